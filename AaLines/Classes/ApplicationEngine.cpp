@@ -1,4 +1,5 @@
 #include "Interfaces.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 using namespace std;
 
@@ -44,11 +45,13 @@ void ApplicationEngine::Initialize(int width, int height)
 
 void ApplicationEngine::Render() const
 {
+    PROFILE_ZONE("ApplicationEngine::Render");
     m_renderingEngine->Render();
 }
 
 void ApplicationEngine::UpdateAnimation(float dt)
 {
+    PROFILE_ZONE("ApplicationEngine::UpdateAnimation");
     m_timestamp += dt;
     m_renderingEngine->UpdateAnimation(m_timestamp);
 }
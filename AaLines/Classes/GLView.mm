@@ -1,5 +1,15 @@
 #import "GLView.h"
+#include "../../Common/Classes/Profiler.hpp"
 #import <OpenGLES/ES2/gl.h> // <-- for GL_RENDERBUFFER only
+#import <string>
+
+std::string GetResourcePath(const std::string& file)
+{
+    NSString* basePath = [NSString stringWithUTF8String:file.c_str()];
+    NSString* resourcePath = [[NSBundle mainBundle] resourcePath];
+    NSString* fullPath = [resourcePath stringByAppendingPathComponent:basePath];
+    return [fullPath UTF8String];
+}
 
 @implementation GLView
 
@@ -58,6 +68,7 @@
     
     m_applicationEngine->Render();
     [m_context presentRenderbuffer:GL_RENDERBUFFER];
+    PROFILE_FRAME();
 }
 
 - (void) touchesBegan: (NSSet*) touches withEvent: (UIEvent*) event
@@ -2,9 +2,10 @@
 #include <OpenGLES/ES1/glext.h>
 #include "Interfaces.hpp"
 #include "Matrix.hpp"
-#include "../Textures/BlurryCircle.h"
-#include "../Textures/Circle.h"
-#include "../Textures/Tile.h"
+#include "../../Common/Classes/AssetPack.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include "../../Common/Classes/PvrUpload.hpp"
+#include <string>
 #include <vector>
 
 const int JointCount = 18;
@@ -12,40 +13,12 @@ extern const float ShortMoCap[21][JointCount][3];
 extern const float LongMoCap[653][JointCount][3];
 extern const unsigned short StickFigureIndices[17 * 2];
 
+std::string GetResourcePath(const std::string& file);
+
 using namespace std;
 
 namespace ES1 {
 
-struct PVRTextureHeader {
-    unsigned int HeaderSize;
-    unsigned int Height;
-    unsigned int Width;
-    unsigned int MipMapCount;
-    unsigned int Flags;
-    unsigned int TextureDataSize;
-    unsigned int BitCount;
-    unsigned int RBitMask;
-    unsigned int GBitMask;
-    unsigned int BBitMask;
-    unsigned int AlphaBitMask;
-    unsigned int PVR;
-    unsigned int NumSurfs;
-};
-
-enum PVRPixelType {
-    OGL_RGBA_4444 = 0x10,
-    OGL_RGBA_5551,
-    OGL_RGBA_8888,
-    OGL_RGB_565,
-    OGL_RGB_555,
-    OGL_RGB_888,
-    OGL_I_8,
-    OGL_AI_88,
-    OGL_PVRTC2,
-    OGL_PVRTC4,
-    PVRTEX_PIXELTYPE = 0xff,
-};
-
 enum DemoState {
     DemoStateAaLines,
     DemoStateNormalLines,
@@ -88,7 +61,7 @@ public:
     void Render() const;
     void UpdateAnimation(float timestamp);
 private:
-    GLuint CreateTexture(const unsigned long* data);
+    GLuint CreateTexture(const void* data, size_t size);
     
     void GenerateTriangleIndices(size_t lineCount, IndexList& triangles) const;
     void GenerateTriangleTexCoords(StickFigure& triangles) const;
@@ -104,6 +77,7 @@ private:
     StickFigure m_stickFigure;
     StickFigure m_aaStickFigure;
     DemoState m_demoState;
+    AssetPack m_assets;
 };
 
 IRenderingEngine* CreateRenderingEngine()
@@ -163,10 +137,20 @@ void RenderingEngine::Initialize()
     // Initialize the demo state.
     m_demoState = DemoStateAaLines;
     
-    // Load up some textures.
-    m_textures.Tile = CreateTexture(Tile);
-    m_textures.Circle = CreateTexture(Circle);
-    m_textures.BlurryCircle = CreateTexture(BlurryCircle);
+    // Load up some textures.  The pack stays mapped, but once GL has a copy
+    // of each texture its pages can go.
+    string packPath = GetResourcePath("Textures.pack");
+    if (m_assets.Open(packPath.c_str()) != AssetPackErrorNone)
+        printf("%s: %s.\n", packPath.c_str(), AssetPack::GetErrorString(m_assets.GetError()));
+    AssetEntry tile = m_assets.Find("Tile");
+    AssetEntry circle = m_assets.Find("Circle");
+    AssetEntry blurryCircle = m_assets.Find("BlurryCircle");
+    m_textures.Tile = CreateTexture(tile.Data, tile.Size);
+    m_textures.Circle = CreateTexture(circle.Data, circle.Size);
+    m_textures.BlurryCircle = CreateTexture(blurryCircle.Data, blurryCircle.Size);
+    m_assets.Release(tile);
+    m_assets.Release(circle);
+    m_assets.Release(blurryCircle);
 
     // Extract width and height from the color buffer.
     ivec2 screenSize;
@@ -203,6 +187,7 @@ void RenderingEngine::Initialize()
     
 void RenderingEngine::UpdateAnimation(float timestamp)
 {
+    PROFILE_ZONE("ES1::RenderingEngine::UpdateAnimation");
     int timeIndex = (int) (timestamp * 40.0f);
     
     //timeIndex = 63 + 57 + 653 + 653;
@@ -243,6 +228,7 @@ void RenderingEngine::UpdateAnimation(float timestamp)
 
 void RenderingEngine::Render() const
 {
+    PROFILE_ZONE("ES1::RenderingEngine::Render");
     GLsizei stride = sizeof(Vertex);
 
     // Set up camera:
@@ -372,41 +358,19 @@ void RenderingEngine::GenerateTriangleTexCoords(StickFigure& triangles) const
     }
 }
 
-GLuint RenderingEngine::CreateTexture(const unsigned long* data)
+GLuint RenderingEngine::CreateTexture(const void* data, size_t size)
 {
-    PVRTextureHeader* header = (PVRTextureHeader*) data;
-    GLsizei w = header->Width;
-    GLsizei h = header->Height;
-    const unsigned long* texels = data + header->HeaderSize / 4;
+    PvrTexture texture;
+    texture.Parse(data, size);
+    assert(texture.IsValid() && "Bad texture.");
 
     GLuint name;
     glGenTextures(1, &name);
     glBindTexture(GL_TEXTURE_2D, name);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    
-    switch (header->Flags & PVRTEX_PIXELTYPE) {
-        case OGL_I_8: {
-            GLenum format = GL_ALPHA;
-            GLenum type = GL_UNSIGNED_BYTE;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_RGB_565: {
-            GLenum format = GL_RGB;
-            GLenum type = GL_UNSIGNED_SHORT_5_6_5;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_PVRTC4: {
-            GLsizei size = max(32, w * h / 2);
-            GLenum format = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG;
-            glCompressedTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, size, data);
-            break;
-        }
-        default:
-            printf("Unknown format.\n");
-    }
+    if (!UploadPvrTexture(texture))
+        printf("Unknown format.\n");
 
     return name;
 }
@@ -1,30 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT static const unsigned long
-#endif
-
-A32BIT BlurryCircle[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x00000010,		/* dwHeight */
-0x00000010,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00010016,		/* dwpfFlags */
-0x00000100,		/* dwDataSize */
-0x00000008,		/* dwBitCount */
-0x000000ff,		/* dwRBitMask */
-0x000000ff,		/* dwGBitMask */
-0x000000ff,		/* dwBBitMask */
-0x00000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x59300100,0x00003059,0x00000000,0x281d0000,0x5251483c,0x3c485152,0x00001d28,0x37280000,0x7c746352,0x5263747c,0x00002836,0x523c0000,0x9a938472,0x7284939a,0x00003c52,0x64490100,0xb3ab9a84,0x849aabb3,0x00014863,0x75513300,0xc5bdab93,0x93abbdc5,0x00315174,0x7d535900,0xcec6b49a,0x9ab3c5ce,0x0058527c,
-0x7d535a00,0xcec6b49a,0x9ab3c5ce,0x0058527c,0x75513400,0xc6beac93,0x93abbdc6,0x00315174,0x64490100,0xb3ab9a84,0x849aabb3,0x00014863,0x533c0000,0x9a938473,0x7284939a,0x00003c52,0x37280000,0x7d756452,0x5264757d,0x00002837,0x281d0000,0x5251493c,0x3c495152,0x00001d28,0x00000000,0x5b310100,0x0001315b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0 };
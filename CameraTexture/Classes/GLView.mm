@@ -1,4 +1,5 @@
 #import "GLView.h"
+#include "../../Common/Classes/Profiler.hpp"
 #import <OpenGLES/ES2/gl.h> // <-- for GL_RENDERBUFFER only
 
 @implementation GLView
@@ -70,6 +71,7 @@
     
     m_renderingEngine->Render(m_zScale, m_xRotation, false);
     [m_context presentRenderbuffer:GL_RENDERBUFFER];
+    PROFILE_FRAME();
 }
 
 - (void) touchesEnded: (NSSet*) touches withEvent: (UIEvent*) event
@@ -124,9 +126,16 @@
 
     int bpp = 4;
     ivec2 size(256, 256);
-    int byteCount = size.x * size.y * bpp;
-    unsigned char* data = (unsigned char*) calloc(byteCount, 1);
+    TextureDescription description;
+    description.Size = size;
+    description.OriginalSize.x = CGImageGetWidth(image.CGImage);
+    description.OriginalSize.y = CGImageGetHeight(image.CGImage);
+    description.Format = TextureFormatRgba;
+    description.BitsPerComponent = 8;
     
+    // Draw straight into the engine's frame buffer, which still holds an
+    // older picture.
+    void* data = m_renderingEngine->BeginCameraFrame(description);
     CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
     CGBitmapInfo bitmapInfo = kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Big;
     CGContextRef context = CGBitmapContextCreate(data,
@@ -138,25 +147,17 @@
                                                  bitmapInfo);
     CGColorSpaceRelease(colorSpace);
     CGRect rect = CGRectMake(0, 0, size.x, size.y);
+    CGContextClearRect(context, rect);
     CGContextTranslateCTM(context, size.x / 2, size.y / 2);
     CGContextRotateCTM(context, theta);
     CGContextTranslateCTM(context, -size.x / 2, -size.y / 2);
     CGContextDrawImage(context, rect, image.CGImage);
+    CGContextRelease(context);
     
-    TextureDescription description;
-    description.Size = size;
-    description.OriginalSize.x = CGImageGetWidth(image.CGImage);
-    description.OriginalSize.y = CGImageGetHeight(image.CGImage);
-    description.Format = TextureFormatRgba;
-    description.BitsPerComponent = 8;
-    
-    m_renderingEngine->LoadCameraTexture(description, data);
+    m_renderingEngine->EndCameraFrame();
     m_renderingEngine->Render(m_zScale, m_xRotation, true);
     [m_context presentRenderbuffer:GL_RENDERBUFFER];
     
-    CGContextRelease(context);
-    free(data);
-    
     [m_viewController dismissModalViewControllerAnimated:NO];
     m_paused = false;
     [picker release];
@@ -41,7 +41,10 @@ struct ISurface {
 struct IRenderingEngine {
     virtual void Initialize() = 0;
     virtual void Render(float zScale, float theta, bool waiting) const = 0;
-    virtual void LoadCameraTexture(const TextureDescription&, void* data) = 0;
+    // The buffer to draw the next camera frame into, from any one thread,
+    // and then hand over; the next Render picks up the newest.
+    virtual void* BeginCameraFrame(const TextureDescription&) = 0;
+    virtual void EndCameraFrame() = 0;
     virtual ~IRenderingEngine() {}
 };
 
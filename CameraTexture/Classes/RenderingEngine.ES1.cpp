@@ -3,10 +3,17 @@
 #include "Interfaces.hpp"
 #include "Matrix.hpp"
 #include "ParametricSurface.hpp"
+#include "../../Common/Classes/MonotonicClock.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include "../../Common/Classes/StreamingTexture.hpp"
 
 #include <iostream>
 using namespace std;
 
+// Camera frames get drawn into a queue's buffers as they arrive, and the
+// newest one goes into a ring of textures when the next frame renders.
+const int CameraFrameSize = 256;
+
 struct Drawable {
     GLuint VertexBuffer;
     GLuint IndexBuffer;
@@ -18,12 +25,13 @@ public:
     RenderingEngine(IResourceManager* resourceManager);
     void Initialize();
     void Render(float zScale, float theta, bool waiting) const;
-    void LoadCameraTexture(const TextureDescription& description, void* data);
+    void* BeginCameraFrame(const TextureDescription& description);
+    void EndCameraFrame();
 private:
     GLuint CreateTexture(const string& file);
     Drawable CreateDrawable(const ParametricSurface& surface);
     void RenderDrawable(const Drawable& drawable) const;
-    void UploadImage(const TextureDescription& description, void* data = 0);
+    void UploadImage(const TextureDescription& description);
     Drawable m_sphere;
     Drawable m_button;
     GLuint m_colorRenderbuffer;
@@ -31,6 +39,8 @@ private:
     GLuint m_cameraTexture;
     GLuint m_waitTexture;
     GLuint m_actionTexture;
+    mutable FrameQueue m_cameraFrames;
+    mutable StreamingTexture m_cameraStream;
     IResourceManager* m_resourceManager;
 };
     
@@ -39,7 +49,8 @@ IRenderingEngine* CreateRenderingEngine(IResourceManager* resourceManager)
     return new RenderingEngine(resourceManager);
 }
 
-RenderingEngine::RenderingEngine(IResourceManager* resourceManager)
+RenderingEngine::RenderingEngine(IResourceManager* resourceManager) :
+    m_cameraFrames(CameraFrameSize * CameraFrameSize * 4)
 {
     m_resourceManager = resourceManager;
     glGenRenderbuffersOES(1, &m_colorRenderbuffer);
@@ -56,6 +67,7 @@ void RenderingEngine::Initialize()
     m_cameraTexture = CreateTexture("Tarsier.png");
     m_waitTexture = CreateTexture("PleaseWait.png");
     m_actionTexture = CreateTexture("TakePicture.png");
+    m_cameraStream.Create(CameraFrameSize, CameraFrameSize, GL_RGBA);
 
     // Extract width and height from the color buffer.
     int width, height;
@@ -112,6 +124,8 @@ void RenderingEngine::Initialize()
 
 void RenderingEngine::Render(float zScale, float theta, bool waiting) const
 {
+    PROFILE_ZONE("RenderingEngine::Render");
+    m_cameraStream.Update(m_cameraFrames);
     glClearColor(0.5f, 0.5f, 0.5f, 1);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     glPushMatrix();
@@ -121,8 +135,9 @@ void RenderingEngine::Render(float zScale, float theta, bool waiting) const
     glBindTexture(GL_TEXTURE_2D, waiting ? m_waitTexture : m_actionTexture);
     RenderDrawable(m_button);
     
-    // Draw the sphere.
-    glBindTexture(GL_TEXTURE_2D, m_cameraTexture);
+    // Draw the sphere, with the tarsier until there's a picture.
+    GLuint cameraTexture = m_cameraStream.GetTexture();
+    glBindTexture(GL_TEXTURE_2D, cameraTexture ? cameraTexture : m_cameraTexture);
     glTranslatef(0, 4.75, 0);
     glRotatef(theta, 1, 0, 0);
     glScalef(1, 1, zScale);
@@ -133,10 +148,16 @@ void RenderingEngine::Render(float zScale, float theta, bool waiting) const
     glPopMatrix();
 }
 
-void RenderingEngine::LoadCameraTexture(const TextureDescription& desc, void* data)
+void* RenderingEngine::BeginCameraFrame(const TextureDescription& description)
 {
-    glBindTexture(GL_TEXTURE_2D, m_cameraTexture);
-    UploadImage(desc, data);
+    assert(description.Format == TextureFormatRgba &&
+           description.Size.x == CameraFrameSize && description.Size.y == CameraFrameSize);
+    return m_cameraFrames.GetBackFrame().Pixels;
+}
+
+void RenderingEngine::EndCameraFrame()
+{
+    m_cameraFrames.Publish(GetMonotonicNanoseconds());
 }
 
 GLuint RenderingEngine::CreateTexture(const string& file)
@@ -198,7 +219,7 @@ void RenderingEngine::RenderDrawable(const Drawable& drawable) const
     glDrawElements(GL_TRIANGLES, drawable.IndexCount, GL_UNSIGNED_SHORT, 0);
 }
 
-void RenderingEngine::UploadImage(const TextureDescription& description, void* data)
+void RenderingEngine::UploadImage(const TextureDescription& description)
 {
     GLenum format;
     switch (description.Format) {
@@ -209,11 +230,7 @@ void RenderingEngine::UploadImage(const TextureDescription& description, void* d
     GLenum type = GL_UNSIGNED_BYTE;
     ivec2 size = description.Size;
     
-    if (data == 0) {
-        data = m_resourceManager->GetImageData();
-        glTexImage2D(GL_TEXTURE_2D, 0, format, size.x, size.y, 0, format, type, data);
-        m_resourceManager->UnloadImage();
-    } else {
-        glTexImage2D(GL_TEXTURE_2D, 0, format, size.x, size.y, 0, format, type, data);
-    }
+    void* data = m_resourceManager->GetImageData();
+    glTexImage2D(GL_TEXTURE_2D, 0, format, size.x, size.y, 0, format, type, data);
+    m_resourceManager->UnloadImage();
 }
\ No newline at end of file
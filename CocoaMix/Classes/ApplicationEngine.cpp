@@ -1,5 +1,6 @@
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 using namespace std;
 
@@ -61,6 +62,7 @@ void ApplicationEngine::Initialize(int width, int height)
 
 void ApplicationEngine::Render() const
 {
+    PROFILE_ZONE("ApplicationEngine::Render");
     vector<Visual> visuals(2);
     
     visuals[0].Color = vec3(0.5, 0.5, 0.5);
@@ -78,6 +80,7 @@ void ApplicationEngine::Render() const
 
 void ApplicationEngine::UpdateAnimation(float dt)
 {
+    PROFILE_ZONE("ApplicationEngine::UpdateAnimation");
     if (m_animating) {
         vec3 axis(0, 1, 0);
         float angle = M_PI / 2;
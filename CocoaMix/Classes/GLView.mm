@@ -1,4 +1,5 @@
 #import "GLView.h"
+#include "../../Common/Classes/Profiler.hpp"
 
 #define GL_RENDERBUFFER 0x8d41
 
@@ -98,6 +99,7 @@
     
     m_applicationEngine->Render();
     [m_context presentRenderbuffer:GL_RENDERBUFFER];
+    PROFILE_FRAME();
 }
 
 - (void) touchesBegan: (NSSet*) touches withEvent: (UIEvent*) event
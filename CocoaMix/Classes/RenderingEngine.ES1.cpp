@@ -2,6 +2,7 @@
 #include <OpenGLES/ES1/glext.h>
 #include "Interfaces.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 #include <iostream>
 using namespace std;
@@ -151,6 +152,7 @@ void RenderingEngine::Initialize(const vector<ISurface*>& surfaces)
 
 void RenderingEngine::Render(const vector<Visual>& visuals) const
 {
+    PROFILE_ZONE("ES1::RenderingEngine::Render");
     glClearColor(0.5f, 0.5f, 0.5f, 1);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -0,0 +1,337 @@
+#pragma once
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// An asset pack is one read-only file holding many named blobs (PVR
+// textures, texture sets, vertex arrays) in place of the C arrays that used
+// to be compiled into each sample.  The file is memory-mapped, so nothing
+// is read until an entry is touched, and pages can be handed back to the
+// system once their contents have been uploaded to GL.
+//
+// The layout is a 16-byte header, a table of records sorted by name, the
+// NUL-terminated names, and then the entries, each aligned to the header's
+// Alignment so that PvrTexture and the vertex arrays can point straight
+// into the mapping.  AssetPacker writes packs and converts the old headers.
+
+struct AssetPackHeader {
+    unsigned int Identifier;
+    unsigned int Version;
+    unsigned int EntryCount;
+    unsigned int Alignment;
+};
+
+struct AssetPackRecord {
+    unsigned int NameOffset;
+    unsigned int Offset;
+    unsigned int Size;
+    unsigned int Reserved;
+};
+
+struct AssetEntry {
+    const void* Data;
+    size_t Size;
+};
+
+enum AssetPackError {
+    AssetPackErrorNone,
+    AssetPackErrorOpen,
+    AssetPackErrorTruncated,
+    AssetPackErrorIdentifier,
+    AssetPackErrorVersion,
+    AssetPackErrorTable,
+};
+
+const unsigned int AssetPackIdentifier = 0x4b415041;
+const unsigned int AssetPackVersion = 1;
+const unsigned int AssetPackDefaultAlignment = 4096;
+
+class AssetPack {
+public:
+    AssetPack();
+    ~AssetPack() { Close(); }
+    AssetPackError Open(const char* path);
+    AssetPackError Parse(const void* blob, size_t blobSize);
+    void Close();
+    bool IsValid() const { return m_error == AssetPackErrorNone; }
+    AssetPackError GetError() const { return m_error; }
+    int GetEntryCount() const { return m_entryCount; }
+    const char* GetEntryName(int index) const;
+    AssetEntry GetEntry(int index) const;
+    AssetEntry Find(const char* name) const;
+    void Release(const AssetEntry& entry) const;
+    static const char* GetErrorString(AssetPackError error);
+private:
+    AssetPack(const AssetPack&);
+    AssetPack& operator=(const AssetPack&);
+    AssetPackError Validate();
+    AssetPackError Fail(AssetPackError error);
+    const unsigned char* m_blob;
+    size_t m_blobSize;
+    void* m_mapping;
+    size_t m_mappingSize;
+    const AssetPackRecord* m_records;
+    int m_entryCount;
+    AssetPackError m_error;
+};
+
+inline AssetPack::AssetPack()
+    : m_blob(0), m_blobSize(0), m_mapping(0), m_mappingSize(0),
+      m_records(0), m_entryCount(0), m_error(AssetPackErrorOpen)
+{
+}
+
+inline AssetPackError AssetPack::Open(const char* path)
+{
+    Close();
+    int file = open(path, O_RDONLY);
+    if (file < 0)
+        return Fail(AssetPackErrorOpen);
+
+    struct stat info;
+    if (fstat(file, &info) != 0 || info.st_size <= 0) {
+        close(file);
+        return Fail(AssetPackErrorOpen);
+    }
+
+    // The mapping survives closing the descriptor.
+    size_t size = info.st_size;
+    void* mapping = mmap(0, size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (mapping == MAP_FAILED)
+        return Fail(AssetPackErrorOpen);
+
+    m_mapping = mapping;
+    m_mappingSize = size;
+    m_blob = (const unsigned char*) mapping;
+    m_blobSize = size;
+    AssetPackError error = Validate();
+    if (error != AssetPackErrorNone) {
+        munmap(m_mapping, m_mappingSize);
+        m_mapping = 0;
+        m_mappingSize = 0;
+    }
+    return error;
+}
+
+// Also accepts a pack that is already in memory, in which case the caller
+// keeps ownership of the blob.
+inline AssetPackError AssetPack::Parse(const void* blob, size_t blobSize)
+{
+    Close();
+    m_blob = (const unsigned char*) blob;
+    m_blobSize = blobSize;
+    return Validate();
+}
+
+inline AssetPackError AssetPack::Validate()
+{
+    size_t blobSize = m_blobSize;
+    AssetPackHeader header;
+    if (!m_blob || blobSize < sizeof(header))
+        return Fail(AssetPackErrorTruncated);
+    memcpy(&header, m_blob, sizeof(header));
+    if (header.Identifier != AssetPackIdentifier)
+        return Fail(AssetPackErrorIdentifier);
+    if (header.Version != AssetPackVersion)
+        return Fail(AssetPackErrorVersion);
+
+    size_t namesBegin = sizeof(header) + (size_t) header.EntryCount * sizeof(AssetPackRecord);
+    if (header.EntryCount > blobSize / sizeof(AssetPackRecord) || namesBegin > blobSize)
+        return Fail(AssetPackErrorTruncated);
+    if ((size_t) m_blob % sizeof(unsigned int))
+        return Fail(AssetPackErrorTable);
+
+    // Names must be terminated inside the file, and sorted for Find.
+    m_records = (const AssetPackRecord*) (m_blob + sizeof(header));
+    for (unsigned int i = 0; i < header.EntryCount; ++i) {
+        const AssetPackRecord& record = m_records[i];
+        if (record.NameOffset < namesBegin || record.NameOffset >= blobSize)
+            return Fail(AssetPackErrorTable);
+        const void* end = memchr(m_blob + record.NameOffset, 0, blobSize - record.NameOffset);
+        if (!end)
+            return Fail(AssetPackErrorTable);
+        if (record.Offset > blobSize || record.Size > blobSize - record.Offset)
+            return Fail(AssetPackErrorTruncated);
+        if (i > 0 && strcmp((const char*) m_blob + m_records[i - 1].NameOffset,
+                            (const char*) m_blob + record.NameOffset) >= 0)
+            return Fail(AssetPackErrorTable);
+    }
+
+    m_entryCount = header.EntryCount;
+    m_error = AssetPackErrorNone;
+    return m_error;
+}
+
+inline void AssetPack::Close()
+{
+    if (m_mapping)
+        munmap(m_mapping, m_mappingSize);
+    m_mapping = 0;
+    m_mappingSize = 0;
+    m_blob = 0;
+    m_blobSize = 0;
+    Fail(AssetPackErrorOpen);
+}
+
+inline AssetPackError AssetPack::Fail(AssetPackError error)
+{
+    m_error = error;
+    m_records = 0;
+    m_entryCount = 0;
+    return error;
+}
+
+inline const char* AssetPack::GetEntryName(int index) const
+{
+    assert(index >= 0 && index < m_entryCount);
+    return (const char*) m_blob + m_records[index].NameOffset;
+}
+
+inline AssetEntry AssetPack::GetEntry(int index) const
+{
+    assert(index >= 0 && index < m_entryCount);
+    AssetEntry entry;
+    entry.Data = m_blob + m_records[index].Offset;
+    entry.Size = m_records[index].Size;
+    return entry;
+}
+
+// Returns a null entry if the name isn't in the pack.
+inline AssetEntry AssetPack::Find(const char* name) const
+{
+    int low = 0, high = m_entryCount - 1;
+    while (low <= high) {
+        int middle = (low + high) / 2;
+        int order = strcmp(GetEntryName(middle), name);
+        if (order == 0)
+            return GetEntry(middle);
+        if (order < 0)
+            low = middle + 1;
+        else
+            high = middle - 1;
+    }
+    AssetEntry entry = { 0, 0 };
+    return entry;
+}
+
+// Tells the system that an entry won't be needed for a while, typically
+// right after it has been uploaded.  Only whole pages inside the entry are
+// dropped; touching the entry again faults them back in from the file.
+inline void AssetPack::Release(const AssetEntry& entry) const
+{
+    if (!m_mapping || !entry.Data)
+        return;
+    size_t page = getpagesize();
+    size_t begin = ((size_t) entry.Data + page - 1) & ~(page - 1);
+    size_t end = ((size_t) entry.Data + entry.Size) & ~(page - 1);
+    if (end > begin)
+        madvise((void*) begin, end - begin, MADV_DONTNEED);
+}
+
+inline const char* AssetPack::GetErrorString(AssetPackError error)
+{
+    switch (error) {
+        case AssetPackErrorNone: return "No error";
+        case AssetPackErrorOpen: return "Unable to open";
+        case AssetPackErrorTruncated: return "Truncated pack";
+        case AssetPackErrorIdentifier: return "Not an asset pack";
+        case AssetPackErrorVersion: return "Unsupported version";
+        case AssetPackErrorTable: return "Corrupt entry table";
+    }
+    return "Unknown error";
+}
+
+// Builds asset packs for the offline tools.
+class AssetPackWriter {
+public:
+    AssetPackWriter(unsigned int alignment = AssetPackDefaultAlignment)
+        : m_alignment(alignment) {}
+    bool AddEntry(const std::string& name, const std::vector<unsigned char>& data);
+    int GetEntryCount() const { return m_entries.size(); }
+    void Write(std::vector<unsigned char>& blob) const;
+    bool WriteFile(const char* path) const;
+private:
+    struct Entry {
+        std::string Name;
+        std::vector<unsigned char> Data;
+        bool operator<(const Entry& other) const { return Name < other.Name; }
+    };
+    unsigned int m_alignment;
+    std::vector<Entry> m_entries;
+};
+
+// Returns false if the name is empty or already taken.
+inline bool AssetPackWriter::AddEntry(const std::string& name,
+                                      const std::vector<unsigned char>& data)
+{
+    if (name.empty())
+        return false;
+    for (size_t i = 0; i < m_entries.size(); ++i)
+        if (m_entries[i].Name == name)
+            return false;
+    Entry entry;
+    entry.Name = name;
+    entry.Data = data;
+    m_entries.push_back(entry);
+    return true;
+}
+
+inline void AssetPackWriter::Write(std::vector<unsigned char>& blob) const
+{
+    // Sort with strcmp order, which std::string's operator< matches.
+    std::vector<Entry> entries(m_entries);
+    std::sort(entries.begin(), entries.end());
+
+    AssetPackHeader header;
+    header.Identifier = AssetPackIdentifier;
+    header.Version = AssetPackVersion;
+    header.EntryCount = entries.size();
+    header.Alignment = m_alignment;
+
+    std::vector<AssetPackRecord> records(entries.size());
+    size_t offset = sizeof(header) + records.size() * sizeof(AssetPackRecord);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        records[i].NameOffset = offset;
+        offset += entries[i].Name.size() + 1;
+    }
+    for (size_t i = 0; i < entries.size(); ++i) {
+        offset = (offset + m_alignment - 1) / m_alignment * m_alignment;
+        records[i].Offset = offset;
+        records[i].Size = entries[i].Data.size();
+        records[i].Reserved = 0;
+        offset += entries[i].Data.size();
+    }
+
+    const unsigned char* bytes = (const unsigned char*) &header;
+    blob.assign(bytes, bytes + sizeof(header));
+    if (!records.empty()) {
+        bytes = (const unsigned char*) &records[0];
+        blob.insert(blob.end(), bytes, bytes + records.size() * sizeof(AssetPackRecord));
+    }
+    for (size_t i = 0; i < entries.size(); ++i)
+        blob.insert(blob.end(), entries[i].Name.c_str(),
+                    entries[i].Name.c_str() + entries[i].Name.size() + 1);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        blob.resize(records[i].Offset, 0);
+        blob.insert(blob.end(), entries[i].Data.begin(), entries[i].Data.end());
+    }
+}
+
+inline bool AssetPackWriter::WriteFile(const char* path) const
+{
+    std::vector<unsigned char> blob;
+    Write(blob);
+    FILE* file = fopen(path, "wb");
+    if (!file)
+        return false;
+    bool ok = fwrite(&blob[0], 1, blob.size(), file) == blob.size();
+    return fclose(file) == 0 && ok;
+}
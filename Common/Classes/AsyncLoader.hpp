@@ -0,0 +1,310 @@
+#pragma once
+#include <cassert>
+#include <deque>
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+// Loads images in the background so that the first frame doesn't wait on
+// every texture.  A pool of worker threads decodes each request into a
+// buffer it owns; the render thread then uploads whatever's ready, up to a
+// byte budget per frame, and asks each handle for its texture as it goes.
+//
+//     AsyncLoader loader(decoder, 2);
+//     LoadHandle sky = loader.Load("Sky.pvr", LoadPriorityHigh);
+//
+//     every frame:
+//     loader.Upload(uploader, 512 * 1024);
+//     glBindTexture(GL_TEXTURE_2D, loader.GetTexture(sky));   // 0 until it's in
+//
+// Nothing here touches GL.  The decoder runs on the workers and must be
+// safe to call from several threads at once.  Everything else, uploads
+// included, belongs to one thread, usually the render thread.
+
+enum LoadPriority {
+    LoadPriorityHigh,
+    LoadPriorityNormal,
+    LoadPriorityLow,
+    LoadPriorityCount,
+};
+
+enum LoadState {
+    LoadStateQueued,
+    LoadStateDecoding,
+    LoadStateDecoded,
+    LoadStateUploaded,
+    LoadStateFailed,
+};
+
+typedef int LoadHandle;
+
+// What a decoder hands to an uploader.  Format is whatever the two agree
+// on, usually the sample's TextureFormat; Pixels holds every mip level.
+struct DecodedImage {
+    DecodedImage() : Format(0), BitsPerComponent(0), Width(0), Height(0), MipCount(1) {}
+    int Format;
+    int BitsPerComponent;
+    int Width;
+    int Height;
+    int MipCount;
+    std::vector<unsigned char> Pixels;
+};
+
+struct IImageDecoder {
+    virtual bool Decode(const std::string& name, DecodedImage& image) = 0;
+    virtual ~IImageDecoder() {}
+};
+
+// Returns a texture name, or 0 if the image couldn't be uploaded.  It can
+// keep the pixels, by swapping them out, if it needs them later.
+struct IImageUploader {
+    virtual unsigned int Upload(DecodedImage& image) = 0;
+    virtual ~IImageUploader() {}
+};
+
+class AsyncLoader {
+public:
+    AsyncLoader(IImageDecoder* decoder, int threadCount);
+    ~AsyncLoader();
+    LoadHandle Load(const std::string& name, LoadPriority priority);
+    LoadState GetState(LoadHandle handle) const;
+    unsigned int GetTexture(LoadHandle handle) const;
+    int GetPendingCount() const;
+    int Upload(IImageUploader& uploader, size_t byteBudget);
+    void Finish(IImageUploader& uploader);
+private:
+    struct Request {
+        std::string Name;
+        LoadPriority Priority;
+        LoadState State;
+        unsigned int Texture;
+        DecodedImage Image;
+    };
+    static void* WorkerThread(void* context);
+    void Work();
+    bool DecodeNext();
+    LoadHandle PeekDecoded(size_t* byteCount) const;
+    IImageDecoder* m_decoder;
+    std::vector<pthread_t> m_threads;
+    mutable pthread_mutex_t m_mutex;
+    pthread_cond_t m_queued;            // workers wait on this for requests
+    pthread_cond_t m_decoded;           // Finish waits on this for images
+    std::deque<Request> m_requests;     // a deque, so workers' references stay put
+    std::deque<LoadHandle> m_waiting[LoadPriorityCount];
+    std::deque<LoadHandle> m_ready[LoadPriorityCount];
+    int m_pending;
+    bool m_stopping;
+};
+
+// With no threads, Upload decodes one request per call itself, which is
+// handy on a single core and for comparing against the threaded path.
+inline AsyncLoader::AsyncLoader(IImageDecoder* decoder, int threadCount) :
+    m_decoder(decoder),
+    m_threads(threadCount > 0 ? threadCount : 0),
+    m_pending(0),
+    m_stopping(false)
+{
+    assert(decoder);
+    pthread_mutex_init(&m_mutex, 0);
+    pthread_cond_init(&m_queued, 0);
+    pthread_cond_init(&m_decoded, 0);
+
+    // Decoding can wait; the render thread can't, so on a single core the
+    // workers should get the processor only when it's idle.
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+    int policy;
+    sched_param parameters;
+    pthread_getschedparam(pthread_self(), &policy, &parameters);
+    parameters.sched_priority = sched_get_priority_min(policy);
+    pthread_attr_setschedpolicy(&attributes, policy);
+    pthread_attr_setschedparam(&attributes, &parameters);
+    pthread_attr_setinheritsched(&attributes, PTHREAD_EXPLICIT_SCHED);
+    for (size_t i = 0; i < m_threads.size(); ++i)
+        if (pthread_create(&m_threads[i], &attributes, WorkerThread, this))
+            pthread_create(&m_threads[i], 0, WorkerThread, this);
+    pthread_attr_destroy(&attributes);
+}
+
+// Requests still waiting are dropped; the workers finish the ones they
+// started.  Textures already uploaded belong to the caller.
+inline AsyncLoader::~AsyncLoader()
+{
+    pthread_mutex_lock(&m_mutex);
+    m_stopping = true;
+    pthread_cond_broadcast(&m_queued);
+    pthread_mutex_unlock(&m_mutex);
+    for (size_t i = 0; i < m_threads.size(); ++i)
+        pthread_join(m_threads[i], 0);
+    pthread_cond_destroy(&m_decoded);
+    pthread_cond_destroy(&m_queued);
+    pthread_mutex_destroy(&m_mutex);
+}
+
+inline LoadHandle AsyncLoader::Load(const std::string& name, LoadPriority priority)
+{
+    assert(priority >= 0 && priority < LoadPriorityCount);
+    pthread_mutex_lock(&m_mutex);
+    LoadHandle handle = m_requests.size();
+    m_requests.push_back(Request());
+    Request& request = m_requests.back();
+    request.Name = name;
+    request.Priority = priority;
+    request.State = LoadStateQueued;
+    request.Texture = 0;
+    m_waiting[priority].push_back(handle);
+    ++m_pending;
+    pthread_cond_signal(&m_queued);
+    pthread_mutex_unlock(&m_mutex);
+    return handle;
+}
+
+inline LoadState AsyncLoader::GetState(LoadHandle handle) const
+{
+    pthread_mutex_lock(&m_mutex);
+    assert(handle >= 0 && handle < (int) m_requests.size());
+    LoadState state = m_requests[handle].State;
+    pthread_mutex_unlock(&m_mutex);
+    return state;
+}
+
+// Only the uploading thread writes the texture, so it can read it freely.
+inline unsigned int AsyncLoader::GetTexture(LoadHandle handle) const
+{
+    assert(handle >= 0 && handle < (int) m_requests.size());
+    return m_requests[handle].Texture;
+}
+
+// Requests that are neither uploaded nor failed.
+inline int AsyncLoader::GetPendingCount() const
+{
+    pthread_mutex_lock(&m_mutex);
+    int pending = m_pending;
+    pthread_mutex_unlock(&m_mutex);
+    return pending;
+}
+
+// Uploads decoded images, most important first, until the next one would
+// go over the budget.  The first one always goes so that a large image
+// can't hold everything up.  Returns how many were uploaded.
+inline int AsyncLoader::Upload(IImageUploader& uploader, size_t byteBudget)
+{
+    if (m_threads.empty()) {
+        pthread_mutex_lock(&m_mutex);
+        DecodeNext();
+        pthread_mutex_unlock(&m_mutex);
+    }
+
+    int uploaded = 0;
+    size_t spent = 0;
+    for (;;) {
+        size_t byteCount;
+        pthread_mutex_lock(&m_mutex);
+        LoadHandle handle = PeekDecoded(&byteCount);
+        if (handle < 0 || (uploaded && spent + byteCount > byteBudget)) {
+            pthread_mutex_unlock(&m_mutex);
+            break;
+        }
+        Request& request = m_requests[handle];
+        m_ready[request.Priority].pop_front();
+        pthread_mutex_unlock(&m_mutex);
+
+        // The image is ours now; the workers are done with it.
+        unsigned int texture = uploader.Upload(request.Image);
+        std::vector<unsigned char>().swap(request.Image.Pixels);
+        spent += byteCount;
+        ++uploaded;
+
+        pthread_mutex_lock(&m_mutex);
+        request.Texture = texture;
+        request.State = texture ? LoadStateUploaded : LoadStateFailed;
+        --m_pending;
+        pthread_mutex_unlock(&m_mutex);
+    }
+    return uploaded;
+}
+
+// Blocks until every request so far is uploaded or has failed.
+inline void AsyncLoader::Finish(IImageUploader& uploader)
+{
+    for (;;) {
+        while (Upload(uploader, (size_t) -1))
+            ;
+        pthread_mutex_lock(&m_mutex);
+        while (m_pending && PeekDecoded(0) < 0 && !m_threads.empty())
+            pthread_cond_wait(&m_decoded, &m_mutex);
+        bool done = !m_pending;
+        pthread_mutex_unlock(&m_mutex);
+        if (done)
+            return;
+    }
+}
+
+inline void* AsyncLoader::WorkerThread(void* context)
+{
+    ((AsyncLoader*) context)->Work();
+    return 0;
+}
+
+inline void AsyncLoader::Work()
+{
+    pthread_mutex_lock(&m_mutex);
+    while (!m_stopping) {
+        if (!DecodeNext())
+            pthread_cond_wait(&m_queued, &m_mutex);
+    }
+    pthread_mutex_unlock(&m_mutex);
+}
+
+// Decodes the most important request waiting, if there is one.  Call with
+// the mutex held; it's let go while the decoder runs.
+inline bool AsyncLoader::DecodeNext()
+{
+    int priority = 0;
+    while (priority < LoadPriorityCount && m_waiting[priority].empty())
+        ++priority;
+    if (priority == LoadPriorityCount)
+        return false;
+
+    LoadHandle handle = m_waiting[priority].front();
+    m_waiting[priority].pop_front();
+    Request& request = m_requests[handle];
+    request.State = LoadStateDecoding;
+    std::string name = request.Name;
+    pthread_mutex_unlock(&m_mutex);
+
+    DecodedImage image;
+    bool decoded = m_decoder->Decode(name, image);
+
+    pthread_mutex_lock(&m_mutex);
+    if (decoded) {
+        request.Image.Format = image.Format;
+        request.Image.BitsPerComponent = image.BitsPerComponent;
+        request.Image.Width = image.Width;
+        request.Image.Height = image.Height;
+        request.Image.MipCount = image.MipCount;
+        request.Image.Pixels.swap(image.Pixels);
+        request.State = LoadStateDecoded;
+        m_ready[priority].push_back(handle);
+    } else {
+        request.State = LoadStateFailed;
+        --m_pending;
+    }
+    pthread_cond_broadcast(&m_decoded);
+    return true;
+}
+
+// The most important decoded image, without taking it, or -1.  Call with
+// the mutex held.
+inline LoadHandle AsyncLoader::PeekDecoded(size_t* byteCount) const
+{
+    for (int priority = 0; priority < LoadPriorityCount; ++priority) {
+        if (m_ready[priority].empty())
+            continue;
+        LoadHandle handle = m_ready[priority].front();
+        if (byteCount)
+            *byteCount = m_requests[handle].Image.Pixels.size();
+        return handle;
+    }
+    return -1;
+}
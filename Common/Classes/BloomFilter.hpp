@@ -0,0 +1,523 @@
+#pragma once
+#include "ParallelFor.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define BLOOM_FILTER_SSE2
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define BLOOM_FILTER_NEON
+#endif
+
+// The GaussianBloom pass chain on the CPU, for golden images and for post-
+// processing video offline.  Like the sample, it renders each level into
+// RGBA8 and the passes go:
+//
+//     level 0 = high-pass of the scene, at full size
+//     level i = level i - 1 at half the size, bilinearly filtered
+//     blur each level from FirstBlurred on, horizontally then vertically
+//     result = scene + the levels from FirstAccumulated on, bilinearly
+//              scaled up and added with saturation
+//
+// Blurs use 8.8 fixed point weights that add up to exactly one, with SSE2
+// or NEON where there is one, and rows are split across threads.
+
+// A sample a shader takes from a blur kernel; offsets are in texels, and
+// between two texels means bilinear filtering blends them.
+struct BloomSample {
+    float Offset;
+    float Weight;
+};
+
+// A symmetric blur kernel.  Pairs of neighboring taps fold into one
+// bilinear sample, so a 5-tap kernel takes the shader 3 texture reads.
+class BloomKernel {
+public:
+    static BloomKernel Binomial(int taps);
+    static BloomKernel Gaussian(int radius, float sigma);
+    int GetRadius() const { return (int) m_weights.size() - 1; }
+    // Weight of the texel this far from the center, in either direction.
+    float GetWeight(int offset) const { return m_weights[offset < 0 ? -offset : offset]; }
+    // Samples for the center and one side, center first; the other side
+    // mirrors them.
+    std::vector<BloomSample> GetSamples() const;
+private:
+    explicit BloomKernel(const std::vector<double>& weights);
+    std::vector<float> m_weights;
+};
+
+enum BloomFormat {
+    BloomFormatRgba8,
+    BloomFormatRgb565,
+};
+
+struct BloomImage {
+    BloomImage() : Width(0), Height(0), Format(BloomFormatRgba8) {}
+    void Resize(int width, int height, BloomFormat format = BloomFormatRgba8)
+    {
+        Width = width;
+        Height = height;
+        Format = format;
+        Texels.assign(width * height * GetBytesPerPixel(), 0);
+    }
+    int GetBytesPerPixel() const { return Format == BloomFormatRgb565 ? 2 : 4; }
+    int Width;
+    int Height;
+    BloomFormat Format;
+    std::vector<unsigned char> Texels;
+};
+
+// Where GL_LINEAR and GL_CLAMP_TO_EDGE sample each texel along one axis
+// when scaling: between texels First and Second, Fraction / 256 of the way.
+struct BloomAxis {
+    void Resize(int sourceSize, int targetSize);
+    std::vector<int> First;
+    std::vector<int> Second;
+    std::vector<int> Fraction;
+};
+
+// The defaults are what GaussianBloom does.
+struct BloomOptions {
+    BloomOptions() :
+        LevelCount(5), FirstBlurred(2), FirstAccumulated(1), Threshold(0.85f),
+        ThreadCount(1), Simd(true) {}
+    int LevelCount;
+    int FirstBlurred;
+    int FirstAccumulated;
+    float Threshold;
+    int ThreadCount;
+    bool Simd;
+};
+
+class BloomFilter {
+public:
+    BloomFilter(const BloomKernel& kernel, const BloomOptions& options = BloomOptions());
+    // The result has the scene's size and format.
+    void Apply(const BloomImage& scene, BloomImage& result);
+    int GetLevelCount() const { return (int) m_levels.size(); }
+    const BloomImage& GetLevel(int level) const { return m_levels[level]; }
+private:
+    typedef void (BloomFilter::*Stage)(int begin, int end);
+    struct Job {
+        BloomFilter* Filter;
+        Stage Method;
+        void operator()(int begin, int end) { (Filter->*Method)(begin, end); }
+    };
+    struct Tap {
+        int Offset;
+        unsigned short Weight;
+    };
+    void Run(Stage stage, int count);
+    void Unpack(int firstRow, int lastRow);
+    void HighPass(int firstRow, int lastRow);
+    void Downsample(int firstRow, int lastRow);
+    void BlurRows(int firstRow, int lastRow);
+    void BlurColumns(int firstRow, int lastRow);
+    void Composite(int firstRow, int lastRow);
+    void WeightedSum(const unsigned char* const* sources, int bytes, unsigned char* target) const;
+    // The last two source rows scaled across, for the target rows after.
+    struct RowCache {
+        RowCache() : Next(0) { Rows[0] = Rows[1] = -1; }
+        int Rows[2];
+        std::vector<unsigned short> Texels[2];
+        int Next;
+    };
+    const unsigned short* ScaleRow(const BloomImage& source, const BloomAxis& columns, int row,
+                                   RowCache& cache) const;
+    void AddSamples(const BloomImage& source, const BloomAxis& columns, const BloomAxis& rows,
+                    int y, RowCache& cache, int* sums) const;
+    std::vector<Tap> m_taps;
+    BloomOptions m_options;
+    std::vector<BloomImage> m_levels;
+    std::vector<BloomAxis> m_levelColumns;
+    std::vector<BloomAxis> m_levelRows;
+    std::vector<BloomAxis> m_sceneColumns;
+    std::vector<BloomAxis> m_sceneRows;
+    BloomImage m_blurred;
+    BloomImage m_unpacked;
+    const BloomImage* m_scene;
+    BloomImage* m_result;
+    int m_level;
+};
+
+inline void BloomAxis::Resize(int sourceSize, int targetSize)
+{
+    First.resize(targetSize);
+    Second.resize(targetSize);
+    Fraction.resize(targetSize);
+    float scale = (float) sourceSize / targetSize;
+    for (int i = 0; i < targetSize; ++i) {
+        float position = (i + 0.5f) * scale - 0.5f;
+        position = position < 0 ? 0 : position;
+        int first = (int) position;
+        Fraction[i] = (int) ((position - first) * 256);
+        First[i] = first < sourceSize ? first : sourceSize - 1;
+        Second[i] = first + 1 < sourceSize ? first + 1 : sourceSize - 1;
+    }
+}
+
+inline BloomKernel::BloomKernel(const std::vector<double>& weights)
+{
+    double total = weights[0];
+    for (size_t i = 1; i < weights.size(); ++i)
+        total += 2 * weights[i];
+    for (size_t i = 0; i < weights.size(); ++i)
+        m_weights.push_back((float) (weights[i] / total));
+}
+
+// A row of Pascal's triangle, which GaussianBloom's 5/16, 6/16, 5/16 at
+// 1.2 texels is the 5-tap fold of.
+inline BloomKernel BloomKernel::Binomial(int taps)
+{
+    int radius = taps / 2;
+    std::vector<double> row(1, 1.0);
+    for (int n = 1; n < radius * 2 + 1; ++n) {
+        row.push_back(0);
+        for (int k = n; k > 0; --k)
+            row[k] += row[k - 1];
+    }
+    return BloomKernel(std::vector<double>(row.begin() + radius, row.end()));
+}
+
+inline BloomKernel BloomKernel::Gaussian(int radius, float sigma)
+{
+    std::vector<double> weights;
+    for (int i = 0; i <= radius; ++i)
+        weights.push_back(std::exp(-0.5 * i * i / ((double) sigma * sigma)));
+    return BloomKernel(weights);
+}
+
+// Texels i and i + 1 blend into one sample at i + w[i + 1] / (w[i] + w[i + 1]),
+// which a bilinear read weighs the same as reading the two separately.
+inline std::vector<BloomSample> BloomKernel::GetSamples() const
+{
+    std::vector<BloomSample> samples;
+    BloomSample center = { 0, m_weights[0] };
+    samples.push_back(center);
+    for (int i = 1; i <= GetRadius(); i += 2) {
+        BloomSample sample = { (float) i, m_weights[i] };
+        if (i < GetRadius()) {
+            sample.Weight += m_weights[i + 1];
+            sample.Offset += m_weights[i + 1] / sample.Weight;
+        }
+        samples.push_back(sample);
+    }
+    return samples;
+}
+
+// The taps come from the folded samples, split back into texels the way
+// bilinear filtering splits them, and rounded so they add up to exactly 256.
+inline BloomFilter::BloomFilter(const BloomKernel& kernel, const BloomOptions& options) :
+    m_options(options), m_scene(0), m_result(0), m_level(0)
+{
+    int radius = kernel.GetRadius();
+    std::vector<float> weights(radius + 2, 0.0f);
+    std::vector<BloomSample> samples = kernel.GetSamples();
+    weights[0] = samples[0].Weight;
+    for (size_t i = 1; i < samples.size(); ++i) {
+        int texel = (int) samples[i].Offset;
+        float fraction = samples[i].Offset - texel;
+        weights[texel] += samples[i].Weight * (1 - fraction);
+        weights[texel + 1] += samples[i].Weight * fraction;
+    }
+
+    int total = 0;
+    for (int offset = -radius; offset <= radius; ++offset) {
+        Tap tap = { offset, (unsigned short) (weights[abs(offset)] * 256 + 0.5f) };
+        total += tap.Weight;
+        m_taps.push_back(tap);
+    }
+    m_taps[radius].Weight += 256 - total;
+
+    std::vector<Tap> taps;
+    for (size_t i = 0; i < m_taps.size(); ++i)
+        if (m_taps[i].Weight)
+            taps.push_back(m_taps[i]);
+    m_taps.swap(taps);
+}
+
+inline void BloomFilter::Run(Stage stage, int count)
+{
+    Job job = { this, stage };
+    ParallelFor(count, m_options.ThreadCount, job);
+}
+
+inline void BloomFilter::Apply(const BloomImage& scene, BloomImage& result)
+{
+    m_scene = &scene;
+    if (scene.Format == BloomFormatRgb565) {
+        m_unpacked.Resize(scene.Width, scene.Height);
+        Run(&BloomFilter::Unpack, scene.Height);
+        m_scene = &m_unpacked;
+    }
+
+    int width = scene.Width, height = scene.Height;
+    m_levels.resize(m_options.LevelCount);
+    m_levelColumns.resize(m_options.LevelCount);
+    m_levelRows.resize(m_options.LevelCount);
+    m_sceneColumns.resize(m_options.LevelCount);
+    m_sceneRows.resize(m_options.LevelCount);
+    for (int i = 0; i < m_options.LevelCount; ++i, width >>= 1, height >>= 1) {
+        m_level = i;
+        m_levels[i].Resize(width > 1 ? width : 1, height > 1 ? height : 1);
+        const BloomImage& level = m_levels[i];
+        m_sceneColumns[i].Resize(level.Width, scene.Width);
+        m_sceneRows[i].Resize(level.Height, scene.Height);
+        if (i) {
+            m_levelColumns[i].Resize(m_levels[i - 1].Width, level.Width);
+            m_levelRows[i].Resize(m_levels[i - 1].Height, level.Height);
+        }
+        Run(i ? &BloomFilter::Downsample : &BloomFilter::HighPass, m_levels[i].Height);
+    }
+
+    for (int i = m_options.FirstBlurred; i < m_options.LevelCount; ++i) {
+        m_level = i;
+        m_blurred.Resize(m_levels[i].Width, m_levels[i].Height);
+        Run(&BloomFilter::BlurRows, m_levels[i].Height);
+        Run(&BloomFilter::BlurColumns, m_levels[i].Height);
+    }
+
+    m_result = &result;
+    result.Resize(scene.Width, scene.Height, scene.Format);
+    Run(&BloomFilter::Composite, scene.Height);
+}
+
+inline void BloomFilter::Unpack(int firstRow, int lastRow)
+{
+    const unsigned short* source = (const unsigned short*) &m_scene->Texels[0];
+    for (int i = firstRow * m_scene->Width; i < lastRow * m_scene->Width; ++i) {
+        unsigned int texel = source[i];
+        unsigned char* target = &m_unpacked.Texels[i * 4];
+        target[0] = (unsigned char) ((texel >> 11) * 255 / 31);
+        target[1] = (unsigned char) (((texel >> 5) & 63) * 255 / 63);
+        target[2] = (unsigned char) ((texel & 31) * 255 / 31);
+        target[3] = 255;
+    }
+}
+
+// The sample's perceptual weights, scaled so the comparison is in integers.
+inline void BloomFilter::HighPass(int firstRow, int lastRow)
+{
+    int threshold = (int) (m_options.Threshold * 255 * 1000);
+    const unsigned char* source = &m_scene->Texels[0];
+    unsigned char* target = &m_levels[0].Texels[0];
+    for (int i = firstRow * m_scene->Width; i < lastRow * m_scene->Width; ++i) {
+        const unsigned char* texel = source + i * 4;
+        bool bright = 299 * texel[0] + 587 * texel[1] + 114 * texel[2] > threshold;
+        for (int c = 0; c < 3; ++c)
+            target[i * 4 + c] = bright ? texel[c] : 0;
+        target[i * 4 + 3] = bright ? 255 : 0;
+    }
+}
+
+// A source row scaled to the target's width, 256 times over so it's exact.
+// Neighboring target rows mostly sample the same two source rows, so the
+// last two stay around.
+inline const unsigned short* BloomFilter::ScaleRow(const BloomImage& source,
+                                                   const BloomAxis& columns, int row,
+                                                   RowCache& cache) const
+{
+    for (int i = 0; i < 2; ++i) {
+        if (cache.Rows[i] == row) {
+            cache.Next = 1 - i;
+            return &cache.Texels[i][0];
+        }
+    }
+
+    int slot = cache.Next;
+    cache.Next = 1 - slot;
+    cache.Rows[slot] = row;
+    std::vector<unsigned short>& scaled = cache.Texels[slot];
+    scaled.resize(columns.First.size() * 4);
+    const unsigned char* texels = &source.Texels[row * source.Width * 4];
+    for (size_t x = 0; x < columns.First.size(); ++x) {
+        const unsigned char* left = texels + columns.First[x] * 4;
+        const unsigned char* right = texels + columns.Second[x] * 4;
+        int weight = columns.Fraction[x];
+        for (int c = 0; c < 4; ++c)
+            scaled[x * 4 + c] = (unsigned short) (left[c] * (256 - weight) + right[c] * weight);
+    }
+    return &scaled[0];
+}
+
+// Adds row y of the source scaled up or down with bilinear filtering,
+// rounded to 8 bits the way a texture lookup rounds.
+inline void BloomFilter::AddSamples(const BloomImage& source, const BloomAxis& columns,
+                                    const BloomAxis& rows, int y, RowCache& cache,
+                                    int* sums) const
+{
+    const unsigned short* top = ScaleRow(source, columns, rows.First[y], cache);
+    const unsigned short* bottom = ScaleRow(source, columns, rows.Second[y], cache);
+    int weight = rows.Fraction[y];
+    int count = (int) columns.First.size() * 4;
+    int i = 0;
+#if defined(BLOOM_FILTER_SSE2)
+    if (m_options.Simd) {
+        __m128i topWeight = _mm_set1_epi16((short) (256 - weight));
+        __m128i bottomWeight = _mm_set1_epi16((short) weight);
+        __m128i half = _mm_set1_epi32(32768);
+        for (; i + 8 <= count; i += 8) {
+            __m128i a = _mm_loadu_si128((const __m128i*) (top + i));
+            __m128i b = _mm_loadu_si128((const __m128i*) (bottom + i));
+            __m128i aLow = _mm_mullo_epi16(a, topWeight), aHigh = _mm_mulhi_epu16(a, topWeight);
+            __m128i bLow = _mm_mullo_epi16(b, bottomWeight), bHigh = _mm_mulhi_epu16(b, bottomWeight);
+            __m128i first = _mm_add_epi32(_mm_unpacklo_epi16(aLow, aHigh),
+                                          _mm_unpacklo_epi16(bLow, bHigh));
+            __m128i second = _mm_add_epi32(_mm_unpackhi_epi16(aLow, aHigh),
+                                           _mm_unpackhi_epi16(bLow, bHigh));
+            first = _mm_srli_epi32(_mm_add_epi32(first, half), 16);
+            second = _mm_srli_epi32(_mm_add_epi32(second, half), 16);
+            __m128i* target = (__m128i*) (sums + i);
+            _mm_storeu_si128(target, _mm_add_epi32(_mm_loadu_si128(target), first));
+            _mm_storeu_si128(target + 1, _mm_add_epi32(_mm_loadu_si128(target + 1), second));
+        }
+    }
+#elif defined(BLOOM_FILTER_NEON)
+    if (m_options.Simd) {
+        uint16x4_t topWeight = vdup_n_u16((uint16_t) (256 - weight));
+        uint16x4_t bottomWeight = vdup_n_u16((uint16_t) weight);
+        for (; i + 4 <= count; i += 4) {
+            uint32x4_t sum = vmull_u16(vld1_u16(top + i), topWeight);
+            sum = vmlal_u16(sum, vld1_u16(bottom + i), bottomWeight);
+            int32x4_t rounded = vreinterpretq_s32_u32(vrshrq_n_u32(sum, 16));
+            vst1q_s32(sums + i, vaddq_s32(vld1q_s32(sums + i), rounded));
+        }
+    }
+#endif
+    for (; i < count; ++i)
+        sums[i] += (int) ((top[i] * (256 - weight) + bottom[i] * weight + 32768) >> 16);
+}
+
+inline void BloomFilter::Downsample(int firstRow, int lastRow)
+{
+    BloomImage& target = m_levels[m_level];
+    RowCache cache;
+    std::vector<int> sums(target.Width * 4);
+    for (int y = firstRow; y < lastRow; ++y) {
+        sums.assign(sums.size(), 0);
+        AddSamples(m_levels[m_level - 1], m_levelColumns[m_level], m_levelRows[m_level], y,
+                   cache, &sums[0]);
+        unsigned char* texel = &target.Texels[y * target.Width * 4];
+        for (int i = 0; i < target.Width * 4; ++i)
+            texel[i] = (unsigned char) sums[i];
+    }
+}
+
+// Each row gets copied with its edge texels repeated on either side, so
+// every tap is just the copy shifted.
+inline void BloomFilter::BlurRows(int firstRow, int lastRow)
+{
+    const BloomImage& level = m_levels[m_level];
+    int radius = 0;
+    for (size_t i = 0; i < m_taps.size(); ++i)
+        radius = m_taps[i].Offset > radius ? m_taps[i].Offset : radius;
+
+    std::vector<unsigned char> padded((level.Width + radius * 2) * 4);
+    std::vector<const unsigned char*> sources(m_taps.size());
+    for (int y = firstRow; y < lastRow; ++y) {
+        const unsigned char* row = &level.Texels[y * level.Width * 4];
+        for (int x = -radius; x < level.Width + radius; ++x) {
+            int clamped = x < 0 ? 0 : (x < level.Width ? x : level.Width - 1);
+            for (int c = 0; c < 4; ++c)
+                padded[(x + radius) * 4 + c] = row[clamped * 4 + c];
+        }
+        for (size_t i = 0; i < m_taps.size(); ++i)
+            sources[i] = &padded[(radius + m_taps[i].Offset) * 4];
+        WeightedSum(&sources[0], level.Width * 4, &m_blurred.Texels[y * level.Width * 4]);
+    }
+}
+
+inline void BloomFilter::BlurColumns(int firstRow, int lastRow)
+{
+    BloomImage& level = m_levels[m_level];
+    std::vector<const unsigned char*> sources(m_taps.size());
+    for (int y = firstRow; y < lastRow; ++y) {
+        for (size_t i = 0; i < m_taps.size(); ++i) {
+            int row = y + m_taps[i].Offset;
+            row = row < 0 ? 0 : (row < level.Height ? row : level.Height - 1);
+            sources[i] = &m_blurred.Texels[row * level.Width * 4];
+        }
+        WeightedSum(&sources[0], level.Width * 4, &level.Texels[y * level.Width * 4]);
+    }
+}
+
+// target[i] is the weighted sum of sources[t][i] over the taps, rounded.
+// The weights add up to 256, so the sum fits in 16 bits unsigned.
+inline void BloomFilter::WeightedSum(const unsigned char* const* sources, int bytes,
+                                     unsigned char* target) const
+{
+    int tapCount = (int) m_taps.size();
+    int i = 0;
+#if defined(BLOOM_FILTER_SSE2)
+    if (m_options.Simd) {
+        __m128i zero = _mm_setzero_si128();
+        __m128i half = _mm_set1_epi16(128);
+        for (; i + 16 <= bytes; i += 16) {
+            __m128i low = half, high = half;
+            for (int t = 0; t < tapCount; ++t) {
+                __m128i weight = _mm_set1_epi16((short) m_taps[t].Weight);
+                __m128i texels = _mm_loadu_si128((const __m128i*) (sources[t] + i));
+                low = _mm_add_epi16(low, _mm_mullo_epi16(_mm_unpacklo_epi8(texels, zero), weight));
+                high = _mm_add_epi16(high, _mm_mullo_epi16(_mm_unpackhi_epi8(texels, zero), weight));
+            }
+            low = _mm_srli_epi16(low, 8);
+            high = _mm_srli_epi16(high, 8);
+            _mm_storeu_si128((__m128i*) (target + i), _mm_packus_epi16(low, high));
+        }
+    }
+#elif defined(BLOOM_FILTER_NEON)
+    if (m_options.Simd) {
+        for (; i + 16 <= bytes; i += 16) {
+            uint16x8_t low = vdupq_n_u16(0), high = vdupq_n_u16(0);
+            for (int t = 0; t < tapCount; ++t) {
+                uint16x8_t weight = vdupq_n_u16(m_taps[t].Weight);
+                uint8x16_t texels = vld1q_u8(sources[t] + i);
+                low = vmlaq_u16(low, vmovl_u8(vget_low_u8(texels)), weight);
+                high = vmlaq_u16(high, vmovl_u8(vget_high_u8(texels)), weight);
+            }
+            vst1q_u8(target + i, vcombine_u8(vrshrn_n_u16(low, 8), vrshrn_n_u16(high, 8)));
+        }
+    }
+#endif
+    for (; i < bytes; ++i) {
+        unsigned int sum = 128;
+        for (int t = 0; t < tapCount; ++t)
+            sum += sources[t][i] * m_taps[t].Weight;
+        target[i] = (unsigned char) (sum >> 8);
+    }
+}
+
+// The scene with each accumulated level sampled over it, as the sample
+// blends them with GL_ONE, GL_ONE into an RGBA8 or RGB565 surface.
+inline void BloomFilter::Composite(int firstRow, int lastRow)
+{
+    const BloomImage& scene = *m_scene;
+    std::vector<RowCache> caches(m_options.LevelCount);
+    std::vector<int> sums(scene.Width * 4);
+    for (int y = firstRow; y < lastRow; ++y) {
+        const unsigned char* texel = &scene.Texels[y * scene.Width * 4];
+        for (int i = 0; i < scene.Width * 4; ++i)
+            sums[i] = texel[i];
+        for (int i = m_options.FirstAccumulated; i < m_options.LevelCount; ++i)
+            AddSamples(m_levels[i], m_sceneColumns[i], m_sceneRows[i], y, caches[i], &sums[0]);
+        for (int i = 0; i < scene.Width * 4; ++i)
+            sums[i] = sums[i] < 255 ? sums[i] : 255;
+
+        if (m_result->Format == BloomFormatRgb565) {
+            unsigned short* target = (unsigned short*) &m_result->Texels[y * scene.Width * 2];
+            for (int x = 0; x < scene.Width; ++x) {
+                const int* sum = &sums[x * 4];
+                target[x] = (unsigned short) (((sum[0] * 31 + 127) / 255) << 11 |
+                                              ((sum[1] * 63 + 127) / 255) << 5 |
+                                              ((sum[2] * 31 + 127) / 255));
+            }
+        } else {
+            unsigned char* target = &m_result->Texels[y * scene.Width * 4];
+            for (int i = 0; i < scene.Width * 4; ++i)
+                target[i] = (unsigned char) sums[i];
+        }
+    }
+}
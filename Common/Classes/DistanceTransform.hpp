@@ -0,0 +1,205 @@
+#pragma once
+#include "ParallelFor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Exact Euclidean signed distance fields for the offline tools, using the
+// separable algorithm from Meijster, Roerdink, and Hesselink, "A General
+// Algorithm for Computing Distance Transforms in Linear Time" (2000).
+//
+// The first phase scans columns for the nearest feature in each column.  It
+// walks whole rows at a time so that the inner loops run over contiguous
+// texels and vectorize.  The second phase takes the lower envelope of
+// parabolas along each row.  Both phases split into independent stripes
+// across threads, and everything stays in integers, so the output doesn't
+// depend on the thread count.
+//
+// Distances are measured between texel centers, then pulled in by half a
+// texel so that the zero crossing falls on the boundary between an inside
+// texel and an outside one.  They are negative inside.
+
+class DistanceTransform {
+public:
+    DistanceTransform(int threadCount = 1) : m_threadCount(threadCount) {}
+    void Compute(const unsigned char* mask, int width, int height,
+                 std::vector<float>& distances);
+    void operator()(int begin, int end);
+private:
+    enum Phase {
+        PhaseColumns,
+        PhaseRows,
+    };
+    void ScanColumns(int firstColumn, int lastColumn);
+    void ScanRow(const int* g, int* dt, int* s, int* t) const;
+    int m_threadCount;
+    Phase m_phase;
+    const unsigned char* m_mask;
+    int m_width;
+    int m_height;
+    std::vector<int> m_inside;
+    std::vector<int> m_outside;
+    float* m_distances;
+};
+
+// The mask is one byte per texel, nonzero inside.
+inline void DistanceTransform::Compute(const unsigned char* mask, int width, int height,
+                                       std::vector<float>& distances)
+{
+    m_mask = mask;
+    m_width = width;
+    m_height = height;
+    m_inside.resize(width * height);
+    m_outside.resize(width * height);
+    distances.resize(width * height);
+    m_distances = &distances[0];
+
+    // Column stripes should be wide enough to fill a vector register or
+    // two; sixteen texels is plenty.
+    const int StripeWidth = 16;
+    m_phase = PhaseColumns;
+    ParallelFor((width + StripeWidth - 1) / StripeWidth, m_threadCount, *this);
+    m_phase = PhaseRows;
+    ParallelFor(height, m_threadCount, *this);
+}
+
+inline void DistanceTransform::operator()(int begin, int end)
+{
+    if (m_phase == PhaseColumns) {
+        const int StripeWidth = 16;
+        int last = end * StripeWidth < m_width ? end * StripeWidth : m_width;
+        ScanColumns(begin * StripeWidth, last);
+        return;
+    }
+
+    std::vector<int> row(m_width), s(m_width), t(m_width);
+    for (int y = begin; y < end; ++y) {
+        int* inside = &m_inside[y * m_width];
+        int* outside = &m_outside[y * m_width];
+        ScanRow(inside, &row[0], &s[0], &t[0]);
+        std::copy(row.begin(), row.end(), inside);
+        ScanRow(outside, &row[0], &s[0], &t[0]);
+        std::copy(row.begin(), row.end(), outside);
+
+        // Inside texels measure to the nearest outside texel and vice versa.
+        float* distance = m_distances + y * m_width;
+        const unsigned char* mask = m_mask + y * m_width;
+        for (int x = 0; x < m_width; ++x) {
+            if (mask[x])
+                distance[x] = 0.5f - std::sqrt((float) outside[x]);
+            else
+                distance[x] = std::sqrt((float) inside[x]) - 0.5f;
+        }
+    }
+}
+
+// Phase one: the distance to the nearest inside texel and the nearest
+// outside texel in the same column, for columns [firstColumn, lastColumn).
+inline void DistanceTransform::ScanColumns(int firstColumn, int lastColumn)
+{
+    const int infinity = m_width + m_height;
+    int w = m_width;
+    int count = lastColumn - firstColumn;
+
+    const unsigned char* mask = m_mask + firstColumn;
+    int* inside = &m_inside[firstColumn];
+    int* outside = &m_outside[firstColumn];
+    for (int x = 0; x < count; ++x) {
+        inside[x] = mask[x] ? 0 : infinity;
+        outside[x] = mask[x] ? infinity : 0;
+    }
+    for (int y = 1; y < m_height; ++y) {
+        mask += w;
+        inside += w;
+        outside += w;
+        for (int x = 0; x < count; ++x) {
+            int in = inside[x - w] + 1;
+            int out = outside[x - w] + 1;
+            inside[x] = mask[x] ? 0 : in;
+            outside[x] = mask[x] ? out : 0;
+        }
+    }
+    for (int y = m_height - 2; y >= 0; --y) {
+        inside -= w;
+        outside -= w;
+        for (int x = 0; x < count; ++x) {
+            int in = inside[x + w] + 1;
+            int out = outside[x + w] + 1;
+            inside[x] = in < inside[x] ? in : inside[x];
+            outside[x] = out < outside[x] ? out : outside[x];
+        }
+    }
+}
+
+// Phase two, for one row: dt[x] = min over i of (x - i)^2 + g[i]^2.
+// s and t are scratch arrays as long as the row.
+inline void DistanceTransform::ScanRow(const int* g, int* dt, int* s, int* t) const
+{
+    int m = m_width;
+    int q = 0;
+    s[0] = 0;
+    t[0] = 0;
+    for (int u = 1; u < m; ++u) {
+        while (q >= 0) {
+            int a = t[q] - s[q], b = t[q] - u;
+            if (a * a + g[s[q]] * g[s[q]] <= b * b + g[u] * g[u])
+                break;
+            --q;
+        }
+        if (q < 0) {
+            q = 0;
+            s[0] = u;
+        } else {
+            // The first x at which u's parabola is below s[q]'s, rounding
+            // the division down for negative numerators too.
+            int i = s[q];
+            int numerator = u * u - i * i + g[u] * g[u] - g[i] * g[i];
+            int denominator = 2 * (u - i);
+            int sep = numerator >= 0 ? numerator / denominator :
+                      -((denominator - 1 - numerator) / denominator);
+            int w = 1 + sep;
+            if (w < m) {
+                ++q;
+                s[q] = u;
+                t[q] = w;
+            }
+        }
+    }
+    for (int u = m - 1; u >= 0; --u) {
+        int a = u - s[q];
+        dt[u] = a * a + g[s[q]] * g[s[q]];
+        if (u == t[q])
+            --q;
+    }
+}
+
+// Averages factor x factor blocks of a field; the size is rounded down.
+inline void DownsampleDistances(const std::vector<float>& source, int width, int height,
+                                int factor, std::vector<float>& dest)
+{
+    int w = width / factor, h = height / factor;
+    dest.assign(w * h, 0.0f);
+    float scale = 1.0f / (factor * factor);
+    for (int y = 0; y < h; ++y) {
+        float* out = &dest[y * w];
+        for (int j = 0; j < factor; ++j) {
+            const float* in = &source[(y * factor + j) * width];
+            for (int x = 0; x < w; ++x) {
+                float sum = 0;
+                for (int i = 0; i < factor; ++i)
+                    sum += in[x * factor + i];
+                out[x] += sum;
+            }
+        }
+        for (int x = 0; x < w; ++x)
+            out[x] *= scale;
+    }
+}
+
+// Maps distances to the 8-bit layout that the DistanceField shaders read:
+// 128 on the edge, 0 at spread texels inside, and 255 at spread outside.
+inline unsigned char QuantizeDistance(float distance, float spread)
+{
+    float value = 128 + 128 * distance / spread;
+    return value <= 0 ? 0 : (value >= 255 ? 255 : (unsigned char) (value + 0.5f));
+}
@@ -0,0 +1,195 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+// Groups draws that share a mesh and a material so that each group can go
+// out in one submission rather than one per draw.  How a group's draws
+// differ, their transforms and colors, is up to the renderer: on ES1 it
+// transforms the vertices itself, and on ES2 it indexes uniform arrays
+// with a per-vertex instance number.
+//
+//     batcher.Clear();
+//     for each visual:  batcher.Add(mesh, material, shareable);
+//     batcher.Build(capacities);          // the most draws each mesh takes at once
+//     for each batch:   draw GetDraw(batch.First) through GetDraw(batch.First + batch.Count - 1)
+//
+// Draws that set their own viewport can share a submission only if the
+// viewport moves into their transform, which GetViewportTransform does,
+// and only if their mesh stays inside the viewport, since nothing clips
+// it to the viewport any more.  Those that might not are unshareable, and
+// get a batch of their own.
+//
+// Matrices here are 16 floats, row by row, with vectors on the left, as
+// with the samples' mat4.  Nothing here touches GL.
+
+struct DrawBatch {
+    int Mesh;
+    int Material;
+    int First;          // into the order GetDraw returns
+    int Count;
+};
+
+class DrawBatcher {
+public:
+    DrawBatcher() : m_groupCount(0) {}
+    void Clear();
+    int Add(int mesh, int material, bool shareable);
+    void Build(const std::vector<int>& capacities);
+    int GetDrawCount() const { return m_draws.size(); }
+    int GetBatchCount() const { return m_batches.size(); }
+    const DrawBatch& GetBatch(int batch) const { return m_batches[batch]; }
+    int GetDraw(int position) const { return m_order[position]; }
+private:
+    struct Draw {
+        int Mesh;
+        int Material;
+        int Group;
+    };
+    std::vector<Draw> m_draws;
+    std::vector<int> m_order;
+    std::vector<DrawBatch> m_batches;
+    std::map<std::pair<int, int>, int> m_groups;
+    int m_groupCount;
+};
+
+inline void DrawBatcher::Clear()
+{
+    m_draws.clear();
+    m_groups.clear();
+    m_groupCount = 0;
+}
+
+// Returns the draw's number, counting from 0 in the order they're added.
+inline int DrawBatcher::Add(int mesh, int material, bool shareable)
+{
+    Draw draw = { mesh, material, m_groupCount };
+    if (shareable) {
+        std::pair<std::map<std::pair<int, int>, int>::iterator, bool> group =
+            m_groups.insert(std::make_pair(std::make_pair(mesh, material), m_groupCount));
+        draw.Group = group.first->second;
+        m_groupCount += group.second;
+    } else {
+        ++m_groupCount;
+    }
+    m_draws.push_back(draw);
+    return m_draws.size() - 1;
+}
+
+// Groups come out in the order of their first draws, and a group bigger
+// than its mesh's capacity is split.  A capacity below 1 counts as 1.
+inline void DrawBatcher::Build(const std::vector<int>& capacities)
+{
+    m_batches.clear();
+    m_order.resize(m_draws.size());
+
+    // A counting sort by group keeps draws in order within each one.
+    std::vector<int> starts(m_groupCount + 1, 0);
+    for (size_t i = 0; i < m_draws.size(); ++i)
+        ++starts[m_draws[i].Group + 1];
+    for (int group = 0; group < m_groupCount; ++group)
+        starts[group + 1] += starts[group];
+    std::vector<int> next(starts.begin(), starts.end() - 1);
+    for (size_t i = 0; i < m_draws.size(); ++i)
+        m_order[next[m_draws[i].Group]++] = i;
+
+    for (int group = 0; group < m_groupCount; ++group) {
+        int first = starts[group], end = starts[group + 1];
+        if (first == end)
+            continue;
+        const Draw& draw = m_draws[m_order[first]];
+        assert(draw.Mesh >= 0 && draw.Mesh < (int) capacities.size());
+        int capacity = std::max(capacities[draw.Mesh], 1);
+        for (; first < end; first += capacity) {
+            DrawBatch batch = { draw.Mesh, draw.Material, first, std::min(capacity, end - first) };
+            m_batches.push_back(batch);
+        }
+    }
+}
+
+// How many copies of a mesh fit in one draw with 16-bit indices.
+inline int GetBatchCapacity(int vertexCount, int maxInstances)
+{
+    assert(vertexCount > 0);
+    return std::max(1, std::min(maxInstances, 65536 / vertexCount));
+}
+
+// The mesh's indices once for each copy, each copy's vertices following
+// the last's.
+inline void BuildBatchIndices(const unsigned short* indices, int indexCount, int vertexCount,
+                              int instanceCount, std::vector<unsigned short>& batchIndices)
+{
+    assert(vertexCount * instanceCount <= 65536);
+    batchIndices.resize(indexCount * instanceCount);
+    unsigned short* index = batchIndices.empty() ? 0 : &batchIndices[0];
+    for (int instance = 0; instance < instanceCount; ++instance)
+        for (int i = 0; i < indexCount; ++i)
+            *index++ = indices[i] + instance * vertexCount;
+}
+
+// Takes clip space for a viewport, given as x, y, width and height from the
+// lower left, to clip space for the whole screen, so that whatever was
+// inside the viewport lands in the same pixels.
+inline void GetViewportTransform(const int* viewport, int screenWidth, int screenHeight,
+                                 float* matrix)
+{
+    std::fill(matrix, matrix + 16, 0.0f);
+    matrix[0] = (float) viewport[2] / screenWidth;
+    matrix[5] = (float) viewport[3] / screenHeight;
+    matrix[10] = 1;
+    matrix[12] = (2.0f * viewport[0] + viewport[2]) / screenWidth - 1;
+    matrix[13] = (2.0f * viewport[1] + viewport[3]) / screenHeight - 1;
+    matrix[15] = 1;
+}
+
+// Whether a sphere centered on the view axis, the given distance in front
+// of the eye, projects inside the viewport.  The test is conservative: it
+// takes x and y at their furthest from the axis and w at the sphere's
+// nearest point, which suits any projection whose w grows with distance.
+inline bool IsInsideViewport(const float* projection, float distance, float radius)
+{
+    float z = radius - distance;
+    float w = z * projection[11] + projection[15];
+    float x = std::fabs(projection[0]) * radius + std::fabs(projection[8]) * (distance + radius);
+    float y = std::fabs(projection[5]) * radius + std::fabs(projection[9]) * (distance + radius);
+    return w > 0 && x <= w && y <= w;
+}
+
+// Multiplies a by b into result, which mustn't be either of them.
+inline void MultiplyBatchMatrices(const float* a, const float* b, float* result)
+{
+    for (int row = 0; row < 4; ++row)
+        for (int column = 0; column < 4; ++column)
+            result[row * 4 + column] = a[row * 4] * b[column] +
+                                       a[row * 4 + 1] * b[4 + column] +
+                                       a[row * 4 + 2] * b[8 + column] +
+                                       a[row * 4 + 3] * b[12 + column];
+}
+
+// Pre-transforms copies of a mesh into one vertex array for a batch.  Each
+// source vertex starts with a position and a normal; the position goes
+// through the copy's transform and comes out as x, y, z, w, the normal goes
+// through the upper left of its normal matrix, and any floats after them,
+// like texture coordinates, are copied as they are.
+inline float* TransformBatchVertices(const float* vertices, int vertexCount, int floatsPerVertex,
+                                     const float* transform, const float* normalMatrix,
+                                     float* destination)
+{
+    assert(floatsPerVertex >= 6);
+    const float* m = transform;
+    const float* n = normalMatrix;
+    for (int i = 0; i < vertexCount; ++i, vertices += floatsPerVertex) {
+        const float* p = vertices;
+        const float* v = vertices + 3;
+        for (int c = 0; c < 4; ++c)
+            *destination++ = p[0] * m[c] + p[1] * m[4 + c] + p[2] * m[8 + c] + m[12 + c];
+        for (int c = 0; c < 3; ++c)
+            *destination++ = v[0] * n[c] + v[1] * n[4 + c] + v[2] * n[8 + c];
+        for (int c = 6; c < floatsPerVertex; ++c)
+            *destination++ = vertices[c];
+    }
+    return destination;
+}
@@ -0,0 +1,648 @@
+#pragma once
+#include "ParallelFor.hpp"
+#include "PvrTexture.hpp"
+#include <vector>
+
+// Software ETC1 / ETC2 codec for the offline tools.
+//
+// Every 4x4 block is 64 bits, stored big-endian.  ETC1 splits the block into
+// two 2x4 or 4x2 halves, each with a base color and a table of luminance
+// offsets.  ETC2 keeps those blocks bit-for-bit and hides three more modes
+// (T, H, and planar) in the differential encodings that would overflow.
+// ETC2 RGBA prefixes every color block with a 64-bit EAC alpha block.
+//
+// The decoder handles every mode.  The encoder searches the ETC1 modes and,
+// for ETC2, the planar mode, which is what smooth gradients want; it never
+// emits T or H blocks.
+
+const int EtcModifiers[8][2] = {
+    { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 },
+    { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 },
+};
+
+const int EtcDistances[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+const int EacModifiers[16][8] = {
+    { -3, -6, -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5, -8, -13, 1, 4, 7, 12 },
+    { -2, -4, -6, -13, 1, 3, 5, 12 },
+    { -3, -6, -8, -12, 2, 5, 7, 11 },
+    { -3, -7, -9, -11, 2, 6, 8, 10 },
+    { -4, -7, -8, -11, 3, 6, 7, 10 },
+    { -3, -5, -8, -11, 2, 4, 7, 10 },
+    { -2, -6, -8, -10, 1, 5, 7, 9 },
+    { -2, -5, -8, -10, 1, 4, 7, 9 },
+    { -2, -4, -8, -10, 1, 3, 7, 9 },
+    { -2, -5, -7, -10, 1, 4, 6, 9 },
+    { -3, -4, -7, -10, 2, 3, 6, 9 },
+    { -1, -2, -3, -10, 0, 1, 2, 9 },
+    { -4, -6, -8, -9, 3, 5, 7, 8 },
+    { -3, -5, -7, -9, 2, 4, 6, 8 },
+};
+
+inline int EtcClamp(int value)
+{
+    return value < 0 ? 0 : (value > 255 ? 255 : value);
+}
+
+inline int EtcExpand4(int c) { return (c << 4) | c; }
+inline int EtcExpand5(int c) { return (c << 3) | (c >> 2); }
+inline int EtcExpand6(int c) { return (c << 2) | (c >> 4); }
+inline int EtcExpand7(int c) { return (c << 1) | (c >> 6); }
+
+inline bool IsEtcPixelType(PvrPixelType type)
+{
+    return type == PvrPixelTypeEtc1 || type == PvrPixelTypeEtc2Rgb ||
+           type == PvrPixelTypeEtc2Rgba;
+}
+
+// Decodes one 64-bit color block into 16 RGBA texels, row-major.  Alpha is
+// left untouched.
+inline void DecodeEtcColorBlock(const unsigned char* src, unsigned char* texels, bool etc2)
+{
+    unsigned int indices = src[4] << 24 | src[5] << 16 | src[6] << 8 | src[7];
+    bool differential = (src[3] & 2) != 0;
+    int paint[4][3];
+    bool usePaint = false;
+
+    int base[2][3], tables[2];
+    bool flip = (src[3] & 1) != 0;
+    tables[0] = (src[3] >> 5) & 7;
+    tables[1] = (src[3] >> 2) & 7;
+
+    if (!differential) {
+        for (int c = 0; c < 3; ++c) {
+            base[0][c] = EtcExpand4(src[c] >> 4);
+            base[1][c] = EtcExpand4(src[c] & 0xf);
+        }
+    } else {
+        int overflow = -1;
+        int first[3], second[3];
+        for (int c = 0; c < 3; ++c) {
+            int delta = src[c] & 7;
+            delta = delta >= 4 ? delta - 8 : delta;
+            first[c] = src[c] >> 3;
+            second[c] = first[c] + delta;
+            if (overflow < 0 && (second[c] < 0 || second[c] > 31))
+                overflow = c;
+        }
+
+        if (!etc2 || overflow < 0) {
+            // ETC1 encoders never overflow; decoders wrap if one does.
+            for (int c = 0; c < 3; ++c) {
+                base[0][c] = EtcExpand5(first[c]);
+                base[1][c] = EtcExpand5(second[c] & 31);
+            }
+        } else if (overflow == 0) {
+            // T mode.
+            int c1[3], c2[3];
+            c1[0] = EtcExpand4(((src[0] >> 1) & 0xc) | (src[0] & 3));
+            c1[1] = EtcExpand4(src[1] >> 4);
+            c1[2] = EtcExpand4(src[1] & 0xf);
+            c2[0] = EtcExpand4(src[2] >> 4);
+            c2[1] = EtcExpand4(src[2] & 0xf);
+            c2[2] = EtcExpand4(src[3] >> 4);
+            int d = EtcDistances[((src[3] >> 1) & 6) | (src[3] & 1)];
+            for (int c = 0; c < 3; ++c) {
+                paint[0][c] = c1[c];
+                paint[1][c] = EtcClamp(c2[c] + d);
+                paint[2][c] = c2[c];
+                paint[3][c] = EtcClamp(c2[c] - d);
+            }
+            usePaint = true;
+        } else if (overflow == 1) {
+            // H mode.
+            int r1 = (src[0] >> 3) & 0xf;
+            int g1 = ((src[0] & 7) << 1) | ((src[1] >> 4) & 1);
+            int b1 = (src[1] & 8) | ((src[1] & 3) << 1) | (src[2] >> 7);
+            int r2 = (src[2] >> 3) & 0xf;
+            int g2 = ((src[2] & 7) << 1) | (src[3] >> 7);
+            int b2 = (src[3] >> 3) & 0xf;
+            int order = (r1 << 8 | g1 << 4 | b1) >= (r2 << 8 | g2 << 4 | b2) ? 1 : 0;
+            int d = EtcDistances[(src[3] & 4) | ((src[3] & 1) << 1) | order];
+            int c1[3] = { EtcExpand4(r1), EtcExpand4(g1), EtcExpand4(b1) };
+            int c2[3] = { EtcExpand4(r2), EtcExpand4(g2), EtcExpand4(b2) };
+            for (int c = 0; c < 3; ++c) {
+                paint[0][c] = EtcClamp(c1[c] + d);
+                paint[1][c] = EtcClamp(c1[c] - d);
+                paint[2][c] = EtcClamp(c2[c] + d);
+                paint[3][c] = EtcClamp(c2[c] - d);
+            }
+            usePaint = true;
+        } else {
+            // Planar mode.
+            int o[3], h[3], v[3];
+            o[0] = EtcExpand6((src[0] >> 1) & 0x3f);
+            o[1] = EtcExpand7(((src[0] & 1) << 6) | ((src[1] >> 1) & 0x3f));
+            o[2] = EtcExpand6(((src[1] & 1) << 5) | (src[2] & 0x18) |
+                              ((src[2] & 3) << 1) | (src[3] >> 7));
+            h[0] = EtcExpand6(((src[3] >> 1) & 0x3e) | (src[3] & 1));
+            h[1] = EtcExpand7(src[4] >> 1);
+            h[2] = EtcExpand6(((src[4] & 1) << 5) | (src[5] >> 3));
+            v[0] = EtcExpand6(((src[5] & 7) << 3) | (src[6] >> 5));
+            v[1] = EtcExpand7(((src[6] & 0x1f) << 2) | (src[7] >> 6));
+            v[2] = EtcExpand6(src[7] & 0x3f);
+            for (int y = 0; y < 4; ++y)
+                for (int x = 0; x < 4; ++x)
+                    for (int c = 0; c < 3; ++c)
+                        texels[(y * 4 + x) * 4 + c] = EtcClamp(
+                            (x * (h[c] - o[c]) + y * (v[c] - o[c]) + 4 * o[c] + 2) >> 2);
+            return;
+        }
+    }
+
+    // Texel indices are stored column by column, the high bits first.
+    for (int x = 0; x < 4; ++x) {
+        for (int y = 0; y < 4; ++y) {
+            int bit = x * 4 + y;
+            int index = ((indices >> (bit + 15)) & 2) | ((indices >> bit) & 1);
+            unsigned char* texel = texels + (y * 4 + x) * 4;
+            if (usePaint) {
+                for (int c = 0; c < 3; ++c)
+                    texel[c] = paint[index][c];
+                continue;
+            }
+            int half = flip ? (y >= 2) : (x >= 2);
+            int modifier = EtcModifiers[tables[half]][index & 1];
+            if (index & 2)
+                modifier = -modifier;
+            for (int c = 0; c < 3; ++c)
+                texel[c] = EtcClamp(base[half][c] + modifier);
+        }
+    }
+}
+
+inline void DecodeEacAlphaBlock(const unsigned char* src, unsigned char* texels)
+{
+    int base = src[0];
+    int multiplier = src[1] >> 4;
+    const int* modifiers = EacModifiers[src[1] & 0xf];
+    unsigned long long bits = 0;
+    for (int i = 2; i < 8; ++i)
+        bits = bits << 8 | src[i];
+
+    for (int x = 0; x < 4; ++x) {
+        for (int y = 0; y < 4; ++y) {
+            int index = (int) (bits >> (45 - 3 * (x * 4 + y))) & 7;
+            texels[(y * 4 + x) * 4 + 3] = EtcClamp(base + modifiers[index] * multiplier);
+        }
+    }
+}
+
+// Decodes one level into 8-bit RGBA.
+inline void DecodeEtc(const unsigned char* data, int width, int height,
+                      PvrPixelType type, std::vector<unsigned char>& rgba)
+{
+    bool alpha = type == PvrPixelTypeEtc2Rgba;
+    int blocksX = (width + 3) / 4, blocksY = (height + 3) / 4;
+    rgba.resize(width * height * 4);
+
+    for (int by = 0; by < blocksY; ++by) {
+        for (int bx = 0; bx < blocksX; ++bx) {
+            unsigned char texels[64];
+            for (int i = 0; i < 16; ++i)
+                texels[i * 4 + 3] = 255;
+            if (alpha) {
+                DecodeEacAlphaBlock(data, texels);
+                data += 8;
+            }
+            DecodeEtcColorBlock(data, texels, type != PvrPixelTypeEtc1);
+            data += 8;
+
+            for (int y = 0; y < 4 && by * 4 + y < height; ++y)
+                for (int x = 0; x < 4 && bx * 4 + x < width; ++x)
+                    for (int c = 0; c < 4; ++c)
+                        rgba[((by * 4 + y) * width + bx * 4 + x) * 4 + c] =
+                            texels[(y * 4 + x) * 4 + c];
+        }
+    }
+}
+
+// Encoder.  Quality 0 takes each half's average color as its base; higher
+// qualities search around it (see SearchHalf).  Blocks are independent, so
+// rows of blocks are spread across threads.
+class EtcEncoder {
+public:
+    static const int DefaultQuality = 1;
+    static const int MaxQuality = 2;
+    EtcEncoder(PvrPixelType type, int quality = DefaultQuality, int threadCount = 1);
+    void Encode(const unsigned char* rgba, int width, int height,
+                std::vector<unsigned char>& output);
+    void operator()(int firstBlockRow, int lastBlockRow);
+private:
+    struct Half {
+        int Base[3];
+        int Table;
+        int Indices[8];
+        int Error;
+    };
+    void EncodeColorBlock(const unsigned char* texels, unsigned char* block) const;
+    void EncodeAlphaBlock(const unsigned char* texels, unsigned char* block) const;
+    int EncodePlanar(const unsigned char* texels, unsigned char* block) const;
+    void FitHalf(const unsigned char* texels, const int* members, Half& half) const;
+    bool TryBase(const unsigned char* texels, const int* members,
+                 const int* q, int bits, Half& best) const;
+    void SearchHalf(const unsigned char* texels, const int* members,
+                    const int* average, int bits, Half& half) const;
+    static void HalfMembers(bool flip, int half, int* members);
+    PvrPixelType m_type;
+    int m_quality;
+    int m_threadCount;
+    const unsigned char* m_source;
+    int m_width;
+    int m_height;
+    unsigned char* m_output;
+};
+
+inline EtcEncoder::EtcEncoder(PvrPixelType type, int quality, int threadCount)
+    : m_type(type), m_quality(quality), m_threadCount(threadCount),
+      m_source(0), m_width(0), m_height(0), m_output(0)
+{
+    if (m_quality < 0)
+        m_quality = 0;
+    if (m_quality > MaxQuality)
+        m_quality = MaxQuality;
+}
+
+inline void EtcEncoder::Encode(const unsigned char* rgba, int width, int height,
+                               std::vector<unsigned char>& output)
+{
+    output.resize(PvrTexture::ComputeLevelSize(m_type, width, height));
+    m_source = rgba;
+    m_width = width;
+    m_height = height;
+    m_output = &output[0];
+    ParallelFor((height + 3) / 4, m_threadCount, *this);
+}
+
+inline void EtcEncoder::operator()(int firstBlockRow, int lastBlockRow)
+{
+    int blocksX = (m_width + 3) / 4;
+    int blockSize = m_type == PvrPixelTypeEtc2Rgba ? 16 : 8;
+
+    for (int by = firstBlockRow; by < lastBlockRow; ++by) {
+        for (int bx = 0; bx < blocksX; ++bx) {
+            // Partial blocks at the edges repeat the last row and column.
+            unsigned char texels[64];
+            for (int y = 0; y < 4; ++y) {
+                int sy = by * 4 + y < m_height ? by * 4 + y : m_height - 1;
+                for (int x = 0; x < 4; ++x) {
+                    int sx = bx * 4 + x < m_width ? bx * 4 + x : m_width - 1;
+                    for (int c = 0; c < 4; ++c)
+                        texels[(y * 4 + x) * 4 + c] = m_source[(sy * m_width + sx) * 4 + c];
+                }
+            }
+
+            unsigned char* block = m_output + (by * blocksX + bx) * blockSize;
+            if (m_type == PvrPixelTypeEtc2Rgba) {
+                EncodeAlphaBlock(texels, block);
+                block += 8;
+            }
+            EncodeColorBlock(texels, block);
+        }
+    }
+}
+
+inline void EtcEncoder::HalfMembers(bool flip, int half, int* members)
+{
+    int n = 0;
+    for (int y = 0; y < 4; ++y)
+        for (int x = 0; x < 4; ++x)
+            if ((flip ? y >= 2 : x >= 2) == (half == 1))
+                members[n++] = y * 4 + x;
+}
+
+// Chooses the best table and per-texel indices for a fixed base color.
+inline void EtcEncoder::FitHalf(const unsigned char* texels, const int* members,
+                                Half& half) const
+{
+    half.Error = 0x7fffffff;
+    for (int table = 0; table < 8; ++table) {
+        int palette[4][3];
+        for (int index = 0; index < 4; ++index) {
+            int modifier = EtcModifiers[table][index & 1];
+            if (index & 2)
+                modifier = -modifier;
+            for (int c = 0; c < 3; ++c)
+                palette[index][c] = EtcClamp(half.Base[c] + modifier);
+        }
+
+        int error = 0, indices[8];
+        for (int i = 0; i < 8 && error < half.Error; ++i) {
+            const unsigned char* texel = texels + members[i] * 4;
+            int best = 0x7fffffff;
+            for (int index = 0; index < 4; ++index) {
+                int dr = texel[0] - palette[index][0];
+                int dg = texel[1] - palette[index][1];
+                int db = texel[2] - palette[index][2];
+                int e = dr * dr + dg * dg + db * db;
+                if (e < best) {
+                    best = e;
+                    indices[i] = index;
+                }
+            }
+            error += best;
+        }
+        if (error < half.Error) {
+            half.Error = error;
+            half.Table = table;
+            for (int i = 0; i < 8; ++i)
+                half.Indices[i] = indices[i];
+        }
+    }
+}
+
+// Fits a quantized base color and keeps it if it beats the best so far.
+// The base stored in the half is the quantized value, not the expanded one.
+inline bool EtcEncoder::TryBase(const unsigned char* texels, const int* members,
+                                const int* q, int bits, Half& best) const
+{
+    int maxValue = (1 << bits) - 1;
+    Half candidate;
+    for (int c = 0; c < 3; ++c) {
+        if (q[c] < 0 || q[c] > maxValue)
+            return false;
+        candidate.Base[c] = bits == 4 ? EtcExpand4(q[c]) : EtcExpand5(q[c]);
+    }
+    FitHalf(texels, members, candidate);
+    if (candidate.Error >= best.Error)
+        return false;
+    best = candidate;
+    for (int c = 0; c < 3; ++c)
+        best.Base[c] = q[c];
+    return true;
+}
+
+// Quantizes the average to the given precision, then searches around it:
+// quality 1 tries one step brighter and darker, and quality 2 keeps walking
+// to whichever single-channel or gray neighbour helps most.
+inline void EtcEncoder::SearchHalf(const unsigned char* texels, const int* members,
+                                   const int* average, int bits, Half& half) const
+{
+    static const int Steps[8][3] = {
+        { 1, 1, 1 }, { -1, -1, -1 },
+        { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 },
+    };
+    const int MaxWalk = 4;
+
+    int maxValue = (1 << bits) - 1;
+    int center[3];
+    for (int c = 0; c < 3; ++c)
+        center[c] = (average[c] * maxValue + 127) / 255;
+
+    half.Error = 0x7fffffff;
+    TryBase(texels, members, center, bits, half);
+    int stepCount = m_quality >= 2 ? 8 : (m_quality >= 1 ? 2 : 0);
+    int walks = m_quality >= 2 ? MaxWalk : 1;
+    for (int walk = 0; walk < walks && half.Error > 0; ++walk) {
+        int origin[3] = { half.Base[0], half.Base[1], half.Base[2] };
+        bool moved = false;
+        for (int i = 0; i < stepCount; ++i) {
+            int q[3];
+            for (int c = 0; c < 3; ++c)
+                q[c] = origin[c] + Steps[i][c];
+            moved = TryBase(texels, members, q, bits, half) || moved;
+        }
+        if (!moved)
+            break;
+    }
+}
+
+inline void EtcEncoder::EncodeColorBlock(const unsigned char* texels, unsigned char* block) const
+{
+    int bestError = 0x7fffffff;
+    unsigned char candidate[8];
+
+    for (int flip = 0; flip < 2; ++flip) {
+        int members[2][8], averages[2][3];
+        for (int h = 0; h < 2; ++h) {
+            HalfMembers(flip != 0, h, members[h]);
+            for (int c = 0; c < 3; ++c) {
+                int sum = 0;
+                for (int i = 0; i < 8; ++i)
+                    sum += texels[members[h][i] * 4 + c];
+                averages[h][c] = (sum + 4) / 8;
+            }
+        }
+
+        for (int differential = 0; differential < 2; ++differential) {
+            int bits = differential ? 5 : 4;
+            Half halves[2];
+            SearchHalf(texels, members[0], averages[0], bits, halves[0]);
+            SearchHalf(texels, members[1], averages[1], bits, halves[1]);
+
+            if (differential) {
+                // The second base is stored as a 3-bit signed delta.
+                bool clamped = false;
+                for (int c = 0; c < 3; ++c) {
+                    int delta = halves[1].Base[c] - halves[0].Base[c];
+                    if (delta < -4 || delta > 3) {
+                        halves[1].Base[c] = halves[0].Base[c] + (delta < 0 ? -4 : 3);
+                        clamped = true;
+                    }
+                }
+                if (clamped) {
+                    int quantized[3];
+                    for (int c = 0; c < 3; ++c) {
+                        quantized[c] = halves[1].Base[c];
+                        halves[1].Base[c] = EtcExpand5(quantized[c]);
+                    }
+                    FitHalf(texels, members[1], halves[1]);
+                    for (int c = 0; c < 3; ++c)
+                        halves[1].Base[c] = quantized[c];
+                }
+            }
+
+            int error = halves[0].Error + halves[1].Error;
+            if (error >= bestError)
+                continue;
+            bestError = error;
+
+            for (int c = 0; c < 3; ++c) {
+                if (differential)
+                    candidate[c] = halves[0].Base[c] << 3 |
+                                   ((halves[1].Base[c] - halves[0].Base[c]) & 7);
+                else
+                    candidate[c] = halves[0].Base[c] << 4 | halves[1].Base[c];
+            }
+            candidate[3] = halves[0].Table << 5 | halves[1].Table << 2 |
+                           differential << 1 | flip;
+
+            unsigned int indices = 0;
+            for (int h = 0; h < 2; ++h) {
+                for (int i = 0; i < 8; ++i) {
+                    int texel = members[h][i];
+                    int bit = (texel % 4) * 4 + texel / 4;
+                    int index = halves[h].Indices[i];
+                    indices |= (unsigned int) (index >> 1) << (bit + 16);
+                    indices |= (unsigned int) (index & 1) << bit;
+                }
+            }
+            candidate[4] = indices >> 24;
+            candidate[5] = indices >> 16;
+            candidate[6] = indices >> 8;
+            candidate[7] = indices;
+            for (int i = 0; i < 8; ++i)
+                block[i] = candidate[i];
+        }
+    }
+
+    if (m_type != PvrPixelTypeEtc1 && bestError > 0) {
+        if (EncodePlanar(texels, candidate) < bestError)
+            for (int i = 0; i < 8; ++i)
+                block[i] = candidate[i];
+    }
+}
+
+// Fits a plane to each channel by least squares, then rounds the three
+// corner colors, trying each neighbour of the rounded values.  Returns the
+// block's squared error.
+inline int EtcEncoder::EncodePlanar(const unsigned char* texels, unsigned char* block) const
+{
+    int q[3][3];   // [channel][origin, horizontal, vertical]
+    int totalError = 0;
+    for (int c = 0; c < 3; ++c) {
+        float mean = 0, sx = 0, sy = 0;
+        for (int y = 0; y < 4; ++y) {
+            for (int x = 0; x < 4; ++x) {
+                float v = texels[(y * 4 + x) * 4 + c];
+                mean += v;
+                sx += (x - 1.5f) * v;
+                sy += (y - 1.5f) * v;
+            }
+        }
+        mean /= 16;
+        float dx = sx / 20, dy = sy / 20;
+        float o = mean - 1.5f * dx - 1.5f * dy;
+        float corner[3] = { o, o + 4 * dx, o + 4 * dy };
+
+        int bits = c == 1 ? 7 : 6;
+        int maxValue = (1 << bits) - 1;
+        int center[3];
+        for (int i = 0; i < 3; ++i) {
+            int value = (int) (corner[i] * maxValue / 255 + 0.5f);
+            center[i] = value < 0 ? 0 : (value > maxValue ? maxValue : value);
+        }
+
+        int bestError = 0x7fffffff;
+        for (int i = -1; i <= 1; ++i) {
+            for (int j = -1; j <= 1; ++j) {
+                for (int k = -1; k <= 1; ++k) {
+                    int candidate[3] = { center[0] + i, center[1] + j, center[2] + k };
+                    bool valid = true;
+                    int e[3];
+                    for (int n = 0; n < 3; ++n) {
+                        valid = valid && candidate[n] >= 0 && candidate[n] <= maxValue;
+                        e[n] = bits == 7 ? EtcExpand7(candidate[n]) : EtcExpand6(candidate[n]);
+                    }
+                    if (!valid)
+                        continue;
+                    int error = 0;
+                    for (int y = 0; y < 4; ++y) {
+                        for (int x = 0; x < 4; ++x) {
+                            int v = EtcClamp((x * (e[1] - e[0]) + y * (e[2] - e[0]) +
+                                              4 * e[0] + 2) >> 2);
+                            int d = texels[(y * 4 + x) * 4 + c] - v;
+                            error += d * d;
+                        }
+                    }
+                    if (error < bestError) {
+                        bestError = error;
+                        for (int n = 0; n < 3; ++n)
+                            q[c][n] = candidate[n];
+                    }
+                }
+            }
+        }
+        totalError += bestError;
+    }
+
+    int ro = q[0][0], go = q[1][0], bo = q[2][0];
+    int rh = q[0][1], gh = q[1][1], bh = q[2][1];
+    int rv = q[0][2], gv = q[1][2], bv = q[2][2];
+    block[0] = (ro << 1) | (go >> 6);
+    block[1] = ((go & 0x3f) << 1) | (bo >> 5);
+    block[2] = (bo & 0x18) | ((bo >> 1) & 3);
+    block[3] = ((bo & 1) << 7) | ((rh >> 1) << 2) | 2 | (rh & 1);
+    block[4] = (gh << 1) | (bh >> 5);
+    block[5] = ((bh & 0x1f) << 3) | (rv >> 3);
+    block[6] = ((rv & 7) << 5) | (gv >> 2);
+    block[7] = ((gv & 3) << 6) | bv;
+
+    // The red and green fields must not overflow as differential colors,
+    // and the blue one must; the unused bits steer the decoder.
+    for (int c = 0; c < 2; ++c) {
+        int delta = block[c] & 7;
+        delta = delta >= 4 ? delta - 8 : delta;
+        if ((block[c] >> 3) + delta < 0)
+            block[c] |= 0x80;
+    }
+    int blue = ((block[2] >> 3) & 3) + (block[2] & 3);
+    if (blue < 4)
+        block[2] |= 0x04;
+    else
+        block[2] |= 0xe0;
+    return totalError;
+}
+
+inline void EtcEncoder::EncodeAlphaBlock(const unsigned char* texels, unsigned char* block) const
+{
+    int low = 255, high = 0;
+    for (int i = 0; i < 16; ++i) {
+        int a = texels[i * 4 + 3];
+        low = a < low ? a : low;
+        high = a > high ? a : high;
+    }
+
+    int bestError = 0x7fffffff;
+    int bestBase = high, bestMultiplier = 0, bestTable = 0;
+    unsigned long long bestBits = 0;
+    if (low == high) {
+        bestError = 0;
+    }
+
+    int spread = m_quality >= 1 ? 1 : 0;
+    for (int table = 0; table < 16 && bestError > 0; ++table) {
+        const int* modifiers = EacModifiers[table];
+        int range = modifiers[7] - modifiers[3];
+        int multiplier = (high - low + range / 2) / range;
+        int base = low - modifiers[3] * (multiplier ? multiplier : 1);
+        for (int m = multiplier - spread; m <= multiplier + spread; ++m) {
+            if (m < 1 || m > 15)
+                continue;
+            for (int b = base - 2 * spread; b <= base + 2 * spread; ++b) {
+                int clampedBase = EtcClamp(b);
+                int error = 0;
+                unsigned long long bits = 0;
+                for (int x = 0; x < 4 && error < bestError; ++x) {
+                    for (int y = 0; y < 4; ++y) {
+                        int a = texels[(y * 4 + x) * 4 + 3];
+                        int best = 0x7fffffff, bestIndex = 0;
+                        for (int index = 0; index < 8; ++index) {
+                            int d = a - EtcClamp(clampedBase + modifiers[index] * m);
+                            if (d * d < best) {
+                                best = d * d;
+                                bestIndex = index;
+                            }
+                        }
+                        error += best;
+                        bits = bits << 3 | bestIndex;
+                    }
+                }
+                if (error < bestError) {
+                    bestError = error;
+                    bestBase = clampedBase;
+                    bestMultiplier = m;
+                    bestTable = table;
+                    bestBits = bits;
+                }
+            }
+        }
+    }
+
+    block[0] = bestBase;
+    block[1] = bestMultiplier << 4 | bestTable;
+    for (int i = 0; i < 6; ++i)
+        block[2 + i] = (unsigned char) (bestBits >> (40 - 8 * i));
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <cassert>
+#include <stdint.h>
+#include <vector>
+
+// Hands video frames from a producer thread, like a camera callback, to
+// the render thread without either one waiting on the other.  There are
+// three buffers: the producer fills one, the consumer reads one, and the
+// third holds the newest frame that's waiting.  Publishing swaps the
+// filled buffer with the waiting one, so a frame nobody took in time gets
+// dropped rather than queued, and the consumer always gets the newest.
+//
+//     producer                              consumer
+//     StreamFrame& frame = queue.GetBackFrame();
+//     fill frame.Pixels                     if (const StreamFrame* frame = queue.Acquire())
+//     queue.Publish(timestamp);                 read frame->Pixels until the next Acquire
+//
+// There must be one producer and one consumer.  Neither call takes a lock
+// or allocates, and the producer writes straight into memory the consumer
+// reads from, so there's no copy in between.
+
+struct StreamFrame {
+    unsigned char* Pixels;
+    unsigned int Sequence;      // counts up from 1 with every frame published
+    uint64_t Timestamp;         // whatever the producer passed to Publish
+};
+
+class FrameQueue {
+public:
+    FrameQueue(int byteCount) :
+        m_storage(byteCount * 3),
+        m_back(0),
+        m_ready(1),
+        m_front(2),
+        m_published(0),
+        m_dropped(0)
+    {
+        assert(byteCount > 0);
+        for (int i = 0; i < 3; ++i) {
+            m_frames[i].Pixels = &m_storage[byteCount * i];
+            m_frames[i].Sequence = 0;
+            m_frames[i].Timestamp = 0;
+        }
+    }
+    int GetByteCount() const { return (int) m_storage.size() / 3; }
+
+    // The producer's buffer, which is its own until it calls Publish.
+    StreamFrame& GetBackFrame() { return m_frames[m_back]; }
+    void Publish(uint64_t timestamp)
+    {
+        StreamFrame& frame = m_frames[m_back];
+        frame.Sequence = ++m_published;
+        frame.Timestamp = timestamp;
+        unsigned int previous = Exchange(m_back | Fresh);
+        if (previous & Fresh)
+            __sync_fetch_and_add(&m_dropped, 1);
+        m_back = previous & ~Fresh;
+    }
+
+    // The newest frame published since the last call, or null if there
+    // isn't one.  The frame stays put until the next call.
+    const StreamFrame* Acquire()
+    {
+        if (!(Read() & Fresh))
+            return 0;
+        m_front = Exchange(m_front) & ~Fresh;
+        return &m_frames[m_front];
+    }
+
+    // Frames published, and frames replaced by a newer one before the
+    // consumer took them.  Either thread can ask.
+    unsigned int GetPublishedCount() const { return m_published; }
+    unsigned int GetDroppedCount() const { return m_dropped; }
+
+private:
+    static const unsigned int Fresh = 4;
+
+    unsigned int Read() { return __sync_fetch_and_or(&m_ready, 0); }
+
+    // Swaps the waiting buffer's index, with a full barrier either side,
+    // so the frame's contents travel with it.
+    unsigned int Exchange(unsigned int index)
+    {
+        unsigned int previous = Read();
+        for (;;) {
+            unsigned int seen = __sync_val_compare_and_swap(&m_ready, previous, index);
+            if (seen == previous)
+                return previous;
+            previous = seen;
+        }
+    }
+
+    std::vector<unsigned char> m_storage;
+    StreamFrame m_frames[3];
+    unsigned int m_back;                // only the producer touches these
+    volatile unsigned int m_ready;      // the waiting buffer, and whether it's new
+    unsigned int m_front;               // only the consumer touches this
+    volatile unsigned int m_published;
+    volatile unsigned int m_dropped;
+};
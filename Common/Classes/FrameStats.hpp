@@ -0,0 +1,110 @@
+#pragma once
+#include <algorithm>
+#include <stdint.h>
+#include <vector>
+
+// Frame times for performance overlays, kept in a ring of the most recent
+// frames.  All of the memory is allocated up front, so adding frames and
+// summarizing them never touches the heap, and nothing here depends on GL.
+// Times are in milliseconds.
+
+struct FrameSummary {
+    int FrameCount;
+    float Mean;
+    float P50;
+    float P95;
+    float P99;
+    float Worst;
+    float Fps;      // from the mean
+};
+
+class FrameStats {
+public:
+    FrameStats(int capacity = 128);
+    void AddFrame(uint64_t nanoseconds);
+    void AddFrameMilliseconds(float milliseconds);
+    void Reset() { m_next = m_count = 0; }
+    int GetCount() const { return m_count; }
+    int GetCapacity() const { return (int) m_times.size(); }
+    float GetFrame(int age) const;
+    void Summarize(FrameSummary& summary) const;
+    void Histogram(float bucketWidth, int bucketCount, int* counts) const;
+private:
+    std::vector<float> m_times;
+    mutable std::vector<float> m_sorted;
+    int m_next;
+    int m_count;
+};
+
+inline FrameStats::FrameStats(int capacity) :
+    m_times(capacity),
+    m_sorted(capacity),
+    m_next(0),
+    m_count(0)
+{
+}
+
+inline void FrameStats::AddFrame(uint64_t nanoseconds)
+{
+    AddFrameMilliseconds((float) (nanoseconds * 1e-6));
+}
+
+inline void FrameStats::AddFrameMilliseconds(float milliseconds)
+{
+    m_times[m_next] = milliseconds;
+    m_next = (m_next + 1) % (int) m_times.size();
+    if (m_count < (int) m_times.size())
+        ++m_count;
+}
+
+// Age 0 is the most recent frame.
+inline float FrameStats::GetFrame(int age) const
+{
+    int capacity = (int) m_times.size();
+    return m_times[(m_next - 1 - age + capacity * 2) % capacity];
+}
+
+// Percentiles use the nearest rank: p99 is the smallest time that at least
+// 99% of the frames are no slower than.  Each one is a partial sort of
+// what's left above the previous one.
+inline void FrameStats::Summarize(FrameSummary& summary) const
+{
+    summary.FrameCount = m_count;
+    if (!m_count) {
+        summary.Mean = summary.P50 = summary.P95 = summary.P99 = summary.Worst = 0;
+        summary.Fps = 0;
+        return;
+    }
+
+    float* sorted = &m_sorted[0];
+    double total = 0;
+    for (int i = 0; i < m_count; ++i) {
+        sorted[i] = m_times[i];
+        total += m_times[i];
+    }
+
+    const int Percents[] = { 50, 95, 99 };
+    float* results[] = { &summary.P50, &summary.P95, &summary.P99 };
+    float* first = sorted;
+    for (int i = 0; i < 3; ++i) {
+        int rank = (Percents[i] * m_count + 99) / 100;
+        float* nth = sorted + (rank > 0 ? rank - 1 : 0);
+        std::nth_element(first, nth, sorted + m_count);
+        *results[i] = *nth;
+        first = nth;
+    }
+    summary.Worst = *std::max_element(first, sorted + m_count);
+    summary.Mean = (float) (total / m_count);
+    summary.Fps = summary.Mean > 0 ? 1000 / summary.Mean : 0;
+}
+
+// Counts frames into buckets of the given width, starting at zero; the
+// last bucket also takes everything slower.
+inline void FrameStats::Histogram(float bucketWidth, int bucketCount, int* counts) const
+{
+    std::fill(counts, counts + bucketCount, 0);
+    for (int i = 0; i < m_count; ++i) {
+        int bucket = (int) (m_times[i] / bucketWidth);
+        counts[std::min(std::max(bucket, 0), bucketCount - 1)]++;
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "GlyphCache.hpp"
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+// IGlyphRasterizer on top of FreeType, so that the offline tools can run the
+// text code headless.  The device rasterizes with UIKit instead.
+
+class FreeTypeRasterizer : public IGlyphRasterizer {
+public:
+    FreeTypeRasterizer(const char* path, int pixelSize);
+    ~FreeTypeRasterizer();
+    bool IsValid() const { return m_face != 0; }
+    bool Rasterize(unsigned int codepoint, GlyphBitmap& bitmap);
+    int GetLineHeight() const;
+    int GetKerning(unsigned int left, unsigned int right) const;
+private:
+    FT_Library m_library;
+    FT_Face m_face;
+};
+
+inline FreeTypeRasterizer::FreeTypeRasterizer(const char* path, int pixelSize) :
+    m_library(0),
+    m_face(0)
+{
+    if (FT_Init_FreeType(&m_library))
+        return;
+    if (FT_New_Face(m_library, path, 0, &m_face) ||
+        FT_Set_Pixel_Sizes(m_face, 0, pixelSize)) {
+        if (m_face)
+            FT_Done_Face(m_face);
+        m_face = 0;
+    }
+}
+
+inline FreeTypeRasterizer::~FreeTypeRasterizer()
+{
+    if (m_face)
+        FT_Done_Face(m_face);
+    if (m_library)
+        FT_Done_FreeType(m_library);
+}
+
+inline bool FreeTypeRasterizer::Rasterize(unsigned int codepoint, GlyphBitmap& bitmap)
+{
+    if (FT_Load_Char(m_face, codepoint, FT_LOAD_RENDER))
+        return false;
+
+    FT_GlyphSlot slot = m_face->glyph;
+    const FT_Bitmap& source = slot->bitmap;
+    GlyphMetrics& metrics = bitmap.Metrics;
+    metrics.XBearing = slot->bitmap_left;
+    metrics.YBearing = -slot->bitmap_top;
+    metrics.Width = source.width;
+    metrics.Height = source.rows;
+    metrics.XAdvance = (int) ((slot->advance.x + 32) >> 6);
+
+    bitmap.Texels.resize(metrics.Width * metrics.Height);
+    for (int y = 0; y < metrics.Height; ++y) {
+        const unsigned char* row = source.buffer + y * source.pitch;
+        unsigned char* dest = &bitmap.Texels[y * metrics.Width];
+        for (int x = 0; x < metrics.Width; ++x) {
+            if (source.pixel_mode == FT_PIXEL_MODE_MONO)
+                dest[x] = (row[x >> 3] & (0x80 >> (x & 7))) ? 255 : 0;
+            else
+                dest[x] = row[x];
+        }
+    }
+    return true;
+}
+
+inline int FreeTypeRasterizer::GetLineHeight() const
+{
+    return (int) ((m_face->size->metrics.height + 32) >> 6);
+}
+
+inline int FreeTypeRasterizer::GetKerning(unsigned int left, unsigned int right) const
+{
+    if (!FT_HAS_KERNING(m_face))
+        return 0;
+    FT_Vector kerning;
+    FT_Get_Kerning(m_face, FT_Get_Char_Index(m_face, left), FT_Get_Char_Index(m_face, right),
+                   FT_KERNING_DEFAULT, &kerning);
+    return (int) ((kerning.x + 32) >> 6);
+}
@@ -0,0 +1,311 @@
+#pragma once
+#include <cassert>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+// A unit geodesic sphere: each face of an icosahedron is cut into
+// frequency * frequency triangles, and the new vertices are pushed out to
+// the sphere.  Vertices are shared, so it draws indexed.  Triangles that
+// reach above the given height are dropped, which makes a dome.  Like the
+// old dome's, triangles wind counterclockwise as seen from inside.
+//
+// Every triangle maps the whole of an equilateral texture triangle, like
+// the one Holodeck's dome uses.  That texture looks the same whichever
+// corner goes where, so a vertex can be shared as long as the triangles
+// around it agree on its corner.  The lattice on each face allows that,
+// but the icosahedron's twelve five-way vertices don't, so vertices are
+// duplicated along the few seams that leads to.
+//
+// GeodesicLod picks between spheres of different frequencies from frame
+// to frame.  Nothing here touches GL.
+
+class GeodesicSphere {
+public:
+    GeodesicSphere(int frequency, float maxHeight = 1);
+    int GetFrequency() const { return m_frequency; }
+    int GetVertexCount() const { return m_vertexPoints.size(); }
+    int GetPointCount() const { return m_positions.size() / 3; }   // a dome's too
+    int GetTriangleIndexCount() const { return m_indices.size(); }
+    int GetLineIndexCount() const { return m_lineIndices.size(); }
+    int GetPoint(int vertex) const { return m_vertexPoints[vertex]; }
+    const float* GetPosition(int vertex) const;
+    const float* GetTexCoord(int vertex) const;
+    const std::vector<unsigned short>& GetTriangleIndices() const { return m_indices; }
+    const std::vector<unsigned short>& GetLineIndices() const { return m_lineIndices; }
+    static float GetEdgeAngle(int frequency);
+private:
+    // A lattice point, as weights on up to three of the icosahedron's
+    // vertices, sorted by vertex so that the faces sharing it agree.
+    struct Key {
+        int Vertex[3];
+        int Weight[3];
+        bool operator<(const Key& other) const;
+    };
+    int Weld(const int* vertices, const int* weights, const float (*icosahedron)[3]);
+    void Label(const std::vector<int>& triangles);
+    int m_frequency;
+    std::vector<float> m_positions;             // three per lattice point
+    std::vector<int> m_vertexPoints;            // the lattice point of each vertex
+    std::vector<unsigned char> m_corners;       // the texture corner of each vertex
+    std::vector<unsigned short> m_indices;
+    std::vector<unsigned short> m_lineIndices;
+    std::map<Key, int> m_points;
+};
+
+// Picks a level each frame so that edges stay under a size on screen.
+// Going finer happens straight away; going coarser waits until the
+// coarser level is comfortably under, so a sphere that hovers at a
+// threshold doesn't flicker between two levels.
+class GeodesicLod {
+public:
+    GeodesicLod(float maxEdgePixels, float hysteresis = 0.75f) :
+        m_maxEdgePixels(maxEdgePixels), m_hysteresis(hysteresis), m_level(-1) {}
+    int AddLevel(int frequency);
+    int GetLevelCount() const { return m_frequencies.size(); }
+    int GetFrequency(int level) const { return m_frequencies[level]; }
+    int GetLevel() const { return m_level; }
+    int Update(float screenRadius);
+    float GetEdgePixels(int level, float screenRadius) const;
+private:
+    float m_maxEdgePixels;
+    float m_hysteresis;
+    int m_level;
+    std::vector<int> m_frequencies;
+};
+
+inline bool GeodesicSphere::Key::operator<(const Key& other) const
+{
+    for (int i = 0; i < 3; ++i) {
+        if (Vertex[i] != other.Vertex[i])
+            return Vertex[i] < other.Vertex[i];
+        if (Weight[i] != other.Weight[i])
+            return Weight[i] < other.Weight[i];
+    }
+    return false;
+}
+
+inline GeodesicSphere::GeodesicSphere(int frequency, float maxHeight) :
+    m_frequency(frequency)
+{
+    assert(frequency >= 1);
+
+    // The same icosahedron as the old GeodesicDome.py.
+    const float a = 0.850651f, b = 0.525731f;
+    const float icosahedron[12][3] = {
+        { 0, b, -a }, { b, a, 0 }, { -b, a, 0 }, { 0, b, a },
+        { 0, -b, a }, { -a, 0, b }, { 0, -b, -a }, { a, 0, -b },
+        { a, 0, b }, { -a, 0, -b }, { b, -a, 0 }, { -b, -a, 0 },
+    };
+    const int faces[20][3] = {
+        { 0, 1, 2 }, { 3, 2, 1 }, { 3, 4, 5 }, { 3, 8, 4 }, { 0, 6, 7 },
+        { 0, 9, 6 }, { 4, 10, 11 }, { 6, 11, 10 }, { 2, 5, 9 }, { 11, 9, 5 },
+        { 1, 7, 8 }, { 10, 8, 7 }, { 3, 5, 2 }, { 3, 1, 8 }, { 0, 2, 9 },
+        { 0, 7, 1 }, { 6, 9, 11 }, { 6, 10, 7 }, { 4, 11, 5 }, { 4, 8, 10 },
+    };
+
+    // Each face's lattice, row by row: point (i, j) is i steps towards the
+    // face's second vertex and j steps towards its third.
+    int n = frequency;
+    std::vector<int> points((n + 1) * (n + 2) / 2);
+    std::vector<int> triangles;
+    for (int face = 0; face < 20; ++face) {
+        for (int j = 0, point = 0; j <= n; ++j) {
+            for (int i = 0; i + j <= n; ++i) {
+                int weights[3] = { n - i - j, i, j };
+                points[point++] = Weld(faces[face], weights, icosahedron);
+            }
+        }
+        for (int j = 0, row = 0; j < n; row += n + 1 - j, ++j) {
+            int next = row + n + 1 - j;
+            for (int i = 0; i + j < n; ++i) {
+                triangles.push_back(points[row + i]);
+                triangles.push_back(points[row + i + 1]);
+                triangles.push_back(points[next + i]);
+                if (i + j == n - 1)
+                    continue;
+                triangles.push_back(points[row + i + 1]);
+                triangles.push_back(points[next + i + 1]);
+                triangles.push_back(points[next + i]);
+            }
+        }
+    }
+    m_points.clear();
+
+    std::vector<int> kept;
+    for (size_t t = 0; t < triangles.size(); t += 3) {
+        if (m_positions[triangles[t] * 3 + 1] <= maxHeight &&
+            m_positions[triangles[t + 1] * 3 + 1] <= maxHeight &&
+            m_positions[triangles[t + 2] * 3 + 1] <= maxHeight)
+            kept.insert(kept.end(), triangles.begin() + t, triangles.begin() + t + 3);
+    }
+    Label(kept);
+}
+
+// Returns the lattice point, adding it if no face has yet.  Its position
+// comes from the sorted key, so it's the same whichever face asks first.
+inline int GeodesicSphere::Weld(const int* vertices, const int* weights,
+                                const float (*icosahedron)[3])
+{
+    Key key;
+    int count = 0;
+    for (int i = 0; i < 3; ++i) {
+        if (!weights[i])
+            continue;
+        int slot = count++;
+        for (; slot > 0 && key.Vertex[slot - 1] > vertices[i]; --slot) {
+            key.Vertex[slot] = key.Vertex[slot - 1];
+            key.Weight[slot] = key.Weight[slot - 1];
+        }
+        key.Vertex[slot] = vertices[i];
+        key.Weight[slot] = weights[i];
+    }
+    for (int i = count; i < 3; ++i)
+        key.Vertex[i] = key.Weight[i] = -1;
+
+    std::map<Key, int>::iterator found = m_points.find(key);
+    if (found != m_points.end())
+        return found->second;
+
+    float p[3] = { 0, 0, 0 };
+    for (int i = 0; i < count; ++i)
+        for (int c = 0; c < 3; ++c)
+            p[c] += icosahedron[key.Vertex[i]][c] * key.Weight[i];
+    float scale = 1 / std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+    int point = m_positions.size() / 3;
+    for (int c = 0; c < 3; ++c)
+        m_positions.push_back(p[c] * scale);
+    m_points[key] = point;
+    return point;
+}
+
+// Hands out the three texture corners to every triangle's vertices.
+// Going breadth first means each triangle after the first meets one that's
+// done along an edge, which settles two of its corners; its vertices are
+// shared wherever a lattice point already has one with the right corner.
+inline void GeodesicSphere::Label(const std::vector<int>& triangles)
+{
+    static const int permutations[6][3] = {
+        { 0, 1, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 0, 2, 1 }, { 2, 1, 0 }, { 1, 0, 2 },
+    };
+    int triangleCount = triangles.size() / 3;
+
+    // The triangle and side that first had each edge, and each side's
+    // neighbour.
+    std::map<std::pair<int, int>, int> edges;
+    std::vector<int> neighbors(triangles.size(), -1);
+    for (int side = 0; side < (int) triangles.size(); ++side) {
+        int p = triangles[side], q = triangles[side - side % 3 + (side + 1) % 3];
+        std::pair<int, int> edge(std::min(p, q), std::max(p, q));
+        std::map<std::pair<int, int>, int>::iterator found = edges.find(edge);
+        if (found == edges.end()) {
+            edges[edge] = side;
+        } else {
+            neighbors[side] = found->second / 3;
+            neighbors[found->second] = side / 3;
+        }
+    }
+
+    std::vector<int> vertices(m_positions.size(), -1);     // per lattice point and corner
+    std::vector<int> firstIndex(triangleCount, -1);
+    std::vector<int> queue;
+    size_t head = 0;
+    for (int seed = 0; seed < triangleCount; ++seed) {
+        if (firstIndex[seed] >= 0)
+            continue;
+        firstIndex[seed] = 0;
+        queue.push_back(seed);
+        for (; head < queue.size(); ++head) {
+            int t = queue[head];
+            const int* points = &triangles[t * 3];
+            int best = 0, bestShared = -1;
+            for (int p = 0; p < 6; ++p) {
+                int shared = 0;
+                for (int c = 0; c < 3; ++c)
+                    shared += vertices[points[c] * 3 + permutations[p][c]] >= 0;
+                if (shared > bestShared) {
+                    best = p;
+                    bestShared = shared;
+                }
+            }
+            firstIndex[t] = m_indices.size();
+            for (int c = 0; c < 3; ++c) {
+                int corner = permutations[best][c];
+                int& vertex = vertices[points[c] * 3 + corner];
+                if (vertex < 0) {
+                    vertex = m_vertexPoints.size();
+                    m_vertexPoints.push_back(points[c]);
+                    m_corners.push_back(corner);
+                }
+                m_indices.push_back(vertex);
+            }
+            for (int side = 0; side < 3; ++side) {
+                int neighbor = neighbors[t * 3 + side];
+                if (neighbor >= 0 && firstIndex[neighbor] < 0) {
+                    firstIndex[neighbor] = 0;
+                    queue.push_back(neighbor);
+                }
+            }
+        }
+    }
+    assert(m_vertexPoints.size() <= 65536);
+
+    // Each edge once, even where a seam splits its vertices.
+    std::map<std::pair<int, int>, int>::const_iterator edge = edges.begin();
+    for (; edge != edges.end(); ++edge) {
+        int side = edge->second, first = firstIndex[side / 3];
+        m_lineIndices.push_back(m_indices[first + side % 3]);
+        m_lineIndices.push_back(m_indices[first + (side + 1) % 3]);
+    }
+}
+
+inline const float* GeodesicSphere::GetPosition(int vertex) const
+{
+    return &m_positions[m_vertexPoints[vertex] * 3];
+}
+
+// The corners of the equilateral triangle the old dome mapped, which is
+// what Triangle.png draws.
+inline const float* GeodesicSphere::GetTexCoord(int vertex) const
+{
+    static const float corners[3][2] = {
+        { 0, 1 }, { 0.5f, 0.133975f }, { 1, 1 },
+    };
+    return corners[m_corners[vertex]];
+}
+
+// The angle an edge spans, about the same everywhere on the sphere.
+inline float GeodesicSphere::GetEdgeAngle(int frequency)
+{
+    return 1.107149f / frequency;
+}
+
+// Levels go from coarsest to finest.
+inline int GeodesicLod::AddLevel(int frequency)
+{
+    assert(m_frequencies.empty() || frequency > m_frequencies.back());
+    m_frequencies.push_back(frequency);
+    return m_frequencies.size() - 1;
+}
+
+inline float GeodesicLod::GetEdgePixels(int level, float screenRadius) const
+{
+    return screenRadius * GeodesicSphere::GetEdgeAngle(m_frequencies[level]);
+}
+
+// The radius is in pixels.  Returns the level to draw.
+inline int GeodesicLod::Update(float screenRadius)
+{
+    assert(!m_frequencies.empty());
+    int last = m_frequencies.size() - 1;
+    int level = 0;
+    while (level < last && GetEdgePixels(level, screenRadius) > m_maxEdgePixels)
+        ++level;
+    if (m_level < 0 || level > m_level)
+        m_level = level;
+    while (m_level > level &&
+           GetEdgePixels(m_level - 1, screenRadius) <= m_maxEdgePixels * m_hysteresis)
+        --m_level;
+    return m_level;
+}
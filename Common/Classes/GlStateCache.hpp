@@ -0,0 +1,562 @@
+#pragma once
+#include <stdint.h>
+#include <map>
+#include <utility>
+
+// Shadows the GL state that engines set over and over, and drops calls
+// that would set it to what it already is.  Include it after the GL
+// headers, and after GlTraceHooks.hpp if that's there too, so traces show
+// what actually reaches the driver.  From then on these calls go through
+// the cache:
+//
+//     glActiveTexture, glBindTexture, glTexParameteri, glDeleteTextures
+//     glBindBuffer, glDeleteBuffers, glBlendFunc, glEnable, glDisable
+//     glClientActiveTexture, glEnableClientState, glDisableClientState,
+//     glVertexPointer, glNormalPointer, glColorPointer, glTexCoordPointer
+//                                                         (ES 1.1 only)
+//     glUseProgram, glEnableVertexAttribArray, glDisableVertexAttribArray,
+//     glVertexAttribPointer                               (ES 2.0 only)
+//
+// The cache can only be right if it sees every change, so every file that
+// draws into the context needs to include it.  There's one cache, since
+// the samples have one context; call Reset for a new context, and
+// Invalidate after code that doesn't go through the cache has changed
+// this state.
+// State that hasn't been set through the cache yet counts as unknown, so
+// the first call always goes through; the one exception is the active
+// texture unit, which starts out as GL_TEXTURE0.
+
+enum GlCachedCall {
+    GlCachedActiveTexture,
+    GlCachedBindTexture,
+    GlCachedTexParameter,
+    GlCachedBindBuffer,
+    GlCachedBlendFunc,
+    GlCachedEnable,
+    GlCachedClientState,
+    GlCachedPointer,
+    GlCachedUseProgram,
+    GlCachedAttribArray,
+    GlCachedAttribPointer,
+    GlCachedCallCount,
+};
+
+inline const char* GetGlCachedCallName(GlCachedCall call)
+{
+    static const char* names[] = {
+        "glActiveTexture", "glBindTexture", "glTexParameteri", "glBindBuffer",
+        "glBlendFunc", "glEnable/glDisable", "gl*ClientState", "gl*Pointer",
+        "glUseProgram", "gl*VertexAttribArray", "glVertexAttribPointer",
+    };
+    return names[call];
+}
+
+// One piece of state, of up to six values.
+struct GlCachedSlot {
+    GlCachedSlot() : Known(false) {}
+    bool Known;
+    uintptr_t Values[6];
+};
+
+// Slots found by key, for state with sparse keys such as capabilities.
+// Once it's full, state for new keys just goes uncached.
+class GlCachedTable {
+public:
+    GlCachedTable() : m_count(0) {}
+    GlCachedSlot* Find(uintptr_t key)
+    {
+        for (int i = 0; i < m_count; ++i)
+            if (m_keys[i] == key)
+                return &m_slots[i];
+        if (m_count == Capacity)
+            return 0;
+        m_keys[m_count] = key;
+        m_slots[m_count] = GlCachedSlot();
+        return &m_slots[m_count++];
+    }
+    void Forget(int index, uintptr_t value)
+    {
+        for (int i = 0; i < m_count; ++i)
+            if (m_slots[i].Values[index] == value)
+                m_slots[i].Known = false;
+    }
+private:
+    static const int Capacity = 32;
+    uintptr_t m_keys[Capacity];
+    GlCachedSlot m_slots[Capacity];
+    int m_count;
+};
+
+class GlStateCache {
+public:
+    static GlStateCache& Get()
+    {
+        static GlStateCache cache;
+        return cache;
+    }
+    void Invalidate() { *this = GlStateCache(m_issued, m_skipped); }
+    void Reset() { *this = GlStateCache(); }
+
+    // Each returns true if the call has to go to GL.
+    bool SetActiveTexture(GLenum unit);
+    bool SetTexture(GLenum target, GLuint texture);
+    bool SetTexParameter(GLenum target, GLenum name, GLint value);
+    bool SetBuffer(GLenum target, GLuint buffer);
+    bool SetBlendFunc(GLenum source, GLenum destination);
+    bool SetEnabled(GLenum cap, bool enabled);
+    bool SetClientActiveTexture(GLenum unit);
+    bool SetClientState(GLenum array, bool enabled);
+    bool SetPointer(GLenum array, GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
+    bool SetProgram(GLuint program);
+    bool SetAttribArray(GLuint index, bool enabled);
+    bool SetAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized,
+                          GLsizei stride, const GLvoid* pointer);
+    void DeleteTexture(GLuint texture);
+    void DeleteBuffer(GLuint buffer);
+
+    int GetIssuedCount(GlCachedCall call) const { return m_issued[call]; }
+    int GetSkippedCount(GlCachedCall call) const { return m_skipped[call]; }
+    int GetIssuedCount() const;
+    int GetSkippedCount() const;
+    void ResetCounters();
+private:
+    static const int MaxUnits = 8;
+    static const int MaxAttribs = 16;
+    GlStateCache();
+    GlStateCache(const int* issued, const int* skipped);
+    bool Update(GlCachedSlot* slot, GlCachedCall call, int count,
+                uintptr_t a = 0, uintptr_t b = 0, uintptr_t c = 0,
+                uintptr_t d = 0, uintptr_t e = 0, uintptr_t f = 0);
+    GlCachedSlot* FindTexture(GLenum target);
+    GlCachedSlot* FindBuffer(GLenum target);
+    int GetUnit(const GlCachedSlot& slot, GLenum first) const;
+    GlCachedSlot m_activeTexture;
+    GlCachedSlot m_clientActiveTexture;
+    GlCachedSlot m_textures[MaxUnits][2];
+    GlCachedSlot m_buffers[2];
+    GlCachedSlot m_blendFunc;
+    GlCachedSlot m_program;
+    GlCachedSlot m_attribArrays[MaxAttribs];
+    GlCachedSlot m_attribPointers[MaxAttribs];
+    GlCachedTable m_enables;
+    GlCachedTable m_clientStates;
+    GlCachedTable m_pointers;
+    std::map<std::pair<GLuint, GLenum>, GLint> m_texParameters;
+    int m_issued[GlCachedCallCount];
+    int m_skipped[GlCachedCallCount];
+};
+
+// Engines that only use one texture unit never select it, so this starts
+// out with the unit a new context has.
+inline GlStateCache::GlStateCache()
+{
+    m_activeTexture.Known = m_clientActiveTexture.Known = true;
+    m_activeTexture.Values[0] = m_clientActiveTexture.Values[0] = GL_TEXTURE0;
+    ResetCounters();
+}
+
+inline GlStateCache::GlStateCache(const int* issued, const int* skipped)
+{
+    for (int i = 0; i < GlCachedCallCount; ++i) {
+        m_issued[i] = issued[i];
+        m_skipped[i] = skipped[i];
+    }
+}
+
+inline void GlStateCache::ResetCounters()
+{
+    for (int i = 0; i < GlCachedCallCount; ++i)
+        m_issued[i] = m_skipped[i] = 0;
+}
+
+inline int GlStateCache::GetIssuedCount() const
+{
+    int total = 0;
+    for (int i = 0; i < GlCachedCallCount; ++i)
+        total += m_issued[i];
+    return total;
+}
+
+inline int GlStateCache::GetSkippedCount() const
+{
+    int total = 0;
+    for (int i = 0; i < GlCachedCallCount; ++i)
+        total += m_skipped[i];
+    return total;
+}
+
+// Stores the values, returning false if the slot already held them.  A
+// null slot is state that can't be cached, so the call always goes out.
+inline bool GlStateCache::Update(GlCachedSlot* slot, GlCachedCall call, int count,
+                                 uintptr_t a, uintptr_t b, uintptr_t c,
+                                 uintptr_t d, uintptr_t e, uintptr_t f)
+{
+    uintptr_t values[6] = { a, b, c, d, e, f };
+    if (slot && slot->Known) {
+        bool same = true;
+        for (int i = 0; i < count; ++i)
+            same = same && slot->Values[i] == values[i];
+        if (same) {
+            ++m_skipped[call];
+            return false;
+        }
+    }
+    if (slot) {
+        slot->Known = true;
+        for (int i = 0; i < count; ++i)
+            slot->Values[i] = values[i];
+    }
+    ++m_issued[call];
+    return true;
+}
+
+// Returns -1 if the unit isn't known or is past what the cache tracks.
+inline int GlStateCache::GetUnit(const GlCachedSlot& slot, GLenum first) const
+{
+    if (!slot.Known || slot.Values[0] < first || slot.Values[0] >= first + MaxUnits)
+        return -1;
+    return (int) (slot.Values[0] - first);
+}
+
+inline GlCachedSlot* GlStateCache::FindTexture(GLenum target)
+{
+    int unit = GetUnit(m_activeTexture, GL_TEXTURE0);
+    int index = target == GL_TEXTURE_2D ? 0 : 1;
+#ifdef GL_TEXTURE_CUBE_MAP
+    if (target != GL_TEXTURE_2D && target != GL_TEXTURE_CUBE_MAP)
+        return 0;
+#else
+    if (target != GL_TEXTURE_2D)
+        return 0;
+#endif
+    return unit < 0 ? 0 : &m_textures[unit][index];
+}
+
+inline GlCachedSlot* GlStateCache::FindBuffer(GLenum target)
+{
+    if (target == GL_ARRAY_BUFFER)
+        return &m_buffers[0];
+    if (target == GL_ELEMENT_ARRAY_BUFFER)
+        return &m_buffers[1];
+    return 0;
+}
+
+inline bool GlStateCache::SetActiveTexture(GLenum unit)
+{
+    return Update(&m_activeTexture, GlCachedActiveTexture, 1, unit);
+}
+
+inline bool GlStateCache::SetTexture(GLenum target, GLuint texture)
+{
+    return Update(FindTexture(target), GlCachedBindTexture, 1, texture);
+}
+
+// Parameters belong to the texture, so they're keyed by whichever one is
+// bound.  If that isn't known, it could be any of them.
+inline bool GlStateCache::SetTexParameter(GLenum target, GLenum name, GLint value)
+{
+    GlCachedSlot* texture = FindTexture(target);
+    if (!texture || !texture->Known) {
+        m_texParameters.clear();
+        ++m_issued[GlCachedTexParameter];
+        return true;
+    }
+
+    std::pair<GLuint, GLenum> key((GLuint) texture->Values[0], name);
+    std::map<std::pair<GLuint, GLenum>, GLint>::iterator parameter = m_texParameters.find(key);
+    if (parameter != m_texParameters.end() && parameter->second == value) {
+        ++m_skipped[GlCachedTexParameter];
+        return false;
+    }
+    m_texParameters[key] = value;
+    ++m_issued[GlCachedTexParameter];
+    return true;
+}
+
+inline bool GlStateCache::SetBuffer(GLenum target, GLuint buffer)
+{
+    return Update(FindBuffer(target), GlCachedBindBuffer, 1, buffer);
+}
+
+inline bool GlStateCache::SetBlendFunc(GLenum source, GLenum destination)
+{
+    return Update(&m_blendFunc, GlCachedBlendFunc, 2, source, destination);
+}
+
+// In ES 1.1, texturing is enabled per texture unit.
+inline bool GlStateCache::SetEnabled(GLenum cap, bool enabled)
+{
+    uintptr_t key = cap;
+    if (cap == GL_TEXTURE_2D) {
+        int unit = GetUnit(m_activeTexture, GL_TEXTURE0);
+        key = unit < 0 ? 0 : cap + ((uintptr_t) unit << 16);
+    }
+    return Update(key ? m_enables.Find(key) : 0, GlCachedEnable, 1, enabled);
+}
+
+inline bool GlStateCache::SetClientActiveTexture(GLenum unit)
+{
+    return Update(&m_clientActiveTexture, GlCachedActiveTexture, 1, unit);
+}
+
+// Texture coordinate arrays are per unit too, chosen with
+// glClientActiveTexture.
+inline bool GlStateCache::SetClientState(GLenum array, bool enabled)
+{
+    uintptr_t key = array;
+#ifdef GL_TEXTURE_COORD_ARRAY
+    if (array == GL_TEXTURE_COORD_ARRAY) {
+        int unit = GetUnit(m_clientActiveTexture, GL_TEXTURE0);
+        key = unit < 0 ? 0 : array + ((uintptr_t) unit << 16);
+    }
+#endif
+    return Update(key ? m_clientStates.Find(key) : 0, GlCachedClientState, 1, enabled);
+}
+
+// Pointers are offsets into whichever array buffer is bound, so that's
+// part of the state; with no way of knowing it, the call goes uncached.
+inline bool GlStateCache::SetPointer(GLenum array, GLint size, GLenum type, GLsizei stride,
+                                     const GLvoid* pointer)
+{
+    uintptr_t key = array;
+#ifdef GL_TEXTURE_COORD_ARRAY
+    if (array == GL_TEXTURE_COORD_ARRAY) {
+        int unit = GetUnit(m_clientActiveTexture, GL_TEXTURE0);
+        key = unit < 0 ? 0 : array + ((uintptr_t) unit << 16);
+    }
+#endif
+    GlCachedSlot* slot = key ? m_pointers.Find(key) : 0;
+    if (slot && !m_buffers[0].Known) {
+        slot->Known = false;
+        slot = 0;
+    }
+    return Update(slot, GlCachedPointer, 5, size, type, stride, (uintptr_t) pointer,
+                  m_buffers[0].Values[0]);
+}
+
+inline bool GlStateCache::SetProgram(GLuint program)
+{
+    return Update(&m_program, GlCachedUseProgram, 1, program);
+}
+
+inline bool GlStateCache::SetAttribArray(GLuint index, bool enabled)
+{
+    GlCachedSlot* slot = index < MaxAttribs ? &m_attribArrays[index] : 0;
+    return Update(slot, GlCachedAttribArray, 1, enabled);
+}
+
+inline bool GlStateCache::SetAttribPointer(GLuint index, GLint size, GLenum type,
+                                           GLboolean normalized, GLsizei stride,
+                                           const GLvoid* pointer)
+{
+    GlCachedSlot* slot = index < MaxAttribs ? &m_attribPointers[index] : 0;
+    if (slot && !m_buffers[0].Known) {
+        slot->Known = false;
+        slot = 0;
+    }
+    return Update(slot, GlCachedAttribPointer, 6, size, type, normalized, stride,
+                  (uintptr_t) pointer, m_buffers[0].Values[0]);
+}
+
+// Deleting a bound texture or buffer binds zero in its place.  A new
+// texture with the same name starts with default parameters, and pointers
+// into a deleted buffer still point into it rather than a new one.
+inline void GlStateCache::DeleteTexture(GLuint texture)
+{
+    for (int unit = 0; unit < MaxUnits; ++unit)
+        for (int i = 0; i < 2; ++i)
+            if (m_textures[unit][i].Known && m_textures[unit][i].Values[0] == texture)
+                m_textures[unit][i].Values[0] = 0;
+
+    std::map<std::pair<GLuint, GLenum>, GLint>::iterator parameter =
+        m_texParameters.lower_bound(std::make_pair(texture, (GLenum) 0));
+    while (parameter != m_texParameters.end() && parameter->first.first == texture)
+        m_texParameters.erase(parameter++);
+}
+
+inline void GlStateCache::DeleteBuffer(GLuint buffer)
+{
+    for (int i = 0; i < 2; ++i)
+        if (m_buffers[i].Known && m_buffers[i].Values[0] == buffer)
+            m_buffers[i].Values[0] = 0;
+    m_pointers.Forget(4, buffer);
+    for (int i = 0; i < MaxAttribs; ++i)
+        if (m_attribPointers[i].Values[5] == buffer)
+            m_attribPointers[i].Known = false;
+}
+
+inline void CachedGlActiveTexture(GLenum unit)
+{
+    if (GlStateCache::Get().SetActiveTexture(unit))
+        glActiveTexture(unit);
+}
+
+inline void CachedGlBindTexture(GLenum target, GLuint texture)
+{
+    if (GlStateCache::Get().SetTexture(target, texture))
+        glBindTexture(target, texture);
+}
+
+inline void CachedGlTexParameteri(GLenum target, GLenum name, GLint value)
+{
+    if (GlStateCache::Get().SetTexParameter(target, name, value))
+        glTexParameteri(target, name, value);
+}
+
+inline void CachedGlDeleteTextures(GLsizei count, const GLuint* textures)
+{
+    glDeleteTextures(count, textures);
+    for (GLsizei i = 0; i < count; ++i)
+        GlStateCache::Get().DeleteTexture(textures[i]);
+}
+
+inline void CachedGlBindBuffer(GLenum target, GLuint buffer)
+{
+    if (GlStateCache::Get().SetBuffer(target, buffer))
+        glBindBuffer(target, buffer);
+}
+
+inline void CachedGlDeleteBuffers(GLsizei count, const GLuint* buffers)
+{
+    glDeleteBuffers(count, buffers);
+    for (GLsizei i = 0; i < count; ++i)
+        GlStateCache::Get().DeleteBuffer(buffers[i]);
+}
+
+inline void CachedGlBlendFunc(GLenum source, GLenum destination)
+{
+    if (GlStateCache::Get().SetBlendFunc(source, destination))
+        glBlendFunc(source, destination);
+}
+
+inline void CachedGlEnable(GLenum cap)
+{
+    if (GlStateCache::Get().SetEnabled(cap, true))
+        glEnable(cap);
+}
+
+inline void CachedGlDisable(GLenum cap)
+{
+    if (GlStateCache::Get().SetEnabled(cap, false))
+        glDisable(cap);
+}
+
+#undef glActiveTexture
+#undef glBindTexture
+#undef glTexParameteri
+#undef glDeleteTextures
+#undef glBindBuffer
+#undef glDeleteBuffers
+#undef glBlendFunc
+#undef glEnable
+#undef glDisable
+#define glActiveTexture CachedGlActiveTexture
+#define glBindTexture CachedGlBindTexture
+#define glTexParameteri CachedGlTexParameteri
+#define glDeleteTextures CachedGlDeleteTextures
+#define glBindBuffer CachedGlBindBuffer
+#define glDeleteBuffers CachedGlDeleteBuffers
+#define glBlendFunc CachedGlBlendFunc
+#define glEnable CachedGlEnable
+#define glDisable CachedGlDisable
+
+#ifdef GL_VERSION_ES_CM_1_0
+
+inline void CachedGlClientActiveTexture(GLenum unit)
+{
+    if (GlStateCache::Get().SetClientActiveTexture(unit))
+        glClientActiveTexture(unit);
+}
+
+inline void CachedGlEnableClientState(GLenum array)
+{
+    if (GlStateCache::Get().SetClientState(array, true))
+        glEnableClientState(array);
+}
+
+inline void CachedGlDisableClientState(GLenum array)
+{
+    if (GlStateCache::Get().SetClientState(array, false))
+        glDisableClientState(array);
+}
+
+inline void CachedGlVertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    if (GlStateCache::Get().SetPointer(GL_VERTEX_ARRAY, size, type, stride, pointer))
+        glVertexPointer(size, type, stride, pointer);
+}
+
+inline void CachedGlNormalPointer(GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    if (GlStateCache::Get().SetPointer(GL_NORMAL_ARRAY, 3, type, stride, pointer))
+        glNormalPointer(type, stride, pointer);
+}
+
+inline void CachedGlColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    if (GlStateCache::Get().SetPointer(GL_COLOR_ARRAY, size, type, stride, pointer))
+        glColorPointer(size, type, stride, pointer);
+}
+
+inline void CachedGlTexCoordPointer(GLint size, GLenum type, GLsizei stride,
+                                    const GLvoid* pointer)
+{
+    if (GlStateCache::Get().SetPointer(GL_TEXTURE_COORD_ARRAY, size, type, stride, pointer))
+        glTexCoordPointer(size, type, stride, pointer);
+}
+
+#undef glClientActiveTexture
+#undef glEnableClientState
+#undef glDisableClientState
+#undef glVertexPointer
+#undef glNormalPointer
+#undef glColorPointer
+#undef glTexCoordPointer
+#define glClientActiveTexture CachedGlClientActiveTexture
+#define glEnableClientState CachedGlEnableClientState
+#define glDisableClientState CachedGlDisableClientState
+#define glVertexPointer CachedGlVertexPointer
+#define glNormalPointer CachedGlNormalPointer
+#define glColorPointer CachedGlColorPointer
+#define glTexCoordPointer CachedGlTexCoordPointer
+
+#endif
+
+#ifdef GL_ES_VERSION_2_0
+
+inline void CachedGlUseProgram(GLuint program)
+{
+    if (GlStateCache::Get().SetProgram(program))
+        glUseProgram(program);
+}
+
+inline void CachedGlEnableVertexAttribArray(GLuint index)
+{
+    if (GlStateCache::Get().SetAttribArray(index, true))
+        glEnableVertexAttribArray(index);
+}
+
+inline void CachedGlDisableVertexAttribArray(GLuint index)
+{
+    if (GlStateCache::Get().SetAttribArray(index, false))
+        glDisableVertexAttribArray(index);
+}
+
+inline void CachedGlVertexAttribPointer(GLuint index, GLint size, GLenum type,
+                                        GLboolean normalized, GLsizei stride,
+                                        const GLvoid* pointer)
+{
+    if (GlStateCache::Get().SetAttribPointer(index, size, type, normalized, stride, pointer))
+        glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+#undef glUseProgram
+#undef glEnableVertexAttribArray
+#undef glDisableVertexAttribArray
+#undef glVertexAttribPointer
+#define glUseProgram CachedGlUseProgram
+#define glEnableVertexAttribArray CachedGlEnableVertexAttribArray
+#define glDisableVertexAttribArray CachedGlDisableVertexAttribArray
+#define glVertexAttribPointer CachedGlVertexAttribPointer
+
+#endif
@@ -0,0 +1,582 @@
+#pragma once
+#include <stdint.h>
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+// A compact binary record of the OpenGL ES 2.0 calls that an engine makes,
+// payloads included, for looking at frames away from the device.  The calls
+// get captured by the wrappers in GlTraceHooks.hpp; this file has the
+// format, the recorder they write to, and a reader that replays the calls
+// through an IGlTraceBackend, such as GlTraceAnalyzer below, which needs no
+// GL at all, or GlTracePlayer, which issues them to a real context.
+//
+//     GL_TRACE_FRAME();   ends a frame; see GL_TRACE_FRAMES
+//
+// The recorder is compiled out unless ENABLE_GL_TRACE is defined.
+//
+// A trace is "GLTR" and a version, then one command after another: the op
+// as a byte, each integer argument as a zigzag varint, each float argument
+// as four little-endian bytes, and for ops that carry one, the payload as a
+// varint size plus one (zero for a null pointer) followed by the bytes.
+
+#ifndef GL_TRACE_FRAMES
+#define GL_TRACE_FRAMES 60
+#endif
+
+#ifdef ENABLE_GL_TRACE
+#define GL_TRACE_FRAME() GlTraceRecorder::Get().EndFrame()
+#else
+#define GL_TRACE_FRAME()
+#endif
+
+// Name, integer arguments, float arguments, and whether there's a payload.
+// Gen and Delete calls are recorded one name at a time.
+#define GL_TRACE_OPS(X) \
+    X(ActiveTexture, 1, 0, false) \
+    X(AttachShader, 2, 0, false) \
+    X(BindAttribLocation, 2, 0, true) \
+    X(BindBuffer, 2, 0, false) \
+    X(BindFramebuffer, 2, 0, false) \
+    X(BindRenderbuffer, 2, 0, false) \
+    X(BindTexture, 2, 0, false) \
+    X(BlendFunc, 2, 0, false) \
+    X(BufferData, 3, 0, true) \
+    X(BufferSubData, 2, 0, true) \
+    X(Clear, 1, 0, false) \
+    X(ClearColor, 0, 4, false) \
+    X(ClearDepthf, 0, 1, false) \
+    X(ColorMask, 4, 0, false) \
+    X(CompileShader, 1, 0, false) \
+    X(CompressedTexImage2D, 6, 0, true) \
+    X(CreateProgram, 1, 0, false) \
+    X(CreateShader, 2, 0, false) \
+    X(CullFace, 1, 0, false) \
+    X(DeleteBuffer, 1, 0, false) \
+    X(DeleteFramebuffer, 1, 0, false) \
+    X(DeleteProgram, 1, 0, false) \
+    X(DeleteRenderbuffer, 1, 0, false) \
+    X(DeleteShader, 1, 0, false) \
+    X(DeleteTexture, 1, 0, false) \
+    X(DepthFunc, 1, 0, false) \
+    X(DepthMask, 1, 0, false) \
+    X(Disable, 1, 0, false) \
+    X(DisableVertexAttribArray, 1, 0, false) \
+    X(DrawArrays, 3, 0, false) \
+    X(DrawElements, 4, 0, true) \
+    X(Enable, 1, 0, false) \
+    X(EnableVertexAttribArray, 1, 0, false) \
+    X(FramebufferRenderbuffer, 4, 0, false) \
+    X(FramebufferTexture2D, 5, 0, false) \
+    X(FrontFace, 1, 0, false) \
+    X(GenBuffer, 1, 0, false) \
+    X(GenFramebuffer, 1, 0, false) \
+    X(GenRenderbuffer, 1, 0, false) \
+    X(GenTexture, 1, 0, false) \
+    X(GenerateMipmap, 1, 0, false) \
+    X(GetAttribLocation, 2, 0, true) \
+    X(GetUniformLocation, 2, 0, true) \
+    X(LineWidth, 0, 1, false) \
+    X(LinkProgram, 1, 0, false) \
+    X(PixelStorei, 2, 0, false) \
+    X(RenderbufferStorage, 4, 0, false) \
+    X(Scissor, 4, 0, false) \
+    X(ShaderSource, 1, 0, true) \
+    X(TexImage2D, 8, 0, true) \
+    X(TexParameteri, 3, 0, false) \
+    X(TexSubImage2D, 8, 0, true) \
+    X(Uniform1f, 1, 1, false) \
+    X(Uniform2f, 1, 2, false) \
+    X(Uniform3f, 1, 3, false) \
+    X(Uniform4f, 1, 4, false) \
+    X(Uniform1i, 2, 0, false) \
+    X(Uniform1fv, 2, 0, true) \
+    X(Uniform2fv, 2, 0, true) \
+    X(Uniform3fv, 2, 0, true) \
+    X(Uniform4fv, 2, 0, true) \
+    X(UniformMatrix3fv, 3, 0, true) \
+    X(UniformMatrix4fv, 3, 0, true) \
+    X(UseProgram, 1, 0, false) \
+    X(VertexAttribPointer, 6, 0, false) \
+    X(Viewport, 4, 0, false) \
+    X(EndFrame, 0, 0, false)
+
+#define GL_TRACE_ENUM(name, ints, floats, payload) GlTraceOp##name,
+enum GlTraceOp {
+    GL_TRACE_OPS(GL_TRACE_ENUM)
+    GlTraceOpCount,
+};
+#undef GL_TRACE_ENUM
+
+struct GlTraceSignature {
+    const char* Name;
+    int IntCount;
+    int FloatCount;
+    bool HasPayload;
+};
+
+inline const GlTraceSignature& GetGlTraceSignature(GlTraceOp op)
+{
+    #define GL_TRACE_SIGNATURE(name, ints, floats, payload) { "gl" #name, ints, floats, payload },
+    static const GlTraceSignature signatures[] = { GL_TRACE_OPS(GL_TRACE_SIGNATURE) };
+    #undef GL_TRACE_SIGNATURE
+    return signatures[op];
+}
+
+static const int GlTraceMaxInts = 8;
+static const int GlTraceMaxFloats = 4;
+static const uint32_t GlTraceVersion = 1;
+
+// One call, as recorded or read back.  The payload points into the
+// caller's memory when recording, and into the trace when replaying.
+struct GlTraceCommand {
+    GlTraceCommand(GlTraceOp op = GlTraceOpEndFrame) :
+        Op(op), IntCount(0), FloatCount(0), Payload(0), PayloadSize(0) {}
+    GlTraceCommand& Int(int64_t value)
+    {
+        assert(IntCount < GlTraceMaxInts);
+        Ints[IntCount++] = value;
+        return *this;
+    }
+    GlTraceCommand& Float(float value)
+    {
+        assert(FloatCount < GlTraceMaxFloats);
+        Floats[FloatCount++] = value;
+        return *this;
+    }
+    GlTraceCommand& Data(const void* payload, int size)
+    {
+        Payload = (const unsigned char*) payload;
+        PayloadSize = payload ? size : 0;
+        return *this;
+    }
+    GlTraceOp Op;
+    int IntCount;
+    int FloatCount;
+    int64_t Ints[GlTraceMaxInts];
+    float Floats[GlTraceMaxFloats];
+    const unsigned char* Payload;
+    int PayloadSize;
+};
+
+// Appends commands to a buffer in the format described above.
+class GlTraceWriter {
+public:
+    GlTraceWriter()
+    {
+        const unsigned char header[] = { 'G', 'L', 'T', 'R' };
+        m_bytes.insert(m_bytes.end(), header, header + 4);
+        WriteVarint(GlTraceVersion);
+    }
+    void Write(const GlTraceCommand& command)
+    {
+        const GlTraceSignature& signature = GetGlTraceSignature(command.Op);
+        assert(command.IntCount == signature.IntCount &&
+               command.FloatCount == signature.FloatCount && "Wrong arguments for the op.");
+        m_bytes.push_back((unsigned char) command.Op);
+        for (int i = 0; i < command.IntCount; ++i)
+            WriteVarint(((uint64_t) command.Ints[i] << 1) ^ (uint64_t) (command.Ints[i] >> 63));
+        for (int i = 0; i < command.FloatCount; ++i) {
+            unsigned char bytes[4];
+            memcpy(bytes, &command.Floats[i], 4);
+            m_bytes.insert(m_bytes.end(), bytes, bytes + 4);
+        }
+        if (signature.HasPayload) {
+            WriteVarint(command.Payload ? command.PayloadSize + 1 : 0);
+            m_bytes.insert(m_bytes.end(), command.Payload, command.Payload + command.PayloadSize);
+        }
+    }
+    const std::vector<unsigned char>& GetBytes() const { return m_bytes; }
+private:
+    void WriteVarint(uint64_t value)
+    {
+        while (value >= 0x80) {
+            m_bytes.push_back((unsigned char) (value | 0x80));
+            value >>= 7;
+        }
+        m_bytes.push_back((unsigned char) value);
+    }
+    std::vector<unsigned char> m_bytes;
+};
+
+// Hands back one command at a time from a whole trace in memory.
+class GlTraceReader {
+public:
+    GlTraceReader(const std::vector<unsigned char>& bytes) :
+        m_bytes(bytes.empty() ? 0 : &bytes[0]),
+        m_size(bytes.size()),
+        m_offset(0),
+        m_error(false)
+    {
+        uint64_t version;
+        m_error = m_size < 4 || memcmp(m_bytes, "GLTR", 4) != 0;
+        m_offset = 4;
+        m_error = m_error || !ReadVarint(&version) || version != GlTraceVersion;
+    }
+    bool IsValid() const { return !m_error; }
+    // Returns false at the end of the trace, or if it's cut short or
+    // corrupt, which HasError tells apart.
+    bool Next(GlTraceCommand& command)
+    {
+        if (m_error || m_offset == m_size)
+            return false;
+        int op = m_bytes[m_offset++];
+        if (op >= GlTraceOpCount)
+            return Fail();
+
+        command = GlTraceCommand((GlTraceOp) op);
+        const GlTraceSignature& signature = GetGlTraceSignature(command.Op);
+        for (int i = 0; i < signature.IntCount; ++i) {
+            uint64_t value;
+            if (!ReadVarint(&value))
+                return Fail();
+            command.Int((int64_t) (value >> 1) ^ -(int64_t) (value & 1));
+        }
+        for (int i = 0; i < signature.FloatCount; ++i) {
+            if (m_size - m_offset < 4)
+                return Fail();
+            float value;
+            memcpy(&value, m_bytes + m_offset, 4);
+            command.Float(value);
+            m_offset += 4;
+        }
+        if (signature.HasPayload) {
+            uint64_t size;
+            if (!ReadVarint(&size) || (size && size - 1 > m_size - m_offset))
+                return Fail();
+            if (size)
+                command.Data(m_bytes + m_offset, (int) size - 1);
+            m_offset += size ? size - 1 : 0;
+        }
+        return true;
+    }
+    bool HasError() const { return m_error; }
+private:
+    bool ReadVarint(uint64_t* value)
+    {
+        *value = 0;
+        for (int shift = 0; shift < 64 && m_offset < m_size; shift += 7) {
+            unsigned char byte = m_bytes[m_offset++];
+            *value |= (uint64_t) (byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+                return true;
+        }
+        return false;
+    }
+    bool Fail()
+    {
+        m_error = true;
+        return false;
+    }
+    const unsigned char* m_bytes;
+    size_t m_size;
+    size_t m_offset;
+    bool m_error;
+};
+
+// Replays get one call at a time.  Gen and Create commands carry the names
+// the driver gave out while recording, so backends that talk to a real
+// context have to map those onto their own.
+struct IGlTraceBackend {
+    virtual void Execute(const GlTraceCommand& command) = 0;
+    virtual ~IGlTraceBackend() {}
+};
+
+// Returns the number of frames replayed, or -1 if the trace is malformed;
+// commands before a malformed one still get executed.
+inline int ReplayGlTrace(const std::vector<unsigned char>& trace, IGlTraceBackend& backend)
+{
+    GlTraceReader reader(trace);
+    if (!reader.IsValid())
+        return -1;
+    int frameCount = 0;
+    GlTraceCommand command;
+    while (reader.Next(command)) {
+        backend.Execute(command);
+        if (command.Op == GlTraceOpEndFrame)
+            ++frameCount;
+    }
+    return reader.HasError() ? -1 : frameCount;
+}
+
+// Collects calls from process start until GL_TRACE_FRAMES frames have
+// ended, then writes them to frames.gltrace in $TMPDIR, which is the
+// application's tmp folder on the iPhone.  Recording happens on whichever
+// thread owns the context, so there's no locking.
+class GlTraceRecorder {
+public:
+    static GlTraceRecorder& Get()
+    {
+        static GlTraceRecorder recorder;
+        return recorder;
+    }
+    bool IsRecording() const { return m_writer != 0; }
+    void Record(const GlTraceCommand& command)
+    {
+        if (m_writer)
+            m_writer->Write(command);
+    }
+    void EndFrame();
+    int GetFrameCount() const { return m_frameCount; }
+private:
+    GlTraceRecorder() : m_writer(new GlTraceWriter), m_frameCount(0) {}
+    GlTraceWriter* m_writer;
+    int m_frameCount;
+};
+
+inline void GlTraceRecorder::EndFrame()
+{
+    if (!m_writer)
+        return;
+    m_writer->Write(GlTraceCommand(GlTraceOpEndFrame));
+    if (++m_frameCount < GL_TRACE_FRAMES)
+        return;
+
+    const char* folder = getenv("TMPDIR");
+    std::string path = std::string(folder ? folder : "/tmp") + "/frames.gltrace";
+    const std::vector<unsigned char>& bytes = m_writer->GetBytes();
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file && fwrite(&bytes[0], 1, bytes.size(), file) == bytes.size())
+        printf("Wrote %d frames of GL calls (%d bytes) to %s\n",
+               m_frameCount, (int) bytes.size(), path.c_str());
+    else
+        printf("Unable to write %s\n", path.c_str());
+    if (file)
+        fclose(file);
+    delete m_writer;
+    m_writer = 0;
+}
+
+// What one frame asked of the driver.  Everything before the first frame
+// ends, such as loading, counts toward the first frame.
+struct GlTraceFrameStats {
+    GlTraceFrameStats() :
+        Calls(0), DrawCalls(0), Indices(0), Binds(0), StateChanges(0), Redundant(0),
+        UploadCalls(0), BytesUploaded(0) {}
+    int Calls;
+    int DrawCalls;
+    int Indices;            // vertices or indices that the draws consumed
+    int Binds;              // objects, programs, and the active texture unit
+    int StateChanges;       // binds, enables, uniforms, and other settings
+    int Redundant;          // state changes that set what was already set
+    int UploadCalls;
+    int64_t BytesUploaded;  // buffer and texture data
+};
+
+// A backend that runs without GL.  It shadows the state that the calls
+// set, so it can tell which of them changed nothing, and counts the work
+// in each frame.  State that the trace never set is taken as unknown, so
+// the first call to set it never counts as redundant.
+class GlTraceAnalyzer : public IGlTraceBackend {
+public:
+    GlTraceAnalyzer() : m_activeTexture(0)
+    {
+        for (int i = 0; i < GlTraceOpCount; ++i)
+            m_calls[i] = m_redundant[i] = 0;
+        m_frames.push_back(GlTraceFrameStats());
+    }
+    void Execute(const GlTraceCommand& command);
+    // The last frame is the one still in progress, so usually empty.
+    const std::vector<GlTraceFrameStats>& GetFrames() const { return m_frames; }
+    int GetCallCount(GlTraceOp op) const { return m_calls[op]; }
+    int GetRedundantCount(GlTraceOp op) const { return m_redundant[op]; }
+private:
+    struct StateKey {
+        StateKey(int64_t a = 0, int64_t b = 0, int64_t c = 0, int64_t d = 0)
+        {
+            Keys[0] = a; Keys[1] = b; Keys[2] = c; Keys[3] = d;
+        }
+        bool operator<(const StateKey& other) const
+        {
+            return std::lexicographical_compare(Keys, Keys + 4, other.Keys, other.Keys + 4);
+        }
+        int64_t Keys[4];
+    };
+    typedef std::vector<unsigned char> StateValue;
+    void Set(const StateKey& key, const GlTraceCommand& command, int firstInt, bool bind);
+    void Forget(GlTraceOp group, int64_t name);
+    int64_t Bound(const StateKey& key) const;
+    std::map<StateKey, StateValue> m_state;
+    std::vector<GlTraceFrameStats> m_frames;
+    int64_t m_activeTexture;
+    int m_calls[GlTraceOpCount];
+    int m_redundant[GlTraceOpCount];
+};
+
+// Stores the command's arguments from firstInt on, along with any floats
+// and payload, under the key, and counts it as redundant if they match
+// what was there.
+inline void GlTraceAnalyzer::Set(const StateKey& key, const GlTraceCommand& command,
+                                 int firstInt, bool bind)
+{
+    StateValue value;
+    const unsigned char* ints = (const unsigned char*) (command.Ints + firstInt);
+    const unsigned char* floats = (const unsigned char*) command.Floats;
+    value.insert(value.end(), ints, ints + (command.IntCount - firstInt) * sizeof(int64_t));
+    value.insert(value.end(), floats, floats + command.FloatCount * sizeof(float));
+    value.insert(value.end(), command.Payload, command.Payload + command.PayloadSize);
+
+    GlTraceFrameStats& frame = m_frames.back();
+    ++frame.StateChanges;
+    if (bind)
+        ++frame.Binds;
+
+    std::map<StateKey, StateValue>::iterator previous = m_state.find(key);
+    if (previous != m_state.end() && previous->second == value) {
+        ++frame.Redundant;
+        ++m_redundant[command.Op];
+    } else {
+        m_state[key] = value;
+    }
+}
+
+// Deleting an object unbinds it, and linking a program resets its
+// uniforms, so the shadowed state under that group and name goes.
+inline void GlTraceAnalyzer::Forget(GlTraceOp group, int64_t name)
+{
+    std::map<StateKey, StateValue>::iterator i = m_state.begin();
+    while (i != m_state.end()) {
+        bool matches = i->first.Keys[0] == group;
+        if (matches && group == GlTraceOpUniform1f)
+            matches = i->first.Keys[1] == name;
+        else if (matches)
+            matches = i->second.size() == sizeof(int64_t) &&
+                      *(const int64_t*) &i->second[0] == name;
+        if (matches)
+            m_state.erase(i++);
+        else
+            ++i;
+    }
+}
+
+inline int64_t GlTraceAnalyzer::Bound(const StateKey& key) const
+{
+    std::map<StateKey, StateValue>::const_iterator i = m_state.find(key);
+    return i == m_state.end() ? 0 : *(const int64_t*) &i->second[0];
+}
+
+inline void GlTraceAnalyzer::Execute(const GlTraceCommand& command)
+{
+    GlTraceFrameStats& frame = m_frames.back();
+    const int64_t* a = command.Ints;
+    GlTraceOp op = command.Op;
+    if (op == GlTraceOpEndFrame) {
+        m_frames.push_back(GlTraceFrameStats());
+        return;
+    }
+    ++frame.Calls;
+    ++m_calls[op];
+
+    switch (op) {
+    case GlTraceOpActiveTexture:
+        m_activeTexture = a[0];
+        Set(StateKey(op), command, 0, true);
+        break;
+    case GlTraceOpBindTexture:
+        Set(StateKey(op, m_activeTexture, a[0]), command, 1, true);
+        break;
+    case GlTraceOpBindBuffer:
+    case GlTraceOpBindFramebuffer:
+    case GlTraceOpBindRenderbuffer:
+        Set(StateKey(op, a[0]), command, 1, true);
+        break;
+    case GlTraceOpUseProgram:
+        Set(StateKey(op), command, 0, true);
+        break;
+    case GlTraceOpBlendFunc:
+    case GlTraceOpClearColor:
+    case GlTraceOpClearDepthf:
+    case GlTraceOpColorMask:
+    case GlTraceOpCullFace:
+    case GlTraceOpDepthFunc:
+    case GlTraceOpDepthMask:
+    case GlTraceOpFrontFace:
+    case GlTraceOpLineWidth:
+    case GlTraceOpScissor:
+    case GlTraceOpViewport:
+        Set(StateKey(op), command, 0, false);
+        break;
+    case GlTraceOpEnable:
+    case GlTraceOpDisable:
+        Set(StateKey(GlTraceOpEnable, a[0]), GlTraceCommand(op).Int(op == GlTraceOpEnable), 0, false);
+        break;
+    case GlTraceOpEnableVertexAttribArray:
+    case GlTraceOpDisableVertexAttribArray:
+        Set(StateKey(GlTraceOpEnableVertexAttribArray, a[0]),
+            GlTraceCommand(op).Int(op == GlTraceOpEnableVertexAttribArray), 0, false);
+        break;
+    case GlTraceOpPixelStorei:
+        Set(StateKey(op, a[0]), command, 1, false);
+        break;
+    case GlTraceOpTexParameteri: {
+        int64_t texture = Bound(StateKey(GlTraceOpBindTexture, m_activeTexture, a[0]));
+        Set(StateKey(op, texture, a[1]), command, 2, false);
+        break;
+    }
+    case GlTraceOpVertexAttribPointer: {
+        // The pointer is an offset into whatever array buffer is bound.
+        GlTraceCommand pointer(command);
+        pointer.Int(Bound(StateKey(GlTraceOpBindBuffer, 0x8892)));  // GL_ARRAY_BUFFER
+        Set(StateKey(op, a[0]), pointer, 1, false);
+        break;
+    }
+    case GlTraceOpUniform1f:
+    case GlTraceOpUniform2f:
+    case GlTraceOpUniform3f:
+    case GlTraceOpUniform4f:
+    case GlTraceOpUniform1i:
+    case GlTraceOpUniform1fv:
+    case GlTraceOpUniform2fv:
+    case GlTraceOpUniform3fv:
+    case GlTraceOpUniform4fv:
+    case GlTraceOpUniformMatrix3fv:
+    case GlTraceOpUniformMatrix4fv: {
+        int64_t program = Bound(StateKey(GlTraceOpUseProgram));
+        GlTraceCommand uniform(command);
+        uniform.Ints[0] = op;
+        Set(StateKey(GlTraceOpUniform1f, program, a[0]), uniform, 0, false);
+        break;
+    }
+    case GlTraceOpLinkProgram:
+        Forget(GlTraceOpUniform1f, a[0]);
+        break;
+    case GlTraceOpDeleteBuffer:
+        Forget(GlTraceOpBindBuffer, a[0]);
+        break;
+    case GlTraceOpDeleteFramebuffer:
+        Forget(GlTraceOpBindFramebuffer, a[0]);
+        break;
+    case GlTraceOpDeleteRenderbuffer:
+        Forget(GlTraceOpBindRenderbuffer, a[0]);
+        break;
+    case GlTraceOpDeleteTexture:
+        Forget(GlTraceOpBindTexture, a[0]);
+        break;
+    case GlTraceOpDeleteProgram:
+        Forget(GlTraceOpUseProgram, a[0]);
+        break;
+    case GlTraceOpDrawArrays:
+        ++frame.DrawCalls;
+        frame.Indices += (int) a[2];
+        break;
+    case GlTraceOpDrawElements:
+        ++frame.DrawCalls;
+        frame.Indices += (int) a[1];
+        break;
+    case GlTraceOpBufferData:
+    case GlTraceOpBufferSubData:
+    case GlTraceOpCompressedTexImage2D:
+    case GlTraceOpTexImage2D:
+    case GlTraceOpTexSubImage2D:
+        ++frame.UploadCalls;
+        frame.BytesUploaded += command.PayloadSize;
+        break;
+    default:
+        break;
+    }
+}
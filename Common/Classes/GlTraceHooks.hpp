@@ -0,0 +1,876 @@
+#pragma once
+#include "GlTrace.hpp"
+#include <map>
+#include <string>
+#include <utility>
+
+// The GL side of GlTrace.hpp, for ES 2.0 engines.  Include it after the GL
+// headers and before anything else that makes GL calls.  With
+// ENABLE_GL_TRACE defined, every call that GlTrace.hpp has an op for then
+// goes through a wrapper that makes the call and records it, along with the
+// data it uploads.  Client-side vertex arrays are the exception: their
+// pointers are recorded, but not what they point to.
+//
+// GlTracePlayer is the backend that replays a trace into the current
+// context, mapping recorded names onto the ones that it gets back.
+
+#ifndef GL_ES_VERSION_2_0
+#error "GlTraceHooks.hpp needs the OpenGL ES 2.0 headers."
+#endif
+
+// What the recorder needs to know about the GL state to size payloads.
+struct GlTraceHookState {
+    GlTraceHookState() : UnpackAlignment(4), ElementBuffer(0) {}
+    GLint UnpackAlignment;
+    GLuint ElementBuffer;
+};
+
+inline GlTraceHookState& GetGlTraceHookState()
+{
+    static GlTraceHookState state;
+    return state;
+}
+
+// Bytes that glTexImage2D reads for the given size, format, and type.
+inline int GetGlTraceImageSize(GLsizei width, GLsizei height, GLenum format, GLenum type)
+{
+    if (width <= 0 || height <= 0)
+        return 0;
+    int pixelSize = 2;
+    if (type == GL_UNSIGNED_BYTE) {
+        switch (format) {
+        case GL_ALPHA:
+        case GL_LUMINANCE: pixelSize = 1; break;
+        case GL_LUMINANCE_ALPHA: pixelSize = 2; break;
+        case GL_RGB: pixelSize = 3; break;
+        default: pixelSize = 4; break;
+        }
+    }
+    int alignment = GetGlTraceHookState().UnpackAlignment;
+    int rowSize = width * pixelSize;
+    int stride = (rowSize + alignment - 1) / alignment * alignment;
+    return stride * (height - 1) + rowSize;
+}
+
+inline void GlTraceRecord(const GlTraceCommand& command)
+{
+    GlTraceRecorder::Get().Record(command);
+}
+
+inline void TraceGlActiveTexture(GLenum texture)
+{
+    glActiveTexture(texture);
+    GlTraceRecord(GlTraceCommand(GlTraceOpActiveTexture).Int(texture));
+}
+
+inline void TraceGlAttachShader(GLuint program, GLuint shader)
+{
+    glAttachShader(program, shader);
+    GlTraceRecord(GlTraceCommand(GlTraceOpAttachShader).Int(program).Int(shader));
+}
+
+inline void TraceGlBindAttribLocation(GLuint program, GLuint index, const GLchar* name)
+{
+    glBindAttribLocation(program, index, name);
+    GlTraceRecord(GlTraceCommand(GlTraceOpBindAttribLocation).Int(program).Int(index)
+                  .Data(name, (int) strlen(name)));
+}
+
+inline void TraceGlBindBuffer(GLenum target, GLuint buffer)
+{
+    glBindBuffer(target, buffer);
+    if (target == GL_ELEMENT_ARRAY_BUFFER)
+        GetGlTraceHookState().ElementBuffer = buffer;
+    GlTraceRecord(GlTraceCommand(GlTraceOpBindBuffer).Int(target).Int(buffer));
+}
+
+inline void TraceGlBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    glBindFramebuffer(target, framebuffer);
+    GlTraceRecord(GlTraceCommand(GlTraceOpBindFramebuffer).Int(target).Int(framebuffer));
+}
+
+inline void TraceGlBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+    glBindRenderbuffer(target, renderbuffer);
+    GlTraceRecord(GlTraceCommand(GlTraceOpBindRenderbuffer).Int(target).Int(renderbuffer));
+}
+
+inline void TraceGlBindTexture(GLenum target, GLuint texture)
+{
+    glBindTexture(target, texture);
+    GlTraceRecord(GlTraceCommand(GlTraceOpBindTexture).Int(target).Int(texture));
+}
+
+inline void TraceGlBlendFunc(GLenum source, GLenum destination)
+{
+    glBlendFunc(source, destination);
+    GlTraceRecord(GlTraceCommand(GlTraceOpBlendFunc).Int(source).Int(destination));
+}
+
+inline void TraceGlBufferData(GLenum target, GLsizeiptr size, const GLvoid* data, GLenum usage)
+{
+    glBufferData(target, size, data, usage);
+    GlTraceRecord(GlTraceCommand(GlTraceOpBufferData).Int(target).Int(size).Int(usage)
+                  .Data(data, (int) size));
+}
+
+inline void TraceGlBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid* data)
+{
+    glBufferSubData(target, offset, size, data);
+    GlTraceRecord(GlTraceCommand(GlTraceOpBufferSubData).Int(target).Int(offset)
+                  .Data(data, (int) size));
+}
+
+inline void TraceGlClear(GLbitfield mask)
+{
+    glClear(mask);
+    GlTraceRecord(GlTraceCommand(GlTraceOpClear).Int(mask));
+}
+
+inline void TraceGlClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    glClearColor(red, green, blue, alpha);
+    GlTraceRecord(GlTraceCommand(GlTraceOpClearColor).Float(red).Float(green).Float(blue)
+                  .Float(alpha));
+}
+
+inline void TraceGlClearDepthf(GLfloat depth)
+{
+    glClearDepthf(depth);
+    GlTraceRecord(GlTraceCommand(GlTraceOpClearDepthf).Float(depth));
+}
+
+inline void TraceGlColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    glColorMask(red, green, blue, alpha);
+    GlTraceRecord(GlTraceCommand(GlTraceOpColorMask).Int(red).Int(green).Int(blue).Int(alpha));
+}
+
+inline void TraceGlCompileShader(GLuint shader)
+{
+    glCompileShader(shader);
+    GlTraceRecord(GlTraceCommand(GlTraceOpCompileShader).Int(shader));
+}
+
+inline void TraceGlCompressedTexImage2D(GLenum target, GLint level, GLenum format,
+                                        GLsizei width, GLsizei height, GLint border,
+                                        GLsizei size, const GLvoid* data)
+{
+    glCompressedTexImage2D(target, level, format, width, height, border, size, data);
+    GlTraceRecord(GlTraceCommand(GlTraceOpCompressedTexImage2D).Int(target).Int(level)
+                  .Int(format).Int(width).Int(height).Int(border).Data(data, size));
+}
+
+inline GLuint TraceGlCreateProgram()
+{
+    GLuint program = glCreateProgram();
+    GlTraceRecord(GlTraceCommand(GlTraceOpCreateProgram).Int(program));
+    return program;
+}
+
+inline GLuint TraceGlCreateShader(GLenum type)
+{
+    GLuint shader = glCreateShader(type);
+    GlTraceRecord(GlTraceCommand(GlTraceOpCreateShader).Int(type).Int(shader));
+    return shader;
+}
+
+inline void TraceGlCullFace(GLenum mode)
+{
+    glCullFace(mode);
+    GlTraceRecord(GlTraceCommand(GlTraceOpCullFace).Int(mode));
+}
+
+inline void TraceGlDeleteBuffers(GLsizei count, const GLuint* buffers)
+{
+    glDeleteBuffers(count, buffers);
+    for (GLsizei i = 0; i < count; ++i)
+        GlTraceRecord(GlTraceCommand(GlTraceOpDeleteBuffer).Int(buffers[i]));
+}
+
+inline void TraceGlDeleteFramebuffers(GLsizei count, const GLuint* framebuffers)
+{
+    glDeleteFramebuffers(count, framebuffers);
+    for (GLsizei i = 0; i < count; ++i)
+        GlTraceRecord(GlTraceCommand(GlTraceOpDeleteFramebuffer).Int(framebuffers[i]));
+}
+
+inline void TraceGlDeleteProgram(GLuint program)
+{
+    glDeleteProgram(program);
+    GlTraceRecord(GlTraceCommand(GlTraceOpDeleteProgram).Int(program));
+}
+
+inline void TraceGlDeleteRenderbuffers(GLsizei count, const GLuint* renderbuffers)
+{
+    glDeleteRenderbuffers(count, renderbuffers);
+    for (GLsizei i = 0; i < count; ++i)
+        GlTraceRecord(GlTraceCommand(GlTraceOpDeleteRenderbuffer).Int(renderbuffers[i]));
+}
+
+inline void TraceGlDeleteShader(GLuint shader)
+{
+    glDeleteShader(shader);
+    GlTraceRecord(GlTraceCommand(GlTraceOpDeleteShader).Int(shader));
+}
+
+inline void TraceGlDeleteTextures(GLsizei count, const GLuint* textures)
+{
+    glDeleteTextures(count, textures);
+    for (GLsizei i = 0; i < count; ++i)
+        GlTraceRecord(GlTraceCommand(GlTraceOpDeleteTexture).Int(textures[i]));
+}
+
+inline void TraceGlDepthFunc(GLenum func)
+{
+    glDepthFunc(func);
+    GlTraceRecord(GlTraceCommand(GlTraceOpDepthFunc).Int(func));
+}
+
+inline void TraceGlDepthMask(GLboolean flag)
+{
+    glDepthMask(flag);
+    GlTraceRecord(GlTraceCommand(GlTraceOpDepthMask).Int(flag));
+}
+
+inline void TraceGlDisable(GLenum cap)
+{
+    glDisable(cap);
+    GlTraceRecord(GlTraceCommand(GlTraceOpDisable).Int(cap));
+}
+
+inline void TraceGlDisableVertexAttribArray(GLuint index)
+{
+    glDisableVertexAttribArray(index);
+    GlTraceRecord(GlTraceCommand(GlTraceOpDisableVertexAttribArray).Int(index));
+}
+
+inline void TraceGlDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    glDrawArrays(mode, first, count);
+    GlTraceRecord(GlTraceCommand(GlTraceOpDrawArrays).Int(mode).Int(first).Int(count));
+}
+
+// Indices in client memory go into the trace; otherwise the pointer is an
+// offset into the element buffer.
+inline void TraceGlDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices)
+{
+    glDrawElements(mode, count, type, indices);
+    GlTraceCommand command(GlTraceOpDrawElements);
+    command.Int(mode).Int(count).Int(type);
+    if (GetGlTraceHookState().ElementBuffer)
+        command.Int((int64_t) (intptr_t) indices);
+    else
+        command.Int(0).Data(indices, count * (type == GL_UNSIGNED_BYTE ? 1 : 2));
+    GlTraceRecord(command);
+}
+
+inline void TraceGlEnable(GLenum cap)
+{
+    glEnable(cap);
+    GlTraceRecord(GlTraceCommand(GlTraceOpEnable).Int(cap));
+}
+
+inline void TraceGlEnableVertexAttribArray(GLuint index)
+{
+    glEnableVertexAttribArray(index);
+    GlTraceRecord(GlTraceCommand(GlTraceOpEnableVertexAttribArray).Int(index));
+}
+
+inline void TraceGlFramebufferRenderbuffer(GLenum target, GLenum attachment,
+                                           GLenum renderbufferTarget, GLuint renderbuffer)
+{
+    glFramebufferRenderbuffer(target, attachment, renderbufferTarget, renderbuffer);
+    GlTraceRecord(GlTraceCommand(GlTraceOpFramebufferRenderbuffer).Int(target).Int(attachment)
+                  .Int(renderbufferTarget).Int(renderbuffer));
+}
+
+inline void TraceGlFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textureTarget,
+                                        GLuint texture, GLint level)
+{
+    glFramebufferTexture2D(target, attachment, textureTarget, texture, level);
+    GlTraceRecord(GlTraceCommand(GlTraceOpFramebufferTexture2D).Int(target).Int(attachment)
+                  .Int(textureTarget).Int(texture).Int(level));
+}
+
+inline void TraceGlFrontFace(GLenum mode)
+{
+    glFrontFace(mode);
+    GlTraceRecord(GlTraceCommand(GlTraceOpFrontFace).Int(mode));
+}
+
+inline void TraceGlGenBuffers(GLsizei count, GLuint* buffers)
+{
+    glGenBuffers(count, buffers);
+    for (GLsizei i = 0; i < count; ++i)
+        GlTraceRecord(GlTraceCommand(GlTraceOpGenBuffer).Int(buffers[i]));
+}
+
+inline void TraceGlGenFramebuffers(GLsizei count, GLuint* framebuffers)
+{
+    glGenFramebuffers(count, framebuffers);
+    for (GLsizei i = 0; i < count; ++i)
+        GlTraceRecord(GlTraceCommand(GlTraceOpGenFramebuffer).Int(framebuffers[i]));
+}
+
+inline void TraceGlGenRenderbuffers(GLsizei count, GLuint* renderbuffers)
+{
+    glGenRenderbuffers(count, renderbuffers);
+    for (GLsizei i = 0; i < count; ++i)
+        GlTraceRecord(GlTraceCommand(GlTraceOpGenRenderbuffer).Int(renderbuffers[i]));
+}
+
+inline void TraceGlGenTextures(GLsizei count, GLuint* textures)
+{
+    glGenTextures(count, textures);
+    for (GLsizei i = 0; i < count; ++i)
+        GlTraceRecord(GlTraceCommand(GlTraceOpGenTexture).Int(textures[i]));
+}
+
+inline void TraceGlGenerateMipmap(GLenum target)
+{
+    glGenerateMipmap(target);
+    GlTraceRecord(GlTraceCommand(GlTraceOpGenerateMipmap).Int(target));
+}
+
+inline GLint TraceGlGetAttribLocation(GLuint program, const GLchar* name)
+{
+    GLint location = glGetAttribLocation(program, name);
+    GlTraceRecord(GlTraceCommand(GlTraceOpGetAttribLocation).Int(program).Int(location)
+                  .Data(name, (int) strlen(name)));
+    return location;
+}
+
+inline GLint TraceGlGetUniformLocation(GLuint program, const GLchar* name)
+{
+    GLint location = glGetUniformLocation(program, name);
+    GlTraceRecord(GlTraceCommand(GlTraceOpGetUniformLocation).Int(program).Int(location)
+                  .Data(name, (int) strlen(name)));
+    return location;
+}
+
+inline void TraceGlLineWidth(GLfloat width)
+{
+    glLineWidth(width);
+    GlTraceRecord(GlTraceCommand(GlTraceOpLineWidth).Float(width));
+}
+
+inline void TraceGlLinkProgram(GLuint program)
+{
+    glLinkProgram(program);
+    GlTraceRecord(GlTraceCommand(GlTraceOpLinkProgram).Int(program));
+}
+
+inline void TraceGlPixelStorei(GLenum name, GLint param)
+{
+    glPixelStorei(name, param);
+    if (name == GL_UNPACK_ALIGNMENT)
+        GetGlTraceHookState().UnpackAlignment = param;
+    GlTraceRecord(GlTraceCommand(GlTraceOpPixelStorei).Int(name).Int(param));
+}
+
+inline void TraceGlRenderbufferStorage(GLenum target, GLenum format, GLsizei width, GLsizei height)
+{
+    glRenderbufferStorage(target, format, width, height);
+    GlTraceRecord(GlTraceCommand(GlTraceOpRenderbufferStorage).Int(target).Int(format)
+                  .Int(width).Int(height));
+}
+
+inline void TraceGlScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    glScissor(x, y, width, height);
+    GlTraceRecord(GlTraceCommand(GlTraceOpScissor).Int(x).Int(y).Int(width).Int(height));
+}
+
+// The strings get joined into one payload.
+inline void TraceGlShaderSource(GLuint shader, GLsizei count, const GLchar* const* strings,
+                                const GLint* lengths)
+{
+    glShaderSource(shader, count, (const GLchar**) strings, lengths);
+    std::string source;
+    for (GLsizei i = 0; i < count; ++i) {
+        if (lengths && lengths[i] >= 0)
+            source.append(strings[i], lengths[i]);
+        else
+            source.append(strings[i]);
+    }
+    GlTraceRecord(GlTraceCommand(GlTraceOpShaderSource).Int(shader)
+                  .Data(source.c_str(), (int) source.size()));
+}
+
+inline void TraceGlTexImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width,
+                              GLsizei height, GLint border, GLenum format, GLenum type,
+                              const GLvoid* pixels)
+{
+    glTexImage2D(target, level, internalFormat, width, height, border, format, type, pixels);
+    GlTraceRecord(GlTraceCommand(GlTraceOpTexImage2D).Int(target).Int(level).Int(internalFormat)
+                  .Int(width).Int(height).Int(border).Int(format).Int(type)
+                  .Data(pixels, GetGlTraceImageSize(width, height, format, type)));
+}
+
+inline void TraceGlTexParameteri(GLenum target, GLenum name, GLint param)
+{
+    glTexParameteri(target, name, param);
+    GlTraceRecord(GlTraceCommand(GlTraceOpTexParameteri).Int(target).Int(name).Int(param));
+}
+
+inline void TraceGlTexSubImage2D(GLenum target, GLint level, GLint x, GLint y, GLsizei width,
+                                 GLsizei height, GLenum format, GLenum type, const GLvoid* pixels)
+{
+    glTexSubImage2D(target, level, x, y, width, height, format, type, pixels);
+    GlTraceRecord(GlTraceCommand(GlTraceOpTexSubImage2D).Int(target).Int(level).Int(x).Int(y)
+                  .Int(width).Int(height).Int(format).Int(type)
+                  .Data(pixels, GetGlTraceImageSize(width, height, format, type)));
+}
+
+inline void TraceGlUniform1f(GLint location, GLfloat x)
+{
+    glUniform1f(location, x);
+    GlTraceRecord(GlTraceCommand(GlTraceOpUniform1f).Int(location).Float(x));
+}
+
+inline void TraceGlUniform2f(GLint location, GLfloat x, GLfloat y)
+{
+    glUniform2f(location, x, y);
+    GlTraceRecord(GlTraceCommand(GlTraceOpUniform2f).Int(location).Float(x).Float(y));
+}
+
+inline void TraceGlUniform3f(GLint location, GLfloat x, GLfloat y, GLfloat z)
+{
+    glUniform3f(location, x, y, z);
+    GlTraceRecord(GlTraceCommand(GlTraceOpUniform3f).Int(location).Float(x).Float(y).Float(z));
+}
+
+inline void TraceGlUniform4f(GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    glUniform4f(location, x, y, z, w);
+    GlTraceRecord(GlTraceCommand(GlTraceOpUniform4f).Int(location).Float(x).Float(y).Float(z)
+                  .Float(w));
+}
+
+inline void TraceGlUniform1i(GLint location, GLint x)
+{
+    glUniform1i(location, x);
+    GlTraceRecord(GlTraceCommand(GlTraceOpUniform1i).Int(location).Int(x));
+}
+
+inline void TraceGlUniformfv(GlTraceOp op, GLint location, GLsizei count, int size,
+                             const GLfloat* values)
+{
+    GlTraceRecord(GlTraceCommand(op).Int(location).Int(count)
+                  .Data(values, count * size * (int) sizeof(GLfloat)));
+}
+
+inline void TraceGlUniform1fv(GLint location, GLsizei count, const GLfloat* values)
+{
+    glUniform1fv(location, count, values);
+    TraceGlUniformfv(GlTraceOpUniform1fv, location, count, 1, values);
+}
+
+inline void TraceGlUniform2fv(GLint location, GLsizei count, const GLfloat* values)
+{
+    glUniform2fv(location, count, values);
+    TraceGlUniformfv(GlTraceOpUniform2fv, location, count, 2, values);
+}
+
+inline void TraceGlUniform3fv(GLint location, GLsizei count, const GLfloat* values)
+{
+    glUniform3fv(location, count, values);
+    TraceGlUniformfv(GlTraceOpUniform3fv, location, count, 3, values);
+}
+
+inline void TraceGlUniform4fv(GLint location, GLsizei count, const GLfloat* values)
+{
+    glUniform4fv(location, count, values);
+    TraceGlUniformfv(GlTraceOpUniform4fv, location, count, 4, values);
+}
+
+inline void TraceGlUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose,
+                                    const GLfloat* values)
+{
+    glUniformMatrix3fv(location, count, transpose, values);
+    GlTraceRecord(GlTraceCommand(GlTraceOpUniformMatrix3fv).Int(location).Int(count)
+                  .Int(transpose).Data(values, count * 9 * (int) sizeof(GLfloat)));
+}
+
+inline void TraceGlUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose,
+                                    const GLfloat* values)
+{
+    glUniformMatrix4fv(location, count, transpose, values);
+    GlTraceRecord(GlTraceCommand(GlTraceOpUniformMatrix4fv).Int(location).Int(count)
+                  .Int(transpose).Data(values, count * 16 * (int) sizeof(GLfloat)));
+}
+
+inline void TraceGlUseProgram(GLuint program)
+{
+    glUseProgram(program);
+    GlTraceRecord(GlTraceCommand(GlTraceOpUseProgram).Int(program));
+}
+
+inline void TraceGlVertexAttribPointer(GLuint index, GLint size, GLenum type,
+                                       GLboolean normalized, GLsizei stride, const GLvoid* pointer)
+{
+    glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+    GlTraceRecord(GlTraceCommand(GlTraceOpVertexAttribPointer).Int(index).Int(size).Int(type)
+                  .Int(normalized).Int(stride).Int((int64_t) (intptr_t) pointer));
+}
+
+inline void TraceGlViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    glViewport(x, y, width, height);
+    GlTraceRecord(GlTraceCommand(GlTraceOpViewport).Int(x).Int(y).Int(width).Int(height));
+}
+
+// Replays into the current context.  Objects are created afresh and
+// recorded names are mapped onto the new ones; names the trace never
+// created, such as a renderbuffer whose storage came from the window
+// system, pass through unchanged.  Vertex pointers into client memory
+// can't be replayed, so they're skipped and counted.
+class GlTracePlayer : public IGlTraceBackend {
+public:
+    GlTracePlayer() : m_program(0), m_arrayBuffer(0), m_elementBuffer(0), m_skipped(0) {}
+    void Execute(const GlTraceCommand& command);
+    int GetSkippedCount() const { return m_skipped; }
+private:
+    enum NameKind {
+        NameKindBuffer,
+        NameKindFramebuffer,
+        NameKindRenderbuffer,
+        NameKindTexture,
+        NameKindProgram,    // shaders and programs share their names
+        NameKindCount,
+    };
+    GLuint Name(NameKind kind, int64_t recorded) const
+    {
+        std::map<int64_t, GLuint>::const_iterator i = m_names[kind].find(recorded);
+        return i == m_names[kind].end() ? (GLuint) recorded : i->second;
+    }
+    GLint Uniform(int64_t recorded) const
+    {
+        std::map<std::pair<GLuint, int64_t>, GLint>::const_iterator i =
+            m_uniforms.find(std::make_pair(m_program, recorded));
+        return i == m_uniforms.end() ? (GLint) recorded : i->second;
+    }
+    GLuint Attribute(int64_t recorded) const
+    {
+        std::map<int64_t, GLuint>::const_iterator i = m_attributes.find(recorded);
+        return i == m_attributes.end() ? (GLuint) recorded : i->second;
+    }
+    std::map<int64_t, GLuint> m_names[NameKindCount];
+    std::map<std::pair<GLuint, int64_t>, GLint> m_uniforms;
+    std::map<int64_t, GLuint> m_attributes;
+    GLuint m_program;
+    GLuint m_arrayBuffer;
+    GLuint m_elementBuffer;
+    int m_skipped;
+};
+
+inline void GlTracePlayer::Execute(const GlTraceCommand& c)
+{
+    const int64_t* a = c.Ints;
+    const GLfloat* f = c.Floats;
+    const GLfloat* values = (const GLfloat*) c.Payload;
+    std::string text((const char*) c.Payload, c.PayloadSize);
+    GLuint name;
+
+    switch (c.Op) {
+    case GlTraceOpActiveTexture:
+        glActiveTexture(a[0]);
+        break;
+    case GlTraceOpAttachShader:
+        glAttachShader(Name(NameKindProgram, a[0]), Name(NameKindProgram, a[1]));
+        break;
+    case GlTraceOpBindAttribLocation:
+        glBindAttribLocation(Name(NameKindProgram, a[0]), a[1], text.c_str());
+        break;
+    case GlTraceOpBindBuffer:
+        name = Name(NameKindBuffer, a[1]);
+        glBindBuffer(a[0], name);
+        if (a[0] == GL_ARRAY_BUFFER)
+            m_arrayBuffer = name;
+        else if (a[0] == GL_ELEMENT_ARRAY_BUFFER)
+            m_elementBuffer = name;
+        break;
+    case GlTraceOpBindFramebuffer:
+        glBindFramebuffer(a[0], Name(NameKindFramebuffer, a[1]));
+        break;
+    case GlTraceOpBindRenderbuffer:
+        glBindRenderbuffer(a[0], Name(NameKindRenderbuffer, a[1]));
+        break;
+    case GlTraceOpBindTexture:
+        glBindTexture(a[0], Name(NameKindTexture, a[1]));
+        break;
+    case GlTraceOpBlendFunc:
+        glBlendFunc(a[0], a[1]);
+        break;
+    case GlTraceOpBufferData:
+        glBufferData(a[0], a[1], c.Payload, a[2]);
+        break;
+    case GlTraceOpBufferSubData:
+        glBufferSubData(a[0], a[1], c.PayloadSize, c.Payload);
+        break;
+    case GlTraceOpClear:
+        glClear(a[0]);
+        break;
+    case GlTraceOpClearColor:
+        glClearColor(f[0], f[1], f[2], f[3]);
+        break;
+    case GlTraceOpClearDepthf:
+        glClearDepthf(f[0]);
+        break;
+    case GlTraceOpColorMask:
+        glColorMask(a[0], a[1], a[2], a[3]);
+        break;
+    case GlTraceOpCompileShader:
+        glCompileShader(Name(NameKindProgram, a[0]));
+        break;
+    case GlTraceOpCompressedTexImage2D:
+        glCompressedTexImage2D(a[0], a[1], a[2], a[3], a[4], a[5], c.PayloadSize, c.Payload);
+        break;
+    case GlTraceOpCreateProgram:
+        m_names[NameKindProgram][a[0]] = glCreateProgram();
+        break;
+    case GlTraceOpCreateShader:
+        m_names[NameKindProgram][a[1]] = glCreateShader(a[0]);
+        break;
+    case GlTraceOpCullFace:
+        glCullFace(a[0]);
+        break;
+    case GlTraceOpDeleteBuffer:
+        name = Name(NameKindBuffer, a[0]);
+        glDeleteBuffers(1, &name);
+        break;
+    case GlTraceOpDeleteFramebuffer:
+        name = Name(NameKindFramebuffer, a[0]);
+        glDeleteFramebuffers(1, &name);
+        break;
+    case GlTraceOpDeleteProgram:
+        glDeleteProgram(Name(NameKindProgram, a[0]));
+        break;
+    case GlTraceOpDeleteRenderbuffer:
+        name = Name(NameKindRenderbuffer, a[0]);
+        glDeleteRenderbuffers(1, &name);
+        break;
+    case GlTraceOpDeleteShader:
+        glDeleteShader(Name(NameKindProgram, a[0]));
+        break;
+    case GlTraceOpDeleteTexture:
+        name = Name(NameKindTexture, a[0]);
+        glDeleteTextures(1, &name);
+        break;
+    case GlTraceOpDepthFunc:
+        glDepthFunc(a[0]);
+        break;
+    case GlTraceOpDepthMask:
+        glDepthMask(a[0]);
+        break;
+    case GlTraceOpDisable:
+        glDisable(a[0]);
+        break;
+    case GlTraceOpDisableVertexAttribArray:
+        glDisableVertexAttribArray(Attribute(a[0]));
+        break;
+    case GlTraceOpDrawArrays:
+        glDrawArrays(a[0], a[1], a[2]);
+        break;
+    case GlTraceOpDrawElements:
+        if (c.Payload || m_elementBuffer)
+            glDrawElements(a[0], a[1], a[2], c.Payload ? c.Payload : (const GLvoid*) (intptr_t) a[3]);
+        else
+            ++m_skipped;
+        break;
+    case GlTraceOpEnable:
+        glEnable(a[0]);
+        break;
+    case GlTraceOpEnableVertexAttribArray:
+        glEnableVertexAttribArray(Attribute(a[0]));
+        break;
+    case GlTraceOpFramebufferRenderbuffer:
+        glFramebufferRenderbuffer(a[0], a[1], a[2], Name(NameKindRenderbuffer, a[3]));
+        break;
+    case GlTraceOpFramebufferTexture2D:
+        glFramebufferTexture2D(a[0], a[1], a[2], Name(NameKindTexture, a[3]), a[4]);
+        break;
+    case GlTraceOpFrontFace:
+        glFrontFace(a[0]);
+        break;
+    case GlTraceOpGenBuffer:
+        glGenBuffers(1, &name);
+        m_names[NameKindBuffer][a[0]] = name;
+        break;
+    case GlTraceOpGenFramebuffer:
+        glGenFramebuffers(1, &name);
+        m_names[NameKindFramebuffer][a[0]] = name;
+        break;
+    case GlTraceOpGenRenderbuffer:
+        glGenRenderbuffers(1, &name);
+        m_names[NameKindRenderbuffer][a[0]] = name;
+        break;
+    case GlTraceOpGenTexture:
+        glGenTextures(1, &name);
+        m_names[NameKindTexture][a[0]] = name;
+        break;
+    case GlTraceOpGenerateMipmap:
+        glGenerateMipmap(a[0]);
+        break;
+    case GlTraceOpGetAttribLocation: {
+        GLint location = glGetAttribLocation(Name(NameKindProgram, a[0]), text.c_str());
+        if (location >= 0)
+            m_attributes[a[1]] = location;
+        break;
+    }
+    case GlTraceOpGetUniformLocation: {
+        name = Name(NameKindProgram, a[0]);
+        m_uniforms[std::make_pair(name, a[1])] = glGetUniformLocation(name, text.c_str());
+        break;
+    }
+    case GlTraceOpLineWidth:
+        glLineWidth(f[0]);
+        break;
+    case GlTraceOpLinkProgram:
+        glLinkProgram(Name(NameKindProgram, a[0]));
+        break;
+    case GlTraceOpPixelStorei:
+        glPixelStorei(a[0], a[1]);
+        break;
+    case GlTraceOpRenderbufferStorage:
+        glRenderbufferStorage(a[0], a[1], a[2], a[3]);
+        break;
+    case GlTraceOpScissor:
+        glScissor(a[0], a[1], a[2], a[3]);
+        break;
+    case GlTraceOpShaderSource: {
+        const GLchar* source = text.c_str();
+        glShaderSource(Name(NameKindProgram, a[0]), 1, &source, 0);
+        break;
+    }
+    case GlTraceOpTexImage2D:
+        glTexImage2D(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], c.Payload);
+        break;
+    case GlTraceOpTexParameteri:
+        glTexParameteri(a[0], a[1], a[2]);
+        break;
+    case GlTraceOpTexSubImage2D:
+        glTexSubImage2D(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], c.Payload);
+        break;
+    case GlTraceOpUniform1f:
+        glUniform1f(Uniform(a[0]), f[0]);
+        break;
+    case GlTraceOpUniform2f:
+        glUniform2f(Uniform(a[0]), f[0], f[1]);
+        break;
+    case GlTraceOpUniform3f:
+        glUniform3f(Uniform(a[0]), f[0], f[1], f[2]);
+        break;
+    case GlTraceOpUniform4f:
+        glUniform4f(Uniform(a[0]), f[0], f[1], f[2], f[3]);
+        break;
+    case GlTraceOpUniform1i:
+        glUniform1i(Uniform(a[0]), a[1]);
+        break;
+    case GlTraceOpUniform1fv:
+        glUniform1fv(Uniform(a[0]), a[1], values);
+        break;
+    case GlTraceOpUniform2fv:
+        glUniform2fv(Uniform(a[0]), a[1], values);
+        break;
+    case GlTraceOpUniform3fv:
+        glUniform3fv(Uniform(a[0]), a[1], values);
+        break;
+    case GlTraceOpUniform4fv:
+        glUniform4fv(Uniform(a[0]), a[1], values);
+        break;
+    case GlTraceOpUniformMatrix3fv:
+        glUniformMatrix3fv(Uniform(a[0]), a[1], a[2], values);
+        break;
+    case GlTraceOpUniformMatrix4fv:
+        glUniformMatrix4fv(Uniform(a[0]), a[1], a[2], values);
+        break;
+    case GlTraceOpUseProgram:
+        m_program = Name(NameKindProgram, a[0]);
+        glUseProgram(m_program);
+        break;
+    case GlTraceOpVertexAttribPointer:
+        if (m_arrayBuffer)
+            glVertexAttribPointer(Attribute(a[0]), a[1], a[2], a[3], a[4],
+                                  (const GLvoid*) (intptr_t) a[5]);
+        else
+            ++m_skipped;
+        break;
+    case GlTraceOpViewport:
+        glViewport(a[0], a[1], a[2], a[3]);
+        break;
+    default:
+        break;
+    }
+}
+
+#ifdef ENABLE_GL_TRACE
+#define glActiveTexture TraceGlActiveTexture
+#define glAttachShader TraceGlAttachShader
+#define glBindAttribLocation TraceGlBindAttribLocation
+#define glBindBuffer TraceGlBindBuffer
+#define glBindFramebuffer TraceGlBindFramebuffer
+#define glBindRenderbuffer TraceGlBindRenderbuffer
+#define glBindTexture TraceGlBindTexture
+#define glBlendFunc TraceGlBlendFunc
+#define glBufferData TraceGlBufferData
+#define glBufferSubData TraceGlBufferSubData
+#define glClear TraceGlClear
+#define glClearColor TraceGlClearColor
+#define glClearDepthf TraceGlClearDepthf
+#define glColorMask TraceGlColorMask
+#define glCompileShader TraceGlCompileShader
+#define glCompressedTexImage2D TraceGlCompressedTexImage2D
+#define glCreateProgram TraceGlCreateProgram
+#define glCreateShader TraceGlCreateShader
+#define glCullFace TraceGlCullFace
+#define glDeleteBuffers TraceGlDeleteBuffers
+#define glDeleteFramebuffers TraceGlDeleteFramebuffers
+#define glDeleteProgram TraceGlDeleteProgram
+#define glDeleteRenderbuffers TraceGlDeleteRenderbuffers
+#define glDeleteShader TraceGlDeleteShader
+#define glDeleteTextures TraceGlDeleteTextures
+#define glDepthFunc TraceGlDepthFunc
+#define glDepthMask TraceGlDepthMask
+#define glDisable TraceGlDisable
+#define glDisableVertexAttribArray TraceGlDisableVertexAttribArray
+#define glDrawArrays TraceGlDrawArrays
+#define glDrawElements TraceGlDrawElements
+#define glEnable TraceGlEnable
+#define glEnableVertexAttribArray TraceGlEnableVertexAttribArray
+#define glFramebufferRenderbuffer TraceGlFramebufferRenderbuffer
+#define glFramebufferTexture2D TraceGlFramebufferTexture2D
+#define glFrontFace TraceGlFrontFace
+#define glGenBuffers TraceGlGenBuffers
+#define glGenFramebuffers TraceGlGenFramebuffers
+#define glGenRenderbuffers TraceGlGenRenderbuffers
+#define glGenTextures TraceGlGenTextures
+#define glGenerateMipmap TraceGlGenerateMipmap
+#define glGetAttribLocation TraceGlGetAttribLocation
+#define glGetUniformLocation TraceGlGetUniformLocation
+#define glLineWidth TraceGlLineWidth
+#define glLinkProgram TraceGlLinkProgram
+#define glPixelStorei TraceGlPixelStorei
+#define glRenderbufferStorage TraceGlRenderbufferStorage
+#define glScissor TraceGlScissor
+#define glShaderSource TraceGlShaderSource
+#define glTexImage2D TraceGlTexImage2D
+#define glTexParameteri TraceGlTexParameteri
+#define glTexSubImage2D TraceGlTexSubImage2D
+#define glUniform1f TraceGlUniform1f
+#define glUniform2f TraceGlUniform2f
+#define glUniform3f TraceGlUniform3f
+#define glUniform4f TraceGlUniform4f
+#define glUniform1i TraceGlUniform1i
+#define glUniform1fv TraceGlUniform1fv
+#define glUniform2fv TraceGlUniform2fv
+#define glUniform3fv TraceGlUniform3fv
+#define glUniform4fv TraceGlUniform4fv
+#define glUniformMatrix3fv TraceGlUniformMatrix3fv
+#define glUniformMatrix4fv TraceGlUniformMatrix4fv
+#define glUseProgram TraceGlUseProgram
+#define glVertexAttribPointer TraceGlVertexAttribPointer
+#define glViewport TraceGlViewport
+#endif
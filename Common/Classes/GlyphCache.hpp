@@ -0,0 +1,425 @@
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <vector>
+
+// On-demand glyph atlas for the text renderers.  A glyph is rasterized the
+// first time it's looked up and packed onto a shelf in an 8-bit coverage
+// atlas; once the atlas fills up, the least recently used glyphs make room
+// for new ones.  Nothing here touches OpenGL: the renderer uploads the rows
+// reported by GetDirtyRows, so rasterization, caching, and layout
+// (TextLayout.hpp) can all be run and timed headless.
+
+struct GlyphMetrics {
+    int XBearing;   // from the pen to the left edge of the bitmap
+    int YBearing;   // from the baseline to the top edge, negative above it
+    int Width;
+    int Height;
+    int XAdvance;
+};
+
+struct GlyphBitmap {
+    GlyphMetrics Metrics;
+    std::vector<unsigned char> Texels;  // Width x Height, top row first
+};
+
+struct IGlyphRasterizer {
+    virtual bool Rasterize(unsigned int codepoint, GlyphBitmap& bitmap) = 0;
+    virtual int GetLineHeight() const = 0;
+    virtual int GetKerning(unsigned int, unsigned int) const { return 0; }
+    virtual ~IGlyphRasterizer() {}
+};
+
+struct CachedGlyph {
+    unsigned int Codepoint;
+    GlyphMetrics Metrics;
+    int X;  // top-left corner of the bitmap in the atlas
+    int Y;
+};
+
+struct GlyphCacheStats {
+    GlyphCacheStats() : Hits(0), Misses(0), Evictions(0), Failures(0) {}
+    float GetHitRate() const
+    {
+        int lookups = Hits + Misses;
+        return lookups ? (float) Hits / lookups : 0;
+    }
+    int Hits;
+    int Misses;
+    int Evictions;
+    int Failures;   // glyphs that didn't fit beside the ones in use this frame
+};
+
+class GlyphCache {
+public:
+    GlyphCache(IGlyphRasterizer* rasterizer, int width, int height, int padding = 1);
+    void BeginFrame();
+    const CachedGlyph* Lookup(unsigned int codepoint);
+    int GetWidth() const { return m_width; }
+    int GetHeight() const { return m_height; }
+    int GetLineHeight() const { return m_rasterizer->GetLineHeight(); }
+    int GetKerning(unsigned int left, unsigned int right);
+    int GetGlyphCount() const { return (int) m_index.size(); }
+    int GetGeneration() const { return m_generation; }
+    const unsigned char* GetTexels() const { return &m_texels[0]; }
+    bool GetDirtyRows(int* first, int* count) const;
+    void ClearDirtyRows();
+    const GlyphCacheStats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = GlyphCacheStats(); }
+private:
+    struct Span {
+        int X;
+        int Width;
+    };
+    struct Shelf {
+        int Y;
+        int Height;
+        int GlyphCount;
+        std::vector<Span> Free;
+    };
+    struct Entry {
+        CachedGlyph Glyph;
+        int SlotWidth;
+        int LastFrame;
+        int Previous;
+        int Next;
+    };
+    bool Allocate(int width, int height, int* x, int* y);
+    void Release(int x, int y, int width);
+    Shelf MakeShelf(int y, int height) const;
+    bool EvictLeastRecent();
+    void LinkFront(int entry);
+    void Unlink(int entry);
+    IGlyphRasterizer* m_rasterizer;
+    int m_width;
+    int m_height;
+    int m_padding;
+    int m_top;
+    int m_frame;
+    int m_generation;
+    int m_head;
+    int m_tail;
+    int m_dirtyFirst;
+    int m_dirtyLast;
+    std::vector<unsigned char> m_texels;
+    std::vector<Shelf> m_shelves;
+    std::vector<Entry> m_entries;
+    std::vector<int> m_freeEntries;
+    std::map<unsigned int, int> m_index;
+    std::map<std::pair<unsigned int, unsigned int>, int> m_kerning;
+    GlyphBitmap m_bitmap;
+    GlyphCacheStats m_stats;
+};
+
+// Padding is the number of empty texels kept to the right of and below each
+// glyph, so that filtering never picks up a neighbor.
+inline GlyphCache::GlyphCache(IGlyphRasterizer* rasterizer, int width, int height,
+                              int padding) :
+    m_rasterizer(rasterizer),
+    m_width(width),
+    m_height(height),
+    m_padding(padding),
+    m_top(0),
+    m_frame(0),
+    m_generation(0),
+    m_head(-1),
+    m_tail(-1),
+    m_dirtyFirst(0),
+    m_dirtyLast(height),
+    m_texels(width * height, 0)
+{
+}
+
+// Glyphs looked up since the last call can't be evicted, so everything that
+// gets drawn together stays in the atlas together.
+inline void GlyphCache::BeginFrame()
+{
+    ++m_frame;
+}
+
+// Returns 0 when the glyph can't fit alongside the ones already in use this
+// frame.  The pointer stays valid until the next lookup.
+inline const CachedGlyph* GlyphCache::Lookup(unsigned int codepoint)
+{
+    std::map<unsigned int, int>::iterator found = m_index.find(codepoint);
+    if (found != m_index.end()) {
+        ++m_stats.Hits;
+        int index = found->second;
+        m_entries[index].LastFrame = m_frame;
+        if (index != m_head) {
+            Unlink(index);
+            LinkFront(index);
+        }
+        return &m_entries[index].Glyph;
+    }
+
+    ++m_stats.Misses;
+    GlyphBitmap& bitmap = m_bitmap;
+    bitmap.Texels.clear();
+    if (!m_rasterizer->Rasterize(codepoint, bitmap)) {
+        memset(&bitmap.Metrics, 0, sizeof(bitmap.Metrics));
+        bitmap.Texels.clear();
+    }
+
+    const GlyphMetrics& metrics = bitmap.Metrics;
+    int x = 0, y = 0, slotWidth = 0;
+    if (metrics.Width > 0 && metrics.Height > 0) {
+        slotWidth = metrics.Width + m_padding;
+        int slotHeight = metrics.Height + m_padding;
+        if (slotWidth > m_width || slotHeight > m_height) {
+            ++m_stats.Failures;
+            return 0;
+        }
+        while (!Allocate(slotWidth, slotHeight, &x, &y)) {
+            if (!EvictLeastRecent()) {
+                ++m_stats.Failures;
+                return 0;
+            }
+        }
+
+        // Clear the whole slot, padding included, since an evicted glyph
+        // may have left texels behind.
+        for (int row = 0; row < slotHeight; ++row) {
+            unsigned char* dest = &m_texels[(y + row) * m_width + x];
+            memset(dest, 0, slotWidth);
+            if (row < metrics.Height)
+                memcpy(dest, &bitmap.Texels[row * metrics.Width], metrics.Width);
+        }
+        if (m_dirtyFirst >= m_dirtyLast) {
+            m_dirtyFirst = y;
+            m_dirtyLast = y + slotHeight;
+        } else {
+            m_dirtyFirst = std::min(m_dirtyFirst, y);
+            m_dirtyLast = std::max(m_dirtyLast, y + slotHeight);
+        }
+    }
+
+    int index;
+    if (m_freeEntries.empty()) {
+        index = (int) m_entries.size();
+        m_entries.push_back(Entry());
+    } else {
+        index = m_freeEntries.back();
+        m_freeEntries.pop_back();
+    }
+    Entry& entry = m_entries[index];
+    entry.Glyph.Codepoint = codepoint;
+    entry.Glyph.Metrics = metrics;
+    entry.Glyph.X = x;
+    entry.Glyph.Y = y;
+    entry.SlotWidth = slotWidth;
+    entry.LastFrame = m_frame;
+    LinkFront(index);
+    m_index[codepoint] = index;
+    return &entry.Glyph;
+}
+
+// Kerning doesn't depend on the atlas, so pairs are kept for good.
+inline int GlyphCache::GetKerning(unsigned int left, unsigned int right)
+{
+    std::pair<unsigned int, unsigned int> pair(left, right);
+    std::map<std::pair<unsigned int, unsigned int>, int>::iterator found =
+        m_kerning.find(pair);
+    if (found != m_kerning.end())
+        return found->second;
+    int kerning = m_rasterizer->GetKerning(left, right);
+    m_kerning[pair] = kerning;
+    return kerning;
+}
+
+// Atlas rows that changed since the last ClearDirtyRows, as whole rows
+// because ES1 can't upload part of a row from a wider image.
+inline bool GlyphCache::GetDirtyRows(int* first, int* count) const
+{
+    *first = m_dirtyFirst;
+    *count = m_dirtyLast - m_dirtyFirst;
+    return *count > 0;
+}
+
+inline void GlyphCache::ClearDirtyRows()
+{
+    m_dirtyFirst = m_dirtyLast = 0;
+}
+
+inline GlyphCache::Shelf GlyphCache::MakeShelf(int y, int height) const
+{
+    Shelf shelf;
+    shelf.Y = y;
+    shelf.Height = height;
+    shelf.GlyphCount = 0;
+    Span span = { 0, m_width };
+    shelf.Free.push_back(span);
+    return shelf;
+}
+
+// Picks the shelf that wastes the fewest rows, and only opens a new shelf
+// when none of the existing ones has room.
+inline bool GlyphCache::Allocate(int width, int height, int* x, int* y)
+{
+    int best = -1, bestSpan = 0, bestWaste = 0;
+    for (int i = 0; i < (int) m_shelves.size(); ++i) {
+        const Shelf& shelf = m_shelves[i];
+        int waste = shelf.Height - height;
+        if (waste < 0 || (best >= 0 && waste >= bestWaste))
+            continue;
+
+        // Short glyphs on tall shelves would strand rows; empty shelves
+        // get split instead.
+        if (shelf.GlyphCount && waste > height / 2 + 2)
+            continue;
+        for (int j = 0; j < (int) shelf.Free.size(); ++j) {
+            if (shelf.Free[j].Width >= width) {
+                best = i;
+                bestSpan = j;
+                bestWaste = waste;
+                break;
+            }
+        }
+    }
+
+    if (best < 0) {
+        if (m_top + height > m_height)
+            return false;
+        best = (int) m_shelves.size();
+        bestSpan = 0;
+        m_shelves.push_back(MakeShelf(m_top, height));
+        m_top += height;
+    } else if (!m_shelves[best].GlyphCount && bestWaste > height / 2 + 2) {
+        Shelf remainder = MakeShelf(m_shelves[best].Y + height, bestWaste);
+        m_shelves[best].Height = height;
+        m_shelves.insert(m_shelves.begin() + best + 1, remainder);
+    }
+
+    Shelf& shelf = m_shelves[best];
+    Span& span = shelf.Free[bestSpan];
+    *x = span.X;
+    *y = shelf.Y;
+    span.X += width;
+    span.Width -= width;
+    if (!span.Width)
+        shelf.Free.erase(shelf.Free.begin() + bestSpan);
+    ++shelf.GlyphCount;
+    return true;
+}
+
+// Returns a slot to its shelf.  Shelves that empty out merge with empty
+// neighbors, and the topmost one gives its rows back altogether.
+inline void GlyphCache::Release(int x, int y, int width)
+{
+    int i = 0;
+    while (m_shelves[i].Y != y)
+        ++i;
+    Shelf& shelf = m_shelves[i];
+
+    if (--shelf.GlyphCount == 0) {
+        Span all = { 0, m_width };
+        shelf.Free.assign(1, all);
+        if (i + 1 < (int) m_shelves.size() && !m_shelves[i + 1].GlyphCount) {
+            shelf.Height += m_shelves[i + 1].Height;
+            m_shelves.erase(m_shelves.begin() + i + 1);
+        }
+        if (i > 0 && !m_shelves[i - 1].GlyphCount) {
+            m_shelves[i - 1].Height += m_shelves[i].Height;
+            m_shelves.erase(m_shelves.begin() + i);
+            --i;
+        }
+        if (i + 1 == (int) m_shelves.size()) {
+            m_top = m_shelves[i].Y;
+            m_shelves.pop_back();
+        }
+        return;
+    }
+
+    std::vector<Span>& free = shelf.Free;
+    int j = 0;
+    while (j < (int) free.size() && free[j].X < x)
+        ++j;
+    Span span = { x, width };
+    free.insert(free.begin() + j, span);
+    if (j + 1 < (int) free.size() && free[j].X + free[j].Width == free[j + 1].X) {
+        free[j].Width += free[j + 1].Width;
+        free.erase(free.begin() + j + 1);
+    }
+    if (j > 0 && free[j - 1].X + free[j - 1].Width == free[j].X) {
+        free[j - 1].Width += free[j].Width;
+        free.erase(free.begin() + j);
+    }
+}
+
+inline bool GlyphCache::EvictLeastRecent()
+{
+    // The list is in order of use, so if the tail was used this frame,
+    // everything was.
+    int index = m_tail;
+    if (index < 0 || m_entries[index].LastFrame == m_frame)
+        return false;
+
+    Entry& entry = m_entries[index];
+    if (entry.SlotWidth)
+        Release(entry.Glyph.X, entry.Glyph.Y, entry.SlotWidth);
+    Unlink(index);
+    m_index.erase(entry.Glyph.Codepoint);
+    m_freeEntries.push_back(index);
+    ++m_stats.Evictions;
+    ++m_generation;
+    return true;
+}
+
+inline void GlyphCache::LinkFront(int index)
+{
+    Entry& entry = m_entries[index];
+    entry.Previous = -1;
+    entry.Next = m_head;
+    if (m_head >= 0)
+        m_entries[m_head].Previous = index;
+    else
+        m_tail = index;
+    m_head = index;
+}
+
+inline void GlyphCache::Unlink(int index)
+{
+    Entry& entry = m_entries[index];
+    if (entry.Previous >= 0)
+        m_entries[entry.Previous].Next = entry.Next;
+    else
+        m_head = entry.Next;
+    if (entry.Next >= 0)
+        m_entries[entry.Next].Previous = entry.Previous;
+    else
+        m_tail = entry.Previous;
+}
+
+// Decodes one UTF-8 sequence and steps past it.  Malformed input comes back
+// as U+FFFD one byte at a time.
+inline unsigned int DecodeUtf8(const char*& text)
+{
+    const unsigned char* bytes = (const unsigned char*) text;
+    unsigned int codepoint = bytes[0];
+    if (codepoint < 0x80) {
+        ++text;
+        return codepoint;
+    }
+
+    int length = (codepoint >> 5) == 0x6 ? 2 : (codepoint >> 4) == 0xe ? 3 :
+                 (codepoint >> 3) == 0x1e ? 4 : 0;
+    const unsigned int Smallest[] = { 0, 0, 0x80, 0x800, 0x10000 };
+    if (length) {
+        codepoint &= 0x7f >> length;
+        for (int i = 1; i < length; ++i) {
+            if ((bytes[i] & 0xc0) != 0x80) {
+                length = 0;
+                break;
+            }
+            codepoint = (codepoint << 6) | (bytes[i] & 0x3f);
+        }
+    }
+    if (!length || codepoint < Smallest[length] || codepoint > 0x10ffff ||
+        (codepoint >= 0xd800 && codepoint <= 0xdfff)) {
+        ++text;
+        return 0xfffd;
+    }
+    text += length;
+    return codepoint;
+}
@@ -0,0 +1,154 @@
+#pragma once
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+// Subpixel offsets for supersampling by jittering the projection, at any
+// sample count, and a controller that picks the count from a frame-time
+// budget.  Offsets are in [0, 1) across a pixel, like the tables they
+// replace.
+//
+// All three patterns are progressive: the first n offsets of a longer
+// pattern are themselves well spread, so a renderer can stop early, or
+// keep going, without regenerating anything.
+//
+//   - Halton uses the radical inverses in bases 2 and 3.
+//   - R2 steps by the reciprocal powers of the plastic number from the
+//     pixel's center, and has the most even gaps of any additive
+//     recurrence.
+//   - Blue noise picks each offset as the best of many random candidates,
+//     the one furthest from what's there, with distances wrapping across
+//     the pixel's edges since the pattern repeats over every pixel.
+
+enum JitterPatternKind {
+    JitterPatternHalton,
+    JitterPatternR2,
+    JitterPatternBlueNoise,
+};
+
+struct JitterOffset {
+    float X;
+    float Y;
+};
+
+inline float GetRadicalInverse(int index, int base)
+{
+    float inverse = 1.0f / base, scale = inverse, result = 0;
+    for (; index > 0; index /= base, scale *= inverse)
+        result += (index % base) * scale;
+    return result;
+}
+
+// The squared distance between two offsets on the torus.
+inline float GetJitterDistance2(const JitterOffset& a, const JitterOffset& b)
+{
+    float dx = std::fabs(a.X - b.X), dy = std::fabs(a.Y - b.Y);
+    dx = dx > 0.5f ? 1 - dx : dx;
+    dy = dy > 0.5f ? 1 - dy : dy;
+    return dx * dx + dy * dy;
+}
+
+// The same count and kind always give the same offsets.
+inline void GenerateJitterPattern(JitterPatternKind kind, int count,
+                                  std::vector<JitterOffset>& offsets)
+{
+    assert(count > 0);
+    offsets.resize(count);
+    if (kind == JitterPatternHalton) {
+        for (int i = 0; i < count; ++i) {
+            offsets[i].X = GetRadicalInverse(i + 1, 2);
+            offsets[i].Y = GetRadicalInverse(i + 1, 3);
+        }
+        return;
+    }
+
+    if (kind == JitterPatternR2) {
+        const double Plastic = 1.32471795724474602596;
+        const double StepX = 1 / Plastic, StepY = 1 / (Plastic * Plastic);
+        for (int i = 0; i < count; ++i) {
+            double x = 0.5 + StepX * i, y = 0.5 + StepY * i;
+            offsets[i].X = (float) (x - std::floor(x));
+            offsets[i].Y = (float) (y - std::floor(y));
+        }
+        return;
+    }
+
+    // Mitchell's best candidate, with a fixed seed.  More candidates for
+    // later offsets keep the spacing even as the gaps get smaller.
+    unsigned int seed = 0x2545f491u;
+    for (int i = 0; i < count; ++i) {
+        float bestDistance = -1;
+        int candidateCount = i ? 16 + 8 * i : 1;
+        for (int c = 0; c < candidateCount; ++c) {
+            JitterOffset candidate;
+            seed = seed * 1664525u + 1013904223u;
+            candidate.X = (seed >> 8) * (1.0f / 16777216.0f);
+            seed = seed * 1664525u + 1013904223u;
+            candidate.Y = (seed >> 8) * (1.0f / 16777216.0f);
+            float nearest = 2;
+            for (int j = 0; j < i; ++j) {
+                float distance = GetJitterDistance2(candidate, offsets[j]);
+                nearest = distance < nearest ? distance : nearest;
+            }
+            if (nearest > bestDistance) {
+                bestDistance = nearest;
+                offsets[i] = candidate;
+            }
+        }
+    }
+}
+
+// Picks how many samples to render from how long they take.  Feed it the
+// time the GPU spent, not the time between frames: behind vsync, frames
+// take a whole interval whether they're nearly idle or nearly full, which
+// hides the headroom.
+//
+// Frames that run over the budget cut the count in proportion, right
+// away.  A sample is added only when the frames have settled and one more
+// would still fit, scaling the time by the count; that overestimates, since
+// part of each frame doesn't depend on the count, so an added sample never
+// pushes the frames over and the count doesn't hunt.
+class JitterBudget {
+public:
+    JitterBudget(float budgetMilliseconds, int minCount, int maxCount, int startCount) :
+        m_budget(budgetMilliseconds), m_minCount(minCount), m_maxCount(maxCount),
+        m_count(startCount), m_smoothed(0), m_calmFrames(0)
+    {
+        assert(minCount > 0 && minCount <= startCount && startCount <= maxCount);
+    }
+    // How long a frame's samples took, and how many it rendered.  Frames
+    // that rendered some other count, like a still frame rendering none,
+    // say nothing about this one.
+    void AddFrame(float milliseconds, int sampleCount)
+    {
+        if (sampleCount != m_count)
+            return;
+        m_smoothed = m_smoothed ? m_smoothed + (milliseconds - m_smoothed) * 0.25f : milliseconds;
+        if (m_smoothed > m_budget * 1.1f && m_count > m_minCount) {
+            int count = (int) (m_count * m_budget / m_smoothed);
+            count = count < m_count ? count : m_count - 1;
+            SetCount(count < m_minCount ? m_minCount : count);
+        } else if (m_count < m_maxCount && m_smoothed * (m_count + 1) / m_count < m_budget) {
+            if (++m_calmFrames >= CalmFrameCount)
+                SetCount(m_count + 1);
+        } else {
+            m_calmFrames = 0;
+        }
+    }
+    int GetSampleCount() const { return m_count; }
+    float GetSmoothedMilliseconds() const { return m_smoothed; }
+private:
+    static const int CalmFrameCount = 30;
+    void SetCount(int count)
+    {
+        m_smoothed *= (float) count / m_count;
+        m_count = count;
+        m_calmFrames = 0;
+    }
+    float m_budget;
+    int m_minCount;
+    int m_maxCount;
+    int m_count;
+    float m_smoothed;
+    int m_calmFrames;
+};
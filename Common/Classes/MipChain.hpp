@@ -0,0 +1,238 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Floating-point RGBA images and mip chain generation for the offline tools.
+// Filtering happens on linear-light values; sRGB decoding and encoding are
+// done by the caller on the way in and out.
+
+struct FloatImage {
+    FloatImage() : Width(0), Height(0) {}
+    FloatImage(int width, int height)
+        : Width(width), Height(height), Texels(width * height * 4, 0.0f) {}
+    float* Texel(int x, int y)
+    {
+        return &Texels[(y * Width + x) * 4];
+    }
+    const float* Texel(int x, int y) const
+    {
+        return &Texels[(y * Width + x) * 4];
+    }
+    void FlipRows()
+    {
+        int rowFloats = Width * 4;
+        for (int y = 0; y < Height / 2; ++y) {
+            float* a = Texel(0, y);
+            float* b = Texel(0, Height - 1 - y);
+            for (int i = 0; i < rowFloats; ++i) {
+                float t = a[i]; a[i] = b[i]; b[i] = t;
+            }
+        }
+    }
+    int Width;
+    int Height;
+    std::vector<float> Texels;
+};
+
+enum MipFilter {
+    MipFilterNone,
+    MipFilterBox,
+    MipFilterKaiser,
+};
+
+inline float SrgbToLinear(float c)
+{
+    if (c <= 0.04045f)
+        return c / 12.92f;
+    return std::pow((c + 0.055f) / 1.055f, 2.4f);
+}
+
+inline float LinearToSrgb(float c)
+{
+    if (c <= 0.0031308f)
+        return c * 12.92f;
+    return 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+}
+
+// Expands 8-bit RGBA into a float image.  Alpha is always linear.
+inline void DecodeRgba8(const unsigned char* rgba, int width, int height,
+                        bool srgb, FloatImage& image)
+{
+    float table[256];
+    for (int i = 0; i < 256; ++i)
+        table[i] = srgb ? SrgbToLinear(i / 255.0f) : i / 255.0f;
+
+    image = FloatImage(width, height);
+    float* texel = &image.Texels[0];
+    for (int i = 0; i < width * height; ++i, rgba += 4) {
+        *texel++ = table[rgba[0]];
+        *texel++ = table[rgba[1]];
+        *texel++ = table[rgba[2]];
+        *texel++ = rgba[3] / 255.0f;
+    }
+}
+
+class MipGenerator {
+public:
+    MipGenerator(MipFilter filter, bool wrap) : m_filter(filter), m_wrap(wrap) {}
+    void Generate(const FloatImage& base, std::vector<FloatImage>& chain) const;
+    void Downsample(const FloatImage& source, FloatImage& dest) const;
+    void Resample(const FloatImage& source, int width, int height, FloatImage& dest) const;
+private:
+    struct Tap {
+        int Index;
+        float Weight;
+    };
+    struct Footprint {
+        int First;
+        int Count;
+    };
+    static const int KaiserRadius = 3;
+    void ComputeWeights(int sourceSize, int destSize,
+                        std::vector<Footprint>& footprints,
+                        std::vector<Tap>& taps) const;
+    float Evaluate(float t) const;
+    static float BesselI0(float x);
+    MipFilter m_filter;
+    bool m_wrap;
+};
+
+inline void MipGenerator::Generate(const FloatImage& base,
+                                   std::vector<FloatImage>& chain) const
+{
+    chain.clear();
+    chain.push_back(base);
+    if (m_filter == MipFilterNone)
+        return;
+
+    while (chain.back().Width > 1 || chain.back().Height > 1) {
+        FloatImage next;
+        Downsample(chain.back(), next);
+        chain.push_back(next);
+    }
+}
+
+inline void MipGenerator::Downsample(const FloatImage& source, FloatImage& dest) const
+{
+    int w = source.Width > 1 ? source.Width / 2 : 1;
+    int h = source.Height > 1 ? source.Height / 2 : 1;
+    Resample(source, w, h, dest);
+}
+
+// Resizes to an arbitrary size.  When enlarging, the kernel keeps its
+// source-texel width, so the box filter degenerates to a tent.
+inline void MipGenerator::Resample(const FloatImage& source, int w, int h,
+                                   FloatImage& dest) const
+{
+    std::vector<Footprint> columns, rows;
+    std::vector<Tap> columnTaps, rowTaps;
+    ComputeWeights(source.Width, w, columns, columnTaps);
+    ComputeWeights(source.Height, h, rows, rowTaps);
+
+    // Horizontal pass.
+    FloatImage temp(w, source.Height);
+    for (int y = 0; y < source.Height; ++y) {
+        for (int x = 0; x < w; ++x) {
+            float sum[4] = { 0, 0, 0, 0 };
+            const Tap* tap = &columnTaps[columns[x].First];
+            for (int i = 0; i < columns[x].Count; ++i, ++tap) {
+                const float* texel = source.Texel(tap->Index, y);
+                for (int c = 0; c < 4; ++c)
+                    sum[c] += texel[c] * tap->Weight;
+            }
+            float* out = temp.Texel(x, y);
+            for (int c = 0; c < 4; ++c)
+                out[c] = sum[c];
+        }
+    }
+
+    // Vertical pass.  Kaiser lobes can overshoot, so clamp to [0, 1].
+    dest = FloatImage(w, h);
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            float sum[4] = { 0, 0, 0, 0 };
+            const Tap* tap = &rowTaps[rows[y].First];
+            for (int i = 0; i < rows[y].Count; ++i, ++tap) {
+                const float* texel = temp.Texel(x, tap->Index);
+                for (int c = 0; c < 4; ++c)
+                    sum[c] += texel[c] * tap->Weight;
+            }
+            float* out = dest.Texel(x, y);
+            for (int c = 0; c < 4; ++c)
+                out[c] = sum[c] < 0 ? 0 : (sum[c] > 1 ? 1 : sum[c]);
+        }
+    }
+}
+
+inline void MipGenerator::ComputeWeights(int sourceSize, int destSize,
+                                         std::vector<Footprint>& footprints,
+                                         std::vector<Tap>& taps) const
+{
+    float scale = (float) sourceSize / destSize;
+    float width = scale > 1 ? scale : 1;
+    float radius = m_filter == MipFilterKaiser ? KaiserRadius * width : width / 2;
+
+    footprints.resize(destSize);
+    taps.clear();
+    for (int i = 0; i < destSize; ++i) {
+        float center = (i + 0.5f) * scale;
+        int first = (int) std::floor(center - radius);
+        int last = (int) std::ceil(center + radius);
+
+        footprints[i].First = taps.size();
+        float total = 0;
+        for (int j = first; j < last; ++j) {
+            float weight;
+            if (m_filter == MipFilterKaiser) {
+                weight = Evaluate((j + 0.5f - center) / width);
+            } else {
+                float left = std::max((float) j, center - radius);
+                float right = std::min((float) j + 1, center + radius);
+                weight = right - left;
+            }
+            if (weight == 0)
+                continue;
+
+            int index = j;
+            if (m_wrap)
+                index = ((j % sourceSize) + sourceSize) % sourceSize;
+            else
+                index = j < 0 ? 0 : (j >= sourceSize ? sourceSize - 1 : j);
+
+            Tap tap = { index, weight };
+            taps.push_back(tap);
+            total += weight;
+        }
+        footprints[i].Count = taps.size() - footprints[i].First;
+
+        for (int t = footprints[i].First; t < (int) taps.size(); ++t)
+            taps[t].Weight /= total;
+    }
+}
+
+// Kaiser-windowed sinc, with t measured in the larger of the source and
+// destination texel sizes.
+inline float MipGenerator::Evaluate(float t) const
+{
+    const float Alpha = 4;
+    if (std::fabs(t) >= KaiserRadius)
+        return 0;
+
+    float x = 3.14159265f * t;
+    float sinc = t == 0 ? 1 : std::sin(x) / x;
+    float r = t / KaiserRadius;
+    float window = BesselI0(Alpha * std::sqrt(1 - r * r)) / BesselI0(Alpha);
+    return sinc * window;
+}
+
+inline float MipGenerator::BesselI0(float x)
+{
+    float sum = 1, term = 1;
+    float halfX = x / 2;
+    for (int k = 1; k < 20; ++k) {
+        term *= (halfX / k) * (halfX / k);
+        sum += term;
+    }
+    return sum;
+}
@@ -0,0 +1,265 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+// Decides how much of each texture's mip chain belongs in video memory.
+// Every texture starts with only its small levels, those no larger than
+// the base size, and gains one finer level per frame until it matches how
+// big it is on screen.  Under the memory cap, textures that weren't seen
+// lately, then textures finer than they need to be, give levels back.
+//
+// ES 1.1 and 2.0 can't set a texture's base level, so a texture holds
+// every level from its finest resident one down to 1x1, and changing the
+// finest level re-specifies that whole chain.  That's what the per-frame
+// budget is charged.  Nothing here touches GL; MipStreamer.hpp applies the
+// changes.
+//
+//     every frame:
+//     residency.SetScreenSize(texture, pixels);   // for each texture in view
+//     residency.Update(byteBudget, changes);      // then re-specify each change
+
+struct MipChange {
+    int Texture;
+    int Level;              // the new finest resident level
+};
+
+struct MipResidencyStats {
+    int LevelCount;
+    int BaseLevel;          // where the texture starts; it's never evicted past this
+    int ResidentLevel;
+    int WantedLevel;
+    size_t ResidentBytes;
+    size_t FullBytes;       // every level
+    float ScreenSize;       // in pixels, as of the last frame it was seen
+    unsigned int LastSeen;  // the frame it was last seen, counting from 1
+    int Promotions;
+    int Evictions;
+};
+
+class MipResidency {
+public:
+    MipResidency(size_t memoryCap, int baseSize = 32);
+    int AddTexture(int width, int height, const std::vector<size_t>& levelSizes);
+    void SetScreenSize(int texture, float pixels);
+    void Update(size_t byteBudget, std::vector<MipChange>& changes);
+    void SetMemoryCap(size_t memoryCap) { m_memoryCap = memoryCap; }
+    size_t GetMemoryCap() const { return m_memoryCap; }
+    size_t GetResidentBytes() const { return m_residentBytes; }
+    size_t GetUploadedBytes() const { return m_uploadedBytes; }
+    int GetTextureCount() const { return m_textures.size(); }
+    const MipResidencyStats& GetStats(int texture) const;
+    size_t GetChainBytes(int texture, int level) const;
+    static float EstimateScreenSize(float worldSize, float distance, float focalLength);
+private:
+    struct Texture {
+        int Size;                           // the larger of width and height
+        std::vector<size_t> ChainBytes;     // from each level down to 1x1
+        MipResidencyStats Stats;
+    };
+    bool MakeRoom(int keep, size_t needed, bool force, std::vector<MipChange>& changes);
+    int ChooseVictim(int keep, bool force) const;
+    void SetLevel(int texture, int level, std::vector<MipChange>& changes);
+    std::vector<Texture> m_textures;
+    std::vector<int> m_candidates;
+    size_t m_memoryCap;
+    size_t m_residentBytes;
+    size_t m_uploadedBytes;
+    int m_baseSize;
+    unsigned int m_frame;
+};
+
+inline MipResidency::MipResidency(size_t memoryCap, int baseSize) :
+    m_memoryCap(memoryCap),
+    m_residentBytes(0),
+    m_uploadedBytes(0),
+    m_baseSize(baseSize),
+    m_frame(1)
+{
+    assert(baseSize >= 1);
+}
+
+// The sizes run from level 0 down to 1x1.  The caller uploads the base
+// chain straight away; it doesn't count against any frame's budget, and
+// it's there whatever the cap says.
+inline int MipResidency::AddTexture(int width, int height, const std::vector<size_t>& levelSizes)
+{
+    assert(width > 0 && height > 0 && !levelSizes.empty());
+    Texture texture;
+    texture.Size = std::max(width, height);
+    texture.ChainBytes.resize(levelSizes.size() + 1, 0);
+    for (int level = levelSizes.size() - 1; level >= 0; --level)
+        texture.ChainBytes[level] = texture.ChainBytes[level + 1] + levelSizes[level];
+    texture.ChainBytes.pop_back();
+
+    MipResidencyStats& stats = texture.Stats;
+    stats.LevelCount = levelSizes.size();
+    stats.BaseLevel = 0;
+    int last = stats.LevelCount - 1;
+    while (stats.BaseLevel < last && (texture.Size >> stats.BaseLevel) > m_baseSize)
+        ++stats.BaseLevel;
+    stats.ResidentLevel = stats.BaseLevel;
+    stats.WantedLevel = stats.BaseLevel;
+    stats.ResidentBytes = texture.ChainBytes[stats.BaseLevel];
+    stats.FullBytes = texture.ChainBytes[0];
+    stats.ScreenSize = 0;
+    stats.LastSeen = 0;
+    stats.Promotions = 0;
+    stats.Evictions = 0;
+
+    m_residentBytes += stats.ResidentBytes;
+    m_textures.push_back(texture);
+    return m_textures.size() - 1;
+}
+
+// Marks the texture as seen this frame, covering about this many pixels
+// across its larger side.  A texture that repeats counts one repeat.
+inline void MipResidency::SetScreenSize(int texture, float pixels)
+{
+    assert(texture >= 0 && texture < (int) m_textures.size());
+    Texture& entry = m_textures[texture];
+    MipResidencyStats& stats = entry.Stats;
+    stats.ScreenSize = pixels;
+    stats.LastSeen = m_frame;
+
+    // The coarsest level that still has a texel for every pixel.
+    int level = 0;
+    while (level < stats.BaseLevel && (entry.Size >> (level + 1)) >= pixels)
+        ++level;
+    stats.WantedLevel = level;
+}
+
+inline const MipResidencyStats& MipResidency::GetStats(int texture) const
+{
+    assert(texture >= 0 && texture < (int) m_textures.size());
+    return m_textures[texture].Stats;
+}
+
+inline size_t MipResidency::GetChainBytes(int texture, int level) const
+{
+    assert(texture >= 0 && texture < (int) m_textures.size());
+    return m_textures[texture].ChainBytes[level];
+}
+
+// Something worldSize across, seen face on from the given distance, with a
+// projection whose focal length is in pixels: the near plane's distance
+// times the viewport's width over the frustum's.
+inline float MipResidency::EstimateScreenSize(float worldSize, float distance, float focalLength)
+{
+    return worldSize * focalLength / std::max(distance, 0.001f);
+}
+
+// Promotes textures seen this frame by one level each, the furthest behind
+// first, until the budget runs out.  The first promotion always goes so
+// that a big texture can't stall forever.  Changes hold each texture
+// touched once, at its new level.
+inline void MipResidency::Update(size_t byteBudget, std::vector<MipChange>& changes)
+{
+    changes.clear();
+    m_uploadedBytes = 0;
+    MakeRoom(-1, 0, true, changes);
+
+    m_candidates.clear();
+    for (size_t i = 0; i < m_textures.size(); ++i) {
+        const MipResidencyStats& stats = m_textures[i].Stats;
+        if (stats.LastSeen == m_frame && stats.ResidentLevel > stats.WantedLevel)
+            m_candidates.push_back(i);
+    }
+    for (size_t i = 1; i < m_candidates.size(); ++i) {
+        for (size_t j = i; j > 0; --j) {
+            const MipResidencyStats& a = m_textures[m_candidates[j - 1]].Stats;
+            const MipResidencyStats& b = m_textures[m_candidates[j]].Stats;
+            int gapA = a.ResidentLevel - a.WantedLevel;
+            int gapB = b.ResidentLevel - b.WantedLevel;
+            if (gapA > gapB || (gapA == gapB && a.ScreenSize >= b.ScreenSize))
+                break;
+            std::swap(m_candidates[j - 1], m_candidates[j]);
+        }
+    }
+
+    bool promoted = false;
+    for (size_t i = 0; i < m_candidates.size(); ++i) {
+        int texture = m_candidates[i];
+        const Texture& entry = m_textures[texture];
+        int level = entry.Stats.ResidentLevel - 1;
+        size_t cost = entry.ChainBytes[level];
+        if (promoted && m_uploadedBytes + cost > byteBudget)
+            break;
+        if (!MakeRoom(texture, entry.ChainBytes[level] - entry.Stats.ResidentBytes, false, changes))
+            continue;
+        SetLevel(texture, level, changes);
+        ++m_textures[texture].Stats.Promotions;
+        promoted = true;
+    }
+
+    // A texture evicted twice is only re-specified once.
+    m_uploadedBytes = 0;
+    for (size_t i = 0; i < changes.size(); ++i)
+        m_uploadedBytes += m_textures[changes[i].Texture].ChainBytes[changes[i].Level];
+    ++m_frame;
+}
+
+// Gives levels back until there's room for the given growth.  Without
+// force, textures in view only give up what they don't need, so one
+// can't be evicted to make room for another and then come straight back.
+inline bool MipResidency::MakeRoom(int keep, size_t needed, bool force,
+                                   std::vector<MipChange>& changes)
+{
+    while (m_residentBytes + needed > m_memoryCap) {
+        int victim = ChooseVictim(keep, force);
+        if (victim < 0)
+            return false;
+        SetLevel(victim, m_textures[victim].Stats.ResidentLevel + 1, changes);
+        ++m_textures[victim].Stats.Evictions;
+    }
+    return true;
+}
+
+// Least recently seen first, then whatever's finest compared to what it
+// needs, then, when forced, whatever's smallest on screen.
+inline int MipResidency::ChooseVictim(int keep, bool force) const
+{
+    int victim = -1;
+    int victimTier = 0;
+    for (size_t i = 0; i < m_textures.size(); ++i) {
+        const MipResidencyStats& stats = m_textures[i].Stats;
+        if ((int) i == keep || stats.ResidentLevel >= stats.BaseLevel)
+            continue;
+        int tier = stats.LastSeen != m_frame ? 3 :
+                   stats.ResidentLevel < stats.WantedLevel ? 2 : force ? 1 : 0;
+        if (!tier || tier < victimTier)
+            continue;
+        if (tier > victimTier) {
+            victim = i;
+            victimTier = tier;
+            continue;
+        }
+        const MipResidencyStats& best = m_textures[victim].Stats;
+        bool better = tier == 3 ? stats.LastSeen < best.LastSeen :
+                      tier == 2 ? stats.WantedLevel - stats.ResidentLevel >
+                                  best.WantedLevel - best.ResidentLevel :
+                      stats.ScreenSize < best.ScreenSize;
+        if (better)
+            victim = i;
+    }
+    return victim;
+}
+
+inline void MipResidency::SetLevel(int texture, int level, std::vector<MipChange>& changes)
+{
+    Texture& entry = m_textures[texture];
+    MipResidencyStats& stats = entry.Stats;
+    m_residentBytes = m_residentBytes - stats.ResidentBytes + entry.ChainBytes[level];
+    m_uploadedBytes += entry.ChainBytes[level];
+    stats.ResidentLevel = level;
+    stats.ResidentBytes = entry.ChainBytes[level];
+
+    for (size_t i = 0; i < changes.size(); ++i) {
+        if (changes[i].Texture == texture) {
+            changes[i].Level = level;
+            return;
+        }
+    }
+    MipChange change = { texture, level };
+    changes.push_back(change);
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include "MipResidency.hpp"
+#include "PvrUpload.hpp"
+#include <deque>
+#include <map>
+#include <vector>
+
+// Keeps a CPU copy of each texture's mip chain and re-specifies the GL
+// texture whenever MipResidency moves its finest level.  The texture name
+// never changes, so whoever holds it can keep binding it.  A chain that
+// shrinks leaves a stale level past its new end, which GL ignores because
+// completeness only looks as far as the new level 0 needs.
+// Include the ES1 or ES2 headers before this file.
+
+class MipStreamer {
+public:
+    MipStreamer(size_t memoryCap, size_t byteBudget, int baseSize = 32) :
+        m_residency(memoryCap, baseSize), m_byteBudget(byteBudget) {}
+    GLuint AddTexture(const PvrGlFormat& format, int width, int height,
+                      const std::vector<size_t>& levelSizes,
+                      std::vector<unsigned char>& pixels);
+    void SetScreenSize(GLuint texture, float pixels);
+    void Update();
+    const MipResidency& GetResidency() const { return m_residency; }
+    int GetIndex(GLuint texture) const;
+private:
+    struct Source {
+        GLuint Name;
+        PvrGlFormat Format;
+        int Width;
+        int Height;
+        std::vector<size_t> Offsets;
+        std::vector<size_t> Sizes;
+        std::vector<unsigned char> Pixels;
+    };
+    void Specify(const Source& source, int firstLevel) const;
+    MipResidency m_residency;
+    size_t m_byteBudget;
+    std::deque<Source> m_sources;
+    std::map<GLuint, int> m_indices;
+    std::vector<MipChange> m_changes;
+};
+
+// Takes the pixels, every level from 0 down to 1x1 back to back, by
+// swapping them out of the caller's vector, and uploads the base chain.
+inline GLuint MipStreamer::AddTexture(const PvrGlFormat& format, int width, int height,
+                                      const std::vector<size_t>& levelSizes,
+                                      std::vector<unsigned char>& pixels)
+{
+    m_sources.push_back(Source());
+    Source& source = m_sources.back();
+    source.Format = format;
+    source.Width = width;
+    source.Height = height;
+    source.Sizes = levelSizes;
+    size_t offset = 0;
+    for (size_t level = 0; level < levelSizes.size(); ++level) {
+        source.Offsets.push_back(offset);
+        offset += levelSizes[level];
+    }
+    assert(offset <= pixels.size());
+    source.Pixels.swap(pixels);
+
+    glGenTextures(1, &source.Name);
+    glBindTexture(GL_TEXTURE_2D, source.Name);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    int index = m_residency.AddTexture(width, height, levelSizes);
+    m_indices[source.Name] = index;
+    Specify(source, m_residency.GetStats(index).ResidentLevel);
+    return source.Name;
+}
+
+inline int MipStreamer::GetIndex(GLuint texture) const
+{
+    std::map<GLuint, int>::const_iterator index = m_indices.find(texture);
+    return index == m_indices.end() ? -1 : index->second;
+}
+
+// Textures this streamer doesn't own are ignored.
+inline void MipStreamer::SetScreenSize(GLuint texture, float pixels)
+{
+    int index = GetIndex(texture);
+    if (index >= 0)
+        m_residency.SetScreenSize(index, pixels);
+}
+
+inline void MipStreamer::Update()
+{
+    m_residency.Update(m_byteBudget, m_changes);
+    for (size_t i = 0; i < m_changes.size(); ++i)
+        Specify(m_sources[m_changes[i].Texture], m_changes[i].Level);
+}
+
+inline void MipStreamer::Specify(const Source& source, int firstLevel) const
+{
+    glBindTexture(GL_TEXTURE_2D, source.Name);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (int level = firstLevel; level < (int) source.Sizes.size(); ++level) {
+        int width = source.Width >> level;
+        int height = source.Height >> level;
+        width = width ? width : 1;
+        height = height ? height : 1;
+        const unsigned char* data = &source.Pixels[source.Offsets[level]];
+        if (source.Format.Compressed)
+            glCompressedTexImage2D(GL_TEXTURE_2D, level - firstLevel, source.Format.Format,
+                                   width, height, 0, source.Sizes[level], data);
+        else
+            glTexImage2D(GL_TEXTURE_2D, level - firstLevel, source.Format.Format, width, height,
+                         0, source.Format.Format, source.Format.Type, data);
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
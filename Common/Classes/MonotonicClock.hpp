@@ -0,0 +1,25 @@
+#pragma once
+#include <stdint.h>
+#ifdef __APPLE__
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
+
+// Nanoseconds since an arbitrary point, from a clock that never jumps
+// backward when the wall clock gets set.  Mach's timebase only needs
+// asking once.
+
+inline uint64_t GetMonotonicNanoseconds()
+{
+#ifdef __APPLE__
+    static mach_timebase_info_data_t timebase;
+    if (!timebase.denom)
+        mach_timebase_info(&timebase);
+    return mach_absolute_time() * timebase.numer / timebase.denom;
+#else
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000u + now.tv_nsec;
+#endif
+}
@@ -0,0 +1,641 @@
+#pragma once
+#include "DistanceTransform.hpp"
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+// Multi-channel signed distance fields, after Chlumsky's "Shape Decomposition
+// for Multi-channel Distance Fields" (2015) and his msdfgen.  A single
+// distance field rounds off every corner, because bilinear filtering of one
+// channel can only represent one edge per texel.  Here the edges of each
+// contour are colored so that the two edges meeting at a corner never share
+// a channel, each channel stores the distance to its own edges, and the
+// shader takes the median of the three, which keeps corners sharp at a
+// fraction of the resolution.
+//
+// Shapes are built from lines and quadratic and cubic Beziers in texel
+// units, y up, with outer contours counterclockwise.  The alpha channel gets
+// the true distance so that effects which reach far from the edge, such as
+// glows and shadows, still have something smooth to work with.  Values use
+// the same 128-centered layout as DistanceTransform.hpp, negative inside.
+
+struct MsdfVector {
+    MsdfVector(double x = 0, double y = 0) : X(x), Y(y) {}
+    MsdfVector operator+(const MsdfVector& v) const { return MsdfVector(X + v.X, Y + v.Y); }
+    MsdfVector operator-(const MsdfVector& v) const { return MsdfVector(X - v.X, Y - v.Y); }
+    MsdfVector operator*(double s) const { return MsdfVector(X * s, Y * s); }
+    bool operator==(const MsdfVector& v) const { return X == v.X && Y == v.Y; }
+    double Dot(const MsdfVector& v) const { return X * v.X + Y * v.Y; }
+    double Cross(const MsdfVector& v) const { return X * v.Y - Y * v.X; }
+    double Length() const { return std::sqrt(X * X + Y * Y); }
+    MsdfVector Normalized() const
+    {
+        double length = Length();
+        return length ? MsdfVector(X / length, Y / length) : MsdfVector(0, 1);
+    }
+    MsdfVector Lerp(double t, const MsdfVector& v) const { return *this + (v - *this) * t; }
+    double X;
+    double Y;
+};
+
+enum EdgeColor {
+    EdgeColorBlack = 0,
+    EdgeColorRed = 1,
+    EdgeColorGreen = 2,
+    EdgeColorYellow = 3,
+    EdgeColorBlue = 4,
+    EdgeColorMagenta = 5,
+    EdgeColorCyan = 6,
+    EdgeColorWhite = 7,
+};
+
+// Distance to an edge, with the dot product between the edge's direction
+// and the direction to its nearest point to break ties at shared endpoints.
+struct MsdfDistance {
+    MsdfDistance(double distance = 1e240, double dot = 1) : Distance(distance), Dot(dot) {}
+    bool IsCloserThan(const MsdfDistance& other) const
+    {
+        double a = std::fabs(Distance), b = std::fabs(other.Distance);
+        return a < b || (a == b && Dot < other.Dot);
+    }
+    double Distance;
+    double Dot;
+};
+
+struct EdgeSegment {
+    EdgeSegment() : Order(1), Color(EdgeColorWhite) {}
+    MsdfVector Point(double t) const;
+    MsdfVector Direction(double t) const;
+    MsdfDistance Distance(const MsdfVector& origin, double* param) const;
+    void ToPseudoDistance(MsdfDistance& distance, const MsdfVector& origin, double param) const;
+    void Split(double t, EdgeSegment& first, EdgeSegment& second) const;
+    void Reverse();
+    int Order;
+    MsdfVector P[4];
+    int Color;
+};
+
+// Control points bound their curve, so a box around them is a conservative
+// test for skipping edges and contours that can't be the nearest.
+struct MsdfBounds {
+    MsdfBounds() : Left(1e240), Bottom(1e240), Right(-1e240), Top(-1e240) {}
+    void Include(const MsdfVector& p)
+    {
+        Left = std::min(Left, p.X);
+        Bottom = std::min(Bottom, p.Y);
+        Right = std::max(Right, p.X);
+        Top = std::max(Top, p.Y);
+    }
+    void Include(const MsdfBounds& other)
+    {
+        Left = std::min(Left, other.Left);
+        Bottom = std::min(Bottom, other.Bottom);
+        Right = std::max(Right, other.Right);
+        Top = std::max(Top, other.Top);
+    }
+    double Distance(const MsdfVector& p) const
+    {
+        double dx = std::max(std::max(Left - p.X, p.X - Right), 0.0);
+        double dy = std::max(std::max(Bottom - p.Y, p.Y - Top), 0.0);
+        return std::sqrt(dx * dx + dy * dy);
+    }
+    double Left;
+    double Bottom;
+    double Right;
+    double Top;
+};
+
+struct MsdfContour {
+    std::vector<EdgeSegment> Edges;
+};
+
+class MsdfShape {
+public:
+    MsdfShape() : m_open(false) {}
+    void MoveTo(const MsdfVector& p);
+    void LineTo(const MsdfVector& p);
+    void QuadraticTo(const MsdfVector& control, const MsdfVector& p);
+    void CubicTo(const MsdfVector& control0, const MsdfVector& control1, const MsdfVector& p);
+    void ReverseContours(int firstContour = 0);
+    void ColorEdges(double angleThreshold = 3);
+    int GetContourCount() const { return m_contours.size(); }
+    const std::vector<MsdfContour>& GetContours() const { return m_contours; }
+private:
+    void AddEdge(int order, const MsdfVector* points);
+    std::vector<MsdfContour> m_contours;
+    MsdfVector m_cursor;
+    bool m_open;
+};
+
+class MsdfGenerator {
+public:
+    MsdfGenerator(int threadCount = 1) : m_threadCount(threadCount) {}
+    void Generate(const MsdfShape& shape, int width, int height, float range,
+                  std::vector<unsigned char>& rgba);
+    void operator()(int begin, int end);
+private:
+    void CorrectClashes(std::vector<float>& distances) const;
+    int m_threadCount;
+    std::vector<MsdfBounds> m_contourBounds;
+    std::vector<std::vector<MsdfBounds> > m_edgeBounds;
+    const MsdfShape* m_shape;
+    int m_width;
+    int m_height;
+    std::vector<float>* m_distances;
+};
+
+inline double MsdfSign(double value)
+{
+    return value > 0 ? 1 : -1;
+}
+
+inline int MsdfSolveQuadratic(double x[2], double a, double b, double c)
+{
+    if (a == 0 || std::fabs(b) > 1e12 * std::fabs(a)) {
+        if (b == 0)
+            return 0;
+        x[0] = -c / b;
+        return 1;
+    }
+    double discriminant = b * b - 4 * a * c;
+    if (discriminant > 0) {
+        discriminant = std::sqrt(discriminant);
+        x[0] = (-b + discriminant) / (2 * a);
+        x[1] = (-b - discriminant) / (2 * a);
+        return 2;
+    }
+    if (discriminant == 0) {
+        x[0] = -b / (2 * a);
+        return 1;
+    }
+    return 0;
+}
+
+inline int MsdfSolveCubic(double x[3], double a, double b, double c, double d)
+{
+    // Past this ratio the cubic term is noise and a quadratic is more accurate.
+    if (a == 0 || std::fabs(b / a) >= 1e6)
+        return MsdfSolveQuadratic(x, b, c, d);
+
+    b /= a;
+    c /= a;
+    d /= a;
+    double b2 = b * b;
+    double q = (b2 - 3 * c) / 9;
+    double r = (b * (2 * b2 - 9 * c) + 27 * d) / 54;
+    double q3 = q * q * q;
+    const double TwoPi = 6.28318530717958647692;
+    b /= 3;
+    if (r * r < q3) {
+        double t = r / std::sqrt(q3);
+        t = std::acos(t < -1 ? -1 : (t > 1 ? 1 : t));
+        q = -2 * std::sqrt(q);
+        x[0] = q * std::cos(t / 3) - b;
+        x[1] = q * std::cos((t + TwoPi) / 3) - b;
+        x[2] = q * std::cos((t - TwoPi) / 3) - b;
+        return 3;
+    }
+    double u = (r < 0 ? 1 : -1) * std::pow(std::fabs(r) + std::sqrt(r * r - q3), 1 / 3.0);
+    double v = u == 0 ? 0 : q / u;
+    x[0] = u + v - b;
+    if (u == v || std::fabs(u - v) < 1e-12 * std::fabs(u + v)) {
+        x[1] = -0.5 * (u + v) - b;
+        return 2;
+    }
+    return 1;
+}
+
+inline MsdfVector EdgeSegment::Point(double t) const
+{
+    MsdfVector p[4] = { P[0], P[1], P[2], P[3] };
+    for (int n = Order; n > 0; --n)
+        for (int i = 0; i < n; ++i)
+            p[i] = p[i].Lerp(t, p[i + 1]);
+    return p[0];
+}
+
+// Proportional to the derivative.  Curves whose control points coincide
+// with an endpoint fall back to the chord so that corners are still found.
+inline MsdfVector EdgeSegment::Direction(double t) const
+{
+    if (Order == 1)
+        return P[1] - P[0];
+    if (Order == 2) {
+        MsdfVector tangent = (P[1] - P[0]).Lerp(t, P[2] - P[1]);
+        return tangent == MsdfVector() ? P[2] - P[0] : tangent;
+    }
+    MsdfVector tangent = (P[1] - P[0]).Lerp(t, P[2] - P[1]).Lerp(t, (P[2] - P[1]).Lerp(t, P[3] - P[2]));
+    if (tangent == MsdfVector()) {
+        if (t == 0)
+            return P[2] - P[0];
+        if (t == 1)
+            return P[3] - P[1];
+    }
+    return tangent;
+}
+
+inline MsdfDistance EdgeSegment::Distance(const MsdfVector& origin, double* param) const
+{
+    if (Order == 1) {
+        MsdfVector aq = origin - P[0];
+        MsdfVector ab = P[1] - P[0];
+        *param = aq.Dot(ab) / ab.Dot(ab);
+        MsdfVector eq = P[*param > 0.5 ? 1 : 0] - origin;
+        double endpointDistance = eq.Length();
+        if (*param > 0 && *param < 1) {
+            double orthoDistance = aq.Cross(ab) / ab.Length();
+            if (std::fabs(orthoDistance) < endpointDistance)
+                return MsdfDistance(orthoDistance, 0);
+        }
+        return MsdfDistance(MsdfSign(aq.Cross(ab)) * endpointDistance,
+                            std::fabs(ab.Normalized().Dot(eq.Normalized())));
+    }
+
+    MsdfVector last = P[Order];
+    MsdfVector qa = P[0] - origin;
+    MsdfVector direction = Direction(0);
+    double minDistance = MsdfSign(direction.Cross(qa)) * qa.Length();
+    *param = -qa.Dot(direction) / direction.Dot(direction);
+    direction = Direction(1);
+    double distance = (last - origin).Length();
+    if (distance < std::fabs(minDistance)) {
+        minDistance = MsdfSign(direction.Cross(last - origin)) * distance;
+        *param = (origin - P[Order - 1]).Dot(direction) / direction.Dot(direction);
+    }
+
+    MsdfVector ab = P[1] - P[0];
+    MsdfVector br = P[2] - P[1] - ab;
+    if (Order == 2) {
+        // The nearest point zeroes the derivative of the squared distance.
+        double t[3];
+        int count = MsdfSolveCubic(t, br.Dot(br), 3 * ab.Dot(br),
+                                   2 * ab.Dot(ab) + qa.Dot(br), qa.Dot(ab));
+        for (int i = 0; i < count; ++i) {
+            if (t[i] <= 0 || t[i] >= 1)
+                continue;
+            MsdfVector qe = qa + ab * (2 * t[i]) + br * (t[i] * t[i]);
+            distance = qe.Length();
+            if (distance <= std::fabs(minDistance)) {
+                minDistance = MsdfSign((ab + br * t[i]).Cross(qe)) * distance;
+                *param = t[i];
+            }
+        }
+    } else {
+        // No closed form for cubics; refine a few starting points instead.
+        const int Starts = 4, Steps = 4;
+        MsdfVector as = (P[3] - P[2]) - (P[2] - P[1]) - br;
+        for (int i = 0; i <= Starts; ++i) {
+            double t = (double) i / Starts;
+            MsdfVector qe = qa + ab * (3 * t) + br * (3 * t * t) + as * (t * t * t);
+            for (int step = 0; step < Steps; ++step) {
+                MsdfVector d1 = ab * 3 + br * (6 * t) + as * (3 * t * t);
+                MsdfVector d2 = br * 6 + as * (6 * t);
+                t -= qe.Dot(d1) / (d1.Dot(d1) + qe.Dot(d2));
+                if (t <= 0 || t >= 1)
+                    break;
+                qe = qa + ab * (3 * t) + br * (3 * t * t) + as * (t * t * t);
+                distance = qe.Length();
+                if (distance < std::fabs(minDistance)) {
+                    minDistance = MsdfSign(d1.Cross(qe)) * distance;
+                    *param = t;
+                }
+            }
+        }
+    }
+
+    if (*param >= 0 && *param <= 1)
+        return MsdfDistance(minDistance, 0);
+    if (*param < 0.5)
+        return MsdfDistance(minDistance, std::fabs(Direction(0).Normalized().Dot(qa.Normalized())));
+    return MsdfDistance(minDistance,
+                        std::fabs(Direction(1).Normalized().Dot((last - origin).Normalized())));
+}
+
+// Past either end, measures to the line that continues the edge instead, so
+// that the channels stay straight across a corner rather than rounding it.
+inline void EdgeSegment::ToPseudoDistance(MsdfDistance& distance, const MsdfVector& origin,
+                                          double param) const
+{
+    if (param >= 0 && param <= 1)
+        return;
+    bool start = param < 0;
+    MsdfVector direction = Direction(start ? 0 : 1).Normalized();
+    MsdfVector q = origin - P[start ? 0 : Order];
+    double along = q.Dot(direction);
+    if (start ? along >= 0 : along <= 0)
+        return;
+    double pseudoDistance = q.Cross(direction);
+    if (std::fabs(pseudoDistance) <= std::fabs(distance.Distance)) {
+        distance.Distance = pseudoDistance;
+        distance.Dot = 0;
+    }
+}
+
+// De Casteljau subdivision.
+inline void EdgeSegment::Split(double t, EdgeSegment& first, EdgeSegment& second) const
+{
+    MsdfVector p[4] = { P[0], P[1], P[2], P[3] };
+    first = second = *this;
+    for (int n = Order; n >= 0; --n) {
+        first.P[Order - n] = p[0];
+        second.P[n] = p[n];
+        for (int i = 0; i < n; ++i)
+            p[i] = p[i].Lerp(t, p[i + 1]);
+    }
+}
+
+inline void EdgeSegment::Reverse()
+{
+    for (int i = 0; i < (Order + 1) / 2; ++i)
+        std::swap(P[i], P[Order - i]);
+}
+
+inline void MsdfShape::MoveTo(const MsdfVector& p)
+{
+    m_contours.push_back(MsdfContour());
+    m_cursor = p;
+    m_open = true;
+}
+
+inline void MsdfShape::LineTo(const MsdfVector& p)
+{
+    MsdfVector points[2] = { m_cursor, p };
+    AddEdge(1, points);
+}
+
+inline void MsdfShape::QuadraticTo(const MsdfVector& control, const MsdfVector& p)
+{
+    MsdfVector points[3] = { m_cursor, control, p };
+    AddEdge(2, points);
+}
+
+inline void MsdfShape::CubicTo(const MsdfVector& control0, const MsdfVector& control1,
+                               const MsdfVector& p)
+{
+    MsdfVector points[4] = { m_cursor, control0, control1, p };
+    AddEdge(3, points);
+}
+
+inline void MsdfShape::AddEdge(int order, const MsdfVector* points)
+{
+    assert(m_open && "MoveTo must start every contour");
+    m_cursor = points[order];
+
+    // Degenerate edges have no direction and would only confuse coloring.
+    bool degenerate = true;
+    for (int i = 1; i <= order; ++i)
+        degenerate = degenerate && points[i] == points[0];
+    if (degenerate)
+        return;
+
+    EdgeSegment edge;
+    edge.Order = order;
+    for (int i = 0; i <= order; ++i)
+        edge.P[i] = points[i];
+    m_contours.back().Edges.push_back(edge);
+}
+
+// For outlines that wind the other way, such as TrueType glyphs.
+inline void MsdfShape::ReverseContours(int firstContour)
+{
+    for (size_t c = firstContour; c < m_contours.size(); ++c) {
+        std::vector<EdgeSegment>& edges = m_contours[c].Edges;
+        std::reverse(edges.begin(), edges.end());
+        for (size_t i = 0; i < edges.size(); ++i)
+            edges[i].Reverse();
+    }
+}
+
+inline void MsdfSwitchColor(int& color, unsigned int& seed, int banned = EdgeColorBlack)
+{
+    static const int Start[3] = { EdgeColorCyan, EdgeColorMagenta, EdgeColorYellow };
+    int combined = color & banned;
+    if (combined == EdgeColorRed || combined == EdgeColorGreen || combined == EdgeColorBlue) {
+        color = combined ^ EdgeColorWhite;
+        return;
+    }
+    if (color == EdgeColorBlack || color == EdgeColorWhite) {
+        color = Start[seed % 3];
+        seed /= 3;
+        return;
+    }
+    int shifted = color << (1 + (seed & 1));
+    color = (shifted | shifted >> 3) & EdgeColorWhite;
+    seed >>= 1;
+}
+
+// Assigns channels so that the edges on either side of every corner sharper
+// than the threshold (in radians) differ in two channels.  Smooth contours
+// stay white.  A contour with a single corner, a teardrop, is split into
+// three runs so that the corner still gets two colors.
+inline void MsdfShape::ColorEdges(double angleThreshold)
+{
+    double crossThreshold = std::sin(angleThreshold);
+    unsigned int seed = 0;
+    for (size_t c = 0; c < m_contours.size(); ++c) {
+        std::vector<EdgeSegment>& edges = m_contours[c].Edges;
+        int m = edges.size();
+        if (!m)
+            continue;
+
+        std::vector<int> corners;
+        MsdfVector previous = edges.back().Direction(1).Normalized();
+        for (int i = 0; i < m; ++i) {
+            MsdfVector next = edges[i].Direction(0).Normalized();
+            if (previous.Dot(next) <= 0 || std::fabs(previous.Cross(next)) > crossThreshold)
+                corners.push_back(i);
+            previous = edges[i].Direction(1).Normalized();
+        }
+
+        if (corners.empty()) {
+            for (int i = 0; i < m; ++i)
+                edges[i].Color = EdgeColorWhite;
+        } else if (corners.size() == 1) {
+            int colors[3] = { EdgeColorWhite, EdgeColorWhite, EdgeColorWhite };
+            MsdfSwitchColor(colors[0], seed);
+            colors[2] = colors[0];
+            MsdfSwitchColor(colors[2], seed);
+            int corner = corners[0];
+            if (m >= 3) {
+                for (int i = 0; i < m; ++i) {
+                    int third = (int) (3 + 2.875 * i / (m - 1) - 1.4375 + 0.5) - 3;
+                    edges[(corner + i) % m].Color = colors[1 + third];
+                }
+            } else {
+                // Too few edges to color; cut each into thirds, starting at the corner.
+                std::vector<EdgeSegment> parts;
+                for (int i = 0; i < m; ++i) {
+                    EdgeSegment first, rest, second, third;
+                    edges[(corner + i) % m].Split(1 / 3.0, first, rest);
+                    rest.Split(0.5, second, third);
+                    parts.push_back(first);
+                    parts.push_back(second);
+                    parts.push_back(third);
+                }
+                for (size_t i = 0; i < parts.size(); ++i)
+                    parts[i].Color = colors[i * 3 / parts.size()];
+                edges = parts;
+            }
+        } else {
+            int cornerCount = corners.size();
+            int spline = 0;
+            int start = corners[0];
+            int color = EdgeColorWhite;
+            MsdfSwitchColor(color, seed);
+            int initialColor = color;
+            for (int i = 0; i < m; ++i) {
+                int index = (start + i) % m;
+                if (spline + 1 < cornerCount && corners[spline + 1] == index) {
+                    ++spline;
+                    MsdfSwitchColor(color, seed, spline == cornerCount - 1 ? initialColor : 0);
+                }
+                edges[index].Color = color;
+            }
+        }
+    }
+}
+
+// Rows come out top-down, with the shape's y axis pointing up.  The range
+// is the distance in texels from the edge to full black or white.
+inline void MsdfGenerator::Generate(const MsdfShape& shape, int width, int height, float range,
+                                    std::vector<unsigned char>& rgba)
+{
+    std::vector<float> distances(width * height * 4);
+    m_shape = &shape;
+    m_width = width;
+    m_height = height;
+    m_distances = &distances;
+
+    const std::vector<MsdfContour>& contours = shape.GetContours();
+    m_contourBounds.assign(contours.size(), MsdfBounds());
+    m_edgeBounds.resize(contours.size());
+    for (size_t c = 0; c < contours.size(); ++c) {
+        const std::vector<EdgeSegment>& edges = contours[c].Edges;
+        m_edgeBounds[c].assign(edges.size(), MsdfBounds());
+        for (size_t e = 0; e < edges.size(); ++e) {
+            for (int i = 0; i <= edges[e].Order; ++i)
+                m_edgeBounds[c][e].Include(edges[e].P[i]);
+            m_contourBounds[c].Include(m_edgeBounds[c][e]);
+        }
+    }
+
+    ParallelFor(height, m_threadCount, *this);
+    CorrectClashes(distances);
+
+    rgba.resize(distances.size());
+    for (size_t i = 0; i < distances.size(); ++i)
+        rgba[i] = QuantizeDistance(distances[i], range);
+}
+
+inline void MsdfGenerator::operator()(int begin, int end)
+{
+    const std::vector<MsdfContour>& contours = m_shape->GetContours();
+    std::vector<std::pair<double, int> > order(contours.size());
+    for (int y = begin; y < end; ++y) {
+        float* out = &(*m_distances)[y * m_width * 4];
+        for (int x = 0; x < m_width; ++x, out += 4) {
+            MsdfVector p(x + 0.5, m_height - y - 0.5);
+            MsdfDistance nearest[4];
+            const EdgeSegment* nearestEdge[3] = { 0, 0, 0 };
+            double nearestParam[3] = { 0, 0, 0 };
+
+            // Visit contours nearest first, and stop once the rest are all
+            // farther away than the worst of the four distances found.
+            for (size_t c = 0; c < contours.size(); ++c)
+                order[c] = std::make_pair(m_contourBounds[c].Distance(p), (int) c);
+            std::sort(order.begin(), order.end());
+            for (size_t i = 0; i < order.size(); ++i) {
+                double farthest = 0;
+                for (int channel = 0; channel < 4; ++channel)
+                    farthest = std::max(farthest, std::fabs(nearest[channel].Distance));
+                if (order[i].first > farthest)
+                    break;
+
+                int c = order[i].second;
+                const std::vector<EdgeSegment>& edges = contours[c].Edges;
+                for (size_t e = 0; e < edges.size(); ++e) {
+                    if (m_edgeBounds[c][e].Distance(p) > farthest)
+                        continue;
+                    double param;
+                    MsdfDistance distance = edges[e].Distance(p, &param);
+                    for (int channel = 0; channel < 3; ++channel) {
+                        if ((edges[e].Color & (1 << channel)) &&
+                            distance.IsCloserThan(nearest[channel])) {
+                            nearest[channel] = distance;
+                            nearestEdge[channel] = &edges[e];
+                            nearestParam[channel] = param;
+                        }
+                    }
+                    if (distance.IsCloserThan(nearest[3]))
+                        nearest[3] = distance;
+                }
+            }
+            for (int channel = 0; channel < 3; ++channel) {
+                if (nearestEdge[channel])
+                    nearestEdge[channel]->ToPseudoDistance(nearest[channel], p,
+                                                           nearestParam[channel]);
+            }
+
+            // Where the median disagrees with the true distance about which
+            // side of the edge the texel is on, trust the true distance.
+            double r = nearest[0].Distance, g = nearest[1].Distance, b = nearest[2].Distance;
+            double median = std::max(std::min(r, g), std::min(std::max(r, g), b));
+            if ((median < 0) != (nearest[3].Distance < 0))
+                r = g = b = nearest[3].Distance;
+            out[0] = (float) r;
+            out[1] = (float) g;
+            out[2] = (float) b;
+            out[3] = (float) nearest[3].Distance;
+        }
+    }
+}
+
+// Two neighboring texels whose channels disagree by more than a texel's
+// worth of distance in two channels would interpolate into a spurious edge
+// between them.  The texel farther from the real edge gets flattened to its
+// median, as in msdfgen's error correction.
+inline void MsdfGenerator::CorrectClashes(std::vector<float>& distances) const
+{
+    const float Threshold = 1.001f;
+    std::vector<bool> clashes(m_width * m_height, false);
+    for (int y = 0; y < m_height; ++y) {
+        for (int x = 0; x < m_width; ++x) {
+            const float* a = &distances[(y * m_width + x) * 4];
+            for (int neighbor = 0; neighbor < 4; ++neighbor) {
+                int nx = x + (neighbor == 0) - (neighbor == 1);
+                int ny = y + (neighbor == 2) - (neighbor == 3);
+                if (nx < 0 || ny < 0 || nx >= m_width || ny >= m_height)
+                    continue;
+                const float* b = &distances[(ny * m_width + nx) * 4];
+                float d[3], from[3], to[3];
+                for (int i = 0; i < 3; ++i) {
+                    from[i] = a[i];
+                    to[i] = b[i];
+                    d[i] = std::fabs(b[i] - a[i]);
+                }
+                // Sort channels by how much they change, largest first.
+                for (int i = 0; i < 2; ++i) {
+                    for (int j = 2; j > i; --j) {
+                        if (d[j] > d[j - 1]) {
+                            std::swap(d[j], d[j - 1]);
+                            std::swap(from[j], from[j - 1]);
+                            std::swap(to[j], to[j - 1]);
+                        }
+                    }
+                }
+                bool equalized = to[0] == to[1] && to[0] == to[2];
+                if (d[1] >= Threshold && !equalized && std::fabs(from[2]) >= std::fabs(to[2]))
+                    clashes[y * m_width + x] = true;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < clashes.size(); ++i) {
+        if (!clashes[i])
+            continue;
+        float* texel = &distances[i * 4];
+        float median = std::max(std::min(texel[0], texel[1]),
+                                std::min(std::max(texel[0], texel[1]), texel[2]));
+        texel[0] = texel[1] = texel[2] = median;
+    }
+}
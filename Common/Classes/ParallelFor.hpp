@@ -0,0 +1,56 @@
+#pragma once
+#include <pthread.h>
+#include <unistd.h>
+#include <vector>
+
+// Minimal fork-join helper for the offline tools.  ParallelFor splits
+// [0, count) into one contiguous range per thread and calls job(begin, end)
+// on each; the calling thread takes the first range.  Ranges must not write
+// to shared state.
+
+template <class Job>
+struct ParallelForRange {
+    Job* Work;
+    int Begin;
+    int End;
+};
+
+template <class Job>
+void* ParallelForThread(void* context)
+{
+    ParallelForRange<Job>* range = (ParallelForRange<Job>*) context;
+    (*range->Work)(range->Begin, range->End);
+    return 0;
+}
+
+template <class Job>
+void ParallelFor(int count, int threadCount, Job& job)
+{
+    if (threadCount > count)
+        threadCount = count;
+    if (threadCount <= 1) {
+        if (count > 0)
+            job(0, count);
+        return;
+    }
+
+    std::vector<ParallelForRange<Job> > ranges(threadCount);
+    std::vector<pthread_t> threads(threadCount);
+    for (int i = 0; i < threadCount; ++i) {
+        ranges[i].Work = &job;
+        ranges[i].Begin = (int) ((long long) count * i / threadCount);
+        ranges[i].End = (int) ((long long) count * (i + 1) / threadCount);
+    }
+
+    for (int i = 1; i < threadCount; ++i)
+        pthread_create(&threads[i], 0, ParallelForThread<Job>, &ranges[i]);
+    job(ranges[0].Begin, ranges[0].End);
+    for (int i = 1; i < threadCount; ++i)
+        pthread_join(threads[i], 0);
+}
+
+inline int GetProcessorCount()
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int) count : 1;
+}
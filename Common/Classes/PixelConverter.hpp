@@ -0,0 +1,218 @@
+#pragma once
+#include "MipChain.hpp"
+#include "PvrTexture.hpp"
+#include <cmath>
+#include <vector>
+
+// Quantizes linear float images into the uncompressed PVR pixel types, with
+// optional 4x4 ordered dithering, and unpacks them again for comparison.
+
+struct ConvertOptions {
+    ConvertOptions() : Dither(false), Srgb(true), IntensityFromAlpha(false) {}
+    bool Dither;
+    bool Srgb;
+    bool IntensityFromAlpha;
+};
+
+class PixelConverter {
+public:
+    PixelConverter(const ConvertOptions& options) : m_options(options) {}
+    static bool IsSupported(PvrPixelType type);
+    void Convert(const FloatImage& image, PvrPixelType type,
+                 std::vector<unsigned char>& output) const;
+private:
+    unsigned int Quantize(float value, int bits, int x, int y) const;
+    float Encode(float linear) const;
+    ConvertOptions m_options;
+};
+
+inline bool PixelConverter::IsSupported(PvrPixelType type)
+{
+    switch (type) {
+        case PvrPixelTypeRgba4444:
+        case PvrPixelTypeRgba5551:
+        case PvrPixelTypeRgba8888:
+        case PvrPixelTypeRgb565:
+        case PvrPixelTypeRgb888:
+        case PvrPixelTypeI8:
+        case PvrPixelTypeAi88:
+            return true;
+        default:
+            return false;
+    }
+}
+
+inline float PixelConverter::Encode(float linear) const
+{
+    return m_options.Srgb ? LinearToSrgb(linear) : linear;
+}
+
+inline unsigned int PixelConverter::Quantize(float value, int bits, int x, int y) const
+{
+    static const unsigned char Bayer[4][4] = {
+        {  0,  8,  2, 10 },
+        { 12,  4, 14,  6 },
+        {  3, 11,  1,  9 },
+        { 15,  7, 13,  5 },
+    };
+    unsigned int maxValue = (1 << bits) - 1;
+    float bias = m_options.Dither ? (Bayer[y & 3][x & 3] + 0.5f) / 16.0f : 0.5f;
+    float scaled = value * maxValue + bias;
+    if (scaled <= 0)
+        return 0;
+    unsigned int q = (unsigned int) scaled;
+    return q > maxValue ? maxValue : q;
+}
+
+inline void PixelConverter::Convert(const FloatImage& image, PvrPixelType type,
+                                    std::vector<unsigned char>& output) const
+{
+    int bytesPerPixel = PvrTexture::GetBitsPerPixel(type) / 8;
+    output.resize(image.Width * image.Height * bytesPerPixel);
+    unsigned char* out = output.empty() ? 0 : &output[0];
+
+    for (int y = 0; y < image.Height; ++y) {
+        for (int x = 0; x < image.Width; ++x) {
+            const float* texel = image.Texel(x, y);
+            float r = Encode(texel[0]);
+            float g = Encode(texel[1]);
+            float b = Encode(texel[2]);
+            float a = texel[3];
+            float luminance = Encode(0.2126f * texel[0] + 0.7152f * texel[1] +
+                                     0.0722f * texel[2]);
+
+            unsigned int packed;
+            switch (type) {
+                case PvrPixelTypeRgb565:
+                    packed = Quantize(r, 5, x, y) << 11 |
+                             Quantize(g, 6, x, y) << 5 |
+                             Quantize(b, 5, x, y);
+                    *out++ = packed & 0xff;
+                    *out++ = packed >> 8;
+                    break;
+                case PvrPixelTypeRgba4444:
+                    packed = Quantize(r, 4, x, y) << 12 |
+                             Quantize(g, 4, x, y) << 8 |
+                             Quantize(b, 4, x, y) << 4 |
+                             Quantize(a, 4, x, y);
+                    *out++ = packed & 0xff;
+                    *out++ = packed >> 8;
+                    break;
+                case PvrPixelTypeRgba5551:
+                    packed = Quantize(r, 5, x, y) << 11 |
+                             Quantize(g, 5, x, y) << 6 |
+                             Quantize(b, 5, x, y) << 1 |
+                             Quantize(a, 1, x, y);
+                    *out++ = packed & 0xff;
+                    *out++ = packed >> 8;
+                    break;
+                case PvrPixelTypeAi88:
+                    *out++ = Quantize(luminance, 8, x, y);
+                    *out++ = Quantize(a, 8, x, y);
+                    break;
+                case PvrPixelTypeI8:
+                    *out++ = Quantize(m_options.IntensityFromAlpha ? a : luminance, 8, x, y);
+                    break;
+                case PvrPixelTypeRgb888:
+                    *out++ = Quantize(r, 8, x, y);
+                    *out++ = Quantize(g, 8, x, y);
+                    *out++ = Quantize(b, 8, x, y);
+                    break;
+                case PvrPixelTypeRgba8888:
+                default:
+                    *out++ = Quantize(r, 8, x, y);
+                    *out++ = Quantize(g, 8, x, y);
+                    *out++ = Quantize(b, 8, x, y);
+                    *out++ = Quantize(a, 8, x, y);
+                    break;
+            }
+        }
+    }
+}
+
+// The inverse of Convert, for checking cooked textures: widens one level of
+// an uncompressed pixel type back to 8-bit RGBA by bit replication.
+inline bool UnpackPixels(const unsigned char* data, int width, int height,
+                         PvrPixelType type, std::vector<unsigned char>& rgba)
+{
+    if (!PixelConverter::IsSupported(type) && type != PvrPixelTypeBgra8888)
+        return false;
+
+    rgba.resize(width * height * 4);
+    unsigned char* out = &rgba[0];
+    for (int i = 0; i < width * height; ++i, out += 4) {
+        unsigned int packed = data[0] | data[1] << 8;
+        switch (type) {
+            case PvrPixelTypeRgb565:
+                out[0] = (packed >> 11) << 3 | (packed >> 13);
+                out[1] = ((packed >> 5) & 0x3f) << 2 | ((packed >> 9) & 0x3);
+                out[2] = (packed & 0x1f) << 3 | ((packed >> 2) & 0x7);
+                out[3] = 255;
+                data += 2;
+                break;
+            case PvrPixelTypeRgba4444:
+                out[0] = (packed >> 12) * 17;
+                out[1] = ((packed >> 8) & 0xf) * 17;
+                out[2] = ((packed >> 4) & 0xf) * 17;
+                out[3] = (packed & 0xf) * 17;
+                data += 2;
+                break;
+            case PvrPixelTypeRgba5551:
+                out[0] = (packed >> 11) << 3 | (packed >> 13);
+                out[1] = ((packed >> 6) & 0x1f) << 3 | ((packed >> 8) & 0x7);
+                out[2] = ((packed >> 1) & 0x1f) << 3 | ((packed >> 3) & 0x7);
+                out[3] = (packed & 1) ? 255 : 0;
+                data += 2;
+                break;
+            case PvrPixelTypeAi88:
+                out[0] = out[1] = out[2] = data[0];
+                out[3] = data[1];
+                data += 2;
+                break;
+            case PvrPixelTypeI8:
+                out[0] = out[1] = out[2] = out[3] = data[0];
+                data += 1;
+                break;
+            case PvrPixelTypeRgb888:
+                out[0] = data[0];
+                out[1] = data[1];
+                out[2] = data[2];
+                out[3] = 255;
+                data += 3;
+                break;
+            case PvrPixelTypeBgra8888:
+                out[0] = data[2];
+                out[1] = data[1];
+                out[2] = data[0];
+                out[3] = data[3];
+                data += 4;
+                break;
+            default:
+                out[0] = data[0];
+                out[1] = data[1];
+                out[2] = data[2];
+                out[3] = data[3];
+                data += 4;
+                break;
+        }
+    }
+    return true;
+}
+
+// Peak signal-to-noise ratio over the first channelCount channels of two
+// RGBA8 images, in decibels.  Identical images report 99 dB.
+inline double ComputePsnr(const unsigned char* a, const unsigned char* b,
+                          int texelCount, int channelCount = 3)
+{
+    double sum = 0;
+    for (int i = 0; i < texelCount; ++i, a += 4, b += 4) {
+        for (int c = 0; c < channelCount; ++c) {
+            double d = a[c] - b[c];
+            sum += d * d;
+        }
+    }
+    if (sum == 0)
+        return 99;
+    double mse = sum / ((double) texelCount * channelCount);
+    return 10 * std::log10(255.0 * 255.0 / mse);
+}
@@ -0,0 +1,245 @@
+#pragma once
+#include "MonotonicClock.hpp"
+#include <algorithm>
+#include <pthread.h>
+#include <stdint.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Scoped CPU zones for finding out where frame time goes.  Each zone is a
+// begin and end time in nanoseconds, written when it goes out of scope into
+// a ring that belongs to the calling thread, so recording never takes a
+// lock.  Zones nest just by being inside each other, and the trace can be
+// written in Chrome's trace event format and opened with chrome://tracing.
+// Around OpenGL calls, zones measure the CPU side only, since the driver
+// usually returns long before the GPU has done the work.
+//
+//     PROFILE_ZONE("Blur");       times the rest of the enclosing scope
+//     PROFILE_FRAME();            ends a frame; see PROFILER_TRACE_FRAMES
+//     PROFILE_THREAD("Loader");   names the calling thread in the trace
+//
+// Everything is compiled out unless ENABLE_PROFILER is defined.  Zone names
+// must be string literals, since only the pointers get stored.
+
+#ifndef PROFILER_RING_SIZE
+#define PROFILER_RING_SIZE 16384
+#endif
+
+// The trace is written once, after this many frames, to trace.json in
+// $TMPDIR, which is the application's tmp folder on the iPhone.  Zero
+// leaves it to whoever calls WriteTrace.
+#ifndef PROFILER_TRACE_FRAMES
+#define PROFILER_TRACE_FRAMES 300
+#endif
+
+#define PROFILE_CONCAT2(a, b) a ## b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT2(a, b)
+
+#ifdef ENABLE_PROFILER
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_FRAME() Profiler::Get().EndFrame()
+#define PROFILE_THREAD(name) Profiler::Get().NameThread(name)
+#else
+#define PROFILE_ZONE(name)
+#define PROFILE_FRAME()
+#define PROFILE_THREAD(name)
+#endif
+
+// Publishes the event before the count that covers it.  x86 keeps stores
+// in order anyway, so there it only has to stop the compiler.
+#if defined(__i386__) || defined(__x86_64__)
+#define PROFILE_RELEASE() __asm__ __volatile__("" ::: "memory")
+#else
+#define PROFILE_RELEASE() __sync_synchronize()
+#endif
+
+struct ProfileEvent {
+    const char* Name;
+    uint64_t Begin;
+    uint64_t End;
+};
+
+// Only the owning thread writes.  Readers copy what's there, then check
+// the count again and drop whatever got overwritten in the meantime.
+class ProfileRing {
+public:
+    ProfileRing(int threadId) :
+        m_events(PROFILER_RING_SIZE),
+        m_written(0),
+        m_threadId(threadId),
+        m_name(0)
+    {
+    }
+    void Add(const char* name, uint64_t begin, uint64_t end)
+    {
+        ProfileEvent& event = m_events[m_written & Mask];
+        event.Name = name;
+        event.Begin = begin;
+        event.End = end;
+        PROFILE_RELEASE();
+        m_written = m_written + 1;
+    }
+    void Read(std::vector<ProfileEvent>& events) const;
+    int GetThreadId() const { return m_threadId; }
+    const char* GetName() const { return m_name; }
+    void SetName(const char* name) { m_name = name; }
+private:
+    static const unsigned int Mask = PROFILER_RING_SIZE - 1;
+    std::vector<ProfileEvent> m_events;
+    volatile unsigned int m_written;
+    int m_threadId;
+    const char* m_name;
+    char m_padding[64];     // keeps other threads' rings off this cache line
+};
+
+// Appends the events that are still in the ring, oldest first.
+inline void ProfileRing::Read(std::vector<ProfileEvent>& events) const
+{
+    unsigned int end = m_written;
+    __sync_synchronize();
+    unsigned int begin = end > PROFILER_RING_SIZE ? end - PROFILER_RING_SIZE : 0;
+    size_t first = events.size();
+    for (unsigned int i = begin; i != end; ++i)
+        events.push_back(m_events[i & Mask]);
+
+    // The writer may be inside Add, filling slot written & Mask, which holds
+    // the event at written - PROFILER_RING_SIZE.  That one might be torn, so
+    // it goes too.
+    __sync_synchronize();
+    unsigned int written = m_written;
+    unsigned int overwritten = written + 1 - begin > PROFILER_RING_SIZE ?
+                               written + 1 - begin - PROFILER_RING_SIZE : 0;
+    if (overwritten)
+        events.erase(events.begin() + first,
+                     events.begin() + first + std::min<size_t>(overwritten, end - begin));
+}
+
+class Profiler {
+public:
+    static Profiler& Get()
+    {
+        static Profiler profiler;
+        return profiler;
+    }
+    ProfileRing* GetRing()
+    {
+        ProfileRing* ring = (ProfileRing*) pthread_getspecific(m_key);
+        return ring ? ring : AddRing();
+    }
+    void NameThread(const char* name) { GetRing()->SetName(name); }
+    void EndFrame();
+    int GetFrameCount() const { return m_frameCount; }
+    bool WriteTrace(const char* path);
+    void WriteTrace(FILE* file);
+private:
+    Profiler();
+    ProfileRing* AddRing();
+    pthread_key_t m_key;
+    pthread_mutex_t m_mutex;
+    std::vector<ProfileRing*> m_rings;
+    uint64_t m_origin;
+    uint64_t m_frameStart;
+    int m_frameCount;
+};
+
+// Zones are usually made by PROFILE_ZONE rather than directly.  The ring
+// gets looked up before the clock is read, so that's left out of the zone.
+class ProfileZone {
+public:
+    ProfileZone(const char* name) :
+        m_ring(Profiler::Get().GetRing()),
+        m_name(name),
+        m_begin(GetMonotonicNanoseconds())
+    {
+    }
+    ~ProfileZone() { m_ring->Add(m_name, m_begin, GetMonotonicNanoseconds()); }
+private:
+    ProfileRing* m_ring;
+    const char* m_name;
+    uint64_t m_begin;
+};
+
+// Rings belong to the profiler rather than their threads, so the zones of
+// threads that have finished still make it into the trace.
+inline Profiler::Profiler() : m_frameCount(0)
+{
+    pthread_key_create(&m_key, 0);
+    pthread_mutex_init(&m_mutex, 0);
+    m_origin = m_frameStart = GetMonotonicNanoseconds();
+}
+
+inline ProfileRing* Profiler::AddRing()
+{
+    pthread_mutex_lock(&m_mutex);
+    ProfileRing* ring = new ProfileRing((int) m_rings.size() + 1);
+    m_rings.push_back(ring);
+    pthread_mutex_unlock(&m_mutex);
+    pthread_setspecific(m_key, ring);
+    return ring;
+}
+
+// Each frame is a zone of its own, from the end of the previous one.
+inline void Profiler::EndFrame()
+{
+    uint64_t now = GetMonotonicNanoseconds();
+    GetRing()->Add("Frame", m_frameStart, now);
+    m_frameStart = now;
+    if (++m_frameCount != PROFILER_TRACE_FRAMES)
+        return;
+
+    const char* folder = getenv("TMPDIR");
+    std::string path = std::string(folder ? folder : "/tmp") + "/trace.json";
+    if (WriteTrace(path.c_str()))
+        printf("Wrote %d frames of zones to %s\n", m_frameCount, path.c_str());
+}
+
+inline bool Profiler::WriteTrace(const char* path)
+{
+    FILE* file = fopen(path, "w");
+    if (!file)
+        return false;
+    WriteTrace(file);
+    fclose(file);
+    return true;
+}
+
+// Complete ("X") events, with times in microseconds since the profiler
+// started.  The names are literals from the code, so they only need their
+// quotes and backslashes escaping.
+inline void Profiler::WriteTrace(FILE* file)
+{
+    pthread_mutex_lock(&m_mutex);
+    std::vector<ProfileRing*> rings(m_rings);
+    pthread_mutex_unlock(&m_mutex);
+
+    fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    const char* separator = "";
+    std::vector<ProfileEvent> events;
+    for (size_t i = 0; i < rings.size(); ++i) {
+        const ProfileRing& ring = *rings[i];
+        int tid = ring.GetThreadId();
+        if (ring.GetName()) {
+            fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+                    "\"args\":{\"name\":\"%s\"}}", separator, tid, ring.GetName());
+            separator = ",\n";
+        }
+
+        events.clear();
+        ring.Read(events);
+        for (size_t j = 0; j < events.size(); ++j) {
+            const ProfileEvent& event = events[j];
+            fprintf(file, "%s{\"name\":\"", separator);
+            for (const char* c = event.Name; *c; ++c) {
+                if (*c == '"' || *c == '\\')
+                    fputc('\\', file);
+                fputc(*c, file);
+            }
+            fprintf(file, "\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    tid, (event.Begin - m_origin) * 1e-3, (event.End - event.Begin) * 1e-3);
+            separator = ",\n";
+        }
+    }
+    fprintf(file, "\n]}\n");
+}
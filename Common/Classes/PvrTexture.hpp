@@ -0,0 +1,345 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+
+// Reader for the legacy PowerVR texture container (the 44-byte v1 header and
+// the 52-byte v2 header) that PVRTexTool, texturetool, and Filewrap produce.
+//
+// Nothing is copied: levels are handed out as pointers into the caller's blob,
+// which can be an array compiled into the binary or a memory-mapped file.  The
+// blob must outlive the PvrTexture that parsed it.
+
+struct PvrHeader {
+    unsigned int HeaderSize;
+    unsigned int Height;
+    unsigned int Width;
+    unsigned int MipMapCount;
+    unsigned int Flags;
+    unsigned int TextureDataSize;
+    unsigned int BitCount;
+    unsigned int RBitMask;
+    unsigned int GBitMask;
+    unsigned int BBitMask;
+    unsigned int AlphaBitMask;
+    unsigned int PVR;
+    unsigned int NumSurfs;
+};
+
+enum PvrPixelType {
+    PvrPixelTypeRgba4444 = 0x10,
+    PvrPixelTypeRgba5551,
+    PvrPixelTypeRgba8888,
+    PvrPixelTypeRgb565,
+    PvrPixelTypeRgb555,
+    PvrPixelTypeRgb888,
+    PvrPixelTypeI8,
+    PvrPixelTypeAi88,
+    PvrPixelTypePvrtc2,
+    PvrPixelTypePvrtc4,
+    PvrPixelTypeBgra8888,
+    PvrPixelTypeEtc1 = 0x36,
+
+    // PVRTexTool's legacy header has no ETC2 codes, so these two are private
+    // to TextureCooker and the loaders in this tree.
+    PvrPixelTypeEtc2Rgb = 0xe0,
+    PvrPixelTypeEtc2Rgba,
+};
+
+enum PvrFlags {
+    PvrFlagsPixelType = 0xff,
+    PvrFlagsMipMap = 1 << 8,
+    PvrFlagsTwiddle = 1 << 9,
+    PvrFlagsBumpMap = 1 << 10,
+    PvrFlagsTiling = 1 << 11,
+    PvrFlagsCubeMap = 1 << 12,
+    PvrFlagsFalseMipColors = 1 << 13,
+    PvrFlagsVolume = 1 << 14,
+    PvrFlagsAlpha = 1 << 15,
+    PvrFlagsVerticalFlip = 1 << 16,
+};
+
+enum PvrError {
+    PvrErrorNone,
+    PvrErrorTruncatedHeader,
+    PvrErrorHeaderSize,
+    PvrErrorIdentifier,
+    PvrErrorPixelType,
+    PvrErrorUnsupported,
+    PvrErrorDimensions,
+    PvrErrorMipMapCount,
+    PvrErrorSurfaceCount,
+    PvrErrorDataSize,
+    PvrErrorTruncatedData,
+};
+
+const unsigned int PvrIdentifier = 0x21525650;
+const unsigned int PvrHeaderSizeV1 = 44;
+const unsigned int PvrHeaderSizeV2 = 52;
+
+struct PvrLevel {
+    const unsigned char* Data;
+    size_t Size;
+    int Width;
+    int Height;
+};
+
+class PvrTexture {
+public:
+    static const int MaxDimension = 8192;
+    static const int MaxLevels = 14;
+    static const int MaxSurfaces = 6;
+    static const size_t UnknownSize = ~(size_t) 0;
+    PvrTexture();
+    PvrError Parse(const void* blob, size_t blobSize = UnknownSize);
+    PvrError ParseHeaderless(const void* data, size_t dataSize,
+                             PvrPixelType type, int width, int height);
+    bool IsValid() const { return m_error == PvrErrorNone; }
+    PvrError GetError() const { return m_error; }
+    const PvrHeader& GetHeader() const { return m_header; }
+    PvrPixelType GetPixelType() const;
+    int GetWidth() const { return m_header.Width; }
+    int GetHeight() const { return m_header.Height; }
+    int GetLevelCount() const { return m_levelCount; }
+    int GetSurfaceCount() const { return m_surfaceCount; }
+    bool IsCompressed() const;
+    bool HasAlpha() const;
+    bool IsVerticallyFlipped() const;
+    PvrLevel GetLevel(int level, int surface = 0) const;
+    const unsigned char* GetData() const { return m_data; }
+    size_t GetDataSize() const { return m_surfaceSize * m_surfaceCount; }
+    static bool IsKnownPixelType(unsigned int type);
+    static int GetBitsPerPixel(PvrPixelType type);
+    static size_t ComputeLevelSize(PvrPixelType type, int width, int height);
+    static const char* GetErrorString(PvrError error);
+private:
+    PvrError Validate(size_t dataSize);
+    PvrError Fail(PvrError error);
+    PvrHeader m_header;
+    PvrError m_error;
+    const unsigned char* m_data;
+    int m_levelCount;
+    int m_surfaceCount;
+    size_t m_surfaceSize;
+    size_t m_levelOffsets[MaxLevels];
+};
+
+inline PvrTexture::PvrTexture()
+{
+    memset(&m_header, 0, sizeof(m_header));
+    m_error = PvrErrorTruncatedHeader;
+    m_data = 0;
+    m_levelCount = 0;
+    m_surfaceCount = 0;
+    m_surfaceSize = 0;
+}
+
+inline PvrError PvrTexture::Parse(const void* blob, size_t blobSize)
+{
+    memset(&m_header, 0, sizeof(m_header));
+    if (!blob || blobSize < PvrHeaderSizeV1)
+        return Fail(PvrErrorTruncatedHeader);
+
+    // The blob might not be word-aligned, so copy the header out.
+    memcpy(&m_header, blob, PvrHeaderSizeV1);
+    unsigned int headerSize = m_header.HeaderSize;
+    if (headerSize != PvrHeaderSizeV1 && headerSize != PvrHeaderSizeV2)
+        return Fail(PvrErrorHeaderSize);
+    if (blobSize < headerSize)
+        return Fail(PvrErrorTruncatedHeader);
+
+    if (headerSize == PvrHeaderSizeV2) {
+        memcpy(&m_header, blob, PvrHeaderSizeV2);
+        if (m_header.PVR != PvrIdentifier)
+            return Fail(PvrErrorIdentifier);
+    }
+
+    m_data = (const unsigned char*) blob + headerSize;
+    size_t dataSize = blobSize == UnknownSize ? UnknownSize : blobSize - headerSize;
+    return Validate(dataSize);
+}
+
+inline PvrError PvrTexture::ParseHeaderless(const void* data, size_t dataSize,
+                                            PvrPixelType type, int width, int height)
+{
+    memset(&m_header, 0, sizeof(m_header));
+    if (!data)
+        return Fail(PvrErrorTruncatedData);
+
+    m_header.Width = width;
+    m_header.Height = height;
+    m_header.Flags = type;
+    m_header.NumSurfs = 1;
+    m_data = (const unsigned char*) data;
+    return Validate(dataSize);
+}
+
+inline PvrError PvrTexture::Validate(size_t dataSize)
+{
+    const PvrHeader& header = m_header;
+
+    unsigned int type = header.Flags & PvrFlagsPixelType;
+    if (!IsKnownPixelType(type))
+        return Fail(PvrErrorPixelType);
+    if (type == PvrPixelTypeRgb555 || (header.Flags & PvrFlagsVolume))
+        return Fail(PvrErrorUnsupported);
+
+    if (header.Width == 0 || header.Height == 0 ||
+        header.Width > (unsigned int) MaxDimension ||
+        header.Height > (unsigned int) MaxDimension)
+        return Fail(PvrErrorDimensions);
+
+    // PVRTC blocks wrap around the texture edges, so the hardware only
+    // accepts power-of-two sizes.  ETC blocks don't.
+    bool pot = !(header.Width & (header.Width - 1)) &&
+               !(header.Height & (header.Height - 1));
+    PvrPixelType pixelType = (PvrPixelType) type;
+    bool pvrtc = pixelType == PvrPixelTypePvrtc2 || pixelType == PvrPixelTypePvrtc4;
+    if (pvrtc && !pot)
+        return Fail(PvrErrorDimensions);
+
+    // MipMapCount excludes the base level.
+    unsigned int largest = header.Width > header.Height ? header.Width : header.Height;
+    int maxLevels = 1;
+    while (largest >>= 1)
+        maxLevels++;
+    if (header.MipMapCount >= (unsigned int) maxLevels)
+        return Fail(PvrErrorMipMapCount);
+    m_levelCount = header.MipMapCount + 1;
+
+    if (header.NumSurfs > (unsigned int) MaxSurfaces)
+        return Fail(PvrErrorSurfaceCount);
+    if (header.Flags & PvrFlagsCubeMap)
+        m_surfaceCount = 6;
+    else
+        m_surfaceCount = header.NumSurfs ? header.NumSurfs : 1;
+
+    m_surfaceSize = 0;
+    for (int level = 0; level < m_levelCount; ++level) {
+        int w = header.Width >> level;
+        int h = header.Height >> level;
+        m_levelOffsets[level] = m_surfaceSize;
+        m_surfaceSize += ComputeLevelSize(pixelType, w ? w : 1, h ? h : 1);
+    }
+
+    // Some exporters count one surface in TextureDataSize and some count all
+    // of them, so accept either.
+    size_t totalSize = m_surfaceSize * m_surfaceCount;
+    if (header.TextureDataSize && header.TextureDataSize != m_surfaceSize &&
+        header.TextureDataSize != totalSize)
+        return Fail(PvrErrorDataSize);
+
+    if (dataSize != UnknownSize && dataSize < totalSize)
+        return Fail(PvrErrorTruncatedData);
+
+    m_error = PvrErrorNone;
+    return m_error;
+}
+
+inline PvrError PvrTexture::Fail(PvrError error)
+{
+    m_error = error;
+    m_data = 0;
+    m_levelCount = 0;
+    m_surfaceCount = 0;
+    m_surfaceSize = 0;
+    return error;
+}
+
+inline PvrPixelType PvrTexture::GetPixelType() const
+{
+    return (PvrPixelType) (m_header.Flags & PvrFlagsPixelType);
+}
+
+inline bool PvrTexture::IsCompressed() const
+{
+    PvrPixelType type = GetPixelType();
+    return type == PvrPixelTypePvrtc2 || type == PvrPixelTypePvrtc4 ||
+           type == PvrPixelTypeEtc1 || type == PvrPixelTypeEtc2Rgb ||
+           type == PvrPixelTypeEtc2Rgba;
+}
+
+inline bool PvrTexture::HasAlpha() const
+{
+    return m_header.AlphaBitMask || (m_header.Flags & PvrFlagsAlpha);
+}
+
+inline bool PvrTexture::IsVerticallyFlipped() const
+{
+    return (m_header.Flags & PvrFlagsVerticalFlip) ? true : false;
+}
+
+inline PvrLevel PvrTexture::GetLevel(int level, int surface) const
+{
+    assert(IsValid());
+    assert(level >= 0 && level < m_levelCount);
+    assert(surface >= 0 && surface < m_surfaceCount);
+
+    PvrLevel result;
+    result.Width = m_header.Width >> level;
+    result.Height = m_header.Height >> level;
+    result.Width = result.Width ? result.Width : 1;
+    result.Height = result.Height ? result.Height : 1;
+    result.Size = ComputeLevelSize(GetPixelType(), result.Width, result.Height);
+    result.Data = m_data + surface * m_surfaceSize + m_levelOffsets[level];
+    return result;
+}
+
+inline bool PvrTexture::IsKnownPixelType(unsigned int type)
+{
+    return (type >= PvrPixelTypeRgba4444 && type <= PvrPixelTypeBgra8888) ||
+           type == PvrPixelTypeEtc1 || type == PvrPixelTypeEtc2Rgb ||
+           type == PvrPixelTypeEtc2Rgba;
+}
+
+inline int PvrTexture::GetBitsPerPixel(PvrPixelType type)
+{
+    switch (type) {
+        case PvrPixelTypePvrtc2: return 2;
+        case PvrPixelTypePvrtc4:
+        case PvrPixelTypeEtc1:
+        case PvrPixelTypeEtc2Rgb: return 4;
+        case PvrPixelTypeI8:
+        case PvrPixelTypeEtc2Rgba: return 8;
+        case PvrPixelTypeRgb888: return 24;
+        case PvrPixelTypeRgba8888:
+        case PvrPixelTypeBgra8888: return 32;
+        default: return 16;
+    }
+}
+
+inline size_t PvrTexture::ComputeLevelSize(PvrPixelType type, int width, int height)
+{
+    // PVRTC levels are padded out to a minimum of two blocks by two blocks.
+    if (type == PvrPixelTypePvrtc4) {
+        width = width > 8 ? width : 8;
+        height = height > 8 ? height : 8;
+    } else if (type == PvrPixelTypePvrtc2) {
+        width = width > 16 ? width : 16;
+        height = height > 8 ? height : 8;
+    } else if (type == PvrPixelTypeEtc1 || type == PvrPixelTypeEtc2Rgb ||
+               type == PvrPixelTypeEtc2Rgba) {
+        // ETC levels are a whole number of 4x4 blocks.
+        width = (width + 3) & ~3;
+        height = (height + 3) & ~3;
+    }
+    return (size_t) width * height * GetBitsPerPixel(type) / 8;
+}
+
+inline const char* PvrTexture::GetErrorString(PvrError error)
+{
+    switch (error) {
+        case PvrErrorNone: return "No error";
+        case PvrErrorTruncatedHeader: return "Truncated header";
+        case PvrErrorHeaderSize: return "Unrecognized header size";
+        case PvrErrorIdentifier: return "Missing PVR identifier";
+        case PvrErrorPixelType: return "Unknown pixel type";
+        case PvrErrorUnsupported: return "Unsupported pixel type or layout";
+        case PvrErrorDimensions: return "Invalid dimensions";
+        case PvrErrorMipMapCount: return "Too many mip levels";
+        case PvrErrorSurfaceCount: return "Too many surfaces";
+        case PvrErrorDataSize: return "Inconsistent data size";
+        case PvrErrorTruncatedData: return "Truncated texel data";
+    }
+    return "Unknown error";
+}
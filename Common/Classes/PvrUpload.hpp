@@ -0,0 +1,145 @@
+#pragma once
+#include "PvrTexture.hpp"
+#include "TextureSet.hpp"
+#include <cstring>
+
+// Uploads every mip level of a parsed PVR surface straight out of its blob.
+// Include the ES1 or ES2 headers (including glext.h) before this file.
+
+// Older SDKs don't declare the ETC tokens.
+#ifndef GL_ETC1_RGB8_OES
+#define GL_ETC1_RGB8_OES 0x8D64
+#endif
+#ifndef GL_COMPRESSED_RGB8_ETC2
+#define GL_COMPRESSED_RGB8_ETC2 0x9274
+#endif
+#ifndef GL_COMPRESSED_RGBA8_ETC2_EAC
+#define GL_COMPRESSED_RGBA8_ETC2_EAC 0x9278
+#endif
+
+struct PvrGlFormat {
+    GLenum Format;
+    GLenum Type;
+    bool Compressed;
+};
+
+inline bool GetPvrGlFormat(const PvrTexture& texture,
+                           GLenum intensityFormat,
+                           PvrGlFormat* glFormat)
+{
+    glFormat->Compressed = false;
+    glFormat->Type = GL_UNSIGNED_BYTE;
+    bool alpha = texture.HasAlpha();
+
+    switch (texture.GetPixelType()) {
+        case PvrPixelTypeRgba4444:
+            glFormat->Format = GL_RGBA;
+            glFormat->Type = GL_UNSIGNED_SHORT_4_4_4_4;
+            break;
+        case PvrPixelTypeRgba5551:
+            glFormat->Format = GL_RGBA;
+            glFormat->Type = GL_UNSIGNED_SHORT_5_5_5_1;
+            break;
+        case PvrPixelTypeRgb565:
+            glFormat->Format = GL_RGB;
+            glFormat->Type = GL_UNSIGNED_SHORT_5_6_5;
+            break;
+        case PvrPixelTypeRgba8888:
+            glFormat->Format = GL_RGBA;
+            break;
+        case PvrPixelTypeRgb888:
+            glFormat->Format = GL_RGB;
+            break;
+        case PvrPixelTypeI8:
+            glFormat->Format = intensityFormat;
+            break;
+        case PvrPixelTypeAi88:
+            glFormat->Format = GL_LUMINANCE_ALPHA;
+            break;
+#ifdef GL_BGRA_EXT
+        case PvrPixelTypeBgra8888:
+            glFormat->Format = GL_BGRA_EXT;
+            break;
+#endif
+        case PvrPixelTypePvrtc2:
+            glFormat->Compressed = true;
+            glFormat->Format = alpha ? GL_COMPRESSED_RGBA_PVRTC_2BPPV1_IMG :
+                                       GL_COMPRESSED_RGB_PVRTC_2BPPV1_IMG;
+            break;
+        case PvrPixelTypePvrtc4:
+            glFormat->Compressed = true;
+            glFormat->Format = alpha ? GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG :
+                                       GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG;
+            break;
+        case PvrPixelTypeEtc1:
+            glFormat->Compressed = true;
+            glFormat->Format = GL_ETC1_RGB8_OES;
+            break;
+        case PvrPixelTypeEtc2Rgb:
+            glFormat->Compressed = true;
+            glFormat->Format = GL_COMPRESSED_RGB8_ETC2;
+            break;
+        case PvrPixelTypeEtc2Rgba:
+            glFormat->Compressed = true;
+            glFormat->Format = GL_COMPRESSED_RGBA8_ETC2_EAC;
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+// Returns the number of levels uploaded, or zero if the format has no GL
+// equivalent.  Single-channel textures go up as GL_ALPHA unless the caller
+// asks for something else, such as GL_LUMINANCE.
+inline int UploadPvrTexture(const PvrTexture& texture,
+                            GLenum target = GL_TEXTURE_2D,
+                            GLenum intensityFormat = GL_ALPHA,
+                            int surface = 0)
+{
+    PvrGlFormat glFormat;
+    if (!texture.IsValid() || !GetPvrGlFormat(texture, intensityFormat, &glFormat))
+        return 0;
+
+    // PVR rows are tightly packed, which matters for 8- and 24-bit formats.
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    int levelCount = texture.GetLevelCount();
+    for (int level = 0; level < levelCount; ++level) {
+        PvrLevel mip = texture.GetLevel(level, surface);
+        if (glFormat.Compressed)
+            glCompressedTexImage2D(target, level, glFormat.Format,
+                                   mip.Width, mip.Height, 0, mip.Size, mip.Data);
+        else
+            glTexImage2D(target, level, glFormat.Format, mip.Width, mip.Height,
+                         0, glFormat.Format, glFormat.Type, mip.Data);
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    return levelCount;
+}
+
+// Asks the current context which block formats it can sample.  ETC2 is core
+// in ES 3.0, so it is keyed off the version string rather than an extension.
+inline TextureCompressionSupport GetTextureCompressionSupport()
+{
+    TextureCompressionSupport support;
+    const char* extensions = (const char*) glGetString(GL_EXTENSIONS);
+    const char* version = (const char*) glGetString(GL_VERSION);
+    if (extensions) {
+        support.Pvrtc = strstr(extensions, "GL_IMG_texture_compression_pvrtc") != 0;
+        support.Etc1 = strstr(extensions, "GL_OES_compressed_ETC1_RGB8_texture") != 0;
+    }
+    if (version)
+        support.Etc2 = strstr(version, "OpenGL ES 3") != 0;
+    return support;
+}
+
+// Parses a PVR container or texture set, picking the best encoding for the
+// current context.  The query is cheap, but callers loading many textures
+// can hold on to a TextureCompressionSupport and use the overload in
+// TextureSet.hpp instead.
+inline PvrError ParseTextureAsset(const void* blob, size_t blobSize, PvrTexture& texture)
+{
+    return ParseTextureAsset(blob, blobSize, GetTextureCompressionSupport(), texture);
+}
@@ -0,0 +1,179 @@
+#pragma once
+#include "PvrTexture.hpp"
+#include <cstdio>
+#include <vector>
+
+// Builds legacy v2 PVR containers for the offline tools.  The output is laid
+// out exactly the way PvrTexture::Parse expects it: a 52-byte header followed
+// by every mip level of a single surface, largest first.
+
+class PvrWriter {
+public:
+    PvrWriter(PvrPixelType type, int width, int height);
+    void SetVerticallyFlipped(bool flipped) { m_flipped = flipped; }
+    void SetAlpha(bool alpha) { m_alpha = alpha; }
+    void AddLevel(const std::vector<unsigned char>& texels);
+    int GetLevelCount() const { return m_levelCount; }
+    PvrHeader GetHeader() const;
+    void Write(std::vector<unsigned char>& blob) const;
+    bool WriteFile(const char* path) const;
+    bool WriteSource(const char* path, const char* name) const;
+private:
+    static void SetMasks(PvrPixelType type, PvrHeader& header);
+    PvrPixelType m_type;
+    int m_width;
+    int m_height;
+    int m_levelCount;
+    bool m_flipped;
+    bool m_alpha;
+    std::vector<unsigned char> m_data;
+};
+
+inline PvrWriter::PvrWriter(PvrPixelType type, int width, int height)
+    : m_type(type), m_width(width), m_height(height), m_levelCount(0),
+      m_flipped(false), m_alpha(false)
+{
+    switch (type) {
+        case PvrPixelTypeRgba4444:
+        case PvrPixelTypeRgba5551:
+        case PvrPixelTypeRgba8888:
+        case PvrPixelTypeBgra8888:
+        case PvrPixelTypeAi88:
+            m_alpha = true;
+            break;
+        default:
+            break;
+    }
+}
+
+inline void PvrWriter::AddLevel(const std::vector<unsigned char>& texels)
+{
+    int w = m_width >> m_levelCount;
+    int h = m_height >> m_levelCount;
+    size_t expected = PvrTexture::ComputeLevelSize(m_type, w ? w : 1, h ? h : 1);
+    assert(texels.size() == expected && m_levelCount < PvrTexture::MaxLevels);
+    m_data.insert(m_data.end(), texels.begin(), texels.begin() + expected);
+    m_levelCount++;
+}
+
+inline PvrHeader PvrWriter::GetHeader() const
+{
+    PvrHeader header;
+    memset(&header, 0, sizeof(header));
+    header.HeaderSize = PvrHeaderSizeV2;
+    header.Width = m_width;
+    header.Height = m_height;
+    header.MipMapCount = m_levelCount > 0 ? m_levelCount - 1 : 0;
+    header.Flags = m_type;
+    if (m_levelCount > 1)
+        header.Flags |= PvrFlagsMipMap;
+    if (m_alpha)
+        header.Flags |= PvrFlagsAlpha;
+    if (m_flipped)
+        header.Flags |= PvrFlagsVerticalFlip;
+    header.TextureDataSize = m_data.size();
+    header.BitCount = PvrTexture::GetBitsPerPixel(m_type);
+    SetMasks(m_type, header);
+    if (!m_alpha)
+        header.AlphaBitMask = 0;
+    header.PVR = PvrIdentifier;
+    header.NumSurfs = 1;
+    return header;
+}
+
+inline void PvrWriter::SetMasks(PvrPixelType type, PvrHeader& header)
+{
+    switch (type) {
+        case PvrPixelTypeRgba4444:
+            header.RBitMask = 0xf000;
+            header.GBitMask = 0x0f00;
+            header.BBitMask = 0x00f0;
+            header.AlphaBitMask = 0x000f;
+            break;
+        case PvrPixelTypeRgba5551:
+            header.RBitMask = 0xf800;
+            header.GBitMask = 0x07c0;
+            header.BBitMask = 0x003e;
+            header.AlphaBitMask = 0x0001;
+            break;
+        case PvrPixelTypeRgb565:
+            header.RBitMask = 0xf800;
+            header.GBitMask = 0x07e0;
+            header.BBitMask = 0x001f;
+            break;
+        case PvrPixelTypeRgba8888:
+        case PvrPixelTypeRgb888:
+            header.RBitMask = 0x000000ff;
+            header.GBitMask = 0x0000ff00;
+            header.BBitMask = 0x00ff0000;
+            header.AlphaBitMask = 0xff000000;
+            break;
+        case PvrPixelTypeI8:
+        case PvrPixelTypeAi88:
+            header.RBitMask = header.GBitMask = header.BBitMask = 0xff;
+            header.AlphaBitMask = 0xff00;
+            break;
+        default:
+            break;
+    }
+}
+
+inline void PvrWriter::Write(std::vector<unsigned char>& blob) const
+{
+    PvrHeader header = GetHeader();
+    const unsigned char* bytes = (const unsigned char*) &header;
+    blob.assign(bytes, bytes + sizeof(header));
+    blob.insert(blob.end(), m_data.begin(), m_data.end());
+}
+
+inline bool PvrWriter::WriteFile(const char* path) const
+{
+    std::vector<unsigned char> blob;
+    Write(blob);
+    FILE* file = fopen(path, "wb");
+    if (!file)
+        return false;
+    bool ok = fwrite(&blob[0], 1, blob.size(), file) == blob.size();
+    return fclose(file) == 0 && ok;
+}
+
+// Emits the container as a C array of 32-bit words, in the same layout as
+// the headers that PVRTexTool's -h option generates.  The words are written
+// as unsigned int so that the array is not padded out on 64-bit targets.
+inline bool PvrWriter::WriteSource(const char* path, const char* name) const
+{
+    static const char* FieldNames[] = {
+        "dwHeaderSize", "dwHeight", "dwWidth", "dwMipMapCount", "dwpfFlags",
+        "dwDataSize", "dwBitCount", "dwRBitMask", "dwGBitMask", "dwBBitMask",
+        "dwAlphaBitMask", "dwPVR", "dwNumSurfs",
+    };
+
+    FILE* file = fopen(path, "w");
+    if (!file)
+        return false;
+
+    fprintf(file, "// This file was created by TextureCooker.\n");
+    fprintf(file, "// DO NOT EDIT\n\n");
+    fprintf(file, "#ifndef A32BIT\n #define A32BIT static const unsigned int\n#endif\n\n");
+    fprintf(file, "A32BIT %s[] = {\n\n/* Header */\n", name);
+
+    PvrHeader header = GetHeader();
+    const unsigned int* fields = (const unsigned int*) &header;
+    for (int i = 0; i < 13; ++i)
+        fprintf(file, "0x%08x,\t\t/* %s */\n", fields[i], FieldNames[i]);
+
+    fprintf(file, "\n/* Data */\n");
+    std::vector<unsigned char> data(m_data);
+    data.resize((data.size() + 3) & ~3, 0);
+    size_t wordCount = data.size() / 4;
+    for (size_t i = 0; i < wordCount; ++i) {
+        const unsigned char* b = &data[i * 4];
+        unsigned int word = b[0] | b[1] << 8 | b[2] << 16 | (unsigned int) b[3] << 24;
+        fprintf(file, "0x%08x,", word);
+        if (i % 32 == 31 || i + 1 == wordCount)
+            fprintf(file, "\n");
+    }
+
+    fprintf(file, "0 };\n\n");
+    return fclose(file) == 0;
+}
@@ -0,0 +1,833 @@
+#pragma once
+#include "ParallelFor.hpp"
+#include <cmath>
+#include <vector>
+
+// Software PVRTC1 codec, 2 and 4 bits per pixel, for the offline tools.
+//
+// Each 64-bit block holds two low-resolution colors, A and B, plus a
+// modulation value per texel.  The decoder upscales the A and B images
+// bilinearly, anchoring each block's colors at the block's center, and blends
+// between them by the modulation.  Blocks are stored in Morton order and the
+// image wraps around at its edges, which is why PVRTC insists on powers of
+// two.  Levels smaller than two blocks by two blocks are padded out.
+
+struct PvrtcBlock {
+    unsigned int Modulation;
+    unsigned int Color;
+};
+
+// Colors at their native precision: 5-bit RGB and 4-bit alpha.
+struct PvrtcColor {
+    int R, G, B, A;
+};
+
+inline int PvrtcExpand4To5(int c) { return (c << 1) | (c >> 3); }
+inline int PvrtcExpand3To5(int c) { return (c << 2) | (c >> 1); }
+
+inline PvrtcColor PvrtcUnpackColorA(unsigned int color)
+{
+    PvrtcColor c;
+    if (color & 0x8000) {
+        c.R = (color >> 10) & 0x1f;
+        c.G = (color >> 5) & 0x1f;
+        c.B = PvrtcExpand4To5((color >> 1) & 0xf);
+        c.A = 0xf;
+    } else {
+        c.R = PvrtcExpand4To5((color >> 8) & 0xf);
+        c.G = PvrtcExpand4To5((color >> 4) & 0xf);
+        c.B = PvrtcExpand3To5((color >> 1) & 0x7);
+        c.A = ((color >> 12) & 0x7) << 1;
+    }
+    return c;
+}
+
+inline PvrtcColor PvrtcUnpackColorB(unsigned int color)
+{
+    PvrtcColor c;
+    if (color & 0x80000000) {
+        c.R = (color >> 26) & 0x1f;
+        c.G = (color >> 21) & 0x1f;
+        c.B = (color >> 16) & 0x1f;
+        c.A = 0xf;
+    } else {
+        c.R = PvrtcExpand4To5((color >> 24) & 0xf);
+        c.G = PvrtcExpand4To5((color >> 20) & 0xf);
+        c.B = PvrtcExpand4To5((color >> 16) & 0xf);
+        c.A = ((color >> 28) & 0x7) << 1;
+    }
+    return c;
+}
+
+// Per-texel modulation is resolved to a weight from 0 to 8; this flag marks
+// the punch-through texels of 4bpp blocks, which decode with zero alpha.
+const unsigned char PvrtcPunchThrough = 0x10;
+
+// Geometry of one PVRTC level, plus the decoding steps that the encoder
+// shares with the decoder.
+class PvrtcLayout {
+public:
+    PvrtcLayout(int width, int height, int bitsPerPixel);
+    int BlockIndex(int bx, int by) const;
+    unsigned int MortonIndex(int bx, int by) const;
+    void ReadBlocks(const unsigned char* data, std::vector<PvrtcBlock>& blocks) const;
+    void WriteBlocks(const std::vector<PvrtcBlock>& blocks,
+                     std::vector<unsigned char>& data) const;
+    void UnpackColors(const std::vector<PvrtcBlock>& blocks,
+                      std::vector<PvrtcColor>& colorsA,
+                      std::vector<PvrtcColor>& colorsB) const;
+    void InterpolateRows(const PvrtcColor* colors, int firstRow, int lastRow,
+                         unsigned char* rgba) const;
+    void UnpackModulation(const PvrtcBlock* blocks, int firstBlockRow, int lastBlockRow,
+                          unsigned char* values, unsigned char* modes) const;
+    void ResolveModulation(const unsigned char* values, const unsigned char* modes,
+                           int firstRow, int lastRow, unsigned char* modulation) const;
+    static void Blend(const unsigned char* a, const unsigned char* b,
+                      unsigned char modulation, unsigned char* rgba);
+    int Width;
+    int Height;
+    int BitsPerPixel;
+    int BlockWidth;
+    int BlockHeight;
+    int BlocksX;
+    int BlocksY;
+};
+
+inline PvrtcLayout::PvrtcLayout(int width, int height, int bitsPerPixel)
+{
+    BitsPerPixel = bitsPerPixel;
+    BlockWidth = bitsPerPixel == 2 ? 8 : 4;
+    BlockHeight = 4;
+    Width = width > BlockWidth * 2 ? width : BlockWidth * 2;
+    Height = height > BlockHeight * 2 ? height : BlockHeight * 2;
+    BlocksX = Width / BlockWidth;
+    BlocksY = Height / BlockHeight;
+}
+
+inline int PvrtcLayout::BlockIndex(int bx, int by) const
+{
+    bx = (bx + BlocksX) % BlocksX;
+    by = (by + BlocksY) % BlocksY;
+    return by * BlocksX + bx;
+}
+
+// Interleaves the block coordinates, y in the low bit, for as many bits as the
+// shorter axis has.  The longer axis's remaining bits go on top.
+inline unsigned int PvrtcLayout::MortonIndex(int bx, int by) const
+{
+    int shorter = BlocksX < BlocksY ? BlocksX : BlocksY;
+    unsigned int index = 0;
+    int shift = 0;
+    for (int bit = 1; bit < shorter; bit <<= 1, ++shift) {
+        if (by & bit)
+            index |= 1u << (2 * shift);
+        if (bx & bit)
+            index |= 1u << (2 * shift + 1);
+    }
+    unsigned int rest = BlocksX > BlocksY ? bx : by;
+    return index | (rest >> shift) << (2 * shift);
+}
+
+inline void PvrtcLayout::ReadBlocks(const unsigned char* data,
+                                    std::vector<PvrtcBlock>& blocks) const
+{
+    blocks.resize(BlocksX * BlocksY);
+    for (int by = 0; by < BlocksY; ++by) {
+        for (int bx = 0; bx < BlocksX; ++bx) {
+            const unsigned char* b = data + MortonIndex(bx, by) * 8;
+            PvrtcBlock& block = blocks[by * BlocksX + bx];
+            block.Modulation = b[0] | b[1] << 8 | b[2] << 16 | (unsigned int) b[3] << 24;
+            block.Color = b[4] | b[5] << 8 | b[6] << 16 | (unsigned int) b[7] << 24;
+        }
+    }
+}
+
+inline void PvrtcLayout::WriteBlocks(const std::vector<PvrtcBlock>& blocks,
+                                     std::vector<unsigned char>& data) const
+{
+    data.resize(BlocksX * BlocksY * 8);
+    for (int by = 0; by < BlocksY; ++by) {
+        for (int bx = 0; bx < BlocksX; ++bx) {
+            unsigned char* b = &data[MortonIndex(bx, by) * 8];
+            const PvrtcBlock& block = blocks[by * BlocksX + bx];
+            for (int i = 0; i < 4; ++i) {
+                b[i] = (block.Modulation >> (8 * i)) & 0xff;
+                b[i + 4] = (block.Color >> (8 * i)) & 0xff;
+            }
+        }
+    }
+}
+
+inline void PvrtcLayout::UnpackColors(const std::vector<PvrtcBlock>& blocks,
+                                      std::vector<PvrtcColor>& colorsA,
+                                      std::vector<PvrtcColor>& colorsB) const
+{
+    colorsA.resize(blocks.size());
+    colorsB.resize(blocks.size());
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        colorsA[i] = PvrtcUnpackColorA(blocks[i].Color);
+        colorsB[i] = PvrtcUnpackColorB(blocks[i].Color);
+    }
+}
+
+// Bilinearly upscales one of the two color images into 8-bit RGBA.  The
+// weights sum to the block area, 16 or 32 texels, and the result is widened
+// from 5 (or 4) bits with fixed-point bit replication.
+inline void PvrtcLayout::InterpolateRows(const PvrtcColor* colors, int firstRow,
+                                         int lastRow, unsigned char* rgba) const
+{
+    int shift = BitsPerPixel == 2 ? 5 : 4;
+    for (int y = firstRow; y < lastRow; ++y) {
+        int sy = y - BlockHeight / 2;
+        int by = (sy + BlockHeight) / BlockHeight - 1;
+        int ly = sy - by * BlockHeight;
+        const PvrtcColor* top = colors + BlockIndex(0, by);
+        const PvrtcColor* bottom = colors + BlockIndex(0, by + 1);
+        unsigned char* out = rgba + y * Width * 4;
+
+        // Blend each pair of block columns vertically, then sweep across
+        // the span of texels between their centers.
+        for (int bx = -1; bx < BlocksX; ++bx) {
+            int left = (bx + BlocksX) % BlocksX;
+            int right = (bx + 1) % BlocksX;
+            int l[4], r[4];
+            l[0] = top[left].R * (BlockHeight - ly) + bottom[left].R * ly;
+            l[1] = top[left].G * (BlockHeight - ly) + bottom[left].G * ly;
+            l[2] = top[left].B * (BlockHeight - ly) + bottom[left].B * ly;
+            l[3] = top[left].A * (BlockHeight - ly) + bottom[left].A * ly;
+            r[0] = top[right].R * (BlockHeight - ly) + bottom[right].R * ly;
+            r[1] = top[right].G * (BlockHeight - ly) + bottom[right].G * ly;
+            r[2] = top[right].B * (BlockHeight - ly) + bottom[right].B * ly;
+            r[3] = top[right].A * (BlockHeight - ly) + bottom[right].A * ly;
+
+            int x0 = bx * BlockWidth + BlockWidth / 2;
+            for (int lx = 0; lx < BlockWidth; ++lx) {
+                int x = x0 + lx;
+                if (x < 0 || x >= Width)
+                    continue;
+                unsigned char* texel = out + x * 4;
+                for (int c = 0; c < 3; ++c) {
+                    int sum = l[c] * (BlockWidth - lx) + r[c] * lx;
+                    texel[c] = (sum >> (shift - 3)) + (sum >> (shift + 2));
+                }
+                int alpha = l[3] * (BlockWidth - lx) + r[3] * lx;
+                texel[3] = (alpha >> (shift - 4)) + (alpha >> shift);
+            }
+        }
+    }
+}
+
+// Expands each block's modulation word into a 2-bit value and a mode per
+// texel.  4bpp modes: 0 is standard, 1 is punch-through.  2bpp modes: 0 is
+// one bit per texel; 1, 2, and 3 store a checkerboard of 2-bit values and
+// fill in the rest from both, horizontal, or vertical neighbours.
+inline void PvrtcLayout::UnpackModulation(const PvrtcBlock* blocks, int firstBlockRow,
+                                          int lastBlockRow, unsigned char* values,
+                                          unsigned char* modes) const
+{
+    for (int by = firstBlockRow; by < lastBlockRow; ++by) {
+        for (int bx = 0; bx < BlocksX; ++bx) {
+            const PvrtcBlock& block = blocks[by * BlocksX + bx];
+            unsigned int bits = block.Modulation;
+            int mode = block.Color & 1;
+
+            if (BitsPerPixel == 2 && mode) {
+                if (bits & 1) {
+                    mode = (bits & (1 << 20)) ? 3 : 2;
+                    if (bits & (1 << 21))
+                        bits |= 1 << 20;
+                    else
+                        bits &= ~(1 << 20);
+                }
+                if (bits & 2)
+                    bits |= 1;
+                else
+                    bits &= ~1u;
+            }
+
+            for (int y = 0; y < BlockHeight; ++y) {
+                int row = (by * BlockHeight + y) * Width + bx * BlockWidth;
+                for (int x = 0; x < BlockWidth; ++x) {
+                    modes[row + x] = mode;
+                    if (BitsPerPixel == 4) {
+                        values[row + x] = bits & 3;
+                        bits >>= 2;
+                    } else if (!mode) {
+                        values[row + x] = (bits & 1) ? 3 : 0;
+                        bits >>= 1;
+                    } else if (((x ^ y) & 1) == 0) {
+                        values[row + x] = bits & 3;
+                        bits >>= 2;
+                    } else {
+                        values[row + x] = 0;
+                    }
+                }
+            }
+        }
+    }
+}
+
+inline void PvrtcLayout::ResolveModulation(const unsigned char* values,
+                                           const unsigned char* modes,
+                                           int firstRow, int lastRow,
+                                           unsigned char* modulation) const
+{
+    static const unsigned char Standard[4] = { 0, 3, 5, 8 };
+    static const unsigned char PunchThrough[4] = { 0, 4, 4 | PvrtcPunchThrough, 8 };
+
+    for (int y = firstRow; y < lastRow; ++y) {
+        int up = ((y + Height - 1) % Height) * Width;
+        int down = ((y + 1) % Height) * Width;
+        int row = y * Width;
+        for (int x = 0; x < Width; ++x) {
+            int i = row + x;
+            int mode = modes[i];
+            if (BitsPerPixel == 4) {
+                modulation[i] = mode ? PunchThrough[values[i]] : Standard[values[i]];
+                continue;
+            }
+            if (mode == 0 || ((x ^ y) & 1) == 0) {
+                modulation[i] = Standard[values[i]];
+                continue;
+            }
+            int left = row + (x + Width - 1) % Width;
+            int right = row + (x + 1) % Width;
+            int vertical = Standard[values[up + x]] + Standard[values[down + x]];
+            int horizontal = Standard[values[left]] + Standard[values[right]];
+            if (mode == 1)
+                modulation[i] = (vertical + horizontal + 2) / 4;
+            else if (mode == 2)
+                modulation[i] = (horizontal + 1) / 2;
+            else
+                modulation[i] = (vertical + 1) / 2;
+        }
+    }
+}
+
+inline void PvrtcLayout::Blend(const unsigned char* a, const unsigned char* b,
+                               unsigned char modulation, unsigned char* rgba)
+{
+    int m = modulation & 0xf;
+    for (int c = 0; c < 4; ++c)
+        rgba[c] = (a[c] * (8 - m) + b[c] * m) / 8;
+    if (modulation & PvrtcPunchThrough)
+        rgba[3] = 0;
+}
+
+// Decodes one level into 8-bit RGBA.
+inline void DecodePvrtc(const unsigned char* data, int width, int height,
+                        int bitsPerPixel, std::vector<unsigned char>& rgba)
+{
+    PvrtcLayout layout(width, height, bitsPerPixel);
+    std::vector<PvrtcBlock> blocks;
+    std::vector<PvrtcColor> colorsA, colorsB;
+    layout.ReadBlocks(data, blocks);
+    layout.UnpackColors(blocks, colorsA, colorsB);
+
+    int texelCount = layout.Width * layout.Height;
+    std::vector<unsigned char> a(texelCount * 4), b(texelCount * 4);
+    std::vector<unsigned char> values(texelCount), modes(texelCount), modulation(texelCount);
+    layout.InterpolateRows(&colorsA[0], 0, layout.Height, &a[0]);
+    layout.InterpolateRows(&colorsB[0], 0, layout.Height, &b[0]);
+    layout.UnpackModulation(&blocks[0], 0, layout.BlocksY, &values[0], &modes[0]);
+    layout.ResolveModulation(&values[0], &modes[0], 0, layout.Height, &modulation[0]);
+
+    rgba.resize(width * height * 4);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int i = y * layout.Width + x;
+            PvrtcLayout::Blend(&a[i * 4], &b[i * 4], modulation[i], &rgba[(y * width + x) * 4]);
+        }
+    }
+}
+
+// Encoder.  Endpoints start from the principal axis of each block's texels,
+// oriented so that B is the brighter color; neighbouring blocks then agree
+// on which image is which.  Each quality step is one round of least-squares
+// refinement: the blocks are solved in four interleaved phases so that no
+// two blocks solved together influence the same texel, and then every
+// texel picks its best modulation again.  The best round is kept.  Quality 0
+// skips refinement entirely.  The 4bpp punch-through mode and the 2bpp
+// horizontal-only and vertical-only modes are decoded but never emitted.
+class PvrtcEncoder {
+public:
+    static const int DefaultQuality = 2;
+    static const int MaxQuality = 8;
+    PvrtcEncoder(int bitsPerPixel, int quality = DefaultQuality, int threadCount = 1);
+    void Encode(const unsigned char* rgba, int width, int height,
+                std::vector<unsigned char>& output);
+private:
+    typedef void (PvrtcEncoder::*Stage)(int begin, int end);
+    struct Job {
+        PvrtcEncoder* Encoder;
+        Stage Method;
+        void operator()(int begin, int end) { (Encoder->*Method)(begin, end); }
+    };
+    void Run(Stage stage, int count);
+    void InitializeBlocks(int firstBlockRow, int lastBlockRow);
+    void InterpolateRows(int firstRow, int lastRow);
+    void SelectModulation(int firstBlockRow, int lastBlockRow);
+    void UnpackModulation(int firstBlockRow, int lastBlockRow);
+    void ResolveModulation(int firstRow, int lastRow);
+    void RefineBlocks(int first, int last);
+    void MeasureRows(int firstRow, int lastRow);
+    void Interpolate();
+    void Modulate();
+    double Measure();
+    void QuantizeBlock(int index);
+    int Error(const unsigned char* source, const unsigned char* a,
+              const unsigned char* b, int modulation) const;
+    int BestValue(int texel, int valueCount) const;
+    static int QuantizeChannel(float value, int bits);
+    static int Expand(int value, int bits);
+    int m_bitsPerPixel;
+    int m_quality;
+    int m_threadCount;
+    int m_phase;
+    PvrtcLayout m_layout;
+    std::vector<unsigned char> m_source;
+    std::vector<float> m_endpoints;
+    std::vector<PvrtcBlock> m_blocks;
+    std::vector<PvrtcColor> m_colorsA;
+    std::vector<PvrtcColor> m_colorsB;
+    std::vector<unsigned char> m_a;
+    std::vector<unsigned char> m_b;
+    std::vector<unsigned char> m_values;
+    std::vector<unsigned char> m_modes;
+    std::vector<unsigned char> m_modulation;
+    std::vector<double> m_rowErrors;
+};
+
+inline PvrtcEncoder::PvrtcEncoder(int bitsPerPixel, int quality, int threadCount)
+    : m_bitsPerPixel(bitsPerPixel), m_quality(quality), m_threadCount(threadCount),
+      m_phase(0), m_layout(1, 1, bitsPerPixel)
+{
+    if (m_quality < 0)
+        m_quality = 0;
+    if (m_quality > MaxQuality)
+        m_quality = MaxQuality;
+}
+
+inline void PvrtcEncoder::Run(Stage stage, int count)
+{
+    Job job = { this, stage };
+    ParallelFor(count, m_threadCount, job);
+}
+
+inline void PvrtcEncoder::Encode(const unsigned char* rgba, int width, int height,
+                                 std::vector<unsigned char>& output)
+{
+    m_layout = PvrtcLayout(width, height, m_bitsPerPixel);
+    const PvrtcLayout& layout = m_layout;
+    int texelCount = layout.Width * layout.Height;
+    int blockCount = layout.BlocksX * layout.BlocksY;
+
+    // Tiny levels are tiled out to the padded size, since PVRTC wraps.
+    m_source.resize(texelCount * 4);
+    for (int y = 0; y < layout.Height; ++y)
+        for (int x = 0; x < layout.Width; ++x)
+            for (int c = 0; c < 4; ++c)
+                m_source[(y * layout.Width + x) * 4 + c] =
+                    rgba[((y % height) * width + x % width) * 4 + c];
+
+    m_endpoints.assign(blockCount * 8, 0.0f);
+    m_blocks.resize(blockCount);
+    m_colorsA.resize(blockCount);
+    m_colorsB.resize(blockCount);
+    m_a.resize(texelCount * 4);
+    m_b.resize(texelCount * 4);
+    m_values.resize(texelCount);
+    m_modes.resize(texelCount);
+    m_modulation.resize(texelCount);
+    m_rowErrors.resize(layout.Height);
+
+    Run(&PvrtcEncoder::InitializeBlocks, layout.BlocksY);
+    Interpolate();
+    Modulate();
+
+    std::vector<PvrtcBlock> best = m_blocks;
+    double bestError = Measure();
+    for (int round = 0; round < m_quality; ++round) {
+        for (m_phase = 0; m_phase < 4; ++m_phase) {
+            Run(&PvrtcEncoder::RefineBlocks, layout.BlocksY / 2);
+            Interpolate();
+        }
+        Modulate();
+        double error = Measure();
+        if (error >= bestError)
+            break;
+        bestError = error;
+        best = m_blocks;
+    }
+
+    layout.WriteBlocks(best, output);
+}
+
+inline void PvrtcEncoder::Interpolate()
+{
+    Run(&PvrtcEncoder::InterpolateRows, m_layout.Height);
+}
+
+inline void PvrtcEncoder::Modulate()
+{
+    Run(&PvrtcEncoder::SelectModulation, m_layout.BlocksY);
+    Run(&PvrtcEncoder::UnpackModulation, m_layout.BlocksY);
+    Run(&PvrtcEncoder::ResolveModulation, m_layout.Height);
+}
+
+inline double PvrtcEncoder::Measure()
+{
+    Run(&PvrtcEncoder::MeasureRows, m_layout.Height);
+    double total = 0;
+    for (size_t i = 0; i < m_rowErrors.size(); ++i)
+        total += m_rowErrors[i];
+    return total;
+}
+
+inline void PvrtcEncoder::InterpolateRows(int firstRow, int lastRow)
+{
+    m_layout.InterpolateRows(&m_colorsA[0], firstRow, lastRow, &m_a[0]);
+    m_layout.InterpolateRows(&m_colorsB[0], firstRow, lastRow, &m_b[0]);
+}
+
+inline void PvrtcEncoder::UnpackModulation(int firstBlockRow, int lastBlockRow)
+{
+    m_layout.UnpackModulation(&m_blocks[0], firstBlockRow, lastBlockRow,
+                              &m_values[0], &m_modes[0]);
+}
+
+inline void PvrtcEncoder::ResolveModulation(int firstRow, int lastRow)
+{
+    m_layout.ResolveModulation(&m_values[0], &m_modes[0], firstRow, lastRow,
+                               &m_modulation[0]);
+}
+
+inline void PvrtcEncoder::InitializeBlocks(int firstBlockRow, int lastBlockRow)
+{
+    const PvrtcLayout& layout = m_layout;
+    const float Brightness[4] = { 0.3f, 0.59f, 0.11f, 0.5f };
+    int texelCount = layout.BlockWidth * layout.BlockHeight;
+
+    for (int by = firstBlockRow; by < lastBlockRow; ++by) {
+        for (int bx = 0; bx < layout.BlocksX; ++bx) {
+            float texels[32][4];
+            float mean[4] = { 0, 0, 0, 0 };
+            for (int y = 0; y < layout.BlockHeight; ++y) {
+                for (int x = 0; x < layout.BlockWidth; ++x) {
+                    int px = bx * layout.BlockWidth + x;
+                    int py = by * layout.BlockHeight + y;
+                    const unsigned char* s = &m_source[(py * layout.Width + px) * 4];
+                    float* t = texels[y * layout.BlockWidth + x];
+                    for (int c = 0; c < 4; ++c) {
+                        t[c] = s[c];
+                        mean[c] += s[c];
+                    }
+                }
+            }
+            for (int c = 0; c < 4; ++c)
+                mean[c] /= texelCount;
+
+            float covariance[4][4] = { { 0 } };
+            for (int i = 0; i < texelCount; ++i)
+                for (int j = 0; j < 4; ++j)
+                    for (int k = 0; k < 4; ++k)
+                        covariance[j][k] += (texels[i][j] - mean[j]) * (texels[i][k] - mean[k]);
+
+            // A few rounds of power iteration find the principal axis.
+            float axis[4] = { 1, 1, 1, 1 };
+            for (int iteration = 0; iteration < 8; ++iteration) {
+                float next[4] = { 0, 0, 0, 0 };
+                for (int j = 0; j < 4; ++j)
+                    for (int k = 0; k < 4; ++k)
+                        next[j] += covariance[j][k] * axis[k];
+                float length = std::sqrt(next[0] * next[0] + next[1] * next[1] +
+                                         next[2] * next[2] + next[3] * next[3]);
+                if (length < 1e-6f) {
+                    axis[0] = axis[1] = axis[2] = axis[3] = 0;
+                    break;
+                }
+                for (int j = 0; j < 4; ++j)
+                    axis[j] = next[j] / length;
+            }
+
+            float brightness = 0;
+            for (int c = 0; c < 4; ++c)
+                brightness += axis[c] * Brightness[c];
+            if (brightness < 0)
+                for (int c = 0; c < 4; ++c)
+                    axis[c] = -axis[c];
+
+            float low = 0, high = 0;
+            for (int i = 0; i < texelCount; ++i) {
+                float t = 0;
+                for (int c = 0; c < 4; ++c)
+                    t += (texels[i][c] - mean[c]) * axis[c];
+                low = t < low ? t : low;
+                high = t > high ? t : high;
+            }
+
+            int index = by * layout.BlocksX + bx;
+            float* endpoints = &m_endpoints[index * 8];
+            for (int c = 0; c < 4; ++c) {
+                endpoints[c] = mean[c] + low * axis[c];
+                endpoints[c + 4] = mean[c] + high * axis[c];
+            }
+            QuantizeBlock(index);
+        }
+    }
+}
+
+// Picks the modulation for every texel in a block, given the current A and B
+// images.  For 2bpp, the direct mode and the checkerboard mode are both
+// tried; texels that the checkerboard fills in from neighbouring blocks are
+// estimated from those texels' own best values.
+inline void PvrtcEncoder::SelectModulation(int firstBlockRow, int lastBlockRow)
+{
+    static const int Standard[4] = { 0, 3, 5, 8 };
+    const PvrtcLayout& layout = m_layout;
+
+    for (int by = firstBlockRow; by < lastBlockRow; ++by) {
+        for (int bx = 0; bx < layout.BlocksX; ++bx) {
+            PvrtcBlock& block = m_blocks[by * layout.BlocksX + bx];
+            block.Color &= ~1u;
+            block.Modulation = 0;
+
+            if (m_bitsPerPixel == 4) {
+                for (int y = 0; y < 4; ++y) {
+                    for (int x = 0; x < 4; ++x) {
+                        int texel = (by * 4 + y) * layout.Width + bx * 4 + x;
+                        block.Modulation |= BestValue(texel, 4) << (2 * (y * 4 + x));
+                    }
+                }
+                continue;
+            }
+
+            int directError = 0, stored[4][8];
+            unsigned int directBits = 0;
+            for (int y = 0; y < 4; ++y) {
+                for (int x = 0; x < 8; ++x) {
+                    int texel = (by * 4 + y) * layout.Width + bx * 8 + x;
+                    int value = BestValue(texel, 2);
+                    directBits |= (value ? 1u : 0u) << (y * 8 + x);
+                    directError += Error(&m_source[texel * 4], &m_a[texel * 4],
+                                         &m_b[texel * 4], value ? 8 : 0);
+                    stored[y][x] = ((x ^ y) & 1) == 0 ?
+                        BestValue(texel, (x | y) ? 4 : 2) : -1;
+                }
+            }
+
+            int checkerError = 0;
+            unsigned int checkerBits = 0;
+            int shift = 0;
+            for (int y = 0; y < 4; ++y) {
+                for (int x = 0; x < 8; ++x) {
+                    int px = bx * 8 + x, py = by * 4 + y;
+                    int texel = py * layout.Width + px;
+                    int modulation;
+                    if (stored[y][x] >= 0) {
+                        int value = stored[y][x];
+                        if (x == 0 && y == 0)
+                            checkerBits |= value ? 2 : 0;
+                        else
+                            checkerBits |= value << shift;
+                        shift += 2;
+                        modulation = Standard[value];
+                    } else {
+                        int sum = 0;
+                        const int dx[4] = { -1, 1, 0, 0 };
+                        const int dy[4] = { 0, 0, -1, 1 };
+                        for (int n = 0; n < 4; ++n) {
+                            int nx = x + dx[n], ny = y + dy[n];
+                            int value;
+                            if (nx >= 0 && nx < 8 && ny >= 0 && ny < 4) {
+                                value = stored[ny][nx];
+                            } else {
+                                int qx = (px + dx[n] + layout.Width) % layout.Width;
+                                int qy = (py + dy[n] + layout.Height) % layout.Height;
+                                value = BestValue(qy * layout.Width + qx, 4);
+                            }
+                            sum += Standard[value];
+                        }
+                        modulation = (sum + 2) / 4;
+                    }
+                    checkerError += Error(&m_source[texel * 4], &m_a[texel * 4],
+                                          &m_b[texel * 4], modulation);
+                }
+            }
+
+            if (checkerError < directError) {
+                block.Color |= 1;
+                block.Modulation = checkerBits;
+            } else {
+                block.Modulation = directBits;
+            }
+        }
+    }
+}
+
+// Returns the index of the best of the first valueCount standard modulation
+// weights; with two values the choice is between 0 and 8.
+inline int PvrtcEncoder::BestValue(int texel, int valueCount) const
+{
+    static const int Four[4] = { 0, 3, 5, 8 };
+    static const int Two[2] = { 0, 8 };
+    const int* weights = valueCount == 4 ? Four : Two;
+    int best = 0, bestError = 0x7fffffff;
+    for (int i = 0; i < valueCount; ++i) {
+        int error = Error(&m_source[texel * 4], &m_a[texel * 4], &m_b[texel * 4], weights[i]);
+        if (error < bestError) {
+            bestError = error;
+            best = i;
+        }
+    }
+    return valueCount == 2 && best ? 3 : best;
+}
+
+inline int PvrtcEncoder::Error(const unsigned char* source, const unsigned char* a,
+                               const unsigned char* b, int modulation) const
+{
+    unsigned char decoded[4];
+    PvrtcLayout::Blend(a, b, modulation, decoded);
+    int error = 0;
+    for (int c = 0; c < 4; ++c) {
+        int d = source[c] - decoded[c];
+        error += d * d;
+    }
+    return error;
+}
+
+// Solves for one block's endpoints by least squares over every texel the
+// block touches, holding its neighbours and the modulation fixed.  A little
+// damping toward the current endpoints keeps flat blocks well-conditioned.
+inline void PvrtcEncoder::RefineBlocks(int first, int last)
+{
+    const PvrtcLayout& layout = m_layout;
+    int bw = layout.BlockWidth, bh = layout.BlockHeight;
+    float area = (float) (bw * bh);
+
+    for (int row = first; row < last; ++row) {
+        int by = row * 2 + (m_phase >> 1);
+        for (int bx = m_phase & 1; bx < layout.BlocksX; bx += 2) {
+            int index = by * layout.BlocksX + bx;
+            float* endpoints = &m_endpoints[index * 8];
+
+            float current[8];
+            const PvrtcColor& ca = m_colorsA[index];
+            const PvrtcColor& cb = m_colorsB[index];
+            current[0] = Expand(ca.R, 5); current[1] = Expand(ca.G, 5);
+            current[2] = Expand(ca.B, 5); current[3] = ca.A * 17;
+            current[4] = Expand(cb.R, 5); current[5] = Expand(cb.G, 5);
+            current[6] = Expand(cb.B, 5); current[7] = cb.A * 17;
+
+            double aa = 0, ab = 0, bb = 0;
+            double ra[4] = { 0, 0, 0, 0 }, rb[4] = { 0, 0, 0, 0 };
+            int centerX = bx * bw + bw / 2, centerY = by * bh + bh / 2;
+            for (int dy = 1 - bh; dy < bh; ++dy) {
+                int py = (centerY + dy + layout.Height) % layout.Height;
+                float wy = (float) (bh - (dy < 0 ? -dy : dy));
+                for (int dx = 1 - bw; dx < bw; ++dx) {
+                    int px = (centerX + dx + layout.Width) % layout.Width;
+                    float w = wy * (bw - (dx < 0 ? -dx : dx)) / area;
+                    int texel = py * layout.Width + px;
+                    float m = (m_modulation[texel] & 0xf) / 8.0f;
+                    float alpha = w * (1 - m), beta = w * m;
+                    aa += alpha * alpha;
+                    ab += alpha * beta;
+                    bb += beta * beta;
+                    for (int c = 0; c < 4; ++c) {
+                        float a = m_a[texel * 4 + c], b = m_b[texel * 4 + c];
+                        float others = (1 - m) * a + m * b -
+                                       alpha * current[c] - beta * current[c + 4];
+                        float target = m_source[texel * 4 + c] - others;
+                        ra[c] += alpha * target;
+                        rb[c] += beta * target;
+                    }
+                }
+            }
+
+            double damping = 1e-3 * (aa + bb) + 1e-6;
+            aa += damping;
+            bb += damping;
+            double determinant = aa * bb - ab * ab;
+            for (int c = 0; c < 4; ++c) {
+                double sa = ra[c] + damping * endpoints[c];
+                double sb = rb[c] + damping * endpoints[c + 4];
+                float a = (float) ((sa * bb - sb * ab) / determinant);
+                float b = (float) ((sb * aa - sa * ab) / determinant);
+                endpoints[c] = a < 0 ? 0 : (a > 255 ? 255 : a);
+                endpoints[c + 4] = b < 0 ? 0 : (b > 255 ? 255 : b);
+            }
+            QuantizeBlock(index);
+        }
+    }
+}
+
+inline void PvrtcEncoder::MeasureRows(int firstRow, int lastRow)
+{
+    for (int y = firstRow; y < lastRow; ++y) {
+        double error = 0;
+        for (int x = 0; x < m_layout.Width; ++x) {
+            int texel = y * m_layout.Width + x;
+            error += Error(&m_source[texel * 4], &m_a[texel * 4], &m_b[texel * 4],
+                           m_modulation[texel]);
+        }
+        m_rowErrors[y] = error;
+    }
+}
+
+// Rounds both endpoints to the nearest representable colors, using the
+// opaque layouts unless the alpha is closer to a translucent step.
+inline void PvrtcEncoder::QuantizeBlock(int index)
+{
+    const float* e = &m_endpoints[index * 8];
+    const float OpaqueThreshold = (238 + 255) / 2.0f;
+    unsigned int color;
+
+    if (e[3] >= OpaqueThreshold) {
+        color = 0x8000 | QuantizeChannel(e[0], 5) << 10 |
+                QuantizeChannel(e[1], 5) << 5 | QuantizeChannel(e[2], 4) << 1;
+    } else {
+        int alpha = (int) (e[3] / 34 + 0.5f);
+        color = alpha << 12 | QuantizeChannel(e[0], 4) << 8 |
+                QuantizeChannel(e[1], 4) << 4 | QuantizeChannel(e[2], 3) << 1;
+    }
+
+    if (e[7] >= OpaqueThreshold) {
+        color |= (0x8000 | QuantizeChannel(e[4], 5) << 10 |
+                  QuantizeChannel(e[5], 5) << 5 | QuantizeChannel(e[6], 5)) << 16;
+    } else {
+        int alpha = (int) (e[7] / 34 + 0.5f);
+        color |= (alpha << 12 | QuantizeChannel(e[4], 4) << 8 |
+                  QuantizeChannel(e[5], 4) << 4 | QuantizeChannel(e[6], 4)) << 16;
+    }
+
+    PvrtcBlock& block = m_blocks[index];
+    block.Color = color | (block.Color & 1);
+    m_colorsA[index] = PvrtcUnpackColorA(color);
+    m_colorsB[index] = PvrtcUnpackColorB(color);
+}
+
+inline int PvrtcEncoder::QuantizeChannel(float value, int bits)
+{
+    int maxValue = (1 << bits) - 1;
+    int guess = (int) (value * maxValue / 255 + 0.5f);
+    int best = 0;
+    float bestError = 1e30f;
+    for (int q = guess - 1; q <= guess + 1; ++q) {
+        if (q < 0 || q > maxValue)
+            continue;
+        float error = std::fabs(Expand(q, bits) - value);
+        if (error < bestError) {
+            bestError = error;
+            best = q;
+        }
+    }
+    return best;
+}
+
+// Widens a 3-, 4-, or 5-bit channel to 8 bits the way the decoder does.
+inline int PvrtcEncoder::Expand(int value, int bits)
+{
+    int c = bits == 5 ? value : (bits == 4 ? PvrtcExpand4To5(value) : PvrtcExpand3To5(value));
+    return (c << 3) | (c >> 2);
+}
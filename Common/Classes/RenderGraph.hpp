@@ -0,0 +1,291 @@
+#pragma once
+#include <cassert>
+#include <string>
+#include <vector>
+
+// Schedules the passes of a multi-pass effect from what each one reads and
+// writes, without touching GL.  Declare the offscreen surfaces and the
+// passes in the order they'd run, then Compile works out:
+//
+//   - which passes can be skipped, because nothing that reaches an
+//     imported surface (the screen) depends on what they write
+//   - how long each surface has to live, and which surfaces can share
+//     storage because their lifetimes don't overlap
+//   - for each pass, which of its attachments have to be loaded first and
+//     which can be discarded afterwards
+//
+// The engine then allocates one texture or renderbuffer per slot, and
+// runs the steps in order.  Surfaces that some pass reads become textures;
+// the rest become renderbuffers.
+
+enum RenderGraphFormat {
+    RenderGraphFormatRgba8,
+    RenderGraphFormatRgb565,
+    RenderGraphFormatDepth16,
+    RenderGraphFormatDepth24,
+    RenderGraphFormatStencil8,
+};
+
+inline int GetRenderGraphBytesPerPixel(RenderGraphFormat format)
+{
+    switch (format) {
+        case RenderGraphFormatRgba8: return 4;
+        case RenderGraphFormatDepth24: return 4;
+        case RenderGraphFormatStencil8: return 1;
+        default: return 2;
+    }
+}
+
+// Storage for one or more surfaces.
+struct RenderGraphSlot {
+    int Width;
+    int Height;
+    RenderGraphFormat Format;
+    bool Texture;
+    int GetBytes() const { return Width * Height * GetRenderGraphBytesPerPixel(Format); }
+};
+
+// A surface that a step draws into.  Load means the pass adds to what's
+// there; otherwise the previous contents are garbage, and the attachment
+// can be cleared or invalidated rather than loaded.  Discard means nothing
+// reads it afterwards.
+struct RenderGraphAttachment {
+    int Resource;
+    int Slot;
+    bool Load;
+    bool Discard;
+};
+
+struct RenderGraphStep {
+    int Pass;
+    std::vector<RenderGraphAttachment> Outputs;
+};
+
+class RenderGraph {
+public:
+    RenderGraph() : m_compiled(false) {}
+    int CreateResource(const char* name, int width, int height, RenderGraphFormat format);
+    // A surface that lives outside the graph, like the screen.  Passes
+    // that end up writing one are never skipped.
+    int ImportResource(const char* name);
+    int AddPass(const char* name);
+    void Read(int pass, int resource);
+    // Drawing over what's there rather than replacing it is a load.
+    void Write(int pass, int resource, bool load = false);
+    void Compile();
+
+    const std::vector<RenderGraphStep>& GetSteps() const { return m_steps; }
+    const std::vector<RenderGraphSlot>& GetSlots() const { return m_slots; }
+    // -1 for imported surfaces and the ones nothing uses.
+    int GetSlot(int resource) const { return m_resources[resource].Slot; }
+    bool IsCulled(int pass) const { return !m_passes[pass].Live; }
+    int GetPassCount() const { return (int) m_passes.size(); }
+    int GetResourceCount() const { return (int) m_resources.size(); }
+    const char* GetPassName(int pass) const { return m_passes[pass].Name.c_str(); }
+    const char* GetResourceName(int resource) const { return m_resources[resource].Name.c_str(); }
+    // What the slots take, against one allocation for each surface that a
+    // pass which runs uses.
+    int GetAllocatedBytes() const;
+    int GetUnaliasedBytes() const;
+private:
+    struct Resource {
+        std::string Name;
+        RenderGraphSlot Description;
+        bool Imported;
+        int First;
+        int Last;
+        int Slot;
+    };
+    struct Use {
+        int Resource;
+        bool Load;
+    };
+    struct Pass {
+        std::string Name;
+        std::vector<int> Reads;
+        std::vector<Use> Writes;
+        bool Live;
+    };
+    void Cull();
+    void MeasureLifetimes();
+    void AssignSlots();
+    void BuildSteps();
+    std::vector<Resource> m_resources;
+    std::vector<Pass> m_passes;
+    std::vector<RenderGraphSlot> m_slots;
+    std::vector<RenderGraphStep> m_steps;
+    bool m_compiled;
+};
+
+inline int RenderGraph::CreateResource(const char* name, int width, int height,
+                                       RenderGraphFormat format)
+{
+    Resource resource;
+    resource.Name = name;
+    resource.Description.Width = width;
+    resource.Description.Height = height;
+    resource.Description.Format = format;
+    resource.Description.Texture = false;
+    resource.Imported = false;
+    resource.First = resource.Last = resource.Slot = -1;
+    m_resources.push_back(resource);
+    return (int) m_resources.size() - 1;
+}
+
+inline int RenderGraph::ImportResource(const char* name)
+{
+    int index = CreateResource(name, 0, 0, RenderGraphFormatRgba8);
+    m_resources[index].Imported = true;
+    return index;
+}
+
+inline int RenderGraph::AddPass(const char* name)
+{
+    Pass pass;
+    pass.Name = name;
+    pass.Live = false;
+    m_passes.push_back(pass);
+    return (int) m_passes.size() - 1;
+}
+
+inline void RenderGraph::Read(int pass, int resource)
+{
+    assert(!m_compiled && "Passes can't change after Compile.");
+    m_passes[pass].Reads.push_back(resource);
+}
+
+inline void RenderGraph::Write(int pass, int resource, bool load)
+{
+    assert(!m_compiled && "Passes can't change after Compile.");
+    Use use = { resource, load };
+    m_passes[pass].Writes.push_back(use);
+}
+
+inline void RenderGraph::Compile()
+{
+    Cull();
+    MeasureLifetimes();
+    AssignSlots();
+    BuildSteps();
+    m_compiled = true;
+}
+
+// Walks backwards from the imported surfaces.  A pass is needed if it
+// writes something needed later; what it reads is then needed, and what
+// it replaces outright isn't needed before it.  What it loads stays needed
+// only if it was, since a load into a surface nobody looks at is moot.
+inline void RenderGraph::Cull()
+{
+    std::vector<bool> needed(m_resources.size(), false);
+    for (size_t i = 0; i < m_resources.size(); ++i)
+        needed[i] = m_resources[i].Imported;
+
+    for (int p = (int) m_passes.size() - 1; p >= 0; --p) {
+        Pass& pass = m_passes[p];
+        pass.Live = false;
+        for (size_t i = 0; i < pass.Writes.size(); ++i)
+            pass.Live = pass.Live || needed[pass.Writes[i].Resource];
+        if (!pass.Live)
+            continue;
+        for (size_t i = 0; i < pass.Writes.size(); ++i)
+            if (!pass.Writes[i].Load && !m_resources[pass.Writes[i].Resource].Imported)
+                needed[pass.Writes[i].Resource] = false;
+        for (size_t i = 0; i < pass.Reads.size(); ++i)
+            needed[pass.Reads[i]] = true;
+    }
+}
+
+inline void RenderGraph::MeasureLifetimes()
+{
+    for (size_t i = 0; i < m_resources.size(); ++i) {
+        m_resources[i].First = m_resources[i].Last = m_resources[i].Slot = -1;
+        m_resources[i].Description.Texture = false;
+    }
+    for (int p = 0; p < (int) m_passes.size(); ++p) {
+        const Pass& pass = m_passes[p];
+        if (!pass.Live)
+            continue;
+        for (size_t i = 0; i < pass.Reads.size(); ++i)
+            m_resources[pass.Reads[i]].Description.Texture = true;
+        std::vector<int> used(pass.Reads);
+        for (size_t i = 0; i < pass.Writes.size(); ++i)
+            used.push_back(pass.Writes[i].Resource);
+        for (size_t i = 0; i < used.size(); ++i) {
+            Resource& resource = m_resources[used[i]];
+            if (resource.First < 0)
+                resource.First = p;
+            resource.Last = p;
+        }
+    }
+}
+
+// Surfaces in order of first use, each into the first slot of the same
+// size and kind that the previous occupant is done with.
+inline void RenderGraph::AssignSlots()
+{
+    m_slots.clear();
+    std::vector<int> slotEnds;
+    for (int p = 0; p < (int) m_passes.size(); ++p) {
+        for (size_t i = 0; i < m_resources.size(); ++i) {
+            Resource& resource = m_resources[i];
+            if (resource.First != p || resource.Imported)
+                continue;
+            const RenderGraphSlot& wanted = resource.Description;
+            int slot = -1;
+            for (size_t s = 0; s < m_slots.size() && slot < 0; ++s) {
+                const RenderGraphSlot& candidate = m_slots[s];
+                if (slotEnds[s] < p && candidate.Width == wanted.Width &&
+                    candidate.Height == wanted.Height && candidate.Format == wanted.Format &&
+                    candidate.Texture == wanted.Texture)
+                    slot = (int) s;
+            }
+            if (slot < 0) {
+                m_slots.push_back(wanted);
+                slotEnds.push_back(0);
+                slot = (int) m_slots.size() - 1;
+            }
+            slotEnds[slot] = resource.Last;
+            resource.Slot = slot;
+        }
+    }
+}
+
+// A write loads if the pass asked for it; and the attachment can go once
+// no later pass uses it, unless it's imported.
+inline void RenderGraph::BuildSteps()
+{
+    m_steps.clear();
+    for (int p = 0; p < (int) m_passes.size(); ++p) {
+        const Pass& pass = m_passes[p];
+        if (!pass.Live)
+            continue;
+        RenderGraphStep step;
+        step.Pass = p;
+        for (size_t i = 0; i < pass.Writes.size(); ++i) {
+            const Resource& resource = m_resources[pass.Writes[i].Resource];
+            RenderGraphAttachment attachment = {
+                pass.Writes[i].Resource, resource.Slot, pass.Writes[i].Load,
+                !resource.Imported && resource.Last == p,
+            };
+            step.Outputs.push_back(attachment);
+        }
+        m_steps.push_back(step);
+    }
+}
+
+inline int RenderGraph::GetAllocatedBytes() const
+{
+    int bytes = 0;
+    for (size_t i = 0; i < m_slots.size(); ++i)
+        bytes += m_slots[i].GetBytes();
+    return bytes;
+}
+
+inline int RenderGraph::GetUnaliasedBytes() const
+{
+    int bytes = 0;
+    for (size_t i = 0; i < m_resources.size(); ++i)
+        if (!m_resources[i].Imported && m_resources[i].First >= 0)
+            bytes += m_resources[i].Description.GetBytes();
+    return bytes;
+}
@@ -0,0 +1,636 @@
+#pragma once
+#include "ParallelFor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdint.h>
+#include <vector>
+
+// A CPU stand-in for the part of OpenGL ES that the samples lean on, so
+// that rendering engines can run headless on machines without a GPU:
+// indexed triangles and lines, a viewport, depth testing, three blending
+// modes, texturing with nearest or bilinear filtering, and rendering into
+// offscreen surfaces that can then be sampled, like an FBO's texture.
+//
+// Engines do their own vertex processing and hand over clip-space
+// positions with up to SoftwareMaxVaryings values to interpolate.  Draws
+// are clipped, set up, and binned into square tiles as they come in;
+// Flush then shades the tiles across threads.  Each tile takes its
+// primitives in the order they were drawn, so the image comes out the
+// same no matter how many threads there are.
+//
+// Images are stored bottom row first, like glReadPixels gives them back.
+
+static const int SoftwareMaxVaryings = 8;
+static const int SoftwareTileSize = 32;
+
+enum SoftwarePrimitive {
+    SoftwarePrimitiveTriangles,
+    SoftwarePrimitiveLines,
+};
+
+enum SoftwareBlend {
+    SoftwareBlendNone,
+    SoftwareBlendAdditive,  // GL_ONE, GL_ONE
+    SoftwareBlendAlpha,     // GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA
+};
+
+enum SoftwareDepthFunc {
+    SoftwareDepthLess,
+    SoftwareDepthLessEqual,
+    SoftwareDepthAlways,
+};
+
+enum SoftwareFilter {
+    SoftwareFilterNearest,
+    SoftwareFilterLinear,
+};
+
+// RGBA with eight bits per channel; serves as both texture and color
+// buffer.
+struct SoftwareImage {
+    SoftwareImage() : Width(0), Height(0) {}
+    void Resize(int width, int height)
+    {
+        Width = width;
+        Height = height;
+        Texels.assign(width * height * 4, 0);
+    }
+    int Width;
+    int Height;
+    std::vector<unsigned char> Texels;
+};
+
+struct SoftwareSurface {
+    void Resize(int width, int height)
+    {
+        Color.Resize(width, height);
+        Depth.assign(width * height, 1.0f);
+    }
+    SoftwareImage Color;
+    std::vector<float> Depth;
+};
+
+struct SoftwareVertex {
+    float Position[4];
+    float Varyings[SoftwareMaxVaryings];
+};
+
+// The fragment stage.  Without one, varyings 0 to 3 are the color, and a
+// texture gets sampled at varyings 4 and 5 and multiplied in, like
+// GL_MODULATE.  Shaders run on several threads at once.
+struct ISoftwareShader {
+    virtual void Shade(const float* varyings, float* color) const = 0;
+    virtual ~ISoftwareShader() {}
+};
+
+struct SoftwareState {
+    SoftwareState() :
+        DepthTest(false),
+        DepthWrite(true),
+        DepthFunc(SoftwareDepthLess),
+        Blend(SoftwareBlendNone),
+        CullBackFaces(false),
+        VaryingCount(4),
+        Texture(0),
+        Filter(SoftwareFilterLinear),
+        ClampToEdge(false),
+        Shader(0)
+    {
+        Viewport[0] = Viewport[1] = Viewport[2] = Viewport[3] = 0;
+    }
+    int Viewport[4];    // x, y, width, height from the lower left
+    bool DepthTest;
+    bool DepthWrite;
+    SoftwareDepthFunc DepthFunc;
+    SoftwareBlend Blend;
+    bool CullBackFaces; // counterclockwise faces the front
+    int VaryingCount;
+    const SoftwareImage* Texture;
+    SoftwareFilter Filter;
+    bool ClampToEdge;   // otherwise texture coordinates repeat
+    const ISoftwareShader* Shader;
+};
+
+// The work that went into the frame, for spotting regressions.
+struct SoftwareStats {
+    SoftwareStats() :
+        DrawCalls(0), Vertices(0), Primitives(0), Clipped(0), Culled(0),
+        TileBins(0), Fragments(0), FragmentsWritten(0) {}
+    int DrawCalls;
+    int Vertices;
+    int Primitives;
+    int Clipped;            // wholly outside the view volume
+    int Culled;             // back facing or without area
+    int TileBins;           // primitives times the tiles they touch
+    int Fragments;          // pixels covered
+    int FragmentsWritten;   // pixels that passed the depth test
+};
+
+// Samples with the given filter; coordinates outside of [0, 1] repeat
+// unless clamped.
+inline void SampleSoftwareImage(const SoftwareImage& image, SoftwareFilter filter, bool clamp,
+                                float s, float t, float* color)
+{
+    int w = image.Width, h = image.Height;
+    const unsigned char* texels = &image.Texels[0];
+    if (filter == SoftwareFilterNearest) {
+        int x = (int) std::floor(s * w), y = (int) std::floor(t * h);
+        x = clamp ? std::min(std::max(x, 0), w - 1) : ((x % w) + w) % w;
+        y = clamp ? std::min(std::max(y, 0), h - 1) : ((y % h) + h) % h;
+        const unsigned char* texel = texels + (y * w + x) * 4;
+        for (int c = 0; c < 4; ++c)
+            color[c] = texel[c] * (1.0f / 255);
+        return;
+    }
+
+    float u = s * w - 0.5f, v = t * h - 0.5f;
+    int x0 = (int) std::floor(u), y0 = (int) std::floor(v);
+    float fx = u - x0, fy = v - y0;
+    int xs[2] = { x0, x0 + 1 }, ys[2] = { y0, y0 + 1 };
+    for (int i = 0; i < 2; ++i) {
+        xs[i] = clamp ? std::min(std::max(xs[i], 0), w - 1) : ((xs[i] % w) + w) % w;
+        ys[i] = clamp ? std::min(std::max(ys[i], 0), h - 1) : ((ys[i] % h) + h) % h;
+    }
+    const unsigned char* a = texels + (ys[0] * w + xs[0]) * 4;
+    const unsigned char* b = texels + (ys[0] * w + xs[1]) * 4;
+    const unsigned char* c = texels + (ys[1] * w + xs[0]) * 4;
+    const unsigned char* d = texels + (ys[1] * w + xs[1]) * 4;
+    for (int i = 0; i < 4; ++i) {
+        float bottom = a[i] + (b[i] - a[i]) * fx;
+        float top = c[i] + (d[i] - c[i]) * fx;
+        color[i] = (bottom + (top - bottom) * fy) * (1.0f / 255);
+    }
+}
+
+class SoftwareRasterizer {
+public:
+    SoftwareRasterizer(int width, int height, int threadCount = 1);
+    SoftwareSurface& GetDefaultSurface() { return m_defaultSurface; }
+    SoftwareSurface& GetSurface() { return *m_surface; }
+    void SetSurface(SoftwareSurface* surface);
+    void Clear(const float* color, bool clearColor = true, bool clearDepth = true);
+    void Draw(const SoftwareState& state, const SoftwareVertex* vertices, int vertexCount,
+              const unsigned short* indices, int indexCount, SoftwarePrimitive primitive);
+    void Flush();
+    int GetThreadCount() const { return m_threadCount; }
+    const SoftwareStats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = SoftwareStats(); }
+    void operator()(int begin, int end);
+private:
+    struct ClipVertex {
+        float Position[4];
+        float Varyings[SoftwareMaxVaryings];
+    };
+    // Positions are in sixteenths of a pixel; varyings are divided by w,
+    // to be interpolated in screen space and multiplied back per pixel.
+    struct SetupVertex {
+        int64_t X;
+        int64_t Y;
+        float Z;
+        float InvW;
+        float Varyings[SoftwareMaxVaryings];
+    };
+    struct Primitive {
+        int State;
+        int First;
+        int VertexCount;
+        int Bounds[4];  // pixel rectangle, inclusive-exclusive
+    };
+    struct TileCounts {
+        int Fragments;
+        int FragmentsWritten;
+    };
+    static const int GuardBand = 4;
+    static const int SubpixelBits = 4;
+    int ClipPolygon(ClipVertex* polygon, int count, int varyingCount) const;
+    void SetUp(const ClipVertex* polygon, int count, int stateIndex);
+    void Bin(const Primitive& primitive);
+    void RasterizeTriangle(const Primitive& primitive, const int* tile, TileCounts& counts);
+    void RasterizeLine(const Primitive& primitive, const int* tile, TileCounts& counts);
+    void ShadeFragment(const SoftwareState& state, int x, int y, float z, const float* varyings,
+                       TileCounts& counts);
+    SoftwareSurface m_defaultSurface;
+    SoftwareSurface* m_surface;
+    int m_threadCount;
+    int m_tilesX;
+    int m_tilesY;
+    std::vector<SoftwareState> m_states;
+    std::vector<SetupVertex> m_vertices;
+    std::vector<Primitive> m_primitives;
+    std::vector<std::vector<int> > m_bins;
+    std::vector<TileCounts> m_tileCounts;
+    SoftwareStats m_stats;
+};
+
+inline SoftwareRasterizer::SoftwareRasterizer(int width, int height, int threadCount) :
+    m_surface(&m_defaultSurface),
+    m_threadCount(threadCount),
+    m_tilesX(0),
+    m_tilesY(0)
+{
+    m_defaultSurface.Resize(width, height);
+}
+
+// Like binding another framebuffer; what's been drawn so far gets
+// finished first, so the old surface can be sampled from.
+inline void SoftwareRasterizer::SetSurface(SoftwareSurface* surface)
+{
+    Flush();
+    m_surface = surface ? surface : &m_defaultSurface;
+}
+
+inline void SoftwareRasterizer::Clear(const float* color, bool clearColor, bool clearDepth)
+{
+    Flush();
+    SoftwareSurface& surface = *m_surface;
+    if (clearDepth)
+        std::fill(surface.Depth.begin(), surface.Depth.end(), 1.0f);
+    if (!clearColor)
+        return;
+    unsigned char texel[4];
+    for (int c = 0; c < 4; ++c)
+        texel[c] = (unsigned char) (std::min(std::max(color[c], 0.0f), 1.0f) * 255 + 0.5f);
+    std::vector<unsigned char>& texels = surface.Color.Texels;
+    for (size_t i = 0; i < texels.size(); i += 4)
+        std::copy(texel, texel + 4, &texels[i]);
+}
+
+// Indices pick out triangles or pairs of line ends, as with glDrawElements.
+inline void SoftwareRasterizer::Draw(const SoftwareState& state, const SoftwareVertex* vertices,
+                                     int vertexCount, const unsigned short* indices,
+                                     int indexCount, SoftwarePrimitive primitive)
+{
+    // The bins are all empty after a flush, so they can be resized for
+    // whatever surface is current.
+    if (m_primitives.empty()) {
+        m_tilesX = (m_surface->Color.Width + SoftwareTileSize - 1) / SoftwareTileSize;
+        m_tilesY = (m_surface->Color.Height + SoftwareTileSize - 1) / SoftwareTileSize;
+        m_bins.resize(m_tilesX * m_tilesY);
+    }
+
+    ++m_stats.DrawCalls;
+    m_stats.Vertices += vertexCount;
+    int stateIndex = (int) m_states.size();
+    m_states.push_back(state);
+
+    int corners = primitive == SoftwarePrimitiveTriangles ? 3 : 2;
+    int varyingCount = std::min(state.VaryingCount, SoftwareMaxVaryings);
+    ClipVertex polygon[3 + 6];
+    for (int i = 0; i + corners <= indexCount; i += corners) {
+        ++m_stats.Primitives;
+        for (int j = 0; j < corners; ++j) {
+            const SoftwareVertex& vertex = vertices[indices[i + j]];
+            std::copy(vertex.Position, vertex.Position + 4, polygon[j].Position);
+            std::copy(vertex.Varyings, vertex.Varyings + varyingCount, polygon[j].Varyings);
+        }
+        int count = ClipPolygon(polygon, corners, varyingCount);
+        if (count < corners) {
+            ++m_stats.Clipped;
+            continue;
+        }
+        SetUp(polygon, count, stateIndex);
+    }
+}
+
+// Clips against the near plane, and against a guard band a few times the
+// size of the view, which keeps the fixed-point positions small.  Anything
+// else outside the viewport is left for the rasterizer to skip.  Returns
+// the new number of corners, which is zero when nothing is left.
+inline int SoftwareRasterizer::ClipPolygon(ClipVertex* polygon, int count, int varyingCount) const
+{
+    const float Planes[5][4] = {
+        { 0, 0, 1, 1 },
+        { 1, 0, 0, GuardBand },
+        { -1, 0, 0, GuardBand },
+        { 0, 1, 0, GuardBand },
+        { 0, -1, 0, GuardBand },
+    };
+    bool isLine = count == 2;
+    ClipVertex scratch[3 + 6];
+    for (int p = 0; p < 5 && count > 0; ++p) {
+        const float* plane = Planes[p];
+        float distances[3 + 6];
+        bool inside = true;
+        for (int i = 0; i < count; ++i) {
+            const float* v = polygon[i].Position;
+            distances[i] = plane[0] * v[0] + plane[1] * v[1] + plane[2] * v[2] + plane[3] * v[3];
+            inside = inside && distances[i] >= 0;
+        }
+        if (inside)
+            continue;
+
+        int edges = isLine ? 1 : count;
+        int out = 0;
+        for (int i = 0; i < edges; ++i) {
+            int j = (i + 1) % count;
+            const ClipVertex& a = polygon[i];
+            const ClipVertex& b = polygon[j];
+            if (distances[i] >= 0)
+                scratch[out++] = a;
+            if ((distances[i] >= 0) != (distances[j] >= 0)) {
+                float t = distances[i] / (distances[i] - distances[j]);
+                ClipVertex& v = scratch[out++];
+                for (int c = 0; c < 4; ++c)
+                    v.Position[c] = a.Position[c] + (b.Position[c] - a.Position[c]) * t;
+                for (int c = 0; c < varyingCount; ++c)
+                    v.Varyings[c] = a.Varyings[c] + (b.Varyings[c] - a.Varyings[c]) * t;
+            }
+            if (isLine && distances[j] >= 0)
+                scratch[out++] = b;
+        }
+        count = out;
+        std::copy(scratch, scratch + count, polygon);
+    }
+    return count;
+}
+
+// Projects the corners into the viewport, then fans polygons out into
+// triangles and bins everything into the tiles that its bounds touch.
+inline void SoftwareRasterizer::SetUp(const ClipVertex* polygon, int count, int stateIndex)
+{
+    const SoftwareState& state = m_states[stateIndex];
+    const int* viewport = state.Viewport;
+    int varyingCount = std::min(state.VaryingCount, SoftwareMaxVaryings);
+    int first = (int) m_vertices.size();
+    for (int i = 0; i < count; ++i) {
+        const ClipVertex& clip = polygon[i];
+        float invW = 1 / clip.Position[3];
+        float x = viewport[0] + (clip.Position[0] * invW + 1) * 0.5f * viewport[2];
+        float y = viewport[1] + (clip.Position[1] * invW + 1) * 0.5f * viewport[3];
+        SetupVertex vertex;
+        vertex.X = (int64_t) std::floor(x * (1 << SubpixelBits) + 0.5f);
+        vertex.Y = (int64_t) std::floor(y * (1 << SubpixelBits) + 0.5f);
+        vertex.Z = (clip.Position[2] * invW + 1) * 0.5f;
+        vertex.InvW = invW;
+        for (int c = 0; c < varyingCount; ++c)
+            vertex.Varyings[c] = clip.Varyings[c] * invW;
+        m_vertices.push_back(vertex);
+    }
+
+    int width = m_surface->Color.Width, height = m_surface->Color.Height;
+    int clipRect[4] = {
+        std::max(viewport[0], 0),
+        std::max(viewport[1], 0),
+        std::min(viewport[0] + viewport[2], width),
+        std::min(viewport[1] + viewport[3], height),
+    };
+
+    int primitives = count == 2 ? 1 : count - 2;
+    for (int i = 0; i < primitives; ++i) {
+        Primitive primitive;
+        primitive.State = stateIndex;
+        if (count == 2) {
+            primitive.First = first;
+            primitive.VertexCount = 2;
+        } else {
+            // Fans share the first corner, so copy it in front of each
+            // triangle after the first.
+            if (i > 0) {
+                SetupVertex corners[3] = { m_vertices[first], m_vertices[first + i + 1],
+                                           m_vertices[first + i + 2] };
+                primitive.First = (int) m_vertices.size();
+                m_vertices.insert(m_vertices.end(), corners, corners + 3);
+            } else {
+                primitive.First = first;
+            }
+            primitive.VertexCount = 3;
+
+            const SetupVertex* v = &m_vertices[primitive.First];
+            int64_t area = (v[1].X - v[0].X) * (v[2].Y - v[0].Y) -
+                           (v[2].X - v[0].X) * (v[1].Y - v[0].Y);
+            if (area == 0 || (state.CullBackFaces && area < 0)) {
+                ++m_stats.Culled;
+                continue;
+            }
+        }
+
+        const SetupVertex* v = &m_vertices[primitive.First];
+        int64_t minX = v[0].X, maxX = v[0].X, minY = v[0].Y, maxY = v[0].Y;
+        for (int j = 1; j < primitive.VertexCount; ++j) {
+            minX = std::min(minX, v[j].X);
+            maxX = std::max(maxX, v[j].X);
+            minY = std::min(minY, v[j].Y);
+            maxY = std::max(maxY, v[j].Y);
+        }
+        primitive.Bounds[0] = std::max((int) (minX >> SubpixelBits) - 1, clipRect[0]);
+        primitive.Bounds[1] = std::max((int) (minY >> SubpixelBits) - 1, clipRect[1]);
+        primitive.Bounds[2] = std::min((int) (maxX >> SubpixelBits) + 2, clipRect[2]);
+        primitive.Bounds[3] = std::min((int) (maxY >> SubpixelBits) + 2, clipRect[3]);
+        if (primitive.Bounds[0] >= primitive.Bounds[2] || primitive.Bounds[1] >= primitive.Bounds[3])
+            continue;
+        Bin(primitive);
+    }
+}
+
+inline void SoftwareRasterizer::Bin(const Primitive& primitive)
+{
+    int index = (int) m_primitives.size();
+    m_primitives.push_back(primitive);
+    int tx0 = primitive.Bounds[0] / SoftwareTileSize;
+    int ty0 = primitive.Bounds[1] / SoftwareTileSize;
+    int tx1 = (primitive.Bounds[2] - 1) / SoftwareTileSize;
+    int ty1 = (primitive.Bounds[3] - 1) / SoftwareTileSize;
+    for (int ty = ty0; ty <= ty1; ++ty)
+        for (int tx = tx0; tx <= tx1; ++tx)
+            m_bins[ty * m_tilesX + tx].push_back(index);
+    m_stats.TileBins += (tx1 - tx0 + 1) * (ty1 - ty0 + 1);
+}
+
+// Shades every binned tile, then starts over with empty bins.
+inline void SoftwareRasterizer::Flush()
+{
+    if (m_primitives.empty()) {
+        m_states.clear();
+        m_vertices.clear();
+        return;
+    }
+
+    int tileCount = m_tilesX * m_tilesY;
+    m_tileCounts.assign(tileCount, TileCounts());
+    ParallelFor(tileCount, m_threadCount, *this);
+    for (int i = 0; i < tileCount; ++i) {
+        m_stats.Fragments += m_tileCounts[i].Fragments;
+        m_stats.FragmentsWritten += m_tileCounts[i].FragmentsWritten;
+        m_bins[i].clear();
+    }
+    m_states.clear();
+    m_vertices.clear();
+    m_primitives.clear();
+}
+
+// One thread's share of the tiles.
+inline void SoftwareRasterizer::operator()(int begin, int end)
+{
+    int width = m_surface->Color.Width, height = m_surface->Color.Height;
+    for (int i = begin; i < end; ++i) {
+        int tx = i % m_tilesX, ty = i / m_tilesX;
+        int tile[4] = {
+            tx * SoftwareTileSize,
+            ty * SoftwareTileSize,
+            std::min((tx + 1) * SoftwareTileSize, width),
+            std::min((ty + 1) * SoftwareTileSize, height),
+        };
+        TileCounts& counts = m_tileCounts[i];
+        const std::vector<int>& bin = m_bins[i];
+        for (size_t j = 0; j < bin.size(); ++j) {
+            const Primitive& primitive = m_primitives[bin[j]];
+            if (primitive.VertexCount == 3)
+                RasterizeTriangle(primitive, tile, counts);
+            else
+                RasterizeLine(primitive, tile, counts);
+        }
+    }
+}
+
+// Edge functions in fixed point, so that neighbouring triangles agree
+// exactly on their shared edges.  Pixels whose centers land right on an
+// edge belong to the triangle on its left or top side.
+inline void SoftwareRasterizer::RasterizeTriangle(const Primitive& primitive, const int* tile,
+                                                  TileCounts& counts)
+{
+    const SoftwareState& state = m_states[primitive.State];
+    const SetupVertex* v[3] = {
+        &m_vertices[primitive.First],
+        &m_vertices[primitive.First + 1],
+        &m_vertices[primitive.First + 2],
+    };
+    int64_t area = (v[1]->X - v[0]->X) * (v[2]->Y - v[0]->Y) -
+                   (v[2]->X - v[0]->X) * (v[1]->Y - v[0]->Y);
+    if (area < 0) {
+        std::swap(v[1], v[2]);
+        area = -area;
+    }
+
+    int x0 = std::max(tile[0], primitive.Bounds[0]);
+    int y0 = std::max(tile[1], primitive.Bounds[1]);
+    int x1 = std::min(tile[2], primitive.Bounds[2]);
+    int y1 = std::min(tile[3], primitive.Bounds[3]);
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    // Edge i is opposite corner i, and is positive on the inside.
+    const int64_t Half = 1 << (SubpixelBits - 1);
+    int64_t px = ((int64_t) x0 << SubpixelBits) + Half;
+    int64_t py = ((int64_t) y0 << SubpixelBits) + Half;
+    int64_t rows[3], stepX[3], stepY[3], bias[3];
+    for (int i = 0; i < 3; ++i) {
+        const SetupVertex& a = *v[(i + 1) % 3];
+        const SetupVertex& b = *v[(i + 2) % 3];
+        int64_t dx = b.X - a.X, dy = b.Y - a.Y;
+        rows[i] = dx * (py - a.Y) - dy * (px - a.X);
+        stepX[i] = -dy << SubpixelBits;
+        stepY[i] = dx << SubpixelBits;
+        bool topLeft = dy < 0 || (dy == 0 && dx < 0);
+        bias[i] = topLeft ? 0 : -1;
+    }
+
+    float invArea = 1.0f / (float) area;
+    int varyingCount = std::min(state.VaryingCount, SoftwareMaxVaryings);
+    float varyings[SoftwareMaxVaryings];
+    for (int y = y0; y < y1; ++y) {
+        int64_t e[3] = { rows[0], rows[1], rows[2] };
+        for (int x = x0; x < x1; ++x) {
+            if (e[0] + bias[0] >= 0 && e[1] + bias[1] >= 0 && e[2] + bias[2] >= 0) {
+                float b0 = e[0] * invArea, b1 = e[1] * invArea, b2 = e[2] * invArea;
+                float z = b0 * v[0]->Z + b1 * v[1]->Z + b2 * v[2]->Z;
+                float w = 1 / (b0 * v[0]->InvW + b1 * v[1]->InvW + b2 * v[2]->InvW);
+                for (int c = 0; c < varyingCount; ++c)
+                    varyings[c] = (b0 * v[0]->Varyings[c] + b1 * v[1]->Varyings[c] +
+                                   b2 * v[2]->Varyings[c]) * w;
+                ShadeFragment(state, x, y, z, varyings, counts);
+            }
+            for (int i = 0; i < 3; ++i)
+                e[i] += stepX[i];
+        }
+        for (int i = 0; i < 3; ++i)
+            rows[i] += stepY[i];
+    }
+}
+
+// One pixel per step along the major axis, at the pixel centers.
+inline void SoftwareRasterizer::RasterizeLine(const Primitive& primitive, const int* tile,
+                                              TileCounts& counts)
+{
+    const SoftwareState& state = m_states[primitive.State];
+    const SetupVertex& a = m_vertices[primitive.First];
+    const SetupVertex& b = m_vertices[primitive.First + 1];
+    const float Scale = 1.0f / (1 << SubpixelBits);
+    float ax = a.X * Scale, ay = a.Y * Scale, bx = b.X * Scale, by = b.Y * Scale;
+    bool xMajor = std::fabs(bx - ax) >= std::fabs(by - ay);
+    float start = xMajor ? ax : ay, end = xMajor ? bx : by;
+    float length = end - start;
+    if (length == 0)
+        return;
+
+    int x0 = std::max(tile[0], primitive.Bounds[0]);
+    int y0 = std::max(tile[1], primitive.Bounds[1]);
+    int x1 = std::min(tile[2], primitive.Bounds[2]);
+    int y1 = std::min(tile[3], primitive.Bounds[3]);
+    int first = (int) std::ceil(std::min(start, end) - 0.5f);
+    int last = (int) std::ceil(std::max(start, end) - 0.5f);
+    first = std::max(first, xMajor ? x0 : y0);
+    last = std::min(last, xMajor ? x1 : y1);
+
+    int varyingCount = std::min(state.VaryingCount, SoftwareMaxVaryings);
+    float varyings[SoftwareMaxVaryings];
+    for (int major = first; major < last; ++major) {
+        float t = (major + 0.5f - start) / length;
+        float minor = xMajor ? ay + (by - ay) * t : ax + (bx - ax) * t;
+        int x = xMajor ? major : (int) std::floor(minor);
+        int y = xMajor ? (int) std::floor(minor) : major;
+        if (x < x0 || x >= x1 || y < y0 || y >= y1)
+            continue;
+        float z = a.Z + (b.Z - a.Z) * t;
+        float w = 1 / (a.InvW + (b.InvW - a.InvW) * t);
+        for (int c = 0; c < varyingCount; ++c)
+            varyings[c] = (a.Varyings[c] + (b.Varyings[c] - a.Varyings[c]) * t) * w;
+        ShadeFragment(state, x, y, z, varyings, counts);
+    }
+}
+
+inline void SoftwareRasterizer::ShadeFragment(const SoftwareState& state, int x, int y, float z,
+                                              const float* varyings, TileCounts& counts)
+{
+    ++counts.Fragments;
+    if (z < 0 || z > 1)
+        return;
+
+    SoftwareSurface& surface = *m_surface;
+    int index = y * surface.Color.Width + x;
+    if (state.DepthTest) {
+        float depth = surface.Depth[index];
+        bool pass = state.DepthFunc == SoftwareDepthAlways ||
+                    (state.DepthFunc == SoftwareDepthLess && z < depth) ||
+                    (state.DepthFunc == SoftwareDepthLessEqual && z <= depth);
+        if (!pass)
+            return;
+        if (state.DepthWrite)
+            surface.Depth[index] = z;
+    }
+
+    float color[4];
+    if (state.Shader) {
+        state.Shader->Shade(varyings, color);
+    } else {
+        for (int c = 0; c < 4; ++c)
+            color[c] = c < state.VaryingCount ? varyings[c] : 1;
+        if (state.Texture) {
+            float texel[4];
+            SampleSoftwareImage(*state.Texture, state.Filter, state.ClampToEdge,
+                                varyings[4], varyings[5], texel);
+            for (int c = 0; c < 4; ++c)
+                color[c] *= texel[c];
+        }
+    }
+
+    unsigned char* dest = &surface.Color.Texels[index * 4];
+    for (int c = 0; c < 4; ++c) {
+        float d = dest[c] * (1.0f / 255), s = color[c];
+        if (state.Blend == SoftwareBlendAdditive)
+            s += d;
+        else if (state.Blend == SoftwareBlendAlpha)
+            s = s * color[3] + d * (1 - color[3]);
+        dest[c] = (unsigned char) (std::min(std::max(s, 0.0f), 1.0f) * 255 + 0.5f);
+    }
+    ++counts.FragmentsWritten;
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include "FrameQueue.hpp"
+
+// Streams frames from a FrameQueue into a ring of three textures.  The
+// textures are allocated once and then only ever updated in place with
+// glTexSubImage2D, so the driver never has to allocate or orphan storage
+// mid-stream.  Each update goes into the texture after the one that was
+// last drawn with, which leaves a frame of slack before the GPU might
+// still be reading a texture that's being written.
+//
+// Include the ES1 or ES2 headers before this file, and call everything on
+// the thread that owns the context.
+
+class StreamingTexture {
+public:
+    StreamingTexture() : m_width(0), m_height(0), m_format(0), m_type(0), m_current(-1)
+    {
+        m_textures[0] = m_textures[1] = m_textures[2] = 0;
+    }
+
+    // Frames must be width by height, tightly packed, in the given format
+    // and type.  Leaves the last texture bound.
+    void Create(int width, int height, GLenum format, GLenum type = GL_UNSIGNED_BYTE)
+    {
+        m_width = width;
+        m_height = height;
+        m_format = format;
+        m_type = type;
+        glGenTextures(3, m_textures);
+        for (int i = 0; i < 3; ++i) {
+            glBindTexture(GL_TEXTURE_2D, m_textures[i]);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, type, 0);
+        }
+    }
+
+    int GetFrameByteCount() const
+    {
+        int bytesPerPixel = 4;
+        if (m_type != GL_UNSIGNED_BYTE)
+            bytesPerPixel = 2;
+        else if (m_format == GL_RGB)
+            bytesPerPixel = 3;
+        else if (m_format == GL_LUMINANCE_ALPHA)
+            bytesPerPixel = 2;
+        else if (m_format == GL_LUMINANCE || m_format == GL_ALPHA)
+            bytesPerPixel = 1;
+        return m_width * m_height * bytesPerPixel;
+    }
+
+    // Uploads the newest frame in the queue, if there's one, and returns
+    // it; otherwise returns null and keeps drawing with the last one.
+    // Binds the texture it wrote to.
+    const StreamFrame* Update(FrameQueue& queue)
+    {
+        assert(queue.GetByteCount() == GetFrameByteCount());
+        const StreamFrame* frame = queue.Acquire();
+        if (!frame)
+            return 0;
+        m_current = (m_current + 1) % 3;
+        glBindTexture(GL_TEXTURE_2D, m_textures[m_current]);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_width, m_height,
+                        m_format, m_type, frame->Pixels);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        return frame;
+    }
+
+    // The texture holding the newest frame, or zero before the first.
+    GLuint GetTexture() const { return m_current < 0 ? 0 : m_textures[m_current]; }
+
+    void Destroy()
+    {
+        glDeleteTextures(3, m_textures);
+        m_textures[0] = m_textures[1] = m_textures[2] = 0;
+        m_current = -1;
+    }
+
+private:
+    int m_width;
+    int m_height;
+    GLenum m_format;
+    GLenum m_type;
+    GLuint m_textures[3];
+    int m_current;
+};
@@ -0,0 +1,73 @@
+#pragma once
+#include <cassert>
+
+// Spreads a jittered supersample over frames.  Each frame renders one
+// sample and blends it into a history buffer with weight 1 / n, which
+// keeps the history at the mean of the n samples so far; once every sample
+// is in, there's nothing left to render until something changes.
+//
+//     if (changed)
+//         accumulator.Reset();
+//     if (!accumulator.IsConverged()) {
+//         render sample accumulator.GetSampleIndex()
+//         blend it in with alpha accumulator.GetWeight()
+//         accumulator.Advance();
+//     }
+//     draw the history to the screen
+//
+// With a history limit, Decay keeps what's there but caps the weight it
+// carries, so the newest samples count for at least 1 / (limit + 1).  That
+// trades a short trail on whatever moved for not dropping back to one
+// sample, and suits scenes where most of the screen holds still.
+class TemporalAccumulator {
+public:
+    TemporalAccumulator(int sampleCount, int historyLimit = 0) :
+        m_sampleCount(sampleCount), m_historyLimit(historyLimit), m_count(0), m_next(0)
+    {
+        assert(sampleCount > 0 && historyLimit >= 0);
+    }
+    void Reset()
+    {
+        m_count = 0;
+        m_next = 0;
+    }
+    // Falls back to Reset without a history limit.
+    void Decay()
+    {
+        if (!m_historyLimit)
+            Reset();
+        else if (m_count > m_historyLimit)
+            m_count = m_historyLimit;
+    }
+    bool IsConverged() const { return m_count >= m_sampleCount; }
+    // Samples start from the first after a reset, and cycle, so a decayed
+    // history keeps getting fresh offsets.
+    int GetSampleIndex() const { return m_next; }
+    int GetSampleCount() const { return m_sampleCount; }
+    // How many samples the history holds.
+    int GetCount() const { return m_count; }
+    // The blend weight for the sample being rendered.
+    float GetWeight() const { return 1.0f / (m_count + 1); }
+    void Advance()
+    {
+        if (!IsConverged())
+            ++m_count;
+        m_next = (m_next + 1) % m_sampleCount;
+    }
+private:
+    int m_sampleCount;
+    int m_historyLimit;
+    int m_count;
+    int m_next;
+};
+
+// What GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA blending does to an 8-bit
+// history: the alpha is quantized to 8 bits like any vertex color, and the
+// blended result is rounded.
+inline void BlendTemporalSample(unsigned char* history, const unsigned char* sample,
+                                int count, float weight)
+{
+    int alpha = (int) (weight * 255 + 0.5f);
+    for (int i = 0; i < count; ++i)
+        history[i] = (unsigned char) ((sample[i] * alpha + history[i] * (255 - alpha) + 127) / 255);
+}
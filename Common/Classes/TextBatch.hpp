@@ -0,0 +1,122 @@
+#pragma once
+#include "TextLayout.hpp"
+#include <string>
+#include <vector>
+
+// Textured quads for a whole string, so that a renderer can keep them in a
+// vertex buffer and draw the string with a single call.  The quads are only
+// rebuilt when the string, its style, or its position changes, or when the
+// glyph cache has evicted something since, because an evicted glyph's
+// texels can be reused by another.
+//
+// Each vertex is x, y, s, t, with y going up; the quads are ordered as in
+// BuildQuadIndices.
+
+struct TextBatchStats {
+    TextBatchStats() : Updates(0), Rebuilds(0) {}
+    int Updates;
+    int Rebuilds;
+};
+
+class TextBatch {
+public:
+    TextBatch() : m_x(0), m_y(0), m_serial(0), m_generation(-1) {}
+    bool Update(GlyphCache& cache, TextLayout& layout, const std::string& text,
+                int x, int y, const TextStyle& style = TextStyle());
+    bool Matches(const std::string& text, int x, int y, const TextStyle& style) const;
+    const std::vector<float>& GetVertices() const { return m_vertices; }
+    int GetQuadCount() const { return (int) m_vertices.size() / VerticesPerQuad / 4; }
+    const TextBatchStats& GetStats() const { return m_stats; }
+    static const int VerticesPerQuad = 4;
+    static const int IndicesPerQuad = 6;
+private:
+    void BuildVertices(const GlyphCache& cache, const TextRun& run);
+    std::string m_text;
+    TextStyle m_style;
+    int m_x;
+    int m_y;
+    int m_serial;
+    int m_generation;
+    std::vector<float> m_vertices;
+    TextBatchStats m_stats;
+};
+
+// (x, y) is the start of the first line's baseline.  Returns true if the
+// vertices changed and need uploading again.
+inline bool TextBatch::Update(GlyphCache& cache, TextLayout& layout, const std::string& text,
+                              int x, int y, const TextStyle& style)
+{
+    ++m_stats.Updates;
+    if (Matches(text, x, y, style) && m_generation == cache.GetGeneration())
+        return false;
+
+    // The layout may have kept the run from before, in which case only the
+    // position can have changed.
+    const TextRun& run = layout.Layout(cache, text, style);
+    m_generation = cache.GetGeneration();
+    m_text = text;
+    m_style = style;
+    if (run.Serial == m_serial && x == m_x && y == m_y)
+        return false;
+
+    ++m_stats.Rebuilds;
+    m_x = x;
+    m_y = y;
+    m_serial = run.Serial;
+    BuildVertices(cache, run);
+    return true;
+}
+
+inline bool TextBatch::Matches(const std::string& text, int x, int y,
+                               const TextStyle& style) const
+{
+    return m_generation >= 0 && x == m_x && y == m_y && style == m_style && text == m_text;
+}
+
+inline void TextBatch::BuildVertices(const GlyphCache& cache, const TextRun& run)
+{
+    float scaleS = 1.0f / cache.GetWidth();
+    float scaleT = 1.0f / cache.GetHeight();
+    m_vertices.resize(run.Glyphs.size() * VerticesPerQuad * 4);
+    float* vertex = m_vertices.empty() ? 0 : &m_vertices[0];
+    for (size_t i = 0; i < run.Glyphs.size(); ++i) {
+        const PlacedGlyph& glyph = run.Glyphs[i];
+        const CachedGlyph& cached = glyph.Glyph;
+        float left = (float) (m_x + glyph.X);
+        float right = left + cached.Metrics.Width;
+        float bottom = (float) (m_y + glyph.Y);
+        float top = bottom + cached.Metrics.Height;
+
+        // The atlas is stored top row first.
+        float s0 = cached.X * scaleS;
+        float s1 = (cached.X + cached.Metrics.Width) * scaleS;
+        float t0 = cached.Y * scaleT;
+        float t1 = (cached.Y + cached.Metrics.Height) * scaleT;
+
+        const float corners[] = {
+            left, bottom, s0, t1,
+            right, bottom, s1, t1,
+            right, top, s1, t0,
+            left, top, s0, t0,
+        };
+        for (int j = 0; j < VerticesPerQuad * 4; ++j)
+            *vertex++ = corners[j];
+    }
+}
+
+// Two counterclockwise triangles per quad; the same indices serve every
+// batch, so renderers can share one index buffer.
+inline void BuildQuadIndices(int quadCount, std::vector<unsigned short>& indices)
+{
+    indices.resize(quadCount * TextBatch::IndicesPerQuad);
+    for (int i = 0; i < quadCount; ++i) {
+        unsigned short first = (unsigned short) (i * TextBatch::VerticesPerQuad);
+        unsigned short* index = &indices[i * TextBatch::IndicesPerQuad];
+        index[0] = first;
+        index[1] = first + 1;
+        index[2] = first + 2;
+        index[3] = first + 2;
+        index[4] = first + 3;
+        index[5] = first;
+    }
+}
@@ -0,0 +1,272 @@
+#pragma once
+#include "GlyphCache.hpp"
+#include <map>
+#include <string>
+#include <vector>
+
+// Turns UTF-8 strings into positioned glyphs, with kerning from the
+// rasterizer, greedy word wrapping at a maximum width, and left, centered,
+// or right aligned lines.  Finished runs are kept, keyed by string and
+// style, so text that doesn't change only gets laid out once.  A kept run
+// is laid out again if the glyph cache has evicted anything since, because
+// its atlas positions may have gone stale.
+
+enum TextAlignment {
+    TextAlignmentLeft,
+    TextAlignmentCenter,
+    TextAlignmentRight,
+};
+
+struct TextStyle {
+    TextStyle() : MaxWidth(0), LineHeight(0), Alignment(TextAlignmentLeft), Kerning(true) {}
+    bool operator==(const TextStyle& other) const
+    {
+        return MaxWidth == other.MaxWidth && LineHeight == other.LineHeight &&
+               Alignment == other.Alignment && Kerning == other.Kerning;
+    }
+    bool operator<(const TextStyle& other) const
+    {
+        if (MaxWidth != other.MaxWidth)
+            return MaxWidth < other.MaxWidth;
+        if (LineHeight != other.LineHeight)
+            return LineHeight < other.LineHeight;
+        if (Alignment != other.Alignment)
+            return Alignment < other.Alignment;
+        return Kerning < other.Kerning;
+    }
+    int MaxWidth;       // wrap lines wider than this; 0 never wraps
+    int LineHeight;     // 0 for the font's
+    TextAlignment Alignment;
+    bool Kerning;
+};
+
+struct PlacedGlyph {
+    int X;  // bottom-left corner of the bitmap, y up
+    int Y;
+    CachedGlyph Glyph;
+};
+
+// Positions are relative to the left end of the first line's baseline, with
+// y going up, so later lines have negative baselines.  Lines are aligned
+// within MaxWidth when wrapping, and within the widest line otherwise.
+struct TextRun {
+    std::vector<PlacedGlyph> Glyphs;
+    int Width;
+    int LineCount;
+    int LineHeight;
+    int Serial;     // new every time a run gets laid out
+};
+
+struct TextLayoutStats {
+    TextLayoutStats() : Requests(0), Layouts(0), Glyphs(0) {}
+    int Requests;
+    int Layouts;
+    int Glyphs;     // placed by actual layouts, not handed back from the cache
+};
+
+class TextLayout {
+public:
+    TextLayout(int capacity = 16);
+    const TextRun& Layout(GlyphCache& cache, const std::string& text,
+                          const TextStyle& style = TextStyle());
+    const TextLayoutStats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = TextLayoutStats(); }
+private:
+    typedef std::pair<std::string, TextStyle> Key;
+    struct Entry {
+        Key Text;
+        TextRun Run;
+        int Generation;
+        int LastUsed;
+    };
+    struct PendingGlyph {
+        CachedGlyph Glyph;
+        int PenX;
+        bool Space;
+    };
+    struct Line {
+        int First;
+        int End;
+        int Width;
+    };
+    void LayOut(GlyphCache& cache, const std::string& text, const TextStyle& style,
+                TextRun& run);
+    void FinishLine(TextRun& run, int count);
+    int m_capacity;
+    int m_clock;
+    int m_serial;
+    std::vector<Entry> m_entries;
+    std::map<Key, int> m_index;
+    std::vector<PendingGlyph> m_pending;
+    std::vector<Line> m_lines;
+    TextRun m_scratch;
+    TextLayoutStats m_stats;
+};
+
+// Capacity is the number of runs to keep; with none, every call lays out
+// from scratch.
+inline TextLayout::TextLayout(int capacity) :
+    m_capacity(capacity),
+    m_clock(0),
+    m_serial(0)
+{
+    m_entries.reserve(capacity);
+}
+
+// The run stays valid until the next call.
+inline const TextRun& TextLayout::Layout(GlyphCache& cache, const std::string& text,
+                                         const TextStyle& style)
+{
+    ++m_stats.Requests;
+    if (!m_capacity) {
+        LayOut(cache, text, style, m_scratch);
+        return m_scratch;
+    }
+
+    ++m_clock;
+    Key key(text, style);
+    std::map<Key, int>::iterator found = m_index.find(key);
+    int index;
+    if (found != m_index.end()) {
+        index = found->second;
+        Entry& entry = m_entries[index];
+        entry.LastUsed = m_clock;
+        if (entry.Generation == cache.GetGeneration())
+            return entry.Run;
+    } else if ((int) m_entries.size() < m_capacity) {
+        index = (int) m_entries.size();
+        m_entries.push_back(Entry());
+        m_index[key] = index;
+    } else {
+        index = 0;
+        for (int i = 1; i < m_capacity; ++i)
+            if (m_entries[i].LastUsed < m_entries[index].LastUsed)
+                index = i;
+        m_index.erase(m_entries[index].Text);
+        m_index[key] = index;
+    }
+
+    Entry& entry = m_entries[index];
+    entry.Text = key;
+    entry.LastUsed = m_clock;
+    LayOut(cache, text, style, entry.Run);
+
+    // Layout can evict glyphs too, but never the ones it just placed.
+    entry.Generation = cache.GetGeneration();
+    return entry.Run;
+}
+
+inline void TextLayout::LayOut(GlyphCache& cache, const std::string& text,
+                               const TextStyle& style, TextRun& run)
+{
+    ++m_stats.Layouts;
+    run.Glyphs.clear();
+    run.Width = 0;
+    run.LineHeight = style.LineHeight ? style.LineHeight : cache.GetLineHeight();
+    run.Serial = ++m_serial;
+    m_lines.clear();
+
+    const char* next = text.c_str();
+    for (;;) {
+        // One paragraph.  wordStart is the first glyph after the last
+        // space, where the line can break, or 0 when there's no space yet.
+        m_pending.clear();
+        int pen = 0, wordStart = 0;
+        unsigned int previous = 0;
+        while (*next && *next != '\n') {
+            unsigned int codepoint = DecodeUtf8(next);
+            const CachedGlyph* glyph = cache.Lookup(codepoint);
+            if (!glyph) {
+                previous = 0;
+                continue;
+            }
+
+            bool space = codepoint == ' ';
+            int kerning = style.Kerning && previous ? cache.GetKerning(previous, codepoint) : 0;
+            int advance = glyph->Metrics.XAdvance;
+
+            // Spaces hang past the edge; anything else that sticks out
+            // goes down to the next line with the rest of its word.  Words
+            // too long for a line of their own break between letters.
+            if (!space && style.MaxWidth > 0 && pen + kerning + advance > style.MaxWidth) {
+                int start = (int) m_pending.size();
+                for (int i = 0; i < wordStart; ++i) {
+                    if (!m_pending[i].Space) {
+                        start = wordStart;
+                        break;
+                    }
+                }
+                bool inked = false;
+                for (int i = 0; i < start && !inked; ++i)
+                    inked = !m_pending[i].Space;
+                if (inked) {
+                    int shift = start < (int) m_pending.size() ? m_pending[start].PenX : pen;
+                    if (start == (int) m_pending.size())
+                        kerning = 0;
+                    FinishLine(run, start);
+                    for (size_t i = 0; i < m_pending.size(); ++i)
+                        m_pending[i].PenX -= shift;
+                    pen -= shift;
+                    wordStart = 0;
+                }
+            }
+
+            PendingGlyph pending;
+            pending.Glyph = *glyph;
+            pending.PenX = pen + kerning;
+            pending.Space = space;
+            m_pending.push_back(pending);
+            pen += kerning + advance;
+            if (space)
+                wordStart = (int) m_pending.size();
+            previous = codepoint;
+        }
+        FinishLine(run, (int) m_pending.size());
+        if (!*next)
+            break;
+        ++next;
+    }
+
+    int box = style.MaxWidth > 0 ? style.MaxWidth : run.Width;
+    for (size_t i = 0; i < m_lines.size(); ++i) {
+        const Line& line = m_lines[i];
+        int offset = 0;
+        if (style.Alignment == TextAlignmentCenter)
+            offset = (box - line.Width) / 2;
+        else if (style.Alignment == TextAlignmentRight)
+            offset = box - line.Width;
+        if (!offset)
+            continue;
+        for (int j = line.First; j < line.End; ++j)
+            run.Glyphs[j].X += offset;
+    }
+    run.LineCount = (int) m_lines.size();
+    m_stats.Glyphs += (int) run.Glyphs.size();
+}
+
+// Places the first count pending glyphs on a new line and drops them from
+// the pending list.  Trailing spaces don't count toward the width.
+inline void TextLayout::FinishLine(TextRun& run, int count)
+{
+    Line line;
+    line.First = (int) run.Glyphs.size();
+    line.Width = 0;
+    int baseline = -(int) m_lines.size() * run.LineHeight;
+    for (int i = 0; i < count; ++i) {
+        const PendingGlyph& pending = m_pending[i];
+        const GlyphMetrics& metrics = pending.Glyph.Metrics;
+        if (!pending.Space)
+            line.Width = std::max(line.Width, pending.PenX + metrics.XAdvance);
+        if (metrics.Width > 0 && metrics.Height > 0) {
+            PlacedGlyph placed;
+            placed.X = pending.PenX + metrics.XBearing;
+            placed.Y = baseline - (metrics.Height + metrics.YBearing);
+            placed.Glyph = pending.Glyph;
+            run.Glyphs.push_back(placed);
+        }
+    }
+    line.End = (int) run.Glyphs.size();
+    m_lines.push_back(line);
+    run.Width = std::max(run.Width, line.Width);
+    m_pending.erase(m_pending.begin(), m_pending.begin() + count);
+}
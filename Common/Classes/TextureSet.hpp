@@ -0,0 +1,201 @@
+#pragma once
+#include "PvrTexture.hpp"
+#include <cstdio>
+#include <vector>
+
+// A texture set holds several encodings of one image, such as PVRTC, ETC2,
+// and an uncompressed fallback, so that a single asset can serve any GPU.
+// TextureCooker writes one when it is given more than one format.
+//
+// The layout is a 'TSET' identifier, an entry count, and an (offset, size)
+// pair per entry, followed by the entries themselves.  Each entry is a
+// complete PVR container aligned to four bytes, listed in order of
+// preference.  Nothing here touches GL; PvrUpload.hpp asks the driver what
+// it supports.
+
+const unsigned int TextureSetIdentifier = 0x54455354;
+const int TextureSetMaxEntries = 8;
+
+struct TextureSetEntry {
+    unsigned int Offset;
+    unsigned int Size;
+};
+
+struct TextureCompressionSupport {
+    TextureCompressionSupport() : Pvrtc(false), Etc1(false), Etc2(false) {}
+    bool Supports(PvrPixelType type) const
+    {
+        switch (type) {
+            case PvrPixelTypePvrtc2:
+            case PvrPixelTypePvrtc4: return Pvrtc;
+            case PvrPixelTypeEtc1: return Etc1;
+            case PvrPixelTypeEtc2Rgb:
+            case PvrPixelTypeEtc2Rgba: return Etc2;
+            default: return true;
+        }
+    }
+    bool Pvrtc;
+    bool Etc1;
+    bool Etc2;
+};
+
+class TextureSet {
+public:
+    TextureSet() : m_blob(0), m_entryCount(0) {}
+    bool Parse(const void* blob, size_t blobSize = PvrTexture::UnknownSize);
+    int GetEntryCount() const { return m_entryCount; }
+    const void* GetEntry(int index, size_t* size) const;
+private:
+    const unsigned char* m_blob;
+    int m_entryCount;
+    TextureSetEntry m_entries[TextureSetMaxEntries];
+};
+
+// Returns false if the blob isn't a texture set or its table doesn't fit.
+inline bool TextureSet::Parse(const void* blob, size_t blobSize)
+{
+    m_blob = 0;
+    m_entryCount = 0;
+
+    unsigned int header[2];
+    if (!blob || blobSize < sizeof(header))
+        return false;
+    memcpy(header, blob, sizeof(header));
+    if (header[0] != TextureSetIdentifier || header[1] == 0 ||
+        header[1] > (unsigned int) TextureSetMaxEntries)
+        return false;
+
+    size_t tableEnd = sizeof(header) + header[1] * sizeof(TextureSetEntry);
+    if (blobSize < tableEnd)
+        return false;
+    memcpy(m_entries, (const unsigned char*) blob + sizeof(header),
+           header[1] * sizeof(TextureSetEntry));
+
+    for (unsigned int i = 0; i < header[1]; ++i) {
+        const TextureSetEntry& entry = m_entries[i];
+        if (entry.Offset < tableEnd)
+            return false;
+        if (blobSize != PvrTexture::UnknownSize &&
+            (entry.Offset > blobSize || entry.Size > blobSize - entry.Offset))
+            return false;
+    }
+
+    m_blob = (const unsigned char*) blob;
+    m_entryCount = header[1];
+    return true;
+}
+
+inline const void* TextureSet::GetEntry(int index, size_t* size) const
+{
+    assert(index >= 0 && index < m_entryCount);
+    *size = m_entries[index].Size;
+    return m_blob + m_entries[index].Offset;
+}
+
+// Parses a plain PVR container, or picks the first entry of a texture set
+// that the GPU can sample.  A plain container is parsed even if the GPU
+// can't sample it, so that the caller sees the usual upload failure.
+inline PvrError ParseTextureAsset(const void* blob, size_t blobSize,
+                                  const TextureCompressionSupport& support,
+                                  PvrTexture& texture)
+{
+    TextureSet set;
+    if (!set.Parse(blob, blobSize))
+        return texture.Parse(blob, blobSize);
+
+    for (int i = 0; i < set.GetEntryCount(); ++i) {
+        size_t size;
+        const void* entry = set.GetEntry(i, &size);
+        PvrTexture candidate;
+        if (candidate.Parse(entry, size) != PvrErrorNone)
+            continue;
+        if (support.Supports(candidate.GetPixelType())) {
+            texture = candidate;
+            return PvrErrorNone;
+        }
+    }
+
+    // Nothing usable; leave the texture invalid.
+    texture.Parse(0, 0);
+    return PvrErrorUnsupported;
+}
+
+// Builds a texture set out of finished PVR containers.
+class TextureSetWriter {
+public:
+    void AddEntry(const std::vector<unsigned char>& container);
+    int GetEntryCount() const { return m_entries.size(); }
+    void Write(std::vector<unsigned char>& blob) const;
+    bool WriteFile(const char* path) const;
+    bool WriteSource(const char* path, const char* name) const;
+private:
+    std::vector<std::vector<unsigned char> > m_entries;
+};
+
+inline void TextureSetWriter::AddEntry(const std::vector<unsigned char>& container)
+{
+    assert((int) m_entries.size() < TextureSetMaxEntries);
+    m_entries.push_back(container);
+}
+
+inline void TextureSetWriter::Write(std::vector<unsigned char>& blob) const
+{
+    unsigned int header[2] = { TextureSetIdentifier, (unsigned int) m_entries.size() };
+    std::vector<TextureSetEntry> table(m_entries.size());
+    size_t offset = sizeof(header) + table.size() * sizeof(TextureSetEntry);
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        table[i].Offset = offset;
+        table[i].Size = m_entries[i].size();
+        offset = (offset + m_entries[i].size() + 3) & ~3;
+    }
+
+    const unsigned char* bytes = (const unsigned char*) header;
+    blob.assign(bytes, bytes + sizeof(header));
+    bytes = (const unsigned char*) &table[0];
+    blob.insert(blob.end(), bytes, bytes + table.size() * sizeof(TextureSetEntry));
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        blob.resize(table[i].Offset, 0);
+        blob.insert(blob.end(), m_entries[i].begin(), m_entries[i].end());
+    }
+    blob.resize(offset, 0);
+}
+
+inline bool TextureSetWriter::WriteFile(const char* path) const
+{
+    std::vector<unsigned char> blob;
+    Write(blob);
+    FILE* file = fopen(path, "wb");
+    if (!file)
+        return false;
+    bool ok = fwrite(&blob[0], 1, blob.size(), file) == blob.size();
+    return fclose(file) == 0 && ok;
+}
+
+// Same word-array layout as PvrWriter::WriteSource, minus the header comments.
+inline bool TextureSetWriter::WriteSource(const char* path, const char* name) const
+{
+    std::vector<unsigned char> blob;
+    Write(blob);
+
+    FILE* file = fopen(path, "w");
+    if (!file)
+        return false;
+
+    fprintf(file, "// This file was created by TextureCooker.\n");
+    fprintf(file, "// DO NOT EDIT\n\n");
+    fprintf(file, "#ifndef A32BIT\n #define A32BIT static const unsigned int\n#endif\n\n");
+    fprintf(file, "A32BIT %s[] = {\n\n/* Texture set, %d entries */\n", name,
+            (int) m_entries.size());
+
+    size_t wordCount = blob.size() / 4;
+    for (size_t i = 0; i < wordCount; ++i) {
+        const unsigned char* b = &blob[i * 4];
+        unsigned int word = b[0] | b[1] << 8 | b[2] << 16 | (unsigned int) b[3] << 24;
+        fprintf(file, "0x%08x,", word);
+        if (i % 32 == 31 || i + 1 == wordCount)
+            fprintf(file, "\n");
+    }
+
+    fprintf(file, "0 };\n\n");
+    return fclose(file) == 0;
+}
@@ -0,0 +1,443 @@
+#pragma once
+#include <cassert>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define YUV_CONVERTER_SSE2
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define YUV_CONVERTER_NEON
+#endif
+
+// Turns camera frames in NV12 or I420 into RGBA8 or RGB565 texels, scaled
+// to whatever size the texture is, in one pass, so a frame goes straight
+// from the capture buffer into a FrameQueue buffer:
+//
+//     converter.Convert(cameraImage, 256, 256, YuvOutputRgba8,
+//                       queue.GetBackFrame().Pixels, 256 * 4);
+//
+// Scaling averages the source area under each target texel, as a box
+// filter: first down the columns of each plane, then along the row, with
+// 8-bit weights that add up to exactly 256.  Chroma is taken to be centered
+// on each 2x2 block of luma.  Colors follow BT.601, in the video range
+// (420v) or the full range (420f), with 8-bit integer coefficients.
+//
+// The column pass reads every source byte and the color conversion writes
+// every target texel, so those two use SSE2 or NEON where there is one.
+// They do the same integer arithmetic as the scalar code, which makes the
+// results the same to the bit either way.
+
+enum YuvLayout {
+    YuvLayoutNv12,      // Y plane, then interleaved U and V at half size
+    YuvLayoutI420,      // Y plane, then U and V planes at half size
+};
+
+enum YuvOutput {
+    YuvOutputRgba8,
+    YuvOutputRgb565,
+};
+
+// Planes hold Y, then UV for NV12 or U and V for I420.  Strides are in
+// bytes, and chroma planes are (Width + 1) / 2 by (Height + 1) / 2.
+struct YuvImage {
+    YuvLayout Layout;
+    int Width;
+    int Height;
+    const unsigned char* Planes[3];
+    int Strides[3];
+};
+
+struct YuvConvertOptions {
+    YuvConvertOptions() : FullRange(false), Simd(true) {}
+    bool FullRange;
+    bool Simd;
+};
+
+// Where each target texel along one axis reads: Taps source texels from
+// First, each with its weight out of 256.
+struct YuvAxis {
+    void Resize(int sourceSize, int targetSize);
+    int SourceSize;
+    int TargetSize;
+    int Taps;
+    std::vector<int> First;
+    std::vector<unsigned short> Weights;    // Taps for each target texel
+};
+
+// Keeps the axes and row buffers from one frame to the next, so converting
+// frames of the same size doesn't allocate.
+class YuvConverter {
+public:
+    YuvConverter(const YuvConvertOptions& options = YuvConvertOptions());
+    void Convert(const YuvImage& source, int width, int height, YuvOutput output,
+                 unsigned char* target, int targetStride);
+private:
+    struct Coefficients {
+        int YOffset;
+        int Y;
+        int RV;
+        int GU;
+        int GV;
+        int BU;
+    };
+    void FilterColumns(const unsigned char* plane, int stride, int bytes,
+                       const YuvAxis& rows, int y, unsigned char* filtered) const;
+    void ConvertRow(const unsigned char* y, const unsigned char* u, const unsigned char* v,
+                    int width, YuvOutput output, unsigned char* target) const;
+    YuvConvertOptions m_options;
+    Coefficients m_coefficients;
+    YuvAxis m_lumaColumns;
+    YuvAxis m_lumaRows;
+    YuvAxis m_chromaColumns;
+    YuvAxis m_chromaRows;
+    std::vector<unsigned char> m_filtered;
+    std::vector<unsigned char> m_texels;
+};
+
+// Target texel t covers source texels [t * S / T, (t + 1) * S / T); the
+// weights are the overlaps, scaled to 256.  Rounding where each overlap
+// ends, rather than each overlap, makes them add up to 256 exactly, and
+// measuring in units of 1 / T keeps it all in integers.
+inline void YuvAxis::Resize(int sourceSize, int targetSize)
+{
+    assert(sourceSize > 0 && targetSize > 0);
+    SourceSize = sourceSize;
+    TargetSize = targetSize;
+    Taps = (sourceSize + targetSize - 1) / targetSize + 1;
+    Taps = Taps > sourceSize ? sourceSize : Taps;
+    First.resize(targetSize);
+    Weights.assign(targetSize * Taps, 0);
+    for (int t = 0; t < targetSize; ++t) {
+        long long begin = (long long) t * sourceSize, end = begin + sourceSize;
+        int first = (int) (begin / targetSize);
+        first = first + Taps > sourceSize ? sourceSize - Taps : first;
+        First[t] = first;
+        long long covered = 0;
+        int previous = 0;
+        for (int k = 0; k < Taps; ++k) {
+            long long cellBegin = (long long) (first + k) * targetSize;
+            long long cellEnd = cellBegin + targetSize;
+            long long overlap = (end < cellEnd ? end : cellEnd) -
+                                (begin > cellBegin ? begin : cellBegin);
+            if (overlap <= 0)
+                continue;
+            covered += overlap;
+            int rounded = (int) ((covered * 256 + sourceSize / 2) / sourceSize);
+            Weights[t * Taps + k] = (unsigned short) (rounded - previous);
+            previous = rounded;
+        }
+    }
+
+    // The tap count allows for the worst alignment, and enlarging only
+    // ever needs one tap; drop the ones no texel uses.
+    int used = 1;
+    for (int t = 0; t < targetSize; ++t) {
+        const unsigned short* weights = &Weights[t * Taps];
+        int first = 0, last = Taps - 1;
+        while (!weights[first])
+            ++first;
+        while (!weights[last])
+            --last;
+        used = last - first + 1 > used ? last - first + 1 : used;
+    }
+    if (used == Taps)
+        return;
+    std::vector<unsigned short> weights(targetSize * used, 0);
+    for (int t = 0; t < targetSize; ++t) {
+        int skipped = 0;
+        while (!Weights[t * Taps + skipped])
+            ++skipped;
+        int first = First[t] + skipped;
+        first = first + used > sourceSize ? sourceSize - used : first;
+        for (int k = 0; k < Taps; ++k) {
+            int index = First[t] + k - first;
+            if (Weights[t * Taps + k])
+                weights[t * used + index] = Weights[t * Taps + k];
+        }
+        First[t] = first;
+    }
+    Taps = used;
+    Weights.swap(weights);
+}
+
+inline YuvConverter::YuvConverter(const YuvConvertOptions& options) : m_options(options)
+{
+    Coefficients video = { 16, 298, 409, -100, -208, 516 };
+    Coefficients full = { 0, 256, 359, -88, -183, 454 };
+    m_coefficients = options.FullRange ? full : video;
+    m_lumaColumns.SourceSize = m_lumaRows.SourceSize = 0;
+    m_chromaColumns.SourceSize = m_chromaRows.SourceSize = 0;
+}
+
+inline void YuvConverter::Convert(const YuvImage& source, int width, int height,
+                                  YuvOutput output, unsigned char* target, int targetStride)
+{
+    int chromaWidth = (source.Width + 1) / 2, chromaHeight = (source.Height + 1) / 2;
+    if (m_lumaColumns.SourceSize != source.Width || m_lumaColumns.TargetSize != width) {
+        m_lumaColumns.Resize(source.Width, width);
+        m_chromaColumns.Resize(chromaWidth, width);
+    }
+    if (m_lumaRows.SourceSize != source.Height || m_lumaRows.TargetSize != height) {
+        m_lumaRows.Resize(source.Height, height);
+        m_chromaRows.Resize(chromaHeight, height);
+    }
+
+    // One filtered row for each plane, source width, then one scaled row
+    // each of Y, U and V at the target width.
+    bool nv12 = source.Layout == YuvLayoutNv12;
+    m_filtered.resize(source.Width + chromaWidth * 2);
+    m_texels.resize(width * 3);
+    unsigned char* filteredY = &m_filtered[0];
+    unsigned char* filteredU = filteredY + source.Width;
+    unsigned char* filteredV = filteredU + chromaWidth;
+    unsigned char* texelsY = &m_texels[0];
+    unsigned char* texelsU = texelsY + width;
+    unsigned char* texelsV = texelsU + width;
+
+    for (int y = 0; y < height; ++y) {
+        FilterColumns(source.Planes[0], source.Strides[0], source.Width, m_lumaRows, y,
+                      filteredY);
+        if (nv12) {
+            FilterColumns(source.Planes[1], source.Strides[1], chromaWidth * 2, m_chromaRows, y,
+                          filteredU);
+        } else {
+            FilterColumns(source.Planes[1], source.Strides[1], chromaWidth, m_chromaRows, y,
+                          filteredU);
+            FilterColumns(source.Planes[2], source.Strides[2], chromaWidth, m_chromaRows, y,
+                          filteredV);
+        }
+
+        // Along the row there are few texels left, and the taps land all
+        // over, so this part stays scalar.  Luma at its own width is done.
+        int taps = m_lumaColumns.Taps;
+        if (taps == 1 && width == source.Width)
+            texelsY = filteredY;
+        for (int x = 0; texelsY != filteredY && x < width; ++x) {
+            const unsigned char* texels = filteredY + m_lumaColumns.First[x];
+            const unsigned short* weights = &m_lumaColumns.Weights[x * taps];
+            unsigned int sum = 128;
+            for (int k = 0; k < taps; ++k)
+                sum += texels[k] * weights[k];
+            texelsY[x] = (unsigned char) (sum >> 8);
+        }
+        taps = m_chromaColumns.Taps;
+        for (int x = 0; x < width; ++x) {
+            int first = m_chromaColumns.First[x];
+            const unsigned short* weights = &m_chromaColumns.Weights[x * taps];
+            unsigned int sumU = 128, sumV = 128;
+            if (nv12) {
+                const unsigned char* texels = filteredU + first * 2;
+                for (int k = 0; k < taps; ++k) {
+                    sumU += texels[k * 2] * weights[k];
+                    sumV += texels[k * 2 + 1] * weights[k];
+                }
+            } else {
+                for (int k = 0; k < taps; ++k) {
+                    sumU += filteredU[first + k] * weights[k];
+                    sumV += filteredV[first + k] * weights[k];
+                }
+            }
+            texelsU[x] = (unsigned char) (sumU >> 8);
+            texelsV[x] = (unsigned char) (sumV >> 8);
+        }
+
+        ConvertRow(texelsY, texelsU, texelsV, width, output, target + y * targetStride);
+    }
+}
+
+// filtered[i] is the weighted sum of plane row First[y] + k, byte i, over
+// the taps, rounded.  The weights add up to 256, so the sum fits in 16 bits
+// unsigned.
+inline void YuvConverter::FilterColumns(const unsigned char* plane, int stride, int bytes,
+                                        const YuvAxis& rows, int y,
+                                        unsigned char* filtered) const
+{
+    const unsigned short* weights = &rows.Weights[y * rows.Taps];
+    const unsigned char* sources[8];
+    unsigned short sourceWeights[8];
+    int tapCount = 0;
+    for (int k = 0; k < rows.Taps; ++k) {
+        if (!weights[k])
+            continue;
+        if (tapCount == 8) {
+            // Shrinking by more than 7 leaves too many rows to keep in
+            // registers; go the long way round.
+            for (int i = 0; i < bytes; ++i) {
+                unsigned int sum = 128;
+                for (int j = 0; j < rows.Taps; ++j)
+                    sum += plane[(rows.First[y] + j) * stride + i] * weights[j];
+                filtered[i] = (unsigned char) (sum >> 8);
+            }
+            return;
+        }
+        sources[tapCount] = plane + (rows.First[y] + k) * stride;
+        sourceWeights[tapCount++] = weights[k];
+    }
+
+    int i = 0;
+#if defined(YUV_CONVERTER_SSE2)
+    if (m_options.Simd) {
+        __m128i zero = _mm_setzero_si128();
+        __m128i half = _mm_set1_epi16(128);
+        for (; i + 16 <= bytes; i += 16) {
+            __m128i low = half, high = half;
+            for (int t = 0; t < tapCount; ++t) {
+                __m128i weight = _mm_set1_epi16((short) sourceWeights[t]);
+                __m128i texels = _mm_loadu_si128((const __m128i*) (sources[t] + i));
+                low = _mm_add_epi16(low, _mm_mullo_epi16(_mm_unpacklo_epi8(texels, zero), weight));
+                high = _mm_add_epi16(high, _mm_mullo_epi16(_mm_unpackhi_epi8(texels, zero), weight));
+            }
+            low = _mm_srli_epi16(low, 8);
+            high = _mm_srli_epi16(high, 8);
+            _mm_storeu_si128((__m128i*) (filtered + i), _mm_packus_epi16(low, high));
+        }
+    }
+#elif defined(YUV_CONVERTER_NEON)
+    if (m_options.Simd) {
+        for (; i + 16 <= bytes; i += 16) {
+            uint16x8_t low = vdupq_n_u16(0), high = vdupq_n_u16(0);
+            for (int t = 0; t < tapCount; ++t) {
+                uint16x8_t weight = vdupq_n_u16(sourceWeights[t]);
+                uint8x16_t texels = vld1q_u8(sources[t] + i);
+                low = vmlaq_u16(low, vmovl_u8(vget_low_u8(texels)), weight);
+                high = vmlaq_u16(high, vmovl_u8(vget_high_u8(texels)), weight);
+            }
+            vst1q_u8(filtered + i, vcombine_u8(vrshrn_n_u16(low, 8), vrshrn_n_u16(high, 8)));
+        }
+    }
+#endif
+    for (; i < bytes; ++i) {
+        unsigned int sum = 128;
+        for (int t = 0; t < tapCount; ++t)
+            sum += sources[t][i] * sourceWeights[t];
+        filtered[i] = (unsigned char) (sum >> 8);
+    }
+}
+
+// With c = Y - YOffset, d = U - 128 and e = V - 128:
+//
+//     R = (Y * c + RV * e + 128) >> 8
+//     G = (Y * c + GU * d + GV * e + 128) >> 8
+//     B = (Y * c + BU * d + 128) >> 8
+//
+// clamped to [0, 255].  The sums need 32 bits, which SSE2 gets from
+// multiplying pairs with _mm_madd_epi16 and NEON from widening multiplies.
+inline void YuvConverter::ConvertRow(const unsigned char* y, const unsigned char* u,
+                                     const unsigned char* v, int width, YuvOutput output,
+                                     unsigned char* target) const
+{
+    const Coefficients& k = m_coefficients;
+    int x = 0;
+#if defined(YUV_CONVERTER_SSE2)
+    if (m_options.Simd) {
+        __m128i zero = _mm_setzero_si128();
+        __m128i yOffset = _mm_set1_epi16((short) k.YOffset);
+        __m128i chromaOffset = _mm_set1_epi16(128);
+        __m128i round = _mm_set1_epi32(128);
+        __m128i red = _mm_set_epi16((short) k.RV, (short) k.Y, (short) k.RV, (short) k.Y,
+                                    (short) k.RV, (short) k.Y, (short) k.RV, (short) k.Y);
+        __m128i blue = _mm_set_epi16((short) k.BU, (short) k.Y, (short) k.BU, (short) k.Y,
+                                     (short) k.BU, (short) k.Y, (short) k.BU, (short) k.Y);
+        __m128i green = _mm_set_epi16((short) k.GU, (short) k.Y, (short) k.GU, (short) k.Y,
+                                      (short) k.GU, (short) k.Y, (short) k.GU, (short) k.Y);
+        __m128i greenV = _mm_set_epi16(0, (short) k.GV, 0, (short) k.GV,
+                                       0, (short) k.GV, 0, (short) k.GV);
+        __m128i alpha = _mm_set1_epi8((char) 255);
+        for (; x + 8 <= width; x += 8) {
+            __m128i c = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) (y + x)), zero), yOffset);
+            __m128i d = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) (u + x)), zero), chromaOffset);
+            __m128i e = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) (v + x)), zero), chromaOffset);
+            __m128i ceLow = _mm_unpacklo_epi16(c, e), ceHigh = _mm_unpackhi_epi16(c, e);
+            __m128i cdLow = _mm_unpacklo_epi16(c, d), cdHigh = _mm_unpackhi_epi16(c, d);
+            __m128i eLow = _mm_unpacklo_epi16(e, zero), eHigh = _mm_unpackhi_epi16(e, zero);
+            __m128i r = _mm_packs_epi32(
+                _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(ceLow, red), round), 8),
+                _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(ceHigh, red), round), 8));
+            __m128i g = _mm_packs_epi32(
+                _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(_mm_madd_epi16(cdLow, green),
+                                                           _mm_madd_epi16(eLow, greenV)), round), 8),
+                _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(_mm_madd_epi16(cdHigh, green),
+                                                           _mm_madd_epi16(eHigh, greenV)), round), 8));
+            __m128i b = _mm_packs_epi32(
+                _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(cdLow, blue), round), 8),
+                _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(cdHigh, blue), round), 8));
+
+            // Clamped to bytes, and then either interleaved with alpha or
+            // packed into 16 bits.
+            r = _mm_packus_epi16(r, r);
+            g = _mm_packus_epi16(g, g);
+            b = _mm_packus_epi16(b, b);
+            if (output == YuvOutputRgba8) {
+                __m128i rg = _mm_unpacklo_epi8(r, g), ba = _mm_unpacklo_epi8(b, alpha);
+                _mm_storeu_si128((__m128i*) (target + x * 4), _mm_unpacklo_epi16(rg, ba));
+                _mm_storeu_si128((__m128i*) (target + x * 4 + 16), _mm_unpackhi_epi16(rg, ba));
+            } else {
+                r = _mm_slli_epi16(_mm_srli_epi16(_mm_unpacklo_epi8(r, zero), 3), 11);
+                g = _mm_slli_epi16(_mm_srli_epi16(_mm_unpacklo_epi8(g, zero), 2), 5);
+                b = _mm_srli_epi16(_mm_unpacklo_epi8(b, zero), 3);
+                _mm_storeu_si128((__m128i*) (target + x * 2), _mm_or_si128(_mm_or_si128(r, g), b));
+            }
+        }
+    }
+#elif defined(YUV_CONVERTER_NEON)
+    if (m_options.Simd) {
+        int16x8_t yOffset = vdupq_n_s16((int16_t) k.YOffset);
+        int16x8_t chromaOffset = vdupq_n_s16(128);
+        int32x4_t round = vdupq_n_s32(128);
+        for (; x + 8 <= width; x += 8) {
+            int16x8_t c = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(y + x))), yOffset);
+            int16x8_t d = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(u + x))), chromaOffset);
+            int16x8_t e = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(v + x))), chromaOffset);
+            int32x4_t yLow = vmlaq_n_s32(round, vmovl_s16(vget_low_s16(c)), k.Y);
+            int32x4_t yHigh = vmlaq_n_s32(round, vmovl_s16(vget_high_s16(c)), k.Y);
+            int32x4_t rLow = vmlal_n_s16(yLow, vget_low_s16(e), (int16_t) k.RV);
+            int32x4_t rHigh = vmlal_n_s16(yHigh, vget_high_s16(e), (int16_t) k.RV);
+            int32x4_t gLow = vmlal_n_s16(vmlal_n_s16(yLow, vget_low_s16(d), (int16_t) k.GU),
+                                         vget_low_s16(e), (int16_t) k.GV);
+            int32x4_t gHigh = vmlal_n_s16(vmlal_n_s16(yHigh, vget_high_s16(d), (int16_t) k.GU),
+                                          vget_high_s16(e), (int16_t) k.GV);
+            int32x4_t bLow = vmlal_n_s16(yLow, vget_low_s16(d), (int16_t) k.BU);
+            int32x4_t bHigh = vmlal_n_s16(yHigh, vget_high_s16(d), (int16_t) k.BU);
+            uint8x8_t r = vqmovun_s16(vcombine_s16(vqmovn_s32(vshrq_n_s32(rLow, 8)),
+                                                   vqmovn_s32(vshrq_n_s32(rHigh, 8))));
+            uint8x8_t g = vqmovun_s16(vcombine_s16(vqmovn_s32(vshrq_n_s32(gLow, 8)),
+                                                   vqmovn_s32(vshrq_n_s32(gHigh, 8))));
+            uint8x8_t b = vqmovun_s16(vcombine_s16(vqmovn_s32(vshrq_n_s32(bLow, 8)),
+                                                   vqmovn_s32(vshrq_n_s32(bHigh, 8))));
+            if (output == YuvOutputRgba8) {
+                uint8x8x4_t texels;
+                texels.val[0] = r;
+                texels.val[1] = g;
+                texels.val[2] = b;
+                texels.val[3] = vdup_n_u8(255);
+                vst4_u8(target + x * 4, texels);
+            } else {
+                uint16x8_t packed = vshlq_n_u16(vmovl_u8(vshr_n_u8(r, 3)), 11);
+                packed = vorrq_u16(packed, vshlq_n_u16(vmovl_u8(vshr_n_u8(g, 2)), 5));
+                packed = vorrq_u16(packed, vmovl_u8(vshr_n_u8(b, 3)));
+                vst1q_u16((uint16_t*) (target + x * 2), packed);
+            }
+        }
+    }
+#endif
+    for (; x < width; ++x) {
+        int c = y[x] - k.YOffset, d = u[x] - 128, e = v[x] - 128;
+        int r = (k.Y * c + k.RV * e + 128) >> 8;
+        int g = (k.Y * c + k.GU * d + k.GV * e + 128) >> 8;
+        int b = (k.Y * c + k.BU * d + 128) >> 8;
+        r = r < 0 ? 0 : (r > 255 ? 255 : r);
+        g = g < 0 ? 0 : (g > 255 ? 255 : g);
+        b = b < 0 ? 0 : (b > 255 ? 255 : b);
+        if (output == YuvOutputRgba8) {
+            unsigned char* texel = target + x * 4;
+            texel[0] = (unsigned char) r;
+            texel[1] = (unsigned char) g;
+            texel[2] = (unsigned char) b;
+            texel[3] = 255;
+        } else {
+            unsigned short texel = (unsigned short) ((r >> 3) << 11 | (g >> 2) << 5 | b >> 3);
+            *(unsigned short*) (target + x * 2) = texel;
+        }
+    }
+}
@@ -0,0 +1,260 @@
+// AssetPacker builds the memory-mapped asset packs that AssetPack.hpp reads.
+// It takes cooked files as they are, and it converts the C array headers
+// that PVRTexTool, Filewrap, and TextureCooker emit, so that the samples can
+// drop their multi-megabyte #includes.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o AssetPacker AssetPacker.cpp
+//
+// Usage:
+//
+//     AssetPacker [options] output.pack input...
+//     AssetPacker -l input.pack
+//
+//     -a bytes     entry alignment (default 4096, one page)
+//     -l           list the entries of an existing pack
+//
+// Every array in a .h or .c input becomes an entry named after the array;
+// the element type comes from the declaration (float, short, char, or 32-bit
+// words for A32BIT, int, and long).  Any other input is stored verbatim
+// under its file name minus the extension.  A name=path argument overrides
+// the name of a verbatim input.
+
+#include "../Classes/AssetPack.hpp"
+#include <cctype>
+#include <cstdlib>
+
+using namespace std;
+
+static void Usage()
+{
+    printf("Usage: AssetPacker [options] output.pack input...\n"
+           "       AssetPacker -l input.pack\n"
+           "  -a bytes  entry alignment\n"
+           "  -l        list an existing pack\n");
+    exit(1);
+}
+
+static bool ReadFile(const string& path, vector<unsigned char>& contents)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    contents.resize(size > 0 ? size : 0);
+    bool ok = size == 0 || fread(&contents[0], 1, size, file) == (size_t) size;
+    fclose(file);
+    return ok;
+}
+
+static bool EndsWith(const string& s, const string& suffix)
+{
+    return s.size() >= suffix.size() &&
+           s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+static string BaseName(const string& path)
+{
+    string name = path;
+    size_t slash = name.find_last_of("/\\");
+    if (slash != string::npos)
+        name = name.substr(slash + 1);
+    return name.substr(0, name.find('.'));
+}
+
+// Blanks out comments and preprocessor lines so that only declarations and
+// initializers are left.
+static string StripComments(const string& source)
+{
+    string result(source);
+    bool lineStart = true;
+    for (size_t i = 0; i < result.size(); ++i) {
+        if (result[i] == '#' && lineStart) {
+            while (i < result.size() && result[i] != '\n')
+                result[i++] = ' ';
+        } else if (result.compare(i, 2, "//") == 0) {
+            while (i < result.size() && result[i] != '\n')
+                result[i++] = ' ';
+        } else if (result.compare(i, 2, "/*") == 0) {
+            size_t end = result.find("*/", i + 2);
+            end = end == string::npos ? result.size() : end + 2;
+            for (; i < end; ++i)
+                if (result[i] != '\n')
+                    result[i] = ' ';
+            --i;
+            continue;
+        }
+        if (i < result.size() && result[i] == '\n')
+            lineStart = true;
+        else if (i < result.size() && !isspace((unsigned char) result[i]))
+            lineStart = false;
+    }
+    return result;
+}
+
+static void AppendValue(const string& token, const string& declaration,
+                        vector<unsigned char>& data)
+{
+    unsigned char bytes[4];
+    size_t size = 4;
+    if (declaration.find("float") != string::npos || declaration.find("double") != string::npos) {
+        float value = (float) strtod(token.c_str(), 0);
+        memcpy(bytes, &value, 4);
+    } else {
+        long long value = strtoll(token.c_str(), 0, 0);
+        if (token[0] != '-')
+            value = (long long) strtoull(token.c_str(), 0, 0);
+        if (declaration.find("char") != string::npos)
+            size = 1;
+        else if (declaration.find("short") != string::npos)
+            size = 2;
+        for (size_t i = 0; i < size; ++i)
+            bytes[i] = (unsigned char) (value >> (8 * i));
+    }
+    data.insert(data.end(), bytes, bytes + size);
+}
+
+// Converts every "name[...] = { ... };" in a header into an entry.
+static bool ConvertHeader(const string& path, AssetPackWriter& writer)
+{
+    vector<unsigned char> contents;
+    if (!ReadFile(path, contents)) {
+        printf("Unable to read %s.\n", path.c_str());
+        return false;
+    }
+    string source = StripComments(string(contents.begin(), contents.end()));
+
+    int arrayCount = 0;
+    size_t statementStart = 0;
+    for (size_t brace = source.find('{'); brace != string::npos;
+         brace = source.find('{', brace + 1)) {
+        size_t previous = source.find_last_of(";}", brace);
+        statementStart = previous == string::npos ? 0 : previous + 1;
+        string declaration = source.substr(statementStart, brace - statementStart);
+        size_t bracket = declaration.find('[');
+        if (bracket == string::npos || declaration.find('=') == string::npos)
+            continue;
+
+        size_t nameEnd = declaration.find_last_not_of(" \t\r\n", bracket - 1);
+        size_t nameStart = declaration.find_last_of(" \t\r\n*", nameEnd);
+        nameStart = nameStart == string::npos ? 0 : nameStart + 1;
+        string name = declaration.substr(nameStart, nameEnd + 1 - nameStart);
+        string type = declaration.substr(0, nameStart);
+
+        size_t close = source.find('}', brace);
+        if (close == string::npos) {
+            printf("%s: unterminated array %s.\n", path.c_str(), name.c_str());
+            return false;
+        }
+
+        vector<unsigned char> data;
+        string body = source.substr(brace + 1, close - brace - 1);
+        size_t start = 0;
+        while (start < body.size()) {
+            size_t comma = body.find(',', start);
+            if (comma == string::npos)
+                comma = body.size();
+            size_t first = body.find_first_not_of(" \t\r\n", start);
+            if (first != string::npos && first < comma)
+                AppendValue(body.substr(first, comma - first), type, data);
+            start = comma + 1;
+        }
+
+        if (!writer.AddEntry(name, data)) {
+            printf("%s: duplicate entry %s.\n", path.c_str(), name.c_str());
+            return false;
+        }
+        printf("  %s: %d bytes\n", name.c_str(), (int) data.size());
+        arrayCount++;
+        brace = close;
+    }
+
+    if (!arrayCount)
+        printf("Warning: %s has no arrays.\n", path.c_str());
+    return true;
+}
+
+static int List(const char* path)
+{
+    AssetPack pack;
+    if (pack.Open(path) != AssetPackErrorNone) {
+        printf("%s: %s\n", path, AssetPack::GetErrorString(pack.GetError()));
+        return 1;
+    }
+    for (int i = 0; i < pack.GetEntryCount(); ++i) {
+        AssetEntry entry = pack.GetEntry(i);
+        printf("%10d  %s\n", (int) entry.Size, pack.GetEntryName(i));
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int alignment = AssetPackDefaultAlignment;
+    vector<string> files;
+    bool list = false;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "-a" && i + 1 < argc)
+            alignment = atoi(argv[++i]);
+        else if (arg == "-l")
+            list = true;
+        else if (arg[0] == '-')
+            Usage();
+        else
+            files.push_back(arg);
+    }
+    if (alignment == 0 || (alignment & (alignment - 1)) || alignment < 4) {
+        printf("The alignment must be a power of two, at least 4.\n");
+        return 1;
+    }
+    if (list && files.size() == 1)
+        return List(files[0].c_str());
+    if (list || files.size() < 2)
+        Usage();
+
+    AssetPackWriter writer(alignment);
+    for (size_t i = 1; i < files.size(); ++i) {
+        string path = files[i];
+        if (EndsWith(path, ".h") || EndsWith(path, ".c")) {
+            if (!ConvertHeader(path, writer))
+                return 1;
+            continue;
+        }
+
+        string name = BaseName(path);
+        size_t equals = path.find('=');
+        if (equals != string::npos) {
+            name = path.substr(0, equals);
+            path = path.substr(equals + 1);
+        }
+
+        vector<unsigned char> data;
+        if (!ReadFile(path, data)) {
+            printf("Unable to read %s.\n", path.c_str());
+            return 1;
+        }
+        if (!writer.AddEntry(name, data)) {
+            printf("%s: duplicate entry %s.\n", path.c_str(), name.c_str());
+            return 1;
+        }
+        printf("  %s: %d bytes\n", name.c_str(), (int) data.size());
+    }
+
+    if (!writer.WriteFile(files[0].c_str())) {
+        printf("Unable to write %s.\n", files[0].c_str());
+        return 1;
+    }
+
+    // Read the result back the same way the samples will.
+    AssetPack pack;
+    if (pack.Open(files[0].c_str()) != AssetPackErrorNone) {
+        printf("Wrote an invalid pack: %s\n", AssetPack::GetErrorString(pack.GetError()));
+        return 1;
+    }
+    printf("%s: %d entries\n", files[0].c_str(), pack.GetEntryCount());
+    return 0;
+}
@@ -0,0 +1,474 @@
+// AsyncLoaderBenchmark starts up a synthetic scene's worth of textures through
+// AsyncLoader.hpp and reports how long it takes to get the first frame out,
+// to get every high-priority texture in, and to finish, along with the
+// longest frame along the way.  For comparison it runs the path the
+// samples use today, which decodes and uploads everything before the first
+// frame.
+//
+// The images are PNGs, encoded in memory up front and decoded with libpng
+// on the loader's workers.  Uploads go to a stub that copies the pixels at
+// a fixed rate, standing in for glTexImage2D, so no GL is needed.  Each
+// frame sleeps for the render time, the way the CPU would while it waits
+// on the GPU.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o AsyncLoaderBenchmark AsyncLoaderBenchmark.cpp -lpng -lpthread
+//
+// Usage:
+//
+//     AsyncLoaderBenchmark [options]
+//
+//     -i images     textures in the scene, 128 to 1024 pixels square (default 24)
+//     -t threads    decoding threads (default 2)
+//     -b kilobytes  upload budget per frame (default 1024)
+//     -r ms         time each frame spends rendering (default 8)
+//     -u MB/s       rate the stub uploader copies at (default 500)
+//     -verify       check the loader instead
+
+#include "../Classes/AsyncLoader.hpp"
+#include "../Classes/MonotonicClock.hpp"
+#include "../Classes/ParallelFor.hpp"
+#include <png.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct BenchmarkOptions {
+    BenchmarkOptions() :
+        ImageCount(24), ThreadCount(2), BudgetKilobytes(1024), RenderMilliseconds(8),
+        UploadRate(500), Verify(false) {}
+    int ImageCount;
+    int ThreadCount;
+    int BudgetKilobytes;
+    float RenderMilliseconds;
+    float UploadRate;
+    bool Verify;
+};
+
+static void Usage()
+{
+    printf("Usage: AsyncLoaderBenchmark [options]\n"
+           "  -i images     textures in the scene\n"
+           "  -t threads    decoding threads\n"
+           "  -b kilobytes  upload budget per frame\n"
+           "  -r ms         time each frame spends rendering\n"
+           "  -u MB/s       rate the stub uploader copies at\n"
+           "  -verify       check the loader instead\n");
+    exit(1);
+}
+
+static BenchmarkOptions ParseOptions(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-i" && hasValue)
+            options.ImageCount = atoi(argv[++i]);
+        else if (arg == "-t" && hasValue)
+            options.ThreadCount = atoi(argv[++i]);
+        else if (arg == "-b" && hasValue)
+            options.BudgetKilobytes = atoi(argv[++i]);
+        else if (arg == "-r" && hasValue)
+            options.RenderMilliseconds = (float) atof(argv[++i]);
+        else if (arg == "-u" && hasValue)
+            options.UploadRate = (float) atof(argv[++i]);
+        else if (arg == "-verify")
+            options.Verify = true;
+        else
+            Usage();
+    }
+
+    if (options.ImageCount < 1 || options.ThreadCount < 1 || options.BudgetKilobytes < 1 ||
+        options.RenderMilliseconds < 0 || options.UploadRate <= 0)
+        Usage();
+    return options;
+}
+
+static double GetMilliseconds(uint64_t begin, uint64_t end)
+{
+    return (end - begin) / 1000000.0;
+}
+
+static void Sleep(double milliseconds)
+{
+    timespec wait;
+    wait.tv_sec = (time_t) (milliseconds / 1000);
+    wait.tv_nsec = (long) ((milliseconds - wait.tv_sec * 1000.0) * 1000000);
+    nanosleep(&wait, 0);
+}
+
+static unsigned int Checksum(const vector<unsigned char>& bytes)
+{
+    unsigned int hash = 2166136261u;
+    for (size_t i = 0; i < bytes.size(); ++i)
+        hash = (hash ^ bytes[i]) * 16777619u;
+    return hash;
+}
+
+// Soft gradients with a little grain, which compress about as well as the
+// samples' own artwork does.
+static vector<unsigned char> MakePixels(int size, int seed)
+{
+    vector<unsigned char> pixels(size * size * 4);
+    unsigned int noise = seed * 2654435761u + 1;
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            noise = noise * 1664525u + 1013904223u;
+            unsigned char* texel = &pixels[(y * size + x) * 4];
+            int grain = (noise >> 28) - 8;
+            texel[0] = (unsigned char) ((x * 255 / size + seed * 40 + grain) & 255);
+            texel[1] = (unsigned char) ((y * 255 / size + grain) & 255);
+            texel[2] = (unsigned char) (((x + y) * 127 / size + seed * 17) & 255);
+            texel[3] = 255;
+        }
+    }
+    return pixels;
+}
+
+static vector<unsigned char> EncodePng(int size, const vector<unsigned char>& pixels)
+{
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    image.width = size;
+    image.height = size;
+    image.format = PNG_FORMAT_RGBA;
+    png_alloc_size_t byteCount = 0;
+    png_image_write_to_memory(&image, 0, &byteCount, 0, &pixels[0], 0, 0);
+    vector<unsigned char> png(byteCount);
+    if (!png_image_write_to_memory(&image, &png[0], &byteCount, 0, &pixels[0], 0, 0)) {
+        printf("Couldn't encode a PNG: %s\n", image.message);
+        exit(1);
+    }
+    png.resize(byteCount);
+    return png;
+}
+
+// Stands in for a resource manager's decoder.  The files are all encoded
+// before any thread starts, so the workers only ever read them.
+class MemoryPngDecoder : public IImageDecoder {
+public:
+    void AddFile(const string& name, const vector<unsigned char>& png) { m_files[name] = png; }
+    bool Decode(const string& name, DecodedImage& decoded)
+    {
+        map<string, vector<unsigned char> >::const_iterator file = m_files.find(name);
+        if (file == m_files.end())
+            return false;
+
+        png_image image;
+        memset(&image, 0, sizeof(image));
+        image.version = PNG_IMAGE_VERSION;
+        if (!png_image_begin_read_from_memory(&image, &file->second[0], file->second.size()))
+            return false;
+        image.format = PNG_FORMAT_RGBA;
+        decoded.Pixels.resize(PNG_IMAGE_SIZE(image));
+        if (!png_image_finish_read(&image, 0, &decoded.Pixels[0], 0, 0))
+            return false;
+        decoded.Width = image.width;
+        decoded.Height = image.height;
+        decoded.BitsPerComponent = 8;
+        return true;
+    }
+private:
+    map<string, vector<unsigned char> > m_files;
+};
+
+// Copies each image into "video memory" no faster than the given rate, and
+// keeps a checksum per texture so that -verify can tell what arrived.
+class StubUploader : public IImageUploader {
+public:
+    StubUploader(float megabytesPerSecond) :
+        m_nanosecondsPerByte(1000.0 / megabytesPerSecond), m_next(1), m_failEvery(0) {}
+    unsigned int Upload(DecodedImage& image)
+    {
+        uint64_t start = GetMonotonicNanoseconds();
+        uint64_t deadline = start + (uint64_t) (image.Pixels.size() * m_nanosecondsPerByte);
+        if (m_memory.size() < image.Pixels.size())
+            m_memory.resize(image.Pixels.size());
+        if (!image.Pixels.empty())
+            memcpy(&m_memory[0], &image.Pixels[0], image.Pixels.size());
+        while (GetMonotonicNanoseconds() < deadline)
+            ;
+        unsigned int texture = m_next++;
+        if (m_failEvery && texture % m_failEvery == 0)
+            return 0;
+        Checksums[texture] = Checksum(image.Pixels);
+        Sizes.push_back(image.Pixels.size());
+        return texture;
+    }
+    void FailEvery(int count) { m_failEvery = count; }
+    map<unsigned int, unsigned int> Checksums;
+    vector<size_t> Sizes;               // in the order they were uploaded
+private:
+    double m_nanosecondsPerByte;
+    vector<unsigned char> m_memory;
+    unsigned int m_next;
+    unsigned int m_failEvery;
+};
+
+struct SceneImage {
+    string Name;
+    int Size;
+    LoadPriority Priority;
+    unsigned int Checksum;
+};
+
+// The first sixth of the images are high priority, like a sky and a floor,
+// the rest of the first half normal, and the rest low, like labels.
+static vector<SceneImage> MakeScene(int imageCount, MemoryPngDecoder& decoder)
+{
+    vector<SceneImage> scene(imageCount);
+    for (int i = 0; i < imageCount; ++i) {
+        SceneImage& image = scene[i];
+        char name[32];
+        sprintf(name, "Image%d.png", i);
+        image.Name = name;
+        image.Size = 128 << (3 - i % 4);
+        image.Priority = i < (imageCount + 5) / 6 ? LoadPriorityHigh :
+                         i < imageCount / 2 ? LoadPriorityNormal : LoadPriorityLow;
+        vector<unsigned char> pixels = MakePixels(image.Size, i);
+        image.Checksum = Checksum(pixels);
+        decoder.AddFile(name, EncodePng(image.Size, pixels));
+    }
+    return scene;
+}
+
+struct StartupResult {
+    double FirstFrame;
+    double Essential;       // every high-priority texture is in
+    double Complete;
+    double LongestFrame;
+    int Frames;
+    int SlowFrames;         // over 1/60th of a second
+};
+
+// Runs frames until the last texture is in.  A synchronous startup is a
+// loader without threads that's told to finish before the first frame.
+static StartupResult Start(const BenchmarkOptions& options, const vector<SceneImage>& scene,
+                           MemoryPngDecoder& decoder, int threadCount, bool synchronous,
+                           size_t budget)
+{
+    StubUploader uploader(options.UploadRate);
+    StartupResult result = {0, 0, 0, 0, 0, 0};
+    uint64_t start = GetMonotonicNanoseconds();
+    AsyncLoader loader(&decoder, threadCount);
+    vector<LoadHandle> handles(scene.size());
+    for (size_t i = 0; i < scene.size(); ++i)
+        handles[i] = loader.Load(scene[i].Name, scene[i].Priority);
+    if (synchronous)
+        loader.Finish(uploader);
+
+    uint64_t frameStart = start;
+    while (!result.Frames || loader.GetPendingCount()) {
+        loader.Upload(uploader, budget);
+        Sleep(options.RenderMilliseconds);
+        uint64_t now = GetMonotonicNanoseconds();
+        double frame = GetMilliseconds(frameStart, now);
+        frameStart = now;
+
+        if (!result.Frames++)
+            result.FirstFrame = GetMilliseconds(start, now);
+        result.LongestFrame = frame > result.LongestFrame ? frame : result.LongestFrame;
+        result.SlowFrames += frame > 1000.0 / 60;
+        if (!result.Essential) {
+            bool essential = true;
+            for (size_t i = 0; i < scene.size() && essential; ++i)
+                essential = scene[i].Priority != LoadPriorityHigh || loader.GetTexture(handles[i]);
+            if (essential)
+                result.Essential = GetMilliseconds(start, now);
+        }
+    }
+    result.Complete = GetMilliseconds(start, GetMonotonicNanoseconds());
+    return result;
+}
+
+static void PrintResult(const char* name, const StartupResult& result)
+{
+    printf("  %-30s %8.1f %8.1f %8.1f %8.1f %5d %5d\n", name, result.FirstFrame,
+           result.Essential, result.Complete, result.LongestFrame, result.Frames,
+           result.SlowFrames);
+}
+
+static int Report(const BenchmarkOptions& options)
+{
+    MemoryPngDecoder decoder;
+    vector<SceneImage> scene = MakeScene(options.ImageCount, decoder);
+    double megabytes = 0;
+    for (size_t i = 0; i < scene.size(); ++i)
+        megabytes += scene[i].Size * scene[i].Size * 4 / 1048576.0;
+    printf("%d PNGs, %.1f MB decoded, %.0f ms a frame rendering, uploads at %.0f MB/s, "
+           "%d processors\n\n", options.ImageCount, megabytes, options.RenderMilliseconds,
+           options.UploadRate, GetProcessorCount());
+    printf("  %-30s %8s %8s %8s %8s %5s %5s\n", "milliseconds", "first", "high", "all",
+           "longest", "frames", "slow");
+
+    size_t budget = options.BudgetKilobytes * 1024;
+    char name[64];
+    PrintResult("synchronous", Start(options, scene, decoder, 0, true, budget));
+    PrintResult("main thread, one a frame", Start(options, scene, decoder, 0, false, budget));
+    sprintf(name, "%d threads, no budget", options.ThreadCount);
+    PrintResult(name, Start(options, scene, decoder, options.ThreadCount, false, (size_t) -1));
+    sprintf(name, "%d threads, %d KB a frame", options.ThreadCount, options.BudgetKilobytes);
+    PrintResult(name, Start(options, scene, decoder, options.ThreadCount, false, budget));
+    return 0;
+}
+
+static int Verify()
+{
+    int failures = 0;
+    MemoryPngDecoder decoder;
+    vector<SceneImage> scene = MakeScene(12, decoder);
+
+    // Every image arrives intact, with or without threads.
+    for (int threadCount = 0; threadCount <= 4; threadCount += 2) {
+        StubUploader uploader(100000);
+        AsyncLoader loader(&decoder, threadCount);
+        vector<LoadHandle> handles;
+        for (size_t i = 0; i < scene.size(); ++i)
+            handles.push_back(loader.Load(scene[i].Name, scene[i].Priority));
+        loader.Finish(uploader);
+        for (size_t i = 0; i < scene.size(); ++i) {
+            unsigned int texture = loader.GetTexture(handles[i]);
+            if (loader.GetState(handles[i]) != LoadStateUploaded || !texture ||
+                uploader.Checksums[texture] != scene[i].Checksum) {
+                printf("%s didn't arrive intact with %d threads.\n", scene[i].Name.c_str(),
+                       threadCount);
+                ++failures;
+            }
+        }
+        if (loader.GetPendingCount()) {
+            printf("Finish returned with requests pending.\n");
+            ++failures;
+        }
+    }
+
+    // Without threads the order is fixed: most important first, and in
+    // the order asked for within a priority.
+    {
+        StubUploader uploader(100000);
+        AsyncLoader loader(&decoder, 0);
+        for (int i = scene.size() - 1; i >= 0; --i)
+            loader.Load(scene[i].Name, scene[i].Priority);
+        vector<size_t> expected;
+        for (int priority = 0; priority < LoadPriorityCount; ++priority)
+            for (int i = scene.size() - 1; i >= 0; --i)
+                if (scene[i].Priority == priority)
+                    expected.push_back(scene[i].Size * scene[i].Size * 4);
+        while (loader.Upload(uploader, 0))
+            ;
+        if (uploader.Sizes != expected) {
+            printf("Uploads didn't go in order of priority.\n");
+            ++failures;
+        }
+    }
+
+    // The budget holds, except for one image too big for it alone.
+    {
+        StubUploader uploader(100000);
+        AsyncLoader loader(&decoder, 2);
+        vector<LoadHandle> handles;
+        for (size_t i = 0; i < scene.size(); ++i)
+            handles.push_back(loader.Load(scene[i].Name, LoadPriorityNormal));
+        size_t budget = 600 * 1024;
+        int calls = 0;
+        while (loader.GetPendingCount() && calls < 100000) {
+            size_t before = uploader.Sizes.size();
+            int uploaded = loader.Upload(uploader, budget);
+            size_t spent = 0;
+            for (size_t i = before; i < uploader.Sizes.size(); ++i)
+                spent += uploader.Sizes[i];
+            if (uploaded > 1 && spent > budget) {
+                printf("One call uploaded %d bytes against a budget of %d.\n", (int) spent,
+                       (int) budget);
+                ++failures;
+                break;
+            }
+            ++calls;
+            Sleep(0.1);
+        }
+        if (loader.GetPendingCount()) {
+            printf("Uploading under a budget never finished.\n");
+            ++failures;
+        }
+    }
+
+    // Missing files and refused uploads both fail without holding anything up.
+    {
+        StubUploader uploader(100000);
+        uploader.FailEvery(2);
+        AsyncLoader loader(&decoder, 2);
+        LoadHandle missing = loader.Load("Missing.png", LoadPriorityHigh);
+        LoadHandle first = loader.Load(scene[0].Name, LoadPriorityHigh);
+        LoadHandle second = loader.Load(scene[1].Name, LoadPriorityHigh);
+        loader.Finish(uploader);
+        if (loader.GetState(missing) != LoadStateFailed || loader.GetTexture(missing)) {
+            printf("A missing file didn't fail.\n");
+            ++failures;
+        }
+        int refused = (loader.GetState(first) == LoadStateFailed) +
+                      (loader.GetState(second) == LoadStateFailed);
+        if (refused != 1 || loader.GetPendingCount()) {
+            printf("A refused upload didn't fail cleanly.\n");
+            ++failures;
+        }
+    }
+
+    // Lots of small requests across threads, uploaded as they come in, and
+    // a loader torn down with work outstanding.
+    {
+        MemoryPngDecoder small;
+        vector<SceneImage> tiles;
+        for (int i = 0; i < 16; ++i) {
+            SceneImage tile;
+            char name[32];
+            sprintf(name, "Tile%d.png", i);
+            tile.Name = name;
+            vector<unsigned char> pixels = MakePixels(16, i);
+            tile.Checksum = Checksum(pixels);
+            small.AddFile(name, EncodePng(16, pixels));
+            tiles.push_back(tile);
+        }
+        StubUploader uploader(100000);
+        AsyncLoader loader(&small, 4);
+        vector<LoadHandle> handles;
+        for (int i = 0; i < 2000; ++i) {
+            handles.push_back(loader.Load(tiles[i % 16].Name, (LoadPriority) (i % 3)));
+            if (i % 10 == 0)
+                loader.Upload(uploader, 4096);
+        }
+        loader.Finish(uploader);
+        for (size_t i = 0; i < handles.size(); ++i) {
+            if (uploader.Checksums[loader.GetTexture(handles[i])] != tiles[i % 16].Checksum) {
+                printf("Request %d came back wrong under load.\n", (int) i);
+                ++failures;
+                break;
+            }
+        }
+
+        AsyncLoader abandoned(&decoder, 3);
+        for (int i = 0; i < 50; ++i)
+            abandoned.Load(scene[i % scene.size()].Name, LoadPriorityLow);
+    }
+
+    if (failures)
+        printf("%d checks failed\n", failures);
+    else
+        printf("Every check passed\n");
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options = ParseOptions(argc, argv);
+    if (options.Verify)
+        return Verify();
+    return Report(options);
+}
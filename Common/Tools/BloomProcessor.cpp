@@ -0,0 +1,409 @@
+// BloomProcessor runs GaussianBloom's bloom on the CPU, with BloomFilter.hpp,
+// over a PNG or a stream of raw video frames.  The output is the reference
+// that captures from the sample get compared with, and the raw mode slots
+// between two ffmpeg processes for post-processing video offline:
+//
+//     ffmpeg -i in.mp4 -f rawvideo -pix_fmt rgba - |
+//         BloomProcessor -raw 1280x720 |
+//         ffmpeg -f rawvideo -pix_fmt rgba -s 1280x720 -i - out.mp4
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o BloomProcessor BloomProcessor.cpp -lpng -lpthread
+//
+// Usage:
+//
+//     BloomProcessor [options] input.png output.png
+//     BloomProcessor [options] -raw WxH < input > output
+//     BloomProcessor -verify
+//     BloomProcessor -bench WxH
+//
+//     -k taps        binomial kernel with this many taps (default 5, as in
+//                    GaussianBloom)
+//     -g radius,sigma  Gaussian kernel instead
+//     -l levels      levels in the chain (default 5)
+//     -b level       first level to blur (default 2)
+//     -a level       first level to add to the scene (default 1)
+//     -t threshold   luminance that counts as bright (default 0.85)
+//     -j threads     threads to filter with (default: one per processor)
+//     -565           raw frames are RGB565 rather than RGBA8
+//     -scalar        leave out SSE2 and NEON
+//     -verify        check the kernels, the SIMD and threaded paths, and RGB565
+//     -bench WxH     time the chain on a random image of this size
+//
+// The blur, its 8.8 fixed point weights and the per-level rounding follow
+// the sample's RGBA8 framebuffers, so results differ from a float
+// Gaussian by a step or two per channel.
+
+#include "../Classes/BloomFilter.hpp"
+#include "../Classes/MonotonicClock.hpp"
+#include <png.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct ProcessorOptions {
+    ProcessorOptions() :
+        Taps(5), Radius(0), Sigma(0), Rgb565(false), Raw(false), RawWidth(0), RawHeight(0),
+        Verify(false), BenchWidth(0), BenchHeight(0)
+    {
+        Bloom.ThreadCount = GetProcessorCount();
+    }
+    BloomKernel GetKernel() const
+    {
+        return Sigma > 0 ? BloomKernel::Gaussian(Radius, Sigma) : BloomKernel::Binomial(Taps);
+    }
+    BloomOptions Bloom;
+    int Taps;
+    int Radius;
+    float Sigma;
+    bool Rgb565;
+    bool Raw;
+    int RawWidth;
+    int RawHeight;
+    bool Verify;
+    int BenchWidth;
+    int BenchHeight;
+    string Input;
+    string Output;
+};
+
+static void Usage()
+{
+    printf("Usage: BloomProcessor [options] input.png output.png\n"
+           "       BloomProcessor [options] -raw WxH < input > output\n"
+           "       BloomProcessor -verify\n"
+           "       BloomProcessor -bench WxH\n"
+           "  -k taps          binomial kernel with this many taps\n"
+           "  -g radius,sigma  Gaussian kernel instead\n"
+           "  -l levels        levels in the chain\n"
+           "  -b level         first level to blur\n"
+           "  -a level         first level to add to the scene\n"
+           "  -t threshold     luminance that counts as bright\n"
+           "  -j threads       threads to filter with\n"
+           "  -565             raw frames are RGB565 rather than RGBA8\n"
+           "  -scalar          leave out SSE2 and NEON\n"
+           "  -verify          check kernels, SIMD, threads, and RGB565\n"
+           "  -bench WxH       time the chain on a random image\n");
+    exit(1);
+}
+
+static ProcessorOptions ParseOptions(int argc, char** argv)
+{
+    ProcessorOptions options;
+    vector<string> files;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-k" && hasValue)
+            options.Taps = atoi(argv[++i]);
+        else if (arg == "-g" && hasValue) {
+            if (sscanf(argv[++i], "%d,%f", &options.Radius, &options.Sigma) != 2)
+                Usage();
+        } else if (arg == "-l" && hasValue)
+            options.Bloom.LevelCount = atoi(argv[++i]);
+        else if (arg == "-b" && hasValue)
+            options.Bloom.FirstBlurred = atoi(argv[++i]);
+        else if (arg == "-a" && hasValue)
+            options.Bloom.FirstAccumulated = atoi(argv[++i]);
+        else if (arg == "-t" && hasValue)
+            options.Bloom.Threshold = (float) atof(argv[++i]);
+        else if (arg == "-j" && hasValue)
+            options.Bloom.ThreadCount = atoi(argv[++i]);
+        else if (arg == "-565")
+            options.Rgb565 = true;
+        else if (arg == "-scalar")
+            options.Bloom.Simd = false;
+        else if (arg == "-raw" && hasValue) {
+            options.Raw = true;
+            if (sscanf(argv[++i], "%dx%d", &options.RawWidth, &options.RawHeight) != 2)
+                Usage();
+        } else if (arg == "-verify")
+            options.Verify = true;
+        else if (arg == "-bench" && hasValue) {
+            if (sscanf(argv[++i], "%dx%d", &options.BenchWidth, &options.BenchHeight) != 2)
+                Usage();
+        } else if (arg[0] == '-')
+            Usage();
+        else
+            files.push_back(arg);
+    }
+
+    bool standalone = options.Verify || options.BenchWidth > 0 || options.Raw;
+    if (files.size() != (standalone ? 0 : 2))
+        Usage();
+    if (!files.empty()) {
+        options.Input = files[0];
+        options.Output = files[1];
+    }
+    if (options.Taps < 1 || (options.Sigma > 0 && options.Radius < 1) ||
+        options.Bloom.LevelCount < 1 || options.Bloom.ThreadCount < 1 ||
+        (options.Raw && (options.RawWidth < 1 || options.RawHeight < 1)) ||
+        (options.BenchWidth > 0 && options.BenchHeight < 1))
+        Usage();
+    return options;
+}
+
+static bool ReadPng(const string& path, BloomImage& image)
+{
+    png_image png;
+    memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&png, path.c_str()))
+        return false;
+    png.format = PNG_FORMAT_RGBA;
+    image.Resize(png.width, png.height);
+    return png_image_finish_read(&png, 0, &image.Texels[0], 0, 0) != 0;
+}
+
+static bool WritePng(const string& path, const BloomImage& image)
+{
+    png_image png;
+    memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    png.width = image.Width;
+    png.height = image.Height;
+    png.format = PNG_FORMAT_RGBA;
+    return png_image_write_to_file(&png, path.c_str(), 0, &image.Texels[0], 0, 0) != 0;
+}
+
+// Frames go through one at a time until the input runs out; a partial
+// frame at the end is dropped.
+static int ProcessRaw(const ProcessorOptions& options)
+{
+    BloomFilter filter(options.GetKernel(), options.Bloom);
+    BloomImage frame, result;
+    frame.Resize(options.RawWidth, options.RawHeight,
+                 options.Rgb565 ? BloomFormatRgb565 : BloomFormatRgba8);
+
+    int frameCount = 0;
+    uint64_t start = GetMonotonicNanoseconds();
+    while (fread(&frame.Texels[0], frame.Texels.size(), 1, stdin) == 1) {
+        filter.Apply(frame, result);
+        if (fwrite(&result.Texels[0], result.Texels.size(), 1, stdout) != 1) {
+            fprintf(stderr, "Unable to write frame %d.\n", frameCount);
+            return 1;
+        }
+        ++frameCount;
+    }
+
+    double seconds = (GetMonotonicNanoseconds() - start) * 1e-9;
+    fprintf(stderr, "%d frames at %dx%d, %.2f ms per frame\n", frameCount,
+            options.RawWidth, options.RawHeight, frameCount ? seconds * 1000 / frameCount : 0.0);
+    return 0;
+}
+
+static void FillRandom(BloomImage& image, int width, int height)
+{
+    image.Resize(width, height);
+    for (size_t i = 0; i < image.Texels.size(); ++i)
+        image.Texels[i] = (unsigned char) (rand() % 4 ? rand() % 256 : 240 + rand() % 16);
+}
+
+static int Benchmark(const ProcessorOptions& options)
+{
+    srand(1);
+    BloomImage scene, result;
+    FillRandom(scene, options.BenchWidth, options.BenchHeight);
+    BloomKernel kernel = options.GetKernel();
+    const int Repeats = 10;
+
+    printf("%dx%d, %d-tap kernel, %d levels\n\n", scene.Width, scene.Height,
+           kernel.GetRadius() * 2 + 1, options.Bloom.LevelCount);
+    printf("%-8s %8s %10s %10s\n", "path", "threads", "ms/frame", "Mpixel/s");
+    for (int simd = 0; simd < 2; ++simd) {
+        for (int threads = 1; threads <= options.Bloom.ThreadCount; threads *= 2) {
+            BloomOptions bloom = options.Bloom;
+            bloom.Simd = simd != 0;
+            bloom.ThreadCount = threads;
+            BloomFilter filter(kernel, bloom);
+            filter.Apply(scene, result);
+
+            uint64_t start = GetMonotonicNanoseconds();
+            for (int i = 0; i < Repeats; ++i)
+                filter.Apply(scene, result);
+            double ms = (GetMonotonicNanoseconds() - start) * 1e-6 / Repeats;
+            printf("%-8s %8d %10.2f %10.1f\n", simd ? "simd" : "scalar", threads, ms,
+                   scene.Width * scene.Height / (ms * 1000));
+        }
+    }
+    return 0;
+}
+
+static bool SameLevels(const BloomFilter& a, const BloomFilter& b)
+{
+    for (int i = 0; i < a.GetLevelCount(); ++i)
+        if (a.GetLevel(i).Texels != b.GetLevel(i).Texels)
+            return false;
+    return true;
+}
+
+// Largest difference between a blurred level and the same blur in double
+// precision, rounding between the passes the way RGBA8 framebuffers do.
+static int CompareBlur(const BloomKernel& kernel, const BloomImage& scene)
+{
+    BloomOptions options;
+    options.LevelCount = 1;
+    options.FirstBlurred = 0;
+    options.Threshold = -1;
+    BloomFilter filter(kernel, options);
+    BloomImage result;
+    filter.Apply(scene, result);
+
+    int width = scene.Width, height = scene.Height, radius = kernel.GetRadius();
+    vector<double> rows(scene.Texels.size());
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+            for (int c = 0; c < 3; ++c) {
+                double sum = 0;
+                for (int k = -radius; k <= radius; ++k) {
+                    int column = x + k < 0 ? 0 : (x + k < width ? x + k : width - 1);
+                    sum += kernel.GetWeight(k) * scene.Texels[(y * width + column) * 4 + c];
+                }
+                rows[(y * width + x) * 4 + c] = (int) (sum + 0.5);
+            }
+
+    int largest = 0;
+    const BloomImage& blurred = filter.GetLevel(0);
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+            for (int c = 0; c < 3; ++c) {
+                double sum = 0;
+                for (int k = -radius; k <= radius; ++k) {
+                    int row = y + k < 0 ? 0 : (y + k < height ? y + k : height - 1);
+                    sum += kernel.GetWeight(k) * rows[(row * width + x) * 4 + c];
+                }
+                int difference = abs((int) (sum + 0.5) - blurred.Texels[(y * width + x) * 4 + c]);
+                largest = difference > largest ? difference : largest;
+            }
+    return largest;
+}
+
+static int Verify()
+{
+    int failures = 0;
+
+    // GaussianBloom's hand-written kernel is the 5-tap binomial folded.
+    vector<BloomSample> samples = BloomKernel::Binomial(5).GetSamples();
+    bool matches = samples.size() == 2 && fabs(samples[0].Weight - 6 / 16.0f) < 1e-6f &&
+                   fabs(samples[1].Weight - 5 / 16.0f) < 1e-6f &&
+                   fabs(samples[1].Offset - 1.2f) < 1e-6f;
+    printf("5-tap binomial folds to GaussianBloom's kernel: %s\n", matches ? "yes" : "NO");
+    failures += !matches;
+
+    // Bilinear samples have to weigh each texel as the kernel does.
+    float largestError = 0;
+    for (int i = 0; i < 16; ++i) {
+        BloomKernel kernel = i < 8 ? BloomKernel::Binomial(3 + i * 2) :
+                                     BloomKernel::Gaussian(i - 7, (i - 7) * 0.6f);
+        vector<float> weights(kernel.GetRadius() + 2, 0);
+        samples = kernel.GetSamples();
+        weights[0] = samples[0].Weight;
+        for (size_t j = 1; j < samples.size(); ++j) {
+            int texel = (int) samples[j].Offset;
+            float fraction = samples[j].Offset - texel;
+            weights[texel] += samples[j].Weight * (1 - fraction);
+            weights[texel + 1] += samples[j].Weight * fraction;
+        }
+        for (int j = 0; j <= kernel.GetRadius(); ++j)
+            largestError = max(largestError, (float) fabs(weights[j] - kernel.GetWeight(j)));
+    }
+    printf("Largest texel weight error after folding: %g\n", largestError);
+    failures += largestError > 1e-5f;
+
+    srand(1);
+    BloomImage scene;
+    FillRandom(scene, 157, 93);
+    int binomialError = CompareBlur(BloomKernel::Binomial(5), scene);
+    int gaussianError = CompareBlur(BloomKernel::Gaussian(6, 3), scene);
+    printf("Largest blur difference from double precision: %d (binomial), %d (Gaussian)\n",
+           binomialError, gaussianError);
+    failures += binomialError > 1 || gaussianError > 2;
+
+    // Odd sizes, so levels round down and SIMD rows have scalar tails.
+    BloomKernel kernel = BloomKernel::Gaussian(4, 2);
+    BloomOptions options;
+    options.FirstBlurred = 0;
+    options.Threshold = 0.5f;
+    options.Simd = false;
+    BloomFilter scalar(kernel, options);
+    BloomImage expected, result;
+    scalar.Apply(scene, expected);
+
+    options.Simd = true;
+    BloomFilter simd(kernel, options);
+    simd.Apply(scene, result);
+    matches = result.Texels == expected.Texels && SameLevels(simd, scalar);
+    printf("SIMD matches scalar: %s\n", matches ? "yes" : "NO");
+    failures += !matches;
+
+    options.ThreadCount = 3;
+    BloomFilter threaded(kernel, options);
+    threaded.Apply(scene, result);
+    matches = result.Texels == expected.Texels && SameLevels(threaded, scalar);
+    printf("3 threads match 1: %s\n", matches ? "yes" : "NO");
+    failures += !matches;
+
+    // RGB565 goes in as its RGBA8 expansion would, and comes out packed.
+    BloomImage packed, unpacked;
+    packed.Resize(scene.Width, scene.Height, BloomFormatRgb565);
+    unpacked.Resize(scene.Width, scene.Height);
+    unsigned short* texels = (unsigned short*) &packed.Texels[0];
+    for (int i = 0; i < scene.Width * scene.Height; ++i) {
+        const unsigned char* rgba = &scene.Texels[i * 4];
+        texels[i] = (unsigned short) ((rgba[0] >> 3) << 11 | (rgba[1] >> 2) << 5 | rgba[2] >> 3);
+        unpacked.Texels[i * 4] = (unsigned char) ((rgba[0] >> 3) * 255 / 31);
+        unpacked.Texels[i * 4 + 1] = (unsigned char) ((rgba[1] >> 2) * 255 / 63);
+        unpacked.Texels[i * 4 + 2] = (unsigned char) ((rgba[2] >> 3) * 255 / 31);
+        unpacked.Texels[i * 4 + 3] = 255;
+    }
+    threaded.Apply(unpacked, expected);
+    threaded.Apply(packed, result);
+    const unsigned short* results = (const unsigned short*) &result.Texels[0];
+    matches = result.Format == BloomFormatRgb565;
+    for (int i = 0; i < scene.Width * scene.Height && matches; ++i) {
+        const unsigned char* rgba = &expected.Texels[i * 4];
+        int r = (rgba[0] * 31 + 127) / 255, g = (rgba[1] * 63 + 127) / 255;
+        int b = (rgba[2] * 31 + 127) / 255;
+        matches = results[i] == (r << 11 | g << 5 | b);
+    }
+    printf("RGB565 matches RGBA8: %s\n", matches ? "yes" : "NO");
+    failures += !matches;
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+    ProcessorOptions options = ParseOptions(argc, argv);
+    if (options.Verify)
+        return Verify();
+    if (options.BenchWidth > 0)
+        return Benchmark(options);
+    if (options.Raw)
+        return ProcessRaw(options);
+
+    BloomImage scene, result;
+    if (!ReadPng(options.Input, scene)) {
+        printf("Unable to read %s.\n", options.Input.c_str());
+        return 1;
+    }
+
+    uint64_t start = GetMonotonicNanoseconds();
+    BloomFilter filter(options.GetKernel(), options.Bloom);
+    filter.Apply(scene, result);
+    double ms = (GetMonotonicNanoseconds() - start) * 1e-6;
+
+    if (!WritePng(options.Output, result)) {
+        printf("Unable to write %s.\n", options.Output.c_str());
+        return 1;
+    }
+    printf("Wrote %s (%dx%d) in %.2f ms\n", options.Output.c_str(), result.Width,
+           result.Height, ms);
+    return 0;
+}
@@ -0,0 +1,405 @@
+// DistanceFieldGenerator turns the coverage of an image into the 8-bit
+// signed distance field that the DistanceField sample's shaders read, using
+// the exact transform in DistanceTransform.hpp.  It replaces the Python
+// propagation in GenerateDistanceField.py, which took minutes on Aum.png.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o DistanceFieldGenerator DistanceFieldGenerator.cpp -lpng -lpthread
+//
+// Usage:
+//
+//     DistanceFieldGenerator [options] input.png output.png
+//     DistanceFieldGenerator [options] input.png output.pvr
+//     DistanceFieldGenerator [options] input.png output.h   (C header, like PVRTexTool -h)
+//     DistanceFieldGenerator -bench size
+//     DistanceFieldGenerator -verify
+//
+//     -s spread     source texels from the edge to full black or white (default 25)
+//     -b border     empty texels added around the source (default: the spread)
+//     -d factor     downsampling factor (default 4)
+//     -c channel    r, g, b, or a: where coverage comes from (default a)
+//     -t threshold  coverage above this is inside (default 0)
+//     -coverage     write the downsampled, inverted coverage instead of the
+//                   distance, for side-by-side comparisons (SmallAum)
+//     -nopot        don't center the result on a power-of-two canvas
+//     -noflip       keep rows top-down in PVR output
+//     -n name       array name for C headers (default: the output's base name)
+//     -j threads    threads (default: one per processor)
+//     -stats        print the time taken by each step
+//     -bench size   time the transform on a synthetic size x size image
+//     -verify       compare the transform with brute force on random masks
+//
+// Inside texels come out below 128 and outside texels above, with 128 on the
+// edge, and PVR output is I8 so that it uploads as GL_ALPHA.
+
+#include "../Classes/DistanceTransform.hpp"
+#include "../Classes/PvrWriter.hpp"
+#include <png.h>
+#include <sys/time.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct GeneratorOptions {
+    GeneratorOptions() : Spread(25), Border(-1), Factor(4), Channel(3), Threshold(0),
+                         Coverage(false), PowerOfTwo(true), Flip(true), Stats(false),
+                         Threads(GetProcessorCount()), BenchmarkSize(0), Verify(false) {}
+    string Input;
+    string Output;
+    string Name;
+    float Spread;
+    int Border;
+    int Factor;
+    int Channel;
+    int Threshold;
+    bool Coverage;
+    bool PowerOfTwo;
+    bool Flip;
+    bool Stats;
+    int Threads;
+    int BenchmarkSize;
+    bool Verify;
+};
+
+static void Usage()
+{
+    printf("Usage: DistanceFieldGenerator [options] input.png output.png|output.pvr|output.h\n"
+           "       DistanceFieldGenerator -bench size\n"
+           "       DistanceFieldGenerator -verify\n"
+           "  -s spread     source texels from the edge to black or white\n"
+           "  -b border     empty texels added around the source\n"
+           "  -d factor     downsampling factor\n"
+           "  -c channel    r, g, b, or a\n"
+           "  -t threshold  coverage above this is inside\n"
+           "  -coverage     write the inverted coverage instead\n"
+           "  -nopot        no power-of-two canvas\n"
+           "  -noflip       keep rows top-down\n"
+           "  -n name       array name for C headers\n"
+           "  -j threads    thread count\n"
+           "  -stats        print timings\n"
+           "  -verify       compare the transform with brute force\n");
+    exit(1);
+}
+
+static GeneratorOptions ParseOptions(int argc, char** argv)
+{
+    GeneratorOptions options;
+    vector<string> files;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-s" && hasValue)
+            options.Spread = (float) atof(argv[++i]);
+        else if (arg == "-b" && hasValue)
+            options.Border = atoi(argv[++i]);
+        else if (arg == "-d" && hasValue)
+            options.Factor = atoi(argv[++i]);
+        else if (arg == "-c" && hasValue) {
+            string channel = argv[++i];
+            options.Channel = string("rgba").find(channel);
+            if (channel.size() != 1 || options.Channel < 0)
+                Usage();
+        } else if (arg == "-t" && hasValue)
+            options.Threshold = atoi(argv[++i]);
+        else if (arg == "-coverage")
+            options.Coverage = true;
+        else if (arg == "-nopot")
+            options.PowerOfTwo = false;
+        else if (arg == "-noflip")
+            options.Flip = false;
+        else if (arg == "-n" && hasValue)
+            options.Name = argv[++i];
+        else if (arg == "-j" && hasValue)
+            options.Threads = atoi(argv[++i]);
+        else if (arg == "-stats")
+            options.Stats = true;
+        else if (arg == "-bench" && hasValue)
+            options.BenchmarkSize = atoi(argv[++i]);
+        else if (arg == "-verify")
+            options.Verify = true;
+        else if (arg[0] == '-')
+            Usage();
+        else
+            files.push_back(arg);
+    }
+
+    if ((options.BenchmarkSize > 0 || options.Verify) && files.empty())
+        return options;
+    if (files.size() != 2 || options.Spread <= 0 || options.Factor < 1)
+        Usage();
+    if (options.Threads < 1)
+        options.Threads = 1;
+    if (options.Border < 0)
+        options.Border = (int) (options.Spread + 0.5f);
+
+    options.Input = files[0];
+    options.Output = files[1];
+    if (options.Name.empty()) {
+        string name = options.Output;
+        size_t slash = name.find_last_of("/\\");
+        if (slash != string::npos)
+            name = name.substr(slash + 1);
+        options.Name = name.substr(0, name.find('.'));
+    }
+    return options;
+}
+
+static double GetSeconds()
+{
+    timeval now;
+    gettimeofday(&now, 0);
+    return now.tv_sec + now.tv_usec * 1e-6;
+}
+
+static bool EndsWith(const string& s, const string& suffix)
+{
+    return s.size() >= suffix.size() &&
+           s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+static int NextPowerOfTwo(int value)
+{
+    int result = 1;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+
+static bool ReadPng(const string& path, int* width, int* height, vector<unsigned char>& rgba)
+{
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&image, path.c_str())) {
+        printf("%s: %s\n", path.c_str(), image.message);
+        return false;
+    }
+    image.format = PNG_FORMAT_RGBA;
+    rgba.resize(PNG_IMAGE_SIZE(image));
+    if (!png_image_finish_read(&image, 0, &rgba[0], 0, 0)) {
+        printf("%s: %s\n", path.c_str(), image.message);
+        return false;
+    }
+    *width = image.width;
+    *height = image.height;
+    return true;
+}
+
+static bool WritePng(const string& path, int width, int height, const vector<unsigned char>& gray)
+{
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    image.width = width;
+    image.height = height;
+    image.format = PNG_FORMAT_GRAY;
+    if (!png_image_write_to_file(&image, path.c_str(), 0, &gray[0], 0, 0)) {
+        printf("%s: %s\n", path.c_str(), image.message);
+        return false;
+    }
+    return true;
+}
+
+// A few hundred overlapping rings, which keeps the row pass's parabola
+// envelope busier than a single glyph would.
+static void MakeBenchmarkMask(int size, vector<unsigned char>& mask)
+{
+    mask.assign(size * size, 0);
+    srand(1);
+    for (int ring = 0; ring < 300; ++ring) {
+        int cx = rand() % size, cy = rand() % size;
+        int outer = size / 64 + rand() % (size / 16 + 1);
+        int inner = outer * 2 / 3;
+        int y0 = max(cy - outer, 0), y1 = min(cy + outer, size - 1);
+        int x0 = max(cx - outer, 0), x1 = min(cx + outer, size - 1);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                int d = (x - cx) * (x - cx) + (y - cy) * (y - cy);
+                if (d <= outer * outer && d >= inner * inner)
+                    mask[y * size + x] ^= 1;
+            }
+        }
+    }
+}
+
+static int Benchmark(const GeneratorOptions& options)
+{
+    int size = options.BenchmarkSize;
+    vector<unsigned char> mask;
+    MakeBenchmarkMask(size, mask);
+
+    vector<float> distances;
+    DistanceTransform transform(options.Threads);
+    transform.Compute(&mask[0], size, size, distances);
+
+    const int Runs = 5;
+    double best = 1e9;
+    for (int run = 0; run < Runs; ++run) {
+        double start = GetSeconds();
+        transform.Compute(&mask[0], size, size, distances);
+        double elapsed = GetSeconds() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    printf("%dx%d, %d threads: %.1f ms, %.1f MPixel/s\n", size, size, options.Threads,
+           best * 1000, size * (double) size / best * 1e-6);
+    return 0;
+}
+
+// The squared distance from each texel to the nearest texel on the other
+// side of the edge, the slow way.
+static void BruteForceDistances(const vector<unsigned char>& mask, int width, int height,
+                                vector<float>& distances)
+{
+    distances.resize(width * height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            bool inside = mask[y * width + x] != 0;
+            int nearest = -1;
+            for (int j = 0; j < height; ++j) {
+                for (int i = 0; i < width; ++i) {
+                    if ((mask[j * width + i] != 0) == inside)
+                        continue;
+                    int d = (x - i) * (x - i) + (y - j) * (y - j);
+                    if (nearest < 0 || d < nearest)
+                        nearest = d;
+                }
+            }
+            float root = sqrt((float) nearest);
+            distances[y * width + x] = inside ? 0.5f - root : root - 0.5f;
+        }
+    }
+}
+
+static int Verify(const GeneratorOptions& options)
+{
+    srand(1);
+    int failures = 0, trials = 0;
+    while (trials < 300) {
+        int width = 1 + rand() % 48, height = 1 + rand() % 48;
+        int density = rand() % 101;
+        vector<unsigned char> mask(width * height);
+        int insideCount = 0;
+        for (size_t i = 0; i < mask.size(); ++i) {
+            mask[i] = rand() % 100 < density;
+            insideCount += mask[i];
+        }
+
+        // Without both sides there is no edge to measure to.
+        if (!insideCount || insideCount == (int) mask.size())
+            continue;
+
+        vector<float> expected, single, threaded;
+        BruteForceDistances(mask, width, height, expected);
+        DistanceTransform(1).Compute(&mask[0], width, height, single);
+        DistanceTransform(options.Threads).Compute(&mask[0], width, height, threaded);
+        if (single != expected || threaded != expected) {
+            printf("Mismatch on a %dx%d mask, %d%% inside.\n", width, height, density);
+            ++failures;
+        }
+        ++trials;
+    }
+    printf("%d of %d masks match\n", trials - failures, trials);
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+    GeneratorOptions options = ParseOptions(argc, argv);
+    if (options.BenchmarkSize > 0)
+        return Benchmark(options);
+    if (options.Verify)
+        return Verify(options);
+
+    int sourceWidth, sourceHeight;
+    vector<unsigned char> rgba;
+    if (!ReadPng(options.Input, &sourceWidth, &sourceHeight, rgba))
+        return 1;
+
+    // Pad the coverage with an empty border so that the field can fall off
+    // outside the shape.
+    int border = options.Border;
+    int width = sourceWidth + border * 2;
+    int height = sourceHeight + border * 2;
+    vector<unsigned char> mask(width * height, 0);
+    for (int y = 0; y < sourceHeight; ++y) {
+        const unsigned char* source = &rgba[y * sourceWidth * 4 + options.Channel];
+        unsigned char* dest = &mask[(y + border) * width + border];
+        for (int x = 0; x < sourceWidth; ++x)
+            dest[x] = source[x * 4] > options.Threshold;
+    }
+
+    double start = GetSeconds();
+    vector<float> field;
+    if (options.Coverage) {
+        // Inverted, like the distance field, so the two look alike.
+        field.resize(mask.size());
+        for (size_t i = 0; i < mask.size(); ++i) {
+            unsigned char coverage = 0;
+            int y = i / width - border, x = i % width - border;
+            if (x >= 0 && x < sourceWidth && y >= 0 && y < sourceHeight)
+                coverage = rgba[(y * sourceWidth + x) * 4 + options.Channel];
+            field[i] = (255 - coverage) / 255.0f;
+        }
+    } else {
+        DistanceTransform transform(options.Threads);
+        transform.Compute(&mask[0], width, height, field);
+    }
+    double transformed = GetSeconds();
+
+    vector<float> small;
+    DownsampleDistances(field, width, height, options.Factor, small);
+    int smallWidth = width / options.Factor;
+    int smallHeight = height / options.Factor;
+
+    int destWidth = options.PowerOfTwo ? NextPowerOfTwo(smallWidth) : smallWidth;
+    int destHeight = options.PowerOfTwo ? NextPowerOfTwo(smallHeight) : smallHeight;
+    int left = (destWidth - smallWidth) / 2;
+    int top = (destHeight - smallHeight) / 2;
+    vector<unsigned char> texels(destWidth * destHeight, 255);
+    for (int y = 0; y < smallHeight; ++y) {
+        const float* source = &small[y * smallWidth];
+        unsigned char* dest = &texels[(y + top) * destWidth + left];
+        for (int x = 0; x < smallWidth; ++x) {
+            if (options.Coverage)
+                dest[x] = (unsigned char) (source[x] * 255 + 0.5f);
+            else
+                dest[x] = QuantizeDistance(source[x], options.Spread);
+        }
+    }
+    double quantized = GetSeconds();
+
+    bool written;
+    if (EndsWith(options.Output, ".pvr") || EndsWith(options.Output, ".h")) {
+        vector<unsigned char> rows(texels);
+        if (options.Flip)
+            for (int y = 0; y < destHeight; ++y)
+                memcpy(&rows[y * destWidth], &texels[(destHeight - 1 - y) * destWidth], destWidth);
+        PvrWriter writer(PvrPixelTypeI8, destWidth, destHeight);
+        writer.SetVerticallyFlipped(options.Flip);
+        writer.AddLevel(rows);
+        if (EndsWith(options.Output, ".h"))
+            written = writer.WriteSource(options.Output.c_str(), options.Name.c_str());
+        else
+            written = writer.WriteFile(options.Output.c_str());
+    } else {
+        written = WritePng(options.Output, destWidth, destHeight, texels);
+    }
+    if (!written) {
+        printf("Unable to write %s.\n", options.Output.c_str());
+        return 1;
+    }
+
+    if (options.Stats) {
+        printf("  transform: %dx%d, %.1f ms on %d threads\n", width, height,
+               (transformed - start) * 1000, options.Threads);
+        printf("  downsample and quantize: %.1f ms\n", (quantized - transformed) * 1000);
+    }
+    printf("%s: %dx%d, %dx%d on the canvas\n", options.Output.c_str(), destWidth, destHeight,
+           smallWidth, smallHeight);
+    return 0;
+}
@@ -0,0 +1,272 @@
+// FrameStatsReport summarizes a log of frame times with FrameStats.hpp,
+// the same code that the FPS overlays use, so that captured frame times can
+// be looked at on the desktop.  It can also check the percentiles against a
+// full sort and time the per-frame work, making sure it never allocates.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o FrameStatsReport FrameStatsReport.cpp
+//
+// Usage:
+//
+//     FrameStatsReport [options] [times.txt]
+//
+//     -c frames     summarize only the most recent frames (default all)
+//     -b ms         histogram bucket width (default 2)
+//     -n buckets    histogram bucket count (default 16)
+//     -verify       compare the stats with a full sort on random frame times
+//     -bench        time adding and summarizing frames, and count allocations
+//
+// The log has one frame time in milliseconds per line; without a file, the
+// times come from standard input.
+
+#include "../Classes/FrameStats.hpp"
+#include "../Classes/MonotonicClock.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Counts every allocation, so the benchmark can show that none happen
+// between frames.
+static int AllocationCount = 0;
+
+void* operator new(size_t size)
+{
+    ++AllocationCount;
+    void* p = malloc(size ? size : 1);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) throw()
+{
+    free(p);
+}
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void* p, size_t) throw()
+{
+    free(p);
+}
+#endif
+
+struct ReportOptions {
+    ReportOptions() : Capacity(0), BucketWidth(2), BucketCount(16), Verify(false), Bench(false) {}
+    string Log;
+    int Capacity;
+    float BucketWidth;
+    int BucketCount;
+    bool Verify;
+    bool Bench;
+};
+
+static void Usage()
+{
+    printf("Usage: FrameStatsReport [options] [times.txt]\n"
+           "  -c frames     summarize only the most recent frames\n"
+           "  -b ms         histogram bucket width\n"
+           "  -n buckets    histogram bucket count\n"
+           "  -verify       compare the stats with a full sort\n"
+           "  -bench        time adding and summarizing frames\n");
+    exit(1);
+}
+
+static ReportOptions ParseOptions(int argc, char** argv)
+{
+    ReportOptions options;
+    vector<string> files;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-c" && hasValue)
+            options.Capacity = atoi(argv[++i]);
+        else if (arg == "-b" && hasValue)
+            options.BucketWidth = (float) atof(argv[++i]);
+        else if (arg == "-n" && hasValue)
+            options.BucketCount = atoi(argv[++i]);
+        else if (arg == "-verify")
+            options.Verify = true;
+        else if (arg == "-bench")
+            options.Bench = true;
+        else if (arg[0] == '-')
+            Usage();
+        else
+            files.push_back(arg);
+    }
+
+    if (files.size() > 1 || options.Capacity < 0 || options.BucketWidth <= 0 ||
+        options.BucketCount < 1)
+        Usage();
+    if (!files.empty())
+        options.Log = files[0];
+    return options;
+}
+
+static void PrintSummary(const FrameSummary& summary)
+{
+    printf("%d frames, %.1f fps\n", summary.FrameCount, summary.Fps);
+    printf("  mean  %7.2f ms\n", summary.Mean);
+    printf("  p50   %7.2f ms\n", summary.P50);
+    printf("  p95   %7.2f ms\n", summary.P95);
+    printf("  p99   %7.2f ms\n", summary.P99);
+    printf("  worst %7.2f ms\n", summary.Worst);
+}
+
+static int Report(const ReportOptions& options)
+{
+    FILE* file = options.Log.empty() ? stdin : fopen(options.Log.c_str(), "r");
+    if (!file) {
+        printf("Unable to open %s.\n", options.Log.c_str());
+        return 1;
+    }
+    vector<float> times;
+    float time;
+    while (fscanf(file, "%f", &time) == 1)
+        times.push_back(time);
+    if (file != stdin)
+        fclose(file);
+    if (times.empty()) {
+        printf("No frame times.\n");
+        return 1;
+    }
+
+    int capacity = options.Capacity ? options.Capacity : (int) times.size();
+    FrameStats stats(capacity);
+    for (size_t i = 0; i < times.size(); ++i)
+        stats.AddFrameMilliseconds(times[i]);
+
+    FrameSummary summary;
+    stats.Summarize(summary);
+    PrintSummary(summary);
+
+    vector<int> counts(options.BucketCount);
+    stats.Histogram(options.BucketWidth, options.BucketCount, &counts[0]);
+    int most = 1;
+    for (int i = 0; i < options.BucketCount; ++i)
+        most = max(most, counts[i]);
+    for (int i = 0; i < options.BucketCount; ++i) {
+        float low = i * options.BucketWidth;
+        bool last = i == options.BucketCount - 1;
+        printf("  %6.1f%s ms %7d  %s\n", low, last ? "+" : " ", counts[i],
+               string(counts[i] * 50 / most, '#').c_str());
+    }
+    return 0;
+}
+
+// Frames around 60 Hz with occasional hitches.
+static float MakeFrameTime()
+{
+    float time = 16.7f + (rand() % 200 - 100) * 0.01f;
+    if (rand() % 50 == 0)
+        time += (float) (rand() % 40);
+    return time;
+}
+
+static float NearestRank(const vector<float>& sorted, int percent)
+{
+    int rank = (int) ceil(percent * sorted.size() / 100.0);
+    return sorted[max(rank, 1) - 1];
+}
+
+// Random captures of every length up to twice the capacity, with lots of
+// ties, each checked against the sorted ring.
+static int Verify()
+{
+    srand(1);
+    int failures = 0, trials = 0;
+    const int Capacities[] = { 1, 2, 3, 7, 64, 100, 128, 1000 };
+    for (size_t c = 0; c < sizeof(Capacities) / sizeof(Capacities[0]); ++c) {
+        int capacity = Capacities[c];
+        for (int frameCount = 1; frameCount <= capacity * 2; frameCount += 1 + frameCount / 8) {
+            FrameStats stats(capacity);
+            vector<float> times;
+            for (int i = 0; i < frameCount; ++i) {
+                float time = rand() % 3 ? MakeFrameTime() : (float) (rand() % 20);
+                stats.AddFrameMilliseconds(time);
+                times.push_back(time);
+            }
+
+            vector<float> recent(times.end() - min(frameCount, capacity), times.end());
+            bool ringOk = stats.GetCount() == (int) recent.size();
+            for (int age = 0; ringOk && age < stats.GetCount(); ++age)
+                ringOk = stats.GetFrame(age) == recent[recent.size() - 1 - age];
+
+            vector<float> sorted(recent);
+            sort(sorted.begin(), sorted.end());
+            double total = 0;
+            for (size_t i = 0; i < sorted.size(); ++i)
+                total += sorted[i];
+            FrameSummary summary;
+            stats.Summarize(summary);
+            bool ok = ringOk && summary.FrameCount == (int) sorted.size() &&
+                      summary.P50 == NearestRank(sorted, 50) &&
+                      summary.P95 == NearestRank(sorted, 95) &&
+                      summary.P99 == NearestRank(sorted, 99) &&
+                      summary.Worst == sorted.back() &&
+                      fabs(summary.Mean - total / sorted.size()) < 1e-3;
+            if (!ok) {
+                printf("Mismatch with capacity %d after %d frames.\n", capacity, frameCount);
+                ++failures;
+            }
+            ++trials;
+        }
+    }
+
+    FrameStats empty(8);
+    FrameSummary summary;
+    empty.Summarize(summary);
+    if (summary.FrameCount || summary.Fps || summary.Worst) {
+        printf("Mismatch with no frames.\n");
+        ++failures;
+    }
+
+    printf("%d of %d captures match\n", trials - failures, trials);
+    return failures ? 1 : 0;
+}
+
+// Each frame adds a time and summarizes the ring, as the overlays do.
+static int Bench()
+{
+    const int Capacity = 128;
+    const int FrameCount = 200000;
+    vector<float> times(FrameCount);
+    srand(1);
+    for (int i = 0; i < FrameCount; ++i)
+        times[i] = MakeFrameTime();
+
+    FrameStats stats(Capacity);
+    FrameSummary summary;
+    int counts[16];
+    int allocations = AllocationCount;
+    uint64_t start = GetMonotonicNanoseconds();
+    float worst = 0;
+    for (int i = 0; i < FrameCount; ++i) {
+        stats.AddFrame((uint64_t) (times[i] * 1e6f));
+        stats.Summarize(summary);
+        stats.Histogram(2, 16, counts);
+        worst = max(worst, summary.Worst);
+    }
+    uint64_t elapsed = GetMonotonicNanoseconds() - start;
+    allocations = AllocationCount - allocations;
+
+    printf("%d frames in a ring of %d: %.0f ns per frame, %d allocations\n", FrameCount,
+           Capacity, (double) elapsed / FrameCount, allocations);
+    printf("worst frame %.2f ms\n", worst);
+    return allocations ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+    ReportOptions options = ParseOptions(argc, argv);
+    if (options.Verify)
+        return Verify();
+    if (options.Bench)
+        return Bench();
+    return Report(options);
+}
@@ -0,0 +1,367 @@
+// GeodesicSphereCheck builds spheres and domes with GeodesicSphere.hpp and
+// prints, for each frequency, how many triangles and vertices they take and
+// how many bytes that is against drawing the same triangles unindexed,
+// five floats a vertex, the way Holodeck's old GeodesicDome.h did.  It then
+// moves a sphere towards the camera and back to show GeodesicLod's levels.
+// With -verify it checks the mesh: the sphere is closed and wound the same
+// way throughout, vertices are on the sphere and shared, every triangle
+// gets all three texture corners, domes stop at their height, and the
+// levels don't flicker.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o GeodesicSphereCheck GeodesicSphereCheck.cpp
+//
+// Usage:
+//
+//     GeodesicSphereCheck [options]
+//
+//     -f frequency  the finest frequency to report (default 32)
+//     -h height     cut the spheres off above this height (default 0.125)
+//     -e pixels     the longest edge on screen GeodesicLod allows (default 16)
+//     -verify       check the meshes and levels
+
+#include "../Classes/GeodesicSphere.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct CheckOptions {
+    CheckOptions() : Frequency(32), Height(0.125f), EdgePixels(16), Verify(false) {}
+    int Frequency;
+    float Height;
+    float EdgePixels;
+    bool Verify;
+};
+
+static void Usage()
+{
+    printf("Usage: GeodesicSphereCheck [options]\n"
+           "  -f frequency  the finest frequency to report\n"
+           "  -h height     cut the spheres off above this height\n"
+           "  -e pixels     the longest edge on screen GeodesicLod allows\n"
+           "  -verify       check the meshes and levels\n");
+    exit(1);
+}
+
+static CheckOptions ParseOptions(int argc, char** argv)
+{
+    CheckOptions options;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-f" && hasValue)
+            options.Frequency = atoi(argv[++i]);
+        else if (arg == "-h" && hasValue)
+            options.Height = atof(argv[++i]);
+        else if (arg == "-e" && hasValue)
+            options.EdgePixels = atof(argv[++i]);
+        else if (arg == "-verify")
+            options.Verify = true;
+        else
+            Usage();
+    }
+
+    if (options.Frequency < 1 || options.Frequency > 80 || options.EdgePixels <= 0)
+        Usage();
+    return options;
+}
+
+// Five floats a vertex and 16-bit indices, as Holodeck uploads them.
+static int GetIndexedBytes(const GeodesicSphere& sphere)
+{
+    return sphere.GetVertexCount() * 5 * sizeof(float) +
+           sphere.GetTriangleIndexCount() * sizeof(unsigned short);
+}
+
+static int GetUnindexedBytes(const GeodesicSphere& sphere)
+{
+    return sphere.GetTriangleIndexCount() * 5 * sizeof(float);
+}
+
+// Points a dome dropped don't count.
+static int CountUsedPoints(const GeodesicSphere& sphere)
+{
+    vector<bool> used(sphere.GetPointCount(), false);
+    int count = 0;
+    for (int i = 0; i < sphere.GetVertexCount(); ++i) {
+        count += !used[sphere.GetPoint(i)];
+        used[sphere.GetPoint(i)] = true;
+    }
+    return count;
+}
+
+static void ReportMeshes(const CheckOptions& options)
+{
+    printf("%9s %6s %9s %8s %8s %6s %9s %9s %6s\n", "", "freq", "triangles", "points",
+           "vertices", "seams", "indexed", "unindexed", "ratio");
+    for (int pass = 0; pass < 2; ++pass) {
+        float height = pass ? options.Height : 1;
+        for (int n = 1; n <= options.Frequency; n *= 2) {
+            GeodesicSphere sphere(n, height);
+            int triangles = sphere.GetTriangleIndexCount() / 3;
+            int points = CountUsedPoints(sphere);
+            printf("%9s %6d %9d %8d %8d %6d %8.1fK %8.1fK %5.1fx\n", pass ? "dome" : "sphere",
+                   n, triangles, points, sphere.GetVertexCount(),
+                   sphere.GetVertexCount() - points, GetIndexedBytes(sphere) / 1024.0f,
+                   GetUnindexedBytes(sphere) / 1024.0f,
+                   triangles * 3.0f / sphere.GetVertexCount());
+        }
+    }
+}
+
+// A sphere of unit radius coming from 200 units away to 2 and back, seen
+// through a 320 pixel wide viewport with Holodeck's projection.
+static float GetScreenRadius(int frame, int frameCount)
+{
+    float t = fabs(2.0f * frame / frameCount - 1);
+    float distance = 2 + 198 * t;
+    float focalLength = 320 * 5 / 4.0f;
+    return focalLength / distance;
+}
+
+static void ReportLevels(const CheckOptions& options)
+{
+    GeodesicLod lod(options.EdgePixels);
+    for (int n = 1; n <= options.Frequency; n *= 2)
+        lod.AddLevel(n);
+
+    printf("\nLevels for a sphere flying in and out, edges up to %.0f pixels:\n",
+           options.EdgePixels);
+    printf("%6s %8s %6s %9s %10s\n", "frame", "radius", "freq", "edge", "triangles");
+    const int FrameCount = 400;
+    int changes = 0, last = -1;
+    for (int frame = 0; frame <= FrameCount; ++frame) {
+        float radius = GetScreenRadius(frame, FrameCount);
+        int level = lod.Update(radius);
+        if (level == last)
+            continue;
+        int n = lod.GetFrequency(level);
+        printf("%6d %7.1fp %6d %8.1fp %10d\n", frame, radius, n,
+               lod.GetEdgePixels(level, radius), 20 * n * n);
+        changes += last >= 0;
+        last = level;
+    }
+    printf("%d level changes in %d frames\n", changes, FrameCount + 1);
+}
+
+static int Report(const CheckOptions& options)
+{
+    ReportMeshes(options);
+
+    GeodesicSphere dome(16, 0.125f);
+    const int OldVertexCount = 2782 * 3;
+    printf("\nHolodeck's dome, frequency 16: %d vertices and %d indices, against %d "
+           "unindexed vertices before (%.1fx fewer)\n", dome.GetVertexCount(),
+           dome.GetTriangleIndexCount(), OldVertexCount,
+           (float) OldVertexCount / dome.GetVertexCount());
+
+    ReportLevels(options);
+    return 0;
+}
+
+static void Cross(const float* a, const float* b, const float* c, float* result)
+{
+    float u[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+    float v[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+    result[0] = u[1] * v[2] - u[2] * v[1];
+    result[1] = u[2] * v[0] - u[0] * v[2];
+    result[2] = u[0] * v[1] - u[1] * v[0];
+}
+
+// Checks what holds for any sphere or dome, and for a whole sphere that
+// it's closed.  Returns false after printing the first problem.
+static bool CheckMesh(const GeodesicSphere& sphere, float height)
+{
+    int n = sphere.GetFrequency();
+    const vector<unsigned short>& indices = sphere.GetTriangleIndices();
+    int vertexCount = sphere.GetVertexCount();
+    bool whole = height >= 1;
+
+    for (int i = 0; i < vertexCount; ++i) {
+        const float* p = sphere.GetPosition(i);
+        float length = sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+        if (fabs(length - 1) > 1e-5f || p[1] > height) {
+            printf("Frequency %d: vertex %d is at (%f, %f, %f).\n", n, i, p[0], p[1], p[2]);
+            return false;
+        }
+    }
+
+    // Vertices at a point differ in their texture corner, or they'd be one.
+    map<pair<int, const float*>, int> corners;
+    for (int i = 0; i < vertexCount; ++i) {
+        pair<int, const float*> key(sphere.GetPoint(i), sphere.GetTexCoord(i));
+        if (corners.count(key)) {
+            printf("Frequency %d: vertices %d and %d are the same.\n", n, corners[key], i);
+            return false;
+        }
+        corners[key] = i;
+    }
+
+    map<pair<int, int>, int> edges;
+    for (size_t t = 0; t < indices.size(); t += 3) {
+        const float* p[3];
+        int points[3];
+        for (int c = 0; c < 3; ++c) {
+            if (indices[t + c] >= vertexCount) {
+                printf("Frequency %d: triangle %d is out of range.\n", n, (int) t / 3);
+                return false;
+            }
+            p[c] = sphere.GetPosition(indices[t + c]);
+            points[c] = sphere.GetPoint(indices[t + c]);
+        }
+        const float* s[3];
+        for (int c = 0; c < 3; ++c)
+            s[c] = sphere.GetTexCoord(indices[t + c]);
+        if (s[0] == s[1] || s[1] == s[2] || s[0] == s[2]) {
+            printf("Frequency %d: triangle %d repeats a texture corner.\n", n, (int) t / 3);
+            return false;
+        }
+        float normal[3];
+        Cross(p[0], p[1], p[2], normal);
+        float outward = (p[0][0] + p[1][0] + p[2][0]) * normal[0] +
+                        (p[0][1] + p[1][1] + p[2][1]) * normal[1] +
+                        (p[0][2] + p[1][2] + p[2][2]) * normal[2];
+        if (outward >= 0) {
+            printf("Frequency %d: triangle %d faces outwards or is flat.\n", n, (int) t / 3);
+            return false;
+        }
+
+        // Each edge goes one way in one triangle and the other way in the
+        // other.
+        for (int c = 0; c < 3; ++c) {
+            pair<int, int> edge(points[c], points[(c + 1) % 3]);
+            if (edges[edge]++) {
+                printf("Frequency %d: edge %d-%d is in two triangles the same way.\n", n,
+                       edge.first, edge.second);
+                return false;
+            }
+        }
+    }
+
+    int edgeCount = 0;
+    for (map<pair<int, int>, int>::iterator edge = edges.begin(); edge != edges.end(); ++edge) {
+        bool paired = edges.count(make_pair(edge->first.second, edge->first.first)) != 0;
+        if (whole && !paired) {
+            printf("Frequency %d: edge %d-%d is open.\n", n, edge->first.first,
+                   edge->first.second);
+            return false;
+        }
+        edgeCount += paired ? 1 : 2;
+    }
+    if (sphere.GetLineIndexCount() != edgeCount) {
+        printf("Frequency %d: %d line indices for %d edges.\n", n,
+               sphere.GetLineIndexCount(), edgeCount / 2);
+        return false;
+    }
+
+    if (whole && (sphere.GetTriangleIndexCount() != 60 * n * n ||
+                  sphere.GetPointCount() != 10 * n * n + 2)) {
+        printf("Frequency %d: %d triangles and %d points.\n", n,
+               sphere.GetTriangleIndexCount() / 3, sphere.GetPointCount());
+        return false;
+    }
+    return true;
+}
+
+static int Verify()
+{
+    int failures = 0;
+
+    // Whole spheres and domes at every frequency up to where 16-bit
+    // indices run out.
+    const float heights[] = { 1, 0.5f, 0.125f, 0, -0.75f };
+    for (int n = 1; n <= 48; ++n) {
+        for (int h = 0; h < 5; ++h) {
+            GeodesicSphere sphere(n, heights[h]);
+            if (!CheckMesh(sphere, heights[h])) {
+                ++failures;
+                break;
+            }
+        }
+    }
+
+    // Seams only add a few vertices.
+    for (int n = 4; n <= 48; n *= 2) {
+        GeodesicSphere sphere(n);
+        int points = CountUsedPoints(sphere);
+        if (sphere.GetVertexCount() > points + 12 * n) {
+            printf("Frequency %d: %d vertices for %d points.\n", n, sphere.GetVertexCount(),
+                   points);
+            ++failures;
+        }
+    }
+
+    // Holodeck's dome is the same size as before, with over five times
+    // fewer vertices.
+    {
+        GeodesicSphere dome(16, 0.125f);
+        int triangles = dome.GetTriangleIndexCount() / 3;
+        if (abs(triangles - 2782) > 2782 / 50 || dome.GetVertexCount() * 5 > 2782 * 3) {
+            printf("The dome has %d triangles and %d vertices.\n", triangles,
+                   dome.GetVertexCount());
+            ++failures;
+        }
+    }
+
+    // Levels keep edges under the limit whenever the finest level can,
+    // and go finer as the sphere grows on screen.
+    {
+        GeodesicLod lod(16);
+        for (int n = 1; n <= 32; n *= 2)
+            lod.AddLevel(n);
+        int last = 0;
+        for (float radius = 1; radius < 2000; radius *= 1.01f) {
+            int level = lod.Update(radius);
+            bool fine = lod.GetEdgePixels(level, radius) <= 16 || level == lod.GetLevelCount() - 1;
+            if (!fine || level < last) {
+                printf("A sphere %.1f pixels across went to level %d.\n", radius, level);
+                ++failures;
+                break;
+            }
+            last = level;
+        }
+
+        // A sphere that wobbles around a threshold changes level once.
+        GeodesicLod wobbling(16);
+        for (int n = 1; n <= 32; n *= 2)
+            wobbling.AddLevel(n);
+        float threshold = 16 / GeodesicSphere::GetEdgeAngle(4);
+        int changes = 0;
+        last = wobbling.Update(threshold * 0.98f);
+        for (int frame = 0; frame < 100; ++frame) {
+            int level = wobbling.Update(threshold * (frame % 2 ? 0.98f : 1.02f));
+            changes += level != last;
+            last = level;
+        }
+        if (changes != 1) {
+            printf("A wobbling sphere changed level %d times.\n", changes);
+            ++failures;
+        }
+
+        // But one that shrinks well under goes back to the coarser level.
+        if (wobbling.Update(threshold * 0.7f) != 2) {
+            printf("A shrinking sphere stayed at level %d.\n", wobbling.GetLevel());
+            ++failures;
+        }
+    }
+
+    if (failures)
+        printf("%d checks failed\n", failures);
+    else
+        printf("Every check passed\n");
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+    CheckOptions options = ParseOptions(argc, argv);
+    if (options.Verify)
+        return Verify();
+    return Report(options);
+}
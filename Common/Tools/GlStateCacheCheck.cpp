@@ -0,0 +1,536 @@
+// GlStateCacheCheck runs GlStateCache.hpp against a mock GL, which keeps
+// the state a real one would and counts the calls that reach it.  By
+// default it replays the state changes from the Haiku text renderer, the
+// Klein FPS counter and the GaussianBloom drawables, and reports how many
+// calls the cache eliminated.  With -verify it makes random calls instead,
+// and checks after each one that the mock ended up where it would have
+// without the cache.
+//
+// Build on Linux or Mac OS X, with the Mesa or ANGLE GLES headers, with:
+//
+//     g++ -O2 -o GlStateCacheCheck GlStateCacheCheck.cpp
+//
+// Usage:
+//
+//     GlStateCacheCheck [options]
+//
+//     -f frames     frames to replay (default 60)
+//     -verify       check random calls against the mock's state
+//     -n calls      random calls to make with -verify (default 200000)
+
+#include <GLES/gl.h>
+#include <GLES2/gl2.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+
+using namespace std;
+
+struct CheckOptions {
+    CheckOptions() : FrameCount(60), Verify(false), CallCount(200000) {}
+    int FrameCount;
+    bool Verify;
+    int CallCount;
+};
+
+static void Usage()
+{
+    printf("Usage: GlStateCacheCheck [options]\n"
+           "  -f frames     frames to replay\n"
+           "  -verify       check random calls against the mock's state\n"
+           "  -n calls      random calls to make with -verify\n");
+    exit(1);
+}
+
+static CheckOptions ParseOptions(int argc, char** argv)
+{
+    CheckOptions options;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-f" && hasValue)
+            options.FrameCount = atoi(argv[++i]);
+        else if (arg == "-verify")
+            options.Verify = true;
+        else if (arg == "-n" && hasValue)
+            options.CallCount = atoi(argv[++i]);
+        else
+            Usage();
+    }
+
+    if (options.FrameCount < 1 || options.CallCount < 1)
+        Usage();
+    return options;
+}
+
+// The state the cache shadows, kept the way GL keeps it.  Units and
+// attributes past these get accepted and ignored, which is enough to
+// notice the cache mistaking them for tracked ones.
+struct MockPointer {
+    MockPointer() :
+        Size(4), Type(GL_FLOAT), Normalized(0), Stride(0), Pointer(0), Buffer(0), Deletions(0) {}
+    bool operator==(const MockPointer& other) const
+    {
+        return Size == other.Size && Type == other.Type && Normalized == other.Normalized &&
+               Stride == other.Stride && Pointer == other.Pointer && Buffer == other.Buffer &&
+               Deletions == other.Deletions;
+    }
+    GLint Size;
+    GLenum Type;
+    GLboolean Normalized;
+    GLsizei Stride;
+    const GLvoid* Pointer;
+    GLuint Buffer;
+    int Deletions;
+};
+
+struct MockGl {
+    static const int Units = 4;
+    static const int Attribs = 8;
+    MockGl() :
+        ActiveTexture(0), ClientActiveTexture(0), ArrayBuffer(0), ElementBuffer(0),
+        BlendSource(GL_ONE), BlendDestination(GL_ZERO), Program(0)
+    {
+        memset(Textures, 0, sizeof(Textures));
+        memset(AttribArrays, 0, sizeof(AttribArrays));
+    }
+    bool operator==(const MockGl& other) const
+    {
+        bool same = ActiveTexture == other.ActiveTexture &&
+            ClientActiveTexture == other.ClientActiveTexture &&
+            ArrayBuffer == other.ArrayBuffer && ElementBuffer == other.ElementBuffer &&
+            BlendSource == other.BlendSource && BlendDestination == other.BlendDestination &&
+            Program == other.Program && Enables == other.Enables &&
+            Parameters == other.Parameters && Pointers == other.Pointers &&
+            !memcmp(Textures, other.Textures, sizeof(Textures)) &&
+            !memcmp(AttribArrays, other.AttribArrays, sizeof(AttribArrays));
+        for (int i = 0; i < Attribs; ++i)
+            same = same && AttribPointers[i] == other.AttribPointers[i];
+        return same;
+    }
+    static int TargetIndex(GLenum target) { return target == GL_TEXTURE_2D ? 0 : 1; }
+    void BindTexture(GLenum target, GLuint texture)
+    {
+        if (ActiveTexture < Units)
+            Textures[ActiveTexture][TargetIndex(target)] = texture;
+    }
+    void TexParameter(GLenum target, GLenum name, GLint value)
+    {
+        if (ActiveTexture < Units)
+            Parameters[make_pair(Textures[ActiveTexture][TargetIndex(target)], name)] = value;
+    }
+    void DeleteTexture(GLuint texture)
+    {
+        for (int unit = 0; unit < Units; ++unit)
+            for (int i = 0; i < 2; ++i)
+                if (Textures[unit][i] == texture)
+                    Textures[unit][i] = 0;
+        map<pair<GLuint, GLenum>, GLint>::iterator parameter = Parameters.begin();
+        while (parameter != Parameters.end())
+            if (parameter->first.first == texture)
+                Parameters.erase(parameter++);
+            else
+                ++parameter;
+    }
+    // Pointers hold on to a deleted buffer, not a new one with its name.
+    void DeleteBuffer(GLuint buffer)
+    {
+        ++Deletions[buffer];
+        if (ArrayBuffer == buffer)
+            ArrayBuffer = 0;
+        if (ElementBuffer == buffer)
+            ElementBuffer = 0;
+    }
+    // Client arrays and texturing are per unit, so the unit is in the key.
+    unsigned int UnitKey(GLenum cap, unsigned int unit) const { return cap + (unit << 16); }
+    void SetEnabled(GLenum cap, bool enabled)
+    {
+        Enables[cap == GL_TEXTURE_2D ? UnitKey(cap, ActiveTexture) : cap] = enabled;
+    }
+    void SetClientState(GLenum array, bool enabled)
+    {
+        unsigned int key = array;
+        if (array == GL_TEXTURE_COORD_ARRAY)
+            key = UnitKey(array, ClientActiveTexture);
+        Enables[key] = enabled;
+    }
+    void SetPointer(GLenum array, GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+    {
+        unsigned int key = array;
+        if (array == GL_TEXTURE_COORD_ARRAY)
+            key = UnitKey(array, ClientActiveTexture);
+        MockPointer& state = Pointers[key];
+        state.Size = size;
+        state.Type = type;
+        state.Stride = stride;
+        state.Pointer = pointer;
+        state.Buffer = ArrayBuffer;
+        state.Deletions = Deletions[ArrayBuffer];
+    }
+    void SetAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized,
+                          GLsizei stride, const GLvoid* pointer)
+    {
+        if (index >= (GLuint) Attribs)
+            return;
+        MockPointer& state = AttribPointers[index];
+        state.Size = size;
+        state.Type = type;
+        state.Normalized = normalized;
+        state.Stride = stride;
+        state.Pointer = pointer;
+        state.Buffer = ArrayBuffer;
+        state.Deletions = Deletions[ArrayBuffer];
+    }
+    unsigned int ActiveTexture;
+    unsigned int ClientActiveTexture;
+    GLuint Textures[Units][2];
+    GLuint ArrayBuffer;
+    GLuint ElementBuffer;
+    GLenum BlendSource;
+    GLenum BlendDestination;
+    GLuint Program;
+    bool AttribArrays[Attribs];
+    MockPointer AttribPointers[Attribs];
+    map<unsigned int, bool> Enables;
+    map<pair<GLuint, GLenum>, GLint> Parameters;
+    map<unsigned int, MockPointer> Pointers;
+    map<GLuint, int> Deletions;
+};
+
+// What reached the mock, and what would have without the cache.
+static MockGl Driver;
+static MockGl Expected;
+static int DriverCalls;
+
+static void ActiveTexture(MockGl& gl, GLenum unit) { gl.ActiveTexture = unit - GL_TEXTURE0; }
+static void ClientActiveTexture(MockGl& gl, GLenum unit) { gl.ClientActiveTexture = unit - GL_TEXTURE0; }
+static void BindBuffer(MockGl& gl, GLenum target, GLuint buffer)
+{
+    (target == GL_ARRAY_BUFFER ? gl.ArrayBuffer : gl.ElementBuffer) = buffer;
+}
+static void BlendFunc(MockGl& gl, GLenum source, GLenum destination)
+{
+    gl.BlendSource = source;
+    gl.BlendDestination = destination;
+}
+static void AttribArray(MockGl& gl, GLuint index, bool enabled)
+{
+    if (index < (GLuint) MockGl::Attribs)
+        gl.AttribArrays[index] = enabled;
+}
+
+extern "C" {
+
+void glActiveTexture(GLenum unit) { ++DriverCalls; ActiveTexture(Driver, unit); }
+void glClientActiveTexture(GLenum unit) { ++DriverCalls; ClientActiveTexture(Driver, unit); }
+void glBindTexture(GLenum target, GLuint texture) { ++DriverCalls; Driver.BindTexture(target, texture); }
+void glTexParameteri(GLenum target, GLenum name, GLint value)
+{
+    ++DriverCalls;
+    Driver.TexParameter(target, name, value);
+}
+void glDeleteTextures(GLsizei count, const GLuint* textures)
+{
+    ++DriverCalls;
+    for (GLsizei i = 0; i < count; ++i)
+        Driver.DeleteTexture(textures[i]);
+}
+void glBindBuffer(GLenum target, GLuint buffer) { ++DriverCalls; BindBuffer(Driver, target, buffer); }
+void glDeleteBuffers(GLsizei count, const GLuint* buffers)
+{
+    ++DriverCalls;
+    for (GLsizei i = 0; i < count; ++i)
+        Driver.DeleteBuffer(buffers[i]);
+}
+void glBlendFunc(GLenum source, GLenum destination) { ++DriverCalls; BlendFunc(Driver, source, destination); }
+void glEnable(GLenum cap) { ++DriverCalls; Driver.SetEnabled(cap, true); }
+void glDisable(GLenum cap) { ++DriverCalls; Driver.SetEnabled(cap, false); }
+void glEnableClientState(GLenum array) { ++DriverCalls; Driver.SetClientState(array, true); }
+void glDisableClientState(GLenum array) { ++DriverCalls; Driver.SetClientState(array, false); }
+void glVertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    ++DriverCalls;
+    Driver.SetPointer(GL_VERTEX_ARRAY, size, type, stride, pointer);
+}
+void glNormalPointer(GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    ++DriverCalls;
+    Driver.SetPointer(GL_NORMAL_ARRAY, 3, type, stride, pointer);
+}
+void glColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    ++DriverCalls;
+    Driver.SetPointer(GL_COLOR_ARRAY, size, type, stride, pointer);
+}
+void glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    ++DriverCalls;
+    Driver.SetPointer(GL_TEXTURE_COORD_ARRAY, size, type, stride, pointer);
+}
+void glUseProgram(GLuint program) { ++DriverCalls; Driver.Program = program; }
+void glEnableVertexAttribArray(GLuint index) { ++DriverCalls; AttribArray(Driver, index, true); }
+void glDisableVertexAttribArray(GLuint index) { ++DriverCalls; AttribArray(Driver, index, false); }
+void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized,
+                           GLsizei stride, const GLvoid* pointer)
+{
+    ++DriverCalls;
+    Driver.SetAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+}
+
+// Everything from here on calls GL through the cache.
+#include "../Classes/GlStateCache.hpp"
+
+static void Reset()
+{
+    Driver = MockGl();
+    Expected = MockGl();
+    DriverCalls = 0;
+    GlStateCache::Get().Reset();
+}
+
+static void PrintCounters(const char* scenario, int frameCount, int calls)
+{
+    const GlStateCache& cache = GlStateCache::Get();
+    printf("%s: %d calls over %d frames, %d reached GL, %d eliminated\n", scenario, calls,
+           frameCount, DriverCalls, cache.GetSkippedCount());
+    for (int i = 0; i < GlCachedCallCount; ++i) {
+        GlCachedCall call = (GlCachedCall) i;
+        int issued = cache.GetIssuedCount(call), skipped = cache.GetSkippedCount(call);
+        if (issued || skipped)
+            printf("    %-24s %8d %10d\n", GetGlCachedCallName(call), issued, skipped);
+    }
+}
+
+// The state changes from TextRenderer::RenderText in Haiku, for a few
+// strings a frame.
+static int ReplayText(int frameCount)
+{
+    const GLuint Texture = 1, IndexBuffer = 1, VertexBuffers[] = { 2, 3, 4 };
+    glBindTexture(GL_TEXTURE_2D, Texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    int calls = 3;
+    for (int frame = 0; frame < frameCount; ++frame) {
+        for (int text = 0; text < 3; ++text) {
+            glBindBuffer(GL_ARRAY_BUFFER, VertexBuffers[text]);
+            glBindTexture(GL_TEXTURE_2D, Texture);
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            glEnable(GL_TEXTURE_2D);
+            glDisableClientState(GL_NORMAL_ARRAY);
+            glVertexPointer(2, GL_FLOAT, 16, 0);
+            glTexCoordPointer(2, GL_FLOAT, 16, (GLvoid*) 8);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, IndexBuffer);
+            glEnableClientState(GL_NORMAL_ARRAY);
+            glDisable(GL_BLEND);
+            calls += 11;
+        }
+    }
+    return calls;
+}
+
+// The state changes from FpsRenderer::RenderFps in Klein.Fps.
+static int ReplayFps(int frameCount)
+{
+    const GLuint Texture = 1, Vbo = 1;
+    int calls = 0;
+    for (int frame = 0; frame < frameCount; ++frame) {
+        glBindBuffer(GL_ARRAY_BUFFER, Vbo);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glDisable(GL_DEPTH_TEST);
+        glDisableClientState(GL_NORMAL_ARRAY);
+        glDisable(GL_TEXTURE_2D);
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        glVertexPointer(2, GL_FLOAT, 8, (GLvoid*) 256);
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+        glEnable(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, Texture);
+        glVertexPointer(2, GL_FLOAT, 16, 0);
+        glTexCoordPointer(2, GL_FLOAT, 16, (GLvoid*) 8);
+        glEnableClientState(GL_NORMAL_ARRAY);
+        glDisable(GL_BLEND);
+        glEnable(GL_DEPTH_TEST);
+        calls += 16;
+    }
+    return calls;
+}
+
+// RenderDrawable in GaussianBloom: a surface and a few full-screen quads
+// that share one buffer, each rebinding everything it uses.
+static int ReplayDrawables(int frameCount)
+{
+    const GLuint Programs[] = { 1, 2, 2, 2, 3 }, Buffers[] = { 1, 2, 2, 2, 2 };
+    int calls = 0;
+    for (int frame = 0; frame < frameCount; ++frame) {
+        for (int pass = 0; pass < 5; ++pass) {
+            glUseProgram(Programs[pass]);
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, pass + 1);
+            glBindBuffer(GL_ARRAY_BUFFER, Buffers[pass]);
+            glEnableVertexAttribArray(0);
+            glEnableVertexAttribArray(1);
+            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 24, 0);
+            glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 24, (GLvoid*) 12);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, Buffers[pass] + 10);
+            glDisableVertexAttribArray(0);
+            glDisableVertexAttribArray(1);
+            calls += 11;
+        }
+    }
+    return calls;
+}
+
+static int Report(const CheckOptions& options)
+{
+    Reset();
+    PrintCounters("Haiku text", options.FrameCount, ReplayText(options.FrameCount));
+    Reset();
+    PrintCounters("Klein FPS counter", options.FrameCount, ReplayFps(options.FrameCount));
+    Reset();
+    PrintCounters("GaussianBloom drawables", options.FrameCount,
+                  ReplayDrawables(options.FrameCount));
+    return 0;
+}
+
+// Small ranges, so that most calls repeat state that's already set, and
+// units and attributes past what the cache tracks now and then.
+static GLenum RandomUnit() { return GL_TEXTURE0 + (rand() % 8 ? rand() % 3 : 9); }
+static GLenum RandomTarget() { return rand() % 4 ? GL_TEXTURE_2D : GL_TEXTURE_CUBE_MAP; }
+static GLuint RandomName() { return rand() % 4; }
+static GLuint RandomAttrib() { return rand() % 8 ? rand() % 3 : 20; }
+static const GLvoid* RandomOffset() { return (const GLvoid*) (size_t) (rand() % 2 * 12); }
+
+static GLenum RandomCap()
+{
+    const GLenum caps[] = { GL_BLEND, GL_DEPTH_TEST, GL_TEXTURE_2D, GL_CULL_FACE };
+    return caps[rand() % 4];
+}
+
+static GLenum RandomArray()
+{
+    const GLenum arrays[] = { GL_VERTEX_ARRAY, GL_NORMAL_ARRAY, GL_COLOR_ARRAY,
+                              GL_TEXTURE_COORD_ARRAY };
+    return arrays[rand() % 4];
+}
+
+// Makes one random call through the cache and the same change to the
+// expected state.
+static void RandomCall()
+{
+    GLenum a = 0, b = 0;
+    GLuint name = 0;
+    switch (rand() % 22) {
+        case 0: ActiveTexture(Expected, a = RandomUnit()); glActiveTexture(a); break;
+        case 1: ClientActiveTexture(Expected, a = RandomUnit()); glClientActiveTexture(a); break;
+        case 2:
+        case 3:
+            a = RandomTarget(), name = RandomName();
+            Expected.BindTexture(a, name);
+            glBindTexture(a, name);
+            break;
+        case 4: {
+            a = RandomTarget(), b = rand() % 2 ? GL_TEXTURE_MIN_FILTER : GL_TEXTURE_WRAP_S;
+            GLint value = rand() % 2 ? GL_NEAREST : GL_LINEAR;
+            Expected.TexParameter(a, b, value);
+            glTexParameteri(a, b, value);
+            break;
+        }
+        case 5:
+            name = RandomName();
+            Expected.DeleteTexture(name);
+            glDeleteTextures(1, &name);
+            break;
+        case 6:
+        case 7:
+            a = rand() % 3 ? GL_ARRAY_BUFFER : GL_ELEMENT_ARRAY_BUFFER, name = RandomName();
+            BindBuffer(Expected, a, name);
+            glBindBuffer(a, name);
+            break;
+        case 8:
+            name = RandomName();
+            Expected.DeleteBuffer(name);
+            glDeleteBuffers(1, &name);
+            break;
+        case 9:
+            a = rand() % 2 ? GL_SRC_ALPHA : GL_ONE, b = rand() % 2 ? GL_ONE : GL_ZERO;
+            BlendFunc(Expected, a, b);
+            glBlendFunc(a, b);
+            break;
+        case 10: Expected.SetEnabled(a = RandomCap(), true); glEnable(a); break;
+        case 11: Expected.SetEnabled(a = RandomCap(), false); glDisable(a); break;
+        case 12: Expected.SetClientState(a = RandomArray(), true); glEnableClientState(a); break;
+        case 13: Expected.SetClientState(a = RandomArray(), false); glDisableClientState(a); break;
+        case 14: {
+            GLint size = 2 + rand() % 2;
+            const GLvoid* pointer = RandomOffset();
+            switch (a = RandomArray()) {
+                case GL_VERTEX_ARRAY: glVertexPointer(size, GL_FLOAT, 24, pointer); break;
+                case GL_NORMAL_ARRAY: glNormalPointer(GL_FLOAT, 24, pointer); size = 3; break;
+                case GL_COLOR_ARRAY: glColorPointer(size, GL_FLOAT, 24, pointer); break;
+                default: glTexCoordPointer(size, GL_FLOAT, 24, pointer); break;
+            }
+            Expected.SetPointer(a, size, GL_FLOAT, 24, pointer);
+            break;
+        }
+        case 15: Expected.Program = name = RandomName(); glUseProgram(name); break;
+        case 16: AttribArray(Expected, name = RandomAttrib(), true); glEnableVertexAttribArray(name); break;
+        case 17: AttribArray(Expected, name = RandomAttrib(), false); glDisableVertexAttribArray(name); break;
+        case 18:
+        case 19: {
+            GLint size = 2 + rand() % 2;
+            const GLvoid* pointer = RandomOffset();
+            name = RandomAttrib();
+            Expected.SetAttribPointer(name, size, GL_FLOAT, GL_FALSE, 24, pointer);
+            glVertexAttribPointer(name, size, GL_FLOAT, GL_FALSE, 24, pointer);
+            break;
+        }
+        case 20:
+            // Something that goes around the cache, and then says so.
+            name = RandomName();
+            Expected.BindTexture(GL_TEXTURE_2D, name);
+            Driver.BindTexture(GL_TEXTURE_2D, name);
+            BlendFunc(Expected, GL_ONE, GL_ONE);
+            BlendFunc(Driver, GL_ONE, GL_ONE);
+            GlStateCache::Get().Invalidate();
+            break;
+        default:
+            // Nothing, so that runs of repeated state stay long.
+            break;
+    }
+}
+
+static int Verify(const CheckOptions& options)
+{
+    srand(1);
+    Reset();
+    int mismatch = -1;
+    for (int i = 0; i < options.CallCount && mismatch < 0; ++i) {
+        RandomCall();
+        if (!(Driver == Expected))
+            mismatch = i;
+    }
+
+    const GlStateCache& cache = GlStateCache::Get();
+    printf("%d random calls, %d reached GL, %d eliminated\n", options.CallCount,
+           DriverCalls, cache.GetSkippedCount());
+    if (mismatch >= 0) {
+        printf("The state differs after call %d.\n", mismatch);
+        return 1;
+    }
+    printf("The state matched after every call\n");
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    CheckOptions options = ParseOptions(argc, argv);
+    if (options.Verify)
+        return Verify(options);
+    return Report(options);
+}
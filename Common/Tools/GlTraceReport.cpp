@@ -0,0 +1,242 @@
+// GlTraceReport replays a trace recorded with GlTraceHooks.hpp through
+// GlTraceAnalyzer, which needs no GL, and reports what each frame asked of
+// the driver: calls, draws, binds, state changes that changed nothing, and
+// bytes uploaded.  Comparing reports from before and after a change shows
+// whether it added CPU-side driver work.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o GlTraceReport GlTraceReport.cpp
+//
+// Usage:
+//
+//     GlTraceReport [options] frames.gltrace
+//
+//     -q            leave out the line for each frame
+//     -verify       write random commands and check they read back the same
+//
+// To record a trace, define ENABLE_GL_TRACE, include GlTraceHooks.hpp
+// after the GL headers in the rendering engine, and call GL_TRACE_FRAME()
+// after presenting each frame.  The trace lands in the application's tmp
+// folder once GL_TRACE_FRAMES frames have been drawn.
+
+#include "../Classes/GlTrace.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct ReportOptions {
+    ReportOptions() : Quiet(false), Verify(false) {}
+    string Trace;
+    bool Quiet;
+    bool Verify;
+};
+
+static void Usage()
+{
+    printf("Usage: GlTraceReport [options] frames.gltrace\n"
+           "  -q            leave out the line for each frame\n"
+           "  -verify       check that random commands read back the same\n");
+    exit(1);
+}
+
+static ReportOptions ParseOptions(int argc, char** argv)
+{
+    ReportOptions options;
+    vector<string> files;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "-q")
+            options.Quiet = true;
+        else if (arg == "-verify")
+            options.Verify = true;
+        else if (arg[0] == '-')
+            Usage();
+        else
+            files.push_back(arg);
+    }
+
+    if (files.size() != (options.Verify ? 0 : 1))
+        Usage();
+    if (!files.empty())
+        options.Trace = files[0];
+    return options;
+}
+
+static bool ReadFile(const string& path, vector<unsigned char>& contents)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    contents.resize(size > 0 ? size : 0);
+    bool ok = size > 0 && fread(&contents[0], 1, size, file) == (size_t) size;
+    fclose(file);
+    return ok;
+}
+
+static void PrintFrame(const char* label, const GlTraceFrameStats& frame)
+{
+    printf("%-8s %6d %6d %8d %6d %6d %6d %6d %10lld\n", label, frame.Calls, frame.DrawCalls,
+           frame.Indices, frame.Binds, frame.StateChanges, frame.Redundant, frame.UploadCalls,
+           (long long) frame.BytesUploaded);
+}
+
+struct OpCount {
+    OpCount(GlTraceOp op, int calls, int redundant) : Op(op), Calls(calls), Redundant(redundant) {}
+    bool operator<(const OpCount& other) const
+    {
+        return Redundant != other.Redundant ? Redundant > other.Redundant : Calls > other.Calls;
+    }
+    GlTraceOp Op;
+    int Calls;
+    int Redundant;
+};
+
+static int Report(const ReportOptions& options)
+{
+    vector<unsigned char> trace;
+    if (!ReadFile(options.Trace, trace)) {
+        printf("Unable to read %s.\n", options.Trace.c_str());
+        return 1;
+    }
+
+    GlTraceAnalyzer analyzer;
+    int frameCount = ReplayGlTrace(trace, analyzer);
+    if (frameCount < 0)
+        printf("%s is malformed; reporting what could be read.\n", options.Trace.c_str());
+
+    // The last entry is whatever came after the last frame ended, and the
+    // first includes loading, so the mean leaves both out.
+    const vector<GlTraceFrameStats>& frames = analyzer.GetFrames();
+    int frameEnd = (int) frames.size() - 1;
+    printf("%d frames, %d bytes; the first includes loading\n\n", frameEnd, (int) trace.size());
+    printf("%-8s %6s %6s %8s %6s %6s %6s %6s %10s\n", "frame", "calls", "draws", "indices",
+           "binds", "state", "redund", "upload", "bytes");
+
+    GlTraceFrameStats total;
+    for (int i = 0; i < frameEnd; ++i) {
+        const GlTraceFrameStats& frame = frames[i];
+        if (!options.Quiet || i == 0) {
+            char label[16];
+            sprintf(label, "%d", i + 1);
+            PrintFrame(label, frame);
+        }
+        if (i == 0)
+            continue;
+        total.Calls += frame.Calls;
+        total.DrawCalls += frame.DrawCalls;
+        total.Indices += frame.Indices;
+        total.Binds += frame.Binds;
+        total.StateChanges += frame.StateChanges;
+        total.Redundant += frame.Redundant;
+        total.UploadCalls += frame.UploadCalls;
+        total.BytesUploaded += frame.BytesUploaded;
+    }
+
+    int n = frameEnd - 1;
+    if (n > 0) {
+        GlTraceFrameStats mean;
+        mean.Calls = total.Calls / n;
+        mean.DrawCalls = total.DrawCalls / n;
+        mean.Indices = total.Indices / n;
+        mean.Binds = total.Binds / n;
+        mean.StateChanges = total.StateChanges / n;
+        mean.Redundant = total.Redundant / n;
+        mean.UploadCalls = total.UploadCalls / n;
+        mean.BytesUploaded = total.BytesUploaded / n;
+        PrintFrame("mean", mean);
+    }
+
+    vector<OpCount> ops;
+    for (int op = 0; op < GlTraceOpEndFrame; ++op) {
+        GlTraceOp traceOp = (GlTraceOp) op;
+        if (analyzer.GetCallCount(traceOp))
+            ops.push_back(OpCount(traceOp, analyzer.GetCallCount(traceOp),
+                                  analyzer.GetRedundantCount(traceOp)));
+    }
+    sort(ops.begin(), ops.end());
+    printf("\n%-28s %8s %10s\n", "call", "count", "redundant");
+    for (size_t i = 0; i < ops.size(); ++i)
+        printf("%-28s %8d %10d\n", GetGlTraceSignature(ops[i].Op).Name, ops[i].Calls,
+               ops[i].Redundant);
+    return frameCount < 0 ? 1 : 0;
+}
+
+static bool SameCommand(const GlTraceCommand& a, const GlTraceCommand& b)
+{
+    if (a.Op != b.Op || a.IntCount != b.IntCount || a.FloatCount != b.FloatCount ||
+        a.PayloadSize != b.PayloadSize || !a.Payload != !b.Payload)
+        return false;
+    for (int i = 0; i < a.IntCount; ++i)
+        if (a.Ints[i] != b.Ints[i])
+            return false;
+    for (int i = 0; i < a.FloatCount; ++i)
+        if (memcmp(&a.Floats[i], &b.Floats[i], sizeof(float)))
+            return false;
+    return !a.PayloadSize || !memcmp(a.Payload, b.Payload, a.PayloadSize);
+}
+
+// Every op with extreme and random arguments, null and empty payloads.
+// Then the trace gets cut short at many lengths, where whatever can still
+// be read must match; run it under a memory checker to catch overreads.
+static int Verify()
+{
+    srand(1);
+    const int64_t Extremes[] = { 0, -1, 1, 63, -64, 64, 0x7fffffffLL, -0x80000000LL,
+                                 0x7fffffffffffffffLL, -0x7fffffffffffffffLL - 1 };
+    vector<unsigned char> payloads(4096);
+    for (size_t i = 0; i < payloads.size(); ++i)
+        payloads[i] = (unsigned char) rand();
+
+    GlTraceWriter writer;
+    vector<GlTraceCommand> commands;
+    for (int i = 0; i < 2000; ++i) {
+        GlTraceCommand command((GlTraceOp) (i % GlTraceOpCount));
+        const GlTraceSignature& signature = GetGlTraceSignature(command.Op);
+        for (int j = 0; j < signature.IntCount; ++j)
+            command.Int(rand() % 2 ? Extremes[rand() % 10] : rand() - RAND_MAX / 2);
+        for (int j = 0; j < signature.FloatCount; ++j)
+            command.Float((rand() - RAND_MAX / 2) * 0.001f);
+        if (signature.HasPayload && rand() % 4)
+            command.Data(&payloads[rand() % 1024], rand() % 3 ? rand() % 3000 : 0);
+        writer.Write(command);
+        commands.push_back(command);
+    }
+
+    vector<unsigned char> bytes = writer.GetBytes();
+    GlTraceReader reader(bytes);
+    GlTraceCommand command;
+    size_t matched = 0;
+    while (matched < commands.size() && reader.Next(command) &&
+           SameCommand(command, commands[matched]))
+        ++matched;
+    bool ok = matched == commands.size() && !reader.Next(command) && !reader.HasError();
+    printf("%d of %d commands read back the same\n", (int) matched, (int) commands.size());
+
+    int truncatedFailures = 0;
+    for (size_t size = 0; size < bytes.size(); size += 1 + size / 64) {
+        vector<unsigned char> truncated(bytes.begin(), bytes.begin() + size);
+        GlTraceReader prefix(truncated);
+        size_t count = 0;
+        while (prefix.Next(command))
+            if (!SameCommand(command, commands[count++]))
+                ++truncatedFailures;
+    }
+    printf("%s in traces cut short\n", truncatedFailures ? "Mismatches" : "No mismatches");
+    return ok && !truncatedFailures ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+    ReportOptions options = ParseOptions(argc, argv);
+    if (options.Verify)
+        return Verify();
+    return Report(options);
+}
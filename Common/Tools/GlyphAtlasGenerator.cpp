@@ -0,0 +1,338 @@
+// GlyphAtlasGenerator lays out lines of text from a TrueType or OpenType
+// font and writes them as a multi-channel distance field (MsdfGenerator.hpp)
+// for the median mode of the DistanceField sample's shader.  Corners stay
+// sharp, so a label atlas needs about a quarter of the texels of the
+// rasterized text that GenerateText.py used to produce.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o GlyphAtlasGenerator GlyphAtlasGenerator.cpp -lpng -lpthread
+//         `pkg-config --cflags --libs freetype2`
+//
+// Usage:
+//
+//     GlyphAtlasGenerator [options] font.ttf output.png|output.pvr|output.h
+//
+//     -s WxH        atlas size in texels (default 128x64)
+//     -l text@y     a line of text centered horizontally, with its ink centered
+//                   y texels from the top (repeat for each line)
+//     -p size       font size in texels per em (default 12)
+//     -r range      texels from the edge to full black or white (default 2)
+//     -a angle      corners sharper than this many degrees get split channels
+//                   (default 170)
+//     -mono         write the single-channel field instead, as I8
+//     -noflip       keep rows top-down in PVR output
+//     -n name       array name for C headers (default: the output's base name)
+//     -j threads    threads (default: one per processor)
+//
+// Output is RGBA8888, with the multi-channel distance in RGB and the true
+// distance in alpha, inside below 128 and outside above.
+
+#include "../Classes/MsdfGenerator.hpp"
+#include "../Classes/PvrWriter.hpp"
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_OUTLINE_H
+#include <png.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct TextLine {
+    string Text;
+    float Center;
+};
+
+struct AtlasOptions {
+    AtlasOptions() : Width(128), Height(64), FontSize(12), Range(2), Angle(170),
+                     Mono(false), Flip(true), Threads(GetProcessorCount()) {}
+    string Font;
+    string Output;
+    string Name;
+    vector<TextLine> Lines;
+    int Width;
+    int Height;
+    float FontSize;
+    float Range;
+    float Angle;
+    bool Mono;
+    bool Flip;
+    int Threads;
+};
+
+static void Usage()
+{
+    printf("Usage: GlyphAtlasGenerator [options] font.ttf output.png|output.pvr|output.h\n"
+           "  -s WxH      atlas size\n"
+           "  -l text@y   add a centered line of text\n"
+           "  -p size     font size in texels per em\n"
+           "  -r range    texels from the edge to black or white\n"
+           "  -a angle    corner threshold in degrees\n"
+           "  -mono       single-channel field\n"
+           "  -noflip     keep rows top-down\n"
+           "  -n name     array name for C headers\n"
+           "  -j threads  thread count\n");
+    exit(1);
+}
+
+static AtlasOptions ParseOptions(int argc, char** argv)
+{
+    AtlasOptions options;
+    vector<string> files;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-s" && hasValue) {
+            if (sscanf(argv[++i], "%dx%d", &options.Width, &options.Height) != 2)
+                Usage();
+        } else if (arg == "-l" && hasValue) {
+            string value = argv[++i];
+            size_t at = value.rfind('@');
+            if (at == string::npos)
+                Usage();
+            TextLine line;
+            line.Text = value.substr(0, at);
+            line.Center = (float) atof(value.c_str() + at + 1);
+            options.Lines.push_back(line);
+        } else if (arg == "-p" && hasValue)
+            options.FontSize = (float) atof(argv[++i]);
+        else if (arg == "-r" && hasValue)
+            options.Range = (float) atof(argv[++i]);
+        else if (arg == "-a" && hasValue)
+            options.Angle = (float) atof(argv[++i]);
+        else if (arg == "-mono")
+            options.Mono = true;
+        else if (arg == "-noflip")
+            options.Flip = false;
+        else if (arg == "-n" && hasValue)
+            options.Name = argv[++i];
+        else if (arg == "-j" && hasValue)
+            options.Threads = atoi(argv[++i]);
+        else if (arg[0] == '-')
+            Usage();
+        else
+            files.push_back(arg);
+    }
+
+    if (files.size() != 2 || options.Lines.empty() || options.Width < 1 ||
+        options.Height < 1 || options.FontSize <= 0 || options.Range <= 0)
+        Usage();
+    if (options.Threads < 1)
+        options.Threads = 1;
+
+    options.Font = files[0];
+    options.Output = files[1];
+    if (options.Name.empty()) {
+        string name = options.Output;
+        size_t slash = name.find_last_of("/\\");
+        if (slash != string::npos)
+            name = name.substr(slash + 1);
+        options.Name = name.substr(0, name.find('.'));
+    }
+    return options;
+}
+
+static bool EndsWith(const string& s, const string& suffix)
+{
+    return s.size() >= suffix.size() &&
+           s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Feeds FreeType's outline decomposition into an MsdfShape, mapping font
+// units onto the atlas.
+struct OutlineSink {
+    MsdfShape* Shape;
+    double Scale;
+    double X;
+    double Y;
+    MsdfVector Map(const FT_Vector* v) const
+    {
+        return MsdfVector(X + v->x * Scale, Y + v->y * Scale);
+    }
+};
+
+static int MoveTo(const FT_Vector* to, void* user)
+{
+    OutlineSink* sink = (OutlineSink*) user;
+    sink->Shape->MoveTo(sink->Map(to));
+    return 0;
+}
+
+static int LineTo(const FT_Vector* to, void* user)
+{
+    OutlineSink* sink = (OutlineSink*) user;
+    sink->Shape->LineTo(sink->Map(to));
+    return 0;
+}
+
+static int ConicTo(const FT_Vector* control, const FT_Vector* to, void* user)
+{
+    OutlineSink* sink = (OutlineSink*) user;
+    sink->Shape->QuadraticTo(sink->Map(control), sink->Map(to));
+    return 0;
+}
+
+static int CubicTo(const FT_Vector* control0, const FT_Vector* control1,
+                   const FT_Vector* to, void* user)
+{
+    OutlineSink* sink = (OutlineSink*) user;
+    sink->Shape->CubicTo(sink->Map(control0), sink->Map(control1), sink->Map(to));
+    return 0;
+}
+
+// Adds one line of text to the shape, with its ink box centered the way
+// GenerateText.py's text() centered it in cairo.
+static bool AddLine(FT_Face face, const AtlasOptions& options, const TextLine& line,
+                    MsdfShape& shape)
+{
+    double scale = options.FontSize / face->units_per_EM;
+
+    // First pass: pen positions and the ink box, in font units.
+    vector<FT_UInt> glyphs;
+    vector<long> pens;
+    long pen = 0;
+    FT_BBox ink = { 0, 0, 0, 0 };
+    bool empty = true;
+    for (size_t i = 0; i < line.Text.size(); ++i) {
+        FT_UInt glyph = FT_Get_Char_Index(face, (unsigned char) line.Text[i]);
+        if (!glyphs.empty() && FT_HAS_KERNING(face)) {
+            FT_Vector kerning;
+            FT_Get_Kerning(face, glyphs.back(), glyph, FT_KERNING_UNSCALED, &kerning);
+            pen += kerning.x;
+        }
+        if (FT_Load_Glyph(face, glyph, FT_LOAD_NO_SCALE)) {
+            printf("Unable to load the glyph for '%c'.\n", line.Text[i]);
+            return false;
+        }
+        FT_BBox box;
+        FT_Outline_Get_CBox(&face->glyph->outline, &box);
+        if (face->glyph->outline.n_points) {
+            if (empty) {
+                ink.xMin = pen + box.xMin;
+                ink.xMax = pen + box.xMax;
+                ink.yMin = box.yMin;
+                ink.yMax = box.yMax;
+                empty = false;
+            }
+            ink.xMin = min(ink.xMin, pen + box.xMin);
+            ink.xMax = max(ink.xMax, pen + box.xMax);
+            ink.yMin = min(ink.yMin, box.yMin);
+            ink.yMax = max(ink.yMax, box.yMax);
+        }
+        glyphs.push_back(glyph);
+        pens.push_back(pen);
+        pen += face->glyph->advance.x;
+    }
+
+    double x = options.Width / 2.0 - (ink.xMin + ink.xMax) / 2.0 * scale;
+    double y = options.Height - line.Center - (ink.yMin + ink.yMax) / 2.0 * scale;
+
+    FT_Outline_Funcs funcs;
+    funcs.move_to = MoveTo;
+    funcs.line_to = LineTo;
+    funcs.conic_to = ConicTo;
+    funcs.cubic_to = CubicTo;
+    funcs.shift = 0;
+    funcs.delta = 0;
+
+    for (size_t i = 0; i < glyphs.size(); ++i) {
+        FT_Load_Glyph(face, glyphs[i], FT_LOAD_NO_SCALE);
+        FT_Outline& outline = face->glyph->outline;
+        OutlineSink sink;
+        sink.Shape = &shape;
+        sink.Scale = scale;
+        sink.X = x + pens[i] * scale;
+        sink.Y = y;
+        int firstContour = shape.GetContourCount();
+        FT_Outline_Decompose(&outline, &funcs, &sink);
+
+        // TrueType outlines wind clockwise; MsdfShape wants counterclockwise.
+        if (FT_Outline_Get_Orientation(&outline) == FT_ORIENTATION_TRUETYPE)
+            shape.ReverseContours(firstContour);
+    }
+    return true;
+}
+
+static bool WritePng(const string& path, int width, int height, bool gray,
+                     const vector<unsigned char>& texels)
+{
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    image.width = width;
+    image.height = height;
+    image.format = gray ? PNG_FORMAT_GRAY : PNG_FORMAT_RGBA;
+    if (!png_image_write_to_file(&image, path.c_str(), 0, &texels[0], 0, 0)) {
+        printf("%s: %s\n", path.c_str(), image.message);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    AtlasOptions options = ParseOptions(argc, argv);
+
+    FT_Library library;
+    FT_Face face;
+    if (FT_Init_FreeType(&library) || FT_New_Face(library, options.Font.c_str(), 0, &face)) {
+        printf("Unable to load %s.\n", options.Font.c_str());
+        return 1;
+    }
+
+    MsdfShape shape;
+    for (size_t i = 0; i < options.Lines.size(); ++i)
+        if (!AddLine(face, options, options.Lines[i], shape))
+            return 1;
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+
+    shape.ColorEdges((180 - options.Angle) * 3.14159265358979 / 180);
+    vector<unsigned char> rgba;
+    MsdfGenerator generator(options.Threads);
+    generator.Generate(shape, options.Width, options.Height, options.Range, rgba);
+
+    int width = options.Width, height = options.Height;
+    int bytesPerTexel = 4;
+    PvrPixelType type = PvrPixelTypeRgba8888;
+    vector<unsigned char> texels(rgba);
+    if (options.Mono) {
+        bytesPerTexel = 1;
+        type = PvrPixelTypeI8;
+        texels.resize(width * height);
+        for (int i = 0; i < width * height; ++i)
+            texels[i] = rgba[i * 4 + 3];
+    }
+
+    bool written;
+    if (EndsWith(options.Output, ".pvr") || EndsWith(options.Output, ".h")) {
+        int pitch = width * bytesPerTexel;
+        vector<unsigned char> rows(texels);
+        if (options.Flip)
+            for (int y = 0; y < height; ++y)
+                memcpy(&rows[y * pitch], &texels[(height - 1 - y) * pitch], pitch);
+        PvrWriter writer(type, width, height);
+        writer.SetVerticallyFlipped(options.Flip);
+        writer.AddLevel(rows);
+        if (EndsWith(options.Output, ".h"))
+            written = writer.WriteSource(options.Output.c_str(), options.Name.c_str());
+        else
+            written = writer.WriteFile(options.Output.c_str());
+    } else {
+        written = WritePng(options.Output, width, height, options.Mono, texels);
+    }
+    if (!written) {
+        printf("Unable to write %s.\n", options.Output.c_str());
+        return 1;
+    }
+
+    int edgeCount = 0;
+    for (int c = 0; c < shape.GetContourCount(); ++c)
+        edgeCount += shape.GetContours()[c].Edges.size();
+    printf("%s: %dx%d, %d lines, %d contours, %d edges\n", options.Output.c_str(), width,
+           height, (int) options.Lines.size(), shape.GetContourCount(), edgeCount);
+    return 0;
+}
@@ -0,0 +1,290 @@
+// GlyphCacheBenchmark runs the glyph cache (GlyphCache.hpp) headless, with
+// FreeType standing in for the device's rasterizer, and reports hit rates
+// along with the separate costs of layout, rasterization, and uploads for a
+// given atlas size.  With -batch, pages go through TextBatch.hpp the way
+// Haiku draws them, and it also counts the draw calls and vertex uploads
+// against the glDrawTexfOES path's one crop and one draw per glyph.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o GlyphCacheBenchmark GlyphCacheBenchmark.cpp -lpng
+//         `pkg-config --cflags --libs freetype2`
+//
+// Usage:
+//
+//     GlyphCacheBenchmark [options] font.ttf [text.txt]
+//
+//     -s WxH        atlas size in texels (default 256x128, as in Haiku)
+//     -p size       font size in pixels (default 20)
+//     -l lines      lines of text per page (default 3)
+//     -f frames     frames each page stays on screen (default 60)
+//     -r repeats    passes through the whole text (default 4)
+//     -o atlas.png  write out the atlas as it stands at the end
+//     -batch        lay out through TextBatch, redoing layout only on change
+//
+// Pages are drawn in order, the way a reader flips through Haiku.  Without
+// a text file the pages are random words in Latin, Greek, and Cyrillic,
+// which is more than the default atlas holds at once.
+
+#include "../Classes/FreeTypeRasterizer.hpp"
+#include "../Classes/TextBatch.hpp"
+#include <png.h>
+#include <sys/time.h>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct BenchmarkOptions {
+    BenchmarkOptions() : Width(256), Height(128), FontSize(20), Lines(3), Frames(60),
+                         Repeats(4), Batch(false) {}
+    string Font;
+    string Text;
+    string Atlas;
+    int Width;
+    int Height;
+    int FontSize;
+    int Lines;
+    int Frames;
+    int Repeats;
+    bool Batch;
+};
+
+static void Usage()
+{
+    printf("Usage: GlyphCacheBenchmark [options] font.ttf [text.txt]\n"
+           "  -s WxH        atlas size\n"
+           "  -p size       font size in pixels\n"
+           "  -l lines      lines per page\n"
+           "  -f frames     frames per page\n"
+           "  -r repeats    passes through the text\n"
+           "  -o atlas.png  write out the atlas\n"
+           "  -batch        lay out through TextBatch\n");
+    exit(1);
+}
+
+static BenchmarkOptions ParseOptions(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    vector<string> files;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-s" && hasValue) {
+            if (sscanf(argv[++i], "%dx%d", &options.Width, &options.Height) != 2)
+                Usage();
+        } else if (arg == "-p" && hasValue)
+            options.FontSize = atoi(argv[++i]);
+        else if (arg == "-l" && hasValue)
+            options.Lines = atoi(argv[++i]);
+        else if (arg == "-f" && hasValue)
+            options.Frames = atoi(argv[++i]);
+        else if (arg == "-r" && hasValue)
+            options.Repeats = atoi(argv[++i]);
+        else if (arg == "-o" && hasValue)
+            options.Atlas = argv[++i];
+        else if (arg == "-batch")
+            options.Batch = true;
+        else if (arg[0] == '-')
+            Usage();
+        else
+            files.push_back(arg);
+    }
+
+    if (files.empty() || files.size() > 2 || options.Width < 1 || options.Height < 1 ||
+        options.FontSize < 1 || options.Lines < 1 || options.Frames < 1 ||
+        options.Repeats < 1)
+        Usage();
+    options.Font = files[0];
+    if (files.size() == 2)
+        options.Text = files[1];
+    return options;
+}
+
+static double GetSeconds()
+{
+    timeval now;
+    gettimeofday(&now, 0);
+    return now.tv_sec + now.tv_usec * 1e-6;
+}
+
+// Keeps a tally of the time spent in the real rasterizer, so that it can be
+// taken out of the layout time.
+class TimedRasterizer : public IGlyphRasterizer {
+public:
+    TimedRasterizer(IGlyphRasterizer* rasterizer) : m_rasterizer(rasterizer), m_seconds(0) {}
+    bool Rasterize(unsigned int codepoint, GlyphBitmap& bitmap)
+    {
+        double start = ::GetSeconds();
+        bool result = m_rasterizer->Rasterize(codepoint, bitmap);
+        m_seconds += ::GetSeconds() - start;
+        return result;
+    }
+    int GetLineHeight() const { return m_rasterizer->GetLineHeight(); }
+    double GetElapsed() const { return m_seconds; }
+private:
+    IGlyphRasterizer* m_rasterizer;
+    double m_seconds;
+};
+
+static void AppendUtf8(unsigned int codepoint, string& text)
+{
+    if (codepoint < 0x80) {
+        text += (char) codepoint;
+    } else if (codepoint < 0x800) {
+        text += (char) (0xc0 | (codepoint >> 6));
+        text += (char) (0x80 | (codepoint & 0x3f));
+    } else {
+        text += (char) (0xe0 | (codepoint >> 12));
+        text += (char) (0x80 | ((codepoint >> 6) & 0x3f));
+        text += (char) (0x80 | (codepoint & 0x3f));
+    }
+}
+
+// Each line sticks to one script; the letters are weighted toward the
+// start of the alphabet, roughly like real text.
+static void MakeText(int lineCount, vector<string>& lines)
+{
+    const unsigned int Alphabets[][2] = {
+        { 'a', 26 },
+        { 0xe0, 31 },   // Latin-1 accented letters
+        { 0x3b1, 25 },  // Greek
+        { 0x430, 32 },  // Cyrillic
+    };
+    srand(1);
+    for (int i = 0; i < lineCount; ++i) {
+        const unsigned int* alphabet = Alphabets[i % 4];
+        string line;
+        for (int word = 0; word < 4; ++word) {
+            if (word)
+                line += ' ';
+            int length = 2 + rand() % 6;
+            for (int letter = 0; letter < length; ++letter) {
+                int a = rand() % alphabet[1], b = rand() % alphabet[1];
+                AppendUtf8(alphabet[0] + min(a, b), line);
+            }
+        }
+        lines.push_back(line);
+    }
+}
+
+static bool WriteAtlas(const string& path, const GlyphCache& cache)
+{
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    image.width = cache.GetWidth();
+    image.height = cache.GetHeight();
+    image.format = PNG_FORMAT_GRAY;
+    if (!png_image_write_to_file(&image, path.c_str(), 0, cache.GetTexels(), 0, 0)) {
+        printf("%s: %s\n", path.c_str(), image.message);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options = ParseOptions(argc, argv);
+
+    FreeTypeRasterizer freeType(options.Font.c_str(), options.FontSize);
+    if (!freeType.IsValid()) {
+        printf("Unable to load %s.\n", options.Font.c_str());
+        return 1;
+    }
+
+    vector<string> lines;
+    if (options.Text.empty()) {
+        MakeText(120, lines);
+    } else {
+        ifstream file(options.Text.c_str());
+        string line;
+        while (getline(file, line))
+            if (!line.empty())
+                lines.push_back(line);
+        if (lines.empty()) {
+            printf("No text in %s.\n", options.Text.c_str());
+            return 1;
+        }
+    }
+
+    vector<string> pages;
+    for (size_t i = 0; i < lines.size(); i += options.Lines) {
+        string page;
+        for (size_t j = i; j < i + options.Lines && j < lines.size(); ++j)
+            page += (j > i ? "\n" : "") + lines[j];
+        pages.push_back(page);
+    }
+
+    TimedRasterizer rasterizer(&freeType);
+    GlyphCache cache(&rasterizer, options.Width, options.Height);
+    TextLayout textLayout(0);
+    TextBatch batch;
+    long long placed = 0, uploadedRows = 0, vertexBytes = 0;
+    int frames = 0, draws = 0, vertexUploads = 0;
+
+    double start = GetSeconds();
+    for (int repeat = 0; repeat < options.Repeats; ++repeat) {
+        for (size_t page = 0; page < pages.size(); ++page) {
+            for (int frame = 0; frame < options.Frames; ++frame) {
+                cache.BeginFrame();
+                int quadCount;
+                if (options.Batch) {
+                    if (batch.Update(cache, textLayout, pages[page], 0, 0)) {
+                        ++vertexUploads;
+                        vertexBytes += batch.GetVertices().size() * sizeof(float);
+                    }
+                    quadCount = batch.GetQuadCount();
+                    draws += quadCount ? 1 : 0;
+                } else {
+                    quadCount = (int) textLayout.Layout(cache, pages[page]).Glyphs.size();
+                    draws += quadCount;
+                }
+                placed += quadCount;
+                int first, count;
+                if (cache.GetDirtyRows(&first, &count))
+                    uploadedRows += count;
+                cache.ClearDirtyRows();
+                ++frames;
+            }
+        }
+    }
+    double total = GetSeconds() - start;
+    double rasterization = rasterizer.GetElapsed();
+    double layout = total - rasterization;
+
+    const GlyphCacheStats& stats = cache.GetStats();
+    printf("%dx%d atlas, %d px, %d pages x %d frames x %d passes\n", options.Width,
+           options.Height, options.FontSize, (int) pages.size(), options.Frames,
+           options.Repeats);
+    printf("Lookups        %d, %.2f%% hits, %d misses, %d evictions, %d failures\n",
+           stats.Hits + stats.Misses, stats.GetHitRate() * 100, stats.Misses,
+           stats.Evictions, stats.Failures);
+    printf("Layout         %.2f us/frame, %.1f ns/glyph\n", layout / frames * 1e6,
+           placed ? layout / placed * 1e9 : 0.0);
+    printf("Rasterization  %.2f us/miss, %.2f us/frame\n",
+           stats.Misses ? rasterization / stats.Misses * 1e6 : 0.0,
+           rasterization / frames * 1e6);
+    printf("Uploads        %.2f rows/frame, %.1f KB/frame\n",
+           (double) uploadedRows / frames,
+           (double) uploadedRows * options.Width / frames / 1024);
+    printf("Resident       %d glyphs\n", cache.GetGlyphCount());
+    if (options.Batch) {
+        printf("Draw calls     %.2f/frame, against %.1f for glDrawTexfOES\n",
+               (double) draws / frames, (double) placed / frames);
+        printf("GL calls       %.2f/frame, against %.1f\n",
+               (double) (draws + vertexUploads) / frames, 2.0 * placed / frames);
+        printf("Relayouts      %d of %d updates, %.1f KB of vertices uploaded\n",
+               batch.GetStats().Rebuilds, batch.GetStats().Updates, vertexBytes / 1024.0);
+    } else {
+        printf("Draw calls     %.1f/frame, plus as many crop rectangles\n",
+               (double) draws / frames);
+    }
+
+    if (!options.Atlas.empty() && !WriteAtlas(options.Atlas, cache))
+        return 1;
+    return 0;
+}
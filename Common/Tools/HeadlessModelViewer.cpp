@@ -0,0 +1,308 @@
+// HeadlessModelViewer runs the ModelViewer sample's parametric viewer on
+// SoftwareRasterizer.hpp instead of OpenGL, so that the rendering path can
+// be exercised without a device.  It prints the work that went into each
+// frame, writes the last one to a PNG, and can compare it with a golden
+// image, which makes it suitable for catching regressions on a build farm.
+// With -v it skips the viewer's buttons and renders a grid of spinning
+// visuals instead, which with -n shows what batching them saves.
+//
+// Build on Linux or Mac OS X with:
+//
+//     M=../../ModelViewer.VertexLighting/Classes
+//     g++ -O2 -o HeadlessModelViewer HeadlessModelViewer.cpp $M/ParametricSurface.cpp
+//         $M/ApplicationEngine.ParametricViewer.cpp $M/RenderingEngine.Software.cpp
+//         -lpng -lpthread
+//
+// Usage:
+//
+//     HeadlessModelViewer [options]
+//
+//     -s WxH         size of the screen (default 320x480)
+//     -t threads     threads to rasterize with (default 4)
+//     -f frames      frames to render, dragging the surface around (default 30)
+//     -o out.png     write the last frame
+//     -g golden.png  compare the last frame with a golden image
+//     -e tolerance   largest difference per channel that still matches (default 2)
+//     -p percent     share of pixels allowed to differ (default 0.1)
+//     -d diff.png    write the pixels that differ in red over the golden image
+//     -u             write the last frame over the golden image instead
+//     -v visuals     render a grid of this many visuals instead of the viewer
+//     -n             draw every visual on its own rather than batching them
+//
+// The exit code is nonzero if the frame doesn't match the golden image.
+// The finger drag is the same every run, so the frames are too.
+
+#include "../../ModelViewer.VertexLighting/Classes/Interfaces.hpp"
+#include "../Classes/MonotonicClock.hpp"
+#include "../Classes/SoftwareRasterizer.hpp"
+#include <png.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct HeadlessOptions {
+    HeadlessOptions() :
+        Width(320), Height(480), ThreadCount(4), FrameCount(30),
+        Tolerance(2), Percent(0.1f), Update(false), VisualCount(0), Batched(true) {}
+    int Width;
+    int Height;
+    int ThreadCount;
+    int FrameCount;
+    string Output;
+    string Golden;
+    string Diff;
+    int Tolerance;
+    float Percent;
+    bool Update;
+    int VisualCount;
+    bool Batched;
+};
+
+static void Usage()
+{
+    printf("Usage: HeadlessModelViewer [options]\n"
+           "  -s WxH         size of the screen\n"
+           "  -t threads     threads to rasterize with\n"
+           "  -f frames      frames to render\n"
+           "  -o out.png     write the last frame\n"
+           "  -g golden.png  compare the last frame with a golden image\n"
+           "  -e tolerance   largest difference per channel that still matches\n"
+           "  -p percent     share of pixels allowed to differ\n"
+           "  -d diff.png    write the pixels that differ\n"
+           "  -u             write the last frame over the golden image\n"
+           "  -v visuals     render a grid of this many visuals\n"
+           "  -n             draw every visual on its own\n");
+    exit(1);
+}
+
+static HeadlessOptions ParseOptions(int argc, char** argv)
+{
+    HeadlessOptions options;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-s" && hasValue) {
+            if (sscanf(argv[++i], "%dx%d", &options.Width, &options.Height) != 2)
+                Usage();
+        } else if (arg == "-t" && hasValue)
+            options.ThreadCount = atoi(argv[++i]);
+        else if (arg == "-f" && hasValue)
+            options.FrameCount = atoi(argv[++i]);
+        else if (arg == "-o" && hasValue)
+            options.Output = argv[++i];
+        else if (arg == "-g" && hasValue)
+            options.Golden = argv[++i];
+        else if (arg == "-e" && hasValue)
+            options.Tolerance = atoi(argv[++i]);
+        else if (arg == "-p" && hasValue)
+            options.Percent = (float) atof(argv[++i]);
+        else if (arg == "-d" && hasValue)
+            options.Diff = argv[++i];
+        else if (arg == "-u")
+            options.Update = true;
+        else if (arg == "-v" && hasValue)
+            options.VisualCount = atoi(argv[++i]);
+        else if (arg == "-n")
+            options.Batched = false;
+        else
+            Usage();
+    }
+
+    if (options.Width < 16 || options.Height < 16 || options.ThreadCount < 1 ||
+        options.FrameCount < 1 || options.Tolerance < 0 || options.Percent < 0 ||
+        options.VisualCount < 0 || options.VisualCount > options.Width * options.Height ||
+        (options.Update && options.Golden.empty()))
+        Usage();
+    return options;
+}
+
+static bool ReadPng(const string& path, int* width, int* height, vector<unsigned char>& rgba)
+{
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&image, path.c_str()))
+        return false;
+    image.format = PNG_FORMAT_RGBA;
+    rgba.resize(PNG_IMAGE_SIZE(image));
+    if (!png_image_finish_read(&image, 0, &rgba[0], 0, 0))
+        return false;
+    *width = image.width;
+    *height = image.height;
+    return true;
+}
+
+static bool WritePng(const string& path, int width, int height, const vector<unsigned char>& rgba)
+{
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    image.width = width;
+    image.height = height;
+    image.format = PNG_FORMAT_RGBA;
+    return png_image_write_to_file(&image, path.c_str(), 0, &rgba[0], 0, 0) != 0;
+}
+
+// The rasterizer keeps the bottom row first, and PNGs want the top.
+static vector<unsigned char> FlipRows(const SoftwareImage& image)
+{
+    int stride = image.Width * 4;
+    vector<unsigned char> rgba(image.Texels.size());
+    for (int y = 0; y < image.Height; ++y)
+        memcpy(&rgba[y * stride], &image.Texels[(image.Height - 1 - y) * stride], stride);
+    return rgba;
+}
+
+// Counts the pixels with any channel further off than the tolerance, and
+// marks them in red over a darkened copy of the golden image.
+static int Compare(const vector<unsigned char>& actual, const vector<unsigned char>& golden,
+                   int tolerance, vector<unsigned char>& diff)
+{
+    int differing = 0;
+    diff.resize(golden.size());
+    for (size_t i = 0; i < golden.size(); i += 4) {
+        bool differs = false;
+        for (int c = 0; c < 4; ++c)
+            differs |= abs(actual[i + c] - golden[i + c]) > tolerance;
+        if (differs)
+            ++differing;
+        int gray = (golden[i] + golden[i + 1] + golden[i + 2]) / 12;
+        diff[i] = differs ? 255 : gray;
+        diff[i + 1] = differs ? 0 : gray;
+        diff[i + 2] = differs ? 0 : gray;
+        diff[i + 3] = 255;
+    }
+    return differing;
+}
+
+// Lays the visuals out in a grid of tiles that are as square as the screen
+// allows, in a handful of colors, turned so that no two look the same.
+static vector<Visual> CreateGrid(int count, int width, int height)
+{
+    if (count == 0)
+        return vector<Visual>();
+
+    int columns = (int) std::ceil(std::sqrt((float) count * width / height));
+    int rows = (count + columns - 1) / columns;
+    ivec2 size(width / columns, height / rows);
+    const vec3 colors[] = {
+        vec3(1, 1, 0.5f), vec3(0.5f, 1, 1), vec3(1, 0.5f, 1), vec3(0.75f, 0.75f, 0.75f),
+    };
+
+    vector<Visual> visuals(count);
+    for (int i = 0; i < count; ++i) {
+        visuals[i].Color = colors[i % 4];
+        visuals[i].LowerLeft = ivec2((i % columns) * size.x, (i / columns) * size.y);
+        visuals[i].ViewportSize = size;
+    }
+    return visuals;
+}
+
+static void SpinGrid(vector<Visual>& visuals, float t)
+{
+    for (size_t i = 0; i < visuals.size(); ++i) {
+        vec3 axis = vec3(1, (float) (i % 7), (float) (i % 3)).Normalized();
+        visuals[i].Orientation = Quaternion::CreateFromAxisAngle(axis, t * 3.14159f + i);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    HeadlessOptions options = ParseOptions(argc, argv);
+    int width = options.Width, height = options.Height;
+
+    SoftwareRasterizer rasterizer(width, height, options.ThreadCount);
+    IRenderingEngine* renderingEngine = Software::CreateRenderingEngine(&rasterizer, options.Batched);
+    IApplicationEngine* applicationEngine = ParametricViewer::CreateApplicationEngine(renderingEngine);
+    applicationEngine->Initialize(width, height);
+    vector<Visual> grid = CreateGrid(options.VisualCount, width, height);
+
+    // Drags a finger in an arc around the middle of the screen, which is
+    // above the buttons, so the surface spins on two axes.
+    ivec2 center(width / 2, height / 2);
+    ivec2 previous = center;
+    applicationEngine->OnFingerDown(center);
+
+    double totalMs = 0;
+    for (int frame = 0; frame < options.FrameCount; ++frame) {
+        float t = (float) (frame + 1) / options.FrameCount;
+        ivec2 location(center.x + (int) (width * 0.3f * t),
+                       center.y + (int) (width * 0.2f * std::sin(t * 3.14159f)));
+        applicationEngine->OnFingerMove(previous, location);
+        previous = location;
+
+        rasterizer.ResetStats();
+        uint64_t start = GetMonotonicNanoseconds();
+        if (grid.empty()) {
+            applicationEngine->UpdateAnimation(1 / 60.0f);
+            applicationEngine->Render();
+        } else {
+            SpinGrid(grid, t);
+            renderingEngine->Render(grid);
+        }
+        double ms = (GetMonotonicNanoseconds() - start) * 1e-6;
+        totalMs += ms;
+
+        const SoftwareStats& stats = rasterizer.GetStats();
+        printf("frame %3d  %7.2f ms  %d draws  %d vertices  %d primitives  %d clipped  "
+               "%d culled  %d bins  %d fragments  %d written\n", frame, ms, stats.DrawCalls,
+               stats.Vertices, stats.Primitives, stats.Clipped, stats.Culled, stats.TileBins,
+               stats.Fragments, stats.FragmentsWritten);
+    }
+    applicationEngine->OnFingerUp(previous);
+    printf("%d frames at %dx%d on %d threads, %.2f ms per frame\n", options.FrameCount,
+           width, height, rasterizer.GetThreadCount(), totalMs / options.FrameCount);
+
+    vector<unsigned char> rgba = FlipRows(rasterizer.GetDefaultSurface().Color);
+    delete applicationEngine;
+
+    if (!options.Output.empty()) {
+        if (!WritePng(options.Output, width, height, rgba)) {
+            printf("Unable to write %s.\n", options.Output.c_str());
+            return 1;
+        }
+        printf("Wrote %s\n", options.Output.c_str());
+    }
+
+    if (options.Golden.empty())
+        return 0;
+
+    if (options.Update) {
+        if (!WritePng(options.Golden, width, height, rgba)) {
+            printf("Unable to write %s.\n", options.Golden.c_str());
+            return 1;
+        }
+        printf("Updated %s\n", options.Golden.c_str());
+        return 0;
+    }
+
+    int goldenWidth, goldenHeight;
+    vector<unsigned char> golden;
+    if (!ReadPng(options.Golden, &goldenWidth, &goldenHeight, golden)) {
+        printf("Unable to read %s.\n", options.Golden.c_str());
+        return 1;
+    }
+    if (goldenWidth != width || goldenHeight != height) {
+        printf("%s is %dx%d rather than %dx%d.\n", options.Golden.c_str(),
+               goldenWidth, goldenHeight, width, height);
+        return 1;
+    }
+
+    vector<unsigned char> diff;
+    int differing = Compare(rgba, golden, options.Tolerance, diff);
+    float percent = 100.0f * differing / (width * height);
+    bool matches = percent <= options.Percent;
+    printf("%d pixels (%.3f%%) differ by more than %d; %s\n", differing, percent,
+           options.Tolerance, matches ? "matches" : "MISMATCH");
+
+    if (!options.Diff.empty() && !WritePng(options.Diff, width, height, diff)) {
+        printf("Unable to write %s.\n", options.Diff.c_str());
+        return 1;
+    }
+    return matches ? 0 : 1;
+}
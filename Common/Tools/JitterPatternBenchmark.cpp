@@ -0,0 +1,338 @@
+// JitterPatternBenchmark measures how well each jitter pattern antialiases
+// edges as the sample count grows, so a renderer can use the fewest
+// samples that reach a target quality.  It crosses pixels with straight
+// edges at every angle and offset, and compares the fraction of each
+// pattern's offsets that land inside with the pixel's exact coverage.
+// Errors are root mean square over the pixels an edge crosses, in 8-bit
+// steps, which is what a hard black-to-white edge would show.
+//
+// The hand-typed tables from Trefoil.Jitter are measured alongside the
+// generated patterns.  With -verify it checks the generators and runs the
+// frame-time budget against a simulated GPU.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o JitterPatternBenchmark JitterPatternBenchmark.cpp
+//
+// Usage:
+//
+//     JitterPatternBenchmark [options]
+//
+//     -n count      largest sample count to measure (default 32)
+//     -e steps      target error, for the fewest samples that reach it (default 8)
+//     -l edges      edges to measure with (default 20000)
+//     -verify       check the generators and the budget
+
+#include "../Classes/JitterPattern.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct BenchmarkOptions {
+    BenchmarkOptions() : MaxCount(32), TargetError(8), EdgeCount(20000), Verify(false) {}
+    int MaxCount;
+    float TargetError;
+    int EdgeCount;
+    bool Verify;
+};
+
+static void Usage()
+{
+    printf("Usage: JitterPatternBenchmark [options]\n"
+           "  -n count      largest sample count to measure\n"
+           "  -e steps      target error in 8-bit steps\n"
+           "  -l edges      edges to measure with\n"
+           "  -verify       check the generators and the budget\n");
+    exit(1);
+}
+
+static BenchmarkOptions ParseOptions(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-n" && hasValue)
+            options.MaxCount = atoi(argv[++i]);
+        else if (arg == "-e" && hasValue)
+            options.TargetError = (float) atof(argv[++i]);
+        else if (arg == "-l" && hasValue)
+            options.EdgeCount = atoi(argv[++i]);
+        else if (arg == "-verify")
+            options.Verify = true;
+        else
+            Usage();
+    }
+
+    if (options.MaxCount < 1 || options.TargetError <= 0 || options.EdgeCount < 1)
+        Usage();
+    return options;
+}
+
+// Trefoil.Jitter's tables, before the generator replaced them.
+static const float Table2[2][2] = { { 0.25f, 0.75f }, { 0.75f, 0.25f } };
+static const float Table4[4][2] = {
+    { 0.375f, 0.25f }, { 0.125f, 0.75f }, { 0.875f, 0.25f }, { 0.625f, 0.75f },
+};
+static const float Table8[8][2] = {
+    { 0.5625f, 0.4375f }, { 0.0625f, 0.9375f }, { 0.3125f, 0.6875f }, { 0.6875f, 0.8125f },
+    { 0.8125f, 0.1875f }, { 0.9375f, 0.5625f }, { 0.4375f, 0.0625f }, { 0.1875f, 0.3125f },
+};
+static const float Table16[16][2] = {
+    { 0.375f, 0.4375f }, { 0.625f, 0.0625f }, { 0.875f, 0.1875f }, { 0.125f, 0.0625f },
+    { 0.375f, 0.6875f }, { 0.875f, 0.4375f }, { 0.625f, 0.5625f }, { 0.375f, 0.9375f },
+    { 0.625f, 0.3125f }, { 0.125f, 0.5625f }, { 0.125f, 0.8125f }, { 0.375f, 0.1875f },
+    { 0.875f, 0.9375f }, { 0.875f, 0.6875f }, { 0.125f, 0.3125f }, { 0.625f, 0.8125f },
+};
+
+static bool GetTable(int count, vector<JitterOffset>& offsets)
+{
+    const float (*table)[2] = count == 2 ? Table2 : count == 4 ? Table4 :
+                              count == 8 ? Table8 : count == 16 ? Table16 : 0;
+    if (!table)
+        return false;
+    offsets.resize(count);
+    for (int i = 0; i < count; ++i) {
+        offsets[i].X = table[i][0];
+        offsets[i].Y = table[i][1];
+    }
+    return true;
+}
+
+// The part of the unit square where Nx * x + Ny * y < D, by clipping the
+// square against the line.
+static double GetCoverage(double nx, double ny, double d)
+{
+    const double Corners[4][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } };
+    double polygon[8][2];
+    int count = 0;
+    for (int i = 0; i < 4; ++i) {
+        const double* a = Corners[i];
+        const double* b = Corners[(i + 1) % 4];
+        double da = nx * a[0] + ny * a[1] - d, db = nx * b[0] + ny * b[1] - d;
+        if (da < 0) {
+            polygon[count][0] = a[0];
+            polygon[count++][1] = a[1];
+        }
+        if ((da < 0) != (db < 0)) {
+            double t = da / (da - db);
+            polygon[count][0] = a[0] + t * (b[0] - a[0]);
+            polygon[count++][1] = a[1] + t * (b[1] - a[1]);
+        }
+    }
+    double area = 0;
+    for (int i = 0; i < count; ++i) {
+        const double* a = polygon[i];
+        const double* b = polygon[(i + 1) % count];
+        area += a[0] * b[1] - b[0] * a[1];
+    }
+    return fabs(area) / 2;
+}
+
+// Edges at evenly spread angles and offsets, the same for every pattern.
+// Only pixels the edge crosses count; the rest come out exact for any
+// pattern.
+static double MeasureEdgeError(const vector<JitterOffset>& offsets, int edgeCount)
+{
+    double sum = 0;
+    int pixels = 0;
+    for (int e = 0; e < edgeCount; ++e) {
+        double angle = 3.14159265358979 * 2 * (e + 0.5) / edgeCount;
+        double nx = cos(angle), ny = sin(angle);
+        double d = GetRadicalInverse(e + 1, 2) * (fabs(nx) + fabs(ny)) +
+                   (nx < 0 ? nx : 0) + (ny < 0 ? ny : 0);
+        double coverage = GetCoverage(nx, ny, d);
+        if (coverage <= 0 || coverage >= 1)
+            continue;
+        int inside = 0;
+        for (size_t i = 0; i < offsets.size(); ++i)
+            inside += nx * offsets[i].X + ny * offsets[i].Y < d;
+        double error = (double) inside / offsets.size() - coverage;
+        sum += error * error;
+        ++pixels;
+    }
+    return pixels ? 255 * sqrt(sum / pixels) : 0;
+}
+
+static const char* PatternNames[] = { "Halton", "R2", "Blue noise" };
+
+static int Report(const BenchmarkOptions& options)
+{
+    printf("RMS edge error in 8-bit steps, over %d edges\n\n", options.EdgeCount);
+    printf("  samples  tables  Halton  R2      Blue noise\n");
+    vector<int> fewest(3, 0);
+    for (int count = 1; count <= options.MaxCount; ++count) {
+        vector<JitterOffset> offsets;
+        printf("  %-8d", count);
+        if (GetTable(count, offsets))
+            printf(" %-7.2f", MeasureEdgeError(offsets, options.EdgeCount));
+        else
+            printf(" %-7s", "-");
+        for (int kind = 0; kind < 3; ++kind) {
+            GenerateJitterPattern((JitterPatternKind) kind, count, offsets);
+            double error = MeasureEdgeError(offsets, options.EdgeCount);
+            printf(" %-7.2f", error);
+            if (!fewest[kind] && error <= options.TargetError)
+                fewest[kind] = count;
+        }
+        printf("\n");
+    }
+
+    printf("\nFewest samples within %.1f steps:\n", options.TargetError);
+    for (int kind = 0; kind < 3; ++kind) {
+        if (fewest[kind])
+            printf("  %-11s %d\n", PatternNames[kind], fewest[kind]);
+        else
+            printf("  %-11s more than %d\n", PatternNames[kind], options.MaxCount);
+    }
+    return 0;
+}
+
+// A GPU that takes Overhead plus PerSample milliseconds a frame, give or
+// take a few percent.
+static float SimulateFrame(int sampleCount, float overhead, float perSample)
+{
+    float noise = 0.97f + 0.06f * rand() / RAND_MAX;
+    return (overhead + perSample * sampleCount) * noise;
+}
+
+static int Verify()
+{
+    int failures = 0;
+
+    // Known values, from the definitions.
+    vector<JitterOffset> offsets;
+    GenerateJitterPattern(JitterPatternHalton, 4, offsets);
+    const float Halton[4][2] = { { 0.5f, 1 / 3.0f }, { 0.25f, 2 / 3.0f },
+                                 { 0.75f, 1 / 9.0f }, { 0.125f, 4 / 9.0f } };
+    for (int i = 0; i < 4; ++i)
+        if (fabsf(offsets[i].X - Halton[i][0]) > 1e-6f || fabsf(offsets[i].Y - Halton[i][1]) > 1e-6f) {
+            printf("Halton offset %d is (%g, %g).\n", i, offsets[i].X, offsets[i].Y);
+            ++failures;
+        }
+    GenerateJitterPattern(JitterPatternR2, 2, offsets);
+    if (offsets[0].X != 0.5f || offsets[0].Y != 0.5f ||
+        fabsf(offsets[1].X - 0.254878f) > 1e-5f || fabsf(offsets[1].Y - 0.069840f) > 1e-5f) {
+        printf("R2 starts at (%g, %g), (%g, %g).\n", offsets[0].X, offsets[0].Y,
+               offsets[1].X, offsets[1].Y);
+        ++failures;
+    }
+
+    for (int kind = 0; kind < 3; ++kind) {
+        const char* name = PatternNames[kind];
+        vector<JitterOffset> longer, again;
+        GenerateJitterPattern((JitterPatternKind) kind, 64, longer);
+        GenerateJitterPattern((JitterPatternKind) kind, 64, again);
+        for (int count = 1; count <= 64; ++count) {
+            GenerateJitterPattern((JitterPatternKind) kind, count, offsets);
+            for (int i = 0; i < count; ++i) {
+                const JitterOffset& o = offsets[i];
+                if (o.X < 0 || o.X >= 1 || o.Y < 0 || o.Y >= 1) {
+                    printf("%s offset %d of %d is outside the pixel.\n", name, i, count);
+                    ++failures;
+                }
+                // Progressive, and the same every time.
+                if (o.X != longer[i].X || o.Y != longer[i].Y || o.X != again[i].X) {
+                    printf("%s's first %d offsets aren't a prefix of 64.\n", name, count);
+                    ++failures;
+                    break;
+                }
+            }
+        }
+
+        // No two offsets crowd each other: the closest pair is at least a
+        // third of what a perfect hexagonal packing would space them by.
+        for (int count = 2; count <= 64; count *= 2) {
+            float closest = 2;
+            for (int i = 0; i < count; ++i)
+                for (int j = 0; j < i; ++j) {
+                    float distance = GetJitterDistance2(longer[i], longer[j]);
+                    closest = distance < closest ? distance : closest;
+                }
+            float hexagonal = sqrtf(2 / (sqrtf(3) * count));
+            if (sqrtf(closest) < hexagonal / 3) {
+                printf("%s has offsets %.4f apart out of %d.\n", name, sqrtf(closest), count);
+                ++failures;
+            }
+        }
+
+        // Quadrupling the samples takes a good part off the edge error.
+        for (int count = 2; count <= 16; count *= 2) {
+            GenerateJitterPattern((JitterPatternKind) kind, count, offsets);
+            double error = MeasureEdgeError(offsets, 4000);
+            GenerateJitterPattern((JitterPatternKind) kind, count * 4, offsets);
+            double better = MeasureEdgeError(offsets, 4000);
+            if (better > error * 0.7) {
+                printf("%s's error goes from %.2f to %.2f for %dx the samples.\n", name,
+                       error, better, 4);
+                ++failures;
+            }
+        }
+    }
+
+    // The exact coverage agrees with counting a fine grid.
+    for (int e = 0; e < 50; ++e) {
+        double angle = e * 0.37, nx = cos(angle), ny = sin(angle), d = 0.2 + e * 0.01;
+        int inside = 0;
+        const int Grid = 400;
+        for (int y = 0; y < Grid; ++y)
+            for (int x = 0; x < Grid; ++x)
+                inside += nx * (x + 0.5) / Grid + ny * (y + 0.5) / Grid < d;
+        if (fabs(GetCoverage(nx, ny, d) - (double) inside / (Grid * Grid)) > 0.005) {
+            printf("The coverage of edge %d is off.\n", e);
+            ++failures;
+        }
+    }
+
+    // The budget settles within a sample of the most that fit, and stays
+    // there.  Each case is the GPU cost model and the budget.
+    struct BudgetCase { float Overhead, PerSample, Budget; };
+    const BudgetCase Cases[] = {
+        { 3, 1.5f, 14 },    // 7 samples take 13.5 ms
+        { 1, 0.5f, 14 },    // all 16 take 9 ms
+        { 4, 3.5f, 28 },    // 6 samples take 25 ms
+        { 20, 4, 14 },      // nothing fits; one sample
+        { 0.5f, 0.8f, 7 },  // 8 samples take 6.9 ms
+    };
+    srand(1);
+    for (int c = 0; c < 5; ++c) {
+        const BudgetCase& test = Cases[c];
+        for (int start = 1; start <= 16; start += 15) {
+            JitterBudget budget(test.Budget, 1, 16, start);
+            int changes = 0, previous = budget.GetSampleCount();
+            for (int frame = 0; frame < 3000; ++frame) {
+                int count = budget.GetSampleCount();
+                budget.AddFrame(SimulateFrame(count, test.Overhead, test.PerSample), count);
+                if (frame >= 1500 && budget.GetSampleCount() != previous)
+                    ++changes;
+                previous = budget.GetSampleCount();
+            }
+            int count = budget.GetSampleCount();
+            float busy = test.Overhead + test.PerSample * count;
+            bool fits = count == 1 || busy <= test.Budget * 1.1f;
+            bool full = count == 16 || test.Overhead + test.PerSample * (count + 2) > test.Budget;
+            if (!fits || !full || changes) {
+                printf("Budget case %d, starting at %d, ended at %d samples taking %.1f ms, "
+                       "and changed %d times late on.\n", c, start, count, busy, changes);
+                ++failures;
+            }
+        }
+    }
+
+    if (failures)
+        return 1;
+    printf("Every check passed\n");
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options = ParseOptions(argc, argv);
+    if (options.Verify)
+        return Verify();
+    return Report(options);
+}
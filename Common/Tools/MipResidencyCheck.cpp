@@ -0,0 +1,388 @@
+// MipResidencyCheck drives MipResidency.hpp through a fly-by of billboards,
+// each with its own PVRTC texture, without a GPU.  It prints how much video
+// memory and upload bandwidth the streamed textures take against loading
+// every level up front, how often a billboard in view was blurrier than
+// its size on screen called for, and each texture's residency at the end.
+// With -verify it checks the policy: textures start at their base chain,
+// stay within the memory cap and the upload budget, reach the level they
+// want when there's room, and give up levels in the right order.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o MipResidencyCheck MipResidencyCheck.cpp
+//
+// Usage:
+//
+//     MipResidencyCheck [options]
+//
+//     -t textures   billboards along the route (default 40)
+//     -f frames     frames to fly by them in (default 600)
+//     -c kilobytes  video memory cap (default 2048)
+//     -b kilobytes  upload budget per frame (default 256)
+//     -verify       check the residency policy
+
+#include "../Classes/MipResidency.hpp"
+#include "../Classes/PvrTexture.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct CheckOptions {
+    CheckOptions() :
+        TextureCount(40), FrameCount(600), CapKilobytes(2048), BudgetKilobytes(256),
+        Verify(false) {}
+    int TextureCount;
+    int FrameCount;
+    int CapKilobytes;
+    int BudgetKilobytes;
+    bool Verify;
+};
+
+static void Usage()
+{
+    printf("Usage: MipResidencyCheck [options]\n"
+           "  -t textures   billboards along the route\n"
+           "  -f frames     frames to fly by them in\n"
+           "  -c kilobytes  video memory cap\n"
+           "  -b kilobytes  upload budget per frame\n"
+           "  -verify       check the residency policy\n");
+    exit(1);
+}
+
+static CheckOptions ParseOptions(int argc, char** argv)
+{
+    CheckOptions options;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-t" && hasValue)
+            options.TextureCount = atoi(argv[++i]);
+        else if (arg == "-f" && hasValue)
+            options.FrameCount = atoi(argv[++i]);
+        else if (arg == "-c" && hasValue)
+            options.CapKilobytes = atoi(argv[++i]);
+        else if (arg == "-b" && hasValue)
+            options.BudgetKilobytes = atoi(argv[++i]);
+        else if (arg == "-verify")
+            options.Verify = true;
+        else
+            Usage();
+    }
+
+    if (options.TextureCount < 1 || options.FrameCount < 1 || options.CapKilobytes < 1 ||
+        options.BudgetKilobytes < 1)
+        Usage();
+    return options;
+}
+
+static vector<size_t> GetLevelSizes(PvrPixelType type, int size)
+{
+    vector<size_t> sizes;
+    for (int level = size; level; level >>= 1)
+        sizes.push_back(PvrTexture::ComputeLevelSize(type, level, level));
+    return sizes;
+}
+
+// Billboards eight units across stand on alternate sides of a straight
+// road, ten units apart, and the camera drives down it looking ahead.
+// Their textures run from 128 to 1024 square.
+struct Billboard {
+    int Texture;
+    float X;
+    float Z;
+};
+
+const float BillboardSize = 8;
+const float FocalLength = 400;      // a 320 pixel wide viewport, 90 degrees across
+const float ViewDistance = 150;
+
+static vector<Billboard> MakeRoute(MipResidency& residency, int count)
+{
+    vector<Billboard> route(count);
+    for (int i = 0; i < count; ++i) {
+        int size = 128 << (i * 7 % 4);
+        route[i].Texture = residency.AddTexture(size, size, GetLevelSizes(PvrPixelTypePvrtc4, size));
+        route[i].X = i % 2 ? 6.0f : -6.0f;
+        route[i].Z = 20 + i * 10.0f;
+    }
+    return route;
+}
+
+// Returns the screen size of a billboard at the camera's position, or 0 if
+// it's behind the camera, out of the frustum, or too far to draw.
+static float GetScreenSize(const Billboard& billboard, float cameraZ)
+{
+    float distance = billboard.Z - cameraZ;
+    if (distance < 1 || distance > ViewDistance || billboard.X * billboard.X > distance * distance)
+        return 0;
+    return MipResidency::EstimateScreenSize(BillboardSize, distance, FocalLength);
+}
+
+static void Drive(MipResidency& residency, const vector<Billboard>& route, float cameraZ)
+{
+    for (size_t i = 0; i < route.size(); ++i) {
+        float pixels = GetScreenSize(route[i], cameraZ);
+        if (pixels > 0)
+            residency.SetScreenSize(route[i].Texture, pixels);
+    }
+}
+
+static int Report(const CheckOptions& options)
+{
+    size_t cap = options.CapKilobytes * 1024;
+    size_t budget = options.BudgetKilobytes * 1024;
+    MipResidency residency(cap);
+    vector<Billboard> route = MakeRoute(residency, options.TextureCount);
+    size_t fullBytes = 0;
+    for (int i = 0; i < residency.GetTextureCount(); ++i)
+        fullBytes += residency.GetStats(i).FullBytes;
+    size_t baseBytes = residency.GetResidentBytes();
+
+    printf("%d PVRTC 4bpp billboards, %d frames, %d KB cap, %d KB a frame\n\n",
+           options.TextureCount, options.FrameCount, options.CapKilobytes,
+           options.BudgetKilobytes);
+    printf("  %6s %10s %10s %8s %8s\n", "frame", "resident", "uploaded", "in view", "blurry");
+
+    float routeLength = route.back().Z + 10;
+    size_t peakBytes = 0, totalUploaded = 0, peakUpload = 0;
+    int blurry = 0, inView = 0;
+    vector<MipChange> changes;
+    for (int frame = 0; frame < options.FrameCount; ++frame) {
+        float cameraZ = routeLength * frame / options.FrameCount;
+        Drive(residency, route, cameraZ);
+        residency.Update(budget, changes);
+
+        int frameBlurry = 0, frameInView = 0;
+        for (size_t i = 0; i < route.size(); ++i) {
+            if (GetScreenSize(route[i], cameraZ) <= 0)
+                continue;
+            const MipResidencyStats& stats = residency.GetStats(route[i].Texture);
+            ++frameInView;
+            frameBlurry += stats.ResidentLevel > stats.WantedLevel;
+        }
+        blurry += frameBlurry;
+        inView += frameInView;
+        peakBytes = max(peakBytes, residency.GetResidentBytes());
+        peakUpload = max(peakUpload, residency.GetUploadedBytes());
+        totalUploaded += residency.GetUploadedBytes();
+        if (frame % (options.FrameCount / 10 > 0 ? options.FrameCount / 10 : 1) == 0)
+            printf("  %6d %7.0f KB %7.1f KB %8d %8d\n", frame,
+                   residency.GetResidentBytes() / 1024.0, residency.GetUploadedBytes() / 1024.0,
+                   frameInView, frameBlurry);
+    }
+
+    printf("\n  %-34s %8.0f KB\n", "every level, loaded up front", fullBytes / 1024.0);
+    printf("  %-34s %8.0f KB\n", "base chains, the first frame", baseBytes / 1024.0);
+    printf("  %-34s %8.0f KB\n", "peak resident while streaming", peakBytes / 1024.0);
+    printf("  %-34s %8.1f KB\n", "uploaded per frame, mean",
+           totalUploaded / 1024.0 / options.FrameCount);
+    printf("  %-34s %8.1f KB\n", "uploaded per frame, most", peakUpload / 1024.0);
+    printf("  %-34s %8.1f %%\n", "billboards in view but blurry",
+           inView ? 100.0 * blurry / inView : 0.0);
+
+    printf("\n  %7s %5s %8s %6s %6s %10s %10s\n", "texture", "size", "resident", "wanted",
+           "base", "promotions", "evictions");
+    for (int i = 0; i < residency.GetTextureCount(); ++i) {
+        const MipResidencyStats& stats = residency.GetStats(i);
+        printf("  %7d %5d %8d %6d %6d %10d %10d\n", i, 128 << (i * 7 % 4), stats.ResidentLevel,
+               stats.WantedLevel, stats.BaseLevel, stats.Promotions, stats.Evictions);
+    }
+    return 0;
+}
+
+static int Verify()
+{
+    int failures = 0;
+    vector<MipChange> changes;
+
+    // A 1024 square texture starts at its 32x32 level, and wants the level
+    // with a texel for every pixel.
+    {
+        MipResidency residency(1 << 30);
+        int texture = residency.AddTexture(1024, 1024, GetLevelSizes(PvrPixelTypePvrtc4, 1024));
+        const MipResidencyStats& stats = residency.GetStats(texture);
+        if (stats.LevelCount != 11 || stats.BaseLevel != 5 || stats.ResidentLevel != 5 ||
+            residency.GetResidentBytes() != residency.GetChainBytes(texture, 5)) {
+            printf("A new texture didn't start at its base chain.\n");
+            ++failures;
+        }
+        const float pixels[] = { 5000, 1024, 1000, 512, 300, 100, 1, 0 };
+        const int levels[] = { 0, 0, 0, 1, 1, 3, 5, 5 };
+        for (int i = 0; i < 8; ++i) {
+            residency.SetScreenSize(texture, pixels[i]);
+            if (stats.WantedLevel != levels[i]) {
+                printf("%.0f pixels wanted level %d, not %d.\n", pixels[i], stats.WantedLevel,
+                       levels[i]);
+                ++failures;
+            }
+        }
+
+        // With room to spare it climbs one level a frame and stops there.
+        residency.SetScreenSize(texture, 300);
+        for (int frame = 0; frame < 10; ++frame) {
+            residency.SetScreenSize(texture, 300);
+            residency.Update(1 << 30, changes);
+            int expected = frame < 4 ? 4 - frame : 1;
+            if (stats.ResidentLevel != expected) {
+                printf("Frame %d left the texture at level %d, not %d.\n", frame,
+                       stats.ResidentLevel, expected);
+                ++failures;
+                break;
+            }
+            if ((frame < 4) != (changes.size() == 1)) {
+                printf("Frame %d made %d changes.\n", frame, (int) changes.size());
+                ++failures;
+                break;
+            }
+        }
+    }
+
+    // Two textures, room for one at full size: the one out of view gives
+    // its levels up, and one in view doesn't evict another in view.
+    {
+        vector<size_t> sizes = GetLevelSizes(PvrPixelTypePvrtc4, 512);
+        MipResidency probe(1 << 30);
+        probe.AddTexture(512, 512, sizes);
+        size_t full = probe.GetChainBytes(0, 0), base = probe.GetResidentBytes();
+        MipResidency residency(full + base);
+        int a = residency.AddTexture(512, 512, sizes);
+        int b = residency.AddTexture(512, 512, sizes);
+        for (int frame = 0; frame < 10; ++frame) {
+            residency.SetScreenSize(a, 512);
+            residency.Update(1 << 30, changes);
+        }
+        for (int frame = 0; frame < 10; ++frame) {
+            residency.SetScreenSize(a, 512);
+            residency.SetScreenSize(b, 512);
+            residency.Update(1 << 30, changes);
+        }
+        if (residency.GetStats(a).ResidentLevel != 0 || residency.GetStats(b).Evictions) {
+            printf("A texture in view was evicted for another in view.\n");
+            ++failures;
+        }
+        for (int frame = 0; frame < 10; ++frame) {
+            residency.SetScreenSize(b, 512);
+            residency.Update(1 << 30, changes);
+        }
+        if (residency.GetStats(b).ResidentLevel != 0 || residency.GetStats(a).ResidentLevel != 4 ||
+            residency.GetResidentBytes() > residency.GetMemoryCap()) {
+            printf("The texture out of view didn't make way.\n");
+            ++failures;
+        }
+
+        // Needing less frees the difference when something else needs it.
+        residency.SetMemoryCap(2 * full);
+        for (int frame = 0; frame < 10; ++frame) {
+            residency.SetScreenSize(a, 512);
+            residency.SetScreenSize(b, 512);
+            residency.Update(1 << 30, changes);
+        }
+        residency.SetMemoryCap(full + probe.GetChainBytes(0, 2));
+        for (int frame = 0; frame < 10; ++frame) {
+            residency.SetScreenSize(a, 512);
+            residency.SetScreenSize(b, 100);
+            residency.Update(1 << 30, changes);
+        }
+        if (residency.GetStats(a).ResidentLevel != 0 || residency.GetStats(b).ResidentLevel != 2) {
+            printf("A texture finer than it needed didn't give way (levels %d and %d).\n",
+                   residency.GetStats(a).ResidentLevel, residency.GetStats(b).ResidentLevel);
+            ++failures;
+        }
+    }
+
+    // Random fly-bys with random caps and budgets.  The cap holds after
+    // every frame, the budget holds unless one promotion alone is over it,
+    // nothing drops below its base, the stats add up, and with enough room
+    // everything in view ends up where it wants to be.
+    srand(1);
+    for (int run = 0; run < 300; ++run) {
+        MipResidency probe(1 << 30);
+        vector<Billboard> route = MakeRoute(probe, 1 + rand() % 40);
+        size_t bases = probe.GetResidentBytes(), full = 0;
+        for (int i = 0; i < probe.GetTextureCount(); ++i)
+            full += probe.GetStats(i).FullBytes;
+        bool ample = rand() % 4 == 0;
+        size_t cap = ample ? full : bases + rand() % (full - bases + 1);
+        size_t budget = 1024 + rand() % (512 * 1024);
+
+        MipResidency residency(cap);
+        MakeRoute(residency, route.size());
+        vector<int> levels(residency.GetTextureCount());
+        for (int i = 0; i < residency.GetTextureCount(); ++i)
+            levels[i] = residency.GetStats(i).ResidentLevel;
+
+        float routeLength = route.back().Z + 10;
+        int frameCount = ample ? 400 : 50 + rand() % 400;
+        bool ok = true;
+        for (int frame = 0; frame < frameCount && ok; ++frame) {
+            float cameraZ = ample ? 0 : routeLength * frame / frameCount;
+            if (rand() % 50 == 0 && !ample) {
+                cap = bases + rand() % (full - bases + 1);
+                residency.SetMemoryCap(cap);
+            }
+            Drive(residency, route, cameraZ);
+            residency.Update(budget, changes);
+
+            int promotions = 0;
+            size_t uploaded = 0, promoted = 0;
+            for (size_t i = 0; i < changes.size(); ++i) {
+                int texture = changes[i].Texture;
+                size_t bytes = residency.GetChainBytes(texture, changes[i].Level);
+                if (changes[i].Level < levels[texture]) {
+                    ++promotions;
+                    promoted += bytes;
+                }
+                levels[texture] = changes[i].Level;
+                uploaded += bytes;
+            }
+            size_t resident = 0;
+            for (int i = 0; i < residency.GetTextureCount(); ++i) {
+                const MipResidencyStats& stats = residency.GetStats(i);
+                resident += stats.ResidentBytes;
+                if (stats.ResidentLevel != levels[i] || stats.ResidentLevel > stats.BaseLevel ||
+                    stats.ResidentBytes != residency.GetChainBytes(i, stats.ResidentLevel))
+                    ok = false;
+            }
+            if (!ok)
+                printf("Run %d, frame %d: the changes don't match the stats.\n", run, frame);
+            else if (resident != residency.GetResidentBytes() || uploaded != residency.GetUploadedBytes())
+                printf("Run %d, frame %d: the totals don't add up.\n", run, frame), ok = false;
+            else if (resident > cap)
+                printf("Run %d, frame %d: %d bytes resident over a cap of %d.\n", run, frame,
+                       (int) resident, (int) cap), ok = false;
+            else if (promotions > 1 && promoted > budget)
+                printf("Run %d, frame %d: %d promotions took %d bytes against %d.\n", run, frame,
+                       promotions, (int) promoted, (int) budget), ok = false;
+        }
+        if (ok && ample) {
+            for (size_t i = 0; i < route.size(); ++i) {
+                const MipResidencyStats& stats = residency.GetStats(route[i].Texture);
+                if (GetScreenSize(route[i], 0) > 0 && stats.ResidentLevel != stats.WantedLevel) {
+                    printf("Run %d: with room for everything, texture %d stopped at level %d "
+                           "and wanted %d.\n", run, (int) i, stats.ResidentLevel,
+                           stats.WantedLevel);
+                    ok = false;
+                    break;
+                }
+            }
+        }
+        failures += !ok;
+    }
+
+    if (failures)
+        printf("%d checks failed\n", failures);
+    else
+        printf("Every check passed\n");
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+    CheckOptions options = ParseOptions(argc, argv);
+    if (options.Verify)
+        return Verify();
+    return Report(options);
+}
@@ -0,0 +1,197 @@
+// ProfilerBenchmark measures what a PROFILE_ZONE from Profiler.hpp costs,
+// on one thread and on several recording at once, against the same loop
+// without zones.  It can also write the zones it recorded as a Chrome trace.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o ProfilerBenchmark ProfilerBenchmark.cpp -lpthread
+//
+// Usage:
+//
+//     ProfilerBenchmark [options]
+//
+//     -n zones      zones per case (default 10000000)
+//     -t threads    threads for the threaded case (default 4)
+//     -o file.json  write the trace afterwards
+//
+// While the threaded case runs, the main thread keeps exporting the trace
+// to nowhere, which is the worst case for the rings.
+
+#define ENABLE_PROFILER
+#define PROFILER_TRACE_FRAMES 0
+#include "../Classes/Profiler.hpp"
+#include "../Classes/ParallelFor.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace std;
+
+struct BenchmarkOptions {
+    BenchmarkOptions() : ZoneCount(10000000), ThreadCount(4) {}
+    int ZoneCount;
+    int ThreadCount;
+    string Trace;
+};
+
+static void Usage()
+{
+    printf("Usage: ProfilerBenchmark [options]\n"
+           "  -n zones      zones per case\n"
+           "  -t threads    threads for the threaded case\n"
+           "  -o file.json  write the trace afterwards\n");
+    exit(1);
+}
+
+static BenchmarkOptions ParseOptions(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-n" && hasValue)
+            options.ZoneCount = atoi(argv[++i]);
+        else if (arg == "-t" && hasValue)
+            options.ThreadCount = atoi(argv[++i]);
+        else if (arg == "-o" && hasValue)
+            options.Trace = argv[++i];
+        else
+            Usage();
+    }
+
+    if (options.ZoneCount < 1 || options.ThreadCount < 1)
+        Usage();
+    return options;
+}
+
+// A little work for each zone to wrap, kept where the optimizer can't
+// throw it away.  Each thread has its own sink, so they don't contend.
+static void Work(volatile unsigned int& sink, unsigned int i)
+{
+    sink = sink * 31 + i;
+}
+
+static double Baseline(int count)
+{
+    volatile unsigned int sink = 0;
+    uint64_t start = GetMonotonicNanoseconds();
+    for (int i = 0; i < count; ++i)
+        Work(sink, i);
+    return (double) (GetMonotonicNanoseconds() - start);
+}
+
+static double ClockReads(int count)
+{
+    volatile unsigned int sink = 0;
+    uint64_t start = GetMonotonicNanoseconds();
+    for (int i = 0; i < count; ++i) {
+        uint64_t begin = GetMonotonicNanoseconds();
+        Work(sink, i);
+        sink += (unsigned int) (GetMonotonicNanoseconds() - begin);
+    }
+    return (double) (GetMonotonicNanoseconds() - start);
+}
+
+static double Zones(int count)
+{
+    volatile unsigned int sink = 0;
+    uint64_t start = GetMonotonicNanoseconds();
+    for (int i = 0; i < count; ++i) {
+        PROFILE_ZONE("Work");
+        Work(sink, i);
+    }
+    return (double) (GetMonotonicNanoseconds() - start);
+}
+
+static double NestedZones(int count)
+{
+    volatile unsigned int sink = 0;
+    uint64_t start = GetMonotonicNanoseconds();
+    for (int i = 0; i < count; i += 3) {
+        PROFILE_ZONE("Outer");
+        {
+            PROFILE_ZONE("Middle");
+            {
+                PROFILE_ZONE("Inner");
+                Work(sink, i);
+            }
+        }
+    }
+    return (double) (GetMonotonicNanoseconds() - start);
+}
+
+struct ThreadedZones {
+    void operator()(int begin, int end)
+    {
+        if (begin > 0)
+            PROFILE_THREAD("Worker");
+        Zones(ZonesPerThread * (end - begin));
+    }
+    int ZonesPerThread;
+};
+
+struct Exporter {
+    Exporter() : Done(false), Exports(0) {}
+    volatile bool Done;
+    int Exports;
+};
+
+static void* ExportUntilDone(void* context)
+{
+    Exporter* exporter = (Exporter*) context;
+    FILE* nowhere = fopen("/dev/null", "w");
+    while (!exporter->Done) {
+        Profiler::Get().WriteTrace(nowhere);
+        ++exporter->Exports;
+    }
+    fclose(nowhere);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options = ParseOptions(argc, argv);
+    int n = options.ZoneCount;
+
+    // Makes this thread's ring before anything gets timed.
+    PROFILE_THREAD("Main");
+    Zones(1);
+
+    double baseline = Baseline(n);
+    double zones = Zones(n);
+    double nested = NestedZones(n);
+    double clocks = ClockReads(n);
+    printf("%d zones with %d events kept per thread\n", n, PROFILER_RING_SIZE);
+    printf("  %-24s %6.1f ns per iteration\n", "without zones", baseline / n);
+    printf("  %-24s %6.1f ns per pair\n", "clock reads alone", (clocks - baseline) / n);
+    printf("  %-24s %6.1f ns per zone\n", "one thread", (zones - baseline) / n);
+    printf("  %-24s %6.1f ns per zone\n", "one thread, nested", (nested - baseline) / n);
+
+    // The zones are split between the threads, so with enough cores the
+    // cost per zone goes down; with fewer, it shows any contention.
+    ThreadedZones threaded;
+    threaded.ZonesPerThread = n / options.ThreadCount;
+    int threadedCount = threaded.ZonesPerThread * options.ThreadCount;
+    Exporter exporter;
+    pthread_t exportThread;
+    pthread_create(&exportThread, 0, ExportUntilDone, &exporter);
+    uint64_t start = GetMonotonicNanoseconds();
+    ParallelFor(options.ThreadCount, options.ThreadCount, threaded);
+    double elapsed = (double) (GetMonotonicNanoseconds() - start);
+    exporter.Done = true;
+    pthread_join(exportThread, 0);
+
+    int coreCount = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    printf("  %-24s %6.1f ns per zone, %d threads on %d cores, %d exports meanwhile\n",
+           "threaded", (elapsed - Baseline(threadedCount)) / threadedCount,
+           options.ThreadCount, coreCount, exporter.Exports);
+
+    if (!options.Trace.empty()) {
+        if (!Profiler::Get().WriteTrace(options.Trace.c_str())) {
+            printf("Unable to write %s.\n", options.Trace.c_str());
+            return 1;
+        }
+        printf("Wrote %s\n", options.Trace.c_str());
+    }
+    return 0;
+}
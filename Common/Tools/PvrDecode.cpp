@@ -0,0 +1,198 @@
+// PvrDecode unpacks one level of a PVR texture to PNG so that cooked and
+// compressed assets can be checked without a device.  Given a reference
+// image, it reports the PSNR of the decoded level against it.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o PvrDecode PvrDecode.cpp -lpng -lpthread
+//
+// Usage:
+//
+//     PvrDecode [options] input.pvr [output.png]
+//
+//     -l level     mip level to decode (default 0)
+//     -e entry     entry to decode if the input is a texture set (default 0)
+//     -c ref.png   print the PSNR against a reference image
+//     -noflip      leave rows in storage order even if the header is flipped
+
+#include "../Classes/EtcCodec.hpp"
+#include "../Classes/PixelConverter.hpp"
+#include "../Classes/PvrtcCodec.hpp"
+#include "../Classes/PvrTexture.hpp"
+#include "../Classes/TextureSet.hpp"
+#include <png.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static void Usage()
+{
+    printf("Usage: PvrDecode [options] input.pvr [output.png]\n"
+           "  -l level    mip level to decode\n"
+           "  -e entry    texture set entry to decode\n"
+           "  -c ref.png  print the PSNR against a reference image\n"
+           "  -noflip     keep rows in storage order\n");
+    exit(1);
+}
+
+static bool ReadFile(const string& path, vector<unsigned char>& contents)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    contents.resize(size > 0 ? size : 0);
+    bool ok = size > 0 && fread(&contents[0], 1, size, file) == (size_t) size;
+    fclose(file);
+    return ok;
+}
+
+static bool ReadPng(const string& path, int* width, int* height, vector<unsigned char>& rgba)
+{
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&image, path.c_str()))
+        return false;
+    image.format = PNG_FORMAT_RGBA;
+    rgba.resize(PNG_IMAGE_SIZE(image));
+    if (!png_image_finish_read(&image, 0, &rgba[0], 0, 0))
+        return false;
+    *width = image.width;
+    *height = image.height;
+    return true;
+}
+
+static bool WritePng(const string& path, int width, int height, const vector<unsigned char>& rgba)
+{
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    image.width = width;
+    image.height = height;
+    image.format = PNG_FORMAT_RGBA;
+    return png_image_write_to_file(&image, path.c_str(), 0, &rgba[0], 0, 0) != 0;
+}
+
+static bool DecodeLevel(const PvrTexture& texture, int level, vector<unsigned char>& rgba)
+{
+    PvrLevel mip = texture.GetLevel(level);
+    switch (texture.GetPixelType()) {
+        case PvrPixelTypePvrtc2:
+            DecodePvrtc(mip.Data, mip.Width, mip.Height, 2, rgba);
+            return true;
+        case PvrPixelTypePvrtc4:
+            DecodePvrtc(mip.Data, mip.Width, mip.Height, 4, rgba);
+            return true;
+        case PvrPixelTypeEtc1:
+        case PvrPixelTypeEtc2Rgb:
+        case PvrPixelTypeEtc2Rgba:
+            DecodeEtc(mip.Data, mip.Width, mip.Height, texture.GetPixelType(), rgba);
+            return true;
+        default:
+            return UnpackPixels(mip.Data, mip.Width, mip.Height, texture.GetPixelType(), rgba);
+    }
+}
+
+static void FlipRows(int width, int height, vector<unsigned char>& rgba)
+{
+    int stride = width * 4;
+    for (int y = 0; y < height / 2; ++y)
+        swap_ranges(rgba.begin() + y * stride, rgba.begin() + (y + 1) * stride,
+                    rgba.begin() + (height - 1 - y) * stride);
+}
+
+int main(int argc, char** argv)
+{
+    int level = 0;
+    int entry = 0;
+    bool flip = true;
+    string reference;
+    vector<string> files;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "-l" && i + 1 < argc)
+            level = atoi(argv[++i]);
+        else if (arg == "-e" && i + 1 < argc)
+            entry = atoi(argv[++i]);
+        else if (arg == "-c" && i + 1 < argc)
+            reference = argv[++i];
+        else if (arg == "-noflip")
+            flip = false;
+        else if (arg[0] == '-')
+            Usage();
+        else
+            files.push_back(arg);
+    }
+    if (files.empty() || files.size() > 2)
+        Usage();
+
+    vector<unsigned char> blob;
+    if (!ReadFile(files[0], blob)) {
+        printf("Unable to read %s.\n", files[0].c_str());
+        return 1;
+    }
+
+    const void* container = &blob[0];
+    size_t containerSize = blob.size();
+    TextureSet set;
+    if (set.Parse(&blob[0], blob.size())) {
+        if (entry < 0 || entry >= set.GetEntryCount()) {
+            printf("%s has %d entries.\n", files[0].c_str(), set.GetEntryCount());
+            return 1;
+        }
+        container = set.GetEntry(entry, &containerSize);
+    }
+
+    PvrTexture texture;
+    if (texture.Parse(container, containerSize) != PvrErrorNone) {
+        printf("%s: %s\n", files[0].c_str(), PvrTexture::GetErrorString(texture.GetError()));
+        return 1;
+    }
+    if (level < 0 || level >= texture.GetLevelCount()) {
+        printf("%s has %d levels.\n", files[0].c_str(), texture.GetLevelCount());
+        return 1;
+    }
+
+    vector<unsigned char> rgba;
+    if (!DecodeLevel(texture, level, rgba)) {
+        printf("%s: no decoder for pixel type 0x%x.\n", files[0].c_str(),
+               texture.GetPixelType());
+        return 1;
+    }
+
+    PvrLevel mip = texture.GetLevel(level);
+    if (flip && texture.IsVerticallyFlipped())
+        FlipRows(mip.Width, mip.Height, rgba);
+
+    printf("%s: %dx%d, level %d of %d\n", files[0].c_str(), mip.Width, mip.Height,
+           level, texture.GetLevelCount());
+
+    if (files.size() == 2 && !WritePng(files[1], mip.Width, mip.Height, rgba)) {
+        printf("Unable to write %s.\n", files[1].c_str());
+        return 1;
+    }
+
+    if (!reference.empty()) {
+        int width, height;
+        vector<unsigned char> expected;
+        if (!ReadPng(reference, &width, &height, expected)) {
+            printf("Unable to read %s.\n", reference.c_str());
+            return 1;
+        }
+        if (width != mip.Width || height != mip.Height) {
+            printf("%s is %dx%d.\n", reference.c_str(), width, height);
+            return 1;
+        }
+        printf("PSNR: %.2f dB RGB, %.2f dB alpha\n",
+               ComputePsnr(&expected[0], &rgba[0], width * height),
+               ComputePsnr(&expected[3], &rgba[3], width * height, 1));
+    }
+    return 0;
+}
@@ -0,0 +1,448 @@
+// PvrTextureCheck runs PvrTexture.hpp over PVR files and prints what it
+// makes of each one: the header, the levels of each surface, and where they
+// lie in the file, or why the file was turned down.  With -verify it fuzzes
+// the reader instead.  It builds well-formed textures in every pixel type,
+// plus any files given, then truncates them and mutates the header fields
+// (header size, dimensions, mip count, flags, data length, bit count and
+// pixel type) and checks that Parse either rejects each one or hands out
+// levels that stay inside it.
+//
+// Every blob is parsed out of a buffer of exactly its size, so building
+// with -fsanitize=address turns any read past the end into a crash.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o PvrTextureCheck PvrTextureCheck.cpp
+//
+// Usage:
+//
+//     PvrTextureCheck [options] [file.pvr ...]
+//
+//     -n mutations  mutations of each texture with -verify (default 3000)
+//     -verify       fuzz the reader
+
+#include "../Classes/PvrTexture.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+typedef vector<unsigned char> Blob;
+
+static volatile unsigned char Sink;
+
+struct CheckOptions {
+    CheckOptions() : MutationCount(3000), Verify(false) {}
+    vector<string> Files;
+    int MutationCount;
+    bool Verify;
+};
+
+static void Usage()
+{
+    printf("Usage: PvrTextureCheck [options] [file.pvr ...]\n"
+           "  -n mutations  mutations of each texture with -verify\n"
+           "  -verify       fuzz the reader\n");
+    exit(1);
+}
+
+static CheckOptions ParseOptions(int argc, char** argv)
+{
+    CheckOptions options;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-n" && hasValue)
+            options.MutationCount = atoi(argv[++i]);
+        else if (arg == "-verify")
+            options.Verify = true;
+        else if (arg[0] != '-')
+            options.Files.push_back(arg);
+        else
+            Usage();
+    }
+
+    if (options.MutationCount < 1 || (!options.Verify && options.Files.empty()))
+        Usage();
+    return options;
+}
+
+static bool ReadFile(const string& path, Blob& blob)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+    unsigned char buffer[4096];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        blob.insert(blob.end(), buffer, buffer + count);
+    fclose(file);
+    return true;
+}
+
+static const char* GetPixelTypeName(PvrPixelType type)
+{
+    switch (type) {
+        case PvrPixelTypeRgba4444: return "RGBA4444";
+        case PvrPixelTypeRgba5551: return "RGBA5551";
+        case PvrPixelTypeRgba8888: return "RGBA8888";
+        case PvrPixelTypeRgb565: return "RGB565";
+        case PvrPixelTypeRgb555: return "RGB555";
+        case PvrPixelTypeRgb888: return "RGB888";
+        case PvrPixelTypeI8: return "I8";
+        case PvrPixelTypeAi88: return "AI88";
+        case PvrPixelTypePvrtc2: return "PVRTC2";
+        case PvrPixelTypePvrtc4: return "PVRTC4";
+        case PvrPixelTypeBgra8888: return "BGRA8888";
+        case PvrPixelTypeEtc1: return "ETC1";
+        case PvrPixelTypeEtc2Rgb: return "ETC2 RGB";
+        case PvrPixelTypeEtc2Rgba: return "ETC2 RGBA";
+    }
+    return "unknown";
+}
+
+static int Report(const CheckOptions& options)
+{
+    int rejected = 0;
+    for (size_t i = 0; i < options.Files.size(); ++i) {
+        const string& path = options.Files[i];
+        Blob blob;
+        if (!ReadFile(path, blob)) {
+            printf("%s: unable to read\n", path.c_str());
+            ++rejected;
+            continue;
+        }
+
+        PvrTexture texture;
+        PvrError error = texture.Parse(blob.empty() ? 0 : &blob[0], blob.size());
+        if (error != PvrErrorNone) {
+            printf("%s: %s\n", path.c_str(), PvrTexture::GetErrorString(error));
+            ++rejected;
+            continue;
+        }
+
+        const PvrHeader& header = texture.GetHeader();
+        printf("%s: %dx%d %s, %d-byte header, %d levels, %d surfaces%s%s\n", path.c_str(),
+               texture.GetWidth(), texture.GetHeight(), GetPixelTypeName(texture.GetPixelType()),
+               header.HeaderSize, texture.GetLevelCount(), texture.GetSurfaceCount(),
+               texture.HasAlpha() ? ", alpha" : "",
+               texture.IsVerticallyFlipped() ? ", flipped" : "");
+        for (int surface = 0; surface < texture.GetSurfaceCount(); ++surface) {
+            for (int level = 0; level < texture.GetLevelCount(); ++level) {
+                PvrLevel mip = texture.GetLevel(level, surface);
+                printf("  surface %d  level %2d  %4dx%-4d  %8d bytes at %d\n", surface, level,
+                       mip.Width, mip.Height, (int) mip.Size, (int) (mip.Data - &blob[0]));
+            }
+        }
+        size_t unused = blob.size() - header.HeaderSize - texture.GetDataSize();
+        if (unused)
+            printf("  %d bytes after the last level\n", (int) unused);
+    }
+    return rejected ? 1 : 0;
+}
+
+// A well-formed texture: a v1 or v2 header, then every level of every
+// surface, filled with a pattern.
+static Blob MakeTexture(PvrPixelType type, int width, int height, int levelCount,
+                        int surfaceCount, bool cubeMap, bool v2)
+{
+    PvrHeader header;
+    memset(&header, 0, sizeof(header));
+    header.HeaderSize = v2 ? PvrHeaderSizeV2 : PvrHeaderSizeV1;
+    header.Width = width;
+    header.Height = height;
+    header.MipMapCount = levelCount - 1;
+    header.Flags = type | (levelCount > 1 ? PvrFlagsMipMap : 0) | (cubeMap ? PvrFlagsCubeMap : 0);
+    header.BitCount = PvrTexture::GetBitsPerPixel(type);
+    header.PVR = PvrIdentifier;
+    header.NumSurfs = cubeMap ? 6 : surfaceCount;
+
+    size_t surfaceSize = 0;
+    for (int level = 0; level < levelCount; ++level) {
+        int w = width >> level, h = height >> level;
+        surfaceSize += PvrTexture::ComputeLevelSize(type, w ? w : 1, h ? h : 1);
+    }
+    header.TextureDataSize = surfaceSize;
+    size_t dataSize = surfaceSize * (cubeMap ? 6 : surfaceCount);
+
+    Blob blob(header.HeaderSize + dataSize);
+    memcpy(&blob[0], &header, header.HeaderSize);
+    for (size_t i = header.HeaderSize; i < blob.size(); ++i)
+        blob[i] = (unsigned char) (i * 7);
+    return blob;
+}
+
+static vector<Blob> MakeTextures()
+{
+    const PvrPixelType types[] = {
+        PvrPixelTypeRgba4444, PvrPixelTypeRgba5551, PvrPixelTypeRgba8888,
+        PvrPixelTypeRgb565, PvrPixelTypeRgb888, PvrPixelTypeI8, PvrPixelTypeAi88,
+        PvrPixelTypePvrtc2, PvrPixelTypePvrtc4, PvrPixelTypeBgra8888,
+        PvrPixelTypeEtc1, PvrPixelTypeEtc2Rgb, PvrPixelTypeEtc2Rgba,
+    };
+    vector<Blob> textures;
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); ++i) {
+        PvrPixelType type = types[i];
+        bool pvrtc = type == PvrPixelTypePvrtc2 || type == PvrPixelTypePvrtc4;
+        textures.push_back(MakeTexture(type, 32, 16, 6, 1, false, true));
+        textures.push_back(MakeTexture(type, 8, 8, 1, 1, false, false));
+        textures.push_back(MakeTexture(type, 16, 16, 2, 1, true, true));
+        if (!pvrtc) {
+            textures.push_back(MakeTexture(type, 13, 7, 4, 2, false, true));
+            textures.push_back(MakeTexture(type, 1, 1, 1, 1, false, false));
+        }
+    }
+    return textures;
+}
+
+// Checks a texture that Parse accepted: every level of every surface has to
+// lie inside the blob, where the texel data starts, and be the size its
+// dimensions call for.  Touching the first and last bytes of each level
+// lets AddressSanitizer catch anything the bounds check misses.
+static bool CheckLevels(const PvrTexture& texture, const unsigned char* blob, size_t blobSize)
+{
+    const unsigned char* begin = blob + texture.GetHeader().HeaderSize;
+    const unsigned char* end = blob + blobSize;
+    if (texture.GetData() != begin || texture.GetDataSize() > (size_t) (end - begin))
+        return false;
+    if (texture.GetLevelCount() < 1 || texture.GetLevelCount() > PvrTexture::MaxLevels ||
+        texture.GetSurfaceCount() < 1 || texture.GetSurfaceCount() > PvrTexture::MaxSurfaces)
+        return false;
+
+    for (int surface = 0; surface < texture.GetSurfaceCount(); ++surface) {
+        for (int level = 0; level < texture.GetLevelCount(); ++level) {
+            PvrLevel mip = texture.GetLevel(level, surface);
+            if (mip.Width < 1 || mip.Height < 1 || mip.Size == 0)
+                return false;
+            if (mip.Size != PvrTexture::ComputeLevelSize(texture.GetPixelType(),
+                                                         mip.Width, mip.Height))
+                return false;
+            if (mip.Data < begin || mip.Data > end || mip.Size > (size_t) (end - mip.Data))
+                return false;
+            Sink = mip.Data[0] ^ mip.Data[mip.Size - 1];
+        }
+    }
+    return true;
+}
+
+// Parses a copy of the blob that's exactly its size, and returns false if
+// the reader accepted it with levels outside it.
+static bool ParseCopy(const Blob& blob, PvrError* error)
+{
+    unsigned char* copy = (unsigned char*) malloc(blob.size() ? blob.size() : 1);
+    if (!blob.empty())
+        memcpy(copy, &blob[0], blob.size());
+    PvrTexture texture;
+    *error = texture.Parse(copy, blob.size());
+    bool ok = *error != PvrErrorNone || CheckLevels(texture, copy, blob.size());
+    free(copy);
+    return ok;
+}
+
+static unsigned int GetField(const Blob& blob, int offset)
+{
+    unsigned int value;
+    memcpy(&value, &blob[offset], sizeof(value));
+    return value;
+}
+
+static void SetField(Blob& blob, int offset, unsigned int value)
+{
+    if (offset + sizeof(value) <= blob.size())
+        memcpy(&blob[offset], &value, sizeof(value));
+}
+
+// Values that tend to sit on the edges of the reader's checks.
+static unsigned int GetNastyValue(unsigned int original)
+{
+    switch (rand() % 12) {
+        case 0: return 0;
+        case 1: return 1;
+        case 2: return ~0u;
+        case 3: return 0x80000000u;
+        case 4: return 0x7fffffffu;
+        case 5: return original + 1;
+        case 6: return original - 1;
+        case 7: return original * 2;
+        case 8: return original / 2;
+        case 9: return original << (1 + rand() % 16);
+        case 10: return original ^ (1u << (rand() % 32));
+        default: return (unsigned int) rand() * 65599u + rand();
+    }
+}
+
+// Mutates one or more header fields, sometimes flips bytes anywhere, and
+// sometimes truncates or extends the blob.
+static void Mutate(Blob& blob)
+{
+    enum {
+        FieldHeaderSize = 0, FieldHeight = 4, FieldWidth = 8, FieldMipMapCount = 12,
+        FieldFlags = 16, FieldDataSize = 20, FieldBitCount = 24, FieldIdentifier = 44,
+        FieldSurfaceCount = 48,
+    };
+    const int fields[] = {
+        FieldHeaderSize, FieldHeight, FieldWidth, FieldMipMapCount, FieldFlags,
+        FieldDataSize, FieldBitCount, FieldIdentifier, FieldSurfaceCount,
+    };
+    int mutationCount = 1 + rand() % 3;
+    for (int i = 0; i < mutationCount; ++i) {
+        int choice = rand() % 13;
+        if (choice < 9) {
+            int offset = fields[choice];
+            if (offset + 4 <= (int) blob.size())
+                SetField(blob, offset, GetNastyValue(GetField(blob, offset)));
+        } else if (choice == 9) {
+            // The pixel type alone, keeping the rest of the flags.
+            unsigned int flags = GetField(blob, FieldFlags);
+            const unsigned int types[] = {
+                0, 0x0f, 0x10, 0x12, 0x14, 0x18, 0x19, 0x1a, 0x1b, 0x35, 0x36, 0x37,
+                0xe0, 0xe1, 0xe2, 0xff, (unsigned int) rand() & 0xff,
+            };
+            flags = (flags & ~PvrFlagsPixelType) | types[rand() % (sizeof(types) / sizeof(types[0]))];
+            SetField(blob, FieldFlags, flags);
+        } else if (choice == 10) {
+            unsigned int flags = GetField(blob, FieldFlags);
+            SetField(blob, FieldFlags, flags ^ (1u << (8 + rand() % 24)));
+        } else if (choice == 11 && !blob.empty()) {
+            blob[rand() % blob.size()] ^= (unsigned char) (1 + rand() % 255);
+        } else if (!blob.empty()) {
+            if (rand() % 4)
+                blob.resize(rand() % blob.size());
+            else
+                blob.resize(blob.size() + 1 + rand() % 64, 0xcd);
+            if (blob.size() < 52)
+                return;
+        }
+    }
+}
+
+static int Verify(const CheckOptions& options)
+{
+    int failures = 0;
+    vector<Blob> textures = MakeTextures();
+    for (size_t i = 0; i < options.Files.size(); ++i) {
+        Blob blob;
+        if (!ReadFile(options.Files[i], blob)) {
+            printf("Unable to read %s.\n", options.Files[i].c_str());
+            return 1;
+        }
+        textures.push_back(blob);
+    }
+    size_t madeCount = textures.size() - options.Files.size();
+
+    // The well-formed textures parse, with their levels packed end to end,
+    // and so do the files given.
+    for (size_t i = 0; i < textures.size(); ++i) {
+        const Blob& blob = textures[i];
+        PvrTexture texture;
+        PvrError error = texture.Parse(&blob[0], blob.size());
+        bool made = i < madeCount;
+        if (error != PvrErrorNone) {
+            printf("Texture %d was turned down: %s.\n", (int) i, PvrTexture::GetErrorString(error));
+            ++failures;
+            continue;
+        }
+        if (!CheckLevels(texture, &blob[0], blob.size()) ||
+            (made && texture.GetHeader().HeaderSize + texture.GetDataSize() != blob.size())) {
+            printf("Texture %d's levels don't fill it.\n", (int) i);
+            ++failures;
+        }
+
+        // Without a size, the reader takes the header's word for it.
+        PvrTexture unsized;
+        if (unsized.Parse(&blob[0]) != PvrErrorNone ||
+            unsized.GetDataSize() != texture.GetDataSize()) {
+            printf("Texture %d parses differently without a size.\n", (int) i);
+            ++failures;
+        }
+    }
+
+    // Every truncation of a well-formed texture is turned down, since they
+    // hold nothing past their last level.
+    for (size_t i = 0; i < madeCount; ++i) {
+        Blob blob = textures[i];
+        for (size_t size = blob.size(); size-- > 0;) {
+            blob.resize(size);
+            PvrError error;
+            if (!ParseCopy(blob, &error) || error == PvrErrorNone) {
+                printf("Texture %d truncated to %d bytes was accepted.\n", (int) i, (int) size);
+                ++failures;
+                break;
+            }
+        }
+    }
+
+    // Mutated headers are either turned down or come out with every level
+    // inside the blob.
+    srand(1);
+    int accepted = 0, total = 0;
+    for (size_t i = 0; i < textures.size(); ++i) {
+        for (int n = 0; n < options.MutationCount; ++n) {
+            Blob blob = textures[i];
+            Mutate(blob);
+            PvrError error;
+            ++total;
+            if (!ParseCopy(blob, &error)) {
+                printf("Mutation %d of texture %d was accepted with levels outside it.\n",
+                       n, (int) i);
+                ++failures;
+                break;
+            }
+            accepted += error == PvrErrorNone;
+        }
+    }
+    printf("%d of %d mutated textures were accepted, all with their levels inside.\n",
+           accepted, total);
+
+    // Headerless data gets the same treatment with random dimensions and
+    // pixel types over a buffer that may be too small.
+    for (int n = 0; n < options.MutationCount; ++n) {
+        int width = rand() % 2 ? rand() % 64 : (int) GetNastyValue(16);
+        int height = rand() % 2 ? rand() % 64 : (int) GetNastyValue(16);
+        PvrPixelType type = (PvrPixelType) (rand() % 0x100);
+        Blob blob(rand() % 8192 + 1, 0x5a);
+        PvrTexture texture;
+        if (texture.ParseHeaderless(&blob[0], blob.size(), type, width, height) != PvrErrorNone &&
+            texture.IsValid()) {
+            printf("A failed headerless parse left the texture valid.\n");
+            ++failures;
+            break;
+        }
+        if (texture.IsValid() && (texture.GetData() != &blob[0] ||
+                                  texture.GetDataSize() > blob.size())) {
+            printf("A %dx%d headerless texture of type 0x%x overruns its %d bytes.\n",
+                   width, height, type, (int) blob.size());
+            ++failures;
+            break;
+        }
+    }
+
+    // A rejected parse leaves nothing to read.
+    {
+        Blob blob = textures[0];
+        PvrTexture texture;
+        texture.Parse(&blob[0], blob.size());
+        blob[0] = 99;
+        if (texture.Parse(&blob[0], blob.size()) == PvrErrorNone || texture.IsValid() ||
+            texture.GetLevelCount() || texture.GetData()) {
+            printf("A rejected parse kept the previous texture.\n");
+            ++failures;
+        }
+    }
+
+    if (failures)
+        printf("%d checks failed\n", failures);
+    else
+        printf("Every check passed\n");
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+    CheckOptions options = ParseOptions(argc, argv);
+    if (options.Verify)
+        return Verify(options);
+    return Report(options);
+}
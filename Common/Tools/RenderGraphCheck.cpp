@@ -0,0 +1,463 @@
+// RenderGraphCheck compiles the render graphs that GaussianBloom and
+// Trefoil.Jitter build, and prints the schedule: which passes run, which
+// slot each surface lands in, what gets loaded and discarded, and how much
+// offscreen memory the slots take against what the samples used to
+// allocate.  With -verify it compiles random graphs instead, and checks
+// that running the schedule through the shared slots leaves the imported
+// surfaces as running every pass with its own storage would have.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o RenderGraphCheck RenderGraphCheck.cpp
+//
+// Usage:
+//
+//     RenderGraphCheck [options]
+//
+//     -s WxH        screen size (default 320x480)
+//     -all          blur every bloom level, as GaussianBloom does without Optimize
+//     -j samples    jitter samples for Trefoil.Jitter (default 8)
+//     -verify       check random graphs
+//     -n graphs     random graphs to check with -verify (default 20000)
+
+#include "../Classes/RenderGraph.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+struct CheckOptions {
+    CheckOptions() :
+        Width(320), Height(480), BlurAll(false), JitterCount(8), Verify(false),
+        GraphCount(20000) {}
+    int Width;
+    int Height;
+    bool BlurAll;
+    int JitterCount;
+    bool Verify;
+    int GraphCount;
+};
+
+static void Usage()
+{
+    printf("Usage: RenderGraphCheck [options]\n"
+           "  -s WxH        screen size\n"
+           "  -all          blur every bloom level\n"
+           "  -j samples    jitter samples for Trefoil.Jitter\n"
+           "  -verify       check random graphs\n"
+           "  -n graphs     random graphs to check with -verify\n");
+    exit(1);
+}
+
+static CheckOptions ParseOptions(int argc, char** argv)
+{
+    CheckOptions options;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-s" && hasValue) {
+            if (sscanf(argv[++i], "%dx%d", &options.Width, &options.Height) != 2)
+                Usage();
+        } else if (arg == "-all")
+            options.BlurAll = true;
+        else if (arg == "-j" && hasValue)
+            options.JitterCount = atoi(argv[++i]);
+        else if (arg == "-verify")
+            options.Verify = true;
+        else if (arg == "-n" && hasValue)
+            options.GraphCount = atoi(argv[++i]);
+        else
+            Usage();
+    }
+
+    if (options.Width < 1 || options.Height < 1 || options.JitterCount < 1 ||
+        options.GraphCount < 1)
+        Usage();
+    return options;
+}
+
+// The same passes GaussianBloom's Initialize declares.
+static void BuildBloomGraph(RenderGraph& graph, const CheckOptions& options)
+{
+    const int OffscreenCount = 5;
+    int w = options.Width, h = options.Height;
+    int sceneColor = graph.CreateResource("SceneColor", w, h, RenderGraphFormatRgba8);
+    int sceneDepth = graph.CreateResource("SceneDepth", w, h, RenderGraphFormatDepth16);
+    int onscreen = graph.ImportResource("Onscreen");
+    int scene = graph.AddPass("Scene");
+    graph.Write(scene, sceneColor);
+    graph.Write(scene, sceneDepth);
+
+    int bloom[OffscreenCount];
+    int source = sceneColor;
+    for (int i = 0; i < OffscreenCount; ++i, w >>= 1, h >>= 1) {
+        bloom[i] = graph.CreateResource("Downsampled", w, h, RenderGraphFormatRgba8);
+        int pass = graph.AddPass(i ? "Downsample" : "HighPass");
+        graph.Read(pass, source);
+        graph.Write(pass, bloom[i]);
+        source = bloom[i];
+    }
+
+    w = options.Width; h = options.Height;
+    for (int i = 0; i < OffscreenCount; ++i, w >>= 1, h >>= 1) {
+        int horizontal = graph.CreateResource("HorizontalBlur", w, h, RenderGraphFormatRgba8);
+        int vertical = graph.CreateResource("VerticalBlur", w, h, RenderGraphFormatRgba8);
+        int pass = graph.AddPass("HorizontalBlur");
+        graph.Read(pass, bloom[i]);
+        graph.Write(pass, horizontal);
+        pass = graph.AddPass("VerticalBlur");
+        graph.Read(pass, horizontal);
+        graph.Write(pass, vertical);
+        if (options.BlurAll || i >= 2)
+            bloom[i] = vertical;
+    }
+
+    int composite = graph.AddPass("Composite");
+    graph.Read(composite, sceneColor);
+    for (int i = 1; i < OffscreenCount; ++i)
+        graph.Read(composite, bloom[i]);
+    graph.Write(composite, onscreen);
+    graph.Compile();
+}
+
+// What GaussianBloom allocated before: a scene texture with an unused
+// color renderbuffer behind it, a depth buffer, and two textures and two
+// renderbuffers per level.
+static int GetOldBloomBytes(const CheckOptions& options)
+{
+    int pixels = options.Width * options.Height;
+    int bytes = pixels * (4 + 4 + 2);
+    int w = options.Width, h = options.Height;
+    for (int i = 0; i < 5; ++i, w >>= 1, h >>= 1)
+        bytes += w * h * 4 * 4;
+    return bytes;
+}
+
+// The same passes Trefoil.Jitter's Initialize declares.
+static void BuildJitterGraph(RenderGraph& graph, const CheckOptions& options)
+{
+    int w = options.Width, h = options.Height;
+    int accumulated = graph.ImportResource("Accumulated");
+    int clear = graph.AddPass("Clear");
+    graph.Write(clear, accumulated);
+    for (int i = 0; i < options.JitterCount; ++i) {
+        int color = graph.CreateResource("SceneColor", w, h, RenderGraphFormatRgba8);
+        int depth = graph.CreateResource("SceneDepth", w, h, RenderGraphFormatDepth24);
+        int stencil = graph.CreateResource("SceneStencil", w, h, RenderGraphFormatStencil8);
+        int scene = graph.AddPass("Scene");
+        graph.Write(scene, color);
+        graph.Write(scene, depth);
+        graph.Write(scene, stencil);
+        int accumulate = graph.AddPass("Accumulate");
+        graph.Read(accumulate, color);
+        graph.Write(accumulate, accumulated, true);
+    }
+    graph.Compile();
+}
+
+// Trefoil.Jitter had a texture, an unused color renderbuffer, and depth
+// and stencil buffers.
+static int GetOldJitterBytes(const CheckOptions& options)
+{
+    return options.Width * options.Height * (4 + 4 + 4 + 1);
+}
+
+static const char* GetFormatName(RenderGraphFormat format)
+{
+    switch (format) {
+        case RenderGraphFormatRgba8: return "RGBA8";
+        case RenderGraphFormatRgb565: return "RGB565";
+        case RenderGraphFormatDepth16: return "DEPTH16";
+        case RenderGraphFormatDepth24: return "DEPTH24";
+        default: return "STENCIL8";
+    }
+}
+
+static void PrintSchedule(const char* title, const RenderGraph& graph, int oldBytes)
+{
+    printf("%s\n\n", title);
+    const vector<RenderGraphStep>& steps = graph.GetSteps();
+    size_t next = 0;
+    for (int p = 0; p < graph.GetPassCount(); ++p) {
+        if (graph.IsCulled(p)) {
+            printf("  %-16s culled\n", graph.GetPassName(p));
+            continue;
+        }
+        const RenderGraphStep& step = steps[next++];
+        printf("  %-16s", graph.GetPassName(p));
+        for (size_t i = 0; i < step.Outputs.size(); ++i) {
+            const RenderGraphAttachment& output = step.Outputs[i];
+            if (output.Slot < 0)
+                printf(" %s", graph.GetResourceName(output.Resource));
+            else
+                printf(" slot %d", output.Slot);
+            printf("%s%s", output.Load ? " (load)" : "", output.Discard ? " (discard)" : "");
+        }
+        printf("\n");
+    }
+
+    printf("\n  slot  size        format    kind\n");
+    const vector<RenderGraphSlot>& slots = graph.GetSlots();
+    for (size_t s = 0; s < slots.size(); ++s) {
+        char size[32];
+        snprintf(size, sizeof(size), "%dx%d", slots[s].Width, slots[s].Height);
+        printf("  %-5d %-11s %-9s %s\n", (int) s, size, GetFormatName(slots[s].Format),
+               slots[s].Texture ? "texture" : "renderbuffer");
+    }
+
+    printf("\n  %-16s %6.2f MB\n", "before", oldBytes / 1048576.0);
+    printf("  %-16s %6.2f MB\n", "one per surface", graph.GetUnaliasedBytes() / 1048576.0);
+    printf("  %-16s %6.2f MB\n\n", "aliased", graph.GetAllocatedBytes() / 1048576.0);
+}
+
+static int Report(const CheckOptions& options)
+{
+    RenderGraph bloom;
+    BuildBloomGraph(bloom, options);
+    PrintSchedule("GaussianBloom", bloom, GetOldBloomBytes(options));
+
+    RenderGraph jitter;
+    BuildJitterGraph(jitter, options);
+    PrintSchedule("Trefoil.Jitter", jitter, GetOldJitterBytes(options));
+    return 0;
+}
+
+// A random graph, along with what it was told, so the schedule can be
+// checked against the declarations rather than against itself.  Passes
+// never read what they write, only read and load what some earlier pass
+// wrote, and only sample offscreen surfaces.
+struct RandomGraph {
+    RenderGraph Graph;
+    vector<RenderGraphSlot> Descriptions;
+    vector<bool> Imported;
+    vector<vector<int> > Reads;
+    vector<vector<pair<int, bool> > > Writes;
+};
+
+static bool Contains(const vector<int>& list, int value)
+{
+    for (size_t i = 0; i < list.size(); ++i)
+        if (list[i] == value)
+            return true;
+    return false;
+}
+
+static void BuildRandomGraph(RandomGraph& random)
+{
+    int resourceCount = 1 + rand() % 10;
+    int importCount = 1 + rand() % 2;
+    for (int r = 0; r < resourceCount + importCount; ++r) {
+        RenderGraphSlot description = { 0, 0, RenderGraphFormatRgba8, false };
+        bool imported = r >= resourceCount;
+        if (imported) {
+            random.Graph.ImportResource("Imported");
+        } else {
+            description.Width = description.Height = rand() % 2 ? 4 : 8;
+            description.Format = rand() % 3 ? RenderGraphFormatRgba8 : RenderGraphFormatDepth16;
+            random.Graph.CreateResource("Surface", description.Width, description.Height,
+                                        description.Format);
+        }
+        random.Descriptions.push_back(description);
+        random.Imported.push_back(imported);
+    }
+
+    int total = resourceCount + importCount;
+    int passCount = 1 + rand() % 16;
+    vector<bool> written(total, false);
+    for (int p = 0; p < passCount; ++p) {
+        random.Graph.AddPass("Pass");
+        vector<int> writes;
+        int writeCount = 1 + rand() % 3;
+        for (int i = 0; i < writeCount; ++i) {
+            int r = rand() % total;
+            if (!Contains(writes, r))
+                writes.push_back(r);
+        }
+        vector<int> reads;
+        int readCount = rand() % 4;
+        for (int i = 0; i < readCount; ++i) {
+            int r = rand() % resourceCount;
+            if (written[r] && !Contains(writes, r) && !Contains(reads, r))
+                reads.push_back(r);
+        }
+        random.Reads.push_back(reads);
+        random.Writes.push_back(vector<pair<int, bool> >());
+        for (size_t i = 0; i < reads.size(); ++i)
+            random.Graph.Read(p, reads[i]);
+        for (size_t i = 0; i < writes.size(); ++i) {
+            int r = writes[i];
+            bool load = (written[r] || random.Imported[r]) && rand() % 3 == 0;
+            random.Graph.Write(p, r, load);
+            random.Writes[p].push_back(make_pair(r, load));
+        }
+        for (size_t i = 0; i < writes.size(); ++i)
+            written[writes[i]] = true;
+    }
+    random.Graph.Compile();
+}
+
+static unsigned long long Mix(unsigned long long x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    return x ^ (x >> 33);
+}
+
+// Each pass writes a hash of its index, what it reads, and what it loads.
+// Runs every pass with a value per surface, or when scheduled, just the
+// steps through the shared slots.  Slots start out holding junk.
+static vector<unsigned long long> Run(const RandomGraph& random, bool scheduled)
+{
+    const RenderGraph& graph = random.Graph;
+    int total = (int) random.Imported.size();
+    vector<unsigned long long> surfaces(total, 0);
+    vector<unsigned long long> slots(graph.GetSlots().size(), 0);
+    for (size_t s = 0; s < slots.size(); ++s)
+        slots[s] = Mix(s + 12345);
+
+    for (int p = 0; p < graph.GetPassCount(); ++p) {
+        if (scheduled && graph.IsCulled(p))
+            continue;
+        unsigned long long* storage[32];
+        for (int r = 0; r < total; ++r) {
+            bool shared = scheduled && !random.Imported[r];
+            storage[r] = shared && graph.GetSlot(r) >= 0 ? &slots[graph.GetSlot(r)] : &surfaces[r];
+        }
+        unsigned long long hash = Mix(p + 1);
+        for (size_t i = 0; i < random.Reads[p].size(); ++i)
+            hash = Mix(hash ^ *storage[random.Reads[p][i]]);
+        vector<unsigned long long> values;
+        for (size_t i = 0; i < random.Writes[p].size(); ++i) {
+            int r = random.Writes[p][i].first;
+            unsigned long long old = random.Writes[p][i].second ? *storage[r] : 0;
+            values.push_back(Mix(hash ^ Mix(r + 1) ^ old));
+        }
+        for (size_t i = 0; i < random.Writes[p].size(); ++i)
+            *storage[random.Writes[p][i].first] = values[i];
+    }
+
+    vector<unsigned long long> imported;
+    for (int r = 0; r < total; ++r)
+        if (random.Imported[r])
+            imported.push_back(surfaces[r]);
+    return imported;
+}
+
+// Returns a description of the first thing wrong with the schedule, or 0.
+static const char* CheckGraph(const RandomGraph& random)
+{
+    const RenderGraph& graph = random.Graph;
+    int total = (int) random.Imported.size();
+    int passCount = graph.GetPassCount();
+
+    vector<int> first(total, -1), last(total, -1);
+    vector<bool> sampled(total, false);
+    for (int p = 0; p < passCount; ++p) {
+        if (graph.IsCulled(p))
+            continue;
+        vector<int> used(random.Reads[p]);
+        for (size_t i = 0; i < random.Writes[p].size(); ++i)
+            used.push_back(random.Writes[p][i].first);
+        for (size_t i = 0; i < used.size(); ++i) {
+            if (first[used[i]] < 0)
+                first[used[i]] = p;
+            last[used[i]] = p;
+        }
+        for (size_t i = 0; i < random.Reads[p].size(); ++i)
+            sampled[random.Reads[p][i]] = true;
+    }
+
+    const vector<RenderGraphSlot>& slots = graph.GetSlots();
+    for (int r = 0; r < total; ++r) {
+        int slot = graph.GetSlot(r);
+        if (random.Imported[r] || first[r] < 0) {
+            if (slot >= 0)
+                return "a surface that needs no storage has a slot";
+            continue;
+        }
+        if (slot < 0 || slot >= (int) slots.size())
+            return "a surface in use has no slot";
+        const RenderGraphSlot& description = random.Descriptions[r];
+        if (slots[slot].Width != description.Width || slots[slot].Height != description.Height ||
+            slots[slot].Format != description.Format)
+            return "a surface shares a slot of another size or format";
+        if (slots[slot].Texture != sampled[r])
+            return "a slot is a texture when nothing samples it, or the other way round";
+        for (int other = 0; other < r; ++other)
+            if (graph.GetSlot(other) == slot && first[other] <= last[r] && first[r] <= last[other])
+                return "surfaces whose lifetimes overlap share a slot";
+    }
+
+    const vector<RenderGraphStep>& steps = graph.GetSteps();
+    size_t next = 0;
+    for (int p = 0; p < passCount; ++p) {
+        if (graph.IsCulled(p))
+            continue;
+        if (next == steps.size() || steps[next].Pass != p)
+            return "the steps aren't the passes that run, in order";
+        const RenderGraphStep& step = steps[next++];
+        if (step.Outputs.size() != random.Writes[p].size())
+            return "a step is missing outputs";
+
+        bool useful = false;
+        for (size_t i = 0; i < step.Outputs.size(); ++i) {
+            int r = random.Writes[p][i].first;
+            const RenderGraphAttachment& output = step.Outputs[i];
+            if (output.Resource != r || output.Slot != graph.GetSlot(r) ||
+                output.Load != random.Writes[p][i].second)
+                return "a step's output doesn't match the pass";
+            if (output.Discard != (!random.Imported[r] && last[r] == p))
+                return "an output is discarded while a later pass uses it, or kept when none does";
+            useful = useful || random.Imported[r] || last[r] > p;
+        }
+        if (!useful)
+            return "a pass runs although nothing uses what it writes";
+    }
+    if (next != steps.size())
+        return "there are steps for culled passes";
+
+    if (graph.GetAllocatedBytes() > graph.GetUnaliasedBytes())
+        return "aliasing takes more memory than it saves";
+    if (Run(random, false) != Run(random, true))
+        return "the schedule leaves an imported surface different";
+    return 0;
+}
+
+static int Verify(const CheckOptions& options)
+{
+    srand(1);
+    int passes = 0, culled = 0;
+    double allocated = 0, unaliased = 0;
+    for (int g = 0; g < options.GraphCount; ++g) {
+        RandomGraph random;
+        BuildRandomGraph(random);
+        const char* error = CheckGraph(random);
+        if (error) {
+            printf("Graph %d: %s.\n", g, error);
+            return 1;
+        }
+        passes += random.Graph.GetPassCount();
+        culled += random.Graph.GetPassCount() - (int) random.Graph.GetSteps().size();
+        allocated += random.Graph.GetAllocatedBytes();
+        unaliased += random.Graph.GetUnaliasedBytes();
+    }
+    printf("%d random graphs, %d passes, %d culled\n", options.GraphCount, passes, culled);
+    printf("Aliasing took %.0f%% of the memory of one allocation per surface\n",
+           unaliased ? 100 * allocated / unaliased : 100);
+    printf("Every schedule checked out\n");
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    CheckOptions options = ParseOptions(argc, argv);
+    if (options.Verify)
+        return Verify(options);
+    return Report(options);
+}
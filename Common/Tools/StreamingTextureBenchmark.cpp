@@ -0,0 +1,544 @@
+// StreamingTextureBenchmark streams synthetic camera frames from a producer
+// thread to a render loop, through FrameQueue.hpp and StreamingTexture.hpp
+// on a mock GL, and reports latency, dropped frames and copies per frame.
+// For comparison it runs the path they replace: a buffer shared under a
+// mutex, copied in by the producer, copied out by the consumer, and then
+// uploaded with a glTexImage2D that reallocates the texture every frame.
+//
+// Latency runs from when the producer starts filling a frame, which is
+// when a camera would have captured it, to when the consumer's upload
+// returns.  Copies count whole frames moved after the producer's fill,
+// including the one the driver makes out of client memory.
+//
+// Build on Linux or Mac OS X, with the Mesa or ANGLE GLES headers, with:
+//
+//     g++ -O2 -o StreamingTextureBenchmark StreamingTextureBenchmark.cpp -lpthread
+//
+// Usage:
+//
+//     StreamingTextureBenchmark [options]
+//
+//     -s WxH        frame size (default 640x480)
+//     -p fps        frames the producer makes a second (default 30)
+//     -c fps        frames the consumer renders a second (default 60)
+//     -f frames     frames to render for each path (default 120)
+//     -verify       check the queue and the texture ring instead
+//     -n frames     frames to stream with -verify (default 200000)
+
+#include <GLES/gl.h>
+#include "../Classes/MonotonicClock.hpp"
+#include "../Classes/StreamingTexture.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct BenchmarkOptions {
+    BenchmarkOptions() :
+        Width(640), Height(480), ProducerRate(30), ConsumerRate(60), FrameCount(120),
+        Verify(false), StreamCount(200000) {}
+    int Width;
+    int Height;
+    int ProducerRate;
+    int ConsumerRate;
+    int FrameCount;
+    bool Verify;
+    int StreamCount;
+};
+
+static void Usage()
+{
+    printf("Usage: StreamingTextureBenchmark [options]\n"
+           "  -s WxH        frame size\n"
+           "  -p fps        frames the producer makes a second\n"
+           "  -c fps        frames the consumer renders a second\n"
+           "  -f frames     frames to render for each path\n"
+           "  -verify       check the queue and the texture ring instead\n"
+           "  -n frames     frames to stream with -verify\n");
+    exit(1);
+}
+
+static BenchmarkOptions ParseOptions(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-s" && hasValue) {
+            if (sscanf(argv[++i], "%dx%d", &options.Width, &options.Height) != 2)
+                Usage();
+        } else if (arg == "-p" && hasValue)
+            options.ProducerRate = atoi(argv[++i]);
+        else if (arg == "-c" && hasValue)
+            options.ConsumerRate = atoi(argv[++i]);
+        else if (arg == "-f" && hasValue)
+            options.FrameCount = atoi(argv[++i]);
+        else if (arg == "-verify")
+            options.Verify = true;
+        else if (arg == "-n" && hasValue)
+            options.StreamCount = atoi(argv[++i]);
+        else
+            Usage();
+    }
+
+    if (options.Width < 1 || options.Height < 1 || options.ProducerRate < 1 ||
+        options.ConsumerRate < 1 || options.FrameCount < 1 || options.StreamCount < 1)
+        Usage();
+    return options;
+}
+
+// Enough of a driver to keep each texture's storage and count what it
+// costs.  Every GL call comes from the consumer's thread.
+struct MockTexture {
+    MockTexture() : Width(0), Height(0) {}
+    int Width;
+    int Height;
+    vector<unsigned char> Pixels;
+};
+
+static map<GLuint, MockTexture> Textures;
+static GLuint BoundTexture;
+static GLuint NextTexture = 1;
+static int Allocations;
+static int Uploads;
+static double CopiedBytes;
+
+static int GetBytesPerPixel(GLenum format)
+{
+    return format == GL_RGBA ? 4 : format == GL_RGB ? 3 : format == GL_LUMINANCE_ALPHA ? 2 : 1;
+}
+
+extern "C" {
+
+void glGenTextures(GLsizei count, GLuint* textures)
+{
+    for (int i = 0; i < count; ++i)
+        textures[i] = NextTexture++;
+}
+
+void glDeleteTextures(GLsizei count, const GLuint* textures)
+{
+    for (int i = 0; i < count; ++i)
+        Textures.erase(textures[i]);
+}
+
+void glBindTexture(GLenum, GLuint texture) { BoundTexture = texture; }
+void glTexParameteri(GLenum, GLenum, GLint) {}
+void glPixelStorei(GLenum, GLint) {}
+
+void glTexImage2D(GLenum, GLint, GLint, GLsizei width, GLsizei height, GLint,
+                  GLenum format, GLenum, const GLvoid* pixels)
+{
+    MockTexture& texture = Textures[BoundTexture];
+    texture.Width = width;
+    texture.Height = height;
+    vector<unsigned char>(width * height * GetBytesPerPixel(format)).swap(texture.Pixels);
+    ++Allocations;
+    if (pixels) {
+        memcpy(&texture.Pixels[0], pixels, texture.Pixels.size());
+        CopiedBytes += texture.Pixels.size();
+        ++Uploads;
+    }
+}
+
+void glTexSubImage2D(GLenum, GLint, GLint x, GLint y, GLsizei width, GLsizei height,
+                     GLenum format, GLenum, const GLvoid* pixels)
+{
+    MockTexture& texture = Textures[BoundTexture];
+    int bytesPerPixel = GetBytesPerPixel(format);
+    for (int row = 0; row < height; ++row)
+        memcpy(&texture.Pixels[((y + row) * texture.Width + x) * bytesPerPixel],
+               (const unsigned char*) pixels + row * width * bytesPerPixel,
+               width * bytesPerPixel);
+    CopiedBytes += (double) width * height * bytesPerPixel;
+    ++Uploads;
+}
+
+}
+
+static void SleepUntil(uint64_t deadline)
+{
+    for (;;) {
+        uint64_t now = GetMonotonicNanoseconds();
+        if (now >= deadline)
+            return;
+        timespec wait;
+        wait.tv_sec = (time_t) ((deadline - now) / 1000000000u);
+        wait.tv_nsec = (long) ((deadline - now) % 1000000000u);
+        nanosleep(&wait, 0);
+    }
+}
+
+// Stands in for the camera writing a frame, with its sequence number in
+// every word so a torn frame would show.
+static void FillFrame(unsigned char* pixels, int byteCount, unsigned int sequence)
+{
+    unsigned int* words = (unsigned int*) pixels;
+    for (int i = 0; i < byteCount / 4; ++i)
+        words[i] = sequence;
+}
+
+static bool IsWholeFrame(const unsigned char* pixels, int byteCount, unsigned int sequence)
+{
+    const unsigned int* words = (const unsigned int*) pixels;
+    for (int i = 0; i < byteCount / 4; ++i)
+        if (words[i] != sequence)
+            return false;
+    return true;
+}
+
+// The path being replaced: one shared frame behind a mutex.
+struct LockedFrame {
+    LockedFrame(int byteCount) :
+        Pixels(byteCount), Sequence(0), Timestamp(0), Fresh(false), Published(0), Dropped(0)
+    {
+        pthread_mutex_init(&Mutex, 0);
+    }
+    ~LockedFrame() { pthread_mutex_destroy(&Mutex); }
+    pthread_mutex_t Mutex;
+    vector<unsigned char> Pixels;
+    unsigned int Sequence;
+    uint64_t Timestamp;
+    bool Fresh;
+    unsigned int Published;
+    unsigned int Dropped;
+};
+
+struct ProducerContext {
+    FrameQueue* Queue;
+    LockedFrame* Locked;
+    int ByteCount;
+    uint64_t Start;
+    uint64_t Interval;
+    int Done;
+    uint64_t LongestPublish;
+    double CopiedBytes;
+};
+
+static void* Produce(void* data)
+{
+    ProducerContext& context = *(ProducerContext*) data;
+    vector<unsigned char> capture(context.ByteCount);
+    for (unsigned int sequence = 1; !__sync_fetch_and_or(&context.Done, 0); ++sequence) {
+        SleepUntil(context.Start + context.Interval * sequence);
+        uint64_t captured = GetMonotonicNanoseconds();
+        if (context.Queue) {
+            FillFrame(context.Queue->GetBackFrame().Pixels, context.ByteCount, sequence);
+            uint64_t publish = GetMonotonicNanoseconds();
+            context.Queue->Publish(captured);
+            context.LongestPublish = max(context.LongestPublish,
+                                         GetMonotonicNanoseconds() - publish);
+            continue;
+        }
+        LockedFrame& locked = *context.Locked;
+        FillFrame(&capture[0], context.ByteCount, sequence);
+        uint64_t publish = GetMonotonicNanoseconds();
+        pthread_mutex_lock(&locked.Mutex);
+        memcpy(&locked.Pixels[0], &capture[0], context.ByteCount);
+        context.CopiedBytes += context.ByteCount;
+        locked.Dropped += locked.Fresh;
+        locked.Sequence = sequence;
+        locked.Timestamp = captured;
+        locked.Fresh = true;
+        ++locked.Published;
+        pthread_mutex_unlock(&locked.Mutex);
+        context.LongestPublish = max(context.LongestPublish, GetMonotonicNanoseconds() - publish);
+    }
+    return 0;
+}
+
+struct StreamResult {
+    StreamResult() : Delivered(0), Published(0), Dropped(0), LongestPublish(0),
+                     CopiesPerFrame(0), AllocationsPerFrame(0), Torn(0) {}
+    vector<double> Latencies;   // milliseconds
+    int Delivered;
+    unsigned int Published;
+    unsigned int Dropped;
+    double LongestPublish;
+    double CopiesPerFrame;
+    double AllocationsPerFrame;
+    int Torn;
+};
+
+static StreamResult Stream(const BenchmarkOptions& options, bool lockFree)
+{
+    int byteCount = options.Width * options.Height * 4;
+    FrameQueue queue(byteCount);
+    LockedFrame locked(byteCount);
+    StreamingTexture texture;
+    GLuint lockedTexture = 0;
+    vector<unsigned char> staging(byteCount);
+    if (lockFree)
+        texture.Create(options.Width, options.Height, GL_RGBA);
+    else
+        glGenTextures(1, &lockedTexture);
+
+    Allocations = Uploads = 0;
+    CopiedBytes = 0;
+    ProducerContext context;
+    context.Queue = lockFree ? &queue : 0;
+    context.Locked = &locked;
+    context.ByteCount = byteCount;
+    // The camera's clock isn't locked to the display's, so start it a
+    // quarter of a frame off rather than racing the consumer's ticks.
+    uint64_t interval = 1000000000u / options.ConsumerRate;
+    uint64_t start = GetMonotonicNanoseconds();
+    context.Start = start + interval / 4;
+    context.Interval = 1000000000u / options.ProducerRate;
+    context.Done = 0;
+    context.LongestPublish = 0;
+    context.CopiedBytes = 0;
+    pthread_t producer;
+    pthread_create(&producer, 0, Produce, &context);
+
+    StreamResult result;
+    for (int frame = 1; frame <= options.FrameCount; ++frame) {
+        SleepUntil(start + interval * frame);
+        if (lockFree) {
+            const StreamFrame* streamed = texture.Update(queue);
+            if (!streamed)
+                continue;
+            result.Latencies.push_back((GetMonotonicNanoseconds() - streamed->Timestamp) / 1e6);
+            result.Torn += !IsWholeFrame(&Textures[texture.GetTexture()].Pixels[0], byteCount,
+                                         streamed->Sequence);
+            continue;
+        }
+        pthread_mutex_lock(&locked.Mutex);
+        bool fresh = locked.Fresh;
+        unsigned int sequence = locked.Sequence;
+        uint64_t timestamp = locked.Timestamp;
+        if (fresh) {
+            memcpy(&staging[0], &locked.Pixels[0], byteCount);
+            CopiedBytes += byteCount;
+            locked.Fresh = false;
+        }
+        pthread_mutex_unlock(&locked.Mutex);
+        if (!fresh)
+            continue;
+        glBindTexture(GL_TEXTURE_2D, lockedTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, options.Width, options.Height, 0,
+                     GL_RGBA, GL_UNSIGNED_BYTE, &staging[0]);
+        result.Latencies.push_back((GetMonotonicNanoseconds() - timestamp) / 1e6);
+        result.Torn += !IsWholeFrame(&Textures[lockedTexture].Pixels[0], byteCount, sequence);
+    }
+    __sync_lock_test_and_set(&context.Done, 1);
+    pthread_join(producer, 0);
+
+    result.Delivered = (int) result.Latencies.size();
+    result.Published = lockFree ? queue.GetPublishedCount() : locked.Published;
+    result.Dropped = lockFree ? queue.GetDroppedCount() : locked.Dropped;
+    result.LongestPublish = context.LongestPublish / 1e6;
+    if (result.Delivered) {
+        result.CopiesPerFrame = (CopiedBytes + context.CopiedBytes) / byteCount / result.Delivered;
+        result.AllocationsPerFrame = (double) Allocations / result.Delivered;
+    }
+    if (lockFree)
+        texture.Destroy();
+    else
+        glDeleteTextures(1, &lockedTexture);
+    return result;
+}
+
+static void PrintResult(const char* name, StreamResult& result)
+{
+    vector<double>& latencies = result.Latencies;
+    sort(latencies.begin(), latencies.end());
+    double sum = 0;
+    for (size_t i = 0; i < latencies.size(); ++i)
+        sum += latencies[i];
+    size_t count = latencies.size();
+    printf("%s\n", name);
+    printf("  frames delivered     %d of %u published, %u dropped\n",
+           result.Delivered, result.Published, result.Dropped);
+    if (count)
+        printf("  latency              %.2f ms mean, %.2f median, %.2f 99th percentile, %.2f max\n",
+               sum / count, latencies[count / 2], latencies[min(count - 1, count * 99 / 100)],
+               latencies[count - 1]);
+    printf("  copies per frame     %.2f\n", result.CopiesPerFrame);
+    printf("  allocations          %.2f per frame\n", result.AllocationsPerFrame);
+    printf("  longest publish      %.3f ms\n", result.LongestPublish);
+    if (result.Torn)
+        printf("  torn frames          %d\n", result.Torn);
+}
+
+static int Report(const BenchmarkOptions& options)
+{
+    printf("%dx%d RGBA frames, produced at %d fps, rendered at %d fps, %d frames each\n\n",
+           options.Width, options.Height, options.ProducerRate, options.ConsumerRate,
+           options.FrameCount);
+    StreamResult locked = Stream(options, false);
+    PrintResult("Mutex, copy in and out, glTexImage2D", locked);
+    printf("\n");
+    StreamResult ring = Stream(options, true);
+    PrintResult("FrameQueue, three textures, glTexSubImage2D", ring);
+    return locked.Torn || ring.Torn;
+}
+
+struct StressContext {
+    FrameQueue* Queue;
+    int FrameCount;
+};
+
+static void* ProduceFast(void* data)
+{
+    StressContext& context = *(StressContext*) data;
+    FrameQueue& queue = *context.Queue;
+    for (int i = 1; i <= context.FrameCount; ++i) {
+        FillFrame(queue.GetBackFrame().Pixels, queue.GetByteCount(), i);
+        queue.Publish(i);
+    }
+    return 0;
+}
+
+static int Verify(const BenchmarkOptions& options)
+{
+    int failures = 0;
+
+    // One thread, against a model of what each call should do.
+    {
+        FrameQueue queue(64);
+        if (queue.Acquire()) {
+            printf("An empty queue handed out a frame.\n");
+            ++failures;
+        }
+        srand(1);
+        unsigned int newest = 0, taken = 0, dropped = 0;
+        const unsigned char* front = 0;
+        for (int i = 0; i < 100000; ++i) {
+            if (rand() % 2) {
+                StreamFrame& back = queue.GetBackFrame();
+                if (back.Pixels == front) {
+                    printf("The producer got the buffer the consumer is reading.\n");
+                    ++failures;
+                    break;
+                }
+                FillFrame(back.Pixels, 64, ++newest);
+                queue.Publish(newest);
+                continue;
+            }
+            const StreamFrame* frame = queue.Acquire();
+            if (frame) {
+                if (frame->Sequence != newest || !IsWholeFrame(frame->Pixels, 64, newest)) {
+                    printf("Got frame %u, not the newest, %u.\n", frame->Sequence, newest);
+                    ++failures;
+                    break;
+                }
+                dropped += frame->Sequence - taken - 1;
+                taken = frame->Sequence;
+                front = frame->Pixels;
+            } else if (taken != newest) {
+                printf("Frame %u was waiting, but Acquire returned nothing.\n", newest);
+                ++failures;
+                break;
+            }
+        }
+        if (queue.Acquire())
+            dropped += queue.GetPublishedCount() - taken - 1;
+        if (queue.GetDroppedCount() != dropped || queue.GetPublishedCount() != newest) {
+            printf("The queue counted %u dropped of %u, not %u of %u.\n",
+                   queue.GetDroppedCount(), queue.GetPublishedCount(), dropped, newest);
+            ++failures;
+        }
+    }
+
+    // Two threads, as fast as they go, with the consumer dawdling now and
+    // then so the producer laps it.
+    for (int size = 4; size <= 4096; size *= 8) {
+        FrameQueue queue(size);
+        StressContext context;
+        context.Queue = &queue;
+        context.FrameCount = options.StreamCount;
+        pthread_t producer;
+        pthread_create(&producer, 0, ProduceFast, &context);
+        unsigned int last = 0, delivered = 0;
+        volatile unsigned int sink = 0;
+        while (last != (unsigned int) options.StreamCount) {
+            const StreamFrame* frame = queue.Acquire();
+            if (!frame)
+                continue;
+            if (frame->Sequence <= last || !IsWholeFrame(frame->Pixels, size, frame->Sequence)) {
+                printf("%d-byte frames: got frame %u after %u, %s.\n", size, frame->Sequence,
+                       last, IsWholeFrame(frame->Pixels, size, frame->Sequence) ? "whole" : "torn");
+                ++failures;
+                break;
+            }
+            last = frame->Sequence;
+            ++delivered;
+            for (int spin = rand() % 64; spin > 0; --spin)
+                sink = sink + spin;
+        }
+        pthread_join(producer, 0);
+        if (delivered + queue.GetDroppedCount() != queue.GetPublishedCount()) {
+            printf("%d-byte frames: %u delivered and %u dropped of %u.\n", size, delivered,
+                   queue.GetDroppedCount(), queue.GetPublishedCount());
+            ++failures;
+        }
+    }
+
+    // The ring allocates once, uploads only when there's a frame, and never
+    // writes the texture that's being drawn with or the one before it.
+    {
+        const int Width = 8, Height = 4, ByteCount = Width * Height * 4;
+        FrameQueue queue(ByteCount);
+        StreamingTexture texture;
+        Allocations = Uploads = 0;
+        texture.Create(Width, Height, GL_RGBA);
+        if (Allocations != 3 || texture.GetTexture()) {
+            printf("Creating the ring made %d allocations.\n", Allocations);
+            ++failures;
+        }
+        GLuint drawn = 0, before = 0;
+        unsigned int newest = 0;
+        for (int i = 0; i < 10000; ++i) {
+            if (rand() % 3) {
+                FillFrame(queue.GetBackFrame().Pixels, ByteCount, ++newest);
+                queue.Publish(0);
+            }
+            int uploads = Uploads;
+            const StreamFrame* frame = texture.Update(queue);
+            GLuint current = texture.GetTexture();
+            if (!frame) {
+                if (Uploads != uploads || current != drawn) {
+                    printf("An update with no frame changed the texture.\n");
+                    ++failures;
+                    break;
+                }
+                continue;
+            }
+            if (current == drawn || current == before || frame->Sequence != newest ||
+                !IsWholeFrame(&Textures[current].Pixels[0], ByteCount, newest)) {
+                printf("Frame %u went into texture %u after %u and %u.\n", frame->Sequence,
+                       current, drawn, before);
+                ++failures;
+                break;
+            }
+            before = drawn;
+            drawn = current;
+        }
+        if (Allocations != 3) {
+            printf("The ring reallocated %d times.\n", Allocations - 3);
+            ++failures;
+        }
+        texture.Destroy();
+    }
+
+    if (failures)
+        return 1;
+    printf("Every check passed\n");
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options = ParseOptions(argc, argv);
+    if (options.Verify)
+        return Verify(options);
+    return Report(options);
+}
@@ -0,0 +1,329 @@
+// TemporalAccumulationCheck runs Trefoil.Jitter's progressive antialiasing
+// on the CPU.  It point-samples an edge test scene at the sample's jitter
+// offsets, blends the samples into an 8-bit history the way the GL blend
+// does, and reports how far each frame's history is from a densely
+// supersampled reference, next to the 8 samples a frame the sample used to
+// render.  With -verify it checks the accumulator and the blend math.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o TemporalAccumulationCheck TemporalAccumulationCheck.cpp
+//
+// Usage:
+//
+//     TemporalAccumulationCheck [options]
+//
+//     -s WxH        image size (default 128x128)
+//     -l limit      history limit, for the trail a moving edge leaves (default 4)
+//     -verify       check the accumulator and the blend math
+
+#include "../Classes/TemporalAccumulator.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct CheckOptions {
+    CheckOptions() : Width(128), Height(128), HistoryLimit(4), Verify(false) {}
+    int Width;
+    int Height;
+    int HistoryLimit;
+    bool Verify;
+};
+
+static void Usage()
+{
+    printf("Usage: TemporalAccumulationCheck [options]\n"
+           "  -s WxH        image size\n"
+           "  -l limit      history limit for the moving edge\n"
+           "  -verify       check the accumulator and the blend math\n");
+    exit(1);
+}
+
+static CheckOptions ParseOptions(int argc, char** argv)
+{
+    CheckOptions options;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-s" && hasValue) {
+            if (sscanf(argv[++i], "%dx%d", &options.Width, &options.Height) != 2)
+                Usage();
+        } else if (arg == "-l" && hasValue)
+            options.HistoryLimit = atoi(argv[++i]);
+        else if (arg == "-verify")
+            options.Verify = true;
+        else
+            Usage();
+    }
+
+    if (options.Width < 1 || options.Height < 1 || options.HistoryLimit < 1)
+        Usage();
+    return options;
+}
+
+// Trefoil.Jitter's JitterOffsets8 and JitterOffsets16.
+static const float JitterOffsets8[8][2] = {
+    { 0.5625f, 0.4375f }, { 0.0625f, 0.9375f }, { 0.3125f, 0.6875f }, { 0.6875f, 0.8125f },
+    { 0.8125f, 0.1875f }, { 0.9375f, 0.5625f }, { 0.4375f, 0.0625f }, { 0.1875f, 0.3125f },
+};
+
+static const float JitterOffsets16[16][2] = {
+    { 0.375f, 0.4375f }, { 0.625f, 0.0625f }, { 0.875f, 0.1875f }, { 0.125f, 0.0625f },
+    { 0.375f, 0.6875f }, { 0.875f, 0.4375f }, { 0.625f, 0.5625f }, { 0.375f, 0.9375f },
+    { 0.625f, 0.3125f }, { 0.125f, 0.5625f }, { 0.125f, 0.8125f }, { 0.375f, 0.1875f },
+    { 0.875f, 0.9375f }, { 0.875f, 0.6875f }, { 0.125f, 0.3125f }, { 0.625f, 0.8125f },
+};
+
+typedef vector<unsigned char> Image;
+
+// A bright disc and a thin bar on a dark background, both at angles that
+// make every edge slope alias.  Angle turns the bar, like the sample's
+// spinning object.
+static float Shade(const CheckOptions& options, float x, float y, float angle)
+{
+    float u = x / options.Width - 0.5f, v = y / options.Height - 0.5f;
+    float s = sinf(angle), c = cosf(angle);
+    float along = u * c + v * s, across = v * c - u * s;
+    if (fabsf(across) < 0.02f && fabsf(along) < 0.4f)
+        return 230;
+    if ((u - 0.15f) * (u - 0.15f) + (v + 0.1f) * (v + 0.1f) < 0.06f)
+        return 180;
+    return 20;
+}
+
+static void RenderSample(const CheckOptions& options, const float* offset, float angle,
+                         Image& image)
+{
+    image.resize(options.Width * options.Height);
+    for (int y = 0; y < options.Height; ++y)
+        for (int x = 0; x < options.Width; ++x)
+            image[y * options.Width + x] =
+                (unsigned char) Shade(options, x + offset[0], y + offset[1], angle);
+}
+
+static vector<double> RenderReference(const CheckOptions& options, float angle)
+{
+    const int Grid = 32;
+    vector<double> reference(options.Width * options.Height);
+    for (int y = 0; y < options.Height; ++y)
+        for (int x = 0; x < options.Width; ++x) {
+            double sum = 0;
+            for (int j = 0; j < Grid; ++j)
+                for (int i = 0; i < Grid; ++i)
+                    sum += Shade(options, x + (i + 0.5f) / Grid, y + (j + 0.5f) / Grid, angle);
+            reference[y * options.Width + x] = sum / (Grid * Grid);
+        }
+    return reference;
+}
+
+// The root mean square difference in 8-bit steps.
+static double GetError(const Image& image, const vector<double>& reference)
+{
+    double sum = 0;
+    for (size_t i = 0; i < image.size(); ++i)
+        sum += (image[i] - reference[i]) * (image[i] - reference[i]);
+    return sqrt(sum / image.size());
+}
+
+// What the sample did before: glColor4f(1 / 8) and additive blending into a
+// cleared buffer, so each sample gets scaled and rounded on its own.
+static void RenderClassic(const CheckOptions& options, float angle, Image& result)
+{
+    Image sample;
+    result.assign(options.Width * options.Height, 0);
+    int scale = (int) (255.0f / 8 + 0.5f);
+    for (int s = 0; s < 8; ++s) {
+        RenderSample(options, JitterOffsets8[s], angle, sample);
+        for (size_t i = 0; i < result.size(); ++i) {
+            int sum = result[i] + (sample[i] * scale + 127) / 255;
+            result[i] = (unsigned char) (sum > 255 ? 255 : sum);
+        }
+    }
+}
+
+static int Report(const CheckOptions& options)
+{
+    const float Angle = 0.3f;
+    vector<double> reference = RenderReference(options, Angle);
+    Image classic, sample;
+    RenderClassic(options, Angle, classic);
+    printf("A still scene, against a %dx%d supersampled reference\n\n", 32, 32);
+    printf("  8 samples every frame:  rms %.2f\n\n", GetError(classic, reference));
+    printf("  frame  samples rendered  rms\n");
+
+    TemporalAccumulator accumulator(16);
+    Image history(options.Width * options.Height, 0);
+    for (int frame = 1; frame <= 20; ++frame) {
+        int rendered = 0;
+        if (!accumulator.IsConverged()) {
+            RenderSample(options, JitterOffsets16[accumulator.GetSampleIndex()], Angle, sample);
+            BlendTemporalSample(&history[0], &sample[0], (int) sample.size(),
+                                accumulator.GetWeight());
+            accumulator.Advance();
+            rendered = 1;
+        }
+        printf("  %-6d %-17d %.2f\n", frame, rendered, GetError(history, reference));
+    }
+
+    // The bar turns a little each frame while the history carries over.
+    printf("\nThe bar turning 0.5 degrees a frame, with a history limit of %d\n\n",
+           options.HistoryLimit);
+    printf("  frame  progressive rms  8 a frame rms\n");
+    TemporalAccumulator decaying(16, options.HistoryLimit);
+    history.assign(options.Width * options.Height, 0);
+    for (int frame = 1; frame <= 12; ++frame) {
+        float angle = Angle + frame * 0.5f * 3.14159265f / 180;
+        decaying.Decay();
+        RenderSample(options, JitterOffsets16[decaying.GetSampleIndex()], angle, sample);
+        BlendTemporalSample(&history[0], &sample[0], (int) sample.size(), decaying.GetWeight());
+        decaying.Advance();
+        vector<double> moved = RenderReference(options, angle);
+        RenderClassic(options, angle, classic);
+        printf("  %-6d %-16.2f %.2f\n", frame, GetError(history, moved),
+               GetError(classic, moved));
+    }
+    return 0;
+}
+
+static int Verify(const CheckOptions& options)
+{
+    srand(1);
+    int failures = 0;
+
+    // A history blended in float with the accumulator's weights is the
+    // plain mean, however many samples it holds.
+    TemporalAccumulator accumulator(16);
+    double mean = 0, sum = 0;
+    for (int n = 1; n <= 16; ++n) {
+        double value = rand() % 256;
+        double weight = accumulator.GetWeight();
+        mean = value * weight + mean * (1 - weight);
+        sum += value;
+        accumulator.Advance();
+        if (fabs(mean - sum / n) > 1e-4) {
+            printf("The float history isn't the mean after %d samples.\n", n);
+            ++failures;
+        }
+    }
+
+    // Converged after every sample, and rendering more changes nothing.
+    if (!accumulator.IsConverged() || accumulator.GetCount() != 16) {
+        printf("The accumulator isn't converged after 16 samples.\n");
+        ++failures;
+    }
+    accumulator.Advance();
+    if (accumulator.GetCount() != 16) {
+        printf("The accumulator counts past its sample count.\n");
+        ++failures;
+    }
+
+    // A reset starts from the first sample with a weight of 1, which
+    // replaces the history outright.
+    accumulator.Reset();
+    unsigned char history = 200, sample = 17;
+    BlendTemporalSample(&history, &sample, 1, accumulator.GetWeight());
+    if (accumulator.GetSampleIndex() != 0 || accumulator.IsConverged() || history != 17) {
+        printf("A reset doesn't start over.\n");
+        ++failures;
+    }
+
+    // Samples visit every offset once before repeating.
+    vector<int> visits(16, 0);
+    for (int i = 0; i < 16; ++i) {
+        ++visits[accumulator.GetSampleIndex()];
+        accumulator.Advance();
+    }
+    for (int i = 0; i < 16; ++i)
+        if (visits[i] != 1) {
+            printf("Sample %d was visited %d times in 16 frames.\n", i, visits[i]);
+            ++failures;
+        }
+
+    // Decaying keeps the newest sample's weight at 1 / (limit + 1) or more,
+    // and without a limit it's a reset.
+    TemporalAccumulator decaying(16, 4);
+    for (int i = 0; i < 40; ++i) {
+        if (i % 3 == 0)
+            decaying.Decay();
+        if (i % 3 == 0 && decaying.GetWeight() < 1.0f / 5 - 1e-6f) {
+            printf("A decayed history outweighs its limit.\n");
+            ++failures;
+            break;
+        }
+        decaying.Advance();
+    }
+    TemporalAccumulator unlimited(16);
+    unlimited.Advance();
+    unlimited.Advance();
+    unlimited.Decay();
+    if (unlimited.GetCount() != 0 || unlimited.GetSampleIndex() != 0) {
+        printf("Decay without a history limit isn't a reset.\n");
+        ++failures;
+    }
+
+    // The 8-bit blend stays near the exact mean of the samples.  It can't
+    // match it, since each step rounds, and a sample within a few steps of
+    // the history moves it by less than half a step at 1 / 16.
+    int worst = 0;
+    double errorSum = 0;
+    const int Trials = 20000;
+    for (int t = 0; t < Trials; ++t) {
+        TemporalAccumulator trial(16);
+        unsigned char value = 0;
+        int total = 0, center = rand() % 256, spread = 1 + rand() % 128;
+        for (int n = 0; n < 16; ++n) {
+            int s = center + rand() % (2 * spread + 1) - spread;
+            unsigned char sample = (unsigned char) (s < 0 ? 0 : s > 255 ? 255 : s);
+            total += sample;
+            BlendTemporalSample(&value, &sample, 1, trial.GetWeight());
+            trial.Advance();
+        }
+        double error = fabs(value - total / 16.0);
+        errorSum += error;
+        if (error > worst)
+            worst = (int) ceil(error);
+    }
+    printf("8-bit history against the exact mean of 16 samples: mean %.2f, worst %d steps\n",
+           errorSum / Trials, worst);
+    if (worst > 8) {
+        printf("The 8-bit history drifts further than the rounding explains.\n");
+        ++failures;
+    }
+
+    // And on the edge scene, 16 progressive samples beat 8 in one frame.
+    const float Angle = 0.3f;
+    vector<double> reference = RenderReference(options, Angle);
+    Image classic, image, progressive(options.Width * options.Height, 0);
+    RenderClassic(options, Angle, classic);
+    TemporalAccumulator still(16);
+    while (!still.IsConverged()) {
+        RenderSample(options, JitterOffsets16[still.GetSampleIndex()], Angle, image);
+        BlendTemporalSample(&progressive[0], &image[0], (int) image.size(), still.GetWeight());
+        still.Advance();
+    }
+    double classicError = GetError(classic, reference);
+    double progressiveError = GetError(progressive, reference);
+    printf("Edge scene rms: 8 a frame %.2f, 16 progressive %.2f\n", classicError,
+           progressiveError);
+    if (progressiveError >= classicError) {
+        printf("16 progressive samples are no closer than 8 in one frame.\n");
+        ++failures;
+    }
+
+    if (failures)
+        return 1;
+    printf("Every check passed\n");
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    CheckOptions options = ParseOptions(argc, argv);
+    if (options.Verify)
+        return Verify(options);
+    return Report(options);
+}
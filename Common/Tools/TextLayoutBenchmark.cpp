@@ -0,0 +1,194 @@
+// TextLayoutBenchmark measures the throughput of TextLayout.hpp, in glyphs
+// per second, with FreeType providing metrics and kerning.  The glyph
+// cache is warmed up first, so rasterization is left out of the timings.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o TextLayoutBenchmark TextLayoutBenchmark.cpp
+//         `pkg-config --cflags --libs freetype2`
+//
+// Usage:
+//
+//     TextLayoutBenchmark [options] font.ttf [text.txt]
+//
+//     -p size       font size in pixels (default 20)
+//     -w width      wrapping width in pixels (default 320)
+//     -t seconds    minimum time for each case (default 0.5)
+//
+// Without a text file, the paragraphs are made up of random words.
+
+#include "../Classes/FreeTypeRasterizer.hpp"
+#include "../Classes/TextLayout.hpp"
+#include <sys/time.h>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct BenchmarkOptions {
+    BenchmarkOptions() : FontSize(20), Width(320), Seconds(0.5) {}
+    string Font;
+    string Text;
+    int FontSize;
+    int Width;
+    double Seconds;
+};
+
+static void Usage()
+{
+    printf("Usage: TextLayoutBenchmark [options] font.ttf [text.txt]\n"
+           "  -p size       font size in pixels\n"
+           "  -w width      wrapping width in pixels\n"
+           "  -t seconds    minimum time for each case\n");
+    exit(1);
+}
+
+static BenchmarkOptions ParseOptions(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    vector<string> files;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-p" && hasValue)
+            options.FontSize = atoi(argv[++i]);
+        else if (arg == "-w" && hasValue)
+            options.Width = atoi(argv[++i]);
+        else if (arg == "-t" && hasValue)
+            options.Seconds = atof(argv[++i]);
+        else if (arg[0] == '-')
+            Usage();
+        else
+            files.push_back(arg);
+    }
+
+    if (files.empty() || files.size() > 2 || options.FontSize < 1 || options.Width < 1 ||
+        options.Seconds <= 0)
+        Usage();
+    options.Font = files[0];
+    if (files.size() == 2)
+        options.Text = files[1];
+    return options;
+}
+
+static double GetSeconds()
+{
+    timeval now;
+    gettimeofday(&now, 0);
+    return now.tv_sec + now.tv_usec * 1e-6;
+}
+
+// Forty paragraphs of five lines' worth of words, in mixed case so that
+// kerning pairs like "Wa" and "To" come up.
+static void MakeParagraphs(vector<string>& paragraphs)
+{
+    srand(1);
+    for (int i = 0; i < 40; ++i) {
+        string paragraph;
+        for (int word = 0; word < 40; ++word) {
+            if (word)
+                paragraph += ' ';
+            int length = 1 + rand() % 9;
+            for (int letter = 0; letter < length; ++letter) {
+                int a = rand() % 26, b = rand() % 26;
+                char base = letter == 0 && rand() % 4 == 0 ? 'A' : 'a';
+                paragraph += (char) (base + min(a, b));
+            }
+        }
+        paragraphs.push_back(paragraph);
+    }
+}
+
+struct BenchmarkCase {
+    const char* Name;
+    int MaxWidth;
+    TextAlignment Alignment;
+    bool Kerning;
+    int Capacity;
+};
+
+// Lays the paragraphs out over and over for at least the given time, and
+// returns glyphs per second.
+static double Run(GlyphCache& cache, const vector<string>& paragraphs,
+                  const BenchmarkCase& test, double seconds, int* lineCount)
+{
+    TextLayout layout(test.Capacity);
+    TextStyle style;
+    style.MaxWidth = test.MaxWidth;
+    style.Alignment = test.Alignment;
+    style.Kerning = test.Kerning;
+
+    long long glyphs = 0;
+    double start = GetSeconds(), elapsed = 0;
+    do {
+        *lineCount = 0;
+        for (size_t i = 0; i < paragraphs.size(); ++i) {
+            cache.BeginFrame();
+            const TextRun& run = layout.Layout(cache, paragraphs[i], style);
+            glyphs += run.Glyphs.size();
+            *lineCount += run.LineCount;
+        }
+        elapsed = GetSeconds() - start;
+    } while (elapsed < seconds);
+    return glyphs / elapsed;
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options = ParseOptions(argc, argv);
+
+    FreeTypeRasterizer rasterizer(options.Font.c_str(), options.FontSize);
+    if (!rasterizer.IsValid()) {
+        printf("Unable to load %s.\n", options.Font.c_str());
+        return 1;
+    }
+
+    vector<string> paragraphs;
+    if (options.Text.empty()) {
+        MakeParagraphs(paragraphs);
+    } else {
+        ifstream file(options.Text.c_str());
+        string line;
+        while (getline(file, line))
+            if (!line.empty())
+                paragraphs.push_back(line);
+        if (paragraphs.empty()) {
+            printf("No text in %s.\n", options.Text.c_str());
+            return 1;
+        }
+    }
+
+    // A big atlas, filled up front, keeps rasterization out of the way.
+    GlyphCache cache(&rasterizer, 1024, 1024);
+    TextLayout warmup(0);
+    for (size_t i = 0; i < paragraphs.size(); ++i)
+        warmup.Layout(cache, paragraphs[i]);
+
+    // The kept runs only cover static text when there's room for all of it.
+    int capacity = (int) paragraphs.size();
+    int w = options.Width;
+    const BenchmarkCase Cases[] = {
+        { "single line", 0, TextAlignmentLeft, false, 0 },
+        { "single line, kerned", 0, TextAlignmentLeft, true, 0 },
+        { "wrapped", w, TextAlignmentLeft, false, 0 },
+        { "wrapped, kerned", w, TextAlignmentLeft, true, 0 },
+        { "wrapped, kerned, centered", w, TextAlignmentCenter, true, 0 },
+        { "wrapped, kerned, kept", w, TextAlignmentLeft, true, capacity },
+    };
+
+    printf("%d paragraphs, %d px, wrapping at %d px\n", (int) paragraphs.size(),
+           options.FontSize, w);
+    for (size_t i = 0; i < sizeof(Cases) / sizeof(Cases[0]); ++i) {
+        int lineCount;
+        double rate = Run(cache, paragraphs, Cases[i], options.Seconds, &lineCount);
+        printf("  %-28s %8.2f M glyphs/s  %5d lines\n", Cases[i].Name, rate * 1e-6,
+               lineCount);
+    }
+
+    const GlyphCacheStats& stats = cache.GetStats();
+    printf("%d glyphs in the atlas, %d evictions\n", cache.GetGlyphCount(), stats.Evictions);
+    return 0;
+}
@@ -0,0 +1,448 @@
+// TextureCooker converts PNG or raw RGBA images into mipmapped PVR textures
+// that PvrTexture::Parse and UploadPvrTexture consume directly, so nothing
+// has to be filtered or converted at startup.  It replaces the PVRTexTool
+// invocations in the Generate.py scripts.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o TextureCooker TextureCooker.cpp -lpng -lpthread
+//
+// Usage:
+//
+//     TextureCooker [options] input.png output.pvr
+//     TextureCooker [options] input.png output.h     (C header, like PVRTexTool -h)
+//
+//     -f format    565, 4444, 5551, 88, 8, 888, 8888, pvrtc2, pvrtc4, etc1, or
+//                  etc2 (default 8888).  A comma-separated list writes a texture
+//                  set with one entry per format, in order of preference; end
+//                  it with an uncompressed format so every GPU has a fallback.
+//                  etc2 becomes ETC2 RGBA if the image has any alpha.
+//     -m filter    none, box, or kaiser (default box)
+//     -d           ordered dithering
+//     -linear      texels are data, not sRGB colors (normal maps, distance fields)
+//     -wrap        wrap around the edges while filtering (tiling textures)
+//     -alpha       take the 8-bit intensity from alpha instead of luminance
+//     -noflip      keep rows top-down instead of OpenGL's bottom-up order
+//     -raw WxH     the input is headerless 8-bit RGBA of the given size
+//     -n name      array name for C headers (default: the output's base name)
+//     -pot         resample to the next power of two first
+//     -q quality   PVRTC refinement rounds, 0 (fastest) to 8 (default 2), or
+//                  ETC search effort, 0 to 2 (default 1)
+//     -j threads   encoder threads (default: one per processor)
+//     -stats       print PSNR and encoding speed for each compressed level
+
+#include "../Classes/EtcCodec.hpp"
+#include "../Classes/MipChain.hpp"
+#include "../Classes/PixelConverter.hpp"
+#include "../Classes/PvrWriter.hpp"
+#include "../Classes/PvrtcCodec.hpp"
+#include "../Classes/TextureSet.hpp"
+#include <png.h>
+#include <sys/time.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct CookerOptions {
+    CookerOptions() : Filter(MipFilterBox),
+                      Wrap(false), Flip(true), PowerOfTwo(false), Stats(false),
+                      RawWidth(0), RawHeight(0), Quality(-1),
+                      Threads(GetProcessorCount()) {}
+    vector<PvrPixelType> Formats;
+    MipFilter Filter;
+    ConvertOptions Convert;
+    bool Wrap;
+    bool Flip;
+    bool PowerOfTwo;
+    bool Stats;
+    int RawWidth;
+    int RawHeight;
+    int Quality;    // -1 picks each encoder's default
+    int Threads;
+    string Name;
+    string Input;
+    string Output;
+};
+
+static void Usage()
+{
+    printf("Usage: TextureCooker [options] input.png output.pvr|output.h\n"
+           "  -f formats  565, 4444, 5551, 88, 8, 888, 8888, pvrtc2, pvrtc4,\n"
+           "              etc1, or etc2; a comma-separated list makes a set\n"
+           "  -m filter   none, box, or kaiser\n"
+           "  -d          ordered dithering\n"
+           "  -linear     disable sRGB conversion\n"
+           "  -wrap       wrap around the edges while filtering\n"
+           "  -alpha      8-bit intensity comes from alpha\n"
+           "  -noflip     keep rows top-down\n"
+           "  -raw WxH    input is raw RGBA8\n"
+           "  -n name     array name for C headers\n"
+           "  -pot        resample to the next power of two\n"
+           "  -q quality  PVRTC rounds, 0 to 8, or ETC effort, 0 to 2\n"
+           "  -j threads  encoder threads\n"
+           "  -stats      print PSNR and encoding speed of compressed levels\n");
+    exit(1);
+}
+
+static bool ParseFormat(const string& name, PvrPixelType* format)
+{
+    static const struct {
+        const char* Name;
+        PvrPixelType Format;
+    } Formats[] = {
+        { "565", PvrPixelTypeRgb565 },
+        { "4444", PvrPixelTypeRgba4444 },
+        { "5551", PvrPixelTypeRgba5551 },
+        { "88", PvrPixelTypeAi88 },
+        { "8", PvrPixelTypeI8 },
+        { "888", PvrPixelTypeRgb888 },
+        { "8888", PvrPixelTypeRgba8888 },
+        { "pvrtc2", PvrPixelTypePvrtc2 },
+        { "pvrtc4", PvrPixelTypePvrtc4 },
+        { "etc1", PvrPixelTypeEtc1 },
+        { "etc2", PvrPixelTypeEtc2Rgb },
+    };
+    for (size_t i = 0; i < sizeof(Formats) / sizeof(Formats[0]); ++i) {
+        if (name == Formats[i].Name) {
+            *format = Formats[i].Format;
+            return true;
+        }
+    }
+    return false;
+}
+
+static CookerOptions ParseArguments(int argc, char** argv)
+{
+    CookerOptions options;
+    vector<string> files;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-f" && hasValue) {
+            string list = argv[++i];
+            options.Formats.clear();
+            for (size_t start = 0; start <= list.size(); ) {
+                size_t comma = list.find(',', start);
+                if (comma == string::npos)
+                    comma = list.size();
+                PvrPixelType format;
+                if (!ParseFormat(list.substr(start, comma - start), &format)) {
+                    printf("Unknown format %s.\n", list.substr(start, comma - start).c_str());
+                    Usage();
+                }
+                options.Formats.push_back(format);
+                start = comma + 1;
+            }
+            if (options.Formats.size() > (size_t) TextureSetMaxEntries)
+                Usage();
+        } else if (arg == "-m" && hasValue) {
+            string filter = argv[++i];
+            if (filter == "none")
+                options.Filter = MipFilterNone;
+            else if (filter == "box")
+                options.Filter = MipFilterBox;
+            else if (filter == "kaiser")
+                options.Filter = MipFilterKaiser;
+            else
+                Usage();
+        } else if (arg == "-raw" && hasValue) {
+            if (sscanf(argv[++i], "%dx%d", &options.RawWidth, &options.RawHeight) != 2)
+                Usage();
+        } else if (arg == "-n" && hasValue) {
+            options.Name = argv[++i];
+        } else if (arg == "-q" && hasValue) {
+            options.Quality = atoi(argv[++i]);
+        } else if (arg == "-j" && hasValue) {
+            options.Threads = atoi(argv[++i]);
+        } else if (arg == "-pot") {
+            options.PowerOfTwo = true;
+        } else if (arg == "-stats") {
+            options.Stats = true;
+        } else if (arg == "-d") {
+            options.Convert.Dither = true;
+        } else if (arg == "-linear") {
+            options.Convert.Srgb = false;
+        } else if (arg == "-wrap") {
+            options.Wrap = true;
+        } else if (arg == "-alpha") {
+            options.Convert.IntensityFromAlpha = true;
+        } else if (arg == "-noflip") {
+            options.Flip = false;
+        } else if (arg[0] == '-') {
+            Usage();
+        } else {
+            files.push_back(arg);
+        }
+    }
+    if (files.size() != 2)
+        Usage();
+    if (options.Formats.empty())
+        options.Formats.push_back(PvrPixelTypeRgba8888);
+
+    options.Input = files[0];
+    options.Output = files[1];
+    if (options.Name.empty()) {
+        string name = options.Output;
+        size_t slash = name.find_last_of("/\\");
+        if (slash != string::npos)
+            name = name.substr(slash + 1);
+        options.Name = name.substr(0, name.find('.'));
+    }
+    return options;
+}
+
+static bool ReadPng(const string& path, int* width, int* height, vector<unsigned char>& rgba)
+{
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&image, path.c_str())) {
+        printf("%s: %s\n", path.c_str(), image.message);
+        return false;
+    }
+    image.format = PNG_FORMAT_RGBA;
+    rgba.resize(PNG_IMAGE_SIZE(image));
+    if (!png_image_finish_read(&image, 0, &rgba[0], 0, 0)) {
+        printf("%s: %s\n", path.c_str(), image.message);
+        return false;
+    }
+    *width = image.width;
+    *height = image.height;
+    return true;
+}
+
+static bool ReadRaw(const string& path, int width, int height, vector<unsigned char>& rgba)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        printf("Unable to open %s.\n", path.c_str());
+        return false;
+    }
+    rgba.resize(width * height * 4);
+    bool ok = fread(&rgba[0], 1, rgba.size(), file) == rgba.size();
+    fclose(file);
+    if (!ok)
+        printf("%s is smaller than %dx%d RGBA.\n", path.c_str(), width, height);
+    return ok;
+}
+
+static int NextPowerOfTwo(int value)
+{
+    int result = 1;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+
+static double GetSeconds()
+{
+    timeval now;
+    gettimeofday(&now, 0);
+    return now.tv_sec + now.tv_usec * 1e-6;
+}
+
+static bool EndsWith(const string& s, const string& suffix)
+{
+    return s.size() >= suffix.size() &&
+           s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+static bool IsPvrtc(PvrPixelType format)
+{
+    return format == PvrPixelTypePvrtc2 || format == PvrPixelTypePvrtc4;
+}
+
+// Encodes every level of the chain into the writer's format.
+static void CookLevels(const CookerOptions& options, PvrPixelType format,
+                       const vector<FloatImage>& chain, PvrWriter& writer)
+{
+    PixelConverter converter(options.Convert);
+    bool pvrtc = IsPvrtc(format);
+    if (!pvrtc && !IsEtcPixelType(format)) {
+        for (size_t level = 0; level < chain.size(); ++level) {
+            vector<unsigned char> texels;
+            converter.Convert(chain[level], format, texels);
+            writer.AddLevel(texels);
+        }
+        return;
+    }
+
+    int bitsPerPixel = PvrTexture::GetBitsPerPixel(format);
+    int quality = options.Quality;
+    PvrtcEncoder pvrtcEncoder(pvrtc ? bitsPerPixel : 4,
+        quality < 0 ? PvrtcEncoder::DefaultQuality : quality, options.Threads);
+    EtcEncoder etcEncoder(format,
+        quality < 0 ? EtcEncoder::DefaultQuality : quality, options.Threads);
+
+    for (size_t level = 0; level < chain.size(); ++level) {
+        const FloatImage& image = chain[level];
+        vector<unsigned char> source, texels;
+        converter.Convert(image, PvrPixelTypeRgba8888, source);
+
+        double start = GetSeconds();
+        if (pvrtc)
+            pvrtcEncoder.Encode(&source[0], image.Width, image.Height, texels);
+        else
+            etcEncoder.Encode(&source[0], image.Width, image.Height, texels);
+        double elapsed = GetSeconds() - start;
+        writer.AddLevel(texels);
+
+        if (options.Stats) {
+            vector<unsigned char> decoded;
+            if (pvrtc)
+                DecodePvrtc(&texels[0], image.Width, image.Height, bitsPerPixel, decoded);
+            else
+                DecodeEtc(&texels[0], image.Width, image.Height, format, decoded);
+            int texelCount = image.Width * image.Height;
+            printf("  level %d: %dx%d, %.2f dB RGB, %.2f dB alpha, %.2f MPixel/s\n",
+                   (int) level, image.Width, image.Height,
+                   ComputePsnr(&source[0], &decoded[0], texelCount),
+                   ComputePsnr(&source[3], &decoded[3], texelCount, 1),
+                   texelCount / (elapsed > 0 ? elapsed : 1e-9) / 1e6);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    CookerOptions options = ParseArguments(argc, argv);
+
+    int width, height;
+    vector<unsigned char> rgba;
+    bool loaded;
+    if (options.RawWidth || options.RawHeight) {
+        width = options.RawWidth;
+        height = options.RawHeight;
+        loaded = ReadRaw(options.Input, width, height, rgba);
+    } else {
+        loaded = ReadPng(options.Input, &width, &height, rgba);
+    }
+    if (!loaded)
+        return 1;
+
+    if (width <= 0 || height <= 0 ||
+        width > PvrTexture::MaxDimension || height > PvrTexture::MaxDimension) {
+        printf("%s has invalid dimensions.\n", options.Input.c_str());
+        return 1;
+    }
+
+    FloatImage base;
+    DecodeRgba8(&rgba[0], width, height, options.Convert.Srgb, base);
+    if (options.Flip)
+        base.FlipRows();
+
+    MipGenerator generator(options.Filter, options.Wrap);
+    if (options.PowerOfTwo) {
+        FloatImage resized;
+        width = NextPowerOfTwo(width);
+        height = NextPowerOfTwo(height);
+        generator.Resample(base, width, height, resized);
+        base = resized;
+    }
+
+
+    bool alpha = false;
+    for (size_t i = 3; i < rgba.size(); i += 4)
+        alpha = alpha || rgba[i] != 255;
+
+    bool pot = !(width & (width - 1)) && !(height & (height - 1));
+    for (size_t i = 0; i < options.Formats.size(); ++i) {
+        PvrPixelType format = options.Formats[i];
+        if (IsPvrtc(format) && !pot) {
+            printf("%s is %dx%d; PVRTC needs powers of two (try -pot).\n",
+                   options.Input.c_str(), width, height);
+            return 1;
+        }
+        if (IsPvrtc(format) && width != height)
+            printf("Warning: iPhone OS only accepts square PVRTC textures.\n");
+        if (format == PvrPixelTypeEtc1 && alpha)
+            printf("Warning: ETC1 has no alpha channel; it will be dropped.\n");
+        if (format == PvrPixelTypeEtc2Rgb && alpha)
+            options.Formats[i] = PvrPixelTypeEtc2Rgba;
+    }
+    if (options.Filter != MipFilterNone && !pot)
+        printf("Warning: %s is not a power of two; ES 1.1 can't mipmap it.\n",
+               options.Input.c_str());
+
+    vector<FloatImage> chain;
+    generator.Generate(base, chain);
+
+    TextureSetWriter setWriter;
+    vector<vector<unsigned char> > containers;
+    for (size_t i = 0; i < options.Formats.size(); ++i) {
+        PvrPixelType format = options.Formats[i];
+        PvrWriter writer(format, width, height);
+        writer.SetVerticallyFlipped(options.Flip);
+        if (IsPvrtc(format))
+            writer.SetAlpha(alpha);
+        if (options.Stats && options.Formats.size() > 1)
+            printf("Entry %d:\n", (int) i);
+        CookLevels(options, format, chain, writer);
+
+        containers.push_back(vector<unsigned char>());
+        writer.Write(containers.back());
+        setWriter.AddEntry(containers.back());
+
+        if (options.Formats.size() == 1) {
+            bool written;
+            if (EndsWith(options.Output, ".h"))
+                written = writer.WriteSource(options.Output.c_str(), options.Name.c_str());
+            else
+                written = writer.WriteFile(options.Output.c_str());
+            if (!written) {
+                printf("Unable to write %s.\n", options.Output.c_str());
+                return 1;
+            }
+        }
+    }
+
+    if (options.Formats.size() > 1) {
+        bool written;
+        if (EndsWith(options.Output, ".h"))
+            written = setWriter.WriteSource(options.Output.c_str(), options.Name.c_str());
+        else
+            written = setWriter.WriteFile(options.Output.c_str());
+        if (!written) {
+            printf("Unable to write %s.\n", options.Output.c_str());
+            return 1;
+        }
+
+        // Every entry of a set must come back out of the table intact.
+        vector<unsigned char> blob;
+        setWriter.Write(blob);
+        TextureSet set;
+        if (!set.Parse(&blob[0], blob.size()) ||
+            set.GetEntryCount() != (int) containers.size()) {
+            printf("Wrote an invalid texture set.\n");
+            return 1;
+        }
+        for (int i = 0; i < set.GetEntryCount(); ++i) {
+            size_t size;
+            const void* entry = set.GetEntry(i, &size);
+            if (size != containers[i].size() || memcmp(entry, &containers[i][0], size)) {
+                printf("Wrote an invalid texture set.\n");
+                return 1;
+            }
+        }
+    }
+
+    // Read each container back the same way the samples will.
+    for (size_t i = 0; i < containers.size(); ++i) {
+        PvrTexture texture;
+        if (texture.Parse(&containers[i][0], containers[i].size()) != PvrErrorNone) {
+            printf("Wrote an invalid texture: %s\n",
+                   PvrTexture::GetErrorString(texture.GetError()));
+            return 1;
+        }
+    }
+
+    printf("%s: %dx%d, %d levels", options.Output.c_str(), width, height,
+           (int) chain.size());
+    if (containers.size() > 1)
+        printf(", %d encodings", (int) containers.size());
+    printf("\n");
+    return 0;
+}
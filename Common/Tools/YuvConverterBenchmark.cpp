@@ -0,0 +1,427 @@
+// YuvConverterBenchmark times YuvConverter.hpp turning 720p and 1080p camera
+// frames into textures: at their own size, and scaled to the power-of-two
+// sizes a texture would take, in NV12 and I420, to RGBA8 and RGB565.  Each
+// case runs with SSE2 or NEON and without, and the scaled ones against
+// converting at full size and scaling the RGBA afterwards, which is what
+// the fused pass saves.
+//
+// With -verify it checks that the SIMD paths match the scalar ones to the
+// bit, on random sizes, strides and contents, and that the scalar path stays
+// within a few steps of exact floating point area averages and BT.601.
+//
+// Build on Linux or Mac OS X with:
+//
+//     g++ -O2 -o YuvConverterBenchmark YuvConverterBenchmark.cpp
+//
+// Usage:
+//
+//     YuvConverterBenchmark [options]
+//
+//     -s WxH        time this source size only
+//     -t WxH        time this target size only
+//     -n frames     frames to time for each case (default 30)
+//     -full         full range (420f) rather than video range (420v)
+//     -verify       check the SIMD paths and the accuracy instead
+
+#include "../Classes/MonotonicClock.hpp"
+#include "../Classes/YuvConverter.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct BenchmarkOptions {
+    BenchmarkOptions() :
+        SourceWidth(0), SourceHeight(0), TargetWidth(0), TargetHeight(0), FrameCount(30),
+        FullRange(false), Verify(false) {}
+    int SourceWidth;
+    int SourceHeight;
+    int TargetWidth;
+    int TargetHeight;
+    int FrameCount;
+    bool FullRange;
+    bool Verify;
+};
+
+static void Usage()
+{
+    printf("Usage: YuvConverterBenchmark [options]\n"
+           "  -s WxH        time this source size only\n"
+           "  -t WxH        time this target size only\n"
+           "  -n frames     frames to time for each case\n"
+           "  -full         full range rather than video range\n"
+           "  -verify       check the SIMD paths and the accuracy instead\n");
+    exit(1);
+}
+
+static BenchmarkOptions ParseOptions(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-s" && hasValue) {
+            if (sscanf(argv[++i], "%dx%d", &options.SourceWidth, &options.SourceHeight) != 2)
+                Usage();
+        } else if (arg == "-t" && hasValue) {
+            if (sscanf(argv[++i], "%dx%d", &options.TargetWidth, &options.TargetHeight) != 2)
+                Usage();
+        } else if (arg == "-n" && hasValue)
+            options.FrameCount = atoi(argv[++i]);
+        else if (arg == "-full")
+            options.FullRange = true;
+        else if (arg == "-verify")
+            options.Verify = true;
+        else
+            Usage();
+    }
+
+    if (options.FrameCount < 1 || options.SourceWidth < 0 || options.SourceHeight < 0 ||
+        options.TargetWidth < 0 || options.TargetHeight < 0)
+        Usage();
+    return options;
+}
+
+// A frame with its planes in one buffer, each row padded out to the
+// stride.  Contents are smooth gradients with noise on top, like a camera
+// image, or random bytes.
+struct Frame {
+    void Resize(YuvLayout layout, int width, int height, int padding)
+    {
+        Image.Layout = layout;
+        Image.Width = width;
+        Image.Height = height;
+        int chromaWidth = (width + 1) / 2, chromaHeight = (height + 1) / 2;
+        int widths[3] = { width, chromaWidth, chromaWidth };
+        if (layout == YuvLayoutNv12)
+            widths[1] = chromaWidth * 2;
+        int heights[3] = { height, chromaHeight, layout == YuvLayoutNv12 ? 0 : chromaHeight };
+        size_t offsets[3], size = 0;
+        for (int p = 0; p < 3; ++p) {
+            Image.Strides[p] = widths[p] + padding;
+            Widths[p] = widths[p];
+            Heights[p] = heights[p];
+            offsets[p] = size;
+            size += Image.Strides[p] * heights[p];
+        }
+        Bytes.assign(size + 1, 0);
+        for (int p = 0; p < 3; ++p)
+            Image.Planes[p] = heights[p] ? &Bytes[offsets[p]] : 0;
+    }
+    unsigned char* GetRow(int plane, int y) const
+    {
+        return (unsigned char*) Image.Planes[plane] + y * Image.Strides[plane];
+    }
+    void Fill(bool random)
+    {
+        for (int p = 0; p < 3; ++p)
+            for (int y = 0; y < Heights[p]; ++y) {
+                unsigned char* row = GetRow(p, y);
+                for (int x = 0; x < Widths[p]; ++x) {
+                    int value = (x * 7 + y * 3 + p * 50) % 200 + rand() % 40;
+                    row[x] = (unsigned char) (random ? rand() % 256 : value);
+                }
+            }
+    }
+    YuvImage Image;
+    int Widths[3];
+    int Heights[3];
+    vector<unsigned char> Bytes;
+};
+
+static double Time(YuvConverter& converter, const Frame& frame, int width, int height,
+                   YuvOutput output, vector<unsigned char>& target, int frameCount)
+{
+    int bytesPerTexel = output == YuvOutputRgba8 ? 4 : 2;
+    target.resize(width * height * bytesPerTexel);
+    converter.Convert(frame.Image, width, height, output, &target[0], width * bytesPerTexel);
+    uint64_t start = GetMonotonicNanoseconds();
+    for (int i = 0; i < frameCount; ++i)
+        converter.Convert(frame.Image, width, height, output, &target[0], width * bytesPerTexel);
+    return frameCount / ((GetMonotonicNanoseconds() - start) / 1e9);
+}
+
+// Converting at full size and then box filtering the RGBA down, with the
+// same weights, as two separate passes would.
+static double TimeSeparate(YuvConverter& converter, const Frame& frame, int width, int height,
+                           vector<unsigned char>& target, int frameCount)
+{
+    const YuvImage& image = frame.Image;
+    vector<unsigned char> full(image.Width * image.Height * 4), columns(image.Width * 4);
+    target.resize(width * height * 4);
+    YuvAxis across, down;
+    across.Resize(image.Width, width);
+    down.Resize(image.Height, height);
+    uint64_t start = GetMonotonicNanoseconds();
+    for (int i = 0; i < frameCount; ++i) {
+        converter.Convert(image, image.Width, image.Height, YuvOutputRgba8, &full[0],
+                          image.Width * 4);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < image.Width * 4; ++x) {
+                unsigned int sum = 128;
+                for (int k = 0; k < down.Taps; ++k)
+                    sum += full[(down.First[y] + k) * image.Width * 4 + x] *
+                           down.Weights[y * down.Taps + k];
+                columns[x] = (unsigned char) (sum >> 8);
+            }
+            for (int x = 0; x < width; ++x)
+                for (int c = 0; c < 4; ++c) {
+                    unsigned int sum = 128;
+                    for (int k = 0; k < across.Taps; ++k)
+                        sum += columns[(across.First[x] + k) * 4 + c] *
+                               across.Weights[x * across.Taps + k];
+                    target[(y * width + x) * 4 + c] = (unsigned char) (sum >> 8);
+                }
+        }
+    }
+    return frameCount / ((GetMonotonicNanoseconds() - start) / 1e9);
+}
+
+static int Report(const BenchmarkOptions& options)
+{
+    const int Sources[2][2] = { { 1280, 720 }, { 1920, 1080 } };
+    const int Targets[3][2] = { { 0, 0 }, { 1024, 512 }, { 256, 256 } };
+    const char* Layouts[2] = { "NV12", "I420" };
+    const char* Outputs[2] = { "RGBA8", "RGB565" };
+    YuvConvertOptions simdOptions, scalarOptions;
+    simdOptions.FullRange = scalarOptions.FullRange = options.FullRange;
+    scalarOptions.Simd = false;
+    YuvConverter simd(simdOptions), scalar(scalarOptions);
+
+    printf("Frames a second, %s range, one thread\n\n", options.FullRange ? "full" : "video");
+    printf("  source     layout  target     output   scalar   SIMD     speedup  separate\n");
+    vector<unsigned char> target;
+    for (int s = 0; s < 2; ++s) {
+        int sourceWidth = options.SourceWidth ? options.SourceWidth : Sources[s][0];
+        int sourceHeight = options.SourceHeight ? options.SourceHeight : Sources[s][1];
+        if (options.SourceWidth && s)
+            break;
+        for (int l = 0; l < 2; ++l) {
+            Frame frame;
+            frame.Resize((YuvLayout) l, sourceWidth, sourceHeight, 0);
+            frame.Fill(false);
+            for (int t = 0; t < 3; ++t) {
+                int width = Targets[t][0] ? Targets[t][0] : sourceWidth;
+                int height = Targets[t][1] ? Targets[t][1] : sourceHeight;
+                if (options.TargetWidth) {
+                    if (t)
+                        break;
+                    width = options.TargetWidth;
+                    height = options.TargetHeight;
+                }
+                for (int o = 0; o < 2; ++o) {
+                    YuvOutput output = (YuvOutput) o;
+                    double slow = Time(scalar, frame, width, height, output, target,
+                                       options.FrameCount);
+                    double fast = Time(simd, frame, width, height, output, target,
+                                       options.FrameCount);
+                    char source[32], size[32];
+                    sprintf(source, "%dx%d", sourceWidth, sourceHeight);
+                    sprintf(size, "%dx%d", width, height);
+                    printf("  %-10s %-7s %-10s %-8s %-8.1f %-8.1f %-8.2f", source, Layouts[l],
+                           size, Outputs[o], slow, fast, fast / slow);
+                    bool scaled = width != sourceWidth || height != sourceHeight;
+                    if (scaled && output == YuvOutputRgba8)
+                        printf(" %.1f", TimeSeparate(simd, frame, width, height, target,
+                                                     options.FrameCount));
+                    printf("\n");
+                }
+            }
+        }
+    }
+    printf("\nSeparate converts at full size with SIMD, then box filters the RGBA.\n");
+    return 0;
+}
+
+// The exact average of a plane over the area a target texel covers, in
+// the plane's own units.
+static double AverageArea(const Frame& frame, int plane, int channel, int channels,
+                          int sourceWidth, int sourceHeight, int width, int height, int x, int y)
+{
+    double left = (double) x * sourceWidth / width, right = (double) (x + 1) * sourceWidth / width;
+    double top = (double) y * sourceHeight / height, bottom = (double) (y + 1) * sourceHeight / height;
+    double sum = 0;
+    for (int row = (int) top; row < bottom && row < sourceHeight; ++row) {
+        double rowWeight = min<double>(row + 1, bottom) - max<double>(row, top);
+        const unsigned char* texels = frame.GetRow(plane, row);
+        for (int column = (int) left; column < right && column < sourceWidth; ++column) {
+            double weight = rowWeight * (min<double>(column + 1, right) - max<double>(column, left));
+            sum += weight * texels[column * channels + channel];
+        }
+    }
+    return sum / ((right - left) * (bottom - top));
+}
+
+static void ConvertExactly(const Frame& frame, int width, int height, bool fullRange,
+                           vector<double>& rgb)
+{
+    const YuvImage& image = frame.Image;
+    int chromaWidth = (image.Width + 1) / 2, chromaHeight = (image.Height + 1) / 2;
+    bool nv12 = image.Layout == YuvLayoutNv12;
+    rgb.resize(width * height * 3);
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x) {
+            double luma = AverageArea(frame, 0, 0, 1, image.Width, image.Height, width, height, x, y);
+            double u = AverageArea(frame, 1, 0, nv12 ? 2 : 1, chromaWidth, chromaHeight,
+                                   width, height, x, y);
+            double v = AverageArea(frame, nv12 ? 1 : 2, nv12 ? 1 : 0, nv12 ? 2 : 1,
+                                   chromaWidth, chromaHeight, width, height, x, y);
+            double c = fullRange ? luma : (luma - 16) * 255 / 219;
+            double scale = fullRange ? 1 : 255.0 / 224;
+            double d = (u - 128) * scale, e = (v - 128) * scale;
+            double* texel = &rgb[(y * width + x) * 3];
+            texel[0] = c + 1.402 * e;
+            texel[1] = c - 0.344136 * d - 0.714136 * e;
+            texel[2] = c + 1.772 * d;
+        }
+}
+
+static int Verify()
+{
+    int failures = 0;
+
+    // Every axis covers its source once over.
+    for (int source = 1; source <= 200 && failures < 10; ++source)
+        for (int target = 1; target <= 200; ++target) {
+            YuvAxis axis;
+            axis.Resize(source, target);
+            for (int t = 0; t < target; ++t) {
+                int sum = 0;
+                for (int k = 0; k < axis.Taps; ++k)
+                    sum += axis.Weights[t * axis.Taps + k];
+                if (sum != 256 || axis.First[t] < 0 || axis.First[t] + axis.Taps > source) {
+                    printf("Axis %d to %d: texel %d sums to %d from %d.\n", source, target, t,
+                           sum, axis.First[t]);
+                    ++failures;
+                    break;
+                }
+            }
+        }
+
+    // SIMD and scalar agree exactly, and both stay near the exact answer.
+    srand(1);
+    // Random bytes get further off than camera images, since every
+    // rounded weight multiplies a big step between neighbors.
+    double worst[2] = { 0, 0 };
+    const double Tolerance[2] = { 4, 6 };
+    for (int i = 0; i < 400; ++i) {
+        YuvLayout layout = (YuvLayout) (rand() % 2);
+        YuvOutput output = (YuvOutput) (rand() % 2);
+        int sourceWidth = 1 + rand() % 160, sourceHeight = 1 + rand() % 90;
+        int width = 1 + rand() % (sourceWidth + 8), height = 1 + rand() % (sourceHeight + 8);
+        if (i % 4 == 0) {
+            width = sourceWidth;
+            height = sourceHeight;
+        }
+        YuvConvertOptions simdOptions, scalarOptions;
+        simdOptions.FullRange = scalarOptions.FullRange = i % 3 == 0;
+        scalarOptions.Simd = false;
+        YuvConverter simd(simdOptions), scalar(scalarOptions);
+
+        Frame frame;
+        frame.Resize(layout, sourceWidth, sourceHeight, rand() % 20);
+        frame.Fill(i % 2 == 1);
+        int bytesPerTexel = output == YuvOutputRgba8 ? 4 : 2, stride = width * bytesPerTexel + 4;
+        vector<unsigned char> fast(stride * height, 7), slow(stride * height, 7);
+        simd.Convert(frame.Image, width, height, output, &fast[0], stride);
+        scalar.Convert(frame.Image, width, height, output, &slow[0], stride);
+        if (fast != slow) {
+            printf("Case %d, %dx%d %s to %dx%d %s: SIMD and scalar differ.\n", i, sourceWidth,
+                   sourceHeight, layout == YuvLayoutNv12 ? "NV12" : "I420", width, height,
+                   output == YuvOutputRgba8 ? "RGBA8" : "RGB565");
+            ++failures;
+            continue;
+        }
+
+        // Clamped texels can't be compared with the exact answer, which is
+        // off the end; random bytes hit that all the time.
+        if (output != YuvOutputRgba8)
+            continue;
+        vector<double> exact;
+        ConvertExactly(frame, width, height, simdOptions.FullRange, exact);
+        int bad = -1;
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+                for (int c = 0; c < 3; ++c) {
+                    double expected = exact[(y * width + x) * 3 + c];
+                    if (expected < 0 || expected > 255)
+                        continue;
+                    double error = fabs(slow[y * stride + x * 4 + c] - expected);
+                    worst[i % 2] = error > worst[i % 2] ? error : worst[i % 2];
+                    if (error > Tolerance[i % 2] && bad < 0)
+                        bad = (y * width + x) * 3 + c;
+                }
+        if (bad >= 0) {
+            int x = bad / 3 % width, y = bad / 3 / width;
+            printf("Case %d: texel (%d, %d) channel %d is %d, not %.2f.\n", i, x, y, bad % 3,
+                   slow[y * stride + x * 4 + bad % 3], exact[bad]);
+            ++failures;
+        }
+    }
+    printf("Largest error against exact BT.601 and area averages: %.2f steps, "
+           "%.2f for random bytes\n", worst[0], worst[1]);
+
+    // The ends of the range clamp rather than wrap, in both layouts.
+    const unsigned char Extremes[4][3] = { { 0, 0, 0 }, { 255, 255, 255 }, { 0, 255, 0 },
+                                           { 255, 0, 255 } };
+    for (int e = 0; e < 4; ++e)
+        for (int l = 0; l < 2; ++l) {
+            Frame frame;
+            frame.Resize((YuvLayout) l, 35, 9, 3);
+            for (size_t b = 0; b < frame.Bytes.size(); ++b)
+                frame.Bytes[b] = Extremes[e][0];
+            for (int y = 0; y < frame.Heights[1]; ++y)
+                for (int x = 0; x < frame.Widths[1]; ++x)
+                    frame.GetRow(1, y)[x] = Extremes[e][l ? 1 : 1 + x % 2];
+            for (int y = 0; y < frame.Heights[2]; ++y)
+                memset(frame.GetRow(2, y), Extremes[e][2], frame.Widths[2]);
+            YuvConvertOptions simdOptions, scalarOptions;
+            scalarOptions.Simd = false;
+            YuvConverter simd(simdOptions), scalar(scalarOptions);
+            vector<unsigned char> fast(35 * 9 * 4), slow(35 * 9 * 4);
+            simd.Convert(frame.Image, 35, 9, YuvOutputRgba8, &fast[0], 35 * 4);
+            scalar.Convert(frame.Image, 35, 9, YuvOutputRgba8, &slow[0], 35 * 4);
+            if (fast != slow) {
+                printf("Extreme %d in %s: SIMD and scalar differ.\n", e, l ? "I420" : "NV12");
+                ++failures;
+            }
+        }
+
+    // Video range white and black come out as white and black, and full
+    // range gray is exact.
+    const int Grays[3][3] = { { 235, 0, 255 }, { 16, 0, 0 }, { 100, 1, 100 } };
+    for (int g = 0; g < 3; ++g) {
+        Frame frame;
+        frame.Resize(YuvLayoutNv12, 16, 2, 0);
+        memset(&frame.Bytes[0], 128, frame.Bytes.size());
+        memset(frame.GetRow(0, 0), Grays[g][0], 16 * 2);
+        YuvConvertOptions options;
+        options.FullRange = Grays[g][1] != 0;
+        YuvConverter converter(options);
+        unsigned char texels[16 * 2 * 4];
+        converter.Convert(frame.Image, 16, 2, YuvOutputRgba8, texels, 16 * 4);
+        for (int i = 0; i < 16 * 2 * 4; ++i)
+            if (texels[i] != (i % 4 == 3 ? 255 : Grays[g][2])) {
+                printf("Gray %d comes out as %d.\n", Grays[g][0], texels[i]);
+                ++failures;
+                break;
+            }
+    }
+
+    if (failures)
+        return 1;
+    printf("Every check passed\n");
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options = ParseOptions(argc, argv);
+    if (options.Verify)
+        return Verify();
+    return Report(options);
+}
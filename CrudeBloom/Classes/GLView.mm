@@ -1,5 +1,5 @@
 #import "GLView.h"
-#import "../Textures/TombWindow.h"
+#include "../../Common/Classes/Profiler.hpp"
 #import <OpenGLES/ES2/gl.h> // <-- for GL_RENDERBUFFER only
 #import <string>
 
@@ -13,6 +13,14 @@ void ReadShaderFile(const std::string& file, std::string& contents)
     contents = std::string((const char*) [data bytes], data.length);
 }
 
+std::string GetResourcePath(const std::string& file)
+{
+    NSString* basePath = [NSString stringWithUTF8String:file.c_str()];
+    NSString* resourcePath = [[NSBundle mainBundle] resourcePath];
+    NSString* fullPath = [resourcePath stringByAppendingPathComponent:basePath];
+    return [fullPath UTF8String];
+}
+
 @implementation GLView
 
 + (Class) layerClass
@@ -77,6 +85,7 @@ void ReadShaderFile(const std::string& file, std::string& contents)
 
     m_renderingEngine->Render(theta);
     [m_context presentRenderbuffer:GL_RENDERBUFFER];
+    PROFILE_FRAME();
 }
 
 - (void) touchesBegan: (NSSet*) touches withEvent: (UIEvent*) event
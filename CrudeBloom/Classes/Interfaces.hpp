@@ -2,8 +2,6 @@
 #include "Vector.hpp"
 #include <vector>
 
-extern const unsigned int TombWindow[];
-
 enum VertexFlags {
     VertexFlagsNormals = 1 << 0,
     VertexFlagsTexCoords = 1 << 1,
@@ -2,9 +2,13 @@
 #include <OpenGLES/ES2/glext.h>
 #include "ParametricSurface.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/AssetPack.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include "../../Common/Classes/PvrUpload.hpp"
 #include <iostream>
 
 void ReadShaderFile(const std::string& file, std::string& contents);
+std::string GetResourcePath(const std::string& file);
 
 using namespace std;
 
@@ -12,12 +16,6 @@ namespace ES2 {
 
 const int OffscreenCount = 5;
     
-struct PVRTextureHeader {
-    unsigned int HeaderSize;
-    unsigned int Height;
-    unsigned int Width;
-};
-
 struct Framebuffers {
     GLuint Backbuffer;
     GLuint Scene;
@@ -87,6 +85,7 @@ private:
     ProgramHandles m_blitting;
     ProgramHandles m_lighting;
     ivec2 m_size;
+    AssetPack m_assets;
 };
 
 IRenderingEngine* CreateRenderingEngine()
@@ -127,18 +126,19 @@ GLuint CreateFboTexture(int w, int h)
 
 void RenderingEngine::Initialize()
 {
-    // Load the background texture:
+    // Load the background texture.  The pack stays mapped, but once GL has
+    // a copy of the texture its pages can go.
+    string packPath = GetResourcePath("Textures.pack");
+    if (m_assets.Open(packPath.c_str()) != AssetPackErrorNone)
+        cout << packPath << ": " << AssetPack::GetErrorString(m_assets.GetError()) << ".\n";
+    AssetEntry tombWindowEntry = m_assets.Find("TombWindow");
+    PvrTexture tombWindow;
+    tombWindow.Parse(tombWindowEntry.Data, tombWindowEntry.Size);
+    assert(tombWindow.IsValid() && "Bad TombWindow texture.");
     glGenTextures(1, &m_textures.TombWindow);
     glBindTexture(GL_TEXTURE_2D, m_textures.TombWindow);
-    {
-        PVRTextureHeader* header = (PVRTextureHeader*) TombWindow;
-        GLsizei w = header->Width;
-        GLsizei h = header->Height;
-        const unsigned int* texels = TombWindow + header->HeaderSize / 4;
-        GLenum format = GL_RGB;
-        GLenum type = GL_UNSIGNED_SHORT_5_6_5;
-        glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-    }
+    UploadPvrTexture(tombWindow);
+    m_assets.Release(tombWindowEntry);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -211,6 +211,7 @@ void RenderingEngine::Initialize()
 
 void RenderingEngine::Render(float theta) const
 {
+    PROFILE_ZONE("ES2::RenderingEngine::Render");
     glViewport(0, 0, m_size.x, m_size.y);
     glEnable(GL_DEPTH_TEST);
 
@@ -257,6 +258,7 @@ void RenderingEngine::Render(float theta) const
     // Downsample the rendered scene.
     int w = m_size.x, h = m_size.y;
     for (int i = 0; i < OffscreenCount; ++i, w >>= 1, h >>= 1) {
+        PROFILE_ZONE("Downsample");
         glViewport(0, 0, w, h);
         glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffers.Offscreen[i]);
         glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers.OffscreenColor[i]);
@@ -272,6 +274,7 @@ void RenderingEngine::Render(float theta) const
     glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffers.Offscreen[0]);
     glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers.OffscreenColor[0]);
     for (int i = 0; i < OffscreenCount; ++i) {
+        PROFILE_ZONE("Accumulate");
         glBindTexture(GL_TEXTURE_2D, m_textures.Offscreen[i]);
         RenderDrawable(m_quad, m_blitting);
     }
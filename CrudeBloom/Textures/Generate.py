@@ -15,17 +15,8 @@ def ShowImage(image):
     elif uname()[0] == 'Darwin': system('open ' + image)
     else: system('start ' + image)
 
-path = '/Users/prideout/Documents/PowerVR-ES2/Utilities/'
-textool = 'PVRTexTool/PVRTexToolCL/MacOS/PVRTexTool -h -yflip1 -fOGL565 -i'
-
-system(path + textool + "TombWindow.png")
-
-images = []
-images.append('TombWindow.h')
-
-fromStr = "static const unsigned long" 
-toStr = "const unsigned int" 
-
-for filename in images:
-	for line in fileinput.FileInput(filename, inplace=1):
-		print line.replace(fromStr, toStr),
+# Build with: g++ -O2 -o TextureCooker TextureCooker.cpp -lpng -lpthread
+#             g++ -O2 -o AssetPacker AssetPacker.cpp
+tools = '../../Common/Tools/'
+system(tools + 'TextureCooker -f 565 -m none TombWindow.png TombWindow.pvr')
+system(tools + 'AssetPacker Textures.pack TombWindow.pvr')
@@ -1,2428 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT const unsigned int
-#endif
-
-A32BIT TombWindow[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x000001e0,		/* dwHeight */
-0x00000140,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00010013,		/* dwpfFlags */
-0x0004b000,		/* dwDataSize */
-0x00000010,		/* dwBitCount */
-0x0000f800,		/* dwRBitMask */
-0x000007e0,		/* dwGBitMask */
-0x0000001f,		/* dwBBitMask */
-0x00000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x10200800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18810820,0x186120a2,0x10201020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18a10000,0x41c73985,0x08003104,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39a620e3,0x00002924,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000800,0x00000000,0x00000000,0x00000000,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000020,0x00000000,0x00000020,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x08000800,0x00000800,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000800,0x00000000,0x00000000,0x08000000,0x10000800,0x18400800,0x08001020,0x08000800,0x00000800,
-0x00000000,0x00000000,0x00000000,0x08000000,0x08001020,0x08000800,0x08000800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18200800,0x10001820,0x10001000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08000800,0x08000800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400820,0x10001020,0x00000000,0x00000000,0x08000000,0x18201820,0x30e22061,0x18402040,0x08001020,0x00001020,
-0x00000000,0x00000000,0x00000000,0x10200000,0x186120a2,0x18401841,0x10001020,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x20a21861,0x38c13060,0x306038c2,0x28812840,0x28a130a1,0x10001820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000800,0x10001000,0x10001000,0x00000800,0x00000000,0x00000000,0x00000000,0x08200800,0x20601840,0x20402060,0x20202820,0x08000800,0x10411000,0x00000820,0x00000000,0x00000000,0x00000000,0x08000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x10000800,0x20201800,0x20002020,0x10001800,0x10001000,0x08001000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x28e22082,0x30e230e2,0x08001020,0x00000000,0x10000000,0x28601840,0x41023902,0x30a02860,0x100028a0,0x10401840,
-0x00000000,0x00000000,0x00000000,0x18400800,0x30c130e2,0x30e130e1,0x204030c2,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000000,0x28c21881,0x514338c1,0x61c559a5,0x516359a5,0x30e24103,0x286130e2,0x08001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x10610841,0x10211841,0x10001000,
-0x08001000,0x00000000,0x00000000,0x00000000,0x08000000,0x28202020,0x30202820,0x28203020,0x10001800,0x00000000,0x00000000,0x00000000,0x18600800,0x414430c2,0x51854985,0x51645984,0x30a14944,0x20202000,0x10002020,0x00000000,0x00000000,0x10000800,0x18001800,0x18201800,0x08001000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200820,0x00000800,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20201820,0x30402820,0x38a13881,0x408140a1,0x30403861,0x28403040,0x18002020,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18401020,0x10201000,0x08201020,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08000800,
-0x10001000,0x08000800,0x00000000,0x00000000,0x00000000,0x08200800,0x10201020,0x08001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10210000,0x39022081,0x49224922,0x18222861,0x00000000,0x00000020,0x30c22081,0x61c35163,0x69e361a2,0x49405140,0x28e13900,
-0x00000000,0x00000021,0x00000000,0x28a10000,0x51614963,0x59c161e2,0x41245163,0x290230e1,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x10200800,0x39231860,0x49014922,0x69e459a3,0x51207245,0x496359a3,0x28803923,0x28803080,0x00000000,0x08010801,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x10411041,0x18201861,0x40c22840,
-0x40e34903,0x00000800,0x00000000,0x08000800,0x18200800,0x51023020,0x610050a0,0x61206962,0x280050a0,0x00010800,0x00200000,0x08200000,0x28c10800,0x48e23040,0x6a2661e5,0x61217a26,0x71c56183,0x50806122,0x20003820,0x00000800,0x00200020,0x38412840,0x384140a3,0x30603040,0x08002860,0x00000000,0x00000020,0x00000001,0x08400000,0x18001000,0x20202021,0x18202020,
-0x08001020,0x00000000,0x00000000,0x00000800,0x00000000,0x00400000,0x00000020,0x08000800,0x38201000,0x50c050c1,0x590048a0,0x69426942,0x51015922,0x40c05163,0x304048e2,0x00000000,0x00000020,0x00000000,0x00000022,0x00000000,0x00000000,0x08000000,0x20201820,0x38c12840,0x30604903,0x20812020,0x00000800,0x00000000,0x00200000,0x00000000,0x00000000,0x28612020,
-0x28402000,0x20a230a1,0x00000000,0x08000000,0x00000000,0x20621000,0x308130a2,0x20812020,0x00201020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08010000,0x08000000,0x38e12081,0x596261a3,0x30825144,0x08000800,0x00000040,0x41030800,0x69a25983,0x79e27a02,0x69e271e2,0x51c56a45,
-0x00000000,0x00000000,0x08000020,0x18400000,0x514040e1,0x61c15980,0x62065963,0x292251c5,0x08400840,0x00000000,0x08410020,0x00000000,0x00000000,0x08010000,0x08200000,0x41642903,0x51423060,0x72457a87,0x71e37203,0x51625961,0x41434943,0x310238c1,0x00001081,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x10200000,0x18201020,0x28402020,0x61643800,
-0x594369a4,0x00000800,0x08200000,0x08010000,0x30c10000,0x718269e5,0x89e281a1,0x8a0389e3,0x69628a03,0x00012882,0x00000862,0x00000000,0x39021020,0x51225164,0x61825100,0x71a36120,0x71826961,0x8a4681c3,0x51437a06,0x00202060,0x20e10000,0x50e340e3,0x51035904,0x48e148c1,0x30a14923,0x00210000,0x00000000,0x00000842,0x08000000,0x40813081,0x40c240c2,0x38604080,
-0x08002820,0x10410000,0x08000000,0x00000000,0x00000000,0x00000040,0x00000000,0x28a10800,0x61834943,0x79a379e5,0x8a4481e3,0x89e481a2,0x58e07162,0x48605060,0x51436183,0x000028c2,0x00000000,0x00000820,0x00010000,0x08200000,0x00000000,0x10200000,0x38a12020,0x512240c1,0x51435943,0x288040e1,0x00001020,0x00000000,0x00000000,0x00000000,0x39031861,0x51435164,
-0x38803880,0x30e34985,0x00210000,0x00000000,0x00000000,0x30a21820,0x51434923,0x202038c2,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28601000,0x402048a0,0x28004020,0x00200000,0x10600000,0x38a00800,0x61205120,0x81e17a03,0x698079a0,0x49227205,
-0x08200800,0x00000020,0x00000000,0x10000000,0x51624122,0x69e35981,0x492261a4,0x000030e2,0x00000000,0x10200820,0x00000000,0x18820800,0x08600020,0x00000000,0x08410000,0x28c118a1,0x61c440e1,0x72037a66,0x616069a0,0x59425900,0x516461a5,0x10802040,0x00000060,0x00000020,0x00000000,0x08000800,0x00000000,0x00010001,0x18000800,0x41234144,0x48c04102,0xab4a5860,
-0x38208a86,0x08600000,0x00000000,0x00200000,0x28400000,0x790071a4,0x810080e0,0x890080e0,0x8a2491a0,0x00014124,0x00000801,0x08000000,0x51843103,0x61a359a4,0x59615982,0x61615920,0x81c35900,0xa2a7a286,0x7a679266,0x000028a0,0x10200040,0x598440e3,0x71e66163,0x59847227,0x5a075164,0x00001840,0x08210000,0x00200000,0x08000020,0x40005143,0x60e04840,0x58a060a0,
-0x494350c0,0x000028c2,0x00210000,0x00000000,0x00000000,0x00200000,0x00000000,0x30e30000,0x82876206,0x9a049225,0x9a029a23,0x91819180,0x70c07900,0x79208140,0x82a88a67,0x080038e2,0x00000820,0x08200000,0x00210000,0x00000000,0x00000000,0x10210000,0x41032883,0x614148c0,0x59215921,0x28405100,0x00011883,0x00000000,0x00000000,0x00000020,0x59c428c0,0x61e461e4,
-0x41005182,0x412540e2,0x00001882,0x00000020,0x00200040,0x51833921,0x51635983,0x20604143,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000841,0x6aa90800,0x9b4a934b,0x832aa3ab,0x00001860,0x00200040,0x28a00000,0xa38a8b29,0x9b079b49,0xb3caab68,0x10007a87,
-0x08201000,0x00200000,0x00000000,0x08000000,0x59623080,0x588071c3,0x51205080,0x00001800,0x00200000,0x00000800,0x28601000,0x10001800,0x10001000,0x00000800,0x00000001,0x20600000,0x50a03840,0x690058a0,0x69207140,0x58407960,0x30004000,0x00002040,0x00400000,0x00000020,0x28811000,0x202038c1,0x08000800,0x00000000,0x08000801,0x492230a1,0x40004880,0xd48e70c0,
-0x2000b40c,0x00200000,0x00000000,0x00000861,0x10000840,0xbb6b8247,0xbb27b307,0xc348b2c6,0xa349cbca,0x00001000,0x00000821,0x00000000,0x30001800,0x48404020,0x50605060,0x484058c0,0x81a16900,0x60406040,0x58a070e0,0x00002040,0x08000000,0x30002800,0x48403800,0x38005080,0x41242800,0x00000000,0x00000801,0x00200040,0x18000841,0x820648a1,0x9a448a24,0xa2a6aae6,
-0x722779c3,0x08003923,0x00000040,0x00000000,0x10410800,0x00001882,0x00000000,0x08000800,0x48c02000,0x91607981,0xa1809120,0xa1e1aa01,0xb26499a0,0x99e3aa23,0x59628205,0x08001000,0x08200000,0x18601000,0x08001000,0x00000000,0x00000020,0x00000000,0x40e32082,0x71c25900,0x720379e2,0x598469e3,0x00020000,0x00000000,0x00000800,0x00000000,0x49622060,0x69e461c4,
-0x49005960,0x38c240c1,0x00001020,0x00400000,0x18400000,0x59414942,0x48c06160,0x20603080,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x838c20c1,0x9b8c9bad,0x8bab9bab,0x00202142,0x00610061,0x08000060,0xbcb093ac,0xbc6eb46e,0xbcafccef,0x08006a67,
-0x08201820,0x00810000,0x00000040,0x08000820,0xb40d3060,0xc368cbec,0x9326c409,0x18411800,0x00000800,0x18200000,0x618240e0,0x8a4681e3,0x20004040,0x08201000,0x00000000,0x10000820,0xa34861a2,0xc367b326,0xc367cbc9,0xc347c347,0x8a66bb48,0x08211000,0x00200042,0x18400820,0x40c03080,0x302050e0,0x18211800,0x00000800,0x00400000,0x59620800,0x89a081e3,0xe54fc3c8,
-0x100082e9,0x08001020,0x00000000,0x08001822,0x08001081,0xdd5369e6,0xed50ed72,0xed70f570,0x9349edb1,0x18c20800,0x08200841,0x51e60000,0xab8aac2d,0xab07ab68,0xa243a264,0xaac4a283,0xbba8bb47,0xcc8cb387,0xa38bd4ae,0x00002820,0x10001001,0x8b4a4944,0xab89a38a,0x9b69a368,0x08006a48,0x00200800,0x08000800,0x00001040,0x08000000,0xd5124903,0xf4ceecef,0xf530f4ee,
-0x6a05d4f0,0x08201000,0x00000020,0x20400800,0x20202861,0x28a21800,0x08001000,0x10400800,0x20001000,0xecefb3aa,0xec2aec6c,0xec2ae3e9,0xd367e3e8,0xcbcbdba9,0x180050a0,0x00001020,0x20810800,0x18001000,0x310238e2,0x00000000,0x00200000,0x08000020,0x38c00000,0x79a06980,0x79c081e0,0x61c38264,0x00000000,0x10610000,0x00010000,0x00000000,0x30c00000,0x594159c4,
-0x58c06160,0x40e14020,0x00001000,0x00000021,0x59a41820,0x61206162,0x48407180,0x18003000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x08000000,0x20002000,0x10002000,0x00810000,0x00000020,0x00000040,0x20001000,0x18001800,0x18002000,0x08000800,
-0x00000820,0x00000881,0x18400000,0x18400000,0xac0d1000,0xe46ce4af,0xa387e50c,0x20611800,0x00001062,0x61e43060,0xa2e68223,0xe4aedc2b,0x8225c40c,0x10002800,0x00200840,0x10001862,0xd4ce7a45,0xed0edc8d,0xed0fe4ee,0xeccdf52e,0xcc6eecce,0x08621800,0x00000000,0x38801800,0x79c150c0,0xb3cab3c9,0x28006162,0x10201800,0x00400881,0x51620000,0xdc8dd4ae,0xb40bed4f,
-0x08001000,0x00001042,0x28a21840,0x18001800,0x08200820,0x62061000,0x82858286,0x9326a388,0x38a08b27,0x00400000,0x10610000,0x49a40000,0xb40c938b,0xdcefbc4d,0xf48cec8d,0xecacf4ac,0xe570e4ee,0xc4aeccee,0x8b0aac0d,0x08001800,0x00001022,0x9c2e3924,0xb48dac4d,0xa44dac4c,0x00006ac9,0x08200841,0x10001000,0x18400800,0x18401020,0x932a1000,0xec4adc8d,0xe48cec8b,
-0x3820d4cf,0x10601000,0x18600000,0x28002860,0x92ea4860,0x200069a5,0x288138e2,0x00000000,0x180020a2,0xf570abca,0xf48bf4cc,0xf4abf48b,0xec28fcab,0xc3a9f48c,0x10202000,0x08210020,0x18001820,0x936b48e0,0x200061c3,0x28c13922,0x00000840,0x18810000,0x7ae90800,0xdc8bd4ce,0xed70dcac,0x2800bcae,0x08200000,0x00001000,0x08011842,0x00210000,0x08000000,0x72884102,
-0x930a9309,0x6a689bcd,0x10a30000,0x00000021,0x938c4964,0x9b2a932b,0xbc6eb40c,0x51c6ac70,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20002040,0x10012041,0x00000821,0x00200000,0x08010000,0x08000800,0x08000800,0x08000800,0x00001862,
-0x18820000,0x49c50800,0x10005a26,0x10211820,0x30a10000,0xcc6da38b,0xa347dced,0x18622000,0x10000000,0xa2a558e0,0xec6bd3e9,0xec4bf46b,0xe4adec4a,0x69c2bba9,0x10201000,0x10001862,0xc4ae61a2,0xa38ac48e,0x72035100,0xd46cbc0b,0xa348e4ee,0x08401800,0x08200021,0x79e22800,0xe46bc3a9,0xec8cec8b,0xa2e6dc6c,0x100050e0,0x00010000,0x10001062,0xed70d4ef,0x59a3c48e,
-0x18c30800,0x10610000,0x62061000,0x3820a3cd,0x08420800,0x08001861,0x10000000,0x10001000,0x08000800,0x00210000,0x00000000,0x00000820,0x10000800,0x7a051800,0xf46bdc2c,0xdc49f46a,0x2000bc0b,0x08001800,0x08001000,0x00000000,0x10010801,0x10000000,0x08000000,0x00000000,0x08200020,0x18210000,0x30801800,0x10004102,0x08200800,0x28000000,0xe4ccb3ca,0xdc4ae449,
-0x2800b3aa,0x00002020,0x08001061,0x79e12800,0xdc6dbb68,0x8a66d48e,0x10002000,0x00002081,0x20001861,0xdd0c9b67,0xf4ece48a,0xecabf50d,0xeccaecaa,0xb388f52e,0x18802000,0x08000820,0x92c73000,0xed70dcce,0x9ae6dd0e,0x30004020,0x100038c2,0x18a10800,0x7aa60800,0xec8bed0e,0xe571eced,0x0800836a,0x10400860,0x49441000,0x10002881,0x00001041,0x00000800,0x29030820,
-0x41443903,0x394551e7,0x00000000,0x00000021,0x41032020,0x59e54944,0x620659c4,0x41a672eb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x08000800,0x08000800,0x08000800,0x08000800,0x00010000,0x08210000,0x00200020,0x00000020,0x00000000,
-0x18400020,0xac0d2000,0x38c0bcf1,0x08210800,0x08000021,0x69c21800,0x8286b40b,0x10621000,0x18000862,0xec6c9244,0xf429f4ab,0xf429ebe8,0xf4aaf408,0xa348eced,0x10401800,0x10000800,0x8b294921,0x18005962,0x18001000,0x82862000,0x7a25c46e,0x10810800,0x08000021,0xd44c7a04,0xfccbec8b,0xf449f46a,0xeccdec6a,0x3860b3eb,0x00011000,0x00000000,0x9b49ac2d,0x08004901,
-0x00001061,0x08000861,0xabec1800,0x9b08ed92,0x20a31800,0x10610000,0x08a008a0,0x18a11080,0x08211061,0x08010001,0x10400800,0x10401040,0x18c21081,0x20001861,0xdc2ba2c6,0xc3c8e429,0x08005961,0x08401080,0x10a210a2,0x00200000,0x00000000,0x10621021,0x00c108c2,0x08a210e3,0x00200040,0x20001000,0xac0e2000,0x2800ac0d,0x00000800,0x08001082,0xc42b7244,0xe50ed44a,
-0x2000c48e,0x10202020,0x59c40800,0xdccdb3ea,0xf4acf4ed,0xed0ff4ee,0x61c4bc2d,0x10200800,0x10001862,0xedb09b88,0xed2ee54e,0xcc4bcc4b,0xe52de54e,0x8aa6ed90,0x20c21000,0x41230000,0xed2fbc2c,0xeccbf50d,0xed4ef54d,0xa309d46d,0x18004020,0x10201000,0x59810800,0xdc6cd48d,0x7a45c3eb,0x08400800,0x08001081,0xbcd14922,0x18008b4a,0x00001840,0x00000800,0x00000000,
-0x00000000,0x00000000,0x00001041,0x00000000,0x08001000,0x00000800,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08200000,0x28412041,0x20402860,0x20a12860,0x08011021,0x00000001,0x08200000,0x08401060,0x10811081,
-0x180020c2,0xe4ef9265,0x7286d530,0x10410800,0x00000000,0x00001881,0x00000800,0x00000800,0x10001061,0xecaca2e6,0xfc8bf46a,0xf46af449,0xf4aafc69,0x9ae5eccc,0x10811800,0x08010000,0x10000800,0x20601000,0x18611860,0x08000800,0x20202020,0x00210000,0x10001082,0xec8cab49,0xf46aec29,0xf46af449,0xf4ecec28,0x50a0cc6c,0x00200800,0x10420000,0x08000800,0x10410000,
-0x00000000,0x18001080,0xdd0e9307,0xdcacecec,0x100048a0,0x08002041,0x00400020,0x08010000,0x00000800,0x00000801,0x08000800,0x00000000,0x00000800,0x08001040,0xbc4e2800,0x8ae7e571,0x20c21000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x00000000,0x00000000,0x200028c2,0xdcae9286,0x9b48e4ef,0x08810800,0x20810000,0x18000800,0xac0c69e3,
-0x1000a40e,0x08001840,0xc4ae3020,0xe44afdb1,0xf4acf4cc,0xf4edf4ab,0xd4eff570,0x000051a3,0x080020a2,0xcd308b49,0x69e29b69,0x20002800,0x9beb6203,0x7267cd52,0x20a20800,0x62050000,0xec8bdcce,0xfcebf48a,0xec8bec8a,0xf50ffd0e,0x48c0bc2d,0x10810800,0x28e00000,0x7aa78b4a,0x10002000,0x00001061,0x18002081,0xd5318287,0x50c0ccae,0x10820800,0x00000000,0x08200000,
-0x00000040,0x00000862,0x08000800,0x08000800,0x10000800,0x08401040,0x10400820,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00410000,0x18a10040,0x50e15163,0x40603000,0x30203860,0x10001000,0x00000000,0x08000840,0x10000800,0x18001000,
-0x61002000,0xeceed42b,0x2000a3aa,0x08401840,0x08000000,0x08410820,0x08410841,0x00200000,0x18000880,0xf4eda2c5,0xf44af4ab,0xf469ec49,0xec68ec47,0x9ae6e4ab,0x08811000,0x00210041,0x18420000,0x00001862,0x08000800,0x08830862,0x00000000,0x00000021,0x180018a2,0xf4ccb348,0xec28ec6a,0xf449fc6a,0xf50df469,0x50e0cc4b,0x08610800,0x00000000,0x08a30000,0x00000882,
-0x00200000,0x100018a1,0xe50e82a5,0xeccadc27,0x3000bc0b,0x38c22800,0x00002880,0x00010801,0x10210000,0x30811000,0x59a34942,0x51a44962,0x30a038c1,0x10400000,0x6a880800,0x4142ac6f,0x00200000,0x18400000,0x38e22880,0x30e130a1,0x00002080,0x00000000,0x00000000,0x30c21840,0x410330a2,0x69612000,0xe48cdc6d,0xabcae4ee,0x10811000,0x00000800,0x10600840,0x20600800,
-0x000028c1,0x08001060,0xd48d61a2,0xf4abeccc,0xe408ec8b,0xe407db85,0xdd0edc49,0x000059c3,0x00001061,0x40e04122,0x10002000,0x10201800,0x08000000,0x30c14164,0x18600800,0x6a250800,0xec48e4ad,0xfcebfd0c,0xf469f4aa,0xf4acf46a,0x6181d48d,0x10611000,0x00000820,0x00001020,0x10620800,0x08210021,0x18001000,0xbc2c2800,0xb389e50e,0x20602000,0x30a028a0,0x20203080,
-0x08400000,0x00000020,0x10000800,0x10001000,0x08001000,0x00000800,0x00000000,0x00000860,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28a00881,0xa32850e0,0xb388a347,0xa307ab47,0x28008244,0x08001800,0x20600000,0x7a026a04,0x92439264,
-0xc36891e2,0xcc4af50d,0x00004920,0x00200040,0x18201000,0x18211000,0x00000000,0x00000020,0x100010e1,0xf50ea306,0xf48aec6a,0xf489f48a,0xeccaeca8,0x92c6ed2e,0x10401000,0x00000000,0x08210820,0x10210000,0x080028a2,0x00000020,0x08410841,0x00200000,0x18001060,0xecccab88,0xfcabe428,0xfc29fc8a,0xf50ef48a,0x4920d4cf,0x00010000,0x08010000,0x00211041,0x00000000,
-0x08200821,0x20200800,0xbc0c2000,0xfcebf4ec,0xbb87f52d,0x50206060,0x30204840,0x08230800,0x00000001,0x40c00800,0x92838243,0x8a229262,0x486079a1,0x08401000,0x10001020,0x00001000,0x00200020,0x28001000,0x50806183,0x71e46942,0x08002820,0x08210800,0x08000800,0x28002000,0x48204840,0xcc0b7981,0xe46becac,0x61e2ccad,0x10410000,0x08001000,0x00000000,0x00001841,
-0x00200000,0x08000861,0xdcad6140,0xf4ccec8c,0xf4ccf4cd,0xec89fccc,0xdd0ef4ec,0x00004120,0x08200020,0x10000800,0x184020a0,0x08000800,0x08411062,0x00000000,0x20601000,0x8ae81000,0xec89ed0e,0xf4aaf4cb,0xfcecfcec,0xec4aec29,0x5900dc8d,0x10221000,0x00000000,0x10401020,0x08400820,0x00000800,0x18810000,0x72231000,0xd46bdc8c,0x380092a6,0x61404860,0x380058c0,
-0x08001800,0x00000000,0x080018a1,0x59624900,0x51644902,0x51655164,0x00003124,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x180018a0,0xe4ad8a43,0xf56ff54f,0xecacf50e,0x7a03dcad,0x18621000,0x39020000,0xd4adbc6e,0xec8cecad,
-0xe42aec4b,0x92c5e4ee,0x20e31000,0x00000020,0x30203080,0x18002000,0x10002881,0x00000020,0x08000060,0xe4ef8ac7,0xf4ececcd,0xf4ecf4cb,0xed4feccb,0x40a0a369,0x08201000,0x08000000,0x08000800,0x492330a1,0x48e05963,0x18401000,0x00000800,0x00000800,0x08000860,0xdccd8284,0xec8be4cc,0xfcccf44a,0xcc4cf4ed,0x10008286,0x00210000,0x00000801,0x08000800,0x41232840,
-0x08001820,0x18201000,0x69c21000,0xec8adcac,0xf50dec8a,0xc3aad40a,0x9b6ac40c,0x08420800,0x20810021,0x93282000,0xdc8bd48c,0xdc2ae48b,0xbbaae44c,0x08201800,0x00001040,0x00000800,0x10400000,0x8a872000,0xbbcbbbcc,0xb369c3eb,0x4920abeb,0x08210800,0x08001022,0xccd08b2b,0xd44dc3ec,0xeccde4ad,0xe4cdec6a,0x1000a3ca,0x08001861,0x20401000,0x182030e2,0x10610800,
-0x00200020,0x10000020,0xb3aa5141,0xf52ed46b,0xecabf4ed,0xececfd0d,0xdd71f56f,0x000030a0,0x00000861,0x18400800,0x08000000,0x30a22881,0x08000800,0x00001882,0x20800800,0x82e80800,0xf52ded90,0xfd0ceccb,0xec8af4ec,0xecedec49,0x5120d4cf,0x08011000,0x00210001,0x10200000,0x10001820,0x10400800,0x00200000,0x20001000,0xe4cdc40a,0xbb89d42c,0xab07c3ca,0xa308b368,
-0x000040e2,0x18a10820,0x51410800,0x9a8592a6,0x71a38224,0x72058a66,0x18a13923,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010001,0x20800000,0x38002020,0xf4cccc0a,0xf50cf4ec,0xf4ecfd2c,0xc46cf52d,0x08002000,0x08000840,0xdcee9328,0xf449ec8b,
-0xe4acec28,0x2000abcb,0x08401020,0x20400000,0xabcc3000,0x4820b3aa,0x08001800,0x00420000,0x08000001,0x6a051000,0xdccebc2c,0xdc6ceccd,0x6182a308,0x00001800,0x00000820,0x08000000,0x48c12841,0x79a06100,0xd48db388,0x30008245,0x18001800,0x00000000,0x08400000,0x59611800,0xed50c48d,0xd48bf54f,0x308082c6,0x18201000,0x00000000,0x00000000,0x49001820,0x92c579e1,
-0x18008b49,0x08000800,0x20002041,0xed0db3a9,0xf4acf4ed,0xeccefcce,0x8ae8e52f,0x10621000,0x10001041,0xdced7a22,0xfd2eed0e,0xfcedf4cc,0xeccefced,0x10007225,0x08201880,0x00000820,0x10000860,0xe4f058c0,0xf52fed0f,0xf54ffd4f,0x9b28f591,0x20c21000,0x10001062,0xe5517a88,0xe46be4ce,0xfd2eec8b,0xd4adf4ec,0x080059a1,0x18001820,0x48c02800,0x616250e0,0x180040c2,
-0x00000000,0x08000000,0x38801000,0xdceda389,0xecebf52d,0xed71ed0d,0x5a05bcaf,0x00400800,0x00000000,0x08000021,0x10001040,0x590148c0,0x304048c1,0x00000800,0x00200040,0x20400800,0xcccd8b69,0xf4ebed0d,0xeccaec88,0xdd2eed2d,0x08007ac6,0x00211061,0x00000020,0x10200880,0x51212000,0x00004963,0x00000840,0x10001041,0xd4ad69e2,0xec6cecad,0xec4bf4ad,0xcc6ceccc,
-0x00002000,0x00001082,0xcc8d5140,0xec4bec8c,0xdc6be46b,0xaba9dccd,0x18202000,0x08220821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20400800,0x9ae72000,0xf4aaec8c,0xf4caf4ca,0xfd4dfd0b,0xe52ff4ec,0x00008329,0x000010a2,0xc40b3820,0xf448ec6b,
-0xe4edf4aa,0x000061c4,0x00001041,0x18002061,0xe5108225,0xd46ceced,0x28208aa7,0x00000000,0x10420001,0x00000000,0x7a032000,0x7140a308,0x10002800,0x00011883,0x00000000,0x20200000,0x69403840,0xe48baae5,0xf4ececcb,0xab49ed2f,0x20004840,0x00000800,0x00000040,0x18001020,0x9b893000,0x5140a389,0x00001000,0x000018a1,0x00000000,0x10200020,0x82833880,0xe4cdcbe9,
-0x8b07e550,0x18821000,0x10001020,0xd4ce50e0,0xec4afd4f,0xfd0ef46b,0x2800cc6d,0x18401000,0x28000800,0xf50dcc6c,0xf4abf4ac,0xfcccf4ab,0xf50dfceb,0x2000c44d,0x08400800,0x00000020,0x18001040,0xecefb36a,0xf4ecfd4f,0xecabecab,0xd4aded0d,0x00003040,0x18001021,0xb3cb2000,0xec8bf50e,0xec6af48a,0x9b07ed0d,0x18a11000,0x18001820,0xc44e6162,0x7160b3aa,0x40c14860,
-0x00002880,0x00000000,0x08000801,0x69e02000,0xd4ccab86,0x9328ccad,0x08001800,0x00000820,0x00000021,0x18201000,0x7aa62840,0xab28cc6e,0x61617160,0x184051a4,0x00400000,0x00000000,0x51800800,0xdcabb3a8,0xdcece50c,0x5180b409,0x10a00800,0x00000000,0x10800000,0x30200800,0xc48e8a65,0x2000b44e,0x08411820,0x18600000,0xabaa1800,0xf429eccd,0xec29f44a,0x9ac5e4ac,
-0x18a31000,0x10001081,0xecedabca,0xf408f44a,0xf4cbec28,0xe54fed0c,0x200082a6,0x00002081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x18001040,0xe4cf58e0,0xfcaafced,0xfccbfccb,0xf52df4eb,0xe52ff50d,0x00008b6a,0x18a21081,0x8a651000,0xec4ae46b,
-0x9b27e4cc,0x08401000,0x10010021,0x40401800,0xeccccc0b,0xf4abf48b,0xabaaecee,0x10a21000,0x00000000,0x10a00020,0x10000820,0x18001800,0x08402080,0x00000820,0x00000000,0x10001081,0xcc2b7a03,0xf4ccf4cc,0xfd0cf4eb,0xeceef4ec,0x6182cc8e,0x10a20800,0x00000000,0x18400000,0x18001000,0x08001800,0x00201060,0x00210000,0x08000800,0x18000800,0xe4cea348,0xf4ecfd4f,
-0xd48df4ec,0x00003880,0x10800840,0x93491000,0xec8ae50e,0xfd4ffd0d,0x1000a389,0x18402080,0x936a1000,0xfccced0e,0xfc69fcaa,0xfccbfc8b,0xe489f4a9,0x8287e510,0x10611000,0x10800000,0x61e40800,0xe48bed50,0xfcebecca,0xf4abf4cb,0xed2fe44a,0x1000ac0c,0x20612040,0x7ac50800,0xf4aae4cc,0xecccec69,0x48c0d4ce,0x08200800,0x20002081,0xe4efab49,0xd46be4cd,0x71a2ab06,
-0x10002000,0x08000800,0x10400000,0x080020a0,0x51821800,0x10003040,0x18611000,0x00000000,0x20200000,0x72232000,0xe54fbc2b,0xf50ef50e,0x9241dc6b,0x40e16140,0x00000800,0x00000000,0x08001860,0x48e01800,0x59a28b29,0x08001800,0x000018a0,0x08420000,0x18001042,0xcc2b8265,0xf4edeccc,0x9aa7ecee,0x10202000,0x10401060,0x72041000,0xfcecdc8c,0xf4edf48a,0x4040c44c,
-0x18401800,0x5a040000,0xecacd4ce,0xfc6af48b,0xf489f448,0xf590f50c,0x4020e550,0x08401000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x18001020,0xe4efa32a,0xec28ec8b,0xf48af46a,0xeccbec8a,0xd4aefdb0,0x10601800,0x08200000,0x48601000,0xec8bdc2b,
-0x2800cc4c,0x08401000,0x20410000,0xa3082800,0xec6af52f,0xfcaaf469,0xc40bf4cc,0x10401800,0x08000000,0x10800000,0x08800840,0x10401881,0x00000020,0x08400000,0x00200000,0x18000860,0xf50dab67,0xf4abf4ab,0xfd2cf4cb,0xf4ecf4ca,0x9b08ed0f,0x08401000,0x08000000,0x18411862,0x20a11820,0x08601060,0x00000000,0x00210021,0x08000000,0x20001020,0xfd6fe530,0xfd0dfd4e,
-0xed0df4aa,0x10008b08,0x088018c1,0x28400000,0xf54dd4ee,0xfd2efcec,0x1000b42c,0x18601820,0xa3cb1000,0xf469ecee,0xfc69fc69,0xf469fc8a,0xeccaf4c9,0x6162d48d,0x08400800,0x10800020,0x83090800,0xfd6ef5f2,0xec89f4eb,0xfcecf4cb,0xdc4bfccc,0x51c4d551,0x18610800,0x59a00800,0xecaadcab,0xe4edecaa,0x180092e7,0x106020a1,0x61a30800,0xecace4cf,0xecedf50d,0xdccfeccd,
-0x10007a87,0x00001860,0x00000840,0x10810000,0x08000820,0x20810000,0x00000800,0x00000040,0x18001860,0xe57082a6,0xf50dfdd1,0xfcccf48b,0xf54efd0c,0x6182bbeb,0x00001000,0x00000000,0x10610000,0x00001841,0x00000800,0x10611840,0x00000000,0x08010000,0x61840800,0xecacdc8e,0xec28e408,0xd3caec0a,0x100058c0,0x08000800,0x20001840,0xecccab68,0xe48bec6a,0x18009b49,
-0x18412020,0x6a450800,0xec8be530,0xfccbec49,0xfccbf489,0xf52efd2d,0xb40ce52f,0x10811000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18002060,0xdcef92e8,0xf48aecac,0xf4aaf48a,0xec8afceb,0x7a85e570,0x10620800,0x18610000,0x71e31000,0xdcade4ad,
-0x10007a66,0x00002081,0x10001060,0xdc8d5880,0xf48af4ed,0xf4aaf489,0xb3a8f4cb,0x08201800,0x10000800,0x00000800,0x18a20000,0x08200820,0x20820000,0x10001800,0x00000800,0x18001881,0xecabb347,0xf489f4ab,0xf4a9f4ca,0xf46afccb,0x9ac7ecce,0x08401000,0x00000860,0x08001000,0x10402081,0x00000000,0x18a20820,0x00000000,0x08210821,0x28000800,0xfd4ddced,0xf4abfd0d,
-0xf54dfceb,0x3020cc8d,0x00001000,0x08001081,0xe4ed9307,0xeccceccc,0x40c0cc6d,0x10c10000,0x61c30000,0xec8ae50e,0xfc8af48a,0xfccbfcaa,0xf56fecaa,0x10009b8a,0x000018a1,0x08400020,0x38e00000,0xf52dd4ee,0xf4cbecaa,0xecaafd2c,0xe4ccec8a,0x10009b8a,0x18a20800,0x72440800,0xecece50d,0xc46ded4f,0x10002000,0x20800800,0xbc4d1800,0xf4edf550,0xecacfd0d,0xfdb2fd0e,
-0x1800abec,0x00002080,0x10810020,0x00000000,0x18610000,0x00000820,0x10811040,0x00010000,0x18001862,0xf5b0c48d,0xf4caeccb,0xfcacfccc,0xf4ccf46a,0xab89fd91,0x18811800,0x00000000,0x00000000,0x08200000,0x10611061,0x10600800,0x00000862,0x10400000,0x7a660800,0xecabdcad,0xec28ec69,0xec2bebe8,0x28009ac7,0x08002020,0x10000800,0xcc4c4060,0xdc4cfd0e,0x10005900,
-0x08001001,0x20001820,0xececbbc9,0xfcece44a,0xfd0cfd0c,0xed2efd6e,0xa3aadd2f,0x18621000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18000800,0xb40c2000,0xeceddcce,0xed0df54e,0xed4ff50d,0x0800a3ea,0x08211861,0x08200020,0xac0d1000,0xa368e551,
-0x18601800,0x10400800,0x10000820,0xf50fbc0c,0xf4ececcd,0xecabf4ec,0xc46bed0c,0x10611800,0x08001000,0x7aea51a5,0x18003060,0x30401800,0x40805143,0x40e248c1,0x08200800,0x20001041,0xf4ecbba8,0xf489f4cb,0xfd2cf4ca,0xfcccf449,0x92a6ed0f,0x18a01800,0x39630000,0x5963832a,0x10001800,0x20402020,0x10001800,0x30c04142,0x08220000,0x18001001,0xed4ddd6f,0xed2eed2e,
-0xf590ed0d,0x9babedd2,0x10c31000,0x08000041,0xc48d2000,0xf52ff570,0x82c7ed71,0x08800800,0x18001061,0xf56fb3ea,0xfcececaa,0xf4edfd4e,0xccaded2e,0x00002840,0x00000820,0x00000000,0x10000860,0xe5908b06,0xecede50d,0xed0ce4ab,0xcc8cfd8f,0x08002800,0x10401061,0xbc8e1000,0xf58fed6f,0x69e3d4ee,0x10801000,0x10001860,0xd50f8307,0xecabe4ed,0xec8bfd2d,0xe4eeecac,
-0x20009b28,0x18401820,0x08000800,0x20811000,0x00001000,0x28a12040,0x08001000,0x08210800,0x10001021,0xf56eccae,0xfcebf4ea,0xfcacfcec,0xe429fcab,0xbbeaf4ed,0x10401800,0x00000000,0x18811020,0x00000000,0x10001040,0x08002880,0x08400000,0x18600020,0x7a451000,0xf4ccdcad,0xfcabec49,0xec2afc6a,0x4840cc2b,0x10421000,0x18800020,0x9b8a1000,0xdc6decee,0x080082a7,
-0x08001020,0x18001021,0xd48b6960,0xec69e46a,0xf52cf4eb,0xe50efd6e,0x2000c48d,0x08210800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08200000,0x51e40800,0x9b889b69,0x9ba99ba9,0x83079bca,0x00002080,0x00000840,0x00000040,0x8bad1000,0x39208bab,
-0x08200000,0x08400820,0x62880000,0xdcefccf0,0xdc8cdcad,0xe50ee4cd,0xac0be54f,0x10611000,0x08001041,0xd5506a03,0xab47d4ee,0x58205840,0x81e168c0,0xabebccad,0x10810800,0x18000840,0xf4edbb68,0xf4aaec8a,0xfcebfcaa,0xecedec6a,0x8aa5f590,0x20e11000,0x51840000,0xdcefdd30,0x6160a389,0x28002800,0x92c74000,0x7aa7c4d0,0x10211800,0x00000022,0x9c098baa,0xbcaeac4b,
-0x9b8aa3eb,0x834ba40d,0x00200000,0x18a10020,0x93291800,0xdceeed91,0xa40cd530,0x08810000,0x08000860,0xccee6a24,0xe4ecdced,0xd4eedced,0x7266ccef,0x18a00800,0x08200800,0x00420883,0x00000862,0xa42d2860,0xcccec4ef,0xedb0e52e,0x8b28e5b1,0x20c21000,0x08001880,0xe5f37aa7,0xe570ed90,0x10009bcb,0x00410840,0x20001020,0xf5f2ccef,0xed2ce52d,0xfd6df54c,0xf54ffd4e,
-0x10009329,0x10002060,0x8b0959a4,0x200048a0,0x28412841,0x48a02800,0x930992c7,0x08001800,0x10000020,0xececc46c,0xfccaf4ca,0xfd0cf489,0xec89f4a9,0xbbeaeccb,0x10611800,0x00200041,0x20001800,0x28c23924,0x18001000,0x59832000,0x08005a06,0x18800000,0x72251000,0xe46ae4cd,0xf4ccec8b,0xf4ecf4ab,0x9b69e50e,0x10a11000,0x00800020,0x30800020,0xed30cc4c,0x1000bcaf,
-0x08001020,0x18400000,0x9b692000,0xf50bed0d,0xf54df54c,0xdd0eed0c,0x10007266,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000860,0x18001000,0x00001000,0x08000800,0x00200000,0x00000000,0x00200000,0x00000000,0x00000000,
-0x00001040,0x00400000,0x39640000,0x69a25962,0x61206120,0x7a0371c1,0x51a27aa5,0x08001000,0x08001081,0xdd4f7284,0xf52eed2d,0xcb89e46c,0xe4add3aa,0xabe9f56f,0x10a11000,0x10000881,0xf530ab8a,0xf4cceced,0xecabf4ab,0xe52ff52f,0x4900abca,0x18801800,0x61c30000,0xfd6ee52e,0xe550f591,0xb3cbc44d,0xe571d4ae,0x6a25dd72,0x10001800,0x00200021,0x00000020,0x10000800,
-0x10001000,0x08001000,0x08611040,0x00000000,0x20001000,0x698069c2,0x40e048a0,0x08200800,0x08200020,0x59c21000,0x71e07a22,0x38805940,0x10001800,0x08001020,0x08001820,0x00000800,0x08210001,0x08000000,0x49001800,0x82c57222,0x288059a0,0x00000000,0x08000840,0x8b0851c3,0x9b689306,0x00004120,0x10c30041,0x49830000,0xc4adabec,0xdd2ec48c,0xd4cdd4cd,0xd4ced48b,
-0x10007ac9,0x100028a3,0xdd527aa8,0xa349cc8e,0x38004000,0xcc6e79e5,0xdd0ff5b2,0x08002000,0x08001081,0xed6fc4ae,0xfcebe48a,0xfcebec89,0xf4ebf4ca,0xaba9f56f,0x08611000,0x08000000,0x9b49a3ac,0x20003820,0x69623800,0xccd0a349,0x1000a42e,0x10201860,0x40c01000,0xb3679ae6,0xb368bba9,0xab05b347,0x8b69abea,0x00200800,0x00400041,0x08000880,0xabaa7a44,0x30c0936a,
-0x00000000,0x10410000,0x40e00000,0xbbe8a367,0xc44bbbe8,0x8ac6bc0a,0x10401000,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00410020,0x10810041,0x18401040,0x10601860,0x08201881,0x00000841,0x00200000,0x00000000,0x10211021,0x10002061,
-0x00000000,0x00000000,0x00000021,0x18001000,0x10001000,0x10001800,0x00000800,0x00000800,0x00000821,0xc50e5a03,0xed2de56e,0xfd0efd2e,0xecedfd70,0xab88ed2d,0x10401800,0x08000020,0x8ae83880,0xed2ed48d,0xf570f50e,0x7ac6ccef,0x08001000,0x10400000,0x6a030800,0xfd0ced0d,0xf54ef4ec,0xf5d2ed4f,0xbcaee591,0x000059e4,0x08001020,0x00000000,0x10a00881,0x20602060,
-0x18601840,0x10402081,0x00000000,0x00000000,0x10000000,0x18000800,0x08001000,0x00000800,0x00000000,0x08000800,0x18001000,0x08000800,0x18810000,0x10200800,0x51a40800,0x40c093cc,0x08010800,0x18601000,0x08000000,0x10001000,0x00000800,0x00010001,0x00400000,0x08000000,0x18001800,0x00400000,0x00000000,0x10000020,0x18001800,0x10001000,0x10001000,0x39012840,
-0x10011800,0x00000820,0xd5516a66,0xf550e530,0xcc0bd44c,0xfdb0e4ee,0xe52fed2d,0x080048e1,0x00000821,0xc4ad6a66,0xecebe52d,0xf4abfd2d,0xed4ef50c,0x6203b40a,0x00000000,0x20000800,0xed0dd46c,0xa305cc6b,0xe48cab05,0xed51e4ad,0x1000bc6f,0x08001800,0x10001000,0x20002000,0x18001800,0x10002000,0x08001000,0x08001820,0x00000000,0x10200000,0x20001800,0x00001000,
-0x00000040,0x00000040,0x08001040,0x18001000,0x18001800,0x10001000,0x00001000,0x00000880,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x08001000,0x10201000,0x00000800,0x00000000,0x00000000,0x08000000,0x10000800,0x08000800,0x08000800,
-0x00000000,0x00000040,0x10410000,0x08201020,0x08600880,0x10601040,0x08401080,0x00000000,0x00000000,0x51a00800,0xed90b44b,0xf52ef570,0xf52efd90,0xd4cdf54e,0x20a12000,0x08201040,0x18000800,0x9b484880,0x9b28ccae,0x08002820,0x08411081,0x18610000,0x7a641000,0xfd2cecec,0xf54dfd4c,0xd52fed6f,0x18009348,0x08800000,0x00000000,0x00000000,0x00000021,0x20200800,
-0x08001000,0x08200800,0x10400800,0x00000000,0x00000820,0x10810020,0x18200800,0x08001000,0x00000000,0x08200800,0x08411881,0x08420021,0x00001020,0x28601000,0xac0d2000,0xa369f634,0x28821800,0x10201000,0x08201040,0x106120c2,0x08410821,0x00010001,0x00000021,0x20c20020,0x20a11860,0x00210020,0x00000000,0x00000000,0x20421841,0x002118a3,0x08200001,0x00000000,
-0x00000000,0x08400020,0x61e31000,0xf591ccae,0xfdb1f550,0xf54cf52d,0xdd0ded0b,0x08005983,0x18811040,0x18000800,0xd4ad9327,0xed2fed0f,0x9306cc8c,0x08002000,0x08400860,0x59210800,0xeccbd46b,0xececed0c,0xf52ef52e,0xc40cecee,0x10007246,0x08001000,0x08210000,0x08010801,0x10611021,0x10810820,0x10401080,0x00000800,0x00000000,0x08210801,0x10201820,0x00200861,
-0x00200000,0x00000021,0x08400020,0x10630801,0x18821042,0x00210841,0x10211041,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x49441820,0x28002800,0x10003020,0x08000000,0x00000000,0x08200000,0x30a130e2,0x20202840,0x10201840,0x00010000,
-0x00000000,0x10600000,0x10201000,0x10811040,0x00600040,0x08401060,0x08810860,0x00000000,0x08200000,0x08001060,0x72661000,0xe570bc6d,0xfd8ff590,0xed2ff50d,0x18009308,0x08600000,0x20a10000,0x08000000,0x18001800,0x20611000,0x00000820,0x20610800,0x8a442000,0xf52df54e,0xdcedf52c,0x4961a3aa,0x08001000,0x00200840,0x00000800,0x08010000,0x20a20820,0x20202880,
-0x18002020,0x08001840,0x10201020,0x00000800,0x00000000,0x08620000,0x10000800,0x18001800,0x00001020,0x00200000,0x00000000,0x18611082,0x38202000,0x300040a0,0xed4f9285,0xdceded2d,0x20005900,0x10002820,0x10201840,0x00000000,0x08010000,0x10420000,0x10001861,0x10401000,0x00200800,0x00000000,0x00000000,0x08000800,0x08000800,0x08000000,0x00000000,0x00000000,
-0x00000020,0x00000820,0x08001040,0x82c63020,0xf5f2c48d,0xf56df58f,0xedb0fdae,0x00007b09,0x00001040,0x100018a2,0x51411000,0xa3aba3ab,0x10003040,0x20602040,0x18a20000,0x72460800,0xf4ece50e,0xe48bf50c,0xd4aee50e,0x28009329,0x08000800,0x00200820,0x00210041,0x10210000,0x00001000,0x00000800,0x00000000,0x00410000,0x00000020,0x00000020,0x10210800,0x00000000,
-0x00000000,0x10000000,0x00000000,0x00010000,0x00010001,0x00000000,0x10001820,0x10200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x10200842,0xac4f1000,0x8244bc4d,0x51216120,0x000030c2,0x08000801,0x20600000,0x406038e1,0x48c048a0,0x100038c0,0x00001000,
-0x00200000,0x10001840,0x28002000,0x10002820,0x10001000,0x10001800,0x00000800,0x00000000,0x00000000,0x18610800,0x10001000,0x7a841800,0xedb1d52f,0xed6ff54f,0xac4dedd2,0x00003983,0x00000840,0x08a10080,0x10220000,0x08001021,0x00000000,0x20001000,0xd4ae8a86,0xe52eed50,0x6960cc8c,0x08001800,0x08601040,0x00000040,0x00000000,0x10000800,0x20001000,0x30003020,
-0x48c04060,0x30203000,0x20004901,0x08200800,0x00200000,0x08000000,0x48c02800,0x30005901,0x00000800,0x00000000,0x10400000,0x28200000,0x79c350c0,0x79a18245,0xfd6fe4ee,0xf54ef50c,0x5060b3a8,0x59836182,0x10002000,0x00000800,0x08000800,0x18001000,0x388040c0,0x38e15163,0x00201040,0x00000001,0x20200000,0x410138e1,0x59834901,0x49225122,0x41224943,0x31034164,
-0x00001040,0x00000000,0x18c20000,0x10000800,0xac6d2000,0xf611f653,0xf5f1fdf0,0x1800a3cb,0x10002880,0x08220000,0x08001021,0x10001800,0x10810000,0x08001020,0x08001020,0xbc6e2000,0xf52df56f,0xf590fdb0,0x5120bc2c,0x00001000,0x00001082,0x00400000,0x00210000,0x30402081,0x38402820,0x38612800,0x386040c2,0x08002020,0x08001000,0x00000000,0x08000000,0x28a01840,
-0x28002860,0x10003020,0x00200820,0x08010000,0x00000000,0x28801020,0x40c02000,0x38e293ad,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18400000,0xc48e1800,0xe50ded70,0xccced48a,0x00006a88,0x08011043,0x30c10800,0xabaa3000,0xccadd4ce,0xac2bdd4f,0x10201000,
-0x08000801,0x82244080,0x9a449244,0x8a448a03,0x82038a03,0x820181c0,0x516371e3,0x08210800,0x00010000,0x10200820,0x20601020,0x10002040,0x93ab1000,0xf612dd71,0xf675f611,0x0000acb1,0x00200860,0x00200000,0x00200040,0x00000000,0x10200000,0x9b482800,0xfdb1f590,0x8b29d510,0x18002800,0x18402060,0x08400800,0x00220001,0x00000000,0x08001041,0xabec8b2a,0xbc0bb3cb,
-0xb347ab26,0xb389b368,0xa369a307,0x080059e4,0x10201020,0x69e41800,0xa2a59ac6,0xa329a2e6,0x00004121,0x00001040,0x00000860,0xb44c832a,0xdcadcc6c,0xed71d48d,0xf58ff590,0xf54efd8f,0xd46bf54e,0xb3ebc44b,0x8309ac0d,0x10400800,0x10200000,0x7ac72020,0x9ac69b07,0x8aa69285,0x08005183,0x00200020,0x18000800,0x79e369a3,0x926479a0,0x8a039264,0x798281c3,0x616579c5,
-0x08202020,0x00000000,0x00000021,0x20c10800,0x10000800,0xc4ee6a85,0xf58fedd0,0xa2e5ed2e,0x10003000,0x08200800,0x10200000,0x18202040,0x00001020,0x00000000,0x30400800,0xfdf2c48e,0xfdf1fdd0,0x9369dd70,0x08001800,0x10202060,0x00200000,0x00200000,0x00000062,0x79c23800,0x89e281c1,0x89e481a3,0x92658a24,0x92669a65,0x18005921,0x08001800,0x10000800,0x71c25100,
-0x79a17980,0x38607183,0x00401040,0x08010000,0x28c00800,0x618038a0,0xd5108a43,0x1800cd32,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18400841,0xbc4c1800,0xf56ef5b0,0xc4cdedaf,0x08201000,0x08010000,0x18003104,0xf5b192e7,0xf58ffdd1,0xccadf5af,0x10202020,
-0x10000821,0xd44d6941,0xec8ceccd,0xec8dec8d,0xeccdecce,0xeceef4ed,0xbc4eed51,0x08011800,0x08010823,0x08000800,0x104020a1,0x18600800,0x00000820,0xac6b4940,0x9ba9cd2e,0x00005a27,0x00400040,0x08200000,0x00000000,0x00210000,0x00000862,0xdd718b6a,0xab68e50f,0x10003840,0x10410800,0x18610000,0x10001000,0x00000800,0x00210001,0x18000841,0xfdd2d531,0xfd6ff590,
-0xfd6fed0d,0xfd2ffd6f,0xf5b2ecee,0x1000ac0d,0x202020a0,0xc46e2000,0xfd2ef570,0xf571ecac,0x1800b44d,0x000020a1,0x000018e2,0xee138b49,0xfdb0f58f,0xf56ffdd1,0xfe11fdd1,0xfdaffdaf,0xf54dfdaf,0xf5f2f5b0,0x936af655,0x10600800,0x080020c2,0xedd26a44,0xfd4ffdb1,0xfe13fd70,0x1000bccf,0x10601880,0x8b6a0800,0xcc0acc8e,0xd3e9d42a,0xd3c9d3a8,0xbb27cba9,0xa309b2e8,
-0x00006206,0x00001040,0x08210000,0x00001020,0x20c11040,0x10000000,0xdd2f8b27,0xdc8ded2e,0x4963abec,0x08600800,0x00000020,0x10001000,0x00001000,0x00000842,0xacaf20a0,0xedb1edd2,0xbc4ced91,0x100059a1,0x10811060,0x10200000,0x08401040,0x00200000,0x10000041,0xcc0aa349,0xe46bd42a,0xe44ce44c,0xdc2adc2a,0xdc6de44b,0x3000ab49,0x08201000,0x49230000,0xed2fc46e,
-0xecceeccd,0x7a04d48e,0x08401000,0x10410800,0x62660000,0xe54fd571,0xed4fe4cc,0x2000c48f,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18810000,0xa40c1800,0xdd2eedf2,0x51a2bcae,0x08610800,0x10400000,0x59401000,0xf56fe50f,0xf56ef56e,0xcc8cf52e,0x00001000,
-0x10000841,0xdc8d6940,0xec49ec6b,0xec4af4ab,0xec4af4ac,0xecabf48a,0xc44df50e,0x08411000,0x08000801,0x38c05143,0x00000000,0x002018e2,0x18a10820,0x08000000,0x08001000,0x08220000,0x00000000,0x18010000,0x20a21820,0x00000820,0x00000041,0x834b30e2,0x20007227,0x18601000,0x08410000,0x08000000,0x28002840,0x30403820,0x00210800,0x10000883,0xeccccc6d,0xecaaec8a,
-0xfcebec89,0xfcedfccc,0xfd70fd2e,0x1800abeb,0x206028a0,0xcccf2000,0xf4ccf52f,0xe48bfd0d,0x7a24dccd,0x10a30800,0x10000820,0xcd0f1800,0xf54df5d1,0xf5aff58f,0xf58ff5b0,0xfd8efd8e,0xfd8efd8e,0xed91ed2e,0x1800c4ae,0x10420800,0x10000820,0xf56fbc2b,0xfd0cfd4d,0xf570f4ec,0x1800cccf,0x20a12040,0xac4d0800,0xfd4ef5d1,0xfd6efd6e,0xfd6ffd2e,0xfd4efd6e,0xf5b1fd6f,
-0x10009bab,0x10202060,0x00000000,0x20402881,0x10401000,0x10601080,0x59c41000,0xb40da3ac,0x418593ac,0x00000000,0x00410041,0x00000820,0x00210000,0x00000800,0x5a470820,0xac2c938a,0x18006a25,0x20a01000,0x00010000,0x00001083,0x00000000,0x00610020,0x10000000,0xfd6ee50f,0xfd6ef50c,0xfd0efd0d,0xfd2efd2e,0xfd70fd0e,0x4060dcd0,0x10810800,0x40e00000,0xf54edcce,
-0xecacf4cc,0xbbaaecad,0x20203000,0x08200800,0x30e10000,0xe4ccccae,0xecccec8a,0x2000bc2c,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18a10000,0xac6e0800,0x82e5ddd2,0x08002000,0x00400840,0x10600020,0xbcd01000,0xf54df5d1,0xf52df54d,0xcc8df56f,0x08611800,
-0x10001082,0xeccd6940,0xf449f4ab,0xf48afcab,0xfc8afcab,0xf489f489,0xbbeaecab,0x10811000,0x080010a2,0xd572934a,0x20608bab,0x18400800,0x00001020,0x18a01080,0x18c20000,0x00001882,0x08000801,0x38812821,0x20002800,0x18401000,0x00000020,0x08000800,0x20620800,0x00201040,0x00000800,0x28202061,0x82664880,0x5962b3ec,0x08410800,0x18000862,0xfccccc2b,0xfccaf48a,
-0xf4aafcaa,0xf46af44a,0xecedfcab,0x1800a38a,0x20202060,0xbc0c2000,0xec49fd4f,0xecabf4aa,0xd510f56f,0x00003923,0x18400800,0x7ac61000,0xed4fd50f,0xed4ded4e,0xfd6ef56e,0xecebf50c,0xe4eced2c,0xabcbe52f,0x10003860,0x18631821,0x6aa80000,0xececedb2,0xf489ec89,0xf52ffcec,0x2800c46d,0x20401000,0xac0b1800,0xe489e50d,0xf4ebec89,0xf4cbf4cb,0xecebecaa,0xed4ef50c,
-0x18009b89,0x08002040,0x8b6c4944,0x59626a06,0x10004101,0x10a10000,0x00000841,0x49431800,0x10001000,0x00200800,0x00000000,0x30e22060,0x00001000,0x10201820,0x00000000,0x10001800,0x20820800,0x08001820,0x18201020,0x30801000,0x20805a06,0x08410000,0x20000821,0xec8ad44b,0xf4cae468,0xf46af48a,0xec49ec49,0xf4cdf46a,0x4020d46d,0x08800000,0x30400000,0xf4ecd46b,
-0xec49ec6a,0xf52ffced,0x180069a1,0x00002060,0x00000062,0xdcac7a03,0xe48becab,0x2800cc8d,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08210000,0x62a90000,0x10005a05,0x10402040,0x00200000,0x00200020,0xa44e0800,0xfe31edd1,0xf56ef5af,0xc44cf58f,0x00001800,
-0x10001082,0xe4ac6100,0xf48af4ab,0xf48af4aa,0xfcabec49,0xf4caf4aa,0xc40afd0c,0x00401000,0x100010a2,0xf6139327,0xcd30f654,0x200082c7,0x10001800,0x00000800,0x00200840,0x10200000,0x38a12020,0x50403000,0xab27ab28,0x20005900,0x10611840,0x20820800,0x00001861,0x00000020,0x40c12020,0x8a653800,0xed50d46d,0x7203e572,0x10800800,0x18000000,0xfd0dd44b,0xf4abf46a,
-0xfcccec49,0xec8bf4cc,0xf52efcec,0x1800a369,0x180030a0,0xabab2000,0xfccbeccc,0xf52df4cb,0xe591f58f,0x00006ac9,0x080020a1,0x10001820,0xabca6a24,0xed2de52e,0xf4cbeceb,0xed0cecaa,0xc48de52e,0x10007aa7,0x10410000,0x10220000,0x5a060000,0xed4fcccf,0xf4ebf4ec,0xf54fe48a,0x1800bc4d,0x28411800,0xb3ec2000,0xfd2ced2e,0xfd2cf4eb,0xfd4ef50c,0xfd4dfd2c,0xf58ffd8e,
-0x2000a3aa,0x18002060,0xd5106181,0x9263cc6c,0x51636120,0x00002880,0x18810820,0x08001820,0x18202060,0x20200800,0x594040e0,0x50c06140,0x38e15143,0x08001000,0x10601020,0x18401880,0x08201041,0x18001020,0x48402000,0xcc6d8a23,0x5961cccf,0x08000800,0x20001022,0xf48bc3c9,0xfc8bf48a,0xfcccfc8b,0xf48af4ab,0xec4afc69,0x5060cc0a,0x08601000,0x18000000,0xf4abc3ea,
-0xf449ec29,0xf52ff4ac,0x2800bc2d,0x00410000,0x10200021,0x7a042000,0xd42bc389,0x3800b389,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x20a00000,0x10200800,0x00001020,0x00201081,0x10000800,0xcd0d7284,0xf5f1f611,0xc46cf5b0,0x10621000,
-0x18001041,0xdc8c6100,0xfccbecab,0xfccafccb,0xf4abf4ab,0xf4aafcab,0xcc2af50c,0x00201000,0x08001081,0xfe539326,0xfe12fe32,0xbc2ded91,0x30a15984,0x10610800,0x00000000,0x38c02040,0x612040a0,0xd46dab49,0xecedeced,0x8a85d44b,0x18002800,0x10002841,0x08200000,0x08200041,0x50603880,0xeceeb369,0xf54ff4ed,0x69a1dcad,0x08801000,0x20001080,0xf4accc2a,0xf4acf4ac,
-0xfcccfcec,0xfcedfd4e,0xf52eec8a,0x1800b40c,0x28602040,0xb40c2000,0xe48ae4ed,0xe50deccc,0x61c0bc2a,0x08410800,0x08000000,0x18401040,0x20000800,0xc42a7a02,0xf56ff56f,0xe54ff56f,0x2800a389,0x08000800,0x00000882,0x10010801,0x10001021,0xa3893020,0xfd90ed70,0xed6ff54e,0x1800cd10,0x20400800,0xbc2d2000,0xfd4dfd90,0xfd2dfd4d,0xfd4efd2d,0xfd2dfd2d,0xed6ffd6d,
-0x1800a3aa,0x100028c1,0xdcee6160,0xe48ceccc,0x79e3bbaa,0x38a15962,0x00000800,0x18400800,0x28801820,0x71e45164,0xbba98202,0xab07d46d,0x59206940,0x38c05963,0x00000800,0x08200000,0x08000000,0x20001000,0xcc4b8244,0xeccdecac,0x4020c40b,0x10421000,0x20001022,0xf4abcc0a,0xfc6aec29,0xf449f429,0xf46af48b,0xf46aec08,0x5060cc0a,0x10401800,0x18000000,0xec8bc3c9,
-0xf4abf48b,0xed91eccc,0x6226dd93,0x08610000,0x00000000,0x20001800,0xa34958c0,0x4060b40d,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001061,0x28c20800,0x080028c4,0x08001040,0x10400000,0x10000800,0xcd0f82e7,0xcd2eedf1,0x00201000,
-0x10001041,0xe4ee50a0,0xf489f4ec,0xfccaf4a9,0xf4abfceb,0xf4cbfcec,0xc42af50c,0x08601800,0x100018a1,0xfe539367,0xfdd1fe12,0xf5d2fdd1,0x51a3d551,0x10820000,0x20200000,0x58c048c0,0xd44b9284,0xf50df570,0xec8aecab,0xecacf4cc,0x7183bb69,0x10002800,0x00201861,0x18000000,0xc42b7203,0xf4ecf52f,0xec8bf4ab,0x79e3e4ae,0x00401000,0x10000860,0xf4accc2b,0xfcccfced,
-0xfcedf4ac,0xfd2dfd2e,0xfdb0fd0c,0x1000bc6d,0x18202060,0xb46e1800,0xe50ef591,0x8ac6d4ae,0x00001800,0x00000840,0x08620020,0x00210021,0x20601880,0x20001000,0xcd5193ab,0x5160ac4d,0x10001000,0x10401860,0x08800000,0x00200020,0x10610000,0x10000800,0xb44c6a25,0xedb1e590,0x1800c510,0x20800000,0xc44d2000,0xfd2ef590,0xf48afd0c,0xf4cbf4cc,0xf50bf4cb,0xed6ff52c,
-0x10009bab,0x18002081,0xdccd71c0,0xe429f4cc,0xe46cf4cd,0x6120aae7,0x00002020,0x08200020,0x48c01800,0xab076960,0xf4ace4ac,0xf48cec6b,0xa2c4d3ea,0x61617140,0x10614184,0x00000000,0x08000020,0xa3275141,0xf4cce4cd,0xf4acf48a,0x3800c3cb,0x00210800,0x18000021,0xfcebdcac,0xfccbfcaa,0xe3c6e3c6,0xfcabf48b,0xf4ecec69,0x50a0d48d,0x10211000,0x20000000,0xf4ecc40a,
-0xf54ef50c,0xbc8ded70,0x10805a66,0x00000000,0x08000840,0x20610800,0x08001000,0x10203965,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30602060,0x280038a1,0x18001800,0x08001841,0x188110a2,0x28201000,0xb4eeb4ac,0x08400000,
-0x10001041,0xe4ee4860,0xfcaafced,0xfceafcea,0xfd0dfceb,0xf4cbfcec,0xc409fd6e,0x10a01000,0x10001080,0xf5f19b67,0xfe11fe12,0xf5b0fdd0,0x2020b48d,0x00001020,0x10000820,0xe4ce8225,0xfd6ff52f,0xfd0dfd8f,0xfcecfccc,0xfcccfcec,0xecf0ecad,0x3820b3ac,0x08400800,0x18000800,0xf5d1ccf0,0xf4cbeccc,0xf48bfceb,0x8a86e48d,0x10a11000,0x10000040,0xf52ed48d,0xfd0cf4ec,
-0xf4ccf4ac,0xfd0cf4cb,0xecccf4aa,0x1800abeb,0x18402080,0xac4e1000,0x8aa5ccef,0x18003800,0x08801860,0x00000020,0x10201061,0x10210000,0x08001000,0x000020c1,0x20800000,0x08001000,0x000018a1,0x10000800,0x080030c0,0x10810820,0x00000000,0x18c20841,0x18000800,0xcd7182e6,0x0800bd11,0x18800000,0xc48e1800,0xfd2ded2e,0xec4afd2e,0xfd2cf50c,0xfd6efd2d,0xf5d1f52d,
-0x10009b6a,0x10002081,0xdccd71c0,0xfc8bf4cc,0xf4acfc8b,0xab8aecad,0x00003080,0x08000040,0x9b483880,0xeccdd4ad,0xf44af4ab,0xfc8bfc6a,0xecacfcec,0x9284d40a,0x30e248c0,0x00001000,0x08000861,0xed919b8a,0xec28ecab,0xf4acfcaa,0x4000cc2c,0x08410800,0x18000020,0xfccbcc4b,0xf469ec48,0xf48af449,0xf48af48a,0xf50ef4ab,0x5060d44d,0x10221000,0x18000000,0xf590bc2b,
-0xdd2ffdf1,0x18009328,0x00000000,0x10000820,0x20601820,0x00000800,0x10e30841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x69a32840,0xc3aa9245,0x3000ab69,0x20a31000,0x00001062,0x000018a1,0x31620000,0x00001860,
-0x10000800,0xdcce5100,0xf4a9f4ec,0xf4cafcca,0xfd0cf4cb,0xeccaf4ca,0xb3e8ed2c,0x08801000,0x080010a1,0xf5d0a3c8,0xfe11f5d0,0xe590fdcf,0x00005a03,0x10201860,0x20000800,0xfd2ed46d,0xfd0df4cc,0xfcccfcec,0xf46af44a,0xf469f449,0xf4eefced,0xc44cf54f,0x00001800,0x10001881,0xe50f9b49,0xf4cbecab,0xecabf489,0x8a86f530,0x10c20800,0x18000820,0xfdd1d550,0xec8af52d,
-0xfd2df4cc,0xf50bfd4d,0xecace428,0x1800bc2c,0x08001840,0x49a61000,0x10001000,0x10400800,0x00001060,0x18c10040,0x38201000,0x28006a26,0x18001000,0x18410800,0x00001040,0x106018a0,0x08000000,0x18001000,0x7a663820,0x20005101,0x08012062,0x00000000,0x10401081,0x10000800,0x08205248,0x18800000,0xc4cf1800,0xf52cf5d0,0xf4ecf4ec,0xf52cf50b,0xfd4ef52c,0xf591f52e,
-0x10009349,0x100020c2,0xdccd7201,0xfcccf4cc,0xfcedf48b,0xc40beccd,0x10211800,0x08000880,0xf5b0c48d,0xf4ecf54e,0xfcabf48b,0xfccbfd0c,0xfccbf48a,0xeccdf4ab,0x5900bba9,0x00211000,0x00000861,0xd4ce59a0,0xfc8bec4a,0xf4ecf469,0x3820d4ae,0x08400800,0x10000021,0xfcedcc2c,0xfc8afcac,0xfcabfcab,0xf469f489,0xfd2ff48b,0x4840cc2c,0x08011800,0x08001062,0xdd91bccf,
-0x5160ac4c,0x20401000,0x08401040,0x10201081,0x18001800,0x08212061,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x10800020,0x8b291000,0xeccee4ef,0xc42ce4ef,0x18007245,0x18811000,0x08a10840,0x00000881,0x10200000,
-0x08001041,0xdd515120,0xf52efd90,0xf54ffd6f,0xf54ff54f,0xf58ffd8f,0xbc8df612,0x10c10800,0x10000860,0xee12a40b,0xf632edf1,0xbc8cf612,0x18810800,0x10001000,0x72c90000,0xdc8cd50f,0xe46be48c,0xfcece408,0xe42aec4a,0xecabe429,0xf54ff50e,0xedb1ed2e,0x00008329,0x080018a2,0xbc2d3000,0xf52ee50f,0xe4cde4cc,0x61a3dd10,0x08400800,0x10000800,0xc4aeac6e,0xcc4acc8c,
-0xdcaddcad,0xd4abd48a,0xcc4cd46b,0x18009329,0x08201040,0x00000000,0x08610841,0x08200020,0x20600800,0x18002020,0xbc8d69e3,0x9babdd72,0x08003080,0x10011001,0x08400000,0x00200020,0x08410000,0x49410800,0xe551b40d,0x8a86ccaf,0x28203820,0x08002861,0x08400800,0x000018a2,0x00000000,0x18a00840,0xb48e1000,0xedb0edd1,0xfdd1fe12,0xfdb0fdd0,0xfdd1fdd1,0xf613fdd1,
-0x1000938a,0x10001881,0xe56f82c5,0xf50df52e,0xed0df50d,0x8243dced,0x20811800,0x6ac70000,0xed4dedf1,0xf50cecec,0xfccbf4eb,0xfd2cf4cb,0xfccafcca,0xe48afcec,0xbc2cf54f,0x10611000,0x20a00000,0x93071800,0xec4bf50f,0xed2feccc,0x3840c4ae,0x08810800,0x18000000,0xf4edcc2c,0xf46aec6a,0xf4cbecab,0xec69f4aa,0xf4cef46b,0x4020cc2d,0x10621000,0x00000000,0x62657b08,
-0x10001000,0x10411841,0x10200820,0x20001000,0x7a048245,0x20813040,0x00210000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x30e00000,0xdd0f8b08,0xe4cdd48c,0xb40be50f,0x10005980,0x18a20800,0x08220021,0x00000000,
-0x00000021,0x938b30a0,0xabaaabeb,0xabababaa,0xabcba38a,0x9b6aa3aa,0x7b29a42d,0x18a10000,0x00001061,0xb4cf72e8,0xb4aeac6e,0x49a2b4ae,0x10420000,0x18420000,0x39640000,0x8b076a86,0xbbea9b07,0xecacecac,0xfdb1fd90,0xed90fdb1,0xdd92d50f,0xc52fd52f,0x00007b6b,0x08200821,0x51840800,0x92e78ae8,0x7a8582a5,0x28a06225,0x00000000,0x10201000,0x08000800,0x30201800,
-0x38404060,0x30803040,0x18002800,0x08001000,0x00000000,0x08200000,0x00400000,0x10000000,0x28002000,0xab495040,0xf674ee13,0xe634f654,0x00006aa8,0x00001042,0x00620000,0x00000821,0x10610000,0x62880000,0xe5b1d592,0xf58fdccc,0x6940c44b,0x20003000,0x00001861,0x10200800,0x00210841,0x08000000,0x62051000,0x938982e8,0xa3eba40c,0xbcafb44d,0xd551d551,0xddd3dd91,
-0x00006ac7,0x080020c2,0xe5b16a44,0xedafe58f,0xee12f612,0x2000bcad,0x20c11820,0xb5310000,0xf5d1fe75,0xed2cf5af,0xf4ebf50b,0xecabf50d,0xfd4df4eb,0xfd6efd4d,0xf5f2f54e,0x080072a8,0x100018a1,0x40a00800,0xdd10c46e,0xdd92d50f,0x1000b48f,0x00201020,0x10000841,0xed6fcd0f,0xf52eed0d,0xed0ded2d,0xe46aeccb,0xe4cdecab,0x3000bc4d,0x00410000,0x08400000,0x08000000,
-0x100020a2,0x10810020,0x18000000,0xc3eb7a03,0xdc8de48d,0x2040a3ab,0x00011000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08420000,0x00000801,0x102020a3,0x00000841,0x8b071000,0xfdf1ed70,0xfe12fdd1,0xb44dedd2,0x10005162,0x18830800,0x00000842,
-0x00210001,0x10000800,0x18001800,0x20002000,0x18001800,0x18001800,0x08000800,0x00001040,0x08200000,0x00000000,0x08000800,0x00000800,0x00000820,0x08010000,0x00000821,0x08000000,0x61602000,0xfdf2ed91,0xfe74f5f1,0x69e1e591,0x20402000,0x10001800,0x08201000,0x00000001,0x08000841,0x18001000,0x08001000,0x00000800,0x00000000,0x00000800,0x00420862,0x00000820,
-0x08000800,0x00000800,0x00000000,0x00000841,0x00000020,0x00000000,0x10200000,0x302028a1,0xa32950a0,0xfdb1f592,0xee53edd1,0x8308d591,0x10400800,0x10420801,0x08000000,0x10011021,0x00000800,0x08000020,0xccee5180,0xed4df5d0,0xed70f58f,0x4860abaa,0x38a140a0,0x08001800,0x00200820,0x08000000,0x10001800,0x10001000,0x10001000,0x10001000,0x10001000,0x20201800,
-0x00001020,0x08000801,0x61e12860,0x82c47a62,0x9c2b93a9,0x00006286,0x08200840,0x838b0000,0xc4aeb48e,0xd50dccee,0xfd8fed6e,0xfd4efd4f,0xfd8efd6d,0xe54fed8f,0xc4eed4ed,0x00008bac,0x00001860,0x08001020,0x6a254921,0x51a36204,0x08003922,0x00001040,0x08000020,0x9b677ae6,0x9b0592e4,0x9ae69b06,0x9aa39aa4,0xa347a305,0x10007266,0x00000800,0x00000020,0x08011082,
-0x18200800,0x10002040,0xa3eb38e0,0xe48cdcce,0xd42cec8c,0x202082a8,0x08010800,0x00000801,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x08001022,0x10001000,0x10200801,0x180020c0,0xfe33bc6c,0xfdb0fdd1,0xf5d1f58f,0xabebedb1,0x080040a0,0x00220000,
-0x00010001,0x20801020,0x18401840,0x18202060,0x18610820,0x10201840,0x08211883,0x08000000,0x08000801,0x10a00860,0x18611840,0x10401020,0x08200000,0x00001040,0x08410841,0x20801040,0x18002080,0xe5b19b69,0xe550e54f,0x1000936a,0x10001840,0x18200800,0x00200800,0x00010001,0x10600000,0x18401861,0x18a01880,0x082018a2,0x00000000,0x00000000,0x00200020,0x10610000,
-0x08001881,0x18421000,0x00420062,0x00400041,0x00000000,0x08000000,0x18002060,0x82034020,0xf570c40b,0xed6ffdb0,0xcd0fdd4e,0x080038c0,0x00001040,0x10000000,0x30203880,0x20202000,0x08001861,0x10810000,0x28001000,0xfe32c4ad,0xfe32fdf1,0xe50ffe33,0x50409a86,0x286040a0,0x08001820,0x08000000,0x18001000,0x208128a2,0x18601840,0x18611862,0x08200840,0x08000000,
-0x08010000,0x08010000,0x08000800,0x08000800,0x00001000,0x08400000,0x00210020,0x08001020,0x18001000,0x49411800,0xd52f7264,0xf52dfdb0,0xe54ef52d,0x61e39b89,0x10004160,0x10211820,0x00200000,0x00200020,0x00000000,0x00000800,0x00410000,0x00000000,0x08400020,0x18001000,0x18001800,0x10001800,0x18001800,0x10001800,0x08200800,0x00000000,0x00000000,0x08200000,
-0x18001881,0x82012800,0xf570dccd,0xe4adf52e,0x6162d48f,0x00001000,0x18621061,0x08001862,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x836d0800,0x18008b4b,0x10210800,0x100018c0,0xf5d282a5,0xf56fe4ed,0xfe11fe11,0xf613f5d1,0x93abe5d3,0x00820000,
-0x00000821,0x10000800,0x10001000,0x18401020,0x00001061,0x00000000,0x00010001,0x08010001,0x00000800,0x20a11020,0x10220800,0x00000000,0x00000800,0x18401000,0x18201000,0x20602060,0x20601040,0xb46d1000,0xbc8ef634,0x18821000,0x08001061,0x18001000,0x08000800,0x10611020,0x00000000,0x00000000,0x10200000,0x20601000,0x00001040,0x00000020,0x00000000,0x10001020,
-0x20201800,0x20002800,0x08411821,0x00000000,0x00000020,0x10000820,0x7a452800,0xf591cc8d,0xfdd0fd6f,0xfdd0fd8e,0x7a84f612,0x20c31000,0x18600000,0x40403081,0xb40c6960,0x38408ac7,0x18002820,0x00001042,0x100020c2,0xedb18264,0xed0cf56f,0xf54ff54e,0xd4aefd91,0x200069a2,0x10001800,0x00000000,0x08000000,0x08000800,0x08000800,0x00000000,0x08400000,0x08200000,
-0x00010801,0x00000822,0x18a10000,0x18c10840,0x21231080,0x00000882,0x00000021,0x20610800,0x208128c2,0x08000800,0x7aa60800,0xed70ed91,0x8242e52f,0x00001800,0x08200000,0x08000000,0x00000801,0x00200000,0x08610881,0x18610820,0x00010842,0x00000001,0x00000020,0x20801840,0x106018a1,0x106210a3,0x20c21882,0x10a01080,0x00201081,0x00200000,0x00000020,0x080020a2,
-0x49001000,0xed4eb3c9,0xecccf52d,0xdccefd4f,0x180050c0,0x002018a2,0x08001840,0x10001000,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000001,0x00000000,0x00000000,0x18800000,0xb4cf1000,0xcd50f654,0x00003942,0x100018a1,0xe5b17a43,0xf632f632,0xc4eecd2f,0xf611f612,0xddd1f631,0x00002920,
-0x08001040,0x10001000,0x20202000,0x18001000,0x18001800,0x08000800,0x00000020,0x00000021,0x308128a1,0x20001800,0x08001000,0x00200000,0x49440800,0x30005141,0x30003840,0x18002800,0x18811800,0x51e40800,0x6225bd31,0x10630000,0x20410000,0x488048e3,0x40604060,0x18003000,0x08411840,0x10000000,0x18001000,0x20002800,0x08001000,0x00000000,0x10400000,0x28002020,
-0x48204020,0x50404820,0x40405060,0x10003020,0x08201020,0x51611000,0xe4eebc0b,0xfdb0fdb1,0xececfd6f,0xfd8ffd4d,0x6a03e5b0,0x10201000,0x28800000,0xab2758e0,0xfdf1ed4f,0xc44ced91,0x300079c2,0x08011800,0x10001041,0xf57071e3,0xfdaff52e,0xf5aff58f,0xfe54fe33,0xb44dedd3,0x08003880,0x00410000,0x21030020,0x492330e3,0x38a138a1,0x30e238c2,0x208130c2,0x00000800,
-0x00000000,0x00610000,0x20a020a1,0x00001000,0x00000020,0x00000000,0x20a20821,0x20202881,0x18600800,0x08000800,0x080018a2,0xe6358b8a,0x1800ac6e,0x10a220a1,0x08000000,0x08000800,0x08000800,0x00200000,0x00000040,0x08001000,0x18621021,0x00000801,0x00400020,0x08000000,0x00200020,0x08010801,0x00210021,0x00200021,0x00000000,0x00000001,0x10200000,0x30201000,
-0xe54fb42c,0xed4df5b0,0xfd70f54e,0x9b28fdb2,0x20c02000,0x08000820,0x72871800,0x5162a40d,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18600000,0xb4ad1800,0xddb0f652,0x000049c3,0x080018a1,0xee547286,0x9ba9ddd2,0x18001800,0xcd0e82e6,0xd5d1ee32,0x00003140,
-0x00001040,0x38e12880,0x49004080,0x388048e0,0x30604080,0x10401820,0x00000000,0x08200040,0x61a42820,0x726861c4,0x080051a6,0x00000840,0x48e13081,0xabca92e7,0xb40cabca,0x8ae8bc4d,0x10401000,0x00001040,0x00001000,0x08001041,0x40c21000,0x58a05060,0x71c26940,0x72657a44,0x08001000,0x08000820,0x72892041,0xa38a932a,0x18008b49,0x08211020,0x00001082,0xbcb0730a,
-0xbbebc46e,0xc3ebbbca,0xbbebc3eb,0x18008ae8,0x20a10800,0x9bcb1000,0xed50e591,0xd44ce50f,0xfdb1e50e,0xe52de4cc,0x4940d550,0x10400800,0x51600800,0xfdb0bbea,0xf50cfdaf,0xfdb0ecec,0xa307e4ed,0x08004080,0x08001062,0xdcce6161,0xf58ff54f,0xe5b0f5f1,0xf654f654,0xf655f634,0x2860bcf0,0x08610000,0x00000000,0x38203040,0x48204020,0x50a050a0,0x382050c0,0x10001800,
-0x00000000,0x00000060,0x40a02000,0x20203020,0x00210800,0x08400000,0x30401000,0x61835921,0x30a048e0,0x00002881,0x00001042,0x62c80000,0x08002060,0x08200841,0x30a128c2,0x490340e2,0x286140e3,0x00000820,0x00000000,0x10000800,0x18002000,0x10211000,0x00000000,0x08010000,0x18200000,0x30402820,0x10002820,0x18401820,0x18601800,0x00210000,0x08001042,0xd5517ac8,
-0xfe53f633,0xedd0fe53,0xf5b0f5af,0x5961e592,0x18800800,0x10000800,0xe5d3a40c,0x40a0e5b3,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20400000,0xb46c2000,0xdd6ff611,0x000049a3,0x00001061,0x944e5246,0x08003920,0x20611000,0x08000800,0xacf08bcb,0x00003962,
-0x10001040,0xcd312000,0xe590ddb1,0xe590e5d2,0xe5f1e590,0x0800a44d,0x00001080,0x18201060,0xcd303820,0xd5f4ee75,0x00005226,0x204018a0,0x92e84020,0xf5f2edb1,0xfe54f612,0xe590fe32,0x100059e3,0x00200840,0x08410000,0x20200000,0x82263800,0xe591dd11,0xed91ed92,0xee54edd1,0x00007b2a,0x108118a2,0xbd120800,0xedb2fe76,0x82e7edf3,0x18831000,0x00000862,0xeeb75246,
-0xf611f694,0xfdd0f5d0,0xf5d0fdaf,0x4100cd2f,0x20610800,0x8b6a1000,0xa3aacd51,0x48607a26,0xbc6d6a04,0xf613ed91,0x1800d571,0x18600000,0xb40c1800,0xfd4df590,0xf4aafceb,0xf4abf48a,0xf56ffd4c,0x2000abab,0x00001861,0xcd1040c0,0xc48dedd3,0x72859389,0xddd3b4ae,0xee34ee34,0x4961cd51,0x10200800,0x83490800,0xb3a9abcb,0xd44bc3ea,0xbb69c3ca,0xbbebc3a9,0x10007a87,
-0x18401820,0x5a050000,0xbbcabc2c,0x8287bc0c,0x10411000,0x08000841,0x9ac66181,0xab27ab27,0x7a03a327,0x18003020,0x10220800,0x00000820,0x10200000,0x10000800,0x60c04880,0x60a068e0,0x38205040,0x00002040,0x08000800,0x49440000,0x7a457a65,0x10003020,0x00200020,0x08000842,0x72244142,0x922292a4,0x92858a02,0x7a038244,0x280069a1,0x10400800,0x51a50800,0xf655e615,
-0xc4efe5d3,0xc52f9bea,0xee12ee12,0x4940ddd2,0x18a10000,0x51820800,0xf5b1e571,0x4880d50f,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200000,0xb46c1800,0xd56ff652,0x00004182,0x08000840,0x00000000,0x20c20000,0x10011001,0x10611063,0x00000000,0x08001040,
-0x08001040,0xe5f33040,0xfe52fe53,0xfe31fe52,0xe5d1fe11,0x08008328,0x00001081,0x180028c2,0xf633ac0b,0xa46dee74,0x18a00000,0x28401040,0xdd105900,0xfe11fe12,0xfdd0fe32,0xedafed6d,0x1800cd0f,0x08820820,0x00200041,0x30c10000,0xdd114840,0xf5f2fe34,0xfe12fe13,0xf673fe11,0x28a0d5b3,0x10a10000,0x7b090000,0xfe13f634,0xcd0ff5f2,0x10002000,0x18e30021,0xac8e0800,
-0xf611f694,0xfdaefdef,0xfdf0fdce,0x4980ddb0,0x10200800,0x39420800,0x18004120,0x10001000,0x10000800,0xbccf7aa6,0x1000ac8f,0x18800840,0xc4ae1800,0xf50bfd90,0xfcebfceb,0xfccbfccb,0xf56df4a9,0x2000ccae,0x00001020,0xac8f1000,0x20009bcb,0x08001000,0x30a00800,0xcd518328,0x38e0bd31,0x08001000,0xcd713100,0xfd70f5f2,0xfd6ffd6f,0xf4eef4ed,0xf591eccd,0x10009b8a,
-0x20801840,0xbc8f1000,0xf52ffdf3,0xa36bf571,0x18621800,0x20000800,0xf54fccae,0xfd70f50e,0xf5d3fdf2,0x20007a66,0x00001821,0x10810000,0x18400840,0x936c1000,0xe4f0d4f0,0xe4efed0f,0xab8bdcf0,0x20602800,0x18620000,0x5a260000,0xedd3dd92,0x2000930a,0x00201880,0x00000820,0xd55151e4,0xeceded90,0xf52ff52e,0xed50f52f,0x2800c46c,0x10401000,0x51a41000,0xa40cc552,
-0x18005162,0x10000800,0xc50f8b67,0x30e0c571,0x10400000,0x72661000,0xfdb0ed50,0x4040e551,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200801,0xbccf1000,0xd5b1f674,0x00003961,0x00000840,0x20a10000,0x204028a1,0x20822081,0x10411861,0x10202082,0x00000820,
-0x10000821,0xddb34900,0xf5d0fe54,0xf58ffdcf,0xa3caedd1,0x20a21000,0x18620000,0x69e42000,0xf674ee13,0x1000b4ae,0x18400800,0x20002080,0xfe13bc2c,0xfe32f5f1,0xfdb0fe12,0xed6ff58f,0xabebfe33,0x10810800,0x00000000,0x18001881,0xfe54a3eb,0xf5f2f5f2,0xf5aff5f1,0xf5f1f5b0,0xac6df654,0x21030000,0x100018c1,0xfe54c4ce,0xfe54fe33,0x10009bcb,0x082018a1,0x28200800,
-0xee12ddd2,0xfdd0fdf0,0xfdd0f56e,0x6203d550,0x10610000,0x00000000,0x18a10000,0x10611861,0x18a11081,0x08000000,0x080041a5,0x10000820,0xc4af1800,0xfd6dfdd1,0xfd4dfd6e,0xfd4dfd2c,0xf54efd2c,0x1800cccf,0x08810000,0x00000000,0x10000800,0x20a11840,0x08002081,0x00000800,0x20a149e6,0x00001021,0xd59049a1,0xf50cfdd0,0xfd0cf4ca,0xf52efd2d,0xd4adf50e,0x000040c0,
-0x08001081,0xe5515942,0xf570ed0e,0x3820e571,0x20a20800,0x8b280800,0xf52ced6f,0xfdd1fd6e,0xfeb6fe32,0x2000cd31,0x00201860,0x00000840,0x08000840,0xdd924920,0xfdd1fdf2,0xfdf2fdd1,0xedb1fdf2,0x20007a66,0x08001800,0x10001881,0xf634c4ef,0x69a2e571,0x18611000,0x18610800,0xb4f10000,0xf58ff5f2,0xfd6ffdd0,0xfdb0fd4e,0x3020d4ee,0x00200800,0x20800000,0x000020a0,
-0x18611000,0x088018c1,0x08000800,0x18603963,0x18a10000,0x82e90800,0xf570ed71,0x4020e530,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000821,0xcd931000,0x8368cdb2,0x00001080,0x08000840,0x28801000,0x492238c0,0x180040c0,0x08001000,0x18202040,0x00000000,
-0x00000862,0xe61538e0,0xfe32fe95,0xf5d0f5af,0x4920ee13,0x08200800,0x30c30801,0xcccf3000,0xf654fe74,0x1000c510,0x20602080,0x7ac70800,0xfe12edf3,0xfdf1f5f1,0xfdb0fdd1,0xfe12fdd1,0xddb2f5d1,0x000030c1,0x10600820,0x52050000,0xfe94e613,0xf5f1f632,0xfe11fe11,0xf5f1fdd1,0x9c0bf653,0x10810800,0x08001080,0xfe549348,0xf5f2f5f1,0x5161ddb2,0x10401000,0x10002061,
-0xfe957ae7,0xfdd0fe11,0xedb1f5af,0x6a46e5b3,0x08810800,0x00200000,0x08400820,0x18600820,0x00001081,0x002010a1,0x08000000,0x18210000,0xcd111000,0xfd6efdd1,0xf52dfd6e,0xfd6efdaf,0xf56ff4ec,0x2020d551,0x00200000,0x00200000,0x102018a1,0x20201000,0x18001800,0x108220c3,0x00000000,0x00001062,0xdd9151c3,0xfd4cf58f,0xfd2cfd2c,0xf56ff52c,0xabcaed70,0x10801000,
-0x10001081,0xf5b1abcb,0xfdd1fd6f,0x1800b44c,0x00002081,0xcd3130a0,0xfd4cfdaf,0xfdf1f56e,0xf633fe32,0x9becfe75,0x10c10800,0x00200840,0x000010a1,0xf5f2bcae,0xfdaff58f,0xfdb0fdb0,0xfe32f5af,0x3820ccae,0x10411800,0x10000820,0xe5b17284,0xccadf5f2,0x20402800,0x10201000,0x10000000,0xfdf1cd0f,0xfd2df56e,0xf58ff52d,0x2000ccce,0x08410800,0x00000000,0x10c20000,
-0x18211001,0x00000000,0x20c128c2,0x00000000,0x10400000,0x8b4a0000,0xfdb1fdf3,0x50a0e551,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6ac920a2,0x080028a0,0x08210000,0x18200000,0x49223081,0x50405921,0xa3695880,0x7225b42d,0x10002000,0x000020a2,
-0x10610000,0x72e80000,0xee33bd10,0xee52ee11,0x000093cb,0x002010a1,0x18002081,0xfe359308,0xfe33fe12,0x8349f6b6,0x28e10800,0x93ab1000,0xfe52fe74,0xfe11fe73,0xf54fed2e,0xf5f1fdb0,0xa42dee13,0x08210800,0x20c20821,0x72ea0800,0xf653f6d7,0xfe11f5f2,0xf5cff5cf,0xfe53fdf1,0x0800cd91,0x10401020,0x080010a1,0xf5f27a85,0xf5affdd0,0xb46dedf2,0x10610800,0x20600800,
-0xb4ae1000,0xf5d0f612,0xee13fe73,0x2881b4b0,0x00000000,0x08200840,0x20200800,0x18002820,0x18201800,0x08201060,0x08220001,0x10000821,0xb48f1000,0xed0dedb1,0xfdaff56e,0xf54ef54e,0xf58feccb,0x1800bc8e,0x00200800,0x00000021,0x18000000,0x30002800,0x40414860,0x08000800,0x00001042,0x00000020,0xc4f03901,0xfd8ef5d1,0xf52cfd4d,0xed8ff56d,0x40a0d50f,0x18600800,
-0x49000800,0xf56fed71,0xe56fe50c,0x00006a65,0x100028e2,0xe5d38b8b,0xfdeff56e,0xf5f1fe11,0xf5f2fe53,0xe5d3f613,0x080049a3,0x18600800,0x49c40000,0xedb0dd71,0xfe10f5ae,0xfd8efdaf,0xf5d0f5cf,0xa3cbf5f2,0x08011000,0x08001040,0xcd2f2820,0xfdf1f58f,0x2000a3ab,0x08002882,0x10001842,0xd54f5160,0xf58efe11,0xedb0fd8f,0x38a0d531,0x08210800,0x00000000,0x006000a1,
-0x18001800,0x390138e1,0x08001000,0x00001862,0x18a20001,0x72c60000,0xf5d0edf1,0x4860e531,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610000,0x00010000,0x10000000,0x72055984,0xab277140,0xf5b1dcce,0xe5b2f5d2,0x4920b44d,0x18610800,
-0x00000820,0x00000860,0x6a851800,0xbd0fc550,0x08800000,0x00000040,0x40402880,0xfe33d510,0xfdf1fdd1,0xc551f654,0x28e00800,0x38e00800,0xfe32dd91,0xf5f0f611,0xfdb0ed4e,0xfe53fe32,0x1000d592,0x08210820,0x10000000,0x10001820,0xfeb6b4cf,0xf5f0edf1,0xf5affe31,0xf674f5d1,0x00008348,0x10401880,0x10001060,0xfe74bc8e,0xfdcffdd0,0xee13fe52,0x08008b6b,0x104120c3,
-0x49820000,0xfe95e614,0x8328cd2f,0x08001000,0x00200841,0x18200000,0x40403880,0xb44d6180,0x30008b08,0x18401800,0x00001042,0x10400000,0x62650800,0xfe54cd0f,0xf5d0f612,0xfe33f5f1,0xe550fe12,0x08007ac7,0x00001020,0x08000800,0x490130c1,0xbc2e69a3,0x50a0ab6b,0x202040a0,0x10610800,0x00200020,0x59a30800,0xedd1abea,0xfdb0fe12,0xe5b0f5d0,0x08008b49,0x20c11880,
-0xabeb1000,0xf52ef591,0xd50df58e,0x10402000,0x08002060,0xd5716225,0xed4eed90,0xfe52fe11,0xf5f1fe12,0xf634fe33,0x0000834b,0x08201880,0x08001081,0xf5f1ac2c,0xf58df5af,0xf58ef54d,0xedaff58e,0xddb2f5f1,0x00002020,0x080018c1,0xe5d25a02,0xf54ff58f,0x5941edb2,0x18621000,0x20811001,0x83271000,0xedf0e5d0,0xedd2edd0,0x2000b46f,0x08000800,0x00000020,0x00000020,
-0x59623040,0x59203000,0x40e35984,0x08011000,0x08210000,0x39400000,0xe5d1b46b,0x3840dd93,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10401040,0x00200841,0x00200020,0x10000000,0x92a65100,0xfdd0dc8d,0xfdd0fdf1,0xfdf1fdb0,0xe5d3fe53,0x080072e9,
-0x00001020,0x18a10000,0x08001860,0x20e21000,0x08410000,0x28a10000,0xc48d3000,0xfdd0fe53,0xfe51fe10,0xee34fe12,0x0000838a,0x08002101,0xf634936a,0xfdf0f612,0xfe31fe31,0xf653fe52,0x08008348,0x00001081,0x08000000,0x10000800,0xd5d338e0,0xf5f0fe74,0xfe32f611,0xc50ffe74,0x10201000,0x08401041,0x6a460800,0xfe12edf3,0xfdeffdaf,0xf5b1fdaf,0x40e0ddb3,0x08410000,
-0x000010a2,0x836a7b2a,0x00001000,0x00211040,0x08000000,0x61822020,0xbb8981c1,0xfe12e550,0xccaded90,0x200071c3,0x08201000,0x00000800,0x08200040,0x7ae80800,0xdd90c4ee,0xd571f634,0x3080a3ec,0x08200800,0x10000800,0x51421000,0x9b0869c3,0xf5b2dcce,0xd4eff613,0x50e07a03,0x000038c0,0x00400000,0x08001842,0x7ac71000,0xee13d570,0xcd50f653,0x10800800,0x080010a2,
-0xee1361a1,0xed8fedb1,0xe56ffe10,0x10004900,0x28c11820,0x93cc0800,0xfe33fe75,0xfdf1fdf1,0xf5d1fe32,0xddf4fe74,0x00004122,0x00000820,0x00000840,0xd5b15a03,0xfdf1edf1,0xfe11fe11,0xfe53fdf1,0xc4f0feb6,0x20e40800,0x000010a0,0xfe53b4ad,0xf5b0f5b0,0xd50ffdf2,0x10402000,0x08000000,0x080020c2,0xe6339bea,0x936ad571,0x10001800,0x00001020,0x10400000,0x61e41000,
-0xe5b2bcaf,0x8201c46c,0x596358e0,0x184038c1,0x00000000,0x00001061,0x5a251000,0x392493ee,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08200000,0x00000000,0x00000000,0x080018c3,0xed718286,0xfd6ef54e,0xed0cfd8e,0xf50cf50c,0xf612ed2d,0x10009bec,
-0x000028c2,0x08420000,0x10410800,0x00000821,0x00000842,0x18001841,0xed7092a6,0xed8fed6f,0xe590dd6e,0xd592e5b1,0x0820acd0,0x10400860,0xb48f1000,0xe590e5d2,0xe5b0edd0,0xac6ce5f2,0x18c00800,0x00400020,0x08000820,0x10600840,0x7b290000,0xbcacbcce,0xbccdc4ce,0x6a86bd0f,0x18830800,0x08410021,0x9c0e0800,0xe54fe592,0xf58ff5d0,0xf58ffdaf,0xb46dedd2,0x18a21000,
-0x10810000,0x00000000,0x08601040,0x00210020,0x10000821,0xa3aa1800,0xfd90e4ee,0xf56ffdd1,0xfdf2f56f,0xababe530,0x00003080,0x00000821,0x08800020,0x08000880,0x7ac61800,0x5181a42c,0x00000000,0x00000861,0x18200000,0x82862000,0xfdd2d4cf,0xfdd1fdf2,0xfe12fdd1,0xb3aaed71,0x10005961,0x00001040,0x08420000,0x000010a2,0x83491000,0x7ae8bcf0,0x10800000,0x100020c2,
-0xfe73bc8d,0xfdf1f5d1,0xf612ed8e,0x1800a40c,0x10002881,0x10000820,0xf614c4f0,0xf5d1f5d2,0xf5f2fe12,0x8b6aee34,0x20a30800,0x00000800,0x18c10020,0x9c2c0000,0xf632f695,0xfe53fe32,0xfe34fe53,0x59c3e5f3,0x10620000,0x41810000,0xfe12e5b2,0xfdd1f5d1,0xfe33fd90,0x10008b08,0x00201881,0x00000021,0x93eb30e0,0x08005a04,0x08011000,0x08200000,0x00001082,0xd5307246,
-0xfe33fe54,0xfdd1fdf1,0x71c3c42c,0x288040c0,0x00000800,0x00200000,0x00001081,0x00000000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x10401040,0x00000000,0x18001882,0xf5d18ac6,0xf50bed0c,0xf4caeccb,0xec69f4aa,0xed2eec89,0x18009329,
-0x00002081,0x00210001,0x10410862,0x08200841,0x18400000,0x50c01800,0xf4eedc6d,0xabe9e50d,0x59e44920,0x49a551c5,0x00203983,0x00400000,0x30c00000,0x6a656226,0x834872c6,0x29017b29,0x00400000,0x10600000,0x08000800,0x08400000,0x00000860,0x08000000,0x10001000,0x08001000,0x00010801,0x00000000,0x41840840,0x7a8661e5,0xd50f9baa,0xf5affe11,0xedf2f5d0,0x100072a7,
-0x00001861,0x18c10840,0x00200840,0x00000820,0x08200042,0xd5301800,0xf54ffdf2,0xf54ef56f,0xfdd0fdb0,0xed92fdd1,0x0000830a,0x000018c3,0x10800820,0x18811081,0x10002060,0x00000000,0x086018e0,0x00000840,0x08000840,0xd5105100,0xfdf2fe13,0xfe12fdf1,0xf56ffd90,0xedb1f5d1,0x3000bc2d,0x08401000,0x00420021,0x10a10041,0x08000800,0x08001000,0x18600800,0x6a241000,
-0xf5b0ed91,0xfdf2fdf2,0xedf2ed90,0x5a04ddd3,0x10200800,0x08001881,0xc4ef6204,0xd4cedd30,0xd550d4ad,0x1840acaf,0x08220000,0x10400820,0x00200020,0x20a00000,0xd570b4cf,0xe5b0dd90,0xee13edd1,0x08009c0c,0x10a21081,0x83290000,0xed90e591,0xf590fdf1,0xed6fed4e,0x3840ccce,0x08201000,0x10400000,0x00000000,0x18a20000,0x00000821,0x00200000,0x10001081,0xf5d1bc8d,
-0xf54ded4e,0xfd6ff52d,0xe530fdd1,0x10008287,0x08611040,0x08200000,0x08400800,0x00001081,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x00000000,0x20412041,0x00000800,0x00000820,0x18001821,0xf5af8ac5,0xfd2cf52c,0xfcecfd0c,0xfccbfccb,0xed0df4eb,0x10009b8a,
-0x08002060,0x08001000,0x08000800,0x08202080,0x10200800,0xabec1800,0xf52fecef,0x2000ccad,0x00000800,0x00000800,0x00000000,0x00000040,0x00000820,0x10000800,0x00000800,0x00000000,0x00000841,0x100028e3,0xc5329bec,0x08400800,0x08600860,0x18c218e2,0x10200840,0x10220801,0x00000000,0x00200020,0x00000020,0x10000800,0x51401000,0xf5d0dd90,0xf612ed8f,0x0800d5b3,
-0x08000800,0x00001081,0x20400800,0x08000800,0x00200041,0xd5501000,0xf56ff5f1,0xfdd0f58f,0xfdd0fdd0,0xf5d2f56f,0x0000938b,0x08400861,0x08000000,0x18001000,0x20612041,0x20e21061,0x20800000,0x08000800,0x08001061,0xe59161e3,0xf58ff590,0xfdb0fdb0,0xfd90fdb0,0xf5f1f5b0,0x3800dd31,0x08201800,0x00820041,0x00000861,0x10001861,0x08410000,0x18400820,0xbc8e1000,
-0xf5d1f612,0xe592fe13,0xb48dd551,0x49c39c0c,0x10410000,0x10200800,0x49201000,0x590069e4,0x20005900,0x00000800,0x10620001,0x00000800,0x00000020,0x00000860,0x40e01000,0x72435980,0x7ac682a5,0x000030e0,0x00200840,0x49630800,0x82637a64,0xa3479b06,0xe52ecc6b,0xb40bedb1,0x20c21000,0x00000820,0x20e30820,0x00210841,0x184120a3,0x08200000,0x100018a1,0xf58fbc6b,
-0xf52cf54d,0xfd8efd8e,0xf590f50c,0x1800b44d,0x002018a1,0x08000000,0x08001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x306030c2,0x62886246,0x10810000,0x10001062,0xe54e8ae5,0xf4caf50b,0xf4ccfd0d,0xfd2cfcec,0xedb0f52c,0x08009bec,
-0x100018a1,0x9bac1800,0x5961b42d,0x18401000,0x10400800,0xb48e1000,0xdd2fe590,0x080059c3,0x08611881,0x18201000,0x00001020,0x00000040,0x10220000,0x08201841,0x084018c0,0x08201040,0x18820000,0x72251000,0xf634e592,0x1000b48f,0x084020c2,0x088110a2,0x08400000,0x00000841,0x00000800,0x00200000,0x08000820,0x18401020,0x180028c1,0xe5f29369,0xee54edf2,0x00009c2e,
-0x10220800,0x30810800,0x38403840,0x10003881,0x18a00000,0xc5301000,0xfdd0f612,0xfd8efdf1,0xf5affdcf,0xedf2e54e,0x08009bec,0x000018c1,0x8b294120,0x30005961,0x20002000,0x10002841,0x20003040,0x20012820,0x00001062,0xddd251c3,0xf58ff5f1,0xf56efdd0,0xfdd0fdb0,0xf612f5af,0x48e0dd71,0x10201000,0x00000840,0x28821000,0x18211000,0x00210822,0x08000840,0xe5f37286,
-0xfe53edd1,0x1800bc8e,0x00001000,0x00000000,0x08001020,0x00000800,0x00000820,0x10000800,0x10001800,0x08012081,0x08001022,0x498349a4,0x08410000,0x08000000,0x08002060,0x08000800,0x10000800,0x08200000,0x08000000,0x00000861,0x10000000,0x18001000,0xcccf48c0,0xedb1f5d1,0x08006a25,0x00001061,0x08010000,0x080028e5,0x10001000,0x08201020,0x10001041,0xfdb0bc2b,
-0xfd8efd8e,0xf56df58e,0xfdb0fd4d,0x1000bc4c,0x00001080,0x00000020,0x39042862,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x18200000,0x830a2000,0xa42dcd73,0x18c20000,0x08000861,0xe5706a43,0xeccbf54e,0xfd0dfced,0xf56ff50d,0xbc8cf5f1,0x00004182,
-0x20800860,0xc46e2800,0xe551ed91,0x18009b8a,0x18a11880,0x5a030800,0x9389ddf2,0x18a20800,0x00000840,0x28202020,0x20602020,0x10811880,0x00000801,0x00000000,0x08200040,0x20202060,0x284030a2,0xdd723000,0xfe13fe54,0x9bedee35,0x10001800,0x00000000,0x00000000,0x00200000,0x08000000,0x18a01060,0x20801860,0x08002080,0x20601020,0xa42c1800,0xcd51f696,0x00001000,
-0x08001082,0x50e12000,0xccd0a369,0x1800a3cd,0x104020a1,0xacaf0800,0xf5f1fe74,0xfdf0f5af,0xf5f0fdf0,0xe613f653,0x000072c8,0x000018e1,0xedf37285,0xbc0ce571,0x48a08aa7,0x40402800,0xabcd71e5,0x4103cd13,0x00000000,0xee956ae8,0xedafee11,0xfdf0fdf0,0xfdaffdd0,0xee13fdf1,0x3080d592,0x18401000,0x838d0800,0x406072a9,0x20203840,0x00000000,0x000010c2,0xe613a46d,
-0xd570ee12,0x00004120,0x10a118c2,0x184020e1,0x18001800,0x00000800,0x08800000,0x00201081,0x20611020,0x18001000,0x20001000,0xbcf0cd51,0x20611800,0x10001000,0x18401000,0x10821881,0x10621062,0x08210021,0x10000800,0x08400000,0x108110a1,0x28e41883,0x6a041000,0xf5f2e550,0x1000bcb0,0x00000820,0x08000821,0x51431000,0x62049bed,0x08200800,0x10001081,0xfdf1bc6d,
-0xfd8eed2c,0xf56ef5af,0xfd8ffd6d,0x1800abea,0x004010a0,0x30e30000,0x30004902,0x184038e2,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18000000,0xbcb01800,0xa3ebf655,0x21031000,0x18800000,0x82e81000,0xed2eccae,0xf50df50e,0xdd30f52f,0x18009baa,0x00600020,
-0x10000860,0xd4ae3800,0xfdd1f590,0x7243e5b0,0x10a20000,0x00000820,0x20a062a8,0x10400000,0x28800800,0x28003860,0x18002800,0x08001000,0x00000000,0x00000000,0x08000840,0x48403000,0x40204020,0xfe34bc2d,0xf5f1fe53,0xee54f633,0x8b09ac4d,0x51c67288,0x08400800,0x00000000,0x08001040,0x10000800,0x18001800,0x08001800,0x08000820,0x41820800,0x5a25acd0,0x18a20000,
-0x10400020,0xabcb2000,0xfe34f5d2,0x2000c4d0,0x10201000,0x30800800,0xedd2b46d,0xedb0f5f1,0xf653f612,0x6aa6d5b1,0x08410000,0x000010c2,0xf6338307,0xfdf2fdd1,0xcc8df5d2,0xc42cab89,0xf614e550,0x5141e5b3,0x08800000,0xad100000,0xf653ee95,0xf5d0f611,0xf5d0f5b0,0xe5f3f633,0x080093cc,0x18401040,0xe6161000,0xb40cf676,0x200071e3,0x00001861,0x00000881,0xe65572c7,
-0x7b07ee95,0x20c20800,0x10200820,0x20001000,0x18002000,0x00001840,0x00000040,0x00000020,0x18001800,0x38402840,0xbc6d2800,0xfe13f5f2,0x20009b8b,0x40c14080,0x18202840,0x00000800,0x00000000,0x00000000,0x30a11800,0x282038e1,0x00001800,0x08210000,0x20002081,0xedf39327,0x38c0cd72,0x18800800,0x49430000,0xdd30a3ab,0x7a85edf3,0x08811000,0x000010c2,0xf6139bab,
-0xfdb0fdd1,0xf58ff58f,0xfdf2f56e,0x1000ac4c,0x10c110c0,0x8b2b0000,0x92a6dd31,0x49435900,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18201060,0xcd312800,0xdd70f633,0x08005140,0x08002902,0x10000000,0x9b282800,0xed91e550,0x5140abca,0x00001000,0x00200840,
-0x30601000,0xdcad5040,0xed2ded4f,0xcccded8e,0x08411000,0x10420000,0x00000000,0x00000820,0x38203080,0x9b497a25,0x8b099309,0x6a878b29,0x08001820,0x00410020,0x5a480000,0xc46eac2e,0xdcefd48f,0xf633edb2,0xf611f611,0xf653f652,0xee34feb6,0x9c0eee77,0x10810800,0x08600060,0x18400000,0xb48facb0,0xa40ba3eb,0x49a48b29,0x08410000,0x00001060,0x08000000,0x00000800,
-0x10001080,0xe5917a65,0xf5b1ed4f,0x5961d530,0x10830800,0x08000801,0x8b281800,0xee34d570,0x9369d571,0x08001800,0x00001040,0x00001081,0xf6339389,0xfdaff58f,0xf5d1fdf1,0xfdf1fe12,0xf5f2f5d1,0x69e3edd2,0x10800800,0x08000000,0xd5d28369,0xf633f674,0xedf2edf2,0x6a65c50f,0x18810800,0x08001040,0xddd351a3,0xfe12f633,0x8b08edb2,0x18c21000,0x18a10000,0x9c2d1000,
-0x10009c6d,0x10611860,0x20200000,0x592069e3,0x40a069a3,0x08201000,0x00410000,0x08200000,0x28201800,0x488040a0,0xf5d1a389,0xf5aff58e,0x9b08f614,0x58e05020,0x51635941,0x10001000,0x00000800,0x10200000,0x59211800,0x7a2571a3,0x516471e5,0x000028c3,0x18400800,0x9bec2000,0x100093ab,0x18202060,0xac4d1000,0xf5b0f613,0x9307f5f2,0x10c20800,0x10a00000,0x7aa61000,
-0xfe33e5b2,0xf5f2fe53,0xdd50fe13,0x00006224,0x08400880,0x9b8b0800,0xfdd2fe13,0x2000b44d,0x00201840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200000,0xdd712800,0xfe32fe12,0x7a84dd70,0x18611000,0x108318a4,0x10000800,0x7b0959e4,0x08001000,0x08201080,0x18000800,
-0x58c048c0,0xe54f79a0,0xf5b0f5d1,0xf5d1f56e,0x10008b6a,0x00002883,0x00200862,0x28810000,0x71c33800,0xf633dd71,0xf5f3edd2,0xf696edd3,0x10009bed,0x084120c2,0x41230800,0xf654e5f4,0xfe13f613,0xedf2f613,0xfe32f632,0xf652fe93,0xf695f632,0x5a25e655,0x10610000,0x10620000,0xa46f0800,0xee34f6b7,0xee12ee12,0xc531ee54,0x08001000,0x00200000,0x002018c1,0x00200000,
-0x18000000,0xedf2cd10,0xf611edb0,0x9389ee33,0x08420000,0x08620842,0x00001881,0x8bab51e4,0x10004983,0x18810800,0x10400000,0x08001060,0xee12ac6d,0xfdd0fe11,0xf611f5f1,0xf5aff5d0,0xf632edd0,0x82c7f634,0x20821000,0x20a20000,0x28800800,0xe676a46e,0x8b69cdb2,0x00000800,0x00001062,0x080018a2,0xee547ae7,0xf5cffe31,0xe5b1f5f1,0x080059c3,0x00001881,0x08002060,
-0x10800800,0x00000820,0xbcf02860,0xe550e591,0xd511e550,0x10007ac9,0x00200840,0x00000042,0xcd5172e9,0xcc8dc4ae,0xed4ee52f,0xed4cf54c,0xf5d2f5d1,0xc3eacc2b,0xb42dbbca,0x0800832a,0x08201020,0x08000020,0xc40aabaa,0xc3c9cc0a,0x9285bb88,0x100048a0,0x08600800,0x08000000,0x08000000,0x080018a1,0xe5b16223,0xfdd0f5b0,0x9308fe13,0x18c21000,0x00200000,0x000010a0,
-0xbd3149a3,0xddb2e614,0x38a0ac4d,0x18a10800,0x31040000,0xa3ca1800,0xfe32fe53,0x1000c530,0x00201040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20400820,0xcccf3000,0xf56efdf1,0xdd4ff5f0,0x18008b48,0x00010000,0x10800881,0x00000000,0x00800060,0x00000020,0x50c02840,
-0xab277140,0xfe32ed4f,0xfdf1fdf1,0xfe12fdb0,0x3080d592,0x18421000,0x00200000,0x28400820,0xd5104860,0xfe32fe54,0xfdf1fe53,0xfe54fe53,0x4920e5d3,0x18620800,0x10002083,0xf6549bec,0xf5f1fe53,0xfe94f632,0xe5b1fe74,0xcd2fd54f,0xbccebccd,0x08009c4d,0x00001040,0x00000822,0xb4d03102,0xd571cd72,0xddb1d570,0xcdb4de13,0x000062ca,0x002010a3,0x00200000,0x18a20000,
-0x8bcd0000,0xee54f6b7,0xee33ee33,0xc572e674,0x000120c1,0x00010021,0x10a20021,0x08000000,0x20a20000,0x00000821,0x08000800,0x20800000,0xee55c573,0xee13e5f2,0xe613ee54,0xf653edf2,0xee75ee73,0x93acf676,0x20831000,0x00010001,0x000020c3,0x41c40000,0x080030c0,0x10831060,0x00010001,0x000018a2,0xee7493ec,0xf632edf1,0xee34edf1,0x08009bed,0x08001041,0x18600000,
-0x00000880,0x000010a2,0xf6b793cd,0xfe54f633,0xf655fe34,0x3923cd94,0x00200000,0x00000881,0xde1549a3,0xf634f696,0xfdf2f5f3,0xfe52fe11,0xf5d1f611,0xfdd1f56f,0xfe75fe13,0x100093ac,0x18a12081,0x6aa70000,0xf54fedb2,0xfd6ffd6f,0xed71f590,0x20008266,0x00201020,0x08200841,0x08200840,0x08000860,0xedf1ac4c,0xf58fed8f,0xb3ecfe13,0x39232800,0x000018a1,0x10c10000,
-0x00000000,0x41616aa7,0x08000800,0x08001040,0x100028c3,0xdd7069e3,0xf5f1ed8f,0x1000cd30,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200000,0xcccf2800,0xfd8ffdd0,0xed90fdb0,0xbc8dfe33,0x08004942,0x00001861,0x18801020,0x00200040,0x18000040,0x82053000,
-0xfdd1dc8e,0xfd8efdb0,0xfd8ffd6e,0xfdd1fd8f,0xa40cf653,0x20a21000,0x08200000,0x20001860,0xfdf3b3eb,0xfe32f5d1,0xf5b0f5f0,0xedb1f5d1,0xac2cf653,0x20611800,0x10001821,0xddf238a0,0xfe31fe73,0xf653f611,0x2000bcad,0x08001000,0x08000800,0x08000800,0x00000000,0x00000000,0x08000840,0x10000800,0x10001000,0x00000800,0x00210841,0x00000000,0x00000000,0x08200000,
-0x42050000,0x6ac683ab,0x942c7306,0x29006b07,0x100128e3,0x00010000,0x08000001,0x20a01840,0x00001040,0x00000000,0x00000800,0x10810000,0x18603164,0x08000800,0x10401040,0x418328e0,0x39a13981,0x28c03961,0x00001020,0x00010001,0x10610000,0x080018a1,0x18400800,0x00010822,0x00000001,0x00000020,0x49c439a4,0x7b096aa7,0x626772c9,0x00005a69,0x00000000,0x00000040,
-0x00400020,0x00000020,0x8bab6b0a,0x72656a64,0x8b6b8b28,0x41c5836c,0x00200800,0x10600000,0x52460000,0xb4f0a48f,0xb48eb48f,0xac4cb46e,0xfe74e613,0xfe33edb1,0xddb3feb6,0x00001800,0x20801040,0xac4d1000,0xfdd1f5f3,0xfe32fdd1,0xfe96fe74,0x4880e572,0x00011840,0x08000000,0x18820000,0x52040000,0xfe73ee33,0xfe33fdf2,0xfe34fe14,0x50e0b3eb,0x28c140c0,0x00000800,
-0x18800840,0x00000000,0x002018e1,0x18400800,0x72871000,0xf5f2edf3,0xfe13f5b0,0x2000dd92,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20a10000,0xc48e1800,0xfdaffdf1,0xfdf1f56f,0xf654f612,0x0800bd11,0x08001000,0x08200000,0x00600040,0x08000841,0xe5739b6d,
-0xf50efdb2,0xfd6df52d,0xfd6efd4d,0xf590fdd0,0xddd2fe32,0x00007b09,0x08401080,0x51a30000,0xf5d1e592,0xf5affdf1,0xfdf0fdf0,0xf5d1fe12,0xddf2f632,0x080072e8,0x18202081,0xcd711800,0xfe31f652,0xf653fe31,0x10009389,0x10a12922,0x08811081,0x08200840,0x00000000,0x00000000,0x00200000,0x10400840,0x00200840,0x00210000,0x00000001,0x00000000,0x00000000,0x00000000,
-0x00000840,0x00000000,0x00000000,0x00000000,0x08001000,0x00000000,0x00000000,0x08000800,0x00000000,0x00000000,0x00000000,0x00210000,0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00010001,0x00000000,0x10400020,0x08001020,0x00010000,0x00200000,0x00000020,0x00000860,0x00000000,0x00000000,0x00000800,0x00000000,0x00200000,
-0x00000000,0x08400860,0x08000000,0x08000800,0x08001000,0x00000800,0x00000000,0x08000000,0x00001060,0x00000000,0x10001000,0x10001000,0xfe94ac4c,0xf5f2edf2,0x8ae7fe54,0x28e41000,0x000018a1,0xee357ae8,0xfe33edd2,0xfe12fdf1,0xfe34fe54,0xa36afe34,0x18a31000,0x10210800,0x10810801,0xa46e0800,0xfe32f674,0xfe12fe53,0xfe13f5f2,0xd4effe54,0x20007a45,0x10401000,
-0x00000820,0x08c208a2,0x00200000,0x08001061,0xe635a44f,0xf5d1f633,0xfe54fdb0,0x2800d551,0x00201020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x10200000,0xccef2800,0xfd8ef5d1,0xf5f1fd8f,0xbcefe5b1,0x08006266,0x10211021,0x00001042,0x00400040,0x08001041,0xc4f06a68,
-0xfdd0e570,0xfdaff58f,0xf54efd4e,0xf5f1fdf1,0xf694edf0,0x08008bab,0x000018a1,0x08000840,0xfe12d550,0xf5b0f590,0xf5d0fdf1,0xfe12fe32,0xee73edf0,0x0800acef,0x208018a0,0xb44d1800,0xf612fe74,0xfe95f611,0x08009bcb,0x00001881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x10220000,0x18611841,0x18a11880,0x002010a1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00410021,0x00200040,0x08200000,0x08201020,0x08600840,0x00200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200820,0x10a20840,0x086110a2,0x00000020,0x00000000,0x00000000,
-0x00210000,0x00200000,0x20a11040,0x18801040,0x086018a0,0x00200860,0x00000000,0x00000000,0x10800000,0x104018c0,0x28a31820,0x08002904,0xf6539bca,0xf5f1f5f1,0x71e2edb1,0x18412000,0x00001081,0xd5b36267,0xf612f654,0xfe32f5d1,0xf5b0fe12,0xe592fe12,0x100059a3,0x00001041,0x08200821,0xc5710800,0xfe11f633,0xfdf2fe11,0xfdf2fe12,0xfe12fdf1,0x8b29e5b2,0x00002040,
-0x08600800,0x00400020,0x08001040,0x00000841,0xee55bd32,0xedd0fe74,0xf5d1fdd0,0x1800cd10,0x08411840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400020,0xc4ef1800,0xed2dfdf2,0xdd4ff590,0x08008306,0x10400000,0x20201000,0x31032020,0x18401860,0x20601840,0x18000800,
-0xe5b19baa,0xf58ffdf1,0xfdb0fd8f,0xf611f5d0,0xc50ef632,0x10401000,0x00000820,0x080010a2,0xf63382e6,0xfdf1fe12,0xfe32fe52,0xf632f5f1,0xde12f673,0x00006285,0x08000840,0xd5513000,0xfe53fe54,0xfe95fe32,0x08009bec,0x000018c2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000800,0x08001083,0xfed59bea,0xfe32fe32,0xcccffe53,0x08003860,0x18c10820,0x834a0800,0xfe74f696,0xfe33fe74,0xfdf1fe12,0xfe54f5f1,0x6268ddb4,0x10620800,0x20c20000,0x8b8a0800,0xfe32f674,0xfe12fdf1,0xfe32fdf2,0xfe33ed90,0xd5d4fed6,0x10004143,
-0x10001840,0x08000800,0x18201000,0x10810000,0x8b8a0800,0xf654d571,0xfe32fe31,0x1800c4ef,0x08411040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20a10000,0xb44d1000,0xed8ff5b1,0x5980e570,0x18a01000,0x18201081,0x50e13000,0x69c471c4,0x20003840,0x10201000,0x104018a2,
-0x6a240800,0xf5b0dd70,0xf5aefdf0,0xf5f1ed6e,0x6a86e5f3,0x10a20800,0x08000000,0x18201882,0xc5311800,0xedf1f654,0xf5d0fe11,0xf633fe12,0xac4df695,0x10800800,0x080018c1,0xf655938a,0xfe33f613,0xf674fe32,0x000093ac,0x000018c2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,
-0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x100020c3,0xf6539b89,0xfe52fe32,0xfeb6fe32,0x10009bac,0x082028c2,0x08001060,0xfed6cd91,0xfe54f633,0xfe54fe13,0xfe95fe74,0x5a25e615,0x18600800,0x00200000,0x10000000,0xfe73d5b1,0xfe52edd0,0xfe54fe74,0xf675fe74,0x4a05acaf,0x10001860,
-0x20002000,0x69a548a1,0x180069e6,0x00200000,0x08001880,0xa42c2000,0xfe72ee10,0x61c4e5b2,0x08611000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20810000,0xac0c1000,0xf5d1ed70,0x2000d530,0x08811860,0x28600000,0x8a246142,0xab4981c1,0xb44ed511,0x10005982,0x10810000,
-0x100018c1,0xf5d19b89,0xf5aefdf0,0xfe53f5ef,0x1000c510,0x08211881,0x10001820,0x20600800,0x73091000,0xee34e635,0xfe74ee33,0xf675ee13,0x3080cd72,0x08600000,0x10200000,0xf6b6d5d3,0xf674f654,0xfe95fe94,0x000093ec,0x000010a1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00010000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10001882,0xf6549b8a,0xf611f612,0xf674ee11,0x1800d573,0x08200800,0x000018e2,0xee958369,0xfe75fed6,0xfeb6f695,0xee54f695,0x080093ec,0x20a02080,0x10411020,0x00000881,0xee336aa5,0xf611f652,0xf634fe53,0x7286ee34,0x00000800,0x10001840,
-0x82673000,0x7982ab8b,0x92e9a2e9,0x100059c5,0x20a21020,0x18000800,0xee31b48a,0x82c8edf4,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28a10800,0xb46d1800,0xf5b0fe12,0x4120d550,0x08800000,0x69e42040,0xbb0789e3,0xfdb1d42b,0xfe95fe13,0xa3ebedf3,0x080038a0,
-0x080018c1,0xf5f369e3,0xfdcffdd1,0xedf1fe31,0x10006204,0x186118a1,0x59c63040,0x100030a1,0x08001020,0x6ac75205,0x8b6a7ae8,0x8bab8b49,0x00005205,0x088110a1,0x5a680000,0xd5d3c573,0xd5b2cdb3,0xfeb5f653,0x0000838a,0x00001081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x080018c2,0xf675834a,0xfed5f675,0xf675feb4,0x72c9e656,0x10a30000,0x18610800,0xb5520000,0xc551d5f4,0xacefaccf,0x8baaacad,0x10410000,0x00001060,0x20411800,0x21230000,0xb4ef0000,0xf612fef6,0xfe74f612,0x18008308,0x28c03102,0x72651000,
-0xe550cc8e,0xe550f5d2,0xc369c348,0x7a24b348,0x10201800,0x080028e3,0xf693a409,0x7a46edd3,0x10a20800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18600000,0xb4cf1000,0xf633fe54,0x30c0d592,0x10800000,0x8aa71800,0xfd30d44d,0xfdaffdd1,0xfe12f590,0xf654fe53,0x0800ac4d,
-0x000018c1,0xe5725962,0xfe12f5d2,0x9beae5b1,0x18601000,0x18001021,0xd5936183,0x0800bd12,0x100020a2,0x00000800,0x08000800,0x08000800,0x10a10000,0x08400000,0x20600000,0x310030e0,0x080020c0,0xe6558347,0x0800838b,0x000018c2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000010a1,0xee97836b,0xe613ee96,0x8348a44b,0x39436245,0x08210000,0x08000000,0x18e00000,0x00000820,0x00000800,0x08001000,0x18821020,0x9c6f0800,0x20008b4c,0x006018a2,0x4a450000,0xfe75cd71,0xe5f2fe74,0x080059c4,0x08002080,0xd5716a86,
-0xfdd1fe12,0xfe74f632,0xf4cefe34,0x92a5b2e5,0x000038c0,0x08001041,0xee538b88,0x8287edf3,0x10a20800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08810000,0x62870000,0xe655bd10,0x0800c572,0x20810000,0xa34a2000,0xfdb1f5d3,0xf58ff56f,0xf5b0fdd0,0xf674fe32,0x0800bd10,
-0x000010c1,0xddb42800,0xbccee5d2,0x08006244,0x08011000,0x20002042,0xfe75bc4d,0x7ae9ee56,0x31050800,0x20c31822,0x18c120e3,0x18c018c0,0x00000860,0x08400860,0x08001040,0x08000800,0x08200000,0x62a90800,0x00005269,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000018c1,0xeed87b4a,0x5204de36,0x00000800,0x10000800,0x10202040,0x08400000,0x00000040,0x10800000,0x188020c0,0x20602080,0x100028a1,0xf6b78349,0x4040dd32,0x004018a0,0x00000080,0xa44d2040,0xee75e654,0x08004102,0x080020c2,0xf6749c0b,
-0xfe12f5f2,0xfe94fe74,0xfe34fe75,0xb40cfe13,0x10811000,0x00001082,0xf695a42c,0x8309f635,0x18a30800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x00000000,0x00001081,0x6ac71000,0x0820736a,0x20200000,0xabac2000,0xfe12fe75,0xfe32fe32,0xfe32fe11,0xf654fe74,0x0800bd0f,
-0x000010a0,0xa46f1820,0x10008328,0x18a10000,0x10020821,0x28000800,0xf633f634,0xddd4fe95,0x10002000,0x10001800,0x08200000,0x00000020,0x08000800,0x30601000,0x492240c1,0x286038e1,0x106120a1,0x08011061,0x08400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000800,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000001,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000018a1,0xde988bed,0x080062a8,0x18202902,0x18001000,0x20002000,0x08001800,0x00400020,0x08000860,0x38e12040,0x40a038c0,0x59823820,0xf675e5f3,0xa3acf635,0x08a10000,0x10a00040,0x08000000,0x9c6e6265,0x00002060,0x080020a3,0xee538ba9,
-0xfe74f633,0xfeb5fe94,0xfe54fe74,0xb46dfe74,0x10810800,0x080010a2,0xf6d793ec,0x7287ee56,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000801,0x18610000,0x000020a1,0x00000000,0x20811041,0xabcc1800,0xfe74fe95,0xfe93fe94,0xfe73fe73,0xfe95fe53,0x1000c530,
-0x10201860,0x08001040,0x20a00000,0x002018a0,0x00000000,0x10001041,0xf613c4f0,0xf634edb2,0x9307ccef,0x8ae79b48,0x51e382e8,0x10200000,0x59232820,0x8a0581e6,0x714089c3,0x69a36920,0x08002800,0x10201000,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00020001,0x00000021,0x00000000,0x08000800,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010021,0x08001042,0x00000860,0x00000000,0x00000040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x08430001,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00420000,0x00010862,0x00000801,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0x83cd6b2b,0x28c10000,0x48a02020,0x92878ac8,0x92869ac6,0x48a28247,0x10410800,0x18000000,0x694048c0,0x9a8681a1,0xedb2ab49,0xfe55fe96,0xb4d0fed8,0x28e30800,0x00000820,0x28e31841,0x00000000,0x08400840,0x000018c2,0xee94940b,
-0xfe95feb5,0xfe74feb5,0xf695f695,0xac4dfeb5,0x10811800,0x00000881,0xacd15246,0x08005a67,0x08210000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10010000,0x00001001,0x18a118a0,0x00001080,0x18610000,0x938b1000,0xed70e5d2,0xed6ff5b0,0xed90f5b0,0xfe74f5d1,0x0800b4cf,
-0x08002080,0x10800000,0x20a01880,0x18001800,0x18401000,0x080018c2,0xedf47aa7,0xfe33fe13,0xfe33fe33,0xfe74fe54,0x834af696,0x28a20000,0x79c540a1,0xdc8e9a66,0xdccfe4cf,0xe551dcae,0x1000a40d,0x10202060,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20001800,0x08001000,0x10200800,0x00000820,0x08000800,0x00000000,0x08400000,
-0x10401040,0x00000800,0x00000001,0x10000800,0x08000000,0x00010001,0x08000801,0x00000820,0x00000820,0x00200000,0x00000000,0x00000020,0x10001000,0x08200000,0x00000820,0x00000020,0x00000800,0x00000020,0x08200820,0x00000841,0x00000000,0x00000000,0x08000000,0x10400800,0x00000020,0x08000800,0x00000800,0x08001000,0x00000041,0x10210000,0x10001820,0x00000000,
-0x00210000,0x00000000,0x00000000,0x18000800,0x08001000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x18001860,0x8a872000,0xc389b36a,0xd42bd3ea,0x5080ab28,0x10002820,0x49630000,0xd48db40c,0xecadd40b,0xfdd2f550,0xf654fdf3,0x5a25e635,0x20610800,0x28201800,0x10002000,0x104120a2,0x00400000,0x000010a1,0xfef69c4c,
-0xf5f2f653,0xfe32fe32,0xfe74fe73,0xb42dfe95,0x20c21000,0x10a00020,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000800,0x180028a2,0x00001020,0x00001080,0x10620000,0x52050000,0xed50c4ef,0xec8bf4ed,0xf52ef4ed,0xc4efed70,0x000072c9,
-0x10001840,0x20810000,0x40802880,0x82866120,0x10005100,0x20a11000,0xbccf1000,0xecedf5b1,0xfd4ff4ee,0xfe13fe12,0x1000cd52,0x20201840,0x60e050c0,0xfed7cc6e,0xfef7fe55,0xfeb6fed6,0x8b49feb6,0x20611800,0x08220000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x69c43880,0x9aa59285,0x82249265,0x20005940,0x10210800,0x08010000,0x00000822,0x00000820,
-0x20201800,0x08002020,0x08010801,0x20201800,0x20622882,0x08011022,0x10000800,0x18002000,0x00200000,0x00000040,0x08200020,0x49630800,0x69c56984,0x100040e0,0x08200820,0x10200800,0x08000800,0x08200000,0x00000800,0x00200000,0x00000020,0x00000000,0x38c02060,0x100030a0,0x00210021,0x30a00800,0x384040e2,0x10002800,0x00000800,0x10001000,0x08001000,0x08020800,
-0x00000001,0x08000020,0x61c43060,0x8aa792c8,0x59a269e3,0x30e13900,0x080028a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18a30021,0x10001860,0xe571a3cb,0xd3eadc8d,0xfd4fe44b,0x92a4ed4f,0x100040c0,0x10001861,0xfe33d551,0xecccf54f,0xf590f56f,0xe591e54e,0x0000836a,0x100020c1,0x92a769e4,0x69838a87,0x18401800,0x00000040,0x100010a2,0xd5507265,
-0xf5d0f633,0xf52ded2d,0xdc29e449,0x9b08d46c,0x10811000,0x00000000,0x28c21020,0x00001881,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18201020,0x9c2d1800,0x59c2a44d,0x10201000,0x00000822,0x08000841,0xa32740c0,0xf50ed44c,0xcc2beccd,0x38809b27,0x08200800,
-0x08000000,0x18001861,0x8a8548c0,0xdccfb368,0x4060ccaf,0x18821000,0x6a460800,0xf54eed90,0xfd0efd4e,0xdd0feccc,0x00007ac8,0x20201041,0x92c63800,0xfe74f614,0xfeb5feb5,0xee33f633,0xee55f694,0x08004941,0x00001042,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x7a043840,0xaae4ab06,0xab06aac4,0x8b08ab89,0x00004164,0x08400820,0x08211062,0x49a50000,
-0x40a04922,0x08002840,0x10001001,0x30403060,0x18002800,0x08000800,0x30811000,0x308048e2,0x004020e2,0x00200041,0x00000020,0x7aa74142,0xa34aab8b,0x38e082e8,0x10610800,0x20601840,0x10001000,0x5a274186,0x410059e4,0x000028e1,0x00400000,0x00000000,0x6a2559e6,0x51a47246,0x00000000,0x6a052880,0x8aa78266,0x61a38ac7,0x08001820,0x5a063902,0x61e67268,0x000028c3,
-0x00000801,0x08000020,0x92c76a05,0xbbaab369,0x7a439b06,0x410061a1,0x00003903,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x08400021,0x6a250800,0xfe33edd3,0xfdd1fdf1,0xf4edf50e,0xcc6afdaf,0x20005900,0x08002081,0xccae8b08,0xfdf1e4cc,0xfdd1fe11,0xd571fe33,0x18601000,0x18001840,0xd48dd4cf,0x9ac7a2a5,0x30408266,0x00400800,0x10200000,0x59401800,
-0xed90abe9,0xfd6ff54e,0xfd0efcec,0x9b4afdb3,0x10a21000,0x00000000,0x18001000,0x28c11000,0x00201040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18400000,0xc4ef1800,0xe591edd2,0x1000936b,0x00000800,0x10400000,0x20001000,0x9b6a5120,0x28008286,0x08001000,0x000018a1,
-0x08000820,0x59631000,0xe4acbbaa,0xfdd1fd6f,0xabcbf5b1,0x18a21000,0x180020c3,0xf590ab89,0xf50df50e,0xc44bfd6e,0x00001000,0x20401081,0xedd26160,0xf653fe74,0xee32f673,0xf674fe74,0xfef7fe94,0x2060d5d4,0x00410020,0x00000000,0x00000000,0x00000000,0x00000000,0x10200000,0x82c81800,0xe56fd50f,0xd4aee50e,0xbcd0d530,0x000049e5,0x000020e1,0x20a30000,0x62670000,
-0xcd52b48f,0x28c1acb1,0x51e50000,0xb44dac2d,0xa3ecb44d,0x080051e5,0x7b4b0800,0x9bacb48f,0x000041a5,0x10620821,0x08001081,0x8ac761e4,0x92a69265,0x496382a8,0x08000800,0x08001000,0x00001860,0x9b8b6a68,0x92e8a349,0x10006226,0x10810820,0x00000882,0x722459a3,0x61a27a03,0x10001800,0x69803880,0x81e18202,0x720379c0,0x00002880,0x48e02880,0x72066122,0x00002080,
-0x18611860,0x00000800,0x7a026a46,0x920068c0,0x89e19a63,0x51208202,0x00001000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x18800020,0xbcae2000,0xf5b0fe33,0xf56efdd0,0xfd6ffd90,0xdc6beccc,0x48608a43,0x18201000,0xa3cc1800,0xc387d48d,0x9aa3aae4,0x49409307,0x20e00000,0x93491000,0xeceddccd,0xcc4aed4f,0x71c0b367,0x10202000,0x00000820,0x10001820,
-0x7ae51000,0xf5f3dd71,0xed91fdf2,0x2880ac0d,0x00000000,0x10000000,0x69a33820,0x40c07205,0x08211000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18800020,0xabaa2000,0xe4eeed0e,0x1800c46e,0x08221000,0x18a20000,0x18401861,0x08000800,0x08001000,0x082018a1,0x00000840,
-0x20610000,0x9b2a1800,0xfd0df52f,0xdc6afd4e,0xe550dc8b,0x08005122,0x08001082,0xed707203,0xfd6efdb0,0xc42afd6e,0x18c21000,0x08001061,0xff17b48e,0xfeb4fed6,0xfeb4fed4,0xfe95feb5,0xfed6f653,0x5a88eed8,0x08c20000,0x00000000,0x00000000,0x00000000,0x00000000,0x20800020,0xac4e1000,0xfed5fef6,0xff38fef6,0x9becfe96,0x18800800,0x6ae90800,0x00006aea,0x30e02060,
-0xc552ac6e,0x20c1a4d1,0x52260000,0xcd31bcf0,0xc551d572,0x00006ac9,0x8bee0000,0x8b6bc512,0x18200800,0x18000800,0x28800800,0xc4b02000,0xfe55fe56,0x1800b4b0,0x30c02860,0x7b09834a,0x08000800,0xe5f5832a,0xe5b3edd3,0x08006a88,0x080030c0,0x00000000,0xc53251a4,0xdd93e5f4,0x08005a47,0xddb372a7,0xe592e592,0xcd31e5b2,0x000049c5,0xd5b46ac9,0xa40edd94,0x18a01000,
-0x10001000,0x080020c2,0xac0c4941,0xbba9bc0b,0xd48dcc2b,0x9349d4ef,0x00400800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000840,0xe5d361e3,0xf56efdf2,0xed2ded2d,0xfd6fe4ab,0xfdb1ecac,0x4020d46d,0x18602820,0x7aa81000,0xe4eee530,0xedd2e50e,0x10008b4a,0x00002123,0xf5d282e7,0xfdaffdd0,0xfe32fe11,0xc40bfdb0,0x10002800,0x00000000,0x08400001,
-0x10001040,0xb44f40c0,0x3000abec,0x00001000,0x00400020,0x08000861,0xdd319b49,0x48c0ccd0,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400020,0xcc6d2000,0xf4eef4ee,0x2000cc8e,0x10211800,0x00001000,0x10400000,0x188018c0,0x18611881,0x00001040,0x08400000,
-0x20600000,0x82461800,0xd387dc0b,0xdc4bd3a8,0xfdf2f4ed,0x1800b44e,0x18612081,0xabeb1800,0xf4ebe4cc,0xed2ffd4d,0x08005143,0x10001880,0xee14bcef,0xf695f6b6,0xf652fe73,0xfeb4fe73,0xfeb6f653,0x0000c573,0x00400060,0x00000000,0x00000000,0x00000000,0x00000000,0x20a10000,0xac8f1000,0xfeb5fef6,0xfef8fe95,0x1000c531,0x080020a1,0xeeb77b08,0x836ceeb8,0x20a00800,
-0x08000800,0x00000000,0x00000020,0x18200000,0x08001840,0x00000820,0x00000861,0x10000000,0x20002820,0xd552a3cc,0x18006a25,0x49221000,0xfed7ee55,0x18007287,0x93693040,0xe614f675,0x180038a0,0x62264122,0x5a266246,0x080020c1,0x8b2a2000,0x00004184,0x732b1020,0x93ed9c0e,0x000041c6,0xa4705226,0xa48fa46f,0x8beeacb0,0x00002944,0x940e5207,0x6ac7942e,0x18001800,
-0xac4f936b,0x28c02860,0xc5730800,0xfe75ff18,0xfe75feb5,0xd5d4ff18,0x10411000,0x00001041,0x00000000,0x00000000,0x00000000,0x00000000,0x08000840,0xedd37266,0xfdd1f590,0xfd8efd8f,0xfd8edc8a,0xfdb0fd6f,0x8264fdd1,0x31021800,0x936a1000,0xf590fe13,0xd50ffe12,0x10811000,0x10000860,0xfdb1cccf,0xfdaffd6e,0xfdf0fdf0,0xed72fdd1,0x00201000,0x00000840,0x08410020,
-0x20a20000,0x08000800,0x10001800,0x10a018a0,0x00200000,0x10000861,0xfe33a3aa,0x69e3e591,0x10620800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200000,0xcc8e2000,0xf4cefd0f,0x2800c44c,0x10001000,0x6ac91000,0x18007ae8,0x28a01000,0x10002020,0x30801800,0x080030e0,
-0x20800820,0x92e81800,0xf4eded0f,0xfd90fd2f,0xed2efd6f,0x5120d50f,0x18810800,0x59c30800,0xe4aadced,0xe530eccc,0x1000934b,0x080028e1,0xe6357b08,0xfeb6ee55,0xfe52f633,0xf673fe94,0xee74feb4,0x08207309,0x00000881,0x00000040,0x00000000,0x00000000,0x00000000,0x20a10000,0xa44d0800,0xf633ee13,0xfed8f654,0x0800c5b3,0x52060800,0xf6d7de35,0xee97f6d7,0x10008b8b,
-0x00000800,0x08620000,0x00000861,0x00000000,0x00000800,0x00000000,0x00000000,0x10000800,0xb42e3840,0xfeb6fe55,0x7ac7f675,0x08000800,0xde13c551,0x18002000,0xee337ac6,0xfe95f633,0x2000bcaf,0x08001000,0x00000000,0x08001081,0xf6769bab,0x0800acb0,0x08001040,0x08000800,0x08200000,0x08001820,0x10001000,0x00000800,0x10400000,0x18001000,0x38e01000,0xbc8d5160,
-0xfed8fe76,0x10009bcd,0x8bcc0800,0xfeb6fed7,0xfeb5fe95,0xd5b3feb6,0x10402040,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x08000881,0xbc6e1800,0xed4fed91,0xf54eed0d,0xed4ef54e,0xf570ed2e,0x7a65e571,0x20401000,0xcd302000,0xed6fed90,0x5981dd50,0x18e30800,0x9c0d0000,0xecededb2,0xed0de4cc,0xe52ded4e,0xdd10ed2f,0x00601000,0x08000800,0x08000000,
-0x100030c3,0x20811820,0x20402880,0x00000800,0x00001060,0x100020e4,0xf5f2a3a9,0x6a02edd2,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000020,0xc48d2800,0xf56ffd90,0x1000cd30,0x18c10860,0xa40c1000,0xbc0add50,0x28008285,0x71633000,0xc46e9266,0x1000b48e,
-0x18600800,0x8b081000,0xed2eedb1,0xed0ceccc,0xed8df58d,0xb44bedb0,0x18c21000,0x08001081,0xfe74b48e,0xfe55fe13,0x4963ddd4,0x18600000,0xcd731000,0xfe75fed8,0xfe73fe53,0xfe73f611,0xc570f6b4,0x08201000,0x00420020,0x00000000,0x00000000,0x00000000,0x00000000,0x20a10000,0xa48e0000,0xfe54ee13,0xfef8feb6,0x0000d635,0x7b8c0000,0xfed6ff18,0xfef7f695,0xc4effed6,
-0xac6eb46d,0x00006ac9,0x39640000,0x8b6a93cd,0x6a888b4a,0x000028c2,0x7b2b1020,0x9b48938a,0xfe75ccef,0xe56ffe74,0xbd31feb6,0x00000000,0xde96ad51,0x10000800,0xfeb5a3eb,0xfe54fe74,0x8b07f654,0x5a047265,0x31635246,0x62c80000,0xf695f695,0xac8df6b6,0x10001800,0x10001000,0x10001820,0x28001800,0x40004020,0x18002800,0x08001840,0x71c34060,0x79e07a23,0xfe95d4ce,
-0xfed7fe95,0x59a3e615,0x5a251000,0xfe74ee75,0xfe54fe53,0xcd92fef6,0x08600820,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x08620000,0x38c00800,0xfe75dd92,0xfe32fe33,0xfe53fe33,0xfeb6f633,0x1000a42d,0x08003124,0xfed7ac6e,0xfeb5f633,0x1000b4af,0x00002124,0xe6365a27,0xf5f2f613,0xfe54fe75,0xfe33fe33,0xcd10fdf3,0x00400800,0x10001060,0x7a886246,
-0x50e04020,0x28004080,0x48803800,0x8b498ae8,0x08210000,0x18001842,0xf5d2abca,0x7a23ed91,0x10a20800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0xb42b2820,0xe590e56f,0x0000b4af,0x18e20880,0xac0b1000,0xf56fed6f,0xb3ebed91,0xe4f1bbec,0xfdd2ecef,0x38e0ddb2,
-0x20a20800,0x7b090800,0xfe53ee34,0xf5d1f5d1,0xfe72f611,0xee54feb4,0x00005205,0x080018a2,0xee976287,0xf676feb7,0x72e9e636,0x21030000,0x5a070000,0xd551c511,0xd52fccee,0xcd2fd56f,0x6a85c54f,0x18800800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18a10800,0xad110000,0xd551f6b7,0xb511c531,0x000083ec,0x52470000,0xcd71cdd4,0xde13cd91,0xee55e613,
-0xfef8fe75,0x2040d5f5,0x8bad0800,0xfe97fed8,0xee76fe96,0x0800732b,0xd5d530c1,0xee14fed8,0xd571ee55,0xccedd52f,0xa48fde14,0x00000820,0xad7294af,0x10000000,0xfed6a3eb,0xf633f633,0xee34ee13,0xcdb4e635,0x62c9c5d5,0x6ae90000,0xee95e675,0xeeb6f6d6,0xd5f4cd92,0xacd2c5d5,0x10003923,0xcd117267,0xd4d0d4d0,0xa3edd511,0x10000800,0xedb29329,0xfdd2ed72,0xfe12fdf2,
-0xedd2f5f2,0x7aa8ee14,0x49a31000,0xfed6ee75,0xf654feb6,0xc530e5f2,0x00400820,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00410001,0x080018c2,0xf6b793ec,0xfef7feb6,0xfed6fed6,0xe656ff18,0x00004184,0x39850000,0xee75e677,0xcd91ee54,0x080030a0,0x000010a2,0xff7bcdf5,0xfef7fef7,0xf6d7fef8,0xf654f695,0xe655feb6,0x00400800,0x080018e2,0xedf59bac,
-0x81e3bc0d,0x7a0379e2,0xcc8f9286,0xc4f0ee14,0x18c30800,0x10002083,0xf6139b49,0x7a65e591,0x10a20800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20800000,0xb4ce1000,0xac6cddf2,0x08004160,0x18401061,0xc4cf1800,0xed6ff612,0xf5f1f5d1,0xf5d1ed90,0xf5d2f590,0x4162ddd3,
-0x10820800,0x31420000,0xa3ec8b6a,0x9bab9bab,0x93cb93ab,0x8bcb9c2c,0x000041c5,0x08201041,0x6ac90000,0x5a057b4a,0x18804162,0x00000000,0x00001062,0x08000800,0x20a00800,0x100028a0,0x10001000,0x08001820,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x7bac0000,0x08007b6c,0x00000800,0x00200800,0x00000021,0x08000800,0x30a02840,0x51834121,
-0xddf561c3,0x2040de36,0x8bcd0800,0xfe96ff19,0xfed8feb6,0x00007309,0xde162860,0x3860bcf0,0x286030c0,0x41203040,0x108049e5,0x08400000,0x08400000,0x100020c2,0xfe95ac2c,0xf695f654,0x9c2cf695,0x62886287,0x20a15227,0x10800000,0x732a5a67,0x5a6683ac,0x9c6f7b6b,0xd657b552,0x10006288,0xee149369,0xfe34edb2,0xcd31f614,0x08000800,0xfeb5bcef,0xfe34fe13,0xedb1f5f3,
-0xed4fdcac,0x59e3d550,0x10400000,0x9bec7b29,0xcd729bec,0xc551f6b6,0x08400800,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x08620821,0x10800000,0x9c8f0000,0xbd30cdf4,0xa4afacef,0x7b4bb512,0x21030000,0x734b0000,0xbd10c593,0x836bd5f4,0x20e30000,0x31850000,0xbd93a532,0xcdd4cdb4,0xcdf5c593,0xc571d5f3,0xb531cdd2,0x00200000,0x00001123,0xfed79bcc,
-0xed71fe14,0xdcaecc0b,0xfe97f615,0xb48ffe76,0x08820000,0x080010c2,0xff39a42d,0x61e4ee35,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200020,0x8bec0800,0x100093eb,0x10200000,0x28201820,0xcccf2800,0xfe32fe33,0xfe32fe32,0xfe53fe12,0xfe95fe74,0x0800ac8f,
-0x08201020,0x00000020,0x18001000,0x08001000,0x08000800,0x00000000,0x10410000,0x00000800,0x00001060,0x08000000,0x00000800,0x00000020,0x00010000,0x00410000,0x00000000,0x10400000,0x20402060,0x10001841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000040,0x20610000,0x10001000,0x10001000,0x00010020,0x10000800,0x20002000,0x10001000,
-0xa40e1800,0x2000bcf0,0x62880800,0xfed7ee76,0xac6efed7,0x08001000,0xe67659c3,0x180093ed,0x10002080,0x18001800,0x00000800,0x08200840,0x00000000,0x10002081,0xddb36a45,0xf6d7ee55,0x1000a48e,0x10001800,0x10000800,0x00000800,0x10000800,0x10000800,0x08000800,0xbdb40800,0x1800730a,0xddb27265,0xfe54edf3,0xbcf0f634,0x08000800,0xfe53cd50,0xfdf2fdf2,0xfe95fe95,
-0xfe53fe53,0x8328fed6,0x18800820,0x10001000,0x5a251000,0xcdd4e677,0x08200000,0x00000821,0x00000000,0x00000000,0x00000000,0x08000801,0x00001000,0x002018a1,0x00000020,0x08000000,0x00000000,0x08001000,0x08001020,0x08000800,0x10000800,0x08000800,0x00001881,0x00000820,0x00000000,0x08000000,0x08000800,0x08000800,0x08000800,0x08820000,0x00000080,0xddf47b2a,
-0xfe95feb6,0xfe55fdf3,0xfe76fe96,0xc511fed7,0x10a20000,0x00200880,0xe676838b,0x6a88eeb8,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001061,0x18401000,0x18810841,0x38002000,0xe4ce60a0,0xfdb0fdb0,0xfdaffd8f,0xfe32fdd0,0x8b8addd2,0x00000800,
-0x00001040,0x08610000,0x28602880,0x188120a2,0x188020a0,0x18821881,0x00001062,0x00000000,0x18c20000,0x20c220a1,0x08811081,0x08810061,0x00200820,0x00000840,0x10a20061,0x10001042,0x18201800,0x10200800,0x080028e3,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x28002880,0xd5129b8b,0x3840ac0e,0x18200800,0x92c87246,0x69808a23,0x28c04100,
-0xb4d00800,0x7a44fed7,0x10001800,0xc5536267,0x10009c0d,0x18002880,0xff18c4f0,0x08008bab,0x69e52840,0x9ac7a308,0x39028ae9,0x00000000,0x59c34100,0x10201000,0x5a460800,0xacf0d635,0x18000800,0x832938c0,0x28406a88,0x20001000,0x7a647225,0x59817223,0x28c128a0,0xc5b41000,0x100072e9,0x93cc1000,0xfe96ee34,0x6266ddf4,0x10000800,0xfe12dd30,0xfd90fdd0,0xfe95fe54,
-0xfe53fe74,0x7aa6fe54,0x18a20000,0x10001000,0x000028c1,0x8c0e4a06,0x00000800,0x00000020,0x00000000,0x00000000,0x00000000,0x08001041,0x7aea6aa9,0x30c31000,0x10a21882,0x108018c2,0x18a018c0,0x186018c1,0x18211021,0x08001000,0x10202060,0x08420800,0x00000000,0x08000800,0x18c21040,0x290420e3,0x39233944,0x41663945,0x20603102,0x00001020,0x08200000,0x31220000,
-0xe634acaf,0xfe94fef6,0xfe54fe74,0xc4d0fe76,0x18c31000,0x00400040,0x49e50000,0x52489c70,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08011843,0x08001061,0xabcb3020,0xe4aced71,0xcbe8d409,0xd46adc4a,0x9327bbc9,0x080038e0,0x00400820,
-0x00200000,0x10000800,0x28002820,0x28602880,0x30402820,0x284038a0,0x18201800,0x00000000,0x00000020,0x18001000,0x10001000,0x08000800,0x00001020,0x00200020,0x00000000,0x28002000,0x49423880,0x93ee38a0,0x000062aa,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x10000820,0x9b8c1800,0xe551d4ef,0x69c4dd31,0x28601000,0xcc6cabcb,0xd4adcc0a,0x0800a40c,
-0x8b8b0800,0xbc4cdd71,0x10003020,0x20201000,0x18001000,0x72a71000,0xcd2fccee,0x08006266,0xc4f12000,0xe530fdf3,0xb4d1edf4,0x00000000,0xee55b48f,0x1800c532,0x00000000,0x292041e4,0x18000000,0xff19c531,0x72a8f6b8,0x832a1800,0xfe75f655,0xf6b7ee34,0x080093ed,0xacb01000,0x1800ac90,0x08001000,0xac6f72e8,0x100059e4,0x7b090000,0xed2fdd51,0xe4cceced,0xed70e50e,
-0xdd2eed90,0x82c6dd4f,0x20a20800,0xac4fb4f2,0x18402020,0x00000000,0x00001040,0x00000040,0x00000000,0x00000000,0x00000000,0x08001881,0xcd74836c,0x18005984,0x10001000,0x08001000,0x00000800,0x10200820,0x30820800,0x6a266a47,0x202038c0,0x08421021,0x00000021,0x30601800,0x20003080,0x10001000,0x20001800,0x20002000,0x18001800,0x08002021,0x00000000,0x00000862,
-0x52440000,0xf6f6bd71,0xee13f695,0xb42dfe96,0x39231800,0x00000820,0x00001080,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00210000,0x18210801,0x59831000,0xf654cd51,0xfe74fe53,0xfe33fe54,0xac0be5b1,0x18005983,0x18621000,0x00000841,
-0x00000040,0x30201800,0x60e05080,0x690058a0,0x89e481e3,0x71409224,0x300058e0,0x08211000,0x08000021,0x8a656161,0x9b079285,0x7a24a348,0x08001800,0x00000800,0x832a2081,0xc42ba38a,0xd4cdcc8c,0xddb3cced,0x00005a26,0x000018a1,0x00000000,0x00000000,0x00000000,0x08000000,0x10200800,0xc5110800,0xe50eed70,0x82c7f5f3,0x30c10800,0xf5b1cccf,0xfe13fdd0,0x1000c4f1,
-0x9c0d0800,0xf5d2e591,0x0800c511,0x10001020,0x100028a2,0xe6148b6a,0xcd0edd4f,0x08006245,0xddb42800,0xfe74fe76,0xb50fee74,0x08000000,0xfeb6d572,0xcd93feb7,0x00203142,0x08400000,0x9c6f0000,0xfef7ff18,0x7ae8f6b7,0xa42e1800,0xfed5f6b6,0xff5aee75,0x0800acb1,0xcd931800,0xcd51fed7,0x00002860,0x00000000,0x10000800,0xee5693ec,0xf5d3f614,0xfe13f5d3,0xf5f2f5f2,
-0xf633fe33,0x8b28f674,0x41850800,0xf676ee77,0x2000b46e,0x18c21020,0x00210000,0x00000020,0x00000000,0x00000000,0x00000000,0x000018a2,0xf6d87b4b,0x92e9ee36,0x93099b29,0x59408aa6,0x08002040,0x08001041,0x8b0938a0,0xab49a329,0x6141a328,0x08211000,0x08000840,0xabaa82a8,0xb3cabc0b,0xb40cabec,0xab89abca,0xab49a328,0x69c592c8,0x08003062,0x00000000,0x18820000,
-0x000020c2,0x7bab0000,0xf6b6de55,0xee35f6b6,0x38609b6b,0x208038e1,0x08410820,0x08410862,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x08001062,0xbcf11000,0xfeb5f676,0xfed6f674,0xcd51feb7,0x10006aa5,0x28831000,0x10002021,0x08600800,
-0x00000020,0x72271800,0xdcefc46f,0xe530ed71,0xdc8ed48e,0xd48dd46c,0xa3ece571,0x10411000,0x10000861,0xed509b28,0xe50fed70,0xedb2ed2f,0x10006204,0x00001862,0xcd731820,0xfe53edd3,0xf5d0fe12,0xe5b1dd2d,0x082072c8,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x20a10000,0x59c40800,0xf5f1e591,0x7aa6dd70,0x08000800,0xedd1cd10,0xf612ed6f,0x1000ddd4,
-0xacb00800,0xfe33feb5,0x83acee97,0x20a20800,0x08001000,0xff18de36,0xe5f2f653,0x10006aa7,0xcd532000,0xf694f675,0xb50fee94,0x00000000,0xf675bd10,0xee98f696,0x00005247,0x20e12943,0xb5530000,0xee75ff18,0x72a6f6d7,0xac901000,0xe633f6b6,0xf739eeb6,0x0800942f,0xcdd30800,0xfef7f675,0x0000c574,0x21451904,0x83ac0000,0xfeb6ee97,0xfeb6fe96,0xfe95fe75,0xfe94fe74,
-0xf613fe53,0x8328f695,0x52060800,0xfe96f697,0xc532fed8,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000018a2,0xf6f97b6b,0xfe55feb8,0xfe76fe56,0xdd93fe76,0x00003921,0x100020a2,0xfe96cd73,0xfdf4fe14,0xc4affe34,0x08211800,0x39210000,0xfe96ddd4,0xfe34fe54,0xfe75fe75,0xf5f2fe75,0xfe13fe34,0xd573f614,0x18012820,0x00000821,0x08001840,
-0x20611800,0x000018a1,0xc5b33982,0xff19fef8,0xbc8ff697,0x180040a0,0x00211020,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000021,0x00400000,0x08400840,0x62670000,0xee75b4cf,0xc571ee75,0x08007b69,0x20800800,0x20201820,0x28002800,0x00001820,
-0x20820840,0x8ac91800,0xfe53fe35,0xfe53feb5,0xf633f654,0xfe94f5f1,0xcd72fef7,0x20e30800,0x10001081,0xf633ac0c,0xfe33f613,0xedb1fdf2,0x1000c50f,0x18e31080,0xa46f0000,0xf654fed7,0xfef6fed6,0xee34f633,0x00006aa8,0x000010a1,0x00000000,0x00000000,0x00000000,0x00000000,0x00001020,0x10001000,0xcd307265,0x7264cd50,0x08000800,0xddb1ac8e,0xd5b1ddb0,0x08008bcb,
-0x942e0000,0xedf2e5f2,0x49a3bd31,0x08000800,0x080020a2,0xde157b4b,0xdd91dd91,0x10006aa8,0xac4f2000,0xddd1cd2f,0xa44ee634,0x08000800,0xff7bc593,0x6268e698,0x10000800,0x00000800,0x18601040,0xff59bd73,0x6285e6b6,0x944e0800,0xff57ffba,0xffdcf738,0x00009490,0xd6340800,0xee95f6d6,0x1000c574,0x10400000,0x6ae90000,0xf675e655,0xfed5fe95,0xfe94feb5,0xf652f653,
-0xf633fe32,0x8308f655,0x4a060000,0xf6d7e655,0xa490ff1a,0x10a20000,0x08410040,0x00000000,0x00000000,0x00000000,0x00000000,0x000018a2,0xf6f8838b,0xf675f6b6,0xfef8f696,0xbd11fef9,0x19030000,0x8b8c0800,0xfed7ff59,0xfed7fed7,0xde35ff38,0x20a31000,0x41a50000,0xff3aeeb8,0xfef8ff19,0xff39fed8,0xfef7fef7,0xfed7fed7,0xe655ff18,0x08002060,0x10001040,0x28201000,
-0x20004040,0x20e32020,0x00000000,0xddf48bab,0xf676f696,0x8b6bddd4,0x00200000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08210000,0x00000821,0x18a00000,0x00001061,0x83691800,0x10008bcb,0x10600000,0x28801840,0x49204142,0x8b085960,0x20808349,
-0x28c20000,0x82882000,0xf5f1fe34,0xf653edf1,0xee53f674,0xedd1fe94,0xc530f654,0x10610800,0x100018a2,0xfeb5b44c,0xfe12fe12,0xfe33fe33,0x7ae6f654,0x10e30000,0x62860000,0xfed6e635,0xf654feb5,0xee55fed6,0x00006267,0x00001080,0x00000000,0x00000000,0x00000000,0x08400020,0x83ad0800,0x18006248,0xa42d1800,0x7ac5f675,0x28a01000,0x61c04900,0x5a236221,0x08002060,
-0x49e50000,0xa3ca9389,0x18005160,0x62252800,0x10002020,0x51c50800,0x7ac672a6,0x08003902,0x62051000,0x69e08326,0x30005940,0x080030a2,0xe6d8c5b4,0x00006b0a,0x51c50800,0x836bc553,0x00000800,0xb5310800,0x3140de96,0x5aa80000,0xad10ad31,0xad53a4f0,0x000052a9,0x9c8e0000,0xc572de55,0x10005206,0x38e14163,0x10000800,0xddf372a6,0xddb2e614,0xc50ecd91,0xddd2ddd2,
-0xe614e5f3,0x72c8ee55,0x39a50000,0xf6f8de56,0x08009c4f,0x00000000,0x00000860,0x00000000,0x00000000,0x00000000,0x00000000,0x000018a2,0xff387b6a,0xfef7ff18,0xf6f8fef7,0x41a4e697,0x00200000,0xe63649a5,0xfed6fef7,0xfed7fed7,0xde35ff79,0x20832020,0x49e60000,0xff5aeed9,0xff39ff19,0xfed8fef8,0xfeb6fe96,0xfed7feb7,0xeeb7ff38,0x10202040,0x080020a1,0xc4f0832a,
-0x69429287,0x20402800,0x188018a1,0x38c00800,0xf6d8ac6e,0xbd53ff1a,0x08200800,0x10001021,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08010821,0x5a481820,0x10003900,0x20c20800,0x00001020,0x10400000,0x20401881,0x50e03020,0x828450c0,0xe5d2ccee,0x3900d592,
-0x20a10000,0x930b1800,0xfe75fe97,0xfeb6ee54,0xfeb5fed6,0xcc2bdcad,0xac2cdced,0x00210000,0x180020a3,0xfe12aba9,0xed2ef56f,0xed6fed2e,0xac4bedd1,0x08810800,0x080010a0,0xde138369,0xe5b1f654,0xe5b2f612,0x00005a25,0x00001060,0x00000000,0x00000000,0x00000000,0x18600820,0xb4d01000,0x3880c553,0x6a661800,0x6a03d572,0x18001800,0x20002800,0x10001800,0x08210000,
-0x08000820,0x20001800,0x61a02000,0xdd70b40a,0x2000c4cf,0x000020a2,0x10000800,0x08000000,0x08001040,0x20001000,0x28002000,0x10003020,0xb530bd51,0x00000000,0xde156287,0xee55f6d7,0x08008bab,0x39c40800,0x5a87c5d4,0x00000000,0x00000000,0x00000000,0x00410000,0x08000840,0x100028a0,0x08000000,0xd593cd52,0x10004901,0x20a01000,0x30e141a5,0x10000800,0x49e43100,
-0x49c549c5,0x31014183,0x08400860,0xc593e6b8,0x00000000,0x942f62c9,0x00000820,0x00001020,0x00000000,0x00000000,0x00000000,0x000010a1,0xe6755a44,0xf655feb6,0xf73af6d7,0x00009cb0,0x08002103,0xfef8b4b0,0xfeb5feb6,0xfeb7fe96,0xd5b3ff18,0x20002820,0x59e50800,0xfed7e656,0xfe96fe96,0xfed8f635,0xfe95fef7,0xfe34fe54,0xd572f654,0x10002820,0x100020a2,0xfe76ac4e,
-0xcc0cecf0,0x200071a3,0x18601000,0x000028e2,0x7b8d0800,0x29038bee,0x18a20000,0x08001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20a30001,0xa42f1000,0x8b28d593,0x10002000,0x18a12060,0x00002103,0x28001000,0x822350c0,0xf612cc8d,0xfeb4fe94,0x6244f695,
-0x21020000,0x72071000,0xfeb6e5b3,0xfed6ff38,0xfeb5feb6,0xf570fe33,0xd551fe12,0x00001020,0x18002083,0xf5d1a368,0xf56eed4e,0xed91f5b1,0x6a43c4cd,0x10410800,0x10600000,0x5a030000,0xe5b1ac2b,0xd571e5b1,0x00006288,0x00001060,0x00000000,0x00000000,0x00000000,0x18600820,0xb4f01000,0x59e5ddf5,0x5a051000,0xc511ddf5,0x7ac87b09,0x6a057ac8,0x6a677ac8,0x00001000,
-0x18400820,0x596338e1,0xccef7265,0xedd0edd1,0xac6eee33,0x29040000,0x10001000,0x10400000,0x20600000,0x386038c0,0x48806184,0x49203000,0xc5b2e695,0x00000020,0xfef8acd0,0xfed6ee54,0x5a46e676,0x39c50000,0x6ae9d657,0x00000800,0x00000000,0x00000000,0x08210000,0x00000000,0x18002020,0x10001861,0xf697a44e,0x6a25ddd4,0x08001000,0x00000800,0x10401021,0x08000800,
-0x08000800,0x08000800,0x62c80000,0x83aceefa,0x08000000,0xce16d657,0x10820000,0x00000800,0x00000000,0x00000000,0x00000000,0x00001081,0xde345224,0xf676f696,0x83acd5f5,0x10e10000,0x08001061,0xe635acb0,0xf674e613,0xf697f696,0xd5d4fed8,0x28812840,0x62670800,0xf675e655,0xf634ee34,0xe571f614,0xd48cd4ae,0xcc6ccc0a,0x9348bbea,0x10002000,0x08001040,0xdd5182c8,
-0xed0fed30,0xababdd10,0x20005941,0x10201000,0x00001062,0x00000000,0x08001860,0x41232000,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18610000,0xa38b1800,0xdcaddcce,0x71e2c40b,0x10401800,0x08410000,0x38800800,0xed70ab68,0xf5f1fe32,0xfe53f5f1,0x6244f674,
-0x10c10000,0x7a881000,0xe5afe591,0xf653f632,0xfef5f694,0xed6efe52,0xd530dd2e,0x000028a0,0x10001081,0xedd19ba9,0xf5f1ed8f,0x9babdd51,0x10001800,0x10011000,0x10840843,0x00002104,0x72a71000,0xd616cd72,0x00005248,0x00001881,0x00000000,0x00000000,0x00000000,0x08400020,0xbd740000,0x28c0d636,0x20600800,0xff19d615,0xeeb7eeb7,0xf696f6b6,0xee35ee34,0x00009c4f,
-0x6b090000,0xe635d5f4,0xf674e634,0xee11fe53,0xbcf0f674,0x00000800,0xbd12a46f,0x000020a2,0xc5114162,0xdd70ee13,0xee35dd91,0xe636ee35,0xbd51ff18,0x00000000,0xff7a9c6e,0xf6d6f6d7,0x5246eeb7,0x29440000,0xde57de98,0xa470acb1,0xac8eacaf,0xac8fb4cf,0x08005a48,0xacb10800,0xa40ccd52,0x08400800,0xa4d00000,0xe5f4f6d8,0xac6eb4ae,0x72caa42f,0x00000800,0x9bcc6226,
-0x93699b8a,0x938a8b49,0xde7793cb,0x732aff7b,0x31420000,0xde77eef9,0x00001020,0x08000820,0x00000000,0x00000000,0x00000000,0x00001082,0xe6d95246,0xbd53ff5b,0x000041c5,0x084018c2,0x08410000,0x942e0000,0xff59eeb7,0xfef8ff18,0xde55ff59,0x18601820,0x62870000,0xff59eef8,0xff18ff59,0xdd30fed7,0xf613dd30,0xfe54fe34,0xe5f3fed6,0x10401800,0x08002103,0xee33b48e,
-0xfe52f5f1,0xe570fe73,0x79e3bc0b,0x18411800,0x10820801,0x00002101,0x8b4a2860,0x9bacd593,0x10a20800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20800000,0xccef2000,0xecccfdf2,0xdd2eed0e,0x10009389,0x10621861,0x72870000,0xfdb0ed91,0xed8efe11,0xf612e52d,0x5a43ee74,
-0x10c10000,0x6a260800,0xfe51ee12,0xfe94fe73,0xfe93feb4,0xfe73f611,0xcceffe94,0x00002860,0x080018c2,0xfeb69beb,0xabebe5d2,0x18005120,0x18202040,0x28412840,0x08001000,0x20a20800,0x080028a1,0x5a680800,0x00002965,0x00000820,0x00000000,0x00000000,0x00000000,0x00400020,0x4a060000,0x00005a68,0x00000800,0x6ac762a8,0xa46d72c7,0xfef7ee96,0xf695ee13,0x0000bd73,
-0x41a30840,0xb4afa44e,0xee55c530,0xe613feb6,0xbd31fed6,0x00000000,0xfef9cd73,0x08006aca,0xee767ae9,0xfe74f654,0xee34f633,0xac6fc511,0x6aa7acaf,0x00000000,0xb4f06267,0xbd10b4f0,0x10009c6e,0x18c30000,0xb4f18bed,0xd5d5b4d1,0xff39ff5a,0xff9bff39,0x1000a470,0xde161800,0xee55fed7,0x0800ac8f,0x00000880,0xfef7c551,0xfed7fef7,0xbd33ff19,0x00000000,0xff18bcf1,
-0xfeb6feb7,0xee96ff39,0xe677ddf4,0x4206c5d5,0x20a10000,0xcdd5d616,0x00000000,0x00000841,0x00000000,0x00000000,0x00000000,0x00001062,0xb57439a5,0x080083ae,0x29030000,0x08000800,0x10201820,0x00001081,0xc59349e5,0xf6d8ff19,0xd614ff18,0x10a01060,0x4a050000,0xf6f8e6b7,0xfed7f6d7,0xfed6edd3,0xfeb6feb6,0xfe55fe55,0xd5b3f675,0x00001800,0x08002103,0xfef6ac8e,
-0xfeb3f673,0xfe52fe72,0xccaefe33,0x08006a06,0x20c31022,0x7b280800,0xfed7cd92,0x936bfeb7,0x18c30800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20800000,0xb3ea2000,0xf4edfd70,0xf5b0dc4a,0x9c2dee54,0x20a30800,0x51640800,0xf56fdcf0,0xfe52fdf0,0xed6fed4e,0x51e0d590,
-0x18c20000,0x6a870000,0xfef5ee54,0xfe94fe94,0xfe32fe73,0xfe53fe33,0xddb2fe94,0x000028c0,0x000018a2,0xacd083ab,0x08004183,0x28611000,0x41442061,0x402040a1,0x9b2979e3,0x10002800,0x18812082,0x00201080,0x00220000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08000820,0x10000800,0x10200800,0x10000800,0x18001000,0xcdd46287,0xe655f6d7,0x00006ae9,
-0x100020a0,0x20001800,0x28201800,0xff39cdb3,0xa490f719,0x00000000,0xf6b6cd51,0x08007b2a,0xe6986268,0xfed5f6b5,0x72a8ee76,0x08001000,0x00000800,0x08400860,0x20001800,0x18002000,0x08001000,0x00010001,0x10000800,0x10001000,0xeef9a4b0,0xff5aff3a,0x08008bee,0xee562820,0xfed6feb6,0xa40dfef7,0x08000800,0xfeb7ac2e,0xfe75fe75,0xbd32ff39,0x00000000,0xff19a48f,
-0xfef8feb6,0x5a26cdb4,0x08001000,0x00000000,0x08000841,0x184028c0,0x00210020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00002102,0x20a20000,0x100020a2,0x8b296a66,0x30204020,0x18e11000,0x00000000,0xeeb8940f,0xd614ff5a,0x10c01060,0x49a50000,0xfed7e676,0xfe55fed7,0xfeb5fe54,0xfeb5feb5,0xfef8feb6,0xe635ff18,0x00001000,0x00002105,0xff39b4d0,
-0xfe94feb5,0xfe73fe53,0xee54fe53,0x1000832a,0x100028e3,0xfe559349,0xfef7fef7,0x9bccff19,0x10a20800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000020,0xbc6d1800,0xe4ede54f,0xf5f1f590,0xc550ee33,0x08001000,0x18001822,0xd4cd9b08,0xedafed8f,0xf5f1fe11,0x7306ee73,
-0x18a10000,0x62870000,0xee33de13,0xe570e591,0xf612dd4f,0xdd2ffe33,0xbccfd4ee,0x000028c1,0x10200821,0x08200000,0x18a20000,0x38a22861,0x40a03040,0x92c65900,0xed90cc4b,0x5963ccf0,0x10610800,0x08a10040,0x00000041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x5a281000,0x18006289,0x00001020,0x93ec730a,0x100051e4,0x5a261000,0x8349bd10,0x20c10800,
-0x49212020,0x28005142,0x10002820,0xb5523941,0x0000944f,0x10002903,0xf695c530,0x08006a86,0x836c0000,0xde14d5d3,0x1000832a,0x18401800,0x000028e0,0x00000020,0x724740c1,0x72877aa8,0x00004964,0x00000801,0x30802880,0x20201800,0xad120800,0xacf2ef1a,0x08000000,0xddf438c0,0xe5f3e614,0xd593ee34,0x080030e1,0xf6569bed,0xee34e5f3,0x7b6bde15,0x10800000,0xbd533963,
-0xc552f6b7,0x08001000,0x18000800,0x08410000,0x00000821,0x10001000,0x00210000,0x00000842,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10211883,0x834b0800,0xf635e635,0x50a0abac,0x204040c0,0x184020a1,0x62681000,0xd635d615,0x00600840,0x28600000,0xfed7ddd4,0xcc6cfe34,0xcc8cbbe9,0xe5b1dd90,0xe5d3edf3,0xbcf0ddb2,0x00201000,0x000010c3,0xe6158b6b,
-0xe5b1e5d2,0xedf2f633,0xd5b2fe95,0x18001800,0x38e00800,0xdd0eccef,0xedf3dd50,0x8b4ae5d3,0x18c30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18400000,0xbd101800,0xfe74fe95,0xfe53fe33,0xe654ee33,0x000083ab,0x00002904,0xe6134100,0xf654f695,0xf695f674,0x62a6eeb6,
-0x18c20000,0x4a060800,0xc52fbd31,0xe5d3bccf,0xd56ff674,0xd52fd54f,0x9becd530,0x10620800,0x08010001,0x18601020,0x20a11880,0x402040e3,0xab6879a2,0xdcedcc4b,0xfdb0f58f,0xd510fdf2,0x08007ae9,0x00200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200020,0xcd941800,0x83acff3a,0x00000000,0xee96d5f4,0x6a87de15,0x08000800,0x10001000,0x38e01800,
-0xd5b3bd11,0xcd51d551,0x10006a46,0x00000820,0x08200000,0xa44f0800,0xfed7f6b6,0x4184de36,0x10000000,0x5a255204,0x18001000,0xc59172c6,0x83abcdd3,0x08000000,0xf656a3ee,0xee34edf3,0x1800c552,0x5a070800,0xddb3d5b3,0x1800bcd1,0x18610800,0x000062eb,0x08000800,0xf6f9acb0,0xfed8fef9,0xcdf4ff19,0x00003184,0xe697942e,0xd614e696,0x00005a46,0x00000000,0x20a20800,
-0x39429c70,0x10000800,0xd5b4a44e,0x08009c2f,0x41a50000,0x51838309,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08810040,0x08001862,0xf719838d,0xfeb5f6d7,0xd551f675,0x6960a349,0x10004080,0x000028c2,0x734a2901,0x00200820,0x29000000,0xfe96de14,0xedd2e591,0xfef7fe75,0xf6d6f6d6,0xe614f6b6,0xd5d4fed7,0x10820800,0x000010e2,0xe6159c0d,
-0xfe96f656,0xfed7f676,0x834af6b7,0x29240800,0x9c6f0000,0xf675fef7,0xf676f654,0xa40eee36,0x18c30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200000,0xbd521000,0xddf3f6f7,0xc530d592,0xacadbcce,0x00006ac7,0x10810861,0x83aa0000,0xa48eaccf,0x93cba42c,0x29207b69,
-0x10400000,0x08000000,0x7b486ae8,0x72c772c8,0x7ae68307,0x6a437283,0x288059c2,0x00000000,0x00000001,0x18401001,0x30a028c0,0xa34a3840,0xf590dcef,0xfe52fdf1,0xed6eed8e,0xd530f5d1,0x000093ad,0x08401040,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0xcdb31000,0x9c4eff19,0x08000000,0xff18ddf4,0xe6b8f6d8,0x0000736b,0x20813104,0xcd931000,
-0xff18fef8,0xfed7fed7,0x6ae9ee97,0x19230000,0x000010e2,0xf6f9a4b0,0xfef7fef8,0xcdf5ff39,0x080041a5,0x08000000,0x5a260800,0xf6d6d5f3,0xbd52f6f7,0x08000000,0xfef7c511,0xfed6f633,0x3900ee97,0x730a0800,0xf695f6b6,0xc533fed8,0x084120a1,0x18620000,0xacf20800,0xf71aff5b,0x9bedbd33,0x7309a44e,0x00000000,0x52263143,0x28c03960,0x10000800,0x7b6c5a26,0x10200000,
-0x08000000,0xacb01000,0xfed7fed7,0x2000e657,0x83ac0800,0xc552fef9,0x00610800,0x00000041,0x00000000,0x00000000,0x00000000,0x00200000,0x00000040,0x00001061,0xacf149c6,0xff38eed7,0xfef7f6b6,0xc44dfe34,0x48c08ac7,0x20602840,0x00000000,0x08410841,0x10200000,0xfed7de55,0xfef8f676,0xff7aff59,0xf739f738,0xff19ff19,0xeed9ff5a,0x08600000,0x00001903,0xff9cbd52,
-0xff7bff5b,0xff9cff7b,0x1000cdb5,0x000028e3,0xde7841a5,0xff38ff7a,0xff39fef8,0xbd12ff3a,0x18c30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000820,0xa4f10800,0x0800946e,0x08000000,0x08000800,0x10400000,0x00000000,0x00000840,0x00000000,0x10000800,0x00000000,
-0x00001000,0x00000000,0x00000000,0x08000800,0x08001000,0x08000800,0x00000800,0x00200840,0x00200040,0x30e11040,0x59402000,0xedb1bc4c,0xf612fe33,0xf653f612,0xee53f673,0x59a4b44d,0x10620000,0x10610800,0x00200041,0x00000020,0x00000000,0x00000000,0x00000000,0x08000020,0xb4d02000,0xacf0ff59,0x00000000,0xff19de56,0xde77f719,0x0000630a,0x10612905,0xd5f50000,
-0xfe96ff39,0xf6b7fe97,0x83eef71a,0x21250000,0x10200842,0xff18d636,0xf696f6d6,0xff5bf6b7,0x0000ad13,0x294420c2,0xa4d10000,0xee95ff38,0xb4f0f6d6,0x08000000,0xfef6bd0f,0xf6b6f6b5,0x28c0d635,0x732a0000,0xde12f6f7,0xde36e655,0x00005268,0x00003185,0xeed96a88,0x9c2ff71a,0x10000800,0x10001000,0x08610840,0x08000000,0x10001800,0x51a31800,0xe6d8de55,0x00005205,
-0x00002944,0xe6356267,0xf655d52f,0x2000ee97,0x83ed0000,0xddf5ff39,0x08400000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x08610000,0x18c20840,0x00000000,0xbd735268,0xfef7f6f8,0xfe96fed7,0xa368e591,0x40606940,0x10a22060,0x00010001,0x00000000,0x9c8f7bcc,0xa4b0a4d1,0x9c6ea4af,0x8bed9c6e,0x8bef8bee,0x83ad944f,0x08400000,0x00001081,0xbd947b8c,
-0xb5b4b574,0xc5f6c5f6,0x00005a68,0x000020c3,0xd65783ce,0xd614d615,0xd5f3de55,0xb511ff18,0x18c30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x62ea2903,0x08200000,0x18811081,0x28c02060,0x182028a1,0x00010842,0x18c20000,0x18a410a3,0x20612082,0x18a218c2,
-0x08000800,0x00200001,0x18c11081,0x30c128c2,0x288030a1,0x31023901,0x108020a1,0x00000020,0x08600000,0x20001800,0xccef7a44,0xfeb4fe53,0xf633fe53,0xfe95f633,0x8348ee95,0x08001000,0x186218a2,0x10001800,0x00600000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0xa48f1000,0x7babe6b7,0x00000000,0xff1acdb4,0x4a25d677,0x00000000,0x00000000,0x41a40000,
-0xff39de35,0xfef9fed8,0x0000acd1,0x000020c2,0x08000800,0xe6b77b6b,0xff39f718,0xde37ff3a,0x000062a9,0x08000800,0x52060000,0xff59de56,0xb511ff39,0x00000000,0xff78c5d2,0xff3afef8,0x1880deb8,0x7b6b0800,0xff59ff7a,0x8bccf6f9,0x08400000,0x20800000,0xb4f21800,0x0800940f,0x20002041,0x202038a1,0x00000000,0x51e70800,0x514259c5,0xe6157aa7,0xa48ef719,0x18000800,
-0x28a10000,0xb4d02000,0xf6b6f6b6,0x2060e677,0x842e0000,0xcdb4ff3a,0x08800000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000021,0x20a01060,0x18001000,0x20c21040,0x00000000,0xfef8a48f,0xfeb6f6b6,0xf5f2feb5,0x7a03c42b,0x20611800,0x00210801,0x08200000,0x00000020,0x00000000,0x08000800,0x08001000,0x00000000,0x00000000,0x00001040,0x10600000,0x00000000,
-0x00000000,0x00000000,0x18810000,0x18200800,0x18003944,0x41811800,0x100030e0,0xa48f940c,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000000,0x18201820,0x18001800,0x51425122,0x10002800,0x00000800,0x00000020,0x00000822,0x18002020,0x00001000,
-0x00210840,0x00000000,0x10001000,0x30001800,0x614150e0,0x30003800,0x08001800,0x00400820,0x08000080,0xc3ec58c0,0xfe75f5f4,0xfe73f5f2,0xfe95fe53,0xfeb6fe95,0x1000bcef,0x20a120a1,0x10000800,0x72682800,0x00003184,0x000010a1,0x00000000,0x00000000,0x00000000,0x08000800,0x41a50000,0x108041e5,0x00000020,0x6b0a41a5,0x00003143,0x6aa80000,0x6aa8bd12,0x00000800,
-0xcd934183,0xb4aeee55,0x18400800,0x6aa82860,0x10004143,0x5a880800,0x83ed8c0d,0x5a8a9c91,0x18200000,0x18004162,0x00000800,0x8c0e4a06,0x49c78bcf,0x00000000,0xa4cf7bab,0xad32b511,0x0000842f,0x52070800,0xb512a490,0x08007b4c,0x62a80800,0x08007b6b,0x00001820,0x10000000,0xbccf2800,0xc531f696,0x00001860,0xee7672c8,0xfed6fed7,0xfef8f695,0x08008bed,0x38a01000,
-0x100059c5,0x08001000,0xeef9c593,0x0000bd94,0x63090020,0xa4b0ce15,0x00400000,0x00000040,0x00000000,0x00000000,0x00000000,0x00000841,0xbcf151c5,0x6960a36a,0x18004880,0x000020c2,0xf69651c2,0xfeb5fed6,0xfe94fe74,0xdd50feb5,0x380092a7,0x10001800,0x00000000,0x20a118c2,0x20601840,0x30a12020,0x20602020,0x21041882,0x10c22124,0x00000021,0x10201000,0x31041020,
-0x18822904,0x10c40862,0x08000000,0x10001821,0x10001000,0x08001800,0x00000800,0x20c10000,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200820,0x30401000,0x828640a0,0x79e392c7,0x8b498ac7,0x20406a46,0x08400000,0x18000801,0x59842000,0x59e56a47,
-0x00200000,0x08210021,0x59e60800,0xb44e9bcc,0xb38aab8a,0xb3ecb3cb,0x8b6dac0e,0x00001840,0x080008c0,0xed1092a6,0xedd3edb3,0xfe74fe54,0xfe74fe74,0xf613fe32,0x0800a46e,0x000020c2,0x93ab30c0,0xcd32b42e,0x00005267,0x00000860,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x00000000,0x08200000,0x00000000,0x08000000,0xe698836b,0xe677ff19,0x000062a9,
-0xc5730800,0xac6eff59,0x18200800,0xf6f893ec,0x5a05de35,0x18001000,0x00000800,0x00000000,0x62680000,0xd5f4de56,0x08004982,0x00000820,0x08000800,0x00200840,0x08000000,0x08001000,0x00200000,0x08001000,0x08001000,0x10000800,0xe6565a04,0x838beed8,0x21030000,0x28c10840,0xf654c510,0xcd70f653,0x00002900,0xe63493cb,0xee12f674,0xbcefee34,0x00000800,0xbcf14943,
-0x8329e615,0x20a11000,0x28e00800,0x00001040,0x00000840,0x00000000,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00001081,0xe63459e3,0xd4cff5f3,0x280092c8,0x08001840,0xd59151c2,0xedb0e5d1,0xedf1edf1,0xee12edf1,0xbc2eedd3,0x08002800,0x00000841,0x41220800,0x49416225,0x49434943,0x38c04921,0x080028a0,0x00400000,0x10410000,0x28600800,0x202051e6,
-0x10001000,0x00210021,0x08001062,0x30802020,0x49024943,0x51645102,0x10002881,0x00001021,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200000,0x38202020,0xb3498205,0xed70ed71,0xe591ed70,0x93aadd91,0x18a10000,0x10001861,0xd59382ea,0xe5f3dd92,
-0x1020a44d,0x10a310a2,0x838c0800,0xfeb6f697,0xedb1f5f3,0xf5f2f613,0xddb3f5f4,0x00005a05,0x08002101,0xf634ac0d,0xe5b1e5b2,0xccedd52f,0xe590edb1,0xedf2e56f,0x0800a42d,0x00002924,0xfed79bec,0xd5b3fed7,0x00003901,0x00001081,0x00000000,0x00000000,0x00000000,0x08000000,0x41441800,0x10003923,0x08200800,0x72c86ae9,0x8bac4121,0xff1af6d9,0xf719ee97,0x0000acf1,
-0xcdd50800,0x8b6aff9b,0x28601000,0xff17d614,0xe675ff17,0x48c09b8b,0x202038a0,0x00002903,0xd5f44183,0xf6d8f6d8,0x59c2de15,0x18001000,0x10001800,0x00200820,0x20000800,0x18002000,0x10210800,0x08000000,0x10001000,0x38e01800,0xfef7de13,0xf6f8f6d7,0x00006aea,0xb5110800,0xedf2ee55,0xc531e5d2,0x00003143,0xee748bcb,0xee33f654,0xbcb0f675,0x00000800,0xee958beb,
-0xe635fef7,0x10006205,0x00000800,0x10400000,0x00000040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001062,0xde135203,0xfe95fed6,0x4943e5f5,0x00000000,0xeeb65225,0xf613ee34,0xfed5fe74,0xfeb5fe94,0xf677feb6,0x00006268,0x080018a3,0xd5b39c2e,0xe592dd92,0xd551e5b2,0xd550dd91,0xbcf1cd30,0x00007b6b,0x000010a1,0xac6f2000,0xb48ecd51,
-0x3923830a,0x08420000,0x30e10000,0xcd51b4d0,0xd530cd30,0xab6accaf,0x30405942,0x08221001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x48a01800,0xdc8e81e3,0xf5b0f5b1,0xfe11f5d0,0xf654fe53,0x00006266,0x100028c2,0xf6566226,0xf633feb6,
-0x6a86ee75,0x20e40800,0x39220000,0xfeb5de14,0xfe33fe54,0xf612f612,0xf676fe33,0x000072c7,0x000020e1,0xff3aa46f,0xac6dee76,0x38005120,0xedf3a389,0xfed6feb5,0x1000ac8f,0x08002924,0xf6969c0c,0xe655fed6,0x00004163,0x00000020,0x00000000,0x00000000,0x00000000,0x10400020,0xcd951800,0x51c5e678,0x29020800,0xff5bde98,0xffbcff3b,0xff1aff9c,0xff9bff3a,0x00008c4e,
-0xbdb50000,0x6267eef9,0x49831000,0xf6f6e634,0xff17fef6,0xee77fed8,0xc594f6d9,0x00000800,0xff7b7b2a,0xff3af6d8,0xeeb7ff7b,0xcdb5d5d4,0x72ebbd34,0x00000000,0xcd9493ee,0xc553c532,0x0000730b,0x6aec0800,0xde78c5d6,0xeed7e697,0xf6d6ff38,0xffdcff7a,0x0000a4f2,0xe6770800,0xfed6ff39,0xde35fef8,0x20c00000,0xb4ae1000,0xfef8fef7,0xb4f1fef8,0x00000000,0xff389c6e,
-0xfed7ee75,0x838bd5d4,0x83cd8bcc,0x00005226,0x10a10000,0x41a53985,0x08200000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000862,0xe6b55a85,0xfed7f6b6,0x5164ee57,0x00000800,0xeed85245,0xfef8ff19,0xa3ebe5f4,0xe675b4ce,0xe676ff38,0x000041a5,0x080020a2,0xfeb6e655,0xfeb5fe75,0xfed6fed6,0xfeb5feb5,0xfef8fed6,0x080083ac,0x000020e1,0xff3aa44f,0xfed7fed7,
-0x28c1de36,0x20e40000,0xb4d10800,0xff17ff39,0xfef7ff37,0xe530fe95,0x510179c3,0x08210800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10200020,0x59a32000,0xfe54bc4d,0xfe94fe94,0xfeb4f673,0xfe94fe94,0x3920de14,0x28c10000,0xbcf10800,0xfe54feb6,
-0xe634feb6,0x08001000,0x080020a1,0xf695a42c,0xfe54fe74,0xfe95fe74,0xf696fe76,0x0000838b,0x000020c1,0x9cb06b2b,0x08004205,0x20001800,0x51e51000,0xd636b531,0x00007b6b,0x00002102,0xfef7a44d,0xe676f6b6,0x00003942,0x00001081,0x00000000,0x00000000,0x00000000,0x18600020,0xd5d51000,0x7309eed8,0x39830800,0xde78f73b,0xa4d2ad33,0xa4b0a4b1,0x842f9470,0x000039e7,
-0x528a0000,0x0840630a,0x5a260000,0xfed6ee75,0xfef7f695,0xc593e676,0xad33ce16,0x00000000,0xa4d23985,0xb533b554,0xc5b4bdb4,0xeed9c5b4,0xa4d2ff9c,0x00000000,0xff9bce16,0xff7bf719,0x0000bd94,0x840e0000,0xde77ff9c,0xbd52bd53,0xb531b531,0xad12a4d0,0x00205aca,0x946f0000,0xb4f0bd73,0xf719de35,0x0800942e,0x10002060,0xcdb3acb0,0x83accdd4,0x00000000,0xad126b0a,
-0x93eba46e,0xa48fad10,0xd656a4cf,0x0800c5b4,0x736b0020,0xacd0f6fa,0x18610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00001061,0xe6b74a04,0xfed8fef7,0x38c1ee57,0x00000800,0xe6b741c3,0x8bedd615,0x00000800,0x49e30820,0xcdf4b551,0x08203142,0x20a00000,0xfef7e676,0xf634f675,0xfeb6f695,0xfeb6feb6,0xbd32fed8,0x29020000,0x62470800,0xfed9ee77,0xfed8fed8,
-0x084083cd,0x080020a1,0xeed86ae9,0xf6b6f6d7,0xf696fed7,0xfe96feb6,0x5900b3ca,0x00002880,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0x8b4a1000,0xfe32f654,0xfeb5fe53,0xfe94feb4,0xedb0f5f1,0x8b8bee34,0x20e10800,0x5a050000,0xfe74f655,
-0xee54ee12,0x10008329,0x000020c1,0xddf31000,0xf653fef7,0xfe75fe94,0xf6b7f675,0x00007b4a,0x10401860,0x00000000,0x39010000,0x59634922,0x08004144,0x18a00000,0x000020e2,0x00002102,0xf6f8a46e,0xde15f6d7,0x00003122,0x00000860,0x00000000,0x00000000,0x00000000,0x10810021,0xcdf50800,0x4161eed8,0x49a41000,0x8c0ee6b8,0x00000000,0x10001000,0x00000800,0x00210000,
-0x00000862,0x18800000,0x18201060,0xff19d5d4,0xde15ff19,0x08006265,0x00001020,0x08421062,0x00000000,0x18001000,0x00000800,0x7b6b0000,0xb512ff9c,0x00000000,0xf75abdb4,0xff9bef19,0x0000ad12,0x8c2e0800,0x4a05ef1a,0x10000800,0x10001800,0x10001800,0x08410000,0x00000840,0x10000800,0xc5d53100,0x732aeef9,0x20a20800,0x10000800,0x00000800,0x10800820,0x10000000,
-0x18001000,0x08000800,0x8bec1000,0x1000cdd4,0x4a060000,0xcdd4de36,0x18a20800,0x00000000,0x00000000,0x00000000,0x00000000,0x00001041,0xd6153100,0xf6d8f6d7,0x2000de16,0x00000000,0x946e3983,0x100028c0,0x39441820,0x00002902,0x4a250800,0x08401880,0x41c40000,0xfef7de55,0xfeb6f696,0xfef7f696,0xf6b7feb6,0x49a5e657,0x20e20000,0xc5321000,0xf677ff1a,0xd5b4feb8,
-0x00000000,0x10001880,0xfef8c572,0xfed7fef8,0xff18fed8,0xff17fef7,0x7202edf3,0x000030a0,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10800840,0xac6f0800,0xed6eee12,0xed0ef56f,0xe4ace4cd,0xe50ddc8a,0xb44ee591,0x08600800,0x08001101,0xedd1b42b,
-0xddb2e5b1,0x1800c511,0x20e10000,0x7b280800,0xf653ee74,0xf612f611,0xff18fe74,0x000072e8,0x08001861,0x30a02060,0x92e761c2,0x71209286,0x49216183,0x00003100,0x00000820,0x00002104,0xff39a4b0,0xde56f719,0x00001860,0x00000860,0x00000000,0x00000000,0x00000000,0x00200000,0x9c910000,0x100083ee,0x6a681000,0x8beeeed9,0x31020000,0x93076a03,0x82e8a38a,0x08002020,
-0x30e10800,0x28206226,0x10000800,0xd5f651c5,0x49e6de58,0x08000000,0x08001000,0x00000801,0x20001820,0x28003000,0x00000800,0x08000000,0xd5b4e677,0x08000800,0xe6986288,0xce56ffbc,0x10404a47,0xb5321000,0x0000deb8,0x286020c2,0x69823800,0x200050a0,0x00001000,0x00000841,0x08000800,0x00000820,0xd658ad53,0x08003145,0x18002000,0x18001000,0x08001000,0x20001000,
-0x20002000,0x18600800,0x732a0000,0x1000d5d4,0x00001860,0x734b28c0,0x00210000,0x00000021,0x00000000,0x00000000,0x00000000,0x00001041,0xde362020,0xff19fef8,0x1000de16,0x10400000,0x00000000,0x28001800,0x7a0669c5,0x30a05121,0x000028e0,0x08400020,0x4a060000,0xf676e656,0xf696ee35,0xfed7feb7,0xf698f697,0x00007b4c,0x00002924,0xee777b09,0xf697f676,0x6a66f696,
-0x20e30800,0x83cc0800,0xf675eeb7,0xfe55f655,0xfe34fe34,0xf5f2f613,0xb44cfe54,0x28a13040,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18810000,0x72e80000,0xfe11fe74,0xfd4ffd90,0xfdb1f52f,0xfe74fdd0,0x7aa7fe76,0x18800800,0x10000880,0xf6139b47,
-0xf674fe74,0x9c0dfeb7,0x21020000,0x10001880,0xfef6c571,0xfe94f653,0xcd51fed6,0x000049c4,0x18001021,0x59202800,0xab2692a5,0xbbcac3ea,0x48a079e3,0x28a059c2,0x00210000,0x000018c4,0xe6d87b8c,0xd656f75a,0x00000000,0x00200040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000881,0x08000000,0xd5b440a0,0x7b2aff3a,0x18200000,0xfeb6cd51,0xfe97fe55,0x0800a450,
-0x9c0e0800,0xde36ee97,0x00006ac8,0x18620000,0x00001862,0x83ac0800,0xa491c594,0x00000000,0xbcf24164,0xcd53d594,0x5247bd32,0x08000000,0xde15c552,0x08005a46,0x8bce0800,0x3141bd74,0x00000000,0xff198b4b,0x0000d656,0x7b0b0000,0xdd31d552,0xbcaeccef,0x000049c4,0x8c0e0000,0x834bc573,0x00000000,0x7bad0000,0x100041a6,0xa46f6226,0x51c593cd,0x08000000,0xb46f7288,
-0xbcafc4cf,0x49c5a48f,0x49c60000,0xac6ede35,0x10001800,0x00000800,0x00000021,0x00000000,0x00000000,0x00000000,0x00000000,0x00001042,0xde563101,0xff39f6f8,0x1800e698,0x08000000,0x10001820,0x9b6a59a2,0xa329c44e,0x61a28246,0x28802000,0x20c30000,0x39650000,0xff5ae677,0xfed7ff19,0xfeb7fef7,0xcd94ff3a,0x20c30800,0x08000800,0xfef8d5d4,0xff18fed7,0x40c0e5f4,
-0x20c31800,0x9c8f0000,0xfed7ff39,0xfe55fe96,0xfe55fe96,0xfe33fe54,0xf696fe95,0x08007b09,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x10000840,0xfe95cd71,0xfeb5feb5,0xfe53fe53,0xfef7feb5,0x0800a46e,0x100028c2,0x49002000,0xfeb5dd71,
-0xfeb5feb5,0xe656fe96,0x00003143,0x000018c2,0xeeb66ac7,0xee97ff18,0x28a0bd32,0x10610000,0x20200841,0x92445040,0xe50dd44b,0xfe95fe12,0xcceff614,0x592092c6,0x00211000,0x10620001,0x62e90000,0xde78d677,0x00000000,0x00000040,0x00000000,0x00000000,0x00000000,0x00000000,0x10a20000,0x59e61000,0xff18ddd4,0x838af6b6,0x08000800,0xff38ddf5,0xff39ff18,0x1000bd54,
-0xacb11000,0xff39ff5a,0x5a68de97,0x10420000,0x00001021,0xf6f98bcd,0xe6b8ff7a,0x18003984,0xfef88329,0xff3aff19,0x9c0eff3a,0x00000000,0xf6f8b511,0x28a0cdd4,0x00000800,0x00000820,0x72c80800,0xfef8f697,0x0800c593,0xa46f0800,0xfe55fe97,0xfed7fe95,0x10008b8a,0xd6160800,0xf6d8ff5a,0x08007b4b,0x000018e2,0x51c50000,0xf6d7d5f4,0xa490fef9,0x00000000,0xfe96acae,
-0xfeb6f613,0x7b0aff19,0x41221000,0xfe95ee14,0x40a0cd10,0x10a10800,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00001042,0xd63630e1,0xf73aff5a,0x0800c594,0x20410800,0x8aa82000,0xf633dd71,0xee12fef6,0xb3cac44c,0x58e092c6,0x10002000,0x00001021,0xbd725267,0xff17eeb6,0xfed6f6b5,0x6a86ee96,0x21020000,0x942e0000,0xfeb7fef8,0xf696f6b6,0x82c6f675,
-0x18a30800,0x28e00020,0xff38e676,0xfed8ff18,0xfef8fed8,0xedf2fe95,0xfef8f654,0x00009c6f,0x08201882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000040,0x00000880,0xe6556a66,0xee54f6b6,0xf694ee53,0xc572f6b6,0x08400800,0x20610000,0x9b6b2000,0xfe74fe75,
-0xf654f632,0xff19f655,0x0000ad11,0x18a118a2,0x946e0000,0x39839c90,0x00000000,0x00011082,0x10000041,0xdcaf9b09,0xfe33f570,0xf654f613,0xfe96f675,0xac2df635,0x08420800,0x00000001,0x00001040,0x734b2060,0x00002104,0x00000041,0x00000000,0x00000000,0x00000000,0x00000000,0x08820061,0xde170800,0xf6d6ff39,0x72e8ee95,0x10200000,0xf719cdb4,0xf718eef7,0x0800bd74,
-0xb5121000,0xeed7f739,0x9470f71a,0x29450000,0x080020c3,0xff3ade37,0xeed7f6f7,0x10005205,0xf6b78328,0xeeb7f6f7,0x834afef8,0x00000800,0xeef8c5d3,0xc594eed8,0x20a30000,0x000020e3,0xe6767b2a,0xf675f676,0x1800cdb3,0xa46f0800,0xf675fed7,0xee75feb5,0x10008329,0xd5f51000,0xee96ee76,0x3124de58,0x29230000,0x942f0800,0xf717ff59,0xacb0ff19,0x00000000,0xf6b69c2c,
-0xee34f654,0x8b6bee56,0x39011000,0xedf3d591,0xc511f676,0x000020a0,0x00200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00001042,0xe6b84a07,0x8bedd656,0x00000000,0x10001062,0xd55161e4,0xfeb5fe34,0xf673ee32,0xe551fe54,0x9b29d4cf,0x10004922,0x08210801,0x00000000,0xc55162a7,0xf6f7eeb6,0x1000a46d,0x00002922,0xe6974a05,0xf6b7ff19,0xf6d7ff18,0xd5b3ff38,
-0x10411000,0x000018a1,0xeed77b49,0xf6b7f6d7,0xf696ee55,0xee33f654,0xd5f4fef7,0x00002060,0x00001041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18810000,0x20c10000,0xa46f1000,0xe696e6b7,0xf6d7e674,0x62a8e656,0x10e30000,0x08000020,0xe6353040,0xfed6ff17,
-0xfed6fed6,0xf675f654,0x7309e696,0x18a20000,0x00001060,0x00000000,0x084218c3,0x00010001,0x10001062,0xfe96a3ec,0xfed7fe96,0xf6b7f6d7,0xf696fed7,0xf6f9f6d7,0x00006aca,0x00001881,0x20a11040,0x00001000,0x00220000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x10c20020,0x9c2f0800,0xf738eef7,0x6ae8f739,0x08000000,0xffbcd657,0xff7af739,0x0800b553,
-0xb5120800,0xf75af75a,0x0800a490,0x000018a1,0x08000000,0xde1672c9,0xde55eed7,0x08003941,0xf6f87b29,0xf6f7f6f8,0x8b4afef8,0x08000800,0xff7ace14,0xc594f719,0x000020a1,0x000028e3,0xf6d8940d,0xfef7f696,0x0800d5f5,0xacf10000,0xf6d6ff18,0xf6f8ff17,0x10008b8c,0xd6161000,0xef19f73a,0x08009450,0x08002040,0x18801020,0xef18bd93,0xb533ff3a,0x00000000,0xff3ab531,
-0xf6f8f6f8,0x8bcdff3a,0x18800800,0xf719d636,0xde37ff3a,0x000020e2,0x00000840,0x00000000,0x00000001,0x00000000,0x00000000,0x00010801,0x83ee4207,0x00000800,0x00200020,0x080020e4,0xf6b69c0d,0xfe95fe95,0xf675f675,0xfeb7fed7,0xc511f696,0x10003040,0x00000021,0x18e108a1,0x08000000,0xbdb49c8f,0x00000800,0x000018c2,0xff3acdd5,0xff19ff19,0xf6f8f719,0xfef8ff19,
-0x10007ae9,0x108118a2,0xacf10800,0xf6b6ff19,0xfeb6f6b6,0xfef8fed7,0x836bff19,0x20a20800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x08000000,0x10201860,0x18400800,0x52855287,0x7b496ac6,0x080049c4,0x00001081,0x000010a2,0xc5936267,0xd5d3d5f4,
-0xde14d5d3,0xf674f675,0xd5f4f6b6,0x00001840,0x20611020,0x182030e3,0x08000800,0x00000821,0x080020e4,0xff59bcf0,0xfef8fef8,0xff39ff19,0xff18fef8,0xf719ff18,0x100093ee,0x10201860,0x10000000,0x20812060,0x00010021,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08200040,0x10001000,0xce5583cb,0x4a26bdb4,0x00000000,0xc5b49c70,0xbd53bd52,0x00006aea,
-0xacf20800,0xb511f73a,0x18001000,0x942f1840,0x10007b4b,0x72e91000,0xe697f718,0x08001820,0xcdd46287,0xcdd3d615,0x5a25bd31,0x00001000,0xbd937bac,0x3901bd73,0x18200800,0x10000800,0x940d0800,0xde56de14,0x0800acf1,0x7bad0000,0xd5f3de55,0xde56e696,0x10007b2c,0xde781000,0x8c2ef75b,0x10000800,0x41422000,0x08001000,0xb5930000,0xb533ff9c,0x00000000,0xf71aa4b1,
-0xf77beef9,0x732aeef9,0x00000000,0xdeb9ad74,0x7b6dde78,0x18c20000,0x00000000,0x00010021,0x00010001,0x00000000,0x00000000,0x00000000,0x00000800,0x20e11840,0x00000020,0x000020e3,0xff18a44d,0xfed6fed7,0xfef8fef8,0xfef8ff19,0xe636ff39,0x10202000,0x00200041,0x18601060,0x000020c2,0x00000000,0x21040000,0x942f0000,0xff3aff3a,0xf6f8ff19,0xff7aff5a,0xff3af6f8,
-0x2000d5f5,0x18c30820,0x29010000,0xf6d7de56,0xf6b6e654,0xff19ff39,0x0800c593,0x08211881,0x08000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000000,0x6a484966,0x20601800,0x00200000,0x00000000,0x00000000,0x10200800,0x00000000,0x08200000,0x08000000,0x08000800,
-0x6a660800,0xfed6f696,0xeef7fef6,0x000062ea,0x30202881,0x51004040,0x40805900,0x00000800,0x00000080,0xfed7a42d,0xff19fed7,0xfed8ff19,0xfef7fef8,0xfef8fef7,0x000083ad,0x08001881,0x20603985,0x30e21000,0x00001042,0x00000021,0x00000000,0x00000000,0x00000000,0x00000020,0x7b4c3122,0x08004144,0x00400000,0x00000000,0x08200841,0x18001000,0x10001800,0x29660000,
-0xb5740000,0x1000e6b8,0x20002020,0xff199bed,0x7ac7f677,0x00001000,0xef1ac5d5,0x102028c1,0x00001040,0x00000800,0x00000000,0x08010801,0x00000000,0x08000000,0xc5106203,0x38e1cd53,0x00000800,0x08000000,0x08200000,0x00000820,0x31001840,0x28a15206,0x28c21000,0xce570000,0x08008c2f,0x30402020,0xf697cd52,0x10008b4b,0x00001020,0xc595cdd6,0x10a20000,0x62ca3124,
-0x62c86ae9,0x290362a9,0x00200000,0x00200000,0x00000000,0x00000000,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20201000,0x18002000,0x08200800,0x08001881,0xfed6a42d,0xfeb6feb6,0xfed7fed7,0xfed8fed8,0xddd4ff19,0x20812840,0x10400000,0x18001000,0x18202000,0x000020a2,0x00001062,0xe6b85226,0xfef8fed8,0xff39fef8,0xde76f6f8,0xe698de77,
-0x5a68de57,0x08410000,0x00001081,0xe696944e,0xe695eed6,0xde56eeb7,0x00003101,0x002118c3,0x10200800,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08210000,0x18000000,0xc4f340a2,0x10008b8c,0x104020c1,0x10411881,0x20c21861,0x00000841,0x10000800,0x18611861,0x20a21840,0x28e320a2,
-0x08003124,0xf6d6ac8f,0xb510eed6,0x20820000,0x59003020,0xabaa92a7,0xcd31d4cf,0x000049a3,0x000018e1,0xee55ac6e,0xfeb7ee55,0xf697f6b7,0xfed7fed7,0xf6b7f675,0x00007b8c,0x00002965,0xde57a491,0x10008bac,0x00210000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200040,0xd5d61800,0x1000d5d6,0x000010c1,0x00010000,0x18200820,0x38402820,0x28004081,0x00000800,
-0xc5d60000,0x0800ce16,0x832b0800,0xf676ee77,0xd5b3ee55,0x00003984,0xe6b9a4d1,0x10006288,0x18000800,0x08001800,0x00000000,0x00001042,0x00000000,0x00002946,0xfed6bccf,0xcd73f6b7,0x00000800,0x08000000,0x10400000,0x00000820,0x10001000,0x10001000,0x08001000,0xc5f50000,0x00005268,0xc55338e1,0xfed8f697,0x9bedf697,0x00001040,0xb513acd2,0x20a20000,0x00000000,
-0x08000800,0x00000000,0x10810000,0x00210021,0x00000842,0x736c41a6,0x000018c0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x51821000,0x93ab7266,0x00005a06,0x000020c2,0xee758b8a,0xf654fe75,0xf696f634,0xf696feb7,0xe615fef8,0x18003040,0x00001861,0x9bccac6f,0x280040c0,0x10002000,0x10202904,0xff1aa490,0xfed7ee96,0xde56f6f8,0x080072e8,0x08001000,
-0x10001000,0x10201800,0x10800000,0x41c30000,0x41a24181,0x20403940,0x28e31000,0x00000000,0x206120c2,0x00001840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28600800,0xe5d63820,0x59a3f698,0x28002000,0x08001000,0x00000820,0x08400000,0x20002060,0x18001800,0x18002000,0x10000800,
-0x08001000,0xde783122,0x20c0d677,0x28600000,0x9ac76142,0xedd3c44d,0xf676feb7,0x00006aa8,0x080020a0,0xff3aacb0,0xfeb7f6b7,0xfed8ff19,0xf697f6b7,0xf6d8fef8,0x00005248,0x002010e4,0xff3aacf2,0xc553f6d8,0x00001020,0x00000841,0x00000000,0x00000000,0x00000000,0x10200840,0xd5f51800,0x6aa7f6f9,0x52670000,0x41649c90,0x62271000,0xd594c533,0xcd93ddd5,0xc594c553,
-0xef3ace16,0x0800ce16,0xa4501000,0xff18ff7b,0xe676ff59,0x10003943,0xff398bac,0xbd31e697,0xb48fbccf,0xcd52bccf,0x5a47bd11,0x18800000,0x6aea7b8c,0x00000000,0xf6d5c571,0xfef8f6b6,0x9becc531,0x8bab9c2c,0x00005267,0x41820000,0x69c27ac7,0x40a061a2,0x4a024160,0xe6d8ad0f,0x08005227,0xeef86287,0xf6d7eed7,0xee56fef7,0x00004184,0xe657acd1,0x10004163,0x20001000,
-0x10001800,0x10000000,0x08001000,0x08001000,0x08001040,0xbd74730b,0x00000000,0x00000861,0x08000000,0x00000000,0x00000000,0x00000860,0xbcaf38e0,0xe5d4e5d3,0x0800832a,0x00002924,0xf6d7acd0,0xfeb6f6b6,0xf696fe96,0xf6f7f6d6,0xe615ff18,0x18003860,0x000020c3,0xfed8de36,0x9329cd11,0x28005100,0x00002060,0xee976aa8,0xff19fed8,0x7b4bf71a,0x28c10800,0x18001000,
-0x28002000,0x18003021,0x08400800,0x00000800,0x00000000,0x00000820,0x10002881,0x9c703922,0x204130e3,0x00001820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28601040,0xd5324020,0xee55fed8,0xbcafcd10,0x5227b4f1,0x08400800,0x10400820,0x8b0851a2,0xa3aba3aa,0x7aa89329,0x08004142,
-0x10411040,0x7bee0000,0x08005a89,0x38a02081,0xa2c58203,0xfef7f613,0xfeb7fe75,0x00006ae9,0x100020c1,0xd6375a47,0xff3aff5a,0xfef8ff19,0xff3aff1a,0x940dee97,0x08620000,0x000010c4,0xff39c573,0xeed8fef8,0x08403943,0x00000040,0x00000000,0x00000000,0x00000000,0x08000020,0xde362020,0x72c7f6f8,0x9c4e1000,0x7b09eef9,0x7ac91800,0xfef8fef9,0xff39f6d7,0xcd94f6d9,
-0xb553b532,0x00007bad,0x7b2b0800,0xde56d636,0x9c2dde14,0x00000800,0x9c4e51e5,0xd5d4a46e,0xfef8ff39,0xff19ff18,0xa44fff1a,0x52050800,0xcdb4f6f8,0x08000000,0xe674c571,0xfed7ee75,0xff39ff39,0xff7aff39,0x0000b553,0x9c6f0000,0xfe96ee96,0xddd3f655,0xc5f4de96,0xacf1ce14,0x00002902,0xacf14183,0xd635ce15,0xc572de35,0x00000800,0xde577b2b,0xd636cdd5,0xcd73de15,
-0xcdd5cd73,0x00009c91,0x10001020,0xb4f2b4f2,0x00000800,0xbd54730b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000008a2,0xf69772e9,0xfeb8fed7,0x0800832a,0x00002123,0xf7199c6f,0xfef7ff39,0xff17fed7,0xeeb5fef6,0xee77ff59,0x100038c2,0x10002083,0xff38de15,0xf614fef7,0x3800a308,0x18812000,0x9c4f1000,0xff3aff1a,0x0000a490,0x08003144,0x49642860,
-0x598440a1,0x6a065963,0x000051c5,0x08411060,0x000010a3,0x20200000,0x51212820,0xde56cd94,0x18203080,0x08002061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x28400000,0xdd524840,0xf6b6fef8,0xf696fed6,0x6ac9eed8,0x20610800,0x20002061,0xdd109309,0xfe74f613,0xee14f633,0x4182de15,
-0x08610000,0x00000042,0x20400000,0x40602861,0xdc8c9aa5,0xfe74f612,0xee76fe75,0x00006288,0x086010a0,0x18830000,0xc5b49430,0xf6d7ee97,0xb573d635,0x000062a8,0x00211061,0x000010a2,0xfef7c551,0xde14fef7,0x00003963,0x00000860,0x00000000,0x00000000,0x00000000,0x08000820,0xd6570800,0x28a0d656,0x834b1000,0x93cbeeb7,0x62670800,0xee75e635,0xde34ee96,0x08006ae8,
-0x08000800,0x00000000,0x00001060,0x10001000,0x18001800,0x08620000,0x00000000,0x08000000,0xf6d8acd0,0xfef9fef9,0x834beeb9,0x6a251800,0xe614f695,0x08001800,0xff38b510,0xfef9f6b7,0xa4d0de56,0x9cd1a511,0x08205aeb,0xbd530800,0xfed7ff19,0xf6f8f6b7,0x18a09c6e,0x00000000,0x00000000,0x00000000,0x08000800,0x00000800,0x08810000,0x00000000,0xa4b020e1,0xf6d7f6f8,
-0xff39f6b7,0x20c0d677,0x08000800,0xe637d5b4,0x000028e1,0xc595730a,0x08210000,0x00000841,0x00000000,0x00000000,0x00000000,0x000008c2,0xeed86ae9,0xff19f6b7,0x00007b2b,0x00202104,0x83ac0000,0xf6d7cd93,0xee74f675,0xfef7fed5,0x940dde34,0x08011020,0x18002082,0xf654cd50,0xfe96f634,0x8a65fdd3,0x18a21000,0x00000040,0xc594c594,0x08800800,0x18600000,0xc4f0acaf,
-0xbc8fbc8f,0xac2dbc8e,0x200059a3,0x08610800,0x6aea0000,0xb48ebcf1,0xee55c4f0,0xe636ff39,0x202038a1,0x08002061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x30a01040,0xdd534020,0xee75fef8,0xff18ee75,0x0800a4af,0x20202881,0x61641800,0xfeb6ccaf,0xedd1fe54,0xf654fe94,0xa44dee54,
-0x10a20000,0x08620021,0x20001861,0x69622000,0xfe12cc4c,0xfe95f612,0xfef8feb6,0x0000a46e,0x18e20000,0x00000842,0x08000000,0x8bec7b09,0x00002900,0x18e20000,0x28c20820,0x10000800,0xfef6d592,0xe655feb6,0x00003921,0x00000040,0x00000000,0x00000000,0x00000000,0x00000020,0x7bad0000,0x08005aa8,0x936b2800,0xc571f6b7,0x20400800,0xe655834a,0x8369e676,0x08000800,
-0x39024142,0x10600000,0x10200000,0x5a053921,0x282061e5,0x00010800,0x10200000,0x10002080,0x940d0800,0xe678de57,0x1000838d,0x82c82000,0xee33f695,0x10002820,0xc5b45204,0xcdb4f73a,0x10205a46,0x00000800,0x10000800,0x838c0800,0xff19e697,0x836ae656,0x00000800,0x08000000,0x08420000,0x00000000,0x00000000,0x00000000,0x00200040,0x00000000,0x10001000,0xe676940c,
-0xf6f9ff5a,0x0800acf1,0x10000800,0xe636ee57,0x00000800,0x83ce5227,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000010c3,0xf73a7bac,0xff39ff7a,0x10008b6b,0x08002020,0x00001060,0xb4d030c0,0xf6d7e676,0xb4aee634,0x100051e3,0x29040820,0x7ac81000,0xfe74f675,0xfe13fe54,0xbbcafdd2,0x18203820,0x000010c2,0x39423101,0x18e10000,0xbd520000,0xff38ff38,
-0xff18ff18,0xfed7ff59,0x28009b29,0x18a12040,0x732a0000,0xfed6fef8,0xfed6ff17,0xee76f6b6,0x20205184,0x00001820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x38a01860,0xd4f14020,0xee96fed8,0xd634ff18,0x00000000,0x20002061,0x92e93000,0xfef7f615,0xfe96feb6,0xedf2f654,0xee55fe95,
-0x00005205,0x08210862,0x10000800,0xa3494880,0xfe94e591,0xf654fe75,0xfef7fed6,0xaccff6f7,0x00004a05,0x08821081,0x20c118a2,0x08000800,0x19030000,0x004000c1,0x10001040,0xbc4d7225,0xe5b1e5d2,0xd592e591,0x000051c5,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000862,0x28001000,0xd5515100,0xeeb7fef8,0x0800838c,0x51e70800,0x100051e6,0x6a251800,
-0xde15d5b3,0x0000732a,0x62670000,0xc4afbcaf,0x8b49ccef,0x08001000,0xb4f228c1,0x40c0b4d0,0x00001000,0x4a284a07,0x10000000,0xdd935942,0xfeb6f675,0x1800b4af,0x00000800,0x28e17bcd,0x20000800,0x722469e3,0x61c47a66,0x10002000,0xc5d56ae9,0x08006aea,0x62871000,0xac90b4f1,0x00003103,0x9c2f2081,0xb4d0bcf2,0x730ab4d0,0x00000000,0xa4703964,0x180072a7,0x4a271000,
-0xa4d1ce17,0x10200000,0xacd10800,0xddf5fed9,0x10201800,0x00000000,0x00000862,0x00000800,0x00000000,0x00000000,0x00000000,0x000018c3,0xf6f88bed,0xf695fef7,0x6962b42d,0x38007183,0x20e11800,0x08000000,0x83ad6aca,0x00004183,0x18800000,0x18000800,0xe6146a05,0xf654f675,0xe570ee12,0xe550ed90,0x30008a65,0x08a10840,0x08000800,0x00002103,0xf6967b29,0xfeb5feb6,
-0xfe54fe94,0xfe95fe74,0x6940e571,0x18602840,0x31420000,0xfef6de34,0xfed5fed5,0xee56fef7,0x28205163,0x08001820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x38e20800,0xccd14020,0xff18ff39,0x9c4dff17,0x21030000,0x18001000,0xb42d4040,0xf696fed7,0xfef8fef8,0xf675f6b6,0xf6b6fe95,
-0x00009c4e,0x00002104,0x20201041,0xd4d050a0,0xfeb5fef7,0xfeb6fed6,0xfed6fef7,0xff38f695,0x944fe697,0x08400000,0x08000020,0x186120a2,0x00000841,0x00000081,0xa42d1000,0xfed7ee35,0xfeb5fe54,0xf6b7feb6,0x0000838c,0x00001061,0x00000000,0x00000000,0x00000000,0x00200000,0x21040001,0x59a30800,0xfef7dd92,0xff19fef7,0x7b4ceef9,0x00000000,0x08000000,0xf6967ac8,
-0xff18fef7,0x0800a48f,0x8bac0800,0xfeb6feb7,0xe5f4fef7,0x08001800,0xe6574963,0xddd3ff18,0x08004983,0x00000000,0x100018c2,0xfeb7d594,0xf675ee13,0xa40dff39,0x10a10800,0x00000000,0xb4cf1000,0xfe55ee34,0xe5f4f614,0x10008b4b,0x00000000,0x00000000,0xeeb8838c,0xf6b7ff19,0x000062a8,0xe69849c5,0xf6b7ff3a,0xcdd5ff5a,0x08000000,0xff5b940e,0x8b4aee97,0x00000800,
-0x00000000,0x08000800,0xf719bd53,0xf6b7fef8,0x1800a42e,0x08620820,0x00210000,0x00000800,0x00000000,0x00000000,0x00000000,0x000018a3,0xff3ab553,0xfeb6fef7,0xedb4feb7,0x50c0b38c,0x08401000,0x18830841,0x00000000,0x18c10000,0x08200860,0xb4d130e2,0xff39fef9,0xfed7fef8,0xfe95feb6,0xfeb6fe75,0x5900edb3,0x00401880,0x20831021,0x4a060000,0xe614d5b4,0xf634ee14,
-0xf633edd1,0xf613f633,0xb3ecfe96,0x18602820,0x000020e3,0xf6d6b531,0xf695f695,0xf6b7f6b6,0x20006206,0x08002040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x38a10000,0xd5324820,0xfed7ff19,0xb4f1ff59,0x10a30000,0x10001063,0xe6372820,0xf6d8ff7b,0xf6f8f6f9,0xfef9fed8,0xf697fed8,
-0x4a06de56,0x08610000,0x10001041,0xe5f53840,0xfed7fed7,0xfe96fe76,0xfeb6feb6,0xf6b6fed7,0xf73af6f8,0x0000ad12,0x000018a2,0x08000000,0x10410800,0x4a270000,0xff19de36,0xfed6ff18,0xfed6fef7,0xfef8fef7,0x00006ae9,0x000018e2,0x00000000,0x00000000,0x00000000,0x00000000,0x10810841,0xc5730000,0xf695ff38,0xf6b6feb6,0xd616ff19,0x18a12902,0x08001061,0xf6b6cd93,
-0xee34ee14,0x1000bd11,0x9bed0800,0xfe75feb7,0xe615feb7,0x10006246,0xee566206,0xfed7fed7,0x3903d5d5,0x29240800,0xb5120000,0xfeb7ff3a,0xee33edf2,0xff19ee55,0x00009c70,0x00002965,0xff39838b,0xf634f675,0xfeb6fe95,0x7b2ae635,0x29020000,0x52270000,0xf6f8e698,0xeeb7fef7,0x00006ac9,0xe6d862c8,0xf6d8f6f8,0xd616ff3a,0x00000000,0xff5bb533,0xf6d8ff19,0x08007b2b,
-0x08402102,0xc5d43162,0xff18f719,0xfef8fed7,0xac6fff19,0x18a20800,0x00000041,0x00000000,0x00000000,0x00000000,0x00000000,0x00001082,0xf71aa491,0xff5aff19,0xfefaff1a,0xc554fed9,0x000049c6,0x08011041,0x210418c3,0x10810841,0x7b8d0000,0xffbee6da,0xff3aff9d,0xff39ff9b,0xff39ff3a,0xff3afef9,0xcd54ff3a,0x00001840,0x08411081,0xc5d70000,0xff19ff7c,0xfef8ff3a,
-0xee14fe96,0xf696e613,0xee15fef8,0x00006247,0x000018c3,0xeeb77b4a,0xfed7fed7,0xf6b7fef7,0x180061e5,0x000028c2,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x28800820,0xdd534840,0xee54fe96,0xe677fef8,0x000028e2,0x18830863,0xb4f20800,0xff5bff5b,0xff5aff5a,0xff3aff3a,0xff5aff19,
-0x3162de57,0x08600000,0x20810000,0xbcf21000,0xf6b7f6b8,0xfe76fe96,0xfe96fe76,0xf6b7fed7,0xde35ff18,0x000083ad,0x18211020,0x18611841,0x10411000,0x39640000,0xeed9bd73,0xee75f6f8,0xf695ee75,0xde14f6b6,0x00003122,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x08400820,0x838b0800,0xf6b6e655,0xf6b7ee96,0x6287cdd4,0x080028c0,0x10201060,0xddf46287,
-0xfef8fef8,0x1000d615,0xacf10800,0xf676fef9,0xff19f696,0x1000730a,0xe6366a87,0xfed8f696,0x51e6d5f6,0x28c10800,0x7b6b0000,0xfed8de15,0xf6d6f6b6,0xeeb8ff39,0x08009c2f,0x080028e3,0xbd5251e5,0xf6b6f6d8,0xf675f675,0xacf1f6f8,0x20800800,0x20602081,0xf6f9b4f1,0xf6f9f6f8,0x00007b8c,0xe6d862c8,0xf719ff39,0xe6b9ff3a,0x00003144,0xf73a8c2f,0xff3aeed8,0x0800bd53,
-0x10802923,0xc5d42101,0xff39f6f8,0xee55fef7,0xfefaf6b8,0x000083ce,0x000018a3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000840,0xde570000,0xfef9ff3a,0xff5cff3a,0xc5d6ff5c,0x000041c6,0x00001021,0x186120c2,0x10001020,0x5a890800,0xef1bad13,0xf73af73b,0xff39f6f9,0xfef9ff19,0xff1afef9,0xcd95ff5c,0x10810000,0x00001081,0xb5540000,0xff19ff5b,0xfef8ff3a,
-0xf676fe97,0xfed7fef8,0xee98ff39,0x000051c6,0x002008a2,0xe6763962,0xff18fef8,0xff19ff18,0x1800834b,0x00001840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x28600000,0xd5113800,0xfeb5fe95,0xff19f6b6,0x00009c6f,0x10a218e4,0x18200000,0xff9cde78,0xff3aff5a,0xff3aff3a,0xff7bff3a,
-0x0000942e,0x00201902,0x10620020,0x08000000,0xff39de56,0xfef7fed7,0xfed8fed7,0xff1afed9,0x4162bd73,0x18410800,0x28831000,0x08001800,0x20c31861,0x00001041,0x6aea0000,0xff7ac5b5,0xf6d7ff59,0xe676ff38,0x00203163,0x00000020,0x00000000,0x00000000,0x00000000,0x08000000,0x08001862,0x00000000,0xa46f6287,0x9c4f9c70,0x18001000,0x30401800,0x000030e1,0x5a690800,
-0xe677d5f6,0x0800b553,0xa5110000,0xf6f8f739,0xeef8f718,0x08206b2a,0xcdd54163,0xb4f1f6f9,0x10002000,0x18400800,0x08200000,0xc5b46288,0xbd93bdb3,0x732ace16,0x18200800,0x10001000,0x10001000,0xff3ad5d6,0xff7aff39,0x0800bd73,0x10001820,0x18000800,0x9c6f0800,0xf73aeef9,0x0000734b,0xd6363962,0xf6d8ff39,0xe677ff39,0x00003122,0xf77c736c,0xbdb5f75c,0x186128c2,
-0x00000000,0x08001061,0xff5aa4b0,0xeed7ff7a,0xcdd5f6f8,0x00003984,0x00420862,0x00000000,0x00000000,0x00000000,0x00000000,0x00000840,0xcdf60800,0xf6d9f73a,0xd637f71a,0x0020738c,0x08200000,0x18a018a1,0x10000800,0x38a05163,0x08002020,0x42060000,0xeed8b552,0xfeb6f6d7,0xfed6f695,0xf676fe96,0x2000ddd5,0x08820000,0x08400000,0x00000000,0xf6f7d614,0xee75ddd2,
-0xff5aff18,0xff5aff39,0x8bedf73a,0x18820000,0x00000880,0xeed849c3,0xf697ff3a,0xff39fed7,0x10008b4b,0x00001820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30e20021,0xccf03000,0xf675fed7,0xf6d7f695,0x2902de77,0x08400000,0x000020e2,0xff3b940f,0xff3af71a,0xf719ff3a,0xd657ff7b,
-0x00000000,0x08800880,0x00000861,0x00002104,0xeed883ac,0xfed7f696,0xff19f696,0x942fe698,0x00000000,0x306130e3,0x282038a2,0x5a263881,0x00001800,0x18a220a2,0x00002103,0x9c900000,0xf6d7e697,0xde56f6d8,0x00000000,0x00000841,0x00000000,0x00000000,0x00000000,0x10610000,0x9c501000,0x08009c51,0x00000800,0x00000000,0x18001820,0xd5d459e4,0x732bde37,0x00000000,
-0x49e530e2,0x00003983,0x31840000,0x62c762c7,0x5aa762e7,0x000031a4,0x5a481000,0x08006288,0x20401000,0xcdd5a490,0x00005247,0x00000000,0x00000000,0x10000800,0x28800800,0xbd13c553,0x10002001,0xde572840,0xb573ff7b,0x08000000,0xbd531820,0x18009c2f,0x08002080,0x9c908bcd,0x08203985,0x7b4b20a0,0xa42d9c2d,0x93eda46f,0x08000800,0x8c5139a6,0x18818c50,0x00000800,
-0x94307b8e,0x00000000,0xa4b10800,0xc594cdf5,0x49c5bd73,0x08000800,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000840,0xde780800,0xff3aff5b,0x0000b533,0x08600000,0x10401040,0x08000000,0xac4f8b8c,0x40405962,0x288040e1,0x00002102,0x8beb0000,0xfeb6f6b6,0xf675ee54,0xf697f655,0x0800832b,0x002018e3,0x000010a1,0x000018a2,0xeeb66ae8,0xff18f6d7,
-0xf719ff19,0xff7bf73a,0x0000b593,0x10411881,0x00001902,0xff3abd73,0xfef9f6b8,0xf6f9ff5a,0x10005a06,0x00002061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18600000,0xd5733020,0xf6f7ff5a,0xf718fef8,0xa4f2f75b,0x18c10000,0x08201080,0xd6160800,0xff5aff7c,0xf75af73a,0x6b0ae6f9,
-0x20e30000,0x00000020,0x10810000,0x08600000,0xcdb41000,0xf6d6ff18,0xde56ff18,0x00005206,0x28a118a1,0x48a03080,0x93094840,0xf6b7d552,0x6225cd52,0x08001000,0x18811881,0x10001040,0xde354982,0xd5f5f6f8,0x08810000,0x00000821,0x00000000,0x00000000,0x00000000,0x18a10020,0xcdb51800,0xb513ff7c,0x7b4b7b2b,0x290462ca,0x5a680800,0xff7be698,0xf73bff7b,0x10008bee,
-0x08000800,0x00000000,0x00000860,0x08000800,0x00000000,0x08400000,0x08000800,0x08000000,0xc5743923,0xff5bff3a,0x7b6cde78,0x20c10800,0x08000000,0x10001000,0xd5f538e1,0xff3aff5b,0x0800a491,0xbd741000,0x5287ffbd,0x31430000,0xeed7c572,0xa48feed8,0x08000800,0x08001000,0x00000000,0x08000800,0x10001000,0x08001000,0x00201040,0x00000000,0x00000800,0x83cd0800,
-0xff7ceefa,0x1000a491,0x00001881,0x08000800,0x00000000,0x6aea0800,0x08003123,0x00000801,0x00000000,0x00000000,0x00000000,0x00000841,0xde980800,0xeed8ff3a,0x080049a3,0x108118c1,0x28400800,0xc5947b2a,0xff3af71a,0x9bccddf5,0x200048a0,0x20c12020,0x000020e1,0xff5aacb0,0xf718ff18,0xc573ff3a,0x10c10000,0x00a00000,0x18800000,0x18a20820,0xb5730000,0xff3bffbc,
-0xffbbff7b,0xdeb8ffbc,0x000031a5,0x10611862,0x738b0000,0xf73aef3a,0xff7cff7b,0xeed9ff7b,0x100051c6,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0xb4d12840,0xbd51c593,0xb511b4f1,0x8c2facf2,0x00200000,0x18a00040,0x6aca0000,0xa490acb1,0xa4d1a4d0,0x000083ad,
-0x10421862,0x52680000,0x000062a9,0x10a11081,0x83ac0000,0xf6f7f718,0xbd52ff39,0x29640000,0x39230820,0x8ac748e0,0xfeb7dd51,0xfed7ff18,0xf6b7ff19,0x1820a44e,0x10610000,0x30e21020,0xc5931000,0xd5f5ff3a,0x00210000,0x00000000,0x00000000,0x00000000,0x00000000,0x10800020,0xbd122860,0xffbdff9c,0xff9dffbd,0x4a28e71b,0x7bae0000,0xff9cff9c,0xffbdff9c,0xacf2ff7c,
-0x944f83ad,0x084083ee,0x41c60000,0x838d7b4c,0x6b2b7b4c,0x00003985,0x5a680000,0x62c96aeb,0xffbcd637,0xff3aff7b,0xcdf6ff9d,0x00000000,0xacf26b0b,0xbd32bd53,0xff1ade37,0xff1af6f8,0x0800cdd5,0xa4b00800,0x736cf79c,0x7b6c0000,0xeeb7ff7b,0xff7beed7,0x3122bd73,0x30e430e3,0x00000800,0x30e31001,0x498338e2,0x394451e6,0x00000000,0x41c620e2,0x28803964,0xeef99c6f,
-0xf71af719,0x8bcef75b,0x29040000,0x10011822,0x08001000,0xd637b512,0x00003102,0x00001021,0x00000000,0x00000000,0x00000000,0x00000841,0xde983122,0xe6b7f73a,0x08005a26,0x000018c2,0xd5d56248,0xffbcff3b,0xff5bff5b,0xff3aff3a,0x82e9dd93,0x000038e1,0x000020e3,0xff5b8bee,0xff5af73a,0x41a5eed9,0x10a20000,0x00000060,0x000039a4,0x10611040,0x52680000,0xacf3a4d2,
-0x948f9cd1,0x736cad53,0x18a30000,0x18410800,0x8c2f0000,0xc5f6bdb4,0xc5d5c5d6,0xe698eefa,0x100030a1,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x180028a2,0x08000800,0x08000800,0x08000800,0x00000820,0x00000020,0x00001061,0x00000800,0x00000000,0x18620800,
-0x20411000,0xcdb51000,0x0800de57,0x10610000,0x08000820,0xff39cdf4,0xb532f719,0x20e30000,0x10000821,0xf655ac4e,0xfeb6fed7,0xf6d8f6b7,0xfef8fef8,0xd5f6ff19,0x00005a89,0x18401860,0xc5b50800,0xd637ff5b,0x00000000,0x00000821,0x00000000,0x00000000,0x00000000,0x18a10040,0xc5732000,0xde78ff7c,0xd678d637,0x31c6c617,0x4a280000,0xe698cdd6,0xde78de57,0xd678deb8,
-0xf77cd637,0x3143ded9,0x94500000,0xff3bff5c,0xf75cf73b,0x00009451,0xc5d60800,0xf79cff9d,0xf75bf75b,0xf6f9ef19,0xb554f75b,0x00000000,0xdeb98c0f,0xff5aeef9,0xf6f9ff7b,0xff7aff19,0x0000ce36,0x94700000,0x6b0bef5c,0x5a281000,0xf719f71a,0xff7af719,0xeef8ff9b,0xd637eed9,0x0800730b,0xcdb64965,0xe657ee77,0xde58e678,0x08005a69,0xe6b88bed,0xee97eeb8,0xf6f9ff5a,
-0xf75aff5a,0x8c0fffbd,0x00000000,0xe6d9bd94,0xe6b7d676,0xde57ff5a,0x18202060,0x00001020,0x00000000,0x00000000,0x00000000,0x00000841,0xd6572902,0xeed8f75a,0x08005206,0x080020a3,0xff7aa490,0xff19ff39,0xf6d9fef9,0xff1afefa,0xf6d8ff3a,0x000072e9,0x000018c2,0xf73b83ee,0xf73bf75b,0x0800acf2,0x208228c3,0x7b8d0000,0x5a26de57,0x18410800,0x08001860,0x00000000,
-0x00000000,0x00000000,0x00001862,0x10001001,0x00001860,0x00000000,0x00000000,0xc5d6838d,0x080049a6,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18a118a1,0x30e420a3,0x20a230e4,0x10801860,0x00200860,0x10a40000,0x20a318a3,0x31243965,0x288228e3,
-0x100030e3,0xf6fa93ad,0x9c4ff6fa,0x18a30800,0x000018a2,0xbd736ac9,0xbdb4ff5b,0x20e40000,0x080018a3,0xff38ddf4,0xfed7fed7,0xff3aff3a,0xff19ff19,0xff9cfef8,0x0000b554,0x18812924,0xd6370000,0xcdf6ff9c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400020,0xcdb51800,0x0800c5d6,0x08000000,0x00400000,0x00000020,0x20600800,0x28e130e1,0x00000000,
-0xbd940800,0x28e1e6da,0xa4910000,0xf6faff7d,0xff7cff5c,0x0000a4f3,0xd65830c1,0x8c2fde99,0x6b0a738c,0x72e872e8,0x41c66ac8,0x00000000,0x49e62924,0x73095a26,0xf73acdd5,0xff5aeed8,0x0000c5f6,0x4a270800,0x31246b0b,0x28820800,0x83cd83ad,0xa4d0940e,0xd636b552,0xf75bde98,0x0800940f,0xeeda72ea,0xff19ff19,0xf71bff3b,0x0000838e,0xff9ba4b0,0xf6f9f6f9,0xde98de77,
-0xcdf6ce16,0x62eac5d6,0x18a10000,0xc5b49cb0,0xd615c5d4,0xd5f5f71a,0x08002040,0x00001060,0x00000000,0x00000000,0x00000000,0x00000020,0x52670000,0xef1ac5f5,0x08003964,0x000020a3,0xf7399c8f,0xff39ff19,0xff1aff3a,0xfef9fef9,0xff1aff19,0x00007b4b,0x00002123,0xf75b7bad,0x8beee6b9,0x10200000,0x08001801,0xde7949a6,0xd5d5ff9c,0x28612020,0x18402020,0x29242904,
-0x18e31903,0x20c218c2,0x10210000,0x18001821,0x20601820,0x28a330c3,0x086118c3,0x52480000,0x000030e3,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200021,0x10001840,0x08000800,0x00000800,0x08610000,0x00220000,0x00000022,0x10001000,0x18001800,
-0x38601800,0xff3aee56,0xe6d9ff3a,0x000020a1,0x18820021,0x08000800,0x8c2f9c90,0x18a20000,0x08001061,0xff17d5b3,0xfef8fef7,0xff3aff1a,0xfef8ff19,0xff3aff19,0x0000b553,0x00001881,0xc5f60000,0x4a06bd94,0x00010000,0x00000020,0x00000000,0x00000000,0x00000000,0x08000000,0x83ad1820,0x00003966,0x08000800,0x00000800,0x08001061,0x08000000,0x00000800,0x18e20000,
-0xa4d20000,0x3984f77c,0x52470000,0xff7cde78,0xde99ff7c,0x000041c5,0xde780800,0x00009470,0x08000800,0x18001000,0x08001800,0x08410841,0x08000800,0x08000800,0xb4d11800,0xcdb4e697,0x00003964,0x00000000,0x00000800,0x00000800,0x08000800,0x08000800,0x08000000,0xd6990000,0x080083cd,0xd65749e6,0xeeb7ff3a,0xde78f73a,0x00004a07,0xef1a9cb0,0x080072e9,0x00000000,
-0x00000800,0x00000000,0x08201041,0x08000000,0x10001000,0xc59493ee,0x08201860,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000060,0x6b4b0000,0x000039a6,0x000020e4,0xffbc942f,0xf71af73b,0xff5aff3a,0xff5aff7a,0xf6faff5b,0x08006a89,0x00002082,0x94716b0c,0x00000000,0x10211041,0x000020e4,0xff7c7b8e,0xff5bff7b,0x2000a42f,0x18002820,0x10001000,
-0x00200000,0x00000000,0x10210000,0x10001000,0x18001000,0x10001800,0x08610800,0x000010a2,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200000,0x41222040,0x5a266247,0x52265a26,0x000028e1,0x00420042,0x39c60000,0x940e8bee,0x9bed93ac,
-0xc5118b6a,0xf6d8ff19,0xa4d1f719,0x10620000,0x10420821,0x18801881,0x00000000,0x00001081,0x08001081,0xfef7cdb2,0xf6f8f6b7,0xf6b8f6fa,0xfe97f697,0xeed8f697,0x00009c90,0x000020e2,0x41e61081,0x00001000,0x00210020,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08001020,0x00001042,0xb4d26a89,0x5a68acb1,0x20c10000,0xa4b183ad,0xa4d2b513,0x18a1736d,
-0x9cb10000,0x942ff77b,0x08000800,0xde5849a5,0x3143ce17,0x08000000,0xeeda7b4c,0x080083ee,0x41a53124,0x622559e4,0x49856a88,0x00000000,0x72ea49c5,0x2080838c,0x51e60800,0x4162b4f1,0x00000000,0x5a885a68,0x00003163,0x08001061,0x18201820,0x10001800,0x20c11840,0xde990000,0x0000bdb4,0x41e60000,0xf77bce15,0x49e6ce36,0x00000000,0xdeb8ce16,0x00001000,0x00000000,
-0x08000800,0x00000800,0x08000820,0x20600000,0x18002000,0x41840800,0x00001881,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x18e30000,0x00001081,0x00000000,0x000018c4,0xf75b9c50,0xff5bff5b,0xff19ff3a,0xe635ee96,0xeeb8f6d8,0x10005a27,0x102128a2,0x00000000,0x21030020,0x10001841,0x18c30841,0xbd950000,0xff7bff9c,0x7a89ee79,0x492138c0,0x38a240a1,
-0x104028c2,0x00000000,0x00000821,0x49441820,0x51435163,0x40e25985,0x08002020,0x10a30000,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10001862,0xe67672a7,0xeed8eed8,0xeed8eeb8,0x6aeade98,0x18c30000,0x41c60000,0xff3ae6b9,0xff39ff18,
-0xf6f8fef8,0xf75af718,0x0840d656,0x10820000,0x08001822,0x18e20000,0x088110c1,0x00200000,0x00001081,0xff5ad615,0xff1aff5a,0xfef9fef9,0xfef8ff19,0xff9bfef8,0x00009cb1,0x00002103,0x00000020,0x18401840,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x08000000,0x20a20800,0x41420800,0xff5ae615,0x940eff5a,0x29020000,0xff7bde36,0xff7bff7b,0x0800d657,
-0xa4b10800,0xeefaff7b,0x08009c70,0x31241000,0x00003965,0x836c1000,0xff3bf6fa,0x000083ee,0xcdf63944,0xeeb8f719,0xacd1eed9,0x08000000,0xf6f8bd11,0xbd52f719,0x08000800,0x20800000,0x9c500800,0xeedaeeda,0x8c0fe6b9,0x5a890000,0xde55d615,0xd615de15,0x08008c0d,0xd6780800,0x944fffbc,0x00000000,0xad532942,0x00004a48,0xbd950000,0xde78ff7c,0x10002860,0xc5d58bee,
-0xc594c574,0x5a88c5b5,0x52270000,0xde77c5b5,0x4964d5d6,0x08000800,0x08000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x188118a1,0x00001021,0x000018c4,0xf6f8940d,0xf6f9eeb7,0xf6b7ff3a,0xf6d8ee76,0xeed8ff5a,0x08005206,0x00001861,0x18a20000,0x000018c1,0x10001000,0x18621000,0x4a070000,0xff5beefa,0xf6d9ff3b,0xe6b7eeb7,0xee99ee98,
-0x0000a491,0x108118c1,0x5aa90000,0xe6b8d658,0xf6b8ee98,0xc512f698,0x20203860,0x00000800,0x08210000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10200020,0x28201800,0xff7ad5d4,0xff5aff5a,0xff5aff5a,0xcdf6ff7b,0x10a10000,0x000018c2,0xff7bb512,0xf6f7ff5a,
-0xff19ff19,0xff7bff7a,0x000083ed,0x10202102,0x72cb1000,0x00003965,0x086018e2,0x00200000,0x00200882,0xff7bbd94,0xfef9ff1a,0xff1aff3a,0xff39fed8,0xf71aff5b,0x000083ef,0x000010a2,0x18820000,0x206020a1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08000000,0xc5b40800,0xf696fef8,0xa490eeb7,0x30e20000,0xf697d5d4,0xf6d8f676,0x0000de56,
-0x9c700800,0xff3aff5a,0x9c50f6fa,0x00000000,0x00000000,0xe698838d,0xf6faff1a,0x080083ad,0xee985206,0xff5aff7a,0xacf2ff3a,0x08000000,0xff18cd72,0xff7beed8,0x00009c91,0x00003164,0xff5c8bee,0xff5bff5b,0xa4d2ff9c,0x736b0000,0xff38ef19,0xff3af6f8,0x0000bd73,0xd6990000,0xef3aff9c,0x00009470,0x00000040,0x00000000,0xff7cb574,0xd616ff7b,0x10001800,0xff9cc594,
-0xff7bff7b,0x7b4cff7c,0x62c90000,0xff7bf73b,0xd5f6ff7b,0x00003944,0x00001862,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x314420c4,0x18200800,0x00001841,0x000010a3,0xeed8732a,0xff3aff7b,0xff3aff1a,0xff5aff5a,0xeed9ff9b,0x00005247,0x00001081,0x084018e2,0x52270000,0x8b8dbd54,0x18201000,0x000020e3,0xff3b9c70,0xff7bff3b,0xff7aff7a,0xf73bff7b,
-0x08007b4c,0x18c11881,0xb5950000,0xff3aff7c,0xff5aff1a,0xfeb8ff3a,0x2000934a,0x08212061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20600820,0x8b2b2000,0xff5aff1a,0xff5bff5a,0xff7bff5b,0xf73aff7b,0x0820732b,0x080018e2,0xeeb94984,0xff3aff7c,
-0xff3aff3a,0xce16f75a,0x18600000,0x10001881,0xf69a48e4,0x7bcdeeda,0x00000000,0x00000020,0x00000841,0xc5945228,0xff7bff5b,0xff5af73a,0xff7bff9b,0x7badde99,0x00201041,0x00000020,0x18211062,0x08000800,0x00001082,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18a20841,0xad530000,0xff5aff5a,0xacd1ff5b,0x18800000,0xff39d5f5,0xff39f6b7,0x0800e697,
-0xa4900800,0xf6f8ff19,0xd636ff5a,0x21030000,0x00001102,0xf71ad657,0xfef9f6d8,0x08007b6c,0xf6b959e5,0xff3aff5a,0xbd33ff5b,0x00000800,0xff5ac593,0xe6d9f73a,0x00006b2d,0x00001040,0xf73b7b4c,0xff3bff5c,0x942fff7c,0x5a880000,0xef19e6d9,0xff5bff3a,0x0800bd53,0xce580000,0xf73bff9c,0x62cbf75c,0x29640820,0xa4b20800,0xff3aff3b,0xc593ff3a,0x10000800,0xff3bacf2,
-0xf6f9f6d8,0x7b6cf73b,0x52480000,0xff5beefa,0xf75bff7b,0x0000734c,0x00000881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0xcdd641c6,0x2880acb1,0x20811000,0x08400000,0x5a890000,0xffbdce17,0xff3aff5b,0xff3aff39,0x6b2bcdf6,0x08410000,0x08200000,0x00000000,0xeefa942f,0xd616ff5c,0x202038a1,0x10611041,0xd6160800,0xff3aff7c,0xf6d8ff19,0xcdf6ff7b,
-0x10410800,0x00001081,0xeefa62ea,0xff1aff7b,0xf6f9ff1a,0xfef9ff3a,0x58c1e5b4,0x18211800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x20400820,0xd5b53000,0xff19ff5b,0xff5aff5a,0xff3aff3a,0xff7bff19,0x0000c5d5,0x20e21060,0xa4700800,0xff5bff5b,
-0xff3aff3a,0x6b2bf75b,0x28e20000,0x28601820,0xff7dc534,0xf77cffbd,0x4207b574,0x08420000,0x10210000,0x08000000,0xd6367b4b,0xf75bf71a,0x942fde98,0x00000000,0x00000820,0x10410000,0x18000800,0xa4b293ef,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0xeefaa4d1,0xa4b1ff7c,0x00000000,0xff5ace16,0xff5af719,0x1000d657,
-0x8bee0800,0xf719f719,0x3941de56,0x00000800,0x00000000,0xef196b2a,0xcdd4f6f8,0x08006aea,0xd5d549a4,0xe697ee97,0xacf2eeb9,0x00000000,0xf6f9c594,0x5a89de78,0x00000000,0x18603144,0x7b4c0800,0xff5cf73b,0x7b8cff9c,0x6b2b0000,0xffbcef3b,0xffbeff7c,0x0000c595,0xdeba0000,0xff9dffbd,0x3104c5b6,0x00000000,0x730c0000,0xff3be699,0xcdf5ff9c,0x00000000,0xff7bbd95,
-0xff5aff3a,0x83adf73b,0x5aa90000,0xff7cf71b,0x9470eefa,0x18a10000,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x00001082,0xeeda2061,0xde37ff9c,0x0800730a,0x000018a0,0x00000840,0x8c300000,0xff7be6da,0x8bedeef9,0x00000000,0x000008a2,0x00000861,0xcdf75248,0xff7cff7c,0xff5cff7c,0x1800ac70,0x18c220a2,0x734b0000,0xff5bf75b,0xf6d8f6f8,0x7b2bff3b,
-0x20e40000,0x00000000,0xff9cd658,0xff3aff1a,0xff5bff3b,0xff5bff3a,0xc4b1ff1a,0x18003060,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x080010a2,0xff1a8b6c,0xfef9ff19,0xff5aff19,0xff5aff19,0xf73aff5a,0x6b6cf77b,0x18c20000,0x18001040,0xff7bd615,
-0xff5bf719,0x0000ad33,0x208020c1,0x8b4b1000,0xff7cff1a,0xf79cff7c,0xb575fffe,0x18a40000,0x08000000,0x20a120a2,0x00000000,0x9cb1944f,0x00000000,0x10a20000,0x00000840,0x00001082,0xe657838d,0xe699ff7c,0x00000000,0x00000040,0x00000000,0x00000000,0x00000000,0x00000000,0x51e62881,0x00001000,0x94500800,0xa4d2f75c,0x20c10000,0x83ee630a,0x8c0e83ed,0x1862734d,
-0x52480000,0x944f83ed,0x000041e6,0x93ed1000,0x00007b6c,0x6b6b0000,0xa512ad53,0x00005a88,0x944f28c1,0x9c6f9c90,0x7b4ca491,0x00000000,0xde78ce17,0x08002880,0x72ea0800,0x8c10de9a,0x08000000,0xf77c940f,0x7b8cffbd,0x5ac90000,0xd677c636,0xde99ce37,0x00009c91,0xbdd60000,0xc5d6eefb,0x00000000,0x49e71800,0x00000000,0xde797b6d,0xa4f2deb9,0x00000800,0xde999491,
-0xde98de98,0x6b4be6f9,0x62c90000,0xff9def1b,0x00009471,0x00000800,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001081,0xe6ba3985,0xffbeff5c,0x0000b533,0x000020e1,0x20c40020,0x08001841,0xa4f34a08,0x00007b8d,0x21231060,0x00000841,0x000018c3,0xff9d8c0f,0xf75cff7c,0xff7cff5c,0x6a26f6b9,0x18820800,0x000018a1,0xff5bb533,0xff9bf739,0x0800c574,
-0x18c21881,0x9c900000,0xff3aff7b,0xff5bff3b,0xff5bff5b,0xff5bff3b,0xff19ff3a,0x00007b4b,0x000018a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x000018e3,0xff1aa450,0xff19f6d9,0xf6d7fef8,0xf6b6f6b7,0xf6f9f6f8,0x2943d657,0x10810000,0x18001020,0xff39d5d4,
-0xde98f71a,0x08002902,0x20601060,0xcd743040,0xff9cff7b,0xf75bff9c,0xbdb5ffdd,0x21050000,0x08000821,0x00000000,0x08402943,0x00000000,0x18a20000,0x000020e3,0x00000000,0x00002925,0xffbcbd12,0xde99ff7c,0x00003144,0x00000041,0x00000000,0x00000000,0x00000000,0x10200041,0xd5d62000,0x0800b533,0x28e30800,0xb554f73b,0x08000800,0x00000800,0x08000000,0x08000000,
-0x00001021,0x00000800,0x08000000,0xf6b89c0d,0x6aa8e677,0x00000000,0x00000000,0x10200000,0x00001000,0x10000000,0x10001000,0x00002082,0x9c70d638,0x10000800,0xf71a93ed,0xff5dff5c,0x000083ef,0xbd940800,0x7bcdff9d,0x29210000,0x08201880,0x20c20840,0x10200820,0x10400000,0x18203944,0x00001040,0xeefbb4f3,0x00007bce,0x39650000,0x00002923,0x08210000,0x08400820,
-0x29412101,0x290141c4,0x52470000,0xa4d2e6da,0x08200000,0x83cd3143,0x00003144,0x00001081,0x00000000,0x00000000,0x00000000,0x00000881,0xe6da5248,0xff7dff7d,0x0800acf2,0x086010a0,0x00000000,0x208220a2,0x00000000,0x10810000,0x000020e2,0x10410000,0x000010a3,0xff7d7bae,0xff7dff7d,0xff5bff7d,0xcd73ff9b,0x18202000,0x000020a1,0xdeb90800,0xf75aff7a,0x1000a46f,
-0x18c220c2,0xa4b10000,0xff3aff3a,0xff3aff1a,0xff3bff1a,0xf6b9ff1a,0xeef9f6f9,0x000062a8,0x00001081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0xd5f60800,0xff3aff3b,0xfef8ff19,0xf6b7fef8,0xeed9f6f8,0x0800732b,0x20a118a2,0x93cd1000,0xf6d8f6b8,
-0x83cdeef9,0x18810000,0x100020c1,0xfed98b2a,0xeeb8f6d9,0xff9cf73a,0xbd95ffdd,0x18c40000,0x10610000,0x00005269,0x18e30000,0x18c218e3,0x20403103,0x08000800,0x00002922,0x08001882,0xe657a46f,0xe699eed9,0x00000800,0x000010a2,0x00000000,0x00000000,0x00000000,0x18610841,0xe6373060,0x6b0bffde,0x39650800,0xde57ef1b,0x732a5a67,0x51c46267,0x392149a3,0x08001020,
-0x18600820,0x29020800,0x5a470000,0xfef8f6b7,0xe636fed8,0x08005185,0x00000800,0x10000800,0x18001000,0x28202840,0x20002000,0x39231000,0x9c70eefa,0x10200000,0xff3ade57,0xf6faff19,0x3123de78,0x942f0000,0x942fffbd,0x08001000,0x08000800,0x00000000,0x08400000,0x08001861,0x10000800,0xacf20000,0xf75cffbd,0x00008c2f,0x080028a3,0x00000000,0x08400820,0x00000000,
-0x00000000,0x00000000,0x62a80800,0x730beefa,0x08000800,0xd5f6bd12,0x18002840,0x00000000,0x00000000,0x00000000,0x00000000,0x00001081,0xf73b5227,0xffbdff5c,0x0000b533,0x00002103,0x39233103,0x18201000,0x18a220c2,0x00002124,0x5a680000,0x080041a6,0x00001862,0xf75c7b6d,0xff5cff5c,0xff7bff5b,0xff39ff9a,0x20008b0b,0x20c32041,0x8c4f0000,0xff5af75a,0x3880e636,
-0x18a30800,0x00000000,0xff3acdf5,0xf6d8fef8,0xf719f719,0xf6d9f6f9,0xa450ff1a,0x18c20000,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08610000,0x10a20001,0x6ac90800,0xff5bf73b,0xff19fef9,0xff19ff19,0xc5b5ff5a,0x18a20000,0x08001040,0xde572860,0xff5aff3a,
-0x0000b533,0x100020c2,0x18001840,0xff3addd5,0xff3af6d8,0xe6b8eed8,0xb554ff7b,0x20e40000,0x00000020,0xc5f7ce37,0x00005aaa,0x31030800,0x20201000,0xc5d5838c,0x0000736c,0x00002904,0xff3ab4f1,0xde58ff7b,0x08200800,0x00000000,0x00000000,0x00000000,0x00000000,0x10410041,0xcd952000,0x6b2cef1b,0x08200000,0xffbcd678,0xf75bf73b,0xee98f71a,0xe6b8e677,0x0000bdb5,
-0x7bad0000,0x8beede99,0x62880800,0xee34e635,0xff5bf6b7,0xbd55eeb9,0xbd96c5d7,0x08006aec,0xcdf749a6,0xe698e678,0xde16e658,0xe6bad637,0xa4f2f75c,0x20810000,0xf739de98,0xff3aff5a,0x41c6e6b9,0x9c910800,0xe6daff9d,0xc5d6ce17,0xbd55bd54,0xbdd6b575,0x0000840f,0x83ce0000,0x8bcd9c70,0xff7cb533,0x9c90f75c,0x08000000,0xacd33924,0x83edb553,0x00000000,0xce179c91,
-0xb595b595,0xb532bdb4,0xe6b8bd93,0x6289f75b,0x49c60000,0xddf6ee98,0x10002820,0x00001062,0x00000000,0x00000000,0x00000000,0x00001081,0xe6d95247,0xff9cf73b,0x0000ad33,0x00002124,0xde586b0b,0x2060940e,0x18401000,0x10200000,0xde999c91,0x0000732c,0x000028e3,0xf77c734c,0xff9cf75b,0xf75aff5b,0xf719f759,0x3000d574,0x00002041,0x000018e4,0xff5bbdb4,0xb4b1ff3b,
-0x20a30800,0x000020e3,0xeef962a8,0xff18ff39,0xeef8ff39,0xffbdf71a,0x1000de58,0x00400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000021,0x00002103,0xff9dad33,0xff5aff5b,0xff5aff19,0x5a68eed9,0x10a20000,0x00001882,0xff9cacd2,0xeeb9ff5b,
-0x00004a06,0x20c220a2,0x8bcd0000,0xff3bff5c,0xff5bff5b,0xef19ff3a,0xbd95ff9c,0x21240000,0x000010a1,0xffbdce37,0xacf2eefa,0x200038e2,0xcd537ac9,0xf73aff19,0x000062e9,0x08002103,0xff7bbd32,0xd637f71a,0x00001000,0x00000840,0x00000000,0x00000000,0x00000000,0x00000021,0x31240000,0x31854207,0x00000000,0x62e94226,0x6b0a738c,0xff9dd617,0xff7cf71a,0x0820e6fa,
-0x94700000,0xad33ffdd,0x5a670000,0xff59e6d8,0xff5bf73a,0xde99e6b9,0xce38deba,0x00006b0c,0xf71a62a9,0xff39ff5a,0xff7bff5a,0xbd96ce17,0x5aeba534,0x08000000,0xb552942e,0xb554b512,0x20e29491,0x736c0000,0xbdd6b595,0xeefac5f7,0xf73bff5b,0xff9cff5b,0x0800b554,0xce170000,0xf71aff9c,0xf73bffbd,0x0800a4b1,0x08000800,0xff7ccdb6,0xb594f77b,0x00000000,0xffbdc5f6,
-0xff9dff9d,0xff7dff9d,0xe6b9de99,0x5a28d5f7,0x39a50800,0xcdf6d677,0x00002040,0x00000820,0x00000000,0x00000000,0x00000000,0x00001081,0xe69849e5,0xff9cff5b,0x0000ad33,0x00002145,0xf75c6b2b,0xcdd5ff7c,0x30606a67,0xde377b0a,0xf75bff7c,0x08006b0a,0x000020e3,0xef1b6b2b,0xf77bf75b,0xff7bff9c,0xf77bff7b,0x8badff5b,0x18c30000,0x000018a4,0xf71b5a48,0xf71bff9d,
-0x08006aaa,0x18e20840,0x9c6f0000,0xff9cffbc,0xffbdff9c,0xff7cff9c,0x0800836c,0x08201881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x00200860,0xbdb641e6,0xde57de98,0xde78de56,0x0000a4f2,0x002018c3,0x000010a2,0xbd74a4b1,0x9470c594,
-0x10a20000,0x10610000,0x94910000,0xd5d6cdd6,0xcdf5cdf5,0xc5b4c5d4,0x83eec5d5,0x10a20000,0x00000040,0xff7cd678,0xff9dff5b,0xcd74de37,0xff7bfed9,0xef1aff5a,0x00205aa9,0x00002103,0xff9cb512,0xd678f73b,0x00000000,0x00001061,0x00000000,0x00000000,0x00000000,0x00000021,0x08001000,0x00000000,0x08200820,0x00000000,0x08000000,0xcdd70800,0xff5cff7d,0x00009c91,
-0x8c0e0000,0xad33ffdd,0x18600800,0xffddad32,0xc5b5ff9c,0x08002060,0x00000000,0x000020a3,0xeefa5aa9,0xf6f8f719,0x942df719,0x00000800,0x00000000,0x10001021,0x08000800,0x00000800,0x08000000,0x00001020,0x00000800,0x730b0800,0xff3ae6b8,0xff9cf6f9,0x0800c5b5,0xdeb90000,0xf73aff7b,0xe6b9ff9c,0x00002902,0xd6165a46,0xf75bffbd,0xc5d5ffbc,0x00000000,0xff7cd657,
-0xff9df75c,0x730be6ba,0x10000800,0x182030a1,0x00200000,0x41e55267,0x10410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00001081,0xe6b941c5,0xffbdff7c,0x0000b554,0x00002125,0xef1a4a48,0xff7bff9c,0xe657f6d9,0xff1bf6fa,0xf73bff5b,0x00006b0b,0x00001081,0x5a683985,0x83cd6b4b,0x838d83ad,0x8c2e8c2e,0x72ea940e,0x10820000,0x18630000,0x83ce0000,0xacf2ad13,
-0x08006aca,0x006010a1,0x00000840,0xde78acf2,0xd637ce17,0xb554d658,0x10400800,0x08001021,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000800,0x18621821,0x08600000,0x00000000,0x08000000,0x00000800,0x00400000,0x00000000,0x08200000,0x08000000,0x00000000,
-0x00000881,0x00000841,0x00000060,0x00000000,0x00000000,0x00000000,0x00000000,0x00000040,0x000008a2,0xf73ba4d2,0xff5cff9c,0xffddf73b,0xff9cff9c,0xef1aff7b,0x00005288,0x00002105,0xc5b45a68,0xe6daffbd,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000021,0x6a082000,0x30a272cb,0x20200800,0x7b4b6ac9,0x00006289,0x00000000,0xa4b2ce18,0x00000000,
-0xde1638e2,0xd616f73b,0x000028a1,0xa4f30000,0x0000bdb6,0x18000800,0x00000800,0x18410800,0xa4d20000,0xf71af75b,0x08009c8f,0x000020e3,0x00000000,0x18000800,0x00000800,0x00000000,0x10000800,0x10010800,0x18000800,0x00000800,0xde575a67,0xf6faff3a,0x000083ad,0xad330000,0xf73af75b,0xd658f71a,0x000041c6,0xff7bb512,0xeefaf73b,0xb553ff9c,0x10000800,0xf75c9470,
-0xde38f75c,0x000049c7,0x08000800,0x00000800,0x00001061,0x00000000,0x08001021,0x00000000,0x00000000,0x00000000,0x00000000,0x00001081,0xe71a4206,0xad33f77c,0x00005248,0x00001082,0xef1b4a28,0xf719ff7b,0xff3aff5a,0xff7cff1a,0xbd34eefa,0x00003103,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x00001881,0x08001001,0x00001041,0x00000000,
-0x10000800,0x00000000,0x00820000,0x00000000,0x00000000,0x00000000,0x00010820,0x00000821,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30c30800,0x08002842,0x108020c2,0x20c218a1,0x084018a1,0x00000000,0x000010a2,0x10410000,0x186020a1,0x20e228e2,0x10a118a1,
-0x00000000,0x18a20000,0x10a118c2,0x20c22904,0x18e22103,0x20e120e1,0x10802922,0x00000000,0x00200020,0x62a90000,0xf77cbd95,0xf73bff7c,0xff5aff3a,0xf77bff7b,0x000073ac,0x20a320c4,0x00000800,0x8c70738c,0x000018c2,0x00000821,0x00000000,0x00000000,0x00000000,0x10000021,0xe5f64080,0x72cbf6fb,0x49441000,0xff9cee98,0x732cf71b,0x18c40000,0x00000000,0x20600000,
-0xff7cde17,0xff3bff1a,0x41a6de78,0x00000000,0x00000000,0x9c4f2020,0xa4b1acf1,0x1020a491,0x00000000,0xa491ad13,0x00000800,0xa4b20000,0x630bb595,0x20610800,0xce16bd74,0xc5f7bdd6,0x2883b555,0x6b0c0000,0xd638d618,0x08008bee,0x7b8b0000,0x730ad616,0x00000800,0x00000000,0xff9cad12,0xe6baffdd,0x000028e2,0xffbdacd2,0xf77cf75c,0xdeb8f75b,0x10006268,0x94500000,
-0x4165ce18,0x08000800,0xb5549491,0x49e6ad13,0x29440000,0x83ad9450,0x00001820,0x00000020,0x00000000,0x00000000,0x00000000,0x00001081,0xa5134a48,0x000062ea,0x20a10000,0x00002903,0xf75b49e6,0xff5aff7b,0xff5bf6f9,0xd617ff5b,0x08006aa9,0x10410000,0x00200000,0x29230840,0x29043104,0x21242944,0x31653185,0x30e23103,0x18612081,0x08000000,0x08600000,0x29422123,
-0x206120c1,0x188320a3,0x00420063,0x10c100a1,0x18a21881,0x18c220c2,0x18831062,0x28e30000,0x102028c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30212862,0x832c6a08,0x00000800,0x10000800,0x00000000,0x08420862,0x00000021,0x08002061,0x08001000,0x08000800,0x10410000,
-0x08000000,0x10001800,0x08000800,0x08000800,0x08000000,0x08000800,0x00001000,0x00000000,0x00000000,0x000018a2,0x734c0000,0xff5bd617,0xfef9ff5b,0xf719ff5a,0x944ee6d8,0x00000000,0x10802102,0x00000000,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x08001082,0xf67748c0,0x6289f71b,0x39440800,0xff19eeb8,0xeed9ff1a,0x00007b8e,0x106118c3,0xd6170800,
-0xff3bff9d,0xff7bff7b,0xd658ff7c,0x10610800,0x080020c2,0xff7bacf2,0xff5aff7a,0xb574ff9c,0x10820000,0x00000000,0x00000880,0xff7cbd53,0x9c90ffbd,0x20c20000,0xffdce6d9,0xffbcffbc,0x2103ef3b,0x84500000,0xffbcffdd,0x7b4bf71a,0x00000000,0x08000000,0x6aca0800,0x08004986,0x94500800,0x944fb553,0x00001060,0xc5d65a89,0xc5f6ce17,0xffdde71a,0x6289e6b9,0x00000000,
-0x00000000,0xb5540800,0xff9dff9c,0x6289f75c,0x52270000,0xe698f71a,0x10002840,0x00001042,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x18c20000,0x080020c2,0x62a90800,0xff7bde57,0xff5bff5b,0xe6b9ff9c,0x00009471,0x28e30000,0x00000820,0x00000000,0x08000000,0x10001000,0x08000800,0x00000000,0x10001000,0x08001000,0x00000800,0x00200020,0x00000000,
-0x10000800,0x00001000,0x002110a3,0x00600000,0x00000000,0x00000000,0x08000000,0xacd17b4b,0x18412040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200000,0x30003062,0xe6587a69,0x6ac9a491,0x72c9834a,0x42086aeb,0x00210000,0x18200000,0x62271800,0x7b0a7b0a,0x52286268,0x00003985,
-0x18000801,0x8b4c2000,0x836c8bad,0x834d834c,0x7b4c836c,0x834c72ea,0x3103730b,0x08000000,0x00000000,0x20e31061,0x000020c3,0x940f0800,0xff3beeda,0xf719ff3a,0xff5bff5a,0x5248c5b5,0x18e20000,0x08820881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000841,0xf6985961,0x5a69eefa,0x28e20000,0xf6f9de37,0xff5bf6d9,0x00009471,0x10a11903,0xcdd60800,
-0xf73aff5c,0xff3af71a,0xacf2ff9c,0x29030000,0x080020c2,0xf73abd94,0xf718f6f8,0xff9cf739,0x0000a4f3,0x10813145,0xb5940000,0xeeb8ff5b,0xa48feef9,0x08200000,0xf75bd678,0xf75af75a,0x2963deb8,0x8c910000,0xef19ff9b,0xe6b9ff7b,0x00006b2c,0x000031a6,0xf73b7b8d,0x30c2d5f7,0x08001000,0x00000800,0x10400820,0x00000000,0x10000000,0xe6d96b2a,0xef1bffbd,0x0000528a,
-0x00002966,0xf77c9cb1,0xf75bef3b,0x5206e6b9,0x52470000,0xee98f6fa,0x10003060,0x00001822,0x00000000,0x00000000,0x00000000,0x00000000,0x10c30000,0x08610061,0x08000000,0xf73ba491,0xf73aff9c,0xff7cff9c,0x41c6c5b5,0x08200000,0x186120e3,0x00200800,0x08400821,0xc5b56b0b,0xc553cdb5,0xb4f2b512,0xacf1acf1,0x9c0fa490,0x7b6d93ef,0x00201861,0x00000040,0x9c4f6b2b,
-0x9c2e9c4f,0x8bceacb1,0x08211000,0x00000840,0x522820c3,0x49e541c5,0x5a063943,0xcdb5f6d9,0x20a22860,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x30003082,0xfefa8aca,0xf73aff9c,0xff7bff3a,0xa4f3f77c,0x10a30000,0x10002081,0xee574942,0xff1aff3a,0xf73bf73b,0x0000ad13,
-0x18411062,0xee783060,0xff3aff7b,0xff7cff5b,0xff5bff5b,0xff7cff5b,0x9470ff5c,0x10a20000,0x20a20000,0x00000000,0x20e310a2,0x000018a2,0xbd7541c7,0xffbdf73b,0xf75bff7b,0xe6fbff9d,0x00008410,0x000008a2,0x00000041,0x00000000,0x00000000,0x00000000,0x00000000,0x10000820,0xf6b93860,0x41c6f73b,0x39240000,0xffddeeb9,0x944fff5b,0x18e20000,0x00200000,0x00000820,
-0xf75bbdb5,0xff7bff7b,0x0800c595,0x00000000,0x08000800,0xbd530800,0xeeb7ff19,0xde77f718,0x00006b0b,0x10400000,0x94900000,0xee98eed9,0xb4f1f6d8,0x00000800,0xff9dde79,0xff9cf71a,0x28c0eed9,0x83ee0000,0xf6f9ff3b,0xd637ff3b,0x00004a08,0x00000000,0xe6da5a89,0xd617ff9d,0x10003923,0x20601820,0x08200000,0x00000000,0x08001000,0x5a680800,0xde99e6fa,0x000041c7,
-0x00000000,0xd6785268,0xff7cff7c,0x5a68f73b,0x52880000,0xe6b9f75b,0x08002861,0x00001021,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x000008a3,0xd6796b4c,0xf75bff7c,0xffbcf73a,0x7b4ce6b9,0x00000800,0x20e32104,0x00000000,0x10400000,0x00001061,0xff9c8c50,0xff3aff3a,0xff5bff5b,0xff9cff7b,0xff7cff9c,0xe699ff9d,0x10002041,0x000020c2,0xff9ccdd6,
-0xff5bff3b,0xff3aff9b,0x1800832a,0x10212061,0xc5d70000,0xeed8ff7c,0xff1aeed8,0xd5d5ff7b,0x28c22860,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x30002000,0xfeda82a9,0xf73aff3b,0xf719f6f9,0x4a27e6d9,0x10820000,0x10001860,0xff5bc532,0xff3aff3a,0xff9cff5b,0x0000c5f6,
-0x08202124,0xee572820,0xff19ff5a,0xff5aff3a,0xff7bff7b,0xff5bff7b,0xad13ffbd,0x29440000,0x5a480800,0x7b6cc5b5,0x00000000,0x18a32103,0x00000000,0xce37736d,0xffbdff9c,0xf79dffbd,0x0000a534,0x004110a3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x7b0b2000,0x20c383ae,0x18620000,0xacf39450,0x00009450,0x00001040,0x6b4b9cd1,0x00000000,
-0x7bac2102,0x7b4a83ac,0x20612860,0xad130000,0x0800c5b5,0x08000000,0xff3ac573,0x5204e677,0x00000800,0x20614185,0x00000000,0xe678a470,0x9c6fde57,0x00000000,0xff5ccdf7,0xf75ceefb,0x1840de99,0x840f0000,0xff3bff5c,0x2881cdd6,0x18620000,0x18007b2c,0x52680000,0xf73be6d9,0xe698e6d9,0xd638e6b9,0x000062cb,0xbdb562ca,0x72e9cdf6,0x08001000,0x4a4862ea,0x08000000,
-0x080062ea,0x41a50000,0xff9dd678,0x5228e6ba,0x42070000,0xce17e6d9,0x08001820,0x00001882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000021,0x00000862,0xe6da7bce,0xffbdf77c,0xb553ef3a,0x08003964,0x18e41862,0x000018a3,0xad1220a0,0x00006b0b,0x00002904,0xf75c83ee,0xff19f71a,0xff3aff1a,0xff3aff3a,0xff1aff3a,0xe657ff5b,0x20203881,0x000020c2,0xff7bc512,
-0xff3aff3a,0xff59fef7,0x4060e5b3,0x20832000,0x6b2b0000,0xff5af71a,0xff39ff39,0xcd52ff19,0x28a22860,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28002041,0xfefa7a68,0xf73aff5b,0xff7bf73a,0x0000a4d1,0x18c218e2,0x62880000,0xff3af6f9,0xff3aff19,0xff5bff3a,0x0000c5d5,
-0x080010a2,0xf69840c0,0xff39ff5a,0xff3aff3a,0xff19ff19,0xff19ff19,0x9c91f75b,0x21230000,0x51a41000,0xf71af6fa,0x5a46c593,0x20810800,0x208328e4,0x00000000,0xdeb98c50,0x738ddeda,0x08400000,0x10a20820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x18810000,0xa4b10000,0xe6b9ff9c,0x0000630b,
-0x00000040,0x10000800,0x10000800,0xf75c9c91,0xbd95ff7c,0x00000001,0xff5ba4b1,0x0000838c,0x62ca0000,0xc595e6da,0x10000000,0x20400800,0x08000800,0x00000000,0x62aa49e7,0x6b4c6b0b,0x08605aca,0x39c60000,0x9c5083ae,0x00003104,0xbd940000,0xacd1ff3b,0x00000800,0xef1a73ac,0xff3aff3a,0xff5cff7b,0x00007b6d,0xeef97b8c,0xeed8f719,0x1000730a,0x00000000,0xacf20000,
-0xa4b1f73b,0x00001000,0x840f4a27,0x20c2734c,0x10a20000,0x41c65aa9,0x08010800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10620000,0x18820821,0x00000000,0xd678b574,0x000083ee,0x20c30000,0x000020c4,0x7bac0000,0xff7bde77,0x1000834b,0x000028e3,0xf77c840e,0xff5bff9c,0xff5bff5b,0xff3aff5a,0xff39ff3a,0xee15fef8,0x20003020,0x100020c0,0xd4b09b4a,
-0xd48dcc6e,0xe4cddc8c,0x71c2cc6c,0x08201800,0x000010c2,0xc4cf8349,0xcc2bccad,0x9b28c44b,0x20813040,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10001861,0xf6b87267,0xf75bff5b,0xd657ffbd,0x00003984,0x10811060,0xcdf60000,0xff5bff7c,0xf6d8ff19,0xff9cff1a,0x0000cdf6,
-0x10200041,0xf6773840,0xf6b7fed8,0xf6f9f6d8,0xf719ff19,0xf6f9ff19,0xa491ff3b,0x29220000,0x59c51000,0xff1af6d9,0xeef9ff3a,0x08009c6f,0x28e30800,0x10a220c3,0x31c60000,0x000041e6,0x18a21061,0x00001040,0x08600000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x08401060,0x00000820,0x20c120e2,0x08001860,0xff5bac70,0xff7cff3a,0x0000ce17,
-0x398518c3,0x6a676aa8,0xa4706247,0xff5bff3b,0xe698ff7b,0x00003146,0xff9cbd53,0x08007b4c,0xf71a6ac9,0xff5bff5b,0x1800c553,0x18001800,0x08001000,0x00000861,0x10001000,0x08001000,0x00000000,0x00001060,0x10001000,0x18001000,0xff5acdb4,0xff7bfef8,0x00009c70,0xeef94a05,0xff18ff7a,0xeefaff7b,0x100062aa,0xff5a93ec,0xff7bff5a,0x8c0fff5b,0x00000020,0xff5cb574,
-0xff7cff5c,0x0800acb1,0x00000000,0x00000000,0x00001062,0x00000000,0x08200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18612062,0x00001881,0x18c10000,0x08400000,0x102120a3,0x29030800,0xf73ab533,0xf6f9ff7a,0x10006aa9,0x000028c3,0xf77b7bac,0xff5aff7b,0xff3aff3a,0xfed6ff18,0xfe33fe75,0xd4effdf3,0x10003020,0x10001060,0x816060a0,
-0x81a06060,0x99c099e0,0x826481a0,0x08003080,0x08400020,0x61811800,0x89e071a0,0x69608a01,0x20203040,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00610000,0x08000841,0xfef96205,0xd657ff5b,0x31859470,0x10600000,0x08000820,0xc5d61000,0xff3bff5b,0xff5aff1a,0xff5aff3a,0x0000cdd5,
-0x10410841,0xfeb83880,0xfef8ff3a,0xff5aff3a,0xff3aff3a,0xff3aff5a,0xacf2ff9c,0x31220000,0x6a071800,0xff3afed9,0xff7bf73a,0xde99f75b,0x0800838d,0x10400800,0x002018c3,0x29040000,0x00001861,0x62ca0800,0x00002903,0x00000000,0x00000000,0x00000000,0x00000000,0x08000841,0xcd7359a3,0x0800a490,0x39640000,0x93ac8bcd,0xac0d938b,0xedf5e5b4,0xe615dd93,0x1000b4d1,
-0x7b2b0800,0xe5f3ddd4,0xfe76e5f3,0xfe34f613,0xdd92fe74,0x100038c1,0xeeb8ac8f,0x1000732b,0xf655936a,0xfe34fe55,0xbc4dfe75,0x828671c1,0x62268b29,0x00000000,0x7a6661e5,0x72247223,0x206051e5,0x72a81800,0x8b28a3ec,0xcd117265,0xfeb6feb6,0xfed7fe75,0x08009c4e,0xde154983,0xf654fe75,0x838be635,0x10000800,0xfef7b46e,0xf719ff18,0xc5b5ff3b,0x00000000,0xffbdd658,
-0xf75bf75c,0xc594ff9c,0x8bcd838c,0x39247b4c,0x42070000,0x838c8c0e,0x00002881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x5a493124,0x08000800,0x18a120a2,0x00000860,0x006108c2,0x08000800,0xeeb98bce,0xff5aff5a,0xeed8f739,0x08006aa9,0x080028c3,0xff5a836a,0xff19ff3a,0xfe96fed8,0xfdf0fe52,0xecebf56d,0xcbeaf4ab,0x00402020,0x18000020,0xbb8b8a46,
-0x9ac88a46,0x9a649a85,0x82a78a44,0x08004103,0x00000820,0x28602081,0x6a044941,0x698379e3,0x10003860,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000841,0xd5f551c4,0x0000acd1,0x00000000,0x20a21020,0x08201020,0x00001040,0xeefaa4b1,0xff19ff3b,0xff5bf6f9,0x0000c5d5,
-0x080010a3,0xee7738a0,0xff19ff3a,0xff5bff1a,0xff3aff3a,0xff1afef9,0x9c4fff3b,0x28c20800,0x40a11800,0xff7bf6b9,0xf75af73a,0xff7cf77b,0xbd94f73b,0x00003984,0x08410861,0x080020a3,0x83ad0800,0xde99d657,0x000041e6,0x00001061,0x00000000,0x00000000,0x00000000,0x08001082,0xe5b47a66,0x08007ae9,0x20a11820,0x61e451e5,0x720469e3,0x50806161,0x59625900,0x100038a0,
-0x30c20800,0x72027245,0x8aa47a43,0x92828a62,0x7a039283,0x080030a0,0x73084981,0x10003103,0x8ae75140,0x9ae792e8,0xa3899b07,0x9b6a9307,0x7ae8a3ab,0x08000000,0xabcb82c8,0xabaab3a9,0x28208309,0x8b291800,0xabcabc6d,0x8b089349,0x82858ac6,0x7ac682a5,0x08004162,0x6a252820,0x7a658286,0x08004960,0x6a881000,0xfeb7d592,0xff5af719,0xc5b5ff9c,0x00000000,0xff7cbd95,
-0xff7cf77c,0xff9cf73b,0xf73bff7b,0x6268f6fa,0x83ee0800,0xe698ffbd,0x100030a1,0x00001041,0x00000000,0x00000000,0x00000000,0x00000841,0xde79628a,0x6aa9cdb6,0x00000800,0x004110a1,0x00000082,0xc5955228,0xff7cff3b,0xff5aff3a,0xf6f9ff7b,0x08006aca,0x080028c3,0xeeb6836a,0xfe96ee76,0xfdb1fe75,0xecc9ed0c,0xec89ecc9,0xaac4ec28,0x00401000,0x10000040,0x71405080,
-0x40204820,0x69a35080,0x41016182,0x08001800,0x10201000,0x08000800,0x10000800,0x59435102,0x08003061,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20a020c1,0x00000000,0x186128e4,0x08002041,0x10800820,0x08200860,0x6aeb0000,0xf71ad5f6,0xff5bff3a,0x0000c5f5,
-0x104210a3,0xee982820,0xff18ff5a,0xf6d9ff19,0xfef9fef9,0xff1aff1a,0x9c70ff5b,0x29030000,0x38401800,0xff5af6b8,0xff7bf73a,0xf719ff5a,0xf73bff5b,0x0000736b,0x104210a2,0x7aea1000,0xf73acdb4,0xef3bff9b,0x000062eb,0x00001062,0x00000000,0x00000000,0x00000000,0x08000861,0xddb48287,0x00006248,0x10201040,0x28604143,0x08001000,0x10000800,0x08001000,0x00000800,
-0x00000000,0x18001000,0x30401800,0x69a269e3,0x514269e4,0x00200800,0x00200000,0x10000000,0x08000000,0x18001800,0x10001800,0x10000800,0x40e059a2,0x18000800,0x69405962,0x81e179a0,0x30208286,0x40c02000,0x300071e3,0x00001000,0x08001000,0x00000800,0x08400000,0x08001000,0x08001000,0x28e10000,0xac0d2000,0xde15fed8,0x83ce7b6c,0x62eb9430,0x00000000,0x94306aea,
-0x9cd29c91,0xad33a4d2,0xe6f9b553,0x59c5f6f9,0x8bee1000,0xde35ff5a,0x18003881,0x00000800,0x00000000,0x00000000,0x00000000,0x00001063,0xeeda62ab,0xf6d9ff9c,0x72eac553,0x00400800,0x000010a3,0xf71a732b,0xf73af73a,0xf719f73a,0xf6faff3a,0x080072ca,0x080028c3,0xf6f77b4a,0xedf2ee75,0xfd2eed0e,0xdbc6fcec,0xec8aec8a,0xab04f4cb,0x00401000,0x08001081,0xabcb82c7,
-0xac2d9b69,0x20008b4b,0x00001000,0x18620800,0x10212083,0x10621042,0x08000000,0x18000800,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x100120c4,0x18002061,0x6aa92020,0x00000800,0x10a210a1,0x000018a3,0x83cd0000,0xff7bde78,0x0000c5f6,
-0x10620882,0xeeb82820,0xf6f8ff7a,0xfef9ff19,0xff1aff1a,0xff19ff19,0x9c90ff5b,0x29030000,0x40a11000,0xff7aee97,0xff3af719,0xfef9ff19,0xbd94ff5b,0x10800000,0x080020e3,0xfefa8b8d,0xf6f8ff5a,0xf73af719,0x0000630b,0x000018a3,0x00000000,0x00000000,0x00000000,0x00000840,0xb4b172a8,0x00001000,0x39010800,0x28204922,0x08001000,0x08000000,0x10001000,0x00000000,
-0x00000000,0x20411800,0x18201840,0x41222860,0x10004103,0x00000820,0x00000000,0x08000820,0x08001020,0x10001000,0x08200800,0x20c10000,0x51417ae8,0x18001000,0x7a454901,0x8a8579e2,0x30207286,0x7a882000,0x40a09b4a,0x10401800,0x08000000,0x00200000,0x00000021,0x08000800,0x20a21000,0x18a10000,0xa3ed3040,0x49a4d5f5,0x00000800,0x00000000,0x08400880,0x08000000,
-0x00000000,0x08000000,0x83cc0020,0x6206f6f9,0x41651000,0xde57c5d4,0x100038a2,0x00001062,0x00000000,0x00000000,0x00000000,0x00001063,0xeefb5a69,0xff7bff7b,0xeeb9ff7b,0x08006aa9,0x10a218a3,0xacf10800,0xff5aff9c,0xff5bf75a,0xff1aff5b,0x080072eb,0x080020a3,0xff597b8b,0xfef7f6d7,0xe429fd90,0xec6afd8f,0xd409dbe9,0x9283c345,0x00201000,0x080018c2,0xf6b6ac8e,
-0xcd73ee76,0x000062a9,0x08a20040,0x00001061,0x28a20800,0x00000000,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200020,0x18220001,0x49221800,0xeefac553,0x5ac9cdf6,0x00000800,0x08a318e4,0x00000841,0xad130800,0x0020bdd6,
-0x08000000,0xee973080,0xff18ff39,0xf676f696,0xf697feb8,0xf6f8f6d7,0x944ff73a,0x20a10800,0x38801000,0xf6d7e635,0xf6d7f6b7,0xfed9fe98,0x5aa9eeda,0x20e10020,0x30a10800,0xff5be658,0xff3aff1a,0xeed9ff3a,0x00005269,0x000018a3,0x00000000,0x00000000,0x00000000,0x00000820,0x080020c2,0x18001000,0x61e34100,0x384061a2,0x30c30800,0x7a047a88,0x7a4671a3,0x08005183,
-0x31250000,0x38c24986,0x08201000,0x08400000,0x08000820,0x51c61821,0x51646a26,0x08001800,0x51212840,0x79c36941,0x30805942,0x08400020,0x596361e5,0x18002000,0x59e51000,0x6a057266,0x08002060,0x7a672800,0x28007aa8,0x49441800,0x59c66a28,0x49c64985,0x00002103,0x49a50800,0x49236206,0x00001020,0x62881000,0x00005a88,0x62ca0000,0x52277b4c,0x00000000,0x41852903,
-0x49a541a5,0x30e149c5,0x62a80800,0xc574ff3b,0x00000800,0x736c20c1,0x08003945,0x00000801,0x00000000,0x00000000,0x00000000,0x00001882,0xe6da5a69,0xff3af73a,0xff5bf71a,0x1800d5b6,0x08611061,0x31020000,0xff9ce698,0xf75af73a,0xf73bf75a,0x00006b0a,0x000020e3,0xef3a736b,0xff19ff9b,0xec8afe12,0xc344f4ab,0x89a0b306,0x69007920,0x00003080,0x000020a3,0xd615acf1,
-0x10007aea,0x10610000,0x000010a2,0x62880000,0xde56bd53,0x3942a48f,0x10410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x08000822,0xf6b98bad,0xff7bff5b,0xef1aff7b,0x1820b533,0x08820000,0x18c210e3,0x00000800,0x20e239a5,
-0x10400000,0xf6d92020,0xff3aff9b,0xff39ff19,0xff19ff19,0xff5aff39,0x8c2ef77b,0x28c10800,0x30801000,0xff59f6d8,0xff19ff39,0xff1bfefa,0x0000acf3,0x18a11081,0xacb11000,0xff1aff9c,0xff5bff3b,0xeeb9ff7c,0x00003965,0x00200821,0x00000000,0x00000000,0x00000000,0x00000820,0x10410000,0x40e10800,0x92e77203,0x50e0a369,0x30c21000,0x79807a25,0xa3299a43,0x10006a05,
-0x41241000,0x51013820,0x08004943,0x00400840,0x10200020,0x59633040,0x71a479e5,0x18001800,0x92c748e1,0xb307aae6,0x40609286,0x10400000,0x590140c0,0x28205963,0x08000800,0x10003923,0x18001000,0x8aa769a3,0x28006a05,0x59642000,0x71847a07,0x49435944,0x00002060,0x59e51820,0x59635142,0x18204964,0x00001840,0x00000000,0xf73b8c2e,0xbd74ff5b,0x00000000,0xe6daacf3,
-0xeedae6b9,0x5a47d637,0x6b0a0800,0xff5cf71a,0x0000b574,0x00000000,0x18420000,0x00000000,0x00000000,0x00000000,0x00000000,0x000018a1,0xef1a62ca,0xff9bf75b,0xff9cff9c,0x9c10ff7d,0x10a20000,0x080020c2,0xff9d9c70,0xffbcffdd,0xf77bffbd,0x0000630a,0x00002903,0xf77c83ed,0xff3af77c,0xd44aedd2,0xcc0ad46b,0x79a17140,0xbc6e92a5,0x08001800,0x00001842,0x52676b0a,
-0x18410800,0x20e328e3,0x20a00000,0xff39acd0,0xff59ffbb,0xde36ff9b,0x000041a6,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x000008a3,0xe6ba7b6d,0xf75bff7c,0xff5bf75b,0xe699ff7c,0x08008bce,0x20e20000,0x20811860,0x00000000,
-0x10400840,0xbd741820,0xe698de78,0xe698e678,0xeed8eeb9,0xe6d8e6b8,0x7b8ce6d9,0x28c30000,0x28401000,0xff5ae677,0xf71af719,0xde38f6fa,0x00000000,0x000018c2,0xeefa5227,0xff5cff7c,0xff3bff5c,0xe699ff9d,0x00000000,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x08000840,0x72264985,0x9a6460c0,0x58a0c3ca,0x28611000,0x818058e0,0x710091c0,0x18003000,
-0x28002020,0xa3278286,0x8b4aac0c,0x18a10000,0x18001040,0x79a07204,0x69207960,0x08003081,0x81e24880,0x9a009a01,0x50c081a1,0x20800800,0x60e06183,0x48a05080,0x08002020,0x18200000,0x48202000,0x79817940,0x28005921,0x38601800,0x604060a0,0x40004820,0x10001000,0x10000800,0x30003800,0x41034080,0x20c30800,0x7bad0000,0xff7bf73a,0xbd95ff9c,0x00000000,0xff7cc5f6,
-0xff5bff3b,0x6288eefa,0x6b2c0000,0xff5beefa,0xad33ff7c,0x18810800,0x00000800,0x00000820,0x00000000,0x00000000,0x00200000,0x000010a1,0xef3b62ca,0xa4d1e6fa,0xa4d2a4f2,0x8befad13,0x08620000,0x00001862,0xa4f230e3,0xa4f2a4f2,0x9cd19cd2,0x00004206,0x00001081,0xbd956aeb,0xc553bd74,0x4840936a,0x9b6a82a7,0x82876162,0xac6fb46e,0x08000800,0x10420800,0x00200000,
-0x18c218e3,0x08000000,0xc57072c6,0xe5b1ee13,0xe5b1e590,0xa42ed571,0x00003925,0x00800880,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18a11020,0x00610081,0x00000000,0xe6999c70,0xff7bff7c,0xff7cff3b,0xcdf6ff7c,0x0000734b,0x31040000,0x00211062,
-0x00000020,0x10200800,0x08000000,0x18200000,0x20a01800,0x084018c0,0x20a128e1,0x10010800,0x18000800,0x7b6b6ac9,0x734b734b,0x418562c9,0x10420000,0x00000820,0x8c0f4a28,0xa4919c70,0x94509c71,0xce37a4b1,0x00003165,0x00001082,0x00000000,0x00000000,0x00000000,0x00000000,0x00001081,0xcd743923,0xf5b3f615,0x6982e531,0x49c61000,0xe571c4f0,0xe573e530,0x080093ae,
-0xa42e1000,0xc46ce5d2,0x6a66bc6d,0x00001000,0x10002060,0xe5929329,0xc46ddcad,0x080072c9,0xccef61a3,0xe4cde50e,0x9329d4ae,0x08000800,0xe592cd11,0xbcafb40b,0x00005206,0x00002946,0xc46f6a48,0xdd10cc4d,0x3040bcb0,0x93cd1000,0xc42dccaf,0xa3acab4a,0x000051c5,0x836b41a3,0x938c8309,0x38e29bcd,0x28e41000,0x7b6d0000,0xf75aeefa,0xc5b5ff7b,0x00000800,0xff7ccdf6,
-0xff3bf71b,0x62a9eed9,0x52490000,0xff5bf71b,0xff9cf75b,0x00007b8d,0x000020c2,0x00000000,0x00000000,0x00000000,0x00200000,0x00000880,0xde996b0b,0x00007bae,0x00000000,0x00000000,0x00000000,0x10000000,0x00000800,0x00000000,0x00000000,0x00000000,0x08000000,0x08000000,0x08000000,0x20001000,0x10001000,0x30401800,0x10002820,0x08200000,0x00000800,0x10e30882,
-0x00000040,0xcdf55a88,0xee95f6f7,0xf633e613,0xbc6dedf3,0x18003020,0x18a30000,0x00001080,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18210000,0x00000800,0x11020020,0x00000881,0x39040800,0xf73bb533,0xf75bff7c,0xffbdf75b,0xb554ef1b,0x00003123,0x00210001,
-0x00200841,0x00410021,0x08411081,0x00000841,0x00000020,0x00200000,0x00000000,0x00010001,0x10200000,0x00000000,0x00000000,0x00000000,0x00001021,0x10400820,0x00000000,0x00000000,0x00000000,0x6b4c0020,0x000039e6,0x00000841,0x00000000,0x00000000,0x00000000,0x00200000,0x20c20000,0x8bee0000,0xff39fef9,0x59c4f697,0x4a060800,0xe676d636,0xe657e615,0x00009c70,
-0xb4ef1800,0xe614fed6,0x08006aa8,0x51c61000,0x08001820,0xb46f1000,0xe5b2f613,0x08007b0a,0xe61451c3,0xee13f674,0x9bedf675,0x10000800,0xfe96d592,0x9c0dee35,0x000120a2,0x00000000,0xcdb349c5,0xfef6feb5,0x20c0d634,0xb5320800,0xfef7ff38,0xff19fef7,0x08008bad,0xe6975a66,0xff1af6d8,0x0000940e,0x00000000,0x00000000,0xe6b95a88,0xbd94f79c,0x08000000,0xff9cd658,
-0xffddff3b,0x5247ef1a,0x62cb0000,0xff9cf77c,0xc5b4f75a,0x20811840,0x00001040,0x00000040,0x00000000,0x00000000,0x00000000,0x00000040,0x734d5aaa,0x29040000,0x292420c2,0x21233185,0x212418e2,0x002118c3,0x10810000,0x18c218c2,0x08c21944,0x106118c3,0x08000000,0x10a31062,0x18c22104,0x184020a0,0x18a21861,0x00001020,0x10400800,0x00000840,0x00000000,0x00000000,
-0x9cd10000,0xffbdef3b,0xff5aff7b,0xff5aff7b,0x1000a46f,0x10600800,0x000020c3,0x41431000,0x10412081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x28421000,0x8bac7288,0x00200000,0x08400000,0x080020a3,0xe6782840,0xff5bff5b,0xf75cf77c,0xff9dff9c,0x8c2fe6da,0x00000000,
-0x00000020,0x00000000,0x00000000,0x00000000,0x08600000,0x08600060,0x08200840,0x00010002,0x10200821,0x10800820,0x10c108a0,0x10211082,0x20610800,0x20602060,0x418528a1,0x21232923,0x18e32123,0x000010c1,0x00400000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x08001800,0x00000000,0x7b4a5246,0x204072e9,0x18800000,0x49e43962,0x204049a3,0x31001020,
-0xb4ee1000,0x5180d5f3,0x00000800,0xde587b4c,0x0800acd2,0x10000800,0xe5f4a3ca,0x080072c9,0x38e03901,0x51605180,0x41216204,0x08000800,0x728559c2,0x10006a66,0x00200000,0x0000630b,0x41820000,0x9c0aa42b,0x08207b6a,0x62e90000,0xa4ae9c8e,0xbd31bd10,0x08005a68,0xde565225,0x942deeb8,0x00000800,0xce1841c6,0x00007b8e,0x5a680000,0xc5f6e6fa,0x00000000,0xbd958c30,
-0xbd74b574,0x3143ad12,0x4a290000,0xce16b554,0x1860b593,0x00000800,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10012083,0x08000800,0x00000000,0x00000000,0x10200000,0x00000821,0x00000821,0x00000000,0x00000000,0x00001840,0x00010021,0x00000000,0x08000000,0x00000000,0x10001021,0x10611861,0x00200000,0x00000000,0x83ed0000,
-0xf77bde97,0xff7df79c,0xff3bff7c,0xde16ff7b,0x00000800,0x086010c2,0x62260000,0xbcd0cd93,0x18412040,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x30411800,0xf6977205,0x83ace697,0x000028e0,0x10002062,0xeeb851a5,0xff3aff7b,0xf77cff7c,0xff7cf77c,0xff9cff7b,0x0000b554,
-0x10401081,0x30c01820,0x49834163,0x38e24943,0x10001800,0x10201820,0x00001060,0x08210000,0x10000800,0x20602020,0x10a00820,0x08000000,0x28202040,0x51634902,0x38803860,0x20203060,0x08200800,0x08800860,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x000008a2,0xa47172eb,0x08800000,0x00000000,0x00000000,0x00000860,0x00000000,0x08000800,0x10000800,
-0xacae1000,0x1800bcf0,0x734c0800,0xff9def1b,0xbd54ff9d,0x08001840,0xff5b836b,0x0800838d,0x08000800,0x10000800,0x18001000,0x08011001,0x00000000,0x00000000,0xbdb60000,0x9cb1ffdd,0x18e20000,0x00000800,0x00000800,0x08001020,0x00000000,0x08000000,0x00000000,0xde574163,0x1000a4b0,0x62a91000,0xff7cde78,0x838ceef9,0x00001020,0xb5349c50,0x10c20000,0x00000020,
-0x00000000,0x00000000,0x00000822,0x00000800,0x00000000,0x838e1000,0x000049e7,0x00000820,0x00000000,0x00000000,0x00000000,0x00000800,0x00420001,0x00001042,0x8b8b4163,0x836a8b8b,0x8b8a8b8a,0x20007ae9,0x08011800,0x20e30000,0x52055267,0x38e26a67,0x10610000,0x00000000,0x28e31883,0x49633902,0x20202040,0x20002000,0x08002000,0x08010800,0x000018a2,0xf75bad13,
-0xff5bff3a,0xff9dff7c,0xf6d8ff5b,0xd5f3ff38,0x18811000,0x000010c2,0xee75a4cf,0xc4cffef8,0x20612820,0x08001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10200000,0x30001800,0xfe7679c4,0xff3aff3a,0x0800acf1,0x080020a2,0xf69840c1,0xff19ff5a,0xbdb5f73a,0xe6d9bdb4,0xff9cf75a,0x0000c5d5,
-0x080020c2,0xee565161,0xfe98fed8,0xf656fe98,0xddf5ee36,0xb532de16,0x00000800,0x10000841,0xd5952000,0xe656ee57,0x0000bd53,0x20610820,0x82672800,0xfe57f636,0xf615fe97,0xee15f615,0x08007ae9,0x00001060,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x000010a2,0xff1b9bad,0x0000838d,0x41e620e2,0x18805247,0x28e10000,0x8b4a834a,0x936b938b,0x9bcb93ab,
-0xf697ac2d,0x1000bd11,0xdeb90000,0xff9dfffe,0xef3bffbd,0x00005aa9,0xffbd7bad,0x62a9b574,0x5a495a28,0x5a695228,0x28816aa9,0x08010801,0x00000000,0x00000820,0xffbdbd95,0x730ae6d9,0x00000000,0x30801000,0x20421000,0x18001000,0x28602040,0x202038e0,0x10002060,0xf6b882c8,0x1000836b,0xe6375184,0xfed8ff3a,0xf6d8ff39,0x080049e6,0xe638a430,0x10002840,0x20202020,
-0x28801800,0x08001800,0x08010821,0x20002000,0x000028e3,0xee79b4b2,0x00003903,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00210001,0x10002081,0xff19cd32,0xfef8fed8,0xff39fef7,0x7a25fe55,0x20831000,0x31040000,0xfef9de57,0xd573fef9,0x10002840,0x080020a2,0xb5140000,0xedf5ee77,0xee15edf4,0xdd93e5d3,0xc4f3dd74,0x080038c3,0x000020c2,0xff5bc594,
-0xf6d9fef9,0xd617d637,0xf6d8f719,0xd5d3f696,0x08611000,0x00000040,0xfeb4cdd2,0xc48dfe74,0x20823040,0x08001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08200000,0x40800800,0xf5519a45,0xe572ed11,0x10009bcd,0x08001860,0xbcd02800,0xd5b3ddb4,0x0000838c,0x62870000,0xde56b531,0x18009c2e,
-0x100028a3,0xedb250e0,0xf531f592,0xfdb3fd72,0xf592fdb3,0xa42eedd4,0x10810800,0x20001020,0xf5939287,0xf636f593,0x000093ed,0x288020c1,0xd48e4020,0xfd92fe14,0xfd92fd92,0xfdd3fd92,0x2800cc8f,0x10202880,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10001081,0xfe3592c7,0x1800936b,0xb4b11800,0x4941cd73,0x62251000,0xf570e571,0xf591fd91,0xf615f5d3,
-0xf636edb3,0x1000a44f,0xad540000,0xe6dadeb9,0xdedaef1b,0x000052aa,0xf77c738c,0xf75bff9d,0xeef9f75b,0xf71af71a,0xacd1ff5b,0x08000000,0xef1abdb5,0xde98de78,0xe6f9ffbc,0x10005a27,0x9c0d1000,0xab6ae592,0x20008288,0x8b0a2000,0xbbcbbc4d,0xa2e7a2c6,0xb389a307,0xedf3dd0f,0x100072e8,0xe57369e5,0xf550fd92,0xdd51f570,0x10004163,0xdd32932b,0xcc2dcc8f,0xa2c6ab08,
-0x9aa4aae6,0x50a092a7,0x10001000,0x69a57a27,0x18000800,0xc470b3ed,0x10002800,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0x58a01800,0xdc0bd46d,0xe44bd3c9,0xe46ceccd,0xb368eccd,0x20812800,0x08001043,0xdcf08b0a,0xdc8eecef,0x18008245,0x18811880,0x830b0800,0xeccddccf,0xf4ccfd0d,0xf50ef4ed,0xf593f550,0x100050c1,0x100020a1,0xdd72a3ab,
-0x8bacbcf0,0x00000800,0xacd072e9,0xc5d4de55,0x08610000,0x00002124,0xfeb3c54e,0xc46cfed5,0x28823860,0x08001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x51220800,0xb24391e3,0xa265aa01,0x10006142,0x08201040,0x7aa81800,0x200069e5,0x20a01000,0x000020c1,0x41820800,0x100051e4,
-0x18001821,0xa2844020,0xba22b263,0xb202ba43,0xbae6b200,0x28008a25,0x10201000,0x61601800,0xbac5bb48,0x81e4b2e7,0x20801800,0x20001820,0xd3889a44,0xba82ba62,0xba20c2a3,0xba83c282,0x6920bb28,0x18202000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x10001061,0xd4af8a64,0x180061c4,0xb44f3000,0x5100c4cf,0x61e41800,0xdbe9cc4c,0xeccde409,0x58a0c40d,
-0x48804820,0x00003060,0x00200000,0x41643943,0x420749c6,0x000018c2,0x736c3184,0x8c0e7bce,0xff59d636,0xff39fef8,0xacf0ff39,0x00000000,0xff5ade57,0xff7aff18,0x72c7f6f7,0x18001000,0xedd3a3cc,0xcbeadc6c,0x28009b09,0x930a2000,0xd3a8cbea,0xd3ebc346,0xa2e7c3eb,0x7a039264,0x08003921,0x61013000,0x92229224,0x71e28a00,0x08001820,0x692148c1,0xab289aa7,0xd3eacc0c,
-0xcb47dba9,0x7183cbcb,0x10001000,0x92a8b3cd,0x10001000,0xb38b9266,0x00004922,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20600020,0xab082800,0xdb46dbc9,0xcb04d324,0xd325d325,0xcba8cae3,0x100071c2,0x20221842,0x81a12800,0xc2e4baa4,0x6160bb88,0x10401000,0x20002062,0xdbc79a43,0xdb01db23,0xd345db44,0xd40be42a,0x10004840,0x10001860,0x828582a6,
-0x08001800,0x20c11020,0x08000000,0x8c0d62a7,0x00210000,0x08000840,0xf651bcec,0xc46cfe52,0x28823840,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x40600000,0xd32799e2,0xcbaadb88,0x180092a7,0x00001860,0x39240800,0x20202000,0x20c128a1,0x20c120a1,0x000020c1,0x08000000,
-0x10001001,0xbb694840,0xe327dbaa,0xdb06e327,0xcb89e388,0x20008226,0x20202041,0x9aa52000,0xd387d3a8,0x6942cbeb,0x20611800,0x60e01800,0xdb45d3a9,0xd281d2a2,0xeb87eb66,0xd345e386,0xb329d3c9,0x18202800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18001041,0xd5108a44,0x10007288,0xac2d2800,0x50c0c4ae,0x38c01000,0xdc6dbbcb,0xd4aee4ce,0x18006183,
-0x10001800,0x08600000,0x00000840,0x10001000,0x08001000,0x08400800,0x00000000,0x00000000,0xbd100800,0xe54fedd2,0x93caedf2,0x00000800,0xee12c510,0xedafed8f,0x61e0dd8f,0x82c91800,0xcb25e4cf,0xec6cd324,0x2000ab8a,0xabcc2000,0xec4aecad,0xdcadec6b,0x18008286,0x20002000,0x10210800,0x18200800,0x08000800,0x10201820,0x00000820,0x10400840,0x28001000,0xd48d8aa6,
-0xe40cd389,0x71a5d40e,0x18001000,0x9286b3ec,0x08001000,0xbc0dab8b,0x00003060,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x08000060,0xd40c6941,0xebc7e3e8,0xec07e3c6,0xebe8ec08,0xec4be3a7,0x3800b389,0x18202000,0x7a241000,0xe3c6d3a8,0x9a83dbe7,0x18402000,0x18001021,0xd3ea71a1,0xeba6db86,0xcb04db66,0xd42cd387,0x18004020,0x10001000,0x10002000,
-0x18e21020,0x18a118c1,0x20a028e1,0x00000000,0x00010042,0x08001883,0xdd8ea44a,0xb40ae58f,0x20812820,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x40a00800,0xcae599e2,0xc347c282,0x20008265,0x00001860,0x00000000,0x20402040,0x18002860,0x08001000,0x10401860,0x00001061,
-0x10000001,0xa3082800,0xd2a4c2e7,0xdae4dac4,0xaaa5db67,0x20203000,0x18001800,0xbb4771c2,0xcb04cb25,0x30008160,0x08002020,0xa34a1800,0xe324dba8,0xe2e2e303,0xf386eb45,0xe3c7e365,0xcc2ce409,0x100069e5,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x10000820,0xac0d7245,0x180038e0,0xb40c2000,0x7a22e571,0x20001800,0xb40d3800,0x3000b3ec,0x10001800,
-0x730a6267,0x00003984,0x73090800,0x8ae7938a,0x72a78b28,0x08002040,0x51e530e1,0x080049a3,0x20000800,0xe54fbc4b,0x40e0abca,0x18601040,0xc46b48c0,0xdd0be56e,0x59c0ccec,0x936c1000,0xd366d40c,0xe46be3e8,0x2800ab48,0x69c41800,0xcbc9bb8a,0x8a23cbea,0x08001800,0x18002800,0x08001000,0x08000800,0x10000800,0x10001000,0x08200800,0x10000800,0x18001000,0x82232000,
-0xd3eccbcb,0x2000a30a,0x20001000,0x81e1ab48,0x08001800,0x9b6b7a46,0x080130c2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000861,0xcb899ae8,0xdb43cb03,0xd323db44,0xd324d344,0xd325db23,0x7a03cbea,0x20411800,0x30001000,0xdb64c346,0xc367d364,0x18006100,0x20401000,0x82022000,0xd2c3d367,0xcaa3d2e4,0xd44cd367,0x10003820,0x00000000,0x10620801,
-0x104010a2,0x10000800,0x18001000,0x18e220c1,0x00000001,0x08001882,0xfed6bd30,0xac2bf653,0x18a11800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x28000000,0xe42a9a42,0xe4cdec4a,0x1000934a,0x00001840,0x20830821,0x304028a1,0x93073800,0x50e0abcb,0x10201000,0x00010000,
-0x08000021,0x8ac81800,0xd2e6c369,0xdb24d2a2,0x7180cb88,0x10201800,0x38600800,0xbb059aa6,0xc327bac3,0x28008a05,0x08002061,0xb40d2000,0xdb04dbea,0xeb45e324,0xf3c7f386,0xf44afc4a,0xe4eeec6a,0x00007a87,0x00001081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x392230e2,0x18000000,0xfe14a369,0xf5f3fdf3,0x18007aa7,0x20601000,0x080028a1,0x9bab1800,
-0xfeb7ee35,0x10009c0c,0xb48f1000,0xed2cf5b0,0xd56fedaf,0x100051c3,0xd55082e7,0x9bcacd4f,0x08000800,0x8b6b5163,0x10001000,0x08000800,0x41001800,0xd5b1ac6c,0x51c2bd2f,0x7b2c0800,0xcbcad510,0xdc2adc2a,0x7160cc0a,0x10001800,0x9bcc48e0,0x20007266,0x62041800,0xcccfccef,0x100051a3,0xa2e96142,0xc389bb8a,0x9aa5bb68,0x18002000,0xab6a5900,0x7183b36a,0x18002000,
-0x7a467a46,0x10001800,0x8a252800,0xaaa4b2e5,0x180050c0,0x39441800,0x00001040,0x00000801,0x00000000,0x00000000,0x00000000,0x00000000,0x10000820,0xbb6769a1,0xcae1c2e2,0xdb66d365,0xd324d324,0xcb24db03,0x69c2bba8,0x28611000,0x71c31800,0xcac4c306,0xcb46c2c3,0x5080a265,0x10611000,0x38600000,0xba83aac6,0xd304d2e4,0xd46ddba8,0x08002000,0x00000000,0x10620001,
-0x10000800,0xdd53a3cd,0x28008a87,0x10401000,0x00000000,0x00001081,0xcdd4736a,0xb4d0ff7a,0x10810800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x10000800,0xcc2b8a44,0xa348cc4b,0x08004942,0x10010800,0x18001822,0x71813820,0xe4ceb388,0xd42decee,0x200092c7,0x08200800,
-0x00000000,0x18000800,0xaaa67162,0xcb67d368,0x20009aa5,0x10201820,0x7a051000,0xb262aa85,0xb284ba82,0x5080ab29,0x18611000,0x69a41000,0xdb67cbca,0xeb45e305,0xeba6eb65,0xec29e386,0xb3a8f50d,0x18c11800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x6a460800,0xfdb2ed92,0xfdd2fd91,0x59e4dd72,0x00200800,0x00000061,0xe5d27ac7,
-0xe570edb0,0x2000a3eb,0x9b692000,0xfd8de4cb,0xd54eed4c,0x08005a24,0xdd708b07,0xe633e5d1,0x00008bad,0x00000800,0x08200820,0x7b8b9c90,0x10001000,0x51e230a0,0x184049c3,0x30e30000,0x61206a05,0x89e168e0,0xc48dcc4b,0x100059c3,0x10000800,0x10000000,0xccae61c3,0xe50eed2e,0x200061e3,0xcb8a68c0,0xf409f44b,0xcba9f46a,0x20003820,0xcbc97980,0xbb89d388,0x10005984,
-0x10001000,0x30600800,0xb2c69aa7,0xc2e5c2c4,0x30009a86,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18000800,0x9ae52000,0xd365c366,0xd303d365,0xd2e3cae3,0xd387caa1,0x200092a4,0x18002020,0xa3083000,0xcaa3cb47,0xc2c4cac4,0x89c3cb48,0x08201800,0x10000861,0xa2a66941,0xcb88b284,0x8225b327,0x00001800,0x08200020,0x10000800,
-0x8a665963,0xdc8ec3cb,0xa2c7d44d,0x18006120,0x00200800,0x10810000,0x00000000,0x7b8c944f,0x10a10000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08000820,0x82e859e5,0x180048c0,0x08200000,0x18000800,0x79e53020,0xd346b2c6,0xec28e408,0xf42ae387,0xab06e40a,0x080048e0,
-0x08001000,0x08000800,0x38201000,0xa32a8226,0x10005122,0x10001020,0xa2864840,0xba61aa21,0xb241ba61,0x8a45aaa5,0x18002000,0x20001821,0xdba9a285,0xe325db05,0xeb86eba6,0xe3c8f3e8,0x7223dcad,0x10800800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20411001,0xbc4f1800,0xd387dc2c,0xd3a8e3c8,0x8b08d4ad,0x21030800,0x080010c3,0xdccc9b69,
-0xe4cde48a,0x28008aa6,0x9b692000,0xfe94e4ed,0xf695fef6,0x00005a87,0xfef893cb,0xff7aff18,0x5249eefb,0x31231000,0x94b10000,0xf73aff9c,0x2000ac6f,0x18002000,0x00001000,0x08001000,0x18001000,0x28002800,0xa3cb48c0,0x5163ac6e,0x20a21000,0x28001060,0xdc0abbca,0xcbe8d364,0x18005141,0xcb6868c0,0xeba6eba8,0xcb67ebe7,0x20004020,0xcb668180,0xc366cb02,0x28009b4a,
-0x28812020,0x9b6b0800,0xba20cbca,0xc283c261,0x9288baa7,0x00201000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x18210000,0x50e01000,0xc325bb68,0xd2c1d303,0xc280ca80,0xc347d2e4,0x08005100,0x20002061,0xd3a981a2,0xc260cb04,0xcae4c261,0xaa84cae4,0x08004080,0x10001861,0x82881800,0x7a0592e8,0x18002000,0x00001020,0x10000000,0x8a244080,
-0xd347cb8a,0xca82c2a3,0xebeadb46,0xa2e7dbea,0x00201800,0x00000021,0x104020a1,0x00000000,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08000000,0x08000800,0x10400800,0x00000820,0x10001020,0xab4a3820,0xdb04dba9,0xdb02d2c1,0xdac2dae2,0xbae4d2c1,0x18008265,
-0x08001820,0x08010801,0x08001042,0x18001800,0x08201000,0x10001040,0xaac68205,0xbaa3b2a4,0xbb05bae4,0xa2e7b2e5,0x10005943,0x18002082,0xc3694820,0xdb47dba9,0xdba7db87,0xcba9d346,0x18008a65,0x00001880,0x08000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x18000800,0x7a262000,0xd3eabb69,0xc3a9d3a8,0x280092c6,0x10003040,0x20000800,0xab673000,
-0xdcaddc8b,0x20009b29,0xa3ec1800,0xf5b2c42c,0xd593fe76,0x00005227,0xee9772c9,0xe677f6b8,0x0000a4b2,0x08001000,0x52a80000,0xf6f8c5d4,0xb40cee55,0x8ae98ac7,0x10005a06,0x41431000,0x69e36a25,0x200061c5,0x38e01800,0x49017ac8,0x08001800,0x18000000,0xe44ca2c7,0xcc2adbe8,0x18004920,0xc3896100,0xec09ec2b,0xcbcae429,0x200048c1,0xd40a81e3,0xcc2adc08,0x100069c4,
-0x18201000,0x72241000,0xd3a8cbea,0xd3aad3a9,0x8a47c38b,0x08811000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x08010001,0x20001820,0xcc0a92a6,0xdbc8dbc8,0xd3c8dbe8,0xa2c6dc2b,0x18a11800,0x30200000,0xdc0abbcb,0xd3a7d3a8,0xcb67cb47,0xc388cb66,0x18007a66,0x10001000,0x39030800,0x18004102,0x10421000,0x08200000,0x10001020,0xcc0b9b28,
-0xdb67d388,0xdb86db87,0xe366e386,0xc389ec2a,0x00001800,0x00010842,0x10400000,0x008010e2,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000000,0x10000800,0x00201061,0x00200000,0x10000800,0xab492800,0xe3a7d3a8,0xe3c8e3e8,0xe3e9ec2a,0xe46ce408,0x18009308,
-0x00002060,0x08000800,0x08000800,0x08001861,0x08400820,0x30800000,0xc3ebab8a,0xc3eacc2c,0xc3eac3ea,0xcc8fcbeb,0x080093ad,0x18400800,0x82661800,0xcb68bb69,0xe4cde4ac,0xb40cdcee,0x08002000,0x00200861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001080,0x61c33900,0x720469a2,0x20003880,0xabad4020,0x28007a68,0x20002000,
-0xabcb9328,0x10006205,0x6a680800,0x93089b6a,0x8b4a8b08,0x100038c3,0x9bcc4101,0x59c5a3ed,0x08000800,0x7aea59e5,0x08000000,0x934a2860,0xd4adc48d,0xdd10dcce,0x1800ac2e,0x934a1800,0xcc0ad46d,0x9b6bd48e,0x10001800,0x10001000,0x8b8c3040,0x00003963,0xa3ed1800,0xc4aed530,0x08004983,0xabcb5140,0xcc0cc40b,0xc4aed4ae,0x10004143,0xccf07205,0x8ac7cccf,0x18401000,
-0x100028a2,0x10000000,0xc48e7a65,0xc46fc44e,0x10008b0a,0x00000800,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x10001020,0xc48f48e0,0xdccedcf0,0xd4cfdccf,0x69c3c44d,0x08400800,0x52280000,0xbc2cac6e,0xc42cbc2c,0xcc4dc40c,0xc46dc42b,0x4962ac4d,0x18400800,0x00001021,0x18401000,0x00010842,0x10420000,0x10001021,0xe551ac0c,
-0xed2fdcee,0xed0ee4ee,0xe46cecee,0xc3aaec6c,0x08201800,0x00000001,0x00000000,0x10400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000021,0x08000000,0x20411800,0x08001000,0x08200000,0x20600000,0xa38a2000,0xec6ad44a,0xf4cdfd2e,0xfd4ffd2f,0xe4adf4ac,0x18009b4a,
-0x08201860,0x20811000,0x00001820,0x00000840,0x00000020,0x51a40000,0x8a847a24,0x71e38265,0x71a16140,0x7a4679e4,0x08006226,0x10401020,0x28200800,0x69206121,0x8ae68a64,0x59839329,0x00010800,0x00210000,0x00010022,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x41e50840,0x08000000,0x10001000,0x18001800,0x38a00800,0xdd31a38a,0x3800c46f,0x10001800,
-0x20002000,0x10001000,0x10001821,0x30002000,0x20002800,0x18001800,0x18002000,0x20002000,0x51e41000,0xa3ecac4e,0x10005a06,0x51001800,0xa2c49ac5,0x9ae5a2c4,0x180082e8,0x69e31000,0xe44bc388,0xabaacc0b,0x08006a47,0x102018c1,0xac4d7ae8,0x18008b6a,0x39210800,0x6a257266,0x08002040,0x38802020,0x50c04060,0x51825920,0x00001040,0x51423080,0x10005183,0x000020a1,
-0x942e51e6,0x080062a8,0x28001000,0x18002000,0x10400800,0x10400000,0x00000800,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x08210000,0x08000000,0x38601800,0x51005941,0x408048c0,0x18003820,0x00001040,0x08200000,0x10001000,0x20002000,0x69a32800,0x51207203,0x5a056224,0x00002060,0x10420000,0x00001020,0x00000000,0x00000800,0x08000800,0x82e772a7,
-0x8ac68ac7,0x9b6882a5,0x92848a84,0xb3aadc8d,0x08401800,0x00000000,0x41a520e2,0x08003123,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18000800,0x28002800,0x59c42000,0x000030e2,0x18400000,0xa3ca2000,0xaae0ab65,0xecacdc08,0xfd70f4ee,0xbb88f4ed,0x100071e4,
-0x00200820,0x41640800,0x28e149c5,0x00410820,0x00200020,0x49c51060,0x59c15140,0x10003080,0x18001800,0x10001000,0x00001000,0x00000800,0x00001001,0x18001000,0x10001000,0x10001000,0x00011042,0x00001082,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0x83290800,0x92e8bcaf,0x59225080,0x28204922,0x6a661000,0xed91c4ad,0xb3aac3ea,0x38809369,
-0x40c04900,0x08002000,0x18001800,0x40002800,0x20002800,0x00001000,0x00000820,0x08000000,0x936751a0,0x9306a367,0x59c3ac2d,0x49001800,0x820071a0,0x9b4892a3,0x00005a05,0x40e01000,0xdcad9ae6,0x9262b346,0x5162abec,0x41620800,0x930582e6,0xabc9bc0a,0x10002000,0x10001800,0x08200800,0x08000000,0x10001800,0x10001800,0x00000000,0x10000800,0x08000800,0x49c30800,
-0x93eb59e3,0x52238baa,0x28c05203,0x08001820,0x10800000,0x39643143,0x00000800,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400881,0x10200800,0x08000800,0x08001000,0x08001000,0x08200000,0x00000820,0x10401040,0x10201020,0x10001000,0x30c01000,0x39232060,0x00001040,0x00000000,0x10001820,0x6b0b41e6,0x08000800,0x00000020,0x10000800,
-0x10001800,0x20201000,0x28003060,0xb40dc46d,0x08401000,0x00000821,0x41c418a0,0x49c55a26,0x00002081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x28601020,0x71c34060,0xabec9b08,0x000051c5,0x10401061,0x8b271000,0xc428bc6a,0xdc09d3c8,0xfdd2f570,0xc40afdb1,0x100069e4,
-0x00000861,0x39421000,0x49a351c4,0x000020a1,0x00000020,0x20800800,0x5a455225,0x10202080,0x28821000,0x28c120a1,0x28a028a0,0x20213081,0x08420000,0x10420000,0x28e41862,0x206030e2,0x20211000,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18600800,0x7ae80800,0xf614edf4,0xbc70d4d1,0x08009c0e,0x5a450800,0xd4eecd50,0xdd51a306,0xe614f676,
-0xc511d593,0x10007b0a,0xac700800,0xa327b3cb,0x7265aba9,0x00000000,0x422518e1,0x49c14224,0xa3c98327,0x9306a367,0x59a3a3cb,0x51631800,0x8ae59baa,0x7ae79347,0x00001840,0x61e50800,0x9ae78266,0xa368a306,0x5183a40c,0x31010800,0x9b478307,0xe550c44b,0x7ae7ac4c,0x5a067b08,0x00001841,0x4a460000,0x51c16ae7,0x414251c3,0x00000000,0x41c62903,0x20e12102,0x6ac75205,
-0x38e06aa6,0x5a2351a0,0x5a8762a7,0x39a53985,0x41e34a46,0x28a149c4,0x08210000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x20e220e3,0x08600000,0x08400000,0x106110a1,0x10620822,0x08400020,0x08000000,0x00000000,0x00000800,0x00200000,0x08210821,0x314418a2,0x20c23985,0x00000020,0x00000000,0x39433102,0x41a53964,0x00000000,0x00000021,0x314528e4,
-0x28c21861,0x39833123,0x49623100,0x6a055982,0x00001000,0x00000000,0x396220c0,0x5a0651a4,0x00002902,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x49021000,0xb3697a25,0xbbebcbea,0x000059e5,0x08600060,0x6a450800,0xc3e9bc6c,0xc347c367,0xfe54f5b1,0x8ae6edd2,0x10002800,
-0x00000021,0x49a32080,0x49a249a2,0x100051c5,0x00010000,0x08000800,0x296339c5,0x08000000,0x28602040,0x40e038e1,0x200038a0,0x18002000,0x00000000,0x10000000,0x10000800,0x20001800,0x28002800,0x82e969c3,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x18200800,0x51e40800,0xd551ddf4,0x7aea7a66,0x00006289,0x39630000,0x7ae793eb,0x8b2961e3,0xa42d9bed,
-0xddb2bcae,0x10008b49,0xe6351000,0xcb87e4ee,0x9b28dc8d,0x00001800,0x73093122,0x62256245,0x93ab8329,0x7ac79bcb,0x30a16a67,0x39240800,0x8bccacd0,0x08005a46,0x08000800,0x6a0559e5,0x722582a8,0x83297a86,0x2902730a,0x20810000,0x8b6a72e9,0xbc6da3ab,0xb4aec510,0x93cabccd,0x10211800,0x52241860,0x93a793a8,0x62448305,0x00000000,0x528739c5,0x39c42963,0x51e551e5,
-0x31033964,0x41633901,0x31433943,0x4a053143,0x62c662e7,0x30e05a04,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4a262902,0x000020c0,0x00000800,0x00000000,0x08020000,0x00000000,0x10200820,0x30a028a0,0x30e02020,0x08002080,0x00000021,0x10810000,0x00002943,0x00200000,0x08000000,0x39233964,0x28e31840,0x00001860,0x00200000,0x31452103,
-0x31231881,0x39833984,0x39413942,0x30e151e5,0x00001062,0x00000001,0x41a31020,0x49a451e5,0x00003103,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x48e01800,0xaac679a3,0x9aa4b2c4,0x10405162,0x00000880,0x10001040,0x92c53840,0xcc6d9aa5,0xddb3f655,0x18008307,0x10001000,
-0x08000821,0x51622000,0x496051c2,0x59e48b49,0x10420000,0x00000801,0x00600040,0x10000000,0x618340c1,0x69807a65,0xabaa8ac5,0x8268a32a,0x08001000,0x00001020,0xb51341a6,0xabcab48f,0x9ac6a349,0xa3aabbeb,0x00201000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x39220800,0x41009c4e,0x18002000,0x10400000,0x08000800,0x18001800,0x20002000,0x20001000,
-0xdd924880,0x10007ac7,0xd5931000,0xc346dc6c,0xab8acc0a,0x00001000,0x6a874183,0x180040e1,0x18001800,0x20002000,0x10001000,0x00001001,0x10000800,0x10200000,0x5a270000,0x72667ac8,0x200059e5,0x08001800,0x00000000,0x10000800,0x20002020,0x28002800,0x18001800,0x83277281,0x08002840,0x418028e1,0x9bc77260,0x62238b25,0x00000000,0x39c43184,0x00000000,0x10001000,
-0x00000000,0x08000800,0x00000800,0x08001000,0x73281000,0x08007b4a,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x52662901,0x628649e3,0x49e54a04,0x39a541c4,0x00001882,0x08410021,0x41a30000,0x72a572e6,0x82e87ac7,0x28606a46,0x00000000,0x00200020,0x00000020,0x00000040,0x31020000,0x392349c5,0x312330e2,0x00000800,0x00000020,0x10200000,
-0x20a11881,0x28e13963,0x31223101,0x20c22922,0x00010000,0x00000000,0x41822080,0x49c530e0,0x000030e2,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0x59432000,0x92038205,0xe530a2a4,0x1000a40d,0x10400800,0x08000801,0x10000800,0xcd9359c4,0x10009c4f,0x18400800,0x20421000,
-0x20002020,0x59825142,0x59c159a2,0x7b079388,0x10400800,0x08010800,0x00000000,0x38810800,0x9aa76101,0xbb669a83,0xe4abd469,0xc38bdc0a,0x180071e6,0x08601880,0xc5930000,0xc3a8f614,0xcbe9c367,0xa348d42a,0x08401000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08000800,0x08000000,0x28201000,0x18001000,0x20400000,0x61605981,0x490050e0,0x200030c0,
-0xcd1250e0,0x1800936a,0x6a880000,0xcc2cc44d,0x7a67c42d,0x00000000,0x5a463962,0x100028a1,0x18001800,0x18002000,0x00000800,0x10000801,0x10001000,0x00001020,0x7b2b1820,0x49837b2a,0x00000000,0x39022000,0x08001000,0x10001000,0x18001800,0x10001800,0x08000820,0x6a8538e0,0x08003902,0x39211840,0x830572c5,0x39206243,0x00000000,0x318431a5,0x08200000,0x20002040,
-0x10600800,0x10000800,0x28c10000,0x10003922,0x31430000,0x080049c6,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000821,0x6ae73983,0x5a2351e2,0x49a26245,0x49c55205,0x00000820,0x00000041,0x62860800,0x83257b06,0x7a637a83,0x61e282c5,0x00201000,0x00000000,0x00000000,0x00000041,0x49c42080,0x312049e4,0x396241c3,0x08000800,0x00000820,0x00000000,
-0x10200000,0x28801820,0x104028a1,0x00000000,0x00000840,0x08000800,0x49e341a2,0x414330c0,0x080028e2,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x50a03040,0xdcf07982,0xfe34f591,0xa3ecee14,0x10003880,0x082220a3,0x08400021,0x00000800,0x00000000,0x080018a2,0x10001820,
-0x72675163,0x61c369e5,0x62015980,0x93679366,0x080051e2,0x08011821,0x00000000,0x38202882,0xdc6d8a45,0xeccbd42a,0xdbe6dc47,0xd368db87,0x3800b34a,0x18e10800,0x6a660000,0xcbc8edb2,0xdbe8c325,0xb388d3e9,0x00001000,0x00000862,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08001861,0xcd319bcb,0x100093ac,0x59e30800,0xc42bccae,0xd530dcce,0x10007b2a,
-0xac0e3800,0x832addb4,0x00000800,0x9b4b69e5,0x18005962,0x31210800,0x5a4662a7,0x08001840,0x6a462820,0x7aa77a86,0x18617b2b,0x18200000,0x6a656224,0x08003922,0x41850800,0x08005206,0x28800800,0x82e97ae9,0x08006266,0x41430800,0x82a782e8,0x62467ac8,0x00001060,0x7ae74981,0x18005a05,0x08002060,0x7b295a04,0x08004162,0x18a10820,0x18803964,0x18c20000,0x626651e5,
-0x39416265,0x18613103,0x52260000,0x836a834a,0x000020a0,0x10000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x62853961,0x5a016242,0x622551a1,0x28c051e4,0x08600000,0x00000000,0x6ac63120,0x8b668ba8,0x8aa27261,0x8b258280,0x08004980,0x00000840,0x08610000,0x00000000,0x51e53902,0x49e43962,0x394041c2,0x49a46266,0x08000800,0x00001020,
-0x00000000,0x18201000,0x00000800,0x08400020,0x00000000,0x31001840,0x51e25a23,0x49834161,0x080028a1,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x58e038a0,0xbbaa7140,0xe50edcad,0xed50ed2e,0x59a1c46d,0x00000800,0x08010800,0x10400800,0x108218a2,0x00000020,0x7a872000,
-0x618182c7,0x51815120,0x72426202,0xa386abc8,0x308082e5,0x10210800,0x18610000,0x59421800,0xc367b369,0xc366d3e9,0xfccce449,0xcb26db87,0x9aa5cba8,0x10801800,0x10001861,0xe4ceb3cb,0xcb25bae5,0xab27cb66,0x00001000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0xa3ed1000,0xed4fe550,0x48e0d511,0x61c21000,0xecacdcad,0xed2fecac,0x18009bcd,
-0x9b8b2800,0xee76ee34,0x00006ae8,0x10001800,0x10001800,0x832859e3,0x62257b07,0x18000800,0xb3cb50e0,0x9b47dd30,0x39419beb,0x30c00000,0x932682c5,0x40a08b28,0x00001000,0x08000800,0x934940c0,0x9b288aa5,0x08008328,0x6a451000,0xb386aba9,0xbc6dbbe9,0x08001000,0x8b4859c3,0x62636a83,0x08003100,0x00000000,0x00000000,0x4a050000,0x20606287,0x18a00000,0x83266283,
-0x41006a64,0x10003903,0x62a70800,0x83a95a22,0x0800836a,0x08001860,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x5a443120,0x6a845a21,0x51c35a03,0x08003921,0x00400000,0x10400000,0x6a8449c2,0x72c472c5,0x82a17261,0x9323a3a5,0x10206a43,0x00210000,0x00000000,0x18600800,0x39004142,0x28e128c0,0x38e049a3,0x72c75160,0x28e16aa8,0x00000000,
-0x00000020,0x00000000,0x00010001,0x00000000,0x41c20800,0x49a151e3,0x41805222,0x41414160,0x100028a1,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x59003040,0x9a427100,0xdc6abb66,0xb304cbc7,0xb44cbbc9,0x082072e9,0x00001042,0x08400000,0x00000000,0x10200020,0xbcaf72a7,
-0x40609b8a,0x59c259a2,0x722159e1,0xa345b3e8,0x6a23abe9,0x18621000,0x08000820,0x8b091000,0xdc6ad46c,0xd409e4cc,0xec8be44a,0xe46be40a,0xdd0eecab,0x00005a05,0x20001841,0xed306960,0xbac3d3c9,0x9264bac4,0x08421800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18800020,0xcd321000,0xd44afdd1,0x5961c46e,0x72441800,0xe408dcac,0xf52fd365,0x1000b44e,
-0x9b8b2000,0xfef7ee14,0x5247de57,0x18820000,0x49a30000,0x93278b28,0x6a867264,0x10001000,0xcc4c79e2,0xa326c40a,0x30a09348,0x30c00800,0xa3668b05,0x9329a348,0x000049a5,0x08000020,0xb3eb8b29,0xb40aa326,0x18009389,0x72a71000,0xd449c42a,0xb3eacc29,0x08004101,0x830659c2,0x9be96a20,0x18208369,0x00010820,0x31650000,0x73085205,0x28c072c7,0x29010000,0x7ae46283,
-0x51a261e1,0x30e249a5,0x5a450800,0x49a07b46,0x41836aa6,0x00000800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x6ae741e4,0x6a8372a5,0x49a24960,0x000049a4,0x00000060,0x39620000,0x51a051e2,0x62215180,0x82c16a40,0xa3c6bca9,0x39218b89,0x00220000,0x00000000,0x31011040,0x38e04982,0x186028a0,0x626549a3,0x49204940,0x6ae972e8,0x00001060,
-0x00200000,0x00010021,0x00220023,0x31630000,0x6b285265,0x62856286,0x51e17306,0x51c351a0,0x102028a1,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x50c02800,0xcc4b7120,0xc3c8d44b,0xdccddc8c,0xbccfccce,0x00007b6b,0x00200020,0x00000840,0x08210000,0x20610000,0x9c2d72e9,
-0x5160a40c,0x59e25181,0x82c459c0,0xbba7bbc8,0x938ab40a,0x18a228a0,0x10401061,0x72c70800,0xcc48bc08,0xbb66c3e7,0xbb04bb24,0xf54fd42a,0xac0af5b0,0x10411800,0x51830800,0xd40ae571,0xf4addc0a,0x7980d3ea,0x00211000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08600020,0x8b490000,0xedb1d4ee,0x2800b44e,0x9b892000,0xfd6ff5d1,0xed70fd4e,0x1800bd11,
-0x9b6b2000,0xf655e5d2,0x7b8deeb9,0x29030800,0x49a30000,0x8ac782a7,0x5a057aa6,0x18001000,0xcbea8a65,0xab89cc2b,0x40e09b69,0x41a40800,0x93059369,0x9b8babca,0x00004185,0x10000863,0xbc2d7288,0xab88b3c9,0x6a25b44d,0x62250800,0xcc69c48c,0xd52eccaa,0x0800836a,0x728438e0,0x8b057260,0x49c48b6a,0x08610000,0x4a270000,0x6a657b09,0x28c051e3,0x20c10000,0x6a8451e3,
-0x520349a0,0x000062c8,0x62a60800,0x5a427326,0x51e65a25,0x08400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x49e30000,0x51c06aa5,0x522449a0,0x00003942,0x00400000,0x41a50000,0x49405a04,0x83476a43,0x7ac27281,0x93a88b44,0x10006a86,0x00010800,0x00000000,0x41a41840,0x624451a2,0x100041a3,0x6a6549a2,0x51a16244,0x62a86286,0x00001881,
-0x00200040,0x00000000,0x00000001,0x41e50000,0x52245266,0x5a4649c4,0x5a026ac6,0x59c46203,0x10002020,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x72042840,0xa30679e3,0xbc0ab388,0xbc6db3ea,0x61e4ac2d,0x08001000,0x080020a1,0x08000000,0x18211000,0x08000800,0x62660800,
-0x59c3836b,0x62035161,0x93055980,0xbb87c3e9,0x6a65b3ea,0x08200800,0x08200000,0x20200000,0xcc49b42a,0xbb65c3e8,0xb304b304,0xf570cbe9,0x3880ccee,0x21040000,0x8b4a0000,0xdc2afdf3,0xec8cd368,0x9ae6fd50,0x10821800,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18001880,0xfeb692e7,0x18009bab,0x82e81800,0xf5f2ee34,0xe571f5f2,0x08009c2d,
-0x7ae91000,0xfed8ee55,0x08008bcd,0x080028a1,0x08001040,0x9bcc59a4,0x41636a87,0x10000800,0xcc6d8266,0xa36add51,0x30809369,0x30e20800,0xa3aa936a,0x40809329,0x00000800,0x08000000,0x8ae81800,0x92c6a389,0x59829348,0x10000800,0xa3879baa,0xc52fa3a6,0x08006287,0x72c630c0,0x726472a4,0x10004941,0x00000800,0x18400000,0x520351e3,0x31425a46,0x20a20000,0x522449c4,
-0x522549c3,0x00004205,0x5a450000,0x72a56aa4,0x08006aa8,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39620000,0x5a005a23,0x49e151e0,0x08004182,0x00200000,0x20a20000,0x62446246,0x51a059c1,0x7b0372a3,0x62437b04,0x00001000,0x00001841,0x08000800,0x31220000,0x7ae77b28,0x51a051a0,0x51a06222,0x5a456244,0x08003962,0x00000000,
-0x00000020,0x00000020,0x08410020,0x08000000,0x31201860,0x41834163,0x5a035223,0x59c46a44,0x10201800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x69e53880,0x59207205,0x62025960,0x28a06244,0x10001000,0x30602880,0x59c33040,0x62047265,0x080038c0,0x08200800,0x08000800,
-0x41630000,0x61a259a2,0x9b4769e1,0xc40ac3e8,0x0800ac2c,0x10410000,0x00000820,0x080018c2,0xcc6c82a5,0xd429cc09,0xc366c387,0xcc0acb87,0x18007a45,0x10801060,0xc5300800,0xd387fdf2,0xd367db67,0x9aa4e44b,0x10201800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x20200800,0xcd313000,0x10009bed,0x30e22040,0x59c459e6,0x620461a3,0x000049c4,
-0x18400000,0x62886288,0x00000000,0x7b0930a0,0x08003121,0x39841000,0x21032944,0x08000000,0x7ac84121,0x59c582c9,0x206051c4,0x30a10800,0x82e8934a,0x18002000,0x5a251800,0x30a07ae8,0x08000000,0x8ae759c3,0x59e39baa,0x08000800,0x51a35a06,0x62a74140,0x00003185,0x52061020,0x394249e4,0x08001000,0x41a420a0,0x08003101,0x31422060,0x18a039c4,0x18800000,0x30e13943,
-0x524649a4,0x08202902,0x6aa60800,0x72648327,0x000049e5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39a40000,0x51e049a1,0x52005a40,0x30e05a24,0x00000000,0x00000822,0x5a643100,0x62225a03,0x5a206261,0x39816ac5,0x00210000,0x08200000,0x00210000,0x00000021,0x8b476a65,0x93259346,0x83058ae4,0x29216aa6,0x00400000,0x00200000,
-0x00000800,0x00000800,0x00000000,0x00000020,0x18600800,0x290120a1,0x5a225203,0x51a26a43,0x10411800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x516330c0,0x61c36183,0x628651a2,0x000039c3,0x206020a0,0x48c13080,0x82c769c4,0x8ae68285,0x6a248b07,0x08001800,0x08400820,
-0x08000840,0x6a0438a0,0xabca6180,0xbc0acc6b,0x000059e3,0x000018a1,0x10411041,0x18600000,0xa3892000,0xc3e8cc6b,0xbb67c3e9,0xb3aacc0a,0x08003020,0x00001061,0xe6343981,0xe42bfdf3,0xecaee42b,0x9ae5dc8c,0x10402000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20600000,0x72671800,0x18009bed,0x10001800,0x10000800,0x18002000,0x10600000,
-0x08001020,0x08000800,0x39210000,0xbcf0b4af,0x00005206,0x08000000,0x00000000,0x08200020,0x08000800,0x18001000,0x10001000,0x41220800,0x40a0938b,0x10001000,0xa3eb7286,0x7ae78b28,0x00002901,0x72a71800,0x72a68308,0x08000800,0x08000800,0x00000800,0x00010000,0x00000000,0x00000000,0x20c10000,0x6ae749e3,0x200072e8,0x10001000,0x00000000,0x00001040,0x08001000,
-0x08000800,0x08000800,0x6a851800,0x59c182e6,0x00000800,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00010000,0x20c00000,0x5a004180,0x62625220,0x51e56285,0x00000000,0x08000001,0x4a030000,0x5a235a44,0x6ac55a21,0x00003981,0x00000000,0x00000800,0x00000000,0x00000062,0x7aa54962,0xb4089b87,0x9ba8b408,0x00001000,0x00410041,0x08000000,
-0x18000800,0x52063102,0x20605205,0x08400000,0x00000800,0x20c10000,0x5a014981,0x496072a4,0x10211000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39001000,0x59825162,0x5a266225,0x00001020,0x38c11840,0x7a865962,0x72237a86,0x828382a4,0xb3eaabc9,0x40a092e6,0x08400000,
-0x00000020,0x59e430a0,0xa38869e2,0x82a4bc4b,0x10600800,0x08010801,0x00000000,0x18600000,0x48e01800,0xbc2aabc9,0x9b27a367,0x6a05abeb,0x18421000,0x000018a3,0xf6f8946e,0xd48dfe54,0xfe15ed72,0xa3eae591,0x10811000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20200800,0x72459b8b,0x10001800,0x28002000,0x7a846180,0x00003942,
-0x28602020,0x51614962,0xd5d47266,0x8b29e5f4,0x18001000,0x83295183,0x30a06224,0x08000800,0x28801820,0x51204900,0x306038c0,0x7b0838a0,0x6a24c530,0x39630000,0x9b47938a,0xa3cb82a5,0x10006a87,0x72861800,0x8b27a3ca,0x41205181,0x30c030e0,0x20603900,0x08210000,0x00000000,0x08200000,0x41c40000,0x62016244,0x8b697ac6,0x49006a23,0x100030a0,0x18600800,0x30e03920,
-0x18401000,0x18001800,0x72a538e0,0x18206285,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39830000,0x49e049e2,0x5a425a62,0x72e96285,0x000020c2,0x08011842,0x21010000,0x41e25a86,0x4a2541e2,0x08002922,0x00000820,0x49a42080,0x00001860,0x00000001,0x83492040,0xa3c89367,0x51609366,0x08220800,0x00000021,0x10200800,
-0x49a330e1,0x6a446a65,0x72a772c6,0x10203943,0x00000820,0x08001000,0x72c44980,0x6a449bc9,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20800000,0x51c44983,0x5a2659e5,0x00001880,0x28600800,0x82a661c3,0x8ae58285,0x93259367,0xb3c89b04,0x9b27bbe9,0x000030e0,
-0x00000820,0x51832060,0x93487a65,0x41209bca,0x18a10000,0x18000000,0x41627b4b,0x08001000,0x10001800,0x7aa561e3,0x51816202,0x18004922,0x00001000,0x00000841,0x8bec4a26,0x71e39baa,0x9bcc9b8b,0xb4cfcd51,0x08400800,0x00000841,0x00200000,0x00000000,0x00000020,0x08210000,0x00200000,0x08200000,0x08000862,0x8b295982,0xb4f07b09,0xc510b4cf,0xe591d52e,0x08007b29,
-0x9bcd3080,0xe614ddd3,0xfed8f697,0x2800936a,0x59a31800,0xd5719b8a,0x9baacd2f,0x00000800,0x8b4a51e5,0xac0b9b69,0xa42db46e,0x93cb7ae8,0x5a049c0c,0x31220000,0x82a672a6,0x9bab8286,0x08006247,0x7b091000,0x82e7938a,0x9bec938b,0x7ae58b68,0xa42ba42a,0x080051e4,0x5a880000,0x080049e6,0x41a20000,0x72627ae5,0x82e66a21,0x8b2882c6,0x39417b29,0x41820000,0x72a48baa,
-0x62a562a3,0x72a96a87,0x940c9c0c,0x00004182,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39840000,0x52635244,0x418149e2,0x41a43941,0x000020c2,0x00000000,0x00000001,0x084010c0,0x00000000,0x08000000,0x08001020,0x83284981,0x00004983,0x08620821,0x49c40000,0x83068327,0x39207ac5,0x08220800,0x00000021,0x39201000,
-0x49a05203,0x72846222,0x62237284,0x31025a04,0x00000000,0x08000800,0x93e951a1,0x5a028b67,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x10000000,0x416328a1,0x4a065205,0x00001040,0x00000020,0x930859a3,0x8ae592e6,0x9b667220,0xc409a346,0xb3cacc2a,0x080051c3,
-0x10200800,0x72c81000,0x8b49938a,0x08006266,0x10200840,0x7a881000,0xa3aac4ae,0x18611000,0x10200801,0x10001000,0x00000800,0x10000800,0x00000800,0x00200000,0x00000020,0x10000800,0x10000800,0x940d6aa7,0x08400800,0x00000000,0x00000000,0x00000000,0x08810000,0x08011022,0x00000000,0x00000000,0x08010002,0x41631000,0xb4d07b2a,0xee75bd52,0xdd2ee56f,0x1000836a,
-0xbcaf4900,0xfed7e5d2,0xde15ff19,0x10001000,0x9b694900,0xa325aba8,0xb42bcc8c,0x08001000,0xabec7288,0xdd109ae6,0x72a9bcb0,0x10001000,0x00001000,0x00000020,0x28600800,0x288130c1,0x00000800,0x20600800,0x30c03902,0x8b8b3922,0xb428bcac,0xd56eccca,0x10008328,0x8bab1800,0x08007b4a,0x51e21020,0x82e28325,0x72647242,0xa46f6224,0x18608bed,0x5a040800,0x9365a3ca,
-0x83668ba6,0x62287ae9,0x4a056287,0x00000800,0x00000020,0x00010021,0x08010822,0x00210001,0x00000000,0x00000000,0x00000000,0x00000000,0x39c50000,0x08204a46,0x00000000,0x00001000,0x00000000,0x00010000,0x00010001,0x00000000,0x08011020,0x10200800,0x38e01000,0x93467ac5,0x30806a23,0x00000800,0x08001040,0x72e84161,0x49e48bcb,0x10410800,0x08000000,0x6aa45a45,
-0x5a426242,0x83276a83,0x59c07aa4,0x31205a03,0x08620000,0x08000820,0xa44b5a03,0x51c28b47,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x08000801,0x08000000,0x39853143,0x00000800,0x00000041,0xabeb6225,0x92e5a3a9,0x61808283,0xcc4aa346,0xbbe9c3a7,0x00006a65,
-0x08002082,0x8bac0800,0x41218309,0x10400800,0x08000000,0x932a38a1,0xc44b9ac4,0x10007a86,0x20821861,0x20a21000,0x00201060,0x08001021,0x10600000,0x292318a0,0x292318a1,0x18423125,0x18c118a1,0x08200000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000020,0x10010000,0x00000821,0x00000821,0x00220001,0x08000000,0x10001000,0x62640800,0xd52fccee,0x100072c7,
-0x8b292820,0xfeb7e614,0xc594f6f8,0x08000000,0xbc8e72a8,0xab65a346,0xb42bb3c8,0x08001000,0x8b094102,0xb3eb9ae7,0x10007288,0x10002000,0x00000800,0x00000840,0x10001000,0x08001000,0x08410000,0x08000800,0x18001000,0x10000800,0xccec8b05,0xcd0dc4cb,0x10006a85,0x9bca2000,0x100093cb,0x49a20800,0x83258b87,0x28406a43,0x100030e0,0x10600000,0x51c40000,0x9ba7ac0a,
-0x72c58b66,0x10003080,0x00000800,0x08000800,0x00000000,0x00420021,0x08000000,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29430000,0x00002101,0x10011000,0x10401000,0x10a00840,0x082018a1,0x00010001,0x08200000,0x00000800,0x10001840,0x8b8930c0,0x9ba79ba7,0x51828b07,0x08400800,0x08400000,0x08000000,0x312239a4,0x08200000,0x00000821,0x7ae472c5,
-0x6a827ae4,0x83266a41,0x59806a00,0x41816a63,0x00000000,0x00000841,0x8b8a5a45,0x30c05a03,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00020000,0x08010001,0x00000820,0x08600000,0x00000021,0x08000020,0x8b486224,0x8b078ae6,0x8b057a84,0xb366a346,0xd48cd429,0x08007ac6,
-0x08001020,0x20a10800,0x10000800,0x08001000,0x08000020,0x934a1000,0xbbc8bc0a,0x7a65bc2b,0x08001800,0x08001800,0x08000800,0x10001000,0x20601820,0x10001000,0x08001820,0x08000800,0x00000860,0x00200861,0x00000000,0x00000000,0x00000000,0x00000020,0x10400000,0x286149a6,0x00400000,0x00000021,0x00000000,0x08200000,0x20801820,0x080020c0,0x7ac87266,0x00000800,
-0x08001020,0xe6b8940e,0xce16ff7b,0x00000000,0xddf47b2b,0xb42ab46c,0xabcbb3ca,0x10004100,0x10001000,0x59c37b08,0x08000800,0xa3ec5982,0x39019bac,0x28e00800,0x7aa57285,0x61e47a86,0x080028c0,0x41620800,0x62236243,0x10003900,0x9c2d1800,0x6aa6a46d,0x08000800,0x8b463020,0x20008b48,0x31021000,0x62456266,0x00001020,0x08000000,0x08200000,0x08001021,0xa42c8b8b,
-0x100059e3,0x18610800,0x10200820,0x00000000,0x00200000,0x00000020,0x00000040,0x30a03080,0x08200800,0x00000000,0x00000000,0x00000000,0x00400000,0x00000000,0x08001022,0x08000800,0x00000000,0x00000800,0x00010841,0x00000000,0x5a663122,0x49a15204,0x830751c3,0xb44b8ae4,0x10008b6a,0x00400000,0x10400000,0x08201040,0x00000000,0x00000000,0x00000001,0x936572a4,
-0x722082a1,0x8b257a81,0x8b057220,0x49809be9,0x00210000,0x00000021,0x080020a0,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x08200820,0x00000000,0x00000000,0x00000020,0x728559e3,0x6a2361e2,0x9b887ac6,0xcc2ab3c9,0xd4cddc8b,0x08007285,
-0x00001860,0x00000000,0x20601820,0x18202061,0x08400000,0x49630000,0xc44abc4c,0xbc0acc4a,0x8b6a8ae6,0x62268b29,0x08004185,0x28410800,0x6a052000,0x9bcb9349,0xacb0acb0,0x6245acaf,0x10a20000,0x08410000,0x00000000,0x00000000,0x00000000,0x18610000,0x730b0800,0x9bedde16,0x08810000,0x00000020,0x00000000,0x00000000,0x00000000,0x20800000,0x10001000,0x39651820,
-0x18800000,0x944f0000,0x9cb1de98,0x00000000,0x6aa73102,0x61c07264,0x93ab61e3,0x6267a46f,0x10600000,0x20600800,0x49620000,0xccaebc8e,0x82e8dd72,0x39401000,0xabea9ba9,0xa38aabca,0x080072c8,0x8b6a1000,0xa4099bc9,0x28608b89,0x08001000,0x08003984,0x20600000,0x9b668305,0x7263ac09,0x10001000,0x208028c0,0x00000000,0x49a241a3,0x62a65a43,0x00000800,0x392130e0,
-0x18400800,0x00000000,0x00000000,0x00001021,0x00000000,0x08800040,0x41820000,0x7ac7ac6d,0x08400800,0x00000800,0x00000000,0x00000000,0x00200020,0x00000840,0x20800000,0x52235245,0x5a2351e2,0x49c272e7,0x08410000,0x00000820,0x7b495a87,0x6a436aa4,0x6a436223,0x9bc96a00,0x080072c8,0x00001081,0x00001020,0x18400000,0x00001040,0x00400020,0x08000021,0xa40872c6,
-0xb3e79b44,0x8a809b43,0xabea9b25,0x49a09ba8,0x00210800,0x00000000,0x00000000,0x08220842,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10001000,0x00000000,0x10401040,0x08000000,0x00000800,0x7b0949a3,0x49816286,0x7a4361c1,0xc44b9ae5,0xc48ccc6b,0x080072a7,
-0x00201060,0x10a00020,0x08001880,0x08001000,0x00410020,0x10001061,0xbc4b8308,0xc3e7ab44,0xc42ac409,0xac0cbc2a,0x000049c5,0x30e21061,0xcc8d4040,0xfe54ed91,0xff3aff39,0xbc6cfed6,0x100040e0,0x00001040,0x00000000,0x00000000,0x00200000,0x18600000,0x8b6b1000,0xe5f3f696,0x080059e4,0x10611840,0x00010001,0x00200000,0x00410020,0x00000000,0x18401040,0x8bad1800,
-0x0800836c,0x00000000,0x00000000,0x08200000,0x00000000,0x10000800,0x08000800,0xc573ac8f,0x08006aa9,0x080020c2,0xa3cb3900,0xd4acbbea,0x8264ed91,0x49611800,0x9b269348,0xa3caa367,0x100072c8,0x82e81800,0xccababc8,0x9368b42a,0x18202840,0x00000000,0x93ca3120,0xabc59b65,0xac27cd0a,0x00004980,0x08000000,0x39420000,0x8b048b27,0xb4ac82e2,0x08007329,0x00000800,
-0x00210840,0x00210000,0x08000820,0x00000800,0x08600840,0x10400000,0x83670800,0x82e5bccc,0x08610800,0x00000020,0x00000000,0x00000000,0x00200000,0x08200020,0x51e30800,0x83456ae5,0xac2aa409,0x8326a429,0x10400800,0x00001000,0x62852900,0x7ac47283,0x62226a63,0x6a857283,0x00000800,0x00000841,0x5a261840,0x10003920,0x18201800,0x00000000,0x08000840,0xb44b6203,
-0xc467bc68,0xbc27b3e4,0xa3c9aba7,0x51c39389,0x10620000,0x00410021,0x00400020,0x00000841,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x41642040,0x30e049c4,0x08000800,0x00000800,0x00000800,0x52050800,0x62866ae9,0x69c161e3,0xabeb8285,0x7265a3ca,0x08201000,
-0x00400020,0x08000820,0x59a11800,0x836aa40d,0x08810800,0x18200000,0x9baa1000,0xbba4c449,0xc3c7bb85,0x8ac5b3c8,0x10611000,0x10001881,0xf5d19306,0xfe12e4cc,0xfed7feb7,0xdd2efe94,0x1800b46e,0x08200800,0x00000020,0x00000000,0x00000000,0x28a11020,0x93ac1000,0xf674ee33,0x1000ac6f,0x080028a0,0x08210000,0x00000021,0x00000000,0x00000000,0x08000820,0x30601800,
-0xcdd5bd12,0x00001020,0x00000800,0x00000800,0x20601840,0x72e76224,0x08000000,0x9c4e1000,0x08006ac9,0x08000800,0x8b2930a0,0xdd0faba9,0x6140d4ef,0x51e41800,0xabeaac4c,0xac2ca389,0x100072c8,0x9bac1000,0xbc4abc4b,0x9b89bc6b,0x000038e0,0x000020c1,0xacae62a7,0xbc27a3c7,0xac68bc66,0x00007b49,0x108120c2,0x72e80000,0xa362a3c8,0x8b649b62,0x00005a65,0x08400820,
-0x00000000,0x00000021,0x08000000,0x10400000,0x00000000,0x08001041,0xbcec6262,0x8b26bc8a,0x08610800,0x00000020,0x00000000,0x00000000,0x00000000,0x08000000,0x72c53100,0x7ac07281,0x9b648ae1,0x93457a60,0x08006a86,0x10001020,0x41810000,0x72617283,0x62226221,0x30c05a02,0x00200800,0x08000000,0x6a853941,0x59e272c6,0x10003880,0x08200800,0x08000000,0x6a221800,
-0xbcaa9be7,0xc48bb427,0x7aa682c4,0x100059e4,0x00001000,0x00000000,0x00200020,0x10200000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x59e52880,0x6a436223,0x41206a85,0x00000000,0x00210000,0x08000000,0x520520a0,0x8b088329,0x5a046a86,0x08001800,0x00000800,
-0x08400000,0x59202000,0xd4acab88,0xbc8dd4ee,0x000051a2,0x10001861,0x69e31000,0xcc29c42a,0xc409cc08,0x4920b42a,0x18610800,0x49611840,0xed4eccee,0xf5b1e4ac,0xff18fed8,0xe591fed6,0xa40dedf4,0x21020800,0x00000000,0x00000000,0x00000000,0x20400800,0x9bed1000,0xdd91edf3,0x08009c2d,0x202030a0,0x080030e2,0x00010820,0x00000000,0x00000000,0x00000000,0x10001842,
-0xcd934963,0x9c2ecdb4,0xad12acf1,0x080020c0,0xb48e6a66,0xe5d1ccac,0x0800a44c,0x00001840,0x20600800,0x18206ac8,0x10000000,0xb46e936b,0x59c4b44e,0x39840800,0x9beba44d,0x9bed8b29,0x08006267,0x940e1000,0xa40a9bcb,0x100093aa,0x08001000,0x00000000,0x73080800,0xb48ab48c,0xa48bbd2c,0x00003122,0x00000000,0x49c30000,0xc488ac49,0x59c0b447,0x00410800,0x00000000,
-0x00000000,0x00000000,0x00010000,0x08001021,0x31420800,0x08001861,0xc52c6aa3,0x7241bc6a,0x08620800,0x00000000,0x00000000,0x00000000,0x00010000,0x08001020,0x7ac46a65,0x9b4382a0,0x9b21a3a4,0xbc2a9ac0,0x30608b07,0x08010000,0x08000800,0x6a625a02,0x72c659e0,0x08006266,0x00001060,0x20400800,0x62635a64,0x7ac56a62,0x49437266,0x00000800,0x00000000,0x10001000,
-0x7b682080,0x8307a44c,0x18004962,0x08000000,0x08001000,0x00000000,0x08000040,0x498338e0,0x000028c2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000040,0x51623080,0x82e45960,0x9beba40a,0x00200800,0x00000042,0x10400000,0x08000000,0x6a876a87,0x00000000,0x08410020,0x00000801,
-0x08000041,0xc44d3000,0xe4cbed2e,0xd50dcc28,0x1800b48c,0x18401800,0x18002081,0xcc2a92e6,0xd4abcc08,0x10008ac5,0x20c22060,0x9c2d0800,0xfe32f654,0xed4ffdb0,0xf6d7fed7,0xfe54feb6,0xe5d3e591,0x000049a3,0x00000860,0x00000000,0x00000000,0x20a10800,0x7b0a0800,0xd592f696,0x18001800,0x62051800,0x282072a7,0x18411000,0x00000000,0x00000000,0x00000000,0x28c30000,
-0x59e41800,0xff3af6b7,0xeefaff7b,0x08003142,0xccee7265,0xe54ddccb,0x9c4df694,0x20c20000,0x93cb1000,0x93aacd51,0x08000800,0x492138a0,0x20003880,0x08000000,0x20001800,0x10002000,0x18200800,0x20600800,0x38e02040,0x10001000,0x830a1800,0x51c4a44e,0x08000000,0x38a040e0,0x20a03960,0x10001000,0x62856265,0x10000000,0xc4ca82e2,0x6a40bc68,0x10a30000,0x00000020,
-0x00000000,0x00000020,0x10610000,0x30801000,0x834993eb,0x18201000,0x9c091800,0x62009bc7,0x00410000,0x00000000,0x00000000,0x00000000,0x08010001,0x38c00000,0x936582e6,0xccc99320,0xab84e58d,0xab669ac0,0x6a668aa5,0x08210000,0x10001842,0x7ae54960,0x6ac66aa3,0x08003101,0x10600000,0x30a01000,0x72c26262,0x93667ac1,0x8b289368,0x00200800,0x00000040,0x08200021,
-0x00000000,0x10005a66,0x08000800,0x00000001,0x08000800,0x00000000,0x31001880,0x622659a3,0x000028c2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x40a03081,0xbcab7221,0xc52ecd2c,0x00003962,0x00000021,0x08200020,0x10610820,0x00000000,0x00a20020,0x10820081,0x00000001,
-0x10000000,0xe55150c0,0xf54bed4d,0xd4eae50a,0x9b86dd4c,0x18601000,0x08001020,0xc46d5962,0xdccbdcab,0x10007a83,0x20a31861,0x72e80800,0xff38f6b7,0xdd2ffe54,0xfef7fef6,0xfe33fe54,0xd550f5f2,0x00007ae9,0x00001081,0x00000000,0x00000000,0x00400020,0x52260000,0x7b2abd32,0x10000800,0xdd947268,0x8244c44d,0x10002000,0x00001841,0x00000000,0x08210000,0x20c20020,
-0x7b2b0800,0xf6d8ee97,0xcdf7ff5b,0x00000000,0xd52e5160,0xed8edceb,0xb48cfe52,0x08001000,0xd5907285,0xcceedd70,0x2800bccf,0x18002000,0x08001000,0x08002061,0x20002000,0x10001800,0x10001800,0x00000000,0x00000000,0x18001020,0xbc4d9349,0xa3cbd510,0x10401000,0x08000800,0x10000800,0x9b462000,0xd58ebc89,0x08008368,0xa4282000,0x7280cd2c,0x08411000,0x00000020,
-0x00000000,0x00000000,0x10000020,0x8b2561e2,0x9ba89b65,0x18004961,0x30c01000,0x5a4472e6,0x00000000,0x00000020,0x00000000,0x00000000,0x08010000,0x6a860800,0xa3a49387,0xc465b3e2,0x8220ab62,0xab86b3a6,0x62459368,0x08400000,0x08000820,0x7aa34920,0x5a0472a4,0x00000800,0x00000840,0x7aa52000,0x9bc59be8,0x9b229b43,0x82e59b24,0x00200800,0x00000000,0x08620042,
-0x00000840,0x10000000,0x00001020,0x00000881,0x00200000,0x00000000,0x394220e1,0x51634942,0x000020a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x38402861,0xe58e9325,0xd58fddad,0x00004183,0x00200861,0x08000000,0x00001861,0x08400861,0x002000a1,0x00000000,0x08210000,
-0x08001061,0xcc4c5080,0xed2aed2c,0xdd2aed6b,0xbc89dd09,0x000038c0,0x18601040,0x8b491000,0xdd0ce54e,0x2060ac6b,0x10220000,0x080020c1,0xff39c573,0xdd4ffe54,0xff17fef7,0xedd2fed6,0xcd30f633,0x18001800,0x00000800,0x00000000,0x00010000,0x00000040,0x00000840,0x08000800,0x10002083,0xf614c4d1,0xf5b2fdf3,0x5162cccf,0x08201000,0x00400020,0x00200020,0x08400020,
-0x62a90000,0xff5ae697,0x1020cdd5,0x08000820,0xf6549c0c,0xedf1e590,0xb46cf612,0x08000800,0xc4ce7ae7,0xdd70d54f,0xac4dd551,0x93ab8b69,0x6247a46f,0x49840800,0x9b8982c7,0x834982e7,0x08005a46,0x52260800,0x520349c3,0x938a6245,0xb3eabc4d,0xabecc46d,0x00005a06,0x4a461080,0x93c87ba9,0xe58db469,0xccc9e54a,0x28a09c2a,0x8b891800,0x72a4c54f,0x10610800,0x00000000,
-0x00000800,0x08400020,0x51c00800,0xb427b46b,0xbc69b405,0x280082c7,0x10001800,0x31414184,0x00000000,0x00000020,0x00000000,0x00000000,0x08200021,0x7ae80800,0x9b40a408,0xdd07cca5,0x9ae0a320,0xbc6abc07,0x10008b48,0x08400000,0x20a00820,0x9be97ac5,0x20607b06,0x08220000,0x00000860,0xac098b48,0xac069ba5,0xa382ab83,0x8ae4b406,0x00001000,0x00000861,0x00000000,
-0x10401060,0x08201061,0x08400840,0x00000000,0x00200000,0x00000020,0x5a4541c5,0x494351a3,0x00001861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30202861,0xedf09b87,0xc54ee60f,0x00000800,0x00000840,0x39413101,0x08000000,0x00001061,0x08000000,0x8b8b5a04,0x000049a5,
-0x08000020,0xb3a94860,0xdccad469,0xdd0bdd0b,0xdd6ddd0a,0x1000a42b,0x10401020,0x40e00800,0xe58ecccd,0x8ba9e632,0x10840800,0x00001083,0xfed87aea,0xf612fe54,0xff38ff17,0xedf2fe95,0x61c3d551,0x20421800,0x00000800,0x00000000,0x00000000,0x00200020,0x00000020,0x08000000,0x20600000,0xd4eecd51,0xf54fdc6b,0xdd51f590,0x08007b09,0x00201040,0x00000040,0x00000000,
-0x00001862,0xa5127bed,0x00000000,0x834b1000,0xde14e676,0x834a9c2d,0x836b9bcc,0x00000000,0x62453941,0x938a938a,0x83486a44,0xbceeac8d,0x7284cd50,0x72c71000,0xc468c46b,0xd54fd50b,0x180093ec,0xac6e2000,0xb44cabea,0xb48eb46d,0xa40cbccf,0x8b8b7aa5,0x00005268,0x8c0c2922,0xddefcdd1,0xedcdee0e,0xd50bd4a8,0x1000b48b,0x6a681000,0x18008b6c,0x00010800,0x00000000,
-0x10620000,0x00000000,0x9bc572c3,0xb404ac05,0xb406cca8,0x5163a3aa,0x18630800,0x00000000,0x00000020,0x00000020,0x00000000,0x00000000,0x08810020,0x39000000,0xbc66a408,0xdce6d4e6,0xa321d509,0xac29abc5,0x08206244,0x08400840,0x49e30000,0xbcce8b68,0x00008b8a,0x00201081,0x28c00000,0x9b44a3e9,0xaba58a80,0xdd2bcc88,0x9345b405,0x08001000,0x00000000,0x28a03961,
-0x08000800,0x08000820,0x00000000,0x10601860,0x00000000,0x00000001,0x6a6549e5,0x62056a44,0x00001820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30201820,0xedf09ba8,0xc54eee31,0x00000800,0x080018a2,0xb4cf72c7,0x30a072e8,0x20001000,0xa40b72a6,0xd571bcad,0x00006226,
-0x000010a2,0xccae3000,0xdceccc8b,0xcc8ac429,0xe5afe56d,0x6ac6c54f,0x18820000,0x08001062,0xe6129b89,0xcdb2e652,0x00021860,0x18a20021,0xc5121000,0xee53ee13,0xf717f6f7,0xe614f6b6,0x18008bab,0x08002082,0x00000000,0x00000000,0x00210000,0x00000020,0x49e60000,0x3184736c,0x08000000,0xedf382e7,0xed50f591,0xe5d2e52f,0x0800d5d4,0x10a20800,0x000010a1,0x00000840,
-0x00200000,0x00000000,0x00000860,0xe6787b4b,0x1000bd32,0x08000800,0x08000800,0x08200820,0x10000800,0x18001800,0x20002000,0x7ac41800,0x7a61d56f,0x5a241000,0xdcead50d,0xdd8fd4ea,0x100093ab,0xbccf3880,0xabc8d50e,0x59815940,0x41405181,0x28802860,0x00000000,0x41601880,0x61e059c0,0xd54ca406,0xc48abc27,0x1800ac4b,0x08001800,0x00000800,0x00000000,0x00000000,
-0x08000800,0x08000800,0xac278b86,0xb3a1ab81,0xb446ccc7,0x28009ba9,0x00000000,0x08000800,0x00200000,0x00000820,0x00010000,0x00000000,0x00200000,0x10001080,0xd54c8b46,0xe528d507,0x9b00d4c8,0xac4a92e0,0x000041a1,0x00000881,0x6b0818a0,0x7ac67ae6,0x00003100,0x00400860,0x62a80000,0x9b659388,0x9b869b66,0xb448b428,0x9be9b48a,0x08200800,0x08001860,0xa44c6264,
-0x51a28b8a,0x08000800,0x41841000,0x39435206,0x00010000,0x00000822,0x5a0349a3,0x59c36a03,0x00001820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x28201000,0xe5d19347,0xcdb1ee93,0x00001020,0x08001882,0xe6138b89,0xcd30ddf2,0xbc2ca3aa,0xbc08bc2a,0xc4cdc449,0x00006205,
-0x10200840,0xb46e2000,0xdd50d50f,0xc44cbc0b,0xccedd50d,0xa46eddb1,0x08820000,0x08000841,0xc5512000,0xcdf3e695,0x000062e9,0x10601080,0x6aa80000,0xde14d5b3,0xeed7eed7,0xb532ff3a,0x08400000,0x08010820,0x00000000,0x00000840,0x00000000,0x20a20000,0x9bcd1800,0xcdf5ff5a,0x20a00000,0xcdb40800,0xff1aff5b,0xfed9ff3a,0x0000838d,0x002110c3,0x18a20000,0x00000000,
-0x00000000,0x18c218c3,0x00000020,0xce17c5b5,0x00002060,0x08001820,0x08001820,0x08000801,0x18001000,0x20002000,0x30801800,0x5a021000,0x82a4dd70,0x08001000,0xd5709bcb,0xcd91e5f1,0x08005a45,0xc5311000,0x7241ddb1,0x18002000,0x10001000,0x08001800,0x08210000,0x08000000,0x18001000,0x72a51000,0xac29ac29,0x10008b8a,0x08400000,0x082010a2,0x00000000,0x00000860,
-0x20601000,0x080028e0,0xb44a4120,0xdcc7cca9,0xcd2abc22,0x00006ac4,0x29010840,0x59c28328,0x08400800,0x00000800,0x00000001,0x00000000,0x00400060,0x08001061,0xbcac5140,0xd4c8e56d,0xcca9c446,0x9387bc69,0x10601000,0x00000881,0x732a3984,0x418172e8,0x08400000,0x00200000,0x4a470000,0x59e16aa6,0x5a0459c3,0x52025202,0x41825a64,0x00000000,0x10001041,0xb48b7283,
-0xabeabc6b,0x41006a22,0x624559e3,0x49a259e3,0x00010800,0x08000001,0x62454183,0x51826a44,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18001840,0xfef772a5,0xad10ff79,0x18820000,0x080020a2,0xee139bca,0xe58ffe74,0xc3c9cc6b,0xb3a6b3a6,0xbc8ccccb,0x00004961,
-0x08200820,0x62261000,0x72236a44,0x82868286,0x72637a64,0x496159a0,0x00000800,0x08400000,0x41840800,0x41a15204,0x00003162,0x00001040,0x08000820,0x51e33941,0x7b4a6ac7,0x29237b4b,0x08820000,0x10610020,0x00000020,0x00000000,0x00200000,0x20820000,0xac2e1800,0xff39ff3a,0x0000944f,0x39850000,0xa4d29c91,0x93eeb4f3,0x00000000,0x94b20000,0x08007b6c,0x10401000,
-0x00000000,0x00210000,0x00000040,0x20c12922,0x00000000,0xc59441c5,0xbd95e6b8,0x08000000,0xa44d6a87,0xac0da3ec,0x49829bec,0x62440800,0xb42ad56f,0x100038a0,0xac8f1800,0x5a23cdd3,0x00000800,0xf6d8cdd4,0x61c0c52f,0x5a251800,0x7b2972c8,0x72c87ae7,0x080028e3,0x5a473102,0x30c16268,0x20200800,0x93a99c0b,0x000030e0,0x00400060,0x00000020,0x08600000,0x10000820,
-0x9beb59c2,0x10006264,0x7ae71000,0xd50bd54e,0xb4cbccea,0x10a00000,0x51e00800,0x7aa3b44a,0x10400800,0x00000000,0x00000000,0x00000000,0x00000040,0x18610000,0x59811000,0x92e2abe9,0xac299b65,0x39009bea,0x08400800,0x00000000,0x18401840,0x00000800,0x00000840,0x00000000,0x00000040,0x10001000,0x00000800,0x00000000,0x00000000,0x00010020,0x08001041,0xa40a6244,
-0x7a409b67,0x8ae59326,0x82a57a64,0x49407a84,0x10211000,0x00000000,0x49a32060,0x5a266266,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08001000,0xbdb36286,0x000083cd,0x10420000,0x100020c1,0xcced8b07,0xd4abd4cb,0xd449d429,0xc4accc8b,0x72c6c4ee,0x08200800,
-0x00000000,0x10001000,0x08000800,0x10001000,0x08000800,0x00000800,0x00000041,0x00000000,0x00000820,0x00000000,0x10200800,0x00000000,0x00200020,0x00000000,0x00000000,0x00000000,0x00220863,0x00000000,0x000018a1,0x00000000,0x00000000,0x20a20020,0xac6f1800,0xff39ff5a,0x41e6e6b8,0x00000000,0x00000000,0x00000800,0x000020e2,0xf75b942f,0xacb1ff3a,0x10001000,
-0x00001880,0x00000021,0x00200000,0x00000000,0x00002103,0xf77bb574,0xeed9ff7c,0x10000800,0xfeb5a42c,0xee11dd8f,0x7ac6e613,0x62241000,0xdd2dcccc,0x4982bcce,0x08000800,0x080028c0,0xb5320000,0xff39ffdd,0x4120bd0f,0x8b6a1800,0xabeb9b8a,0xa42dbcad,0x08005a07,0xa42d6266,0x93acac6e,0x08002020,0x08001840,0x08400000,0x00410000,0x00000020,0x00000881,0x9be81000,
-0xabc6bc49,0x5200ac8b,0x18001000,0x51a159e3,0x31205a03,0x00000000,0x9bc54960,0x9324c4a9,0x08601000,0x00200020,0x00000000,0x00000800,0x00000000,0x00000863,0x08001040,0x18001000,0x10001000,0x00000800,0x00000840,0x00001040,0x00000800,0x08200000,0x00000020,0x00000020,0x10200800,0x18401020,0x10400800,0x10201840,0x10801080,0x00000000,0x10200000,0x6a871000,
-0x93079369,0xab899306,0x92a4a327,0x7a658a84,0x00002880,0x08211042,0x08000000,0x31243123,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08010000,0x08000000,0x000020c1,0x00000000,0x18821022,0x20000800,0xdd2fb46c,0xd4aacccb,0xed90dcec,0x7ac6bc8d,0x08003900,0x00200820,
-0x00000020,0x18410800,0x20c228e3,0x20a020a0,0x18a22902,0x20c320c3,0x004010a3,0x00000020,0x10610000,0x292418a2,0x20c31882,0x084020c3,0x00410000,0x10a20841,0x21041082,0x28e52904,0x100120c4,0x6ac93923,0x08600000,0x00000020,0x00000000,0x18810020,0x9bcc1000,0xee14ee35,0x5247d5f5,0x18a30000,0x10001000,0x08000000,0x000018a0,0xde15836b,0xe614ddf4,0x5983cd32,
-0x08001000,0x00010000,0x00000001,0x08401081,0x00000020,0xad32630a,0xd636e6b8,0x10000800,0xf653ac2c,0xe58edd6e,0x8327e5b1,0x62242000,0xdd6edd6f,0xde36d591,0x00005a89,0x000018c1,0xff9bbd74,0xeeb7f6d8,0x2880c592,0x93cb1000,0x9b47abeb,0xa40cac2b,0x10004984,0x9bcb6a87,0x7b0993ab,0x000028c2,0x10410000,0x00000841,0x00000020,0x08400020,0x6ac60000,0xcccac50d,
-0xedcdd4e8,0x6284d5d0,0x08000800,0x08000000,0x00000800,0x080018c3,0xd58e8326,0xa385dd4c,0x10811000,0x00000000,0x00000000,0x00000000,0x08200820,0x08210000,0x08201041,0x186028c2,0x08001041,0x00620862,0x10810000,0x18601020,0x18402080,0x00000820,0x00000000,0x10800840,0x28c02060,0x208028a0,0x20601840,0x28802040,0x00000000,0x08001040,0x00000000,0x08000800,
-0x6a451800,0xa36982a6,0xab26a306,0x92e69ac4,0x39018b49,0x10000800,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10a00000,0x10421082,0x08000800,0xddf37308,0xddb0f694,0xdd6fcd0d,0xa40ccd30,0x10004121,0x18610000,0x00000020,
-0x08200000,0x18001800,0x10001000,0x18001000,0x10000800,0x08001000,0x00000000,0x00000020,0x18610000,0x00000000,0x00000000,0x00000000,0x00000020,0x00200000,0x08000000,0x08000000,0x08001000,0xa48fa48f,0x10610000,0x00000000,0x00200000,0x10200000,0x8b091800,0xd530d530,0x1000836a,0x28402020,0x7285834a,0x7b288327,0x20e10000,0x93cb1000,0xccadd50f,0xb42cdcce,
-0x08207b09,0x18e50021,0x000010a3,0x00000000,0x08400000,0x00000000,0x83cd62c9,0x10001000,0xd5108ae8,0xdd30c48d,0x8b08dd92,0x51612000,0xe612ddb1,0xcdf5e655,0x00004a06,0x00002103,0xffbca4f2,0xf6f8e676,0x1000cdd3,0xac6e1000,0xa3c9bcce,0x9becac0c,0x10003922,0x836a6aa8,0x080041a3,0x00200000,0x00000020,0x08400000,0x10a310a2,0x080018a3,0xcd2e7b28,0xdcc8d4ca,
-0xedeedd28,0x1000a42b,0x49e60000,0x8bed9470,0x5a477b4b,0x00000800,0xd5906204,0x9bc6ddae,0x18a31000,0x00000000,0x00000000,0x00200000,0x5aa80000,0x080039a3,0x00000000,0x00000000,0x00400000,0x00200000,0x00001080,0x10001000,0x00001000,0x00210000,0x00000001,0x00000000,0x18000800,0x28002000,0x516040c0,0x410040e0,0x394051a0,0x00000000,0x00000000,0x10211021,
-0x10000000,0x82c64121,0xcc6b9b06,0xa305ab45,0x9369abc9,0x08004120,0x08410820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x08400000,0x00200860,0x10420801,0x9c900000,0xff39f6f9,0xe633f6b5,0xac8de633,0x080051a2,0x18a20000,0x082120c4,0x00000020,
-0x00000040,0x8b2a3040,0x9c0d9c0d,0x9c0c9c0d,0xa46ea44d,0xbd12a46e,0x3184a4b1,0x08410000,0x18001000,0xacf38bef,0xb595ad13,0x4228ad75,0x08400000,0x00000840,0x9cd24a48,0xbd55ad14,0xce16b533,0xa48fff9b,0x18c30000,0x00000001,0x00000000,0x20810000,0x7ac91800,0xd592ddf4,0x080049c3,0xac901000,0xf6d6f6b8,0xeef8eed6,0x00008c2e,0x72a70800,0xfef7fed7,0xfe97fe95,
-0x0000bd32,0x00000021,0x20e30000,0x00000820,0x00000000,0x20c118a1,0x00000000,0x08002104,0xff5a9bac,0xfeb8fef9,0x8b2af697,0x28201800,0xf6f7d5f4,0x3942cdf5,0x00000800,0x00000000,0x7b8c0000,0xd5f4cdd4,0x10009c4f,0x62870800,0x72658328,0x62476a46,0x000028a0,0x08001820,0x08200000,0x00000020,0x00000020,0x10201880,0x00000000,0x18000000,0xb46c59a1,0xf5cfdd4e,
-0xbccbedee,0x10201800,0xb5540800,0xf75aff7c,0xde56ff3a,0x18201820,0x8baa1000,0x9c09de52,0x18830800,0x00000001,0x00000000,0x10800000,0x940c0000,0x41209c6c,0x38e051c1,0x290228c0,0x000018c1,0x10600020,0x62840800,0x83078327,0x6ac68b88,0x000020a0,0x00000842,0x83693100,0xa3e993ca,0xa3e7ac29,0xbc49b408,0xb429b408,0xa40acd4e,0x10401000,0x00200040,0x10410000,
-0x08200020,0x28800800,0xc4ce7285,0x8262abc9,0x82a58241,0x51e68b6a,0x00210000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x08221062,0xbd950000,0xff9cff7c,0xd615ff5a,0x08006ae7,0x21010000,0x10811080,0x08200000,0x08400000,
-0x10000041,0xdd5150e0,0xe5d2ee13,0xf654f654,0xf674f654,0xff9bf675,0x5a67f719,0x18c30000,0x39030800,0xffffef1b,0xffffffbe,0xc5f7ffff,0x21030000,0x00001040,0xef1b4a08,0xffffffde,0xffffffff,0xb533fffe,0x18c30000,0x00000000,0x00000000,0x08620001,0x10200000,0x39835267,0x00000020,0xff5d7b6d,0xffbdffde,0xffbdffbd,0x28e4e6db,0x00000000,0xacf1940e,0xad12a4d1,
-0x08006b2a,0x7bd02924,0x000041e8,0x18a20820,0x00000000,0x00000000,0x104018c1,0x00000841,0x940f49e6,0x6aea732b,0x3964732b,0x00000000,0x524641a4,0x08000000,0xa4b20800,0x526ad67a,0x00000000,0x00000800,0x10600000,0x00000820,0x10001000,0x08000800,0x00200000,0x00000840,0x00000822,0x00000020,0x18a11081,0x20000800,0xa48d6242,0x1000836a,0x5a051000,0x7ae68349,
-0x51c28b89,0x08000000,0xde9883ce,0xff59eed8,0xf6d5ff17,0x1000a44c,0x39830000,0x6b08a4cf,0x08400000,0x00000000,0x00000000,0x18600020,0xbd0e1000,0xc4a8cd0b,0xac07b406,0xb4efb46a,0x080051e5,0x08000821,0xbceb3940,0xc469d4ec,0xcd2dd50a,0x08005204,0x080018a2,0xc4ec5160,0xccc8cca9,0xccc8d509,0xe52ad4e8,0xe54be52a,0xb408e52b,0x08001800,0x00000020,0x00000000,
-0x08200800,0x00000820,0x39620800,0x72865a04,0x7a8669e2,0x31236267,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x18c10860,0x10220801,0x08200000,0xce177b8d,0x0000a4d2,0x18c00800,0x18e11080,0x00001040,0x6b2c28c2,0x00003185,
-0x08000841,0xedb26140,0xfed6f654,0xf695fed6,0xf674ee53,0xf6b7ee34,0x5205de15,0x18820000,0x38c21800,0xffdeeeda,0xffdfffbe,0xf79dffff,0x00005aeb,0x20a218a2,0xad130000,0xffbeffde,0xffdef7be,0xb574fffe,0x18c30000,0x00000000,0x08010000,0x00000000,0x00000841,0x00000000,0x000010c2,0xffbfc5b7,0xffffffbe,0xffbeffde,0x9c92ffbf,0x29250000,0x00000000,0x00000000,
-0x00000000,0xf79e7bae,0x9451e6fb,0x00000000,0x00001041,0x00200000,0x00000000,0x00420000,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x00000800,0xff9ea4d3,0xd6bbffff,0x00004228,0x08200000,0x00000000,0x00200040,0x18401020,0x10401860,0x00000000,0x00210000,0x00410000,0x10800000,0x00000000,0x8b676264,0xde33c54e,0x1000accf,0x08002060,0x10000000,
-0x08000800,0x52680000,0xffbcef1a,0xff9affbc,0xde11ff37,0x41a1c550,0x00000820,0x00000000,0x00200040,0x00000000,0x00000000,0x08000820,0xb4ab1800,0xdd08e56b,0xc467c445,0xb4accd0c,0x18811000,0x08001862,0xd54c8345,0xcc25c427,0xcceacc85,0x000051c1,0x10001840,0xd54c6a20,0xdce6d4e7,0xdd06e527,0xed48dd06,0xe508ed49,0xbbe7dca7,0x10202800,0x00000020,0x520528c1,
-0x10001800,0x08801040,0x00000081,0x5a260800,0x51c4832a,0x00000800,0x00000840,0x08000820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18831842,0x00000862,0x00000000,0x00000000,0x10601081,0x000018a1,0x9c302861,0xf75de6ba,0x00005289,
-0x08002104,0xe5b36160,0xff7bf697,0xffbdff7b,0xff7bff7b,0xff5bff5b,0x6b2aeef9,0x20c20000,0x61e71000,0xffffff3c,0xffffffbe,0xffffffff,0x0000c659,0x18811081,0x41a60000,0xffdee6da,0xfffeffde,0xbdd5ffdd,0x08a30000,0x00000842,0x00000800,0x08220801,0x41c80000,0x296552aa,0x00000020,0xff7e838e,0xf7beffff,0xffdef7de,0x9410ffff,0x28820800,0x10000800,0x08001000,
-0x08000800,0xef1c5249,0xffbeffff,0x734dd679,0x10420000,0x10411041,0x00000820,0x00000001,0x20a30000,0x086120e4,0x08a110c2,0x00000000,0x6b2b5aa9,0xad346b2c,0xfffff7be,0xfffff7de,0xad34e71b,0xad35bd96,0x39c6a533,0x10820000,0x00000000,0x00000000,0x00000000,0x00200000,0x11020081,0x00000861,0xacee5245,0xcd4de652,0xde14cd90,0x0800838b,0x730a1800,0x5a478bcd,
-0x49c572ca,0x39830800,0xffddef1a,0xffdcff9c,0xe695f737,0x5a46e696,0x10420000,0x08001000,0x00210020,0x00010001,0x00000000,0x00000821,0xc52e30c0,0xf5ede5ad,0xcccbedce,0x6221d590,0x10600800,0x08001060,0xdd8dbcec,0xed6ce56d,0xdd8df5ed,0x10006203,0x10002060,0xcd0b59e0,0xe547d508,0xdd25e567,0xe525e525,0xdcc6e506,0xc46ae4e8,0x10002800,0x08001061,0xac0c5140,
-0x59409b07,0x10401800,0x08201081,0x08000800,0x080030e3,0x08001000,0x08410000,0x00000000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31230820,0x7b2b5a27,0x00000800,0x10a310a3,0x10e310c3,0x108110a2,0x00001040,0x8bce0800,0xff7ee659,0xf79dffdf,0x0000736d,
-0x100018a2,0xf6565920,0xf77cff5b,0xfffeffde,0xfffeffdd,0xffbdffde,0x83edffdd,0x29030000,0x7aca1800,0xffdeff5c,0xffdeffdf,0xfffff7ff,0x630cf7be,0x18620000,0x000020c2,0xce176b0b,0xfffeff9d,0x8c4fff9c,0x10e40000,0x00000000,0x00000000,0x10420000,0xad140800,0xd679f79e,0x080020c2,0xcdf80800,0xffffffff,0xffffffde,0x0800c5f7,0x30c21000,0xeefbd617,0xde9ae69a,
-0x00007b6d,0xb5760000,0xffdeffff,0xffbeffff,0x0800a4d3,0x00002082,0x21030020,0x00210021,0x00000000,0x00000000,0x00200000,0x00000061,0xff9db574,0xffdfff9e,0xfffeffde,0xf7fef7fe,0xfffffffe,0xffdfffdf,0x2944c617,0x08420000,0x00000000,0x00000000,0x00220001,0x10e30862,0x00000000,0x08000800,0xf738a4af,0xff57ff16,0xeed8ffdb,0x080041a3,0xf73b7b6b,0xf73bffbd,
-0xde58ff7c,0x080038e2,0xdef98c2e,0xffddf77b,0xff59f739,0x0000bd93,0x20c40800,0xa471c576,0x08410000,0x00000801,0x00000000,0x00000020,0xc54f1820,0xfeb2ddae,0xd570fef5,0x18008b48,0x18e30840,0x83cc0000,0xddaeff57,0xedafedaf,0xee51ee0f,0x080072c6,0x10002081,0xac894120,0xedccddad,0xdd26e568,0xeda8eda8,0xdd29ed89,0xc46bc446,0x080040a0,0x08001841,0xbc8d5161,
-0xb3cad4ce,0x08006a66,0x10400000,0x10000800,0x08000000,0x20a20800,0x08001820,0x41434943,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x306028a2,0xf6fb93cd,0x738ed659,0x00000000,0x002010a2,0x18400840,0x72eb0800,0xff9ecdf7,0xff9effdf,0xf79dffde,0x000083ef,
-0x180020c3,0xfef971e4,0xffdeffbd,0xf7bef7de,0xfffeffdd,0xffdeffde,0x7b8df79d,0x29030000,0x7b0b1000,0xffdeff9d,0xffdfffbe,0xef7dffff,0x2904a514,0x18610000,0x18a10800,0x00000000,0xe6b993ee,0xa4d1ffbc,0x18c40000,0x00000000,0x00000000,0x20a20000,0xbd750000,0xfffeffde,0x0000ad33,0x5a8a0000,0xff7deedb,0xef3bff7c,0x00006b2c,0xa4f30000,0xfffeffde,0xffffffdf,
-0x0800d679,0x4a080000,0xf77dde9a,0xf77def3c,0x00008bef,0x41c60800,0x00000000,0x18c30020,0x00001082,0x00000000,0x00200000,0x00000021,0xacf33965,0xffbeeefb,0xffffffdf,0xfffefffe,0xf77dffde,0x736dc618,0x00000000,0x00001041,0x00000000,0x00000000,0x18a218a3,0x00000000,0xa4d3526a,0x08005a48,0xe6da62ca,0xff5bff5b,0xacb2ff7c,0x18600800,0xfffed657,0xffffffbe,
-0xffdefffe,0x1800acb2,0xce161840,0xf77bfffd,0xef19ffdc,0x080041a5,0x94510000,0xcdf7ffbe,0x10810000,0x00000821,0x00000000,0x08a00040,0xbd910000,0xcdf1e6b4,0x38e0ac8d,0x08200800,0x10a30001,0x62e90000,0xeed5c591,0xd58ff6b5,0xf716ee72,0x00007349,0x080020a3,0xcdd049c0,0xff56ff57,0xe5cbfeb1,0xf60dee0c,0xedcef62e,0xc4cde58e,0x10003840,0x000020a3,0xff1a6aca,
-0xc4aef676,0xcdb4e615,0x00005227,0x08001800,0x08210000,0x00001062,0x72243040,0x72049b49,0x08201000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200000,0x30202020,0xff7c936c,0xffbeffde,0x73cfce59,0x08600000,0x10000820,0xde381800,0xff9effdf,0xffdeffbe,0xf7bdf7be,0x00007bce,
-0x10003144,0xff3b932a,0xf79dffde,0xfffff7df,0xfffefffe,0xffffffff,0x6b6cffbe,0x28e20800,0x72eb1000,0xffdfff5d,0xffdfffff,0x5acbce79,0x00000000,0x20821021,0x188118a2,0x20c220e2,0x39011000,0xa4d1bd53,0x08620000,0x00000000,0x00000000,0x18a10820,0xbd950800,0xffdefffe,0x3144ef1b,0x00000000,0x72ca4965,0x524772ea,0x00001881,0xf77d62eb,0xffdeffde,0xffffffff,
-0x7baef79d,0x00000800,0x52693144,0x52285aaa,0x08000800,0xef1b62aa,0x7baece58,0x00000000,0x08410000,0x00000000,0x00200000,0x08010000,0x08000000,0x9c313925,0xf77dd638,0xe6baffbd,0x62eba4d2,0x00000000,0x10421042,0x08400000,0x00000000,0x00000821,0x08000000,0xb5974a6a,0xffdff73d,0x0800bd75,0x49e80000,0x5a296aab,0x30c3628a,0xa4d30000,0xfffeffde,0xffdeffff,
-0xffdefffe,0x51a7eedb,0x5aa91000,0x8c0e8c2e,0x732b940e,0x00000800,0xdeb93984,0xcdf6ffde,0x10a10000,0x00000821,0x00000000,0x00400020,0x9cd00020,0x10209cce,0x08000800,0x084220c3,0x106318a4,0x00001083,0x942c0800,0xff79de34,0xef38fffb,0x00204a45,0x00001883,0xe6b462a5,0xff78eef6,0xee50ff55,0xfef3ee50,0xfef5fef4,0xf6b6ff78,0x10006206,0x000020e4,0xff9d736d,
-0xfef9ff7b,0xff7bff3a,0x62a9eed9,0x20820800,0x08410821,0x83ce0000,0xd571c572,0x7a44cccf,0x08411000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000000,0x384038a2,0xff5c9b6c,0xffffffbe,0xef7dffff,0x000073ae,0x20c320e3,0xb4f41000,0xffdeffdf,0xf7bdfffe,0xef7cf7de,0x00007bcd,
-0x08002103,0xff7c93ad,0xffffffde,0xffffffdf,0xfffffffe,0xffffffff,0x632cf79e,0x20a20000,0x62481000,0xfffff75d,0x8c30deba,0x00000000,0x10a218c3,0x00002103,0x08000000,0x18810000,0x000020c2,0x00000820,0x00000061,0x00000000,0x00000000,0x10620000,0xc5960800,0xffdfffdf,0xad13ffff,0x28e20000,0x10001000,0x00001000,0x000020c2,0xffffa4d3,0xffdfffbf,0xffdfffdf,
-0xc5d7ffff,0x31040000,0x00000000,0x08000000,0x100028e3,0xffdeacf3,0xffbeffff,0xad34deba,0x000031a6,0x08211062,0x004110c3,0x00010841,0x10621083,0x00000801,0x62aa0000,0x2041838e,0x00000000,0x18c31061,0x00000821,0x08201061,0x18c42104,0x00000000,0xce58842f,0xfffff79e,0xffffffff,0x5a88ef5c,0x00000800,0x10000800,0x10000800,0xb5960800,0xffdfffff,0xffffffdf,
-0xffffffff,0x8b4eff9f,0x08001000,0x00000000,0x08000800,0x08002904,0xff9a9caf,0xbd52f739,0x10c20000,0x00000001,0x00000000,0x00000000,0x00200841,0x00000000,0x102120a1,0x00001862,0x00000800,0x20c21862,0x00001880,0x9c6f20a0,0xf79beef9,0x00005ac8,0x080020c2,0xde525a21,0xff57ff57,0xff16f6b4,0xff7aff38,0xfffdff9b,0xffddffbc,0x08008bee,0x00002123,0xff9d6b2c,
-0xf75bff7c,0xffbcffdd,0x3901de77,0x18600800,0x00001040,0xef5c9491,0xff5bffbd,0x8309f6b8,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x30003082,0xff5c9b6c,0xf7defffe,0xffffffff,0x0000e6fb,0x18820000,0x28820800,0xffbee6ba,0xffdeffff,0xfffefffe,0x00007bcd,
-0x00002144,0xff7d8b8d,0xffdfffdf,0xffdfffdf,0xffdeffff,0xffdfffdf,0x632cef7d,0x28e30000,0x49c70800,0xb575de79,0x00002903,0x18c20800,0x00002103,0x6b2c0000,0xc5d6c5f7,0x080062cb,0x10820000,0x00201082,0x00200020,0x00000000,0x00000000,0x18a20000,0xc5960800,0xffdfffdf,0x7b8def3c,0x08000000,0x628a49a6,0x52695249,0x000018a1,0xe6bb3945,0xffbfffff,0xffdfffdf,
-0x7b8ef79e,0x10200000,0x6b2c6b4c,0x5a8962eb,0x08002061,0xef3c5228,0xffdeffde,0xffffffff,0x4a28deba,0x00000000,0x00000000,0x084118c3,0x00620021,0x18a30021,0x00001061,0x10000800,0x106128c3,0x00000000,0x20c41062,0x00001081,0x00000000,0x08410862,0xffffdeda,0xffdfffdf,0xffffffbf,0x0820ce58,0x7b6d0000,0x732c9451,0x5a899410,0x31650000,0xffffdefb,0xfffff7be,
-0xfffff7be,0x3023de3a,0x732c0800,0x7b8e9cb2,0x62aa7b8d,0x00000000,0xde975ac8,0xc5b3ff9b,0x18c20000,0x00000020,0x00000000,0x00000000,0x00000000,0x00201081,0x18820820,0x4a080800,0x732cacf3,0x00000000,0x20c220c2,0x00000000,0xad545aa9,0x00004a68,0x080020c2,0xcdd249a0,0xff59ff99,0xff59ee95,0xffbdffbc,0xffdeffde,0xffbdfffe,0x00009c91,0x000018e2,0xef3c4a49,
-0xffbdffbd,0xff9cff7c,0x0800836b,0x106020a1,0x5aea0000,0xffddef5c,0xffddffde,0x834bff5b,0x18a30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x28202061,0xff5c9b6d,0xffffffde,0xfffef7be,0x7bceffde,0x10c20000,0x000018a2,0xffff9451,0xffffffde,0xffbeffff,0x0000738d,
-0x00002124,0xff5d6248,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0x630bffbe,0x18810000,0x10200000,0x080041c6,0x28e30000,0x000028e3,0x41a60000,0xef5da4d2,0xffffffdf,0x9471ef5d,0x08011863,0x08600820,0x00000000,0x00000000,0x00000000,0x18c30020,0xad340000,0xffdeffff,0x0000a4f4,0x730c0800,0xf77def1c,0xf77df79e,0x080083ef,0x8c100800,0xffffffff,0xffffffdf,
-0x0000c618,0x7b8e1000,0xffdeef5c,0xf7bef79d,0x08009450,0x94710000,0xffffffbe,0xffdeffff,0x0000d699,0x41c70800,0x00007baf,0x00000000,0x08c310c3,0x00200020,0x18810820,0x18421842,0x08000800,0x20a10800,0x00000000,0x4a480000,0x7badad33,0x00000000,0xffff9491,0xffffffff,0xffdfffff,0x0800734d,0xe6da4184,0xffbeffde,0xd658ffde,0x00001840,0xffdf8c10,0xffffffff,
-0xf79dffff,0x10007b2d,0xe6da3945,0xffbeffdf,0xe6fbffde,0x10003124,0xa4f20000,0xbd94ffdd,0x10a10000,0x00000000,0x00000000,0x00000000,0x00000000,0x08610020,0x00000000,0xe71ca4f4,0xf77cffbe,0x28e2ad33,0x00000800,0x21242104,0x00000000,0x00000841,0x08001861,0xe6f93963,0xfffeffdd,0xffddffdd,0xfffffffe,0xfffeffff,0xfffefffe,0x00009450,0x00002923,0xff7d4165,
-0xffdefffe,0xce17ffdd,0x10810000,0x18c20020,0xb5b50000,0xfffffffe,0xffddffde,0xa470ffbd,0x18c30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x18001861,0xff5c934c,0xffffffff,0xffdeffff,0xce79ffff,0x08610000,0x08400861,0xd6381841,0xef1bf77d,0xdebaef3c,0x00006b2c,
-0x080010a3,0xde382882,0xf77dff7d,0xffbef77d,0xffbef79d,0xffbeff9e,0x4a28e71b,0x08200000,0x00000000,0x20610000,0x28a228e3,0x28a20800,0xeefbb534,0xffdeffff,0xffdef7be,0xe71bffff,0x00004a29,0x00001061,0x00000000,0x00000000,0x00000000,0x08620021,0x62aa0000,0x9cf3a513,0x000031a6,0xde792021,0xffdeffdf,0xffffffff,0x3945e6fb,0x10000800,0xce58ad55,0xc5f7ce37,
-0x00006b0c,0xde9a1000,0xffdeffff,0xffffffff,0x2904e6fb,0x00000000,0xb5b69cd3,0xc617bdd6,0x0000734c,0xc5b70000,0xe6fbffdf,0x5aaaad34,0x00000000,0x00000000,0x08200840,0x08010000,0x00000820,0x00000000,0x8c101861,0xef5cce39,0xe6dafffe,0x080041e6,0x945120c2,0xb534b534,0x9451c5b7,0x00001000,0xffdea4d2,0xff9effff,0xffdeffff,0x0800a4f2,0xad540000,0xc637d679,
-0x9491c658,0x10001000,0xffff9471,0xffffffff,0xffbeffff,0x1000bd55,0x31850800,0x6b0ba4d2,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000040,0xce583185,0xffffffdf,0xffddffff,0xe6daffde,0x3985a4b2,0x00000000,0x10822104,0x00000000,0x00000000,0xa4f32903,0xd659ce38,0xd658d679,0xce38d679,0xce58ce59,0xbdd6bdf6,0x000062cb,0x00001880,0xad1328c2,
-0xbdb5c5d6,0x630bbd95,0x08a30000,0x000010c2,0xce583185,0xef1cf77d,0xf75cf75c,0xb533ffde,0x18a20800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08001081,0xff9d9bce,0xbdd7ef1c,0xb595b595,0x8c51ad54,0x00002905,0x08400041,0x10000000,0x49c55227,0x39454165,0x00000801,
-0x10620000,0x20400800,0x626849a5,0x838d7b4c,0x8bce83ad,0x8bce8bce,0x0820732c,0x08200000,0x00200000,0x28c320e3,0x18001000,0xe6daacd2,0xfffffffe,0xffdeffde,0xffdfffff,0x5aaad659,0x08620000,0x10a21082,0x00000000,0x00000800,0x00000000,0x00010022,0x00000800,0x00000000,0x00000040,0xffdead13,0xf7deffff,0xf7deffff,0xb575ffff,0x20a30000,0x00000000,0x00000000,
-0x08000000,0xffbead14,0xffffffff,0xffdef7be,0xad34ffff,0x20c30000,0x00200000,0x00000000,0x00000000,0xf77d6b0c,0xffffffff,0xef3cffdf,0x9cb2d659,0x08003144,0x08a20840,0x084218c4,0x00000021,0xb5753165,0xf79ededb,0xffffffff,0xffffffff,0x0000b596,0x00002103,0x00000800,0x00000000,0x4a480000,0xffffe6da,0xffffffbf,0xffdfffdf,0x5a88f75c,0x00000000,0x00000000,
-0x00000000,0x5a690800,0xffffef3c,0xffffffde,0xffffffde,0x6acbff5d,0x08400000,0x00000000,0x00210021,0x00000000,0x00000000,0x00000000,0x00200000,0x00000820,0xad5441e6,0xffffef3c,0xf7bdfffe,0xfffffffe,0xe6dbffdf,0x30c3acd3,0x18620800,0x000018a3,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000021,0x00000000,0x10010000,0x00000000,0x00000021,
-0x00000000,0x00000021,0x00210842,0x00000000,0x20e31060,0x5a6a41e8,0x6289628a,0xa4d2c5b6,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000841,0xeeba93ce,0x00006b0c,0x00000000,0x00000000,0x10220000,0x00000000,0x18600840,0x08000800,0x00000000,0x00010801,
-0x00000000,0x18001001,0x08000800,0x08001000,0x08000800,0x10000800,0x08200000,0x00000000,0x08200000,0x00000800,0xde996aeb,0xffdeffff,0xffdefffe,0xffffffff,0xb575ffbe,0x00000820,0x106220e4,0x00000000,0x00000821,0x00000000,0x00000000,0x00000001,0x08001020,0x00000000,0x000018c2,0xffdecdf7,0xffffffde,0xfffef7de,0xce39ffff,0x20c30000,0x00000000,0x00000000,
-0x00001061,0xffdea4f3,0xffffffde,0xffdeffff,0xce38ffff,0x18820000,0x00000020,0x00000000,0x00000000,0xf75d62aa,0xffdfffdf,0xffffffdf,0xff9effff,0x00007b6d,0x00000000,0x00000000,0x000018e4,0xe6db0000,0xffffffff,0xffdfffbf,0xffffffde,0x0000ad55,0x10401881,0x08000000,0x00000000,0x7bce0000,0xffdffffe,0xffdfffdf,0xffffffbf,0x5a69f75c,0x00000000,0x00000000,
-0x00000000,0x52480000,0xffffef3c,0xffdfffff,0xffffffde,0x628af73d,0x00000000,0x00010000,0x00000842,0x00000020,0x00000000,0x00000000,0x10610000,0x10400820,0x00000000,0xb5954a28,0xfffff7de,0xffdeffde,0xffdfffbe,0xe699ffde,0x000083cf,0x08410000,0x00000000,0x18a20021,0x18812103,0x18a218c2,0x18a218a2,0x10c40862,0x18831042,0x08011022,0x08200000,0x08a40021,
-0x106218a3,0x088410a4,0x00000000,0x10401880,0x00001020,0x00000000,0x00000800,0x28e20800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0x732c628a,0x18e30000,0x298418e2,0x29253165,0x29042082,0x00200061,0x08210000,0x10212082,0x10811061,0x08411061,
-0x00000000,0x10410000,0x28e31861,0x29033124,0x31442923,0x29642123,0x18413124,0x00200000,0x00001061,0xc5b64966,0xffffff7d,0xffffffff,0xffffffff,0xffdeffff,0x00008c71,0x20a30000,0x00000000,0x8c106aec,0x00000000,0x00000000,0x00000000,0x08410000,0x6b0b0000,0x8c109cb2,0x08000800,0xff5d5a49,0xffdeffdf,0xfffff7be,0x734cf77d,0x08000000,0xa4d28c30,0x8c0f9470,
-0x000041e6,0xd6580800,0xffdeffff,0xffffffde,0x6b0cf79d,0x10400000,0xe6babd96,0xbd95c5f7,0x00007b8d,0xb5550800,0xffffffff,0xffdeffde,0xc5f7ffff,0x00000000,0xb59673ae,0xdedb8c51,0x0000c5d7,0x8c300800,0xffffffde,0xffdeffff,0xe6faffff,0x08002903,0xde796aeb,0xc5d7d659,0x7b6ebd96,0x10000800,0xffffd658,0xffdfffbe,0xffdfffdf,0x0000acf3,0x7bae0800,0xbd76bd76,
-0x9c92bd96,0x00001841,0xffff9451,0xffffffde,0xffdfffde,0x0800acb3,0x6b2b0000,0x83cfcdf7,0x08620000,0x00000041,0x00000000,0x00000000,0x00000841,0x20e30000,0x20c218a1,0x00000000,0xe71b6b4c,0xffffffff,0xffffffff,0xffffffbe,0xce38f79e,0x08006acb,0x00210020,0x00000020,0x10000000,0x10000800,0x10001000,0x08000800,0x00000800,0x00000021,0x18c30861,0x18c410c3,
-0x00010842,0x00200001,0x18600000,0x08000800,0x20401820,0x28a21820,0x20c32082,0x00001041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08210000,0x08000000,0x186020a2,0x00001040,0x00000000,0x00000800,0x08a20000,0x00000000,0x10001001,0x00000820,0x00000000,
-0x00000020,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x08411082,0x5a490000,0xffbee67a,0xffbeffff,0xfffffffe,0xffdfffff,0xe71bffff,0x08610000,0x080020c3,0xbd955228,0xde9aff9e,0x00200000,0x00000841,0x00000000,0x10a20840,0xc5d60000,0xffdeffff,0x08008c10,0xacf31000,0xffdfffde,0xffffffff,0x0000b595,0x7bce0000,0xfffef77d,0xffdeffde,
-0x0000bdd6,0x732c0000,0xffffef5c,0xffdef77d,0x0000b575,0x94500000,0xffdeffbe,0xffffffde,0x2903e6fb,0x5a8a0000,0xffbeef3c,0xffffffff,0x5aaaef5d,0x00000000,0xffffd69a,0xffffffdf,0x732cf77d,0x20c20800,0xff9dd679,0xffbeffbe,0x9470f77d,0x00000800,0xffffb554,0xffffffbe,0xeedbffff,0x08003104,0xe6fb5a89,0xff9dffbe,0xde99ffde,0x00002924,0xef1c4a08,0xffdfffff,
-0xff9effdf,0x08009430,0xce380800,0xf79effff,0xde9affdf,0x10002882,0xd6591840,0xb534ffdf,0x10a20000,0x00000020,0x00000000,0x00000000,0x52890000,0x00004a48,0x08200000,0x21240841,0xad550000,0xffdfffff,0xffffffbe,0xffffffff,0xffffffff,0x1800e69a,0x00200800,0x31650000,0x628862a9,0x390351c6,0x41244944,0x08001820,0x00000800,0x08a20000,0x00000000,0x00000800,
-0x00210000,0x00000000,0x08001860,0x51e63103,0x28a130c1,0x08002881,0x08001020,0x08210820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18401861,0x30c22061,0xa4715185,0xa4f3ad14,0x9cd2a4d3,0x000062ea,0x10410841,0x59e81000,0xd679cdf7,0x4a69ce38,
-0x10a20000,0x00000821,0x94513966,0xa4b29cb2,0xacd3acf3,0xa4f3a4d2,0x5aeb9cf3,0x20e40820,0x83ae0800,0xffffffdf,0xffffffbe,0xffdfffff,0xffdeffbe,0xd6baffff,0x20a20000,0x49860800,0xffffe6ba,0xdebaffff,0x00400000,0x00000841,0x00000000,0x10a20000,0xc5d70000,0xffdeffff,0x4a27e6fb,0x08200000,0x947183ef,0xad54a4f3,0x000039c6,0xd69a0800,0xffdfffde,0xffdff7be,
-0x8c50ffde,0x00000000,0x83ae6b0c,0x83cf8bef,0x00003985,0xd6791840,0xffffffff,0xffbeffdf,0xa534ffff,0x00000000,0xa4f36b4c,0xc5f7ad14,0x00009451,0xa4b20000,0xffdfffbe,0xf79effdf,0xbdd6ffff,0x00000000,0x7b8d4a28,0x83cf734d,0x10207b8e,0x39a60000,0xffdeef3c,0xffdefffe,0xffffffbd,0x0800b575,0x5aaa0000,0x7b4d734d,0x628a9410,0x00000800,0xffffb575,0xffdef7be,
-0xffffffde,0x2020de59,0x62890800,0x94109430,0x6acba492,0x08000800,0xffbe83ef,0xb555ffdf,0x10a20000,0x00000000,0x00000000,0x10820000,0xb5750000,0xad34ef5c,0x000039c6,0x18c31082,0xa5140000,0xffdfffff,0xf77dffff,0xfffff79d,0xffbeffff,0x2021eedb,0x21030800,0xad540000,0xef3bf7bd,0xe6bae6ba,0xeefbeefb,0x9451e6ba,0x10a20000,0x00001061,0xad344a28,0xacf3b534,
-0x08205229,0x18820800,0x52280000,0xe6bade79,0xd617de59,0xb555d618,0x20823945,0x08001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18000800,0x304030a2,0xff9db4d2,0xffdeffdf,0xffffffde,0x0000c617,0x108110c2,0x49860800,0xffdef71b,0xc617ffff,
-0x10c20000,0x00000020,0xeefb1000,0xffbeffff,0xffdfffdf,0xffffffdf,0xad75ffff,0x31250000,0x836d0800,0xfffff79d,0xe6fbffde,0xff5dd618,0xffffffdf,0xce58ffff,0x20610000,0x626a1000,0xfffff75d,0xd699ffdf,0x00400000,0x00000841,0x00000000,0x10a20020,0xc5f70000,0xffdeffff,0x9cb1ffde,0x21230000,0x10200000,0x00000000,0x00001061,0xffbe9cb2,0xffffffff,0xffdfffff,
-0xe6fbffff,0x002018c2,0x10000800,0x08000800,0x08002061,0xffbe7b8e,0xffdeffdf,0xffffffdf,0xef7dffff,0x000052a9,0x08000800,0x08000800,0x00000000,0xef1c4a08,0xffbeffff,0xffffffff,0xf7deffff,0x00006b4c,0x00000800,0x08000800,0x28a20800,0xbdb60800,0xfffeffde,0xfffefffe,0xfffffffe,0x3144e6fb,0x00001040,0x10000800,0x08001000,0x5a890000,0xffbef77d,0xffffffff,
-0xffdfffff,0x9410ffbf,0x10000800,0x10001000,0x08001000,0x000028e3,0xffdfce17,0xb534ffdf,0x18c30000,0x00000000,0x00000000,0x18c30000,0xad340000,0xffffffff,0x0000b596,0x20e30841,0x94710000,0xffbeffdf,0x62aabd96,0xad546b0b,0xffffe71b,0x2842f71c,0x20c30800,0xc6180000,0xffffffff,0xffffffdf,0xffdfffff,0x7b6dffbe,0x10a20000,0x00002104,0xffdfad34,0xf73cffdf,
-0x00003104,0x28e31841,0xbdb60000,0xffffffdf,0xffffffff,0xffbfffdf,0x0800ad13,0x08003104,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x28a10820,0x8b6d2000,0xffdeff5c,0xffdfffdf,0xffffffff,0x6b4cf7bd,0x08810000,0x080018a1,0xffbeb513,0xffdeffbe,
-0x0000840f,0x20e32124,0x83ef0000,0xffffffbe,0xfffeffde,0xffdeffde,0xb595ffff,0x31040000,0x51a71800,0xd699ef1b,0x08408c71,0x6acb0800,0xeebbbd55,0xbdd6ffff,0x20c20000,0x72eb1000,0xffdeff9e,0xdebaffff,0x00200000,0x00000861,0x00000000,0x08610040,0xc5f70000,0xffffffbe,0x41e7ef1b,0x00000000,0x08000800,0x08001000,0x000028e3,0xffdfacf3,0xffdeffde,0xffdef7de,
-0xbdb6ffdf,0x08000000,0x51c73925,0x49864945,0x10001000,0xd6590800,0xffdfffff,0xffdeffdf,0xe6daffdf,0x00003985,0x30c30800,0x08002841,0x08000800,0xde7a3945,0xffbeffff,0xffdeffdf,0xf77dffdf,0x00005aaa,0x31042061,0x390349a6,0x20614144,0x94710800,0xffffffde,0xffdeffde,0xffdfffde,0x08009c92,0x49c61840,0x51c66289,0x414551e7,0x4a070800,0xffdfeefb,0xffdfffff,
-0xffdeffdf,0x6a8af71c,0x41a60800,0x730c732c,0x5228730b,0x00001020,0xffbe9c71,0xacd3ffdf,0x18c30000,0x00000000,0x00000000,0x18a30000,0xbdb60000,0xffffffff,0x0000c5f7,0x18c31082,0x7bce0000,0x83efce38,0x00000800,0x00000000,0xad553a07,0x1000bd75,0x10a20000,0xbdf70000,0xffffffff,0xffffffde,0xffdfffbe,0x0000bd96,0x10a218c2,0x4a070000,0xffffef3c,0x9430ffbe,
-0x18a10800,0x00001081,0xef5d62eb,0xffdfffff,0xffbeffdf,0xffffffdf,0x732cf77d,0x18810800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000000,0x100020e2,0xeeba4903,0xffdeffde,0xffdfffff,0xffdeffde,0xc617fffe,0x19240000,0x08001081,0xf71b3903,0xffffffde,
-0x0000ce59,0x00200840,0x00001081,0xffffd679,0xfffeffff,0xffffffde,0x9cf3ffff,0x28e30000,0x20410800,0x082062cb,0x10400000,0x10002081,0x30a21000,0x9491b555,0x20c20000,0x838e1000,0xffdeff9e,0xdebaffff,0x00400000,0x00000041,0x00000000,0x10a20000,0xc5d70000,0xffdeffff,0x08009cb2,0x83cf0000,0xce18d659,0xad13ce18,0x00001861,0xe6ba1020,0xffdeffff,0xffffffde,
-0x41a6ef1b,0x62aa0000,0xeefbe6ba,0xeefbe6bb,0x0800bd75,0x6aec0800,0xffbef77d,0xffffffff,0x9430ffdf,0x08000000,0xe69a9410,0xd638d638,0x00009471,0x732d0000,0xffdfffbe,0xffdfffff,0xbd96ffdf,0x00000000,0xeefb9c92,0xe6bae6ba,0x83aeeeda,0x08000800,0xffdfd679,0xffffffff,0xd679ffff,0x08002061,0xe6ba1800,0xeefbff5d,0xcdd7ff5d,0x08001800,0xffdf9c71,0xffdfffdf,
-0xffdfffff,0x08009c71,0xc5d70800,0xf77dffde,0xdebaffbe,0x000041c6,0xde9a1000,0xb514ffbe,0x10a20000,0x00000820,0x00000000,0x18a20000,0xc5d70000,0xffffffdf,0x0000bdb6,0x00201082,0x29650000,0x00000000,0x20c31040,0x21031881,0x00000000,0x18410800,0x18a20000,0xc6170000,0xf7beffff,0xffdfffff,0xef3cffff,0x00005229,0x18c218a2,0xb5750000,0xffdfffff,0x20a2de9a,
-0x18a20000,0x000018e3,0xffffbdf7,0xffdfffff,0xffdfffff,0xffbeffdf,0xe6dbffff,0x00004a28,0x00201081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x20601880,0xffdec534,0xffffffde,0xffffffdf,0xffffffff,0xf79dffde,0x00006b2c,0x20a21041,0xad130800,0xffffffff,
-0x9471ffdf,0x20e30800,0x000018c2,0xffbe736d,0xffffffde,0xffdeffdf,0xa4b2ffff,0x20c30000,0x08400020,0x00000000,0x20c22923,0x28e31020,0x082028e3,0x00000000,0x18810040,0x8bae1000,0xffdeffbe,0xdebaffdf,0x00400000,0x00000020,0x00000000,0x10a20020,0x8c300000,0xbdb6deda,0x000028c4,0xe6fb30e4,0xffffffff,0xffdfffff,0x00008c50,0x83ce0000,0xff3cff5d,0xf6fbff5c,
-0x00009c71,0xc5f70800,0xffffffff,0xffffffde,0x7b8ef79e,0x00000800,0xeefcacf4,0xff3deedb,0x0800c5b6,0x31040800,0xffffe6fb,0xffffffff,0x5acaef7d,0x08000000,0xef1cacf4,0xf73df6fc,0x4166e67a,0x39450800,0xffffef3c,0xffdfffff,0xe6daffdf,0x00001841,0xde797b4d,0xeedbeeda,0x836deebb,0x08000800,0xff9ea4b2,0xffdfffff,0xffbeffff,0x10009430,0xc5b628e3,0xe6baeefb,
-0xb534eefc,0x08000800,0xffbe83ef,0xffffffff,0xffffffff,0x1000b575,0x6b0b0000,0x730bc5d7,0x08400800,0x00000020,0x00000000,0x18a20000,0xbdd60000,0xffdfffff,0x0000c5f7,0x00201082,0x00000020,0x28e31040,0x18811061,0x18a20800,0x210310a1,0x00001061,0x21030000,0xbdd70000,0xffffffff,0xffbeffdf,0x9cb3ffdf,0x20c30000,0x00001082,0xef7d5acb,0xffffffff,0x0000c5b6,
-0x08602903,0x6b6d0000,0xffffef9e,0xffffffff,0xffffffff,0xffdfffdf,0xffbeffde,0x0000734c,0x002010a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x10001060,0xffbfcdb6,0xffffffdf,0xffffffdf,0xffbeffdf,0xffffffff,0x0000ce59,0x28c30800,0xc5b61000,0xffdeffde,
-0xef5dffff,0x00005249,0x084010a2,0xce181020,0xffdeffff,0xffffffde,0xa4d3ffdf,0x21030000,0x00200000,0x414528c2,0x28811800,0x00002061,0x10811860,0x00801903,0x18c20020,0x93ef0800,0xffffff9e,0xd699ffff,0x00400000,0x00000020,0x00000000,0x00000000,0x00001040,0x00000000,0x00001020,0xffdfb535,0xffffffdf,0xfffff7de,0x41c6e6fb,0x00000000,0x72aa6249,0x496559c7,
-0x08000800,0xff9e8bef,0xf7deffff,0xffdeffff,0xdebaffff,0x080018a2,0x20211820,0x38e42842,0x20821000,0xb5340800,0xffffffff,0xf7fef7fe,0xbdf7ffff,0x08400000,0x20211000,0x494538c4,0x18002000,0xb5341000,0xffbeffdf,0xffdeffdf,0xffbeffdf,0x0000a4f3,0x18200800,0x20202020,0x18002820,0x6b0b0000,0xffdff73d,0xffffffbe,0xfffff7be,0x51e7eefc,0x10000800,0x38a22000,
-0x080030c3,0x31440000,0xffffdeda,0xffffffff,0xffdfffde,0x7b6dff7d,0x00000000,0x00000800,0x00000820,0x00000000,0x00000000,0x18c30000,0xbdb60000,0xffdfffff,0x0000ad34,0x00201062,0x08600000,0x20c21861,0x00000000,0x000028e3,0x18c20000,0x000018a1,0x18e30000,0xa4f30000,0xffffffff,0xffffffff,0x1000d639,0x10620801,0x00001061,0xffffc638,0xffdfffdf,0x5269ef1c,
-0x21240000,0x630c0000,0xfffff79e,0xffffffdf,0xffdfffdf,0xffdfffff,0xad34ffdf,0x10810000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000860,0xf71c51a6,0xffdfffff,0xffffffdf,0xffdeffff,0xffffffbe,0x0000bdd7,0x180020e3,0xf6fb4904,0xffffffde,
-0xfffff7de,0x0000c5d7,0x10a218c3,0x62690000,0xffdfef3c,0xf75cffff,0x3166ad34,0x08200000,0x28a10800,0x48a33020,0xcdb68b2c,0x9430de59,0x00000800,0x088118e3,0x00400000,0x41450800,0xffdec5f7,0xd699ffff,0x00400000,0x00000841,0x00000000,0x00000000,0x18401020,0x00000000,0x100018a1,0xffdfd658,0xfffeffde,0xfffffffe,0x9c92ffff,0x29240000,0x08000000,0x08001000,
-0x00002081,0xffbe9c71,0xfffeffde,0xffffffff,0xef5dffff,0x00004a28,0x00000000,0x00000800,0x08200000,0xef1c3965,0xf7feffff,0xfffff7ff,0xf79dffff,0x0000632c,0x000020c2,0x10000800,0x28c20000,0xd6790000,0xffdeffff,0xffdfffff,0xffffffdf,0x0000c5f7,0x000020e2,0x08000000,0x20810800,0x94910000,0xffbfffdf,0xffdfffdf,0xfffff79e,0x4166eefb,0x00000800,0x10000800,
-0x08000000,0x8c300000,0xffdeffff,0xffffffff,0xffffffdf,0x62aaff5d,0x00000000,0x00000000,0x00000820,0x00000000,0x00000000,0x10a20000,0xa5340000,0x83efd699,0x00001882,0x00000821,0x20c20000,0x00000000,0xb5755249,0xacf3deba,0x000041c7,0x18410000,0x10410000,0x20c30000,0xde9a9431,0xff9effbe,0x08007b6e,0x20e318a3,0x84100000,0xf7ffffff,0xffdfffff,0xbdd6ffff,
-0x18c30000,0x00001082,0xffdea4f3,0xffdfffff,0xffdfffdf,0xffbfffbe,0x1841de9a,0x10410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00200000,0x18a20020,0x94301000,0xffffffbe,0xffdfffdf,0xfffff7df,0xef3cffff,0x0000528a,0x08002103,0xffbea430,0xfffeffff,
-0xffffffff,0x738effbe,0x10a20000,0x000020a3,0xe6fb9c92,0x41a6ad13,0x00000000,0x08000041,0x30402081,0xddb682eb,0xffbeff5d,0xffdfffde,0x7b6dd679,0x00000000,0x00000881,0x00001882,0x8c0f0800,0xd69ae6db,0x08610000,0x00001082,0x08000000,0x08000020,0x00000000,0x31644a28,0x00001060,0xffbe83ae,0xffdeffff,0xffdeffde,0x62cbf75c,0x08000800,0x738d736d,0x62eb6b0c,
-0x00003965,0xd6791000,0xffbeffff,0xffdeffbe,0xa4d3ffdf,0x10600800,0x738d5a89,0x6b4c6b2c,0x00005289,0xbdd60000,0xf7beffff,0xffbef7de,0xd69affdf,0x00002964,0x5aaa1040,0x734c734c,0x000062eb,0x736d0000,0xffdef79d,0xffdeffde,0xf77dffff,0x0000736d,0x4a481881,0x52485289,0x3185630b,0x00200000,0xffdfd679,0xffdfffdf,0xffbeffdf,0x0800a4b2,0x5aca0000,0x7bae8c0f,
-0x5aaa83ef,0x4a080000,0xffffef1c,0xffbeffde,0xffbeffdf,0x0800b514,0x8c300000,0x736ddeba,0x10810000,0x00000000,0x00000000,0x00000000,0x31850000,0x00000000,0x08400000,0x00000000,0x00001061,0xb5555228,0xffdff75d,0xffffffbe,0x9cb2ef1c,0x080049e8,0x00001841,0x00000800,0x00000800,0x943183ae,0x10000000,0x00000820,0xd6ba0000,0xf7deffff,0xffdfffdf,0xf79effdf,
-0x0000632d,0x00002924,0xd6790000,0xffdfffff,0xffbeffbe,0xf77dffdf,0x08007b4d,0x00001862,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00200020,0x18002082,0xffdfcdd7,0xffffffbe,0xfffeffde,0x9cf3ffff,0x21030000,0x39240800,0xffdee699,0xf7deffde,
-0xffffffff,0xc638ffff,0x10a20000,0x00000020,0x18610000,0x00000000,0x006118e3,0x18820000,0xa4502020,0xffdef73c,0xffdefffe,0xffffffde,0xef5dffff,0x39a6b596,0x00410000,0x08610000,0x00001040,0x734d3124,0x00000861,0x00000000,0x00000000,0x10810000,0x94300800,0xc617ef5c,0x08000820,0xce370820,0xffdfffff,0xffdfffdf,0x08009c91,0xa4f30000,0xf7bef77d,0xf79df7be,
-0x0000a4f3,0x83ce0800,0xffdfff9e,0xffdfffdf,0x1820de59,0x83cf0800,0xf79df75d,0xf7beef3c,0x0800d69a,0x42070800,0xffdff73c,0xffffffdf,0x6b2cf75d,0x00000000,0xef7da4f3,0xf7deef9d,0x73cee75c,0x00000000,0xffffb595,0xffffffde,0xbd96ffff,0x00000000,0xef3c5269,0xe71be73c,0xbdd6ef9d,0x00000000,0xff9d736d,0xffbeffdf,0xe6baffff,0x08002061,0xce380800,0xf7beffff,
-0xce38ffff,0x08000800,0xffdfa4d3,0xffffffff,0xef3cffdf,0x00003965,0xd6791020,0xa4f3ffdf,0x21030000,0x00000000,0x00000000,0x00000000,0x00000000,0x10611061,0x08602103,0x18a20000,0x8c500000,0xffdfef3c,0xffdfffdf,0xffdfffdf,0xffffffdf,0x4166de7a,0x18820000,0x08400000,0x000018c2,0x00000000,0x08200820,0x000020e3,0xffdf9cd3,0xffffffff,0xffffffff,0xffffffbf,
-0x0000d69a,0x21030000,0x52690000,0xffdef75d,0xffdfffdf,0xacf3ffdf,0x18820000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00200000,0x08000000,0x08001841,0xeedb51e7,0xffffffff,0xffffffde,0x0060d6da,0x18e20000,0x838d0000,0xfffeffbd,0xffffffff,
-0xffffffdf,0xffffffff,0x00009492,0x084018e3,0x00000820,0x28e328c3,0x002018c3,0x20c30041,0xc5752000,0xffdefffe,0xfffef7de,0xffdeffff,0xffffffdf,0x7bcfffff,0x10e30000,0x08a20000,0x290320c2,0x00000000,0x00200020,0x00000000,0x00000000,0x20e30000,0xb5750000,0xffffffff,0x08209451,0x5aeb0000,0xcdd7c5b6,0xacf3d618,0x00000800,0xff9e6aeb,0xffdeffff,0xffffffff,
-0x5228ef3c,0x08200000,0xc5b69c51,0xcdd7cdd7,0x080062aa,0xe6ba2000,0xffdeffdf,0xffffffff,0x9c71ffff,0x00000000,0xeedb9c72,0xeedbe6ba,0x00009c92,0x5a691000,0xfffff75d,0xffffffdf,0xd699ffff,0x00000000,0xbdb64a07,0xbd95cdf7,0x5a69bd95,0x08000800,0xffffbd96,0xffffffff,0xf7beffff,0x00006b2c,0x8c300000,0xad14b555,0x7b4db514,0x08000000,0xffde83ef,0xffffffff,
-0xffbeffff,0x10008bcf,0xbdb63124,0xc5f7ce58,0x9c92d658,0x00000000,0xffdf83ae,0xacf3ffdf,0x18c30000,0x00000000,0x00000000,0x00000020,0x08200000,0x18c218c2,0x00000000,0x18c20840,0xbdf70000,0xffbeffff,0xffdfffff,0xffffffff,0xffffffdf,0x628aff5d,0x10610800,0x00000020,0x18e20000,0x10a12123,0x08410020,0x29250000,0xffffe73c,0xe6fcffdf,0xce38ce18,0xc5d7ce18,
-0x3186ad55,0x00200000,0x000018a2,0xbdd68c30,0xad34bd95,0x20829451,0x08200000,0x08000821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x18611821,0x18611020,0x730b0000,0xacd3a4b2,0xad54ad13,0x000073ad,0x082010c2,0x5a480800,0xc595acf2,0xe67ad617,
-0xffbef73c,0xffffffde,0x0000d659,0x08000820,0x20c20000,0x08001840,0x00000000,0x18411061,0xc5552800,0xffdeffdf,0xfffeffde,0xffffffff,0xffffffbe,0x73ceef9d,0x08a20020,0x00000840,0x00000000,0x20e33104,0x00200000,0x00000000,0x00000000,0x10610000,0x83cf0000,0xe6fbd699,0x0000ad35,0x000010a3,0x08000000,0x00000000,0x000020e3,0xe6ba9c71,0xeefbe69a,0xeedaeedb,
-0x6b0bde79,0x10810000,0x00000800,0x00000000,0x00000800,0xf6fb7b2c,0xff1cff3c,0xff1cff1c,0xcdf7ff5d,0x18810000,0x18200800,0x18612082,0x20c20000,0xa4b20800,0xe6dbe6ba,0xe69ae69a,0xd658de79,0x000062aa,0x00001040,0x00000000,0x00000000,0x00000800,0xde99c5d7,0xd658de99,0xc5f7ce17,0x080083ae,0x000018a2,0x00000000,0x00000801,0x000018c3,0xd6599430,0xd679de99,
-0xd67ad679,0x08009410,0x00001882,0x00000800,0x00000000,0x00002103,0xc5b67b8e,0x7b4dcdf7,0x08410000,0x00000000,0x00000000,0x00000000,0x00000840,0x00000000,0x420762eb,0x20c20000,0x84300000,0xfffff7be,0xffffffdf,0xffffffff,0xffdfffff,0x49a7f71d,0x10a20000,0x00200000,0x00002944,0x20e30000,0x18a20840,0xad550000,0xffffffff,0x6aecef3c,0x00000000,0x00000000,
-0x00000000,0x00200000,0x18e20000,0x00000000,0x00000000,0x08000000,0x08001040,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x20410800,0x08001000,0x10601861,0x08001881,0x08001000,0x00000800,0x10a10000,0x08000000,0x00000800,0x08000800,0x10000800,
-0xde5938e4,0xffdeffdf,0x83aeffbe,0x18c20000,0x08001881,0x732c1000,0x5228bd55,0x28e30000,0xcd761800,0xffbeffdf,0xf7feffff,0xfffff7de,0xffffffff,0x5b2cf79e,0x19230000,0xad130000,0x3985b575,0x00000000,0x00000841,0x00000020,0x00000000,0x00000000,0x00000820,0x08400000,0x08210000,0x10a20000,0x18c30862,0x10a218e3,0x00200000,0x10000000,0x18001800,0x20412821,
-0x00000800,0x00000020,0x18c31081,0x210318a3,0x000010a2,0x39042082,0x728a4986,0x51656a49,0x41864145,0x00001020,0x08001040,0x00000800,0x00000820,0x10000800,0x10001000,0x18001800,0x00001000,0x00001840,0x10a30000,0x18e41083,0x082118a3,0x18610000,0x08000000,0x08000800,0x08000000,0x10000800,0x08620000,0x18c42105,0x108210a3,0x10810000,0x08000000,0x08000800,
-0x00000000,0x08000800,0x18c20800,0x10c20840,0x084018a2,0x00200000,0x00000000,0x00001000,0x00000800,0x00000000,0x00000000,0x00200000,0x29440000,0xc5f783ce,0xb554ff9e,0x29240000,0x6b4c0000,0xfffff79e,0xffffffff,0xffdff7df,0xfffff7df,0x51a7f71c,0x10810000,0x10c20000,0xd699ce38,0x18a18c0f,0x18c218a2,0xa4f40000,0xffffffdf,0x0000ad34,0x18a23144,0x312420c2,
-0x20803103,0x18a220a1,0x00200000,0x10c210c2,0x18c22103,0x21032924,0x20a120a1,0x29030800,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x38622841,0x5a07728a,0x08400000,0x20c30800,0x20e42945,0x18c218a3,0x00200881,0x18a30040,0x28e32062,0x21232903,0x10a210c2,
-0x6aeb0800,0xfffff77d,0x62ebef3c,0x20c20000,0x5a481000,0xffdec5f7,0x4a28f77d,0x20e30000,0xc5961000,0xffdeffdf,0xf7ffffff,0xffffffff,0xffffffdf,0x4a48ef3c,0x18c20000,0xde791000,0xe6fbffdf,0x41c6a4f3,0x00200000,0x00000000,0x00000000,0x00000000,0x08400000,0x00200020,0x00000000,0x00000000,0x00000841,0x00200000,0x00000000,0x00000000,0x08210841,0x08200820,
-0x00000841,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x08000800,0x10810000,0x08400820,0x08000000,0x00000000,0x08400020,0x08400840,0x00200860,0x00200000,0x00000000,0x00000021,0x00000021,0x00000000,0x08400020,0x10411041,0x18c218a2,0x00000820,0x00200000,0x00000000,0x00000000,0x00000000,0x10600840,0x08400840,
-0x086110a2,0x00000000,0x00400000,0x00000040,0x08200000,0x00000000,0x10a20881,0x080018a2,0x00000820,0x00000000,0x00000000,0x18c20000,0xa4d20800,0xffdfffbe,0xe6daffff,0x18611820,0x5aaa0800,0xffffef7d,0xffffffdf,0xf7dfffff,0xffdff7be,0x3022ff1d,0x10810800,0x18c20000,0xffbfef3c,0xa4d3ffbe,0x20e40800,0x00000800,0xe71bd659,0x00002924,0x18811040,0x00000800,
-0x08001000,0x00000800,0x00001040,0x08610000,0x00000000,0x00000000,0x08000000,0x9cb1b554,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x380040c2,0xe658934d,0x08606b2b,0x00001861,0x00000000,0x00200000,0x00200000,0x00001882,0x08000800,0x00000000,0x08810020,
-0x08002103,0xffdfa4b2,0x0000ad34,0x28e32103,0xcdf72020,0xfffeffff,0x39e6ef3c,0x18e20000,0x7b4d0800,0xffffe6db,0xf7feffff,0xffffffff,0xffffffbe,0x18a2e6fb,0x08000000,0xde792861,0xffffffff,0xc5f7ffff,0x10a20000,0x00000000,0x00210000,0x00000000,0x00000000,0x00600040,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00210021,0x00410041,0x08410021,
-0x00200020,0x00000000,0x00000000,0x00000000,0x00200000,0x08810000,0x10c20881,0x10a11081,0x08610861,0x00000000,0x00000840,0x00000000,0x08200000,0x00400000,0x00400060,0x00400040,0x08610040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000821,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00400040,
-0x00200041,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x00000020,0x00000000,0x00000000,0x00000000,0x18a30000,0xbdb60000,0xffdeffdf,0xef3cffdf,0x08005228,0x41c60800,0xffffe71c,0xffffffff,0xffffffdf,0xff9effdf,0x2822cd97,0x10611000,0x00200000,0xffffdedb,0xf77dffff,0x00004a08,0x000020e3,0x6b0c5a8a,0x08400000,0x00001881,0xa4b241e7,
-0x9c71acf3,0x6b0b8bef,0x18611000,0x00000000,0x6b2d2104,0x9c928c31,0xbd95acf3,0xa4b2ff9d,0x18e30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20600000,0x404048e1,0xff7d9b4c,0xdebaff5c,0xd679deba,0xad95d6ba,0x00002103,0x38e22060,0xacb23082,0xacd2bd55,0x8c70a4f3,0x00002103,
-0x00001061,0xad1320c2,0x00004a28,0x00002903,0xff7e836d,0xffffffbe,0x4a48ef5c,0x10810000,0x08001021,0xbd7549a6,0xfffff77d,0xffffffde,0xdebaffbe,0x000083ef,0x08001081,0xeeba3082,0xffdfffdf,0xd69affff,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,
-0x00200000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000800,0x00000020,0x00000000,0x00000000,0x00200000,0x00000020,0x00000020,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,
-0x00000020,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x00000000,0x18c30000,0xb5950000,0xffdeffff,0xff9effff,0x10006aeb,0x20811800,0xffffdeda,0xffffffde,0xffdfffff,0x8bcfe69a,0x08001800,0x08001061,0x21040000,0xffffe71c,0xffffffdf,0x0000b576,0x106120e4,0x00000000,0x00200861,0x000010a1,0xffffb595,
-0xffbeffdf,0xe6dbffdf,0x08006269,0x00001061,0xdedb1062,0xffdfffbf,0xffbeffff,0x8baeffbe,0x18c30800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20800000,0x50a05122,0xff3ca38c,0xffffffbe,0xffdfffff,0xc637ffff,0x18800000,0x302038a2,0xff7da430,0xffdeffde,0xffdeffde,0x0000b554,
-0x106120c3,0x00000000,0x18610000,0x206120a2,0xffdfde38,0xffffffbe,0x31c6f79d,0x20c30000,0x18820800,0x08000000,0xe6ba7b6d,0xe6daffbd,0x08009c92,0x00000000,0x100020e3,0xf71c2820,0xffdfffff,0xd679ffff,0x10a20000,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,
-0x00200000,0x00000000,0x00000000,0x00200020,0x00000000,0x00210000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x00200000,0x00000000,0x00000020,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,
-0x08210000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x00000000,0x00000000,0x00000000,0x10a20020,0xa5140000,0xffffffff,0xffbeffdf,0x10008bae,0x080028c3,0xce59840f,0xffbef79d,0xa4b2e6fb,0x08002883,0x00200820,0x18a20000,0x08210820,0xffdfef5d,0xffdfffdf,0x7b8ef79e,0x18a30000,0x10a21882,0x00200000,0x630c0000,0xfffff79e,
-0xffffffff,0xffffffdf,0x0800bd35,0x10a22904,0x94920000,0xffdfffdf,0xfffff7de,0xacb2ffbe,0x18a20000,0x10610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x28a00000,0x69636184,0xff5ca38c,0xffdeffbe,0xffffffdf,0x5aebf79d,0x28e20000,0x51034081,0xfffee699,0xffdeffde,0xfffffffe,0x5228f75c,
-0x10a20000,0x10410841,0x28a31861,0x9c311000,0xffffffbe,0xffffffff,0xa534ffff,0x00000000,0x10a218a2,0x28c220c2,0x28810800,0x28e37b4c,0x08400000,0x20e318a2,0x18000800,0xff9eacd3,0xffffffff,0xd69affff,0x08610000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0x00000021,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000021,0x08410000,0x00000000,0x00000841,0x00000000,0x00000020,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00200020,0x00000000,0x20a30000,0x94920000,0xffffffff,0xffffffde,0x08009410,0x18a22903,0x00000000,0x8bf0732c,0x00003124,0x20821800,0x088110a2,0x00002104,0x7bcf0000,0xfffff79e,0xffffffff,0xce39ffff,0x08200000,0x00000800,0x18c21081,0xc6380000,0xffffffff,
-0xffffffff,0xffffffdf,0x2061e6ba,0x10a20000,0x00000000,0xffffdebb,0xffdef7de,0xb513ffff,0x18c31000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31020000,0x590169e6,0xff5c9b8c,0xffffffff,0xffffffdf,0x0000c638,0x28a20880,0xc4d32800,0xfffeffde,0xffdeffde,0xffdeffff,0xc5f7ffff,
-0x08820000,0x08200040,0x08001861,0xeedb38c3,0xffdeffff,0xffffffff,0xffffffff,0x7baede9a,0x00000000,0x10400000,0x08002081,0x08000800,0x108118a2,0x08000000,0xd63972cb,0xffffffff,0xffffffff,0xd6baffff,0x00610000,0x08610881,0x00000000,0x00000000,0x08810000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x08610841,0x00410881,0x00610000,
-0x08410020,0x00000841,0x00000000,0x00000000,0x08210000,0x00000000,0x00200841,0x08410020,0x08400020,0x00200020,0x00200020,0x08410000,0x08400841,0x10201840,0x08411020,0x08410841,0x106118a2,0x08410841,0x00000841,0x00200000,0x08610000,0x108210a2,0x10a210a2,0x18821061,0x10a218a2,0x084118e3,0x00200000,0x00000020,0x18e31082,0x108218c3,0x10a218c3,0x20e318c2,
-0x18a218c2,0x18a32104,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x10820820,0x18c210a2,0x18e310c2,0x18c32104,0x28e418a2,0xa4f30000,0xffffffff,0xffffffff,0x5aaade99,0x00000000,0x10612103,0x00000000,0x20a20000,0x10001821,0x00200000,0x39c60000,0xf79ebdd7,0xffdfffff,0xffdfffff,0xffbeffdf,0x00009472,0x000018a2,0x000010a2,0xffff9cd3,0xffffffff,
-0xffffffff,0xffdfffff,0xad14ffbe,0x10810000,0x000020e3,0xffff9451,0xf7def7fe,0xe699ffde,0x00004a28,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28a10000,0x508069c5,0xffbdcd74,0xfffffffe,0xffffffdf,0x00008c71,0x08001923,0xfebb5966,0xfffefffe,0xffdefffe,0xffffffde,0xffbeffff,
-0x00207bce,0x084008a1,0x10002061,0xffbec596,0xffdeffff,0xffffffff,0xf7beffff,0xf77dffff,0x52aabdd7,0x10810040,0x18610000,0x084020c2,0x00000861,0xc576628a,0xffdfff5d,0xf7ffffde,0xffffffff,0xd6dbffff,0x00400000,0x088208c2,0x000010a2,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000020,0x08400000,0x10a218c2,0x00000000,0x18c20000,0x108110c2,
-0x10c318c3,0x00200020,0x00000000,0x00000020,0x10a20861,0x10c218c3,0x10c218c3,0x18e310a3,0x18e210e2,0x00000861,0x00000040,0x08200000,0x00001081,0x00000000,0x10810820,0x00000000,0x10000000,0x00000000,0x10810000,0x00200000,0x00000040,0x00000000,0x00000000,0x08000800,0x00000000,0x00000000,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x94920000,0xffffffff,0xffdfffff,0xff9effdf,0x83efd659,0x10810000,0x18a220c3,0x000018a2,0x00000800,0x634c39e7,0xdefb94b2,0xffffffff,0xffdfffff,0xffffffff,0xffffffff,0x0000ce38,0x18a21081,0x8c710000,0xfffff7be,0xffffffff,
-0xffffffff,0xffdfffff,0xde59ffdf,0x08400000,0x000020e3,0xffffad34,0xfffeffff,0xb4d3ff7d,0x00003986,0x00200841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20200820,0x484050e2,0xffdee617,0xf7deffde,0xf79effff,0x00207bce,0x000010e2,0xee9a48e4,0xfffeffff,0xffffffff,0xffffffff,0xffffffdf,
-0x39c6e73c,0x10a20000,0x41860000,0xffdff73c,0xffffffbe,0xfffffffe,0xffffffff,0xffdfffbe,0xf7beffff,0x2944ad34,0x10610000,0x00000000,0x080010a2,0xff5ea452,0xffdfffbf,0xf7fff7de,0xf7deffff,0xdefbffff,0x00000841,0x00000040,0x18820000,0x00000000,0x00000000,0x00000821,0x00000000,0x00000000,0x00000000,0x00000861,0x00000000,0x21030800,0x00000820,0x00000000,
-0x00000000,0x10820000,0x00200000,0x10810000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00001041,0x00200000,0x084018c2,0x00000000,0x20a30000,0x418641c7,0x18611020,0x000041c7,0x00000020,0x21240000,0x52694208,0x52085a8a,0x5a695208,0x5acb630c,0x39e76b6d,0x08210000,0x00000820,0x8410630c,0x841083ef,0x7bae7bef,0x736d73ae,
-0x734d736d,0x8c307bcf,0x00004a28,0x00000020,0x00000000,0x00000000,0x00000820,0x8c513165,0x7bef8c50,0x8c517bef,0x840f8c30,0x83cf8410,0xc6387b8e,0xffdeffff,0xffdfffff,0xff9effdf,0x7b8edeba,0x18c20000,0x00000000,0x08400000,0x000018a2,0xce595269,0xffffffff,0xffffffbe,0xffffffdf,0xffffffff,0xf77effff,0x0000630c,0x18a21882,0x83ef0000,0xffffef7d,0xffffffbe,
-0xffffffff,0xffdfffff,0x72ebff3d,0x10810800,0x00001882,0xffffa4f3,0xffdef7de,0x726aff5d,0x18820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20200000,0x50a150e2,0xfffeddf6,0xffffffde,0xe75dffff,0x000031c6,0x20c20840,0xb5141000,0xfffeffff,0xffdefffe,0xf7deffff,0xffffffff,
-0x0000ce38,0x08610040,0x00001081,0xffdfb534,0xffffffff,0xffdeffff,0xffdfffff,0xffffffff,0xb575f79e,0x000041e7,0x18c21081,0x002018e3,0x18820000,0x62490800,0xff7dcd97,0xf7ffffff,0xffffffff,0xffbeffdf,0xe6dbe6db,0xd6bad699,0x00009492,0x000020c3,0x42894aca,0x10610000,0x00000820,0x00001081,0x00200020,0x94710000,0xd679d659,0xe6fbd659,0xd69ae6db,0xce59d679,
-0xd69ad679,0x1882bd96,0x08000000,0x000018a2,0xd6799cb2,0xd679d679,0xd69ad679,0xce59d69a,0xce79d6ba,0x5a8ace58,0x20e30000,0x94710000,0xd6bad6ba,0xd6dadefb,0xd6dad6ba,0xe6fbdedb,0xe71ce71c,0xe6dbdeda,0x0820d679,0x20e30000,0x738e0800,0xef5ce6fb,0xef3cef5d,0xef7def3c,0xf79def7d,0x632cef5c,0x10820000,0x000018a3,0xf7be9492,0xffdfffff,0xffbeffdf,0xffdef79e,
-0xffdfffbe,0xb575ef5d,0x000041e7,0x00001061,0x18c21882,0x18821882,0x000018a2,0x8c3020a3,0xffbee6fb,0xffffffff,0xffffffff,0xffdeffff,0xfffff79e,0xffdfffff,0xffdfffff,0x8bf0de9a,0x00000800,0x000010a2,0x19040861,0x10c208a2,0x18611041,0x41e70800,0xf79dad54,0xffffffff,0xffffffdf,0xffbfffdf,0xb555ffff,0x18a20000,0x00000800,0x000018c3,0xffdf8c51,0xffffffff,
-0xffdfffff,0xffbfffdf,0x0800cdb7,0x08810861,0x00001903,0xffffa534,0xffffffff,0x82ecff3d,0x18a20800,0x08210000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28400000,0x486150e3,0xfffee638,0xffffffbe,0xf79dffff,0x00005aeb,0x18a218c2,0x628a0800,0xffffef5c,0xffffffff,0xfffff7de,0xf77dffdf,
-0x00005a6a,0x000018c2,0x00000860,0xe6ba28a2,0xffdeffff,0xffffffde,0xffdeffff,0xdefbffff,0x00007bce,0x20820000,0x00000000,0x10a20000,0x084010a2,0x00001020,0x83af1000,0xffdede9a,0xffdfffff,0xffffffdf,0xffffffdf,0xffffffff,0x7b6ef77d,0x18c20000,0x19443a28,0x08200000,0x00001882,0x21030000,0x10410020,0x4a280000,0xffbebd96,0xffffffff,0xffffffdf,0xffffffff,
-0xffdfffff,0x00008c31,0x082018a2,0x00001882,0xf79e738e,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0x0000d679,0x10201861,0xd6790800,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x5a8af77d,0x20a20000,0x39860000,0xffffe71b,0xffffffdf,0xfffffffe,0xffffffff,0x0000ad34,0x000020c3,0x08210821,0xce790000,0xffffffff,0xffffffdf,0xffffffff,
-0xce39ffbe,0x00006b4d,0x10810000,0x18a20820,0x00000000,0x00000000,0x18a21041,0x00000800,0xb5951020,0xffdfffdf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9cb3ef3d,0x08001821,0x18621821,0x19040020,0x00000000,0x00000000,0x18610000,0x08001861,0x7bae0000,0xffffdeda,0xffdfffdf,0xffffffbe,0x3145e6fb,0x10620000,0x00000000,0x18c20840,0xc6180000,0xffffffdf,
-0xffdfffff,0xff7effdf,0x08007b2d,0x006010a2,0x31850000,0xffffef5c,0xffdff7de,0x82ecff5d,0x10a20800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28810000,0x50a24861,0xffdee659,0xffdeffbe,0xffffffbe,0x0000a514,0x080020c3,0x18611862,0xffbecdd7,0xffdeffdf,0xffffffdf,0x9451ffbe,
-0x20c20000,0x18a11881,0x18a10000,0x7b4d1000,0xffdff77d,0xffffffde,0xffdeffde,0x31a6c617,0x29230000,0x100030c3,0x94102821,0x00006b4c,0x10c20000,0x10c210a1,0x000018c2,0xd5f72841,0xffffffff,0xffffffff,0xffdfffdf,0xf7deffff,0xe71cffff,0x00005228,0x00000000,0x186218a2,0x18210000,0x00001862,0x20a320a2,0x00000800,0x83ef0000,0xffdfef3c,0xffdeffbe,0xffdeffdf,
-0xbdb6ffff,0x10a20000,0x18e31061,0x18c20020,0x94b20000,0xffdfffdf,0xffdfffdf,0xf7beffdf,0xf79effff,0x00007b6e,0x00002904,0xf77e6b0c,0xf7beffff,0xffffffdf,0xffffffff,0xffdfffff,0xffdeffdf,0xffbeffff,0x8c30ffbe,0x20a20000,0x080020a2,0xffdf9451,0xffdeffff,0xffdeffff,0xd69affff,0x00000820,0x00000840,0x18a20000,0x62ec0000,0xffffef3c,0xffdfffdf,0xffbeffff,
-0x0000a4f3,0x10610000,0x21041882,0x00000000,0xb5965acb,0x62cab595,0x00000000,0x20a220a2,0x00000800,0xffffc5f7,0xffdfffbe,0xffffffff,0xffdfffff,0xffffffdf,0x0000ad35,0x20a32082,0x18a30800,0x00000000,0x8c510000,0xb596ce59,0x00004a69,0x20a20000,0x000018a2,0xd67920c2,0xffdfffdf,0xf79effff,0x00008410,0x000018a2,0x18c21061,0x10a20861,0x42080000,0xffffe71c,
-0xffdfffff,0xc576ffdf,0x20412000,0x10c20000,0x84100000,0xffffffff,0xffdfffdf,0x82ccff3d,0x18a30800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20410000,0x59043821,0xffdede18,0xffdfffdf,0xffffffff,0x3145e6fb,0x10410800,0x000018a2,0xff9e7b4d,0xffdfffdf,0xffffffff,0x0000a4f3,
-0x20c220c2,0x00000000,0x000018a2,0x080020a2,0xffdfad14,0xffffffff,0xbdf7ffff,0x00000000,0x000020e2,0x93ef2040,0xffbede18,0xc637f79e,0x00006b6c,0x08a10000,0x29040020,0xb4b32000,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0xa534f7be,0x00000800,0x18c310a2,0x00000000,0xde9a838e,0x8c30de9a,0x00000000,0x102128c3,0x000028e3,0xf77d6b2c,0xffffffff,0xffdfffde,
-0x52aae73c,0x18e30000,0x00000000,0x084010a2,0x00000861,0xffffce59,0xffffffff,0xffffffff,0xbdd7ffff,0x20a20000,0x000020e3,0xffffa4f3,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0xffdfffff,0xffffffff,0xce38ffff,0x18a10000,0x10201861,0xce380000,0xffbef79d,0xffbeffbe,0x62ebdedb,0x18c20000,0x10810000,0x08001882,0x000020c3,0xffffa4f3,0xffffffff,0xef3cffff,
-0x000041c7,0x106120a2,0x00000000,0xa4f33145,0xfffff77d,0xf79dffff,0x4a28bd96,0x10400800,0x00002103,0xef3c5269,0xffffffff,0xffffffff,0xffdfffff,0xffffffff,0x00009cd3,0x080028e4,0x00001021,0x94922945,0xffdfdeba,0xffffffff,0xad75ef5d,0x08003945,0x21041061,0x7bae0000,0xf7beffbf,0xbdb7ffff,0x10610000,0x18a20000,0x00000000,0x08400000,0x000018c3,0x9cb2630c,
-0xa4d39cb2,0x41459431,0x20620800,0x08410000,0x5aca0000,0xad14a4f3,0xde79ad14,0x8b4efefc,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000000,0x48a33000,0xffffe679,0xe6fbf77d,0xde79d679,0x5a69de79,0x08600000,0x10200020,0xbd352001,0xd639d618,0xa4f3d679,0x18610000,
-0x00002081,0x62ca7b8e,0x10c20000,0x000018e2,0xeefc3905,0xffbeffdf,0x7c0ff7de,0x31240000,0x72aa2820,0xff9dcdd7,0xffffffff,0xffffffff,0xce38f79d,0x00006b2c,0x20611861,0x94301000,0xf7deffbe,0xffffffff,0xffffffff,0xfffff7be,0x0000ce79,0x10610000,0x00000000,0xc5f75a89,0xffffff9e,0xffdfffdf,0x5a69c5f7,0x18620000,0x10201020,0xdebb1841,0xffbeffdf,0xffdfffdf,
-0x00009cd3,0x00003145,0x7b8e6b0c,0x10400800,0x00001881,0x9cb24a28,0xbdd7b575,0xd679c618,0x3145bdb7,0x08610000,0x00000881,0xd6998c50,0xde9ad679,0xffdfe6db,0xffffffbf,0xffffffff,0xf75dffbe,0xce18d679,0x9cb2c5d7,0x08400000,0x08400020,0x39a60000,0x6b0b62cb,0x838e7b4d,0x00005a89,0x00001041,0x000018a2,0x08400000,0x08201061,0xd69a0000,0xffbeffff,0xdedbffff,
-0x000039a6,0x00001882,0x94923186,0xffffdeda,0xffffffdf,0xffdfffbe,0xef3cffff,0x00009451,0x10c21081,0xce590000,0xffbfffff,0xffffffff,0xffffffff,0xffdfffdf,0x00009cb2,0x00002125,0x738e0000,0xffffd6ba,0xffdfffff,0xffdfffbe,0xffffffff,0x0800d618,0x18a22082,0x736d0000,0xfffff77d,0x4208ef1c,0x10610000,0x000018a3,0xa53462eb,0x00000000,0x18a20020,0x00000000,
-0x00000000,0x08000000,0x00001882,0x00000020,0x00001081,0x00000000,0x00000000,0x6acb9451,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18410000,0x38a21000,0xbd75d638,0x41a66aeb,0x00001020,0x08000800,0x00200000,0x00200000,0x10000800,0x08001000,0x00000000,0x20821061,
-0x62cb0800,0xce38ff9d,0x00400000,0x20e30020,0x93f00800,0xfffff75d,0x4a89ef9d,0x20820020,0xd5b63020,0xffffffdf,0xf7feffff,0xffdfffff,0xffffffff,0x39a5e6fb,0x28820800,0x83ae0800,0xffffffbe,0xef5cffde,0xffdfef7d,0xffffffff,0x0000b595,0x10612103,0x94300800,0xfffff75d,0xffdfffff,0xffffffff,0xef3cffff,0x00007bcf,0x080020c3,0xd6791000,0xffdfffff,0xd659ffff,
-0x10210000,0x10410800,0xf75de6db,0x080041a6,0x18811861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x08600040,0x00000000,0x00001840,0xf71c626a,0xffdfffdf,0xffdfffbe,0x49c7c5d7,0x08001841,0x00000000,0x00000020,0x00000020,0x00000000,0x08000800,0x08001000,0x18a10000,0x18a20000,0x4a490000,0x00008c30,0x20c30000,0x6b2c0000,0xffdff77d,0xd699ffff,
-0x00000800,0x000018a2,0xffffb596,0xffdfffff,0xffffffff,0xffffffff,0xffffffdf,0x0000bdb6,0x190310a2,0xc5f70000,0xffdfffff,0xbdb6e6fb,0xff9ede9a,0xffffffff,0x00009492,0x00002104,0xef5d2925,0xffdfffff,0xffffffff,0xffffffff,0xffffffdf,0x3083f71c,0x18c30000,0x736d0000,0xf79effbe,0x00009472,0x106220e4,0x18c30000,0xffffce79,0x0000ad55,0x18c22103,0x29652104,
-0x21232964,0x086110a2,0x00000000,0x18c218c3,0x294410a1,0x212331a6,0x000018c2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x30c30800,0x000049e7,0x00001000,0x190210a1,0x20c22903,0x18c218e3,0x000010e2,0x18a30821,0x10a218a2,0x19232164,0x08002103,
-0xde9a28a2,0xffffffff,0x00009cf3,0x080018a2,0x000020c3,0xce185a49,0x10c2d69a,0x10610000,0xde182000,0xffdeffdf,0xffffffff,0xffdfffff,0xffffffff,0x5acaf79d,0x29030000,0x5a490800,0xde59f6fb,0x30c39c51,0xb51449a7,0xffdfeefb,0x0000c5b6,0x000020e3,0xef1c28e3,0xffffffdf,0xffffffff,0xffffffff,0xffffffdf,0x0000bdf7,0x18622082,0xc5f70800,0xef3cffdf,0x5a8abd96,
-0x21030000,0xb5750000,0xffffffdf,0x0000bdd6,0x10402903,0x29441081,0x29442944,0x18c22103,0x08401882,0x10600800,0x10600020,0x28c22903,0x20821841,0x7b6d0800,0xffdff77d,0xd679ffff,0x00000000,0x18c20820,0x10a220e3,0x00200020,0x00000000,0x08200000,0x18a11061,0x20c21881,0x18a220c2,0x18a22903,0xc6380000,0x8c30ffbe,0x20c30000,0x00001882,0xd6997bae,0xd679ffde,
-0x08210000,0x000020e4,0xffffce59,0xffffffff,0xffdfffff,0xffffffff,0xffffffde,0x0000bdd6,0x08a210c2,0xb5550000,0xa4b2e6fb,0x000020a2,0x736d0000,0xef5dce18,0x000083ef,0x000018e3,0xf79e526a,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x3883eebb,0x10a21000,0x52aa0000,0x630cb596,0x18a30000,0x18820000,0xc6380000,0xffffffff,0x8430f7be,0x00000000,0x00000000,
-0x00000000,0x00000000,0x10610000,0x00000000,0x00000000,0x00000000,0x08201040,0x08611082,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08001020,0x10400000,0x18a120a2,0x00000000,0x00000000,0x00000000,0x08810000,0x00200020,0x00200861,0x00000000,0x00000000,
-0xffdfc5b6,0xffffffde,0x10a1d6fa,0x10210800,0x10810000,0x10200000,0x08404208,0x18a10020,0xd5f72820,0xffdeffff,0xffffffdf,0xffffffdf,0xffdeffdf,0x5aebf79d,0x10810000,0x30c40000,0x200072cb,0x10001000,0x10001000,0xc5964986,0x0000a4f3,0x100020e3,0xeefb3904,0xffdeffff,0xffffffde,0xffdfffff,0xffffffff,0x0000ce58,0x20c31061,0x94510000,0x5229b555,0x00000800,
-0x10a21882,0xbdb60000,0xffdfffff,0x8c30f79d,0x00000000,0x00000000,0x00000000,0x00400000,0x08200020,0x10201840,0x08000800,0x08000800,0x18611020,0x000028e3,0xffffa4f3,0x5aaaef5c,0x21240000,0x08610841,0x210310a2,0x18c20840,0x18a218c3,0x08610000,0x00200000,0x00000000,0x00000000,0x00000000,0xffffa4f3,0xdebaffff,0x08200800,0x10411041,0x00000000,0x947183ef,
-0x10610000,0x00000841,0xffffd69a,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000b595,0x004110a2,0x41c70000,0x08003965,0x21030000,0x000010a2,0x52690000,0x00003145,0x002010a2,0xf79e6b4c,0xffffffff,0xffdfffff,0xffdfffff,0xffffffff,0x40e5f6dc,0x08610000,0x00000020,0x00000000,0x08201062,0x000020c3,0xf79e5acb,0xffdeffdf,0xef5dffff,0xbdf7c5f7,0xb555bdb6,
-0x29049cb2,0x00200000,0x00001082,0xad346b2d,0xad54ad54,0x4a07ad34,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18820841,0x00000800,0x7bcd6b2b,0x8c3083ef,0x8c308c30,0x0000528a,0x10611041,0x4a480000,0x9c928c51,0xce38b575,
-0xffdfffbe,0xf7beffdf,0x00009491,0x20a21020,0x08412904,0x006010e3,0x00000000,0x10201081,0xd6171800,0xffdfffdf,0xffffffff,0xffbfffff,0xffffffdf,0x4a89ef7d,0x10a20000,0x00000000,0x10000000,0x21032103,0x20c218a2,0x10000800,0x08600840,0x00000840,0xe6ba30c3,0xffffffdf,0xffffffff,0xffffffff,0xfffff7be,0x0000ce79,0x00001041,0x00001061,0x00000000,0x21042103,
-0x10610000,0x41e70000,0xffffef3c,0xef5dffdf,0xce59ce59,0x9cd3ce38,0x83ef9471,0x000039a6,0x08000840,0x20200800,0x51c549a5,0x6aa972aa,0x08400800,0x00001081,0xbdb60000,0x00008c10,0x082018a2,0x00001041,0x00000000,0x00000000,0x00000000,0x000018a2,0x00000000,0x41e72924,0x840f6b4c,0x9cf383ef,0xffdfffbe,0xdebaffff,0x00001882,0x18610820,0x10402103,0x00000800,
-0x08210000,0x00000841,0xffffce79,0xffffffff,0xffffffff,0xffdfffff,0xffffffdf,0x0000b595,0x000018e3,0x00000000,0x10411020,0x10a118a2,0x21030860,0x08000861,0x08200000,0x000010a2,0xef7d6b6d,0xf7dfffff,0xffffffff,0xffffffff,0xfffff7de,0x3063eebb,0x00410820,0x00200000,0x20c318a2,0x18a220c3,0x000018c3,0xdeba18c3,0xffffffff,0xffffffde,0xffffffff,0xffffffff,
-0x1000de79,0x21240800,0x4a490000,0xffffef7d,0xffffffde,0xc5d6ffff,0x18610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x20a20800,0xa4d20000,0xffffffbd,0xffdfffff,0xffffffff,0x0000d679,0x18820820,0x6b0c0000,0xffffff7e,0xffdfffff,
-0xffdeffde,0xc5f7ffff,0x10000000,0x000028a2,0x00000000,0x190308a1,0x00000881,0x18610020,0xcdb61800,0xffbeffff,0xffffffdf,0xffdfffdf,0xffffffff,0x5aebef7d,0x10a20000,0x08000000,0x28e32082,0x00000000,0x20e30000,0x18612081,0x00200020,0x08001061,0xeedb2041,0xffdeffdf,0xffdfffff,0xffffffff,0xffffffff,0x0000d6ba,0x08200800,0x18a20000,0x292418c2,0x00000000,
-0x00001061,0x000020c3,0xffbe9cd3,0xffffffff,0xffffffde,0xffffffde,0xffbeffff,0x00006b4c,0x00002103,0xe6baa492,0xeefbeefb,0xf75cf73c,0x0000a513,0x08600860,0x00000020,0x18610800,0x10410800,0xad550000,0xd69adeba,0xbdd7ce38,0x8c51bdb6,0x20a20000,0x00001041,0xef5c9cd2,0xfffff7be,0xffffffff,0xffffffdf,0x736df77d,0x18a20000,0x000018a2,0x28e30000,0x18a220a2,
-0x00200000,0x000018c3,0xffffc618,0xffdfffdf,0xffffffff,0xffffffff,0xffffffdf,0x0000bdb6,0x000018c3,0x10210841,0x29041862,0x00000000,0x00000000,0x20c310a2,0x00000800,0x00000841,0xf79d4a69,0xffdfffff,0xffffffdf,0xffdfffff,0xffffffff,0x1000cdd8,0x00411041,0x00200000,0x108118c3,0x00000000,0x20c31021,0x84100000,0xffdfffde,0xffdfffff,0xffbeffde,0xff9effff,
-0x10009430,0x18a21882,0xbdf70000,0xffdfffff,0xf7beffff,0xffbeffdf,0x08008baf,0x000020c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x100028a2,0xf77c734c,0xffffffff,0xfffffffe,0xffffffde,0x736dffbf,0x21030000,0x10201061,0xffdfd639,0xfffeffff,
-0xffffffff,0x62ebf79d,0x28e30000,0x7b0c1000,0x62cab555,0x00000000,0x08810061,0x18620000,0x7b4d0800,0xffdfe69a,0xffdfffff,0xffffffdf,0xef5dffff,0x2985bdf7,0x18610000,0x18410000,0x08001000,0x736d28e2,0x00002903,0x18a21061,0x00200040,0x10200820,0xc5f70000,0xffffffdf,0xffdeffff,0xffdeffff,0xffffffdf,0x1041e6fb,0x08200000,0x18a20000,0x00000000,0x8c104a08,
-0x08200000,0x08201040,0xd67a1021,0xffbfffff,0xffffffbe,0xffdfffff,0xd699ffff,0x18810000,0x52070800,0xfffff75c,0xffdfffdf,0xffffffff,0x4a69ef5d,0x10810000,0x20c31061,0x08001041,0x000018c2,0xffbe8430,0xffffffff,0xffffffff,0xef5dffff,0x000062cb,0x000020c3,0xffde83ce,0xf7deffff,0xf7beffff,0xffffffdf,0x0000c5f7,0x10a21081,0x41e70000,0x080028c3,0x20c30000,
-0x00200000,0x00001081,0xef1c8c10,0xffffffff,0xffdeffdf,0xffffffff,0xe6fbffff,0x000083cf,0x000010a2,0x18a20020,0x00000000,0x94510000,0x9471d679,0x00000000,0x00001061,0x00000020,0xb5b60000,0xfffff79d,0xffffffff,0xffffffdf,0xd618ff7e,0x08006acc,0x00201061,0x10e20041,0x00000000,0xa514840f,0x08000800,0x00001861,0xffffd699,0xffdfffff,0xffffffff,0xe6baffff,
-0x08001881,0x000020c3,0xf79e6b4c,0xffffffff,0xffffffff,0xfffff7be,0x1000de59,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610000,0x30a21000,0xffffde58,0xffffffff,0xffffffff,0xffdfffdf,0xbdf7ffff,0x10a20000,0x08001861,0xff7e93f0,0xf7deffff,
-0xffffffff,0x00009cd2,0x18202903,0xe69a30a2,0xf77dffde,0x73aebdb6,0x00000020,0x00000862,0x00002082,0x9c512861,0xffbede9a,0xf77dffff,0x5acab596,0x00000000,0x00000000,0x08001862,0xa4b22881,0xff9ee6ba,0x7bcedeba,0x00000000,0x000010c2,0x10410800,0x29650000,0xef1ca4f3,0xffdfffff,0xffdfffbe,0xe6fbffbe,0x08009c92,0x00001882,0x000010a2,0xad3441e7,0xffbeef3d,
-0x0000736d,0x20c320c2,0x7bcf0000,0xffdff77d,0xffdeffdf,0xffdeffdf,0x9491ffde,0x29240000,0xa4d20800,0xffbeffdf,0xffffffdf,0xffdfffff,0xb596ffff,0x18c20000,0x00000000,0x08610021,0x39e70000,0xffffef5c,0xffffffdf,0xffffffff,0xffffffff,0x0000c5f7,0x20c320c3,0xce380000,0xffffffff,0xffffffde,0xf75dffff,0x08005a69,0x00002124,0xe6fb4a69,0x9c92deba,0x00001882,
-0x00000020,0x10610000,0x41860000,0xef1cb535,0xffbeffff,0xf77dffdf,0x3986ad55,0x08200800,0x00000000,0x00000041,0x8c510000,0xf79ee6db,0xffdeffff,0x5269c5f7,0x08610800,0x08400000,0x00000000,0xd6997bcf,0xffffff9e,0xe6baffbe,0x10009431,0x20820000,0x08610000,0x00000000,0xce785b0b,0xffffffde,0x0800a4b3,0x00003124,0xf7be6b8d,0xffffffff,0xffdeffdf,0xa492ffbe,
-0x18c20000,0x00000000,0xffffce79,0xffffffff,0xffffffff,0xffffffff,0x9431ff9e,0x18e30000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18a20020,0xbd540800,0xffdeffde,0xffffffde,0xffffffff,0xffbeffff,0xef5dffff,0x000039a6,0x100020c2,0xf6db40a3,0xf7deffff,
-0xd699ffff,0x10400000,0x080028e3,0xffbebd75,0xffffffff,0xffffffff,0x2965b5b6,0x10820000,0x10400000,0x00000000,0x94102041,0x5208b555,0x00000000,0x086118e3,0x18410000,0x5aaa0000,0xffffde99,0xffdeffff,0xffbeffff,0x5aaac5f7,0x00200000,0x00000800,0x00000821,0x31040000,0xff9ebd75,0xe6baffbf,0x20a3a4d3,0x08200000,0x10610820,0x6b2c0000,0xffffe6fb,0xffffffdf,
-0x0000d699,0x10a20040,0x000018a2,0xffffce18,0xffffffdf,0xffffffff,0x0840deda,0x10610000,0xde791820,0xffdeffff,0xf7ffffff,0xffffffff,0xf77dffff,0x08005229,0x00201882,0x08a20040,0xc5f70000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x5acbf79e,0x29040000,0x7bae0000,0xffdfffbe,0xffdeffdf,0xad14ffff,0x20a21000,0x00002103,0xffffbdd7,0xffffffde,0x8c51e6db,
-0x00001882,0x00001061,0x000010a2,0x41a60000,0xde9ab534,0x3925acd3,0x00000000,0x000010a2,0x18c30000,0x6b4d0000,0xffdfce79,0xffffffff,0xffbeffdf,0xe71cffdf,0x00006b2c,0x000020e4,0x10810820,0x00000000,0xc5d79451,0x18219c72,0x08200000,0x00001061,0x00000821,0xb5954208,0xffffffde,0xffdfffde,0x6accf73d,0x29250000,0xa5340000,0xffdfffdf,0xffffffdf,0x30c3eedb,
-0x20c30800,0x630c0000,0xfffff7be,0xffffffdf,0xffffffff,0xffdfffff,0xd638ffdf,0x00201081,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610020,0xcdd70800,0xffbeffde,0xffffffff,0xffdfffff,0xffffffff,0xffffffff,0x0000a513,0x182020e3,0xf6bb3862,0xffffffde,
-0x6b4def7d,0x29030000,0x62aa0800,0xfffff75d,0xffdeffde,0xffffffde,0x7bcfffde,0x10620000,0x20e30000,0x20c220c2,0x08001820,0x00000800,0x18e33145,0x00000000,0x18821041,0xad540000,0xffdeffde,0xffdeffde,0xffdfffdf,0xf79effdf,0x00009cb3,0x00001062,0x10820000,0x000020c3,0x7b0c0800,0x28a29410,0x08000000,0x08202924,0x10811041,0xc6180000,0xffdfffff,0xffffffdf,
-0xa513ffde,0x10a20020,0x000018a2,0xef3c4a29,0xffffffff,0xffffffdf,0x0000a513,0x00002965,0xffdf9c51,0xffffffdf,0xf7ffffff,0xffffffff,0xffdfffff,0x0800c5d7,0x00201882,0x00000881,0xffbe73ce,0xffffffff,0xffffffff,0xffffffff,0xffdfffdf,0xbdd6ffff,0x18820000,0x00001881,0xffffd679,0xffffffdf,0x3104e6db,0x29040000,0x7bef0000,0xffdfffbf,0xffdfffff,0xffbeffdf,
-0x000083cf,0x00001081,0x18c20841,0x00002104,0x10000800,0x10000800,0x18a220a3,0x00001081,0x00001062,0xdedb2104,0xffffffff,0xffffffde,0xffffffdf,0xffffffff,0x00009cb2,0x000020c3,0x10a10841,0x20c22924,0x00000000,0x08000800,0x18c32103,0x00000881,0x000018c3,0xffffad34,0xffffffff,0xffdfffff,0xcdf8ffff,0x20c30000,0x00000000,0xffffe6fb,0xffffffdf,0x628aff5d,
-0x29040000,0x8c300000,0xfffff7be,0xffdfffdf,0xffffffdf,0xffdfffdf,0xc5b6ffdf,0x08810000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18c30000,0x628a0000,0xffdff73c,0xffffffff,0xffffffff,0xfffeffff,0xffdeffff,0x00008c71,0x00002964,0xffbe838e,0xffffffff,
-0x0000ad34,0x10203104,0xd6591800,0xffdeffff,0xffffffff,0xffffffff,0x7baef79e,0x18a20000,0x00000840,0x00000000,0x290428c3,0x20e32924,0x00000000,0x39453986,0x18c20000,0xbd960000,0xffdeffff,0xffffffde,0xffdfffdf,0xffffffdf,0x0000debb,0x10210800,0x00001021,0x290420c3,0x000018a2,0x00000000,0x08612124,0x00000000,0x08200820,0xce380000,0xffdfffff,0xf7feffff,
-0xef7dffff,0x000062eb,0x20e418c3,0x9cb20000,0xffdfffdf,0xf79dffff,0x00005aaa,0x00002924,0xffdf9c71,0xffdfffbe,0xffffffff,0xffdfffff,0xffffffdf,0x0000bd96,0x000020a2,0x000018c2,0xffff8410,0xffdfffff,0xffdfffdf,0xffffffff,0xffffffff,0xa514ffff,0x29040000,0x20e30000,0xffdfdeba,0xff9effff,0x00007b8e,0x00002905,0xd69a1042,0xffffffdf,0xffdfffff,0xffbfffdf,
-0x0000736e,0x10611061,0x00000000,0x20c30800,0x10402103,0x290428e3,0x00000000,0x08000800,0x00001882,0xf79d5269,0xffffffdf,0xffffffff,0xffdfffff,0xffffffdf,0x0000a4f4,0x084020c3,0x00000000,0x00000000,0x18822924,0x21032124,0x00000000,0x00400000,0x000018c3,0xffffb576,0xffffffdf,0xfffff7df,0xffbeffdf,0x00008410,0x00002125,0xef5d6b4d,0xffdfffff,0xcdf8ffdf,
-0x29040000,0x08400000,0xffdfdeba,0xffffffdf,0xffdfffff,0xffdfffff,0x49c7eefc,0x10e30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x080020c3,0xffbe9451,0xffdeffff,0xffffffde,0xf7fef7de,0xdefbffff,0x08400000,0x00000860,0xffffd659,0xdebaffff,
-0x08001861,0x08002082,0xffbe9c51,0xffdeffdf,0xffffffff,0xffffffde,0x62ebf79e,0x20e30000,0x6b4c0000,0x20c2840f,0x00000000,0x00000000,0xc5f76b2c,0x734de6db,0x21240000,0xbd960000,0xffffffdf,0xffdfffbe,0xffffffff,0xffffffff,0x0000ce59,0x10620000,0x39451000,0x00000000,0x210318c2,0x18e32123,0x00200000,0x31654a69,0x10200000,0xce590000,0xf7deffff,0xfffeffff,
-0xffffffdf,0x0000d69a,0x18820000,0x08001041,0xffdfdeba,0xffdeffde,0x00008c30,0x08002103,0xd6382041,0xffdfffff,0xffdfffdf,0xffdfffdf,0xdebaffff,0x08001020,0x18611020,0x00001041,0xce381040,0xffdfffff,0xffffffff,0xffdfffff,0xffffffdf,0x1041deda,0x18820800,0x738e0000,0xffdfffde,0xc5d7ffff,0x18a20000,0x000018a2,0xffdf9cd3,0xffdfffdf,0xffffffdf,0xef5dffff,
-0x00006b2d,0x000018a2,0x7bae4a08,0x00002924,0x00000000,0x00000000,0x736d1061,0x00006b2c,0x080020a3,0xf77d630c,0xffffffff,0xffffffdf,0xffffffff,0xfffff7be,0x0000a514,0x00002904,0xad7562eb,0x10207bae,0x08400000,0x00000000,0x738d2965,0x000052cb,0x000018e3,0xffdf9cb3,0xf7deffff,0xffdfffff,0xffdfffbe,0x0000d69a,0x21240000,0xb5760000,0xffdfffff,0xef3cffdf,
-0x000041a6,0x00002904,0xf7be840f,0xffdfffdf,0xffbfffbe,0xffdfffbe,0x0000acf3,0x000018e3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10411061,0xce180800,0xffdfffdf,0xffdeffbe,0xffffffff,0x9492ffde,0x20c20800,0x840f0000,0xffbeffbe,0x7b8eff9e,
-0x20820800,0x20621000,0xffdfe6bb,0xffffffbe,0xffffffff,0xffffffff,0x41c7f77d,0x21030000,0x9cd30000,0xdedbffff,0x7b6e9cb2,0xd699acf3,0xfffff79e,0x83efffdf,0x29040000,0xbdb61000,0xf79effff,0xffffffff,0xffffffff,0xfffff7be,0x0000deba,0x00200040,0xd6181020,0x6aebc5b7,0x00000800,0x00000000,0xc617528a,0x630cdedb,0x20c30000,0xce380000,0xffffffff,0xffffffff,
-0xffffffff,0xb555ffdf,0x18a20000,0x00002904,0xffbe8c30,0xffffffdf,0x0800ce38,0x20c31081,0x8c100000,0xffdfff9e,0xffdfffbf,0xffffffff,0x7b8def3c,0x20e30000,0x00000820,0x108110a2,0x41a60000,0xffffef3c,0xffffffdf,0xffdfffff,0xffdfffdf,0x00007bcf,0x18a218c2,0xb5950000,0xffffffdf,0x28a2e6db,0x20e20800,0x29230000,0xffffe6fb,0xffffffff,0xfffffffe,0xf79dffde,
-0x00005269,0x00002924,0xf79e9471,0xa534e6fb,0x39c66b4c,0xb575632c,0xffffdeba,0x2082de9a,0x00001020,0xf77d6b2c,0xffffffff,0xffffffff,0xffdfffff,0xfffff7be,0x0000a514,0x00002905,0xffff9451,0xdefbf7be,0x00208c71,0x9cf339a6,0xffdfe71b,0x0000b575,0x00002904,0xffff9492,0xffffffdf,0xffdfffff,0xffdfffff,0x9cb2ffff,0x18c30000,0x29040000,0xffffdebb,0xffdfffbf,
-0x0000a4d3,0x10a220c3,0xc6380000,0xffffffdf,0xffdfffff,0xde9affff,0x08001000,0x00001081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18a20000,0x5a6a0800,0xffffef3c,0xffdfffff,0xffffffff,0x0000d699,0x18a10000,0xc5f70000,0xffdfffdf,0x0800cdf8,
-0x20c31021,0x94510800,0xffbeff9e,0xf7beffbe,0xffbeffde,0xffffffbe,0x41c7ef1c,0x20e30000,0xad350000,0xffffffff,0xff9effdf,0xffffffff,0xf7dfffff,0x73aeef9d,0x31040000,0xb5550800,0xffdfffff,0xffbfffff,0xffffffdf,0xffffffff,0x18c3d69a,0x08a10000,0xde9a1021,0xf77dffff,0x7baec5f7,0xc5d7738e,0xffffef5c,0x41e7ef7d,0x18a20000,0xbd960000,0xffbeffbe,0xffbeff9d,
-0xffbeffbe,0xe71cf77d,0x0000528a,0x10411862,0xd6590820,0xffffffff,0x736dff9e,0x20c30000,0x10200800,0xffffd679,0xffffffdf,0xffffffdf,0x0000a4f3,0x080020e3,0x39a60000,0x10410000,0x000018a2,0xf77d83ef,0xff9effdf,0xffdfffbe,0xbd96ffdf,0x18c20000,0x00001061,0xef5c3186,0xff9effff,0x080083ae,0x18a128e3,0xa5130000,0xffdeffff,0xffdeffde,0xef7dffde,0xd679ffbe,
-0x000039a6,0x000020e3,0xffffad55,0xffffffff,0xe73cf79d,0xfffff79d,0xffffffff,0x41a6ef1c,0x00000000,0xf79e6b2c,0xffffffff,0xffffffff,0xffffffdf,0xffdfffff,0x00008c51,0x00003166,0xffdfa4f3,0xffffffdf,0xdefbffff,0xffdfe71c,0xffffffff,0x0000bdd7,0x00002904,0xd6ba6b4d,0xdedbdedb,0xe71ce6fb,0xe6dbe6ba,0x9cd3e6db,0x18a20000,0x00001862,0xbdd77bae,0xbd76bdb7,
-0x00007b8e,0x18c21081,0x5acb0000,0xe6fbd6ba,0xe6dbe6db,0x6b0cde9a,0x18a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000020,0x00001841,0xb5557bae,0xb535ad14,0xa4f3ad35,0x00005aca,0x00001081,0x6b0c1861,0x9c929451,0x00005a6a,
-0x000010a2,0x62ab0000,0x83ef9430,0x7bce83cf,0x83ef83ef,0x8bef83ef,0x08007bae,0x20c30020,0xa4f30000,0xffdfffdf,0xffffffdf,0xffdfffff,0xffffffff,0x73aef7be,0x18a20000,0x4a280800,0xffbfc5d7,0xffdfffdf,0xf7deffff,0xffffffff,0x20e3dedb,0x10c20000,0xd6791020,0xffffffff,0xffdeffff,0xffffffbe,0xffdfffff,0x20c3e6fb,0x10410000,0x52280000,0x8bae7b4d,0x8bcf7b4d,
-0x7bae83cf,0x736d6b0c,0x00004208,0x18820821,0x62eb0000,0xad14ad14,0x630bad34,0x10410000,0x08001861,0xa4b35a6a,0xacd49c92,0xad14c596,0x08200000,0x00002903,0xe6db8c30,0x0800732d,0x102020a3,0x6b2c0800,0x83cf8c10,0x8c309451,0x31659471,0x08200000,0x00000840,0xa4f341c7,0x8c30b575,0x18610800,0x08200800,0x83ef0000,0x9c92acf3,0x94109430,0x7b6d83cf,0x51c76acb,
-0x08000800,0x000018c2,0xffffbdb6,0xffffffde,0xffffffff,0xffffffff,0xffffffdf,0x5249f75d,0x00000000,0xdeba2924,0xffffffff,0xffdfffdf,0xffffffff,0x9cf3ef7d,0x00002104,0x000010a2,0xffdfbdd7,0xffdfffff,0xffffffff,0xffdfffff,0xf77dffff,0x0000acf3,0x086118c2,0x00000000,0x08200820,0x10400840,0x08001020,0x00000000,0x00000841,0x10810000,0x00000000,0x00000000,
-0x08400000,0x00000000,0x00001081,0x08200000,0x10210000,0x00000000,0x00001040,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x10611882,0x10620820,0x00000000,0x08000800,0x00000000,0x10a20000,0x08000820,0x00000000,0x00000000,0x10620000,
-0x00200000,0x08001021,0x08000000,0x00000000,0x00000000,0x08000800,0x00000000,0x08400000,0x31250000,0xe6db9431,0xffdfffff,0xffffffdf,0xffdfffdf,0x8c50ffff,0x29040000,0x00000840,0x94510800,0xffdfef1c,0xffffffff,0xe73cffff,0x000083cf,0x20e318c2,0xd6380800,0xffdeffde,0xffdfffff,0xffdeffff,0xffffffff,0x20e3e6fb,0x18610000,0x08000000,0x08000000,0x08000800,
-0x08000000,0x00000000,0x00000000,0x00000000,0x00001882,0x00000800,0x00000000,0x000018c2,0x10210000,0x10000800,0x08000000,0x08001000,0x18a21040,0x52280000,0xffffe71b,0x41a6e6db,0x20a20000,0x00001882,0x08000000,0x00000000,0x00000000,0x10611041,0x08400000,0x00000000,0x00000000,0x00001062,0x08000000,0x00000820,0x08000000,0x08000800,0x00000800,0x08001000,
-0x08000800,0x00001061,0xef3c8410,0xffdfffff,0xffffffff,0xffffffff,0xffffffdf,0x62aaf77d,0x21230000,0x39e70000,0xef3cad34,0xffffffff,0xbdb7f79e,0x00005269,0x10a20000,0x00002124,0xffffc658,0xffdfffdf,0xffbeffdf,0xffffffdf,0x83cfde9a,0x08200000,0x00000000,0x10a210a2,0x18611881,0x10611061,0x18611861,0x18a218a1,0x108110a1,0x00000000,0x088110e2,0x21240881,
-0x18c218a2,0x10a210a2,0x08400020,0x00000861,0x08200840,0x188218a2,0x188110a1,0x00001881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x18201000,0x00000000,0x210320e3,0x29452124,0x188220e3,0x212418c3,0x10411061,0x108118c2,0x214410e3,0x20e32924,0x00000841,
-0x00400020,0x20c31081,0x29032104,0x31043104,0x29242903,0x31043924,0x082028e3,0x00000000,0x00000840,0x39650800,0xef3dad34,0xffdfffdf,0xffffffbe,0xb596ffff,0x20820000,0x18c20820,0x00000841,0xbd964a08,0xef3cf77d,0x41a6b575,0x10200800,0x000018c2,0xe6fb4a48,0xffdfffff,0xffdeffff,0xffdfffdf,0xe6dbffdf,0x00008c10,0x00001020,0x08810000,0x21232144,0x29242924,
-0x18c22924,0x19232103,0x10e30882,0x000008a2,0x08400000,0x18c220e3,0x10c22964,0x10a208a1,0x08001861,0x18a31862,0x210418c3,0x20c32104,0x000028e3,0xd67928a2,0xffffffff,0xc618ffff,0x00000000,0x20c31061,0x20e320c3,0x20c22103,0x08002903,0x18a20800,0x20c32103,0x318620e3,0x10822104,0x00000001,0x08820000,0x212518e4,0x31652965,0x29242904,0x18e32945,0x20e320c3,
-0x00000821,0x08400800,0x4a690000,0xffdfbdf7,0xffffffff,0xffffffff,0xffdfffdf,0xa514ffff,0x10a20000,0x000018a2,0x41e70000,0xce39c5d7,0x0000734d,0x20c30000,0x108210a2,0x6b4c0000,0xffffe73c,0xf7beffdf,0xffffffff,0xb555f75d,0x00001861,0x00001020,0x00000820,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x00000000,0x00001020,0x08400000,0x00000000,
-0x00000000,0x00000000,0x00200000,0x08401081,0x00000820,0x00000000,0x00000000,0x20820000,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18810000,0x49661000,0x41c7a492,0x00000000,0x00000000,0x08400000,0x00000000,0x08001000,0x00000000,0x00000000,0x00000000,0x00001082,
-0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x00200000,0x00000000,0x08000000,0x00001882,0x39860000,0xff7ebd76,0xffbeffff,0xf79effff,0x0000a4f3,0x10a20000,0x18e30020,0x08000000,0x628a6b0c,0x08000800,0x18612082,0x736d0800,0xffffdeda,0xffdeffff,0xffffffde,0xef1cffff,0x10009c72,0x08000000,0x00000000,0x00000040,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x08610000,0x08400000,0x00001040,0x00000000,0x00000000,0x10000000,0x00000800,0x00000841,0x00000000,0x00000800,0xffffbd95,0xffffffdf,0xfffff7de,0x0000ad54,0x00000000,0x00000000,0x10400000,0x08200000,0x00000000,0x00000000,0x00000000,0x08210000,0x00000821,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x08210000,0x00000000,0x000018e3,0x7bef0000,0xffffe6fb,0xffffffdf,0xffdfffdf,0xf7beffff,0x00009cf3,0x21030000,0x000018c2,0x00000000,0x18820000,0x104118a2,0x00000000,0xf79d94b2,0xffffffff,0xffffffdf,0xde7affdf,0x08006acb,0x18a20800,0x00200000,0x00000000,0x52692124,0x6aeb62cb,0x630b6b0b,0x6aeb6aeb,0x5aaa62eb,0x5a896b0b,0x08001020,0x00000000,0x528a18e3,
-0x632c5acb,0x630c6b6d,0x000020e3,0x00000000,0x10a20020,0x42082965,0x6b2c4227,0x730cc5b6,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200000,0x40a33021,0xde9ae679,0x8c719491,0x62eb738d,0x082041a6,0x10810040,0x8b6e2000,0xc5f7c5d7,0xad75b5b6,0x08209491,0x08000800,
-0x31440800,0x7bae6b4c,0x8c508410,0x8c3083ef,0x8c30840f,0x8c309491,0x0000630c,0x00200000,0x10820000,0x20a31862,0x000018a2,0x7bae0800,0xffdfe6bb,0xffdfffff,0xce58ffff,0x00000040,0x002018c2,0x18c20820,0x00000000,0x182128c3,0x00002082,0xf77e8c10,0xffdfffff,0xffdfffde,0xf77dffff,0x41a6bd75,0x10200800,0x102020a2,0x08400000,0x62ca0800,0xbdb6ad13,0xb554bd75,
-0xb534b534,0xc5b6b555,0xc5f7ce38,0x0000736d,0x10001841,0x49e70800,0x62aa628a,0x62aa62aa,0x08003145,0x08411021,0x18820000,0x738e4a28,0xc5d7a4d3,0xffffffde,0xffffffbe,0xffdfffff,0xdebbf7be,0xce59ce38,0xce58ce38,0x00007bcf,0x000018a2,0xa4f32924,0x9492a534,0x9cf39cd3,0x00006b2c,0x10600800,0x52a90000,0x94508c2f,0x9cb1a4f2,0x94709c70,0x942f940f,0x7bad942f,
-0x000028e4,0x00200820,0x10e308a1,0x00000881,0xb57518a2,0xffffffbf,0xffffffbe,0xffffffde,0xc638ffdf,0x000039c6,0x188210a2,0x18a218a3,0x082018a3,0x00000820,0xc5f74a49,0xffdfffff,0xfffff7be,0xff9effff,0x1020ad14,0x20c30800,0x18a21882,0x00000000,0x000018c2,0xff9eb595,0xffbeff9e,0xf7beffde,0xffbeffbe,0xf79ef7be,0xe6fbffff,0x00002061,0x00202103,0xffdf9d14,
-0xf7bef7de,0xffdff7be,0x0000b555,0x106118c2,0xbdd70000,0xef5cef7d,0xffbef7be,0x93cfff5d,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20600000,0x50c34082,0xffffe658,0xffdeffde,0xffbef77d,0x0000bdd6,0x18a10020,0xee7a38a3,0xffdfffff,0xffffffff,0x0000dedb,0x28e30000,
-0x9c910000,0xf79ef79d,0xffdfffbe,0xffdeffdf,0xffdeffff,0xffdeffbe,0x2944defb,0x08000000,0x00001061,0x18a20000,0x18821061,0x00001041,0xbd752082,0xffdfff9e,0xffffffbe,0x738de6fb,0x00200000,0x08400020,0x18821081,0x20c30800,0x94300000,0xffdfffbe,0xffdeffbe,0xffbeffff,0x6b0cc5f7,0x00000000,0x210320c3,0x00000840,0x18a20820,0xad340000,0xffffffff,0xffdfffdf,
-0xffbeffdf,0xffffffff,0xffffffdf,0x0000bd96,0x08003124,0xef1c730c,0xf75dff7d,0xf79df75d,0x1882ce38,0x20a30000,0x7baf0000,0xf79ee6fb,0xffffffff,0xffdeffff,0xffdfffff,0xffffffdf,0xffdfffff,0xffffffff,0xffbeffff,0x000083ef,0x00003165,0xffff9471,0xffffffff,0xffdfffff,0x3985de9a,0x20c20000,0xd6780000,0xffbeffde,0xffbdffff,0xffbdffbd,0xffdeff9d,0xef3bffde,
-0x00005aaa,0x00001081,0x00000000,0x210310c2,0x00000000,0xd679736d,0xffffffff,0xffffffff,0xd69affff,0x000039e7,0x00000841,0x18c32124,0x08200000,0x000018a3,0xffffad55,0xffffffde,0xffbeffff,0x6b0cce38,0x08000000,0x21031061,0x00000000,0x08400000,0x00001903,0xffffc638,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xef3cffff,0x080028e3,0x00002104,0xffdfbdd7,
-0xffffffdf,0xffffffdf,0x5a6af75d,0x18a20000,0xc6170000,0xffffffff,0xffffffff,0x8b4dff7e,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18000020,0x58e44862,0xffdeddf7,0xffdeffde,0xffdeffff,0x0000a554,0x10202103,0xff7d93ef,0xf7deffde,0xfffffffe,0x0000deda,0x20e30881,
-0xb5341000,0xffffffdf,0xffdeffff,0xffffffff,0xffffffff,0xffffffff,0x630cf7be,0x20e30000,0x736d0000,0x00006b6d,0x20c30000,0x18c31081,0x00000000,0xdeba6aec,0xffffffff,0x9c92ffbe,0x18c30000,0x08810040,0x08212104,0x10820000,0x5aaa0000,0xff9ede59,0xffdfffff,0x7b6ede7a,0x00000000,0x214418c3,0x000010a2,0x08610000,0x28e30000,0xb5750000,0xffbeffdf,0xffffffdf,
-0xffdfffde,0xffdeffdf,0xffffffff,0x0000ad75,0x00003185,0xffff9471,0xffffffff,0xffffffff,0x8c71ffff,0x21030000,0x52690000,0xffffef5d,0xffffffbe,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0xffdfffdf,0xce58ffff,0x18a20000,0x10610000,0xffffd69a,0xffdfffdf,0xffffffdf,0x5a49f77e,0x10810000,0xe6fb0000,0xffffffff,0xffffffff,0xffffffff,0xffdfffde,0xf79dffff,
-0x0000632c,0x000018e3,0x7bae8c30,0x00000000,0x210320c2,0x00000000,0xf77d9cd2,0xe6dbffdf,0x00009451,0x18a20000,0x084118c3,0x00000000,0x18c30020,0x000010a2,0xb5544a08,0xff9effbe,0x83afe6db,0x00000000,0x18c220e3,0x000018e3,0x7bef4a48,0x00002965,0x000018e3,0xffffc638,0xffdfffdf,0xffffffff,0xffffffff,0xffdfffdf,0xef3cffdf,0x08004986,0x000028e4,0xffffbdb7,
-0xffdfffff,0xffbeffdf,0xc5d7ffdf,0x31450000,0x630c0000,0xf7def7be,0xffdfffff,0x830dff5d,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20200000,0x48624061,0xffdfe638,0xffdeff9d,0xe73cffff,0x00001903,0x182020c2,0xffdfd5f8,0xffffffbe,0xffffffde,0x0000defb,0x21030000,
-0xb5340800,0xffbeffff,0xffffffff,0xffffffde,0xffffffff,0xffffffff,0x632cf79d,0x29040020,0xb5550000,0xb596ffbf,0x00003145,0x10a21061,0x18e30861,0x28e30000,0xc5d7b595,0x00005a69,0x10810820,0x00000861,0x00000000,0x00001882,0x000010a2,0xa4b30000,0xa4d3de9a,0x00001001,0x21241081,0x000010c2,0x8c920000,0x39c7c617,0x20a20000,0xb5550000,0xffffffdf,0xffffffdf,
-0xffffffff,0xffffffff,0xffffffff,0x0000a534,0x00002965,0xffff9492,0xffdeffff,0xffffffff,0xce79ffff,0x18a20000,0x000020c3,0xffffb555,0xffffffde,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x94b2ffdf,0x29240000,0x7bae0000,0xffdfffdf,0xffffffff,0xffffffdf,0x5a8af75d,0x21040000,0xdedb0000,0xffdfffff,0xffffffff,0xffffffdf,0xffffffff,0xf7beffff,
-0x00006b4d,0x000018c2,0xffffd69a,0x2924bdb6,0x00000000,0x00202124,0x5aaa0000,0x31658c30,0x10200000,0x002018a3,0x00000000,0x94928410,0x00000000,0x18a20841,0x00000000,0x94717b8e,0x00001020,0x18c31082,0x000018c2,0x8c710000,0xef5def7d,0x00005aaa,0x00002904,0xffffce79,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf75dffff,0x10004966,0x08002082,0xffffce18,
-0xffffffff,0xffdfffff,0xef1cffdf,0x00005aaa,0x00002103,0xffffbdd6,0xffdfffde,0x82ecff3d,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18000800,0x40e32000,0xffdfde18,0xffdeffbe,0xad34ffdf,0x29030000,0x72eb0800,0xffdeff7e,0xffdeffde,0xffffffdf,0x2124defb,0x21030000,
-0xbd960000,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x738ef7be,0x29040000,0xad340800,0xffffffff,0x8c51e71c,0x00000000,0x004018e2,0x000018c2,0x00000000,0x18610000,0x000028e3,0x94512081,0x0000a4d2,0x18a20000,0x10621062,0x00000821,0x00001882,0x20e30000,0x000020e3,0x5aaa0000,0xffffc638,0x3945e6fb,0x20c30000,0xbd960800,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x0000ad55,0x00002965,0xffff9cb2,0xffffffff,0xffdfffff,0xf7beffff,0x00008410,0x00002904,0xff9e734d,0xffdfffff,0xffffffde,0xffffffff,0xffffffdf,0xffffffdf,0xffffffff,0x18e3d6ba,0x20e30000,0xb5b60000,0xffdeffff,0xffffffdf,0xffdfffff,0x5aaaf77d,0x20a30000,0xe71c0000,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xf7beffff,
-0x00006b4c,0x000020e3,0xffffd69a,0xef3cffdf,0x00009492,0x08610000,0x000020e3,0x00000000,0x18c22103,0x00000000,0xd69a7bce,0xffdfffff,0x8430d6ba,0x00000000,0x20c32104,0x00000800,0x18c20000,0x086010a2,0x52aa0000,0xffdec638,0xef7dffff,0x00005aca,0x00002123,0xffffce79,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf73dffff,0x18005a08,0x080028a3,0xffffc5f7,
-0xffffffdf,0xffffffff,0xff7effdf,0x0000734d,0x00002123,0xe6fb5289,0xffdfffff,0x726bff1d,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20410000,0x30a21840,0xff9eddf8,0xffdfffdf,0x20e3ce38,0x18610800,0x31041000,0xf75cb534,0xffdeffdf,0xffffffbe,0x52caef7d,0x21240000,
-0xb5750000,0xffffffff,0xffffffff,0xffffffff,0xffffffde,0xffffffff,0x83eff7be,0x21040000,0xbdb60000,0xffffffdf,0xffffffff,0x5aebd679,0x00400000,0x08600000,0x18812103,0x00002903,0x730b1000,0xffbed659,0xd679ffff,0x0000734d,0x18c30000,0x106218c3,0x10620000,0x00001882,0x42080000,0xf79dbdb6,0xffffffff,0x0000de9a,0x20c30800,0xbd760800,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xfffff7de,0x0000b595,0x00002985,0xffff9cb2,0xffffffff,0xffdfffdf,0xffffffdf,0x0000b596,0x186120c3,0x8c100800,0xffbfe6db,0xffdfffff,0xffdfffff,0xffffffff,0xffdfffdf,0xc618f79e,0x00005acb,0x10611081,0x83ef0000,0xffffe71c,0xffdfffff,0xffffffdf,0x5aaaf77d,0x29040000,0xdeba0000,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0xf7beffff,
-0x00006b4d,0x000020c3,0xffffd6ba,0xffffffff,0xd69affff,0x00007bcf,0x10a20840,0x19030881,0x00000000,0xc617632c,0xffffffdf,0xffdeffdf,0xf7beffff,0x6b4dd679,0x00000000,0x20e320c3,0x10c10860,0x00000000,0xef7d9cf3,0xffdeffff,0xf77dffdf,0x000062eb,0x00002103,0xffffc658,0xffffffdf,0xffffffff,0xffffffff,0xffdfffff,0xf73dffff,0x10004125,0x000028c3,0xffffc638,
-0xffdfffff,0xffdfffff,0x8c30e6fb,0x18610000,0x10a10000,0x52690000,0xffbfc5f7,0x72abff5e,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x20612081,0xffdfcd96,0x9471e6db,0x00000820,0x104118a2,0x00001020,0x5aaa0000,0xffdfc5f7,0xffdfffff,0x73aef7be,0x29040000,
-0xbd950800,0xffdeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x840fffdf,0x21040000,0xc5d70000,0xffdeffff,0xffffffdf,0xef7dffff,0x00008c91,0x08201081,0x00001861,0x4a280000,0xff7db554,0xffdeffff,0xffffffde,0xb5b6f7be,0x000031a6,0x18c30000,0x08200821,0x00001061,0xdefb8410,0xffdfffff,0xffffffdf,0x2924e71b,0x18c30000,0xbd750000,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x0000a514,0x00002965,0xffffa4f3,0xffdfffdf,0xffffffff,0x9cb2f75d,0x10413145,0x08410000,0x00000820,0xa4f33125,0xffdfef3d,0xffdfffff,0xffdfffff,0xce39ffdf,0x0000736d,0x18610000,0x10411061,0x00001882,0xb59641c7,0xffdfffbe,0xffffffff,0x4a28ef3c,0x18c20000,0xe71c0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffbeffff,
-0x0000734d,0x000020e3,0xffffd69a,0xffdfffde,0xffffffff,0xa4f3ffbe,0x18c20000,0x000010c2,0xb59618c2,0xfffff79e,0xf7beffff,0xffffffde,0xffdfffff,0xf79effff,0x41e7ad54,0x10610000,0x00000840,0xc61839c6,0xffffffff,0xffbeffdf,0xf79effdf,0x0000630c,0x00002944,0xffffce58,0xffdfffdf,0xffffffff,0xffffffff,0xffffffff,0xef3cffff,0x200130a3,0x00001041,0xffffd699,
-0xffdfffff,0xbdb7f79e,0x00004a28,0x00201861,0x19030881,0x000028e3,0x8bef0000,0x49a7bd76,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000840,0xa4b29430,0x00000000,0x20c30840,0x00000000,0x104018a2,0x000018c2,0x8c100800,0xffffe6db,0x634cf7be,0x21030000,
-0xbdb60000,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x6b6df7be,0x21040000,0xc5d70800,0xffdfffff,0xffdeffff,0xffffffbe,0x2124ef7d,0x18810000,0x39650000,0xef3cad34,0xffffffff,0xffffffbe,0xffffffff,0xffffffff,0xad55ef5d,0x00002124,0x18a20841,0x83f00000,0xffffffbe,0xfffff7be,0xffffffff,0x0861e71b,0x18c20000,0xb5550000,0xffffffff,0xffffffff,
-0xffffffdf,0xffdfffff,0xffffffff,0x0000a4f3,0x08202945,0xffffa4f3,0xffffffff,0xad14ef3d,0x08004a08,0x18820000,0x10a218c2,0x21031061,0x00000000,0xbdb75a6a,0xffffef3d,0xdebaffdf,0x00008c10,0x18820000,0x20a21882,0x00000000,0x18611882,0x08200000,0xce38736d,0xfffff77e,0x2103dedb,0x10a20000,0xdedb0000,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xf7beffff,
-0x0000736d,0x000020e3,0xffffc618,0xffffffff,0xffffffbe,0xbd96ffff,0x18c30000,0x00000000,0xffffce59,0xffffffff,0xffffffdf,0xffdfffff,0xffffffff,0xffffffff,0xe6fbffff,0x00005aaa,0x00002124,0xffffc638,0xffdfffff,0xffffffff,0xf79effff,0x00006b0c,0x00003145,0xffffce38,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xe6fbffff,0x20212021,0x10810000,0xffffd6ba,
-0xd67affbe,0x00007bae,0x18a20000,0x10a21081,0x00000000,0x31040000,0x00001061,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00200040,0x08000800,0x21030000,0x00000000,0x3a076b4d,0x18a20000,0x108118a2,0x00001081,0xc5d762ab,0x7bcff79e,0x29440000,
-0xc5d71000,0xffbeffdf,0xffdeffff,0xffffffdf,0xffffffdf,0xffffffde,0x52caef7d,0x18c30000,0xc5d70000,0xffbeffff,0xffdfffff,0xffdfffff,0x0020b575,0x186118a1,0xc5d71861,0xffffffff,0xffffffde,0xffffffff,0xffffffff,0xf7deffff,0xffffffff,0x0000c638,0x10821062,0x52690000,0xffffef5d,0xffffffde,0xffffffdf,0x0000d6ba,0x18e30040,0xad340000,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffdf,0x00009cb2,0x00002965,0xffffb555,0xbdb6f75d,0x00005228,0x28e40800,0x000028e3,0x00000000,0x20c30000,0x20e310a2,0x00000000,0xc5b7528a,0x1821a4f3,0x00000000,0x106118e3,0x000018a2,0x318539a6,0x18c30000,0x08612103,0x00000000,0xce796b6d,0x0000c638,0x08810861,0xdedb0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffbeffff,
-0x0000736d,0x00002924,0xffffbdf7,0xffffffff,0xffdfffff,0x5aaaf77d,0x21240000,0x8c510000,0xffdeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffdf,0xffffffff,0x0000ad55,0x00002124,0xffdf9cf3,0xffffffdf,0xffbeffdf,0xf77dffdf,0x00006b2c,0x000020c3,0xffffc5f7,0xffffffdf,0xffffffff,0xffffffff,0xffdfffff,0xdebbffff,0x18201821,0x39c60000,0xe6fbe6fb,
-0x18629451,0x18820000,0x18e318c3,0x00000000,0xb5b66b6d,0x080062aa,0x10810820,0x00001081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18821041,0x10820861,0xa4f30800,0xdefbf7de,0x00006b6d,0x18c20000,0x21030020,0x00000000,0x5aaa736d,0x18c20000,
-0xc5960000,0xffbeffdf,0xffffffff,0xffdfffff,0xffdeffff,0xffffffde,0x2944ef3c,0x18a20000,0xce180000,0xffdfffff,0xffbeffff,0xe71cffff,0x000020e3,0x00002903,0xff9e83ae,0xffbeffdf,0xffffffff,0xffffffff,0xffdfffff,0xffffffdf,0xffffffdf,0x7bcfffdf,0x18c30000,0x000018a2,0xffffbd96,0xfffff7be,0xffffffdf,0x0000d6ba,0x18c30881,0xad140000,0xffffffff,0xffffffff,
-0xffdeffff,0xffffffdf,0xef7dffff,0x00007b8e,0x000020e3,0xc5f79c92,0x000062ab,0x20c30000,0x000020a3,0x52490000,0xc5f7bd96,0x000062cb,0x00200000,0x20c31081,0x00000800,0x00001000,0x082020e4,0x00000020,0x7bef0000,0xe71bdefb,0x00007bef,0x10c20000,0x10a22103,0x00000000,0x00002965,0x18c20840,0xdeda0000,0xffffffff,0xffdfffdf,0xffdfffdf,0xffdfffdf,0xff9effdf,
-0x00006b2c,0x000020e3,0xffffc638,0xffffffdf,0xffffffdf,0x0000c618,0x18c21081,0xd6790000,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0xffffffdf,0xffffffdf,0xffffffdf,0x0800e6db,0x00000000,0xdeba10a2,0xffbeffff,0xffdfffdf,0xff9effdf,0x00006b2c,0x00002924,0xffffce38,0xffffffdf,0xffffffff,0xffffffff,0xffdfffff,0xdebaffff,0x18620000,0x29240000,0x4a0883cf,
-0x18410000,0x18a218a2,0x00000020,0xb5d631c6,0xfffff7de,0xa4b2f73d,0x08a20000,0x00400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x08410000,0x00000862,0xffffbdb6,0xffffffff,0xbdd7f79e,0x00002103,0x106118c2,0x18612082,0x00000000,0x20c31061,
-0xb5340800,0xffdfffdf,0xffffffdf,0xffdfffff,0xffdfffff,0xffdfffff,0x1020e6db,0x18a30000,0xc5d70000,0xffffffdf,0xffdfffff,0x83efffbe,0x21030000,0x31440000,0xffdfe6db,0xffffffdf,0xffdfffdf,0xffdfffdf,0xffffffff,0xffdfffff,0xffffffdf,0xdedbffff,0x00002124,0x00001081,0xff7d6aec,0xffffffff,0xffdfffdf,0x0000dedb,0x18a20020,0xa4d30000,0xffffffff,0xffdfffff,
-0xffffffdf,0xffdfffff,0xf79effff,0x0000732d,0x00201081,0x00000800,0x20a20000,0x208220c3,0x10610000,0xe71c9c92,0xffffffff,0x9cf3ef7d,0x00002965,0x08001041,0x20a21861,0x10201862,0x10810000,0x4a480000,0xffdfc617,0xffffffff,0xce58ffde,0x00006b6d,0x21030000,0x000018e3,0x18610000,0x10411000,0xe71c0800,0xffffffdf,0xffffffff,0xffdfffff,0xffdfffff,0xff9effdf,
-0x082062eb,0x00002104,0xffffbdf7,0xffffffff,0xf77dffdf,0x000062cb,0x000020e3,0xf79e630c,0xffffffff,0xffffffff,0xffdfffff,0xffdfffff,0xffdfffff,0xffffffff,0xffdfffdf,0xa4d3ffff,0x39a60000,0x9cd30000,0xffffffff,0xffffffff,0xef5dffff,0x00005a8a,0x00002924,0xffffce58,0xffffffff,0xffffffff,0xffdfffff,0xffffffdf,0xce58ffff,0x10810000,0x00000040,0x00000000,
-0x20822903,0x000020e3,0x9cf30000,0xffffe73c,0xffffffdf,0xcdf8ffdf,0x00000020,0x00000881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00200020,0x00000000,0xce38736d,0xffdfffdf,0xffffffff,0x8430df1b,0x00000000,0x106120c3,0x086110c2,0x18410000,
-0x730b0000,0xbd96b575,0xc5d7bdb6,0xc5d7bdb6,0xc5d6c5d7,0xbd96b555,0x00009cb2,0x18820000,0x734d0000,0xbdb6b575,0xe6fbce38,0x0000b575,0x086118a2,0x5a8a0000,0xde9ace17,0xef3cef3c,0xffdfffbe,0xffffffdf,0xffdfffff,0xffdfffff,0xffbfffdf,0xffdeffbe,0x00007bce,0x080020e3,0xb5351000,0xef1cef1c,0xf77def1c,0x0000c5f7,0x20e30000,0x94510000,0xf77def5d,0xf75dff7e,
-0xef5df75d,0xef3cef5d,0xe73cef7d,0x00006b0c,0x000010a2,0x18820000,0x108120c3,0x00000000,0xd69a83cf,0xffffffff,0xffdeffff,0xffbeffff,0x00008c51,0x080020a2,0x18610000,0x08201882,0x18a20000,0x630c0000,0xffffdedb,0xffdfffdf,0xffffffff,0xc617f79e,0x00005aaa,0x18c31062,0x00001061,0x10200820,0x8c510000,0xbdd7bdb6,0xbdd7bdd7,0xc5d7c5f7,0xc5d7c5d7,0xad34c5b7,
-0x000039a6,0x000018c2,0xdefb9492,0xdedadedb,0xad14e71b,0x20a20000,0x000020c3,0xef5d9471,0xef5df77d,0xffdfef7d,0xffdfffdf,0xffffffdf,0xffffffdf,0xf79effbe,0xf79eff9e,0xb596f77e,0x10a20000,0x41c70000,0xd69ace58,0xce38ce59,0x9cd3b596,0x000018a2,0x00001081,0xb595736d,0xb555b596,0xad34ad34,0xa4f3ad14,0xad34a4f3,0x528a9cd3,0x08610000,0x00200020,0x18a210a2,
-0x000020c3,0x73ae0000,0xffffce79,0xffdfffff,0xf77dffff,0x18419cb2,0x00610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000841,0x08610000,0x00000000,0xf75d9492,0xffdfffdf,0xffdfffff,0x4a89bdf7,0x00000000,0x000010c3,0x08000000,
-0x00001081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x00001020,0x00000000,0x10610800,0x00001041,0x00000020,0x08000800,0x18611000,0x31254a08,0xff9e9472,0xffdfffdf,0xffffffbf,0xa4d3e71c,0x94719cb2,0x7bcf83ef,0x00004a28,0x08000841,0x10000800,0x49e73124,0x4a0841a6,0x000041c7,0x08200000,0x20c30000,0x52695229,0x628a6acb,
-0x52695228,0x4a085249,0x42075aaa,0x08000820,0x00000020,0x20c30840,0x00000000,0xd679840f,0xfffff7be,0xffdeffff,0xffffffff,0x9492e71b,0x00003986,0x08201020,0x000020c3,0x10810000,0x08001061,0x00000820,0xbdb620e3,0xffffffde,0xffffffdf,0xffffffff,0x9492ef5d,0x00000000,0x004018c2,0x00000000,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x10810000,0x00000000,0x10410000,0x20a22904,0x000020c3,0x08201041,0x00000000,0x4a2820e3,0x4a28528a,0x94714a28,0xfffff79d,0xffdfffdf,0xef3dffdf,0x736d8c30,0x732d7b8e,0x41a662aa,0x00000000,0x00000840,0x08400020,0x00000000,0x00000000,0x00000000,0x10810000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000861,0x00000000,0x00001861,
-0x6b4c0000,0xf7debdf7,0xffdeffff,0xffbeffdf,0x5269ce38,0x00000800,0x08600040,0x100020a2,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18c20800,0x00001081,0x106118c3,0x62cb0000,0xffdfde9a,0xffffffbe,0xef9effff,0x0000a534,0x00410000,0x00000820,
-0x08810000,0x19231903,0x110308c2,0x08a210e3,0x190310c2,0x18c218c2,0x002018e3,0x00410000,0x18a20841,0x086120e3,0x00001061,0x10200800,0x00000000,0x00000820,0x08001841,0x00000000,0xad150000,0xffbfffbf,0xe6fbffdf,0x08005a8a,0x00000800,0x00000000,0x10610000,0x00000000,0x10000800,0x00000000,0x00000000,0x00000000,0x00000820,0x00000820,0x08000000,0x00000000,
-0x00000800,0x00000000,0x00000000,0x08000000,0x10810000,0x00000000,0xce794a69,0xffffffdf,0xffffffff,0xffffffff,0xce38ffff,0x000041c7,0x10410000,0x00001882,0x10810000,0x000052aa,0x18c30000,0x10610861,0x00000000,0xf77d840f,0xffffffff,0xffdeffdf,0xffffffdf,0x7befe71c,0x00000000,0x00200861,0x10c20040,0x192310e3,0x19231103,0x19241944,0x08a21904,0x10e310c3,
-0x00000040,0x00000820,0x08000840,0x00000000,0x08200000,0x00000800,0x08001041,0x00000000,0x00000000,0x00000000,0xffff9cd3,0xffdfffbe,0x83efffbf,0x08000000,0x00000800,0x00000000,0x08410000,0x10810000,0x00000000,0x08610841,0x18c320e3,0x08200020,0x00000000,0x18e318a2,0x214418e3,0x20e32124,0x31453145,0x31452904,0x10612944,0x08610000,0x10410000,0x00000000,
-0xffbebd96,0xffffffff,0xffdfffdf,0xc5b6ffdf,0x08000000,0x000020c3,0x000008a1,0x10000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x28821820,0x00001000,0x18c21061,0x08200000,0x00002944,0xffbf9410,0xffdfffdf,0xffffffff,0xdefbffff,0x000094b2,0x08000821,
-0x08200000,0x10c30861,0x10e308a2,0x190318e3,0x18c310a2,0x000020c3,0x00000000,0x10620000,0x20c30800,0x10a210a2,0x10610820,0x00001020,0x18e31081,0x20c310a2,0x20a21882,0x20a21081,0x28c40000,0xffdfe6db,0x83cfff9e,0x28e40000,0x31241862,0x290428e3,0x18a218c2,0x00001081,0x10410000,0x10411061,0x20e320c3,0x19032103,0x002010a2,0x00000020,0x20821061,0x28c32904,
-0x28e420a3,0x29042904,0x20e32103,0x000018a2,0x00000840,0x9cf30020,0xffffe73c,0xffffffdf,0xffffffff,0xffffffff,0x4a08f79e,0x31040000,0x20c30800,0x00000000,0xd6ba8430,0xbdf7f79d,0x0000528a,0x10a10000,0x002010c2,0xd6990000,0xffdeffff,0xffdfffff,0xffdfffff,0xffdfffff,0x4a08ce38,0x10610000,0x00000820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000020,
-0x00000000,0x10810840,0x00000000,0x10201861,0x10610820,0x10a20000,0x18a21081,0x20e318c2,0x292418a2,0x20c318a2,0xce590000,0xffffffff,0x0000bdb7,0x186128e3,0x312420a2,0x20c32904,0x18c220e3,0x000018e3,0x10810861,0x08610000,0x00000861,0x108110a2,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000040,0x000018c3,0xce79528a,
-0xffdeffff,0xfffff7de,0xffffffff,0x9431ffbf,0x18c20000,0x10810000,0x31440000,0x62299c10,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x410438e4,0xa4b2acd3,0x00000000,0x00000840,0x080018c2,0xffbf838e,0xffdfffdf,0xf7deffff,0xffffffff,0x7bcfffff,0x31240000,
-0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001041,0x00001062,0x00000800,0x00000000,0x08000000,0x10410800,0x00000000,0x00000000,0x00000000,0x08200000,0x000020a3,0xffbf7b8e,0x0800ce18,0x102028e4,0x00001841,0x00000000,0x00000000,0x10810000,0x00000000,0x00200000,0x08000000,0x00000000,0x08610000,0x00400000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x10200000,0x000018c2,0xffdfa4f3,0xffffffff,0xfffff79e,0xffffffff,0xffffffff,0x41a6f75d,0x10200800,0x00001020,0xd6ba738e,0xffffffff,0xffffffff,0x9d13e73c,0x00000020,0x002010c2,0xce790020,0xffffffff,0xffffffdf,0xffffffff,0xffffffbf,0x734dffbe,0x20820000,0x39a60000,0x62eb5289,0x6b4c6b6d,0x4a6962eb,0x18c320e4,0x00000000,
-0x08400000,0x00000000,0x08002904,0x08200000,0x00001041,0x00000861,0x00000000,0x00000000,0x00000000,0x20c30000,0x5a8a0000,0xe71cf75d,0x08003966,0x18a21861,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00001081,0x00000000,0x00000000,0x00000840,0x00200020,0x29240000,0x6b0c41e7,0x83ef83ef,0x8c50840f,0x31a6736d,0x00600000,0x31450000,0xffffd6ba,
-0xffffffdf,0xffffffff,0xffdfffdf,0x7b4eff9e,0x18c30800,0x000010a2,0xd6795b0b,0x8b6eff7e,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000000,0x48e45125,0xffdfd5b7,0x7bcede99,0x10810000,0x00001861,0xf71c6249,0xffdfffdf,0xffffffde,0xffffffff,0x8c91ffff,0x28a30000,
-0x5a490800,0xd659ce18,0xb5b6c618,0xad55ad55,0xb575b596,0x39869471,0x18820000,0x62cb0000,0xd69adedb,0x8c51bdf7,0x00000000,0x00001041,0xa5346b4d,0xbdd7b595,0x9cd3c618,0x00000000,0x08000821,0xa4d31841,0x00005249,0x000020a2,0x41a60800,0x5aca5a69,0x62eb5aaa,0x00002965,0x000010a2,0x08400020,0x94717bae,0x9d138c91,0x00006b4d,0x00400861,0x29040000,0xa4f39451,
-0x8c719cd2,0x8c3083ef,0x94b29cd2,0x00004a48,0x000018e2,0xffdfad55,0xffbeffdf,0xffffffff,0xffffffff,0xffffffde,0x2103e71b,0x20a20000,0xad350000,0xffffffbe,0xffffffbe,0xf7dfffff,0xffffffff,0x5acadeda,0x29030000,0xce380000,0xffffffff,0xce38ffbe,0xf77dc5d7,0xffffffdf,0x62cbf77d,0x18410000,0xd6790820,0xef7dffbe,0xf79effbe,0xef7def7d,0xbdb6f79e,0x18c30000,
-0x00001081,0xc6182924,0xef3cf75d,0x0000b576,0x10811882,0x73ae0820,0xd69ace79,0xce58ce58,0x8430bdd6,0x00001882,0x000020c3,0x736d738e,0x08200000,0x000018a2,0xb596630c,0xa514b575,0xbdb6ad75,0x00008430,0x10a21081,0xad540000,0xdefbef7d,0x9cf3e73c,0x18c20000,0x08410020,0xef7dc638,0xf79ee73c,0xf7beffdf,0xffdff7de,0xce38ffbe,0x19030000,0x39860000,0xffffef5d,
-0xce59f77d,0xe75cc618,0xffdfffff,0x628aff9e,0x18e30000,0x630b0000,0xffffef7c,0x93afff7e,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200000,0x48625104,0xffbed5d7,0xe73bffff,0x000031a6,0x000018a2,0xeedb41a6,0xffdfffdf,0xad14ef1c,0xf77dbd96,0x8c71ffff,0x39250800,
-0x6aab1000,0xffffff9e,0xffffffff,0xffffffff,0xffffffff,0x0000d679,0x20e41041,0xbdd70000,0xffffffff,0xbdd6ffdf,0x20c30000,0x5aaa0800,0xffffef7d,0xffffffff,0xffdfffdf,0x00009491,0x08201082,0x00000800,0x10210000,0x10400800,0xef3cbd95,0xf77de71b,0xf77df77d,0x39c6d69a,0x08610000,0x00000881,0xffffce18,0xffffffff,0x41e7e73c,0x18c20000,0x20e30000,0xffffe6fb,
-0xffffffff,0xffdeffff,0xffffffff,0x00009cd2,0x00002965,0xffffad34,0xffffffff,0xc5f7ef3c,0xff9ede99,0xffffffff,0x0000e71b,0x00001041,0xf77e4a08,0xffdfffdf,0xffffffff,0xffffffdf,0xffdeffff,0x9492ffff,0x29440000,0xbd960800,0xde9affdf,0x00009431,0x732d0000,0xff9ebdb7,0x4a08f75d,0x00000800,0xf79d5248,0xffffffff,0xffffffff,0xffffffff,0x83efffbe,0x18820000,
-0x000010a2,0xffffad75,0xffffffdf,0x0000ad14,0x00002924,0xdefb2124,0xffffffff,0xffffffff,0xffffffff,0x0000ad55,0x18a21041,0x00000000,0x18a21882,0x5acb0000,0xffffef5d,0xffffffff,0xffffffff,0x5acaf79e,0x21240000,0x8c710000,0xffffffff,0xf79dffff,0x00006b6d,0x000018a2,0xffffbdf7,0xffffffff,0xffffffdf,0xffdfffff,0xd69affff,0x10c30000,0x41a70000,0xb596c618,
-0x00005269,0x4a690000,0xde9a9cd3,0x3945e6bb,0x21440000,0x73ce0000,0xffffffde,0x9befff9d,0x18c30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20810000,0x50415925,0xffbeddb6,0xf79dffbe,0x00005289,0x000018a2,0xe6ba1000,0xa4d3f75d,0x00003104,0x62aa0000,0x8c51c617,0x28820000,
-0x62291000,0xffdff73d,0xffffffdf,0xffffffff,0xf7beffff,0x0000840f,0x00002924,0xef5d4a49,0xffffffdf,0x4a48ef7d,0x20c30000,0xbd960000,0xffdeffff,0xf7beffdf,0xffffffff,0x0000defb,0x00410000,0x10a20840,0x20e31081,0x8c500000,0xffffffff,0xffffffff,0xffdfffff,0xa534ffff,0x18c20000,0x00000881,0xff9e730c,0xffdeffdf,0xb555ffff,0x20c30000,0x00001061,0xffdf9431,
-0xffffffff,0xffffffff,0xffffffff,0x0000ad34,0x00002944,0xffdf9cb2,0xb554ef1b,0x100049e7,0x83ae1861,0xff9dce18,0x0000c617,0x000018a2,0xf79d632c,0xffffffff,0xffffffff,0xffdfffff,0xffffffff,0x9cd2ffde,0x29030000,0x736d0000,0x08009450,0x10200000,0x000020c3,0x7bcf0000,0x10419cd3,0x00001061,0xf77d6b2c,0xffdeffff,0xffffffff,0xffffffbe,0x0000c5d7,0x20e318a3,
-0x6b6d0000,0xfffff79e,0xd679ffdf,0x08000000,0x000018c2,0xffff9cf3,0xffffffff,0xffffffff,0xffdfffdf,0x73aeffde,0x18a20000,0x10a21081,0x00000800,0xd69a0000,0xffdfffff,0xffffffff,0xffdfffff,0xb575ffdf,0x29030000,0x00000000,0xffffdefb,0xffdeffde,0x0000c638,0x00002944,0xef7d632c,0xffffffff,0xffffffff,0xffffffff,0xd69affdf,0x10a20000,0x18620000,0x000010a2,
-0x18c20000,0x00002104,0x28e40000,0x000041a7,0x10e20000,0x6b6c0000,0xffdeffde,0x93efff9e,0x18c30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20400000,0x58c348a2,0xffbed596,0xf77dfffe,0x00005269,0x000010a2,0x8c101020,0x00005a69,0x29030000,0x000020a2,0x10410000,0x18210800,
-0x62091000,0xfffff71c,0xffffffdf,0xffdeffff,0xc617ffff,0x10810000,0x000020e3,0xffffbdb6,0xffffffdf,0x0000ad75,0x00002924,0xef3c62aa,0xffffffff,0xffffffff,0xffdfffbe,0x9cf3ffff,0x18e30000,0x00000020,0x00000840,0xef1b4a07,0xffdeffff,0xffffffde,0xffdfffff,0xef7dffff,0x00004a28,0x10a210c2,0xce180800,0xffdfffff,0xe71cffff,0x08004a28,0x10211882,0xde9a1000,
-0xffffffff,0xffffffff,0xffffffde,0x0000ad55,0x00002924,0x9c926b0c,0x00003986,0x18610000,0x08000800,0x6b0c0000,0x00006b0b,0x000020a2,0xffdf840f,0xffffffff,0xffffffff,0xffffffdf,0xffffffdf,0x9491ffff,0x21030000,0x00000020,0x00000000,0x188220c3,0x290420c3,0x000020c3,0x00000000,0x000018a2,0xef7d5aca,0xffdfffff,0xffbeffff,0xe6fbffff,0x000039c7,0x000020c3,
-0xd6da31a6,0xffdfffff,0x9451ff9e,0x20c30800,0x42070000,0xffffe73c,0xffdfffff,0xffffffff,0xffffffff,0xd69affff,0x08410000,0x00000840,0x000018e3,0xffff9cf3,0xffffffdf,0xffffffff,0xffffffff,0xef3cffff,0x000041e7,0x00002924,0xffffb595,0xffffffff,0x8c30f7be,0x29240000,0xc5f70000,0xffffffdf,0xffffffff,0xffffffff,0xde9affff,0x08410000,0x08001021,0x18c30000,
-0x20a218c2,0x08200000,0x08003165,0x10000000,0x08810000,0x6b6d0000,0xfffff79d,0x8baeff9d,0x18c30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200000,0x50a250c3,0xffded596,0xf77dffff,0x0000528a,0x00000861,0x00000820,0x29040000,0x20c220e3,0x10810840,0x000010a2,0x20420800,
-0x6a6a1000,0xffdff77e,0xffffffbe,0xffffffdf,0x5a8af77d,0x21240000,0x738d0000,0xffdeffde,0xe75cffff,0x00004248,0x00002164,0xffdfb535,0xffffffdf,0xffffffff,0xf7ffffff,0xf77dffff,0x0000630c,0x08200861,0x000018a2,0xffffb555,0xffffffbe,0xffffffff,0xffffffff,0xffffffff,0x0000b595,0x18e310a2,0x840f0000,0xfffff7df,0xffffffff,0x0800b576,0x20a220c3,0x736d0000,
-0xfffef77d,0xffffffff,0xffffffff,0x0000bd95,0x10612103,0x00000000,0x29040000,0x10812124,0x210320e3,0x000018a2,0x18820000,0x000018a3,0xffdf8c31,0xffffffff,0xffffffdf,0xffdfffff,0xffffffbe,0x7befffbe,0x20e30000,0x08610000,0x20e318a2,0x000018c2,0x00000000,0x20e320a2,0x000010a2,0x000018a3,0xf7be5acb,0xffdfffdf,0xffffffdf,0x8c30ffdf,0x21040000,0x000010a2,
-0xffffb5d6,0xfffff7be,0x3145ef5c,0x28e30800,0xa4f30800,0xffffffff,0xffffffdf,0xffffffff,0xffffffff,0xf79effff,0x00007bcf,0x086110a2,0x4a480000,0xffffef5c,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0x00009cd3,0x00002103,0xffff7bce,0xf7beffff,0xe6fbffff,0x080018a2,0x42280000,0xffdfef5c,0xffdfffdf,0xffdfffff,0xd67affdf,0x10820000,0x00200000,0x18c30841,
-0x00000000,0x18c218a1,0x00000000,0x10203104,0x18c20000,0x6b2c0000,0xffdeffbe,0x836dff7d,0x18c30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200000,0x406140a2,0xffbed5d6,0xffbeffdf,0x00006b4d,0x000018c3,0x20c30000,0x00002924,0x00000000,0x10e208a2,0x002008a2,0x18210000,
-0x51e81800,0xffffe71c,0xffbeffdf,0xffffffbe,0x0000b555,0x00202124,0xce581040,0xffdfffde,0xce58ffff,0x21440000,0x000008a1,0xff9e9410,0xffdfffdf,0xffdfffdf,0xffffffff,0xffffffbe,0x0000b596,0x00001081,0x000020e3,0xffbea4b3,0xffdfffbe,0xffffffff,0xfffff7ff,0xffffffff,0x3165ef3c,0x20e30800,0x9cb20000,0xf7dfffff,0xffffffff,0x5a8af75d,0x18a20000,0x000018c2,
-0xffdfb555,0xffdfffdf,0xffffffff,0x0000bd96,0x002020e3,0x29041041,0x000020c3,0x00200000,0x00000000,0x20e22123,0x000018c2,0x00000821,0xbdd741c7,0xffdff77e,0xffbfffff,0xffffffbf,0xffffffff,0x39c6ce38,0x08200000,0x08610000,0x000010a2,0x6b4c0000,0x7baea533,0x00000000,0x000018e2,0x00000861,0xce392945,0xffffffdf,0xffffffdf,0x0800ce18,0x18e31082,0x84300000,
-0xfffff7de,0xf7beffff,0x9471ffbe,0x31240000,0xb5750000,0xffdfffff,0xffffffff,0xffdfffff,0xffbeffdf,0xef5dffff,0x00005aaa,0x10810841,0x52890000,0xffffef3c,0xffdfffff,0xffffffff,0xffdfffff,0xffffffff,0x00009492,0x00002904,0xffdf8430,0xffffffff,0xffdfffbe,0x0000a513,0x00002944,0xffffa513,0xffffffdf,0xffbfffff,0x7baede9a,0x10610000,0x08410000,0x00000861,
-0xa51320e3,0xd6b9deda,0x31859cf3,0x00000000,0x10810000,0x41e70000,0xffffd679,0x7b4dff9e,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x30402020,0xffdfcdb6,0xef5dffff,0x000062eb,0x00000861,0x00001061,0x6b2c0000,0x632bad34,0x00000000,0x10a20020,0x08000000,
-0x08001821,0xc6185269,0xffdfffdf,0xe71cffff,0x08203186,0x00002103,0xff9e83cf,0xffdeffff,0xef3cffff,0x00002924,0x106110a2,0xde592862,0xffdfffbf,0xffdfffff,0xffbeffdf,0xef3cffff,0x00006b2c,0x000018c2,0x10210820,0xde591000,0xffdfffff,0xffdfffff,0xffffffff,0xffffffbe,0x0000d699,0x18211821,0xd6792041,0xf7deffff,0xf7deffff,0xbdf7ffff,0x18c20000,0x08200881,
-0xde392862,0xffdfffdf,0xce38ff7d,0x0000732d,0x08401061,0x000018c2,0x42070000,0xbe17bdd7,0x10e27c0f,0x00000000,0x00000000,0x10410000,0x00000000,0xbd965a6a,0xffdfef1c,0xffdfffff,0x9430e6db,0x00000800,0x00000820,0x00000020,0x5aeb0000,0xef9dbdd6,0xf7bdffff,0x1903bdf6,0x18c20000,0x10810000,0x08610000,0xdeba8c51,0xef3dffff,0x00005a8a,0x000018a3,0xef7d5aeb,
-0xffdeffff,0xffffffff,0xce18ffff,0x28e30000,0x52aa0000,0xfffff79e,0xffffffdf,0xffdfffbf,0xffdfffdf,0xa4f3ffff,0x10820000,0x00200020,0x000018c2,0xffdead55,0xffdfffdf,0xffffffff,0xffdfffff,0xd679ffff,0x08002082,0x000020c3,0xffffc5f7,0xfffff7be,0xffffffff,0x39a6e6fb,0x08200000,0xdeba1061,0xffdfffdf,0x9492ef3c,0x00000800,0x00000841,0x00001081,0x73ce0000,
-0xffffdedb,0xffffffff,0xe71bffff,0x29249cb2,0x00000020,0x00000861,0x9cb21081,0x5a89ce38,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x10001881,0xf73cb513,0x62ccbd96,0x10a20000,0x10610000,0x41c70000,0xf77dc5d7,0xf79dffdf,0x840fc638,0x00000000,0x000010a2,
-0x10210000,0x08400000,0xd69a8c51,0x9cf3ffdf,0x18e30000,0x00001041,0xffffde79,0xffdeffde,0xffdfffdf,0x0000a4f3,0x108118c2,0x836e0800,0xffdfff9f,0xffdfff9e,0xffdfffdf,0x8c51ffdf,0x18c30000,0x10410840,0x20c30000,0x7b6d0800,0xffdff77d,0xffdfffff,0xffffffdf,0xffbeffdf,0x08008c10,0x08003104,0xff9e7b4d,0xffdfffdf,0xffffffff,0xffffffff,0x00008c51,0x10612124,
-0x832d1000,0xcdf7e67a,0x10007b8e,0x10610000,0x08200000,0x52aa0000,0xe73cbdf7,0xffffffff,0xdefbf7de,0x73cebe17,0x00000000,0x00000020,0x18a31041,0x08000000,0xad1441c7,0x9451c5d7,0x08001861,0x10411021,0x08200000,0x31a60000,0xf79ebdd7,0xffffffff,0xffffffff,0xdedaffff,0x000073ae,0x000010a2,0x00000840,0x00000000,0x83f09cb2,0x18a30000,0x000018a3,0xffffce59,
-0xffdfffdf,0xffffffdf,0xf77dffff,0x0000736d,0x004018e3,0xffdfb596,0xffffffdf,0xffdfffbf,0xffffffbe,0x1041d69a,0x10610000,0x00000000,0x00000840,0xef5c2944,0xffdfffff,0xffdfffdf,0xffdfffff,0x7b8ef79e,0x20c30000,0x31450000,0xffffe73c,0xffffffde,0xffffffde,0xbd96ffff,0x29030000,0x738e0000,0xb596d69a,0x0000526a,0x18a30000,0x18820000,0x52690000,0xf7ded699,
-0xffdeffff,0xffffffdf,0xfffff7de,0xad34ffdf,0x08810000,0x08410000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000040,0x6aeb62aa,0x00000000,0x00000821,0x08200820,0xef1c732d,0xffffffdf,0xffffffde,0xf79effff,0x5b2cce99,0x18820000,
-0x00000800,0x08401081,0x18820000,0x42289492,0x21240000,0x94310000,0xffdfffdf,0xffffffff,0xffdfffdf,0x18a2e6fb,0x18c20000,0x10001041,0xffbfcdd7,0xffdfffbf,0xffbeff7d,0x0000c618,0x10a210a2,0x00000000,0x00001061,0x000020c3,0xffdfad34,0xffdfffdf,0xffbeffdf,0xde9affff,0x00001081,0x08002903,0xffdfb535,0xffdfffbe,0xffdeffdf,0xffffffde,0x4a48ef5c,0x18a20000,
-0x08001000,0x10002021,0x10810800,0x00000881,0x00000840,0xef5d9491,0xffffffff,0xffdfffde,0xffffffff,0xf79dffff,0x000083ef,0x000018a2,0x18c20800,0x210310a2,0x00000000,0x00000020,0x18a20000,0x00001881,0x00001061,0xce580861,0xffffffff,0xffffffdf,0xffffffff,0xfffff7be,0x0000deba,0x10810000,0x18c20000,0x000018c3,0x08200000,0x20c31041,0x7bef0000,0xffffffde,
-0xffdfffbf,0xffbfffdf,0xffffffff,0x0000ce38,0x00002103,0xf77e52aa,0xffdfffff,0xffdfffdf,0xffbeffdf,0x000083ef,0x082018c3,0x18a218c2,0x18a20000,0x94710000,0xffffffdf,0xffffffdf,0xffffffff,0x0000c5f7,0x20c31862,0xa4d30000,0xffffffff,0xffffffdf,0xffbeffff,0xef3cffff,0x082049e7,0x000018c2,0x00000820,0x20a30000,0x000018a2,0x18c20000,0xa5130000,0xffffffff,
-0xffffffff,0xffffffff,0xffbeffff,0xc5f7ffdf,0x10820800,0x00000000,0x18a218a2,0x08001841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08800000,0x00000000,0x18a420e4,0x00000000,0x080018c3,0xffdfa4b2,0xffdfffbe,0xffffffde,0xffdeffdf,0xad75ffff,0x18c30000,
-0x00200000,0x08400000,0x00002103,0x00000000,0x000010a2,0xef3c5269,0xffbeffdf,0xf77dffdf,0xde9aeedb,0x5aaad659,0x08610000,0x00000820,0x838e49e7,0x8bf08bef,0x7b6d83ae,0x000041e7,0x000018c2,0x20e339c6,0x10410000,0x10200800,0xcdf71821,0xf73df71c,0xff9ef73d,0x9471ff7e,0x21230000,0x18610000,0xffdfe6db,0xffdfffbe,0xffffffff,0xffffffff,0xc618ffff,0x10200800,
-0x18a20820,0x20a20800,0x18e32103,0x08610040,0x52490000,0xffffef3c,0xf7fefffe,0xffffffff,0xffbeffff,0xffffffbe,0x00009cb2,0x082020c3,0x00000000,0x18e20000,0x18e218e2,0x18c210a1,0x108120e3,0x08400000,0x00001061,0xdeda31a6,0xf7beffff,0xffdfffff,0xffdfffdf,0xffffffff,0x3986deba,0x08200000,0x08400000,0x210318a2,0x10812124,0x00001061,0xf77d5269,0xffdfffff,
-0xffdfffbf,0xff9ef77d,0xe71cef3c,0x0000c5f7,0x18c20861,0xa4d30000,0xe6dbe6fc,0xde7ae6db,0xa4f3d659,0x08200000,0x10820820,0x00000000,0x084018c3,0x00000820,0xb5b69471,0xad55b596,0xa4f3b596,0x00005249,0x08001882,0x6b2c0000,0x9cb29cd3,0xd6799492,0xffdfffde,0xffffffdf,0x0000bdb6,0x10a218c2,0x20a30800,0x28e41841,0x00201062,0x10810020,0xbdb60800,0xffffffff,
-0xffffffdf,0xffdeffff,0xffdfffff,0xc5b6ffdf,0x10610000,0x08001062,0x00000000,0x10002061,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x28e41020,0x00000800,0x00000000,0x000018e3,0xffdfacb3,0xffdfffdf,0xffdeffff,0xffffffdf,0xb5d7ffff,0x18c20000,
-0x00000840,0x10810000,0x106218e3,0x106120a3,0x000010a2,0xffdfc618,0xffffffdf,0x736de6db,0x08001881,0x08200000,0x00000000,0x10410000,0x00000000,0x00000000,0x00000000,0x20c20000,0x29440000,0xc618dedb,0x10610000,0x08200861,0x20410000,0x498630c4,0x72ec51c8,0x00006b0c,0x00200000,0x10200800,0x9c72838e,0xad149451,0xf79ebdb6,0xffbeffde,0xffbeffff,0x0000ad54,
-0x002010c2,0x00202103,0x00000000,0x10610840,0x732c0000,0xfffff77d,0xffffffdf,0xffffffff,0xffffffde,0xffdeffff,0x00008c30,0x000020e3,0x736d3165,0x000041c6,0x20e20000,0x18a118c2,0x10200000,0x000041c6,0x00001040,0xd69a0000,0xffffffdf,0xffffffff,0xffdfffff,0xffffffdf,0x3124e6db,0x10610000,0x00000820,0x00000000,0x08200020,0x00002104,0xffffa514,0xffdfffdf,
-0xd619ffdf,0x5a8a62ec,0x10214a29,0x00200000,0x00000000,0x00000020,0x28821841,0x10002062,0x00000000,0x08200820,0x000018a2,0x9cf3ad55,0x18a20000,0x10810020,0x00000000,0x00000000,0x00000000,0x08200000,0x00000000,0x00001041,0x00000000,0x10410000,0xffffdeba,0xffdfffbe,0x0000d659,0x000010a2,0x20c31062,0x00000800,0x00000000,0x18c20000,0xb5960000,0xffffffff,
-0xffffffff,0xffffffff,0xffdeffdf,0xbd96ffff,0x10a20000,0x00000020,0x210410a2,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000000,0x00001000,0x31a61061,0x08610000,0x000010a2,0xffdfb4d3,0xffffffbe,0xffdfffff,0xffdeffdf,0xbdf7ffff,0x18c20000,
-0x10810020,0x00000000,0x10610000,0x08001862,0x000010a2,0xffffd679,0xdedbffff,0x00004a28,0x10811061,0x002018c2,0x10611861,0x00000000,0x10e20881,0x294418c2,0x29642123,0x00002903,0xbdd60000,0xffbeffff,0x00009cd2,0x08612103,0x10201061,0x10000800,0x08001000,0x00000000,0x00000020,0x08000000,0x08000800,0x00000800,0xce380000,0xffbeffff,0xffffffde,0x0000ce17,
-0x10a110a1,0x00000000,0x9cb2840f,0x18610000,0x730c0800,0xffdff79d,0xffffffff,0xffffffff,0xffffffff,0xffdeffdf,0x00008c71,0x00002924,0xf77d6b4c,0xa513e71b,0x00002944,0x00000000,0xc5f7736d,0x62cae6db,0x29030000,0xbdf70000,0xffdeffff,0xffffffff,0xffffffff,0xffffffdf,0x1000deba,0x18a20000,0xad750000,0x8430bdd6,0x00000841,0x00001061,0xef3c4a49,0xffdfffff,
-0x5a49f75d,0x00000000,0x08200800,0x08810861,0x10401041,0x10610820,0x08000800,0x10201000,0x18811881,0x29040820,0x8c510000,0xffdfffdf,0x00009491,0x00202103,0x18c218c3,0x18a218c3,0x20e318a2,0x00000840,0x08401041,0x18a20800,0x10612904,0x00003165,0xf77d62cb,0xf79effff,0x00007b8e,0x002010a2,0x00001061,0x8c310000,0x5289bdd6,0x18c30000,0xbdf70000,0xffffffff,
-0xffffffff,0xffffffde,0xffdfffdf,0xbdb6ffdf,0x10c20000,0x000010a2,0xdedb8c91,0x10209451,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20001800,0xa4d25a07,0xbdf7ef3c,0x10610000,0x000018a2,0xff7e9c31,0xffdeffff,0xffffffde,0xffdeffbe,0xc638ffff,0x10a20000,
-0x000008a2,0xd618ad14,0x0000732d,0x08410000,0x000010c3,0xff9e736d,0x6b4cff9e,0x21440000,0x00201061,0x00000000,0x00000000,0x00200820,0x00200000,0x00000000,0x00000000,0x52280000,0xffdfbdb6,0xffdfffdf,0x4228ef7d,0x00000000,0x20a30020,0x20413104,0x18612041,0x002020c3,0x19030060,0x18e218c2,0x21032924,0x290428e3,0x28c31000,0xffffde9a,0xde79ffdf,0x08002061,
-0x000020c2,0xe6da8c0f,0xf75cffde,0x18003103,0x838e0800,0xffdfff9e,0xffdfffff,0xffffffff,0xffffffff,0xffdeffdf,0x00008c50,0x00002903,0xffdf8c50,0xffffffff,0xa533e6fb,0xce79a533,0xfffff79e,0x83efffff,0x31440000,0xb5950000,0xffdfffff,0xffffffff,0xffbeffdf,0xffffffbf,0x0000ce38,0x00002903,0xe73c2103,0xffffffff,0x00009cd3,0x210318c2,0x9cd20000,0xffdfffff,
-0x0800a4f3,0x210320c3,0x000020c3,0x00000000,0x00000000,0x08201061,0x10201040,0x08001020,0x20e31061,0x00002124,0xe73c39e7,0xffffffff,0x6b2cef7d,0x21030000,0x20e32104,0x00000820,0x00000000,0x08400000,0x08611061,0x08400020,0x18c20000,0x21041061,0x9cb20000,0xad34ffde,0x10610000,0x18821020,0x94710000,0xffffdefb,0x5aaaf77d,0x18e30000,0xc6170000,0xffffffff,
-0xffffffdf,0xffdeffff,0xffbeffff,0xbd75ffdf,0x18e30000,0x000010a2,0xffffbdf7,0x62caf77d,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000040,0x408138a1,0xffbeb4d2,0xdefbffff,0x000031a6,0x000018a2,0xa49238c3,0xffffef3c,0xffbeffff,0xffffffff,0xbdf7ffdf,0x18c20000,
-0x000018e3,0xffdfbd55,0xc5d7ff9e,0x00001882,0x10a20041,0xad140800,0x0000a4d3,0x082020e3,0x10610000,0x39c63a07,0x39c74a69,0x08400000,0x00000020,0x838e2882,0xb5d69cf3,0xef3cd679,0xffffffff,0xffdeffdf,0xce79ffff,0x31e74a89,0x00000000,0x08000000,0x00001000,0x08810000,0x00000000,0x00000000,0x00000000,0x10001020,0x080020a3,0xef3c62aa,0x5a49eefb,0x28e20800,
-0x7b6d0000,0xfffff75c,0xf75cffde,0x080049c6,0x41a61000,0xff7dbd96,0xffffffdf,0xffffffdf,0xffffffff,0xef3cffff,0x0000630b,0x00002923,0xffff9cb2,0xffffffbe,0xffffffff,0xffffffff,0xffdfffff,0x9491ffff,0x29030000,0x738d0000,0xffdfef5c,0xffdfffff,0xffffffff,0xde9affff,0x0000732c,0x000018a1,0xef7d632c,0xffffffff,0x4228ef5d,0x18820800,0x00000000,0xce38ce38,
-0x00000000,0x000018a2,0x10610000,0x39c63165,0x398541e7,0x10400000,0x00000000,0x10600000,0x00000000,0x00000000,0xffdfd69a,0xffdfffbe,0xdefbffff,0x000062eb,0x00000000,0x00000800,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x08400000,0x18c20000,0x10816b4d,0x08410000,0x00002904,0xffdf9472,0xffffffff,0x20e3d699,0x18c30820,0x738d0000,0xffffef3c,
-0xffdfffff,0xffffffde,0xffffffdf,0x730ce6db,0x08610000,0x000018c2,0xffffce38,0x83ceff9d,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200000,0x50815924,0xffbdbcf2,0xef9dfffe,0x00004a48,0x080010a2,0x10000800,0xc6185a8a,0xfffff7be,0xf75dffff,0x4a48bdf7,0x18820000,
-0x00002104,0xffbfbd76,0xffffff9e,0x0000a514,0x086118e3,0x00000000,0x10610000,0x000020e3,0xde9a9c51,0xe71ce6fb,0xce9aef7d,0x00001081,0x000010e2,0xf6fc38a3,0xffffffff,0xffffffde,0xffffffbe,0xfffff7be,0xffffffff,0xe75cef7d,0xb5b6ce79,0x5229ad14,0x08200800,0x00000840,0x945141a6,0x83ef8410,0x52897bcf,0x10200000,0x20a20800,0x738d0800,0x00006b2c,0x102018a1,
-0xd6582060,0xffdefffe,0xef3cfffe,0x08004a07,0x000020c1,0x8c300000,0xffbfde9a,0xffffffff,0xef3cffdf,0x6b0cc5b7,0x10200000,0x00002924,0xffff9cb2,0xffffffff,0xffffffff,0xfffff7de,0xffdeffff,0x9cf3ffff,0x29440000,0x00000820,0xce185aaa,0xffffffdf,0xff7effdf,0x2062bd76,0x18810800,0x000020e3,0xffde8430,0xfffff7de,0xbdd7ffff,0x18a20000,0x00001882,0x39a63165,
-0x21030000,0x7bce0000,0xd6babdf7,0xe6fbe6fb,0xdedaef3c,0x000083ef,0x002018c2,0x00000840,0x9cd24a69,0xd679b596,0xffffffff,0xffffffff,0xffffffdf,0xbdf7e73c,0x9492b575,0x00002945,0x00200020,0x000010a2,0xce999d13,0xce79ce58,0xbdd7ce79,0x00004a48,0x00001081,0x00000020,0x18e30020,0x62cb0000,0xfffff79d,0xffffffdf,0x0820e6fb,0x29440000,0x000010a1,0xbdd64a28,
-0xfffff79e,0xffffffff,0xad13ef3c,0x10003925,0x08201841,0x000018a2,0xffffce58,0x940fff9e,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000060,0x58826186,0xffbebcf2,0xfffeffbd,0x0000738d,0x00002124,0x20820800,0x00000000,0xce5973ae,0x5a8ab575,0x00000000,0x102028e4,
-0x84100000,0xffdfef3d,0xffffffdf,0x62ecef5d,0x10a20000,0x08610841,0x10610841,0x62ab0000,0xfffff73d,0xffffffff,0xffffffff,0x000094b2,0x184118c2,0xddf82800,0xffdfffff,0xffdeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x5aaaf79e,0x10810000,0x000018a2,0xffdfc5b7,0xffbeffbe,0xf79effbe,0x0000a514,0x000020c3,0x00001081,0x10a10000,0x000020e2,
-0xffffb554,0xfffefffe,0xffdefffe,0x00009491,0x08202964,0x000018a1,0xacd42041,0xef5df75d,0x4a28b576,0x00000000,0x20a20800,0x000020e3,0xffffad34,0xffffffff,0xffffffff,0xffffffff,0xffdeffff,0xce79ffff,0x00000000,0x106120e3,0x00000000,0xde9a7b8e,0x7b8ede9a,0x00000000,0x08001882,0x00002924,0xffff9cf3,0xffdfffff,0xf7beffdf,0x000083ef,0x104118a2,0x00000000,
-0x00001081,0xe73c4a69,0xffffffff,0xffffffff,0xffffffff,0x3965e6db,0x08400000,0x000018c2,0xffffad75,0xffffffff,0xffbfffff,0xffffffff,0xffdfffff,0xffffffff,0xffbeffff,0x00005aaa,0x18e31081,0x73ae0000,0xfffff7de,0xffffffff,0xffffffff,0x0000c618,0x10811882,0x086110a2,0x00001081,0xdedb3145,0xffdfffff,0xffdfffff,0xc5f7ffdf,0x000039c6,0x21030000,0x00000000,
-0xb5965aaa,0x9cb2ce38,0x000039a6,0x18201000,0x18e30000,0x00000000,0xffffe6db,0x93cfff5d,0x18c30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000000,0x50a261a6,0xffbec4f3,0xffffffff,0x39e7deda,0x18a20000,0x080020c3,0x104118a2,0x00000000,0x00000000,0x18a210a2,0x10200000,
-0xf79eb576,0xffffffdf,0xffdfffdf,0xce59ffff,0x08210000,0x00200020,0x08200061,0xd6391000,0xffdfffdf,0xffdfffff,0xffffffff,0x1041deba,0x28e40000,0xb4f41800,0xffdfffbf,0xffffffde,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffde,0x0000bdd6,0x20c220e3,0x94510000,0xffdfffbe,0xffdfffdf,0xffffffff,0x7bcff79e,0x21040000,0x18c20000,0x20e30820,0x8bef0800,
-0xffdeffbe,0xffffffff,0xffffffff,0x73aeef9d,0x21230000,0x20a21061,0x08000800,0x41c75a4a,0x00000000,0x18c32103,0x00002103,0x7bce0000,0xffffef3c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x4a28deba,0x20e30820,0x10611881,0x00000000,0x00000000,0x18821082,0x10412104,0x73ae0000,0xffffef7d,0xffffffff,0xffdeffdf,0x39a6e71c,0x18820000,0x10810840,
-0x00002123,0xffffb596,0xf7defffe,0xffffffff,0xffffffff,0xb554ffdf,0x10810000,0x000020e3,0xf79d738d,0xffffffff,0xffffffdf,0xffffffff,0xffdfffff,0xffffffff,0xc5f7ffff,0x10620000,0x000018e3,0xdefb4208,0xf7dfffff,0xffdfffff,0xffbeffff,0x8c30ffdf,0x18a20000,0x00200000,0x00000000,0xffffc638,0xffffffff,0xffffffdf,0xffffffdf,0xa513ef5d,0x00000020,0x10811041,
-0x00000000,0x00000000,0x18a20000,0x20c31862,0x00001903,0xa5540000,0xffdef7be,0xacb2ff9e,0x18c30000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20610820,0x69a65124,0xffbee618,0xffdfffde,0xdedbffff,0x00008c51,0x08200000,0x10410000,0x002018c2,0x10a218c2,0x000018e3,0xde79730c,
-0xffdfffbf,0xffffffbe,0xffdfffdf,0xffdfffff,0x00009cd3,0x00401903,0x000010e3,0xffbfa492,0xffdfffff,0xffdfffdf,0xffffffdf,0x8410ffdf,0x28c30000,0x8baf0800,0xffbef73c,0xffbeffff,0xffffffff,0xffffffff,0xffffffff,0xffdeffff,0xf79effff,0x000073ad,0x000018c2,0xf73c5208,0xffbeffff,0xffdfffff,0xf7def7df,0xe6fbffff,0x000039a6,0x000018c2,0x00001081,0xe6fb49a6,
-0xffdfffff,0xffffffff,0xf7feffff,0xef7cffff,0x00008c50,0x18610000,0x18821041,0x00000000,0x086118c3,0x00000000,0x4a690000,0xf7bebdd6,0xffffffff,0xffffffff,0xffdfffff,0xffffffff,0xffffffff,0xffbeffff,0xdedaffff,0x000062eb,0x00201061,0x082018c3,0x10a20861,0x000010a2,0x00000000,0xef7dad34,0xffdfffff,0xffffffff,0xffbeffff,0xc617ffff,0x10810000,0x10810820,
-0x630c0000,0xffffef7d,0xffffffff,0xffffffff,0xffdeffff,0xf77dffff,0x00006b2c,0x000018a2,0xd6ba0000,0xffdeffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x8410ffdf,0x20e30000,0x00001061,0xffffc618,0xfffff7de,0xffffffff,0xffdeffdf,0xe6fbffff,0x000039c6,0x18a21081,0x9d130000,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xffffffff,0x8c10de9a,0x08201061,
-0x108218c3,0x18c31061,0x08401081,0x00000000,0x638d0000,0xffffd6ba,0xffffffde,0xa492ff9e,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200000,0x38204924,0xffdfcd55,0xf7dfffdf,0xffffffff,0xb5b6ffff,0x08415aeb,0x000010a2,0x08410000,0x10a20020,0x62eb0000,0xffdff73d,
-0xffdfffdf,0xffdfffdf,0xffffffff,0xffffffff,0x736ef77d,0x10c30000,0x00000861,0xff9e9410,0xffffffdf,0xffffffff,0xf7dfffff,0xc618ffff,0x28e40000,0x28c30000,0xa4b25a29,0xfffff7be,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf79dffff,0x00004207,0x00002103,0xff9e838e,0xffffffdf,0xffffffff,0xffffffff,0xffffffdf,0x0020c638,0x00200000,0x080018e2,0xffdfb4f3,
-0xffffffdf,0xffffffff,0xffffffff,0xffffffde,0xb555ffbe,0x00003124,0x00001061,0x10611882,0x00000841,0x6b4c0861,0xef5db595,0xffffffff,0xfffff7be,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffbe,0x9491f7be,0x00000000,0x00000861,0x08410000,0x21040000,0xd69a7bce,0xffffffdf,0xffffffff,0xffdfffff,0xffffffdf,0xef3cffdf,0x00005aaa,0x000018a2,
-0xd69920e3,0xffffffff,0xffffffff,0xffffffff,0xffbeffff,0xffffffdf,0x0000c5d7,0x104118c3,0xce790000,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0xffdfffff,0x0000ad55,0x18c318a2,0xad340000,0xffffffff,0xffffffff,0xffffffde,0xffdfffff,0xffbeffdf,0x00008c10,0x00002103,0xf7be8c50,0xfffeffff,0xffffffff,0xffdfffff,0xffffffdf,0xffdfffdf,0xffdfffff,0x00009cd3,
-0x000018c3,0x00000820,0x00000020,0x736d3145,0xf7deb5d6,0xffdeffff,0xffdfffdf,0x59e8ff1c,0x08610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18000800,0x30003061,0xff9ecd55,0xf7deffff,0xffdeffdf,0xffffffff,0x31a6d6ba,0x10610000,0x00200000,0x00400000,0x39860000,0xf75dacf3,
-0xffffffff,0xffffffdf,0xffffffff,0xf7dfffff,0xc5f7ffff,0x10e30000,0x20820020,0xcdf81800,0xffdfffff,0xffffffdf,0xffffffff,0xdefbffff,0x00003986,0x10001841,0x20411000,0xffffdedb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x000094b2,0x102020c2,0xde591800,0xffffffff,0xfffff7df,0xffffffff,0xffdfffff,0xbdd6ffff,0x08810000,0x000010a1,0xf73d7b0c,
-0xffdfffdf,0xffffffdf,0xffffffdf,0xffdfffff,0xffffffdf,0x4a28deba,0x08200000,0x08000820,0x00000800,0xce592945,0xffffffff,0xffdfffdf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0xad34f79e,0x08400000,0x00000000,0x10810000,0x73ae0000,0xffffef7d,0xffdfffff,0xffffffff,0xffffffff,0xffdeffdf,0xc5f7ffff,0x08200820,0x000018e3,
-0xffffa4d3,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0xffbeffdf,0x00009451,0x086120c3,0xce590000,0xffdfffff,0xffffffff,0xffffffff,0xffdfffff,0xffdfffff,0x00008410,0x00002104,0xffdea4f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe6fbffff,0x000039a6,0x00002904,0xf79d7bae,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0xbd96ff9e,0x000062ab,
-0x00200841,0x00000800,0x000018c2,0xffdf9cb2,0xffffffff,0xffffffdf,0xffffffdf,0x59c8fefb,0x10821861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18000800,0x51033020,0xffdeddd7,0xf7ffffde,0xffffffff,0xc5f7ffbe,0x000062eb,0x08410020,0x18c20840,0x00000000,0x00001061,0x732d0000,
-0xffbfe6db,0xffffffff,0xffffffff,0xffffffff,0x83efffbf,0x10a20000,0x20c30000,0x83af1000,0xffdfff9e,0xffffffdf,0xffffffff,0xfffff7de,0x1882d69a,0x31040000,0xa4931000,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0x0000ad34,0x20a218a2,0x7b6e0800,0xffdfffbe,0xf7fff7ff,0xffffffff,0xffdfffdf,0xd6baffff,0x00810000,0x18610840,0xcdb71000,
-0xffdfffdf,0xffffffdf,0xffffffdf,0xffffffde,0xeefbffbe,0x28c29c71,0x08200000,0x188118a2,0x08201041,0x49e70820,0xf77dad34,0xffffffdf,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffdf,0xe6dbffdf,0x000083cf,0x08400000,0x08810881,0x08600841,0x29240000,0xdeba8c0f,0xffffffdf,0xffdfffff,0xffdfffff,0xffffffdf,0x7b6eff7e,0x18c30000,0x000010a2,
-0xff9d7bae,0xffdfffdf,0xffffffff,0xffffffff,0xffbfffff,0xde7affdf,0x00001001,0x000010a2,0xdeba0000,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xffffffdf,0x00009cb3,0x00002966,0xffffa4f3,0xffffffde,0xffffffdf,0xffffffff,0xffdfffff,0xb555ffff,0x18a30000,0x20821021,0xbdd60000,0xffdeffff,0xffffffff,0xffdfffdf,0xffffffdf,0xe6dbffdf,0x08009411,0x10410000,
-0x18c20860,0x18a218c2,0x00000860,0xbd965269,0xfffff75d,0xffffffdf,0xfffffffe,0x6a08fefb,0x10a21821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18000000,0x50e33000,0xffdeddd6,0xfffffffe,0xe6fbffff,0x08007bce,0x00000000,0x18c21081,0x00000000,0x10822124,0x08200000,0x000020c4,
-0xcdb72042,0xffffff9e,0xffffffdf,0xffffffff,0x0000ce59,0x08401081,0x08000000,0x080028e3,0xffffce18,0xffffffbf,0xffbeffbe,0xffffffff,0x0820c638,0x08001861,0xe6bb2883,0xffdfffff,0xffffffff,0xffdfffff,0xf7ffffff,0xffffffff,0xffdfffdf,0x0000de9a,0x08410820,0x08001041,0xffdfd659,0xf7ffffff,0xffdfffff,0xffdfffff,0x6b4df77e,0x10e30000,0x20c30000,0x730c0800,
-0xffdff77d,0xffffffff,0xffffffff,0xef1cffff,0x2020acf3,0x00000800,0x20e21881,0x00000000,0x20e30020,0x00000000,0x62cb0800,0xf79ec5f7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xff9effbf,0x3104c596,0x20c20000,0x190318e2,0x00000000,0x18c20000,0x000018c2,0x08000800,0xef3ca4d3,0xffffffdf,0xffdfffff,0xffffffdf,0x0000ce18,0x08411082,0x18c20020,
-0xbd960000,0xf7beffff,0xffffffff,0xffdfffff,0xffdfffdf,0x9410ff7e,0x18c30000,0x000018e3,0xffffa534,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0x0800ce18,0x00001082,0xe6ba0000,0xffdeffff,0xffdfffff,0xfffff7de,0xffffffdf,0x49e8e6fc,0x10a20000,0x10610821,0x52690000,0xffffe73c,0xffdeffff,0xffdfffff,0xf77dffbf,0x2083b535,0x20a20000,0x210318a2,
-0x00000000,0x00000000,0x210318a1,0x00000000,0xc618528a,0xffffffbe,0xfffff7de,0x7249ff1c,0x10611000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20200800,0x51032800,0xffdee638,0xffffffff,0x2944deda,0x18810000,0x290318a2,0x00000000,0x39e74228,0x00000000,0x108218c3,0x20c30000,
-0x10000800,0xff9ebd35,0xffffffff,0xf79effff,0x0000738e,0x080018a2,0x00001882,0x000018a2,0xf79e6b4d,0xffdfffff,0xffbfffdf,0xf7beffdf,0x0000630c,0x00002124,0xff9ea4d3,0xffdfffdf,0xffffffff,0xffffffdf,0xffffffff,0xfffff7de,0xffffffff,0x9471ffdf,0x18c20000,0x000018e3,0xff7e7b2d,0xffdfffbf,0xffdfffdf,0xffffffbe,0x0800ad14,0x084020c3,0x000010a2,0x080028e3,
-0xffdfbd55,0xffffffdf,0xffffffff,0x734df79d,0x08000000,0x20c220c2,0x00000000,0x738e5aca,0x00000000,0x20a220c3,0x000020c3,0x9c920000,0xffdfffbe,0xffffffff,0xffffffff,0xffffffff,0xffffffde,0x7b8ef77e,0x00000000,0x21032103,0x00000000,0x7b8d62ea,0x00001880,0x18c30000,0x18201881,0x7bae0800,0xffdfffff,0xffdfffdf,0xf79effdf,0x08007b8e,0x084120e3,0x10a218e3,
-0x49e70000,0xffffe71c,0xfffff7ff,0xffdfffdf,0xffdfffdf,0x1000c5b7,0x18a21882,0x630c0000,0xffffef9d,0xffffffff,0xffffffff,0xffffffff,0xfffff7ff,0xffdfffff,0x8430ffbe,0x21450000,0x632c0000,0xfffff7be,0xffdfffdf,0xffdfffff,0xffbeffff,0x00009c92,0x00202104,0x10c210a2,0x00002103,0xffdea513,0xffffffff,0xffdfffff,0xb555ffff,0x08210000,0x210318c3,0x00000000,
-0xb5b652aa,0x83cece38,0x00000000,0x18e22103,0x00000000,0xfffead75,0xfffef7de,0x726aff1c,0x10620800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200000,0x49031800,0xffbeee9a,0xffffffbe,0x00009cd2,0x10812965,0x00000000,0xb59539c6,0xe71bef5c,0x4a69a514,0x00000020,0x00000841,
-0x080020c2,0xff5d6208,0xffffffff,0xce58ffdf,0x00000000,0x00001861,0x10610000,0x18e30000,0x9cf30020,0xde7adeba,0xeefce69a,0xb596e71c,0x10a20000,0x00000020,0xffdfd659,0xffdfffff,0xffffffff,0xffffffdf,0xffffffff,0xffffffff,0xf79effff,0xd69affdf,0x000018c3,0x18610020,0xc5561800,0xffffffff,0xffdfffdf,0xce38ffff,0x00001000,0x000020a2,0x10a20000,0x08001041,
-0xf71c51c7,0xffdfffdf,0xffffffff,0x4a28ef3c,0x29030000,0x00000800,0xb5755269,0xffbeef5c,0x738dce99,0x00000000,0x29041882,0x62eb0000,0xfffff79e,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0x0000ad55,0x18a220e4,0x00000000,0xad754a48,0xf79def5c,0x9cb2deba,0x000020c2,0x20c20800,0x41c70000,0xffffef5d,0xffbeffdf,0xce59ffff,0x10200000,0x00001041,0x08400000,
-0x00002903,0xffffa4f3,0xffffffff,0xffffffff,0xe6dbffff,0x08003966,0x00001862,0xdefb18e3,0xffffffff,0xffffffbe,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0xe71cffff,0x000039c7,0x00002103,0xffffb5f7,0xffdfffff,0xffffffff,0xd639ffdf,0x10201000,0x00400040,0x00000020,0x00201081,0xd6990840,0xffdeffff,0xffffffff,0x9c92ffff,0x18c30000,0x00000020,0xad542123,
-0xffffef7d,0xf77dffff,0x6b2cc5d7,0x00000000,0x00401903,0xe73c10c2,0xffffffff,0x728aff3d,0x18a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000000,0x51852000,0xffdff6db,0xffdfffdf,0x082073ae,0x000010a2,0x9c922904,0xffffef3c,0xffffffff,0xef5cffff,0x3a079cf3,0x10810000,
-0x080010a1,0xff3d6a29,0xffffffff,0x630cef7d,0x10a20020,0x20a30000,0x00003965,0x000010a2,0x00000060,0x18201021,0x30832842,0x000028c3,0x08600000,0x00200000,0x9c9262eb,0xce18bd96,0xf73de6bb,0xffbfffdf,0xffffffdf,0xad14f77d,0x838e8bef,0x6b2c83ce,0x000018e2,0x18611040,0x52081000,0xb555acf3,0xacb3b4d3,0x41e7a4b3,0x20c30000,0x42080000,0x000073ce,0x20a20800,
-0x9c920800,0xffdfffbf,0xffdeffdf,0x4207e71b,0x00000000,0xb5343124,0xffffef5c,0xffffffff,0xf7deffff,0x4207bdf7,0x18820000,0x41e70000,0xffffe71c,0xffdfffdf,0xffdfffff,0xffbfffff,0xffffffdf,0x00007c0f,0x000020e2,0xa4f33164,0xffffef3c,0xffffffff,0xffffffff,0xacf3ef1b,0x10003124,0x39a60000,0xffdfef5d,0xffffffdf,0x734df79e,0x20c30000,0x42080000,0x00008c51,
-0x00000820,0x9cb220c2,0xc638c618,0xe6fbd679,0x630cd69a,0x28e30800,0x00001020,0xde9a5acb,0xf75def3c,0xff9eff7d,0xffbfffdf,0xffbfffff,0xff9fffdf,0xffbfff9e,0xf75dff7e,0x00007b8e,0x000018e3,0xd67a39e7,0xff5ef75d,0xff5df71d,0x62abe6bb,0x20820800,0x000010a1,0x8c50ad75,0x29240000,0x734d0000,0xffdeffbe,0xffffffff,0x838eff7d,0x10a20000,0x94b20020,0xffffe71b,
-0xf7beffff,0xffffffde,0xff7dffff,0x2020b534,0x00001020,0xe71c2904,0xffffffff,0x6a4aff3d,0x10610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10410000,0x28601000,0xff9ecdb6,0xffbeffdf,0x000062cb,0x000018e3,0xffff9cb2,0xffffffdf,0xffffffff,0xffffffdf,0xd6daffff,0x000031a6,
-0x000018e2,0xff1c4925,0xffffffdf,0x0000a514,0x10a210c3,0xbd760800,0x0000d679,0x00600000,0x10810040,0x18211841,0x10001800,0x08200000,0x00000820,0x00000040,0x00000000,0x08000800,0x49a71800,0xffffe6bb,0xffffffdf,0x0000bd96,0x10000800,0x00000000,0x00200000,0x00000820,0x00001821,0x00000000,0x18001000,0x00000000,0x20c31041,0xce590000,0x8c50ffff,0x20c30000,
-0x08000800,0xcdd7838e,0xfffff77d,0x31c6e73c,0x08200000,0xffbe9430,0xffffffff,0xffffffff,0xffffffff,0xe75cffff,0x000062eb,0x106118a2,0xffffd6ba,0xffffffff,0xc5f7f77d,0xffffdeba,0xffdfffff,0x00007c0f,0x00002944,0xffffad13,0xffffffff,0xf7ffffff,0xffffffff,0xffbeffde,0x00008c10,0x29241061,0xffffe71b,0xffffffff,0x0000ad14,0x188220e3,0xc6180000,0x8c51ffff,
-0x29030000,0x00000000,0x00000000,0x00000800,0x00000000,0x00000820,0x10610800,0x00000000,0x49a62041,0x7b2d6acb,0xffdfe6bb,0xffffffdf,0x8bcfef1c,0x8b8e8bd0,0x394572ec,0x08200000,0x08810000,0x18620000,0x49a75a6a,0x51a749a7,0x00001000,0x20c21840,0x842f0000,0xf77dffff,0x00006b2c,0x08002924,0xffdfacf3,0xffdfffff,0x628af73d,0x00000000,0xef7d5289,0xffffffff,
-0xffffffff,0xffffffff,0xffdfffdf,0x628affbe,0x18410800,0xe6fb0800,0xffffffff,0x3904e69a,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08000800,0x838e28a2,0xe6dbce18,0x00004a48,0x000018e3,0xffbec5b7,0xffbeffff,0xffdfffff,0xf79effdf,0xf7ffffff,0x000073ce,
-0x00001903,0xff1c38a3,0xad75f77d,0x00002103,0x00001904,0xff5d7b6d,0xa534ffdf,0x21440000,0x10810881,0x28a31862,0x18611820,0x00001040,0x18610800,0x10611040,0x290418c2,0x20c320c3,0x10012062,0xef1c5249,0xe6bbffff,0x10203945,0x20e32903,0x18e22103,0x108118e2,0x08201061,0x08200000,0x18a220e3,0x28e328e4,0x18c318e3,0x00002103,0xffde9cb2,0xce59ffff,0x08610000,
-0x18611041,0x08000000,0xd679732c,0x3165d679,0x00001061,0xffff9451,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0x0000ad34,0x00002103,0xffdfde9a,0xc5f7ef3c,0x0000736d,0xad343145,0xffffef3c,0x0000738e,0x00002944,0xffffd679,0xffffffde,0xffffffff,0xfffeffff,0xffffffff,0x0000a4d3,0x000020e3,0xffffce38,0xb595e71c,0x00000800,0x000020e3,0xffdfa4d3,0xef5dffff,
-0x00004a68,0x290320e3,0x20e320c2,0x08201881,0x18a20820,0x10400000,0x10a118c2,0x18a220e3,0x00001040,0x08000000,0xf75d6b0c,0xffdfffff,0x00008c51,0x00000000,0x00000800,0x08601881,0x002008a1,0x00001081,0x08000000,0x00000000,0x10811061,0x000018e2,0xef5c31c6,0xffdfffdf,0x0000ad14,0x082018a2,0x9c711000,0xffdfde9a,0x2062e6ba,0x00001041,0xf7be7bae,0xffffffff,
-0xffffffff,0xffffffff,0xffffffdf,0x62cbff9e,0x18410000,0xeebb1000,0xc596ff5d,0x0800628a,0x08200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200000,0x08001000,0x4a090000,0x000020e4,0x000010e3,0xffdfbd76,0xffffffbe,0xffffffff,0xffffffdf,0xf7ffffff,0x00009471,
-0x002010e2,0x8baf1000,0x00006b0c,0x00610000,0x00000040,0xde594186,0xf79dffff,0x000073ae,0x00000000,0x00000000,0x08000000,0x00000000,0x00001020,0x00000000,0x00000000,0x08200000,0x21041061,0xacf40000,0x8bf0ff9e,0x20c20000,0x00000000,0x00000000,0x00000000,0x08810000,0x00400020,0x00200000,0x00000000,0x00000000,0x732d0000,0xffdff75d,0x9471ff9e,0x10c20000,
-0x08400020,0x188220c3,0x08000000,0x186149e7,0x00002903,0xffff9c71,0xffdeffff,0xffffffff,0xffffffff,0xffdfffff,0x0000b575,0x00002124,0xce18b575,0x000062aa,0x20c30000,0x08000000,0xb5755a69,0x0000528a,0x000018c3,0xffffce18,0xffffffff,0xffffffff,0xffffffff,0xffffffde,0x0000ad55,0x00002924,0xb5758c51,0x00005aca,0x18621020,0x00001081,0xffdfce18,0xffdfffdf,
-0x0000c638,0x00000000,0x00000000,0x10400000,0x00000840,0x00001081,0x00000000,0x00000000,0x00000000,0x29031881,0xbd960000,0xce79ffff,0x10810861,0x29032904,0x00000000,0x00000000,0x08400000,0x10200840,0x102020a2,0x00000800,0x00000000,0x00000000,0xffffb595,0xef3cffff,0x00005249,0x08401081,0x00001861,0x83cf2041,0x000083cf,0x000020e3,0xffff9450,0xfffffffe,
-0xffffffff,0xffffffff,0xffffffde,0x62ebffbe,0x10200000,0x93f01800,0x08006aab,0x18410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08200000,0x20a21000,0x00001042,0x00000000,0x000010c3,0xffdfb555,0xffdfffdf,0xffdfffdf,0xffffffbf,0xf7fef7de,0x000094b2,
-0x004018e2,0x08000800,0x20e30000,0x00201061,0x20e40000,0x6acb0000,0xfffff77d,0x8410ef1c,0x630c6b4c,0x5acb62cb,0x00004207,0x10610020,0x39450800,0x62eb5a69,0x5aeb52aa,0x000052aa,0x10820000,0x31450000,0x00007b8e,0x00001061,0x630b2903,0x9471736d,0x84308c10,0x00007c0f,0x00200060,0x00000061,0x5aeb41e7,0x5b2c6b6d,0xef1c6b2c,0xffdfffbe,0x0800cdf7,0x08401081,
-0x00000861,0x186218a2,0x082020a2,0x08200000,0x00002903,0xffffa4b3,0xffffffdf,0xffffffff,0xffffffff,0xffffffdf,0x0000d679,0x08201041,0x08000000,0x18820000,0x28e32904,0x20e31881,0x00000000,0x08410000,0x000018e4,0xffffce38,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0x0000b575,0x084118c2,0x00000000,0x18c20000,0x10002904,0x000018a2,0xf77d736d,0xffdfffdf,
-0xad75ffff,0x734d6b4c,0x62aa6b2c,0x00003124,0x10810820,0x52aa0000,0x9cf294b2,0x8c519491,0x6b4c840f,0x18200800,0x41c70800,0x62ebbd96,0x18820000,0x00001061,0x41a53144,0x42064a26,0x080041c6,0x10200000,0x08000800,0x42072903,0x42484a48,0x73ae2985,0xffdfef5d,0xb535ffdf,0x19030000,0x10a10060,0x292410a1,0x00001020,0x08200000,0x000020c3,0xffff83ef,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x4a28f77d,0x10610000,0x08001000,0x20c30800,0x08001021,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08200000,0x18401861,0x18a30000,0x00000000,0x000018c3,0xffdfad14,0xffffffbf,0xffffffdf,0xffdfffbe,0xffffffff,0x0000a534,
-0x000018e2,0x18810800,0x18a220c3,0x00000000,0x00000020,0x080028e3,0xffbebd75,0xffbeffff,0xef5dffbe,0xef7df79e,0x000073ae,0x000018c2,0xdeba5248,0xf77df77d,0xef9eef7d,0xad75ef7d,0x10620000,0x00000820,0x18a20000,0x00001881,0xf79ea513,0xffbeffbe,0xffffffbe,0x94b2f7be,0x10c20000,0x00000881,0xf75d83cf,0xef9dffdf,0xffbef7be,0xf73cffff,0x00005a49,0x004018a2,
-0x19030000,0x00000000,0x108118a2,0x000018c2,0x000018a2,0xffdfa4d3,0xffbeffff,0xffffffff,0xffdfffdf,0xffffffff,0x0000d69a,0x18610820,0x08411041,0x20e320e3,0x00000000,0x18c20000,0x20c31061,0x00000820,0x000018c3,0xffffce18,0xffffffbf,0xffffffff,0xffffffff,0xffffffbe,0x0000b555,0x002018e3,0x10811041,0x00002103,0x00000000,0x10a21081,0xad140000,0xffdfffff,
-0xffffffdf,0xf77df79d,0xf75dff9e,0x00006b0c,0x000020c2,0xdf1b31a5,0xffdeffff,0xffdfffdf,0xf77dffbe,0x08009c92,0x00002082,0x00000000,0x18a218a2,0x9cd20000,0xf77ce71b,0xef5ce73b,0xc5d6ef5c,0x080028e3,0x000028c2,0xef3c9cb2,0xe75cef5c,0xef9de73c,0xffffffdf,0x3966e6db,0x00600000,0x00000000,0x00000000,0x29240800,0x00001081,0x00002924,0xffff7bef,0xfffffffe,
-0xffffffff,0xffffffff,0xfffff7de,0x3144ef3c,0x08410000,0x18a30800,0x10a210a2,0x000020c3,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000041,0x00000840,0x18610000,0x00202103,0x00000000,0x00000020,0xc5b65a6a,0xffdfff9e,0xffbeffdf,0xffdfffbf,0xdf1bffde,0x0000632c,
-0x000018c2,0x20e30820,0x00000020,0x000018a2,0x00001061,0x00000861,0xeedb3925,0xffdfffdf,0xffffffdf,0xce79ffff,0x00000000,0x00002903,0xffffc5d7,0xffffffff,0xffffffff,0xf7beffff,0x00008430,0x002018e3,0x18411861,0x732c0800,0xffffff9e,0xffffffff,0xffdfffff,0xef3cffff,0x00004a49,0x080018c2,0xeefb2883,0xffffffff,0xffbeffff,0xa4f3ffdf,0x20e30000,0x00001881,
-0xdefb9cd2,0x29449cf3,0x08200000,0x000018e2,0x000008c1,0xc5d741c7,0xffdfff9e,0xffdfffff,0xffdfffdf,0xef1cffbf,0x00009471,0x00000840,0x20c30820,0x00000000,0x8c71736d,0x00002964,0x18c31061,0x00200000,0x000010a1,0xffdfb555,0xffbfffdf,0xf7bfffff,0xffffffff,0xd638ffdf,0x000062cb,0x08610840,0x20e31061,0x18e30000,0x5269840f,0x18c20000,0x20c20000,0xffffe71b,
-0xffdeffdf,0xffffffff,0xd659ffdf,0x08200000,0x000018a1,0xffffad75,0xffdfffff,0xffffffdf,0xffffffff,0x41e7e6fb,0x20c20000,0x08401081,0x00001081,0xffbd738d,0xfffeffff,0xffffffff,0xffffffff,0x00009cd2,0x00002103,0xf7be6b4c,0xfffeffff,0xffffffff,0xffbfffdf,0x00008c51,0x00201903,0xbdd70000,0x8c50d6ba,0x00003144,0x10810000,0x000018a2,0xf7be738d,0xffdeffde,
-0xffdfffff,0xffdfffdf,0xffbfffdf,0x0000b555,0x00400020,0x10620000,0x002008a2,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39640000,0x00006289,0x00000000,0x00000820,0x10620000,0x08000000,0xce185a8a,0xffffffbe,0xe6fbffdf,0x000094b2,0x10810000,
-0x08200000,0x00000000,0xa5342104,0x734ddedb,0x20c30000,0x18a20000,0x8baf0800,0xffffff7d,0xffdfffff,0x7bcfffde,0x31650000,0x8bef0000,0xffdeffdf,0xffffffdf,0xffffffff,0xfffff7de,0x0000defb,0x10810000,0x20820800,0xcdf72020,0xffdeffff,0xffffffff,0xffdfffff,0xffffffff,0x0000bdb6,0x104118c2,0xa4521800,0xffffffdf,0xffffffff,0x3945ef1b,0x20c20000,0x4a070000,
-0xffffef3c,0xdefbffff,0x00009cd2,0x00600000,0x08800000,0x00000000,0xde7a83ae,0xffdfffff,0xe6fbffdf,0x3124a4d3,0x10610000,0x00000020,0x00000820,0xbdb641c6,0xfffff7be,0x8c51e71b,0x00000000,0x000010a2,0x00000020,0xa4b31020,0xffdfef3d,0xffffffdf,0xe6fcffdf,0x10009c72,0x10810000,0x08400000,0x00000000,0xd6ba7bef,0xbdd7ffff,0x18a20000,0x00002924,0xffde9491,
-0xffdeffdf,0xffffffdf,0x5aaaf75d,0x20e20000,0x5aca0800,0xfffff7be,0xffffffff,0xffffffff,0xffffffde,0xb595ffff,0x18810800,0x10810840,0x21030000,0xffffdeba,0xfffefffe,0xfffefffe,0xfffff7de,0x39a6e6fb,0x21230000,0xbdd60000,0xffffffff,0xfffff7de,0xce59ffff,0x08410000,0x00001903,0xffffa4f3,0xffffffde,0x9cd2e71b,0x000039a6,0x18611020,0x7bae0000,0xffffef1b,
-0xffdfffff,0xffbfffdf,0x8bcfeedb,0x18620800,0x00000020,0x00201082,0x73ce0000,0x3103acf3,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10810020,0x38e21000,0xde79de38,0x18e39471,0x08610000,0x00000000,0x20a31861,0x10410000,0xbdb6736d,0x3986a514,0x00000000,0x000018a2,
-0x00000020,0xa4b228c3,0xffffdefb,0xd69affff,0x00000000,0x08400861,0x18002082,0xffdfc5b7,0xffffffbe,0x0000ce79,0x10001081,0xde592021,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xb5b6ffff,0x10a20000,0x00001882,0xf79e7b8e,0xffffffde,0xffffffff,0xffdfffff,0xffffffff,0x734dff9e,0x29030000,0x28821800,0xffffe71b,0xffbeffde,0x0800a4b2,0x108118a2,0xbdd60000,
-0xffdeffdf,0xffffffde,0xd6baf7de,0x0000738d,0x00000861,0x18e30840,0x18620000,0xeefcb535,0x3966bd76,0x00000000,0x000020c3,0x08400020,0x94910000,0xffffe71b,0xffdeffdf,0xffdeffff,0x6b6cd6b9,0x10610000,0x08410841,0x00000000,0xbd964208,0xff5df75d,0x51e8c5b7,0x08410800,0x000010a2,0x00000840,0xc5f752aa,0xffffffbe,0xf7beffff,0x00008430,0x080018a2,0xdeba1040,
-0xffdeffff,0xffdeffdf,0x0800a4f3,0x212318e2,0xad540000,0xffffffff,0xffffffdf,0xffffffff,0xffffffff,0xf77dffdf,0x0000732c,0x18a118a1,0x9d330020,0xfffeffff,0xfffffffe,0xffffffff,0xffffffff,0xad14ffdf,0x18c20000,0x52280800,0xffffef1c,0xffdeffff,0x83cfff9e,0x21250000,0x42070000,0xffdfef1c,0xffdfffde,0xffbeffff,0x0000ad14,0x104120c3,0x00000820,0xacf328c3,
-0xffbef73c,0xb514f73d,0x080030e4,0x08001821,0x10a20000,0x5b2c0000,0xffbebe37,0x4904ff3c,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x38c22860,0xffdede17,0xbdf7ffff,0x00000000,0x08200861,0x08000000,0x082020c3,0x00000000,0x00000000,0x106118a2,0x00000820,
-0x00002103,0xff9e8bae,0xf7deffff,0xffffffbe,0x0000ad55,0x082010a2,0x08001041,0xeefb2082,0xf79effff,0x0000738e,0x08002924,0xf71c51c8,0xffffffff,0xffffffff,0xf7ffffff,0xffffffff,0xdefbffff,0x00200000,0x000020c3,0xf79e734d,0xffffffff,0xffffffff,0xffffffff,0xf7ffffff,0xbd96ffff,0x20c20000,0x10001020,0xffffd6da,0xdebaffdf,0x08001020,0x000020c2,0xf7be738d,
-0xffdfffff,0xffdfffff,0xffffffff,0x3144defb,0x10610000,0x18e30861,0x000018c3,0x41460800,0x00000800,0x18a220e3,0x000018a2,0x000018c2,0xf7be7bef,0xffbeffff,0xffffffde,0xfffeffff,0xef7dfffe,0x00006b4c,0x00001062,0x18c30862,0x00000000,0x7b2d628a,0x00000800,0x21041882,0x00400020,0x000018c2,0xffffc638,0xffdeffdf,0xffffffde,0x39c6ef3c,0x21030800,0x7b8e0000,
-0xffdff79d,0xf79dffff,0x0000734d,0x000010c1,0xe6fb4a28,0xf7beffff,0xffdfffdf,0xffffffff,0xfffff7be,0xffbfffdf,0x10008bcf,0x000020c2,0xe73b10a1,0xffffffff,0xffffffde,0xffdfffff,0xffdfffdf,0xe6baffff,0x00002944,0x080028e3,0xffdfde79,0xffffffdf,0x0000c5f7,0x20e41082,0xb5b60000,0xffbeffff,0xffffffde,0xffffffbe,0x0000bdd7,0x000018a2,0x29041882,0x08001821,
-0x9c7149c7,0x080062aa,0x20a30000,0x00001862,0x00000841,0xdefb0000,0xfffeffff,0x4061ee59,0x08411000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x40a22840,0xffbed5d6,0xdefbffde,0x000031a6,0x00001081,0x18c30020,0x08401061,0x18c21081,0x18c318a2,0x082118c3,0x08200000,
-0x000018c2,0xffdfa472,0xffdeffbe,0xffffffff,0x632cf7be,0x20c30000,0x10610000,0x8bcf1000,0xf79effbf,0x0000630c,0x184120c3,0xbd351000,0xffdfffff,0xffffffff,0xffffffdf,0xffffffff,0xb575ffff,0x10610000,0x30e41000,0xa4d30800,0xf7beffff,0xffffffff,0xffffffff,0xffffffdf,0x6b2cef7d,0x29240000,0xa4f30000,0xfffeffff,0x840fffff,0x29440000,0x00000820,0xffffd69a,
-0xffdfffde,0xffdfffff,0xffffffff,0x4a08e71c,0x10610000,0x00000000,0x210418c3,0x08001882,0x28e41842,0x000020e3,0x08610000,0x000010a2,0xffbea513,0xffffffff,0xffffffdf,0xfffff7de,0xffffffff,0x00009491,0x000020e3,0x00000000,0x292418c3,0x08000000,0x20c320a2,0x000018c2,0x00400000,0x00200020,0xffffce59,0xffdfffde,0xffffffff,0xbdb6ffff,0x18e20000,0x000020e3,
-0xffdfb575,0xffffffbe,0x0000c5f7,0x00002103,0xf79d6b2c,0xffffffff,0xffffffff,0xffffffff,0xf79effff,0xde7affff,0x18201000,0x10811020,0xbdf70000,0xffdfffff,0xffffffdf,0xffffffdf,0xffbfffff,0xc5d7ffff,0x10a20000,0x000020c2,0xffffd638,0xef3cffde,0x08005a8a,0x000020e3,0xf79d5aca,0xffdeffff,0xffdeffff,0xffffffdf,0x0000c618,0x088210e3,0x00000000,0x29240000,
-0x00000000,0x20c20800,0x18a22103,0x00000800,0x00001041,0xef5c5aeb,0xfffeffff,0x4882feda,0x08411000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18610000,0x40a22000,0xffbeddb6,0xdefbffff,0x00002944,0x08410020,0x00000000,0x18e30000,0x10a210a2,0x000018c2,0x00000000,0x00000000,
-0x080018c2,0xff9e9c31,0xffdfffff,0xffdeffff,0xce59ffff,0x08000800,0x08610020,0x08001861,0xffffcdf8,0x0000b555,0x208220c3,0x5a291000,0xffdfef1c,0xffffffbe,0xffffffff,0xffffffff,0x62ebf77d,0x18a20000,0x18001020,0x20821000,0xffdfde9a,0xffdfffdf,0xffdfffdf,0xffffffdf,0x0000bdd6,0x00002123,0xef3c41e7,0xffffffff,0x0000d6ba,0x21230000,0x94710000,0xffffffdf,
-0xffffffdf,0xffffffff,0xffffffff,0x41c7ef1c,0x00000000,0x7bcf5aaa,0x00000000,0x20c320c3,0x000020a2,0x62eb0000,0x0000738d,0x000018e3,0xffdf9cf3,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x00009cb2,0x000020a1,0x29443144,0x00000000,0x20e42104,0x00001882,0x5b0b0000,0x00002985,0x00000841,0xffffce58,0xffdfffdf,0xffffffff,0xffbeffff,0x0000738d,0x000020e3,
-0xe6fb28c3,0xffbeffff,0x630bf77d,0x18c20000,0xce580000,0xffdeffff,0xffffffde,0xffffffff,0xffffffbf,0x8bf0ff9e,0x20820800,0x18c20800,0x630c0000,0xffdff77d,0xffffffbe,0xffffffff,0xffffffbf,0x62aaef3c,0x18e30000,0x7bce0000,0xffbeffbe,0xb596ffff,0x20c20000,0x000018a2,0xffffc617,0xffffffde,0xffbeffde,0xffffffff,0x0000bdf7,0x00002144,0xa4f36b4d,0x00003986,
-0x210318e2,0x08402103,0x00000000,0x00000000,0x000018c3,0xffbe738e,0xfffefffe,0x4041f679,0x00411000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x30611820,0xff9eddb7,0xd6baffff,0x000010a1,0x000010c2,0xb5556aeb,0x00005289,0x00000000,0x5aca0000,0xbdf7bdd6,0x00000000,
-0x000018e3,0xffbf93f0,0xffdfffdf,0xffdfffff,0xffffffff,0x0000acf3,0x002018c3,0x000018a2,0xff3d6acc,0x6acbff5d,0x10610000,0x080020a3,0xffdfacf4,0xffffffbe,0xffffffff,0xffffffff,0x0000c5f7,0x086110a2,0x08400841,0x08001862,0xffbf7b6e,0xffdfffdf,0xffdfffdf,0xf75dffdf,0x00005a69,0x000020c3,0xffffc618,0xffdfffdf,0x00008410,0x000020e3,0xe6fb41c7,0xffdfffff,
-0xffffffff,0xffdfffff,0xffffffff,0x41e7e6fb,0x00000000,0xffde9471,0x6b4dc638,0x00000000,0x6b4c0000,0xf79dc618,0x0000bdf7,0x00002944,0xffffa513,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0800a4f3,0x000028e3,0xe6fb9491,0x10619cb2,0x00000000,0x42270000,0xe73cbe17,0x00006b6d,0x000018c3,0xffffc5f7,0xffdfffff,0xffffffdf,0xffffffdf,0x0000ce59,0x20e30841,
-0x8c510000,0xffdfffbe,0xce18ffdf,0x20c30000,0x6b0c0000,0xfffff77d,0xffffffbf,0xffdfffdf,0xffffffdf,0x1821de9a,0x08201841,0x108110a1,0x00001061,0xffdfc5d7,0xffffffdf,0xffffffff,0xffdfffdf,0x0800b555,0x000028e4,0xdeba0000,0xffdfffff,0x734dff9e,0x28e40000,0x84300000,0xffdfffdf,0xffffffff,0xffdfffdf,0xffffffff,0x0000c5b7,0x00002945,0xffff9491,0x9471e6db,
-0x00000000,0x00000000,0xbdd7736d,0x0000a4f3,0x00002104,0xffde8c30,0xffdeffff,0x3841e618,0x00001821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28612081,0xffbfc535,0xd6baffde,0x00000860,0x00001903,0xffdf83ae,0xad95ef7d,0x738e632c,0xf77dc5f7,0xdefbffff,0x00200861,
-0x000010a2,0xa4924186,0xa4b2b514,0xad13a4b2,0xb575a4f3,0x00009451,0x08610020,0x18a20000,0x836e0800,0x732dbd75,0x10a20000,0x00001041,0xe69a4186,0xff9effbe,0xffdfffdf,0xef1cff9e,0x00006b0c,0x000020a2,0x08610000,0x18820841,0xacf40800,0xcdd7d659,0xd618cdd7,0x8c10d618,0x21030000,0x52690000,0xffbedeba,0xd659ffbf,0x00000820,0x000020c3,0xff9e9cb2,0xff9effbe,
-0xff9effbe,0xffdeffdf,0xffffffbf,0x41c6e6da,0x00000820,0xffde9491,0xffbeffff,0x6b2cb596,0xf7dec617,0xffffffff,0x0000c617,0x00002904,0xffdfad34,0xffdeffff,0xffffffdf,0xffffffdf,0xffdfffff,0x0000ad14,0x00002924,0xffffa4f3,0xdedaffff,0x18e27bce,0xef7c94b2,0xffdeffff,0x00008c30,0x00002104,0xf77da4f3,0xff9ef77d,0xff9effbe,0xffbfffbe,0x8451ffdf,0x18c30000,
-0x08000820,0xffbfbdd7,0xf79effdf,0x000083cf,0x08002904,0xffbeb555,0xffffffdf,0xffdfffff,0xffbeffff,0x00008c10,0x18a220a2,0x00000000,0x000020c3,0xef1c5269,0xffdfffdf,0xffffffff,0xef1cffff,0x000049e7,0x00002905,0xffdf9471,0xffdfffdf,0x0000b596,0x184120c3,0xce590000,0xffbeffbe,0xffbeffde,0xffbeffbe,0xf79effbe,0x00009c72,0x00002924,0xffff9cd2,0xfffeffde,
-0x6b6cce38,0xd6999d13,0xffffffde,0x0000ce18,0x00002123,0xffde8c50,0xfffffffe,0x2800cd96,0x00201861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20411861,0xffbfbd15,0xce79ffff,0x00200000,0x00002124,0xffdf9c30,0xf7ffffff,0xffffef7d,0xffffffff,0xce38ffff,0x08810000,
-0x08400000,0x10000000,0x00000800,0x00000000,0x00000000,0x10000000,0x00200000,0x00000000,0x00001041,0x00000000,0x00000861,0x10820000,0x5a090800,0x7b2d834d,0x730c6acb,0x49a772ec,0x18810000,0x7b4d0800,0x0000bdb6,0x00200000,0x00000040,0x00001081,0x08610000,0x00000840,0x00000881,0x18410000,0x62cb3986,0x41c76b2c,0x08400000,0x00000840,0x522839a6,0x6aec5a8a,
-0x6b2c6b2c,0x7b8d736d,0x8c517bcf,0x10207b8d,0x000020e4,0xffff840f,0xffdfffff,0xffbeffff,0xffffffff,0xfffff7de,0x0000c618,0x000020c3,0xce594a28,0xffffffdf,0xffdfffdf,0xffbeffff,0xff9effdf,0x00007b8e,0x00002124,0xffffad75,0xffdeffff,0xef5cffde,0xffffffbe,0xff9effff,0x00007b6e,0x00001041,0x4a0720a2,0x52285248,0x628a5a49,0x8c107b4d,0x39c6738e,0x10400000,
-0x00001081,0x6b2c18a2,0x84107bcf,0x00004a08,0x000018a2,0xb5962944,0xbdf7b595,0xbdb6c5f7,0x9c51bd76,0x000020a3,0x00001861,0x52897bce,0x08a10000,0x62eb0000,0xbd55acf4,0xc5f7c5b7,0x7b6dbd96,0x18a10000,0x000010a3,0xa4f3736d,0x9cb3ad14,0x000020e3,0x00000820,0x5aaa1082,0x732c7b6d,0x6aeb6b0c,0x734d6b0c,0x62ec6b4d,0x08002882,0x00002123,0xffff94d2,0xfffeffff,
-0xfffeffde,0xfffefffe,0xffffffff,0x2020d638,0x000020a2,0xffde840f,0xfffeffff,0x1000acb2,0x00201882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x080020a2,0xff9ea472,0x632cd679,0x08610000,0x00002124,0xffdfacd3,0xf7deffff,0xffdeffff,0xf75dffff,0x4208b555,0x00400000,
-0x00200040,0x20a21021,0x210320a2,0x18a220c2,0x20c210a1,0x00001862,0x00000000,0x00000020,0x10a20020,0x002018e3,0x00000000,0x00000000,0x08001062,0x10001000,0x10001000,0x08001000,0x10201841,0xd6791020,0x9cf3ffff,0x21240000,0x08a20881,0x10810861,0x006110c2,0x08c10040,0x00200000,0x00000000,0x00000000,0x00000800,0x00000820,0x08410000,0x00000000,0x08000000,
-0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x8c3020c2,0xffdfd69a,0xffffffff,0xfffeffde,0xfffff7de,0x0840c617,0x104120c3,0x18610000,0xe6fb9451,0xffdfffdf,0xffbfffdf,0x732dcdf8,0x10410800,0x000010a2,0xffffbdd7,0xffffffff,0xffffffde,0xffbeffdf,0x9410eedb,0x10410800,0x08000800,0x00000000,0x00000000,0x08000800,0x08000800,0x00000000,0x00000820,
-0x08200000,0x00000000,0x00000000,0x08400000,0x10610000,0x00000000,0x00000000,0x00000000,0x08000800,0x18a10000,0x5aaa0800,0xd699f77d,0x00000000,0x00001081,0x08000000,0x08000800,0x00000800,0x00001061,0x08a30000,0x00000000,0x00000000,0x08810000,0x00000000,0x00000000,0x08000000,0x00000800,0x00000000,0x00000000,0x10200800,0x00000881,0xd6da52ea,0xfffff79d,
-0xfffeffde,0xffffffff,0xffffffff,0x2882eedb,0x08601040,0x9cb218e2,0xffbee71b,0x08008bcf,0x00201861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001841,0x94316aeb,0x00000000,0x18a20841,0x08000000,0xffdfe69a,0xffffffbe,0xffdeffff,0x5a89ce38,0x00000000,0x00001882,
-0x00000020,0x20c31020,0x210320e3,0x18e218a2,0x18e318e3,0x20a220c3,0x00001082,0x00000820,0x00200000,0x18e310c2,0x18e318e3,0x00000041,0x08410000,0x20622082,0x290428c3,0x294420e3,0x08003124,0xffdf94b2,0xef7dffff,0x00005b0b,0x18a318c3,0x212418e3,0x00200020,0x00200881,0x08610020,0x10611081,0x20c318a2,0x18a21020,0x00000000,0x08610840,0x29041081,0x188220c3,
-0x290420a3,0x20e32924,0x294520e3,0x00001881,0x00210021,0x00000000,0x8c310801,0xffffe6fc,0xf7deffff,0xffffffde,0x0000defb,0x20e30000,0x00002082,0x20a30000,0xffbfc5b7,0x9431ef1c,0x00000000,0x10411041,0x00002925,0xffffc618,0xffffffbf,0xffbeffdf,0x9c51eefc,0x00001800,0x00210000,0x00000000,0x312418a2,0x20e32904,0x28e420e3,0x29043125,0x18c22103,0x000018a2,
-0x00000000,0x10810840,0x210418c3,0x108110a2,0x08400840,0x18a20820,0x20e320a2,0x29041861,0x28e32082,0x18e218e2,0xce780000,0xffdfffde,0x100083ef,0x20c228e3,0x20e32924,0x18a220e3,0x084018a2,0x08400000,0x10e318e4,0x29232123,0x18a22924,0x00000020,0x10610820,0x18e32104,0x28e32924,0x290320e3,0x290420e3,0x29042124,0x00001800,0x08800840,0x00000000,0xe6fb9491,
-0xffdeffff,0xffdfffde,0xffffffde,0x0800e6db,0x21440000,0x00000000,0x836d3924,0x000049c7,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18610000,0x00000000,0x10a20861,0x08001041,0xd6794a28,0xffbeffdf,0xffffffff,0x8c30deda,0x00000000,0x108120e3,0x08200000,
-0x00600000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x10610000,0x00000000,0x00001041,0x00000000,0x00000000,0x00810040,0x00200000,0x08000000,0x00000000,0x00000000,0x4a280000,0xffffe71b,0xffffffff,0x0000d69a,0x00000000,0x00000000,0x08610000,0x00200000,0x000010a2,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x10200800,0x00000000,0x20e30820,0x00010000,0xa5143186,0xffffef5d,0xffdfffff,0xb596ffbe,0x00004a28,0x18611020,0x080028e4,0x62ab0000,0x00005229,0x18e30821,0x00000841,0x41e80000,0xffdfdedb,0xffffffff,0x9451e6bb,0x000028c3,0x20c31821,0x00000820,0x08610020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000820,0x00000020,0x00000000,0x00000000,0x08610000,0x00001081,0x08000800,0x08000000,0x00000000,0x00000000,0xffff8cb1,0xffffffff,0x0800d659,0x00000000,0x00000000,0x00200000,0x00000020,0x00001081,0x00000000,0x00000000,0x10620000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x18001000,0x00000000,0x08401081,0x29030800,
-0xef3c9cd2,0xffdfffff,0xfffff7be,0xbdd6ffbe,0x00004a68,0x20e30000,0x08001000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08821082,0x10a20861,0x9cb20000,0xffffffbe,0xffdfffdf,0xad13f75d,0x00003185,0x18a218a1,0x18a21081,0x08000000,
-0x00000020,0x83cf49e7,0x8c719471,0x94b29492,0x8c9194d2,0x84308c71,0x0000632c,0x08210800,0x41e70000,0x94718c10,0x9cd294b2,0x00004228,0x00000861,0x00000000,0x7bae5249,0x8c918410,0xdedb9cd3,0xffbeffff,0xffffffdf,0xdefbffde,0xc618ce59,0xad14b596,0x000039c6,0x10411020,0x31860000,0x31a64a49,0x18e331a6,0x00000000,0x00000840,0x39c618c2,0x52894208,0x5acb5289,
-0x5aeb5aeb,0x52895a89,0x5aca528a,0x00004a28,0x00000820,0x10401040,0x18c40841,0x00000000,0xce1862ec,0xfffff77d,0xffffffdf,0x8c51e6fb,0x00000000,0x08211061,0x00001882,0x18a30000,0x08820020,0x00000000,0xe6fc9492,0xffdfffdf,0xa493eefc,0x00003104,0x20e30800,0x10411061,0x10a10020,0x00000020,0x94916b4c,0x94b29491,0x94919cd2,0x7bce8c50,0x6b8c6b8c,0x20e15ae9,
-0x08200000,0x00000000,0x422839e6,0x42484a48,0x00001903,0x08400000,0x00000000,0x20c21861,0x4a6939a6,0x634c2985,0xffffef9d,0xfffff7be,0x9cd2ffbe,0x6b8d5289,0x5aeb636c,0x00003185,0x10c20000,0x52890000,0x84308c51,0x6b8d7c0f,0x000041e7,0x00000841,0x738d1040,0x94d29492,0xad549d13,0xc618bdd7,0xbdf7c617,0xce38c638,0x1000628a,0x00201040,0x20e30840,0x000028e3,
-0x4a680000,0xff7dc5d7,0xf7beffff,0xfffff7be,0xb555ef1c,0x00005aaa,0x20c21840,0x00000860,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x08410040,0x94310000,0xffffe71c,0xbdb6f79d,0x000041c7,0x18c20000,0x18c218c2,0x00000000,0x00001041,
-0x000018e2,0xffdfa4b2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x528aef7d,0x29040000,0x83cf0000,0xffdfffbe,0xffffffff,0x0000ce39,0x002010a2,0x000018e3,0xffbe8c10,0xffffffff,0xffdfffff,0xffffffbe,0xffffffff,0xffffffff,0xffffffff,0xef3cffff,0x000041a6,0x00002082,0xe71ba4f3,0xdefbef3c,0xd6bae71c,0x000052aa,0x00002103,0xef3c9cd2,0xef5cef3c,0xef7def7d,
-0xef9df79d,0xef7df77d,0xf7beef5d,0x1020ce17,0x08200000,0x00000000,0x18c310a2,0x18a21062,0x00000000,0xd69a6b2c,0xffffffbe,0xffffffff,0x4a28ce59,0x08410000,0x10a20820,0x00200861,0x000008a2,0xd6ba634d,0xffffffff,0xb535f73d,0x10004146,0x20a30800,0x18a21882,0x00000000,0x00200000,0x00000881,0xffded679,0xffffffff,0xffffffff,0xffdeffff,0xf7bdf79d,0x738df77c,
-0x21030000,0x94b20000,0xe75ce75c,0xe71bef9d,0xbdf7e71b,0x00200820,0x000018a2,0xdeba736d,0xe73ce71b,0xef7de71b,0xffffffff,0xffffffff,0xffdeffff,0xf7bef7be,0xf7beef9d,0x00009471,0x000018e3,0xd6790020,0xffffffff,0xffffffff,0x0000c5f7,0x000010a2,0xf77d41e7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x0800a4b2,0x002028e3,0x00000000,0x20c20000,
-0x00002123,0x6aeb0800,0xf7bec5f7,0xffffffff,0xff9effdf,0x00009471,0x000018a1,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000040,0x00000000,0x00000020,0xa4f33986,0x000083af,0x20e30000,0x18c220c2,0x00000000,0x7bae6b0c,0x08200000,
-0x000010c2,0xffbfacd3,0xffdfffdf,0xffdfffff,0xffffffff,0xffffffff,0x7bcfffdf,0x29040000,0x83ae0800,0xffdfff9e,0xffdfffbe,0x8c30ffdf,0x18c30000,0x00000840,0xe6db2082,0xf7beffff,0xfffff7df,0xffffffff,0xffffffdf,0xffdfffff,0xffdef7be,0x9cb2ffdf,0x31250000,0x7bae0000,0xfffff7be,0xffffffff,0xffffffff,0x00008410,0x00002965,0xffffb5b6,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x20c2deba,0x00200000,0x4a4818a1,0x00000000,0x18a220e3,0x20822082,0x08000000,0xd6598c30,0xffdeffbe,0x3165c5f7,0x10810000,0x08810000,0x00000020,0x000008a2,0xdedb6b6d,0xc5f7f75d,0x000062cb,0x20a20000,0x20822082,0x00001000,0x5aeb0000,0x000018a3,0x000010a2,0xffdfd679,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0x8c0fffde,
-0x21230000,0xce580000,0xffffffff,0xffffffff,0xffffffff,0x0000ad75,0x00002103,0xef5c41c6,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xffffffdf,0xf79effff,0x0000632c,0x00002124,0xffff94b2,0xffffffff,0xffffffff,0x20a2e6ba,0x00000020,0xf79d4a28,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x08009c92,0x00002903,0x9cf39cd2,0x00004228,
-0x29240000,0x000020c2,0x840f0000,0xef1bdeba,0x6aebbd76,0x00001020,0x00000861,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0x10610000,0x000010a2,0x10a20000,0x00000000,0x18820000,0x10a120c2,0x00000000,0xb5b64208,0xd69affbe,0x08610000,
-0x000018c2,0xffdfacd3,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0x8410ffdf,0x29240000,0x838e0800,0xffffff9e,0xffdfffff,0xef1cffdf,0x00002904,0x18c31081,0x94310800,0xffdfffdf,0xf7deffff,0xffffffff,0xffffffdf,0xffbeffdf,0xffffffdf,0x3145e6fb,0x08000000,0xdebb2904,0xffdfffdf,0xffbeffdf,0xffffffff,0x00008c30,0x00002944,0xffffb5b6,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x28e2deda,0x00001061,0xe71b7bae,0x7befce59,0x00000000,0x20c30000,0x082020e3,0x00000000,0x7bef7bef,0x00000000,0x08610000,0x000018c2,0x108110a2,0x08610000,0x08200000,0x08005269,0x18a20000,0x10611882,0x000020a2,0x7bae0000,0xdefbd6ba,0x00003186,0x00000000,0xffffe6db,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0x8befffbe,
-0x20e30000,0xce380000,0xffdeffff,0xffffffff,0xffffffde,0x738df7be,0x31650000,0x94920000,0xf7beffff,0xffdfffff,0xffbeffdf,0xffffffff,0xffdfffff,0xffbef79e,0xbd96ffff,0x18e30000,0x21040000,0xffffdefb,0xffffffdf,0xfffff79e,0x2082e6db,0x00000000,0xef5c3185,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x08009c92,0x000020e3,0xffffce99,0xbdb6df1b,
-0x080041a6,0x21230000,0x000010c2,0x39452061,0x08000800,0x08200000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08001000,0x20e30000,0x00000861,0x20e31061,0x082010a2,0x00000000,0xa4f32924,0xffffef7d,0xd69affff,0x08400000,
-0x000018c2,0xffdfacd3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x8c50f7be,0x29440000,0x7bae0800,0xfffff7de,0xffffffde,0xffffffdf,0x0000a4f3,0x104118c2,0x28e30800,0xff7ec5d7,0xffdfffdf,0xfffff7de,0xffffffff,0xfffff7be,0xef1bffdf,0x0000736d,0x000028e3,0xffdf9451,0xffdeffdf,0xffffffdf,0xffdfffff,0x00007bcf,0x00002944,0xffffbdd6,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x2922e6da,0x000018a1,0xffde7b8d,0xffdeffff,0x7befce58,0x00000000,0x18c21081,0x084110a2,0x00000000,0x08410861,0x00002103,0x39c60000,0x00000000,0x104020e3,0x00001081,0x10610000,0x08401061,0x000018c2,0x632c0000,0xf7bece58,0xef3cffff,0x000041e7,0x10810000,0xffffef3c,0xffffffff,0xffffffff,0xffffffff,0xfffefffe,0x83ceffbe,
-0x20e30000,0xce580000,0xffdeffff,0xffffffff,0xffbeffff,0xe71bffff,0x000020e3,0x28e30800,0xffffce18,0xffdfffdf,0xffffffdf,0xffffffdf,0xffdfffff,0xff9effdf,0x4166d639,0x21240000,0x9cd30000,0xffffffff,0xffffffdf,0xffdfffff,0x30c3e6ba,0x00000821,0xef3b28c2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x10009c72,0x00002903,0xffffce58,0xffffffff,
-0xa4b2eefb,0x00003965,0x18c20000,0x08000000,0x18612082,0x18e21040,0x00001040,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18610000,0x6aaa2021,0x00005228,0x10610000,0x08000000,0x08400000,0x94300800,0xffffef1c,0xffdeffff,0xce99ffff,0x08410000,
-0x000018a2,0xffdfb4f4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x8c50ffde,0x29440000,0x83cf0000,0xffffffde,0xffffffff,0xef5dffdf,0x000083cf,0x080020a2,0x00001041,0x72ec0800,0xffdfcdf7,0xffdfffff,0xffdfffdf,0xffbeffdf,0x49e7ce18,0x18820000,0x00001861,0xbdb64a08,0xffffffbe,0xffffffbe,0xffbeffff,0x000073ae,0x00002944,0xffffbdb6,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x3143e6da,0x08200000,0xffbd7b8d,0xffffffde,0xffdeffff,0x73aece79,0x00000000,0x002010a2,0x212410c2,0x00002104,0x08610000,0xef5db575,0x3986ad54,0x00000000,0x084010a1,0x084010a1,0x00000000,0x4a480000,0xf7debdf7,0xffffffff,0xe73cffde,0x00004a28,0x00000860,0xffffdeba,0xffffffff,0xffffffff,0xffffffff,0xfffefffe,0x83adffbd,
-0x21030000,0xce380000,0xffffffff,0xffdeffff,0xffffffdf,0xa4f3e71c,0x00002924,0x00001040,0x94510000,0xffffeefc,0xffdfffdf,0xffffffff,0xffdfffdf,0x9c52f71c,0x08002021,0x080020c3,0xdeba0000,0xffdfffff,0xffbeffff,0xffffffdf,0x3924f71c,0x00000000,0xef3c3103,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x10009c72,0x000020a2,0xffffd6ba,0xffffffde,
-0xffffffdf,0xad14e71b,0x000039c6,0x10811040,0x18611020,0x00000000,0x18410800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20a20000,0xb4d32000,0xa4f3eeda,0x00002924,0x000018a2,0x000008c2,0xff3d626a,0xffffffbf,0xffffffde,0xd6baffff,0x08200000,
-0x080010c2,0xffdfb534,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0x8c30ffdf,0x29440000,0x7b2d1000,0xffdfff9e,0xeefbffdf,0x41e7ad14,0x08200800,0x08000800,0x10810000,0x08001000,0x8bf01021,0xffbfde7a,0xffdfffbf,0xa4b2f73d,0x00000000,0x104120e3,0x08610000,0x00000000,0xde7a8bcf,0xffdfffbe,0xf7beffdf,0x00006b6d,0x00002924,0xffffbd96,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x3985e6fb,0x00000000,0xffbe734c,0xffffffff,0xffffffdf,0xffdeffff,0x6b4cce79,0x08810000,0x08610040,0x00000000,0xef5d9491,0xffffffff,0xef5cffff,0x18e3a513,0x10610000,0x00001061,0x08610000,0xef5dad55,0xffffffde,0xffdeffff,0xe75cffff,0x00004208,0x000010a2,0xffffd679,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x736dffbe,
-0x18c20000,0xd6790000,0xffbeffff,0xffffffdf,0xbdb6f79e,0x00005a8a,0x10410000,0x10a20000,0x00000881,0xa4d349e7,0xffdfde9a,0xffdfffdf,0xb535f73d,0x08003945,0x10811000,0x10610000,0x52aa0000,0xf75dbdd7,0xffffffdf,0xffffffdf,0x3924e6ba,0x00000000,0xf73b30e2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x18009430,0x000030e3,0xffffd699,0xffdeffbe,
-0xffdfffff,0xffbeffff,0x0800a4f3,0x000018a2,0x08001861,0x94710020,0x4145c576,0x00610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20810000,0x934d2800,0xffffff9d,0x630ce6fb,0x18e30000,0x08610040,0xd5f81800,0xffdfffdf,0xffdfffff,0xd6baffff,0x10610000,
-0x000010a1,0xffdfbd35,0xffffffdf,0xffdfffdf,0xffffffdf,0xffdfffdf,0x8c30ffdf,0x29240000,0x62290800,0xffbeff3d,0x3965c596,0x00000800,0x10411061,0x10812103,0x084018c3,0x18611020,0x00001021,0x9c312842,0xd5f8eebb,0x00006aab,0x10e210a1,0x10810000,0x000010a2,0x18821061,0x20410800,0xe71c9430,0xffffffff,0x00007bef,0x00003124,0xffffbd96,0xffffffdf,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x4a06ef1b,0x00000000,0xf79d6b0b,0xffffffff,0xffdeffff,0xffdfffff,0xa514ffff,0x18e30000,0x00000840,0xd6ba8430,0xffffffff,0xffffffde,0xffffffff,0xe71cffff,0x00009491,0x08200820,0x00200000,0xffffdedb,0xffffffde,0xffdeffde,0xe73cffff,0x000039a6,0x00000861,0xffffdeba,0xf7dfffff,0xffffffff,0xffffffff,0xffffffff,0x732cff9d,
-0x21240000,0xc6170000,0xffffffdf,0xc5f7f77d,0x00006b0c,0x18a20000,0x18c20820,0x108118c2,0x10a118e2,0x00000000,0xa4b32082,0xbd96de7a,0x0800624a,0x20a30800,0x18e218a2,0x106118a2,0x00000861,0x5a690000,0xff9ece18,0xffffffff,0x4165eefb,0x00000000,0xef1b2060,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffdf,0x10009430,0x00002041,0xffffd699,0xffffffde,
-0xffdfffff,0xf75dffff,0x00006aeb,0x20c21040,0x6b2c0000,0xffffce79,0x2821e67a,0x00201061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x18000020,0x69e83800,0xffbdeeda,0xce79ffff,0x18c20000,0x18a20000,0x836e1800,0xffbeffbf,0xf7beffdf,0xce59ffff,0x08a20000,
-0x000010c2,0xffdfb534,0xffffffdf,0xffdfffdf,0xffffffdf,0xffdfffdf,0x9492ffdf,0x21030000,0x10000800,0x834dacd3,0x00000800,0x18e318c3,0x00002103,0x00000000,0x00000000,0x00001081,0x18c31061,0x00000000,0x10001841,0x20c20000,0x00200840,0x00000000,0x08810000,0x000018a3,0x100028c3,0x39451000,0xd69a9c92,0x000083cf,0x00002924,0xffffbdb6,0xffffffdf,0xffffffff,
-0xffffffff,0xffffffff,0xffffffdf,0x5228ef3c,0x00000000,0xffde7b8d,0xffffffff,0xffffffff,0xffffffdf,0x18a2de9a,0x29040000,0x94b20000,0xffffffde,0xffdeffde,0xffffffff,0xffffffff,0xffffffde,0x94b2ffdf,0x21040000,0x000018c2,0xffdf8c50,0xffffffff,0xffdfffff,0xe73cffff,0x000041c7,0x00001041,0xffffde9a,0xffffffff,0xffffffff,0xffffffff,0xffffffde,0x732cff9d,
-0x10a20000,0xd69a0000,0xc5f7ffdf,0x00006b2c,0x20820800,0x082020a2,0x000020c3,0x00000000,0x08000000,0x10a110a1,0x00000040,0x00001061,0x20e30000,0x08201882,0x00000000,0x00000000,0x188220a2,0x000020e3,0x7b8e0800,0xffdfce38,0x3924eefb,0x00000000,0xe6fa20a1,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffdf,0x10009c51,0x080020a2,0xffffdefb,0xfffff7de,
-0xf7beffff,0xc596ffdf,0x10a20000,0x000010a1,0xdedb39a6,0xffffffff,0x2000bd14,0x000028a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10000000,0x48a34082,0xffffcdd6,0xffffffff,0x00009451,0x086118c3,0x20211000,0xffffd659,0xffffffff,0xd699ffdf,0x08810000,
-0x000010e2,0xffdfb514,0xffffffff,0xffffffdf,0xffffffdf,0xffffffff,0xa514ffff,0x19030000,0x18610000,0x08000800,0x10811881,0x000010c2,0x29450000,0xd6da9cf3,0x000094b2,0x08410000,0x00200000,0x18c20040,0x00000000,0x082018c3,0x84100000,0xc638defb,0x00005aeb,0x20e30000,0x18211000,0x08002062,0x08000000,0x000020c3,0x000028e4,0xffffbdb6,0xffdfffdf,0xffffffdf,
-0xffffffdf,0xffffffff,0xffffffdf,0x4a07ef1c,0x00000000,0xffbe7b6d,0xffffffff,0xffbfffff,0xff9effdf,0x08007b8e,0x00002904,0xef7d5aaa,0xffdeffff,0xffffffff,0xffffffff,0xffffffff,0xffbfffff,0xe73cffff,0x00004a49,0x106110a2,0xce380000,0xffdfffdf,0xffffffdf,0xef3cffdf,0x000041c7,0x000020a2,0xffffde9a,0xffffffdf,0xffdfffff,0xffdfffff,0xffffffde,0x732cff9e,
-0x10a20000,0x94710000,0x00007bae,0x20a20000,0x08001882,0x080020a2,0x5acb0000,0xc618ce59,0x20a283ef,0x00400000,0x10c20080,0x10810000,0x000018a2,0x00001040,0xb5754a28,0x2944a4f3,0x00000000,0x20c220e3,0x00001040,0x83cf0000,0x180093ef,0x00000841,0xeefb1881,0xffdfffff,0xffdfffdf,0xffdfffdf,0xffdfffdf,0xffdfffdf,0x1000a492,0x000020a2,0xffffdeda,0xffffffff,
-0xffdfffff,0x5a49f73d,0x08810000,0x000018e2,0xffffbd96,0xff9effde,0x10008bcf,0x000028a3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x18002062,0xde9a734d,0xe67aeeba,0x0000acd3,0x00410861,0x00001062,0xbdd762cb,0xc5d6bdb6,0x8c10bd75,0x08410000,
-0x00001081,0xbd967b6e,0xbd96c596,0xb535bd76,0xb535acf4,0xbd96b535,0x6b4cc5d7,0x00a10000,0x08400000,0x18a21882,0x108120e3,0x29440000,0xe6fbad34,0xffffffff,0xd6baffff,0x00008430,0x00000860,0x00200020,0x10610820,0x08400840,0xbdb60000,0xffdfffdf,0xad34ef5d,0x00003165,0x20a31021,0x10211841,0x002018c2,0x10200000,0x000020a3,0xffffad34,0xffbfffdf,0xffdfffdf,
-0xffffffff,0xffffffdf,0xffffffdf,0x5228ef3c,0x08000000,0xff5d6269,0xffdfffff,0xffdfffff,0xc5f7ffdf,0x20c30000,0x00001041,0xffdfce18,0xffdfffff,0xffdeffff,0xffffffff,0xffdfffff,0xffdfffdf,0xffdfffff,0x1041d67a,0x18a30000,0x6b2d0000,0xffdff75d,0xffbfffbf,0xef1cffdf,0x00003966,0x000020a2,0xffdfc5f7,0xffbeff9e,0xffdfffbf,0xffdfffdf,0xffffffbe,0x62aaff5d,
-0x18c30000,0x00000020,0x18c20000,0x08400881,0x10c218c2,0x00000000,0xef5da513,0xffffffff,0x5a49ef1c,0x18a20000,0x00200000,0x18821081,0x18410800,0x39860800,0xffffde9a,0xe71bffff,0x29449cf2,0x00000000,0x20c22103,0x00000820,0x00000000,0x08001081,0xe69a0800,0xff9effbf,0xffbeffdf,0xffdfffdf,0xffbeffdf,0xff9effdf,0x100093f0,0x00001881,0xff9ed658,0xffbeff9e,
-0xff7eff9e,0x0000acd3,0x008110e3,0x628a0800,0xffbef73c,0xe6baffbe,0x100030c3,0x00001021,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0x10000800,0x20002821,0x10410800,0x00200020,0x10410820,0x00000000,0x00000800,0x08000000,0x00000800,
-0x10610000,0x08000000,0x10000800,0x00000000,0x00000800,0x00000800,0x00000000,0x00200020,0x00000020,0x20e30861,0x00000000,0xdefb8c51,0xffffffff,0xffffffde,0xffffffff,0x0000bdf7,0x00201040,0x08810020,0x00002103,0x10410000,0x00000000,0xd6798bef,0xffffffff,0x9471deda,0x00000000,0x18a21041,0x08810840,0x00000840,0x00001841,0xa4f35a8a,0xc596bd75,0xbdb6c596,
-0xc5f7bd96,0xbdd7c5f7,0xcdf7ce38,0x3144ad34,0x00000000,0xad133104,0xbdb6c5d6,0xc5b6bdb6,0x5a6abdb6,0x10810000,0x21030000,0xbdb69cd3,0xbd96bd96,0xffffd69a,0xffdfffff,0xffffffff,0xde9aff7e,0xce38d659,0x5aabc5d7,0x10a20000,0x00001041,0xad148bcf,0xa4b3a4b3,0x83af9c92,0x08001020,0x00001041,0x7b8e5a8a,0x9c719451,0xa4d39c92,0x9c929c92,0xa4b2acf3,0x31049410,
-0x00200000,0x10c20000,0x00000881,0x18e31081,0x00000000,0xd6ba7bef,0xffffffff,0xce38ffbe,0x10206aeb,0x10400800,0x10c20040,0x00000000,0x100020a3,0x08001041,0xef3c8c10,0xffffffff,0xdedaffff,0x10a19491,0x00200000,0x10e318e3,0x000010c3,0x10200000,0x6aeb0000,0x9c3193f0,0xad149c92,0xb514b514,0xacf3acd3,0x9c71b514,0x00003904,0x00001060,0x7b4d5a69,0x940f8bce,
-0x834dac71,0x00201861,0x00610060,0x49a60000,0x838d836d,0x62aa8bef,0x18410800,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08001842,0x08200000,0x00200020,0x00000000,0x00000000,0x20c30841,0x18a218a2,0x20a23104,0x00000000,
-0x00000020,0x20e31061,0x18a21081,0x10e32124,0x210410a2,0x20a220e3,0x084018a2,0x00000000,0x18c30000,0x00000000,0xce79630c,0xffffffbe,0xffdfffdf,0xffffffdf,0xa513f7be,0x00000000,0x18c20820,0x000018e3,0x00000000,0x000018e3,0x08410020,0x08200000,0xef5c9471,0xffffffff,0x7befdefb,0x00000000,0x08a210c2,0x00000020,0x08200000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x08200000,0x00000000,0x00200040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0x00000020,0x00000000,0x08000000,0xe69a4146,0xffffffff,0xffdeffdf,0x08009451,0x00000800,0x00000000,0x00000861,0x00000821,0x00000800,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,
-0x00000000,0x00000020,0x21040841,0x00000000,0xce79630b,0xfffff79d,0xef5dffff,0x08009451,0x00000000,0x08411041,0x00000000,0x21030000,0x00200020,0x004010c1,0x52680000,0xffbec617,0xffffffde,0xe73cffbe,0x000094d2,0x10c20000,0x002008a1,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08000800,0x00000000,0x08000000,0x08000800,0x00000000,0x08000000,
-0x08000800,0x00200020,0x00000000,0x08000820,0x00000800,0x00000000,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x00c108c1,0x10a208a2,0x188218a3,0x00000021,0x00000000,0x10a20000,0x18c220e3,0x00000000,
-0x00000000,0x00000000,0x18c210a2,0x110308e2,0x10e21103,0x210310a2,0x082018c2,0x00000000,0x000018c2,0xb5b639c6,0xffffef7d,0xffdfffff,0xffffffdf,0xffdfffff,0x00009491,0x18810860,0x000020c2,0x7c0f0000,0x000094d2,0x10820000,0x00200881,0x082018c2,0xde9a0000,0xf7deffff,0xf7beffff,0x6b6dce58,0x00000000,0x00001081,0x00000000,0x18c20020,0x08a210e3,0x08c208c2,
-0x10c208a2,0x10c208a1,0x00400861,0x006110c2,0x00000020,0x18c20840,0x10c210c2,0x08612103,0x086118c2,0x00000000,0x00000000,0x18c310c2,0x28e418a2,0x7b0c1800,0xffbef75d,0xdebaffdf,0x08400000,0x10a21081,0x002018c3,0x00000841,0x08200000,0x18c318a2,0x18a218a2,0x108118a2,0x00000040,0x00000000,0x18821062,0x18c318a2,0x10a218c3,0x10a22103,0x21031081,0x000018a2,
-0x08200020,0x10810000,0x00000000,0xb5954207,0xffdfef5d,0xffdeffff,0xdebaffdf,0x08000000,0x084018e3,0x000010a2,0x8c510000,0xdefbd6ba,0x00008c91,0x10c10000,0x00002103,0xce580000,0xffdeffff,0xffffffde,0xce99ffff,0x0000738d,0x10810000,0x00400000,0x08810040,0x10e210e2,0x18c218e2,0x20e32124,0x208128e3,0x18e218e2,0x00000020,0x20a21040,0x292320c2,0x20c22103,
-0x108118a1,0x00200060,0x18a30862,0x188118a2,0x294318e2,0x086018e2,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000041,0x00000000,0x00000841,0x00000000,0x000008a2,
-0x00200000,0x00200000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x18a20800,0x6b6d0000,0xffffe73c,0xffdeffff,0xffdfffdf,0xffffffdf,0xef5cffff,0x08410841,0x000010a2,0x62cb0000,0xf7bec638,0xd6baffff,0x0800736d,0x00200000,0x18611041,0xe6db1800,0xf7beffff,0xffffffff,0xf7beffff,0x634cce58,0x10a20000,0x00000020,0x10810820,0x18e318e3,0x18e32104,
-0x21042104,0x210418e3,0x002010a2,0x00000881,0x08610000,0x18c318e3,0x10822104,0x00400000,0x00200020,0x21030861,0x18e318c2,0x18c22124,0x000018c3,0x080020c3,0xffdfb535,0x8c10ffbe,0x10e30000,0x21241081,0x10a218e3,0x20a320c3,0x084118a2,0x00000000,0x08200000,0x10a22103,0x08611904,0x00000000,0x10000000,0x18821041,0x18e318c3,0x10a21904,0x21031903,0x18a218a2,
-0x00000000,0x000020c3,0x9cd20000,0xffffef3c,0xffdeffff,0xffbeffff,0xdebaffdf,0x10611021,0x00000841,0x6b4d0000,0xffffd699,0xffffffff,0xd6baffff,0x0000736d,0x294318c1,0xbdf60000,0xfffffffe,0xfffffffe,0xffffffdf,0xbdb6f7be,0x000041c6,0x00000860,0x00400000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000020,0x00200040,0x00000000,0x00000000,0x00000000,
-0x00000080,0x08410000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x39c618a1,0x62cb5269,0x528a738e,0x10a20000,0x08410000,0x5aaa0000,0x5b0b8c71,0x08810000,
-0x00000000,0x00000020,0x734d6b0c,0x7bef738e,0x73ce7c0f,0x7bef7c30,0x2104630b,0x21030820,0x9cd30000,0xffdfffff,0xffffffff,0xffbeffdf,0xffffffff,0xef3cffff,0x08200000,0x10211041,0xf79eacf3,0xf7dfffff,0xffffffff,0xc5f7f79e,0x00004228,0x00001041,0xeeba38c3,0xffffffff,0xf77dffdf,0xffdff75d,0xf79effff,0x0000ad55,0x000010a2,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00410000,0x00000000,0x00000841,0x00000000,0x00200000,0x00000841,0x00810000,0x00000000,0x00000000,0x00000000,0x10a20000,0x00001081,0xe6bb30e4,0x0800c5d7,0x10e30040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000061,0x00000820,0x00000000,0x00000000,0x00001082,0x18410000,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x10621061,0x7bcf0000,0xffdfe6db,0xffdeffff,0xfffff77d,0xffbeffdf,0xd679ffff,0x10610800,0x18c20820,0xf7beb5b6,0xffffffff,0xf7beffff,0xffdfffff,0x9cb2ffbe,0x29430000,0xad540000,0xffdeffff,0xef3cffff,0xffdfff9e,0xffffffbe,0x6b2cef3c,0x10a10000,0x00000000,0x31a631a5,0x29443164,0x212331a6,0x00000000,0x00000000,0x00400020,0x73ce0020,0x7bef8430,0x39e7840f,
-0x00a10000,0x00000881,0x6b2c2945,0x6b2c6b2c,0x7bce6b6d,0x00003144,0x00200081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x10001882,0xeefba492,0xf79def3c,0xdedbf7be,0x000039c7,0x10810882,0x83af0800,0xf79dffbe,0x0000736d,
-0x000018c2,0x000018a2,0xf75d9c72,0xf77effbf,0xffdfffde,0xffdfffff,0x738def5d,0x29440000,0x94300000,0xffffffff,0xde7aff7e,0x8c109c92,0xff7ece18,0xde9affdf,0x28a30800,0x62aa0800,0xfffff79e,0xffdfffdf,0xffdfffde,0xffffffdf,0x0000c618,0x000018c3,0xf6db3042,0xff5dffbf,0x72cccdb7,0xc5d762ab,0xffdff75d,0x0000deba,0x00001081,0x9cb22082,0xad75b575,0xb555ad55,
-0xb596b596,0xbdb6bdb6,0x00008c71,0x08410841,0x42080000,0xbdf7b5d7,0x8c30bdf7,0x10a20000,0x000010c2,0xbdb66b4d,0xbdf7ce18,0xbdf7c618,0x00008cb2,0x18a21081,0x41c70000,0x00003965,0x000018e2,0xbdb65269,0xc638bdd7,0xce59c618,0x0000b575,0x18c20000,0x6b0b0000,0xc618ce38,0x5acbbdb6,0x08810000,0x00001081,0xd638acf4,0xc638ce18,0xbe37be38,0xc617be17,0x6acbc5b6,
-0x21040000,0xc5f70000,0xffbeffff,0xad13ef1c,0xcdf783ae,0xffffffbe,0xce18ffdf,0x18a20800,0xa5340000,0xffffffff,0xffdeffff,0xffffffde,0xffbeffff,0xc5f7ffff,0x21030000,0xb5550800,0xffdfffff,0x72cbde38,0xe659834d,0xffbfff9e,0x83aeff9e,0x20e30000,0xad540000,0xe71be73c,0xe71be6fb,0xdefbdefb,0x7baedeba,0x18c20000,0x000018a2,0xf7de73ae,0xffffffff,0x5249ef1c,
-0x08a10000,0x00000000,0xf7bec638,0xf77df77d,0xf75cff9e,0x00005a48,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x180018a3,0xff7d934d,0xffffffff,0xffffffff,0x0000b596,0x002010e2,0x20212041,0xffdfcdf8,0x0000d67a,
-0x10610000,0x10001020,0xde7a2041,0xffdfffdf,0xffffffff,0xffffffff,0x8430ffff,0x29440000,0x8bcf0000,0xd659f75d,0x18218bcf,0x08000800,0x7b6d0800,0xde59de9a,0x20410800,0x6aec1000,0xfffff79e,0xffffffff,0xffdfffff,0xffffffbe,0x2144dedb,0x08000000,0xe67a2862,0x7b2dde39,0x10001000,0x08000800,0xce1862aa,0x0000c5d7,0x00001041,0xf73d3124,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0x0000ad95,0x21031082,0xad750000,0xffffffff,0x9492ffff,0x18e30000,0x29240000,0xffffd6ba,0xffffffff,0xffffffff,0x6b8df7de,0x18c20000,0x00001081,0x10610000,0x00001881,0xffffc5f7,0xffffffff,0xffffffff,0x8c71ffff,0x20e30000,0x39860000,0xffffef1c,0xc617ffff,0x08810000,0x000018e3,0xffdfacd3,0xffffffff,0xf7ffffff,0xffffffff,0xacd3ffdf,
-0x21040000,0xce590000,0xad34f77d,0x000041a6,0x00000000,0xd6597b8e,0xbdb6ffff,0x29440000,0xc6380000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc5d7ffdf,0x21030000,0x9c920000,0xb555f73c,0x10002882,0x28211800,0xe69a9c31,0x5a8aef1c,0x18a10000,0xd6ba0000,0xffffffff,0xffffffff,0xffffffdf,0x49e7ef1c,0x10610800,0x00000840,0xffffce79,0xffdfffde,0x0800b535,
-0x18e218a2,0x94910000,0xffffffdf,0xffdfffff,0xd5f8ffdf,0x18203082,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30830821,0xee184822,0xf7feffff,0xffdeffff,0x7bcfffdf,0x18c20000,0x100020a2,0xff5d832d,0xad34ffdf,
-0x18c30000,0x20a30800,0x6b0c0800,0xfffff77d,0xffdfffdf,0xffffffff,0x7c2ff7de,0x20c30000,0x39660000,0x08206b0c,0x10410000,0x20c320c3,0x00001862,0x62aa1021,0x18411000,0x732d0800,0xffdfff9e,0xffffffff,0xffffffff,0xffffffff,0x4a48e75c,0x18810000,0x5a491841,0x08001800,0x18a22082,0x10a218e3,0x08000000,0x188241c7,0x08001020,0xeefb2041,0xffdfffff,0xffdfffff,
-0xffffffff,0xe71bffdf,0x00004228,0x00002904,0xf7be6b0c,0xffffffff,0x0000d69a,0x21031041,0x9cb20800,0xffdfffff,0xffffffff,0xf7deffff,0xd69affff,0x10a20000,0x08610020,0x18821061,0x94920000,0xffdeffdf,0xffdfffff,0xffffffff,0xe75cffff,0x000031a6,0x00002924,0xff9e83ce,0xffdeffff,0x000073ce,0x08401102,0xd6791000,0xffdeffff,0xf7fff7de,0xffdff7ff,0x9c51ffdf,
-0x18c30000,0x736d0000,0x000062cb,0x20c20000,0x188128e3,0x18610800,0x630c8c30,0x00000000,0xd6ba10a1,0xffffffff,0xffffffde,0xffffffff,0xffdfffff,0xce38ffff,0x10c20000,0x4a280000,0x00005269,0x20c20000,0x104020c2,0x20e30000,0x20c262cb,0x00000000,0xdeda0000,0xffdeffff,0xffffffff,0xffbeffbe,0x08009430,0x18a228e3,0x8c710000,0xffbeffdf,0xeefbffff,0x100049a6,
-0x000028e3,0xf7be5aca,0xffffffde,0xffffffde,0x934dff9e,0x20a21000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28820821,0xbc924000,0xf7deffde,0xffdeffff,0xdebaffdf,0x00000020,0x080020c2,0xff1c5146,0xef5dffdf,
-0x00005acb,0x08001061,0x00001841,0xffdfbd96,0xffffffdf,0xffffffff,0x7c30f7df,0x18a20000,0x00000000,0x00000000,0x18c220e3,0x20c31081,0x18a21061,0x00000000,0x20820000,0x6b0c0000,0xfffff77d,0xffffffde,0xffffffdf,0xf7deffff,0x4a48f7be,0x18810000,0x00000000,0x20c30800,0x10a218c2,0x002010c2,0x10611882,0x00000000,0x00001021,0xf73d3945,0xffdfffdf,0xffdfffff,
-0xffffffde,0xad34ffff,0x21230000,0x00001040,0xffdfd69a,0xffdfffff,0x08008c10,0x00002103,0xf77d62aa,0xffffffff,0xf7ffffff,0xffffffff,0xf79effff,0x00008430,0x000018c2,0x00001061,0xe6db49e7,0xffffffff,0xffffffdf,0xffffffff,0xffffffff,0x0000b596,0x188110a1,0xd6590800,0xffffffff,0x0040c678,0x18e20080,0x7bae0000,0xffffff9e,0xf7deffff,0xffdfffff,0xa492ff9e,
-0x18e30000,0x00000020,0x18a20000,0x20c21040,0x18a220a2,0x082020c2,0x00000000,0x000020c3,0xe73b39a5,0xfffefffe,0xffffffff,0xffffffff,0xffbeffff,0xd659ffdf,0x08820000,0x00000882,0x18c20000,0x10c11081,0x08810840,0x00002964,0x00000000,0x00001061,0xe71b1881,0xffffffff,0xffdeffff,0xd659ffdf,0x18002061,0x08201021,0xd6ba0000,0xffdfffff,0xa492ff7e,0x28821000,
-0x00002061,0xffffce58,0xffffffff,0xffdfffde,0x48c4ee59,0x08401820,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200800,0x72282800,0xfffff6db,0xffffffdf,0xffdeffdf,0x000094d2,0x104010c1,0xeedb3062,0xffffffde,
-0x0000b5b6,0x002008a2,0x08001882,0xe6ba28a3,0xffbfffdf,0xffffffbe,0x83cfffdf,0x21030000,0x10610000,0x29041061,0x00000000,0x00000000,0x10a210a2,0x18c30841,0x10620000,0x5a6a0800,0xffdff71c,0xffffffff,0xffffffbe,0xffffffde,0x5aebffff,0x20c20000,0x10c20000,0x10811081,0x00000000,0x18e30000,0x08401041,0x00201061,0x00001061,0xf75d4a08,0xffbeffff,0xffffffbe,
-0xffdfffff,0x49e7e6fb,0x20c20000,0x94500800,0xffffffbe,0xe71bffff,0x08001020,0x000018a2,0xffffc5d7,0xf7deffde,0xffffffff,0xffffffff,0xffffffbe,0x4207e73c,0x10620000,0x000018a3,0xffff9cb2,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0x4228ef7d,0x21030000,0x8c100000,0xffffffbe,0x8c70fffe,0x18e20000,0x000018a1,0xffffce38,0xffdfffbe,0xffdfffff,0x8bcfffbf,
-0x18c30000,0x18c20020,0x106110a2,0x00002103,0x00000000,0x18a218a1,0x084120c3,0x00000841,0xef1b39a5,0xfffeffff,0xfffefffe,0xffffffff,0xffdfffdf,0xb555ffdf,0x18a30000,0x08610000,0x20a220c3,0x00001020,0x00000000,0x18e20000,0x002018c2,0x00000840,0xef5d2924,0xffdfffff,0xffffffff,0x730cff7d,0x28e30000,0x00002082,0xffff9cb2,0xf7feffff,0xa492ffdf,0x31040800,
-0x7bcf0000,0xfffff7de,0xffdeffde,0xffdfffde,0x2000b4b3,0x00402903,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x280038a2,0xff9ebcf4,0xffbeffbe,0xffffffdf,0x0000b5d6,0x00002164,0xff9d9410,0xf7deffff,
-0x738ef79d,0x10c20020,0x28e30000,0x8bcf1000,0xffdfff9e,0xff9effdf,0x3965bd75,0x00200000,0x00000000,0x00002904,0xad340000,0x632cc638,0x00000000,0x084110a2,0x00000000,0x10410000,0xcdf8730c,0xffdff77d,0xffbfffdf,0xf7beffff,0x2103bdf7,0x08600000,0x08810000,0x00000020,0xbdd77bae,0x00005aca,0x10810000,0x00000840,0x08000020,0x8c100000,0xffffe6db,0xffdfffff,
-0xffdfffde,0x00009cb2,0x000020c2,0xe6fb3165,0xffdeffff,0xef5dffff,0x000041e7,0x00001881,0xffbece38,0xffffffff,0xfffff7ff,0xffffffff,0xffffffff,0x4a08f77d,0x10620000,0x000018a2,0xff9e83af,0xffdeffde,0xffffffff,0xffffffff,0xfffff7be,0x0000bdb6,0x18c20840,0x83ef0800,0xffffffff,0xe73cffff,0x000039c6,0x000020e2,0xef1c5a89,0xffdfffdf,0xffbeffff,0x3925c5d7,
-0x00200000,0x00200000,0x000020e3,0x5aca0000,0x8c30ad55,0x00000000,0x086118c2,0x08000841,0x94701000,0xffffdeda,0xffffffff,0xffdfffde,0xf73dffff,0x1801a492,0x00000000,0x08610000,0x000020c3,0x94910000,0xd679e6db,0x000083ef,0x10a10000,0x08810020,0xb5750000,0xffffff9e,0xffdfffff,0x0800cdd7,0x184120a3,0x49e80000,0xffffef5d,0xf7def7fe,0xe6fbffff,0x08203985,
-0x736d0000,0xfffff79d,0xffffffde,0xe6baffff,0x10004904,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18002041,0xfedb40c3,0xffffffdf,0xef5cffdf,0x000052ca,0x002010c1,0xffffd699,0xf7deffbe,
-0xe71bffff,0x00004207,0x080010a2,0x100028a3,0xff7ec556,0x83aee6bb,0x00000000,0x000018a2,0x00200020,0x5aea0000,0xffffce59,0xef9effff,0x4a89be17,0x00000000,0x00000061,0x00200000,0x00000000,0xd6187b6e,0xff9eff7e,0x8c10e6ba,0x00000000,0x00000040,0x00000861,0xb5550800,0xffffff9e,0xa534ef5d,0x000010c2,0x084010c2,0x10410000,0x00000000,0xad143966,0xffdff73d,
-0xd699ffff,0x08400000,0x00002124,0xffffb595,0xffdeffff,0xffffffff,0x0000a534,0x00002964,0xff7d730c,0xffdeffdf,0xfffff7de,0xffffffff,0xffdfffdf,0x1000b515,0x000020a3,0x10610841,0xc5960800,0xffdfffff,0xffffffff,0xffdeffde,0xde7affff,0x08002062,0x082020a2,0xd6790000,0xffbeffff,0xffdfffbe,0x0000bdb6,0x20c220c2,0x83cf0000,0xffdfffbe,0x83aed659,0x00000800,
-0x00001041,0x08610861,0x31a60000,0xef7db595,0xffbeffff,0x7bcece79,0x00000000,0x08200820,0x00000800,0xad3441c6,0xffffef1c,0xff9effdf,0x6aecce18,0x10000800,0x00001021,0x00001061,0x8c710000,0xffffd6ba,0xffffffdf,0xc638ffde,0x00004227,0x002018c2,0x00000000,0xd6387b8e,0xe69aff5d,0x00005208,0x20e31861,0xbdb70000,0xffdeffde,0xffdeffff,0xffffffde,0x00009cd2,
-0x00002103,0xffffc637,0xffbeffde,0xb514ffbe,0x28e31000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28a20800,0x9c311000,0xef1ceefc,0xa4d3ff9e,0x29640000,0x738d0000,0xffffffdf,0xffdfffbe,
-0xffffffdf,0x0000bdb6,0x002010c2,0x08001020,0xa4315187,0x08004986,0x084010a2,0x08400000,0x00000820,0xef7d9491,0xf7beffff,0xffffffdf,0xe75cffff,0x21449d14,0x08820000,0x00000000,0x188218a2,0x08000800,0xa47293f0,0x08002841,0x08a10840,0x08a10020,0x52490000,0xffffd659,0xffdfffff,0xffffffff,0x73efdefb,0x00000000,0x00000840,0x20c31041,0x08000800,0xbd965208,
-0x7baee71b,0x21230000,0x62cb0000,0xffffef5c,0xffffffde,0xffffffde,0x10c2deda,0x20c20000,0xc5960800,0xffffffff,0xffffffdf,0xffbeffdf,0xef1cffff,0x08003946,0x00201882,0x10820000,0x52280000,0xffffef3c,0xffdfffff,0xffdfffff,0x732dff7e,0x20a30800,0x00002082,0xffdf9491,0xffbeffbe,0xffdfffdf,0x6b4cf79d,0x20c30000,0x000020a2,0xacf4a4b3,0x08002082,0x10611841,
-0x00000800,0x00000000,0xe73c8430,0xffffffff,0xffdeffff,0xffdeffff,0x39a6b596,0x10410000,0x20c20840,0x00000000,0xbd965228,0x9c71de7a,0x00002062,0x084120e3,0x10610000,0x31a60000,0xf7beb5b6,0xffffffff,0xffdeffde,0xffffffff,0x52aadefb,0x08400000,0x18811040,0x10000000,0x626a7b4d,0x18a20000,0x000010a2,0xef7d630c,0xffdfffff,0xffffffff,0xfffefffe,0x3124e6da,
-0x00001040,0xffff840f,0xffffffde,0x51c7f6fb,0x10610000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400800,0x00000000,0x628a3946,0x080062ab,0x08001061,0x52280800,0xcdd79c92,0xff1df6bb,
-0xffbeff5d,0x73aef79e,0x10e30000,0x08200000,0x00000000,0x18c20000,0x00000841,0x18e30020,0x9c910000,0xffdfffdf,0xffffffdf,0xffffffdf,0xffffffdf,0x738effdf,0x08410000,0x00000800,0x08200000,0x084118c3,0x08000000,0x20a20800,0x00000020,0x18c20020,0xce180000,0xffdfffff,0xffffffff,0xffdfffff,0xffffffff,0x0000bdf7,0x08000820,0x00000000,0x18821020,0x00000000,
-0x080028e3,0x10201861,0xce380800,0xffdfffff,0xffffffdf,0xffffffff,0x8410f7be,0x20c30000,0x62aa0800,0xff5de67a,0xffbeff7e,0xffffffbf,0xad55ffff,0x18c30000,0x08611061,0x00200861,0x000018c2,0xf6fca472,0xff3df6fc,0xff3dff3d,0x0000acd3,0x10612924,0x41c70000,0xffbff75d,0xffdfffdf,0xffdfffff,0xce99f7de,0x08610020,0x20820800,0x00000800,0x18a30000,0x00000820,
-0x21040000,0x8c710000,0xffffffde,0xffffffff,0xffffffff,0xffdfffff,0xc618ffff,0x08200000,0x18c20000,0x20c320c3,0x00000000,0x00001821,0x20a21861,0x18c218a2,0x10810820,0x9d340000,0xffffffff,0xffffffff,0xffffffff,0xffbeffdf,0xa4f3ffde,0x20e30000,0x18c20000,0x18613145,0x00000000,0x002018c2,0x00000061,0xffffce79,0xff7dffde,0xd5f7cdb7,0xcdd7d5d7,0x3965acd2,
-0x00000000,0x949118a2,0xb555bdb6,0x18007b0c,0x00001861,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x08810040,0x00000000,0x08200000,0x08000800,0x10001000,0x10000800,0x40c43062,
-0xde5972cb,0xce99ffff,0x00400000,0x00200020,0x18c20840,0x00200881,0x00200840,0x18e30020,0xad140000,0xffffffff,0xffffffdf,0xffffffdf,0xffdfffdf,0x8410ffdf,0x20e30000,0x08200000,0x084018a3,0x00600020,0x10a208c2,0x18811881,0x00400840,0x10400840,0xde9a0800,0xffdeffff,0xffffffdf,0xffffffdf,0xfffff7ff,0x4a08ef7d,0x18820000,0x08410000,0x00001861,0x10a21081,
-0x08000800,0x000020a2,0xffbe83af,0xffdfffff,0xbdd7ffbe,0xad14ad14,0x5acb9cd2,0x10200000,0x00001041,0x72cb3083,0x9c108b6e,0xa4b2acb3,0x4208a4f3,0x10c20000,0x00000000,0x00400000,0x08400020,0x30830800,0x40844105,0x59c85987,0x10211800,0x00400020,0x41c70000,0x9c728bf0,0x94519c51,0xf7beb555,0xf7deffff,0x000094b2,0x080020c3,0x18c218a2,0x10810861,0x084018e3,
-0x10610840,0xc6170000,0xffffffff,0xffffffff,0xffffffff,0xffdeffde,0xce38ffff,0x10610000,0x000018c2,0x20c30000,0x18a22103,0x18a21882,0x20c21862,0x00000000,0x18a21061,0xa5340000,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xa4f3ffde,0x18a20000,0x00001081,0x00000000,0x20c32903,0x19030000,0x94b20020,0xffdefffe,0xacb3ffbe,0x28001800,0x10001800,0x08001000,
-0x08001020,0x00000000,0x08000000,0x20210800,0x00000000,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08611082,0x084118e3,0x08200000,0x10610000,0x100020c3,0x08001842,
-0x5a8a0800,0xffdef77d,0x00008c71,0x002020e3,0x00400000,0x000010a2,0x00200000,0x18c20020,0xb5550000,0xffffffff,0xffffffdf,0xffffffdf,0xf7deffff,0x8c50ffff,0x18c20000,0x00001041,0x00400000,0x004010a1,0x10810060,0x000020c2,0x08400000,0x10400840,0xd6391800,0xffdeffff,0xffffffff,0xffffffff,0xfffff7ff,0x5249ef5d,0x18410000,0x00000820,0x18a20000,0x00201081,
-0x08201061,0x31250800,0xffbfde9a,0xffdfffbe,0x0000bdb6,0x00000000,0x00000000,0x00000800,0x08210000,0x08000800,0x00000800,0x00000000,0x00000000,0x000010c2,0xbdf710a2,0x0000738d,0x000010a2,0x08001862,0x08000000,0x00000000,0x08210820,0x00000000,0x00001061,0x00000000,0x08000800,0xbd960000,0xffdfffff,0x5269ef5d,0x18610000,0x10400800,0x000020e3,0x00000000,
-0x10610840,0xce580000,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xd67affdf,0x18610800,0x6b6c0000,0x000062eb,0x08400000,0x18c218e3,0x00000000,0x73ad5aca,0x18c20000,0xa5130000,0xfffeffff,0xffffffff,0xffdfffff,0xffdeffff,0x9471ffbe,0x21030000,0x7bcf0000,0x00008c70,0x00000000,0x000008a2,0xdeda4207,0xffdeffff,0x2800cd95,0x20832842,0x18a21082,0x10201061,
-0x00200000,0x18c30020,0x18a21081,0x00001882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x10820000,0x18c32104,0x210420e4,0x10a218c3,0x18c30021,
-0x00002924,0xffffad34,0x49e7ef1c,0x08000000,0x18c20841,0x00200000,0x00002104,0x18a20000,0xc5d70000,0xffffffff,0xffdfffdf,0xffdfffdf,0xf7deffff,0x8430ffdf,0x20c20000,0x39c60000,0x0000738d,0x08810000,0x00000060,0x738d0000,0x00005aeb,0x10401081,0xe6ba1820,0xffdeffdf,0xffffffff,0xffdfffff,0xfffff7df,0x6b2cf79d,0x20820000,0x42280000,0x00000000,0x10a20000,
-0x10a20000,0x4a080000,0xffdfef1c,0xdebaffff,0x08001861,0x21042924,0x10a22944,0x08400861,0x00000000,0x18621061,0x20e41062,0x20e320e3,0x10e31924,0x00000881,0xffffb5b6,0x0000d699,0x08410820,0x10620000,0x08410841,0x10a218c3,0x00000020,0x00000000,0x08200000,0x21042124,0x312520c3,0x18411842,0xffffdeba,0x5a69ef3d,0x18a10000,0x000018a1,0x41e60000,0x62eba513,
-0x10610000,0xce580800,0xffffffff,0xfffff7de,0xffffffff,0xffdfffde,0xd679ffdf,0x18611020,0xce580000,0xc617f77d,0x00007bae,0x00000020,0xad343985,0xd679f77d,0x20e20820,0x94510000,0xfffffffe,0xfffff7be,0xffdfffdf,0xffffffde,0x9450ffbe,0x18e30000,0xd6990000,0xdedaffff,0x00009491,0x00000020,0xffbe6b2c,0xbd75ffde,0x28202840,0x00002041,0x19240882,0x18a22965,
-0x18e318c2,0x00000861,0x00410000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0x00000000,0x00000000,0x00000000,0x00000861,
-0x00000840,0xef3d20a2,0x3165e6fb,0x18c20000,0x00000861,0xc63831a6,0x00008c92,0x106118c2,0x6aec0000,0xffbfde39,0xffdfffbf,0xffbeffbf,0xffffffdf,0x41c7d659,0x28e30000,0x734d0000,0xdedaf79d,0x00007bef,0x7c0f0000,0xf7bece79,0x0000b5b6,0x080018e3,0xce381000,0xffdfffff,0xffffffff,0xffffffdf,0xffffffdf,0x5aebf79e,0x18c20000,0xb5950000,0x9cd3e71b,0x00003186,
-0x00400040,0x000018c2,0xffdfa4d3,0x62abe6db,0x20c30800,0x08401061,0x00000000,0x00000000,0x00200000,0x00000000,0x00000020,0x00000000,0x18e20000,0x94910000,0xffffffff,0x9491ffff,0x21030000,0x10a218c3,0x00200020,0x00000000,0x08410000,0x10a210a2,0x10a20841,0x08410000,0x00001081,0x000020e3,0xf71c7b4d,0x00009c51,0x10c21081,0x00000000,0xe73ca513,0x8c30ffde,
-0x18c20000,0xd6990000,0xffdeffdf,0xffdeffff,0xffffffbe,0xffdfffdf,0xc5d7ffff,0x00000800,0xe6fa3144,0xffdeffff,0xdedaffdf,0xa5139471,0xffdfef3c,0xe6baffff,0x10201861,0x6b0b0000,0xffbeeedb,0xffffffdf,0xffffffdf,0xff5dffdf,0x3965b534,0x10a20800,0xd6ba0000,0xffffffff,0xbdd6ffff,0x18211821,0xb5750000,0x20a1c5d7,0x10401020,0x10820000,0x00200000,0x00000000,
-0x00000000,0x10610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x18820000,0x39c60000,0xb5969cf3,0x9d13ad75,0x6b8e9cf3,0x08410000,
-0x18820000,0x8c100000,0x00007b8e,0x10811081,0x9cd20000,0xffffe73c,0x0000ad75,0x00002103,0x08001861,0xb4d42862,0xff9ef71c,0xffdfffdf,0xb514ff7e,0x08003925,0x20821841,0x83cf0800,0xffffffbe,0xc638f7be,0xf7bece79,0xffffffff,0x0000bdd6,0x08612104,0x4a280000,0xf77dbd96,0xffdfffdf,0xffffffff,0xe6dbffbe,0x00209cd3,0x08610861,0xd6990000,0xffdfffff,0x8450e71b,
-0x08810000,0x00001081,0xc5d71000,0x00009c72,0x080028c3,0x00000000,0x00200000,0x19241903,0x00000020,0x00001081,0x08400000,0x00000000,0x00000000,0xf77d52aa,0xf7beffff,0xe6fbffff,0x00001081,0x00000000,0x00000000,0x00000000,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x10200840,0x49a70800,0x08201000,0x00201081,0xce792144,0xffffffff,0x8c10ffbe,
-0x21230000,0x7bef0000,0xffdfdedb,0xffdfffff,0xffdfffff,0xe6dbffdf,0x3186ad55,0x00000020,0xef5c5268,0xffffffde,0xffffffdf,0xffffffff,0xffbeffff,0xe6fbffde,0x08003144,0x080020a2,0xb4f451e8,0xffbfeefc,0xf73dffdf,0x6aebc5d7,0x08000800,0x00001061,0xdf1b0860,0xffbeffff,0xffdfffdf,0x08009c72,0x10401861,0x00000820,0x00001080,0x000018c2,0xa534632c,0x8c7194b2,
-0x83ce7bae,0x00002924,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0xd6591000,0xffffffff,0xffffffff,0xef7dffff,0x00005aeb,
-0x000018a2,0x000020c3,0x10a20000,0x000018c2,0xffdf7bcf,0xffffffff,0x0000b595,0x00200881,0x20c30000,0x10001000,0xbd354966,0xd5f8ff1d,0x0000628a,0x10810000,0x20c30000,0xad140800,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0x0000b596,0x002010a2,0x00200840,0x734d0000,0xff9ede59,0xc596f71c,0x20828bcf,0x00000000,0x00000840,0xde791000,0xffdeffff,0xef7dffff,
-0x00004248,0x08610840,0x00000800,0x18610000,0x080018a2,0xe71b8430,0xe73cdefb,0xef5de73c,0x10c2ce79,0x10810000,0x000010c2,0xe6fb9cb2,0xd6dae71b,0xffffef5c,0xffffffff,0xffffffff,0xad75ce79,0xb596bdf7,0x00005269,0x08002082,0x41e70000,0xce59c618,0xd6bad679,0xe73cdedb,0x0000ad75,0x08000860,0x08002061,0x00001020,0x000018e3,0xffffa575,0xffdfffff,0x7b8effbe,
-0x10c10000,0x00000840,0x94101841,0xffbfeedb,0xc597f71c,0x28e48bcf,0x00200000,0x000010c2,0xf79d4a48,0xffdeffff,0xffffffff,0xffffffff,0xffffffdf,0xef5cffff,0x00004a07,0x080028c2,0x08000000,0x9c3130a3,0x626aacb3,0x00000800,0x084018a2,0x00001061,0xf7be5aeb,0xf7fff7ff,0xfffff7ff,0x2020e6db,0x10a10000,0x08810040,0x10a10020,0x4a680000,0xffffef3c,0xffbeffff,
-0xffbeff9e,0x1040ce18,0x08400820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08001861,0xdeba1020,0xffffffff,0xffdfffdf,0xffffffff,0x0000bdf7,
-0x18611861,0x10a20000,0x08401081,0x31860000,0xffffdedb,0xffdfffde,0x0020c617,0x10c21903,0x08200040,0x20a30800,0x08000800,0x18002042,0x18820000,0x00000840,0x00002104,0xef1c2904,0xffffffff,0xffffffff,0xffffffde,0xffffffff,0x0000c618,0x18a22924,0x08400000,0x000020e3,0x836e1800,0x08006269,0x10000800,0x082018a2,0x080020e3,0xeefb2041,0xffdfffff,0xffffffff,
-0x0000ad75,0x000018e3,0x18a20820,0x08611061,0x00000000,0xffffdedb,0xffffffff,0xffffffdf,0xad75ffff,0x18c20000,0x000018e2,0xffde736d,0xffffffff,0xffffffff,0xffdeffff,0xffffffff,0xffffffff,0xd69affff,0x08201881,0x20a20820,0xb5960000,0xffffffff,0xffffffff,0xffffffff,0x8c70ffff,0x21230000,0x18410000,0x18a21020,0x52ca0000,0xffffef7d,0xffffffdf,0x83efffdf,
-0x21440000,0x18a20020,0x08000800,0xa45238c4,0x10005a09,0x00001000,0x000018a2,0x00001923,0xfffe7c0f,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xffdfffdf,0x0000b555,0x18810000,0x20a31041,0x08000800,0x08000800,0x10a21041,0x08400000,0x00002924,0xfffe9471,0xf7ffffff,0xffdeffff,0xa4b2ffbe,0x20c20800,0x00000020,0x08410841,0xce780000,0xffffffff,0xffdfffde,
-0xffdfffdf,0x28e3e6ba,0x10400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20820000,0xb5340000,0xffbeffdf,0xffffffff,0xffffffff,0x4a69f79e,
-0x18620000,0x00000000,0x21240040,0xb5750000,0xffdfffff,0xffffffff,0x6b6de71c,0x00000000,0x000010a2,0x00200020,0x18a31062,0x10610000,0x082020c3,0x10820000,0x00000000,0xffffc638,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x840fef7d,0x00000000,0x000010c2,0x20a30000,0x00000820,0x10610820,0x186120a2,0x18c20000,0x00000000,0xff7d9451,0xffffffdf,0xffffffbe,
-0x4207e73c,0x18820000,0x00000000,0x18c20020,0x9cd30000,0xffdfffff,0xffdfffff,0xffdeffff,0xef7cffff,0x00005289,0x002010a1,0xd6790000,0xffdfffff,0xffdfffff,0xffffffff,0xffffffdf,0xffdeffdf,0x7b8dff9e,0x18e20000,0x00001081,0xf79d4a69,0xf7beffff,0xffffffdf,0xffdfffbe,0xef5cffff,0x00004207,0x000018a2,0x18a20000,0xbdd70000,0xffffffff,0xffdfffff,0xd679ffff,
-0x00000000,0x08001081,0x20c31041,0x00000000,0x18620000,0x188220e3,0x10a20020,0x00000000,0xffded6b9,0xf7deffff,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0xad55ffbe,0x00000000,0x08410841,0x18c21040,0x10402103,0x00001061,0x00000841,0x4a680000,0xffffce78,0xffffffff,0xffffffdf,0xe6bafffe,0x080028a2,0x00001020,0x000018c4,0xffde9cd2,0xffdeffff,0xffbeffdf,
-0xe69affbe,0x00006acb,0x00001861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18610000,0x08000800,0xffdfbd96,0xffdeffdf,0xffdfffff,0xb5b6ffff,
-0x10610000,0x00200020,0x00000861,0xd6ba0000,0xffdfffff,0xffdfffdf,0xf79effff,0x5b0bbdf7,0x08810000,0x00200000,0x00000040,0x00400861,0x08000000,0x08001021,0xde9a734d,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf79effff,0x0000b576,0x08a20000,0x00000000,0x19030040,0x08400060,0x08000000,0x00001861,0xc5d75269,0xfffff75d,0xffdfffdf,0xffdfffff,
-0xad55ffff,0x18c30000,0x00000800,0x00000841,0xe73c31a6,0xffffffff,0xffffffff,0xffffffdf,0xffffffff,0x0000bdb6,0x20c218c2,0xacf30000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffde,0x62ebf79d,0x10a10000,0x000010a1,0xffffbdf7,0xffdfffff,0xffffffff,0xffffffdf,0xffffffff,0x0000ad55,0x000018c2,0x000018a2,0xef7d632c,0xffdfffff,0xffffffff,0xffdfffff,
-0x6b2cdeda,0x08400000,0x00000820,0x18c31081,0x00201061,0x00000000,0x00000820,0xdefb8c30,0xfffeffff,0xffffffde,0xffffffff,0xffffffff,0xffdfffff,0xffdfffdf,0xffdfffbe,0x5aaae6da,0x10820000,0x00000000,0x00000000,0x08420000,0x00200000,0xf79db595,0xffffffff,0xffdfffff,0xffdeffff,0xffbefffe,0x18007b0c,0x18822082,0x6b2d0000,0xfffeef7c,0xffdeffde,0xffdfffff,
-0x4145e6da,0x18610800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18411020,0xd6182061,0xffdfffdf,0xffdeffbe,0xd69affff,
-0x00002104,0x08400840,0x08400841,0xffdeb5b6,0xffdfffff,0xffffffdf,0xffffffdf,0xf7beffff,0x0000b575,0x00200040,0x00200020,0x00000000,0x00200000,0x08001862,0xffbeb535,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xe6fbffdf,0x000052ca,0x08001861,0x00400000,0x00000000,0x10610841,0xa4f40800,0xfffff77e,0xffffffff,0xffffffff,0xffffffff,
-0xef7dffff,0x00006b6d,0x08001882,0x18610800,0xbdd70000,0xffffffdf,0xffffffdf,0xffffffff,0xffdeffff,0x3985e6fb,0x29240000,0x94300000,0xffffffdf,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0x8450fffe,0x18e20020,0x10a10000,0xffffe71b,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0x3965ef3c,0x10400000,0x000018a2,0xffde8430,0xffffffff,0xffffffff,0xffdfffdf,
-0xff9effff,0x00009c92,0x08001061,0x00000000,0x00000020,0x10410000,0x00001020,0xe6db9451,0xffdeffde,0xffffffff,0xffffffdf,0xffffffff,0xffffffff,0xffffffdf,0xff9effdf,0x41e7c5b6,0x10a20000,0x08000000,0x00000000,0x00010021,0x18820000,0xe6fb9c92,0xffdeffbe,0xffdfffff,0xffdeffff,0xe6baffff,0x10002021,0x18a31041,0x83d00000,0xfffeffbe,0xffdeffde,0xff5dffff,
-0x1000730c,0x08003104,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200820,0x6a8a1800,0xffdff6fc,0xffffffbe,0x4228ce38,
-0x00400000,0x10411061,0xb5960000,0xffdfffff,0xffdfffff,0xffffffff,0xffdfffff,0xffdfffff,0x0000ad55,0x00410882,0x10a20000,0x00000841,0x00200000,0x20620000,0x93f01800,0xffdff71c,0xffffffff,0xffdeffff,0xffffffff,0xffffffff,0xffffffdf,0xde9aff9e,0x0000630c,0x08001021,0x00200000,0x00000020,0x08410861,0xa4b30000,0xffdfff7e,0xffffffdf,0xffffffff,0xffffffff,
-0xffffffdf,0x0000b596,0x082018a2,0x10200800,0x52490000,0xffdfef3c,0xffffffff,0xffffffdf,0xffffffff,0x0000ad54,0x18811081,0xb5550800,0xffffffff,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0x9491ffff,0x29230000,0x000020c2,0xffdf9cb2,0xffdfffff,0xffffffdf,0xffffffff,0xffffffff,0x0800c5f7,0x08201040,0x00000820,0xd69a2103,0xffdfffff,0xffffffff,0xffffffdf,
-0xce18ff9e,0x000062aa,0x00001061,0x00000020,0x00000020,0x00001081,0x10000000,0x20a20000,0xef1bacf3,0xfffff7be,0xffffffff,0xffdfffdf,0xffffffff,0xffbeffdf,0x838eeefb,0x00000000,0x00000882,0x10200000,0x18a220c2,0x08621082,0x00000000,0x18200000,0xf75da492,0xffffffdf,0xffffffdf,0xad13ffde,0x28c31000,0x00000000,0x00001883,0xffbd9470,0xfffefffe,0x9c31ff9e,
-0x30e31000,0x00000800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200000,0x200038e4,0xff5da472,0xd659ffdf,0x00000000,
-0x00200061,0x10410000,0x83af0800,0xfffff75d,0xffffffbe,0xffffffdf,0xffffffde,0x738def3c,0x08820000,0x08000020,0x000018a3,0x18c30000,0x00000861,0x08400000,0x08001061,0xff3d72cb,0xffdfffff,0xffffffff,0xffdfffff,0xffffffdf,0xe6fbffff,0x10219431,0x18c20000,0x18620000,0x18c32925,0x00200020,0x00000000,0x08001862,0xeebb5a09,0xf79effff,0xffdfffff,0xf7dfffff,
-0xef3cffff,0x00004208,0x00001081,0x08000000,0x000028e3,0xffff9c92,0xffffffdf,0xffffffff,0xef5cffff,0x000041c6,0x00002103,0xdeba0000,0xffdeffdf,0xffffffdf,0xf7dff7be,0xffffffff,0xf7beffff,0xc617ffff,0x18610800,0x000020a2,0xef1c1020,0xffbeffbe,0xffdfffff,0xffdfffdf,0xff9effde,0x0000734c,0x000020c2,0x21030000,0x7bce0000,0xffffff9e,0xffffffdf,0xffffffff,
-0x0000c638,0x10810000,0x00000000,0x08610020,0x000018c3,0x084110a2,0x00200020,0x082010a1,0x62ea0000,0xffffef7c,0xffdfffff,0xffdfffbf,0xffdeffff,0xef3cffff,0x08005a28,0x10a228e3,0x08610000,0x000018c2,0x00000000,0x08410000,0x00202104,0x188120e3,0x8c300000,0xffffffff,0xffffffff,0x6aebf77d,0x10610000,0x00200000,0x08410021,0x8bef0800,0xff9eff9d,0x2000ac92,
-0x182028a2,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x39041800,0xc5762000,0x6b2cff9e,0x18c20000,
-0x00810882,0x08000000,0x10002062,0xffbe9451,0xffffffff,0xffffffdf,0xef7dffff,0x0000734d,0x000018e3,0x18621041,0x632c0000,0x000039e7,0x10a20861,0x00000060,0x28e41081,0xcdb71800,0xffdfffff,0xffffffdf,0xffdfffdf,0xffffffff,0x4a28dedb,0x10410000,0x10611861,0x000020a2,0x00000000,0x18e30020,0x00200061,0x28a30800,0x51e81000,0xffffdebb,0xffffffbe,0xffffffff,
-0x83cfffbe,0x20e30000,0x08400000,0x000018a2,0x10200840,0xd65920a2,0xffdfffbe,0xffbeff9e,0xb575ffbe,0x20c20800,0x00001081,0xffdf9471,0xffffffff,0xffbeffff,0xffffffff,0xffffffdf,0xffffffdf,0xef5cffff,0x00005249,0x28c31020,0xa4b20800,0xffffffdf,0xffffffdf,0xffffffff,0xbd55ffdf,0x18e20000,0x08400840,0x00000840,0x080020c3,0xffdfc5d7,0xffffffdf,0xffffffff,
-0x0000b595,0x00002104,0x10c20000,0x000018c2,0x00000000,0x00000000,0x086110a2,0x10810020,0x20c220a2,0xffffe71b,0xff9effdf,0xffbeffdf,0xffdfffbe,0xe6dbffff,0x18202882,0x00001081,0x10a218c3,0x00000000,0xbdd7a534,0x00006b4c,0x10a20000,0x18a10000,0x000018a1,0xffffdefb,0xffdff7be,0x1820d638,0x08611881,0x10a20000,0x006110c2,0x080018a2,0xa4929430,0x20202000,
-0x00001841,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20611000,0x5a690800,0x00008c10,0x10811081,
-0x00000000,0x00000882,0x18211862,0xc5d71800,0xffdeffff,0xffbeffde,0xce38ffff,0x29240000,0x10a20040,0x000018a2,0xf7be8410,0x8471e73c,0x00000000,0x10811081,0x18610800,0xce181000,0xffbeffff,0xffdfffff,0xffbfffff,0xf77dffff,0x00007bcf,0x08203145,0x00001841,0x39a60000,0xa534ad55,0x00000000,0x106110a2,0x08000000,0x00002904,0xffffb5b6,0xffdeffff,0xfffff7be,
-0x0000c5f7,0x000020c3,0x002010a2,0x08810000,0x10410000,0x52490000,0x8bef9451,0x8bf083cf,0x39867b6e,0x08400000,0x00001081,0xd69a8c30,0xd679d679,0xffdfe6fb,0xffffffdf,0xffdfffdf,0xde79ff7d,0xd659de7a,0x00007b8e,0x082018a2,0x39860000,0xd679bdb6,0xde7ade7a,0xe6bae67a,0x3966cdf8,0x08610000,0x00000861,0x08610861,0x000018a1,0xff7d6aab,0xffbeffff,0xffffffbe,
-0x0800a4f3,0x000018a2,0x000010a2,0x31c60000,0xce999cf3,0x3185ad54,0x00000000,0x00001861,0x00001040,0xffffce79,0xfffff7be,0xffdfffbe,0xffbeffff,0xd699ffde,0x10201820,0x10810840,0x00000000,0xce9973ce,0xffffffff,0xce79f79d,0x0000840f,0x00400040,0x000008a1,0xffffd6b9,0xffdfffde,0x1000acb3,0x000020c2,0x00000881,0x18e20000,0x18610000,0x00000000,0x18411000,
-0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00001820,0x00000800,0x00001081,
-0x31a64a69,0x10a20000,0x20830000,0x28c30800,0xffdfde9a,0xffdeffff,0xad34ffdf,0x20e30000,0x00001081,0xa4f30000,0xffdeffde,0xffffffff,0x6b6dd6ba,0x00000000,0x18611041,0xce590820,0xffffffdf,0xef1cffdf,0xe6fbc5d7,0xf75dffdf,0x00003986,0x18820820,0x4a080000,0xe73cad54,0xffffffff,0x83efdeda,0x00000000,0x00000841,0x00002103,0xffdfad54,0xffffffff,0xe6fbffdf,
-0x08005229,0x08401882,0x31c60000,0x000052aa,0x000010a2,0x00001861,0x00000000,0x00000000,0x00000000,0x00001041,0x08810000,0x00000000,0x10411061,0xe6db3965,0xff9effff,0xffbeffbf,0x08009431,0x00001841,0x08400000,0x00000000,0x00000840,0x00000000,0x18001861,0x18201820,0x08200000,0x08400020,0x31a60000,0x00200000,0x20c20800,0x9c710800,0xfffff75d,0xffdfffff,
-0x00008c10,0x10411862,0x18c20000,0xe75c9cf3,0xffffffff,0xe71cffff,0x49e8bdb6,0x20810800,0x000020e2,0xffffb595,0xdedbffbe,0xa4d29c91,0xffdfeefb,0xce38ffff,0x20c20000,0x00001061,0xc6176b2c,0xfffff7be,0xfffff7be,0xffffffff,0xc617ffbe,0x000039c6,0x00002944,0xffffd699,0xde79ffdf,0x202130a3,0x08401020,0x7bce0000,0x00005aa9,0x000018a2,0x18e310a2,0x08000800,
-0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0x108118a2,0x00200000,
-0xce59dedb,0x00000000,0x000010a2,0x00001882,0xb5144166,0xffdfeedb,0x8c30ffff,0x21230000,0x4a280000,0xffffbdf7,0xffffffff,0xffffffff,0xffdeffff,0x0000b596,0x10611081,0xd6990000,0xf73dffff,0x5a49cdf7,0x31240000,0xde9ab535,0x000041c6,0x00002103,0xef3c9430,0xffffffff,0xffffffff,0xffffffff,0x62ebce59,0x08600000,0x08001081,0xffdf9c51,0xff7dffdf,0x7b4deedb,
-0x18a20000,0x08610840,0xbdf70000,0x0000defb,0x08200000,0x18610800,0x20c32082,0x18a21882,0x08411062,0x00000000,0x00000000,0x18a218a2,0x20c30841,0x732d0800,0xfffff75d,0xbd96ffdf,0x08a20000,0x086110c3,0x00200020,0x00200000,0x00000020,0x18c218e3,0x10a21081,0x08601081,0x000010c2,0x000018a3,0xd6ba39e7,0x00009492,0x000020c2,0x000010a1,0xb5555aaa,0xffbef73c,
-0x000083ae,0x000020e3,0xdeda6b6d,0xffffffff,0xffffffff,0xffffffff,0xe6fbffff,0x00003965,0x000020e2,0xe69aa492,0x20819430,0x08000800,0xacd34965,0xb534eeda,0x18c20000,0x5a8a0000,0xffffef5c,0xffffffff,0xffffffff,0xffbeffff,0xffffffff,0x00007bcf,0x00002924,0xff9dd658,0x5208bd75,0x18820800,0x00001061,0xf75c2103,0x7b4cf75c,0x10620000,0x00000040,0x00000820,
-0x00210000,0x00000021,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0xc6180000,
-0xffdfffff,0x0000b596,0x08610000,0x18820000,0x10000800,0xb51438e4,0x5acade9a,0x20c20000,0xbdd70000,0xffffffff,0xffffffde,0xffffffff,0xffffffdf,0x0000e71c,0x18c20000,0xad340000,0x7b6dd638,0x00000000,0x000028e3,0x49e70800,0x000020e3,0x000018e2,0xffffbd96,0xffffffde,0xffffffff,0xffffffff,0xdedbffff,0x00002985,0x000018e2,0xe69a7b4d,0x838ed5f7,0x08002041,
-0x08201862,0x00001081,0xffde94b2,0xa513ffff,0x31450000,0x20a21862,0x082020a2,0x00000820,0x00000020,0x08410000,0x10a210c3,0x18a30841,0x08200841,0x080028c3,0xffffad34,0x41c7eefb,0x08e30000,0x08c20040,0x08610881,0x086110c2,0x00000841,0x00200820,0x00400840,0x08810060,0x08810040,0x000020e3,0xffffbdd6,0x734df77d,0x20c20000,0x18a20000,0x10000000,0xad135a69,
-0x00005aaa,0x000020e3,0xffffb595,0xffffffff,0xffffffff,0xffffffff,0xffbeffdf,0x00005a8a,0x00001881,0x20414145,0x08000800,0x20c218a1,0x18001000,0x310330c2,0x18a20000,0x83ae0800,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xffdeffbe,0x080083ef,0x080020c3,0x7b4d8bef,0x00000800,0x00000861,0x00000020,0x8c3018a2,0xb514de79,0x10a30000,0x00000020,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10410020,0xbd960000,
-0xffbeff9e,0x9cf3ffff,0x10c20000,0x00000020,0x20a31041,0x08000000,0x20c33104,0x08000000,0xdeba20a2,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x0000d69a,0x08410841,0x00000020,0x00000000,0x18c210a1,0x08600881,0x000018a2,0x00200000,0x000010c1,0xffffbdb6,0xffffffff,0xffffffff,0xffdfffff,0xf7beffff,0x0000738e,0x000018e3,0x39863145,0x00000000,0x10400800,
-0x08200800,0x08000800,0xffffe6fb,0xef7dffff,0x00004a07,0x08000000,0x00000000,0x00200000,0x00000000,0x00001081,0x00000000,0x00000000,0x08400020,0x00001041,0xc5d720a2,0x00008c10,0x004018a2,0x00000040,0x00000000,0x00000000,0x08610000,0x00000000,0x00000020,0x10c20860,0x18c20881,0x7bae0000,0xffdff7be,0x9430ffbe,0x20a30000,0x00000800,0x188120a2,0x00000000,
-0x10610000,0x000020c2,0xffffc5f7,0xffffffff,0xffdeffff,0xffdeffff,0xf77dffff,0x080049c7,0x10211841,0x00000000,0x086020c3,0x08400020,0x20a21061,0x00000000,0x18a20820,0x6b0c0000,0xffffffbe,0xffffffff,0xffffffff,0xffffffde,0xffdfffdf,0x08008c10,0x18412082,0x00000000,0x10811081,0x00200000,0x08400020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x00000000,0x08210000,0x10000800,
-0xffdfcdb7,0xb595ffdf,0x10810000,0x088108a2,0x00000021,0x20a31862,0x00000000,0x000020c3,0xffbe7b6d,0xffdeffdf,0xffffffff,0xffffffff,0xffffffdf,0x0000ce79,0x000020c3,0x08610000,0x086018c2,0x00002123,0x18c20000,0x00400840,0x08800020,0x000010c2,0xffdec5d7,0xffffffdf,0xffffffff,0xffffffdf,0xf79effbe,0x00007bcf,0x002010c2,0x00000000,0x188220a2,0x214410c2,
-0x08200000,0x080020a2,0xffde9471,0xffffffde,0x9c92d679,0xa4f3a513,0x5acb7bef,0x00000000,0x10a20000,0x39c70000,0x62eb5acb,0x5aca630c,0x00000840,0x10201041,0x00000800,0x18610000,0x00000820,0x4a690000,0x5aeb4a89,0x4a4852aa,0x00002124,0x00001061,0x10610000,0x00000000,0x00000000,0xe6fb5aaa,0xffdfffff,0x1820d659,0x00001841,0x18821020,0x002018a2,0x10a21081,
-0x00001081,0x000018a2,0xffffce38,0xffffffbe,0xffffffff,0xffdeffff,0xf77dffff,0x08003945,0x00001862,0x08411041,0x18e30840,0x000010a2,0x10a218c2,0x08201081,0x10610000,0x4a480000,0xfffff77d,0xffffffde,0xffffffff,0xffbeffff,0xff9effdf,0x08007b8e,0x00001862,0x08a210a2,0x00400060,0x08810881,0x002010c2,0x10a30020,0x00000021,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x080018a2,
-0xc5961820,0x20a2d639,0x10810800,0x00200000,0x088118c3,0x00000000,0x00200861,0x00000861,0xde5972cb,0xffffffdf,0xffffffde,0xffffffdf,0xffffffdf,0x0000deba,0x000020c3,0x00200000,0x108118c2,0x08400000,0x00001881,0x18a11061,0x00000000,0x08001881,0xe69a7b2d,0xffdfffdf,0xffffffff,0xffffffff,0xf77effdf,0x00006b2c,0x082018a2,0x10610000,0x18e31081,0x00000000,
-0x00000881,0x08400840,0xce580000,0xffdeffff,0xffffffff,0xffffffff,0xc618ffff,0x18a20000,0x000020c2,0xdeda5b0b,0xef9df7be,0xef7df7be,0x0000bdb6,0x10201020,0x18a20820,0x00001081,0x00001081,0xf77db5b6,0xef5def7d,0xef7def7d,0x4248d69a,0x10a20000,0x00001061,0xc5f78c50,0xceb9c658,0xffffe75c,0xf77dffdf,0x0000736d,0x082018a2,0x00000000,0x10c20000,0x00000881,
-0x10410000,0x000018c2,0xe71c9cb2,0xffdfffff,0xffdfffbe,0xffbeffdf,0x8befd679,0x08200800,0x00000000,0x08810020,0x00000861,0x00000000,0x00000000,0x104018c2,0x08200800,0x10810000,0xef3ca4f3,0xffffffff,0xf7deffff,0xffffffff,0xa472f6fc,0x10002862,0x00200800,0x00200020,0x10611081,0x00200000,0x00000000,0x00000820,0x00000821,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x18620000,
-0x18200800,0x00002061,0x08001000,0x4a293145,0x00000000,0x088118c3,0x00000020,0x18820020,0x38e40800,0xf71cb4f4,0xffffffbe,0xffdfffdf,0xff9effdf,0x0000ad34,0x000020e3,0x21030840,0x00200000,0xdeba7bef,0x734cd69a,0x00000000,0x000018e2,0x20820000,0x28421000,0xff9ebd35,0xffbeffdf,0xffdfffdf,0xf75dffff,0x00006b2c,0x080020c3,0x29041020,0x00000000,0x7bef5b0b,
-0x08810000,0x08400000,0x6b0c0800,0xffffef5d,0xffffffde,0xf7deffff,0x62ebef7d,0x20c30000,0x00000000,0xffffd699,0xffffffde,0xffffffde,0x8c50ffff,0x20e30000,0x00000020,0x18e30000,0x73ae0000,0xfffff7be,0xffffffff,0xffdfffff,0xc618ffff,0x00200000,0x000018c2,0xffde9471,0xffffffde,0xf7deffff,0xbd75ffff,0x18e20000,0x00000820,0x94b21924,0x00005b0b,0x18c20000,
-0x00000000,0x10a20000,0x62eb0000,0xff9ece18,0xffdfffff,0x8c30deba,0x00002062,0x00201041,0x08a10000,0x000010e2,0x6b6d0000,0xdebac5f7,0x4a48a4f3,0x00000000,0x000018a2,0x00400040,0x5a8a0000,0xff7dd679,0xffffffdf,0xbd76f73c,0x100051a7,0x10002021,0x00000820,0x18c20882,0x00000000,0xce3883ef,0x0820ad54,0x08200820,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x10400840,0x18610000,0x000020a2,0xf79da4f3,0x2945ad55,0x00000000,0x00200840,0x00000000,0x00000861,0x41051000,0xf6fcbd15,0xffdfffdf,0x6b0cde9a,0x10a20000,0x00810000,0x00000000,0xc6385aaa,0xfffff7df,0xf7beffff,0x0000ad55,0x18c20000,0x00000000,0x08002082,0x732d1000,0xffbee69a,0xeefbffdf,0x5a49b514,0x00001000,0x00000000,0x00000000,0xad5439a6,0xfffef7be,
-0x00008430,0x00002103,0x080020a2,0xffdfb4f3,0xffffffde,0xffffffff,0x0000a4f3,0x20c320c3,0x94b20000,0xffbeffff,0xffffffde,0xffdeffff,0xef9dffff,0x00204a89,0x000010a2,0x00000841,0xce990000,0xffdeffff,0xffdfffdf,0xffffffff,0xffffffde,0x00009cf3,0x188110c2,0xce380000,0xffbeffff,0xffffffff,0x51e7f71c,0x10610000,0x00002903,0xffff9d33,0xa513ef9d,0x00003165,
-0x000010a2,0x00000820,0x000010a2,0x736d0000,0xacf4bd96,0x00002883,0x18c21041,0x00000020,0x00000040,0x5b0b0000,0xf7bdc658,0xffffffff,0xf77dffff,0x0840a4f3,0x08810000,0x00400000,0x00001081,0x94301000,0xe67ae659,0x1000730c,0x28e30800,0x08000800,0x08410000,0x00000000,0xce1862ca,0xffffffbe,0x1040c5d7,0x10610000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x18820861,0x732c0000,0xffdfef5d,0xe71bffff,0x10a294b2,0x08610000,0x00000000,0x08610000,0x100030e4,0x59c81800,0xb514bd35,0x08001821,0x000020c3,0x00000840,0xa5141924,0xffffef3c,0xffffffff,0xffffffff,0xdebaffdf,0x00005aeb,0x00000881,0x10200000,0x000020c3,0xb5142882,0x51e8c576,0x08001000,0x08401020,0x08400020,0x9c922104,0xffffef3c,0xffffffde,
-0x0000d6ba,0x00200020,0x18001020,0xeedb38c3,0xffdeffff,0xe6fbffff,0x08000800,0x000028e3,0xe73c52aa,0xffdfffff,0xffdeffff,0xffffffde,0xffffffdf,0x0000d6ba,0x002010a2,0x000018c3,0xffde8c51,0xffffffff,0xffffffff,0xffffffdf,0xffffffdf,0x528af79d,0x29240000,0x8c500000,0xffbeffde,0xffdfffdf,0x08009c51,0x20c220c2,0x6b4c0000,0xffffef9d,0xffffffff,0x7b8edeba,
-0x08410000,0x00000800,0x18a30000,0x00001061,0x08000800,0x28e40800,0x00200800,0x08820000,0x19030020,0xef7da554,0xffffffff,0xfffffffe,0xffdfffff,0xdedbffff,0x0000632c,0x00001903,0x18a20000,0x10001820,0x20002000,0x20821000,0x00001061,0x00200000,0x00000861,0xbdd65aca,0xffdfff7d,0xbd75ffde,0x08001020,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x20a30000,0x8bf00000,0xffdfff7e,0xffdfffdf,0xd6baffff,0x000052ca,0x000008a1,0x00000000,0x18210800,0x08002882,0x00000000,0x08a20020,0x00000020,0x080020c2,0xffde736d,0xffffffff,0xffffffff,0xffdfffff,0xffffffff,0x00009d13,0x084118e3,0x08000000,0x18c20000,0x00000860,0x00000000,0x18a120c3,0x00200000,0x000018c3,0xffbe9491,0xffbeffff,0xffdeffff,
-0x8450f79e,0x21030000,0x20821020,0x94310000,0xffdeffdf,0xad54ffff,0x28e30000,0x000020c3,0xffff9cb2,0xffffffde,0xffffffff,0xffffffff,0xffffffff,0x0000d6ba,0x00200000,0x000018c3,0xffbe8c30,0xffdeffde,0xffffffff,0xffffffff,0xffffffff,0x1040d659,0x18a10000,0x62cb0000,0xffffef5d,0xce38ffdf,0x18811040,0x000020a2,0xd6da2964,0xffffffff,0xffbeffff,0xf77dffdf,
-0x0000630c,0x00000861,0x00000020,0x20a20800,0x28c32082,0x08001821,0x108218a3,0x08a20000,0x7bee0000,0xfffff7be,0xffffffff,0xffffffff,0xffdeffff,0xffffffde,0x0000ad55,0x00001081,0x18611020,0x10611040,0x10000800,0x08002061,0x10c20860,0x08400020,0x00000881,0xffffce79,0xffbeffdf,0x2041b534,0x18611820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x000018a2,0xf73c8bcf,0xffdfffdf,0xffffffdf,0x00008c70,0x002010c2,0x18820020,0x08400840,0x10810000,0x18e318e3,0x006010e3,0x00000000,0x080020a2,0xffde8c10,0xffffffdf,0xffdfffff,0xffdfffff,0xffdfffde,0x00008cb2,0x000018e3,0x20c30800,0x00001061,0x11020060,0x10a118e2,0x106120e3,0x00000000,0x000018c2,0xffbe9471,0xffdfffff,0xffdeffff,
-0xe6fbffff,0x000018c3,0x10201861,0x00001041,0xffffce59,0xce59ffff,0x10610000,0x000018a2,0xe6db5a69,0xffbeffff,0xffffffff,0xffffffde,0xffbeffff,0x00007bcf,0x000020e3,0x18c20020,0xbdb60000,0xffffffff,0xffffffff,0xffdfffff,0xf75dffdf,0x0000734c,0x20a21861,0x94710000,0xffdfffde,0x5aaaf73c,0x18c20000,0x00001040,0xffffbdf7,0xffffffff,0xffffffde,0xffbeffdf,
-0x000083ef,0x000018c2,0x10410000,0x10412904,0x00000820,0x20c318a2,0x00000000,0x18c30021,0x8c300000,0xffffffde,0xffffffde,0xffffffff,0xffffffde,0xffffffdf,0x0000b555,0x082020c3,0x00000000,0x18e218c2,0x08600840,0x18c20820,0x00001081,0x08600020,0x00000000,0xffffdefb,0xacf3ff9d,0x18402020,0x000020a2,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x29040000,0x734d0000,0xffdfe6ba,0xffbeffbe,0x000083ef,0x004010e2,0x00000000,0x08c20000,0x00200060,0x000010a2,0x00000000,0x00001081,0x000020a2,0xffdf9451,0xffffffff,0xfffff7df,0xffffffff,0xffdeffff,0x00008c71,0x104110a2,0x08000000,0x20e30000,0x08800060,0x000018e2,0x00000000,0x00000861,0x000010a2,0xffbe8c50,0xffffffff,0xffffffde,
-0xffffffff,0x0000ad34,0x000028e3,0x000020a3,0xf75d7b8e,0xf77dffdf,0x00004228,0x10c210c2,0x94510000,0xffdfffff,0xffdfffbe,0xffdeffff,0xce38ffdf,0x10610000,0x08200800,0x10810000,0x52490800,0xfffff77d,0xffdeffff,0xffffffff,0xbdb6ffff,0x20a30800,0x08001840,0xdeba0000,0xffdfffff,0x0000a4d3,0x10c218e3,0x83cf0800,0xffffffdf,0xffffffff,0xffdfffdf,0xffffffff,
-0x00008c50,0x000018e3,0x00000000,0x00000000,0x10a118e2,0x00000000,0x52694a48,0x20c30000,0x94500000,0xffdeffde,0xffffffff,0xffffffdf,0xffdeffde,0xffffffbe,0x0000bd76,0x000020a3,0x5aeb4a28,0x00000000,0x08a110e2,0x000010c2,0x6b2c0000,0x000031c6,0x00000020,0xffdfe71b,0x1820a4b2,0x18611820,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00200000,0x00000020,0x00003145,0xde593904,0xffbeffdf,0x000083ae,0x00002144,0x8c514208,0x00000000,0x10e210c2,0x00000000,0xd6ba9492,0x0000738d,0x00002924,0xffffa4b2,0xf7beffdf,0xffffffff,0xffffffdf,0xffdeffdf,0x00008c71,0x000018e3,0x8bef4a08,0x00003145,0x00000000,0x20e30000,0x9cd2a513,0x08810000,0x000018e3,0xffdf9451,0xffdfffff,0xffffffdf,
-0xffffffff,0x7b6ef77e,0x18820000,0x20820820,0xc5960800,0xffffffdf,0x0000ad54,0x108110c2,0x10200800,0xffffde9a,0xffdfffff,0xffffffde,0x62ebef1c,0x18820000,0x10810000,0x000020e3,0x10002081,0xffdfad14,0xffffffff,0xffdfffdf,0x5249e6fb,0x20820000,0x08002082,0xffbe736d,0xde9affdf,0x080028c3,0x10810881,0xc5f70000,0xf77dff9e,0xff5df73d,0xf75dff5d,0xe6fbf75d,
-0x0000738d,0x00002103,0xce599491,0x31c69cd2,0x00400000,0xad954248,0xad54f79d,0x28e30000,0x9cb20000,0xffdfffff,0xffdeffbe,0xffbeffff,0xffdfffbe,0xff9effdf,0x08009c72,0x00002904,0xef7da4f3,0x632cbdf7,0x00200000,0x630b0000,0xf77dc5f7,0x00007bae,0x000018c2,0xa4d2bdd6,0x18610800,0x00001862,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00400020,0x20a20000,0x28420800,0xde7abd35,0x00005a49,0x000018a2,0xff7e6aec,0x630bd679,0x00000000,0xd679738d,0xffffffff,0x00008c71,0x000018c2,0xe69a6aab,0xffffffbf,0xf7beffff,0xffffffdf,0xffffffdf,0x00009cb2,0x00002944,0xff9e83ef,0x9c92e6db,0x39a62103,0xe71b9cd2,0xdebaffdf,0x00200000,0x080018a2,0xeebb838e,0xff5dff3d,0xf71cff1c,
-0xeedbeefc,0xb555ff5d,0x18a20000,0x18620000,0x39460800,0xcdf8c596,0x00009492,0x08200020,0x08001061,0xbdb6736d,0xbd75c596,0xad13ad14,0x00006b2c,0x000010a1,0x00002924,0x18410000,0x00000800,0x9c921020,0xad14ad14,0xa4d3acf3,0x00005acb,0x000020c3,0x00001041,0x94715a69,0x5a499c71,0x18610000,0x00000000,0x52690840,0x6aaa6aeb,0x62496249,0x49865a08,0x20a23924,
-0x08400000,0x000018a2,0xffffb595,0xe73bffff,0x9d139cf3,0xffffef7c,0xbdf7ffff,0x31040000,0x52690000,0xffdfd659,0xffdfffdf,0xffdeffbe,0xffbeffdf,0x83cfeefb,0x10610000,0x000020c3,0xffffb5b6,0xf7beffff,0x52caad75,0xf7beb5b6,0xf71cffdf,0x10006aaa,0x10202041,0x00000861,0x08401041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00200000,0x00200000,0x10200820,0x08002082,0x28831000,0x08001000,0x00001041,0xe6ba4186,0xff9effdf,0xc5f7bd96,0xffffffbe,0xffdeffdf,0x00008430,0x104118e3,0x39250800,0xf75db514,0xffffffdf,0xffdfffff,0xe6bbffdf,0x000062eb,0x002018c2,0xff9e738e,0xffbeffff,0xdedbe6fb,0xffffffff,0xe71cffff,0x00002924,0x00001882,0x49662021,0x622951c7,0x498651a7,
-0x49a74166,0x41664986,0x00000820,0x00000000,0x08001021,0x00000800,0x08810000,0x08400000,0x10400000,0x08000000,0x10001000,0x00000000,0x10610000,0x10810000,0x8c300000,0x0800736d,0x104020c2,0x08001000,0x08000000,0x00000000,0x18a20000,0x00200000,0x08200000,0x08000000,0x08000800,0x000018a2,0x08000800,0x00000020,0x10000800,0x10001000,0x08001000,0x08001000,
-0x00000840,0x000020c2,0xffffbdb6,0xfffeffff,0xfffffffe,0xf7beffff,0xc617ffde,0x18610000,0x00001040,0x7bae1061,0xffbed659,0xffdfffff,0xa4b2ef1c,0x00004166,0x08201041,0x000020e3,0xffffad75,0xffffffde,0xffbeffff,0xffbeffff,0x5228c5d7,0x20410800,0x08001000,0x10a20020,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x18610800,0x00001861,0x00000000,0x10810020,0x49860800,0xff7ec596,0xffffffff,0xffdfffdf,0xffffffff,0x00008c51,0x00201081,0x08001861,0x730c0800,0xff9ed659,0xff7dffbf,0x20a2b514,0x08610000,0x000018a2,0xf77e7b6e,0xffffffff,0xffffffff,0xffdfffdf,0xe6dbffdf,0x00003165,0x08201041,0x00000800,0x10000800,0x00000000,
-0x00000000,0x00000000,0x00000821,0x00200020,0x10210000,0x10a21882,0x000010a2,0x00000020,0x08200000,0x18a21041,0x10811061,0x20c220c2,0x080018a1,0x000020a2,0xf79d736d,0x2985e73c,0x10610000,0x20821041,0x20c328e3,0x20c320a3,0x00001082,0x00000000,0x00000000,0x20a21020,0x102120a3,0x00200000,0x00000020,0x08a20000,0x20821882,0x18611841,0x10401861,0x10401040,
-0x00000000,0x00000861,0xce585aaa,0xffffffde,0xffdeffff,0xffffffff,0xd679ffff,0x18c20000,0x08400820,0x00000000,0x83ef0820,0xc5b7d659,0x08005228,0x20a20800,0x10400000,0x00002103,0xffdebdd6,0xffdeffff,0xffbeffbe,0x7b0cde39,0x00000000,0x00000840,0x00000000,0x10201041,0x00200000,0x00000841,0x00210021,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00200840,0x00000000,0x00000000,0x08001861,0x838e0800,0xffdee6db,0xffdeffbe,0xffdfffde,0x0000a534,0x18a22945,0x20a30000,0x08002062,0x94101800,0x5a29bd35,0x08000800,0x084118a2,0x00002924,0xffff9c92,0xffdfffdf,0xffbeffde,0xf77dffff,0x6b2cc5d7,0x10610000,0x00000000,0x10610820,0x08400840,0x08810880,
-0x00001041,0x108110a2,0x00000000,0x00000000,0x00000000,0x08810841,0x08610020,0x10e20061,0x00000020,0x10810000,0x00000020,0x084010c2,0x18811061,0x31650800,0xffffe6fb,0xbdd6ffff,0x21030000,0x10411041,0x00000000,0x00001061,0x00000000,0x10a20040,0x10811081,0x082010a2,0x08410000,0x00000020,0x10810861,0x088110e3,0x18c21081,0x20c318a2,0x20c220e3,0x18a218c2,
-0x00000820,0x08400000,0x00000000,0xe6ba8c0f,0xffdeffde,0xffbeffde,0xef3cffff,0x00001081,0x08002904,0x18c20840,0x00000800,0x00000000,0x20c30000,0x00000820,0x00000820,0x634c0020,0xfffeef3c,0xffdfffde,0x8b6ede79,0x10002801,0x10811841,0x00000020,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10a10000,0x08001861,0xbd7530c3,0xffbeff7e,0xffffffff,0x634ce73c,0x00000000,0x000010a2,0x20c30800,0x00000820,0x00000000,0x10411861,0x00000840,0x6b6d0000,0xffffe71b,0xfffff7de,0xffdfffff,0x83aede79,0x00000000,0x00000020,0x00000000,0x18c20020,0x10a218c3,0x10a110c2,
-0x20e318a2,0x10a20861,0x086110c2,0x00200000,0x00200020,0x10a20841,0x00000840,0x00000000,0x00200840,0x00000840,0x00000020,0x00000000,0x00000000,0xc6370000,0xf7deffff,0xffdeffde,0x00008c71,0x084118e3,0x086110a2,0x00200000,0x00000000,0x00000841,0x00000000,0x00000000,0x00000020,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x10401061,0x28c20800,0xf71ca4b2,0xffffffdf,0xffdeffbe,0x62ebce58,0x08000000,0x00000800,0x18a21061,0x18c318c2,0x000018c2,0x00000000,0x21030000,0xef7d9cf2,0xffdeffdf,0x9410de79,0x08002861,0x18612081,0x00200820,0x00200000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20a20020,0x10001000,0xd639730c,0xffffffdf,0xf79effff,0x3986a513,0x08610000,0x00000000,0x10a20840,0x18a218c2,0x08200820,0x3a070000,0xf79ebdd6,0xffdeffff,0xffffffff,0xacd3f75d,0x08001821,0x18a22082,0x00200020,0x00400000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000821,0x00610000,0x00000000,0x10410000,0x39a62904,0x00200000,0x08400000,0x10610000,0x21240820,0x00202985,0xfffe9cf2,0xfffffffe,0xffffffff,0x5acbe73c,0x00000000,0x00000000,0x00000040,0x00000020,0x31c60000,0x3a074207,0x000029a6,0x00200000,0x00000820,0x630c2124,0x4a285aaa,0x632c528a,0x6b6d634d,0x7bef7bcf,0x738d7bce,
-0x00002124,0x00001061,0x10610861,0x080018a1,0x51e70800,0xf73cc5b6,0xffdfffff,0xef3cffff,0x1061a4f4,0x08400000,0x00000000,0x00200000,0x00000000,0x10810020,0x9cd20000,0xffffffff,0x9c71deba,0x10001800,0x20611000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x18411821,0x10001821,0xef1c9431,0xffdfffdf,0xde9affff,0x00003986,0x00000840,0x00000841,0x00000820,0x10810820,0xb5960000,0xffffffff,0xffdfffbe,0xcdd7ff7e,0x00005228,0x20c20800,0x18e218a1,0x00200060,0x00000060,0x83ef1861,0x842f9471,0x8c918c91,
-0x94b29491,0x8c508c70,0x420773ae,0x08410000,0x000010a2,0xce798c51,0xe6fbdedb,0xef5cdedb,0x0000a513,0x188118a2,0x52690800,0xdf1bdeba,0xdf1bdefb,0xfffff7de,0xffffffff,0xffffffff,0xe73cffff,0xd6bad6da,0x41a6c5f7,0x10810000,0x000018a2,0xdf3b94d2,0xe73ce73c,0xbdf7e71b,0x00000840,0x000018c2,0xef9d738d,0xe75cef7d,0xf7beef9d,0xf7dff7be,0xffdeffff,0xe71bffff,
-0x000041c6,0x00001081,0x10a20000,0x106110a2,0x080020a2,0x628a0800,0xff9ecdb7,0xff9effdf,0x20e4ce18,0x08200000,0x00000000,0x08610020,0x00000000,0x08200000,0x41c70000,0x9451acf4,0x00001861,0x18820000,0x00001861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18621821,0x41660800,0xff9ebd55,0xad13f75d,0x00000000,0x08411082,0x18a31882,0x00000841,0x08410000,0x41c60820,0xff7dad34,0xde59ffde,0x08007b4d,0x28e30000,0x20e31040,0x00000000,0x08810000,0x00000080,0xeefb49e7,0xf7deffff,0xfffefffe,
-0xffffffde,0xffdefffe,0xbdb6ffff,0x08600000,0x084018a2,0xffffbdb6,0xffffffff,0xffffffff,0x3165ef5c,0x18610800,0x10001000,0xffffd679,0xffffffff,0xffffffde,0xffffffff,0xffffffdf,0xffffffff,0xffffffff,0x1861d679,0x18a20800,0x5aca0000,0xffffef9d,0xfffeffff,0xe6fbffff,0x000018a2,0x000020e3,0xffff8c70,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe71bffff,
-0x080041c6,0x00000840,0x00003185,0x18c30000,0x18411882,0x080020a3,0x83ae0800,0x9450c5d7,0x00000000,0x00000820,0x10a20020,0x00000000,0x086118e3,0x00000820,0x08000800,0x08000000,0x08611061,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x630c2124,0xbdf794b2,0xf79edefb,0xffffffff,0xdefbf79e,0x94b2bdf7,0x2124630c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10210800,0x08002082,0x734d1000,0x0000630b,0x08600000,0x00000882,0x00000000,0x18a20000,0x00000000,0x00000000,0x736d0000,0x10208c30,0x18c20000,0x106118a2,0x00000841,0xb5b652aa,0x0000634c,0x000018e2,0xf75d41a6,0xffffffff,0xfffeffff,
-0xffffffff,0xffdeffff,0xc618ffff,0x18c20000,0x000020c3,0xffffad55,0xffffffde,0xffffffff,0x9492ffde,0x20c30000,0x00002103,0xffbe8bef,0xffbeffdf,0xffffffde,0xffdfffff,0xf7beffff,0xffdeffdf,0xf75dffdf,0x08006acb,0x18a220a2,0xc6380000,0xefbeffff,0xffffffde,0xe6fbffff,0x00003145,0x000028e3,0xfffe9cd2,0xffffffff,0xffffffff,0xffffffff,0xffdeffff,0xe6fafffe,
-0x00003144,0x00001061,0xce99c617,0x0000634c,0x21030000,0x18a20820,0x00001881,0x00000000,0x08610840,0x10810000,0x000018c2,0x29440000,0x00000000,0x18a210a2,0x10610000,0x20a320a3,0x08410820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21240000,0xd69a8410,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x8410d69a,0x00002124,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00001882,0x18e20000,0x10c20881,0x31c60020,0xad55ad55,0x00002103,0x08402103,0x08610000,0x000018a1,0x10610000,0x08811081,0x000018e3,0x8c710000,0xffffe73c,0x00009cf3,0x00002104,0xf73c4145,0xffffffde,0xffffffff,
-0xffffffff,0xffffffff,0xce58ffff,0x08200000,0x000020c3,0xffffad34,0xffffffff,0xffbeffde,0xd6baffff,0x00200000,0x00001061,0xacf31841,0xffdff73c,0xffbeffff,0xffdfffdf,0xffffffff,0xffdfffdf,0x8befeefb,0x20c30000,0x00001861,0xef7d4a49,0xf7beffff,0xffbeffff,0xef3cffff,0x00003986,0x000028e3,0xffffa4f3,0xffffffde,0xffffffff,0xffffffff,0xffdeffff,0xe6fbffff,
-0x10203965,0x00001881,0xffffd699,0xad55f79d,0x00003a07,0x08810000,0x10c20040,0x18e208a1,0x08610020,0x00002103,0x6b4c0000,0xe71bd699,0x5aeb9cf3,0x00000000,0x108118c2,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39c70000,0xffffad55,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xad55ffff,0x000039c7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18a20820,0x18c318e3,0x00000000,0xe73c6b8d,0xffdeffff,0x738ddefb,0x00000000,0x084018e3,0x18820000,0x000020c3,0x00001081,0x39e70000,0xffffc638,0xffdfffff,0x0000a4f4,0x000028e4,0xf6fc38c4,0xffdfffdf,0xffffffff,
-0xffffffff,0xffdfffff,0xce59ffff,0x08410000,0x00002104,0xffffa4f3,0xffdeffff,0xfffffffe,0xc618ffbe,0x00002124,0x08610861,0x00000000,0xcdb75a49,0xffdfff7e,0xffdfffdf,0xffffffdf,0xbd96ff9e,0x00003124,0x000018c2,0x08001020,0xad343165,0xfffff73d,0xffbeffde,0xef3cffff,0x00003966,0x000028e4,0xffffa513,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe6dbffff,
-0x00003103,0x000020a2,0xffffdeba,0xffffffff,0xa534ef5c,0x00200000,0x00000061,0x00000040,0x00001103,0x42270020,0xf7beb5d6,0xffffffff,0xef5cffff,0x52cac617,0x00000040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18e30000,0xffffa514,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xa514ffff,0x000018e3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0xb5b631a6,0xfffff7de,0xffffffff,0xf79effff,0x10e3ad96,0x10a20000,0x00000840,0x18610000,0x21030000,0xef7d9cf3,0xffdfffff,0xffffffbe,0x00009472,0x080028e4,0xe69a2842,0xffdfffff,0xffffffff,
-0xffffffff,0xffffffff,0xc658ffff,0x10a20000,0x000020e3,0xffff9cb2,0xffffffff,0xd699ff9d,0x000083ef,0x10810000,0x00000000,0x20c20840,0x10000000,0xde598b8e,0xffdfffbe,0xd69affff,0x08007b8e,0x18a20000,0x08400040,0x08000820,0x00000000,0xde5972ec,0xffffffbe,0xe6fbffdf,0x00003145,0x000020e3,0xffff9cd2,0xffffffde,0xffffffff,0xffffffff,0xffdfffdf,0xdebaffff,
-0x000028e3,0x00001020,0xffffdeda,0xffbeffde,0xffffffff,0x632bd699,0x00810000,0x00a20040,0x29a50000,0xef7da533,0xffffffff,0xfffffffe,0xffffffff,0xef7dffff,0x62ebad75,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf79e630c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x630cf79e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x9cb22904,0xffffef3c,0xf7beffff,0xffffffff,0xfffff7de,0xd6daffff,0x00007bef,0x08200000,0x08002082,0xe6db3946,0xf7feffff,0xffffffff,0xffffffdf,0x0000a4f3,0x08002103,0xe69a2021,0xffffffff,0xffffffff,
-0xffdeffff,0xffffffff,0xce38ffff,0x10610000,0x080020c3,0xffdf9c71,0xe6baffdf,0x08009430,0x10a20000,0x00200840,0x20c320e3,0x00001061,0x104110a2,0x10000800,0xcdf79c51,0x10219472,0x10410000,0x10611841,0x00001081,0x104110a2,0x18820820,0x20211000,0xf73cb514,0xe6fbffff,0x000028e4,0x000020e3,0xffff9cb2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd6baffff,
-0x18411020,0x00001040,0xffdfe6fb,0xffdfffbe,0xffdfffbe,0xbdb6ffff,0x18c30000,0x00001082,0xdf1b73ad,0xf7ffffff,0xfffff7fe,0xffffffde,0xffbeffff,0xffdfffbe,0xbd96ffbe,0x18a20000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x94b20000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x000094b2,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001841,0xeefc62cb,0xffbeffdf,0xffdfffbe,0xffffffde,0xf7deffff,0xffffffff,0xbdd7ffdf,0x00000000,0x10001021,0xeedb3083,0xf7deffff,0xf7deffff,0xffffffff,0x00009cf3,0x00001924,0xde9a0800,0xffdfffdf,0xffffffdf,
-0xffffffff,0xffdfffff,0xc618ffff,0x10610000,0x000020c3,0xce38736d,0x28a29430,0x18410800,0x000020c2,0x000018c2,0x00000000,0x10810800,0x00200000,0x18611882,0x08000800,0x10410000,0x002010a2,0x00000820,0x21030000,0x00000000,0x000018e3,0x182120a2,0x52080800,0xcdf8c5b7,0x000020c3,0x000020c3,0xffde9cb2,0xffdfffff,0xffffffff,0xffdfffff,0xffdfffde,0xd699ffff,
-0x00000820,0x00001061,0xffffdeda,0xffffffdf,0xffdfffff,0x5aaaf75c,0x18820800,0x20830000,0xffffe69a,0xffffffbe,0xf7def7de,0xfffeffff,0xffbeffdf,0xff5dffdf,0x4145acb3,0x08200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0xffffb5b6,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb5b6ffff,0x00000020,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18620800,0x49c70800,0xffbecdf7,0xffdfffbf,0xffffffde,0xffffffff,0xffdfffde,0xffffffdf,0x00008c50,0x206228e4,0xa4721000,0xffffffff,0xffdeffde,0xffffffff,0x0000a534,0x00001923,0xe6db1020,0xffffffff,0xffffffff,
-0xffffffff,0xffffffdf,0xbdf7ffff,0x10c20000,0x08410000,0x08000000,0x00000000,0x10201862,0x20c21881,0x29240800,0x73ae9d13,0x00000000,0x08001061,0x08200000,0x18a218c2,0x100020a2,0x08610000,0x00000000,0xe71c8c71,0x0000b596,0x21030000,0x00201081,0x080020c2,0x28c30800,0x00001841,0x000020e3,0xffde9450,0xffffffdf,0xffdfffff,0xffdfffdf,0xffbeffdf,0xcdb7ffbf,
-0x10810000,0x00001041,0xffffdeba,0xffbeffde,0xff9effde,0x00009c92,0x20a31862,0x838e0000,0xfe9bfefc,0xffdeff3d,0xffffffde,0xfffff7de,0xffbeffdf,0x7aece659,0x08000800,0x00001881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xbdf70020,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0020bdf7,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x100020a3,0x94301800,0xffdfeeba,0xffdfffff,0xffdeffde,0xffdfffff,0xffdfff9e,0x0000d699,0x20a30000,0x39250800,0xffdfe6ba,0xffbeff9e,0xffbef77d,0x00009471,0x000010e2,0xde592061,0xffbeffde,0xff9df77d,
-0xf77df77d,0xf77dff9e,0xa513ef5c,0x10a20000,0x00000041,0x00000000,0x084118a2,0x20e30840,0x00000000,0xe6fb738e,0xf7beffff,0x6b2cd679,0x18820000,0x00400000,0x00000000,0x08000800,0x00201061,0xb5b60020,0xffffffdf,0xd699ffde,0x0000736d,0x10c10040,0x20c20020,0x08001020,0x08410000,0x00001041,0x9c925248,0xa4b2a4b2,0xa4b29c92,0xb514a4b3,0xa451acb3,0x628a9bf0,
-0x08200000,0x00000820,0x9c91736d,0x8c0f9451,0x734c83ef,0x08000800,0x10211000,0x41660800,0x486369e9,0xd5d759a7,0xff9effdf,0xffffffdf,0xa492f73c,0x10002841,0x080028c3,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffb5b6,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb5b6ffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20820800,0x10002061,0xb4d338a3,0xffffff7d,0xffdfffde,0x8bcfde7a,0x83cf7b2d,0x18e37bae,0x08400000,0x08001041,0x838e72eb,0x7b2d8b6e,0x628a6aab,0x00003945,0x00000840,0x6aaa1000,0x730c730c,0x6acb730c,
-0x5a486aaa,0x52085a28,0x20c349c7,0x00000000,0x00000000,0x10820841,0x10a20841,0x00001062,0xbdd639e6,0xfffff7de,0xffbfffff,0x734de69a,0x10810000,0x00000020,0x10a210e2,0x00000000,0x10610800,0x8c710000,0xffffef3c,0xffffffde,0xad34f7be,0x00000000,0x084018c2,0x08600040,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x08000800,
-0x00000840,0x08200000,0x00000000,0x00000000,0x00000000,0x00201040,0x00000000,0x00000000,0x08000000,0x08000000,0xffbfc576,0xd5d7ffbf,0x18006249,0x20a21861,0x08200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x94b20000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x000094b2,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x28821861,0x20001800,0xde797b2c,0xde79ffbe,0x18003904,0x08001000,0x00000000,0x00000040,0x10200020,0x10000800,0x10001000,0x08001000,0x00000800,0x08200000,0x10000800,0x08000800,0x10001000,
-0x20001000,0x08001000,0x00000800,0x00000800,0x00000000,0x08410000,0x000018c3,0x94710000,0xffffdf1b,0xffdfffff,0x9410e6bb,0x00001821,0x00001081,0x10e20881,0x00000000,0x08402103,0x08200000,0x00001041,0xde9a5a8a,0xf7deffff,0xffffffff,0x632bd6ba,0x00000020,0x004008c1,0x00200000,0x00000000,0x18e31061,0x210318a2,0x10812103,0x18a22103,0x20e318a2,0x102020c3,
-0x00000000,0x00200000,0x20e31061,0x18812103,0x10a120e3,0x00200020,0x00000000,0x00200000,0x08810080,0x000010c2,0xb4f32041,0x2000a431,0x28c30800,0x00000800,0x00000820,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff630c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x630cffff,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200000,0x28a22041,0x20620800,0x62ab9c71,0x28a30800,0x184128a3,0x002020a2,0x00000020,0x00000000,0x20a21861,0x20622882,0x18412062,0x00000800,0x00000000,0x18410800,0x10601881,0x20a21861,
-0x18202061,0x18611861,0x08400820,0x00000000,0x00000020,0x000010a2,0x52aa0000,0xffffc617,0xf7deffff,0xf75dffde,0x00006b0c,0x10611061,0x20e30800,0x00000000,0x738d630b,0x00200000,0x104120e3,0x20c20820,0x41e70800,0xffffef3c,0xffdeffff,0xef9dffff,0x0881ad54,0x18e20000,0x000008a2,0x00000000,0x00000020,0x00000000,0x00400000,0x00200000,0x00001061,0x08200000,
-0x00200000,0x00000000,0x00000840,0x00000000,0x00200000,0x08610000,0x18c20881,0x002018c2,0x00000000,0x10810000,0x00000000,0x08400000,0x000020c2,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18e30000,0xfffff79e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf79effff,0x000018e3,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000800,0x00000000,0x182120a3,0x10000800,0x08001861,0x00000000,0x18a20000,0x18c21081,0x00000881,0x00000000,0x00000000,0x18611862,0x18c218c2,0x00200040,0x08000000,0x08400000,0x20c21060,
-0x18811881,0x20c220c2,0x10a11081,0x00000000,0x10c20000,0x41e70000,0xef5cb555,0xffbeffff,0xffbeffde,0xdebaffff,0x18c20000,0x000010a2,0x00001041,0x9cd20000,0xf7bef79d,0x3a07bdf7,0x10610000,0x10610820,0x000018c2,0xffdfd679,0xffdeffbe,0xffffffde,0xdedaffdf,0x00007bef,0x08810000,0x00000000,0x08410840,0x18c218c3,0x10c218e2,0x18c210c2,0x00200861,0x00000000,
-0x00000040,0x18c21081,0x18a218c3,0x00000000,0x00000000,0x00000861,0x00000000,0x00000000,0x00000841,0x00000000,0x10c20060,0x00601924,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xa5140000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000a514,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x08000000,0x104120a2,0x00000000,0x00200000,0x00000000,0x00000000,0x08810000,0x00200000,0x00200000,0x00000000,0x00000000,0x00600000,0x00000000,0x00000020,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00200040,0x000010a1,0xf75c83ef,0xffdfffff,0xf71cf71c,0xffdeffde,0xce58ffff,0x18e20020,0x08600020,0x7bcf0000,0xffdededa,0xffffffde,0xef5cffff,0x00008430,0x08600000,0x00001102,0xffffce38,0xffdfffde,0xf73cff5d,0xffdfffdf,0xc617f7be,0x0000528a,0x00200841,0x00000000,0x00000000,0x00000000,0x00000020,0x00400000,0x00000020,
-0x08810000,0x00200000,0x00000000,0x00000841,0x08410000,0x00000000,0x736d736d,0x52488bef,0x00200000,0x00200020,0x00000020,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff39c7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x39c7ffff,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x08000000,0x00000800,0x00000040,0x00000061,0x83cf3165,0x7b8e83cf,0x00005269,0x00410081,0x00200000,0x736d5aab,0x94928410,0x000031c7,0x00001081,0x08810000,0x8c71842f,
-0x94b28430,0x8c7194d2,0x5b0b94d2,0x08610000,0x000018e3,0xffdfbd75,0xde79ff9e,0x4145836d,0xf77dc596,0xbdd6ffff,0x20e30000,0x00000820,0xffdeb575,0xffffffff,0xffdfffde,0xffffffff,0xbdd7ffde,0x000018e2,0x000010e1,0xffdfd679,0xde79ff9e,0x626a836e,0xffbecdd7,0xffffffde,0x0000bdb6,0x000020e3,0x8c7141c7,0xad759cd3,0xa574b5b6,0xb5b6ad75,0x000073ce,0x00000881,
-0x000010e2,0xbdf7738d,0x8c30c5f7,0x10620000,0x18c30000,0xa4d30000,0xff7dffbe,0x5a89c5b6,0x10a20000,0x00000000,0x08000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffad55,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xad55ffff,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0xbdb641e7,0xffffff9d,0x0000deba,0x08810000,0x08000841,0xffbece18,0xffdfffbe,0x0020ad75,0x004010c2,0x00000860,0xffdfce18,
-0xf7deffff,0xffffffff,0xbdf7ffff,0x08810000,0x000010a2,0xde79acf4,0x18009410,0x08000800,0x83ae0800,0xad13e6db,0x28a20800,0x20a20000,0xffffdedb,0xffffffde,0xffffffdf,0xffdeffff,0xef3cffdf,0x000039a5,0x000018e1,0xf71cde99,0x20829c71,0x00000000,0x83ae1020,0xffdfde38,0x0000bd96,0x00002924,0xffde9cb2,0xffffffff,0xffffffff,0xf79effff,0x000073ae,0x106118a2,
-0x00000000,0xffffd6ba,0xad55ffff,0x18e30000,0x08001061,0xef1c3125,0x8bcfe6da,0x00002040,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21240000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00002124,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x00000000,0xd658736d,0xb554ffdf,0x19030000,0x000010a2,0xffbf8c10,0xffffffff,0x73adffde,0x10c10000,0x000010a1,0xf75d62aa,
-0xffffffff,0xffdfffff,0xc618ffff,0x18c20000,0x00001061,0x20214166,0x10200000,0x106118a1,0x00001861,0x4a083124,0x18200800,0x20620800,0xffdfdebb,0xffffffff,0xffffffff,0xffffffff,0xe6daffff,0x00003984,0x00001880,0x5a28730b,0x18210800,0x10a220c3,0x08001040,0x9c302820,0x00007b4d,0x00002124,0xffff9cd2,0xf7beffff,0xffbeffff,0xad34ffff,0x18c20000,0x21030000,
-0xa5130000,0xffdeffde,0x41c6ef1c,0x08400000,0x00000841,0x94105a49,0x08002862,0x10400800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x84100000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00008410,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x10401040,0x08000800,0x9cb28c30,0x00000000,0x08001082,0xde9a2062,0xffdeffbe,0xdedaffff,0x00201902,0x20a10820,0xbd750800,
-0xffffffbe,0xffffffde,0xd69affff,0x00000000,0x08200840,0x08000000,0x08a110a2,0x08601923,0x18810840,0x00000000,0x18611881,0x41a60800,0xffffe6db,0xffdfffff,0xffffffff,0xffffffff,0xe6baffdf,0x00003964,0x18201840,0x00000000,0x080020c2,0x10401040,0x20c20800,0x00001840,0x08200000,0x00002103,0xffde9cd2,0xffffffdf,0xffdfffdf,0x3124ef1c,0x18c20000,0x000018c2,
-0xe73c4a48,0xffdfffff,0x0000d679,0x00400861,0x00200000,0x00000800,0x20c20000,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd69a0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000d69a,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x080020e3,0x00000000,0x00000882,0x18820000,0xb5550800,0xffdeffff,0xffffffde,0x0000a513,0x102028e3,0x49e70000,
-0xffdfef1c,0xffdeffff,0xd679ffff,0x00200000,0x00200000,0x10610800,0x000010e3,0x00000000,0x004008a1,0x18a20881,0x18a20000,0x39650000,0xffdfe6db,0xffffffbf,0xffffffff,0xffdfffff,0xe6baffff,0x00001840,0x10201000,0x18c21082,0x18a20840,0x00000800,0x002018a1,0x18e30020,0x000010a2,0x002008a2,0xffff9491,0xffbeffdf,0xff9effdf,0x0800a492,0x000020e3,0x00002124,
-0xffffb5b6,0xffffffde,0x0820de9a,0x08610000,0x00200000,0x18820000,0x00001861,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff2124,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2124ffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x00000000,0x08200000,0x188220e3,0x00000000,0x20c30000,0xc5f70000,0xffdeffff,0xffffffde,0x62ebf77d,0x20a20800,0x00002103,
-0xff9ea492,0xf75dffbf,0x5249b555,0x00400000,0x00600020,0x20a20000,0x10810000,0x000073ae,0x19030000,0x00001061,0x00000840,0x08001061,0xe67a836e,0xffdfffdf,0xffdfffdf,0xffffffff,0x8befeefb,0x10610000,0x00210841,0x10820000,0x000018a2,0x28e30000,0x00200000,0x004008e3,0x00000020,0x00000881,0xb5342903,0xffdff75d,0xe69affbf,0x10003083,0x18e31041,0x7bce0000,
-0xffdff79d,0xffdfffde,0x20c2d679,0x08410000,0x00000000,0x00000000,0x08200000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff630c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x630cffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x08200000,0x83cf0800,0xffbedeba,0xff9effff,0xde9affff,0x08201881,0x08000820,
-0xc5962020,0x6249c596,0x00001000,0x00400040,0x00200000,0x000018e3,0xd69a5aaa,0xd6baf79e,0x00007bef,0x18e30000,0x00000000,0x10000020,0x30621800,0xeefcb4d3,0xffffffbf,0xad14f75d,0x00004185,0x08211861,0x00000000,0x000018c4,0x736d0000,0xdedace58,0x000094b2,0x08a20000,0x00200000,0x00200000,0x08000000,0xce185a49,0x836ee6bb,0x20621000,0x00000820,0xdefb10c2,
-0xffdfffff,0xacf3eefb,0x00005228,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff94b2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x94b2ffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x00000840,0x8bef2082,0xffffe69a,0xffffffdf,0x000094b2,0x08002903,
-0x10200000,0x08000000,0x10402061,0x00400040,0x008100a1,0x7bae0000,0xffffef5c,0xffffffff,0xc5f7ff9e,0x00004a69,0x00000861,0x08000000,0x00002081,0x49661000,0xc575bd55,0x00005a49,0x10810000,0x00000820,0x08820041,0x41e70000,0xf7beb575,0xffffffff,0xd6baf7be,0x000083f0,0x00000820,0x00000840,0x29030800,0x10200000,0x000028e3,0x00002883,0x000020a2,0xffff9cb2,
-0xa4b2f73c,0x08004166,0x18210800,0x00000000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffbdf7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xbdf7ffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18c20020,0x08001020,0xacd33924,0xffffde9a,0x6b4cf79d,0x18a10000,
-0x08800840,0x104018a2,0x10202082,0x00000000,0x000008c2,0xff9e83ef,0xffdeffff,0xfffff7de,0xffdfffff,0x8c91ef7d,0x10a20000,0x00000000,0x10400000,0x08002082,0x10001000,0x20c20800,0x00201061,0x00000000,0x00000882,0xef3c9471,0xffffffff,0xf7fff7fe,0xffffffff,0xad35ffbf,0x18820000,0x00000000,0x08000000,0x106118a2,0x10410820,0x18420800,0x00000820,0xbd75bd96,
-0x08005a69,0x28c30800,0x00002062,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffdefb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdefbffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20c21061,0x00000000,0x8c102882,0xad34d638,0x10c10000,
-0x00000020,0x10a118c2,0x00000000,0x00001041,0x080018a2,0xffffb555,0xffffffdf,0xffffffff,0xffffffdf,0xdedaffff,0x00400000,0x00200840,0x004010a1,0x10400020,0x28e31881,0x00001861,0x10a21081,0x00600000,0x00200000,0xffffdeda,0xffdfffdf,0xffffffdf,0xffdeffff,0xde9affff,0x08210800,0x00000820,0x108118a2,0x08600840,0x08400861,0x00000000,0x10410800,0x08001020,
-0x18820000,0x080020a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfffff79e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf79effff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x20c31040,0x08001000,0x31440800,0x00000881,
-0x08400000,0x00000000,0x4a081862,0x10410000,0x000020c3,0xffffbd96,0xffffffbe,0xffffffdf,0xffdeffff,0xdedbffff,0x00000840,0x00000840,0x00400000,0x002010a1,0x00200000,0x20e31040,0x00000000,0x00600881,0x18a10000,0xffffe6fb,0xffffffbe,0xffffffff,0xffdeffff,0xde9affff,0x00001000,0x00201081,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x18411000,
-0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x28e31020,0x00001061,0x00000000,
-0x00000840,0xa5144207,0xb575ef5d,0x10a20000,0x000010c2,0xffffb595,0xffdfffff,0xffffffff,0xffffffde,0xe71bffff,0x000039a6,0x31650000,0x0000630b,0x10e20000,0x10c20880,0x00000000,0x7b6e62cb,0x10810000,0x21020000,0xffffe6fb,0xffffffbe,0xffdeffbf,0xfffeffff,0xd658ffff,0x08410000,0x00000020,0x83ef9492,0x000018a2,0x00000020,0x00000000,0x00000000,0x08200000,
-0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x00200020,0x00000000,
-0x00000020,0xbdf75289,0xe6dbffbe,0x08810000,0x00001903,0xffffb596,0xffdeffde,0xf7deffff,0xf7beffff,0xef1cffff,0x000041a6,0x5aaa0800,0xce38ef5d,0x00005aca,0x00000000,0xad752964,0xde7affbf,0x08400000,0x18a00000,0xffdee6da,0xffbeffbe,0xffffffdf,0xffdef7de,0xd658ffff,0x10a20000,0x00000041,0xef5ce71b,0x00007bae,0x00000861,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfffff79e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf79effff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00200020,0x00000000,0x9c516acb,0x00002082,0x000018c2,0xef3c83cf,0xffffffdf,0xffffffde,0xffdeffde,0xd618ffdf,0x20a20800,0x52480800,0xfffff75d,0xa534ef5d,0x8c710000,0xffdfdefb,0xdebbffdf,0x080020a2,0x08001020,0xeedb8bae,0xffffffdf,0xf7fff7de,0xffffffff,0x9451f73c,0x18e40000,0x00000000,0x8c109cb2,0x00001882,0x00000020,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffdefb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdefbffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,
-0x00000000,0x20a31041,0x08001000,0x08000800,0x20a20000,0x51c70800,0xf77dbd75,0xffdfffde,0xe6dbffdf,0x20419c51,0x18810800,0x39a60000,0xffffdeba,0xffdfffdf,0xf7deef5c,0xffdfffdf,0xd69affff,0x08001881,0x10201861,0x41241000,0xf77dbd55,0xfffeffff,0xc5d7ffde,0x0800628a,0x00201061,0x00000000,0x00000800,0x08400000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffbdf7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xbdf7ffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x20621841,0x00000000,0x00000000,0x08001861,0x6aeb0800,0xeedbcdd7,0x3924bd35,0x08000800,0x10810820,0x00001061,0xffffdeda,0xffffffff,0xffffffff,0xffffffdf,0xe6fbffff,0x000039c6,0x00001081,0x080020c2,0x838d1800,0xe699de59,0x18008bce,0x20830800,0x00200000,0x00000000,0x18412082,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff94b2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x94b2ffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20810000,0x08002082,0x28621800,0x08001000,0x084020a2,0x21231081,0x7bce0000,0xfffff7be,0xffffffff,0xffffffff,0xffffffff,0xf77dffff,0x000052ca,0x00202124,0x10810020,0x10001840,0x28412840,0x18201000,0x000020a2,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff630c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x630cffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10810800,0x08001861,0x08611861,0x08610000,0x00000000,0xef5c738e,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0xffffffde,0x4a69d679,0x10810000,0x00000840,0x10810820,0x10201041,0x08201861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff2124,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2124ffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x00200841,0x08410841,0x00001082,0xc618632c,0xfffff79e,0xfffff7be,0xffdfffff,0xffffffff,0xffffffff,0xffffffde,0xef5cffff,0x0000840f,0x00201081,0x00410020,0x00200020,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd69a0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000d69a,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001841,0xef1b9431,0xffdfffff,0xffdeffdf,0xffffffff,0xffffffde,0xffffffff,0xffdfffde,0xffffffdf,0x8c50ffff,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x84100000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00008410,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18410800,0x39650000,0xcdf783ae,0xffdfff7d,0xffdfffdf,0xffdfffdf,0xffffffdf,0xffffffff,0xdebaff9e,0x6b2cad34,0x10610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21240000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00002124,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000020a2,0x18000800,0xbd356aeb,0xff7eeefb,0xffdfffbf,0xff3dffbf,0xb514de59,0x18417b8e,0x00000000,0x00001062,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffad55,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xad55ffff,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x20a20000,0x208128e3,0x10000800,0x9c314125,0xde39de18,0x7aecb4f4,0x08002861,0x10200800,0x186220a2,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff39c7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x39c7ffff,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x20c320c2,0x00000000,0x08000800,0x00000800,0x28a21020,0x186120a3,0x00000800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xa5140000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000a514,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x08400000,0x21031081,0x10a218e3,0x18822103,0x10001041,0x00000800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18e30000,0xfffff79e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf79effff,0x000018e3,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08000800,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff630c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x630cffff,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x94b20000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x000094b2,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffb5b6,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb5b6ffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xbdf70020,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0020bdf7,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0xffffb5b6,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb5b6ffff,0x00000020,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x94b20000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x000094b2,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf79e630c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x630cf79e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18e30000,0xffffa514,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xa514ffff,0x000018e3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39c70000,0xffffad55,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xad55ffff,0x000039c7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21240000,0xd69a8410,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x8410d69a,0x00002124,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x630c2124,0xbdf794b2,0xf79edefb,0xffffffff,0xdefbf79e,0x94b2bdf7,0x2124630c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0 };
@@ -1,7 +1,17 @@
 #import "GLView.h"
+#include "../../Common/Classes/Profiler.hpp"
+#import <string>
 
 #define GL_RENDERBUFFER 0x8d41
 
+std::string GetResourcePath(const std::string& file)
+{
+    NSString* basePath = [NSString stringWithUTF8String:file.c_str()];
+    NSString* resourcePath = [[NSBundle mainBundle] resourcePath];
+    NSString* fullPath = [resourcePath stringByAppendingPathComponent:basePath];
+    return [fullPath UTF8String];
+}
+
 @implementation GLView
 
 + (Class) layerClass
@@ -70,6 +80,7 @@
     
     m_applicationEngine->Render();
     [m_context presentRenderbuffer:GL_RENDERBUFFER];
+    PROFILE_FRAME();
 }
 
 - (void) touchesBegan: (NSSet*) touches withEvent: (UIEvent*) event
@@ -3,10 +3,12 @@
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
 #include "Matrix.hpp"
-#include "../Textures/DistanceField.h"
-#include "../Textures/Tile.h"
-#include "../Textures/Text.h"
-#include "../Textures/SmallAum.h"
+#include "../../Common/Classes/AssetPack.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include "../../Common/Classes/PvrUpload.hpp"
+#include <string>
+
+std::string GetResourcePath(const std::string& file);
 
 using namespace std;
 
@@ -26,36 +28,6 @@ const vec3 CameraPositions[] = {
 const int NumCameraPositions = sizeof(CameraPositions) / sizeof(vec3);
 const float CameraSpeed = 5;
 
-struct PVRTextureHeader {
-    unsigned int HeaderSize;
-    unsigned int Height;
-    unsigned int Width;
-    unsigned int MipMapCount;
-    unsigned int Flags;
-    unsigned int TextureDataSize;
-    unsigned int BitCount;
-    unsigned int RBitMask;
-    unsigned int GBitMask;
-    unsigned int BBitMask;
-    unsigned int AlphaBitMask;
-    unsigned int PVR;
-    unsigned int NumSurfs;
-};
-
-enum PVRPixelType {
-    OGL_RGBA_4444 = 0x10,
-    OGL_RGBA_5551,
-    OGL_RGBA_8888,
-    OGL_RGB_565,
-    OGL_RGB_555,
-    OGL_RGB_888,
-    OGL_I_8,
-    OGL_AI_88,
-    OGL_PVRTC2,
-    OGL_PVRTC4,
-    PVRTEX_PIXELTYPE = 0xff,
-};
-
 enum DemoState {
     DemoStateAlphaBlended,
     DemoStateAlphaTested,
@@ -96,7 +68,8 @@ public:
     void Initialize();
     void Render(float timestamp) const;
 private:
-    GLuint CreateTexture(const unsigned long* data);
+    GLuint LoadTexture(const char* name);
+    GLuint CreateTexture(const void* data, size_t size);
     Drawable CreateDrawable(const ParametricSurface& surface);
     void RenderDrawable(const Drawable& drawable) const;
     Textures m_textures;
@@ -104,6 +77,7 @@ private:
     Framebuffers m_framebuffers;
     Drawables m_drawables;
     ivec2 m_screenSize;
+    AssetPack m_assets;
 };
 
 IRenderingEngine* CreateRenderingEngine()
@@ -124,11 +98,15 @@ void RenderingEngine::Initialize()
     m_drawables.Square = CreateDrawable(Quad(3, 3));
     m_drawables.Label = CreateDrawable(Quad(0.75f, 0.125f));
     
-    // Load up some textures.
-    m_textures.DistanceField = CreateTexture(DistanceField);
-    m_textures.SmallAum = CreateTexture(SmallAum);
-    m_textures.Tile = CreateTexture(Tile);
-    m_textures.Text = CreateTexture(Text);
+    // Load up some textures.  The pack stays mapped, but once GL has a copy
+    // of each texture its pages can go.
+    string packPath = GetResourcePath("Textures.pack");
+    if (m_assets.Open(packPath.c_str()) != AssetPackErrorNone)
+        printf("%s: %s.\n", packPath.c_str(), AssetPack::GetErrorString(m_assets.GetError()));
+    m_textures.DistanceField = LoadTexture("DistanceField");
+    m_textures.SmallAum = LoadTexture("SmallAum");
+    m_textures.Tile = LoadTexture("Tile");
+    m_textures.Text = LoadTexture("Text");
 
     // Extract width and height from the color buffer.
     glGetRenderbufferParameterivOES(GL_RENDERBUFFER_OES,
@@ -164,6 +142,7 @@ void RenderingEngine::Initialize()
     
 void RenderingEngine::Render(float timestamp) const
 {
+    PROFILE_ZONE("ES1::RenderingEngine::Render");
     if (false) {
         int desiredState = 0;
         float desiredSegment = 5.5 + desiredState * NumCameraPositions;
@@ -238,41 +217,27 @@ void RenderingEngine::Render(float timestamp) const
     glMatrixMode(GL_MODELVIEW);
 }
 
-GLuint RenderingEngine::CreateTexture(const unsigned long* data)
+GLuint RenderingEngine::LoadTexture(const char* name)
 {
-    PVRTextureHeader* header = (PVRTextureHeader*) data;
-    GLsizei w = header->Width;
-    GLsizei h = header->Height;
-    const unsigned long* texels = data + header->HeaderSize / 4;
+    AssetEntry entry = m_assets.Find(name);
+    GLuint texture = CreateTexture(entry.Data, entry.Size);
+    m_assets.Release(entry);
+    return texture;
+}
+
+GLuint RenderingEngine::CreateTexture(const void* data, size_t size)
+{
+    PvrTexture texture;
+    texture.Parse(data, size);
+    assert(texture.IsValid() && "Bad texture.");
 
     GLuint name;
     glGenTextures(1, &name);
     glBindTexture(GL_TEXTURE_2D, name);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    
-    switch (header->Flags & PVRTEX_PIXELTYPE) {
-        case OGL_I_8: {
-            GLenum format = GL_ALPHA;
-            GLenum type = GL_UNSIGNED_BYTE;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_RGB_565: {
-            GLenum format = GL_RGB;
-            GLenum type = GL_UNSIGNED_SHORT_5_6_5;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_PVRTC4: {
-            GLsizei size = max(32, w * h / 2);
-            GLenum format = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG;
-            glCompressedTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, size, data);
-            break;
-        }
-        default:
-            printf("Unknown format.\n");
-    }
+    if (!UploadPvrTexture(texture))
+        printf("Unknown format.\n");
 
     return name;
 }
@@ -4,16 +4,16 @@
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
 #include "Matrix.hpp"
-#include "../Textures/DistanceField.h"
-#include "../Textures/Tile.h"
-#include "../Textures/Text.h"
-#include "../Textures/SmallAum.h"
-#include "../Textures/SmallText.h"
+#include "../../Common/Classes/AssetPack.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include "../../Common/Classes/PvrUpload.hpp"
 
 #define STRINGIFY(A)  #A
 #include "../Shaders/SimpleTexturing.es2.vert"
 #include "../Shaders/SimpleTexturing.es2.frag"
 
+std::string GetResourcePath(const std::string& file);
+
 using namespace std;
 
 namespace ES2 {
@@ -32,36 +32,6 @@ const vec3 CameraPositions[] = {
 const int NumCameraPositions = sizeof(CameraPositions) / sizeof(vec3);
 const float CameraSpeed = 5;
 
-struct PVRTextureHeader {
-    unsigned int HeaderSize;
-    unsigned int Height;
-    unsigned int Width;
-    unsigned int MipMapCount;
-    unsigned int Flags;
-    unsigned int TextureDataSize;
-    unsigned int BitCount;
-    unsigned int RBitMask;
-    unsigned int GBitMask;
-    unsigned int BBitMask;
-    unsigned int AlphaBitMask;
-    unsigned int PVR;
-    unsigned int NumSurfs;
-};
-
-enum PVRPixelType {
-    OGL_RGBA_4444 = 0x10,
-    OGL_RGBA_5551,
-    OGL_RGBA_8888,
-    OGL_RGB_565,
-    OGL_RGB_555,
-    OGL_RGB_888,
-    OGL_I_8,
-    OGL_AI_88,
-    OGL_PVRTC2,
-    OGL_PVRTC4,
-    PVRTEX_PIXELTYPE = 0xff,
-};
-
 enum DemoState {
     DemoStateAlphaBlended,
     DemoStateAlphaTested,
@@ -90,6 +60,7 @@ struct UniformHandles {
     GLuint GlowOffset;
     GLuint GlyphColor;
     GLuint Shadow;
+    GLuint Median;
 };
 
 struct AttributeHandles {
@@ -132,7 +103,8 @@ public:
     void Initialize();
     void Render(float timestamp) const;
 private:
-    GLuint CreateTexture(const unsigned long* data);
+    GLuint LoadTexture(const char* name);
+    GLuint CreateTexture(const void* data, size_t size);
     Drawable CreateDrawable(const ParametricSurface& surface);
     void RenderDrawable(const Drawable& drawable) const;
     GLuint BuildShader(const char* source, GLenum shaderType) const;
@@ -144,6 +116,7 @@ private:
     AttributeHandles m_attributes;
     UniformHandles m_uniforms;
     ivec2 m_screenSize;
+    AssetPack m_assets;
 };
 
 IRenderingEngine* CreateRenderingEngine()
@@ -182,12 +155,16 @@ void RenderingEngine::Initialize()
     m_drawables.Label = CreateDrawable(Quad(0.75f, 0.125f));
     m_drawables.SmallLabel = CreateDrawable(Quad(0.5f, 0.0625f));
     
-    // Load up some textures.
-    m_textures.DistanceField = CreateTexture(DistanceField);
-    m_textures.SmallAum = CreateTexture(SmallAum);
-    m_textures.Tile = CreateTexture(Tile);
-    m_textures.Text = CreateTexture(Text);
-    m_textures.SmallText = CreateTexture(SmallText);
+    // Load up some textures.  The pack stays mapped, but once GL has a copy
+    // of each texture its pages can go.
+    string packPath = GetResourcePath("Textures.pack");
+    if (m_assets.Open(packPath.c_str()) != AssetPackErrorNone)
+        cout << packPath << ": " << AssetPack::GetErrorString(m_assets.GetError()) << ".\n";
+    m_textures.DistanceField = LoadTexture("DistanceField");
+    m_textures.SmallAum = LoadTexture("SmallAum");
+    m_textures.Tile = LoadTexture("Tile");
+    m_textures.Text = LoadTexture("TextMsdf");
+    m_textures.SmallText = LoadTexture("SmallTextMsdf");
 
     // Extract width and height from the color buffer.
     glGetRenderbufferParameteriv(GL_RENDERBUFFER,
@@ -226,6 +203,7 @@ void RenderingEngine::Initialize()
     m_uniforms.GlowOffset = glGetUniformLocation(program, "GlowOffset");
     m_uniforms.Shadow = glGetUniformLocation(program, "Shadow");
     m_uniforms.GlyphColor = glGetUniformLocation(program, "GlyphColor");
+    m_uniforms.Median = glGetUniformLocation(program, "Median");
     
 	// Set the active sampler to stage 0.  Not really necessary since the uniform
     // defaults to zero anyway, but good practice.
@@ -251,6 +229,7 @@ void RenderingEngine::Initialize()
     
 void RenderingEngine::Render(float timestamp) const
 {
+    PROFILE_ZONE("ES2::RenderingEngine::Render");
     if (false) {
         int desiredState = DemoStateDistanceFieldSmooth;
         float desiredSegment = 0 + desiredState * NumCameraPositions;
@@ -280,6 +259,7 @@ void RenderingEngine::Render(float timestamp) const
     glUniform1i(m_uniforms.Outline, GL_FALSE);
     glUniform1i(m_uniforms.Glow, GL_FALSE);
     glUniform1i(m_uniforms.Shadow, GL_FALSE);
+    glUniform1i(m_uniforms.Median, GL_FALSE);
     
     // Render the background quad:
     glBindTexture(GL_TEXTURE_2D, m_textures.Tile);
@@ -348,13 +328,17 @@ void RenderingEngine::Render(float timestamp) const
 
     glUniform1f(m_uniforms.AlphaTest, 2);
     glUniform3f(m_uniforms.GlyphColor, 1, 1, 1);
-    glUniform1i(m_uniforms.Smooth, GL_FALSE);
     glUniform1f(m_uniforms.Outline, GL_FALSE);
     glUniform1i(m_uniforms.Glow, GL_FALSE);
     glUniform1i(m_uniforms.Shadow, GL_FALSE);
+
+    // The labels are multi-channel distance fields, a quarter the size of
+    // the rasterized text they replace.
+    glUniform1i(m_uniforms.Median, GL_TRUE);
+    glUniform1i(m_uniforms.Smooth, GL_TRUE);
     
     glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glBlendFunc(GL_ONE_MINUS_SRC_ALPHA, GL_SRC_ALPHA);
 
     // Render the top label:
     glUniform3f(m_uniforms.GlyphColor, 0.2f, 0.3f, 0.6f);
@@ -400,42 +384,27 @@ void RenderingEngine::Render(float timestamp) const
     glDisable(GL_BLEND);
 }
 
-GLuint RenderingEngine::CreateTexture(const unsigned long* data)
+GLuint RenderingEngine::LoadTexture(const char* name)
+{
+    AssetEntry entry = m_assets.Find(name);
+    GLuint texture = CreateTexture(entry.Data, entry.Size);
+    m_assets.Release(entry);
+    return texture;
+}
+
+GLuint RenderingEngine::CreateTexture(const void* data, size_t size)
 {
-    PVRTextureHeader* header = (PVRTextureHeader*) data;
-    GLsizei w = header->Width;
-    GLsizei h = header->Height;
-    const unsigned long* texels = data + header->HeaderSize / 4;
+    PvrTexture texture;
+    texture.Parse(data, size);
+    assert(texture.IsValid() && "Bad texture.");
 
     GLuint name;
     glGenTextures(1, &name);
     glBindTexture(GL_TEXTURE_2D, name);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    
-    switch (header->Flags & PVRTEX_PIXELTYPE) {
-        case OGL_I_8: {
-            GLenum format = GL_ALPHA;
-            GLenum type = GL_UNSIGNED_BYTE;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_RGB_565: {
-            GLenum format = GL_RGB;
-            GLenum type = GL_UNSIGNED_SHORT_5_6_5;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_PVRTC4: {
-            GLsizei size = max(32, w * h / 2);
-            GLenum format = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG;
-            glCompressedTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, size, data);
-            break;
-        }
-        default:
-            std::cout << "Unknown format.\n";
-            break;
-    }
+    if (!UploadPvrTexture(texture))
+        std::cout << "Unknown format.\n";
 
     return name;
 }
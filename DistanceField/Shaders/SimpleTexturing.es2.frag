@@ -8,6 +8,7 @@ uniform mediump vec3 OutlineColor;
 uniform mediump vec3 GlyphColor;
 uniform mediump vec3 GlowColor;
 
+uniform bool Median;
 uniform bool Smooth;
 uniform bool Outline;
 uniform bool Glow;
@@ -24,6 +25,13 @@ void main(void)
     // Look up distance from the distance field:
     mediump vec4 color = texture2D(Sampler, TextureCoordOut);
     mediump float alpha = color.a;
+
+    // Multi-channel fields keep the distance to different edges in each
+    // channel; the median of the three keeps corners sharp.
+    if (Median) {
+        alpha = max(min(color.r, color.g), min(max(color.r, color.g), color.b));
+        color.rgb = vec3(0.0);
+    }
     
     // Kill the fragment if it fails the alpha test.
     if (alpha > AlphaTest)
@@ -107,6 +115,7 @@ uniform mediump vec3 OutlineColor;
 uniform mediump vec3 GlyphColor;
 uniform mediump vec3 GlowColor;
 
+uniform bool Median;
 uniform bool Smooth;
 uniform bool Outline;
 uniform bool Glow;
@@ -124,6 +133,13 @@ void main(void)
     mediump vec4 color = texture2D(Sampler, TextureCoordOut);
     mediump float alpha = color.a;
 
+    // Multi-channel fields keep the distance to different edges in each
+    // channel; the median of the three keeps corners sharp.
+    if (Median) {
+        alpha = max(min(color.r, color.g), min(max(color.r, color.g), color.b));
+        color.rgb = vec3(0.0);
+    }
+
     // Kill the fragment if it fails the alpha test.
     if (alpha > AlphaTest)
         discard;
@@ -1,284 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT static const unsigned long
-#endif
-
-A32BIT DistanceField[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x00000080,		/* dwHeight */
-0x00000100,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00010016,		/* dwpfFlags */
-0x00008000,		/* dwDataSize */
-0x00000008,		/* dwBitCount */
-0x000000ff,		/* dwRBitMask */
-0x000000ff,		/* dwGBitMask */
-0x000000ff,		/* dwBBitMask */
-0x00000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfafcffff,0xf5f5f6fa,0xfaf8f5f5,0xfffffffc,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf1f3f8fc,0xe6e8ebed,0xe1e1e2e6,0xe6e4e1e1,0xf6efece8,0xfffffffb,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf2f0f2f7,0xfffffff7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xedf3f8fe,0xdce1e4e8,0xd1d4d6d9,0xccccced1,0xd1d0cccc,0xe2dcd6d4,0xfff7efe7,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xedf8ffff,0xdddcdde4,0xfffbeee4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xeff6fcff,0xd9dfe4ea,0xc8ccd0d5,0xbdc0c2c5,0xb8b8b9bd,0xbdbdb8b8,0xcec9c3c0,0xede4dcd4,
-0xfffffffa,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdce7f1fc,0xcac7cad2,0xfcecddd2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7ffffff,0xdce2e8f1,0xc5ccd0d6,0xb4b8bdc2,0xa8adaeb2,0xa3a3a6a8,0xa8a8a4a3,0xb9b5afad,0xdbd2c9c2,
-0xfffff3e8,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf8ffffff,0xcbd5e0ec,0xb7b3b7c0,0xf2e0cfc1,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe4ecf3fc,0xc9cfd6dd,0xb2b8bdc3,0xa0a4a9ae,0x9399999e,0x8f8f9393,0x9393908f,0xa6a29b99,0xc9c0b7af,
-0xfef1e5d8,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe8f7ffff,0xb9c4cfdc,0xa49ea4af,0xead6c4b3,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf2fbffff,0xd2d9e2ea,0xb5bbc4ca,0x9fa4aaaf,0x8e909599,0x7580808a,0x70747575,0x75757570,0x958f8a80,0xb9ada49b,
-0xf0e1d5c8,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdae8f7ff,0xa7b3c0cc,0x968a929d,0xe4d0bdaa,0xfffffff8,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe0e8f2fb,0xbfc7d0d6,0xa2a9b0b7,0x8b90969b,0x70747d80,0x64666a6b,0x5c606161,0x6461615c,0x7d716b66,0xa79c928a,
-0xe1d3c4b9,0xfffffff1,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xccdae8f7,0x96a4afbd,0x90747d8b,0xe1ccb8a4,0xfffffff3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf2fcffff,0xcdd6e0e8,0xabb4bdc4,0x8f969da4,0x6e74808a,0x5c60656a,0x50515659,0x474c4c4c,0x504c4c48,0x655f5954,0x998b786d,
-0xd5c4b6a7,0xfffff5e5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7ffffff,0xbdccdae8,0x8292a0af,0x8e706671,0xdcc8b4a0,0xfffffff1,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe0ebf3ff,0xbbc4cdd6,0x99a2aab2,0x74808a92,0x5b60666d,0x474c5156,0x3c3c4245,0x33383838,0x3c383835,0x524b4540,0x8a71665b,
-0xc8b9a799,0xfffbead9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe8f7ffff,0xafbdccda,0x6d7d92a0,0x8a6b5962,0xd8c4b09d,0xffffffec,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf8ffffff,0xcfd9e3ed,0xa9b2bbc4,0x829096a0,0x60666e75,0x474d545a,0x33383c42,0x282a2d31,0x20232323,0x28232321,0x3f38322c,0x7163564b,
-0xbdac9c8b,0xfff2e0ce,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdae8f7ff,0xa0afbdcc,0x5c6a7d92,0x80665450,0xd2bfab99,0xfffff7e4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe7f1fcff,0xbdc7d2dc,0x96a0a9b3,0x6a74808e,0x4d545b64,0x333a4046,0x20242a2f,0x1316191d,0x0c0f0f10,0x13100f0d,0x2f241e18,0x6354463a,
-0xb2a09074,0xfbe8d6c4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xccdaeafb,0x92a0afbd,0x4d5b6a7d,0x75624f41,0xc9b7a492,0xfff7eadb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd5e0ecf7,0xabb6c0cb,0x808e96a2,0x59626971,0x3a424850,0x20262d33,0x1418191b,0x090e1214,0x00000004,0x00000000,0x1d120b04,0x54463729,
-0xa996806a,0xf3e0cdbb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xbdceddee,0x7d92a0af,0x3e4d5b6a,0x6e5b4835,0xbead9c8a,0xede4dace,0xfffcf9f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf1feffff,0xc4cfdbe6,0x99a4afb9,0x69718290,0x464f565f,0x262f363c,0x2d2a2828,0x282c2e2e,0x1d222628,0x020b1118,0x00000000,0x0c010000,0x4938291a,
-0xa08e715f,0xecd9c5b2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7ffffff,0xb2c1d2e4,0x6a7d92a0,0x303e4d5b,0x6654422f,0xb2a29278,0xdad2c9bd,0xede8e6e1,0xfffbf6f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe1edf8ff,0xb3bec9d5,0x8a929da7,0x56626a74,0x343b444d,0x3a383332,0x423c3c3c,0x3c404242,0x31363a3c,0x141d242b,0x0000020b,0x00000000,0x3f2d1c0c,
-0x99806956,0xe6d2bfab,0xfffffff9,0xffffffff,0xffffffff,0xffffffff,0xedffffff,0xa4b7c9db,0x5b6a8095,0x21303e4d,0x5b4b3826,0xa095826d,0xc7c0b7ad,0xd9d5d2cd,0xeee7e2dd,0xfffffcf3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd0dce8f5,0xa2adb9c4,0x6d7d8b96,0x454f5963,0x423c3a3b,0x4d4c4746,0x56515151,0x51545757,0x45494d51,0x262f383f,0x0008131d,0x00000000,0x36241200,
-0x9275624f,0xdfccb9a5,0xfffffff3,0xffffffff,0xffffffff,0xffffffff,0xe6f9ffff,0x9badc0d2,0x4d5f6d8a,0x1321303e,0x503f2f1d,0x92806d5f,0xb4ada49b,0xc5c2bdb9,0xdad4ceca,0xfff5ebe2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf1feffff,0xc0ccd9e5,0x929ca7b4,0x5b667182,0x443f4652,0x56514d48,0x61605c5a,0x6a666666,0x66666b6b,0x595c6166,0x38424b52,0x0b18242f,0x00000000,0x301d0900,
-0x8b705c48,0xdcc7b39f,0xffffffef,0xffffffff,0xffffffff,0xffffffff,0xdff3ffff,0x92a5b9cc,0x42526475,0x04132131,0x42332312,0x756a5f50,0xa09a928a,0xb2aea9a5,0xc7c0b9b7,0xf0e4d9d0,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe1eefbff,0xafbdc8d5,0x758b99a4,0x4b565f6a,0x57524d48,0x6a66615c,0x7574706d,0x80808080,0x8080858a,0x6b707580,0x4b545c65,0x1a283441,0x0000000c,0x2b170300,
-0x8a6b5744,0xd6c3af9b,0xffffffec,0xffffffff,0xffffffff,0xffffffff,0xdcf0ffff,0x8b9fb3c7,0x36485c70,0x00041524,0x33241607,0x645b4d42,0x8e82756e,0x9e999592,0xb4ada6a3,0xe1d3c8bd,0xfffffff0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd2ddecfa,0xa0acb9c4,0x66718292,0x554f4f5b,0x6b66615b,0x82807570,0x93908f8a,0x99999995,0x9999999d,0x8a8f9395,0x5c666e7d,0x29374550,0x00000819,0x27130000,
-0x80665440,0xd6c2ae99,0xffffffeb,0xffffffff,0xffffffff,0xffffffff,0xdcf0ffff,0x8a9eb3c7,0x3044576b,0x0000081c,0x24160800,0x53483e31,0x706a645c,0x8a808075,0xa29a938f,0xd3c4b7ac,0xfffff3e3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7ffffff,0xc1cfdde8,0x909ca7b6,0x56626d7d,0x69625b54,0x8a80756e,0x9a95928e,0xa8a4a29e,0xaeaeaea9,0xaeaeaeb0,0x9ba2a6a9,0x6d7d8b95,0x36465462,0x00051624,0x230f0000,
-0x8066513c,0xd3bfab99,0xfffffbe7,0xffffffff,0xffffffff,0xffffffff,0xdcf0ffff,0x8a9eb3c7,0x2e42576b,0x00000619,0x15080000,0x42372d21,0x5c565049,0x6d6a6661,0x90877571,0xc7b6a79b,0xfffbe8d8,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe8f7ffff,0xb2c1ccda,0x748b99a4,0x5f595c6a,0x80756e66,0x9b96928b,0xaea9a5a0,0xbdb8b5b3,0xc2c2c2bd,0xc2c2c2c4,0xafb5b9bd,0x82929da6,0x42526371,0x00112233,0x230e0000,
-0x7564503c,0xd1bda893,0xfffffae6,0xffffffff,0xffffffff,0xffffffff,0xdcf0ffff,0x8a9eb3c7,0x32465a6d,0x0000091e,0x04000000,0x2f261b11,0x48443c36,0x5a56514d,0x746b645f,0xbbab998b,0xfff3e0cd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdae8f7ff,0xa4b0bdcc,0x66718a95,0x716a625a,0x99928b80,0xafaaa59f,0xc2bdb9b4,0xd0ccc9c7,0xd6d6d5d2,0xd5d6d6d8,0xc2c9ced2,0x96a4afb9,0x4f5f6d87,0x081b2d3e,0x1e0b0000,
-0x75614c38,0xd1bda893,0xfffffae6,0xffffffff,0xffffffff,0xffffffff,0xddf1ffff,0x8fa2b5c9,0x36495c70,0x00001023,0x00000000,0x1d140a00,0x35302a23,0x46423c3a,0x6659524b,0xb2a08e74,0xffedd9c5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfeffffff,0xc8d6e5f1,0x909cabb9,0x695f6a7d,0x928b7d71,0xb0aaa29b,0xc8c3bdb7,0xdad6d2cd,0xe8e6e2df,0xf0f0eeeb,0xeef0f0f1,0xd9e1e7eb,0xa7b7c4cf,0x5c6d8799,0x1426384b,0x220e0002,
-0x75624f3b,0xd1bda893,0xfffffae6,0xffffffff,0xffffffff,0xffffffff,0xe3f7ffff,0x95a9bbcf,0x3f52657d,0x040c1c2d,0x00000000,0x04000000,0x1c17110b,0x2d282421,0x56453a32,0xab998069,0xfbe7d3bf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0ffffff,0xb9c8d5e1,0x758e9cab,0x8071666a,0xa59d958b,0xc4bdb5ad,0xdcd6d0ca,0xeeeae6e1,0xfcfaf6f3,0xffffffff,0xffffffff,0xebf3fbff,0xb4c4d3e0,0x667d92a4,0x1d2f4254,0x230f000b,
-0x8066513c,0xd0beaa96,0xfff8ecdd,0xffffffff,0xffffffff,0xffffffff,0xe8fcffff,0x9bafc2d5,0x495b6d8a,0x181e2938,0x090c0f13,0x00000205,0x08030000,0x1915110d,0x4f3b281f,0xa8937562,0xfae6d1bd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe4f3ffff,0xabb9c4d3,0x66748e9c,0x958b7d6e,0xb9b0a69f,0xd6d0c9c0,0xefeae4dd,0xfffef9f3,0xffffffff,0xffffffff,0xffffffff,0xfcffffff,0xc0d0e1f0,0x6e8b9daf,0x26384b5c,0x230f0013,
-0x8066513c,0xc1b4a799,0xf7e8dccf,0xffffffff,0xffffffff,0xffffffff,0xefffffff,0xa4b7c9dc,0x54667592,0x2b323a46,0x1d202327,0x0c111619,0x00000006,0x06010000,0x4c38230f,0xa8937561,0xfae6d1bd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd6e5f3ff,0x9ca7b7c8,0x756a748e,0xa69d958a,0xcbc2b9b0,0xeae2dbd2,0xfffef7f1,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xcbdcedfe,0x7d95a6b9,0x2d405466,0x230e0619,
-0x7464503c,0xb2a4998b,0xe6daccc0,0xfffffff3,0xffffffff,0xffffffff,0xf7ffffff,0xadc0d2e4,0x63718b9c,0x3f454b56,0x3133383b,0x20242a2d,0x00081118,0x00000000,0x4c382310,0xa8937561,0xfae6d1bd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc8d6e5f3,0x8b9babb9,0x92827174,0xb9b0a49b,0xddd4ccc2,0xfcf6ede6,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd4e7f8ff,0x8a9bafc2,0x33465a6d,0x1e0b0c20,
-0x63584836,0xa4958771,0xd6c9bdaf,0xfffcf0e3,0xffffffff,0xffffffff,0xffffffff,0xb9c9dbed,0x718b99a7,0x52595f66,0x45474c4f,0x33383c42,0x0f1b242b,0x01000003,0x503c2815,0xa8937564,0xfae6d1bd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf9ffffff,0xb9c8d6e7,0x748e9cab,0xa2968b75,0xcbc1b7ad,0xf0e7ddd4,0xfffffff9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdcefffff,0x90a2b5c9,0x384c6074,0x16041124,
-0x54463b2c,0x92826d63,0xc7b9ada0,0xf8ece0d3,0xffffffff,0xffffffff,0xffffffff,0xc4d5e6f7,0x8b99a7b6,0x666b717d,0x595c6062,0x464c5156,0x1f2c363f,0x08000413,0x55422f1b,0xab998069,0xfbe7d3bf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0ffffff,0xabb9cbdd,0x80748e9c,0xb3a79c92,0xddd2c9be,0xfff9f0e7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe2f6ffff,0x95a9bdd0,0x3c51657d,0x0b02162a,
-0x46372a1e,0x7d6d5f52,0xb6ab9c92,0xe8dccfc4,0xfffffff3,0xffffffff,0xffffffff,0xd3e1f1ff,0x9da7b6c4,0x808a8e95,0x6b707475,0x5960656a,0x303b4852,0x13021221,0x5b483624,0xb29f8b6e,0xffecd9c5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe8fcffff,0x9db0c2d5,0x9582748e,0xc4b9ada0,0xeee4dbcf,0xfffffff9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe8fcffff,0x9aaec2d5,0x42566a82,0x0006192d,
-0x36291a0e,0x6a5c5042,0xa7998e75,0xd8ccc0b3,0xfffaeee3,0xffffffff,0xffffffff,0xe1f0feff,0xb0b9c4d3,0x999ba0a6,0x8a8e8f93,0x6b747d80,0x3e4c5864,0x1d0c1d2f,0x6452412f,0xb9a59275,0xfff3dfcc,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe6faffff,0x95a9bdd2,0xa495827d,0xd5c9bdb2,0xfff7ece0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xeeffffff,0x9eb3c7da,0x465a6d8a,0x00091e32,
-0x24190c00,0x5b4d4133,0x968b7466,0xc7bbafa4,0xf3e8ddd2,0xffffffff,0xffffffff,0xf0feffff,0xc2cbd5e1,0xabafb4b9,0x9ea0a3a8,0x878f9599,0x4b5b6974,0x2919283a,0x6d5c4b3a,0xc0ad9b8a,0xfff9e6d2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe7fbffff,0x99abbfd3,0xb2a4968f,0xe6dacec1,0xfffffcf1,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf1ffffff,0xa2b5c9dd,0x475c708f,0x000a1e33,
-0x16080000,0x493e3024,0x82716458,0xb6aba092,0xe3d8ccc1,0xfffff7ed,0xffffffff,0xfeffffff,0xd4dde7f1,0xbfc3c8cd,0xb2b4b8bb,0x99a2a9ae,0x5666788e,0x36243244,0x7d665646,0xc9b7a492,0xffffeddb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xecffffff,0xa9b6c7d9,0xc1b3a9a3,0xf7eaddcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf5ffffff,0xa3b8cce1,0x475c708f,0x000a1e33,
-0x08000000,0x3b2d2113,0x6d5f5448,0xa4998e7d,0xd2c7bbb0,0xf9f0e6db,0xffffffff,0xffffffff,0xe7f0f9ff,0xd3d6dce1,0xc5c8cccf,0xabb4bbc2,0x5f718e9c,0x4233384b,0x8e716352,0xd2c0af9d,0xfffff7e4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf3ffffff,0xbbc5d3e3,0xcfc4bbb8,0xfffbecdd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf5ffffff,0xa3b8cce1,0x475c708f,0x000a1e33,
-0x00000000,0x2c1e1104,0x5b504437,0x958a7469,0xc0b6aba0,0xe7ddd4c9,0xfffff7ef,0xffffffff,0xfbffffff,0xe7eceff3,0xd9dce1e3,0xb9c7cfd5,0x657d95a9,0x50413c51,0x998a6d5f,0xdccbb9a9,0xffffffed,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xcfd6e2f0,0xe0d6cfcc,0xfffffbec,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0f2f6f9,0xf5f1f0f0,0xfffffcf8,0xffffffff,0xffffffff,0xf3ffffff,0xa3b8cce1,0x475c708f,0x000a1e33,
-0x00000000,0x1b0f0100,0x4c3f3327,0x806e6458,0xada4998e,0xd4cbc2b9,0xf3ece4dc,0xfffffff9,0xffffffff,0xfbffffff,0xedf1f3f7,0xc2d5e2e8,0x668099ae,0x5c4d3e51,0xa495826d,0xe7d6c5b6,0xfffffff8,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe3e8f3ff,0xf2e8e3e1,0xfffffffc,0xffffffff,0xffffffff,0xffffffff,0xecf3fcff,0xdcdde1e6,0xe1dddcdc,0xf3eee8e4,0xfffffffb,0xffffffff,0xefffffff,0xa0b4c8dc,0x475c708e,0x030d1e33,
-0x00000000,0x0b000000,0x3b302316,0x6a5f5348,0x9c928a74,0xc2b9b0a6,0xdfd9d2c9,0xf6f1ece6,0xfffffcf9,0xffffffff,0xf6f9fbfe,0xc2d6ebf1,0x668099ae,0x6a5b4d51,0xb2a4927d,0xf3e2d2c1,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7fcffff,0xfffcf7f5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd9e2ebf5,0xc7cacdd2,0xccc9c7c7,0xe1dad4d0,0xfff7efe7,0xffffffff,0xe8fcffff,0x9bafc3d6,0x44576b8a,0x141f2830,
-0x00000007,0x00000000,0x2c1f1307,0x594d4237,0x8b786d63,0xafa69d95,0xccc5bfb7,0xe1ddd8d2,0xebebe8e6,0xebebebec,0xe1e6e6ea,0xc2d0d8dd,0x668099ae,0x7d6a5b51,0xc0afa092,0xffeeddcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0feffff,0xc7d0d9e4,0xb3b7b9bf,0xb8b5b3b3,0xcdc7c0bd,0xece4dcd4,0xfffffbf3,0xe0f0fcff,0x96a9bbcf,0x47546680,0x26303b44,
-0x00010c18,0x00000000,0x1b0f0300,0x463c3126,0x6e665b52,0x9b958b7d,0xb9b2aba4,0xcdc9c4bf,0xd6d6d4d1,0xd6d6d6d8,0xcdd1d2d6,0xb6bdc4c9,0x668099ab,0x927d6a5b,0xccbdafa0,0xfffbecdc,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe1f0feff,0xb4bdc8d3,0x9ea3a5ab,0xa4a29e9e,0xb9b4ada8,0xd9d2c9c2,0xf2eee8e1,0xd3e1ebf1,0x8fa2b3c4,0x5c566074,0x37424c56,
-0x07121d28,0x00000000,0x0a000000,0x362b2015,0x5c544b3f,0x8a7d6e66,0xa59f9992,0xb9b5b0ab,0xc2c2c0bd,0xc2c2c2c4,0xb9bdbec2,0xa4abb0b5,0x64748e99,0xa0927d6a,0xdaccbdaf,0xfffff8e8,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3e1f0fe,0xa2acb7c4,0x8a8f9299,0x908f8a8a,0xa6a09a93,0xc7bfb7af,0xdddad5cd,0xc4d0d9dd,0x8296a7b6,0x7066596a,0x48535c69,
-0x18232f3a,0x0000000b,0x00000000,0x24190f04,0x4b42382f,0x6d665c54,0x928b8075,0xa5a29d99,0xaeaeada8,0xaeaeaeb0,0xa5a8aaae,0x90999da2,0x6a66748a,0xafa0927d,0xe8daccbd,0xfffffff7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfeffffff,0xc4d3e1f0,0x909ba7b6,0x6d707582,0x74706b6b,0x958e8278,0xb4aba49b,0xcac7c2bb,0xb4bdc5c9,0x718b99a7,0x8e74665f,0x59646e7d,
-0x28343f4b,0x0005111c,0x00000000,0x12080000,0x382f261d,0x5b544b42,0x756e6962,0x928f8a80,0x99999993,0x9999999d,0x92939699,0x75808a8f,0x7d6a646d,0xbdafa092,0xf7e8dacc,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0ffffff,0xb6c4d3e1,0x748b99a7,0x5a5c626a,0x605c5957,0x7d716a65,0xa099928a,0xb7b3aea9,0xa2abb2b5,0x64748b99,0x9c8e756a,0x6a748a95,
-0x3845505b,0x0b16222d,0x00000001,0x01000000,0x261d140b,0x4840382f,0x625b554f,0x75706b66,0x80808075,0x8080858a,0x75758080,0x62666b70,0x927d6d5f,0xccbdafa0,0xfff7e8da,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe3f3ffff,0xa7b6c4d3,0x66718b99,0x46484f59,0x4c474542,0x665f5651,0x8e82756d,0xa39e9a95,0x90999ea2,0x6d667182,0xab9c907d,0x809099a4,
-0x4954626d,0x1d27333e,0x00000712,0x00000000,0x140b0200,0x352d261d,0x4f48423b,0x615c5954,0x6a666664,0x666a6b6b,0x61626666,0x5f54595c,0xa092806d,0xdaccbdaf,0xfffff7e8,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd6e5f5ff,0x99a7b6c7,0x5463718b,0x32353c49,0x3833312e,0x544b443c,0x716a625b,0x8f8a827d,0x74808a8f,0x8271636a,0xb9aca092,0x95a0abb6,
-0x5b667182,0x2f38444f,0x040f1823,0x00000000,0x02000000,0x211b130b,0x3b352f28,0x4c484540,0x56515150,0x51565757,0x4c4f5151,0x6d5f5048,0xafa09582,0xe8daccbd,0xfffffff7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc8d9e8f5,0x8b99abb9,0x46546371,0x1e222c38,0x24201d19,0x4038322a,0x5f594f48,0x706d6a65,0x62696d70,0x958b7466,0xc8bdafa4,0xa4b0bdc7,
-0x6a758b96,0x3f4b545f,0x16202b34,0x0000040d,0x00000000,0x0e080000,0x27211b15,0x3835312c,0x423c3c3c,0x3c424242,0x463b3c3c,0x826d5f54,0xbdb0a495,0xf7e8dacc,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0feffff,0xb9c8d5e1,0x718b99a9,0x33425062,0x040b1824,0x0c070401,0x28211912,0x46403830,0x5755514c,0x6a5b5557,0xab9c927d,0xddcfc4b6,0xb9c5d0dd,
-0x8b95a0ac,0x545f6a74,0x2d36414b,0x0c141b24,0x00000006,0x00000000,0x0e090300,0x1e1c1813,0x28242323,0x2d282828,0x5b4d4237,0x998b7466,0xd0c4b6a7,0xfffbecdd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe1f1ffff,0xabb9c4d3,0x63748e9c,0x24344554,0x00000816,0x00000000,0x160e0600,0x332d261d,0x42413c38,0x75645242,0xb9ada092,0xece0d3c7,0xcbd6e2ed,
-0x9ba6b2bd,0x66718090,0x3f48525c,0x20262f36,0x090d1319,0x00000205,0x00000000,0x0b080400,0x1b15100e,0x3e342b23,0x6a5f5348,0xa7998e75,0xe1d3c4b6,0xfffffbed,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd5e7f9ff,0x9ca7b6c4,0x5866748e,0x282f3746,0x0b121b21,0x00000002,0x03000000,0x2019130b,0x2e2d2824,0x8a6b5742,0xc9bdad9b,0xfcf0e3d6,0xdce7f3fe,
-0xacb7c2ce,0x7d8b96a0,0x525b646d,0x333a4248,0x1d21262d,0x12141619,0x110f0f0f,0x1b181414,0x2f28231e,0x4f463c36,0x806e645b,0xb6ab9c92,0xf0e1d3c4,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xcbddf1ff,0x8b99a7b9,0x4f586674,0x3b42474c,0x1d242d35,0x00000a14,0x00000000,0x0c060000,0x2d191511,0x826a5642,0xc7b6a799,0xfff7e6d6,0xedf8ffff,
-0xbdc8d3df,0x929da7b2,0x646d758a,0x464d545b,0x31353a40,0x26282a2d,0x24232323,0x2f2c2828,0x423c3733,0x62595048,0x958b756a,0xc7b9ada0,0xfef0e1d3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4d8ecff,0x718b9db0,0x62666666,0x4f555b60,0x2f383f48,0x07121b26,0x00000000,0x00000000,0x2a160200,0x71624f3c,0xb9ab998b,0xfcecdbc9,0xfeffffff,
-0xced9e4f0,0xa4afb9c4,0x758a929b,0x5a60666e,0x45484d54,0x3a3c3c42,0x38383838,0x42403c3c,0x55504b47,0x746a645b,0xa69b9082,0xd6c9bdb2,0xfffef0e3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc2d6ebff,0x80879aae,0x75808080,0x62696e74,0x424b525b,0x18232d37,0x0000030d,0x00000000,0x220f0000,0x64544534,0xad9c8e74,0xf3e2d0be,0xffffffff,
-0xe0eaf5ff,0xb7c0cbd5,0x929ba4ad,0x6d74808b,0x595c6166,0x4d515156,0x4c4c4c4c,0x57545151,0x69645f5b,0x9082756e,0xb7aca299,0xe6dacec2,0xfffffff3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc7daeeff,0x999aa4b4,0x93999999,0x75808b8f,0x535c656d,0x28343f48,0x0008131f,0x00000000,0x18060000,0x58483728,0xa2927866,0xe8d6c5b4,0xfffffffa,
-0xf1fbffff,0xc9d2dce7,0xa5adb7c0,0x8a8f969d,0x6b707580,0x6166666a,0x61616161,0x6b666665,0x8075716e,0xa29a928b,0xc8bdb4ab,0xf7eadfd3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd0e2f3ff,0xaeaeb4c1,0xa8abaeae,0x92999fa3,0x646e788a,0x3b45505b,0x0e192430,0x00000003,0x0b000000,0x4b3b2c1b,0x99826d5b,0xddccbba9,0xfffffff0,
-0xffffffff,0xdbe4edf8,0xb9c0c9d2,0x9da2a9b0,0x8a8f9296,0x75808082,0x75757575,0x8a808078,0x99938f8a,0xb4ada59f,0xd9d0c7bd,0xfffbf0e4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xddedfeff,0xc2c2c7d0,0xbbbfc2c2,0xa4abb2b8,0x758a929b,0x4c56626d,0x1f2a3641,0x00000813,0x00000000,0x3f2f1e0f,0x8e716250,0xd4c2b0a0,0xfffff9e7,
-0xffffffff,0xedf7ffff,0xcbd2dbe4,0xb0b5bbc4,0x9ea2a5aa,0x9396999a,0x93939393,0x9d999993,0xada6a39e,0xc7c0b9b2,0xebe2d9d0,0xfffffff5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xedfbffff,0xd6d6dae2,0xcfd3d6d6,0xb7bfc5cc,0x929ba4ad,0x5c697182,0x303b4652,0x000c1924,0x00000000,0x34231201,0x80695645,0xccb9a695,0xfffff3df,
-0xffffffff,0xffffffff,0xdde6edf7,0xc4c9cfd6,0xb3b5b9be,0xa8aaaeae,0xa8a8a8a8,0xb0aeada8,0xc0b9b7b3,0xdad2ccc5,0xfcf3ebe2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfeffffff,0xebebeef3,0xe3e7ebeb,0xc9d2d9df,0xa2adb7c0,0x6d7d8e99,0x414c5863,0x0f1d2936,0x00000004,0x28180700,0x6e5f4d3b,0xc5b29f8b,0xffffedd9,
-0xffffffff,0xffffffff,0xf1f9ffff,0xd6dde2e8,0xc7c9cdd2,0xbdbec2c2,0xbdbdbdbd,0xc4c2c0bd,0xd4cecac7,0xede6dfd9,0xfffffcf3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7fbffff,0xdbe4ecf3,0xb4bec9d2,0x8a959da9,0x525c6974,0x202c3a46,0x00000413,0x1f0d0000,0x69554231,0xc2ae9980,0xffffebd6,
-0xffffffff,0xffffffff,0xffffffff,0xeaf1f6fc,0xdadde1e6,0xd1d2d6d6,0xd1d1d1d1,0xd8d6d4d1,0xe7e2dddc,0xfff9f3ed,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xedf7ffff,0xc5d0dbe4,0x99a4b0b9,0x636d7d8e,0x303c4956,0x00041321,0x15040000,0x66513c28,0xc2ae9980,0xfffce8d5,
-0xffffffff,0xffffffff,0xffffffff,0xfeffffff,0xeef1f6f9,0xe6e6eaeb,0xe6e6e6e6,0xecebe8e6,0xfbf6f2f0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd6e2ecf7,0xabb6c1cb,0x718795a0,0x3e4d5966,0x01122130,0x14000000,0x66513c28,0xbda99580,0xfffae6d2,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfafbfeff,0xfafafafa,0xfffffcfa,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe7f3fcff,0xbbc7d2dd,0x8e99a4b0,0x4d5b6a74,0x0e1e2f3e,0x14000000,0x65513c28,0xbda89378,0xfffae6d1,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf9ffffff,0xccd8e3ee,0x9ca9b4c1,0x5b6a7d8e,0x192a3b4b,0x14000008,0x66513c28,0xc0ad9980,0xfffce8d4,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf8fbffff,0xf0f1f5f5,0xf3f0f0f0,0xfffbf6f5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdde8f3ff,0xabb9c5d0,0x667892a0,0x24364658,0x18040213,0x6654402c,0xc2ae9980,0xffffebd6,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf6fbffff,0xe4e7ecf1,0xdcdde1e1,0xdfdcdcdc,0xece7e2e1,0xfffef7f1,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xedfaffff,0xbbc8d6e2,0x748e9cad,0x2f415263,0x1e0b091d,0x6b594532,0xc4b09d8a,0xffffecd8,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfbffffff,0xe2e7eef3,0xd0d3d8dd,0xc7c9cccc,0xccc7c7c7,0xd8d3cecc,0xf3ebe4dd,0xfffffffb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfeffffff,0xc9d8e5f3,0x8a99abb9,0x36495c6d,0x24121124,0x715f4b38,0xc9b5a28f,0xfffff1dd,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe7eef7fe,0xced4dae1,0xbdbfc4c9,0xb3b5b8b8,0xb8b3b3b3,0xc4bfb9b8,0xe1d9d0ca,0xfffef3e8,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfcffffff,0xfcfafafa,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd6e6f3ff,0x92a4b6c7,0x3f526475,0x2d1b182b,0x7d65523f,0xcfbba995,0xfffff6e2,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf3fcffff,0xd4dbe4eb,0xb9c0c7cd,0xa8abb0b5,0x9ea2a3a4,0xa39f9e9e,0xb0aba6a3,0xcdc7bdb7,0xf7ede2d8,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe8f0f9ff,0xe8e6e6e6,0xfffcf6ee,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe3f3ffff,0x9badc0d2,0x45596b8a,0x37261e32,0x8a6d5b48,0xd5c2af9b,0xfffffce8,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe2ebf3fc,0xc0c9d0d9,0xa6adb4b9,0x93999da2,0x8a8f8f90,0x8f8b8a8a,0x9d99938f,0xbbb4aba4,0xe6dbd0c7,0xfffffff3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfaffffff,0xd5dde7f0,0xd4d1d1d2,0xf1eae2db,0xfffffcf7,0xffffffff,0xffffffff,0xffffffff,0xedffffff,0xa2b5c9db,0x4b5f718f,0x42302337,0x92756453,0xdcc9b7a4,0xffffffef,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf5ffffff,0xd0d9e2eb,0xadb7bdc7,0x939aa0a6,0x75808a8f,0x6d707075,0x70706b6b,0x8a807571,0xaba09990,0xd6c9c0b4,0xfffef0e2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe8f7ffff,0xc2cbd4dd,0xc0bdbdbd,0xddd6d0c9,0xf2ede8e3,0xfffefbf6,0xffffffff,0xffffffff,0xf6ffffff,0xa8bbcfe2,0x50647593,0x4d3c2c3c,0x9b8a6e5c,0xe4d2c0ad,0xfffffff7,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe4eefaff,0xbdc7d0d9,0x9ba4abb4,0x75828e93,0x64666b70,0x5a5c5c61,0x5c5c5757,0x6d66625f,0x998e8274,0xc5b9ada4,0xfef0e1d3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd6e5f3ff,0xabb4bdc8,0xa9a3a3a4,0xc5bfb9b0,0xd9d4cfca,0xe8e6e1dd,0xf1f0eeeb,0xf5f5f5f5,0xeaeef0f2,0xadc0d4e6,0x51668099,0x5b4c3b3c,0xa796826d,0xf0ddcbb9,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xfbffffff,0xced9e4ee,0xa6b0b9c4,0x808b959d,0x5f656b74,0x4b4f5459,0x41424447,0x42423f3c,0x554f4946,0x7d6e665c,0xb2a4998e,0xecddcfc1,0xfffffffb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc8d6e5f3,0x99a2acb9,0x968f8f90,0xb2aba59d,0xc5c0bbb7,0xd4d1cdc9,0xdddcdad6,0xe1e1e1e1,0xd6dadcdd,0xaec2ced2,0x51668099,0x6958493c,0xb3a2927d,0xf9e7d5c4,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xeaf5ffff,0xbdc8d2dd,0x959da7b2,0x696e7d8b,0x4b525960,0x373b4045,0x2d2e3033,0x2e2e2b28,0x423b3632,0x695c544b,0xa4958a74,0xddcfc1b2,0xfffffbec,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf3ffffff,0xb9c8d6e5,0x82909cab,0x80747074,0x9e99928b,0xb2ada8a3,0xc0bdb9b5,0xc9c7c7c2,0xcccccccc,0xc2c7c7ca,0xaeb5b9be,0x51668099,0x74665646,0xbeaf9d8e,0xfff1e0cf,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xd9e5f1fe,0xacb7c1ce,0x7d8b96a0,0x555c666e,0x383f464d,0x23272c32,0x19191c1e,0x19191715,0x2f28221e,0x584c4238,0x95826e63,0xcfc1b2a4,0xfffeeddd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe8f8ffff,0xabb9c8d8,0x6a758e9c,0x69605c62,0x8a80756e,0x9e99938f,0xada8a5a2,0xb5b3b3ae,0xb8b8b8b8,0xaeb3b3b7,0x9ba2a6aa,0x51668095,0x8b716354,0xcbb9ab9c,0xfffcecdb,0xffffffff,
-0xffffffff,0xffffffff,0xfbffffff,0xc8d5e1ed,0x9ba4b2bd,0x66718090,0x424b545c,0x242b333b,0x0e13181e,0x0405080b,0x06050301,0x1d150e09,0x463b3026,0x826d5f53,0xc1b2a495,0xfff3e2d0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdcecfcff,0x9cabbbcc,0x5b66748e,0x554d474f,0x6e69645c,0x8a807874,0x9993928f,0xa29e9e9a,0xa3a3a3a3,0x9a9e9ea3,0x8a8f9396,0x5462717d,0x998b7163,0xd6c8b9a7,0xfffff7e7,0xffffffff,
-0xffffffff,0xffffffff,0xecf7ffff,0xb9c4d0dd,0x8a95a0ac,0x565f6a74,0x2f38424b,0x1e1e2028,0x1318191e,0x00040b10,0x00000000,0x0b020000,0x372a1f14,0x6d5f5042,0xb4a49582,0xf8e7d6c5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xcfe0f0ff,0x8ea0afc0,0x49586674,0x423b343e,0x5b555049,0x6b696560,0x80787570,0x8f8a8a87,0x8f8f8f8f,0x828a8a8f,0x6b707580,0x63545f65,0xa7998b71,0xe5d5c4b6,0xfffffff3,0xffffffff,
-0xffffffff,0xffffffff,0xdbe8f7ff,0xa7b4c1cf,0x6e80909c,0x444f5964,0x33332f3a,0x33333333,0x282c2e32,0x10181e23,0x00000008,0x00000000,0x261a0e03,0x5f504233,0xa999876d,0xeddccbb9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4d3e4f3,0x7d92a4b3,0x3b495869,0x2f28222d,0x47423c36,0x5955514c,0x6665615c,0x706d6b6b,0x70707070,0x6a6b6e70,0x595c6266,0x71635452,0xb6a7998b,0xf1e1d3c4,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xccdae8f7,0x99a4b2be,0x5f6a748b,0x3f3c4853,0x47474242,0x47474747,0x3c404246,0x232b3237,0x0008121b,0x00000000,0x160a0000,0x52423324,0x9d8e7163,0xe4d2c0af,0xfffffff5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7ffffff,0xb7c8d8e8,0x6d8296a7,0x2c3b4c5b,0x1d15111e,0x332f2823,0x45413c38,0x52514c48,0x5c5a5757,0x5c5c5c5c,0x56575b5c,0x49494f51,0x8b716358,0xc4b6a799,0xfef0e1d3,0xffffffff,0xffffffff,
-0xffffffff,0xf3ffffff,0xbdccdae8,0x8795a2af,0x4d596671,0x52504b46,0x5c5b5757,0x5c5c5c5c,0x5054575a,0x363c454b,0x111b242d,0x00000005,0x08000000,0x46362416,0x927d6656,0xd9c8b7a4,0xfffffeeb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe8f7ffff,0xabbbccda,0x5f718b9b,0x1f303f50,0x0902010f,0x201b1510,0x312d2824,0x3f3c3835,0x47464242,0x47474747,0x42424747,0x584c3f3c,0x998b7466,0xd3c4b6a7,0xfffef0e1,0xffffffff,0xffffffff,
-0xffffffff,0xe5f3ffff,0xafbdccd8,0x6d8292a0,0x554f5463,0x66645f5a,0x706e6b6b,0x70707070,0x64666b6d,0x4850595f,0x222d363f,0x00000a16,0x00000000,0x3a291908,0x8a6d5b4b,0xd0bdac9b,0xfffff7e4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdaeafbff,0xa0afbdcc,0x5464748e,0x13233344,0x00000003,0x0c070100,0x1d191511,0x2b282421,0x33322e2e,0x33333333,0x382f3333,0x695b5044,0xa7998e74,0xe1d3c4b6,0xfffffef0,0xffffffff,0xffffffff,
-0xffffffff,0xd8e8f7ff,0xa0afbbc8,0x5f6d7d92,0x69625b55,0x8075716d,0x8f8a8a87,0x8f8f8f8f,0x75808a8a,0x5b646a71,0x333e4852,0x000c1a26,0x00000000,0x2f1d0c00,0x7564523f,0xc9b7a490,0xffffeedb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xcee0f3ff,0x92a0afbd,0x4858697d,0x151b2737,0x04070c10,0x00000000,0x09040100,0x1714110d,0x1e1e1919,0x1f1e1e1e,0x493e3328,0x7d6d5f54,0xb6a99c8e,0xf0e1d3c4,0xfffffffe,0xffffffff,0xffffffff,
-0xffffffff,0xccdae8f7,0x92a0abbb,0x5f5b6a7d,0x80756e69,0x99938f8a,0xa39e9e9a,0xa2a3a3a3,0x93999d9e,0x6d75828e,0x424f5b64,0x0f1c2937,0x00000001,0x24120100,0x6d5b4836,0xc0ad9b8a,0xfffbe7d4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc5d9edff,0x8092a0b2,0x3f4c5b6a,0x282f333a,0x181b2023,0x0c0f1114,0x05070a0a,0x0a090605,0x15110e0a,0x3228211b,0x5b4f443b,0x92827166,0xc5b9aba0,0xfef0e1d3,0xffffffff,0xffffffff,0xffffffff,
-0xf7ffffff,0xbdccdae8,0x7d8ea0af,0x71695f6a,0x99928b80,0xaba8a39e,0xb7b3b3ae,0xb5b8b8b8,0xa6adb0b3,0x8a929aa0,0x535f6a75,0x1e2c3846,0x0000000f,0x1b080000,0x65523f2d,0xb9a69378,0xfff6e2ce,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc2d6ebff,0x6d7d99ae,0x52595f66,0x3c42474d,0x2c2f3338,0x20232428,0x191b1e1e,0x1e1e1919,0x2824221e,0x443b352f,0x6a5f564d,0xa2968b75,0xd6c8bbaf,0xfffef0e2,0xffffffff,0xffffffff,0xffffffff,
-0xe8faffff,0xafbdccda,0x6a7d92a0,0x8e807166,0xaba59d96,0xbfbbb7b2,0xcac7c7c2,0xc9cccccc,0xb9c0c4c7,0x9ba4adb4,0x636e8090,0x2c3b4954,0x00000c1b,0x12000000,0x5f4b3824,0xb5a28f71,0xffefdcc9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4d8ecff,0x8a909db0,0x666b717d,0x50555b60,0x4042474c,0x3338383c,0x2e2f3333,0x33322e2e,0x3c383633,0x564f4842,0x8271695f,0xb3a79b90,0xe5d8ccbe,0xfffffff3,0xffffffff,0xffffffff,0xffffffff,
-0xddecfbff,0xa0afbdcc,0x6d6a7d92,0xa0968e7d,0xbfb9b0a9,0xd3cfcac5,0xdddcdad6,0xdde1e1e1,0xcdd4d8dc,0xacb7c0c7,0x718b95a0,0x37485866,0x000a1a29,0x0b000000,0x5945321e,0xaf9b8a6b,0xffecd6c3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xcbddf1ff,0x9ba4acb9,0x808a8f95,0x64696e74,0x54575b60,0x474c4c51,0x42424747,0x47464242,0x514c4947,0x69625b55,0x968e8071,0xc4b7aca2,0xf3e8dbcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xcfddeefe,0x92a0b0c1,0x82716a7d,0xb2a99d92,0xd2cbc4bb,0xe7e3ddd9,0xf2f0eeeb,0xf1f5f5f5,0xe1e7ecf0,0xbdc8d2da,0x8b99a6b2,0x46546474,0x05162637,0x04000000,0x54402c18,0xad998066,0xfce8d4c0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd6e7f9ff,0xafb7bdc8,0x959ba2a9,0x75808a90,0x666b6e74,0x5c606165,0x57575b5c,0x5c5a5757,0x65615c5c,0x80756e69,0xa9a0968e,0xd3c8bdb3,0xfff7ece0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xc1d2e1f1,0x8095a4b2,0x998b746a,0xc4b9afa4,0xe6ddd6cd,0xfbf7f2ec,0xffffffff,0xffffffff,0xf3fbffff,0xced9e4ed,0x99a7b6c2,0x5363718b,0x0f223342,0x00000000,0x503c2813,0xa8937564,0xfae6d1bd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe5f3ffff,0xc2c9d0d9,0xa9afb5bb,0x93999ea4,0x808a8b8f,0x70747578,0x6b6b6e70,0x706d6b6b,0x78757070,0x99908a80,0xbbb2a9a0,0xe4d9cfc4,0xfffffcf0,0xffffffff,0xffffffff,0xffffffff,0xf8ffffff,
-0xb6c4d5e5,0x6d8295a4,0xa7998b71,0xd6cbc0b4,0xf9f1e8e0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdfeaf5ff,0xa7b6c4d3,0x5f6e8b99,0x1b2c3c4f,0x00000008,0x4c382310,0xa8937561,0xfae6d1bd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf5ffffff,0xd5dce4eb,0xbdc2c9cf,0xa8adb2b7,0x999b9fa3,0x8f8f9393,0x8a8a8a8f,0x8f8a8a8a,0x93928f8f,0xaba49e99,0xcdc4bbb2,0xf5ebe0d6,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xecfcffff,
-0xa7b9c8d8,0x716e8a99,0xb6a7998b,0xe7dcd0c4,0xfffffbf2,0xffffffff,0xfafcffff,0xfffffffc,0xffffffff,0xf0fbffff,0xb6c4d3e1,0x6a8095a6,0x24364859,0x00000012,0x4c38230f,0xa8937561,0xfae6d1bd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe8eff7fe,0xd0d5dce2,0xbbc0c5ca,0xadafb3b8,0xa3a3a8a8,0x9e9e9ea3,0xa29e9e9e,0xa8a5a3a3,0xbdb7b2ad,0xe0d6cdc5,0xfffcf2e8,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe0f0ffff,
-0x9cabbbcc,0x806a718b,0xc4b6a796,0xf8ede1d3,0xffffffff,0xffffffff,0xe6e8eef7,0xfff7eee8,0xffffffff,0xfeffffff,0xc2d3e1f0,0x7490a0b2,0x2d3f5264,0x0000081b,0x4c38230f,0xa8937561,0xfae6d1bd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfcffffff,0xe4e8eff6,0xcfd4d9dd,0xc0c3c7cc,0xb8b8bbbd,0xb3b3b3b7,0xb5b3b3b3,0xbdb9b8b8,0xd0cac5c0,0xf2e8e0d9,0xfffffffb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3e4f3ff,
-0x8ea0afc0,0x90746674,0xd3c4b2a0,0xfffef0e1,0xffffffff,0xf3ffffff,0xd1d4dbe6,0xf3e6dbd4,0xffffffff,0xffffffff,0xcedff0fe,0x8a9bacbd,0x36485b6d,0x00001124,0x4c382412,0xa8937561,0xfae6d1bd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7fcffff,0xe3e8edf2,0xd4d6dcdf,0xcccccfd1,0xc7c7c7ca,0xc9c7c7c7,0xd1cdcccc,0xe4ddd9d4,0xfffbf3eb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc8d8e8f8,
-0x7d92a4b3,0x99876d6a,0xe0cebdab,0xfffffef0,0xffffffff,0xe5f3ffff,0xbdc0c9d6,0xe5d6c9c0,0xfffffff3,0xffffffff,0xd9eafbff,0x92a4b7c8,0x3f526475,0x0b06182b,0x523f2d1b,0xa9957d65,0xfae6d2bd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7fcffff,0xe8eceff3,0xe1e1e3e6,0xdcdcdcdd,0xdddcdcdc,0xe6e1e1e1,0xf7f2ede8,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfeffffff,0xbbccdced,
-0x6d8296a7,0xa2907564,0xead9c7b4,0xfffffffb,0xffffffff,0xd6e5f3ff,0xa8adb9c8,0xd6c8b9ad,0xfffff3e5,0xffffffff,0xe4f5ffff,0x9badc0d2,0x46596b8a,0x180c2033,0x5b483728,0xaf9b8a6d,0xfce8d5c2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfcffffff,0xf5f5f7fa,0xf0f0f0f2,0xf1f0f0f0,0xf9f6f5f5,0xfffffffc,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf1ffffff,0xafc0d0e1,
-0x5f718b9b,0xab99876d,0xf3e2d0bd,0xffffffff,0xffffffff,0xc8d6e5f3,0x939cabb9,0xc8b9ab9c,0xfff3e5d6,0xffffffff,0xedffffff,0xa2b5c9db,0x4d60748f,0x2416263a,0x64544534,0xb7a49275,0xffefdcc9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe3f3ffff,0xa0b2c1d2,
-0x6662718b,0xb7a49278,0xffeddbc9,0xffffffff,0xf0feffff,0xb6c4d3e1,0x718b99a7,0xb6a7998b,0xf0e1d3c4,0xfffffffe,0xf7ffffff,0xaabdd0e4,0x54668096,0x37292c40,0x74645446,0xc2b09d8e,0xfff9e7d4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd8e8f8ff,0x95a4b6c7,
-0x715f6675,0xc0ad9c8b,0xfff7e4d2,0xffffffff,0xe1f0feff,0xa7b6c4d3,0x63718b99,0xa7998b71,0xe1d3c4b6,0xfffffef0,0xfeffffff,0xb0c4d6ea,0x596b8a9d,0x46373145,0x8b716354,0xcbb9ab99,0xfffff0dd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xccdcedfe,0x8a99abbb,
-0x826d5f6a,0xc9b9a796,0xffffeddb,0xffffffff,0xd3e1f0fe,0x99a7b6c4,0x5463718b,0x998b7163,0xd3c4b6a7,0xfffef0e1,0xffffffff,0xb5c9ddf1,0x5c708fa2,0x54463748,0x998b7163,0xd6c7b6a7,0xfffff9e7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc0d0e1f1,0x748ea0af,
-0x95806d5f,0xd5c4b3a4,0xfffff7e6,0xfeffffff,0xc4d3e1f0,0x8b99a7b6,0x46546371,0x8b716354,0xc4b6a799,0xfef0e1d3,0xffffffff,0xb9cde1f6,0x617592a5,0x6354464c,0xa7998b71,0xe3d3c4b6,0xfffffff3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7ffffff,0xb4c4d5e6,0x697d92a4,
-0xa092826d,0xe0cfc1b0,0xfffffff1,0xf0ffffff,0xb6c4d3e1,0x718b99a7,0x37465463,0x71635446,0xb6a7998b,0xf0e1d3c4,0xffffffff,0xbdd1e6f9,0x627593a8,0x7163544f,0xb6a7998b,0xf0e1d3c4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xeafbffff,0xa7b9c9da,0x6e6d8299,
-0xafa2958a,0xecddccbd,0xfffffffc,0xe3f3ffff,0xa7b6c4d3,0x63718b99,0x29374654,0x63544637,0xa7998b71,0xe2d3c4b6,0xfffffff3,0xbed2e6fb,0x668096aa,0x8b716354,0xc4b6a799,0xfef0e1d3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe0f3ffff,0x9cadbdce,0x8b74718b,
-0xbeb2a499,0xfae8dacc,0xffffffff,0xd9ecffff,0x99a7b6c7,0x5463718b,0x1a293746,0x54463729,0x998b7163,0xd6c5b6a7,0xfffffce8,0xc2d6eafe,0x668099ae,0x998b7163,0xd3c4b6a7,0xfffef0e1,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd9edffff,0x92a0b2c5,0x9b908075,
-0xcfc1b6a9,0xfff7e8db,0xffffffff,0xd3e7fbff,0x8b99abbf,0x46546371,0x0c1a2937,0x4637291a,0x8b716354,0xcfbba999,0xfffff7e3,0xc2d6ebff,0x698099ae,0xa7998b74,0xe1d3c4b6,0xfffffef0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd6ebffff,0x8099aec2,0xaca0958a,
-0xddd2c5b9,0xfffff7ec,0xffffffff,0xd1e6faff,0x7493a8bd,0x3b495866,0x010f1e2c,0x3b2c1e0f,0x74665849,0xccb8a38f,0xfffff5e1,0xc2d6ebff,0x7d8099ae,0xb6a7998e,0xf0e1d3c4,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd9edffff,0x95a0b2c5,0xbdb2a499,
-0xeee2d6cb,0xfffffffb,0xffffffff,0xd4e8fcff,0x8e9cadc0,0x49586674,0x0f1e2c3b,0x493b2c1e,0x8b746658,0xcfbba999,0xfffff7e3,0xc4d8ecff,0x95909db0,0xc4b6aba0,0xfef0e1d3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe0f3ffff,0xa9b0bdce,0xcec1b6ab,
-0xfff3e7dc,0xffffffff,0xffffffff,0xdbeeffff,0x9cabb9c9,0x5866748e,0x1e2c3b49,0x58493b2c,0x998b7466,0xd6c5b6a7,0xfffffce8,0xcbddf1ff,0xa6a4acb9,0xd3c7bbb0,0xfffef0e1,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xeafbffff,0xbdc2ccda,0xddd2c7bf,
-0xfffff8ed,0xffffffff,0xffffffff,0xe6f7ffff,0xabb9c8d6,0x66748e9c,0x2c3b4958,0x6658493b,0xa7998b74,0xe2d3c4b6,0xfffffff3,0xd6e7f9ff,0xb9b8bdc8,0xe3d8ccc2,0xfffffef0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7ffffff,0xd2d5dde8,0xeee3d9d3,
-0xfffffffe,0xffffffff,0xffffffff,0xf3ffffff,0xb9c8d6e5,0x748e9cab,0x3b495866,0x74665849,0xb6a7998b,0xf0e1d3c4,0xffffffff,0xe5f3ffff,0xceccd0d9,0xf3e8ddd4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe6e8f0fa,0xfff3ece7,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc8d6e5f3,0x8e9cabb9,0x49586674,0x8b746658,0xc4b6a799,0xfef0e1d3,0xffffffff,0xf5ffffff,0xe2e1e4eb,0xfffaf0e7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfafcffff,0xfffffffb,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd6e5f3ff,0x9cabb9c8,0x5866748e,0x998b7466,0xd3c4b6a7,0xfffef0e1,0xffffffff,0xffffffff,0xf6f5f8fe,0xfffffffb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe5f3ffff,0xabb9c8d6,0x66748e9c,0xa7998b74,0xe1d3c4b6,0xfffffef0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf3ffffff,0xb9c8d6e5,0x748e9cab,0xb6a7998b,0xf0e1d3c4,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc8d6e5f3,0x939cabb9,0xc4b6a799,0xfef0e1d3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd6e5f3ff,0xa8adb9c8,0xd3c4b6ab,0xfffef0e1,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe5f3ffff,0xbdc0c9d6,0xe1d3c7bf,0xfffffef0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf3ffffff,0xd1d4dbe6,0xf0e3d9d3,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe6e8eef7,0xfff3ece7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfafcffff,0xfffffffb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0 };
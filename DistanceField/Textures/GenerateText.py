@@ -73,11 +73,34 @@ alphaChannel.save("SmallText.png")
 
 showImage("SmallText.png")
 
-# Convert to header files:
+# Cook the textures:
 
 if True:
-    path = '/Users/prideout/Documents/PowerVR-ES2/Utilities/PVRTexTool/PVRTexToolCL/MacOS/'
-    system(path + 'PVRTexTool -h -yflip1 -fOGL8 -iText.png')
-    system(path + 'PVRTexTool -h -yflip1 -fOGL8 -iSmallText.png')
-    system(path + 'PVRTexTool -h -yflip1 -fOGL565 -iTile.png')
+    # Build with: g++ -O2 -o TextureCooker TextureCooker.cpp -lpng -lpthread
+    tool = '../../Common/Tools/TextureCooker'
+    system(tool + ' -f 8 -m none Text.png Text.pvr')
+    system(tool + ' -f 8 -m none SmallText.png SmallText.pvr')
+    system(tool + ' -f 565 -m none Tile.png Tile.pvr')
 
+
+# Multi-channel distance fields for the ES2 labels, at half the resolution
+# in each direction:
+
+if True:
+    # Build with: g++ -O2 -o GlyphAtlasGenerator GlyphAtlasGenerator.cpp -lpng -lpthread
+    #                 `pkg-config --cflags --libs freetype2`
+    tool = '../../Common/Tools/GlyphAtlasGenerator'
+    font = '/usr/share/fonts/truetype/dejavu/DejaVuSans-Bold.ttf'
+    system(tool + ' -p 12 -l "Alpha Blended@10.5" -l "Alpha Tested@32" ' +
+           '-l "Distance Field@53" ' + font + ' TextMsdf.pvr')
+    system(tool + ' -p 10 -l "Smooth@8" -l "Outline@24" -l "Glow@40" -l "Shadow@56" ' +
+           font + ' SmallTextMsdf.pvr')
+
+# Pack everything the renderers load, including the distance fields from
+# GenerateDistanceField.py:
+
+if True:
+    # Build with: g++ -O2 -o AssetPacker AssetPacker.cpp
+    tool = '../../Common/Tools/AssetPacker'
+    system(tool + ' Textures.pack DistanceField.pvr SmallAum.pvr Tile.pvr Text.pvr ' +
+           'TextMsdf.pvr SmallTextMsdf.pvr')
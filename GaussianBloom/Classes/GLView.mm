@@ -1,9 +1,18 @@
 #import "GLView.h"
-#include "../Textures/TombWindow.h"
-#include "../Textures/Circle.h"
+#include "../../Common/Classes/GlTrace.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#import <string>
 
 #define GL_RENDERBUFFER 0x8d41
 
+std::string GetResourcePath(const std::string& file)
+{
+    NSString* basePath = [NSString stringWithUTF8String:file.c_str()];
+    NSString* resourcePath = [[NSBundle mainBundle] resourcePath];
+    NSString* fullPath = [resourcePath stringByAppendingPathComponent:basePath];
+    return [fullPath UTF8String];
+}
+
 @implementation GLView
 
 + (Class) layerClass
@@ -62,6 +71,8 @@
     
     m_renderingEngine->Render(m_theta);
     [m_context presentRenderbuffer:GL_RENDERBUFFER];
+    PROFILE_FRAME();
+    GL_TRACE_FRAME();
 }
 
 - (void) touchesBegan: (NSSet*) touches withEvent: (UIEvent*) event
@@ -2,9 +2,6 @@
 #include "Vector.hpp"
 #include <vector>
 
-extern const unsigned int TombWindow[];
-extern const unsigned int Circle[];
-
 enum VertexFlags {
     VertexFlagsNormals = 1 << 0,
     VertexFlagsTexCoords = 1 << 1,
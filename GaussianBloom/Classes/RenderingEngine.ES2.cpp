@@ -1,8 +1,15 @@
 #include <OpenGLES/ES2/gl.h>
 #include <OpenGLES/ES2/glext.h>
+#include "../../Common/Classes/GlTraceHooks.hpp"
+#include "../../Common/Classes/GlStateCache.hpp"
 #include "ParametricSurface.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/AssetPack.hpp"
+#include "../../Common/Classes/PvrUpload.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include "../../Common/Classes/RenderGraph.hpp"
 #include <iostream>
+#include <map>
 
 #define STRINGIFY(A)  #A
 #include "../Shaders/Blitting.es2.vert"
@@ -13,40 +20,44 @@
 #include "../Shaders/HighPass.es2.frag"
 #include "../Shaders/Sun.es2.vert"
 
+std::string GetResourcePath(const std::string& file);
+
 using namespace std;
 
 namespace ES2 {
 
-struct PVRTextureHeader {
-    unsigned int HeaderSize;
-    unsigned int Height;
-    unsigned int Width;
-};
-
 const int OffscreenCount = 5;
 const bool Optimize = true;
+
+// Each offscreen pass and the inputs it samples; the render graph decides
+// which ones run and where they draw.
+enum PassKind {
+    PassKindScene,
+    PassKindHighPass,
+    PassKindDownsample,
+    PassKindHorizontalBlur,
+    PassKindVerticalBlur,
+    PassKindComposite,
+};
+
+struct Pass {
+    PassKind Kind;
+    int Level;
+    std::vector<int> Inputs;
+    GLuint Framebuffer;
+};
     
 struct Framebuffers {
     GLuint Onscreen;
-    GLuint Scene;
-    GLuint OffscreenLeft[OffscreenCount];
-    GLuint OffscreenRight[OffscreenCount];
 };
 
 struct Renderbuffers {
     GLuint Onscreen;
-    GLuint OffscreenLeft[OffscreenCount];
-    GLuint OffscreenRight[OffscreenCount];
-    GLuint SceneColor;
-    GLuint SceneDepth;
 };
 
 struct Textures {
     GLuint TombWindow;
     GLuint Sun;
-    GLuint Scene;
-    GLuint OffscreenLeft[OffscreenCount];
-    GLuint OffscreenRight[OffscreenCount];
 };
 
 struct Drawable {
@@ -102,14 +113,23 @@ private:
     GLuint BuildShader(const char* source, GLenum shaderType) const;
     void BuildProgram(const char* vs, const char* fs, ProgramHandles&) const;
     GLuint CreateFboTexture(int w, int h) const;
+    int AddPass(const char* name, PassKind kind, int level);
+    void Read(int pass, int resource);
+    void CreateOffscreenSurfaces();
+    void RenderScene(float theta) const;
+    void RenderPass(const Pass& pass) const;
     Textures m_textures;
     Drawable m_kleinBottle;
     Drawable m_quad;
     Renderbuffers m_renderbuffers;
     Framebuffers m_framebuffers;
     Programs m_programs;
+    RenderGraph m_graph;
+    std::vector<Pass> m_passes;
+    std::vector<GLuint> m_slots;
     ivec2 m_size;
     vec3 m_sunPosition;
+    AssetPack m_assets;
 };
 
 IRenderingEngine* CreateRenderingEngine()
@@ -146,41 +166,136 @@ GLuint RenderingEngine::CreateFboTexture(int w, int h) const
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
     return texture;
 }
 
+int RenderingEngine::AddPass(const char* name, PassKind kind, int level)
+{
+    Pass pass;
+    pass.Kind = kind;
+    pass.Level = level;
+    pass.Framebuffer = 0;
+    m_passes.push_back(pass);
+    int index = m_graph.AddPass(name);
+    assert(index == (int) m_passes.size() - 1);
+    return index;
+}
+
+void RenderingEngine::Read(int pass, int resource)
+{
+    m_graph.Read(pass, resource);
+    m_passes[pass].Inputs.push_back(resource);
+}
+
+static GLenum GetAttachment(RenderGraphFormat format)
+{
+    switch (format) {
+        case RenderGraphFormatDepth16:
+        case RenderGraphFormatDepth24: return GL_DEPTH_ATTACHMENT;
+        case RenderGraphFormatStencil8: return GL_STENCIL_ATTACHMENT;
+        default: return GL_COLOR_ATTACHMENT0;
+    }
+}
+
+static GLbitfield GetClearBit(RenderGraphFormat format)
+{
+    switch (format) {
+        case RenderGraphFormatDepth16:
+        case RenderGraphFormatDepth24: return GL_DEPTH_BUFFER_BIT;
+        case RenderGraphFormatStencil8: return GL_STENCIL_BUFFER_BIT;
+        default: return GL_COLOR_BUFFER_BIT;
+    }
+}
+
+// Allocates a texture or renderbuffer for each slot the graph handed out,
+// and one FBO for each distinct set of attachments.
+void RenderingEngine::CreateOffscreenSurfaces()
+{
+    const std::vector<RenderGraphSlot>& slots = m_graph.GetSlots();
+    m_slots.resize(slots.size());
+    for (size_t i = 0; i < slots.size(); ++i) {
+        const RenderGraphSlot& slot = slots[i];
+        if (slot.Texture) {
+            assert(slot.Format == RenderGraphFormatRgba8);
+            m_slots[i] = CreateFboTexture(slot.Width, slot.Height);
+            continue;
+        }
+        GLenum format = GL_RGBA8_OES;
+        switch (slot.Format) {
+            case RenderGraphFormatRgb565: format = GL_RGB565; break;
+            case RenderGraphFormatDepth16: format = GL_DEPTH_COMPONENT16; break;
+            case RenderGraphFormatDepth24: format = GL_DEPTH_COMPONENT24_OES; break;
+            case RenderGraphFormatStencil8: format = GL_STENCIL_INDEX8; break;
+            default: break;
+        }
+        glGenRenderbuffers(1, &m_slots[i]);
+        glBindRenderbuffer(GL_RENDERBUFFER, m_slots[i]);
+        glRenderbufferStorage(GL_RENDERBUFFER, format, slot.Width, slot.Height);
+    }
+
+    std::map<std::vector<int>, GLuint> framebuffers;
+    const std::vector<RenderGraphStep>& steps = m_graph.GetSteps();
+    for (size_t i = 0; i < steps.size(); ++i) {
+        const RenderGraphStep& step = steps[i];
+        std::vector<int> key;
+        for (size_t j = 0; j < step.Outputs.size(); ++j)
+            key.push_back(step.Outputs[j].Slot);
+        if (key.size() == 1 && key[0] < 0) {
+            m_passes[step.Pass].Framebuffer = m_framebuffers.Onscreen;
+            continue;
+        }
+        GLuint& framebuffer = framebuffers[key];
+        if (!framebuffer) {
+            glGenFramebuffers(1, &framebuffer);
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            for (size_t j = 0; j < key.size(); ++j) {
+                assert(key[j] >= 0 && "Passes can't mix onscreen and offscreen outputs.");
+                const RenderGraphSlot& slot = slots[key[j]];
+                GLenum attachment = GetAttachment(slot.Format);
+                if (slot.Texture)
+                    glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D,
+                                           m_slots[key[j]], 0);
+                else
+                    glFramebufferRenderbuffer(GL_FRAMEBUFFER, attachment, GL_RENDERBUFFER,
+                                              m_slots[key[j]]);
+            }
+        }
+        m_passes[step.Pass].Framebuffer = framebuffer;
+    }
+    glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers.Onscreen);
+}
+
 void RenderingEngine::Initialize()
 {
+    // Load the textures.  The pack stays mapped, but once GL has a copy of
+    // each texture its pages can go.
+    string packPath = GetResourcePath("Textures.pack");
+    if (m_assets.Open(packPath.c_str()) != AssetPackErrorNone)
+        cout << packPath << ": " << AssetPack::GetErrorString(m_assets.GetError()) << ".\n";
+    AssetEntry tombWindowEntry = m_assets.Find("TombWindow");
+    AssetEntry circleEntry = m_assets.Find("Circle");
+
     // Load the background texture:
+    PvrTexture tombWindow;
+    tombWindow.Parse(tombWindowEntry.Data, tombWindowEntry.Size);
+    assert(tombWindow.IsValid() && "Bad TombWindow texture.");
     glGenTextures(1, &m_textures.TombWindow);
     glBindTexture(GL_TEXTURE_2D, m_textures.TombWindow);
-    {
-        PVRTextureHeader* header = (PVRTextureHeader*) TombWindow;
-        GLsizei w = header->Width;
-        GLsizei h = header->Height;
-        const unsigned int* texels = TombWindow + header->HeaderSize / 4;
-        GLenum format = GL_RGB;
-        GLenum type = GL_UNSIGNED_SHORT_5_6_5;
-        glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-    }
+    UploadPvrTexture(tombWindow);
+    m_assets.Release(tombWindowEntry);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
     // Load the sun texture:
+    PvrTexture circle;
+    circle.Parse(circleEntry.Data, circleEntry.Size);
+    assert(circle.IsValid() && "Bad Circle texture.");
     glGenTextures(1, &m_textures.Sun);
     glBindTexture(GL_TEXTURE_2D, m_textures.Sun);
-    {
-        PVRTextureHeader* header = (PVRTextureHeader*) Circle;
-        GLsizei w = header->Width;
-        GLsizei h = header->Height;
-        const unsigned int* texels = Circle + header->HeaderSize / 4;
-        GLenum format = GL_LUMINANCE;
-        GLenum type = GL_UNSIGNED_BYTE;
-        glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-    }
+    UploadPvrTexture(circle, GL_TEXTURE_2D, GL_LUMINANCE);
+    m_assets.Release(circleEntry);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
@@ -199,41 +314,49 @@ void RenderingEngine::Initialize()
                               GL_RENDERBUFFER, m_renderbuffers.Onscreen);
     glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers.Onscreen);
 
-    // Create the depth buffer for the full-size off-screen FBO:
-    glGenRenderbuffers(1, &m_renderbuffers.SceneDepth);
-    glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers.SceneDepth);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, m_size.x, m_size.y);
-    glGenRenderbuffers(1, &m_renderbuffers.SceneColor);
-    glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers.SceneColor);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8_OES, m_size.x, m_size.y);
-    glGenFramebuffers(1, &m_framebuffers.Scene);
-    glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffers.Scene);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
-                              GL_RENDERBUFFER, m_renderbuffers.SceneColor);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
-                              GL_RENDERBUFFER, m_renderbuffers.SceneDepth);
-    m_textures.Scene = CreateFboTexture(m_size.x, m_size.y);
-    
-    // Create FBOs for the half, quarter, and eighth sizes:
+    // Describe the bloom chain.  Blurs that the composite never samples
+    // get culled, and levels that are done with their storage hand it on.
     int w = m_size.x, h = m_size.y;
+    int sceneColor = m_graph.CreateResource("SceneColor", w, h, RenderGraphFormatRgba8);
+    int sceneDepth = m_graph.CreateResource("SceneDepth", w, h, RenderGraphFormatDepth16);
+    int onscreen = m_graph.ImportResource("Onscreen");
+    int scene = AddPass("Scene", PassKindScene, 0);
+    m_graph.Write(scene, sceneColor);
+    m_graph.Write(scene, sceneDepth);
+
+    int bloom[OffscreenCount];
+    int source = sceneColor;
     for (int i = 0; i < OffscreenCount; ++i, w >>= 1, h >>= 1) {
-        glGenRenderbuffers(1, &m_renderbuffers.OffscreenLeft[i]);
-        glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers.OffscreenLeft[i]);
-        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8_OES, w, h);
-        glGenFramebuffers(1, &m_framebuffers.OffscreenLeft[i]);
-        glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffers.OffscreenLeft[i]);
-        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
-                                  GL_RENDERBUFFER, m_renderbuffers.OffscreenLeft[i]);
-        m_textures.OffscreenLeft[i] = CreateFboTexture(w, h);
-
-        glGenRenderbuffers(1, &m_renderbuffers.OffscreenRight[i]);
-        glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers.OffscreenRight[i]);
-        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8_OES, w, h);
-        glGenFramebuffers(1, &m_framebuffers.OffscreenRight[i]);
-        glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffers.OffscreenRight[i]);
-        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_renderbuffers.OffscreenRight[i]);
-        m_textures.OffscreenRight[i] = CreateFboTexture(w, h);
+        bloom[i] = m_graph.CreateResource("Downsampled", w, h, RenderGraphFormatRgba8);
+        int pass = i ? AddPass("Downsample", PassKindDownsample, i) :
+                       AddPass("HighPass", PassKindHighPass, i);
+        Read(pass, source);
+        m_graph.Write(pass, bloom[i]);
+        source = bloom[i];
     }
+
+    w = m_size.x; h = m_size.y;
+    for (int i = 0; i < OffscreenCount; ++i, w >>= 1, h >>= 1) {
+        int horizontal = m_graph.CreateResource("HorizontalBlur", w, h, RenderGraphFormatRgba8);
+        int vertical = m_graph.CreateResource("VerticalBlur", w, h, RenderGraphFormatRgba8);
+        int pass = AddPass("HorizontalBlur", PassKindHorizontalBlur, i);
+        Read(pass, bloom[i]);
+        m_graph.Write(pass, horizontal);
+        pass = AddPass("VerticalBlur", PassKindVerticalBlur, i);
+        Read(pass, horizontal);
+        m_graph.Write(pass, vertical);
+        if (!Optimize || i >= 2)
+            bloom[i] = vertical;
+    }
+
+    int composite = AddPass("Composite", PassKindComposite, 0);
+    Read(composite, sceneColor);
+    for (int i = 1; i < OffscreenCount; ++i)
+        Read(composite, bloom[i]);
+    m_graph.Write(composite, onscreen);
+
+    m_graph.Compile();
+    CreateOffscreenSurfaces();
     
     // Create the GLSL programs:
     BuildProgram(BlittingVertexShader, BlittingFragmentShader, m_programs.Blit);
@@ -248,6 +371,13 @@ void RenderingEngine::Initialize()
     glUniform3f(m_programs.Light.Uniforms.AmbientMaterial, 0.04f, 0.04f, 0.04f);
     glUniform3f(m_programs.Light.Uniforms.SpecularMaterial, 0.6f, 0.5f, 0.5f);
     glUniform1f(m_programs.Light.Uniforms.Shininess, 50);
+
+    // Set up the high-pass filter and the gaussian kernel:
+    float kernel[3] = { 5.0f / 16.0f, 6 / 16.0f, 5 / 16.0f };
+    glUseProgram(m_programs.Blur.Program);
+    glUniform1fv(m_programs.Blur.Uniforms.Coefficients, 3, kernel);
+    glUseProgram(m_programs.HighPass.Program);
+    glUniform1f(m_programs.HighPass.Uniforms.Threshold, 0.85);
     
     // Set up the transforms:
     const float NearPlane = 5, FarPlane = 50;
@@ -267,13 +397,46 @@ void RenderingEngine::Initialize()
 
 void RenderingEngine::Render(float theta) const
 {
-    glViewport(0, 0, m_size.x, m_size.y);
-    glEnable(GL_DEPTH_TEST);
+    PROFILE_ZONE("ES2::RenderingEngine::Render");
+    const std::vector<RenderGraphStep>& steps = m_graph.GetSteps();
+    const std::vector<RenderGraphSlot>& slots = m_graph.GetSlots();
+    for (size_t i = 0; i < steps.size(); ++i) {
+        const RenderGraphStep& step = steps[i];
+        const Pass& pass = m_passes[step.Pass];
+        glBindFramebuffer(GL_FRAMEBUFFER, pass.Framebuffer);
+        glViewport(0, 0, m_size.x >> pass.Level, m_size.y >> pass.Level);
+
+        // Attachments that the pass draws over completely start cleared,
+        // so a tiler needn't load what was there:
+        GLbitfield clear = 0;
+        for (size_t j = 0; j < step.Outputs.size(); ++j)
+            if (!step.Outputs[j].Load && step.Outputs[j].Slot >= 0)
+                clear |= GetClearBit(slots[step.Outputs[j].Slot].Format);
+        if (clear)
+            glClear(clear);
+
+        if (pass.Kind == PassKindScene)
+            RenderScene(theta);
+        else
+            RenderPass(pass);
+
+        // Nor need it store the ones that nothing samples afterwards:
+#ifdef GL_EXT_discard_framebuffer
+        GLenum discards[4];
+        GLsizei discardCount = 0;
+        for (size_t j = 0; j < step.Outputs.size() && discardCount < 4; ++j)
+            if (step.Outputs[j].Discard)
+                discards[discardCount++] = GetAttachment(slots[step.Outputs[j].Slot].Format);
+        if (discardCount)
+            glDiscardFramebufferEXT(GL_FRAMEBUFFER, discardCount, discards);
+#endif
+    }
+}
 
-    // Set the render target to the full size offscreen buffer:
+void RenderingEngine::RenderScene(float theta) const
+{
+    glEnable(GL_DEPTH_TEST);
     glBindTexture(GL_TEXTURE_2D, m_textures.TombWindow);
-    glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffers.Scene);
-    glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers.SceneColor);
 
     // Blit the background texture:
     glUseProgram(m_programs.Blit.Program);
@@ -323,78 +486,64 @@ void RenderingEngine::Render(float theta) const
     glDepthFunc(GL_LESS);
     glEnableVertexAttribArray(m_programs.Light.Attributes.Normal);
     RenderDrawable(m_kleinBottle, m_programs.Light);
-    
-    // Set up the high-pass filter:
-    glUseProgram(m_programs.HighPass.Program);
-    glUniform1f(m_programs.HighPass.Uniforms.Threshold, 0.85);
     glDisable(GL_DEPTH_TEST);
+}
 
-    // Downsample the rendered scene:
-    int w = m_size.x, h = m_size.y;
-    for (int i = 0; i < OffscreenCount; ++i, w >>= 1, h >>= 1) {
-        glViewport(0, 0, w, h);
-        glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffers.OffscreenLeft[i]);
-        glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers.OffscreenLeft[i]);
-        glBindTexture(GL_TEXTURE_2D, i ? m_textures.OffscreenLeft[i - 1] :
-                                         m_textures.Scene);
-        if (i == 0) {
+void RenderingEngine::RenderPass(const Pass& pass) const
+{
+    int w = m_size.x >> pass.Level, h = m_size.y >> pass.Level;
+    const GLuint source = m_slots[m_graph.GetSlot(pass.Inputs[0])];
+    switch (pass.Kind) {
+        case PassKindHighPass: {
+            PROFILE_ZONE("High-pass");
+            glUseProgram(m_programs.HighPass.Program);
+            glBindTexture(GL_TEXTURE_2D, source);
             RenderDrawable(m_quad, m_programs.HighPass);
+            break;
+        }
+        case PassKindDownsample: {
+            PROFILE_ZONE("Downsample");
             glUseProgram(m_programs.Blit.Program);
-        } else {
+            glBindTexture(GL_TEXTURE_2D, source);
             RenderDrawable(m_quad, m_programs.Blit);
+            break;
         }
-    }
-    
-    // Set up for gaussian blur:
-    float kernel[3] = { 5.0f / 16.0f, 6 / 16.0f, 5 / 16.0f };
-    glUseProgram(m_programs.Blur.Program);
-    glUniform1fv(m_programs.Blur.Uniforms.Coefficients, 3, kernel);
-
-    // Perform the horizontal blurring pass:
-    w = m_size.x; h = m_size.y;
-    for (int i = 0; i < OffscreenCount; ++i, w >>= 1, h >>= 1) {
-        if (Optimize && i < 2)
-            continue;
-        float offset = 1.2f / (float) w;
-        glUniform2f(m_programs.Blur.Uniforms.Offset, offset, 0);
-        glViewport(0, 0, w, h);
-        glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffers.OffscreenRight[i]);
-        glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers.OffscreenRight[i]);
-        glBindTexture(GL_TEXTURE_2D, m_textures.OffscreenLeft[i]);
-        RenderDrawable(m_quad, m_programs.Blur);
-    }
-
-    // Perform the vertical blurring pass:
-    w = m_size.x; h = m_size.y;
-    for (int i = 0; i < OffscreenCount; ++i, w >>= 1, h >>= 1) {
-        if (Optimize && i < 2)
-            continue;
-        float offset = 1.2f / (float) h;
-        glUniform2f(m_programs.Blur.Uniforms.Offset, 0, offset);
-        glViewport(0, 0, w, h);
-        glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffers.OffscreenLeft[i]);
-        glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers.OffscreenLeft[i]);
-        glBindTexture(GL_TEXTURE_2D, m_textures.OffscreenRight[i]);
-        RenderDrawable(m_quad, m_programs.Blur);
-    }
-
-    // Blit the full-color buffer onto the screen:
-    glUseProgram(m_programs.Blit.Program);
-    glViewport(0, 0, m_size.x, m_size.y);
-    glDisable(GL_BLEND);
-    glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffers.Onscreen);
-    glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers.Onscreen);
-    glBindTexture(GL_TEXTURE_2D, m_textures.Scene);
-    RenderDrawable(m_quad, m_programs.Blit);
+        case PassKindHorizontalBlur: {
+            PROFILE_ZONE("Horizontal blur");
+            glUseProgram(m_programs.Blur.Program);
+            glUniform2f(m_programs.Blur.Uniforms.Offset, 1.2f / (float) w, 0);
+            glBindTexture(GL_TEXTURE_2D, source);
+            RenderDrawable(m_quad, m_programs.Blur);
+            break;
+        }
+        case PassKindVerticalBlur: {
+            PROFILE_ZONE("Vertical blur");
+            glUseProgram(m_programs.Blur.Program);
+            glUniform2f(m_programs.Blur.Uniforms.Offset, 0, 1.2f / (float) h);
+            glBindTexture(GL_TEXTURE_2D, source);
+            RenderDrawable(m_quad, m_programs.Blur);
+            break;
+        }
+        case PassKindComposite: {
+            // Blit the full-color buffer onto the screen:
+            glUseProgram(m_programs.Blit.Program);
+            glBindTexture(GL_TEXTURE_2D, source);
+            RenderDrawable(m_quad, m_programs.Blit);
 
-    // Accumulate the bloom textures onto the screen:
-    glBlendFunc(GL_ONE, GL_ONE);
-    glEnable(GL_BLEND);
-    for (int i = 1; i < OffscreenCount; ++i) {
-        glBindTexture(GL_TEXTURE_2D, m_textures.OffscreenLeft[i]);
-        RenderDrawable(m_quad, m_programs.Blit);
+            // Accumulate the bloom textures onto the screen:
+            glBlendFunc(GL_ONE, GL_ONE);
+            glEnable(GL_BLEND);
+            for (size_t i = 1; i < pass.Inputs.size(); ++i) {
+                PROFILE_ZONE("Accumulate");
+                glBindTexture(GL_TEXTURE_2D, m_slots[m_graph.GetSlot(pass.Inputs[i])]);
+                RenderDrawable(m_quad, m_programs.Blit);
+            }
+            glDisable(GL_BLEND);
+            break;
+        }
+        default:
+            break;
     }
-    glDisable(GL_BLEND);
 }
 
 GLuint RenderingEngine::BuildShader(const char* source, GLenum shaderType) const
@@ -15,10 +15,6 @@ def ShowImage(image):
     elif uname()[0] == 'Darwin': system('open ' + image)
     else: system('start ' + image)
 
-path = '/Users/prideout/Documents/PowerVR-ES2/Utilities/'
-textool565 = 'PVRTexTool/PVRTexToolCL/MacOS/PVRTexTool -h -yflip1 -fOGL565 -i'
-textool8 = 'PVRTexTool/PVRTexToolCL/MacOS/PVRTexTool -h -yflip1 -fOGL8 -i'
-
 imagesize = (64,64)
 viewport = imagesize
 surface = cairo.ImageSurface(cairo.FORMAT_ARGB32, *imagesize)
@@ -31,16 +27,10 @@ cr.fill()
 surface.write_to_png("Circle.png")
 ShowImage('Circle.png')
 
-system(path + textool565 + "TombWindow.jpg")
-system(path + textool8 + "Circle.png")
-
-images = []
-images.append('TombWindow.h')
-images.append('Circle.h')
-
-fromStr = "static const unsigned long" 
-toStr = "const unsigned int" 
-
-for filename in images:
-	for line in fileinput.FileInput(filename, inplace=1):
-		print line.replace(fromStr, toStr),
+# Build with: g++ -O2 -o TextureCooker TextureCooker.cpp -lpng -lpthread
+#             g++ -O2 -o AssetPacker AssetPacker.cpp
+tools = '../../Common/Tools/'
+Image.open("TombWindow.jpg").save("TombWindow.png")
+system(tools + 'TextureCooker -f 565 -m none TombWindow.png TombWindow.pvr')
+system(tools + 'TextureCooker -f 8 -m none Circle.png Circle.pvr')
+system(tools + 'AssetPacker Textures.pack TombWindow.pvr Circle.pvr')
@@ -1,2428 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT const unsigned int
-#endif
-
-A32BIT TombWindow[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x000001e0,		/* dwHeight */
-0x00000140,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00010013,		/* dwpfFlags */
-0x0004b000,		/* dwDataSize */
-0x00000010,		/* dwBitCount */
-0x0000f800,		/* dwRBitMask */
-0x000007e0,		/* dwGBitMask */
-0x0000001f,		/* dwBBitMask */
-0x00000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08200000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x10200820,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610820,0x10411881,0x10401020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10810000,0x31652924,0x082020c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x294418a2,0x000018c3,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00200000,0x00000020,0x00200000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200820,0x08000820,0x00000000,0x00000000,0x08000000,0x08000800,0x08000800,0x00000000,0x00000800,0x00000000,
-0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x08200020,0x00000820,0x00200000,0x00200020,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000820,0x08200800,0x00000820,0x00000000,0x00200000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00200000,0x00200000,0x00200000,0x00200020,0x00200020,0x00200020,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200800,0x00000800,0x00000000,0x00000000,0x08000000,0x08200800,0x10410800,0x08001020,0x08000800,0x00000800,
-0x00000020,0x00000000,0x00000000,0x08000000,0x08000820,0x08000800,0x08000800,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x10200800,0x10201040,0x08200800,0x08000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08000000,0x08000800,0x08000800,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x00000000,0x00000000,0x00200020,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400820,0x08201020,0x00200020,0x00000000,0x08000800,0x10401020,0x20a21861,0x10411840,0x08201040,0x00001040,
-0x00000000,0x00000000,0x00000000,0x08200800,0x10611882,0x10401041,0x08201020,0x08200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200800,0x18811041,0x28812061,0x20602881,0x20612040,0x18612081,0x08001020,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08000800,0x00000800,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200800,0x10001000,0x10001000,0x00200800,0x00000000,0x00000000,0x00000000,0x08200820,0x18601040,0x18401840,0x18201820,0x08000800,0x08410820,0x00000820,0x00000000,0x00000000,0x00000000,0x08000800,0x00000800,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000800,0x10000800,0x18201020,0x18201820,0x10001000,0x10001000,0x08000800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,
-0x00000020,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x20a21861,0x20a228a2,0x08200820,0x00000000,0x08200000,0x18611040,0x30c228c2,0x28802040,0x10002080,0x10401040,
-0x00000000,0x00000000,0x00000000,0x10400820,0x28a120a2,0x28c128a1,0x18402081,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200800,0x20821061,0x38e22881,0x49644944,0x41024943,0x28a130c2,0x186128a2,0x08001000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x10610841,0x10411041,0x10001020,
-0x08001000,0x00000000,0x00000000,0x00000000,0x08000000,0x20401820,0x20202020,0x20202020,0x10001000,0x00000800,0x00200000,0x00200020,0x10400820,0x30e320a2,0x41233923,0x41034103,0x20813903,0x18201800,0x08201840,0x00000000,0x00000000,0x10000800,0x10001000,0x10201020,0x08200820,0x00000020,0x00000000,0x00000000,0x00200000,0x08200820,0x00000800,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x18201040,0x20402020,0x28612861,0x30613061,0x28412841,0x20402040,0x10001820,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200800,0x10401020,0x10200820,0x08201040,0x00000000,0x00000000,0x00000000,0x00000000,0x08200820,0x08000800,
-0x08200820,0x08200820,0x00000020,0x00000000,0x00000000,0x08210820,0x10200820,0x08200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10210000,0x28c21861,0x38e238e1,0x10222041,0x08000000,0x00000020,0x28a11861,0x49423902,0x59835142,0x38e04100,0x20a128c0,
-0x00010020,0x00200021,0x00000000,0x18810000,0x41013902,0x49414961,0x30e34103,0x20c120a1,0x00200840,0x00200000,0x00000000,0x00000020,0x00000020,0x00000020,0x08200800,0x28e21040,0x38c138e2,0x51634923,0x40c061c4,0x39024142,0x206128e2,0x20612060,0x08000800,0x08010801,0x00200000,0x00000020,0x00200020,0x00200000,0x08000800,0x10410841,0x10201061,0x30822041,
-0x30a238a2,0x00200800,0x00000000,0x08010800,0x10200820,0x40a12020,0x50c04060,0x48c15901,0x20003860,0x00210800,0x00200020,0x08200820,0x20a10820,0x30a12040,0x59a44963,0x48c169a4,0x59435102,0x386050c2,0x18202820,0x00200800,0x08200020,0x28412040,0x28413082,0x20602040,0x08002060,0x00000020,0x00000021,0x00200021,0x08400000,0x10001000,0x18201821,0x10201820,
-0x08201020,0x00000000,0x00000000,0x00000800,0x00200000,0x00400000,0x00000020,0x08000820,0x28201000,0x40804081,0x40c13860,0x50e250e2,0x38c140c1,0x30814102,0x204038a2,0x00200000,0x00000020,0x00000000,0x00000021,0x00000020,0x00000000,0x08000000,0x18201020,0x28812040,0x206030c2,0x18611840,0x00000820,0x00000000,0x00200000,0x00200000,0x00000800,0x20611820,
-0x20401800,0x18822081,0x00000000,0x08000800,0x00000800,0x18610821,0x20612081,0x18611820,0x00200841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08010000,0x08200000,0x28a11861,0x49025143,0x206240e3,0x08200800,0x00200840,0x30c20800,0x51414922,0x61616182,0x59826161,0x396451c4,
-0x00210000,0x00200020,0x08200820,0x10400000,0x40e030a0,0x51614920,0x51854102,0x20c23964,0x08400840,0x00000000,0x08410840,0x00000000,0x00000020,0x08210000,0x08200000,0x310320c2,0x40e22040,0x61a36205,0x59826182,0x41024101,0x31023902,0x20c228a1,0x00001061,0x00010000,0x00000020,0x00000000,0x00200020,0x00000000,0x10400000,0x10401020,0x20401840,0x51032800,
-0x40e35923,0x00000800,0x08200000,0x08210000,0x20810000,0x61225964,0x79627121,0x79637962,0x51017182,0x00012062,0x00200841,0x00000000,0x28c11020,0x40c24103,0x492138c0,0x612250e1,0x61215901,0x79a47143,0x41026984,0x00401860,0x18a10000,0x38a230a2,0x40c240a3,0x38a138a1,0x208138e2,0x00210000,0x00000000,0x00200841,0x08000020,0x30612061,0x30813082,0x28403060,
-0x08001820,0x08410000,0x08200000,0x00000000,0x00200000,0x00000040,0x00000000,0x18810820,0x490238e2,0x69426963,0x79c36962,0x71637122,0x48a05901,0x38403840,0x40e25102,0x002018a2,0x00200000,0x00000820,0x00010000,0x08410000,0x00000000,0x10210000,0x28811820,0x40e13081,0x40e240e2,0x206030a1,0x00000820,0x00000000,0x00000000,0x00000020,0x28c21041,0x39023903,
-0x28602860,0x28a23923,0x00210000,0x00000000,0x08000000,0x20811040,0x38e238e2,0x182028a1,0x00200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20400820,0x30003860,0x20003020,0x00400800,0x08600000,0x28800800,0x48c040c0,0x69616982,0x59206140,0x38e25983,
-0x08200800,0x00000020,0x00000000,0x08200000,0x410130e2,0x51624921,0x38c25143,0x000020a2,0x00000020,0x08200820,0x00000000,0x10610821,0x08600040,0x00000000,0x08410000,0x20a11081,0x494330a1,0x618269c4,0x51005921,0x48e248c0,0x39034943,0x10601840,0x00000040,0x00000021,0x08000000,0x08000800,0x00000000,0x00000021,0x10210800,0x30c230e3,0x388030c1,0x9aa84840,
-0x28207a05,0x08600000,0x00000020,0x00400000,0x20400000,0x60a06123,0x70a068a0,0x70a07080,0x79a38120,0x000130e3,0x00000821,0x08000800,0x392328c2,0x49224943,0x49014921,0x510140e0,0x694248a0,0x922589e4,0x69e581e5,0x00001880,0x08400040,0x490330a2,0x59644903,0x490361a5,0x49854103,0x00001040,0x08410000,0x00200000,0x08000020,0x300040e2,0x48a03820,0x40604860,
-0x38e23880,0x000020a2,0x00210000,0x00200000,0x00200020,0x00410000,0x00200020,0x28a20000,0x69e54984,0x898379a4,0x89828983,0x79218101,0x586068a0,0x60c168c0,0x6a2679e5,0x082028a1,0x00000820,0x08200800,0x08210020,0x00000000,0x00000000,0x10410000,0x30c22062,0x48e13880,0x40e140c1,0x202038c1,0x00011062,0x00000000,0x00000000,0x00000040,0x41432080,0x51635163,
-0x30c14122,0x30e330a2,0x00001062,0x00000020,0x08200040,0x412228c1,0x41024922,0x186030e2,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000841,0x5a270800,0x82a87aa9,0x72a88b09,0x00001060,0x00200040,0x20800000,0x8ae87287,0x8a868aa7,0x9b289ac6,0x100061e5,
-0x08201000,0x00200020,0x00000020,0x08000000,0x49012060,0x40406142,0x38c04060,0x00001000,0x00200020,0x08000800,0x18401000,0x10001000,0x08200800,0x00000820,0x00000021,0x18400000,0x38802840,0x58a04860,0x58c058e0,0x40206100,0x20003000,0x00001840,0x00400000,0x00000020,0x20610800,0x18202881,0x08000800,0x00000000,0x08000801,0x38c22081,0x30003860,0xcbec5880,
-0x1800a36a,0x00200800,0x00000000,0x00200861,0x08000860,0xaac871c5,0xaa86a265,0xb286a225,0x92a7bb27,0x00000800,0x00000821,0x08000800,0x20001000,0x38203000,0x40404040,0x38204080,0x694150a0,0x48005020,0x408058a0,0x00201840,0x08000000,0x28002020,0x38402800,0x28004060,0x30e32000,0x00000000,0x00000801,0x00400040,0x10200841,0x69843881,0x89c37983,0x8a049a45,
-0x59a56143,0x082028c2,0x00000041,0x00000000,0x08410820,0x00001062,0x08000000,0x08000800,0x38801820,0x78e06901,0x890080c0,0x91619961,0xa1e38920,0x89629982,0x41026983,0x08001000,0x08200800,0x10400800,0x08000820,0x00200000,0x00200020,0x00000000,0x30a21862,0x614148c0,0x61826162,0x41235962,0x00210000,0x00000000,0x00000820,0x00000020,0x39011860,0x51635163,
-0x38c04100,0x288230a1,0x00200820,0x00400020,0x10400000,0x41013901,0x38804901,0x18602860,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6aea18a1,0x8ae98b2b,0x7b098b09,0x00201902,0x00610061,0x08000060,0xac0d830a,0xabcba3cc,0xb42dbc6d,0x080051c6,
-0x08201040,0x00610000,0x00000840,0x08000840,0xa36b2860,0xb2c6c349,0x8285b367,0x10411000,0x00000820,0x10200000,0x512230a0,0x71c46963,0x18003040,0x08401000,0x00000020,0x08000821,0x92a65142,0xb2c5a285,0xb2c5bb27,0xb2a5b2a5,0x71c5aaa6,0x08411000,0x00200041,0x10400840,0x30802860,0x202038a0,0x10211000,0x00000800,0x08400000,0x41020800,0x71206962,0xdcadbb26,
-0x08006a47,0x08201020,0x00000000,0x08001021,0x08001061,0xccb05164,0xe4cee4f0,0xe4eeecee,0x82a7e52f,0x10a10800,0x08200841,0x41640000,0x9b089b8b,0x9a6592c6,0x91a291e3,0x9a2391e3,0xab06aaa5,0xc3eaa2e5,0x92e9c40c,0x08002020,0x08000821,0x7aa83903,0x93078ae8,0x8ac792e6,0x080059c6,0x08200820,0x08000800,0x00000840,0x08000820,0xcc7038c2,0xec2be44d,0xecadec4b,
-0x5984cc6e,0x08200800,0x00000020,0x18400820,0x18202041,0x20821000,0x08000800,0x08400800,0x18001020,0xe44ca308,0xe388e3c9,0xe368db27,0xcac5db27,0xbb28cb07,0x10003860,0x00001020,0x18610820,0x10001000,0x20c228a1,0x00200000,0x00200000,0x08200820,0x28810000,0x69205900,0x69607160,0x496369e3,0x00000800,0x10410000,0x00010000,0x00000000,0x20800000,0x48e14943,
-0x40805100,0x30a13020,0x00200800,0x00000041,0x49431020,0x50c05102,0x38205920,0x10002000,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x08000000,0x18001800,0x08001800,0x00610000,0x00000020,0x00000040,0x18001000,0x10001000,0x10001800,0x08000800,
-0x00000820,0x00000861,0x10400000,0x10400000,0x9b6b1000,0xdbc9d40c,0x92e5dc6a,0x18611000,0x00001041,0x51632061,0x924469a3,0xdc0ccb89,0x69a3b36a,0x10001800,0x00200840,0x08001062,0xcc4c69c4,0xe46cd3ea,0xe48cdc4c,0xe42bf48c,0xbbcbe44c,0x08411000,0x00000000,0x28601020,0x61414080,0xa328a327,0x18005102,0x10201000,0x00400861,0x41020000,0xd3eacc0c,0xa388e4cc,
-0x08201000,0x00001041,0x20821041,0x10001000,0x08200820,0x51840800,0x720369e5,0x82a592e6,0x28807a86,0x08400800,0x10610000,0x39430000,0xa36a82e9,0xd44db3ab,0xebeae3eb,0xe409ec0a,0xdceedc6c,0xb42cc46c,0x7a889b6a,0x08001000,0x08000821,0x8b8c30c3,0xa3eb9bab,0x93aa9ba9,0x00005a27,0x08200841,0x08001000,0x10400800,0x10401040,0x82881000,0xe3a8d3eb,0xdc0aebe9,
-0x2820cc2d,0x10601000,0x10600000,0x18002060,0x7a683840,0x18005144,0x186128a2,0x08200000,0x10001881,0xeced9b28,0xebe9ec4a,0xf409ebe8,0xe366f429,0xb307ebea,0x10201800,0x08410020,0x10001020,0x82c938a1,0x18005142,0x208128c2,0x00000840,0x10610000,0x6a670800,0xd409cc4b,0xe4eed40a,0x1800b40c,0x08200000,0x08000800,0x08011042,0x00210000,0x08000800,0x620628c2,
-0x7a887a67,0x59e68b2b,0x10820800,0x00000021,0x82ea3903,0x82888289,0xabeba36a,0x41459bcd,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x18201840,0x10211841,0x00000841,0x00200020,0x08210021,0x08000800,0x08000800,0x08000800,0x00001061,
-0x10610000,0x39440800,0x100041a4,0x10211041,0x20810800,0xbbca92e9,0x92c5d44b,0x10411800,0x08000000,0x920448a0,0xe3c9cb47,0xeba9ebc9,0xdc0ae3a8,0x5941ab07,0x08400800,0x08001042,0xbc2c5121,0x92e8b3eb,0x598240c0,0xcbcaab69,0x92a6dc6c,0x08411000,0x08200021,0x61611800,0xdbc9b307,0xe409e3e9,0x9245d3c9,0x100040a0,0x00210800,0x08000862,0xe4eec44d,0x4922b3eb,
-0x10820800,0x10610000,0x51850800,0x2800932a,0x08410800,0x08001041,0x08200800,0x08000800,0x08000800,0x08410000,0x00000000,0x00000820,0x08000800,0x61841000,0xf3c9d389,0xd3a7ebc8,0x1800ab69,0x08001000,0x08001000,0x00200000,0x08210801,0x08000800,0x08000000,0x00000000,0x08400020,0x10210000,0x28601000,0x080030c1,0x08200820,0x18000000,0xdc2aa328,0xd3a8dba7,
-0x2000a308,0x08001840,0x08000861,0x69612000,0xcbcaaac6,0x79e5cbec,0x10001800,0x00001861,0x18001061,0xd48a8ac6,0xec4adbe8,0xe408f48b,0xec28e428,0xa2e6ecab,0x10801800,0x08000840,0x82452000,0xe4eecc4c,0x8244d48c,0x20003000,0x10202881,0x10810820,0x6a050800,0xe409e46c,0xdceee44b,0x080072c8,0x08400860,0x38e30800,0x08002061,0x00000841,0x00000820,0x20c20840,
-0x30e328c2,0x28e44165,0x00000000,0x00000041,0x30c21820,0x41643903,0x49844163,0x31255a49,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x08000800,0x08000800,0x08000800,0x08000800,0x00010000,0x08210001,0x00200020,0x00200820,0x00200021,
-0x10400841,0x9b6b1800,0x2880ac6e,0x08210800,0x08200021,0x51421000,0x6a04a369,0x10620800,0x10000861,0xe3ca79c3,0xeb87f409,0xeb67e347,0xf408eb66,0x92a6e44b,0x10401000,0x08000801,0x728738e1,0x10004101,0x10000800,0x72041800,0x61a3b3eb,0x08610800,0x08000021,0xc3aa6183,0xfc29e3e9,0xeba7f3c8,0xe42aebc8,0x2860a349,0x00211000,0x08000000,0x8ac79b8b,0x080038c1,
-0x00001061,0x08000861,0x9b4a1000,0x8a66e510,0x18821000,0x08610000,0x08800881,0x10811080,0x08211061,0x08210001,0x10400800,0x08401040,0x10821081,0x18001061,0xd3899225,0xb326db87,0x08004901,0x08400860,0x10811081,0x00400020,0x00000020,0x10610821,0x088108a2,0x088110a2,0x00400040,0x18000820,0x9b6b1800,0x18009b6a,0x00200800,0x08001082,0xb3a961c3,0xdc8cc3a8,
-0x1800b3ec,0x10201840,0x41630800,0xd42ba348,0xec2aec4b,0xe46dec6c,0x5163ab8b,0x08200800,0x08001061,0xe52e82e6,0xe4ace4cc,0xbbc8bba9,0xdcabdccb,0x7a24e50e,0x18a10800,0x30e20000,0xe48dab8a,0xe429ec8b,0xeccceccb,0x8a67c3cb,0x10003020,0x08401020,0x41210800,0xd3eacbea,0x61c3b348,0x08400800,0x08001061,0xac2f38c2,0x10007aa8,0x08001041,0x08200800,0x00000000,
-0x00000000,0x00000000,0x00000841,0x00000000,0x08000800,0x00000800,0x08000800,0x08000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000021,0x08400000,0x18411841,0x18402041,0x18811860,0x08210841,0x00000021,0x08200000,0x08400860,0x08611061,
-0x100018a2,0xdc4d81c4,0x5a04c4ae,0x08410800,0x08000000,0x08001061,0x08000800,0x00000800,0x10000861,0xec0a9244,0xf3e9eba8,0xf3c8eba7,0xf408f3c7,0x8a64e42a,0x10811000,0x08210000,0x10000800,0x18600800,0x10411040,0x08000800,0x18201820,0x08210000,0x10001061,0xe3ea9aa7,0xf3c8e387,0xebc8eba7,0xec4ae387,0x3880c3ea,0x08200800,0x08410000,0x08000800,0x08410800,
-0x00000020,0x10000860,0xd46c7a66,0xd42ae46a,0x10003880,0x08001841,0x00400020,0x08210000,0x00000800,0x08000801,0x08000800,0x00000800,0x00000820,0x08000841,0xabcc2000,0x7a45dcef,0x18a20800,0x00200020,0x00000000,0x00000000,0x00200000,0x00000000,0x00400020,0x00000020,0x00000000,0x18002082,0xd42c7a05,0x8aa6d46d,0x08810800,0x18610000,0x10000800,0x936a5162,
-0x1000938b,0x08001040,0xb42c2020,0xdba8f52f,0xf429ec2a,0xf46bec09,0xc46deced,0x00004122,0x08001882,0xbc8e7aa7,0x59628ac7,0x18001800,0x8b4949a2,0x59e5bcd0,0x18810800,0x51840000,0xe3e9d44c,0xf449ec08,0xec08ebe8,0xec6dfc6c,0x30a0ab8a,0x10610800,0x20a00000,0x620572c8,0x08001800,0x00001061,0x10001861,0xccaf69e5,0x4080c42c,0x08610800,0x00000000,0x08200000,
-0x00200840,0x00200861,0x08000800,0x08200820,0x08200800,0x08401040,0x08410840,0x08200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00410001,0x10810040,0x38a13903,0x30402000,0x20202840,0x08001000,0x00000000,0x08200840,0x10000800,0x10001000,
-0x50c01800,0xe44ccb89,0x18009308,0x08401040,0x08200000,0x08410840,0x08410841,0x00200000,0x10000860,0xf44b8a23,0xeba8f409,0xebc7e3a7,0xe3c6eba6,0x8244dc09,0x08611000,0x00210841,0x10410000,0x00001061,0x08200800,0x08620862,0x00000000,0x00000021,0x10001081,0xec2a9aa6,0xe366ebc8,0xf3a7f3c8,0xf46aebc7,0x40a0bba9,0x08610800,0x00010000,0x08820000,0x00200862,
-0x08400020,0x08001081,0xdc6b7224,0xe428d386,0x2000ab68,0x30822000,0x00001860,0x00010821,0x10210000,0x20610800,0x412238e2,0x41433901,0x208130a1,0x08400800,0x52060800,0x30e19bed,0x00400000,0x10400800,0x28a12061,0x20a12881,0x08201861,0x00000000,0x00200020,0x20a21041,0x30c22081,0x51011800,0xdbeacbcb,0x9b48dc6b,0x08610800,0x00000800,0x10600840,0x18400800,
-0x000020a1,0x08001061,0xc40b5142,0xec29e42a,0xdb67e3e9,0xdb66cae4,0xd48cd3a7,0x08004962,0x08001061,0x30a030e1,0x10001800,0x10201020,0x08200000,0x28a13103,0x10610800,0x59a40800,0xe3a6dc2a,0xfc49fc69,0xebc7f408,0xec0af3c8,0x5101cc0b,0x08410800,0x00000840,0x08001040,0x10410820,0x08410821,0x10000820,0xab8a2000,0x9ae7dc6c,0x18401800,0x28802080,0x18402060,
-0x08600000,0x00000841,0x08200800,0x08000800,0x08000800,0x00000800,0x00000000,0x00200860,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18800881,0x92664080,0xa2e69286,0x92659aa5,0x200069a3,0x08001020,0x18600000,0x61825183,0x81a379c3,
-0xb2a68162,0xbba8ec6b,0x000038e0,0x00200840,0x10401020,0x10411000,0x08000800,0x00200020,0x080010a1,0xf48c9265,0xebe8ebc8,0xebe7ebe8,0xe428ec07,0x7a25e48c,0x08410800,0x00200000,0x08210820,0x10210000,0x08002082,0x00200841,0x08410841,0x08200000,0x10001060,0xe4299ae6,0xf408db66,0xf387fbc8,0xf48bf3e8,0x38c1cc4c,0x00210000,0x08010000,0x08210841,0x00000000,
-0x08400821,0x18200800,0xab891800,0xf449ec4a,0xaae5ecab,0x38004820,0x28203820,0x08420800,0x00000021,0x30800800,0x79e271c3,0x798181e2,0x38406921,0x08401000,0x08001040,0x08000800,0x00400020,0x20001020,0x40604922,0x596358e1,0x08002020,0x08210800,0x08000800,0x20001800,0x38003020,0xbb686921,0xd3c9e42a,0x5182c42a,0x08410800,0x08000820,0x00000000,0x00001041,
-0x00400000,0x08000861,0xcc0b48e1,0xf44ae409,0xec2af42a,0xe3e7f429,0xd48bec69,0x000030c0,0x08200020,0x08000800,0x10401881,0x08000800,0x08410862,0x08000000,0x18401020,0x72460800,0xe3e7e48b,0xec08f428,0xf44af44a,0xe3a8eb87,0x48a0cbeb,0x08411000,0x00000000,0x10411021,0x08400820,0x00000820,0x10610000,0x61a31000,0xcbc9cbea,0x28008204,0x48e13840,0x28004880,
-0x08001000,0x00000000,0x08001081,0x490138c0,0x410338c1,0x39034103,0x002020e3,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10001081,0xdc0b79a3,0xf4ececcc,0xe42af48b,0x6982d40a,0x10621000,0x28c10000,0xcc0babcc,0xe3e9e40a,
-0xd388e3a9,0x7a44dc6b,0x18a20800,0x08000020,0x20202060,0x10001800,0x08202061,0x00000020,0x08000860,0xdc6d7a45,0xec4ae44b,0xec49ec29,0xe4ace429,0x306092c7,0x08201000,0x08000000,0x08000800,0x38c22081,0x38a14102,0x10400800,0x00000820,0x00200820,0x08000860,0xcc4b6a03,0xe3e9dc2a,0xf42aeba8,0xc3caec4b,0x100069e4,0x00410020,0x00000821,0x08000800,0x30e21840,
-0x08001020,0x10200800,0x51421000,0xe3e8d40a,0xf46be3e8,0xbb08cb48,0x8ac8bb69,0x08420800,0x18610021,0x82861800,0xd3e9c3ea,0xd388dbe8,0xab08d3aa,0x08201000,0x00000840,0x00200800,0x08400020,0x72051800,0xab28ab29,0xa2c7bb49,0x38e09b49,0x08210800,0x08001021,0xbc4e7288,0xcbaab349,0xec2bdc0b,0xdc4ae3c8,0x08009328,0x08001041,0x18400800,0x104020a1,0x10610800,
-0x00200040,0x08000020,0xa30840e1,0xf4accbc9,0xe409ec4b,0xec6af48b,0xd4eeeced,0x00002080,0x00000861,0x10410820,0x08200000,0x20822061,0x08000800,0x08001062,0x18600800,0x6a460800,0xecaae50e,0xfc8aec29,0xe3e8f469,0xe44be3a7,0x40c0cc4c,0x08211000,0x00410021,0x10400820,0x10201040,0x08400800,0x08410000,0x18000820,0xdc4bb368,0xb2e7c389,0x9a65b328,0x8a66a2a6,
-0x000030a1,0x10810840,0x40e10800,0x81e48225,0x59427183,0x598471e5,0x108130e2,0x00210000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210001,0x18610000,0x28001820,0xec29c368,0xf46aec69,0xec49fc8a,0xbbc9ecab,0x08201800,0x08000841,0xd44c7a86,0xeba7ebe9,
-0xdc0ae366,0x18009b29,0x08411020,0x18400000,0x9b2a2000,0x3800a308,0x08001000,0x00410020,0x08000021,0x51840800,0xd42bab8a,0xd3cae42b,0x51229266,0x08001000,0x00000820,0x08000000,0x38812041,0x692050c0,0xc3eaa2e6,0x200071c3,0x10201000,0x00000000,0x08400020,0x49011000,0xe4cdbbeb,0xc3e9eccd,0x28607245,0x10400800,0x00000020,0x08200000,0x30c01040,0x82246161,
-0x10007ac7,0x08000800,0x18001841,0xe48ba307,0xf40af44b,0xe42bf44b,0x7a46dc8d,0x10621000,0x10001041,0xd44b61a2,0xf48cec8b,0xf44af44a,0xe42bfc6b,0x100061a3,0x08201060,0x00000820,0x08000860,0xd46d4880,0xec8ce46d,0xeccdf4cd,0x82a6ed0e,0x18821000,0x10001042,0xdccf69e6,0xdbc9dc2c,0xfc8be3e9,0xcc0aec6a,0x08004121,0x10001040,0x38801800,0x490240a0,0x100030a1,
-0x00000000,0x08200021,0x28601000,0xd46b92e7,0xe449ecaa,0xe4eee46b,0x4984b40c,0x08400800,0x00000000,0x08200821,0x10001040,0x40a138a0,0x20403881,0x00000800,0x00200840,0x18400820,0xbc4b72c7,0xec49e48a,0xe428e3e7,0xccace4aa,0x08006224,0x00211061,0x00200041,0x10200860,0x38e11800,0x08003902,0x00000841,0x10000841,0xc40b5962,0xebcae40a,0xe3a9f40a,0xc3cae42a,
-0x00001800,0x08000861,0xc3ea40e0,0xe3a8e3ea,0xcbc9dbc9,0x9b07d44b,0x10201800,0x08410821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x18400800,0x8a461800,0xf408e409,0xec28f428,0xfccbf469,0xdcacec6a,0x00006a87,0x08001082,0xb3692820,0xeb86e3c8,
-0xd44bec08,0x00004963,0x00001041,0x10001861,0xdc8d69a4,0xc3c9e44b,0x20207a25,0x00010820,0x08420021,0x08000000,0x61821800,0x58e09266,0x08001800,0x00211062,0x00200000,0x18200000,0x58e12820,0xdbe99a44,0xec6aec29,0x9aa7e4ad,0x18003020,0x00000800,0x00200040,0x10001040,0x8ae72800,0x40e09307,0x00001000,0x00001081,0x00000000,0x08200020,0x71e22860,0xdc4abb47,
-0x7266dccd,0x10620800,0x10000841,0xcc4b38a0,0xe388fccd,0xf48cebc8,0x2000bbca,0x10410800,0x18000800,0xec6bc3ea,0xec09ec09,0xfc4af409,0xf46bfc49,0x1800b3aa,0x08400800,0x00000820,0x10001040,0xe46c9ac8,0xec6af4cc,0xe429ec29,0xc40bec6b,0x08002840,0x10001041,0xa3281800,0xebe9ec6c,0xe3c8ebe8,0x8a85e46b,0x10810800,0x10001020,0xb3ab4902,0x6100a308,0x30813840,
-0x00002061,0x08000000,0x08000821,0x59601800,0xcc2a9ae5,0x8286c40b,0x08001000,0x00000840,0x00000021,0x10200820,0x6a042040,0x9286bbcb,0x51016101,0x10404143,0x00410000,0x00000020,0x41200800,0xcc09a306,0xd44adc8a,0x4120a367,0x10800800,0x00000020,0x10810000,0x28200800,0xbbec71e3,0x1800a3ab,0x08411020,0x10600000,0x9b081000,0xeb87ec2b,0xe367f3a8,0x8224dc0a,
-0x10821000,0x08000861,0xe44b9b28,0xeb66eba8,0xec29e386,0xdcccec8a,0x18007204,0x00001861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x00000000,0x10001040,0xdc2d48a0,0xf408f46b,0xf429fc29,0xf4aaec49,0xdcadf48a,0x00007ae8,0x10810861,0x71e41000,0xeba8dbc9,
-0x8a85dc2a,0x08401000,0x08210021,0x30201000,0xe42abb69,0xec09ebe8,0x9b08e46c,0x10820800,0x00000020,0x10810820,0x08000820,0x10001000,0x08401860,0x00200821,0x00200000,0x10000861,0xc3696982,0xf429ec2a,0xf48af449,0xe46bec6a,0x5102c3eb,0x10810800,0x00200000,0x10400000,0x10000800,0x08001020,0x08411061,0x00210001,0x08200820,0x10000820,0xdc4b8aa6,0xec6afccc,
-0xcc0aec4a,0x08002860,0x10600840,0x82c70800,0xe3e8dc8b,0xfcccfc8a,0x100092e7,0x10401860,0x82c80800,0xf449e48c,0xf3c7fc08,0xfc29f3e9,0xdbe7f407,0x7205dc8d,0x10611000,0x10600000,0x49630800,0xdbe9e4ce,0xf469e428,0xec09f429,0xecaddb88,0x10009b69,0x18611840,0x6a240800,0xec08dc4a,0xe42ae3c7,0x3880cc2c,0x08200800,0x18001861,0xdc4c92a7,0xcbc9dc4b,0x61219a65,
-0x08201800,0x08200800,0x08400000,0x08001880,0x41211000,0x10002040,0x10611000,0x00200000,0x18200000,0x59a31800,0xdccdab89,0xf46cec6c,0x79c1d3e9,0x30a150e0,0x00210800,0x08200000,0x08001060,0x38a01000,0x49427287,0x08001000,0x00001080,0x08420000,0x10001041,0xbb8971c4,0xec6be42a,0x8a05e44c,0x10211800,0x10401061,0x59830800,0xf44ad3ea,0xec4aebe8,0x3040b3aa,
-0x10411000,0x49830000,0xe409cc4b,0xf3c8f3e8,0xebe7eba7,0xf4edf46a,0x3000dcae,0x08400800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400020,0x10001040,0xdc4d8a88,0xe386ebe9,0xf3e8f3c8,0xe449e3e8,0xc42bfd2e,0x10401000,0x08400000,0x38401000,0xe3e9d389,
-0x2000bbca,0x08401020,0x18410000,0x92662000,0xe3c8ec8c,0xf408f3c7,0xb368ec4a,0x10411000,0x08200820,0x10600820,0x08610840,0x08401061,0x00000040,0x08410820,0x00200000,0x10000860,0xf48b9ac6,0xf409ec09,0xfcaaec28,0xec4af428,0x8a86e46c,0x08401000,0x08200000,0x10411041,0x18811020,0x08610860,0x00000020,0x00210041,0x08200021,0x18000820,0xfceddcae,0xfc6afcac,
-0xec6bf408,0x08007a66,0x08611081,0x20400000,0xf4cbcc6c,0xf4acf449,0x1000a389,0x10601040,0x8b291000,0xebc7e44b,0xfbc7f3c7,0xebc7fbe8,0xe428ec27,0x5102cbeb,0x08410800,0x10600820,0x6a670800,0xfcecf570,0xe3e7f448,0xf44af429,0xcba8f44a,0x4143cccf,0x10610800,0x41400800,0xe408d429,0xdc4be408,0x10007a45,0x10611881,0x51220800,0xe40ad44d,0xec6aec6b,0xd42ce44b,
-0x08006205,0x00001040,0x00000841,0x10810000,0x08000820,0x18610000,0x00000820,0x00000841,0x10001061,0xdcee6a04,0xec8bf54e,0xfc4aebe9,0xf4ccf46a,0x4901ab48,0x00211000,0x00200000,0x10610000,0x00001041,0x08000800,0x10611040,0x00200000,0x08210000,0x49230800,0xe40acbec,0xe386db46,0xc308e368,0x10004881,0x08200800,0x18001040,0xe44a9ac6,0xd3e9e3c8,0x10008aa7,
-0x10411841,0x51c40800,0xe3e9dcad,0xfc29e3a7,0xfc49f3e7,0xf4acfc8b,0xa36adcad,0x10610800,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x10001860,0xd44d7a46,0xebe8e40a,0xf408f3e8,0xe408fc49,0x6204dced,0x10610800,0x10610020,0x61621000,0xd40adc0a,
-0x100069c4,0x00001861,0x10001061,0xd3eb4840,0xebe8ec4b,0xf408ebe7,0xa306ec49,0x08201000,0x10010800,0x08000800,0x10810000,0x08200820,0x18610000,0x08001020,0x08200800,0x10001061,0xec29a2a5,0xebe7f429,0xec07ec28,0xebc8fc48,0x8a45e42c,0x08401000,0x00000860,0x08000800,0x10401861,0x00000820,0x10820820,0x00000000,0x08210821,0x20000800,0xfcabd44b,0xec29f46b,
-0xf4cbf469,0x2820bbea,0x00200820,0x08000881,0xdc6b8265,0xe42aec29,0x3080bbca,0x10810000,0x49420000,0xe3e8dc6c,0xf3e8f3e8,0xf429fc08,0xecece428,0x08008ae8,0x00001081,0x08400020,0x28a00000,0xecabcc6b,0xf449ec08,0xe408fcaa,0xdc2ae408,0x10008ae8,0x10820800,0x61c30800,0xe449dc8b,0xb3eae4cc,0x10201800,0x18600820,0xabaa1000,0xf46becad,0xec2af48b,0xfd30f48c,
-0x10009b49,0x00001860,0x08810020,0x00000000,0x10610800,0x00000820,0x08610840,0x00210000,0x10001062,0xf52eb3eb,0xec28e428,0xf40af42a,0xec2aebc8,0x92e7f50e,0x10611000,0x00200020,0x00000000,0x08200021,0x10611061,0x10610800,0x00000861,0x10400000,0x69e50800,0xec09d40b,0xe386e3c7,0xe389eb46,0x18008a25,0x08001821,0x08000820,0xbbca3040,0xd3a9fc6c,0x080040a0,
-0x08001021,0x18001020,0xec4aab27,0xfc4adba8,0xf469fc69,0xecabfcec,0x8b08d48c,0x10610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x10000800,0xa36a1800,0xe44bd42b,0xec8beccc,0xe4cdec6b,0x08008b48,0x08211041,0x08200840,0x9b6b1000,0x92c6dcce,
-0x10411000,0x10400800,0x10000840,0xec8dab6a,0xf46aec2a,0xe428f46a,0xb3c9e46a,0x10611000,0x08000800,0x6a484144,0x10002060,0x20401000,0x30604102,0x30a138a1,0x08200800,0x18000841,0xf449ab06,0xebe7f429,0xfcaaf428,0xf42aeba7,0x7a04ec6c,0x10801000,0x29020000,0x49027288,0x10001000,0x18401840,0x08001000,0x20a030e1,0x08410000,0x10000821,0xe4cbd4ed,0xe48ce48c,
-0xed2ee48b,0x8309e550,0x10820800,0x08000041,0xbbeb1800,0xecacf4ee,0x6a25e4ef,0x08610820,0x10001061,0xf4eda348,0xf46ae408,0xec6afccb,0xbc2be4ac,0x00002040,0x00000820,0x00200000,0x10000861,0xe50d7a65,0xe46be46b,0xe48adc08,0xbbeaf50d,0x08002000,0x08401061,0xabec1000,0xed0deced,0x5162c44c,0x10600800,0x08001060,0xcc8d7266,0xe429dc6b,0xe3e8fcab,0xdc4bec2a,
-0x18008286,0x10401020,0x08000800,0x18610800,0x08000800,0x20811840,0x08001000,0x08410800,0x10000841,0xf4ecbc0b,0xfc49ec48,0xf409fc4a,0xdb87f429,0xab48ec6b,0x08401000,0x00000000,0x10610841,0x00000000,0x08001040,0x08001860,0x08410000,0x10600020,0x61c30800,0xec29d40a,0xf429e3a7,0xe388fbc8,0x3040bb89,0x10411000,0x10600020,0x8ae70800,0xd3cae44c,0x08007206,
-0x08211041,0x10001021,0xcbe95100,0xe3c7dbc8,0xf4aaec49,0xdc8bfccc,0x1800b3ea,0x08210800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00200000,0x08200020,0x41630800,0x8ae682e7,0x83278b07,0x6a668b28,0x08201860,0x00200840,0x00000040,0x730a1020,0x28c07b09,
-0x08200800,0x08410820,0x51e60000,0xd44dbc4e,0xcbe9cc0b,0xdc8cdc4b,0x9b69dccd,0x10610800,0x08000841,0xccce5182,0x9aa5cc6c,0x40004820,0x71415880,0x9b49c40b,0x08610800,0x10000840,0xf44aaac6,0xf408ebe8,0xfc49f408,0xec4aebc8,0x7204ed0e,0x18a11000,0x41230800,0xd46cd4ae,0x510192e7,0x20002000,0x7a253000,0x6a05bc4d,0x10411000,0x00200021,0x8b677308,0xac2c9bc9,
-0x82e89349,0x6ac9936a,0x00200000,0x10810041,0x82871000,0xcc4ce50f,0x936accae,0x08610800,0x08000861,0xc46c59a3,0xdc4ad44b,0xcc6cd46b,0x61e4bc4c,0x10800800,0x08200800,0x00420862,0x00000841,0x938b1860,0xbc2bbc4d,0xed4ed4ac,0x7286dd2f,0x18a11000,0x08001060,0xdd716226,0xdcede52e,0x08008b49,0x00410840,0x18000820,0xf58fbc6d,0xecaadc8a,0xf4cbecca,0xeccdfccb,
-0x10008287,0x08001840,0x72674123,0x18003860,0x20412041,0x38802000,0x7a677a25,0x08001000,0x08000020,0xe46ab3ca,0xf428ec48,0xfc69ebe7,0xec07f427,0xb347e429,0x08611000,0x00200041,0x18001000,0x208228e3,0x10001000,0x49221800,0x08004985,0x10600800,0x61a31000,0xdbc8dc4b,0xec29e409,0xf44af409,0x82c7dc6c,0x10810800,0x00600020,0x28600020,0xe4adbba9,0x1000ac0c,
-0x08201020,0x10400000,0x8ac71800,0xec69e48a,0xeccbf4ca,0xd48ce48a,0x080061e4,0x00001041,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x00000860,0x10000800,0x08000800,0x08000800,0x00400000,0x00200020,0x00200020,0x00000000,0x00000000,
-0x00000840,0x00410020,0x29030000,0x59424102,0x50e048e0,0x61826141,0x41416a04,0x08200800,0x08001081,0xd4cd6203,0xecabe4ab,0xbae7d3ca,0xdc2bc307,0x9b47ecec,0x10810800,0x08000861,0xecad9ae8,0xec4aec4a,0xec09f429,0xdcadecac,0x38c09b48,0x10601020,0x49630800,0xf4ccdc8c,0xe4cef50e,0xa329b3aa,0xdcefc40c,0x59a3ccef,0x08201000,0x00200021,0x00000020,0x08000800,
-0x10000800,0x08000800,0x08611040,0x00000000,0x18000800,0x51215142,0x30a03880,0x08400800,0x08200020,0x49410800,0x618161a1,0x286040e0,0x08001000,0x08001020,0x08001040,0x00000800,0x08210021,0x08000800,0x30c01000,0x724459a1,0x20604141,0x00000800,0x08200840,0x72864162,0x8ae67a64,0x000030e0,0x08820041,0x39230000,0xbc2b934a,0xd4acb3e9,0xc44ac44a,0xc44cc3e9,
-0x08006a27,0x10001882,0xccd06206,0x8a87bbec,0x28003000,0xbbcb6963,0xcc6df52f,0x08001800,0x08000861,0xecedb42c,0xf469dbe8,0xfc69ebe7,0xec69f448,0x9b07ecec,0x08611000,0x08000000,0x8aa79309,0x18002820,0x51022800,0xc42e92a7,0x0800938c,0x10201040,0x30800800,0xa2c58a45,0xa2c6ab07,0x9284a2a5,0x7ac79b48,0x00200800,0x00400041,0x08000860,0x9b0869c3,0x20a07ae8,
-0x00200000,0x08410020,0x30a00800,0xab4692c5,0xb3a8ab46,0x7224ab68,0x08401000,0x00400020,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x08410021,0x08610041,0x10401040,0x10601060,0x08201061,0x00000841,0x00400000,0x00000020,0x10211021,0x10201861,
-0x00200000,0x00200000,0x00000021,0x10000800,0x10000800,0x10001000,0x08000800,0x00000800,0x00000841,0xb48c4183,0xecaadcec,0xf48cf48c,0xe44bfcee,0x9b06e4ab,0x08401000,0x08000820,0x7a462860,0xe48cc40b,0xecedec8b,0x6225c46d,0x08000800,0x10400000,0x51820800,0xf469e48b,0xf4acec49,0xf570e4cd,0xb40cdd0f,0x08004183,0x08201020,0x00000000,0x10810881,0x18401860,
-0x10611840,0x10401861,0x00000000,0x00000020,0x10000000,0x10000800,0x08000800,0x00000820,0x00000000,0x08000800,0x10000800,0x08000800,0x10610000,0x10400820,0x39430800,0x3081832a,0x08010800,0x10600820,0x08000000,0x08000800,0x00000800,0x00010801,0x00400000,0x08000000,0x10001000,0x00400000,0x00000000,0x08200020,0x10001000,0x08000800,0x10000800,0x28c11840,
-0x08011000,0x00000821,0xcccf51e4,0xeccedcad,0xbb69c3aa,0xfd4edc6b,0xdcace48a,0x080038a1,0x08000821,0xb42b59e4,0xe449dcab,0xec29fc8b,0xecccec6a,0x4982a368,0x00200020,0x18000800,0xe46bc3ca,0x9264bbc9,0xd40a9a64,0xe4cedc0a,0x1000abed,0x08001020,0x10001020,0x18001800,0x10001000,0x10001800,0x08000800,0x08201040,0x00000001,0x10200000,0x18001000,0x00000800,
-0x00200040,0x00000041,0x08000840,0x10001000,0x10001000,0x10001000,0x00000820,0x00200861,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08410000,0x00000000,0x08000820,0x10201000,0x00000800,0x00000000,0x08000000,0x08000000,0x08200800,0x08000800,0x08000800,
-0x00000020,0x00000040,0x08410020,0x08400841,0x08600861,0x10600840,0x08400860,0x08000000,0x08000000,0x41410800,0xe52ea3c9,0xec8cf4ed,0xecacfd0d,0xcc4beccb,0x18811800,0x08200840,0x10000800,0x8aa63860,0x8aa6bc0c,0x08002020,0x08411061,0x10610020,0x69e31000,0xfcaae44a,0xf4abfcaa,0xcc8de4ed,0x100082a6,0x08600800,0x00200000,0x00000820,0x00000021,0x18200800,
-0x08001020,0x08400820,0x10400800,0x00200000,0x00000840,0x08610020,0x10410820,0x08001020,0x00000000,0x08200820,0x08411061,0x08410021,0x08001040,0x18611000,0x9b6a1800,0x92c7f5b2,0x20611000,0x10201000,0x08200840,0x10611082,0x08410841,0x00010001,0x00200041,0x18a20020,0x18811060,0x00210020,0x00000000,0x08000000,0x18411041,0x08211082,0x08210001,0x00000000,
-0x00000000,0x08400020,0x51621000,0xed0fc40c,0xfd2eeccd,0xf4caecab,0xd48be469,0x08004922,0x10611041,0x10000800,0xc42a8285,0xe48de48c,0x8264c3ea,0x08001800,0x08410860,0x40c10800,0xec28cbc9,0xe46ae46a,0xf4acecab,0xb36ae44c,0x080061c5,0x08201020,0x08210000,0x08010821,0x10610841,0x08610840,0x08401060,0x00000820,0x00000000,0x08210821,0x10201040,0x00200861,
-0x00400020,0x00000021,0x08410020,0x10620821,0x10621042,0x08210841,0x10211041,0x00200820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x38e31040,0x20002000,0x08002020,0x08000800,0x00000000,0x08400000,0x208120a2,0x18202040,0x08201041,0x08010000,
-0x00000020,0x10600020,0x10201020,0x08610840,0x00600040,0x08400860,0x08610060,0x00000000,0x08400000,0x08001060,0x61e51000,0xdceeabcb,0xf52ded0d,0xecacec8a,0x10008266,0x08600000,0x18810800,0x08000000,0x10001000,0x18610800,0x00000820,0x18410821,0x71c31800,0xf48aecac,0xd44aec8a,0x39019328,0x08001000,0x00400840,0x00000820,0x08210000,0x18810820,0x18201860,
-0x10201820,0x08001040,0x10401020,0x00000820,0x00000000,0x08410021,0x08000800,0x10001000,0x00001020,0x08200000,0x00000000,0x10610861,0x28201800,0x20003080,0xe4ad7a04,0xd44be48b,0x180048c0,0x10001820,0x10211041,0x00000000,0x08210000,0x10410000,0x08201041,0x08400820,0x00200820,0x00000000,0x08000000,0x08000800,0x08000800,0x08000000,0x00000000,0x00200000,
-0x00000820,0x00000840,0x08000840,0x72242020,0xed6fb3eb,0xecebed0c,0xe52efd2c,0x00006a67,0x00000840,0x08001082,0x38e11000,0x8b098b09,0x08002040,0x18401840,0x10820000,0x61c50800,0xec49dc8c,0xdc08f48a,0xc42bdc6b,0x20008287,0x08200800,0x00200820,0x00410041,0x08210000,0x00000820,0x00000800,0x00000800,0x00410020,0x00000040,0x00000820,0x08410800,0x00000020,
-0x00200000,0x08200800,0x00000020,0x08010000,0x00210821,0x00000020,0x08001020,0x10200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x08200841,0x9bcc1000,0x71c3abab,0x40e148e0,0x00002082,0x08210821,0x18600000,0x306030a1,0x38803880,0x100028a0,0x00000800,
-0x00200020,0x10001040,0x20001800,0x10002020,0x08001000,0x08001000,0x00000800,0x00000000,0x00000000,0x10610820,0x10001020,0x62031000,0xed4fc4ad,0xeccdeccd,0x9babe550,0x00002922,0x00200840,0x08810060,0x08410000,0x08001021,0x08200020,0x18000800,0xcc2c71e5,0xdcace4cd,0x5100c3e9,0x08001000,0x08611040,0x00000041,0x00000000,0x10200800,0x18001000,0x20002020,
-0x30803060,0x28202000,0x180038c1,0x08400800,0x00200000,0x08000020,0x38811800,0x200040a1,0x00200800,0x00000000,0x08400000,0x18200800,0x61624080,0x614169c4,0xf4ccdc6c,0xeccbec6a,0x4040a307,0x41225121,0x08001800,0x00000820,0x08000800,0x10000800,0x28603081,0x28a13902,0x00201040,0x00010021,0x18200000,0x30c128a1,0x412238c1,0x38e238e2,0x30c238e2,0x20c23103,
-0x00001040,0x00200020,0x10820000,0x08000800,0xa3ca1800,0xf58ff5f1,0xf58ffd8e,0x10009349,0x10202060,0x08410000,0x08001041,0x10001000,0x10610800,0x08000820,0x08001040,0xabcb1800,0xecabeced,0xed0efd2d,0x40e0aba9,0x08001000,0x00001061,0x00400000,0x00410020,0x20401861,0x28402020,0x28412000,0x28603082,0x08001820,0x08001020,0x00000000,0x08000800,0x18801040,
-0x20002060,0x10002020,0x00400820,0x08010000,0x00000021,0x20601040,0x30801800,0x28a27b0b,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x10400000,0xb40c1000,0xdc6be4ee,0xbc2bc3e8,0x00005a06,0x08011042,0x20a10800,0x93082800,0xc40ac44c,0x9b89cccc,0x08200800,
-0x08000821,0x71a33060,0x81c381c3,0x79a37962,0x71827183,0x69816961,0x41025962,0x08210800,0x00210000,0x08200820,0x18401040,0x10001840,0x7b091000,0xed8fd50e,0xee13edaf,0x00009c2f,0x00400860,0x00400020,0x00200040,0x00000000,0x08200000,0x8aa61800,0xf52ff50e,0x7a87cc8d,0x10002000,0x10401860,0x08410800,0x00410021,0x00200021,0x08000841,0x9b497287,0xab68a329,
-0x9aa59a85,0xa2e7a2c6,0x92c79266,0x08004963,0x10200840,0x59631000,0x8a048225,0x8a879245,0x000030c1,0x00200840,0x00000860,0xa3aa72a7,0xcc0abbc9,0xe4eecc0b,0xf50df50e,0xeccbf50c,0xc3c9eccc,0xa368b3a9,0x6a879b6a,0x08400800,0x10200000,0x6a251820,0x8a458266,0x722579e4,0x08003922,0x00200020,0x10000800,0x61625142,0x81e36121,0x796281c3,0x61027142,0x51036944,
-0x08401820,0x00000000,0x00200041,0x18810800,0x10000800,0xb46c5a04,0xed2de54e,0x9244e4ac,0x10002000,0x08200800,0x10200000,0x10201840,0x00001020,0x08200000,0x20400800,0xf56fb3eb,0xf58ef54e,0x82c7d4ee,0x08001000,0x10201860,0x00200800,0x00400020,0x00000061,0x69422800,0x71626941,0x71637142,0x81e47983,0x79e481e4,0x100048c1,0x08201020,0x08000800,0x614238c0,
-0x69216120,0x28405922,0x00400840,0x08210000,0x20800820,0x51202880,0xcc8d71c2,0x1000c4b0,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400841,0xabca1000,0xececed2d,0xbc4bed2d,0x08200800,0x08210000,0x100020c3,0xed2f8245,0xf50cfd6e,0xbc2af52d,0x08201820,
-0x08000821,0xc3ab50e1,0xebeae42b,0xe3ebe3ea,0xe42bec2b,0xe46bec6b,0xabace4ce,0x08011000,0x08210842,0x08000800,0x10401881,0x10600800,0x08000840,0x9bc930e0,0x8307bcac,0x000049a5,0x00400040,0x08200000,0x00000000,0x00410000,0x00000862,0xd4ef7ac8,0x9ac6dc8c,0x10002840,0x10410800,0x10410000,0x08200800,0x00000820,0x00210021,0x10000841,0xf550cc8e,0xf4edf50e,
-0xfcccec6a,0xf4adfccd,0xf530ec4b,0x10009b6a,0x18401880,0xb3cc1800,0xfcacf4ce,0xeceee40a,0x1000a3ab,0x00001881,0x080010a2,0xedb17ac7,0xfd4ded0d,0xeccdfd4f,0xfdaffd6e,0xfd4dfd2d,0xf4cbfd4c,0xf590f52e,0x7ac8f613,0x10600800,0x080018a2,0xe55059c3,0xf4cdf54f,0xfd91fcee,0x0800ac2d,0x10601061,0x72c80800,0xbb68bbec,0xc347c388,0xc327c306,0xaa86bb07,0x9267a246,
-0x08005185,0x00001040,0x08210020,0x00001021,0x18a11040,0x10000000,0xd48c7a85,0xcc0be48c,0x39029b4a,0x08600800,0x00000040,0x08210820,0x00000821,0x00000841,0x9c0d1880,0xed2ee550,0xaba9e52e,0x08004941,0x08611060,0x10400000,0x08400840,0x00400000,0x08000041,0xc36892a7,0xdbc9cb88,0xdbaadbaa,0xd388d388,0xd3cbdb89,0x200092a7,0x08401000,0x38e20800,0xe48db3cb,
-0xe42be42b,0x6183cbeb,0x08400800,0x08410820,0x49e50000,0xdccdcd0f,0xecaddc4a,0x1800bc0c,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610000,0x93691000,0xcc8bed6f,0x4142ac0b,0x08610800,0x10400020,0x40e00800,0xf4ecd48d,0xf4ccf4ec,0xbbeaecab,0x00201000,
-0x10000841,0xd3ea58e0,0xeba7e3c9,0xe3a8f409,0xeba8f409,0xec08ec08,0xb3cbec8c,0x08411000,0x08000821,0x30a03902,0x00000800,0x002010a2,0x10810820,0x08000800,0x08000800,0x08210000,0x00200000,0x10210000,0x18811020,0x00000820,0x00000041,0x72a928a1,0x180059a5,0x10600800,0x08410820,0x08000000,0x20001840,0x20402820,0x08210800,0x10000862,0xe42ac3ca,0xec08e3e8,
-0xf449e3e7,0xfc4bf429,0xf4eefcac,0x10009b49,0x18401880,0xc42d1800,0xf429f4ad,0xdbe9f46a,0x61a3cc2b,0x10820800,0x08000820,0xbc8d1000,0xeccbf54e,0xf52df50c,0xf50df52d,0xfd2bf50c,0xfd0bfd2b,0xe52fe4ab,0x1000b42c,0x08410800,0x10000820,0xecedaba9,0xfc6afccb,0xf4eef44a,0x1000bc4d,0x18811840,0x9bcb0800,0xf4ccf54f,0xfccbfcec,0xfcecfcab,0xf4ccfcec,0xf52ff4ec,
-0x10008b09,0x10201860,0x00000000,0x18402061,0x10400800,0x08600860,0x41430800,0xa36b9309,0x3123830a,0x00200000,0x00410041,0x00000820,0x08210000,0x00000820,0x49c50820,0x9b8a82e8,0x100059a4,0x18811000,0x00210021,0x00001062,0x00000000,0x08610020,0x10000020,0xfcecd46d,0xfcebec69,0xfc6bfc8b,0xfcacfcac,0xfceefc8c,0x3040d44e,0x08810800,0x30a00000,0xf4cccc4c,
-0xec09ec2a,0xb308e40a,0x18402000,0x08200800,0x20a10000,0xdc2abc2b,0xe42ae3e8,0x1800ab8a,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x10810000,0x93ec0800,0x7244d570,0x08001800,0x00400840,0x10600020,0xb44d1000,0xecabf56f,0xecabecaa,0xc3ebf4ec,0x08611000,
-0x08001062,0xe44b58e0,0xeba7f409,0xf3e8fc08,0xf3e8f409,0xebe7f3e7,0xab48e409,0x08611000,0x08001082,0xc4f07aa8,0x18607b09,0x10400800,0x00001020,0x10801060,0x10820820,0x00001062,0x08000821,0x28611821,0x18002000,0x10400800,0x00000820,0x08000800,0x18610800,0x08200841,0x08000800,0x20201841,0x69c43860,0x4902a34a,0x08410800,0x10000861,0xf429c389,0xf428f3e8,
-0xf408f428,0xebc8eba8,0xe44bf409,0x10008ae7,0x18201860,0xab6a1800,0xe3a7f4ac,0xe409ec08,0xcc8ef4ed,0x000028c2,0x10400820,0x6a251000,0xe4cccc8c,0xe4cbe4ab,0xf4ececec,0xe448ec8a,0xdc4aec8a,0x9b28dcad,0x08002840,0x10621041,0x5a060800,0xe44ae52f,0xebe7e407,0xecacf449,0x1800b3cb,0x18400800,0x9b691000,0xdbe7dc6b,0xf448e407,0xec49ec49,0xe448e408,0xe4abec89,
-0x10008ae7,0x08001840,0x72c93103,0x41025984,0x080030c1,0x10810000,0x00000841,0x38e21000,0x08001000,0x00200820,0x08000020,0x28a21840,0x00000800,0x10201040,0x00000000,0x10001000,0x18610800,0x08001020,0x10201021,0x20611000,0x18604184,0x08400000,0x18000821,0xe408c3a9,0xec28dbc6,0xebc8ebe8,0xe387e3a7,0xec4bebc8,0x3020c3cb,0x08600800,0x28400000,0xec4ac3c9,
-0xe387ebc8,0xec8df44a,0x10005921,0x00001040,0x08000042,0xd42a6182,0xdbe9e409,0x2000bbeb,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410021,0x52270000,0x100049a3,0x10401840,0x00200000,0x00200020,0x93ac0800,0xfdcee56f,0xececf54d,0xb3aaed0d,0x00201000,
-0x10001061,0xdc0a50a0,0xf3e8ec09,0xebe8f408,0xf409eba7,0xf428f408,0xb368f48a,0x00401000,0x10200882,0xedb17a86,0xc4adf5f2,0x18007245,0x08001000,0x00000800,0x08200840,0x10200000,0x28811020,0x40202800,0x92859a86,0x180048a0,0x10411040,0x18620800,0x00001041,0x00000020,0x30811840,0x79c32800,0xe4cec3cb,0x5982dcef,0x10600800,0x10000020,0xfc6acbc9,0xec09ebc8,
-0xf44ae3a7,0xebe9f44a,0xec8cfc6a,0x10008ac7,0x10202080,0x9b081800,0xf449e44a,0xf48af429,0xdd0ff50d,0x00005a27,0x08001881,0x10001020,0x932851a3,0xe4abdcac,0xec48e449,0xec6ae408,0xb3eadcab,0x10006205,0x10410800,0x10210000,0x49850000,0xe4cdbc4d,0xf469ec6a,0xecccdbe8,0x1000abca,0x18411000,0xa3491800,0xf48aecac,0xf489ec48,0xfccbf46a,0xfccaf4aa,0xed0dfd0b,
-0x18009328,0x10001860,0xc46d4921,0x79c3c3ca,0x410248e0,0x00002060,0x10610820,0x08001020,0x10201860,0x18200800,0x40e030a0,0x408048e1,0x28a14102,0x08000800,0x10600840,0x10401060,0x08210841,0x10201040,0x30201800,0xc3cb79a2,0x4101bc2d,0x08200800,0x18001021,0xebe8bb27,0xf3e9f3e8,0xfc2af3e9,0xebe8f409,0xeba8f3c7,0x4040c348,0x08601000,0x10000020,0xec09b347,
-0xeba7e387,0xec8dec09,0x2000ab8a,0x08410000,0x08200041,0x69831800,0xc389b2e7,0x2800a2e7,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200020,0x18800000,0x08200800,0x00000820,0x00400881,0x08000820,0xbc6b6203,0xf58fed8f,0xb3eaed4d,0x10610800,
-0x10001041,0xcbe948c0,0xfc29ec09,0xf428f428,0xf409f409,0xf428f429,0xbb88f46a,0x00401000,0x08000881,0xfdf18285,0xf5b0fdd0,0xab8ae50f,0x28814923,0x08610800,0x00000000,0x28801840,0x48e03080,0xcbca92a7,0xe44ae44b,0x7a04c3c9,0x10002000,0x10001841,0x08400000,0x08400041,0x40402860,0xe44ca2c7,0xf4adec4b,0x5941cc0b,0x08600800,0x18000860,0xf409c388,0xf40aec0a,
-0xf44afc4a,0xf44afcac,0xecacebe8,0x1000a38a,0x18601840,0xa36a1800,0xdbe8dc4b,0xdc8be42a,0x5161ab88,0x08410800,0x08000000,0x10401040,0x18000800,0xb3886182,0xecececed,0xdccdeced,0x180092e7,0x08200800,0x00000861,0x08210821,0x08001041,0x92e72820,0xf52de4ee,0xe4edeccc,0x1000bc8d,0x18410800,0xab8b1800,0xfccbf50e,0xfcabfccb,0xfccbf48b,0xfcaaf4aa,0xececfceb,
-0x10009308,0x08002081,0xd44b5100,0xdc0ae44a,0x6962ab07,0x28814902,0x00000800,0x10400820,0x20601020,0x59634103,0xab077182,0x9a66cbcb,0x48c058e0,0x28814902,0x08200800,0x08200000,0x08200000,0x18000800,0xc3a971c3,0xe42ae40a,0x3020bb69,0x10410800,0x18001021,0xf408c368,0xf3c8eb87,0xeba7eb87,0xebc8f3e9,0xebc8eb66,0x4040c368,0x08401000,0x10000020,0xebe8b327,
-0xec09f3e8,0xed0fe42a,0x49a4d530,0x08610000,0x00000000,0x18001020,0x92a74880,0x3060a36b,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x00000861,0x18810800,0x080018a3,0x08200840,0x10400000,0x10000800,0xc48d6a45,0xbc8ce58f,0x08201020,
-0x10000841,0xdc4b4080,0xf3e7f44a,0xf448f407,0xf409fc49,0xf429fc4a,0xb388f46a,0x08601000,0x10001081,0xfdf082c5,0xf54efdb0,0xed70f54e,0x4142c4ae,0x08620000,0x18410000,0x48803880,0xc3a981e3,0xec6bf4ed,0xe3e8ec09,0xe42aec29,0x6102aac7,0x10002000,0x08201041,0x10000020,0xb3886183,0xec4aecad,0xebe9ec08,0x6962dc2b,0x08401000,0x10000860,0xec2abb88,0xf42afc4a,
-0xfc4af409,0xfc8bfcab,0xfd2efc69,0x1000abcb,0x10201860,0xa3cb1000,0xdc6bed0e,0x7224c42b,0x00001000,0x00000860,0x08410841,0x08210021,0x18401061,0x18000800,0xbccf8328,0x41009bab,0x08200800,0x08401060,0x08600020,0x00200020,0x10410020,0x08000800,0xa3aa59a3,0xe54edd0e,0x1000bc8d,0x18600000,0xb3cb1800,0xfcabf50e,0xebe8fc6a,0xec29f44a,0xf469ec29,0xe4edec8a,
-0x10008b09,0x10001861,0xd42a5961,0xdb87ec4a,0xdbcaf42b,0x48e19245,0x00001820,0x08200020,0x38a01000,0x9a655901,0xec0adc0a,0xebeae3c9,0x9223cb48,0x490158e0,0x10413123,0x00000000,0x08000820,0x8a864101,0xec4adc2b,0xec09ebe8,0x2800b328,0x08210800,0x10000821,0xf449d40a,0xfc29f408,0xdb25db25,0xf409f3e9,0xf44aebc7,0x4060cbeb,0x10411000,0x18000000,0xf46abb68,
-0xf4acec6a,0xabebe4ee,0x086049e5,0x08000000,0x08000841,0x18410800,0x08001000,0x10403103,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08200000,0x20601860,0x20002881,0x10001000,0x08001041,0x10611081,0x20201000,0xa46ca40a,0x08400800,
-0x10001041,0xd46c3840,0xf428f46a,0xfc48fc68,0xfc8afc69,0xec29f449,0xb387fceb,0x08801000,0x08001061,0xed8f8ac6,0xfd8ffdaf,0xed4efd4e,0x1820ac0b,0x00200820,0x10000821,0xd42c69a3,0xfd0df4ac,0xfc8afd0d,0xfc4af42a,0xfc2afc49,0xe46de40a,0x2820a30a,0x08400800,0x10000800,0xf54fc46d,0xf429e42a,0xec09fc49,0x79e4dbea,0x10810800,0x10000040,0xf48bc40b,0xfc6af44a,
-0xf42aec09,0xfc8af449,0xe42aec08,0x10009b49,0x10401861,0x9bac1000,0x7a24bc4d,0x10002800,0x08611060,0x00000040,0x10201061,0x10410000,0x08000820,0x00001881,0x18600000,0x08000800,0x00201081,0x10200800,0x080020a0,0x08610820,0x00000000,0x10810841,0x10000800,0xc4ef7245,0x0800ac6e,0x10600020,0xb40c1000,0xf4abe4ac,0xe3a8fcab,0xf48af46a,0xfccbfcab,0xf54ff4ab,
-0x080082c8,0x10001861,0xd44a5940,0xf3e8f44a,0xf40afbe9,0x9ae8e40b,0x00002061,0x08000840,0x8aa62860,0xe44bcc0b,0xeba8ec09,0xf3e9f3c8,0xec0afc6a,0x79e3c368,0x28a13880,0x08000800,0x08000861,0xe50f82e8,0xe386e409,0xec09f408,0x3000bb8a,0x08410800,0x10000041,0xf449c3a9,0xebc7eba7,0xf3e8eba7,0xf3e8f3e8,0xf46bf409,0x3840c3ab,0x10421000,0x10000000,0xf50db389,
-0xd4adf56f,0x10008286,0x00200000,0x08200841,0x18411020,0x00000800,0x10a20841,0x00210000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x51422040,0xb30881c3,0x280092c7,0x18821000,0x00001062,0x00001081,0x29010000,0x00001060,
-0x10000820,0xcc4b40a0,0xf407ec4a,0xf428f448,0xf46aec29,0xec48ec28,0xa346ecaa,0x08601000,0x08001081,0xed6e9327,0xfdaff54d,0xdd0df54d,0x08004982,0x10201060,0x18000800,0xf48cc3eb,0xfc6bec2a,0xfc29fc4a,0xf3c8eba8,0xebc7eba7,0xec6bf44a,0xb3aaf4cd,0x00001000,0x08001061,0xdc8d8aa7,0xf429e409,0xec09ebe7,0x71e4ecad,0x08a10800,0x10000840,0xf54eccae,0xe3e8f4ab,
-0xf48bec2a,0xf469fcca,0xe42adb86,0x1000ab8a,0x08001040,0x39440800,0x08000800,0x10400800,0x00000860,0x10a10041,0x28201000,0x200059a4,0x10200800,0x10410800,0x00000840,0x08601080,0x08210020,0x10001020,0x69e52820,0x180038c1,0x08011842,0x00000000,0x10401061,0x10200800,0x082041c6,0x10800000,0xb44c1000,0xecaaed4e,0xec4aec4a,0xf4aaec69,0xf4abf48a,0xed0ef4ab,
-0x08007aa7,0x08001881,0xd44a5981,0xfc4aec2a,0xfc4bf3e9,0xb369e42a,0x10411000,0x08000861,0xed2db40a,0xf44af4cc,0xf409ebe8,0xf449fc6a,0xf429f3e8,0xe42aec29,0x48c0ab07,0x08210800,0x08000861,0xcc2b4921,0xfbe9e3a8,0xec4aebc7,0x2820cc0c,0x08410800,0x10000041,0xfc4bc389,0xf3e8fc09,0xf408f429,0xebc7ebe7,0xfc8df3e8,0x3820c38a,0x08211000,0x08000862,0xd50eac4c,
-0x39019baa,0x18401000,0x08400840,0x10200861,0x10001000,0x08211861,0x00200000,0x00200020,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00200000,0x10600020,0x7a870800,0xe42bdc6d,0xb389dc6c,0x100061a4,0x10611000,0x08810860,0x00000861,0x08200000,
-0x08000841,0xd4ce38e1,0xf48bf50e,0xf4ccf4cc,0xeccceccd,0xed0df50d,0xabeaf5af,0x10a10800,0x10200860,0xedb09369,0xf5d0ed6f,0xabeaedaf,0x10610800,0x10200820,0x62470000,0xd3eacc6d,0xdbc9dbea,0xfc4adb66,0xdb88e3a8,0xec08db87,0xeccdec8b,0xe52fe4ab,0x00006a87,0x08001081,0xb38a2000,0xec8ce48d,0xdc4bdc2a,0x5142d48e,0x08400800,0x08000820,0xbc2b9bcc,0xc3a8c40a,
-0xcc0ad40b,0xcc08c3e8,0xbbaacbc9,0x10008287,0x08201040,0x00000800,0x08610841,0x08400820,0x18410800,0x10001820,0xabeb5162,0x8b09d510,0x08002061,0x08210801,0x08400021,0x00200020,0x08410020,0x38e10800,0xd4cfa36a,0x7205c42d,0x20202820,0x08002061,0x08400820,0x00001082,0x00000000,0x10800840,0xa3ec1000,0xed4ee54f,0xfd4ffd90,0xf54ef54e,0xf54ffd6f,0xf5b1f54f,
-0x08007ae8,0x10001061,0xdced6a24,0xf46becac,0xe46bec6b,0x69a2d44b,0x18611000,0x52250000,0xeccbe58f,0xf46ae469,0xf429f449,0xfc8aec29,0xf428f428,0xdbe8f46a,0xb389eccc,0x10611000,0x18810020,0x82651000,0xe3a9ec6c,0xe4ade42a,0x2840bc0c,0x08610800,0x10000000,0xec4bbb8a,0xebc8ebc8,0xec29ec09,0xebc7ec08,0xec2bebc8,0x3020bb8b,0x08620800,0x00000000,0x51e36286,
-0x08000800,0x10411041,0x10400840,0x18000800,0x618369c4,0x18612040,0x08210000,0x00200000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000020,0x28a00000,0xcc6c7a66,0xd42acbe9,0xa369dc8c,0x10004920,0x10820800,0x08420821,0x00000801,
-0x00000021,0x82e82080,0x9b089b69,0x9b089b08,0x932892e8,0x8ae89308,0x6287938a,0x10810800,0x00001061,0xa44d5a66,0xa40c9beb,0x3941a42c,0x08420800,0x10420000,0x29030000,0x72655a05,0xb3488286,0xe409e40a,0xf52ef50d,0xed0efd4e,0xd52fc48d,0xbcadc4ac,0x00006ac9,0x08400841,0x41230800,0x7a457246,0x62047224,0x208051a4,0x08200000,0x10200820,0x08000800,0x20201000,
-0x28403060,0x28602040,0x10001800,0x08001000,0x00000000,0x08400000,0x00400020,0x10000000,0x20001800,0x92a74020,0xf612edb1,0xe5b2edf1,0x00005226,0x00001041,0x00620021,0x00000841,0x10610000,0x52060000,0xe52fcd30,0xed0dd44a,0x50e0bba9,0x18002800,0x00001061,0x08410800,0x00410841,0x08000000,0x51841000,0x82e76a46,0x93499369,0xb42ca3cb,0xcccfc4cf,0xd571d50f,
-0x08005a46,0x08001882,0xd52f59c3,0xed2ddd0d,0xe590f590,0x1820ac2b,0x18a11040,0xacaf0000,0xed6ef633,0xe4aaed2d,0xec69ec69,0xe429f48b,0xfccaec69,0xf4ecf4cb,0xed70eccb,0x08006226,0x08201061,0x30800800,0xd48db3cb,0xd50fcc8d,0x1000a3ec,0x00201020,0x08000841,0xecedc48d,0xecabec8b,0xec8be48b,0xdbc8ec29,0xdc2be409,0x2020abcb,0x08410800,0x08400000,0x08000000,
-0x08201881,0x08810020,0x10000000,0xb3496183,0xd3ebdbea,0x18408b09,0x00010821,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410021,0x00000821,0x08411882,0x00000841,0x7a851000,0xfd6fe4ee,0xfdb0fd6e,0xa3cae56f,0x10004101,0x10620800,0x00000842,
-0x08410021,0x10000800,0x10001000,0x18001800,0x10001000,0x10001000,0x08000800,0x00001040,0x08200000,0x00000000,0x08000800,0x00000800,0x00000820,0x08010800,0x00000841,0x08000800,0x49001800,0xfd6fed0f,0xfe12f56f,0x5961dd0f,0x18401800,0x10001000,0x08200820,0x00210021,0x08000841,0x10001000,0x08001000,0x00000800,0x00000000,0x00000800,0x00410861,0x08000820,
-0x08000800,0x00000800,0x00200000,0x00000841,0x00000040,0x00000000,0x08200020,0x28202081,0x92873860,0xf52ff4ef,0xedf1ed6f,0x6a66cd0f,0x08400800,0x08410821,0x08000000,0x10211021,0x08200800,0x08000820,0xbc6c4121,0xeccbf54d,0xe4edf50c,0x38409b08,0x28813080,0x08001000,0x00210820,0x08000000,0x10001000,0x08001000,0x08001000,0x10000800,0x10001000,0x18201000,
-0x00000820,0x08000821,0x49612040,0x722361e2,0x8b898307,0x00005204,0x08200840,0x72e90000,0xb42ba3ec,0xcc8bbc4b,0xf52de4ec,0xf4ccf4cc,0xf50cf4cb,0xdccde50d,0xbc4cc44a,0x00007b2a,0x00001041,0x08001040,0x51a338e1,0x41425183,0x080028e1,0x00200840,0x08000040,0x8ae56a44,0x8a648243,0x8a648265,0x8a038a23,0x8aa69264,0x100061e4,0x00000820,0x00000020,0x08211061,
-0x10400800,0x08001840,0x934928a0,0xdbead42c,0xc389e3ea,0x18207226,0x08210800,0x00000801,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00210000,0x08000841,0x10001000,0x10210801,0x10001880,0xfdb1abca,0xfd2dfd4e,0xf54eed0c,0x9b49e52f,0x08003080,0x00210000,
-0x08010001,0x18611020,0x10401040,0x10201860,0x10610820,0x10201040,0x08211062,0x08000000,0x08200821,0x10800860,0x10611040,0x10401040,0x08200000,0x00200840,0x08410841,0x18601040,0x10001860,0xdd2f82c7,0xd4cddcac,0x08007ac8,0x08201040,0x10200800,0x00200820,0x00210001,0x10600000,0x10411061,0x10801060,0x08401081,0x00200000,0x00200000,0x00200841,0x10610000,
-0x08201061,0x10421021,0x00410062,0x00400041,0x00000000,0x08200000,0x10001860,0x69823000,0xecedb369,0xececfd2e,0xbc8cd4cc,0x08002880,0x00001040,0x08000000,0x20002860,0x18201800,0x08211061,0x10610000,0x18000800,0xfdb0bc0a,0xfdd0fd8e,0xdc6dfdb1,0x40408204,0x20603080,0x08001020,0x08000000,0x10201020,0x18612081,0x10611040,0x10611061,0x08200840,0x08000800,
-0x08210000,0x08010000,0x08000800,0x08000800,0x08000800,0x08400000,0x08210021,0x08001021,0x10001000,0x39011000,0xccad59e3,0xf4abfd4e,0xdcccecab,0x49628ae7,0x08003101,0x10211020,0x08410000,0x00200040,0x08000000,0x08000800,0x08410000,0x00200000,0x08400020,0x10000800,0x10001000,0x08001000,0x10001000,0x10001000,0x08200800,0x00200000,0x00000000,0x08210000,
-0x10201061,0x69812000,0xecedcc4b,0xdc2bec8c,0x5102cc0c,0x08200800,0x10621061,0x08001062,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x72ea0800,0x10007ac9,0x08210800,0x080010a1,0xed706a04,0xececdc6b,0xfdaffd8f,0xf5b0f56f,0x7b09dd71,0x00620000,
-0x00000841,0x08000800,0x08200820,0x10401020,0x08201041,0x00000820,0x00010001,0x08010001,0x08000800,0x18811020,0x10210800,0x00000000,0x08000820,0x10400800,0x10401020,0x18401840,0x18601040,0xa3eb1000,0xabebf5d2,0x10611000,0x08001061,0x10001000,0x08000800,0x10411021,0x00000820,0x08000820,0x08400000,0x18411000,0x00200841,0x00000840,0x00000000,0x10001040,
-0x18201000,0x18001800,0x08411021,0x00000020,0x00000040,0x08000840,0x69c41800,0xf50ec3eb,0xfd4df4ed,0xfd6df50b,0x61e3f5b0,0x18a21000,0x10600820,0x30402061,0xa36a5100,0x28407226,0x10202020,0x00000841,0x10001882,0xed2e69e3,0xe48aecec,0xeccceccc,0xcc2cf50f,0x18005141,0x10201000,0x00000820,0x08000000,0x08000800,0x08000800,0x00000000,0x08400000,0x08400000,
-0x00010821,0x00000822,0x10810000,0x10810840,0x18c21080,0x00000861,0x00000021,0x18410800,0x18612082,0x08000800,0x62040800,0xecede50e,0x69c2dcac,0x00001000,0x08400020,0x08010800,0x00200821,0x00200000,0x08610861,0x10610820,0x00210841,0x00000001,0x00200020,0x10601040,0x08611081,0x08621082,0x18a21062,0x10801061,0x00200881,0x00210000,0x00000020,0x08001882,
-0x38c00800,0xe4aca327,0xe44aec8b,0xd44cf4cd,0x10004080,0x00201881,0x08001040,0x10001000,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000001,0x00000000,0x00000000,0x10600020,0xa42d0800,0xbcceee12,0x000028e2,0x08001081,0xe52f61c3,0xf5d0f5b0,0xb46bbcac,0xedafedb0,0xcd4fedcf,0x002020e0,
-0x08000840,0x10001000,0x18201800,0x10001000,0x10201000,0x08200800,0x00000820,0x00000021,0x20611881,0x18001000,0x08001000,0x00200020,0x30e30800,0x200040e1,0x20002840,0x10001800,0x10611020,0x41630800,0x49a4b4af,0x10620800,0x18410000,0x386038a2,0x30603040,0x10002000,0x08411040,0x08200000,0x10000800,0x18002000,0x08001000,0x00210000,0x08400000,0x20001820,
-0x38003000,0x40403800,0x30403840,0x08002020,0x08200820,0x41010800,0xdc6cab69,0xfd2efd2f,0xec4afced,0xf52cfcca,0x5182dd2e,0x10210800,0x20600020,0x9a8640a0,0xfd6fe4cd,0xbbaaed0e,0x20006162,0x08211000,0x10000841,0xecee6162,0xfd2cf4ac,0xed2df52c,0xfdf2fdd1,0xa3abe571,0x08002860,0x00410020,0x18c20020,0x30c228a2,0x28812881,0x28a12881,0x18612081,0x00000800,
-0x00000000,0x08610000,0x18801881,0x00000820,0x00000020,0x00210020,0x18820841,0x18202061,0x10410800,0x08200820,0x08001081,0xddd37ae8,0x10009bcc,0x10821881,0x08000020,0x08000800,0x08200800,0x00200000,0x00000040,0x08000821,0x10621021,0x00000821,0x00410020,0x08000000,0x00200020,0x08210821,0x00410021,0x00400041,0x00000020,0x00010001,0x08410000,0x28200800,
-0xdccda389,0xe4cbed4d,0xf4edeccb,0x8a86f550,0x18a01800,0x08000820,0x62051000,0x3902936a,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400020,0xac0b1000,0xd54ef5f0,0x00003942,0x08001081,0xe5f25a04,0x8307d54f,0x10001000,0xbc8c7265,0xcd4fedf0,0x00002100,
-0x08000840,0x30a12060,0x38c03060,0x286030a0,0x28403060,0x10401020,0x00000000,0x08200840,0x49432040,0x61e65163,0x08003925,0x00000840,0x38a12861,0x9b287a45,0xa36a9b28,0x7246abab,0x10410800,0x00001040,0x00000820,0x08001041,0x30821000,0x48603840,0x616250e0,0x61c469c3,0x08200800,0x08000820,0x5a071841,0x92e88287,0x10007aa7,0x08410820,0x00000862,0xac2d6288,
-0xab49b3cc,0xb349ab28,0xab49b348,0x10007246,0x18810800,0x8b290800,0xe4cde50f,0xcbaae46d,0xfd2ee48c,0xe48bdc49,0x38e0ccce,0x10400800,0x39000800,0xfd2eab48,0xec6afd2d,0xfd2eec4a,0x8a85dc4b,0x08003060,0x08001062,0xcc4c5101,0xf50deccd,0xdd2eed8f,0xf5f2f612,0xedf3edd1,0x1860ac4d,0x08610000,0x00000000,0x28202040,0x38203020,0x38804080,0x28204080,0x08201000,
-0x00200000,0x00000860,0x30801800,0x18202020,0x00210820,0x08400000,0x28400800,0x512240e1,0x288030a0,0x00001861,0x00000841,0x52260800,0x08001840,0x08200841,0x288120a2,0x38c230c2,0x184130a2,0x00200820,0x00000000,0x08000801,0x10001800,0x08411000,0x00000000,0x08210000,0x10400000,0x28402020,0x10001820,0x10401020,0x10611020,0x00210000,0x08000842,0xc4cf6246,
-0xfdf1f5d1,0xed4efdf0,0xed2ef52d,0x4901dd0f,0x10800800,0x08000800,0xe551936a,0x3080dd30,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18400000,0xa3ca1800,0xccecedae,0x00003922,0x00001061,0x83ab41c5,0x080028c0,0x18611020,0x08000800,0x9c6d7329,0x00002901,
-0x08001040,0xbcae1800,0xdd2ed52f,0xd50edd6f,0xdd6fdd2d,0x08008baa,0x00201081,0x10200861,0xc4ae2820,0xcd92e613,0x000041a5,0x18401080,0x82663020,0xf58fe52f,0xfdf1f590,0xdd2efdd0,0x08004962,0x00400840,0x08410000,0x18200000,0x69a52800,0xe50fcc8e,0xed0fecef,0xedf2e54f,0x08006aa8,0x10611081,0xb4900800,0xe52ffe14,0x6a45e571,0x10620800,0x00000862,0xee5541c5,
-0xf5aff652,0xfd4ef54e,0xf54ef52d,0x30c0c4ad,0x18610800,0x72e80800,0x8b08bcce,0x384061a4,0xabca5983,0xedb0e50e,0x1000c50f,0x10600800,0x9b8a1000,0xfccbed0d,0xf408f449,0xf408f3e8,0xececfcaa,0x10009309,0x08001061,0xbc8d3080,0xb40be570,0x5a038307,0xcd70a42b,0xedd1edd1,0x3901bcce,0x10200800,0x6ac70800,0xa3079b49,0xc3a9b347,0xaac7bb28,0xab49b307,0x08006205,
-0x10401040,0x49840000,0xab28ab8a,0x71e5b36a,0x08410800,0x08000841,0x8a455121,0x9a859a85,0x61829285,0x10002020,0x08410800,0x00000820,0x10200000,0x10000820,0x50803860,0x486050a0,0x28203820,0x00001840,0x08200820,0x39030800,0x61c469e4,0x08002020,0x00400020,0x08000841,0x59a330e1,0x81a28203,0x79e47182,0x618271a3,0x18005141,0x08410800,0x41430800,0xedf3ddb3,
-0xb44ddd51,0xbcad8b48,0xedafedaf,0x38e0d570,0x10810000,0x41210800,0xf52fdcef,0x3860cc6d,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200000,0xa3ea1000,0xccedf5f0,0x00003122,0x08200841,0x00000000,0x18a10000,0x08211001,0x08411062,0x00000000,0x08001040,
-0x08000840,0xe5912840,0xfdeff5f1,0xfdcffe10,0xdd6ef5ae,0x08006a86,0x00001081,0x100018a1,0xedd19b69,0x93ebe612,0x10810800,0x18401040,0xd48d48a0,0xfdaffdb0,0xf54efdd0,0xe52deceb,0x1000bc8d,0x08610820,0x00200041,0x28a10000,0xd48f3820,0xf590fdd2,0xfd90fdb0,0xf611f5af,0x2080cd51,0x10810000,0x6a670800,0xfdb1f5d2,0xc48ded90,0x08001800,0x10a20841,0x9c0c0800,
-0xedaeee52,0xf52cf56d,0xfd8efd4c,0x3920d52e,0x10400800,0x28e10800,0x100030e0,0x10001000,0x10000800,0xac4d6204,0x08009c0c,0x10600840,0xb40c1000,0xf489f52d,0xfc49fc69,0xfc28fc29,0xf4ebec27,0x1800bc0c,0x00001040,0x9bed0800,0x18008b29,0x08000800,0x20800800,0xbcce7286,0x28a0b4ae,0x08000800,0xc50e28c0,0xf50ded70,0xfcecfd0c,0xec4bf46b,0xed0fe42b,0x080082e8,
-0x18601040,0xabed1000,0xecadfd91,0x92c8eccf,0x10621000,0x18000800,0xecacc40b,0xf4edec6c,0xed70fd6f,0x180061e4,0x00001041,0x10610000,0x10400840,0x82ca1000,0xdc6dcc4e,0xdc4ce46d,0x92e9d46e,0x18401800,0x10610800,0x49a50000,0xe550d510,0x18007a67,0x00201080,0x08000841,0xc4cf4163,0xe46bed0e,0xf4acf4ac,0xe4cdecad,0x2000b3ca,0x08401020,0x39430800,0x9369bccf,
-0x10004101,0x08000800,0xb48c7ac5,0x20a0b4cf,0x10400000,0x61e51000,0xf52ee4cd,0x3020dcce,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200821,0xac4d1000,0xc52eee11,0x00202921,0x00000841,0x18810820,0x18402081,0x18611861,0x10411061,0x10201861,0x00000821,
-0x08000841,0xd53030c0,0xf54efdf1,0xed0cf54d,0x9328ed4e,0x18821000,0x10620000,0x59831800,0xf632edb1,0x1000a40c,0x10400800,0x18001860,0xfdb1ab8a,0xfdd0f56f,0xfd2dfdaf,0xe4eced0c,0x9349f5b0,0x10610800,0x00200000,0x10201061,0xf6129348,0xf590ed90,0xed2df56f,0xed6fed2d,0x93ebee12,0x18c20800,0x08001081,0xfdf2bc4c,0xf5f2fdd1,0x10008b29,0x08401081,0x18400800,
-0xedafcd50,0xfd6df56e,0xf54ef4eb,0x5182cccd,0x08610800,0x00000820,0x10810000,0x10611061,0x10811081,0x08000800,0x08003143,0x10200821,0xb40c1000,0xfccbf54e,0xfcabfccb,0xfccbf4aa,0xecccf48a,0x1000bc4c,0x08610000,0x08000020,0x10200800,0x18811040,0x08001861,0x08000800,0x18813984,0x08000821,0xcd0e3941,0xf48af54e,0xfc8aec28,0xf48bfc8b,0xc40bec6c,0x08003080,
-0x08001061,0xdccf40e1,0xf4ede46c,0x2820dcef,0x18810800,0x72860800,0xf48aeced,0xfd4ef4cc,0xfe74fdb0,0x1800c4ae,0x00201040,0x00000840,0x08000840,0xd51038c0,0xfd6ffd70,0xfd90fd4f,0xe52ffd8f,0x180069e4,0x08001020,0x08001061,0xf5d1b44d,0x5141d4ee,0x10611000,0x10610800,0xa44e0800,0xf50ded90,0xfcecfd4e,0xf52efccc,0x2020c46c,0x00200800,0x18800000,0x08001880,
-0x10411000,0x086010a1,0x08000800,0x10602902,0x10810000,0x6a670800,0xf4eeecef,0x3020dcae,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000821,0xbd310800,0x6ac6c530,0x00001060,0x08000841,0x20611000,0x38e22880,0x100030a0,0x08000800,0x10201840,0x00210000,
-0x08000841,0xd5b328a0,0xf5d0fe53,0xf54eed4d,0x38e0e5b1,0x08210800,0x20820801,0xbc2d2800,0xf5f1fe12,0x1000b48e,0x18601860,0x62250800,0xfdb0ed71,0xfd8ff58f,0xfd2efd4e,0xfdaffd6e,0xd530ed4f,0x08202081,0x10600820,0x41840000,0xf652ddd1,0xf58ff5b0,0xfdaff58e,0xf58ffd6e,0x8368ee11,0x10810800,0x08000880,0xfe1282a6,0xf590f56f,0x4101d530,0x08400800,0x10001861,
-0xf6536a65,0xf54df5af,0xed4ef52d,0x51c4dd30,0x08610820,0x08200020,0x08400840,0x10600820,0x00201061,0x00201081,0x08210000,0x10210000,0xbc8e1000,0xf4ecf54f,0xecaaf4cb,0xf4ebfd2c,0xf4edec6a,0x1820ccce,0x00200000,0x00200000,0x08401081,0x18201000,0x10001000,0x10621882,0x08000000,0x00000862,0xcd2f4162,0xfccaed0c,0xfc8afc89,0xf4ecf48a,0x9b28ecee,0x10601000,
-0x08001061,0xf52f9b29,0xfd6ff4ed,0x1000a3aa,0x00001861,0xc4ae2080,0xf4aaf52d,0xfd8feceb,0xedd1f5b0,0x8b49fe33,0x10810800,0x00200840,0x08000881,0xed6fac0c,0xf52ced0d,0xfd2dfd2e,0xfdb0f52d,0x2820bc2c,0x08411020,0x10000820,0xdd2e6203,0xbc2bf58f,0x18402000,0x08410820,0x10000000,0xf58fbc8d,0xf4abf4cc,0xf50df4aa,0x1800bc2b,0x08410800,0x00000820,0x10a10020,
-0x10411021,0x00000000,0x188118a1,0x00000000,0x10400000,0x72a80000,0xf52ef590,0x3880dccf,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x52271882,0x08002080,0x08410820,0x10400000,0x38c22061,0x382048c1,0x92c74060,0x59a4a38a,0x08001800,0x00001882,
-0x10610000,0x5a660000,0xe5d1ac8e,0xedf0edaf,0x00007b28,0x00201081,0x10001861,0xfdd37a66,0xfdd1fdb0,0x6aa7f654,0x18a10800,0x83090800,0xfdf0fe12,0xfdaffe10,0xeccce4ab,0xf58ff54e,0x938aed91,0x08210800,0x18820821,0x62670800,0xedf1f675,0xfdafed8f,0xf54df56d,0xfdf1fd8f,0x0800c50e,0x08400820,0x08001081,0xed706a04,0xed2df54e,0xa3ebed8f,0x10610800,0x18410820,
-0xa42c0800,0xed6eedb0,0xe5b1fe11,0x2061a40e,0x00200000,0x08200840,0x18400800,0x10001820,0x10201000,0x08401060,0x08410021,0x08200821,0xa40c1000,0xe48bed2e,0xf52decec,0xeccceccc,0xf50de449,0x1000ac0b,0x00210820,0x00200021,0x10200000,0x28002000,0x28413040,0x08200800,0x00001041,0x00000021,0xb46d28c1,0xf50bf56e,0xf48afccb,0xe50ceceb,0x3080c48d,0x10600800,
-0x30a00800,0xf4ede4ef,0xdcede48a,0x000051e4,0x080020c2,0xdd707ae8,0xfd6decec,0xed6efdae,0xf590fdf0,0xdd71f590,0x08203922,0x10600820,0x39630000,0xed2eccef,0xfdadf52c,0xf50cfd4d,0xed6df54c,0x9329ed8f,0x08210800,0x08000840,0xc4ad1820,0xf56fed2d,0x18009309,0x08001861,0x08001041,0xcccd4100,0xf52cfdaf,0xed2ef52c,0x2880c4ae,0x08210800,0x00200000,0x00610081,
-0x10001020,0x28c128a1,0x08000800,0x00001062,0x10820021,0x5a250000,0xf56eed8e,0x3840d4ae,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x00000800,0x10610000,0x00210000,0x10000000,0x61844123,0x9a8560e0,0xf52fd42b,0xe530ed4f,0x38e1a3cb,0x10610800,
-0x00000840,0x00000860,0x5a041000,0xac8dbcee,0x08600000,0x08200040,0x30402060,0xfdd1cc8e,0xf58ff56e,0xbccef612,0x18c10800,0x30a00800,0xf5d0d50f,0xf56ef5ae,0xf52deccc,0xf5f1fdd0,0x1000cd2f,0x08410820,0x08200000,0x08001020,0xfe74a42d,0xf56eed8f,0xed4dfdcf,0xf612ed6e,0x08006aa6,0x08401061,0x10001060,0xfe12ac0b,0xfd6dfd6d,0xedb1fdf0,0x080072c8,0x10411882,
-0x39220800,0xf633e5b2,0x6a86bcad,0x08001000,0x00200841,0x10200000,0x30202860,0xa3ca5120,0x20007a66,0x10401000,0x00000841,0x10400000,0x51c40800,0xfdf2c46d,0xed6ef5af,0xfdb0f56f,0xd4cefdb0,0x08006a45,0x08001020,0x08000820,0x38c12081,0xab8c5942,0x406092c9,0x18403081,0x10410800,0x00200020,0x41220800,0xed4e9b48,0xf54efdaf,0xdd2ef54e,0x080072c7,0x18811061,
-0x9b691000,0xecabed0e,0xc48bf50c,0x08401820,0x08001860,0xccef49a3,0xe4cbed0d,0xfdf0fdaf,0xf58ffdaf,0xedd2fdd1,0x00006ac8,0x08201060,0x08001081,0xed8f9b89,0xed0bed4d,0xf50ceccb,0xed4ded2c,0xd530ed6f,0x00001820,0x080010a1,0xdd704982,0xeccced0d,0x48e1e530,0x10620800,0x18610821,0x72850800,0xed6edd4e,0xe570e54e,0x1800a3ec,0x08200800,0x00000020,0x08000020,
-0x41022040,0x40e02800,0x30a24923,0x08210800,0x08410000,0x28e00000,0xdd4fa3c9,0x2840d511,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410840,0x00400841,0x00200820,0x10000000,0x822540a1,0xfd4ed40a,0xfd6efd6e,0xfd8ff54d,0xdd71fdf2,0x08006247,
-0x08201040,0x10810000,0x08001060,0x18a10800,0x08410000,0x18810000,0xb3ea2000,0xf54efdf1,0xfdeffd8e,0xedd1f5b0,0x00007308,0x080018c1,0xedd27ae8,0xf58ef5af,0xfdcffdcf,0xedf1fdf0,0x08006aa6,0x00200861,0x08200020,0x08200820,0xcd5128a0,0xed8ef612,0xf5d0f5af,0xb46df632,0x10401000,0x08400841,0x59c40800,0xfd8fed91,0xfd6dfd4c,0xed2ffd2d,0x30a0d550,0x08410800,
-0x00001081,0x72c86a88,0x08000800,0x08210841,0x08000000,0x49211820,0xaae76941,0xf590e4ce,0xc40be50e,0x18006142,0x08201000,0x00000800,0x08200840,0x6a660800,0xd50eb46c,0xcceef5d1,0x20608b6a,0x08400800,0x08000800,0x40e20800,0x8a665942,0xf54fd42c,0xcc6cf591,0x40a06982,0x000028a0,0x08400000,0x08001041,0x62451000,0xe5b0ccee,0xbccef5f1,0x10600800,0x08001061,
-0xed914941,0xed0ded2e,0xdcecfdae,0x080038c0,0x20811020,0x7b290800,0xfdb1f613,0xfd8ffd8f,0xf54ffdd0,0xd572fe12,0x080030c2,0x00200840,0x08000840,0xcd2f4182,0xf58eed6e,0xfdaffdaf,0xfdf1fd8f,0xb46efe74,0x18a30800,0x08001080,0xf5f1a40b,0xf52eed2e,0xc46dfd90,0x10401820,0x08200800,0x080018a2,0xddd18b68,0x7ac8c4ee,0x08001000,0x00001020,0x10410000,0x49631000,
-0xdd30ac0c,0x6981b3ca,0x490248a0,0x10412881,0x00000820,0x00001061,0x41a30800,0x30e3834c,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08400800,0x00200000,0x00000020,0x08001082,0xe4ee69e4,0xfcebf4cc,0xec89fd0b,0xec8aec89,0xf590e48b,0x08008b4a,
-0x08001881,0x08410000,0x10410800,0x00000841,0x08200841,0x10001041,0xe4ee7a04,0xed0de4ec,0xdd0ddcec,0xcd0fdd2f,0x08209c4e,0x08400860,0xa40c0800,0xdd2edd50,0xdd4ee54e,0x9beadd8f,0x10800800,0x00400020,0x08200820,0x10600840,0x62870800,0xac0aac2c,0xb42bbc4b,0x5a05b48d,0x10620800,0x08410021,0x8b6b0800,0xdccddd30,0xed2ced4e,0xed0df52d,0xabebed4f,0x10810800,
-0x10610020,0x00000800,0x08600840,0x00210041,0x10200821,0x93081000,0xfd0edc6c,0xececfd4f,0xfd90f4ed,0x9b09dc8e,0x00002060,0x00000841,0x08600020,0x08000860,0x6a441000,0x4121938a,0x00000800,0x00200861,0x10200000,0x69e41800,0xfd70cc4d,0xfd6ffd90,0xfdb0f56f,0xa308e50e,0x10004901,0x00201040,0x08420000,0x00001082,0x72a71000,0x6266ac6e,0x08600800,0x100018a2,
-0xfe11abeb,0xf56ff56f,0xf5b0ed0c,0x1000936a,0x08002061,0x08000820,0xf5b2b46e,0xf54ef570,0xf590fdb0,0x72c8e5d2,0x18820800,0x00200820,0x10a10020,0x8baa0800,0xedd0f633,0xfdf0f5d0,0xfdd1fdf1,0x4963dd91,0x08620800,0x31010000,0xf590dd50,0xfd4ff54f,0xfdd1f50d,0x08007286,0x08201881,0x00000021,0x7b4920a0,0x08004183,0x08011020,0x08200000,0x08000861,0xcc8e59c4,
-0xfdd1f5f2,0xfd4ffd8f,0x6142b38a,0x186030a1,0x00000820,0x08200020,0x00001081,0x08000800,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08400840,0x00000000,0x10001062,0xf54e7a24,0xec69ec6a,0xec48ec48,0xebc7ec08,0xe48ce3e7,0x10008287,
-0x00001861,0x00210021,0x08410842,0x08210841,0x10410000,0x40801000,0xec6ccbcb,0x9b67d48b,0x418338e0,0x39434143,0x00202922,0x08400000,0x20a10000,0x59e451a4,0x72c66224,0x20c162a7,0x08400000,0x08600000,0x08000800,0x08400000,0x00000860,0x08000800,0x08001000,0x08000800,0x00210821,0x00000000,0x31230840,0x61e54963,0xc48c8b07,0xed2df5af,0xed90f54e,0x08006225,
-0x08201061,0x10a10840,0x00200841,0x00000821,0x08400042,0xc4cd1000,0xecccfd90,0xeccceccc,0xfd4efd2d,0xe510fd4f,0x08006a68,0x00001082,0x08600840,0x10611061,0x08001860,0x00000800,0x086010a1,0x00000840,0x08000841,0xcc6d38c0,0xfd8ffdb0,0xfdb0fd6f,0xecccfd0d,0xed4ff54e,0x2800ab8a,0x08401000,0x00410021,0x10810041,0x08000800,0x08000800,0x10600820,0x51a30800,
-0xed2de52e,0xf570fd6f,0xed90e52e,0x4183cd50,0x08200800,0x08001061,0xbc6d5183,0xc42cccae,0xcccec42b,0x10409c2d,0x08410000,0x08400820,0x00400020,0x18800000,0xcceea44c,0xdd2ed50e,0xe5b1ed6f,0x08008b6a,0x10811081,0x6a870800,0xed2edd0f,0xed2df58f,0xecedecab,0x2840c42c,0x08401000,0x08400000,0x00000000,0x10820000,0x00000821,0x00200020,0x08000861,0xed4fb3eb,
-0xecabe4ab,0xfcececaa,0xdcaefd4f,0x100069e5,0x08610840,0x08400000,0x08410820,0x00001061,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x00000000,0x18411841,0x00000800,0x00000840,0x10001041,0xed2d7a44,0xfcaaecaa,0xf469f469,0xfc49fc29,0xe46bf448,0x10008ae8,
-0x08201860,0x08000820,0x08000800,0x08201861,0x10200820,0x9b4a1000,0xec8ce46d,0x1800bc0a,0x00000800,0x08000800,0x00000000,0x00000040,0x00000821,0x08000800,0x00000800,0x00000820,0x00000841,0x080018a2,0xb4af8b4a,0x08400800,0x08600861,0x10a110a1,0x08410840,0x08410821,0x00000000,0x00200021,0x08000020,0x10000800,0x39001000,0xed6ed50e,0xed90e50d,0x0800cd51,
-0x08000800,0x00001061,0x18400800,0x08000800,0x00200041,0xc4ce1000,0xececf58f,0xfd4ef50d,0xfd4efd4d,0xed50f4ed,0x08007ae9,0x08410861,0x08000800,0x10201000,0x18611841,0x18a21061,0x18600000,0x08000800,0x08001061,0xdd0f5162,0xf50ded2d,0xf52ef52d,0xfd0dfd2e,0xf58ff52d,0x2800d4af,0x08401000,0x00610041,0x00000861,0x08211041,0x08410000,0x10400820,0xac0b1000,
-0xf56ef5b0,0xdd0ff591,0xa3ebccce,0x39628b8a,0x08410800,0x10200800,0x38e00800,0x40c05983,0x180040a0,0x00000800,0x10620021,0x08000800,0x00000020,0x00000861,0x30a01000,0x59c24120,0x6a456a23,0x000020a0,0x00200840,0x39020800,0x71e261c3,0x92a58265,0xdcacbbc9,0xa369ed2f,0x18a21000,0x00000820,0x18c20820,0x08210841,0x10411882,0x08200000,0x10001081,0xed0cb3c9,
-0xf4aaf4cb,0xfd0cfd0c,0xf50eec8a,0x1000a3ab,0x00201081,0x08200000,0x08000820,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20402882,0x520651c5,0x08610000,0x08001061,0xdccb7244,0xec28ec89,0xf42afc8b,0xfc8afc4a,0xed4dec89,0x08008b49,
-0x08201081,0x8b0a1000,0x4901a38b,0x10401000,0x10400820,0xa40b0800,0xd4addd0e,0x08004942,0x08611081,0x10200800,0x00001020,0x00000840,0x10420000,0x08201041,0x08401080,0x08401040,0x10610000,0x59a41000,0xf5d2dd10,0x0800a3ed,0x08401881,0x08610881,0x08400000,0x00000841,0x00000800,0x00400000,0x08200840,0x10401040,0x100020a1,0xe57082c7,0xedf2e590,0x08008bab,
-0x08210820,0x28610800,0x28402840,0x08002861,0x10800000,0xb4ae0800,0xfd6ef5af,0xf50cfd8e,0xf54cf56d,0xed90dccb,0x0800834a,0x08001081,0x72a730c0,0x20004901,0x18001800,0x10001841,0x18002840,0x18212000,0x08201062,0xd5504162,0xed2ced6f,0xf4ecfd4d,0xfd4efd2d,0xf5b0f52d,0x38a0ccef,0x10200800,0x00000840,0x20611000,0x10411000,0x00410841,0x08000840,0xdd705a04,
-0xf5f1ed6f,0x1000ac0c,0x00000800,0x08200000,0x08001040,0x08000820,0x00000820,0x10000800,0x08001000,0x08211861,0x08001021,0x39223923,0x08410000,0x08000000,0x08001860,0x08000800,0x08000800,0x08400000,0x08200000,0x00000861,0x10000800,0x10001000,0xbc4c3880,0xe52ff54f,0x080059a4,0x00001061,0x08210000,0x080020a3,0x08000800,0x08201020,0x10000841,0xf52dab89,
-0xfd2bf50b,0xf4ebf50c,0xfd2ef4cb,0x1000abca,0x00201060,0x08000820,0x28c31861,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x10400000,0x72681800,0x8b8bc4f0,0x10810800,0x08000861,0xdd0e59c3,0xec49eccb,0xf46bf46b,0xf4ccf46b,0xac0af56e,0x00003121,
-0x18600860,0xb3cb1800,0xdccee50f,0x100082e8,0x10811061,0x41820800,0x82e7d570,0x10820800,0x00000840,0x18201840,0x18401820,0x10611061,0x00000821,0x00200000,0x08400840,0x18201840,0x20402081,0xd4f02800,0xf590fe12,0x8b4aedd3,0x10001000,0x00000000,0x00200820,0x00200000,0x08000000,0x10811061,0x18601060,0x08201861,0x18600820,0x938a1000,0xbccfee34,0x00001000,
-0x08001061,0x40a11800,0xc44d92c7,0x10008b2b,0x10401881,0x9c0d0800,0xf56ef612,0xfd6ef52d,0xed6ef58e,0xddb1f5f0,0x00005a46,0x080010a1,0xe5915a04,0xab69dcef,0x38807225,0x30401800,0x9b2b6163,0x30a2bc71,0x00000000,0xe6545a66,0xe54de58f,0xfd8ef58e,0xf52dfd4e,0xedb0f56f,0x2860cd10,0x10400800,0x730b0800,0x30606207,0x18202840,0x00000000,0x000010a1,0xddb193cb,
-0xcceee5b0,0x080030c0,0x088110a1,0x104018c1,0x10201020,0x08200800,0x08610000,0x08200881,0x18611020,0x10200800,0x18000800,0xac4dbcaf,0x18611000,0x10001000,0x10401000,0x10611061,0x08611062,0x08410021,0x10200800,0x08400000,0x10611081,0x20a31062,0x51830800,0xf570d4cd,0x1000ac2d,0x00200820,0x08000841,0x38e21000,0x49838b4a,0x08200800,0x10001061,0xf58fabeb,
-0xf50ce4aa,0xececf52c,0xf50dfceb,0x10009348,0x08401080,0x28a20000,0x280038c2,0x104028a1,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200000,0xac0d1000,0x9369edf3,0x18c21000,0x10600000,0x72661000,0xe48cc40b,0xec6bf48b,0xd4adecad,0x10208b08,0x00600820,
-0x10200860,0xcc0b2800,0xf56fed0e,0x59c2dd2e,0x08820800,0x08000820,0x18804a06,0x08400800,0x20600800,0x20002840,0x10002000,0x08000800,0x00000000,0x00200020,0x08000840,0x30202000,0x30003000,0xf5d2ab8a,0xed8ffdf1,0xedf2edd1,0x72679baa,0x41446206,0x08400800,0x00200020,0x08000840,0x08000800,0x10001000,0x08001000,0x08200820,0x31210800,0x41a49c2d,0x10820000,
-0x10400020,0x9b281800,0xfdd2f570,0x1800bc2d,0x08410800,0x20600800,0xe56fa3cb,0xe54eed6f,0xedf1edaf,0x5a25c52f,0x08410800,0x000008a2,0xedd16a66,0xfd6ff56f,0xbbeaf570,0xb38a9ae7,0xf5b2dcce,0x40e1dd31,0x08600000,0x9c6d0000,0xedf1ee53,0xed6eedaf,0xf54ef52d,0xdd70f5d0,0x08007b29,0x10401040,0xddb41000,0xa36af5f4,0x18005962,0x00001061,0x00200861,0xddf35a46,
-0x6a85e633,0x18a20800,0x10200840,0x18000800,0x10001800,0x00001041,0x00000040,0x00000020,0x10001021,0x28402040,0xabcb1800,0xf5b1f590,0x18008ae9,0x30813061,0x10202040,0x08010800,0x08200000,0x00000000,0x20811020,0x182030a1,0x08001000,0x08210000,0x18001861,0xe5917a85,0x28a0c4f0,0x10600800,0x30e20800,0xd4ae9309,0x69e4e571,0x08610800,0x080010a1,0xedb18308,
-0xfd2ef56f,0xf50cf50d,0xfd8ff4ec,0x10009baa,0x08a10880,0x72890800,0x8204d48f,0x30e240c0,0x00201040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400860,0xc4af2000,0xd4eef5d1,0x080038e0,0x080020c1,0x08000800,0x8a861800,0xed2fdccd,0x40e09b28,0x08000800,0x08400840,
-0x28600820,0xcc2b4040,0xe4abeccc,0xbc4be50c,0x08410800,0x10410000,0x00200020,0x00000840,0x28202060,0x82a761a4,0x7a678267,0x5a0572a7,0x08201020,0x00410040,0x49c60000,0xb3cc9b8c,0xd44dc3ec,0xf5b1ed50,0xedaff5af,0xf5f1f5f0,0xe5d2fe74,0x8b6cee15,0x10610800,0x08600060,0x10400000,0xa40d9c0d,0x93699349,0x392372a7,0x08410800,0x00001060,0x08200000,0x00000820,
-0x08000880,0xdd0f61e3,0xed4ee4cd,0x4101ccae,0x10620800,0x08000801,0x72861000,0xe5d2c4ee,0x7ae7c4ef,0x08001000,0x00200840,0x00000881,0xf5d17ae7,0xf52df52d,0xf56ff56f,0xfd6ffd90,0xed6ff56e,0x5182e550,0x10810800,0x08000000,0xcd7072c7,0xedd1ee32,0xe56fed90,0x51c3b46c,0x10610800,0x08000840,0xd5514142,0xf590f5b1,0x7a66e550,0x10810800,0x10810000,0x8b8b1000,
-0x08008beb,0x10611060,0x18200800,0x48c05163,0x30805142,0x08201000,0x00610000,0x08200000,0x20201020,0x38603080,0xed6f92e7,0xf52df50c,0x8266f5b2,0x48a04000,0x410248e1,0x08201000,0x08200820,0x10200020,0x40c11000,0x69a45942,0x41035963,0x00002082,0x10400820,0x8b4a1800,0x08007b09,0x10201860,0x9bab1000,0xf52ef590,0x7a65f590,0x08810800,0x10800020,0x62040800,
-0xfdd1dd50,0xf58ffdf1,0xd4cef5b0,0x080051a3,0x08400880,0x82e90800,0xf570fdb1,0x1800a3ab,0x00201040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10200020,0xd4ef1800,0xfdd0fdb0,0x6203d4ed,0x10411000,0x10621083,0x08000800,0x6a674963,0x08200800,0x08201060,0x10200820,
-0x48803880,0xdccc6140,0xed4ded4e,0xed4fecec,0x10007ac8,0x00002062,0x00210862,0x20610000,0x59422800,0xf5d1d4ef,0xed91ed50,0xf634e570,0x08008b4a,0x084118a2,0x30c20800,0xf5f2dd72,0xf5b1f5b1,0xed6ff590,0xf5d0f5b0,0xf5f0fe31,0xf653edd0,0x49a4ddf3,0x08610800,0x10610000,0x93cc0800,0xedd2f655,0xedb0edb0,0xb4afe5f2,0x08001000,0x00400000,0x002010a1,0x08200020,
-0x10000000,0xed90bc6d,0xedafed4e,0x7b07e5d1,0x08410000,0x08410841,0x08001061,0x7b094183,0x08003922,0x10610800,0x10410000,0x08001060,0xe5909bcb,0xfd6efdaf,0xf5afed6e,0xed4ded4d,0xf5d0ed6e,0x6a25edd2,0x18620800,0x18810800,0x18600800,0xde1493ec,0x72c7c530,0x00000800,0x00011062,0x08001082,0xedf16245,0xf56df5cf,0xdd2fed6e,0x08004962,0x00001061,0x08001860,
-0x08600820,0x08000840,0xb44e2040,0xdccedd0f,0xc46edcae,0x08006a27,0x00200841,0x00000041,0xbccf5a67,0xbbebb40c,0xecccdcad,0xe4caecca,0xf570f56e,0xbb48c389,0xa3aaab27,0x08007288,0x08201040,0x08000020,0xbb689b08,0xbb27bb68,0x79e4aae6,0x10003081,0x08600820,0x08000000,0x08000800,0x08001081,0xd54f51a2,0xfd6eed2d,0x8266f5b1,0x10a21000,0x00400000,0x08001080,
-0xb4af3942,0xcd30ddb2,0x28809bcb,0x10810800,0x20c30000,0x93281000,0xf5d0fe10,0x1000bcad,0x00201040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18400840,0xbc4c2000,0xececfd6f,0xccccf56e,0x10007aa6,0x00210000,0x10600861,0x00000000,0x00600060,0x00000020,0x38a02040,
-0x9a8558e0,0xfdcfe4cc,0xfd8ffd8e,0xfd90fd4d,0x2860cd0f,0x10420800,0x00400000,0x20400840,0xcc6d3840,0xfdd0fe12,0xf58ffdf0,0xf5f2fdf1,0x38e0dd71,0x10410800,0x10001862,0xedf28b49,0xed8ff5f0,0xfe52f5d0,0xd52ffe32,0xbcacc4cd,0xac4bb44b,0x08008baa,0x00000840,0x00000822,0xa42e20c2,0xccefc4f0,0xd52fccee,0xc552d591,0x00005228,0x00201082,0x00200020,0x10820000,
-0x7b4a0000,0xedf2f675,0xe5f1edd1,0xb4efe632,0x00211881,0x00210021,0x10810021,0x08000000,0x18820800,0x00000841,0x08200820,0x18600000,0xe5f3b4f0,0xe5b0dd70,0xddb1e5f2,0xedf1e590,0xee33ee11,0x8309ee34,0x18621000,0x08010001,0x00001882,0x31630000,0x080020a0,0x10620860,0x00010001,0x08001082,0xe6127b4a,0xedcfe58f,0xe5d2e58f,0x0800834a,0x08201041,0x10600000,
-0x00000861,0x00001082,0xf6757b2a,0xfdf2edd1,0xf5f4fdf3,0x28c2c512,0x00400000,0x00000861,0xd5b33942,0xf5b2f634,0xf58ff590,0xfdeffdaf,0xed4ef5af,0xfd4ff4ed,0xfe33fd90,0x0800830a,0x10811861,0x5a050000,0xf4cce52f,0xf4edfced,0xe4cef50d,0x180071e5,0x00200820,0x08210841,0x08400841,0x08000861,0xe56f9baa,0xed0ded2d,0xa349f591,0x28e21800,0x00001081,0x10810000,
-0x08000000,0x31015225,0x08000800,0x08200840,0x080018a2,0xd4ee5182,0xed8ee52c,0x0800bcce,0x00200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x10400020,0xbc4c2000,0xfd2cf56e,0xed0df54d,0xabebf5b1,0x080038e2,0x08001061,0x10611040,0x00200040,0x10200041,0x71832000,
-0xfd4fd3eb,0xf50cfd2d,0xfd0cfceb,0xf54ffd0d,0x9389f5d1,0x18821000,0x08200000,0x18001060,0xfd90a349,0xfdcfed4e,0xed2df56e,0xe54ef54e,0x93a9f5f1,0x18611000,0x08001021,0xd5702880,0xfdcffe10,0xf5f1ed8e,0x1800ac0b,0x08000800,0x08000800,0x08200820,0x00000000,0x00000000,0x08200840,0x08000800,0x08000800,0x00000800,0x00210841,0x00200020,0x00000020,0x08200800,
-0x31a40000,0x5a246b08,0x83aa6265,0x20c15a66,0x082118a2,0x00210001,0x08200021,0x18801040,0x00001040,0x00200000,0x00000820,0x08610020,0x10602103,0x08200800,0x08400840,0x312218a0,0x29412921,0x20a03121,0x00000820,0x00010001,0x10610000,0x08001081,0x10400800,0x00010841,0x00000021,0x00000040,0x39632943,0x6a875205,0x49c66247,0x080049e7,0x00000000,0x00000840,
-0x08400020,0x00000040,0x73095a67,0x61e359c3,0x7ac87286,0x314472ea,0x00200820,0x10600000,0x41c40800,0xa44e93ec,0xa3eca40d,0x9baaa3ec,0xf612e5b0,0xf5b1e54e,0xd531fe54,0x08001000,0x18601040,0x9baa1000,0xfd6ff591,0xfdd0fd6e,0xfe54fe12,0x3060dcf0,0x00211040,0x08000800,0x10620800,0x41830000,0xfe11e5d1,0xfdd1f590,0xf5d2f5b2,0x40a0a349,0x208130a0,0x00000820,
-0x10800840,0x00000000,0x084010a1,0x10400820,0x61e50800,0xf590e570,0xfdb0ed2e,0x1800d510,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000021,0x18810021,0xb40b1000,0xfd2dfd6f,0xfd6fecec,0xedf2f5af,0x0800ac6f,0x08000820,0x08200000,0x00600040,0x08000841,0xdcd18aca,
-0xec8bf52f,0xfcebecab,0xfcecfccb,0xed0efd4e,0xd56ff5d0,0x00006267,0x08401060,0x39220000,0xf54fdd0f,0xed4df56e,0xf56ef58e,0xed6efdaf,0xd56ff5d0,0x08006246,0x10401061,0xc4ef1000,0xf5cef5f0,0xf5f1f5cf,0x080082e7,0x108118c2,0x08610861,0x08400840,0x00000020,0x00000000,0x00400020,0x08400840,0x08200840,0x00210020,0x00000021,0x00200000,0x00000020,0x00000000,
-0x00000841,0x00000000,0x00000000,0x00200000,0x08000820,0x00210000,0x00000020,0x08000800,0x00000000,0x00000000,0x00000020,0x00210020,0x00000000,0x00000000,0x00000021,0x00000000,0x00200020,0x00000000,0x00010000,0x00210021,0x00000000,0x08400820,0x08000840,0x00010000,0x00200020,0x00000020,0x00000861,0x00000000,0x00000000,0x00000821,0x00200000,0x00400000,
-0x00000020,0x08400860,0x08000000,0x08000800,0x08001000,0x08000800,0x00200000,0x08200000,0x00001060,0x08000000,0x08000800,0x10000800,0xf6329baa,0xed90e590,0x7a45fdf2,0x18a31000,0x08001081,0xe5d36266,0xfdb1e550,0xfdaffd8f,0xf5d2fe12,0x8ac8fdd2,0x10820800,0x08410800,0x10610821,0x8bcc0820,0xfdd0f612,0xf590fdf1,0xf5b1f570,0xcc6cfdf1,0x180061c3,0x10401000,
-0x00000820,0x08810881,0x00400000,0x08001061,0xddb38bcd,0xf56ef5d1,0xfdf2f52e,0x2020cccf,0x08411020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00410000,0x08400020,0xbc4d1800,0xf50cf54f,0xf56ff50d,0xac6cd54e,0x080049e5,0x10211041,0x00000841,0x08400040,0x08000841,0xbc4e59e6,
-0xf54edcee,0xfd2df50c,0xecccf4cb,0xf58ffd6f,0xf632ed8e,0x08007b09,0x00201081,0x08000841,0xfdb0ccae,0xed2ded2d,0xf54dfd8e,0xf5affdd0,0xee31e56d,0x08009c4d,0x18801081,0xa3ab1000,0xf5affe11,0xfe53f5af,0x08008329,0x00001061,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x08200820,0x00000020,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,
-0x10210000,0x10411041,0x10811060,0x00201081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000001,0x08410021,0x00200040,0x08200020,0x08200840,0x08610840,0x08200840,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400820,0x10810841,0x08611081,0x00200020,0x00000000,0x00200000,
-0x00410020,0x08200000,0x18810840,0x10601040,0x08601080,0x08200860,0x00000000,0x08000000,0x08600000,0x104010a1,0x18821020,0x080018c3,0xedf08328,0xf58fed6f,0x6161e52f,0x10411800,0x00001081,0xcd3151e5,0xf5b0edf2,0xfdd0ed6f,0xed2efdb0,0xdd2ffdb0,0x08004922,0x00001041,0x08200841,0xb4ef0800,0xf58fedd0,0xfd8ffd8f,0xfd8ffdb0,0xfdb0fd8f,0x7287dd2f,0x00001840,
-0x08600820,0x00400020,0x08200840,0x00000841,0xe613acb0,0xed6ef612,0xf56ff54e,0x1000bc8d,0x08411040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10400020,0xbc6d1000,0xe4abfd8f,0xd4cded2e,0x08006a85,0x10400000,0x18200800,0x20c21820,0x10401060,0x18401040,0x10000800,
-0xe54e8b28,0xf50cf58f,0xfd4df52d,0xf5aff54d,0xb46cedd0,0x10400800,0x00000840,0x08001082,0xf5d17265,0xfd8ffdb0,0xfdcffdf0,0xf5d0f58f,0xd5b0f611,0x000049e4,0x08000840,0xc4af2000,0xfdf1fe12,0xfe33fdb0,0x0800834a,0x00201081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x08010001,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000001,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000020,0x00000000,0x00000000,0x00200000,0x00200000,0x00000020,0x00000000,0x00000000,
-0x00210000,0x00000000,0x00000800,0x00200000,0x00200000,0x00000020,0x00000000,0x00000000,0x00000000,0x08400000,0x08000800,0x08001062,0xfe938b48,0xfdd0f5cf,0xbc4cfdf1,0x08002860,0x10a10820,0x6aa80800,0xfe32f654,0xfdd0fe12,0xfd8ffdb0,0xfe12f56f,0x51e6cd51,0x08610800,0x18a10020,0x7b080800,0xfdcff612,0xfdaff58e,0xfdd0f58f,0xf5d0ed2d,0xcd72fe75,0x08203102,
-0x10201040,0x08000800,0x10400800,0x10810000,0x72e80800,0xf5f1c4ef,0xfdd0fdcf,0x1000bc6d,0x08411040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x18810020,0xa3aa1000,0xed0ded2e,0x4920dcee,0x10801000,0x10401061,0x40a12000,0x59435943,0x18002840,0x10201000,0x08401081,
-0x51a30800,0xed4dd4ee,0xf54cfd6d,0xed8ee50b,0x5a05dd70,0x10810800,0x08200000,0x10201061,0xbcae1000,0xed6ff5f2,0xed4ef5af,0xedb0f5b0,0x9bcaf633,0x10600800,0x080010a1,0xedf37ae8,0xf5b0edb1,0xf612fdb0,0x00007b29,0x000010a1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010001,
-0x00000000,0x00000000,0x00010000,0x00000001,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x00010000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x08001882,0xf5f182e7,0xfe10f5d0,0xfe74f5d0,0x1000830a,0x082018a1,0x08000860,0xfe74c50f,0xfdf1f5b1,0xf5f1f5b1,0xf633fe31,0x49a4ddb3,0x10600800,0x00200020,0x08000000,0xf610cd2f,0xfdf0ed6d,0xfe12fe11,0xee13f612,0x39849c2c,0x10201060,
-0x18001800,0x51243881,0x10005965,0x00400800,0x08001061,0x938a1800,0xfe10e58e,0x5163dd30,0x08610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18610000,0x9b6a1000,0xf54ee4ed,0x1800ccad,0x08611060,0x20600800,0x718350e2,0x9aa77141,0xa3accc8e,0x10004122,0x10610000,
-0x10001081,0xed6f8ae7,0xf52cfd8e,0xf5f0f56d,0x0800b46e,0x08411061,0x10001020,0x18600800,0x62670800,0xe5d2ddd3,0xf612edd1,0xf633edb1,0x2060c4ef,0x08600000,0x10400000,0xf674c551,0xf612edf2,0xfe53fe32,0x08007b4a,0x00001081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000020,0x00000000,0x00010000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000800,0x00000000,0x00000000,0x00010000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000800,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x08001061,0xedf182e8,0xedcfedb0,0xf612edaf,0x1000c4f1,0x08400800,0x000010a2,0xe6346ac7,0xf633fe94,0xf674f633,0xe5f2f653,0x0800834a,0x18801860,0x10411020,0x00000861,0xe5f15a04,0xf5aff5f0,0xedd2f5f1,0x5a04e5d2,0x00000800,0x10001040,
-0x71e52000,0x61229ae9,0x82478a47,0x08004963,0x18811020,0x10000800,0xedcfa3e8,0x7226ed91,0x08610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18810820,0xa3cb1000,0xed2ef5b0,0x38c0ccae,0x08600000,0x51631840,0xaa657962,0xf52ecb88,0xfe33fdb1,0x8b49e591,0x08002880,
-0x08001081,0xed705962,0xf54dfd6e,0xe58ffdcf,0x10005183,0x10411061,0x49642040,0x08202081,0x08001020,0x5a254184,0x7ae86266,0x7b0872c7,0x00004183,0x08611081,0x49e60000,0xcd71bd11,0xc550bd30,0xf653edf1,0x000072e8,0x00000861,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000020,0x00010000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00200000,0x00200000,0x080010a2,0xee1472a8,0xfe73f633,0xee33f672,0x5a27e5f4,0x10820000,0x10610821,0xa4cf0000,0xb4cfc592,0x9c6d9c4d,0x73089c2b,0x10410800,0x00001060,0x18411000,0x18c20820,0xa46d0000,0xf5affeb4,0xf612f5b0,0x10007266,0x18a120c1,0x61e40800,
-0xe4cebbeb,0xdcceed70,0xb2c7b2a6,0x69a3a2a6,0x08201000,0x080018a2,0xf6518b87,0x61c4e550,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x10600000,0xac2d0800,0xf5b1f5f2,0x2880cd10,0x10600000,0x72051000,0xf4adcbab,0xfd2dfd6f,0xf5aff52d,0xedf2fdf1,0x080093cb,
-0x000010a1,0xd4ef4902,0xf5aff570,0x8b48dd4e,0x18401000,0x10001041,0xcd114922,0x0800ac6f,0x08201882,0x00000800,0x08000800,0x08000800,0x10810000,0x08400000,0x18600000,0x28c028a0,0x080018a0,0xddf372a5,0x08207309,0x000010a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x00000000,0x00200000,0x00000000,0x00001081,0xee5572e8,0xddb1ee34,0x72a693a9,0x30e251c4,0x08210000,0x08200800,0x10c00020,0x08000820,0x00000820,0x08000820,0x18620820,0x8bcd0800,0x18007aaa,0x00601081,0x39c40000,0xf633bcef,0xdd70fe32,0x08004963,0x08001861,0xccee5a04,
-0xfd6ff590,0xfe32f5b0,0xec4cfdd2,0x8204a244,0x08002880,0x08001041,0xee117b06,0x6a05e591,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08810000,0x52050800,0xe5f3b46e,0x0800b4ef,0x18610000,0x92a81800,0xf52ff551,0xed2deced,0xf52dfd4d,0xf612fdd0,0x0800ac8d,
-0x000008a1,0xd5512020,0xb42bdd50,0x080051c3,0x08010800,0x18001842,0xfe33abab,0x6267e614,0x20c30800,0x18821041,0x108118a2,0x108010a0,0x00000860,0x08400860,0x08001040,0x08000800,0x08200000,0x52270800,0x000041e7,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00200000,0x00000000,0x00000000,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00200000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08001081,0xe6766aa8,0x4183d5d4,0x08000800,0x10200800,0x10201840,0x08400800,0x00200040,0x10600000,0x106018a1,0x18601880,0x08001881,0xee556aa7,0x3020ccb0,0x00401081,0x00200060,0x93ab1840,0xe613ddf2,0x080030c2,0x08001882,0xee328369,
-0xf590ed90,0xfe32fe32,0xfdd2fe33,0xa389fdb1,0x08610800,0x08001062,0xf6539389,0x7267edd3,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x00000000,0x08001061,0x5a261000,0x082062c8,0x18410000,0x9b091800,0xf590fe13,0xfdd0fdd0,0xfdd0fdaf,0xf5f2fe11,0x0800ac6d,
-0x00001080,0x93ed1020,0x10006a86,0x10810800,0x08210821,0x20200800,0xf5d1edd2,0xd572f634,0x10001800,0x10001000,0x08200800,0x00000840,0x08000800,0x20600800,0x38e230a1,0x206030a1,0x10611881,0x08211061,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x08000820,0x00000820,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000001,0x00000040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00200000,0x00000000,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000841,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000020,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001081,0xd656734b,0x08005226,0x102020c1,0x10001000,0x18001800,0x08001000,0x00400020,0x08000860,0x28a11840,0x30803081,0x49222820,0xf613dd91,0x9309f5d3,0x08810800,0x08800040,0x08000000,0x8bec49e4,0x00001840,0x08001882,0xe5f17b07,
-0xfe32edd1,0xfe53fe32,0xf5f2f612,0xa3cbfe12,0x10810800,0x08001082,0xf675834a,0x59e5e5f4,0x10610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010821,0x10610000,0x00001881,0x00000000,0x18610841,0x93291000,0xfe32fe33,0xfe31fe32,0xfe11fe31,0xfe53fe11,0x0800b4ae,
-0x08401060,0x08200840,0x18800000,0x00201080,0x08000820,0x10001041,0xedb1b46d,0xf5d2e550,0x7a65bc6d,0x72658aa6,0x41636a66,0x10200000,0x40c22020,0x79846964,0x60e07143,0x594258c0,0x08001800,0x08410820,0x00201061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00210001,0x00200021,0x00000000,0x08000800,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00210021,0x08001042,0x00000860,0x00000000,0x00000041,0x00000000,0x00000020,0x00000020,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000800,0x08420001,0x00000000,0x00200000,0x00000020,0x08000000,0x00200000,
-0x00000000,0x00200820,0x00410000,0x00210842,0x00010801,0x00000021,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000841,0x6b2b5aa9,0x20810000,0x30801820,0x81e57a26,0x81e48a25,0x308269a5,0x08410800,0x10000800,0x58e03880,0x89e46921,0xed309aa7,0xfe13fe34,0xa44efe96,0x18a20800,0x00000820,0x20a21041,0x00000000,0x08400840,0x00001082,0xee328388,
-0xfe53fe53,0xf612fe53,0xee33f653,0x9bcaf653,0x10611000,0x00000881,0x944e41c5,0x080049c5,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08010800,0x00001001,0x10811081,0x00001060,0x10610000,0x82e81000,0xe4ede550,0xe4eded2e,0xed2eed4e,0xf612ed4e,0x0800a42d,
-0x08001860,0x08810000,0x18801080,0x10201020,0x10410800,0x08001081,0xe5916225,0xfdd1f5b1,0xfdd1fdd1,0xfe12fdf2,0x72a8f634,0x20810800,0x61443061,0xd3ec89c5,0xd42ddc2d,0xdccfcc0b,0x1000936b,0x10201861,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18001000,0x08000800,0x08200800,0x08000840,0x08000800,0x00010001,0x08410000,
-0x10400840,0x08000800,0x00010801,0x08200800,0x08000000,0x00010801,0x08000821,0x00200820,0x00000820,0x00400020,0x08200020,0x00000020,0x10000800,0x08400000,0x00000820,0x00200020,0x00000820,0x00200020,0x08400840,0x00000841,0x00000000,0x00000000,0x08000000,0x10400800,0x00200020,0x08000800,0x08000800,0x08200800,0x00200041,0x08210000,0x08201040,0x00000001,
-0x00210001,0x00000000,0x08000000,0x10000800,0x08001000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000020,0x00200020,0x00000000,0x10001040,0x72051800,0xb2e7a2c8,0xc389c348,0x40609a86,0x08002020,0x31020000,0xcbeba36a,0xe40bcb69,0xfd4ff4cd,0xf5d2fd91,0x49a4ddd3,0x18610800,0x20201000,0x08001800,0x08411882,0x00400020,0x08001081,0xfeb48ba9,
-0xed90edf1,0xfdb0fdd0,0xf611fe11,0xa3aafe33,0x18a20800,0x08800020,0x00000000,0x08200000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x10000800,0x10202081,0x08001020,0x00001060,0x08620000,0x41840000,0xe4cdbc4d,0xe3e9ec6b,0xecacec4a,0xbc4ce4ed,0x00005a47,
-0x10201040,0x18610000,0x30602060,0x71e448c0,0x100038c1,0x18810800,0xac2d1000,0xe46bed2e,0xf4cdec6b,0xfdb1fdb0,0x1000c4d0,0x18201041,0x50a04081,0xfe75bbcc,0xfeb5f5f3,0xfe74fe94,0x72a7f654,0x18611000,0x08410000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000000,0x59432860,0x8a0479e4,0x698379c4,0x180048e1,0x10410800,0x08210000,0x00000841,0x08000820,
-0x18201000,0x08001820,0x08010801,0x18201020,0x18612061,0x08010821,0x10000800,0x10201820,0x00200000,0x00000041,0x08200020,0x39020800,0x59435123,0x080030a0,0x08210840,0x08200800,0x08000800,0x08200000,0x00000800,0x00200000,0x00200020,0x08200020,0x28a01840,0x08002880,0x00410021,0x20810800,0x284030a2,0x10002000,0x00000800,0x10000800,0x08000800,0x08210801,
-0x00000001,0x08000020,0x51632060,0x7a057a26,0x41225963,0x20a128c1,0x08002081,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x10820021,0x10001060,0xdcef9329,0xcb48d3eb,0xf4cddbc9,0x7a03e4cd,0x08003081,0x08001041,0xfdd1c4cf,0xe44aecac,0xed0df4ed,0xdd0fdcac,0x080072c8,0x080018a1,0x7a065963,0x51227a06,0x10401000,0x00000840,0x08001081,0xccce59e4,
-0xf54ef5d0,0xf48aec8a,0xd387dba7,0x8a66cbca,0x10611000,0x00000020,0x18a21040,0x00001061,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200820,0x8b8b1000,0x496193ca,0x08200800,0x00010841,0x08000841,0x8a863080,0xec6ccba9,0xbb88e42b,0x28608a85,0x08400800,
-0x08000000,0x10001041,0x79e33880,0xd44da2c6,0x3060bc2c,0x18611000,0x59c40800,0xf4cce50e,0xf46bfcac,0xd48ce44a,0x08006246,0x18201041,0x82252800,0xf612f5b2,0xf673fe73,0xedd1edd1,0xe613f632,0x080038e1,0x00000842,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x61832840,0x9a439a65,0x9a649a23,0x72669ae7,0x08003103,0x08410840,0x08410862,0x39440000,
-0x306038c2,0x08002040,0x10201021,0x28402060,0x10002000,0x08000800,0x20611000,0x286038a1,0x004018c1,0x00210041,0x00000020,0x6a053101,0x8aa892e9,0x28a06a46,0x10410800,0x18401040,0x10000800,0x49a53124,0x30c04963,0x002020a1,0x08400020,0x00000000,0x51a44984,0x412359c5,0x00000000,0x51842060,0x7a2569e5,0x49427a46,0x08001020,0x498428c2,0x498559e6,0x00001882,
-0x00000821,0x08000020,0x7a255183,0xab07a2c7,0x69a28a65,0x30c04921,0x080028c2,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x08410021,0x51a30800,0xfdd1e571,0xfd6ffd6f,0xec6af46b,0xbbc8fd2d,0x182040c0,0x08001861,0xc42b7266,0xfd8fd42a,0xf56efd8f,0xcceff5d1,0x10600800,0x10001040,0xcbebc42d,0x8a458a04,0x204069e4,0x08400820,0x10200000,0x40e01000,
-0xe52d9b47,0xfcececcc,0xf48cf44a,0x82a8f551,0x10820800,0x08000020,0x10000800,0x20811000,0x08200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10400020,0xb44d1000,0xdd0fed50,0x080082e9,0x00000801,0x10410001,0x18000800,0x82c740e0,0x20006a04,0x08001000,0x00001081,
-0x08000840,0x49020800,0xdc0aab08,0xfd4ff4ed,0x9b28f54f,0x10620800,0x100018a2,0xf50d9ae7,0xec6bec8b,0xbba9f4ec,0x00001000,0x18401061,0xe5504900,0xf5f1fe32,0xe5cff610,0xf612f632,0xfeb5f632,0x1860c552,0x00410020,0x00000020,0x00000000,0x00000000,0x00000000,0x10200000,0x6a261000,0xe4edcc8c,0xcc2bdc8c,0xac4dccae,0x00003964,0x000018a1,0x18820000,0x51e60000,
-0xbcd0a40d,0x18a19c0e,0x39640000,0xa3aa93ab,0x8b4aa3aa,0x08004184,0x6aa90800,0x830aa3ed,0x00003144,0x10620841,0x08001061,0x72264963,0x7a0579e4,0x39026a26,0x08000800,0x08001000,0x08001060,0x8ae959e6,0x826692a7,0x080051a5,0x08610820,0x08000861,0x61a34142,0x51426983,0x08001020,0x51202860,0x71616982,0x61826941,0x00002060,0x38a02060,0x598548c1,0x00201060,
-0x10611061,0x08000820,0x618259c4,0x79815080,0x716181e2,0x40c06982,0x00000820,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x10600040,0xb42c1800,0xf52dfdd1,0xf4ccfd4d,0xfcedfd0d,0xd3c9ec2a,0x384079a2,0x10400800,0x8b291000,0xb2e6c3eb,0x8a029a43,0x38e18265,0x18a10000,0x82a71000,0xe44ad42b,0xbba8eccd,0x6141a2c5,0x10201800,0x00000840,0x10001041,
-0x6a431000,0xf591d4ef,0xe50ffd70,0x20609b6b,0x00200800,0x08200000,0x59422820,0x30815984,0x08410820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10600020,0x9b081800,0xdc4bec8c,0x1000b3ec,0x08411020,0x10820000,0x10401061,0x08000800,0x08000800,0x08201081,0x00000840,
-0x18610000,0x82881000,0xf46bec8d,0xd3c8f4cc,0xdcced3e9,0x080038e1,0x08001061,0xe4ee5982,0xfcecfd2e,0xb388fcec,0x10821000,0x08000861,0xfed5ac0b,0xfe52fe94,0xfe52fe92,0xfe53fe73,0xfe95f5f1,0x4a06ee97,0x08820000,0x00000000,0x00000000,0x00000000,0x00000000,0x18610020,0x9bcc1000,0xfe93fed5,0xfef7feb5,0x8b6af654,0x10600800,0x5a670800,0x08005a68,0x20a11860,
-0xb4b09bcc,0x18a1942f,0x41a40000,0xbcaeac6e,0xb4cfc50f,0x00005a47,0x7b4c0000,0x7ac8b48f,0x10400800,0x10000800,0x20600800,0xb42e1800,0xf5f3fdf4,0x1000ac0e,0x20801840,0x626772c8,0x08000800,0xdd737288,0xdd31e551,0x08005a06,0x080020a1,0x00000000,0xbc8f3943,0xcd31e572,0x080049c6,0xd5306226,0xdd0fd510,0xbc8fdd30,0x00003964,0xc5325a27,0x936cd512,0x10800800,
-0x08000800,0x08001881,0x9b6a38e1,0xab07ab69,0xc3ebbb89,0x7aa7c44c,0x00410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000840,0xdd504963,0xf4ecfd8f,0xecabecab,0xfceddc09,0xfd2eec2a,0x3000cbea,0x10611820,0x6a260800,0xdc6cdcae,0xed50dc6b,0x08007ac8,0x000018e2,0xed706a46,0xfd4dfd4e,0xfdaffdaf,0xb368fd2e,0x08201800,0x00200820,0x08410021,
-0x10001060,0xa3cc30a0,0x20009b49,0x00000800,0x08400020,0x08000861,0xd4af82a7,0x38a0bc2d,0x08200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x10400020,0xbbcb1800,0xf44cf44c,0x1800bbeb,0x10211020,0x08000800,0x10400800,0x10801081,0x10611061,0x00000840,0x08400000,
-0x18600000,0x71c51000,0xcae5cb69,0xd3a9c306,0xfd70ec6b,0x1000a3ab,0x10411861,0x9b691000,0xec69dc49,0xe48dfcab,0x08004102,0x08001060,0xe5b1ac6d,0xf633f654,0xf5f0f611,0xfe52f631,0xf674ee11,0x0000b511,0x00400860,0x00000000,0x00000000,0x00000000,0x00000000,0x18810000,0x9bec0800,0xfe53feb4,0xfeb6fe54,0x1000b4af,0x08001881,0xe6556266,0x72eae657,0x18800800,
-0x08000800,0x00000000,0x00000020,0x10200000,0x08001040,0x00200840,0x00000861,0x08000800,0x18001820,0xc4d0932a,0x100059c3,0x30e20800,0xfe95e5f3,0x10006205,0x82e72840,0xddb2f634,0x10002880,0x49a530e1,0x41a549c5,0x08001881,0x72871800,0x00003123,0x5a890820,0x836b836b,0x00003164,0x93ed41a5,0x93ed93ed,0x7b4b940d,0x000020e3,0x7b6c3985,0x522683ac,0x10001020,
-0x9bac7ac8,0x20a12060,0xbd110800,0xfe33fed6,0xfe33fe54,0xcd51fef6,0x08410800,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x08000840,0xe55161e5,0xfd6ff50e,0xfd0cfd0d,0xfd0cd3e8,0xfd2efcec,0x71c3f54f,0x20c11000,0x82e81000,0xf50efd91,0xc46dfdb0,0x10611000,0x10000860,0xfd2ec42c,0xfd2cfcec,0xfd6efd6e,0xe4f0fd4f,0x08201000,0x00000840,0x08410841,
-0x18810000,0x08000800,0x10001000,0x10801080,0x00400000,0x08000861,0xf5d18b07,0x5162dd2f,0x08610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400020,0xc40c1800,0xec2bfc8d,0x1800b3ca,0x08201000,0x5a270800,0x10006266,0x18810800,0x10001840,0x20601000,0x080028a0,
-0x18600820,0x7a461000,0xf46bec8d,0xfd0ef4ad,0xe48bfcec,0x38c0cc8d,0x10610800,0x49620800,0xd408d46b,0xdc8de42a,0x10007aa8,0x080018a1,0xddd36a86,0xfe74e5f3,0xfdf0f5d0,0xf610fe51,0xe612f672,0x08206287,0x00000881,0x00000040,0x00000000,0x00000000,0x00000000,0x18810000,0x93ab0800,0xf5d1e590,0xf696edf2,0x0800bd31,0x41840800,0xf695d5b3,0xe656f696,0x100072e9,
-0x08000800,0x08610000,0x00000861,0x08000000,0x00000800,0x00200800,0x00000000,0x10000800,0xa3ab2840,0xfe54fdf3,0x6246ee13,0x08000800,0xcd91b4ce,0x10001820,0xe5d16a24,0xfe33edd1,0x1800b42d,0x08001000,0x00000000,0x08000881,0xf6348b08,0x08009c0e,0x08001040,0x08000800,0x08200000,0x08001020,0x10000800,0x08000800,0x10400000,0x10000800,0x28a01000,0xabeb4100,
-0xfe97f614,0x1000832a,0x7b4a0800,0xfe74f695,0xfe74fe33,0xc531fe74,0x10401840,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x08200861,0xabcb1000,0xecace50f,0xeccce48b,0xeccbeccc,0xecede48b,0x61e4dcef,0x18400800,0xc4ae1800,0xe4ede50e,0x4921d4ce,0x10a20800,0x8b6b0000,0xe44ae530,0xe46bdc2a,0xdc8be4cc,0xcc6eecad,0x00610800,0x08200820,0x08000000,
-0x080028a2,0x18611020,0x18402060,0x00000800,0x00000860,0x080018a3,0xed6f9327,0x5982e56f,0x10610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200020,0xbbeb1800,0xecedf50e,0x0800bcae,0x10810860,0x938a0800,0xab68d4cd,0x20006a03,0x59032800,0xbbcb81c4,0x1000a3eb,
-0x10610800,0x72660800,0xe4abed2f,0xec8ae44a,0xe50bed0b,0xa3c9e54d,0x10a10800,0x08001061,0xf612a40b,0xfdf3fdb1,0x3902d552,0x10600800,0xbcf10800,0xfe13fe96,0xfe10fdf1,0xf611f5af,0xbceef672,0x08201000,0x00410021,0x00000000,0x00000000,0x00000000,0x00000000,0x18810820,0x940c0800,0xf612e5b1,0xf6b6fe74,0x0000c5d3,0x6ae90000,0xf694f6d6,0xfeb5ee53,0xb44cf675,
-0x9bcba3ea,0x08005a47,0x31030000,0x7ac8832a,0x59e67aa8,0x00002081,0x62891020,0x82c682e8,0xfe13bc6d,0xdd0dfe32,0xac8ffe74,0x00000000,0xd6349cce,0x10000800,0xfe538b49,0xfe12fe32,0x7a65f5f2,0x418359e4,0x210241c5,0x52260000,0xf653ee54,0x9bebee74,0x08001000,0x08000800,0x10001020,0x20001000,0x30003020,0x10002000,0x08001040,0x59423060,0x616169a2,0xfe53cc4b,
-0xfe75fe53,0x4942e5b3,0x49a41000,0xfe32ee13,0xf5f2f5f1,0xc52ffeb5,0x08600820,0x08000820,0x00000000,0x00000000,0x00000000,0x00000000,0x08610021,0x28800800,0xfe13d510,0xfdd0fdd0,0xfdf1fdd1,0xfe74f5d1,0x0800938b,0x080020e3,0xfe959bcc,0xfe53edd0,0x0800ac2d,0x000018e3,0xddd449a5,0xed90edb1,0xf5f2fe33,0xfdd0fdd1,0xc48ef590,0x00400800,0x10001060,0x620651c5,
-0x40a03020,0x18003060,0x38602800,0x72a77a66,0x08410800,0x10001041,0xed6f9b28,0x61a2e50f,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x9b892020,0xdd0edcec,0x0800a40c,0x10a10861,0x9b691000,0xecede4ed,0xa349e50f,0xdc6eab4a,0xf550e46d,0x28a0d530,
-0x18810800,0x62870800,0xfdf1edd2,0xf54ef54f,0xf630f5af,0xe612fe52,0x00004184,0x08001082,0xe6355205,0xee14f655,0x5a47ddd4,0x18a20000,0x49850800,0xcccfbc8f,0xccacc46c,0xbcaccced,0x5a03b4cd,0x10610800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x10810820,0x9c8e0000,0xc4cff676,0xa48eb48f,0x0000734a,0x41c60000,0xbcefc572,0xd591c50f,0xedf3ddb1,
-0xfed7f633,0x1840cd73,0x732b0800,0xf655f697,0xe615f635,0x08006288,0xc5532081,0xedb2fe96,0xcd0fedf3,0xbc4bccac,0x940cd5b2,0x00000820,0x9cf0842d,0x08000000,0xfe749349,0xf5d1f5d1,0xe5d2edb1,0xbd32ddd3,0x4a27bd73,0x52670000,0xe633de34,0xe654ee95,0xc572bd30,0x9c4fbd53,0x100028c2,0xbc6f59e5,0xcc2ec44e,0x8b4acc8f,0x10000800,0xe5307a87,0xf550ecef,0xfd90fd70,
-0xe550f590,0x6a26e5b2,0x39420800,0xfe74e613,0xf5f2fe74,0xb4aedd70,0x00400820,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x08410001,0x08001082,0xee75836a,0xfeb5fe74,0xf695fe94,0xddf4fed7,0x00003123,0x29230000,0xe613de15,0xc50fe5f2,0x08202080,0x00001082,0xff7abd73,0xfeb6feb6,0xf676feb7,0xedf2f634,0xe5f3fe74,0x00400800,0x080010a1,0xe593832a,
-0x6962ab6a,0x61826162,0xbbec7a05,0xb46eed92,0x10a20800,0x10001862,0xed9182a7,0x61c4dd0f,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18600020,0xa42c0800,0x9be9d590,0x08003101,0x10411061,0xb42d1000,0xe4ecf5b0,0xed8fed4e,0xf54fe50e,0xed6fed0d,0x3101d551,
-0x10610800,0x20e10000,0x934a72c8,0x8b298b29,0x83488328,0x73298b89,0x00003164,0x08200841,0x5a470800,0x41836aa8,0x10603102,0x00200020,0x08001042,0x08000800,0x18800800,0x08001880,0x08001000,0x08201020,0x00000840,0x00000020,0x00000000,0x00000000,0x00000000,0x08400000,0x630a0000,0x08006aca,0x00000800,0x08200820,0x00000021,0x08000800,0x28801840,0x412230c1,
-0xd5935142,0x1840d5b4,0x7b2a0800,0xf634fed7,0xf696fe54,0x08005a67,0xcdb41860,0x2840ac4e,0x186028a0,0x30c02040,0x10803963,0x08400000,0x08400020,0x080018a2,0xfe339b8a,0xf633f5f2,0x8b89ee53,0x52065205,0x188141a5,0x10610000,0x62a841e5,0x49e5730a,0x8bcc6ac8,0xce15a4d0,0x10004a06,0xe5b27ac7,0xfdd2e530,0xbcafedb2,0x08000800,0xfe73ac6d,0xfdb2fdb1,0xed2ff590,
-0xe4cdd42a,0x4962ccae,0x10400800,0x8b696287,0xbcf08b49,0xb4cfee55,0x08400820,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x08410821,0x08600020,0x840c0000,0xacaec592,0x942c9c6d,0x6aa9a48f,0x18c20800,0x5ac90000,0xac8ebd31,0x72e9cd72,0x18a20800,0x21230000,0xad3194af,0xc552bd31,0xc593b531,0xb50ec591,0xa4aec54f,0x00200000,0x080010e2,0xfe768b4a,
-0xe4eff5b2,0xcc0cbb69,0xfe35f593,0xa40df614,0x08610000,0x08001081,0xff1893ab,0x5183e5b3,0x10610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200020,0x7b6a0800,0x10008369,0x08400800,0x20201040,0xc44d2000,0xfdaffdd1,0xfdcffdcf,0xfdf0fdaf,0xf633fe32,0x08009c0d,
-0x08201020,0x00000020,0x10000800,0x08001000,0x08000800,0x00000000,0x08410800,0x00000820,0x00000860,0x08000800,0x00000820,0x00000020,0x00210000,0x00410000,0x00000020,0x10400000,0x18401840,0x08201041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00200840,0x18410000,0x08001000,0x10000800,0x00210021,0x10000800,0x18001800,0x10000800,
-0x8b8b1000,0x1800ac6e,0x52060800,0xfe75e614,0x9becfe76,0x08000800,0xde154162,0x1000834a,0x10001860,0x10001000,0x00000800,0x08200840,0x08000800,0x08001861,0xd55159c4,0xf695e613,0x080093eb,0x10001000,0x08200800,0x00000800,0x08000800,0x08000800,0x08000800,0xb5310800,0x10005a87,0xd53059e4,0xf5f2ed91,0xac6eedd2,0x08000800,0xfe11bcce,0xfd70fd70,0xfe33fe33,
-0xfdf1fdf1,0x7286fe74,0x10800820,0x10000800,0x49a40800,0xc552de35,0x08400000,0x00000840,0x00000000,0x00000000,0x00000000,0x08000821,0x08000800,0x08201061,0x00000020,0x08200000,0x00000000,0x08000800,0x08200820,0x08000820,0x08000800,0x08000800,0x00001061,0x00200840,0x00000020,0x08000000,0x08000800,0x08000800,0x08000800,0x08620020,0x00000861,0xd5726a88,
-0xfe33fe54,0xfdf3f570,0xfe14fe34,0xb48ffe75,0x08820800,0x08200881,0xde156ae8,0x5206ee76,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00001041,0x10410800,0x10610841,0x28001800,0xdc2b5060,0xfd2dfd4e,0xfd2dfd0c,0xf5d0fd6e,0x72e8d550,0x00000800,
-0x00000840,0x08610000,0x18601860,0x10611881,0x10601880,0x10611061,0x00001062,0x00200000,0x10a20000,0x18811881,0x08611061,0x08610861,0x00200840,0x00200840,0x10820861,0x10201041,0x10401020,0x10210800,0x080018a2,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x08000820,0x20002060,0xc48f8ae9,0x28409b6b,0x10200800,0x822661a4,0x590071a3,0x20a030c0,
-0xa42e0800,0x61c3fe96,0x10001000,0xb4d151c5,0x1000836b,0x10001860,0xfed7b46d,0x08007309,0x51832040,0x82258a66,0x28c27247,0x00000000,0x494230c1,0x10200800,0x49c40800,0x9c6ecdd3,0x10000800,0x72872880,0x18405a06,0x18001000,0x69c359a3,0x412159a2,0x20a12080,0xbd320800,0x08005a47,0x7b290800,0xf654e5d2,0x51e4d592,0x08000820,0xfdb0ccae,0xfd0dfd4e,0xfe53fdf2,
-0xfdf1fe11,0x6224fe12,0x10810800,0x10001000,0x080020a1,0x7b8c3984,0x00000800,0x00000020,0x00000000,0x00000000,0x00000000,0x08001041,0x62685a27,0x20a21000,0x10821062,0x106010a1,0x10801080,0x10411081,0x10411021,0x08000800,0x10401840,0x08410820,0x08000000,0x08000800,0x10820840,0x20c318a2,0x28e228e3,0x310428e4,0x186020c2,0x00000820,0x08400000,0x28e10000,
-0xddf29c2c,0xfe33feb5,0xf5f2f612,0xb44efe14,0x10a20800,0x00400040,0x39840000,0x41c683cd,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x08011042,0x08001041,0x9b292820,0xdc2ae4ee,0xc346c367,0xc3c8cbc8,0x8285ab27,0x080030a0,0x00400840,
-0x08200000,0x08000800,0x20002020,0x20602060,0x20402020,0x20402880,0x10201000,0x00200800,0x00000021,0x10001000,0x10000800,0x08000800,0x00000820,0x00200020,0x08000000,0x18001800,0x38e12860,0x834c2880,0x00005228,0x00001041,0x00000000,0x00000000,0x00000000,0x00000000,0x08000820,0x8ae91000,0xdccfcc6d,0x5143d4af,0x18600800,0xc3ca9b29,0xc40bc368,0x08008b6a,
-0x7ae90800,0xabcad4ee,0x08002020,0x18201000,0x10000800,0x62050800,0xc48dbc4c,0x080051e5,0xbc4f1800,0xdc8df571,0xa42ee592,0x00000000,0xedf3ac0d,0x1000b4af,0x00000000,0x20e03183,0x10000000,0xfef7b48f,0x5a06ee76,0x72881000,0xfe33edf3,0xf676edd2,0x08007b4b,0x9c0e1000,0x10009c0d,0x08000800,0x93cc6246,0x08004183,0x62670800,0xe48dd4ae,0xdc29e46b,0xe4eedc6c,
-0xd48bed0d,0x6a44d4cd,0x18820800,0x93ada44f,0x10401820,0x00000000,0x00000841,0x00000841,0x00000000,0x00000000,0x00000000,0x08001061,0xbd1272e9,0x18004923,0x08001000,0x08000800,0x00200820,0x10400820,0x28610800,0x51a459c5,0x182030a0,0x08420841,0x00000821,0x28401000,0x18002860,0x10000800,0x18001000,0x18001800,0x10001000,0x08001841,0x08200000,0x00000861,
-0x41c30000,0xf694b4ef,0xe5b0f653,0xa38bfe34,0x28c21000,0x00200820,0x00001080,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00210020,0x10200800,0x41221000,0xf5f2c4cf,0xfe12f5f1,0xf5d1fdf2,0x9b89dd2f,0x10004922,0x10411000,0x00000841,
-0x00200040,0x20201020,0x48a03860,0x50c04060,0x71637163,0x58e079a3,0x200048a0,0x08210800,0x08000021,0x79e34901,0x8a6579e3,0x61a392a6,0x08201000,0x08000800,0x6a881861,0xb38992e8,0xc42bbbea,0xd550c44b,0x000049a4,0x00001081,0x00000000,0x00000000,0x00000000,0x08200000,0x10400820,0xb48f0800,0xdc8ce4ee,0x7246ed91,0x20810800,0xf54fbc4d,0xfdb0fd4e,0x1000b46e,
-0x8b6b0800,0xed70e50e,0x0800b48f,0x10201020,0x08002082,0xddb272c8,0xc48cd4cd,0x080049c4,0xd5321800,0xfe12fe14,0xa48dee12,0x08000000,0xfe54c4ef,0xbd11fe75,0x002020e1,0x08400000,0x8bed0000,0xfeb6fed7,0x6a46ee75,0x938c1000,0xfe93f654,0xff39ee13,0x08009c2f,0xbd111000,0xbceff675,0x00001860,0x00000000,0x08000800,0xe5f4834a,0xed51ed92,0xfdb1f570,0xf58ff56f,
-0xf5d0fdd1,0x72a6f632,0x31240800,0xf634ee35,0x1800a3cc,0x10a20840,0x00410000,0x00000020,0x00000000,0x00000000,0x00000000,0x08001082,0xee7762a8,0x7a47e5b4,0x82678287,0x49007a25,0x08001840,0x08000841,0x7a872860,0x92a78a87,0x48e19287,0x08410800,0x08000840,0x9b086a26,0xa328ab69,0xa36a9b49,0x9ae79b28,0x92a79286,0x59448246,0x08002861,0x00010000,0x10610000,
-0x000018a1,0x6b090820,0xee74d613,0xe5d3f675,0x284082e8,0x186028c1,0x08410820,0x08410841,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00400000,0x00000020,0x08200861,0xac6e0800,0xfe73ee34,0xfe74ee12,0xbccff675,0x10005a03,0x20620800,0x10001821,0x08600800,
-0x08200020,0x61851000,0xd46dbbcc,0xdcaee4ee,0xcbebcbec,0xcc0acbca,0x934adcef,0x10410800,0x10000861,0xe4ce8a86,0xdc8cecee,0xe52fe4ac,0x10005183,0x00001061,0xbcf11020,0xfdf1ed71,0xed4efdaf,0xd52fd48b,0x08205a26,0x00200840,0x00000000,0x00000000,0x00000000,0x00000000,0x18810000,0x49430800,0xf56fdd0e,0x6204d4ed,0x08000800,0xed4fbc8e,0xf5b0e4ec,0x0800cd52,
-0x9c2d0800,0xf5b0fe53,0x6b0ae655,0x18820800,0x08000820,0xfef6d5d4,0xdd6ff5f1,0x10005a25,0xc4d11800,0xf652ee13,0xa48dee32,0x08000000,0xee33ac8d,0xee56f635,0x000041c5,0x18c120e2,0xa4d00820,0xe633f6f7,0x5a05f695,0x940d1000,0xddd0ee74,0xf6f7ee74,0x0800838d,0xc5710800,0xfeb6ee33,0x0000b4f2,0x18e410c3,0x730a0000,0xf675e635,0xfe75fe34,0xfe53fe33,0xfe52fe12,
-0xedb0f5f1,0x7286f633,0x41850800,0xf654ee55,0xb490fe97,0x08820800,0x00010021,0x00200020,0x00000000,0x00000000,0x00000000,0x00001082,0xf6b76ac9,0xf5f4fe76,0xfe14f5f4,0xd530fe14,0x000028e1,0x08001882,0xf634bcd0,0xf591f5b2,0xb42dfdd2,0x08211000,0x28e10000,0xfe54d552,0xfdd1fdf2,0xfe13fe13,0xed90fe33,0xfd91fdd1,0xccf1f5b2,0x10212020,0x00000821,0x08001040,
-0x18611000,0x00001081,0xbd313122,0xfef7f6b6,0xabecf655,0x10003080,0x00210820,0x00000821,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00200021,0x08400000,0x08400840,0x51e60000,0xe613a42d,0xb4eee613,0x080062c7,0x18600800,0x18401020,0x20202020,0x00001020,
-0x18610840,0x72271000,0xfdf1fdd3,0xfdf1fe73,0xf5d1f5f2,0xfe52ed8f,0xbcf0feb5,0x18a20800,0x08001081,0xf5d19b6a,0xfdd1f5b0,0xed2ffd90,0x0800b46d,0x10c20860,0x93cc0800,0xf5f1fe95,0xfeb4fe74,0xe5d2f5d1,0x00005226,0x00001081,0x00000000,0x00000000,0x00000000,0x00000000,0x08001040,0x10001000,0xc4ae61e4,0x59e2c4cd,0x08000800,0xd52e9beb,0xcd2fd52e,0x08007b29,
-0x83ac0000,0xe590dd90,0x3943b4ae,0x08000800,0x08001881,0xd5b36ac9,0xcd2fcd2e,0x08005a06,0x9bcc1800,0xd56fc4ad,0x93abddd1,0x08000800,0xff5ab511,0x49c6de36,0x08200800,0x08000800,0x10600840,0xff38acf1,0x5203e674,0x83ac0800,0xf736ff99,0xffdbef16,0x000083ee,0xcdd20800,0xee34f694,0x1000b4f1,0x08400000,0x52470000,0xf633ddf3,0xfe94fe33,0xf652fe73,0xf5f0f611,
-0xf5d1f5d0,0x7286f613,0x39850800,0xf695ddf4,0x93eef6d8,0x10810800,0x08410040,0x00000000,0x00000000,0x00000000,0x00000000,0x00001082,0xeeb66ae9,0xee13ee54,0xfeb7f654,0xac8ffeb7,0x10c20000,0x730a0800,0xfe95ff18,0xfe95fe96,0xd5d3fef6,0x18821000,0x31430000,0xfef8e677,0xfeb7fed7,0xfef7fe96,0xfed6feb5,0xfe95fe75,0xddf4fed6,0x08001840,0x08201040,0x20200800,
-0x18003040,0x18a21841,0x00000820,0xd5927b29,0xee14f655,0x72c9d572,0x08200000,0x08210000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08210000,0x00000841,0x10800000,0x08001061,0x72c71000,0x10007b29,0x08600000,0x20601040,0x38e130e1,0x72864900,0x18606aa7,
-0x18a20000,0x72061800,0xed6ff5d2,0xedf1e58f,0xedd1ee12,0xe56ffe32,0xb4aef5f1,0x08610800,0x08001081,0xfe53a3aa,0xfdb0f5b0,0xfdd1fdd0,0x6245edf2,0x10a20000,0x49e50000,0xfe94ddd3,0xf612fe53,0xedf3fe74,0x000049e5,0x00001061,0x00000000,0x00000000,0x00000000,0x08400020,0x730b0800,0x100049c6,0x938a1000,0x6a24ee33,0x20801000,0x494030c0,0x49a251a1,0x08201860,
-0x39840000,0x8b4782e7,0x10004100,0x49a41820,0x10001820,0x41630800,0x62256224,0x080028c1,0x49830800,0x51807284,0x280048e0,0x08002081,0xde76b552,0x08005a68,0x39630800,0x72c9b4d0,0x00000800,0xa4af0800,0x28e0d634,0x4a260000,0x9c8d9cae,0x9cd0946e,0x00004227,0x8c0c0000,0xbcf0d5f3,0x08004185,0x28a13102,0x10000800,0xd5915a04,0xcd50ddb2,0xb48cc50e,0xd570cd6f,
-0xe5b2dd91,0x6246e5f3,0x29430000,0xf6b7d614,0x080083ac,0x00000000,0x00200861,0x00000000,0x00000000,0x00000000,0x00000000,0x00001081,0xf6f76ac8,0xfeb5fef6,0xf6d7f6b6,0x3143e656,0x08200000,0xddd43943,0xfe95f6b5,0xfe96fe95,0xd5d3ff58,0x18621840,0x39840800,0xff39ee97,0xfef8fef8,0xfe96feb7,0xfe74fe54,0xfe95fe75,0xee75fef6,0x08201840,0x08001861,0xb44e6aa8,
-0x50e27a05,0x18401800,0x10801081,0x28800800,0xee769bec,0xb4d1fef9,0x08210800,0x08201041,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08010821,0x49c61020,0x080028c0,0x18a20800,0x08001040,0x10400000,0x18401061,0x40a02020,0x71e34080,0xdd70c44b,0x28c0c52f,
-0x18810000,0x7a681000,0xfe13fe55,0xf674edf2,0xfe54fe94,0xc388cc0b,0x9b89cc4b,0x00210800,0x10001882,0xfd8f9307,0xecabecec,0xe4edecac,0x9ba9e54f,0x08610800,0x08201080,0xd5b16ac7,0xe54eee12,0xdd50f5b0,0x000049a4,0x00001060,0x00000000,0x00000000,0x00000000,0x10600840,0xa42e1000,0x2860b4b1,0x59e51000,0x5982c4ef,0x10001000,0x18001800,0x08001000,0x08210800,
-0x08000820,0x18001800,0x49411800,0xd50ea388,0x1800b44d,0x00001881,0x08000800,0x08200000,0x08001040,0x18001000,0x20001800,0x10002020,0xa4aeacce,0x08000000,0xd5b35205,0xe613f695,0x08007b09,0x29420820,0x4a05b572,0x00000000,0x00000000,0x00000020,0x08410000,0x08000840,0x08002080,0x08000800,0xcd11bcd0,0x100038c1,0x18801000,0x28a13143,0x08000800,0x396320c0,
-0x39643943,0x20c13122,0x08400860,0xb511de56,0x00000000,0x7bad5227,0x00000820,0x00000841,0x00000000,0x00000000,0x00000000,0x00000881,0xde1341c3,0xee13f654,0xf718f675,0x00008c2e,0x080018c2,0xfeb7a42e,0xfe74fe74,0xfe55f634,0xc551fed6,0x18202020,0x41840800,0xfe96e5f4,0xf634f654,0xfe76f5d3,0xfe33feb6,0xfdd1fe12,0xccf0f5f2,0x10201840,0x10001882,0xfe149bac,
-0xbb6ae46e,0x18006142,0x10600800,0x080020a1,0x6aea0800,0x20c27b4c,0x10820000,0x08001020,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18820021,0x93ac1000,0x7a86cd10,0x10001800,0x10811860,0x002018c2,0x18000820,0x69a24080,0xf590bbea,0xfe72fe32,0x49c3ee53,
-0x18c10000,0x59851000,0xfe54dd51,0xfe94ff17,0xfe73f674,0xf4edfdb1,0xcccefdb0,0x00001040,0x10001862,0xf54e92c6,0xecececab,0xe50ff52e,0x59a2bc2b,0x08410800,0x10600020,0x49820800,0xdd4f9b89,0xccefdd2f,0x00005206,0x00001060,0x00000000,0x00000000,0x00000000,0x10600820,0xa44e1000,0x4983cd93,0x41841000,0xb48ed593,0x62466a67,0x59836a26,0x51e66a26,0x00000800,
-0x10400820,0x410230a1,0xbc6c61c4,0xe54ee56e,0x9bccedb1,0x18c30000,0x10001000,0x08400000,0x18600000,0x284028a0,0x38405103,0x38c02800,0xb52fde53,0x00000820,0xf6d69c4e,0xfe94e5f2,0x49c4de14,0x29430000,0x5247ce15,0x00000800,0x00200000,0x00000000,0x08210000,0x08000000,0x10001840,0x08001061,0xee5593ac,0x51a4cd52,0x08000800,0x08000800,0x10410841,0x08000800,
-0x08000800,0x08000800,0x4a260800,0x6b2ae6d8,0x08200000,0xc5b4cdf5,0x10610000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000881,0xd5d241a3,0xee34ee34,0x6b09cd73,0x10a10000,0x08001061,0xddd39c0e,0xee12dd91,0xf635f634,0xcd72fe96,0x20612040,0x51e50800,0xf633ddf4,0xedd2e5d2,0xdccff5b2,0xc3eacc0b,0xc3c9bb68,0x82a6ab48,0x10201820,0x08001041,0xd4ce6a46,
-0xe48de4ad,0x9309d48e,0x180040e1,0x08410800,0x00000861,0x00000000,0x08001060,0x30e21820,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610000,0x8ae81000,0xd42bcc2c,0x6161b368,0x10401000,0x08410000,0x28600800,0xe4ed92c6,0xed6efdd0,0xfdf1f58f,0x49c3ee12,
-0x10810000,0x62061000,0xe52ddd2e,0xedf0edd0,0xfeb3f651,0xe4ecfdf0,0xc48dd48b,0x00202080,0x08001061,0xed6f8b07,0xf58fe50c,0x8b09ccaf,0x10001000,0x08011000,0x08630842,0x000018c3,0x62251000,0xcdd4bcf0,0x000041c6,0x00001061,0x00000000,0x00000000,0x00000000,0x08400020,0xad120000,0x20a0cdd4,0x18600800,0xf6d8cd93,0xe655e676,0xf634ee55,0xe5d3edd2,0x00008bcc,
-0x52670000,0xddd3cd92,0xee12e5d2,0xed8ff611,0xac6df632,0x00000800,0xac9093cd,0x00001881,0xb48e3102,0xd4eee591,0xedb3d50f,0xe5d4e5b4,0xaccffef6,0x00000000,0xff598bcc,0xee75ee95,0x41c4e675,0x18e30000,0xd615d656,0x93cd9c2f,0x940c940c,0x9c0da42d,0x080049a6,0x9c2e0800,0x8b8abccf,0x08400800,0x942e0020,0xdd91ee96,0x9bebac0b,0x5a4893ac,0x00000800,0x8b4951a4,
-0x7ac782e8,0x7b087aa7,0xd6158329,0x5aa8ff5a,0x20e20800,0xd616e6b8,0x00000820,0x08200840,0x00000000,0x00000000,0x00000000,0x00000861,0xe6b741c5,0xacd1ff3a,0x00003144,0x084010a1,0x08410020,0x7b8c0000,0xff38e655,0xfeb6fed7,0xd5f4ff38,0x10601040,0x4a050000,0xff38eed7,0xfef7ff17,0xccaefe75,0xf591d4ad,0xfdf2fdd2,0xdd91fe74,0x10401000,0x080018c2,0xedd1a3ec,
-0xfe10ed8f,0xdcedfe11,0x6162b369,0x10411000,0x10620821,0x000018c1,0x72c81860,0x832acd31,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18600020,0xc44d1800,0xe42afd70,0xd4acec8b,0x080082e7,0x10611061,0x59e50000,0xf52ee50f,0xe50cfdaf,0xf5afd48a,0x49c2ee12,
-0x10a10020,0x51a40800,0xfdefe5b0,0xfe52fe31,0xfe51fe72,0xfe31f5af,0xbc6dfe32,0x00001860,0x080010a2,0xf6748b69,0x9369dd70,0x100040e1,0x10401840,0x20411840,0x08001000,0x18810800,0x08002081,0x41e60800,0x00002104,0x00000820,0x00000000,0x00000000,0x00000000,0x00400020,0x39850000,0x080041e6,0x00000820,0x5a255226,0x93cb5a45,0xfeb6e654,0xf633e5b0,0x0000acf0,
-0x31420840,0xa42c93ab,0xe5f3b4ae,0xe5b0fe74,0xac8ff675,0x08000000,0xfeb7c4f0,0x08005a48,0xee146247,0xfe32f5f1,0xe5d2edd1,0x9bccbc8f,0x52259c2c,0x00000020,0xa46e51e5,0xac8ea46d,0x08208bcc,0x10a20000,0xa46f734b,0xcd73a42f,0xff17ff39,0xff7aff17,0x08008bce,0xd5941000,0xe613fe95,0x08009bed,0x00000880,0xfeb5bccf,0xfe95feb5,0xacb1fed8,0x00000000,0xfed7ac6f,
-0xfe75fe75,0xe635ff17,0xde15cd92,0x3184b553,0x18810000,0xbd73c5b4,0x00000800,0x00000841,0x00000000,0x00000000,0x00000000,0x00000862,0xa4f22943,0x08006b2b,0x20c20000,0x08000800,0x08201040,0x00000861,0xb5313963,0xee96f6d8,0xcdb2f6d6,0x10801060,0x39a40000,0xeeb6de76,0xfe95f696,0xfe94e570,0xfe54fe74,0xf5f3fdf3,0xcd50f613,0x08001020,0x080018c2,0xfeb59c0c,
-0xfe51f611,0xfdf0fe10,0xbc0cfdd1,0x08005185,0x18a21042,0x6a860800,0xfe95c50f,0x82e8fe76,0x10a20800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18600020,0xa3481800,0xec6bf4ed,0xed2ed3a8,0x8b8aedf2,0x18820800,0x39030800,0xeccdd46e,0xfe0ffd8e,0xe50ce4cb,0x4161cd2e,
-0x10a10800,0x5a050800,0xfeb3edf2,0xfe32fe52,0xfdd0fe11,0xfdf1fdb0,0xd550fe32,0x00002081,0x08001082,0x9c4d7329,0x08003122,0x20610800,0x30e31861,0x30203081,0x8a876962,0x08002000,0x10611862,0x00200880,0x08420000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08000820,0x08000800,0x08400800,0x08000800,0x10000800,0xc5515205,0xddf3f695,0x00005a67,
-0x08001860,0x18001000,0x20201000,0xfef7c551,0x940ef6d8,0x00000000,0xf675bccf,0x08006aa8,0xe65649e6,0xfe73f673,0x6206ee14,0x08001000,0x00000800,0x08400860,0x18001000,0x10001800,0x08000800,0x00210021,0x08000800,0x08001000,0xeeb7940d,0xff19f6f8,0x0800734c,0xe5f42020,0xfe94fe74,0x938afeb6,0x08000800,0xfe759bab,0xf613fe13,0xacb0fef8,0x00200000,0xfef893ed,
-0xfeb6fe74,0x41a5c552,0x08000800,0x00000000,0x08000841,0x10402080,0x00410020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000018c2,0x18820000,0x08001882,0x7a8759c4,0x20203020,0x10a11020,0x08000000,0xe657836d,0xc5b2ff38,0x10800860,0x39430000,0xfe96e615,0xfdf3fe96,0xfe73fdf2,0xfe53fe53,0xfeb6fe75,0xddd3fef6,0x00211000,0x000018c3,0xff17a44e,
-0xfe32fe53,0xfe10fe10,0xedf2f5f1,0x08006a88,0x100020a2,0xfdf382a7,0xfeb5feb5,0x8b2afed7,0x10820800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200820,0xabca1000,0xdc6adcac,0xf58ff50d,0xb4ceedd1,0x08001000,0x10001021,0xcc4b8286,0xe52de50d,0xed8ffdaf,0x6265e611,
-0x10810000,0x52060000,0xe5d1d5b1,0xdceedd0e,0xf590d4cd,0xd48dfdd1,0xb44cc46c,0x000020a1,0x10200821,0x08200000,0x10810000,0x28811861,0x30802040,0x822548c0,0xed0ec3a8,0x4102c44e,0x10610800,0x08810040,0x00000041,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x41a60820,0x10005207,0x00000820,0x834a6287,0x08004163,0x49a40800,0x6aa7ac6e,0x18810800,
-0x38c11820,0x200040e2,0x08001820,0xa4d028e1,0x080083ac,0x100018c2,0xee33b48d,0x08005205,0x6ae90800,0xd5b2c571,0x08006a88,0x10401000,0x000020c0,0x00000020,0x61c53081,0x62056a26,0x08003103,0x00000821,0x20602060,0x18201000,0x9c900800,0x9c4feed9,0x08000000,0xd57228a0,0xdd70ddb2,0xcd10edd2,0x080020a1,0xee148b6b,0xe5d2dd91,0x6ae9d5b3,0x08600000,0xb4d12902,
-0xb4cfee76,0x08000800,0x10200800,0x08410000,0x00000841,0x08001000,0x00210020,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10211062,0x72c90800,0xedd2ddd3,0x40609b09,0x18403080,0x10411881,0x49c60800,0xcdd3cdb3,0x08600840,0x18600820,0xfe96cd52,0xbbcafdd2,0xbc0aab47,0xdd4fd52e,0xdd51e591,0xb46ed530,0x00210800,0x00000882,0xddb372c9,
-0xdd2fdd50,0xed8ff5b1,0xcd50f653,0x10201000,0x28a00800,0xcc6cc46d,0xe570d4cd,0x72a8dd51,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0xb48e1000,0xf612fe53,0xf5f1f5d1,0xe612edd0,0x00007309,0x080018c3,0xddb130c0,0xee11f633,0xf653f612,0x4a24e674,
-0x10a10000,0x39850820,0xb4adacae,0xdd71b44c,0xccedee12,0xccadcccd,0x8b4ac4ae,0x08620800,0x08010001,0x10601020,0x18811060,0x302030a2,0x9ac66141,0xd46bbba9,0xf54ded0c,0xcc8efd70,0x08006247,0x00200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200040,0xbd111020,0x7309ff19,0x08000000,0xee35cd72,0x5205d5b3,0x08000800,0x08000800,0x28a01000,
-0xcd30b48e,0xc4afc4cf,0x080059c4,0x00000840,0x08200020,0x93ac0800,0xfe95f655,0x3123cdd4,0x10200800,0x49a341a3,0x10001000,0xbd0f5a44,0x6b09bd71,0x08000000,0xf5f4934b,0xe5d2e591,0x1000b4d0,0x41a50800,0xd551cd31,0x1000ac4e,0x10410800,0x00005249,0x08000800,0xf6b79c2e,0xf696fed7,0xc592fed7,0x00002122,0xe65583ac,0xcdb2de34,0x000041c4,0x08000000,0x18610800,
-0x28e28bcd,0x10000800,0xc53193ab,0x08008b8c,0x31440000,0x41226a87,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08610040,0x08001062,0xf6d872ea,0xf673f695,0xccaef633,0x590192a7,0x10003060,0x000018a2,0x5aa820c1,0x00400820,0x20c10000,0xfe54dd92,0xe550dd0f,0xfeb5f613,0xf694f694,0xdd92f654,0xcd72fe75,0x08610800,0x000010a2,0xddb3836a,
-0xf635ee14,0xfe96f634,0x72a8f676,0x20e30800,0x8bcd0000,0xf613f6b6,0xf614edf2,0x938cedd4,0x10a20800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10400000,0xaccf0800,0xcd91eeb5,0xbcaecd30,0x9c0bac4b,0x00005245,0x10610861,0x6b080800,0x93eb9c2c,0x83298b8a,0x20e062c7,
-0x10400000,0x08200000,0x62a75246,0x62256246,0x6a446a86,0x59c26202,0x20604962,0x00200000,0x00000021,0x10400821,0x28802080,0x8aa82820,0xed0ed46c,0xfdeffd8f,0xe50ce50c,0xccaeed4e,0x08007b0a,0x08401040,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x08200820,0xc5511000,0x8babf6f7,0x08200000,0xfed7cd92,0xde76ee96,0x000062c9,0x186120c3,0xbd110800,
-0xfef6feb6,0xfe75fe95,0x5a47e635,0x10c20000,0x000010a2,0xf6b7940e,0xfeb6feb6,0xc593fef8,0x08003123,0x08000000,0x49a50800,0xee94cd91,0xaccff6d5,0x08000000,0xfeb5b46e,0xfe95edd2,0x28c1e655,0x62870800,0xf633f674,0xb4b0fe96,0x08411881,0x10610000,0x9c700800,0xf6d9f71a,0x834bb4b1,0x5a6793ac,0x00200000,0x41a420e2,0x20a02900,0x10200800,0x6aca41a4,0x10210800,
-0x08200000,0x9c0e1000,0xfe96fe96,0x1800ddf5,0x6b0a0800,0xbcb0feb8,0x00610800,0x00000041,0x00000000,0x00000000,0x00000000,0x00200000,0x00200040,0x08001041,0x9c4f3964,0xff16e675,0xfeb5f674,0xbbabfdd2,0x38807a25,0x18602040,0x00000800,0x08410841,0x08400000,0xfe95d5f3,0xfeb6ee34,0xff59ff18,0xf717f6f7,0xf6d7fef8,0xee98ff39,0x08600000,0x000010c2,0xff9bacd0,
-0xff5aff3a,0xff7bff3a,0x0800c533,0x000018a2,0xd6363144,0xff17ff59,0xfef7fed6,0xac6ffef8,0x10a20800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200820,0x944f0800,0x080083cc,0x08000800,0x08000800,0x10410800,0x00000000,0x00000840,0x00000000,0x08000800,0x00000000,
-0x08001020,0x00000000,0x00000020,0x08000800,0x08000800,0x08000800,0x00000800,0x00400840,0x00200041,0x20a10840,0x40e01800,0xe52faba9,0xf5b0fdd1,0xf5f1f590,0xee11f631,0x49439baa,0x08620000,0x10610800,0x00410041,0x00000020,0x00000000,0x00000000,0x00000000,0x08200040,0xa44d1800,0x9c4dff38,0x00000000,0xfed7d5f4,0xd635eed7,0x00005288,0x104118c4,0xc5930800,
-0xf655fef8,0xf656f635,0x734bf6f9,0x18e40000,0x10210842,0xf6d7cdd5,0xee54f674,0xff39f675,0x08009c91,0x20e318a2,0x942e0000,0xe653fef7,0xa46eee95,0x08200000,0xf6b4ac8d,0xee55f654,0x20a0cdd4,0x62880000,0xd5b0f6b5,0xcdd4de13,0x000041e6,0x00002124,0xee985206,0x8badf6d9,0x10000800,0x08001000,0x08610840,0x08000000,0x10001000,0x41421000,0xe676d5f3,0x00003984,
-0x000020e3,0xddb351e5,0xee13c4ad,0x1820ee36,0x734b0000,0xcd73fef8,0x08400800,0x00000840,0x00000000,0x00000000,0x00000000,0x00200001,0x08610020,0x10a20841,0x00000000,0xad1141e6,0xfeb6f6b6,0xfe54fe95,0x92c6dd0f,0x304050e0,0x08821860,0x00210021,0x00000000,0x8c0d6b2a,0x942e944f,0x8bcc940d,0x734a8bcc,0x7b6c734c,0x6b2b83ad,0x08400000,0x00000881,0xad1262ea,
-0xad32a512,0xb574b594,0x080041e6,0x00001882,0xcdf56b2b,0xc5b2c5b3,0xcd91d5f3,0xa46efed7,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000821,0x524818c2,0x08400000,0x10611061,0x20a11840,0x10412081,0x00210841,0x10820000,0x10831082,0x18611862,0x108110a1,
-0x08000800,0x00210021,0x10a10861,0x20a118a1,0x20602081,0x28c128c1,0x10601881,0x00000020,0x08600020,0x18001000,0xc46c61c3,0xfe52fdf1,0xf5d1fdf1,0xfe53f5d1,0x72c6ee33,0x08001000,0x10611081,0x08001000,0x00600000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200020,0x93ec1000,0x6b09de76,0x00000000,0xf6f8bd32,0x39a4ce15,0x00000000,0x08000800,0x31430800,
-0xfef8d5b3,0xfed8fe96,0x00009c4e,0x00001882,0x08000801,0xe6756ac9,0xfef7f6d6,0xd5d5ff18,0x00005227,0x08200820,0x41a50000,0xff18d614,0xa48ffef8,0x00000000,0xff57bd70,0xff19f6d6,0x1080d656,0x62c90800,0xff38ff59,0x734aeed7,0x08400000,0x18600000,0xa44f1020,0x0800838c,0x18001841,0x18202881,0x00000000,0x41850800,0x41014964,0xddb36205,0x8becf6d7,0x10200800,
-0x20810800,0xa42d1800,0xf675f654,0x1860de36,0x738b0000,0xc552ff19,0x08610000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000021,0x18811061,0x10000800,0x18a21040,0x00000020,0xfed693ec,0xfe74f674,0xf56ffe73,0x6982b389,0x18611000,0x00210821,0x08400000,0x00000020,0x00000000,0x08000800,0x08000800,0x00000000,0x00000000,0x00000840,0x10600000,0x00000020,
-0x00000020,0x00000020,0x10610000,0x10200800,0x102028e3,0x31211000,0x100020c0,0x940d838a,0x08610820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08000000,0x10401040,0x10001000,0x40e238e1,0x10001800,0x00000800,0x00000840,0x08000841,0x10001820,0x00000800,
-0x00410840,0x00000000,0x10000820,0x20001000,0x50e140a0,0x20002800,0x08001000,0x00400820,0x08000080,0xb3494880,0xfe13f592,0xfe11ed90,0xfe53f5f1,0xfe74fe33,0x0800ac4d,0x18811881,0x08000800,0x61c62000,0x00202923,0x00001081,0x00000000,0x00200000,0x00000000,0x08200820,0x31430800,0x08603164,0x00000020,0x5a883123,0x00002102,0x52260800,0x5a26ac70,0x00000800,
-0xbd103122,0xa40ce5f3,0x10400800,0x5a271860,0x10003102,0x49e60800,0x734b7b6b,0x4a078bef,0x10200000,0x10203102,0x00000800,0x736c3984,0x39457b2c,0x00200000,0x944d6b09,0x9cb0a48f,0x000073ad,0x41850800,0xa4908bed,0x08006aa9,0x52260800,0x08006ac8,0x00001040,0x10000000,0xac2d1800,0xbcaff634,0x00001060,0xe6156246,0xf674f695,0xf6b6ee33,0x0800734b,0x28801000,
-0x10004963,0x08001000,0xeeb7b511,0x0020ad12,0x52670040,0x942ec5b3,0x00400000,0x00000840,0x00000000,0x00000000,0x00000000,0x00000841,0xb46e4163,0x510192c8,0x10003060,0x00001882,0xee544162,0xfe73fe94,0xfe32fe31,0xd4cefe73,0x28007a25,0x08201000,0x00000020,0x18811081,0x18401040,0x20811840,0x18601840,0x18c31061,0x108218c3,0x00000821,0x10200820,0x20c31020,
-0x106120c2,0x10a30862,0x08200020,0x10001041,0x10000800,0x08001000,0x00000800,0x18a10800,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400840,0x20401000,0x69e53060,0x61627a26,0x7aa77245,0x184051c4,0x08400020,0x10010801,0x41231800,0x418459c5,
-0x00400820,0x08210841,0x49650800,0xa3ab8b2a,0x9ae89ae8,0xa34aa329,0x7aca9b6c,0x00001040,0x08000880,0xe48e8225,0xe550ed30,0xfe32f5f1,0xfe12fe32,0xedb1f5d0,0x080093cb,0x000018a2,0x83092080,0xbcb0a38c,0x000041c5,0x00000860,0x00000000,0x00200000,0x00000000,0x08000000,0x08000800,0x00000000,0x08400020,0x08000800,0x08000800,0xe6366ae9,0xde15fed8,0x00005227,
-0xb5110800,0x9bebff38,0x10200800,0xf6b7834a,0x4984d5d3,0x10001000,0x00000800,0x00000000,0x49e60800,0xc572d5f4,0x08003922,0x00000820,0x08000800,0x00200840,0x08000000,0x08001000,0x00200000,0x08000821,0x08001000,0x08000800,0xde144983,0x7309ee96,0x18c20800,0x20a10841,0xf612b48e,0xbceeedf1,0x000020c0,0xddd28329,0xe5b0ee12,0xac4dedd2,0x00000800,0xb46f3902,
-0x7287ddb3,0x18810800,0x20c00800,0x00000840,0x00200840,0x00000800,0x00200020,0x00000000,0x00000000,0x00200000,0x00000000,0x00001061,0xe5d24162,0xcc2ced91,0x18007a46,0x08001040,0xc50f4162,0xe52edd4f,0xed6fed6f,0xe590e58f,0xab8bed51,0x08002000,0x00000841,0x30e10800,0x390149a4,0x38e238e2,0x288038c1,0x08002060,0x00400000,0x10410000,0x18400800,0x18204164,
-0x10000800,0x00210821,0x08001061,0x20601820,0x38c238e2,0x410338c2,0x10202061,0x00000841,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x28201820,0xa2a76984,0xeceeecce,0xdd0ee4ed,0x8308d50f,0x10810800,0x08001041,0xccf16a48,0xdd91d530,
-0x102093cb,0x10821081,0x730a0800,0xfe54ee55,0xe52fed90,0xed90f5b0,0xd551ed91,0x00004983,0x080018c1,0xedd29b6a,0xdd4fdd2f,0xbc4bc4ac,0xe50de54f,0xe58fe4ec,0x08008b8a,0x080020e3,0xfe75834a,0xcd31fe75,0x000028c1,0x00001061,0x00000000,0x00000000,0x00000000,0x08200000,0x30e31000,0x100028c2,0x08200820,0x5a265a47,0x7b0a30c1,0xfed8ee97,0xf6d7ee55,0x0000946e,
-0xbd730800,0x72c8ff7a,0x18600800,0xfef6cd91,0xe614f6d6,0x38808ae9,0x18202880,0x000020c2,0xcd723122,0xf696ee96,0x4162d5b2,0x10001000,0x08001000,0x00400840,0x18000800,0x10001800,0x10210800,0x08000800,0x08001000,0x28a01000,0xf6b5d5b1,0xeeb7ee95,0x00005a48,0xa48f0800,0xe590edf3,0xbcaedd4f,0x00002902,0xe6127b28,0xe5d1ee12,0xac2df613,0x00000800,0xe6337b49,
-0xe5b3feb6,0x08004983,0x08000800,0x08400000,0x00000040,0x00000000,0x00200820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000861,0xcdb141a2,0xfe33fe94,0x38e2dd93,0x00000800,0xee5541a3,0xf5b1edd2,0xfe73f612,0xf673f652,0xee35fe75,0x080051c6,0x08001082,0xcd308b8b,0xd50fd50f,0xccced530,0xccced50e,0xac6ec4ae,0x000062c9,0x00001081,0x9bcd1800,0xa40cc4cf,
-0x28c27288,0x08420000,0x28a10800,0xbccea44d,0xccaebc8e,0x92c8c40c,0x204048e1,0x08411021,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08200020,0x38801000,0xd40b7162,0xf54ef52e,0xf5afed4e,0xee12fdf1,0x000051e4,0x100020a1,0xedf551a5,0xf5f1fe54,
-0x5a04ee33,0x18a30800,0x28e20000,0xfe74d5b2,0xf5b0fe12,0xf5b0f5b0,0xf614f5b1,0x08006245,0x000018c1,0xff1893cc,0x9bcae614,0x280040c0,0xe59192e7,0xfe94fe53,0x080093ed,0x080020e3,0xf6348b6a,0xddf3f675,0x00003102,0x00000020,0x00000000,0x00000000,0x00000000,0x10400020,0xbd131000,0x3944de16,0x20c20800,0xff3ad636,0xff9cf71a,0xf6f8ff7b,0xff9af719,0x00007bac,
-0xad330000,0x49e5e6b8,0x39220800,0xf6b4ddf2,0xfed6f6b4,0xee15fe76,0xb512ee77,0x08000800,0xff5a62a8,0xff18ee97,0xe675ff79,0xc533c552,0x5a49b4b1,0x00000000,0xbd127b6c,0xb4d1b48f,0x08006269,0x52690800,0xd636bd74,0xee96de56,0xee74ff17,0xffdcff59,0x00009470,0xde150800,0xfe95ff17,0xd5d3feb6,0x18a00800,0xa42b0800,0xfeb6feb6,0xa46ffeb7,0x00000000,0xff1783ec,
-0xf695e633,0x7309cd72,0x732a732a,0x080041a5,0x10810000,0x31442923,0x08200000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000841,0xde5441e4,0xfe95f674,0x3903e5f5,0x00000800,0xee9641c4,0xfeb6fef7,0x8b68dd92,0xde13a44c,0xde14fef7,0x00003143,0x08001882,0xfe74ddf3,0xfe53fe33,0xfe74fe94,0xfe53fe73,0xfeb7fe74,0x0820732a,0x080018c1,0xfef993ad,0xfe95fe95,
-0x20a1d5d4,0x18a30000,0xa42e0800,0xfef5ff17,0xfeb5fef6,0xdcaefe34,0x40c16162,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10200020,0x49221800,0xfdf2abaa,0xfe52fe32,0xfe72f611,0xfe52fe52,0x28e1d592,0x18a10000,0xac6f0800,0xfe12fe75,
-0xddd2fe74,0x08000800,0x08001881,0xf6338b8a,0xf5f2f612,0xfe33fe32,0xee35f634,0x00006ae8,0x000018a1,0x8c2e5a88,0x080031a4,0x18001000,0x41631000,0xcdd4a48f,0x080062c9,0x000018c1,0xfeb693ab,0xde14f674,0x000028e2,0x00000861,0x00000000,0x00000000,0x00000000,0x10600841,0xc5731000,0x6287ee97,0x29220800,0xd636ef19,0x94509cb1,0x8c0e940e,0x73ac83ed,0x00002985,
-0x3a080000,0x08405288,0x41a40000,0xfe94e613,0xfeb6ee53,0xbd11de14,0x9cb1c5b4,0x00000000,0x944f2923,0xa4b1acb1,0xb552b532,0xe698b532,0x9430ff7c,0x00000000,0xff9ac5b4,0xff5aeef8,0x0000ad11,0x736c0000,0xd616ff7b,0xacd0acd0,0xa48fa48f,0x9470942e,0x08204a48,0x83cd0000,0xa44dacf0,0xeed8d5d3,0x0800838b,0x10001860,0xbd319c0d,0x6b2abd72,0x00200000,0x9c8f5288,
-0x836993cb,0x8c0c9c6e,0xcdf4942d,0x0800b531,0x5ac90820,0x9c2eeed8,0x10610800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000841,0xde753983,0xfe96fed6,0x28a1e5f5,0x00000800,0xde753162,0x7b6ac5b3,0x00000800,0x39830820,0xbd72accf,0x082028e1,0x18800000,0xfeb5de14,0xedd2f633,0xf674f654,0xfe74fe74,0xacb0f696,0x18c20800,0x51c50800,0xfe97e616,0xf696fe96,
-0x08406b2a,0x08001881,0xee975a47,0xf654f696,0xee54f695,0xfe54fe54,0x40c09b28,0x08002060,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400820,0x7aa81000,0xf5d0edf2,0xfe53f5f1,0xfe31fe52,0xe52ef58f,0x7ae8edd2,0x18c10820,0x41a30000,0xfe12edf3,
-0xedf2edb0,0x08006a87,0x080018a1,0xd5911000,0xf5f1feb5,0xfe33fe52,0xee55f613,0x082062a8,0x10401060,0x00000000,0x28c10800,0x410338c2,0x080030e3,0x10800000,0x000018a2,0x000018c2,0xf6b693ec,0xcdb3f696,0x002020c1,0x00000860,0x00000000,0x00000000,0x00000000,0x10610841,0xc5930800,0x3101e697,0x39431000,0x7b6cde56,0x08000000,0x10001000,0x00000800,0x00410000,
-0x00000862,0x10600000,0x10401060,0xfed7cd52,0xd5b3fef8,0x080049e4,0x00000820,0x08421062,0x00000000,0x10001000,0x00000800,0x6ac90800,0xa470ff7b,0x00000800,0xf739b532,0xff9ae6f8,0x0000948f,0x7bab0800,0x3984e6f9,0x08000800,0x10001000,0x08001000,0x08410000,0x00000840,0x10000800,0xbd7320c0,0x62a8e6d8,0x18810800,0x08000800,0x00000800,0x10610840,0x10000800,
-0x10001000,0x08000800,0x7b6a1020,0x1000c552,0x39840000,0xc572cdd4,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0xcdb320c0,0xf696f696,0x1800d5b4,0x00000000,0x83cc2922,0x080020a0,0x29031020,0x000020c1,0x39a30800,0x08401080,0x31630000,0xfeb5d5f3,0xfe74f654,0xfeb6ee54,0xf675f654,0x3943ddf5,0x18a10800,0xb4b00800,0xf635fed8,0xc552fe76,
-0x00200820,0x08001060,0xf6d7b4f0,0xfe95feb6,0xfed6fe96,0xfed5feb5,0x6182ed70,0x00002080,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10600840,0x9bec0800,0xe4ecedb0,0xec8ceccc,0xd42adc4b,0xdc8bcbe8,0x9babdd2f,0x08600800,0x080010c1,0xed4fa389,
-0xd54fdd2e,0x1000b48e,0x18a10000,0x6a860800,0xedf1e612,0xf5afedaf,0xfef7fe32,0x00005a46,0x08001041,0x20801860,0x82455142,0x58c081e4,0x30c15122,0x000020c0,0x00000820,0x000018c3,0xf718942d,0xd5f4f6d7,0x00001060,0x00000861,0x00000000,0x00000000,0x00000000,0x08400020,0x83ee0800,0x1000734b,0x59e61000,0x7b6bee98,0x20c10000,0x82655982,0x724692e8,0x08001820,
-0x20a10800,0x202051a5,0x08200800,0xcd953944,0x3964cdf6,0x08200000,0x08000800,0x00000821,0x18001020,0x20002000,0x08200800,0x08000820,0xc552e616,0x08000800,0xde5749e6,0xc5f4ff9b,0x084039c5,0xa4b00800,0x0000d657,0x206018a2,0x59212800,0x18003880,0x00201020,0x00000841,0x08000800,0x00200820,0xc5f69cd1,0x080028e4,0x10001820,0x10201000,0x08000820,0x18001000,
-0x18001800,0x10600800,0x5a880000,0x1000c572,0x00001060,0x62a91880,0x00210000,0x00000021,0x00000000,0x00000000,0x00000000,0x00000841,0xd5d41840,0xfed7fed6,0x1000d594,0x08400800,0x00000000,0x20001000,0x61855944,0x288038c1,0x000020a0,0x08400020,0x39840000,0xee14ddf4,0xf634e5d3,0xfe96fe75,0xee56f655,0x00006aa9,0x080020c3,0xe6156267,0xf635ee15,0x59c4f634,
-0x18a20800,0x732a0800,0xee13e655,0xfdf3f5f3,0xf5d2f5d2,0xed90f5b1,0xa3aaf5f2,0x18812040,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x10810020,0x62460800,0xfdaff632,0xf4cdf50e,0xfd4eecad,0xfe32fd4e,0x6a25fe34,0x10800800,0x08000860,0xf5b182a6,
-0xf632fe12,0x8b6bf675,0x18c20000,0x10001060,0xfed5bcef,0xfe52edf1,0xbccffe95,0x00003963,0x10001041,0x48c02000,0x9a858203,0xab28bb48,0x38806162,0x20804961,0x08210000,0x00001083,0xe6976b0a,0xcdf4f719,0x00200000,0x00200840,0x00000000,0x00000000,0x00000000,0x00200000,0x00000861,0x08000000,0xcd323080,0x62a8fef9,0x10400000,0xfe54c4cf,0xf635fdf3,0x080093ad,
-0x838c0800,0xd5d4ee36,0x08005226,0x10410800,0x00001062,0x6b0a0800,0x93efb512,0x00000000,0xac6f3103,0xbcd1cd12,0x41c5acb0,0x08000000,0xd5b3b4d0,0x080049c5,0x732c0800,0x20e1ad11,0x08000000,0xf6d872c8,0x0000cdf5,0x62680000,0xd4afccb0,0xac2cc44c,0x00003963,0x736c0000,0x6aa8b4f1,0x00000000,0x630b0000,0x10003125,0x93cc49a5,0x3943834b,0x08000000,0xa3cd5a06,
-0xac2cb42d,0x396393ec,0x39640000,0x9becd5d3,0x10001000,0x08200800,0x00000021,0x00000000,0x00000000,0x00000000,0x00000000,0x08001041,0xd5f428c1,0xfef8f6b6,0x1000e657,0x08000800,0x10001020,0x8ae84942,0x9287b3ab,0x514271c4,0x20601800,0x18a20000,0x29040000,0xff39de16,0xfe96fef7,0xf675feb5,0xbd12fef8,0x18a20800,0x08000820,0xfeb7cd72,0xfed7f696,0x3080dd91,
-0x18821020,0x8c0d0000,0xfe95fef7,0xfdf3fe54,0xfdf3fe34,0xfdd1fdf2,0xf634fe33,0x08006a67,0x00201061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08400000,0x10200840,0xfe53c4ee,0xfe73fe53,0xfdf1fdf1,0xfed6fe73,0x080093cc,0x082018a2,0x38c01800,0xfe73d4ef,
-0xfe53fe73,0xddf5f654,0x000020e2,0x000010a2,0xe6745a45,0xe655f6f7,0x1880acaf,0x08610000,0x18200841,0x81a34020,0xdc6bc3a8,0xfe33fdb0,0xc44dedb2,0x40e07a45,0x00210800,0x10410021,0x52470000,0xce16ce15,0x00200000,0x00000040,0x00000000,0x00000000,0x00000000,0x00000000,0x08820000,0x49650800,0xfef7cd52,0x72e8ee55,0x08000800,0xff17d593,0xfef8fed6,0x1000acd2,
-0x9c2e0800,0xff18ff39,0x49e6d636,0x08410000,0x08000841,0xeeb77b2b,0xde76ff59,0x10202923,0xfeb76a87,0xff18fed7,0x836bff19,0x00000000,0xeed7a48e,0x2080c572,0x00000800,0x00000820,0x62460800,0xfe96f635,0x0800bd30,0x93cc0800,0xf5f3f655,0xfe95f633,0x100072e8,0xcdb40800,0xf676ff39,0x08006aa9,0x000010a1,0x39640800,0xee95cd72,0x940df6b7,0x00000000,0xf6549c0c,
-0xfe74edb1,0x6a87fed7,0x30e20800,0xfe33e5b2,0x3080bc6e,0x10810800,0x00000020,0x00000020,0x00000000,0x00000000,0x00000000,0x00001042,0xcdd420a1,0xf6f8ff39,0x0800b532,0x18410800,0x72261800,0xedd1d4ef,0xedb0feb4,0xa328b3a9,0x40a08225,0x10201800,0x00000821,0xad1041e5,0xfed6e655,0xfe94f673,0x51e4ee54,0x18c20800,0x838b0000,0xf675f6b7,0xee34ee75,0x6a45ee13,
-0x10820800,0x20c00820,0xfef7de34,0xfe96fed6,0xfeb6fe96,0xed90fe33,0xfed6edf2,0x00008bcd,0x08211061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200840,0x00000860,0xe5f351c4,0xe612f674,0xf652ee11,0xb4f0ee54,0x08400800,0x18610820,0x8ac91800,0xf612f613,
-0xf611edd0,0xfed7f613,0x00009c8f,0x10811082,0x83cc0800,0x29228c0d,0x00000800,0x00210862,0x10000841,0xd42c8a67,0xfdd0eced,0xedf2edb1,0xfe34f634,0x9b8bf5d3,0x08410800,0x08200021,0x08001061,0x5aa91860,0x000018c3,0x00000841,0x00000000,0x00000000,0x00000000,0x00200000,0x08620061,0xd5b50800,0xf694ff17,0x6266e633,0x10200000,0xf6d7bd52,0xeed7eeb5,0x0800b4f2,
-0xac900800,0xe696f6f8,0x83cdeef9,0x20e30000,0x080018a2,0xfef8d5b5,0xe696eeb6,0x080041a4,0xee756a86,0xe675eeb6,0x72a8f6b6,0x00000800,0xeed6bd71,0xb532ee96,0x18820800,0x000018a2,0xe6156288,0xee13f614,0x1020bd31,0x93ec0800,0xee13f695,0xe613f674,0x08006a87,0xc5930800,0xee35ee34,0x28c3d5f6,0x20e20800,0x83ac0800,0xf6d6f718,0x942dfef7,0x00200000,0xf6748baa,
-0xedd2edf2,0x7ac9e5f4,0x28c10800,0xe590cd2f,0xb48ff614,0x00001880,0x00200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00001042,0xde573985,0x734acdf5,0x00000000,0x08001061,0xcccf5163,0xfe73f5d2,0xf611edd0,0xdccefdf2,0x8a87cc2d,0x080038c2,0x08210821,0x00000020,0xb4ee5225,0xf6b5ee74,0x080093cb,0x000020e2,0xde5639a4,0xf675fed7,0xf695f6d6,0xcd30fef6,
-0x10411000,0x00001081,0xe67662a7,0xf675ee76,0xf634e5f4,0xe5d1edf2,0xcd92feb5,0x00001840,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10610000,0x18a10000,0x93cd0800,0xde54de55,0xee95de12,0x5226de14,0x10a20000,0x08000020,0xddd32040,0xfe93fed6,
-0xfe94fe94,0xf633f5f2,0x5a67e634,0x10810000,0x00001060,0x00000000,0x08411082,0x00210021,0x10000862,0xfe54936a,0xfe95fe34,0xf675f695,0xee54f696,0xf6b7f696,0x08005a28,0x00001061,0x18810840,0x00000800,0x00220000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x10a20020,0x8b8d0800,0xf716eed6,0x5246f717,0x08200000,0xff9bcdf5,0xff79f718,0x0800a4d1,
-0xa4900800,0xf739f738,0x0800940e,0x00001081,0x08000000,0xd5b46227,0xd613ee95,0x08002901,0xf6b66a87,0xf6b5f6d6,0x72c8fed6,0x08000800,0xff78bd92,0xbd12f6d8,0x00001881,0x080020a3,0xee967b6b,0xfeb6f634,0x0800c593,0x9c4f0000,0xf694fef7,0xf6b6fef6,0x080072ea,0xc5b41000,0xeed8f718,0x080083ad,0x08001840,0x10601020,0xeef7ad10,0xacb0f719,0x00000000,0xff18a48f,
-0xf6d7f6d7,0x7b2aff19,0x10600800,0xf6d7cdd4,0xd5d5fef9,0x000018a2,0x00200840,0x00000021,0x00010001,0x00000000,0x00000000,0x08010801,0x734c3185,0x00000820,0x00210020,0x080018a3,0xf6548b6b,0xfe33f633,0xf633f613,0xfe75fe95,0xbc8ff635,0x10002040,0x00000041,0x10a10881,0x08200000,0xb5318c0d,0x00000800,0x000010a1,0xff19bd73,0xfed8fed8,0xf6b6f6d7,0xfeb7fed7,
-0x10006247,0x10811081,0x9c6f0820,0xf675fef8,0xfe74f654,0xfeb6fe95,0x6ac9f6d7,0x18820800,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x00000021,0x08000800,0x08401060,0x10400800,0x42044205,0x62c75245,0x08003943,0x00001081,0x00001082,0xbd1149c5,0xcd70cd91,
-0xd592c551,0xf612f613,0xc592ee74,0x00001040,0x18611040,0x102020a2,0x08000800,0x00000821,0x080018a3,0xff17ac6e,0xfeb7feb6,0xff18fef8,0xfef7feb6,0xf6d8f6d7,0x08007b4c,0x08401060,0x08200000,0x18611860,0x00010821,0x00000021,0x00000000,0x00000000,0x00000000,0x00000020,0x08200040,0x08000800,0xc5f36b29,0x39a5ad52,0x00000000,0xbd328bce,0xacd0acd0,0x00005268,
-0x9c700800,0x9c8ff719,0x10001000,0x83ac1040,0x080062a8,0x62671000,0xde55eed7,0x08001020,0xbd5249e6,0xc551cdb3,0x49a4acae,0x08000800,0xb5316b09,0x28c1acf1,0x10400800,0x10000800,0x836a0800,0xd5f4d5b2,0x08009c4f,0x6b2a0000,0xc591d5f3,0xd5f4de55,0x08006a89,0xd6371000,0x7bacef3a,0x10000800,0x30e21800,0x08000800,0xa5100000,0xa4b0ff7b,0x00000000,0xeed9940f,
-0xf75ae6b7,0x5a88e6b8,0x00000000,0xd6779d12,0x6acbd617,0x10a20000,0x00000020,0x00010021,0x00010001,0x00000000,0x00000000,0x00010001,0x00000800,0x18a11040,0x00200820,0x080018a2,0xfed68bcb,0xfe75fe95,0xfed7feb6,0xfeb7fed7,0xddb4fef8,0x10201800,0x00200841,0x10601061,0x000018a1,0x00000000,0x18c30000,0x7b8c0000,0xfef8f719,0xf6b7fed8,0xff59ff39,0xff19f6b7,
-0x1820cd73,0x10820820,0x20c10000,0xee75d5f4,0xf674e5f2,0xfef7ff17,0x0800b511,0x08211061,0x08000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x51c63904,0x18601000,0x00200820,0x00000000,0x08000800,0x08410800,0x00000800,0x08210020,0x08000000,0x08000800,
-0x51c50800,0xfe94f634,0xeeb6feb4,0x00005248,0x20202061,0x40a03040,0x306040c0,0x00200800,0x00000860,0xfe9593ab,0xfed7fe95,0xf696fed7,0xfeb5feb6,0xf6d7feb5,0x0000730b,0x08001061,0x18403123,0x20a11000,0x00000841,0x00000021,0x00000000,0x00000000,0x00000000,0x00200020,0x62a920c2,0x080030e3,0x00400000,0x00000000,0x08200841,0x10000800,0x10001000,0x21040000,
-0xa4f20000,0x0800de57,0x18201040,0xfef88b4a,0x6225ee35,0x00001000,0xeed8bd53,0x084018a1,0x00001040,0x08000800,0x00000000,0x08210821,0x00000000,0x08000000,0xb48e4982,0x28a1bcd0,0x00000800,0x08000000,0x08200800,0x00000840,0x20c01040,0x18814184,0x20a20800,0xc5f50800,0x08007b8d,0x28401820,0xee36bcd0,0x100072a8,0x00000820,0xb533bd74,0x10820000,0x4a2820c3,
-0x52465267,0x20c24a07,0x00200000,0x00200020,0x00000000,0x00000800,0x08200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18201000,0x10001800,0x08200800,0x08001061,0xfe958b8a,0xfe74fe74,0xfe96fe95,0xfe96fe96,0xd552fed8,0x18612040,0x10400000,0x10001000,0x10401020,0x08201882,0x00000862,0xe65641a4,0xfeb6f696,0xff18feb6,0xd614eeb6,0xde36d615,
-0x49c6d5f6,0x08410000,0x00001081,0xde5583cc,0xe633e695,0xd5f4ee75,0x000028c1,0x002110a2,0x10210800,0x00000820,0x00200000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08210000,0x10200000,0xb4713082,0x10007aea,0x10401881,0x10411061,0x18821061,0x00000841,0x10200800,0x10611041,0x18811040,0x20a21881,
-0x080020c3,0xee759c0d,0xa48eee95,0x18610000,0x48c12000,0x9b087a25,0xc4afc44d,0x00203943,0x080010c1,0xee149bcc,0xf675e5f3,0xf655f655,0xf675f675,0xee55ee13,0x00006aea,0x00002103,0xd5f68c0e,0x08007b0a,0x00210000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200840,0xc5741000,0x0800c574,0x00001081,0x00210000,0x10400820,0x28402020,0x20203061,0x00000800,
-0xb5740000,0x0800c5b5,0x6aa90800,0xee14e615,0xcd31edf3,0x00003123,0xde77942e,0x08004a06,0x10200800,0x08001000,0x00000800,0x00000841,0x00000000,0x000018e4,0xfe94ac4c,0xbcf1f655,0x00000800,0x08000000,0x10410000,0x00000820,0x08000800,0x08001000,0x08001000,0xbd930800,0x080041e6,0xbcb028a1,0xfe96ee35,0x8b4bf656,0x00001040,0xa4919c50,0x18810800,0x08000000,
-0x08000800,0x00000000,0x10610000,0x00210041,0x00000842,0x62ca3124,0x00201081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x41221000,0x830959c4,0x00004184,0x000018a2,0xee137b08,0xf5f2f633,0xf634edd2,0xf634f675,0xe593feb7,0x10002040,0x08001061,0x8b2a9bcd,0x18003080,0x10001020,0x082018c3,0xfef8940e,0xf696ee34,0xd5f4f6b7,0x08005a46,0x08000800,
-0x10000800,0x10401020,0x10800800,0x31420000,0x31413121,0x184028e1,0x20a21000,0x00000000,0x18411882,0x00001041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20400820,0xdd543020,0x4942ee56,0x18001800,0x08001000,0x00000820,0x08400020,0x18201840,0x10001000,0x10001800,0x08200800,
-0x08000820,0xd63620c1,0x18a0ce15,0x18610000,0x822550e2,0xed71b3aa,0xee15fe55,0x00005226,0x08001881,0xff199c0d,0xf675ee55,0xfe76fed7,0xf655f656,0xee96feb6,0x000041c6,0x002010a3,0xff199c6f,0xb4d1ee97,0x00001040,0x00000841,0x00000000,0x00000000,0x00000000,0x08200841,0xcd731000,0x5a25f6b7,0x41e50800,0x31038c0e,0x51a50800,0xcd32bcb0,0xc511d553,0xbd12bcd1,
-0xe719bd94,0x0800c5b4,0x8bae0800,0xfed7ff3a,0xde34ff37,0x100028e2,0xf6f87309,0xacafde35,0xa40cac2d,0xbccfac2d,0x49c5ac8f,0x10600000,0x5a686ae9,0x00000000,0xf693bd0f,0xfeb6f654,0x8b4ab4af,0x7b098b8a,0x000041e5,0x31210000,0x51626a45,0x30804921,0x39823100,0xe6969c6d,0x080041a5,0xeeb751e5,0xf695ee95,0xe5f4feb6,0x08003123,0xddf69c2f,0x08003102,0x18001000,
-0x10001000,0x08200800,0x08000800,0x08000800,0x08001040,0xacf26268,0x00000000,0x00000861,0x08000000,0x00000000,0x00000000,0x00000860,0xac2d28a0,0xdd72dd51,0x08006a88,0x000020e3,0xf6969c4e,0xf654f674,0xf654f654,0xf6b5f674,0xddb3fed7,0x10002860,0x00001882,0xf697cdb4,0x82a7bc8e,0x200040c0,0x08001840,0xe6365226,0xfed7fe97,0x62a8f6d8,0x20a10800,0x10001000,
-0x18001800,0x10002021,0x08400800,0x00000820,0x00000000,0x08000840,0x10002061,0x8bed28c2,0x184128a2,0x00001040,0x00200020,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20401040,0xcc903020,0xe5f3fe97,0xac2dbc8e,0x41a5a44f,0x08400800,0x10400840,0x72864142,0x8b088b08,0x6a268287,0x080030e2,
-0x08411041,0x6b4c0000,0x08004a07,0x28811861,0x92246983,0xfeb5f591,0xf676fe13,0x00005a67,0x08001881,0xcdd541c6,0xfef8ff19,0xfeb7fed7,0xff19fed8,0x836be635,0x08420000,0x000010a3,0xfef7b4f0,0xee76feb6,0x084028e2,0x00200040,0x00000000,0x00000000,0x00000000,0x08200840,0xd5d41840,0x5a45eeb7,0x83ac0800,0x6a67eeb7,0x62471000,0xfeb7feb7,0xfef8f696,0xbd12f697,
-0xa4d1a4b0,0x08006b0a,0x62890800,0xd614cdd4,0x8babcdb2,0x08000800,0x8bab4164,0xcd7293cc,0xfed6ff17,0xfed7fef7,0x8bacfef8,0x41840800,0xbd52eeb7,0x08000000,0xde12b4ef,0xfe96ee33,0xfef7ff18,0xff59fef7,0x0000a4d1,0x8bec0000,0xf634ee34,0xcd51edf4,0xbd92d634,0x9c6ebd92,0x000020c2,0x9c6e3122,0xcdd3c5b3,0xb4f0d5d3,0x00000800,0xcdf662a9,0xcdd4bd73,0xbcf0cd93,
-0xc573bcf1,0x00008c0f,0x10001020,0xa450a470,0x00000800,0xacd26288,0x00200000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000881,0xee356267,0xfe76fe95,0x08006a88,0x000018c2,0xf6f88bed,0xfeb6ff18,0xfed6fe95,0xee74f6b5,0xe635ff38,0x10002881,0x10001862,0xff17d5b3,0xed92feb6,0x28008a86,0x10611820,0x8bad0800,0xfef9fed8,0x000093ee,0x080020e3,0x39031860,
-0x49033081,0x598548e3,0x08004144,0x08411061,0x00001082,0x18200000,0x38c12020,0xd5f5c531,0x10202060,0x08001861,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x20400800,0xd4d03040,0xf654feb6,0xee34fe75,0x5a27ee77,0x18610800,0x18001841,0xd48d8267,0xfe12f591,0xe5b1edb1,0x3122d5b3,
-0x08610000,0x00000041,0x18400000,0x30402061,0xcbea8a04,0xf612f5b0,0xee14f613,0x00005206,0x08611081,0x10620000,0xb5327b8d,0xee95e635,0xacf0cdd3,0x08004a26,0x08410841,0x00001082,0xfeb5b4cf,0xd5b2fed6,0x00002902,0x00000861,0x00000000,0x00000000,0x00000000,0x08200821,0xcdf50800,0x1880ce14,0x72c91000,0x7b28e655,0x49e50800,0xe613ddd3,0xd5d2ee54,0x08005a67,
-0x08000800,0x08200000,0x00001061,0x08000800,0x10001000,0x08620000,0x00000000,0x08000000,0xee969c4d,0xfeb8feb7,0x6aa9e657,0x51a41000,0xddb2ee34,0x08001000,0xfef7a48e,0xf6b7ee76,0x944dd5f4,0x8c4e946e,0x08204a48,0xacd10800,0xfe96fed7,0xf697f676,0x108083cc,0x00000800,0x00010001,0x00000000,0x08200800,0x00000800,0x08610000,0x00000000,0x942d18a1,0xf696f6d7,
-0xfef8ee55,0x18a0ce15,0x08000820,0xddd5c532,0x000018a1,0xb5135a68,0x08410000,0x00000841,0x00000000,0x00000000,0x00000000,0x000008a2,0xee975247,0xfed8f676,0x00006288,0x002018c3,0x73290000,0xf695bd30,0xe612ee33,0xfed5f674,0x836bd5d2,0x08011040,0x10001862,0xee11bcce,0xfe54f5b2,0x79e4f551,0x10811000,0x00000040,0xbd32bd32,0x08600800,0x10600000,0xb46e9c0d,
-0xabecac0c,0x9b8babec,0x18004922,0x08410800,0x5a670000,0xac0cac6f,0xee14b46d,0xddd4fef8,0x18202881,0x08001861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x28801040,0xd4d03000,0xe613fed6,0xfed6ee33,0x0800940d,0x18201861,0x49031000,0xfe75c40d,0xe54ffdf2,0xf612fe52,0x93cbe5f2,
-0x10820800,0x08620021,0x18201041,0x51011800,0xfdb0bbaa,0xf633ed90,0xfed6fe74,0x080093ec,0x10a20000,0x00000841,0x08000000,0x7b496287,0x000020c0,0x10a20000,0x18a20820,0x10000800,0xfeb5cd30,0xddf3f674,0x000028e1,0x00000840,0x00000000,0x00000000,0x00000000,0x00200841,0x6b0a0000,0x08004a26,0x7ac82000,0xb4efee75,0x18400800,0xddf372c8,0x6ac7de14,0x08000800,
-0x28c23102,0x08610000,0x10200000,0x498428c1,0x20205163,0x00210800,0x08400000,0x10201860,0x838b0800,0xde17d5f6,0x100072eb,0x72461800,0xe5d1f633,0x10002020,0xbd524183,0xbd52f6f9,0x082041c4,0x08000800,0x08000800,0x72e90800,0xfed8e635,0x72c8ddd4,0x00000800,0x08000800,0x08410000,0x00000000,0x08000800,0x00000800,0x00400840,0x00000000,0x08000800,0xde34836a,
-0xeeb7ff19,0x08209c6f,0x08000820,0xddd4e5f5,0x00000800,0x732c41a5,0x00000000,0x00000020,0x00000020,0x00000000,0x00000001,0x000008a2,0xf7196b0a,0xfef8ff59,0x100072c9,0x08001820,0x00001060,0xa44d20a0,0xf695de14,0xa40cddf2,0x10204162,0x20c30820,0x62260800,0xf632ee13,0xf591f5f2,0xab28fd50,0x10402820,0x00000881,0x28e220c1,0x10a10000,0xacd00000,0xfef6fef7,
-0xfed6fed6,0xfe95ff37,0x200082a7,0x10811840,0x62880000,0xfe95feb6,0xfe74fed5,0xe615f654,0x18204123,0x08001020,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28801060,0xc44f3000,0xe634fe96,0xcdd2fed6,0x00000000,0x18001841,0x82472000,0xfeb6edb3,0xf654fe74,0xe590edf2,0xe5f3fe53,
-0x000041a4,0x08410861,0x10000820,0x92a73860,0xfe52dd0e,0xedf2fe33,0xf6b5fe95,0x9c4cf6b5,0x000039a3,0x08610881,0x18811082,0x08000800,0x10c20000,0x00400881,0x10001040,0xabcb59a4,0xdd2fdd50,0xcd10dd2f,0x00003963,0x00000840,0x00000000,0x00000000,0x00000000,0x00200000,0x00000842,0x18000800,0xcccf40a0,0xe655feb6,0x08006ae9,0x41850800,0x10004165,0x51a31000,
-0xd5b3cd31,0x08006288,0x49e50000,0xb42cac2d,0x7aa7bc4d,0x08000800,0xa47020a1,0x30a0a42d,0x00000800,0x39a63985,0x08000000,0xd51140e2,0xf654f613,0x1000a40d,0x08200800,0x18c16b2b,0x18000800,0x61a35162,0x514369c4,0x08001800,0xbd535a67,0x08005a48,0x52050800,0x9bedac6f,0x000020c2,0x83ad1861,0xa42eac6f,0x6267a44e,0x00000000,0x93ed2903,0x10006205,0x39a51000,
-0x942fbdb5,0x10200000,0x9c2f0800,0xcd73f697,0x08201020,0x00000000,0x00000841,0x00000800,0x00000000,0x00010000,0x00210000,0x000010a2,0xeeb7734b,0xf633f6b5,0x5901a38b,0x28005902,0x18a11020,0x08000000,0x730a5247,0x08003122,0x10800000,0x10000800,0xddb25184,0xee12ee13,0xdceeedb0,0xdccee50d,0x280079c4,0x08810840,0x08000800,0x000018c2,0xee346a87,0xfe73fe74,
-0xfdf1fe32,0xfe33fe32,0x50e0dcef,0x10602040,0x29020000,0xfeb4d5d2,0xf674f694,0xe5f4feb5,0x18203902,0x08001040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x30a10820,0xbc2e3000,0xfed6fef8,0x8babf6d6,0x18c20000,0x10000800,0xa38b3040,0xf655fe76,0xf6b6f6b6,0xf633f675,0xf674fe53,
-0x00008bcc,0x000018c3,0x18200841,0xc44e4060,0xf653feb5,0xfe74fe95,0xf695feb5,0xff16ee53,0x83ccde55,0x08400000,0x08200020,0x10611881,0x00200841,0x00000061,0x8b8b0800,0xfe95edd3,0xfe53f5f2,0xf675fe74,0x00006aea,0x00000861,0x00000000,0x00000000,0x00000000,0x00210000,0x18c30021,0x41220800,0xfeb6d510,0xfed7feb6,0x62caeeb8,0x00000000,0x08000800,0xee346226,
-0xfef7feb5,0x0800940d,0x7b0a0800,0xfe54fe75,0xdd92feb5,0x08001000,0xddf53902,0xd571fed6,0x08003922,0x00000000,0x10001081,0xfe76cd11,0xee13e5b1,0x8b8bff18,0x10810800,0x00200000,0xa42d0800,0xfdf3edb2,0xdd72f5b2,0x10007aa8,0x08200000,0x08000000,0xe676730a,0xee76fef7,0x00005206,0xde573944,0xf676fef8,0xc553ff19,0x08000000,0xff1a836c,0x7ac8ee35,0x00000800,
-0x00000000,0x08000800,0xf6d8acd1,0xf676feb7,0x10208bab,0x08610820,0x00410000,0x08000800,0x00000000,0x00010000,0x00200000,0x00001082,0xf6f8acd1,0xfe74feb6,0xe532fe76,0x4080a2e9,0x08400800,0x10620841,0x00000000,0x10810000,0x08200860,0xa44f20a1,0xfef8feb8,0xfe95feb6,0xfe53fe74,0xfe75fe33,0x48c1e531,0x00401060,0x18620821,0x39850000,0xe5b2c552,0xedd1e5b1,
-0xf5d1e54f,0xedb1edb1,0xa349fe54,0x10602040,0x000018a2,0xee95acae,0xee33ee53,0xee55ee54,0x18205184,0x08201841,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400020,0x28810800,0xcc903820,0xf695fef7,0xa46eff38,0x08820000,0x08001062,0xddd52020,0xf697ff5a,0xf6b7f6b7,0xfeb7f697,0xee55fe96,
-0x3984cdf5,0x08610000,0x08001041,0xdd732840,0xfe95fe96,0xfe34fe14,0xfe75fe75,0xf654fe95,0xf6f8f6b6,0x00009c90,0x00001081,0x08000000,0x08410820,0x39a50000,0xf6d7cdd5,0xfe95fef7,0xfe94fed5,0xfed7fed5,0x00005a67,0x000010a2,0x00000000,0x00000000,0x00000000,0x00200000,0x10810841,0xb4f10000,0xf633fef7,0xf675fe74,0xc5b4f6d8,0x108118c1,0x08000861,0xf655bd11,
-0xe5d2e5b1,0x0800ac8e,0x834b0800,0xf614fe56,0xddb3fe55,0x100051c5,0xe5f44984,0xf675fe95,0x28c2cd53,0x20c30800,0xa4900000,0xfe55ff19,0xe5d1e590,0xfed8edf3,0x00008bcd,0x00002103,0xff186ae9,0xedd2ee14,0xfe54fe33,0x6a87ddd4,0x18c10800,0x41a50000,0xf6b7de56,0xee55feb6,0x00005247,0xde774a26,0xee96eeb6,0xc5b5ff19,0x00000000,0xff3aa4b1,0xee76fef8,0x08006aa9,
-0x084018c2,0xbd722102,0xfed7f6f8,0xfeb6fe95,0x9bedfed7,0x10820800,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000861,0xeed98c0f,0xff19fef8,0xfeb8fed8,0xbcd1fe78,0x00003944,0x08210841,0x18c31082,0x08610841,0x62ea0000,0xffbdde99,0xf6f9ff9c,0xff18ff7b,0xfef8ff19,0xfef8feb7,0xbcd1fef9,0x00201040,0x08411061,0xb5550000,0xfef8ff5b,0xfeb7ff18,
-0xedb2fe54,0xf634e591,0xe5b3feb6,0x000049c5,0x000010a2,0xee7562a7,0xfe75fe95,0xee55feb6,0x10004964,0x080020a2,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x20610820,0xd4d03840,0xedf2f634,0xde35fed6,0x000020a1,0x10620842,0xa4700800,0xff3aff3a,0xff19ff39,0xfef9ff19,0xff19fed8,
-0x2902d615,0x08600000,0x18610020,0xac4f1000,0xf655ee56,0xfe34fe34,0xf654f634,0xf655fe96,0xd5d3fed7,0x0000730a,0x10410820,0x10411041,0x10410820,0x29030000,0xee97acf1,0xe633f6b6,0xee33e633,0xcd92f674,0x000020e1,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x08400820,0x6b090820,0xee75ddf4,0xee75ee34,0x5205c552,0x08201880,0x10401060,0xd59251e5,
-0xfeb6feb6,0x1000cd93,0x9c6f0800,0xee34fed7,0xfed7ee34,0x08006268,0xddd459e6,0xf696ee35,0x4165cd94,0x18a10800,0x62c90000,0xf696d5b3,0xf694ee54,0xee76ff17,0x0800838d,0x080020a2,0xb4d04184,0xf654f696,0xee33ee33,0x9c4ef6b7,0x18600800,0x18601861,0xf6b7a46f,0xf6d7f6b6,0x002062e9,0xde974a26,0xf6f7f718,0xde77f719,0x000020e3,0xeef97b8c,0xf719e677,0x0800acd1,
-0x086020c2,0xb57218c1,0xfef7eeb7,0xe5f3feb6,0xf6b8f676,0x0000732b,0x00001082,0x00000000,0x00000000,0x00000000,0x00000020,0x00000840,0xcdf60800,0xf6b8fef9,0xff3bfef9,0xbd54ff3b,0x00003165,0x00001041,0x106118a2,0x08200820,0x4a070800,0xe6da9c71,0xeef9ef1a,0xff18f6b7,0xfeb7fef8,0xfef8feb7,0xc533ff3b,0x10810800,0x00200861,0xa4d20000,0xfef8ff1a,0xfeb7ff18,
-0xee14f655,0xf696fed6,0xe656ff18,0x00003964,0x00200882,0xde153102,0xfed7feb7,0xfed7fed6,0x100072a8,0x00001040,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000021,0x20600020,0xc46e2800,0xfe73fe54,0xfed7f674,0x00008bcd,0x108210a3,0x10200000,0xff5bd616,0xfef9ff19,0xff18ff18,0xff5aff19,
-0x00007b8c,0x002010c1,0x08610020,0x08000800,0xfef8d5f5,0xfeb6fe95,0xfe96fe96,0xf6d8f697,0x3102b4d0,0x10410800,0x18621000,0x08001000,0x18a21061,0x00000841,0x52680000,0xf759b552,0xf695ff38,0xde14fef7,0x00202902,0x00000020,0x00000000,0x00000000,0x00000000,0x08200000,0x08001062,0x08000000,0x8bed5205,0x83ad8bed,0x10000800,0x20401000,0x080020a1,0x49e70800,
-0xde36c574,0x0820a4d1,0x946f0000,0xeed7f6f8,0xe6b7eed7,0x08205a88,0xc5533102,0xa46feeb8,0x08001820,0x10400800,0x08200000,0xb5524a06,0xad31b551,0x6288c5b4,0x10200800,0x10000800,0x10000800,0xfef9cd74,0xff59ff18,0x0800ad11,0x08001040,0x10000800,0x8bcd0800,0xeef9eeb7,0x00005aa9,0xcdd42902,0xf696ff18,0xde35fef8,0x000028e1,0xef5c62ea,0xb533ef1b,0x106120a1,
-0x00000000,0x08001061,0xff39942e,0xee96ff59,0xc573eeb7,0x00002923,0x00410842,0x00000000,0x00000000,0x00000000,0x00000000,0x08200840,0xc5950800,0xee98f6f9,0xcdd6eed9,0x002062ea,0x08400000,0x10811081,0x10000800,0x28804102,0x08001820,0x31a50000,0xee96a4d0,0xfe74f695,0xfe95f633,0xee15f654,0x1800cd53,0x08610000,0x08400000,0x08000020,0xf6d6c5b2,0xee13d570,
-0xff39fed7,0xff38ff18,0x7b4bf718,0x10610000,0x00000861,0xee973962,0xf635fef8,0xfef8f696,0x080072c9,0x00001020,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20a20021,0xbc4e2000,0xee33fe95,0xee95ee33,0x20c1d636,0x08410000,0x000018a2,0xf71a838c,0xfef9f6d9,0xf6f8ff18,0xcdf5ff5a,
-0x00000800,0x08610860,0x00000861,0x000018c3,0xee97730a,0xfe95ee54,0xfed7f634,0x83ace636,0x08000800,0x206128a2,0x20202882,0x49a52861,0x08001020,0x10811881,0x000018c2,0x8bee0000,0xee96de55,0xd5f4f696,0x00000820,0x00000841,0x00000000,0x00000000,0x00000000,0x10410020,0x8bae1000,0x080083ce,0x08000800,0x08000800,0x10001020,0xcd524963,0x62a9cdd5,0x00000000,
-0x396420a2,0x00002922,0x29230000,0x52455226,0x4a255245,0x00002943,0x49c60820,0x080051e6,0x18400800,0xbd7393ee,0x000041c5,0x08200000,0x00200000,0x08000800,0x20600800,0xac70b4d1,0x08001801,0xd5f61840,0xa511f75a,0x08000000,0xacd11020,0x10008bad,0x08001860,0x8c0e732b,0x08202924,0x6aa91880,0x8b8b8b8b,0x7b4a93ec,0x08000800,0x7bce2944,0x10617bae,0x00000820,
-0x7bae6aeb,0x08000000,0x940e0800,0xb531bd73,0x3964acf1,0x08200800,0x00000000,0x00000021,0x00000000,0x00000000,0x00000000,0x08200841,0xd6160800,0xf719ff1a,0x0000a4b0,0x08600000,0x10400840,0x08000800,0x93cc72e9,0x30404902,0x206030a1,0x000018c2,0x7b490000,0xfe74ee54,0xf633edf1,0xee35ee13,0x080072a9,0x002010a2,0x00001081,0x00001081,0xe6745a66,0xfef6f695,
-0xf6f8fef7,0xf75af718,0x0000a511,0x08411061,0x000010c1,0xf719acf0,0xfeb8ee77,0xeeb7ff18,0x08004984,0x00001861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400020,0xc4f12020,0xf6b5ff38,0xf6d7f6d6,0x944ff719,0x10a10000,0x08200860,0xcdb50800,0xff19ff3b,0xf719f6f8,0x5268e6b7,
-0x18a20000,0x00000820,0x08610020,0x08610000,0xbd520800,0xf695fef7,0xd5f4fef6,0x000041a4,0x18811081,0x30802860,0x82673820,0xee56c4d0,0x49a3bcd0,0x08000800,0x10611061,0x08001040,0xd5b33922,0xcd93f6b7,0x08610000,0x00000840,0x00000000,0x00000000,0x00000000,0x10810041,0xbd331000,0xa490ff3b,0x6aa96288,0x20c35248,0x49e60800,0xff5ade56,0xf6faff3a,0x08007b4c,
-0x08000800,0x00000000,0x00000860,0x08000800,0x00000800,0x08400000,0x08000820,0x08000800,0xb51228e2,0xff3aff19,0x62cad616,0x18810800,0x08000000,0x10000800,0xcd7330a1,0xff19ff3a,0x0800940f,0xb5120800,0x4205ffbc,0x28e20020,0xee76b510,0x93edee96,0x08000800,0x08001000,0x00000000,0x08000800,0x10000800,0x08000800,0x00200840,0x00000000,0x08000800,0x732a0800,
-0xff5be6b8,0x1000940e,0x00001061,0x08000800,0x08000800,0x5a480800,0x080020c2,0x00000821,0x00000000,0x00000000,0x00000000,0x00000841,0xd6360800,0xe696f718,0x08003943,0x106110a1,0x20400800,0xb5126a88,0xfef9f6f9,0x8b2ad573,0x18003860,0x18811840,0x080018a1,0xff199c2e,0xf6f7f6d7,0xb4f1fef9,0x10810800,0x00800020,0x10800000,0x10810820,0xa4f10000,0xff19ff9c,
-0xff9bff7a,0xd677ffbb,0x00002943,0x10611061,0x5b090000,0xf719ef19,0xff5aff3a,0xe697ff5a,0x10004144,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200021,0xa42f1840,0xaccfbd11,0xa48fa46e,0x7b8d9c4f,0x00200000,0x10810840,0x52280800,0x940e940f,0x944e942e,0x00006b2a,
-0x10411062,0x41e60800,0x00004a27,0x10810881,0x730a0000,0xf6b5f6d7,0xacd0ff18,0x21030000,0x28e20840,0x722538a0,0xfe75cccf,0xfe96fed7,0xee76fed7,0x102093ac,0x10610800,0x20a11020,0xbd110800,0xc593fef8,0x00210000,0x00000020,0x00000000,0x00000000,0x00000000,0x10600040,0xac6f2060,0xffbdff7c,0xff9cff9c,0x39a6e6da,0x6b2b0000,0xff7bff7b,0xff9cff7b,0x9c50ff5b,
-0x7bad730b,0x0840734c,0x31650000,0x730a62ca,0x5a8962c9,0x00002924,0x49e60800,0x52275268,0xff9ccdd5,0xff19ff5a,0xbd95ff9c,0x00000000,0x9c4f5a89,0xac90b4d1,0xfed8d5d5,0xfef8f6b7,0x0800bd73,0x8c0e0800,0x5aeaf79c,0x62ca0000,0xe675ff5a,0xff59e696,0x28e2acf1,0x20a328a2,0x00010800,0x20a20821,0x392328a1,0x28e34184,0x00200000,0x316418a2,0x20603103,0xe6b78bcd,
-0xf6f9eed8,0x732bf71a,0x20c30000,0x10211042,0x08001020,0xcdd5a470,0x080020c1,0x00001021,0x00000000,0x00000000,0x00000000,0x00000841,0xd65620e2,0xe676f718,0x080041a4,0x000010a1,0xc55351c6,0xff9bff19,0xff3aff3a,0xff19ff19,0x7267d511,0x000028a1,0x000018a2,0xff3a7b4b,0xf739f719,0x3123e698,0x10810000,0x00000060,0x00002943,0x10411041,0x41e60000,0x9c709450,
-0x840d8c2e,0x5ac99cd0,0x10820000,0x10410800,0x73ac0000,0xbd74ad32,0xbd53bd74,0xde57eed9,0x08002081,0x00201041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x10002081,0x08000800,0x08000800,0x08000800,0x00200840,0x00000020,0x00000861,0x08000800,0x08000800,0x10610800,
-0x18410801,0xbd331000,0x0800d5f6,0x10610000,0x08000840,0xf6f7c572,0xa4b0f6f8,0x18a20000,0x10000821,0xedf39bab,0xf655fe95,0xf696ee55,0xfeb7feb7,0xc594f6d8,0x000041e7,0x10401041,0xbd530800,0xcdd5ff1a,0x00000000,0x00000841,0x00000000,0x00000000,0x00000000,0x10810041,0xbcf11800,0xce16ff5b,0xce16c5d5,0x2964bdb5,0x39a60000,0xde37bd74,0xd636d616,0xce16d657,
-0xf75bc5d5,0x2102d678,0x83ae0000,0xf6faff3b,0xf71bf71a,0x080083ce,0xbd540800,0xf77cf77c,0xef19ef3a,0xeed7eed8,0xa4b2f71a,0x00000000,0xd657736d,0xff19e6b8,0xeeb7ff5a,0xff59fef7,0x0000c5d4,0x83ce0000,0x5a69ef1b,0x49a60800,0xeed8eed9,0xff59eef8,0xe6b7ff7a,0xcdd6e698,0x08005a89,0xc5543104,0xddf5e615,0xd5f6e636,0x080049e7,0xde567b6b,0xe656e676,0xeeb7ff19,
-0xf719f739,0x7b6cff9c,0x00000000,0xde77ad12,0xde56ce15,0xd5f5ff39,0x10401840,0x00001040,0x00000000,0x00000000,0x00000000,0x00000841,0xc5f520c2,0xe697f739,0x080041a4,0x08001882,0xff5993ed,0xfed7ff18,0xf697f6b8,0xfed8feb8,0xf697ff19,0x00005a47,0x000010a2,0xf71a734b,0xf719f73a,0x08009c4f,0x18622082,0x6aea0000,0x49a5d616,0x10410800,0x08001040,0x00000000,
-0x00200000,0x00000000,0x00001061,0x10001001,0x00001060,0x00000800,0x00000000,0xbd546b0b,0x08003944,0x00000820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000000,0x10811081,0x20a31882,0x188220a3,0x08601060,0x00400860,0x10830000,0x18821082,0x20e32903,0x186120a2,
-0x100028a2,0xf6b87b0a,0x83aceed8,0x10820800,0x00001082,0xb4f05a47,0xb532f73a,0x18a30000,0x08001082,0xfef6d592,0xf695fe95,0xfef9ff19,0xfef8fed7,0xff9bf6b7,0x0000a4d2,0x106120c3,0xc5d50800,0xc594ff7b,0x00200000,0x00000020,0x00000000,0x00000000,0x00000000,0x10400020,0xbd531000,0x0800bd74,0x08000800,0x08400000,0x00000020,0x18400800,0x20a128a1,0x00000000,
-0xad120800,0x18a1de98,0x8c0f0800,0xf6b9ff5c,0xff5cff3b,0x08009450,0xce1620a1,0x7b8dd657,0x5a88630a,0x62665a46,0x31445226,0x00000000,0x396420c3,0x626741a4,0xf6f9c573,0xf738ee96,0x0000bd94,0x39a60820,0x28c35a69,0x18620800,0x732b730b,0x944e7b8c,0xc5d4a4cf,0xf71ad657,0x08007b8d,0xeeb85a48,0xfed7fef8,0xf6faff1a,0x08006aeb,0xff7a940d,0xf6b8f6d8,0xd636d616,
-0xbd94c594,0x5248b574,0x10810000,0xb5328c0e,0xc5b3bd72,0xc593f6f8,0x08201840,0x00000841,0x00000000,0x00000000,0x00000000,0x00000841,0x41e50000,0xe6d9bd93,0x08002903,0x00001882,0xf7188bed,0xfef8f6d8,0xfed8fef9,0xfeb8feb8,0xfef8fed8,0x000062a9,0x002018e2,0xef1b630b,0x7b6cde77,0x10200800,0x08001021,0xd6373945,0xc573ff7b,0x20411820,0x10401820,0x20e320c3,
-0x10c210c2,0x18a21081,0x10210800,0x10001021,0x18411040,0x18822082,0x08611082,0x41c60000,0x080020a2,0x00000820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x08200841,0x08001041,0x08000800,0x00000800,0x08610000,0x00220001,0x00000821,0x08000800,0x10001000,
-0x28601000,0xff19e5f5,0xde98f719,0x00001881,0x10620821,0x08000800,0x7b8c840e,0x10820000,0x08001061,0xfed5cd50,0xf6b6feb6,0xfef9f6d9,0xfeb7fed8,0xfef8fed7,0x0020a4d1,0x00001061,0xbd950000,0x39a5ad12,0x00210020,0x00000841,0x00000000,0x00000000,0x00000000,0x08200000,0x6b0b1020,0x00002904,0x08000800,0x00000800,0x08201061,0x08000800,0x00000800,0x10a20000,
-0x8c4f0000,0x2923ef3b,0x41c60000,0xff5bd617,0xd657ff5b,0x08003164,0xce170800,0x000083ce,0x08000820,0x10001000,0x08001000,0x08410841,0x08000800,0x08000800,0xa44f1000,0xbd52e635,0x00002903,0x00000000,0x00000800,0x00000801,0x08000800,0x08000800,0x08000800,0xce370000,0x08006b2b,0xcdf63964,0xe676f718,0xd616f719,0x08003985,0xe6d88c0e,0x08005a47,0x00000800,
-0x00000800,0x00000000,0x08200841,0x08000000,0x10000800,0xb5127b4b,0x08201060,0x00200020,0x00000000,0x00000000,0x00000000,0x00200000,0x00000061,0x5aa90020,0x00003125,0x000018a3,0xff9c83ad,0xf6d9f6fa,0xff39ff19,0xff39ff59,0xf6b8ff3a,0x080051e7,0x00001861,0x7bce528a,0x00200000,0x10411041,0x000018a3,0xff5c6aeb,0xff1aff5a,0x1800938d,0x10002020,0x10001000,
-0x00200000,0x00000020,0x08210000,0x08000800,0x10001000,0x08001000,0x08610820,0x00001081,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08200021,0x30e21840,0x41a449c5,0x41a441a4,0x000018a1,0x00420041,0x31450000,0x836b7b4c,0x8b6a8329,
-0xb48f7ac8,0xee96fed7,0x944eeef8,0x08620000,0x10410821,0x10801061,0x00200000,0x00001061,0x08000861,0xfeb5bd30,0xf697ee75,0xee57f6b8,0xfe55f635,0xee97f655,0x00008bee,0x082018a2,0x31650861,0x00000820,0x00210021,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08001020,0x08001041,0xa44f51e7,0x49e69c0e,0x18810000,0x940f730b,0x9450a490,0x108162eb,
-0x8c2f0000,0x7bacf73b,0x08000800,0xd6173923,0x28e2c5b5,0x08000000,0xe6996ac9,0x0820734c,0x314420e3,0x51a44963,0x39235a06,0x00000000,0x5a673964,0x18606aea,0x41840800,0x3102a46f,0x08000000,0x49e641e6,0x00002902,0x08001041,0x10201020,0x08001020,0x18a11040,0xd6570000,0x0000ad32,0x31640000,0xf75abdb3,0x3984c5d5,0x00000000,0xd657c5b5,0x08001000,0x00000000,
-0x08000800,0x00000800,0x08000840,0x18410000,0x10001800,0x31230800,0x00001061,0x00000841,0x00000000,0x00000000,0x00200000,0x00200000,0x10a20020,0x00000861,0x00000000,0x00001083,0xf71a83cd,0xff3aff1a,0xf6d7fef9,0xddd3ee35,0xe657ee97,0x100049a5,0x10411882,0x00000000,0x18c20040,0x08211041,0x10820841,0xad130000,0xff3aff7b,0x6a07ee37,0x30c12880,0x28813061,
-0x08402082,0x00200000,0x00000841,0x31031020,0x40e23902,0x30a24923,0x08201820,0x10820000,0x08200800,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08200000,0x10001061,0xe6145a05,0xe676ee97,0xe677e676,0x5248d636,0x10a20000,0x31640000,0xff19e677,0xfef7fed7,
-0xf6b7f6b6,0xf718f6d7,0x0840c5f4,0x10610020,0x08001021,0x10a10000,0x088110a1,0x00200000,0x00000881,0xff38cdb3,0xfed8ff19,0xfeb8f6b8,0xfeb7fed7,0xff7af6b7,0x00008c2f,0x002018c2,0x00000020,0x10401040,0x00210000,0x00000020,0x00000000,0x00000000,0x00000000,0x08000000,0x18610800,0x30e20800,0xff38ddb3,0x836bff39,0x20c10800,0xff5ad5d5,0xff5aff59,0x0800c5d5,
-0x942e0800,0xeed8ff5a,0x08008bcd,0x28e30800,0x00002904,0x6aca0800,0xf71aeeb9,0x0000734c,0xc5742903,0xe676f6d8,0x9c2fee97,0x08000800,0xf6b7ac8e,0xacd0f6f8,0x08000800,0x18600000,0x83cd0800,0xee98ee98,0x736cde78,0x42070000,0xd5f3cdb3,0xcdb3d5b3,0x08007b6b,0xce360800,0x83ccff9b,0x00000000,0x94d120e2,0x000039c6,0xad130000,0xd616f75b,0x08002040,0xbd537b4b,
-0xbd12bcf1,0x4a06b533,0x39a50800,0xd616b533,0x3903c574,0x08000800,0x08000000,0x08200000,0x00000000,0x00000000,0x00200000,0x00200000,0x00000000,0x10611081,0x00000841,0x000010a3,0xeeb77b6b,0xf6b7e656,0xee56fef8,0xee96e635,0xe677ff39,0x08004184,0x00001061,0x10810000,0x000010a1,0x08001000,0x10610820,0x39a50020,0xff3ae6b8,0xf698ff1a,0xe656e656,0xe657e656,
-0x0000940f,0x08611081,0x42070000,0xe657cdf6,0xf656ee36,0xb490ee36,0x18202840,0x00000820,0x08410800,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400020,0x10200020,0x20201000,0xff59cd72,0xff39ff39,0xff19ff39,0xc594ff5b,0x10810000,0x000010a1,0xff5aa46f,0xf6b6ff18,
-0xf6f7fef7,0xf75aff59,0x0000736b,0x082018c2,0x5a291000,0x00002904,0x086010a1,0x00200000,0x00200881,0xff3ab512,0xf6b8fef8,0xfed8fef9,0xfef8f697,0xeef9ff3a,0x0000734c,0x00001082,0x10820000,0x18601881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08200800,0xbd320800,0xee54feb6,0x940de656,0x20a10000,0xee35c552,0xf6b6ee34,0x0800ce15,
-0x8bed0800,0xf6f8ff19,0x8bceeed8,0x00000800,0x00000000,0xde576b0b,0xf6b8fef9,0x0800730b,0xe6574185,0xff19ff59,0x9c6ffef9,0x08000800,0xfed7bcf0,0xff5aee96,0x00008bef,0x00002103,0xff3b7b6c,0xff3aff1b,0x942fff7b,0x5ac90000,0xf6f7eed7,0xff18f6b6,0x0000b4f1,0xce570000,0xeef9f77b,0x000083ce,0x00000840,0x00000000,0xff5bacf2,0xc5b4ff5a,0x10001000,0xff7bb512,
-0xff3aff5a,0x62a9ff3b,0x52470800,0xff5af71a,0xcd94ff5a,0x00002903,0x08001062,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x20e318a3,0x10200800,0x00001041,0x00001082,0xe6975a88,0xfef9ff5a,0xff19fef8,0xff39ff19,0xe698ff7b,0x000041c5,0x00000861,0x084010a2,0x41a50820,0x72ebacb2,0x10210800,0x000018a2,0xf71a8bce,0xff5bf6f9,0xff79ff39,0xf6faff5a,
-0x080062a9,0x10a11081,0xa5130000,0xfef9ff5b,0xff19fef8,0xfe77fef9,0x180082a8,0x08211841,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18400840,0x72881800,0xff39fed8,0xf73aff19,0xff3aff3a,0xf6f9ff5a,0x08205a88,0x080010a1,0xe6783923,0xf6f9ff5b,
-0xfef8fef8,0xbdb4f739,0x10600000,0x08001061,0xee3838a3,0x6b2be699,0x00200000,0x00200820,0x00000841,0xb51241a6,0xff5af71a,0xff39f6f8,0xff3aff7b,0x6b0bd657,0x00200841,0x00000020,0x10211062,0x08000800,0x00001062,0x00200000,0x00000000,0x00000000,0x00000000,0x00200020,0x10810841,0x9cd10000,0xff39ff39,0x942fff3a,0x10600000,0xfef7c593,0xfef7ee75,0x0800de56,
-0x940e0800,0xeeb6f6f8,0xcdd4ff39,0x18c20000,0x002010c2,0xf6f8cdf5,0xf6b8f697,0x08006ac9,0xee774964,0xff18ff39,0xacb1ff3a,0x08000800,0xff39bd11,0xde98f719,0x00005aaa,0x00000840,0xf6fa62ca,0xff1aff1b,0x7b8cff5b,0x42060800,0xeed8de98,0xff3bf6f9,0x0800acd1,0xc5f70000,0xf71aff7c,0x5228f71b,0x21030820,0x940f0800,0xfef9f6fa,0xb511ff18,0x08000800,0xff199c4f,
-0xf6b8ee97,0x62caf6f9,0x41c60000,0xff3ae6b9,0xf71aff5a,0x000062aa,0x00200861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0xbd743145,0x20609c0e,0x18610800,0x08400000,0x4a070800,0xffbdbd95,0xff18ff3a,0xff18fef8,0x5289bd94,0x08410000,0x08400020,0x08000000,0xeeb983ad,0xcd95ff3b,0x18212881,0x08610841,0xc5b50800,0xf6f9ff5b,0xf697fed8,0xc574ff3a,
-0x10410800,0x00201061,0xe6b95248,0xfed8ff3b,0xf6b7fed8,0xfeb8fef9,0x4881dd32,0x10211000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18400840,0xcd332000,0xfed8ff3a,0xff19ff19,0xff19ff19,0xff5afef8,0x0000bd73,0x18a20861,0x93ee0800,0xff1aff3a,
-0xff19fef9,0x5a88f73a,0x18a10800,0x20401020,0xff3cbc92,0xf75bff9c,0x3185a4f2,0x08410000,0x08410001,0x08000000,0xc5d462a9,0xf71aeef9,0x7badd657,0x00000000,0x00000821,0x08410000,0x10000800,0x940f834c,0x00210000,0x00000841,0x00000000,0x00000000,0x00000000,0x00200020,0x00000800,0x08200020,0xeed9942f,0x940fff3b,0x08000000,0xf739c5b4,0xff39eed7,0x1000cdf5,
-0x7b6b0800,0xf6f8f6d8,0x2901d5f4,0x00000800,0x00000020,0xeed85a88,0xc572eeb7,0x08005a68,0xcd733923,0xe635e656,0x9c50e678,0x00000000,0xeeb8b512,0x4a07d616,0x00000000,0x10602903,0x62ca0800,0xff3bf6fb,0x6b0aff7c,0x5aa90000,0xff9cef1a,0xffbdff3b,0x0800b513,0xd6790000,0xff7cffbd,0x20c3b534,0x08000000,0x5a690000,0xff19e657,0xbd73ff9b,0x08000800,0xff3aad12,
-0xff39f719,0x6b2bf71a,0x4a070000,0xff5bf6fa,0x83eee6b9,0x10810000,0x00000861,0x00000020,0x00000000,0x00000000,0x00000000,0x00000862,0xe6991861,0xd5d5ff7c,0x08006268,0x00201081,0x08200841,0x7b8d0000,0xff5ae699,0x7b4aeeb7,0x00000000,0x00000882,0x00000861,0xbd9539c6,0xff5cff5c,0xff3bff3b,0x10009bce,0x10a21882,0x62a90000,0xff3af73b,0xf697f6b7,0x6289fefa,
-0x18a30000,0x00000000,0xff7ccdf6,0xff19f6d9,0xff3aff19,0xff19fef9,0xb40efed9,0x10202840,0x00000821,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08001081,0xfed97aca,0xf6d7feb8,0xff18fed7,0xff38fef7,0xf6f8ff38,0x5ac9f75a,0x10a20000,0x10201040,0xff39cdb3,
-0xff3af6f8,0x00009c91,0x186018a1,0x72c91000,0xff5bf6d9,0xf77bff5b,0xa4f3ffdd,0x10830000,0x08000800,0x18811882,0x08000800,0x8c0f7bcd,0x00000000,0x10810000,0x00000840,0x00001062,0xddf672ea,0xde37ff5b,0x00000800,0x00000041,0x00000000,0x00000000,0x00000000,0x00000020,0x41652061,0x00001020,0x83ad0800,0x942ff71b,0x18810000,0x736c5288,0x736c734b,0x104162aa,
-0x41c60000,0x83ad734b,0x00003164,0x834b0800,0x00006ae9,0x5ac90820,0x948f9cd1,0x00004206,0x83ad20a1,0x8bcd8bed,0x62aa940f,0x00000800,0xd637c595,0x08001860,0x5a680800,0x7b8ed638,0x08000000,0xf73b7b8d,0x630aff9c,0x4a470000,0xc615bdd4,0xd638bdd5,0x00008bef,0xb5540000,0xb554e6b9,0x00000000,0x39651020,0x00000000,0xd6176acb,0x9470d658,0x00000800,0xce5783ef,
-0xd656d656,0x5aa9deb8,0x4a270000,0xff7de6da,0x000083cf,0x00000820,0x08400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000861,0xde782924,0xffbdff3c,0x0000a4b1,0x002018c1,0x18a30820,0x08001041,0x94703986,0x000062ea,0x18c20860,0x00000841,0x00001082,0xff9d736d,0xf71bff3c,0xff3bff3b,0x51a5f677,0x10610800,0x00001081,0xf73aa491,0xff9af718,0x0800b4f1,
-0x10a21061,0x8bee0000,0xf719ff5a,0xff3aff19,0xff1aff1a,0xff3aff1a,0xfef8ff18,0x00006aa9,0x00001082,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x000010a2,0xfed993ce,0xfef8f697,0xf695feb7,0xee75f675,0xeed7f6b6,0x20e2cdf5,0x10610000,0x10201040,0xfef8cd52,
-0xd636f6f8,0x080020c2,0x18601060,0xc4f22040,0xff7bff3a,0xf73aff9b,0xb533ffdd,0x18c30000,0x08000821,0x00200000,0x084020e2,0x00000000,0x10820000,0x002018a2,0x00000000,0x080020e4,0xffbcac90,0xd637ff5b,0x000020e3,0x00000841,0x00000000,0x00000000,0x00000000,0x08200841,0xc5541800,0x0800acb1,0x20a20800,0xacd1eefb,0x08000800,0x00000820,0x08000000,0x08000000,
-0x00000841,0x00000820,0x08000000,0xee768b6b,0x5226de15,0x00000000,0x00000000,0x08200800,0x08000820,0x08000800,0x08000800,0x00001861,0x8beecdd6,0x08000800,0xf6d97b4b,0xf73cff3c,0x0000734d,0xad120800,0x6b2aff9c,0x20c10000,0x08401080,0x18a20840,0x10400820,0x10400000,0x102028e3,0x00000840,0xe6baa471,0x00006b2c,0x29040000,0x000020e2,0x08210000,0x08400840,
-0x210118c1,0x18c13163,0x41c50800,0x9430e699,0x08400000,0x732b28e2,0x000028e3,0x00000861,0x00000000,0x00000000,0x00000000,0x00000861,0xe69941c6,0xff5cff5c,0x08009c70,0x08601081,0x00000000,0x18611882,0x00000000,0x08610000,0x000018a1,0x08410000,0x00001082,0xff5c6b0b,0xff5cff5c,0xff3aff5c,0xbcf1ff7a,0x10201800,0x00001881,0xd6570800,0xf718ff59,0x100093cd,
-0x10a218a2,0x8c2f0000,0xff18f719,0xff19f6f8,0xff1af6f9,0xee77fed9,0xeed8f6b7,0x00004a26,0x00200861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08410020,0xcd940800,0xfef9ff1a,0xfeb6fed7,0xf675feb6,0xee97f6b7,0x08006288,0x18811081,0x7b2a1000,0xf696ee56,
-0x732be6b8,0x10610000,0x08001881,0xfe987288,0xe677f697,0xff9bf719,0xad33ffbc,0x10a30800,0x08610000,0x000041e7,0x10a20000,0x108210a2,0x184020c2,0x08000800,0x000020c2,0x08001062,0xde1593cd,0xde57ee98,0x00000800,0x00001081,0x00000000,0x00000000,0x00000000,0x10610841,0xddd52840,0x5a69ffbe,0x29040800,0xcdf5e6da,0x628849e5,0x414351e5,0x28c13922,0x08201040,
-0x10410820,0x20c20800,0x49c50800,0xfeb6f656,0xddd4f696,0x08003923,0x08000800,0x10000800,0x10001000,0x18201840,0x18001800,0x28c20800,0x83eee6b9,0x10200000,0xf719cdf5,0xf6b8f6d8,0x20e2d617,0x7bad0000,0x83acff9c,0x08000800,0x08000800,0x00000800,0x08400000,0x08001061,0x08000800,0x94700800,0xf73bff9d,0x00007bad,0x08002082,0x00000800,0x08400840,0x00000000,
-0x00000000,0x08000000,0x52260800,0x5a68e6b8,0x08000800,0xcd74ac70,0x10202040,0x00200020,0x00000000,0x00000000,0x00000000,0x00000861,0xeefa41a5,0xff9df73b,0x0000a491,0x000018c2,0x28e220c2,0x10200800,0x108118a2,0x000018c3,0x41e60800,0x08003144,0x00001061,0xf73b62ea,0xf73bf73b,0xff5aff3b,0xff18ff79,0x18007288,0x18a21841,0x73ad0000,0xff39f739,0x2860e5d5,
-0x10820800,0x08000000,0xff18c593,0xf696f6d7,0xf6f8f6f7,0xee98f6b8,0x8bcdf6d9,0x10a20800,0x00200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08610000,0x10820021,0x52470800,0xff3af6fa,0xfef8fed8,0xfed7fed7,0xbd33ff39,0x10810800,0x08001041,0xd5f51860,0xff19fef9,
-0x0000a4b1,0x08201882,0x10201040,0xfef9d573,0xfef8ee77,0xe677e697,0xacf2ff3a,0x18a30000,0x00000840,0xb575bdb6,0x00004207,0x20c20800,0x18201000,0xbd5372e9,0x000062c9,0x080018c3,0xff19a44f,0xd616ff3a,0x08200800,0x00200000,0x00000000,0x00000000,0x00000000,0x08410041,0xbd131800,0x5a8aeefa,0x08200000,0xff9cce37,0xf71aef19,0xe637f6d9,0xde57de16,0x0800b533,
-0x6b2b0000,0x736cd658,0x52060800,0xe5d2ddd3,0xff3aee75,0xacd3e658,0xb535bd55,0x08005249,0xc5753945,0xe637de37,0xcd95ddf6,0xde78cdd6,0x9450ef3b,0x18610000,0xf6f8d656,0xf719ff19,0x3144de57,0x8c0e0800,0xde98ff7c,0xbd54c5b5,0xacd2acb2,0xb554acf3,0x00006b6c,0x732c0000,0x7b2b8bcd,0xff5ba4b1,0x8beef71b,0x08000800,0x9c5028e3,0x6b4aa4d0,0x00000000,0xbdb58c0f,
-0xa512a513,0xa4b0ad32,0xde77ad11,0x5207f71a,0x39640800,0xcd94e657,0x08001820,0x00000861,0x00000000,0x00000000,0x00000000,0x00000861,0xde7841c5,0xff7cf6fa,0x00009cb1,0x000018e3,0xd5f65a69,0x1840836c,0x10400800,0x08200000,0xde588bee,0x080062a9,0x080018a2,0xf75b62ca,0xff7bf73a,0xf719ff3a,0xeed7f738,0x2000c4f2,0x00001841,0x000010a3,0xff3ab532,0xa40fff1a,
-0x18820800,0x000018a2,0xeeb75226,0xf6d7fef8,0xeeb7f718,0xff9cf6f8,0x1000d5f6,0x00410000,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000021,0x000018c2,0xff7c9cb1,0xff19f719,0xff19fef8,0x41e6e697,0x10820000,0x00001061,0xff7b9c50,0xe677ff3a,
-0x00003985,0x18821862,0x732b0000,0xff1aff1b,0xff39ff3a,0xeed8f719,0xad13ff7b,0x18c30800,0x00000881,0xff9cc5d5,0x9c70e6b9,0x180028a2,0xbcd16a27,0xf6f9f6d8,0x00005247,0x080018c2,0xff5aacb0,0xc5d5eed9,0x00000820,0x00000840,0x00000000,0x00000000,0x00000000,0x00200021,0x28e30000,0x21243185,0x00000000,0x4a6731a5,0x5a68630a,0xff7ccd95,0xff5bf6d9,0x0820deb9,
-0x83ed0000,0x9cb1ffbc,0x49e60800,0xf718e676,0xf73af718,0xd638de78,0xbdd7d659,0x0000526a,0xeef94a27,0xfef8ff39,0xff5aff19,0xad34c5b5,0x4a6994b2,0x08000000,0xa4d0838c,0xa4d2a490,0x18c183ee,0x62ca0000,0xad54a513,0xe6b9bd95,0xf719ff3a,0xff7bff3a,0x0800a4d2,0xbdb50000,0xeed8ff7b,0xf6faff9c,0x0800940f,0x08000800,0xff3cbd54,0xad12f75b,0x00000000,0xff9cbd74,
-0xff7df77c,0xff5cff7c,0xde58d637,0x49a6c595,0x29440820,0xc594ce16,0x08001840,0x00000820,0x00000000,0x00000000,0x00000000,0x00000861,0xde573984,0xff7bf73a,0x00009cb1,0x000018e4,0xf73b5a89,0xc553ff5b,0x206051c5,0xcdd56268,0xf73bff5b,0x08205a68,0x000018a2,0xe6da5a89,0xf75aef3a,0xff3aff7b,0xf75af77a,0x7b0bff1a,0x10a20000,0x00001083,0xeeda41c6,0xeed9ff7c,
-0x08005a27,0x10c20840,0x8bcd0000,0xff7bff9b,0xff9cff7b,0xff5bff7b,0x08006aea,0x08201061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x00200860,0xad543165,0xcdf5d637,0xd636cdf5,0x00009450,0x004010a2,0x00001081,0xb4f2942f,0x83cdb532,
-0x10820000,0x10610000,0x83ee0000,0xc574bd54,0xc593c573,0xb552bd52,0x734cbd73,0x10820000,0x00200040,0xff5bce16,0xff7cff1a,0xbcf2d5d6,0xff3af698,0xeed8ff19,0x00204227,0x000018c2,0xff7ba490,0xce16eefa,0x00000000,0x00001061,0x00000000,0x00000000,0x00000000,0x00000021,0x08001020,0x00000000,0x08200820,0x00000820,0x08200000,0xbd550800,0xf73bff5c,0x00008c0f,
-0x7b8c0800,0x9cb0ffdd,0x10600800,0xffdc9cb0,0xb553f77b,0x08001860,0x08000000,0x00001882,0xe6d84a27,0xeeb7eed7,0x7b8beed7,0x00000800,0x00000000,0x10001021,0x08000800,0x00000820,0x08200800,0x00001040,0x00000800,0x5a680800,0xff19de57,0xff9beeb7,0x0800b533,0xd6570000,0xf6f8ff5a,0xde78ff7b,0x080020c2,0xc5b441c4,0xf71bff9c,0xb553ff9c,0x00000000,0xf75bc5f6,
-0xff7df71b,0x5a89de59,0x10000800,0x10402081,0x00200000,0x316441e5,0x10410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000861,0xde773164,0xff9cff5b,0x0000a4d1,0x000018e3,0xe6d939c6,0xff3aff7b,0xddf5f697,0xf6f9f6b8,0xf71aff3b,0x08005a88,0x00200861,0x41e62924,0x734b5aa9,0x6b0a6b0b,0x7b8c7b8c,0x5a68836c,0x08620000,0x10420000,0x732c0800,0x9c709c91,
-0x08005a28,0x08601081,0x00000840,0xd6369c6f,0xc5b5c5b5,0xa4d2cdf6,0x10400800,0x08201041,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00200020,0x10000800,0x10621021,0x08600000,0x00000000,0x08000000,0x00000800,0x00410000,0x00200000,0x08400020,0x08000000,0x00000000,
-0x00000861,0x00000841,0x00000061,0x00000000,0x00000000,0x00000000,0x00000000,0x00200040,0x00000882,0xf6fa9450,0xf73bff7c,0xffbcf71a,0xff7bff7b,0xe6f9ff5a,0x00004206,0x000018c3,0xb53249e6,0xde99ff9c,0x00000000,0x00000820,0x00000000,0x00000000,0x00000000,0x08000021,0x51861800,0x20825a28,0x18400800,0x6ac95a26,0x00004a07,0x00000800,0x8c30bdb7,0x08000800,
-0xcd9528a1,0xc5b4f6fa,0x08001881,0x94510800,0x0000ad34,0x10000800,0x08000800,0x10410800,0x944f0000,0xeed8f71a,0x08208bed,0x000018a2,0x00000000,0x10200800,0x08000800,0x00000000,0x10000800,0x10010800,0x10000800,0x08000800,0xd61549e5,0xf6b8ff19,0x0000732b,0x94b10000,0xf6f9f73a,0xcdf6eef9,0x00003144,0xff5aa46f,0xe6b9ef1a,0xa4d1ff9b,0x08000800,0xf73b83ee,
-0xcdd7f71b,0x08003965,0x08000800,0x08000800,0x00200861,0x00000000,0x08201041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000861,0xe6d93184,0x9cb1f75b,0x000041c6,0x00001061,0xe6da39a6,0xf6d8ff3a,0xfef9ff39,0xff3bfed9,0xacb1ee99,0x000020c2,0x00000861,0x00000000,0x08000000,0x00200000,0x00000000,0x08000800,0x00001061,0x08000801,0x00001041,0x00000000,
-0x08200800,0x00000000,0x08610000,0x00000020,0x00000000,0x00000000,0x08010820,0x00000821,0x08001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x28820800,0x08002041,0x086018a1,0x18a11081,0x08401081,0x00000000,0x00200881,0x08410000,0x10401881,0x18a218a2,0x10811081,
-0x00200020,0x10810000,0x108110a1,0x18a218c3,0x10a118c2,0x18c118c1,0x106018c2,0x00200000,0x08200020,0x52270000,0xf73bad12,0xf71aff5b,0xff19f719,0xf75aff5a,0x0000630a,0x18821883,0x00000800,0x7bce62ea,0x00001082,0x00000821,0x00000000,0x00000000,0x00000000,0x08200041,0xdd953060,0x5a28f6ba,0x30e30800,0xff7be637,0x62aaeed9,0x10830000,0x00000000,0x18600000,
-0xff7cd5b6,0xff1afef9,0x3144d617,0x00000000,0x00000000,0x8bad1840,0x942ea46f,0x10208c0f,0x00000000,0x8c0e9c71,0x00000800,0x8c300000,0x5289a513,0x18610800,0xbdb5acf2,0xbd95b574,0x1862acd3,0x5a6a0800,0xcdd6c596,0x08007b4c,0x6ae90800,0x6268cdb5,0x00000800,0x00000000,0xff7b9c90,0xde78ffdd,0x080018a2,0xff9c944f,0xf75bf73b,0xd657ef1a,0x080049e6,0x7bce0000,
-0x3104c5b6,0x08000800,0xa4d283ef,0x39659c91,0x20e30000,0x732b83cd,0x08001020,0x00000820,0x00000000,0x00000000,0x00000000,0x00000861,0x949039c6,0x00004a48,0x10610000,0x000020c2,0xf73a3965,0xff39ff5a,0xff3af6d8,0xc595ff3b,0x08005207,0x08410000,0x00200000,0x20c20840,0x20c320c3,0x18c320e3,0x21032124,0x20a220c2,0x10611861,0x08000000,0x08600020,0x18e218e2,
-0x186118a1,0x10621882,0x00410042,0x08a10081,0x10811061,0x108218a2,0x10621061,0x20a20000,0x082018a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x20212061,0x72aa5186,0x00000800,0x08000800,0x00000800,0x08410841,0x08000021,0x08001841,0x08000800,0x08000800,0x08410000,
-0x08000000,0x10001000,0x08000800,0x08000800,0x08000800,0x08000800,0x08000800,0x00000000,0x00200020,0x00001081,0x62a90800,0xff1bc5b5,0xf6b8ff3a,0xf6f8ff19,0x83ace697,0x00000800,0x086018c2,0x00000000,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x08000861,0xee153880,0x4a07f6fa,0x30e30800,0xfef8e656,0xe698f6d8,0x000062eb,0x106110a2,0xc5b50800,
-0xff1aff7c,0xff5aff5a,0xcdf6ff5b,0x08410820,0x08001882,0xff5a9c6f,0xf739ff59,0xacf2ff9b,0x10610000,0x00000000,0x00000860,0xff5bacd1,0x8c0dffbc,0x18820000,0xffbcde98,0xffbbffbb,0x18c2e6fa,0x73ae0000,0xffbbffdd,0x62a8eef9,0x00000000,0x08000000,0x52280800,0x08003924,0x83cd0800,0x7bada4d1,0x00001060,0xb5754a07,0xbd74bdb6,0xffbce6d9,0x5207de58,0x00000000,
-0x00000000,0xa4d20800,0xff9cf77c,0x4a07f73b,0x41a50800,0xe636f6d9,0x08002040,0x00001041,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x10810000,0x080018a1,0x52070800,0xff5ad5f6,0xff39ff39,0xde58ff7b,0x000083ce,0x18a20000,0x00000821,0x00200020,0x08000000,0x08001000,0x08000800,0x08000000,0x10000800,0x08000800,0x00200820,0x00200020,0x00000000,
-0x08000800,0x08001000,0x00411082,0x00600020,0x00000820,0x00000000,0x08000800,0x9c4f6aa9,0x10411840,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200020,0x20002041,0xe5d661c7,0x5a47940e,0x5a476aa8,0x31865a68,0x00410000,0x10200000,0x51a51000,0x62686a68,0x41a649c6,0x00002924,
-0x10200821,0x72aa1800,0x72ca7b0b,0x6aaa72aa,0x6aca6aca,0x6aca6268,0x20c26269,0x08200000,0x00000020,0x18a21061,0x000018a2,0x838d0800,0xff1aee79,0xf6d7fef8,0xf73aff39,0x41c6b533,0x10a20000,0x08610861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000841,0xf6564101,0x41e7eed9,0x20a10000,0xf6b7d5d5,0xf73aee97,0x000083ce,0x108110c2,0xbd540800,
-0xf6f9f73b,0xf719f6f8,0x9c50ff7b,0x18c20000,0x08001882,0xf719b512,0xf6d6eeb6,0xff7bf718,0x00009471,0x106120e4,0xa5120000,0xe656ff1a,0x940deeb7,0x08200800,0xef3ace16,0xf739f739,0x2102d657,0x7bee0000,0xeed7f77a,0xe678ff7a,0x00005a8a,0x00002924,0xeefa6aea,0x2082c595,0x08000800,0x08000800,0x08400820,0x00000000,0x10200800,0xde985a88,0xeedaff9c,0x000141e7,
-0x00002104,0xf75b8c0f,0xef1aeefa,0x4185de78,0x41c50000,0xe657eeb8,0x08002040,0x00001041,0x00000000,0x00000000,0x00000000,0x00200000,0x08a20000,0x08410861,0x08000000,0xeefa8bee,0xf719ff7b,0xff5bff7b,0x3145b533,0x08210000,0x106118a2,0x08200820,0x08400841,0xb5335268,0xb4d1bd33,0xa46fa490,0x9c4f9c6f,0x836c93ee,0x6aca7b4c,0x00201061,0x00000840,0x83ac5aa8,
-0x8bac8bac,0x7b4b9c2e,0x08210800,0x00000840,0x41a61882,0x39843144,0x498430e2,0xc533f698,0x18811860,0x08200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20002062,0xfeb97228,0xf6f9ff7c,0xff3afef9,0x9451f73b,0x10820001,0x08001861,0xe5f538e2,0xf6d9ff19,0xef1af6fa,0x00009c91,
-0x10410861,0xe6162040,0xff19ff3a,0xff3bff1a,0xff3aff3a,0xff5bff1a,0x83cef73b,0x10820000,0x18810000,0x00000000,0x18a21081,0x00001082,0xacf33145,0xff9cef1a,0xf71aff7a,0xdebaff7c,0x0000738d,0x00200882,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x08000840,0xee582860,0x3145eefa,0x28e30800,0xffbde678,0x83adff3a,0x10c10000,0x00200020,0x00000820,
-0xf73ab533,0xff3aff5a,0x0800b513,0x00000000,0x08000800,0xacb10800,0xee75f6d7,0xd635eed7,0x08005a88,0x10410000,0x83ee0000,0xee36e677,0xa44fee97,0x00000800,0xff7cd637,0xff7beed9,0x18a1e698,0x6b4c0000,0xf6b8f71a,0xcdb6fef9,0x00003986,0x08000000,0xde784a07,0xc5b5ff9c,0x102028e2,0x18601020,0x08200000,0x00000000,0x08000800,0x49e60800,0xd637e6b9,0x00003165,
-0x00000000,0xce1741e6,0xf75bf75b,0x49e6eefa,0x42060000,0xe677f71a,0x08002061,0x00001021,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x00000882,0xce175aaa,0xf71aff5c,0xff9cf719,0x62cade77,0x00000800,0x18a218c3,0x00000000,0x08400000,0x00000861,0xff7c7bae,0xfef9f719,0xff3aff1a,0xff7bff5b,0xff5bff7b,0xde37ff7c,0x08001841,0x000018a2,0xff7bbd74,
-0xff3aff1a,0xfef8ff9b,0x10006a88,0x10211841,0xb5550000,0xee77ff5b,0xfef8ee77,0xc553ff5a,0x20822060,0x08200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000820,0x20001800,0xfe987207,0xf6f9ff1a,0xf6d8f6b7,0x39a6de78,0x10610000,0x10001040,0xff39b490,0xfef9ff19,0xff7bff3a,0x0000bd94,
-0x082018e3,0xe5f52020,0xfed8ff39,0xff19fef9,0xff5aff5a,0xff1aff5a,0x9c71ffbd,0x19030000,0x49c60800,0x62cab533,0x00000000,0x108218c2,0x00000000,0xc5d65aca,0xffbcf77c,0xf77dff9d,0x000094b2,0x08411082,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x62691820,0x18a26b2c,0x10410800,0x9c7083ae,0x000083ae,0x00000840,0x5aa98c4f,0x00000000,
-0x6b0a18c2,0x62a87309,0x18611861,0x9c910000,0x0800b533,0x08000000,0xff18bcf1,0x4183de15,0x00000800,0x18613124,0x08000000,0xde1693cd,0x8bcdd5f5,0x00000000,0xf73cbd95,0xf71beeba,0x1040d657,0x736d0000,0xff1aff1b,0x1861c554,0x10610800,0x10206289,0x41e60800,0xef1ade78,0xde57e698,0xcdd6de57,0x00005248,0xb5334a27,0x5a67c574,0x08000800,0x39c65268,0x08000000,
-0x08005248,0x31430000,0xff7cce37,0x41a6de79,0x31850000,0xc5b5de78,0x08001040,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00010041,0x00000862,0xde996b2c,0xff9cf73b,0xa4d1eef9,0x08002903,0x10a31062,0x00001082,0x9c901880,0x00005a68,0x000018a2,0xf73b6b4c,0xf6d8f6f8,0xfef9fef9,0xfef9fef9,0xf6f9f6f9,0xddf6ff3a,0x18202861,0x080018a1,0xff3ab490,
-0xfef8fef9,0xff17feb6,0x3060dd51,0x18621820,0x5a890000,0xff19f6d9,0xfef7fef8,0xbcb0fed7,0x20822040,0x08200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20001841,0xfeb869e6,0xf6f9ff3a,0xff5af6f9,0x0000944f,0x10a210a2,0x52060000,0xff19f6b8,0xfef8fed8,0xf73aff19,0x0000bd73,
-0x08200882,0xf6363080,0xfef7ff39,0xfef8fef8,0xf6f7f6d7,0xf6d8fed8,0x8c0ef71a,0x18c20020,0x41431000,0xf6d9f6b8,0x49c4bd11,0x18610800,0x186220a3,0x00000000,0xd6787bce,0x62ead699,0x08400000,0x10820821,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000820,0x00000000,0x00000020,0x00000000,0x10610000,0x940e0800,0xde78ff7b,0x00205269,
-0x00000841,0x10000800,0x08000800,0xf73b8c0f,0xad13ff5c,0x00010001,0xff3a940e,0x08006aea,0x52480000,0xb513e699,0x08200000,0x18400800,0x08000800,0x00000020,0x52283985,0x5aaa5269,0x08614a28,0x29650000,0x83ae732b,0x080028c3,0xad120800,0x9c2fff1a,0x00000800,0xe6f8630a,0xfef8ff18,0xf71bff3b,0x000062cb,0xeed86ae9,0xe677f6f8,0x08006268,0x00000000,0x9c500000,
-0x940ff6fb,0x00000800,0x736d39a6,0x18a25aaa,0x10820000,0x31644a27,0x08210800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10620021,0x10620841,0x00000000,0xce16a4f2,0x0000734b,0x18a20000,0x000018a3,0x6b0a0000,0xff5ad615,0x08006aa9,0x000020a2,0xef7b6b6c,0xff3aff7b,0xff3aff3a,0xff18ff39,0xfef8ff18,0xe593feb6,0x18002020,0x08001880,0xc42d8aa8,
-0xc40bbbcb,0xdc2ad3e9,0x5962c3ca,0x08201000,0x000010a2,0xb44d6aa7,0xbb89c40b,0x8a86bba9,0x18612020,0x08200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08001061,0xf67761e5,0xf73aff3a,0xc5f5ff9c,0x00002923,0x10610861,0xbd740000,0xff3aff5b,0xee76fed8,0xff7bf6f8,0x0000c594,
-0x08410841,0xee152840,0xee55fe96,0xf6b7f697,0xf6d7f6d8,0xf6b8fed7,0x8c0ef6f9,0x18c20000,0x49431000,0xfef8f697,0xeeb7ff19,0x08008bcd,0x20a20800,0x10811882,0x29440000,0x00003164,0x10811061,0x00000840,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x08000800,0x08400840,0x00200840,0x18a118a2,0x08001860,0xff1a9bee,0xff5bfef9,0x0000c5b5,
-0x29241082,0x59e55a06,0x93cd51c5,0xff39ff19,0xde37ff5a,0x000020e4,0xff7bacd1,0x080062ca,0xf6d85a47,0xff1aff1a,0x1000b4d0,0x10001000,0x08001000,0x00000861,0x10000800,0x08000800,0x00000000,0x00000860,0x10001000,0x10000800,0xff39c553,0xff5afeb7,0x00008bce,0xeed73984,0xfed7ff58,0xeeb9ff5a,0x08005228,0xff38834a,0xff5aff39,0x7b6dff1a,0x00000040,0xff3ba4f2,
-0xff3bff3b,0x0800942f,0x00000800,0x00000800,0x00000861,0x08000000,0x08210800,0x00000020,0x00000000,0x00200000,0x00000000,0x00000000,0x00000800,0x10411861,0x00001061,0x10a10000,0x08400020,0x10211882,0x20c20800,0xf719a4b0,0xeeb7ff59,0x10005a07,0x000020a2,0xf75a6309,0xff19ff5a,0xff19ff19,0xfe74fed6,0xf5d1fe33,0xcc4dfd90,0x10002020,0x10001060,0x68e14880,
-0x71205020,0x81408960,0x71e37140,0x08202060,0x08400020,0x49211000,0x71616120,0x59007981,0x18202840,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00610000,0x08000841,0xfeb85184,0xce16ff1a,0x292383cd,0x10600000,0x08000840,0xbd540820,0xfef9ff1a,0xff19fef9,0xff19fef9,0x0800bd73,
-0x10410841,0xf6562860,0xf6d7ff18,0xff39fef9,0xff18ff19,0xfef9ff19,0x9c6fff7b,0x20c20000,0x51851000,0xfef9f698,0xff5af6f8,0xd657ef3a,0x08006b0a,0x10400800,0x004010a2,0x18c30000,0x00001061,0x52280800,0x000020c2,0x00000000,0x00000000,0x00000000,0x00000000,0x08000841,0xc4f14922,0x080093ee,0x29030000,0x7b297b2b,0x9b8b82e8,0xed93dd32,0xddb3d511,0x1000a42f,
-0x62890800,0xdd71d572,0xfe14dd71,0xfdd1f5b1,0xd510fe12,0x080028a1,0xe6569c0d,0x08006289,0xedf37ae8,0xf5d2fdf3,0xb3cafe13,0x6a046141,0x49a47a87,0x00000000,0x69e44984,0x59a36182,0x18404163,0x5a061000,0x7a86936a,0xbc8e61e4,0xfe54fe54,0xfe96fe13,0x08008bac,0xd5933922,0xf5f2f613,0x6ae8ddd3,0x08000800,0xfeb6a3cc,0xf6d7f6d6,0xb533f71a,0x00000000,0xff9dcdf6,
-0xf71af71b,0xb512ff7b,0x7b2b72ea,0x28e36aaa,0x31850000,0x72ea7b6c,0x08002061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x49c728c3,0x08000800,0x10811882,0x00000861,0x08610881,0x08000800,0xe6587b2c,0xf718ff39,0xe697f6f7,0x08005227,0x080020a2,0xff386ae8,0xfed7ff18,0xfe34fe96,0xfd6dfdf0,0xe449eceb,0xbb48ec09,0x00401820,0x10000040,0xaac871c4,
-0x8a4679a4,0x81c38a04,0x720571c3,0x080030c2,0x00000820,0x18401861,0x598338e1,0x59226162,0x10002840,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08000841,0xc5734143,0x0000942f,0x00000000,0x18811040,0x08200820,0x00001040,0xeeb9942f,0xf6d8ff1a,0xff3af6b8,0x0000bd73,
-0x08201082,0xee362880,0xfed7ff18,0xff19f6f8,0xfef8fef9,0xfed8f6b8,0x8bcdfef9,0x20a10820,0x30611000,0xff5af677,0xf739f719,0xf75bf75a,0xb512f71a,0x00002923,0x08410861,0x08001882,0x6b0a0800,0xd637cdf6,0x00003165,0x00001061,0x00000000,0x00000000,0x00000000,0x08001061,0xdd5269e4,0x08006a47,0x18811040,0x49634163,0x61835163,0x40605101,0x492240a0,0x08002880,
-0x28a10800,0x618259c4,0x720369c2,0x79e279e2,0x61827a02,0x08002880,0x62673921,0x080020c2,0x7a4538e0,0x82658266,0x92e78265,0x8ae87a65,0x6a468b29,0x08000800,0x9b286a26,0x9b089b07,0x20207267,0x72871000,0x9b48abcb,0x72867aa7,0x72047224,0x6a457224,0x08003102,0x59a41820,0x61e37205,0x08003100,0x59e61000,0xf675cd10,0xf739f6d8,0xb533ff7c,0x00000000,0xff7cb533,
-0xf75bf75b,0xff7bf71a,0xf71aff5b,0x51e6eeb9,0x734c0800,0xde36ffbc,0x08002881,0x00000841,0x00000000,0x00000000,0x00200000,0x08000841,0xd6385208,0x5207bd34,0x00000800,0x00411081,0x00000081,0xb51341a6,0xff5bf6fa,0xff38f6f8,0xeed8ff59,0x08005a28,0x08002082,0xee7472c8,0xf654e634,0xfd2ffe13,0xe427e46a,0xe3e7e427,0x9a23e386,0x00400800,0x08000840,0x58e04040,
-0x30003800,0x59424060,0x30c14922,0x08001000,0x08200820,0x08200821,0x08000800,0x40e240c2,0x08002061,0x00000800,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x188018a1,0x00000000,0x106118a3,0x08001841,0x08600820,0x08400860,0x5a690000,0xf6f9c594,0xff3aff19,0x0000b573,
-0x08410882,0xe6361820,0xf6f7ff18,0xf697f6d8,0xfeb8fe98,0xfef8fed8,0x8bedff1a,0x20c20000,0x28401000,0xff19f657,0xff7af718,0xf6d8ff39,0xef1af739,0x00005ac9,0x10411082,0x62481000,0xf718bd52,0xef19ff9a,0x00004a68,0x00000861,0x00000000,0x00000000,0x00000000,0x08000861,0xd5326a05,0x000049c6,0x10400840,0x204030e2,0x08001000,0x10000800,0x08001000,0x00200820,
-0x00000021,0x10001000,0x20401000,0x51425162,0x40e25963,0x00400800,0x00400020,0x08200000,0x08000800,0x10001000,0x08001000,0x10000800,0x30a04121,0x10000800,0x50e04901,0x69616120,0x282069e4,0x30801800,0x28005962,0x00000800,0x08000800,0x08000800,0x08400000,0x08001020,0x08001000,0x18a10000,0x936b1800,0xcd93f696,0x732c6ac9,0x52497b8e,0x00000000,0x83ad5248,
-0x8c2f8bef,0x9cb0942f,0xe6b7a4d1,0x4964eeb8,0x7b4c0800,0xd5d3ff19,0x10002861,0x00000820,0x00000000,0x00000000,0x00000000,0x00001062,0xe6995228,0xee98ff7b,0x5a47b4d1,0x08400800,0x00001082,0xeed95aa9,0xf6f8f719,0xf6d8f718,0xf6b9ff19,0x08005a28,0x080020a2,0xee956aa7,0xe590e633,0xfc8ce46c,0xcb25f46a,0xe408e408,0x9a63ec29,0x00401000,0x08000861,0x9b286a25,
-0x9b8b8ac7,0x182072c8,0x00000800,0x10420800,0x10411862,0x08620841,0x08200020,0x10000800,0x00001021,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08200000,0x00000000,0x08211883,0x10001841,0x52071820,0x00000800,0x10811081,0x00001082,0x732b0800,0xff3ad616,0x0020b594,
-0x10610862,0xe6571820,0xf6b6ff59,0xfeb7fef8,0xfed8fed8,0xf6d8fed8,0x8c0eff3a,0x20c20000,0x30811000,0xff59ee36,0xf718f6f8,0xfed8fed8,0xad12ff3a,0x08800000,0x080018a2,0xfeb97aeb,0xeed7ff19,0xef19eed7,0x00005269,0x00001082,0x00000000,0x00000000,0x00000000,0x00000841,0xa42f6206,0x00000800,0x28c10800,0x202038e1,0x08201020,0x08000000,0x10000800,0x00200000,
-0x00000020,0x18411000,0x10401041,0x30e22060,0x100030c2,0x00000820,0x00000000,0x08000821,0x08001040,0x08000800,0x08200800,0x18a10000,0x38e16246,0x10001000,0x61a338c1,0x7a046961,0x202061e5,0x62061800,0x308082c8,0x10401020,0x08000000,0x08410000,0x00200041,0x08000800,0x18621000,0x10810020,0x936a2040,0x3943cd73,0x00000800,0x00000800,0x08400860,0x08000000,
-0x08000800,0x08000800,0x6b290820,0x4984eeb7,0x31041000,0xd615bd52,0x08002882,0x00001061,0x00000000,0x00000000,0x00000000,0x00001062,0xe6d949e7,0xff5aff5a,0xe677ff3a,0x08005a27,0x10811082,0x9c6f0800,0xf739ff7b,0xff39f739,0xf6d9ff39,0x08006249,0x08001882,0xf7186ae9,0xfeb5ee95,0xdb87fd0d,0xe3c8fd0d,0xcb67cb47,0x81e2b2a4,0x00201000,0x08001082,0xee549c0c,
-0xbcf1e635,0x00005207,0x08820840,0x08000841,0x20820800,0x00000000,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400020,0x10210801,0x38e21000,0xeeb8b4d1,0x4a27bd94,0x00000820,0x088210a3,0x00000841,0x9c700800,0x0020ad54,
-0x08200020,0xe6362860,0xfed7ff18,0xee14ee55,0xf655fe76,0xf6b6f696,0x83ccf718,0x18810800,0x28610800,0xf695ddd3,0xf696ee75,0xf698f656,0x4a27e699,0x18a10840,0x20810800,0xff3addf6,0xfef9fed8,0xe698fef9,0x000041e7,0x00001082,0x00000000,0x00000000,0x00000000,0x00000821,0x08001882,0x10000800,0x518230c0,0x28405121,0x20820800,0x618361e6,0x69c46122,0x08003922,
-0x28e30000,0x28813924,0x08200800,0x08400000,0x08000840,0x39451041,0x410351a5,0x08001000,0x40c12040,0x614258e1,0x206048e2,0x08400020,0x49024964,0x10001820,0x49640800,0x518461c5,0x08001860,0x61c51800,0x20006a26,0x38e31000,0x494551a6,0x39443924,0x000018c2,0x39440800,0x38e24984,0x00001020,0x52061000,0x00004a06,0x52470000,0x41a562ca,0x00000000,0x312320c2,
-0x39433144,0x20a13944,0x4a260800,0xb4f1f6f9,0x00000800,0x62ca18a1,0x080028e4,0x00000801,0x00000000,0x00200000,0x00000000,0x00001062,0xe69849e7,0xf719f719,0xff1aeed8,0x1000cd54,0x08611061,0x20c10800,0xff5bde57,0xef19ef19,0xef1af739,0x00005a68,0x000018a2,0xef1962c9,0xfed7ff7b,0xe3e8fd90,0xbaa3ec09,0x7120a264,0x50c068c0,0x00002060,0x00001882,0xcdb39c6f,
-0x08006267,0x10610800,0x00200881,0x4a060000,0xd5f4b4d1,0x290293ed,0x08410000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x00000000,0x00200000,0x08000821,0xee787b0b,0xff5aff3a,0xeef9ff5a,0x1041a4b1,0x08620000,0x10a210a2,0x08000800,0x10a22944,
-0x10400000,0xee971820,0xff19ff7b,0xfef8fed8,0xfed7fed8,0xff38ff17,0x7b8cf75a,0x18810800,0x28600800,0xff18f697,0xfed7fef7,0xfedafeb8,0x00009c51,0x10811081,0x9c2f1000,0xf6d9ff7b,0xff3afefa,0xe677ff5b,0x00002904,0x08200821,0x00000000,0x00000000,0x00000000,0x00000820,0x08410000,0x30a10800,0x82655983,0x40a092c7,0x20820800,0x690069a3,0x928781a3,0x08005184,
-0x30e31000,0x38c12820,0x08003902,0x00400840,0x08200020,0x49022040,0x59436963,0x10001000,0x7a2538a1,0xa2659a45,0x30608205,0x08400000,0x48c13080,0x18204102,0x08000800,0x080028e2,0x10000800,0x72055142,0x18005183,0x49031800,0x59036985,0x38e248e3,0x08001860,0x41841020,0x490240e1,0x10203903,0x00001040,0x00000000,0xef1a7b8c,0xacf2f73a,0x00000000,0xe6999c71,
-0xe699e678,0x49c5cdb5,0x5a680800,0xff3bf6d9,0x0000acf2,0x08200000,0x10420000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001081,0xeed95248,0xff7af73a,0xff7bff7b,0x8b6eff5d,0x10820000,0x080018a2,0xff9c8bce,0xff9cffbc,0xef5bffbc,0x00005268,0x000018c2,0xf75b734b,0xff19f75b,0xcba8ed50,0xbb68cbc9,0x614158e0,0xabcc8224,0x08001000,0x00001042,0x41e55268,
-0x10410800,0x18a218a2,0x18800000,0xfef8942e,0xff38ffba,0xcdd4ff7a,0x00003124,0x00000020,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00200000,0x00000882,0xe6786aeb,0xf73aff5b,0xff1af719,0xe657ff5b,0x08007b4c,0x18c10000,0x18611040,0x00000000,
-0x08400840,0xb4f21040,0xde36d616,0xde36de36,0xe697ee77,0xde96de76,0x62eade97,0x20820000,0x20401000,0xff39de16,0xeef8f6f8,0xcdd6eeb9,0x00000000,0x00001082,0xe6b939a5,0xff3bff5c,0xfefbff1b,0xde37ff7c,0x00000800,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x08200840,0x59a43923,0x81c35080,0x4880b328,0x20611000,0x692048a0,0x58a07940,0x10002000,
-0x20201820,0x8a8671e4,0x7ac89b6a,0x10810800,0x10000840,0x61415983,0x50e06100,0x08002061,0x69623060,0x89808981,0x40807141,0x18610800,0x48a05102,0x30804060,0x08201820,0x10200000,0x38201800,0x692160e0,0x200048c1,0x28401000,0x50205060,0x30003800,0x08201000,0x10000800,0x20002800,0x30c23060,0x18a20800,0x6b0b0000,0xff5aef19,0xb513ff7b,0x00000000,0xff5bbd74,
-0xff1af6fa,0x4a06eeb9,0x5a890000,0xf73aeeb9,0x9cb1f75b,0x10610800,0x08000800,0x00000840,0x00000000,0x00000000,0x00200000,0x00001081,0xeefa5247,0x944fe6d9,0x944f9470,0x734d9c91,0x08420000,0x08001061,0x945020a2,0x94709470,0x8c2f8c4f,0x00203185,0x00001061,0xb5135248,0xb4d1acf2,0x304082e8,0x82c87225,0x69e55101,0x9beca3cc,0x08000800,0x10410800,0x00200000,
-0x10a210a2,0x08000000,0xbcee5a45,0xdd4fe5b1,0xdd2fdd0e,0x8b8bccef,0x000028c4,0x08600860,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x10811040,0x00610861,0x00000000,0xde578bce,0xff5bff5b,0xff5bff19,0xbd94ff5b,0x00005aa9,0x20c30800,0x00210861,
-0x00000020,0x08200820,0x08000800,0x10200800,0x18801020,0x08401080,0x188118c1,0x08210800,0x10000800,0x6ac95a27,0x5ac95aa8,0x31245227,0x08410000,0x00000840,0x7b8d39a6,0x940f83ce,0x83ae8bce,0xc5d5942f,0x00002103,0x00001062,0x00000000,0x00000000,0x00000000,0x00200000,0x00001081,0xc4f130e2,0xed51f5b3,0x5922dc8e,0x39650800,0xd4efb46e,0xdcf1d4ae,0x08007b0b,
-0x93ac0800,0xb3cadd50,0x59c4abcb,0x08001000,0x10001860,0xdd107a87,0xb3cacc2b,0x08005a27,0xc44d4942,0xdc2bdc8c,0x8287c40b,0x08000800,0xdd10bc8f,0xac2da369,0x00004185,0x00001904,0xb3ed59c6,0xd48dc3aa,0x2040ac0d,0x832b0800,0xbb8ac42d,0x930a9aa8,0x08004144,0x72e93122,0x82e97267,0x28a2832b,0x18a31020,0x62ea0000,0xf719e6b8,0xb553f73a,0x00000800,0xff5bbd94,
-0xf6faf6f9,0x4a07e698,0x41c70000,0xf73aeefa,0xff9bf73a,0x08006aea,0x082018a1,0x00000020,0x00000000,0x00000000,0x00200000,0x00000860,0xd6385269,0x00006b0b,0x00000000,0x00000000,0x00200020,0x08200000,0x00000800,0x00000000,0x00000000,0x00200000,0x08000000,0x08000000,0x08000800,0x18001000,0x10001000,0x20401000,0x10002020,0x08200000,0x00000800,0x08a20862,
-0x00000040,0xbd734a06,0xee33eeb6,0xedd1e591,0xabeae590,0x10002820,0x10820800,0x00000860,0x00000840,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x10210800,0x00000800,0x08c20020,0x00000861,0x28c30800,0xf6faa4b1,0xf71aff3b,0xffbdf73b,0xa4d2e6da,0x000020e2,0x00210021,
-0x00210841,0x08410021,0x08410861,0x00200841,0x00000840,0x00200000,0x00000000,0x00010801,0x08200000,0x00000000,0x00200000,0x08000000,0x00001021,0x08400820,0x00000000,0x00000000,0x00000000,0x52a90020,0x00202965,0x00000841,0x00000000,0x00000000,0x00000000,0x08410000,0x18a20800,0x7b6c0000,0xfef8f6b8,0x4943ee35,0x39850800,0xe614cdd4,0xddf5ddb3,0x08008bce,
-0xa46d1000,0xddb2fe95,0x08005a06,0x41640800,0x08001040,0xa3ec0800,0xe530f5b1,0x08006a67,0xddb24142,0xe5b1ee12,0x8b6aee13,0x08000800,0xfe54cd10,0x8b6be5d3,0x00211881,0x00000000,0xc5313944,0xfeb4fe73,0x18a0cdd2,0xa4b00820,0xfeb5fef7,0xfed8feb6,0x0800730b,0xde5549e4,0xf6d8ee96,0x00007b8c,0x00000000,0x00000000,0xde7849e6,0xad12f77b,0x08000000,0xff7ccdf6,
-0xffddf71a,0x41c5eed9,0x52490800,0xff9bf73b,0xb552f739,0x18611040,0x00001040,0x00000041,0x00000000,0x00000000,0x00000000,0x00200040,0x5aab4208,0x20c30000,0x20e31882,0x18e22123,0x18e310c2,0x082110a2,0x10610020,0x10a210a2,0x08a210e3,0x106110a2,0x08200000,0x08820862,0x108118c3,0x10401880,0x10821061,0x08001020,0x10400800,0x00000840,0x08200000,0x00000000,
-0x8c4e0000,0xff9de6fa,0xff19ff3a,0xff39ff3a,0x100093cc,0x10610800,0x08001882,0x31020800,0x08411861,0x00000000,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20411000,0x730a59e6,0x00200000,0x08400020,0x08001882,0xde161840,0xf73aff3a,0xef3bf73b,0xff9cf77c,0x7badde98,0x00000000,
-0x00200021,0x00000000,0x00000000,0x00000000,0x08610000,0x08600860,0x08200840,0x00010001,0x08200821,0x08600820,0x08810881,0x10211061,0x18610800,0x18601840,0x31242081,0x18e220c2,0x10c218c2,0x000008a1,0x08400000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410020,0x08001020,0x00000020,0x62c841c4,0x18405a67,0x10600000,0x39632902,0x18403942,0x20c11040,
-0xa44c1000,0x3921cd71,0x00000800,0xd5f66aaa,0x08009c50,0x10000800,0xdd929328,0x08006247,0x28a028c1,0x39003920,0x30c151a3,0x08000800,0x5a044142,0x100059e4,0x00210000,0x08005269,0x31220000,0x8b888b89,0x084062e8,0x52670000,0x940c8bec,0xacafac8e,0x080049e6,0xcdf441a4,0x838be676,0x00000800,0xbdb63145,0x00006b0b,0x49e60800,0xb574e6b9,0x08000000,0xad137b8d,
-0xad12acf2,0x20e29c90,0x39a70000,0xbdb4a4d2,0x1060a511,0x08000800,0x08400800,0x00000020,0x00000000,0x00000000,0x00000000,0x00200020,0x00000000,0x10211862,0x08000800,0x00000000,0x00000000,0x08200000,0x00000841,0x00000841,0x00000000,0x08000000,0x00001040,0x00210021,0x00000000,0x08000800,0x00000800,0x08201041,0x10611041,0x00200020,0x00000020,0x736b0800,
-0xf75ad656,0xf75cf77c,0xff1aff5b,0xd5b4ff5a,0x00000800,0x086110a2,0x49a50000,0xac2ec511,0x10411840,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x08000000,0x28411000,0xf6365984,0x7329de35,0x000018c1,0x08001861,0xee574144,0xff19ff39,0xf75bf75b,0xf75bf75b,0xff7bff5a,0x0000a4d2,
-0x08401061,0x20a01020,0x39233102,0x28a13902,0x08001000,0x08201040,0x00000861,0x08210000,0x10000800,0x18601840,0x10800820,0x08200000,0x20201840,0x410238c1,0x28602840,0x18402860,0x08400800,0x08610860,0x00200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000882,0x93ce6248,0x08610000,0x00000000,0x00000000,0x00000860,0x08000000,0x08000800,0x08000800,
-0x9c0c1000,0x1000ac6e,0x5aca0800,0xff9ce6fa,0xacf2ff7c,0x08001040,0xff3a72c9,0x080072ea,0x08000800,0x08000800,0x10001000,0x08011001,0x08000000,0x00000800,0xad340000,0x8c0effbd,0x10a10000,0x08000800,0x00000820,0x08001021,0x00000020,0x08200000,0x00000020,0xd5f53102,0x0800940d,0x52070800,0xff5bd637,0x6aeae6b8,0x00000840,0xa4b283ae,0x10820000,0x00000020,
-0x00000000,0x00000000,0x00000841,0x08000800,0x00000000,0x72eb1000,0x00003965,0x00000821,0x00000800,0x00000000,0x00000000,0x08000800,0x08410021,0x00000841,0x72e93102,0x72c87b09,0x7ae87ae8,0x18006a67,0x08011020,0x18a20000,0x418441c5,0x28a151e6,0x10410800,0x00000000,0x20a21062,0x390228c2,0x18201840,0x18201800,0x08001800,0x08210800,0x00001081,0xf71a9c90,
-0xff19ff19,0xff7cff5b,0xf696ff3a,0xcd71ff17,0x10610800,0x00000882,0xe613942d,0xb42dfed6,0x18612020,0x08000800,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x10200000,0x28001000,0xfe156943,0xff18ff18,0x0800a44e,0x08001882,0xee3630a1,0xfed8ff39,0xb553eef9,0xe698ad32,0xff9bf719,0x0800bd53,
-0x08001882,0xe5f43901,0xfe56fe77,0xf5d5fe36,0xd593e5d4,0xa490d5b4,0x00000820,0x10000841,0xcd131800,0xddf5edf5,0x0000acd1,0x18610840,0x69e52000,0xf5f5edd4,0xed93fe36,0xe593edb3,0x08006a47,0x00001060,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x08000882,0xfed98b0a,0x08206aea,0x318418a1,0x106039c5,0x20a10000,0x7ac86aa8,0x7ae982e9,0x83298309,
-0xee5593aa,0x1000ac8f,0xd6580800,0xff9cfffe,0xeefaff9c,0x08204a27,0xff9d6b2b,0x5227a4f2,0x49c741a6,0x49c741a6,0x20615207,0x08210801,0x00000000,0x08200820,0xff9dad13,0x5a88e698,0x00000800,0x20600800,0x18211000,0x10200800,0x18601840,0x182028a0,0x10001840,0xee566a46,0x08006ae9,0xddd54123,0xfe96ff19,0xf697fef8,0x08003964,0xddd68b8d,0x08002040,0x18401820,
-0x18601000,0x08001000,0x08210821,0x18001800,0x000018a2,0xe617a40f,0x080028c2,0x00000841,0x00000800,0x00000000,0x00000000,0x00000800,0x00210021,0x10001861,0xfed8c4b0,0xfed6fe96,0xff17feb6,0x69a4fdf3,0x18621000,0x20c30000,0xfeb7d5f5,0xccf1fe97,0x10202040,0x08201081,0xa4910000,0xe593e616,0xe5b3e592,0xd511dd51,0xb470ccf1,0x08002882,0x080018a2,0xff39bd12,
-0xf698f6b8,0xcdb5cdd5,0xf696f6d8,0xc571ee54,0x08611020,0x00000041,0xf672c570,0xb3ebfe11,0x18612840,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x08200000,0x30610800,0xf4af81c4,0xe4f0ec8e,0x10008b2a,0x08001041,0xac2e1800,0xcd31d531,0x000072e9,0x4a060000,0xd5f4a48f,0x10008b8c,
-0x10002082,0xed3040a0,0xec8ff510,0xfd31fcf0,0xed10fd31,0x938ce552,0x10810800,0x18000820,0xed1179e5,0xf5b4ed11,0x0000834b,0x206018a1,0xcbec3000,0xfd10fdb2,0xfd10fd10,0xfd51fd0f,0x2000bbed,0x10402061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08001061,0xf5d47a25,0x10007ac9,0xa40e1000,0x3901bcf1,0x51a41000,0xeceedcef,0xf50ffd0f,0xed93ed51,
-0xedd4e551,0x080093ad,0x9cd20800,0xde98d658,0xd679e6fa,0x00004228,0xef3b62ea,0xef1af77c,0xeed8f73a,0xeed9eed9,0x942ff73a,0x08200800,0xe6d9ad33,0xd636d636,0xdeb8ffbc,0x100041a5,0x8b6a0800,0x9ac7dd10,0x180069e6,0x72681800,0xab28abab,0x92458a25,0xa2e79265,0xe571d46d,0x08006266,0xe4f15964,0xecaef510,0xd4ceecee,0x08003102,0xd4b08288,0xbb8ac3ec,0x92259a86,
-0x8a039a44,0x38808205,0x08001000,0x512461a5,0x10000800,0xbbcda34b,0x10202000,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x10410000,0x40801000,0xcb69cbcb,0xdba9c307,0xdbcaec2b,0xa2c6e42b,0x18612000,0x08001042,0xcc4d7a88,0xd3ebe46d,0x100069c4,0x10611060,0x72680800,0xe42ad44c,0xec4af48b,0xec8cec6b,0xed11f4ce,0x10003881,0x08001881,0xd4ef9328,
-0x7b09ac6e,0x08000800,0x9c2e5a67,0xbd71d5f3,0x08610000,0x080018c3,0xfe71b4cc,0xb3cafe93,0x20612840,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x00200020,0x40c20800,0xa1a38162,0x91c39961,0x100050e1,0x08401040,0x62061000,0x18005983,0x18800800,0x080018a1,0x31210800,0x08004163,
-0x10001021,0x89e33000,0xa982a1c2,0xa161a9a2,0xaa44a181,0x180079a4,0x10401000,0x49001000,0xaa24aaa6,0x6963a246,0x18801000,0x18001040,0xc2e689c3,0xa9e2a9c2,0xa180b202,0xa9e2b9e2,0x50c0aa86,0x10201800,0x08200820,0x00000000,0x00000000,0x00000000,0x00000000,0x10001061,0xcc2c79c3,0x10005143,0xa3cc2000,0x40c0b42c,0x51631000,0xcb47c3a9,0xe42bd367,0x4860b36a,
-0x38603820,0x00002040,0x08400000,0x310328e2,0x31853964,0x00201082,0x62ea2123,0x736c6b2b,0xff38cdd4,0xff17fed7,0x9c4dff17,0x08000000,0xff39d615,0xff78fed7,0x5a45eeb6,0x10001000,0xed509329,0xc348d3ca,0x18008a67,0x82881800,0xc306bb48,0xc349b2a5,0x9245bb49,0x618279c3,0x080030c1,0x50c12000,0x81a279a3,0x61827180,0x08001020,0x50e138a1,0x9a868205,0xcb48c369,
-0xc2a5d307,0x5902bb09,0x10000800,0x8226a32a,0x10000800,0xa2e981c5,0x000038c2,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x18600020,0x9a661800,0xd2a4d327,0xc243ca83,0xca84ca84,0xc306c242,0x10006162,0x18221042,0x69412000,0xb243aa03,0x4900aae6,0x08400800,0x18001861,0xcb0589c2,0xca61ca82,0xc2a4caa3,0xc369db87,0x10003820,0x08001060,0x69e46a05,
-0x08001000,0x18a10840,0x08000000,0x736b5225,0x00210020,0x08000840,0xedefac6a,0xbbcafdf0,0x18612840,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08200000,0x30400000,0xc2858162,0xc2e7d2e6,0x10007a05,0x00001060,0x30e30800,0x18201800,0x18811881,0x18811881,0x000018a1,0x08000000,
-0x10000821,0xaac73020,0xd285d307,0xd244d265,0xc2e7dac6,0x18007184,0x18201841,0x8a041800,0xcac5cb06,0x50e2bb49,0x18611000,0x48a01000,0xd284c307,0xc1e1c202,0xe2e5e2a5,0xca84dae5,0x9a87cb27,0x10202000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x10000841,0xcc6e71c3,0x08005a06,0x9b8a1800,0x4080bc2b,0x28810800,0xcbcaab29,0xcc0cdc2c,0x10004922,
-0x10001000,0x08600000,0x00000840,0x10000800,0x08000800,0x08400800,0x00000000,0x00000000,0xac8e0820,0xdccced4f,0x8328e590,0x08000800,0xed90b46d,0xed4de50c,0x4960d52d,0x72471000,0xba84dc2c,0xe3c9c283,0x18009ae8,0x9b2a1800,0xe388e40b,0xd40be3c9,0x100069e5,0x18001800,0x08210800,0x10200800,0x08000800,0x10401020,0x00000820,0x10400840,0x18000800,0xcbeb7a24,
-0xdb6acac7,0x5944c36b,0x10200800,0x7a05a34a,0x08000800,0xb36b9ae9,0x00002040,0x00000820,0x00000000,0x00000000,0x00000000,0x00200000,0x08000061,0xcb6950e1,0xe325db47,0xe346db05,0xe346e366,0xe3a9db05,0x2800a2e7,0x10211820,0x61a31000,0xd305c306,0x89e2cb46,0x10401800,0x10001041,0xc3476121,0xe2e5d2c4,0xc263d2a4,0xcb89c2c5,0x10003000,0x08200820,0x08001800,
-0x10a10820,0x108110a1,0x188018a1,0x00000000,0x00010041,0x08001062,0xd52c93a8,0xa368e50c,0x18612020,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x30600800,0xba448162,0xb2a5b1e2,0x100071c4,0x00001060,0x00000800,0x18401840,0x10002040,0x08001000,0x08401060,0x00001061,
-0x10000801,0x92662000,0xca03ba45,0xca23d203,0x9a04d2c5,0x18202000,0x10001020,0xaaa56142,0xba63c283,0x20006900,0x08001820,0x92a81000,0xd263cb06,0xda22da43,0xeae5e283,0xdb26daa4,0xc389d367,0x08005163,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x10000840,0x9b6a61a3,0x100028a1,0xa3691800,0x61a2dcee,0x18201000,0xa36b2800,0x2800a34a,0x10001000,
-0x626851e6,0x00002923,0x5a670820,0x724582e8,0x62257aa6,0x08001840,0x416420a1,0x08003942,0x18000800,0xdccdb3a9,0x30a09347,0x10601040,0xb3c930a0,0xd489e4eb,0x4940bc69,0x82ea0800,0xcac5cb69,0xdbc8db46,0x200092a6,0x51631000,0xc327aae7,0x71a2bb48,0x08001000,0x10002020,0x08000800,0x08000800,0x08000800,0x08001000,0x08210800,0x08000820,0x10000800,0x69a21800,
-0xcb4ac329,0x18009268,0x18000800,0x71619aa6,0x08001000,0x8ac969c5,0x082120a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000861,0xbae78246,0xd2a3c263,0xc262d2a3,0xca83caa3,0xc284ca83,0x6183bb48,0x18411000,0x20001000,0xd2a3b2a5,0xb2c5cac3,0x100050c0,0x18401020,0x71821800,0xc223c2c6,0xba02ca43,0xcbaac2c5,0x08002800,0x08200800,0x10620821,
-0x08401081,0x10000800,0x10201000,0x10a21881,0x00010021,0x08001062,0xf694acad,0x9b89f5f1,0x10811000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x18000000,0xdb8881a2,0xdc2be3a8,0x080082a8,0x08001040,0x18620821,0x20401881,0x82652800,0x40a09b29,0x08201000,0x00210000,
-0x08200021,0x7a461000,0xc244bac7,0xca63ca02,0x6100bae6,0x10211000,0x28400800,0xaa648a04,0xb285aa22,0x20007984,0x08001841,0xa36b1800,0xd243d328,0xe283da63,0xf326eac4,0xeba8f3a8,0xdc6be3c8,0x00006205,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x28c228a1,0x10000800,0xfdb28ac8,0xed71f570,0x10006a25,0x18601000,0x08001881,0x83091000,
-0xfe75e5d3,0x10008b6a,0xa3ec1000,0xe48aed2e,0xccede54c,0x08004162,0xc4ce6a45,0x8b48c4cd,0x08000800,0x7ac93902,0x08001000,0x08000800,0x30c01000,0xc54f9bea,0x3961acad,0x6a890800,0xbb28cc6e,0xcb88d388,0x5900bb67,0x10001000,0x8b2a38a0,0x180061e5,0x51831000,0xbc2cc44c,0x10004122,0x8a4750e2,0xb2e7aae7,0x8204aac6,0x10001800,0x9ac740c0,0x6122a2c8,0x10001800,
-0x61c469c4,0x10001000,0x71a42000,0x9a03a244,0x10004080,0x30e31000,0x00001041,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x08000820,0xaac65941,0xba41b242,0xcac4cac4,0xca63ca63,0xba83ca62,0x5942ab06,0x18411000,0x59421000,0xc223b265,0xba85ba22,0x406091e4,0x10611000,0x28400800,0xa9e29225,0xc243c243,0xcbcbcb06,0x08001800,0x00200020,0x10620021,
-0x10000800,0xd4d1932b,0x200071e5,0x10400800,0x00000020,0x00001061,0xbd7262c8,0xa44eff59,0x10810800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x10000800,0xc38971c3,0x92a6c3a9,0x08003902,0x10210800,0x10001021,0x59212800,0xdc4ba2e6,0xc38ae44c,0x18007a25,0x08200800,
-0x00000000,0x10000800,0x9a046101,0xbac6c2c6,0x18008204,0x10211840,0x61841000,0xa1c299e3,0xa203a9e2,0x40409a87,0x10611000,0x59431000,0xd2a5c308,0xe284d263,0xeae5e2c4,0xe367dac5,0xa306ec6b,0x10811000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08000000,0x59c40800,0xfd2fed10,0xfd70fd0e,0x4963d4f0,0x00200800,0x00000061,0xe5506225,
-0xdceded2e,0x18009348,0x8ac71800,0xfd2bdc49,0xc4cbe4ca,0x080041a3,0xd4ee7a65,0xe5d1dd6f,0x00007b2b,0x08000800,0x08200821,0x6b098c0d,0x10000800,0x41822080,0x10403962,0x20a20000,0x50c059a4,0x796158a0,0xbbeabba9,0x08004942,0x08000800,0x08000800,0xbc0b5142,0xdc8be4ab,0x18005182,0xbae85080,0xeb67eba9,0xbb07f3a8,0x18002820,0xc3076920,0xb2c7c2e6,0x10004903,
-0x10001000,0x20600820,0xa2248226,0xb244b223,0x280089e5,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200800,0x8a441800,0xc2c4b2c5,0xc243cac4,0xc222c222,0xc2e5ba01,0x18008223,0x10001820,0x92662000,0xb9e2c2a6,0xb223ba23,0x7142baa6,0x08201000,0x08000861,0x920450e1,0xbae699e3,0x71a4a286,0x00011000,0x08200020,0x10000800,
-0x79e54902,0xd3ecb309,0x9225cbab,0x100050e0,0x00200800,0x08610000,0x00000000,0x6b0a83cd,0x10810000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08000820,0x6a464964,0x10003080,0x08400800,0x10000800,0x61642020,0xc2a5a225,0xe387db66,0xeb68dae5,0x9a65db68,0x080038a0,
-0x08000820,0x08000800,0x28001000,0x8a886985,0x100040e1,0x08001040,0x89e53820,0xa9c19981,0x99a1a9c1,0x79a49a04,0x10001800,0x18001021,0xd30791e4,0xda84ca44,0xe2e5e2e5,0xd327eb26,0x61a3cc0b,0x10600800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18410801,0xabac1000,0xcae5d38a,0xc306d306,0x7266c40b,0x18c20800,0x08001082,0xcc4a8ac7,
-0xdc4adbe8,0x18007a24,0x8ae71800,0xfe32dc6b,0xee33feb4,0x00004a05,0xfeb67b29,0xff59fed7,0x41a7eeba,0x20e20800,0x842e0000,0xf718ff9b,0x180093ec,0x10001800,0x08001000,0x08000820,0x10001000,0x20002000,0x934938a0,0x4102a3cc,0x18821000,0x18200860,0xd367ab28,0xbb46c2c3,0x10004101,0xbac65080,0xeae5e306,0xbac5eb46,0x18003020,0xbac56900,0xbac4ba62,0x18008aa8,
-0x18611820,0x82e80800,0xa180c328,0xb1e2b1c1,0x81e6aa05,0x00201000,0x00000020,0x00200000,0x00000000,0x00000000,0x00000020,0x00000000,0x10210001,0x40a01000,0xb283aac6,0xc221c242,0xb1e0b9e1,0xb2a5c243,0x080040c0,0x10001861,0xc3076921,0xb1c0c263,0xc243b1c1,0x91e3ba23,0x08003060,0x10001041,0x6a061000,0x69848246,0x10001800,0x00001021,0x10000000,0x79a33060,
-0xc2a6bae8,0xb9e2ba02,0xe348d284,0x8a45d348,0x00201000,0x00000021,0x10401881,0x00200000,0x00200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x08200000,0x08000800,0x10400800,0x00000840,0x10001020,0x9aa82820,0xd263d2e7,0xca62c221,0xca02d222,0xb243c201,0x100069c4,
-0x08001040,0x08210801,0x08000841,0x10001000,0x08201000,0x10000840,0x9a256983,0xaa02a203,0xb264b243,0x9245a244,0x100040e2,0x10001862,0xb2c73800,0xd2a5d2e7,0xd2e5d2e5,0xbb07caa4,0x100071e4,0x00001060,0x08000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x10200800,0x61a41800,0xc327aac7,0xbb06c306,0x20008224,0x08002040,0x18000800,0x9ac52800,
-0xd40ad3e9,0x180082a7,0x93691000,0xed2fb3aa,0xcd11fe34,0x080041a5,0xe6565a47,0xe616f676,0x08009410,0x08000800,0x42060020,0xf6b7bd72,0x9b69e5f3,0x72477a26,0x10004984,0x30e20800,0x516251a3,0x18005143,0x28a01000,0x38c16226,0x08001000,0x10000000,0xd3a99245,0xbb88d346,0x100038e1,0xb30748a0,0xe367e389,0xbb27db87,0x18003881,0xc3687162,0xc388cb66,0x10005963,
-0x10400800,0x59a31000,0xcae6bb48,0xcb08cb07,0x71a5bac9,0x08610800,0x08200000,0x00000020,0x00000000,0x00000000,0x00200020,0x00000000,0x08010001,0x18001020,0xc3688225,0xd326cb26,0xcb26d347,0x9224d368,0x10811000,0x20200000,0xcb68ab29,0xcae6cb06,0xc2c5baa5,0xb2e6c2a5,0x100069c4,0x08200800,0x28c20800,0x100030c2,0x08410800,0x08200000,0x10000820,0xbb6982a6,
-0xd2c5cae6,0xd2c4d2e5,0xdac5dae5,0xb2e7e388,0x00001000,0x00210841,0x08400000,0x006010c1,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08210000,0x08000820,0x08200800,0x08201061,0x08200020,0x10000800,0x92a72000,0xdae5cb06,0xdb26db46,0xdb47e388,0xd3c9db66,0x10008266,
-0x00001860,0x08000800,0x08000800,0x08201061,0x08400840,0x20600000,0xb34992e8,0xb348bb8a,0xb348b348,0xc40dbb49,0x0800830a,0x10400820,0x69e41000,0xbac6aac7,0xdc4bdc0a,0xa36ad46c,0x08001800,0x00210861,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08001060,0x494228c0,0x59835122,0x18002860,0x930a3000,0x180069e6,0x18001800,
-0x93498286,0x10004984,0x59e60800,0x826682c8,0x7aa87a66,0x080028a2,0x832930c1,0x4963934b,0x08000800,0x62684164,0x08000800,0x7aa82040,0xcc0bbbeb,0xd48ed42c,0x10009bab,0x7ac81000,0xc368c3ea,0x8ac9c40c,0x08001000,0x08000800,0x7b0a2040,0x08002902,0x934a1000,0xb40ccc8d,0x08003922,0x9b2840e1,0xbb69b369,0xb40ccc2b,0x08003102,0xc44e5983,0x7245bc4d,0x10410800,
-0x10002082,0x08000800,0xbbec69e4,0xb3cdb3ab,0x10007a68,0x00200820,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x08000841,0xb3ec38a0,0xd42cd46d,0xcc2ccc4c,0x5942bbab,0x08410800,0x41a60001,0xabaa9bcc,0xb38aab8a,0xc3abb36a,0xbbeabb89,0x39019bab,0x10410800,0x00001021,0x10401000,0x00010841,0x10410000,0x08001041,0xd4ce936a,
-0xe48dd44c,0xe48cdc4c,0xdbc9e44b,0xb307e3c9,0x08401000,0x00000021,0x00000000,0x08400000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0x08000000,0x18411000,0x08000800,0x08200000,0x18400000,0x92e71800,0xe3c8cba8,0xf42bfc8c,0xfccdfcad,0xdc0aec09,0x10008aa7,
-0x08201060,0x18610800,0x00001040,0x00000840,0x00200040,0x39430000,0x71e461a3,0x616269e4,0x592150e0,0x61c56163,0x080049a5,0x10400820,0x18200800,0x58c050e1,0x7a4571c3,0x412282a7,0x00210800,0x00410000,0x00010021,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x31630840,0x08000000,0x08001000,0x10001000,0x28800800,0xd48f92e8,0x2800bbcc,0x10001000,
-0x18001800,0x08201000,0x10001021,0x20001800,0x18002000,0x10001000,0x10001800,0x18001800,0x41630800,0x936a9bab,0x08004984,0x40c11000,0x92238224,0x8a449223,0x10007246,0x59831000,0xdba9b2e6,0x9b08c369,0x080059c5,0x10201081,0x9bab6a46,0x10007ac8,0x28e10800,0x51a461e4,0x08001840,0x28601840,0x38a03060,0x412140e0,0x00000840,0x38e22060,0x08004123,0x00001881,
-0x838c4164,0x08005226,0x18201000,0x10001800,0x08400800,0x08400020,0x00000820,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x08200000,0x28601000,0x40c04101,0x30603880,0x10002820,0x00201040,0x08200000,0x10000800,0x18001800,0x51222000,0x40e05983,0x498451a3,0x00001860,0x10410000,0x00001020,0x00000000,0x00000820,0x08000820,0x72455a05,
-0x72257225,0x8ac67224,0x82037a03,0xa307d3eb,0x08401000,0x00000000,0x314418a2,0x080028c2,0x00000820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000800,0x18002000,0x49431800,0x080028a2,0x10400000,0x93481800,0x9a419ae3,0xebead367,0xfcedec6b,0xb2e6ec6b,0x10006163,
-0x00400840,0x31030800,0x20a13963,0x08410820,0x00400020,0x39441061,0x49413900,0x10002060,0x10001000,0x08001000,0x08000800,0x08000800,0x08001021,0x10001000,0x10001000,0x08001000,0x00011041,0x00201062,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400020,0x6a870800,0x8266b42d,0x48c24060,0x184038e2,0x51e41000,0xed0ebc2b,0xa308b348,0x286082c7,
-0x30a038c0,0x08001800,0x10001020,0x30002000,0x18002000,0x00000800,0x00200820,0x08000000,0x82c64140,0x82648ac5,0x49429b8a,0x38c11000,0x69805940,0x82a68223,0x00004184,0x30a00800,0xd42b8a45,0x79c2a2a4,0x39029b4a,0x31020800,0x82647265,0x9b27ab68,0x10001800,0x10001000,0x08200800,0x08000000,0x10001020,0x10001000,0x00010000,0x08000800,0x08000800,0x39620820,
-0x83494982,0x41a27b08,0x20a041a2,0x08001020,0x10800000,0x290320e2,0x00000800,0x00010001,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x08400861,0x10200820,0x08000800,0x08000800,0x08000800,0x08200000,0x00000820,0x08400840,0x10200840,0x10001000,0x20a00800,0x28e21840,0x00200840,0x08000820,0x10001020,0x52893164,0x08200800,0x00210021,0x10000800,
-0x10001000,0x18201000,0x20002040,0xa38ab3cb,0x08400800,0x00000841,0x31631080,0x394441a5,0x00001861,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x20601020,0x61423040,0x9b4a8a66,0x00004143,0x10400861,0x72851000,0xbb86b3e8,0xd347c326,0xfd6ff4ee,0xb368f52e,0x08005163,
-0x00000861,0x31020820,0x39423963,0x00001881,0x00000841,0x18600800,0x41c441a3,0x08201880,0x18621000,0x18a11881,0x20801880,0x18212061,0x08420800,0x08410001,0x20a31062,0x186020a2,0x18411000,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10600820,0x6a460800,0xf592e592,0xabcdcc2e,0x08008b8c,0x49c40800,0xc46cc4cd,0xd4ce8a65,0xddb2ee34,
-0xb48ecd10,0x08006268,0x9bcd0800,0x9285a329,0x61e49b07,0x00000000,0x31a410a1,0x314131a3,0x93477285,0x82648ac5,0x49438b29,0x39031000,0x72448308,0x6a4582a6,0x08001040,0x49840800,0x8a4569c4,0x8ac68a84,0x3922936a,0x28c10800,0x8ac57265,0xdccdbba8,0x62659bca,0x41846a66,0x00001041,0x39c40000,0x39415a45,0x30e24162,0x00000020,0x316420c2,0x18a118c2,0x5a254184,
-0x28a05a05,0x49a24141,0x41e54a25,0x29442924,0x318339c4,0x20813963,0x08210800,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,0x18c218a2,0x08600000,0x08400000,0x10611081,0x10420821,0x08400020,0x08000000,0x08000800,0x00000800,0x08400000,0x08210821,0x21031081,0x18812924,0x00200020,0x00000000,0x290228c1,0x31442903,0x00000000,0x00000021,0x28e318c3,
-0x18a11061,0x292220e2,0x390120a0,0x51834921,0x00000800,0x00000000,0x290118a0,0x49843943,0x000020c2,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x38c11000,0xa2c769a4,0xab48bb48,0x00004963,0x08600861,0x51c30800,0xb347b3e9,0xb2a5baa5,0xfdf2f52f,0x7265e56f,0x08001820,
-0x00000841,0x39221860,0x39223922,0x08004163,0x08010800,0x08000800,0x21022964,0x08200000,0x20401840,0x30a030a1,0x18002880,0x10001800,0x00200000,0x08200000,0x08000800,0x18001000,0x18002000,0x6a675142,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x10400800,0x41630800,0xc4cfd592,0x6a4769e5,0x000049e7,0x29020000,0x6a657b49,0x72875162,0x938b834a,
-0xd530b42c,0x100072a7,0xddd41000,0xc2e5dc4b,0x8a86d40a,0x00001000,0x626728e1,0x51c449c4,0x830972a7,0x6a258b29,0x208159e6,0x28e30800,0x7b299c2e,0x080049c4,0x08000800,0x51834964,0x61a47226,0x6aa76205,0x20c15a67,0x18610000,0x7ac86267,0xabcb9308,0xa42cb48e,0x8328ac4b,0x10211000,0x41a31060,0x83057b06,0x51c37284,0x00000000,0x41e53164,0x29632102,0x41644163,
-0x20c22903,0x310228c1,0x20e22902,0x398420e2,0x52245245,0x20a041a3,0x00210000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39a420c2,0x000018a0,0x00000820,0x00000000,0x08210000,0x00000000,0x10200840,0x20802080,0x28a01820,0x08001860,0x00010821,0x10610000,0x000020e2,0x00200020,0x08200000,0x28e23103,0x20a21040,0x00001060,0x00200000,0x290318c2,
-0x20e21061,0x29222923,0x28e128e1,0x20a14163,0x00001061,0x08000801,0x31421040,0x39434184,0x080020c2,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x38a11000,0x92456142,0x8a03a223,0x08404122,0x00000861,0x08000840,0x82242840,0xc3cb8a04,0xd550f5f3,0x10007265,0x08001000,
-0x08000821,0x39011800,0x39004142,0x416372a7,0x08410800,0x00000801,0x08600040,0x08200000,0x49023081,0x510069e4,0x93287224,0x69e69288,0x08001000,0x00000820,0xac913145,0x9b28a3ec,0x8a2592a7,0x9308ab48,0x08200800,0x00000020,0x00000800,0x00000000,0x00000000,0x08000800,0x28e20800,0x30c08bab,0x10001800,0x08400800,0x08000800,0x10001000,0x18001800,0x18001000,
-0xd5303860,0x10006a45,0xcd310800,0xbaa4d3ea,0x92e8c368,0x00000800,0x52053122,0x100030a1,0x10001800,0x18001800,0x10201000,0x00001021,0x10200800,0x08200000,0x49a60000,0x61e56a46,0x18004964,0x08001000,0x00200000,0x10200800,0x18001820,0x18002000,0x18001000,0x72856201,0x08001840,0x312020a1,0x8b4559e1,0x49a27284,0x00000000,0x29432923,0x00000000,0x10000800,
-0x00000000,0x08000800,0x00000800,0x08001000,0x62860820,0x08006aa8,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x41e420c1,0x4a043982,0x39833983,0x31433163,0x00001061,0x08410021,0x31420800,0x5a035a45,0x6a666a25,0x206051c4,0x00200000,0x00200020,0x00000020,0x00200040,0x20c20000,0x28e23944,0x20e220a1,0x00200800,0x00000040,0x10400000,
-0x18811061,0x20a12902,0x20e220c1,0x18a120e2,0x08210000,0x08000801,0x31221860,0x394328a0,0x000020a2,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x48e21800,0x79826983,0xdcad9203,0x0800938b,0x10410800,0x08000801,0x10000800,0xc5114943,0x08008bcc,0x10400800,0x10411020,
-0x18201820,0x412238e1,0x49414141,0x6a867ae6,0x08400800,0x08010801,0x00000020,0x28610800,0x820548c1,0xaac489e3,0xd409c3c7,0xbae9d368,0x10006164,0x08601060,0xbd110000,0xb306f5b2,0xc347b2c6,0x92a6cb88,0x08401000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08000800,0x08000800,0x18201000,0x10200800,0x18400800,0x51004921,0x38c040a0,0x182020a0,
-0xc48f40a0,0x10007ac8,0x51e60000,0xc38ab3ab,0x61e5b38b,0x00000000,0x49c52902,0x08002081,0x10001000,0x10001800,0x08000800,0x10000801,0x08000800,0x08001040,0x62a91040,0x39226a88,0x00000800,0x28c11820,0x08000820,0x10001000,0x10001000,0x10001000,0x08000820,0x5a0428a0,0x080028c2,0x28e11040,0x6a646223,0x28e051c2,0x00000000,0x21232944,0x08400000,0x18201840,
-0x10600800,0x08200800,0x18a10000,0x080028c1,0x20e20800,0x08003965,0x00200820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000821,0x5a453142,0x49a24161,0x394249c3,0x39634184,0x00000840,0x00200841,0x52040800,0x6a846284,0x69e261e2,0x49617224,0x00200800,0x00200020,0x00000000,0x00000841,0x39631860,0x28c13963,0x29013142,0x08000800,0x00000840,0x00000800,
-0x08200000,0x20611020,0x10402081,0x00000000,0x00000840,0x08000800,0x39623142,0x310220a0,0x080020a2,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x38602040,0xd44d6122,0xfdd1f50f,0x934aedb2,0x10002860,0x08411882,0x08400021,0x08000800,0x00000000,0x08001081,0x10001020,
-0x59e53902,0x49425163,0x51814121,0x7ac582c5,0x08004162,0x08011021,0x00000001,0x28201861,0xd3cb79a4,0xe429cb88,0xd344d3a6,0xc2c6d2e5,0x2800a2a8,0x10a10800,0x51e50000,0xc326ed2f,0xcb46b284,0xa2e6cb47,0x00201000,0x00000862,0x00000000,0x00000000,0x00000000,0x00000000,0x08200800,0x08001041,0xbcae8b28,0x1000830a,0x41630800,0xbb88c42c,0xccaecc4b,0x08006a88,
-0x9b6b2800,0x6aa7cd52,0x08000800,0x8aa85163,0x10004902,0x20e10800,0x49c45225,0x08001040,0x59a42020,0x62056a05,0x10616288,0x10200800,0x59e451a3,0x080028e1,0x31230800,0x08004184,0x18600800,0x6a676a47,0x080049e5,0x30e20800,0x72257266,0x51c56a26,0x00001061,0x62653921,0x10204183,0x08001860,0x6aa74183,0x08003102,0x10810820,0x10602903,0x10a10000,0x51e44184,
-0x290149e4,0x104120c2,0x41a50000,0x6ac86ac8,0x00001880,0x08000800,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000821,0x52032901,0x498151c2,0x49a34141,0x20814163,0x08600000,0x00000020,0x5a2420c0,0x72c57b06,0x722261c1,0x7a847201,0x08203921,0x00200841,0x08610000,0x00000000,0x396328c1,0x39632901,0x28e03142,0x394349e4,0x08000800,0x00000841,
-0x00000000,0x10201020,0x00000800,0x08400040,0x00000020,0x28c01040,0x396141a3,0x39223101,0x08002081,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x40a02881,0xab0760e0,0xe48bd40a,0xe4cee48c,0x4921b3ea,0x00000800,0x08210801,0x08400820,0x08611082,0x08000820,0x62051800,
-0x49217246,0x412140e0,0x59c25182,0x8b059326,0x20606a44,0x08210800,0x10610000,0x48e21000,0xb2c5a2c7,0xbac4c347,0xf429dba7,0xc284cae5,0x8204c306,0x10601000,0x10001060,0xd42b9b29,0xba84b243,0x9285bac5,0x00001000,0x00000021,0x00000000,0x00000000,0x00000000,0x00000000,0x10400020,0x934b0800,0xe4cde4ce,0x38a0c48e,0x49611000,0xe40acc0a,0xe4adec29,0x10008b2a,
-0x8ae82000,0xee34e5d2,0x08005246,0x08001000,0x10001000,0x6a864962,0x49a36a65,0x10000800,0x9b2840a0,0x8aa6d4ae,0x30e18b69,0x20a00800,0x7a846a44,0x30807a86,0x00000800,0x08000820,0x7aa730a0,0x82a67a24,0x08006a86,0x51c40800,0xa2e59b07,0xabcbab47,0x08000800,0x72a64162,0x51e259e2,0x080028c0,0x08000800,0x00000000,0x39840800,0x18605205,0x10800000,0x6a845203,
-0x30c059e3,0x100028c2,0x52250800,0x730749a1,0x08006ae8,0x08201060,0x00000020,0x00000020,0x00000000,0x00000000,0x00000000,0x00000820,0x49c320c0,0x5a0349a1,0x41624982,0x080028c1,0x00400020,0x10400020,0x52033941,0x62435a43,0x6a0161e1,0x7aa29303,0x102051c2,0x00210000,0x00000020,0x10600820,0x28c03102,0x20c120a0,0x28a03942,0x62253901,0x20a15206,0x00200000,
-0x00000040,0x00000000,0x00210001,0x00000000,0x31620820,0x39213962,0x312041a2,0x31013100,0x08202081,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x48a02840,0x81a258a0,0xcbc8aac5,0xa263c326,0xa3aaab27,0x08205a67,0x08011041,0x08400020,0x00000000,0x10200820,0xac0c6205,
-0x306082e8,0x49624941,0x59a14961,0x92a3a346,0x51a29b47,0x10610800,0x08000840,0x72670800,0xd3c8c3c9,0xcb67dc2a,0xebe9dba8,0xdbc9db67,0xd48ce409,0x00004984,0x18001041,0xe48d5900,0xaa23cb27,0x81e3aa23,0x08411000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10800020,0xc4af0800,0xc3a8fd4f,0x4901b3eb,0x61c31000,0xd367d40a,0xecacc2c4,0x1000a3cc,
-0x8ae91800,0xfeb6edb2,0x41c6d615,0x10610000,0x39220000,0x7a867286,0x5a0561e3,0x10001000,0xc3ca6162,0x8aa5b368,0x20807ac6,0x20a00800,0x92c57a64,0x7aa78ac6,0x00003923,0x08000021,0xa3497287,0xa3689285,0x100082e7,0x62250800,0xc3a7b387,0xa368c3a7,0x080030c1,0x72844962,0x836751a0,0x10206ac7,0x00210820,0x21040000,0x62664183,0x20a05a46,0x18c10800,0x626351e2,
-0x41424981,0x20a13943,0x49c40800,0x39406aa5,0x31225a25,0x00000800,0x00000040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x5a453163,0x5a035a23,0x39413900,0x08003943,0x00200860,0x29020000,0x41204162,0x51a14120,0x6a4159c0,0x8b25ac07,0x28c17ae7,0x00210000,0x00000020,0x20c11040,0x28a03922,0x10402080,0x51c43922,0x38e03900,0x5a676246,0x00200860,
-0x00400020,0x00010041,0x00210042,0x21020000,0x5a8641e3,0x51e45204,0x41815a65,0x41424141,0x10202081,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200020,0x40802020,0xc3a958c0,0xb326c3a8,0xd42bcbe9,0xac2dc42c,0x00006ac9,0x00400020,0x00200840,0x08210800,0x18410000,0x8b8a6247,
-0x4100936a,0x49624121,0x72434961,0xab05ab26,0x82e8a388,0x10812081,0x08401061,0x62260800,0xc3a6ab66,0xaac4bb26,0xaa63aa83,0xeccdcb88,0x9b68ed2d,0x08411020,0x41230800,0xcb68dccf,0xec0bd368,0x6120c347,0x00211000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x08600020,0x72a70800,0xed2fcc4c,0x2000a3cb,0x8ae71800,0xf4edf54f,0xe4eef4cc,0x1000ac6e,
-0x82e81800,0xedf3dd50,0x6aebe677,0x18c20800,0x39230000,0x72456a05,0x49836204,0x10000800,0xbb4879c4,0x9ae7bb89,0x30a08ae7,0x31430800,0x826482c7,0x8ae99b28,0x00003124,0x08000842,0xab8b61e6,0x9ae6a327,0x51a4a3cb,0x49a40800,0xbbc7b3e9,0xccacc408,0x080072c8,0x620328a0,0x728461c0,0x394372e7,0x08610800,0x39a50000,0x51e36287,0x20a04182,0x18810000,0x52033982,
-0x41833941,0x00004a26,0x52250800,0x49c16284,0x416449a3,0x08400000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x39820000,0x41405a04,0x41a33940,0x00002902,0x00400020,0x31440000,0x38e04183,0x72a551c2,0x6a425a01,0x83267aa3,0x10005a05,0x08000800,0x08000000,0x31431040,0x51c34142,0x10003142,0x51e33921,0x414151c3,0x52065205,0x00001061,
-0x00200040,0x00000020,0x00000021,0x31640000,0x41a341e4,0x49c43963,0x41825a45,0x49434982,0x08201820,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x59832040,0x8a656962,0xab689ae6,0xabcaa368,0x49839b8b,0x08000800,0x08001881,0x08000800,0x10211020,0x08000800,0x49e50800,
-0x416272c8,0x51823901,0x7a644120,0xaae5b347,0x59c4a368,0x08400800,0x08400000,0x18200000,0xbba7a388,0xaac4b346,0xa263a263,0xeceec347,0x2860c46b,0x18c30800,0x7ac80000,0xd388fd70,0xebeac2c6,0x8a44fccd,0x10611000,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10001060,0xfe557a65,0x10008309,0x6a461000,0xed70edb2,0xd4eff570,0x0800838b,
-0x6a671000,0xfe97e5f4,0x08007b2b,0x08001881,0x08001040,0x8b2a4943,0x31025a05,0x08000820,0xbbeb71e4,0x8ac8d4cf,0x206082c7,0x20a10800,0x930882e8,0x30608287,0x08000800,0x08000000,0x72461000,0x824492e7,0x412282a7,0x08000800,0x93058b07,0xb4ac8b05,0x08005205,0x624520a0,0x59e36203,0x08003901,0x00000800,0x10400000,0x41824162,0x290249c4,0x18810000,0x41a33963,
-0x41a43962,0x00003184,0x49c40800,0x5a235223,0x08005a26,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x29010000,0x498149a2,0x39614180,0x08003122,0x00200020,0x18810000,0x51c349c4,0x41204161,0x62826222,0x49c26263,0x08000800,0x00001041,0x08000800,0x28e10000,0x6a656a86,0x41214121,0x414051a2,0x49c349c3,0x08202901,0x00200000,
-0x00000040,0x00200020,0x08410040,0x08000820,0x20e11060,0x31223102,0x49a241a3,0x494359c3,0x08201000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x51642860,0x48c06184,0x49814900,0x208051c3,0x08000800,0x20402061,0x49422840,0x518359e4,0x08002880,0x08400800,0x08000820,
-0x31020800,0x49414122,0x8aa55161,0xb368b346,0x08009b8a,0x08410000,0x00000821,0x08001081,0xbbc96a04,0xcb87bb67,0xb2c5b2e5,0xbb68bae5,0x100061c4,0x08601061,0xbcae0820,0xcac5fd70,0xcac6cac6,0x8203dba9,0x10401000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x18200800,0xbc8f2000,0x10008b6b,0x28a21840,0x41434184,0x51834942,0x00003963,
-0x10400800,0x520651e6,0x00000000,0x6a672080,0x080028e1,0x31230800,0x18c220e3,0x08000000,0x622630e1,0x49636a47,0x10403943,0x20810800,0x72467ac8,0x10001800,0x49a41000,0x20806246,0x08000800,0x72464942,0x49628308,0x08000800,0x41424984,0x522530e0,0x00002104,0x41a40820,0x28e23963,0x08000820,0x31431880,0x080020c1,0x29021840,0x10802963,0x10600000,0x20a128e2,
-0x41c53143,0x082020c2,0x5a240800,0x59e37285,0x00003963,0x00000820,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x29430000,0x41603941,0x41a149c1,0x20a149a3,0x08210800,0x00000841,0x49e320c0,0x51a24982,0x49a051e1,0x29215243,0x08210000,0x08200000,0x00410000,0x00000041,0x7aa551e4,0x7a8382a5,0x72647a63,0x20e15204,0x00400000,0x00200020,
-0x08000801,0x00000800,0x00000000,0x00000020,0x10600800,0x20c11881,0x49a24182,0x412159c2,0x10411020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x41022881,0x49434923,0x52054122,0x00003142,0x18611881,0x38812860,0x72255163,0x72656a04,0x51a37266,0x08001000,0x08400840,
-0x08000840,0x51832880,0x9b285120,0xab68c3c9,0x00004962,0x00001081,0x10411041,0x10400000,0x92e71800,0xb346c3c9,0xaac5b347,0xa307c368,0x08002820,0x00001061,0xddd22921,0xdb88fd90,0xe40bdb89,0x8a44d40a,0x10401800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18400800,0x59e51000,0x10008b4a,0x08001000,0x08000800,0x10001800,0x08600800,
-0x08000840,0x08000800,0x28e10800,0xac4ea42d,0x080041a4,0x08000800,0x00000000,0x08400020,0x08000800,0x10001000,0x08001000,0x30e20800,0x308082e9,0x10001000,0x8b495a04,0x62467aa6,0x000020c1,0x62051000,0x62257286,0x08000800,0x08000800,0x08000800,0x00210000,0x00000020,0x00000000,0x18a10820,0x5a653963,0x10205a46,0x08000800,0x00000000,0x00001040,0x08000800,
-0x08000800,0x08000800,0x5a041000,0x41416a44,0x00200800,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00210001,0x18a00000,0x41a13120,0x49e241a0,0x41835204,0x08010000,0x08200801,0x39820820,0x49a249c3,0x524441a1,0x00002921,0x00000020,0x00000820,0x00000000,0x00000062,0x6a033901,0x9b668ae5,0x8b26a386,0x00000800,0x00610041,0x08200020,
-0x10000800,0x41a428c1,0x18604183,0x08400000,0x08000820,0x18810800,0x49813921,0x39006223,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000020,0x28c11020,0x41224102,0x49a451a4,0x00001020,0x28811040,0x69e54102,0x59a26a04,0x6a026a03,0xa3689b27,0x30807a44,0x08400800,
-0x00000040,0x49632080,0x92e65962,0x6a23aba8,0x10600800,0x08210821,0x00000000,0x10600820,0x38a01000,0xab889b27,0x828592e6,0x59849b49,0x10411000,0x00001082,0xf6d683cc,0xcc0bfdf2,0xf5b3e4d0,0x9348dd2f,0x10610800,0x00000000,0x00000000,0x00200000,0x00200000,0x00000020,0x00000000,0x08000000,0x18200800,0x61c482e8,0x10001000,0x20001800,0x6a035120,0x000030e2,
-0x20601840,0x39013902,0xcd5259e5,0x7aa7dd92,0x10001000,0x6a874122,0x208049a3,0x08200800,0x20601040,0x38e038c0,0x20403080,0x6a862880,0x51c3b4ae,0x29020800,0x82a58308,0x8b297204,0x10005205,0x59e51000,0x7a858b28,0x30c04101,0x208028a0,0x184028c0,0x08410000,0x00000020,0x08200000,0x31630000,0x498149c3,0x7ac76224,0x38c059a2,0x10202080,0x10600800,0x28a028c0,
-0x10401020,0x10001020,0x5a2428a0,0x10405204,0x00400000,0x00000000,0x00200000,0x00000000,0x00000020,0x00000000,0x00000000,0x00200000,0x29220000,0x39803981,0x49c249e2,0x5a675204,0x000018a2,0x08211042,0x18c10000,0x31824204,0x39a33161,0x080020c1,0x00000821,0x39431860,0x00001060,0x00000021,0x72a71840,0x932682c5,0x410082c4,0x08220800,0x00200021,0x10200820,
-0x394220a1,0x51c351c4,0x5a256224,0x08202902,0x08000820,0x08000821,0x5a233920,0x59c38b47,0x08410800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18600000,0x41433922,0x49a54984,0x00001060,0x20600800,0x6a045162,0x72446a04,0x82a482c5,0xa3268a63,0x8285ab47,0x000020a0,
-0x00000820,0x41221840,0x82a661e4,0x30e08b28,0x10810000,0x10000800,0x31026aa8,0x08201000,0x10001020,0x6a245182,0x41215181,0x100038e1,0x00001020,0x00000841,0x7b4a39a4,0x59628b08,0x8b2a82e9,0xa44cbcce,0x08400800,0x00000841,0x08200000,0x00200000,0x00000020,0x08410000,0x00400000,0x08200000,0x08000841,0x7a874122,0xa44e6a67,0xbc8da42d,0xd52eccac,0x08006a87,
-0x832a2060,0xddb2cd51,0xf696f655,0x180082e8,0x49421000,0xccef82e8,0x8308c4ad,0x00000800,0x72a84164,0x9b6982e7,0x93aba3cc,0x7b296246,0x41838b8a,0x20e20000,0x6a246205,0x83096a04,0x080051c5,0x62670800,0x724582e8,0x8b6a82e8,0x6a6472c6,0x8b899388,0x08003963,0x4a060000,0x08003984,0x31420000,0x61e26a64,0x726551a1,0x72a66a24,0x28e16a87,0x31220000,0x5a037b08,
-0x52235202,0x62275206,0x83698b6a,0x00003122,0x00000840,0x00000000,0x00000000,0x00200020,0x00000020,0x00000000,0x00000000,0x00200000,0x29230000,0x41e341c3,0x31213961,0x312328e1,0x000018a2,0x08010800,0x00000021,0x08401080,0x00200000,0x08000800,0x08001020,0x6a863921,0x08003923,0x08410841,0x39430000,0x72846a86,0x30c06223,0x08220800,0x00000021,0x28e00800,
-0x39414183,0x620351a2,0x51a261e3,0x20c141a3,0x00000800,0x08000820,0x83473941,0x49817ac5,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x10200000,0x31022081,0x39844184,0x00201040,0x08000020,0x7a864942,0x7a447a65,0x8ac561a1,0xb36792a4,0xa327bb88,0x08004162,
-0x10200820,0x62261000,0x72a782e8,0x080051c4,0x08400840,0x62061000,0x9308b42c,0x10611000,0x10210821,0x10000800,0x00000800,0x10200800,0x00000820,0x00200020,0x00000020,0x10000800,0x10000800,0x7b6b5205,0x08400820,0x00000000,0x00000000,0x00000000,0x08610000,0x08010841,0x00200000,0x00000000,0x08210001,0x31020800,0xa44e6a88,0xe613acd0,0xccacdd0d,0x100072c7,
-0xac2d30c0,0xfe95dd50,0xcdb3fed7,0x08000800,0x82c738c0,0x92849b06,0xa389bc09,0x08001000,0x9b4a59e6,0xcc6d8a44,0x6227ac0e,0x08001000,0x00000820,0x08000020,0x18400800,0x186128a1,0x00200820,0x18400800,0x288028c1,0x7ae828c2,0xa386ac2a,0xccecbc48,0x08006aa6,0x7b291000,0x08006aa8,0x39821040,0x72427284,0x59e359c2,0x93cc51a3,0x1060734b,0x41a30820,0x82c49327,
-0x6ac57b04,0x51a66a67,0x39835205,0x00000800,0x00000820,0x00010021,0x08210841,0x08210801,0x00000000,0x00000001,0x00000000,0x00200000,0x29630000,0x082039c4,0x08000800,0x00000800,0x00000000,0x08010000,0x00210001,0x00000020,0x08210841,0x10200820,0x28a00800,0x7aa56a43,0x286051a3,0x00000800,0x08001040,0x5a663101,0x39637b29,0x10410800,0x08000000,0x5a0349c3,
-0x49c249c2,0x6a855202,0x49606223,0x28c149a2,0x08620000,0x08000820,0x93c94982,0x416172c6,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x08000801,0x08000800,0x292320e2,0x00000820,0x00000041,0x9b6951a3,0x7a449307,0x51206a02,0xbba892c5,0xab47b306,0x080059e4,
-0x08001862,0x7b0a0800,0x30e16a87,0x08600800,0x08200020,0x82882881,0xb3a98223,0x08006205,0x18621061,0x18811020,0x00201060,0x08001021,0x08600000,0x18c21081,0x20c21081,0x104120c3,0x10a11081,0x08200000,0x00000020,0x00000020,0x00000000,0x00000021,0x00000020,0x08010800,0x00000821,0x00010821,0x00210001,0x08000000,0x08000800,0x51e30800,0xc4adc46b,0x08005a25,
-0x7aa71820,0xf675ddb2,0xb512f6b7,0x08000000,0xabeb6206,0x92c492a4,0xa389a326,0x08001000,0x7a6730c2,0xa3498245,0x100061e6,0x08001800,0x00000800,0x00000840,0x10000800,0x08000800,0x08410000,0x08000800,0x10000800,0x10000800,0xbc4a7264,0xbc8bbc28,0x08005a03,0x83281800,0x10007b29,0x39420800,0x72847ae5,0x184051c2,0x102028a0,0x08600000,0x41630000,0x8b059368,
-0x5a4372e4,0x08002060,0x00000800,0x08010800,0x00000000,0x00410021,0x08200000,0x08000800,0x00000000,0x00000001,0x00000000,0x00200000,0x21020000,0x000018c1,0x10210821,0x10401020,0x08800840,0x08201081,0x00010001,0x08200000,0x00000800,0x10001040,0x7ae72080,0x8b058b05,0x39227265,0x08400820,0x08400000,0x08000000,0x20e12942,0x08200000,0x00000821,0x6a635a24,
-0x59e26243,0x72a451c1,0x49205981,0x312159e2,0x00000000,0x08000841,0x72e749c3,0x20a04182,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00020001,0x08010001,0x00000820,0x08600000,0x00000821,0x08000040,0x7aa651a3,0x7a657245,0x7a646203,0xa2c492a4,0xc3e9cb87,0x08006a24,
-0x08001020,0x18810820,0x08000800,0x08001000,0x08200020,0x7ac80800,0xab26ab88,0x69c3b389,0x08001000,0x08001000,0x08200800,0x10001000,0x18401040,0x10001000,0x08001020,0x08000800,0x00000860,0x00200861,0x00000000,0x00000000,0x00000000,0x00000820,0x10400000,0x18613944,0x00410000,0x00000021,0x00000021,0x08200820,0x18601040,0x08001880,0x622659e4,0x00000800,
-0x08001040,0xe676838b,0xc5b5ff5a,0x00000000,0xd5926a88,0xa388a3ca,0x93299b48,0x100030c0,0x10000800,0x41626a66,0x08000800,0x936a4922,0x28c1832a,0x20c00800,0x6a2459e4,0x518369e4,0x08202081,0x31020800,0x49a249c3,0x100028c0,0x8b8b1000,0x5a2593cb,0x08000800,0x72a52020,0x180072a6,0x20c21000,0x49c351e4,0x00001020,0x08000000,0x08400000,0x08001041,0x93aa7ae8,
-0x08004162,0x10610800,0x08200820,0x08000800,0x00200000,0x00200020,0x00000840,0x28802060,0x08200800,0x00000800,0x00000000,0x00000000,0x00400020,0x08200000,0x08000821,0x08200800,0x00000000,0x00000800,0x00210841,0x00000020,0x49e520e2,0x39214183,0x6a654162,0xa3a87263,0x10007ae8,0x08400000,0x08400000,0x08201040,0x00000000,0x00000020,0x00000021,0x7ac45a23,
-0x59a06a01,0x7a846a01,0x7a6461a0,0x39208b47,0x00410000,0x00200021,0x08001880,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010021,0x08000000,0x08400820,0x00000020,0x00200020,0x00000020,0x62044162,0x51a24961,0x8ae66a44,0xbb87a327,0xcc4bd3e9,0x08006204,
-0x00001060,0x00000000,0x18401040,0x10411861,0x08400020,0x39020000,0xbbc8aba9,0xab68bbc8,0x7ae77265,0x51a47287,0x08003124,0x18410800,0x51831800,0x8b497ac7,0x9c0e9c0d,0x51c49c0c,0x10810800,0x08410000,0x00000000,0x00200000,0x00000000,0x10410000,0x62880800,0x834bd5b4,0x08610800,0x00000020,0x00200000,0x00000000,0x00000020,0x10600820,0x08000800,0x29241040,
-0x10610000,0x7bad0000,0x8c2fce56,0x00000000,0x5a0520c1,0x516159e3,0x83095162,0x49e593cc,0x10610000,0x18600800,0x39020000,0xbc2babeb,0x6a46ccef,0x30e10800,0x9b488b07,0x8ae89b28,0x08005a46,0x72e80800,0x93878b47,0x20607b07,0x08000800,0x08002922,0x18600000,0x82e47264,0x59e29367,0x10000800,0x18602081,0x00200000,0x39423142,0x522549c2,0x00000800,0x28e120a0,
-0x10400800,0x00000820,0x00000000,0x00001021,0x00000820,0x08600040,0x31210000,0x62259bcb,0x08410800,0x00000820,0x00000000,0x00000000,0x00200040,0x00000840,0x18610000,0x41a241c4,0x49a24182,0x39626265,0x08410000,0x08000821,0x62c74a05,0x51c25a23,0x59c251a2,0x8b275980,0x08005a26,0x00000861,0x08000840,0x10600000,0x00000840,0x00410820,0x08000021,0x93666244,
-0x9b6582a3,0x72008aa2,0x9b478aa4,0x39418326,0x00210800,0x00000000,0x00200020,0x08420842,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10201020,0x08000800,0x10411040,0x08200000,0x08000820,0x62873942,0x392151e4,0x61c24941,0xbba98244,0xb3eabbc9,0x08006225,
-0x00400860,0x08810040,0x08001080,0x08000800,0x00410020,0x08001061,0xabc97266,0xb36592a3,0xb388b387,0x9b69ab88,0x00003944,0x28a11061,0xbbeb3040,0xf5f2e52e,0xfef8fef8,0xabcafe94,0x080030a0,0x00001041,0x00000020,0x00000000,0x08200000,0x10400800,0x72c90800,0xdd91f654,0x08004163,0x10611040,0x00210021,0x00400000,0x00410040,0x08000820,0x10401040,0x7b0b1000,
-0x08006ac9,0x00000000,0x00000000,0x08200820,0x00000000,0x08000800,0x08000800,0xbcf19c0d,0x08005227,0x080018a2,0x932928c1,0xcc0aab48,0x69e3e50f,0x39011000,0x8a8482a6,0x932892c5,0x08006226,0x6a661000,0xbc099b46,0x82c6a387,0x10401840,0x08000000,0x7b2820e0,0x9b248ae4,0x9ba6c488,0x00003920,0x08200000,0x28e10000,0x7a837285,0xa42a7261,0x08006287,0x00000820,
-0x00210840,0x00210000,0x08000820,0x00000820,0x08600840,0x10400000,0x72c50800,0x7244ac2a,0x08610800,0x00000820,0x00000000,0x00000000,0x00200000,0x08400020,0x39630800,0x6ac45a43,0x93888b67,0x6aa59387,0x08400800,0x00000821,0x4a0320c0,0x6a435a02,0x49a159e2,0x5a036202,0x08200800,0x00000841,0x41a41040,0x100028e0,0x10201020,0x00000000,0x08000841,0xa3c85182,
-0xb3e5abc6,0xab85a343,0x93279b26,0x41627ae7,0x08610800,0x00410021,0x00400020,0x00000841,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x31031840,0x20a03963,0x08000800,0x00000820,0x00000820,0x39840800,0x51e55a67,0x51415162,0x9b697204,0x61e49328,0x08200800,
-0x00400020,0x08000820,0x49411000,0x72c8938a,0x08610800,0x10400820,0x8b071000,0xab03b3a7,0xb325aae4,0x7244a326,0x10611000,0x10001061,0xf54f8265,0xfd90dc2a,0xf696fe76,0xd4acfe32,0x1000a3ec,0x08400800,0x00000840,0x00200000,0x00000000,0x18810820,0x83090800,0xf612e5d1,0x08009bec,0x08002080,0x08410000,0x00200821,0x00200000,0x00000000,0x08200820,0x28601000,
-0xbd53ac90,0x00001020,0x00000800,0x08000820,0x18601040,0x624549a3,0x08000000,0x8bac1000,0x08005a47,0x08000800,0x72872880,0xd48c9b07,0x48e0cc6c,0x41631000,0x9b489baa,0x9b8a9307,0x10006246,0x83291000,0xaba7aba8,0x8307abe9,0x080028a0,0x000018a1,0x9c2b4a25,0xab859325,0x9be6abe5,0x00006ac7,0x106118a2,0x5a460000,0x92e29326,0x7ac38ac2,0x000049e3,0x08400820,
-0x00000000,0x00000021,0x08000000,0x08400000,0x00000000,0x08000841,0xac6a49e2,0x7a84ac08,0x08610800,0x00000020,0x00000000,0x00000000,0x00200000,0x08000820,0x5a4428c0,0x6a415a01,0x8ae37261,0x7aa469e0,0x08005a04,0x08201021,0x31210000,0x59e15a02,0x49a151a1,0x20804981,0x00210820,0x08000000,0x520428e1,0x49625a24,0x08002860,0x08200800,0x08000020,0x51a21000,
-0xac288b46,0xb408a385,0x62047223,0x08004963,0x08000800,0x00000000,0x00200020,0x08200000,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200020,0x49642061,0x51c351a3,0x30e05a04,0x00200000,0x00210000,0x08000000,0x41841880,0x72867287,0x498359e5,0x08001020,0x00000800,
-0x08400020,0x48c01800,0xc40a9ae6,0xb40bcc6c,0x08004142,0x10201061,0x51620800,0xc387b388,0xbb67bb66,0x38c0a388,0x10410800,0x39011040,0xe4ccc44b,0xf52edc2a,0xfed7fe96,0xdd0efe94,0x936be592,0x18c20800,0x00000000,0x00000000,0x00000000,0x18400800,0x8b4b0800,0xd50fe591,0x08008b8b,0x18202080,0x080020a1,0x00210820,0x00000000,0x00000000,0x08000000,0x08001041,
-0xbd113902,0x8bacc532,0x9c8f9c6f,0x080018a0,0xabeb59e5,0xdd4ebc0a,0x080093ca,0x08001040,0x18600800,0x10405226,0x08000000,0xa3cb82e8,0x4943a3ac,0x31230800,0x8b4893cb,0x8b6a72a7,0x080051e5,0x836c1000,0x93688b28,0x10007b08,0x08000800,0x00000800,0x62860820,0xa3e8a3e9,0x8be9acaa,0x080028e2,0x00000800,0x39630000,0xb4069ba7,0x4940a3a5,0x08410800,0x00000020,
-0x00200020,0x00000000,0x00210021,0x08001041,0x28e20800,0x08001061,0xb4aa5a22,0x61c1abe7,0x08610800,0x00000020,0x00000000,0x00000000,0x00210001,0x08001020,0x6a4351e4,0x82c26a20,0x82819303,0xaba78241,0x28607265,0x08210800,0x08000800,0x59e14981,0x5a444980,0x080051e4,0x00000860,0x18400800,0x51e249e3,0x622459e2,0x390259c4,0x00000800,0x00000000,0x08000820,
-0x6ae61860,0x6a6693aa,0x10003902,0x08000800,0x08000800,0x00000000,0x08000840,0x392228a0,0x000018a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000040,0x41012060,0x72434100,0x83689367,0x00200800,0x00000041,0x08400000,0x08000000,0x520551e5,0x00000800,0x08410040,0x00000821,
-0x08200041,0xb3ab2800,0xdc49ecac,0xcc6bbb86,0x1000a3ea,0x10411020,0x10001861,0xbb888245,0xcc29c366,0x10007243,0x18821860,0x8b8b0800,0xfdb0f612,0xe4cdfd2e,0xf695f675,0xfdf2fe74,0xdd71dd0f,0x00003943,0x00000861,0x00000000,0x00000000,0x18810820,0x6a680800,0xcd10f655,0x10201020,0x51841000,0x18206205,0x10411000,0x00000000,0x00000020,0x00000001,0x18820000,
-0x49631000,0xff18ee56,0xe6b8ff3a,0x080020e2,0xc46c59e4,0xdccad429,0x8bcaee32,0x18a20000,0x83290800,0x7b08bccf,0x08000800,0x38e12880,0x18202860,0x08000800,0x18001000,0x10001800,0x10200800,0x18600800,0x28a01840,0x10000800,0x6a881000,0x416393ac,0x08000800,0x288030a0,0x18803100,0x10001000,0x51e451e4,0x08000800,0xb4476a42,0x59c0abe6,0x10820800,0x00000020,
-0x00000000,0x00200040,0x10610000,0x20600800,0x6aa78349,0x10200800,0x8b671000,0x51818b25,0x00410000,0x00000020,0x00000000,0x00000000,0x08210021,0x28a00800,0x82c36a64,0xbc478281,0x9ae3dd0b,0x92c48220,0x59c47224,0x08410800,0x08001042,0x62633900,0x5a245a02,0x080028c1,0x08600020,0x28801000,0x624251e2,0x82e56a21,0x728682c6,0x08200800,0x00000840,0x08200821,
-0x08200020,0x100049e5,0x08000800,0x00010021,0x08000800,0x00000000,0x20c01080,0x51a44122,0x000018a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30602061,0xb40861a1,0xb4ccc4aa,0x00202901,0x00000021,0x08200820,0x10610820,0x00000000,0x08820040,0x08620861,0x00000801,
-0x08000020,0xdcce4080,0xecc9eccb,0xcc67dc88,0x82e5d4ca,0x10600800,0x08000820,0xb3ca4101,0xcc29d429,0x10006203,0x18821061,0x5a660800,0xff16ee75,0xd4acfe12,0xfeb5feb5,0xfdb1fdf2,0xccceed90,0x00006247,0x00001061,0x00000000,0x00000000,0x08400020,0x41a50000,0x6a88acb0,0x08000800,0xd51261e6,0x69a3b3ab,0x08001800,0x00001041,0x00000020,0x08410000,0x18a20020,
-0x6aa80800,0xee96e635,0xbd95ff3a,0x00000000,0xc48c4100,0xed0bd449,0xa40afdf0,0x08001000,0xcd0e6204,0xbc4bd50e,0x1800ac2c,0x10001800,0x08001000,0x08001861,0x18001800,0x10001000,0x08001020,0x00000800,0x08000800,0x10001020,0xabab82a7,0x9329cc8e,0x10401000,0x08000800,0x10000800,0x82c41800,0xcd0babe7,0x08006ae6,0x93861800,0x59e0bca9,0x08411000,0x00200020,
-0x00000000,0x00000000,0x08000840,0x7a844981,0x8b0682c4,0x10003901,0x28800800,0x49c36245,0x00200020,0x00000021,0x00000000,0x00000000,0x08210000,0x52050800,0x93238305,0xbbe4a342,0x71a09ae2,0x9ae5a304,0x51c482c6,0x08400000,0x08000820,0x622230e0,0x49a35a03,0x08000800,0x00000840,0x62241800,0x8b248b46,0x828282c2,0x726482a3,0x00200800,0x00000000,0x08610041,
-0x00200840,0x08200000,0x08200820,0x00200861,0x00200000,0x00000020,0x290118a1,0x390338e1,0x00001881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x28402041,0xd52c82a4,0xc50cd52b,0x00003142,0x00200861,0x08000000,0x00201061,0x08410861,0x00400881,0x00000000,0x08210800,
-0x08000861,0xbbaa3860,0xe4a8e48a,0xd4a8e4e9,0xb407d487,0x080028a0,0x10601040,0x7aa70800,0xd48adccc,0x18409be9,0x08420000,0x08001881,0xfef7bcf1,0xd4cdfe12,0xfef6fed5,0xed50fe74,0xc48ef5d1,0x10211000,0x00000800,0x00000000,0x00210000,0x00000040,0x00000840,0x08000800,0x08001862,0xf592b42f,0xf550fd71,0x4102bc4d,0x08400800,0x00400020,0x00200040,0x08400040,
-0x52070000,0xff39de35,0x1020bd73,0x08000820,0xedf28b6a,0xed8fdd2e,0xa3caed90,0x08000800,0xb44b6a65,0xd4eecccd,0x9bcbc4ce,0x7b297ac7,0x51c593ec,0x39030800,0x8ae77246,0x72a77265,0x080049c5,0x39a40800,0x41823942,0x7ae849c4,0xa348abaa,0x9b49bbeb,0x00004185,0x39c41060,0x7b466b07,0xdd0aa3c7,0xbc47dcc8,0x20808b88,0x7ae71000,0x5a23bccc,0x10610800,0x00000020,
-0x00000820,0x08400021,0x41410800,0xa386a3e8,0xabc7a364,0x18006a45,0x08001021,0x20e13123,0x00000020,0x00000020,0x00000000,0x00000000,0x08210021,0x62660800,0x82a09366,0xd486c424,0x82418a80,0xabc8ab66,0x100072a6,0x08400000,0x18800820,0x8b476243,0x18606a85,0x08410800,0x08000861,0x936772a6,0x9b648b24,0x92e292e2,0x7263a365,0x00200800,0x00200861,0x00000000,
-0x08401060,0x08401061,0x08400840,0x00000000,0x00400020,0x00000020,0x41c43163,0x38e24122,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000021,0x28201841,0xe58d8ae6,0xbccbddad,0x00000800,0x00000840,0x28e128c1,0x08000800,0x00201061,0x08000800,0x72e84983,0x00003944,
-0x08000020,0xa2e73840,0xd448c3c7,0xd489d489,0xd4ead488,0x10208ba8,0x10401040,0x30a00800,0xdd0cbc4b,0x7b07ddcf,0x10630800,0x00001062,0xfe966a68,0xedb0f5f2,0xfef6fef6,0xe590f653,0x4962c4ce,0x18421000,0x00000800,0x00000000,0x00000000,0x00200020,0x08200020,0x08200000,0x18400000,0xcc6cc4cf,0xf4cdd3c9,0xccceed0e,0x08006a67,0x00200840,0x00000040,0x00000000,
-0x00001061,0x94906b4b,0x08000000,0x6aa80800,0xd5b2de14,0x72a88b8b,0x72c9832a,0x00000000,0x51c428e1,0x7b087b08,0x72a651c3,0xac6c9beb,0x6203c4cd,0x5a251000,0xbbc6b3e9,0xcccccc69,0x10008349,0x9bcc1800,0xa3c99348,0xa3eca3cb,0x936aac2d,0x7b086204,0x000041e6,0x7b8a20c1,0xd58dc56f,0xe56ae5cc,0xcc89c406,0x1000a409,0x51e61000,0x100072ca,0x08010800,0x00200000,
-0x10620000,0x08000820,0x8b245a23,0xa3639b64,0xa365bc26,0x41028b07,0x10620800,0x00000000,0x00000020,0x00000020,0x00000000,0x00000000,0x08610020,0x28c00000,0xabe49366,0xcc64cc64,0x8a81cc67,0x9b879b24,0x082049c3,0x08400840,0x39820000,0xac4b7ac6,0x080072e8,0x00201061,0x18800000,0x82a38b47,0x9b037200,0xd4a9bc06,0x7ac4a364,0x08201000,0x00000800,0x20802901,
-0x08000800,0x08200820,0x00000000,0x10601060,0x00210020,0x00000021,0x51e43983,0x498451c3,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20201020,0xe58e8b06,0xb4cce5ee,0x00000800,0x08001081,0xa42d5a25,0x20806246,0x18000800,0x93696225,0xc50fac2b,0x080049c4,
-0x08001081,0xbc0b2000,0xd46ac409,0xc408b387,0xdd4cdcea,0x5a25bccd,0x10610000,0x08001061,0xddb082e7,0xbd4fddf0,0x00011061,0x10810021,0xb48f1000,0xedf1e5b1,0xf6d6f6b5,0xddb2ee54,0x10007b08,0x08001861,0x00000000,0x00000000,0x00410000,0x00200020,0x39640800,0x292362e9,0x08000000,0xe5716a66,0xe4cded0f,0xdd50d48c,0x0800cd52,0x10820820,0x00000881,0x00000840,
-0x08200000,0x00200000,0x00000860,0xde166aa9,0x0800ac8f,0x08000800,0x08000800,0x08200820,0x08000800,0x10001000,0x18001800,0x6a231000,0x61c1cced,0x49a31000,0xcc48c48b,0xd52dc448,0x10007b28,0xac2d2860,0x9b26c48c,0x492148e0,0x30e04121,0x18602060,0x00000000,0x31001060,0x49604160,0xccea9365,0xb408ab85,0x10009bc9,0x08001000,0x08000800,0x00200000,0x08200000,
-0x08000820,0x08000820,0x9ba57ae5,0xa32192e1,0xa3a5c445,0x18208b07,0x00000800,0x08000800,0x00200000,0x00000820,0x00010001,0x00000000,0x00400000,0x10001060,0xc4ca72a4,0xd4a6cc85,0x8a60c446,0x9bc88260,0x00003141,0x00000861,0x5a861080,0x62446a65,0x000028c0,0x00400860,0x52260000,0x82c48306,0x8ae58ac5,0xa3a6a3a6,0x8b47a3e8,0x08400800,0x08001041,0x93ca51e3,
-0x39427b08,0x08000800,0x31230800,0x28e24184,0x00010000,0x08000822,0x49823942,0x41425182,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x20201020,0xdd6e7aa5,0xc54fee31,0x00001020,0x08001061,0xddb17ae7,0xc4add570,0xabaa9308,0xab66ab88,0xb42ab3a7,0x08004983,
-0x08200840,0xabec1800,0xd4cdc48d,0xb3c9ab68,0xc46acc8b,0x93ebcd2f,0x08620000,0x08000841,0xb4cf1820,0xbd71de33,0x00005267,0x10600860,0x5a060800,0xd5b1c531,0xe696ee95,0xacb0ff18,0x08400000,0x08210820,0x00000000,0x00000840,0x00000000,0x18820000,0x832b1000,0xc593ff19,0x18800000,0xc5320800,0xfed8ff3a,0xf698ff19,0x0000730a,0x002110a2,0x10810000,0x00000000,
-0x00000020,0x108210a2,0x00000020,0xc595b553,0x08001841,0x08001020,0x08001020,0x08000821,0x10000800,0x18001800,0x20601000,0x49820800,0x6a23cd0d,0x08001000,0xcced8b28,0xc52edd8f,0x080049c4,0xb4ae1000,0x61c1d54f,0x10001800,0x08000800,0x08001000,0x08210000,0x08000000,0x10000800,0x5a241000,0x9ba79b87,0x080072e8,0x08410000,0x08401081,0x00000000,0x00000841,
-0x18400800,0x080018a0,0xa3c830c0,0xcc45c427,0xc4a8ab82,0x00005a43,0x20c10840,0x41616a86,0x08400800,0x00000820,0x00000001,0x00200000,0x00400060,0x08000861,0xb42a38e0,0xcc46dd0a,0xbc27b3c5,0x7ae5abe7,0x10600800,0x00000861,0x62882923,0x31215a46,0x08400000,0x00400000,0x39c50000,0x49615a25,0x49834142,0x41814182,0x312149e3,0x00210000,0x10000841,0xa4095a03,
-0x9348abc9,0x30c051a2,0x51c44962,0x39224982,0x08010800,0x08200001,0x49c33122,0x392151c3,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10001040,0xf6b56224,0x9c6eff58,0x10620800,0x08001881,0xe5b08b28,0xdd0dfe31,0xb327c3e9,0xa325ab05,0xabe9c449,0x00003901,
-0x08200840,0x51a40800,0x59a359a3,0x69e469e4,0x61e269e3,0x39014920,0x00000820,0x08400000,0x31230800,0x314141a3,0x00002902,0x00000840,0x08000840,0x418228e1,0x62a75a25,0x20e262a9,0x08620000,0x10610020,0x00200020,0x00000000,0x00210000,0x18610000,0x938c1000,0xff18ff18,0x000083cc,0x29240000,0x94308bef,0x7b4ca471,0x08200800,0x84100000,0x080062ca,0x10401020,
-0x00000000,0x00210000,0x00000840,0x18a120e2,0x00000000,0xb5123144,0xb513de57,0x08000000,0x93ab5205,0x936a9349,0x39228b4a,0x49c30800,0xa388cced,0x08002880,0x9bec1000,0x49a2c550,0x08000800,0xee96bd52,0x4960bcad,0x49a41000,0x6a876246,0x5a466245,0x080020c3,0x49c528c1,0x288151e6,0x18400800,0x7b278b69,0x000028c1,0x00400860,0x00200040,0x08600020,0x08000820,
-0x8b694961,0x100049e3,0x6a451000,0xcc89cccb,0xa428c468,0x10800800,0x41600820,0x6a22a3c8,0x08410800,0x00000820,0x00000001,0x00000000,0x00200040,0x10410001,0x49211000,0x7a429b47,0x9b878ac4,0x28c08b67,0x08400800,0x00000020,0x10401040,0x00000800,0x00200840,0x00000020,0x00000840,0x08000800,0x08000800,0x00000800,0x00000800,0x00210020,0x08000841,0x938851c3,
-0x69a18ac5,0x72447a85,0x6a0469c3,0x38e06203,0x10410800,0x00000001,0x39431860,0x49a451e5,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08001020,0xb53149e5,0x0000732b,0x10410800,0x08001881,0xc44b7265,0xcc08c429,0xc3a7c387,0xb40ac409,0x6245b46c,0x08200800,
-0x00200000,0x08001020,0x08000800,0x10000800,0x08000800,0x00000800,0x00210041,0x00200000,0x00000840,0x00000000,0x08200800,0x08200800,0x00200820,0x00000000,0x00000000,0x00000000,0x00210842,0x00000000,0x00001081,0x00000000,0x00000000,0x18810841,0x9bcd1000,0xfef8ff39,0x3164e677,0x00010000,0x00000001,0x00000800,0x000018a2,0xf71a83ad,0x9c2ef6f9,0x08001000,
-0x00001060,0x00010021,0x00200020,0x00000000,0x000018c2,0xf73aa4f2,0xe698ff5b,0x08000800,0xf67393aa,0xe58fd52d,0x6224ddb1,0x51a30800,0xd4abc449,0x3922b44c,0x08200800,0x080018a0,0xa4af0800,0xff18ffdc,0x30c0ac6c,0x72c81000,0x9b698ae8,0x938aac0b,0x08004185,0x8b8b51c5,0x83099bcb,0x08001820,0x08001040,0x08400000,0x00610020,0x00000020,0x00000861,0x8b460800,
-0x9b24abc7,0x41a19c08,0x10201000,0x41414962,0x28c04982,0x00000000,0x8b243100,0x82a3bc27,0x08601000,0x08400020,0x00000000,0x00000800,0x00200020,0x00000862,0x08001040,0x10001000,0x10001000,0x00000800,0x00200840,0x00000840,0x08000800,0x08200000,0x00200040,0x00000020,0x10400820,0x10401020,0x08400820,0x10401040,0x10601080,0x00000000,0x08200000,0x52050800,
-0x7a857ae7,0x92e78265,0x82039285,0x61e37a03,0x08002060,0x08410841,0x08000000,0x20e320c2,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08210000,0x08000800,0x000018a1,0x00010000,0x10610821,0x18200800,0xccaca3ca,0xc408c429,0xe50ed44a,0x6a24b40a,0x080028c0,0x00400820,
-0x00200020,0x10410800,0x18a118a2,0x18801881,0x108118c2,0x18a218a2,0x00410882,0x00000040,0x08610000,0x20e31082,0x18a21061,0x084118a2,0x08410020,0x08810841,0x18c31061,0x20a320c3,0x08211883,0x524728e2,0x08600000,0x00000020,0x00000020,0x10610020,0x8b2a1000,0xe5b2edb3,0x41c5c593,0x10820000,0x08001000,0x08000800,0x00001081,0xd5b46ac9,0xdd92d572,0x4122bcb0,
-0x08200800,0x00010001,0x00000021,0x08400861,0x00000040,0x9cb05268,0xcdd5de57,0x08000800,0xee119389,0xdd0cd4eb,0x7285d54f,0x51a31800,0xd4ebd50c,0xd5d4cd0e,0x00004207,0x000010a1,0xff7bad11,0xee55f697,0x2060bd0f,0x83291000,0x8aa59348,0x93699b89,0x08003923,0x83495a05,0x6a678308,0x00002082,0x08410000,0x00000841,0x00000020,0x08400021,0x5a250800,0xbc48b48b,
-0xe56bcc66,0x5203cd4d,0x08000800,0x08000800,0x08000800,0x080010a2,0xcd0b72a4,0x8b04d4ca,0x10811000,0x00000000,0x00000000,0x00000000,0x08200820,0x08410000,0x08200841,0x106018a2,0x08211041,0x08610841,0x08610000,0x10601040,0x10401860,0x00200820,0x00000000,0x10600840,0x20801860,0x18601880,0x18601040,0x18601840,0x00000800,0x08001040,0x00000000,0x08000800,
-0x59c41000,0x92c77205,0x9a859264,0x82648a23,0x28c17aa7,0x08200800,0x00000821,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08800000,0x08411062,0x08000820,0xd5916266,0xd54df652,0xccedc48a,0x936ac4ad,0x080030e1,0x10610800,0x00000820,
-0x08200000,0x10001020,0x08000800,0x10201000,0x08000800,0x08001000,0x00000000,0x00200040,0x10410820,0x08000800,0x00000000,0x00000000,0x00000840,0x00200000,0x08200000,0x08000800,0x08000800,0x940c93ec,0x08610000,0x00000001,0x00200000,0x10200020,0x7a671000,0xc4aecc8d,0x080072e8,0x18401820,0x5a0472a8,0x62a66a85,0x18a10000,0x83291000,0xc42ac48c,0xa38acc4c,
-0x08206267,0x10a30821,0x00001082,0x00000000,0x08400020,0x00000000,0x734b5247,0x08000820,0xcc8d7a66,0xccadbbea,0x7a66d530,0x41011800,0xdd90d54f,0xc593ddf3,0x00003985,0x080018c2,0xff9c9470,0xf6d6de14,0x0800bd51,0x93ec1000,0x9327ac2c,0x8b4a9b8a,0x100030e2,0x6ac85a26,0x08003142,0x00200000,0x00000020,0x08400020,0x10821082,0x08001082,0xbcac6a86,0xcc26c428,
-0xe58bd4a6,0x10008b89,0x39850800,0x734b83cd,0x41c562a8,0x08000800,0xc50e49a3,0x8b45d54b,0x10820800,0x00000000,0x00200000,0x00400000,0x4a260000,0x08002942,0x08000000,0x00200000,0x00400000,0x00400000,0x08001080,0x10000800,0x08000800,0x00210820,0x00200021,0x08000000,0x10000800,0x18201800,0x41003080,0x30c030a0,0x28e04140,0x00200000,0x00000000,0x08410841,
-0x08000800,0x6a2530c1,0xbbe98264,0x8a8492a4,0x82c79b27,0x080030c1,0x08410840,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x08400000,0x00200860,0x08410821,0x8c0e0000,0xff17eeb7,0xddd0ee53,0x9beaddd0,0x08003941,0x10820000,0x084118a3,0x00200020,
-0x00000040,0x72872040,0x8b6a8b6b,0x836a8b6a,0x93cc93ab,0xac9093cc,0x2923942e,0x08410000,0x10200820,0x9c717b4d,0xa5139c91,0x31a69cf3,0x08410000,0x00000841,0x8c3039c6,0xacd39c92,0xc5b4a491,0x940dff7a,0x10a20000,0x00000021,0x00000000,0x18610000,0x6a471000,0xc510d572,0x08003962,0x9bee1000,0xee75ee76,0xeeb6ee95,0x00007b8c,0x5a250800,0xfeb5fe95,0xfe55fe34,
-0x0000acb0,0x00000821,0x18a20000,0x00000820,0x00000000,0x18a11081,0x00000000,0x080018c3,0xff19830a,0xf676fe97,0x7aa8ee36,0x18401000,0xeeb6cd72,0x28e2c593,0x00000800,0x00000000,0x6aea0000,0xc592bd72,0x10208bcd,0x52050800,0x59e46a86,0x51c559c4,0x08001881,0x08001040,0x08400000,0x00200040,0x00000020,0x10401060,0x08000000,0x10000800,0xabea4141,0xed6cd4cb,
-0xac48e58b,0x10201020,0xa4d20800,0xf739f75b,0xd5f4ff18,0x10401020,0x7b080800,0x8367d5f0,0x10620800,0x00000801,0x00000000,0x08600020,0x7b8a0800,0x30c08bca,0x28a04141,0x20c12080,0x000010a1,0x08600020,0x52030800,0x72857285,0x5a257ae6,0x00001881,0x00000841,0x6ac720c1,0x8b678348,0x93469387,0xabc7a386,0xa3a79b66,0x8b88c4cc,0x08400800,0x00200840,0x08410000,
-0x08200021,0x20600800,0xb42b61e4,0x71e19b27,0x722469c1,0x39647ac8,0x00210000,0x08400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000021,0x00200000,0x00200020,0x08211042,0xad130000,0xff7bff5b,0xc5b3ff39,0x08005a46,0x18c10800,0x08610860,0x08200000,0x08400000,
-0x08000041,0xd4cf40a0,0xdd50e591,0xee12edf2,0xee12ee11,0xff9aee13,0x49e5f6d8,0x10a20000,0x28c20800,0xfffee6da,0xffffffbe,0xb575ffdf,0x18c20000,0x00000841,0xe6db3986,0xffffffbe,0xffffffff,0xa4b1ffdd,0x10820000,0x00000000,0x00000000,0x08620001,0x08200000,0x292241e5,0x00000020,0xff3c6acb,0xff9cffde,0xffbdff9c,0x20a3de9a,0x00000000,0x9c4f7b6c,0x9c8f944e,
-0x08005a88,0x6b2d18c3,0x00003186,0x10810840,0x00200000,0x08200000,0x08401081,0x00000841,0x838c3965,0x5a486289,0x31035a89,0x08000800,0x41c53143,0x08000000,0x94100800,0x41e8ce19,0x00000000,0x00000800,0x10600000,0x08000820,0x10000800,0x08000800,0x00200000,0x08200841,0x00010841,0x00000040,0x10810881,0x18200800,0x93ea51c2,0x08006ac8,0x49840800,0x626572a7,
-0x41627ae7,0x08200000,0xd636732b,0xff18ee97,0xf694fef5,0x100093aa,0x29220000,0x5286944d,0x08410000,0x08200000,0x00000000,0x10600820,0xac8b0800,0xbc26bc89,0x9b66a364,0xa46c9be8,0x08003963,0x08000821,0xac6930e0,0xb3c7c46a,0xbcaac488,0x08004183,0x08001081,0xb46a3900,0xc426bc27,0xc446cc87,0xd4a8c446,0xdcc9dca8,0xa366dca9,0x08201000,0x00200040,0x00000020,
-0x08400800,0x00000820,0x29020820,0x62044983,0x62055161,0x20e251e5,0x00200000,0x00000820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x10810860,0x08210821,0x08200000,0xc5b56aeb,0x0000944f,0x10800820,0x10a10880,0x00000840,0x5a8918a2,0x00002123,
-0x08000841,0xe5305100,0xfe95f5f2,0xf653fe95,0xee12e5f1,0xf655e5d2,0x4184cdb3,0x10620000,0x28a21000,0xffdee6b9,0xffdeff9d,0xf77dffff,0x00004a49,0x18811082,0x9c710800,0xffbeffde,0xf7bef7bd,0xa4f2fffe,0x10a20000,0x00000000,0x08210000,0x00010000,0x00200841,0x00000000,0x000008a2,0xffbeb535,0xffdeff9d,0xff9effde,0x8bf0ffbf,0x20e30000,0x00000000,0x00000000,
-0x00000000,0xf77e630c,0x7bcfdeba,0x00000800,0x00000841,0x00200000,0x00000000,0x08410000,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x00000820,0xf77d9431,0xce5affff,0x000031a6,0x08200000,0x00000000,0x08200840,0x10410820,0x08401060,0x00000020,0x00410000,0x08410021,0x08600020,0x08000000,0x7ac551e3,0xd5d1bccc,0x10009c4d,0x08001861,0x08000800,
-0x08000800,0x41e60000,0xffbbe6d9,0xff79ffbb,0xd5afff15,0x3141b4cd,0x00200840,0x00000000,0x00200840,0x08000000,0x00000000,0x08000840,0xa4091000,0xd486d509,0xb3c5bba4,0xa40abc89,0x10610800,0x08001061,0xc4c972c3,0xbb84b385,0xbc67bbe4,0x08004141,0x10001040,0xccc951a0,0xd464cc66,0xd484dca5,0xe4e6d485,0xdc86e4c7,0xab45d406,0x10202000,0x00000020,0x418418a1,
-0x10001000,0x08611040,0x00200061,0x41a40800,0x41436a88,0x08000800,0x00000840,0x08200840,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x00000000,0x10621041,0x00000841,0x00000000,0x00000000,0x08601061,0x00001081,0x8b8e2061,0xef3cde79,0x00004207,
-0x080018c3,0xe5504900,0xff5aee35,0xffbcff5a,0xff7aff5a,0xff3aff1a,0x5a88e6b8,0x18a20000,0x49651000,0xffdeff1b,0xfffeff9d,0xf7ffffff,0x0000bdf7,0x10611061,0x31440800,0xffdede99,0xfffeffde,0xad73ffdc,0x08820000,0x00000841,0x00000800,0x08210821,0x31660000,0x21234208,0x00000020,0xff5d6aec,0xf7beffff,0xf7def7de,0x7b6dffdf,0x18610800,0x10000800,0x08001000,
-0x08000800,0xe6db41c7,0xff9effff,0x5aaace38,0x10410000,0x08411041,0x00000840,0x00000021,0x18820000,0x086118a3,0x088110a1,0x00200000,0x5a894207,0x9cb2528a,0xfffff79d,0xfffff7de,0x9cb2deda,0x9cb2ad35,0x296494b1,0x08620000,0x00000000,0x00000000,0x00000000,0x00200000,0x10c20061,0x00000861,0x9c6c41c3,0xbccbddf0,0xd5b1c50d,0x08007308,0x5a681020,0x49c57b2b,
-0x39445a48,0x29220800,0xffdce6f8,0xffdcf77b,0xe653f6f6,0x41c4de54,0x08410820,0x08000800,0x00210820,0x00010001,0x00000000,0x00000821,0xb4ac28a0,0xed8bdd2a,0xbc28ed6c,0x49a1cd2d,0x08600800,0x08001061,0xd52aac69,0xe4eadceb,0xd50aed8a,0x100049a2,0x08001860,0xbc884980,0xdcc6cc86,0xd4a4e4e6,0xdca4dca4,0xd445dc85,0xbbc8d467,0x08002000,0x08001041,0x9b8938e0,
-0x48e08265,0x10401000,0x08401061,0x08000800,0x080020a2,0x08200820,0x08410020,0x00000000,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x20c20820,0x62a941a5,0x00000800,0x10821082,0x10a20882,0x08610881,0x08001041,0x732c0800,0xff5dddf7,0xf77dffde,0x000062eb,
-0x08001082,0xf5f448e0,0xf75bff1a,0xffdeffbe,0xfffdffbd,0xffbdffdd,0x6b4bffbc,0x20c20000,0x62281000,0xffdeff3c,0xffdeffde,0xfffff7de,0x4a69f79e,0x10610000,0x00001882,0xbdb65a69,0xfffeff9d,0x7bacff9b,0x10a30000,0x00000000,0x00000000,0x10420800,0x9c720800,0xc617f79d,0x080018a2,0xbd960800,0xffffffff,0xfffef7dd,0x0800bd95,0x20821000,0xeebac5b6,0xd638de39,
-0x000062ea,0xa4f30000,0xffbeffff,0xff9effff,0x08009451,0x00001862,0x18c20020,0x00210021,0x00000000,0x00000000,0x00200000,0x00000861,0xff7da4f2,0xffbeff7d,0xf7feffde,0xf7fef7fe,0xfffffffe,0xffbeffdf,0x1903b5b6,0x08410000,0x00000000,0x00000000,0x08210001,0x10a20861,0x00000020,0x08000820,0xf6f6940d,0xff36fef4,0xee96ffda,0x08003122,0xf71a6ae9,0xf6fbffbd,
-0xcdf6ff3c,0x080028c2,0xd6b77b8c,0xffdcef5a,0xff38f717,0x0800ad10,0x18830800,0x93efb4f4,0x08410000,0x00010801,0x00000000,0x00000841,0xb4ed1040,0xfe70cd4c,0xcd0efeb3,0x102072a6,0x10c20840,0x732a0000,0xd54cff35,0xe52ce54d,0xe60fedac,0x08005a25,0x10001861,0x9be730e0,0xe549d54b,0xd4a4dd07,0xe526e526,0xd4a7e507,0xb3e9bbc5,0x08003080,0x08001041,0xabeb4101,
-0x9b28c44c,0x080059e4,0x10400800,0x08200800,0x08000000,0x18810800,0x08001040,0x30e230e2,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20612082,0xf6b9832b,0x62ebcdf7,0x00000000,0x00201082,0x10400840,0x5a490800,0xff7dbd95,0xff9effbf,0xef7dffbe,0x00006b4c,
-0x10001882,0xfeb75963,0xffddff9c,0xefbdf7de,0xfffef7dd,0xffdeffde,0x630af77c,0x20c20000,0x62690800,0xffbeff7d,0xffdeffbe,0xef5cffff,0x20c39472,0x10610000,0x10810820,0x08000000,0xe6777b4c,0x944fff9b,0x10a30000,0x00000000,0x00200000,0x18820000,0xacf30800,0xfffeffde,0x08009cb1,0x49e80800,0xff5ce69a,0xeefaff5b,0x00005a89,0x94500800,0xfffeffdd,0xffffffde,
-0x0800c617,0x39860000,0xf75dd639,0xf73cef1b,0x0800734d,0x31450800,0x00000000,0x10a20841,0x00000861,0x00000000,0x00400000,0x00000041,0x9c512904,0xff9eeebb,0xfffeffdf,0xffddffdd,0xef3cffde,0x62ebbdb6,0x00000000,0x00000841,0x00000000,0x00000000,0x10821082,0x00000000,0x943041e8,0x080041c6,0xde985228,0xff3aff3a,0x9c2fff5b,0x10600800,0xfffdce16,0xffffff9d,
-0xffdefffe,0x10009c10,0xbdb41040,0xf77afffd,0xeed8ffbb,0x08003123,0x83ae0000,0xc575ffbe,0x08610000,0x00000821,0x00000000,0x08800040,0xad2f0000,0xc56ede52,0x28a093eb,0x08200800,0x08820021,0x52470000,0xee93b52f,0xcd2df673,0xf6f4e630,0x000062c7,0x08001882,0xbd4e3961,0xff34ff35,0xdd69fe6e,0xedaaedaa,0xe56bedcc,0xb42bdd2c,0x08002840,0x00001882,0xfed95a27,
-0xb42cf634,0xbd32ddb3,0x080041a5,0x08001020,0x08210000,0x00000861,0x59a32040,0x59838aa7,0x08211000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10410820,0x20201820,0xff5b82ca,0xffbeffbe,0x632cbdf7,0x08610000,0x10200820,0xd5d71000,0xff7dffdf,0xffbeffbe,0xef9df7bd,0x0000632c,
-0x080020e3,0xff1a7a88,0xef7dffbd,0xfffff7de,0xfffefffe,0xffffffde,0x5acaf79d,0x20a20800,0x62490800,0xffdfff3c,0xffdeffff,0x4a48c617,0x00000000,0x18621041,0x10611081,0x18a118a2,0x28c10800,0x942facd1,0x08610000,0x00000021,0x00000000,0x10810840,0xb5130800,0xffddfffe,0x2903e6da,0x08000000,0x5a283104,0x41c55a48,0x00001061,0xf75d5249,0xffdeffde,0xffffffff,
-0x6b0bf77d,0x00000800,0x41c720e3,0x39a64a08,0x08000800,0xe6db4a08,0x630bc5f7,0x00000000,0x08410000,0x00200000,0x00400020,0x08210000,0x08000000,0x838e28c3,0xf75cc5d7,0xde78ff9d,0x52499430,0x00000000,0x08410841,0x08400000,0x00000000,0x00000821,0x08200000,0xad1539e7,0xffbfef1c,0x0800acf2,0x39660000,0x49a75a29,0x208251e8,0x94310000,0xffdeffbd,0xf7beffff,
-0xffdeffde,0x4125ee7a,0x4a070800,0x7b6b7b8c,0x62887b6b,0x00000800,0xd6772923,0xc574ffdd,0x10810000,0x00000821,0x00000000,0x00400020,0x8c4d0020,0x10408c4b,0x08000800,0x08411882,0x08621083,0x00001062,0x83aa0800,0xff57cdd1,0xeef6fff9,0x082039c3,0x08001062,0xde525203,0xff56e6d5,0xe5edff33,0xfeb1e5ee,0xfeb4feb2,0xee55ff57,0x08004984,0x000018a3,0xff7c62cb,
-0xfeb7ff5a,0xff5aff18,0x5227e698,0x18610800,0x08410841,0x734b0000,0xc4efbcf0,0x61c3c44c,0x08411000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x28402881,0xff1b8aca,0xffffffbd,0xef5dffff,0x0820630c,0x188218a2,0xa4720800,0xffbeffbe,0xf7bdffde,0xe75bf7dd,0x0000632b,
-0x080018c2,0xff5c830b,0xffffffbe,0xfffff7de,0xffdefffe,0xffffffff,0x5289f79d,0x18810000,0x49a61000,0xffdff73c,0x738dd679,0x00000020,0x108110a2,0x000018c2,0x08000800,0x10610000,0x000018a2,0x00200840,0x00000061,0x00000000,0x00000000,0x10610021,0xb5340800,0xffdeffbf,0x9c70fffe,0x18a20820,0x10000800,0x00001000,0x000018a1,0xffdf9430,0xffbfffbe,0xffdff7df,
-0xb575ffff,0x20c30000,0x00000000,0x08000000,0x100020a2,0xffbe9c71,0xffbeffde,0x9492ce58,0x00002924,0x08410862,0x004110a2,0x00210841,0x08620862,0x00000801,0x52280000,0x18416aeb,0x00000000,0x10a21061,0x00000821,0x08400861,0x10a318c3,0x00210000,0xc61773ad,0xffffef7d,0xffffffff,0x4206ef3b,0x00000820,0x10000800,0x10000800,0xa5140800,0xffdeffdf,0xf7fff7df,
-0xffffffdf,0x72acff5f,0x08000800,0x08000800,0x08000800,0x082020c3,0xf7798c2d,0xacd0f6f8,0x10a10000,0x00000021,0x00000000,0x00000000,0x00200860,0x00200000,0x10411881,0x00001041,0x00000800,0x18a21061,0x00001060,0x8bec1880,0xf77ae6d8,0x00004a26,0x08001882,0xd5f041a1,0xff16ff36,0xfed4f672,0xff58ff17,0xfffcff9a,0xffbcffbb,0x08007b4c,0x002018c2,0xf77d528a,
-0xf71aff5b,0xff9bffdc,0x28c1d616,0x10410800,0x00000840,0xef3b840e,0xff3aff9c,0x7287f656,0x10610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000820,0x20002861,0xff3b8aca,0xf7beffde,0xffffffff,0x0000deba,0x10610000,0x20620800,0xffbede59,0xf7ddfffe,0xfffefffe,0x0000634b,
-0x000018e3,0xff5c72ea,0xffdeffde,0xffdfffdf,0xffdeffff,0xffdfffbf,0x5289ef5d,0x18a20000,0x39450800,0xa4f3ce17,0x000020c2,0x10a20820,0x000018c2,0x52890000,0xb555bd96,0x08005248,0x10620000,0x00200861,0x00200020,0x00000000,0x00000000,0x10820020,0xb5140800,0xffdfffbf,0x62eaef1b,0x08000000,0x52083945,0x41e741c7,0x00001081,0xde792904,0xf7bfffff,0xffdfffdf,
-0x62ebf77d,0x10200000,0x5aaa5aaa,0x4a075268,0x08001861,0xef1b41a6,0xffdeffde,0xffffffff,0x39a6d679,0x00000000,0x00000000,0x08411082,0x00620021,0x10820821,0x08001061,0x10000800,0x106118a2,0x00000800,0x18831042,0x00201061,0x00000000,0x08410842,0xffffd679,0xffbfffdf,0xfffff7bf,0x0840c5f6,0x62ea0000,0x628a83ae,0x49e77b6d,0x21040000,0xffffd6ba,0xffffef9e,
-0xfffff7be,0x2022d5d8,0x5a8a0800,0x62eb8c10,0x4a2862eb,0x00000000,0xd6554a26,0xb531ff9a,0x10a20000,0x00000021,0x00000000,0x00000000,0x00000000,0x08200861,0x10620821,0x39860800,0x5aa99471,0x08000000,0x188118a2,0x00000800,0x9cd14207,0x000039e6,0x080018a2,0xbd703940,0xff38ff78,0xff18e654,0xff9cffbb,0xffbdffbd,0xffbcfffd,0x08008bee,0x000010a1,0xef1b39c7,
-0xff9cffbd,0xff7bff5b,0x08006ac9,0x10611881,0x4a480000,0xffbdef3b,0xffbdffbd,0x6aa9ff3a,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x20201841,0xff3b8aca,0xffffffbe,0xfffef7bd,0x634cffde,0x10a20020,0x00001082,0xffdf83ae,0xffdeffde,0xffbdffff,0x002062ea,
-0x000018c3,0xff3c51c6,0xffffffdf,0xfffeffff,0xfffeffff,0xffffffdf,0x5289f7be,0x10610000,0x08200000,0x08003145,0x20a20800,0x000020a2,0x31240800,0xef3c8c30,0xffffffde,0x83efef3c,0x08211042,0x08610840,0x00000000,0x00000000,0x00000000,0x10820020,0x9c920000,0xffdeffff,0x00009471,0x626a0800,0xf73ceedb,0xef5cf77d,0x0800734c,0x7b6e0800,0xffffffdf,0xffffffde,
-0x0000bd96,0x6aeb0820,0xffbeef3c,0xf79df79d,0x08007bae,0x83ef0800,0xfffff79e,0xffdeffff,0x0000ce37,0x31450800,0x00006b2c,0x00000000,0x088208a2,0x08200020,0x10610840,0x10411041,0x08200800,0x18810820,0x08000000,0x39c60000,0x6b0b9cb1,0x00000000,0xffff83ef,0xffdfffff,0xffbfffdf,0x080062ca,0xde783123,0xff9dffde,0xce17ffde,0x00001040,0xffbf738e,0xfffeffff,
-0xf77dffff,0x1000628b,0xde7928e3,0xf79effdf,0xdebaffde,0x082028e3,0x94700000,0xad12ffdd,0x10810000,0x00000020,0x00000000,0x00000000,0x00000020,0x08610040,0x00000000,0xdedb9451,0xf75cff9d,0x18a19c91,0x00000800,0x18c318c3,0x00000000,0x00000841,0x08001061,0xe6b82902,0xfffdffdd,0xffbcffbc,0xfffefffe,0xfffefffe,0xfffdfffe,0x00007bce,0x000020e2,0xff5c3104,
-0xffddffde,0xc5b5ffdd,0x08610000,0x10a20040,0xad330000,0xfffefffe,0xffddffde,0x93edff9c,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x10001061,0xff1b7aaa,0xfffeffff,0xffdeffff,0xc638ffff,0x08610000,0x08410861,0xc5d71041,0xe6dbf75c,0xd659eefb,0x00005aaa,
-0x08001082,0xd5d72062,0xf73cf73c,0xffbdf73c,0xffbdf77d,0xffbeff9d,0x39a6e6da,0x08200000,0x00200000,0x18610000,0x208220a2,0x20810800,0xe6baa492,0xffdeffff,0xffbef7bd,0xdedbffff,0x000039a7,0x00001061,0x00000000,0x00000000,0x00000020,0x08410021,0x4a280000,0x8c509471,0x00002125,0xd6181821,0xffbeffdf,0xfffffffe,0x2904deba,0x08200800,0xc6179cd3,0xbd95c5d6,
-0x00005a6a,0xd6380800,0xffdeffff,0xffffffff,0x20c3deba,0x00000000,0xad548c50,0xbdb5b555,0x00005aa9,0xb5350800,0xdebaffbf,0x4a289cb2,0x00200000,0x00000000,0x08400840,0x08210000,0x08000821,0x00000000,0x7b6e1041,0xef1cc5d7,0xde99fffe,0x08003165,0x83ae1882,0xa492a4b2,0x83aeb535,0x00000820,0xffbd942f,0xff9dfffe,0xffdeffff,0x08009450,0x9cb20000,0xbdd6ce17,
-0x840fbe17,0x08000800,0xfffe83ce,0xffffffff,0xffbdffff,0x0800acd3,0x29240820,0x5a699450,0x08610000,0x00000020,0x00000000,0x00000000,0x00200020,0x00000840,0xbdd72124,0xffffffdf,0xf7bdfffe,0xde99ffdd,0x31248c0f,0x08000000,0x086218c3,0x00000020,0x00000000,0x945118c2,0xce17c5d7,0xc617ce17,0xbdd6c617,0xc5f7c5f7,0xb574b594,0x00004a28,0x00001060,0x9c711882,
-0xb533b574,0x5269ad13,0x08820000,0x00000882,0xc5f62944,0xe6fbef5c,0xf71bf73b,0xa4b1ffdd,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08001081,0xff7d832c,0xad75e6db,0xa513a513,0x7baf9cb2,0x000018c3,0x08410041,0x08200000,0x394441a5,0x29043104,0x00000821,
-0x08620021,0x18400800,0x51e63944,0x6aeb6aa9,0x732b6b0b,0x7b2c7b2b,0x08205aaa,0x08210000,0x00200000,0x18a218a2,0x10000800,0xe6999c30,0xfffeffde,0xffbeffbd,0xffdeffff,0x4a28ce17,0x08420000,0x10811062,0x00000000,0x00000800,0x00000000,0x00210041,0x00000800,0x00000000,0x00000840,0xffbe9c71,0xf7ddfffe,0xf7defffe,0xacf3ffff,0x18820000,0x00000000,0x00000020,
-0x08000000,0xffbe9c71,0xffdeffde,0xffdef7be,0x9cb2ffff,0x18a20000,0x00200000,0x00000000,0x08000000,0xf75d5269,0xffffffff,0xeefcffdf,0x8c30c5f8,0x080028e3,0x08810840,0x08411082,0x00000021,0xa4f32103,0xf77ed69a,0xffffffff,0xffffffde,0x0000a514,0x000018c2,0x00000800,0x00000000,0x39c60000,0xfffede98,0xffffffbe,0xffdfffbf,0x49e6ef1b,0x00000000,0x00000000,
-0x00000020,0x49e70800,0xffffeefb,0xffffffbe,0xffffffde,0x5a49f73d,0x08400000,0x00000800,0x00210021,0x00000020,0x00000000,0x00000000,0x00200020,0x00000820,0x9cd23165,0xffffe6fb,0xf7bdfffe,0xfffefffe,0xe679ffbe,0x20829c50,0x10420800,0x00001082,0x08620000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000021,0x00000820,0x08010000,0x08000000,0x00000021,
-0x00000000,0x00000821,0x00210841,0x08200000,0x18a21061,0x49e83186,0x4a074a08,0x942fbd54,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000841,0xe6597b0c,0x00005a8a,0x00000000,0x00000000,0x10210000,0x00000000,0x10400840,0x08000800,0x00000800,0x00010821,
-0x00000021,0x10001021,0x08000800,0x08000800,0x08000800,0x08000800,0x08200800,0x00200000,0x08400000,0x08000800,0xd6385a48,0xffdeffdf,0xffbdfffe,0xfffffffe,0xa4f3ffbe,0x00000820,0x106218a3,0x00000000,0x00000841,0x00000000,0x00000000,0x00000021,0x08001040,0x00000000,0x000010a2,0xffbec596,0xfffef7bd,0xfffef7de,0xc5d7ffff,0x18820800,0x00000000,0x00000000,
-0x00001061,0xffbe9c51,0xfffeffbe,0xf7befffe,0xc5d7ffff,0x10610000,0x00000820,0x00000000,0x00000000,0xf73d5228,0xffbeffbf,0xffffffbe,0xf77dffff,0x000062cb,0x00000000,0x00000020,0x000010a3,0xde9a0820,0xffffffdf,0xffdeffbe,0xffffffde,0x00009cd2,0x08401061,0x08000000,0x00000800,0x6b2c0000,0xffdeffde,0xffbfffdf,0xffffffbf,0x49e7ef1c,0x00000000,0x00000000,
-0x00000000,0x41c60000,0xffdfeefb,0xffdfffff,0xffffffde,0x5208f71c,0x00000000,0x00010000,0x00010842,0x00200021,0x00000000,0x00000000,0x08610000,0x10400840,0x00000000,0xa53339a6,0xfffff7be,0xffbef7de,0xffdfff9e,0xde38ffde,0x0800732c,0x08410800,0x00000000,0x10820021,0x108118c2,0x108110a2,0x10811081,0x10830862,0x10821041,0x08010842,0x08200000,0x08830021,
-0x10621082,0x08631083,0x00200000,0x10401060,0x00001040,0x00000000,0x08000800,0x18a20800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0x628a49e7,0x10c20000,0x212310a1,0x20e32104,0x18c31862,0x00200861,0x08210020,0x10411862,0x08610861,0x08410861,
-0x00000000,0x10410000,0x20a21061,0x20c220e3,0x20e320c2,0x210318e2,0x104120e3,0x00200000,0x00001061,0xbd343104,0xfffff75c,0xfffefffe,0xfffffffe,0xf7deffff,0x00007bef,0x18820000,0x08000000,0x7b6d5a69,0x00200000,0x00000000,0x00000000,0x08410000,0x5a690000,0x738d8c10,0x08000800,0xff3c49c7,0xffdeffde,0xfffff7bd,0x62aaf75d,0x08000000,0x94307b8d,0x736c83ce,
-0x00003165,0xcdf70800,0xffdeffff,0xffffffde,0x5a89f77d,0x08400000,0xde79ad34,0xad13bd75,0x000062eb,0xa4d30800,0xffffffff,0xffbeffde,0xb595ffff,0x00000000,0xa514630b,0xd69a73ae,0x0000b555,0x7b8e0800,0xffdfffbe,0xffdeffff,0xdeb9fffe,0x080020c2,0xce385249,0xbd55cdf7,0x6acbb514,0x08000800,0xffffc5f7,0xffdeffbe,0xffdfffde,0x00009471,0x6b0c0800,0xacf4acf4,
-0x8befb514,0x00001041,0xffde83ce,0xfffff7de,0xffdeffde,0x08009410,0x5a890000,0x732dbd76,0x08610000,0x00000841,0x00000000,0x00000000,0x00000841,0x18a20000,0x18a21061,0x00000000,0xdeda5aaa,0xfffeffff,0xffffffff,0xffffffbe,0xc5d7f79d,0x08005229,0x00410841,0x00000020,0x08000800,0x10000800,0x08000800,0x08000800,0x08200820,0x00000041,0x10a20861,0x10a31082,
-0x00210841,0x00200021,0x10600000,0x08000800,0x18401020,0x18821020,0x18821861,0x00000841,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08210000,0x08000000,0x10601881,0x00001040,0x00000000,0x00000800,0x08810000,0x00000000,0x08000801,0x00200820,0x00000000,
-0x00000841,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x08410861,0x41c70000,0xffbede38,0xffbdffde,0xfffeffde,0xffdeffff,0xdedaffff,0x08610000,0x080018a2,0xad1341a6,0xd638ff7d,0x08400000,0x00000841,0x00000000,0x10810840,0xb5550800,0xffbeffff,0x08007b8e,0x9c510800,0xffdeffbe,0xfffffffe,0x0000ad34,0x6b2b0000,0xffdef75c,0xffdeffde,
-0x0000b554,0x5a8a0000,0xfffee71b,0xffdef75c,0x0000a4f2,0x7bae0000,0xffdeff9d,0xffffffbe,0x20c2deba,0x4a070000,0xffbee71b,0xffdfffff,0x4a28ef3c,0x00200000,0xffffce59,0xffffffdf,0x5a8af75d,0x18820800,0xf77dce38,0xffbeff9d,0x83cef75c,0x08000800,0xffdfa4d2,0xffdfffbe,0xe69affdf,0x080028c3,0xe6ba49e7,0xff7dff9e,0xce38ffbe,0x000020c3,0xe6db3986,0xffdfffff,
-0xff7dffbe,0x0800838e,0xc5d70800,0xf79dffff,0xd638ffdf,0x08001861,0xcdf71040,0xa4b2ffdf,0x08810000,0x00000021,0x00000000,0x00200000,0x41e70000,0x000039c6,0x08400000,0x18c30841,0x9cd30000,0xffdeffff,0xffffffbe,0xffdeffff,0xffdeffde,0x1000de59,0x00400820,0x21030000,0x52064a27,0x28c23964,0x30e330e3,0x08001020,0x00200820,0x08810000,0x00000000,0x00000820,
-0x00210000,0x00000000,0x08001041,0x396520c2,0x208120a1,0x08002061,0x08201020,0x08410821,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10401041,0x28821861,0x93ce4124,0x94509c91,0x8c509450,0x00004a68,0x10410841,0x41661000,0xce17c575,0x39e7bdd6,
-0x08810020,0x00000841,0x83ae3104,0x94308c10,0x9c509c71,0x94719430,0x4a498c71,0x18a30821,0x730c0800,0xffffffde,0xffdfff9d,0xffdfffff,0xffbeff9e,0xce79ffde,0x18820000,0x31250800,0xffffde59,0xd679ffdf,0x00400000,0x00000841,0x00000000,0x10810020,0xb5550000,0xffbeffde,0x39a5deb9,0x08200000,0x83ce736c,0x9cd29451,0x00003165,0xce580820,0xffdeffbe,0xffdef79e,
-0x7baeffbe,0x00200000,0x6b2c5a69,0x732c734d,0x08002924,0xce381041,0xffdeffff,0xf7bdffde,0x94b1ffff,0x00000000,0x94715aaa,0xb5759c91,0x00007bae,0x8c300000,0xffdfffbe,0xf79dffdf,0xad54ffff,0x00000000,0x62eb39a6,0x732d62cb,0x10406aec,0x29240000,0xffdeef1b,0xffddffde,0xfffef7bd,0x0800a4f3,0x4a080000,0x62ab62aa,0x4a087b6e,0x00000820,0xffffa4f3,0xffdef79d,
-0xffffffde,0x1820d5f8,0x49e70800,0x7b6d838e,0x5a2893ef,0x08000800,0xffbe734c,0xa4b2ffdf,0x10820000,0x00000000,0x00000000,0x10620000,0xa4f30000,0x9cb2ef1c,0x00002945,0x10821061,0x94710000,0xffdfffff,0xf75dffff,0xffdff77d,0xffbeffff,0x1821e67a,0x18c20800,0x9cd20000,0xe71af79d,0xde78de79,0xe6bae6ba,0x83cfde59,0x10810000,0x00000861,0x9c9239a6,0x9c51a492,
-0x082139a7,0x10610800,0x41a60000,0xde79d638,0xc5b6d5f7,0xa4b2cdb6,0x18612904,0x08201021,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x10200820,0x28412881,0xff7ca430,0xffdeffde,0xffffffde,0x0000b5b5,0x106110a2,0x39240800,0xffbdf6da,0xb595fffe,
-0x10820000,0x00000820,0xe6ba1000,0xff9effff,0xffdfffde,0xffffffde,0x9cf3ffff,0x20e30000,0x6acb0800,0xffdef77d,0xdebaffde,0xf73cc5b6,0xffdfffdf,0xc5f7ffff,0x18610000,0x51e81000,0xfffff73c,0xce38ffdf,0x00400000,0x00000841,0x00000000,0x10820040,0xb5750000,0xffdeffff,0x8c2fffde,0x18e20020,0x10200000,0x00000800,0x00001061,0xffbe8c30,0xffffffdf,0xffdfffff,
-0xdebaffff,0x002010a2,0x10000800,0x08000800,0x08001861,0xffbe6aeb,0xffbeffdf,0xffffffde,0xef3cffff,0x00204227,0x08000800,0x08000800,0x00000000,0xeefb3986,0xffbeffff,0xffffffff,0xf7beffff,0x00005aca,0x08000800,0x08000800,0x20820800,0xad340800,0xfffeffde,0xfffefffe,0xfffffffe,0x28e3deba,0x00001040,0x10000800,0x08000800,0x42070000,0xffbeef3c,0xffffffff,
-0xffdeffff,0x836effbe,0x10000800,0x08000800,0x08001000,0x000020a2,0xffdfc596,0xa492ffdf,0x10a20000,0x00200000,0x00000000,0x10820000,0x9c920800,0xffffffff,0x0000a514,0x18a20841,0x83cf0000,0xff9effdf,0x5228ad14,0x9cd25269,0xffffdeda,0x1841f6fc,0x10820800,0xbdb60000,0xfffffffe,0xffffffde,0xffdfffff,0x62cbff9e,0x10810000,0x000018c3,0xffdf9c92,0xf6fcffdf,
-0x000020c3,0x18a21041,0xad340000,0xffdfffdf,0xffdfffdf,0xffbeffdf,0x08009c71,0x080020c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x20810820,0x7aca1800,0xffddf73b,0xffdeffde,0xfffffffe,0x52a9f7bd,0x08610020,0x08001081,0xffbeac71,0xffbeffbe,
-0x00006b6d,0x18a218e3,0x734d0000,0xffdeff9e,0xfffeffde,0xffdeffde,0xa513ffff,0x20c30000,0x41451000,0xce38e6db,0x08407bce,0x5a290800,0xe67ab4b3,0xad54ffff,0x18820000,0x62491000,0xffbeff7d,0xd659ffdf,0x00200020,0x00000861,0x00000000,0x08610040,0xbd950000,0xffffff9d,0x3165e6db,0x00000000,0x08000800,0x08000800,0x000018a2,0xffdf9c71,0xffdeffbe,0xf7def7be,
-0xad34ffde,0x08200000,0x414530e3,0x392430e4,0x10200800,0xcdf80800,0xffdfffff,0xffdeffde,0xde99ffdf,0x00002924,0x20820800,0x08001841,0x08000800,0xd6182904,0xffbeffff,0xffbeffdf,0xef5dffdf,0x00004a08,0x28c31861,0x28c23945,0x184130e3,0x83ce0800,0xffdeffde,0xffdeffbe,0xffdeffbe,0x08008bef,0x39451040,0x416551e7,0x31034185,0x39860800,0xffdfe6ba,0xffdeffff,
-0xffbeffde,0x5208eedb,0x31450800,0x5a89628a,0x41a65a69,0x00001040,0xff9e8bef,0x9c51ffdf,0x10a20000,0x00000020,0x00000000,0x10820000,0xad340000,0xffffffff,0x0000b596,0x10821062,0x632c0000,0x734cbdd6,0x00000800,0x00000000,0x9cd22985,0x0800acf3,0x10810000,0xb5950000,0xffdfffff,0xffdfffbe,0xffdfffbe,0x0800ad14,0x088110a2,0x39860000,0xffffe71b,0x83aeffbe,
-0x10810800,0x00001061,0xef3c5269,0xffdfffff,0xff9effdf,0xffffffbe,0x5aaaf75d,0x10610800,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x00200000,0x080018a1,0xee5830c2,0xffdeffde,0xffdeffff,0xffbeffde,0xb5b5fffe,0x10e30000,0x08001081,0xf6da28c2,0xffffffde,
-0x0000c617,0x08400840,0x00000861,0xffffce17,0xfffeffff,0xffdfffde,0x8c71ffff,0x18a20000,0x18410800,0x08205228,0x10400000,0x08001861,0x20821000,0x83efa4d3,0x18a20000,0x72eb0800,0xffdeff7d,0xd679ffff,0x00400000,0x00000841,0x00000000,0x10820020,0xb5750000,0xffdeffff,0x08008c10,0x734d0000,0xc596cdf7,0x9c71c5b6,0x00001061,0xde791020,0xffdeffff,0xffffffde,
-0x3124e6db,0x4a280000,0xeebade59,0xe6bae679,0x0800acd3,0x5a690800,0xff9ef75d,0xffdfffff,0x838effdf,0x08000800,0xde59838e,0xcdd7cdd7,0x000083cf,0x62aa0800,0xffdfff9e,0xffdfffff,0xad14ffbf,0x08000800,0xe6ba8bef,0xde79de79,0x732ce699,0x08000800,0xffbece18,0xffffffff,0xce18ffff,0x08001861,0xde591000,0xeebaf73c,0xbd75ff3c,0x08001000,0xffdf8bcf,0xffdfffdf,
-0xffbeffff,0x08008bcf,0xb5750800,0xf75dffbe,0xd679ff9d,0x00003145,0xd6380820,0xa492ffbe,0x10810000,0x00000821,0x00000000,0x10820000,0xb5750000,0xffffffdf,0x0000ad34,0x00201062,0x21030000,0x00000000,0x18a21041,0x18c21061,0x00000000,0x10410800,0x10820000,0xb5960000,0xf79effff,0xffdfffdf,0xe6fbffdf,0x000039a7,0x10a21082,0xa4f30020,0xffdeffdf,0x1881d638,
-0x10810000,0x000010a2,0xffffb596,0xffdfffdf,0xffbfffff,0xffbeffdf,0xde9affff,0x080039a6,0x00200861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18401060,0xffbeb492,0xffffffbe,0xffffffbf,0xffffffff,0xf77dffde,0x0000528a,0x18811041,0x9c910800,0xffffffff,
-0x83cfffdf,0x18a20800,0x00201082,0xff9e62cb,0xfffeffde,0xffbeffde,0x8c30ffdf,0x18a20000,0x08400020,0x08000000,0x188120c2,0x20a21020,0x082018a2,0x00000000,0x10610840,0x730c1000,0xffdeff9d,0xd679ffdf,0x00400000,0x00000020,0x00000000,0x10810020,0x7b8e0000,0xad34d679,0x080018a3,0xe6bb20a3,0xffffffff,0xffdeffff,0x00007bae,0x732c0000,0xf6fbf71c,0xeebaff1c,
-0x08008bcf,0xbd750800,0xffffffff,0xffffffde,0x6b0cf77d,0x08000800,0xeebb9c51,0xfefcee7a,0x0800bd34,0x20c30800,0xffdedeba,0xffffffff,0x4a28ef5c,0x08000000,0xeedb9c72,0xf6fceebb,0x3104de38,0x28e40800,0xffffeefb,0xffdfffff,0xde99ffdf,0x08001041,0xd63862aa,0xe699e679,0x6acbe67a,0x08000800,0xff7e9410,0xffdeffff,0xffbeffdf,0x0800838e,0xb53420a2,0xe659eeba,
-0xa4b2eedb,0x08000800,0xf7be6b4c,0xfffffffe,0xffffffff,0x0820a4f3,0x5a890000,0x5a69bd55,0x08400800,0x00000820,0x00000000,0x10820000,0xad550000,0xffdfffff,0x0000b596,0x08411062,0x00000020,0x18a20840,0x10611061,0x10810800,0x18c21081,0x00001061,0x18c20820,0xad750000,0xffffffff,0xffbeffbe,0x8c10ffdf,0x18a20000,0x00201061,0xef5c4a48,0xffffffff,0x0800b554,
-0x086018c2,0x52eb0000,0xf7dfef7d,0xffdff7df,0xffdfffff,0xffdfffdf,0xff9effbe,0x00005aaa,0x08411081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x10000860,0xffbec534,0xffdfffbe,0xffffffdf,0xffbeffdf,0xffffffff,0x0000c5f8,0x20820820,0xb5340800,0xf7def7be,
-0xef3cffff,0x000041c7,0x08401082,0xbd961021,0xffdeffff,0xffffffbe,0x9431ffdf,0x18c20000,0x00400000,0x310318a1,0x18611000,0x00001861,0x10611061,0x006010c2,0x10820020,0x7b4d0800,0xffffff9d,0xce38ffdf,0x00400020,0x00000040,0x00000000,0x00000020,0x00001041,0x00000000,0x08001041,0xffdfa4b3,0xffffffde,0xfffff7de,0x3145deba,0x08000800,0x5a0849c7,0x39044965,
-0x08000800,0xff7d7b4d,0xf7deffff,0xf7deffff,0xd679ffff,0x08001082,0x18211021,0x28a32041,0x18610800,0xa4b20800,0xf7feffff,0xf7fef7fe,0xad95ffff,0x08410000,0x18210800,0x38e42883,0x10001820,0xa4921000,0xff9effde,0xffbeffde,0xffbeffde,0x08009471,0x10200800,0x18201820,0x10002020,0x5a690800,0xffbff71c,0xffdfff9e,0xfffff79e,0x4165eebb,0x10200800,0x28821800,
-0x08002082,0x21030800,0xffffd699,0xfffeffff,0xffdeffde,0x62cbf75d,0x00000000,0x00000800,0x00200820,0x00000020,0x00000000,0x10820000,0xad340000,0xffdeffdf,0x00009cb2,0x00200862,0x08600020,0x18821061,0x00000000,0x000018a2,0x10a20000,0x00001081,0x10a20000,0x8c710000,0xffffffff,0xffdfffdf,0x0821c5d7,0x08620821,0x00001061,0xffffbdd7,0xffdfffbe,0x41e7e6db,
-0x18e30000,0x4a890000,0xffffef9d,0xffdfffdf,0xffdfffdf,0xffdfffff,0x9cb2ffbf,0x10610000,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x08000860,0xeedb3945,0xffdfffff,0xffffffdf,0xf7bef7df,0xffffffbe,0x0000b555,0x102018a2,0xf6bb38c3,0xffffffde,
-0xfffff7de,0x0000b555,0x086110a2,0x49e70000,0xffdfeefb,0xef1cffdf,0x21249cb2,0x08400000,0x20810800,0x38822820,0xc5347a8a,0x7baed5f7,0x00000800,0x086110a2,0x00400020,0x30e40800,0xffdebd75,0xce38ffff,0x00400000,0x00000841,0x00000000,0x00000020,0x10410820,0x08000000,0x08201081,0xffdecdf7,0xfffeffde,0xffdefffe,0x8c0fffff,0x20e30000,0x08000000,0x08000800,
-0x08001861,0xff9e8bcf,0xffdeffde,0xfffeffde,0xef3cffff,0x000039c6,0x00000000,0x08000800,0x08400000,0xe6db2904,0xf7feffff,0xf7fef7fe,0xef7dffff,0x00005289,0x08001882,0x08000800,0x18a10800,0xce170000,0xffbeffff,0xffdeffff,0xffffffdf,0x0800b575,0x080018a2,0x08000800,0x18610800,0x83ef0000,0xffbfffbe,0xffdfffbf,0xfffff79e,0x3104e6ba,0x00000800,0x08000800,
-0x08200800,0x7bae0000,0xffdeffff,0xfffffffe,0xffdfffde,0x5228f73c,0x00000000,0x00000000,0x00200820,0x00000000,0x00000000,0x10820000,0x94b20000,0x736dce38,0x00001061,0x00000841,0x18a20000,0x08000000,0xacf341c7,0x9471d659,0x00003165,0x10410000,0x08410000,0x18820000,0xd6597b8e,0xff7dff9e,0x08006acc,0x18a21082,0x6b6d0000,0xf7fff7ff,0xffdeffff,0xad55ffff,
-0x10a20000,0x00001082,0xf7be8c71,0xffdfffff,0xffbfffbf,0xffbeff9e,0x1041d639,0x10410000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00200000,0x10820020,0x838e0800,0xffffff9e,0xf7dff7de,0xfffff7de,0xe6fbffff,0x00204208,0x080018c2,0xff9e938e,0xf7deffff,
-0xffffffff,0x62ecf79e,0x10820000,0x00001882,0xe6ba8bef,0x31249c71,0x00000000,0x08200041,0x20401861,0xcd347249,0xffbeff3c,0xffdeffbe,0x62ebce18,0x00000000,0x00200861,0x00001062,0x736d0820,0xce58de9a,0x08610000,0x00000861,0x08200000,0x08200820,0x00000800,0x210339a6,0x00001060,0xff9d6b0b,0xffdefffe,0xffdeffbe,0x5248ef1c,0x08200820,0x62eb62cb,0x52695a8a,
-0x00002904,0xce181020,0xf79dffff,0xffbeffbe,0x9450ffdf,0x10610820,0x62eb4207,0x5aca5289,0x00004207,0xad540000,0xf7beffff,0xf7bef7be,0xce58ffde,0x00002103,0x4a080840,0x5aaa5aaa,0x08205269,0x5aca0000,0xffbef77d,0xffbeffbe,0xef5cffdf,0x00005aca,0x39c61061,0x39c641e7,0x29245269,0x00200000,0xffbfce17,0xffdeffbe,0xff9effdf,0x08009410,0x4a480000,0x6b0c736d,
-0x4a08734d,0x39860000,0xffffe6db,0xffbeffde,0xff9effde,0x0800a492,0x738d0000,0x62ebd659,0x08610000,0x00000020,0x00000000,0x00200000,0x21240000,0x08200000,0x08410000,0x00000000,0x00000861,0xa4d341a6,0xffdfef3c,0xffdfffbe,0x8c30e6fb,0x08003966,0x00001041,0x00000820,0x08000800,0x7b8e732c,0x08210800,0x00000821,0xce590000,0xf7beffff,0xffdff7df,0xef7dffde,
-0x0000528a,0x002018e3,0xce380000,0xffdeffff,0xffbeffbe,0xf75dffdf,0x080062cb,0x08001062,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x08200020,0x10211862,0xffbebd55,0xffffffbe,0xffdef7de,0x8c70fffe,0x18c20000,0x28e30820,0xffbdde38,0xf7deffde,
-0xffdeffde,0xbdd6ffff,0x10820000,0x00000820,0x10610800,0x00000000,0x006110a2,0x10610000,0x93ce1820,0xffdef71b,0xffdefffe,0xffffffbe,0xef3cffff,0x2945a514,0x08410000,0x08610000,0x00000840,0x5aca20e3,0x00000861,0x00000000,0x00000000,0x10610000,0x7bae0800,0xbdb6ef3c,0x08200820,0xbdb60820,0xffdfffdf,0xffdfffdf,0x08008bef,0x94500800,0xf79def5c,0xf79df79d,
-0x00009470,0x6b2c0800,0xffdfff7d,0xffdfffdf,0x1020cdf8,0x732c0800,0xf77def3c,0xf79de71b,0x0820ce38,0x31850820,0xffdfeefb,0xffdfffdf,0x5a8af73c,0x00000000,0xef5c9471,0xf7beef7c,0x632ce71b,0x00000000,0xffffa513,0xffffffde,0xad34ffff,0x00000000,0xe71b41e7,0xdefbe71b,0xad54ef7d,0x00000000,0xf77d62eb,0xffbeffdf,0xde79ffdf,0x08001861,0xbdd70820,0xf7beffff,
-0xbdd7ffff,0x08000800,0xffde9430,0xffffffff,0xeefbffdf,0x00002904,0xce180820,0x9451ffdf,0x18c20000,0x00000020,0x00000000,0x00000000,0x00000000,0x10611061,0x086118c2,0x10820000,0x7bae0000,0xffdeef1b,0xffbeffdf,0xffbeffdf,0xffffffdf,0x3104d638,0x10610000,0x08410000,0x002010a2,0x00000000,0x08400820,0x000018a2,0xf7bf8431,0xffffffff,0xffdfffff,0xffffffbf,
-0x0000ce39,0x18c20000,0x41e70000,0xffdeef3c,0xffdfffde,0x9451ffdf,0x10620000,0x00000820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00200000,0x08200000,0x08001041,0xe6994185,0xffffffdf,0xffffffbe,0x0060ce98,0x10a20000,0x6aeb0000,0xfffeff9d,0xfffffffe,
-0xffffffde,0xffffffdf,0x00007bef,0x084010a2,0x00000840,0x18a218a2,0x002010a2,0x18a20041,0xbcf31800,0xffddffde,0xfffef7bd,0xffdeffff,0xffdfffdf,0x632cffff,0x10a20000,0x08810000,0x20c218a2,0x00000000,0x00200841,0x00000000,0x00000000,0x18a20020,0xa4f30000,0xffffffde,0x082083ce,0x4a480000,0xbd55b534,0x9c51c5b6,0x08000800,0xff7d5a69,0xffbeffff,0xfffeffff,
-0x41a6eefb,0x08200000,0xbd3483af,0xbd55bd55,0x08005228,0xde591820,0xffbeffdf,0xffdefffe,0x83cfffdf,0x00000000,0xe69a8bef,0xe67ade59,0x00008bef,0x49e71020,0xffffef3c,0xffffffde,0xc638ffff,0x00000000,0xad343986,0xad13bd95,0x41c7ad13,0x08000800,0xffffad34,0xffffffff,0xf79dffff,0x00005a8a,0x7bae0000,0x9c71a4d3,0x62cba492,0x08000800,0xffbe734d,0xffffffff,
-0xffbeffff,0x0800732d,0xad3428e3,0xbd96c5f7,0x8befc5f7,0x00000000,0xffbe6b0c,0x9c71ffdf,0x10a20000,0x00000000,0x00000000,0x00000020,0x08400020,0x10821082,0x00000000,0x10820841,0xb5750000,0xf79effff,0xffdeffff,0xffffffdf,0xffdfffdf,0x51e8ff3d,0x08610800,0x00000840,0x10c20000,0x108118c2,0x08410840,0x20e30000,0xffffdefc,0xdebbffbf,0xc5b7bdb7,0xbd76c5b7,
-0x29249cd3,0x00200000,0x00001081,0xb554738d,0x9cb2ad13,0x186183ce,0x08410000,0x08200821,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x10411041,0x10610820,0x5a690800,0x9c519410,0xa4b29c71,0x0000630b,0x08201081,0x41c60820,0xb5139c50,0xde18c596,
-0xff9ef6fc,0xffffffbe,0x0000c5f7,0x08200820,0x18a20820,0x08001040,0x00000000,0x10411061,0xb4d31820,0xffdeffde,0xf7fef7bd,0xfffffffe,0xfffff7be,0x634cef7d,0x08810040,0x00000841,0x00000000,0x18a220c3,0x00200020,0x00000000,0x00000000,0x08610020,0x6b4c0000,0xdebace38,0x00009cb3,0x00001082,0x08000000,0x00000000,0x000018a2,0xde598bef,0xeebade38,0xe679e679,
-0x5269d618,0x10810000,0x08000800,0x00000800,0x00000820,0xeeba628a,0xfedbfefc,0xfedbfedb,0xbd96ff3d,0x10610800,0x10200800,0x10611861,0x18820800,0x94100800,0xe67ade79,0xde59de39,0xc5f7d618,0x00004a27,0x00001041,0x00000000,0x00000000,0x08000820,0xce38b555,0xcdf7d638,0xbd75bdb6,0x08006b0c,0x00001082,0x00000000,0x00000821,0x00001082,0xcdf77b8e,0xce18d658,
-0xce18c618,0x0800838e,0x00001061,0x00000820,0x00000000,0x000018c2,0xb53562eb,0x62abc576,0x08410000,0x00200020,0x00000000,0x00000000,0x00000840,0x00000000,0x31855249,0x18820000,0x738d0000,0xffdff79e,0xffffffde,0xffffffff,0xffbfffdf,0x3945f6dc,0x10810000,0x00400000,0x000018e3,0x18a20000,0x10820841,0x9cd30000,0xffffffdf,0x5269e6fc,0x00000000,0x08000000,
-0x00000000,0x00200000,0x10a20000,0x00000000,0x00000000,0x08200000,0x08200840,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08200000,0x18410800,0x08000800,0x10601061,0x08001061,0x08000800,0x00000800,0x10810000,0x08200000,0x08000800,0x08000800,0x10000800,
-0xd5f728a3,0xffbeffde,0x6b2cff9e,0x10810000,0x08001061,0x5aaa1020,0x41a6acd3,0x20a20000,0xbcf41000,0xffbeffbf,0xf7feffff,0xfffff7de,0xffdfffff,0x4a89ef7d,0x18e30000,0x94710000,0x2924a4f3,0x00000000,0x00000841,0x00000021,0x00000000,0x00000000,0x00000840,0x08410000,0x08210800,0x08820000,0x10a20861,0x108110a2,0x08200020,0x10000000,0x10001000,0x18411821,
-0x00000800,0x00200020,0x10a20861,0x18c21082,0x00001081,0x28c31861,0x59e83904,0x390459a7,0x31253104,0x00001040,0x08001040,0x00000800,0x00000820,0x10200800,0x10000800,0x10201000,0x08000800,0x00001041,0x10820000,0x10a30862,0x08411082,0x10610000,0x08000000,0x08000800,0x08000800,0x08200800,0x08610000,0x108318c3,0x08621082,0x08610020,0x08000800,0x08000800,
-0x00000000,0x08000800,0x10a20820,0x10a10840,0x08401081,0x08200020,0x00000000,0x08000800,0x00000820,0x00000000,0x00000000,0x00200000,0x20e30000,0xbd956b2c,0xa4d2ff7d,0x20c30800,0x52aa0000,0xffffef9d,0xffffffff,0xf7dff7de,0xfffff7be,0x4125f6dc,0x08810000,0x10820020,0xce38bdd6,0x1081736d,0x10821082,0x94710000,0xffffffdf,0x00009cb2,0x10812103,0x20e31882,
-0x186120c2,0x10811881,0x00200020,0x10821082,0x108218c3,0x18c218c3,0x18811881,0x20c20800,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x28411841,0x49856208,0x08400000,0x18a20800,0x18a320e4,0x10821082,0x00400861,0x10820041,0x20a21862,0x18c218c2,0x108110a2,
-0x5a490800,0xfffff75c,0x5248e6fb,0x18810000,0x49c60800,0xffbebd95,0x39a6f75c,0x18a20000,0xbd140800,0xffbeffbf,0xf7fefffe,0xf7def7ff,0xffffffbe,0x39c6e6fb,0x10810000,0xd6381000,0xdebaffde,0x31659471,0x00200000,0x00000020,0x00000000,0x00000020,0x08400020,0x00200040,0x00000000,0x00000000,0x00000841,0x00200000,0x00200000,0x00200000,0x08410841,0x08200821,
-0x00000841,0x00000000,0x00000020,0x00200020,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x08200820,0x10610000,0x08400840,0x08200800,0x00000000,0x08400020,0x08400840,0x08200861,0x08400000,0x00200000,0x00000041,0x00000041,0x00000020,0x08410820,0x08410841,0x10821081,0x00000840,0x00200000,0x00000000,0x00000000,0x00000020,0x10610840,0x08400840,
-0x08611081,0x00200000,0x00400000,0x00200040,0x08200000,0x00000000,0x10810861,0x08201082,0x00000820,0x00000000,0x00000000,0x10820020,0x8c300800,0xffdeffbe,0xde79ffdf,0x10411041,0x4a080800,0xffffef5c,0xfffff7be,0xf7beffff,0xffdff79e,0x2021febc,0x10610800,0x10820000,0xffbee6fb,0x8c51ff9e,0x18a30800,0x00000820,0xdedbc5f7,0x000018c3,0x10611040,0x08000800,
-0x08000800,0x08000800,0x00001041,0x08610020,0x08000000,0x00000000,0x08000800,0x8c0fa4b2,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000040,0x280030a2,0xddd782aa,0x08605a89,0x00001061,0x00000000,0x08200000,0x00200000,0x00001061,0x08000800,0x00000000,0x08810020,
-0x080018c2,0xffde8c30,0x00009cb2,0x18a218c2,0xc5751820,0xffdeffde,0x2965e71b,0x10a20000,0x6aab0800,0xffdfe69a,0xf7feffde,0xffffffff,0xffdfff9e,0x1081e6ba,0x08200020,0xd6182061,0xffffffff,0xb596ffdf,0x08820000,0x00000020,0x00210000,0x00200000,0x00000000,0x00610040,0x00200040,0x00000000,0x00200000,0x00000000,0x00000000,0x00410021,0x00410041,0x08410041,
-0x00200040,0x00000000,0x00000000,0x00000000,0x00200020,0x08610020,0x10810861,0x10810861,0x08610861,0x08000000,0x00000840,0x00000000,0x08200000,0x00400000,0x00400060,0x00400040,0x08610040,0x00000020,0x00000020,0x00000000,0x00200000,0x00000000,0x00200841,0x00200820,0x00000020,0x00000020,0x00000000,0x00000000,0x00000000,0x00200000,0x00200020,0x00400840,
-0x00200841,0x00000040,0x00000020,0x00200000,0x00000000,0x00000000,0x00200020,0x00200020,0x00000000,0x00000000,0x00000000,0x10820000,0xad340000,0xffdeffdf,0xef1bffde,0x080041a6,0x31450800,0xffffdedb,0xffffffff,0xffdfffdf,0xff7effdf,0x2021c515,0x10610800,0x00200000,0xffffd69a,0xef5cffdf,0x00003986,0x000018a2,0x52694208,0x08400000,0x00001061,0x8c303165,
-0x8bce9c50,0x5a697b4c,0x10611020,0x00000000,0x5aab18c3,0x8bef7b8e,0xad139c71,0x940fff9d,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18600000,0x302038a1,0xff5c8aa9,0xd658f73c,0xce18d659,0x9d33ce79,0x000018c2,0x28a21861,0x9c102861,0x9450b4d3,0x7bce9471,0x000018c2,
-0x00001061,0x947118a2,0x000039a6,0x080018c2,0xff5d72cb,0xffffffbe,0x39c6e71b,0x08610000,0x08001041,0xacf33945,0xfffff75c,0xffffffde,0xd659ffbe,0x0020736d,0x08200861,0xe6592862,0xffdeffdf,0xce59ffff,0x08610000,0x00000020,0x00000000,0x00200000,0x00000000,0x00000020,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x00200000,
-0x00200000,0x00000000,0x00200020,0x00200000,0x00200000,0x00000020,0x00400000,0x00000000,0x00000000,0x00000800,0x00000021,0x00000000,0x00000000,0x00200000,0x00200020,0x00200020,0x00210000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x08200000,0x00200000,0x00000020,0x00000020,0x00000000,0x00000000,0x00200000,0x00000000,0x00000020,0x00200000,
-0x00000020,0x00200000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x08200800,0x00000000,0x00000000,0x10a20000,0xa5130000,0xffdeffff,0xff7dffff,0x08005a49,0x18611020,0xffffd699,0xffdfffde,0xffdfffdf,0x7b2dde39,0x08001020,0x08201041,0x18c30000,0xffffdedb,0xffffffbe,0x0000a4f4,0x106118a3,0x00000000,0x08400861,0x00001081,0xffffa513,
-0xffbeffde,0xde9affde,0x080049e7,0x00001041,0xd69a0861,0xffbeffbf,0xffbeffff,0x7b0cff9d,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18600000,0x406040e2,0xff1b92ea,0xffffffbe,0xffdfffff,0xb5d6ffff,0x10600000,0x20202881,0xff5c938e,0xffdeffde,0xffdeffde,0x0000a4d2,
-0x106118a2,0x00000000,0x10410000,0x18411881,0xffbecdd7,0xffdeff9d,0x2964ef7d,0x18a20000,0x10610820,0x08000800,0xde5862ca,0xde99ff9d,0x08008bef,0x00200000,0x080018a2,0xeedb1821,0xffdfffff,0xc618ffff,0x08820000,0x00000841,0x00000000,0x00000000,0x00000000,0x00200020,0x00400000,0x00200020,0x00200000,0x00000000,0x00000000,0x00000820,0x00000000,0x00000841,
-0x00200020,0x00200000,0x00000000,0x00200020,0x00000000,0x00200000,0x00000000,0x00000021,0x00000820,0x00000000,0x00000000,0x00200000,0x00000000,0x00000800,0x00000000,0x00000000,0x00000020,0x00000020,0x00000000,0x00210000,0x00210000,0x00000000,0x00000000,0x00000821,0x00200000,0x00000000,0x00200020,0x00200000,0x00000020,0x00200000,0x00000000,0x00000000,
-0x08410000,0x00000000,0x00000841,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x00000000,0x00200020,0x00200000,0x10820020,0x94920020,0xffffffff,0xff9effde,0x0800730c,0x08201882,0xc6176b6d,0xffbef77d,0x9410e6bb,0x08002062,0x00200840,0x10820000,0x08410821,0xffdfe71c,0xffdfffdf,0x62ecf77e,0x10820000,0x10811061,0x08400000,0x4a690020,0xfffff79d,
-0xffffffff,0xffffffdf,0x0800acb2,0x108120c3,0x83f00000,0xffbfffbf,0xfffef7be,0x9c10ff9d,0x10820800,0x10610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20810000,0x51024923,0xff3b8aea,0xffdeff9d,0xffffffde,0x4a68ef7d,0x20a10020,0x38a33061,0xfffede58,0xffddffde,0xfffffffe,0x41a6ef1c,
-0x10820000,0x08410841,0x20821041,0x8b8e1000,0xffdeff9e,0xfffeffff,0x94b2ffff,0x00000000,0x10811082,0x18a21882,0x18810800,0x20a262aa,0x08410000,0x18a21082,0x10000800,0xf77d9c51,0xffffffff,0xce39ffff,0x08610000,0x00000020,0x00200000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0x00200000,0x00000020,0x00200000,
-0x00000000,0x00200000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00200841,0x00000041,0x00000021,0x00000000,0x08000800,0x00000000,0x00200000,0x00000000,0x00000020,0x00200020,0x00000841,0x08410020,0x00000000,0x00000841,0x00000000,0x00000020,0x00200000,0x00000000,0x00000020,0x00200000,0x00200020,0x00000841,0x00000000,
-0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00200000,0x00000000,0x00200000,0x00000020,0x00200020,0x00000000,0x18820000,0x84100000,0xffdfffff,0xffffffbe,0x08007b6d,0x108220c2,0x00200000,0x7b6d5aaa,0x080020c3,0x18621000,0x08811081,0x000018c3,0x6b2c0000,0xffffef7d,0xffffffff,0xc5d7ffff,0x08210000,0x00000820,0x10820861,0xbdd60000,0xffffffff,
-0xffffffff,0xffffffde,0x1861de59,0x08810000,0x00000020,0xffffd679,0xf7def7de,0xa491ffde,0x10820820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x28c20000,0x48c15164,0xff3b8aea,0xfffffffe,0xffffffde,0x0000b5d6,0x18810861,0xb4512000,0xffdeffbd,0xffbeffde,0xf7bdffff,0xbd95ffff,
-0x08810000,0x08400040,0x08001061,0xe69a2882,0xf7deffff,0xfffefffe,0xffffffff,0x630cce59,0x00000000,0x10410000,0x08001861,0x08000800,0x08611082,0x08000800,0xcdd75a49,0xffffffff,0xfffff7de,0xce79ffff,0x08610000,0x08610861,0x00000000,0x00200020,0x08610000,0x00000000,0x00000000,0x00000000,0x00200000,0x00200020,0x08410820,0x08610841,0x00410861,0x00610000,
-0x08410020,0x00000841,0x00000000,0x00000000,0x08410000,0x00000020,0x00210841,0x08410021,0x08400020,0x00200020,0x00400020,0x08410000,0x08400841,0x10201041,0x08410841,0x08410841,0x10611082,0x08410841,0x00200841,0x00200000,0x08610000,0x08611082,0x10811082,0x10611061,0x10811082,0x084110a2,0x00200020,0x00000841,0x10a20861,0x086110a2,0x108210a2,0x18a21082,
-0x10821082,0x108218c3,0x00200841,0x00200000,0x00000000,0x00000000,0x00200000,0x08610821,0x10821082,0x10a21082,0x10a218c3,0x20a31082,0x94510000,0xffffffdf,0xffffffde,0x4a08ce38,0x00000000,0x086118c2,0x00000000,0x18820000,0x08201021,0x00200000,0x29450000,0xf79db555,0xffdfffff,0xffdfffff,0xff9effdf,0x000083ef,0x00201082,0x00001081,0xffff8c50,0xffffffdf,
-0xf7ffffff,0xffdeffff,0x9c71ffbe,0x08610000,0x000018a2,0xffdf7bcf,0xf7def7fe,0xde38ffbe,0x000039a6,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20810000,0x40605144,0xff9dc4d2,0xffdeffde,0xffdfffde,0x00007bce,0x080010e2,0xf67a4904,0xffdeffde,0xffdeffde,0xffffffde,0xff9effff,
-0x0020632c,0x08410881,0x08001861,0xffbeb514,0xffbeffff,0xffffffff,0xf79dffff,0xf75dffff,0x4228ad55,0x08610840,0x10610000,0x084018a2,0x00000861,0xb4f451e8,0xffdfff1d,0xf7fef7de,0xf7ffffff,0xce99ffff,0x00410000,0x08810882,0x00201082,0x00000000,0x00200020,0x00000000,0x00000000,0x00000000,0x00000020,0x08410000,0x10811082,0x00000020,0x10a20000,0x08811082,
-0x10a210a2,0x00200040,0x00200000,0x00000020,0x10820861,0x10821082,0x108210a2,0x10a21082,0x10c210a2,0x00000861,0x00200040,0x08400020,0x00200861,0x00000000,0x08610840,0x00000020,0x08000800,0x00000800,0x08610000,0x00200020,0x00000041,0x00000000,0x08000000,0x08000800,0x00000000,0x00000000,0x00200841,0x00200000,0x00000000,0x00000000,0x00000000,0x00000020,
-0x00000000,0x00000000,0x00200000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x08000000,0x83ef0000,0xffdfffff,0xffdfffff,0xf77dffdf,0x6b4dcdf8,0x08810000,0x108218a2,0x08201081,0x00000820,0x52aa3185,0xd6ba8410,0xffffffff,0xffdfffff,0xffffffff,0xffffffdf,0x0000bdd7,0x10821061,0x7bcf0000,0xfffff7be,0xffffffdf,
-0xffffffff,0xffbfffff,0xcdd7ffdf,0x08400800,0x000018a2,0xffdf9cb2,0xffdef7fe,0xa431ff5d,0x00003124,0x08200841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18200820,0x382040a2,0xffdeddb5,0xf7beffbe,0xf77dffff,0x0020632c,0x000010a2,0xee3938a3,0xffdefffe,0xfffffffe,0xffffffff,0xffffffde,
-0x2965e6fb,0x10820000,0x31240800,0xffdfeefb,0xffffffbe,0xfffffffe,0xffdeffff,0xffdfffbe,0xf79effff,0x18e394b2,0x10610000,0x00000000,0x08001081,0xff3d8baf,0xffdfff9f,0xf7fff7de,0xf7beffff,0xd6baffff,0x00000841,0x00000041,0x10620000,0x00200000,0x00200000,0x00000841,0x00200000,0x00000000,0x00000020,0x00000861,0x00000000,0x18c20820,0x00000820,0x00000000,
-0x00000000,0x08610000,0x08400000,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x00000841,0x00200000,0x08401081,0x00000000,0x18820000,0x31253145,0x10411021,0x00003165,0x00000841,0x18e30000,0x41e73186,0x39864a08,0x49e74186,0x4a485269,0x31655acb,0x08410000,0x00000821,0x736e528a,0x736d6b4d,0x632c6b4d,0x5acb630c,
-0x5aaa62cb,0x738e6b2c,0x000039a6,0x00000820,0x00200000,0x00000000,0x00000820,0x7bae2904,0x6b4d7bae,0x7bce6b6d,0x736d73ae,0x732d736e,0xbdb762ec,0xf7beffff,0xffbeffff,0xff7effdf,0x62ebd679,0x10a20000,0x00000000,0x08400000,0x00001082,0xc5f741e7,0xffffffff,0xffdff7be,0xffffffdf,0xffffffff,0xf75dffff,0x0000526a,0x10821061,0x6b6d0000,0xffffef3c,0xfffff7be,
-0xffffffff,0xffdfffdf,0x5a49f71c,0x08610800,0x00001062,0xffdf9451,0xffbef7de,0x59e8ff1c,0x10620800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200000,0x406140a2,0xffded595,0xffffffde,0xe73cffff,0x00202144,0x18810840,0xa4921000,0xfffeffff,0xffdeffde,0xf7deffff,0xffffffff,
-0x0000bdd7,0x08610040,0x08001061,0xffdfa4b2,0xffdfffdf,0xffdeffff,0xffdeffff,0xffffffff,0xa4f3f77d,0x08003185,0x10811061,0x002010a2,0x10610000,0x49a70800,0xff5dbd15,0xf7fefffe,0xffffffdf,0xff9effbf,0xde9ade9a,0xce79c638,0x000083ef,0x000018a2,0x31e73a28,0x10610000,0x00200840,0x00000861,0x08400840,0x7bcf0000,0xce18c5f7,0xe6bbc5f7,0xce38de9a,0xc617c618,
-0xce59c618,0x1062ad34,0x08200800,0x00001082,0xc6188c10,0xce38ce18,0xce38c618,0xbdf7ce38,0xc638ce59,0x4208bdd7,0x18a20000,0x83cf0000,0xc678ce79,0xce79d6b9,0xce99ce79,0xdebace79,0xe6fbdedb,0xdebad699,0x0820c618,0x18a20000,0x62eb0800,0xef3cdeba,0xe71bef3c,0xef3ce71b,0xef7def5d,0x5289e71c,0x10610000,0x00001082,0xf79e83ef,0xffbeffff,0xffbeffde,0xffbef79d,
-0xffdfff9e,0xa4f3ef1c,0x00003185,0x00001061,0x10821061,0x10611061,0x00001082,0x7b8e1882,0xf79ddeba,0xffffffff,0xffdfffff,0xffbeffdf,0xfffff79e,0xffdfffff,0xffbfffff,0x7b4dd639,0x00000800,0x00001082,0x10c30861,0x10820881,0x10611041,0x31650800,0xef7d9cb2,0xffffffff,0xffffffdf,0xffbeffdf,0xa4d3ffff,0x10820000,0x00000820,0x000010a2,0xffde7bae,0xffdfffff,
-0xffdeffff,0xffbfffdf,0x0800bd35,0x08610861,0x000010c2,0xffff94b2,0xffdfffff,0x6a4afefc,0x10820800,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18410000,0x384140a2,0xffdeddd6,0xfffff7bd,0xef7dffff,0x00004a69,0x108110a1,0x4a080800,0xffdeef1c,0xffffffde,0xfffff7de,0xef5dffde,
-0x000041e7,0x00001082,0x00000861,0xde592082,0xffbeffff,0xffffffbe,0xffdeffff,0xd6baffff,0x0000632c,0x18610800,0x00000800,0x10810000,0x08411081,0x08000820,0x730c0800,0xffbece38,0xffdfffff,0xffdfffdf,0xffdfffdf,0xffffffff,0x62ebef5d,0x10820000,0x10e331a6,0x08200000,0x00001061,0x18c20820,0x08410020,0x39a60000,0xff9ead14,0xffffffff,0xffffffdf,0xffffffff,
-0xffbfffff,0x00007bae,0x08201082,0x00001061,0xf77d62eb,0xffffffff,0xffffffff,0xffffffff,0xffffffde,0x0000ce18,0x10211041,0xce180800,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x4208ef5d,0x18820000,0x29240000,0xffffe6da,0xffffffde,0xfffffffe,0xffffffdf,0x000094b2,0x000018a2,0x08410841,0xc6180000,0xffffffff,0xffffffde,0xffffffff,
-0xc5d7ff9e,0x00005aaa,0x10610000,0x10820840,0x00000000,0x00000000,0x10820841,0x00000800,0xa5131040,0xffdfffdf,0xffffffdf,0xffffffdf,0xffffffff,0xffffffff,0x8c10e71c,0x08001021,0x10621041,0x10c30841,0x00000000,0x00000020,0x10610000,0x08001061,0x632c0000,0xffffd699,0xffdfffdf,0xffffff9e,0x28e4de9a,0x10610000,0x00200000,0x10a20841,0xb5b60000,0xffffffdf,
-0xffdfffff,0xff5dffdf,0x08006a8b,0x00611082,0x21240000,0xffffe71c,0xffbef7be,0x724aff1d,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x20610000,0x38613041,0xffdeddf7,0xffdeffbe,0xfffff79e,0x00009492,0x080018a2,0x10611061,0xff9ebd76,0xf7beffbe,0xffffffdf,0x7baef79e,
-0x18820000,0x10811061,0x10810000,0x62cb1000,0xffdef75d,0xffffffde,0xf7bef7be,0x2944b5b6,0x18e20000,0x10002082,0x836e2021,0x00005aaa,0x10a10000,0x10811081,0x080010a1,0xcd762041,0xffffffff,0xffffffff,0xffdeffdf,0xf7bef7ff,0xe6dbffff,0x000039a6,0x00000000,0x10611082,0x10210800,0x00001061,0x18821882,0x00000800,0x734d0000,0xffbee6fb,0xf7beffbe,0xf7beffde,
-0xad35ffff,0x10810000,0x10a20861,0x10820020,0x84100000,0xffdeffde,0xffdeffde,0xf79effde,0xf77dffff,0x000062eb,0x000020c3,0xf75d5a6a,0xf7beffdf,0xffffffde,0xffffffff,0xffdeffff,0xffdeffdf,0xf7beffff,0x7b8effbe,0x18820800,0x08001882,0xffde83ce,0xffdefffe,0xffdefffe,0xce59ffff,0x00000820,0x00000841,0x10820000,0x52690000,0xffffe6fb,0xffdfffdf,0xffbeffdf,
-0x00009471,0x10410800,0x18c31061,0x00000000,0xa5144a48,0x4a48a513,0x00000000,0x18811882,0x00000800,0xffffb575,0xffdeffbe,0xffffffff,0xffdfffff,0xffffffdf,0x08009cb2,0x18821862,0x10820820,0x00000000,0x7bae0000,0xa513bdf7,0x000039e7,0x18820000,0x00001082,0xc6171882,0xffdfffdf,0xf77effff,0x0800736d,0x00001082,0x10821061,0x10810861,0x31860000,0xffffe6fb,
-0xffbeffff,0xbcf4ffbf,0x18411800,0x10820820,0x736d0000,0xffdfffff,0xffdfffde,0x6a2afefd,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x18410000,0x40c32821,0xffded5b6,0xffdeffdf,0xffffffff,0x28e3de9a,0x10410800,0x00001081,0xff7e6aab,0xffdfffdf,0xffffffff,0x00009451,
-0x18821882,0x00000000,0x00001081,0x08001881,0xffbe9c92,0xffffffff,0xad95ffff,0x00000000,0x080018a2,0x832d1840,0xff9ecdb7,0xb5b6f77d,0x00005aca,0x08810020,0x20c30020,0xa4111800,0xffdeffff,0xffffffff,0xffffffdf,0xfffff7de,0x9492f79e,0x00000800,0x10a21081,0x08000000,0xd6596aec,0x7b8ed638,0x00000000,0x104118a2,0x000018a2,0xef5d5a8a,0xffffffff,0xffdef7be,
-0x4208e6fb,0x10a20000,0x00000020,0x08401081,0x00200861,0xffffbdf7,0xffffffff,0xffffffff,0xb555ffff,0x18820000,0x000018a2,0xffdf9471,0xffffffdf,0xffffffff,0xffffffff,0xfffff7df,0xffdeffff,0xffffffff,0xbdd6ffff,0x10810000,0x08201041,0xc5d60800,0xffbef77d,0xffbef79d,0x4a49d69a,0x10820000,0x10610000,0x08201062,0x000018a2,0xffdf9471,0xffffffff,0xe6fbffff,
-0x00003145,0x10611882,0x00000000,0x94712103,0xffffef5d,0xf77dffdf,0x39a6ad14,0x10410800,0x000018c2,0xe6fb41e7,0xffdfffff,0xffffffff,0xffdeffdf,0xffffffff,0x00008c31,0x080020a3,0x00000841,0x83f018e3,0xffbfd659,0xffffffff,0x9cf3e73c,0x080028e4,0x18c31041,0x6b0c0000,0xf79effbe,0xad55ffff,0x10410000,0x10820800,0x00200000,0x08410000,0x000010a2,0x8c105269,
-0x94308c10,0x30e4838e,0x18610800,0x08410000,0x4a480000,0x94918c50,0xd6389491,0x72abfebb,0x10620800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000800,0x38822000,0xffdfde18,0xe6baf75c,0xd618ce18,0x49e7d618,0x08610000,0x08410040,0xac931821,0xcdd7cdb7,0x9471ce18,0x10410000,
-0x00001861,0x4a286b0b,0x10810000,0x000010a2,0xeebb28c3,0xffbeffbf,0x6b8df7de,0x20c30000,0x62282020,0xff7dc575,0xfffeffff,0xffffffff,0xbdd6f77d,0x000052a9,0x18611061,0x838e1000,0xf7deffbe,0xffffffff,0xffffffff,0xfffef79d,0x0000c617,0x10610000,0x00000820,0xbd754a07,0xffffff7e,0xffbeffbf,0x41e7bd76,0x10610000,0x10211021,0xd6791041,0xffbeffdf,0xffdfffdf,
-0x08008c31,0x000028e4,0x62eb5269,0x10410800,0x00001061,0x840f39a6,0xb575a4f3,0xc618bdb6,0x20e4ad35,0x08610000,0x00000861,0xce387bae,0xd659ce18,0xffdfe69a,0xffffffbf,0xffffffff,0xf71cff9e,0xc5b6ce18,0x8410b575,0x08400000,0x08410020,0x29240000,0x5a695228,0x6b0b62aa,0x00004a07,0x00000841,0x00001082,0x08410000,0x08201061,0xce380000,0xffbeffff,0xd679ffff,
-0x00002945,0x00001061,0x840f2924,0xffffd699,0xffffffbe,0xffdeffbe,0xe6fbffff,0x00007bae,0x10820861,0xc5f70000,0xffbeffff,0xffffffdf,0xffffffff,0xffbeffdf,0x00008c10,0x002118c3,0x630c0000,0xffffce79,0xffdfffff,0xffdff7be,0xffffffff,0x0800c596,0x10821862,0x62cb0000,0xffffef5d,0x3186e6fb,0x10410000,0x00001082,0x94924a69,0x00000000,0x10820020,0x00000000,
-0x00000000,0x08000800,0x00001062,0x00200020,0x00000881,0x00000000,0x00000000,0x5a4983af,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10410000,0x28821000,0xacf3cdd7,0x31245249,0x08001040,0x08000800,0x00400020,0x08200000,0x08000800,0x08000800,0x00200000,0x18621061,
-0x52280800,0xbdd6f77d,0x00400000,0x18a20020,0x834e0800,0xfffff73d,0x3a07ef7d,0x18610020,0xcd342020,0xffffffdf,0xf7feffff,0xffdeffff,0xffffffdf,0x2924deba,0x18610800,0x6b0c0800,0xffffff9e,0xe71bf7be,0xffdeef3c,0xffffffff,0x0000a513,0x106118c2,0x7b8e0820,0xffffef3c,0xffdfffff,0xffffffdf,0xe71cffff,0x00006b2c,0x08001882,0xce180820,0xffdfffff,0xc5f7ffdf,
-0x10210800,0x10410800,0xef3cde7a,0x08003144,0x10611061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x08600040,0x00000000,0x08001041,0xeedb49c8,0xffdfffdf,0xffdfffbe,0x3965b555,0x08001041,0x00000000,0x00000840,0x00200020,0x00000000,0x08000800,0x08001000,0x10810000,0x10820000,0x39c70000,0x0000738e,0x18a20000,0x5a8a0000,0xffdfef5d,0xce38ffff,
-0x00000800,0x00001082,0xffffa514,0xffdfffff,0xffffffff,0xffffffff,0xffffffdf,0x0000ad34,0x10c21081,0xb5750000,0xffbfffdf,0xad34e6bb,0xf79ece59,0xffffffff,0x000083f0,0x002018c3,0xef3c20e3,0xf7dfffff,0xffffffff,0xffffffdf,0xffffffde,0x2062f6dc,0x10a20000,0x5acb0000,0xf77df79e,0x000083cf,0x106118a3,0x10a20000,0xffffc638,0x00009cd2,0x10a218c2,0x210418c3,
-0x18c22103,0x08611081,0x00000000,0x10a210a2,0x18e31081,0x18e22944,0x002010a1,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x28a20800,0x00003965,0x00000800,0x10c21081,0x18a218c2,0x10a210c2,0x000010a2,0x10820841,0x10821082,0x10c21903,0x080018c2,
-0xd6382082,0xffdeffff,0x00208470,0x08001081,0x08001882,0xbdb641a7,0x10a2ce59,0x10610000,0xd5b61800,0xffbeffdf,0xffffffff,0xffdfffff,0xffffffff,0x4a28f77d,0x20c20000,0x49a70800,0xd5d7ee9b,0x20a28bae,0xa4923945,0xffbeeeba,0x0000b554,0x000018a2,0xeedb20a2,0xffffffdf,0xffffffff,0xffdfffff,0xffffffde,0x0000b595,0x10611862,0xbd760800,0xe6fbffbf,0x4a08ad14,
-0x18c20800,0xa4f30000,0xffffffbe,0x0000ad54,0x084018c2,0x18e31061,0x20e32103,0x10a218c2,0x08411061,0x08600820,0x10600840,0x18a220c2,0x18611041,0x6acb0800,0xffbef75d,0xce18ffff,0x08000000,0x10820840,0x108118a2,0x08400020,0x00000000,0x08400020,0x10811061,0x18a21061,0x108118a2,0x108118c2,0xbdb60000,0x7baeffbe,0x18a20000,0x00001061,0xce386b0c,0xce38ffde,
-0x08410000,0x000018a3,0xffffc618,0xffffffff,0xffdfffff,0xffffffff,0xffffffbe,0x0000ad54,0x088210a2,0xa4d30000,0x8c30de9a,0x00001882,0x62cb0000,0xef3cbd96,0x0000734d,0x000010a2,0xf77d41e7,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x2862ee5a,0x10820800,0x42280020,0x5269a514,0x10820820,0x10620000,0xbdb70000,0xffffffff,0x738ef79e,0x00000000,0x00000000,
-0x00000000,0x00200020,0x08610000,0x08200000,0x00000000,0x00000000,0x08401041,0x08611061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08001020,0x10400800,0x10811881,0x00000000,0x00000000,0x00000000,0x08610000,0x00200040,0x00200861,0x00000000,0x08000000,
-0xffdfb534,0xffffffbe,0x1081ceb9,0x10410800,0x10610000,0x10210000,0x08403186,0x10810020,0xcd752020,0xffdeffdf,0xffffffdf,0xffffffdf,0xffbeffdf,0x4a68ef7d,0x10610000,0x20a30000,0x18006229,0x08000800,0x08000800,0xb5143904,0x00009471,0x082018a2,0xe6ba28c3,0xf7beffff,0xfffff7de,0xffdeffff,0xffffffff,0x0000bdf7,0x18a21061,0x83af0000,0x41a7a4d3,0x00000800,
-0x10811061,0xad340820,0xffdeffff,0x738df77d,0x00200000,0x00000000,0x00000000,0x08400000,0x08200820,0x08201040,0x08000800,0x08000800,0x10611040,0x080020a2,0xffff9451,0x4a08ef1c,0x18c30000,0x08610841,0x18c21081,0x10a20841,0x108210a2,0x08610000,0x00200000,0x00000000,0x00000000,0x00000000,0xffff8c51,0xce59ffff,0x08200820,0x10411041,0x00000000,0x7bcf6b4c,
-0x08610000,0x00000841,0xffffce59,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000a513,0x08410882,0x31450000,0x08002904,0x18c20000,0x00001081,0x41e70000,0x00002104,0x00401082,0xf79d52aa,0xffffffff,0xffdeffff,0xf7deffff,0xffdfffdf,0x30a3ee7b,0x08610000,0x00000020,0x00000000,0x08211061,0x000018a2,0xf79e4a29,0xf7beffdf,0xe73cffdf,0xad75b596,0xa4d3ad34,
-0x20c38c10,0x00200000,0x00001082,0x9c925a8a,0x9cd29cd2,0x39869cb2,0x08200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x10610841,0x08000820,0x6b2b52a9,0x7b8e736c,0x738d7b8e,0x00004208,0x08410841,0x39c60000,0x8c107bae,0xc5d7a4f3,
-0xffdeffbe,0xf7beffde,0x000083ef,0x18821020,0x084118c3,0x006110a2,0x00000000,0x08200861,0xcd961000,0xffdeffdf,0xffffffdf,0xffbeffff,0xffffffbe,0x39e7e73c,0x10810020,0x00000000,0x08000800,0x18c218c2,0x18a21081,0x10000800,0x08610840,0x00000840,0xe6592882,0xffffffdf,0xffffffff,0xffffffff,0xfffff79d,0x0000c618,0x00000841,0x00001041,0x00000000,0x18c318c2,
-0x10610000,0x31860000,0xffffe71b,0xef3cffde,0xc617c5f7,0x8c50bdd6,0x6b6d7bce,0x00002944,0x08200840,0x18200800,0x39443944,0x52075a28,0x08400800,0x00001061,0xad340000,0x00007b6d,0x08201082,0x00000841,0x00000000,0x00000000,0x00000000,0x00001081,0x00000000,0x316520e3,0x736d5aaa,0x8c506b4d,0xffdff79e,0xd679ffff,0x00001061,0x10610820,0x084018c2,0x00000820,
-0x08410820,0x00200841,0xffdfc618,0xffffffdf,0xffffffdf,0xffdfffff,0xffffffde,0x0000a513,0x002010a2,0x00000800,0x10411020,0x10811081,0x18c20861,0x08200861,0x08200000,0x00001082,0xef5d5aca,0xf7deffff,0xffffffff,0xffffffff,0xfffff7be,0x2042e65a,0x00410821,0x00200000,0x18a21082,0x108218a2,0x00001082,0xce7910a2,0xffdfffff,0xfffff7de,0xffffffff,0xffffffff,
-0x1000d618,0x18c30820,0x39c70000,0xffffef3d,0xffffffbe,0xb554ffff,0x10410800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00200000,0x18810820,0x8c300000,0xfffff79d,0xffdeffde,0xffffffff,0x0000ce18,0x10610820,0x5a8a0000,0xffdff75d,0xffdfffff,
-0xffdeffde,0xb595ffff,0x08200800,0x08001882,0x00200000,0x10c20881,0x00200881,0x10610020,0xbd541000,0xffbeffdf,0xffdfffdf,0xffdfffdf,0xffffffdf,0x4a68ef5c,0x10810000,0x08000000,0x20a21881,0x00000000,0x18a20000,0x10611861,0x00200020,0x08200861,0xe67a1841,0xffbeffdf,0xffdfffff,0xffffffff,0xffdfffff,0x0000ce79,0x08400820,0x10810000,0x18e31082,0x00000000,
-0x08001061,0x000018a2,0xffbe8c30,0xffffffff,0xffffffde,0xffffffde,0xf79dffff,0x00005aaa,0x000018c2,0xe6798c0f,0xeebaee9a,0xf73cf6fb,0x00009471,0x08600861,0x00000020,0x10410800,0x08410820,0x9cd30000,0xce38ce59,0xb575bdd7,0x7baead35,0x18820000,0x00001041,0xef3c8c50,0xfffff79d,0xffffffff,0xffdfffbe,0x62ebf75d,0x10820000,0x00001082,0x18a20000,0x10821881,
-0x08410000,0x000010a2,0xffffbdb6,0xffdfffdf,0xffffffff,0xffffffff,0xffffffde,0x0000ad34,0x002010a2,0x10210841,0x18c31041,0x00000000,0x00000000,0x18a21081,0x00000820,0x00000841,0xef7d39e7,0xffdeffff,0xffdfffdf,0xffdfffff,0xffdfffff,0x1000c556,0x00410841,0x00200020,0x106110a2,0x00000000,0x18a20841,0x738e0000,0xf7def7de,0xf7deffff,0xffbef7be,0xff7dffff,
-0x1000838e,0x10821061,0xad750020,0xffdfffff,0xf79dffff,0xff9effde,0x0800730c,0x000018a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10002082,0xf73c62aa,0xffffffdf,0xfffff7de,0xffdfffbe,0x5acbffbe,0x18c20000,0x10211041,0xffdfcdd7,0xffdeffdf,
-0xfffffffe,0x4a69ef7c,0x20a20000,0x628a0800,0x4a28a4d2,0x00000020,0x08610061,0x10620000,0x6acb0800,0xffdfde38,0xffdfffff,0xffffffbe,0xe73cffff,0x2124ad95,0x10610000,0x10410000,0x08000800,0x62ca20a2,0x000018c2,0x10821061,0x00400040,0x10200820,0xbd760000,0xffdfffbe,0xf7deffde,0xffdeffff,0xffffffdf,0x1041e6bb,0x08200000,0x10820000,0x00000000,0x7b6e3986,
-0x08400000,0x08200840,0xce381041,0xffbeffdf,0xffdfffbe,0xffdeffdf,0xce38ffff,0x10610000,0x39850800,0xffffef1c,0xffdfffde,0xffffffdf,0x39e7ef3c,0x08610000,0x18a20861,0x08200841,0x002010a2,0xf7be738e,0xffffffff,0xffffffff,0xe71cffff,0x00004a49,0x00001882,0xffbe6b2c,0xf7deffff,0xf7beffff,0xffdfffde,0x0000b575,0x10821061,0x31650000,0x080020a2,0x18a20000,
-0x00200020,0x00001061,0xe6db736d,0xffffffdf,0xffdeffdf,0xffdfffdf,0xdebaffff,0x0000734d,0x00001082,0x10820021,0x00000000,0x7bcf0000,0x83cfc617,0x00000000,0x00001061,0x00200020,0xad340000,0xffffef7d,0xffdfffff,0xffdfffbf,0xc5b7ff5d,0x08005a29,0x00200841,0x10a20041,0x00000020,0x94916b8d,0x08000800,0x00001041,0xffffc638,0xf7deffff,0xffdfffff,0xde79ffdf,
-0x08201061,0x00001882,0xef9d52aa,0xffffffff,0xfffff7ff,0xfffff7be,0x1000d5f8,0x08610820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610000,0x20811000,0xfffece17,0xffffffdf,0xffffffff,0xffdeffdf,0xb595ffff,0x10810000,0x08001061,0xff5d834d,0xf7deffff,
-0xfffff7fe,0x00008430,0x102020c2,0xde382082,0xf75cffde,0x630bad54,0x00000040,0x00000841,0x08001862,0x83ae1841,0xffbed659,0xef5cffff,0x4248a534,0x00000000,0x00000800,0x08001061,0x940f2061,0xff9dde79,0x6b2cd679,0x00000000,0x00000882,0x10410820,0x21030000,0xe6db9451,0xffdeffff,0xffdfff9e,0xdebaff9e,0x08008bef,0x00001061,0x00001081,0x9c923165,0xff9def1c,
-0x00005acb,0x188218a2,0x6b2d0000,0xffdff75d,0xffdeffdf,0xffdeffde,0x83efffbe,0x20c30000,0x94300800,0xff9effde,0xffffffdf,0xf7dfffff,0xa514ffff,0x10820000,0x00200000,0x08610021,0x29850020,0xffffe71c,0xffffffde,0xffffffff,0xffffffff,0x0000b596,0x18a218a2,0xc5d70000,0xffffffff,0xfffff7de,0xef1cffdf,0x080041e7,0x000018c3,0xdeba39c7,0x8bf0d679,0x00001061,
-0x00000841,0x10410000,0x31250800,0xe6dba4b2,0xffbeffdf,0xef3cffdf,0x29249cb2,0x08400800,0x00200000,0x00000841,0x7bae0000,0xf77dde9a,0xffbeffdf,0x41e7b575,0x08610820,0x08410000,0x00000000,0xce386b4c,0xffffff7e,0xde59ff9e,0x0800838e,0x18620800,0x08610000,0x00000000,0xbe174a89,0xfffff7be,0x08009430,0x000020c3,0xef9d5aeb,0xffffffff,0xffdeffde,0x8bf0ff9e,
-0x10a20000,0x00000800,0xffffc618,0xffffffff,0xffffffff,0xffffffff,0x838eff9e,0x10a20000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10820020,0xacb20800,0xffdeffbe,0xffffffde,0xffffffdf,0xffbeffff,0xe73cffff,0x08002945,0x10201882,0xee7a3082,0xf7deffff,
-0xc638ffff,0x08400000,0x080018a2,0xffbeacf3,0xffffffde,0xfffeffff,0x2104a534,0x10610000,0x08400000,0x00000000,0x838e1841,0x3986acd3,0x00000000,0x086110c2,0x10410000,0x4a080000,0xffffce38,0xffbeffff,0xff9effdf,0x4208bd96,0x00200000,0x00000800,0x00200841,0x28c30000,0xff7db4f3,0xde79ffbe,0x18829431,0x08200000,0x08610840,0x52aa0000,0xffffdeba,0xffffffdf,
-0x0000c638,0x10810840,0x00001082,0xffffbdb7,0xffffffde,0xffffffff,0x0840d699,0x10610000,0xd6381020,0xffbeffff,0xf7ffffff,0xffffffff,0xef5dffff,0x080041c7,0x00201061,0x08820041,0xb5950000,0xffffffff,0xffffffff,0xffdfffff,0xffffffdf,0x4a28f77d,0x20c30000,0x630b0000,0xffdfff9e,0xf7beffde,0x9c72ffff,0x18820800,0x000018a2,0xffffad55,0xffffffbe,0x7baede9a,
-0x00001062,0x00001061,0x00001081,0x31450000,0xd638a4b2,0x28e39c51,0x00000000,0x00001081,0x10a20000,0x5aab0000,0xffdfc618,0xffffffdf,0xffbeffdf,0xdedbffde,0x0000528a,0x000018a3,0x10610840,0x00000000,0xb55583ae,0x10418bcf,0x08200800,0x00000861,0x00000821,0xa5133186,0xfffff7de,0xffdff7be,0x5a49f71c,0x20e30000,0x94b20020,0xffbeffdf,0xffdfffdf,0x2082e69a,
-0x18a20800,0x52690000,0xfffff79e,0xffffffbf,0xf7dfffff,0xffdfffdf,0xcdd7ffdf,0x00201061,0x00200841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08610040,0xbd750800,0xffbeffde,0xffffffff,0xffdfffff,0xffffffff,0xffdfffff,0x00009491,0x104118a2,0xee7a2862,0xffffffbe,
-0x5aaaef5c,0x20c20000,0x52080800,0xfffff73c,0xffbeffde,0xffffffde,0x6b4cf7de,0x10610020,0x18a20000,0x188218a2,0x08001020,0x08000800,0x10a220e3,0x00000000,0x10610841,0x9cb20000,0xffdeffde,0xffdeffde,0xffdfffdf,0xf77dffdf,0x08208c30,0x08001061,0x10610000,0x00001882,0x628a0800,0x18827b6d,0x08000000,0x082018c3,0x10610841,0xbdb60000,0xffdeffff,0xfffeffde,
-0x9491f7be,0x10810020,0x00001082,0xe6fb39a7,0xffffffdf,0xffffffde,0x00009471,0x00002103,0xffdf83ae,0xffdfffbe,0xf7ffffff,0xffffffff,0xffdfffdf,0x0800b555,0x00201081,0x00000861,0xf7be632c,0xffffffff,0xffffffff,0xffffffff,0xffdfffdf,0xad55ffff,0x10610000,0x00001061,0xffdfce38,0xffffffdf,0x20c3de7a,0x18c30000,0x6b4c0000,0xffbeffbe,0xffdeffff,0xff9effdf,
-0x08006b2d,0x00001061,0x10a20841,0x000018c3,0x10200800,0x10000800,0x10821882,0x00000861,0x00000861,0xd69a18c3,0xffffffff,0xfffff7be,0xffffffde,0xffffffff,0x00008410,0x000018a2,0x10810841,0x188220e3,0x00000800,0x08000800,0x10a218c2,0x00200861,0x000010a2,0xffff9cb2,0xffffffdf,0xffdeffff,0xc596ffdf,0x18a20000,0x00000000,0xffffdeba,0xffffffbe,0x5208ff3d,
-0x18c30000,0x738e0000,0xfffff79e,0xffdfffbf,0xffffffdf,0xffbfffdf,0xb535ffdf,0x08610000,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10a20000,0x4a080000,0xffdfef1b,0xfffeffde,0xffffffff,0xf7defffe,0xf7deffff,0x00007bce,0x00001903,0xff9e72eb,0xffffffff,
-0x00009cb2,0x102020c3,0xcdf71020,0xffdeffff,0xfffeffff,0xffffffde,0x630cef7d,0x10820000,0x00000840,0x00000000,0x20c318a2,0x18a220c3,0x08000000,0x29043124,0x10a20000,0xad140000,0xffdeffff,0xffdfffde,0xf7deffde,0xffffffdf,0x0000d67a,0x08410820,0x00000821,0x18c31082,0x00001081,0x00200000,0x086118e3,0x00000000,0x08200820,0xbdd70000,0xffdeffff,0xf7feffff,
-0xef5cffff,0x00004a69,0x18a31082,0x8c100000,0xffdfffdf,0xef7dffff,0x00004207,0x000018c3,0xffdf8bcf,0xffdfffbe,0xffffffff,0xffdfffff,0xffffffdf,0x0000ad34,0x08001882,0x00201082,0xffdf738d,0xffdfffdf,0xffdfffdf,0xffffffff,0xffffffdf,0x9492ffff,0x18c30000,0x18a20000,0xffdfce79,0xf79effdf,0x0800630c,0x000020c3,0xce591041,0xffffffdf,0xffbfffff,0xff9effdf,
-0x000062cb,0x10611061,0x00000000,0x18a20820,0x104118c2,0x20c318a2,0x00000000,0x08200820,0x00001062,0xef7d39c7,0xffdfffde,0xffdfffff,0xffdeffff,0xfffff7be,0x00009471,0x084118a2,0x00000000,0x00000000,0x106120e3,0x18c218e3,0x00000000,0x00410000,0x000010a2,0xffffa4f4,0xfffff7de,0xfffff7df,0xff9effbf,0x0000736e,0x000018e3,0xef3c52aa,0xffbfffff,0xbd76ffdf,
-0x18c30800,0x08410000,0xffdfce79,0xffffffdf,0xffbfffff,0xffdfffff,0x3965e6bb,0x10a20000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x080018a2,0xffbe83ae,0xf7befffe,0xffffffde,0xf7def7de,0xd6daffff,0x08400000,0x00000860,0xffdfcdf7,0xd679ffff,
-0x08001041,0x08001862,0xffbe8baf,0xffbeffde,0xfffefffe,0xffffffde,0x5249f77d,0x18a20000,0x52aa0000,0x18a26b6d,0x08000800,0x00000000,0xb575528a,0x62cbde7a,0x18c30000,0xad140000,0xffffffde,0xffdff7be,0xffffffff,0xffffffdf,0x0000c5f8,0x10610020,0x28e40800,0x00000000,0x18c218a2,0x10c218c3,0x00200000,0x210439c7,0x08200800,0xc5f70800,0xf7beffff,0xf7deffff,
-0xffffffde,0x0000ce58,0x10620000,0x08200841,0xffdfd679,0xffbeffbe,0x0000738e,0x080018c2,0xcdd71841,0xffdfffff,0xffbfffdf,0xffbeffdf,0xd659ffff,0x08000820,0x10610820,0x00000841,0xbdd60840,0xffdfffff,0xffffffff,0xffdfffff,0xffffffbe,0x0841d679,0x10610820,0x630b0000,0xffdff7be,0xb555ffff,0x10820000,0x00001082,0xffdf8c31,0xffdeffdf,0xffdfffdf,0xef3cffff,
-0x00005aaa,0x00001082,0x6b2c3986,0x000020e3,0x00000000,0x00000000,0x62cb1041,0x00005a8a,0x08001882,0xef5c5269,0xffffffff,0xffffffde,0xffffffff,0xfffff79e,0x00009492,0x000020c3,0x9cf34a69,0x08416b2c,0x08400000,0x00200000,0x5aeb2104,0x00004228,0x000010a2,0xffdf8c30,0xf7deffff,0xffdfffff,0xffdfff9e,0x0000ce59,0x18c30000,0xa4f40000,0xffdfffff,0xeefcffdf,
-0x00003145,0x000018c3,0xf79e6b6d,0xffdfffbe,0xffbef79e,0xffdfff9e,0x08009c51,0x000010a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10410861,0xc5b70800,0xffdfffde,0xffbeffbe,0xffffffff,0x840fffbe,0x18a20820,0x736d0000,0xffbeff9e,0x6aebff7d,
-0x18620820,0x18410800,0xffdfe67a,0xffffffbe,0xffffffff,0xffffffff,0x3145ef3c,0x18c20000,0x8c510000,0xd69affff,0x6acb8c10,0xce389471,0xffffef7d,0x6b6dffdf,0x20c30000,0xb5340800,0xf79dffff,0xffffffff,0xffdfffdf,0xfffff7be,0x0000ce79,0x00200041,0xc5b71020,0x5249b535,0x00000800,0x00000000,0xb5964207,0x5289d69a,0x18a20000,0xbdb60000,0xffffffff,0xffffffff,
-0xffffffff,0xa4d3ffdf,0x10820000,0x000020c3,0xffbe7bae,0xffffffde,0x0800c5d7,0x18a21061,0x7b6d0800,0xffdff79e,0xffdff7be,0xffdfffff,0x62ebe71c,0x18a20000,0x00000820,0x08611082,0x31450000,0xffffe6fb,0xffffffdf,0xffdfffff,0xffdfffbe,0x00006b2c,0x10821082,0xa5130000,0xffffffde,0x2082de9a,0x18a20820,0x18c20000,0xffffdeba,0xffffffff,0xfffefffe,0xef7dffde,
-0x000041e7,0x000020e3,0xf79d7bcf,0x9492deba,0x29655aaa,0xa4f3528a,0xffdfd679,0x1862ce38,0x00001021,0xef5d528a,0xffdfffff,0xffffffff,0xffdfffff,0xfffff7be,0x00009472,0x000020c3,0xffff7bcf,0xd6baf7be,0x00207bcf,0x8c512944,0xffdededb,0x0000a4f3,0x000018c3,0xffff83ef,0xffffffdf,0xffdfffdf,0xffbfffdf,0x8c10ffdf,0x10820000,0x20c30000,0xffffd67a,0xffdfffbf,
-0x00009451,0x108118a2,0xb5b60000,0xffffffdf,0xffdfffff,0xd638ffdf,0x08001020,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10620000,0x49e80800,0xffffeefc,0xffdeffff,0xffffffff,0x0000ce38,0x10810000,0xbd960000,0xffdfffde,0x0800bd96,
-0x18a20841,0x83af0800,0xff9eff7e,0xf79df79d,0xf7beffbe,0xfffff79d,0x3145e6db,0x18a20000,0x9cb20000,0xffffffff,0xff7effdf,0xffffffff,0xf7deffff,0x630bef7d,0x20c30000,0xa4d30800,0xffdfffff,0xffbeffdf,0xffdfffdf,0xffffffff,0x1082ce59,0x08810000,0xd6381041,0xf73cffdf,0x6b0bbd95,0xb57562eb,0xffffe71c,0x3185ef5c,0x18820000,0xad140000,0xff9eff9e,0xffbef77d,
-0xf79dff9e,0xe6dbf75d,0x000041e8,0x10411061,0xc5f70820,0xffffffff,0x62cbf79e,0x18820000,0x10200800,0xffffce18,0xffffffdf,0xffffffdf,0x00009471,0x082018a2,0x29240800,0x08410000,0x00001882,0xf75d734d,0xf79effbe,0xffdfffbe,0xad34ffdf,0x10820000,0x00001061,0xe71b2924,0xf77dffff,0x0800730c,0x108118a2,0x94910000,0xffbeffff,0xf7bdffde,0xef5cf7de,0xc617ffbd,
-0x00002924,0x000018a2,0xffff9cd3,0xffdfffff,0xdefbef7d,0xffffef7d,0xffffffff,0x3145e6fb,0x00000000,0xf77d5a8a,0xffdfffff,0xffffffff,0xffffffbe,0xffbfffdf,0x00007bcf,0x00002104,0xffdf9471,0xffffffdf,0xd6baffff,0xffdedefb,0xffdfffff,0x0000b555,0x000018c3,0xce7952aa,0xd69ad69a,0xe6dbdeba,0xde7ade79,0x8c30de7a,0x10810000,0x00001062,0xb575630c,0xacf4b535,
-0x000062eb,0x10821061,0x4a480000,0xdebbce79,0xde9ade9a,0x5269d639,0x10820800,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08200821,0x00001041,0xa4b36b0c,0xa4b29471,0x94519cb2,0x00004228,0x00001061,0x528a1061,0x8c1083af,0x000041c7,
-0x00201082,0x4a080000,0x734d7b8e,0x6b2c6b2c,0x736d6b4c,0x734d734d,0x08206b0c,0x18a20820,0x94510000,0xffdfffdf,0xffffffdf,0xffdeffff,0xffffffff,0x630cf79e,0x10820000,0x39a60800,0xffbebd75,0xffdfffdf,0xf7beffff,0xfffff7ff,0x18a2d679,0x10810000,0xce181020,0xffffffff,0xf7beffff,0xfffff7be,0xffdfffff,0x18a2deba,0x08410000,0x41a60800,0x730c62cb,0x7b2c6aab,
-0x6b0c732c,0x5acb528a,0x00003186,0x10620821,0x52490000,0x9c919c92,0x52699cb2,0x08410000,0x08001041,0x943149e8,0x94518bf0,0x9c92b514,0x08200000,0x000020c2,0xde9a7b8e,0x080062aa,0x10211882,0x5a8a0800,0x734d7b8e,0x7bae7bae,0x210483cf,0x08400000,0x00000841,0x94713165,0x7b8ea4f3,0x10410800,0x08200800,0x6b4d0000,0x8bef9c71,0x7b6d838e,0x6aeb734c,0x39455a29,
-0x08200800,0x00001082,0xffffad54,0xffffffbe,0xffffffff,0xffffffff,0xffffffdf,0x41c7ef1c,0x00000000,0xd67918e3,0xffffffff,0xffbeffbe,0xffdfffff,0x8c51ef3d,0x000018c3,0x00001082,0xffdead75,0xffdeffff,0xffffffdf,0xffbeffff,0xf75dffff,0x00009451,0x086110a2,0x00000000,0x08400820,0x08410840,0x08000820,0x00000000,0x00000841,0x08610000,0x00000000,0x00000000,
-0x08410000,0x00000020,0x00000861,0x08210000,0x10410800,0x00000000,0x00000840,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x08000000,0x08411061,0x10610821,0x00000000,0x08000800,0x00000800,0x10810000,0x08200820,0x00000020,0x08000000,0x08610000,
-0x00200000,0x08000841,0x08000000,0x00000000,0x00000000,0x08000800,0x00000000,0x08410000,0x28e30000,0xde9a838e,0xf7deffff,0xffdfffde,0xffbeffdf,0x73aeffff,0x18c30000,0x00000841,0x7bae0800,0xffdfe6db,0xffffffdf,0xe6fbffff,0x08006b2c,0x18a210a2,0xc5d70800,0xffbeffde,0xffdeffff,0xffbeffff,0xffffffdf,0x18a2deba,0x10610000,0x08000000,0x08000800,0x08000800,
-0x08200000,0x00000000,0x00200000,0x00000020,0x00001061,0x00000820,0x00000000,0x00001082,0x10410000,0x08000800,0x08000800,0x08001000,0x10811040,0x41a60000,0xffffe6da,0x3125de9a,0x18820800,0x00001061,0x08000800,0x00000000,0x00000000,0x10610841,0x08410000,0x00000000,0x00000000,0x00001041,0x08200000,0x00000821,0x08000000,0x08000800,0x08000800,0x08000800,
-0x08200800,0x00001061,0xe71b736d,0xffdeffff,0xffffffde,0xffffffff,0xffdfffde,0x4a28f75d,0x18e20000,0x31650000,0xe71c9cb2,0xffffffff,0xad55f77e,0x000041c7,0x10820000,0x000018e3,0xffffbdf7,0xffdfffdf,0xffbeffdf,0xffdfffde,0x732cd659,0x08200800,0x00200000,0x10810881,0x10611061,0x10611061,0x10611061,0x10811081,0x08611081,0x00000000,0x088110a2,0x18e30861,
-0x10a21082,0x10811082,0x08410840,0x00000861,0x08200841,0x10611082,0x10611081,0x08001061,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x10411020,0x00000000,0x18c218a2,0x20e418c3,0x106118a2,0x18e310a2,0x10411041,0x08611082,0x18e310a2,0x18a218c3,0x00000841,
-0x08400040,0x18a21061,0x18c218c3,0x20c320c3,0x20e318c2,0x28c328e3,0x084018a2,0x00000020,0x00000841,0x29040800,0xef1c9c92,0xffdfffbf,0xffffff9e,0xa534ffff,0x18620000,0x10820840,0x00000841,0xad143986,0xe6fbf73c,0x3144acf3,0x08200800,0x000010a2,0xdeba39c6,0xffdeffdf,0xf7beffff,0xffbfffdf,0xde9affbf,0x08007b6d,0x00000820,0x08610000,0x18e218e3,0x20e318e3,
-0x10a218e3,0x10c218c2,0x10c20881,0x00000882,0x08400000,0x10a218a2,0x10812103,0x10820881,0x08001061,0x10821041,0x18c310a2,0x188218c3,0x000018a2,0xce171882,0xffffffdf,0xb5b6ffff,0x00000000,0x18a21041,0x18a218a2,0x18a218c2,0x082018c2,0x10810820,0x18a218c2,0x210418a2,0x106218c3,0x00000021,0x08620020,0x18e310a3,0x21042104,0x20e320c3,0x18a218e3,0x18a21882,
-0x00000841,0x08410820,0x39c70000,0xffdfb595,0xfffeffff,0xffffffdf,0xffdfffde,0x9492ffff,0x10810000,0x00001082,0x31860000,0xc5d7b555,0x000062ab,0x18a20000,0x08611082,0x52aa0000,0xffffdf1b,0xf7beffde,0xffdfffff,0xa4d3f73d,0x08001041,0x08200841,0x00200820,0x00200000,0x08000000,0x00000000,0x08000000,0x00000800,0x00000000,0x08001040,0x08400000,0x00000020,
-0x00000000,0x00000000,0x00200000,0x08400861,0x00000840,0x00000000,0x00000000,0x18610800,0x08410821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x10610000,0x39040800,0x31658bef,0x00000000,0x00000000,0x08410000,0x00200020,0x08000800,0x00000000,0x00000000,0x00000000,0x00000861,
-0x00000000,0x00000000,0x00000000,0x08000800,0x00000000,0x08000800,0x00200000,0x00200000,0x08200000,0x00001061,0x31240800,0xff5dacf3,0xf79effff,0xef7dffff,0x00009471,0x10810000,0x10a20040,0x08000000,0x4a085a69,0x08000800,0x10611861,0x5aca0820,0xffdfd699,0xffbeffff,0xffffffbe,0xe6dbffff,0x10008bcf,0x08000800,0x00000000,0x00000040,0x00000020,0x00000000,
-0x00200000,0x00000000,0x00200000,0x08610000,0x08400000,0x00000840,0x00000000,0x00000000,0x08200000,0x00200820,0x00000841,0x00000000,0x08000800,0xffdfad13,0xffffffde,0xfffff7be,0x00009cb2,0x00000000,0x00000000,0x08400000,0x08400000,0x00000000,0x00000000,0x00000000,0x08410000,0x00000841,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x08410000,0x00000000,0x000010a2,0x6b4c0000,0xffffdeda,0xffdfffde,0xffdfffde,0xf79effdf,0x00008c71,0x18c20000,0x00001082,0x00000000,0x10620000,0x08411082,0x00200000,0xef7d8410,0xffffffff,0xffffffde,0xd618ffdf,0x08005a49,0x10820800,0x08200020,0x00000820,0x41e718c3,0x52495249,0x52695269,0x52695269,0x4a284a48,0x4a075269,0x08001020,0x00000820,0x420810a2,
-0x52894a48,0x52895acb,0x000018a2,0x00200020,0x10810820,0x31a62103,0x5aaa31a6,0x628ab534,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10200020,0x30622021,0xd658de18,0x7bce83ef,0x524962eb,0x08203144,0x10810040,0x7acc1800,0xb595bd55,0x9d13a534,0x082083ef,0x08200820,
-0x21030800,0x630b5aaa,0x7bae738d,0x7b8e734d,0x7bae736d,0x7bae83ef,0x00005269,0x00200020,0x10610000,0x18821061,0x00001082,0x6b0c0800,0xffdfde79,0xffbeffff,0xbdf7ffff,0x00000840,0x00201082,0x10820840,0x00000000,0x104118a2,0x08001862,0xf75d7b6e,0xffdfffff,0xffdeffbe,0xf75dffff,0x3145acf3,0x10200800,0x08411882,0x08410000,0x4a480820,0xb5349c91,0xa4b2acf3,
-0xa4b2a492,0xb554a4d3,0xb575bdb6,0x000062cb,0x10001041,0x39650800,0x4a084a08,0x4a084a28,0x080028e3,0x08410841,0x10620000,0x62eb39a6,0xb5559430,0xffdfffbe,0xfffff79e,0xffdfffff,0xd679f79e,0xc5f7bdd7,0xc5f7bdd6,0x00006b4c,0x00001081,0x947120e3,0x840f94b2,0x8c518430,0x00005a89,0x10600800,0x42070020,0x7bce738d,0x8c0f9470,0x83ce83ee,0x838d836d,0x6b0b7bad,
-0x000020a3,0x00200820,0x10a20881,0x00000881,0xa4f31081,0xffffffbe,0xffffff9e,0xffdff7be,0xbdb6ffde,0x00002945,0x10621082,0x10821082,0x08211082,0x00000821,0xb59539c7,0xffdeffff,0xfffff7be,0xff7effdf,0x10219c92,0x18820800,0x10821061,0x00000020,0x000010a2,0xf79ea513,0xffbeff9e,0xf7bdf7be,0xffbef79d,0xf79df7be,0xdebaffff,0x00001861,0x004018c2,0xffdf8c91,
-0xf7bef7be,0xffdef79e,0x0800a4d3,0x08611082,0xad550000,0xe73ce73c,0xff9eef9d,0x832dff3d,0x08610000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18600000,0x38823062,0xffdfddd7,0xffdeffde,0xff9ef75c,0x0000ad54,0x10810020,0xe6182862,0xffdeffdf,0xffffffff,0x0000d699,0x18a20000,
-0x8bef0800,0xf79df77d,0xffdef79d,0xffbeffde,0xffbeffdf,0xffdef7be,0x18e3deda,0x08200020,0x00001061,0x10820000,0x10611061,0x00001061,0xacf31862,0xffdfff7d,0xffdfffbe,0x5aebdeda,0x08400000,0x08400020,0x10611061,0x18820800,0x7b8e0800,0xffdfff9e,0xffbeff9e,0xff9effff,0x5a69bd96,0x00000000,0x18c218a2,0x00000841,0x10820820,0x9c920000,0xffdfffdf,0xffbeffdf,
-0xffbeffdf,0xffffffdf,0xffffffbf,0x0000ad14,0x080028e3,0xeedb6269,0xf71cf73d,0xf77df73c,0x1061c5d7,0x18820000,0x6b0c0000,0xf77ddeba,0xffdfffdf,0xf7beffff,0xffdeffff,0xffffffdf,0xffbeffdf,0xffffffff,0xffbeffff,0x00006b4c,0x00002104,0xffdf7bcf,0xffffffff,0xffdfffff,0x2924d658,0x18a10000,0xc6170000,0xffbdffbd,0xffbdfffe,0xff9dff9d,0xffbeff7c,0xe6faffdd,
-0x00004a08,0x00201061,0x00200000,0x18c21082,0x00000000,0xce1862cb,0xffffffff,0xffffffdf,0xce58ffdf,0x00003165,0x00200841,0x108218c3,0x08210020,0x00001082,0xffff9cd2,0xffffffbe,0xffbeffff,0x5269c5d7,0x08200000,0x18c21061,0x00000000,0x08400000,0x000010c2,0xffffbdd6,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xe6fbffff,0x080020a2,0x000018c3,0xffdfad55,
-0xffffffde,0xffdfffdf,0x49e7f73c,0x10820000,0xb5b60000,0xfffeffff,0xffffffff,0x72abff5d,0x10820000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200020,0x48833841,0xffded596,0xf7bdffde,0xffdeffff,0x000094d2,0x102018c2,0xff3c834d,0xf7bdffbe,0xfffffffe,0x0020d699,0x18a20861,
-0xa4b20800,0xffffffde,0xffdeffff,0xffffffff,0xffffffff,0xfffffffe,0x4a69f79e,0x18a20000,0x5acb0000,0x00005acb,0x18a20000,0x10a20861,0x00000000,0xd6595a69,0xffffffff,0x8c0fff9e,0x10a20000,0x08610841,0x084118c3,0x10610000,0x42080000,0xff9ecdf8,0xffdfffff,0x62cbd619,0x00000000,0x18e310a2,0x00000882,0x08610020,0x18a20000,0xa4f30000,0xff9effde,0xffffffde,
-0xffdeffde,0xffbeffde,0xffffffdf,0x00009cf3,0x00002924,0xffff83cf,0xffffffde,0xffffffff,0x7bceffff,0x18c20000,0x41e70000,0xffffef1c,0xfffff7be,0xfffffffe,0xfffff7ff,0xffffffff,0xffdfffdf,0xffdeffde,0xbdf7ffff,0x10810000,0x08410000,0xffffce38,0xffdeffde,0xffffffdf,0x41c7f75d,0x08610000,0xdeba0000,0xffdfffff,0xfffffffe,0xffffffff,0xffdeffbe,0xef7dffff,
-0x000052aa,0x000010a2,0x630c738e,0x00000000,0x18c218a2,0x00000000,0xef5d8430,0xde9affbe,0x00007baf,0x10820000,0x084110a2,0x00000000,0x10820020,0x00001081,0xa4d23986,0xff9eff9e,0x6b0cde7a,0x00000000,0x10a218a2,0x000010a2,0x6b4d39c6,0x00002103,0x000010a2,0xffffbdd6,0xffdfffdf,0xffffffff,0xffffffff,0xffdfffdf,0xeefcffdf,0x08003925,0x000020a3,0xffffad55,
-0xffdfffdf,0xffbeffdf,0xbd55ffbf,0x21030000,0x52890000,0xf7def79d,0xffbeffff,0x726aff1d,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18200000,0x38413041,0xffdeddb6,0xffdef77d,0xe71bffff,0x000010c2,0x10201882,0xffdfc596,0xfffff7bd,0xffffffde,0x0020d6ba,0x18c20000,
-0xa4b20800,0xffbeffff,0xffffffff,0xffffffde,0xffffffff,0xf7feffff,0x5289ef7d,0x18c30020,0xa4d30800,0xa514f7be,0x00002104,0x10810861,0x10a20861,0x20a20000,0xb555ad13,0x000049e7,0x10610820,0x00001061,0x00200000,0x00001062,0x00001082,0x8c100800,0x8c51d659,0x08001021,0x18e31061,0x00001082,0x7bef0000,0x3165b596,0x18820000,0xa4d30800,0xffffffdf,0xfffeffde,
-0xfffeffff,0xffffffff,0xffffffff,0x000094b2,0x00002103,0xffff840f,0xffdeffff,0xffdeffff,0xc638ffff,0x10810000,0x000018a2,0xffffa4d3,0xfffff7be,0xffdffffe,0xffffffff,0xffdff7df,0xffdfffff,0xffdeffff,0x8430ffde,0x20e30000,0x630b0000,0xffbeffdf,0xffffffff,0xffffffdf,0x49e8f73d,0x18c30000,0xd69a0000,0xffdfffff,0xffffffff,0xffffffdf,0xffffffff,0xef9dffff,
-0x000052cb,0x000010a2,0xffffce38,0x20e3ad34,0x00000000,0x002018c3,0x4a280000,0x21047bae,0x08410000,0x08201082,0x00000000,0x7c0f6b8d,0x00000000,0x10820841,0x00000000,0x83cf6aeb,0x00001041,0x10a21061,0x00201082,0x7bce0000,0xe73cef5c,0x00004228,0x000018c3,0xffffc638,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0xf71cffff,0x08003905,0x08001862,0xffffbdb7,
-0xffffffff,0xffdfffff,0xeedbffdf,0x00004a08,0x000018c3,0xffffad54,0xffdff7de,0x724afefc,0x10820800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000800,0x30a21800,0xffbfd596,0xffbeffbe,0x9cb2ffde,0x18c20000,0x5a490800,0xffbeff5d,0xffdeffbe,0xffffffde,0x18e3d6ba,0x18c20000,
-0xad140800,0xffdfffdf,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0x630cf79e,0x18c30000,0x9cb20800,0xffffffff,0x7baededb,0x00000000,0x004010c2,0x000010a1,0x00000000,0x10610000,0x080020a2,0x83ce1861,0x00008c30,0x10810000,0x08610861,0x00000841,0x00001062,0x18a20000,0x000018a2,0x42280000,0xffffb5b6,0x2904deba,0x18820000,0xb5140800,0xffffffdf,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x00009cd3,0x00002104,0xffff8c30,0xffffffdf,0xffdfffff,0xf79dffff,0x0000736d,0x000020c3,0xff9e5aaa,0xffbeffdf,0xffffffbe,0xffffffff,0xffffffdf,0xffdfffdf,0xffffffdf,0x10a2ce79,0x18c20000,0xad340000,0xffbeffff,0xffdfffdf,0xffdfffff,0x4a08f75d,0x18820000,0xdedb0000,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xf79effff,
-0x00005aaa,0x000018a2,0xffffce58,0xe71bffdf,0x000083ef,0x08610000,0x000018a2,0x00000000,0x108218c2,0x00000000,0xce59632c,0xffdeffff,0x738ece59,0x00000000,0x188218c3,0x00000800,0x10a20000,0x08610881,0x42280000,0xf7bebdd7,0xef3cffff,0x00004228,0x000018c3,0xffffc617,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xf71cffff,0x10004986,0x08001882,0xffffb596,
-0xffffffdf,0xffdfffdf,0xf75dffdf,0x000062aa,0x000018c3,0xdeba4207,0xffdfffdf,0x59e8fedc,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18410800,0x20811041,0xff9ed596,0xffdeffdf,0x18a2c5d7,0x10610820,0x28c30800,0xef1ca4b2,0xffdeffde,0xffffffbe,0x4248e73c,0x18c30000,
-0xa4f30000,0xffffffff,0xffdfffff,0xffffffff,0xfffff7be,0xffffffff,0x6b4df79e,0x18c30000,0xb5350000,0xffffffdf,0xffdfffff,0x4a48c638,0x00400000,0x08610000,0x106118c2,0x000018c2,0x5a691020,0xff9dcdf7,0xce38ffff,0x00005aaa,0x10820000,0x08611082,0x10610000,0x00001062,0x31860000,0xef7dad34,0xffffffff,0x0000d639,0x18a20800,0xacf40800,0xffdfffff,0xffffffff,
-0xffffffff,0xffffffff,0xfffff7de,0x0000a513,0x00002124,0xffff8c30,0xffffffff,0xffdfffdf,0xffffffdf,0x0000a514,0x106118a2,0x7b8e0800,0xffbede7a,0xffdfffff,0xffdfffdf,0xffdfffff,0xffdfffdf,0xbdb6f77d,0x00004a28,0x10611061,0x6b4d0000,0xffffdedb,0xffdeffff,0xffffffdf,0x4a08f75d,0x20c30000,0xd6790000,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0xf79effff,
-0x00005aaa,0x000018a2,0xffffce79,0xffffffff,0xce58ffff,0x00006b4c,0x10810841,0x10c20861,0x00200000,0xb5965289,0xffffffdf,0xf7beffde,0xf7beffff,0x5acac638,0x00000000,0x18a21882,0x08810861,0x00000000,0xef5c8c71,0xffdeffdf,0xef5cffdf,0x00004a69,0x000018c2,0xffffbdd7,0xffffffdf,0xffffffff,0xffffffff,0xffdfffff,0xef1cffff,0x100030c4,0x000018a2,0xffffbdb6,
-0xffdfffff,0xffdfffff,0x7b8edeba,0x10610000,0x10810020,0x41c70000,0xffbfb575,0x5a09ff3d,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x18611061,0xffbfbd14,0x7bcede99,0x00000840,0x08411082,0x00001040,0x4a280000,0xffbebd96,0xffdfffdf,0x5b2cf7be,0x18c30000,
-0xacf30800,0xffdeffff,0xffffffdf,0xffffffff,0xffffffff,0xffdeffff,0x6b6dffde,0x18c30000,0xb5750000,0xffbeffff,0xffffffbe,0xef5cffdf,0x00207bef,0x08200861,0x08001061,0x39a60000,0xf75ca4d2,0xffdeffdf,0xffffffbe,0xa534f79e,0x00002945,0x10820000,0x08210841,0x00001061,0xd6ba736d,0xf7deffff,0xfffff7de,0x18c3deda,0x10a20000,0xacf30800,0xf7deffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x00009492,0x00002104,0xffff9471,0xffdfffbe,0xffffffff,0x8c10ef1c,0x08412104,0x08410000,0x00000841,0x945120e3,0xffdfef1c,0xffbeffff,0xffdfffff,0xc5d7ffdf,0x000062cb,0x10610000,0x10411061,0x00001061,0xa5143165,0xffdfffbe,0xffffffff,0x39a6e6fb,0x10820000,0xdedb0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7beffff,
-0x00005aaa,0x000018a2,0xffffce58,0xffdff7be,0xffffffff,0x9471ffbe,0x10820000,0x00001082,0xa53410a2,0xfffff77d,0xf7beffff,0xfffff7be,0xffdeffdf,0xef7dffff,0x31659cb2,0x10610000,0x00000840,0xb5b62965,0xffffffff,0xffbeffde,0xf77dffdf,0x00005269,0x000020e3,0xffdfbdf7,0xffdfffdf,0xffffffff,0xffffffff,0xffffffff,0xeefbffff,0x18012882,0x00200841,0xffdfc638,
-0xffdfffff,0xad55f77d,0x000039a6,0x00201061,0x10c20861,0x000018a2,0x734d0000,0x3945acf4,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x00000840,0x9410838e,0x00000000,0x18a20841,0x00000000,0x08401081,0x000010a2,0x7b6d0800,0xffffde7a,0x52aaf79e,0x18c20000,
-0xb5340800,0xffdeffff,0xffffffff,0xffffffff,0xffdeffde,0xffffffff,0x5aebf79e,0x18c30000,0xbd750800,0xffdeffff,0xffbeffff,0xffffffbe,0x18e3e73c,0x10610000,0x29040000,0xef1b9cb2,0xffdfffdf,0xffffff9d,0xffdeffff,0xffffffff,0x94b2e73c,0x000018e3,0x10820841,0x736d0000,0xffffff9e,0xf7def7be,0xffffffff,0x0841deda,0x10a20000,0xa4d30800,0xffffffff,0xffffffff,
-0xffffffdf,0xffdeffff,0xffffffff,0x00009471,0x08402103,0xffff9471,0xffffffff,0x9c92ef1c,0x08003986,0x10610000,0x10811082,0x18c20861,0x00000000,0xb53541e7,0xffdfef1c,0xd659ffdf,0x0000736e,0x10620800,0x18821061,0x00000000,0x10611061,0x08200000,0xbdd75acb,0xfffff75d,0x18c2d69a,0x10820000,0xd69a0020,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xf79effff,
-0x000062eb,0x000018a2,0xffffb5b6,0xffdfffff,0xffffffbe,0xad14ffff,0x10a20000,0x00000000,0xffffbdf7,0xffdfffff,0xffffffdf,0xffdeffff,0xffffffff,0xffffffff,0xdebaffff,0x00004a08,0x000018c3,0xffffbdd7,0xffdeffdf,0xffffffff,0xf77dffff,0x0000528a,0x00002103,0xffffbdd7,0xffdfffdf,0xffffffff,0xffffffff,0xffffffff,0xe6bbffff,0x18211821,0x08610800,0xffffce79,
-0xce18ff9e,0x00006b0c,0x10820000,0x10821061,0x00000020,0x20c30000,0x00001041,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00200040,0x08000800,0x18c20000,0x08000000,0x298552ca,0x10820000,0x10611082,0x00001061,0xbd755228,0x6b2df77e,0x20e30000,
-0xbd750820,0xffbeffdf,0xffdeffff,0xffffffde,0xffffffde,0xffffffde,0x4228e75c,0x10a20000,0xbd750000,0xffbeffff,0xffdfffff,0xffdeffff,0x0020a4f3,0x10611081,0xbd751041,0xffffffdf,0xffffffde,0xfffeffde,0xffffffff,0xf7beffff,0xffffffff,0x0000bdd7,0x10620861,0x41e70000,0xffffef1c,0xfffff7de,0xffffffde,0x0020ce58,0x10a20040,0x9c920800,0xf7ffffff,0xffffffff,
-0xffdfffff,0xffffffff,0xffffffde,0x08008c30,0x00002104,0xffffa4d3,0xad34ef3c,0x080039a6,0x20a30800,0x000018a2,0x00000000,0x18a20000,0x18a21081,0x00000000,0xb55541e7,0x10419451,0x08200000,0x086110a2,0x00001082,0x21242945,0x10a20000,0x086118c2,0x00200000,0xc6185acb,0x0000bdd6,0x08610861,0xd69a0020,0xffffffff,0xffdfffff,0xffffffff,0xffdfffff,0xf79effff,
-0x000062eb,0x000018c3,0xffffb596,0xffffffff,0xffdfffff,0x4a28ef3c,0x18c30000,0x7bce0000,0xf7beffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffdf,0xffffffff,0x00009cb2,0x000018e3,0xffdf8c51,0xffffffdf,0xffbeffdf,0xf75dffdf,0x0000528a,0x000018a2,0xffffb575,0xffffffdf,0xffffffff,0xffffffff,0xffbeffff,0xd679ffff,0x10211021,0x29450000,0xdebadeba,
-0x10617bae,0x10610000,0x10a210a2,0x00000000,0xa53452eb,0x08004a08,0x08610820,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x10611041,0x08610861,0x94710800,0xcebaf7be,0x00005acb,0x10a20020,0x18c20020,0x00000000,0x4a285acb,0x10a20000,
-0xb5340800,0xffbeffdf,0xffdfffff,0xffdeffff,0xffdeffff,0xffdeffbe,0x2103e71b,0x10820000,0xbdb60000,0xffdeffff,0xff9effdf,0xe6dbffff,0x000018a2,0x080018c2,0xff9e730c,0xffbeffbe,0xffdeffdf,0xffffffff,0xffdeffff,0xffffffdf,0xffdfffdf,0x6b4dffdf,0x10820000,0x00001082,0xffffad34,0xfffff7be,0xffdfffbe,0x0000ce79,0x10a20861,0x9c920000,0xf7ffffff,0xffdfffdf,
-0xffbeffff,0xffffffbe,0xef5dffff,0x000062eb,0x000018a2,0xbd7683ef,0x00004a28,0x18820000,0x00001882,0x41c70000,0xb596ad14,0x00004a49,0x00200000,0x10a20861,0x00000800,0x08000800,0x082118a3,0x00200820,0x6b4d0000,0xdedbdeda,0x00006b4c,0x10a20000,0x088118c3,0x00200000,0x00002104,0x10820840,0xce790000,0xffffffff,0xffdfffdf,0xffbfffdf,0xffbfffbf,0xf77dffdf,
-0x00005a8a,0x000018a2,0xffffbdd6,0xffdfffdf,0xffffffdf,0x0000bdb6,0x10821061,0xc6380000,0xffdfffff,0xffffffdf,0xffffffff,0xffffffde,0xffffffdf,0xffffffde,0xffdfffde,0x0820de9a,0x00000000,0xce591081,0xffbeffff,0xffdfffdf,0xf77dffdf,0x0800528a,0x000020e3,0xffffbdd7,0xffdfffbe,0xffffffff,0xffffffff,0xffdfffdf,0xd659ffdf,0x10610800,0x18e30000,0x39866b2c,
-0x10410000,0x10821082,0x00000020,0xa5542945,0xfffff7de,0x9410ef1c,0x08810000,0x00400020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x08410020,0x00000861,0xffffad35,0xffffffff,0xad55ef7d,0x000018c2,0x10611082,0x10611862,0x00000000,0x18a20861,
-0xa4920800,0xffdfffdf,0xffffffdf,0xffdfffdf,0xffbeffdf,0xffdfffdf,0x0820de9a,0x10820000,0xb5750000,0xffffffdf,0xffdfffff,0x734dffbe,0x18c20000,0x28e30000,0xffdfde9a,0xffffffdf,0xffdeffdf,0xffdfffdf,0xffffffff,0xf7beffdf,0xffffffbf,0xd699ffff,0x000018c3,0x08001061,0xf75d5a69,0xffffffdf,0xffdfffdf,0x0000d699,0x10820020,0x94510800,0xffdfffff,0xffdfffff,
-0xffffffbf,0xffdfffff,0xef7dffff,0x00005aaa,0x00200861,0x00000800,0x18820000,0x18621882,0x10610000,0xe6fb83ef,0xffffffff,0x8c51ef5c,0x00002103,0x08200841,0x18821061,0x10211061,0x10610000,0x39c60000,0xffbeb596,0xffffffff,0xbdf7f7be,0x00005acb,0x18c20000,0x002010a2,0x10610000,0x08410820,0xdedb0820,0xffffffdf,0xffffffff,0xffdfffdf,0xffdfffdf,0xff7dffdf,
-0x08405269,0x000018c3,0xffffb575,0xffffffff,0xef5dffdf,0x00004a28,0x000018a2,0xf77d5289,0xffffffff,0xffffffdf,0xffdfffdf,0xffdfffff,0xffdfffff,0xffffffff,0xffdfffdf,0x8c51ffdf,0x29450000,0x8c310000,0xffffffdf,0xffffffdf,0xef3cffff,0x00004208,0x000020e3,0xffffc5f7,0xffffffff,0xffffffff,0xffdfffdf,0xffffffdf,0xbdf7ffff,0x10610000,0x00000040,0x00000000,
-0x186120c2,0x000018a2,0x8c510000,0xffffe71b,0xffffffde,0xbd96ffdf,0x00200840,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00200020,0x00000020,0xbdd75aeb,0xffdeffde,0xffffffff,0x738dd6da,0x00200000,0x086118a2,0x08611082,0x10410000,
-0x5a690800,0xad14a4f3,0xb575ad34,0xb575b535,0xb555b555,0xad34a4d3,0x00008c10,0x10620000,0x5aaa0000,0xad54a4f3,0xde9ac5d7,0x0800a4f3,0x08611081,0x4a080800,0xd638c596,0xe6fbe6fb,0xffdfff9e,0xffffffbe,0xffbeffff,0xffdfffff,0xffbeffdf,0xf7bef79e,0x0000632c,0x080018a2,0xa4b30800,0xe6dbe6db,0xf75de6db,0x0000b575,0x18a20020,0x83af0000,0xef5def3c,0xf71cff5d,
-0xef3cef1c,0xe71cef1c,0xdefbef5c,0x00005a6a,0x00201081,0x10610000,0x106118a2,0x00000000,0xce386b4d,0xffffffff,0xf7beffdf,0xf7beffff,0x00007bae,0x08201882,0x10610000,0x08201061,0x10820000,0x52690000,0xffffd69a,0xffdfffbe,0xffdfffff,0xb596f77d,0x00004228,0x10a20861,0x00001061,0x08410820,0x7bae0000,0xb575ad34,0xb555ad55,0xb555b576,0xb555b555,0x9cb2b555,
-0x00002945,0x00001082,0xd6ba840f,0xd679d69a,0x9c92dedb,0x18820000,0x000018a2,0xef3c7bcf,0xe73cef7d,0xffdeef5c,0xffdfffde,0xffffffde,0xffffffdf,0xf77dffbe,0xf77dff7e,0xa514f75d,0x10820000,0x31650000,0xce59c5f7,0xbdb7c5f7,0x8c31ad14,0x00001082,0x00001061,0xa51462eb,0xa4d3ad34,0x9cb29cb2,0x94519c92,0x9c929451,0x42088c50,0x08610000,0x00200040,0x10811081,
-0x000018a2,0x630b0000,0xffffc617,0xffdfffff,0xef5dffff,0x10418c10,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000841,0x08610000,0x00000000,0xef3c83ef,0xffbeffdf,0xffdeffff,0x3a07ad75,0x00200000,0x002008a2,0x08000000,
-0x00000861,0x00000000,0x00200000,0x00000000,0x00000000,0x00200000,0x00200000,0x00000040,0x00000841,0x00000020,0x10610820,0x08001041,0x00000020,0x08000820,0x10410800,0x20e33986,0xff7e83cf,0xffbfffbf,0xffdfffbf,0x9451e6db,0x7bcf8c10,0x6b4c6b4d,0x000039a6,0x08000841,0x10000800,0x396520c3,0x39863145,0x00003165,0x08200020,0x18a20000,0x41c741a7,0x52085249,
-0x41e739a6,0x398641c7,0x31864208,0x08000820,0x00000820,0x18a20841,0x00000000,0xc6186b6d,0xfffff79e,0xf7beffff,0xffffffff,0x83efdedb,0x00002924,0x08200820,0x000018a2,0x08610000,0x08201061,0x00000840,0xad3418a2,0xffffffbe,0xffffffbe,0xffffffff,0x83efe73c,0x00000000,0x08401082,0x00000000,0x00400040,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,
-0x08610000,0x00200000,0x08410820,0x188218c3,0x08001882,0x08200841,0x00000000,0x39a618a2,0x39a64208,0x7bcf39a6,0xfffff77d,0xffdfffbe,0xef1cffbe,0x62cb7b8e,0x5aaa62eb,0x31454a28,0x00000000,0x00000841,0x08410820,0x00000020,0x00000000,0x00200000,0x08610000,0x00000000,0x00000000,0x08200000,0x00000000,0x00000800,0x00000000,0x00000861,0x08000020,0x00001061,
-0x5aaa0000,0xf7bead95,0xffbeffff,0xff9effdf,0x41e7bdb6,0x08200800,0x08600040,0x08201881,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x10820800,0x00000861,0x084110a2,0x52490000,0xffdfd659,0xffdfff9e,0xef9dffff,0x000094b2,0x00410000,0x00000821,
-0x08610000,0x10e210c2,0x08c208a2,0x088208a2,0x10c210a2,0x10a210a2,0x002010a2,0x00410000,0x10820841,0x086118a2,0x00001061,0x08410800,0x00200020,0x00000820,0x08001041,0x00000000,0x9c930800,0xffbfffbf,0xde9affdf,0x080049e8,0x00000800,0x00000000,0x10610000,0x00000000,0x10200800,0x00000800,0x00000000,0x00000000,0x00000840,0x00000840,0x08000000,0x08000800,
-0x00000800,0x00000000,0x00000000,0x08200000,0x08610000,0x00000000,0xc61839e7,0xffffffde,0xffffffff,0xffffffff,0xbdb6ffff,0x00003145,0x10410800,0x00001061,0x08610000,0x00004208,0x10a20000,0x08610861,0x00000000,0xef5c736d,0xffdfffff,0xffbeffbe,0xffffffdf,0x6b4ddedb,0x00000000,0x00400861,0x08a20040,0x10e210c2,0x10e310c2,0x10e310e3,0x088110c3,0x10a208a2,
-0x00000040,0x00000840,0x08200841,0x00000000,0x08200000,0x00000820,0x08200841,0x00000000,0x00000000,0x00000000,0xffdf8c30,0xffdfff9e,0x734dffbe,0x08000000,0x00000800,0x00000000,0x08410000,0x10610000,0x00200000,0x08410841,0x10a218a2,0x08200820,0x00000000,0x10a21082,0x18e310a2,0x18a218e3,0x20e320e3,0x210420c3,0x086120e3,0x08610020,0x08410000,0x00000000,
-0xf79dad34,0xffffffff,0xffdfffdf,0xb535ffbf,0x08200000,0x002018a2,0x00000881,0x08000800,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x20621020,0x00000800,0x10820861,0x08200820,0x000018e3,0xffbf836e,0xffbeffdf,0xffffffff,0xd6daffff,0x00008430,0x08200841,
-0x08200800,0x10a20861,0x10a20882,0x10c210a2,0x10a21082,0x000018a2,0x00000000,0x08610000,0x18a20820,0x10821082,0x10410840,0x00001021,0x10a21061,0x18a21081,0x18821061,0x18821061,0x20830000,0xffdfe69a,0x732cff7e,0x20a30800,0x20e31061,0x18c218a2,0x10821082,0x00001061,0x08410000,0x08411041,0x18a218a2,0x10c218c2,0x00201081,0x00200040,0x18621041,0x18a220c3,
-0x20a31882,0x20c320c3,0x18a218c2,0x00001082,0x00000841,0x8c510820,0xffffe71b,0xffffffdf,0xf7feffff,0xffffffff,0x3986f77d,0x20c30800,0x18a20800,0x00000000,0xce79738e,0xad95ef7d,0x00004207,0x08810000,0x00201081,0xce580000,0xffdeffff,0xffdeffff,0xffdfffff,0xf7beffff,0x3986bdd6,0x10610000,0x00000820,0x00000020,0x00000000,0x00000000,0x00000000,0x00200020,
-0x00200020,0x10610840,0x08000000,0x08411061,0x10610820,0x10810000,0x10821061,0x18c21082,0x20e31082,0x18821082,0xc5f70000,0xffffffdf,0x0000b555,0x104118a2,0x20c31882,0x18a220c3,0x108218a2,0x000010a2,0x08610861,0x08610020,0x00200861,0x08611081,0x00000840,0x00000020,0x00000020,0x00000000,0x00000000,0x00000800,0x00000000,0x00200040,0x000010a2,0xc61839e7,
-0xffdeffff,0xfffff7be,0xffffffff,0x838eff9f,0x10820000,0x08810020,0x21030020,0x51a78b6e,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x30a328a3,0x94309c51,0x00000000,0x08200841,0x08001082,0xff9e72ec,0xffdfffdf,0xf7beffff,0xfffff7de,0x632cffff,0x20c30000,
-0x00001021,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001041,0x00001041,0x00000820,0x00000000,0x08200000,0x08410800,0x00000000,0x00000000,0x00000000,0x08400000,0x08001882,0xffbf6aec,0x0800bd96,0x102120a3,0x00001041,0x00000000,0x00000000,0x10610000,0x00000000,0x08200000,0x08200000,0x00000000,0x08610000,0x00400000,0x00000820,0x08000000,
-0x00000000,0x00000000,0x00000000,0x08410000,0x00001082,0xffdf8c71,0xffdfffff,0xfffff79d,0xffffffff,0xffffffff,0x3145ef3c,0x10200800,0x00001021,0xce7962eb,0xffffffff,0xffffffff,0x8c91defb,0x00000020,0x00201081,0xc6170020,0xffdeffff,0xffdfffde,0xffffffff,0xfffff7be,0x62cbff9e,0x18620000,0x29240000,0x4a694207,0x52aa5aca,0x39e74a69,0x10a218a3,0x00000000,
-0x08400000,0x00000000,0x080018c3,0x08200000,0x00000841,0x00000861,0x00000000,0x00000000,0x00000000,0x18a20000,0x42080000,0xe6dbef3c,0x08002904,0x10821061,0x00000000,0x00000000,0x00000000,0x08400000,0x00000020,0x00000861,0x00000000,0x00000000,0x00000841,0x08200020,0x20e30000,0x52693165,0x736d734d,0x73ae736d,0x294462eb,0x00610000,0x21040000,0xffffce59,
-0xffffffdf,0xf7deffff,0xffdfffdf,0x6aabff7e,0x10a20800,0x00001082,0xc6174a69,0x72cbff5d,0x08610800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200020,0x38a338e4,0xffbec555,0x632cd658,0x08610000,0x00001061,0xeedb49c7,0xffdeffdf,0xffffffde,0xffffffff,0x7befffff,0x20820000,
-0x41a60800,0xc5f7c5b6,0xa534b5b6,0x9cd39cd3,0xa4f3a514,0x292483cf,0x10620000,0x4a290000,0xce58d67a,0x73aead75,0x00000000,0x00001041,0x94b25aca,0xad55a513,0x8c51bdb6,0x00000000,0x08000821,0x94511041,0x000041c7,0x00001882,0x31450800,0x4a2841e7,0x4a494a28,0x00002103,0x00201081,0x08410020,0x7bcf6b0c,0x8c917bef,0x00005aca,0x00400861,0x20c30000,0x945183cf,
-0x7bce8c30,0x738e736d,0x840f8c50,0x080039c6,0x000010a2,0xffde9cd2,0xf79effde,0xffffffff,0xffffffff,0xffffffbe,0x18c2dedb,0x18820000,0x9cb20000,0xffffff9e,0xfffff7be,0xf7deffff,0xffffffff,0x4a28d699,0x18c20000,0xc5d70000,0xffdfffff,0xc5d7ff9e,0xef5db575,0xffdfffbf,0x5249f75d,0x10410000,0xc6170840,0xef5cf79e,0xf79df7be,0xef5cef5d,0xad34ef5d,0x10a20000,
-0x00200861,0xbdb618e3,0xef1cef3c,0x0000acf4,0x08611061,0x630c0840,0xce58c618,0xbdf7bdf7,0x738ead54,0x08201061,0x000018a2,0x5acb62eb,0x08200000,0x00001082,0xa5145289,0x9491a4f3,0xad549cf3,0x0000738e,0x10810861,0x9cd20000,0xd6baef3c,0x8c71e71b,0x10820000,0x08410020,0xef5cbdd7,0xef7de6fb,0xf7beffdf,0xffdff7be,0xbdd6f79e,0x10c20000,0x29240000,0xffffef3c,
-0xc617ef5d,0xe71bb5b6,0xffdfffff,0x51e8ff7e,0x10a20000,0x4a890000,0xffffe73c,0x830cff5d,0x10820800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10200000,0x384240a3,0xffbecd55,0xdefafffe,0x00002944,0x08001082,0xe69a3125,0xffdeffdf,0x9c92e6db,0xef5dad14,0x7bcfffff,0x28c30800,
-0x5a281000,0xffffff7e,0xffffffff,0xffffffff,0xffffffff,0x0000c618,0x18a30841,0xad550000,0xffffffff,0xad55ffde,0x18a20000,0x4a280800,0xffffef5c,0xffffffff,0xffdeffbe,0x00007bef,0x08211062,0x00000820,0x10410800,0x10410820,0xe6fbad13,0xef3ce6db,0xef5def5d,0x2965ce58,0x08610000,0x00000881,0xffffbd96,0xffffffff,0x3185e6fb,0x10a20000,0x18a20000,0xffdfdeba,
-0xffffffff,0xffbeffff,0xffffffff,0x00008c30,0x00002103,0xffff9cb2,0xffffffde,0xbd95eefb,0xff9dce38,0xffffffff,0x0000dedb,0x00000841,0xf75d3986,0xffdfffdf,0xffffffff,0xffffffdf,0xffdeffde,0x840fffff,0x20e30000,0xad340800,0xd658ffbe,0x00007bae,0x5aaa0000,0xff9eb535,0x3986ef3c,0x00000800,0xf77d39c6,0xffdfffff,0xffffffff,0xffffffff,0x6b4df79e,0x10620000,
-0x00001081,0xffff9cf3,0xffffffdf,0x00009c92,0x000018c3,0xd6ba18e3,0xffffffdf,0xffffffff,0xffffffff,0x00009cd3,0x10820841,0x00000000,0x10821061,0x4a480000,0xffffe73c,0xffffffff,0xffffffff,0x4228f77d,0x18e30000,0x7bcf0000,0xffffffff,0xef7dffff,0x00005acb,0x00001082,0xffffad75,0xffffffff,0xffffffde,0xffdfffff,0xce38ffff,0x10a20000,0x31450000,0xa514bdb6,
-0x000041e7,0x39e70000,0xd6398c31,0x28e4de7a,0x18e30000,0x632c0000,0xfffff7de,0x834dff5d,0x10a20800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18610000,0x382148c4,0xffbecd34,0xf79dffbd,0x00004207,0x08201081,0xde790800,0x9451f71c,0x080020c3,0x4a080800,0x7baebd96,0x18620000,
-0x49a70800,0xffdff71c,0xffffffdf,0xffffffff,0xf79dffff,0x0000736d,0x000020e3,0xef3c39c7,0xffdfffdf,0x39c6ef5c,0x18a20000,0xad140800,0xffbeffff,0xf7beffdf,0xffffffff,0x0000deda,0x08410000,0x10820840,0x18a20861,0x7bae0000,0xffffffdf,0xffffffff,0xffdfffff,0x94b2ffff,0x10a20000,0x00000881,0xff7e628a,0xf7beffdf,0xa4d3ffff,0x18a20000,0x08001061,0xffbf838e,
-0xffdeffff,0xffffffff,0xffffffde,0x00009cb2,0x000020e3,0xffbe8c10,0xa4b2e6da,0x08003986,0x732c1841,0xf77dc5b6,0x0800bd96,0x00001082,0xef7d528a,0xffffffff,0xffffffff,0xffdfffff,0xfffffffe,0x8430ffde,0x18c20000,0x62cb0000,0x08207bae,0x08200000,0x000018a2,0x6b2d0000,0x08418c51,0x00001041,0xef5c528a,0xffdeffff,0xffffffde,0xffffffbe,0x0000b575,0x18a21082,
-0x5aeb0000,0xffffef7d,0xce18ffdf,0x08000000,0x00001082,0xffdf8c71,0xffffffff,0xffffffdf,0xffdfffde,0x630cffbe,0x10820000,0x10811061,0x00200820,0xce580000,0xf7deffff,0xffffffff,0xffdeffdf,0xa4f3ffdf,0x18c30000,0x00000000,0xffffd6ba,0xffdeffde,0x0000bdd7,0x000020e3,0xef5d528a,0xffdfffff,0xffffffff,0xffdff7de,0xce38ffdf,0x10820000,0x10410800,0x00001082,
-0x10820000,0x000018c3,0x18a30000,0x00003145,0x10a20020,0x5aca0020,0xffdeffde,0x834dff7d,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18400000,0x48833862,0xff9dccf4,0xef5cfffe,0x000041e7,0x00001082,0x7b8e0820,0x080049e7,0x20c20000,0x00001882,0x10410000,0x10410820,
-0x49871000,0xffffeefb,0xffffffdf,0xf7beffff,0xb5b6ffff,0x08610000,0x000018a2,0xffffad34,0xffffffde,0x00009cf3,0x000018e3,0xeefc4a08,0xffffffdf,0xffffffdf,0xffdef7be,0x8c51ffff,0x10a20000,0x00000020,0x00000840,0xe6db3986,0xffbeffff,0xfffff7be,0xffdeffff,0xef5cffff,0x000039a6,0x108110a2,0xc5960800,0xffdeffff,0xe6dbffff,0x080039a6,0x10411061,0xd6391021,
-0xffffffdf,0xfffffffe,0xfffff7de,0x00009cd2,0x000020e3,0x8c105a69,0x00003124,0x10610000,0x08000800,0x5a690000,0x00005269,0x00001882,0xffde6b6d,0xffffffff,0xffffffff,0xffdfffdf,0xffffffdf,0x7befffff,0x18c20000,0x00000820,0x00000000,0x106118a2,0x18c318a2,0x000018a2,0x00000000,0x00001082,0xef5c4a28,0xffdeffff,0xffbeffff,0xdebaffff,0x00002945,0x000018a2,
-0xce992144,0xffdeffff,0x7baef77d,0x18a20800,0x31860000,0xffffe71c,0xffdeffff,0xffffffff,0xffffffff,0xce58ffff,0x08410000,0x00000841,0x000010a2,0xffff8c51,0xffffffdf,0xffffffff,0xffffffff,0xe6fbffff,0x00003165,0x000018c3,0xffffa513,0xffdfffdf,0x73aef79e,0x18c30000,0xb5960000,0xffdfffde,0xffffffff,0xffffffff,0xd659ffff,0x08410000,0x08200841,0x10a20000,
-0x188218a2,0x08400000,0x08002104,0x08200000,0x08610020,0x5aca0000,0xffffef7d,0x730cff7d,0x10a20000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x10200020,0x40623882,0xffdecd14,0xf75cfffe,0x00004208,0x00000861,0x00000840,0x20c30000,0x18a218a2,0x08810841,0x00201082,0x18410800,
-0x51c81000,0xffdff75d,0xffffffbe,0xffdfffdf,0x4208f75d,0x18e30000,0x62eb0000,0xffbeffbe,0xe71bffff,0x000031c6,0x00001903,0xffdfa4b3,0xffdfffbf,0xffdfffdf,0xf7dfffff,0xef5dffff,0x00004a69,0x08400861,0x00001082,0xffffa4d3,0xffffffbe,0xf7ffffff,0xffffffff,0xfffffffe,0x0000a513,0x10a21081,0x736d0000,0xfffff7be,0xffffffdf,0x0800acf4,0x18821882,0x62eb0000,
-0xffdeef3c,0xffdefffe,0xffffffde,0x0000ad13,0x106118c2,0x00000000,0x18c30000,0x106118e3,0x18a218a2,0x00001081,0x10610000,0x00001082,0xffdf7bae,0xffffffff,0xffffffdf,0xffdfffff,0xffffffbe,0x6b4cf7be,0x18a20000,0x08610000,0x18a21082,0x00001081,0x08000000,0x18a21881,0x00201081,0x00001082,0xf7be4a49,0xffdfffdf,0xffffffbf,0x738effbf,0x18c30000,0x00201082,
-0xffffa554,0xfffff7bd,0x28e3ef1c,0x18a20800,0x94710800,0xffffffff,0xfffff7de,0xffffffff,0xffffffdf,0xf77effdf,0x00006b4d,0x08611081,0x39c60000,0xffffe73c,0xffffffdf,0xffffffff,0xffffffff,0xffdfffdf,0x00008c31,0x000018c2,0xffff632c,0xf7beffff,0xdedaffff,0x08201081,0x31a60000,0xffdeef1c,0xffdeffdf,0xffbfffdf,0xce18ffdf,0x10620000,0x08410020,0x10a20841,
-0x00000000,0x10a21081,0x00000000,0x102020c3,0x10810820,0x52890000,0xffdef79d,0x6acbff5d,0x10a20000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0x30413061,0xff9dcd54,0xff9effde,0x00005aaa,0x002010a2,0x18a20000,0x000020e3,0x00000000,0x10a20881,0x00200882,0x10210800,
-0x41661000,0xffffdedb,0xff9effdf,0xffffffbe,0x0000a4d3,0x084018c3,0xc5f70840,0xffdeffbe,0xbdf7ffff,0x18e30000,0x00000881,0xff7e7b6e,0xffbfffdf,0xffdfffdf,0xffffffff,0xfffff7be,0x0020a514,0x00200861,0x000018a2,0xff9e9431,0xffdeffbe,0xffffffff,0xfffff7ff,0xffffffff,0x2103e71b,0x18a20800,0x84300000,0xf7dfffff,0xfffff7df,0x4a08ef3d,0x10820000,0x000010a2,
-0xffdea4d3,0xffdeffdf,0xffffffff,0x0000ad14,0x082018a2,0x18c30841,0x000018a2,0x00200000,0x00000000,0x18a218c2,0x000010a2,0x00000841,0xb5553145,0xffdff77e,0xffbfffff,0xffdfff9f,0xffffffff,0x2945bdb6,0x08210000,0x08610000,0x00001082,0x5aaa0000,0x630b9491,0x00000000,0x000010a2,0x00000861,0xbdd72104,0xffffffdf,0xffffffdf,0x0820bdb7,0x10a21062,0x6b8e0000,
-0xf7ffefbe,0xf7bdf7fe,0x83cfffbe,0x20e30000,0xa4f30000,0xf7deffff,0xffdfffff,0xffdfffff,0xffbeffdf,0xe71cffff,0x08204208,0x10610841,0x42070000,0xffffe71b,0xffdfffff,0xffffffff,0xffbfffff,0xffdfffff,0x000083f0,0x000018c3,0xffde738d,0xffffffff,0xffdef7be,0x00009471,0x00002103,0xffff9471,0xffdfffdf,0xffbeffff,0x6b0cce39,0x08410000,0x08410000,0x00000861,
-0x949118a2,0xce58d699,0x21248c70,0x08000000,0x10810000,0x31850000,0xffffc617,0x62aaff7d,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200020,0x20401820,0xffdebd34,0xef1cffff,0x00004a49,0x00000861,0x08001061,0x5aaa0000,0x52899cb2,0x00000020,0x10820020,0x08000000,
-0x08001041,0xbdb641e7,0xffdfffbe,0xdedbffff,0x08402124,0x000018c2,0xff7d732c,0xffdeffff,0xe6fbffff,0x000020e3,0x10611082,0xd5f81842,0xffbfffbf,0xffdfffff,0xffbeffdf,0xe71cffff,0x000052aa,0x00001082,0x10410820,0xce181020,0xffbeffff,0xffdfffff,0xffffffff,0xfffff79e,0x0000ce38,0x10411021,0xce181841,0xf7beffff,0xf7deffff,0xb595ffff,0x10820000,0x08400861,
-0xd5d72061,0xffdfffdf,0xc5d7ff5d,0x00005aaa,0x08401061,0x00001081,0x31850000,0xb595ad75,0x08a16b6d,0x00200020,0x00200020,0x08410000,0x00000000,0xad1441e8,0xffbfe6db,0xffdfffdf,0x83aede9a,0x08000800,0x00000820,0x00000820,0x4a490000,0xef7cad75,0xef9dffff,0x10c2ad75,0x10a20000,0x08610000,0x08610000,0xd6797bae,0xe71cffff,0x00004208,0x00001082,0xe75c4a49,
-0xf7deffff,0xffffffff,0xbdb6ffdf,0x18a20000,0x42080000,0xfffff79d,0xfffff7be,0xffdff7be,0xffbeffdf,0x9471ffff,0x10610000,0x08200020,0x000010a2,0xffbe9cd2,0xffdfffbf,0xffffffff,0xffdfffdf,0xce18ffff,0x08201862,0x000018a2,0xffffb596,0xfffff7bd,0xffffffff,0x2944deba,0x08400000,0xd6791061,0xffdfffdf,0x83efe6fc,0x08000800,0x00000841,0x00000861,0x632c0000,
-0xffffd69a,0xffffffff,0xdedaffff,0x20c38c30,0x00200020,0x00200861,0x84300861,0x49e7c5d6,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x10001061,0xeefba471,0x4a49ad14,0x10820000,0x10610020,0x31450000,0xef5cb575,0xef7dffde,0x6b6dbdd6,0x00000020,0x00001082,
-0x10410800,0x08410000,0xce387bae,0x8c71ffbf,0x10a20020,0x08000841,0xffdfce18,0xffbeffbe,0xffbeffde,0x08009471,0x10611082,0x6acb0800,0xffdfff9e,0xffdfff7e,0xffdfffdf,0x7baeffdf,0x10a20000,0x08410841,0x18820000,0x62cb0800,0xffbff73d,0xffdfffff,0xffdfffdf,0xff9effdf,0x0800738d,0x080020c3,0xff9e6aab,0xffdeffdf,0xffffffff,0xffffffff,0x00007bce,0x106118e3,
-0x6a8a0800,0xc576de39,0x08206aeb,0x08610000,0x08200000,0x42070000,0xe6fbad75,0xffffffff,0xd6baf7be,0x632bad95,0x00000000,0x00000820,0x10820841,0x08000000,0x9c923145,0x83afb575,0x08001041,0x10411041,0x08200000,0x21240020,0xef9dad55,0xfffeffff,0xffffffff,0xd699ffff,0x0000630c,0x00001081,0x00200840,0x00000000,0x736d8c30,0x10820000,0x00001082,0xffffbdf7,
-0xffdeffdf,0xffffffbf,0xf75dffff,0x000062cb,0x004010a2,0xffdfa514,0xffffffdf,0xffdfff9e,0xffffffbe,0x0841ce59,0x10610820,0x00200020,0x00200840,0xe73c2103,0xffdfffff,0xffdfffbf,0xffbfffff,0x62ecf77d,0x18820000,0x21040000,0xffffe6fb,0xffffffde,0xffffffbe,0xad14ffff,0x18c20000,0x630b0000,0xa514ce38,0x000041e7,0x10820820,0x10620000,0x39e70000,0xf7bec638,
-0xf7deffff,0xfffff7de,0xfffff7be,0x9cb2ffde,0x08610000,0x08410000,0x00200000,0x00000000,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000040,0x52494a08,0x00000000,0x00000841,0x08200840,0xeedb62aa,0xffffffbe,0xffffffde,0xf79dffdf,0x4a89c638,0x10620000,
-0x08200820,0x08400861,0x10610020,0x31a683ef,0x18e30000,0x7bae0000,0xffdfffdf,0xffffffff,0xffdfffdf,0x1081e6ba,0x10820020,0x08000841,0xffbfbd55,0xffdfff9e,0xff9ef75d,0x0000bdb6,0x10811081,0x00000000,0x00001061,0x00001882,0xffdf9c92,0xffdfffbf,0xff9effdf,0xce59ffff,0x00000881,0x080020c2,0xffbfa4b3,0xffdfffbe,0xf7deffde,0xffdff7be,0x39c6e71b,0x10820000,
-0x08000820,0x08001821,0x08610820,0x00000861,0x00000841,0xef3c83ef,0xffffffff,0xffdeffbe,0xfffffffe,0xf77dffff,0x0000736d,0x00001082,0x10820820,0x18c21081,0x00000000,0x00000020,0x10810000,0x00001061,0x00000861,0xbdf70861,0xffffffff,0xffffffde,0xffffffff,0xfffff7be,0x0000d679,0x10610820,0x10820000,0x002010a2,0x08200000,0x18a20841,0x6b4c0000,0xffffffbe,
-0xffbfffbe,0xffbfffdf,0xffffffdf,0x0000bdd7,0x000018c2,0xf75d4208,0xffdfffff,0xffdfffdf,0xffbeffdf,0x00006b4d,0x082110a2,0x10821082,0x10810020,0x7bef0000,0xffffffdf,0xffffffdf,0xffffffff,0x0000b596,0x18a21061,0x8c510000,0xffffffdf,0xffffffde,0xf79dffff,0xe6fbffff,0x08203966,0x000010a2,0x00000821,0x18820000,0x00001082,0x10820000,0x94710000,0xffffffff,
-0xffdfffff,0xffffffff,0xffbeffff,0xbd76ffdf,0x10620800,0x00000000,0x10811082,0x08001041,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08800000,0x00000800,0x108318a3,0x00200020,0x080010a2,0xffdf9410,0xffdeffbe,0xffffffde,0xffbeffde,0x9cf3ffff,0x10a20000,
-0x08400000,0x08410020,0x002018c2,0x00000000,0x00001082,0xeefc41c7,0xff9effdf,0xef3cffde,0xd638e69a,0x4207cdf7,0x08610000,0x00000820,0x72ec3966,0x734d734d,0x62cb6b0c,0x00203185,0x000010a2,0x18a22945,0x08410000,0x08200820,0xbd761041,0xf6fcf6dc,0xff7df6fc,0x83cff75d,0x18e20000,0x10410000,0xffdfde7a,0xffdfff9e,0xffffffff,0xffdfffff,0xbdb6ffdf,0x08200800,
-0x10820840,0x18820800,0x10a218c2,0x08610840,0x41c70000,0xffffef1b,0xf7fef7de,0xffffffff,0xf7bdffff,0xffffffbe,0x00008c10,0x082018a2,0x00000000,0x10a20000,0x10a210a2,0x10a11081,0x106118a2,0x08400000,0x00000861,0xd6992124,0xf7beffff,0xffdeffff,0xffdeffdf,0xffdfffdf,0x2924d679,0x08400000,0x08410000,0x18c21082,0x106118e3,0x00001061,0xef5c41e7,0xffbeffff,
-0xffdfffbf,0xf77ef73d,0xdedbe6fc,0x0000b596,0x10a20861,0x8c510000,0xde7ae6bb,0xd618e67a,0x9471c5f7,0x08200000,0x10620821,0x00000000,0x084010a2,0x00000840,0xa5347bef,0x9cd3a514,0x9471a514,0x000039c7,0x08201061,0x5aaa0000,0x84108c51,0xc61883ef,0xffdeffde,0xffffffdf,0x0000ad34,0x108110a2,0x18820820,0x20a31041,0x08410861,0x10610820,0xad340800,0xffffffde,
-0xffffffdf,0xf7beffff,0xffdfffff,0xb514ffdf,0x08610000,0x08201061,0x00000000,0x10201861,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00200040,0x20a31040,0x00000821,0x00000020,0x080010a2,0xffdf9c10,0xffdeffdf,0xffdeffff,0xffdfffdf,0xa575ffdf,0x10a20000,
-0x00000841,0x10610020,0x086110a2,0x10411882,0x00001082,0xffdfbdb6,0xffffffbe,0x5acade9a,0x08201061,0x08400000,0x00000000,0x08410000,0x00000000,0x00000000,0x00000000,0x18a20000,0x21030000,0xbdb6d699,0x10610000,0x08200861,0x18410800,0x392528a3,0x5a4a4166,0x00005a6a,0x08200000,0x10200800,0x8bcf6aec,0x9c7283af,0xf79dad55,0xffbeffbe,0xffbeffff,0x00009cb2,
-0x00201081,0x004018c2,0x00000000,0x10610840,0x5a8a0000,0xffffef5c,0xffffffdf,0xfffeffff,0xffffffde,0xffbeffff,0x0000738d,0x000018a2,0x5aca2103,0x00003165,0x18a20000,0x108110a2,0x08200000,0x08003145,0x00000840,0xce580000,0xffffffdf,0xffffffff,0xf7beffff,0xffffffdf,0x20e3de9a,0x10610000,0x00000820,0x00000020,0x08400020,0x000018c3,0xffdf9491,0xffdfffbe,
-0xc5b7ffdf,0x4a085249,0x084139a7,0x08400000,0x00200000,0x00000020,0x18621041,0x08001861,0x00000000,0x08200820,0x00001082,0x8c719cd3,0x10820000,0x08610820,0x00000000,0x00000000,0x00000000,0x08400000,0x00000000,0x00000841,0x00000000,0x08410000,0xffffd659,0xffbeff9e,0x0000c5f7,0x00201082,0x18821061,0x00000800,0x00000000,0x10a20020,0xa5140000,0xfffeffff,
-0xffffffff,0xffffffff,0xffbeffdf,0xad14ffdf,0x10820000,0x00000020,0x18c30881,0x08000000,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000000,0x08001000,0x29451061,0x08610000,0x00001082,0xffbfa431,0xffffffbe,0xffdefffe,0xffbeffdf,0xad95ffff,0x10820000,
-0x08610020,0x00000000,0x10610000,0x08201041,0x00000882,0xffdfce18,0xd69affff,0x000039c6,0x08611061,0x082010a2,0x10611061,0x00000000,0x10a20881,0x18e31082,0x210318e2,0x000020c2,0xad540000,0xffbeffff,0x00008c30,0x086118c2,0x10211041,0x08000800,0x08001000,0x00200000,0x00000020,0x08000820,0x08000800,0x08000800,0xc5d70000,0xffbeffff,0xffffffbe,0x0000bd96,
-0x08811081,0x00000000,0x8c10736d,0x10610800,0x5a8a0800,0xffdef77d,0xffffffff,0xffffffff,0xffffffff,0xf7beffde,0x00007bce,0x000018c3,0xef5c5aaa,0x9491deda,0x00002103,0x00000000,0xbd9562ca,0x4a28de9a,0x18c20000,0xb5750000,0xf7beffff,0xffffffff,0xffffffff,0xffffffdf,0x0820d679,0x10810000,0x9d130000,0x73aead54,0x00000841,0x00001061,0xe71c39c7,0xffdfffdf,
-0x41c7ef1c,0x00000000,0x08200800,0x08610861,0x08400841,0x10610840,0x08000800,0x10201000,0x10611061,0x18c30820,0x7baf0000,0xffdfffbf,0x00007bef,0x082018c2,0x10a210a2,0x108218a2,0x18a21081,0x00000841,0x08410841,0x10820820,0x106118c3,0x00002104,0xef3c4a28,0xf77dffff,0x0000630c,0x08201082,0x00000841,0x7bae0000,0x4207ad55,0x10a20000,0xb5750000,0xffffffff,
-0xffffffff,0xfffff7be,0xffdfffde,0xb535ffdf,0x10820000,0x00001082,0xd6997bef,0x104083ce,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x18001000,0x94304185,0xad75e6fb,0x08610000,0x08001082,0xff5d8b8e,0xffdeffdf,0xffdeffde,0xffbeff9e,0xb5d6ffff,0x10810000,
-0x00000881,0xc5b79c92,0x00005aab,0x08410000,0x000010a2,0xff7e62cb,0x5aaaff9e,0x18e30000,0x00200861,0x00000000,0x00000000,0x00200840,0x00200020,0x00000000,0x00000000,0x39a60000,0xffdfad54,0xffdfffdf,0x31a6ef5c,0x00200000,0x18820020,0x184120c3,0x10611841,0x002018a2,0x10c20060,0x10a210a2,0x18c218e3,0x20c318a2,0x20a20800,0xffdfd659,0xd618ffdf,0x08001841,
-0x000018a1,0xde79736d,0xef1bffbe,0x102028c2,0x6aeb0800,0xffdfff7d,0xffdfffff,0xffffffff,0xffffffff,0xffbeffde,0x00007bae,0x000018c2,0xffde7bae,0xffffffff,0x9491deba,0xc6179491,0xffdff79d,0x6b4cffdf,0x20e30000,0xa5130000,0xffdeffff,0xffffffdf,0xffbeffdf,0xffffffbe,0x0000c5d7,0x000020c2,0xdf1b18c2,0xfffeffff,0x00008c50,0x18c21082,0x8c300000,0xffdfffff,
-0x08009451,0x18c218a2,0x00001882,0x00000000,0x00000000,0x08201061,0x10201041,0x08201040,0x18a21061,0x000018c3,0xe6fc3165,0xffffffff,0x52aaef5c,0x18c20000,0x18a218c3,0x00000821,0x00200020,0x08400000,0x08610861,0x08410020,0x10820020,0x18c30861,0x84100000,0x9cb2ffbe,0x10610000,0x10620841,0x7bcf0000,0xffffd6ba,0x4a28ef5d,0x10a20000,0xb5b50020,0xffdeffff,
-0xffffffde,0xffdeffff,0xf79effde,0xacf3ffdf,0x10a20000,0x00001082,0xffffad75,0x5228f75c,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000040,0x30612861,0xffbda430,0xd6b9ffff,0x00002944,0x08001082,0x93f028a2,0xffffeefb,0xf7beffff,0xffdfffff,0xad95ffde,0x10820000,
-0x000010a2,0xffbfacd3,0xb555ff9e,0x00201062,0x10820061,0x9c720800,0x00009451,0x082018a2,0x10610000,0x29653185,0x296539e7,0x08410000,0x00000020,0x6aec1862,0xad748c71,0xe6fbce38,0xffffffff,0xffbeffbe,0xc618ffff,0x29653a07,0x00000000,0x08000000,0x00001020,0x08610000,0x00000000,0x00000000,0x00200000,0x08200841,0x08001882,0xeefb5208,0x49c7e6ba,0x20a20800,
-0x62ea0800,0xfffef73b,0xef3bffde,0x08003945,0x31450800,0xf75dad14,0xffffffdf,0xffdfffdf,0xffffffff,0xe6fbffdf,0x00005269,0x000020c3,0xffde8c30,0xffdeffbe,0xffffffff,0xffffffff,0xffdeffde,0x83efffff,0x18c20000,0x62eb0000,0xffdfe71c,0xffdfffdf,0xffdfffdf,0xd639ffff,0x00005a8a,0x00001081,0xef5c5289,0xfffeffff,0x31a6e73c,0x10610820,0x00000000,0xc5d7bdd7,
-0x08200000,0x00001081,0x10610820,0x29442103,0x29243185,0x08400000,0x00000000,0x08600000,0x00000000,0x00000000,0xffdfc638,0xffdff7be,0xd6baffff,0x00004a69,0x00000000,0x00000820,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x08410000,0x10820000,0x08615aca,0x08410000,0x000018c3,0xffdf83ef,0xffdfffff,0x18a2ce38,0x10a20820,0x5aeb0000,0xffffe71b,
-0xffdeffff,0xffffffbe,0xffffffde,0x5a69e69a,0x08610000,0x00001082,0xffffbdd6,0x732cff7d,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400020,0x406140c3,0xff9dac50,0xef7cffde,0x000039c6,0x08201081,0x08000800,0xb5b64a08,0xfffff7be,0xef1cffff,0x39c6ad75,0x10610000,
-0x000018c3,0xffbfacf4,0xffffff9e,0x00009492,0x086110a2,0x00000000,0x10610000,0x000018a2,0xd65983af,0xdefbdeba,0xc658e75c,0x00000861,0x000010a2,0xf6bb2862,0xffffffff,0xffffffde,0xfffff7be,0xffdff7be,0xffffffff,0xdf1be75c,0xa534c617,0x41a79c92,0x08200800,0x00000841,0x83cf3145,0x6b4d736d,0x42076b2c,0x10210000,0x18820800,0x62eb0800,0x00005289,0x08201081,
-0xcdf71841,0xffddfffe,0xef1affde,0x08003985,0x00001881,0x7b8e0000,0xffbfd639,0xffdfffff,0xeefcffdf,0x5269b555,0x10400000,0x000020c3,0xffff8c30,0xffffffde,0xffffffff,0xfffff7de,0xf7deffff,0x8c71ffff,0x19030000,0x00000840,0xbdb64a08,0xffdfffbf,0xff5dffbf,0x1842acf4,0x10610800,0x000018a2,0xf7be738d,0xfffff7be,0xad55ffff,0x10820000,0x00001061,0x29442904,
-0x18c20000,0x632c0000,0xce79ad75,0xdebadeba,0xd699e6fb,0x0000734c,0x00201081,0x00000840,0x843039e7,0xc638a514,0xffffffff,0xffffffff,0xffffffdf,0xb595e6fb,0x83efa4f3,0x000020e3,0x00200820,0x00201082,0xc6388c91,0xc617bdf7,0xad55c617,0x000039c6,0x00001061,0x00000820,0x10a20840,0x4a280000,0xffffef7d,0xfffff7de,0x0820deba,0x18e30000,0x00201081,0xad5439a6,
-0xfffff77d,0xffdfffff,0x9c91e6fb,0x100028e3,0x08201041,0x00001081,0xffdfc5f7,0x836dff7d,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000060,0x40615104,0xffbdb450,0xfffeffbd,0x00205aeb,0x082018e3,0x18620800,0x08200000,0xc5f7630c,0x4208a4f3,0x00000000,0x102120a3,
-0x736d0000,0xffdfeefc,0xffffffbf,0x4a69ef3c,0x10820000,0x08610841,0x10610841,0x52290000,0xffdfeefc,0xffffffff,0xffffffff,0x00008430,0x10411082,0xd5771800,0xffdeffdf,0xffbeffff,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x4a28f77d,0x10610000,0x00001082,0xffdfb535,0xffbeff9e,0xf79df7be,0x00009492,0x080018a2,0x00001061,0x10810000,0x000018a2,
-0xffffa4d2,0xffdefffe,0xffdefffe,0x000083ee,0x08402103,0x00001081,0x9c511841,0xef1cef1d,0x39a6acf4,0x08000000,0x18820820,0x000018a2,0xfffe9cb2,0xffffffff,0xffffffff,0xffffffff,0xf7deffff,0xc638ffff,0x00000000,0x106118a2,0x08000000,0xd6596b0c,0x6aecd639,0x08000800,0x08201061,0x002020e3,0xffff8c71,0xffdeffff,0xf7beffde,0x00006b4d,0x10411082,0x00000000,
-0x00001061,0xe71b39e7,0xffffffff,0xffffffff,0xffffffff,0x2903de99,0x08400020,0x000010a1,0xffff9cf3,0xffffffff,0xf7beffff,0xffffffff,0xffdeffff,0xffffffff,0xf79effdf,0x00004208,0x10a21061,0x632c0000,0xfffff7be,0xffffffff,0xffffffdf,0x0000bdb6,0x08611061,0x08611081,0x00200861,0xd69a2103,0xffdfffff,0xffdeffff,0xb575ffbe,0x00002945,0x18c20000,0x00000000,
-0xa5144208,0x8c30c5d7,0x00003144,0x10200800,0x10a20820,0x00000000,0xffdfde99,0x7b2cff3c,0x10820000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x40625124,0xff9db451,0xfffffffe,0x3165ce79,0x10820000,0x080018a2,0x08411082,0x00000000,0x00000020,0x10821081,0x10210000,
-0xf77dacf4,0xffffffdf,0xffdfffdf,0xbdf7ffff,0x08410000,0x00200020,0x08200861,0xcdd70800,0xffbeffdf,0xffbeffff,0xffffffdf,0x0841d679,0x20a30000,0xa4521000,0xffdfffbe,0xffffffbe,0xffffffff,0xffffffdf,0xffffffff,0xffffffff,0xfffff7de,0x0000ad74,0x18a218a2,0x83ae0000,0xffdfffbe,0xffdfffdf,0xffffffff,0x6b2df77d,0x18c30000,0x10a20000,0x18a20840,0x734d0800,
-0xffdef79d,0xffffffff,0xfffff7fe,0x632bef7c,0x18c20000,0x18821061,0x08000800,0x314549c7,0x00000000,0x10a218c2,0x000018c2,0x6b2c0000,0xffdfe6fb,0xffffffff,0xffffffff,0xffdfffff,0xffffffdf,0xffffffff,0x39a6ce59,0x18a20820,0x10611061,0x00000000,0x00000000,0x10621061,0x084118c2,0x630c0000,0xffffe73c,0xffdfffff,0xffbeffde,0x2924dedb,0x10610000,0x10610841,
-0x000018c2,0xffffa534,0xf7def7de,0xffffffff,0xfffefffe,0xa4d2ffde,0x10810000,0x000018a2,0xef7d62eb,0xffffffdf,0xffffffdf,0xffffffff,0xffdfffdf,0xffffffff,0xb595ffff,0x10610000,0x000010a2,0xd6ba31a6,0xf7deffff,0xffdeffff,0xffbeffff,0x738effbe,0x10820000,0x08200020,0x00200020,0xffffbdd6,0xffffffff,0xffffffde,0xffffffdf,0x9471e71c,0x00000820,0x10610841,
-0x00000000,0x00000000,0x10810000,0x18821061,0x000010c2,0x94d20000,0xffbef79d,0x9410ff9d,0x10a20000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18610820,0x514540c3,0xff9eddb6,0xffdeffde,0xd69affff,0x00007bce,0x08200000,0x08410000,0x082010a2,0x108110a2,0x000010a2,0xce185a6a,
-0xffdfffbe,0xffffffbe,0xffdfffdf,0xffdfffff,0x00008c31,0x004110c2,0x000010a2,0xffbf93f0,0xffdeffdf,0xffdfffdf,0xffffffdf,0x736dffdf,0x18820000,0x730c0800,0xffbef6fc,0xf7beffff,0xffffffdf,0xffffffff,0xffffffff,0xf7beffff,0xef9dffff,0x00005b0b,0x00001082,0xef1c4186,0xf79effff,0xf7dfffff,0xf7bef7df,0xdebbffff,0x00002945,0x00001082,0x00000861,0xe69a3945,
-0xf7dfffff,0xffffffff,0xf7feffff,0xe75cffff,0x002073ce,0x10610000,0x10611041,0x00000800,0x086110a2,0x00000020,0x39e70000,0xf79dad54,0xffffffff,0xffffffff,0xffbeffff,0xffffffff,0xffffffff,0xffbeffff,0xd699ffff,0x00204a48,0x08200861,0x084010a2,0x10820861,0x00000881,0x00000000,0xef5c94b2,0xffdeffff,0xffffffff,0xffbeffff,0xbd96ffff,0x10610000,0x10610820,
-0x52890000,0xffffef5c,0xffffffff,0xffffffff,0xffdeffff,0xf75dffff,0x00005289,0x00001082,0xce580000,0xf7beffff,0xffffffff,0xffffffff,0xffdfffff,0xffdfffff,0x736dffdf,0x18a20000,0x00001061,0xffffb5b6,0xfffff7be,0xffffffff,0xffbeffdf,0xdebaffff,0x00003145,0x10821061,0x8c710000,0xfffffffe,0xffffffff,0xffffffff,0xffdeffff,0xffffffff,0x738ece59,0x08401061,
-0x086110a2,0x10a20861,0x08400861,0x00000000,0x52eb0000,0xffffc679,0xffffffde,0x93f0ff9e,0x08610000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18200000,0x280038c3,0xffbfbcb3,0xf7dfffbe,0xffffffdf,0xa534ffff,0x08414a49,0x00001082,0x08410000,0x10820040,0x52490000,0xffdff71c,
-0xffdfffdf,0xffdfffdf,0xffdfffff,0xffffffff,0x5aebef5d,0x08a20000,0x08000861,0xff7e836e,0xffdfffdf,0xffffffff,0xf7dfffff,0xbdb6ffff,0x20a30000,0x20820800,0x941049a7,0xfffff79d,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xef7dffdf,0x000031a5,0x080018c2,0xff7d72eb,0xffffffbe,0xffffffff,0xffffffff,0xffffffdf,0x0020bdd7,0x00400000,0x080010a2,0xffbfa471,
-0xffdfffbf,0xffdfffdf,0xffffffdf,0xffffffde,0xa4d2ff9e,0x000020e3,0x08201061,0x10611061,0x00200841,0x52aa0861,0xe73ca4f3,0xffdeffff,0xfffff7be,0xffdeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffff7be,0x83eff79d,0x00000020,0x00000861,0x08410020,0x18c30000,0xc638632c,0xffffffde,0xffdfffff,0xffdeffff,0xffffffdf,0xe71cffdf,0x00004208,0x00001082,
-0xce3818a2,0xfffeffff,0xffffffff,0xffffffff,0xffbeffff,0xffffffde,0x0000b575,0x08411082,0xc6170000,0xffffffff,0xffffffff,0xffffffff,0xffffffbf,0xffdeffdf,0x00009cd3,0x10821082,0x94920000,0xffffffdf,0xffffffff,0xfffff7be,0xffdfffff,0xff9effdf,0x0000736d,0x000018c2,0xf7bd7bae,0xf7deffff,0xfffffffe,0xffdfffff,0xffffffdf,0xffbeffdf,0xffbeffdf,0x00008c30,
-0x002110a2,0x00000821,0x00000820,0x5acb2904,0xefdea555,0xf7deffff,0xffbeffdf,0x4966f6db,0x08610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000820,0x20002841,0xff9ebcd3,0xf7deffdf,0xffdeffde,0xffffffdf,0x2944ce58,0x08610000,0x08410000,0x00410000,0x29240000,0xf73c9c51,
-0xffdfffdf,0xffffffdf,0xffffffdf,0xf7dfffff,0xb596ffff,0x10a20000,0x18610020,0xc5961000,0xffdfffff,0xffffffbf,0xffffffff,0xd6baffff,0x00002925,0x10201041,0x18410800,0xffffd69a,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000842f,0x102018a2,0xd5f81000,0xffdfffff,0xfffff7df,0xffffffff,0xffdfffff,0xad75ffff,0x08810000,0x00001081,0xf6fc626a,
-0xffdfffbf,0xffffffdf,0xffffffdf,0xffdeffff,0xffdfffbe,0x39a6d659,0x08400000,0x08200820,0x00000820,0xc5f720e3,0xffffffff,0xffdeffde,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffde,0x9cb2f79d,0x08400000,0x00000020,0x08610000,0x630b0000,0xffffef5c,0xffdeffdf,0xffffffff,0xffdfffff,0xffbeffdf,0xb596ffff,0x08400820,0x000010a2,
-0xffff9451,0xffffffde,0xffffffff,0xffffffff,0xffffffdf,0xff9effdf,0x00007baf,0x086118a2,0xc6170000,0xffdeffff,0xffffffff,0xffffffff,0xffbeffff,0xffdeffff,0x0000736d,0x000018c3,0xffde9471,0xffffffff,0xffffffdf,0xffffffff,0xffffffff,0xdebaffdf,0x00002925,0x000018c3,0xef9d630b,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,0xffffffbe,0xad34ff7d,0x00004a28,
-0x08210841,0x00000820,0x00001082,0xffbf8c10,0xf7dfffff,0xfffff7df,0xffdfffdf,0x4966f6bb,0x08611041,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000800,0x40a22000,0xffded575,0xf7feffde,0xfffffffe,0xb575ffbe,0x00004a69,0x08410020,0x10820840,0x00000000,0x00001061,0x62ab0000,
-0xffbee67a,0xffdfffff,0xffffffff,0xffffffdf,0x6b4dffbe,0x10810000,0x18a20020,0x730c0800,0xffdfff7e,0xffffffdf,0xffffffff,0xfffff7be,0x1061ce59,0x20c30000,0x94100800,0xf7ffffdf,0xffffffff,0xffffffdf,0xffffffff,0xffffffff,0xffffffdf,0x00009c92,0x18821082,0x62cb0800,0xffdfff9e,0xf7fff7df,0xfffff7ff,0xffbfffdf,0xce59ffdf,0x00610000,0x10410840,0xbd351000,
-0xffdfffbf,0xffffffdf,0xffffffdf,0xffffffde,0xe6baffbe,0x18828bcf,0x08200000,0x10611081,0x08200841,0x39660820,0xf73d9cb2,0xffdfffdf,0xffffffde,0xffffffff,0xffffffff,0xffdfffff,0xffdfffdf,0xffdfffdf,0xde79ffdf,0x0000732c,0x08400000,0x08610861,0x08600841,0x20e30000,0xd659736d,0xffffffde,0xf7deffff,0xffdfffff,0xffffffdf,0x62cbf75d,0x10a20000,0x00001082,
-0xf77d6b0c,0xffdfffbe,0xffffffff,0xffffffff,0xffbfffff,0xd639ffdf,0x00001021,0x00001081,0xd6790000,0xffffffff,0xffffffff,0xfffff7ff,0xffdeffff,0xffffffbf,0x00008c30,0x00002104,0xffdf9451,0xfffeffde,0xffffffdf,0xffffffff,0xffbfffff,0xa4d3ffff,0x10820000,0x18620841,0xad540000,0xffdeffff,0xffffffff,0xffdfffdf,0xffffffdf,0xe69affdf,0x0800836e,0x08410800,
-0x10810861,0x10811082,0x00000861,0xad1441c7,0xffffef3c,0xffdeffdf,0xfffffffe,0x5186febb,0x10821021,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000800,0x38a22000,0xffbed575,0xf7feffde,0xdebaffff,0x08206b2c,0x00000000,0x10a21061,0x00000020,0x086118e3,0x08210000,0x000018a3,
-0xbd351841,0xffffff7e,0xffffffdf,0xffffffdf,0x0000c5f7,0x08411061,0x08000000,0x080018a2,0xffdfc5b7,0xffffffbe,0xff9eff9e,0xffffffdf,0x0820bdd6,0x08001061,0xde5a2062,0xf7deffff,0xffffffff,0xffdfffff,0xf7feffff,0xf7def7ff,0xffdfffbe,0x0000d639,0x08410821,0x08000841,0xffbfcdd8,0xf7dfffdf,0xffdfffff,0xffdfffff,0x5aaaf75d,0x10a20000,0x18a20000,0x626a0800,
-0xffdff73d,0xffffffff,0xffdeffff,0xe6fbffde,0x18419c71,0x00000800,0x18a21061,0x00000000,0x18a20820,0x00000800,0x52280800,0xf77dbd96,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xffbfffff,0xff7eff9f,0x28c3b514,0x18a20000,0x10c210a2,0x00000000,0x10810000,0x000010a2,0x08000800,0xe6fb9451,0xffffffde,0xffdeffdf,0xffffffde,0x0000bd96,0x08411061,0x10820040,
-0xad140000,0xf79effff,0xf7fff7ff,0xffdfffff,0xffbfffdf,0x836eff5d,0x10820000,0x000010a2,0xffff94b2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0x0821bdb7,0x00200862,0xde790000,0xf7deffff,0xffdfffff,0xfffff7be,0xfffff7bf,0x3966debb,0x10820000,0x10410821,0x41e70000,0xffffe71b,0xffdefffe,0xffdfffff,0xf75dffbe,0x1862a493,0x18820800,0x18c21082,
-0x00200000,0x00000000,0x18c21081,0x00000000,0xbdb641e7,0xfffff79e,0xfffef7de,0x61c7fedb,0x10610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18410800,0x38c22000,0xffdeddd6,0xfffffffe,0x20e3d679,0x10610000,0x18c21081,0x00000000,0x296531a6,0x00000000,0x106210a2,0x18820000,
-0x08000800,0xff7eac93,0xffffffdf,0xf79dffff,0x002062ec,0x08201082,0x00001061,0x00001081,0xf77e5aaa,0xffdfffdf,0xffbfffdf,0xf79effdf,0x00005289,0x000018e3,0xff9e9431,0xffdfffbf,0xffffffff,0xffffffdf,0xffffffff,0xfffff7de,0xffffffff,0x7bcfffdf,0x10820000,0x000010a2,0xff5e6a8b,0xf7deffbe,0xffdfffdf,0xfffff7be,0x08009c92,0x08411882,0x00001081,0x080018a2,
-0xffdfacb3,0xffffffbe,0xfffffffe,0x62aaf77d,0x08000800,0x18a218a2,0x00000000,0x630b4a28,0x00000000,0x188218a2,0x00001882,0x84100000,0xffdfffbe,0xffffffff,0xffffffff,0xffffffdf,0xfffff7de,0x6aecf75d,0x00000000,0x18c218c2,0x00000000,0x630b4a48,0x00001061,0x10a20000,0x10411061,0x630c0800,0xf7deffdf,0xffdfffdf,0xf79dffdf,0x08006aeb,0x084118a2,0x108110a2,
-0x39850000,0xffffe6db,0xf7def7de,0xffdfffdf,0xffdfffbf,0x0800bd35,0x10821061,0x4a890000,0xf7ffef9d,0xffdfffff,0xffffffff,0xffffffff,0xfffff7ff,0xffdfffff,0x738ef79e,0x18e30000,0x52890000,0xfffff79d,0xffdfffbe,0xffbfffff,0xff9effdf,0x00008bf0,0x002018c3,0x10a21082,0x000018c2,0xf7de9491,0xffffffff,0xffdfffff,0xa4d3ffff,0x08210000,0x18c218a2,0x00000000,
-0xa5344228,0x6b2cbdb6,0x00000000,0x10a218c2,0x00000000,0xf7de9d13,0xffdef7de,0x61e8fedb,0x08610800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0x38a21000,0xffbeee58,0xffffffbe,0x00008c50,0x10612103,0x00000000,0xa5133165,0xdedae71c,0x39e79492,0x00000020,0x00000841,
-0x080018a2,0xff3d5187,0xf7deffff,0xbdf7ffdf,0x00200000,0x00001061,0x10610000,0x10a20000,0x8c510020,0xd638d659,0xeebbde59,0xa534e6db,0x10810020,0x00200040,0xffdfcdf7,0xffdfffdf,0xffffffff,0xffffffdf,0xffdfffff,0xffffffff,0xf77dffdf,0xce38ffbe,0x000010a2,0x10610020,0xb4d41000,0xffffffdf,0xffdfffdf,0xbdd7ffff,0x00000820,0x00201882,0x08810000,0x08001041,
-0xeedb3966,0xffdfffdf,0xffffffff,0x39a6e6fb,0x20c20000,0x00000820,0xa4f339c7,0xf7beef3c,0x5aebc638,0x00000000,0x18c31061,0x52490000,0xfffff77d,0xffffffdf,0xffffffff,0xffffffdf,0xffffffdf,0x00009cd3,0x108218a3,0x00000000,0x9cf239c6,0xf77ce71b,0x8c30d679,0x000018a2,0x18820800,0x31650000,0xffffe73c,0xffbeffdf,0xc5f7ffff,0x10210000,0x00000841,0x08400000,
-0x000018c2,0xffff9471,0xffffffff,0xffffffdf,0xde9affff,0x08003104,0x00001061,0xd6ba10a2,0xffffffff,0xffffffbe,0xffffffff,0xffffffff,0xffffffff,0xffffffdf,0xe6dbffff,0x00002965,0x000018c2,0xffffad75,0xffdfffdf,0xffdfffdf,0xc5d7ffdf,0x08200800,0x00400840,0x00000020,0x00200861,0xce580840,0xffdeffff,0xffdfffff,0x8bf0ffdf,0x10a20800,0x00000020,0x9cd218c2,
-0xffffe75c,0xf75cffff,0x5a89b555,0x08200000,0x004010c2,0xdefb0881,0xffffffff,0x59e8ff1c,0x10820800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x41241000,0xffdfee9a,0xffbeffdf,0x0840630b,0x00001081,0x8c1020c3,0xffffe6fb,0xffffffff,0xe71cffff,0x29858450,0x08610000,
-0x08001081,0xfefc59a7,0xffffffff,0x5289ef5d,0x10820040,0x18820000,0x00002904,0x00001081,0x00000061,0x10211041,0x20622041,0x000018a2,0x08600000,0x00200000,0x8c105249,0xc5b6ad14,0xf71cde7a,0xffbfffdf,0xffffffdf,0x9c72ef5d,0x6aeb734d,0x5a8a732c,0x000010a2,0x10410840,0x41860800,0xa4b39471,0x9c31a451,0x31868c30,0x18a20000,0x31860000,0x0000634c,0x18820820,
-0x8bf00800,0xffbfffbe,0xffdeffde,0x31a5defb,0x00000020,0xa4b220e3,0xffffef3c,0xffffffff,0xf7beffff,0x3186ad75,0x10610000,0x31860800,0xffffe6fb,0xffdfffdf,0xffdfffff,0xffbeffff,0xfffff7bf,0x00206b6d,0x000018a2,0x94702903,0xffffe6fb,0xffffffff,0xffffffff,0x9c50e6da,0x082028e3,0x29450000,0xffdfef3c,0xffffffde,0x5aaaf77d,0x18a20000,0x31860800,0x000073ae,
-0x00000820,0x8c3018a2,0xbdd6b5b6,0xdebac618,0x5269ce59,0x18a20800,0x00000841,0xce594a48,0xf71ceefb,0xff9ef73d,0xff9effdf,0xff9effff,0xff7effdf,0xff9fff5e,0xf73dff5d,0x00006aeb,0x002010a2,0xce182965,0xff3df73d,0xff3df6dc,0x5208e67a,0x18610800,0x00001081,0x73ce9d13,0x20e30000,0x5aca0000,0xffdeff9e,0xfffffffe,0x6aecf75d,0x10810000,0x840f0840,0xffffdefb,
-0xf7beffff,0xfffff7de,0xff5dffff,0x1820a4b2,0x08001021,0xdedb20c3,0xffdfffff,0x51c7ff1c,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10410000,0x20410800,0xff7ec555,0xff9effdf,0x00004a49,0x002010c2,0xffdf8c10,0xffffffdf,0xffdfffff,0xffffffbe,0xce99ffff,0x00002944,
-0x000010c2,0xfebc38e4,0xffffffbf,0x00009492,0x108210a2,0xacf40800,0x0000ce18,0x00610000,0x08610040,0x10211041,0x10001000,0x08200000,0x00000820,0x00200040,0x00000000,0x08000800,0x39451001,0xffdfde5a,0xffffffbe,0x0800ad34,0x08000800,0x00000800,0x00200020,0x00000820,0x08001021,0x08000000,0x10000800,0x00000000,0x18820841,0xbdf70000,0x73aeffdf,0x18a20000,
-0x08000800,0xbd766aec,0xfffff75d,0x2964df1b,0x08200020,0xffbe7b8e,0xffffffdf,0xfffffffe,0xffdeffff,0xe71cffff,0x00004a49,0x10411082,0xffdfce59,0xffffffff,0xbd75f75d,0xffffd659,0xffdfffdf,0x00006b6d,0x00002103,0xffff9c91,0xfffeffff,0xf7fff7ff,0xffffffff,0xffbeffde,0x00007b6d,0x20e31061,0xffffdedb,0xffffffff,0x00009471,0x106118a2,0xbdb60000,0x7bceffff,
-0x18c20000,0x00000000,0x00000000,0x08000800,0x00200000,0x00000820,0x08610820,0x00000000,0x39451841,0x62ab5a49,0xffdfde7a,0xffdfffbf,0x7b2de6dc,0x72ec7b2d,0x3104624a,0x08200000,0x08610000,0x10610000,0x394549c8,0x39453925,0x08001000,0x18a21041,0x738d0000,0xef5dffff,0x0000528a,0x080020e3,0xffbe9c71,0xffdeffff,0x49e8f71c,0x00200000,0xe75c4207,0xffffffff,
-0xffffffff,0xffffffdf,0xffbeffbe,0x51e8ff9e,0x10410800,0xe6ba0800,0xffdfffff,0x28c3de59,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000021,0x08000800,0x72ec2082,0xde9abd96,0x000039c6,0x000010c2,0xff9eb535,0xffbeffff,0xffdfffff,0xf77dffdf,0xf7feffff,0x0000632c,
-0x000010c2,0xf6dc2882,0x9cf3f75d,0x002018c2,0x000010c3,0xff3d6acb,0x94b2ffdf,0x18e30000,0x08610861,0x18821061,0x10411020,0x00000841,0x10610800,0x08610841,0x18c310a2,0x18821882,0x10211062,0xeedc41c7,0xde7affdf,0x10402903,0x18a220c2,0x10a218c2,0x108110a2,0x08201061,0x08200000,0x108210a2,0x18a220a3,0x10a210a2,0x000018c2,0xffbe8c10,0xc5f7ffff,0x08610000,
-0x10611041,0x08000000,0xce175aaa,0x2103ce17,0x00001061,0xffff7bae,0xffffffff,0xf7ffffff,0xffdfffff,0xffffffde,0x00009cb2,0x000018c2,0xffdfce38,0xb596e6fb,0x00005acb,0x9c9228e3,0xffffe71c,0x0000630b,0x000018e3,0xffdfce38,0xffffffde,0xffffffff,0xf7fefffe,0xffffffff,0x00009451,0x000018a2,0xffffbdd7,0xa513defb,0x00000800,0x000018a2,0xffbf9431,0xe73cffff,
-0x000039c6,0x18c218a2,0x18a218a2,0x08201061,0x10810840,0x08610000,0x108110a2,0x108118a2,0x00000840,0x08000000,0xef3d5a6a,0xffbfffff,0x08007baf,0x00000000,0x00000800,0x08601061,0x00200881,0x00000861,0x08000800,0x00000800,0x08611061,0x000010a2,0xe71b2944,0xffdfffde,0x00009c72,0x08201081,0x8bcf0800,0xffdfd638,0x1861de59,0x00001041,0xf79d630b,0xfffeffff,
-0xffffffff,0xffdfffdf,0xffdfffdf,0x5249ff7d,0x10410000,0xee7a1000,0xb514ff1d,0x080051e8,0x08210820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10400000,0x08000800,0x39a70800,0x000018a3,0x000010a2,0xffdfacf4,0xffffffbe,0xffffffff,0xffffffbf,0xf7def7ff,0x00007bef,
-0x082010a2,0x7b0d0800,0x00005a69,0x08610000,0x00000041,0xcdf83125,0xf77dffdf,0x0000630c,0x00000000,0x00000000,0x08200800,0x00000020,0x08001040,0x00000000,0x00000000,0x08400000,0x18c31061,0x9c720000,0x736dff7d,0x18a20000,0x00000000,0x00000000,0x00000000,0x08610000,0x00400020,0x00200000,0x00000000,0x00000000,0x5aaa0000,0xffdfef3c,0x83cfff9e,0x10a20000,
-0x08410020,0x106118a2,0x08000000,0x10613986,0x000018c2,0xffff83ef,0xffdeffff,0xffffffff,0xfffff7ff,0xffdfffdf,0x0000a4f3,0x000018e3,0xc5b7a4f3,0x00004a28,0x18820000,0x08000000,0xa4f341e7,0x00004207,0x000010a2,0xffffbdb7,0xffffffff,0xfffffffe,0xfffffffe,0xfffff7de,0x00009cb2,0x000020e3,0xa4f37bae,0x00004228,0x10610820,0x00001061,0xffdfbdb6,0xffdfffbe,
-0x0020bdd6,0x00000000,0x00000000,0x10410000,0x00000840,0x00000861,0x00000000,0x00000000,0x00000000,0x20c21061,0xad140800,0xc618ffff,0x08610861,0x18c218c3,0x00000000,0x00000000,0x08400000,0x10400840,0x10201882,0x00000820,0x00000000,0x00000020,0xffffa513,0xeefcffdf,0x000041c7,0x08401061,0x08001061,0x732c1841,0x0000732c,0x000018a2,0xffff7bae,0xfffffffe,
-0xffffffff,0xffffffff,0xffffffde,0x4a48ff9e,0x10200000,0x834e1000,0x08005a29,0x10410800,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08200000,0x18821020,0x00001041,0x00200000,0x000010a2,0xffdfacd3,0xffdfffdf,0xffdfffbe,0xffdfffbe,0xf7fef7de,0x0000842f,
-0x084010a2,0x08000800,0x18a20000,0x00400861,0x18a30000,0x5a490800,0xfffff75d,0x738de6db,0x526952aa,0x4a484a49,0x000031a5,0x08610040,0x28e30800,0x526949e7,0x42694208,0x00004228,0x10610000,0x20e40000,0x000062eb,0x00000841,0x526918c2,0x83cf62eb,0x738d738d,0x00006b6d,0x00200060,0x00000861,0x4a493165,0x4a8952ca,0xe6db528a,0xffdfffbe,0x0800bd75,0x00601081,
-0x00200861,0x10611082,0x08201881,0x08200000,0x080020c2,0xffdf9430,0xffffffdf,0xffffffdf,0xffffffff,0xffffffde,0x0000ce38,0x08200841,0x08200000,0x10610000,0x18a220c3,0x18a21061,0x00000000,0x08410000,0x000010a3,0xffffbdd7,0xffdfffdf,0xffffffff,0xffffffff,0xffffffde,0x0000a4f3,0x084110a2,0x00000000,0x10a20000,0x082020c3,0x00001082,0xf75d62cb,0xffdfffdf,
-0x9cf3ffff,0x5aca5aaa,0x4a285a89,0x000020e3,0x08810840,0x42280000,0x8c50842f,0x7bce83ef,0x5aa9736d,0x10410800,0x31450800,0x5249ad14,0x10610000,0x00001061,0x314420e3,0x318539a5,0x08003164,0x10200000,0x08000800,0x318520c2,0x31c639c6,0x5b0b2124,0xffdfef3c,0xa4b2ffdf,0x10c20000,0x08810060,0x20e31081,0x08001040,0x08400000,0x000018a2,0xffde6b4c,0xfffefffe,
-0xffffffff,0xf7ffffff,0xffffffff,0x39a6f75d,0x10610000,0x08001000,0x18a20800,0x08001041,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08200000,0x10411041,0x10820820,0x00200820,0x000010a2,0xffdf9c72,0xffffffbe,0xffffffbe,0xffbeff9e,0xffffffff,0x000094b2,
-0x002010a2,0x10610800,0x10821882,0x00200000,0x00000820,0x080018a2,0xff9eacd3,0xffbeffdf,0xe73cf79e,0xef5df77d,0x0020630b,0x000010a2,0xd65941c6,0xef5cf73c,0xef9def5c,0x9cf3ef5c,0x10610000,0x00000821,0x10820000,0x08001061,0xf79d9491,0xff9dff9e,0xffdff79d,0x7c2ff7be,0x08a20000,0x00200861,0xef3c732c,0xef7df7de,0xff9ef7be,0xef1cffff,0x000041c7,0x08401081,
-0x10c20000,0x08000000,0x10611081,0x000010a1,0x00001081,0xffde9450,0xffbeffff,0xffdfffdf,0xffbeffbf,0xffffffdf,0x0800ce58,0x10610820,0x08410841,0x18a218a2,0x00000800,0x10a20000,0x18821061,0x00000821,0x00001082,0xffdfbdb6,0xffffff9e,0xffffffff,0xffdfffff,0xffffffbe,0x0000a4d3,0x082010a2,0x10611041,0x000018c2,0x00000000,0x10811061,0x9c920000,0xffbeffff,
-0xffffffde,0xf75df77d,0xef1cf77d,0x00005289,0x002018a2,0xdeda2144,0xf7beffff,0xffdeffde,0xef5cffbe,0x08008c0f,0x08001861,0x00000000,0x10811082,0x8c300000,0xef5be6da,0xe73be6fa,0xb574ef3b,0x080020a2,0x000018a2,0xe71b8c30,0xe73be73b,0xef7ddefb,0xffdfffdf,0x2904de7a,0x00610000,0x00000000,0x00000000,0x20c30820,0x00000861,0x000020e3,0xffff6b4c,0xfffffffe,
-0xffffffff,0xffffffff,0xffdef7be,0x2103ef1b,0x08410000,0x10820800,0x08811082,0x080018a2,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000041,0x00000840,0x10610800,0x002018c2,0x00200000,0x00000841,0xb53449e7,0xffdfff7d,0xffbeffdf,0xffdfffbe,0xdedaf7be,0x0820528a,
-0x000010a1,0x18a20820,0x00000020,0x00001082,0x00001041,0x00000861,0xe67a30e4,0xffbfffdf,0xffffffdf,0xc618ffff,0x00200000,0x000018c2,0xffffb555,0xffffffff,0xffffffff,0xf7beffff,0x0000738e,0x002010a2,0x10411061,0x628a0800,0xfffff77d,0xffffffff,0xffdfffff,0xe71cffff,0x002039c7,0x080010a2,0xee9b2062,0xfffeffff,0xffbeffff,0x9451ffde,0x18a20000,0x00001061,
-0xd6ba8430,0x20e38c71,0x08200000,0x002010a2,0x00000881,0xbd753145,0xffdfff7e,0xffbfffdf,0xffdfffdf,0xe6fbffbe,0x00007bcf,0x00200841,0x18a20820,0x00000000,0x7bee5aeb,0x00002103,0x10a20861,0x00200000,0x00001081,0xffbfa4d3,0xff9fffdf,0xf7bfffff,0xffffffff,0xcdd7ffdf,0x00005229,0x08610841,0x18a21061,0x10a20000,0x41c7736d,0x10810000,0x18a20000,0xffffdeda,
-0xffbeffde,0xffffffff,0xcdf7ffdf,0x08400000,0x00001081,0xffde9cf3,0xffdeffff,0xffffffde,0xffffffff,0x3165deba,0x18a20000,0x08401061,0x00001081,0xff9d62eb,0xfffefffe,0xfffefffe,0xfffffffe,0x00008c30,0x000018c2,0xf79d5aaa,0xf7feffff,0xffffffff,0xff9effdf,0x00007baf,0x004010c2,0xad750000,0x73aece58,0x00002103,0x08610000,0x00001082,0xf7bd5aeb,0xffdeffde,
-0xffdfffff,0xffbeffdf,0xffbfffdf,0x0000a4b3,0x00410020,0x08610000,0x00400881,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x31030800,0x08005207,0x00200000,0x00000821,0x08610020,0x08000800,0xbdb64a08,0xffffffbe,0xdebaffdf,0x00008430,0x10610000,
-0x08400000,0x00000000,0x949218c3,0x5aaad69a,0x18a20000,0x10820000,0x730c0800,0xffdfff5d,0xffdeffdf,0x6b2cf7be,0x21040000,0x7b4d0800,0xffdeffdf,0xffffffbe,0xffffffff,0xfffff7be,0x0020d6ba,0x08610020,0x18620800,0xc5961820,0xffbeffff,0xffffffff,0xffdfffff,0xffffffdf,0x0000ad34,0x104110a2,0x8bcf1000,0xfffeffde,0xffdfffff,0x28e3e6db,0x18a20000,0x39860000,
-0xffffe71c,0xd6baffff,0x00008c30,0x00600000,0x08610020,0x08000000,0xd618730c,0xffbfffdf,0xdebbffdf,0x20e39431,0x08610000,0x00200020,0x00000820,0xad343165,0xfffff79d,0x73aededa,0x00000000,0x00200881,0x00000020,0x8c311021,0xffbfeefc,0xffffffbf,0xe6bbffdf,0x10008bef,0x10610000,0x08410000,0x00000000,0xce796b4d,0xb575ffff,0x10810000,0x000018c3,0xffbe83ef,
-0xffdeffde,0xffffffde,0x4a28ef3c,0x18a20000,0x4a480820,0xfffff7bd,0xffffffde,0xffffffff,0xffdeffde,0xad13ffff,0x10610800,0x08610840,0x18c20000,0xfffed678,0xfffefffe,0xf7fefffe,0xfffff7dd,0x2944deba,0x18e20000,0xad540000,0xffdeffff,0xf7dff7de,0xc5f8ffff,0x08410000,0x000010c2,0xffff8c51,0xffffffbe,0x8c50deda,0x00002944,0x10610820,0x632c0000,0xffffe6db,
-0xffdfffdf,0xff9effdf,0x7b2de69a,0x10610800,0x00000841,0x00200861,0x634c0020,0x28c29471,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610020,0x28a20800,0xd617d5d6,0x10c27bce,0x08610000,0x00000000,0x18821041,0x08410000,0xad3462cb,0x29249492,0x00200000,0x00001082,
-0x00000040,0x8c102082,0xffffdeda,0xce38ffdf,0x00000000,0x08400861,0x10201862,0xffbfb535,0xfffff79e,0x0000c617,0x08201061,0xd5f81821,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xa554ffff,0x10820000,0x00001061,0xf77d62eb,0xfffff7be,0xffffffff,0xffdfffff,0xffffffff,0x62abf77d,0x18c20000,0x18621020,0xfffededa,0xffbeffbe,0x08009410,0x10811081,0xad540000,
-0xffbeffbe,0xffffffbe,0xce79f7de,0x00205b0b,0x00000861,0x10a20841,0x10410000,0xe6bba4b3,0x2904acf4,0x00000000,0x000018a2,0x08410820,0x7bef0000,0xffffdeda,0xf7beffde,0xf7deffff,0x52cac658,0x08610000,0x08410841,0x00000000,0xad143186,0xff3df73d,0x3986bd55,0x08410800,0x00001081,0x00000841,0xb5964208,0xfffff7be,0xf79dffff,0x0000738d,0x08201081,0xd6791041,
-0xffbeffff,0xffbeffde,0x08009471,0x18c210a2,0x9cb20000,0xffffffff,0xffffffde,0xffffffff,0xffffffff,0xf75dffbe,0x0800628a,0x10811081,0x8c910020,0xfffeffff,0xffffffde,0xffffffff,0xffffffff,0x9c92ffde,0x10820000,0x41a60800,0xffffe6db,0xffbeffff,0x6b2cff7e,0x18e30000,0x31850000,0xffdfe6db,0xffdeffbe,0xff9effff,0x00009492,0x08411882,0x00000840,0x9c7120a2,
-0xff9eeefb,0xa492f71c,0x080020a3,0x08001021,0x08820020,0x4a890000,0xffbdb5d6,0x38c3fefb,0x08410800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x30a21840,0xffded5b6,0xb595ffff,0x00000000,0x08400861,0x08000000,0x084018a2,0x00000820,0x00000820,0x10611081,0x00000820,
-0x000018c2,0xff7e730c,0xf7beffff,0xfffff7be,0x00009cd3,0x08201081,0x08001041,0xe69a1862,0xf77dffff,0x0000630b,0x080020e3,0xf6dc4146,0xffdfffdf,0xffffffff,0xf7deffff,0xffdfffdf,0xd6baffff,0x08400000,0x00001882,0xf77d5aaa,0xffffffff,0xffffffff,0xffffffff,0xf7dff7ff,0xad14ffdf,0x18a20000,0x08201020,0xffffce79,0xd659ffde,0x08001020,0x000018a2,0xf79e62eb,
-0xffdfffff,0xf7deffff,0xffffffff,0x2103d6b9,0x10610000,0x10a20861,0x000010a2,0x30e40800,0x00000800,0x108218a3,0x00001082,0x000010a2,0xf79d6b4d,0xffbeffff,0xffdeffbe,0xffdeffff,0xef5cfffe,0x00005aaa,0x00000861,0x10a20861,0x00000000,0x628a49e8,0x08000800,0x18c31062,0x08400020,0x000010a2,0xffffbdd6,0xffbeffde,0xfffff7de,0x3165e71b,0x18c20820,0x62eb0000,
-0xffdff77d,0xf77dffff,0x00005aaa,0x00001081,0xdeba39a6,0xf7bdffff,0xffdeffdf,0xffffffff,0xfffff7be,0xffbeffdf,0x0800732d,0x000018a2,0xdefb0881,0xffdeffff,0xfffff7de,0xffdfffff,0xffbeffdf,0xde79ffff,0x000020e3,0x080018a2,0xffdfce18,0xffffffdf,0x0800bd96,0x18a31061,0xad340000,0xffbeffff,0xffffffde,0xffffffbe,0x0820ad55,0x00001082,0x20c31062,0x08001021,
-0x8bef3965,0x08005208,0x18820800,0x00001041,0x00200841,0xd6ba0000,0xfffeffff,0x3041e5f7,0x08411000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000820,0x30812040,0xffbecd55,0xd6baffde,0x00002124,0x00000861,0x10a20820,0x08401061,0x10a21061,0x10a21082,0x08411082,0x08400000,
-0x000010a1,0xffbf93d0,0xf7beffbe,0xffffffff,0x4a8aef9e,0x18a20000,0x10610000,0x732d1000,0xf77dffbf,0x0000528a,0x104118a2,0xacb31000,0xffdeffdf,0xffffffff,0xfffff7df,0xffffffff,0xa4f3ffff,0x08610000,0x20a30820,0x94310800,0xf7beffff,0xffffffff,0xffffffff,0xffffffdf,0x5289ef5d,0x18e30000,0x8c500000,0xf7deffff,0x736dffff,0x20e30000,0x00000840,0xffffce58,
-0xffdeffbe,0xffdeffff,0xffffffff,0x3986e6db,0x10610000,0x00000000,0x18c310a2,0x08001062,0x20a31041,0x000018a2,0x08610000,0x00001081,0xffbe9491,0xffffffff,0xffffffde,0xfffff7be,0xfffffffe,0x000083ef,0x000018a2,0x00000020,0x18c310a2,0x08000000,0x18821882,0x000010a2,0x08400000,0x08200820,0xffffbdf7,0xffdfffbe,0xfffeffff,0xad54ffff,0x10a20000,0x000018a2,
-0xffdfa4f3,0xfffff79e,0x0000b595,0x002018c2,0xf77d5a89,0xffffffff,0xffdfffff,0xffffffff,0xf79effff,0xd618ffdf,0x10410800,0x10610820,0xb5950000,0xffdeffff,0xffdfffdf,0xffffffdf,0xffbfffff,0xb555ffdf,0x10810000,0x00001882,0xffffc5d7,0xe71bffde,0x080049e7,0x000018a2,0xef7d4a28,0xffdeffff,0xffbeffff,0xffffffdf,0x0000b596,0x088110a2,0x00000000,0x20e30000,
-0x00000000,0x18a20800,0x108218c2,0x08210820,0x00000841,0xe73c4a49,0xfffefffe,0x3061f679,0x08411020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610000,0x30811800,0xff9ecd34,0xd6baffff,0x00001903,0x08410040,0x00000000,0x10a20000,0x10811081,0x00001082,0x00000000,0x00200000,
-0x080010a2,0xff5e8b8f,0xffbeffff,0xf7beffff,0xbdf7ffff,0x08000800,0x08610840,0x08001061,0xffdfbd96,0x0000a4d3,0x186218a2,0x49a70800,0xffbeeefb,0xffdfffbe,0xffffffdf,0xffffffff,0x5249f75d,0x10820000,0x10200820,0x18621000,0xffdfd639,0xffbfffdf,0xffbfffbf,0xffffffbf,0x0000ad54,0x000018c3,0xe71b3165,0xffffffff,0x0020ce79,0x18e20020,0x7bce0000,0xffffffdf,
-0xffffffdf,0xffffffff,0xffdfffdf,0x3165e6fb,0x00000000,0x6b2c4a28,0x00000000,0x18a218a2,0x00001882,0x4a490000,0x00005aeb,0x000010a2,0xffde8c50,0xffffffff,0xffffffde,0xfffeffff,0xffdeffff,0x00008c0f,0x00001881,0x21032103,0x00000000,0x18a318c3,0x00001061,0x4a690000,0x00202124,0x00000841,0xffdfbdf7,0xffdfffbe,0xffdfffff,0xff9effdf,0x00005aeb,0x000018a2,
-0xe6bb18a2,0xffbeffff,0x5269f75d,0x10a20020,0xc5f70000,0xffbeffff,0xffffffbe,0xffffffdf,0xfffff7be,0x7b4dff7e,0x18620800,0x10810820,0x52890000,0xffbef75d,0xffdfff9e,0xffdfffff,0xffdfffbf,0x4a28eefc,0x10a20000,0x6b2c0000,0xffbeffbe,0xad14ffff,0x18820800,0x00001082,0xffffbdb6,0xfffff7be,0xffbeffbe,0xffffffff,0x0000b596,0x000018e3,0x947152aa,0x00002924,
-0x18c210a2,0x084018c2,0x00000000,0x08200000,0x000010a2,0xf7be62eb,0xfffeffde,0x3041ee18,0x08411020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x28411040,0xff7ecd35,0xce78ffff,0x00000881,0x000010a2,0xa4d25269,0x00004207,0x00000000,0x4a280000,0xad95ad55,0x00200000,
-0x000010a2,0xff9e7b4d,0xffbeffdf,0xffdeffdf,0xffffffff,0x00009451,0x00201082,0x00001082,0xf71c5a29,0x5229ff3d,0x10610000,0x08001882,0xffdf9c72,0xffdfffbe,0xffffffff,0xffffffff,0x0000bd96,0x08611081,0x08410841,0x08001061,0xff9f6acb,0xffdfffdf,0xffbfffdf,0xf71cffdf,0x000041e7,0x000018a2,0xffffbd96,0xffdeffdf,0x0000738e,0x000018a3,0xdeba3165,0xffdfffdf,
-0xffffffdf,0xffdeffff,0xffffffff,0x3165deba,0x00000820,0xffbe7bce,0x5aaabdb6,0x00000000,0x5aaa0000,0xf77dbdb6,0x0000b575,0x000018e3,0xffff9471,0xffffffdf,0xffffffff,0xffdfffff,0xffdeffde,0x08209450,0x000018a2,0xdeba83ef,0x10618c30,0x00000000,0x31a60020,0xdf1bb5b5,0x00005acb,0x000010a2,0xffffb596,0xffdfffff,0xffffffdf,0xffffffbf,0x0020bdf7,0x18a20841,
-0x7baf0000,0xffdff79e,0xbdb6ffdf,0x18a20000,0x52690000,0xffffef5d,0xffffffbe,0xffbfffdf,0xffffffbe,0x1021d639,0x08201041,0x10811081,0x08001061,0xffdfb555,0xffffffbf,0xffffffdf,0xffdfffbf,0x0800a4b2,0x000018c3,0xd6790800,0xffdfffff,0x62cbf79e,0x20a30000,0x738e0000,0xffdeffde,0xffffffff,0xffdfffdf,0xffffffff,0x0000b555,0x00202103,0xffff7c0f,0x83efde9a,
-0x00000000,0x00000000,0xad5562eb,0x00009451,0x000018c3,0xffde73ae,0xffdeffff,0x2841ddb6,0x00201041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x20411861,0xffbfbc93,0xce78ffbe,0x00000861,0x000010c2,0xffdf730c,0x9d13ef5c,0x630b5289,0xef5cb595,0xd6baffff,0x00200861,
-0x00000881,0x93f03124,0x9430a492,0x9c719430,0xa4f39451,0x000083cf,0x08610821,0x10820020,0x6acb0800,0x62aaacd3,0x10820000,0x08000841,0xde393125,0xf77dff9e,0xffdfffbe,0xe6fbff9d,0x00005a69,0x00001882,0x08610000,0x10620841,0x9c520800,0xbd75cdd7,0xcdb7bd55,0x7b8ec5b6,0x18c30000,0x41c70000,0xffbed679,0xc5f7ffbf,0x08200821,0x000018a2,0xf77e8c30,0xf75dff9e,
-0xf77dffbe,0xffbeffbe,0xffffffbe,0x3164de99,0x00200840,0xffbe83ef,0xffbeffdf,0x5aaaad14,0xf7beb5b6,0xffffffff,0x0000b595,0x000018c3,0xffde9492,0xffbeffff,0xffffffde,0xffffffdf,0xffdeffdf,0x00009491,0x000020e3,0xffff9471,0xd699ffff,0x10a26b2c,0xe73c842f,0xffdeffff,0x0000738e,0x000018c3,0xf75c9471,0xff7ef75c,0xff7eff9e,0xff9eff9e,0x73aeffbe,0x10a20000,
-0x08000821,0xffbeb555,0xf77dffdf,0x00006b2d,0x082020c3,0xff9ea4d3,0xffffffdf,0xffdfffff,0xf79effff,0x0800736d,0x10811882,0x00000000,0x000018a2,0xe6fb41c7,0xffdfffdf,0xffdfffff,0xe6dbffff,0x08003965,0x000018c4,0xffde83ef,0xffbfffdf,0x0000a514,0x10411882,0xc5f70000,0xffbeffbe,0xffbeffbe,0xffbeff9e,0xf77dffbe,0x08008bef,0x000018e3,0xffff8450,0xffdeffbe,
-0x5acabdd6,0xc6588c91,0xfffff7be,0x0000c5b6,0x000018c2,0xf7be73ae,0xffffffde,0x2000c514,0x00201041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18411041,0xff9eb492,0xc617ffff,0x00400000,0x000018c3,0xffbf838e,0xf7feffff,0xffffe75c,0xffffffdf,0xbdd7ffff,0x08810000,
-0x08410000,0x08000800,0x00000800,0x00000000,0x00000000,0x08200000,0x00200000,0x00000000,0x00000841,0x00000000,0x00000861,0x10610020,0x41870800,0x6a8a6aab,0x626a5a29,0x3945626a,0x10610800,0x62cb0800,0x0000ad34,0x00200000,0x00000041,0x00000861,0x08610000,0x00000840,0x00000861,0x10410000,0x52292924,0x31455a8a,0x08400000,0x00000841,0x39a62944,0x52494a08,
-0x5a8a5a8a,0x62eb62cb,0x7bce6b2d,0x082062eb,0x000018a3,0xffff736d,0xffdfffff,0xf79dffff,0xffffffff,0xfffff7be,0x0000b5b6,0x000018a2,0xc5f739a6,0xffffffbe,0xffdfffdf,0xff9effff,0xff7dffdf,0x00006aeb,0x000018c3,0xffff9cf3,0xffdefffe,0xe73bffde,0xfffff79e,0xff7dffdf,0x000062eb,0x00000841,0x39851882,0x41a641c6,0x49e841c7,0x7b8e62ab,0x296562eb,0x08400000,
-0x00001061,0x5aaa1082,0x736d6b2c,0x00003986,0x00001082,0xa51420e3,0xb575a513,0xad55b595,0x83afacf4,0x08001882,0x00001061,0x42076b2c,0x08810020,0x52690000,0xacd39c71,0xbd76b535,0x62cbad15,0x10810800,0x00001082,0x945162eb,0x8c109c92,0x000018a2,0x00000820,0x4a281061,0x62aa62cb,0x5a695a69,0x62cb5a8a,0x52495aab,0x08001862,0x000018c2,0xffff7c2f,0xffdefffe,
-0xfffeffde,0xffdeffde,0xffffffff,0x1820cdb7,0x00001081,0xffde736d,0xffdeffff,0x10009c10,0x00201061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08001881,0xff7e93cf,0x5289ce38,0x08610020,0x080018e3,0xffdf9c51,0xf7deffff,0xffdeffff,0xef3cffff,0x3186a4d3,0x00400020,
-0x00200040,0x18821041,0x18c21881,0x108118a2,0x18a21081,0x00001061,0x00000000,0x00000820,0x10810020,0x004010c2,0x00200000,0x00000020,0x08001061,0x10001000,0x08000800,0x08000800,0x08201041,0xce181020,0x8c51ffff,0x18c30000,0x08810861,0x08810861,0x00610881,0x08a10040,0x00200020,0x08000000,0x00000000,0x00000800,0x00200840,0x08410020,0x00000000,0x08000800,
-0x00000000,0x00000000,0x00000000,0x08000000,0x00000020,0x7bae18a2,0xffbfce59,0xffffffff,0xf7def7be,0xfffff7be,0x0840b596,0x104118a2,0x10410000,0xdeba83af,0xffbfffdf,0xffbfffdf,0x628ac596,0x08410800,0x00201081,0xffffad75,0xffffffff,0xffffffbe,0xff9effdf,0x838ee67a,0x08410800,0x08200820,0x08000000,0x08000800,0x08000800,0x08000800,0x00000000,0x00000840,
-0x08400000,0x08200000,0x00000000,0x08410000,0x10610000,0x00000000,0x00000000,0x00000000,0x08000800,0x10810000,0x42070820,0xce38f75c,0x00000000,0x00000881,0x08000000,0x08000800,0x00000800,0x00001061,0x08820000,0x00000000,0x00000000,0x08610000,0x00000000,0x00000000,0x08000000,0x08000800,0x00000000,0x00000000,0x10200800,0x00000861,0xce994248,0xffffef7c,
-0xfffef7de,0xffffffff,0xffffffff,0x2061e69a,0x08610840,0x8c3010a2,0xff9de6da,0x08007b2c,0x00201061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00001041,0x7b8e5a49,0x00000000,0x10810841,0x08000000,0xffdfde39,0xfffeffbe,0xffdeffff,0x4a07bdd6,0x00000800,0x00001061,
-0x00000040,0x18821021,0x18c218a2,0x10a21081,0x10a210a2,0x188218a2,0x00201062,0x00000820,0x00200000,0x10c210a2,0x10c210a2,0x00200041,0x08410000,0x18411861,0x18c318a2,0x20e318a2,0x080020e3,0xf7de8410,0xe75cffff,0x00004a69,0x10821082,0x18c310a2,0x00400020,0x00200861,0x08610040,0x10611061,0x18a21082,0x10820841,0x00200000,0x08610840,0x18c31061,0x10611882,
-0x18c31882,0x18a220c3,0x20e318a2,0x00001061,0x08210821,0x00000000,0x7b8e0821,0xffffdedb,0xf7beffff,0xfffff7be,0x0000d6ba,0x18a20000,0x00001862,0x18820000,0xff9eb535,0x7bafeefc,0x00000800,0x10411041,0x000020e3,0xffffb5b6,0xffdff7be,0xff9effdf,0x83afe6bb,0x08001020,0x08210000,0x00000000,0x20c31082,0x18a218c3,0x18a318a2,0x20c320c3,0x10a218c2,0x00001081,
-0x00000000,0x10610840,0x18c310a2,0x08611081,0x08400841,0x10820820,0x18a21882,0x20c31061,0x18a21861,0x10a210a2,0xc6170000,0xffdeffbe,0x0820734c,0x18a220a2,0x18a220c3,0x108218a2,0x08411062,0x08400800,0x10a210a3,0x18e218c2,0x108220e3,0x00000841,0x08610840,0x10a218c3,0x18c220e3,0x18c218a2,0x18c318a2,0x18c318e3,0x08001021,0x08610840,0x00000000,0xdeba83ef,
-0xffdeffff,0xffdeffbe,0xfffff7be,0x0800de79,0x19030000,0x00000000,0x6acb28e3,0x00003965,0x00200841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610000,0x00000000,0x10810861,0x08000841,0xc61839a6,0xff9effdf,0xffffffdf,0x738ed679,0x00000000,0x106118a2,0x08200000,
-0x00610020,0x00000800,0x00000000,0x00000000,0x00000020,0x00000000,0x08610000,0x08000000,0x00000841,0x00000000,0x00000000,0x00610041,0x00200020,0x08000000,0x00000000,0x00000000,0x39a60000,0xffffdedb,0xfffff7de,0x0000c659,0x00000000,0x00000000,0x08610000,0x00200000,0x00001081,0x00000000,0x00000000,0x00000020,0x00000000,0x00000020,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x10400800,0x00000000,0x18a20820,0x00210800,0x94922925,0xffffe73c,0xffdeffff,0xa514f79e,0x000039a6,0x10410841,0x080018a3,0x52290000,0x000041a7,0x10a20841,0x08200841,0x31660000,0xffbfd69a,0xffdfffdf,0x83afde7a,0x08002082,0x18821041,0x00000820,0x08610040,0x00000000,0x00000000,0x08200000,0x00000000,0x00000000,0x00200020,
-0x00000820,0x00200020,0x00000000,0x00000020,0x08610000,0x00000861,0x08200800,0x08000000,0x00000800,0x00200000,0xfffe7c0f,0xffffffde,0x0800cdf7,0x00000800,0x00000000,0x00200020,0x00000841,0x00001061,0x00000000,0x00000000,0x08610000,0x00200000,0x00000000,0x00200000,0x00000020,0x00000000,0x00000000,0x00000000,0x10200800,0x00000000,0x08400861,0x20c20800,
-0xe71b8c30,0xffdeffff,0xfffff79d,0xad54ffbe,0x000039e6,0x18a20000,0x08000800,0x08400000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08610861,0x10820861,0x8c100000,0xfffff79e,0xffdfffdf,0x9c91ef3c,0x00002924,0x10811081,0x10820861,0x08200000,
-0x00000020,0x732c3965,0x7bef7bcf,0x84307c0f,0x7c0f8430,0x738d7bce,0x0000528a,0x08210820,0x31650000,0x7bcf736d,0x84308430,0x000031a6,0x00200861,0x08000000,0x6b0c41c7,0x7c0f6b8d,0xd69a8c50,0xffbeffff,0xffffffde,0xd6baf7be,0xb5b6c5f7,0x9492ad34,0x00003145,0x08410841,0x21240000,0x294539c7,0x10a22944,0x00200020,0x00000840,0x29451082,0x42073186,0x4a4841e7,
-0x4a494a49,0x42074207,0x42284208,0x000039a6,0x00200821,0x08401041,0x10830841,0x08000000,0xbdb65249,0xffffef5d,0xffffffdf,0x7bafdebb,0x00000000,0x08211041,0x00001062,0x10820000,0x08810020,0x00000000,0xe6bb83f0,0xffbfffdf,0x93f0ee9b,0x000020c3,0x18a20800,0x08411061,0x08810040,0x00000020,0x83ef52aa,0x842f840f,0x7c0f842f,0x6b4c7bce,0x5aea5aea,0x18a14a47,
-0x08200000,0x00000000,0x31a62965,0x31c639c6,0x000010c2,0x08400000,0x00000800,0x18a21061,0x39e72944,0x52aa2123,0xf7fee77c,0xffffef9d,0x8c30ffbe,0x5aeb41e7,0x426852ca,0x00002924,0x10820000,0x42070000,0x738e73af,0x5aea6b6d,0x00003185,0x00200841,0x62eb1041,0x84307c0f,0x9cd28c71,0xb5b6ad75,0xb596b596,0xbdd7b5b6,0x08005208,0x00200840,0x18a20840,0x000018a2,
-0x39e60020,0xff5dbd55,0xf7bdffff,0xfffff79d,0xa4b2e6fb,0x00004a08,0x18821041,0x00000860,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x00200020,0x08410041,0x7bae0800,0xffffe6db,0xad34f77d,0x08003165,0x10810000,0x108110a2,0x00000000,0x00001041,
-0x000010a2,0xffdf9410,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0x4208e73c,0x18c30000,0x732c0800,0xffdfff9e,0xffffffff,0x0000c5d7,0x00201082,0x000010a2,0xff9e7b6e,0xffffffff,0xffdeffff,0xffffffbe,0xffffffdf,0xffffffff,0xffffffff,0xe6fbffff,0x08003145,0x00001862,0xdedb8c51,0xd6dae71b,0xce79defb,0x00004228,0x000018c2,0xe6fb8c30,0xe71ce71b,0xef5def5c,
-0xef7cef7d,0xef3cef5c,0xf79ee73c,0x0820bdb6,0x08210000,0x00000000,0x10a21082,0x10820862,0x08000000,0xce385a8a,0xffdfff9e,0xffdfffff,0x39a6c5f7,0x08410000,0x10820821,0x00400861,0x00000882,0xce7952aa,0xffdfffdf,0xa493f6fc,0x080030e4,0x18820800,0x10821061,0x00200000,0x00400000,0x00000881,0xffdec617,0xfffeffff,0xfffeffff,0xffdeffff,0xf7bdef9c,0x630aef5b,
-0x18c20000,0x840f0000,0xe71be71b,0xdedaef7c,0xad75deda,0x00200840,0x00001081,0xd67962ca,0xdefbdefb,0xe75cdefb,0xf7fefffe,0xfffeffff,0xf7deffff,0xf79df7bd,0xf7bdef7d,0x00007bef,0x000010c2,0xc6380820,0xffffffff,0xfffeffff,0x0000bd96,0x00001082,0xef5c3165,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdeffff,0x08009410,0x002018a2,0x00000000,0x18a20800,
-0x000018c2,0x5a490800,0xf79dbd95,0xffffffff,0xff7dffdf,0x000083cf,0x00201081,0x00200000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x00000000,0x00200041,0x00200000,0x00000820,0x94712924,0x00006b2c,0x18a20000,0x10a218a2,0x00000000,0x6b2c528a,0x08400000,
-0x00001081,0xffbe9c51,0xffdeffdf,0xffdfffff,0xf7ffffff,0xffffffff,0x632cffdf,0x18c30000,0x730c0800,0xffdfff9e,0xffdfffbe,0x7b8effbf,0x10820000,0x00200841,0xde9a1861,0xf7beffff,0xfffff7de,0xffffffff,0xffffffde,0xffdfffdf,0xf7def7be,0x8410ffde,0x20e30000,0x6b0c0000,0xfffff79e,0xffffffff,0xffffffff,0x0000738d,0x00002103,0xffffa554,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x18a1d679,0x08200000,0x39c61081,0x00000000,0x108218a2,0x18621862,0x08000000,0xc5f77b8e,0xffbeff9e,0x2104b595,0x08610000,0x08610000,0x00200020,0x00000881,0xd6795acb,0xbd75ef3c,0x00005249,0x18820000,0x18611861,0x00000820,0x4a490020,0x00001082,0x00001082,0xffdfce18,0xffffffde,0xffffffff,0xffffffdf,0xfffeffff,0x736dffbd,
-0x18c20000,0xbdf70000,0xffffffff,0xffffffff,0xffffffff,0x00009cf3,0x000018c2,0xe71b3165,0xffffffff,0xffffffff,0xffffffdf,0xffdfffff,0xf7deffff,0xffffffde,0xf77dffdf,0x000052aa,0x000018e3,0xffff840f,0xffffffff,0xffffffff,0x1881de79,0x00000020,0xf77c39a6,0xffdeffff,0xffffffff,0xffffffff,0xffdfffff,0xffdfffdf,0x08008bf0,0x000018c2,0x8c718450,0x000031a6,
-0x20c30000,0x000018a2,0x738d0000,0xe6dbd659,0x5249acf4,0x00001020,0x00000861,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0x08610020,0x00001081,0x10810020,0x00000000,0x10610000,0x108118a2,0x00200000,0xa53431a6,0xce38ff9e,0x08610000,
-0x08001081,0xffbf9c31,0xffdfffdf,0xffffffff,0xffffffff,0xffffffff,0x6b6df7be,0x20e30000,0x6aeb0800,0xffffff9d,0xffdfffff,0xe6dbffdf,0x000020c3,0x18a20861,0x83ae0800,0xffbeffdf,0xf7deffff,0xffffffff,0xffffffde,0xf7beffde,0xffffffde,0x20e3deba,0x08000000,0xde7a20c3,0xffdeffde,0xffbeffdf,0xffffffdf,0x0020738e,0x000018e3,0xffffa554,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x18a1d699,0x00001061,0xdeda630b,0x6b6dc617,0x00000000,0x18820000,0x082118a2,0x00000000,0x6b4d6b4d,0x00200000,0x08610020,0x000010a2,0x08611082,0x08610000,0x08200000,0x080041e7,0x10820000,0x10611061,0x00001882,0x630c0000,0xd6bace58,0x00002924,0x08200020,0xffdfde9a,0xffffffff,0xffffffff,0xffffffdf,0xfffeffde,0x734cff9d,
-0x18a20800,0xbdd60000,0xffdeffff,0xffffffff,0xffffffde,0x62ebf79d,0x21030000,0x840f0000,0xf7beffdf,0xffdfffff,0xffbeffdf,0xffffffff,0xffdeffdf,0xff9ef77d,0xad14ffdf,0x10a20000,0x18c30000,0xffffd6ba,0xffffffde,0xfffff79d,0x1861e69a,0x00000820,0xef1b2923,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffdf,0x08008bf0,0x002018a2,0xffffc658,0xad34d6da,
-0x08003124,0x18e30000,0x000010a1,0x31041861,0x08000800,0x08200000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x08000820,0x18a20000,0x00000861,0x18a21061,0x08401081,0x00000000,0x8c7120e3,0xffffef5c,0xce58ffff,0x08410000,
-0x00001081,0xffbf9c31,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x73aef7be,0x18e30000,0x6b0b0800,0xfffff7be,0xffdff7be,0xffffffbe,0x00009451,0x08411882,0x20a20820,0xff5dbd55,0xffdfffdf,0xfffff7be,0xffdfffff,0xffdff79d,0xe6dbffbe,0x000062cb,0x080018a2,0xffbf83af,0xffbeffdf,0xffffffdf,0xffbeffff,0x00006b2c,0x000018e3,0xffffad54,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x20e2de99,0x00001081,0xffde630b,0xf7beffff,0x6b4cbdf7,0x00000000,0x10820861,0x08611082,0x00000000,0x08410861,0x000018c2,0x29650000,0x00000000,0x104118a2,0x00001061,0x08610000,0x08401061,0x00001081,0x52890000,0xf7bebdf7,0xe71bffff,0x00003165,0x08610020,0xffffe6fb,0xfffefffe,0xffffffff,0xfffeffff,0xfffefffe,0x734bffbd,
-0x18a20000,0xbdf70000,0xffdeffff,0xffdeffff,0xf79effff,0xdedaffff,0x000018a2,0x18a20820,0xffdfbd96,0xffbfffdf,0xffffffdf,0xffffffdf,0xffbfffff,0xff7effdf,0x3105cdd8,0x18e30000,0x8c510000,0xffffffff,0xffffffde,0xffdfffff,0x20a2e679,0x00000841,0xe6fa18a2,0xffdeffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x08008bcf,0x000020c2,0xffffbe17,0xffdfffff,
-0x9430e6ba,0x00002904,0x10a20000,0x08000000,0x10611861,0x10a20841,0x00000841,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10610000,0x52281841,0x080039a6,0x08610000,0x08200000,0x08400020,0x838e0800,0xffffe6fb,0xf7deffff,0xc638ffff,0x08410020,
-0x08001081,0xffbfa451,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0x73aeffbe,0x18e30000,0x732c0800,0xfffef7be,0xffffffff,0xef3cffdf,0x00006b4d,0x08001882,0x00000841,0x5a490800,0xffdfbd76,0xffbeffff,0xffbfffdf,0xff9effde,0x3965c5b6,0x10610000,0x00001041,0xad353986,0xffffff9e,0xffdfff9e,0xf7beffff,0x0000630c,0x000020e3,0xffffad54,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x28e2de99,0x08400820,0xff9d62eb,0xffffffde,0xffdeffff,0x632cc618,0x00000000,0x00201081,0x18c31082,0x000018c3,0x08610020,0xef3ca4f3,0x29249cb2,0x00000000,0x08401081,0x08401081,0x00000000,0x39c60000,0xf7dead95,0xffdeffff,0xe6fbffde,0x000039a6,0x00200861,0xffffd679,0xffffffde,0xffffffff,0xffffffff,0xfffefffe,0x6b0bffbd,
-0x18c20000,0xbdd60000,0xffffffff,0xffbeffff,0xffffffde,0x9471e6fb,0x082020e3,0x00000841,0x83af0000,0xffdfe6bb,0xffdfffdf,0xffdfffff,0xffdfffbf,0x8bcfeedb,0x08001821,0x08201882,0xd6790000,0xffdeffdf,0xff9effff,0xffffffdf,0x28e3eedb,0x00000000,0xeefb20c2,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x08008bcf,0x00001882,0xffffce58,0xffffffde,
-0xffdfffbe,0x9491e6da,0x00003145,0x10610840,0x10410820,0x00000000,0x10410800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18810000,0xa4301800,0x9471e699,0x000018c3,0x00001082,0x00200881,0xf71c51e8,0xffffffbe,0xfffff7be,0xce79ffff,0x08200000,
-0x08001081,0xffdfac92,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0x738effdf,0x20e30000,0x6a8a0800,0xffbeff7d,0xe6baffdf,0x31869c92,0x08200820,0x08200800,0x08610020,0x08001020,0x7b4e1021,0xffbfd618,0xffdfffbf,0x9430f71c,0x00000000,0x084118a2,0x08610000,0x00000000,0xd638732d,0xffdfff9e,0xf7beffdf,0x00005acb,0x000020e3,0xffdfad34,0xffffffdf,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x2923deb9,0x00000000,0xff9d5aca,0xffffffff,0xffffffde,0xf7beffff,0x52aac618,0x08610000,0x08610840,0x00200000,0xe73c840f,0xffffffdf,0xe71bffff,0x10a29491,0x10610000,0x00001061,0x08610020,0xe73c9cd3,0xffffffde,0xffdefffe,0xe71bffff,0x00003186,0x00001081,0xffffc618,0xffffffff,0xf7ffffff,0xffffffff,0xfffefffe,0x62caff9d,
-0x10a20000,0xce380000,0xffbeffff,0xffffffdf,0xad34f77d,0x00004208,0x08410000,0x10810000,0x00000861,0x94303985,0xffbfd659,0xffdfffdf,0xa493f71c,0x080028e4,0x10610820,0x10610000,0x42080000,0xef3cb575,0xffdfffdf,0xffdfffbe,0x28c3de79,0x00000000,0xeefa20a2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x1000838e,0x080020a2,0xffffce38,0xffdef79e,
-0xffdeffff,0xff9effff,0x08009451,0x00001081,0x08001041,0x7bce0020,0x30e4bcf4,0x00610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18610020,0x7aab2000,0xfffeff7d,0x528adeba,0x10a20000,0x08610040,0xcd961000,0xffdfffbf,0xf7deffdf,0xc679ffff,0x08610000,
-0x08201081,0xffdfacb2,0xffffffdf,0xffdfffdf,0xffffffdf,0xffdfffdf,0x738effde,0x18c30000,0x51a70800,0xff9ef6fc,0x2904b514,0x00000800,0x08411061,0x106118c2,0x084010a2,0x10610841,0x08001021,0x8b8e1841,0xc596e65a,0x08005a28,0x10a21081,0x08610000,0x00001081,0x10620861,0x18410800,0xe6db7b8e,0xffffffff,0x00006b4d,0x000020c3,0xffdfad14,0xffffffdf,0xf7ffffff,
-0xffffffff,0xffffffff,0xffffffdf,0x3985e6fa,0x00000800,0xf77c5269,0xffffffff,0xffdeffff,0xffdfffff,0x9491ffff,0x10a20000,0x00000840,0xce78738d,0xffffffff,0xffffffde,0xfffeffff,0xdefbffff,0x00007bef,0x08200820,0x08200020,0xffffd69a,0xffdff7be,0xffdeffbe,0xdefbffff,0x00002945,0x00200861,0xffffd659,0xf7dfffff,0xf7ffffff,0xffffffff,0xfffff7ff,0x5aaaf79d,
-0x18c30000,0xb5960000,0xffffffdf,0xbd96f75d,0x00005a6a,0x10820800,0x10820820,0x086110a2,0x108110a2,0x00000000,0x94301862,0xb514d618,0x080049c8,0x18820800,0x10a21082,0x10611081,0x00000861,0x49e70000,0xff9ec5b6,0xffffffff,0x3103eeba,0x00000800,0xe6da1860,0xf7feffff,0xffffffff,0xffffffff,0xffffffff,0xffbeffdf,0x0800838e,0x00001841,0xffffce38,0xfffeffde,
-0xf7deffff,0xf73cffff,0x08005249,0x18a21041,0x5aaa0000,0xffffc638,0x2021e639,0x00401061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x10000820,0x59662800,0xff9dee79,0xc618ffff,0x10820000,0x10820000,0x72cc1021,0xff9effbe,0xf7beffde,0xbe17ffff,0x08810000,
-0x000008a1,0xffdfa492,0xffffffdf,0xffdfffdf,0xffffffdf,0xffdfffdf,0x83efffdf,0x18c20000,0x10000800,0x6acb9c51,0x00000800,0x10a210a2,0x000018c2,0x00000000,0x00000000,0x00001061,0x10821061,0x08000000,0x08201041,0x18820800,0x00200840,0x00000000,0x08610000,0x08001082,0x08001882,0x28e40800,0xce388c10,0x00006b2d,0x000020c3,0xffffad34,0xffffffdf,0xffffffff,
-0xffffffff,0xffffffff,0xffffffdf,0x41a6eefb,0x00000000,0xffbe6aeb,0xffffffdf,0xffffffff,0xffdfffdf,0x1082ce38,0x18c30000,0x84300020,0xffffffde,0xf7deffde,0xffffffff,0xffffffff,0xfffff7de,0x8410ffdf,0x18c30000,0x00001082,0xffdf73ae,0xffdfffff,0xffdeffff,0xe6fbffff,0x00003145,0x00000841,0xffdfd638,0xffffffff,0xffffffff,0xffffffff,0xffffffde,0x5a89ff7d,
-0x10810000,0xce380000,0xb575ffdf,0x00005a8a,0x18620800,0x08201882,0x000018a2,0x00200000,0x08200000,0x10811081,0x00000840,0x00001061,0x18a20000,0x08201061,0x00000000,0x00000000,0x10611882,0x000018a2,0x6b0c0800,0xffdebdd7,0x30e3ee9a,0x00000000,0xe6b91881,0xfffeffff,0xffffffff,0xffffffff,0xffdfffff,0xffbeffdf,0x08008baf,0x08201881,0xffffd6ba,0xf7def7de,
-0xf79ef7ff,0xbd15ffdf,0x10810800,0x00001081,0xd6992924,0xffffffff,0x1800ac92,0x00001882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000000,0x38823062,0xfffec575,0xffdfffdf,0x00007bae,0x086110a2,0x18411020,0xffffcdf8,0xffffffff,0xce38ffdf,0x08610000,
-0x000010a2,0xffdfa492,0xffffffff,0xffdfffdf,0xffffffdf,0xffffffff,0x9492ffff,0x10c20020,0x10610000,0x08000800,0x10811061,0x000010a2,0x21030000,0xce998c51,0x00208430,0x08410000,0x00200000,0x10a20840,0x00000000,0x084010a2,0x738d0000,0xbdd7deba,0x00004a49,0x18a30000,0x10210821,0x08001862,0x08200000,0x080018a2,0x000020c3,0xffdfad34,0xffdfffbf,0xffffffdf,
-0xffdfffdf,0xffffffff,0xffdfffdf,0x3985e6db,0x00000800,0xffbe62cb,0xffdfffdf,0xffbeffdf,0xff9effdf,0x080062eb,0x000020c3,0xef3c4a08,0xffbeffde,0xffffffff,0xffffffff,0xffffffff,0xffbeffff,0xe6fcffff,0x000039c7,0x08611062,0xc5d70000,0xffbeffdf,0xffdfffdf,0xe6fbffdf,0x00003145,0x00001882,0xffdfd638,0xffffffbe,0xffdfffff,0xffdfffdf,0xffffffbe,0x628aff9d,
-0x10810000,0x7bcf0000,0x0000630c,0x18820000,0x08001082,0x08201882,0x4a480000,0xbdb6c5f7,0x1882734c,0x08400000,0x10a10060,0x10610020,0x00001082,0x00000840,0xa4f339a6,0x20e39471,0x00000000,0x18a218a2,0x00001041,0x734c0800,0x10207b4d,0x00000841,0xe6ba1061,0xffdfffff,0xffdfffdf,0xffdfffdf,0xffdfffdf,0xffbfffdf,0x080093f0,0x00001881,0xffffd699,0xffffffff,
-0xffdfffdf,0x49c7f6fc,0x08610000,0x000010a2,0xffdfad34,0xf77dffde,0x10007b2d,0x00001882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x10001841,0xd63862aa,0xde18e659,0x00009451,0x00410861,0x00001061,0xad554a49,0xb555b534,0x7b8dacf3,0x08400000,
-0x00000861,0xb51462cb,0xb514b514,0xa4b2acf4,0xa4b39c71,0xad14a4b2,0x52aab555,0x08810020,0x08410000,0x18621061,0x106118a2,0x18e30000,0xdeba94b2,0xffffffff,0xce58fffe,0x000073ad,0x00000861,0x00200020,0x10610840,0x08410840,0xad340000,0xffdfffbf,0x9cb2ef3c,0x00002904,0x18821041,0x10411041,0x08201082,0x08210000,0x00001882,0xffdf9c92,0xffbfffdf,0xffdfffdf,
-0xffffffdf,0xffffffdf,0xffdfffbf,0x41a6eefb,0x08000000,0xf73c49c7,0xffdeffff,0xffdfffdf,0xbd75ffdf,0x18820800,0x00000841,0xffdfc5b6,0xffbeffdf,0xf7deffff,0xffffffdf,0xffdfffff,0xffdfffdf,0xffdfffff,0x1041ce38,0x10820000,0x5a8a0000,0xffbff71d,0xff9effbf,0xe6dbffdf,0x00002904,0x00001882,0xffbfbd96,0xff9eff7e,0xffdfffbf,0xffbeffdf,0xffdfff9e,0x5208ff3c,
-0x10820000,0x00000020,0x10820000,0x08400861,0x108110a1,0x00200000,0xef3c9471,0xffffffff,0x49c7eedb,0x10810000,0x00200000,0x10610861,0x10410800,0x29240800,0xffdfd638,0xdedaffff,0x20e38c50,0x00200000,0x18a218c2,0x00000840,0x00000000,0x08001061,0xde390800,0xff7effbf,0xffbeffdf,0xffdfffbf,0xff9effdf,0xff7effbf,0x1000834d,0x00001061,0xff7dcdf7,0xff9eff7d,
-0xff5dff7e,0x00009c31,0x006108a2,0x49e70820,0xff9df6fb,0xde79ffbe,0x08002882,0x00001021,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00200020,0x00000841,0x10000800,0x18201821,0x08410800,0x00200020,0x08410821,0x00000000,0x00000800,0x08000800,0x00000820,
-0x08610000,0x08000000,0x10000800,0x00000800,0x00000800,0x08000800,0x00000000,0x00200020,0x00000020,0x18a20861,0x00000000,0xd6ba7bae,0xffffffff,0xffdeffbe,0xffffffff,0x0000b595,0x08200841,0x08810020,0x000018c2,0x08410020,0x00000000,0xce18734d,0xffffffff,0x7bced699,0x00000000,0x10821041,0x08610841,0x00000841,0x00001041,0x94514a08,0xb514acd4,0xb534b515,
-0xbd75ad14,0xb575b596,0xbd96c5d7,0x20e39cb2,0x00000000,0x9c7120a3,0xad34b555,0xb514b534,0x49e7b534,0x10610000,0x18c20000,0xb5348c30,0xad14ad14,0xffffce38,0xffdeffdf,0xffffffdf,0xd639ff5d,0xbdd7cdf8,0x4a28b575,0x10820000,0x00001041,0x9c72732d,0x8c108c10,0x6b2c8c10,0x08001021,0x00000841,0x6b0c4a08,0x8bcf83cf,0x94318bf0,0x8bef8bef,0x94309451,0x20c37b6d,
-0x08410000,0x10a20020,0x00000861,0x10c20881,0x00000000,0xce586b6c,0xffffffdf,0xc5d7ff9e,0x10205249,0x08400800,0x08a20040,0x00000000,0x08201882,0x08001041,0xeefb7b6d,0xffffffff,0xd699ffff,0x108183ef,0x00400000,0x10a210c2,0x002010a2,0x08410020,0x5a490800,0x8bae834d,0x9c718bef,0xa492a472,0x9c719c31,0x8bcfa492,0x080028c3,0x00001061,0x6aaa49c7,0x836d732c,
-0x72ab9bcf,0x00201041,0x00610061,0x39450000,0x72eb6acb,0x52287b4c,0x10410800,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08001041,0x08400000,0x00200840,0x00000000,0x00000000,0x18a20841,0x10811082,0x188220c3,0x00200000,
-0x00000020,0x18a21061,0x10821061,0x10a218e3,0x18c31081,0x188218a2,0x08411081,0x00000000,0x10a20000,0x00000020,0xc6185289,0xffffffbe,0xffdeffdf,0xffffffdf,0x9491f79d,0x00000000,0x10a20840,0x000010c2,0x00000000,0x002010a2,0x08410020,0x08200000,0xef3c83ef,0xffffffde,0x6b4dd6ba,0x00000000,0x08810881,0x00000020,0x08410000,0x00200000,0x00000000,0x00000020,
-0x00000020,0x00000000,0x08400000,0x00000000,0x08400841,0x00000000,0x00000000,0x00000000,0x08000000,0x00000841,0x00000020,0x00000000,0x08000000,0xde5930e4,0xffdfffdf,0xffbeffdf,0x080083cf,0x00000820,0x00000000,0x00000861,0x00000821,0x00000800,0x00000000,0x00200000,0x00200000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,
-0x00000020,0x00000820,0x18c30841,0x00000000,0xc6174a69,0xfffff77d,0xef3cffff,0x080083cf,0x00200000,0x08410841,0x00000000,0x18c20000,0x00200020,0x00400881,0x41c60000,0xf79dbdb6,0xfffeffde,0xdefbf7be,0x00008430,0x08810000,0x00200881,0x00000000,0x00000020,0x00000820,0x00000000,0x08000000,0x08000800,0x00000000,0x08200000,0x08000800,0x08000800,0x08000800,
-0x08000800,0x00200820,0x00000000,0x08000820,0x00000800,0x00000000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x08410800,0x08810881,0x10810881,0x10621082,0x00000021,0x00200020,0x10810000,0x108218a2,0x00000000,
-0x00000020,0x00200000,0x10a21081,0x08c208a2,0x10a210c2,0x18c20881,0x08401082,0x08200820,0x00001082,0xa5342965,0xffffef5d,0xffdeffff,0xffffffdf,0xffdfffff,0x00007bef,0x10610861,0x00001882,0x636d0000,0x00008430,0x10610000,0x00400861,0x082010a2,0xce380000,0xf7deffff,0xf7beffff,0x5acbbdf7,0x00000000,0x00000861,0x00200000,0x10a20020,0x088110a2,0x08a108a2,
-0x10820882,0x08820881,0x00410861,0x08610882,0x00000020,0x10a20841,0x10a20882,0x086118c3,0x08611082,0x00200000,0x00200020,0x10a20881,0x20a31082,0x626a1000,0xff9ef73c,0xd659ffbf,0x08400020,0x10810861,0x002010a2,0x00200841,0x08200000,0x10821082,0x10821082,0x08611082,0x00000041,0x00000000,0x10621061,0x10a21082,0x088110a2,0x108118c2,0x18c21061,0x00001082,
-0x08210820,0x10610000,0x00000020,0xa5133185,0xffdeef3c,0xffdeffff,0xd679ffdf,0x08200000,0x084110a2,0x00001082,0x7bce0000,0xd6bace59,0x00007bef,0x08810020,0x000018c2,0xc6170000,0xffdefffe,0xfffeffde,0xc638ffde,0x00005aeb,0x08610000,0x08400000,0x08810040,0x10a210c2,0x10a210a2,0x18a218e3,0x186118a2,0x10c210a2,0x00000040,0x18821041,0x18e218a2,0x188118c2,
-0x10811081,0x00200841,0x10820841,0x10611082,0x18e210a2,0x086010a1,0x00200020,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000841,0x00000000,0x00000841,0x00000000,0x00000882,
-0x00200000,0x00200000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x10820800,0x5aeb0000,0xffffdefb,0xf7beffff,0xffdeffdf,0xffffffdf,0xe71cffff,0x08410841,0x00001081,0x52490800,0xef9dbdd6,0xc658f7ff,0x080062eb,0x08400000,0x10610841,0xe67a1000,0xf7bdffff,0xffdfffdf,0xf79effff,0x52aabdf7,0x08810000,0x00000020,0x08610840,0x10a210a2,0x10a218c3,
-0x18c318c3,0x18c310a2,0x00401082,0x00000861,0x08610000,0x10a210a2,0x086118c3,0x00410000,0x00200040,0x18c20861,0x10a210a2,0x10a218c3,0x082010a2,0x08001882,0xffdfa4b3,0x7b6eff9e,0x10a20000,0x18e30861,0x108210a2,0x188218a2,0x08411082,0x00000020,0x08200020,0x108118c2,0x086110c3,0x08200020,0x08210000,0x10610841,0x10a21082,0x088210c3,0x18c210c2,0x10821082,
-0x00000000,0x000018a2,0x8c300000,0xffffe6fb,0xffbeffff,0xffbeffff,0xd679ffdf,0x10411041,0x00000841,0x52aa0000,0xffffc638,0xffffffff,0xce79ffff,0x00005aea,0x18e21081,0xad740000,0xfffefffe,0xfffeffde,0xffffffde,0xad54f79d,0x00003165,0x00200860,0x00400000,0x00200000,0x00000000,0x00000000,0x00000820,0x00200020,0x00400040,0x00200000,0x00000000,0x00000000,
-0x00200060,0x08410000,0x00000000,0x00000000,0x00000020,0x08400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x29641081,0x4a4939e7,0x41e862eb,0x08820000,0x08410020,0x4a080000,0x4a6973cf,0x08610000,
-0x00000020,0x00000840,0x62cb5269,0x6b4c630b,0x634c6b6d,0x6b4d6b8d,0x18c34a69,0x18c20820,0x8c500000,0xffdeffff,0xffffffdf,0xf79effdf,0xffdfffff,0xe6fbffdf,0x08200000,0x10410841,0xf77d9c71,0xf7deffff,0xffffffff,0xbd76f77d,0x000031a6,0x08000841,0xe6592882,0xffffffdf,0xf75dffdf,0xffdfef3c,0xf77dffff,0x00009cd2,0x00201081,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00410000,0x00000000,0x00000841,0x00000000,0x08200000,0x00000841,0x00610020,0x00000000,0x00000000,0x00000000,0x08810000,0x00000861,0xde5920a3,0x0800bd55,0x10a20040,0x00000000,0x00000000,0x00000000,0x00200000,0x00000061,0x00000840,0x00000000,0x00000000,0x00000861,0x10410000,0x08000000,0x00000000,0x00000000,0x00000020,0x00000000,
-0x08611061,0x6b4c0000,0xffbede9a,0xffbeffdf,0xfffff75d,0xffbeffde,0xce18ffff,0x10410800,0x10a20820,0xf79ea534,0xffffffff,0xf7beffff,0xffdeffde,0x840fffbe,0x20e20000,0x9cd20000,0xffdeffff,0xe6fbfffe,0xffdfff7d,0xffdfffbe,0x5289eefb,0x10810000,0x00000020,0x21442144,0x20e32103,0x18c22944,0x00200000,0x00000000,0x08400020,0x632c0020,0x6b6c6b8d,0x29856b6d,
-0x00810020,0x00000881,0x528a20e4,0x528a528a,0x6b2c5aea,0x000028e3,0x00400861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x08001062,0xeeba93ef,0xef7de6fb,0xd69af7be,0x00002965,0x08610881,0x730c0800,0xef7df79e,0x00005acb,
-0x00001082,0x08001082,0xf73d8bef,0xf75dff9e,0xf7def7be,0xffdeffff,0x5aebe73c,0x20e30000,0x7b8e0800,0xffdfffdf,0xd638f75d,0x7b6e8bef,0xff5dc5b7,0xd659ffdf,0x20820800,0x4a080800,0xfffff77d,0xf7deffde,0xffdff7be,0xffffffdf,0x0000b5b6,0x000010a2,0xf69b2041,0xff3dffbf,0x6249c535,0xbd555228,0xffdff71c,0x0000d659,0x00001061,0x8c101882,0x9cf3a4f3,0xa4d39cb2,
-0xa534a514,0xad35ad35,0x00007bcf,0x08410841,0x31860000,0xb596a555,0x738eb576,0x08820000,0x000008a2,0xad345aaa,0xb575bdb6,0xad95b5b6,0x00007c0f,0x10820861,0x31450800,0x00002904,0x000010a2,0xad3441e7,0xb5b6ad75,0xc5f7bdb6,0x0000a4f3,0x10820000,0x52690000,0xbdb6c5d7,0x4a48ad54,0x08610000,0x00000861,0xc5d79c72,0xbdd6c5b6,0xadd6add6,0xb5b6adb6,0x5229b535,
-0x18c30000,0xb5950000,0xff9effff,0x9c71e6db,0xbd966b0c,0xffffff9e,0xbdb6ffdf,0x10820800,0x94b20000,0xffffffff,0xffbeffff,0xffffffde,0xffbeffff,0xbd95ffff,0x18c20000,0xa4d20800,0xffbeffff,0x5a29cdd7,0xddd772ab,0xffbfff7e,0x6b0cff7d,0x18a20000,0x9cd20000,0xdedadefb,0xdedadeba,0xd6b9d6da,0x6b0bce58,0x10820000,0x00001082,0xf7be630b,0xffffffff,0x41c7e6db,
-0x08810020,0x00200000,0xf79ebdd7,0xf75def5d,0xf71cff7d,0x080049a6,0x00000841,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x10001082,0xff5d7aab,0xf7fefffe,0xfffff7fe,0x0000a514,0x084010a2,0x18211841,0xffdfc596,0x0000ce18,
-0x08610000,0x08200841,0xd6381841,0xffdfffbf,0xffffffff,0xffffffff,0x6b8dffff,0x18e30000,0x734d0000,0xcdf7f71c,0x1021732d,0x08000800,0x6acb0800,0xcdf8d639,0x18410800,0x5a491000,0xfffff77d,0xffffffff,0xffdfffff,0xffffffbe,0x18e3d6ba,0x08000000,0xde182041,0x6a8ad5d7,0x08001000,0x08000800,0xc5965208,0x0800b575,0x00000841,0xef1c20c3,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0x00209d13,0x18c21062,0x9cf30000,0xffffffff,0x83efffff,0x10a20000,0x18e30000,0xffffce59,0xffffffff,0xffffffff,0x5b0bf7be,0x10a20000,0x00001061,0x10610000,0x00001081,0xffffb575,0xffffffdf,0xffffffff,0x7bcfffff,0x18a20000,0x29240000,0xffffe6db,0xb5b6ffff,0x08810020,0x000010c2,0xffdf9451,0xffffffdf,0xf7fff7ff,0xfffff7ff,0x9c31ffdf,
-0x18c30000,0xc5f70000,0x9cb2f75d,0x00003124,0x00000000,0xc5f76b0b,0xad34ffdf,0x20e30000,0xbdd60000,0xfffeffff,0xffffffdf,0xffffffff,0xffffffff,0xb575ffdf,0x18c20000,0x8c100000,0xacd3eefb,0x10002061,0x20211000,0xde398b8e,0x49e7eedb,0x10810800,0xce790000,0xffffffff,0xffffffff,0xffffffde,0x3965e6db,0x10610800,0x00000841,0xffffc618,0xffdfffbe,0x0800a4b3,
-0x10a21081,0x7bef0000,0xffffffdf,0xffdfffff,0xcd96ffbf,0x10402062,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20620821,0xe5b73821,0xf7fefffe,0xffdef7fe,0x6b4cffde,0x10a20000,0x10001882,0xff1d728b,0x9492ffdf,
-0x10a20000,0x18820800,0x5a6a0800,0xfffff75d,0xffdfffdf,0xffffffff,0x6b8defde,0x18a20000,0x29240000,0x08205269,0x08410000,0x18a21882,0x00001061,0x4a081041,0x10410820,0x5a8a0800,0xffdff79e,0xf7ffffff,0xffffffff,0xffffffff,0x39c7df1b,0x10610000,0x41c71041,0x08001020,0x10821862,0x108110a2,0x08000000,0x10613165,0x08001020,0xe6bb1841,0xffdfffff,0xffdfffff,
-0xffdfffdf,0xe6daffdf,0x000031a6,0x000018c3,0xf79d528a,0xffffffff,0x0000ce38,0x18c20841,0x8c300800,0xf7deffff,0xffdfffdf,0xf7beffff,0xc658ffff,0x10810000,0x08610840,0x10611061,0x840f0000,0xffbeffde,0xffdfffff,0xffdfffff,0xe73cffff,0x00002124,0x000018c3,0xff7d732c,0xf7deffdf,0x00205b2b,0x084010c2,0xce180820,0xffdeffff,0xf7fff7de,0xffdef7fe,0x8bafffbf,
-0x10820000,0x62eb0000,0x00004a28,0x18a20000,0x106118a2,0x10410800,0x52697b8e,0x00000000,0xce781081,0xfffeffff,0xffffffde,0xffffffff,0xffdfffff,0xc5d7ffff,0x10a20000,0x39a60000,0x000041e7,0x18810800,0x08401881,0x18a20000,0x18825248,0x00000000,0xd6990000,0xffdeffff,0xfffff7fe,0xffbeffbe,0x08007b8e,0x108218a2,0x7bcf0000,0xffbeffdf,0xe6bbffdf,0x08003925,
-0x000020a2,0xef9d4228,0xffffffde,0xffdfffde,0x7aabff7e,0x18810800,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20610841,0xabef3000,0xf7ddffbe,0xf7deffff,0xce79ffdf,0x00200020,0x080018a2,0xfedc40e4,0xe73cffdf,
-0x00004a48,0x08001061,0x00001041,0xffbfad14,0xffffffbf,0xffffffdf,0x6b8df7de,0x10810000,0x00000000,0x00000000,0x108218a2,0x18a21061,0x10821061,0x00000000,0x18620800,0x526a0000,0xfffff75d,0xfffff7be,0xffffffdf,0xf7deffff,0x39c7efbe,0x10610000,0x00000000,0x18a20800,0x10811082,0x00400881,0x10611061,0x00000000,0x08001041,0xeefc3104,0xffdfffdf,0xffdfffff,
-0xffffffde,0x9cb2ffdf,0x18c20000,0x00000840,0xffdece58,0xffdeffff,0x0820736d,0x000018c2,0xf75d4a28,0xffffffff,0xf7ffffff,0xffffffff,0xf77dffff,0x0000738e,0x00001082,0x00001061,0xde9a3985,0xffffffff,0xffffffdf,0xffffffff,0xfffff7ff,0x0000a534,0x10611081,0xcdf70800,0xffffffff,0x0040be17,0x10a20861,0x6b0c0000,0xffdfff9d,0xefdeffff,0xffdeffff,0x93f0ff7e,
-0x10a20000,0x00000020,0x10820000,0x18a21041,0x10811882,0x08201882,0x00000000,0x000018a2,0xdefa2924,0xfffef7fe,0xfffeffff,0xffffffde,0xff9effff,0xcdf8ffdf,0x08610000,0x00000861,0x10a20000,0x10811061,0x08810840,0x00001903,0x00000020,0x00001061,0xdeda1061,0xffffffff,0xffdefffe,0xcdf7ffde,0x10201861,0x08201041,0xce790000,0xffdfffff,0x93f0ff5d,0x20611000,
-0x00001861,0xffffbdf7,0xffffffff,0xffdfffde,0x3883edf8,0x08401020,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200820,0x59a62000,0xffdfee9a,0xffdfffde,0xffbeffde,0x00008430,0x08400881,0xee9a2061,0xffffffde,
-0x0000ad34,0x00200881,0x08001061,0xde592082,0xffbeffdf,0xffffffbe,0x6b4dffdf,0x18c20000,0x10610820,0x18c31061,0x00000020,0x00000000,0x10811081,0x10820841,0x10610000,0x41e80800,0xffdfeedc,0xffffffff,0xffffffbe,0xfffff7de,0x4a48ffde,0x18a20000,0x08a20000,0x10610861,0x00000000,0x10a20000,0x08410841,0x08200861,0x00001061,0xef1c3986,0xf7beffff,0xffffffbe,
-0xffdfffff,0x3985e6ba,0x18a20000,0x7bae0820,0xffffffbe,0xdedaffff,0x08200820,0x00001081,0xffffb575,0xf7deffde,0xf7fff7ff,0xffffffff,0xffffffbe,0x3185defb,0x10610000,0x00001082,0xffff8c10,0xffffffde,0xffdfffff,0xf7ffffff,0xf7fff7ff,0x31a6ef5c,0x18c20020,0x7b6d0000,0xfffef7bd,0x73ceffde,0x10a20000,0x00001081,0xffffc5d6,0xffdef7be,0xffdfffdf,0x732dffbe,
-0x10820000,0x10820020,0x10611081,0x000018c2,0x00000000,0x10811081,0x084118a2,0x00000841,0xe6fa3144,0xf7fefffe,0xf7fefffe,0xfffffffe,0xffdfffbf,0xacb3ffdf,0x10820000,0x08610000,0x188218a2,0x00001040,0x00200000,0x10a20000,0x00201081,0x00000840,0xef3c20e3,0xffdeffff,0xffdfffde,0x6269ff3d,0x20a20800,0x00001862,0xffff8c30,0xf7def7ff,0x8bf0ffdf,0x20c30800,
-0x6b4c0000,0xfffff7de,0xffdeffde,0xffdfffbe,0x1800ac31,0x004020c2,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20002882,0xff7eb472,0xffbeff9e,0xffffffde,0x0020ad54,0x00001903,0xff7d7b8d,0xf7deffff,
-0x630bef7d,0x08810040,0x18a20000,0x7b2d0800,0xffdfff7e,0xff9effbf,0x2904acf3,0x08200000,0x00000000,0x000018c3,0x94b20000,0x528ab5b6,0x00000020,0x08411082,0x00000000,0x10410000,0xbd765a6a,0xffdff75d,0xff9effdf,0xf79dffff,0x18c2ad75,0x08610000,0x08810020,0x00000020,0xb575630c,0x00204a28,0x08610000,0x00000841,0x08200020,0x738e0000,0xffffde9a,0xffbeffff,
-0xffdeffbe,0x00008c10,0x000018a2,0xdeba2103,0xffbeffff,0xef3cffff,0x00003165,0x00001061,0xffbec5d7,0xffffffff,0xf7fff7ff,0xffffffff,0xffdfffff,0x3986f75d,0x10610000,0x00001082,0xff7d6b0c,0xffdeffbe,0xffffffdf,0xffffffff,0xfffff7be,0x0000ad34,0x10810840,0x734d0820,0xffdeffff,0xe6fbffff,0x00003165,0x000018a2,0xe6fb4a07,0xffdfffde,0xff9effdf,0x28e4bd55,
-0x08410000,0x00200000,0x000018a2,0x42280000,0x738d9cd2,0x00000000,0x08611082,0x08200841,0x83ce0820,0xfffed699,0xffffffff,0xffdef7be,0xf71cffdf,0x100193f0,0x08000800,0x08610000,0x000018a2,0x83ef0000,0xce18de9a,0x00006b4c,0x10810000,0x08610020,0xa4f30000,0xffdff77d,0xffdfffdf,0x0800bd55,0x10411882,0x39860000,0xffffef1c,0xf7bef7fe,0xe6baffff,0x08202924,
-0x5aeb0000,0xffffef9d,0xfffef7bd,0xe679ffff,0x100030c3,0x00200840,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10001841,0xf69b3082,0xffffffdf,0xef1cffdf,0x00004228,0x00200881,0xffffc638,0xf7bef7be,
-0xdedaffff,0x00003185,0x08001081,0x08001882,0xff5eb4d4,0x6b0ce65a,0x00000000,0x00001081,0x00200820,0x4a480000,0xffffbe17,0xef9dffff,0x3a07adb6,0x00000020,0x00000861,0x08200000,0x08000000,0xc5b76acb,0xff7eff5d,0x7b6dde59,0x00000020,0x00000040,0x00000861,0xa4d30800,0xfffff79e,0x94b2e73c,0x00000881,0x08410881,0x08410000,0x08000000,0x9c722904,0xffbfeefc,
-0xce38ffdf,0x08400000,0x000018e3,0xffffa513,0xffdeffff,0xffffffff,0x000094b2,0x00002103,0xff5d5a69,0xf7deffde,0xfffef7de,0xffffffff,0xffbfffbf,0x0800a492,0x00201882,0x10610841,0xb5340800,0xffdeffff,0xffdfffff,0xf7bef7be,0xce18ffff,0x08001841,0x08401882,0xc6380000,0xff9effdf,0xffdfffbe,0x0000ad34,0x18a218a2,0x732c0000,0xffbfff9e,0x730ccdf7,0x00000800,
-0x00000841,0x08610861,0x29440000,0xe75ca513,0xf7beffff,0x6b2cc617,0x00000000,0x08200820,0x00000820,0x9cb23144,0xffffe6db,0xff7dffdf,0x5a6ac5b7,0x08000800,0x08001021,0x00001061,0x73ef0000,0xffffce79,0xffffffde,0xbdd6ffbe,0x000031a6,0x004010a1,0x00000000,0xc5b76aeb,0xde39ff3d,0x00004186,0x18a21061,0xb5550800,0xffdeffde,0xf7deffff,0xfffff7de,0x08008c30,
-0x000018c2,0xffffb5d6,0xffbdf7bd,0xac92ff9e,0x20a21000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20820800,0x8b8e1000,0xe6dbeebb,0x8c51ff7e,0x21030000,0x5aeb0000,0xffffffde,0xffdfffbe,
-0xffffffdf,0x0020ad34,0x002010a2,0x08000841,0x8b8f3925,0x08003925,0x08411081,0x08410000,0x00000840,0xef5c840f,0xf7beffff,0xfffff7de,0xdf3cffff,0x18e38c91,0x08810000,0x00000000,0x10621082,0x08000800,0x93f07b4d,0x08001841,0x08810840,0x08810040,0x41c70000,0xffdfc5f7,0xffdfffff,0xffffffff,0x634cceba,0x00200000,0x00000841,0x18820841,0x08000800,0xad144186,
-0x6b2cdeba,0x18c30000,0x4a490000,0xffffe71c,0xffdfffde,0xffffffbe,0x10a2d699,0x18820000,0xb5140800,0xffffffdf,0xffffffdf,0xffbeffbe,0xe6dbffff,0x080028e4,0x08411062,0x08610000,0x41a60800,0xffdfeefc,0xffbfffff,0xffdfffdf,0x628aff5d,0x18820800,0x08001861,0xffde840f,0xffbeff9e,0xffdeffdf,0x52aaf77d,0x18a20000,0x00001882,0x9c719410,0x08001862,0x10411041,
-0x00200820,0x00000000,0xe71b738e,0xffffffff,0xf7deffff,0xffbeffff,0x2945a514,0x08410000,0x18a20840,0x08000000,0xb53441a6,0x8bcfd618,0x00001842,0x084118a2,0x10410800,0x21240000,0xef9da554,0xffffffff,0xffbeffde,0xffffffff,0x4227d6ba,0x08400000,0x10610841,0x10000800,0x49c76aab,0x10820000,0x00001081,0xef3c5269,0xffdfffff,0xffffffff,0xffdeffde,0x20c3de99,
-0x00000840,0xffff738d,0xffffffde,0x4145eeba,0x10610000,0x00000000,0x00000040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400820,0x00000020,0x49e82904,0x08004a29,0x08001061,0x41a60800,0xbd558bef,0xfedcee7a,
-0xff9eff1d,0x5b0bf77d,0x08c20000,0x08400000,0x00000000,0x10a20000,0x00000841,0x10a20040,0x83ef0000,0xffdeffde,0xffffffdf,0xffffffde,0xffffffdf,0x5aebf7be,0x08410000,0x08200820,0x08210000,0x084110a2,0x08000000,0x18820800,0x00000820,0x10a20020,0xc5b70800,0xffdeffff,0xffffffff,0xffdfffff,0xffffffff,0x0000ad75,0x08200821,0x00000000,0x10621021,0x00000000,
-0x080020a3,0x08411061,0xc5b70800,0xffdfffdf,0xffffffdf,0xffffffff,0x736df79e,0x18a20000,0x52080800,0xff1cde18,0xff9eff3d,0xffdfff9e,0x9cd3ffdf,0x10a20000,0x08610861,0x00400861,0x000010a2,0xf6bb8bf0,0xfefcf6bb,0xfefcfefd,0x08009c31,0x086118c3,0x31450800,0xff9ef71c,0xffbfffdf,0xffdfffdf,0xc638f7de,0x08610020,0x18620820,0x00000800,0x10820000,0x00000821,
-0x18c30000,0x7bcf0000,0xfffff7be,0xffffffff,0xffdeffff,0xffdeffff,0xbdb6ffff,0x08400800,0x10a20000,0x188218a2,0x00000000,0x08001041,0x18821061,0x10a21081,0x10610820,0x94910000,0xffffffff,0xffffffdf,0xffffffff,0xffbeffde,0x9471ffbe,0x18a20000,0x10820000,0x10612103,0x00000000,0x004010a2,0x00000061,0xffffc637,0xff5dffbe,0xcd76c535,0xc575c575,0x31039c50,
-0x08000000,0x83ef1081,0xacd3b534,0x10006a8a,0x00001041,0x08000800,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x08610040,0x00000000,0x08210000,0x08000820,0x08001020,0x08000800,0x30832842,
-0xcdf86229,0xc638ffff,0x00400020,0x00200020,0x10820841,0x00400861,0x00200840,0x10a20040,0x9c920000,0xffffffff,0xffffffdf,0xffffffdf,0xffdfffdf,0x6b6dffdf,0x18a20000,0x08210000,0x08411082,0x00400020,0x08810881,0x10611061,0x08400840,0x08400840,0xd6390800,0xf7deffdf,0xffffffdf,0xffffffdf,0xfffff7df,0x3986ef5d,0x10620000,0x08410000,0x08201061,0x10820861,
-0x08000800,0x00001882,0xff9e6b0c,0xffdfffdf,0xb555ffbe,0x9c929c92,0x4a498c30,0x10210000,0x08001041,0x62292862,0x836e72cc,0x8c109410,0x31a69471,0x10a20000,0x00000000,0x00400020,0x08410020,0x28620800,0x306330a3,0x49464926,0x08211000,0x00400020,0x31450000,0x8bcf7b4d,0x83ae8bcf,0xf79da4d3,0xf7beffff,0x00008430,0x082018a2,0x10821082,0x08610861,0x084110a2,
-0x10610841,0xb5960000,0xffdfffff,0xffffffff,0xffffffff,0xffdeffde,0xbdb6ffff,0x10410000,0x00001082,0x18a20000,0x108218c2,0x10821061,0x18a21061,0x00000000,0x10810861,0x94b10000,0xffffffff,0xffffffff,0xffffffff,0xffdeffff,0x9471ffde,0x10820000,0x00001061,0x00200000,0x18a218c2,0x10c20000,0x7c2f0020,0xffdef7de,0x9c30ff9d,0x18001000,0x08001000,0x08000800,
-0x08200820,0x00000000,0x08000000,0x18410800,0x00000000,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00200000,0x08610861,0x084110a2,0x08200020,0x10410000,0x082118a2,0x08001041,
-0x49e80800,0xffbeef3c,0x00007bce,0x082018a2,0x00400000,0x00000881,0x00200000,0x10a20840,0xa4d30000,0xffffffff,0xffffffdf,0xffffffde,0xf7deffff,0x73aeffff,0x10820000,0x00000841,0x08400000,0x00400881,0x08810040,0x00001882,0x08410000,0x08410840,0xcdd71000,0xffbeffff,0xffffffff,0xf7ffffff,0xf7fff7ff,0x41c7ef3c,0x10410800,0x00000820,0x10820000,0x00200861,
-0x08201061,0x20e30800,0xffbed639,0xffdfff9e,0x0000ad34,0x00000000,0x00000020,0x08000820,0x08210000,0x08000800,0x00000800,0x00000000,0x00000000,0x00001082,0xad750881,0x000062eb,0x00201081,0x08001061,0x08000800,0x00000800,0x08410821,0x00200000,0x00000841,0x00000000,0x08000800,0xad140800,0xffdeffff,0x41e7ef3c,0x10610000,0x08410820,0x000018a2,0x00000000,
-0x10410841,0xbdf70000,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xce38ffdf,0x10610800,0x5aca0000,0x00005269,0x08400000,0x10a210c2,0x00000000,0x630b4a48,0x10810000,0x94910000,0xf7deffff,0xffffffff,0xffdfffff,0xffdeffff,0x83ceffbe,0x18c20000,0x6b4c0000,0x00007bce,0x00200000,0x00000882,0xd69931a5,0xffbeffff,0x2000bd13,0x18621841,0x10821061,0x08411061,
-0x00200000,0x10a20020,0x10820861,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x08610000,0x108218c3,0x18c318a3,0x108210a2,0x10820021,
-0x000020c3,0xffdf9cb2,0x3966e6db,0x08200000,0x10820841,0x00200000,0x000018c3,0x10820020,0xb5550000,0xffdfffff,0xffdfffdf,0xffdfffdf,0xf7beffff,0x738dffde,0x18a20000,0x29450000,0x0000630b,0x08610020,0x00200061,0x62eb0000,0x00004a49,0x10410861,0xde7a1021,0xffbeffdf,0xffffffff,0xffdeffff,0xf7fff7de,0x5a8af77d,0x18620000,0x31a60000,0x00000000,0x10810000,
-0x10810020,0x39860000,0xffbfe6db,0xd679ffdf,0x08201041,0x18c318e3,0x108118e3,0x08410861,0x00200020,0x10611041,0x18a30861,0x18a218a2,0x10a210e3,0x00000861,0xffffa554,0x0000ce58,0x08410840,0x08610020,0x08410841,0x10821082,0x00000020,0x00200000,0x08210000,0x18c318c3,0x20c318a2,0x10411041,0xffffd679,0x41e7ef1c,0x10810000,0x00001081,0x31650000,0x52699471,
-0x10410000,0xbdf70820,0xffffffff,0xfffff7de,0xffffffff,0xffbef7be,0xce18ffdf,0x10411021,0xbdf60000,0xbdb5f75c,0x0000632b,0x00200020,0x9cb22924,0xce37f75c,0x18c20840,0x83ce0000,0xffffffde,0xfffff79e,0xffdff7bf,0xffdeffbe,0x7baeffbe,0x10a20000,0xc6380000,0xd699fffe,0x002083ee,0x00000020,0xff9d528a,0xacf3ffde,0x18202040,0x00001841,0x10e30861,0x10821904,
-0x10a21082,0x00000861,0x08410020,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00200000,0x00000000,0x00000841,0x00000000,0x00200000,0x00000020,0x00000861,
-0x00000841,0xef1c1882,0x2904de9a,0x10a20000,0x00000861,0xb5b62124,0x00007c0f,0x10611082,0x52490000,0xffbfcdd7,0xffbfff9e,0xff9effbe,0xffdfffbe,0x3145cdf8,0x18a20000,0x62ab0000,0xce79f77d,0x00006b4d,0x6b6d0000,0xf79ec617,0x0000ad54,0x082010a2,0xc5d70800,0xffbeffff,0xffffffdf,0xffffffde,0xffffffde,0x4a49ef7d,0x10a20000,0xa5130000,0x8c50deda,0x00002124,
-0x00400040,0x00001082,0xffdf9451,0x5229e69a,0x18820800,0x08411061,0x00000000,0x00000000,0x08410020,0x00000000,0x00000020,0x00000800,0x10c20020,0x7bef0020,0xffffffff,0x83efffff,0x18c20020,0x108110a2,0x08400020,0x00000000,0x08410020,0x10821082,0x10820861,0x08410000,0x00200861,0x000018a2,0xeedb62ab,0x080083cf,0x10810861,0x00000000,0xdefb9491,0x7b8effbe,
-0x10a20000,0xc6380000,0xf7beffdf,0xf7beffff,0xfffff7be,0xffdeffdf,0xb575ffff,0x08000800,0xdeb92103,0xffdeffff,0xd699ffde,0x947183ef,0xffdee6fb,0xde79ffdf,0x10201061,0x5a690000,0xff9ee69a,0xffffffdf,0xffffffdf,0xf73cffdf,0x2904acb2,0x10810820,0xce580000,0xffffffff,0xb554ffff,0x10411021,0xa4f30000,0x1881b575,0x10400820,0x10610000,0x00200020,0x00000000,
-0x00000000,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x10620000,0x29450000,0xa5148c51,0x8c919cf3,0x5aeb8c71,0x08410020,
-0x10610000,0x7b6d0000,0x000062eb,0x08610861,0x84300000,0xffffdefb,0x00009cf3,0x000018c2,0x08001061,0xa4512062,0xff7ef6dc,0xffdfffdf,0xa492ff7d,0x080028e3,0x18621041,0x732c0800,0xfffff79e,0xbdd6f7be,0xf7bec638,0xffffffff,0x0000ad54,0x086118c3,0x39a60000,0xf75dad14,0xffbeffdf,0xffffffff,0xde9aff9e,0x08408c50,0x08610861,0xc6380000,0xffdfffdf,0x73aededb,
-0x08610020,0x00000861,0xb5550820,0x08008bef,0x080018a2,0x00000000,0x00400020,0x18e310c2,0x00000020,0x00001061,0x08410000,0x00000000,0x00000000,0xef5c4207,0xf7beffff,0xdebaffff,0x00000861,0x00200000,0x00000000,0x00200020,0x00000841,0x00000000,0x00000000,0x00200000,0x00000000,0x08200841,0x39450800,0x08201000,0x00200881,0xbe371903,0xffffffff,0x7b6dffbe,
-0x18c30000,0x6b4c0000,0xffdfd699,0xffdfffff,0xffdfffff,0xde9affbf,0x29249cb2,0x00000020,0xef3b41e6,0xfffeffde,0xffffffde,0xffffffff,0xffbeffff,0xdebaffbe,0x080028e3,0x08001881,0xa4714186,0xffbee6bb,0xeefcffbf,0x5a49bd55,0x08000800,0x00001061,0xd6da0860,0xf7beffff,0xffdeffde,0x08008bcf,0x08401041,0x00000820,0x00000860,0x00001081,0x94b252aa,0x7bef8430,
-0x6b2c6b2c,0x000020e3,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0xcdf80820,0xffdfffff,0xffffffff,0xe75cffff,0x00004a48,
-0x00001082,0x000018a2,0x10810000,0x00001082,0xffdf6b2c,0xffffffff,0x0000a513,0x00200861,0x18a20000,0x08000800,0xacb33105,0xc576f6dc,0x00005208,0x08610000,0x18a20000,0x9c720800,0xffdeffdf,0xffffffff,0xffdfffff,0xffffffff,0x0020a514,0x00201081,0x08200841,0x5aaa0000,0xff7ed5f7,0xb514eedb,0x1861732c,0x00000000,0x08000840,0xce181000,0xf7deffff,0xe75cffff,
-0x000031c6,0x08610840,0x00000800,0x10610000,0x08201082,0xdedb738d,0xdf1bd6ba,0xe73cdf1b,0x08a1c638,0x08610000,0x00001081,0xdeba8c10,0xce79deda,0xffffe71b,0xffffffff,0xffffffff,0x9cf3c617,0xa514ad75,0x000041c7,0x08001862,0x31650000,0xc617bdb6,0xce79c618,0xdefbd69a,0x00009cf3,0x08200861,0x08001841,0x00001020,0x000010c2,0xffff94f3,0xffdeffff,0x6b0cff9e,
-0x08810000,0x00000840,0x7b6e1041,0xff9ee69a,0xbd15f6db,0x20a37b2d,0x08200000,0x00001082,0xf79c39c6,0xffdefffe,0xffffffdf,0xffffffff,0xfffff7be,0xef1cffff,0x00003985,0x080018a2,0x08000000,0x8bae2082,0x49e89c30,0x00000800,0x08401082,0x00001061,0xf79d4a48,0xf7fff7fe,0xfffff7fe,0x1820e679,0x10810000,0x08610840,0x10810020,0x39c60000,0xffdee71b,0xffbeffff,
-0xff9eff7d,0x1040bdb6,0x08400820,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08001041,0xd6791021,0xffdfffff,0xffdef7de,0xffffffff,0x0000ad75,
-0x10411061,0x10810000,0x08400861,0x21240000,0xffffd69a,0xffdfffbe,0x0020b596,0x10a210c2,0x08210041,0x18820820,0x08000800,0x10001842,0x10610800,0x00000841,0x000018c3,0xe6db20c3,0xffffffff,0xffdfffff,0xfffff7be,0xffffffff,0x0000b5b6,0x108218c3,0x08410000,0x080018a2,0x72cb1000,0x080049e7,0x10000800,0x08401081,0x082018a2,0xe6ba1841,0xffdeffff,0xfffffffe,
-0x00009cf3,0x000018a2,0x10820840,0x08610861,0x00000020,0xffffd699,0xffffffff,0xffffffdf,0x9d13ffff,0x10a20000,0x000010a2,0xffbe62eb,0xffffffff,0xffffffff,0xffdeffde,0xffffffff,0xffffffff,0xce58ffdf,0x08201061,0x18820820,0xad140800,0xffffffff,0xffffffff,0xffdfffff,0x73ceffff,0x18c20000,0x10410000,0x10810820,0x42280000,0xffffe75c,0xffffffde,0x6b4dffbe,
-0x18e30000,0x10820020,0x08000800,0x8baf28a3,0x08004987,0x08000800,0x00201082,0x002010c2,0xfffe6b6c,0xffffffff,0xffffffff,0xfffff7ff,0xffdfffff,0xffdeffde,0x0000a4d3,0x10610000,0x18821041,0x08000800,0x08000800,0x10820841,0x08400000,0x000020e3,0xffde83ef,0xeffeffff,0xf7deffff,0x9410ffbe,0x18a20800,0x00200820,0x08410841,0xc6170000,0xffffffde,0xffbeffbe,
-0xffdfffbe,0x18a2de79,0x08410000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x18620000,0xa4b20800,0xffbeffde,0xffffffff,0xffdfffdf,0x39e7ef7d,
-0x10610000,0x00200000,0x18c30040,0xa4f30000,0xffbeffff,0xffffffdf,0x5acbdedb,0x00000000,0x00000882,0x00200020,0x10820861,0x10610000,0x08211882,0x10610000,0x00200000,0xffffbdd6,0xffdfffdf,0xffffffff,0xffffffff,0xffffffff,0x6b6def5d,0x00000000,0x002010a2,0x18820820,0x00000820,0x10610840,0x10411882,0x10820000,0x00000000,0xf73d83af,0xffffffbe,0xffffffbe,
-0x3185e6fb,0x10810000,0x00200000,0x10820020,0x8c500000,0xffdeffff,0xffbeffdf,0xffbeffff,0xe73cffff,0x000041e7,0x08201081,0xce380000,0xffdeffff,0xffdfffff,0xffffffff,0xfffff7de,0xffbeffde,0x630bf77d,0x10a20000,0x00000881,0xef9d39e7,0xf7beffff,0xffffffde,0xffdfff9e,0xe71bffff,0x00003185,0x00001081,0x10810000,0xad750000,0xffffffff,0xffdfffff,0xce38ffff,
-0x00000000,0x00201061,0x18a20841,0x00000000,0x10610000,0x106118a2,0x10810820,0x00000000,0xf7ddce58,0xf7deffff,0xffffffff,0xf7ffffff,0xfffff7df,0xffffffde,0x9cd3ffbe,0x00000000,0x08410841,0x10a10841,0x084118c2,0x00000841,0x00000841,0x39e60000,0xfffec617,0xffffffff,0xfffff7de,0xde79ffde,0x08002082,0x00001021,0x000010a3,0xf7dd8450,0xffbeffff,0xffbeffde,
-0xde38ffbe,0x08005228,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x10610000,0x08000800,0xffbead14,0xffbeffde,0xffdfffdf,0xa534ffff,
-0x10610000,0x00200020,0x00000861,0xce590000,0xffdfffff,0xffdfffdf,0xf79dffff,0x4a69ad95,0x08610000,0x00200000,0x00000040,0x00410861,0x08200000,0x08001021,0xce5962ab,0xffffffdf,0xffffffff,0xffffffff,0xffdfffff,0xffffffff,0xf79effff,0x0000acf4,0x08820000,0x00000800,0x10c20841,0x08400061,0x08000000,0x00001061,0xb57541e7,0xffffef3c,0xffdfffbf,0xffdfffff,
-0x9cd3ffff,0x10a20000,0x00200020,0x00000841,0xdefb2944,0xffdfffff,0xffffffff,0xffffffdf,0xfffffffe,0x0000ad34,0x18a21081,0x94710000,0xffdeffff,0xffffffff,0xffffffff,0xfffeffff,0xffffffde,0x5269f77d,0x10810020,0x00001081,0xffffad95,0xffdeffff,0xffdfffff,0xffffffdf,0xffffffde,0x00009cd2,0x00001081,0x00001081,0xef5d528a,0xffdeffff,0xffffffff,0xffdeffdf,
-0x5a8ad679,0x08410000,0x00000840,0x10a20861,0x00200861,0x00200000,0x00000840,0xd69a738e,0xfffeffff,0xffffffde,0xffffffff,0xffffffff,0xffdfffff,0xffdfffdf,0xffdeffbe,0x4a28de99,0x08610000,0x00000000,0x00200000,0x08410000,0x08200021,0xf79da513,0xffffffff,0xffdfffdf,0xffdeffff,0xffbdffde,0x1000628a,0x10621861,0x528b0000,0xfffeef5c,0xffdef7dd,0xffbeffff,
-0x3104e679,0x10610800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10410820,0xc5b61861,0xffdfffdf,0xffbeffbe,0xce58ffff,
-0x000018c3,0x08400841,0x08410841,0xf7bead54,0xffdfffff,0xffffffbe,0xffffffde,0xf79dffff,0x0000a4f3,0x00400041,0x00200020,0x00200020,0x00200020,0x08001061,0xff9ea492,0xffdeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffdf,0xdebbffdf,0x00004228,0x08001061,0x00400020,0x00200000,0x08410841,0x94510800,0xffdff75d,0xffffffdf,0xffffffff,0xf7dfffff,
-0xef5cffff,0x00005acb,0x08201061,0x10610820,0xb5550800,0xffffffdf,0xffffffbe,0xffffffff,0xffdeffde,0x2924deba,0x18c30000,0x7bae0800,0xffffffdf,0xffffffdf,0xffffffff,0xffffffff,0xfffefffe,0x73adffde,0x10a20020,0x10810020,0xffdedefb,0xffffffff,0xffffffff,0xffffffff,0xffffffde,0x2904e6fb,0x08410000,0x00001081,0xf7be738e,0xfffff7de,0xffffffff,0xffdeffde,
-0xff7effdf,0x00008bef,0x08201061,0x00200000,0x00000020,0x08410020,0x00000841,0xde9a83af,0xffdeffbe,0xffffffff,0xffffffdf,0xffffffff,0xffffffdf,0xffffffbf,0xff7dffbe,0x3186b534,0x08810000,0x08200000,0x08000000,0x00210821,0x10620020,0xe6ba8bef,0xffbeff9d,0xffdfffff,0xffdeffff,0xde78ffff,0x10001821,0x10821041,0x732d0000,0xfffef79d,0xffdef7dd,0xff3cffff,
-0x08006269,0x080020a3,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10410820,0x52081000,0xffdfeebb,0xffffff9e,0x31a6bdd6,
-0x08400000,0x10411061,0xa5140000,0xffbeffff,0xffbfffff,0xffffffff,0xf7deffff,0xffdfffff,0x00009cb3,0x00410881,0x10820000,0x00200841,0x00200000,0x18620000,0x7b4d1000,0xffdfeedb,0xffffffff,0xf7beffff,0xffffffff,0xffffffff,0xffffffbf,0xd639ff7e,0x0000528a,0x08001041,0x00200000,0x00000020,0x08410861,0x94100000,0xffbfff5d,0xffffffdf,0xffffffff,0xffffffff,
-0xffffffde,0x0000a514,0x08201082,0x10210800,0x41c70000,0xffdfe6fb,0xffffffff,0xffffffdf,0xffffffdf,0x00009cb2,0x10611061,0xa4d30800,0xffdfffff,0xffdfffdf,0xffffffff,0xffffffff,0xfffefffe,0x840fffff,0x18e20000,0x000018a2,0xffde8c30,0xffdeffff,0xffffffde,0xffffffff,0xffffffdf,0x0800bd75,0x08200840,0x00000820,0xce5818c2,0xffdeffff,0xffffffdf,0xffffffde,
-0xbd96ff7d,0x00004a08,0x00001061,0x00000820,0x00200020,0x00000861,0x08200000,0x18820000,0xe6da9c71,0xfffff79d,0xffffffff,0xffdfffdf,0xffffffdf,0xff9effbe,0x6aeceeba,0x00000800,0x00200861,0x08200000,0x108118a2,0x08610861,0x00000020,0x10200000,0xf73c8c0f,0xffffffbe,0xfffff7de,0x9c91ffde,0x20a21000,0x00200000,0x00001062,0xf7bd7bce,0xffdefffe,0x8baeff7d,
-0x28a20800,0x00000800,0x00000820,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10200820,0x180028a3,0xff3d93cf,0xcdf7ffdf,0x00200000,
-0x00200061,0x10410020,0x6b0c0800,0xffffef1c,0xffffff9e,0xffffffde,0xfffff7de,0x62ebe71b,0x08610000,0x08200820,0x00001082,0x10a20000,0x00000861,0x08410020,0x08001061,0xfefc6229,0xffdeffff,0xffffffff,0xffdfffff,0xffffffde,0xdebaffff,0x10417bae,0x10820000,0x10610800,0x10a220e3,0x00400841,0x00200000,0x08001041,0xe67a4987,0xf79effdf,0xffdfffdf,0xf7dff7df,
-0xe6fbffff,0x00003186,0x00001061,0x08000000,0x000018a2,0xffff8bef,0xffdfffdf,0xffffffff,0xef1cffff,0x00003145,0x000018c2,0xd6790000,0xffbeffdf,0xffffffbe,0xf7def7be,0xffffffff,0xf79dffff,0xbd96ffdf,0x10610800,0x08001882,0xe6db1020,0xffbeffbe,0xffdeffff,0xffdfffdf,0xff7dffbe,0x00005aaa,0x00001081,0x18c20000,0x6b2c0000,0xffffff7e,0xffffffdf,0xffffffff,
-0x0000bdd7,0x10610000,0x00000000,0x08610020,0x002010a2,0x08411081,0x00200840,0x08201081,0x52480800,0xffffe75c,0xffbfffff,0xffbfffbf,0xf7beffff,0xeefbffdf,0x080049a6,0x108118a2,0x08610000,0x000010a2,0x00000000,0x08610000,0x082018c3,0x106118a2,0x738d0000,0xffffffde,0xffffffff,0x5a69f73c,0x10410000,0x00200000,0x08410021,0x736d0820,0xff9eff7d,0x18009410,
-0x10412082,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x28c31020,0xb4f41800,0x5a8aff7d,0x10a20000,
-0x08610881,0x08200000,0x08001861,0xff9e83af,0xffdfffff,0xffffffde,0xef3cffff,0x000062ca,0x002010a2,0x10610841,0x528a0820,0x00202985,0x10820861,0x00000061,0x20a30861,0xc5351000,0xffdeffdf,0xffffffdf,0xffdfffdf,0xffdfffdf,0x39a6d69a,0x10410000,0x10611061,0x00001882,0x00000000,0x10a20020,0x00200061,0x20820800,0x39661000,0xffffd67a,0xfffff79e,0xffffffff,
-0x6b2cffbe,0x18a20000,0x08410000,0x00001082,0x08410841,0xc5f71882,0xffbeffbe,0xff9ef77d,0xa4f3ff9d,0x18a20800,0x00001081,0xffbf83cf,0xffffffff,0xff9effff,0xffffffdf,0xffffffdf,0xffffffde,0xef1cffff,0x000041c7,0x20a21020,0x94300800,0xffffffdf,0xffffffdf,0xffdfffff,0xacd3ffdf,0x10a20000,0x08400840,0x00000840,0x080018a2,0xffbfbd75,0xffffffdf,0xffffffff,
-0x0000a513,0x002018c3,0x10820000,0x000010a2,0x00000000,0x00200000,0x08611082,0x10610020,0x18821881,0xffffdeda,0xff7effde,0xff9effbf,0xffdeffbe,0xde9affff,0x10202061,0x00001061,0x108110a2,0x00200000,0xad7594b2,0x000052aa,0x10810000,0x10810020,0x00001081,0xffffd6b9,0xffdef7be,0x1020cdd7,0x08611061,0x10810000,0x08610882,0x08001081,0x9410838e,0x10201820,
-0x00001041,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18410800,0x49c70800,0x00007b8e,0x08610861,
-0x00000000,0x00000861,0x10211062,0xbd551000,0xf7beffdf,0xf7beffde,0xc5d6ffff,0x20e30000,0x08810840,0x00001081,0xf79d736d,0x73efdefb,0x00200000,0x10610861,0x10410820,0xc5960800,0xffbeffff,0xffbeffff,0xffbeffff,0xf75dffff,0x00006b2c,0x082020e3,0x00001041,0x29440000,0x94b29cd3,0x00000000,0x08611081,0x08000000,0x000020c3,0xffffa534,0xf7deffff,0xfffff7be,
-0x0000b575,0x00001882,0x00201081,0x08610000,0x08410000,0x41c70000,0x734d83ae,0x736d732c,0x292462eb,0x08410000,0x00200861,0xce597b8e,0xc618c618,0xffbfdeba,0xffffffbe,0xffdfffdf,0xd618f75d,0xcdf7d618,0x00006aec,0x08201081,0x29240000,0xce18ad34,0xd639d618,0xe679de38,0x2904c596,0x08610000,0x00000861,0x08610861,0x00001081,0xff5d5228,0xf79effff,0xffffffbe,
-0x08009471,0x00001082,0x00001081,0x21440000,0xc6388c71,0x21249cd2,0x00000000,0x00001041,0x00001040,0xffffc617,0xfffff7be,0xffbeff9e,0xffbeffff,0xce38ffbe,0x08201020,0x08610840,0x00000000,0xc638632c,0xffdfffff,0xc617ef7d,0x00006b6d,0x00400040,0x00200881,0xfffece58,0xffdfffbe,0x10009c31,0x00201882,0x00000861,0x10a20000,0x10610000,0x00000800,0x10411020,
-0x08210000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00001041,0x08200800,0x00201061,
-0x294539c7,0x10820000,0x18620000,0x20a20800,0xffdfd639,0xffbeffff,0x9cb2ffdf,0x18a20000,0x00000861,0x94710000,0xffdeffbe,0xfffff7de,0x5aebc679,0x00000020,0x10611041,0xc5f70820,0xffdfffdf,0xe6dbffbe,0xe6bbb575,0xf73cffdf,0x00002924,0x10610820,0x39860000,0xe71b9cd2,0xffffffff,0x6b6dce79,0x00000000,0x00200841,0x000018c2,0xffde9cd2,0xffffffdf,0xdebaffdf,
-0x080041a7,0x08401061,0x21440020,0x00204228,0x00001081,0x00001061,0x00000000,0x00000800,0x00000000,0x00200841,0x08610000,0x00000000,0x10411061,0xde7a2904,0xf79effdf,0xff9effbe,0x08007b8e,0x00001041,0x08400000,0x00200000,0x00000841,0x00000000,0x10001041,0x10211841,0x08200800,0x08410820,0x21240000,0x08400000,0x18820820,0x83cf0800,0xffffef1c,0xffdeffff,
-0x00007b6e,0x08411061,0x10820000,0xdf3c8c50,0xffffffff,0xe6fbffff,0x3986ad34,0x18610800,0x000018a2,0xffdfa513,0xd699ffbe,0x943083ef,0xffdfe6ba,0xc5d6ffff,0x18a20000,0x00001061,0xb5b652a9,0xfffff79e,0xfffff7be,0xffffffff,0xb5b6ffbe,0x00002965,0x00001903,0xffffce37,0xd618ffde,0x18212882,0x08400820,0x632c0000,0x00004a27,0x00201081,0x10a20881,0x08000820,
-0x00000821,0x00200000,0x00200000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410800,0x10611081,0x00200000,
-0xc5f7d69a,0x00000000,0x00001082,0x00001061,0xa4723104,0xffdfe69a,0x7b8dffdf,0x18c20000,0x39a60000,0xffffb575,0xffffffdf,0xffdfffff,0xffbeffff,0x0000a514,0x08611061,0xce380000,0xf71cffdf,0x49c7bd76,0x20c30000,0xd659a4b3,0x00003145,0x000018c2,0xe6fb7b8e,0xffffffff,0xffdeffff,0xffffffff,0x4a69c617,0x08610000,0x08001081,0xffdf83ae,0xff5dffbf,0x62aae69a,
-0x10820000,0x08610841,0xad950000,0x0000d6ba,0x08200000,0x10610800,0x18a21861,0x10821061,0x08411061,0x00200000,0x00000000,0x10821082,0x18a20841,0x628a0800,0xffffef1c,0xad14ffbf,0x08820000,0x08610882,0x00200020,0x00200000,0x00200820,0x10a210a2,0x10810861,0x08600861,0x000010a2,0x00001082,0xce792965,0x0000840f,0x000018a2,0x00001081,0xa4d24a08,0xff9ef71c,
-0x00006b0c,0x000018a2,0xd6995aca,0xffffffff,0xffdfffff,0xffdfffff,0xdebaffff,0x00002904,0x000018a2,0xde5993f0,0x186183ae,0x08000800,0x9c303904,0xa4b2e679,0x10a20000,0x49e80000,0xffffef3c,0xffffffff,0xffffffff,0xffbdffff,0xfffffffe,0x00006b2c,0x000020e3,0xff7dcdf7,0x4186b4f3,0x10610800,0x00001061,0xef3c18c2,0x62aaf73b,0x08620000,0x00000041,0x00000820,
-0x00210000,0x00000041,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08400020,0xbdb60020,
-0xffdfffff,0x0000a514,0x08610020,0x10610000,0x10000800,0xa49228a3,0x4a28d659,0x18a20000,0xb5550800,0xffdfffff,0xfffff7be,0xffffffff,0xffffffde,0x0000dedb,0x10a20000,0x94b20000,0x62cbc5f7,0x00000800,0x000018a2,0x39860800,0x000018a2,0x000010a2,0xffffad14,0xfffff7be,0xffffffff,0xfffeffff,0xd699ffff,0x00002124,0x000010a2,0xde396aaa,0x72ecc576,0x08001841,
-0x08201061,0x00001061,0xf7be8410,0x9491ffff,0x20e30000,0x18821061,0x08201882,0x00000840,0x00000820,0x08410000,0x088110a2,0x10820841,0x08210841,0x080020a2,0xffdf9c92,0x3165e6ba,0x08a20000,0x08a20041,0x08610861,0x08611082,0x00000841,0x00200840,0x00400841,0x00810060,0x08610040,0x000018a2,0xffdfad54,0x62abf75d,0x18a20000,0x10810000,0x08000000,0x9c7149e7,
-0x00004a08,0x000018a2,0xffffa513,0xffffffff,0xffdfffff,0xffffffdf,0xff9dffde,0x00004a08,0x00001061,0x184130e4,0x08000800,0x18821081,0x10000800,0x20c22082,0x10810000,0x6b0c0800,0xffdeffff,0xffffffff,0xffffffff,0xffdeffff,0xffbeffbe,0x0800734d,0x08001882,0x62ca7b6d,0x00000800,0x00000861,0x00000020,0x7bae1082,0xa491d617,0x10820000,0x00200020,0x00000000,
-0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410820,0xad340000,
-0xff9eff7d,0x8c51ffdf,0x08a20020,0x00000020,0x18821041,0x08000800,0x188220c3,0x08000000,0xd6791882,0xf7feffff,0xfffff7fe,0xffffffde,0xffdfffff,0x0020ce58,0x08410841,0x00000820,0x00000000,0x10a21081,0x08610861,0x00001081,0x00400000,0x00200881,0xffffad34,0xffffffdf,0xffffffff,0xffdeffff,0xf7beffdf,0x00205b0b,0x000010c2,0x292420e3,0x08000000,0x08410820,
-0x08200800,0x08000800,0xffffdeba,0xef5cffff,0x00003986,0x08000000,0x00000000,0x00200020,0x00000020,0x00000861,0x00000000,0x00000000,0x08410020,0x00000841,0xb5551882,0x00007b8e,0x08401081,0x00200040,0x00000000,0x00000020,0x08610000,0x00000000,0x00000820,0x10a10860,0x10a20861,0x630b0000,0xffdef79d,0x838eff9e,0x18820800,0x00000800,0x10611882,0x00000000,
-0x08610000,0x00001882,0xffffb575,0xffffffff,0xf7deffff,0xffbeffff,0xf73cffff,0x08003945,0x10411041,0x08000000,0x084118a2,0x08400020,0x18821061,0x00000000,0x10810820,0x5a890000,0xfffff79d,0xffffffff,0xffffffff,0xffdeffde,0xffdeffde,0x0800736e,0x10411862,0x00000000,0x08810861,0x00200000,0x08410040,0x00000000,0x08000000,0x00000000,0x00200020,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00410000,0x00000000,0x08410000,0x08200800,
-0xffdfbd55,0xad13ffdf,0x08810000,0x08610882,0x00200841,0x18821062,0x00000000,0x00001882,0xff9e6acb,0xf7beffde,0xfffeffff,0xffffffff,0xffffffde,0x0000c617,0x082018a2,0x08610000,0x086110a2,0x000018c2,0x10810000,0x08400840,0x08610040,0x000010a1,0xffbeb555,0xffffffbe,0xffffffff,0xffffffdf,0xf79dffbe,0x00006b4c,0x084010a2,0x00000000,0x10611882,0x18e31082,
-0x08200000,0x08001882,0xffbe7bce,0xffffffde,0x840fc617,0x8c719491,0x4a486b4d,0x00000000,0x10810000,0x29650000,0x4a694a48,0x42285269,0x00000841,0x08410841,0x08000800,0x10610000,0x00000840,0x39e70000,0x424839e7,0x39c64228,0x000018c3,0x00000861,0x08610000,0x00200000,0x00000000,0xdeba4a28,0xffdeffff,0x1021cdf7,0x08001041,0x10610820,0x08201082,0x10810861,
-0x00000861,0x00001081,0xffffbdd6,0xffdeffbe,0xffffffff,0xffdeffde,0xf73cffff,0x080028e3,0x00001061,0x08410841,0x10c20841,0x00201081,0x108110a2,0x08201081,0x10610820,0x39c60000,0xffffef5c,0xffffffde,0xffffffff,0xffbeffff,0xf77dffbf,0x08006aec,0x00001041,0x08821082,0x00400061,0x08610881,0x00201082,0x10820020,0x00210821,0x00000020,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08001082,
-0xb5141021,0x1882cdf7,0x10610800,0x00200000,0x086110a2,0x00000000,0x00400861,0x00000861,0xd5f85a29,0xffdfffbf,0xffffffde,0xffffffde,0xffffffdf,0x0000d679,0x000018a2,0x08200000,0x08811081,0x08400000,0x00001061,0x10811061,0x00200000,0x08001061,0xe6596a8a,0xffdfffdf,0xfffeffff,0xffdfffde,0xf75dffdf,0x0000528a,0x08201081,0x10410000,0x10c21061,0x00000020,
-0x00200861,0x08400841,0xc5f70000,0xf7deffff,0xffffffff,0xfffff7fe,0xb5b6ffdf,0x10810000,0x000018a2,0xd6994a69,0xef7df7bd,0xef5cf79e,0x0000ad54,0x08410841,0x10810820,0x00001061,0x00200881,0xef5ca554,0xe73cef5c,0xef5cef5d,0x31c6ce58,0x10810000,0x00000861,0xb5957bae,0xc658bdf7,0xffffe73c,0xef3cffde,0x00005aca,0x08401081,0x00200000,0x10a20000,0x00200881,
-0x08410000,0x00001082,0xe6db8410,0xffdfffff,0xffdfffbe,0xff9effdf,0x734dce18,0x08400800,0x00200000,0x08810020,0x00000861,0x00000000,0x00000000,0x084010a2,0x08200820,0x08810000,0xeefb9451,0xffffffdf,0xf7beffff,0xffdfffff,0x93f0eebb,0x08002042,0x00400820,0x00200020,0x08610861,0x00200000,0x00000000,0x00000840,0x00200841,0x00000000,0x00200000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x10610000,
-0x10200800,0x08001841,0x08000820,0x39a72104,0x00000000,0x086110a2,0x00000020,0x10610020,0x30a30800,0xf6dbac72,0xffdfff9e,0xffdfffdf,0xf79effdf,0x00009c92,0x000018a2,0x18c20841,0x00200000,0xce796b4c,0x5aaace58,0x00000000,0x000010a2,0x18610800,0x20410800,0xff7dacb3,0xffbeffdf,0xffdfffdf,0xef1cffdf,0x00005a8a,0x080018a2,0x18c30841,0x00000000,0x636c4a89,
-0x08610000,0x08410000,0x5a890820,0xffffef3c,0xffffffde,0xf7deffff,0x4a49ef5c,0x18a20000,0x00200000,0xffffce38,0xfffff7de,0xfffff7de,0x73aeffff,0x18a20000,0x00200020,0x10a20000,0x632b0000,0xfffff7be,0xffffffff,0xffdfffff,0xb5b6ffff,0x00200000,0x000010a2,0xffde7bce,0xffffffde,0xf7beffff,0xacf3ffdf,0x10a20000,0x00000840,0x7c3010e3,0x00004a89,0x10a20000,
-0x00000000,0x10810000,0x52490000,0xff7dbdb6,0xffdfffff,0x7b8ed679,0x00001861,0x00200841,0x08810000,0x000010a2,0x5acb0020,0xce59b596,0x39c69471,0x00000000,0x00001081,0x08400040,0x4a070800,0xf75dce18,0xffffffdf,0xacf4ef1c,0x10004125,0x08201821,0x00000821,0x10a20881,0x00000000,0xbdd6734d,0x08409cd2,0x08400820,0x00000020,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x08410840,0x10610000,0x08001882,0xf77d9451,0x20e39cd2,0x00200000,0x08200840,0x00000000,0x00000861,0x30a30800,0xf6bbac72,0xffbfffbf,0x5a6ad659,0x10810000,0x08610000,0x00000000,0xbdd64228,0xfffff7de,0xf79effff,0x00009cd3,0x10a20000,0x00000000,0x08001861,0x628a0800,0xff9ede38,0xeebaffdf,0x49c7a472,0x08200820,0x00000000,0x00000000,0x9cb22944,0xf7deef9d,
-0x00006bae,0x002018c2,0x08001882,0xffdfa451,0xffdeffbe,0xffffffff,0x08009451,0x18a218a2,0x842f0000,0xf7beffff,0xffdeffde,0xffdeffff,0xef7dffff,0x00403a07,0x00000882,0x00000841,0xc6380000,0xffdeffff,0xffdfffdf,0xffffffff,0xfffff7be,0x00008c71,0x10611081,0xc5d70000,0xf7beffff,0xffffffde,0x4165eedb,0x10610000,0x000018c2,0xffff8c91,0x9491e77c,0x00002103,
-0x00001081,0x00000821,0x00001082,0x62cb0000,0x9c72b514,0x08001862,0x10820841,0x00000020,0x00000040,0x4a690000,0xef9db5f6,0xffffffff,0xef3cffff,0x08419471,0x08610000,0x00400000,0x08001081,0x838e1020,0xde18ddf8,0x1000626a,0x18a20800,0x08200820,0x08410000,0x00000000,0xc5b65228,0xffffff9e,0x1041b575,0x10610000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,
-0x00200000,0x10610861,0x5a8a0000,0xffdfef1c,0xdedaffff,0x10818430,0x08610000,0x00200020,0x08610000,0x100020a3,0x49461000,0xa472ac93,0x08001021,0x000018a2,0x00000840,0x949110e3,0xffffe71c,0xffffffff,0xffdfffff,0xce59ffdf,0x00004a49,0x00000861,0x08200000,0x08001882,0xa4922062,0x4166b4f4,0x08000800,0x08401021,0x08400020,0x841018c3,0xffffe6fb,0xfffff7be,
-0x0000ce79,0x08200040,0x10001040,0xe69a2882,0xf7deffff,0xdebaffff,0x08000800,0x000018a2,0xdf1b4228,0xffdeffff,0xffdeffff,0xffffffbe,0xfffff7de,0x0000c679,0x00201082,0x000010a2,0xffde7bce,0xffdfffff,0xffffffff,0xffdfffdf,0xffdfffde,0x4207ef7d,0x18c30000,0x7bae0000,0xff9effbe,0xffdfffde,0x08008baf,0x18a21882,0x52aa0000,0xffffef7d,0xffffffff,0x630bd679,
-0x08410000,0x00000820,0x10820020,0x00000841,0x08000800,0x20a30800,0x00200820,0x08810000,0x10c20020,0xef5c94d2,0xfffffffe,0xffdef7de,0xffdeffdf,0xd699ffff,0x00005289,0x000010c2,0x10810020,0x10001041,0x18001800,0x18611000,0x00201041,0x00200000,0x00000861,0xad554228,0xffdeff5d,0xacf3ffbe,0x08201020,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,
-0x00000000,0x18820000,0x736d0000,0xffdfff5d,0xffdfffdf,0xce58ffff,0x00004228,0x00000881,0x00000000,0x10210800,0x08001862,0x00000000,0x08810040,0x00000020,0x08001882,0xffbe5aca,0xffffffff,0xffdfffff,0xffbeffff,0xffffffff,0x00008c91,0x086110c2,0x08200000,0x10820000,0x00000861,0x08000000,0x108118a2,0x00200000,0x000010a2,0xffbe83ef,0xf79dffff,0xffdeffff,
-0x73aef79d,0x18c20000,0x18621021,0x7bae0800,0xf7deffde,0x9cd2ffff,0x18a20000,0x000018a2,0xffff8c30,0xffffffbe,0xffffffff,0xffdeffff,0xffffffff,0x0000ce79,0x08410000,0x000010a2,0xf79d738e,0xffdeffbe,0xffffffff,0xffdfffff,0xffffffff,0x0840c617,0x10810000,0x4a480000,0xffffef3c,0xc5b6ffbe,0x10611041,0x00001881,0xce992103,0xfffeffff,0xffbeffff,0xf77dffdf,
-0x00005289,0x00200861,0x08200020,0x18820800,0x20a21861,0x08001041,0x08611082,0x08820020,0x6b4c0000,0xfffff7bd,0xfffefffe,0xfffeffde,0xffdeffff,0xfffff7be,0x08209cd3,0x00000861,0x10610820,0x10610841,0x10200800,0x08001861,0x08a10860,0x08400040,0x00000861,0xffffc617,0xff9effdf,0x1841a4b2,0x10411041,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00001082,0xeefc732d,0xffbeffdf,0xffffffde,0x00007bce,0x002008a1,0x10610840,0x08400841,0x08610020,0x10a210a2,0x006110c2,0x00000020,0x08001882,0xffbe7b6d,0xffffffbe,0xffdeffff,0xffdfffff,0xffdef7be,0x00007c0f,0x000010a2,0x18820820,0x00001061,0x10c20060,0x108110a2,0x086118a2,0x00200020,0x000010a1,0xffbe7bce,0xffdeffff,0xffdeffff,
-0xdebaffff,0x000010a2,0x08201041,0x00001041,0xffffc5f7,0xc617ffdf,0x10410000,0x00001081,0xde9a41e7,0xff9dffff,0xffffffff,0xffffffbe,0xffbeffdf,0x00006b4c,0x000018a2,0x10a20020,0xad340000,0xffffffff,0xffffffff,0xffbeffff,0xef3cffdf,0x08005aaa,0x18821061,0x83ef0000,0xffdeffbe,0x4a08ef1c,0x10a10000,0x00000840,0xffffad75,0xfffffffe,0xffffffbe,0xffbeffde,
-0x0000736d,0x002010a2,0x08410000,0x104120c3,0x00000820,0x18a21082,0x00000000,0x10a20041,0x738d0000,0xffffffde,0xffffffde,0xffffffff,0xffffffde,0xffffffde,0x0000a4d3,0x082018a2,0x00000800,0x10a210a2,0x08610840,0x10810820,0x00000881,0x08610020,0x00200000,0xffffd6ba,0x9c71ff7d,0x10401841,0x00001881,0x00200820,0x00000020,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00200000,0x20c30000,0x62aa0000,0xffdfde59,0xffbeffbe,0x0000736d,0x004010a2,0x00000000,0x08a10000,0x00200061,0x00001082,0x00000000,0x08001081,0x08001882,0xffde83ce,0xffffffff,0xfffff7de,0xffdfffdf,0xf7beffff,0x00207bef,0x10411081,0x08000800,0x18a20000,0x08610060,0x000010a2,0x00000000,0x00000861,0x00001081,0xffbe7bae,0xffdfffdf,0xffffffde,
-0xffffffdf,0x00009cb2,0x000018a2,0x00001882,0xf73d6aeb,0xef5dffdf,0x000031a6,0x108108a2,0x83ce0000,0xffdeffdf,0xffdeffbe,0xffdeffff,0xbdd7ffdf,0x10410000,0x08400820,0x10610000,0x41c70800,0xfffff75d,0xffbeffff,0xffdfffff,0xb534ffdf,0x18820800,0x08201041,0xd6790000,0xffdfffff,0x00009451,0x108110c2,0x6b4c0820,0xffffffde,0xffffffff,0xffbeffbe,0xffffffdf,
-0x00007bae,0x000010c2,0x00000000,0x00000000,0x108110a2,0x00000000,0x41e739c6,0x18a20000,0x7bae0000,0xffdeffde,0xffffffff,0xffffffde,0xffdeffde,0xfffff79e,0x0800acf4,0x00001882,0x4a6839a6,0x00000000,0x088110a2,0x000010a1,0x52aa0000,0x00202944,0x00000040,0xffbededa,0x10419430,0x10611020,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00400000,0x00000020,0x00002103,0xd61828c3,0xff9effbf,0x00006b2c,0x000018e3,0x7bae3186,0x00000000,0x10a208a2,0x00000000,0xce79840f,0x000062eb,0x080020c3,0xffff9430,0xef9dffdf,0xffffffff,0xffffffdf,0xf7beffdf,0x00007bef,0x000010a2,0x734d3986,0x000028e4,0x00000000,0x18a20000,0x8c509491,0x08610000,0x000010c2,0xffdf7bae,0xffdfffdf,0xffffffdf,
-0xffffffff,0x62ebf75d,0x10610000,0x18620820,0xb5140800,0xffdfffdf,0x00009cd2,0x088108a2,0x10200820,0xffffd638,0xffdfffdf,0xffffffbe,0x5249e6fb,0x10610000,0x10610820,0x000018a2,0x08001861,0xffde9c91,0xffffffff,0xffdfffdf,0x41c7deba,0x18610000,0x08001861,0xffbe62ca,0xd638ffdf,0x08001882,0x08810861,0xb5950000,0xf75dff9d,0xf73cf71c,0xf73cff3c,0xe6baf71c,
-0x000062eb,0x000018c2,0xc61783ef,0x29448c30,0x00400000,0x9d1331e6,0x9cd2ef7d,0x18a20000,0x8c100000,0xffdeffde,0xffbeffbe,0xffbeffff,0xffdfffbe,0xff7dffdf,0x080083ef,0x000020c3,0xe73c8c71,0x52a9ad95,0x00200000,0x4a690020,0xf75db595,0x00006b0c,0x00001082,0x8c30b555,0x10410800,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000020,0x00400020,0x18820000,0x18410800,0xd618ac93,0x000041c7,0x00001082,0xf75d5269,0x5269ce18,0x00000000,0xc6185aeb,0xffffffff,0x00007bcf,0x000010a2,0xde595229,0xffffffbe,0xf7beffff,0xfffff7de,0xffffffbf,0x00008430,0x00001903,0xff9e6b4d,0x8410de9a,0x294418c2,0xdeda8c50,0xd679ffbe,0x00200000,0x08001082,0xe67a6aec,0xff1dfefc,0xf6dbf6db,
-0xe69aeebb,0xacd3ff3d,0x10820000,0x10610820,0x28e40800,0xbd96b515,0x0020840f,0x08400020,0x08001061,0xb53462cb,0xacf3b534,0x9c719c92,0x00005289,0x00001081,0x000018c3,0x10410000,0x00000820,0x83ef1021,0x9c929c72,0x94519471,0x00004a28,0x000018a2,0x00000841,0x83cf41e7,0x49c78bcf,0x10610000,0x00000000,0x41e70841,0x52085a49,0x51c751c7,0x39254186,0x188228c3,
-0x08400000,0x00001081,0xffffa513,0xdefafffe,0x8c918c70,0xffffe75c,0xb595ffff,0x20c30000,0x41e70000,0xffdec5f7,0xffdeffde,0xffbeff9e,0xff9effdf,0x732ce6bb,0x08410000,0x000018a2,0xfffea534,0xf79dffff,0x42289cf3,0xf79da534,0xeefbffde,0x08005a28,0x10211841,0x00000861,0x08410841,0x00200000,0x00000020,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00200000,0x00200000,0x08200840,0x08001862,0x20621000,0x08001020,0x00000841,0xde593125,0xff9effdf,0xb595ad14,0xfffff79e,0xffbeffdf,0x0000738e,0x084110a2,0x28e40800,0xef1ca492,0xffffffdf,0xffdfffff,0xde79ffdf,0x00205269,0x00201082,0xf79e62eb,0xffbeffff,0xd69adeba,0xffffffdf,0xe6dbffff,0x000020e3,0x00001061,0x39041841,0x49a74166,0x39244125,
-0x39453104,0x31043925,0x00200821,0x00200000,0x08001041,0x08000800,0x08610000,0x08400020,0x08400000,0x08000000,0x08001020,0x00000800,0x10610000,0x10810000,0x7bae0000,0x080062cb,0x104118a2,0x08000820,0x08000000,0x00000000,0x10820000,0x00200000,0x08200000,0x08000800,0x08000800,0x00001081,0x08200800,0x00000020,0x08000800,0x10000800,0x08000800,0x08000800,
-0x00000840,0x000018a2,0xffffad54,0xffdeffff,0xfffefffe,0xef9dffff,0xb595ffde,0x10410800,0x00000840,0x6b0c1061,0xff9ec5f7,0xffdfffdf,0x9410eedb,0x00003104,0x08400841,0x000018a2,0xffff9cf3,0xffffffbe,0xffbeffdf,0xff9effff,0x41a6b555,0x18410800,0x08001000,0x10810020,0x00000841,0x00200000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00200020,0x00000000,0x10410800,0x00001041,0x00000000,0x10610040,0x39240800,0xff5db514,0xffffffdf,0xffdeffde,0xffdfffdf,0x00007bae,0x00200861,0x08001061,0x5a6a0800,0xff7ecdd7,0xff3dff9e,0x1882a492,0x08610000,0x00001082,0xf75d62eb,0xffffffff,0xffffffff,0xffdeffde,0xde7affdf,0x00002904,0x08200841,0x08000800,0x08200800,0x00000000,
-0x08000000,0x00000000,0x00200841,0x00200020,0x10410000,0x10821062,0x00201081,0x00000040,0x08200820,0x10811041,0x10611061,0x18a218a2,0x08001081,0x00001882,0xef7d5aca,0x2123defb,0x08610000,0x18620841,0x18a218a2,0x18a21882,0x00201061,0x00000020,0x00000020,0x18820841,0x08411882,0x00200020,0x00000820,0x08810000,0x18611061,0x10411041,0x10401061,0x08401041,
-0x00000000,0x00000861,0xc5f74207,0xffffffde,0xffdefffe,0xfffffffe,0xce18ffff,0x10820000,0x08410820,0x00000020,0x734d0820,0xb535cdf8,0x080041a6,0x18810800,0x08400000,0x000018c2,0xffdead74,0xffbeffde,0xff9effbe,0x626ad5d7,0x00000800,0x00200841,0x08000000,0x08411041,0x00200020,0x00000841,0x00210021,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x08200840,0x00000000,0x00000000,0x08001041,0x72ec0800,0xffbede9a,0xffbeff9e,0xffdfffbe,0x00009492,0x10812103,0x18820000,0x08001841,0x7b6e1000,0x41a7acb3,0x08000800,0x08411082,0x000020e3,0xffff8c10,0xf7deffde,0xffbeffde,0xf73cffff,0x5a8abd75,0x08610000,0x00000020,0x10610820,0x08400840,0x08610861,
-0x08200841,0x08611081,0x00000000,0x00200020,0x00000020,0x08610841,0x08610840,0x10a20061,0x00000820,0x08610000,0x00000020,0x08401081,0x10611061,0x21030820,0xffffdeba,0xad74ffff,0x18c20000,0x08410841,0x00000000,0x00000861,0x00200020,0x08810840,0x08610861,0x08401081,0x08410000,0x00000020,0x08810861,0x086110a2,0x10821061,0x18821082,0x18a218a2,0x108210a2,
-0x00000821,0x08410000,0x00000000,0xde797b6d,0xffdeffde,0xffbeffbe,0xe6fbffff,0x00001081,0x082018c3,0x10820841,0x08000820,0x00000000,0x18820000,0x00000840,0x00000840,0x52aa0020,0xffdee6fb,0xffdeffbe,0x72cbd618,0x08001821,0x10811041,0x00000040,0x08400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00200020,0x00200000,0x10810000,0x08001061,0xacd32082,0xffbeff5d,0xf7ffffff,0x52cadefb,0x00000000,0x00001082,0x18a20800,0x00000820,0x00000000,0x10411061,0x00000840,0x5aeb0000,0xffdfdedb,0xfffff7be,0xffbfffff,0x6b0cce18,0x00000800,0x00200020,0x00000020,0x10a20840,0x108110a2,0x10811082,
-0x18a21081,0x10810861,0x08611082,0x00210020,0x00200020,0x10820841,0x00000841,0x00000000,0x00400841,0x00000841,0x00000840,0x00000000,0x00200000,0xb5d60000,0xf7beffff,0xf7def7be,0x00007bcf,0x084110a2,0x08610881,0x00200000,0x00000000,0x00000841,0x00000000,0x00000000,0x00000020,0x08410020,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,
-0x00200000,0x00000000,0x08401061,0x18a20800,0xeefb9430,0xffffffbe,0xffbeff9d,0x4a69bdf7,0x08200000,0x00000820,0x10820861,0x10a21082,0x00001082,0x00000820,0x18c20000,0xef5c8c50,0xffbeffde,0x836dd618,0x08002041,0x10611861,0x00200840,0x00200000,0x00000020,0x00000000,0x00200000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00200000,0x00000000,0x00000000,0x00200020,0x18820020,0x10001000,0xc5d7626a,0xffffffbe,0xf79dffdf,0x29249471,0x08610000,0x00000000,0x10810840,0x108210a2,0x08400820,0x31850000,0xef7dad55,0xffbeffff,0xffdfffff,0x9451f73d,0x08001041,0x10811861,0x00200020,0x00400020,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000841,0x00610000,0x00000000,0x10410000,0x294518c3,0x00200000,0x08410020,0x08610000,0x18e30840,0x00202124,0xf7de8c50,0xfffffffe,0xffffffde,0x4a48e6fb,0x00000000,0x00000020,0x00200041,0x00000841,0x29450000,0x29853186,0x00002144,0x08410000,0x00000820,0x4a8918c3,0x39a64208,0x4a8a4208,0x5aeb52aa,0x6b4c6b2c,0x630b6b2c,
-0x000018e3,0x00000841,0x10610861,0x08001081,0x41660800,0xf71cbd34,0xffdeffff,0xe71cffff,0x10419471,0x08410800,0x00200000,0x00200000,0x00000000,0x10810820,0x8c300000,0xffdfffff,0x8bcfd659,0x10001000,0x18611000,0x00000820,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200020,0x10411041,0x08001021,0xeedb83af,0xffdfffdf,0xd659ffdf,0x00002924,0x00000841,0x00000841,0x00200821,0x10610820,0xad340000,0xffffffff,0xffdfff9e,0xbd75ff5d,0x080041a6,0x18820800,0x10a21081,0x00200860,0x00000060,0x734c1061,0x738d7bee,0x7bee7bee,
-0x842f7c0f,0x73ae7bce,0x3185630b,0x08410000,0x00001081,0xc6187bce,0xdebad699,0xe71cd69a,0x00009491,0x10611081,0x41e70800,0xdedad679,0xd6dad6da,0xfffff7be,0xfffffffe,0xffdfffff,0xdf1bffdf,0xce58ce99,0x3145bd96,0x08610000,0x00001082,0xd6fa8430,0xdf1bdf1b,0xad75defa,0x00000840,0x000010a2,0xef7c5aeb,0xe71bef5c,0xef9eef7d,0xf7beef9e,0xffdeffff,0xe6daffff,
-0x00003165,0x00001061,0x08810000,0x10611081,0x08001882,0x51e80800,0xff7dbd55,0xff9effdf,0x18a3bdb6,0x08400000,0x00200000,0x08610040,0x00200000,0x08400000,0x31650000,0x83cf9472,0x00001061,0x10610800,0x00001061,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x08200000,0x10411041,0x31050800,0xff7eacd3,0x9c71ef1c,0x00000800,0x08411061,0x10821062,0x00000841,0x08410020,0x31650840,0xf75d9cb2,0xcdf7ffbe,0x080062aa,0x18a20800,0x18a21041,0x00000000,0x08810000,0x00000060,0xe6ba3965,0xf7bdfffe,0xfffeffde,
-0xffffffde,0xffdefffe,0xad54ffff,0x08610020,0x08401081,0xffffad34,0xffffffff,0xffffffff,0x2104e71c,0x10410800,0x08201020,0xffffce17,0xffffffff,0xfffeffde,0xffffffff,0xfffff7df,0xffffffff,0xffffffff,0x1041ce18,0x10820820,0x42480000,0xffffe79d,0xffdeffff,0xdedaffff,0x00001081,0x000018a2,0xfffe7bce,0xffffffff,0xffffffff,0xffffffff,0xffdeffff,0xdedafffe,
-0x08203164,0x00200840,0x00002124,0x10820020,0x10411062,0x08001882,0x730c0800,0x83aebd55,0x00000000,0x00000840,0x10820020,0x00200000,0x086110c2,0x00000840,0x08000820,0x08000800,0x08611061,0x00200841,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x08410820,0x08001862,0x62ab1020,0x00005269,0x08600000,0x00000861,0x00000000,0x10820000,0x00000020,0x00000020,0x62cb0000,0x08207b8e,0x10820000,0x08611082,0x00000841,0xa5344228,0x000052aa,0x000010c2,0xf73c3124,0xfffeffff,0xfffeffff,
-0xffffffff,0xffbeffff,0xbdb6ffff,0x10820000,0x000018a2,0xffff9cd2,0xffdeffde,0xffffffdf,0x840fffbe,0x18a20000,0x000018c2,0xff9e7b4d,0xff9dffdf,0xffffffde,0xffdfffff,0xf79effff,0xffbeffde,0xf71cffbe,0x08005229,0x10821882,0xb5d60000,0xefbdffff,0xfffff7be,0xdebaffff,0x000020e3,0x000020a2,0xffde8c30,0xffffffff,0xffffffff,0xffffffff,0xffbeffdf,0xdeb9fffe,
-0x00002903,0x00001061,0xc638b5b6,0x000052aa,0x18c20000,0x10820820,0x00001061,0x00000000,0x08610840,0x08610000,0x00001082,0x18e30000,0x00000000,0x10821081,0x10610000,0x18821882,0x08410821,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08210000,0x00001061,0x10a20000,0x10a10861,0x21450020,0x9cd39cd3,0x000018a2,0x084118c2,0x08610020,0x00001081,0x10610000,0x08611081,0x000010a2,0x7bef0000,0xffffe71c,0x00008c51,0x000018c3,0xf6fb30e4,0xfffeffbe,0xffffffff,
-0xffffffff,0xffffffff,0xc5f7ffff,0x08400820,0x000018a2,0xffff9cb2,0xffffffff,0xffbeffde,0xce79ffff,0x08400000,0x08000861,0x9c511041,0xffdff6fb,0xffbeffff,0xffdfffdf,0xffdfffdf,0xffbeffdf,0x7b4de6ba,0x18820800,0x00001061,0xef5d39c7,0xf7bdffff,0xffbeffff,0xe6fbffff,0x00002924,0x000020a2,0xfffe9471,0xffffffde,0xffffffff,0xffffffff,0xffdeffff,0xdebaffff,
-0x10202904,0x00001061,0xffffce58,0x9cd2ef7d,0x00003185,0x08610000,0x10a10040,0x10a20881,0x08610040,0x000018c2,0x5aaa0000,0xdedac638,0x4a488c71,0x00200000,0x108110a2,0x00000821,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x00000000,0x10820820,0x10a210a2,0x00000000,0xdf1b5aeb,0xf7beffff,0x5aebdeda,0x00200000,0x084010a2,0x10610000,0x000018a2,0x00000861,0x29650000,0xffffbdd7,0xffdfffff,0x00009471,0x080018a3,0xeebb2883,0xffdeffdf,0xffffffff,
-0xffffffff,0xf7dfffff,0xbe17ffff,0x08410000,0x000018c3,0xffff8c71,0xffdefffe,0xffffffde,0xb5b6f7be,0x000018c3,0x08610861,0x00000820,0xbd3549a7,0xffdfff5d,0xffdeffdf,0xfffff7be,0xb514ff7d,0x000020e3,0x000010a2,0x08000820,0x9c922104,0xffdff71c,0xf7beffbe,0xe6fbffff,0x00002904,0x000020a3,0xffff9471,0xfffffffe,0xffffffff,0xffffffff,0xffdfffff,0xde99ffff,
-0x080020c2,0x00001882,0xffffce59,0xffffffff,0x94b2e73c,0x00200000,0x00200061,0x00200040,0x000010c2,0x31a60020,0xef9dad54,0xffffffff,0xe73cffff,0x4248b5b5,0x00000040,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000020,0x08200020,0x00000000,0xa5342944,0xfffff7de,0xffdfffdf,0xef9dffff,0x10a29d34,0x10810000,0x00000840,0x10410000,0x18c20000,0xef5d8c71,0xffdeffff,0xfffff79e,0x000083ef,0x080020a3,0xe6592041,0xffdfffdf,0xffffffff,
-0xffffffff,0xffffffff,0xbdf7ffff,0x10820000,0x000018a2,0xffff8c30,0xfffeffff,0xce37f77d,0x00006b4c,0x08610000,0x00000020,0x18a20840,0x10000800,0xd5f872ec,0xffdfff9e,0xce39ffff,0x08006aeb,0x10820000,0x08410040,0x08000840,0x00000000,0xcdd7626a,0xffffff9e,0xe6baffbe,0x000020e4,0x000018a2,0xffff8c30,0xffffffbe,0xffffffff,0xffdfffff,0xffdeffdf,0xd659ffff,
-0x080020a2,0x08001040,0xffffd699,0xf7beffde,0xffffffff,0x4a89c638,0x08610020,0x08810041,0x21440000,0xe75c8cb1,0xffffffff,0xfffff7de,0xffffffff,0xef3cffff,0x4a699cf3,0x00200040,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000820,0x8c1020c3,0xffdfe6fb,0xf79dffff,0xffffffff,0xfffff7be,0xce99ffff,0x0000634c,0x08400020,0x08001861,0xde9a28e4,0xf7deffff,0xffffffff,0xffffffdf,0x00008c71,0x080018c2,0xde391821,0xffffffff,0xffffffff,
-0xf7beffff,0xffffffff,0xbdd7ffff,0x10610000,0x080018a2,0xffbe83ef,0xde79ffbe,0x0800838e,0x10820000,0x00200841,0x188218a2,0x00001041,0x08411081,0x08000800,0xbd768baf,0x084183cf,0x08410000,0x10411041,0x00000861,0x08411081,0x10610840,0x18210800,0xeefba472,0xe6baffdf,0x000018a3,0x000018a2,0xfffe8c30,0xffffffff,0xffffffff,0xffffffff,0xfffeffdf,0xce58ffff,
-0x10410820,0x00001040,0xffdedeba,0xffdeffbe,0xffdeffbe,0xad34ffff,0x10a20000,0x00000862,0xd6da630b,0xf7feffff,0xfffff7fe,0xfffef7de,0xff9effdf,0xffdfff9e,0xb514ffbe,0x10810000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001041,0xe6bb5229,0xff9effdf,0xffdfffbe,0xffffffbe,0xf7deffff,0xffffffff,0xad55ffdf,0x00000000,0x08001041,0xe69a2062,0xf7deffff,0xf7beffff,0xffffffff,0x00008c71,0x000018e3,0xd6590800,0xffdeffdf,0xffffffdf,
-0xffffffff,0xffdeffdf,0xb5b6ffff,0x10610000,0x000018a2,0xc5b662cb,0x2082838e,0x10410800,0x002018a2,0x00001082,0x00000000,0x10610820,0x00200000,0x10411061,0x08000800,0x08410800,0x00201082,0x08000820,0x18c20000,0x00000000,0x082010a2,0x10211882,0x41860800,0xbd96bd35,0x00001882,0x000018a2,0xffde8410,0xffdeffff,0xffffffff,0xffdfffff,0xffdeffde,0xce38ffff,
-0x08000820,0x00001061,0xffdfd679,0xffdfffdf,0xffdeffff,0x4a08ef1c,0x10620800,0x18620000,0xffdfde59,0xffffff9e,0xf7ddf7de,0xffdeffff,0xff9effde,0xff1cffbf,0x30e39c30,0x08200800,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610800,0x39650800,0xff9ec596,0xffbeffbe,0xffdeffbe,0xffffffff,0xffdeffbe,0xffffffdf,0x002073ae,0x186218a3,0x93d01000,0xffffffff,0xffdeffde,0xffffffff,0x00009491,0x000010e2,0xde791020,0xffffffff,0xffffffff,
-0xffffffff,0xffdeffde,0xb595ffff,0x10a20000,0x08410000,0x08200000,0x00000000,0x08201061,0x18821061,0x18c30820,0x5b0b8c91,0x00000000,0x08001061,0x08400000,0x10821082,0x08201882,0x08610000,0x00000000,0xdefb7bce,0x0000a514,0x18c20000,0x00400861,0x08001882,0x20820800,0x00001041,0x000018a2,0xffbe7bae,0xffffffde,0xffbfffdf,0xffdfffdf,0xff9effdf,0xbd55ffbf,
-0x10610000,0x00000841,0xffdfd658,0xff9dffbe,0xff7dffbe,0x08008bef,0x18821062,0x72ec0000,0xfe5afe9c,0xffbefefc,0xffffffde,0xffdef7de,0xff9effde,0x626addf8,0x08000800,0x00001061,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08000800,0x08001882,0x838e1000,0xffbfe659,0xffdeffdf,0xffdeffbe,0xffbfffff,0xffdfff7d,0x0000c638,0x18820000,0x30c40800,0xffdede79,0xff9eff9d,0xff9ef75d,0x00007bce,0x002010a2,0xcdf71861,0xffbeffbe,0xff7df75c,
-0xf75cf75d,0xef5cff9d,0x9491e71c,0x10810000,0x00000841,0x00200020,0x08411082,0x18a20841,0x00000000,0xdeda630b,0xf7beffff,0x528ac638,0x10610000,0x00400020,0x00200020,0x08000820,0x08201061,0xa5340020,0xffffffdf,0xc638f7be,0x000062eb,0x08810040,0x18820020,0x08001020,0x08410000,0x00001041,0x8bef41c6,0x8c109430,0x94108bf0,0xa4729410,0x8baf9c10,0x5208834e,
-0x08400000,0x00000820,0x83ef62cb,0x736d83ce,0x5aaa734d,0x08200800,0x10210820,0x31040800,0x38425167,0xc5554925,0xf77dffdf,0xffffffbf,0x940ff6fb,0x10002041,0x08201882,0x00400000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x18620800,0x10001841,0xa4512882,0xffdfff5d,0xffdfffbe,0x7b2dd618,0x732c628a,0x10a2630c,0x08400020,0x08000841,0x72eb5a49,0x6a8a72cb,0x49e75a28,0x000028e3,0x00000840,0x52081000,0x5a695a69,0x5a28628a,
-0x49c65208,0x418649a6,0x18a23965,0x00200000,0x00000000,0x08610841,0x10820841,0x00000861,0xad542965,0xfffef7be,0xffbeffff,0x62aade59,0x08810000,0x00200040,0x108110a2,0x00000000,0x10610800,0x7bcf0000,0xffffe6fb,0xfffff7de,0x94b2f79d,0x00200000,0x084010a1,0x08600840,0x00000020,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x08000800,
-0x00200841,0x08200000,0x00000000,0x00000000,0x00000800,0x00200841,0x00000820,0x08000000,0x08200000,0x08000800,0xffbeb4f4,0xcd55ff9f,0x100049c7,0x18821041,0x08200800,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00200020,0x00000000,0x18621041,0x18001000,0xd618628a,0xd618ffbe,0x100028c3,0x08000800,0x00000000,0x00000040,0x08410020,0x08000800,0x10001000,0x08000800,0x00000800,0x08200000,0x08000800,0x08000800,0x08000800,
-0x18000800,0x08000800,0x00000800,0x00000820,0x00200020,0x08410000,0x000010a2,0x7bef0000,0xffffd6da,0xffdeffff,0x836ede7a,0x00001021,0x00000861,0x10a20881,0x00000000,0x084018c2,0x08200000,0x00000841,0xd6584a08,0xf7deffde,0xffffffff,0x5289ce58,0x00000020,0x00400881,0x00200020,0x00000020,0x10a20861,0x18c21081,0x106118c2,0x108118c2,0x18a21081,0x08411882,
-0x00000000,0x00200020,0x18a21061,0x106118c2,0x108118a2,0x00400020,0x00200000,0x00400000,0x08810060,0x000010a2,0xa4511821,0x1800938e,0x18820800,0x00000820,0x00000820,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x10200000,0x20821841,0x18610800,0x52288bcf,0x20820800,0x10412082,0x00201882,0x00200020,0x00000020,0x18821061,0x18411862,0x10411841,0x00000820,0x00000020,0x10410800,0x10611061,0x18811061,
-0x10201861,0x10411061,0x08400820,0x00000020,0x00000020,0x00000881,0x42070000,0xffffb596,0xf7deffff,0xef3cffbe,0x00005269,0x10611061,0x18a20820,0x00000000,0x5b0b4a69,0x00200000,0x084118a2,0x18820820,0x31650800,0xffffe6fb,0xffbeffff,0xef7dfffe,0x08619cd2,0x10a20000,0x00200881,0x00000000,0x00200840,0x00200020,0x08400000,0x08200000,0x00001061,0x08200000,
-0x00400000,0x00200020,0x00000841,0x00200020,0x00400020,0x08610000,0x10a10861,0x004010a2,0x00000020,0x08810000,0x00000020,0x08400000,0x000018a2,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00200000,0x00000020,0x08000820,0x00000800,0x10411882,0x08000800,0x08201041,0x00000000,0x10820800,0x10a20861,0x00000881,0x00000000,0x08000000,0x10611061,0x10a21082,0x00200040,0x08200000,0x08400000,0x10a10860,
-0x10611061,0x18a218a2,0x10811081,0x00200020,0x10a20000,0x31850000,0xef1ba4d3,0xffbeffff,0xf7beffbe,0xd679ffff,0x10a20000,0x00001081,0x00000841,0x8c500000,0xf79df77d,0x29a5ad95,0x08610000,0x10610820,0x00001081,0xffdfce18,0xffbeff9d,0xffffffbe,0xd679ffde,0x00006b4c,0x08610000,0x00200020,0x08410841,0x10a210a2,0x10a110c2,0x10a110a1,0x00200861,0x00000000,
-0x00000040,0x10a20861,0x10821082,0x00200000,0x00000000,0x00000861,0x00000000,0x00000000,0x00200841,0x00200000,0x08a20061,0x006110e3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x08410020,0x08000000,0x10411882,0x00000000,0x00200020,0x00000800,0x00000000,0x08610000,0x00200000,0x08200020,0x00000000,0x00000000,0x00610000,0x00000000,0x00200020,0x00000020,
-0x00000020,0x00000000,0x00200000,0x00400040,0x00001081,0xef1c736d,0xffdfffdf,0xeefbf6fb,0xffdeffde,0xc5f7ffff,0x10a20020,0x08610020,0x6b2c0020,0xffded699,0xffffffde,0xe71bffde,0x0000738e,0x08610000,0x000010c2,0xffffbdd6,0xffdeffde,0xf6fbff3c,0xffdeffdf,0xb5b6f79d,0x00004207,0x08200841,0x00000000,0x00000000,0x00200000,0x00000020,0x00400000,0x00200020,
-0x08610000,0x08410000,0x00000000,0x00000841,0x08410000,0x00000000,0x62cb62cb,0x41c6734c,0x00200000,0x00200840,0x00000020,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00200000,0x00200020,0x08200000,0x00000800,0x00200040,0x00000061,0x734c2904,0x6b0b732c,0x000041e7,0x00410861,0x00210000,0x62cb4a29,0x840f736e,0x00002965,0x08200861,0x08610000,0x7bce738d,
-0x7c306bad,0x73ef8430,0x4a698430,0x08610000,0x000010c2,0xffdfad14,0xd618ff7d,0x30e36acb,0xf75cb514,0xad54ffff,0x18a20000,0x00000840,0xffbea4f3,0xffffffff,0xffdeffbe,0xffffffff,0xad75ffbe,0x000010c2,0x000010c1,0xffdfce37,0xd638ff7d,0x51e872cb,0xff9ebd75,0xffffffbe,0x0800ad34,0x000018a2,0x7bcf3165,0x9cf38c51,0x94f2a534,0xa5549d13,0x0000632c,0x00000861,
-0x000010a2,0xb5955aeb,0x738eb596,0x08610000,0x10a20020,0x94500000,0xff5dffbe,0x4a07b534,0x08820000,0x00000000,0x08200820,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000040,0xad343185,0xfffff77d,0x0000d659,0x08610000,0x08200841,0xff9ebd96,0xffdeffbe,0x00209cf3,0x084008a1,0x00000860,0xffdfbdb6,
-0xf7deffde,0xffffffff,0xad75ffff,0x08810000,0x08001081,0xd6189c72,0x1000836e,0x08000800,0x730c0800,0x9c71de79,0x18820800,0x18820800,0xffffd69a,0xffffffbe,0xffdfffdf,0xffbeffff,0xef1bffde,0x00002944,0x000010c1,0xf6fbd638,0x18618bcf,0x00000000,0x732c1020,0xffbed5d7,0x0000b514,0x000020e3,0xffde8430,0xffffffff,0xffffffff,0xf77dffff,0x0000630b,0x08611082,
-0x00200000,0xffffce58,0x9cb2ffdf,0x10a20000,0x08201061,0xeedb28e3,0x732ce679,0x00001840,0x00200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x00000000,0xc5f762cb,0xa4d2ffde,0x10a20000,0x00001082,0xffbe736d,0xffdfffdf,0x5b0bf7be,0x08a10020,0x00001081,0xf71c5208,
-0xffffffff,0xffdef7de,0xbdb6ffff,0x10a20000,0x00000861,0x18213104,0x08200800,0x10611081,0x08001061,0x398628e3,0x10410800,0x18610800,0xffdfd679,0xffffffff,0xffffffff,0xffffffff,0xde99ffff,0x00002923,0x00001080,0x49a66289,0x10210800,0x108118a2,0x08000840,0x8b8e1820,0x000062ab,0x000018e3,0xffff8c50,0xf7bdfffe,0xffbeffde,0x9cb2ffff,0x10a20000,0x18c20000,
-0x94910000,0xffbeffbe,0x3165e6db,0x08410000,0x00000841,0x7b6d41c7,0x08001861,0x10400800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08400840,0x08000800,0x8c307b8e,0x00000000,0x08201061,0xd6591861,0xffbeff9e,0xd699ffff,0x002010c2,0x18810820,0xacf30800,
-0xffffff9e,0xffffffde,0xce38ffdf,0x00200000,0x08200841,0x08000000,0x08811082,0x086110c2,0x10610840,0x00000000,0x10411061,0x31450800,0xffffde9a,0xffbeffdf,0xffffffff,0xffffffff,0xde79ffde,0x00002903,0x10401040,0x00000800,0x080018a2,0x10401041,0x18a20820,0x00001041,0x08400000,0x000018c2,0xffde8c50,0xffffffde,0xffdfffde,0x20c3e6db,0x10820000,0x000010a1,
-0xe71b39c6,0xffdeffff,0x0000c617,0x00400861,0x08200000,0x00000820,0x18a20000,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08200820,0x082018a2,0x00000000,0x00200861,0x10620000,0xa4d30800,0xffbeffff,0xffffffbe,0x00209491,0x104018a2,0x39650000,
-0xffdfeefb,0xffdeffdf,0xce38ffdf,0x00200000,0x00200020,0x10610820,0x000010a2,0x00200000,0x00400881,0x10810861,0x10810000,0x29040000,0xffdfe69a,0xffffff9e,0xffffffff,0xffdef7df,0xde58ffff,0x00001041,0x10210820,0x10821061,0x10810840,0x00000800,0x00401081,0x10c20840,0x00201082,0x00200881,0xffff83ef,0xff9effde,0xff9effbf,0x080093f0,0x000018a2,0x000018e3,
-0xfffea554,0xffffffde,0x0840d658,0x08610000,0x08400020,0x10610820,0x00001061,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x08200000,0x106118a2,0x00200000,0x18a20000,0xbd760000,0xffbeffff,0xffffffbe,0x5248f75c,0x18810800,0x080018c2,
-0xff9e93f0,0xf71cffbe,0x41c7acd3,0x00400000,0x00610020,0x18820000,0x08610000,0x0000630b,0x10c20000,0x00001061,0x00000840,0x08000861,0xde396acb,0xffbfffbf,0xffdeffbf,0xffffffff,0x7b4de6ba,0x10410000,0x00210841,0x08610000,0x00001082,0x18a20000,0x00200020,0x004108a2,0x00000040,0x00000881,0xa4b220c2,0xffbff73c,0xde59ffbf,0x10002062,0x10a21041,0x634c0000,
-0xffdff77d,0xffdfffbe,0x1882ce18,0x08410000,0x00000000,0x00000000,0x08400000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x08400020,0x6b4d0800,0xff9ed659,0xff7dffff,0xd658ffff,0x08201061,0x08000820,
-0xbd141820,0x49c7b514,0x00001000,0x00400040,0x00200020,0x000010a2,0xce584208,0xce59f77d,0x00006b4d,0x10a20000,0x00200000,0x08200820,0x20621000,0xee9ba431,0xffdfff9e,0x9c91ef1c,0x08003124,0x08411061,0x00000020,0x000010a3,0x5aca0000,0xd679c5f7,0x0000842f,0x08820000,0x00200000,0x00200000,0x08000000,0xc59649c7,0x6acbde7a,0x18610800,0x00000820,0xd6ba1081,
-0xffbeffdf,0x9c71e6ba,0x080041a6,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00400000,0x00000841,0x7b4d1861,0xffdfde39,0xffffffde,0x0000840f,0x080018c2,
-0x10200000,0x08000000,0x10401861,0x00400040,0x00610081,0x6b0c0000,0xffffe71c,0xffffffff,0xb596f79e,0x000039c7,0x00000861,0x08000000,0x08001861,0x31041000,0xb4f3b4d3,0x000041c7,0x10810000,0x00000840,0x08610041,0x31660000,0xf79da4f3,0xffffffff,0xce59f7be,0x00006b4d,0x00200820,0x00000841,0x20c20820,0x10400000,0x080018a2,0x08001862,0x00001882,0xffdf8c10,
-0x9410eefb,0x08003104,0x10210800,0x00000000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10820020,0x08001020,0x943128c3,0xffffd658,0x5aaaf77d,0x10810000,
-0x08610840,0x10411081,0x08201861,0x00200000,0x000008a1,0xff7e734d,0xf7deffff,0xfffff7de,0xffbeffff,0x7befe75c,0x10810000,0x00000000,0x08410000,0x08001881,0x08000800,0x18820800,0x00200861,0x00200020,0x00000881,0xe6fb7bcf,0xffffffff,0xf7fef7fe,0xffffffff,0x9cb2ffbe,0x10620000,0x00200000,0x00000000,0x08611081,0x10410820,0x10410800,0x00000820,0xacf3ad14,
-0x080049e7,0x20a20800,0x00001861,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18a21061,0x00000800,0x7b6d1862,0x9cb2c5d7,0x08810000,
-0x00200040,0x108110a1,0x00000000,0x00001041,0x08001082,0xffffa4d3,0xffffffdf,0xffdfffff,0xffffffde,0xce99ffff,0x00400000,0x00200841,0x08400881,0x08400020,0x18a21061,0x08001061,0x10811061,0x00600000,0x00200020,0xffffd699,0xffdeffde,0xffffffde,0xffdeffff,0xd658ffff,0x08210800,0x00000840,0x10611081,0x08610840,0x08400861,0x00000800,0x10410820,0x08001020,
-0x10610800,0x08201882,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18a20841,0x08001000,0x21030800,0x00200861,
-0x08400020,0x00000000,0x39861061,0x08410000,0x00001882,0xffdfad34,0xffffffbe,0xffffffdf,0xf7deffff,0xd699ffff,0x00000841,0x00200841,0x00400000,0x00201081,0x00200020,0x18a20841,0x00000000,0x08600861,0x10810000,0xffffdeb9,0xffffffbe,0xffffffff,0xf7deffff,0xd658ffff,0x00000820,0x00200861,0x00000000,0x00200000,0x00200020,0x08200020,0x00000000,0x10410820,
-0x00201041,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x18a20820,0x00001061,0x00000000,
-0x00200840,0x94923186,0xa4f3ef1c,0x10810020,0x002010a2,0xffffa513,0xffdeffff,0xfffffffe,0xfffff7de,0xdedaffde,0x00002944,0x21030000,0x00004a89,0x10a20020,0x10a10861,0x00000000,0x62cb5229,0x08610000,0x18c20020,0xffffdeb9,0xffdfffbe,0xf7beffbe,0xfffef7ff,0xc5f7fffe,0x08410000,0x00000040,0x6b4d840f,0x00001081,0x00200040,0x00000000,0x00000000,0x08200000,
-0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x00000000,0x00200020,0x00000000,
-0x00000040,0xb57539e7,0xde9aff9e,0x08610000,0x000010c2,0xffffa514,0xffdef7be,0xf7beffde,0xf79dffde,0xe6dbffff,0x00003144,0x4a080800,0xbdd6ef3c,0x00004228,0x00000000,0x9cf32103,0xce18ff9e,0x08400000,0x10810000,0xffbee6b9,0xffbeff9e,0xffffffde,0xf7def7de,0xc5f6ffff,0x10820000,0x00000841,0xef1cdeda,0x0000630b,0x00200861,0x00000000,0x00000020,0x00000000,
-0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,
-0x00400020,0x00000820,0x8bcf5a29,0x00001862,0x000010a2,0xeefb734d,0xffffffdf,0xffdef7be,0xffbeffde,0xc596ffdf,0x18810800,0x41c60820,0xffdff73c,0x9492ef1c,0x73ce0000,0xffbed6ba,0xd679ffdf,0x08001881,0x08000840,0xee9a730c,0xffdfffdf,0xf7fef7de,0xfffffffe,0x83aef6fb,0x10a30000,0x00000000,0x7b6d8c30,0x00001061,0x00200020,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,
-0x00000000,0x18820841,0x08000800,0x08200800,0x18820020,0x39650800,0xf75dacf3,0xffdeffbe,0xe69affde,0x18418baf,0x10610800,0x29440000,0xffffd659,0xffdeffbe,0xf7bee71c,0xffdeffdf,0xce58ffff,0x08001061,0x10401061,0x30c31000,0xf75cacd3,0xfffeffff,0xb575ffde,0x080051e8,0x00211041,0x00200020,0x08000800,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x18621041,0x00200000,0x00200020,0x08001061,0x5a490800,0xee9abd55,0x30c3b4b3,0x08200800,0x08610840,0x00000861,0xffdece99,0xffdfffff,0xffffffff,0xffffffde,0xdebaffdf,0x00002965,0x00000861,0x080018a2,0x72eb1020,0xde38d5f7,0x10207b2c,0x18620800,0x00210000,0x00000020,0x10411861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18610000,0x08001861,0x20411000,0x08001000,0x08401882,0x18e20861,0x634c0000,0xffffef9d,0xffffffff,0xffffffff,0xffdeffff,0xef5cffff,0x00004228,0x002018e3,0x08610020,0x08001041,0x20412041,0x10410800,0x00001882,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610820,0x08201061,0x08411061,0x08610000,0x00000000,0xe71c62eb,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0xffffffde,0x39e7c638,0x08610000,0x00000841,0x10610840,0x10211041,0x08201041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410020,0x00200841,0x08410841,0x00001061,0xbdb6528a,0xfffff79d,0xfffff79e,0xffdeffff,0xffffffff,0xffffffff,0xffffffde,0xe73cffff,0x00006b6d,0x00200861,0x08410020,0x00200020,0x00200841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08000000,0x00001041,0xe6db7bae,0xffdfffdf,0xffbeffde,0xffffffff,0xffffffde,0xffdeffff,0xffdeffde,0xffffffde,0x73aeffff,0x10820000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x10410800,0x29040000,0xbd96732c,0xffbef75d,0xffdfffdf,0xffdeffde,0xffffffdf,0xffdfffdf,0xd679f77d,0x528a9cb2,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00001881,0x10200800,0xacb25a49,0xff5deeba,0xffbfff9e,0xff1cff9e,0xa492d5f8,0x10416aeb,0x00000000,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x18810000,0x186120a2,0x08000800,0x8b8e30e3,0xd5d7cdb7,0x626aa451,0x08001841,0x10200800,0x10611882,0x08210000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200020,0x08200000,0x18a21882,0x00000000,0x08000800,0x00000800,0x18821020,0x10611882,0x00000800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000840,0x08400000,0x18c21061,0x108110a2,0x106118c2,0x08201041,0x00000820,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x08200820,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200020,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0 };
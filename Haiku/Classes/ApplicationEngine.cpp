@@ -1,5 +1,6 @@
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 using namespace std;
 
@@ -47,6 +48,7 @@ void ApplicationEngine::Initialize(int width, int height)
 
 void ApplicationEngine::Render() const
 {
+    PROFILE_ZONE("ApplicationEngine::Render");
     string poem1 = "Haikus are easy\n"
                    "But sometimes they don't make sense\n"
                    "Refrigerator\n";
@@ -69,6 +71,7 @@ void ApplicationEngine::Render() const
 
 void ApplicationEngine::UpdateAnimation(float dt)
 {
+    PROFILE_ZONE("ApplicationEngine::UpdateAnimation");
     m_timestamp += dt;
     
     // The page falls down when untouched:
@@ -0,0 +1,101 @@
+#import <UIKit/UIKit.h>
+#import <string>
+#import <vector>
+#import "Interfaces.hpp"
+#import "../../Common/Classes/GlyphCache.hpp"
+
+using namespace std;
+
+// Draws one character at a time with UIKit into an alpha-only bitmap, then
+// trims the bitmap down to its ink.
+class GlyphRasterizer : public IGlyphRasterizer {
+public:
+    GlyphRasterizer(const string& fontName, float size)
+    {
+        NSString* name = [NSString stringWithUTF8String:fontName.c_str()];
+        m_font = [UIFont fontWithName:name size:size];
+        if (!m_font)
+            m_font = [UIFont systemFontOfSize:size];
+        [m_font retain];
+        m_ascent = (int) ceilf(m_font.ascender);
+        m_descent = (int) ceilf(-m_font.descender);
+    }
+    ~GlyphRasterizer()
+    {
+        [m_font release];
+    }
+    int GetLineHeight() const
+    {
+        return (int) ceilf(m_font.leading);
+    }
+    bool Rasterize(unsigned int codepoint, GlyphBitmap& bitmap)
+    {
+        unichar characters[2];
+        int length = 1;
+        if (codepoint > 0xffff) {
+            codepoint -= 0x10000;
+            characters[0] = 0xd800 + (codepoint >> 10);
+            characters[1] = 0xdc00 + (codepoint & 0x3ff);
+            length = 2;
+        } else {
+            characters[0] = codepoint;
+        }
+        NSString* text = [NSString stringWithCharacters:characters length:length];
+        CGSize size = [text sizeWithFont:m_font];
+
+        // Leave a margin for italic overhangs and swashes that reach past
+        // the advance.
+        int margin = m_ascent / 2;
+        int width = (int) ceilf(size.width) + margin * 2;
+        int height = m_ascent + m_descent + margin * 2;
+        vector<unsigned char> canvas(width * height);
+        CGContextRef context = CGBitmapContextCreate(&canvas[0], width, height, 8, width,
+                                                     0, kCGImageAlphaOnly);
+        CGContextTranslateCTM(context, 0, height);
+        CGContextScaleCTM(context, 1, -1);
+        UIGraphicsPushContext(context);
+        [text drawAtPoint:CGPointMake(margin, margin) withFont:m_font];
+        UIGraphicsPopContext();
+        CGContextRelease(context);
+
+        int left = width, right = -1, top = height, bottom = -1;
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (canvas[y * width + x]) {
+                    left = min(left, x);
+                    right = max(right, x);
+                    top = min(top, y);
+                    bottom = max(bottom, y);
+                }
+            }
+        }
+
+        GlyphMetrics& metrics = bitmap.Metrics;
+        metrics.XAdvance = (int) (size.width + 0.5f);
+        if (right < 0) {
+            metrics.XBearing = metrics.YBearing = 0;
+            metrics.Width = metrics.Height = 0;
+            bitmap.Texels.clear();
+            return true;
+        }
+
+        metrics.XBearing = left - margin;
+        metrics.YBearing = top - (margin + m_ascent);
+        metrics.Width = right - left + 1;
+        metrics.Height = bottom - top + 1;
+        bitmap.Texels.resize(metrics.Width * metrics.Height);
+        for (int y = 0; y < metrics.Height; ++y)
+            memcpy(&bitmap.Texels[y * metrics.Width],
+                   &canvas[(top + y) * width + left], metrics.Width);
+        return true;
+    }
+private:
+    UIFont* m_font;
+    int m_ascent;
+    int m_descent;
+};
+
+IGlyphRasterizer* CreateGlyphRasterizer(const string& fontName, float size)
+{
+    return new GlyphRasterizer(fontName, size);
+}
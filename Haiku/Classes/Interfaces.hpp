@@ -63,14 +63,17 @@ struct IRenderingEngine {
 };
 
 struct ITextRenderer {
-    virtual void Initialize() = 0;
+    virtual void Initialize(ivec2 viewportSize) = 0;
+    virtual void BeginFrame() const = 0;
     virtual void RenderText(ivec2 position, const string& text) const = 0;
     virtual ~ITextRenderer() {}
 };
 
+struct IGlyphRasterizer;
+
 struct IResourceManager {
     virtual TextureDescription LoadImage(const string& filename) = 0;
-    virtual TextureDescription ParsePvrHeader(const unsigned long* imageData) = 0;
+    virtual TextureDescription ParsePvrHeader(const void* imageData, size_t imageSize) = 0;
     virtual void* GetImageData() = 0;
     virtual void UnloadImage() = 0;
     virtual ~IResourceManager() {}
@@ -78,6 +81,7 @@ struct IResourceManager {
 
 IApplicationEngine* CreateApplicationEngine(IRenderingEngine*);
 IResourceManager* CreateResourceManager();
+IGlyphRasterizer* CreateGlyphRasterizer(const string& fontName, float size);
 
 namespace ES1  { IRenderingEngine* CreateRenderingEngine(IResourceManager*); }
 namespace ES1  { ITextRenderer* CreateTextRenderer(); }
@@ -1,8 +1,11 @@
 #include <OpenGLES/ES1/gl.h>
 #include <OpenGLES/ES1/glext.h>
+#include "../../Common/Classes/GlStateCache.hpp"
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/PvrTexture.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <iostream>
 
 using namespace std;
@@ -93,7 +96,7 @@ void RenderingEngine::Initialize()
     m_pageSubsize = ivec2(400, 100);
 
     PrettyPrintExtensions();
-    m_textRenderer->Initialize();
+    m_textRenderer->Initialize(m_pageSubsize);
     
     // Create vertex buffer objects.
     m_drawables.Quad = CreateDrawable(Quad(m_pageSubsize));
@@ -164,6 +167,7 @@ void RenderingEngine::Render(const string& poem1,
                              const string& poem2,
                              float pageCurl) const
 {
+    PROFILE_ZONE("ES1::RenderingEngine::Render");
     glViewport(0, 0, m_pageSubsize.x, m_pageSubsize.y);
     glMatrixMode(GL_PROJECTION);
     glLoadIdentity();
@@ -171,6 +175,7 @@ void RenderingEngine::Render(const string& poem1,
     glLoadIdentity();
 
     ivec2 textPosition(30, 70);
+    m_textRenderer->BeginFrame();
 
     glBindFramebufferOES(GL_FRAMEBUFFER_OES, m_framebuffers.Page1);
     glBindRenderbufferOES(GL_RENDERBUFFER_OES, m_renderbuffers.Page1);
@@ -287,10 +292,20 @@ void RenderingEngine::UploadTexture(const TextureDescription& desc,
             type = GL_UNSIGNED_BYTE;
             bitsPerPixel = 24;
             break;
+        case TextureFormat5551:
+            format = GL_RGBA;
+            type = GL_UNSIGNED_SHORT_5_5_5_1;
+            bitsPerPixel = 16;
+            break;
         case TextureFormatRgba:
             format = GL_RGBA;
-            type = GL_UNSIGNED_BYTE;
-            bitsPerPixel = 32;
+            if (desc.BitsPerComponent == 4) {
+                type = GL_UNSIGNED_SHORT_4_4_4_4;
+                bitsPerPixel = 16;
+            } else {
+                type = GL_UNSIGNED_BYTE;
+                bitsPerPixel = 32;
+            }
             break;
         case TextureFormatGray:
             format = GL_ALPHA;
@@ -301,23 +316,22 @@ void RenderingEngine::UploadTexture(const TextureDescription& desc,
     
     int w = desc.Size.x;
     int h = desc.Size.y;
+    const unsigned char* bytes = (const unsigned char*) data;
     
-    int level = 0;
-    while (w && h) {
-        GLsizei size = w * h * bitsPerPixel / 8;
-        
+    // MipCount includes the base level.
+    for (int level = 0; level < desc.MipCount; ++level) {
         if (compressed) {
-            size = max(size, 32);
-            glCompressedTexImage2D(GL_TEXTURE_2D, level, format, w, h, 0, size, data);
+            PvrPixelType pvrType = bitsPerPixel == 2 ? PvrPixelTypePvrtc2 :
+                                                       PvrPixelTypePvrtc4;
+            GLsizei size = PvrTexture::ComputeLevelSize(pvrType, w, h);
+            glCompressedTexImage2D(GL_TEXTURE_2D, level, format, w, h, 0, size, bytes);
+            bytes += size;
+        } else {
+            glTexImage2D(GL_TEXTURE_2D, level, format, w, h, 0, format, type, bytes);
+            bytes += w * h * bitsPerPixel / 8;
         }
-        else
-            glTexImage2D(GL_TEXTURE_2D, level, format, w, h, 0, format, type, data);
-        
-        if (level < desc.MipCount - 1)
-            data += size;
-        
-        w >>= 1; h >>= 1; level++;
-        break;
+        w = max(w >> 1, 1);
+        h = max(h >> 1, 1);
     }
 }
     
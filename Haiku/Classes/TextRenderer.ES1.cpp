@@ -1,99 +1,184 @@
 #include <OpenGLES/ES1/gl.h>
 #include <OpenGLES/ES1/glext.h>
-#include "../Textures/GlyphsTexture.h"
+#include "../../Common/Classes/GlStateCache.hpp"
 #include "Interfaces.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include "../../Common/Classes/TextBatch.hpp"
 
-typedef unsigned int PVRTuint32;
+namespace ES1 {
 
-struct PVR_Texture_Header
-{
-	PVRTuint32 dwHeaderSize;			/*!< size of the structure */
-	PVRTuint32 dwHeight;				/*!< height of surface to be created */
-	PVRTuint32 dwWidth;				/*!< width of input surface */
-	PVRTuint32 dwMipMapCount;			/*!< number of mip-map levels requested */
-	PVRTuint32 dwpfFlags;				/*!< pixel format flags */
-	PVRTuint32 dwTextureDataSize;		/*!< Total size in bytes */
-	PVRTuint32 dwBitCount;			/*!< number of bits per pixel  */
-	PVRTuint32 dwRBitMask;			/*!< mask for red bit */
-	PVRTuint32 dwGBitMask;			/*!< mask for green bits */
-	PVRTuint32 dwBBitMask;			/*!< mask for blue bits */
-	PVRTuint32 dwAlphaBitMask;		/*!< mask for alpha channel */
-	PVRTuint32 dwPVR;					/*!< magic number identifying pvr file */
-	PVRTuint32 dwNumSurfs;			/*!< the number of surfaces present in the pvr */
+struct TextBuffer {
+    TextBatch Batch;
+    GLuint VertexBuffer;
+    int LastUsed;
 };
 
-namespace ES1 {
-
 class TextRenderer : public ITextRenderer {
 public:
-    void Initialize();
+    TextRenderer();
+    ~TextRenderer();
+    void Initialize(ivec2 viewportSize);
+    void BeginFrame() const;
     void RenderText(ivec2 position, const string& text) const;
 private:
-    void RenderGlyph(const Glyph& glyph, vec2 position) const;
-    vec2 m_textureSize;
+    TextBuffer& FindBuffer(ivec2 position, const string& text,
+                           const TextStyle& style) const;
+    void UploadDirtyRows() const;
+    IGlyphRasterizer* m_rasterizer;
+    GlyphCache* m_glyphCache;
+    mutable TextLayout m_layout;
+    mutable vector<TextBuffer> m_buffers;
+    mutable int m_renderCount;
     GLuint m_textureHandle;
-    static const int LineHeight = 25;
+    GLuint m_indexBuffer;
+    ivec2 m_viewportSize;
+    static const int AtlasWidth = 256;
+    static const int AtlasHeight = 128;
+    static const int BufferCount = 4;
+    static const int MaxGlyphs = 1024;
 };
-    
+
 ITextRenderer* CreateTextRenderer()
 {
     return new TextRenderer();
 }
-    
-void TextRenderer::Initialize()
+
+TextRenderer::TextRenderer() : m_rasterizer(0), m_glyphCache(0), m_renderCount(0)
+{
+}
+
+TextRenderer::~TextRenderer()
 {
+    delete m_glyphCache;
+    delete m_rasterizer;
+}
+
+void TextRenderer::Initialize(ivec2 viewportSize)
+{
+    m_viewportSize = viewportSize;
+    m_rasterizer = CreateGlyphRasterizer("Georgia-Italic", 20);
+    m_glyphCache = new GlyphCache(m_rasterizer, AtlasWidth, AtlasHeight);
+
+    // The atlas starts out empty; glyphs get rasterized into it as they're
+    // first drawn.
     glGenTextures(1, &m_textureHandle);
     glBindTexture(GL_TEXTURE_2D, m_textureHandle);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    
-    PVR_Texture_Header* header = (PVR_Texture_Header*) GlyphsTexture;
-    const unsigned char* bytes = (unsigned char*) GlyphsTexture;
-    const unsigned char* imageData = bytes + header->dwHeaderSize;
-    GLenum type = GL_UNSIGNED_BYTE;
-    GLenum format = GL_ALPHA;
-    int w = header->dwWidth;
-    int h = header->dwHeight;
-    m_textureSize = vec2(w, h);
-    glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, imageData);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, AtlasWidth, AtlasHeight, 0,
+                 GL_ALPHA, GL_UNSIGNED_BYTE, m_glyphCache->GetTexels());
+    m_glyphCache->ClearDirtyRows();
+
+    // Every string shares one index buffer, big enough for the longest.
+    vector<unsigned short> indices;
+    BuildQuadIndices(MaxGlyphs, indices);
+    glGenBuffers(1, &m_indexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(indices[0]),
+                 &indices[0], GL_STATIC_DRAW);
+
+    m_buffers.resize(BufferCount);
+    for (int i = 0; i < BufferCount; ++i) {
+        glGenBuffers(1, &m_buffers[i].VertexBuffer);
+        m_buffers[i].LastUsed = 0;
+    }
+}
+
+// Every string drawn until the next call keeps its glyphs in the atlas, so
+// strings in the same frame can't evict each other's.
+void TextRenderer::BeginFrame() const
+{
+    m_glyphCache->BeginFrame();
 }
-    
+
+// The text is UTF-8, and wraps to leave as much room on the right as the
+// position leaves on the left.  Each string is a single draw call, and its
+// vertex buffer only gets refilled when the text, its position, or the
+// atlas changes.  Leaves the vertex, normal, and texture coordinate arrays
+// enabled, the way the rendering engine sets them up.
 void TextRenderer::RenderText(ivec2 position, const string& text) const
 {
+    PROFILE_ZONE("ES1::TextRenderer::RenderText");
+    TextStyle style;
+    style.MaxWidth = m_viewportSize.x - 2 * position.x;
+
+    ++m_renderCount;
+    TextBuffer& buffer = FindBuffer(position, text, style);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer.VertexBuffer);
+    if (buffer.Batch.Update(*m_glyphCache, m_layout, text, position.x, position.y, style)) {
+        const vector<float>& vertices = buffer.Batch.GetVertices();
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float),
+                     vertices.empty() ? 0 : &vertices[0], GL_DYNAMIC_DRAW);
+    }
+
+    int quadCount = std::min(buffer.Batch.GetQuadCount(), (int) MaxGlyphs);
+    if (!quadCount)
+        return;
+
     glBindTexture(GL_TEXTURE_2D, m_textureHandle);
+    UploadDirtyRows();
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glEnable(GL_TEXTURE_2D);
-    
-    int x = position.x;
-    for (const char* digit = &text[0]; *digit; ++digit) {
-        if (*digit == '\n') {
-            position.x = x;
-            position.y -= LineHeight;
-            continue;
+
+    // Quads are in window coordinates.
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    glOrthof(0, m_viewportSize.x, 0, m_viewportSize.y, -1, 1);
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+
+    int stride = 4 * sizeof(float);
+    const GLvoid* texCoordOffset = (const GLvoid*) (2 * sizeof(float));
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glVertexPointer(2, GL_FLOAT, stride, 0);
+    glTexCoordPointer(2, GL_FLOAT, stride, texCoordOffset);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
+    glDrawElements(GL_TRIANGLES, quadCount * TextBatch::IndicesPerQuad,
+                   GL_UNSIGNED_SHORT, 0);
+    glEnableClientState(GL_NORMAL_ARRAY);
+
+    glPopMatrix();
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glDisable(GL_BLEND);
+}
+
+// Reuses the buffer that last held this string if there is one, otherwise
+// the one that's gone unused the longest.
+TextBuffer& TextRenderer::FindBuffer(ivec2 position, const string& text,
+                                     const TextStyle& style) const
+{
+    int oldest = 0;
+    for (int i = 0; i < BufferCount; ++i) {
+        if (m_buffers[i].Batch.Matches(text, position.x, position.y, style)) {
+            oldest = i;
+            break;
         }
-        int glyphIndex = *digit - '!' + 3;
-        const Glyph& glyph = Glyphs[glyphIndex];
-        RenderGlyph(glyph, position);
-        position.x += glyph.Metrics.XAdvance;
+        if (m_buffers[i].LastUsed < m_buffers[oldest].LastUsed)
+            oldest = i;
     }
-              
-    glDisable(GL_BLEND);
+    m_buffers[oldest].LastUsed = m_renderCount;
+    return m_buffers[oldest];
 }
-    
-void TextRenderer::RenderGlyph(const Glyph& glyph, vec2 position) const
+
+// Sends up the atlas rows that new glyphs landed in.
+void TextRenderer::UploadDirtyRows() const
 {
-    position.x += glyph.Metrics.XBearing;
-    position.y -= glyph.Metrics.Height + glyph.Metrics.YBearing;
-
-    int box[] = { glyph.Position.X,
-                  m_textureSize.y - 1 - glyph.Position.Y - glyph.Metrics.Height,
-                  glyph.Metrics.Width + 1,
-                  glyph.Metrics.Height + 1 };
-    
-    glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_CROP_RECT_OES, box);
-    glDrawTexfOES(position.x, position.y, 0,
-                  glyph.Metrics.Width + 1, glyph.Metrics.Height + 1);
+    int first, count;
+    if (!m_glyphCache->GetDirtyRows(&first, &count))
+        return;
+
+    const unsigned char* texels = m_glyphCache->GetTexels() + first * AtlasWidth;
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, first, AtlasWidth, count,
+                    GL_ALPHA, GL_UNSIGNED_BYTE, texels);
+    m_glyphCache->ClearDirtyRows();
 }
 
 }
@@ -1,403 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT static const unsigned long
-#endif
-
-A32BIT GlyphsTexture[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x00000080,		/* dwHeight */
-0x00000100,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00010016,		/* dwpfFlags */
-0x00008000,		/* dwDataSize */
-0x00000008,		/* dwBitCount */
-0x000000ff,		/* dwRBitMask */
-0x000000ff,		/* dwGBitMask */
-0x000000ff,		/* dwBBitMask */
-0x00000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x07000000,0x00000002,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xa6240000,0x0000004e,0x00000000,0x63000000,0x000165db,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffed1800,0x00002df9,0x00000000,0x07000000,0x03a8ff8c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf7ff6700,0x00000033,0x00000000,0x00000000,0x6affaf00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2a060000,0x00001d3f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x21000000,0x0002273f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xe2ff6c00,0x00000000,0x00000000,0x00000000,0xd8ff4c00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd0220000,0x32c3ffff,0x00000000,0x00000000,0x00000000,0x20000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff9e0000,0x89e6ffff,0x00000010,0x00000000,0x00000000,0x00000000,0x00000000,0xfcff4e00,0x00000009,0x00000000,0x00000000,0xffff2f00,0x00000013,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0a000000,0xf8bda497,0x00000054,0x00000000,0x00000000,0x75000000,0x00000495,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xb4060000,0xdda2a1db,0x00003be7,0x00000000,0x00000000,0x00000000,0x00000000,0xffff2300,0x00000033,0x00000000,0x00000000,0xffff2d00,0x00000028,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x5f000000,0x000039f9,0x00000000,0x00000000,0x4d000000,0x0017bcff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x02000000,0x0045f683,0x00000000,0x00000000,0x00000000,0x00000000,0xffed0100,0x00000061,0x00116300,0x00000000,0xffff2400,0x0000002d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0005dac7,0x00000000,0x00000000,0x27000000,0x5bedffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x15ebc401,0x00000000,0x00000000,0x00000000,0x00000000,0xffbb0000,0x0000008b,0x0fca7700,0x00000000,0xfffe0a00,0x0000002d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0060ff79,0x00000000,0x00000000,0x05000000,0xffb0fcfa,0x00000016,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x8fff5700,0x00000000,0x00000000,0x00000000,0x00000000,0xff980000,0x000000ab,0xa5ff5900,0x00000000,0xffb90000,0x00000058,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00bbff4b,0x00000000,0x00000000,0x00000000,0x5331ffd8,0x00000024,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00193a05,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xf2fc1200,0x0000000a,0x00000000,0x00000000,0x00000000,0xff820000,0x000000cb,0xd1ff3c00,0x00000000,0xf92e0000,0x036076ee,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02f3ff29,0x00000000,0x00000000,0x00000000,0x004fffb2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x8efbffb3,0x00000003,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xffc70000,0x00000056,0x00000000,0x00000000,0x66180000,0xffe88066,0x000000c3,0xefff1f00,0x00000000,0xff600000,0xa3ffffff,0x00000003,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4fffff10,0x00000018,0x00000000,0x00000000,0x006dff8a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x07000000,0xf6c7fffe,0x0000008b,0x2b000000,0x00000026,0x00013618,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x37020000,0xff82000f,0x0000009a,0x00000000,0x00000000,0x8e000000,0xffffffff,0x00000098,0xfffc0400,0x0000000d,0xff920000,0x777b9af9,0x0000002b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x000d4100,0x1b000000,0x0000002a,0x3c240000,0x00000011,0x00000000,0x00000000,0xfffff600,0x0030bffe,0x05000000,0x00001338,0x008bff64,0x03060000,0x00000000,0x00000000,0x3b240100,0x00000015,0x03000000,0x4647fffc,0x00000096,0xfe3a0000,0x0024bfff,0x0ab5ffce,0x00000000,0x00044d00,0x00000000,0x00000000,0x0000177c,0x00296e00,0x00000000,0x173b0c00,0x00000000,
-0x0004350d,0x00000000,0xff790000,0xff375cf2,0x000000d8,0x44444418,0x39444444,0x01000002,0xffe88062,0x0000004d,0xffe30000,0x0000002a,0xff9e0000,0x000000b3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x62f2a200,0xdc000000,0x000aaaff,0xffff9300,0x00088ff8,0x00000000,0x00000000,0xd6ffdb00,0x54f9d19c,0xa6000000,0x0685fbff,0x00a8ff3c,0xeb230000,0x00000d9b,0x00000000,0xffffce2f,0x0027b0fe,0x00000000,0x0058ffe8,0x00000002,0xff620000,0x2fecf6fe,0xb4feffdd,0x00000001,0x0cb7c800,0x00000000,0x00000000,0x0027ddb4,0x32ecab00,0x00000000,0xfaffd60a,0x19000186,
-0x1cceffdf,0x00000000,0xffbc0000,0xe85cf2e1,0x00000ffc,0xffffea10,0xffffffff,0x000007c9,0xff370000,0x000002db,0xffc60000,0x00000048,0xff810000,0x000000c5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xa8ff8400,0xfa000000,0x02b1fbff,0xe7fffe24,0x0ab9eca6,0x00000000,0x00000000,0x6cffc200,0xf9c80600,0xf6000035,0xaceecaff,0x00c6ff19,0xff080000,0x000033ff,0x00000000,0xc9ffa409,0x20eef9a6,0x00000000,0x0073ffcf,0x00000000,0xff500000,0xe8b910ee,0xf884ffd3,0x00000048,0xb2fff100,0x00000000,0x00000000,0x00cbffc1,0xcaffcc00,0x00000000,0xb0d32400,0xae0093fc,
-0xb8dae3ff,0x00000000,0xffc30000,0xbdf13b96,0x000043ff,0xffff6900,0xae9999c3,0x000013c8,0xf5000000,0x000033ff,0xffa90000,0x00000066,0xff640000,0x000000e7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xc6ff6600,0xe8000000,0x35f881ff,0x3affff4e,0x97f62b00,0x00000000,0x00000000,0x98ffa900,0xff3f0000,0xfc0101cd,0xd31e4eff,0x00e4ef80,0xeb000000,0x000051ff,0x00000000,0x00390000,0x85ffce00,0x00000000,0x0091ffb1,0x00000000,0xff350000,0xc50800f9,0x527bfffe,0x0000000e,0xffffff1d,0x0000005c,0x00000000,0x38ffffd3,0xffffec00,0x00000049,0x00000000,0xfe82ff66,
-0x612d42ff,0x00000000,0xffc30000,0xf17d0087,0x000078ff,0xff960000,0x000010dd,0x00000000,0xf0000000,0x000052ff,0xff8c0000,0x00000083,0xff390000,0x00001cff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xf3ff4900,0xd6000006,0x04436eff,0x04ffff47,0xfea10000,0x00000035,0x00000000,0xe5ff8f00,0xe8020004,0xe7003bff,0x150062ff,0x05fce4d6,0xcf000000,0x000079ff,0x00000000,0x00000000,0x72ffff69,0x00000000,0x00b0ff93,0x00000000,0xff180000,0x240015ff,0x00a3fff5,0x00000000,0xb5fcff59,0x00001cee,0x00000000,0xa7f9ffed,0xd8fbff0f,0x000003ce,0x00000000,0xffff9d00,
-0x000000c7,0x00000000,0xffc30000,0xe50a0087,0x0000aeff,0xa6030000,0x0001b1ff,0x00000000,0xf0000000,0x00005aff,0xff6e0000,0x000000a0,0xfc0a0000,0x00004fff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffff2b00,0xbb000044,0x000086ff,0x07fffc18,0xff6d0000,0x000000a0,0x1d000000,0xf3ff7403,0xca00006d,0xa5007bff,0x000084ff,0x21ffff55,0xb3000000,0x0000b9ff,0x00000000,0x5a000000,0x0ac8fffc,0x554f0200,0x55dbffa7,0x00014e55,0xf9010a00,0x00002fff,0x00c9ff99,0x00000000,0x16d2ff9d,0x0001b9eb,0x11000000,0xfc8affff,0x47d8ff6b,0x000073ff,0x00000000,0xffff1a00,
-0x00000058,0x00000000,0xffc30000,0x84000087,0x0000e3ff,0x06000000,0x0077ffbd,0x00000000,0xd6000000,0x00005bff,0xff510000,0x000000be,0xd9000000,0x000078ff,0x00170000,0x0e000000,0x00001a4e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffff0e02,0x9e0002cb,0x00009fff,0x2dffb500,0xff5f0000,0x000000dd,0x53000000,0xa9ff7fc5,0xb6003cf2,0x3c0097ff,0x0000d8ff,0x3ffffb07,0x99000000,0x0034feff,0x00000000,0xf9380000,0x0018d9ff,0xf3440000,0xffffffff,0x05a2ffff,0xdf47c300,0x000045ff,0x00f1ff49,0x03000000,0x0095ffe4,0x0060ff5f,0x3c060000,0xd810ffff,0x00aafff3,0x001ef3b7,0x00000000,0xffff6900,
-0x00000067,0x18000000,0xffc807ae,0x38000087,0x001bffff,0x10930500,0x3cfcd20f,0x00000000,0xae000000,0x000076ff,0xff340000,0x000000dc,0xb1000000,0x00009bff,0x00c74d00,0xe83f0000,0x0034f0ff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffef2ec6,0x8d0089eb,0x0000b9ff,0x9bf72c00,0xff850000,0x000000ee,0x17000000,0xb6fffebf,0xe07ef678,0x00008fff,0x005effa0,0x5cffd600,0x7b791a00,0x0acaf5ff,0x00000000,0xff9f0000,0x000023ec,0x34000000,0x90ffff9d,0x43888888,0xecec8800,0x000060ff,0x1dffff1d,0x4c4f6200,0x0040ffff,0x13ede804,0x6e9c6900,0x6d00ddff,0x0080ffff,0x00a4ff45,0x63180000,0xe1ffdb03,
-0x000028f3,0x19000000,0xffeaa8f5,0x06000076,0x005cfff9,0xe8ff1300,0xeaea2438,0x0000001d,0x49000000,0x0003cfff,0xff160000,0x000001f8,0xd80d0000,0x000098ff,0x10f86300,0xfcf95a00,0x02d0d69e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffecd6ad,0xb4a2d681,0x0000caff,0xfe5e0000,0xfff06d95,0x000000d4,0x00000000,0xe7f16001,0xfff97300,0x00004fff,0x77f6be0a,0x7effe15c,0xaafb3200,0xc0a0e0ff,0x00005c65,0xff820000,0x40c266ca,0x00000000,0x26ffff17,0x00000000,0xffa10300,0x000057ff,0x57fff501,0xd3c99c00,0x0001d5ff,0x70ffe318,0xe7f56700,0x13009cff,0x005cfff9,0x11fcff69,0xf6540000,0x1ff7ff9b,
-0x1b68dcc1,0x00000000,0xffffea43,0x0000003e,0x00a9ffc5,0xffdc0000,0xfed49a89,0x000001c7,0x00000000,0x0a9fff93,0xe0000000,0x000017ff,0xffdd1100,0x000045fe,0xb0f31700,0x49f3fe9a,0x2eff3f00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffffb50a,0xffbd1868,0x0000b5ff,0x5b000000,0xfffffff2,0x00000068,0x00000000,0xcf240000,0x73260019,0x00000056,0xfb8f0800,0xb3ffffff,0xf35c0000,0xb106e3ff,0x0ca4ffff,0xb80a0000,0xf7ffffff,0x00000047,0x36a35201,0x00000000,0x4c000000,0x00000774,0x5c6c1d00,0xffed2200,0x000045fb,0x6dffe33b,0xffc70500,0x00003efe,0x0041ff79,0x1df9fa64,0xb8030000,0x0071ffff,
-0xe6ffc10f,0x0000003a,0x556e1500,0x00000000,0x06904203,0xf5440000,0xffffffff,0x00004dff,0x00000000,0x96db6100,0x23000000,0x000035e3,0xc33f0000,0x0000004f,0xfe620000,0x0031ddff,0x2bf30300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x76520100,0x4701000b,0x0000267b,0x00000000,0x447d6714,0x00000000,0x00000000,0x08000000,0x00000013,0x00000000,0x19000000,0x2d708163,0x1e000000,0x00004075,0x13517b49,0x00000000,0x497b7039,0x00000005,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x79230000,0x00000037,0x015c1300,0x700c0000,0x0000004b,0x00246e00,0x00384500,0x04000000,0x00005466,
-0x6e590300,0x00000024,0x00000000,0x00000000,0x00000000,0x28000000,0x88888876,0x00005f88,0x00000000,0x12020000,0x00000000,0x00003b24,0x00000000,0x00000000,0x40000000,0x00000e59,0x00220000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x925f1000,0x00054e89,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xff8e0300,0x41ddffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x5a000000,0xfc9f4d62,0x0000004e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x004c6e00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x9e000000,0x000029f5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7c2d0000,0x03458398,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xbbbb5500,0x3cb9bbbb,0x00000000,0x00000000,0x49ffd200,0xbbbbb424,0x0288bbbb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2a000000,0x0000b1ff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xe32b0000,0xd1ffffff,0x00000030,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff5b00,0xf7ffffff,0x00000051,0x00000000,0x14fefe14,0xffee3e00,0x97ffffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000ffbee,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x11000000,0xa4425767,0x000038f0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xddff3e00,0x22222222,0x0000001f,0x00000000,0x00d2ff54,0x22120000,0xe1ff4922,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0050ffc3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01000000,0x000be0d1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf3ff2100,0x00000000,0x00000000,0x00000000,0x0092ff93,0x00000000,0xfbff1400,0x00000003,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0079ffaa,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x006bff84,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfffc0600,0x00000012,0x00000000,0x00000000,0x0051ffd4,0x00000000,0xfff50000,0x0000001d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x99996400,0x00064986,0x00000000,0x00000000,0x00000000,0x79840d00,0x8304001e,
-0x0000107c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00a1ff8f,0x00000000,0x00000000,0x85936607,0x0000074d,0x00000000,0x00035184,0x76750000,0x0000000c,0x00000000,0x00000000,0x00000000,0x00c6ff44,0x86000000,0x0100034b,0x0009756c,0x528e1800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffe60000,0x00000030,0x00000000,0x16000000,0x0013fcfe,0x00000000,0xffd90000,0x0000003a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff7900,0x3ad9ffff,0x00000000,0x00000000,0x00000000,0xffff8f00,0xff3f59f1,
-0x001dd4ff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00bdff74,0x00000000,0x0d000000,0xffffffd1,0x0055e3ff,0x00000000,0x007dffa8,0xffff1e00,0x00001bd3,0x00000000,0x00000000,0x00000000,0x0cfbff1e,0xb5000000,0x93007eff,0x15cfffff,0xffff7900,0x00000095,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffc80000,0x0000004d,0x00000000,0x56000000,0x0000d0ff,0x00000000,0xffbb0000,0x00000057,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf7ff4900,0xf7c34b5b,0x00000048,0x00000000,0x00000000,0xb6ffbe00,0xff86f880,
-0x02cbbdff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00d9ff5b,0x00000000,0x86000000,0x58c9ffff,0x8af78648,0x00000001,0x009bff8a,0xffff1c00,0x0000c4e1,0x00000000,0x00000000,0x00000000,0x39fff902,0x97000000,0xff5c9dff,0x83d168f9,0xe6ff7e00,0x000063f8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffab0000,0x0000006a,0x00000000,0x96000000,0x00008fff,0x00000000,0xff9e0000,0x00000075,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfeff2c00,0xe513000b,0x00001aed,0x00000000,0x00000000,0x91ffb900,0xfffc5100,
-0x13df3aff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00f2ff42,0x00000000,0xc1000000,0x0009d6ff,0xff460000,0x00000080,0x00b8ff6e,0xffff0c00,0x000fec59,0x0057931c,0x00000000,0x00000000,0x5cffd600,0x7b000000,0xffeccdff,0x1c230079,0xd5ff6b00,0x0000ae92,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x99999972,0x00589999,0x00000000,0x52000000,0x99999999,0x99999999,0x00002f80,0xff8e0000,0x00000088,0x00000000,0xd6000000,0x00004dff,0x00000000,0xff800000,0x00000091,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0f00,0x87000042,0x000093ff,0x00000000,0x00000000,0xabff9200,0xff930000,
-0x00043cff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0bffff27,0x00000000,0xb7000000,0x00008eff,0xc9000000,0x00002afe,0x03f1ff52,0xfff70000,0x00000d4d,0x88ffff76,0x00000000,0x00000000,0x7cffbb00,0x5e000000,0xe4fffeff,0x00000007,0xebff4c00,0x00001617,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffffd518,0x73feffff,0x00000000,0xa7000000,0xffffffff,0xffffffff,0x0068fbff,0xff710000,0x000000a5,0x00000000,0xff180000,0x000010fc,0x00000000,0xff640000,0x000000af,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfff10000,0x440000a3,0x0002eaff,0x00000000,0x00000000,0xd9ff4500,0xfc1a0000,
-0x000059ff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x24ffff0d,0x00000000,0x7c000000,0x0000a4ff,0x93000000,0x00008eff,0x4effff35,0xffdb0000,0x00000066,0xf0efff66,0x0000005f,0x00000000,0x95ff9f00,0x41000000,0xfbd9ffff,0x000041dc,0xffff3000,0x00000008,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x9d6e1600,0x4453f6ff,0x0000000a,0x21000000,0x4eeafff0,0x44444444,0x00c39d51,0xff530000,0x000000c2,0x00000000,0xff580000,0x000000cc,0x00000000,0xff460000,0x000000cc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfbd50000,0x2a0041dd,0x0021ffff,0x00000000,0x00000000,0xffcb0100,0xca000038,
-0x000075ff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3efff300,0x00000000,0x18000000,0x001af3ef,0x78000000,0x0000c3ff,0xdaffff19,0xffc40009,0x00000080,0x6cf3ff48,0x000000af,0x00000000,0xaeff8400,0x24000000,0x268bffff,0x0044fcd4,0xffff1300,0x00000024,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x007bffe8,0x00000000,0x00000000,0xa8fffc47,0x00000001,0x00000000,0xff360000,0x000000e0,0x00000000,0xff980000,0x0000008b,0x00000000,0xff2a0000,0x000000e8,0x0000000b,0x01000000,0x0000199d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffb90000,0x2237ec83,0x0031ffff,0x00000000,0x00000000,0xf3290000,0x9e000fd2,
-0x000091ff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x56ffd900,0x00000000,0x00000000,0x03b7fe56,0x6b000000,0x0000e6ff,0xf5fffa02,0xffb007b6,0x00000097,0x28ffff24,0x00000011,0x00000000,0xcaff6a00,0x08000000,0x50ece4ff,0x00ddff47,0xfff50000,0x00000041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00bfffad,0x00000000,0x00000000,0xffff6d00,0x0000007f,0x00000000,0xff190000,0x000002fa,0x00000000,0xffd80000,0x0000004b,0x00000000,0xff0c0000,0x000008ff,0x00026e58,0x5f000000,0x0000b7ff,0x00000000,0x00000000,0x00000000,0x00000000,0x7f820c00,0x84040021,0x00000f7b,0xff9d0000,0xd2f89657,0x001bffff,0x90720a00,0x0000045b,0x3f000000,0xf0b9e4f3,
-0x0000aeff,0x00000000,0x93500000,0x0000207b,0x00000000,0x7b010000,0xcdffecaa,0x0057aaaa,0x00000000,0xb9fc6000,0x5e000c6e,0x0000f0ff,0x69ffdd00,0xffe8dfc1,0x000000a3,0x50fff904,0x00000000,0x01000000,0xe3ff5000,0x00000000,0xfa72fceb,0x13ffffd1,0xffd90000,0x0000005b,0x00000000,0x0a636c00,0x5c790000,0x09000007,0x00026389,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02efff87,0x00000000,0x00000000,0xff970000,0x000057fe,0x00000000,0xf9010000,0x00001bff,0x00000000,0xfcff1a00,0x0000000e,0x00000000,0xef000000,0x000024ff,0x007fd604,0xdd040000,0x000051ff,0x00000000,0x00000000,0x00000000,0x00000000,0xffff8700,0xff365ef5,0x001cd3ff,0xff800000,0xf16e0184,0x0000b1ff,0xffffc502,0x002cd8ff,0x00000000,0xfff8a921,
-0x0000cbff,0x00000000,0xffff7c00,0x006bf7ff,0x00000000,0x11000000,0xffffffc7,0x70feffff,0x00000000,0xfffe2700,0x522ddfff,0x0000ffff,0x75ffc200,0xfff37f07,0x1500006d,0x7bffd438,0x00000000,0x27000000,0xfbff3c8c,0x00000002,0x5f38ffcf,0x03d4ffeb,0xffbc0000,0x00000077,0x00000000,0xadff8400,0xff8f0000,0x5200009e,0x06b3ffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0x2cffff8d,0x00000000,0x00000000,0xbd060000,0x0036f5ff,0x00000000,0xdd000000,0x000038ff,0x00000000,0xc9ff5800,0x00000000,0x00000000,0xd1000000,0x000042ff,0x1cf55100,0xff5c0000,0x000000cd,0x00000000,0x00000000,0x00000000,0x00000000,0xbdffb800,0xff7df67b,0x04cfbeff,0xff630000,0x040000b1,0x00000321,0xb3ffff43,0x1eeebb4c,0x00000000,0x4d090000,
-0x0000e8ff,0x00000000,0xd6fff303,0x73fea573,0x00000000,0x00000000,0xbeff9a0b,0x33333333,0x00000005,0xffff4800,0x59e3bf60,0x0009ffff,0x92ffa600,0x24060000,0x64000000,0xa6ffb8d1,0x00000000,0x0e000000,0xffffe1f3,0x00000018,0x0067ffb3,0x00072404,0xffa00000,0x00000093,0x00000000,0xccff6600,0xff750000,0x550000bc,0x93e3f8ff,0x00000000,0x00000000,0x00000000,
-0x00000000,0x6bf3ffa6,0x00000000,0x00000000,0x13000000,0x1ce3ffdb,0x00000000,0xc0000000,0x000055ff,0x00000000,0x89ff9800,0x00000000,0x00000000,0xb5000000,0x00005fff,0xa2c80100,0xffc30000,0x00000065,0x00000000,0x00000000,0x00000000,0x00000000,0x9bffb000,0xfff14600,0x1bdb44ff,0xff380000,0x000000dd,0x00000000,0x15fcff67,0x41d80a00,0x00000000,0x09000000,
-0x0006fefc,0x00000000,0x42ffff18,0xfb710000,0x0000000a,0x00000000,0xc9ff5f00,0x00000000,0x00000000,0xffff4000,0xd09c040b,0x000ffff8,0xafff7b00,0x00000000,0x0e000000,0xc6ffffd2,0x00000000,0x00000000,0xffffc323,0x00000033,0x0097ff89,0x00000000,0xff780000,0x000000af,0x00000000,0xedff4800,0xff590000,0x440000dc,0xc95cffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0xd8afffd2,0x00000002,0x00000000,0x0000000b,0xcbfff027,0x0000000a,0xa3000000,0x000073ff,0x00000000,0x47ffd800,0x00000000,0x00000000,0x97000000,0x00007dff,0xfe420000,0xf3fe2334,0x0000000c,0x00000000,0x00000000,0x00000000,0x00000000,0xb2ff8f00,0xff7f0000,0x000459ff,0xf1080000,0x000010fe,0x00000000,0x00e7ff59,0x001d0000,0x00000000,0x00000000,
-0x0027ffcb,0x00000000,0xe8fff805,0x5301178e,0x00000000,0x00000000,0xefff2800,0x00000000,0x00000000,0xfffe1800,0xc5030026,0x001efffa,0xd4ff4100,0x00000000,0x00000000,0xa8ffb415,0x00000000,0x00000000,0xfe880200,0x0000004d,0x00c6ff4c,0x00000000,0xff400000,0x000000d0,0x00000000,0xffff2a00,0xff3b002a,0x2f001cff,0x1217ffff,0x00000000,0x00000000,0x00000000,
-0x24000000,0xf544ffff,0x00000057,0x00000000,0x0041c45a,0xfffc4500,0x000001aa,0x86000000,0x000090ff,0x00000000,0x0bfaff1a,0x00000000,0x00000000,0x79000000,0x00009aff,0xb8000000,0xadff6cc3,0x00000000,0x00000000,0x00000000,0x00000000,0x014d0100,0xe2ff4200,0xed090002,0x00007eff,0x99000000,0x000040ff,0x00000000,0x00f3fe1e,0x00000000,0x00000000,0x00000000,
-0x0054ff75,0x00000000,0xd1ffb100,0x0051ebef,0x00000000,0x00000000,0xffd90000,0x00000019,0x00000000,0xffc70000,0x3600005c,0x0039ffff,0xfce20200,0x00000009,0x00000000,0x08752e00,0x00000000,0x00000000,0xa84e0000,0x0000005e,0x02f3ea06,0x00000000,0xe5030000,0x000003f7,0x00000000,0xffff0d00,0xff1f0089,0x15007fff,0x002fffff,0x00000000,0x00000000,0x00000000,
-0x8a000000,0x8f07f0ff,0x000010e0,0x00000000,0x0affff41,0xff6c0000,0x000082ff,0x68000000,0x0000adff,0x00000000,0x00c5ff5a,0x00000000,0x00000000,0x5c000000,0x0000b7ff,0x31000000,0x5fffe8fe,0x00000000,0x00000000,0x00000000,0x00000000,0x90ff9300,0xffca0100,0x9d000043,0x0000a4ff,0x1f000000,0x000093f7,0x00000000,0x24ffb000,0x00000000,0x00000000,0x00000000,
-0x0097ec0e,0x00000000,0x6dfe3900,0x53fcb20e,0x00000000,0x00000000,0xff6a0000,0x00000065,0x00000000,0xff490000,0x000000c2,0x005affd9,0xff630000,0x0000005c,0x00000000,0x97d90100,0x00000003,0x00000000,0xfc1e0000,0x0000006e,0x4cff6e00,0x00000000,0x70000000,0x00003aff,0x00000000,0xffef041f,0xfb0420f7,0x001ef3ff,0x0048fff9,0x00000000,0x00000000,0x00000000,
-0xf7241669,0x110093ff,0x000fbddd,0x00000003,0x15ffe407,0x96000000,0x005bfeff,0x4b000000,0x0000cbff,0x00000000,0x0085ff9a,0x00000000,0x00000000,0x40000000,0x0000d5ff,0x00000000,0x17ffffa8,0x00000000,0x00000000,0x00000000,0x00000000,0x54f9ff4f,0xf32a0000,0x680010db,0x0000ccff,0x00000000,0x0040f664,0x00000000,0xacee2100,0x00020003,0x00000000,0x00000000,
-0x2ef35600,0x00000000,0xe08e0000,0xe8ff3315,0x00000006,0x00000000,0xc9050000,0x00000ed1,0x00000000,0x92000000,0x000078ff,0x007bffa8,0xb2010000,0x000022df,0x00000000,0xff770000,0x0000009f,0x00000000,0xdd000000,0x00005cfe,0xd4bb0300,0x00000017,0x04000000,0x0008bcc4,0x00000000,0xffd475c3,0xe30acdf5,0x0ac9dbff,0x0061ffe8,0x00000000,0x00000000,0x00000000,
-0xffeae7d8,0x000016e8,0xd6ece82b,0x000016c9,0xe0f74200,0xc0bbbbbb,0x2ef8fffa,0x2b000000,0xaaaaf5ff,0x000055aa,0x0045f979,0x00000000,0x950b0000,0xb9aaaaaa,0x0000f1ff,0x00000000,0x00dffa24,0x7f000000,0xbbbbbbbb,0xbbbbbbbb,0x002bbbbb,0x006effc9,0x3f000000,0xe3b3e3ef,0x0003f3ff,0x00000000,0xc5f97800,0x00038dc5,0xf13c0000,0x6ef2bcdd,0x00000000,0x00000000,
-0xf6760000,0x0183c9bf,0xb0030000,0xffffd1e3,0x00000027,0x00000000,0x1a000000,0xd6bcefd5,0x000013c7,0x03000000,0xb8c3ff97,0x00a9fff3,0x0c000000,0xcdbdf3bd,0x00000060,0xa60f0000,0x000030ff,0x00000000,0x28000000,0x0000ddc1,0xc5100000,0x43cdbbef,0x00000000,0xb8e3d316,0x000031c9,0xfff2fa57,0xf9d8d08c,0xd9c26eff,0x0069fffb,0x00000000,0x00000000,0x00000000,
-0xdbffc624,0x00000032,0xfcae1e00,0x000089fc,0xb52f0000,0xfffffff9,0x6effffff,0x00000000,0xfffffe71,0x0070feff,0x000a2900,0x00000000,0x28000000,0xffffffe0,0x0010ffff,0x00000000,0x00a05000,0x95000000,0xffffffff,0xffffffff,0x0055ffff,0x0003bc3a,0x00000000,0xfff19e1c,0x0028f3ff,0x00000000,0xc6430000,0x0fb9ffff,0x24000000,0xfcfffbb0,0x00000043,0x00000000,
-0x49000000,0xafffffcc,0x04000008,0xdffff280,0x0000000a,0x00000000,0x00000000,0xffe5830c,0x001dd6ff,0x00000000,0xfcc24800,0x00ccffff,0x00000000,0xffe47404,0x000075fe,0x00000000,0x00001071,0x00000000,0x00000000,0x00006306,0x06000000,0xfaffe87d,0x00000065,0xf08d0d00,0x0051f3ff,0xffea4f00,0xfea61153,0x9b0c3afc,0x0039fbfc,0x00000000,0x00000000,0x00000000,
-0x000f0000,0x00000000,0x08000000,0x0000000a,0x00000000,0x22221c08,0x03222222,0x00000000,0x33332900,0x06333333,0x00000000,0x00000000,0x00000000,0x33333313,0x00063333,0x00000000,0x000a0000,0x12000000,0x22222222,0x22222222,0x000e2222,0x00000100,0x00000000,0x21060000,0x00000626,0x00000000,0x00000000,0x000f2814,0x00000000,0x11280d00,0x00000000,0x00000000,
-0x00000000,0x0a281600,0x00000000,0x09270900,0x00000000,0x00000000,0x00000000,0x1a010000,0x00001329,0x00000000,0x0d000000,0x00011c29,0x00000000,0x1d020000,0x00000624,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x221f0300,0x00000005,0x05000000,0x00021d24,0x21060000,0x11000000,0x0000001c,0x00001c0e,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00070200,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4e000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x93330000,0xd9fcf8d4,0x0000066e,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01000000,0xffffff9b,0x003fefff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xbd0a0000,0xffffffff,0x0000007b,0xed1e0000,0x0000000e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffcf48,0xdbd5f8ff,0x000ac7ff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfeffa203,0x32bbaee1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0f000000,0xfeffffc9,0x000063e5,0xff6b0000,0x0000007e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xbc290000,0xb5ffffff,0x0000034d,0x007dffb3,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x8f120300,0x0002c8ff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0d000000,0x0000032b,0x00000000,0xffc01b0b,0x00000052,0xffcf0100,0x000006ef,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfff56100,0x0043d9ff,0x00000000,0x00b7f987,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x22000000,0x0044ffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000d00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffd516,0x0491ffff,0x005f0000,0x2d000000,0x7cc1f3ff,0x0000000f,0xff490000,0x000000cb,0xffff7600,0x000024ff,0x00000000,0x11000000,0xd6eedf90,0x00003999,0x00000000,0x00000000,0x00000000,0x00000000,0x01000000,0xe2efce66,0xffffffc6,0x00000797,0x00000000,0x004e2000,
-0xfffff95b,0x0041f0ff,0x0b000000,0x006de4aa,0x21000000,0xdbefdd9f,0x000039a0,0x00000000,0x00000000,0x007bffe4,0x00000000,0x00000000,0x00000000,0x33000000,0x83d8edbc,0x52c5530b,0x00000002,0x00000000,0x051a0000,0x00000000,0x00000000,0x38000000,0x0000000d,0x30000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffffd220,0x0189ffff,0x2d000000,0x005bdbc7,0x8f7c5600,0xd5c8b6a3,0xe0f0eee3,0x00002fa0,0xffd51600,0x95eaffff,0x8bf30204,0x2d000000,0xe6dbffff,0x00000049,0xff170000,0x000007fb,0xfffffa38,0x000048ff,0x00000000,0xd4110000,0xebfcffff,0x09a0fefc,0x03000000,0xffffffa1,0x002fe6ff,0x00000000,0x92000000,0xefffffff,0x65fcffff,0x00000000,0x00000000,0x00000000,
-0xf5ee4200,0x37b6caf6,0xbf080000,0x72fef9ff,0xe41f0000,0xeffcffff,0x0391feff,0x00070000,0x00000000,0x0097ffc2,0x00000000,0x00000000,0x00000000,0xf01e0000,0xfcf0ffff,0xffff27c8,0x000265db,0x00000000,0xb06b0000,0x00000007,0x00000000,0x53000000,0x000014cb,0xe8000000,0x00000046,0xc85c0000,0x0039bced,0x00000000,0x53d8dd55,0x00000000,0x00000000,0x00000000,
-0xe2a90c00,0x74b5ddfe,0xef2d0001,0x65fffaff,0xffb11900,0xffffffff,0xf0ddddee,0x007bfbff,0x1a0c0000,0x0040ffb3,0xffff2200,0x2d00006c,0x0036ffff,0x00080000,0xf1000000,0x150024ff,0xd8f0ffe0,0x00006aff,0x00000000,0xff990000,0x001ab1ff,0xc3fa7b0f,0x0000000c,0xffff9801,0x29b5b8ea,0x00000000,0xff470000,0x0031d0ff,0xa7e0f877,0x00000009,0x00000000,0x00000000,
-0x17000000,0x005afcef,0xff8c0000,0xca7f32f8,0xff9b0000,0x000a99ff,0x78ffd227,0x3cc10000,0x00000000,0x00b1ffa6,0x00000000,0x00000000,0x00000000,0xff890000,0x170042f5,0xffdfa8b0,0x0066fcf0,0x00000000,0xff960000,0x000006b9,0x00000000,0x39000000,0x0014d6ff,0xff160000,0x000031f5,0x93070000,0x7dfcf5ff,0x2b000000,0xfcf7fffa,0x0000003f,0x00000000,0x00000000,
-0x01000000,0x00adffa9,0xffdd1200,0xa78a19db,0x52000000,0xd4ffa65c,0x00000007,0x28f77f1c,0x00000000,0x009fff49,0xffff6200,0x2d0002dc,0x0024ffff,0x49b30000,0xd5000000,0xc3053cff,0x9c42faff,0x00008cff,0x00000000,0xfff60e00,0x000006cc,0xff5c0000,0x000000a3,0x680b0100,0x001ee8ff,0x00000000,0xffb20000,0x000017ef,0xda171d00,0x000003c1,0x00000000,0x00000000,
-0x00000000,0x00d1ffa3,0xfffc3b00,0x1a0f0092,0xc7350000,0x000004dd,0xe8ff5300,0xf7ff0a00,0x00000054,0x00cdff8b,0x00000000,0x00000000,0x00000000,0xffc00000,0x000000a3,0xffebe006,0x00291f68,0x00000000,0xffc00000,0x00006bff,0x00000000,0x2d000000,0x0088ffff,0xff3c0000,0x0000a5ff,0x00000000,0xff8f0424,0xb900006a,0xbd0ddaff,0x000000bd,0x00000000,0x00000000,
-0x00000000,0x28ffff47,0xf8ffa900,0x0b050030,0x00000000,0xffcc0300,0x00000062,0x001f0000,0x00000000,0x00e3fc11,0xfeffb800,0x2a0055ff,0x001effff,0xfaf60000,0xb900005b,0xff8e59ff,0x7c0069ff,0x0000b0ff,0x00000000,0xffff4100,0x00000052,0xb0000000,0x000049ff,0x06000000,0x0079fff3,0x00000000,0xfff10000,0x00000093,0x46000000,0x00007fff,0x00000000,0x00000000,
-0x00000000,0x0bfcff65,0xf5ffc801,0x00000017,0x01000000,0x0000002b,0xffff6e00,0xffff0808,0x00000084,0x00e8ff70,0x00000000,0x00000000,0x00000000,0xffda0000,0x00000072,0xffff6d00,0x00000072,0x00000000,0xffed0100,0x0014ecff,0x00000000,0x21000000,0x12f3ffff,0xff670000,0x001efbff,0x00000000,0xa7010000,0xff3836fc,0x3b005cff,0x00000046,0x00000000,0x00000000,
-0x00000000,0x5cfffc0b,0x74ffff54,0x00000000,0x00000000,0xff800000,0x000000a7,0x00000000,0x00000006,0x18ffd500,0x7efffa13,0x1e05dbe6,0x001effff,0xfff90000,0x9e000093,0xffffc2ff,0x5a00008b,0x0000d2ff,0x00000000,0xffff5a00,0x0000001a,0x43000000,0x0000c3ff,0x00000000,0x05afffbc,0x00000000,0xffff0b00,0x00000066,0x01000000,0x000df3e5,0x00000000,0x02000000,
-0x00000019,0x37ffff44,0x88ffff58,0x00000000,0x00000000,0x00000000,0xd9fff13b,0xffda0000,0x00000045,0x06feff53,0x00000000,0x00000000,0x00000000,0xffed0000,0x00000066,0xffff1a00,0x0000008e,0x00000000,0xffff2700,0x00a5ed89,0x00000000,0x24000000,0x82ffffff,0xff8f0000,0x0090fbdd,0x00000000,0x13000000,0xffb5d2ec,0x000005e6,0x00000000,0x00000000,0x00000000,
-0x00000017,0x95ffe400,0x03c6ffeb,0x00000000,0x00000000,0xff650000,0x000000d8,0x00000000,0x00038f69,0x36ffa500,0x15f9ff6a,0x1b6eff5a,0x001effff,0xffcd0000,0x82000054,0xbeffffff,0x34000003,0x0000f3ff,0x00000000,0xf8ff5200,0x00000001,0x08000000,0x3f16fcfa,0x00000024,0xffffff98,0x001687d6,0xfffe0300,0x00000048,0x00000000,0x005effaf,0x00000000,0x31000000,
-0x00001fdb,0xffffff28,0x12f1ffff,0x00000000,0x00000000,0x55000000,0x56fffff3,0xff740000,0x00000070,0x21ffff37,0x00000000,0x00000000,0x049b1e00,0xffe10000,0x00000074,0xffe80000,0x000000a8,0x00000000,0xffff6000,0x53ff572f,0x00000000,0x2d000000,0xefe2ffff,0xffb7000f,0x14f39e96,0x00000000,0x00000000,0xffffff64,0x0000007c,0x00000000,0x00000000,0x00000000,
-0x00006dc2,0xfcffc800,0x002afbff,0x00000000,0x00000000,0xff5a0000,0x000000e7,0x00000000,0x08aeffa1,0x4bff7800,0x00acffd1,0x24efbe00,0x001effff,0xff670000,0x6600007f,0x23f7ffff,0x09000000,0x001bfffc,0x00000000,0xfaff3700,0x00000000,0x00000000,0x974effe8,0x000043ee,0xcbfcff79,0x46ecffe5,0xffe70000,0x0000004c,0x00000000,0x0092ff9b,0x00000000,0x5c000000,
-0x0022e1ff,0xe1ffff0c,0x7efceacb,0x00000001,0x00000000,0xfe870200,0x006efcff,0xbd040000,0x1a327ef9,0x48ffff2b,0x00061111,0x00000000,0xb9ff5c00,0xffc9000d,0x00000090,0xffbc0000,0x000000c4,0x00000000,0xecff9b00,0xebaf0002,0x00000017,0x31000000,0xff59ffff,0xffe8007e,0x8cfb2466,0x00000000,0x00000000,0xf9ffd202,0x00000018,0x00000000,0x00000000,0x00000000,
-0x007dfff3,0xffffac00,0x000097ff,0x00000000,0x00000000,0xff5a0000,0x000000f0,0x00000000,0x09e7ffa1,0x89ff4b00,0x0048ffff,0xaafb2c00,0x0029fffc,0xb0020000,0x623385f9,0x009dffff,0x00000000,0x0048ffcc,0x00000000,0xfff30500,0x0000001c,0x00000000,0xb164fff0,0x0005eeff,0x09ffff5a,0xf9e83900,0xffa80033,0x0000006e,0x00000000,0x00adffa1,0x00000000,0x5a000000,
-0x0030ffff,0x79fff100,0xffc00b00,0x00000079,0x00000000,0xffffa303,0x000049f1,0x08000000,0xfffffc99,0xffffffff,0xe2ffffff,0x0000359e,0xffff6400,0xffa20033,0x000000c1,0xff9b0000,0x000000e2,0x00000000,0xafffdc00,0xf51e0000,0x0000009e,0x3e000000,0xae0dffff,0xffff2df1,0xf3a5003a,0x00000013,0x00000000,0xd5ffeb09,0x00000001,0x00000000,0x00000000,0x00000000,
-0x0093fff0,0xffff8f00,0x0000a0ff,0x00000000,0x00000000,0xff450000,0x000000f1,0x00000000,0x00aeff74,0xd9ff1e00,0x0003e7ff,0xff970000,0x0040fffe,0x06000000,0xfffffc8e,0x0058ffff,0x00000000,0x0077ff82,0x00000000,0xff9f0000,0x00000061,0x13000000,0x9a66ffff,0x0000aeff,0x26ffff3b,0xff690000,0xff4f00bc,0x000000b4,0x00000000,0x00b9ffc3,0x00000000,0x37000000,
-0x0000f3ff,0x95ffd500,0xff240000,0x000014f6,0x00000000,0xe2ffff6b,0x0000002d,0x00000000,0xa9782400,0xbbbbbbbb,0xd3bfbbbb,0x0393fef5,0xedff3f00,0xff6a0000,0x000007f3,0xff7e0000,0x000004fc,0x00000000,0x6effff2d,0x8b000000,0x000034fc,0x57000000,0x2600efff,0xffffcdfa,0xff3c000f,0x0000007c,0x00000000,0xffffff5f,0x0000005c,0x00000000,0x00000000,0x00000000,
-0x005cffc1,0xf1ff7300,0x0042fea4,0x00000000,0x00000000,0xfe1d0000,0x000005ff,0x00000000,0x05d6f017,0xfaf00000,0x000090ff,0xf2170000,0x0054ffff,0x00000000,0xad792200,0x003cbbbb,0x00000000,0x00bcfc24,0x00000000,0xf9240000,0x000005d3,0x5a000000,0x4f48ffff,0x0000b3ff,0x44ffff1c,0xff440000,0xcd0105fc,0x00002ffc,0x12000000,0x009efff7,0x00000000,0x01000000,
-0x0011fedd,0xb1ffb900,0xf2000000,0x000050ff,0x00000000,0x1ae5ffb3,0x231b0000,0x00000000,0x00000000,0x00000000,0x00000000,0x87ff970b,0xfcdb0300,0xff260012,0x000050ff,0xff5e0000,0x000024ff,0x00000000,0x22ffff7d,0x23000000,0x0000c3ff,0x74000002,0x0000caff,0xe3ffff96,0xe2000000,0x000009eb,0x00000000,0xd6caffcb,0x00000fe7,0x00000000,0x00000000,0x00000000,
-0x008eff59,0xffff5700,0x30f0bd19,0x00000000,0x00000000,0xbe000000,0x00002dff,0x00000000,0xbcfb5300,0xffca274d,0x000045ff,0x7b000000,0x007bffff,0x00000000,0x00000000,0x00000000,0x00000000,0x23fca700,0x00000000,0x6b000000,0x000096ff,0xdb0f0000,0x030ef5ff,0x0056fcc3,0x61fffa03,0xff7b0000,0x28000fff,0x0010d3f3,0x9d000000,0x005cffff,0x00000000,0x00000000,
-0x0cb0fe4c,0xcbff9e00,0xff210000,0x00005fff,0x00000000,0x009cffa6,0xe8960000,0x0000000c,0x00000000,0x00000000,0x00000000,0xf6ff2900,0xf33c000d,0xd6244fcd,0x0000a8ff,0xff400000,0x00004cff,0x0000c245,0x00cfffcc,0x00000000,0x0a37ffdd,0xa9002ee3,0x0000a2ff,0xc9fffc24,0xb2000000,0x000059ff,0x43009b3a,0x374bffff,0x0000a8fa,0x00000000,0x00000000,0x00000000,
-0x92fe9f00,0xffff553b,0xf5b50d42,0x244b2473,0x00000000,0x2b000000,0x3e24b7f0,0x0000108d,0xdd410000,0xffffffff,0x000018ff,0x0a000000,0x00a6ffe1,0x00000000,0x00000000,0x00000000,0x00000000,0xcddd1300,0x1e712436,0x00000000,0x41b4ff88,0xffcc411c,0x00008cff,0xc2ffcc18,0x8bffeb73,0xfff8792e,0x000000d6,0x5bddf344,0xff9c2d1e,0x0009ddff,0x00000000,0x00000000,
-0xe6fc6900,0xe8ffae8a,0xffd15022,0x000024fc,0x00000000,0x40e5ff47,0xffcd3a1a,0x00000072,0x00000000,0x00000000,0x00000000,0xffff7c00,0x3300002d,0xffffffd1,0x0026fbff,0xff210000,0x00007dff,0x5566ff45,0x0073fffe,0x1e000000,0x0179fff1,0xf130bde2,0x000062ff,0xb6ffa700,0xe1140000,0x00009eff,0xc452ff56,0x0000bcff,0x2497ff73,0x0000001b,0x00000000,0x00000000,
-0xf3740200,0xffffffff,0x84030070,0xe7fffff9,0x0000002d,0x00000000,0xffffdc32,0x001dd3ff,0x03000000,0xbbb5924e,0x000000bb,0x00000000,0x00d09a13,0x00000000,0x00000000,0x00000000,0x00000000,0xc61a0000,0xe8ffffff,0x00000039,0xffec6200,0xffffffff,0x00000abc,0xf07f0900,0xffffffff,0xeeffffff,0x0000003c,0xffcd3100,0xffffffff,0x000032ed,0x00000000,0x00000000,
-0xca380000,0xffffffff,0xfcffffff,0x00000077,0x00000000,0xfff96e00,0xffffffff,0x00000097,0x00000000,0x00000000,0x00000000,0xefe13700,0x00000008,0xb1884201,0x0069bbbb,0x50010000,0x0000b9c8,0xffffb300,0x000ce8ff,0x70000000,0x0062fffe,0xfffff53c,0x000011f0,0xbdb40b00,0xf6490000,0x000087ff,0xffffbe06,0x000031fc,0xfffe7d00,0x000478f8,0x00000000,0x00000000,
-0x0f000000,0xbbb6995f,0x00000070,0xa3b38520,0x00000062,0x00000000,0xad650800,0x003391b8,0x00000000,0x00000000,0x00000000,0x00000000,0x00320000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0xa3bba254,0x0000005c,0x63110000,0x62aeb9a3,0x00000004,0x09000000,0xbbaf8b54,0x146e9bb3,0x00000000,0x48020000,0x85b6b495,0x00000019,0x00000000,0x00000000,
-0x00000000,0xb9a57732,0x2c80a1b8,0x00000000,0x00000000,0x81240000,0x399abbb5,0x00000000,0x00000000,0x00000000,0x00000000,0x3c150000,0x00000000,0x00000000,0x00000000,0x00000000,0x00003400,0xb3710400,0x000029a3,0x00000000,0x0006a04d,0xb2a22900,0x0000003e,0x6b030000,0x36000000,0x000009a1,0xb3790700,0x0000005a,0x9d380000,0x003096b8,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x61370000,0x0000235a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffc61f,0x1fb7ffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01000000,0xc4ffffcd,0xe8f18c79,0x00000024,0x55553e00,0x00315555,0x00000000,0x00001172,0x00000000,0x00000000,0x00000000,0x00000000,0x37000000,0x001a5562,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x019fcf24,0xff490000,0x000002d0,0xffe72800,0x55f9ffff,0x00000000,0x319cf5f0,0x00000000,0x00000000,0x00000000,0x00000000,0xffb30a00,0xa8feffff,0x00000017,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000a0800,0xe8010000,0x000045ff,0xb5280000,0x6cb4f2d6,0x00000016,0xffffffe6,0x00000098,0x00000000,0x00000000,0x00000000,0xffff9b00,0xfc9e7fd1,0x00001ce1,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00006209,0x00000000,0x410d0000,0x00001b42,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x26484010,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x48240000,0xb6001637,0x000086ff,0x00000000,0x57fff313,0x00000000,0x40ddffd6,0x0000007e,0x00000000,0x00000000,0x00000000,0xd4ffd806,0x68000007,0x0000beff,0x00000000,
-0x431b0000,0x00000639,0x480f0000,0x00225263,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x0074ff9a,0x00000000,0xfff35c00,0x40c5feff,0x00000000,0x55380000,0x31555555,0x00000000,0x034d5600,0x00000000,0x43331b02,0x082e444c,0x00000000,
-0x87030000,0xfffffff9,0x00036de0,0x00000000,0x3b2c1300,0x22374b44,0x00000002,0x01000000,0x5555554c,0x55555555,0x35545555,0x0000000f,0x53060000,0x55555555,0x00000042,0x00000000,0x00000000,0xffffc422,0xc1beffff,0x0000b3ff,0x00000000,0xa5ffc600,0x00000000,0x00e3ffbb,0x00000000,0x07000000,0x55555554,0x00004855,0x63a30d00,0x09000000,0x003ffff0,0x00000000,
-0xfffe9d07,0x0270edff,0xffe81c00,0xc3feffff,0x00000034,0x00000000,0x00000000,0x02814200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x22000000,0x0ae8ffeb,0x00000000,0xf8fffa24,0xfed696ae,0x0000003c,0xbc140000,0xf5ffffff,0x00000046,0xe4ffdb00,0x93000a7f,0xfffffff9,0xf9ffffff,0x000157bc,
-0xff8e0000,0x9b9ee8ff,0x0fc2ffd5,0x54000000,0xfffffff5,0xffffffff,0x004eabed,0x00000000,0xfffff03e,0xffffffff,0xffffffff,0x0024a2fb,0x61000000,0xfffffffc,0x000186ff,0x00000000,0x0f000000,0xc2ffffdf,0xffedaf93,0x0000d6ff,0x00000000,0xd0ff9c00,0x00000000,0x00f6ff9f,0x00000000,0x00000000,0xfffffe69,0x0395ffff,0x04000000,0x00000000,0x0093ffbd,0x00000000,
-0xe4ffff8f,0xa5ffbc9b,0xea310001,0xc07880be,0x00006efc,0x00000000,0x00000000,0xacf14100,0x00000003,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0049e22c,0x00000000,0x50ffff7c,0x70023c58,0x003c602a,0x03000000,0x8fedaf6e,0x00000a66,0xeaffff35,0x0a0062f5,0xfff9ffbf,0x988c99f0,0x0ab9ffcd,
-0xfffe2a00,0x00000ec0,0xbeee4f00,0x00000000,0xfffbfc62,0x8f99beff,0xc5f3b396,0x00000026,0xffe83100,0xf1fffcff,0x8d969aae,0x3ef2eeab,0x00000000,0xe3edb85f,0x00316b8c,0x00000000,0x89000000,0x0056fcff,0xa2100000,0x0000f5ff,0x00006d24,0xf2ff7600,0x66666666,0x0affffb9,0x00000000,0x00000000,0xefb66800,0x396a87e1,0x00000000,0x00000000,0x00cfff92,0x00000000,
-0x0dceffe7,0xffb10000,0x09000063,0x00000000,0x0073fe62,0x00000000,0x00000000,0xff470000,0x0000008f,0x00000000,0x3e000000,0x00000055,0x00000000,0x00000000,0x00000000,0x05000000,0x00000000,0x00000000,0x00000000,0x00005f21,0x00000000,0x80d1ff9e,0x0eadffff,0xb3ffffe3,0x0000000a,0xfcc00300,0x0000004c,0x49ffff6a,0x00000b08,0xec191b0b,0x000062ff,0x87ffac00,
-0xfaff8500,0x0000001e,0xf6330000,0x00000016,0x8f092600,0x0001ccff,0xc0160000,0x000037ec,0x281a0000,0xfcf22e08,0x00000040,0x738a0c00,0x00000000,0xff500000,0x00001efa,0x00000000,0xe2000000,0x0000a5ff,0x3a000000,0x0015ffff,0x079eff64,0xffff5900,0xffffffff,0x21ffffff,0x00000000,0x00000000,0x5c000000,0x0019f8ff,0x00000000,0x00000000,0x03f9ff6e,0x00000000,
-0x0062ffe8,0xffa60000,0x000000bc,0x00000000,0x42fc9500,0x00000000,0x0000359a,0xff220000,0x00001afc,0x00000000,0xfc810600,0x000055fc,0x00000000,0x00000000,0x00000000,0x6b000000,0x00001881,0x00000000,0x00000000,0x0057fc58,0x00000000,0xb9a6ffb9,0xcfcecbff,0xfc9bffff,0x00000098,0xff400000,0x666666e7,0x11ffffb0,0x00000000,0xad000000,0x0000c5ff,0xd1ff8800,
-0xc0ffb300,0x00000000,0x17000000,0x00000000,0x3b000000,0x003affff,0x0f000000,0x0019ecd6,0x00000000,0xffa60000,0x000000b3,0x00000000,0x00000000,0xf7080000,0x000070ff,0x00000000,0xff140000,0x000058ff,0x1a000000,0x0033ffff,0x31ffff78,0xffff3c00,0x66666685,0x3effff8d,0x00000000,0x00000000,0x0f000000,0x0065fffc,0x00000000,0x00000000,0x1dffff51,0x00000000,
-0x007dff9a,0xfffc5200,0x000000af,0x4d5c2400,0xd6f91910,0x82010004,0x0043f2ff,0xffcc1b00,0x00003bff,0x00000000,0xfeffd947,0x00000993,0x00000000,0x00000000,0x00000000,0x04000000,0x2d9ef8b8,0x00000000,0x00000000,0x02f6ff47,0x00000000,0xae96ffae,0xdb0f9aff,0xaa12ffff,0x00002ffe,0xce000000,0xffffffff,0x00e1ffff,0x09020000,0x7e000000,0x0000f3ff,0xccfff02f,
-0x9fffc300,0x00000000,0x00000000,0x00000000,0x0d000000,0x0069fffe,0x00000000,0x00a8ff43,0x00000000,0xff790000,0x000001f1,0x00000000,0x00000000,0xc6000000,0x00009eff,0x00000000,0xff220000,0x770039ff,0x677189b5,0x0057fffe,0x00e3ff62,0xffff2200,0x00000047,0x62ffff1f,0x00000000,0x00000000,0x00000000,0x0093ffd4,0x00000000,0x00000000,0x39ffff33,0x00000000,
-0x47f5d614,0xf2fffb59,0x0000002e,0xfffffa5e,0xffb470f1,0x7c000056,0x0051ffff,0xffcb1300,0x000006da,0xbf410000,0x48e7ffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfeb63f00,0x00014bbb,0x00000000,0x0efcd504,0x00000000,0x73a0ff98,0x5f00b7ff,0x681effff,0x790096ff,0x64000028,0x6666e4ff,0x00caffc9,0xc0310000,0x5400000e,0x936effff,0x83fffff5,
-0x8cffb400,0x00000000,0x00000000,0x6c000000,0x0000000a,0x0087ffe2,0x00000000,0x24fcdf00,0x00721e00,0xff560000,0x626674ff,0x00000022,0x082c0000,0xa8000000,0x6666d2ff,0x0000145f,0xff150000,0x08002eff,0xffffffce,0x0092ffff,0x00e6fc1d,0xffff0700,0x00000061,0x86fff602,0x00000000,0x31000000,0x00000007,0x00b1ffb5,0x00000000,0x0000001d,0x57ffff15,0x00000000,
-0xf8ab1600,0x38e4fffc,0x10000000,0x8ff9fff1,0xffdcea84,0x000000aa,0x00007067,0x9e0e0000,0x09000022,0xffffca62,0x00159dfc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30000000,0x67d8fca6,0x0000000a,0x9ee12600,0x00000001,0x11c5ff5e,0x0c1ff9ed,0x4d2ffffc,0xe300d9ff,0x0a0031e8,0x001ffcef,0x00b9ffa5,0xff620000,0x360015cc,0xffffffff,0x06a8feff,
-0x9eff9600,0x00000000,0x00000000,0xfc090000,0x00001ccd,0x00a7ffc3,0x00000000,0x6effae00,0xa5ff5b00,0xff37000a,0xffffffff,0x00006cfb,0xc6a20000,0x8b000016,0xffffffff,0x0042f0ff,0xf3020000,0x000044ff,0x6666540e,0x004b6666,0x54ff9a00,0xffe80000,0x00000085,0xa8ffc300,0x00000000,0xaa000000,0x000011bf,0x00cdff99,0x06000000,0x00005cec,0x74fff500,0x00000000,
-0xfe6a0000,0x16c6faff,0x42000000,0x006affff,0xfff32700,0x000000da,0x00000000,0x00000000,0x4d000000,0xa8fafff9,0x00000030,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffc62200,0x000026e0,0xbf180000,0x000018b5,0x0ef6fa19,0x78d9f844,0x4844ffed,0xff0cfcff,0x0000a2ff,0x0084ff92,0x00b4ff97,0xff620000,0x18002bff,0x7b98ffff,0x005ef1e4,
-0xd1ff5400,0x00000000,0x00000000,0xff180000,0x00008dff,0x00c7ffa3,0x00000000,0x9cffa900,0xffff7100,0xff1a0039,0x79679fff,0x003f9c8a,0xffc70000,0x6e0002d8,0x6b66fcff,0x2fb09f82,0xb3000000,0x000074ff,0x00000000,0x00000000,0xfcb60900,0xffe881b7,0x000000af,0xcdff8300,0x00000000,0xcf000000,0x0000caff,0x00ebff7c,0x27000000,0x006cfeff,0x91ffd600,0x00000000,
-0xfffb2900,0xd2dc18b0,0x4e00000e,0x000fffff,0xff9b0000,0x000000ee,0x00000000,0x00000000,0x00000000,0xa9fcdd47,0x00000032,0x00000000,0x66666624,0x66666666,0x05606666,0x00000000,0x00000000,0xffffc742,0x0003bfff,0x08000000,0x0035eab7,0x70ff9d00,0xffd53a00,0x665bffff,0xfe14ffff,0x000050ff,0x06e7fc28,0x00b8ff96,0xff390000,0x010000ec,0x006afff8,0x4bfee319,
-0xffe80a00,0x0000002a,0x00000000,0xf8030000,0x000041ff,0x00e5ff85,0x00000000,0xa9ffd000,0xeaff5500,0xf9020000,0x000073ff,0x00000000,0xffb50000,0x510000a8,0x0014ffff,0x00000000,0x53000000,0x0000cbff,0x00000000,0x00000000,0x6a020000,0xffffffdd,0x000000d9,0xf9ff3200,0x0000000a,0xc1000000,0x0000a3ff,0x08ffff5f,0x1c000000,0x0056ffff,0xaeffb900,0x00000000,
-0xb9ff7300,0xff8d0004,0x1e000086,0x0006feff,0xffaa0000,0x000000e5,0x00000c00,0x06000000,0x00000003,0xc3530300,0x0042b9ff,0x00000000,0xfffc7b01,0xffffffff,0xb7ffffff,0x0000000c,0xb1160000,0xabfcffff,0x00000141,0x00000000,0x0ee8fb12,0xf0ea1c00,0x3a020024,0x9c1c5861,0xc900f9ff,0x00004eff,0x62ff9700,0x00c3ff96,0xd9010000,0x00001cff,0x0088ffdb,0xb9ff8100,
-0xff6c0000,0x000002b9,0x81030000,0xab000027,0x00005cff,0x07feff65,0x00000000,0x89ffff43,0xf3f71000,0xdd000003,0x00008eff,0x01350700,0xff720000,0x34000095,0x0032ffff,0x07060000,0x01000000,0x005bffca,0x00000000,0x00068532,0x00000000,0x66552901,0x00000062,0xffca0000,0x00000045,0x82000000,0x000086ff,0x24ffff43,0x01000000,0x002effe0,0xcbff9a00,0x00000000,
-0x5fff5f00,0xffab0000,0x000000c3,0x004effb4,0xfff72400,0x000000af,0x0040e521,0x8c000000,0x00000bb2,0x00000000,0xcafaa534,0x00000253,0x77420000,0x77777777,0x77777777,0x00000045,0xffe84900,0x0029a5fe,0x00000000,0x00000207,0x57fff80a,0xf8460000,0x000034e0,0xf8350000,0x4e00c4ff,0x0007beff,0xedd20f00,0x00ddffc4,0x3a000000,0x0022c9f8,0x00a4ffbd,0xd6ffa300,
-0xad010000,0x000aa1ff,0xe3070000,0x260000c6,0x024eeaf3,0x26ffff46,0x53000000,0x36feffef,0xff800000,0xbf00007d,0x0000a8ff,0x6bff0d00,0xe00f0000,0x170024e8,0x0050ffff,0xe46e0000,0x00000014,0x4df5ed21,0x00000000,0x006cff4d,0x00000000,0x00000000,0x00000000,0xfc390000,0x0000009f,0x17000000,0x0011d9ed,0x4bffff26,0x00000000,0x008cff65,0xf1ff7c00,0x00000001,
-0xddda0a00,0xfffea178,0x0000009c,0x7bf1e61c,0xfcffe475,0x1400003c,0x37f6ffe1,0xff760000,0x0003c6ff,0x00000000,0x881c0000,0x00007bed,0x66665f04,0x66666666,0x11656666,0x08000000,0xccfffe96,0x00000038,0x00000000,0x768cdd67,0x48ffffc4,0x41000000,0x7fb8fcee,0xfff69d72,0x000054ff,0x95e8fe76,0xfe926d7b,0x0ffcffff,0x00000000,0xb5f9e841,0x7dd8ffd9,0xa9ffffb8,
-0x07000000,0x91e5ffa7,0xffdb8673,0x00003eff,0xebffe438,0x95ffffcc,0xffdf9e7b,0x0084ffff,0xa2040000,0xd189cdff,0x776cd6ff,0xdcff9982,0x30000001,0x7fa5f8e6,0x72a3ffff,0xffbe8877,0x0000007e,0xffe22c00,0xa27380c0,0x02dbfff7,0x00000000,0x00000000,0x00000000,0x60000000,0xb576a4fc,0x0000069b,0x9aeaee3c,0x79ffff84,0x00000000,0xccff8901,0xffffad87,0x00000023,
-0xb91e0000,0xdbffffff,0x0000001a,0xffcf2400,0x6bf9ffff,0x00000000,0x0bd8fe6e,0xcb180000,0x00007eff,0x00000000,0x00000000,0x0015640b,0xffef4000,0xffffffff,0xd3ffffff,0x0200001c,0x037bfb96,0x00000000,0x00000000,0xffffb81b,0x06c0ffff,0x00000000,0xfff09314,0xf6ffffff,0x00000076,0xf7b63a00,0xffffffff,0x59ffffff,0x00000000,0xe7871100,0xffffffff,0x18b7fcff,
-0x00000000,0xffd65901,0xffffffff,0x000050d1,0xcd740b00,0xffffffff,0xfcffffff,0x00004fc7,0x01000000,0xffffdb64,0xffffffff,0xffffffff,0x00000043,0xfff5a11b,0xffffffff,0xffffffff,0x000004e5,0x8c100000,0xfffffff1,0x17aff8ff,0x00000000,0x00000000,0x00000000,0x00000000,0xffffd942,0x000bc1ff,0xf39c1a00,0xa8ffffff,0x00000000,0xc1450000,0xfffffffe,0x00000053,
-0x00000000,0x084b5c30,0x00000000,0x46030000,0x00236c74,0x00000000,0x00195200,0x0b000000,0x0000005f,0x00000000,0x00000000,0x00000000,0x662a0000,0x66666666,0x66666666,0x00000049,0x00002400,0x00000000,0x00000000,0x5c230000,0x00014164,0x00000000,0x3c060000,0x134e665a,0x00000000,0x0b000000,0x66645232,0x45666666,0x00000000,0x02000000,0x5f655229,0x00001b4b,
-0x00000000,0x27000000,0x244d6652,0x00000000,0x00000000,0x66563c13,0x15425c66,0x00000000,0x00000000,0x50280000,0x66666666,0x66666666,0x00000036,0x3b0b0000,0x6666665c,0x66666666,0x00001566,0x00000000,0x5f5c3f06,0x00000f40,0x00000000,0x00000000,0x00000000,0x00000000,0x603c0200,0x00001c56,0x0a000000,0x50665c3b,0x00000000,0x00000000,0x66614918,0x0000002e,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00050000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x8f020000,0x00000013,0x001e9203,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xac2d0000,0x00000249,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff780000,0x000014d0,0x43ecc40f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x7e000000,0x0006cbff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfffa3100,0x00000ddd,0xf9b20700,0x00000054,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x05000000,0x0081ffcf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfbffb400,0x00000039,0xc0060000,0x000042f9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x33fbf92e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x98fffe34,0x00000000,0x16000000,0x001aede8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xd2ff7e00,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00060000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21fbff96,0x00000000,0x00000000,0x00b1ff59,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xffcc0500,0x00000083,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x436b0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00adffe1,0x00000000,0x00000000,0x38ffd501,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xf92d0000,0x000033fb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x0c060000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf6600000,0x00000010,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28000000,0x0064ffff,0x00000000,0x00000000,0xa7ff7300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x7c000000,0x0007d2ff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xc87f0000,0x00000012,0x00000000,0x32000000,0x00340000,0x00000000,0x00000000,0xff470000,0x0000002f,0x00000000,0x00000000,0x00000000,0x00000000,0x905a0500,0x00367e9f,0x4b9a6401,0x00000000,0x00000000,0x46000000,0x0021ffff,0x00000000,0x00000000,0xf3ff2600,0x00000009,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x04000000,0x0085ffcc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1c7f2700,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xfffe5c00,0x000002ce,0x00000000,0x54000000,0x608b0192,0x00000000,0x07000000,0xffbb8953,0x00000576,0x00000000,0x0000083c,0x00000000,0x00000000,0xffffc106,0xbfffffff,0xffffffa5,0x0000008c,0x00000000,0x5f000000,0x0004feff,0x00000000,0x00000000,0xfff20100,0x0000003a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x33fbf82d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x09000000,0xb6b69a5c,0x00014290,0x00000000,0x00000000,0xfcff1900,0x00000019,0x00000000,0x00000000,0x00000000,0x9d630600,0x00045696,0x00000000,0x00000710,0x00000000,0x00000000,0x00000000,
-0x00000000,0xffb50a00,0x00000079,0x00000000,0x0c000000,0xfe3e88f6,0x00000050,0xad000000,0xfff5ffff,0x001ecffa,0x00000000,0x0001c26e,0x759e7507,0x00000014,0xcfffff6e,0xda5e3c59,0x6a9affff,0x000010fc,0x00000000,0x69000000,0x0000eaff,0x00000000,0x00000000,0xffd60000,0x00000067,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd4ff7900,0x00000007,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01000000,0xffffff99,0x27c6ffff,0x00000000,0x00000000,0xfff90200,0x00000039,0xbbb2934e,0x000961a0,0x00000000,0xffffcd12,0x1ccbffff,0x00000000,0x2999ec1d,0x00000000,0x00000000,0x00000000,
-0x00000000,0x591b0000,0x00000000,0x00000000,0x00000000,0xe805e6b1,0x000000b0,0x08000000,0xfb095a9b,0x02c9ff8b,0x00000000,0x005ad304,0xffffff97,0x000043ec,0x0de3ffa8,0xee110000,0x002ffcff,0x00000033,0x00000000,0x5c000000,0x0000e6ff,0x00000000,0x00000000,0xffcc0000,0x0000007b,0x00000000,0x00000000,0x00000000,0x00094b00,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffcb0400,0x00000085,0x00000000,0x00000000,0x00000000,0x69000000,0xaaaaaaaa,0x0016a4aa,0x00000000,0x00000000,0x00000000,0x2f668001,0xeeea5e24,0x0000002b,0x00000000,0xffdd0000,0x00001e6a,0xfffffc54,0x44e5ffff,0x00000000,0x9affff9e,0xd6f56e41,0x0000000e,0x98ffcb00,0x00000000,0x00000000,0x00000000,
-0x00000000,0xbf4f0000,0x0000001c,0x00000000,0x00000000,0x9b39ff60,0x00000af6,0x00000000,0xe5000000,0x2affffa6,0x00000000,0x0ce34000,0x49b8ffdd,0x0028f5e6,0x009fffab,0xff880000,0x08d3d6f3,0x00000000,0x00000000,0x3e000000,0x0001f6ff,0x00000000,0x00000000,0xffdd0000,0x00000081,0x00000000,0x00000000,0x00000000,0x14c77800,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf82b0000,0x000035fb,0x00000000,0x96460000,0x00045593,0x0f000000,0xffffffc8,0x0fd2ffff,0xaaaaaa31,0xaaaaaaaa,0x000060aa,0x00000000,0xff5c0000,0x5e2100c6,0xb09c8571,0xfffad8c4,0x0055fcff,0x3c875700,0xf9d64e22,0x0c000049,0x00b7fffa,0xff800000,0x00000088,0xd6ff6d00,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff3a0000,0x000000bc,0x00000000,0xbbb61800,0xd6d8ffc6,0xb5bbc9ff,0x00000016,0xca000000,0x17f7ffff,0x00000000,0x87a50000,0x006effc6,0x00a8ff7f,0x00acff71,0xfff51000,0x74ff5284,0x00000000,0x00000000,0x0e000000,0x0021fffc,0x00000000,0x00000000,0xfff60000,0x0000006a,0x00095c00,0x00000000,0x00000000,0x99ff5a00,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x79000000,0x0007d4ff,0x00000000,0xfffe6600,0x26ceffff,0x00000000,0xffa6330f,0x153333b5,0xfffe6a00,0xffffffff,0x005efeff,0x00000000,0xff5f0000,0xab070aff,0xffffffff,0xffffffff,0x26c2daf8,0x00000000,0xff270000,0x350007e5,0x0056ffff,0xff490000,0x000000e4,0xffdd0700,0x00000033,0x00000000,0x00000000,
-0x00000000,0xff2c0000,0x000000d6,0x00000000,0xff790000,0xffffffff,0xffffffff,0x000001b4,0xf5740100,0x005cfbff,0xb14c0000,0xec1d5cae,0x00adff88,0x00ddff84,0x29f8d908,0xf3ff7400,0xd8f90812,0x00000000,0x00000000,0x00000000,0x005fffbf,0x00000000,0x00000000,0xffff2900,0x00000052,0x12e5bc00,0x00000000,0x00000000,0xb7ff3c00,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x0085ffc9,0x00000000,0xf3ffee03,0xe7ca4d67,0x00000024,0xff750000,0x000000be,0xa8450000,0x34b1fff6,0x00303333,0x00000504,0xffec5305,0x030004fb,0x60e6ff95,0xff922f47,0x000000b0,0x00000000,0xf5010000,0x360047ff,0x006effff,0xff690000,0x000008ff,0xff5b0000,0x000000b5,0x00000000,0x00000000,
-0x00000000,0xff1e0000,0x000000ee,0x00000000,0x11020000,0x28fe8c11,0x1111e1c0,0x00000211,0xffff8900,0x00003ae8,0xfffb2900,0x82bbffff,0xd1ffa2b5,0x00c9fff3,0xe8cf1a00,0xffffdb60,0xfff9cdeb,0x377d9bb6,0x00000000,0x00000000,0x00b2ff63,0x00000000,0x00000000,0xffff7000,0x992d001e,0x37ff9e39,0x00199156,0x00000000,0xd3ff1e00,0x00000000,0x08000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x36fcf82b,0x00000000,0x74ffff22,0xe60f0000,0x000006ce,0xff570000,0x000000db,0x00000000,0xa2fc860d,0x00000001,0xd4d48501,0xfffffff1,0x000000aa,0xb5ff7f00,0xff66000b,0x000000cd,0x00000000,0xff380000,0x1e0061ff,0x2becffff,0xffda1600,0x000000ee,0xbe020000,0x000039ff,0x00000000,0x00000000,
-0x00000000,0xff130000,0x35360aff,0x00353600,0xbb360000,0xceffd1bb,0xbbc0ffe0,0x000006a5,0xf9fffa05,0x000000d1,0xfcff6000,0xaeff783a,0xe4724dda,0x0047ecff,0x6d060000,0x49eeffed,0xffffeaae,0xffffffff,0x150028c7,0x0000015c,0x28fcdf06,0x00000000,0x00000000,0xd2ffc600,0x70000000,0xedffd6fa,0x2eedffff,0xbbbb8401,0xf7ffbfbb,0x78bbbbbb,0xe8410000,0x0000003e,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd4ff7600,0x00000007,0x32ffff22,0x7e000000,0x000068ff,0xff390000,0x000001f8,0x00000000,0xf7480000,0x00000091,0xff820000,0x86ebffff,0x0000000a,0xfc6a0000,0xff4915ca,0x000000eb,0x00000000,0xffe34901,0x000041ff,0xf9dbffdf,0xfffff1d1,0x00000091,0x1b000000,0x000cd6ec,0x00000000,0x00000000,
-0x00000000,0xff0f0000,0xfc5a1bff,0x95fc5a95,0xa6000000,0xffffffff,0xffffffff,0x000088ff,0xb5ffef00,0x064701e8,0xf0ff4300,0xfff60200,0x0007da77,0x0000000d,0x01000000,0x8ff9ffdc,0x1108000b,0x5f241211,0x1e13e7f7,0x0018c4ff,0xb8ff4e00,0x00000000,0x00000000,0x84ffff42,0x00000000,0xffffff5f,0x001c90f3,0xffb60b00,0xffffffff,0xffffffff,0x9a030395,0x000043f8,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffc90300,0x00000087,0x2bfff305,0x49000000,0x0000cdff,0xff1c0000,0x000017ff,0x00000000,0x6d000000,0x000050ff,0x10000000,0x96fcb642,0x00000003,0x54000000,0xff4fdbf8,0x000009ff,0xd0d41700,0xffffffec,0x000002c0,0x5084ff86,0xa0f7fbc9,0x0000000b,0x00000000,0x00a5ff4f,0x00000000,0x00000000,
-0x00000000,0xff140000,0xff5a2aff,0xf0ff5af0,0x05000000,0xeead1111,0x11bde414,0x00001011,0xedfe6c00,0xb7ffdffc,0xffd6040a,0xfff80d36,0x0078b45f,0x00000000,0x24000000,0xcd58ffff,0x000012c9,0x00000000,0x1e6effd6,0x003cffff,0xff930000,0x0000006e,0x01000000,0x16f3ffc3,0x0e000000,0xfeffffb5,0x0000004b,0x11030000,0xffc71111,0x1111113f,0x04000311,0x0013ece8,
-0x00000000,0x00000000,0x03120000,0x00000000,0x00000000,0x00000000,0xf7290000,0x000036fc,0x4cffa900,0x39000000,0x0008feff,0xfa032e63,0x000035ff,0x00000000,0x09000000,0x000ce8f8,0x00000000,0xffa40000,0x0000008a,0x00000000,0xfff2f141,0x000026ff,0xffed0000,0x7ed3f3ff,0x0000000a,0x06e6ef12,0x00040500,0x00000000,0x00000000,0x6eff8700,0x00000000,0x00000000,
-0x00000000,0xff220000,0xff5a39ff,0xf0ff5af0,0x00000000,0xff5a0000,0x0ff89340,0x00000000,0xab350000,0x608dafff,0xee2d0016,0xffffdff3,0x1bec2448,0x00000000,0x33000000,0x5a1bffff,0x0000a6ff,0x40000000,0x1e7bfffe,0x003cffff,0xb9040000,0x00004ff9,0x72000000,0x008bffff,0xc40a0000,0xf9fff5ff,0x00004cf3,0x00000000,0xffa60000,0x0000004c,0x1f000000,0x0066fff3,
-0x00000000,0x00000000,0xaab60200,0x00000006,0x00000000,0x00000000,0x76000000,0x0008d4ff,0xa9fc3000,0x60000000,0x0019ffff,0xeb9bfc87,0x000053ff,0x00000000,0x00000000,0x0055ffed,0x00000000,0xff470000,0x000001f3,0x00000000,0xffe73000,0x000044ff,0xffbd0000,0x0000005c,0x00000000,0x85fe5300,0x00000000,0x00000000,0x00000000,0xfea40100,0x00000066,0x00000000,
-0x00000000,0xff480000,0xff5a43ff,0xf0ff5af0,0x00000000,0xfa0f0000,0x5aff4390,0x00000000,0x42000000,0x000036ff,0x24000000,0xadfcfbb0,0xa5870003,0x00000000,0x09000000,0x5b2ffffa,0x0006f9ff,0x00000000,0x1e1ace4f,0x003cffff,0x07000000,0x005af9ab,0xf5100000,0x0010dfff,0xf3510000,0xcbff3cf0,0x005fee5f,0x00000000,0xff8a0000,0x0000006a,0xe3100000,0x0063ffff,
-0x00000000,0x00000000,0xffff9100,0x000000a2,0x00000000,0x00000000,0x03000000,0x0089ffc7,0xfc7d0000,0xd3120058,0x0002f7ff,0xfff18b1a,0x000070ff,0xa74f0000,0x7301001b,0x005affff,0x697c0000,0xff800001,0x00000bfe,0x00000000,0xdb220000,0x000061ff,0xff8e0000,0x00000087,0x00000000,0xfc740000,0x0000077c,0x00003135,0x00000000,0xbd060000,0x000065fe,0x00000000,
-0x00000000,0xfc5a0000,0xff5834ff,0xf0ff58f0,0x00000000,0x5b000000,0xad8d02dd,0x00000000,0x1e000000,0x000050f9,0x00000000,0x00080500,0x920c0000,0x00000029,0x00000000,0xf3e5ff8c,0x0000eeff,0x00000000,0x1b000000,0x003cfffe,0x00000000,0x20f88003,0x56000000,0x000039f6,0x19000000,0xe8df0031,0x00000700,0x00000000,0xe2290000,0x00000086,0x55000000,0x260bd2f9,
-0xbbbbbbb3,0x00017dbb,0xfad11900,0x00000043,0x00000000,0x00000000,0x00000000,0x36f3a01f,0x8d010000,0xffefdbff,0x000099ff,0x8e0e0000,0x00008efb,0xe62b0000,0xffe1d9fe,0x0015e5ff,0xff710000,0xffffd6e0,0x000000c3,0x00000000,0x17000000,0x00007fcc,0xff4f0000,0xbbbbbbe7,0x000692bb,0x5f000000,0xe3ccf1f1,0x003cf1ff,0xbbbb8d05,0xc9bbbbbb,0x0069feff,0x00000000,
-0x00000000,0x1a000000,0x72031777,0xe77203e7,0x00000000,0x00000000,0x72002c4e,0x0000000a,0x00000000,0x00005846,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffe27002,0x000059ec,0x00000000,0x00000000,0x003cdd44,0x00000000,0x001f0000,0x00000000,0x0000001f,0x00000000,0x91100000,0x00000006,0x00000000,0x1b000000,0x00000075,0x00000000,0x0000103a,
-0xffffe535,0x0bacffff,0x3f110000,0x00000000,0x00000000,0x00000000,0x00000000,0x4f140000,0x00000000,0xf8fcc64e,0x00000da8,0x00000000,0x0000722e,0x0c000000,0xfbfbce74,0x00002bbc,0x58000000,0xaff9fccb,0x0000001b,0x00000000,0x00000000,0x0000590d,0x61000000,0xfffffffa,0x0fbdffff,0x00000000,0xfedd8b19,0x0495e3ff,0xffaf0c00,0xffffffff,0x75feffff,0x00000000,
-0x00000000,0x00000000,0x00000000,0x1e00001e,0x00000000,0x00000000,0x00000200,0x00000002,0x00000000,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0a000000,0x00000000,0x00000000,0x00000000,0x00140c00,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x11110800,0x06111111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05050000,0x00000000,0x00000000,0x00000000,0x00000000,0x06040000,0x00000000,0x00000000,0x00040700,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1111110d,0x07111111,0x00000000,0x05000000,0x00000008,0x11020000,0x11111111,0x11111111,0x00000000,
-0 };
-
-struct GlyphPosition {
-    int X;
-    int Y;
-};
-
-struct GlyphMetrics {
-    int XBearing;
-    int YBearing;
-    int Width;
-    int Height;
-    int XAdvance;
-    int YAdvance;
-};
-
-struct Glyph {
-    GlyphPosition Position;
-    GlyphMetrics Metrics;
-};
-
-static const Glyph Glyphs[] = {
-    {{ 0, 0 }, { 0, -1, 1, 1, 1, 0 }},
-    {{ 1, 0 }, { 0, -1, 1, 1, 16, 0 }},
-    {{ 3, 0 }, { 0, -1, 1, 1, 7, 0 }},
-    {{ 4, 0 }, { 1, -15, 5, 16, 6, 0 }},
-    {{ 10, 0 }, { 2, -14, 6, 7, 8, 0 }},
-    {{ 17, 0 }, { 0, -13, 13, 15, 12, 0 }},
-    {{ 30, 0 }, { 0, -14, 10, 17, 9, 0 }},
-    {{ 41, 0 }, { 2, -13, 14, 15, 16, 0 }},
-    {{ 56, 0 }, { 1, -15, 19, 15, 19, 0 }},
-    {{ 75, 0 }, { 2, -14, 3, 7, 5, 0 }},
-    {{ 79, 0 }, { 2, -19, 8, 24, 8, 0 }},
-    {{ 88, 0 }, { -1, -19, 9, 24, 8, 0 }},
-    {{ 97, 0 }, { 1, -15, 10, 10, 10, 0 }},
-    {{ 108, 0 }, { 0, -11, 13, 12, 12, 0 }},
-    {{ 122, 0 }, { 0, -4, 5, 8, 5, 0 }},
-    {{ 127, 0 }, { 1, -6, 8, 3, 8, 0 }},
-    {{ 136, 0 }, { 0, -4, 5, 5, 5, 0 }},
-    {{ 142, 0 }, { -3, -19, 18, 24, 10, 0 }},
-    {{ 160, 0 }, { 1, -11, 10, 11, 11, 0 }},
-    {{ 171, 0 }, { 1, -12, 8, 12, 10, 0 }},
-    {{ 180, 0 }, { 0, -11, 11, 11, 12, 0 }},
-    {{ 191, 0 }, { 0, -11, 10, 15, 10, 0 }},
-    {{ 202, 0 }, { 0, -12, 13, 15, 13, 0 }},
-    {{ 216, 0 }, { 0, -10, 11, 14, 11, 0 }},
-    {{ 227, 0 }, { 2, -14, 12, 14, 12, 0 }},
-    {{ 240, 0 }, { 1, -11, 12, 14, 11, 0 }},
-    {{ 0, 24 }, { 1, -14, 9, 14, 11, 0 }},
-    {{ 9, 24 }, { 0, -10, 12, 15, 12, 0 }},
-    {{ 22, 24 }, { 0, -10, 6, 11, 5, 0 }},
-    {{ 28, 24 }, { 0, -10, 6, 14, 5, 0 }},
-    {{ 35, 24 }, { 1, -11, 12, 12, 12, 0 }},
-    {{ 48, 24 }, { 0, -8, 13, 6, 12, 0 }},
-    {{ 61, 24 }, { 0, -11, 13, 12, 12, 0 }},
-    {{ 75, 24 }, { 1, -15, 8, 16, 8, 0 }},
-    {{ 84, 24 }, { 1, -15, 14, 15, 15, 0 }},
-    {{ 98, 24 }, { 1, -14, 15, 15, 15, 0 }},
-    {{ 114, 24 }, { 1, -14, 14, 14, 15, 0 }},
-    {{ 129, 24 }, { 1, -15, 13, 15, 13, 0 }},
-    {{ 142, 24 }, { 1, -14, 17, 14, 18, 0 }},
-    {{ 160, 24 }, { 0, -14, 17, 14, 16, 0 }},
-    {{ 178, 24 }, { 1, -14, 16, 14, 15, 0 }},
-    {{ 194, 24 }, { 1, -15, 13, 21, 14, 0 }},
-    {{ 208, 24 }, { 1, -18, 22, 19, 18, 0 }},
-    {{ 231, 24 }, { 1, -14, 9, 14, 10, 0 }},
-    {{ 240, 24 }, { -2, -14, 12, 19, 10, 0 }},
-    {{ 0, 46 }, { 1, -14, 17, 14, 17, 0 }},
-    {{ 17, 46 }, { 0, -14, 14, 14, 14, 0 }},
-    {{ 32, 46 }, { 1, -15, 21, 16, 21, 0 }},
-    {{ 53, 46 }, { 1, -18, 23, 19, 18, 0 }},
-    {{ 77, 46 }, { 1, -15, 13, 15, 15, 0 }},
-    {{ 91, 46 }, { 1, -14, 14, 14, 14, 0 }},
-    {{ 105, 46 }, { 1, -15, 21, 20, 15, 0 }},
-    {{ 127, 46 }, { 1, -15, 17, 15, 17, 0 }},
-    {{ 145, 46 }, { 0, -15, 12, 15, 12, 0 }},
-    {{ 157, 46 }, { 1, -19, 19, 19, 16, 0 }},
-    {{ 177, 46 }, { 1, -15, 18, 15, 18, 0 }},
-    {{ 196, 46 }, { 1, -14, 15, 15, 15, 0 }},
-    {{ 211, 46 }, { 1, -14, 18, 15, 19, 0 }},
-    {{ 230, 46 }, { 0, -14, 16, 14, 15, 0 }},
-    {{ 0, 66 }, { 1, -14, 14, 14, 13, 0 }},
-    {{ 14, 66 }, { 0, -14, 14, 14, 13, 0 }},
-    {{ 29, 66 }, { 1, -18, 10, 23, 7, 0 }},
-    {{ 39, 66 }, { 0, -19, 8, 24, 8, 0 }},
-    {{ 48, 66 }, { -2, -18, 10, 23, 7, 0 }},
-    {{ 59, 66 }, { 1, -14, 11, 12, 12, 0 }},
-    {{ 70, 66 }, { 0, -1, 12, 3, 12, 0 }},
-    {{ 83, 66 }, { 5, -15, 5, 5, 10, 0 }},
-    {{ 89, 66 }, { 1, -10, 11, 10, 11, 0 }},
-    {{ 100, 66 }, { 1, -18, 11, 18, 11, 0 }},
-    {{ 112, 66 }, { 1, -10, 8, 10, 9, 0 }},
-    {{ 121, 66 }, { 1, -18, 15, 18, 11, 0 }},
-    {{ 136, 66 }, { 1, -10, 8, 10, 9, 0 }},
-    {{ 145, 66 }, { -5, -18, 17, 26, 7, 0 }},
-    {{ 163, 66 }, { -1, -10, 12, 18, 11, 0 }},
-    {{ 175, 66 }, { 1, -18, 11, 18, 12, 0 }},
-    {{ 187, 66 }, { 1, -15, 6, 15, 7, 0 }},
-    {{ 194, 66 }, { -5, -15, 12, 23, 6, 0 }},
-    {{ 206, 66 }, { 1, -18, 10, 18, 10, 0 }},
-    {{ 217, 66 }, { 2, -18, 10, 18, 7, 0 }},
-    {{ 228, 66 }, { 1, -10, 16, 10, 17, 0 }},
-    {{ 0, 93 }, { 1, -10, 12, 10, 13, 0 }},
-    {{ 12, 93 }, { 1, -10, 9, 10, 10, 0 }},
-    {{ 22, 93 }, { -5, -11, 16, 19, 11, 0 }},
-    {{ 38, 93 }, { 1, -10, 10, 18, 11, 0 }},
-    {{ 49, 93 }, { 1, -10, 10, 10, 9, 0 }},
-    {{ 60, 93 }, { 0, -10, 9, 10, 8, 0 }},
-    {{ 69, 93 }, { 0, -13, 10, 13, 8, 0 }},
-    {{ 80, 93 }, { 0, -11, 12, 11, 12, 0 }},
-    {{ 93, 93 }, { 1, -10, 11, 11, 11, 0 }},
-    {{ 104, 93 }, { 0, -10, 15, 11, 14, 0 }},
-    {{ 120, 93 }, { 0, -10, 13, 10, 12, 0 }},
-    {{ 134, 93 }, { -1, -11, 13, 19, 12, 0 }},
-    {{ 147, 93 }, { -1, -10, 10, 10, 9, 0 }},
-    {{ 158, 93 }, { 0, -18, 10, 23, 8, 0 }},
-    {{ 169, 93 }, { 1, -15, 5, 17, 5, 0 }},
-    {{ 174, 93 }, { -1, -19, 10, 23, 8, 0 }},
-    {{ 185, 93 }, { 2, -8, 10, 6, 13, 0 }},
-};
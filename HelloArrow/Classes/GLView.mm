@@ -1,4 +1,5 @@
 #import "GLView.h"
+#include "../../Common/Classes/Profiler.hpp"
 #import <OpenGLES/ES2/gl.h> // <-- for GL_RENDERBUFFER only
 
 const bool ForceES1 = false;
@@ -81,6 +82,7 @@ const bool ForceES1 = false;
 
     m_renderingEngine->Render();
     [m_context presentRenderbuffer:GL_RENDERBUFFER];
+    PROFILE_FRAME();
 }
 
 @end
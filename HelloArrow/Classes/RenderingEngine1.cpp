@@ -1,6 +1,7 @@
 #include <OpenGLES/ES1/gl.h>
 #include <OpenGLES/ES1/glext.h>
 #include "IRenderingEngine.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 static const float RevolutionsPerSecond = 1;
 
@@ -74,6 +75,7 @@ void RenderingEngine1::Initialize(int width, int height)
 
 void RenderingEngine1::Render() const
 {
+    PROFILE_ZONE("RenderingEngine1::Render");
     glClearColor(0.5f, 0.5f, 0.5f, 1);
     glClear(GL_COLOR_BUFFER_BIT);
     glPushMatrix();
@@ -104,6 +106,7 @@ float RenderingEngine1::RotationDirection() const
 
 void RenderingEngine1::UpdateAnimation(float timeStep)
 {
+    PROFILE_ZONE("RenderingEngine1::UpdateAnimation");
     float direction = RotationDirection();
     if (direction == 0)
         return;
@@ -3,6 +3,7 @@
 #include <cmath>
 #include <iostream>
 #include "IRenderingEngine.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 #define STRINGIFY(A)  #A
 #include "../Shaders/Simple.vert"
@@ -114,6 +115,7 @@ void RenderingEngine2::ApplyRotation(float degrees) const
 
 void RenderingEngine2::Render() const
 {
+    PROFILE_ZONE("RenderingEngine2::Render");
     glClearColor(0.5f, 0.5f, 0.5f, 1);
     glClear(GL_COLOR_BUFFER_BIT);
     
@@ -151,6 +153,7 @@ float RenderingEngine2::RotationDirection() const
 
 void RenderingEngine2::UpdateAnimation(float timeStep)
 {
+    PROFILE_ZONE("RenderingEngine2::UpdateAnimation");
     float direction = RotationDirection();
     if (direction == 0)
         return;
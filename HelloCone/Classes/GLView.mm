@@ -1,4 +1,5 @@
 #import "GLView.h"
+#include "../../Common/Classes/Profiler.hpp"
 
 #define GL_RENDERBUFFER 0x8d41
 
@@ -80,6 +81,7 @@
 
     m_renderingEngine->Render();
     [m_context presentRenderbuffer:GL_RENDERBUFFER];
+    PROFILE_FRAME();
 }
 
 @end
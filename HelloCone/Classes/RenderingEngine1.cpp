@@ -2,6 +2,7 @@
 #include <OpenGLES/ES1/glext.h>
 #include "IRenderingEngine.hpp"
 #include "Quaternion.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <vector>
 
 static const float AnimationDuration = 0.25f;
@@ -140,6 +141,7 @@ void RenderingEngine1::Initialize(int width, int height)
 
 void RenderingEngine1::Render() const
 {
+    PROFILE_ZONE("RenderingEngine1::Render");
     glClearColor(0.5f, 0.5f, 0.5f, 1);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     glPushMatrix();
@@ -168,6 +170,7 @@ void RenderingEngine1::Render() const
 
 void RenderingEngine1::UpdateAnimation(float timeStep)
 {
+    PROFILE_ZONE("RenderingEngine1::UpdateAnimation");
     if (m_animation.Current == m_animation.End)
         return;
 
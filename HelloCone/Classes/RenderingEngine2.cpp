@@ -2,6 +2,7 @@
 #include <OpenGLES/ES2/glext.h>
 #include "IRenderingEngine.hpp"
 #include "Quaternion.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <vector>
 #include <iostream>
 
@@ -152,6 +153,7 @@ void RenderingEngine2::Initialize(int width, int height)
 
 void RenderingEngine2::Render() const
 {
+    PROFILE_ZONE("RenderingEngine2::Render");
     GLuint positionSlot = glGetAttribLocation(m_simpleProgram, "Position");
     GLuint colorSlot = glGetAttribLocation(m_simpleProgram, "SourceColor");
 
@@ -195,6 +197,7 @@ void RenderingEngine2::Render() const
 
 void RenderingEngine2::UpdateAnimation(float timeStep)
 {
+    PROFILE_ZONE("RenderingEngine2::UpdateAnimation");
     if (m_animation.Current == m_animation.End)
         return;
     
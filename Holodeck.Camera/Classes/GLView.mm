@@ -1,4 +1,5 @@
 #import "GLView.h"
+#include "../../Common/Classes/Profiler.hpp"
 
 #define GL_RENDERBUFFER 0x8d41
 
@@ -146,6 +147,7 @@
     
     m_renderingEngine->Render(m_theta, m_phi, buttonFlags);
     [m_context presentRenderbuffer:GL_RENDERBUFFER];
+    PROFILE_FRAME();
 }
 
 bool buttonHit(CGPoint location, int x, int y)
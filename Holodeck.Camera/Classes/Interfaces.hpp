@@ -1,5 +1,6 @@
 #pragma once
 #include "Vector.hpp"
+#include "../../Common/Classes/AsyncLoader.hpp"
 #include <vector>
 #include <string>
 
@@ -60,7 +61,9 @@ struct IRenderingEngine {
     virtual ~IRenderingEngine() {}
 };
 
-struct IResourceManager {
+// Decode comes from IImageDecoder and runs on the texture loader's threads;
+// the rest is for the main thread.
+struct IResourceManager : IImageDecoder {
     virtual TextureDescription LoadImagePot(const string& image) = 0;
     virtual void* GetImageData() = 0;
     virtual void UnloadImage() = 0;
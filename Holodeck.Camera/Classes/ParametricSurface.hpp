@@ -1,4 +1,5 @@
 #include "Interfaces.hpp"
+#include "../../Common/Classes/GeodesicSphere.hpp"
 
 struct ParametricInterval {
     ivec2 Divisions;
@@ -175,3 +176,38 @@ public:
 private:
     float m_radius;
 };
+
+// A geodesic sphere of unit radius, or the part of it no higher than
+// maxHeight, with each triangle mapping the whole of an equilateral
+// texture triangle.
+class GeodesicSurface : public ISurface {
+public:
+    GeodesicSurface(int frequency, float maxHeight = 1) : m_sphere(frequency, maxHeight) {}
+    int GetVertexCount() const { return m_sphere.GetVertexCount(); }
+    int GetLineIndexCount() const { return m_sphere.GetLineIndexCount(); }
+    int GetTriangleIndexCount() const { return m_sphere.GetTriangleIndexCount(); }
+    void GenerateVertices(vector<float>& vertices, unsigned char flags) const
+    {
+        vertices.clear();
+        for (int i = 0; i < GetVertexCount(); ++i) {
+            const float* position = m_sphere.GetPosition(i);
+            vertices.insert(vertices.end(), position, position + 3);
+            if (flags & VertexFlagsNormals)
+                vertices.insert(vertices.end(), position, position + 3);
+            if (flags & VertexFlagsTexCoords) {
+                const float* texCoord = m_sphere.GetTexCoord(i);
+                vertices.insert(vertices.end(), texCoord, texCoord + 2);
+            }
+        }
+    }
+    void GenerateLineIndices(vector<unsigned short>& indices) const
+    {
+        indices = m_sphere.GetLineIndices();
+    }
+    void GenerateTriangleIndices(vector<unsigned short>& indices) const
+    {
+        indices = m_sphere.GetTriangleIndices();
+    }
+private:
+    GeodesicSphere m_sphere;
+};
@@ -3,7 +3,25 @@
 #include "Interfaces.hpp"
 #include "Matrix.hpp"
 #include "ParametricSurface.hpp"
-#include "../Models/GeodesicDome.h"
+#include "../../Common/Classes/MipStreamer.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+
+// Textures load in the background and go up a few per frame, most
+// important first; nothing is drawn until its texture is in.
+const int LoaderThreadCount = 1;
+const size_t UploadBytesPerFrame = 256 * 1024;
+
+// Mipmapped PVRs start out with their 32x32 and smaller levels and gain a
+// level a frame, within a budget of their own, until they're as sharp as
+// their size on screen calls for.
+const size_t TextureMemoryCap = 512 * 1024;
+const size_t StreamBytesPerFrame = 64 * 1024;
+
+// The dome is the lower part of a geodesic sphere whose icosahedron's
+// edges are cut 16 ways.  The camera stays inside it, so one level of
+// detail is all it needs.
+const int DomeFrequency = 16;
+const float DomeHeight = 0.125f;
 
 struct Drawable {
     GLuint VertexBuffer;
@@ -19,14 +37,14 @@ struct Drawables {
 };
 
 struct Textures {
-    GLuint Sky;
-    GLuint Floor;
-    GLuint Button;
-    GLuint Triangle;
-    GLuint North;
-    GLuint South;
-    GLuint East;
-    GLuint West;
+    LoadHandle Sky;
+    LoadHandle Floor;
+    LoadHandle Button;
+    LoadHandle Triangle;
+    LoadHandle North;
+    LoadHandle South;
+    LoadHandle East;
+    LoadHandle West;
 };
 
 struct Renderbuffers {
@@ -34,24 +52,35 @@ struct Renderbuffers {
     GLuint Depth;
 };
 
+class TextureUploader : public IImageUploader {
+public:
+    TextureUploader(MipStreamer* streamer) : m_streamer(streamer) {}
+    unsigned int Upload(DecodedImage& image);
+private:
+    MipStreamer* m_streamer;
+};
+
 class RenderingEngine : public IRenderingEngine {
 public:
     RenderingEngine(IResourceManager* resourceManager);
     void Initialize(bool opaqueBackground);
     void Render(float theta, float phi, ButtonMask buttons) const;
 private:
-    void RenderText(GLuint texture, float theta, float scale) const;
-    GLuint CreateTexture(const string& file);
-    Drawable CreateDrawable(const ParametricSurface& surface);
-    Drawable CreateDrawable(const float* vertices, int VertexCount);
+    void RenderText(LoadHandle texture, float theta, float scale) const;
+    bool BindTexture(LoadHandle texture) const;
+    Drawable CreateDrawable(const ISurface& surface);
     void RenderDrawable(const Drawable& drawable) const;
-    void UploadImage(const TextureDescription& description);
     void SetButtonAlpha(ButtonMask pressed, ButtonFlags flag) const;
     bool m_opaqueBackground;
     Drawables m_drawables;
     Textures m_textures;
     Renderbuffers m_renderbuffers;
     IResourceManager* m_resourceManager;
+    mutable AsyncLoader m_loader;
+    mutable MipStreamer m_streamer;
+    mutable TextureUploader m_uploader;
+    float m_skyScreenSize;
+    float m_floorScreenSize;
 };
     
 IRenderingEngine* CreateRenderingEngine(IResourceManager* resourceManager)
@@ -59,7 +88,10 @@ IRenderingEngine* CreateRenderingEngine(IResourceManager* resourceManager)
     return new RenderingEngine(resourceManager);
 }
 
-RenderingEngine::RenderingEngine(IResourceManager* resourceManager)
+RenderingEngine::RenderingEngine(IResourceManager* resourceManager) :
+    m_loader(resourceManager, LoaderThreadCount),
+    m_streamer(TextureMemoryCap, StreamBytesPerFrame),
+    m_uploader(&m_streamer)
 {
     m_resourceManager = resourceManager;
     glGenRenderbuffersOES(1, &m_renderbuffers.Color);
@@ -71,19 +103,19 @@ void RenderingEngine::Initialize(bool opaqueBackground)
     m_opaqueBackground = opaqueBackground;
     
     // Create vertex buffer objects.
-    m_drawables.GeodesicDome = CreateDrawable(DomeVertices, DomeVertexCount);
+    m_drawables.GeodesicDome = CreateDrawable(GeodesicSurface(DomeFrequency, DomeHeight));
     m_drawables.SkySphere = CreateDrawable(Sphere(1));
     m_drawables.Quad = CreateDrawable(Quad(64));
     
-    // Load up some textures.
-    m_textures.Floor = CreateTexture("Moss.pvr");
-    m_textures.Sky = CreateTexture("Sky.pvr");
-    m_textures.Button = CreateTexture("Button.png");
-    m_textures.Triangle = CreateTexture("Triangle.png");
-    m_textures.North = CreateTexture("North.png");
-    m_textures.South = CreateTexture("South.png");
-    m_textures.East = CreateTexture("East.png");
-    m_textures.West = CreateTexture("West.png");
+    // Ask for the textures; they show up over the first few frames.
+    m_textures.Floor = m_loader.Load("Moss.pvr", LoadPriorityHigh);
+    m_textures.Sky = m_loader.Load("Sky.pvr", LoadPriorityHigh);
+    m_textures.Triangle = m_loader.Load("Triangle.png", LoadPriorityNormal);
+    m_textures.Button = m_loader.Load("Button.png", LoadPriorityNormal);
+    m_textures.North = m_loader.Load("North.png", LoadPriorityLow);
+    m_textures.South = m_loader.Load("South.png", LoadPriorityLow);
+    m_textures.East = m_loader.Load("East.png", LoadPriorityLow);
+    m_textures.West = m_loader.Load("West.png", LoadPriorityLow);
 
     // Extract width and height from the color buffer.
     int width, height;
@@ -93,6 +125,12 @@ void RenderingEngine::Initialize(bool opaqueBackground)
                                     GL_RENDERBUFFER_HEIGHT_OES, &height);
     glViewport(0, 0, width, height);
 
+    // One repeat of the sky wraps all the way around, 100 units out.  The
+    // floor repeats every 64 units, and the nearest of it is 10 units away.
+    float focalLength = width * 5 / 4.0f;
+    m_skyScreenSize = MipResidency::EstimateScreenSize(TwoPi * 100, 100, focalLength);
+    m_floorScreenSize = MipResidency::EstimateScreenSize(64, 10, focalLength);
+
     // Create a depth buffer that has the same size as the color buffer.
     glGenRenderbuffersOES(1, &m_renderbuffers.Depth);
     glBindRenderbufferOES(GL_RENDERBUFFER_OES, m_renderbuffers.Depth);
@@ -126,9 +164,18 @@ void RenderingEngine::Initialize(bool opaqueBackground)
     glMatrixMode(GL_MODELVIEW);
 }
 
-void RenderingEngine::RenderText(GLuint texture, float theta, float scale) const
+bool RenderingEngine::BindTexture(LoadHandle texture) const
+{
+    GLuint name = m_loader.GetTexture(texture);
+    if (name)
+        glBindTexture(GL_TEXTURE_2D, name);
+    return name != 0;
+}
+
+void RenderingEngine::RenderText(LoadHandle texture, float theta, float scale) const
 {
-    glBindTexture(GL_TEXTURE_2D, texture);
+    if (!BindTexture(texture))
+        return;
     glPushMatrix();
     glRotatef(theta, 0, 1, 0);
     glTranslatef(0, -1, -30);
@@ -139,6 +186,12 @@ void RenderingEngine::RenderText(GLuint texture, float theta, float scale) const
 
 void RenderingEngine::Render(float theta, float phi, ButtonMask buttons) const
 {
+    PROFILE_ZONE("RenderingEngine::Render");
+    m_loader.Upload(m_uploader, UploadBytesPerFrame);
+    m_streamer.SetScreenSize(m_loader.GetTexture(m_textures.Sky), m_skyScreenSize);
+    m_streamer.SetScreenSize(m_loader.GetTexture(m_textures.Floor), m_floorScreenSize);
+    m_streamer.Update();
+
     static float frameCounter = 0;
     frameCounter++;
     
@@ -147,13 +200,12 @@ void RenderingEngine::Render(float theta, float phi, ButtonMask buttons) const
     glRotatef(phi, 1, 0, 0);
     glRotatef(theta, 0, 1, 0);
 
-    if (m_opaqueBackground) {
+    if (m_opaqueBackground && BindTexture(m_textures.Sky)) {
         glClear(GL_DEPTH_BUFFER_BIT);
 
         glPushMatrix();
         glScalef(100, 100, 100);
         glRotatef(frameCounter * 2, 0, 1, 0);
-        glBindTexture(GL_TEXTURE_2D, m_textures.Sky);
         RenderDrawable(m_drawables.SkySphere);
         glPopMatrix();
     } else {
@@ -162,11 +214,11 @@ void RenderingEngine::Render(float theta, float phi, ButtonMask buttons) const
     }
 
     glEnable(GL_BLEND);
-    glBindTexture(GL_TEXTURE_2D, m_textures.Triangle);
     glPushMatrix();
     glTranslatef(0, 10, 0);
     glScalef(90, 90, 90);
-    RenderDrawable(m_drawables.GeodesicDome);
+    if (BindTexture(m_textures.Triangle))
+        RenderDrawable(m_drawables.GeodesicDome);
     glPopMatrix();
     
     float textScale = 1.0 / 10.0 + sin(frameCounter / 10.0f) / 150.0;
@@ -182,16 +234,15 @@ void RenderingEngine::Render(float theta, float phi, ButtonMask buttons) const
     glScalef(4, 4, 4);
     glMatrixMode(GL_TEXTURE);
     glScalef(4, 4, 1);
-    glBindTexture(GL_TEXTURE_2D, m_textures.Floor);
-    RenderDrawable(m_drawables.Quad);
+    if (BindTexture(m_textures.Floor))
+        RenderDrawable(m_drawables.Quad);
     glLoadIdentity();
     glMatrixMode(GL_MODELVIEW);
     glPopMatrix();
     
-    if (buttons) {
+    if (buttons && BindTexture(m_textures.Button)) {
         glEnable(GL_BLEND);
         glDisable(GL_DEPTH_TEST);
-        glBindTexture(GL_TEXTURE_2D, m_textures.Button);
         glMatrixMode(GL_PROJECTION);
         glPushMatrix();
             glLoadIdentity();
@@ -239,19 +290,7 @@ void RenderingEngine::Render(float theta, float phi, ButtonMask buttons) const
     }
 }
 
-GLuint RenderingEngine::CreateTexture(const string& file)
-{
-    GLuint name;
-    glGenTextures(1, &name);
-    glBindTexture(GL_TEXTURE_2D, name);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE);
-    UploadImage(m_resourceManager->LoadImagePot(file));
-    return name;
-}
-
-Drawable RenderingEngine::CreateDrawable(const ParametricSurface& surface)
+Drawable RenderingEngine::CreateDrawable(const ISurface& surface)
 {
     // Create the VBO for the vertices.
     vector<float> vertices;
@@ -286,26 +325,6 @@ Drawable RenderingEngine::CreateDrawable(const ParametricSurface& surface)
     return drawable;
 }
 
-Drawable RenderingEngine::CreateDrawable(const float* vertices, int vertexCount)
-{
-    // Create the VBO for the vertices.
-    GLuint vertexBuffer;
-    glGenBuffers(1, &vertexBuffer);
-    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
-    glBufferData(GL_ARRAY_BUFFER,
-                 vertexCount * 5 * sizeof(*vertices),
-                 vertices,
-                 GL_STATIC_DRAW);
-    
-    // Fill in a descriptive struct and return it.
-    Drawable drawable;
-    drawable.IndexBuffer = 0;
-    drawable.VertexBuffer = vertexBuffer;
-    drawable.IndexCount = 0;
-    drawable.VertexCount = vertexCount;
-    return drawable;
-}
-
 void RenderingEngine::RenderDrawable(const Drawable& drawable) const
 {
     int stride = sizeof(vec3) + sizeof(vec2);
@@ -313,14 +332,8 @@ void RenderingEngine::RenderDrawable(const Drawable& drawable) const
     glBindBuffer(GL_ARRAY_BUFFER, drawable.VertexBuffer);
     glVertexPointer(3, GL_FLOAT, stride, 0);
     glTexCoordPointer(2, GL_FLOAT, stride, texCoordOffset);
-    
-    if (drawable.IndexBuffer) {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, drawable.IndexBuffer);
-        glDrawElements(GL_TRIANGLES, drawable.IndexCount, GL_UNSIGNED_SHORT, 0);
-    } else {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-        glDrawArrays(GL_TRIANGLES, 0, drawable.VertexCount);
-    }
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, drawable.IndexBuffer);
+    glDrawElements(GL_TRIANGLES, drawable.IndexCount, GL_UNSIGNED_SHORT, 0);
 }
 
 void RenderingEngine::SetButtonAlpha(ButtonMask pressed, ButtonFlags flag) const
@@ -329,15 +342,15 @@ void RenderingEngine::SetButtonAlpha(ButtonMask pressed, ButtonFlags flag) const
     glColor4f(1, 1, 1, alpha);
 }
 
-void RenderingEngine::UploadImage(const TextureDescription& desc)
+unsigned int TextureUploader::Upload(DecodedImage& image)
 {
-    GLenum type;
+    GLenum type = GL_UNSIGNED_BYTE;
     GLenum format;
     int bitsPerPixel;
     bool compressed = false;
     bool mipped = false;
     
-    switch (desc.Format) {
+    switch ((TextureFormat) image.Format) {
         case TextureFormatPvrtcRgba2:
             compressed = true;
             format = GL_COMPRESSED_RGBA_PVRTC_2BPPV1_IMG;
@@ -382,9 +395,35 @@ void RenderingEngine::UploadImage(const TextureDescription& desc)
             break;
     }
     
-    int w = desc.Size.x;
-    int h = desc.Size.y;
-    unsigned char* data = (unsigned char*) m_resourceManager->GetImageData();
+    // A file with the whole chain, down to 1x1, goes to the streamer.
+    int w = image.Width;
+    int h = image.Height;
+    vector<size_t> levelSizes;
+    size_t chainSize = 0;
+    while (mipped && image.MipCount > 1 && (w || h)) {
+        GLsizei size = (w ? w : 1) * (h ? h : 1) * bitsPerPixel / 8;
+        size = compressed && size < 32 ? 32 : size;
+        levelSizes.push_back(size);
+        chainSize += size;
+        w >>= 1; h >>= 1;
+    }
+    if (!levelSizes.empty() && (int) levelSizes.size() <= image.MipCount &&
+        chainSize <= image.Pixels.size()) {
+        PvrGlFormat glFormat = { format, type, compressed };
+        return m_streamer->AddTexture(glFormat, image.Width, image.Height, levelSizes,
+                                      image.Pixels);
+    }
+
+    GLuint name;
+    glGenTextures(1, &name);
+    glBindTexture(GL_TEXTURE_2D, name);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE);
+
+    w = image.Width;
+    h = image.Height;
+    const unsigned char* data = &image.Pixels[0];
     
     int level = 0;
     while (w && h) {
@@ -397,7 +436,7 @@ void RenderingEngine::UploadImage(const TextureDescription& desc)
         else
             glTexImage2D(GL_TEXTURE_2D, level, format, w, h, 0, format, type, data);
         
-        if (level < desc.MipCount - 1)
+        if (level < image.MipCount - 1)
             data += size;
         
         if (!mipped)
@@ -406,5 +445,5 @@ void RenderingEngine::UploadImage(const TextureDescription& desc)
         w >>= 1; h >>= 1; level++;
     }
     
-    m_resourceManager->UnloadImage();
+    return name;
 }
@@ -1,16696 +0,0 @@
-const int DomeFaceCount = 2782;
-const int DomeVertexCount = DomeFaceCount * 3;
-const float DomeVertices[DomeVertexCount * 5] = {
-    -0.819207, 0.040640, 0.572056,
-    0.000000, 1.000000,
-    -0.819207, -0.040640, 0.572056,
-    0.500000, 0.133975,
-    -0.850651, 0.000000, 0.525731,
-    1.000000, 1.000000,
-    0.000000, -0.465658, 0.884965,
-    0.000000, 1.000000,
-    0.065758, -0.506298, 0.859848,
-    0.500000, 0.133975,
-    0.000000, -0.525731, 0.850651,
-    1.000000, 1.000000,
-    0.819207, 0.040640, -0.572056,
-    0.000000, 1.000000,
-    0.819207, -0.040640, -0.572056,
-    0.500000, 0.133975,
-    0.850651, 0.000000, -0.525731,
-    1.000000, 1.000000,
-    0.000000, -0.465658, -0.884965,
-    0.000000, 1.000000,
-    -0.065758, -0.506298, -0.859848,
-    0.500000, 0.133975,
-    0.000000, -0.525731, -0.850651,
-    1.000000, 1.000000,
-    -0.506298, -0.859848, 0.065758,
-    0.000000, 1.000000,
-    -0.465658, -0.884965, 0.000000,
-    0.500000, 0.133975,
-    -0.525731, -0.850651, 0.000000,
-    1.000000, 1.000000,
-    0.506298, -0.859848, -0.065758,
-    0.000000, 1.000000,
-    0.465658, -0.884965, 0.000000,
-    0.500000, 0.133975,
-    0.525731, -0.850651, 0.000000,
-    1.000000, 1.000000,
-    -0.859848, 0.065758, -0.506298,
-    0.000000, 1.000000,
-    -0.884965, 0.000000, -0.465658,
-    0.500000, 0.133975,
-    -0.850651, 0.000000, -0.525731,
-    1.000000, 1.000000,
-    -0.859848, -0.065758, 0.506298,
-    0.000000, 1.000000,
-    -0.884965, 0.000000, 0.465658,
-    0.500000, 0.133975,
-    -0.850651, 0.000000, 0.525731,
-    1.000000, 1.000000,
-    0.859848, 0.065758, 0.506298,
-    0.000000, 1.000000,
-    0.884965, 0.000000, 0.465658,
-    0.500000, 0.133975,
-    0.850651, 0.000000, 0.525731,
-    1.000000, 1.000000,
-    0.859848, -0.065758, -0.506298,
-    0.000000, 1.000000,
-    0.884965, 0.000000, -0.465658,
-    0.500000, 0.133975,
-    0.850651, 0.000000, -0.525731,
-    1.000000, 1.000000,
-    0.819207, 0.040640, 0.572056,
-    0.000000, 1.000000,
-    0.859848, 0.065758, 0.506298,
-    0.500000, 0.133975,
-    0.850651, 0.000000, 0.525731,
-    1.000000, 1.000000,
-    -0.819207, 0.040640, -0.572056,
-    0.000000, 1.000000,
-    -0.859848, 0.065758, -0.506298,
-    0.500000, 0.133975,
-    -0.850651, 0.000000, -0.525731,
-    1.000000, 1.000000,
-    -0.506298, -0.859848, -0.065758,
-    0.000000, 1.000000,
-    -0.572056, -0.819207, -0.040640,
-    0.500000, 0.133975,
-    -0.525731, -0.850651, 0.000000,
-    1.000000, 1.000000,
-    0.819207, -0.040640, -0.572056,
-    0.000000, 1.000000,
-    0.859848, -0.065758, -0.506298,
-    0.500000, 0.133975,
-    0.850651, 0.000000, -0.525731,
-    1.000000, 1.000000,
-    -0.819207, -0.040640, 0.572056,
-    0.000000, 1.000000,
-    -0.859848, -0.065758, 0.506298,
-    0.500000, 0.133975,
-    -0.850651, 0.000000, 0.525731,
-    1.000000, 1.000000,
-    0.506298, -0.859848, 0.065758,
-    0.000000, 1.000000,
-    0.572056, -0.819207, 0.040640,
-    0.500000, 0.133975,
-    0.525731, -0.850651, 0.000000,
-    1.000000, 1.000000,
-    -0.444464, -0.274694, 0.852640,
-    0.000000, 1.000000,
-    -0.442867, -0.342848, 0.828447,
-    0.500000, 0.133975,
-    -0.500000, -0.309017, 0.809017,
-    1.000000, 1.000000,
-    0.066741, 0.041248, 0.996917,
-    0.000000, 1.000000,
-    0.066741, -0.041248, 0.996917,
-    0.500000, 0.133975,
-    0.000000, 0.000000, 1.000000,
-    1.000000, 1.000000,
-    0.000000, 0.069142, 0.997607,
-    0.000000, 1.000000,
-    0.066741, 0.041248, 0.996917,
-    0.500000, 0.133975,
-    0.000000, 0.000000, 1.000000,
-    1.000000, 1.000000,
-    0.511205, -0.233445, 0.827147,
-    0.000000, 1.000000,
-    0.554740, -0.273707, 0.785715,
-    0.500000, 0.133975,
-    0.500000, -0.309017, 0.809017,
-    1.000000, 1.000000,
-    0.444464, -0.274694, -0.852640,
-    0.000000, 1.000000,
-    0.442867, -0.342848, -0.828447,
-    0.500000, 0.133975,
-    0.500000, -0.309017, -0.809017,
-    1.000000, 1.000000,
-    -0.066741, 0.041248, -0.996917,
-    0.000000, 1.000000,
-    -0.066741, -0.041248, -0.996917,
-    0.500000, 0.133975,
-    0.000000, 0.000000, -1.000000,
-    1.000000, 1.000000,
-    0.000000, 0.069142, -0.997607,
-    0.000000, 1.000000,
-    -0.066741, 0.041248, -0.996917,
-    0.500000, 0.133975,
-    0.000000, 0.000000, -1.000000,
-    1.000000, 1.000000,
-    -0.511205, -0.233445, -0.827147,
-    0.000000, 1.000000,
-    -0.554740, -0.273707, -0.785715,
-    0.500000, 0.133975,
-    -0.500000, -0.309017, -0.809017,
-    1.000000, 1.000000,
-    -0.233445, -0.827147, 0.511205,
-    0.000000, 1.000000,
-    -0.274694, -0.852640, 0.444464,
-    0.500000, 0.133975,
-    -0.309017, -0.809017, 0.500000,
-    1.000000, 1.000000,
-    -0.273707, -0.785715, 0.554740,
-    0.000000, 1.000000,
-    -0.233445, -0.827147, 0.511205,
-    0.500000, 0.133975,
-    -0.309017, -0.809017, 0.500000,
-    1.000000, 1.000000,
-    0.041248, -0.996917, 0.066741,
-    0.000000, 1.000000,
-    0.069142, -0.997607, 0.000000,
-    0.500000, 0.133975,
-    0.000000, -1.000000, 0.000000,
-    1.000000, 1.000000,
-    0.233445, -0.827147, -0.511205,
-    0.000000, 1.000000,
-    0.274694, -0.852640, -0.444464,
-    0.500000, 0.133975,
-    0.309017, -0.809017, -0.500000,
-    1.000000, 1.000000,
-    0.273707, -0.785715, -0.554740,
-    0.000000, 1.000000,
-    0.233445, -0.827147, -0.511205,
-    0.500000, 0.133975,
-    0.309017, -0.809017, -0.500000,
-    1.000000, 1.000000,
-    -0.041248, -0.996917, -0.066741,
-    0.000000, 1.000000,
-    -0.069142, -0.997607, 0.000000,
-    0.500000, 0.133975,
-    0.000000, -1.000000, 0.000000,
-    1.000000, 1.000000,
-    -0.996917, 0.066741, 0.041248,
-    0.000000, 1.000000,
-    -0.997607, 0.000000, 0.069142,
-    0.500000, 0.133975,
-    -1.000000, 0.000000, 0.000000,
-    1.000000, 1.000000,
-    -0.827147, -0.511205, 0.233445,
-    0.000000, 1.000000,
-    -0.852640, -0.444464, 0.274694,
-    0.500000, 0.133975,
-    -0.809017, -0.500000, 0.309017,
-    1.000000, 1.000000,
-    -0.785715, -0.554740, 0.273707,
-    0.000000, 1.000000,
-    -0.827147, -0.511205, 0.233445,
-    0.500000, 0.133975,
-    -0.809017, -0.500000, 0.309017,
-    1.000000, 1.000000,
-    -0.996917, -0.066741, -0.041248,
-    0.000000, 1.000000,
-    -0.997607, 0.000000, -0.069142,
-    0.500000, 0.133975,
-    -1.000000, 0.000000, 0.000000,
-    1.000000, 1.000000,
-    0.996917, 0.066741, -0.041248,
-    0.000000, 1.000000,
-    0.997607, 0.000000, -0.069142,
-    0.500000, 0.133975,
-    1.000000, 0.000000, 0.000000,
-    1.000000, 1.000000,
-    0.827147, -0.511205, -0.233445,
-    0.000000, 1.000000,
-    0.852640, -0.444464, -0.274694,
-    0.500000, 0.133975,
-    0.809017, -0.500000, -0.309017,
-    1.000000, 1.000000,
-    0.785715, -0.554740, -0.273707,
-    0.000000, 1.000000,
-    0.827147, -0.511205, -0.233445,
-    0.500000, 0.133975,
-    0.809017, -0.500000, -0.309017,
-    1.000000, 1.000000,
-    0.996917, -0.066741, 0.041248,
-    0.000000, 1.000000,
-    0.997607, 0.000000, 0.069142,
-    0.500000, 0.133975,
-    1.000000, 0.000000, 0.000000,
-    1.000000, 1.000000,
-    -0.341435, -0.760406, -0.552454,
-    0.000000, 1.000000,
-    -0.382683, -0.785899, -0.485712,
-    0.500000, 0.133975,
-    -0.309017, -0.809017, -0.500000,
-    1.000000, 1.000000,
-    -0.273707, -0.785715, -0.554740,
-    0.000000, 1.000000,
-    -0.341435, -0.760406, -0.552454,
-    0.500000, 0.133975,
-    -0.309017, -0.809017, -0.500000,
-    1.000000, 1.000000,
-    -0.785899, -0.485712, -0.382683,
-    0.000000, 1.000000,
-    -0.828447, -0.442867, -0.342848,
-    0.500000, 0.133975,
-    -0.809017, -0.500000, -0.309017,
-    1.000000, 1.000000,
-    0.485712, -0.382683, -0.785899,
-    0.000000, 1.000000,
-    0.552454, -0.341435, -0.760406,
-    0.500000, 0.133975,
-    0.500000, -0.309017, -0.809017,
-    1.000000, 1.000000,
-    0.442867, -0.342848, -0.828447,
-    0.000000, 1.000000,
-    0.485712, -0.382683, -0.785899,
-    0.500000, 0.133975,
-    0.500000, -0.309017, -0.809017,
-    1.000000, 1.000000,
-    0.760406, -0.552454, -0.341435,
-    0.000000, 1.000000,
-    0.785715, -0.554740, -0.273707,
-    0.500000, 0.133975,
-    0.809017, -0.500000, -0.309017,
-    1.000000, 1.000000,
-    -0.485712, -0.382683, 0.785899,
-    0.000000, 1.000000,
-    -0.552454, -0.341435, 0.760406,
-    0.500000, 0.133975,
-    -0.500000, -0.309017, 0.809017,
-    1.000000, 1.000000,
-    -0.442867, -0.342848, 0.828447,
-    0.000000, 1.000000,
-    -0.485712, -0.382683, 0.785899,
-    0.500000, 0.133975,
-    -0.500000, -0.309017, 0.809017,
-    1.000000, 1.000000,
-    -0.760406, -0.552454, 0.341435,
-    0.000000, 1.000000,
-    -0.785715, -0.554740, 0.273707,
-    0.500000, 0.133975,
-    -0.809017, -0.500000, 0.309017,
-    1.000000, 1.000000,
-    0.341435, -0.760406, 0.552454,
-    0.000000, 1.000000,
-    0.382683, -0.785899, 0.485712,
-    0.500000, 0.133975,
-    0.309017, -0.809017, 0.500000,
-    1.000000, 1.000000,
-    0.273707, -0.785715, 0.554740,
-    0.000000, 1.000000,
-    0.341435, -0.760406, 0.552454,
-    0.500000, 0.133975,
-    0.309017, -0.809017, 0.500000,
-    1.000000, 1.000000,
-    0.785899, -0.485712, 0.382683,
-    0.000000, 1.000000,
-    0.828447, -0.442867, 0.342848,
-    0.500000, 0.133975,
-    0.809017, -0.500000, 0.309017,
-    1.000000, 1.000000,
-    -0.662842, -0.121193, 0.738886,
-    0.000000, 1.000000,
-    -0.656006, -0.199331, 0.727958,
-    0.500000, 0.133975,
-    -0.702046, -0.160622, 0.693780,
-    1.000000, 1.000000,
-    0.066567, -0.247326, 0.966643,
-    0.000000, 1.000000,
-    0.066042, -0.316778, 0.946198,
-    0.500000, 0.133975,
-    0.000000, -0.273267, 0.961938,
-    1.000000, 1.000000,
-    0.000000, -0.206103, 0.978530,
-    0.000000, 1.000000,
-    0.066567, -0.247326, 0.966643,
-    0.500000, 0.133975,
-    0.000000, -0.273267, 0.961938,
-    1.000000, 1.000000,
-    0.262661, -0.368518, 0.891742,
-    0.000000, 1.000000,
-    0.322525, -0.405434, 0.855337,
-    0.500000, 0.133975,
-    0.259892, -0.433889, 0.862668,
-    1.000000, 1.000000,
-    0.662842, -0.121193, -0.738886,
-    0.000000, 1.000000,
-    0.656006, -0.199331, -0.727958,
-    0.500000, 0.133975,
-    0.702046, -0.160622, -0.693780,
-    1.000000, 1.000000,
-    -0.066567, -0.247326, -0.966643,
-    0.000000, 1.000000,
-    -0.066042, -0.316778, -0.946198,
-    0.500000, 0.133975,
-    0.000000, -0.273267, -0.961938,
-    1.000000, 1.000000,
-    0.000000, -0.206103, -0.978530,
-    0.000000, 1.000000,
-    -0.066567, -0.247326, -0.966643,
-    0.500000, 0.133975,
-    0.000000, -0.273267, -0.961938,
-    1.000000, 1.000000,
-    -0.262661, -0.368518, -0.891742,
-    0.000000, 1.000000,
-    -0.322525, -0.405434, -0.855337,
-    0.500000, 0.133975,
-    -0.259892, -0.433889, -0.862668,
-    1.000000, 1.000000,
-    -0.368518, -0.891742, 0.262661,
-    0.000000, 1.000000,
-    -0.397351, -0.896401, 0.196412,
-    0.500000, 0.133975,
-    -0.433889, -0.862668, 0.259892,
-    1.000000, 1.000000,
-    -0.405434, -0.855337, 0.322525,
-    0.000000, 1.000000,
-    -0.368518, -0.891742, 0.262661,
-    0.500000, 0.133975,
-    -0.433889, -0.862668, 0.259892,
-    1.000000, 1.000000,
-    -0.247326, -0.966643, 0.066567,
-    0.000000, 1.000000,
-    -0.206103, -0.978530, 0.000000,
-    0.500000, 0.133975,
-    -0.273267, -0.961938, 0.000000,
-    1.000000, 1.000000,
-    0.368518, -0.891742, -0.262661,
-    0.000000, 1.000000,
-    0.397351, -0.896401, -0.196412,
-    0.500000, 0.133975,
-    0.433889, -0.862668, -0.259892,
-    1.000000, 1.000000,
-    0.405434, -0.855337, -0.322525,
-    0.000000, 1.000000,
-    0.368518, -0.891742, -0.262661,
-    0.500000, 0.133975,
-    0.433889, -0.862668, -0.259892,
-    1.000000, 1.000000,
-    0.247326, -0.966643, -0.066567,
-    0.000000, 1.000000,
-    0.206103, -0.978530, 0.000000,
-    0.500000, 0.133975,
-    0.273267, -0.961938, 0.000000,
-    1.000000, 1.000000,
-    -0.966643, 0.066567, -0.247326,
-    0.000000, 1.000000,
-    -0.978530, 0.000000, -0.206103,
-    0.500000, 0.133975,
-    -0.961938, 0.000000, -0.273267,
-    1.000000, 1.000000,
-    -0.891742, -0.262661, 0.368518,
-    0.000000, 1.000000,
-    -0.896401, -0.196412, 0.397351,
-    0.500000, 0.133975,
-    -0.862668, -0.259892, 0.433889,
-    1.000000, 1.000000,
-    -0.855337, -0.322525, 0.405434,
-    0.000000, 1.000000,
-    -0.891742, -0.262661, 0.368518,
-    0.500000, 0.133975,
-    -0.862668, -0.259892, 0.433889,
-    1.000000, 1.000000,
-    -0.966643, -0.066567, 0.247326,
-    0.000000, 1.000000,
-    -0.978530, 0.000000, 0.206103,
-    0.500000, 0.133975,
-    -0.961938, 0.000000, 0.273267,
-    1.000000, 1.000000,
-    0.966643, 0.066567, 0.247326,
-    0.000000, 1.000000,
-    0.978530, 0.000000, 0.206103,
-    0.500000, 0.133975,
-    0.961938, 0.000000, 0.273267,
-    1.000000, 1.000000,
-    0.891742, -0.262661, -0.368518,
-    0.000000, 1.000000,
-    0.896401, -0.196412, -0.397351,
-    0.500000, 0.133975,
-    0.862668, -0.259892, -0.433889,
-    1.000000, 1.000000,
-    0.855337, -0.322525, -0.405434,
-    0.000000, 1.000000,
-    0.891742, -0.262661, -0.368518,
-    0.500000, 0.133975,
-    0.862668, -0.259892, -0.433889,
-    1.000000, 1.000000,
-    0.966643, -0.066567, -0.247326,
-    0.000000, 1.000000,
-    0.978530, 0.000000, -0.206103,
-    0.500000, 0.133975,
-    0.961938, 0.000000, -0.273267,
-    1.000000, 1.000000,
-    -0.476226, -0.825175, -0.303801,
-    0.000000, 1.000000,
-    -0.504209, -0.830359, -0.237229,
-    0.500000, 0.133975,
-    -0.433889, -0.862668, -0.259892,
-    1.000000, 1.000000,
-    -0.405434, -0.855337, -0.322525,
-    0.000000, 1.000000,
-    -0.476226, -0.825175, -0.303801,
-    0.500000, 0.133975,
-    -0.433889, -0.862668, -0.259892,
-    1.000000, 1.000000,
-    -0.672319, -0.703983, -0.228900,
-    0.000000, 1.000000,
-    -0.727958, -0.656006, -0.199331,
-    0.500000, 0.133975,
-    -0.693780, -0.702046, -0.160622,
-    1.000000, 1.000000,
-    0.703983, -0.228900, -0.672319,
-    0.000000, 1.000000,
-    0.749786, -0.187432, -0.634579,
-    0.500000, 0.133975,
-    0.702046, -0.160622, -0.693780,
-    1.000000, 1.000000,
-    0.656006, -0.199331, -0.727958,
-    0.000000, 1.000000,
-    0.703983, -0.228900, -0.672319,
-    0.500000, 0.133975,
-    0.702046, -0.160622, -0.693780,
-    1.000000, 1.000000,
-    0.825175, -0.303801, -0.476226,
-    0.000000, 1.000000,
-    0.855337, -0.322525, -0.405434,
-    0.500000, 0.133975,
-    0.862668, -0.259892, -0.433889,
-    1.000000, 1.000000,
-    -0.703983, -0.228900, 0.672319,
-    0.000000, 1.000000,
-    -0.749786, -0.187432, 0.634579,
-    0.500000, 0.133975,
-    -0.702046, -0.160622, 0.693780,
-    1.000000, 1.000000,
-    -0.656006, -0.199331, 0.727958,
-    0.000000, 1.000000,
-    -0.703983, -0.228900, 0.672319,
-    0.500000, 0.133975,
-    -0.702046, -0.160622, 0.693780,
-    1.000000, 1.000000,
-    -0.825175, -0.303801, 0.476226,
-    0.000000, 1.000000,
-    -0.855337, -0.322525, 0.405434,
-    0.500000, 0.133975,
-    -0.862668, -0.259892, 0.433889,
-    1.000000, 1.000000,
-    0.476226, -0.825175, 0.303801,
-    0.000000, 1.000000,
-    0.504209, -0.830359, 0.237229,
-    0.500000, 0.133975,
-    0.433889, -0.862668, 0.259892,
-    1.000000, 1.000000,
-    0.405434, -0.855337, 0.322525,
-    0.000000, 1.000000,
-    0.476226, -0.825175, 0.303801,
-    0.500000, 0.133975,
-    0.433889, -0.862668, 0.259892,
-    1.000000, 1.000000,
-    0.672319, -0.703983, 0.228900,
-    0.000000, 1.000000,
-    0.727958, -0.656006, 0.199331,
-    0.500000, 0.133975,
-    0.693780, -0.702046, 0.160622,
-    1.000000, 1.000000,
-    -0.464213, -0.041299, 0.884760,
-    0.000000, 1.000000,
-    -0.524110, -0.078459, 0.848029,
-    0.500000, 0.133975,
-    -0.525731, 0.000000, 0.850651,
-    1.000000, 1.000000,
-    -0.198337, -0.191780, 0.961188,
-    0.000000, 1.000000,
-    -0.264151, -0.232455, 0.936050,
-    0.500000, 0.133975,
-    -0.262866, -0.162460, 0.951057,
-    1.000000, 1.000000,
-    -0.198580, -0.122729, 0.972370,
-    0.000000, 1.000000,
-    -0.198337, -0.191780, 0.961188,
-    0.500000, 0.133975,
-    -0.262866, -0.162460, 0.951057,
-    1.000000, 1.000000,
-    -0.196412, -0.397351, 0.896401,
-    0.000000, 1.000000,
-    -0.196015, -0.460267, 0.865871,
-    0.500000, 0.133975,
-    -0.259892, -0.433889, 0.862668,
-    1.000000, 1.000000,
-    0.332342, -0.122800, 0.935130,
-    0.000000, 1.000000,
-    0.325530, -0.201189, 0.923880,
-    0.500000, 0.133975,
-    0.262866, -0.162460, 0.951057,
-    1.000000, 1.000000,
-    0.574458, 0.040675, 0.817523,
-    0.000000, 1.000000,
-    0.574458, -0.040675, 0.817523,
-    0.500000, 0.133975,
-    0.525731, 0.000000, 0.850651,
-    1.000000, 1.000000,
-    0.524110, 0.078459, 0.848029,
-    0.000000, 1.000000,
-    0.574458, 0.040675, 0.817523,
-    0.500000, 0.133975,
-    0.525731, 0.000000, 0.850651,
-    1.000000, 1.000000,
-    0.708969, -0.080573, 0.700622,
-    0.000000, 1.000000,
-    0.744727, -0.121144, 0.656282,
-    0.500000, 0.133975,
-    0.702046, -0.160622, 0.693780,
-    1.000000, 1.000000,
-    0.464213, -0.041299, -0.884760,
-    0.000000, 1.000000,
-    0.524110, -0.078459, -0.848029,
-    0.500000, 0.133975,
-    0.525731, 0.000000, -0.850651,
-    1.000000, 1.000000,
-    0.198337, -0.191780, -0.961188,
-    0.000000, 1.000000,
-    0.264151, -0.232455, -0.936050,
-    0.500000, 0.133975,
-    0.262866, -0.162460, -0.951057,
-    1.000000, 1.000000,
-    0.198580, -0.122729, -0.972370,
-    0.000000, 1.000000,
-    0.198337, -0.191780, -0.961188,
-    0.500000, 0.133975,
-    0.262866, -0.162460, -0.951057,
-    1.000000, 1.000000,
-    0.196412, -0.397351, -0.896401,
-    0.000000, 1.000000,
-    0.196015, -0.460267, -0.865871,
-    0.500000, 0.133975,
-    0.259892, -0.433889, -0.862668,
-    1.000000, 1.000000,
-    -0.332342, -0.122800, -0.935130,
-    0.000000, 1.000000,
-    -0.325530, -0.201189, -0.923880,
-    0.500000, 0.133975,
-    -0.262866, -0.162460, -0.951057,
-    1.000000, 1.000000,
-    -0.574458, 0.040675, -0.817523,
-    0.000000, 1.000000,
-    -0.574458, -0.040675, -0.817523,
-    0.500000, 0.133975,
-    -0.525731, 0.000000, -0.850651,
-    1.000000, 1.000000,
-    -0.524110, 0.078459, -0.848029,
-    0.000000, 1.000000,
-    -0.574458, 0.040675, -0.817523,
-    0.500000, 0.133975,
-    -0.525731, 0.000000, -0.850651,
-    1.000000, 1.000000,
-    -0.708969, -0.080573, -0.700622,
-    0.000000, 1.000000,
-    -0.744727, -0.121144, -0.656282,
-    0.500000, 0.133975,
-    -0.702046, -0.160622, -0.693780,
-    1.000000, 1.000000,
-    0.041299, -0.884760, 0.464213,
-    0.000000, 1.000000,
-    -0.041299, -0.884760, 0.464213,
-    0.500000, 0.133975,
-    0.000000, -0.850651, 0.525731,
-    1.000000, 1.000000,
-    0.078459, -0.848029, 0.524110,
-    0.000000, 1.000000,
-    0.041299, -0.884760, 0.464213,
-    0.500000, 0.133975,
-    0.000000, -0.850651, 0.525731,
-    1.000000, 1.000000,
-    -0.081501, -0.960655, 0.265518,
-    0.000000, 1.000000,
-    -0.122729, -0.972370, 0.198580,
-    0.500000, 0.133975,
-    -0.162460, -0.951057, 0.262866,
-    1.000000, 1.000000,
-    -0.080573, -0.700622, 0.708969,
-    0.000000, 1.000000,
-    -0.121193, -0.738886, 0.662842,
-    0.500000, 0.133975,
-    -0.160622, -0.693780, 0.702046,
-    1.000000, 1.000000,
-    -0.121144, -0.656282, 0.744727,
-    0.000000, 1.000000,
-    -0.080573, -0.700622, 0.708969,
-    0.500000, 0.133975,
-    -0.160622, -0.693780, 0.702046,
-    1.000000, 1.000000,
-    0.040675, -0.817523, 0.574458,
-    0.000000, 1.000000,
-    0.078459, -0.848029, 0.524110,
-    0.500000, 0.133975,
-    0.000000, -0.850651, 0.525731,
-    1.000000, 1.000000,
-    0.232455, -0.936050, 0.264151,
-    0.000000, 1.000000,
-    0.191780, -0.961188, 0.198337,
-    0.500000, 0.133975,
-    0.162460, -0.951057, 0.262866,
-    1.000000, 1.000000,
-    0.201189, -0.923880, 0.325530,
-    0.000000, 1.000000,
-    0.232455, -0.936050, 0.264151,
-    0.500000, 0.133975,
-    0.162460, -0.951057, 0.262866,
-    1.000000, 1.000000,
-    0.316778, -0.946198, 0.066042,
-    0.000000, 1.000000,
-    0.339123, -0.940742, 0.000000,
-    0.500000, 0.133975,
-    0.273267, -0.961938, 0.000000,
-    1.000000, 1.000000,
-    -0.041299, -0.884760, -0.464213,
-    0.000000, 1.000000,
-    0.041299, -0.884760, -0.464213,
-    0.500000, 0.133975,
-    0.000000, -0.850651, -0.525731,
-    1.000000, 1.000000,
-    -0.078459, -0.848029, -0.524110,
-    0.000000, 1.000000,
-    -0.041299, -0.884760, -0.464213,
-    0.500000, 0.133975,
-    0.000000, -0.850651, -0.525731,
-    1.000000, 1.000000,
-    0.081501, -0.960655, -0.265518,
-    0.000000, 1.000000,
-    0.122729, -0.972370, -0.198580,
-    0.500000, 0.133975,
-    0.162460, -0.951057, -0.262866,
-    1.000000, 1.000000,
-    0.080573, -0.700622, -0.708969,
-    0.000000, 1.000000,
-    0.121193, -0.738886, -0.662842,
-    0.500000, 0.133975,
-    0.160622, -0.693780, -0.702046,
-    1.000000, 1.000000,
-    0.121144, -0.656282, -0.744727,
-    0.000000, 1.000000,
-    0.080573, -0.700622, -0.708969,
-    0.500000, 0.133975,
-    0.160622, -0.693780, -0.702046,
-    1.000000, 1.000000,
-    -0.040675, -0.817523, -0.574458,
-    0.000000, 1.000000,
-    -0.078459, -0.848029, -0.524110,
-    0.500000, 0.133975,
-    0.000000, -0.850651, -0.525731,
-    1.000000, 1.000000,
-    -0.232455, -0.936050, -0.264151,
-    0.000000, 1.000000,
-    -0.191780, -0.961188, -0.198337,
-    0.500000, 0.133975,
-    -0.162460, -0.951057, -0.262866,
-    1.000000, 1.000000,
-    -0.201189, -0.923880, -0.325530,
-    0.000000, 1.000000,
-    -0.232455, -0.936050, -0.264151,
-    0.500000, 0.133975,
-    -0.162460, -0.951057, -0.262866,
-    1.000000, 1.000000,
-    -0.316778, -0.946198, -0.066042,
-    0.000000, 1.000000,
-    -0.339123, -0.940742, 0.000000,
-    0.500000, 0.133975,
-    -0.273267, -0.961938, 0.000000,
-    1.000000, 1.000000,
-    -0.946198, 0.066042, 0.316778,
-    0.000000, 1.000000,
-    -0.940742, 0.000000, 0.339123,
-    0.500000, 0.133975,
-    -0.961938, 0.000000, 0.273267,
-    1.000000, 1.000000,
-    -0.884760, -0.464213, -0.041299,
-    0.000000, 1.000000,
-    -0.884760, -0.464213, 0.041299,
-    0.500000, 0.133975,
-    -0.850651, -0.525731, 0.000000,
-    1.000000, 1.000000,
-    -0.848029, -0.524110, -0.078459,
-    0.000000, 1.000000,
-    -0.884760, -0.464213, -0.041299,
-    0.500000, 0.133975,
-    -0.850651, -0.525731, 0.000000,
-    1.000000, 1.000000,
-    -0.960655, -0.265518, 0.081501,
-    0.000000, 1.000000,
-    -0.972370, -0.198580, 0.122729,
-    0.500000, 0.133975,
-    -0.951057, -0.262866, 0.162460,
-    1.000000, 1.000000,
-    -0.700622, -0.708969, 0.080573,
-    0.000000, 1.000000,
-    -0.738886, -0.662842, 0.121193,
-    0.500000, 0.133975,
-    -0.693780, -0.702046, 0.160622,
-    1.000000, 1.000000,
-    -0.656282, -0.744727, 0.121144,
-    0.000000, 1.000000,
-    -0.700622, -0.708969, 0.080573,
-    0.500000, 0.133975,
-    -0.693780, -0.702046, 0.160622,
-    1.000000, 1.000000,
-    -0.817523, -0.574458, -0.040675,
-    0.000000, 1.000000,
-    -0.848029, -0.524110, -0.078459,
-    0.500000, 0.133975,
-    -0.850651, -0.525731, 0.000000,
-    1.000000, 1.000000,
-    -0.936050, -0.264151, -0.232455,
-    0.000000, 1.000000,
-    -0.961188, -0.198337, -0.191780,
-    0.500000, 0.133975,
-    -0.951057, -0.262866, -0.162460,
-    1.000000, 1.000000,
-    -0.923880, -0.325530, -0.201189,
-    0.000000, 1.000000,
-    -0.936050, -0.264151, -0.232455,
-    0.500000, 0.133975,
-    -0.951057, -0.262866, -0.162460,
-    1.000000, 1.000000,
-    -0.946198, -0.066042, -0.316778,
-    0.000000, 1.000000,
-    -0.940742, 0.000000, -0.339123,
-    0.500000, 0.133975,
-    -0.961938, 0.000000, -0.273267,
-    1.000000, 1.000000,
-    0.946198, 0.066042, -0.316778,
-    0.000000, 1.000000,
-    0.940742, 0.000000, -0.339123,
-    0.500000, 0.133975,
-    0.961938, 0.000000, -0.273267,
-    1.000000, 1.000000,
-    0.884760, -0.464213, 0.041299,
-    0.000000, 1.000000,
-    0.884760, -0.464213, -0.041299,
-    0.500000, 0.133975,
-    0.850651, -0.525731, 0.000000,
-    1.000000, 1.000000,
-    0.848029, -0.524110, 0.078459,
-    0.000000, 1.000000,
-    0.884760, -0.464213, 0.041299,
-    0.500000, 0.133975,
-    0.850651, -0.525731, 0.000000,
-    1.000000, 1.000000,
-    0.960655, -0.265518, -0.081501,
-    0.000000, 1.000000,
-    0.972370, -0.198580, -0.122729,
-    0.500000, 0.133975,
-    0.951057, -0.262866, -0.162460,
-    1.000000, 1.000000,
-    0.700622, -0.708969, -0.080573,
-    0.000000, 1.000000,
-    0.738886, -0.662842, -0.121193,
-    0.500000, 0.133975,
-    0.693780, -0.702046, -0.160622,
-    1.000000, 1.000000,
-    0.656282, -0.744727, -0.121144,
-    0.000000, 1.000000,
-    0.700622, -0.708969, -0.080573,
-    0.500000, 0.133975,
-    0.693780, -0.702046, -0.160622,
-    1.000000, 1.000000,
-    0.817523, -0.574458, 0.040675,
-    0.000000, 1.000000,
-    0.848029, -0.524110, 0.078459,
-    0.500000, 0.133975,
-    0.850651, -0.525731, 0.000000,
-    1.000000, 1.000000,
-    0.936050, -0.264151, 0.232455,
-    0.000000, 1.000000,
-    0.961188, -0.198337, 0.191780,
-    0.500000, 0.133975,
-    0.951057, -0.262866, 0.162460,
-    1.000000, 1.000000,
-    0.923880, -0.325530, 0.201189,
-    0.000000, 1.000000,
-    0.936050, -0.264151, 0.232455,
-    0.500000, 0.133975,
-    0.951057, -0.262866, 0.162460,
-    1.000000, 1.000000,
-    0.946198, -0.066042, 0.316778,
-    0.000000, 1.000000,
-    0.940742, 0.000000, 0.339123,
-    0.500000, 0.133975,
-    0.961938, 0.000000, 0.273267,
-    1.000000, 1.000000,
-    -0.496441, -0.552418, -0.669612,
-    0.000000, 1.000000,
-    -0.470917, -0.619242, -0.628313,
-    0.500000, 0.133975,
-    -0.425325, -0.587785, -0.688191,
-    1.000000, 1.000000,
-    -0.448259, -0.522499, -0.725299,
-    0.000000, 1.000000,
-    -0.496441, -0.552418, -0.669612,
-    0.500000, 0.133975,
-    -0.425325, -0.587785, -0.688191,
-    1.000000, 1.000000,
-    -0.619242, -0.628313, -0.470917,
-    0.000000, 1.000000,
-    -0.649448, -0.646840, -0.399769,
-    0.500000, 0.133975,
-    -0.587785, -0.688191, -0.425325,
-    1.000000, 1.000000,
-    -0.187432, -0.634579, -0.749786,
-    0.000000, 1.000000,
-    -0.228900, -0.672319, -0.703983,
-    0.500000, 0.133975,
-    -0.160622, -0.693780, -0.702046,
-    1.000000, 1.000000,
-    -0.121144, -0.656282, -0.744727,
-    0.000000, 1.000000,
-    -0.187432, -0.634579, -0.749786,
-    0.500000, 0.133975,
-    -0.160622, -0.693780, -0.702046,
-    1.000000, 1.000000,
-    -0.386730, -0.553372, -0.737712,
-    0.000000, 1.000000,
-    -0.448259, -0.522499, -0.725299,
-    0.500000, 0.133975,
-    -0.425325, -0.587785, -0.688191,
-    1.000000, 1.000000,
-    -0.697037, -0.361592, -0.619186,
-    0.000000, 1.000000,
-    -0.737712, -0.386730, -0.553372,
-    0.500000, 0.133975,
-    -0.688191, -0.425325, -0.587785,
-    1.000000, 1.000000,
-    -0.646840, -0.399769, -0.649448,
-    0.000000, 1.000000,
-    -0.697037, -0.361592, -0.619186,
-    0.500000, 0.133975,
-    -0.688191, -0.425325, -0.587785,
-    1.000000, 1.000000,
-    -0.830359, -0.237229, -0.504209,
-    0.000000, 1.000000,
-    -0.865871, -0.196015, -0.460267,
-    0.500000, 0.133975,
-    -0.862668, -0.259892, -0.433889,
-    1.000000, 1.000000,
-    0.470917, -0.619242, -0.628313,
-    0.000000, 1.000000,
-    0.496441, -0.552418, -0.669612,
-    0.500000, 0.133975,
-    0.425325, -0.587785, -0.688191,
-    1.000000, 1.000000,
-    0.399769, -0.649448, -0.646840,
-    0.000000, 1.000000,
-    0.470917, -0.619242, -0.628313,
-    0.500000, 0.133975,
-    0.425325, -0.587785, -0.688191,
-    1.000000, 1.000000,
-    0.669612, -0.496441, -0.552418,
-    0.000000, 1.000000,
-    0.725299, -0.448259, -0.522499,
-    0.500000, 0.133975,
-    0.688191, -0.425325, -0.587785,
-    1.000000, 1.000000,
-    0.237229, -0.504209, -0.830359,
-    0.000000, 1.000000,
-    0.303801, -0.476226, -0.825175,
-    0.500000, 0.133975,
-    0.259892, -0.433889, -0.862668,
-    1.000000, 1.000000,
-    0.196015, -0.460267, -0.865871,
-    0.000000, 1.000000,
-    0.237229, -0.504209, -0.830359,
-    0.500000, 0.133975,
-    0.259892, -0.433889, -0.862668,
-    1.000000, 1.000000,
-    0.361592, -0.619186, -0.697037,
-    0.000000, 1.000000,
-    0.399769, -0.649448, -0.646840,
-    0.500000, 0.133975,
-    0.425325, -0.587785, -0.688191,
-    1.000000, 1.000000,
-    0.553372, -0.737712, -0.386730,
-    0.000000, 1.000000,
-    0.619186, -0.697037, -0.361592,
-    0.500000, 0.133975,
-    0.587785, -0.688191, -0.425325,
-    1.000000, 1.000000,
-    0.522499, -0.725299, -0.448259,
-    0.000000, 1.000000,
-    0.553372, -0.737712, -0.386730,
-    0.500000, 0.133975,
-    0.587785, -0.688191, -0.425325,
-    1.000000, 1.000000,
-    0.634579, -0.749786, -0.187432,
-    0.000000, 1.000000,
-    0.656282, -0.744727, -0.121144,
-    0.500000, 0.133975,
-    0.693780, -0.702046, -0.160622,
-    1.000000, 1.000000,
-    -0.470917, -0.619242, 0.628313,
-    0.000000, 1.000000,
-    -0.496441, -0.552418, 0.669612,
-    0.500000, 0.133975,
-    -0.425325, -0.587785, 0.688191,
-    1.000000, 1.000000,
-    -0.399769, -0.649448, 0.646840,
-    0.000000, 1.000000,
-    -0.470917, -0.619242, 0.628313,
-    0.500000, 0.133975,
-    -0.425325, -0.587785, 0.688191,
-    1.000000, 1.000000,
-    -0.669612, -0.496441, 0.552418,
-    0.000000, 1.000000,
-    -0.725299, -0.448259, 0.522499,
-    0.500000, 0.133975,
-    -0.688191, -0.425325, 0.587785,
-    1.000000, 1.000000,
-    -0.237229, -0.504209, 0.830359,
-    0.000000, 1.000000,
-    -0.303801, -0.476226, 0.825175,
-    0.500000, 0.133975,
-    -0.259892, -0.433889, 0.862668,
-    1.000000, 1.000000,
-    -0.196015, -0.460267, 0.865871,
-    0.000000, 1.000000,
-    -0.237229, -0.504209, 0.830359,
-    0.500000, 0.133975,
-    -0.259892, -0.433889, 0.862668,
-    1.000000, 1.000000,
-    -0.361592, -0.619186, 0.697037,
-    0.000000, 1.000000,
-    -0.399769, -0.649448, 0.646840,
-    0.500000, 0.133975,
-    -0.425325, -0.587785, 0.688191,
-    1.000000, 1.000000,
-    -0.553372, -0.737712, 0.386730,
-    0.000000, 1.000000,
-    -0.619186, -0.697037, 0.361592,
-    0.500000, 0.133975,
-    -0.587785, -0.688191, 0.425325,
-    1.000000, 1.000000,
-    -0.522499, -0.725299, 0.448259,
-    0.000000, 1.000000,
-    -0.553372, -0.737712, 0.386730,
-    0.500000, 0.133975,
-    -0.587785, -0.688191, 0.425325,
-    1.000000, 1.000000,
-    -0.634579, -0.749786, 0.187432,
-    0.000000, 1.000000,
-    -0.656282, -0.744727, 0.121144,
-    0.500000, 0.133975,
-    -0.693780, -0.702046, 0.160622,
-    1.000000, 1.000000,
-    0.496441, -0.552418, 0.669612,
-    0.000000, 1.000000,
-    0.470917, -0.619242, 0.628313,
-    0.500000, 0.133975,
-    0.425325, -0.587785, 0.688191,
-    1.000000, 1.000000,
-    0.448259, -0.522499, 0.725299,
-    0.000000, 1.000000,
-    0.496441, -0.552418, 0.669612,
-    0.500000, 0.133975,
-    0.425325, -0.587785, 0.688191,
-    1.000000, 1.000000,
-    0.619242, -0.628313, 0.470917,
-    0.000000, 1.000000,
-    0.649448, -0.646840, 0.399769,
-    0.500000, 0.133975,
-    0.587785, -0.688191, 0.425325,
-    1.000000, 1.000000,
-    0.187432, -0.634579, 0.749786,
-    0.000000, 1.000000,
-    0.228900, -0.672319, 0.703983,
-    0.500000, 0.133975,
-    0.160622, -0.693780, 0.702046,
-    1.000000, 1.000000,
-    0.121144, -0.656282, 0.744727,
-    0.000000, 1.000000,
-    0.187432, -0.634579, 0.749786,
-    0.500000, 0.133975,
-    0.160622, -0.693780, 0.702046,
-    1.000000, 1.000000,
-    0.386730, -0.553372, 0.737712,
-    0.000000, 1.000000,
-    0.448259, -0.522499, 0.725299,
-    0.500000, 0.133975,
-    0.425325, -0.587785, 0.688191,
-    1.000000, 1.000000,
-    0.697037, -0.361592, 0.619186,
-    0.000000, 1.000000,
-    0.737712, -0.386730, 0.553372,
-    0.500000, 0.133975,
-    0.688191, -0.425325, 0.587785,
-    1.000000, 1.000000,
-    0.646840, -0.399769, 0.649448,
-    0.000000, 1.000000,
-    0.697037, -0.361592, 0.619186,
-    0.500000, 0.133975,
-    0.688191, -0.425325, 0.587785,
-    1.000000, 1.000000,
-    0.830359, -0.237229, 0.504209,
-    0.000000, 1.000000,
-    0.865871, -0.196015, 0.460267,
-    0.500000, 0.133975,
-    0.862668, -0.259892, 0.433889,
-    1.000000, 1.000000,
-    -0.749387, 0.040642, 0.660884,
-    0.000000, 1.000000,
-    -0.786433, 0.000000, 0.617676,
-    0.500000, 0.133975,
-    -0.783843, 0.081086, 0.615642,
-    1.000000, 1.000000,
-    -0.744727, 0.121144, 0.656282,
-    0.000000, 1.000000,
-    -0.749387, 0.040642, 0.660884,
-    0.500000, 0.133975,
-    -0.783843, 0.081086, 0.615642,
-    1.000000, 1.000000,
-    -0.749387, -0.040642, 0.660884,
-    0.000000, 1.000000,
-    -0.744727, -0.121144, 0.656282,
-    0.500000, 0.133975,
-    -0.783843, -0.081086, 0.615642,
-    1.000000, 1.000000,
-    0.065988, -0.381722, 0.921919,
-    0.000000, 1.000000,
-    0.065817, -0.445365, 0.892927,
-    0.500000, 0.133975,
-    0.000000, -0.403355, 0.915043,
-    1.000000, 1.000000,
-    0.000000, -0.339123, 0.940742,
-    0.000000, 1.000000,
-    0.065988, -0.381722, 0.921919,
-    0.500000, 0.133975,
-    0.000000, -0.403355, 0.915043,
-    1.000000, 1.000000,
-    0.131749, -0.422364, 0.896801,
-    0.000000, 1.000000,
-    0.196015, -0.460267, 0.865871,
-    0.500000, 0.133975,
-    0.131200, -0.484442, 0.864929,
-    1.000000, 1.000000,
-    0.749387, 0.040642, -0.660884,
-    0.000000, 1.000000,
-    0.786433, 0.000000, -0.617676,
-    0.500000, 0.133975,
-    0.783843, 0.081086, -0.615642,
-    1.000000, 1.000000,
-    0.744727, 0.121144, -0.656282,
-    0.000000, 1.000000,
-    0.749387, 0.040642, -0.660884,
-    0.500000, 0.133975,
-    0.783843, 0.081086, -0.615642,
-    1.000000, 1.000000,
-    0.749387, -0.040642, -0.660884,
-    0.000000, 1.000000,
-    0.744727, -0.121144, -0.656282,
-    0.500000, 0.133975,
-    0.783843, -0.081086, -0.615642,
-    1.000000, 1.000000,
-    -0.065988, -0.381722, -0.921919,
-    0.000000, 1.000000,
-    -0.065817, -0.445365, -0.892927,
-    0.500000, 0.133975,
-    0.000000, -0.403355, -0.915043,
-    1.000000, 1.000000,
-    0.000000, -0.339123, -0.940742,
-    0.000000, 1.000000,
-    -0.065988, -0.381722, -0.921919,
-    0.500000, 0.133975,
-    0.000000, -0.403355, -0.915043,
-    1.000000, 1.000000,
-    -0.131749, -0.422364, -0.896801,
-    0.000000, 1.000000,
-    -0.196015, -0.460267, -0.865871,
-    0.500000, 0.133975,
-    -0.131200, -0.484442, -0.864929,
-    1.000000, 1.000000,
-    -0.422364, -0.896801, 0.131749,
-    0.000000, 1.000000,
-    -0.445365, -0.892927, 0.065817,
-    0.500000, 0.133975,
-    -0.484442, -0.864929, 0.131200,
-    1.000000, 1.000000,
-    -0.460267, -0.865871, 0.196015,
-    0.000000, 1.000000,
-    -0.422364, -0.896801, 0.131749,
-    0.500000, 0.133975,
-    -0.484442, -0.864929, 0.131200,
-    1.000000, 1.000000,
-    -0.381722, -0.921919, 0.065988,
-    0.000000, 1.000000,
-    -0.339123, -0.940742, 0.000000,
-    0.500000, 0.133975,
-    -0.403355, -0.915043, 0.000000,
-    1.000000, 1.000000,
-    0.422364, -0.896801, -0.131749,
-    0.000000, 1.000000,
-    0.445365, -0.892927, -0.065817,
-    0.500000, 0.133975,
-    0.484442, -0.864929, -0.131200,
-    1.000000, 1.000000,
-    0.460267, -0.865871, -0.196015,
-    0.000000, 1.000000,
-    0.422364, -0.896801, -0.131749,
-    0.500000, 0.133975,
-    0.484442, -0.864929, -0.131200,
-    1.000000, 1.000000,
-    0.381722, -0.921919, -0.065988,
-    0.000000, 1.000000,
-    0.339123, -0.940742, 0.000000,
-    0.500000, 0.133975,
-    0.403355, -0.915043, 0.000000,
-    1.000000, 1.000000,
-    -0.921919, 0.065988, -0.381722,
-    0.000000, 1.000000,
-    -0.940742, 0.000000, -0.339123,
-    0.500000, 0.133975,
-    -0.915043, 0.000000, -0.403355,
-    1.000000, 1.000000,
-    -0.896801, -0.131749, 0.422364,
-    0.000000, 1.000000,
-    -0.892927, -0.065817, 0.445365,
-    0.500000, 0.133975,
-    -0.864929, -0.131200, 0.484442,
-    1.000000, 1.000000,
-    -0.865871, -0.196015, 0.460267,
-    0.000000, 1.000000,
-    -0.896801, -0.131749, 0.422364,
-    0.500000, 0.133975,
-    -0.864929, -0.131200, 0.484442,
-    1.000000, 1.000000,
-    -0.921919, -0.065988, 0.381722,
-    0.000000, 1.000000,
-    -0.940742, 0.000000, 0.339123,
-    0.500000, 0.133975,
-    -0.915043, 0.000000, 0.403355,
-    1.000000, 1.000000,
-    0.921919, 0.065988, 0.381722,
-    0.000000, 1.000000,
-    0.940742, 0.000000, 0.339123,
-    0.500000, 0.133975,
-    0.915043, 0.000000, 0.403355,
-    1.000000, 1.000000,
-    0.896801, -0.131749, -0.422364,
-    0.000000, 1.000000,
-    0.892927, -0.065817, -0.445365,
-    0.500000, 0.133975,
-    0.864929, -0.131200, -0.484442,
-    1.000000, 1.000000,
-    0.865871, -0.196015, -0.460267,
-    0.000000, 1.000000,
-    0.896801, -0.131749, -0.422364,
-    0.500000, 0.133975,
-    0.864929, -0.131200, -0.484442,
-    1.000000, 1.000000,
-    0.921919, -0.065988, -0.381722,
-    0.000000, 1.000000,
-    0.940742, 0.000000, -0.339123,
-    0.500000, 0.133975,
-    0.915043, 0.000000, -0.403355,
-    1.000000, 1.000000,
-    -0.529135, -0.830812, -0.172532,
-    0.000000, 1.000000,
-    -0.551859, -0.827110, -0.106494,
-    0.500000, 0.133975,
-    -0.484442, -0.864929, -0.131200,
-    1.000000, 1.000000,
-    -0.460267, -0.865871, -0.196015,
-    0.000000, 1.000000,
-    -0.529135, -0.830812, -0.172532,
-    0.500000, 0.133975,
-    -0.484442, -0.864929, -0.131200,
-    1.000000, 1.000000,
-    -0.594895, -0.790170, -0.147414,
-    0.000000, 1.000000,
-    -0.656282, -0.744727, -0.121144,
-    0.500000, 0.133975,
-    -0.615642, -0.783843, -0.081086,
-    1.000000, 1.000000,
-    0.790170, -0.147414, -0.594895,
-    0.000000, 1.000000,
-    0.827110, -0.106494, -0.551859,
-    0.500000, 0.133975,
-    0.783843, -0.081086, -0.615642,
-    1.000000, 1.000000,
-    0.744727, -0.121144, -0.656282,
-    0.000000, 1.000000,
-    0.790170, -0.147414, -0.594895,
-    0.500000, 0.133975,
-    0.783843, -0.081086, -0.615642,
-    1.000000, 1.000000,
-    0.830812, -0.172532, -0.529135,
-    0.000000, 1.000000,
-    0.865871, -0.196015, -0.460267,
-    0.500000, 0.133975,
-    0.864929, -0.131200, -0.484442,
-    1.000000, 1.000000,
-    -0.790170, -0.147414, 0.594895,
-    0.000000, 1.000000,
-    -0.827110, -0.106494, 0.551859,
-    0.500000, 0.133975,
-    -0.783843, -0.081086, 0.615642,
-    1.000000, 1.000000,
-    -0.744727, -0.121144, 0.656282,
-    0.000000, 1.000000,
-    -0.790170, -0.147414, 0.594895,
-    0.500000, 0.133975,
-    -0.783843, -0.081086, 0.615642,
-    1.000000, 1.000000,
-    -0.830812, -0.172532, 0.529135,
-    0.000000, 1.000000,
-    -0.865871, -0.196015, 0.460267,
-    0.500000, 0.133975,
-    -0.864929, -0.131200, 0.484442,
-    1.000000, 1.000000,
-    0.529135, -0.830812, 0.172532,
-    0.000000, 1.000000,
-    0.551859, -0.827110, 0.106494,
-    0.500000, 0.133975,
-    0.484442, -0.864929, 0.131200,
-    1.000000, 1.000000,
-    0.460267, -0.865871, 0.196015,
-    0.000000, 1.000000,
-    0.529135, -0.830812, 0.172532,
-    0.500000, 0.133975,
-    0.484442, -0.864929, 0.131200,
-    1.000000, 1.000000,
-    0.594895, -0.790170, 0.147414,
-    0.000000, 1.000000,
-    0.656282, -0.744727, 0.121144,
-    0.500000, 0.133975,
-    0.615642, -0.783843, 0.081086,
-    1.000000, 1.000000,
-    -0.325929, -0.270627, 0.905832,
-    0.000000, 1.000000,
-    -0.385906, -0.307659, 0.869725,
-    0.500000, 0.133975,
-    -0.386187, -0.238677, 0.891007,
-    1.000000, 1.000000,
-    -0.325530, -0.201189, 0.923880,
-    0.000000, 1.000000,
-    -0.325929, -0.270627, 0.905832,
-    0.500000, 0.133975,
-    -0.386187, -0.238677, 0.891007,
-    1.000000, 1.000000,
-    -0.324864, -0.339209, 0.882837,
-    0.000000, 1.000000,
-    -0.322525, -0.405434, 0.855337,
-    0.500000, 0.133975,
-    -0.383614, -0.375039, 0.843911,
-    1.000000, 1.000000,
-    0.200368, 0.041251, 0.978852,
-    0.000000, 1.000000,
-    0.133523, 0.000000, 0.991046,
-    0.500000, 0.133975,
-    0.133071, 0.082242, 0.987688,
-    1.000000, 1.000000,
-    0.198580, 0.122729, 0.972370,
-    0.000000, 1.000000,
-    0.200368, 0.041251, 0.978852,
-    0.500000, 0.133975,
-    0.133071, 0.082242, 0.987688,
-    1.000000, 1.000000,
-    0.200368, -0.041251, 0.978852,
-    0.000000, 1.000000,
-    0.198580, -0.122729, 0.972370,
-    0.500000, 0.133975,
-    0.133071, -0.082242, 0.987688,
-    1.000000, 1.000000,
-    0.571140, -0.119078, 0.812169,
-    0.000000, 1.000000,
-    0.564513, -0.197274, 0.801504,
-    0.500000, 0.133975,
-    0.519258, -0.156434, 0.840178,
-    1.000000, 1.000000,
-    0.524110, -0.078459, 0.848029,
-    0.000000, 1.000000,
-    0.571140, -0.119078, 0.812169,
-    0.500000, 0.133975,
-    0.519258, -0.156434, 0.840178,
-    1.000000, 1.000000,
-    0.615456, -0.159613, 0.771841,
-    0.000000, 1.000000,
-    0.656006, -0.199331, 0.727958,
-    0.500000, 0.133975,
-    0.606825, -0.237086, 0.758652,
-    1.000000, 1.000000,
-    0.325929, -0.270627, -0.905832,
-    0.000000, 1.000000,
-    0.385906, -0.307659, -0.869725,
-    0.500000, 0.133975,
-    0.386187, -0.238677, -0.891007,
-    1.000000, 1.000000,
-    0.325530, -0.201189, -0.923880,
-    0.000000, 1.000000,
-    0.325929, -0.270627, -0.905832,
-    0.500000, 0.133975,
-    0.386187, -0.238677, -0.891007,
-    1.000000, 1.000000,
-    0.324864, -0.339209, -0.882837,
-    0.000000, 1.000000,
-    0.322525, -0.405434, -0.855337,
-    0.500000, 0.133975,
-    0.383614, -0.375039, -0.843911,
-    1.000000, 1.000000,
-    -0.200368, 0.041251, -0.978852,
-    0.000000, 1.000000,
-    -0.133523, 0.000000, -0.991046,
-    0.500000, 0.133975,
-    -0.133071, 0.082242, -0.987688,
-    1.000000, 1.000000,
-    -0.198580, 0.122729, -0.972370,
-    0.000000, 1.000000,
-    -0.200368, 0.041251, -0.978852,
-    0.500000, 0.133975,
-    -0.133071, 0.082242, -0.987688,
-    1.000000, 1.000000,
-    -0.200368, -0.041251, -0.978852,
-    0.000000, 1.000000,
-    -0.198580, -0.122729, -0.972370,
-    0.500000, 0.133975,
-    -0.133071, -0.082242, -0.987688,
-    1.000000, 1.000000,
-    -0.571140, -0.119078, -0.812169,
-    0.000000, 1.000000,
-    -0.564513, -0.197274, -0.801504,
-    0.500000, 0.133975,
-    -0.519258, -0.156434, -0.840178,
-    1.000000, 1.000000,
-    -0.524110, -0.078459, -0.848029,
-    0.000000, 1.000000,
-    -0.571140, -0.119078, -0.812169,
-    0.500000, 0.133975,
-    -0.519258, -0.156434, -0.840178,
-    1.000000, 1.000000,
-    -0.615456, -0.159613, -0.771841,
-    0.000000, 1.000000,
-    -0.656006, -0.199331, -0.727958,
-    0.500000, 0.133975,
-    -0.606825, -0.237086, -0.758652,
-    1.000000, 1.000000,
-    -0.119755, -0.879345, 0.460882,
-    0.000000, 1.000000,
-    -0.198227, -0.868534, 0.454262,
-    0.500000, 0.133975,
-    -0.156434, -0.840178, 0.519258,
-    1.000000, 1.000000,
-    -0.078459, -0.848029, 0.524110,
-    0.000000, 1.000000,
-    -0.119755, -0.879345, 0.460882,
-    0.500000, 0.133975,
-    -0.156434, -0.840178, 0.519258,
-    1.000000, 1.000000,
-    -0.161006, -0.904839, 0.394136,
-    0.000000, 1.000000,
-    -0.201189, -0.923880, 0.325530,
-    0.500000, 0.133975,
-    -0.238677, -0.891007, 0.386187,
-    1.000000, 1.000000,
-    -0.159613, -0.771841, 0.615456,
-    0.000000, 1.000000,
-    -0.197274, -0.801504, 0.564513,
-    0.500000, 0.133975,
-    -0.237086, -0.758652, 0.606825,
-    1.000000, 1.000000,
-    -0.199331, -0.727958, 0.656006,
-    0.000000, 1.000000,
-    -0.159613, -0.771841, 0.615456,
-    0.500000, 0.133975,
-    -0.237086, -0.758652, 0.606825,
-    1.000000, 1.000000,
-    -0.119078, -0.812169, 0.571140,
-    0.000000, 1.000000,
-    -0.078459, -0.848029, 0.524110,
-    0.500000, 0.133975,
-    -0.156434, -0.840178, 0.519258,
-    1.000000, 1.000000,
-    0.151549, -0.979426, 0.133256,
-    0.000000, 1.000000,
-    0.110385, -0.991648, 0.066709,
-    0.500000, 0.133975,
-    0.082242, -0.987688, 0.133071,
-    1.000000, 1.000000,
-    0.122729, -0.972370, 0.198580,
-    0.000000, 1.000000,
-    0.151549, -0.979426, 0.133256,
-    0.500000, 0.133975,
-    0.082242, -0.987688, 0.133071,
-    1.000000, 1.000000,
-    0.179596, -0.981483, 0.066604,
-    0.000000, 1.000000,
-    0.206103, -0.978530, 0.000000,
-    0.500000, 0.133975,
-    0.137952, -0.990439, 0.000000,
-    1.000000, 1.000000,
-    0.119755, -0.879345, -0.460882,
-    0.000000, 1.000000,
-    0.198227, -0.868534, -0.454262,
-    0.500000, 0.133975,
-    0.156434, -0.840178, -0.519258,
-    1.000000, 1.000000,
-    0.078459, -0.848029, -0.524110,
-    0.000000, 1.000000,
-    0.119755, -0.879345, -0.460882,
-    0.500000, 0.133975,
-    0.156434, -0.840178, -0.519258,
-    1.000000, 1.000000,
-    0.161006, -0.904839, -0.394136,
-    0.000000, 1.000000,
-    0.201189, -0.923880, -0.325530,
-    0.500000, 0.133975,
-    0.238677, -0.891007, -0.386187,
-    1.000000, 1.000000,
-    0.159613, -0.771841, -0.615456,
-    0.000000, 1.000000,
-    0.197274, -0.801504, -0.564513,
-    0.500000, 0.133975,
-    0.237086, -0.758652, -0.606825,
-    1.000000, 1.000000,
-    0.199331, -0.727958, -0.656006,
-    0.000000, 1.000000,
-    0.159613, -0.771841, -0.615456,
-    0.500000, 0.133975,
-    0.237086, -0.758652, -0.606825,
-    1.000000, 1.000000,
-    0.119078, -0.812169, -0.571140,
-    0.000000, 1.000000,
-    0.078459, -0.848029, -0.524110,
-    0.500000, 0.133975,
-    0.156434, -0.840178, -0.519258,
-    1.000000, 1.000000,
-    -0.151549, -0.979426, -0.133256,
-    0.000000, 1.000000,
-    -0.110385, -0.991648, -0.066709,
-    0.500000, 0.133975,
-    -0.082242, -0.987688, -0.133071,
-    1.000000, 1.000000,
-    -0.122729, -0.972370, -0.198580,
-    0.000000, 1.000000,
-    -0.151549, -0.979426, -0.133256,
-    0.500000, 0.133975,
-    -0.082242, -0.987688, -0.133071,
-    1.000000, 1.000000,
-    -0.179596, -0.981483, -0.066604,
-    0.000000, 1.000000,
-    -0.206103, -0.978530, 0.000000,
-    0.500000, 0.133975,
-    -0.137952, -0.990439, 0.000000,
-    1.000000, 1.000000,
-    -0.981483, 0.066604, 0.179596,
-    0.000000, 1.000000,
-    -0.978530, 0.000000, 0.206103,
-    0.500000, 0.133975,
-    -0.990439, 0.000000, 0.137952,
-    1.000000, 1.000000,
-    -0.879345, -0.460882, 0.119755,
-    0.000000, 1.000000,
-    -0.868534, -0.454262, 0.198227,
-    0.500000, 0.133975,
-    -0.840178, -0.519258, 0.156434,
-    1.000000, 1.000000,
-    -0.848029, -0.524110, 0.078459,
-    0.000000, 1.000000,
-    -0.879345, -0.460882, 0.119755,
-    0.500000, 0.133975,
-    -0.840178, -0.519258, 0.156434,
-    1.000000, 1.000000,
-    -0.904839, -0.394136, 0.161006,
-    0.000000, 1.000000,
-    -0.923880, -0.325530, 0.201189,
-    0.500000, 0.133975,
-    -0.891007, -0.386187, 0.238677,
-    1.000000, 1.000000,
-    -0.771841, -0.615456, 0.159613,
-    0.000000, 1.000000,
-    -0.801504, -0.564513, 0.197274,
-    0.500000, 0.133975,
-    -0.758652, -0.606825, 0.237086,
-    1.000000, 1.000000,
-    -0.727958, -0.656006, 0.199331,
-    0.000000, 1.000000,
-    -0.771841, -0.615456, 0.159613,
-    0.500000, 0.133975,
-    -0.758652, -0.606825, 0.237086,
-    1.000000, 1.000000,
-    -0.812169, -0.571140, 0.119078,
-    0.000000, 1.000000,
-    -0.848029, -0.524110, 0.078459,
-    0.500000, 0.133975,
-    -0.840178, -0.519258, 0.156434,
-    1.000000, 1.000000,
-    -0.979426, -0.133256, -0.151549,
-    0.000000, 1.000000,
-    -0.991648, -0.066709, -0.110385,
-    0.500000, 0.133975,
-    -0.987688, -0.133071, -0.082242,
-    1.000000, 1.000000,
-    -0.972370, -0.198580, -0.122729,
-    0.000000, 1.000000,
-    -0.979426, -0.133256, -0.151549,
-    0.500000, 0.133975,
-    -0.987688, -0.133071, -0.082242,
-    1.000000, 1.000000,
-    -0.981483, -0.066604, -0.179596,
-    0.000000, 1.000000,
-    -0.978530, 0.000000, -0.206103,
-    0.500000, 0.133975,
-    -0.990439, 0.000000, -0.137952,
-    1.000000, 1.000000,
-    0.981483, 0.066604, -0.179596,
-    0.000000, 1.000000,
-    0.978530, 0.000000, -0.206103,
-    0.500000, 0.133975,
-    0.990439, 0.000000, -0.137952,
-    1.000000, 1.000000,
-    0.879345, -0.460882, -0.119755,
-    0.000000, 1.000000,
-    0.868534, -0.454262, -0.198227,
-    0.500000, 0.133975,
-    0.840178, -0.519258, -0.156434,
-    1.000000, 1.000000,
-    0.848029, -0.524110, -0.078459,
-    0.000000, 1.000000,
-    0.879345, -0.460882, -0.119755,
-    0.500000, 0.133975,
-    0.840178, -0.519258, -0.156434,
-    1.000000, 1.000000,
-    0.904839, -0.394136, -0.161006,
-    0.000000, 1.000000,
-    0.923880, -0.325530, -0.201189,
-    0.500000, 0.133975,
-    0.891007, -0.386187, -0.238677,
-    1.000000, 1.000000,
-    0.771841, -0.615456, -0.159613,
-    0.000000, 1.000000,
-    0.801504, -0.564513, -0.197274,
-    0.500000, 0.133975,
-    0.758652, -0.606825, -0.237086,
-    1.000000, 1.000000,
-    0.727958, -0.656006, -0.199331,
-    0.000000, 1.000000,
-    0.771841, -0.615456, -0.159613,
-    0.500000, 0.133975,
-    0.758652, -0.606825, -0.237086,
-    1.000000, 1.000000,
-    0.812169, -0.571140, -0.119078,
-    0.000000, 1.000000,
-    0.848029, -0.524110, -0.078459,
-    0.500000, 0.133975,
-    0.840178, -0.519258, -0.156434,
-    1.000000, 1.000000,
-    0.979426, -0.133256, 0.151549,
-    0.000000, 1.000000,
-    0.991648, -0.066709, 0.110385,
-    0.500000, 0.133975,
-    0.987688, -0.133071, 0.082242,
-    1.000000, 1.000000,
-    0.972370, -0.198580, 0.122729,
-    0.000000, 1.000000,
-    0.979426, -0.133256, 0.151549,
-    0.500000, 0.133975,
-    0.987688, -0.133071, 0.082242,
-    1.000000, 1.000000,
-    0.981483, -0.066604, 0.179596,
-    0.000000, 1.000000,
-    0.978530, 0.000000, 0.206103,
-    0.500000, 0.133975,
-    0.990439, 0.000000, 0.137952,
-    1.000000, 1.000000,
-    -0.443957, -0.678977, -0.584716,
-    0.000000, 1.000000,
-    -0.414273, -0.735011, -0.536784,
-    0.500000, 0.133975,
-    -0.371748, -0.707107, -0.601501,
-    1.000000, 1.000000,
-    -0.399769, -0.649448, -0.646840,
-    0.000000, 1.000000,
-    -0.443957, -0.678977, -0.584716,
-    0.500000, 0.133975,
-    -0.371748, -0.707107, -0.601501,
-    1.000000, 1.000000,
-    -0.485208, -0.704471, -0.517970,
-    0.000000, 1.000000,
-    -0.522499, -0.725299, -0.448259,
-    0.500000, 0.133975,
-    -0.453990, -0.757935, -0.468430,
-    1.000000, 1.000000,
-    -0.267381, -0.705236, -0.656620,
-    0.000000, 1.000000,
-    -0.305212, -0.734794, -0.605741,
-    0.500000, 0.133975,
-    -0.237086, -0.758652, -0.606825,
-    1.000000, 1.000000,
-    -0.199331, -0.727958, -0.656006,
-    0.000000, 1.000000,
-    -0.267381, -0.705236, -0.656620,
-    0.500000, 0.133975,
-    -0.237086, -0.758652, -0.606825,
-    1.000000, 1.000000,
-    -0.334692, -0.678913, -0.653497,
-    0.000000, 1.000000,
-    -0.399769, -0.649448, -0.646840,
-    0.500000, 0.133975,
-    -0.371748, -0.707107, -0.601501,
-    1.000000, 1.000000,
-    -0.772575, -0.408286, -0.486240,
-    0.000000, 1.000000,
-    -0.803016, -0.427135, -0.415597,
-    0.500000, 0.133975,
-    -0.757935, -0.468430, -0.453990,
-    1.000000, 1.000000,
-    -0.725299, -0.448259, -0.522499,
-    0.000000, 1.000000,
-    -0.772575, -0.408286, -0.486240,
-    0.500000, 0.133975,
-    -0.757935, -0.468430, -0.453990,
-    1.000000, 1.000000,
-    -0.816233, -0.366027, -0.446977,
-    0.000000, 1.000000,
-    -0.855337, -0.322525, -0.405434,
-    0.500000, 0.133975,
-    -0.843911, -0.383614, -0.375039,
-    1.000000, 1.000000,
-    0.517970, -0.485208, -0.704471,
-    0.000000, 1.000000,
-    0.536784, -0.414273, -0.735011,
-    0.500000, 0.133975,
-    0.468430, -0.453990, -0.757935,
-    1.000000, 1.000000,
-    0.448259, -0.522499, -0.725299,
-    0.000000, 1.000000,
-    0.517970, -0.485208, -0.704471,
-    0.500000, 0.133975,
-    0.468430, -0.453990, -0.757935,
-    1.000000, 1.000000,
-    0.584716, -0.443957, -0.678977,
-    0.000000, 1.000000,
-    0.646840, -0.399769, -0.649448,
-    0.500000, 0.133975,
-    0.601501, -0.371748, -0.707107,
-    1.000000, 1.000000,
-    0.366027, -0.446977, -0.816233,
-    0.000000, 1.000000,
-    0.427135, -0.415597, -0.803016,
-    0.500000, 0.133975,
-    0.383614, -0.375039, -0.843911,
-    1.000000, 1.000000,
-    0.322525, -0.405434, -0.855337,
-    0.000000, 1.000000,
-    0.366027, -0.446977, -0.816233,
-    0.500000, 0.133975,
-    0.383614, -0.375039, -0.843911,
-    1.000000, 1.000000,
-    0.408286, -0.486240, -0.772575,
-    0.000000, 1.000000,
-    0.448259, -0.522499, -0.725299,
-    0.500000, 0.133975,
-    0.468430, -0.453990, -0.757935,
-    1.000000, 1.000000,
-    0.678913, -0.653497, -0.334692,
-    0.000000, 1.000000,
-    0.734794, -0.605741, -0.305212,
-    0.500000, 0.133975,
-    0.707107, -0.601501, -0.371748,
-    1.000000, 1.000000,
-    0.649448, -0.646840, -0.399769,
-    0.000000, 1.000000,
-    0.678913, -0.653497, -0.334692,
-    0.500000, 0.133975,
-    0.707107, -0.601501, -0.371748,
-    1.000000, 1.000000,
-    0.705236, -0.656620, -0.267381,
-    0.000000, 1.000000,
-    0.727958, -0.656006, -0.199331,
-    0.500000, 0.133975,
-    0.758652, -0.606825, -0.237086,
-    1.000000, 1.000000,
-    -0.517970, -0.485208, 0.704471,
-    0.000000, 1.000000,
-    -0.536784, -0.414273, 0.735011,
-    0.500000, 0.133975,
-    -0.468430, -0.453990, 0.757935,
-    1.000000, 1.000000,
-    -0.448259, -0.522499, 0.725299,
-    0.000000, 1.000000,
-    -0.517970, -0.485208, 0.704471,
-    0.500000, 0.133975,
-    -0.468430, -0.453990, 0.757935,
-    1.000000, 1.000000,
-    -0.584716, -0.443957, 0.678977,
-    0.000000, 1.000000,
-    -0.646840, -0.399769, 0.649448,
-    0.500000, 0.133975,
-    -0.601501, -0.371748, 0.707107,
-    1.000000, 1.000000,
-    -0.366027, -0.446977, 0.816233,
-    0.000000, 1.000000,
-    -0.427135, -0.415597, 0.803016,
-    0.500000, 0.133975,
-    -0.383614, -0.375039, 0.843911,
-    1.000000, 1.000000,
-    -0.322525, -0.405434, 0.855337,
-    0.000000, 1.000000,
-    -0.366027, -0.446977, 0.816233,
-    0.500000, 0.133975,
-    -0.383614, -0.375039, 0.843911,
-    1.000000, 1.000000,
-    -0.408286, -0.486240, 0.772575,
-    0.000000, 1.000000,
-    -0.448259, -0.522499, 0.725299,
-    0.500000, 0.133975,
-    -0.468430, -0.453990, 0.757935,
-    1.000000, 1.000000,
-    -0.678913, -0.653497, 0.334692,
-    0.000000, 1.000000,
-    -0.734794, -0.605741, 0.305212,
-    0.500000, 0.133975,
-    -0.707107, -0.601501, 0.371748,
-    1.000000, 1.000000,
-    -0.649448, -0.646840, 0.399769,
-    0.000000, 1.000000,
-    -0.678913, -0.653497, 0.334692,
-    0.500000, 0.133975,
-    -0.707107, -0.601501, 0.371748,
-    1.000000, 1.000000,
-    -0.705236, -0.656620, 0.267381,
-    0.000000, 1.000000,
-    -0.727958, -0.656006, 0.199331,
-    0.500000, 0.133975,
-    -0.758652, -0.606825, 0.237086,
-    1.000000, 1.000000,
-    0.443957, -0.678977, 0.584716,
-    0.000000, 1.000000,
-    0.414273, -0.735011, 0.536784,
-    0.500000, 0.133975,
-    0.371748, -0.707107, 0.601501,
-    1.000000, 1.000000,
-    0.399769, -0.649448, 0.646840,
-    0.000000, 1.000000,
-    0.443957, -0.678977, 0.584716,
-    0.500000, 0.133975,
-    0.371748, -0.707107, 0.601501,
-    1.000000, 1.000000,
-    0.485208, -0.704471, 0.517970,
-    0.000000, 1.000000,
-    0.522499, -0.725299, 0.448259,
-    0.500000, 0.133975,
-    0.453990, -0.757935, 0.468430,
-    1.000000, 1.000000,
-    0.267381, -0.705236, 0.656620,
-    0.000000, 1.000000,
-    0.305212, -0.734794, 0.605741,
-    0.500000, 0.133975,
-    0.237086, -0.758652, 0.606825,
-    1.000000, 1.000000,
-    0.199331, -0.727958, 0.656006,
-    0.000000, 1.000000,
-    0.267381, -0.705236, 0.656620,
-    0.500000, 0.133975,
-    0.237086, -0.758652, 0.606825,
-    1.000000, 1.000000,
-    0.334692, -0.678913, 0.653497,
-    0.000000, 1.000000,
-    0.399769, -0.649448, 0.646840,
-    0.500000, 0.133975,
-    0.371748, -0.707107, 0.601501,
-    1.000000, 1.000000,
-    0.772575, -0.408286, 0.486240,
-    0.000000, 1.000000,
-    0.803016, -0.427135, 0.415597,
-    0.500000, 0.133975,
-    0.757935, -0.468430, 0.453990,
-    1.000000, 1.000000,
-    0.725299, -0.448259, 0.522499,
-    0.000000, 1.000000,
-    0.772575, -0.408286, 0.486240,
-    0.500000, 0.133975,
-    0.757935, -0.468430, 0.453990,
-    1.000000, 1.000000,
-    0.816233, -0.366027, 0.446977,
-    0.000000, 1.000000,
-    0.855337, -0.322525, 0.405434,
-    0.500000, 0.133975,
-    0.843911, -0.383614, 0.375039,
-    1.000000, 1.000000,
-    -0.622292, 0.000000, 0.782786,
-    0.000000, 1.000000,
-    -0.667502, 0.040677, 0.743496,
-    0.500000, 0.133975,
-    -0.620240, 0.081142, 0.780204,
-    1.000000, 1.000000,
-    -0.574458, 0.040675, 0.817523,
-    0.000000, 1.000000,
-    -0.622292, 0.000000, 0.782786,
-    0.500000, 0.133975,
-    -0.620240, 0.081142, 0.780204,
-    1.000000, 1.000000,
-    -0.667502, -0.040677, 0.743496,
-    0.000000, 1.000000,
-    -0.708969, -0.080573, 0.700622,
-    0.500000, 0.133975,
-    -0.711282, 0.000000, 0.702907,
-    1.000000, 1.000000,
-    -0.571140, 0.119078, 0.812169,
-    0.000000, 1.000000,
-    -0.574458, 0.040675, 0.817523,
-    0.500000, 0.133975,
-    -0.620240, 0.081142, 0.780204,
-    1.000000, 1.000000,
-    -0.571140, -0.119078, 0.812169,
-    0.000000, 1.000000,
-    -0.615456, -0.159613, 0.771841,
-    0.500000, 0.133975,
-    -0.620240, -0.081142, 0.780204,
-    1.000000, 1.000000,
-    -0.574458, -0.040675, 0.817523,
-    0.000000, 1.000000,
-    -0.571140, -0.119078, 0.812169,
-    0.500000, 0.133975,
-    -0.620240, -0.081142, 0.780204,
-    1.000000, 1.000000,
-    -0.564513, -0.197274, 0.801504,
-    0.000000, 1.000000,
-    -0.554740, -0.273707, 0.785715,
-    0.500000, 0.133975,
-    -0.606825, -0.237086, 0.758652,
-    1.000000, 1.000000,
-    0.199094, -0.261550, 0.944433,
-    0.000000, 1.000000,
-    0.132570, -0.289929, 0.947822,
-    0.500000, 0.133975,
-    0.132792, -0.220117, 0.966393,
-    1.000000, 1.000000,
-    0.198337, -0.191780, 0.961188,
-    0.000000, 1.000000,
-    0.199094, -0.261550, 0.944433,
-    0.500000, 0.133975,
-    0.132792, -0.220117, 0.966393,
-    1.000000, 1.000000,
-    0.198387, -0.330607, 0.922682,
-    0.000000, 1.000000,
-    0.196412, -0.397351, 0.896401,
-    0.500000, 0.133975,
-    0.131655, -0.358229, 0.924305,
-    1.000000, 1.000000,
-    0.066709, -0.110385, 0.991648,
-    0.000000, 1.000000,
-    0.066604, -0.179596, 0.981483,
-    0.500000, 0.133975,
-    0.000000, -0.137952, 0.990439,
-    1.000000, 1.000000,
-    0.000000, -0.069142, 0.997607,
-    0.000000, 1.000000,
-    0.066709, -0.110385, 0.991648,
-    0.500000, 0.133975,
-    0.000000, -0.137952, 0.990439,
-    1.000000, 1.000000,
-    0.133256, -0.151549, 0.979426,
-    0.000000, 1.000000,
-    0.198337, -0.191780, 0.961188,
-    0.500000, 0.133975,
-    0.132792, -0.220117, 0.966393,
-    1.000000, 1.000000,
-    0.325929, -0.270627, 0.905832,
-    0.000000, 1.000000,
-    0.324864, -0.339209, 0.882837,
-    0.500000, 0.133975,
-    0.264083, -0.301259, 0.916244,
-    1.000000, 1.000000,
-    0.264151, -0.232455, 0.936050,
-    0.000000, 1.000000,
-    0.325929, -0.270627, 0.905832,
-    0.500000, 0.133975,
-    0.264083, -0.301259, 0.916244,
-    1.000000, 1.000000,
-    0.385906, -0.307659, 0.869725,
-    0.000000, 1.000000,
-    0.442867, -0.342848, 0.828447,
-    0.500000, 0.133975,
-    0.383614, -0.375039, 0.843911,
-    1.000000, 1.000000,
-    0.622292, 0.000000, -0.782786,
-    0.000000, 1.000000,
-    0.667502, 0.040677, -0.743496,
-    0.500000, 0.133975,
-    0.620240, 0.081142, -0.780204,
-    1.000000, 1.000000,
-    0.574458, 0.040675, -0.817523,
-    0.000000, 1.000000,
-    0.622292, 0.000000, -0.782786,
-    0.500000, 0.133975,
-    0.620240, 0.081142, -0.780204,
-    1.000000, 1.000000,
-    0.667502, -0.040677, -0.743496,
-    0.000000, 1.000000,
-    0.708969, -0.080573, -0.700622,
-    0.500000, 0.133975,
-    0.711282, 0.000000, -0.702907,
-    1.000000, 1.000000,
-    0.571140, 0.119078, -0.812169,
-    0.000000, 1.000000,
-    0.574458, 0.040675, -0.817523,
-    0.500000, 0.133975,
-    0.620240, 0.081142, -0.780204,
-    1.000000, 1.000000,
-    0.571140, -0.119078, -0.812169,
-    0.000000, 1.000000,
-    0.615456, -0.159613, -0.771841,
-    0.500000, 0.133975,
-    0.620240, -0.081142, -0.780204,
-    1.000000, 1.000000,
-    0.574458, -0.040675, -0.817523,
-    0.000000, 1.000000,
-    0.571140, -0.119078, -0.812169,
-    0.500000, 0.133975,
-    0.620240, -0.081142, -0.780204,
-    1.000000, 1.000000,
-    0.564513, -0.197274, -0.801504,
-    0.000000, 1.000000,
-    0.554740, -0.273707, -0.785715,
-    0.500000, 0.133975,
-    0.606825, -0.237086, -0.758652,
-    1.000000, 1.000000,
-    -0.199094, -0.261550, -0.944433,
-    0.000000, 1.000000,
-    -0.132570, -0.289929, -0.947822,
-    0.500000, 0.133975,
-    -0.132792, -0.220117, -0.966393,
-    1.000000, 1.000000,
-    -0.198337, -0.191780, -0.961188,
-    0.000000, 1.000000,
-    -0.199094, -0.261550, -0.944433,
-    0.500000, 0.133975,
-    -0.132792, -0.220117, -0.966393,
-    1.000000, 1.000000,
-    -0.198387, -0.330607, -0.922682,
-    0.000000, 1.000000,
-    -0.196412, -0.397351, -0.896401,
-    0.500000, 0.133975,
-    -0.131655, -0.358229, -0.924305,
-    1.000000, 1.000000,
-    -0.066709, -0.110385, -0.991648,
-    0.000000, 1.000000,
-    -0.066604, -0.179596, -0.981483,
-    0.500000, 0.133975,
-    0.000000, -0.137952, -0.990439,
-    1.000000, 1.000000,
-    0.000000, -0.069142, -0.997607,
-    0.000000, 1.000000,
-    -0.066709, -0.110385, -0.991648,
-    0.500000, 0.133975,
-    0.000000, -0.137952, -0.990439,
-    1.000000, 1.000000,
-    -0.133256, -0.151549, -0.979426,
-    0.000000, 1.000000,
-    -0.198337, -0.191780, -0.961188,
-    0.500000, 0.133975,
-    -0.132792, -0.220117, -0.966393,
-    1.000000, 1.000000,
-    -0.325929, -0.270627, -0.905832,
-    0.000000, 1.000000,
-    -0.324864, -0.339209, -0.882837,
-    0.500000, 0.133975,
-    -0.264083, -0.301259, -0.916244,
-    1.000000, 1.000000,
-    -0.264151, -0.232455, -0.936050,
-    0.000000, 1.000000,
-    -0.325929, -0.270627, -0.905832,
-    0.500000, 0.133975,
-    -0.264083, -0.301259, -0.916244,
-    1.000000, 1.000000,
-    -0.385906, -0.307659, -0.869725,
-    0.000000, 1.000000,
-    -0.442867, -0.342848, -0.828447,
-    0.500000, 0.133975,
-    -0.383614, -0.375039, -0.843911,
-    1.000000, 1.000000,
-    -0.261550, -0.944433, 0.199094,
-    0.000000, 1.000000,
-    -0.330607, -0.922682, 0.198387,
-    0.500000, 0.133975,
-    -0.301259, -0.916244, 0.264083,
-    1.000000, 1.000000,
-    -0.232455, -0.936050, 0.264151,
-    0.000000, 1.000000,
-    -0.261550, -0.944433, 0.199094,
-    0.500000, 0.133975,
-    -0.301259, -0.916244, 0.264083,
-    1.000000, 1.000000,
-    -0.289929, -0.947822, 0.132570,
-    0.000000, 1.000000,
-    -0.316778, -0.946198, 0.066042,
-    0.500000, 0.133975,
-    -0.358229, -0.924305, 0.131655,
-    1.000000, 1.000000,
-    -0.307659, -0.869725, 0.385906,
-    0.000000, 1.000000,
-    -0.339209, -0.882837, 0.324864,
-    0.500000, 0.133975,
-    -0.375039, -0.843911, 0.383614,
-    1.000000, 1.000000,
-    -0.342848, -0.828447, 0.442867,
-    0.000000, 1.000000,
-    -0.307659, -0.869725, 0.385906,
-    0.500000, 0.133975,
-    -0.375039, -0.843911, 0.383614,
-    1.000000, 1.000000,
-    -0.270627, -0.905832, 0.325929,
-    0.000000, 1.000000,
-    -0.232455, -0.936050, 0.264151,
-    0.500000, 0.133975,
-    -0.301259, -0.916244, 0.264083,
-    1.000000, 1.000000,
-    -0.151549, -0.979426, 0.133256,
-    0.000000, 1.000000,
-    -0.179596, -0.981483, 0.066604,
-    0.500000, 0.133975,
-    -0.220117, -0.966393, 0.132792,
-    1.000000, 1.000000,
-    -0.191780, -0.961188, 0.198337,
-    0.000000, 1.000000,
-    -0.151549, -0.979426, 0.133256,
-    0.500000, 0.133975,
-    -0.220117, -0.966393, 0.132792,
-    1.000000, 1.000000,
-    -0.110385, -0.991648, 0.066709,
-    0.000000, 1.000000,
-    -0.069142, -0.997607, 0.000000,
-    0.500000, 0.133975,
-    -0.137952, -0.990439, 0.000000,
-    1.000000, 1.000000,
-    0.261550, -0.944433, -0.199094,
-    0.000000, 1.000000,
-    0.330607, -0.922682, -0.198387,
-    0.500000, 0.133975,
-    0.301259, -0.916244, -0.264083,
-    1.000000, 1.000000,
-    0.232455, -0.936050, -0.264151,
-    0.000000, 1.000000,
-    0.261550, -0.944433, -0.199094,
-    0.500000, 0.133975,
-    0.301259, -0.916244, -0.264083,
-    1.000000, 1.000000,
-    0.289929, -0.947822, -0.132570,
-    0.000000, 1.000000,
-    0.316778, -0.946198, -0.066042,
-    0.500000, 0.133975,
-    0.358229, -0.924305, -0.131655,
-    1.000000, 1.000000,
-    0.307659, -0.869725, -0.385906,
-    0.000000, 1.000000,
-    0.339209, -0.882837, -0.324864,
-    0.500000, 0.133975,
-    0.375039, -0.843911, -0.383614,
-    1.000000, 1.000000,
-    0.342848, -0.828447, -0.442867,
-    0.000000, 1.000000,
-    0.307659, -0.869725, -0.385906,
-    0.500000, 0.133975,
-    0.375039, -0.843911, -0.383614,
-    1.000000, 1.000000,
-    0.270627, -0.905832, -0.325929,
-    0.000000, 1.000000,
-    0.232455, -0.936050, -0.264151,
-    0.500000, 0.133975,
-    0.301259, -0.916244, -0.264083,
-    1.000000, 1.000000,
-    0.151549, -0.979426, -0.133256,
-    0.000000, 1.000000,
-    0.179596, -0.981483, -0.066604,
-    0.500000, 0.133975,
-    0.220117, -0.966393, -0.132792,
-    1.000000, 1.000000,
-    0.191780, -0.961188, -0.198337,
-    0.000000, 1.000000,
-    0.151549, -0.979426, -0.133256,
-    0.500000, 0.133975,
-    0.220117, -0.966393, -0.132792,
-    1.000000, 1.000000,
-    0.110385, -0.991648, -0.066709,
-    0.000000, 1.000000,
-    0.069142, -0.997607, 0.000000,
-    0.500000, 0.133975,
-    0.137952, -0.990439, 0.000000,
-    1.000000, 1.000000,
-    -0.991648, 0.066709, -0.110385,
-    0.000000, 1.000000,
-    -0.997607, 0.000000, -0.069142,
-    0.500000, 0.133975,
-    -0.990439, 0.000000, -0.137952,
-    1.000000, 1.000000,
-    -0.944433, -0.199094, 0.261550,
-    0.000000, 1.000000,
-    -0.922682, -0.198387, 0.330607,
-    0.500000, 0.133975,
-    -0.916244, -0.264083, 0.301259,
-    1.000000, 1.000000,
-    -0.936050, -0.264151, 0.232455,
-    0.000000, 1.000000,
-    -0.944433, -0.199094, 0.261550,
-    0.500000, 0.133975,
-    -0.916244, -0.264083, 0.301259,
-    1.000000, 1.000000,
-    -0.947822, -0.132570, 0.289929,
-    0.000000, 1.000000,
-    -0.946198, -0.066042, 0.316778,
-    0.500000, 0.133975,
-    -0.924305, -0.131655, 0.358229,
-    1.000000, 1.000000,
-    -0.869725, -0.385906, 0.307659,
-    0.000000, 1.000000,
-    -0.882837, -0.324864, 0.339209,
-    0.500000, 0.133975,
-    -0.843911, -0.383614, 0.375039,
-    1.000000, 1.000000,
-    -0.828447, -0.442867, 0.342848,
-    0.000000, 1.000000,
-    -0.869725, -0.385906, 0.307659,
-    0.500000, 0.133975,
-    -0.843911, -0.383614, 0.375039,
-    1.000000, 1.000000,
-    -0.905832, -0.325929, 0.270627,
-    0.000000, 1.000000,
-    -0.936050, -0.264151, 0.232455,
-    0.500000, 0.133975,
-    -0.916244, -0.264083, 0.301259,
-    1.000000, 1.000000,
-    -0.979426, -0.133256, 0.151549,
-    0.000000, 1.000000,
-    -0.981483, -0.066604, 0.179596,
-    0.500000, 0.133975,
-    -0.966393, -0.132792, 0.220117,
-    1.000000, 1.000000,
-    -0.961188, -0.198337, 0.191780,
-    0.000000, 1.000000,
-    -0.979426, -0.133256, 0.151549,
-    0.500000, 0.133975,
-    -0.966393, -0.132792, 0.220117,
-    1.000000, 1.000000,
-    -0.991648, -0.066709, 0.110385,
-    0.000000, 1.000000,
-    -0.997607, 0.000000, 0.069142,
-    0.500000, 0.133975,
-    -0.990439, 0.000000, 0.137952,
-    1.000000, 1.000000,
-    0.991648, 0.066709, 0.110385,
-    0.000000, 1.000000,
-    0.997607, 0.000000, 0.069142,
-    0.500000, 0.133975,
-    0.990439, 0.000000, 0.137952,
-    1.000000, 1.000000,
-    0.944433, -0.199094, -0.261550,
-    0.000000, 1.000000,
-    0.922682, -0.198387, -0.330607,
-    0.500000, 0.133975,
-    0.916244, -0.264083, -0.301259,
-    1.000000, 1.000000,
-    0.936050, -0.264151, -0.232455,
-    0.000000, 1.000000,
-    0.944433, -0.199094, -0.261550,
-    0.500000, 0.133975,
-    0.916244, -0.264083, -0.301259,
-    1.000000, 1.000000,
-    0.947822, -0.132570, -0.289929,
-    0.000000, 1.000000,
-    0.946198, -0.066042, -0.316778,
-    0.500000, 0.133975,
-    0.924305, -0.131655, -0.358229,
-    1.000000, 1.000000,
-    0.869725, -0.385906, -0.307659,
-    0.000000, 1.000000,
-    0.882837, -0.324864, -0.339209,
-    0.500000, 0.133975,
-    0.843911, -0.383614, -0.375039,
-    1.000000, 1.000000,
-    0.828447, -0.442867, -0.342848,
-    0.000000, 1.000000,
-    0.869725, -0.385906, -0.307659,
-    0.500000, 0.133975,
-    0.843911, -0.383614, -0.375039,
-    1.000000, 1.000000,
-    0.905832, -0.325929, -0.270627,
-    0.000000, 1.000000,
-    0.936050, -0.264151, -0.232455,
-    0.500000, 0.133975,
-    0.916244, -0.264083, -0.301259,
-    1.000000, 1.000000,
-    0.979426, -0.133256, -0.151549,
-    0.000000, 1.000000,
-    0.981483, -0.066604, -0.179596,
-    0.500000, 0.133975,
-    0.966393, -0.132792, -0.220117,
-    1.000000, 1.000000,
-    0.961188, -0.198337, -0.191780,
-    0.000000, 1.000000,
-    0.979426, -0.133256, -0.151549,
-    0.500000, 0.133975,
-    0.966393, -0.132792, -0.220117,
-    1.000000, 1.000000,
-    0.991648, -0.066709, -0.110385,
-    0.000000, 1.000000,
-    0.997607, 0.000000, -0.069142,
-    0.500000, 0.133975,
-    0.990439, 0.000000, -0.137952,
-    1.000000, 1.000000,
-    -0.583691, -0.745338, -0.322141,
-    0.000000, 1.000000,
-    -0.545109, -0.790112, -0.280319,
-    0.500000, 0.133975,
-    -0.516122, -0.783452, -0.346153,
-    1.000000, 1.000000,
-    -0.553372, -0.737712, -0.386730,
-    0.000000, 1.000000,
-    -0.583691, -0.745338, -0.322141,
-    0.500000, 0.133975,
-    -0.516122, -0.783452, -0.346153,
-    1.000000, 1.000000,
-    -0.610926, -0.749435, -0.255180,
-    0.000000, 1.000000,
-    -0.634579, -0.749786, -0.187432,
-    0.500000, 0.133975,
-    -0.571252, -0.792649, -0.213023,
-    1.000000, 1.000000,
-    -0.415597, -0.803016, -0.427135,
-    0.000000, 1.000000,
-    -0.446977, -0.816233, -0.366027,
-    0.500000, 0.133975,
-    -0.375039, -0.843911, -0.383614,
-    1.000000, 1.000000,
-    -0.342848, -0.828447, -0.442867,
-    0.000000, 1.000000,
-    -0.415597, -0.803016, -0.427135,
-    0.500000, 0.133975,
-    -0.375039, -0.843911, -0.383614,
-    1.000000, 1.000000,
-    -0.486240, -0.772575, -0.408286,
-    0.000000, 1.000000,
-    -0.553372, -0.737712, -0.386730,
-    0.500000, 0.133975,
-    -0.516122, -0.783452, -0.346153,
-    1.000000, 1.000000,
-    -0.678913, -0.653497, -0.334692,
-    0.000000, 1.000000,
-    -0.705236, -0.656620, -0.267381,
-    0.500000, 0.133975,
-    -0.647412, -0.702310, -0.296005,
-    1.000000, 1.000000,
-    -0.619186, -0.697037, -0.361592,
-    0.000000, 1.000000,
-    -0.678913, -0.653497, -0.334692,
-    0.500000, 0.133975,
-    -0.647412, -0.702310, -0.296005,
-    1.000000, 1.000000,
-    -0.734794, -0.605741, -0.305212,
-    0.000000, 1.000000,
-    -0.785715, -0.554740, -0.273707,
-    0.500000, 0.133975,
-    -0.758652, -0.606825, -0.237086,
-    1.000000, 1.000000,
-    0.745338, -0.322141, -0.583691,
-    0.000000, 1.000000,
-    0.749435, -0.255180, -0.610926,
-    0.500000, 0.133975,
-    0.702310, -0.296005, -0.647412,
-    1.000000, 1.000000,
-    0.697037, -0.361592, -0.619186,
-    0.000000, 1.000000,
-    0.745338, -0.322141, -0.583691,
-    0.500000, 0.133975,
-    0.702310, -0.296005, -0.647412,
-    1.000000, 1.000000,
-    0.790112, -0.280319, -0.545109,
-    0.000000, 1.000000,
-    0.830359, -0.237229, -0.504209,
-    0.500000, 0.133975,
-    0.792649, -0.213023, -0.571252,
-    1.000000, 1.000000,
-    0.605741, -0.305212, -0.734794,
-    0.000000, 1.000000,
-    0.656620, -0.267381, -0.705236,
-    0.500000, 0.133975,
-    0.606825, -0.237086, -0.758652,
-    1.000000, 1.000000,
-    0.554740, -0.273707, -0.785715,
-    0.000000, 1.000000,
-    0.605741, -0.305212, -0.734794,
-    0.500000, 0.133975,
-    0.606825, -0.237086, -0.758652,
-    1.000000, 1.000000,
-    0.653497, -0.334692, -0.678913,
-    0.000000, 1.000000,
-    0.697037, -0.361592, -0.619186,
-    0.500000, 0.133975,
-    0.702310, -0.296005, -0.647412,
-    1.000000, 1.000000,
-    0.772575, -0.408286, -0.486240,
-    0.000000, 1.000000,
-    0.816233, -0.366027, -0.446977,
-    0.500000, 0.133975,
-    0.783452, -0.346153, -0.516122,
-    1.000000, 1.000000,
-    0.737712, -0.386730, -0.553372,
-    0.000000, 1.000000,
-    0.772575, -0.408286, -0.486240,
-    0.500000, 0.133975,
-    0.783452, -0.346153, -0.516122,
-    1.000000, 1.000000,
-    0.803016, -0.427135, -0.415597,
-    0.000000, 1.000000,
-    0.828447, -0.442867, -0.342848,
-    0.500000, 0.133975,
-    0.843911, -0.383614, -0.375039,
-    1.000000, 1.000000,
-    -0.745338, -0.322141, 0.583691,
-    0.000000, 1.000000,
-    -0.749435, -0.255180, 0.610926,
-    0.500000, 0.133975,
-    -0.702310, -0.296005, 0.647412,
-    1.000000, 1.000000,
-    -0.697037, -0.361592, 0.619186,
-    0.000000, 1.000000,
-    -0.745338, -0.322141, 0.583691,
-    0.500000, 0.133975,
-    -0.702310, -0.296005, 0.647412,
-    1.000000, 1.000000,
-    -0.790112, -0.280319, 0.545109,
-    0.000000, 1.000000,
-    -0.830359, -0.237229, 0.504209,
-    0.500000, 0.133975,
-    -0.792649, -0.213023, 0.571252,
-    1.000000, 1.000000,
-    -0.605741, -0.305212, 0.734794,
-    0.000000, 1.000000,
-    -0.656620, -0.267381, 0.705236,
-    0.500000, 0.133975,
-    -0.606825, -0.237086, 0.758652,
-    1.000000, 1.000000,
-    -0.554740, -0.273707, 0.785715,
-    0.000000, 1.000000,
-    -0.605741, -0.305212, 0.734794,
-    0.500000, 0.133975,
-    -0.606825, -0.237086, 0.758652,
-    1.000000, 1.000000,
-    -0.653497, -0.334692, 0.678913,
-    0.000000, 1.000000,
-    -0.697037, -0.361592, 0.619186,
-    0.500000, 0.133975,
-    -0.702310, -0.296005, 0.647412,
-    1.000000, 1.000000,
-    -0.772575, -0.408286, 0.486240,
-    0.000000, 1.000000,
-    -0.816233, -0.366027, 0.446977,
-    0.500000, 0.133975,
-    -0.783452, -0.346153, 0.516122,
-    1.000000, 1.000000,
-    -0.737712, -0.386730, 0.553372,
-    0.000000, 1.000000,
-    -0.772575, -0.408286, 0.486240,
-    0.500000, 0.133975,
-    -0.783452, -0.346153, 0.516122,
-    1.000000, 1.000000,
-    -0.803016, -0.427135, 0.415597,
-    0.000000, 1.000000,
-    -0.828447, -0.442867, 0.342848,
-    0.500000, 0.133975,
-    -0.843911, -0.383614, 0.375039,
-    1.000000, 1.000000,
-    0.583691, -0.745338, 0.322141,
-    0.000000, 1.000000,
-    0.545109, -0.790112, 0.280319,
-    0.500000, 0.133975,
-    0.516122, -0.783452, 0.346153,
-    1.000000, 1.000000,
-    0.553372, -0.737712, 0.386730,
-    0.000000, 1.000000,
-    0.583691, -0.745338, 0.322141,
-    0.500000, 0.133975,
-    0.516122, -0.783452, 0.346153,
-    1.000000, 1.000000,
-    0.610926, -0.749435, 0.255180,
-    0.000000, 1.000000,
-    0.634579, -0.749786, 0.187432,
-    0.500000, 0.133975,
-    0.571252, -0.792649, 0.213023,
-    1.000000, 1.000000,
-    0.415597, -0.803016, 0.427135,
-    0.000000, 1.000000,
-    0.446977, -0.816233, 0.366027,
-    0.500000, 0.133975,
-    0.375039, -0.843911, 0.383614,
-    1.000000, 1.000000,
-    0.342848, -0.828447, 0.442867,
-    0.000000, 1.000000,
-    0.415597, -0.803016, 0.427135,
-    0.500000, 0.133975,
-    0.375039, -0.843911, 0.383614,
-    1.000000, 1.000000,
-    0.486240, -0.772575, 0.408286,
-    0.000000, 1.000000,
-    0.553372, -0.737712, 0.386730,
-    0.500000, 0.133975,
-    0.516122, -0.783452, 0.346153,
-    1.000000, 1.000000,
-    0.678913, -0.653497, 0.334692,
-    0.000000, 1.000000,
-    0.705236, -0.656620, 0.267381,
-    0.500000, 0.133975,
-    0.647412, -0.702310, 0.296005,
-    1.000000, 1.000000,
-    0.619186, -0.697037, 0.361592,
-    0.000000, 1.000000,
-    0.678913, -0.653497, 0.334692,
-    0.500000, 0.133975,
-    0.647412, -0.702310, 0.296005,
-    1.000000, 1.000000,
-    0.734794, -0.605741, 0.305212,
-    0.000000, 1.000000,
-    0.785715, -0.554740, 0.273707,
-    0.500000, 0.133975,
-    0.758652, -0.606825, 0.237086,
-    1.000000, 1.000000,
-    -0.334140, -0.041302, 0.941618,
-    0.000000, 1.000000,
-    -0.334140, 0.041302, 0.941618,
-    0.500000, 0.133975,
-    -0.266405, 0.000000, 0.963861,
-    1.000000, 1.000000,
-    -0.265518, -0.081501, 0.960655,
-    0.000000, 1.000000,
-    -0.334140, -0.041302, 0.941618,
-    0.500000, 0.133975,
-    -0.266405, 0.000000, 0.963861,
-    1.000000, 1.000000,
-    -0.400968, 0.000000, 0.916092,
-    0.000000, 1.000000,
-    -0.464213, 0.041299, 0.884760,
-    0.500000, 0.133975,
-    -0.399607, 0.082324, 0.912982,
-    1.000000, 1.000000,
-    -0.133523, 0.000000, 0.991046,
-    0.000000, 1.000000,
-    -0.200368, 0.041251, 0.978852,
-    0.500000, 0.133975,
-    -0.133071, 0.082242, 0.987688,
-    1.000000, 1.000000,
-    -0.066741, 0.041248, 0.996917,
-    0.000000, 1.000000,
-    -0.133523, 0.000000, 0.991046,
-    0.500000, 0.133975,
-    -0.133071, 0.082242, 0.987688,
-    1.000000, 1.000000,
-    -0.200368, -0.041251, 0.978852,
-    0.000000, 1.000000,
-    -0.265518, -0.081501, 0.960655,
-    0.500000, 0.133975,
-    -0.266405, 0.000000, 0.963861,
-    1.000000, 1.000000,
-    -0.394136, -0.161006, 0.904839,
-    0.000000, 1.000000,
-    -0.460882, -0.119755, 0.879345,
-    0.500000, 0.133975,
-    -0.399607, -0.082324, 0.912982,
-    1.000000, 1.000000,
-    -0.332342, -0.122800, 0.935130,
-    0.000000, 1.000000,
-    -0.394136, -0.161006, 0.904839,
-    0.500000, 0.133975,
-    -0.399607, -0.082324, 0.912982,
-    1.000000, 1.000000,
-    -0.454262, -0.198227, 0.868534,
-    0.000000, 1.000000,
-    -0.511205, -0.233445, 0.827147,
-    0.500000, 0.133975,
-    -0.519258, -0.156434, 0.840178,
-    1.000000, 1.000000,
-    -0.066709, 0.110385, 0.991648,
-    0.000000, 1.000000,
-    -0.066741, 0.041248, 0.996917,
-    0.500000, 0.133975,
-    -0.133071, 0.082242, 0.987688,
-    1.000000, 1.000000,
-    -0.132570, -0.289929, 0.947822,
-    0.000000, 1.000000,
-    -0.199094, -0.261550, 0.944433,
-    0.500000, 0.133975,
-    -0.132792, -0.220117, 0.966393,
-    1.000000, 1.000000,
-    -0.066567, -0.247326, 0.966643,
-    0.000000, 1.000000,
-    -0.132570, -0.289929, 0.947822,
-    0.500000, 0.133975,
-    -0.132792, -0.220117, 0.966393,
-    1.000000, 1.000000,
-    -0.198387, -0.330607, 0.922682,
-    0.000000, 1.000000,
-    -0.262661, -0.368518, 0.891742,
-    0.500000, 0.133975,
-    -0.264083, -0.301259, 0.916244,
-    1.000000, 1.000000,
-    -0.066709, -0.110385, 0.991648,
-    0.000000, 1.000000,
-    -0.133256, -0.151549, 0.979426,
-    0.500000, 0.133975,
-    -0.133071, -0.082242, 0.987688,
-    1.000000, 1.000000,
-    -0.066741, -0.041248, 0.996917,
-    0.000000, 1.000000,
-    -0.066709, -0.110385, 0.991648,
-    0.500000, 0.133975,
-    -0.133071, -0.082242, 0.987688,
-    1.000000, 1.000000,
-    -0.066604, -0.179596, 0.981483,
-    0.000000, 1.000000,
-    -0.066567, -0.247326, 0.966643,
-    0.500000, 0.133975,
-    -0.132792, -0.220117, 0.966393,
-    1.000000, 1.000000,
-    -0.065988, -0.381722, 0.921919,
-    0.000000, 1.000000,
-    -0.131749, -0.422364, 0.896801,
-    0.500000, 0.133975,
-    -0.131655, -0.358229, 0.924305,
-    1.000000, 1.000000,
-    -0.066042, -0.316778, 0.946198,
-    0.000000, 1.000000,
-    -0.065988, -0.381722, 0.921919,
-    0.500000, 0.133975,
-    -0.131655, -0.358229, 0.924305,
-    1.000000, 1.000000,
-    -0.065817, -0.445365, 0.892927,
-    0.000000, 1.000000,
-    -0.065758, -0.506298, 0.859848,
-    0.500000, 0.133975,
-    -0.131200, -0.484442, 0.864929,
-    1.000000, 1.000000,
-    0.400968, 0.000000, 0.916092,
-    0.000000, 1.000000,
-    0.334140, 0.041302, 0.941618,
-    0.500000, 0.133975,
-    0.399607, 0.082324, 0.912982,
-    1.000000, 1.000000,
-    0.464213, 0.041299, 0.884760,
-    0.000000, 1.000000,
-    0.400968, 0.000000, 0.916092,
-    0.500000, 0.133975,
-    0.399607, 0.082324, 0.912982,
-    1.000000, 1.000000,
-    0.334140, -0.041302, 0.941618,
-    0.000000, 1.000000,
-    0.265518, -0.081501, 0.960655,
-    0.500000, 0.133975,
-    0.266405, 0.000000, 0.963861,
-    1.000000, 1.000000,
-    0.460882, 0.119755, 0.879345,
-    0.000000, 1.000000,
-    0.464213, 0.041299, 0.884760,
-    0.500000, 0.133975,
-    0.399607, 0.082324, 0.912982,
-    1.000000, 1.000000,
-    0.460882, -0.119755, 0.879345,
-    0.000000, 1.000000,
-    0.394136, -0.161006, 0.904839,
-    0.500000, 0.133975,
-    0.399607, -0.082324, 0.912982,
-    1.000000, 1.000000,
-    0.464213, -0.041299, 0.884760,
-    0.000000, 1.000000,
-    0.460882, -0.119755, 0.879345,
-    0.500000, 0.133975,
-    0.399607, -0.082324, 0.912982,
-    1.000000, 1.000000,
-    0.454262, -0.198227, 0.868534,
-    0.000000, 1.000000,
-    0.444464, -0.274694, 0.852640,
-    0.500000, 0.133975,
-    0.386187, -0.238677, 0.891007,
-    1.000000, 1.000000,
-    0.667502, 0.040677, 0.743496,
-    0.000000, 1.000000,
-    0.622292, 0.000000, 0.782786,
-    0.500000, 0.133975,
-    0.620240, 0.081142, 0.780204,
-    1.000000, 1.000000,
-    0.662842, 0.121193, 0.738886,
-    0.000000, 1.000000,
-    0.667502, 0.040677, 0.743496,
-    0.500000, 0.133975,
-    0.620240, 0.081142, 0.780204,
-    1.000000, 1.000000,
-    0.667502, -0.040677, 0.743496,
-    0.000000, 1.000000,
-    0.662842, -0.121193, 0.738886,
-    0.500000, 0.133975,
-    0.620240, -0.081142, 0.780204,
-    1.000000, 1.000000,
-    0.749387, 0.040642, 0.660884,
-    0.000000, 1.000000,
-    0.749387, -0.040642, 0.660884,
-    0.500000, 0.133975,
-    0.711282, 0.000000, 0.702907,
-    1.000000, 1.000000,
-    0.708969, 0.080573, 0.700622,
-    0.000000, 1.000000,
-    0.749387, 0.040642, 0.660884,
-    0.500000, 0.133975,
-    0.711282, 0.000000, 0.702907,
-    1.000000, 1.000000,
-    0.786433, 0.000000, 0.617676,
-    0.000000, 1.000000,
-    0.819207, -0.040640, 0.572056,
-    0.500000, 0.133975,
-    0.783843, -0.081086, 0.615642,
-    1.000000, 1.000000,
-    0.334140, -0.041302, -0.941618,
-    0.000000, 1.000000,
-    0.334140, 0.041302, -0.941618,
-    0.500000, 0.133975,
-    0.266405, 0.000000, -0.963861,
-    1.000000, 1.000000,
-    0.265518, -0.081501, -0.960655,
-    0.000000, 1.000000,
-    0.334140, -0.041302, -0.941618,
-    0.500000, 0.133975,
-    0.266405, 0.000000, -0.963861,
-    1.000000, 1.000000,
-    0.400968, 0.000000, -0.916092,
-    0.000000, 1.000000,
-    0.464213, 0.041299, -0.884760,
-    0.500000, 0.133975,
-    0.399607, 0.082324, -0.912982,
-    1.000000, 1.000000,
-    0.133523, 0.000000, -0.991046,
-    0.000000, 1.000000,
-    0.200368, 0.041251, -0.978852,
-    0.500000, 0.133975,
-    0.133071, 0.082242, -0.987688,
-    1.000000, 1.000000,
-    0.066741, 0.041248, -0.996917,
-    0.000000, 1.000000,
-    0.133523, 0.000000, -0.991046,
-    0.500000, 0.133975,
-    0.133071, 0.082242, -0.987688,
-    1.000000, 1.000000,
-    0.200368, -0.041251, -0.978852,
-    0.000000, 1.000000,
-    0.265518, -0.081501, -0.960655,
-    0.500000, 0.133975,
-    0.266405, 0.000000, -0.963861,
-    1.000000, 1.000000,
-    0.394136, -0.161006, -0.904839,
-    0.000000, 1.000000,
-    0.460882, -0.119755, -0.879345,
-    0.500000, 0.133975,
-    0.399607, -0.082324, -0.912982,
-    1.000000, 1.000000,
-    0.332342, -0.122800, -0.935130,
-    0.000000, 1.000000,
-    0.394136, -0.161006, -0.904839,
-    0.500000, 0.133975,
-    0.399607, -0.082324, -0.912982,
-    1.000000, 1.000000,
-    0.454262, -0.198227, -0.868534,
-    0.000000, 1.000000,
-    0.511205, -0.233445, -0.827147,
-    0.500000, 0.133975,
-    0.519258, -0.156434, -0.840178,
-    1.000000, 1.000000,
-    0.066709, 0.110385, -0.991648,
-    0.000000, 1.000000,
-    0.066741, 0.041248, -0.996917,
-    0.500000, 0.133975,
-    0.133071, 0.082242, -0.987688,
-    1.000000, 1.000000,
-    0.132570, -0.289929, -0.947822,
-    0.000000, 1.000000,
-    0.199094, -0.261550, -0.944433,
-    0.500000, 0.133975,
-    0.132792, -0.220117, -0.966393,
-    1.000000, 1.000000,
-    0.066567, -0.247326, -0.966643,
-    0.000000, 1.000000,
-    0.132570, -0.289929, -0.947822,
-    0.500000, 0.133975,
-    0.132792, -0.220117, -0.966393,
-    1.000000, 1.000000,
-    0.198387, -0.330607, -0.922682,
-    0.000000, 1.000000,
-    0.262661, -0.368518, -0.891742,
-    0.500000, 0.133975,
-    0.264083, -0.301259, -0.916244,
-    1.000000, 1.000000,
-    0.066709, -0.110385, -0.991648,
-    0.000000, 1.000000,
-    0.133256, -0.151549, -0.979426,
-    0.500000, 0.133975,
-    0.133071, -0.082242, -0.987688,
-    1.000000, 1.000000,
-    0.066741, -0.041248, -0.996917,
-    0.000000, 1.000000,
-    0.066709, -0.110385, -0.991648,
-    0.500000, 0.133975,
-    0.133071, -0.082242, -0.987688,
-    1.000000, 1.000000,
-    0.066604, -0.179596, -0.981483,
-    0.000000, 1.000000,
-    0.066567, -0.247326, -0.966643,
-    0.500000, 0.133975,
-    0.132792, -0.220117, -0.966393,
-    1.000000, 1.000000,
-    0.065988, -0.381722, -0.921919,
-    0.000000, 1.000000,
-    0.131749, -0.422364, -0.896801,
-    0.500000, 0.133975,
-    0.131655, -0.358229, -0.924305,
-    1.000000, 1.000000,
-    0.066042, -0.316778, -0.946198,
-    0.000000, 1.000000,
-    0.065988, -0.381722, -0.921919,
-    0.500000, 0.133975,
-    0.131655, -0.358229, -0.924305,
-    1.000000, 1.000000,
-    0.065817, -0.445365, -0.892927,
-    0.000000, 1.000000,
-    0.065758, -0.506298, -0.859848,
-    0.500000, 0.133975,
-    0.131200, -0.484442, -0.864929,
-    1.000000, 1.000000,
-    -0.400968, 0.000000, -0.916092,
-    0.000000, 1.000000,
-    -0.334140, 0.041302, -0.941618,
-    0.500000, 0.133975,
-    -0.399607, 0.082324, -0.912982,
-    1.000000, 1.000000,
-    -0.464213, 0.041299, -0.884760,
-    0.000000, 1.000000,
-    -0.400968, 0.000000, -0.916092,
-    0.500000, 0.133975,
-    -0.399607, 0.082324, -0.912982,
-    1.000000, 1.000000,
-    -0.334140, -0.041302, -0.941618,
-    0.000000, 1.000000,
-    -0.265518, -0.081501, -0.960655,
-    0.500000, 0.133975,
-    -0.266405, 0.000000, -0.963861,
-    1.000000, 1.000000,
-    -0.460882, 0.119755, -0.879345,
-    0.000000, 1.000000,
-    -0.464213, 0.041299, -0.884760,
-    0.500000, 0.133975,
-    -0.399607, 0.082324, -0.912982,
-    1.000000, 1.000000,
-    -0.460882, -0.119755, -0.879345,
-    0.000000, 1.000000,
-    -0.394136, -0.161006, -0.904839,
-    0.500000, 0.133975,
-    -0.399607, -0.082324, -0.912982,
-    1.000000, 1.000000,
-    -0.464213, -0.041299, -0.884760,
-    0.000000, 1.000000,
-    -0.460882, -0.119755, -0.879345,
-    0.500000, 0.133975,
-    -0.399607, -0.082324, -0.912982,
-    1.000000, 1.000000,
-    -0.454262, -0.198227, -0.868534,
-    0.000000, 1.000000,
-    -0.444464, -0.274694, -0.852640,
-    0.500000, 0.133975,
-    -0.386187, -0.238677, -0.891007,
-    1.000000, 1.000000,
-    -0.667502, 0.040677, -0.743496,
-    0.000000, 1.000000,
-    -0.622292, 0.000000, -0.782786,
-    0.500000, 0.133975,
-    -0.620240, 0.081142, -0.780204,
-    1.000000, 1.000000,
-    -0.662842, 0.121193, -0.738886,
-    0.000000, 1.000000,
-    -0.667502, 0.040677, -0.743496,
-    0.500000, 0.133975,
-    -0.620240, 0.081142, -0.780204,
-    1.000000, 1.000000,
-    -0.667502, -0.040677, -0.743496,
-    0.000000, 1.000000,
-    -0.662842, -0.121193, -0.738886,
-    0.500000, 0.133975,
-    -0.620240, -0.081142, -0.780204,
-    1.000000, 1.000000,
-    -0.749387, 0.040642, -0.660884,
-    0.000000, 1.000000,
-    -0.749387, -0.040642, -0.660884,
-    0.500000, 0.133975,
-    -0.711282, 0.000000, -0.702907,
-    1.000000, 1.000000,
-    -0.708969, 0.080573, -0.700622,
-    0.000000, 1.000000,
-    -0.749387, 0.040642, -0.660884,
-    0.500000, 0.133975,
-    -0.711282, 0.000000, -0.702907,
-    1.000000, 1.000000,
-    -0.786433, 0.000000, -0.617676,
-    0.000000, 1.000000,
-    -0.819207, -0.040640, -0.572056,
-    0.500000, 0.133975,
-    -0.783843, -0.081086, -0.615642,
-    1.000000, 1.000000,
-    0.041302, -0.941618, 0.334140,
-    0.000000, 1.000000,
-    0.000000, -0.916092, 0.400968,
-    0.500000, 0.133975,
-    0.082324, -0.912982, 0.399607,
-    1.000000, 1.000000,
-    0.122800, -0.935130, 0.332342,
-    0.000000, 1.000000,
-    0.041302, -0.941618, 0.334140,
-    0.500000, 0.133975,
-    0.082324, -0.912982, 0.399607,
-    1.000000, 1.000000,
-    -0.041302, -0.941618, 0.334140,
-    0.000000, 1.000000,
-    -0.122800, -0.935130, 0.332342,
-    0.500000, 0.133975,
-    -0.082324, -0.912982, 0.399607,
-    1.000000, 1.000000,
-    0.198227, -0.868534, 0.454262,
-    0.000000, 1.000000,
-    0.119755, -0.879345, 0.460882,
-    0.500000, 0.133975,
-    0.156434, -0.840178, 0.519258,
-    1.000000, 1.000000,
-    0.233445, -0.827147, 0.511205,
-    0.000000, 1.000000,
-    0.198227, -0.868534, 0.454262,
-    0.500000, 0.133975,
-    0.156434, -0.840178, 0.519258,
-    1.000000, 1.000000,
-    0.161006, -0.904839, 0.394136,
-    0.000000, 1.000000,
-    0.122800, -0.935130, 0.332342,
-    0.500000, 0.133975,
-    0.082324, -0.912982, 0.399607,
-    1.000000, 1.000000,
-    0.041251, -0.978852, 0.200368,
-    0.000000, 1.000000,
-    -0.041251, -0.978852, 0.200368,
-    0.500000, 0.133975,
-    0.000000, -0.963861, 0.266405,
-    1.000000, 1.000000,
-    0.081501, -0.960655, 0.265518,
-    0.000000, 1.000000,
-    0.041251, -0.978852, 0.200368,
-    0.500000, 0.133975,
-    0.000000, -0.963861, 0.266405,
-    1.000000, 1.000000,
-    0.000000, -0.991046, 0.133523,
-    0.000000, 1.000000,
-    -0.041248, -0.996917, 0.066741,
-    0.500000, 0.133975,
-    -0.082242, -0.987688, 0.133071,
-    1.000000, 1.000000,
-    0.040677, -0.743496, 0.667502,
-    0.000000, 1.000000,
-    -0.040677, -0.743496, 0.667502,
-    0.500000, 0.133975,
-    0.000000, -0.702907, 0.711282,
-    1.000000, 1.000000,
-    0.080573, -0.700622, 0.708969,
-    0.000000, 1.000000,
-    0.040677, -0.743496, 0.667502,
-    0.500000, 0.133975,
-    0.000000, -0.702907, 0.711282,
-    1.000000, 1.000000,
-    0.000000, -0.782786, 0.622292,
-    0.000000, 1.000000,
-    -0.040675, -0.817523, 0.574458,
-    0.500000, 0.133975,
-    -0.081142, -0.780204, 0.620240,
-    1.000000, 1.000000,
-    0.000000, -0.617676, 0.786433,
-    0.000000, 1.000000,
-    -0.040642, -0.660884, 0.749387,
-    0.500000, 0.133975,
-    -0.081086, -0.615642, 0.783843,
-    1.000000, 1.000000,
-    -0.040640, -0.572056, 0.819207,
-    0.000000, 1.000000,
-    0.000000, -0.617676, 0.786433,
-    0.500000, 0.133975,
-    -0.081086, -0.615642, 0.783843,
-    1.000000, 1.000000,
-    0.040642, -0.660884, 0.749387,
-    0.000000, 1.000000,
-    0.080573, -0.700622, 0.708969,
-    0.500000, 0.133975,
-    0.000000, -0.702907, 0.711282,
-    1.000000, 1.000000,
-    0.159613, -0.771841, 0.615456,
-    0.000000, 1.000000,
-    0.119078, -0.812169, 0.571140,
-    0.500000, 0.133975,
-    0.081142, -0.780204, 0.620240,
-    1.000000, 1.000000,
-    0.121193, -0.738886, 0.662842,
-    0.000000, 1.000000,
-    0.159613, -0.771841, 0.615456,
-    0.500000, 0.133975,
-    0.081142, -0.780204, 0.620240,
-    1.000000, 1.000000,
-    0.197274, -0.801504, 0.564513,
-    0.000000, 1.000000,
-    0.233445, -0.827147, 0.511205,
-    0.500000, 0.133975,
-    0.156434, -0.840178, 0.519258,
-    1.000000, 1.000000,
-    0.330607, -0.922682, 0.198387,
-    0.000000, 1.000000,
-    0.261550, -0.944433, 0.199094,
-    0.500000, 0.133975,
-    0.301259, -0.916244, 0.264083,
-    1.000000, 1.000000,
-    0.368518, -0.891742, 0.262661,
-    0.000000, 1.000000,
-    0.330607, -0.922682, 0.198387,
-    0.500000, 0.133975,
-    0.301259, -0.916244, 0.264083,
-    1.000000, 1.000000,
-    0.289929, -0.947822, 0.132570,
-    0.000000, 1.000000,
-    0.247326, -0.966643, 0.066567,
-    0.500000, 0.133975,
-    0.220117, -0.966393, 0.132792,
-    1.000000, 1.000000,
-    0.307659, -0.869725, 0.385906,
-    0.000000, 1.000000,
-    0.270627, -0.905832, 0.325929,
-    0.500000, 0.133975,
-    0.238677, -0.891007, 0.386187,
-    1.000000, 1.000000,
-    0.274694, -0.852640, 0.444464,
-    0.000000, 1.000000,
-    0.307659, -0.869725, 0.385906,
-    0.500000, 0.133975,
-    0.238677, -0.891007, 0.386187,
-    1.000000, 1.000000,
-    0.339209, -0.882837, 0.324864,
-    0.000000, 1.000000,
-    0.368518, -0.891742, 0.262661,
-    0.500000, 0.133975,
-    0.301259, -0.916244, 0.264083,
-    1.000000, 1.000000,
-    0.422364, -0.896801, 0.131749,
-    0.000000, 1.000000,
-    0.381722, -0.921919, 0.065988,
-    0.500000, 0.133975,
-    0.358229, -0.924305, 0.131655,
-    1.000000, 1.000000,
-    0.397351, -0.896401, 0.196412,
-    0.000000, 1.000000,
-    0.422364, -0.896801, 0.131749,
-    0.500000, 0.133975,
-    0.358229, -0.924305, 0.131655,
-    1.000000, 1.000000,
-    0.445365, -0.892927, 0.065817,
-    0.000000, 1.000000,
-    0.465658, -0.884965, 0.000000,
-    0.500000, 0.133975,
-    0.403355, -0.915043, 0.000000,
-    1.000000, 1.000000,
-    -0.041302, -0.941618, -0.334140,
-    0.000000, 1.000000,
-    0.000000, -0.916092, -0.400968,
-    0.500000, 0.133975,
-    -0.082324, -0.912982, -0.399607,
-    1.000000, 1.000000,
-    -0.122800, -0.935130, -0.332342,
-    0.000000, 1.000000,
-    -0.041302, -0.941618, -0.334140,
-    0.500000, 0.133975,
-    -0.082324, -0.912982, -0.399607,
-    1.000000, 1.000000,
-    0.041302, -0.941618, -0.334140,
-    0.000000, 1.000000,
-    0.122800, -0.935130, -0.332342,
-    0.500000, 0.133975,
-    0.082324, -0.912982, -0.399607,
-    1.000000, 1.000000,
-    -0.198227, -0.868534, -0.454262,
-    0.000000, 1.000000,
-    -0.119755, -0.879345, -0.460882,
-    0.500000, 0.133975,
-    -0.156434, -0.840178, -0.519258,
-    1.000000, 1.000000,
-    -0.233445, -0.827147, -0.511205,
-    0.000000, 1.000000,
-    -0.198227, -0.868534, -0.454262,
-    0.500000, 0.133975,
-    -0.156434, -0.840178, -0.519258,
-    1.000000, 1.000000,
-    -0.161006, -0.904839, -0.394136,
-    0.000000, 1.000000,
-    -0.122800, -0.935130, -0.332342,
-    0.500000, 0.133975,
-    -0.082324, -0.912982, -0.399607,
-    1.000000, 1.000000,
-    -0.041251, -0.978852, -0.200368,
-    0.000000, 1.000000,
-    0.041251, -0.978852, -0.200368,
-    0.500000, 0.133975,
-    0.000000, -0.963861, -0.266405,
-    1.000000, 1.000000,
-    -0.081501, -0.960655, -0.265518,
-    0.000000, 1.000000,
-    -0.041251, -0.978852, -0.200368,
-    0.500000, 0.133975,
-    0.000000, -0.963861, -0.266405,
-    1.000000, 1.000000,
-    0.000000, -0.991046, -0.133523,
-    0.000000, 1.000000,
-    0.041248, -0.996917, -0.066741,
-    0.500000, 0.133975,
-    0.082242, -0.987688, -0.133071,
-    1.000000, 1.000000,
-    -0.040677, -0.743496, -0.667502,
-    0.000000, 1.000000,
-    0.040677, -0.743496, -0.667502,
-    0.500000, 0.133975,
-    0.000000, -0.702907, -0.711282,
-    1.000000, 1.000000,
-    -0.080573, -0.700622, -0.708969,
-    0.000000, 1.000000,
-    -0.040677, -0.743496, -0.667502,
-    0.500000, 0.133975,
-    0.000000, -0.702907, -0.711282,
-    1.000000, 1.000000,
-    0.000000, -0.782786, -0.622292,
-    0.000000, 1.000000,
-    0.040675, -0.817523, -0.574458,
-    0.500000, 0.133975,
-    0.081142, -0.780204, -0.620240,
-    1.000000, 1.000000,
-    0.000000, -0.617676, -0.786433,
-    0.000000, 1.000000,
-    0.040642, -0.660884, -0.749387,
-    0.500000, 0.133975,
-    0.081086, -0.615642, -0.783843,
-    1.000000, 1.000000,
-    0.040640, -0.572056, -0.819207,
-    0.000000, 1.000000,
-    0.000000, -0.617676, -0.786433,
-    0.500000, 0.133975,
-    0.081086, -0.615642, -0.783843,
-    1.000000, 1.000000,
-    -0.040642, -0.660884, -0.749387,
-    0.000000, 1.000000,
-    -0.080573, -0.700622, -0.708969,
-    0.500000, 0.133975,
-    0.000000, -0.702907, -0.711282,
-    1.000000, 1.000000,
-    -0.159613, -0.771841, -0.615456,
-    0.000000, 1.000000,
-    -0.119078, -0.812169, -0.571140,
-    0.500000, 0.133975,
-    -0.081142, -0.780204, -0.620240,
-    1.000000, 1.000000,
-    -0.121193, -0.738886, -0.662842,
-    0.000000, 1.000000,
-    -0.159613, -0.771841, -0.615456,
-    0.500000, 0.133975,
-    -0.081142, -0.780204, -0.620240,
-    1.000000, 1.000000,
-    -0.197274, -0.801504, -0.564513,
-    0.000000, 1.000000,
-    -0.233445, -0.827147, -0.511205,
-    0.500000, 0.133975,
-    -0.156434, -0.840178, -0.519258,
-    1.000000, 1.000000,
-    -0.330607, -0.922682, -0.198387,
-    0.000000, 1.000000,
-    -0.261550, -0.944433, -0.199094,
-    0.500000, 0.133975,
-    -0.301259, -0.916244, -0.264083,
-    1.000000, 1.000000,
-    -0.368518, -0.891742, -0.262661,
-    0.000000, 1.000000,
-    -0.330607, -0.922682, -0.198387,
-    0.500000, 0.133975,
-    -0.301259, -0.916244, -0.264083,
-    1.000000, 1.000000,
-    -0.289929, -0.947822, -0.132570,
-    0.000000, 1.000000,
-    -0.247326, -0.966643, -0.066567,
-    0.500000, 0.133975,
-    -0.220117, -0.966393, -0.132792,
-    1.000000, 1.000000,
-    -0.307659, -0.869725, -0.385906,
-    0.000000, 1.000000,
-    -0.270627, -0.905832, -0.325929,
-    0.500000, 0.133975,
-    -0.238677, -0.891007, -0.386187,
-    1.000000, 1.000000,
-    -0.274694, -0.852640, -0.444464,
-    0.000000, 1.000000,
-    -0.307659, -0.869725, -0.385906,
-    0.500000, 0.133975,
-    -0.238677, -0.891007, -0.386187,
-    1.000000, 1.000000,
-    -0.339209, -0.882837, -0.324864,
-    0.000000, 1.000000,
-    -0.368518, -0.891742, -0.262661,
-    0.500000, 0.133975,
-    -0.301259, -0.916244, -0.264083,
-    1.000000, 1.000000,
-    -0.422364, -0.896801, -0.131749,
-    0.000000, 1.000000,
-    -0.381722, -0.921919, -0.065988,
-    0.500000, 0.133975,
-    -0.358229, -0.924305, -0.131655,
-    1.000000, 1.000000,
-    -0.397351, -0.896401, -0.196412,
-    0.000000, 1.000000,
-    -0.422364, -0.896801, -0.131749,
-    0.500000, 0.133975,
-    -0.358229, -0.924305, -0.131655,
-    1.000000, 1.000000,
-    -0.445365, -0.892927, -0.065817,
-    0.000000, 1.000000,
-    -0.465658, -0.884965, 0.000000,
-    0.500000, 0.133975,
-    -0.403355, -0.915043, 0.000000,
-    1.000000, 1.000000,
-    -0.892927, 0.065817, 0.445365,
-    0.000000, 1.000000,
-    -0.884965, 0.000000, 0.465658,
-    0.500000, 0.133975,
-    -0.915043, 0.000000, 0.403355,
-    1.000000, 1.000000,
-    -0.941618, -0.334140, -0.041302,
-    0.000000, 1.000000,
-    -0.916092, -0.400968, 0.000000,
-    0.500000, 0.133975,
-    -0.912982, -0.399607, -0.082324,
-    1.000000, 1.000000,
-    -0.935130, -0.332342, -0.122800,
-    0.000000, 1.000000,
-    -0.941618, -0.334140, -0.041302,
-    0.500000, 0.133975,
-    -0.912982, -0.399607, -0.082324,
-    1.000000, 1.000000,
-    -0.941618, -0.334140, 0.041302,
-    0.000000, 1.000000,
-    -0.935130, -0.332342, 0.122800,
-    0.500000, 0.133975,
-    -0.912982, -0.399607, 0.082324,
-    1.000000, 1.000000,
-    -0.868534, -0.454262, -0.198227,
-    0.000000, 1.000000,
-    -0.879345, -0.460882, -0.119755,
-    0.500000, 0.133975,
-    -0.840178, -0.519258, -0.156434,
-    1.000000, 1.000000,
-    -0.827147, -0.511205, -0.233445,
-    0.000000, 1.000000,
-    -0.868534, -0.454262, -0.198227,
-    0.500000, 0.133975,
-    -0.840178, -0.519258, -0.156434,
-    1.000000, 1.000000,
-    -0.904839, -0.394136, -0.161006,
-    0.000000, 1.000000,
-    -0.935130, -0.332342, -0.122800,
-    0.500000, 0.133975,
-    -0.912982, -0.399607, -0.082324,
-    1.000000, 1.000000,
-    -0.978852, -0.200368, -0.041251,
-    0.000000, 1.000000,
-    -0.978852, -0.200368, 0.041251,
-    0.500000, 0.133975,
-    -0.963861, -0.266405, 0.000000,
-    1.000000, 1.000000,
-    -0.960655, -0.265518, -0.081501,
-    0.000000, 1.000000,
-    -0.978852, -0.200368, -0.041251,
-    0.500000, 0.133975,
-    -0.963861, -0.266405, 0.000000,
-    1.000000, 1.000000,
-    -0.991046, -0.133523, 0.000000,
-    0.000000, 1.000000,
-    -0.996917, -0.066741, 0.041248,
-    0.500000, 0.133975,
-    -0.987688, -0.133071, 0.082242,
-    1.000000, 1.000000,
-    -0.743496, -0.667502, -0.040677,
-    0.000000, 1.000000,
-    -0.743496, -0.667502, 0.040677,
-    0.500000, 0.133975,
-    -0.702907, -0.711282, 0.000000,
-    1.000000, 1.000000,
-    -0.700622, -0.708969, -0.080573,
-    0.000000, 1.000000,
-    -0.743496, -0.667502, -0.040677,
-    0.500000, 0.133975,
-    -0.702907, -0.711282, 0.000000,
-    1.000000, 1.000000,
-    -0.782786, -0.622292, 0.000000,
-    0.000000, 1.000000,
-    -0.817523, -0.574458, 0.040675,
-    0.500000, 0.133975,
-    -0.780204, -0.620240, 0.081142,
-    1.000000, 1.000000,
-    -0.617676, -0.786433, 0.000000,
-    0.000000, 1.000000,
-    -0.660884, -0.749387, 0.040642,
-    0.500000, 0.133975,
-    -0.615642, -0.783843, 0.081086,
-    1.000000, 1.000000,
-    -0.572056, -0.819207, 0.040640,
-    0.000000, 1.000000,
-    -0.617676, -0.786433, 0.000000,
-    0.500000, 0.133975,
-    -0.615642, -0.783843, 0.081086,
-    1.000000, 1.000000,
-    -0.660884, -0.749387, -0.040642,
-    0.000000, 1.000000,
-    -0.700622, -0.708969, -0.080573,
-    0.500000, 0.133975,
-    -0.702907, -0.711282, 0.000000,
-    1.000000, 1.000000,
-    -0.771841, -0.615456, -0.159613,
-    0.000000, 1.000000,
-    -0.812169, -0.571140, -0.119078,
-    0.500000, 0.133975,
-    -0.780204, -0.620240, -0.081142,
-    1.000000, 1.000000,
-    -0.738886, -0.662842, -0.121193,
-    0.000000, 1.000000,
-    -0.771841, -0.615456, -0.159613,
-    0.500000, 0.133975,
-    -0.780204, -0.620240, -0.081142,
-    1.000000, 1.000000,
-    -0.801504, -0.564513, -0.197274,
-    0.000000, 1.000000,
-    -0.827147, -0.511205, -0.233445,
-    0.500000, 0.133975,
-    -0.840178, -0.519258, -0.156434,
-    1.000000, 1.000000,
-    -0.922682, -0.198387, -0.330607,
-    0.000000, 1.000000,
-    -0.944433, -0.199094, -0.261550,
-    0.500000, 0.133975,
-    -0.916244, -0.264083, -0.301259,
-    1.000000, 1.000000,
-    -0.891742, -0.262661, -0.368518,
-    0.000000, 1.000000,
-    -0.922682, -0.198387, -0.330607,
-    0.500000, 0.133975,
-    -0.916244, -0.264083, -0.301259,
-    1.000000, 1.000000,
-    -0.947822, -0.132570, -0.289929,
-    0.000000, 1.000000,
-    -0.966643, -0.066567, -0.247326,
-    0.500000, 0.133975,
-    -0.966393, -0.132792, -0.220117,
-    1.000000, 1.000000,
-    -0.869725, -0.385906, -0.307659,
-    0.000000, 1.000000,
-    -0.905832, -0.325929, -0.270627,
-    0.500000, 0.133975,
-    -0.891007, -0.386187, -0.238677,
-    1.000000, 1.000000,
-    -0.852640, -0.444464, -0.274694,
-    0.000000, 1.000000,
-    -0.869725, -0.385906, -0.307659,
-    0.500000, 0.133975,
-    -0.891007, -0.386187, -0.238677,
-    1.000000, 1.000000,
-    -0.882837, -0.324864, -0.339209,
-    0.000000, 1.000000,
-    -0.891742, -0.262661, -0.368518,
-    0.500000, 0.133975,
-    -0.916244, -0.264083, -0.301259,
-    1.000000, 1.000000,
-    -0.896801, -0.131749, -0.422364,
-    0.000000, 1.000000,
-    -0.921919, -0.065988, -0.381722,
-    0.500000, 0.133975,
-    -0.924305, -0.131655, -0.358229,
-    1.000000, 1.000000,
-    -0.896401, -0.196412, -0.397351,
-    0.000000, 1.000000,
-    -0.896801, -0.131749, -0.422364,
-    0.500000, 0.133975,
-    -0.924305, -0.131655, -0.358229,
-    1.000000, 1.000000,
-    -0.892927, -0.065817, -0.445365,
-    0.000000, 1.000000,
-    -0.884965, 0.000000, -0.465658,
-    0.500000, 0.133975,
-    -0.915043, 0.000000, -0.403355,
-    1.000000, 1.000000,
-    0.892927, 0.065817, -0.445365,
-    0.000000, 1.000000,
-    0.884965, 0.000000, -0.465658,
-    0.500000, 0.133975,
-    0.915043, 0.000000, -0.403355,
-    1.000000, 1.000000,
-    0.941618, -0.334140, 0.041302,
-    0.000000, 1.000000,
-    0.916092, -0.400968, 0.000000,
-    0.500000, 0.133975,
-    0.912982, -0.399607, 0.082324,
-    1.000000, 1.000000,
-    0.935130, -0.332342, 0.122800,
-    0.000000, 1.000000,
-    0.941618, -0.334140, 0.041302,
-    0.500000, 0.133975,
-    0.912982, -0.399607, 0.082324,
-    1.000000, 1.000000,
-    0.941618, -0.334140, -0.041302,
-    0.000000, 1.000000,
-    0.935130, -0.332342, -0.122800,
-    0.500000, 0.133975,
-    0.912982, -0.399607, -0.082324,
-    1.000000, 1.000000,
-    0.868534, -0.454262, 0.198227,
-    0.000000, 1.000000,
-    0.879345, -0.460882, 0.119755,
-    0.500000, 0.133975,
-    0.840178, -0.519258, 0.156434,
-    1.000000, 1.000000,
-    0.827147, -0.511205, 0.233445,
-    0.000000, 1.000000,
-    0.868534, -0.454262, 0.198227,
-    0.500000, 0.133975,
-    0.840178, -0.519258, 0.156434,
-    1.000000, 1.000000,
-    0.904839, -0.394136, 0.161006,
-    0.000000, 1.000000,
-    0.935130, -0.332342, 0.122800,
-    0.500000, 0.133975,
-    0.912982, -0.399607, 0.082324,
-    1.000000, 1.000000,
-    0.978852, -0.200368, 0.041251,
-    0.000000, 1.000000,
-    0.978852, -0.200368, -0.041251,
-    0.500000, 0.133975,
-    0.963861, -0.266405, 0.000000,
-    1.000000, 1.000000,
-    0.960655, -0.265518, 0.081501,
-    0.000000, 1.000000,
-    0.978852, -0.200368, 0.041251,
-    0.500000, 0.133975,
-    0.963861, -0.266405, 0.000000,
-    1.000000, 1.000000,
-    0.991046, -0.133523, 0.000000,
-    0.000000, 1.000000,
-    0.996917, -0.066741, -0.041248,
-    0.500000, 0.133975,
-    0.987688, -0.133071, -0.082242,
-    1.000000, 1.000000,
-    0.743496, -0.667502, 0.040677,
-    0.000000, 1.000000,
-    0.743496, -0.667502, -0.040677,
-    0.500000, 0.133975,
-    0.702907, -0.711282, 0.000000,
-    1.000000, 1.000000,
-    0.700622, -0.708969, 0.080573,
-    0.000000, 1.000000,
-    0.743496, -0.667502, 0.040677,
-    0.500000, 0.133975,
-    0.702907, -0.711282, 0.000000,
-    1.000000, 1.000000,
-    0.782786, -0.622292, 0.000000,
-    0.000000, 1.000000,
-    0.817523, -0.574458, -0.040675,
-    0.500000, 0.133975,
-    0.780204, -0.620240, -0.081142,
-    1.000000, 1.000000,
-    0.617676, -0.786433, 0.000000,
-    0.000000, 1.000000,
-    0.660884, -0.749387, -0.040642,
-    0.500000, 0.133975,
-    0.615642, -0.783843, -0.081086,
-    1.000000, 1.000000,
-    0.572056, -0.819207, -0.040640,
-    0.000000, 1.000000,
-    0.617676, -0.786433, 0.000000,
-    0.500000, 0.133975,
-    0.615642, -0.783843, -0.081086,
-    1.000000, 1.000000,
-    0.660884, -0.749387, 0.040642,
-    0.000000, 1.000000,
-    0.700622, -0.708969, 0.080573,
-    0.500000, 0.133975,
-    0.702907, -0.711282, 0.000000,
-    1.000000, 1.000000,
-    0.771841, -0.615456, 0.159613,
-    0.000000, 1.000000,
-    0.812169, -0.571140, 0.119078,
-    0.500000, 0.133975,
-    0.780204, -0.620240, 0.081142,
-    1.000000, 1.000000,
-    0.738886, -0.662842, 0.121193,
-    0.000000, 1.000000,
-    0.771841, -0.615456, 0.159613,
-    0.500000, 0.133975,
-    0.780204, -0.620240, 0.081142,
-    1.000000, 1.000000,
-    0.801504, -0.564513, 0.197274,
-    0.000000, 1.000000,
-    0.827147, -0.511205, 0.233445,
-    0.500000, 0.133975,
-    0.840178, -0.519258, 0.156434,
-    1.000000, 1.000000,
-    0.922682, -0.198387, 0.330607,
-    0.000000, 1.000000,
-    0.944433, -0.199094, 0.261550,
-    0.500000, 0.133975,
-    0.916244, -0.264083, 0.301259,
-    1.000000, 1.000000,
-    0.891742, -0.262661, 0.368518,
-    0.000000, 1.000000,
-    0.922682, -0.198387, 0.330607,
-    0.500000, 0.133975,
-    0.916244, -0.264083, 0.301259,
-    1.000000, 1.000000,
-    0.947822, -0.132570, 0.289929,
-    0.000000, 1.000000,
-    0.966643, -0.066567, 0.247326,
-    0.500000, 0.133975,
-    0.966393, -0.132792, 0.220117,
-    1.000000, 1.000000,
-    0.869725, -0.385906, 0.307659,
-    0.000000, 1.000000,
-    0.905832, -0.325929, 0.270627,
-    0.500000, 0.133975,
-    0.891007, -0.386187, 0.238677,
-    1.000000, 1.000000,
-    0.852640, -0.444464, 0.274694,
-    0.000000, 1.000000,
-    0.869725, -0.385906, 0.307659,
-    0.500000, 0.133975,
-    0.891007, -0.386187, 0.238677,
-    1.000000, 1.000000,
-    0.882837, -0.324864, 0.339209,
-    0.000000, 1.000000,
-    0.891742, -0.262661, 0.368518,
-    0.500000, 0.133975,
-    0.916244, -0.264083, 0.301259,
-    1.000000, 1.000000,
-    0.896801, -0.131749, 0.422364,
-    0.000000, 1.000000,
-    0.921919, -0.065988, 0.381722,
-    0.500000, 0.133975,
-    0.924305, -0.131655, 0.358229,
-    1.000000, 1.000000,
-    0.896401, -0.196412, 0.397351,
-    0.000000, 1.000000,
-    0.896801, -0.131749, 0.422364,
-    0.500000, 0.133975,
-    0.924305, -0.131655, 0.358229,
-    1.000000, 1.000000,
-    0.892927, -0.065817, 0.445365,
-    0.000000, 1.000000,
-    0.884965, 0.000000, 0.465658,
-    0.500000, 0.133975,
-    0.915043, 0.000000, 0.403355,
-    1.000000, 1.000000,
-    -0.607478, -0.540650, -0.581952,
-    0.000000, 1.000000,
-    -0.540650, -0.581952, -0.607478,
-    0.500000, 0.133975,
-    -0.564254, -0.513375, -0.646578,
-    1.000000, 1.000000,
-    -0.628313, -0.470917, -0.619242,
-    0.000000, 1.000000,
-    -0.607478, -0.540650, -0.581952,
-    0.500000, 0.133975,
-    -0.564254, -0.513375, -0.646578,
-    1.000000, 1.000000,
-    -0.581952, -0.607478, -0.540650,
-    0.000000, 1.000000,
-    -0.552418, -0.669612, -0.496441,
-    0.500000, 0.133975,
-    -0.513375, -0.646578, -0.564254,
-    1.000000, 1.000000,
-    -0.536784, -0.414273, -0.735011,
-    0.000000, 1.000000,
-    -0.517970, -0.485208, -0.704471,
-    0.500000, 0.133975,
-    -0.468430, -0.453990, -0.757935,
-    1.000000, 1.000000,
-    -0.485712, -0.382683, -0.785899,
-    0.000000, 1.000000,
-    -0.536784, -0.414273, -0.735011,
-    0.500000, 0.133975,
-    -0.468430, -0.453990, -0.757935,
-    1.000000, 1.000000,
-    -0.584716, -0.443957, -0.678977,
-    0.000000, 1.000000,
-    -0.628313, -0.470917, -0.619242,
-    0.500000, 0.133975,
-    -0.564254, -0.513375, -0.646578,
-    1.000000, 1.000000,
-    -0.704471, -0.517970, -0.485208,
-    0.000000, 1.000000,
-    -0.678977, -0.584716, -0.443957,
-    0.500000, 0.133975,
-    -0.646578, -0.564254, -0.513375,
-    1.000000, 1.000000,
-    -0.669612, -0.496441, -0.552418,
-    0.000000, 1.000000,
-    -0.704471, -0.517970, -0.485208,
-    0.500000, 0.133975,
-    -0.646578, -0.564254, -0.513375,
-    1.000000, 1.000000,
-    -0.735011, -0.536784, -0.414273,
-    0.000000, 1.000000,
-    -0.760406, -0.552454, -0.341435,
-    0.500000, 0.133975,
-    -0.707107, -0.601501, -0.371748,
-    1.000000, 1.000000,
-    -0.280319, -0.545109, -0.790112,
-    0.000000, 1.000000,
-    -0.255180, -0.610926, -0.749435,
-    0.500000, 0.133975,
-    -0.213023, -0.571252, -0.792649,
-    1.000000, 1.000000,
-    -0.237229, -0.504209, -0.830359,
-    0.000000, 1.000000,
-    -0.280319, -0.545109, -0.790112,
-    0.500000, 0.133975,
-    -0.213023, -0.571252, -0.792649,
-    1.000000, 1.000000,
-    -0.322141, -0.583691, -0.745338,
-    0.000000, 1.000000,
-    -0.361592, -0.619186, -0.697037,
-    0.500000, 0.133975,
-    -0.296005, -0.647412, -0.702310,
-    1.000000, 1.000000,
-    -0.106494, -0.551859, -0.827110,
-    0.000000, 1.000000,
-    -0.147414, -0.594895, -0.790170,
-    0.500000, 0.133975,
-    -0.081086, -0.615642, -0.783843,
-    1.000000, 1.000000,
-    -0.040640, -0.572056, -0.819207,
-    0.000000, 1.000000,
-    -0.106494, -0.551859, -0.827110,
-    0.500000, 0.133975,
-    -0.081086, -0.615642, -0.783843,
-    1.000000, 1.000000,
-    -0.172532, -0.529135, -0.830812,
-    0.000000, 1.000000,
-    -0.237229, -0.504209, -0.830359,
-    0.500000, 0.133975,
-    -0.213023, -0.571252, -0.792649,
-    1.000000, 1.000000,
-    -0.366027, -0.446977, -0.816233,
-    0.000000, 1.000000,
-    -0.408286, -0.486240, -0.772575,
-    0.500000, 0.133975,
-    -0.346153, -0.516122, -0.783452,
-    1.000000, 1.000000,
-    -0.303801, -0.476226, -0.825175,
-    0.000000, 1.000000,
-    -0.366027, -0.446977, -0.816233,
-    0.500000, 0.133975,
-    -0.346153, -0.516122, -0.783452,
-    1.000000, 1.000000,
-    -0.427135, -0.415597, -0.803016,
-    0.000000, 1.000000,
-    -0.485712, -0.382683, -0.785899,
-    0.500000, 0.133975,
-    -0.468430, -0.453990, -0.757935,
-    1.000000, 1.000000,
-    -0.749435, -0.255180, -0.610926,
-    0.000000, 1.000000,
-    -0.745338, -0.322141, -0.583691,
-    0.500000, 0.133975,
-    -0.702310, -0.296005, -0.647412,
-    1.000000, 1.000000,
-    -0.703983, -0.228900, -0.672319,
-    0.000000, 1.000000,
-    -0.749435, -0.255180, -0.610926,
-    0.500000, 0.133975,
-    -0.702310, -0.296005, -0.647412,
-    1.000000, 1.000000,
-    -0.790112, -0.280319, -0.545109,
-    0.000000, 1.000000,
-    -0.825175, -0.303801, -0.476226,
-    0.500000, 0.133975,
-    -0.783452, -0.346153, -0.516122,
-    1.000000, 1.000000,
-    -0.605741, -0.305212, -0.734794,
-    0.000000, 1.000000,
-    -0.653497, -0.334692, -0.678913,
-    0.500000, 0.133975,
-    -0.601501, -0.371748, -0.707107,
-    1.000000, 1.000000,
-    -0.552454, -0.341435, -0.760406,
-    0.000000, 1.000000,
-    -0.605741, -0.305212, -0.734794,
-    0.500000, 0.133975,
-    -0.601501, -0.371748, -0.707107,
-    1.000000, 1.000000,
-    -0.656620, -0.267381, -0.705236,
-    0.000000, 1.000000,
-    -0.703983, -0.228900, -0.672319,
-    0.500000, 0.133975,
-    -0.702310, -0.296005, -0.647412,
-    1.000000, 1.000000,
-    -0.790170, -0.147414, -0.594895,
-    0.000000, 1.000000,
-    -0.830812, -0.172532, -0.529135,
-    0.500000, 0.133975,
-    -0.792649, -0.213023, -0.571252,
-    1.000000, 1.000000,
-    -0.749786, -0.187432, -0.634579,
-    0.000000, 1.000000,
-    -0.790170, -0.147414, -0.594895,
-    0.500000, 0.133975,
-    -0.792649, -0.213023, -0.571252,
-    1.000000, 1.000000,
-    -0.827110, -0.106494, -0.551859,
-    0.000000, 1.000000,
-    -0.859848, -0.065758, -0.506298,
-    0.500000, 0.133975,
-    -0.864929, -0.131200, -0.484442,
-    1.000000, 1.000000,
-    0.581952, -0.607478, -0.540650,
-    0.000000, 1.000000,
-    0.540650, -0.581952, -0.607478,
-    0.500000, 0.133975,
-    0.513375, -0.646578, -0.564254,
-    1.000000, 1.000000,
-    0.552418, -0.669612, -0.496441,
-    0.000000, 1.000000,
-    0.581952, -0.607478, -0.540650,
-    0.500000, 0.133975,
-    0.513375, -0.646578, -0.564254,
-    1.000000, 1.000000,
-    0.607478, -0.540650, -0.581952,
-    0.000000, 1.000000,
-    0.628313, -0.470917, -0.619242,
-    0.500000, 0.133975,
-    0.564254, -0.513375, -0.646578,
-    1.000000, 1.000000,
-    0.414273, -0.735011, -0.536784,
-    0.000000, 1.000000,
-    0.443957, -0.678977, -0.584716,
-    0.500000, 0.133975,
-    0.371748, -0.707107, -0.601501,
-    1.000000, 1.000000,
-    0.341435, -0.760406, -0.552454,
-    0.000000, 1.000000,
-    0.414273, -0.735011, -0.536784,
-    0.500000, 0.133975,
-    0.371748, -0.707107, -0.601501,
-    1.000000, 1.000000,
-    0.485208, -0.704471, -0.517970,
-    0.000000, 1.000000,
-    0.552418, -0.669612, -0.496441,
-    0.500000, 0.133975,
-    0.513375, -0.646578, -0.564254,
-    1.000000, 1.000000,
-    0.678977, -0.584716, -0.443957,
-    0.000000, 1.000000,
-    0.704471, -0.517970, -0.485208,
-    0.500000, 0.133975,
-    0.646578, -0.564254, -0.513375,
-    1.000000, 1.000000,
-    0.619242, -0.628313, -0.470917,
-    0.000000, 1.000000,
-    0.678977, -0.584716, -0.443957,
-    0.500000, 0.133975,
-    0.646578, -0.564254, -0.513375,
-    1.000000, 1.000000,
-    0.735011, -0.536784, -0.414273,
-    0.000000, 1.000000,
-    0.785899, -0.485712, -0.382683,
-    0.500000, 0.133975,
-    0.757935, -0.468430, -0.453990,
-    1.000000, 1.000000,
-    0.255180, -0.610926, -0.749435,
-    0.000000, 1.000000,
-    0.280319, -0.545109, -0.790112,
-    0.500000, 0.133975,
-    0.213023, -0.571252, -0.792649,
-    1.000000, 1.000000,
-    0.187432, -0.634579, -0.749786,
-    0.000000, 1.000000,
-    0.255180, -0.610926, -0.749435,
-    0.500000, 0.133975,
-    0.213023, -0.571252, -0.792649,
-    1.000000, 1.000000,
-    0.322141, -0.583691, -0.745338,
-    0.000000, 1.000000,
-    0.386730, -0.553372, -0.737712,
-    0.500000, 0.133975,
-    0.346153, -0.516122, -0.783452,
-    1.000000, 1.000000,
-    0.106494, -0.551859, -0.827110,
-    0.000000, 1.000000,
-    0.172532, -0.529135, -0.830812,
-    0.500000, 0.133975,
-    0.131200, -0.484442, -0.864929,
-    1.000000, 1.000000,
-    0.065758, -0.506298, -0.859848,
-    0.000000, 1.000000,
-    0.106494, -0.551859, -0.827110,
-    0.500000, 0.133975,
-    0.131200, -0.484442, -0.864929,
-    1.000000, 1.000000,
-    0.147414, -0.594895, -0.790170,
-    0.000000, 1.000000,
-    0.187432, -0.634579, -0.749786,
-    0.500000, 0.133975,
-    0.213023, -0.571252, -0.792649,
-    1.000000, 1.000000,
-    0.267381, -0.705236, -0.656620,
-    0.000000, 1.000000,
-    0.334692, -0.678913, -0.653497,
-    0.500000, 0.133975,
-    0.296005, -0.647412, -0.702310,
-    1.000000, 1.000000,
-    0.228900, -0.672319, -0.703983,
-    0.000000, 1.000000,
-    0.267381, -0.705236, -0.656620,
-    0.500000, 0.133975,
-    0.296005, -0.647412, -0.702310,
-    1.000000, 1.000000,
-    0.305212, -0.734794, -0.605741,
-    0.000000, 1.000000,
-    0.341435, -0.760406, -0.552454,
-    0.500000, 0.133975,
-    0.371748, -0.707107, -0.601501,
-    1.000000, 1.000000,
-    0.545109, -0.790112, -0.280319,
-    0.000000, 1.000000,
-    0.583691, -0.745338, -0.322141,
-    0.500000, 0.133975,
-    0.516122, -0.783452, -0.346153,
-    1.000000, 1.000000,
-    0.476226, -0.825175, -0.303801,
-    0.000000, 1.000000,
-    0.545109, -0.790112, -0.280319,
-    0.500000, 0.133975,
-    0.516122, -0.783452, -0.346153,
-    1.000000, 1.000000,
-    0.610926, -0.749435, -0.255180,
-    0.000000, 1.000000,
-    0.672319, -0.703983, -0.228900,
-    0.500000, 0.133975,
-    0.647412, -0.702310, -0.296005,
-    1.000000, 1.000000,
-    0.415597, -0.803016, -0.427135,
-    0.000000, 1.000000,
-    0.486240, -0.772575, -0.408286,
-    0.500000, 0.133975,
-    0.453990, -0.757935, -0.468430,
-    1.000000, 1.000000,
-    0.382683, -0.785899, -0.485712,
-    0.000000, 1.000000,
-    0.415597, -0.803016, -0.427135,
-    0.500000, 0.133975,
-    0.453990, -0.757935, -0.468430,
-    1.000000, 1.000000,
-    0.446977, -0.816233, -0.366027,
-    0.000000, 1.000000,
-    0.476226, -0.825175, -0.303801,
-    0.500000, 0.133975,
-    0.516122, -0.783452, -0.346153,
-    1.000000, 1.000000,
-    0.529135, -0.830812, -0.172532,
-    0.000000, 1.000000,
-    0.594895, -0.790170, -0.147414,
-    0.500000, 0.133975,
-    0.571252, -0.792649, -0.213023,
-    1.000000, 1.000000,
-    0.504209, -0.830359, -0.237229,
-    0.000000, 1.000000,
-    0.529135, -0.830812, -0.172532,
-    0.500000, 0.133975,
-    0.571252, -0.792649, -0.213023,
-    1.000000, 1.000000,
-    0.551859, -0.827110, -0.106494,
-    0.000000, 1.000000,
-    0.572056, -0.819207, -0.040640,
-    0.500000, 0.133975,
-    0.615642, -0.783843, -0.081086,
-    1.000000, 1.000000,
-    -0.581952, -0.607478, 0.540650,
-    0.000000, 1.000000,
-    -0.540650, -0.581952, 0.607478,
-    0.500000, 0.133975,
-    -0.513375, -0.646578, 0.564254,
-    1.000000, 1.000000,
-    -0.552418, -0.669612, 0.496441,
-    0.000000, 1.000000,
-    -0.581952, -0.607478, 0.540650,
-    0.500000, 0.133975,
-    -0.513375, -0.646578, 0.564254,
-    1.000000, 1.000000,
-    -0.607478, -0.540650, 0.581952,
-    0.000000, 1.000000,
-    -0.628313, -0.470917, 0.619242,
-    0.500000, 0.133975,
-    -0.564254, -0.513375, 0.646578,
-    1.000000, 1.000000,
-    -0.414273, -0.735011, 0.536784,
-    0.000000, 1.000000,
-    -0.443957, -0.678977, 0.584716,
-    0.500000, 0.133975,
-    -0.371748, -0.707107, 0.601501,
-    1.000000, 1.000000,
-    -0.341435, -0.760406, 0.552454,
-    0.000000, 1.000000,
-    -0.414273, -0.735011, 0.536784,
-    0.500000, 0.133975,
-    -0.371748, -0.707107, 0.601501,
-    1.000000, 1.000000,
-    -0.485208, -0.704471, 0.517970,
-    0.000000, 1.000000,
-    -0.552418, -0.669612, 0.496441,
-    0.500000, 0.133975,
-    -0.513375, -0.646578, 0.564254,
-    1.000000, 1.000000,
-    -0.678977, -0.584716, 0.443957,
-    0.000000, 1.000000,
-    -0.704471, -0.517970, 0.485208,
-    0.500000, 0.133975,
-    -0.646578, -0.564254, 0.513375,
-    1.000000, 1.000000,
-    -0.619242, -0.628313, 0.470917,
-    0.000000, 1.000000,
-    -0.678977, -0.584716, 0.443957,
-    0.500000, 0.133975,
-    -0.646578, -0.564254, 0.513375,
-    1.000000, 1.000000,
-    -0.735011, -0.536784, 0.414273,
-    0.000000, 1.000000,
-    -0.785899, -0.485712, 0.382683,
-    0.500000, 0.133975,
-    -0.757935, -0.468430, 0.453990,
-    1.000000, 1.000000,
-    -0.255180, -0.610926, 0.749435,
-    0.000000, 1.000000,
-    -0.280319, -0.545109, 0.790112,
-    0.500000, 0.133975,
-    -0.213023, -0.571252, 0.792649,
-    1.000000, 1.000000,
-    -0.187432, -0.634579, 0.749786,
-    0.000000, 1.000000,
-    -0.255180, -0.610926, 0.749435,
-    0.500000, 0.133975,
-    -0.213023, -0.571252, 0.792649,
-    1.000000, 1.000000,
-    -0.322141, -0.583691, 0.745338,
-    0.000000, 1.000000,
-    -0.386730, -0.553372, 0.737712,
-    0.500000, 0.133975,
-    -0.346153, -0.516122, 0.783452,
-    1.000000, 1.000000,
-    -0.106494, -0.551859, 0.827110,
-    0.000000, 1.000000,
-    -0.172532, -0.529135, 0.830812,
-    0.500000, 0.133975,
-    -0.131200, -0.484442, 0.864929,
-    1.000000, 1.000000,
-    -0.065758, -0.506298, 0.859848,
-    0.000000, 1.000000,
-    -0.106494, -0.551859, 0.827110,
-    0.500000, 0.133975,
-    -0.131200, -0.484442, 0.864929,
-    1.000000, 1.000000,
-    -0.147414, -0.594895, 0.790170,
-    0.000000, 1.000000,
-    -0.187432, -0.634579, 0.749786,
-    0.500000, 0.133975,
-    -0.213023, -0.571252, 0.792649,
-    1.000000, 1.000000,
-    -0.267381, -0.705236, 0.656620,
-    0.000000, 1.000000,
-    -0.334692, -0.678913, 0.653497,
-    0.500000, 0.133975,
-    -0.296005, -0.647412, 0.702310,
-    1.000000, 1.000000,
-    -0.228900, -0.672319, 0.703983,
-    0.000000, 1.000000,
-    -0.267381, -0.705236, 0.656620,
-    0.500000, 0.133975,
-    -0.296005, -0.647412, 0.702310,
-    1.000000, 1.000000,
-    -0.305212, -0.734794, 0.605741,
-    0.000000, 1.000000,
-    -0.341435, -0.760406, 0.552454,
-    0.500000, 0.133975,
-    -0.371748, -0.707107, 0.601501,
-    1.000000, 1.000000,
-    -0.545109, -0.790112, 0.280319,
-    0.000000, 1.000000,
-    -0.583691, -0.745338, 0.322141,
-    0.500000, 0.133975,
-    -0.516122, -0.783452, 0.346153,
-    1.000000, 1.000000,
-    -0.476226, -0.825175, 0.303801,
-    0.000000, 1.000000,
-    -0.545109, -0.790112, 0.280319,
-    0.500000, 0.133975,
-    -0.516122, -0.783452, 0.346153,
-    1.000000, 1.000000,
-    -0.610926, -0.749435, 0.255180,
-    0.000000, 1.000000,
-    -0.672319, -0.703983, 0.228900,
-    0.500000, 0.133975,
-    -0.647412, -0.702310, 0.296005,
-    1.000000, 1.000000,
-    -0.415597, -0.803016, 0.427135,
-    0.000000, 1.000000,
-    -0.486240, -0.772575, 0.408286,
-    0.500000, 0.133975,
-    -0.453990, -0.757935, 0.468430,
-    1.000000, 1.000000,
-    -0.382683, -0.785899, 0.485712,
-    0.000000, 1.000000,
-    -0.415597, -0.803016, 0.427135,
-    0.500000, 0.133975,
-    -0.453990, -0.757935, 0.468430,
-    1.000000, 1.000000,
-    -0.446977, -0.816233, 0.366027,
-    0.000000, 1.000000,
-    -0.476226, -0.825175, 0.303801,
-    0.500000, 0.133975,
-    -0.516122, -0.783452, 0.346153,
-    1.000000, 1.000000,
-    -0.529135, -0.830812, 0.172532,
-    0.000000, 1.000000,
-    -0.594895, -0.790170, 0.147414,
-    0.500000, 0.133975,
-    -0.571252, -0.792649, 0.213023,
-    1.000000, 1.000000,
-    -0.504209, -0.830359, 0.237229,
-    0.000000, 1.000000,
-    -0.529135, -0.830812, 0.172532,
-    0.500000, 0.133975,
-    -0.571252, -0.792649, 0.213023,
-    1.000000, 1.000000,
-    -0.551859, -0.827110, 0.106494,
-    0.000000, 1.000000,
-    -0.572056, -0.819207, 0.040640,
-    0.500000, 0.133975,
-    -0.615642, -0.783843, 0.081086,
-    1.000000, 1.000000,
-    0.607478, -0.540650, 0.581952,
-    0.000000, 1.000000,
-    0.540650, -0.581952, 0.607478,
-    0.500000, 0.133975,
-    0.564254, -0.513375, 0.646578,
-    1.000000, 1.000000,
-    0.628313, -0.470917, 0.619242,
-    0.000000, 1.000000,
-    0.607478, -0.540650, 0.581952,
-    0.500000, 0.133975,
-    0.564254, -0.513375, 0.646578,
-    1.000000, 1.000000,
-    0.581952, -0.607478, 0.540650,
-    0.000000, 1.000000,
-    0.552418, -0.669612, 0.496441,
-    0.500000, 0.133975,
-    0.513375, -0.646578, 0.564254,
-    1.000000, 1.000000,
-    0.536784, -0.414273, 0.735011,
-    0.000000, 1.000000,
-    0.517970, -0.485208, 0.704471,
-    0.500000, 0.133975,
-    0.468430, -0.453990, 0.757935,
-    1.000000, 1.000000,
-    0.485712, -0.382683, 0.785899,
-    0.000000, 1.000000,
-    0.536784, -0.414273, 0.735011,
-    0.500000, 0.133975,
-    0.468430, -0.453990, 0.757935,
-    1.000000, 1.000000,
-    0.584716, -0.443957, 0.678977,
-    0.000000, 1.000000,
-    0.628313, -0.470917, 0.619242,
-    0.500000, 0.133975,
-    0.564254, -0.513375, 0.646578,
-    1.000000, 1.000000,
-    0.704471, -0.517970, 0.485208,
-    0.000000, 1.000000,
-    0.678977, -0.584716, 0.443957,
-    0.500000, 0.133975,
-    0.646578, -0.564254, 0.513375,
-    1.000000, 1.000000,
-    0.669612, -0.496441, 0.552418,
-    0.000000, 1.000000,
-    0.704471, -0.517970, 0.485208,
-    0.500000, 0.133975,
-    0.646578, -0.564254, 0.513375,
-    1.000000, 1.000000,
-    0.735011, -0.536784, 0.414273,
-    0.000000, 1.000000,
-    0.760406, -0.552454, 0.341435,
-    0.500000, 0.133975,
-    0.707107, -0.601501, 0.371748,
-    1.000000, 1.000000,
-    0.280319, -0.545109, 0.790112,
-    0.000000, 1.000000,
-    0.255180, -0.610926, 0.749435,
-    0.500000, 0.133975,
-    0.213023, -0.571252, 0.792649,
-    1.000000, 1.000000,
-    0.237229, -0.504209, 0.830359,
-    0.000000, 1.000000,
-    0.280319, -0.545109, 0.790112,
-    0.500000, 0.133975,
-    0.213023, -0.571252, 0.792649,
-    1.000000, 1.000000,
-    0.322141, -0.583691, 0.745338,
-    0.000000, 1.000000,
-    0.361592, -0.619186, 0.697037,
-    0.500000, 0.133975,
-    0.296005, -0.647412, 0.702310,
-    1.000000, 1.000000,
-    0.106494, -0.551859, 0.827110,
-    0.000000, 1.000000,
-    0.147414, -0.594895, 0.790170,
-    0.500000, 0.133975,
-    0.081086, -0.615642, 0.783843,
-    1.000000, 1.000000,
-    0.040640, -0.572056, 0.819207,
-    0.000000, 1.000000,
-    0.106494, -0.551859, 0.827110,
-    0.500000, 0.133975,
-    0.081086, -0.615642, 0.783843,
-    1.000000, 1.000000,
-    0.172532, -0.529135, 0.830812,
-    0.000000, 1.000000,
-    0.237229, -0.504209, 0.830359,
-    0.500000, 0.133975,
-    0.213023, -0.571252, 0.792649,
-    1.000000, 1.000000,
-    0.366027, -0.446977, 0.816233,
-    0.000000, 1.000000,
-    0.408286, -0.486240, 0.772575,
-    0.500000, 0.133975,
-    0.346153, -0.516122, 0.783452,
-    1.000000, 1.000000,
-    0.303801, -0.476226, 0.825175,
-    0.000000, 1.000000,
-    0.366027, -0.446977, 0.816233,
-    0.500000, 0.133975,
-    0.346153, -0.516122, 0.783452,
-    1.000000, 1.000000,
-    0.427135, -0.415597, 0.803016,
-    0.000000, 1.000000,
-    0.485712, -0.382683, 0.785899,
-    0.500000, 0.133975,
-    0.468430, -0.453990, 0.757935,
-    1.000000, 1.000000,
-    0.749435, -0.255180, 0.610926,
-    0.000000, 1.000000,
-    0.745338, -0.322141, 0.583691,
-    0.500000, 0.133975,
-    0.702310, -0.296005, 0.647412,
-    1.000000, 1.000000,
-    0.703983, -0.228900, 0.672319,
-    0.000000, 1.000000,
-    0.749435, -0.255180, 0.610926,
-    0.500000, 0.133975,
-    0.702310, -0.296005, 0.647412,
-    1.000000, 1.000000,
-    0.790112, -0.280319, 0.545109,
-    0.000000, 1.000000,
-    0.825175, -0.303801, 0.476226,
-    0.500000, 0.133975,
-    0.783452, -0.346153, 0.516122,
-    1.000000, 1.000000,
-    0.605741, -0.305212, 0.734794,
-    0.000000, 1.000000,
-    0.653497, -0.334692, 0.678913,
-    0.500000, 0.133975,
-    0.601501, -0.371748, 0.707107,
-    1.000000, 1.000000,
-    0.552454, -0.341435, 0.760406,
-    0.000000, 1.000000,
-    0.605741, -0.305212, 0.734794,
-    0.500000, 0.133975,
-    0.601501, -0.371748, 0.707107,
-    1.000000, 1.000000,
-    0.656620, -0.267381, 0.705236,
-    0.000000, 1.000000,
-    0.703983, -0.228900, 0.672319,
-    0.500000, 0.133975,
-    0.702310, -0.296005, 0.647412,
-    1.000000, 1.000000,
-    0.790170, -0.147414, 0.594895,
-    0.000000, 1.000000,
-    0.830812, -0.172532, 0.529135,
-    0.500000, 0.133975,
-    0.792649, -0.213023, 0.571252,
-    1.000000, 1.000000,
-    0.749786, -0.187432, 0.634579,
-    0.000000, 1.000000,
-    0.790170, -0.147414, 0.594895,
-    0.500000, 0.133975,
-    0.792649, -0.213023, 0.571252,
-    1.000000, 1.000000,
-    0.827110, -0.106494, 0.551859,
-    0.000000, 1.000000,
-    0.859848, -0.065758, 0.506298,
-    0.500000, 0.133975,
-    0.864929, -0.131200, 0.484442,
-    1.000000, 1.000000,
-    -0.786433, 0.000000, 0.617676,
-    0.000000, 1.000000,
-    -0.819207, -0.040640, 0.572056,
-    0.500000, 0.133975,
-    -0.819207, 0.040640, 0.572056,
-    1.000000, 1.000000,
-    -0.783843, 0.081086, 0.615642,
-    0.000000, 1.000000,
-    -0.786433, 0.000000, 0.617676,
-    0.500000, 0.133975,
-    -0.819207, 0.040640, 0.572056,
-    1.000000, 1.000000,
-    -0.786433, 0.000000, 0.617676,
-    0.000000, 1.000000,
-    -0.783843, -0.081086, 0.615642,
-    0.500000, 0.133975,
-    -0.819207, -0.040640, 0.572056,
-    1.000000, 1.000000,
-    0.065817, -0.445365, 0.892927,
-    0.000000, 1.000000,
-    0.065758, -0.506298, 0.859848,
-    0.500000, 0.133975,
-    0.000000, -0.465658, 0.884965,
-    1.000000, 1.000000,
-    0.000000, -0.403355, 0.915043,
-    0.000000, 1.000000,
-    0.065817, -0.445365, 0.892927,
-    0.500000, 0.133975,
-    0.000000, -0.465658, 0.884965,
-    1.000000, 1.000000,
-    0.065817, -0.445365, 0.892927,
-    0.000000, 1.000000,
-    0.131200, -0.484442, 0.864929,
-    0.500000, 0.133975,
-    0.065758, -0.506298, 0.859848,
-    1.000000, 1.000000,
-    0.786433, 0.000000, -0.617676,
-    0.000000, 1.000000,
-    0.819207, -0.040640, -0.572056,
-    0.500000, 0.133975,
-    0.819207, 0.040640, -0.572056,
-    1.000000, 1.000000,
-    0.783843, 0.081086, -0.615642,
-    0.000000, 1.000000,
-    0.786433, 0.000000, -0.617676,
-    0.500000, 0.133975,
-    0.819207, 0.040640, -0.572056,
-    1.000000, 1.000000,
-    0.786433, 0.000000, -0.617676,
-    0.000000, 1.000000,
-    0.783843, -0.081086, -0.615642,
-    0.500000, 0.133975,
-    0.819207, -0.040640, -0.572056,
-    1.000000, 1.000000,
-    -0.065817, -0.445365, -0.892927,
-    0.000000, 1.000000,
-    -0.065758, -0.506298, -0.859848,
-    0.500000, 0.133975,
-    0.000000, -0.465658, -0.884965,
-    1.000000, 1.000000,
-    0.000000, -0.403355, -0.915043,
-    0.000000, 1.000000,
-    -0.065817, -0.445365, -0.892927,
-    0.500000, 0.133975,
-    0.000000, -0.465658, -0.884965,
-    1.000000, 1.000000,
-    -0.065817, -0.445365, -0.892927,
-    0.000000, 1.000000,
-    -0.131200, -0.484442, -0.864929,
-    0.500000, 0.133975,
-    -0.065758, -0.506298, -0.859848,
-    1.000000, 1.000000,
-    -0.445365, -0.892927, 0.065817,
-    0.000000, 1.000000,
-    -0.465658, -0.884965, 0.000000,
-    0.500000, 0.133975,
-    -0.506298, -0.859848, 0.065758,
-    1.000000, 1.000000,
-    -0.484442, -0.864929, 0.131200,
-    0.000000, 1.000000,
-    -0.445365, -0.892927, 0.065817,
-    0.500000, 0.133975,
-    -0.506298, -0.859848, 0.065758,
-    1.000000, 1.000000,
-    -0.445365, -0.892927, 0.065817,
-    0.000000, 1.000000,
-    -0.403355, -0.915043, 0.000000,
-    0.500000, 0.133975,
-    -0.465658, -0.884965, 0.000000,
-    1.000000, 1.000000,
-    0.445365, -0.892927, -0.065817,
-    0.000000, 1.000000,
-    0.465658, -0.884965, 0.000000,
-    0.500000, 0.133975,
-    0.506298, -0.859848, -0.065758,
-    1.000000, 1.000000,
-    0.484442, -0.864929, -0.131200,
-    0.000000, 1.000000,
-    0.445365, -0.892927, -0.065817,
-    0.500000, 0.133975,
-    0.506298, -0.859848, -0.065758,
-    1.000000, 1.000000,
-    0.445365, -0.892927, -0.065817,
-    0.000000, 1.000000,
-    0.403355, -0.915043, 0.000000,
-    0.500000, 0.133975,
-    0.465658, -0.884965, 0.000000,
-    1.000000, 1.000000,
-    -0.892927, 0.065817, -0.445365,
-    0.000000, 1.000000,
-    -0.884965, 0.000000, -0.465658,
-    0.500000, 0.133975,
-    -0.859848, 0.065758, -0.506298,
-    1.000000, 1.000000,
-    -0.892927, 0.065817, -0.445365,
-    0.000000, 1.000000,
-    -0.915043, 0.000000, -0.403355,
-    0.500000, 0.133975,
-    -0.884965, 0.000000, -0.465658,
-    1.000000, 1.000000,
-    -0.892927, -0.065817, 0.445365,
-    0.000000, 1.000000,
-    -0.884965, 0.000000, 0.465658,
-    0.500000, 0.133975,
-    -0.859848, -0.065758, 0.506298,
-    1.000000, 1.000000,
-    -0.864929, -0.131200, 0.484442,
-    0.000000, 1.000000,
-    -0.892927, -0.065817, 0.445365,
-    0.500000, 0.133975,
-    -0.859848, -0.065758, 0.506298,
-    1.000000, 1.000000,
-    -0.892927, -0.065817, 0.445365,
-    0.000000, 1.000000,
-    -0.915043, 0.000000, 0.403355,
-    0.500000, 0.133975,
-    -0.884965, 0.000000, 0.465658,
-    1.000000, 1.000000,
-    0.892927, 0.065817, 0.445365,
-    0.000000, 1.000000,
-    0.884965, 0.000000, 0.465658,
-    0.500000, 0.133975,
-    0.859848, 0.065758, 0.506298,
-    1.000000, 1.000000,
-    0.892927, 0.065817, 0.445365,
-    0.000000, 1.000000,
-    0.915043, 0.000000, 0.403355,
-    0.500000, 0.133975,
-    0.884965, 0.000000, 0.465658,
-    1.000000, 1.000000,
-    0.892927, -0.065817, -0.445365,
-    0.000000, 1.000000,
-    0.884965, 0.000000, -0.465658,
-    0.500000, 0.133975,
-    0.859848, -0.065758, -0.506298,
-    1.000000, 1.000000,
-    0.864929, -0.131200, -0.484442,
-    0.000000, 1.000000,
-    0.892927, -0.065817, -0.445365,
-    0.500000, 0.133975,
-    0.859848, -0.065758, -0.506298,
-    1.000000, 1.000000,
-    0.892927, -0.065817, -0.445365,
-    0.000000, 1.000000,
-    0.915043, 0.000000, -0.403355,
-    0.500000, 0.133975,
-    0.884965, 0.000000, -0.465658,
-    1.000000, 1.000000,
-    0.827110, 0.106494, 0.551859,
-    0.000000, 1.000000,
-    0.859848, 0.065758, 0.506298,
-    0.500000, 0.133975,
-    0.819207, 0.040640, 0.572056,
-    1.000000, 1.000000,
-    0.783843, 0.081086, 0.615642,
-    0.000000, 1.000000,
-    0.827110, 0.106494, 0.551859,
-    0.500000, 0.133975,
-    0.819207, 0.040640, 0.572056,
-    1.000000, 1.000000,
-    -0.827110, 0.106494, -0.551859,
-    0.000000, 1.000000,
-    -0.859848, 0.065758, -0.506298,
-    0.500000, 0.133975,
-    -0.819207, 0.040640, -0.572056,
-    1.000000, 1.000000,
-    -0.783843, 0.081086, -0.615642,
-    0.000000, 1.000000,
-    -0.827110, 0.106494, -0.551859,
-    0.500000, 0.133975,
-    -0.819207, 0.040640, -0.572056,
-    1.000000, 1.000000,
-    -0.551859, -0.827110, -0.106494,
-    0.000000, 1.000000,
-    -0.572056, -0.819207, -0.040640,
-    0.500000, 0.133975,
-    -0.506298, -0.859848, -0.065758,
-    1.000000, 1.000000,
-    -0.484442, -0.864929, -0.131200,
-    0.000000, 1.000000,
-    -0.551859, -0.827110, -0.106494,
-    0.500000, 0.133975,
-    -0.506298, -0.859848, -0.065758,
-    1.000000, 1.000000,
-    -0.551859, -0.827110, -0.106494,
-    0.000000, 1.000000,
-    -0.615642, -0.783843, -0.081086,
-    0.500000, 0.133975,
-    -0.572056, -0.819207, -0.040640,
-    1.000000, 1.000000,
-    0.827110, -0.106494, -0.551859,
-    0.000000, 1.000000,
-    0.859848, -0.065758, -0.506298,
-    0.500000, 0.133975,
-    0.819207, -0.040640, -0.572056,
-    1.000000, 1.000000,
-    0.783843, -0.081086, -0.615642,
-    0.000000, 1.000000,
-    0.827110, -0.106494, -0.551859,
-    0.500000, 0.133975,
-    0.819207, -0.040640, -0.572056,
-    1.000000, 1.000000,
-    0.827110, -0.106494, -0.551859,
-    0.000000, 1.000000,
-    0.864929, -0.131200, -0.484442,
-    0.500000, 0.133975,
-    0.859848, -0.065758, -0.506298,
-    1.000000, 1.000000,
-    -0.827110, -0.106494, 0.551859,
-    0.000000, 1.000000,
-    -0.859848, -0.065758, 0.506298,
-    0.500000, 0.133975,
-    -0.819207, -0.040640, 0.572056,
-    1.000000, 1.000000,
-    -0.783843, -0.081086, 0.615642,
-    0.000000, 1.000000,
-    -0.827110, -0.106494, 0.551859,
-    0.500000, 0.133975,
-    -0.819207, -0.040640, 0.572056,
-    1.000000, 1.000000,
-    -0.827110, -0.106494, 0.551859,
-    0.000000, 1.000000,
-    -0.864929, -0.131200, 0.484442,
-    0.500000, 0.133975,
-    -0.859848, -0.065758, 0.506298,
-    1.000000, 1.000000,
-    0.551859, -0.827110, 0.106494,
-    0.000000, 1.000000,
-    0.572056, -0.819207, 0.040640,
-    0.500000, 0.133975,
-    0.506298, -0.859848, 0.065758,
-    1.000000, 1.000000,
-    0.484442, -0.864929, 0.131200,
-    0.000000, 1.000000,
-    0.551859, -0.827110, 0.106494,
-    0.500000, 0.133975,
-    0.506298, -0.859848, 0.065758,
-    1.000000, 1.000000,
-    0.551859, -0.827110, 0.106494,
-    0.000000, 1.000000,
-    0.615642, -0.783843, 0.081086,
-    0.500000, 0.133975,
-    0.572056, -0.819207, 0.040640,
-    1.000000, 1.000000,
-    -0.385906, -0.307659, 0.869725,
-    0.000000, 1.000000,
-    -0.442867, -0.342848, 0.828447,
-    0.500000, 0.133975,
-    -0.444464, -0.274694, 0.852640,
-    1.000000, 1.000000,
-    -0.386187, -0.238677, 0.891007,
-    0.000000, 1.000000,
-    -0.385906, -0.307659, 0.869725,
-    0.500000, 0.133975,
-    -0.444464, -0.274694, 0.852640,
-    1.000000, 1.000000,
-    -0.385906, -0.307659, 0.869725,
-    0.000000, 1.000000,
-    -0.383614, -0.375039, 0.843911,
-    0.500000, 0.133975,
-    -0.442867, -0.342848, 0.828447,
-    1.000000, 1.000000,
-    0.133523, 0.000000, 0.991046,
-    0.000000, 1.000000,
-    0.066741, -0.041248, 0.996917,
-    0.500000, 0.133975,
-    0.066741, 0.041248, 0.996917,
-    1.000000, 1.000000,
-    0.133071, 0.082242, 0.987688,
-    0.000000, 1.000000,
-    0.133523, 0.000000, 0.991046,
-    0.500000, 0.133975,
-    0.066741, 0.041248, 0.996917,
-    1.000000, 1.000000,
-    0.133523, 0.000000, 0.991046,
-    0.000000, 1.000000,
-    0.133071, -0.082242, 0.987688,
-    0.500000, 0.133975,
-    0.066741, -0.041248, 0.996917,
-    1.000000, 1.000000,
-    0.066709, 0.110385, 0.991648,
-    0.000000, 1.000000,
-    0.066741, 0.041248, 0.996917,
-    0.500000, 0.133975,
-    0.000000, 0.069142, 0.997607,
-    1.000000, 1.000000,
-    0.066709, 0.110385, 0.991648,
-    0.000000, 1.000000,
-    0.133071, 0.082242, 0.987688,
-    0.500000, 0.133975,
-    0.066741, 0.041248, 0.996917,
-    1.000000, 1.000000,
-    0.564513, -0.197274, 0.801504,
-    0.000000, 1.000000,
-    0.554740, -0.273707, 0.785715,
-    0.500000, 0.133975,
-    0.511205, -0.233445, 0.827147,
-    1.000000, 1.000000,
-    0.519258, -0.156434, 0.840178,
-    0.000000, 1.000000,
-    0.564513, -0.197274, 0.801504,
-    0.500000, 0.133975,
-    0.511205, -0.233445, 0.827147,
-    1.000000, 1.000000,
-    0.564513, -0.197274, 0.801504,
-    0.000000, 1.000000,
-    0.606825, -0.237086, 0.758652,
-    0.500000, 0.133975,
-    0.554740, -0.273707, 0.785715,
-    1.000000, 1.000000,
-    0.385906, -0.307659, -0.869725,
-    0.000000, 1.000000,
-    0.442867, -0.342848, -0.828447,
-    0.500000, 0.133975,
-    0.444464, -0.274694, -0.852640,
-    1.000000, 1.000000,
-    0.386187, -0.238677, -0.891007,
-    0.000000, 1.000000,
-    0.385906, -0.307659, -0.869725,
-    0.500000, 0.133975,
-    0.444464, -0.274694, -0.852640,
-    1.000000, 1.000000,
-    0.385906, -0.307659, -0.869725,
-    0.000000, 1.000000,
-    0.383614, -0.375039, -0.843911,
-    0.500000, 0.133975,
-    0.442867, -0.342848, -0.828447,
-    1.000000, 1.000000,
-    -0.133523, 0.000000, -0.991046,
-    0.000000, 1.000000,
-    -0.066741, -0.041248, -0.996917,
-    0.500000, 0.133975,
-    -0.066741, 0.041248, -0.996917,
-    1.000000, 1.000000,
-    -0.133071, 0.082242, -0.987688,
-    0.000000, 1.000000,
-    -0.133523, 0.000000, -0.991046,
-    0.500000, 0.133975,
-    -0.066741, 0.041248, -0.996917,
-    1.000000, 1.000000,
-    -0.133523, 0.000000, -0.991046,
-    0.000000, 1.000000,
-    -0.133071, -0.082242, -0.987688,
-    0.500000, 0.133975,
-    -0.066741, -0.041248, -0.996917,
-    1.000000, 1.000000,
-    -0.066709, 0.110385, -0.991648,
-    0.000000, 1.000000,
-    -0.066741, 0.041248, -0.996917,
-    0.500000, 0.133975,
-    0.000000, 0.069142, -0.997607,
-    1.000000, 1.000000,
-    -0.066709, 0.110385, -0.991648,
-    0.000000, 1.000000,
-    -0.133071, 0.082242, -0.987688,
-    0.500000, 0.133975,
-    -0.066741, 0.041248, -0.996917,
-    1.000000, 1.000000,
-    -0.564513, -0.197274, -0.801504,
-    0.000000, 1.000000,
-    -0.554740, -0.273707, -0.785715,
-    0.500000, 0.133975,
-    -0.511205, -0.233445, -0.827147,
-    1.000000, 1.000000,
-    -0.519258, -0.156434, -0.840178,
-    0.000000, 1.000000,
-    -0.564513, -0.197274, -0.801504,
-    0.500000, 0.133975,
-    -0.511205, -0.233445, -0.827147,
-    1.000000, 1.000000,
-    -0.564513, -0.197274, -0.801504,
-    0.000000, 1.000000,
-    -0.606825, -0.237086, -0.758652,
-    0.500000, 0.133975,
-    -0.554740, -0.273707, -0.785715,
-    1.000000, 1.000000,
-    -0.198227, -0.868534, 0.454262,
-    0.000000, 1.000000,
-    -0.274694, -0.852640, 0.444464,
-    0.500000, 0.133975,
-    -0.233445, -0.827147, 0.511205,
-    1.000000, 1.000000,
-    -0.156434, -0.840178, 0.519258,
-    0.000000, 1.000000,
-    -0.198227, -0.868534, 0.454262,
-    0.500000, 0.133975,
-    -0.233445, -0.827147, 0.511205,
-    1.000000, 1.000000,
-    -0.198227, -0.868534, 0.454262,
-    0.000000, 1.000000,
-    -0.238677, -0.891007, 0.386187,
-    0.500000, 0.133975,
-    -0.274694, -0.852640, 0.444464,
-    1.000000, 1.000000,
-    -0.197274, -0.801504, 0.564513,
-    0.000000, 1.000000,
-    -0.233445, -0.827147, 0.511205,
-    0.500000, 0.133975,
-    -0.273707, -0.785715, 0.554740,
-    1.000000, 1.000000,
-    -0.237086, -0.758652, 0.606825,
-    0.000000, 1.000000,
-    -0.197274, -0.801504, 0.564513,
-    0.500000, 0.133975,
-    -0.273707, -0.785715, 0.554740,
-    1.000000, 1.000000,
-    -0.197274, -0.801504, 0.564513,
-    0.000000, 1.000000,
-    -0.156434, -0.840178, 0.519258,
-    0.500000, 0.133975,
-    -0.233445, -0.827147, 0.511205,
-    1.000000, 1.000000,
-    0.110385, -0.991648, 0.066709,
-    0.000000, 1.000000,
-    0.069142, -0.997607, 0.000000,
-    0.500000, 0.133975,
-    0.041248, -0.996917, 0.066741,
-    1.000000, 1.000000,
-    0.082242, -0.987688, 0.133071,
-    0.000000, 1.000000,
-    0.110385, -0.991648, 0.066709,
-    0.500000, 0.133975,
-    0.041248, -0.996917, 0.066741,
-    1.000000, 1.000000,
-    0.110385, -0.991648, 0.066709,
-    0.000000, 1.000000,
-    0.137952, -0.990439, 0.000000,
-    0.500000, 0.133975,
-    0.069142, -0.997607, 0.000000,
-    1.000000, 1.000000,
-    0.198227, -0.868534, -0.454262,
-    0.000000, 1.000000,
-    0.274694, -0.852640, -0.444464,
-    0.500000, 0.133975,
-    0.233445, -0.827147, -0.511205,
-    1.000000, 1.000000,
-    0.156434, -0.840178, -0.519258,
-    0.000000, 1.000000,
-    0.198227, -0.868534, -0.454262,
-    0.500000, 0.133975,
-    0.233445, -0.827147, -0.511205,
-    1.000000, 1.000000,
-    0.198227, -0.868534, -0.454262,
-    0.000000, 1.000000,
-    0.238677, -0.891007, -0.386187,
-    0.500000, 0.133975,
-    0.274694, -0.852640, -0.444464,
-    1.000000, 1.000000,
-    0.197274, -0.801504, -0.564513,
-    0.000000, 1.000000,
-    0.233445, -0.827147, -0.511205,
-    0.500000, 0.133975,
-    0.273707, -0.785715, -0.554740,
-    1.000000, 1.000000,
-    0.237086, -0.758652, -0.606825,
-    0.000000, 1.000000,
-    0.197274, -0.801504, -0.564513,
-    0.500000, 0.133975,
-    0.273707, -0.785715, -0.554740,
-    1.000000, 1.000000,
-    0.197274, -0.801504, -0.564513,
-    0.000000, 1.000000,
-    0.156434, -0.840178, -0.519258,
-    0.500000, 0.133975,
-    0.233445, -0.827147, -0.511205,
-    1.000000, 1.000000,
-    -0.110385, -0.991648, -0.066709,
-    0.000000, 1.000000,
-    -0.069142, -0.997607, 0.000000,
-    0.500000, 0.133975,
-    -0.041248, -0.996917, -0.066741,
-    1.000000, 1.000000,
-    -0.082242, -0.987688, -0.133071,
-    0.000000, 1.000000,
-    -0.110385, -0.991648, -0.066709,
-    0.500000, 0.133975,
-    -0.041248, -0.996917, -0.066741,
-    1.000000, 1.000000,
-    -0.110385, -0.991648, -0.066709,
-    0.000000, 1.000000,
-    -0.137952, -0.990439, 0.000000,
-    0.500000, 0.133975,
-    -0.069142, -0.997607, 0.000000,
-    1.000000, 1.000000,
-    -0.991648, 0.066709, 0.110385,
-    0.000000, 1.000000,
-    -0.997607, 0.000000, 0.069142,
-    0.500000, 0.133975,
-    -0.996917, 0.066741, 0.041248,
-    1.000000, 1.000000,
-    -0.991648, 0.066709, 0.110385,
-    0.000000, 1.000000,
-    -0.990439, 0.000000, 0.137952,
-    0.500000, 0.133975,
-    -0.997607, 0.000000, 0.069142,
-    1.000000, 1.000000,
-    -0.868534, -0.454262, 0.198227,
-    0.000000, 1.000000,
-    -0.852640, -0.444464, 0.274694,
-    0.500000, 0.133975,
-    -0.827147, -0.511205, 0.233445,
-    1.000000, 1.000000,
-    -0.840178, -0.519258, 0.156434,
-    0.000000, 1.000000,
-    -0.868534, -0.454262, 0.198227,
-    0.500000, 0.133975,
-    -0.827147, -0.511205, 0.233445,
-    1.000000, 1.000000,
-    -0.868534, -0.454262, 0.198227,
-    0.000000, 1.000000,
-    -0.891007, -0.386187, 0.238677,
-    0.500000, 0.133975,
-    -0.852640, -0.444464, 0.274694,
-    1.000000, 1.000000,
-    -0.801504, -0.564513, 0.197274,
-    0.000000, 1.000000,
-    -0.827147, -0.511205, 0.233445,
-    0.500000, 0.133975,
-    -0.785715, -0.554740, 0.273707,
-    1.000000, 1.000000,
-    -0.758652, -0.606825, 0.237086,
-    0.000000, 1.000000,
-    -0.801504, -0.564513, 0.197274,
-    0.500000, 0.133975,
-    -0.785715, -0.554740, 0.273707,
-    1.000000, 1.000000,
-    -0.801504, -0.564513, 0.197274,
-    0.000000, 1.000000,
-    -0.840178, -0.519258, 0.156434,
-    0.500000, 0.133975,
-    -0.827147, -0.511205, 0.233445,
-    1.000000, 1.000000,
-    -0.991648, -0.066709, -0.110385,
-    0.000000, 1.000000,
-    -0.997607, 0.000000, -0.069142,
-    0.500000, 0.133975,
-    -0.996917, -0.066741, -0.041248,
-    1.000000, 1.000000,
-    -0.987688, -0.133071, -0.082242,
-    0.000000, 1.000000,
-    -0.991648, -0.066709, -0.110385,
-    0.500000, 0.133975,
-    -0.996917, -0.066741, -0.041248,
-    1.000000, 1.000000,
-    -0.991648, -0.066709, -0.110385,
-    0.000000, 1.000000,
-    -0.990439, 0.000000, -0.137952,
-    0.500000, 0.133975,
-    -0.997607, 0.000000, -0.069142,
-    1.000000, 1.000000,
-    0.991648, 0.066709, -0.110385,
-    0.000000, 1.000000,
-    0.997607, 0.000000, -0.069142,
-    0.500000, 0.133975,
-    0.996917, 0.066741, -0.041248,
-    1.000000, 1.000000,
-    0.991648, 0.066709, -0.110385,
-    0.000000, 1.000000,
-    0.990439, 0.000000, -0.137952,
-    0.500000, 0.133975,
-    0.997607, 0.000000, -0.069142,
-    1.000000, 1.000000,
-    0.868534, -0.454262, -0.198227,
-    0.000000, 1.000000,
-    0.852640, -0.444464, -0.274694,
-    0.500000, 0.133975,
-    0.827147, -0.511205, -0.233445,
-    1.000000, 1.000000,
-    0.840178, -0.519258, -0.156434,
-    0.000000, 1.000000,
-    0.868534, -0.454262, -0.198227,
-    0.500000, 0.133975,
-    0.827147, -0.511205, -0.233445,
-    1.000000, 1.000000,
-    0.868534, -0.454262, -0.198227,
-    0.000000, 1.000000,
-    0.891007, -0.386187, -0.238677,
-    0.500000, 0.133975,
-    0.852640, -0.444464, -0.274694,
-    1.000000, 1.000000,
-    0.801504, -0.564513, -0.197274,
-    0.000000, 1.000000,
-    0.827147, -0.511205, -0.233445,
-    0.500000, 0.133975,
-    0.785715, -0.554740, -0.273707,
-    1.000000, 1.000000,
-    0.758652, -0.606825, -0.237086,
-    0.000000, 1.000000,
-    0.801504, -0.564513, -0.197274,
-    0.500000, 0.133975,
-    0.785715, -0.554740, -0.273707,
-    1.000000, 1.000000,
-    0.801504, -0.564513, -0.197274,
-    0.000000, 1.000000,
-    0.840178, -0.519258, -0.156434,
-    0.500000, 0.133975,
-    0.827147, -0.511205, -0.233445,
-    1.000000, 1.000000,
-    0.991648, -0.066709, 0.110385,
-    0.000000, 1.000000,
-    0.997607, 0.000000, 0.069142,
-    0.500000, 0.133975,
-    0.996917, -0.066741, 0.041248,
-    1.000000, 1.000000,
-    0.987688, -0.133071, 0.082242,
-    0.000000, 1.000000,
-    0.991648, -0.066709, 0.110385,
-    0.500000, 0.133975,
-    0.996917, -0.066741, 0.041248,
-    1.000000, 1.000000,
-    0.991648, -0.066709, 0.110385,
-    0.000000, 1.000000,
-    0.990439, 0.000000, 0.137952,
-    0.500000, 0.133975,
-    0.997607, 0.000000, 0.069142,
-    1.000000, 1.000000,
-    -0.414273, -0.735011, -0.536784,
-    0.000000, 1.000000,
-    -0.382683, -0.785899, -0.485712,
-    0.500000, 0.133975,
-    -0.341435, -0.760406, -0.552454,
-    1.000000, 1.000000,
-    -0.371748, -0.707107, -0.601501,
-    0.000000, 1.000000,
-    -0.414273, -0.735011, -0.536784,
-    0.500000, 0.133975,
-    -0.341435, -0.760406, -0.552454,
-    1.000000, 1.000000,
-    -0.414273, -0.735011, -0.536784,
-    0.000000, 1.000000,
-    -0.453990, -0.757935, -0.468430,
-    0.500000, 0.133975,
-    -0.382683, -0.785899, -0.485712,
-    1.000000, 1.000000,
-    -0.305212, -0.734794, -0.605741,
-    0.000000, 1.000000,
-    -0.341435, -0.760406, -0.552454,
-    0.500000, 0.133975,
-    -0.273707, -0.785715, -0.554740,
-    1.000000, 1.000000,
-    -0.237086, -0.758652, -0.606825,
-    0.000000, 1.000000,
-    -0.305212, -0.734794, -0.605741,
-    0.500000, 0.133975,
-    -0.273707, -0.785715, -0.554740,
-    1.000000, 1.000000,
-    -0.305212, -0.734794, -0.605741,
-    0.000000, 1.000000,
-    -0.371748, -0.707107, -0.601501,
-    0.500000, 0.133975,
-    -0.341435, -0.760406, -0.552454,
-    1.000000, 1.000000,
-    -0.803016, -0.427135, -0.415597,
-    0.000000, 1.000000,
-    -0.828447, -0.442867, -0.342848,
-    0.500000, 0.133975,
-    -0.785899, -0.485712, -0.382683,
-    1.000000, 1.000000,
-    -0.757935, -0.468430, -0.453990,
-    0.000000, 1.000000,
-    -0.803016, -0.427135, -0.415597,
-    0.500000, 0.133975,
-    -0.785899, -0.485712, -0.382683,
-    1.000000, 1.000000,
-    -0.803016, -0.427135, -0.415597,
-    0.000000, 1.000000,
-    -0.843911, -0.383614, -0.375039,
-    0.500000, 0.133975,
-    -0.828447, -0.442867, -0.342848,
-    1.000000, 1.000000,
-    0.536784, -0.414273, -0.735011,
-    0.000000, 1.000000,
-    0.552454, -0.341435, -0.760406,
-    0.500000, 0.133975,
-    0.485712, -0.382683, -0.785899,
-    1.000000, 1.000000,
-    0.468430, -0.453990, -0.757935,
-    0.000000, 1.000000,
-    0.536784, -0.414273, -0.735011,
-    0.500000, 0.133975,
-    0.485712, -0.382683, -0.785899,
-    1.000000, 1.000000,
-    0.536784, -0.414273, -0.735011,
-    0.000000, 1.000000,
-    0.601501, -0.371748, -0.707107,
-    0.500000, 0.133975,
-    0.552454, -0.341435, -0.760406,
-    1.000000, 1.000000,
-    0.427135, -0.415597, -0.803016,
-    0.000000, 1.000000,
-    0.485712, -0.382683, -0.785899,
-    0.500000, 0.133975,
-    0.442867, -0.342848, -0.828447,
-    1.000000, 1.000000,
-    0.383614, -0.375039, -0.843911,
-    0.000000, 1.000000,
-    0.427135, -0.415597, -0.803016,
-    0.500000, 0.133975,
-    0.442867, -0.342848, -0.828447,
-    1.000000, 1.000000,
-    0.427135, -0.415597, -0.803016,
-    0.000000, 1.000000,
-    0.468430, -0.453990, -0.757935,
-    0.500000, 0.133975,
-    0.485712, -0.382683, -0.785899,
-    1.000000, 1.000000,
-    0.734794, -0.605741, -0.305212,
-    0.000000, 1.000000,
-    0.785715, -0.554740, -0.273707,
-    0.500000, 0.133975,
-    0.760406, -0.552454, -0.341435,
-    1.000000, 1.000000,
-    0.707107, -0.601501, -0.371748,
-    0.000000, 1.000000,
-    0.734794, -0.605741, -0.305212,
-    0.500000, 0.133975,
-    0.760406, -0.552454, -0.341435,
-    1.000000, 1.000000,
-    0.734794, -0.605741, -0.305212,
-    0.000000, 1.000000,
-    0.758652, -0.606825, -0.237086,
-    0.500000, 0.133975,
-    0.785715, -0.554740, -0.273707,
-    1.000000, 1.000000,
-    -0.536784, -0.414273, 0.735011,
-    0.000000, 1.000000,
-    -0.552454, -0.341435, 0.760406,
-    0.500000, 0.133975,
-    -0.485712, -0.382683, 0.785899,
-    1.000000, 1.000000,
-    -0.468430, -0.453990, 0.757935,
-    0.000000, 1.000000,
-    -0.536784, -0.414273, 0.735011,
-    0.500000, 0.133975,
-    -0.485712, -0.382683, 0.785899,
-    1.000000, 1.000000,
-    -0.536784, -0.414273, 0.735011,
-    0.000000, 1.000000,
-    -0.601501, -0.371748, 0.707107,
-    0.500000, 0.133975,
-    -0.552454, -0.341435, 0.760406,
-    1.000000, 1.000000,
-    -0.427135, -0.415597, 0.803016,
-    0.000000, 1.000000,
-    -0.485712, -0.382683, 0.785899,
-    0.500000, 0.133975,
-    -0.442867, -0.342848, 0.828447,
-    1.000000, 1.000000,
-    -0.383614, -0.375039, 0.843911,
-    0.000000, 1.000000,
-    -0.427135, -0.415597, 0.803016,
-    0.500000, 0.133975,
-    -0.442867, -0.342848, 0.828447,
-    1.000000, 1.000000,
-    -0.427135, -0.415597, 0.803016,
-    0.000000, 1.000000,
-    -0.468430, -0.453990, 0.757935,
-    0.500000, 0.133975,
-    -0.485712, -0.382683, 0.785899,
-    1.000000, 1.000000,
-    -0.734794, -0.605741, 0.305212,
-    0.000000, 1.000000,
-    -0.785715, -0.554740, 0.273707,
-    0.500000, 0.133975,
-    -0.760406, -0.552454, 0.341435,
-    1.000000, 1.000000,
-    -0.707107, -0.601501, 0.371748,
-    0.000000, 1.000000,
-    -0.734794, -0.605741, 0.305212,
-    0.500000, 0.133975,
-    -0.760406, -0.552454, 0.341435,
-    1.000000, 1.000000,
-    -0.734794, -0.605741, 0.305212,
-    0.000000, 1.000000,
-    -0.758652, -0.606825, 0.237086,
-    0.500000, 0.133975,
-    -0.785715, -0.554740, 0.273707,
-    1.000000, 1.000000,
-    0.414273, -0.735011, 0.536784,
-    0.000000, 1.000000,
-    0.382683, -0.785899, 0.485712,
-    0.500000, 0.133975,
-    0.341435, -0.760406, 0.552454,
-    1.000000, 1.000000,
-    0.371748, -0.707107, 0.601501,
-    0.000000, 1.000000,
-    0.414273, -0.735011, 0.536784,
-    0.500000, 0.133975,
-    0.341435, -0.760406, 0.552454,
-    1.000000, 1.000000,
-    0.414273, -0.735011, 0.536784,
-    0.000000, 1.000000,
-    0.453990, -0.757935, 0.468430,
-    0.500000, 0.133975,
-    0.382683, -0.785899, 0.485712,
-    1.000000, 1.000000,
-    0.305212, -0.734794, 0.605741,
-    0.000000, 1.000000,
-    0.341435, -0.760406, 0.552454,
-    0.500000, 0.133975,
-    0.273707, -0.785715, 0.554740,
-    1.000000, 1.000000,
-    0.237086, -0.758652, 0.606825,
-    0.000000, 1.000000,
-    0.305212, -0.734794, 0.605741,
-    0.500000, 0.133975,
-    0.273707, -0.785715, 0.554740,
-    1.000000, 1.000000,
-    0.305212, -0.734794, 0.605741,
-    0.000000, 1.000000,
-    0.371748, -0.707107, 0.601501,
-    0.500000, 0.133975,
-    0.341435, -0.760406, 0.552454,
-    1.000000, 1.000000,
-    0.803016, -0.427135, 0.415597,
-    0.000000, 1.000000,
-    0.828447, -0.442867, 0.342848,
-    0.500000, 0.133975,
-    0.785899, -0.485712, 0.382683,
-    1.000000, 1.000000,
-    0.757935, -0.468430, 0.453990,
-    0.000000, 1.000000,
-    0.803016, -0.427135, 0.415597,
-    0.500000, 0.133975,
-    0.785899, -0.485712, 0.382683,
-    1.000000, 1.000000,
-    0.803016, -0.427135, 0.415597,
-    0.000000, 1.000000,
-    0.843911, -0.383614, 0.375039,
-    0.500000, 0.133975,
-    0.828447, -0.442867, 0.342848,
-    1.000000, 1.000000,
-    -0.667502, 0.040677, 0.743496,
-    0.000000, 1.000000,
-    -0.708969, 0.080573, 0.700622,
-    0.500000, 0.133975,
-    -0.662842, 0.121193, 0.738886,
-    1.000000, 1.000000,
-    -0.620240, 0.081142, 0.780204,
-    0.000000, 1.000000,
-    -0.667502, 0.040677, 0.743496,
-    0.500000, 0.133975,
-    -0.662842, 0.121193, 0.738886,
-    1.000000, 1.000000,
-    -0.667502, 0.040677, 0.743496,
-    0.000000, 1.000000,
-    -0.711282, 0.000000, 0.702907,
-    0.500000, 0.133975,
-    -0.708969, 0.080573, 0.700622,
-    1.000000, 1.000000,
-    -0.615456, -0.159613, 0.771841,
-    0.000000, 1.000000,
-    -0.656006, -0.199331, 0.727958,
-    0.500000, 0.133975,
-    -0.662842, -0.121193, 0.738886,
-    1.000000, 1.000000,
-    -0.620240, -0.081142, 0.780204,
-    0.000000, 1.000000,
-    -0.615456, -0.159613, 0.771841,
-    0.500000, 0.133975,
-    -0.662842, -0.121193, 0.738886,
-    1.000000, 1.000000,
-    -0.615456, -0.159613, 0.771841,
-    0.000000, 1.000000,
-    -0.606825, -0.237086, 0.758652,
-    0.500000, 0.133975,
-    -0.656006, -0.199331, 0.727958,
-    1.000000, 1.000000,
-    0.132570, -0.289929, 0.947822,
-    0.000000, 1.000000,
-    0.066042, -0.316778, 0.946198,
-    0.500000, 0.133975,
-    0.066567, -0.247326, 0.966643,
-    1.000000, 1.000000,
-    0.132792, -0.220117, 0.966393,
-    0.000000, 1.000000,
-    0.132570, -0.289929, 0.947822,
-    0.500000, 0.133975,
-    0.066567, -0.247326, 0.966643,
-    1.000000, 1.000000,
-    0.132570, -0.289929, 0.947822,
-    0.000000, 1.000000,
-    0.131655, -0.358229, 0.924305,
-    0.500000, 0.133975,
-    0.066042, -0.316778, 0.946198,
-    1.000000, 1.000000,
-    0.066604, -0.179596, 0.981483,
-    0.000000, 1.000000,
-    0.066567, -0.247326, 0.966643,
-    0.500000, 0.133975,
-    0.000000, -0.206103, 0.978530,
-    1.000000, 1.000000,
-    0.000000, -0.137952, 0.990439,
-    0.000000, 1.000000,
-    0.066604, -0.179596, 0.981483,
-    0.500000, 0.133975,
-    0.000000, -0.206103, 0.978530,
-    1.000000, 1.000000,
-    0.066604, -0.179596, 0.981483,
-    0.000000, 1.000000,
-    0.132792, -0.220117, 0.966393,
-    0.500000, 0.133975,
-    0.066567, -0.247326, 0.966643,
-    1.000000, 1.000000,
-    0.324864, -0.339209, 0.882837,
-    0.000000, 1.000000,
-    0.322525, -0.405434, 0.855337,
-    0.500000, 0.133975,
-    0.262661, -0.368518, 0.891742,
-    1.000000, 1.000000,
-    0.264083, -0.301259, 0.916244,
-    0.000000, 1.000000,
-    0.324864, -0.339209, 0.882837,
-    0.500000, 0.133975,
-    0.262661, -0.368518, 0.891742,
-    1.000000, 1.000000,
-    0.324864, -0.339209, 0.882837,
-    0.000000, 1.000000,
-    0.383614, -0.375039, 0.843911,
-    0.500000, 0.133975,
-    0.322525, -0.405434, 0.855337,
-    1.000000, 1.000000,
-    0.667502, 0.040677, -0.743496,
-    0.000000, 1.000000,
-    0.708969, 0.080573, -0.700622,
-    0.500000, 0.133975,
-    0.662842, 0.121193, -0.738886,
-    1.000000, 1.000000,
-    0.620240, 0.081142, -0.780204,
-    0.000000, 1.000000,
-    0.667502, 0.040677, -0.743496,
-    0.500000, 0.133975,
-    0.662842, 0.121193, -0.738886,
-    1.000000, 1.000000,
-    0.667502, 0.040677, -0.743496,
-    0.000000, 1.000000,
-    0.711282, 0.000000, -0.702907,
-    0.500000, 0.133975,
-    0.708969, 0.080573, -0.700622,
-    1.000000, 1.000000,
-    0.615456, -0.159613, -0.771841,
-    0.000000, 1.000000,
-    0.656006, -0.199331, -0.727958,
-    0.500000, 0.133975,
-    0.662842, -0.121193, -0.738886,
-    1.000000, 1.000000,
-    0.620240, -0.081142, -0.780204,
-    0.000000, 1.000000,
-    0.615456, -0.159613, -0.771841,
-    0.500000, 0.133975,
-    0.662842, -0.121193, -0.738886,
-    1.000000, 1.000000,
-    0.615456, -0.159613, -0.771841,
-    0.000000, 1.000000,
-    0.606825, -0.237086, -0.758652,
-    0.500000, 0.133975,
-    0.656006, -0.199331, -0.727958,
-    1.000000, 1.000000,
-    -0.132570, -0.289929, -0.947822,
-    0.000000, 1.000000,
-    -0.066042, -0.316778, -0.946198,
-    0.500000, 0.133975,
-    -0.066567, -0.247326, -0.966643,
-    1.000000, 1.000000,
-    -0.132792, -0.220117, -0.966393,
-    0.000000, 1.000000,
-    -0.132570, -0.289929, -0.947822,
-    0.500000, 0.133975,
-    -0.066567, -0.247326, -0.966643,
-    1.000000, 1.000000,
-    -0.132570, -0.289929, -0.947822,
-    0.000000, 1.000000,
-    -0.131655, -0.358229, -0.924305,
-    0.500000, 0.133975,
-    -0.066042, -0.316778, -0.946198,
-    1.000000, 1.000000,
-    -0.066604, -0.179596, -0.981483,
-    0.000000, 1.000000,
-    -0.066567, -0.247326, -0.966643,
-    0.500000, 0.133975,
-    0.000000, -0.206103, -0.978530,
-    1.000000, 1.000000,
-    0.000000, -0.137952, -0.990439,
-    0.000000, 1.000000,
-    -0.066604, -0.179596, -0.981483,
-    0.500000, 0.133975,
-    0.000000, -0.206103, -0.978530,
-    1.000000, 1.000000,
-    -0.066604, -0.179596, -0.981483,
-    0.000000, 1.000000,
-    -0.132792, -0.220117, -0.966393,
-    0.500000, 0.133975,
-    -0.066567, -0.247326, -0.966643,
-    1.000000, 1.000000,
-    -0.324864, -0.339209, -0.882837,
-    0.000000, 1.000000,
-    -0.322525, -0.405434, -0.855337,
-    0.500000, 0.133975,
-    -0.262661, -0.368518, -0.891742,
-    1.000000, 1.000000,
-    -0.264083, -0.301259, -0.916244,
-    0.000000, 1.000000,
-    -0.324864, -0.339209, -0.882837,
-    0.500000, 0.133975,
-    -0.262661, -0.368518, -0.891742,
-    1.000000, 1.000000,
-    -0.324864, -0.339209, -0.882837,
-    0.000000, 1.000000,
-    -0.383614, -0.375039, -0.843911,
-    0.500000, 0.133975,
-    -0.322525, -0.405434, -0.855337,
-    1.000000, 1.000000,
-    -0.330607, -0.922682, 0.198387,
-    0.000000, 1.000000,
-    -0.397351, -0.896401, 0.196412,
-    0.500000, 0.133975,
-    -0.368518, -0.891742, 0.262661,
-    1.000000, 1.000000,
-    -0.301259, -0.916244, 0.264083,
-    0.000000, 1.000000,
-    -0.330607, -0.922682, 0.198387,
-    0.500000, 0.133975,
-    -0.368518, -0.891742, 0.262661,
-    1.000000, 1.000000,
-    -0.330607, -0.922682, 0.198387,
-    0.000000, 1.000000,
-    -0.358229, -0.924305, 0.131655,
-    0.500000, 0.133975,
-    -0.397351, -0.896401, 0.196412,
-    1.000000, 1.000000,
-    -0.339209, -0.882837, 0.324864,
-    0.000000, 1.000000,
-    -0.368518, -0.891742, 0.262661,
-    0.500000, 0.133975,
-    -0.405434, -0.855337, 0.322525,
-    1.000000, 1.000000,
-    -0.375039, -0.843911, 0.383614,
-    0.000000, 1.000000,
-    -0.339209, -0.882837, 0.324864,
-    0.500000, 0.133975,
-    -0.405434, -0.855337, 0.322525,
-    1.000000, 1.000000,
-    -0.339209, -0.882837, 0.324864,
-    0.000000, 1.000000,
-    -0.301259, -0.916244, 0.264083,
-    0.500000, 0.133975,
-    -0.368518, -0.891742, 0.262661,
-    1.000000, 1.000000,
-    -0.179596, -0.981483, 0.066604,
-    0.000000, 1.000000,
-    -0.206103, -0.978530, 0.000000,
-    0.500000, 0.133975,
-    -0.247326, -0.966643, 0.066567,
-    1.000000, 1.000000,
-    -0.220117, -0.966393, 0.132792,
-    0.000000, 1.000000,
-    -0.179596, -0.981483, 0.066604,
-    0.500000, 0.133975,
-    -0.247326, -0.966643, 0.066567,
-    1.000000, 1.000000,
-    -0.179596, -0.981483, 0.066604,
-    0.000000, 1.000000,
-    -0.137952, -0.990439, 0.000000,
-    0.500000, 0.133975,
-    -0.206103, -0.978530, 0.000000,
-    1.000000, 1.000000,
-    0.330607, -0.922682, -0.198387,
-    0.000000, 1.000000,
-    0.397351, -0.896401, -0.196412,
-    0.500000, 0.133975,
-    0.368518, -0.891742, -0.262661,
-    1.000000, 1.000000,
-    0.301259, -0.916244, -0.264083,
-    0.000000, 1.000000,
-    0.330607, -0.922682, -0.198387,
-    0.500000, 0.133975,
-    0.368518, -0.891742, -0.262661,
-    1.000000, 1.000000,
-    0.330607, -0.922682, -0.198387,
-    0.000000, 1.000000,
-    0.358229, -0.924305, -0.131655,
-    0.500000, 0.133975,
-    0.397351, -0.896401, -0.196412,
-    1.000000, 1.000000,
-    0.339209, -0.882837, -0.324864,
-    0.000000, 1.000000,
-    0.368518, -0.891742, -0.262661,
-    0.500000, 0.133975,
-    0.405434, -0.855337, -0.322525,
-    1.000000, 1.000000,
-    0.375039, -0.843911, -0.383614,
-    0.000000, 1.000000,
-    0.339209, -0.882837, -0.324864,
-    0.500000, 0.133975,
-    0.405434, -0.855337, -0.322525,
-    1.000000, 1.000000,
-    0.339209, -0.882837, -0.324864,
-    0.000000, 1.000000,
-    0.301259, -0.916244, -0.264083,
-    0.500000, 0.133975,
-    0.368518, -0.891742, -0.262661,
-    1.000000, 1.000000,
-    0.179596, -0.981483, -0.066604,
-    0.000000, 1.000000,
-    0.206103, -0.978530, 0.000000,
-    0.500000, 0.133975,
-    0.247326, -0.966643, -0.066567,
-    1.000000, 1.000000,
-    0.220117, -0.966393, -0.132792,
-    0.000000, 1.000000,
-    0.179596, -0.981483, -0.066604,
-    0.500000, 0.133975,
-    0.247326, -0.966643, -0.066567,
-    1.000000, 1.000000,
-    0.179596, -0.981483, -0.066604,
-    0.000000, 1.000000,
-    0.137952, -0.990439, 0.000000,
-    0.500000, 0.133975,
-    0.206103, -0.978530, 0.000000,
-    1.000000, 1.000000,
-    -0.981483, 0.066604, -0.179596,
-    0.000000, 1.000000,
-    -0.978530, 0.000000, -0.206103,
-    0.500000, 0.133975,
-    -0.966643, 0.066567, -0.247326,
-    1.000000, 1.000000,
-    -0.981483, 0.066604, -0.179596,
-    0.000000, 1.000000,
-    -0.990439, 0.000000, -0.137952,
-    0.500000, 0.133975,
-    -0.978530, 0.000000, -0.206103,
-    1.000000, 1.000000,
-    -0.922682, -0.198387, 0.330607,
-    0.000000, 1.000000,
-    -0.896401, -0.196412, 0.397351,
-    0.500000, 0.133975,
-    -0.891742, -0.262661, 0.368518,
-    1.000000, 1.000000,
-    -0.916244, -0.264083, 0.301259,
-    0.000000, 1.000000,
-    -0.922682, -0.198387, 0.330607,
-    0.500000, 0.133975,
-    -0.891742, -0.262661, 0.368518,
-    1.000000, 1.000000,
-    -0.922682, -0.198387, 0.330607,
-    0.000000, 1.000000,
-    -0.924305, -0.131655, 0.358229,
-    0.500000, 0.133975,
-    -0.896401, -0.196412, 0.397351,
-    1.000000, 1.000000,
-    -0.882837, -0.324864, 0.339209,
-    0.000000, 1.000000,
-    -0.891742, -0.262661, 0.368518,
-    0.500000, 0.133975,
-    -0.855337, -0.322525, 0.405434,
-    1.000000, 1.000000,
-    -0.843911, -0.383614, 0.375039,
-    0.000000, 1.000000,
-    -0.882837, -0.324864, 0.339209,
-    0.500000, 0.133975,
-    -0.855337, -0.322525, 0.405434,
-    1.000000, 1.000000,
-    -0.882837, -0.324864, 0.339209,
-    0.000000, 1.000000,
-    -0.916244, -0.264083, 0.301259,
-    0.500000, 0.133975,
-    -0.891742, -0.262661, 0.368518,
-    1.000000, 1.000000,
-    -0.981483, -0.066604, 0.179596,
-    0.000000, 1.000000,
-    -0.978530, 0.000000, 0.206103,
-    0.500000, 0.133975,
-    -0.966643, -0.066567, 0.247326,
-    1.000000, 1.000000,
-    -0.966393, -0.132792, 0.220117,
-    0.000000, 1.000000,
-    -0.981483, -0.066604, 0.179596,
-    0.500000, 0.133975,
-    -0.966643, -0.066567, 0.247326,
-    1.000000, 1.000000,
-    -0.981483, -0.066604, 0.179596,
-    0.000000, 1.000000,
-    -0.990439, 0.000000, 0.137952,
-    0.500000, 0.133975,
-    -0.978530, 0.000000, 0.206103,
-    1.000000, 1.000000,
-    0.981483, 0.066604, 0.179596,
-    0.000000, 1.000000,
-    0.978530, 0.000000, 0.206103,
-    0.500000, 0.133975,
-    0.966643, 0.066567, 0.247326,
-    1.000000, 1.000000,
-    0.981483, 0.066604, 0.179596,
-    0.000000, 1.000000,
-    0.990439, 0.000000, 0.137952,
-    0.500000, 0.133975,
-    0.978530, 0.000000, 0.206103,
-    1.000000, 1.000000,
-    0.922682, -0.198387, -0.330607,
-    0.000000, 1.000000,
-    0.896401, -0.196412, -0.397351,
-    0.500000, 0.133975,
-    0.891742, -0.262661, -0.368518,
-    1.000000, 1.000000,
-    0.916244, -0.264083, -0.301259,
-    0.000000, 1.000000,
-    0.922682, -0.198387, -0.330607,
-    0.500000, 0.133975,
-    0.891742, -0.262661, -0.368518,
-    1.000000, 1.000000,
-    0.922682, -0.198387, -0.330607,
-    0.000000, 1.000000,
-    0.924305, -0.131655, -0.358229,
-    0.500000, 0.133975,
-    0.896401, -0.196412, -0.397351,
-    1.000000, 1.000000,
-    0.882837, -0.324864, -0.339209,
-    0.000000, 1.000000,
-    0.891742, -0.262661, -0.368518,
-    0.500000, 0.133975,
-    0.855337, -0.322525, -0.405434,
-    1.000000, 1.000000,
-    0.843911, -0.383614, -0.375039,
-    0.000000, 1.000000,
-    0.882837, -0.324864, -0.339209,
-    0.500000, 0.133975,
-    0.855337, -0.322525, -0.405434,
-    1.000000, 1.000000,
-    0.882837, -0.324864, -0.339209,
-    0.000000, 1.000000,
-    0.916244, -0.264083, -0.301259,
-    0.500000, 0.133975,
-    0.891742, -0.262661, -0.368518,
-    1.000000, 1.000000,
-    0.981483, -0.066604, -0.179596,
-    0.000000, 1.000000,
-    0.978530, 0.000000, -0.206103,
-    0.500000, 0.133975,
-    0.966643, -0.066567, -0.247326,
-    1.000000, 1.000000,
-    0.966393, -0.132792, -0.220117,
-    0.000000, 1.000000,
-    0.981483, -0.066604, -0.179596,
-    0.500000, 0.133975,
-    0.966643, -0.066567, -0.247326,
-    1.000000, 1.000000,
-    0.981483, -0.066604, -0.179596,
-    0.000000, 1.000000,
-    0.990439, 0.000000, -0.137952,
-    0.500000, 0.133975,
-    0.978530, 0.000000, -0.206103,
-    1.000000, 1.000000,
-    -0.545109, -0.790112, -0.280319,
-    0.000000, 1.000000,
-    -0.504209, -0.830359, -0.237229,
-    0.500000, 0.133975,
-    -0.476226, -0.825175, -0.303801,
-    1.000000, 1.000000,
-    -0.516122, -0.783452, -0.346153,
-    0.000000, 1.000000,
-    -0.545109, -0.790112, -0.280319,
-    0.500000, 0.133975,
-    -0.476226, -0.825175, -0.303801,
-    1.000000, 1.000000,
-    -0.545109, -0.790112, -0.280319,
-    0.000000, 1.000000,
-    -0.571252, -0.792649, -0.213023,
-    0.500000, 0.133975,
-    -0.504209, -0.830359, -0.237229,
-    1.000000, 1.000000,
-    -0.446977, -0.816233, -0.366027,
-    0.000000, 1.000000,
-    -0.476226, -0.825175, -0.303801,
-    0.500000, 0.133975,
-    -0.405434, -0.855337, -0.322525,
-    1.000000, 1.000000,
-    -0.375039, -0.843911, -0.383614,
-    0.000000, 1.000000,
-    -0.446977, -0.816233, -0.366027,
-    0.500000, 0.133975,
-    -0.405434, -0.855337, -0.322525,
-    1.000000, 1.000000,
-    -0.446977, -0.816233, -0.366027,
-    0.000000, 1.000000,
-    -0.516122, -0.783452, -0.346153,
-    0.500000, 0.133975,
-    -0.476226, -0.825175, -0.303801,
-    1.000000, 1.000000,
-    -0.705236, -0.656620, -0.267381,
-    0.000000, 1.000000,
-    -0.727958, -0.656006, -0.199331,
-    0.500000, 0.133975,
-    -0.672319, -0.703983, -0.228900,
-    1.000000, 1.000000,
-    -0.647412, -0.702310, -0.296005,
-    0.000000, 1.000000,
-    -0.705236, -0.656620, -0.267381,
-    0.500000, 0.133975,
-    -0.672319, -0.703983, -0.228900,
-    1.000000, 1.000000,
-    -0.705236, -0.656620, -0.267381,
-    0.000000, 1.000000,
-    -0.758652, -0.606825, -0.237086,
-    0.500000, 0.133975,
-    -0.727958, -0.656006, -0.199331,
-    1.000000, 1.000000,
-    0.749435, -0.255180, -0.610926,
-    0.000000, 1.000000,
-    0.749786, -0.187432, -0.634579,
-    0.500000, 0.133975,
-    0.703983, -0.228900, -0.672319,
-    1.000000, 1.000000,
-    0.702310, -0.296005, -0.647412,
-    0.000000, 1.000000,
-    0.749435, -0.255180, -0.610926,
-    0.500000, 0.133975,
-    0.703983, -0.228900, -0.672319,
-    1.000000, 1.000000,
-    0.749435, -0.255180, -0.610926,
-    0.000000, 1.000000,
-    0.792649, -0.213023, -0.571252,
-    0.500000, 0.133975,
-    0.749786, -0.187432, -0.634579,
-    1.000000, 1.000000,
-    0.656620, -0.267381, -0.705236,
-    0.000000, 1.000000,
-    0.703983, -0.228900, -0.672319,
-    0.500000, 0.133975,
-    0.656006, -0.199331, -0.727958,
-    1.000000, 1.000000,
-    0.606825, -0.237086, -0.758652,
-    0.000000, 1.000000,
-    0.656620, -0.267381, -0.705236,
-    0.500000, 0.133975,
-    0.656006, -0.199331, -0.727958,
-    1.000000, 1.000000,
-    0.656620, -0.267381, -0.705236,
-    0.000000, 1.000000,
-    0.702310, -0.296005, -0.647412,
-    0.500000, 0.133975,
-    0.703983, -0.228900, -0.672319,
-    1.000000, 1.000000,
-    0.816233, -0.366027, -0.446977,
-    0.000000, 1.000000,
-    0.855337, -0.322525, -0.405434,
-    0.500000, 0.133975,
-    0.825175, -0.303801, -0.476226,
-    1.000000, 1.000000,
-    0.783452, -0.346153, -0.516122,
-    0.000000, 1.000000,
-    0.816233, -0.366027, -0.446977,
-    0.500000, 0.133975,
-    0.825175, -0.303801, -0.476226,
-    1.000000, 1.000000,
-    0.816233, -0.366027, -0.446977,
-    0.000000, 1.000000,
-    0.843911, -0.383614, -0.375039,
-    0.500000, 0.133975,
-    0.855337, -0.322525, -0.405434,
-    1.000000, 1.000000,
-    -0.749435, -0.255180, 0.610926,
-    0.000000, 1.000000,
-    -0.749786, -0.187432, 0.634579,
-    0.500000, 0.133975,
-    -0.703983, -0.228900, 0.672319,
-    1.000000, 1.000000,
-    -0.702310, -0.296005, 0.647412,
-    0.000000, 1.000000,
-    -0.749435, -0.255180, 0.610926,
-    0.500000, 0.133975,
-    -0.703983, -0.228900, 0.672319,
-    1.000000, 1.000000,
-    -0.749435, -0.255180, 0.610926,
-    0.000000, 1.000000,
-    -0.792649, -0.213023, 0.571252,
-    0.500000, 0.133975,
-    -0.749786, -0.187432, 0.634579,
-    1.000000, 1.000000,
-    -0.656620, -0.267381, 0.705236,
-    0.000000, 1.000000,
-    -0.703983, -0.228900, 0.672319,
-    0.500000, 0.133975,
-    -0.656006, -0.199331, 0.727958,
-    1.000000, 1.000000,
-    -0.606825, -0.237086, 0.758652,
-    0.000000, 1.000000,
-    -0.656620, -0.267381, 0.705236,
-    0.500000, 0.133975,
-    -0.656006, -0.199331, 0.727958,
-    1.000000, 1.000000,
-    -0.656620, -0.267381, 0.705236,
-    0.000000, 1.000000,
-    -0.702310, -0.296005, 0.647412,
-    0.500000, 0.133975,
-    -0.703983, -0.228900, 0.672319,
-    1.000000, 1.000000,
-    -0.816233, -0.366027, 0.446977,
-    0.000000, 1.000000,
-    -0.855337, -0.322525, 0.405434,
-    0.500000, 0.133975,
-    -0.825175, -0.303801, 0.476226,
-    1.000000, 1.000000,
-    -0.783452, -0.346153, 0.516122,
-    0.000000, 1.000000,
-    -0.816233, -0.366027, 0.446977,
-    0.500000, 0.133975,
-    -0.825175, -0.303801, 0.476226,
-    1.000000, 1.000000,
-    -0.816233, -0.366027, 0.446977,
-    0.000000, 1.000000,
-    -0.843911, -0.383614, 0.375039,
-    0.500000, 0.133975,
-    -0.855337, -0.322525, 0.405434,
-    1.000000, 1.000000,
-    0.545109, -0.790112, 0.280319,
-    0.000000, 1.000000,
-    0.504209, -0.830359, 0.237229,
-    0.500000, 0.133975,
-    0.476226, -0.825175, 0.303801,
-    1.000000, 1.000000,
-    0.516122, -0.783452, 0.346153,
-    0.000000, 1.000000,
-    0.545109, -0.790112, 0.280319,
-    0.500000, 0.133975,
-    0.476226, -0.825175, 0.303801,
-    1.000000, 1.000000,
-    0.545109, -0.790112, 0.280319,
-    0.000000, 1.000000,
-    0.571252, -0.792649, 0.213023,
-    0.500000, 0.133975,
-    0.504209, -0.830359, 0.237229,
-    1.000000, 1.000000,
-    0.446977, -0.816233, 0.366027,
-    0.000000, 1.000000,
-    0.476226, -0.825175, 0.303801,
-    0.500000, 0.133975,
-    0.405434, -0.855337, 0.322525,
-    1.000000, 1.000000,
-    0.375039, -0.843911, 0.383614,
-    0.000000, 1.000000,
-    0.446977, -0.816233, 0.366027,
-    0.500000, 0.133975,
-    0.405434, -0.855337, 0.322525,
-    1.000000, 1.000000,
-    0.446977, -0.816233, 0.366027,
-    0.000000, 1.000000,
-    0.516122, -0.783452, 0.346153,
-    0.500000, 0.133975,
-    0.476226, -0.825175, 0.303801,
-    1.000000, 1.000000,
-    0.705236, -0.656620, 0.267381,
-    0.000000, 1.000000,
-    0.727958, -0.656006, 0.199331,
-    0.500000, 0.133975,
-    0.672319, -0.703983, 0.228900,
-    1.000000, 1.000000,
-    0.647412, -0.702310, 0.296005,
-    0.000000, 1.000000,
-    0.705236, -0.656620, 0.267381,
-    0.500000, 0.133975,
-    0.672319, -0.703983, 0.228900,
-    1.000000, 1.000000,
-    0.705236, -0.656620, 0.267381,
-    0.000000, 1.000000,
-    0.758652, -0.606825, 0.237086,
-    0.500000, 0.133975,
-    0.727958, -0.656006, 0.199331,
-    1.000000, 1.000000,
-    -0.334140, 0.041302, 0.941618,
-    0.000000, 1.000000,
-    -0.332342, 0.122800, 0.935130,
-    0.500000, 0.133975,
-    -0.265518, 0.081501, 0.960655,
-    1.000000, 1.000000,
-    -0.266405, 0.000000, 0.963861,
-    0.000000, 1.000000,
-    -0.334140, 0.041302, 0.941618,
-    0.500000, 0.133975,
-    -0.265518, 0.081501, 0.960655,
-    1.000000, 1.000000,
-    -0.334140, 0.041302, 0.941618,
-    0.000000, 1.000000,
-    -0.399607, 0.082324, 0.912982,
-    0.500000, 0.133975,
-    -0.332342, 0.122800, 0.935130,
-    1.000000, 1.000000,
-    -0.200368, 0.041251, 0.978852,
-    0.000000, 1.000000,
-    -0.265518, 0.081501, 0.960655,
-    0.500000, 0.133975,
-    -0.198580, 0.122729, 0.972370,
-    1.000000, 1.000000,
-    -0.133071, 0.082242, 0.987688,
-    0.000000, 1.000000,
-    -0.200368, 0.041251, 0.978852,
-    0.500000, 0.133975,
-    -0.198580, 0.122729, 0.972370,
-    1.000000, 1.000000,
-    -0.200368, 0.041251, 0.978852,
-    0.000000, 1.000000,
-    -0.266405, 0.000000, 0.963861,
-    0.500000, 0.133975,
-    -0.265518, 0.081501, 0.960655,
-    1.000000, 1.000000,
-    -0.460882, -0.119755, 0.879345,
-    0.000000, 1.000000,
-    -0.524110, -0.078459, 0.848029,
-    0.500000, 0.133975,
-    -0.464213, -0.041299, 0.884760,
-    1.000000, 1.000000,
-    -0.399607, -0.082324, 0.912982,
-    0.000000, 1.000000,
-    -0.460882, -0.119755, 0.879345,
-    0.500000, 0.133975,
-    -0.464213, -0.041299, 0.884760,
-    1.000000, 1.000000,
-    -0.460882, -0.119755, 0.879345,
-    0.000000, 1.000000,
-    -0.519258, -0.156434, 0.840178,
-    0.500000, 0.133975,
-    -0.524110, -0.078459, 0.848029,
-    1.000000, 1.000000,
-    -0.199094, -0.261550, 0.944433,
-    0.000000, 1.000000,
-    -0.264151, -0.232455, 0.936050,
-    0.500000, 0.133975,
-    -0.198337, -0.191780, 0.961188,
-    1.000000, 1.000000,
-    -0.132792, -0.220117, 0.966393,
-    0.000000, 1.000000,
-    -0.199094, -0.261550, 0.944433,
-    0.500000, 0.133975,
-    -0.198337, -0.191780, 0.961188,
-    1.000000, 1.000000,
-    -0.199094, -0.261550, 0.944433,
-    0.000000, 1.000000,
-    -0.264083, -0.301259, 0.916244,
-    0.500000, 0.133975,
-    -0.264151, -0.232455, 0.936050,
-    1.000000, 1.000000,
-    -0.133256, -0.151549, 0.979426,
-    0.000000, 1.000000,
-    -0.198337, -0.191780, 0.961188,
-    0.500000, 0.133975,
-    -0.198580, -0.122729, 0.972370,
-    1.000000, 1.000000,
-    -0.133071, -0.082242, 0.987688,
-    0.000000, 1.000000,
-    -0.133256, -0.151549, 0.979426,
-    0.500000, 0.133975,
-    -0.198580, -0.122729, 0.972370,
-    1.000000, 1.000000,
-    -0.133256, -0.151549, 0.979426,
-    0.000000, 1.000000,
-    -0.132792, -0.220117, 0.966393,
-    0.500000, 0.133975,
-    -0.198337, -0.191780, 0.961188,
-    1.000000, 1.000000,
-    -0.131749, -0.422364, 0.896801,
-    0.000000, 1.000000,
-    -0.196015, -0.460267, 0.865871,
-    0.500000, 0.133975,
-    -0.196412, -0.397351, 0.896401,
-    1.000000, 1.000000,
-    -0.131655, -0.358229, 0.924305,
-    0.000000, 1.000000,
-    -0.131749, -0.422364, 0.896801,
-    0.500000, 0.133975,
-    -0.196412, -0.397351, 0.896401,
-    1.000000, 1.000000,
-    -0.131749, -0.422364, 0.896801,
-    0.000000, 1.000000,
-    -0.131200, -0.484442, 0.864929,
-    0.500000, 0.133975,
-    -0.196015, -0.460267, 0.865871,
-    1.000000, 1.000000,
-    0.334140, 0.041302, 0.941618,
-    0.000000, 1.000000,
-    0.265518, 0.081501, 0.960655,
-    0.500000, 0.133975,
-    0.332342, 0.122800, 0.935130,
-    1.000000, 1.000000,
-    0.399607, 0.082324, 0.912982,
-    0.000000, 1.000000,
-    0.334140, 0.041302, 0.941618,
-    0.500000, 0.133975,
-    0.332342, 0.122800, 0.935130,
-    1.000000, 1.000000,
-    0.334140, 0.041302, 0.941618,
-    0.000000, 1.000000,
-    0.266405, 0.000000, 0.963861,
-    0.500000, 0.133975,
-    0.265518, 0.081501, 0.960655,
-    1.000000, 1.000000,
-    0.394136, -0.161006, 0.904839,
-    0.000000, 1.000000,
-    0.325530, -0.201189, 0.923880,
-    0.500000, 0.133975,
-    0.332342, -0.122800, 0.935130,
-    1.000000, 1.000000,
-    0.399607, -0.082324, 0.912982,
-    0.000000, 1.000000,
-    0.394136, -0.161006, 0.904839,
-    0.500000, 0.133975,
-    0.332342, -0.122800, 0.935130,
-    1.000000, 1.000000,
-    0.394136, -0.161006, 0.904839,
-    0.000000, 1.000000,
-    0.386187, -0.238677, 0.891007,
-    0.500000, 0.133975,
-    0.325530, -0.201189, 0.923880,
-    1.000000, 1.000000,
-    0.622292, 0.000000, 0.782786,
-    0.000000, 1.000000,
-    0.574458, -0.040675, 0.817523,
-    0.500000, 0.133975,
-    0.574458, 0.040675, 0.817523,
-    1.000000, 1.000000,
-    0.620240, 0.081142, 0.780204,
-    0.000000, 1.000000,
-    0.622292, 0.000000, 0.782786,
-    0.500000, 0.133975,
-    0.574458, 0.040675, 0.817523,
-    1.000000, 1.000000,
-    0.622292, 0.000000, 0.782786,
-    0.000000, 1.000000,
-    0.620240, -0.081142, 0.780204,
-    0.500000, 0.133975,
-    0.574458, -0.040675, 0.817523,
-    1.000000, 1.000000,
-    0.571140, 0.119078, 0.812169,
-    0.000000, 1.000000,
-    0.574458, 0.040675, 0.817523,
-    0.500000, 0.133975,
-    0.524110, 0.078459, 0.848029,
-    1.000000, 1.000000,
-    0.571140, 0.119078, 0.812169,
-    0.000000, 1.000000,
-    0.620240, 0.081142, 0.780204,
-    0.500000, 0.133975,
-    0.574458, 0.040675, 0.817523,
-    1.000000, 1.000000,
-    0.749387, -0.040642, 0.660884,
-    0.000000, 1.000000,
-    0.744727, -0.121144, 0.656282,
-    0.500000, 0.133975,
-    0.708969, -0.080573, 0.700622,
-    1.000000, 1.000000,
-    0.711282, 0.000000, 0.702907,
-    0.000000, 1.000000,
-    0.749387, -0.040642, 0.660884,
-    0.500000, 0.133975,
-    0.708969, -0.080573, 0.700622,
-    1.000000, 1.000000,
-    0.749387, -0.040642, 0.660884,
-    0.000000, 1.000000,
-    0.783843, -0.081086, 0.615642,
-    0.500000, 0.133975,
-    0.744727, -0.121144, 0.656282,
-    1.000000, 1.000000,
-    0.334140, 0.041302, -0.941618,
-    0.000000, 1.000000,
-    0.332342, 0.122800, -0.935130,
-    0.500000, 0.133975,
-    0.265518, 0.081501, -0.960655,
-    1.000000, 1.000000,
-    0.266405, 0.000000, -0.963861,
-    0.000000, 1.000000,
-    0.334140, 0.041302, -0.941618,
-    0.500000, 0.133975,
-    0.265518, 0.081501, -0.960655,
-    1.000000, 1.000000,
-    0.334140, 0.041302, -0.941618,
-    0.000000, 1.000000,
-    0.399607, 0.082324, -0.912982,
-    0.500000, 0.133975,
-    0.332342, 0.122800, -0.935130,
-    1.000000, 1.000000,
-    0.200368, 0.041251, -0.978852,
-    0.000000, 1.000000,
-    0.265518, 0.081501, -0.960655,
-    0.500000, 0.133975,
-    0.198580, 0.122729, -0.972370,
-    1.000000, 1.000000,
-    0.133071, 0.082242, -0.987688,
-    0.000000, 1.000000,
-    0.200368, 0.041251, -0.978852,
-    0.500000, 0.133975,
-    0.198580, 0.122729, -0.972370,
-    1.000000, 1.000000,
-    0.200368, 0.041251, -0.978852,
-    0.000000, 1.000000,
-    0.266405, 0.000000, -0.963861,
-    0.500000, 0.133975,
-    0.265518, 0.081501, -0.960655,
-    1.000000, 1.000000,
-    0.460882, -0.119755, -0.879345,
-    0.000000, 1.000000,
-    0.524110, -0.078459, -0.848029,
-    0.500000, 0.133975,
-    0.464213, -0.041299, -0.884760,
-    1.000000, 1.000000,
-    0.399607, -0.082324, -0.912982,
-    0.000000, 1.000000,
-    0.460882, -0.119755, -0.879345,
-    0.500000, 0.133975,
-    0.464213, -0.041299, -0.884760,
-    1.000000, 1.000000,
-    0.460882, -0.119755, -0.879345,
-    0.000000, 1.000000,
-    0.519258, -0.156434, -0.840178,
-    0.500000, 0.133975,
-    0.524110, -0.078459, -0.848029,
-    1.000000, 1.000000,
-    0.199094, -0.261550, -0.944433,
-    0.000000, 1.000000,
-    0.264151, -0.232455, -0.936050,
-    0.500000, 0.133975,
-    0.198337, -0.191780, -0.961188,
-    1.000000, 1.000000,
-    0.132792, -0.220117, -0.966393,
-    0.000000, 1.000000,
-    0.199094, -0.261550, -0.944433,
-    0.500000, 0.133975,
-    0.198337, -0.191780, -0.961188,
-    1.000000, 1.000000,
-    0.199094, -0.261550, -0.944433,
-    0.000000, 1.000000,
-    0.264083, -0.301259, -0.916244,
-    0.500000, 0.133975,
-    0.264151, -0.232455, -0.936050,
-    1.000000, 1.000000,
-    0.133256, -0.151549, -0.979426,
-    0.000000, 1.000000,
-    0.198337, -0.191780, -0.961188,
-    0.500000, 0.133975,
-    0.198580, -0.122729, -0.972370,
-    1.000000, 1.000000,
-    0.133071, -0.082242, -0.987688,
-    0.000000, 1.000000,
-    0.133256, -0.151549, -0.979426,
-    0.500000, 0.133975,
-    0.198580, -0.122729, -0.972370,
-    1.000000, 1.000000,
-    0.133256, -0.151549, -0.979426,
-    0.000000, 1.000000,
-    0.132792, -0.220117, -0.966393,
-    0.500000, 0.133975,
-    0.198337, -0.191780, -0.961188,
-    1.000000, 1.000000,
-    0.131749, -0.422364, -0.896801,
-    0.000000, 1.000000,
-    0.196015, -0.460267, -0.865871,
-    0.500000, 0.133975,
-    0.196412, -0.397351, -0.896401,
-    1.000000, 1.000000,
-    0.131655, -0.358229, -0.924305,
-    0.000000, 1.000000,
-    0.131749, -0.422364, -0.896801,
-    0.500000, 0.133975,
-    0.196412, -0.397351, -0.896401,
-    1.000000, 1.000000,
-    0.131749, -0.422364, -0.896801,
-    0.000000, 1.000000,
-    0.131200, -0.484442, -0.864929,
-    0.500000, 0.133975,
-    0.196015, -0.460267, -0.865871,
-    1.000000, 1.000000,
-    -0.334140, 0.041302, -0.941618,
-    0.000000, 1.000000,
-    -0.265518, 0.081501, -0.960655,
-    0.500000, 0.133975,
-    -0.332342, 0.122800, -0.935130,
-    1.000000, 1.000000,
-    -0.399607, 0.082324, -0.912982,
-    0.000000, 1.000000,
-    -0.334140, 0.041302, -0.941618,
-    0.500000, 0.133975,
-    -0.332342, 0.122800, -0.935130,
-    1.000000, 1.000000,
-    -0.334140, 0.041302, -0.941618,
-    0.000000, 1.000000,
-    -0.266405, 0.000000, -0.963861,
-    0.500000, 0.133975,
-    -0.265518, 0.081501, -0.960655,
-    1.000000, 1.000000,
-    -0.394136, -0.161006, -0.904839,
-    0.000000, 1.000000,
-    -0.325530, -0.201189, -0.923880,
-    0.500000, 0.133975,
-    -0.332342, -0.122800, -0.935130,
-    1.000000, 1.000000,
-    -0.399607, -0.082324, -0.912982,
-    0.000000, 1.000000,
-    -0.394136, -0.161006, -0.904839,
-    0.500000, 0.133975,
-    -0.332342, -0.122800, -0.935130,
-    1.000000, 1.000000,
-    -0.394136, -0.161006, -0.904839,
-    0.000000, 1.000000,
-    -0.386187, -0.238677, -0.891007,
-    0.500000, 0.133975,
-    -0.325530, -0.201189, -0.923880,
-    1.000000, 1.000000,
-    -0.622292, 0.000000, -0.782786,
-    0.000000, 1.000000,
-    -0.574458, -0.040675, -0.817523,
-    0.500000, 0.133975,
-    -0.574458, 0.040675, -0.817523,
-    1.000000, 1.000000,
-    -0.620240, 0.081142, -0.780204,
-    0.000000, 1.000000,
-    -0.622292, 0.000000, -0.782786,
-    0.500000, 0.133975,
-    -0.574458, 0.040675, -0.817523,
-    1.000000, 1.000000,
-    -0.622292, 0.000000, -0.782786,
-    0.000000, 1.000000,
-    -0.620240, -0.081142, -0.780204,
-    0.500000, 0.133975,
-    -0.574458, -0.040675, -0.817523,
-    1.000000, 1.000000,
-    -0.571140, 0.119078, -0.812169,
-    0.000000, 1.000000,
-    -0.574458, 0.040675, -0.817523,
-    0.500000, 0.133975,
-    -0.524110, 0.078459, -0.848029,
-    1.000000, 1.000000,
-    -0.571140, 0.119078, -0.812169,
-    0.000000, 1.000000,
-    -0.620240, 0.081142, -0.780204,
-    0.500000, 0.133975,
-    -0.574458, 0.040675, -0.817523,
-    1.000000, 1.000000,
-    -0.749387, -0.040642, -0.660884,
-    0.000000, 1.000000,
-    -0.744727, -0.121144, -0.656282,
-    0.500000, 0.133975,
-    -0.708969, -0.080573, -0.700622,
-    1.000000, 1.000000,
-    -0.711282, 0.000000, -0.702907,
-    0.000000, 1.000000,
-    -0.749387, -0.040642, -0.660884,
-    0.500000, 0.133975,
-    -0.708969, -0.080573, -0.700622,
-    1.000000, 1.000000,
-    -0.749387, -0.040642, -0.660884,
-    0.000000, 1.000000,
-    -0.783843, -0.081086, -0.615642,
-    0.500000, 0.133975,
-    -0.744727, -0.121144, -0.656282,
-    1.000000, 1.000000,
-    0.000000, -0.916092, 0.400968,
-    0.000000, 1.000000,
-    -0.041299, -0.884760, 0.464213,
-    0.500000, 0.133975,
-    0.041299, -0.884760, 0.464213,
-    1.000000, 1.000000,
-    0.082324, -0.912982, 0.399607,
-    0.000000, 1.000000,
-    0.000000, -0.916092, 0.400968,
-    0.500000, 0.133975,
-    0.041299, -0.884760, 0.464213,
-    1.000000, 1.000000,
-    0.000000, -0.916092, 0.400968,
-    0.000000, 1.000000,
-    -0.082324, -0.912982, 0.399607,
-    0.500000, 0.133975,
-    -0.041299, -0.884760, 0.464213,
-    1.000000, 1.000000,
-    0.119755, -0.879345, 0.460882,
-    0.000000, 1.000000,
-    0.041299, -0.884760, 0.464213,
-    0.500000, 0.133975,
-    0.078459, -0.848029, 0.524110,
-    1.000000, 1.000000,
-    0.156434, -0.840178, 0.519258,
-    0.000000, 1.000000,
-    0.119755, -0.879345, 0.460882,
-    0.500000, 0.133975,
-    0.078459, -0.848029, 0.524110,
-    1.000000, 1.000000,
-    0.119755, -0.879345, 0.460882,
-    0.000000, 1.000000,
-    0.082324, -0.912982, 0.399607,
-    0.500000, 0.133975,
-    0.041299, -0.884760, 0.464213,
-    1.000000, 1.000000,
-    -0.041251, -0.978852, 0.200368,
-    0.000000, 1.000000,
-    -0.122729, -0.972370, 0.198580,
-    0.500000, 0.133975,
-    -0.081501, -0.960655, 0.265518,
-    1.000000, 1.000000,
-    0.000000, -0.963861, 0.266405,
-    0.000000, 1.000000,
-    -0.041251, -0.978852, 0.200368,
-    0.500000, 0.133975,
-    -0.081501, -0.960655, 0.265518,
-    1.000000, 1.000000,
-    -0.041251, -0.978852, 0.200368,
-    0.000000, 1.000000,
-    -0.082242, -0.987688, 0.133071,
-    0.500000, 0.133975,
-    -0.122729, -0.972370, 0.198580,
-    1.000000, 1.000000,
-    -0.040677, -0.743496, 0.667502,
-    0.000000, 1.000000,
-    -0.121193, -0.738886, 0.662842,
-    0.500000, 0.133975,
-    -0.080573, -0.700622, 0.708969,
-    1.000000, 1.000000,
-    0.000000, -0.702907, 0.711282,
-    0.000000, 1.000000,
-    -0.040677, -0.743496, 0.667502,
-    0.500000, 0.133975,
-    -0.080573, -0.700622, 0.708969,
-    1.000000, 1.000000,
-    -0.040677, -0.743496, 0.667502,
-    0.000000, 1.000000,
-    -0.081142, -0.780204, 0.620240,
-    0.500000, 0.133975,
-    -0.121193, -0.738886, 0.662842,
-    1.000000, 1.000000,
-    -0.040642, -0.660884, 0.749387,
-    0.000000, 1.000000,
-    -0.080573, -0.700622, 0.708969,
-    0.500000, 0.133975,
-    -0.121144, -0.656282, 0.744727,
-    1.000000, 1.000000,
-    -0.081086, -0.615642, 0.783843,
-    0.000000, 1.000000,
-    -0.040642, -0.660884, 0.749387,
-    0.500000, 0.133975,
-    -0.121144, -0.656282, 0.744727,
-    1.000000, 1.000000,
-    -0.040642, -0.660884, 0.749387,
-    0.000000, 1.000000,
-    0.000000, -0.702907, 0.711282,
-    0.500000, 0.133975,
-    -0.080573, -0.700622, 0.708969,
-    1.000000, 1.000000,
-    0.119078, -0.812169, 0.571140,
-    0.000000, 1.000000,
-    0.078459, -0.848029, 0.524110,
-    0.500000, 0.133975,
-    0.040675, -0.817523, 0.574458,
-    1.000000, 1.000000,
-    0.081142, -0.780204, 0.620240,
-    0.000000, 1.000000,
-    0.119078, -0.812169, 0.571140,
-    0.500000, 0.133975,
-    0.040675, -0.817523, 0.574458,
-    1.000000, 1.000000,
-    0.119078, -0.812169, 0.571140,
-    0.000000, 1.000000,
-    0.156434, -0.840178, 0.519258,
-    0.500000, 0.133975,
-    0.078459, -0.848029, 0.524110,
-    1.000000, 1.000000,
-    0.261550, -0.944433, 0.199094,
-    0.000000, 1.000000,
-    0.191780, -0.961188, 0.198337,
-    0.500000, 0.133975,
-    0.232455, -0.936050, 0.264151,
-    1.000000, 1.000000,
-    0.301259, -0.916244, 0.264083,
-    0.000000, 1.000000,
-    0.261550, -0.944433, 0.199094,
-    0.500000, 0.133975,
-    0.232455, -0.936050, 0.264151,
-    1.000000, 1.000000,
-    0.261550, -0.944433, 0.199094,
-    0.000000, 1.000000,
-    0.220117, -0.966393, 0.132792,
-    0.500000, 0.133975,
-    0.191780, -0.961188, 0.198337,
-    1.000000, 1.000000,
-    0.270627, -0.905832, 0.325929,
-    0.000000, 1.000000,
-    0.232455, -0.936050, 0.264151,
-    0.500000, 0.133975,
-    0.201189, -0.923880, 0.325530,
-    1.000000, 1.000000,
-    0.238677, -0.891007, 0.386187,
-    0.000000, 1.000000,
-    0.270627, -0.905832, 0.325929,
-    0.500000, 0.133975,
-    0.201189, -0.923880, 0.325530,
-    1.000000, 1.000000,
-    0.270627, -0.905832, 0.325929,
-    0.000000, 1.000000,
-    0.301259, -0.916244, 0.264083,
-    0.500000, 0.133975,
-    0.232455, -0.936050, 0.264151,
-    1.000000, 1.000000,
-    0.381722, -0.921919, 0.065988,
-    0.000000, 1.000000,
-    0.339123, -0.940742, 0.000000,
-    0.500000, 0.133975,
-    0.316778, -0.946198, 0.066042,
-    1.000000, 1.000000,
-    0.358229, -0.924305, 0.131655,
-    0.000000, 1.000000,
-    0.381722, -0.921919, 0.065988,
-    0.500000, 0.133975,
-    0.316778, -0.946198, 0.066042,
-    1.000000, 1.000000,
-    0.381722, -0.921919, 0.065988,
-    0.000000, 1.000000,
-    0.403355, -0.915043, 0.000000,
-    0.500000, 0.133975,
-    0.339123, -0.940742, 0.000000,
-    1.000000, 1.000000,
-    0.000000, -0.916092, -0.400968,
-    0.000000, 1.000000,
-    0.041299, -0.884760, -0.464213,
-    0.500000, 0.133975,
-    -0.041299, -0.884760, -0.464213,
-    1.000000, 1.000000,
-    -0.082324, -0.912982, -0.399607,
-    0.000000, 1.000000,
-    0.000000, -0.916092, -0.400968,
-    0.500000, 0.133975,
-    -0.041299, -0.884760, -0.464213,
-    1.000000, 1.000000,
-    0.000000, -0.916092, -0.400968,
-    0.000000, 1.000000,
-    0.082324, -0.912982, -0.399607,
-    0.500000, 0.133975,
-    0.041299, -0.884760, -0.464213,
-    1.000000, 1.000000,
-    -0.119755, -0.879345, -0.460882,
-    0.000000, 1.000000,
-    -0.041299, -0.884760, -0.464213,
-    0.500000, 0.133975,
-    -0.078459, -0.848029, -0.524110,
-    1.000000, 1.000000,
-    -0.156434, -0.840178, -0.519258,
-    0.000000, 1.000000,
-    -0.119755, -0.879345, -0.460882,
-    0.500000, 0.133975,
-    -0.078459, -0.848029, -0.524110,
-    1.000000, 1.000000,
-    -0.119755, -0.879345, -0.460882,
-    0.000000, 1.000000,
-    -0.082324, -0.912982, -0.399607,
-    0.500000, 0.133975,
-    -0.041299, -0.884760, -0.464213,
-    1.000000, 1.000000,
-    0.041251, -0.978852, -0.200368,
-    0.000000, 1.000000,
-    0.122729, -0.972370, -0.198580,
-    0.500000, 0.133975,
-    0.081501, -0.960655, -0.265518,
-    1.000000, 1.000000,
-    0.000000, -0.963861, -0.266405,
-    0.000000, 1.000000,
-    0.041251, -0.978852, -0.200368,
-    0.500000, 0.133975,
-    0.081501, -0.960655, -0.265518,
-    1.000000, 1.000000,
-    0.041251, -0.978852, -0.200368,
-    0.000000, 1.000000,
-    0.082242, -0.987688, -0.133071,
-    0.500000, 0.133975,
-    0.122729, -0.972370, -0.198580,
-    1.000000, 1.000000,
-    0.040677, -0.743496, -0.667502,
-    0.000000, 1.000000,
-    0.121193, -0.738886, -0.662842,
-    0.500000, 0.133975,
-    0.080573, -0.700622, -0.708969,
-    1.000000, 1.000000,
-    0.000000, -0.702907, -0.711282,
-    0.000000, 1.000000,
-    0.040677, -0.743496, -0.667502,
-    0.500000, 0.133975,
-    0.080573, -0.700622, -0.708969,
-    1.000000, 1.000000,
-    0.040677, -0.743496, -0.667502,
-    0.000000, 1.000000,
-    0.081142, -0.780204, -0.620240,
-    0.500000, 0.133975,
-    0.121193, -0.738886, -0.662842,
-    1.000000, 1.000000,
-    0.040642, -0.660884, -0.749387,
-    0.000000, 1.000000,
-    0.080573, -0.700622, -0.708969,
-    0.500000, 0.133975,
-    0.121144, -0.656282, -0.744727,
-    1.000000, 1.000000,
-    0.081086, -0.615642, -0.783843,
-    0.000000, 1.000000,
-    0.040642, -0.660884, -0.749387,
-    0.500000, 0.133975,
-    0.121144, -0.656282, -0.744727,
-    1.000000, 1.000000,
-    0.040642, -0.660884, -0.749387,
-    0.000000, 1.000000,
-    0.000000, -0.702907, -0.711282,
-    0.500000, 0.133975,
-    0.080573, -0.700622, -0.708969,
-    1.000000, 1.000000,
-    -0.119078, -0.812169, -0.571140,
-    0.000000, 1.000000,
-    -0.078459, -0.848029, -0.524110,
-    0.500000, 0.133975,
-    -0.040675, -0.817523, -0.574458,
-    1.000000, 1.000000,
-    -0.081142, -0.780204, -0.620240,
-    0.000000, 1.000000,
-    -0.119078, -0.812169, -0.571140,
-    0.500000, 0.133975,
-    -0.040675, -0.817523, -0.574458,
-    1.000000, 1.000000,
-    -0.119078, -0.812169, -0.571140,
-    0.000000, 1.000000,
-    -0.156434, -0.840178, -0.519258,
-    0.500000, 0.133975,
-    -0.078459, -0.848029, -0.524110,
-    1.000000, 1.000000,
-    -0.261550, -0.944433, -0.199094,
-    0.000000, 1.000000,
-    -0.191780, -0.961188, -0.198337,
-    0.500000, 0.133975,
-    -0.232455, -0.936050, -0.264151,
-    1.000000, 1.000000,
-    -0.301259, -0.916244, -0.264083,
-    0.000000, 1.000000,
-    -0.261550, -0.944433, -0.199094,
-    0.500000, 0.133975,
-    -0.232455, -0.936050, -0.264151,
-    1.000000, 1.000000,
-    -0.261550, -0.944433, -0.199094,
-    0.000000, 1.000000,
-    -0.220117, -0.966393, -0.132792,
-    0.500000, 0.133975,
-    -0.191780, -0.961188, -0.198337,
-    1.000000, 1.000000,
-    -0.270627, -0.905832, -0.325929,
-    0.000000, 1.000000,
-    -0.232455, -0.936050, -0.264151,
-    0.500000, 0.133975,
-    -0.201189, -0.923880, -0.325530,
-    1.000000, 1.000000,
-    -0.238677, -0.891007, -0.386187,
-    0.000000, 1.000000,
-    -0.270627, -0.905832, -0.325929,
-    0.500000, 0.133975,
-    -0.201189, -0.923880, -0.325530,
-    1.000000, 1.000000,
-    -0.270627, -0.905832, -0.325929,
-    0.000000, 1.000000,
-    -0.301259, -0.916244, -0.264083,
-    0.500000, 0.133975,
-    -0.232455, -0.936050, -0.264151,
-    1.000000, 1.000000,
-    -0.381722, -0.921919, -0.065988,
-    0.000000, 1.000000,
-    -0.339123, -0.940742, 0.000000,
-    0.500000, 0.133975,
-    -0.316778, -0.946198, -0.066042,
-    1.000000, 1.000000,
-    -0.358229, -0.924305, -0.131655,
-    0.000000, 1.000000,
-    -0.381722, -0.921919, -0.065988,
-    0.500000, 0.133975,
-    -0.316778, -0.946198, -0.066042,
-    1.000000, 1.000000,
-    -0.381722, -0.921919, -0.065988,
-    0.000000, 1.000000,
-    -0.403355, -0.915043, 0.000000,
-    0.500000, 0.133975,
-    -0.339123, -0.940742, 0.000000,
-    1.000000, 1.000000,
-    -0.921919, 0.065988, 0.381722,
-    0.000000, 1.000000,
-    -0.940742, 0.000000, 0.339123,
-    0.500000, 0.133975,
-    -0.946198, 0.066042, 0.316778,
-    1.000000, 1.000000,
-    -0.921919, 0.065988, 0.381722,
-    0.000000, 1.000000,
-    -0.915043, 0.000000, 0.403355,
-    0.500000, 0.133975,
-    -0.940742, 0.000000, 0.339123,
-    1.000000, 1.000000,
-    -0.916092, -0.400968, 0.000000,
-    0.000000, 1.000000,
-    -0.884760, -0.464213, 0.041299,
-    0.500000, 0.133975,
-    -0.884760, -0.464213, -0.041299,
-    1.000000, 1.000000,
-    -0.912982, -0.399607, -0.082324,
-    0.000000, 1.000000,
-    -0.916092, -0.400968, 0.000000,
-    0.500000, 0.133975,
-    -0.884760, -0.464213, -0.041299,
-    1.000000, 1.000000,
-    -0.916092, -0.400968, 0.000000,
-    0.000000, 1.000000,
-    -0.912982, -0.399607, 0.082324,
-    0.500000, 0.133975,
-    -0.884760, -0.464213, 0.041299,
-    1.000000, 1.000000,
-    -0.879345, -0.460882, -0.119755,
-    0.000000, 1.000000,
-    -0.884760, -0.464213, -0.041299,
-    0.500000, 0.133975,
-    -0.848029, -0.524110, -0.078459,
-    1.000000, 1.000000,
-    -0.840178, -0.519258, -0.156434,
-    0.000000, 1.000000,
-    -0.879345, -0.460882, -0.119755,
-    0.500000, 0.133975,
-    -0.848029, -0.524110, -0.078459,
-    1.000000, 1.000000,
-    -0.879345, -0.460882, -0.119755,
-    0.000000, 1.000000,
-    -0.912982, -0.399607, -0.082324,
-    0.500000, 0.133975,
-    -0.884760, -0.464213, -0.041299,
-    1.000000, 1.000000,
-    -0.978852, -0.200368, 0.041251,
-    0.000000, 1.000000,
-    -0.972370, -0.198580, 0.122729,
-    0.500000, 0.133975,
-    -0.960655, -0.265518, 0.081501,
-    1.000000, 1.000000,
-    -0.963861, -0.266405, 0.000000,
-    0.000000, 1.000000,
-    -0.978852, -0.200368, 0.041251,
-    0.500000, 0.133975,
-    -0.960655, -0.265518, 0.081501,
-    1.000000, 1.000000,
-    -0.978852, -0.200368, 0.041251,
-    0.000000, 1.000000,
-    -0.987688, -0.133071, 0.082242,
-    0.500000, 0.133975,
-    -0.972370, -0.198580, 0.122729,
-    1.000000, 1.000000,
-    -0.743496, -0.667502, 0.040677,
-    0.000000, 1.000000,
-    -0.738886, -0.662842, 0.121193,
-    0.500000, 0.133975,
-    -0.700622, -0.708969, 0.080573,
-    1.000000, 1.000000,
-    -0.702907, -0.711282, 0.000000,
-    0.000000, 1.000000,
-    -0.743496, -0.667502, 0.040677,
-    0.500000, 0.133975,
-    -0.700622, -0.708969, 0.080573,
-    1.000000, 1.000000,
-    -0.743496, -0.667502, 0.040677,
-    0.000000, 1.000000,
-    -0.780204, -0.620240, 0.081142,
-    0.500000, 0.133975,
-    -0.738886, -0.662842, 0.121193,
-    1.000000, 1.000000,
-    -0.660884, -0.749387, 0.040642,
-    0.000000, 1.000000,
-    -0.700622, -0.708969, 0.080573,
-    0.500000, 0.133975,
-    -0.656282, -0.744727, 0.121144,
-    1.000000, 1.000000,
-    -0.615642, -0.783843, 0.081086,
-    0.000000, 1.000000,
-    -0.660884, -0.749387, 0.040642,
-    0.500000, 0.133975,
-    -0.656282, -0.744727, 0.121144,
-    1.000000, 1.000000,
-    -0.660884, -0.749387, 0.040642,
-    0.000000, 1.000000,
-    -0.702907, -0.711282, 0.000000,
-    0.500000, 0.133975,
-    -0.700622, -0.708969, 0.080573,
-    1.000000, 1.000000,
-    -0.812169, -0.571140, -0.119078,
-    0.000000, 1.000000,
-    -0.848029, -0.524110, -0.078459,
-    0.500000, 0.133975,
-    -0.817523, -0.574458, -0.040675,
-    1.000000, 1.000000,
-    -0.780204, -0.620240, -0.081142,
-    0.000000, 1.000000,
-    -0.812169, -0.571140, -0.119078,
-    0.500000, 0.133975,
-    -0.817523, -0.574458, -0.040675,
-    1.000000, 1.000000,
-    -0.812169, -0.571140, -0.119078,
-    0.000000, 1.000000,
-    -0.840178, -0.519258, -0.156434,
-    0.500000, 0.133975,
-    -0.848029, -0.524110, -0.078459,
-    1.000000, 1.000000,
-    -0.944433, -0.199094, -0.261550,
-    0.000000, 1.000000,
-    -0.961188, -0.198337, -0.191780,
-    0.500000, 0.133975,
-    -0.936050, -0.264151, -0.232455,
-    1.000000, 1.000000,
-    -0.916244, -0.264083, -0.301259,
-    0.000000, 1.000000,
-    -0.944433, -0.199094, -0.261550,
-    0.500000, 0.133975,
-    -0.936050, -0.264151, -0.232455,
-    1.000000, 1.000000,
-    -0.944433, -0.199094, -0.261550,
-    0.000000, 1.000000,
-    -0.966393, -0.132792, -0.220117,
-    0.500000, 0.133975,
-    -0.961188, -0.198337, -0.191780,
-    1.000000, 1.000000,
-    -0.905832, -0.325929, -0.270627,
-    0.000000, 1.000000,
-    -0.936050, -0.264151, -0.232455,
-    0.500000, 0.133975,
-    -0.923880, -0.325530, -0.201189,
-    1.000000, 1.000000,
-    -0.891007, -0.386187, -0.238677,
-    0.000000, 1.000000,
-    -0.905832, -0.325929, -0.270627,
-    0.500000, 0.133975,
-    -0.923880, -0.325530, -0.201189,
-    1.000000, 1.000000,
-    -0.905832, -0.325929, -0.270627,
-    0.000000, 1.000000,
-    -0.916244, -0.264083, -0.301259,
-    0.500000, 0.133975,
-    -0.936050, -0.264151, -0.232455,
-    1.000000, 1.000000,
-    -0.921919, -0.065988, -0.381722,
-    0.000000, 1.000000,
-    -0.940742, 0.000000, -0.339123,
-    0.500000, 0.133975,
-    -0.946198, -0.066042, -0.316778,
-    1.000000, 1.000000,
-    -0.924305, -0.131655, -0.358229,
-    0.000000, 1.000000,
-    -0.921919, -0.065988, -0.381722,
-    0.500000, 0.133975,
-    -0.946198, -0.066042, -0.316778,
-    1.000000, 1.000000,
-    -0.921919, -0.065988, -0.381722,
-    0.000000, 1.000000,
-    -0.915043, 0.000000, -0.403355,
-    0.500000, 0.133975,
-    -0.940742, 0.000000, -0.339123,
-    1.000000, 1.000000,
-    0.921919, 0.065988, -0.381722,
-    0.000000, 1.000000,
-    0.940742, 0.000000, -0.339123,
-    0.500000, 0.133975,
-    0.946198, 0.066042, -0.316778,
-    1.000000, 1.000000,
-    0.921919, 0.065988, -0.381722,
-    0.000000, 1.000000,
-    0.915043, 0.000000, -0.403355,
-    0.500000, 0.133975,
-    0.940742, 0.000000, -0.339123,
-    1.000000, 1.000000,
-    0.916092, -0.400968, 0.000000,
-    0.000000, 1.000000,
-    0.884760, -0.464213, -0.041299,
-    0.500000, 0.133975,
-    0.884760, -0.464213, 0.041299,
-    1.000000, 1.000000,
-    0.912982, -0.399607, 0.082324,
-    0.000000, 1.000000,
-    0.916092, -0.400968, 0.000000,
-    0.500000, 0.133975,
-    0.884760, -0.464213, 0.041299,
-    1.000000, 1.000000,
-    0.916092, -0.400968, 0.000000,
-    0.000000, 1.000000,
-    0.912982, -0.399607, -0.082324,
-    0.500000, 0.133975,
-    0.884760, -0.464213, -0.041299,
-    1.000000, 1.000000,
-    0.879345, -0.460882, 0.119755,
-    0.000000, 1.000000,
-    0.884760, -0.464213, 0.041299,
-    0.500000, 0.133975,
-    0.848029, -0.524110, 0.078459,
-    1.000000, 1.000000,
-    0.840178, -0.519258, 0.156434,
-    0.000000, 1.000000,
-    0.879345, -0.460882, 0.119755,
-    0.500000, 0.133975,
-    0.848029, -0.524110, 0.078459,
-    1.000000, 1.000000,
-    0.879345, -0.460882, 0.119755,
-    0.000000, 1.000000,
-    0.912982, -0.399607, 0.082324,
-    0.500000, 0.133975,
-    0.884760, -0.464213, 0.041299,
-    1.000000, 1.000000,
-    0.978852, -0.200368, -0.041251,
-    0.000000, 1.000000,
-    0.972370, -0.198580, -0.122729,
-    0.500000, 0.133975,
-    0.960655, -0.265518, -0.081501,
-    1.000000, 1.000000,
-    0.963861, -0.266405, 0.000000,
-    0.000000, 1.000000,
-    0.978852, -0.200368, -0.041251,
-    0.500000, 0.133975,
-    0.960655, -0.265518, -0.081501,
-    1.000000, 1.000000,
-    0.978852, -0.200368, -0.041251,
-    0.000000, 1.000000,
-    0.987688, -0.133071, -0.082242,
-    0.500000, 0.133975,
-    0.972370, -0.198580, -0.122729,
-    1.000000, 1.000000,
-    0.743496, -0.667502, -0.040677,
-    0.000000, 1.000000,
-    0.738886, -0.662842, -0.121193,
-    0.500000, 0.133975,
-    0.700622, -0.708969, -0.080573,
-    1.000000, 1.000000,
-    0.702907, -0.711282, 0.000000,
-    0.000000, 1.000000,
-    0.743496, -0.667502, -0.040677,
-    0.500000, 0.133975,
-    0.700622, -0.708969, -0.080573,
-    1.000000, 1.000000,
-    0.743496, -0.667502, -0.040677,
-    0.000000, 1.000000,
-    0.780204, -0.620240, -0.081142,
-    0.500000, 0.133975,
-    0.738886, -0.662842, -0.121193,
-    1.000000, 1.000000,
-    0.660884, -0.749387, -0.040642,
-    0.000000, 1.000000,
-    0.700622, -0.708969, -0.080573,
-    0.500000, 0.133975,
-    0.656282, -0.744727, -0.121144,
-    1.000000, 1.000000,
-    0.615642, -0.783843, -0.081086,
-    0.000000, 1.000000,
-    0.660884, -0.749387, -0.040642,
-    0.500000, 0.133975,
-    0.656282, -0.744727, -0.121144,
-    1.000000, 1.000000,
-    0.660884, -0.749387, -0.040642,
-    0.000000, 1.000000,
-    0.702907, -0.711282, 0.000000,
-    0.500000, 0.133975,
-    0.700622, -0.708969, -0.080573,
-    1.000000, 1.000000,
-    0.812169, -0.571140, 0.119078,
-    0.000000, 1.000000,
-    0.848029, -0.524110, 0.078459,
-    0.500000, 0.133975,
-    0.817523, -0.574458, 0.040675,
-    1.000000, 1.000000,
-    0.780204, -0.620240, 0.081142,
-    0.000000, 1.000000,
-    0.812169, -0.571140, 0.119078,
-    0.500000, 0.133975,
-    0.817523, -0.574458, 0.040675,
-    1.000000, 1.000000,
-    0.812169, -0.571140, 0.119078,
-    0.000000, 1.000000,
-    0.840178, -0.519258, 0.156434,
-    0.500000, 0.133975,
-    0.848029, -0.524110, 0.078459,
-    1.000000, 1.000000,
-    0.944433, -0.199094, 0.261550,
-    0.000000, 1.000000,
-    0.961188, -0.198337, 0.191780,
-    0.500000, 0.133975,
-    0.936050, -0.264151, 0.232455,
-    1.000000, 1.000000,
-    0.916244, -0.264083, 0.301259,
-    0.000000, 1.000000,
-    0.944433, -0.199094, 0.261550,
-    0.500000, 0.133975,
-    0.936050, -0.264151, 0.232455,
-    1.000000, 1.000000,
-    0.944433, -0.199094, 0.261550,
-    0.000000, 1.000000,
-    0.966393, -0.132792, 0.220117,
-    0.500000, 0.133975,
-    0.961188, -0.198337, 0.191780,
-    1.000000, 1.000000,
-    0.905832, -0.325929, 0.270627,
-    0.000000, 1.000000,
-    0.936050, -0.264151, 0.232455,
-    0.500000, 0.133975,
-    0.923880, -0.325530, 0.201189,
-    1.000000, 1.000000,
-    0.891007, -0.386187, 0.238677,
-    0.000000, 1.000000,
-    0.905832, -0.325929, 0.270627,
-    0.500000, 0.133975,
-    0.923880, -0.325530, 0.201189,
-    1.000000, 1.000000,
-    0.905832, -0.325929, 0.270627,
-    0.000000, 1.000000,
-    0.916244, -0.264083, 0.301259,
-    0.500000, 0.133975,
-    0.936050, -0.264151, 0.232455,
-    1.000000, 1.000000,
-    0.921919, -0.065988, 0.381722,
-    0.000000, 1.000000,
-    0.940742, 0.000000, 0.339123,
-    0.500000, 0.133975,
-    0.946198, -0.066042, 0.316778,
-    1.000000, 1.000000,
-    0.924305, -0.131655, 0.358229,
-    0.000000, 1.000000,
-    0.921919, -0.065988, 0.381722,
-    0.500000, 0.133975,
-    0.946198, -0.066042, 0.316778,
-    1.000000, 1.000000,
-    0.921919, -0.065988, 0.381722,
-    0.000000, 1.000000,
-    0.915043, 0.000000, 0.403355,
-    0.500000, 0.133975,
-    0.940742, 0.000000, 0.339123,
-    1.000000, 1.000000,
-    -0.540650, -0.581952, -0.607478,
-    0.000000, 1.000000,
-    -0.470917, -0.619242, -0.628313,
-    0.500000, 0.133975,
-    -0.496441, -0.552418, -0.669612,
-    1.000000, 1.000000,
-    -0.564254, -0.513375, -0.646578,
-    0.000000, 1.000000,
-    -0.540650, -0.581952, -0.607478,
-    0.500000, 0.133975,
-    -0.496441, -0.552418, -0.669612,
-    1.000000, 1.000000,
-    -0.540650, -0.581952, -0.607478,
-    0.000000, 1.000000,
-    -0.513375, -0.646578, -0.564254,
-    0.500000, 0.133975,
-    -0.470917, -0.619242, -0.628313,
-    1.000000, 1.000000,
-    -0.517970, -0.485208, -0.704471,
-    0.000000, 1.000000,
-    -0.496441, -0.552418, -0.669612,
-    0.500000, 0.133975,
-    -0.448259, -0.522499, -0.725299,
-    1.000000, 1.000000,
-    -0.468430, -0.453990, -0.757935,
-    0.000000, 1.000000,
-    -0.517970, -0.485208, -0.704471,
-    0.500000, 0.133975,
-    -0.448259, -0.522499, -0.725299,
-    1.000000, 1.000000,
-    -0.517970, -0.485208, -0.704471,
-    0.000000, 1.000000,
-    -0.564254, -0.513375, -0.646578,
-    0.500000, 0.133975,
-    -0.496441, -0.552418, -0.669612,
-    1.000000, 1.000000,
-    -0.678977, -0.584716, -0.443957,
-    0.000000, 1.000000,
-    -0.649448, -0.646840, -0.399769,
-    0.500000, 0.133975,
-    -0.619242, -0.628313, -0.470917,
-    1.000000, 1.000000,
-    -0.646578, -0.564254, -0.513375,
-    0.000000, 1.000000,
-    -0.678977, -0.584716, -0.443957,
-    0.500000, 0.133975,
-    -0.619242, -0.628313, -0.470917,
-    1.000000, 1.000000,
-    -0.678977, -0.584716, -0.443957,
-    0.000000, 1.000000,
-    -0.707107, -0.601501, -0.371748,
-    0.500000, 0.133975,
-    -0.649448, -0.646840, -0.399769,
-    1.000000, 1.000000,
-    -0.255180, -0.610926, -0.749435,
-    0.000000, 1.000000,
-    -0.228900, -0.672319, -0.703983,
-    0.500000, 0.133975,
-    -0.187432, -0.634579, -0.749786,
-    1.000000, 1.000000,
-    -0.213023, -0.571252, -0.792649,
-    0.000000, 1.000000,
-    -0.255180, -0.610926, -0.749435,
-    0.500000, 0.133975,
-    -0.187432, -0.634579, -0.749786,
-    1.000000, 1.000000,
-    -0.255180, -0.610926, -0.749435,
-    0.000000, 1.000000,
-    -0.296005, -0.647412, -0.702310,
-    0.500000, 0.133975,
-    -0.228900, -0.672319, -0.703983,
-    1.000000, 1.000000,
-    -0.147414, -0.594895, -0.790170,
-    0.000000, 1.000000,
-    -0.187432, -0.634579, -0.749786,
-    0.500000, 0.133975,
-    -0.121144, -0.656282, -0.744727,
-    1.000000, 1.000000,
-    -0.081086, -0.615642, -0.783843,
-    0.000000, 1.000000,
-    -0.147414, -0.594895, -0.790170,
-    0.500000, 0.133975,
-    -0.121144, -0.656282, -0.744727,
-    1.000000, 1.000000,
-    -0.147414, -0.594895, -0.790170,
-    0.000000, 1.000000,
-    -0.213023, -0.571252, -0.792649,
-    0.500000, 0.133975,
-    -0.187432, -0.634579, -0.749786,
-    1.000000, 1.000000,
-    -0.408286, -0.486240, -0.772575,
-    0.000000, 1.000000,
-    -0.448259, -0.522499, -0.725299,
-    0.500000, 0.133975,
-    -0.386730, -0.553372, -0.737712,
-    1.000000, 1.000000,
-    -0.346153, -0.516122, -0.783452,
-    0.000000, 1.000000,
-    -0.408286, -0.486240, -0.772575,
-    0.500000, 0.133975,
-    -0.386730, -0.553372, -0.737712,
-    1.000000, 1.000000,
-    -0.408286, -0.486240, -0.772575,
-    0.000000, 1.000000,
-    -0.468430, -0.453990, -0.757935,
-    0.500000, 0.133975,
-    -0.448259, -0.522499, -0.725299,
-    1.000000, 1.000000,
-    -0.745338, -0.322141, -0.583691,
-    0.000000, 1.000000,
-    -0.737712, -0.386730, -0.553372,
-    0.500000, 0.133975,
-    -0.697037, -0.361592, -0.619186,
-    1.000000, 1.000000,
-    -0.702310, -0.296005, -0.647412,
-    0.000000, 1.000000,
-    -0.745338, -0.322141, -0.583691,
-    0.500000, 0.133975,
-    -0.697037, -0.361592, -0.619186,
-    1.000000, 1.000000,
-    -0.745338, -0.322141, -0.583691,
-    0.000000, 1.000000,
-    -0.783452, -0.346153, -0.516122,
-    0.500000, 0.133975,
-    -0.737712, -0.386730, -0.553372,
-    1.000000, 1.000000,
-    -0.653497, -0.334692, -0.678913,
-    0.000000, 1.000000,
-    -0.697037, -0.361592, -0.619186,
-    0.500000, 0.133975,
-    -0.646840, -0.399769, -0.649448,
-    1.000000, 1.000000,
-    -0.601501, -0.371748, -0.707107,
-    0.000000, 1.000000,
-    -0.653497, -0.334692, -0.678913,
-    0.500000, 0.133975,
-    -0.646840, -0.399769, -0.649448,
-    1.000000, 1.000000,
-    -0.653497, -0.334692, -0.678913,
-    0.000000, 1.000000,
-    -0.702310, -0.296005, -0.647412,
-    0.500000, 0.133975,
-    -0.697037, -0.361592, -0.619186,
-    1.000000, 1.000000,
-    -0.830812, -0.172532, -0.529135,
-    0.000000, 1.000000,
-    -0.865871, -0.196015, -0.460267,
-    0.500000, 0.133975,
-    -0.830359, -0.237229, -0.504209,
-    1.000000, 1.000000,
-    -0.792649, -0.213023, -0.571252,
-    0.000000, 1.000000,
-    -0.830812, -0.172532, -0.529135,
-    0.500000, 0.133975,
-    -0.830359, -0.237229, -0.504209,
-    1.000000, 1.000000,
-    -0.830812, -0.172532, -0.529135,
-    0.000000, 1.000000,
-    -0.864929, -0.131200, -0.484442,
-    0.500000, 0.133975,
-    -0.865871, -0.196015, -0.460267,
-    1.000000, 1.000000,
-    0.540650, -0.581952, -0.607478,
-    0.000000, 1.000000,
-    0.496441, -0.552418, -0.669612,
-    0.500000, 0.133975,
-    0.470917, -0.619242, -0.628313,
-    1.000000, 1.000000,
-    0.513375, -0.646578, -0.564254,
-    0.000000, 1.000000,
-    0.540650, -0.581952, -0.607478,
-    0.500000, 0.133975,
-    0.470917, -0.619242, -0.628313,
-    1.000000, 1.000000,
-    0.540650, -0.581952, -0.607478,
-    0.000000, 1.000000,
-    0.564254, -0.513375, -0.646578,
-    0.500000, 0.133975,
-    0.496441, -0.552418, -0.669612,
-    1.000000, 1.000000,
-    0.443957, -0.678977, -0.584716,
-    0.000000, 1.000000,
-    0.470917, -0.619242, -0.628313,
-    0.500000, 0.133975,
-    0.399769, -0.649448, -0.646840,
-    1.000000, 1.000000,
-    0.371748, -0.707107, -0.601501,
-    0.000000, 1.000000,
-    0.443957, -0.678977, -0.584716,
-    0.500000, 0.133975,
-    0.399769, -0.649448, -0.646840,
-    1.000000, 1.000000,
-    0.443957, -0.678977, -0.584716,
-    0.000000, 1.000000,
-    0.513375, -0.646578, -0.564254,
-    0.500000, 0.133975,
-    0.470917, -0.619242, -0.628313,
-    1.000000, 1.000000,
-    0.704471, -0.517970, -0.485208,
-    0.000000, 1.000000,
-    0.725299, -0.448259, -0.522499,
-    0.500000, 0.133975,
-    0.669612, -0.496441, -0.552418,
-    1.000000, 1.000000,
-    0.646578, -0.564254, -0.513375,
-    0.000000, 1.000000,
-    0.704471, -0.517970, -0.485208,
-    0.500000, 0.133975,
-    0.669612, -0.496441, -0.552418,
-    1.000000, 1.000000,
-    0.704471, -0.517970, -0.485208,
-    0.000000, 1.000000,
-    0.757935, -0.468430, -0.453990,
-    0.500000, 0.133975,
-    0.725299, -0.448259, -0.522499,
-    1.000000, 1.000000,
-    0.280319, -0.545109, -0.790112,
-    0.000000, 1.000000,
-    0.303801, -0.476226, -0.825175,
-    0.500000, 0.133975,
-    0.237229, -0.504209, -0.830359,
-    1.000000, 1.000000,
-    0.213023, -0.571252, -0.792649,
-    0.000000, 1.000000,
-    0.280319, -0.545109, -0.790112,
-    0.500000, 0.133975,
-    0.237229, -0.504209, -0.830359,
-    1.000000, 1.000000,
-    0.280319, -0.545109, -0.790112,
-    0.000000, 1.000000,
-    0.346153, -0.516122, -0.783452,
-    0.500000, 0.133975,
-    0.303801, -0.476226, -0.825175,
-    1.000000, 1.000000,
-    0.172532, -0.529135, -0.830812,
-    0.000000, 1.000000,
-    0.237229, -0.504209, -0.830359,
-    0.500000, 0.133975,
-    0.196015, -0.460267, -0.865871,
-    1.000000, 1.000000,
-    0.131200, -0.484442, -0.864929,
-    0.000000, 1.000000,
-    0.172532, -0.529135, -0.830812,
-    0.500000, 0.133975,
-    0.196015, -0.460267, -0.865871,
-    1.000000, 1.000000,
-    0.172532, -0.529135, -0.830812,
-    0.000000, 1.000000,
-    0.213023, -0.571252, -0.792649,
-    0.500000, 0.133975,
-    0.237229, -0.504209, -0.830359,
-    1.000000, 1.000000,
-    0.334692, -0.678913, -0.653497,
-    0.000000, 1.000000,
-    0.399769, -0.649448, -0.646840,
-    0.500000, 0.133975,
-    0.361592, -0.619186, -0.697037,
-    1.000000, 1.000000,
-    0.296005, -0.647412, -0.702310,
-    0.000000, 1.000000,
-    0.334692, -0.678913, -0.653497,
-    0.500000, 0.133975,
-    0.361592, -0.619186, -0.697037,
-    1.000000, 1.000000,
-    0.334692, -0.678913, -0.653497,
-    0.000000, 1.000000,
-    0.371748, -0.707107, -0.601501,
-    0.500000, 0.133975,
-    0.399769, -0.649448, -0.646840,
-    1.000000, 1.000000,
-    0.583691, -0.745338, -0.322141,
-    0.000000, 1.000000,
-    0.619186, -0.697037, -0.361592,
-    0.500000, 0.133975,
-    0.553372, -0.737712, -0.386730,
-    1.000000, 1.000000,
-    0.516122, -0.783452, -0.346153,
-    0.000000, 1.000000,
-    0.583691, -0.745338, -0.322141,
-    0.500000, 0.133975,
-    0.553372, -0.737712, -0.386730,
-    1.000000, 1.000000,
-    0.583691, -0.745338, -0.322141,
-    0.000000, 1.000000,
-    0.647412, -0.702310, -0.296005,
-    0.500000, 0.133975,
-    0.619186, -0.697037, -0.361592,
-    1.000000, 1.000000,
-    0.486240, -0.772575, -0.408286,
-    0.000000, 1.000000,
-    0.553372, -0.737712, -0.386730,
-    0.500000, 0.133975,
-    0.522499, -0.725299, -0.448259,
-    1.000000, 1.000000,
-    0.453990, -0.757935, -0.468430,
-    0.000000, 1.000000,
-    0.486240, -0.772575, -0.408286,
-    0.500000, 0.133975,
-    0.522499, -0.725299, -0.448259,
-    1.000000, 1.000000,
-    0.486240, -0.772575, -0.408286,
-    0.000000, 1.000000,
-    0.516122, -0.783452, -0.346153,
-    0.500000, 0.133975,
-    0.553372, -0.737712, -0.386730,
-    1.000000, 1.000000,
-    0.594895, -0.790170, -0.147414,
-    0.000000, 1.000000,
-    0.656282, -0.744727, -0.121144,
-    0.500000, 0.133975,
-    0.634579, -0.749786, -0.187432,
-    1.000000, 1.000000,
-    0.571252, -0.792649, -0.213023,
-    0.000000, 1.000000,
-    0.594895, -0.790170, -0.147414,
-    0.500000, 0.133975,
-    0.634579, -0.749786, -0.187432,
-    1.000000, 1.000000,
-    0.594895, -0.790170, -0.147414,
-    0.000000, 1.000000,
-    0.615642, -0.783843, -0.081086,
-    0.500000, 0.133975,
-    0.656282, -0.744727, -0.121144,
-    1.000000, 1.000000,
-    -0.540650, -0.581952, 0.607478,
-    0.000000, 1.000000,
-    -0.496441, -0.552418, 0.669612,
-    0.500000, 0.133975,
-    -0.470917, -0.619242, 0.628313,
-    1.000000, 1.000000,
-    -0.513375, -0.646578, 0.564254,
-    0.000000, 1.000000,
-    -0.540650, -0.581952, 0.607478,
-    0.500000, 0.133975,
-    -0.470917, -0.619242, 0.628313,
-    1.000000, 1.000000,
-    -0.540650, -0.581952, 0.607478,
-    0.000000, 1.000000,
-    -0.564254, -0.513375, 0.646578,
-    0.500000, 0.133975,
-    -0.496441, -0.552418, 0.669612,
-    1.000000, 1.000000,
-    -0.443957, -0.678977, 0.584716,
-    0.000000, 1.000000,
-    -0.470917, -0.619242, 0.628313,
-    0.500000, 0.133975,
-    -0.399769, -0.649448, 0.646840,
-    1.000000, 1.000000,
-    -0.371748, -0.707107, 0.601501,
-    0.000000, 1.000000,
-    -0.443957, -0.678977, 0.584716,
-    0.500000, 0.133975,
-    -0.399769, -0.649448, 0.646840,
-    1.000000, 1.000000,
-    -0.443957, -0.678977, 0.584716,
-    0.000000, 1.000000,
-    -0.513375, -0.646578, 0.564254,
-    0.500000, 0.133975,
-    -0.470917, -0.619242, 0.628313,
-    1.000000, 1.000000,
-    -0.704471, -0.517970, 0.485208,
-    0.000000, 1.000000,
-    -0.725299, -0.448259, 0.522499,
-    0.500000, 0.133975,
-    -0.669612, -0.496441, 0.552418,
-    1.000000, 1.000000,
-    -0.646578, -0.564254, 0.513375,
-    0.000000, 1.000000,
-    -0.704471, -0.517970, 0.485208,
-    0.500000, 0.133975,
-    -0.669612, -0.496441, 0.552418,
-    1.000000, 1.000000,
-    -0.704471, -0.517970, 0.485208,
-    0.000000, 1.000000,
-    -0.757935, -0.468430, 0.453990,
-    0.500000, 0.133975,
-    -0.725299, -0.448259, 0.522499,
-    1.000000, 1.000000,
-    -0.280319, -0.545109, 0.790112,
-    0.000000, 1.000000,
-    -0.303801, -0.476226, 0.825175,
-    0.500000, 0.133975,
-    -0.237229, -0.504209, 0.830359,
-    1.000000, 1.000000,
-    -0.213023, -0.571252, 0.792649,
-    0.000000, 1.000000,
-    -0.280319, -0.545109, 0.790112,
-    0.500000, 0.133975,
-    -0.237229, -0.504209, 0.830359,
-    1.000000, 1.000000,
-    -0.280319, -0.545109, 0.790112,
-    0.000000, 1.000000,
-    -0.346153, -0.516122, 0.783452,
-    0.500000, 0.133975,
-    -0.303801, -0.476226, 0.825175,
-    1.000000, 1.000000,
-    -0.172532, -0.529135, 0.830812,
-    0.000000, 1.000000,
-    -0.237229, -0.504209, 0.830359,
-    0.500000, 0.133975,
-    -0.196015, -0.460267, 0.865871,
-    1.000000, 1.000000,
-    -0.131200, -0.484442, 0.864929,
-    0.000000, 1.000000,
-    -0.172532, -0.529135, 0.830812,
-    0.500000, 0.133975,
-    -0.196015, -0.460267, 0.865871,
-    1.000000, 1.000000,
-    -0.172532, -0.529135, 0.830812,
-    0.000000, 1.000000,
-    -0.213023, -0.571252, 0.792649,
-    0.500000, 0.133975,
-    -0.237229, -0.504209, 0.830359,
-    1.000000, 1.000000,
-    -0.334692, -0.678913, 0.653497,
-    0.000000, 1.000000,
-    -0.399769, -0.649448, 0.646840,
-    0.500000, 0.133975,
-    -0.361592, -0.619186, 0.697037,
-    1.000000, 1.000000,
-    -0.296005, -0.647412, 0.702310,
-    0.000000, 1.000000,
-    -0.334692, -0.678913, 0.653497,
-    0.500000, 0.133975,
-    -0.361592, -0.619186, 0.697037,
-    1.000000, 1.000000,
-    -0.334692, -0.678913, 0.653497,
-    0.000000, 1.000000,
-    -0.371748, -0.707107, 0.601501,
-    0.500000, 0.133975,
-    -0.399769, -0.649448, 0.646840,
-    1.000000, 1.000000,
-    -0.583691, -0.745338, 0.322141,
-    0.000000, 1.000000,
-    -0.619186, -0.697037, 0.361592,
-    0.500000, 0.133975,
-    -0.553372, -0.737712, 0.386730,
-    1.000000, 1.000000,
-    -0.516122, -0.783452, 0.346153,
-    0.000000, 1.000000,
-    -0.583691, -0.745338, 0.322141,
-    0.500000, 0.133975,
-    -0.553372, -0.737712, 0.386730,
-    1.000000, 1.000000,
-    -0.583691, -0.745338, 0.322141,
-    0.000000, 1.000000,
-    -0.647412, -0.702310, 0.296005,
-    0.500000, 0.133975,
-    -0.619186, -0.697037, 0.361592,
-    1.000000, 1.000000,
-    -0.486240, -0.772575, 0.408286,
-    0.000000, 1.000000,
-    -0.553372, -0.737712, 0.386730,
-    0.500000, 0.133975,
-    -0.522499, -0.725299, 0.448259,
-    1.000000, 1.000000,
-    -0.453990, -0.757935, 0.468430,
-    0.000000, 1.000000,
-    -0.486240, -0.772575, 0.408286,
-    0.500000, 0.133975,
-    -0.522499, -0.725299, 0.448259,
-    1.000000, 1.000000,
-    -0.486240, -0.772575, 0.408286,
-    0.000000, 1.000000,
-    -0.516122, -0.783452, 0.346153,
-    0.500000, 0.133975,
-    -0.553372, -0.737712, 0.386730,
-    1.000000, 1.000000,
-    -0.594895, -0.790170, 0.147414,
-    0.000000, 1.000000,
-    -0.656282, -0.744727, 0.121144,
-    0.500000, 0.133975,
-    -0.634579, -0.749786, 0.187432,
-    1.000000, 1.000000,
-    -0.571252, -0.792649, 0.213023,
-    0.000000, 1.000000,
-    -0.594895, -0.790170, 0.147414,
-    0.500000, 0.133975,
-    -0.634579, -0.749786, 0.187432,
-    1.000000, 1.000000,
-    -0.594895, -0.790170, 0.147414,
-    0.000000, 1.000000,
-    -0.615642, -0.783843, 0.081086,
-    0.500000, 0.133975,
-    -0.656282, -0.744727, 0.121144,
-    1.000000, 1.000000,
-    0.540650, -0.581952, 0.607478,
-    0.000000, 1.000000,
-    0.470917, -0.619242, 0.628313,
-    0.500000, 0.133975,
-    0.496441, -0.552418, 0.669612,
-    1.000000, 1.000000,
-    0.564254, -0.513375, 0.646578,
-    0.000000, 1.000000,
-    0.540650, -0.581952, 0.607478,
-    0.500000, 0.133975,
-    0.496441, -0.552418, 0.669612,
-    1.000000, 1.000000,
-    0.540650, -0.581952, 0.607478,
-    0.000000, 1.000000,
-    0.513375, -0.646578, 0.564254,
-    0.500000, 0.133975,
-    0.470917, -0.619242, 0.628313,
-    1.000000, 1.000000,
-    0.517970, -0.485208, 0.704471,
-    0.000000, 1.000000,
-    0.496441, -0.552418, 0.669612,
-    0.500000, 0.133975,
-    0.448259, -0.522499, 0.725299,
-    1.000000, 1.000000,
-    0.468430, -0.453990, 0.757935,
-    0.000000, 1.000000,
-    0.517970, -0.485208, 0.704471,
-    0.500000, 0.133975,
-    0.448259, -0.522499, 0.725299,
-    1.000000, 1.000000,
-    0.517970, -0.485208, 0.704471,
-    0.000000, 1.000000,
-    0.564254, -0.513375, 0.646578,
-    0.500000, 0.133975,
-    0.496441, -0.552418, 0.669612,
-    1.000000, 1.000000,
-    0.678977, -0.584716, 0.443957,
-    0.000000, 1.000000,
-    0.649448, -0.646840, 0.399769,
-    0.500000, 0.133975,
-    0.619242, -0.628313, 0.470917,
-    1.000000, 1.000000,
-    0.646578, -0.564254, 0.513375,
-    0.000000, 1.000000,
-    0.678977, -0.584716, 0.443957,
-    0.500000, 0.133975,
-    0.619242, -0.628313, 0.470917,
-    1.000000, 1.000000,
-    0.678977, -0.584716, 0.443957,
-    0.000000, 1.000000,
-    0.707107, -0.601501, 0.371748,
-    0.500000, 0.133975,
-    0.649448, -0.646840, 0.399769,
-    1.000000, 1.000000,
-    0.255180, -0.610926, 0.749435,
-    0.000000, 1.000000,
-    0.228900, -0.672319, 0.703983,
-    0.500000, 0.133975,
-    0.187432, -0.634579, 0.749786,
-    1.000000, 1.000000,
-    0.213023, -0.571252, 0.792649,
-    0.000000, 1.000000,
-    0.255180, -0.610926, 0.749435,
-    0.500000, 0.133975,
-    0.187432, -0.634579, 0.749786,
-    1.000000, 1.000000,
-    0.255180, -0.610926, 0.749435,
-    0.000000, 1.000000,
-    0.296005, -0.647412, 0.702310,
-    0.500000, 0.133975,
-    0.228900, -0.672319, 0.703983,
-    1.000000, 1.000000,
-    0.147414, -0.594895, 0.790170,
-    0.000000, 1.000000,
-    0.187432, -0.634579, 0.749786,
-    0.500000, 0.133975,
-    0.121144, -0.656282, 0.744727,
-    1.000000, 1.000000,
-    0.081086, -0.615642, 0.783843,
-    0.000000, 1.000000,
-    0.147414, -0.594895, 0.790170,
-    0.500000, 0.133975,
-    0.121144, -0.656282, 0.744727,
-    1.000000, 1.000000,
-    0.147414, -0.594895, 0.790170,
-    0.000000, 1.000000,
-    0.213023, -0.571252, 0.792649,
-    0.500000, 0.133975,
-    0.187432, -0.634579, 0.749786,
-    1.000000, 1.000000,
-    0.408286, -0.486240, 0.772575,
-    0.000000, 1.000000,
-    0.448259, -0.522499, 0.725299,
-    0.500000, 0.133975,
-    0.386730, -0.553372, 0.737712,
-    1.000000, 1.000000,
-    0.346153, -0.516122, 0.783452,
-    0.000000, 1.000000,
-    0.408286, -0.486240, 0.772575,
-    0.500000, 0.133975,
-    0.386730, -0.553372, 0.737712,
-    1.000000, 1.000000,
-    0.408286, -0.486240, 0.772575,
-    0.000000, 1.000000,
-    0.468430, -0.453990, 0.757935,
-    0.500000, 0.133975,
-    0.448259, -0.522499, 0.725299,
-    1.000000, 1.000000,
-    0.745338, -0.322141, 0.583691,
-    0.000000, 1.000000,
-    0.737712, -0.386730, 0.553372,
-    0.500000, 0.133975,
-    0.697037, -0.361592, 0.619186,
-    1.000000, 1.000000,
-    0.702310, -0.296005, 0.647412,
-    0.000000, 1.000000,
-    0.745338, -0.322141, 0.583691,
-    0.500000, 0.133975,
-    0.697037, -0.361592, 0.619186,
-    1.000000, 1.000000,
-    0.745338, -0.322141, 0.583691,
-    0.000000, 1.000000,
-    0.783452, -0.346153, 0.516122,
-    0.500000, 0.133975,
-    0.737712, -0.386730, 0.553372,
-    1.000000, 1.000000,
-    0.653497, -0.334692, 0.678913,
-    0.000000, 1.000000,
-    0.697037, -0.361592, 0.619186,
-    0.500000, 0.133975,
-    0.646840, -0.399769, 0.649448,
-    1.000000, 1.000000,
-    0.601501, -0.371748, 0.707107,
-    0.000000, 1.000000,
-    0.653497, -0.334692, 0.678913,
-    0.500000, 0.133975,
-    0.646840, -0.399769, 0.649448,
-    1.000000, 1.000000,
-    0.653497, -0.334692, 0.678913,
-    0.000000, 1.000000,
-    0.702310, -0.296005, 0.647412,
-    0.500000, 0.133975,
-    0.697037, -0.361592, 0.619186,
-    1.000000, 1.000000,
-    0.830812, -0.172532, 0.529135,
-    0.000000, 1.000000,
-    0.865871, -0.196015, 0.460267,
-    0.500000, 0.133975,
-    0.830359, -0.237229, 0.504209,
-    1.000000, 1.000000,
-    0.792649, -0.213023, 0.571252,
-    0.000000, 1.000000,
-    0.830812, -0.172532, 0.529135,
-    0.500000, 0.133975,
-    0.830359, -0.237229, 0.504209,
-    1.000000, 1.000000,
-    0.830812, -0.172532, 0.529135,
-    0.000000, 1.000000,
-    0.864929, -0.131200, 0.484442,
-    0.500000, 0.133975,
-    0.865871, -0.196015, 0.460267,
-    1.000000, 1.000000,
-    -0.749387, -0.040642, 0.660884,
-    0.000000, 1.000000,
-    -0.786433, 0.000000, 0.617676,
-    0.500000, 0.133975,
-    -0.749387, 0.040642, 0.660884,
-    1.000000, 1.000000,
-    -0.711282, 0.000000, 0.702907,
-    0.000000, 1.000000,
-    -0.749387, -0.040642, 0.660884,
-    0.500000, 0.133975,
-    -0.749387, 0.040642, 0.660884,
-    1.000000, 1.000000,
-    -0.749387, -0.040642, 0.660884,
-    0.000000, 1.000000,
-    -0.783843, -0.081086, 0.615642,
-    0.500000, 0.133975,
-    -0.786433, 0.000000, 0.617676,
-    1.000000, 1.000000,
-    -0.708969, 0.080573, 0.700622,
-    0.000000, 1.000000,
-    -0.749387, 0.040642, 0.660884,
-    0.500000, 0.133975,
-    -0.744727, 0.121144, 0.656282,
-    1.000000, 1.000000,
-    -0.708969, 0.080573, 0.700622,
-    0.000000, 1.000000,
-    -0.711282, 0.000000, 0.702907,
-    0.500000, 0.133975,
-    -0.749387, 0.040642, 0.660884,
-    1.000000, 1.000000,
-    -0.708969, -0.080573, 0.700622,
-    0.000000, 1.000000,
-    -0.744727, -0.121144, 0.656282,
-    0.500000, 0.133975,
-    -0.749387, -0.040642, 0.660884,
-    1.000000, 1.000000,
-    -0.711282, 0.000000, 0.702907,
-    0.000000, 1.000000,
-    -0.708969, -0.080573, 0.700622,
-    0.500000, 0.133975,
-    -0.749387, -0.040642, 0.660884,
-    1.000000, 1.000000,
-    -0.708969, -0.080573, 0.700622,
-    0.000000, 1.000000,
-    -0.702046, -0.160622, 0.693780,
-    0.500000, 0.133975,
-    -0.744727, -0.121144, 0.656282,
-    1.000000, 1.000000,
-    0.131749, -0.422364, 0.896801,
-    0.000000, 1.000000,
-    0.065817, -0.445365, 0.892927,
-    0.500000, 0.133975,
-    0.065988, -0.381722, 0.921919,
-    1.000000, 1.000000,
-    0.131655, -0.358229, 0.924305,
-    0.000000, 1.000000,
-    0.131749, -0.422364, 0.896801,
-    0.500000, 0.133975,
-    0.065988, -0.381722, 0.921919,
-    1.000000, 1.000000,
-    0.131749, -0.422364, 0.896801,
-    0.000000, 1.000000,
-    0.131200, -0.484442, 0.864929,
-    0.500000, 0.133975,
-    0.065817, -0.445365, 0.892927,
-    1.000000, 1.000000,
-    0.066042, -0.316778, 0.946198,
-    0.000000, 1.000000,
-    0.065988, -0.381722, 0.921919,
-    0.500000, 0.133975,
-    0.000000, -0.339123, 0.940742,
-    1.000000, 1.000000,
-    0.000000, -0.273267, 0.961938,
-    0.000000, 1.000000,
-    0.066042, -0.316778, 0.946198,
-    0.500000, 0.133975,
-    0.000000, -0.339123, 0.940742,
-    1.000000, 1.000000,
-    0.066042, -0.316778, 0.946198,
-    0.000000, 1.000000,
-    0.131655, -0.358229, 0.924305,
-    0.500000, 0.133975,
-    0.065988, -0.381722, 0.921919,
-    1.000000, 1.000000,
-    0.196412, -0.397351, 0.896401,
-    0.000000, 1.000000,
-    0.196015, -0.460267, 0.865871,
-    0.500000, 0.133975,
-    0.131749, -0.422364, 0.896801,
-    1.000000, 1.000000,
-    0.131655, -0.358229, 0.924305,
-    0.000000, 1.000000,
-    0.196412, -0.397351, 0.896401,
-    0.500000, 0.133975,
-    0.131749, -0.422364, 0.896801,
-    1.000000, 1.000000,
-    0.196412, -0.397351, 0.896401,
-    0.000000, 1.000000,
-    0.259892, -0.433889, 0.862668,
-    0.500000, 0.133975,
-    0.196015, -0.460267, 0.865871,
-    1.000000, 1.000000,
-    0.749387, -0.040642, -0.660884,
-    0.000000, 1.000000,
-    0.786433, 0.000000, -0.617676,
-    0.500000, 0.133975,
-    0.749387, 0.040642, -0.660884,
-    1.000000, 1.000000,
-    0.711282, 0.000000, -0.702907,
-    0.000000, 1.000000,
-    0.749387, -0.040642, -0.660884,
-    0.500000, 0.133975,
-    0.749387, 0.040642, -0.660884,
-    1.000000, 1.000000,
-    0.749387, -0.040642, -0.660884,
-    0.000000, 1.000000,
-    0.783843, -0.081086, -0.615642,
-    0.500000, 0.133975,
-    0.786433, 0.000000, -0.617676,
-    1.000000, 1.000000,
-    0.708969, 0.080573, -0.700622,
-    0.000000, 1.000000,
-    0.749387, 0.040642, -0.660884,
-    0.500000, 0.133975,
-    0.744727, 0.121144, -0.656282,
-    1.000000, 1.000000,
-    0.708969, 0.080573, -0.700622,
-    0.000000, 1.000000,
-    0.711282, 0.000000, -0.702907,
-    0.500000, 0.133975,
-    0.749387, 0.040642, -0.660884,
-    1.000000, 1.000000,
-    0.708969, -0.080573, -0.700622,
-    0.000000, 1.000000,
-    0.744727, -0.121144, -0.656282,
-    0.500000, 0.133975,
-    0.749387, -0.040642, -0.660884,
-    1.000000, 1.000000,
-    0.711282, 0.000000, -0.702907,
-    0.000000, 1.000000,
-    0.708969, -0.080573, -0.700622,
-    0.500000, 0.133975,
-    0.749387, -0.040642, -0.660884,
-    1.000000, 1.000000,
-    0.708969, -0.080573, -0.700622,
-    0.000000, 1.000000,
-    0.702046, -0.160622, -0.693780,
-    0.500000, 0.133975,
-    0.744727, -0.121144, -0.656282,
-    1.000000, 1.000000,
-    -0.131749, -0.422364, -0.896801,
-    0.000000, 1.000000,
-    -0.065817, -0.445365, -0.892927,
-    0.500000, 0.133975,
-    -0.065988, -0.381722, -0.921919,
-    1.000000, 1.000000,
-    -0.131655, -0.358229, -0.924305,
-    0.000000, 1.000000,
-    -0.131749, -0.422364, -0.896801,
-    0.500000, 0.133975,
-    -0.065988, -0.381722, -0.921919,
-    1.000000, 1.000000,
-    -0.131749, -0.422364, -0.896801,
-    0.000000, 1.000000,
-    -0.131200, -0.484442, -0.864929,
-    0.500000, 0.133975,
-    -0.065817, -0.445365, -0.892927,
-    1.000000, 1.000000,
-    -0.066042, -0.316778, -0.946198,
-    0.000000, 1.000000,
-    -0.065988, -0.381722, -0.921919,
-    0.500000, 0.133975,
-    0.000000, -0.339123, -0.940742,
-    1.000000, 1.000000,
-    0.000000, -0.273267, -0.961938,
-    0.000000, 1.000000,
-    -0.066042, -0.316778, -0.946198,
-    0.500000, 0.133975,
-    0.000000, -0.339123, -0.940742,
-    1.000000, 1.000000,
-    -0.066042, -0.316778, -0.946198,
-    0.000000, 1.000000,
-    -0.131655, -0.358229, -0.924305,
-    0.500000, 0.133975,
-    -0.065988, -0.381722, -0.921919,
-    1.000000, 1.000000,
-    -0.196412, -0.397351, -0.896401,
-    0.000000, 1.000000,
-    -0.196015, -0.460267, -0.865871,
-    0.500000, 0.133975,
-    -0.131749, -0.422364, -0.896801,
-    1.000000, 1.000000,
-    -0.131655, -0.358229, -0.924305,
-    0.000000, 1.000000,
-    -0.196412, -0.397351, -0.896401,
-    0.500000, 0.133975,
-    -0.131749, -0.422364, -0.896801,
-    1.000000, 1.000000,
-    -0.196412, -0.397351, -0.896401,
-    0.000000, 1.000000,
-    -0.259892, -0.433889, -0.862668,
-    0.500000, 0.133975,
-    -0.196015, -0.460267, -0.865871,
-    1.000000, 1.000000,
-    -0.381722, -0.921919, 0.065988,
-    0.000000, 1.000000,
-    -0.445365, -0.892927, 0.065817,
-    0.500000, 0.133975,
-    -0.422364, -0.896801, 0.131749,
-    1.000000, 1.000000,
-    -0.358229, -0.924305, 0.131655,
-    0.000000, 1.000000,
-    -0.381722, -0.921919, 0.065988,
-    0.500000, 0.133975,
-    -0.422364, -0.896801, 0.131749,
-    1.000000, 1.000000,
-    -0.381722, -0.921919, 0.065988,
-    0.000000, 1.000000,
-    -0.403355, -0.915043, 0.000000,
-    0.500000, 0.133975,
-    -0.445365, -0.892927, 0.065817,
-    1.000000, 1.000000,
-    -0.397351, -0.896401, 0.196412,
-    0.000000, 1.000000,
-    -0.422364, -0.896801, 0.131749,
-    0.500000, 0.133975,
-    -0.460267, -0.865871, 0.196015,
-    1.000000, 1.000000,
-    -0.433889, -0.862668, 0.259892,
-    0.000000, 1.000000,
-    -0.397351, -0.896401, 0.196412,
-    0.500000, 0.133975,
-    -0.460267, -0.865871, 0.196015,
-    1.000000, 1.000000,
-    -0.397351, -0.896401, 0.196412,
-    0.000000, 1.000000,
-    -0.358229, -0.924305, 0.131655,
-    0.500000, 0.133975,
-    -0.422364, -0.896801, 0.131749,
-    1.000000, 1.000000,
-    -0.316778, -0.946198, 0.066042,
-    0.000000, 1.000000,
-    -0.339123, -0.940742, 0.000000,
-    0.500000, 0.133975,
-    -0.381722, -0.921919, 0.065988,
-    1.000000, 1.000000,
-    -0.358229, -0.924305, 0.131655,
-    0.000000, 1.000000,
-    -0.316778, -0.946198, 0.066042,
-    0.500000, 0.133975,
-    -0.381722, -0.921919, 0.065988,
-    1.000000, 1.000000,
-    -0.316778, -0.946198, 0.066042,
-    0.000000, 1.000000,
-    -0.273267, -0.961938, 0.000000,
-    0.500000, 0.133975,
-    -0.339123, -0.940742, 0.000000,
-    1.000000, 1.000000,
-    0.381722, -0.921919, -0.065988,
-    0.000000, 1.000000,
-    0.445365, -0.892927, -0.065817,
-    0.500000, 0.133975,
-    0.422364, -0.896801, -0.131749,
-    1.000000, 1.000000,
-    0.358229, -0.924305, -0.131655,
-    0.000000, 1.000000,
-    0.381722, -0.921919, -0.065988,
-    0.500000, 0.133975,
-    0.422364, -0.896801, -0.131749,
-    1.000000, 1.000000,
-    0.381722, -0.921919, -0.065988,
-    0.000000, 1.000000,
-    0.403355, -0.915043, 0.000000,
-    0.500000, 0.133975,
-    0.445365, -0.892927, -0.065817,
-    1.000000, 1.000000,
-    0.397351, -0.896401, -0.196412,
-    0.000000, 1.000000,
-    0.422364, -0.896801, -0.131749,
-    0.500000, 0.133975,
-    0.460267, -0.865871, -0.196015,
-    1.000000, 1.000000,
-    0.433889, -0.862668, -0.259892,
-    0.000000, 1.000000,
-    0.397351, -0.896401, -0.196412,
-    0.500000, 0.133975,
-    0.460267, -0.865871, -0.196015,
-    1.000000, 1.000000,
-    0.397351, -0.896401, -0.196412,
-    0.000000, 1.000000,
-    0.358229, -0.924305, -0.131655,
-    0.500000, 0.133975,
-    0.422364, -0.896801, -0.131749,
-    1.000000, 1.000000,
-    0.316778, -0.946198, -0.066042,
-    0.000000, 1.000000,
-    0.339123, -0.940742, 0.000000,
-    0.500000, 0.133975,
-    0.381722, -0.921919, -0.065988,
-    1.000000, 1.000000,
-    0.358229, -0.924305, -0.131655,
-    0.000000, 1.000000,
-    0.316778, -0.946198, -0.066042,
-    0.500000, 0.133975,
-    0.381722, -0.921919, -0.065988,
-    1.000000, 1.000000,
-    0.316778, -0.946198, -0.066042,
-    0.000000, 1.000000,
-    0.273267, -0.961938, 0.000000,
-    0.500000, 0.133975,
-    0.339123, -0.940742, 0.000000,
-    1.000000, 1.000000,
-    -0.921919, 0.065988, -0.381722,
-    0.000000, 1.000000,
-    -0.915043, 0.000000, -0.403355,
-    0.500000, 0.133975,
-    -0.892927, 0.065817, -0.445365,
-    1.000000, 1.000000,
-    -0.946198, 0.066042, -0.316778,
-    0.000000, 1.000000,
-    -0.940742, 0.000000, -0.339123,
-    0.500000, 0.133975,
-    -0.921919, 0.065988, -0.381722,
-    1.000000, 1.000000,
-    -0.946198, 0.066042, -0.316778,
-    0.000000, 1.000000,
-    -0.961938, 0.000000, -0.273267,
-    0.500000, 0.133975,
-    -0.940742, 0.000000, -0.339123,
-    1.000000, 1.000000,
-    -0.921919, -0.065988, 0.381722,
-    0.000000, 1.000000,
-    -0.892927, -0.065817, 0.445365,
-    0.500000, 0.133975,
-    -0.896801, -0.131749, 0.422364,
-    1.000000, 1.000000,
-    -0.924305, -0.131655, 0.358229,
-    0.000000, 1.000000,
-    -0.921919, -0.065988, 0.381722,
-    0.500000, 0.133975,
-    -0.896801, -0.131749, 0.422364,
-    1.000000, 1.000000,
-    -0.921919, -0.065988, 0.381722,
-    0.000000, 1.000000,
-    -0.915043, 0.000000, 0.403355,
-    0.500000, 0.133975,
-    -0.892927, -0.065817, 0.445365,
-    1.000000, 1.000000,
-    -0.896401, -0.196412, 0.397351,
-    0.000000, 1.000000,
-    -0.896801, -0.131749, 0.422364,
-    0.500000, 0.133975,
-    -0.865871, -0.196015, 0.460267,
-    1.000000, 1.000000,
-    -0.862668, -0.259892, 0.433889,
-    0.000000, 1.000000,
-    -0.896401, -0.196412, 0.397351,
-    0.500000, 0.133975,
-    -0.865871, -0.196015, 0.460267,
-    1.000000, 1.000000,
-    -0.896401, -0.196412, 0.397351,
-    0.000000, 1.000000,
-    -0.924305, -0.131655, 0.358229,
-    0.500000, 0.133975,
-    -0.896801, -0.131749, 0.422364,
-    1.000000, 1.000000,
-    -0.946198, -0.066042, 0.316778,
-    0.000000, 1.000000,
-    -0.940742, 0.000000, 0.339123,
-    0.500000, 0.133975,
-    -0.921919, -0.065988, 0.381722,
-    1.000000, 1.000000,
-    -0.924305, -0.131655, 0.358229,
-    0.000000, 1.000000,
-    -0.946198, -0.066042, 0.316778,
-    0.500000, 0.133975,
-    -0.921919, -0.065988, 0.381722,
-    1.000000, 1.000000,
-    -0.946198, -0.066042, 0.316778,
-    0.000000, 1.000000,
-    -0.961938, 0.000000, 0.273267,
-    0.500000, 0.133975,
-    -0.940742, 0.000000, 0.339123,
-    1.000000, 1.000000,
-    0.921919, 0.065988, 0.381722,
-    0.000000, 1.000000,
-    0.915043, 0.000000, 0.403355,
-    0.500000, 0.133975,
-    0.892927, 0.065817, 0.445365,
-    1.000000, 1.000000,
-    0.946198, 0.066042, 0.316778,
-    0.000000, 1.000000,
-    0.940742, 0.000000, 0.339123,
-    0.500000, 0.133975,
-    0.921919, 0.065988, 0.381722,
-    1.000000, 1.000000,
-    0.946198, 0.066042, 0.316778,
-    0.000000, 1.000000,
-    0.961938, 0.000000, 0.273267,
-    0.500000, 0.133975,
-    0.940742, 0.000000, 0.339123,
-    1.000000, 1.000000,
-    0.921919, -0.065988, -0.381722,
-    0.000000, 1.000000,
-    0.892927, -0.065817, -0.445365,
-    0.500000, 0.133975,
-    0.896801, -0.131749, -0.422364,
-    1.000000, 1.000000,
-    0.924305, -0.131655, -0.358229,
-    0.000000, 1.000000,
-    0.921919, -0.065988, -0.381722,
-    0.500000, 0.133975,
-    0.896801, -0.131749, -0.422364,
-    1.000000, 1.000000,
-    0.921919, -0.065988, -0.381722,
-    0.000000, 1.000000,
-    0.915043, 0.000000, -0.403355,
-    0.500000, 0.133975,
-    0.892927, -0.065817, -0.445365,
-    1.000000, 1.000000,
-    0.896401, -0.196412, -0.397351,
-    0.000000, 1.000000,
-    0.896801, -0.131749, -0.422364,
-    0.500000, 0.133975,
-    0.865871, -0.196015, -0.460267,
-    1.000000, 1.000000,
-    0.862668, -0.259892, -0.433889,
-    0.000000, 1.000000,
-    0.896401, -0.196412, -0.397351,
-    0.500000, 0.133975,
-    0.865871, -0.196015, -0.460267,
-    1.000000, 1.000000,
-    0.896401, -0.196412, -0.397351,
-    0.000000, 1.000000,
-    0.924305, -0.131655, -0.358229,
-    0.500000, 0.133975,
-    0.896801, -0.131749, -0.422364,
-    1.000000, 1.000000,
-    0.946198, -0.066042, -0.316778,
-    0.000000, 1.000000,
-    0.940742, 0.000000, -0.339123,
-    0.500000, 0.133975,
-    0.921919, -0.065988, -0.381722,
-    1.000000, 1.000000,
-    0.924305, -0.131655, -0.358229,
-    0.000000, 1.000000,
-    0.946198, -0.066042, -0.316778,
-    0.500000, 0.133975,
-    0.921919, -0.065988, -0.381722,
-    1.000000, 1.000000,
-    0.946198, -0.066042, -0.316778,
-    0.000000, 1.000000,
-    0.961938, 0.000000, -0.273267,
-    0.500000, 0.133975,
-    0.940742, 0.000000, -0.339123,
-    1.000000, 1.000000,
-    -0.594895, -0.790170, -0.147414,
-    0.000000, 1.000000,
-    -0.551859, -0.827110, -0.106494,
-    0.500000, 0.133975,
-    -0.529135, -0.830812, -0.172532,
-    1.000000, 1.000000,
-    -0.571252, -0.792649, -0.213023,
-    0.000000, 1.000000,
-    -0.594895, -0.790170, -0.147414,
-    0.500000, 0.133975,
-    -0.529135, -0.830812, -0.172532,
-    1.000000, 1.000000,
-    -0.594895, -0.790170, -0.147414,
-    0.000000, 1.000000,
-    -0.615642, -0.783843, -0.081086,
-    0.500000, 0.133975,
-    -0.551859, -0.827110, -0.106494,
-    1.000000, 1.000000,
-    -0.504209, -0.830359, -0.237229,
-    0.000000, 1.000000,
-    -0.529135, -0.830812, -0.172532,
-    0.500000, 0.133975,
-    -0.460267, -0.865871, -0.196015,
-    1.000000, 1.000000,
-    -0.433889, -0.862668, -0.259892,
-    0.000000, 1.000000,
-    -0.504209, -0.830359, -0.237229,
-    0.500000, 0.133975,
-    -0.460267, -0.865871, -0.196015,
-    1.000000, 1.000000,
-    -0.504209, -0.830359, -0.237229,
-    0.000000, 1.000000,
-    -0.571252, -0.792649, -0.213023,
-    0.500000, 0.133975,
-    -0.529135, -0.830812, -0.172532,
-    1.000000, 1.000000,
-    -0.634579, -0.749786, -0.187432,
-    0.000000, 1.000000,
-    -0.656282, -0.744727, -0.121144,
-    0.500000, 0.133975,
-    -0.594895, -0.790170, -0.147414,
-    1.000000, 1.000000,
-    -0.571252, -0.792649, -0.213023,
-    0.000000, 1.000000,
-    -0.634579, -0.749786, -0.187432,
-    0.500000, 0.133975,
-    -0.594895, -0.790170, -0.147414,
-    1.000000, 1.000000,
-    -0.634579, -0.749786, -0.187432,
-    0.000000, 1.000000,
-    -0.693780, -0.702046, -0.160622,
-    0.500000, 0.133975,
-    -0.656282, -0.744727, -0.121144,
-    1.000000, 1.000000,
-    0.830812, -0.172532, -0.529135,
-    0.000000, 1.000000,
-    0.827110, -0.106494, -0.551859,
-    0.500000, 0.133975,
-    0.790170, -0.147414, -0.594895,
-    1.000000, 1.000000,
-    0.792649, -0.213023, -0.571252,
-    0.000000, 1.000000,
-    0.830812, -0.172532, -0.529135,
-    0.500000, 0.133975,
-    0.790170, -0.147414, -0.594895,
-    1.000000, 1.000000,
-    0.830812, -0.172532, -0.529135,
-    0.000000, 1.000000,
-    0.864929, -0.131200, -0.484442,
-    0.500000, 0.133975,
-    0.827110, -0.106494, -0.551859,
-    1.000000, 1.000000,
-    0.749786, -0.187432, -0.634579,
-    0.000000, 1.000000,
-    0.790170, -0.147414, -0.594895,
-    0.500000, 0.133975,
-    0.744727, -0.121144, -0.656282,
-    1.000000, 1.000000,
-    0.702046, -0.160622, -0.693780,
-    0.000000, 1.000000,
-    0.749786, -0.187432, -0.634579,
-    0.500000, 0.133975,
-    0.744727, -0.121144, -0.656282,
-    1.000000, 1.000000,
-    0.749786, -0.187432, -0.634579,
-    0.000000, 1.000000,
-    0.792649, -0.213023, -0.571252,
-    0.500000, 0.133975,
-    0.790170, -0.147414, -0.594895,
-    1.000000, 1.000000,
-    0.830359, -0.237229, -0.504209,
-    0.000000, 1.000000,
-    0.865871, -0.196015, -0.460267,
-    0.500000, 0.133975,
-    0.830812, -0.172532, -0.529135,
-    1.000000, 1.000000,
-    0.792649, -0.213023, -0.571252,
-    0.000000, 1.000000,
-    0.830359, -0.237229, -0.504209,
-    0.500000, 0.133975,
-    0.830812, -0.172532, -0.529135,
-    1.000000, 1.000000,
-    0.830359, -0.237229, -0.504209,
-    0.000000, 1.000000,
-    0.862668, -0.259892, -0.433889,
-    0.500000, 0.133975,
-    0.865871, -0.196015, -0.460267,
-    1.000000, 1.000000,
-    -0.830812, -0.172532, 0.529135,
-    0.000000, 1.000000,
-    -0.827110, -0.106494, 0.551859,
-    0.500000, 0.133975,
-    -0.790170, -0.147414, 0.594895,
-    1.000000, 1.000000,
-    -0.792649, -0.213023, 0.571252,
-    0.000000, 1.000000,
-    -0.830812, -0.172532, 0.529135,
-    0.500000, 0.133975,
-    -0.790170, -0.147414, 0.594895,
-    1.000000, 1.000000,
-    -0.830812, -0.172532, 0.529135,
-    0.000000, 1.000000,
-    -0.864929, -0.131200, 0.484442,
-    0.500000, 0.133975,
-    -0.827110, -0.106494, 0.551859,
-    1.000000, 1.000000,
-    -0.749786, -0.187432, 0.634579,
-    0.000000, 1.000000,
-    -0.790170, -0.147414, 0.594895,
-    0.500000, 0.133975,
-    -0.744727, -0.121144, 0.656282,
-    1.000000, 1.000000,
-    -0.702046, -0.160622, 0.693780,
-    0.000000, 1.000000,
-    -0.749786, -0.187432, 0.634579,
-    0.500000, 0.133975,
-    -0.744727, -0.121144, 0.656282,
-    1.000000, 1.000000,
-    -0.749786, -0.187432, 0.634579,
-    0.000000, 1.000000,
-    -0.792649, -0.213023, 0.571252,
-    0.500000, 0.133975,
-    -0.790170, -0.147414, 0.594895,
-    1.000000, 1.000000,
-    -0.830359, -0.237229, 0.504209,
-    0.000000, 1.000000,
-    -0.865871, -0.196015, 0.460267,
-    0.500000, 0.133975,
-    -0.830812, -0.172532, 0.529135,
-    1.000000, 1.000000,
-    -0.792649, -0.213023, 0.571252,
-    0.000000, 1.000000,
-    -0.830359, -0.237229, 0.504209,
-    0.500000, 0.133975,
-    -0.830812, -0.172532, 0.529135,
-    1.000000, 1.000000,
-    -0.830359, -0.237229, 0.504209,
-    0.000000, 1.000000,
-    -0.862668, -0.259892, 0.433889,
-    0.500000, 0.133975,
-    -0.865871, -0.196015, 0.460267,
-    1.000000, 1.000000,
-    0.594895, -0.790170, 0.147414,
-    0.000000, 1.000000,
-    0.551859, -0.827110, 0.106494,
-    0.500000, 0.133975,
-    0.529135, -0.830812, 0.172532,
-    1.000000, 1.000000,
-    0.571252, -0.792649, 0.213023,
-    0.000000, 1.000000,
-    0.594895, -0.790170, 0.147414,
-    0.500000, 0.133975,
-    0.529135, -0.830812, 0.172532,
-    1.000000, 1.000000,
-    0.594895, -0.790170, 0.147414,
-    0.000000, 1.000000,
-    0.615642, -0.783843, 0.081086,
-    0.500000, 0.133975,
-    0.551859, -0.827110, 0.106494,
-    1.000000, 1.000000,
-    0.504209, -0.830359, 0.237229,
-    0.000000, 1.000000,
-    0.529135, -0.830812, 0.172532,
-    0.500000, 0.133975,
-    0.460267, -0.865871, 0.196015,
-    1.000000, 1.000000,
-    0.433889, -0.862668, 0.259892,
-    0.000000, 1.000000,
-    0.504209, -0.830359, 0.237229,
-    0.500000, 0.133975,
-    0.460267, -0.865871, 0.196015,
-    1.000000, 1.000000,
-    0.504209, -0.830359, 0.237229,
-    0.000000, 1.000000,
-    0.571252, -0.792649, 0.213023,
-    0.500000, 0.133975,
-    0.529135, -0.830812, 0.172532,
-    1.000000, 1.000000,
-    0.634579, -0.749786, 0.187432,
-    0.000000, 1.000000,
-    0.656282, -0.744727, 0.121144,
-    0.500000, 0.133975,
-    0.594895, -0.790170, 0.147414,
-    1.000000, 1.000000,
-    0.571252, -0.792649, 0.213023,
-    0.000000, 1.000000,
-    0.634579, -0.749786, 0.187432,
-    0.500000, 0.133975,
-    0.594895, -0.790170, 0.147414,
-    1.000000, 1.000000,
-    0.634579, -0.749786, 0.187432,
-    0.000000, 1.000000,
-    0.693780, -0.702046, 0.160622,
-    0.500000, 0.133975,
-    0.656282, -0.744727, 0.121144,
-    1.000000, 1.000000,
-    -0.464213, 0.041299, 0.884760,
-    0.000000, 1.000000,
-    -0.524110, 0.078459, 0.848029,
-    0.500000, 0.133975,
-    -0.460882, 0.119755, 0.879345,
-    1.000000, 1.000000,
-    -0.399607, 0.082324, 0.912982,
-    0.000000, 1.000000,
-    -0.464213, 0.041299, 0.884760,
-    0.500000, 0.133975,
-    -0.460882, 0.119755, 0.879345,
-    1.000000, 1.000000,
-    -0.464213, 0.041299, 0.884760,
-    0.000000, 1.000000,
-    -0.525731, 0.000000, 0.850651,
-    0.500000, 0.133975,
-    -0.524110, 0.078459, 0.848029,
-    1.000000, 1.000000,
-    -0.324864, -0.339209, 0.882837,
-    0.000000, 1.000000,
-    -0.385906, -0.307659, 0.869725,
-    0.500000, 0.133975,
-    -0.325929, -0.270627, 0.905832,
-    1.000000, 1.000000,
-    -0.264083, -0.301259, 0.916244,
-    0.000000, 1.000000,
-    -0.324864, -0.339209, 0.882837,
-    0.500000, 0.133975,
-    -0.325929, -0.270627, 0.905832,
-    1.000000, 1.000000,
-    -0.324864, -0.339209, 0.882837,
-    0.000000, 1.000000,
-    -0.383614, -0.375039, 0.843911,
-    0.500000, 0.133975,
-    -0.385906, -0.307659, 0.869725,
-    1.000000, 1.000000,
-    -0.264151, -0.232455, 0.936050,
-    0.000000, 1.000000,
-    -0.325929, -0.270627, 0.905832,
-    0.500000, 0.133975,
-    -0.325530, -0.201189, 0.923880,
-    1.000000, 1.000000,
-    -0.262866, -0.162460, 0.951057,
-    0.000000, 1.000000,
-    -0.264151, -0.232455, 0.936050,
-    0.500000, 0.133975,
-    -0.325530, -0.201189, 0.923880,
-    1.000000, 1.000000,
-    -0.264151, -0.232455, 0.936050,
-    0.000000, 1.000000,
-    -0.264083, -0.301259, 0.916244,
-    0.500000, 0.133975,
-    -0.325929, -0.270627, 0.905832,
-    1.000000, 1.000000,
-    -0.262661, -0.368518, 0.891742,
-    0.000000, 1.000000,
-    -0.322525, -0.405434, 0.855337,
-    0.500000, 0.133975,
-    -0.324864, -0.339209, 0.882837,
-    1.000000, 1.000000,
-    -0.264083, -0.301259, 0.916244,
-    0.000000, 1.000000,
-    -0.262661, -0.368518, 0.891742,
-    0.500000, 0.133975,
-    -0.324864, -0.339209, 0.882837,
-    1.000000, 1.000000,
-    -0.262661, -0.368518, 0.891742,
-    0.000000, 1.000000,
-    -0.259892, -0.433889, 0.862668,
-    0.500000, 0.133975,
-    -0.322525, -0.405434, 0.855337,
-    1.000000, 1.000000,
-    0.200368, -0.041251, 0.978852,
-    0.000000, 1.000000,
-    0.133523, 0.000000, 0.991046,
-    0.500000, 0.133975,
-    0.200368, 0.041251, 0.978852,
-    1.000000, 1.000000,
-    0.266405, 0.000000, 0.963861,
-    0.000000, 1.000000,
-    0.200368, -0.041251, 0.978852,
-    0.500000, 0.133975,
-    0.200368, 0.041251, 0.978852,
-    1.000000, 1.000000,
-    0.200368, -0.041251, 0.978852,
-    0.000000, 1.000000,
-    0.133071, -0.082242, 0.987688,
-    0.500000, 0.133975,
-    0.133523, 0.000000, 0.991046,
-    1.000000, 1.000000,
-    0.265518, 0.081501, 0.960655,
-    0.000000, 1.000000,
-    0.200368, 0.041251, 0.978852,
-    0.500000, 0.133975,
-    0.198580, 0.122729, 0.972370,
-    1.000000, 1.000000,
-    0.265518, 0.081501, 0.960655,
-    0.000000, 1.000000,
-    0.266405, 0.000000, 0.963861,
-    0.500000, 0.133975,
-    0.200368, 0.041251, 0.978852,
-    1.000000, 1.000000,
-    0.265518, -0.081501, 0.960655,
-    0.000000, 1.000000,
-    0.198580, -0.122729, 0.972370,
-    0.500000, 0.133975,
-    0.200368, -0.041251, 0.978852,
-    1.000000, 1.000000,
-    0.266405, 0.000000, 0.963861,
-    0.000000, 1.000000,
-    0.265518, -0.081501, 0.960655,
-    0.500000, 0.133975,
-    0.200368, -0.041251, 0.978852,
-    1.000000, 1.000000,
-    0.265518, -0.081501, 0.960655,
-    0.000000, 1.000000,
-    0.262866, -0.162460, 0.951057,
-    0.500000, 0.133975,
-    0.198580, -0.122729, 0.972370,
-    1.000000, 1.000000,
-    0.615456, -0.159613, 0.771841,
-    0.000000, 1.000000,
-    0.564513, -0.197274, 0.801504,
-    0.500000, 0.133975,
-    0.571140, -0.119078, 0.812169,
-    1.000000, 1.000000,
-    0.620240, -0.081142, 0.780204,
-    0.000000, 1.000000,
-    0.615456, -0.159613, 0.771841,
-    0.500000, 0.133975,
-    0.571140, -0.119078, 0.812169,
-    1.000000, 1.000000,
-    0.615456, -0.159613, 0.771841,
-    0.000000, 1.000000,
-    0.606825, -0.237086, 0.758652,
-    0.500000, 0.133975,
-    0.564513, -0.197274, 0.801504,
-    1.000000, 1.000000,
-    0.574458, -0.040675, 0.817523,
-    0.000000, 1.000000,
-    0.571140, -0.119078, 0.812169,
-    0.500000, 0.133975,
-    0.524110, -0.078459, 0.848029,
-    1.000000, 1.000000,
-    0.525731, 0.000000, 0.850651,
-    0.000000, 1.000000,
-    0.574458, -0.040675, 0.817523,
-    0.500000, 0.133975,
-    0.524110, -0.078459, 0.848029,
-    1.000000, 1.000000,
-    0.574458, -0.040675, 0.817523,
-    0.000000, 1.000000,
-    0.620240, -0.081142, 0.780204,
-    0.500000, 0.133975,
-    0.571140, -0.119078, 0.812169,
-    1.000000, 1.000000,
-    0.662842, -0.121193, 0.738886,
-    0.000000, 1.000000,
-    0.656006, -0.199331, 0.727958,
-    0.500000, 0.133975,
-    0.615456, -0.159613, 0.771841,
-    1.000000, 1.000000,
-    0.620240, -0.081142, 0.780204,
-    0.000000, 1.000000,
-    0.662842, -0.121193, 0.738886,
-    0.500000, 0.133975,
-    0.615456, -0.159613, 0.771841,
-    1.000000, 1.000000,
-    0.662842, -0.121193, 0.738886,
-    0.000000, 1.000000,
-    0.702046, -0.160622, 0.693780,
-    0.500000, 0.133975,
-    0.656006, -0.199331, 0.727958,
-    1.000000, 1.000000,
-    0.464213, 0.041299, -0.884760,
-    0.000000, 1.000000,
-    0.524110, 0.078459, -0.848029,
-    0.500000, 0.133975,
-    0.460882, 0.119755, -0.879345,
-    1.000000, 1.000000,
-    0.399607, 0.082324, -0.912982,
-    0.000000, 1.000000,
-    0.464213, 0.041299, -0.884760,
-    0.500000, 0.133975,
-    0.460882, 0.119755, -0.879345,
-    1.000000, 1.000000,
-    0.464213, 0.041299, -0.884760,
-    0.000000, 1.000000,
-    0.525731, 0.000000, -0.850651,
-    0.500000, 0.133975,
-    0.524110, 0.078459, -0.848029,
-    1.000000, 1.000000,
-    0.324864, -0.339209, -0.882837,
-    0.000000, 1.000000,
-    0.385906, -0.307659, -0.869725,
-    0.500000, 0.133975,
-    0.325929, -0.270627, -0.905832,
-    1.000000, 1.000000,
-    0.264083, -0.301259, -0.916244,
-    0.000000, 1.000000,
-    0.324864, -0.339209, -0.882837,
-    0.500000, 0.133975,
-    0.325929, -0.270627, -0.905832,
-    1.000000, 1.000000,
-    0.324864, -0.339209, -0.882837,
-    0.000000, 1.000000,
-    0.383614, -0.375039, -0.843911,
-    0.500000, 0.133975,
-    0.385906, -0.307659, -0.869725,
-    1.000000, 1.000000,
-    0.264151, -0.232455, -0.936050,
-    0.000000, 1.000000,
-    0.325929, -0.270627, -0.905832,
-    0.500000, 0.133975,
-    0.325530, -0.201189, -0.923880,
-    1.000000, 1.000000,
-    0.262866, -0.162460, -0.951057,
-    0.000000, 1.000000,
-    0.264151, -0.232455, -0.936050,
-    0.500000, 0.133975,
-    0.325530, -0.201189, -0.923880,
-    1.000000, 1.000000,
-    0.264151, -0.232455, -0.936050,
-    0.000000, 1.000000,
-    0.264083, -0.301259, -0.916244,
-    0.500000, 0.133975,
-    0.325929, -0.270627, -0.905832,
-    1.000000, 1.000000,
-    0.262661, -0.368518, -0.891742,
-    0.000000, 1.000000,
-    0.322525, -0.405434, -0.855337,
-    0.500000, 0.133975,
-    0.324864, -0.339209, -0.882837,
-    1.000000, 1.000000,
-    0.264083, -0.301259, -0.916244,
-    0.000000, 1.000000,
-    0.262661, -0.368518, -0.891742,
-    0.500000, 0.133975,
-    0.324864, -0.339209, -0.882837,
-    1.000000, 1.000000,
-    0.262661, -0.368518, -0.891742,
-    0.000000, 1.000000,
-    0.259892, -0.433889, -0.862668,
-    0.500000, 0.133975,
-    0.322525, -0.405434, -0.855337,
-    1.000000, 1.000000,
-    -0.200368, -0.041251, -0.978852,
-    0.000000, 1.000000,
-    -0.133523, 0.000000, -0.991046,
-    0.500000, 0.133975,
-    -0.200368, 0.041251, -0.978852,
-    1.000000, 1.000000,
-    -0.266405, 0.000000, -0.963861,
-    0.000000, 1.000000,
-    -0.200368, -0.041251, -0.978852,
-    0.500000, 0.133975,
-    -0.200368, 0.041251, -0.978852,
-    1.000000, 1.000000,
-    -0.200368, -0.041251, -0.978852,
-    0.000000, 1.000000,
-    -0.133071, -0.082242, -0.987688,
-    0.500000, 0.133975,
-    -0.133523, 0.000000, -0.991046,
-    1.000000, 1.000000,
-    -0.265518, 0.081501, -0.960655,
-    0.000000, 1.000000,
-    -0.200368, 0.041251, -0.978852,
-    0.500000, 0.133975,
-    -0.198580, 0.122729, -0.972370,
-    1.000000, 1.000000,
-    -0.265518, 0.081501, -0.960655,
-    0.000000, 1.000000,
-    -0.266405, 0.000000, -0.963861,
-    0.500000, 0.133975,
-    -0.200368, 0.041251, -0.978852,
-    1.000000, 1.000000,
-    -0.265518, -0.081501, -0.960655,
-    0.000000, 1.000000,
-    -0.198580, -0.122729, -0.972370,
-    0.500000, 0.133975,
-    -0.200368, -0.041251, -0.978852,
-    1.000000, 1.000000,
-    -0.266405, 0.000000, -0.963861,
-    0.000000, 1.000000,
-    -0.265518, -0.081501, -0.960655,
-    0.500000, 0.133975,
-    -0.200368, -0.041251, -0.978852,
-    1.000000, 1.000000,
-    -0.265518, -0.081501, -0.960655,
-    0.000000, 1.000000,
-    -0.262866, -0.162460, -0.951057,
-    0.500000, 0.133975,
-    -0.198580, -0.122729, -0.972370,
-    1.000000, 1.000000,
-    -0.615456, -0.159613, -0.771841,
-    0.000000, 1.000000,
-    -0.564513, -0.197274, -0.801504,
-    0.500000, 0.133975,
-    -0.571140, -0.119078, -0.812169,
-    1.000000, 1.000000,
-    -0.620240, -0.081142, -0.780204,
-    0.000000, 1.000000,
-    -0.615456, -0.159613, -0.771841,
-    0.500000, 0.133975,
-    -0.571140, -0.119078, -0.812169,
-    1.000000, 1.000000,
-    -0.615456, -0.159613, -0.771841,
-    0.000000, 1.000000,
-    -0.606825, -0.237086, -0.758652,
-    0.500000, 0.133975,
-    -0.564513, -0.197274, -0.801504,
-    1.000000, 1.000000,
-    -0.574458, -0.040675, -0.817523,
-    0.000000, 1.000000,
-    -0.571140, -0.119078, -0.812169,
-    0.500000, 0.133975,
-    -0.524110, -0.078459, -0.848029,
-    1.000000, 1.000000,
-    -0.525731, 0.000000, -0.850651,
-    0.000000, 1.000000,
-    -0.574458, -0.040675, -0.817523,
-    0.500000, 0.133975,
-    -0.524110, -0.078459, -0.848029,
-    1.000000, 1.000000,
-    -0.574458, -0.040675, -0.817523,
-    0.000000, 1.000000,
-    -0.620240, -0.081142, -0.780204,
-    0.500000, 0.133975,
-    -0.571140, -0.119078, -0.812169,
-    1.000000, 1.000000,
-    -0.662842, -0.121193, -0.738886,
-    0.000000, 1.000000,
-    -0.656006, -0.199331, -0.727958,
-    0.500000, 0.133975,
-    -0.615456, -0.159613, -0.771841,
-    1.000000, 1.000000,
-    -0.620240, -0.081142, -0.780204,
-    0.000000, 1.000000,
-    -0.662842, -0.121193, -0.738886,
-    0.500000, 0.133975,
-    -0.615456, -0.159613, -0.771841,
-    1.000000, 1.000000,
-    -0.662842, -0.121193, -0.738886,
-    0.000000, 1.000000,
-    -0.702046, -0.160622, -0.693780,
-    0.500000, 0.133975,
-    -0.656006, -0.199331, -0.727958,
-    1.000000, 1.000000,
-    -0.161006, -0.904839, 0.394136,
-    0.000000, 1.000000,
-    -0.198227, -0.868534, 0.454262,
-    0.500000, 0.133975,
-    -0.119755, -0.879345, 0.460882,
-    1.000000, 1.000000,
-    -0.082324, -0.912982, 0.399607,
-    0.000000, 1.000000,
-    -0.161006, -0.904839, 0.394136,
-    0.500000, 0.133975,
-    -0.119755, -0.879345, 0.460882,
-    1.000000, 1.000000,
-    -0.161006, -0.904839, 0.394136,
-    0.000000, 1.000000,
-    -0.238677, -0.891007, 0.386187,
-    0.500000, 0.133975,
-    -0.198227, -0.868534, 0.454262,
-    1.000000, 1.000000,
-    -0.041299, -0.884760, 0.464213,
-    0.000000, 1.000000,
-    -0.119755, -0.879345, 0.460882,
-    0.500000, 0.133975,
-    -0.078459, -0.848029, 0.524110,
-    1.000000, 1.000000,
-    0.000000, -0.850651, 0.525731,
-    0.000000, 1.000000,
-    -0.041299, -0.884760, 0.464213,
-    0.500000, 0.133975,
-    -0.078459, -0.848029, 0.524110,
-    1.000000, 1.000000,
-    -0.041299, -0.884760, 0.464213,
-    0.000000, 1.000000,
-    -0.082324, -0.912982, 0.399607,
-    0.500000, 0.133975,
-    -0.119755, -0.879345, 0.460882,
-    1.000000, 1.000000,
-    -0.122800, -0.935130, 0.332342,
-    0.000000, 1.000000,
-    -0.201189, -0.923880, 0.325530,
-    0.500000, 0.133975,
-    -0.161006, -0.904839, 0.394136,
-    1.000000, 1.000000,
-    -0.082324, -0.912982, 0.399607,
-    0.000000, 1.000000,
-    -0.122800, -0.935130, 0.332342,
-    0.500000, 0.133975,
-    -0.161006, -0.904839, 0.394136,
-    1.000000, 1.000000,
-    -0.122800, -0.935130, 0.332342,
-    0.000000, 1.000000,
-    -0.162460, -0.951057, 0.262866,
-    0.500000, 0.133975,
-    -0.201189, -0.923880, 0.325530,
-    1.000000, 1.000000,
-    -0.119078, -0.812169, 0.571140,
-    0.000000, 1.000000,
-    -0.197274, -0.801504, 0.564513,
-    0.500000, 0.133975,
-    -0.159613, -0.771841, 0.615456,
-    1.000000, 1.000000,
-    -0.081142, -0.780204, 0.620240,
-    0.000000, 1.000000,
-    -0.119078, -0.812169, 0.571140,
-    0.500000, 0.133975,
-    -0.159613, -0.771841, 0.615456,
-    1.000000, 1.000000,
-    -0.119078, -0.812169, 0.571140,
-    0.000000, 1.000000,
-    -0.156434, -0.840178, 0.519258,
-    0.500000, 0.133975,
-    -0.197274, -0.801504, 0.564513,
-    1.000000, 1.000000,
-    -0.121193, -0.738886, 0.662842,
-    0.000000, 1.000000,
-    -0.159613, -0.771841, 0.615456,
-    0.500000, 0.133975,
-    -0.199331, -0.727958, 0.656006,
-    1.000000, 1.000000,
-    -0.160622, -0.693780, 0.702046,
-    0.000000, 1.000000,
-    -0.121193, -0.738886, 0.662842,
-    0.500000, 0.133975,
-    -0.199331, -0.727958, 0.656006,
-    1.000000, 1.000000,
-    -0.121193, -0.738886, 0.662842,
-    0.000000, 1.000000,
-    -0.081142, -0.780204, 0.620240,
-    0.500000, 0.133975,
-    -0.159613, -0.771841, 0.615456,
-    1.000000, 1.000000,
-    -0.040675, -0.817523, 0.574458,
-    0.000000, 1.000000,
-    -0.078459, -0.848029, 0.524110,
-    0.500000, 0.133975,
-    -0.119078, -0.812169, 0.571140,
-    1.000000, 1.000000,
-    -0.081142, -0.780204, 0.620240,
-    0.000000, 1.000000,
-    -0.040675, -0.817523, 0.574458,
-    0.500000, 0.133975,
-    -0.119078, -0.812169, 0.571140,
-    1.000000, 1.000000,
-    -0.040675, -0.817523, 0.574458,
-    0.000000, 1.000000,
-    0.000000, -0.850651, 0.525731,
-    0.500000, 0.133975,
-    -0.078459, -0.848029, 0.524110,
-    1.000000, 1.000000,
-    0.179596, -0.981483, 0.066604,
-    0.000000, 1.000000,
-    0.110385, -0.991648, 0.066709,
-    0.500000, 0.133975,
-    0.151549, -0.979426, 0.133256,
-    1.000000, 1.000000,
-    0.220117, -0.966393, 0.132792,
-    0.000000, 1.000000,
-    0.179596, -0.981483, 0.066604,
-    0.500000, 0.133975,
-    0.151549, -0.979426, 0.133256,
-    1.000000, 1.000000,
-    0.179596, -0.981483, 0.066604,
-    0.000000, 1.000000,
-    0.137952, -0.990439, 0.000000,
-    0.500000, 0.133975,
-    0.110385, -0.991648, 0.066709,
-    1.000000, 1.000000,
-    0.191780, -0.961188, 0.198337,
-    0.000000, 1.000000,
-    0.151549, -0.979426, 0.133256,
-    0.500000, 0.133975,
-    0.122729, -0.972370, 0.198580,
-    1.000000, 1.000000,
-    0.162460, -0.951057, 0.262866,
-    0.000000, 1.000000,
-    0.191780, -0.961188, 0.198337,
-    0.500000, 0.133975,
-    0.122729, -0.972370, 0.198580,
-    1.000000, 1.000000,
-    0.191780, -0.961188, 0.198337,
-    0.000000, 1.000000,
-    0.220117, -0.966393, 0.132792,
-    0.500000, 0.133975,
-    0.151549, -0.979426, 0.133256,
-    1.000000, 1.000000,
-    0.247326, -0.966643, 0.066567,
-    0.000000, 1.000000,
-    0.206103, -0.978530, 0.000000,
-    0.500000, 0.133975,
-    0.179596, -0.981483, 0.066604,
-    1.000000, 1.000000,
-    0.220117, -0.966393, 0.132792,
-    0.000000, 1.000000,
-    0.247326, -0.966643, 0.066567,
-    0.500000, 0.133975,
-    0.179596, -0.981483, 0.066604,
-    1.000000, 1.000000,
-    0.247326, -0.966643, 0.066567,
-    0.000000, 1.000000,
-    0.273267, -0.961938, 0.000000,
-    0.500000, 0.133975,
-    0.206103, -0.978530, 0.000000,
-    1.000000, 1.000000,
-    0.161006, -0.904839, -0.394136,
-    0.000000, 1.000000,
-    0.198227, -0.868534, -0.454262,
-    0.500000, 0.133975,
-    0.119755, -0.879345, -0.460882,
-    1.000000, 1.000000,
-    0.082324, -0.912982, -0.399607,
-    0.000000, 1.000000,
-    0.161006, -0.904839, -0.394136,
-    0.500000, 0.133975,
-    0.119755, -0.879345, -0.460882,
-    1.000000, 1.000000,
-    0.161006, -0.904839, -0.394136,
-    0.000000, 1.000000,
-    0.238677, -0.891007, -0.386187,
-    0.500000, 0.133975,
-    0.198227, -0.868534, -0.454262,
-    1.000000, 1.000000,
-    0.041299, -0.884760, -0.464213,
-    0.000000, 1.000000,
-    0.119755, -0.879345, -0.460882,
-    0.500000, 0.133975,
-    0.078459, -0.848029, -0.524110,
-    1.000000, 1.000000,
-    0.000000, -0.850651, -0.525731,
-    0.000000, 1.000000,
-    0.041299, -0.884760, -0.464213,
-    0.500000, 0.133975,
-    0.078459, -0.848029, -0.524110,
-    1.000000, 1.000000,
-    0.041299, -0.884760, -0.464213,
-    0.000000, 1.000000,
-    0.082324, -0.912982, -0.399607,
-    0.500000, 0.133975,
-    0.119755, -0.879345, -0.460882,
-    1.000000, 1.000000,
-    0.122800, -0.935130, -0.332342,
-    0.000000, 1.000000,
-    0.201189, -0.923880, -0.325530,
-    0.500000, 0.133975,
-    0.161006, -0.904839, -0.394136,
-    1.000000, 1.000000,
-    0.082324, -0.912982, -0.399607,
-    0.000000, 1.000000,
-    0.122800, -0.935130, -0.332342,
-    0.500000, 0.133975,
-    0.161006, -0.904839, -0.394136,
-    1.000000, 1.000000,
-    0.122800, -0.935130, -0.332342,
-    0.000000, 1.000000,
-    0.162460, -0.951057, -0.262866,
-    0.500000, 0.133975,
-    0.201189, -0.923880, -0.325530,
-    1.000000, 1.000000,
-    0.119078, -0.812169, -0.571140,
-    0.000000, 1.000000,
-    0.197274, -0.801504, -0.564513,
-    0.500000, 0.133975,
-    0.159613, -0.771841, -0.615456,
-    1.000000, 1.000000,
-    0.081142, -0.780204, -0.620240,
-    0.000000, 1.000000,
-    0.119078, -0.812169, -0.571140,
-    0.500000, 0.133975,
-    0.159613, -0.771841, -0.615456,
-    1.000000, 1.000000,
-    0.119078, -0.812169, -0.571140,
-    0.000000, 1.000000,
-    0.156434, -0.840178, -0.519258,
-    0.500000, 0.133975,
-    0.197274, -0.801504, -0.564513,
-    1.000000, 1.000000,
-    0.121193, -0.738886, -0.662842,
-    0.000000, 1.000000,
-    0.159613, -0.771841, -0.615456,
-    0.500000, 0.133975,
-    0.199331, -0.727958, -0.656006,
-    1.000000, 1.000000,
-    0.160622, -0.693780, -0.702046,
-    0.000000, 1.000000,
-    0.121193, -0.738886, -0.662842,
-    0.500000, 0.133975,
-    0.199331, -0.727958, -0.656006,
-    1.000000, 1.000000,
-    0.121193, -0.738886, -0.662842,
-    0.000000, 1.000000,
-    0.081142, -0.780204, -0.620240,
-    0.500000, 0.133975,
-    0.159613, -0.771841, -0.615456,
-    1.000000, 1.000000,
-    0.040675, -0.817523, -0.574458,
-    0.000000, 1.000000,
-    0.078459, -0.848029, -0.524110,
-    0.500000, 0.133975,
-    0.119078, -0.812169, -0.571140,
-    1.000000, 1.000000,
-    0.081142, -0.780204, -0.620240,
-    0.000000, 1.000000,
-    0.040675, -0.817523, -0.574458,
-    0.500000, 0.133975,
-    0.119078, -0.812169, -0.571140,
-    1.000000, 1.000000,
-    0.040675, -0.817523, -0.574458,
-    0.000000, 1.000000,
-    0.000000, -0.850651, -0.525731,
-    0.500000, 0.133975,
-    0.078459, -0.848029, -0.524110,
-    1.000000, 1.000000,
-    -0.179596, -0.981483, -0.066604,
-    0.000000, 1.000000,
-    -0.110385, -0.991648, -0.066709,
-    0.500000, 0.133975,
-    -0.151549, -0.979426, -0.133256,
-    1.000000, 1.000000,
-    -0.220117, -0.966393, -0.132792,
-    0.000000, 1.000000,
-    -0.179596, -0.981483, -0.066604,
-    0.500000, 0.133975,
-    -0.151549, -0.979426, -0.133256,
-    1.000000, 1.000000,
-    -0.179596, -0.981483, -0.066604,
-    0.000000, 1.000000,
-    -0.137952, -0.990439, 0.000000,
-    0.500000, 0.133975,
-    -0.110385, -0.991648, -0.066709,
-    1.000000, 1.000000,
-    -0.191780, -0.961188, -0.198337,
-    0.000000, 1.000000,
-    -0.151549, -0.979426, -0.133256,
-    0.500000, 0.133975,
-    -0.122729, -0.972370, -0.198580,
-    1.000000, 1.000000,
-    -0.162460, -0.951057, -0.262866,
-    0.000000, 1.000000,
-    -0.191780, -0.961188, -0.198337,
-    0.500000, 0.133975,
-    -0.122729, -0.972370, -0.198580,
-    1.000000, 1.000000,
-    -0.191780, -0.961188, -0.198337,
-    0.000000, 1.000000,
-    -0.220117, -0.966393, -0.132792,
-    0.500000, 0.133975,
-    -0.151549, -0.979426, -0.133256,
-    1.000000, 1.000000,
-    -0.247326, -0.966643, -0.066567,
-    0.000000, 1.000000,
-    -0.206103, -0.978530, 0.000000,
-    0.500000, 0.133975,
-    -0.179596, -0.981483, -0.066604,
-    1.000000, 1.000000,
-    -0.220117, -0.966393, -0.132792,
-    0.000000, 1.000000,
-    -0.247326, -0.966643, -0.066567,
-    0.500000, 0.133975,
-    -0.179596, -0.981483, -0.066604,
-    1.000000, 1.000000,
-    -0.247326, -0.966643, -0.066567,
-    0.000000, 1.000000,
-    -0.273267, -0.961938, 0.000000,
-    0.500000, 0.133975,
-    -0.206103, -0.978530, 0.000000,
-    1.000000, 1.000000,
-    -0.981483, 0.066604, 0.179596,
-    0.000000, 1.000000,
-    -0.990439, 0.000000, 0.137952,
-    0.500000, 0.133975,
-    -0.991648, 0.066709, 0.110385,
-    1.000000, 1.000000,
-    -0.966643, 0.066567, 0.247326,
-    0.000000, 1.000000,
-    -0.978530, 0.000000, 0.206103,
-    0.500000, 0.133975,
-    -0.981483, 0.066604, 0.179596,
-    1.000000, 1.000000,
-    -0.966643, 0.066567, 0.247326,
-    0.000000, 1.000000,
-    -0.961938, 0.000000, 0.273267,
-    0.500000, 0.133975,
-    -0.978530, 0.000000, 0.206103,
-    1.000000, 1.000000,
-    -0.904839, -0.394136, 0.161006,
-    0.000000, 1.000000,
-    -0.868534, -0.454262, 0.198227,
-    0.500000, 0.133975,
-    -0.879345, -0.460882, 0.119755,
-    1.000000, 1.000000,
-    -0.912982, -0.399607, 0.082324,
-    0.000000, 1.000000,
-    -0.904839, -0.394136, 0.161006,
-    0.500000, 0.133975,
-    -0.879345, -0.460882, 0.119755,
-    1.000000, 1.000000,
-    -0.904839, -0.394136, 0.161006,
-    0.000000, 1.000000,
-    -0.891007, -0.386187, 0.238677,
-    0.500000, 0.133975,
-    -0.868534, -0.454262, 0.198227,
-    1.000000, 1.000000,
-    -0.884760, -0.464213, 0.041299,
-    0.000000, 1.000000,
-    -0.879345, -0.460882, 0.119755,
-    0.500000, 0.133975,
-    -0.848029, -0.524110, 0.078459,
-    1.000000, 1.000000,
-    -0.850651, -0.525731, 0.000000,
-    0.000000, 1.000000,
-    -0.884760, -0.464213, 0.041299,
-    0.500000, 0.133975,
-    -0.848029, -0.524110, 0.078459,
-    1.000000, 1.000000,
-    -0.884760, -0.464213, 0.041299,
-    0.000000, 1.000000,
-    -0.912982, -0.399607, 0.082324,
-    0.500000, 0.133975,
-    -0.879345, -0.460882, 0.119755,
-    1.000000, 1.000000,
-    -0.935130, -0.332342, 0.122800,
-    0.000000, 1.000000,
-    -0.923880, -0.325530, 0.201189,
-    0.500000, 0.133975,
-    -0.904839, -0.394136, 0.161006,
-    1.000000, 1.000000,
-    -0.912982, -0.399607, 0.082324,
-    0.000000, 1.000000,
-    -0.935130, -0.332342, 0.122800,
-    0.500000, 0.133975,
-    -0.904839, -0.394136, 0.161006,
-    1.000000, 1.000000,
-    -0.935130, -0.332342, 0.122800,
-    0.000000, 1.000000,
-    -0.951057, -0.262866, 0.162460,
-    0.500000, 0.133975,
-    -0.923880, -0.325530, 0.201189,
-    1.000000, 1.000000,
-    -0.812169, -0.571140, 0.119078,
-    0.000000, 1.000000,
-    -0.801504, -0.564513, 0.197274,
-    0.500000, 0.133975,
-    -0.771841, -0.615456, 0.159613,
-    1.000000, 1.000000,
-    -0.780204, -0.620240, 0.081142,
-    0.000000, 1.000000,
-    -0.812169, -0.571140, 0.119078,
-    0.500000, 0.133975,
-    -0.771841, -0.615456, 0.159613,
-    1.000000, 1.000000,
-    -0.812169, -0.571140, 0.119078,
-    0.000000, 1.000000,
-    -0.840178, -0.519258, 0.156434,
-    0.500000, 0.133975,
-    -0.801504, -0.564513, 0.197274,
-    1.000000, 1.000000,
-    -0.738886, -0.662842, 0.121193,
-    0.000000, 1.000000,
-    -0.771841, -0.615456, 0.159613,
-    0.500000, 0.133975,
-    -0.727958, -0.656006, 0.199331,
-    1.000000, 1.000000,
-    -0.693780, -0.702046, 0.160622,
-    0.000000, 1.000000,
-    -0.738886, -0.662842, 0.121193,
-    0.500000, 0.133975,
-    -0.727958, -0.656006, 0.199331,
-    1.000000, 1.000000,
-    -0.738886, -0.662842, 0.121193,
-    0.000000, 1.000000,
-    -0.780204, -0.620240, 0.081142,
-    0.500000, 0.133975,
-    -0.771841, -0.615456, 0.159613,
-    1.000000, 1.000000,
-    -0.817523, -0.574458, 0.040675,
-    0.000000, 1.000000,
-    -0.848029, -0.524110, 0.078459,
-    0.500000, 0.133975,
-    -0.812169, -0.571140, 0.119078,
-    1.000000, 1.000000,
-    -0.780204, -0.620240, 0.081142,
-    0.000000, 1.000000,
-    -0.817523, -0.574458, 0.040675,
-    0.500000, 0.133975,
-    -0.812169, -0.571140, 0.119078,
-    1.000000, 1.000000,
-    -0.817523, -0.574458, 0.040675,
-    0.000000, 1.000000,
-    -0.850651, -0.525731, 0.000000,
-    0.500000, 0.133975,
-    -0.848029, -0.524110, 0.078459,
-    1.000000, 1.000000,
-    -0.981483, -0.066604, -0.179596,
-    0.000000, 1.000000,
-    -0.991648, -0.066709, -0.110385,
-    0.500000, 0.133975,
-    -0.979426, -0.133256, -0.151549,
-    1.000000, 1.000000,
-    -0.966393, -0.132792, -0.220117,
-    0.000000, 1.000000,
-    -0.981483, -0.066604, -0.179596,
-    0.500000, 0.133975,
-    -0.979426, -0.133256, -0.151549,
-    1.000000, 1.000000,
-    -0.981483, -0.066604, -0.179596,
-    0.000000, 1.000000,
-    -0.990439, 0.000000, -0.137952,
-    0.500000, 0.133975,
-    -0.991648, -0.066709, -0.110385,
-    1.000000, 1.000000,
-    -0.961188, -0.198337, -0.191780,
-    0.000000, 1.000000,
-    -0.979426, -0.133256, -0.151549,
-    0.500000, 0.133975,
-    -0.972370, -0.198580, -0.122729,
-    1.000000, 1.000000,
-    -0.951057, -0.262866, -0.162460,
-    0.000000, 1.000000,
-    -0.961188, -0.198337, -0.191780,
-    0.500000, 0.133975,
-    -0.972370, -0.198580, -0.122729,
-    1.000000, 1.000000,
-    -0.961188, -0.198337, -0.191780,
-    0.000000, 1.000000,
-    -0.966393, -0.132792, -0.220117,
-    0.500000, 0.133975,
-    -0.979426, -0.133256, -0.151549,
-    1.000000, 1.000000,
-    -0.966643, -0.066567, -0.247326,
-    0.000000, 1.000000,
-    -0.978530, 0.000000, -0.206103,
-    0.500000, 0.133975,
-    -0.981483, -0.066604, -0.179596,
-    1.000000, 1.000000,
-    -0.966393, -0.132792, -0.220117,
-    0.000000, 1.000000,
-    -0.966643, -0.066567, -0.247326,
-    0.500000, 0.133975,
-    -0.981483, -0.066604, -0.179596,
-    1.000000, 1.000000,
-    -0.966643, -0.066567, -0.247326,
-    0.000000, 1.000000,
-    -0.961938, 0.000000, -0.273267,
-    0.500000, 0.133975,
-    -0.978530, 0.000000, -0.206103,
-    1.000000, 1.000000,
-    0.981483, 0.066604, -0.179596,
-    0.000000, 1.000000,
-    0.990439, 0.000000, -0.137952,
-    0.500000, 0.133975,
-    0.991648, 0.066709, -0.110385,
-    1.000000, 1.000000,
-    0.966643, 0.066567, -0.247326,
-    0.000000, 1.000000,
-    0.978530, 0.000000, -0.206103,
-    0.500000, 0.133975,
-    0.981483, 0.066604, -0.179596,
-    1.000000, 1.000000,
-    0.966643, 0.066567, -0.247326,
-    0.000000, 1.000000,
-    0.961938, 0.000000, -0.273267,
-    0.500000, 0.133975,
-    0.978530, 0.000000, -0.206103,
-    1.000000, 1.000000,
-    0.904839, -0.394136, -0.161006,
-    0.000000, 1.000000,
-    0.868534, -0.454262, -0.198227,
-    0.500000, 0.133975,
-    0.879345, -0.460882, -0.119755,
-    1.000000, 1.000000,
-    0.912982, -0.399607, -0.082324,
-    0.000000, 1.000000,
-    0.904839, -0.394136, -0.161006,
-    0.500000, 0.133975,
-    0.879345, -0.460882, -0.119755,
-    1.000000, 1.000000,
-    0.904839, -0.394136, -0.161006,
-    0.000000, 1.000000,
-    0.891007, -0.386187, -0.238677,
-    0.500000, 0.133975,
-    0.868534, -0.454262, -0.198227,
-    1.000000, 1.000000,
-    0.884760, -0.464213, -0.041299,
-    0.000000, 1.000000,
-    0.879345, -0.460882, -0.119755,
-    0.500000, 0.133975,
-    0.848029, -0.524110, -0.078459,
-    1.000000, 1.000000,
-    0.850651, -0.525731, 0.000000,
-    0.000000, 1.000000,
-    0.884760, -0.464213, -0.041299,
-    0.500000, 0.133975,
-    0.848029, -0.524110, -0.078459,
-    1.000000, 1.000000,
-    0.884760, -0.464213, -0.041299,
-    0.000000, 1.000000,
-    0.912982, -0.399607, -0.082324,
-    0.500000, 0.133975,
-    0.879345, -0.460882, -0.119755,
-    1.000000, 1.000000,
-    0.935130, -0.332342, -0.122800,
-    0.000000, 1.000000,
-    0.923880, -0.325530, -0.201189,
-    0.500000, 0.133975,
-    0.904839, -0.394136, -0.161006,
-    1.000000, 1.000000,
-    0.912982, -0.399607, -0.082324,
-    0.000000, 1.000000,
-    0.935130, -0.332342, -0.122800,
-    0.500000, 0.133975,
-    0.904839, -0.394136, -0.161006,
-    1.000000, 1.000000,
-    0.935130, -0.332342, -0.122800,
-    0.000000, 1.000000,
-    0.951057, -0.262866, -0.162460,
-    0.500000, 0.133975,
-    0.923880, -0.325530, -0.201189,
-    1.000000, 1.000000,
-    0.812169, -0.571140, -0.119078,
-    0.000000, 1.000000,
-    0.801504, -0.564513, -0.197274,
-    0.500000, 0.133975,
-    0.771841, -0.615456, -0.159613,
-    1.000000, 1.000000,
-    0.780204, -0.620240, -0.081142,
-    0.000000, 1.000000,
-    0.812169, -0.571140, -0.119078,
-    0.500000, 0.133975,
-    0.771841, -0.615456, -0.159613,
-    1.000000, 1.000000,
-    0.812169, -0.571140, -0.119078,
-    0.000000, 1.000000,
-    0.840178, -0.519258, -0.156434,
-    0.500000, 0.133975,
-    0.801504, -0.564513, -0.197274,
-    1.000000, 1.000000,
-    0.738886, -0.662842, -0.121193,
-    0.000000, 1.000000,
-    0.771841, -0.615456, -0.159613,
-    0.500000, 0.133975,
-    0.727958, -0.656006, -0.199331,
-    1.000000, 1.000000,
-    0.693780, -0.702046, -0.160622,
-    0.000000, 1.000000,
-    0.738886, -0.662842, -0.121193,
-    0.500000, 0.133975,
-    0.727958, -0.656006, -0.199331,
-    1.000000, 1.000000,
-    0.738886, -0.662842, -0.121193,
-    0.000000, 1.000000,
-    0.780204, -0.620240, -0.081142,
-    0.500000, 0.133975,
-    0.771841, -0.615456, -0.159613,
-    1.000000, 1.000000,
-    0.817523, -0.574458, -0.040675,
-    0.000000, 1.000000,
-    0.848029, -0.524110, -0.078459,
-    0.500000, 0.133975,
-    0.812169, -0.571140, -0.119078,
-    1.000000, 1.000000,
-    0.780204, -0.620240, -0.081142,
-    0.000000, 1.000000,
-    0.817523, -0.574458, -0.040675,
-    0.500000, 0.133975,
-    0.812169, -0.571140, -0.119078,
-    1.000000, 1.000000,
-    0.817523, -0.574458, -0.040675,
-    0.000000, 1.000000,
-    0.850651, -0.525731, 0.000000,
-    0.500000, 0.133975,
-    0.848029, -0.524110, -0.078459,
-    1.000000, 1.000000,
-    0.981483, -0.066604, 0.179596,
-    0.000000, 1.000000,
-    0.991648, -0.066709, 0.110385,
-    0.500000, 0.133975,
-    0.979426, -0.133256, 0.151549,
-    1.000000, 1.000000,
-    0.966393, -0.132792, 0.220117,
-    0.000000, 1.000000,
-    0.981483, -0.066604, 0.179596,
-    0.500000, 0.133975,
-    0.979426, -0.133256, 0.151549,
-    1.000000, 1.000000,
-    0.981483, -0.066604, 0.179596,
-    0.000000, 1.000000,
-    0.990439, 0.000000, 0.137952,
-    0.500000, 0.133975,
-    0.991648, -0.066709, 0.110385,
-    1.000000, 1.000000,
-    0.961188, -0.198337, 0.191780,
-    0.000000, 1.000000,
-    0.979426, -0.133256, 0.151549,
-    0.500000, 0.133975,
-    0.972370, -0.198580, 0.122729,
-    1.000000, 1.000000,
-    0.951057, -0.262866, 0.162460,
-    0.000000, 1.000000,
-    0.961188, -0.198337, 0.191780,
-    0.500000, 0.133975,
-    0.972370, -0.198580, 0.122729,
-    1.000000, 1.000000,
-    0.961188, -0.198337, 0.191780,
-    0.000000, 1.000000,
-    0.966393, -0.132792, 0.220117,
-    0.500000, 0.133975,
-    0.979426, -0.133256, 0.151549,
-    1.000000, 1.000000,
-    0.966643, -0.066567, 0.247326,
-    0.000000, 1.000000,
-    0.978530, 0.000000, 0.206103,
-    0.500000, 0.133975,
-    0.981483, -0.066604, 0.179596,
-    1.000000, 1.000000,
-    0.966393, -0.132792, 0.220117,
-    0.000000, 1.000000,
-    0.966643, -0.066567, 0.247326,
-    0.500000, 0.133975,
-    0.981483, -0.066604, 0.179596,
-    1.000000, 1.000000,
-    0.966643, -0.066567, 0.247326,
-    0.000000, 1.000000,
-    0.961938, 0.000000, 0.273267,
-    0.500000, 0.133975,
-    0.978530, 0.000000, 0.206103,
-    1.000000, 1.000000,
-    -0.485208, -0.704471, -0.517970,
-    0.000000, 1.000000,
-    -0.414273, -0.735011, -0.536784,
-    0.500000, 0.133975,
-    -0.443957, -0.678977, -0.584716,
-    1.000000, 1.000000,
-    -0.513375, -0.646578, -0.564254,
-    0.000000, 1.000000,
-    -0.485208, -0.704471, -0.517970,
-    0.500000, 0.133975,
-    -0.443957, -0.678977, -0.584716,
-    1.000000, 1.000000,
-    -0.485208, -0.704471, -0.517970,
-    0.000000, 1.000000,
-    -0.453990, -0.757935, -0.468430,
-    0.500000, 0.133975,
-    -0.414273, -0.735011, -0.536784,
-    1.000000, 1.000000,
-    -0.470917, -0.619242, -0.628313,
-    0.000000, 1.000000,
-    -0.443957, -0.678977, -0.584716,
-    0.500000, 0.133975,
-    -0.399769, -0.649448, -0.646840,
-    1.000000, 1.000000,
-    -0.425325, -0.587785, -0.688191,
-    0.000000, 1.000000,
-    -0.470917, -0.619242, -0.628313,
-    0.500000, 0.133975,
-    -0.399769, -0.649448, -0.646840,
-    1.000000, 1.000000,
-    -0.470917, -0.619242, -0.628313,
-    0.000000, 1.000000,
-    -0.513375, -0.646578, -0.564254,
-    0.500000, 0.133975,
-    -0.443957, -0.678977, -0.584716,
-    1.000000, 1.000000,
-    -0.552418, -0.669612, -0.496441,
-    0.000000, 1.000000,
-    -0.522499, -0.725299, -0.448259,
-    0.500000, 0.133975,
-    -0.485208, -0.704471, -0.517970,
-    1.000000, 1.000000,
-    -0.513375, -0.646578, -0.564254,
-    0.000000, 1.000000,
-    -0.552418, -0.669612, -0.496441,
-    0.500000, 0.133975,
-    -0.485208, -0.704471, -0.517970,
-    1.000000, 1.000000,
-    -0.552418, -0.669612, -0.496441,
-    0.000000, 1.000000,
-    -0.587785, -0.688191, -0.425325,
-    0.500000, 0.133975,
-    -0.522499, -0.725299, -0.448259,
-    1.000000, 1.000000,
-    -0.334692, -0.678913, -0.653497,
-    0.000000, 1.000000,
-    -0.305212, -0.734794, -0.605741,
-    0.500000, 0.133975,
-    -0.267381, -0.705236, -0.656620,
-    1.000000, 1.000000,
-    -0.296005, -0.647412, -0.702310,
-    0.000000, 1.000000,
-    -0.334692, -0.678913, -0.653497,
-    0.500000, 0.133975,
-    -0.267381, -0.705236, -0.656620,
-    1.000000, 1.000000,
-    -0.334692, -0.678913, -0.653497,
-    0.000000, 1.000000,
-    -0.371748, -0.707107, -0.601501,
-    0.500000, 0.133975,
-    -0.305212, -0.734794, -0.605741,
-    1.000000, 1.000000,
-    -0.228900, -0.672319, -0.703983,
-    0.000000, 1.000000,
-    -0.267381, -0.705236, -0.656620,
-    0.500000, 0.133975,
-    -0.199331, -0.727958, -0.656006,
-    1.000000, 1.000000,
-    -0.160622, -0.693780, -0.702046,
-    0.000000, 1.000000,
-    -0.228900, -0.672319, -0.703983,
-    0.500000, 0.133975,
-    -0.199331, -0.727958, -0.656006,
-    1.000000, 1.000000,
-    -0.228900, -0.672319, -0.703983,
-    0.000000, 1.000000,
-    -0.296005, -0.647412, -0.702310,
-    0.500000, 0.133975,
-    -0.267381, -0.705236, -0.656620,
-    1.000000, 1.000000,
-    -0.361592, -0.619186, -0.697037,
-    0.000000, 1.000000,
-    -0.399769, -0.649448, -0.646840,
-    0.500000, 0.133975,
-    -0.334692, -0.678913, -0.653497,
-    1.000000, 1.000000,
-    -0.296005, -0.647412, -0.702310,
-    0.000000, 1.000000,
-    -0.361592, -0.619186, -0.697037,
-    0.500000, 0.133975,
-    -0.334692, -0.678913, -0.653497,
-    1.000000, 1.000000,
-    -0.361592, -0.619186, -0.697037,
-    0.000000, 1.000000,
-    -0.425325, -0.587785, -0.688191,
-    0.500000, 0.133975,
-    -0.399769, -0.649448, -0.646840,
-    1.000000, 1.000000,
-    -0.816233, -0.366027, -0.446977,
-    0.000000, 1.000000,
-    -0.803016, -0.427135, -0.415597,
-    0.500000, 0.133975,
-    -0.772575, -0.408286, -0.486240,
-    1.000000, 1.000000,
-    -0.783452, -0.346153, -0.516122,
-    0.000000, 1.000000,
-    -0.816233, -0.366027, -0.446977,
-    0.500000, 0.133975,
-    -0.772575, -0.408286, -0.486240,
-    1.000000, 1.000000,
-    -0.816233, -0.366027, -0.446977,
-    0.000000, 1.000000,
-    -0.843911, -0.383614, -0.375039,
-    0.500000, 0.133975,
-    -0.803016, -0.427135, -0.415597,
-    1.000000, 1.000000,
-    -0.737712, -0.386730, -0.553372,
-    0.000000, 1.000000,
-    -0.772575, -0.408286, -0.486240,
-    0.500000, 0.133975,
-    -0.725299, -0.448259, -0.522499,
-    1.000000, 1.000000,
-    -0.688191, -0.425325, -0.587785,
-    0.000000, 1.000000,
-    -0.737712, -0.386730, -0.553372,
-    0.500000, 0.133975,
-    -0.725299, -0.448259, -0.522499,
-    1.000000, 1.000000,
-    -0.737712, -0.386730, -0.553372,
-    0.000000, 1.000000,
-    -0.783452, -0.346153, -0.516122,
-    0.500000, 0.133975,
-    -0.772575, -0.408286, -0.486240,
-    1.000000, 1.000000,
-    -0.825175, -0.303801, -0.476226,
-    0.000000, 1.000000,
-    -0.855337, -0.322525, -0.405434,
-    0.500000, 0.133975,
-    -0.816233, -0.366027, -0.446977,
-    1.000000, 1.000000,
-    -0.783452, -0.346153, -0.516122,
-    0.000000, 1.000000,
-    -0.825175, -0.303801, -0.476226,
-    0.500000, 0.133975,
-    -0.816233, -0.366027, -0.446977,
-    1.000000, 1.000000,
-    -0.825175, -0.303801, -0.476226,
-    0.000000, 1.000000,
-    -0.862668, -0.259892, -0.433889,
-    0.500000, 0.133975,
-    -0.855337, -0.322525, -0.405434,
-    1.000000, 1.000000,
-    0.584716, -0.443957, -0.678977,
-    0.000000, 1.000000,
-    0.536784, -0.414273, -0.735011,
-    0.500000, 0.133975,
-    0.517970, -0.485208, -0.704471,
-    1.000000, 1.000000,
-    0.564254, -0.513375, -0.646578,
-    0.000000, 1.000000,
-    0.584716, -0.443957, -0.678977,
-    0.500000, 0.133975,
-    0.517970, -0.485208, -0.704471,
-    1.000000, 1.000000,
-    0.584716, -0.443957, -0.678977,
-    0.000000, 1.000000,
-    0.601501, -0.371748, -0.707107,
-    0.500000, 0.133975,
-    0.536784, -0.414273, -0.735011,
-    1.000000, 1.000000,
-    0.496441, -0.552418, -0.669612,
-    0.000000, 1.000000,
-    0.517970, -0.485208, -0.704471,
-    0.500000, 0.133975,
-    0.448259, -0.522499, -0.725299,
-    1.000000, 1.000000,
-    0.425325, -0.587785, -0.688191,
-    0.000000, 1.000000,
-    0.496441, -0.552418, -0.669612,
-    0.500000, 0.133975,
-    0.448259, -0.522499, -0.725299,
-    1.000000, 1.000000,
-    0.496441, -0.552418, -0.669612,
-    0.000000, 1.000000,
-    0.564254, -0.513375, -0.646578,
-    0.500000, 0.133975,
-    0.517970, -0.485208, -0.704471,
-    1.000000, 1.000000,
-    0.628313, -0.470917, -0.619242,
-    0.000000, 1.000000,
-    0.646840, -0.399769, -0.649448,
-    0.500000, 0.133975,
-    0.584716, -0.443957, -0.678977,
-    1.000000, 1.000000,
-    0.564254, -0.513375, -0.646578,
-    0.000000, 1.000000,
-    0.628313, -0.470917, -0.619242,
-    0.500000, 0.133975,
-    0.584716, -0.443957, -0.678977,
-    1.000000, 1.000000,
-    0.628313, -0.470917, -0.619242,
-    0.000000, 1.000000,
-    0.688191, -0.425325, -0.587785,
-    0.500000, 0.133975,
-    0.646840, -0.399769, -0.649448,
-    1.000000, 1.000000,
-    0.408286, -0.486240, -0.772575,
-    0.000000, 1.000000,
-    0.427135, -0.415597, -0.803016,
-    0.500000, 0.133975,
-    0.366027, -0.446977, -0.816233,
-    1.000000, 1.000000,
-    0.346153, -0.516122, -0.783452,
-    0.000000, 1.000000,
-    0.408286, -0.486240, -0.772575,
-    0.500000, 0.133975,
-    0.366027, -0.446977, -0.816233,
-    1.000000, 1.000000,
-    0.408286, -0.486240, -0.772575,
-    0.000000, 1.000000,
-    0.468430, -0.453990, -0.757935,
-    0.500000, 0.133975,
-    0.427135, -0.415597, -0.803016,
-    1.000000, 1.000000,
-    0.303801, -0.476226, -0.825175,
-    0.000000, 1.000000,
-    0.366027, -0.446977, -0.816233,
-    0.500000, 0.133975,
-    0.322525, -0.405434, -0.855337,
-    1.000000, 1.000000,
-    0.259892, -0.433889, -0.862668,
-    0.000000, 1.000000,
-    0.303801, -0.476226, -0.825175,
-    0.500000, 0.133975,
-    0.322525, -0.405434, -0.855337,
-    1.000000, 1.000000,
-    0.303801, -0.476226, -0.825175,
-    0.000000, 1.000000,
-    0.346153, -0.516122, -0.783452,
-    0.500000, 0.133975,
-    0.366027, -0.446977, -0.816233,
-    1.000000, 1.000000,
-    0.386730, -0.553372, -0.737712,
-    0.000000, 1.000000,
-    0.448259, -0.522499, -0.725299,
-    0.500000, 0.133975,
-    0.408286, -0.486240, -0.772575,
-    1.000000, 1.000000,
-    0.346153, -0.516122, -0.783452,
-    0.000000, 1.000000,
-    0.386730, -0.553372, -0.737712,
-    0.500000, 0.133975,
-    0.408286, -0.486240, -0.772575,
-    1.000000, 1.000000,
-    0.386730, -0.553372, -0.737712,
-    0.000000, 1.000000,
-    0.425325, -0.587785, -0.688191,
-    0.500000, 0.133975,
-    0.448259, -0.522499, -0.725299,
-    1.000000, 1.000000,
-    0.705236, -0.656620, -0.267381,
-    0.000000, 1.000000,
-    0.734794, -0.605741, -0.305212,
-    0.500000, 0.133975,
-    0.678913, -0.653497, -0.334692,
-    1.000000, 1.000000,
-    0.647412, -0.702310, -0.296005,
-    0.000000, 1.000000,
-    0.705236, -0.656620, -0.267381,
-    0.500000, 0.133975,
-    0.678913, -0.653497, -0.334692,
-    1.000000, 1.000000,
-    0.705236, -0.656620, -0.267381,
-    0.000000, 1.000000,
-    0.758652, -0.606825, -0.237086,
-    0.500000, 0.133975,
-    0.734794, -0.605741, -0.305212,
-    1.000000, 1.000000,
-    0.619186, -0.697037, -0.361592,
-    0.000000, 1.000000,
-    0.678913, -0.653497, -0.334692,
-    0.500000, 0.133975,
-    0.649448, -0.646840, -0.399769,
-    1.000000, 1.000000,
-    0.587785, -0.688191, -0.425325,
-    0.000000, 1.000000,
-    0.619186, -0.697037, -0.361592,
-    0.500000, 0.133975,
-    0.649448, -0.646840, -0.399769,
-    1.000000, 1.000000,
-    0.619186, -0.697037, -0.361592,
-    0.000000, 1.000000,
-    0.647412, -0.702310, -0.296005,
-    0.500000, 0.133975,
-    0.678913, -0.653497, -0.334692,
-    1.000000, 1.000000,
-    0.672319, -0.703983, -0.228900,
-    0.000000, 1.000000,
-    0.727958, -0.656006, -0.199331,
-    0.500000, 0.133975,
-    0.705236, -0.656620, -0.267381,
-    1.000000, 1.000000,
-    0.647412, -0.702310, -0.296005,
-    0.000000, 1.000000,
-    0.672319, -0.703983, -0.228900,
-    0.500000, 0.133975,
-    0.705236, -0.656620, -0.267381,
-    1.000000, 1.000000,
-    0.672319, -0.703983, -0.228900,
-    0.000000, 1.000000,
-    0.693780, -0.702046, -0.160622,
-    0.500000, 0.133975,
-    0.727958, -0.656006, -0.199331,
-    1.000000, 1.000000,
-    -0.584716, -0.443957, 0.678977,
-    0.000000, 1.000000,
-    -0.536784, -0.414273, 0.735011,
-    0.500000, 0.133975,
-    -0.517970, -0.485208, 0.704471,
-    1.000000, 1.000000,
-    -0.564254, -0.513375, 0.646578,
-    0.000000, 1.000000,
-    -0.584716, -0.443957, 0.678977,
-    0.500000, 0.133975,
-    -0.517970, -0.485208, 0.704471,
-    1.000000, 1.000000,
-    -0.584716, -0.443957, 0.678977,
-    0.000000, 1.000000,
-    -0.601501, -0.371748, 0.707107,
-    0.500000, 0.133975,
-    -0.536784, -0.414273, 0.735011,
-    1.000000, 1.000000,
-    -0.496441, -0.552418, 0.669612,
-    0.000000, 1.000000,
-    -0.517970, -0.485208, 0.704471,
-    0.500000, 0.133975,
-    -0.448259, -0.522499, 0.725299,
-    1.000000, 1.000000,
-    -0.425325, -0.587785, 0.688191,
-    0.000000, 1.000000,
-    -0.496441, -0.552418, 0.669612,
-    0.500000, 0.133975,
-    -0.448259, -0.522499, 0.725299,
-    1.000000, 1.000000,
-    -0.496441, -0.552418, 0.669612,
-    0.000000, 1.000000,
-    -0.564254, -0.513375, 0.646578,
-    0.500000, 0.133975,
-    -0.517970, -0.485208, 0.704471,
-    1.000000, 1.000000,
-    -0.628313, -0.470917, 0.619242,
-    0.000000, 1.000000,
-    -0.646840, -0.399769, 0.649448,
-    0.500000, 0.133975,
-    -0.584716, -0.443957, 0.678977,
-    1.000000, 1.000000,
-    -0.564254, -0.513375, 0.646578,
-    0.000000, 1.000000,
-    -0.628313, -0.470917, 0.619242,
-    0.500000, 0.133975,
-    -0.584716, -0.443957, 0.678977,
-    1.000000, 1.000000,
-    -0.628313, -0.470917, 0.619242,
-    0.000000, 1.000000,
-    -0.688191, -0.425325, 0.587785,
-    0.500000, 0.133975,
-    -0.646840, -0.399769, 0.649448,
-    1.000000, 1.000000,
-    -0.408286, -0.486240, 0.772575,
-    0.000000, 1.000000,
-    -0.427135, -0.415597, 0.803016,
-    0.500000, 0.133975,
-    -0.366027, -0.446977, 0.816233,
-    1.000000, 1.000000,
-    -0.346153, -0.516122, 0.783452,
-    0.000000, 1.000000,
-    -0.408286, -0.486240, 0.772575,
-    0.500000, 0.133975,
-    -0.366027, -0.446977, 0.816233,
-    1.000000, 1.000000,
-    -0.408286, -0.486240, 0.772575,
-    0.000000, 1.000000,
-    -0.468430, -0.453990, 0.757935,
-    0.500000, 0.133975,
-    -0.427135, -0.415597, 0.803016,
-    1.000000, 1.000000,
-    -0.303801, -0.476226, 0.825175,
-    0.000000, 1.000000,
-    -0.366027, -0.446977, 0.816233,
-    0.500000, 0.133975,
-    -0.322525, -0.405434, 0.855337,
-    1.000000, 1.000000,
-    -0.259892, -0.433889, 0.862668,
-    0.000000, 1.000000,
-    -0.303801, -0.476226, 0.825175,
-    0.500000, 0.133975,
-    -0.322525, -0.405434, 0.855337,
-    1.000000, 1.000000,
-    -0.303801, -0.476226, 0.825175,
-    0.000000, 1.000000,
-    -0.346153, -0.516122, 0.783452,
-    0.500000, 0.133975,
-    -0.366027, -0.446977, 0.816233,
-    1.000000, 1.000000,
-    -0.386730, -0.553372, 0.737712,
-    0.000000, 1.000000,
-    -0.448259, -0.522499, 0.725299,
-    0.500000, 0.133975,
-    -0.408286, -0.486240, 0.772575,
-    1.000000, 1.000000,
-    -0.346153, -0.516122, 0.783452,
-    0.000000, 1.000000,
-    -0.386730, -0.553372, 0.737712,
-    0.500000, 0.133975,
-    -0.408286, -0.486240, 0.772575,
-    1.000000, 1.000000,
-    -0.386730, -0.553372, 0.737712,
-    0.000000, 1.000000,
-    -0.425325, -0.587785, 0.688191,
-    0.500000, 0.133975,
-    -0.448259, -0.522499, 0.725299,
-    1.000000, 1.000000,
-    -0.705236, -0.656620, 0.267381,
-    0.000000, 1.000000,
-    -0.734794, -0.605741, 0.305212,
-    0.500000, 0.133975,
-    -0.678913, -0.653497, 0.334692,
-    1.000000, 1.000000,
-    -0.647412, -0.702310, 0.296005,
-    0.000000, 1.000000,
-    -0.705236, -0.656620, 0.267381,
-    0.500000, 0.133975,
-    -0.678913, -0.653497, 0.334692,
-    1.000000, 1.000000,
-    -0.705236, -0.656620, 0.267381,
-    0.000000, 1.000000,
-    -0.758652, -0.606825, 0.237086,
-    0.500000, 0.133975,
-    -0.734794, -0.605741, 0.305212,
-    1.000000, 1.000000,
-    -0.619186, -0.697037, 0.361592,
-    0.000000, 1.000000,
-    -0.678913, -0.653497, 0.334692,
-    0.500000, 0.133975,
-    -0.649448, -0.646840, 0.399769,
-    1.000000, 1.000000,
-    -0.587785, -0.688191, 0.425325,
-    0.000000, 1.000000,
-    -0.619186, -0.697037, 0.361592,
-    0.500000, 0.133975,
-    -0.649448, -0.646840, 0.399769,
-    1.000000, 1.000000,
-    -0.619186, -0.697037, 0.361592,
-    0.000000, 1.000000,
-    -0.647412, -0.702310, 0.296005,
-    0.500000, 0.133975,
-    -0.678913, -0.653497, 0.334692,
-    1.000000, 1.000000,
-    -0.672319, -0.703983, 0.228900,
-    0.000000, 1.000000,
-    -0.727958, -0.656006, 0.199331,
-    0.500000, 0.133975,
-    -0.705236, -0.656620, 0.267381,
-    1.000000, 1.000000,
-    -0.647412, -0.702310, 0.296005,
-    0.000000, 1.000000,
-    -0.672319, -0.703983, 0.228900,
-    0.500000, 0.133975,
-    -0.705236, -0.656620, 0.267381,
-    1.000000, 1.000000,
-    -0.672319, -0.703983, 0.228900,
-    0.000000, 1.000000,
-    -0.693780, -0.702046, 0.160622,
-    0.500000, 0.133975,
-    -0.727958, -0.656006, 0.199331,
-    1.000000, 1.000000,
-    0.485208, -0.704471, 0.517970,
-    0.000000, 1.000000,
-    0.414273, -0.735011, 0.536784,
-    0.500000, 0.133975,
-    0.443957, -0.678977, 0.584716,
-    1.000000, 1.000000,
-    0.513375, -0.646578, 0.564254,
-    0.000000, 1.000000,
-    0.485208, -0.704471, 0.517970,
-    0.500000, 0.133975,
-    0.443957, -0.678977, 0.584716,
-    1.000000, 1.000000,
-    0.485208, -0.704471, 0.517970,
-    0.000000, 1.000000,
-    0.453990, -0.757935, 0.468430,
-    0.500000, 0.133975,
-    0.414273, -0.735011, 0.536784,
-    1.000000, 1.000000,
-    0.470917, -0.619242, 0.628313,
-    0.000000, 1.000000,
-    0.443957, -0.678977, 0.584716,
-    0.500000, 0.133975,
-    0.399769, -0.649448, 0.646840,
-    1.000000, 1.000000,
-    0.425325, -0.587785, 0.688191,
-    0.000000, 1.000000,
-    0.470917, -0.619242, 0.628313,
-    0.500000, 0.133975,
-    0.399769, -0.649448, 0.646840,
-    1.000000, 1.000000,
-    0.470917, -0.619242, 0.628313,
-    0.000000, 1.000000,
-    0.513375, -0.646578, 0.564254,
-    0.500000, 0.133975,
-    0.443957, -0.678977, 0.584716,
-    1.000000, 1.000000,
-    0.552418, -0.669612, 0.496441,
-    0.000000, 1.000000,
-    0.522499, -0.725299, 0.448259,
-    0.500000, 0.133975,
-    0.485208, -0.704471, 0.517970,
-    1.000000, 1.000000,
-    0.513375, -0.646578, 0.564254,
-    0.000000, 1.000000,
-    0.552418, -0.669612, 0.496441,
-    0.500000, 0.133975,
-    0.485208, -0.704471, 0.517970,
-    1.000000, 1.000000,
-    0.552418, -0.669612, 0.496441,
-    0.000000, 1.000000,
-    0.587785, -0.688191, 0.425325,
-    0.500000, 0.133975,
-    0.522499, -0.725299, 0.448259,
-    1.000000, 1.000000,
-    0.334692, -0.678913, 0.653497,
-    0.000000, 1.000000,
-    0.305212, -0.734794, 0.605741,
-    0.500000, 0.133975,
-    0.267381, -0.705236, 0.656620,
-    1.000000, 1.000000,
-    0.296005, -0.647412, 0.702310,
-    0.000000, 1.000000,
-    0.334692, -0.678913, 0.653497,
-    0.500000, 0.133975,
-    0.267381, -0.705236, 0.656620,
-    1.000000, 1.000000,
-    0.334692, -0.678913, 0.653497,
-    0.000000, 1.000000,
-    0.371748, -0.707107, 0.601501,
-    0.500000, 0.133975,
-    0.305212, -0.734794, 0.605741,
-    1.000000, 1.000000,
-    0.228900, -0.672319, 0.703983,
-    0.000000, 1.000000,
-    0.267381, -0.705236, 0.656620,
-    0.500000, 0.133975,
-    0.199331, -0.727958, 0.656006,
-    1.000000, 1.000000,
-    0.160622, -0.693780, 0.702046,
-    0.000000, 1.000000,
-    0.228900, -0.672319, 0.703983,
-    0.500000, 0.133975,
-    0.199331, -0.727958, 0.656006,
-    1.000000, 1.000000,
-    0.228900, -0.672319, 0.703983,
-    0.000000, 1.000000,
-    0.296005, -0.647412, 0.702310,
-    0.500000, 0.133975,
-    0.267381, -0.705236, 0.656620,
-    1.000000, 1.000000,
-    0.361592, -0.619186, 0.697037,
-    0.000000, 1.000000,
-    0.399769, -0.649448, 0.646840,
-    0.500000, 0.133975,
-    0.334692, -0.678913, 0.653497,
-    1.000000, 1.000000,
-    0.296005, -0.647412, 0.702310,
-    0.000000, 1.000000,
-    0.361592, -0.619186, 0.697037,
-    0.500000, 0.133975,
-    0.334692, -0.678913, 0.653497,
-    1.000000, 1.000000,
-    0.361592, -0.619186, 0.697037,
-    0.000000, 1.000000,
-    0.425325, -0.587785, 0.688191,
-    0.500000, 0.133975,
-    0.399769, -0.649448, 0.646840,
-    1.000000, 1.000000,
-    0.816233, -0.366027, 0.446977,
-    0.000000, 1.000000,
-    0.803016, -0.427135, 0.415597,
-    0.500000, 0.133975,
-    0.772575, -0.408286, 0.486240,
-    1.000000, 1.000000,
-    0.783452, -0.346153, 0.516122,
-    0.000000, 1.000000,
-    0.816233, -0.366027, 0.446977,
-    0.500000, 0.133975,
-    0.772575, -0.408286, 0.486240,
-    1.000000, 1.000000,
-    0.816233, -0.366027, 0.446977,
-    0.000000, 1.000000,
-    0.843911, -0.383614, 0.375039,
-    0.500000, 0.133975,
-    0.803016, -0.427135, 0.415597,
-    1.000000, 1.000000,
-    0.737712, -0.386730, 0.553372,
-    0.000000, 1.000000,
-    0.772575, -0.408286, 0.486240,
-    0.500000, 0.133975,
-    0.725299, -0.448259, 0.522499,
-    1.000000, 1.000000,
-    0.688191, -0.425325, 0.587785,
-    0.000000, 1.000000,
-    0.737712, -0.386730, 0.553372,
-    0.500000, 0.133975,
-    0.725299, -0.448259, 0.522499,
-    1.000000, 1.000000,
-    0.737712, -0.386730, 0.553372,
-    0.000000, 1.000000,
-    0.783452, -0.346153, 0.516122,
-    0.500000, 0.133975,
-    0.772575, -0.408286, 0.486240,
-    1.000000, 1.000000,
-    0.825175, -0.303801, 0.476226,
-    0.000000, 1.000000,
-    0.855337, -0.322525, 0.405434,
-    0.500000, 0.133975,
-    0.816233, -0.366027, 0.446977,
-    1.000000, 1.000000,
-    0.783452, -0.346153, 0.516122,
-    0.000000, 1.000000,
-    0.825175, -0.303801, 0.476226,
-    0.500000, 0.133975,
-    0.816233, -0.366027, 0.446977,
-    1.000000, 1.000000,
-    0.825175, -0.303801, 0.476226,
-    0.000000, 1.000000,
-    0.862668, -0.259892, 0.433889,
-    0.500000, 0.133975,
-    0.855337, -0.322525, 0.405434,
-    1.000000, 1.000000,
-    -0.667502, -0.040677, 0.743496,
-    0.000000, 1.000000,
-    -0.667502, 0.040677, 0.743496,
-    0.500000, 0.133975,
-    -0.622292, 0.000000, 0.782786,
-    1.000000, 1.000000,
-    -0.620240, -0.081142, 0.780204,
-    0.000000, 1.000000,
-    -0.667502, -0.040677, 0.743496,
-    0.500000, 0.133975,
-    -0.622292, 0.000000, 0.782786,
-    1.000000, 1.000000,
-    -0.667502, -0.040677, 0.743496,
-    0.000000, 1.000000,
-    -0.711282, 0.000000, 0.702907,
-    0.500000, 0.133975,
-    -0.667502, 0.040677, 0.743496,
-    1.000000, 1.000000,
-    -0.574458, -0.040675, 0.817523,
-    0.000000, 1.000000,
-    -0.622292, 0.000000, 0.782786,
-    0.500000, 0.133975,
-    -0.574458, 0.040675, 0.817523,
-    1.000000, 1.000000,
-    -0.525731, 0.000000, 0.850651,
-    0.000000, 1.000000,
-    -0.574458, -0.040675, 0.817523,
-    0.500000, 0.133975,
-    -0.574458, 0.040675, 0.817523,
-    1.000000, 1.000000,
-    -0.574458, -0.040675, 0.817523,
-    0.000000, 1.000000,
-    -0.620240, -0.081142, 0.780204,
-    0.500000, 0.133975,
-    -0.622292, 0.000000, 0.782786,
-    1.000000, 1.000000,
-    -0.662842, -0.121193, 0.738886,
-    0.000000, 1.000000,
-    -0.708969, -0.080573, 0.700622,
-    0.500000, 0.133975,
-    -0.667502, -0.040677, 0.743496,
-    1.000000, 1.000000,
-    -0.620240, -0.081142, 0.780204,
-    0.000000, 1.000000,
-    -0.662842, -0.121193, 0.738886,
-    0.500000, 0.133975,
-    -0.667502, -0.040677, 0.743496,
-    1.000000, 1.000000,
-    -0.662842, -0.121193, 0.738886,
-    0.000000, 1.000000,
-    -0.702046, -0.160622, 0.693780,
-    0.500000, 0.133975,
-    -0.708969, -0.080573, 0.700622,
-    1.000000, 1.000000,
-    -0.524110, 0.078459, 0.848029,
-    0.000000, 1.000000,
-    -0.574458, 0.040675, 0.817523,
-    0.500000, 0.133975,
-    -0.571140, 0.119078, 0.812169,
-    1.000000, 1.000000,
-    -0.524110, 0.078459, 0.848029,
-    0.000000, 1.000000,
-    -0.525731, 0.000000, 0.850651,
-    0.500000, 0.133975,
-    -0.574458, 0.040675, 0.817523,
-    1.000000, 1.000000,
-    -0.564513, -0.197274, 0.801504,
-    0.000000, 1.000000,
-    -0.615456, -0.159613, 0.771841,
-    0.500000, 0.133975,
-    -0.571140, -0.119078, 0.812169,
-    1.000000, 1.000000,
-    -0.519258, -0.156434, 0.840178,
-    0.000000, 1.000000,
-    -0.564513, -0.197274, 0.801504,
-    0.500000, 0.133975,
-    -0.571140, -0.119078, 0.812169,
-    1.000000, 1.000000,
-    -0.564513, -0.197274, 0.801504,
-    0.000000, 1.000000,
-    -0.606825, -0.237086, 0.758652,
-    0.500000, 0.133975,
-    -0.615456, -0.159613, 0.771841,
-    1.000000, 1.000000,
-    -0.524110, -0.078459, 0.848029,
-    0.000000, 1.000000,
-    -0.571140, -0.119078, 0.812169,
-    0.500000, 0.133975,
-    -0.574458, -0.040675, 0.817523,
-    1.000000, 1.000000,
-    -0.525731, 0.000000, 0.850651,
-    0.000000, 1.000000,
-    -0.524110, -0.078459, 0.848029,
-    0.500000, 0.133975,
-    -0.574458, -0.040675, 0.817523,
-    1.000000, 1.000000,
-    -0.524110, -0.078459, 0.848029,
-    0.000000, 1.000000,
-    -0.519258, -0.156434, 0.840178,
-    0.500000, 0.133975,
-    -0.571140, -0.119078, 0.812169,
-    1.000000, 1.000000,
-    -0.511205, -0.233445, 0.827147,
-    0.000000, 1.000000,
-    -0.554740, -0.273707, 0.785715,
-    0.500000, 0.133975,
-    -0.564513, -0.197274, 0.801504,
-    1.000000, 1.000000,
-    -0.519258, -0.156434, 0.840178,
-    0.000000, 1.000000,
-    -0.511205, -0.233445, 0.827147,
-    0.500000, 0.133975,
-    -0.564513, -0.197274, 0.801504,
-    1.000000, 1.000000,
-    -0.511205, -0.233445, 0.827147,
-    0.000000, 1.000000,
-    -0.500000, -0.309017, 0.809017,
-    0.500000, 0.133975,
-    -0.554740, -0.273707, 0.785715,
-    1.000000, 1.000000,
-    0.198387, -0.330607, 0.922682,
-    0.000000, 1.000000,
-    0.132570, -0.289929, 0.947822,
-    0.500000, 0.133975,
-    0.199094, -0.261550, 0.944433,
-    1.000000, 1.000000,
-    0.264083, -0.301259, 0.916244,
-    0.000000, 1.000000,
-    0.198387, -0.330607, 0.922682,
-    0.500000, 0.133975,
-    0.199094, -0.261550, 0.944433,
-    1.000000, 1.000000,
-    0.198387, -0.330607, 0.922682,
-    0.000000, 1.000000,
-    0.131655, -0.358229, 0.924305,
-    0.500000, 0.133975,
-    0.132570, -0.289929, 0.947822,
-    1.000000, 1.000000,
-    0.264151, -0.232455, 0.936050,
-    0.000000, 1.000000,
-    0.199094, -0.261550, 0.944433,
-    0.500000, 0.133975,
-    0.198337, -0.191780, 0.961188,
-    1.000000, 1.000000,
-    0.262866, -0.162460, 0.951057,
-    0.000000, 1.000000,
-    0.264151, -0.232455, 0.936050,
-    0.500000, 0.133975,
-    0.198337, -0.191780, 0.961188,
-    1.000000, 1.000000,
-    0.264151, -0.232455, 0.936050,
-    0.000000, 1.000000,
-    0.264083, -0.301259, 0.916244,
-    0.500000, 0.133975,
-    0.199094, -0.261550, 0.944433,
-    1.000000, 1.000000,
-    0.262661, -0.368518, 0.891742,
-    0.000000, 1.000000,
-    0.196412, -0.397351, 0.896401,
-    0.500000, 0.133975,
-    0.198387, -0.330607, 0.922682,
-    1.000000, 1.000000,
-    0.264083, -0.301259, 0.916244,
-    0.000000, 1.000000,
-    0.262661, -0.368518, 0.891742,
-    0.500000, 0.133975,
-    0.198387, -0.330607, 0.922682,
-    1.000000, 1.000000,
-    0.262661, -0.368518, 0.891742,
-    0.000000, 1.000000,
-    0.259892, -0.433889, 0.862668,
-    0.500000, 0.133975,
-    0.196412, -0.397351, 0.896401,
-    1.000000, 1.000000,
-    0.133256, -0.151549, 0.979426,
-    0.000000, 1.000000,
-    0.066604, -0.179596, 0.981483,
-    0.500000, 0.133975,
-    0.066709, -0.110385, 0.991648,
-    1.000000, 1.000000,
-    0.133071, -0.082242, 0.987688,
-    0.000000, 1.000000,
-    0.133256, -0.151549, 0.979426,
-    0.500000, 0.133975,
-    0.066709, -0.110385, 0.991648,
-    1.000000, 1.000000,
-    0.133256, -0.151549, 0.979426,
-    0.000000, 1.000000,
-    0.132792, -0.220117, 0.966393,
-    0.500000, 0.133975,
-    0.066604, -0.179596, 0.981483,
-    1.000000, 1.000000,
-    0.066741, -0.041248, 0.996917,
-    0.000000, 1.000000,
-    0.066709, -0.110385, 0.991648,
-    0.500000, 0.133975,
-    0.000000, -0.069142, 0.997607,
-    1.000000, 1.000000,
-    0.000000, 0.000000, 1.000000,
-    0.000000, 1.000000,
-    0.066741, -0.041248, 0.996917,
-    0.500000, 0.133975,
-    0.000000, -0.069142, 0.997607,
-    1.000000, 1.000000,
-    0.066741, -0.041248, 0.996917,
-    0.000000, 1.000000,
-    0.133071, -0.082242, 0.987688,
-    0.500000, 0.133975,
-    0.066709, -0.110385, 0.991648,
-    1.000000, 1.000000,
-    0.198580, -0.122729, 0.972370,
-    0.000000, 1.000000,
-    0.198337, -0.191780, 0.961188,
-    0.500000, 0.133975,
-    0.133256, -0.151549, 0.979426,
-    1.000000, 1.000000,
-    0.133071, -0.082242, 0.987688,
-    0.000000, 1.000000,
-    0.198580, -0.122729, 0.972370,
-    0.500000, 0.133975,
-    0.133256, -0.151549, 0.979426,
-    1.000000, 1.000000,
-    0.198580, -0.122729, 0.972370,
-    0.000000, 1.000000,
-    0.262866, -0.162460, 0.951057,
-    0.500000, 0.133975,
-    0.198337, -0.191780, 0.961188,
-    1.000000, 1.000000,
-    0.385906, -0.307659, 0.869725,
-    0.000000, 1.000000,
-    0.324864, -0.339209, 0.882837,
-    0.500000, 0.133975,
-    0.325929, -0.270627, 0.905832,
-    1.000000, 1.000000,
-    0.386187, -0.238677, 0.891007,
-    0.000000, 1.000000,
-    0.385906, -0.307659, 0.869725,
-    0.500000, 0.133975,
-    0.325929, -0.270627, 0.905832,
-    1.000000, 1.000000,
-    0.385906, -0.307659, 0.869725,
-    0.000000, 1.000000,
-    0.383614, -0.375039, 0.843911,
-    0.500000, 0.133975,
-    0.324864, -0.339209, 0.882837,
-    1.000000, 1.000000,
-    0.325530, -0.201189, 0.923880,
-    0.000000, 1.000000,
-    0.325929, -0.270627, 0.905832,
-    0.500000, 0.133975,
-    0.264151, -0.232455, 0.936050,
-    1.000000, 1.000000,
-    0.262866, -0.162460, 0.951057,
-    0.000000, 1.000000,
-    0.325530, -0.201189, 0.923880,
-    0.500000, 0.133975,
-    0.264151, -0.232455, 0.936050,
-    1.000000, 1.000000,
-    0.325530, -0.201189, 0.923880,
-    0.000000, 1.000000,
-    0.386187, -0.238677, 0.891007,
-    0.500000, 0.133975,
-    0.325929, -0.270627, 0.905832,
-    1.000000, 1.000000,
-    0.444464, -0.274694, 0.852640,
-    0.000000, 1.000000,
-    0.442867, -0.342848, 0.828447,
-    0.500000, 0.133975,
-    0.385906, -0.307659, 0.869725,
-    1.000000, 1.000000,
-    0.386187, -0.238677, 0.891007,
-    0.000000, 1.000000,
-    0.444464, -0.274694, 0.852640,
-    0.500000, 0.133975,
-    0.385906, -0.307659, 0.869725,
-    1.000000, 1.000000,
-    0.444464, -0.274694, 0.852640,
-    0.000000, 1.000000,
-    0.500000, -0.309017, 0.809017,
-    0.500000, 0.133975,
-    0.442867, -0.342848, 0.828447,
-    1.000000, 1.000000,
-    0.667502, -0.040677, -0.743496,
-    0.000000, 1.000000,
-    0.667502, 0.040677, -0.743496,
-    0.500000, 0.133975,
-    0.622292, 0.000000, -0.782786,
-    1.000000, 1.000000,
-    0.620240, -0.081142, -0.780204,
-    0.000000, 1.000000,
-    0.667502, -0.040677, -0.743496,
-    0.500000, 0.133975,
-    0.622292, 0.000000, -0.782786,
-    1.000000, 1.000000,
-    0.667502, -0.040677, -0.743496,
-    0.000000, 1.000000,
-    0.711282, 0.000000, -0.702907,
-    0.500000, 0.133975,
-    0.667502, 0.040677, -0.743496,
-    1.000000, 1.000000,
-    0.574458, -0.040675, -0.817523,
-    0.000000, 1.000000,
-    0.622292, 0.000000, -0.782786,
-    0.500000, 0.133975,
-    0.574458, 0.040675, -0.817523,
-    1.000000, 1.000000,
-    0.525731, 0.000000, -0.850651,
-    0.000000, 1.000000,
-    0.574458, -0.040675, -0.817523,
-    0.500000, 0.133975,
-    0.574458, 0.040675, -0.817523,
-    1.000000, 1.000000,
-    0.574458, -0.040675, -0.817523,
-    0.000000, 1.000000,
-    0.620240, -0.081142, -0.780204,
-    0.500000, 0.133975,
-    0.622292, 0.000000, -0.782786,
-    1.000000, 1.000000,
-    0.662842, -0.121193, -0.738886,
-    0.000000, 1.000000,
-    0.708969, -0.080573, -0.700622,
-    0.500000, 0.133975,
-    0.667502, -0.040677, -0.743496,
-    1.000000, 1.000000,
-    0.620240, -0.081142, -0.780204,
-    0.000000, 1.000000,
-    0.662842, -0.121193, -0.738886,
-    0.500000, 0.133975,
-    0.667502, -0.040677, -0.743496,
-    1.000000, 1.000000,
-    0.662842, -0.121193, -0.738886,
-    0.000000, 1.000000,
-    0.702046, -0.160622, -0.693780,
-    0.500000, 0.133975,
-    0.708969, -0.080573, -0.700622,
-    1.000000, 1.000000,
-    0.524110, 0.078459, -0.848029,
-    0.000000, 1.000000,
-    0.574458, 0.040675, -0.817523,
-    0.500000, 0.133975,
-    0.571140, 0.119078, -0.812169,
-    1.000000, 1.000000,
-    0.524110, 0.078459, -0.848029,
-    0.000000, 1.000000,
-    0.525731, 0.000000, -0.850651,
-    0.500000, 0.133975,
-    0.574458, 0.040675, -0.817523,
-    1.000000, 1.000000,
-    0.564513, -0.197274, -0.801504,
-    0.000000, 1.000000,
-    0.615456, -0.159613, -0.771841,
-    0.500000, 0.133975,
-    0.571140, -0.119078, -0.812169,
-    1.000000, 1.000000,
-    0.519258, -0.156434, -0.840178,
-    0.000000, 1.000000,
-    0.564513, -0.197274, -0.801504,
-    0.500000, 0.133975,
-    0.571140, -0.119078, -0.812169,
-    1.000000, 1.000000,
-    0.564513, -0.197274, -0.801504,
-    0.000000, 1.000000,
-    0.606825, -0.237086, -0.758652,
-    0.500000, 0.133975,
-    0.615456, -0.159613, -0.771841,
-    1.000000, 1.000000,
-    0.524110, -0.078459, -0.848029,
-    0.000000, 1.000000,
-    0.571140, -0.119078, -0.812169,
-    0.500000, 0.133975,
-    0.574458, -0.040675, -0.817523,
-    1.000000, 1.000000,
-    0.525731, 0.000000, -0.850651,
-    0.000000, 1.000000,
-    0.524110, -0.078459, -0.848029,
-    0.500000, 0.133975,
-    0.574458, -0.040675, -0.817523,
-    1.000000, 1.000000,
-    0.524110, -0.078459, -0.848029,
-    0.000000, 1.000000,
-    0.519258, -0.156434, -0.840178,
-    0.500000, 0.133975,
-    0.571140, -0.119078, -0.812169,
-    1.000000, 1.000000,
-    0.511205, -0.233445, -0.827147,
-    0.000000, 1.000000,
-    0.554740, -0.273707, -0.785715,
-    0.500000, 0.133975,
-    0.564513, -0.197274, -0.801504,
-    1.000000, 1.000000,
-    0.519258, -0.156434, -0.840178,
-    0.000000, 1.000000,
-    0.511205, -0.233445, -0.827147,
-    0.500000, 0.133975,
-    0.564513, -0.197274, -0.801504,
-    1.000000, 1.000000,
-    0.511205, -0.233445, -0.827147,
-    0.000000, 1.000000,
-    0.500000, -0.309017, -0.809017,
-    0.500000, 0.133975,
-    0.554740, -0.273707, -0.785715,
-    1.000000, 1.000000,
-    -0.198387, -0.330607, -0.922682,
-    0.000000, 1.000000,
-    -0.132570, -0.289929, -0.947822,
-    0.500000, 0.133975,
-    -0.199094, -0.261550, -0.944433,
-    1.000000, 1.000000,
-    -0.264083, -0.301259, -0.916244,
-    0.000000, 1.000000,
-    -0.198387, -0.330607, -0.922682,
-    0.500000, 0.133975,
-    -0.199094, -0.261550, -0.944433,
-    1.000000, 1.000000,
-    -0.198387, -0.330607, -0.922682,
-    0.000000, 1.000000,
-    -0.131655, -0.358229, -0.924305,
-    0.500000, 0.133975,
-    -0.132570, -0.289929, -0.947822,
-    1.000000, 1.000000,
-    -0.264151, -0.232455, -0.936050,
-    0.000000, 1.000000,
-    -0.199094, -0.261550, -0.944433,
-    0.500000, 0.133975,
-    -0.198337, -0.191780, -0.961188,
-    1.000000, 1.000000,
-    -0.262866, -0.162460, -0.951057,
-    0.000000, 1.000000,
-    -0.264151, -0.232455, -0.936050,
-    0.500000, 0.133975,
-    -0.198337, -0.191780, -0.961188,
-    1.000000, 1.000000,
-    -0.264151, -0.232455, -0.936050,
-    0.000000, 1.000000,
-    -0.264083, -0.301259, -0.916244,
-    0.500000, 0.133975,
-    -0.199094, -0.261550, -0.944433,
-    1.000000, 1.000000,
-    -0.262661, -0.368518, -0.891742,
-    0.000000, 1.000000,
-    -0.196412, -0.397351, -0.896401,
-    0.500000, 0.133975,
-    -0.198387, -0.330607, -0.922682,
-    1.000000, 1.000000,
-    -0.264083, -0.301259, -0.916244,
-    0.000000, 1.000000,
-    -0.262661, -0.368518, -0.891742,
-    0.500000, 0.133975,
-    -0.198387, -0.330607, -0.922682,
-    1.000000, 1.000000,
-    -0.262661, -0.368518, -0.891742,
-    0.000000, 1.000000,
-    -0.259892, -0.433889, -0.862668,
-    0.500000, 0.133975,
-    -0.196412, -0.397351, -0.896401,
-    1.000000, 1.000000,
-    -0.133256, -0.151549, -0.979426,
-    0.000000, 1.000000,
-    -0.066604, -0.179596, -0.981483,
-    0.500000, 0.133975,
-    -0.066709, -0.110385, -0.991648,
-    1.000000, 1.000000,
-    -0.133071, -0.082242, -0.987688,
-    0.000000, 1.000000,
-    -0.133256, -0.151549, -0.979426,
-    0.500000, 0.133975,
-    -0.066709, -0.110385, -0.991648,
-    1.000000, 1.000000,
-    -0.133256, -0.151549, -0.979426,
-    0.000000, 1.000000,
-    -0.132792, -0.220117, -0.966393,
-    0.500000, 0.133975,
-    -0.066604, -0.179596, -0.981483,
-    1.000000, 1.000000,
-    -0.066741, -0.041248, -0.996917,
-    0.000000, 1.000000,
-    -0.066709, -0.110385, -0.991648,
-    0.500000, 0.133975,
-    0.000000, -0.069142, -0.997607,
-    1.000000, 1.000000,
-    0.000000, 0.000000, -1.000000,
-    0.000000, 1.000000,
-    -0.066741, -0.041248, -0.996917,
-    0.500000, 0.133975,
-    0.000000, -0.069142, -0.997607,
-    1.000000, 1.000000,
-    -0.066741, -0.041248, -0.996917,
-    0.000000, 1.000000,
-    -0.133071, -0.082242, -0.987688,
-    0.500000, 0.133975,
-    -0.066709, -0.110385, -0.991648,
-    1.000000, 1.000000,
-    -0.198580, -0.122729, -0.972370,
-    0.000000, 1.000000,
-    -0.198337, -0.191780, -0.961188,
-    0.500000, 0.133975,
-    -0.133256, -0.151549, -0.979426,
-    1.000000, 1.000000,
-    -0.133071, -0.082242, -0.987688,
-    0.000000, 1.000000,
-    -0.198580, -0.122729, -0.972370,
-    0.500000, 0.133975,
-    -0.133256, -0.151549, -0.979426,
-    1.000000, 1.000000,
-    -0.198580, -0.122729, -0.972370,
-    0.000000, 1.000000,
-    -0.262866, -0.162460, -0.951057,
-    0.500000, 0.133975,
-    -0.198337, -0.191780, -0.961188,
-    1.000000, 1.000000,
-    -0.385906, -0.307659, -0.869725,
-    0.000000, 1.000000,
-    -0.324864, -0.339209, -0.882837,
-    0.500000, 0.133975,
-    -0.325929, -0.270627, -0.905832,
-    1.000000, 1.000000,
-    -0.386187, -0.238677, -0.891007,
-    0.000000, 1.000000,
-    -0.385906, -0.307659, -0.869725,
-    0.500000, 0.133975,
-    -0.325929, -0.270627, -0.905832,
-    1.000000, 1.000000,
-    -0.385906, -0.307659, -0.869725,
-    0.000000, 1.000000,
-    -0.383614, -0.375039, -0.843911,
-    0.500000, 0.133975,
-    -0.324864, -0.339209, -0.882837,
-    1.000000, 1.000000,
-    -0.325530, -0.201189, -0.923880,
-    0.000000, 1.000000,
-    -0.325929, -0.270627, -0.905832,
-    0.500000, 0.133975,
-    -0.264151, -0.232455, -0.936050,
-    1.000000, 1.000000,
-    -0.262866, -0.162460, -0.951057,
-    0.000000, 1.000000,
-    -0.325530, -0.201189, -0.923880,
-    0.500000, 0.133975,
-    -0.264151, -0.232455, -0.936050,
-    1.000000, 1.000000,
-    -0.325530, -0.201189, -0.923880,
-    0.000000, 1.000000,
-    -0.386187, -0.238677, -0.891007,
-    0.500000, 0.133975,
-    -0.325929, -0.270627, -0.905832,
-    1.000000, 1.000000,
-    -0.444464, -0.274694, -0.852640,
-    0.000000, 1.000000,
-    -0.442867, -0.342848, -0.828447,
-    0.500000, 0.133975,
-    -0.385906, -0.307659, -0.869725,
-    1.000000, 1.000000,
-    -0.386187, -0.238677, -0.891007,
-    0.000000, 1.000000,
-    -0.444464, -0.274694, -0.852640,
-    0.500000, 0.133975,
-    -0.385906, -0.307659, -0.869725,
-    1.000000, 1.000000,
-    -0.444464, -0.274694, -0.852640,
-    0.000000, 1.000000,
-    -0.500000, -0.309017, -0.809017,
-    0.500000, 0.133975,
-    -0.442867, -0.342848, -0.828447,
-    1.000000, 1.000000,
-    -0.289929, -0.947822, 0.132570,
-    0.000000, 1.000000,
-    -0.330607, -0.922682, 0.198387,
-    0.500000, 0.133975,
-    -0.261550, -0.944433, 0.199094,
-    1.000000, 1.000000,
-    -0.220117, -0.966393, 0.132792,
-    0.000000, 1.000000,
-    -0.289929, -0.947822, 0.132570,
-    0.500000, 0.133975,
-    -0.261550, -0.944433, 0.199094,
-    1.000000, 1.000000,
-    -0.289929, -0.947822, 0.132570,
-    0.000000, 1.000000,
-    -0.358229, -0.924305, 0.131655,
-    0.500000, 0.133975,
-    -0.330607, -0.922682, 0.198387,
-    1.000000, 1.000000,
-    -0.191780, -0.961188, 0.198337,
-    0.000000, 1.000000,
-    -0.261550, -0.944433, 0.199094,
-    0.500000, 0.133975,
-    -0.232455, -0.936050, 0.264151,
-    1.000000, 1.000000,
-    -0.162460, -0.951057, 0.262866,
-    0.000000, 1.000000,
-    -0.191780, -0.961188, 0.198337,
-    0.500000, 0.133975,
-    -0.232455, -0.936050, 0.264151,
-    1.000000, 1.000000,
-    -0.191780, -0.961188, 0.198337,
-    0.000000, 1.000000,
-    -0.220117, -0.966393, 0.132792,
-    0.500000, 0.133975,
-    -0.261550, -0.944433, 0.199094,
-    1.000000, 1.000000,
-    -0.247326, -0.966643, 0.066567,
-    0.000000, 1.000000,
-    -0.316778, -0.946198, 0.066042,
-    0.500000, 0.133975,
-    -0.289929, -0.947822, 0.132570,
-    1.000000, 1.000000,
-    -0.220117, -0.966393, 0.132792,
-    0.000000, 1.000000,
-    -0.247326, -0.966643, 0.066567,
-    0.500000, 0.133975,
-    -0.289929, -0.947822, 0.132570,
-    1.000000, 1.000000,
-    -0.247326, -0.966643, 0.066567,
-    0.000000, 1.000000,
-    -0.273267, -0.961938, 0.000000,
-    0.500000, 0.133975,
-    -0.316778, -0.946198, 0.066042,
-    1.000000, 1.000000,
-    -0.270627, -0.905832, 0.325929,
-    0.000000, 1.000000,
-    -0.339209, -0.882837, 0.324864,
-    0.500000, 0.133975,
-    -0.307659, -0.869725, 0.385906,
-    1.000000, 1.000000,
-    -0.238677, -0.891007, 0.386187,
-    0.000000, 1.000000,
-    -0.270627, -0.905832, 0.325929,
-    0.500000, 0.133975,
-    -0.307659, -0.869725, 0.385906,
-    1.000000, 1.000000,
-    -0.270627, -0.905832, 0.325929,
-    0.000000, 1.000000,
-    -0.301259, -0.916244, 0.264083,
-    0.500000, 0.133975,
-    -0.339209, -0.882837, 0.324864,
-    1.000000, 1.000000,
-    -0.274694, -0.852640, 0.444464,
-    0.000000, 1.000000,
-    -0.307659, -0.869725, 0.385906,
-    0.500000, 0.133975,
-    -0.342848, -0.828447, 0.442867,
-    1.000000, 1.000000,
-    -0.309017, -0.809017, 0.500000,
-    0.000000, 1.000000,
-    -0.274694, -0.852640, 0.444464,
-    0.500000, 0.133975,
-    -0.342848, -0.828447, 0.442867,
-    1.000000, 1.000000,
-    -0.274694, -0.852640, 0.444464,
-    0.000000, 1.000000,
-    -0.238677, -0.891007, 0.386187,
-    0.500000, 0.133975,
-    -0.307659, -0.869725, 0.385906,
-    1.000000, 1.000000,
-    -0.201189, -0.923880, 0.325530,
-    0.000000, 1.000000,
-    -0.232455, -0.936050, 0.264151,
-    0.500000, 0.133975,
-    -0.270627, -0.905832, 0.325929,
-    1.000000, 1.000000,
-    -0.238677, -0.891007, 0.386187,
-    0.000000, 1.000000,
-    -0.201189, -0.923880, 0.325530,
-    0.500000, 0.133975,
-    -0.270627, -0.905832, 0.325929,
-    1.000000, 1.000000,
-    -0.201189, -0.923880, 0.325530,
-    0.000000, 1.000000,
-    -0.162460, -0.951057, 0.262866,
-    0.500000, 0.133975,
-    -0.232455, -0.936050, 0.264151,
-    1.000000, 1.000000,
-    -0.110385, -0.991648, 0.066709,
-    0.000000, 1.000000,
-    -0.179596, -0.981483, 0.066604,
-    0.500000, 0.133975,
-    -0.151549, -0.979426, 0.133256,
-    1.000000, 1.000000,
-    -0.082242, -0.987688, 0.133071,
-    0.000000, 1.000000,
-    -0.110385, -0.991648, 0.066709,
-    0.500000, 0.133975,
-    -0.151549, -0.979426, 0.133256,
-    1.000000, 1.000000,
-    -0.110385, -0.991648, 0.066709,
-    0.000000, 1.000000,
-    -0.137952, -0.990439, 0.000000,
-    0.500000, 0.133975,
-    -0.179596, -0.981483, 0.066604,
-    1.000000, 1.000000,
-    -0.122729, -0.972370, 0.198580,
-    0.000000, 1.000000,
-    -0.151549, -0.979426, 0.133256,
-    0.500000, 0.133975,
-    -0.191780, -0.961188, 0.198337,
-    1.000000, 1.000000,
-    -0.162460, -0.951057, 0.262866,
-    0.000000, 1.000000,
-    -0.122729, -0.972370, 0.198580,
-    0.500000, 0.133975,
-    -0.191780, -0.961188, 0.198337,
-    1.000000, 1.000000,
-    -0.122729, -0.972370, 0.198580,
-    0.000000, 1.000000,
-    -0.082242, -0.987688, 0.133071,
-    0.500000, 0.133975,
-    -0.151549, -0.979426, 0.133256,
-    1.000000, 1.000000,
-    -0.041248, -0.996917, 0.066741,
-    0.000000, 1.000000,
-    -0.069142, -0.997607, 0.000000,
-    0.500000, 0.133975,
-    -0.110385, -0.991648, 0.066709,
-    1.000000, 1.000000,
-    -0.082242, -0.987688, 0.133071,
-    0.000000, 1.000000,
-    -0.041248, -0.996917, 0.066741,
-    0.500000, 0.133975,
-    -0.110385, -0.991648, 0.066709,
-    1.000000, 1.000000,
-    -0.041248, -0.996917, 0.066741,
-    0.000000, 1.000000,
-    0.000000, -1.000000, 0.000000,
-    0.500000, 0.133975,
-    -0.069142, -0.997607, 0.000000,
-    1.000000, 1.000000,
-    0.289929, -0.947822, -0.132570,
-    0.000000, 1.000000,
-    0.330607, -0.922682, -0.198387,
-    0.500000, 0.133975,
-    0.261550, -0.944433, -0.199094,
-    1.000000, 1.000000,
-    0.220117, -0.966393, -0.132792,
-    0.000000, 1.000000,
-    0.289929, -0.947822, -0.132570,
-    0.500000, 0.133975,
-    0.261550, -0.944433, -0.199094,
-    1.000000, 1.000000,
-    0.289929, -0.947822, -0.132570,
-    0.000000, 1.000000,
-    0.358229, -0.924305, -0.131655,
-    0.500000, 0.133975,
-    0.330607, -0.922682, -0.198387,
-    1.000000, 1.000000,
-    0.191780, -0.961188, -0.198337,
-    0.000000, 1.000000,
-    0.261550, -0.944433, -0.199094,
-    0.500000, 0.133975,
-    0.232455, -0.936050, -0.264151,
-    1.000000, 1.000000,
-    0.162460, -0.951057, -0.262866,
-    0.000000, 1.000000,
-    0.191780, -0.961188, -0.198337,
-    0.500000, 0.133975,
-    0.232455, -0.936050, -0.264151,
-    1.000000, 1.000000,
-    0.191780, -0.961188, -0.198337,
-    0.000000, 1.000000,
-    0.220117, -0.966393, -0.132792,
-    0.500000, 0.133975,
-    0.261550, -0.944433, -0.199094,
-    1.000000, 1.000000,
-    0.247326, -0.966643, -0.066567,
-    0.000000, 1.000000,
-    0.316778, -0.946198, -0.066042,
-    0.500000, 0.133975,
-    0.289929, -0.947822, -0.132570,
-    1.000000, 1.000000,
-    0.220117, -0.966393, -0.132792,
-    0.000000, 1.000000,
-    0.247326, -0.966643, -0.066567,
-    0.500000, 0.133975,
-    0.289929, -0.947822, -0.132570,
-    1.000000, 1.000000,
-    0.247326, -0.966643, -0.066567,
-    0.000000, 1.000000,
-    0.273267, -0.961938, 0.000000,
-    0.500000, 0.133975,
-    0.316778, -0.946198, -0.066042,
-    1.000000, 1.000000,
-    0.270627, -0.905832, -0.325929,
-    0.000000, 1.000000,
-    0.339209, -0.882837, -0.324864,
-    0.500000, 0.133975,
-    0.307659, -0.869725, -0.385906,
-    1.000000, 1.000000,
-    0.238677, -0.891007, -0.386187,
-    0.000000, 1.000000,
-    0.270627, -0.905832, -0.325929,
-    0.500000, 0.133975,
-    0.307659, -0.869725, -0.385906,
-    1.000000, 1.000000,
-    0.270627, -0.905832, -0.325929,
-    0.000000, 1.000000,
-    0.301259, -0.916244, -0.264083,
-    0.500000, 0.133975,
-    0.339209, -0.882837, -0.324864,
-    1.000000, 1.000000,
-    0.274694, -0.852640, -0.444464,
-    0.000000, 1.000000,
-    0.307659, -0.869725, -0.385906,
-    0.500000, 0.133975,
-    0.342848, -0.828447, -0.442867,
-    1.000000, 1.000000,
-    0.309017, -0.809017, -0.500000,
-    0.000000, 1.000000,
-    0.274694, -0.852640, -0.444464,
-    0.500000, 0.133975,
-    0.342848, -0.828447, -0.442867,
-    1.000000, 1.000000,
-    0.274694, -0.852640, -0.444464,
-    0.000000, 1.000000,
-    0.238677, -0.891007, -0.386187,
-    0.500000, 0.133975,
-    0.307659, -0.869725, -0.385906,
-    1.000000, 1.000000,
-    0.201189, -0.923880, -0.325530,
-    0.000000, 1.000000,
-    0.232455, -0.936050, -0.264151,
-    0.500000, 0.133975,
-    0.270627, -0.905832, -0.325929,
-    1.000000, 1.000000,
-    0.238677, -0.891007, -0.386187,
-    0.000000, 1.000000,
-    0.201189, -0.923880, -0.325530,
-    0.500000, 0.133975,
-    0.270627, -0.905832, -0.325929,
-    1.000000, 1.000000,
-    0.201189, -0.923880, -0.325530,
-    0.000000, 1.000000,
-    0.162460, -0.951057, -0.262866,
-    0.500000, 0.133975,
-    0.232455, -0.936050, -0.264151,
-    1.000000, 1.000000,
-    0.110385, -0.991648, -0.066709,
-    0.000000, 1.000000,
-    0.179596, -0.981483, -0.066604,
-    0.500000, 0.133975,
-    0.151549, -0.979426, -0.133256,
-    1.000000, 1.000000,
-    0.082242, -0.987688, -0.133071,
-    0.000000, 1.000000,
-    0.110385, -0.991648, -0.066709,
-    0.500000, 0.133975,
-    0.151549, -0.979426, -0.133256,
-    1.000000, 1.000000,
-    0.110385, -0.991648, -0.066709,
-    0.000000, 1.000000,
-    0.137952, -0.990439, 0.000000,
-    0.500000, 0.133975,
-    0.179596, -0.981483, -0.066604,
-    1.000000, 1.000000,
-    0.122729, -0.972370, -0.198580,
-    0.000000, 1.000000,
-    0.151549, -0.979426, -0.133256,
-    0.500000, 0.133975,
-    0.191780, -0.961188, -0.198337,
-    1.000000, 1.000000,
-    0.162460, -0.951057, -0.262866,
-    0.000000, 1.000000,
-    0.122729, -0.972370, -0.198580,
-    0.500000, 0.133975,
-    0.191780, -0.961188, -0.198337,
-    1.000000, 1.000000,
-    0.122729, -0.972370, -0.198580,
-    0.000000, 1.000000,
-    0.082242, -0.987688, -0.133071,
-    0.500000, 0.133975,
-    0.151549, -0.979426, -0.133256,
-    1.000000, 1.000000,
-    0.041248, -0.996917, -0.066741,
-    0.000000, 1.000000,
-    0.069142, -0.997607, 0.000000,
-    0.500000, 0.133975,
-    0.110385, -0.991648, -0.066709,
-    1.000000, 1.000000,
-    0.082242, -0.987688, -0.133071,
-    0.000000, 1.000000,
-    0.041248, -0.996917, -0.066741,
-    0.500000, 0.133975,
-    0.110385, -0.991648, -0.066709,
-    1.000000, 1.000000,
-    0.041248, -0.996917, -0.066741,
-    0.000000, 1.000000,
-    0.000000, -1.000000, 0.000000,
-    0.500000, 0.133975,
-    0.069142, -0.997607, 0.000000,
-    1.000000, 1.000000,
-    -0.966643, 0.066567, -0.247326,
-    0.000000, 1.000000,
-    -0.961938, 0.000000, -0.273267,
-    0.500000, 0.133975,
-    -0.946198, 0.066042, -0.316778,
-    1.000000, 1.000000,
-    -0.991648, 0.066709, -0.110385,
-    0.000000, 1.000000,
-    -0.990439, 0.000000, -0.137952,
-    0.500000, 0.133975,
-    -0.981483, 0.066604, -0.179596,
-    1.000000, 1.000000,
-    -0.996917, 0.066741, -0.041248,
-    0.000000, 1.000000,
-    -0.997607, 0.000000, -0.069142,
-    0.500000, 0.133975,
-    -0.991648, 0.066709, -0.110385,
-    1.000000, 1.000000,
-    -0.996917, 0.066741, -0.041248,
-    0.000000, 1.000000,
-    -1.000000, 0.000000, 0.000000,
-    0.500000, 0.133975,
-    -0.997607, 0.000000, -0.069142,
-    1.000000, 1.000000,
-    -0.947822, -0.132570, 0.289929,
-    0.000000, 1.000000,
-    -0.922682, -0.198387, 0.330607,
-    0.500000, 0.133975,
-    -0.944433, -0.199094, 0.261550,
-    1.000000, 1.000000,
-    -0.966393, -0.132792, 0.220117,
-    0.000000, 1.000000,
-    -0.947822, -0.132570, 0.289929,
-    0.500000, 0.133975,
-    -0.944433, -0.199094, 0.261550,
-    1.000000, 1.000000,
-    -0.947822, -0.132570, 0.289929,
-    0.000000, 1.000000,
-    -0.924305, -0.131655, 0.358229,
-    0.500000, 0.133975,
-    -0.922682, -0.198387, 0.330607,
-    1.000000, 1.000000,
-    -0.961188, -0.198337, 0.191780,
-    0.000000, 1.000000,
-    -0.944433, -0.199094, 0.261550,
-    0.500000, 0.133975,
-    -0.936050, -0.264151, 0.232455,
-    1.000000, 1.000000,
-    -0.951057, -0.262866, 0.162460,
-    0.000000, 1.000000,
-    -0.961188, -0.198337, 0.191780,
-    0.500000, 0.133975,
-    -0.936050, -0.264151, 0.232455,
-    1.000000, 1.000000,
-    -0.961188, -0.198337, 0.191780,
-    0.000000, 1.000000,
-    -0.966393, -0.132792, 0.220117,
-    0.500000, 0.133975,
-    -0.944433, -0.199094, 0.261550,
-    1.000000, 1.000000,
-    -0.966643, -0.066567, 0.247326,
-    0.000000, 1.000000,
-    -0.946198, -0.066042, 0.316778,
-    0.500000, 0.133975,
-    -0.947822, -0.132570, 0.289929,
-    1.000000, 1.000000,
-    -0.966393, -0.132792, 0.220117,
-    0.000000, 1.000000,
-    -0.966643, -0.066567, 0.247326,
-    0.500000, 0.133975,
-    -0.947822, -0.132570, 0.289929,
-    1.000000, 1.000000,
-    -0.966643, -0.066567, 0.247326,
-    0.000000, 1.000000,
-    -0.961938, 0.000000, 0.273267,
-    0.500000, 0.133975,
-    -0.946198, -0.066042, 0.316778,
-    1.000000, 1.000000,
-    -0.905832, -0.325929, 0.270627,
-    0.000000, 1.000000,
-    -0.882837, -0.324864, 0.339209,
-    0.500000, 0.133975,
-    -0.869725, -0.385906, 0.307659,
-    1.000000, 1.000000,
-    -0.891007, -0.386187, 0.238677,
-    0.000000, 1.000000,
-    -0.905832, -0.325929, 0.270627,
-    0.500000, 0.133975,
-    -0.869725, -0.385906, 0.307659,
-    1.000000, 1.000000,
-    -0.905832, -0.325929, 0.270627,
-    0.000000, 1.000000,
-    -0.916244, -0.264083, 0.301259,
-    0.500000, 0.133975,
-    -0.882837, -0.324864, 0.339209,
-    1.000000, 1.000000,
-    -0.852640, -0.444464, 0.274694,
-    0.000000, 1.000000,
-    -0.869725, -0.385906, 0.307659,
-    0.500000, 0.133975,
-    -0.828447, -0.442867, 0.342848,
-    1.000000, 1.000000,
-    -0.809017, -0.500000, 0.309017,
-    0.000000, 1.000000,
-    -0.852640, -0.444464, 0.274694,
-    0.500000, 0.133975,
-    -0.828447, -0.442867, 0.342848,
-    1.000000, 1.000000,
-    -0.852640, -0.444464, 0.274694,
-    0.000000, 1.000000,
-    -0.891007, -0.386187, 0.238677,
-    0.500000, 0.133975,
-    -0.869725, -0.385906, 0.307659,
-    1.000000, 1.000000,
-    -0.923880, -0.325530, 0.201189,
-    0.000000, 1.000000,
-    -0.936050, -0.264151, 0.232455,
-    0.500000, 0.133975,
-    -0.905832, -0.325929, 0.270627,
-    1.000000, 1.000000,
-    -0.891007, -0.386187, 0.238677,
-    0.000000, 1.000000,
-    -0.923880, -0.325530, 0.201189,
-    0.500000, 0.133975,
-    -0.905832, -0.325929, 0.270627,
-    1.000000, 1.000000,
-    -0.923880, -0.325530, 0.201189,
-    0.000000, 1.000000,
-    -0.951057, -0.262866, 0.162460,
-    0.500000, 0.133975,
-    -0.936050, -0.264151, 0.232455,
-    1.000000, 1.000000,
-    -0.991648, -0.066709, 0.110385,
-    0.000000, 1.000000,
-    -0.981483, -0.066604, 0.179596,
-    0.500000, 0.133975,
-    -0.979426, -0.133256, 0.151549,
-    1.000000, 1.000000,
-    -0.987688, -0.133071, 0.082242,
-    0.000000, 1.000000,
-    -0.991648, -0.066709, 0.110385,
-    0.500000, 0.133975,
-    -0.979426, -0.133256, 0.151549,
-    1.000000, 1.000000,
-    -0.991648, -0.066709, 0.110385,
-    0.000000, 1.000000,
-    -0.990439, 0.000000, 0.137952,
-    0.500000, 0.133975,
-    -0.981483, -0.066604, 0.179596,
-    1.000000, 1.000000,
-    -0.972370, -0.198580, 0.122729,
-    0.000000, 1.000000,
-    -0.979426, -0.133256, 0.151549,
-    0.500000, 0.133975,
-    -0.961188, -0.198337, 0.191780,
-    1.000000, 1.000000,
-    -0.951057, -0.262866, 0.162460,
-    0.000000, 1.000000,
-    -0.972370, -0.198580, 0.122729,
-    0.500000, 0.133975,
-    -0.961188, -0.198337, 0.191780,
-    1.000000, 1.000000,
-    -0.972370, -0.198580, 0.122729,
-    0.000000, 1.000000,
-    -0.987688, -0.133071, 0.082242,
-    0.500000, 0.133975,
-    -0.979426, -0.133256, 0.151549,
-    1.000000, 1.000000,
-    -0.996917, -0.066741, 0.041248,
-    0.000000, 1.000000,
-    -0.997607, 0.000000, 0.069142,
-    0.500000, 0.133975,
-    -0.991648, -0.066709, 0.110385,
-    1.000000, 1.000000,
-    -0.987688, -0.133071, 0.082242,
-    0.000000, 1.000000,
-    -0.996917, -0.066741, 0.041248,
-    0.500000, 0.133975,
-    -0.991648, -0.066709, 0.110385,
-    1.000000, 1.000000,
-    -0.996917, -0.066741, 0.041248,
-    0.000000, 1.000000,
-    -1.000000, 0.000000, 0.000000,
-    0.500000, 0.133975,
-    -0.997607, 0.000000, 0.069142,
-    1.000000, 1.000000,
-    0.966643, 0.066567, 0.247326,
-    0.000000, 1.000000,
-    0.961938, 0.000000, 0.273267,
-    0.500000, 0.133975,
-    0.946198, 0.066042, 0.316778,
-    1.000000, 1.000000,
-    0.991648, 0.066709, 0.110385,
-    0.000000, 1.000000,
-    0.990439, 0.000000, 0.137952,
-    0.500000, 0.133975,
-    0.981483, 0.066604, 0.179596,
-    1.000000, 1.000000,
-    0.996917, 0.066741, 0.041248,
-    0.000000, 1.000000,
-    0.997607, 0.000000, 0.069142,
-    0.500000, 0.133975,
-    0.991648, 0.066709, 0.110385,
-    1.000000, 1.000000,
-    0.996917, 0.066741, 0.041248,
-    0.000000, 1.000000,
-    1.000000, 0.000000, 0.000000,
-    0.500000, 0.133975,
-    0.997607, 0.000000, 0.069142,
-    1.000000, 1.000000,
-    0.947822, -0.132570, -0.289929,
-    0.000000, 1.000000,
-    0.922682, -0.198387, -0.330607,
-    0.500000, 0.133975,
-    0.944433, -0.199094, -0.261550,
-    1.000000, 1.000000,
-    0.966393, -0.132792, -0.220117,
-    0.000000, 1.000000,
-    0.947822, -0.132570, -0.289929,
-    0.500000, 0.133975,
-    0.944433, -0.199094, -0.261550,
-    1.000000, 1.000000,
-    0.947822, -0.132570, -0.289929,
-    0.000000, 1.000000,
-    0.924305, -0.131655, -0.358229,
-    0.500000, 0.133975,
-    0.922682, -0.198387, -0.330607,
-    1.000000, 1.000000,
-    0.961188, -0.198337, -0.191780,
-    0.000000, 1.000000,
-    0.944433, -0.199094, -0.261550,
-    0.500000, 0.133975,
-    0.936050, -0.264151, -0.232455,
-    1.000000, 1.000000,
-    0.951057, -0.262866, -0.162460,
-    0.000000, 1.000000,
-    0.961188, -0.198337, -0.191780,
-    0.500000, 0.133975,
-    0.936050, -0.264151, -0.232455,
-    1.000000, 1.000000,
-    0.961188, -0.198337, -0.191780,
-    0.000000, 1.000000,
-    0.966393, -0.132792, -0.220117,
-    0.500000, 0.133975,
-    0.944433, -0.199094, -0.261550,
-    1.000000, 1.000000,
-    0.966643, -0.066567, -0.247326,
-    0.000000, 1.000000,
-    0.946198, -0.066042, -0.316778,
-    0.500000, 0.133975,
-    0.947822, -0.132570, -0.289929,
-    1.000000, 1.000000,
-    0.966393, -0.132792, -0.220117,
-    0.000000, 1.000000,
-    0.966643, -0.066567, -0.247326,
-    0.500000, 0.133975,
-    0.947822, -0.132570, -0.289929,
-    1.000000, 1.000000,
-    0.966643, -0.066567, -0.247326,
-    0.000000, 1.000000,
-    0.961938, 0.000000, -0.273267,
-    0.500000, 0.133975,
-    0.946198, -0.066042, -0.316778,
-    1.000000, 1.000000,
-    0.905832, -0.325929, -0.270627,
-    0.000000, 1.000000,
-    0.882837, -0.324864, -0.339209,
-    0.500000, 0.133975,
-    0.869725, -0.385906, -0.307659,
-    1.000000, 1.000000,
-    0.891007, -0.386187, -0.238677,
-    0.000000, 1.000000,
-    0.905832, -0.325929, -0.270627,
-    0.500000, 0.133975,
-    0.869725, -0.385906, -0.307659,
-    1.000000, 1.000000,
-    0.905832, -0.325929, -0.270627,
-    0.000000, 1.000000,
-    0.916244, -0.264083, -0.301259,
-    0.500000, 0.133975,
-    0.882837, -0.324864, -0.339209,
-    1.000000, 1.000000,
-    0.852640, -0.444464, -0.274694,
-    0.000000, 1.000000,
-    0.869725, -0.385906, -0.307659,
-    0.500000, 0.133975,
-    0.828447, -0.442867, -0.342848,
-    1.000000, 1.000000,
-    0.809017, -0.500000, -0.309017,
-    0.000000, 1.000000,
-    0.852640, -0.444464, -0.274694,
-    0.500000, 0.133975,
-    0.828447, -0.442867, -0.342848,
-    1.000000, 1.000000,
-    0.852640, -0.444464, -0.274694,
-    0.000000, 1.000000,
-    0.891007, -0.386187, -0.238677,
-    0.500000, 0.133975,
-    0.869725, -0.385906, -0.307659,
-    1.000000, 1.000000,
-    0.923880, -0.325530, -0.201189,
-    0.000000, 1.000000,
-    0.936050, -0.264151, -0.232455,
-    0.500000, 0.133975,
-    0.905832, -0.325929, -0.270627,
-    1.000000, 1.000000,
-    0.891007, -0.386187, -0.238677,
-    0.000000, 1.000000,
-    0.923880, -0.325530, -0.201189,
-    0.500000, 0.133975,
-    0.905832, -0.325929, -0.270627,
-    1.000000, 1.000000,
-    0.923880, -0.325530, -0.201189,
-    0.000000, 1.000000,
-    0.951057, -0.262866, -0.162460,
-    0.500000, 0.133975,
-    0.936050, -0.264151, -0.232455,
-    1.000000, 1.000000,
-    0.991648, -0.066709, -0.110385,
-    0.000000, 1.000000,
-    0.981483, -0.066604, -0.179596,
-    0.500000, 0.133975,
-    0.979426, -0.133256, -0.151549,
-    1.000000, 1.000000,
-    0.987688, -0.133071, -0.082242,
-    0.000000, 1.000000,
-    0.991648, -0.066709, -0.110385,
-    0.500000, 0.133975,
-    0.979426, -0.133256, -0.151549,
-    1.000000, 1.000000,
-    0.991648, -0.066709, -0.110385,
-    0.000000, 1.000000,
-    0.990439, 0.000000, -0.137952,
-    0.500000, 0.133975,
-    0.981483, -0.066604, -0.179596,
-    1.000000, 1.000000,
-    0.972370, -0.198580, -0.122729,
-    0.000000, 1.000000,
-    0.979426, -0.133256, -0.151549,
-    0.500000, 0.133975,
-    0.961188, -0.198337, -0.191780,
-    1.000000, 1.000000,
-    0.951057, -0.262866, -0.162460,
-    0.000000, 1.000000,
-    0.972370, -0.198580, -0.122729,
-    0.500000, 0.133975,
-    0.961188, -0.198337, -0.191780,
-    1.000000, 1.000000,
-    0.972370, -0.198580, -0.122729,
-    0.000000, 1.000000,
-    0.987688, -0.133071, -0.082242,
-    0.500000, 0.133975,
-    0.979426, -0.133256, -0.151549,
-    1.000000, 1.000000,
-    0.996917, -0.066741, -0.041248,
-    0.000000, 1.000000,
-    0.997607, 0.000000, -0.069142,
-    0.500000, 0.133975,
-    0.991648, -0.066709, -0.110385,
-    1.000000, 1.000000,
-    0.987688, -0.133071, -0.082242,
-    0.000000, 1.000000,
-    0.996917, -0.066741, -0.041248,
-    0.500000, 0.133975,
-    0.991648, -0.066709, -0.110385,
-    1.000000, 1.000000,
-    0.996917, -0.066741, -0.041248,
-    0.000000, 1.000000,
-    1.000000, 0.000000, 0.000000,
-    0.500000, 0.133975,
-    0.997607, 0.000000, -0.069142,
-    1.000000, 1.000000,
-    -0.610926, -0.749435, -0.255180,
-    0.000000, 1.000000,
-    -0.545109, -0.790112, -0.280319,
-    0.500000, 0.133975,
-    -0.583691, -0.745338, -0.322141,
-    1.000000, 1.000000,
-    -0.647412, -0.702310, -0.296005,
-    0.000000, 1.000000,
-    -0.610926, -0.749435, -0.255180,
-    0.500000, 0.133975,
-    -0.583691, -0.745338, -0.322141,
-    1.000000, 1.000000,
-    -0.610926, -0.749435, -0.255180,
-    0.000000, 1.000000,
-    -0.571252, -0.792649, -0.213023,
-    0.500000, 0.133975,
-    -0.545109, -0.790112, -0.280319,
-    1.000000, 1.000000,
-    -0.619186, -0.697037, -0.361592,
-    0.000000, 1.000000,
-    -0.583691, -0.745338, -0.322141,
-    0.500000, 0.133975,
-    -0.553372, -0.737712, -0.386730,
-    1.000000, 1.000000,
-    -0.587785, -0.688191, -0.425325,
-    0.000000, 1.000000,
-    -0.619186, -0.697037, -0.361592,
-    0.500000, 0.133975,
-    -0.553372, -0.737712, -0.386730,
-    1.000000, 1.000000,
-    -0.619186, -0.697037, -0.361592,
-    0.000000, 1.000000,
-    -0.647412, -0.702310, -0.296005,
-    0.500000, 0.133975,
-    -0.583691, -0.745338, -0.322141,
-    1.000000, 1.000000,
-    -0.672319, -0.703983, -0.228900,
-    0.000000, 1.000000,
-    -0.634579, -0.749786, -0.187432,
-    0.500000, 0.133975,
-    -0.610926, -0.749435, -0.255180,
-    1.000000, 1.000000,
-    -0.647412, -0.702310, -0.296005,
-    0.000000, 1.000000,
-    -0.672319, -0.703983, -0.228900,
-    0.500000, 0.133975,
-    -0.610926, -0.749435, -0.255180,
-    1.000000, 1.000000,
-    -0.672319, -0.703983, -0.228900,
-    0.000000, 1.000000,
-    -0.693780, -0.702046, -0.160622,
-    0.500000, 0.133975,
-    -0.634579, -0.749786, -0.187432,
-    1.000000, 1.000000,
-    -0.486240, -0.772575, -0.408286,
-    0.000000, 1.000000,
-    -0.446977, -0.816233, -0.366027,
-    0.500000, 0.133975,
-    -0.415597, -0.803016, -0.427135,
-    1.000000, 1.000000,
-    -0.453990, -0.757935, -0.468430,
-    0.000000, 1.000000,
-    -0.486240, -0.772575, -0.408286,
-    0.500000, 0.133975,
-    -0.415597, -0.803016, -0.427135,
-    1.000000, 1.000000,
-    -0.486240, -0.772575, -0.408286,
-    0.000000, 1.000000,
-    -0.516122, -0.783452, -0.346153,
-    0.500000, 0.133975,
-    -0.446977, -0.816233, -0.366027,
-    1.000000, 1.000000,
-    -0.382683, -0.785899, -0.485712,
-    0.000000, 1.000000,
-    -0.415597, -0.803016, -0.427135,
-    0.500000, 0.133975,
-    -0.342848, -0.828447, -0.442867,
-    1.000000, 1.000000,
-    -0.309017, -0.809017, -0.500000,
-    0.000000, 1.000000,
-    -0.382683, -0.785899, -0.485712,
-    0.500000, 0.133975,
-    -0.342848, -0.828447, -0.442867,
-    1.000000, 1.000000,
-    -0.382683, -0.785899, -0.485712,
-    0.000000, 1.000000,
-    -0.453990, -0.757935, -0.468430,
-    0.500000, 0.133975,
-    -0.415597, -0.803016, -0.427135,
-    1.000000, 1.000000,
-    -0.522499, -0.725299, -0.448259,
-    0.000000, 1.000000,
-    -0.553372, -0.737712, -0.386730,
-    0.500000, 0.133975,
-    -0.486240, -0.772575, -0.408286,
-    1.000000, 1.000000,
-    -0.453990, -0.757935, -0.468430,
-    0.000000, 1.000000,
-    -0.522499, -0.725299, -0.448259,
-    0.500000, 0.133975,
-    -0.486240, -0.772575, -0.408286,
-    1.000000, 1.000000,
-    -0.522499, -0.725299, -0.448259,
-    0.000000, 1.000000,
-    -0.587785, -0.688191, -0.425325,
-    0.500000, 0.133975,
-    -0.553372, -0.737712, -0.386730,
-    1.000000, 1.000000,
-    -0.734794, -0.605741, -0.305212,
-    0.000000, 1.000000,
-    -0.705236, -0.656620, -0.267381,
-    0.500000, 0.133975,
-    -0.678913, -0.653497, -0.334692,
-    1.000000, 1.000000,
-    -0.707107, -0.601501, -0.371748,
-    0.000000, 1.000000,
-    -0.734794, -0.605741, -0.305212,
-    0.500000, 0.133975,
-    -0.678913, -0.653497, -0.334692,
-    1.000000, 1.000000,
-    -0.734794, -0.605741, -0.305212,
-    0.000000, 1.000000,
-    -0.758652, -0.606825, -0.237086,
-    0.500000, 0.133975,
-    -0.705236, -0.656620, -0.267381,
-    1.000000, 1.000000,
-    -0.649448, -0.646840, -0.399769,
-    0.000000, 1.000000,
-    -0.678913, -0.653497, -0.334692,
-    0.500000, 0.133975,
-    -0.619186, -0.697037, -0.361592,
-    1.000000, 1.000000,
-    -0.587785, -0.688191, -0.425325,
-    0.000000, 1.000000,
-    -0.649448, -0.646840, -0.399769,
-    0.500000, 0.133975,
-    -0.619186, -0.697037, -0.361592,
-    1.000000, 1.000000,
-    -0.649448, -0.646840, -0.399769,
-    0.000000, 1.000000,
-    -0.707107, -0.601501, -0.371748,
-    0.500000, 0.133975,
-    -0.678913, -0.653497, -0.334692,
-    1.000000, 1.000000,
-    -0.760406, -0.552454, -0.341435,
-    0.000000, 1.000000,
-    -0.785715, -0.554740, -0.273707,
-    0.500000, 0.133975,
-    -0.734794, -0.605741, -0.305212,
-    1.000000, 1.000000,
-    -0.707107, -0.601501, -0.371748,
-    0.000000, 1.000000,
-    -0.760406, -0.552454, -0.341435,
-    0.500000, 0.133975,
-    -0.734794, -0.605741, -0.305212,
-    1.000000, 1.000000,
-    -0.760406, -0.552454, -0.341435,
-    0.000000, 1.000000,
-    -0.809017, -0.500000, -0.309017,
-    0.500000, 0.133975,
-    -0.785715, -0.554740, -0.273707,
-    1.000000, 1.000000,
-    0.790112, -0.280319, -0.545109,
-    0.000000, 1.000000,
-    0.749435, -0.255180, -0.610926,
-    0.500000, 0.133975,
-    0.745338, -0.322141, -0.583691,
-    1.000000, 1.000000,
-    0.783452, -0.346153, -0.516122,
-    0.000000, 1.000000,
-    0.790112, -0.280319, -0.545109,
-    0.500000, 0.133975,
-    0.745338, -0.322141, -0.583691,
-    1.000000, 1.000000,
-    0.790112, -0.280319, -0.545109,
-    0.000000, 1.000000,
-    0.792649, -0.213023, -0.571252,
-    0.500000, 0.133975,
-    0.749435, -0.255180, -0.610926,
-    1.000000, 1.000000,
-    0.737712, -0.386730, -0.553372,
-    0.000000, 1.000000,
-    0.745338, -0.322141, -0.583691,
-    0.500000, 0.133975,
-    0.697037, -0.361592, -0.619186,
-    1.000000, 1.000000,
-    0.688191, -0.425325, -0.587785,
-    0.000000, 1.000000,
-    0.737712, -0.386730, -0.553372,
-    0.500000, 0.133975,
-    0.697037, -0.361592, -0.619186,
-    1.000000, 1.000000,
-    0.737712, -0.386730, -0.553372,
-    0.000000, 1.000000,
-    0.783452, -0.346153, -0.516122,
-    0.500000, 0.133975,
-    0.745338, -0.322141, -0.583691,
-    1.000000, 1.000000,
-    0.825175, -0.303801, -0.476226,
-    0.000000, 1.000000,
-    0.830359, -0.237229, -0.504209,
-    0.500000, 0.133975,
-    0.790112, -0.280319, -0.545109,
-    1.000000, 1.000000,
-    0.783452, -0.346153, -0.516122,
-    0.000000, 1.000000,
-    0.825175, -0.303801, -0.476226,
-    0.500000, 0.133975,
-    0.790112, -0.280319, -0.545109,
-    1.000000, 1.000000,
-    0.825175, -0.303801, -0.476226,
-    0.000000, 1.000000,
-    0.862668, -0.259892, -0.433889,
-    0.500000, 0.133975,
-    0.830359, -0.237229, -0.504209,
-    1.000000, 1.000000,
-    0.653497, -0.334692, -0.678913,
-    0.000000, 1.000000,
-    0.656620, -0.267381, -0.705236,
-    0.500000, 0.133975,
-    0.605741, -0.305212, -0.734794,
-    1.000000, 1.000000,
-    0.601501, -0.371748, -0.707107,
-    0.000000, 1.000000,
-    0.653497, -0.334692, -0.678913,
-    0.500000, 0.133975,
-    0.605741, -0.305212, -0.734794,
-    1.000000, 1.000000,
-    0.653497, -0.334692, -0.678913,
-    0.000000, 1.000000,
-    0.702310, -0.296005, -0.647412,
-    0.500000, 0.133975,
-    0.656620, -0.267381, -0.705236,
-    1.000000, 1.000000,
-    0.552454, -0.341435, -0.760406,
-    0.000000, 1.000000,
-    0.605741, -0.305212, -0.734794,
-    0.500000, 0.133975,
-    0.554740, -0.273707, -0.785715,
-    1.000000, 1.000000,
-    0.500000, -0.309017, -0.809017,
-    0.000000, 1.000000,
-    0.552454, -0.341435, -0.760406,
-    0.500000, 0.133975,
-    0.554740, -0.273707, -0.785715,
-    1.000000, 1.000000,
-    0.552454, -0.341435, -0.760406,
-    0.000000, 1.000000,
-    0.601501, -0.371748, -0.707107,
-    0.500000, 0.133975,
-    0.605741, -0.305212, -0.734794,
-    1.000000, 1.000000,
-    0.646840, -0.399769, -0.649448,
-    0.000000, 1.000000,
-    0.697037, -0.361592, -0.619186,
-    0.500000, 0.133975,
-    0.653497, -0.334692, -0.678913,
-    1.000000, 1.000000,
-    0.601501, -0.371748, -0.707107,
-    0.000000, 1.000000,
-    0.646840, -0.399769, -0.649448,
-    0.500000, 0.133975,
-    0.653497, -0.334692, -0.678913,
-    1.000000, 1.000000,
-    0.646840, -0.399769, -0.649448,
-    0.000000, 1.000000,
-    0.688191, -0.425325, -0.587785,
-    0.500000, 0.133975,
-    0.697037, -0.361592, -0.619186,
-    1.000000, 1.000000,
-    0.803016, -0.427135, -0.415597,
-    0.000000, 1.000000,
-    0.816233, -0.366027, -0.446977,
-    0.500000, 0.133975,
-    0.772575, -0.408286, -0.486240,
-    1.000000, 1.000000,
-    0.757935, -0.468430, -0.453990,
-    0.000000, 1.000000,
-    0.803016, -0.427135, -0.415597,
-    0.500000, 0.133975,
-    0.772575, -0.408286, -0.486240,
-    1.000000, 1.000000,
-    0.803016, -0.427135, -0.415597,
-    0.000000, 1.000000,
-    0.843911, -0.383614, -0.375039,
-    0.500000, 0.133975,
-    0.816233, -0.366027, -0.446977,
-    1.000000, 1.000000,
-    0.725299, -0.448259, -0.522499,
-    0.000000, 1.000000,
-    0.772575, -0.408286, -0.486240,
-    0.500000, 0.133975,
-    0.737712, -0.386730, -0.553372,
-    1.000000, 1.000000,
-    0.688191, -0.425325, -0.587785,
-    0.000000, 1.000000,
-    0.725299, -0.448259, -0.522499,
-    0.500000, 0.133975,
-    0.737712, -0.386730, -0.553372,
-    1.000000, 1.000000,
-    0.725299, -0.448259, -0.522499,
-    0.000000, 1.000000,
-    0.757935, -0.468430, -0.453990,
-    0.500000, 0.133975,
-    0.772575, -0.408286, -0.486240,
-    1.000000, 1.000000,
-    0.785899, -0.485712, -0.382683,
-    0.000000, 1.000000,
-    0.828447, -0.442867, -0.342848,
-    0.500000, 0.133975,
-    0.803016, -0.427135, -0.415597,
-    1.000000, 1.000000,
-    0.757935, -0.468430, -0.453990,
-    0.000000, 1.000000,
-    0.785899, -0.485712, -0.382683,
-    0.500000, 0.133975,
-    0.803016, -0.427135, -0.415597,
-    1.000000, 1.000000,
-    0.785899, -0.485712, -0.382683,
-    0.000000, 1.000000,
-    0.809017, -0.500000, -0.309017,
-    0.500000, 0.133975,
-    0.828447, -0.442867, -0.342848,
-    1.000000, 1.000000,
-    -0.790112, -0.280319, 0.545109,
-    0.000000, 1.000000,
-    -0.749435, -0.255180, 0.610926,
-    0.500000, 0.133975,
-    -0.745338, -0.322141, 0.583691,
-    1.000000, 1.000000,
-    -0.783452, -0.346153, 0.516122,
-    0.000000, 1.000000,
-    -0.790112, -0.280319, 0.545109,
-    0.500000, 0.133975,
-    -0.745338, -0.322141, 0.583691,
-    1.000000, 1.000000,
-    -0.790112, -0.280319, 0.545109,
-    0.000000, 1.000000,
-    -0.792649, -0.213023, 0.571252,
-    0.500000, 0.133975,
-    -0.749435, -0.255180, 0.610926,
-    1.000000, 1.000000,
-    -0.737712, -0.386730, 0.553372,
-    0.000000, 1.000000,
-    -0.745338, -0.322141, 0.583691,
-    0.500000, 0.133975,
-    -0.697037, -0.361592, 0.619186,
-    1.000000, 1.000000,
-    -0.688191, -0.425325, 0.587785,
-    0.000000, 1.000000,
-    -0.737712, -0.386730, 0.553372,
-    0.500000, 0.133975,
-    -0.697037, -0.361592, 0.619186,
-    1.000000, 1.000000,
-    -0.737712, -0.386730, 0.553372,
-    0.000000, 1.000000,
-    -0.783452, -0.346153, 0.516122,
-    0.500000, 0.133975,
-    -0.745338, -0.322141, 0.583691,
-    1.000000, 1.000000,
-    -0.825175, -0.303801, 0.476226,
-    0.000000, 1.000000,
-    -0.830359, -0.237229, 0.504209,
-    0.500000, 0.133975,
-    -0.790112, -0.280319, 0.545109,
-    1.000000, 1.000000,
-    -0.783452, -0.346153, 0.516122,
-    0.000000, 1.000000,
-    -0.825175, -0.303801, 0.476226,
-    0.500000, 0.133975,
-    -0.790112, -0.280319, 0.545109,
-    1.000000, 1.000000,
-    -0.825175, -0.303801, 0.476226,
-    0.000000, 1.000000,
-    -0.862668, -0.259892, 0.433889,
-    0.500000, 0.133975,
-    -0.830359, -0.237229, 0.504209,
-    1.000000, 1.000000,
-    -0.653497, -0.334692, 0.678913,
-    0.000000, 1.000000,
-    -0.656620, -0.267381, 0.705236,
-    0.500000, 0.133975,
-    -0.605741, -0.305212, 0.734794,
-    1.000000, 1.000000,
-    -0.601501, -0.371748, 0.707107,
-    0.000000, 1.000000,
-    -0.653497, -0.334692, 0.678913,
-    0.500000, 0.133975,
-    -0.605741, -0.305212, 0.734794,
-    1.000000, 1.000000,
-    -0.653497, -0.334692, 0.678913,
-    0.000000, 1.000000,
-    -0.702310, -0.296005, 0.647412,
-    0.500000, 0.133975,
-    -0.656620, -0.267381, 0.705236,
-    1.000000, 1.000000,
-    -0.552454, -0.341435, 0.760406,
-    0.000000, 1.000000,
-    -0.605741, -0.305212, 0.734794,
-    0.500000, 0.133975,
-    -0.554740, -0.273707, 0.785715,
-    1.000000, 1.000000,
-    -0.500000, -0.309017, 0.809017,
-    0.000000, 1.000000,
-    -0.552454, -0.341435, 0.760406,
-    0.500000, 0.133975,
-    -0.554740, -0.273707, 0.785715,
-    1.000000, 1.000000,
-    -0.552454, -0.341435, 0.760406,
-    0.000000, 1.000000,
-    -0.601501, -0.371748, 0.707107,
-    0.500000, 0.133975,
-    -0.605741, -0.305212, 0.734794,
-    1.000000, 1.000000,
-    -0.646840, -0.399769, 0.649448,
-    0.000000, 1.000000,
-    -0.697037, -0.361592, 0.619186,
-    0.500000, 0.133975,
-    -0.653497, -0.334692, 0.678913,
-    1.000000, 1.000000,
-    -0.601501, -0.371748, 0.707107,
-    0.000000, 1.000000,
-    -0.646840, -0.399769, 0.649448,
-    0.500000, 0.133975,
-    -0.653497, -0.334692, 0.678913,
-    1.000000, 1.000000,
-    -0.646840, -0.399769, 0.649448,
-    0.000000, 1.000000,
-    -0.688191, -0.425325, 0.587785,
-    0.500000, 0.133975,
-    -0.697037, -0.361592, 0.619186,
-    1.000000, 1.000000,
-    -0.803016, -0.427135, 0.415597,
-    0.000000, 1.000000,
-    -0.816233, -0.366027, 0.446977,
-    0.500000, 0.133975,
-    -0.772575, -0.408286, 0.486240,
-    1.000000, 1.000000,
-    -0.757935, -0.468430, 0.453990,
-    0.000000, 1.000000,
-    -0.803016, -0.427135, 0.415597,
-    0.500000, 0.133975,
-    -0.772575, -0.408286, 0.486240,
-    1.000000, 1.000000,
-    -0.803016, -0.427135, 0.415597,
-    0.000000, 1.000000,
-    -0.843911, -0.383614, 0.375039,
-    0.500000, 0.133975,
-    -0.816233, -0.366027, 0.446977,
-    1.000000, 1.000000,
-    -0.725299, -0.448259, 0.522499,
-    0.000000, 1.000000,
-    -0.772575, -0.408286, 0.486240,
-    0.500000, 0.133975,
-    -0.737712, -0.386730, 0.553372,
-    1.000000, 1.000000,
-    -0.688191, -0.425325, 0.587785,
-    0.000000, 1.000000,
-    -0.725299, -0.448259, 0.522499,
-    0.500000, 0.133975,
-    -0.737712, -0.386730, 0.553372,
-    1.000000, 1.000000,
-    -0.725299, -0.448259, 0.522499,
-    0.000000, 1.000000,
-    -0.757935, -0.468430, 0.453990,
-    0.500000, 0.133975,
-    -0.772575, -0.408286, 0.486240,
-    1.000000, 1.000000,
-    -0.785899, -0.485712, 0.382683,
-    0.000000, 1.000000,
-    -0.828447, -0.442867, 0.342848,
-    0.500000, 0.133975,
-    -0.803016, -0.427135, 0.415597,
-    1.000000, 1.000000,
-    -0.757935, -0.468430, 0.453990,
-    0.000000, 1.000000,
-    -0.785899, -0.485712, 0.382683,
-    0.500000, 0.133975,
-    -0.803016, -0.427135, 0.415597,
-    1.000000, 1.000000,
-    -0.785899, -0.485712, 0.382683,
-    0.000000, 1.000000,
-    -0.809017, -0.500000, 0.309017,
-    0.500000, 0.133975,
-    -0.828447, -0.442867, 0.342848,
-    1.000000, 1.000000,
-    0.610926, -0.749435, 0.255180,
-    0.000000, 1.000000,
-    0.545109, -0.790112, 0.280319,
-    0.500000, 0.133975,
-    0.583691, -0.745338, 0.322141,
-    1.000000, 1.000000,
-    0.647412, -0.702310, 0.296005,
-    0.000000, 1.000000,
-    0.610926, -0.749435, 0.255180,
-    0.500000, 0.133975,
-    0.583691, -0.745338, 0.322141,
-    1.000000, 1.000000,
-    0.610926, -0.749435, 0.255180,
-    0.000000, 1.000000,
-    0.571252, -0.792649, 0.213023,
-    0.500000, 0.133975,
-    0.545109, -0.790112, 0.280319,
-    1.000000, 1.000000,
-    0.619186, -0.697037, 0.361592,
-    0.000000, 1.000000,
-    0.583691, -0.745338, 0.322141,
-    0.500000, 0.133975,
-    0.553372, -0.737712, 0.386730,
-    1.000000, 1.000000,
-    0.587785, -0.688191, 0.425325,
-    0.000000, 1.000000,
-    0.619186, -0.697037, 0.361592,
-    0.500000, 0.133975,
-    0.553372, -0.737712, 0.386730,
-    1.000000, 1.000000,
-    0.619186, -0.697037, 0.361592,
-    0.000000, 1.000000,
-    0.647412, -0.702310, 0.296005,
-    0.500000, 0.133975,
-    0.583691, -0.745338, 0.322141,
-    1.000000, 1.000000,
-    0.672319, -0.703983, 0.228900,
-    0.000000, 1.000000,
-    0.634579, -0.749786, 0.187432,
-    0.500000, 0.133975,
-    0.610926, -0.749435, 0.255180,
-    1.000000, 1.000000,
-    0.647412, -0.702310, 0.296005,
-    0.000000, 1.000000,
-    0.672319, -0.703983, 0.228900,
-    0.500000, 0.133975,
-    0.610926, -0.749435, 0.255180,
-    1.000000, 1.000000,
-    0.672319, -0.703983, 0.228900,
-    0.000000, 1.000000,
-    0.693780, -0.702046, 0.160622,
-    0.500000, 0.133975,
-    0.634579, -0.749786, 0.187432,
-    1.000000, 1.000000,
-    0.486240, -0.772575, 0.408286,
-    0.000000, 1.000000,
-    0.446977, -0.816233, 0.366027,
-    0.500000, 0.133975,
-    0.415597, -0.803016, 0.427135,
-    1.000000, 1.000000,
-    0.453990, -0.757935, 0.468430,
-    0.000000, 1.000000,
-    0.486240, -0.772575, 0.408286,
-    0.500000, 0.133975,
-    0.415597, -0.803016, 0.427135,
-    1.000000, 1.000000,
-    0.486240, -0.772575, 0.408286,
-    0.000000, 1.000000,
-    0.516122, -0.783452, 0.346153,
-    0.500000, 0.133975,
-    0.446977, -0.816233, 0.366027,
-    1.000000, 1.000000,
-    0.382683, -0.785899, 0.485712,
-    0.000000, 1.000000,
-    0.415597, -0.803016, 0.427135,
-    0.500000, 0.133975,
-    0.342848, -0.828447, 0.442867,
-    1.000000, 1.000000,
-    0.309017, -0.809017, 0.500000,
-    0.000000, 1.000000,
-    0.382683, -0.785899, 0.485712,
-    0.500000, 0.133975,
-    0.342848, -0.828447, 0.442867,
-    1.000000, 1.000000,
-    0.382683, -0.785899, 0.485712,
-    0.000000, 1.000000,
-    0.453990, -0.757935, 0.468430,
-    0.500000, 0.133975,
-    0.415597, -0.803016, 0.427135,
-    1.000000, 1.000000,
-    0.522499, -0.725299, 0.448259,
-    0.000000, 1.000000,
-    0.553372, -0.737712, 0.386730,
-    0.500000, 0.133975,
-    0.486240, -0.772575, 0.408286,
-    1.000000, 1.000000,
-    0.453990, -0.757935, 0.468430,
-    0.000000, 1.000000,
-    0.522499, -0.725299, 0.448259,
-    0.500000, 0.133975,
-    0.486240, -0.772575, 0.408286,
-    1.000000, 1.000000,
-    0.522499, -0.725299, 0.448259,
-    0.000000, 1.000000,
-    0.587785, -0.688191, 0.425325,
-    0.500000, 0.133975,
-    0.553372, -0.737712, 0.386730,
-    1.000000, 1.000000,
-    0.734794, -0.605741, 0.305212,
-    0.000000, 1.000000,
-    0.705236, -0.656620, 0.267381,
-    0.500000, 0.133975,
-    0.678913, -0.653497, 0.334692,
-    1.000000, 1.000000,
-    0.707107, -0.601501, 0.371748,
-    0.000000, 1.000000,
-    0.734794, -0.605741, 0.305212,
-    0.500000, 0.133975,
-    0.678913, -0.653497, 0.334692,
-    1.000000, 1.000000,
-    0.734794, -0.605741, 0.305212,
-    0.000000, 1.000000,
-    0.758652, -0.606825, 0.237086,
-    0.500000, 0.133975,
-    0.705236, -0.656620, 0.267381,
-    1.000000, 1.000000,
-    0.649448, -0.646840, 0.399769,
-    0.000000, 1.000000,
-    0.678913, -0.653497, 0.334692,
-    0.500000, 0.133975,
-    0.619186, -0.697037, 0.361592,
-    1.000000, 1.000000,
-    0.587785, -0.688191, 0.425325,
-    0.000000, 1.000000,
-    0.649448, -0.646840, 0.399769,
-    0.500000, 0.133975,
-    0.619186, -0.697037, 0.361592,
-    1.000000, 1.000000,
-    0.649448, -0.646840, 0.399769,
-    0.000000, 1.000000,
-    0.707107, -0.601501, 0.371748,
-    0.500000, 0.133975,
-    0.678913, -0.653497, 0.334692,
-    1.000000, 1.000000,
-    0.760406, -0.552454, 0.341435,
-    0.000000, 1.000000,
-    0.785715, -0.554740, 0.273707,
-    0.500000, 0.133975,
-    0.734794, -0.605741, 0.305212,
-    1.000000, 1.000000,
-    0.707107, -0.601501, 0.371748,
-    0.000000, 1.000000,
-    0.760406, -0.552454, 0.341435,
-    0.500000, 0.133975,
-    0.734794, -0.605741, 0.305212,
-    1.000000, 1.000000,
-    0.760406, -0.552454, 0.341435,
-    0.000000, 1.000000,
-    0.809017, -0.500000, 0.309017,
-    0.500000, 0.133975,
-    0.785715, -0.554740, 0.273707,
-    1.000000, 1.000000,
-    -0.400968, 0.000000, 0.916092,
-    0.000000, 1.000000,
-    -0.334140, 0.041302, 0.941618,
-    0.500000, 0.133975,
-    -0.334140, -0.041302, 0.941618,
-    1.000000, 1.000000,
-    -0.399607, -0.082324, 0.912982,
-    0.000000, 1.000000,
-    -0.400968, 0.000000, 0.916092,
-    0.500000, 0.133975,
-    -0.334140, -0.041302, 0.941618,
-    1.000000, 1.000000,
-    -0.400968, 0.000000, 0.916092,
-    0.000000, 1.000000,
-    -0.399607, 0.082324, 0.912982,
-    0.500000, 0.133975,
-    -0.334140, 0.041302, 0.941618,
-    1.000000, 1.000000,
-    -0.332342, -0.122800, 0.935130,
-    0.000000, 1.000000,
-    -0.334140, -0.041302, 0.941618,
-    0.500000, 0.133975,
-    -0.265518, -0.081501, 0.960655,
-    1.000000, 1.000000,
-    -0.262866, -0.162460, 0.951057,
-    0.000000, 1.000000,
-    -0.332342, -0.122800, 0.935130,
-    0.500000, 0.133975,
-    -0.265518, -0.081501, 0.960655,
-    1.000000, 1.000000,
-    -0.332342, -0.122800, 0.935130,
-    0.000000, 1.000000,
-    -0.399607, -0.082324, 0.912982,
-    0.500000, 0.133975,
-    -0.334140, -0.041302, 0.941618,
-    1.000000, 1.000000,
-    -0.464213, -0.041299, 0.884760,
-    0.000000, 1.000000,
-    -0.464213, 0.041299, 0.884760,
-    0.500000, 0.133975,
-    -0.400968, 0.000000, 0.916092,
-    1.000000, 1.000000,
-    -0.399607, -0.082324, 0.912982,
-    0.000000, 1.000000,
-    -0.464213, -0.041299, 0.884760,
-    0.500000, 0.133975,
-    -0.400968, 0.000000, 0.916092,
-    1.000000, 1.000000,
-    -0.464213, -0.041299, 0.884760,
-    0.000000, 1.000000,
-    -0.525731, 0.000000, 0.850651,
-    0.500000, 0.133975,
-    -0.464213, 0.041299, 0.884760,
-    1.000000, 1.000000,
-    -0.200368, -0.041251, 0.978852,
-    0.000000, 1.000000,
-    -0.200368, 0.041251, 0.978852,
-    0.500000, 0.133975,
-    -0.133523, 0.000000, 0.991046,
-    1.000000, 1.000000,
-    -0.133071, -0.082242, 0.987688,
-    0.000000, 1.000000,
-    -0.200368, -0.041251, 0.978852,
-    0.500000, 0.133975,
-    -0.133523, 0.000000, 0.991046,
-    1.000000, 1.000000,
-    -0.200368, -0.041251, 0.978852,
-    0.000000, 1.000000,
-    -0.266405, 0.000000, 0.963861,
-    0.500000, 0.133975,
-    -0.200368, 0.041251, 0.978852,
-    1.000000, 1.000000,
-    -0.066741, -0.041248, 0.996917,
-    0.000000, 1.000000,
-    -0.133523, 0.000000, 0.991046,
-    0.500000, 0.133975,
-    -0.066741, 0.041248, 0.996917,
-    1.000000, 1.000000,
-    0.000000, 0.000000, 1.000000,
-    0.000000, 1.000000,
-    -0.066741, -0.041248, 0.996917,
-    0.500000, 0.133975,
-    -0.066741, 0.041248, 0.996917,
-    1.000000, 1.000000,
-    -0.066741, -0.041248, 0.996917,
-    0.000000, 1.000000,
-    -0.133071, -0.082242, 0.987688,
-    0.500000, 0.133975,
-    -0.133523, 0.000000, 0.991046,
-    1.000000, 1.000000,
-    -0.198580, -0.122729, 0.972370,
-    0.000000, 1.000000,
-    -0.265518, -0.081501, 0.960655,
-    0.500000, 0.133975,
-    -0.200368, -0.041251, 0.978852,
-    1.000000, 1.000000,
-    -0.133071, -0.082242, 0.987688,
-    0.000000, 1.000000,
-    -0.198580, -0.122729, 0.972370,
-    0.500000, 0.133975,
-    -0.200368, -0.041251, 0.978852,
-    1.000000, 1.000000,
-    -0.198580, -0.122729, 0.972370,
-    0.000000, 1.000000,
-    -0.262866, -0.162460, 0.951057,
-    0.500000, 0.133975,
-    -0.265518, -0.081501, 0.960655,
-    1.000000, 1.000000,
-    -0.454262, -0.198227, 0.868534,
-    0.000000, 1.000000,
-    -0.460882, -0.119755, 0.879345,
-    0.500000, 0.133975,
-    -0.394136, -0.161006, 0.904839,
-    1.000000, 1.000000,
-    -0.386187, -0.238677, 0.891007,
-    0.000000, 1.000000,
-    -0.454262, -0.198227, 0.868534,
-    0.500000, 0.133975,
-    -0.394136, -0.161006, 0.904839,
-    1.000000, 1.000000,
-    -0.454262, -0.198227, 0.868534,
-    0.000000, 1.000000,
-    -0.519258, -0.156434, 0.840178,
-    0.500000, 0.133975,
-    -0.460882, -0.119755, 0.879345,
-    1.000000, 1.000000,
-    -0.325530, -0.201189, 0.923880,
-    0.000000, 1.000000,
-    -0.394136, -0.161006, 0.904839,
-    0.500000, 0.133975,
-    -0.332342, -0.122800, 0.935130,
-    1.000000, 1.000000,
-    -0.262866, -0.162460, 0.951057,
-    0.000000, 1.000000,
-    -0.325530, -0.201189, 0.923880,
-    0.500000, 0.133975,
-    -0.332342, -0.122800, 0.935130,
-    1.000000, 1.000000,
-    -0.325530, -0.201189, 0.923880,
-    0.000000, 1.000000,
-    -0.386187, -0.238677, 0.891007,
-    0.500000, 0.133975,
-    -0.394136, -0.161006, 0.904839,
-    1.000000, 1.000000,
-    -0.444464, -0.274694, 0.852640,
-    0.000000, 1.000000,
-    -0.511205, -0.233445, 0.827147,
-    0.500000, 0.133975,
-    -0.454262, -0.198227, 0.868534,
-    1.000000, 1.000000,
-    -0.386187, -0.238677, 0.891007,
-    0.000000, 1.000000,
-    -0.444464, -0.274694, 0.852640,
-    0.500000, 0.133975,
-    -0.454262, -0.198227, 0.868534,
-    1.000000, 1.000000,
-    -0.444464, -0.274694, 0.852640,
-    0.000000, 1.000000,
-    -0.500000, -0.309017, 0.809017,
-    0.500000, 0.133975,
-    -0.511205, -0.233445, 0.827147,
-    1.000000, 1.000000,
-    0.000000, 0.069142, 0.997607,
-    0.000000, 1.000000,
-    -0.066741, 0.041248, 0.996917,
-    0.500000, 0.133975,
-    -0.066709, 0.110385, 0.991648,
-    1.000000, 1.000000,
-    0.000000, 0.069142, 0.997607,
-    0.000000, 1.000000,
-    0.000000, 0.000000, 1.000000,
-    0.500000, 0.133975,
-    -0.066741, 0.041248, 0.996917,
-    1.000000, 1.000000,
-    -0.198387, -0.330607, 0.922682,
-    0.000000, 1.000000,
-    -0.199094, -0.261550, 0.944433,
-    0.500000, 0.133975,
-    -0.132570, -0.289929, 0.947822,
-    1.000000, 1.000000,
-    -0.131655, -0.358229, 0.924305,
-    0.000000, 1.000000,
-    -0.198387, -0.330607, 0.922682,
-    0.500000, 0.133975,
-    -0.132570, -0.289929, 0.947822,
-    1.000000, 1.000000,
-    -0.198387, -0.330607, 0.922682,
-    0.000000, 1.000000,
-    -0.264083, -0.301259, 0.916244,
-    0.500000, 0.133975,
-    -0.199094, -0.261550, 0.944433,
-    1.000000, 1.000000,
-    -0.066042, -0.316778, 0.946198,
-    0.000000, 1.000000,
-    -0.132570, -0.289929, 0.947822,
-    0.500000, 0.133975,
-    -0.066567, -0.247326, 0.966643,
-    1.000000, 1.000000,
-    0.000000, -0.273267, 0.961938,
-    0.000000, 1.000000,
-    -0.066042, -0.316778, 0.946198,
-    0.500000, 0.133975,
-    -0.066567, -0.247326, 0.966643,
-    1.000000, 1.000000,
-    -0.066042, -0.316778, 0.946198,
-    0.000000, 1.000000,
-    -0.131655, -0.358229, 0.924305,
-    0.500000, 0.133975,
-    -0.132570, -0.289929, 0.947822,
-    1.000000, 1.000000,
-    -0.196412, -0.397351, 0.896401,
-    0.000000, 1.000000,
-    -0.262661, -0.368518, 0.891742,
-    0.500000, 0.133975,
-    -0.198387, -0.330607, 0.922682,
-    1.000000, 1.000000,
-    -0.131655, -0.358229, 0.924305,
-    0.000000, 1.000000,
-    -0.196412, -0.397351, 0.896401,
-    0.500000, 0.133975,
-    -0.198387, -0.330607, 0.922682,
-    1.000000, 1.000000,
-    -0.196412, -0.397351, 0.896401,
-    0.000000, 1.000000,
-    -0.259892, -0.433889, 0.862668,
-    0.500000, 0.133975,
-    -0.262661, -0.368518, 0.891742,
-    1.000000, 1.000000,
-    -0.066604, -0.179596, 0.981483,
-    0.000000, 1.000000,
-    -0.133256, -0.151549, 0.979426,
-    0.500000, 0.133975,
-    -0.066709, -0.110385, 0.991648,
-    1.000000, 1.000000,
-    0.000000, -0.137952, 0.990439,
-    0.000000, 1.000000,
-    -0.066604, -0.179596, 0.981483,
-    0.500000, 0.133975,
-    -0.066709, -0.110385, 0.991648,
-    1.000000, 1.000000,
-    -0.066604, -0.179596, 0.981483,
-    0.000000, 1.000000,
-    -0.132792, -0.220117, 0.966393,
-    0.500000, 0.133975,
-    -0.133256, -0.151549, 0.979426,
-    1.000000, 1.000000,
-    0.000000, -0.069142, 0.997607,
-    0.000000, 1.000000,
-    -0.066709, -0.110385, 0.991648,
-    0.500000, 0.133975,
-    -0.066741, -0.041248, 0.996917,
-    1.000000, 1.000000,
-    0.000000, 0.000000, 1.000000,
-    0.000000, 1.000000,
-    0.000000, -0.069142, 0.997607,
-    0.500000, 0.133975,
-    -0.066741, -0.041248, 0.996917,
-    1.000000, 1.000000,
-    0.000000, -0.069142, 0.997607,
-    0.000000, 1.000000,
-    0.000000, -0.137952, 0.990439,
-    0.500000, 0.133975,
-    -0.066709, -0.110385, 0.991648,
-    1.000000, 1.000000,
-    0.000000, -0.206103, 0.978530,
-    0.000000, 1.000000,
-    -0.066567, -0.247326, 0.966643,
-    0.500000, 0.133975,
-    -0.066604, -0.179596, 0.981483,
-    1.000000, 1.000000,
-    0.000000, -0.137952, 0.990439,
-    0.000000, 1.000000,
-    0.000000, -0.206103, 0.978530,
-    0.500000, 0.133975,
-    -0.066604, -0.179596, 0.981483,
-    1.000000, 1.000000,
-    0.000000, -0.206103, 0.978530,
-    0.000000, 1.000000,
-    0.000000, -0.273267, 0.961938,
-    0.500000, 0.133975,
-    -0.066567, -0.247326, 0.966643,
-    1.000000, 1.000000,
-    -0.065817, -0.445365, 0.892927,
-    0.000000, 1.000000,
-    -0.131749, -0.422364, 0.896801,
-    0.500000, 0.133975,
-    -0.065988, -0.381722, 0.921919,
-    1.000000, 1.000000,
-    0.000000, -0.403355, 0.915043,
-    0.000000, 1.000000,
-    -0.065817, -0.445365, 0.892927,
-    0.500000, 0.133975,
-    -0.065988, -0.381722, 0.921919,
-    1.000000, 1.000000,
-    -0.065817, -0.445365, 0.892927,
-    0.000000, 1.000000,
-    -0.131200, -0.484442, 0.864929,
-    0.500000, 0.133975,
-    -0.131749, -0.422364, 0.896801,
-    1.000000, 1.000000,
-    0.000000, -0.339123, 0.940742,
-    0.000000, 1.000000,
-    -0.065988, -0.381722, 0.921919,
-    0.500000, 0.133975,
-    -0.066042, -0.316778, 0.946198,
-    1.000000, 1.000000,
-    0.000000, -0.273267, 0.961938,
-    0.000000, 1.000000,
-    0.000000, -0.339123, 0.940742,
-    0.500000, 0.133975,
-    -0.066042, -0.316778, 0.946198,
-    1.000000, 1.000000,
-    0.000000, -0.339123, 0.940742,
-    0.000000, 1.000000,
-    0.000000, -0.403355, 0.915043,
-    0.500000, 0.133975,
-    -0.065988, -0.381722, 0.921919,
-    1.000000, 1.000000,
-    0.000000, -0.465658, 0.884965,
-    0.000000, 1.000000,
-    -0.065758, -0.506298, 0.859848,
-    0.500000, 0.133975,
-    -0.065817, -0.445365, 0.892927,
-    1.000000, 1.000000,
-    0.000000, -0.403355, 0.915043,
-    0.000000, 1.000000,
-    0.000000, -0.465658, 0.884965,
-    0.500000, 0.133975,
-    -0.065817, -0.445365, 0.892927,
-    1.000000, 1.000000,
-    0.000000, -0.465658, 0.884965,
-    0.000000, 1.000000,
-    0.000000, -0.525731, 0.850651,
-    0.500000, 0.133975,
-    -0.065758, -0.506298, 0.859848,
-    1.000000, 1.000000,
-    0.334140, -0.041302, 0.941618,
-    0.000000, 1.000000,
-    0.334140, 0.041302, 0.941618,
-    0.500000, 0.133975,
-    0.400968, 0.000000, 0.916092,
-    1.000000, 1.000000,
-    0.399607, -0.082324, 0.912982,
-    0.000000, 1.000000,
-    0.334140, -0.041302, 0.941618,
-    0.500000, 0.133975,
-    0.400968, 0.000000, 0.916092,
-    1.000000, 1.000000,
-    0.334140, -0.041302, 0.941618,
-    0.000000, 1.000000,
-    0.266405, 0.000000, 0.963861,
-    0.500000, 0.133975,
-    0.334140, 0.041302, 0.941618,
-    1.000000, 1.000000,
-    0.464213, -0.041299, 0.884760,
-    0.000000, 1.000000,
-    0.400968, 0.000000, 0.916092,
-    0.500000, 0.133975,
-    0.464213, 0.041299, 0.884760,
-    1.000000, 1.000000,
-    0.525731, 0.000000, 0.850651,
-    0.000000, 1.000000,
-    0.464213, -0.041299, 0.884760,
-    0.500000, 0.133975,
-    0.464213, 0.041299, 0.884760,
-    1.000000, 1.000000,
-    0.464213, -0.041299, 0.884760,
-    0.000000, 1.000000,
-    0.399607, -0.082324, 0.912982,
-    0.500000, 0.133975,
-    0.400968, 0.000000, 0.916092,
-    1.000000, 1.000000,
-    0.332342, -0.122800, 0.935130,
-    0.000000, 1.000000,
-    0.265518, -0.081501, 0.960655,
-    0.500000, 0.133975,
-    0.334140, -0.041302, 0.941618,
-    1.000000, 1.000000,
-    0.399607, -0.082324, 0.912982,
-    0.000000, 1.000000,
-    0.332342, -0.122800, 0.935130,
-    0.500000, 0.133975,
-    0.334140, -0.041302, 0.941618,
-    1.000000, 1.000000,
-    0.332342, -0.122800, 0.935130,
-    0.000000, 1.000000,
-    0.262866, -0.162460, 0.951057,
-    0.500000, 0.133975,
-    0.265518, -0.081501, 0.960655,
-    1.000000, 1.000000,
-    0.524110, 0.078459, 0.848029,
-    0.000000, 1.000000,
-    0.464213, 0.041299, 0.884760,
-    0.500000, 0.133975,
-    0.460882, 0.119755, 0.879345,
-    1.000000, 1.000000,
-    0.524110, 0.078459, 0.848029,
-    0.000000, 1.000000,
-    0.525731, 0.000000, 0.850651,
-    0.500000, 0.133975,
-    0.464213, 0.041299, 0.884760,
-    1.000000, 1.000000,
-    0.454262, -0.198227, 0.868534,
-    0.000000, 1.000000,
-    0.394136, -0.161006, 0.904839,
-    0.500000, 0.133975,
-    0.460882, -0.119755, 0.879345,
-    1.000000, 1.000000,
-    0.519258, -0.156434, 0.840178,
-    0.000000, 1.000000,
-    0.454262, -0.198227, 0.868534,
-    0.500000, 0.133975,
-    0.460882, -0.119755, 0.879345,
-    1.000000, 1.000000,
-    0.454262, -0.198227, 0.868534,
-    0.000000, 1.000000,
-    0.386187, -0.238677, 0.891007,
-    0.500000, 0.133975,
-    0.394136, -0.161006, 0.904839,
-    1.000000, 1.000000,
-    0.524110, -0.078459, 0.848029,
-    0.000000, 1.000000,
-    0.460882, -0.119755, 0.879345,
-    0.500000, 0.133975,
-    0.464213, -0.041299, 0.884760,
-    1.000000, 1.000000,
-    0.525731, 0.000000, 0.850651,
-    0.000000, 1.000000,
-    0.524110, -0.078459, 0.848029,
-    0.500000, 0.133975,
-    0.464213, -0.041299, 0.884760,
-    1.000000, 1.000000,
-    0.524110, -0.078459, 0.848029,
-    0.000000, 1.000000,
-    0.519258, -0.156434, 0.840178,
-    0.500000, 0.133975,
-    0.460882, -0.119755, 0.879345,
-    1.000000, 1.000000,
-    0.511205, -0.233445, 0.827147,
-    0.000000, 1.000000,
-    0.444464, -0.274694, 0.852640,
-    0.500000, 0.133975,
-    0.454262, -0.198227, 0.868534,
-    1.000000, 1.000000,
-    0.519258, -0.156434, 0.840178,
-    0.000000, 1.000000,
-    0.511205, -0.233445, 0.827147,
-    0.500000, 0.133975,
-    0.454262, -0.198227, 0.868534,
-    1.000000, 1.000000,
-    0.511205, -0.233445, 0.827147,
-    0.000000, 1.000000,
-    0.500000, -0.309017, 0.809017,
-    0.500000, 0.133975,
-    0.444464, -0.274694, 0.852640,
-    1.000000, 1.000000,
-    0.667502, -0.040677, 0.743496,
-    0.000000, 1.000000,
-    0.622292, 0.000000, 0.782786,
-    0.500000, 0.133975,
-    0.667502, 0.040677, 0.743496,
-    1.000000, 1.000000,
-    0.711282, 0.000000, 0.702907,
-    0.000000, 1.000000,
-    0.667502, -0.040677, 0.743496,
-    0.500000, 0.133975,
-    0.667502, 0.040677, 0.743496,
-    1.000000, 1.000000,
-    0.667502, -0.040677, 0.743496,
-    0.000000, 1.000000,
-    0.620240, -0.081142, 0.780204,
-    0.500000, 0.133975,
-    0.622292, 0.000000, 0.782786,
-    1.000000, 1.000000,
-    0.708969, 0.080573, 0.700622,
-    0.000000, 1.000000,
-    0.667502, 0.040677, 0.743496,
-    0.500000, 0.133975,
-    0.662842, 0.121193, 0.738886,
-    1.000000, 1.000000,
-    0.708969, 0.080573, 0.700622,
-    0.000000, 1.000000,
-    0.711282, 0.000000, 0.702907,
-    0.500000, 0.133975,
-    0.667502, 0.040677, 0.743496,
-    1.000000, 1.000000,
-    0.708969, -0.080573, 0.700622,
-    0.000000, 1.000000,
-    0.662842, -0.121193, 0.738886,
-    0.500000, 0.133975,
-    0.667502, -0.040677, 0.743496,
-    1.000000, 1.000000,
-    0.711282, 0.000000, 0.702907,
-    0.000000, 1.000000,
-    0.708969, -0.080573, 0.700622,
-    0.500000, 0.133975,
-    0.667502, -0.040677, 0.743496,
-    1.000000, 1.000000,
-    0.708969, -0.080573, 0.700622,
-    0.000000, 1.000000,
-    0.702046, -0.160622, 0.693780,
-    0.500000, 0.133975,
-    0.662842, -0.121193, 0.738886,
-    1.000000, 1.000000,
-    0.786433, 0.000000, 0.617676,
-    0.000000, 1.000000,
-    0.749387, -0.040642, 0.660884,
-    0.500000, 0.133975,
-    0.749387, 0.040642, 0.660884,
-    1.000000, 1.000000,
-    0.783843, 0.081086, 0.615642,
-    0.000000, 1.000000,
-    0.786433, 0.000000, 0.617676,
-    0.500000, 0.133975,
-    0.749387, 0.040642, 0.660884,
-    1.000000, 1.000000,
-    0.786433, 0.000000, 0.617676,
-    0.000000, 1.000000,
-    0.783843, -0.081086, 0.615642,
-    0.500000, 0.133975,
-    0.749387, -0.040642, 0.660884,
-    1.000000, 1.000000,
-    0.744727, 0.121144, 0.656282,
-    0.000000, 1.000000,
-    0.749387, 0.040642, 0.660884,
-    0.500000, 0.133975,
-    0.708969, 0.080573, 0.700622,
-    1.000000, 1.000000,
-    0.744727, 0.121144, 0.656282,
-    0.000000, 1.000000,
-    0.783843, 0.081086, 0.615642,
-    0.500000, 0.133975,
-    0.749387, 0.040642, 0.660884,
-    1.000000, 1.000000,
-    0.819207, 0.040640, 0.572056,
-    0.000000, 1.000000,
-    0.819207, -0.040640, 0.572056,
-    0.500000, 0.133975,
-    0.786433, 0.000000, 0.617676,
-    1.000000, 1.000000,
-    0.783843, 0.081086, 0.615642,
-    0.000000, 1.000000,
-    0.819207, 0.040640, 0.572056,
-    0.500000, 0.133975,
-    0.786433, 0.000000, 0.617676,
-    1.000000, 1.000000,
-    0.819207, 0.040640, 0.572056,
-    0.000000, 1.000000,
-    0.850651, 0.000000, 0.525731,
-    0.500000, 0.133975,
-    0.819207, -0.040640, 0.572056,
-    1.000000, 1.000000,
-    0.400968, 0.000000, -0.916092,
-    0.000000, 1.000000,
-    0.334140, 0.041302, -0.941618,
-    0.500000, 0.133975,
-    0.334140, -0.041302, -0.941618,
-    1.000000, 1.000000,
-    0.399607, -0.082324, -0.912982,
-    0.000000, 1.000000,
-    0.400968, 0.000000, -0.916092,
-    0.500000, 0.133975,
-    0.334140, -0.041302, -0.941618,
-    1.000000, 1.000000,
-    0.400968, 0.000000, -0.916092,
-    0.000000, 1.000000,
-    0.399607, 0.082324, -0.912982,
-    0.500000, 0.133975,
-    0.334140, 0.041302, -0.941618,
-    1.000000, 1.000000,
-    0.332342, -0.122800, -0.935130,
-    0.000000, 1.000000,
-    0.334140, -0.041302, -0.941618,
-    0.500000, 0.133975,
-    0.265518, -0.081501, -0.960655,
-    1.000000, 1.000000,
-    0.262866, -0.162460, -0.951057,
-    0.000000, 1.000000,
-    0.332342, -0.122800, -0.935130,
-    0.500000, 0.133975,
-    0.265518, -0.081501, -0.960655,
-    1.000000, 1.000000,
-    0.332342, -0.122800, -0.935130,
-    0.000000, 1.000000,
-    0.399607, -0.082324, -0.912982,
-    0.500000, 0.133975,
-    0.334140, -0.041302, -0.941618,
-    1.000000, 1.000000,
-    0.464213, -0.041299, -0.884760,
-    0.000000, 1.000000,
-    0.464213, 0.041299, -0.884760,
-    0.500000, 0.133975,
-    0.400968, 0.000000, -0.916092,
-    1.000000, 1.000000,
-    0.399607, -0.082324, -0.912982,
-    0.000000, 1.000000,
-    0.464213, -0.041299, -0.884760,
-    0.500000, 0.133975,
-    0.400968, 0.000000, -0.916092,
-    1.000000, 1.000000,
-    0.464213, -0.041299, -0.884760,
-    0.000000, 1.000000,
-    0.525731, 0.000000, -0.850651,
-    0.500000, 0.133975,
-    0.464213, 0.041299, -0.884760,
-    1.000000, 1.000000,
-    0.200368, -0.041251, -0.978852,
-    0.000000, 1.000000,
-    0.200368, 0.041251, -0.978852,
-    0.500000, 0.133975,
-    0.133523, 0.000000, -0.991046,
-    1.000000, 1.000000,
-    0.133071, -0.082242, -0.987688,
-    0.000000, 1.000000,
-    0.200368, -0.041251, -0.978852,
-    0.500000, 0.133975,
-    0.133523, 0.000000, -0.991046,
-    1.000000, 1.000000,
-    0.200368, -0.041251, -0.978852,
-    0.000000, 1.000000,
-    0.266405, 0.000000, -0.963861,
-    0.500000, 0.133975,
-    0.200368, 0.041251, -0.978852,
-    1.000000, 1.000000,
-    0.066741, -0.041248, -0.996917,
-    0.000000, 1.000000,
-    0.133523, 0.000000, -0.991046,
-    0.500000, 0.133975,
-    0.066741, 0.041248, -0.996917,
-    1.000000, 1.000000,
-    0.000000, 0.000000, -1.000000,
-    0.000000, 1.000000,
-    0.066741, -0.041248, -0.996917,
-    0.500000, 0.133975,
-    0.066741, 0.041248, -0.996917,
-    1.000000, 1.000000,
-    0.066741, -0.041248, -0.996917,
-    0.000000, 1.000000,
-    0.133071, -0.082242, -0.987688,
-    0.500000, 0.133975,
-    0.133523, 0.000000, -0.991046,
-    1.000000, 1.000000,
-    0.198580, -0.122729, -0.972370,
-    0.000000, 1.000000,
-    0.265518, -0.081501, -0.960655,
-    0.500000, 0.133975,
-    0.200368, -0.041251, -0.978852,
-    1.000000, 1.000000,
-    0.133071, -0.082242, -0.987688,
-    0.000000, 1.000000,
-    0.198580, -0.122729, -0.972370,
-    0.500000, 0.133975,
-    0.200368, -0.041251, -0.978852,
-    1.000000, 1.000000,
-    0.198580, -0.122729, -0.972370,
-    0.000000, 1.000000,
-    0.262866, -0.162460, -0.951057,
-    0.500000, 0.133975,
-    0.265518, -0.081501, -0.960655,
-    1.000000, 1.000000,
-    0.454262, -0.198227, -0.868534,
-    0.000000, 1.000000,
-    0.460882, -0.119755, -0.879345,
-    0.500000, 0.133975,
-    0.394136, -0.161006, -0.904839,
-    1.000000, 1.000000,
-    0.386187, -0.238677, -0.891007,
-    0.000000, 1.000000,
-    0.454262, -0.198227, -0.868534,
-    0.500000, 0.133975,
-    0.394136, -0.161006, -0.904839,
-    1.000000, 1.000000,
-    0.454262, -0.198227, -0.868534,
-    0.000000, 1.000000,
-    0.519258, -0.156434, -0.840178,
-    0.500000, 0.133975,
-    0.460882, -0.119755, -0.879345,
-    1.000000, 1.000000,
-    0.325530, -0.201189, -0.923880,
-    0.000000, 1.000000,
-    0.394136, -0.161006, -0.904839,
-    0.500000, 0.133975,
-    0.332342, -0.122800, -0.935130,
-    1.000000, 1.000000,
-    0.262866, -0.162460, -0.951057,
-    0.000000, 1.000000,
-    0.325530, -0.201189, -0.923880,
-    0.500000, 0.133975,
-    0.332342, -0.122800, -0.935130,
-    1.000000, 1.000000,
-    0.325530, -0.201189, -0.923880,
-    0.000000, 1.000000,
-    0.386187, -0.238677, -0.891007,
-    0.500000, 0.133975,
-    0.394136, -0.161006, -0.904839,
-    1.000000, 1.000000,
-    0.444464, -0.274694, -0.852640,
-    0.000000, 1.000000,
-    0.511205, -0.233445, -0.827147,
-    0.500000, 0.133975,
-    0.454262, -0.198227, -0.868534,
-    1.000000, 1.000000,
-    0.386187, -0.238677, -0.891007,
-    0.000000, 1.000000,
-    0.444464, -0.274694, -0.852640,
-    0.500000, 0.133975,
-    0.454262, -0.198227, -0.868534,
-    1.000000, 1.000000,
-    0.444464, -0.274694, -0.852640,
-    0.000000, 1.000000,
-    0.500000, -0.309017, -0.809017,
-    0.500000, 0.133975,
-    0.511205, -0.233445, -0.827147,
-    1.000000, 1.000000,
-    0.000000, 0.069142, -0.997607,
-    0.000000, 1.000000,
-    0.066741, 0.041248, -0.996917,
-    0.500000, 0.133975,
-    0.066709, 0.110385, -0.991648,
-    1.000000, 1.000000,
-    0.000000, 0.069142, -0.997607,
-    0.000000, 1.000000,
-    0.000000, 0.000000, -1.000000,
-    0.500000, 0.133975,
-    0.066741, 0.041248, -0.996917,
-    1.000000, 1.000000,
-    0.198387, -0.330607, -0.922682,
-    0.000000, 1.000000,
-    0.199094, -0.261550, -0.944433,
-    0.500000, 0.133975,
-    0.132570, -0.289929, -0.947822,
-    1.000000, 1.000000,
-    0.131655, -0.358229, -0.924305,
-    0.000000, 1.000000,
-    0.198387, -0.330607, -0.922682,
-    0.500000, 0.133975,
-    0.132570, -0.289929, -0.947822,
-    1.000000, 1.000000,
-    0.198387, -0.330607, -0.922682,
-    0.000000, 1.000000,
-    0.264083, -0.301259, -0.916244,
-    0.500000, 0.133975,
-    0.199094, -0.261550, -0.944433,
-    1.000000, 1.000000,
-    0.066042, -0.316778, -0.946198,
-    0.000000, 1.000000,
-    0.132570, -0.289929, -0.947822,
-    0.500000, 0.133975,
-    0.066567, -0.247326, -0.966643,
-    1.000000, 1.000000,
-    0.000000, -0.273267, -0.961938,
-    0.000000, 1.000000,
-    0.066042, -0.316778, -0.946198,
-    0.500000, 0.133975,
-    0.066567, -0.247326, -0.966643,
-    1.000000, 1.000000,
-    0.066042, -0.316778, -0.946198,
-    0.000000, 1.000000,
-    0.131655, -0.358229, -0.924305,
-    0.500000, 0.133975,
-    0.132570, -0.289929, -0.947822,
-    1.000000, 1.000000,
-    0.196412, -0.397351, -0.896401,
-    0.000000, 1.000000,
-    0.262661, -0.368518, -0.891742,
-    0.500000, 0.133975,
-    0.198387, -0.330607, -0.922682,
-    1.000000, 1.000000,
-    0.131655, -0.358229, -0.924305,
-    0.000000, 1.000000,
-    0.196412, -0.397351, -0.896401,
-    0.500000, 0.133975,
-    0.198387, -0.330607, -0.922682,
-    1.000000, 1.000000,
-    0.196412, -0.397351, -0.896401,
-    0.000000, 1.000000,
-    0.259892, -0.433889, -0.862668,
-    0.500000, 0.133975,
-    0.262661, -0.368518, -0.891742,
-    1.000000, 1.000000,
-    0.066604, -0.179596, -0.981483,
-    0.000000, 1.000000,
-    0.133256, -0.151549, -0.979426,
-    0.500000, 0.133975,
-    0.066709, -0.110385, -0.991648,
-    1.000000, 1.000000,
-    0.000000, -0.137952, -0.990439,
-    0.000000, 1.000000,
-    0.066604, -0.179596, -0.981483,
-    0.500000, 0.133975,
-    0.066709, -0.110385, -0.991648,
-    1.000000, 1.000000,
-    0.066604, -0.179596, -0.981483,
-    0.000000, 1.000000,
-    0.132792, -0.220117, -0.966393,
-    0.500000, 0.133975,
-    0.133256, -0.151549, -0.979426,
-    1.000000, 1.000000,
-    0.000000, -0.069142, -0.997607,
-    0.000000, 1.000000,
-    0.066709, -0.110385, -0.991648,
-    0.500000, 0.133975,
-    0.066741, -0.041248, -0.996917,
-    1.000000, 1.000000,
-    0.000000, 0.000000, -1.000000,
-    0.000000, 1.000000,
-    0.000000, -0.069142, -0.997607,
-    0.500000, 0.133975,
-    0.066741, -0.041248, -0.996917,
-    1.000000, 1.000000,
-    0.000000, -0.069142, -0.997607,
-    0.000000, 1.000000,
-    0.000000, -0.137952, -0.990439,
-    0.500000, 0.133975,
-    0.066709, -0.110385, -0.991648,
-    1.000000, 1.000000,
-    0.000000, -0.206103, -0.978530,
-    0.000000, 1.000000,
-    0.066567, -0.247326, -0.966643,
-    0.500000, 0.133975,
-    0.066604, -0.179596, -0.981483,
-    1.000000, 1.000000,
-    0.000000, -0.137952, -0.990439,
-    0.000000, 1.000000,
-    0.000000, -0.206103, -0.978530,
-    0.500000, 0.133975,
-    0.066604, -0.179596, -0.981483,
-    1.000000, 1.000000,
-    0.000000, -0.206103, -0.978530,
-    0.000000, 1.000000,
-    0.000000, -0.273267, -0.961938,
-    0.500000, 0.133975,
-    0.066567, -0.247326, -0.966643,
-    1.000000, 1.000000,
-    0.065817, -0.445365, -0.892927,
-    0.000000, 1.000000,
-    0.131749, -0.422364, -0.896801,
-    0.500000, 0.133975,
-    0.065988, -0.381722, -0.921919,
-    1.000000, 1.000000,
-    0.000000, -0.403355, -0.915043,
-    0.000000, 1.000000,
-    0.065817, -0.445365, -0.892927,
-    0.500000, 0.133975,
-    0.065988, -0.381722, -0.921919,
-    1.000000, 1.000000,
-    0.065817, -0.445365, -0.892927,
-    0.000000, 1.000000,
-    0.131200, -0.484442, -0.864929,
-    0.500000, 0.133975,
-    0.131749, -0.422364, -0.896801,
-    1.000000, 1.000000,
-    0.000000, -0.339123, -0.940742,
-    0.000000, 1.000000,
-    0.065988, -0.381722, -0.921919,
-    0.500000, 0.133975,
-    0.066042, -0.316778, -0.946198,
-    1.000000, 1.000000,
-    0.000000, -0.273267, -0.961938,
-    0.000000, 1.000000,
-    0.000000, -0.339123, -0.940742,
-    0.500000, 0.133975,
-    0.066042, -0.316778, -0.946198,
-    1.000000, 1.000000,
-    0.000000, -0.339123, -0.940742,
-    0.000000, 1.000000,
-    0.000000, -0.403355, -0.915043,
-    0.500000, 0.133975,
-    0.065988, -0.381722, -0.921919,
-    1.000000, 1.000000,
-    0.000000, -0.465658, -0.884965,
-    0.000000, 1.000000,
-    0.065758, -0.506298, -0.859848,
-    0.500000, 0.133975,
-    0.065817, -0.445365, -0.892927,
-    1.000000, 1.000000,
-    0.000000, -0.403355, -0.915043,
-    0.000000, 1.000000,
-    0.000000, -0.465658, -0.884965,
-    0.500000, 0.133975,
-    0.065817, -0.445365, -0.892927,
-    1.000000, 1.000000,
-    0.000000, -0.465658, -0.884965,
-    0.000000, 1.000000,
-    0.000000, -0.525731, -0.850651,
-    0.500000, 0.133975,
-    0.065758, -0.506298, -0.859848,
-    1.000000, 1.000000,
-    -0.334140, -0.041302, -0.941618,
-    0.000000, 1.000000,
-    -0.334140, 0.041302, -0.941618,
-    0.500000, 0.133975,
-    -0.400968, 0.000000, -0.916092,
-    1.000000, 1.000000,
-    -0.399607, -0.082324, -0.912982,
-    0.000000, 1.000000,
-    -0.334140, -0.041302, -0.941618,
-    0.500000, 0.133975,
-    -0.400968, 0.000000, -0.916092,
-    1.000000, 1.000000,
-    -0.334140, -0.041302, -0.941618,
-    0.000000, 1.000000,
-    -0.266405, 0.000000, -0.963861,
-    0.500000, 0.133975,
-    -0.334140, 0.041302, -0.941618,
-    1.000000, 1.000000,
-    -0.464213, -0.041299, -0.884760,
-    0.000000, 1.000000,
-    -0.400968, 0.000000, -0.916092,
-    0.500000, 0.133975,
-    -0.464213, 0.041299, -0.884760,
-    1.000000, 1.000000,
-    -0.525731, 0.000000, -0.850651,
-    0.000000, 1.000000,
-    -0.464213, -0.041299, -0.884760,
-    0.500000, 0.133975,
-    -0.464213, 0.041299, -0.884760,
-    1.000000, 1.000000,
-    -0.464213, -0.041299, -0.884760,
-    0.000000, 1.000000,
-    -0.399607, -0.082324, -0.912982,
-    0.500000, 0.133975,
-    -0.400968, 0.000000, -0.916092,
-    1.000000, 1.000000,
-    -0.332342, -0.122800, -0.935130,
-    0.000000, 1.000000,
-    -0.265518, -0.081501, -0.960655,
-    0.500000, 0.133975,
-    -0.334140, -0.041302, -0.941618,
-    1.000000, 1.000000,
-    -0.399607, -0.082324, -0.912982,
-    0.000000, 1.000000,
-    -0.332342, -0.122800, -0.935130,
-    0.500000, 0.133975,
-    -0.334140, -0.041302, -0.941618,
-    1.000000, 1.000000,
-    -0.332342, -0.122800, -0.935130,
-    0.000000, 1.000000,
-    -0.262866, -0.162460, -0.951057,
-    0.500000, 0.133975,
-    -0.265518, -0.081501, -0.960655,
-    1.000000, 1.000000,
-    -0.524110, 0.078459, -0.848029,
-    0.000000, 1.000000,
-    -0.464213, 0.041299, -0.884760,
-    0.500000, 0.133975,
-    -0.460882, 0.119755, -0.879345,
-    1.000000, 1.000000,
-    -0.524110, 0.078459, -0.848029,
-    0.000000, 1.000000,
-    -0.525731, 0.000000, -0.850651,
-    0.500000, 0.133975,
-    -0.464213, 0.041299, -0.884760,
-    1.000000, 1.000000,
-    -0.454262, -0.198227, -0.868534,
-    0.000000, 1.000000,
-    -0.394136, -0.161006, -0.904839,
-    0.500000, 0.133975,
-    -0.460882, -0.119755, -0.879345,
-    1.000000, 1.000000,
-    -0.519258, -0.156434, -0.840178,
-    0.000000, 1.000000,
-    -0.454262, -0.198227, -0.868534,
-    0.500000, 0.133975,
-    -0.460882, -0.119755, -0.879345,
-    1.000000, 1.000000,
-    -0.454262, -0.198227, -0.868534,
-    0.000000, 1.000000,
-    -0.386187, -0.238677, -0.891007,
-    0.500000, 0.133975,
-    -0.394136, -0.161006, -0.904839,
-    1.000000, 1.000000,
-    -0.524110, -0.078459, -0.848029,
-    0.000000, 1.000000,
-    -0.460882, -0.119755, -0.879345,
-    0.500000, 0.133975,
-    -0.464213, -0.041299, -0.884760,
-    1.000000, 1.000000,
-    -0.525731, 0.000000, -0.850651,
-    0.000000, 1.000000,
-    -0.524110, -0.078459, -0.848029,
-    0.500000, 0.133975,
-    -0.464213, -0.041299, -0.884760,
-    1.000000, 1.000000,
-    -0.524110, -0.078459, -0.848029,
-    0.000000, 1.000000,
-    -0.519258, -0.156434, -0.840178,
-    0.500000, 0.133975,
-    -0.460882, -0.119755, -0.879345,
-    1.000000, 1.000000,
-    -0.511205, -0.233445, -0.827147,
-    0.000000, 1.000000,
-    -0.444464, -0.274694, -0.852640,
-    0.500000, 0.133975,
-    -0.454262, -0.198227, -0.868534,
-    1.000000, 1.000000,
-    -0.519258, -0.156434, -0.840178,
-    0.000000, 1.000000,
-    -0.511205, -0.233445, -0.827147,
-    0.500000, 0.133975,
-    -0.454262, -0.198227, -0.868534,
-    1.000000, 1.000000,
-    -0.511205, -0.233445, -0.827147,
-    0.000000, 1.000000,
-    -0.500000, -0.309017, -0.809017,
-    0.500000, 0.133975,
-    -0.444464, -0.274694, -0.852640,
-    1.000000, 1.000000,
-    -0.667502, -0.040677, -0.743496,
-    0.000000, 1.000000,
-    -0.622292, 0.000000, -0.782786,
-    0.500000, 0.133975,
-    -0.667502, 0.040677, -0.743496,
-    1.000000, 1.000000,
-    -0.711282, 0.000000, -0.702907,
-    0.000000, 1.000000,
-    -0.667502, -0.040677, -0.743496,
-    0.500000, 0.133975,
-    -0.667502, 0.040677, -0.743496,
-    1.000000, 1.000000,
-    -0.667502, -0.040677, -0.743496,
-    0.000000, 1.000000,
-    -0.620240, -0.081142, -0.780204,
-    0.500000, 0.133975,
-    -0.622292, 0.000000, -0.782786,
-    1.000000, 1.000000,
-    -0.708969, 0.080573, -0.700622,
-    0.000000, 1.000000,
-    -0.667502, 0.040677, -0.743496,
-    0.500000, 0.133975,
-    -0.662842, 0.121193, -0.738886,
-    1.000000, 1.000000,
-    -0.708969, 0.080573, -0.700622,
-    0.000000, 1.000000,
-    -0.711282, 0.000000, -0.702907,
-    0.500000, 0.133975,
-    -0.667502, 0.040677, -0.743496,
-    1.000000, 1.000000,
-    -0.708969, -0.080573, -0.700622,
-    0.000000, 1.000000,
-    -0.662842, -0.121193, -0.738886,
-    0.500000, 0.133975,
-    -0.667502, -0.040677, -0.743496,
-    1.000000, 1.000000,
-    -0.711282, 0.000000, -0.702907,
-    0.000000, 1.000000,
-    -0.708969, -0.080573, -0.700622,
-    0.500000, 0.133975,
-    -0.667502, -0.040677, -0.743496,
-    1.000000, 1.000000,
-    -0.708969, -0.080573, -0.700622,
-    0.000000, 1.000000,
-    -0.702046, -0.160622, -0.693780,
-    0.500000, 0.133975,
-    -0.662842, -0.121193, -0.738886,
-    1.000000, 1.000000,
-    -0.786433, 0.000000, -0.617676,
-    0.000000, 1.000000,
-    -0.749387, -0.040642, -0.660884,
-    0.500000, 0.133975,
-    -0.749387, 0.040642, -0.660884,
-    1.000000, 1.000000,
-    -0.783843, 0.081086, -0.615642,
-    0.000000, 1.000000,
-    -0.786433, 0.000000, -0.617676,
-    0.500000, 0.133975,
-    -0.749387, 0.040642, -0.660884,
-    1.000000, 1.000000,
-    -0.786433, 0.000000, -0.617676,
-    0.000000, 1.000000,
-    -0.783843, -0.081086, -0.615642,
-    0.500000, 0.133975,
-    -0.749387, -0.040642, -0.660884,
-    1.000000, 1.000000,
-    -0.744727, 0.121144, -0.656282,
-    0.000000, 1.000000,
-    -0.749387, 0.040642, -0.660884,
-    0.500000, 0.133975,
-    -0.708969, 0.080573, -0.700622,
-    1.000000, 1.000000,
-    -0.744727, 0.121144, -0.656282,
-    0.000000, 1.000000,
-    -0.783843, 0.081086, -0.615642,
-    0.500000, 0.133975,
-    -0.749387, 0.040642, -0.660884,
-    1.000000, 1.000000,
-    -0.819207, 0.040640, -0.572056,
-    0.000000, 1.000000,
-    -0.819207, -0.040640, -0.572056,
-    0.500000, 0.133975,
-    -0.786433, 0.000000, -0.617676,
-    1.000000, 1.000000,
-    -0.783843, 0.081086, -0.615642,
-    0.000000, 1.000000,
-    -0.819207, 0.040640, -0.572056,
-    0.500000, 0.133975,
-    -0.786433, 0.000000, -0.617676,
-    1.000000, 1.000000,
-    -0.819207, 0.040640, -0.572056,
-    0.000000, 1.000000,
-    -0.850651, 0.000000, -0.525731,
-    0.500000, 0.133975,
-    -0.819207, -0.040640, -0.572056,
-    1.000000, 1.000000,
-    -0.041302, -0.941618, 0.334140,
-    0.000000, 1.000000,
-    0.000000, -0.916092, 0.400968,
-    0.500000, 0.133975,
-    0.041302, -0.941618, 0.334140,
-    1.000000, 1.000000,
-    0.000000, -0.963861, 0.266405,
-    0.000000, 1.000000,
-    -0.041302, -0.941618, 0.334140,
-    0.500000, 0.133975,
-    0.041302, -0.941618, 0.334140,
-    1.000000, 1.000000,
-    -0.041302, -0.941618, 0.334140,
-    0.000000, 1.000000,
-    -0.082324, -0.912982, 0.399607,
-    0.500000, 0.133975,
-    0.000000, -0.916092, 0.400968,
-    1.000000, 1.000000,
-    0.081501, -0.960655, 0.265518,
-    0.000000, 1.000000,
-    0.041302, -0.941618, 0.334140,
-    0.500000, 0.133975,
-    0.122800, -0.935130, 0.332342,
-    1.000000, 1.000000,
-    0.162460, -0.951057, 0.262866,
-    0.000000, 1.000000,
-    0.081501, -0.960655, 0.265518,
-    0.500000, 0.133975,
-    0.122800, -0.935130, 0.332342,
-    1.000000, 1.000000,
-    0.081501, -0.960655, 0.265518,
-    0.000000, 1.000000,
-    0.000000, -0.963861, 0.266405,
-    0.500000, 0.133975,
-    0.041302, -0.941618, 0.334140,
-    1.000000, 1.000000,
-    -0.081501, -0.960655, 0.265518,
-    0.000000, 1.000000,
-    -0.122800, -0.935130, 0.332342,
-    0.500000, 0.133975,
-    -0.041302, -0.941618, 0.334140,
-    1.000000, 1.000000,
-    0.000000, -0.963861, 0.266405,
-    0.000000, 1.000000,
-    -0.081501, -0.960655, 0.265518,
-    0.500000, 0.133975,
-    -0.041302, -0.941618, 0.334140,
-    1.000000, 1.000000,
-    -0.081501, -0.960655, 0.265518,
-    0.000000, 1.000000,
-    -0.162460, -0.951057, 0.262866,
-    0.500000, 0.133975,
-    -0.122800, -0.935130, 0.332342,
-    1.000000, 1.000000,
-    0.161006, -0.904839, 0.394136,
-    0.000000, 1.000000,
-    0.119755, -0.879345, 0.460882,
-    0.500000, 0.133975,
-    0.198227, -0.868534, 0.454262,
-    1.000000, 1.000000,
-    0.238677, -0.891007, 0.386187,
-    0.000000, 1.000000,
-    0.161006, -0.904839, 0.394136,
-    0.500000, 0.133975,
-    0.198227, -0.868534, 0.454262,
-    1.000000, 1.000000,
-    0.161006, -0.904839, 0.394136,
-    0.000000, 1.000000,
-    0.082324, -0.912982, 0.399607,
-    0.500000, 0.133975,
-    0.119755, -0.879345, 0.460882,
-    1.000000, 1.000000,
-    0.274694, -0.852640, 0.444464,
-    0.000000, 1.000000,
-    0.198227, -0.868534, 0.454262,
-    0.500000, 0.133975,
-    0.233445, -0.827147, 0.511205,
-    1.000000, 1.000000,
-    0.309017, -0.809017, 0.500000,
-    0.000000, 1.000000,
-    0.274694, -0.852640, 0.444464,
-    0.500000, 0.133975,
-    0.233445, -0.827147, 0.511205,
-    1.000000, 1.000000,
-    0.274694, -0.852640, 0.444464,
-    0.000000, 1.000000,
-    0.238677, -0.891007, 0.386187,
-    0.500000, 0.133975,
-    0.198227, -0.868534, 0.454262,
-    1.000000, 1.000000,
-    0.201189, -0.923880, 0.325530,
-    0.000000, 1.000000,
-    0.122800, -0.935130, 0.332342,
-    0.500000, 0.133975,
-    0.161006, -0.904839, 0.394136,
-    1.000000, 1.000000,
-    0.238677, -0.891007, 0.386187,
-    0.000000, 1.000000,
-    0.201189, -0.923880, 0.325530,
-    0.500000, 0.133975,
-    0.161006, -0.904839, 0.394136,
-    1.000000, 1.000000,
-    0.201189, -0.923880, 0.325530,
-    0.000000, 1.000000,
-    0.162460, -0.951057, 0.262866,
-    0.500000, 0.133975,
-    0.122800, -0.935130, 0.332342,
-    1.000000, 1.000000,
-    0.000000, -0.991046, 0.133523,
-    0.000000, 1.000000,
-    -0.041251, -0.978852, 0.200368,
-    0.500000, 0.133975,
-    0.041251, -0.978852, 0.200368,
-    1.000000, 1.000000,
-    0.082242, -0.987688, 0.133071,
-    0.000000, 1.000000,
-    0.000000, -0.991046, 0.133523,
-    0.500000, 0.133975,
-    0.041251, -0.978852, 0.200368,
-    1.000000, 1.000000,
-    0.000000, -0.991046, 0.133523,
-    0.000000, 1.000000,
-    -0.082242, -0.987688, 0.133071,
-    0.500000, 0.133975,
-    -0.041251, -0.978852, 0.200368,
-    1.000000, 1.000000,
-    0.122729, -0.972370, 0.198580,
-    0.000000, 1.000000,
-    0.041251, -0.978852, 0.200368,
-    0.500000, 0.133975,
-    0.081501, -0.960655, 0.265518,
-    1.000000, 1.000000,
-    0.162460, -0.951057, 0.262866,
-    0.000000, 1.000000,
-    0.122729, -0.972370, 0.198580,
-    0.500000, 0.133975,
-    0.081501, -0.960655, 0.265518,
-    1.000000, 1.000000,
-    0.122729, -0.972370, 0.198580,
-    0.000000, 1.000000,
-    0.082242, -0.987688, 0.133071,
-    0.500000, 0.133975,
-    0.041251, -0.978852, 0.200368,
-    1.000000, 1.000000,
-    0.041248, -0.996917, 0.066741,
-    0.000000, 1.000000,
-    -0.041248, -0.996917, 0.066741,
-    0.500000, 0.133975,
-    0.000000, -0.991046, 0.133523,
-    1.000000, 1.000000,
-    0.082242, -0.987688, 0.133071,
-    0.000000, 1.000000,
-    0.041248, -0.996917, 0.066741,
-    0.500000, 0.133975,
-    0.000000, -0.991046, 0.133523,
-    1.000000, 1.000000,
-    0.041248, -0.996917, 0.066741,
-    0.000000, 1.000000,
-    0.000000, -1.000000, 0.000000,
-    0.500000, 0.133975,
-    -0.041248, -0.996917, 0.066741,
-    1.000000, 1.000000,
-    0.000000, -0.782786, 0.622292,
-    0.000000, 1.000000,
-    -0.040677, -0.743496, 0.667502,
-    0.500000, 0.133975,
-    0.040677, -0.743496, 0.667502,
-    1.000000, 1.000000,
-    0.081142, -0.780204, 0.620240,
-    0.000000, 1.000000,
-    0.000000, -0.782786, 0.622292,
-    0.500000, 0.133975,
-    0.040677, -0.743496, 0.667502,
-    1.000000, 1.000000,
-    0.000000, -0.782786, 0.622292,
-    0.000000, 1.000000,
-    -0.081142, -0.780204, 0.620240,
-    0.500000, 0.133975,
-    -0.040677, -0.743496, 0.667502,
-    1.000000, 1.000000,
-    0.121193, -0.738886, 0.662842,
-    0.000000, 1.000000,
-    0.040677, -0.743496, 0.667502,
-    0.500000, 0.133975,
-    0.080573, -0.700622, 0.708969,
-    1.000000, 1.000000,
-    0.160622, -0.693780, 0.702046,
-    0.000000, 1.000000,
-    0.121193, -0.738886, 0.662842,
-    0.500000, 0.133975,
-    0.080573, -0.700622, 0.708969,
-    1.000000, 1.000000,
-    0.121193, -0.738886, 0.662842,
-    0.000000, 1.000000,
-    0.081142, -0.780204, 0.620240,
-    0.500000, 0.133975,
-    0.040677, -0.743496, 0.667502,
-    1.000000, 1.000000,
-    0.040675, -0.817523, 0.574458,
-    0.000000, 1.000000,
-    -0.040675, -0.817523, 0.574458,
-    0.500000, 0.133975,
-    0.000000, -0.782786, 0.622292,
-    1.000000, 1.000000,
-    0.081142, -0.780204, 0.620240,
-    0.000000, 1.000000,
-    0.040675, -0.817523, 0.574458,
-    0.500000, 0.133975,
-    0.000000, -0.782786, 0.622292,
-    1.000000, 1.000000,
-    0.040675, -0.817523, 0.574458,
-    0.000000, 1.000000,
-    0.000000, -0.850651, 0.525731,
-    0.500000, 0.133975,
-    -0.040675, -0.817523, 0.574458,
-    1.000000, 1.000000,
-    0.040642, -0.660884, 0.749387,
-    0.000000, 1.000000,
-    -0.040642, -0.660884, 0.749387,
-    0.500000, 0.133975,
-    0.000000, -0.617676, 0.786433,
-    1.000000, 1.000000,
-    0.081086, -0.615642, 0.783843,
-    0.000000, 1.000000,
-    0.040642, -0.660884, 0.749387,
-    0.500000, 0.133975,
-    0.000000, -0.617676, 0.786433,
-    1.000000, 1.000000,
-    0.040642, -0.660884, 0.749387,
-    0.000000, 1.000000,
-    0.000000, -0.702907, 0.711282,
-    0.500000, 0.133975,
-    -0.040642, -0.660884, 0.749387,
-    1.000000, 1.000000,
-    0.040640, -0.572056, 0.819207,
-    0.000000, 1.000000,
-    0.000000, -0.617676, 0.786433,
-    0.500000, 0.133975,
-    -0.040640, -0.572056, 0.819207,
-    1.000000, 1.000000,
-    0.000000, -0.525731, 0.850651,
-    0.000000, 1.000000,
-    0.040640, -0.572056, 0.819207,
-    0.500000, 0.133975,
-    -0.040640, -0.572056, 0.819207,
-    1.000000, 1.000000,
-    0.040640, -0.572056, 0.819207,
-    0.000000, 1.000000,
-    0.081086, -0.615642, 0.783843,
-    0.500000, 0.133975,
-    0.000000, -0.617676, 0.786433,
-    1.000000, 1.000000,
-    0.121144, -0.656282, 0.744727,
-    0.000000, 1.000000,
-    0.080573, -0.700622, 0.708969,
-    0.500000, 0.133975,
-    0.040642, -0.660884, 0.749387,
-    1.000000, 1.000000,
-    0.081086, -0.615642, 0.783843,
-    0.000000, 1.000000,
-    0.121144, -0.656282, 0.744727,
-    0.500000, 0.133975,
-    0.040642, -0.660884, 0.749387,
-    1.000000, 1.000000,
-    0.121144, -0.656282, 0.744727,
-    0.000000, 1.000000,
-    0.160622, -0.693780, 0.702046,
-    0.500000, 0.133975,
-    0.080573, -0.700622, 0.708969,
-    1.000000, 1.000000,
-    0.197274, -0.801504, 0.564513,
-    0.000000, 1.000000,
-    0.119078, -0.812169, 0.571140,
-    0.500000, 0.133975,
-    0.159613, -0.771841, 0.615456,
-    1.000000, 1.000000,
-    0.237086, -0.758652, 0.606825,
-    0.000000, 1.000000,
-    0.197274, -0.801504, 0.564513,
-    0.500000, 0.133975,
-    0.159613, -0.771841, 0.615456,
-    1.000000, 1.000000,
-    0.197274, -0.801504, 0.564513,
-    0.000000, 1.000000,
-    0.156434, -0.840178, 0.519258,
-    0.500000, 0.133975,
-    0.119078, -0.812169, 0.571140,
-    1.000000, 1.000000,
-    0.199331, -0.727958, 0.656006,
-    0.000000, 1.000000,
-    0.159613, -0.771841, 0.615456,
-    0.500000, 0.133975,
-    0.121193, -0.738886, 0.662842,
-    1.000000, 1.000000,
-    0.160622, -0.693780, 0.702046,
-    0.000000, 1.000000,
-    0.199331, -0.727958, 0.656006,
-    0.500000, 0.133975,
-    0.121193, -0.738886, 0.662842,
-    1.000000, 1.000000,
-    0.199331, -0.727958, 0.656006,
-    0.000000, 1.000000,
-    0.237086, -0.758652, 0.606825,
-    0.500000, 0.133975,
-    0.159613, -0.771841, 0.615456,
-    1.000000, 1.000000,
-    0.273707, -0.785715, 0.554740,
-    0.000000, 1.000000,
-    0.233445, -0.827147, 0.511205,
-    0.500000, 0.133975,
-    0.197274, -0.801504, 0.564513,
-    1.000000, 1.000000,
-    0.237086, -0.758652, 0.606825,
-    0.000000, 1.000000,
-    0.273707, -0.785715, 0.554740,
-    0.500000, 0.133975,
-    0.197274, -0.801504, 0.564513,
-    1.000000, 1.000000,
-    0.273707, -0.785715, 0.554740,
-    0.000000, 1.000000,
-    0.309017, -0.809017, 0.500000,
-    0.500000, 0.133975,
-    0.233445, -0.827147, 0.511205,
-    1.000000, 1.000000,
-    0.289929, -0.947822, 0.132570,
-    0.000000, 1.000000,
-    0.261550, -0.944433, 0.199094,
-    0.500000, 0.133975,
-    0.330607, -0.922682, 0.198387,
-    1.000000, 1.000000,
-    0.358229, -0.924305, 0.131655,
-    0.000000, 1.000000,
-    0.289929, -0.947822, 0.132570,
-    0.500000, 0.133975,
-    0.330607, -0.922682, 0.198387,
-    1.000000, 1.000000,
-    0.289929, -0.947822, 0.132570,
-    0.000000, 1.000000,
-    0.220117, -0.966393, 0.132792,
-    0.500000, 0.133975,
-    0.261550, -0.944433, 0.199094,
-    1.000000, 1.000000,
-    0.397351, -0.896401, 0.196412,
-    0.000000, 1.000000,
-    0.330607, -0.922682, 0.198387,
-    0.500000, 0.133975,
-    0.368518, -0.891742, 0.262661,
-    1.000000, 1.000000,
-    0.433889, -0.862668, 0.259892,
-    0.000000, 1.000000,
-    0.397351, -0.896401, 0.196412,
-    0.500000, 0.133975,
-    0.368518, -0.891742, 0.262661,
-    1.000000, 1.000000,
-    0.397351, -0.896401, 0.196412,
-    0.000000, 1.000000,
-    0.358229, -0.924305, 0.131655,
-    0.500000, 0.133975,
-    0.330607, -0.922682, 0.198387,
-    1.000000, 1.000000,
-    0.316778, -0.946198, 0.066042,
-    0.000000, 1.000000,
-    0.247326, -0.966643, 0.066567,
-    0.500000, 0.133975,
-    0.289929, -0.947822, 0.132570,
-    1.000000, 1.000000,
-    0.358229, -0.924305, 0.131655,
-    0.000000, 1.000000,
-    0.316778, -0.946198, 0.066042,
-    0.500000, 0.133975,
-    0.289929, -0.947822, 0.132570,
-    1.000000, 1.000000,
-    0.316778, -0.946198, 0.066042,
-    0.000000, 1.000000,
-    0.273267, -0.961938, 0.000000,
-    0.500000, 0.133975,
-    0.247326, -0.966643, 0.066567,
-    1.000000, 1.000000,
-    0.339209, -0.882837, 0.324864,
-    0.000000, 1.000000,
-    0.270627, -0.905832, 0.325929,
-    0.500000, 0.133975,
-    0.307659, -0.869725, 0.385906,
-    1.000000, 1.000000,
-    0.375039, -0.843911, 0.383614,
-    0.000000, 1.000000,
-    0.339209, -0.882837, 0.324864,
-    0.500000, 0.133975,
-    0.307659, -0.869725, 0.385906,
-    1.000000, 1.000000,
-    0.339209, -0.882837, 0.324864,
-    0.000000, 1.000000,
-    0.301259, -0.916244, 0.264083,
-    0.500000, 0.133975,
-    0.270627, -0.905832, 0.325929,
-    1.000000, 1.000000,
-    0.342848, -0.828447, 0.442867,
-    0.000000, 1.000000,
-    0.307659, -0.869725, 0.385906,
-    0.500000, 0.133975,
-    0.274694, -0.852640, 0.444464,
-    1.000000, 1.000000,
-    0.309017, -0.809017, 0.500000,
-    0.000000, 1.000000,
-    0.342848, -0.828447, 0.442867,
-    0.500000, 0.133975,
-    0.274694, -0.852640, 0.444464,
-    1.000000, 1.000000,
-    0.342848, -0.828447, 0.442867,
-    0.000000, 1.000000,
-    0.375039, -0.843911, 0.383614,
-    0.500000, 0.133975,
-    0.307659, -0.869725, 0.385906,
-    1.000000, 1.000000,
-    0.405434, -0.855337, 0.322525,
-    0.000000, 1.000000,
-    0.368518, -0.891742, 0.262661,
-    0.500000, 0.133975,
-    0.339209, -0.882837, 0.324864,
-    1.000000, 1.000000,
-    0.375039, -0.843911, 0.383614,
-    0.000000, 1.000000,
-    0.405434, -0.855337, 0.322525,
-    0.500000, 0.133975,
-    0.339209, -0.882837, 0.324864,
-    1.000000, 1.000000,
-    0.405434, -0.855337, 0.322525,
-    0.000000, 1.000000,
-    0.433889, -0.862668, 0.259892,
-    0.500000, 0.133975,
-    0.368518, -0.891742, 0.262661,
-    1.000000, 1.000000,
-    0.445365, -0.892927, 0.065817,
-    0.000000, 1.000000,
-    0.381722, -0.921919, 0.065988,
-    0.500000, 0.133975,
-    0.422364, -0.896801, 0.131749,
-    1.000000, 1.000000,
-    0.484442, -0.864929, 0.131200,
-    0.000000, 1.000000,
-    0.445365, -0.892927, 0.065817,
-    0.500000, 0.133975,
-    0.422364, -0.896801, 0.131749,
-    1.000000, 1.000000,
-    0.445365, -0.892927, 0.065817,
-    0.000000, 1.000000,
-    0.403355, -0.915043, 0.000000,
-    0.500000, 0.133975,
-    0.381722, -0.921919, 0.065988,
-    1.000000, 1.000000,
-    0.460267, -0.865871, 0.196015,
-    0.000000, 1.000000,
-    0.422364, -0.896801, 0.131749,
-    0.500000, 0.133975,
-    0.397351, -0.896401, 0.196412,
-    1.000000, 1.000000,
-    0.433889, -0.862668, 0.259892,
-    0.000000, 1.000000,
-    0.460267, -0.865871, 0.196015,
-    0.500000, 0.133975,
-    0.397351, -0.896401, 0.196412,
-    1.000000, 1.000000,
-    0.460267, -0.865871, 0.196015,
-    0.000000, 1.000000,
-    0.484442, -0.864929, 0.131200,
-    0.500000, 0.133975,
-    0.422364, -0.896801, 0.131749,
-    1.000000, 1.000000,
-    0.506298, -0.859848, 0.065758,
-    0.000000, 1.000000,
-    0.465658, -0.884965, 0.000000,
-    0.500000, 0.133975,
-    0.445365, -0.892927, 0.065817,
-    1.000000, 1.000000,
-    0.484442, -0.864929, 0.131200,
-    0.000000, 1.000000,
-    0.506298, -0.859848, 0.065758,
-    0.500000, 0.133975,
-    0.445365, -0.892927, 0.065817,
-    1.000000, 1.000000,
-    0.506298, -0.859848, 0.065758,
-    0.000000, 1.000000,
-    0.525731, -0.850651, 0.000000,
-    0.500000, 0.133975,
-    0.465658, -0.884965, 0.000000,
-    1.000000, 1.000000,
-    0.041302, -0.941618, -0.334140,
-    0.000000, 1.000000,
-    0.000000, -0.916092, -0.400968,
-    0.500000, 0.133975,
-    -0.041302, -0.941618, -0.334140,
-    1.000000, 1.000000,
-    0.000000, -0.963861, -0.266405,
-    0.000000, 1.000000,
-    0.041302, -0.941618, -0.334140,
-    0.500000, 0.133975,
-    -0.041302, -0.941618, -0.334140,
-    1.000000, 1.000000,
-    0.041302, -0.941618, -0.334140,
-    0.000000, 1.000000,
-    0.082324, -0.912982, -0.399607,
-    0.500000, 0.133975,
-    0.000000, -0.916092, -0.400968,
-    1.000000, 1.000000,
-    -0.081501, -0.960655, -0.265518,
-    0.000000, 1.000000,
-    -0.041302, -0.941618, -0.334140,
-    0.500000, 0.133975,
-    -0.122800, -0.935130, -0.332342,
-    1.000000, 1.000000,
-    -0.162460, -0.951057, -0.262866,
-    0.000000, 1.000000,
-    -0.081501, -0.960655, -0.265518,
-    0.500000, 0.133975,
-    -0.122800, -0.935130, -0.332342,
-    1.000000, 1.000000,
-    -0.081501, -0.960655, -0.265518,
-    0.000000, 1.000000,
-    0.000000, -0.963861, -0.266405,
-    0.500000, 0.133975,
-    -0.041302, -0.941618, -0.334140,
-    1.000000, 1.000000,
-    0.081501, -0.960655, -0.265518,
-    0.000000, 1.000000,
-    0.122800, -0.935130, -0.332342,
-    0.500000, 0.133975,
-    0.041302, -0.941618, -0.334140,
-    1.000000, 1.000000,
-    0.000000, -0.963861, -0.266405,
-    0.000000, 1.000000,
-    0.081501, -0.960655, -0.265518,
-    0.500000, 0.133975,
-    0.041302, -0.941618, -0.334140,
-    1.000000, 1.000000,
-    0.081501, -0.960655, -0.265518,
-    0.000000, 1.000000,
-    0.162460, -0.951057, -0.262866,
-    0.500000, 0.133975,
-    0.122800, -0.935130, -0.332342,
-    1.000000, 1.000000,
-    -0.161006, -0.904839, -0.394136,
-    0.000000, 1.000000,
-    -0.119755, -0.879345, -0.460882,
-    0.500000, 0.133975,
-    -0.198227, -0.868534, -0.454262,
-    1.000000, 1.000000,
-    -0.238677, -0.891007, -0.386187,
-    0.000000, 1.000000,
-    -0.161006, -0.904839, -0.394136,
-    0.500000, 0.133975,
-    -0.198227, -0.868534, -0.454262,
-    1.000000, 1.000000,
-    -0.161006, -0.904839, -0.394136,
-    0.000000, 1.000000,
-    -0.082324, -0.912982, -0.399607,
-    0.500000, 0.133975,
-    -0.119755, -0.879345, -0.460882,
-    1.000000, 1.000000,
-    -0.274694, -0.852640, -0.444464,
-    0.000000, 1.000000,
-    -0.198227, -0.868534, -0.454262,
-    0.500000, 0.133975,
-    -0.233445, -0.827147, -0.511205,
-    1.000000, 1.000000,
-    -0.309017, -0.809017, -0.500000,
-    0.000000, 1.000000,
-    -0.274694, -0.852640, -0.444464,
-    0.500000, 0.133975,
-    -0.233445, -0.827147, -0.511205,
-    1.000000, 1.000000,
-    -0.274694, -0.852640, -0.444464,
-    0.000000, 1.000000,
-    -0.238677, -0.891007, -0.386187,
-    0.500000, 0.133975,
-    -0.198227, -0.868534, -0.454262,
-    1.000000, 1.000000,
-    -0.201189, -0.923880, -0.325530,
-    0.000000, 1.000000,
-    -0.122800, -0.935130, -0.332342,
-    0.500000, 0.133975,
-    -0.161006, -0.904839, -0.394136,
-    1.000000, 1.000000,
-    -0.238677, -0.891007, -0.386187,
-    0.000000, 1.000000,
-    -0.201189, -0.923880, -0.325530,
-    0.500000, 0.133975,
-    -0.161006, -0.904839, -0.394136,
-    1.000000, 1.000000,
-    -0.201189, -0.923880, -0.325530,
-    0.000000, 1.000000,
-    -0.162460, -0.951057, -0.262866,
-    0.500000, 0.133975,
-    -0.122800, -0.935130, -0.332342,
-    1.000000, 1.000000,
-    0.000000, -0.991046, -0.133523,
-    0.000000, 1.000000,
-    0.041251, -0.978852, -0.200368,
-    0.500000, 0.133975,
-    -0.041251, -0.978852, -0.200368,
-    1.000000, 1.000000,
-    -0.082242, -0.987688, -0.133071,
-    0.000000, 1.000000,
-    0.000000, -0.991046, -0.133523,
-    0.500000, 0.133975,
-    -0.041251, -0.978852, -0.200368,
-    1.000000, 1.000000,
-    0.000000, -0.991046, -0.133523,
-    0.000000, 1.000000,
-    0.082242, -0.987688, -0.133071,
-    0.500000, 0.133975,
-    0.041251, -0.978852, -0.200368,
-    1.000000, 1.000000,
-    -0.122729, -0.972370, -0.198580,
-    0.000000, 1.000000,
-    -0.041251, -0.978852, -0.200368,
-    0.500000, 0.133975,
-    -0.081501, -0.960655, -0.265518,
-    1.000000, 1.000000,
-    -0.162460, -0.951057, -0.262866,
-    0.000000, 1.000000,
-    -0.122729, -0.972370, -0.198580,
-    0.500000, 0.133975,
-    -0.081501, -0.960655, -0.265518,
-    1.000000, 1.000000,
-    -0.122729, -0.972370, -0.198580,
-    0.000000, 1.000000,
-    -0.082242, -0.987688, -0.133071,
-    0.500000, 0.133975,
-    -0.041251, -0.978852, -0.200368,
-    1.000000, 1.000000,
-    -0.041248, -0.996917, -0.066741,
-    0.000000, 1.000000,
-    0.041248, -0.996917, -0.066741,
-    0.500000, 0.133975,
-    0.000000, -0.991046, -0.133523,
-    1.000000, 1.000000,
-    -0.082242, -0.987688, -0.133071,
-    0.000000, 1.000000,
-    -0.041248, -0.996917, -0.066741,
-    0.500000, 0.133975,
-    0.000000, -0.991046, -0.133523,
-    1.000000, 1.000000,
-    -0.041248, -0.996917, -0.066741,
-    0.000000, 1.000000,
-    0.000000, -1.000000, 0.000000,
-    0.500000, 0.133975,
-    0.041248, -0.996917, -0.066741,
-    1.000000, 1.000000,
-    0.000000, -0.782786, -0.622292,
-    0.000000, 1.000000,
-    0.040677, -0.743496, -0.667502,
-    0.500000, 0.133975,
-    -0.040677, -0.743496, -0.667502,
-    1.000000, 1.000000,
-    -0.081142, -0.780204, -0.620240,
-    0.000000, 1.000000,
-    0.000000, -0.782786, -0.622292,
-    0.500000, 0.133975,
-    -0.040677, -0.743496, -0.667502,
-    1.000000, 1.000000,
-    0.000000, -0.782786, -0.622292,
-    0.000000, 1.000000,
-    0.081142, -0.780204, -0.620240,
-    0.500000, 0.133975,
-    0.040677, -0.743496, -0.667502,
-    1.000000, 1.000000,
-    -0.121193, -0.738886, -0.662842,
-    0.000000, 1.000000,
-    -0.040677, -0.743496, -0.667502,
-    0.500000, 0.133975,
-    -0.080573, -0.700622, -0.708969,
-    1.000000, 1.000000,
-    -0.160622, -0.693780, -0.702046,
-    0.000000, 1.000000,
-    -0.121193, -0.738886, -0.662842,
-    0.500000, 0.133975,
-    -0.080573, -0.700622, -0.708969,
-    1.000000, 1.000000,
-    -0.121193, -0.738886, -0.662842,
-    0.000000, 1.000000,
-    -0.081142, -0.780204, -0.620240,
-    0.500000, 0.133975,
-    -0.040677, -0.743496, -0.667502,
-    1.000000, 1.000000,
-    -0.040675, -0.817523, -0.574458,
-    0.000000, 1.000000,
-    0.040675, -0.817523, -0.574458,
-    0.500000, 0.133975,
-    0.000000, -0.782786, -0.622292,
-    1.000000, 1.000000,
-    -0.081142, -0.780204, -0.620240,
-    0.000000, 1.000000,
-    -0.040675, -0.817523, -0.574458,
-    0.500000, 0.133975,
-    0.000000, -0.782786, -0.622292,
-    1.000000, 1.000000,
-    -0.040675, -0.817523, -0.574458,
-    0.000000, 1.000000,
-    0.000000, -0.850651, -0.525731,
-    0.500000, 0.133975,
-    0.040675, -0.817523, -0.574458,
-    1.000000, 1.000000,
-    -0.040642, -0.660884, -0.749387,
-    0.000000, 1.000000,
-    0.040642, -0.660884, -0.749387,
-    0.500000, 0.133975,
-    0.000000, -0.617676, -0.786433,
-    1.000000, 1.000000,
-    -0.081086, -0.615642, -0.783843,
-    0.000000, 1.000000,
-    -0.040642, -0.660884, -0.749387,
-    0.500000, 0.133975,
-    0.000000, -0.617676, -0.786433,
-    1.000000, 1.000000,
-    -0.040642, -0.660884, -0.749387,
-    0.000000, 1.000000,
-    0.000000, -0.702907, -0.711282,
-    0.500000, 0.133975,
-    0.040642, -0.660884, -0.749387,
-    1.000000, 1.000000,
-    -0.040640, -0.572056, -0.819207,
-    0.000000, 1.000000,
-    0.000000, -0.617676, -0.786433,
-    0.500000, 0.133975,
-    0.040640, -0.572056, -0.819207,
-    1.000000, 1.000000,
-    0.000000, -0.525731, -0.850651,
-    0.000000, 1.000000,
-    -0.040640, -0.572056, -0.819207,
-    0.500000, 0.133975,
-    0.040640, -0.572056, -0.819207,
-    1.000000, 1.000000,
-    -0.040640, -0.572056, -0.819207,
-    0.000000, 1.000000,
-    -0.081086, -0.615642, -0.783843,
-    0.500000, 0.133975,
-    0.000000, -0.617676, -0.786433,
-    1.000000, 1.000000,
-    -0.121144, -0.656282, -0.744727,
-    0.000000, 1.000000,
-    -0.080573, -0.700622, -0.708969,
-    0.500000, 0.133975,
-    -0.040642, -0.660884, -0.749387,
-    1.000000, 1.000000,
-    -0.081086, -0.615642, -0.783843,
-    0.000000, 1.000000,
-    -0.121144, -0.656282, -0.744727,
-    0.500000, 0.133975,
-    -0.040642, -0.660884, -0.749387,
-    1.000000, 1.000000,
-    -0.121144, -0.656282, -0.744727,
-    0.000000, 1.000000,
-    -0.160622, -0.693780, -0.702046,
-    0.500000, 0.133975,
-    -0.080573, -0.700622, -0.708969,
-    1.000000, 1.000000,
-    -0.197274, -0.801504, -0.564513,
-    0.000000, 1.000000,
-    -0.119078, -0.812169, -0.571140,
-    0.500000, 0.133975,
-    -0.159613, -0.771841, -0.615456,
-    1.000000, 1.000000,
-    -0.237086, -0.758652, -0.606825,
-    0.000000, 1.000000,
-    -0.197274, -0.801504, -0.564513,
-    0.500000, 0.133975,
-    -0.159613, -0.771841, -0.615456,
-    1.000000, 1.000000,
-    -0.197274, -0.801504, -0.564513,
-    0.000000, 1.000000,
-    -0.156434, -0.840178, -0.519258,
-    0.500000, 0.133975,
-    -0.119078, -0.812169, -0.571140,
-    1.000000, 1.000000,
-    -0.199331, -0.727958, -0.656006,
-    0.000000, 1.000000,
-    -0.159613, -0.771841, -0.615456,
-    0.500000, 0.133975,
-    -0.121193, -0.738886, -0.662842,
-    1.000000, 1.000000,
-    -0.160622, -0.693780, -0.702046,
-    0.000000, 1.000000,
-    -0.199331, -0.727958, -0.656006,
-    0.500000, 0.133975,
-    -0.121193, -0.738886, -0.662842,
-    1.000000, 1.000000,
-    -0.199331, -0.727958, -0.656006,
-    0.000000, 1.000000,
-    -0.237086, -0.758652, -0.606825,
-    0.500000, 0.133975,
-    -0.159613, -0.771841, -0.615456,
-    1.000000, 1.000000,
-    -0.273707, -0.785715, -0.554740,
-    0.000000, 1.000000,
-    -0.233445, -0.827147, -0.511205,
-    0.500000, 0.133975,
-    -0.197274, -0.801504, -0.564513,
-    1.000000, 1.000000,
-    -0.237086, -0.758652, -0.606825,
-    0.000000, 1.000000,
-    -0.273707, -0.785715, -0.554740,
-    0.500000, 0.133975,
-    -0.197274, -0.801504, -0.564513,
-    1.000000, 1.000000,
-    -0.273707, -0.785715, -0.554740,
-    0.000000, 1.000000,
-    -0.309017, -0.809017, -0.500000,
-    0.500000, 0.133975,
-    -0.233445, -0.827147, -0.511205,
-    1.000000, 1.000000,
-    -0.289929, -0.947822, -0.132570,
-    0.000000, 1.000000,
-    -0.261550, -0.944433, -0.199094,
-    0.500000, 0.133975,
-    -0.330607, -0.922682, -0.198387,
-    1.000000, 1.000000,
-    -0.358229, -0.924305, -0.131655,
-    0.000000, 1.000000,
-    -0.289929, -0.947822, -0.132570,
-    0.500000, 0.133975,
-    -0.330607, -0.922682, -0.198387,
-    1.000000, 1.000000,
-    -0.289929, -0.947822, -0.132570,
-    0.000000, 1.000000,
-    -0.220117, -0.966393, -0.132792,
-    0.500000, 0.133975,
-    -0.261550, -0.944433, -0.199094,
-    1.000000, 1.000000,
-    -0.397351, -0.896401, -0.196412,
-    0.000000, 1.000000,
-    -0.330607, -0.922682, -0.198387,
-    0.500000, 0.133975,
-    -0.368518, -0.891742, -0.262661,
-    1.000000, 1.000000,
-    -0.433889, -0.862668, -0.259892,
-    0.000000, 1.000000,
-    -0.397351, -0.896401, -0.196412,
-    0.500000, 0.133975,
-    -0.368518, -0.891742, -0.262661,
-    1.000000, 1.000000,
-    -0.397351, -0.896401, -0.196412,
-    0.000000, 1.000000,
-    -0.358229, -0.924305, -0.131655,
-    0.500000, 0.133975,
-    -0.330607, -0.922682, -0.198387,
-    1.000000, 1.000000,
-    -0.316778, -0.946198, -0.066042,
-    0.000000, 1.000000,
-    -0.247326, -0.966643, -0.066567,
-    0.500000, 0.133975,
-    -0.289929, -0.947822, -0.132570,
-    1.000000, 1.000000,
-    -0.358229, -0.924305, -0.131655,
-    0.000000, 1.000000,
-    -0.316778, -0.946198, -0.066042,
-    0.500000, 0.133975,
-    -0.289929, -0.947822, -0.132570,
-    1.000000, 1.000000,
-    -0.316778, -0.946198, -0.066042,
-    0.000000, 1.000000,
-    -0.273267, -0.961938, 0.000000,
-    0.500000, 0.133975,
-    -0.247326, -0.966643, -0.066567,
-    1.000000, 1.000000,
-    -0.339209, -0.882837, -0.324864,
-    0.000000, 1.000000,
-    -0.270627, -0.905832, -0.325929,
-    0.500000, 0.133975,
-    -0.307659, -0.869725, -0.385906,
-    1.000000, 1.000000,
-    -0.375039, -0.843911, -0.383614,
-    0.000000, 1.000000,
-    -0.339209, -0.882837, -0.324864,
-    0.500000, 0.133975,
-    -0.307659, -0.869725, -0.385906,
-    1.000000, 1.000000,
-    -0.339209, -0.882837, -0.324864,
-    0.000000, 1.000000,
-    -0.301259, -0.916244, -0.264083,
-    0.500000, 0.133975,
-    -0.270627, -0.905832, -0.325929,
-    1.000000, 1.000000,
-    -0.342848, -0.828447, -0.442867,
-    0.000000, 1.000000,
-    -0.307659, -0.869725, -0.385906,
-    0.500000, 0.133975,
-    -0.274694, -0.852640, -0.444464,
-    1.000000, 1.000000,
-    -0.309017, -0.809017, -0.500000,
-    0.000000, 1.000000,
-    -0.342848, -0.828447, -0.442867,
-    0.500000, 0.133975,
-    -0.274694, -0.852640, -0.444464,
-    1.000000, 1.000000,
-    -0.342848, -0.828447, -0.442867,
-    0.000000, 1.000000,
-    -0.375039, -0.843911, -0.383614,
-    0.500000, 0.133975,
-    -0.307659, -0.869725, -0.385906,
-    1.000000, 1.000000,
-    -0.405434, -0.855337, -0.322525,
-    0.000000, 1.000000,
-    -0.368518, -0.891742, -0.262661,
-    0.500000, 0.133975,
-    -0.339209, -0.882837, -0.324864,
-    1.000000, 1.000000,
-    -0.375039, -0.843911, -0.383614,
-    0.000000, 1.000000,
-    -0.405434, -0.855337, -0.322525,
-    0.500000, 0.133975,
-    -0.339209, -0.882837, -0.324864,
-    1.000000, 1.000000,
-    -0.405434, -0.855337, -0.322525,
-    0.000000, 1.000000,
-    -0.433889, -0.862668, -0.259892,
-    0.500000, 0.133975,
-    -0.368518, -0.891742, -0.262661,
-    1.000000, 1.000000,
-    -0.445365, -0.892927, -0.065817,
-    0.000000, 1.000000,
-    -0.381722, -0.921919, -0.065988,
-    0.500000, 0.133975,
-    -0.422364, -0.896801, -0.131749,
-    1.000000, 1.000000,
-    -0.484442, -0.864929, -0.131200,
-    0.000000, 1.000000,
-    -0.445365, -0.892927, -0.065817,
-    0.500000, 0.133975,
-    -0.422364, -0.896801, -0.131749,
-    1.000000, 1.000000,
-    -0.445365, -0.892927, -0.065817,
-    0.000000, 1.000000,
-    -0.403355, -0.915043, 0.000000,
-    0.500000, 0.133975,
-    -0.381722, -0.921919, -0.065988,
-    1.000000, 1.000000,
-    -0.460267, -0.865871, -0.196015,
-    0.000000, 1.000000,
-    -0.422364, -0.896801, -0.131749,
-    0.500000, 0.133975,
-    -0.397351, -0.896401, -0.196412,
-    1.000000, 1.000000,
-    -0.433889, -0.862668, -0.259892,
-    0.000000, 1.000000,
-    -0.460267, -0.865871, -0.196015,
-    0.500000, 0.133975,
-    -0.397351, -0.896401, -0.196412,
-    1.000000, 1.000000,
-    -0.460267, -0.865871, -0.196015,
-    0.000000, 1.000000,
-    -0.484442, -0.864929, -0.131200,
-    0.500000, 0.133975,
-    -0.422364, -0.896801, -0.131749,
-    1.000000, 1.000000,
-    -0.506298, -0.859848, -0.065758,
-    0.000000, 1.000000,
-    -0.465658, -0.884965, 0.000000,
-    0.500000, 0.133975,
-    -0.445365, -0.892927, -0.065817,
-    1.000000, 1.000000,
-    -0.484442, -0.864929, -0.131200,
-    0.000000, 1.000000,
-    -0.506298, -0.859848, -0.065758,
-    0.500000, 0.133975,
-    -0.445365, -0.892927, -0.065817,
-    1.000000, 1.000000,
-    -0.506298, -0.859848, -0.065758,
-    0.000000, 1.000000,
-    -0.525731, -0.850651, 0.000000,
-    0.500000, 0.133975,
-    -0.465658, -0.884965, 0.000000,
-    1.000000, 1.000000,
-    -0.996917, 0.066741, 0.041248,
-    0.000000, 1.000000,
-    -1.000000, 0.000000, 0.000000,
-    0.500000, 0.133975,
-    -0.996917, 0.066741, -0.041248,
-    1.000000, 1.000000,
-    -0.946198, 0.066042, 0.316778,
-    0.000000, 1.000000,
-    -0.961938, 0.000000, 0.273267,
-    0.500000, 0.133975,
-    -0.966643, 0.066567, 0.247326,
-    1.000000, 1.000000,
-    -0.892927, 0.065817, 0.445365,
-    0.000000, 1.000000,
-    -0.915043, 0.000000, 0.403355,
-    0.500000, 0.133975,
-    -0.921919, 0.065988, 0.381722,
-    1.000000, 1.000000,
-    -0.859848, 0.065758, 0.506298,
-    0.000000, 1.000000,
-    -0.884965, 0.000000, 0.465658,
-    0.500000, 0.133975,
-    -0.892927, 0.065817, 0.445365,
-    1.000000, 1.000000,
-    -0.859848, 0.065758, 0.506298,
-    0.000000, 1.000000,
-    -0.850651, 0.000000, 0.525731,
-    0.500000, 0.133975,
-    -0.884965, 0.000000, 0.465658,
-    1.000000, 1.000000,
-    -0.941618, -0.334140, 0.041302,
-    0.000000, 1.000000,
-    -0.916092, -0.400968, 0.000000,
-    0.500000, 0.133975,
-    -0.941618, -0.334140, -0.041302,
-    1.000000, 1.000000,
-    -0.963861, -0.266405, 0.000000,
-    0.000000, 1.000000,
-    -0.941618, -0.334140, 0.041302,
-    0.500000, 0.133975,
-    -0.941618, -0.334140, -0.041302,
-    1.000000, 1.000000,
-    -0.941618, -0.334140, 0.041302,
-    0.000000, 1.000000,
-    -0.912982, -0.399607, 0.082324,
-    0.500000, 0.133975,
-    -0.916092, -0.400968, 0.000000,
-    1.000000, 1.000000,
-    -0.960655, -0.265518, -0.081501,
-    0.000000, 1.000000,
-    -0.941618, -0.334140, -0.041302,
-    0.500000, 0.133975,
-    -0.935130, -0.332342, -0.122800,
-    1.000000, 1.000000,
-    -0.951057, -0.262866, -0.162460,
-    0.000000, 1.000000,
-    -0.960655, -0.265518, -0.081501,
-    0.500000, 0.133975,
-    -0.935130, -0.332342, -0.122800,
-    1.000000, 1.000000,
-    -0.960655, -0.265518, -0.081501,
-    0.000000, 1.000000,
-    -0.963861, -0.266405, 0.000000,
-    0.500000, 0.133975,
-    -0.941618, -0.334140, -0.041302,
-    1.000000, 1.000000,
-    -0.960655, -0.265518, 0.081501,
-    0.000000, 1.000000,
-    -0.935130, -0.332342, 0.122800,
-    0.500000, 0.133975,
-    -0.941618, -0.334140, 0.041302,
-    1.000000, 1.000000,
-    -0.963861, -0.266405, 0.000000,
-    0.000000, 1.000000,
-    -0.960655, -0.265518, 0.081501,
-    0.500000, 0.133975,
-    -0.941618, -0.334140, 0.041302,
-    1.000000, 1.000000,
-    -0.960655, -0.265518, 0.081501,
-    0.000000, 1.000000,
-    -0.951057, -0.262866, 0.162460,
-    0.500000, 0.133975,
-    -0.935130, -0.332342, 0.122800,
-    1.000000, 1.000000,
-    -0.904839, -0.394136, -0.161006,
-    0.000000, 1.000000,
-    -0.879345, -0.460882, -0.119755,
-    0.500000, 0.133975,
-    -0.868534, -0.454262, -0.198227,
-    1.000000, 1.000000,
-    -0.891007, -0.386187, -0.238677,
-    0.000000, 1.000000,
-    -0.904839, -0.394136, -0.161006,
-    0.500000, 0.133975,
-    -0.868534, -0.454262, -0.198227,
-    1.000000, 1.000000,
-    -0.904839, -0.394136, -0.161006,
-    0.000000, 1.000000,
-    -0.912982, -0.399607, -0.082324,
-    0.500000, 0.133975,
-    -0.879345, -0.460882, -0.119755,
-    1.000000, 1.000000,
-    -0.852640, -0.444464, -0.274694,
-    0.000000, 1.000000,
-    -0.868534, -0.454262, -0.198227,
-    0.500000, 0.133975,
-    -0.827147, -0.511205, -0.233445,
-    1.000000, 1.000000,
-    -0.809017, -0.500000, -0.309017,
-    0.000000, 1.000000,
-    -0.852640, -0.444464, -0.274694,
-    0.500000, 0.133975,
-    -0.827147, -0.511205, -0.233445,
-    1.000000, 1.000000,
-    -0.852640, -0.444464, -0.274694,
-    0.000000, 1.000000,
-    -0.891007, -0.386187, -0.238677,
-    0.500000, 0.133975,
-    -0.868534, -0.454262, -0.198227,
-    1.000000, 1.000000,
-    -0.923880, -0.325530, -0.201189,
-    0.000000, 1.000000,
-    -0.935130, -0.332342, -0.122800,
-    0.500000, 0.133975,
-    -0.904839, -0.394136, -0.161006,
-    1.000000, 1.000000,
-    -0.891007, -0.386187, -0.238677,
-    0.000000, 1.000000,
-    -0.923880, -0.325530, -0.201189,
-    0.500000, 0.133975,
-    -0.904839, -0.394136, -0.161006,
-    1.000000, 1.000000,
-    -0.923880, -0.325530, -0.201189,
-    0.000000, 1.000000,
-    -0.951057, -0.262866, -0.162460,
-    0.500000, 0.133975,
-    -0.935130, -0.332342, -0.122800,
-    1.000000, 1.000000,
-    -0.991046, -0.133523, 0.000000,
-    0.000000, 1.000000,
-    -0.978852, -0.200368, 0.041251,
-    0.500000, 0.133975,
-    -0.978852, -0.200368, -0.041251,
-    1.000000, 1.000000,
-    -0.987688, -0.133071, -0.082242,
-    0.000000, 1.000000,
-    -0.991046, -0.133523, 0.000000,
-    0.500000, 0.133975,
-    -0.978852, -0.200368, -0.041251,
-    1.000000, 1.000000,
-    -0.991046, -0.133523, 0.000000,
-    0.000000, 1.000000,
-    -0.987688, -0.133071, 0.082242,
-    0.500000, 0.133975,
-    -0.978852, -0.200368, 0.041251,
-    1.000000, 1.000000,
-    -0.972370, -0.198580, -0.122729,
-    0.000000, 1.000000,
-    -0.978852, -0.200368, -0.041251,
-    0.500000, 0.133975,
-    -0.960655, -0.265518, -0.081501,
-    1.000000, 1.000000,
-    -0.951057, -0.262866, -0.162460,
-    0.000000, 1.000000,
-    -0.972370, -0.198580, -0.122729,
-    0.500000, 0.133975,
-    -0.960655, -0.265518, -0.081501,
-    1.000000, 1.000000,
-    -0.972370, -0.198580, -0.122729,
-    0.000000, 1.000000,
-    -0.987688, -0.133071, -0.082242,
-    0.500000, 0.133975,
-    -0.978852, -0.200368, -0.041251,
-    1.000000, 1.000000,
-    -0.996917, -0.066741, -0.041248,
-    0.000000, 1.000000,
-    -0.996917, -0.066741, 0.041248,
-    0.500000, 0.133975,
-    -0.991046, -0.133523, 0.000000,
-    1.000000, 1.000000,
-    -0.987688, -0.133071, -0.082242,
-    0.000000, 1.000000,
-    -0.996917, -0.066741, -0.041248,
-    0.500000, 0.133975,
-    -0.991046, -0.133523, 0.000000,
-    1.000000, 1.000000,
-    -0.996917, -0.066741, -0.041248,
-    0.000000, 1.000000,
-    -1.000000, 0.000000, 0.000000,
-    0.500000, 0.133975,
-    -0.996917, -0.066741, 0.041248,
-    1.000000, 1.000000,
-    -0.782786, -0.622292, 0.000000,
-    0.000000, 1.000000,
-    -0.743496, -0.667502, 0.040677,
-    0.500000, 0.133975,
-    -0.743496, -0.667502, -0.040677,
-    1.000000, 1.000000,
-    -0.780204, -0.620240, -0.081142,
-    0.000000, 1.000000,
-    -0.782786, -0.622292, 0.000000,
-    0.500000, 0.133975,
-    -0.743496, -0.667502, -0.040677,
-    1.000000, 1.000000,
-    -0.782786, -0.622292, 0.000000,
-    0.000000, 1.000000,
-    -0.780204, -0.620240, 0.081142,
-    0.500000, 0.133975,
-    -0.743496, -0.667502, 0.040677,
-    1.000000, 1.000000,
-    -0.738886, -0.662842, -0.121193,
-    0.000000, 1.000000,
-    -0.743496, -0.667502, -0.040677,
-    0.500000, 0.133975,
-    -0.700622, -0.708969, -0.080573,
-    1.000000, 1.000000,
-    -0.693780, -0.702046, -0.160622,
-    0.000000, 1.000000,
-    -0.738886, -0.662842, -0.121193,
-    0.500000, 0.133975,
-    -0.700622, -0.708969, -0.080573,
-    1.000000, 1.000000,
-    -0.738886, -0.662842, -0.121193,
-    0.000000, 1.000000,
-    -0.780204, -0.620240, -0.081142,
-    0.500000, 0.133975,
-    -0.743496, -0.667502, -0.040677,
-    1.000000, 1.000000,
-    -0.817523, -0.574458, -0.040675,
-    0.000000, 1.000000,
-    -0.817523, -0.574458, 0.040675,
-    0.500000, 0.133975,
-    -0.782786, -0.622292, 0.000000,
-    1.000000, 1.000000,
-    -0.780204, -0.620240, -0.081142,
-    0.000000, 1.000000,
-    -0.817523, -0.574458, -0.040675,
-    0.500000, 0.133975,
-    -0.782786, -0.622292, 0.000000,
-    1.000000, 1.000000,
-    -0.817523, -0.574458, -0.040675,
-    0.000000, 1.000000,
-    -0.850651, -0.525731, 0.000000,
-    0.500000, 0.133975,
-    -0.817523, -0.574458, 0.040675,
-    1.000000, 1.000000,
-    -0.660884, -0.749387, -0.040642,
-    0.000000, 1.000000,
-    -0.660884, -0.749387, 0.040642,
-    0.500000, 0.133975,
-    -0.617676, -0.786433, 0.000000,
-    1.000000, 1.000000,
-    -0.615642, -0.783843, -0.081086,
-    0.000000, 1.000000,
-    -0.660884, -0.749387, -0.040642,
-    0.500000, 0.133975,
-    -0.617676, -0.786433, 0.000000,
-    1.000000, 1.000000,
-    -0.660884, -0.749387, -0.040642,
-    0.000000, 1.000000,
-    -0.702907, -0.711282, 0.000000,
-    0.500000, 0.133975,
-    -0.660884, -0.749387, 0.040642,
-    1.000000, 1.000000,
-    -0.572056, -0.819207, -0.040640,
-    0.000000, 1.000000,
-    -0.617676, -0.786433, 0.000000,
-    0.500000, 0.133975,
-    -0.572056, -0.819207, 0.040640,
-    1.000000, 1.000000,
-    -0.525731, -0.850651, 0.000000,
-    0.000000, 1.000000,
-    -0.572056, -0.819207, -0.040640,
-    0.500000, 0.133975,
-    -0.572056, -0.819207, 0.040640,
-    1.000000, 1.000000,
-    -0.572056, -0.819207, -0.040640,
-    0.000000, 1.000000,
-    -0.615642, -0.783843, -0.081086,
-    0.500000, 0.133975,
-    -0.617676, -0.786433, 0.000000,
-    1.000000, 1.000000,
-    -0.656282, -0.744727, -0.121144,
-    0.000000, 1.000000,
-    -0.700622, -0.708969, -0.080573,
-    0.500000, 0.133975,
-    -0.660884, -0.749387, -0.040642,
-    1.000000, 1.000000,
-    -0.615642, -0.783843, -0.081086,
-    0.000000, 1.000000,
-    -0.656282, -0.744727, -0.121144,
-    0.500000, 0.133975,
-    -0.660884, -0.749387, -0.040642,
-    1.000000, 1.000000,
-    -0.656282, -0.744727, -0.121144,
-    0.000000, 1.000000,
-    -0.693780, -0.702046, -0.160622,
-    0.500000, 0.133975,
-    -0.700622, -0.708969, -0.080573,
-    1.000000, 1.000000,
-    -0.801504, -0.564513, -0.197274,
-    0.000000, 1.000000,
-    -0.812169, -0.571140, -0.119078,
-    0.500000, 0.133975,
-    -0.771841, -0.615456, -0.159613,
-    1.000000, 1.000000,
-    -0.758652, -0.606825, -0.237086,
-    0.000000, 1.000000,
-    -0.801504, -0.564513, -0.197274,
-    0.500000, 0.133975,
-    -0.771841, -0.615456, -0.159613,
-    1.000000, 1.000000,
-    -0.801504, -0.564513, -0.197274,
-    0.000000, 1.000000,
-    -0.840178, -0.519258, -0.156434,
-    0.500000, 0.133975,
-    -0.812169, -0.571140, -0.119078,
-    1.000000, 1.000000,
-    -0.727958, -0.656006, -0.199331,
-    0.000000, 1.000000,
-    -0.771841, -0.615456, -0.159613,
-    0.500000, 0.133975,
-    -0.738886, -0.662842, -0.121193,
-    1.000000, 1.000000,
-    -0.693780, -0.702046, -0.160622,
-    0.000000, 1.000000,
-    -0.727958, -0.656006, -0.199331,
-    0.500000, 0.133975,
-    -0.738886, -0.662842, -0.121193,
-    1.000000, 1.000000,
-    -0.727958, -0.656006, -0.199331,
-    0.000000, 1.000000,
-    -0.758652, -0.606825, -0.237086,
-    0.500000, 0.133975,
-    -0.771841, -0.615456, -0.159613,
-    1.000000, 1.000000,
-    -0.785715, -0.554740, -0.273707,
-    0.000000, 1.000000,
-    -0.827147, -0.511205, -0.233445,
-    0.500000, 0.133975,
-    -0.801504, -0.564513, -0.197274,
-    1.000000, 1.000000,
-    -0.758652, -0.606825, -0.237086,
-    0.000000, 1.000000,
-    -0.785715, -0.554740, -0.273707,
-    0.500000, 0.133975,
-    -0.801504, -0.564513, -0.197274,
-    1.000000, 1.000000,
-    -0.785715, -0.554740, -0.273707,
-    0.000000, 1.000000,
-    -0.809017, -0.500000, -0.309017,
-    0.500000, 0.133975,
-    -0.827147, -0.511205, -0.233445,
-    1.000000, 1.000000,
-    -0.947822, -0.132570, -0.289929,
-    0.000000, 1.000000,
-    -0.944433, -0.199094, -0.261550,
-    0.500000, 0.133975,
-    -0.922682, -0.198387, -0.330607,
-    1.000000, 1.000000,
-    -0.924305, -0.131655, -0.358229,
-    0.000000, 1.000000,
-    -0.947822, -0.132570, -0.289929,
-    0.500000, 0.133975,
-    -0.922682, -0.198387, -0.330607,
-    1.000000, 1.000000,
-    -0.947822, -0.132570, -0.289929,
-    0.000000, 1.000000,
-    -0.966393, -0.132792, -0.220117,
-    0.500000, 0.133975,
-    -0.944433, -0.199094, -0.261550,
-    1.000000, 1.000000,
-    -0.896401, -0.196412, -0.397351,
-    0.000000, 1.000000,
-    -0.922682, -0.198387, -0.330607,
-    0.500000, 0.133975,
-    -0.891742, -0.262661, -0.368518,
-    1.000000, 1.000000,
-    -0.862668, -0.259892, -0.433889,
-    0.000000, 1.000000,
-    -0.896401, -0.196412, -0.397351,
-    0.500000, 0.133975,
-    -0.891742, -0.262661, -0.368518,
-    1.000000, 1.000000,
-    -0.896401, -0.196412, -0.397351,
-    0.000000, 1.000000,
-    -0.924305, -0.131655, -0.358229,
-    0.500000, 0.133975,
-    -0.922682, -0.198387, -0.330607,
-    1.000000, 1.000000,
-    -0.946198, -0.066042, -0.316778,
-    0.000000, 1.000000,
-    -0.966643, -0.066567, -0.247326,
-    0.500000, 0.133975,
-    -0.947822, -0.132570, -0.289929,
-    1.000000, 1.000000,
-    -0.924305, -0.131655, -0.358229,
-    0.000000, 1.000000,
-    -0.946198, -0.066042, -0.316778,
-    0.500000, 0.133975,
-    -0.947822, -0.132570, -0.289929,
-    1.000000, 1.000000,
-    -0.946198, -0.066042, -0.316778,
-    0.000000, 1.000000,
-    -0.961938, 0.000000, -0.273267,
-    0.500000, 0.133975,
-    -0.966643, -0.066567, -0.247326,
-    1.000000, 1.000000,
-    -0.882837, -0.324864, -0.339209,
-    0.000000, 1.000000,
-    -0.905832, -0.325929, -0.270627,
-    0.500000, 0.133975,
-    -0.869725, -0.385906, -0.307659,
-    1.000000, 1.000000,
-    -0.843911, -0.383614, -0.375039,
-    0.000000, 1.000000,
-    -0.882837, -0.324864, -0.339209,
-    0.500000, 0.133975,
-    -0.869725, -0.385906, -0.307659,
-    1.000000, 1.000000,
-    -0.882837, -0.324864, -0.339209,
-    0.000000, 1.000000,
-    -0.916244, -0.264083, -0.301259,
-    0.500000, 0.133975,
-    -0.905832, -0.325929, -0.270627,
-    1.000000, 1.000000,
-    -0.828447, -0.442867, -0.342848,
-    0.000000, 1.000000,
-    -0.869725, -0.385906, -0.307659,
-    0.500000, 0.133975,
-    -0.852640, -0.444464, -0.274694,
-    1.000000, 1.000000,
-    -0.809017, -0.500000, -0.309017,
-    0.000000, 1.000000,
-    -0.828447, -0.442867, -0.342848,
-    0.500000, 0.133975,
-    -0.852640, -0.444464, -0.274694,
-    1.000000, 1.000000,
-    -0.828447, -0.442867, -0.342848,
-    0.000000, 1.000000,
-    -0.843911, -0.383614, -0.375039,
-    0.500000, 0.133975,
-    -0.869725, -0.385906, -0.307659,
-    1.000000, 1.000000,
-    -0.855337, -0.322525, -0.405434,
-    0.000000, 1.000000,
-    -0.891742, -0.262661, -0.368518,
-    0.500000, 0.133975,
-    -0.882837, -0.324864, -0.339209,
-    1.000000, 1.000000,
-    -0.843911, -0.383614, -0.375039,
-    0.000000, 1.000000,
-    -0.855337, -0.322525, -0.405434,
-    0.500000, 0.133975,
-    -0.882837, -0.324864, -0.339209,
-    1.000000, 1.000000,
-    -0.855337, -0.322525, -0.405434,
-    0.000000, 1.000000,
-    -0.862668, -0.259892, -0.433889,
-    0.500000, 0.133975,
-    -0.891742, -0.262661, -0.368518,
-    1.000000, 1.000000,
-    -0.892927, -0.065817, -0.445365,
-    0.000000, 1.000000,
-    -0.921919, -0.065988, -0.381722,
-    0.500000, 0.133975,
-    -0.896801, -0.131749, -0.422364,
-    1.000000, 1.000000,
-    -0.864929, -0.131200, -0.484442,
-    0.000000, 1.000000,
-    -0.892927, -0.065817, -0.445365,
-    0.500000, 0.133975,
-    -0.896801, -0.131749, -0.422364,
-    1.000000, 1.000000,
-    -0.892927, -0.065817, -0.445365,
-    0.000000, 1.000000,
-    -0.915043, 0.000000, -0.403355,
-    0.500000, 0.133975,
-    -0.921919, -0.065988, -0.381722,
-    1.000000, 1.000000,
-    -0.865871, -0.196015, -0.460267,
-    0.000000, 1.000000,
-    -0.896801, -0.131749, -0.422364,
-    0.500000, 0.133975,
-    -0.896401, -0.196412, -0.397351,
-    1.000000, 1.000000,
-    -0.862668, -0.259892, -0.433889,
-    0.000000, 1.000000,
-    -0.865871, -0.196015, -0.460267,
-    0.500000, 0.133975,
-    -0.896401, -0.196412, -0.397351,
-    1.000000, 1.000000,
-    -0.865871, -0.196015, -0.460267,
-    0.000000, 1.000000,
-    -0.864929, -0.131200, -0.484442,
-    0.500000, 0.133975,
-    -0.896801, -0.131749, -0.422364,
-    1.000000, 1.000000,
-    -0.859848, -0.065758, -0.506298,
-    0.000000, 1.000000,
-    -0.884965, 0.000000, -0.465658,
-    0.500000, 0.133975,
-    -0.892927, -0.065817, -0.445365,
-    1.000000, 1.000000,
-    -0.864929, -0.131200, -0.484442,
-    0.000000, 1.000000,
-    -0.859848, -0.065758, -0.506298,
-    0.500000, 0.133975,
-    -0.892927, -0.065817, -0.445365,
-    1.000000, 1.000000,
-    -0.859848, -0.065758, -0.506298,
-    0.000000, 1.000000,
-    -0.850651, 0.000000, -0.525731,
-    0.500000, 0.133975,
-    -0.884965, 0.000000, -0.465658,
-    1.000000, 1.000000,
-    0.996917, 0.066741, -0.041248,
-    0.000000, 1.000000,
-    1.000000, 0.000000, 0.000000,
-    0.500000, 0.133975,
-    0.996917, 0.066741, 0.041248,
-    1.000000, 1.000000,
-    0.946198, 0.066042, -0.316778,
-    0.000000, 1.000000,
-    0.961938, 0.000000, -0.273267,
-    0.500000, 0.133975,
-    0.966643, 0.066567, -0.247326,
-    1.000000, 1.000000,
-    0.892927, 0.065817, -0.445365,
-    0.000000, 1.000000,
-    0.915043, 0.000000, -0.403355,
-    0.500000, 0.133975,
-    0.921919, 0.065988, -0.381722,
-    1.000000, 1.000000,
-    0.859848, 0.065758, -0.506298,
-    0.000000, 1.000000,
-    0.884965, 0.000000, -0.465658,
-    0.500000, 0.133975,
-    0.892927, 0.065817, -0.445365,
-    1.000000, 1.000000,
-    0.859848, 0.065758, -0.506298,
-    0.000000, 1.000000,
-    0.850651, 0.000000, -0.525731,
-    0.500000, 0.133975,
-    0.884965, 0.000000, -0.465658,
-    1.000000, 1.000000,
-    0.941618, -0.334140, -0.041302,
-    0.000000, 1.000000,
-    0.916092, -0.400968, 0.000000,
-    0.500000, 0.133975,
-    0.941618, -0.334140, 0.041302,
-    1.000000, 1.000000,
-    0.963861, -0.266405, 0.000000,
-    0.000000, 1.000000,
-    0.941618, -0.334140, -0.041302,
-    0.500000, 0.133975,
-    0.941618, -0.334140, 0.041302,
-    1.000000, 1.000000,
-    0.941618, -0.334140, -0.041302,
-    0.000000, 1.000000,
-    0.912982, -0.399607, -0.082324,
-    0.500000, 0.133975,
-    0.916092, -0.400968, 0.000000,
-    1.000000, 1.000000,
-    0.960655, -0.265518, 0.081501,
-    0.000000, 1.000000,
-    0.941618, -0.334140, 0.041302,
-    0.500000, 0.133975,
-    0.935130, -0.332342, 0.122800,
-    1.000000, 1.000000,
-    0.951057, -0.262866, 0.162460,
-    0.000000, 1.000000,
-    0.960655, -0.265518, 0.081501,
-    0.500000, 0.133975,
-    0.935130, -0.332342, 0.122800,
-    1.000000, 1.000000,
-    0.960655, -0.265518, 0.081501,
-    0.000000, 1.000000,
-    0.963861, -0.266405, 0.000000,
-    0.500000, 0.133975,
-    0.941618, -0.334140, 0.041302,
-    1.000000, 1.000000,
-    0.960655, -0.265518, -0.081501,
-    0.000000, 1.000000,
-    0.935130, -0.332342, -0.122800,
-    0.500000, 0.133975,
-    0.941618, -0.334140, -0.041302,
-    1.000000, 1.000000,
-    0.963861, -0.266405, 0.000000,
-    0.000000, 1.000000,
-    0.960655, -0.265518, -0.081501,
-    0.500000, 0.133975,
-    0.941618, -0.334140, -0.041302,
-    1.000000, 1.000000,
-    0.960655, -0.265518, -0.081501,
-    0.000000, 1.000000,
-    0.951057, -0.262866, -0.162460,
-    0.500000, 0.133975,
-    0.935130, -0.332342, -0.122800,
-    1.000000, 1.000000,
-    0.904839, -0.394136, 0.161006,
-    0.000000, 1.000000,
-    0.879345, -0.460882, 0.119755,
-    0.500000, 0.133975,
-    0.868534, -0.454262, 0.198227,
-    1.000000, 1.000000,
-    0.891007, -0.386187, 0.238677,
-    0.000000, 1.000000,
-    0.904839, -0.394136, 0.161006,
-    0.500000, 0.133975,
-    0.868534, -0.454262, 0.198227,
-    1.000000, 1.000000,
-    0.904839, -0.394136, 0.161006,
-    0.000000, 1.000000,
-    0.912982, -0.399607, 0.082324,
-    0.500000, 0.133975,
-    0.879345, -0.460882, 0.119755,
-    1.000000, 1.000000,
-    0.852640, -0.444464, 0.274694,
-    0.000000, 1.000000,
-    0.868534, -0.454262, 0.198227,
-    0.500000, 0.133975,
-    0.827147, -0.511205, 0.233445,
-    1.000000, 1.000000,
-    0.809017, -0.500000, 0.309017,
-    0.000000, 1.000000,
-    0.852640, -0.444464, 0.274694,
-    0.500000, 0.133975,
-    0.827147, -0.511205, 0.233445,
-    1.000000, 1.000000,
-    0.852640, -0.444464, 0.274694,
-    0.000000, 1.000000,
-    0.891007, -0.386187, 0.238677,
-    0.500000, 0.133975,
-    0.868534, -0.454262, 0.198227,
-    1.000000, 1.000000,
-    0.923880, -0.325530, 0.201189,
-    0.000000, 1.000000,
-    0.935130, -0.332342, 0.122800,
-    0.500000, 0.133975,
-    0.904839, -0.394136, 0.161006,
-    1.000000, 1.000000,
-    0.891007, -0.386187, 0.238677,
-    0.000000, 1.000000,
-    0.923880, -0.325530, 0.201189,
-    0.500000, 0.133975,
-    0.904839, -0.394136, 0.161006,
-    1.000000, 1.000000,
-    0.923880, -0.325530, 0.201189,
-    0.000000, 1.000000,
-    0.951057, -0.262866, 0.162460,
-    0.500000, 0.133975,
-    0.935130, -0.332342, 0.122800,
-    1.000000, 1.000000,
-    0.991046, -0.133523, 0.000000,
-    0.000000, 1.000000,
-    0.978852, -0.200368, -0.041251,
-    0.500000, 0.133975,
-    0.978852, -0.200368, 0.041251,
-    1.000000, 1.000000,
-    0.987688, -0.133071, 0.082242,
-    0.000000, 1.000000,
-    0.991046, -0.133523, 0.000000,
-    0.500000, 0.133975,
-    0.978852, -0.200368, 0.041251,
-    1.000000, 1.000000,
-    0.991046, -0.133523, 0.000000,
-    0.000000, 1.000000,
-    0.987688, -0.133071, -0.082242,
-    0.500000, 0.133975,
-    0.978852, -0.200368, -0.041251,
-    1.000000, 1.000000,
-    0.972370, -0.198580, 0.122729,
-    0.000000, 1.000000,
-    0.978852, -0.200368, 0.041251,
-    0.500000, 0.133975,
-    0.960655, -0.265518, 0.081501,
-    1.000000, 1.000000,
-    0.951057, -0.262866, 0.162460,
-    0.000000, 1.000000,
-    0.972370, -0.198580, 0.122729,
-    0.500000, 0.133975,
-    0.960655, -0.265518, 0.081501,
-    1.000000, 1.000000,
-    0.972370, -0.198580, 0.122729,
-    0.000000, 1.000000,
-    0.987688, -0.133071, 0.082242,
-    0.500000, 0.133975,
-    0.978852, -0.200368, 0.041251,
-    1.000000, 1.000000,
-    0.996917, -0.066741, 0.041248,
-    0.000000, 1.000000,
-    0.996917, -0.066741, -0.041248,
-    0.500000, 0.133975,
-    0.991046, -0.133523, 0.000000,
-    1.000000, 1.000000,
-    0.987688, -0.133071, 0.082242,
-    0.000000, 1.000000,
-    0.996917, -0.066741, 0.041248,
-    0.500000, 0.133975,
-    0.991046, -0.133523, 0.000000,
-    1.000000, 1.000000,
-    0.996917, -0.066741, 0.041248,
-    0.000000, 1.000000,
-    1.000000, 0.000000, 0.000000,
-    0.500000, 0.133975,
-    0.996917, -0.066741, -0.041248,
-    1.000000, 1.000000,
-    0.782786, -0.622292, 0.000000,
-    0.000000, 1.000000,
-    0.743496, -0.667502, -0.040677,
-    0.500000, 0.133975,
-    0.743496, -0.667502, 0.040677,
-    1.000000, 1.000000,
-    0.780204, -0.620240, 0.081142,
-    0.000000, 1.000000,
-    0.782786, -0.622292, 0.000000,
-    0.500000, 0.133975,
-    0.743496, -0.667502, 0.040677,
-    1.000000, 1.000000,
-    0.782786, -0.622292, 0.000000,
-    0.000000, 1.000000,
-    0.780204, -0.620240, -0.081142,
-    0.500000, 0.133975,
-    0.743496, -0.667502, -0.040677,
-    1.000000, 1.000000,
-    0.738886, -0.662842, 0.121193,
-    0.000000, 1.000000,
-    0.743496, -0.667502, 0.040677,
-    0.500000, 0.133975,
-    0.700622, -0.708969, 0.080573,
-    1.000000, 1.000000,
-    0.693780, -0.702046, 0.160622,
-    0.000000, 1.000000,
-    0.738886, -0.662842, 0.121193,
-    0.500000, 0.133975,
-    0.700622, -0.708969, 0.080573,
-    1.000000, 1.000000,
-    0.738886, -0.662842, 0.121193,
-    0.000000, 1.000000,
-    0.780204, -0.620240, 0.081142,
-    0.500000, 0.133975,
-    0.743496, -0.667502, 0.040677,
-    1.000000, 1.000000,
-    0.817523, -0.574458, 0.040675,
-    0.000000, 1.000000,
-    0.817523, -0.574458, -0.040675,
-    0.500000, 0.133975,
-    0.782786, -0.622292, 0.000000,
-    1.000000, 1.000000,
-    0.780204, -0.620240, 0.081142,
-    0.000000, 1.000000,
-    0.817523, -0.574458, 0.040675,
-    0.500000, 0.133975,
-    0.782786, -0.622292, 0.000000,
-    1.000000, 1.000000,
-    0.817523, -0.574458, 0.040675,
-    0.000000, 1.000000,
-    0.850651, -0.525731, 0.000000,
-    0.500000, 0.133975,
-    0.817523, -0.574458, -0.040675,
-    1.000000, 1.000000,
-    0.660884, -0.749387, 0.040642,
-    0.000000, 1.000000,
-    0.660884, -0.749387, -0.040642,
-    0.500000, 0.133975,
-    0.617676, -0.786433, 0.000000,
-    1.000000, 1.000000,
-    0.615642, -0.783843, 0.081086,
-    0.000000, 1.000000,
-    0.660884, -0.749387, 0.040642,
-    0.500000, 0.133975,
-    0.617676, -0.786433, 0.000000,
-    1.000000, 1.000000,
-    0.660884, -0.749387, 0.040642,
-    0.000000, 1.000000,
-    0.702907, -0.711282, 0.000000,
-    0.500000, 0.133975,
-    0.660884, -0.749387, -0.040642,
-    1.000000, 1.000000,
-    0.572056, -0.819207, 0.040640,
-    0.000000, 1.000000,
-    0.617676, -0.786433, 0.000000,
-    0.500000, 0.133975,
-    0.572056, -0.819207, -0.040640,
-    1.000000, 1.000000,
-    0.525731, -0.850651, 0.000000,
-    0.000000, 1.000000,
-    0.572056, -0.819207, 0.040640,
-    0.500000, 0.133975,
-    0.572056, -0.819207, -0.040640,
-    1.000000, 1.000000,
-    0.572056, -0.819207, 0.040640,
-    0.000000, 1.000000,
-    0.615642, -0.783843, 0.081086,
-    0.500000, 0.133975,
-    0.617676, -0.786433, 0.000000,
-    1.000000, 1.000000,
-    0.656282, -0.744727, 0.121144,
-    0.000000, 1.000000,
-    0.700622, -0.708969, 0.080573,
-    0.500000, 0.133975,
-    0.660884, -0.749387, 0.040642,
-    1.000000, 1.000000,
-    0.615642, -0.783843, 0.081086,
-    0.000000, 1.000000,
-    0.656282, -0.744727, 0.121144,
-    0.500000, 0.133975,
-    0.660884, -0.749387, 0.040642,
-    1.000000, 1.000000,
-    0.656282, -0.744727, 0.121144,
-    0.000000, 1.000000,
-    0.693780, -0.702046, 0.160622,
-    0.500000, 0.133975,
-    0.700622, -0.708969, 0.080573,
-    1.000000, 1.000000,
-    0.801504, -0.564513, 0.197274,
-    0.000000, 1.000000,
-    0.812169, -0.571140, 0.119078,
-    0.500000, 0.133975,
-    0.771841, -0.615456, 0.159613,
-    1.000000, 1.000000,
-    0.758652, -0.606825, 0.237086,
-    0.000000, 1.000000,
-    0.801504, -0.564513, 0.197274,
-    0.500000, 0.133975,
-    0.771841, -0.615456, 0.159613,
-    1.000000, 1.000000,
-    0.801504, -0.564513, 0.197274,
-    0.000000, 1.000000,
-    0.840178, -0.519258, 0.156434,
-    0.500000, 0.133975,
-    0.812169, -0.571140, 0.119078,
-    1.000000, 1.000000,
-    0.727958, -0.656006, 0.199331,
-    0.000000, 1.000000,
-    0.771841, -0.615456, 0.159613,
-    0.500000, 0.133975,
-    0.738886, -0.662842, 0.121193,
-    1.000000, 1.000000,
-    0.693780, -0.702046, 0.160622,
-    0.000000, 1.000000,
-    0.727958, -0.656006, 0.199331,
-    0.500000, 0.133975,
-    0.738886, -0.662842, 0.121193,
-    1.000000, 1.000000,
-    0.727958, -0.656006, 0.199331,
-    0.000000, 1.000000,
-    0.758652, -0.606825, 0.237086,
-    0.500000, 0.133975,
-    0.771841, -0.615456, 0.159613,
-    1.000000, 1.000000,
-    0.785715, -0.554740, 0.273707,
-    0.000000, 1.000000,
-    0.827147, -0.511205, 0.233445,
-    0.500000, 0.133975,
-    0.801504, -0.564513, 0.197274,
-    1.000000, 1.000000,
-    0.758652, -0.606825, 0.237086,
-    0.000000, 1.000000,
-    0.785715, -0.554740, 0.273707,
-    0.500000, 0.133975,
-    0.801504, -0.564513, 0.197274,
-    1.000000, 1.000000,
-    0.785715, -0.554740, 0.273707,
-    0.000000, 1.000000,
-    0.809017, -0.500000, 0.309017,
-    0.500000, 0.133975,
-    0.827147, -0.511205, 0.233445,
-    1.000000, 1.000000,
-    0.947822, -0.132570, 0.289929,
-    0.000000, 1.000000,
-    0.944433, -0.199094, 0.261550,
-    0.500000, 0.133975,
-    0.922682, -0.198387, 0.330607,
-    1.000000, 1.000000,
-    0.924305, -0.131655, 0.358229,
-    0.000000, 1.000000,
-    0.947822, -0.132570, 0.289929,
-    0.500000, 0.133975,
-    0.922682, -0.198387, 0.330607,
-    1.000000, 1.000000,
-    0.947822, -0.132570, 0.289929,
-    0.000000, 1.000000,
-    0.966393, -0.132792, 0.220117,
-    0.500000, 0.133975,
-    0.944433, -0.199094, 0.261550,
-    1.000000, 1.000000,
-    0.896401, -0.196412, 0.397351,
-    0.000000, 1.000000,
-    0.922682, -0.198387, 0.330607,
-    0.500000, 0.133975,
-    0.891742, -0.262661, 0.368518,
-    1.000000, 1.000000,
-    0.862668, -0.259892, 0.433889,
-    0.000000, 1.000000,
-    0.896401, -0.196412, 0.397351,
-    0.500000, 0.133975,
-    0.891742, -0.262661, 0.368518,
-    1.000000, 1.000000,
-    0.896401, -0.196412, 0.397351,
-    0.000000, 1.000000,
-    0.924305, -0.131655, 0.358229,
-    0.500000, 0.133975,
-    0.922682, -0.198387, 0.330607,
-    1.000000, 1.000000,
-    0.946198, -0.066042, 0.316778,
-    0.000000, 1.000000,
-    0.966643, -0.066567, 0.247326,
-    0.500000, 0.133975,
-    0.947822, -0.132570, 0.289929,
-    1.000000, 1.000000,
-    0.924305, -0.131655, 0.358229,
-    0.000000, 1.000000,
-    0.946198, -0.066042, 0.316778,
-    0.500000, 0.133975,
-    0.947822, -0.132570, 0.289929,
-    1.000000, 1.000000,
-    0.946198, -0.066042, 0.316778,
-    0.000000, 1.000000,
-    0.961938, 0.000000, 0.273267,
-    0.500000, 0.133975,
-    0.966643, -0.066567, 0.247326,
-    1.000000, 1.000000,
-    0.882837, -0.324864, 0.339209,
-    0.000000, 1.000000,
-    0.905832, -0.325929, 0.270627,
-    0.500000, 0.133975,
-    0.869725, -0.385906, 0.307659,
-    1.000000, 1.000000,
-    0.843911, -0.383614, 0.375039,
-    0.000000, 1.000000,
-    0.882837, -0.324864, 0.339209,
-    0.500000, 0.133975,
-    0.869725, -0.385906, 0.307659,
-    1.000000, 1.000000,
-    0.882837, -0.324864, 0.339209,
-    0.000000, 1.000000,
-    0.916244, -0.264083, 0.301259,
-    0.500000, 0.133975,
-    0.905832, -0.325929, 0.270627,
-    1.000000, 1.000000,
-    0.828447, -0.442867, 0.342848,
-    0.000000, 1.000000,
-    0.869725, -0.385906, 0.307659,
-    0.500000, 0.133975,
-    0.852640, -0.444464, 0.274694,
-    1.000000, 1.000000,
-    0.809017, -0.500000, 0.309017,
-    0.000000, 1.000000,
-    0.828447, -0.442867, 0.342848,
-    0.500000, 0.133975,
-    0.852640, -0.444464, 0.274694,
-    1.000000, 1.000000,
-    0.828447, -0.442867, 0.342848,
-    0.000000, 1.000000,
-    0.843911, -0.383614, 0.375039,
-    0.500000, 0.133975,
-    0.869725, -0.385906, 0.307659,
-    1.000000, 1.000000,
-    0.855337, -0.322525, 0.405434,
-    0.000000, 1.000000,
-    0.891742, -0.262661, 0.368518,
-    0.500000, 0.133975,
-    0.882837, -0.324864, 0.339209,
-    1.000000, 1.000000,
-    0.843911, -0.383614, 0.375039,
-    0.000000, 1.000000,
-    0.855337, -0.322525, 0.405434,
-    0.500000, 0.133975,
-    0.882837, -0.324864, 0.339209,
-    1.000000, 1.000000,
-    0.855337, -0.322525, 0.405434,
-    0.000000, 1.000000,
-    0.862668, -0.259892, 0.433889,
-    0.500000, 0.133975,
-    0.891742, -0.262661, 0.368518,
-    1.000000, 1.000000,
-    0.892927, -0.065817, 0.445365,
-    0.000000, 1.000000,
-    0.921919, -0.065988, 0.381722,
-    0.500000, 0.133975,
-    0.896801, -0.131749, 0.422364,
-    1.000000, 1.000000,
-    0.864929, -0.131200, 0.484442,
-    0.000000, 1.000000,
-    0.892927, -0.065817, 0.445365,
-    0.500000, 0.133975,
-    0.896801, -0.131749, 0.422364,
-    1.000000, 1.000000,
-    0.892927, -0.065817, 0.445365,
-    0.000000, 1.000000,
-    0.915043, 0.000000, 0.403355,
-    0.500000, 0.133975,
-    0.921919, -0.065988, 0.381722,
-    1.000000, 1.000000,
-    0.865871, -0.196015, 0.460267,
-    0.000000, 1.000000,
-    0.896801, -0.131749, 0.422364,
-    0.500000, 0.133975,
-    0.896401, -0.196412, 0.397351,
-    1.000000, 1.000000,
-    0.862668, -0.259892, 0.433889,
-    0.000000, 1.000000,
-    0.865871, -0.196015, 0.460267,
-    0.500000, 0.133975,
-    0.896401, -0.196412, 0.397351,
-    1.000000, 1.000000,
-    0.865871, -0.196015, 0.460267,
-    0.000000, 1.000000,
-    0.864929, -0.131200, 0.484442,
-    0.500000, 0.133975,
-    0.896801, -0.131749, 0.422364,
-    1.000000, 1.000000,
-    0.859848, -0.065758, 0.506298,
-    0.000000, 1.000000,
-    0.884965, 0.000000, 0.465658,
-    0.500000, 0.133975,
-    0.892927, -0.065817, 0.445365,
-    1.000000, 1.000000,
-    0.864929, -0.131200, 0.484442,
-    0.000000, 1.000000,
-    0.859848, -0.065758, 0.506298,
-    0.500000, 0.133975,
-    0.892927, -0.065817, 0.445365,
-    1.000000, 1.000000,
-    0.859848, -0.065758, 0.506298,
-    0.000000, 1.000000,
-    0.850651, 0.000000, 0.525731,
-    0.500000, 0.133975,
-    0.884965, 0.000000, 0.465658,
-    1.000000, 1.000000,
-    -0.819207, 0.040640, 0.572056,
-    0.000000, 1.000000,
-    -0.859848, 0.065758, 0.506298,
-    0.500000, 0.133975,
-    -0.827110, 0.106494, 0.551859,
-    1.000000, 1.000000,
-    -0.783843, 0.081086, 0.615642,
-    0.000000, 1.000000,
-    -0.819207, 0.040640, 0.572056,
-    0.500000, 0.133975,
-    -0.827110, 0.106494, 0.551859,
-    1.000000, 1.000000,
-    -0.819207, 0.040640, 0.572056,
-    0.000000, 1.000000,
-    -0.850651, 0.000000, 0.525731,
-    0.500000, 0.133975,
-    -0.859848, 0.065758, 0.506298,
-    1.000000, 1.000000,
-    0.819207, 0.040640, -0.572056,
-    0.000000, 1.000000,
-    0.859848, 0.065758, -0.506298,
-    0.500000, 0.133975,
-    0.827110, 0.106494, -0.551859,
-    1.000000, 1.000000,
-    0.783843, 0.081086, -0.615642,
-    0.000000, 1.000000,
-    0.819207, 0.040640, -0.572056,
-    0.500000, 0.133975,
-    0.827110, 0.106494, -0.551859,
-    1.000000, 1.000000,
-    0.819207, 0.040640, -0.572056,
-    0.000000, 1.000000,
-    0.850651, 0.000000, -0.525731,
-    0.500000, 0.133975,
-    0.859848, 0.065758, -0.506298,
-    1.000000, 1.000000,
-    -0.581952, -0.607478, -0.540650,
-    0.000000, 1.000000,
-    -0.540650, -0.581952, -0.607478,
-    0.500000, 0.133975,
-    -0.607478, -0.540650, -0.581952,
-    1.000000, 1.000000,
-    -0.646578, -0.564254, -0.513375,
-    0.000000, 1.000000,
-    -0.581952, -0.607478, -0.540650,
-    0.500000, 0.133975,
-    -0.607478, -0.540650, -0.581952,
-    1.000000, 1.000000,
-    -0.581952, -0.607478, -0.540650,
-    0.000000, 1.000000,
-    -0.513375, -0.646578, -0.564254,
-    0.500000, 0.133975,
-    -0.540650, -0.581952, -0.607478,
-    1.000000, 1.000000,
-    -0.669612, -0.496441, -0.552418,
-    0.000000, 1.000000,
-    -0.607478, -0.540650, -0.581952,
-    0.500000, 0.133975,
-    -0.628313, -0.470917, -0.619242,
-    1.000000, 1.000000,
-    -0.688191, -0.425325, -0.587785,
-    0.000000, 1.000000,
-    -0.669612, -0.496441, -0.552418,
-    0.500000, 0.133975,
-    -0.628313, -0.470917, -0.619242,
-    1.000000, 1.000000,
-    -0.669612, -0.496441, -0.552418,
-    0.000000, 1.000000,
-    -0.646578, -0.564254, -0.513375,
-    0.500000, 0.133975,
-    -0.607478, -0.540650, -0.581952,
-    1.000000, 1.000000,
-    -0.619242, -0.628313, -0.470917,
-    0.000000, 1.000000,
-    -0.552418, -0.669612, -0.496441,
-    0.500000, 0.133975,
-    -0.581952, -0.607478, -0.540650,
-    1.000000, 1.000000,
-    -0.646578, -0.564254, -0.513375,
-    0.000000, 1.000000,
-    -0.619242, -0.628313, -0.470917,
-    0.500000, 0.133975,
-    -0.581952, -0.607478, -0.540650,
-    1.000000, 1.000000,
-    -0.619242, -0.628313, -0.470917,
-    0.000000, 1.000000,
-    -0.587785, -0.688191, -0.425325,
-    0.500000, 0.133975,
-    -0.552418, -0.669612, -0.496441,
-    1.000000, 1.000000,
-    -0.584716, -0.443957, -0.678977,
-    0.000000, 1.000000,
-    -0.517970, -0.485208, -0.704471,
-    0.500000, 0.133975,
-    -0.536784, -0.414273, -0.735011,
-    1.000000, 1.000000,
-    -0.601501, -0.371748, -0.707107,
-    0.000000, 1.000000,
-    -0.584716, -0.443957, -0.678977,
-    0.500000, 0.133975,
-    -0.536784, -0.414273, -0.735011,
-    1.000000, 1.000000,
-    -0.584716, -0.443957, -0.678977,
-    0.000000, 1.000000,
-    -0.564254, -0.513375, -0.646578,
-    0.500000, 0.133975,
-    -0.517970, -0.485208, -0.704471,
-    1.000000, 1.000000,
-    -0.552454, -0.341435, -0.760406,
-    0.000000, 1.000000,
-    -0.536784, -0.414273, -0.735011,
-    0.500000, 0.133975,
-    -0.485712, -0.382683, -0.785899,
-    1.000000, 1.000000,
-    -0.500000, -0.309017, -0.809017,
-    0.000000, 1.000000,
-    -0.552454, -0.341435, -0.760406,
-    0.500000, 0.133975,
-    -0.485712, -0.382683, -0.785899,
-    1.000000, 1.000000,
-    -0.552454, -0.341435, -0.760406,
-    0.000000, 1.000000,
-    -0.601501, -0.371748, -0.707107,
-    0.500000, 0.133975,
-    -0.536784, -0.414273, -0.735011,
-    1.000000, 1.000000,
-    -0.646840, -0.399769, -0.649448,
-    0.000000, 1.000000,
-    -0.628313, -0.470917, -0.619242,
-    0.500000, 0.133975,
-    -0.584716, -0.443957, -0.678977,
-    1.000000, 1.000000,
-    -0.601501, -0.371748, -0.707107,
-    0.000000, 1.000000,
-    -0.646840, -0.399769, -0.649448,
-    0.500000, 0.133975,
-    -0.584716, -0.443957, -0.678977,
-    1.000000, 1.000000,
-    -0.646840, -0.399769, -0.649448,
-    0.000000, 1.000000,
-    -0.688191, -0.425325, -0.587785,
-    0.500000, 0.133975,
-    -0.628313, -0.470917, -0.619242,
-    1.000000, 1.000000,
-    -0.735011, -0.536784, -0.414273,
-    0.000000, 1.000000,
-    -0.678977, -0.584716, -0.443957,
-    0.500000, 0.133975,
-    -0.704471, -0.517970, -0.485208,
-    1.000000, 1.000000,
-    -0.757935, -0.468430, -0.453990,
-    0.000000, 1.000000,
-    -0.735011, -0.536784, -0.414273,
-    0.500000, 0.133975,
-    -0.704471, -0.517970, -0.485208,
-    1.000000, 1.000000,
-    -0.735011, -0.536784, -0.414273,
-    0.000000, 1.000000,
-    -0.707107, -0.601501, -0.371748,
-    0.500000, 0.133975,
-    -0.678977, -0.584716, -0.443957,
-    1.000000, 1.000000,
-    -0.725299, -0.448259, -0.522499,
-    0.000000, 1.000000,
-    -0.704471, -0.517970, -0.485208,
-    0.500000, 0.133975,
-    -0.669612, -0.496441, -0.552418,
-    1.000000, 1.000000,
-    -0.688191, -0.425325, -0.587785,
-    0.000000, 1.000000,
-    -0.725299, -0.448259, -0.522499,
-    0.500000, 0.133975,
-    -0.669612, -0.496441, -0.552418,
-    1.000000, 1.000000,
-    -0.725299, -0.448259, -0.522499,
-    0.000000, 1.000000,
-    -0.757935, -0.468430, -0.453990,
-    0.500000, 0.133975,
-    -0.704471, -0.517970, -0.485208,
-    1.000000, 1.000000,
-    -0.785899, -0.485712, -0.382683,
-    0.000000, 1.000000,
-    -0.760406, -0.552454, -0.341435,
-    0.500000, 0.133975,
-    -0.735011, -0.536784, -0.414273,
-    1.000000, 1.000000,
-    -0.757935, -0.468430, -0.453990,
-    0.000000, 1.000000,
-    -0.785899, -0.485712, -0.382683,
-    0.500000, 0.133975,
-    -0.735011, -0.536784, -0.414273,
-    1.000000, 1.000000,
-    -0.785899, -0.485712, -0.382683,
-    0.000000, 1.000000,
-    -0.809017, -0.500000, -0.309017,
-    0.500000, 0.133975,
-    -0.760406, -0.552454, -0.341435,
-    1.000000, 1.000000,
-    -0.322141, -0.583691, -0.745338,
-    0.000000, 1.000000,
-    -0.255180, -0.610926, -0.749435,
-    0.500000, 0.133975,
-    -0.280319, -0.545109, -0.790112,
-    1.000000, 1.000000,
-    -0.346153, -0.516122, -0.783452,
-    0.000000, 1.000000,
-    -0.322141, -0.583691, -0.745338,
-    0.500000, 0.133975,
-    -0.280319, -0.545109, -0.790112,
-    1.000000, 1.000000,
-    -0.322141, -0.583691, -0.745338,
-    0.000000, 1.000000,
-    -0.296005, -0.647412, -0.702310,
-    0.500000, 0.133975,
-    -0.255180, -0.610926, -0.749435,
-    1.000000, 1.000000,
-    -0.303801, -0.476226, -0.825175,
-    0.000000, 1.000000,
-    -0.280319, -0.545109, -0.790112,
-    0.500000, 0.133975,
-    -0.237229, -0.504209, -0.830359,
-    1.000000, 1.000000,
-    -0.259892, -0.433889, -0.862668,
-    0.000000, 1.000000,
-    -0.303801, -0.476226, -0.825175,
-    0.500000, 0.133975,
-    -0.237229, -0.504209, -0.830359,
-    1.000000, 1.000000,
-    -0.303801, -0.476226, -0.825175,
-    0.000000, 1.000000,
-    -0.346153, -0.516122, -0.783452,
-    0.500000, 0.133975,
-    -0.280319, -0.545109, -0.790112,
-    1.000000, 1.000000,
-    -0.386730, -0.553372, -0.737712,
-    0.000000, 1.000000,
-    -0.361592, -0.619186, -0.697037,
-    0.500000, 0.133975,
-    -0.322141, -0.583691, -0.745338,
-    1.000000, 1.000000,
-    -0.346153, -0.516122, -0.783452,
-    0.000000, 1.000000,
-    -0.386730, -0.553372, -0.737712,
-    0.500000, 0.133975,
-    -0.322141, -0.583691, -0.745338,
-    1.000000, 1.000000,
-    -0.386730, -0.553372, -0.737712,
-    0.000000, 1.000000,
-    -0.425325, -0.587785, -0.688191,
-    0.500000, 0.133975,
-    -0.361592, -0.619186, -0.697037,
-    1.000000, 1.000000,
-    -0.172532, -0.529135, -0.830812,
-    0.000000, 1.000000,
-    -0.147414, -0.594895, -0.790170,
-    0.500000, 0.133975,
-    -0.106494, -0.551859, -0.827110,
-    1.000000, 1.000000,
-    -0.131200, -0.484442, -0.864929,
-    0.000000, 1.000000,
-    -0.172532, -0.529135, -0.830812,
-    0.500000, 0.133975,
-    -0.106494, -0.551859, -0.827110,
-    1.000000, 1.000000,
-    -0.172532, -0.529135, -0.830812,
-    0.000000, 1.000000,
-    -0.213023, -0.571252, -0.792649,
-    0.500000, 0.133975,
-    -0.147414, -0.594895, -0.790170,
-    1.000000, 1.000000,
-    -0.065758, -0.506298, -0.859848,
-    0.000000, 1.000000,
-    -0.106494, -0.551859, -0.827110,
-    0.500000, 0.133975,
-    -0.040640, -0.572056, -0.819207,
-    1.000000, 1.000000,
-    0.000000, -0.525731, -0.850651,
-    0.000000, 1.000000,
-    -0.065758, -0.506298, -0.859848,
-    0.500000, 0.133975,
-    -0.040640, -0.572056, -0.819207,
-    1.000000, 1.000000,
-    -0.065758, -0.506298, -0.859848,
-    0.000000, 1.000000,
-    -0.131200, -0.484442, -0.864929,
-    0.500000, 0.133975,
-    -0.106494, -0.551859, -0.827110,
-    1.000000, 1.000000,
-    -0.196015, -0.460267, -0.865871,
-    0.000000, 1.000000,
-    -0.237229, -0.504209, -0.830359,
-    0.500000, 0.133975,
-    -0.172532, -0.529135, -0.830812,
-    1.000000, 1.000000,
-    -0.131200, -0.484442, -0.864929,
-    0.000000, 1.000000,
-    -0.196015, -0.460267, -0.865871,
-    0.500000, 0.133975,
-    -0.172532, -0.529135, -0.830812,
-    1.000000, 1.000000,
-    -0.196015, -0.460267, -0.865871,
-    0.000000, 1.000000,
-    -0.259892, -0.433889, -0.862668,
-    0.500000, 0.133975,
-    -0.237229, -0.504209, -0.830359,
-    1.000000, 1.000000,
-    -0.427135, -0.415597, -0.803016,
-    0.000000, 1.000000,
-    -0.408286, -0.486240, -0.772575,
-    0.500000, 0.133975,
-    -0.366027, -0.446977, -0.816233,
-    1.000000, 1.000000,
-    -0.383614, -0.375039, -0.843911,
-    0.000000, 1.000000,
-    -0.427135, -0.415597, -0.803016,
-    0.500000, 0.133975,
-    -0.366027, -0.446977, -0.816233,
-    1.000000, 1.000000,
-    -0.427135, -0.415597, -0.803016,
-    0.000000, 1.000000,
-    -0.468430, -0.453990, -0.757935,
-    0.500000, 0.133975,
-    -0.408286, -0.486240, -0.772575,
-    1.000000, 1.000000,
-    -0.322525, -0.405434, -0.855337,
-    0.000000, 1.000000,
-    -0.366027, -0.446977, -0.816233,
-    0.500000, 0.133975,
-    -0.303801, -0.476226, -0.825175,
-    1.000000, 1.000000,
-    -0.259892, -0.433889, -0.862668,
-    0.000000, 1.000000,
-    -0.322525, -0.405434, -0.855337,
-    0.500000, 0.133975,
-    -0.303801, -0.476226, -0.825175,
-    1.000000, 1.000000,
-    -0.322525, -0.405434, -0.855337,
-    0.000000, 1.000000,
-    -0.383614, -0.375039, -0.843911,
-    0.500000, 0.133975,
-    -0.366027, -0.446977, -0.816233,
-    1.000000, 1.000000,
-    -0.442867, -0.342848, -0.828447,
-    0.000000, 1.000000,
-    -0.485712, -0.382683, -0.785899,
-    0.500000, 0.133975,
-    -0.427135, -0.415597, -0.803016,
-    1.000000, 1.000000,
-    -0.383614, -0.375039, -0.843911,
-    0.000000, 1.000000,
-    -0.442867, -0.342848, -0.828447,
-    0.500000, 0.133975,
-    -0.427135, -0.415597, -0.803016,
-    1.000000, 1.000000,
-    -0.442867, -0.342848, -0.828447,
-    0.000000, 1.000000,
-    -0.500000, -0.309017, -0.809017,
-    0.500000, 0.133975,
-    -0.485712, -0.382683, -0.785899,
-    1.000000, 1.000000,
-    -0.790112, -0.280319, -0.545109,
-    0.000000, 1.000000,
-    -0.745338, -0.322141, -0.583691,
-    0.500000, 0.133975,
-    -0.749435, -0.255180, -0.610926,
-    1.000000, 1.000000,
-    -0.792649, -0.213023, -0.571252,
-    0.000000, 1.000000,
-    -0.790112, -0.280319, -0.545109,
-    0.500000, 0.133975,
-    -0.749435, -0.255180, -0.610926,
-    1.000000, 1.000000,
-    -0.790112, -0.280319, -0.545109,
-    0.000000, 1.000000,
-    -0.783452, -0.346153, -0.516122,
-    0.500000, 0.133975,
-    -0.745338, -0.322141, -0.583691,
-    1.000000, 1.000000,
-    -0.749786, -0.187432, -0.634579,
-    0.000000, 1.000000,
-    -0.749435, -0.255180, -0.610926,
-    0.500000, 0.133975,
-    -0.703983, -0.228900, -0.672319,
-    1.000000, 1.000000,
-    -0.702046, -0.160622, -0.693780,
-    0.000000, 1.000000,
-    -0.749786, -0.187432, -0.634579,
-    0.500000, 0.133975,
-    -0.703983, -0.228900, -0.672319,
-    1.000000, 1.000000,
-    -0.749786, -0.187432, -0.634579,
-    0.000000, 1.000000,
-    -0.792649, -0.213023, -0.571252,
-    0.500000, 0.133975,
-    -0.749435, -0.255180, -0.610926,
-    1.000000, 1.000000,
-    -0.830359, -0.237229, -0.504209,
-    0.000000, 1.000000,
-    -0.825175, -0.303801, -0.476226,
-    0.500000, 0.133975,
-    -0.790112, -0.280319, -0.545109,
-    1.000000, 1.000000,
-    -0.792649, -0.213023, -0.571252,
-    0.000000, 1.000000,
-    -0.830359, -0.237229, -0.504209,
-    0.500000, 0.133975,
-    -0.790112, -0.280319, -0.545109,
-    1.000000, 1.000000,
-    -0.830359, -0.237229, -0.504209,
-    0.000000, 1.000000,
-    -0.862668, -0.259892, -0.433889,
-    0.500000, 0.133975,
-    -0.825175, -0.303801, -0.476226,
-    1.000000, 1.000000,
-    -0.656620, -0.267381, -0.705236,
-    0.000000, 1.000000,
-    -0.653497, -0.334692, -0.678913,
-    0.500000, 0.133975,
-    -0.605741, -0.305212, -0.734794,
-    1.000000, 1.000000,
-    -0.606825, -0.237086, -0.758652,
-    0.000000, 1.000000,
-    -0.656620, -0.267381, -0.705236,
-    0.500000, 0.133975,
-    -0.605741, -0.305212, -0.734794,
-    1.000000, 1.000000,
-    -0.656620, -0.267381, -0.705236,
-    0.000000, 1.000000,
-    -0.702310, -0.296005, -0.647412,
-    0.500000, 0.133975,
-    -0.653497, -0.334692, -0.678913,
-    1.000000, 1.000000,
-    -0.554740, -0.273707, -0.785715,
-    0.000000, 1.000000,
-    -0.605741, -0.305212, -0.734794,
-    0.500000, 0.133975,
-    -0.552454, -0.341435, -0.760406,
-    1.000000, 1.000000,
-    -0.500000, -0.309017, -0.809017,
-    0.000000, 1.000000,
-    -0.554740, -0.273707, -0.785715,
-    0.500000, 0.133975,
-    -0.552454, -0.341435, -0.760406,
-    1.000000, 1.000000,
-    -0.554740, -0.273707, -0.785715,
-    0.000000, 1.000000,
-    -0.606825, -0.237086, -0.758652,
-    0.500000, 0.133975,
-    -0.605741, -0.305212, -0.734794,
-    1.000000, 1.000000,
-    -0.656006, -0.199331, -0.727958,
-    0.000000, 1.000000,
-    -0.703983, -0.228900, -0.672319,
-    0.500000, 0.133975,
-    -0.656620, -0.267381, -0.705236,
-    1.000000, 1.000000,
-    -0.606825, -0.237086, -0.758652,
-    0.000000, 1.000000,
-    -0.656006, -0.199331, -0.727958,
-    0.500000, 0.133975,
-    -0.656620, -0.267381, -0.705236,
-    1.000000, 1.000000,
-    -0.656006, -0.199331, -0.727958,
-    0.000000, 1.000000,
-    -0.702046, -0.160622, -0.693780,
-    0.500000, 0.133975,
-    -0.703983, -0.228900, -0.672319,
-    1.000000, 1.000000,
-    -0.827110, -0.106494, -0.551859,
-    0.000000, 1.000000,
-    -0.830812, -0.172532, -0.529135,
-    0.500000, 0.133975,
-    -0.790170, -0.147414, -0.594895,
-    1.000000, 1.000000,
-    -0.783843, -0.081086, -0.615642,
-    0.000000, 1.000000,
-    -0.827110, -0.106494, -0.551859,
-    0.500000, 0.133975,
-    -0.790170, -0.147414, -0.594895,
-    1.000000, 1.000000,
-    -0.827110, -0.106494, -0.551859,
-    0.000000, 1.000000,
-    -0.864929, -0.131200, -0.484442,
-    0.500000, 0.133975,
-    -0.830812, -0.172532, -0.529135,
-    1.000000, 1.000000,
-    -0.744727, -0.121144, -0.656282,
-    0.000000, 1.000000,
-    -0.790170, -0.147414, -0.594895,
-    0.500000, 0.133975,
-    -0.749786, -0.187432, -0.634579,
-    1.000000, 1.000000,
-    -0.702046, -0.160622, -0.693780,
-    0.000000, 1.000000,
-    -0.744727, -0.121144, -0.656282,
-    0.500000, 0.133975,
-    -0.749786, -0.187432, -0.634579,
-    1.000000, 1.000000,
-    -0.744727, -0.121144, -0.656282,
-    0.000000, 1.000000,
-    -0.783843, -0.081086, -0.615642,
-    0.500000, 0.133975,
-    -0.790170, -0.147414, -0.594895,
-    1.000000, 1.000000,
-    -0.819207, -0.040640, -0.572056,
-    0.000000, 1.000000,
-    -0.859848, -0.065758, -0.506298,
-    0.500000, 0.133975,
-    -0.827110, -0.106494, -0.551859,
-    1.000000, 1.000000,
-    -0.783843, -0.081086, -0.615642,
-    0.000000, 1.000000,
-    -0.819207, -0.040640, -0.572056,
-    0.500000, 0.133975,
-    -0.827110, -0.106494, -0.551859,
-    1.000000, 1.000000,
-    -0.819207, -0.040640, -0.572056,
-    0.000000, 1.000000,
-    -0.850651, 0.000000, -0.525731,
-    0.500000, 0.133975,
-    -0.859848, -0.065758, -0.506298,
-    1.000000, 1.000000,
-    0.607478, -0.540650, -0.581952,
-    0.000000, 1.000000,
-    0.540650, -0.581952, -0.607478,
-    0.500000, 0.133975,
-    0.581952, -0.607478, -0.540650,
-    1.000000, 1.000000,
-    0.646578, -0.564254, -0.513375,
-    0.000000, 1.000000,
-    0.607478, -0.540650, -0.581952,
-    0.500000, 0.133975,
-    0.581952, -0.607478, -0.540650,
-    1.000000, 1.000000,
-    0.607478, -0.540650, -0.581952,
-    0.000000, 1.000000,
-    0.564254, -0.513375, -0.646578,
-    0.500000, 0.133975,
-    0.540650, -0.581952, -0.607478,
-    1.000000, 1.000000,
-    0.619242, -0.628313, -0.470917,
-    0.000000, 1.000000,
-    0.581952, -0.607478, -0.540650,
-    0.500000, 0.133975,
-    0.552418, -0.669612, -0.496441,
-    1.000000, 1.000000,
-    0.587785, -0.688191, -0.425325,
-    0.000000, 1.000000,
-    0.619242, -0.628313, -0.470917,
-    0.500000, 0.133975,
-    0.552418, -0.669612, -0.496441,
-    1.000000, 1.000000,
-    0.619242, -0.628313, -0.470917,
-    0.000000, 1.000000,
-    0.646578, -0.564254, -0.513375,
-    0.500000, 0.133975,
-    0.581952, -0.607478, -0.540650,
-    1.000000, 1.000000,
-    0.669612, -0.496441, -0.552418,
-    0.000000, 1.000000,
-    0.628313, -0.470917, -0.619242,
-    0.500000, 0.133975,
-    0.607478, -0.540650, -0.581952,
-    1.000000, 1.000000,
-    0.646578, -0.564254, -0.513375,
-    0.000000, 1.000000,
-    0.669612, -0.496441, -0.552418,
-    0.500000, 0.133975,
-    0.607478, -0.540650, -0.581952,
-    1.000000, 1.000000,
-    0.669612, -0.496441, -0.552418,
-    0.000000, 1.000000,
-    0.688191, -0.425325, -0.587785,
-    0.500000, 0.133975,
-    0.628313, -0.470917, -0.619242,
-    1.000000, 1.000000,
-    0.485208, -0.704471, -0.517970,
-    0.000000, 1.000000,
-    0.443957, -0.678977, -0.584716,
-    0.500000, 0.133975,
-    0.414273, -0.735011, -0.536784,
-    1.000000, 1.000000,
-    0.453990, -0.757935, -0.468430,
-    0.000000, 1.000000,
-    0.485208, -0.704471, -0.517970,
-    0.500000, 0.133975,
-    0.414273, -0.735011, -0.536784,
-    1.000000, 1.000000,
-    0.485208, -0.704471, -0.517970,
-    0.000000, 1.000000,
-    0.513375, -0.646578, -0.564254,
-    0.500000, 0.133975,
-    0.443957, -0.678977, -0.584716,
-    1.000000, 1.000000,
-    0.382683, -0.785899, -0.485712,
-    0.000000, 1.000000,
-    0.414273, -0.735011, -0.536784,
-    0.500000, 0.133975,
-    0.341435, -0.760406, -0.552454,
-    1.000000, 1.000000,
-    0.309017, -0.809017, -0.500000,
-    0.000000, 1.000000,
-    0.382683, -0.785899, -0.485712,
-    0.500000, 0.133975,
-    0.341435, -0.760406, -0.552454,
-    1.000000, 1.000000,
-    0.382683, -0.785899, -0.485712,
-    0.000000, 1.000000,
-    0.453990, -0.757935, -0.468430,
-    0.500000, 0.133975,
-    0.414273, -0.735011, -0.536784,
-    1.000000, 1.000000,
-    0.522499, -0.725299, -0.448259,
-    0.000000, 1.000000,
-    0.552418, -0.669612, -0.496441,
-    0.500000, 0.133975,
-    0.485208, -0.704471, -0.517970,
-    1.000000, 1.000000,
-    0.453990, -0.757935, -0.468430,
-    0.000000, 1.000000,
-    0.522499, -0.725299, -0.448259,
-    0.500000, 0.133975,
-    0.485208, -0.704471, -0.517970,
-    1.000000, 1.000000,
-    0.522499, -0.725299, -0.448259,
-    0.000000, 1.000000,
-    0.587785, -0.688191, -0.425325,
-    0.500000, 0.133975,
-    0.552418, -0.669612, -0.496441,
-    1.000000, 1.000000,
-    0.735011, -0.536784, -0.414273,
-    0.000000, 1.000000,
-    0.704471, -0.517970, -0.485208,
-    0.500000, 0.133975,
-    0.678977, -0.584716, -0.443957,
-    1.000000, 1.000000,
-    0.707107, -0.601501, -0.371748,
-    0.000000, 1.000000,
-    0.735011, -0.536784, -0.414273,
-    0.500000, 0.133975,
-    0.678977, -0.584716, -0.443957,
-    1.000000, 1.000000,
-    0.735011, -0.536784, -0.414273,
-    0.000000, 1.000000,
-    0.757935, -0.468430, -0.453990,
-    0.500000, 0.133975,
-    0.704471, -0.517970, -0.485208,
-    1.000000, 1.000000,
-    0.649448, -0.646840, -0.399769,
-    0.000000, 1.000000,
-    0.678977, -0.584716, -0.443957,
-    0.500000, 0.133975,
-    0.619242, -0.628313, -0.470917,
-    1.000000, 1.000000,
-    0.587785, -0.688191, -0.425325,
-    0.000000, 1.000000,
-    0.649448, -0.646840, -0.399769,
-    0.500000, 0.133975,
-    0.619242, -0.628313, -0.470917,
-    1.000000, 1.000000,
-    0.649448, -0.646840, -0.399769,
-    0.000000, 1.000000,
-    0.707107, -0.601501, -0.371748,
-    0.500000, 0.133975,
-    0.678977, -0.584716, -0.443957,
-    1.000000, 1.000000,
-    0.760406, -0.552454, -0.341435,
-    0.000000, 1.000000,
-    0.785899, -0.485712, -0.382683,
-    0.500000, 0.133975,
-    0.735011, -0.536784, -0.414273,
-    1.000000, 1.000000,
-    0.707107, -0.601501, -0.371748,
-    0.000000, 1.000000,
-    0.760406, -0.552454, -0.341435,
-    0.500000, 0.133975,
-    0.735011, -0.536784, -0.414273,
-    1.000000, 1.000000,
-    0.760406, -0.552454, -0.341435,
-    0.000000, 1.000000,
-    0.809017, -0.500000, -0.309017,
-    0.500000, 0.133975,
-    0.785899, -0.485712, -0.382683,
-    1.000000, 1.000000,
-    0.322141, -0.583691, -0.745338,
-    0.000000, 1.000000,
-    0.280319, -0.545109, -0.790112,
-    0.500000, 0.133975,
-    0.255180, -0.610926, -0.749435,
-    1.000000, 1.000000,
-    0.296005, -0.647412, -0.702310,
-    0.000000, 1.000000,
-    0.322141, -0.583691, -0.745338,
-    0.500000, 0.133975,
-    0.255180, -0.610926, -0.749435,
-    1.000000, 1.000000,
-    0.322141, -0.583691, -0.745338,
-    0.000000, 1.000000,
-    0.346153, -0.516122, -0.783452,
-    0.500000, 0.133975,
-    0.280319, -0.545109, -0.790112,
-    1.000000, 1.000000,
-    0.228900, -0.672319, -0.703983,
-    0.000000, 1.000000,
-    0.255180, -0.610926, -0.749435,
-    0.500000, 0.133975,
-    0.187432, -0.634579, -0.749786,
-    1.000000, 1.000000,
-    0.160622, -0.693780, -0.702046,
-    0.000000, 1.000000,
-    0.228900, -0.672319, -0.703983,
-    0.500000, 0.133975,
-    0.187432, -0.634579, -0.749786,
-    1.000000, 1.000000,
-    0.228900, -0.672319, -0.703983,
-    0.000000, 1.000000,
-    0.296005, -0.647412, -0.702310,
-    0.500000, 0.133975,
-    0.255180, -0.610926, -0.749435,
-    1.000000, 1.000000,
-    0.361592, -0.619186, -0.697037,
-    0.000000, 1.000000,
-    0.386730, -0.553372, -0.737712,
-    0.500000, 0.133975,
-    0.322141, -0.583691, -0.745338,
-    1.000000, 1.000000,
-    0.296005, -0.647412, -0.702310,
-    0.000000, 1.000000,
-    0.361592, -0.619186, -0.697037,
-    0.500000, 0.133975,
-    0.322141, -0.583691, -0.745338,
-    1.000000, 1.000000,
-    0.361592, -0.619186, -0.697037,
-    0.000000, 1.000000,
-    0.425325, -0.587785, -0.688191,
-    0.500000, 0.133975,
-    0.386730, -0.553372, -0.737712,
-    1.000000, 1.000000,
-    0.147414, -0.594895, -0.790170,
-    0.000000, 1.000000,
-    0.172532, -0.529135, -0.830812,
-    0.500000, 0.133975,
-    0.106494, -0.551859, -0.827110,
-    1.000000, 1.000000,
-    0.081086, -0.615642, -0.783843,
-    0.000000, 1.000000,
-    0.147414, -0.594895, -0.790170,
-    0.500000, 0.133975,
-    0.106494, -0.551859, -0.827110,
-    1.000000, 1.000000,
-    0.147414, -0.594895, -0.790170,
-    0.000000, 1.000000,
-    0.213023, -0.571252, -0.792649,
-    0.500000, 0.133975,
-    0.172532, -0.529135, -0.830812,
-    1.000000, 1.000000,
-    0.040640, -0.572056, -0.819207,
-    0.000000, 1.000000,
-    0.106494, -0.551859, -0.827110,
-    0.500000, 0.133975,
-    0.065758, -0.506298, -0.859848,
-    1.000000, 1.000000,
-    0.000000, -0.525731, -0.850651,
-    0.000000, 1.000000,
-    0.040640, -0.572056, -0.819207,
-    0.500000, 0.133975,
-    0.065758, -0.506298, -0.859848,
-    1.000000, 1.000000,
-    0.040640, -0.572056, -0.819207,
-    0.000000, 1.000000,
-    0.081086, -0.615642, -0.783843,
-    0.500000, 0.133975,
-    0.106494, -0.551859, -0.827110,
-    1.000000, 1.000000,
-    0.121144, -0.656282, -0.744727,
-    0.000000, 1.000000,
-    0.187432, -0.634579, -0.749786,
-    0.500000, 0.133975,
-    0.147414, -0.594895, -0.790170,
-    1.000000, 1.000000,
-    0.081086, -0.615642, -0.783843,
-    0.000000, 1.000000,
-    0.121144, -0.656282, -0.744727,
-    0.500000, 0.133975,
-    0.147414, -0.594895, -0.790170,
-    1.000000, 1.000000,
-    0.121144, -0.656282, -0.744727,
-    0.000000, 1.000000,
-    0.160622, -0.693780, -0.702046,
-    0.500000, 0.133975,
-    0.187432, -0.634579, -0.749786,
-    1.000000, 1.000000,
-    0.305212, -0.734794, -0.605741,
-    0.000000, 1.000000,
-    0.334692, -0.678913, -0.653497,
-    0.500000, 0.133975,
-    0.267381, -0.705236, -0.656620,
-    1.000000, 1.000000,
-    0.237086, -0.758652, -0.606825,
-    0.000000, 1.000000,
-    0.305212, -0.734794, -0.605741,
-    0.500000, 0.133975,
-    0.267381, -0.705236, -0.656620,
-    1.000000, 1.000000,
-    0.305212, -0.734794, -0.605741,
-    0.000000, 1.000000,
-    0.371748, -0.707107, -0.601501,
-    0.500000, 0.133975,
-    0.334692, -0.678913, -0.653497,
-    1.000000, 1.000000,
-    0.199331, -0.727958, -0.656006,
-    0.000000, 1.000000,
-    0.267381, -0.705236, -0.656620,
-    0.500000, 0.133975,
-    0.228900, -0.672319, -0.703983,
-    1.000000, 1.000000,
-    0.160622, -0.693780, -0.702046,
-    0.000000, 1.000000,
-    0.199331, -0.727958, -0.656006,
-    0.500000, 0.133975,
-    0.228900, -0.672319, -0.703983,
-    1.000000, 1.000000,
-    0.199331, -0.727958, -0.656006,
-    0.000000, 1.000000,
-    0.237086, -0.758652, -0.606825,
-    0.500000, 0.133975,
-    0.267381, -0.705236, -0.656620,
-    1.000000, 1.000000,
-    0.273707, -0.785715, -0.554740,
-    0.000000, 1.000000,
-    0.341435, -0.760406, -0.552454,
-    0.500000, 0.133975,
-    0.305212, -0.734794, -0.605741,
-    1.000000, 1.000000,
-    0.237086, -0.758652, -0.606825,
-    0.000000, 1.000000,
-    0.273707, -0.785715, -0.554740,
-    0.500000, 0.133975,
-    0.305212, -0.734794, -0.605741,
-    1.000000, 1.000000,
-    0.273707, -0.785715, -0.554740,
-    0.000000, 1.000000,
-    0.309017, -0.809017, -0.500000,
-    0.500000, 0.133975,
-    0.341435, -0.760406, -0.552454,
-    1.000000, 1.000000,
-    0.610926, -0.749435, -0.255180,
-    0.000000, 1.000000,
-    0.583691, -0.745338, -0.322141,
-    0.500000, 0.133975,
-    0.545109, -0.790112, -0.280319,
-    1.000000, 1.000000,
-    0.571252, -0.792649, -0.213023,
-    0.000000, 1.000000,
-    0.610926, -0.749435, -0.255180,
-    0.500000, 0.133975,
-    0.545109, -0.790112, -0.280319,
-    1.000000, 1.000000,
-    0.610926, -0.749435, -0.255180,
-    0.000000, 1.000000,
-    0.647412, -0.702310, -0.296005,
-    0.500000, 0.133975,
-    0.583691, -0.745338, -0.322141,
-    1.000000, 1.000000,
-    0.504209, -0.830359, -0.237229,
-    0.000000, 1.000000,
-    0.545109, -0.790112, -0.280319,
-    0.500000, 0.133975,
-    0.476226, -0.825175, -0.303801,
-    1.000000, 1.000000,
-    0.433889, -0.862668, -0.259892,
-    0.000000, 1.000000,
-    0.504209, -0.830359, -0.237229,
-    0.500000, 0.133975,
-    0.476226, -0.825175, -0.303801,
-    1.000000, 1.000000,
-    0.504209, -0.830359, -0.237229,
-    0.000000, 1.000000,
-    0.571252, -0.792649, -0.213023,
-    0.500000, 0.133975,
-    0.545109, -0.790112, -0.280319,
-    1.000000, 1.000000,
-    0.634579, -0.749786, -0.187432,
-    0.000000, 1.000000,
-    0.672319, -0.703983, -0.228900,
-    0.500000, 0.133975,
-    0.610926, -0.749435, -0.255180,
-    1.000000, 1.000000,
-    0.571252, -0.792649, -0.213023,
-    0.000000, 1.000000,
-    0.634579, -0.749786, -0.187432,
-    0.500000, 0.133975,
-    0.610926, -0.749435, -0.255180,
-    1.000000, 1.000000,
-    0.634579, -0.749786, -0.187432,
-    0.000000, 1.000000,
-    0.693780, -0.702046, -0.160622,
-    0.500000, 0.133975,
-    0.672319, -0.703983, -0.228900,
-    1.000000, 1.000000,
-    0.446977, -0.816233, -0.366027,
-    0.000000, 1.000000,
-    0.486240, -0.772575, -0.408286,
-    0.500000, 0.133975,
-    0.415597, -0.803016, -0.427135,
-    1.000000, 1.000000,
-    0.375039, -0.843911, -0.383614,
-    0.000000, 1.000000,
-    0.446977, -0.816233, -0.366027,
-    0.500000, 0.133975,
-    0.415597, -0.803016, -0.427135,
-    1.000000, 1.000000,
-    0.446977, -0.816233, -0.366027,
-    0.000000, 1.000000,
-    0.516122, -0.783452, -0.346153,
-    0.500000, 0.133975,
-    0.486240, -0.772575, -0.408286,
-    1.000000, 1.000000,
-    0.342848, -0.828447, -0.442867,
-    0.000000, 1.000000,
-    0.415597, -0.803016, -0.427135,
-    0.500000, 0.133975,
-    0.382683, -0.785899, -0.485712,
-    1.000000, 1.000000,
-    0.309017, -0.809017, -0.500000,
-    0.000000, 1.000000,
-    0.342848, -0.828447, -0.442867,
-    0.500000, 0.133975,
-    0.382683, -0.785899, -0.485712,
-    1.000000, 1.000000,
-    0.342848, -0.828447, -0.442867,
-    0.000000, 1.000000,
-    0.375039, -0.843911, -0.383614,
-    0.500000, 0.133975,
-    0.415597, -0.803016, -0.427135,
-    1.000000, 1.000000,
-    0.405434, -0.855337, -0.322525,
-    0.000000, 1.000000,
-    0.476226, -0.825175, -0.303801,
-    0.500000, 0.133975,
-    0.446977, -0.816233, -0.366027,
-    1.000000, 1.000000,
-    0.375039, -0.843911, -0.383614,
-    0.000000, 1.000000,
-    0.405434, -0.855337, -0.322525,
-    0.500000, 0.133975,
-    0.446977, -0.816233, -0.366027,
-    1.000000, 1.000000,
-    0.405434, -0.855337, -0.322525,
-    0.000000, 1.000000,
-    0.433889, -0.862668, -0.259892,
-    0.500000, 0.133975,
-    0.476226, -0.825175, -0.303801,
-    1.000000, 1.000000,
-    0.551859, -0.827110, -0.106494,
-    0.000000, 1.000000,
-    0.594895, -0.790170, -0.147414,
-    0.500000, 0.133975,
-    0.529135, -0.830812, -0.172532,
-    1.000000, 1.000000,
-    0.484442, -0.864929, -0.131200,
-    0.000000, 1.000000,
-    0.551859, -0.827110, -0.106494,
-    0.500000, 0.133975,
-    0.529135, -0.830812, -0.172532,
-    1.000000, 1.000000,
-    0.551859, -0.827110, -0.106494,
-    0.000000, 1.000000,
-    0.615642, -0.783843, -0.081086,
-    0.500000, 0.133975,
-    0.594895, -0.790170, -0.147414,
-    1.000000, 1.000000,
-    0.460267, -0.865871, -0.196015,
-    0.000000, 1.000000,
-    0.529135, -0.830812, -0.172532,
-    0.500000, 0.133975,
-    0.504209, -0.830359, -0.237229,
-    1.000000, 1.000000,
-    0.433889, -0.862668, -0.259892,
-    0.000000, 1.000000,
-    0.460267, -0.865871, -0.196015,
-    0.500000, 0.133975,
-    0.504209, -0.830359, -0.237229,
-    1.000000, 1.000000,
-    0.460267, -0.865871, -0.196015,
-    0.000000, 1.000000,
-    0.484442, -0.864929, -0.131200,
-    0.500000, 0.133975,
-    0.529135, -0.830812, -0.172532,
-    1.000000, 1.000000,
-    0.506298, -0.859848, -0.065758,
-    0.000000, 1.000000,
-    0.572056, -0.819207, -0.040640,
-    0.500000, 0.133975,
-    0.551859, -0.827110, -0.106494,
-    1.000000, 1.000000,
-    0.484442, -0.864929, -0.131200,
-    0.000000, 1.000000,
-    0.506298, -0.859848, -0.065758,
-    0.500000, 0.133975,
-    0.551859, -0.827110, -0.106494,
-    1.000000, 1.000000,
-    0.506298, -0.859848, -0.065758,
-    0.000000, 1.000000,
-    0.525731, -0.850651, 0.000000,
-    0.500000, 0.133975,
-    0.572056, -0.819207, -0.040640,
-    1.000000, 1.000000,
-    -0.607478, -0.540650, 0.581952,
-    0.000000, 1.000000,
-    -0.540650, -0.581952, 0.607478,
-    0.500000, 0.133975,
-    -0.581952, -0.607478, 0.540650,
-    1.000000, 1.000000,
-    -0.646578, -0.564254, 0.513375,
-    0.000000, 1.000000,
-    -0.607478, -0.540650, 0.581952,
-    0.500000, 0.133975,
-    -0.581952, -0.607478, 0.540650,
-    1.000000, 1.000000,
-    -0.607478, -0.540650, 0.581952,
-    0.000000, 1.000000,
-    -0.564254, -0.513375, 0.646578,
-    0.500000, 0.133975,
-    -0.540650, -0.581952, 0.607478,
-    1.000000, 1.000000,
-    -0.619242, -0.628313, 0.470917,
-    0.000000, 1.000000,
-    -0.581952, -0.607478, 0.540650,
-    0.500000, 0.133975,
-    -0.552418, -0.669612, 0.496441,
-    1.000000, 1.000000,
-    -0.587785, -0.688191, 0.425325,
-    0.000000, 1.000000,
-    -0.619242, -0.628313, 0.470917,
-    0.500000, 0.133975,
-    -0.552418, -0.669612, 0.496441,
-    1.000000, 1.000000,
-    -0.619242, -0.628313, 0.470917,
-    0.000000, 1.000000,
-    -0.646578, -0.564254, 0.513375,
-    0.500000, 0.133975,
-    -0.581952, -0.607478, 0.540650,
-    1.000000, 1.000000,
-    -0.669612, -0.496441, 0.552418,
-    0.000000, 1.000000,
-    -0.628313, -0.470917, 0.619242,
-    0.500000, 0.133975,
-    -0.607478, -0.540650, 0.581952,
-    1.000000, 1.000000,
-    -0.646578, -0.564254, 0.513375,
-    0.000000, 1.000000,
-    -0.669612, -0.496441, 0.552418,
-    0.500000, 0.133975,
-    -0.607478, -0.540650, 0.581952,
-    1.000000, 1.000000,
-    -0.669612, -0.496441, 0.552418,
-    0.000000, 1.000000,
-    -0.688191, -0.425325, 0.587785,
-    0.500000, 0.133975,
-    -0.628313, -0.470917, 0.619242,
-    1.000000, 1.000000,
-    -0.485208, -0.704471, 0.517970,
-    0.000000, 1.000000,
-    -0.443957, -0.678977, 0.584716,
-    0.500000, 0.133975,
-    -0.414273, -0.735011, 0.536784,
-    1.000000, 1.000000,
-    -0.453990, -0.757935, 0.468430,
-    0.000000, 1.000000,
-    -0.485208, -0.704471, 0.517970,
-    0.500000, 0.133975,
-    -0.414273, -0.735011, 0.536784,
-    1.000000, 1.000000,
-    -0.485208, -0.704471, 0.517970,
-    0.000000, 1.000000,
-    -0.513375, -0.646578, 0.564254,
-    0.500000, 0.133975,
-    -0.443957, -0.678977, 0.584716,
-    1.000000, 1.000000,
-    -0.382683, -0.785899, 0.485712,
-    0.000000, 1.000000,
-    -0.414273, -0.735011, 0.536784,
-    0.500000, 0.133975,
-    -0.341435, -0.760406, 0.552454,
-    1.000000, 1.000000,
-    -0.309017, -0.809017, 0.500000,
-    0.000000, 1.000000,
-    -0.382683, -0.785899, 0.485712,
-    0.500000, 0.133975,
-    -0.341435, -0.760406, 0.552454,
-    1.000000, 1.000000,
-    -0.382683, -0.785899, 0.485712,
-    0.000000, 1.000000,
-    -0.453990, -0.757935, 0.468430,
-    0.500000, 0.133975,
-    -0.414273, -0.735011, 0.536784,
-    1.000000, 1.000000,
-    -0.522499, -0.725299, 0.448259,
-    0.000000, 1.000000,
-    -0.552418, -0.669612, 0.496441,
-    0.500000, 0.133975,
-    -0.485208, -0.704471, 0.517970,
-    1.000000, 1.000000,
-    -0.453990, -0.757935, 0.468430,
-    0.000000, 1.000000,
-    -0.522499, -0.725299, 0.448259,
-    0.500000, 0.133975,
-    -0.485208, -0.704471, 0.517970,
-    1.000000, 1.000000,
-    -0.522499, -0.725299, 0.448259,
-    0.000000, 1.000000,
-    -0.587785, -0.688191, 0.425325,
-    0.500000, 0.133975,
-    -0.552418, -0.669612, 0.496441,
-    1.000000, 1.000000,
-    -0.735011, -0.536784, 0.414273,
-    0.000000, 1.000000,
-    -0.704471, -0.517970, 0.485208,
-    0.500000, 0.133975,
-    -0.678977, -0.584716, 0.443957,
-    1.000000, 1.000000,
-    -0.707107, -0.601501, 0.371748,
-    0.000000, 1.000000,
-    -0.735011, -0.536784, 0.414273,
-    0.500000, 0.133975,
-    -0.678977, -0.584716, 0.443957,
-    1.000000, 1.000000,
-    -0.735011, -0.536784, 0.414273,
-    0.000000, 1.000000,
-    -0.757935, -0.468430, 0.453990,
-    0.500000, 0.133975,
-    -0.704471, -0.517970, 0.485208,
-    1.000000, 1.000000,
-    -0.649448, -0.646840, 0.399769,
-    0.000000, 1.000000,
-    -0.678977, -0.584716, 0.443957,
-    0.500000, 0.133975,
-    -0.619242, -0.628313, 0.470917,
-    1.000000, 1.000000,
-    -0.587785, -0.688191, 0.425325,
-    0.000000, 1.000000,
-    -0.649448, -0.646840, 0.399769,
-    0.500000, 0.133975,
-    -0.619242, -0.628313, 0.470917,
-    1.000000, 1.000000,
-    -0.649448, -0.646840, 0.399769,
-    0.000000, 1.000000,
-    -0.707107, -0.601501, 0.371748,
-    0.500000, 0.133975,
-    -0.678977, -0.584716, 0.443957,
-    1.000000, 1.000000,
-    -0.760406, -0.552454, 0.341435,
-    0.000000, 1.000000,
-    -0.785899, -0.485712, 0.382683,
-    0.500000, 0.133975,
-    -0.735011, -0.536784, 0.414273,
-    1.000000, 1.000000,
-    -0.707107, -0.601501, 0.371748,
-    0.000000, 1.000000,
-    -0.760406, -0.552454, 0.341435,
-    0.500000, 0.133975,
-    -0.735011, -0.536784, 0.414273,
-    1.000000, 1.000000,
-    -0.760406, -0.552454, 0.341435,
-    0.000000, 1.000000,
-    -0.809017, -0.500000, 0.309017,
-    0.500000, 0.133975,
-    -0.785899, -0.485712, 0.382683,
-    1.000000, 1.000000,
-    -0.322141, -0.583691, 0.745338,
-    0.000000, 1.000000,
-    -0.280319, -0.545109, 0.790112,
-    0.500000, 0.133975,
-    -0.255180, -0.610926, 0.749435,
-    1.000000, 1.000000,
-    -0.296005, -0.647412, 0.702310,
-    0.000000, 1.000000,
-    -0.322141, -0.583691, 0.745338,
-    0.500000, 0.133975,
-    -0.255180, -0.610926, 0.749435,
-    1.000000, 1.000000,
-    -0.322141, -0.583691, 0.745338,
-    0.000000, 1.000000,
-    -0.346153, -0.516122, 0.783452,
-    0.500000, 0.133975,
-    -0.280319, -0.545109, 0.790112,
-    1.000000, 1.000000,
-    -0.228900, -0.672319, 0.703983,
-    0.000000, 1.000000,
-    -0.255180, -0.610926, 0.749435,
-    0.500000, 0.133975,
-    -0.187432, -0.634579, 0.749786,
-    1.000000, 1.000000,
-    -0.160622, -0.693780, 0.702046,
-    0.000000, 1.000000,
-    -0.228900, -0.672319, 0.703983,
-    0.500000, 0.133975,
-    -0.187432, -0.634579, 0.749786,
-    1.000000, 1.000000,
-    -0.228900, -0.672319, 0.703983,
-    0.000000, 1.000000,
-    -0.296005, -0.647412, 0.702310,
-    0.500000, 0.133975,
-    -0.255180, -0.610926, 0.749435,
-    1.000000, 1.000000,
-    -0.361592, -0.619186, 0.697037,
-    0.000000, 1.000000,
-    -0.386730, -0.553372, 0.737712,
-    0.500000, 0.133975,
-    -0.322141, -0.583691, 0.745338,
-    1.000000, 1.000000,
-    -0.296005, -0.647412, 0.702310,
-    0.000000, 1.000000,
-    -0.361592, -0.619186, 0.697037,
-    0.500000, 0.133975,
-    -0.322141, -0.583691, 0.745338,
-    1.000000, 1.000000,
-    -0.361592, -0.619186, 0.697037,
-    0.000000, 1.000000,
-    -0.425325, -0.587785, 0.688191,
-    0.500000, 0.133975,
-    -0.386730, -0.553372, 0.737712,
-    1.000000, 1.000000,
-    -0.147414, -0.594895, 0.790170,
-    0.000000, 1.000000,
-    -0.172532, -0.529135, 0.830812,
-    0.500000, 0.133975,
-    -0.106494, -0.551859, 0.827110,
-    1.000000, 1.000000,
-    -0.081086, -0.615642, 0.783843,
-    0.000000, 1.000000,
-    -0.147414, -0.594895, 0.790170,
-    0.500000, 0.133975,
-    -0.106494, -0.551859, 0.827110,
-    1.000000, 1.000000,
-    -0.147414, -0.594895, 0.790170,
-    0.000000, 1.000000,
-    -0.213023, -0.571252, 0.792649,
-    0.500000, 0.133975,
-    -0.172532, -0.529135, 0.830812,
-    1.000000, 1.000000,
-    -0.040640, -0.572056, 0.819207,
-    0.000000, 1.000000,
-    -0.106494, -0.551859, 0.827110,
-    0.500000, 0.133975,
-    -0.065758, -0.506298, 0.859848,
-    1.000000, 1.000000,
-    0.000000, -0.525731, 0.850651,
-    0.000000, 1.000000,
-    -0.040640, -0.572056, 0.819207,
-    0.500000, 0.133975,
-    -0.065758, -0.506298, 0.859848,
-    1.000000, 1.000000,
-    -0.040640, -0.572056, 0.819207,
-    0.000000, 1.000000,
-    -0.081086, -0.615642, 0.783843,
-    0.500000, 0.133975,
-    -0.106494, -0.551859, 0.827110,
-    1.000000, 1.000000,
-    -0.121144, -0.656282, 0.744727,
-    0.000000, 1.000000,
-    -0.187432, -0.634579, 0.749786,
-    0.500000, 0.133975,
-    -0.147414, -0.594895, 0.790170,
-    1.000000, 1.000000,
-    -0.081086, -0.615642, 0.783843,
-    0.000000, 1.000000,
-    -0.121144, -0.656282, 0.744727,
-    0.500000, 0.133975,
-    -0.147414, -0.594895, 0.790170,
-    1.000000, 1.000000,
-    -0.121144, -0.656282, 0.744727,
-    0.000000, 1.000000,
-    -0.160622, -0.693780, 0.702046,
-    0.500000, 0.133975,
-    -0.187432, -0.634579, 0.749786,
-    1.000000, 1.000000,
-    -0.305212, -0.734794, 0.605741,
-    0.000000, 1.000000,
-    -0.334692, -0.678913, 0.653497,
-    0.500000, 0.133975,
-    -0.267381, -0.705236, 0.656620,
-    1.000000, 1.000000,
-    -0.237086, -0.758652, 0.606825,
-    0.000000, 1.000000,
-    -0.305212, -0.734794, 0.605741,
-    0.500000, 0.133975,
-    -0.267381, -0.705236, 0.656620,
-    1.000000, 1.000000,
-    -0.305212, -0.734794, 0.605741,
-    0.000000, 1.000000,
-    -0.371748, -0.707107, 0.601501,
-    0.500000, 0.133975,
-    -0.334692, -0.678913, 0.653497,
-    1.000000, 1.000000,
-    -0.199331, -0.727958, 0.656006,
-    0.000000, 1.000000,
-    -0.267381, -0.705236, 0.656620,
-    0.500000, 0.133975,
-    -0.228900, -0.672319, 0.703983,
-    1.000000, 1.000000,
-    -0.160622, -0.693780, 0.702046,
-    0.000000, 1.000000,
-    -0.199331, -0.727958, 0.656006,
-    0.500000, 0.133975,
-    -0.228900, -0.672319, 0.703983,
-    1.000000, 1.000000,
-    -0.199331, -0.727958, 0.656006,
-    0.000000, 1.000000,
-    -0.237086, -0.758652, 0.606825,
-    0.500000, 0.133975,
-    -0.267381, -0.705236, 0.656620,
-    1.000000, 1.000000,
-    -0.273707, -0.785715, 0.554740,
-    0.000000, 1.000000,
-    -0.341435, -0.760406, 0.552454,
-    0.500000, 0.133975,
-    -0.305212, -0.734794, 0.605741,
-    1.000000, 1.000000,
-    -0.237086, -0.758652, 0.606825,
-    0.000000, 1.000000,
-    -0.273707, -0.785715, 0.554740,
-    0.500000, 0.133975,
-    -0.305212, -0.734794, 0.605741,
-    1.000000, 1.000000,
-    -0.273707, -0.785715, 0.554740,
-    0.000000, 1.000000,
-    -0.309017, -0.809017, 0.500000,
-    0.500000, 0.133975,
-    -0.341435, -0.760406, 0.552454,
-    1.000000, 1.000000,
-    -0.610926, -0.749435, 0.255180,
-    0.000000, 1.000000,
-    -0.583691, -0.745338, 0.322141,
-    0.500000, 0.133975,
-    -0.545109, -0.790112, 0.280319,
-    1.000000, 1.000000,
-    -0.571252, -0.792649, 0.213023,
-    0.000000, 1.000000,
-    -0.610926, -0.749435, 0.255180,
-    0.500000, 0.133975,
-    -0.545109, -0.790112, 0.280319,
-    1.000000, 1.000000,
-    -0.610926, -0.749435, 0.255180,
-    0.000000, 1.000000,
-    -0.647412, -0.702310, 0.296005,
-    0.500000, 0.133975,
-    -0.583691, -0.745338, 0.322141,
-    1.000000, 1.000000,
-    -0.504209, -0.830359, 0.237229,
-    0.000000, 1.000000,
-    -0.545109, -0.790112, 0.280319,
-    0.500000, 0.133975,
-    -0.476226, -0.825175, 0.303801,
-    1.000000, 1.000000,
-    -0.433889, -0.862668, 0.259892,
-    0.000000, 1.000000,
-    -0.504209, -0.830359, 0.237229,
-    0.500000, 0.133975,
-    -0.476226, -0.825175, 0.303801,
-    1.000000, 1.000000,
-    -0.504209, -0.830359, 0.237229,
-    0.000000, 1.000000,
-    -0.571252, -0.792649, 0.213023,
-    0.500000, 0.133975,
-    -0.545109, -0.790112, 0.280319,
-    1.000000, 1.000000,
-    -0.634579, -0.749786, 0.187432,
-    0.000000, 1.000000,
-    -0.672319, -0.703983, 0.228900,
-    0.500000, 0.133975,
-    -0.610926, -0.749435, 0.255180,
-    1.000000, 1.000000,
-    -0.571252, -0.792649, 0.213023,
-    0.000000, 1.000000,
-    -0.634579, -0.749786, 0.187432,
-    0.500000, 0.133975,
-    -0.610926, -0.749435, 0.255180,
-    1.000000, 1.000000,
-    -0.634579, -0.749786, 0.187432,
-    0.000000, 1.000000,
-    -0.693780, -0.702046, 0.160622,
-    0.500000, 0.133975,
-    -0.672319, -0.703983, 0.228900,
-    1.000000, 1.000000,
-    -0.446977, -0.816233, 0.366027,
-    0.000000, 1.000000,
-    -0.486240, -0.772575, 0.408286,
-    0.500000, 0.133975,
-    -0.415597, -0.803016, 0.427135,
-    1.000000, 1.000000,
-    -0.375039, -0.843911, 0.383614,
-    0.000000, 1.000000,
-    -0.446977, -0.816233, 0.366027,
-    0.500000, 0.133975,
-    -0.415597, -0.803016, 0.427135,
-    1.000000, 1.000000,
-    -0.446977, -0.816233, 0.366027,
-    0.000000, 1.000000,
-    -0.516122, -0.783452, 0.346153,
-    0.500000, 0.133975,
-    -0.486240, -0.772575, 0.408286,
-    1.000000, 1.000000,
-    -0.342848, -0.828447, 0.442867,
-    0.000000, 1.000000,
-    -0.415597, -0.803016, 0.427135,
-    0.500000, 0.133975,
-    -0.382683, -0.785899, 0.485712,
-    1.000000, 1.000000,
-    -0.309017, -0.809017, 0.500000,
-    0.000000, 1.000000,
-    -0.342848, -0.828447, 0.442867,
-    0.500000, 0.133975,
-    -0.382683, -0.785899, 0.485712,
-    1.000000, 1.000000,
-    -0.342848, -0.828447, 0.442867,
-    0.000000, 1.000000,
-    -0.375039, -0.843911, 0.383614,
-    0.500000, 0.133975,
-    -0.415597, -0.803016, 0.427135,
-    1.000000, 1.000000,
-    -0.405434, -0.855337, 0.322525,
-    0.000000, 1.000000,
-    -0.476226, -0.825175, 0.303801,
-    0.500000, 0.133975,
-    -0.446977, -0.816233, 0.366027,
-    1.000000, 1.000000,
-    -0.375039, -0.843911, 0.383614,
-    0.000000, 1.000000,
-    -0.405434, -0.855337, 0.322525,
-    0.500000, 0.133975,
-    -0.446977, -0.816233, 0.366027,
-    1.000000, 1.000000,
-    -0.405434, -0.855337, 0.322525,
-    0.000000, 1.000000,
-    -0.433889, -0.862668, 0.259892,
-    0.500000, 0.133975,
-    -0.476226, -0.825175, 0.303801,
-    1.000000, 1.000000,
-    -0.551859, -0.827110, 0.106494,
-    0.000000, 1.000000,
-    -0.594895, -0.790170, 0.147414,
-    0.500000, 0.133975,
-    -0.529135, -0.830812, 0.172532,
-    1.000000, 1.000000,
-    -0.484442, -0.864929, 0.131200,
-    0.000000, 1.000000,
-    -0.551859, -0.827110, 0.106494,
-    0.500000, 0.133975,
-    -0.529135, -0.830812, 0.172532,
-    1.000000, 1.000000,
-    -0.551859, -0.827110, 0.106494,
-    0.000000, 1.000000,
-    -0.615642, -0.783843, 0.081086,
-    0.500000, 0.133975,
-    -0.594895, -0.790170, 0.147414,
-    1.000000, 1.000000,
-    -0.460267, -0.865871, 0.196015,
-    0.000000, 1.000000,
-    -0.529135, -0.830812, 0.172532,
-    0.500000, 0.133975,
-    -0.504209, -0.830359, 0.237229,
-    1.000000, 1.000000,
-    -0.433889, -0.862668, 0.259892,
-    0.000000, 1.000000,
-    -0.460267, -0.865871, 0.196015,
-    0.500000, 0.133975,
-    -0.504209, -0.830359, 0.237229,
-    1.000000, 1.000000,
-    -0.460267, -0.865871, 0.196015,
-    0.000000, 1.000000,
-    -0.484442, -0.864929, 0.131200,
-    0.500000, 0.133975,
-    -0.529135, -0.830812, 0.172532,
-    1.000000, 1.000000,
-    -0.506298, -0.859848, 0.065758,
-    0.000000, 1.000000,
-    -0.572056, -0.819207, 0.040640,
-    0.500000, 0.133975,
-    -0.551859, -0.827110, 0.106494,
-    1.000000, 1.000000,
-    -0.484442, -0.864929, 0.131200,
-    0.000000, 1.000000,
-    -0.506298, -0.859848, 0.065758,
-    0.500000, 0.133975,
-    -0.551859, -0.827110, 0.106494,
-    1.000000, 1.000000,
-    -0.506298, -0.859848, 0.065758,
-    0.000000, 1.000000,
-    -0.525731, -0.850651, 0.000000,
-    0.500000, 0.133975,
-    -0.572056, -0.819207, 0.040640,
-    1.000000, 1.000000,
-    0.581952, -0.607478, 0.540650,
-    0.000000, 1.000000,
-    0.540650, -0.581952, 0.607478,
-    0.500000, 0.133975,
-    0.607478, -0.540650, 0.581952,
-    1.000000, 1.000000,
-    0.646578, -0.564254, 0.513375,
-    0.000000, 1.000000,
-    0.581952, -0.607478, 0.540650,
-    0.500000, 0.133975,
-    0.607478, -0.540650, 0.581952,
-    1.000000, 1.000000,
-    0.581952, -0.607478, 0.540650,
-    0.000000, 1.000000,
-    0.513375, -0.646578, 0.564254,
-    0.500000, 0.133975,
-    0.540650, -0.581952, 0.607478,
-    1.000000, 1.000000,
-    0.669612, -0.496441, 0.552418,
-    0.000000, 1.000000,
-    0.607478, -0.540650, 0.581952,
-    0.500000, 0.133975,
-    0.628313, -0.470917, 0.619242,
-    1.000000, 1.000000,
-    0.688191, -0.425325, 0.587785,
-    0.000000, 1.000000,
-    0.669612, -0.496441, 0.552418,
-    0.500000, 0.133975,
-    0.628313, -0.470917, 0.619242,
-    1.000000, 1.000000,
-    0.669612, -0.496441, 0.552418,
-    0.000000, 1.000000,
-    0.646578, -0.564254, 0.513375,
-    0.500000, 0.133975,
-    0.607478, -0.540650, 0.581952,
-    1.000000, 1.000000,
-    0.619242, -0.628313, 0.470917,
-    0.000000, 1.000000,
-    0.552418, -0.669612, 0.496441,
-    0.500000, 0.133975,
-    0.581952, -0.607478, 0.540650,
-    1.000000, 1.000000,
-    0.646578, -0.564254, 0.513375,
-    0.000000, 1.000000,
-    0.619242, -0.628313, 0.470917,
-    0.500000, 0.133975,
-    0.581952, -0.607478, 0.540650,
-    1.000000, 1.000000,
-    0.619242, -0.628313, 0.470917,
-    0.000000, 1.000000,
-    0.587785, -0.688191, 0.425325,
-    0.500000, 0.133975,
-    0.552418, -0.669612, 0.496441,
-    1.000000, 1.000000,
-    0.584716, -0.443957, 0.678977,
-    0.000000, 1.000000,
-    0.517970, -0.485208, 0.704471,
-    0.500000, 0.133975,
-    0.536784, -0.414273, 0.735011,
-    1.000000, 1.000000,
-    0.601501, -0.371748, 0.707107,
-    0.000000, 1.000000,
-    0.584716, -0.443957, 0.678977,
-    0.500000, 0.133975,
-    0.536784, -0.414273, 0.735011,
-    1.000000, 1.000000,
-    0.584716, -0.443957, 0.678977,
-    0.000000, 1.000000,
-    0.564254, -0.513375, 0.646578,
-    0.500000, 0.133975,
-    0.517970, -0.485208, 0.704471,
-    1.000000, 1.000000,
-    0.552454, -0.341435, 0.760406,
-    0.000000, 1.000000,
-    0.536784, -0.414273, 0.735011,
-    0.500000, 0.133975,
-    0.485712, -0.382683, 0.785899,
-    1.000000, 1.000000,
-    0.500000, -0.309017, 0.809017,
-    0.000000, 1.000000,
-    0.552454, -0.341435, 0.760406,
-    0.500000, 0.133975,
-    0.485712, -0.382683, 0.785899,
-    1.000000, 1.000000,
-    0.552454, -0.341435, 0.760406,
-    0.000000, 1.000000,
-    0.601501, -0.371748, 0.707107,
-    0.500000, 0.133975,
-    0.536784, -0.414273, 0.735011,
-    1.000000, 1.000000,
-    0.646840, -0.399769, 0.649448,
-    0.000000, 1.000000,
-    0.628313, -0.470917, 0.619242,
-    0.500000, 0.133975,
-    0.584716, -0.443957, 0.678977,
-    1.000000, 1.000000,
-    0.601501, -0.371748, 0.707107,
-    0.000000, 1.000000,
-    0.646840, -0.399769, 0.649448,
-    0.500000, 0.133975,
-    0.584716, -0.443957, 0.678977,
-    1.000000, 1.000000,
-    0.646840, -0.399769, 0.649448,
-    0.000000, 1.000000,
-    0.688191, -0.425325, 0.587785,
-    0.500000, 0.133975,
-    0.628313, -0.470917, 0.619242,
-    1.000000, 1.000000,
-    0.735011, -0.536784, 0.414273,
-    0.000000, 1.000000,
-    0.678977, -0.584716, 0.443957,
-    0.500000, 0.133975,
-    0.704471, -0.517970, 0.485208,
-    1.000000, 1.000000,
-    0.757935, -0.468430, 0.453990,
-    0.000000, 1.000000,
-    0.735011, -0.536784, 0.414273,
-    0.500000, 0.133975,
-    0.704471, -0.517970, 0.485208,
-    1.000000, 1.000000,
-    0.735011, -0.536784, 0.414273,
-    0.000000, 1.000000,
-    0.707107, -0.601501, 0.371748,
-    0.500000, 0.133975,
-    0.678977, -0.584716, 0.443957,
-    1.000000, 1.000000,
-    0.725299, -0.448259, 0.522499,
-    0.000000, 1.000000,
-    0.704471, -0.517970, 0.485208,
-    0.500000, 0.133975,
-    0.669612, -0.496441, 0.552418,
-    1.000000, 1.000000,
-    0.688191, -0.425325, 0.587785,
-    0.000000, 1.000000,
-    0.725299, -0.448259, 0.522499,
-    0.500000, 0.133975,
-    0.669612, -0.496441, 0.552418,
-    1.000000, 1.000000,
-    0.725299, -0.448259, 0.522499,
-    0.000000, 1.000000,
-    0.757935, -0.468430, 0.453990,
-    0.500000, 0.133975,
-    0.704471, -0.517970, 0.485208,
-    1.000000, 1.000000,
-    0.785899, -0.485712, 0.382683,
-    0.000000, 1.000000,
-    0.760406, -0.552454, 0.341435,
-    0.500000, 0.133975,
-    0.735011, -0.536784, 0.414273,
-    1.000000, 1.000000,
-    0.757935, -0.468430, 0.453990,
-    0.000000, 1.000000,
-    0.785899, -0.485712, 0.382683,
-    0.500000, 0.133975,
-    0.735011, -0.536784, 0.414273,
-    1.000000, 1.000000,
-    0.785899, -0.485712, 0.382683,
-    0.000000, 1.000000,
-    0.809017, -0.500000, 0.309017,
-    0.500000, 0.133975,
-    0.760406, -0.552454, 0.341435,
-    1.000000, 1.000000,
-    0.322141, -0.583691, 0.745338,
-    0.000000, 1.000000,
-    0.255180, -0.610926, 0.749435,
-    0.500000, 0.133975,
-    0.280319, -0.545109, 0.790112,
-    1.000000, 1.000000,
-    0.346153, -0.516122, 0.783452,
-    0.000000, 1.000000,
-    0.322141, -0.583691, 0.745338,
-    0.500000, 0.133975,
-    0.280319, -0.545109, 0.790112,
-    1.000000, 1.000000,
-    0.322141, -0.583691, 0.745338,
-    0.000000, 1.000000,
-    0.296005, -0.647412, 0.702310,
-    0.500000, 0.133975,
-    0.255180, -0.610926, 0.749435,
-    1.000000, 1.000000,
-    0.303801, -0.476226, 0.825175,
-    0.000000, 1.000000,
-    0.280319, -0.545109, 0.790112,
-    0.500000, 0.133975,
-    0.237229, -0.504209, 0.830359,
-    1.000000, 1.000000,
-    0.259892, -0.433889, 0.862668,
-    0.000000, 1.000000,
-    0.303801, -0.476226, 0.825175,
-    0.500000, 0.133975,
-    0.237229, -0.504209, 0.830359,
-    1.000000, 1.000000,
-    0.303801, -0.476226, 0.825175,
-    0.000000, 1.000000,
-    0.346153, -0.516122, 0.783452,
-    0.500000, 0.133975,
-    0.280319, -0.545109, 0.790112,
-    1.000000, 1.000000,
-    0.386730, -0.553372, 0.737712,
-    0.000000, 1.000000,
-    0.361592, -0.619186, 0.697037,
-    0.500000, 0.133975,
-    0.322141, -0.583691, 0.745338,
-    1.000000, 1.000000,
-    0.346153, -0.516122, 0.783452,
-    0.000000, 1.000000,
-    0.386730, -0.553372, 0.737712,
-    0.500000, 0.133975,
-    0.322141, -0.583691, 0.745338,
-    1.000000, 1.000000,
-    0.386730, -0.553372, 0.737712,
-    0.000000, 1.000000,
-    0.425325, -0.587785, 0.688191,
-    0.500000, 0.133975,
-    0.361592, -0.619186, 0.697037,
-    1.000000, 1.000000,
-    0.172532, -0.529135, 0.830812,
-    0.000000, 1.000000,
-    0.147414, -0.594895, 0.790170,
-    0.500000, 0.133975,
-    0.106494, -0.551859, 0.827110,
-    1.000000, 1.000000,
-    0.131200, -0.484442, 0.864929,
-    0.000000, 1.000000,
-    0.172532, -0.529135, 0.830812,
-    0.500000, 0.133975,
-    0.106494, -0.551859, 0.827110,
-    1.000000, 1.000000,
-    0.172532, -0.529135, 0.830812,
-    0.000000, 1.000000,
-    0.213023, -0.571252, 0.792649,
-    0.500000, 0.133975,
-    0.147414, -0.594895, 0.790170,
-    1.000000, 1.000000,
-    0.065758, -0.506298, 0.859848,
-    0.000000, 1.000000,
-    0.106494, -0.551859, 0.827110,
-    0.500000, 0.133975,
-    0.040640, -0.572056, 0.819207,
-    1.000000, 1.000000,
-    0.000000, -0.525731, 0.850651,
-    0.000000, 1.000000,
-    0.065758, -0.506298, 0.859848,
-    0.500000, 0.133975,
-    0.040640, -0.572056, 0.819207,
-    1.000000, 1.000000,
-    0.065758, -0.506298, 0.859848,
-    0.000000, 1.000000,
-    0.131200, -0.484442, 0.864929,
-    0.500000, 0.133975,
-    0.106494, -0.551859, 0.827110,
-    1.000000, 1.000000,
-    0.196015, -0.460267, 0.865871,
-    0.000000, 1.000000,
-    0.237229, -0.504209, 0.830359,
-    0.500000, 0.133975,
-    0.172532, -0.529135, 0.830812,
-    1.000000, 1.000000,
-    0.131200, -0.484442, 0.864929,
-    0.000000, 1.000000,
-    0.196015, -0.460267, 0.865871,
-    0.500000, 0.133975,
-    0.172532, -0.529135, 0.830812,
-    1.000000, 1.000000,
-    0.196015, -0.460267, 0.865871,
-    0.000000, 1.000000,
-    0.259892, -0.433889, 0.862668,
-    0.500000, 0.133975,
-    0.237229, -0.504209, 0.830359,
-    1.000000, 1.000000,
-    0.427135, -0.415597, 0.803016,
-    0.000000, 1.000000,
-    0.408286, -0.486240, 0.772575,
-    0.500000, 0.133975,
-    0.366027, -0.446977, 0.816233,
-    1.000000, 1.000000,
-    0.383614, -0.375039, 0.843911,
-    0.000000, 1.000000,
-    0.427135, -0.415597, 0.803016,
-    0.500000, 0.133975,
-    0.366027, -0.446977, 0.816233,
-    1.000000, 1.000000,
-    0.427135, -0.415597, 0.803016,
-    0.000000, 1.000000,
-    0.468430, -0.453990, 0.757935,
-    0.500000, 0.133975,
-    0.408286, -0.486240, 0.772575,
-    1.000000, 1.000000,
-    0.322525, -0.405434, 0.855337,
-    0.000000, 1.000000,
-    0.366027, -0.446977, 0.816233,
-    0.500000, 0.133975,
-    0.303801, -0.476226, 0.825175,
-    1.000000, 1.000000,
-    0.259892, -0.433889, 0.862668,
-    0.000000, 1.000000,
-    0.322525, -0.405434, 0.855337,
-    0.500000, 0.133975,
-    0.303801, -0.476226, 0.825175,
-    1.000000, 1.000000,
-    0.322525, -0.405434, 0.855337,
-    0.000000, 1.000000,
-    0.383614, -0.375039, 0.843911,
-    0.500000, 0.133975,
-    0.366027, -0.446977, 0.816233,
-    1.000000, 1.000000,
-    0.442867, -0.342848, 0.828447,
-    0.000000, 1.000000,
-    0.485712, -0.382683, 0.785899,
-    0.500000, 0.133975,
-    0.427135, -0.415597, 0.803016,
-    1.000000, 1.000000,
-    0.383614, -0.375039, 0.843911,
-    0.000000, 1.000000,
-    0.442867, -0.342848, 0.828447,
-    0.500000, 0.133975,
-    0.427135, -0.415597, 0.803016,
-    1.000000, 1.000000,
-    0.442867, -0.342848, 0.828447,
-    0.000000, 1.000000,
-    0.500000, -0.309017, 0.809017,
-    0.500000, 0.133975,
-    0.485712, -0.382683, 0.785899,
-    1.000000, 1.000000,
-    0.790112, -0.280319, 0.545109,
-    0.000000, 1.000000,
-    0.745338, -0.322141, 0.583691,
-    0.500000, 0.133975,
-    0.749435, -0.255180, 0.610926,
-    1.000000, 1.000000,
-    0.792649, -0.213023, 0.571252,
-    0.000000, 1.000000,
-    0.790112, -0.280319, 0.545109,
-    0.500000, 0.133975,
-    0.749435, -0.255180, 0.610926,
-    1.000000, 1.000000,
-    0.790112, -0.280319, 0.545109,
-    0.000000, 1.000000,
-    0.783452, -0.346153, 0.516122,
-    0.500000, 0.133975,
-    0.745338, -0.322141, 0.583691,
-    1.000000, 1.000000,
-    0.749786, -0.187432, 0.634579,
-    0.000000, 1.000000,
-    0.749435, -0.255180, 0.610926,
-    0.500000, 0.133975,
-    0.703983, -0.228900, 0.672319,
-    1.000000, 1.000000,
-    0.702046, -0.160622, 0.693780,
-    0.000000, 1.000000,
-    0.749786, -0.187432, 0.634579,
-    0.500000, 0.133975,
-    0.703983, -0.228900, 0.672319,
-    1.000000, 1.000000,
-    0.749786, -0.187432, 0.634579,
-    0.000000, 1.000000,
-    0.792649, -0.213023, 0.571252,
-    0.500000, 0.133975,
-    0.749435, -0.255180, 0.610926,
-    1.000000, 1.000000,
-    0.830359, -0.237229, 0.504209,
-    0.000000, 1.000000,
-    0.825175, -0.303801, 0.476226,
-    0.500000, 0.133975,
-    0.790112, -0.280319, 0.545109,
-    1.000000, 1.000000,
-    0.792649, -0.213023, 0.571252,
-    0.000000, 1.000000,
-    0.830359, -0.237229, 0.504209,
-    0.500000, 0.133975,
-    0.790112, -0.280319, 0.545109,
-    1.000000, 1.000000,
-    0.830359, -0.237229, 0.504209,
-    0.000000, 1.000000,
-    0.862668, -0.259892, 0.433889,
-    0.500000, 0.133975,
-    0.825175, -0.303801, 0.476226,
-    1.000000, 1.000000,
-    0.656620, -0.267381, 0.705236,
-    0.000000, 1.000000,
-    0.653497, -0.334692, 0.678913,
-    0.500000, 0.133975,
-    0.605741, -0.305212, 0.734794,
-    1.000000, 1.000000,
-    0.606825, -0.237086, 0.758652,
-    0.000000, 1.000000,
-    0.656620, -0.267381, 0.705236,
-    0.500000, 0.133975,
-    0.605741, -0.305212, 0.734794,
-    1.000000, 1.000000,
-    0.656620, -0.267381, 0.705236,
-    0.000000, 1.000000,
-    0.702310, -0.296005, 0.647412,
-    0.500000, 0.133975,
-    0.653497, -0.334692, 0.678913,
-    1.000000, 1.000000,
-    0.554740, -0.273707, 0.785715,
-    0.000000, 1.000000,
-    0.605741, -0.305212, 0.734794,
-    0.500000, 0.133975,
-    0.552454, -0.341435, 0.760406,
-    1.000000, 1.000000,
-    0.500000, -0.309017, 0.809017,
-    0.000000, 1.000000,
-    0.554740, -0.273707, 0.785715,
-    0.500000, 0.133975,
-    0.552454, -0.341435, 0.760406,
-    1.000000, 1.000000,
-    0.554740, -0.273707, 0.785715,
-    0.000000, 1.000000,
-    0.606825, -0.237086, 0.758652,
-    0.500000, 0.133975,
-    0.605741, -0.305212, 0.734794,
-    1.000000, 1.000000,
-    0.656006, -0.199331, 0.727958,
-    0.000000, 1.000000,
-    0.703983, -0.228900, 0.672319,
-    0.500000, 0.133975,
-    0.656620, -0.267381, 0.705236,
-    1.000000, 1.000000,
-    0.606825, -0.237086, 0.758652,
-    0.000000, 1.000000,
-    0.656006, -0.199331, 0.727958,
-    0.500000, 0.133975,
-    0.656620, -0.267381, 0.705236,
-    1.000000, 1.000000,
-    0.656006, -0.199331, 0.727958,
-    0.000000, 1.000000,
-    0.702046, -0.160622, 0.693780,
-    0.500000, 0.133975,
-    0.703983, -0.228900, 0.672319,
-    1.000000, 1.000000,
-    0.827110, -0.106494, 0.551859,
-    0.000000, 1.000000,
-    0.830812, -0.172532, 0.529135,
-    0.500000, 0.133975,
-    0.790170, -0.147414, 0.594895,
-    1.000000, 1.000000,
-    0.783843, -0.081086, 0.615642,
-    0.000000, 1.000000,
-    0.827110, -0.106494, 0.551859,
-    0.500000, 0.133975,
-    0.790170, -0.147414, 0.594895,
-    1.000000, 1.000000,
-    0.827110, -0.106494, 0.551859,
-    0.000000, 1.000000,
-    0.864929, -0.131200, 0.484442,
-    0.500000, 0.133975,
-    0.830812, -0.172532, 0.529135,
-    1.000000, 1.000000,
-    0.744727, -0.121144, 0.656282,
-    0.000000, 1.000000,
-    0.790170, -0.147414, 0.594895,
-    0.500000, 0.133975,
-    0.749786, -0.187432, 0.634579,
-    1.000000, 1.000000,
-    0.702046, -0.160622, 0.693780,
-    0.000000, 1.000000,
-    0.744727, -0.121144, 0.656282,
-    0.500000, 0.133975,
-    0.749786, -0.187432, 0.634579,
-    1.000000, 1.000000,
-    0.744727, -0.121144, 0.656282,
-    0.000000, 1.000000,
-    0.783843, -0.081086, 0.615642,
-    0.500000, 0.133975,
-    0.790170, -0.147414, 0.594895,
-    1.000000, 1.000000,
-    0.819207, -0.040640, 0.572056,
-    0.000000, 1.000000,
-    0.859848, -0.065758, 0.506298,
-    0.500000, 0.133975,
-    0.827110, -0.106494, 0.551859,
-    1.000000, 1.000000,
-    0.783843, -0.081086, 0.615642,
-    0.000000, 1.000000,
-    0.819207, -0.040640, 0.572056,
-    0.500000, 0.133975,
-    0.827110, -0.106494, 0.551859,
-    1.000000, 1.000000,
-    0.819207, -0.040640, 0.572056,
-    0.000000, 1.000000,
-    0.850651, 0.000000, 0.525731,
-    0.500000, 0.133975,
-    0.859848, -0.065758, 0.506298,
-    1.000000, 1.000000,
-};
@@ -3,7 +3,7 @@
 #import <string>
 #import <iostream>
 #import "Interfaces.hpp"
-#import "../PowerVR/PVRTTexture.h"
+#import "../../Common/Classes/PvrTexture.hpp"
 
 using namespace std;
 
@@ -20,11 +20,85 @@ public:
 
         m_hasPvrHeader = false;
 
+        UIImage* uiImage = [UIImage imageWithContentsOfFile:GetFullPath(file)];
+        TextureDescription description = DescribeImagePot(uiImage);
+        int bpp = description.BitsPerComponent / 2;
+        int byteCount = description.Size.x * description.Size.y * bpp;
+        unsigned char* data = (unsigned char*) calloc(byteCount, 1);
+        DrawImagePot(uiImage, description, data);
+        m_imageData = [NSData dataWithBytesNoCopy:data length:byteCount freeWhenDone:YES];
+        return description;
+    }
+    TextureDescription LoadPvrImage(const string& file)
+    {
+        m_imageData = [NSData dataWithContentsOfFile:GetFullPath(file)];
+        m_hasPvrHeader = true;
+        m_pvrTexture.Parse([m_imageData bytes], [m_imageData length]);
+        return DescribePvrImage(m_pvrTexture);
+    }
+    void* GetImageData()
+    {
+        if (!m_hasPvrHeader)
+            return (void*) [m_imageData bytes];
+        
+        return (void*) m_pvrTexture.GetData();
+    }
+    void UnloadImage()
+    {
+        m_imageData = 0;
+    }
+
+    // Unlike the methods above, this keeps nothing between calls, so the
+    // texture loader's workers can call it all at once.  They have no
+    // autorelease pool of their own.
+    bool Decode(const string& file, DecodedImage& image)
+    {
+        NSAutoreleasePool* pool = [[NSAutoreleasePool alloc] init];
+        TextureDescription description;
+        bool decoded = false;
+        if (file.find(".pvr") != string::npos) {
+            NSData* data = [NSData dataWithContentsOfFile:GetFullPath(file)];
+            PvrTexture texture;
+            texture.Parse([data bytes], [data length]);
+            description = DescribePvrImage(texture);
+            if (description.MipCount) {
+                const unsigned char* bytes = texture.GetData();
+                image.Pixels.assign(bytes, bytes + texture.GetDataSize());
+                decoded = true;
+            }
+        } else {
+            UIImage* uiImage = [UIImage imageWithContentsOfFile:GetFullPath(file)];
+            if (uiImage) {
+                description = DescribeImagePot(uiImage);
+                image.Pixels.resize(description.Size.x * description.Size.y *
+                                    description.BitsPerComponent / 2);
+                DrawImagePot(uiImage, description, &image.Pixels[0]);
+                decoded = true;
+            }
+        }
+        if (decoded) {
+            image.Format = description.Format;
+            image.BitsPerComponent = description.BitsPerComponent;
+            image.Width = description.Size.x;
+            image.Height = description.Size.y;
+            image.MipCount = description.MipCount;
+        }
+        [pool release];
+        return decoded;
+    }
+
+private:
+    NSData* m_imageData;
+    PvrTexture m_pvrTexture;
+    bool m_hasPvrHeader;
+    NSString* GetFullPath(const string& file)
+    {
         NSString* basePath = [NSString stringWithUTF8String:file.c_str()];
         NSString* resourcePath = [[NSBundle mainBundle] resourcePath];
-        NSString* fullPath = [resourcePath stringByAppendingPathComponent:basePath];
-        UIImage* uiImage = [UIImage imageWithContentsOfFile:fullPath];
-        
+        return [resourcePath stringByAppendingPathComponent:basePath];
+    }
+    TextureDescription DescribeImagePot(UIImage* uiImage)
+    {
         TextureDescription description;
         description.OriginalSize.x = CGImageGetWidth(uiImage.CGImage);
         description.OriginalSize.y = CGImageGetHeight(uiImage.CGImage);
@@ -32,11 +106,12 @@ public:
         description.Size.y = NextPot(description.OriginalSize.y);
         description.BitsPerComponent = 8;
         description.Format = TextureFormatRgba;
-        
+        description.MipCount = 1;
+        return description;
+    }
+    void DrawImagePot(UIImage* uiImage, const TextureDescription& description, void* data)
+    {
         int bpp = description.BitsPerComponent / 2;
-        int byteCount = description.Size.x * description.Size.y * bpp;
-        unsigned char* data = (unsigned char*) calloc(byteCount, 1);
-        
         CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
         CGBitmapInfo bitmapInfo = kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Big;
         CGContextRef context = CGBitmapContextCreate(data,
@@ -50,82 +125,66 @@ public:
         CGRect rect = CGRectMake(0, 0, description.Size.x, description.Size.y);
         CGContextDrawImage(context, rect, uiImage.CGImage);
         CGContextRelease(context);
-        
-        m_imageData = [NSData dataWithBytesNoCopy:data length:byteCount freeWhenDone:YES];
-        return description;
     }
-    TextureDescription LoadPvrImage(const string& file)
+    // A bad or unsupported image comes back with no levels.
+    TextureDescription DescribePvrImage(const PvrTexture& texture)
     {
-        NSString* basePath = [NSString stringWithUTF8String:file.c_str()];
-        NSString* resourcePath = [[NSBundle mainBundle] resourcePath];
-        NSString* fullPath = [resourcePath stringByAppendingPathComponent:basePath];
+        TextureDescription description;
+        description.Format = TextureFormatRgba;
+        description.BitsPerComponent = 8;
+        description.Size = ivec2(0, 0);
+        description.OriginalSize = description.Size;
+        description.MipCount = 0;
+        if (!texture.IsValid()) {
+            cout << "Bad PVR image: "
+                 << PvrTexture::GetErrorString(texture.GetError()) << endl;
+            return description;
+        }
         
-        m_imageData = [NSData dataWithContentsOfFile:fullPath];
-        m_hasPvrHeader = true;
-        PVR_Texture_Header* header = (PVR_Texture_Header*) [m_imageData bytes];
-        bool hasAlpha = header->dwAlphaBitMask ? true : false;
+        bool hasAlpha = texture.HasAlpha();
         
-        TextureDescription description;
-        printf("pixel type = %8.8x", header->dwpfFlags & PVRTEX_PIXELTYPE);
-        switch (header->dwpfFlags & PVRTEX_PIXELTYPE) {
-            case OGL_AI_88:
+        switch (texture.GetPixelType()) {
+            case PvrPixelTypeAi88:
                 description.Format = TextureFormatGrayAlpha;
                 description.BitsPerComponent = 16;
                 break;
-            case OGL_I_8:
+            case PvrPixelTypeI8:
                 description.Format = TextureFormatGray;
                 description.BitsPerComponent = 8;
                 break;
-            case OGL_RGBA_8888:
+            case PvrPixelTypeRgba8888:
                 description.Format = TextureFormatRgba;
                 description.BitsPerComponent = 8;
                 break;
-            case OGL_RGB_565:
+            case PvrPixelTypeRgb565:
                 description.Format = TextureFormat565;
                 break;
-            case OGL_RGBA_5551:
+            case PvrPixelTypeRgba5551:
                 description.Format = TextureFormat5551;
                 break;
-            case OGL_RGBA_4444:
+            case PvrPixelTypeRgba4444:
                 description.Format = TextureFormatRgba;
                 description.BitsPerComponent = 4;
                 break;
-            case OGL_PVRTC2:    
+            case PvrPixelTypePvrtc2:
                 description.Format = hasAlpha ? TextureFormatPvrtcRgba2 :
                 TextureFormatPvrtcRgb2;
                 break;
-            case OGL_PVRTC4:
+            case PvrPixelTypePvrtc4:
                 description.Format = hasAlpha ? TextureFormatPvrtcRgba4 :
                 TextureFormatPvrtcRgb4;
                 break;
             default:
-                assert(!"Unsupported PVR image.");
-                break;
+                cout << "Unsupported PVR image." << endl;
+                return description;
         }
         
-        description.Size.x = header->dwWidth;
-        description.Size.y = header->dwHeight;
-        description.MipCount = header->dwMipMapCount;
+        description.Size.x = texture.GetWidth();
+        description.Size.y = texture.GetHeight();
+        description.OriginalSize = description.Size;
+        description.MipCount = texture.GetLevelCount();
         return description;
     }
-    void* GetImageData()
-    {
-        if (!m_hasPvrHeader)
-            return (void*) [m_imageData bytes];
-        
-        PVR_Texture_Header* header = (PVR_Texture_Header*) [m_imageData bytes];
-        char* data = (char*) [m_imageData bytes];
-        unsigned int headerSize = header->dwHeaderSize;
-        return data + headerSize;
-    }
-    void UnloadImage()
-    {
-        m_imageData = 0;
-    }
-
-private:
-    NSData* m_imageData;
-    bool m_hasPvrHeader;
     unsigned int NextPot(unsigned int n)
     {
         n--;
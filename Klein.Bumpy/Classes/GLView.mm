@@ -1,11 +1,19 @@
 #import "GLView.h"
-#include "../Textures/Tiger565.h"
+#include "../../Common/Classes/Profiler.hpp"
 #include "../Textures/TangentSpaceNormals.h"
-#include "../Textures/ObjectSpaceNormals.h"
 #import <OpenGLES/ES2/gl.h> // <-- for GL_RENDERBUFFER only
+#import <string>
 
 const bool ForceES1 = false;
 
+std::string GetResourcePath(const std::string& file)
+{
+    NSString* basePath = [NSString stringWithUTF8String:file.c_str()];
+    NSString* resourcePath = [[NSBundle mainBundle] resourcePath];
+    NSString* fullPath = [resourcePath stringByAppendingPathComponent:basePath];
+    return [fullPath UTF8String];
+}
+
 @implementation GLView
 
 + (Class) layerClass
@@ -72,6 +80,7 @@ const bool ForceES1 = false;
     
     m_renderingEngine->Render(m_theta);
     [m_context presentRenderbuffer:GL_RENDERBUFFER];
+    PROFILE_FRAME();
 }
 
 @end
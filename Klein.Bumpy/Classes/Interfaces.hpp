@@ -1,11 +1,12 @@
 #pragma once
 #include "Vector.hpp"
+#include <string>
 #include <vector>
 
-extern const unsigned int TigerTexture[131124];
-extern const unsigned int ObjectSpaceNormals[];
 extern const unsigned int TangentSpaceNormals[];
 
+std::string GetResourcePath(const std::string& file);
+
 enum VertexFlags {
     VertexFlagsNormals = 1 << 0,
     VertexFlagsTexCoords = 1 << 1,
@@ -1,34 +1,4 @@
 
-struct PVRTextureHeader {
-    unsigned int HeaderSize;
-    unsigned int Height;
-    unsigned int Width;
-    unsigned int MipMapCount;
-    unsigned int Flags;
-    unsigned int TextureDataSize;
-    unsigned int BitCount;
-    unsigned int RBitMask;
-    unsigned int GBitMask;
-    unsigned int BBitMask;
-    unsigned int AlphaBitMask;
-    unsigned int PVR;
-    unsigned int NumSurfs;
-};
-
-enum PVRPixelType {
-    OGL_RGBA_4444 = 0x10,
-    OGL_RGBA_5551,
-    OGL_RGBA_8888,
-    OGL_RGB_565,
-    OGL_RGB_555,
-    OGL_RGB_888,
-    OGL_I_8,
-    OGL_AI_88,
-    OGL_PVRTC2,
-    OGL_PVRTC4,
-    PVRTEX_PIXELTYPE = 0xff,
-};
-
 struct Framebuffers {
     GLuint Screen;
 };
@@ -51,59 +21,20 @@ struct Drawable {
     int Flags;
 };
 
-GLuint CreateTexture(const unsigned int* data)
+GLuint CreateTexture(const void* data, size_t size = PvrTexture::UnknownSize)
 {
-    PVRTextureHeader* header = (PVRTextureHeader*) data;
-    GLsizei w = header->Width;
-    GLsizei h = header->Height;
-    const unsigned int* texels = data + header->HeaderSize / 4;
-    
+    PvrTexture texture;
+    texture.Parse(data, size);
+    assert(texture.IsValid() && "Bad texture.");
+
     GLuint name;
     glGenTextures(1, &name);
     glBindTexture(GL_TEXTURE_2D, name);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    
-    switch (header->Flags & PVRTEX_PIXELTYPE) {
-        case OGL_I_8: {
-            GLenum format = GL_ALPHA;
-            GLenum type = GL_UNSIGNED_BYTE;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_AI_88: {
-            GLenum format = GL_LUMINANCE_ALPHA;
-            GLenum type = GL_UNSIGNED_BYTE;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_RGB_888: {
-            GLenum format = GL_RGB;
-            GLenum type = GL_UNSIGNED_BYTE;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_RGB_565: {
-            GLenum format = GL_RGB;
-            GLenum type = GL_UNSIGNED_SHORT_5_6_5;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_RGBA_8888: {
-            GLenum format = GL_RGBA;
-            GLenum type = GL_UNSIGNED_BYTE;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        default: {
-            w = h = 512;
-            GLsizei size = max(32, w * h / 2);
-            GLenum format = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG;
-            glCompressedTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, size, data);
-            break;
-        }
-    }
-    
+    if (!UploadPvrTexture(texture))
+        printf("Unknown format.\n");
+
     return name;
 }
 
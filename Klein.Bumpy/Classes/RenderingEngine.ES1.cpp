@@ -2,6 +2,9 @@
 #include <OpenGLES/ES1/glext.h>
 #include "ParametricSurface.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/AssetPack.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include "../../Common/Classes/PvrUpload.hpp"
 
 using namespace std;
 
@@ -20,6 +23,7 @@ private:
     Renderbuffers m_renderbuffers;
     Framebuffers m_framebuffers;
     Drawable m_kleinBottle;
+    AssetPack m_assets;
 };
 
 IRenderingEngine* CreateRenderingEngine()
@@ -35,9 +39,17 @@ RenderingEngine::RenderingEngine()
 
 void RenderingEngine::Initialize()
 {
-    // Load up some textures and VBOs:
-    m_textures.Tiger = CreateTexture(TigerTexture);
-    m_textures.ObjectSpaceNormals = CreateTexture(ObjectSpaceNormals);
+    // Load up some textures and VBOs.  The pack stays mapped, but once GL
+    // has a copy of each texture its pages can go.
+    string packPath = GetResourcePath("Textures.pack");
+    if (m_assets.Open(packPath.c_str()) != AssetPackErrorNone)
+        printf("%s: %s.\n", packPath.c_str(), AssetPack::GetErrorString(m_assets.GetError()));
+    AssetEntry tiger = m_assets.Find("Tiger");
+    AssetEntry objectSpaceNormals = m_assets.Find("ObjectSpaceNormals");
+    m_textures.Tiger = CreateTexture(tiger.Data, tiger.Size);
+    m_textures.ObjectSpaceNormals = CreateTexture(objectSpaceNormals.Data, objectSpaceNormals.Size);
+    m_assets.Release(tiger);
+    m_assets.Release(objectSpaceNormals);
     m_kleinBottle = CreateDrawable(KleinBottle(0.2), VertexFlagsTexCoords);
     
     // Extract width and height from the color buffer:
@@ -84,6 +96,7 @@ void RenderingEngine::Initialize()
 
 void RenderingEngine::Render(float theta) const
 {
+    PROFILE_ZONE("ES1::RenderingEngine::Render");
     const float distance = 10;
     const vec3 eye(0, 0, distance);
     const vec3 target(0, 0, 0);
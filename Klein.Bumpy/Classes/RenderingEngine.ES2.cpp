@@ -2,6 +2,9 @@
 #include <OpenGLES/ES2/glext.h>
 #include "ParametricSurface.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/AssetPack.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include "../../Common/Classes/PvrUpload.hpp"
 #include <iostream>
 
 #define STRINGIFY(A)  #A
@@ -58,6 +61,7 @@ private:
     Framebuffers m_framebuffers;
     ProgramHandles m_simple;
     ProgramHandles m_bump;
+    AssetPack m_assets;
 };
 
 IRenderingEngine* CreateRenderingEngine()
@@ -84,10 +88,18 @@ void PrettyPrintExtensions()
     
 void RenderingEngine::Initialize()
 {
-    // Load up some textures and VBOs:
-    m_textures.Tiger = CreateTexture(TigerTexture);
+    // Load up some textures and VBOs.  The pack stays mapped, but once GL
+    // has a copy of each texture its pages can go.
+    string packPath = GetResourcePath("Textures.pack");
+    if (m_assets.Open(packPath.c_str()) != AssetPackErrorNone)
+        cout << packPath << ": " << AssetPack::GetErrorString(m_assets.GetError()) << ".\n";
+    AssetEntry tiger = m_assets.Find("Tiger");
+    m_textures.Tiger = CreateTexture(tiger.Data, tiger.Size);
+    m_assets.Release(tiger);
 
-    m_textures.ObjectSpaceNormals = CreateTexture(ObjectSpaceNormals);
+    AssetEntry objectSpaceNormals = m_assets.Find("ObjectSpaceNormals");
+    m_textures.ObjectSpaceNormals = CreateTexture(objectSpaceNormals.Data, objectSpaceNormals.Size);
+    m_assets.Release(objectSpaceNormals);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR); 
     glGenerateMipmap(GL_TEXTURE_2D);
 
@@ -153,6 +165,7 @@ void RenderingEngine::Initialize()
 
 void RenderingEngine::Render(float theta) const
 {
+    PROFILE_ZONE("ES2::RenderingEngine::Render");
     // Render the background image:
     {
         const float distance = 10;
@@ -45,17 +45,25 @@ for i in xrange(2):
 img.save("HeightMap.png")
 showImage("HeightMap.png")
 
+# TextureCooker can't derive normals from a height map, so the tangent-space
+# normals still come from PVRTexTool as a header.
 path = '/Users/prideout/Documents/PowerVR-ES2/Utilities/'
-textool = 'PVRTexTool/PVRTexToolCL/MacOS/PVRTexTool -h -yflip1 -fOGL888 -i'
 normaltool = 'PVRTexTool/PVRTexToolCL/MacOS/PVRTexTool -h -yflip1 -b -c2.0 -fOGL888 -i'
 filewrap = 'Filewrap/MacOS/Filewrap -h -o '
 
 system(path + normaltool + "HeightMap.png -oTangentSpaceNormals.h")
-system(path + textool + "ObjectSpaceNormals.png")
 
 fromStr = "static const unsigned long" 
 toStr = "const unsigned int" 
 
-for filename in ['TangentSpaceNormals.h', 'ObjectSpaceNormals.h']:
+for filename in ['TangentSpaceNormals.h']:
 	for line in fileinput.FileInput(filename, inplace=1):
 		print line.replace(fromStr, toStr),
+
+# Cook and pack the other textures:
+
+# Build with: g++ -O2 -o TextureCooker TextureCooker.cpp -lpng -lpthread
+#             g++ -O2 -o AssetPacker AssetPacker.cpp
+tools = '../../Common/Tools/'
+system(tools + 'TextureCooker -f 888 -m none -linear ObjectSpaceNormals.png ObjectSpaceNormals.pvr')
+system(tools + 'AssetPacker Textures.pack Tiger=Tiger565.pvr ObjectSpaceNormals.pvr')
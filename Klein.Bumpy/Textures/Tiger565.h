@@ -1,530 +0,0 @@
-// This file was created by Filewrap 1.1
-// Little endian mode
-// DO NOT EDIT
-
-// using 32 bit to guarantee alignment.
-#ifndef A32BIT
- #define A32BIT const unsigned int
-#endif
-
-// ******** Start: Tiger565.pvr ********
-
-// File data
-A32BIT TigerTexture[] = {
-0x34,0x100,0x100,0x0,0x10013,0x20000,0x10,0xf800,0x7e0,0x1f,0x0,0x21525650,0x1,0x72296a49,0x7a2a7a29,0x722b7a2b,0x62096a0a,0x6a296229,0x5a096a2a,0x52485a29,0x69e85a28,0x618869c9,0x61c75987,0x69c869e8,0x616761a7,0x71686947,0x59876167,0x59a659c7,0x59245144,0x59245944,0x51245103,0x51245965,0x49044903,0x51454904,0x40c35105,0x51045966,0x594648e4,0x41045166,0x51245145,0x614550c3,0x48e45904,0x51265145,0x59455105,0x49055125,0x51254925,0x61055905,0x51046104,0x50e35103,0x69656144,0x590458e3,0x61a66165,0x59236185,0x58c250e2,0x490348a2,0x6a0661c6,0x61a661a5,0x50a35944,0x50a25903,0x590350c2,0x61646164,0x58e250c1,0x59435944,0x59435123,0x61835963,
-0x61646184,0x62267206,0x62266246,0x72277226,0x72277207,0x6a477a88,0x72676a06,0x720661c5,0x69e57a47,0x7a8869e6,0x72467226,0x7a6782c8,0x82687a47,0x61a57a27,0x7ac87aa8,0x7a677287,0x69e68288,0x7a4769c6,0x616469c5,0x8a6771c5,0x59238206,0x7a686164,0x932a932a,0x69e582a8,0x61846984,0x71e66944,0x8aa992a8,0x72267a67,0x598461e5,0x7aa86184,0x9b8c9b8b,0x61c582c9,0x71e75124,0x69c68228,0x9b6b61a5,0x7a88a3cd,0xabae930b,0x726882a9,0x82ea9b6c,0x82a96a27,0x9b2b9b0a,0x71e58a68,0x724669c4,0xa3498ae8,0x82269309,0x79a57184,0x92e98226,0x7a2692c8,0x820779c6,0x8a488a28,0x92ea7a07,0x7a688268,0x934b932b,0x7ac982ea,0x934c8b4b,0x834a7248,0x8b6a93ed,0x830b7ae9,0x830a938d,0x936b7a88,0x734a93ab,0x832b6ac9,0x7aa88b6c,0x936b7ac9,
-0x72477ac9,0x8aca82aa,0x69e67a28,0x82687a49,0x7a278268,0x7a8869e5,0x7b298b2a,0x7aa972c9,0x7a887a88,0x72c982e9,0x82e97ac9,0x6a267aa8,0x8ae97246,0xad12ad12,0xa4d2acf2,0xacf3acd3,0xacd2acd3,0xacd1a491,0xa4d2a4d2,0xa492a4b1,0xac91acd2,0xacf2bcb2,0xa451acd2,0xac92b472,0xb491ac91,0xa450a430,0x94b0a4b1,0xa4919c70,0xa431ac71,0xa410a411,0x9c519bef,0x94109c30,0x9c319c31,0x93ef9c11,0x8bef83ae,0x8bef8bef,0x83ee8bef,0x941083ef,0x8bad8bef,0x93ee940e,0x94308bce,0x838d8bef,0x93ef8bae,0x8bae93ef,0x83ef83ce,0x8bee8bce,0x93ee93ee,0x940f8bcf,0x836d940f,0x93cf93ce,0x8b8e8b8e,0x8baf8b8e,0x83ae8b6e,0x8bcf9c0f,0x8bae836d,0x940f93ef,0x93ee9c30,0x838d8bce,0x7b6d836d,0x834d7b6d,0x7b4d7b6d,0x72cb832d,0x7acb72ab,0x6a6a7aab,
-0x6a696a8b,0x628a5a49,0x62696269,0x62295a29,0x5a286229,0x5a285a08,0x6a696249,0x59e76208,0x5a0859e8,0x59e85a29,0x51e759e7,0x5a085207,0x59e859e8,0x5a0859e8,0x59e759e7,0x61e959c7,0x59c96a09,0x59c759a7,0x51e651e6,0x51a651e6,0x61c75185,0x41455186,0x41244965,0x49454103,0x38a34104,0x514540e3,0x41654965,0x49254144,0x50e44904,0x48e45104,0x51865126,0x49244944,0x51264905,0x59245945,0x512548e3,0x59645965,0x6a2861c6,0x61e76207,0x61e67248,0x7a6859a6,0x7a4882aa,0x720682a9,0x8a8869a5,0x69848a68,0x8a8879e6,0x8aa869c5,0x932a9b2a,0x8aea936b,0x8aea7247,0x7aa9b3cd,0xa38b82c8,0x8a478ac8,0xa32aa32a,0x82677226,0x8aa9ab8c,0x82c87227,0x83497b08,0x938b93cb,0x7a2682c9,0xa38a7226,0x6245936a,0x8b2a6226,0x72468b49,0x8b4a9309,
-0x72a982ea,0x8aea7ae9,0x7a678248,0x7aa88b0a,0x7a478ae9,0x594361a5,0x7ac85984,0x9b0aa3ac,0x698471c5,0x83099329,0x7aa86246,0x72668ae8,0x8b098ae8,0xa5309cd0,0xad72a551,0xa4d1ad32,0xb531ad11,0xad31ad11,0xad11ad31,0xacf1ad12,0xb4f1acd1,0x9cd0acf1,0xad12ad11,0xacd2acf2,0xa4f1a4f1,0x9cd0b512,0xa5519cf0,0xacf1a512,0xad12b4f2,0xacf1acf2,0xacf2a4f1,0xa513ad33,0xa4f2a513,0x9cb1a4d1,0xa4f1a512,0xa532a512,0xa532a532,0x9cd1a512,0xb552a4f1,0xad52ad11,0xa4f2a512,0xad33ad13,0xad73ad52,0xa512ad12,0xa533a533,0xad31ad52,0xa512ad32,0xad32a4f1,0xa533a512,0xad33a4f2,0xb533b554,0xa4d2ad13,0xa533a513,0xa4f2a4d2,0xad13b533,0xad32ad12,0xa532a4d1,0x9cd09cf1,0x9cb19cd1,0xa4d29cd1,0xa4f2a4d2,0x9c91a4b2,0xa4d2a4b2,0xa4b2a4b2,
-0x9cb29c71,0x9c91a4f3,0x9c92a4b2,0xa4b2a492,0xa4d3a4b2,0xacd3acd3,0xa492acd3,0xacd3acd3,0xa4b2acb2,0xa4b3acb3,0xa4f29c51,0x94b2a4f2,0xacb3a4b3,0xa493ac73,0x9cb29c91,0xa4b2a4d2,0xa412a452,0xa4b1a451,0x94909c91,0x94309470,0x9c519c71,0x9c729c51,0x94309c51,0x9c109c31,0x9c109bf0,0x8b8f9bf0,0x83ef8bcf,0x8baf83cf,0x8b0d936f,0x82ed8b0d,0x7b0c7aec,0x6acb6acb,0x72496a6a,0x62086a28,0x62296208,0x59866208,0x51c759a7,0x51c649e7,0x51a64986,0x49865186,0x41654986,0x41654144,0x41044944,0x48e34104,0x38c240e3,0x412438c3,0x39443904,0x39244164,0x412438e4,0x49854124,0x51a54984,0x51034903,0x51035924,0x490348e3,0x71c76165,0x49235144,0x7ae96246,0x7a887b0a,0x61446165,0x596361a4,0x724761c5,0x62067267,0x824769e5,0x6a076184,
-0x8b4b72a8,0x82c98b4b,0x72267a27,0x8b2a9b6a,0x7a887267,0x824892ca,0x82a88268,0x69c561e6,0x79e58206,0x61c56164,0x6a466a46,0x69c569e5,0x69c461c4,0x6b297b8b,0x7b4b7309,0x6ae97b2b,0x6ac86ac9,0x72e97308,0x7b6b72e9,0x6b4a7b8c,0x838c736a,0x7b8b7b4a,0x736b7b6b,0x736a732a,0x7b6b7b6b,0x8bad836b,0x83ac83cc,0x93cd83ac,0x8bcb93ec,0x8c2c83eb,0x842d8c4c,0x8c4e844d,0x8c4e8c4e,0x842d842d,0x8c2d8c2e,0x8c4f9470,0x8c2d844e,0x8c6f842e,0x8c6e8c6f,0x9c8f94ae,0xa4d09caf,0x9cb0a4b0,0x8c4e9caf,0x9cd09cd0,0x9c709c90,0x9c8f9c8f,0x9caf9c8f,0xa46fa4b0,0x944e9c4e,0x9c8f946f,0x946f946f,0x9cb09cb0,0x9cd09cb0,0x9c6fa490,0x9caf9c6f,0x94af94af,0x8c6e948f,0x9c6e8c6e,0x9c8f9c6f,0x9c4fa46f,0x944e9c4e,0x946e9c8f,0x9cd09caf,0x94cf94b0,
-0x94cf9ccf,0x94d094cf,0x9cf0a511,0x9cf19cf0,0xa4d1a4f1,0xacf1ad11,0xa511ad11,0xacf1a4f1,0xacf1acf1,0xa4b1a4d1,0x9cd0ad11,0xa5119d10,0xacd1a4f1,0xad12acf2,0x94cfa511,0xa4f19cd0,0xa4d1a4f1,0xa4d0a4d0,0x9cd09ccf,0x946f9cb0,0x9cb19c90,0x9cd19cb1,0x94b19cd2,0x9cb194b1,0x9c509c90,0x9c909c50,0x94709470,0x94709490,0x94509470,0x944f8c2f,0x8c6f948f,0x8c4f8c70,0x9c709c4f,0x9450940f,0x94709470,0x8c2f8c50,0x940f940f,0x8c10942f,0x83ef8c0f,0x8bef83cf,0x83ae8bcf,0x838e83ae,0x83ae7b6d,0x732d7b6e,0x730d7b4d,0x7acc730d,0x6b0c7b0c,0x6acc630c,0x6a6b72ac,0x622a622a,0x51a85a29,0x59e959c9,0x498751a9,0x49884967,0x40c54126,0x38c440c5,0x30a338c3,0x30633063,0x48a440c4,0x40834083,0x38e338c3,0x38a340e4,0x48833042,0x30813882,
-0x51644943,0x514459a5,0x48e338a1,0x61c55984,0x59644943,0x59a571e6,0x7ae96247,0x61a56206,0x61857a48,0x7a487206,0x7a6982a9,0x698469a5,0x71c469a5,0x5a289c0f,0x7b0c3944,0x6a698b8e,0x7b0c6269,0x6aca834c,0x730b49e7,0x6b0a7b6c,0x732b6b0b,0x52287b4c,0x6aca5a48,0x52276aea,0x72ca49c6,0x49a5832c,0x7b2c49a6,0x41856a69,0x5a0751e6,0x41a549e6,0x730b41e5,0x522762ca,0x62aa5a89,0x39654206,0x49c73985,0x418549e7,0x62c941c6,0x49e65aa9,0x62c962a9,0x49e649c6,0x52275207,0x49e64a07,0x732b5268,0x4a275268,0x62a96aeb,0x49e65207,0x4a074a06,0x49a549e6,0x7b0b5a48,0x4a076268,0x6aca6aca,0x52074a06,0x52075207,0x49e65207,0x6aea62c9,0x5a684a27,0x52286b0b,0x520749c6,0x49e651e6,0x51e649e6,0x72ea6288,0x62c95a27,0x5a686aea,0x62685a67,
-0x5a685a68,0x62a962a9,0x72eb734b,0x6aea5a68,0x6ac97b2b,0x62a96aca,0x72ea6aca,0x72ea72ca,0x7b0b7b2b,0x834c72ca,0x72eb730b,0x72ca72ca,0x72ca72eb,0x730b6aca,0x6aea7b4c,0x6b0b6aea,0x6aca6aca,0x6aa972ca,0x7b4b6aca,0x72ea732b,0x730b730b,0x7b4c732b,0x6b2b7b6b,0x732b734b,0x83ad7b6c,0x7b2b734b,0x838d83ad,0x83ee7b6c,0x83cd83ee,0x944e8c0e,0x8c2e8c2e,0x944f946e,0x946e946f,0x9c909c90,0x946f948f,0x946e946e,0x944e942e,0x9490942e,0x8c2f8c50,0x8c4f8c4f,0x8c4f946f,0x94708c0e,0x8c4f8c4f,0x94709470,0x8c2f842f,0x94308c0e,0x83cf8c0f,0x940f8c0f,0x940f93ef,0x9c0f9c2f,0x940e9c2f,0x9c0f940f,0x8bae93ef,0x940f8bce,0x93ce8bce,0x940f93ce,0x8bef942f,0x8b8e8bce,0x836e7b2d,0x7b4d7b2d,0x730c7b0c,0x6acc730c,0x6a8b6aab,0x5a2a626a,
-0x624a6a8a,0x51c85a09,0x51a751c8,0x41464987,0x41054967,0x39043904,0x28a330e4,0x30e430c4,0x308330a3,0x30c438c4,0x30c330c4,0x38a338a3,0x40c340c3,0x49e7730b,0x52283944,0xb4d393ef,0x6a8a93cf,0x838e6249,0xacb2acb2,0x838d9c30,0x9c507b4d,0xacb29c70,0x6acb93ef,0x8bae6aab,0x9c30ac92,0x39456269,0x7b2c4166,0xac51a410,0x7b0c938e,0x93f0836d,0xa4929430,0xa4318baf,0x93f093f0,0x8bcf9c72,0x7b2d93f0,0x93d08b8f,0x838e9410,0x39455228,0x9c305a48,0x93cf93cf,0x8bae836d,0x836d8bad,0x9c3093cf,0x94108bad,0x940f9410,0x8b8e93ce,0x93ae8b8e,0x838e8bce,0x730b9c50,0x39654965,0x9c10732b,0x832d8b6e,0x93cf8b6e,0x7b6c834d,0x9c0f93ee,0x93ef93cf,0x9c1093cf,0x836d836d,0x834d834d,0x730b7b0c,0x6a89836d,0x49e74165,0x72eb8b6d,0x6a696228,
-0x628972a9,0x5a485207,0x72eb7b2c,0x832c6289,0x5a287b2c,0x626a5a28,0x626972ca,0x7aeb51e7,0x49c67b0b,0x7b2c49a6,0x51c77b2c,0x62496208,0x51c65a08,0x72cb5207,0x72cb834d,0x7b4d72eb,0x41c662ca,0x624a51e7,0x51c751e7,0x836d49c6,0x31246289,0x72ca5a08,0x41655a27,0x51e641a6,0x290349c6,0x62ca5227,0x49e65248,0x52285a68,0x41853144,0x41854185,0x39643964,0x524749e6,0x524849e7,0x41e64a06,0x522641e5,0x52075247,0x52275226,0x62ea62a9,0x732b62ea,0x6b2b732b,0x734b6b2b,0x83ac736b,0x7b8c83ad,0x8bee83cc,0x8bed83ed,0x7bad8bee,0x83cd8bcd,0x83ac83cd,0x5a67732a,0x49c54a05,0x398341a4,0x41a441c4,0x39843984,0x41843964,0x41c441a4,0x41c43183,0x5a885267,0x62ca5a87,0x7bad734c,0x83cd8c0f,0x8c2f8c0f,0x83ef83ef,0x8bef8c0f,0x8c109430,
-0x8bf08c10,0x8c308c10,0x8bef8bf0,0x8bcf8bd0,0x8baf83af,0x838f83af,0x836e836f,0x7b4e7b6e,0x7b2e836e,0x72cd7aee,0x7aee72cd,0x5a2a72ac,0x5a08624a,0x83ad942f,0x8bce7b4c,0x62aa836e,0x836d7b2c,0x6b0c7b4c,0x94307b6d,0x6b2b9c50,0x9c5062aa,0x838d9c50,0x730b7b2c,0x7b2c7b2c,0x7b0b6aaa,0x628993ae,0x8b8e72cb,0x832b7b0c,0x730b834d,0x7b6d730b,0xacf38bef,0x49e78bce,0xa492730c,0x734d9431,0x6aca732c,0x838e730c,0x7bae83ad,0x41c56aea,0x93ee72ea,0x8b8d8bad,0x6aca7b0b,0x93ee7b2b,0xac91acb2,0x5227836d,0xacd2940f,0x836da430,0x6aca72eb,0x8bce7b6c,0x83ad8c0e,0x51e65248,0x8bee732b,0x8bad8c0e,0x6aea72eb,0x942f83ad,0x942fa4d2,0x5ac95a88,0x94309c91,0x7b6c940f,0x62aa6ac9,0x8bee7b6c,0x5aa97b6d,0x4a073964,0x9c2f836c,0x72eb93cf,
-0x730b5a48,0x94509c70,0x7b8d9c50,0x8bae6aea,0x9c91a491,0x836d940f,0x8b8d6aca,0xa471a470,0x41a57b2b,0x62c949e6,0xac719c70,0x72eb8b6d,0x83ce730b,0x9c919c70,0x836c9c30,0x940f7b6c,0x94509470,0x6aaa838e,0x836d72cb,0x8bae9450,0x312449e7,0x730b4186,0x8b8d93ef,0x6acb732b,0x838e6aeb,0x83ae8bce,0x730c734c,0x836e730c,0x72ec7b2d,0x6249626a,0x7b0c6a8a,0x628a834d,0x39663925,0x628a7b0c,0x62695a09,0x5a296269,0x5a2851c7,0x6a89730b,0x72ca6249,0x39035a28,0x49864964,0x41034165,0x62483903,0x39025a07,0x49854985,0x39433102,0x31233143,0x49a549a5,0x626849a4,0x624772c9,0x6aa872c9,0x72c96267,0x6a686ac9,0x62686aa9,0x72a85a46,0x5a266a87,0x6a666266,0x49c451e5,0x41a45246,0x5a6741a4,0x5aa85aa8,0x7b6c6309,0x7b8c738b,0x73ac738c,
-0x83ed7bcd,0x7bac7bad,0x7bac7bcd,0x840e738c,0x840e8c0e,0x8c0e8c0e,0x840e840e,0x83ee840e,0x8c0e8c0e,0x8bce942f,0x8c0f83ae,0x7bcd83ef,0x7bcd83ee,0x9c4f9c90,0x9c70944f,0x8bce942f,0x8bee8bce,0x838d83ad,0x62aa8bef,0x940f4a07,0x5207a4b2,0x9c2f5228,0x72eb836d,0x836d834c,0x9c1093ae,0xa451a430,0x8baea430,0x836d93ae,0x7b0b7b2c,0x5a696aca,0x5a8983ae,0xacd27b4c,0x5a898bef,0x732c6b0b,0x6aeb5228,0x730c72eb,0x83ee6aea,0x9c509c70,0x836c9c0f,0x7b0b7b0b,0x72ca7b2c,0x730a5207,0x7b2b8bee,0x9c30940f,0x8bad8bad,0x6269834c,0x7b2b6268,0x6ae9732b,0x940f62c9,0xa490940f,0x62e9942f,0x730a6289,0x72ca836c,0x7b8d5207,0x83ac8bee,0x8c2f942f,0x83ad7b6d,0x52066b0b,0x7b4c730b,0x5a886aca,0x940f6aea,0x8bee732b,0x5a48732b,0x836d6aaa,
-0x6ac9838d,0x8bee5a88,0x732b8c2f,0x7bcd6b2b,0x7b4c8c0f,0x838d6289,0x838d8bee,0x5a685a68,0x7b8c83ad,0x8c0e62ca,0x524762c9,0x93ee838d,0x62c983ad,0x9c906b2b,0x5a688bee,0x944f62ea,0x5ac983cd,0x8b8d732b,0x730a7b4c,0x6aca4a07,0x49c6730b,0x836d732c,0x62ca5248,0x6aeb7b6c,0x732b6b0b,0x8bae83ae,0x41c65a69,0x8bcf7b4c,0x730c836d,0x51e85a49,0x834d6aaa,0x626a7b0c,0x28e428c3,0x93cf7b4d,0x628a838e,0x5a284986,0x83ce8bae,0x6aeb83ce,0x7b6d5248,0x8bee942f,0x5a68836d,0x9bef6289,0x6aa993ce,0x28a14185,0x416428c1,0x5a0651c6,0x8b6c7b0b,0x8b4b8b8c,0x62266aa8,0x62476268,0x5a065a06,0x51e56227,0x622759e6,0x59e659e6,0x51e66247,0x51a451e6,0x416449a4,0x5a2649c5,0x5a065a06,0x5a6751e5,0x624772e9,0x31224184,0x28e22903,0x31233144,
-0x31433944,0x49c641a5,0x520749e6,0x52274a06,0x49e65227,0x62895a48,0x6aa96289,0x730a730b,0x6ac96ac9,0x7b6b734a,0x736b736b,0x738c736b,0x736b738c,0x62899c50,0x7b6c49e6,0x41857b2c,0x49a64165,0x8bad51e7,0x83cd9c4f,0x52275a89,0x52275a68,0xacb18bae,0x5a088bae,0x39444986,0x6a8a3944,0x6248834d,0xa4306249,0x31036aaa,0x62695a27,0xa4717b0b,0x62a9a491,0x6aea51e7,0x49e75a28,0xa4b183ae,0x6aaa8bae,0x62496a8a,0x83ad6289,0x72eb83ce,0x93ce8b8d,0x72aa6a89,0x834c7b0c,0x9c3093ce,0x52287b6c,0x83ad6aea,0x5a485207,0xa471a450,0x834c8b8d,0x6aca6aea,0x93ee8bad,0x8bad8bad,0x8bae940e,0x7b2b6b0a,0x8b6d7b0a,0x8c0e9c2f,0x5a686289,0x7b6c7b8c,0x72ea41c6,0x8bcea491,0x72ea730b,0x7b2c72ea,0x8bae8bad,0x8bce9c4f,0x7b2c8bae,0x72ea72ea,
-0x732b6aca,0x7b6c8c0e,0x7b6c49a6,0x5a89942f,0x83ad5207,0x6aea83ad,0x6aea72ea,0x836c732b,0x9c4f8bee,0x942f9c4f,0x836c83ac,0x6aea72ca,0x6b2a6289,0x5a6883ad,0x9c4f49e6,0x4a288bee,0x83ad6b2b,0x72a96aea,0x6aca7b0b,0x7b2b6aca,0x9c3093ee,0x834b93ee,0x72ea72ca,0x72ea7b2b,0x6aea6268,0x5a886aa9,0x838d730b,0x5a696aea,0x52486aeb,0x730b62a9,0x520762a9,0x836d6289,0x838e730b,0x4a07732b,0x6aea5227,0x6288730b,0x838c5a88,0x5a89738c,0x7b8d5268,0x6aea83ad,0x5a486aaa,0x416449c6,0x51c64184,0x6a6859e6,0x830b7aaa,0x7ae98b8c,0x51c551c5,0x51a551c5,0x622659e6,0x5a0659c6,0x62066227,0x62266a68,0x622759e6,0x59c66227,0x62476206,0x7aea5a27,0x5a4772e9,0x6a885a27,0x51c45a05,0x51e559e5,0x51c559e6,0x5a0651a5,0x62286a68,0x38e24124,
-0x5a0751a5,0x62487aca,0x41442882,0x52086248,0x41864165,0x394549e7,0x49c63924,0x416551c6,0x4a064185,0x28e23943,0x31443104,0x29033944,0x4a0641a5,0x5a2893ae,0x7b0c4985,0x5a088b4d,0x49a64985,0x72ea4986,0x72aa832b,0x6aca7b4c,0x93ee5a28,0x7b4c62a9,0x418572ea,0x49654165,0x72eb51c6,0x4985832c,0x93ef4185,0x394472a9,0x39034965,0x836d49c6,0x8bad7b4c,0x51c7834c,0x8bae6a8a,0x7b2c7b2c,0x31036269,0x41244145,0x8bae49e7,0x28e37b4c,0x93cf6aaa,0x41654985,0x392449a6,0x8bae72cb,0x838d836d,0x39855a48,0x836c836c,0x836d93ee,0x414551e7,0x39244165,0x8b8d6aa9,0x49a65a07,0x832c834c,0x49a64165,0x51c75185,0x838d8b8d,0x7b0c8bae,0x51e749a5,0x8bae834c,0x6aaa9bcf,0x51c74986,0x41854185,0x7aeb7aeb,0x5a0749a6,0x5a088b4d,0x496530c2,
-0x62694985,0x93ce9c4f,0x5a277b2b,0x52274165,0x93ef7b2b,0x624893ef,0x49a551e7,0x6aaa4165,0x62698b6c,0x8b8d51e7,0x49a672eb,0x51c55185,0x834c5a27,0x836d940f,0x51c66289,0x6aa949c6,0x9c30838d,0x4986834c,0x498549c6,0x834c4144,0x624872a9,0x830b72a9,0x41447289,0x49c651c6,0x93cd6aa9,0x51e78b6c,0x626951e6,0x52273964,0x7b8c942e,0x52475a87,0x52275226,0x7b6b6aea,0x730a838c,0x6ae9836d,0x62685a68,0x6ac96a88,0x72eb7b0b,0x730b3144,0x5a688bae,0x520749c6,0x41643923,0x7ac95a07,0x8b2b7aea,0x5a067aea,0x59c551a5,0x59e659c5,0x49a559e6,0x6a875a06,0x51a56227,0x518449a5,0x496349a4,0x51a549a4,0x41234143,0x41234964,0x416430e2,0x41643103,0x41643943,0x49844984,0x5a055a06,0x6a475a06,0x6a476a47,0x62276a68,0x59c55185,0x59e76248,
-0x59e75186,0x51e76a69,0x310428a3,0x838e6aab,0x49e87b2c,0x6acb41a7,0x836d836e,0x5a6972ec,0x7b2c72ca,0x6aab730c,0x51c85229,0x6a8b5a29,0x416572ab,0x51e76aca,0x6a8a4165,0x72ab832d,0x51e751e7,0x6a8a4965,0x5a28834d,0x8bce732c,0x7b4c730b,0x93ef49e6,0x41856289,0x49a64985,0x8b6d6289,0x39446289,0x834d4185,0x51c772ea,0x41454985,0x72cb4985,0x520772eb,0x834d8b8d,0x6269832c,0x93ef5a69,0x412551c7,0x49864945,0x834d72ab,0x39456a89,0x93cf5a49,0x39655a08,0x392449a6,0x8b6d6aea,0x6aca5a69,0x6aeb83ae,0x52078bce,0x836d836d,0x518549a6,0x49864985,0x832c836d,0x498551a6,0x7b0b7aeb,0x51c751e7,0x49864985,0x7b2c8b6e,0x7b0b6269,0x6aaa832c,0x52078b6d,0x6a699bcf,0x51864144,0x5a084965,0x62698b2d,0x5a284145,0x6a6a93af,0x49253904,
-0x5a283903,0x5a2893ee,0x7aeb7b4c,0x72eb5a48,0x6aaa72cb,0x498693af,0x41854124,0x72eb4104,0x5a078b6d,0x7b2c4986,0x51c672eb,0x49444104,0x72eb51a6,0x6a697b2c,0x5a078b8d,0x7b4c6249,0x7b4c6269,0x38e4832c,0x41254945,0x936e3103,0x3903726a,0x7acb5a08,0x39046229,0x39044145,0x72cb51c7,0x7b0b6a69,0x39446aab,0x834c6a89,0x72ea6aca,0x30e34186,0x41443103,0x7aec6a68,0x41654125,0x51e78b6e,0x39242081,0x59e63923,0x8b4c936d,0x51a66a69,0x38e34964,0x59e63923,0x8b2b7aa9,0x7aca7aca,0x49646227,0x726751a5,0x51a57267,0x5a2659e5,0x5a266247,0x49a451c5,0x624751e5,0x7b0972c9,0x7ae9832a,0x834b8b6c,0x7b0a7b0a,0x6a687aca,0x62486a48,0x414559e7,0x41443903,0x41244944,0x30e23903,0x390330e3,0x622851e7,0x72ca6248,0x6269832c,0x41443944,
-0x622751c6,0x416551e6,0x62aa49e7,0x39866aca,0x5a894a07,0x5a695aaa,0x736c5a69,0x31647b8d,0x7b8d5a69,0x628b6aec,0x5209522a,0x6a8b624a,0x51c76a8a,0x72eb72cb,0x72ec6acb,0xa43193cf,0x830c8b6e,0x72eb834d,0x730c836d,0x940f836d,0x838d8b8d,0x838d7b4c,0x7b2c72eb,0x834c7b0b,0x9bef9c10,0x51c76a89,0x8b8d5a08,0x8b8e9c0f,0x72eb72ec,0x62a97acb,0x72eb838d,0x93ef72ea,0x6aab834c,0x732c834d,0x72cb62aa,0x7aec6249,0x83ae9c31,0x41465228,0x93af51e8,0x7aeb93af,0x6a8b6a8a,0x730b626a,0x6acb7b2c,0x836d9410,0x6aeb6aeb,0x72eb7b4d,0x72ca6269,0x7b4c72aa,0x72cb9c51,0x41444165,0x93cf6aca,0x6a8a832c,0x72cb72cb,0x7b6d6289,0x72eb6aca,0x7b4c93cf,0x730b6289,0x6a8a8b8e,0x6aaa5a08,0x7b0c72aa,0x5a28836d,0x41663104,0x832d834e,0x59e86229,
-0x49e751c7,0x72eb72ea,0x72ea6268,0x72eb93ae,0x730b5a07,0x49c77b2c,0x5a0751e7,0x93ae51c6,0x3924832c,0x626949a6,0x62288bae,0x59e75a08,0x62894185,0x5a48834c,0x93cf6269,0x5a4972cb,0x730c628a,0x4145626a,0x498649a6,0x8b6e5a08,0x30e459e8,0x6a8a4986,0x39456a8a,0x39044165,0x832d4186,0x5a295a49,0x72ec72eb,0x49a7732c,0x72eb6a8a,0x28a24145,0x412530e3,0x7b0d6a8a,0x39253904,0x62298b6d,0x30e330c3,0x51c730c3,0x59e6830b,0x41446248,0x6a684985,0x8b4b832a,0x5a067288,0x51c55a06,0x6a886226,0x51c46246,0x51a451c5,0x5a0659e5,0x6aa86267,0x7b0a7aea,0x7b0a7b09,0x62687b09,0x72e972e9,0x72c96267,0x6a887b0a,0x834b6aa9,0x6a8972a9,0x59e77269,0x51c76228,0x39233902,0x51e53944,0x6a895a06,0x72ea72a9,0x62887b0a,0x7b4c5a68,0x51c57b0a,
-0x41434122,0x6a886247,0x52275206,0x6aca730b,0x524862a9,0x524841c5,0x4a0762ca,0x734b3985,0x3965732b,0x52285a69,0x5a4949e8,0x41c75a49,0x6aca4a07,0x8bef732c,0x7b4da451,0x62ab5228,0x730c838e,0x730d5a69,0x8bcf838d,0x838d9430,0x9c3072eb,0x8bae9c30,0x626972eb,0x8b6e72ca,0x5a497b0c,0xa450830b,0x6a8aa430,0x8bad6a89,0x6a69834d,0x6b0b626a,0x83ad7b6d,0x8bcf8bce,0x83ae8bcf,0x736c7b8d,0x5a496aeb,0x9410626a,0x6aeb7b6e,0x9c3083af,0x72cb8b6e,0x9bf093cf,0x628972cb,0x7b2d72cb,0x8baf836e,0x83ae93f0,0x8bcf9c31,0x732c7b4d,0x62696acb,0x94507b2c,0x730c7b8e,0x93ef8bce,0x7b6d7b6d,0x838e8bef,0x6aaa6a8a,0x7b8d7b6d,0x940f736d,0x83ae9c71,0x83ce8bef,0x72eb730c,0x628a6acb,0x9c30836d,0x730c7b6e,0x732c62cb,0x93f0838e,0x6a8a836e,
-0x7b2c6aaa,0x838d7b4c,0x838d83ce,0x8bce8bce,0x836d836d,0x838d7b4c,0x72eb730b,0x9c309c0f,0x6269836d,0x730b5a28,0xa45193ef,0x72aa830c,0x7b4c7b2c,0x836d734c,0x940f834c,0x7b4d836d,0x732c7b4d,0x72eb730b,0x72eb6aaa,0x8bae93cf,0x41856289,0x7b2c5207,0x834c93ce,0x730b62aa,0x62aa6aca,0x6aeb6aca,0x730b6aeb,0x5228732c,0x51e8732d,0x624a5228,0x72eb6249,0x5a497b2c,0x39053104,0x6aab6aab,0x5a075a08,0x414451a7,0x41445a07,0x6aa849a4,0x72e97ae9,0x41845a26,0x5a4651e5,0x62875a47,0x49e45246,0x5a6649c5,0x73096ae9,0x72e97309,0x6a886ac8,0x7b096ac8,0x6ac97b09,0x6a886287,0x5a265a47,0x5a066a88,0x628851e6,0x62276288,0x52065a27,0x72c95a46,0x52267b0a,0x51e53922,0x6a8772c8,0x51c45a26,0x5a255a05,0x836a72c8,0x5a467309,0x72c972e8,
-0x49646227,0x51e63903,0x62487ac9,0x28e23903,0x28c228c2,0x6aa93103,0x5a697b4c,0x41c54165,0x39853124,0x732c7b4b,0x41c65228,0x39a53985,0x6b095a88,0x524983ce,0x838e4a08,0x49e7838e,0x628949c7,0x730b732c,0x7b6d734c,0x39655aa9,0x5a8941a6,0x7b0b838d,0x72eb72ca,0x51c76aaa,0x7b2c5207,0x52087b4c,0x838d62a9,0x49c66a69,0x7b0c6289,0x7b6d732c,0x83ce83ce,0x52285a89,0x7b8d5a89,0x7b6d8c2f,0x838d732c,0x5248732c,0x732c5228,0x72eb734c,0x72ca7b2c,0x626949a6,0x7b2c834d,0x836d6acb,0x83ae9c30,0x5a696289,0x9c506b0b,0x732c8bef,0x838e7b4d,0x5248834d,0x7b6d5248,0x8bae838d,0x5227732b,0x7b4d5a49,0x72cb8b6e,0x83ce6aeb,0x736c8c0f,0x52686289,0x94307b6d,0x628a6aeb,0x93ef732c,0x49e77b8d,0x83ae49e7,0x8bef83ae,0x49c662aa,0x834d6acb,
-0x49e76289,0x8bce6289,0x734d83ae,0x7b6d730c,0x7b6d8bcf,0x522862aa,0x8bce62ca,0x52277b4c,0x9c306269,0x838dacf2,0x6aca5228,0x628a832b,0x52495228,0x8bce732b,0x8bae7b6d,0x7b6d7b4c,0x7b6d83ae,0x41865a69,0x7b2c6269,0x49c66269,0x9c507b0b,0x6aa98bce,0x7b4c5a69,0x520662a9,0x6aca5227,0x7b8c732b,0x734c7b6c,0x732c8bee,0x6aeb6aeb,0x49e75a89,0x83ae62aa,0x62aa836d,0x6aab5a69,0x836d72ec,0x6aaa836c,0x49845a07,0x72a84163,0x832a7ae9,0x414359e5,0x62675a06,0x5a265a26,0x520551a5,0x72e96247,0x7b2a7b2a,0x62876ac8,0x6ac96288,0x72e972c9,0x51e66288,0x41844984,0x414451c6,0x520651e6,0x49a53944,0x414451a5,0x51e64985,0x6ae95a26,0x5a66730a,0x72e96267,0x51c56aa8,0x390349a5,0x412338e3,0x494351a5,0x51c530e1,0x8b4b7b09,0x5a066a46,
-0x622772a9,0x416451a6,0x72ea49a5,0x39247aca,0x30e33103,0x49c728a2,0x5a485a08,0x31246289,0x62a941a6,0x5a485a48,0x28e23985,0x28e23123,0x62c941c5,0x6aeb7b4c,0x734c6aeb,0x49e762aa,0x72eb6aca,0x7b6d6b0b,0x8bef9410,0x52086aeb,0x6aca51e7,0x8bae9c30,0x836d7b4c,0x51e76aeb,0x7b0c5208,0x5228834d,0x8bae6aca,0x41a662a9,0x6aaa5207,0x836d7aec,0x6b0b83ae,0x41c65a68,0x62ca41a6,0x730b7b6d,0x5a69730b,0x416549e7,0x83cf72ec,0x418562eb,0x8bae730b,0x49a65207,0x6acb5208,0x730c730c,0x6aeb6b0b,0x396541c7,0x730c49e7,0x6aeb6b0b,0x62286acb,0x41a651e7,0x8b6d732c,0x41855a28,0x83ce836d,0x41654986,0x7b0c5a08,0x6b2b730b,0x5a486b0b,0x41c73965,0x6aeb5a69,0x6aeb6aeb,0x51e76aaa,0x52283945,0x6aca838d,0x522820c2,0x6aaa8bae,0x52274164,
-0x7b4c72eb,0x940f838d,0x41c6732c,0x51e83925,0x8bcf7b4d,0x834d836d,0x5a286aec,0x72eb3924,0x5a288bad,0x732b4185,0x5a077b4c,0x6a8a49c6,0x83ae838d,0x83ae838e,0x41856aaa,0x5a6841a5,0x7b8d83ad,0x7b2c730b,0x49c672eb,0x72ea3944,0x49c67b2b,0x7b2c6289,0x49a65a08,0x6aca6289,0x6aaa5a48,0x730b834d,0x396549e6,0x732b5248,0x5228734c,0x6aaa41c6,0x4a0772eb,0x6aaa3944,0x8bef8bcf,0x39445a48,0x49a55a27,0x6a673102,0x830a834a,0x414359e4,0x6a875a05,0x59c55a26,0x5a265a06,0x7b0a6a88,0x626872e9,0x72c96248,0x6aa972ea,0x5a0672a9,0x30c249a5,0x51c549a5,0x5a064985,0x51e66247,0x5a0672a9,0x62477289,0x5a4751c5,0x30c26206,0x31023943,0x730a49e5,0x51e66aa9,0x7aca6a47,0x30c259e7,0x38e238e3,0x49644103,0x38e24123,0x7ac949a4,0x6aa993ad,
-0x62486a89,0x414441a5,0x41643903,0x7aca6aa9,0x31034164,0x49a628a2,0x49c75a28,0x5a6949c7,0x314562cb,0x5a6949c7,0x20613965,0x30e320a3,0x52275a28,0x838d7b4d,0x7b2b8bae,0x93ae7b2c,0x6249830c,0x6aea6249,0x7b4c836d,0x8bae8bae,0x93ef7b4d,0x7b4d7b4d,0x5a4972eb,0x834d628a,0x62287b2b,0x940f7b2c,0x5a498bce,0x7b2c6269,0x5a287b0c,0x72eb5a28,0x8bae838c,0x7b2b7b4c,0x836d836d,0x7b4c7b6c,0x52285228,0x832c72ab,0x5a296248,0x9c50838d,0x5207838d,0x730b51e7,0x5a6972eb,0x7b4c6289,0x838d8bef,0x62ca7b6c,0x8c0f838d,0x6aeb83ce,0x6aaa5a48,0x6269832c,0x72ab49c6,0x9c0f93ce,0x51c77b2b,0x7b0c6248,0x6a6972aa,0x836d5a48,0x7b4c8bce,0x62aa72eb,0x8b8e83ae,0x62897b4c,0x730b5a48,0x49c7730b,0x730b51c6,0x834c838d,0x49c662a9,0x7aeb6249,
-0x626972cb,0x8bae62aa,0x5a697b2c,0x62695a28,0x8b8d7b4d,0x5a496a8a,0x7b0c72cb,0x52075a08,0x7b0c72cb,0x7b2c730b,0x51c76289,0x834c72aa,0x62897b0b,0x8b8d730b,0x49c66aaa,0x5a8849e6,0x732b838d,0x728a5a48,0x62297aec,0x6aaa4166,0x51c76a8a,0x830c6a8a,0x39045a28,0x7b2c51c7,0x72cc830c,0x72ca836e,0x28c33924,0x730b49c7,0x72eb7b2c,0x5a686aca,0x41653965,0x832c72ca,0x39443103,0x6248832c,0x59e630e2,0x7ac9830a,0x49636267,0x6a6751e5,0x51c56a67,0x6a875a06,0x72c97ae9,0x6a896a88,0x7ae9830a,0x59e66247,0x51a651c6,0x51a55a27,0x518551a5,0x518551a5,0x51c651c6,0x61e74985,0x6a2751a5,0x51a551a6,0x496451c6,0x41644944,0x51844144,0x38e24964,0x7aca5a07,0x6a497269,0x59e78aeb,0x38e24124,0x49443923,0x39234964,0x62473922,0x62a97b2a,
-0x49c65207,0x5a065227,0x416451a5,0x6aa94164,0x49856268,0x49a651c6,0x626951e7,0x62aa6289,0x5209732c,0x522962ab,0x5a4a51e9,0x6aab626a,0x31046a8a,0x41855a27,0x62a93944,0x8bae8bce,0x7b0c72cb,0x62897b2c,0x62897b2c,0x7b6c6aaa,0x6aca72ea,0x6aca7b2b,0x834c6289,0x72ea7b2b,0x9c0f93ee,0x49a56269,0x7b2b49a5,0x8b8da450,0x730b6a89,0x6aca836c,0x836c732b,0x8bce6b0a,0x72ea838d,0x6aea732b,0x62aa7b4c,0x8bce5a48,0x8bce9c4f,0x5a286b0a,0x8b8d72ca,0x7b4ca470,0x72ea62a9,0x7b4c7b2c,0x83ad7b6c,0x6b2b838d,0x838d93ee,0x7b4c732c,0x6aaa7b2c,0x9bef72aa,0x832c9c0f,0x72ea6a89,0x93ce7b2b,0x6aaa9c2f,0x7b0b6248,0x7b2b834c,0x93ce7b6c,0x838d93ee,0x7b6d838d,0x7b2b7b2c,0x5a4862a9,0x8bce7b2c,0x6aeb730b,0x7b2c836c,0x7b0c6a8a,0x5a28832c,
-0x72eb5207,0x7b2b836d,0x836e9c0f,0x93ef8b8e,0x730b8b6e,0x72cb832d,0x5a4851e7,0x7b0c93af,0x93af6a8a,0x72eb93ef,0x836d5a69,0x5a286aca,0x72cb51e7,0x732b836d,0x8bef8bee,0x838d7b2c,0x7b2b730b,0x49a66acb,0x6aca51e7,0x51e7730a,0x93ce730b,0x62898bce,0x6aea49e7,0x41a56aaa,0x628a3965,0x6b0c6aca,0x5a6962aa,0x730c7b2c,0x5208730c,0x6aca41a6,0x522772eb,0x5a274185,0x8b4c72aa,0x51a56a88,0x8b4b6247,0x41437ac9,0x6ac849a4,0x59e56a67,0x72c851c5,0x72a88b2a,0x6a886226,0x7ae993ac,0x392359e5,0x62275a07,0x49a64985,0x5a274985,0x62276a68,0x51e66227,0x59e651a5,0x518559c6,0x51c64964,0x59e75164,0x41445185,0x51a551a6,0x41035185,0x39033903,0x51a528a1,0x72a972c9,0x8b6c72c9,0x39034945,0x41644164,0x41644944,0x49c43101,0x5a478b8b,
-0x624849c6,0x62686aaa,0x416451e6,0x59e64124,0x498572c9,0x30e33903,0x416430e3,0x418549a5,0x62896268,0x5a4851e7,0x30c349c6,0x39442903,0x28c230e3,0x52076249,0x72cb49c6,0x49a57aeb,0x41853944,0x6aca4145,0x51e77b0b,0x7b4b6aca,0x72ea6269,0x7b4c5a07,0x41455a28,0x49864985,0x72a95a07,0x41646248,0x7aea49a5,0x59c66268,0x498559e6,0x6a894985,0x5a07832b,0x834c6268,0x5a277b0b,0x7b2b6ac9,0x5a4841a5,0x5a285a68,0x72eb7b6c,0x416549a5,0x7b2c49c6,0x5a4872ca,0x5a285a48,0x72eb6269,0x52286aca,0x72ec8bae,0x628962aa,0x6aaa7b0c,0x624849e7,0x62697289,0x6248938d,0x39444144,0x834c6289,0x5a486aaa,0x62476268,0x7b4c6289,0x62a96268,0x62c9838d,0x6aca5227,0x52077b0c,0x6aca5a69,0x7b0b6289,0x5207836d,0x49a64165,0x834c730b,0x6a6972cb,
-0x62696aaa,0x732b6268,0x6aaa6aaa,0x730b838d,0x7b2c6289,0x62496268,0x72ab72eb,0x93ce7b0b,0x49a6834d,0x62694185,0x8b8e93ce,0x72ca7b2c,0x628972eb,0x7b2b72ca,0x8bae6289,0x62896aca,0x6a8a7b0c,0x6a8a5a28,0x72ea6aaa,0x93ad836c,0x39646268,0x72ea49a5,0x834c93ce,0x6aca6268,0x5a886aaa,0x7b2c6a89,0x6aea730b,0x72cb836d,0x6aaa730b,0x52086269,0x7b2b5a68,0x6aa97b2b,0x5a06730a,0x72c951a5,0x6a688b2b,0x5a2649a4,0x51c46a67,0x6a8849c4,0x6aa87b09,0x72a86a67,0x72a87ae9,0x51a54984,0x62276247,0x49a549a5,0x5a2759e6,0x5a076288,0x624849a6,0x51a55a07,0x51a549a5,0x498459e6,0x41446248,0x51c66228,0x49654945,0x51654124,0x41044103,0x39234944,0x28c130c2,0x7b0a5a27,0x6a896a88,0x414449a5,0x30e330e3,0x49844985,0x416330e2,0x834b6aa8,
-0x51c76289,0x418549a6,0x49a54185,0x414551c7,0x7ac96a88,0x310341a4,0x39233923,0x39234164,0x30c238e3,0x30e33943,0x39243102,0x39443103,0x39023903,0x5a287aeb,0x72ca51e7,0x41456a8a,0x498549a6,0x6aa949a6,0x832c6aaa,0x51e77b0c,0x7b0c5a28,0x7b0c5a08,0x49866aaa,0x41654986,0x7aeb49a6,0x414572cb,0x93ae51c7,0x39036228,0x41044985,0x8b2c59e7,0x7b0b51c6,0x51c7830c,0x82ec72ab,0x72ca6228,0x414559e7,0x49654144,0x830b6249,0x39246a49,0x834d6a8a,0x49a649c7,0x31044186,0x834d72ec,0x6acb5208,0x5a2872ec,0x49e7836e,0x7b2d7b0c,0x49864986,0x496649a7,0x7acb830d,0x5a0851c7,0x6a6a72eb,0x49864185,0x49a64185,0x6a897b0b,0x7b2b628a,0x62696aaa,0x51e672ea,0x628a7b4c,0x418549a5,0x5a2749a6,0x624872ca,0x49a64165,0x6a68832c,0x41653944,
-0x52073904,0x52278bad,0x72ea5a68,0x72ca72ea,0x62695a28,0x4165832c,0x49854164,0x72ca3924,0x49867b0b,0x5a084165,0x51a67aeb,0x496551a6,0x6a6938e3,0x51c6830c,0x7b0b6248,0x6aaa6269,0x72cb51e7,0x30e3728a,0x41644985,0x7aea4144,0x39235a07,0x6a684985,0x41646a68,0x39444985,0x72894144,0x5a075a27,0x6aaa6248,0x416572eb,0x5a286acb,0x49c74186,0x5a4851e7,0x6288730a,0x416430e2,0x72a88b4b,0x59e64984,0x62266a67,0x62475205,0x72c8834b,0x7b096a87,0x6247832a,0x49844984,0x5a264184,0x5a0659e6,0x51a551c6,0x62685a27,0x832b5a27,0x59e659e7,0x49a551e6,0x5a0751c5,0x72a96268,0x62286228,0x518559e7,0x49654164,0x41445165,0x41034124,0x39234144,0x30e23102,0x5a474165,0x72ca6a89,0x414459c7,0x41454144,0x41644145,0x39234144,0x72ea51c5,
-0x6a8a6ac9,0x5a276248,0x5a075a27,0x392451c7,0x8b6c5a06,0x39036227,0x59e651a6,0x392451c6,0x31033903,0x31033943,0x41443924,0x49853923,0x62485a07,0x5a48834c,0x7b0b5a07,0x51c672eb,0x5a285a28,0x7b2c5a07,0x72ca93ce,0x49a751c7,0x51e74186,0x9bf07aec,0x5a4972ec,0x416551c7,0x72cb59e7,0x41456aaa,0x8b4d4986,0x39045a28,0x49654986,0x938e5a08,0x72cb938e,0x498651c7,0x626a49a7,0x832d834e,0x41665a08,0x39453965,0x836e51c7,0x30e47b0d,0x728b6a8a,0x51c74986,0x498659e8,0x8b8e72cb,0x834d832d,0x49a75a49,0x7acb626a,0x832d9bcf,0x49664987,0x41455186,0x830c6229,0x59c75a08,0x728a7aec,0x49a630e3,0x49864986,0x7aec6a8a,0x6aaa8b6d,0x5a074165,0x7aeb72ca,0x6a698b4d,0x51a651a6,0x49864945,0x6a6982cb,0x51a64104,0x59e7830c,0x49654104,
-0x51e738e2,0x6aa98bae,0x5a48836c,0x62683924,0x72ea72eb,0x49a6834c,0x41654145,0x5a084144,0x59e772ca,0x72ca3924,0x416572ea,0x49a64965,0x7aeb51c7,0x6aa9836c,0x51c67b2b,0x7aeb49a5,0x7b0b6269,0x41447aeb,0x41454965,0x7acb4145,0x41246228,0x830b6a8a,0x41245a07,0x41244965,0x6a694966,0x6a4951a6,0x51a66a69,0x5a086a8a,0x6a8a5a08,0x392449a6,0x310328e3,0x5a275a07,0x834b49a5,0x51c56a88,0x6a675a26,0x59e56226,0x83296a87,0x72886a87,0x72a8832a,0x416351c5,0x51c54984,0x622649c5,0x5a265a06,0x62686a67,0x5a275a47,0x52065a47,0x834b6268,0x72ea7b0b,0x6a8872c9,0x5a276248,0x59e759e6,0x498551c6,0x41244965,0x41244104,0x49a53903,0x5a0751c6,0x414451e6,0x52064185,0x72ca5a48,0x41446228,0x30e330c3,0x51a64165,0x41244964,0x8bad51c6,
-0x39655a28,0x626849c5,0x52266aa8,0x51c64143,0x6a684985,0x39246228,0x392330e3,0x49a64144,0x62486a69,0x72a951e6,0x6a8872c9,0x7aca72a9,0x728872a9,0x5a2872eb,0x626949c6,0x6a8a72eb,0x72eb6aaa,0x6aaa6a8a,0x5a087b0c,0x41853924,0x49a64986,0x8b4d72eb,0x6aaa6aaa,0x6a6972ca,0x72cb6a8a,0x41455a07,0x72ab4985,0x72aa6a6a,0x6a6972cb,0x832d6a69,0x30e3836d,0x51e74986,0x39654986,0x93d072ca,0x6a8a628a,0x6aaa6aaa,0x7b2d6acb,0x30e4626a,0x834d6249,0x72cb6aaa,0x72aa72eb,0x8b8e834c,0x49c66aaa,0x51a649c6,0x62484165,0x8b8d938e,0x72aa72aa,0x6a486a6a,0x7aeb830c,0x51a651e7,0x7b0c7aeb,0x6a8a5207,0x6a8a72aa,0x8b4d8b6d,0x49a65a28,0x51e75a27,0x728a4985,0x7acb9bcf,0x62496229,0x620859e7,0x72aa830c,0x59e73924,0x6a6a830c,0x59c751a6,
-0x7aeb5a07,0x834c9c0f,0x394451c6,0x41444144,0x834c51c6,0x6a899bef,0x51c66228,0x6a8a51c6,0x5a08830b,0x834c4185,0x51e76aca,0x51e651c6,0x834d6228,0x7b0b9bef,0x314449a6,0x4a0741a5,0x8b8d72ca,0x59e7834c,0x498651c6,0x7aca4145,0x41456a69,0x7aeb6228,0x39246208,0x49854985,0x7b0b59c7,0x6a478b2c,0x39033924,0x6a8a4985,0x72cb7aeb,0x310351a6,0x30e23103,0x51c53103,0x72c97b0a,0x5a2651c5,0x5a466a67,0x7ae96a66,0x62477ae9,0x834b830a,0x498459e5,0x51e551a5,0x5a065a06,0x62675a05,0x7b0a7b2a,0x51e65a06,0x6ac96a88,0x7b2a72ea,0x6a8972a8,0x62476aa9,0x5a275206,0x59e66247,0x498559e6,0x41244144,0x41444144,0x51a54144,0x7aea72c9,0x72ca72ea,0x8b8c834c,0x41856aa9,0x72ca5a07,0x49655a07,0x390330e4,0x49654965,0x39233943,0x7b4c4144,
-0x52287b2b,0x49a549c6,0x39443143,0x41854165,0x72ca4144,0x41656a89,0x39443904,0x30e330e3,0x28802861,0x41434143,0x39234123,0x39033903,0x30c230e2,0x72ab6a8a,0x6a8a72aa,0x51e76a69,0x49864966,0x39244166,0x7aec5a08,0x39246a69,0x6a694985,0x59c77aeb,0x49654985,0x49854164,0x624859e7,0x72696a28,0x6a687269,0x498559c7,0x49a64986,0x498551a6,0x7acb7aeb,0x498551a6,0x72ea51c6,0x41647b0c,0x49c74986,0x51e751a7,0x5a275a07,0x62495a48,0x52085a28,0x5a285228,0x52085207,0x5a8949e7,0x5a277b0b,0x41a549a6,0x834c51e7,0x49a572c9,0x520749c6,0x52075a28,0x62485a48,0x52275a07,0x62696269,0x62685a27,0x52076268,0x6aca49c6,0x49c66aa9,0x51e749a6,0x7b0c51c7,0x49c76a69,0x520751c7,0x5a285207,0x49865a08,0x49a64185,0x62695a28,0x62286249,
-0x5a075a08,0x82ec59e8,0x392451e7,0x49454144,0x830c6228,0x59e76a49,0x6a8a6229,0x72897269,0x49856a48,0x5a084145,0x72aa6a89,0x6a697289,0x62486228,0x6aca72eb,0x41854165,0x392449a5,0x7b0b72cb,0x62086229,0x6a896a8a,0x72ea6268,0x31035a07,0x62483944,0x624872ca,0x62486248,0x72aa6a68,0x49856a88,0x412330e2,0x41243904,0x82ec72aa,0x6a286a49,0x496459e6,0x7aca59c5,0x51e56a88,0x6a885a06,0x62675a26,0x6aa87b09,0x8b6b6aa8,0x49a57ac9,0x62274143,0x5a066267,0x72a85a26,0x72a872c8,0x5a265a06,0x730a72e9,0x6ae962a8,0x6a887309,0x51e66268,0x49c549c5,0x62675a06,0x72a96268,0x49a56248,0x394351a5,0x49854164,0x830a51c6,0x5a4772ca,0x5a6749c5,0x62a95247,0x6aea836b,0x730b5207,0x416551c6,0x49454144,0x49855186,0x41233923,0x8b8b5a27,
-0x72ea6ae9,0x5a486aea,0x6aa96268,0x49a651c7,0x62674164,0x51e67aea,0x412430e3,0x49a64144,0x41444145,0x41444144,0x41444164,0x49854144,0x49854965,0x51c759c8,0x51c751c7,0x7acc6249,0x62497acb,0x41454986,0x51864945,0x832c7aaa,0x728a7aaa,0x49454925,0x49654945,0x8b0c7249,0x6a498b0c,0x598661e7,0x6a2861c7,0x82cb7a6a,0x59c6728a,0x620751c7,0x6a6951e7,0x6a897aeb,0x72eb832c,0x41654144,0x49a64165,0x7b0c51c7,0x72cb7b4c,0x62086248,0x832c728a,0x62698b6d,0x49a64985,0x51e75a08,0x834c6249,0x59c65a07,0x72aa834c,0x518659c6,0x49654965,0x7aeb59e7,0x832c936d,0x6a89728a,0x8b2c830b,0x51a66a89,0x59e76248,0x498649a6,0x72cb72aa,0x59e849a6,0x728b8b2d,0x51c751c7,0x498651a7,0x62295186,0x728b7aec,0x830c72ab,0x6a2982eb,0x41254966,
-0x49864165,0x51e751a6,0x5a08830c,0x6a493903,0x6228830c,0x49654124,0x41044946,0x59c73904,0x830c72ab,0x72aa830c,0x51666208,0x49454945,0x41454125,0x728a61e7,0x4145728a,0x6a6a3904,0x72498b0d,0x49455166,0x41454124,0x49664145,0x62495a08,0x49865a08,0x41454145,0x30e43925,0x414530c4,0x6a6a728b,0x38c44125,0x62284124,0x39247acb,0x51644923,0x51444944,0x9bad7288,0x622651e5,0x5a467ae9,0x7b0972a8,0x72876a47,0x51c58b6b,0x49a54985,0x626751c5,0x5a266a88,0x72e972c9,0x5a2749a5,0x72e9836b,0x72c95a47,0x6a88832a,0x49a55205,0x62674184,0x73097b0a,0x6a8872c9,0x49a551a5,0x49a54985,0x39234124,0x49843923,0x7aea6a88,0x418449a5,0x72e95206,0x62886ae9,0x834a72ea,0x5a276ac9,0x39033904,0x41033904,0x59c651a6,0x49a54143,0x8bad6247,
-0x418572c9,0x7b4b6aa8,0x730a7b2a,0x416551e6,0x62483924,0x49a672aa,0x392438e3,0x51c63924,0x51a64986,0x51855185,0x51a651a5,0x49654985,0x5a074145,0x498651e8,0x51a74986,0x416551c7,0x628a49a7,0x5a2972cc,0x41664986,0x59e84166,0x41256209,0x59e859c7,0x7acb6228,0x51a7728b,0x41254104,0x49454925,0x49454105,0x51664945,0x72cb6249,0x49a66a6a,0x41654166,0x6a8b5a29,0x41665a29,0x49a74145,0x72cc628a,0x5a297b0c,0x41464166,0x41464166,0x51674986,0x82ec51a7,0x6a8a7acc,0x49866229,0x59e84145,0x830d82ec,0x51a76249,0x51a75166,0x7aec726a,0x6a4a728a,0x59c75a08,0x59a759c7,0x59c859c7,0x82ec6a49,0x6a29728a,0x516759e8,0x62295186,0x7b0c830c,0x41045a08,0x51a74986,0x72cb5a08,0x6a6a830c,0x59a85186,0x494551a7,0x62295187,0x728b728b,
-0x5a087249,0x496651a7,0x7aeb59e8,0x72aa7acb,0x41255a08,0x59e851a7,0x72696249,0x72aa830c,0x51a759e8,0x59c751a7,0x82cc6a6a,0x726a7acb,0x518661e8,0x51a74966,0x7aec72aa,0x7aaa72cb,0x38e35186,0x59c74966,0x728a6208,0x6a6b72cb,0x51c75a29,0x5a0851c7,0x728a6a6a,0x41656229,0x39044125,0x6a4a4125,0x59c7726a,0x72ab6a6a,0x30c33924,0x41043903,0x6a2738e3,0x5183830a,0x72c86246,0x6aa75a05,0x62677ae8,0x7b0a72a8,0x41434984,0x6a6851c5,0x62476267,0x72a96a88,0x62676a88,0x7b0a832a,0x73096aa8,0x520672e9,0x520549c4,0x72c96267,0x5a4772c8,0x5a675206,0x5a066247,0x62486a68,0x51a651e6,0x49654144,0x5a074964,0x62677aea,0x39634984,0x7b4a6288,0x838c7b4b,0x73098b8c,0x41445a27,0x30e34144,0x51a54104,0x416459c6,0x418430e2,0x7b4b7b2a,
-0x62a97b2a,0x394449e6,0x41644184,0x51e64165,0x62273944,0x52077aeb,0x49653904,0x49a64985,0x51a64986,0x51c649a5,0x49854986,0x496551a6,0x41654986,0x94309450,0x9c319c51,0x9c719450,0x94309430,0x94509430,0x83ef9430,0x8bf08bcf,0x8baf93f0,0x8baf8bef,0x8bcf93cf,0x838e8bcf,0x836e8b8e,0x836d838e,0x7b2c834d,0x72ec72ec,0x832e7b0d,0x72cc7b0e,0x6a6b72cc,0x624a626b,0x6a8b6a8b,0x6a8b626b,0x5a2a6a8c,0x5a4a626b,0x5a2a522a,0x5a2a624a,0x622a5a09,0x628a5208,0x6a8b624a,0x6a6a72cc,0x62295a09,0x59e859e8,0x5a0951c8,0x6a6a5a08,0x622972cb,0x62296229,0x51c759c8,0x620851e8,0x51e759c8,0x62496208,0x7aab624a,0x59e86a8a,0x51e851c8,0x5a0859e8,0x5a0851c7,0x6a8a6269,0x49a66269,0x5a2849a6,0x49c751e7,0x49a649a6,0x51c749a7,0x49a651c6,
-0x72eb5a08,0x49c66228,0x5a0849c7,0x498651e7,0x41854165,0x72eb59e8,0x49a66249,0x416541a6,0x41853945,0x41864986,0x41a64165,0x5a0849a6,0x6a6a6aaa,0x414551a7,0x51e74986,0x49855207,0x39444144,0x72aa6208,0x416559e7,0x41454165,0x49864965,0x39244945,0x41453903,0x620859e7,0x38e359e7,0x38e430a2,0x5a084986,0x310459e7,0x39243104,0x49655a07,0x726851a6,0x59e56226,0x62666a87,0x7ae87309,0x832a6286,0x4984834b,0x51c54164,0x62476227,0x7aea6a68,0x62476aa8,0x72c972e9,0x836c6ac8,0x49a46ae9,0x6a884984,0x5a2672e9,0x72c85a67,0x5a066287,0x49a551e6,0x62475206,0x51a551a5,0x6a4851a5,0x498551a5,0x5a074144,0x6a887b0a,0x39433943,0x49a54164,0x62675a67,0x49a449c5,0x39244185,0x41043903,0x51c64103,0x30c151a6,0x49a428c1,0x72e97b2a,
-0x6a896a88,0x49e66248,0x5a0649a5,0x49855a08,0x62883943,0x418572c9,0x49a53103,0x498649a5,0x41443944,0x41644144,0x39244164,0x49854144,0x39034165,0x9cd29c91,0x9cb1a4f2,0x9cf29cd2,0x9cb19cb1,0x9cb19cb2,0xa4f2a4f2,0x9cb1a4f2,0x9c919c91,0x9cb19c91,0x9cb19c91,0xa4f2a4f2,0xa4d29cb1,0xa4d2a4f2,0x9c91a4d2,0xacd2a4b2,0xacf2a4d2,0x9cb1ad13,0x9cd1ad33,0xacf2a4b2,0xa4f2a512,0xa513a4f2,0xad34ad34,0xa513a4f3,0xad34ad54,0xad13a513,0xa4f2a4f3,0xa4f39cb2,0xa4f3a513,0x9cd2a4d3,0xad339cf2,0xad13a513,0xa4f2a4f2,0xa4f3ad14,0xa4d2a4b2,0xa4d2a4d3,0xacf2a4f3,0xa4b1a4d2,0xa4b2a491,0x9c91a4f2,0x9cb2a4d2,0x9c919c71,0xa4b2a4b2,0x9cb19cb2,0x9cb1a4d2,0x9c919cb1,0x94909470,0x94919c90,0x9c919cb1,0x94709490,0x8c4f8c4f,0x94708c70,
-0x940f9450,0x940f8bee,0x8bce942f,0x9c309430,0x8bce8bce,0x83ce8bce,0x838d838d,0x8bee8bce,0x838d83ad,0x83ce83cd,0x7b8d83ce,0x838d838d,0x83ce7b8d,0x83ce83ee,0x83ce83ee,0x7b8d7bae,0x83ee7bac,0x732c7bad,0x836d7b4c,0x730b7b2c,0x730b72ec,0x6aca730c,0x6aaa6aab,0x62496269,0x72cb72cb,0x52086a69,0x624a5a09,0x5a285228,0x5a285227,0x51a56248,0x72896a48,0x728861e5,0x6a876a67,0x62667b49,0x7b0a7b29,0x496551a4,0x7b0951e5,0x626851a5,0x5a066288,0x7b2a72c8,0x72c96267,0x51e68b8c,0x7aea4984,0x62467b0a,0x72c96247,0x51e66a88,0x626749c5,0x62476226,0x51a56a68,0x61e74985,0x51c651a6,0x39244965,0x49a53924,0x6a886a68,0x49c54984,0x31034144,0x39443943,0x41243903,0x41644985,0x39043903,0x51a54144,0x39234985,0x7ae94984,0x6aa993ed,
-0x62a851c6,0x626872ca,0x72c96a87,0x49a551e6,0x72a94984,0x51c67aea,0x49853944,0x41653903,0x51a549a5,0x51e649a5,0x49c551c5,0x49a551c7,0x416451e7,0x9c509c70,0x942f9c50,0x944f9450,0x9c509450,0x9c709470,0xa4b19c70,0x9c909cb0,0x944f9c8f,0x9cb09c6f,0xa4d1a4d1,0x9cb09cb0,0xa490a4b0,0xacb19c70,0xacd1a4b0,0xacd1a4d1,0xa4f1a4d1,0xa5119cd1,0x9cd0a4f1,0xa4f1a4f1,0xa511a4f1,0x9cd1a4f1,0xa511a511,0xa5119cf1,0xa5129d11,0x9cf1a512,0xa532a512,0x94d1ad32,0x9cf19cf1,0xa5129d11,0x9cf1a4f2,0xa512a512,0xa512a512,0xa512a4f2,0xa532a532,0xa511a511,0xa511a4f1,0xa511a511,0x9cd1a511,0xa5129cf1,0xad32a4f2,0x9cf2a4f1,0x9cf2a512,0xa4f2a4f1,0x9cd1a4f1,0xa4f1a4f1,0x9cb09cb1,0x9cd19cd1,0xa4f1a4d1,0x9cd1a511,0xa5119cf1,0x9cf1a511,
-0x9cd19cb1,0xa4d1a4f2,0xad13a4d1,0x9cb1acf1,0xa4f2a4d1,0xad32a4f2,0xa4f1a4f2,0xa512a532,0xa4f29cd2,0x9cd1a4f1,0xad13a4f2,0x9cd1a512,0xa512a4f2,0xa512a4f2,0x9cf19cf1,0xa512a512,0x9cd1a512,0xacf2a4d1,0x9cd1a4d1,0xa4d2a491,0xa4b19cb1,0x9c91a4b2,0x9c919c71,0x94509450,0x94309c50,0x94509c50,0x9c519430,0x94309450,0x9c509c30,0x59c66269,0x61e66227,0x6a676246,0x8bab5a05,0x6ae85a66,0x5a067309,0x5a064164,0x49a46a47,0x6aa86aa8,0x72e95226,0x72a87b0a,0x62477b0a,0x6ac94163,0x62687b2a,0x72c86267,0x5a066a87,0x5a2751c4,0x6aa85a06,0x62276aa8,0x51c659e6,0x51c64964,0x51865186,0x39244965,0x49854144,0x6aa85a27,0x496549c6,0x41444985,0x41444164,0x7b0b51e7,0x6a89830b,0x41044144,0x41244944,0x41432881,0x7b2a6aa9,0x72ea7b4a,
-0x51e66aa9,0x624749a5,0x6a8872c9,0x41644164,0x72c951c5,0x49a672ca,0x62474144,0x6a896aa9,0x51e55206,0x520649e6,0x49a549c5,0x394449a5,0x418449c5,0x49c649a6,0x51e751e7,0x49e651e6,0x4a0749a6,0x52075a27,0x62695228,0x5a675a68,0x52265a68,0x52475206,0x5a475247,0x5a675a47,0x5a675a67,0x5a465a46,0x5a465a46,0x6aa86287,0x6aa862a8,0x62a862a8,0x62a862a8,0x6b0962a8,0x6b0a732a,0x6b0a6ae9,0x6b0a6b0a,0x7b6b6b2a,0x7b8b7b8c,0x7b8b738b,0x83cc7bab,0x7b8b83cc,0x83ac83ac,0x8c0d8bec,0x8c0e8bed,0x8c0d83ed,0x942e944e,0x944e944f,0x944e942e,0x942e940e,0x944f944e,0x940e942e,0x942e942f,0x942f940e,0x9c6f9c4f,0x9c4f946f,0x944f944f,0x942e940e,0x9c4f9c4f,0x940e942e,0x9c6f942f,0x942e944f,0x944f942f,0xa48fa46f,0x946f9c8f,0xa48f9c6f,
-0x9cb0a4b0,0x9c6f946f,0x9c909470,0xa4d1a4d0,0x946f9cb0,0x9cb09c8f,0x9c909c90,0x9cb0a4b0,0xa4d09cd0,0xa4b09cb0,0xa4d1a4d1,0xacb1a4b1,0x9c90a4b1,0xacd1a490,0xa4b0acf1,0xa4f19cb0,0x9cb09cb0,0x9c909c90,0x948f9cb0,0x9cb0948f,0x946f944f,0x9c909cb0,0x946f946f,0x9470944f,0x94509470,0x9c909490,0x9c719c70,0x942f9c70,0xa4509c50,0x62486269,0x6a476a48,0x59c57288,0x628772c8,0x836b7b09,0x51c56267,0x59c65a06,0x6a886247,0x5a2662a8,0x6aa872c8,0x6aa86a88,0x5a0649a5,0x6aa993ac,0x6aa86268,0x5a066a67,0x51e551e5,0x72c96247,0x62687b4a,0x6a686247,0x72886247,0x59e682ea,0x5a0759c6,0x49a56207,0x39024124,0x7b0a49a5,0x51a572c9,0x51a64986,0x49853924,0x72a96a48,0x938c832c,0x41446a69,0x390330c3,0x72c951e7,0x8b8c8b6b,0x52065a47,
-0x62276247,0x51c55a07,0x41644164,0x412351c6,0x832a5a06,0x39236247,0x41633944,0x51e64984,0x5a4751c5,0x6ac86a87,0x72e96aa8,0x6ac97b0a,0x7b0a72ea,0x8c0f9430,0x8c0f8c0f,0x7b8d7bad,0x7b4c83ae,0x730c83ae,0x72eb5a49,0x5aaa6acb,0x83ae7b6d,0x7b4c7b4c,0x7b4c7b4c,0x730a7b6c,0x730a6ac9,0x6ac972c9,0x7ae96aa8,0x6a887b0a,0x72a96a67,0x5a076a68,0x6a686207,0x51c56226,0x62275a07,0x620859e7,0x49a66228,0x59e64165,0x51e65a06,0x51c651e6,0x49c651e6,0x49c449e5,0x5a065a05,0x5a055a06,0x5a2759e6,0x6a6859e6,0x5a286268,0x52075a28,0x62075a07,0x51a64985,0x498551a6,0x51a64986,0x51a65186,0x518551c6,0x59e651c6,0x51c651c6,0x51c651a6,0x59e651e6,0x518459c5,0x49644164,0x59e651a5,0x51c559e6,0x498549a5,0x51c651c5,0x49c549c5,0x51e651e5,
-0x51a549a5,0x49a651a5,0x49854965,0x51c551c6,0x51e549a4,0x51c559e5,0x51c559e6,0x51a551c5,0x59c551a5,0x5a065a05,0x5a075a06,0x61e759e7,0x620759e7,0x59e66206,0x51e65a06,0x52065a06,0x52285a27,0x5a485248,0x5a275227,0x5a275a27,0x5a275a48,0x6aa86288,0x6ac96aa8,0x6aa972e9,0x730a72ea,0x7b2a730a,0x7b0b730a,0x7b0a834c,0x6a89838c,0x59c851c6,0x59c751a6,0x51a56a47,0x6a4672a8,0x62476a88,0x496451a4,0x6a4759e5,0x6a886226,0x6aa849a4,0x7b0a72e9,0x49846267,0x8b6c72a9,0x7ae95a06,0x622672c8,0x626751c5,0x6a8772a8,0x62677b0a,0x834b5a67,0x8b8b836b,0x8b4b93ac,0x62476a88,0x6a696aa9,0x6a8972a9,0x414351c5,0x5a074184,0x728a830b,0x41244124,0x39643924,0x6aa86247,0x836b6ac8,0x834a836a,0x8b8b836a,0x834b8b6b,0x6a897b2b,0x51e649a5,
-0x52066226,0x6a8851c6,0x49a56aa9,0x416451c5,0x7aea72ca,0x414451a6,0x31034124,0x39044165,0x30e34144,0x39033102,0x38e330e2,0x49443944,0x41233923,0x9cb1734c,0xa4d2ad33,0x6b0b7bce,0x7b8e7b8d,0x94519430,0x8bcf8bef,0x628a838e,0x9c3162ca,0xa4d2a4b2,0xacf2acf2,0x9c50a450,0xa470acb0,0xb4f1942e,0x93ec9c0d,0xac6eb4b0,0xa42f93ac,0x7aeaa44f,0x9bed830a,0x9bcdb490,0xa40f9bcd,0x6aaa832c,0x8b8d9bef,0x836c7aea,0xa44f9c0e,0x8b8d9bee,0x836c8bad,0x832a7b2b,0x9baca3ee,0x72a8830a,0x7aa96a47,0x938da3cd,0xa40f8b4c,0x834b9bee,0x8b2b832b,0x8b0b6a47,0x59a67aa9,0x59a65986,0x51855186,0x518551a5,0x59c65165,0x518659c6,0x61c759a6,0x6a0761e6,0x516469e6,0x61c659c6,0x728859c5,0x726882c9,0x7aca7289,0x832b51c6,0x6a887ac9,0x72a86a67,
-0x6a2772a8,0x72677aa9,0x6a2759c5,0x72676a67,0x72667287,0x82e86a46,0x7aa88ae9,0x6a266226,0x7aa77a88,0x6a266a66,0x6a266a46,0x7aa97268,0x412359e6,0x620659a5,0x83096a67,0x6aa86a87,0x626772c9,0x49c651e6,0x49644985,0x39034144,0x51854124,0x51a551a5,0x518451e5,0x41243903,0x30c23902,0x38e230c1,0x30c230c2,0x39224123,0x5a2649a4,0x49654965,0x498559e7,0x49844102,0x41424984,0x49644143,0x41234964,0x41434123,0x41424184,0x498451c5,0x49854984,0x49644144,0x59c559c5,0x51a451c5,0x41634143,0x62264984,0x49846247,0x7b0a51c5,0x7b0a72c9,0x72a87b0a,0x834b72a9,0x830a8b6b,0x6a8872a9,0x62476226,0x41646227,0x49a53923,0x72aa5a27,0x49a66aaa,0x41844144,0x5a4641a4,0x7b6a6ae8,0x8bab838a,0x836a7b49,0x5a277309,0x5a275206,0x51e65a07,
-0x51e649a5,0x52065a26,0x49a551e6,0x51e63944,0x6a68832b,0x41444123,0x49864985,0x310351c6,0x39044185,0x416549a5,0x41244144,0x49854144,0x49644123,0xa4d28c70,0x9cd2a4f2,0x94719cb1,0x9c918c30,0x83ae9c71,0x83ce9c71,0x8bce730c,0x522883ad,0x942f62aa,0xa4b1a4b1,0x8bcd8bcd,0x940eac8f,0x942d836b,0xac8fac8f,0xa44ea44e,0xa46ea44e,0x93ec9c2e,0x940c9c4d,0x944ea48f,0x6287730a,0x9c4f838c,0x8bed734b,0x7b4b9c4f,0x940e6ae9,0x62a993ee,0xa4907b4c,0x72ea8bad,0x9c0e836b,0x8b4a93ac,0x938b93ac,0x93ac832b,0x832a7ae9,0x72c87b0a,0x832a72e9,0xbcd08b6b,0x7aea8b4a,0x8b2b7ae9,0x62077aa9,0x59c66a48,0x59c661e6,0x51655165,0x59865986,0x61a65986,0x51655165,0x598659a6,0x51a65165,0x51865186,0x6a696a48,0x6a485165,0x59e65a06,0x936c938d,
-0x7ae96a27,0x620582e8,0x51c47286,0x93aa8b4a,0x82e98329,0x8b296a46,0x62268309,0x82e87ae8,0x8b298309,0x8b4972a8,0x9baa7ae8,0x82e88b29,0x5a278309,0x59c64123,0x83096a47,0x72e88b6a,0x8b6972c7,0x72e98b6a,0x59c66247,0x49a56a68,0x51654144,0x6a884964,0x6a888b4b,0x6a696248,0x39034144,0x390338e3,0x51a64124,0x49846228,0xa44e8b8b,0x832a8b6b,0x620772c9,0x8b8b7aea,0x6a676267,0x72888b8c,0x6a4751a4,0x72887ae9,0x6a675185,0x7b0a8b4b,0x59c57267,0x59c64984,0x6a686206,0x72677267,0x62067267,0x49434943,0x6a686226,0x51e66267,0x5a465206,0x51e551e5,0x49a55a06,0x38e24103,0x5a264123,0x7b0a7aea,0x6a897aea,0x392351c6,0x51a549a5,0x7b2b5a28,0x39436a89,0x49a43944,0x626749e5,0x73096287,0x5a667b2a,0x72e96268,0x49e55a07,0x7aea6a89,
-0x5a065a26,0x418449a5,0x416451e6,0x8b8d4164,0x39237aea,0x51c651e6,0x52074144,0x41656249,0x310351c6,0x49854164,0x39034145,0x59c64144,0x51a54944,0x9cd2a513,0x9cd194b1,0x83ce94b1,0x94706b2b,0x9471a4d2,0x9cb19c90,0x8bee9c71,0x5a896b2b,0x62a95a89,0xad119c6f,0xa490a4b0,0xa4afa4af,0xa48facd0,0x9c2da48e,0x83cb9c2d,0xa4cf942c,0x8bec946d,0x9c6e9c6d,0x944d942d,0x9c6e946d,0xa4d0a4d0,0x5a88734b,0x8c0d83ac,0x940d7b4a,0x942eacd0,0x9c0d83ac,0x8baca48e,0x9c2d9c2d,0x9c4e9c2d,0x836c93cd,0x7b0a93ee,0xac708bcd,0x9c0db4d0,0x940c8b8b,0x8bab8bcb,0xa42e8bab,0x93ac9bed,0x8b6b938b,0x8b2a936b,0x8b0a7a89,0x51a57268,0x6a486207,0x59a661e7,0x51865186,0x59a659c7,0x51864945,0x496559c7,0x494551a6,0x59865186,0x59a55165,0x61e759e7,
-0x51a559c6,0x7aa751c5,0x5a048329,0x7ac88309,0xa3cc7287,0x6a879bcc,0x83288348,0x8b698b48,0x72877ae7,0xa40c93aa,0x7b088b69,0x72877b09,0x8b6b830a,0x49846a88,0x49844964,0x83096227,0x938c8b2a,0x72888309,0x934ba3cc,0x5a0772a9,0x5a074965,0x30e259c6,0x6a884163,0x416472aa,0x49654985,0x496451a5,0x390330e2,0x51e65185,0x6a866a46,0x7b099c0d,0x72c85a05,0x49846aa8,0xa42e6aa8,0x51c56a88,0x9bed832b,0x5a26832b,0x93ed8b6a,0x5a477309,0x5a063943,0x8b6c93ad,0x8b8c6a68,0x93eda42e,0x6a67a40d,0x93ac51e5,0x7b0aa42e,0x9c0d8b8c,0x8bac8bcc,0x72c98b8c,0x41634984,0x93ac72a8,0x6227830a,0x30e33944,0x6aa949a4,0x5a077b0a,0x51e64185,0x5a276248,0x72ea72e9,0x418451e6,0x49a55a06,0x72c95206,0x62475206,0x6ac9730a,0x5a486268,0x7ae949e6,
-0x6a88832b,0x5a476268,0x51e64144,0x72a98b6c,0x41444144,0x5a275a27,0x62276268,0x49c63924,0x41644185,0x51e772ca,0x59c649a6,0x51e64144,0x30e249a5,0x9cd1a512,0x9cf1a511,0x840e844e,0x9cd19cb1,0x8c2f9cb1,0x8c2f7b8d,0x6b0a83ae,0x8c2f8bee,0x6b0a9c70,0x8c2f5a88,0xa4b0a4d1,0x9c6e9c6e,0x942d9c6e,0x9c4d9c6d,0xacaeaccf,0xa4aea4ae,0x944da48e,0xa4aea4ae,0x8c2c8bcb,0xa48ea4cf,0x8c0d8bcc,0x83cda48f,0x9c4e7b8b,0x736a7b8c,0x8bcc942d,0x8bec7309,0x838b9c2e,0x9c4d8bec,0x838b8bac,0x838c940d,0x9c0e940d,0x836b836b,0x7ae9834a,0x7b2a7b29,0x522662c8,0x72ea93cc,0x93cc93ac,0x6aa872c9,0x938a8b4a,0x8b49938b,0x7ae87ac8,0x938b936a,0x7aca8b4a,0x51a659e7,0x518651a6,0x51665166,0x51865166,0x51865186,0x51655166,0x49655145,0x51655165,
-0x51655145,0x51c559c6,0x620559e5,0x518559e6,0x728851a6,0x8b4a830a,0x7b0872a7,0x83297b08,0x62257ae8,0x83476265,0x83498ba9,0x938c93ab,0x93cd8b6b,0x51c5832b,0x6a8972ea,0x62275185,0x6a6859c6,0x82ea7aa9,0x7ac99bac,0x5a0782ea,0x7aca6a49,0x62277289,0x49845a06,0x72a94104,0x72698b4d,0x62076a48,0x41255165,0x39024124,0x6aa84123,0x9bcb938b,0x9beb9c2c,0x6ac972c8,0x7b2b9c0e,0x93ac6a88,0x6246834a,0x72e86a67,0x836b72e8,0x49c55a67,0x8bac72e9,0x49c56aa9,0x7b2b7b2b,0x7b4b4164,0x520572e9,0x730a72ea,0x6aa849c5,0x7b4a93cd,0x7b2a7309,0x72c9834b,0x62275a06,0x832a830a,0x62476227,0x52066aa9,0x41644985,0x72ea51c6,0x49c66268,0x41844164,0x628849a5,0x5a076aa9,0x72ca6248,0x6a88832b,0x41854164,0x836b72ea,0x6ac972e9,0x49c54985,
-0x62475a27,0x39635206,0x834b51e5,0x41847b0a,0x62674184,0x62475a47,0x62476aa9,0x62884985,0x49e55a27,0x51c65a27,0x49c55206,0x624849a5,0x39035185,0xa5129cd1,0x9cf1a512,0x7c0d8c4f,0x9cf29cb1,0x736c9cb1,0xacf383ee,0x736c9450,0x83ad8c0e,0x730b7b8c,0x62c941c6,0xa4b09c6f,0x940d8bed,0x940da4af,0xa4af9c6e,0xa4ae9c4d,0x940c9c6d,0xa46da4ae,0x944c9c4d,0xa4ae944c,0x9c6ea48e,0x940d9c4e,0x83aca48f,0x944e838c,0x83acacd0,0xa48f8bac,0x9c2e93ed,0x7b4a940d,0x9c4e83ab,0x732a8c2d,0x8c0c7b4a,0x942d7b8b,0x6aa6836a,0x93cb8348,0x93ec8b8a,0x7b4bacb0,0x836b7b2b,0x7b2a9c0e,0x8b6a6aa8,0x62867b09,0x93aaa42c,0x7b288b69,0x72c76a65,0x938c938b,0x62067aea,0x72897aeb,0x496559c6,0x51854144,0x6a286a28,0x49444965,0x49444124,0x51455164,
-0x51665165,0x49654945,0x49444124,0x49655185,0x49654944,0x59c54944,0x59e56a47,0x6aa759c4,0x7b087ac8,0x83278b69,0x72c672a6,0x938b6a86,0x72a87b09,0x8bcc8b8b,0x9bcd7b2a,0x72a98b6c,0x620751c6,0x620759e7,0x624772a9,0x7289936c,0x6a277aa9,0x830a72a9,0x51a56a47,0x49654924,0x6a2759c6,0x7aea7288,0x59e67ac9,0x38e338e3,0x6a475165,0x83297ae8,0x6a867b28,0x73295a46,0x72ea834b,0x62468b4b,0x7b0951e5,0x6a678b6a,0x6ac86267,0x7b6b5a86,0x730a942e,0x7b4b5247,0x51e5838c,0x8bcc5a67,0x73295a47,0x49c57b4a,0x8bad5a47,0x6aa862c9,0xa44e93ec,0x834a9c2d,0x626849a5,0x8b6c9bee,0x838b72e9,0x6aa95a47,0x49c672c9,0x49853903,0x7b296aa9,0x626762a8,0x5a266287,0x5a065206,0x5a0751c6,0x62286aa8,0x39234164,0x52064184,0x5a676267,0x7b2b72e9,
-0x39435a06,0x72ea49a5,0x6268836c,0x41634184,0x49c55a27,0x6ac949a5,0x51c66aa8,0x62685a26,0x52064164,0x51c65a07,0x5a066247,0x72c951c6,0x59e759e6,0x9cf19cf1,0x9cf19cf1,0x9cd19d11,0x7bad840e,0x840e8c4f,0x8c2e7bad,0x734c8bef,0x7b8d7b6d,0x6b0b5aa9,0x5227736c,0x942f62a9,0x9c6fa4b0,0xacf09c8f,0xa48ea4cf,0xa4ae944d,0xa48eaccf,0x940cacae,0x9c0c9c0c,0xacce8beb,0x942da46d,0xacb0acb0,0x7b4b93ee,0xacb09c6f,0x836b7b6b,0x8bac9c2d,0x8b8c6aa8,0x7b4a9c2d,0x940d6ac8,0x83ab9c4e,0x940d8bed,0x7b6a5266,0xa44cacae,0xa42ca46d,0x8baa7b27,0x93cbacae,0x83299bec,0x7b298b8b,0x834a6a87,0x832a93cc,0x72e9834a,0xa42f5a06,0x8b8c9c2e,0x6a888b6c,0x72a9834b,0x9bee93cd,0x7aea72a9,0x51a582eb,0x8b2c6a68,0x6a486a27,0x62067268,0x72487249,
-0x49445985,0x51464945,0x49454945,0x51655166,0x49444965,0x59a54944,0x518451a5,0x51a54944,0x62266a47,0x9bcc7287,0x61e459c4,0x8b698308,0x83697ae7,0x8bab9c0d,0x6aa86aa8,0x9bec8b8a,0x8b6b7b09,0x41447aea,0x49644964,0x728859e5,0x8b2b830b,0x6aa78b4b,0x832a6267,0x49a56a89,0x72a97ac9,0x7ac86226,0x51857ac9,0x41044124,0x38e240e3,0x72a659e5,0x6a876245,0x51c572e8,0x626851e6,0x72c851e6,0x7ac7834a,0x830872a7,0x7ae87ae8,0x49c472e9,0x7b0a72c9,0x834b72ea,0x5a4672a8,0x72e98bcd,0x93cc6aa8,0x832b93cd,0x7b2b8b4c,0x5a474163,0x62876287,0x5a4672e9,0x7b0a6227,0x51c56247,0x72e972c9,0x6aa96267,0x7aeb6aa9,0x30e272ca,0x628749a5,0x7b4a6ae8,0x8bac838b,0x72c97b2a,0x7b2a7b0a,0x6a886a88,0x72e96a88,0x5a4772ea,0x6ac85a26,0x416449c4,
-0x72c949c6,0x7aea834b,0x28e251e5,0x6aa94184,0x5a265a26,0x5a275a27,0x51e65206,0x62675a27,0x628851e5,0x5a476268,0x5a476a88,0x6a8949a5,0x49c65a47,0x9d119d12,0xa511a511,0xa4f2a4f2,0x6b2b944f,0xa5127bcd,0x7b8ca4f1,0xa4b283ce,0x732c9c71,0x83ad5248,0x730b8bee,0x838d41a6,0x942fb512,0xa4b08c0d,0x9c6e9c6e,0xa4cfa4ae,0x944daccf,0xaccf8bec,0xaccfa48e,0xa48eb510,0x942d9c4d,0xa46f942e,0x6288942e,0xacd1734b,0x73098bcd,0x9c2d93ed,0x7b298bab,0xacaf93cc,0x838a7b6a,0x8bec9c4e,0x9c0e836b,0x836b7b4a,0x832a9c2e,0x93ab7b09,0x8bab93cb,0x7b089bec,0x8bab7b09,0x7b0972a8,0x7b09836a,0x8b8b8b6b,0x8b8b8b8b,0x72e9838b,0x838b7b2a,0x7ae972ea,0x93ac832a,0x5a0672c8,0x72c95a27,0x5a2672a8,0x62276a47,0x7aa97268,0x62066a47,0x72886a47,
-0x49436206,0x518559c5,0x61e661e7,0x61e659a6,0x62066a26,0x494459c5,0x51a661e7,0x49454925,0x49444965,0x59a65164,0x51435165,0x622659e5,0x7ae94963,0x51e59bcc,0x93ab6267,0x72c8938b,0x93cc7b09,0x62888b4a,0x41226247,0x59c64963,0x832a72a9,0x83098309,0x62467b09,0x51e672a8,0x498359e6,0x72a76a46,0x6a677287,0x490459c6,0x410340c3,0x41435183,0x6a676205,0x6a886206,0x30e159e6,0x6a866247,0x72a651e3,0x82e8938a,0x6a6759c4,0x834b6246,0x72e993ed,0x72e96267,0x732a72e9,0x7ae99bcd,0x62675a05,0x7b0a8b8b,0x52064985,0x6ac872c8,0x730949c4,0x6ac87b4b,0x72e972e9,0x834b5a46,0x72ea93ee,0x62684985,0x6ac9834b,0x41244185,0x6a883944,0x6ac87b4a,0x62876267,0x7b2a72e9,0x6aa96aa8,0x49c66aa9,0x5a4751c5,0x51e55a47,0x5a265206,0x832b6267,
-0x72ca834b,0x30e351c6,0x51e64144,0x39444164,0x5a276247,0x6aa96267,0x62886288,0x52266aa8,0x5a2651e6,0x5a0741a4,0x41855a27,0x730a5206,0x41635a47,0x9cf19d12,0xa5129cd1,0x9cb0a512,0xa4f19491,0x8c4f9cb1,0x8c0e9490,0x9450940e,0x7b4c8bae,0x8c0f83ae,0x7b4c9c30,0x5a6839a6,0xa4909c2f,0xa48f9c2e,0xacf1a46e,0x8c0c9c6e,0xacf0a4af,0xad10a4af,0x946d9cae,0xa4afa4ae,0x7b6aa48e,0x734a5226,0x8bed9caf,0x942d732b,0x62e98c0d,0x7b4a6ae8,0x6ac762a7,0x7329838a,0x83ab838a,0x7b2a7b29,0xac8f940e,0x8b8c8b6c,0x6a88834a,0xac4e93cc,0x834b8b8b,0x6a688b8c,0xa42f8b6c,0x72c98b4b,0x7b0a72c9,0x838a93cc,0x72e86aa7,0x72e893cb,0x93ec7308,0x62458b6a,0x62476226,0x72c9a42d,0x62476205,0x5a266206,0x62676a67,0x6a685184,0x6a4859e6,0x59c561e6,
-0x59a46a47,0x72886246,0x7aa882e9,0x6a467288,0x936a7ac7,0x72678b09,0x8b0c7a89,0x490459e7,0x49454924,0x49255166,0x51664925,0x41444924,0x51a55185,0x49a459c5,0x62674983,0x5a06830a,0x624649a4,0x93ac8b8b,0x6a8772a8,0x72885a25,0x6a465a06,0x6a876266,0x62466a66,0x59e57ae9,0x72e84984,0x8b8a9bcb,0x6a6772e8,0x82ea6207,0x40e34124,0x41024104,0x51a54123,0x938c7aca,0x51c459c5,0x62266246,0x7ae87286,0x82e88308,0x6a876a66,0x8bac8bab,0x5a676ac8,0x72e972e9,0x6ac85205,0x5a467b6a,0x7b2a6267,0x5a266a87,0x93cc7b4b,0x49c46267,0x8bac8bec,0x5a065206,0x72e9834a,0x62a841a4,0x49e6732b,0x72ea5207,0x730a730a,0x49646aa9,0x6aa83903,0x7b2a8bac,0x7b4a6ac8,0x7b2a834b,0x730a834b,0x7b2a6a88,0x6aa972e9,0x832a72ea,0x7b0a7b0a,0x51c66268,
-0x28c24164,0x5a0751c6,0x41644164,0x6a8851e6,0x418449c5,0x49c551e6,0x5a2749a5,0x6ac86268,0x5a476aa9,0x72ca72ea,0x6aa96a88,0x5a476aa9,0x49a55a27,0xa512a4f2,0xad11a4f1,0x7b8c9cb1,0x9c706b2a,0x6aea8c0f,0x9470736c,0x730b8c0f,0x62aa6aeb,0x52276269,0x838d7b6c,0x62697b4c,0xacd1730a,0xb4d1acf1,0x8bec942e,0xa4afa4cf,0x9c6e9c6e,0x9c2d940d,0xa46eacf0,0xa4cfa4ae,0xa48e9c6e,0x9c6facf0,0x838c940e,0x62a98bed,0x944e6ae9,0x838c9c6e,0x9c4e93cd,0x8bcca46f,0x7b4a93cc,0x8b6b6ac8,0x836b9c0e,0x73098b8b,0x9c0d834a,0x836a9c0c,0x6ac86aa7,0x7b0a838b,0xb490a42e,0x72c9834b,0x72e9832a,0x72e872a9,0x8349834a,0x62667b09,0x940c8bcc,0x832a7b09,0x7ac86a87,0x72886246,0x7b0a72c9,0x49636a88,0x622751c6,0x51e651c6,0x51c55185,0x622749a5,
-0x49847289,0x728851c4,0x59c56a26,0x59c451a4,0x7aa76a46,0x72877a87,0x72a96a47,0x59a659a5,0x61e76a28,0x41454945,0x61c761e8,0x41044125,0x51644945,0x49444944,0x41034964,0x49454144,0x59c64125,0x5a056227,0x9bec7b09,0x938c6246,0x72c9832a,0x62666287,0x72c86aa7,0x7ae98b6c,0x8b6a6a88,0x62667ac8,0x7b096a86,0x830a936b,0x51866a69,0x38e238e3,0x622738e2,0x72a8934b,0xa40c6a67,0x6a466226,0x6a677aa7,0x6a666a86,0x6ae85205,0x52265a46,0x5a876b09,0x4a0541a4,0x6b096ac8,0x9c2d7b6a,0x93ec942d,0x8bcc838b,0x6ac8940d,0x6ae94984,0x5205836b,0x940d6286,0x3902836b,0x8b8c49c5,0x730a72e9,0x7b4b83ac,0x51c65206,0x41455a48,0x41643923,0x418449a5,0x49a54164,0x398441c5,0x520641c5,0x394349c5,0x39433923,0x39033923,0x206128c2,0x39243923,
-0x41654124,0x41444145,0x5a0751e6,0x39433943,0x520651e6,0x49c54184,0x62686a88,0x49c54183,0x49c541c4,0x62686246,0x5a475a26,0x6ac86aa8,0x6aea6288,0xa512a512,0x9cb1a511,0x946f9cb0,0x8c0f838d,0xa491acf2,0x7b8c942f,0x734c6b2b,0x838d732c,0x8badacb2,0x836c6aea,0x5a47836d,0x732a3964,0x940eac90,0x9c6da48f,0xaccfa4af,0x626683ab,0x8bcc7b29,0xa46e9c4d,0x9c2dacef,0x8bac7309,0x8beda46e,0x7309838b,0x9c6f836c,0x7b6ba48f,0x8bcd836b,0x93ed7309,0x7b4a9c4e,0x9c2d940d,0x93cc836a,0x7b2aa44e,0x834b6a88,0x8bcc72e9,0x5225836a,0x8bec6ae8,0xa48e8bac,0x832a9c4e,0x72a87b0a,0x9c0d7ae9,0x620593ac,0x62468b4a,0x8b4bac4e,0x6a477267,0x6a4659e5,0x72886267,0x72a959e5,0x7aea72a9,0x59e67aea,0x72aa59e7,0x728959e7,0x412459e7,0x7aea5a07,
-0x41256a69,0x414551a6,0x622759e6,0x49a451a5,0x62056225,0x620551e4,0x8309934a,0x6a676a47,0x61e76a48,0x5a0659e6,0x5a067b2a,0x62076227,0x494459c5,0x59a65165,0x49054945,0x49455166,0x49244925,0x51a54103,0x6a8772a8,0x938c6a88,0x832a832a,0x72c88b6b,0x6aa86266,0x6aa85a26,0x7b0893cc,0x6a855a45,0x6aa772c7,0x6a677ac8,0x51c6832b,0x41254966,0x41443904,0x49a44964,0x6a6672a6,0x626651c4,0x8b6b6a87,0x51c58b6b,0x8b8b72e8,0x8bac6aa7,0x72e9836a,0x7b2a7b6b,0x62875a46,0x7b499c2d,0x6a675204,0x49a46225,0x6aa86246,0x836b72e9,0x7b297b2a,0x628772c8,0x8b8b72e9,0x836c8b8b,0x5227730a,0x730a49a5,0x834c8b8d,0x498572aa,0x30c24986,0x5a2749a5,0x52074185,0x52066aa9,0x6ac95227,0x62c9732b,0x6288730a,0x39233924,0x62075a07,0x30e34985,
-0x49653924,0x49644985,0x41443944,0x49a551c6,0x49854985,0x51e551c6,0x49a549c5,0x6a886267,0x6aa86a88,0x51e649a5,0x72ea72e9,0x51e65206,0x5a465a47,0xad32ad32,0x83acad12,0x6b0a5267,0x62ca736c,0x8c2f942f,0x83cd6b0b,0x834c9c50,0x62896268,0x5a685a48,0x72eb7b6c,0x7b4b6aca,0x626862a9,0x9c2e940e,0x940c9c4d,0xa4ae9c4d,0xa44eac8e,0x6a8893ed,0x7b2951e5,0x940ca48e,0x8bab7308,0x940cac8f,0x522672c9,0x836b9c0e,0x8bab7b09,0x940d8bcc,0x7b29a48f,0x93cc8bec,0x834a836a,0xa42e940d,0x72c87b2a,0x8bad8bac,0x5a47836c,0x9bed93ee,0x8bab7b29,0x73297b29,0x93ec6aa7,0x832a72e9,0x93aca42e,0x830a72c8,0x936b9bcc,0x7ae98b4b,0x830a7289,0x72a9830a,0x59e69bcd,0x6a476227,0x620759c5,0x49856248,0x624851a5,0x832c6a89,0x41445a08,0x59e84165,
-0x5187624a,0x49254947,0x832b51a6,0x59e66a68,0x5a266a47,0x83097ae9,0x5a056a86,0x59e55a05,0x72887287,0x6a875a06,0x626672c7,0x8b6a7b08,0x6a2672a7,0x61e66a27,0x51465166,0x51655165,0x49454945,0x51855165,0x49a54964,0x62477b0a,0x7b094964,0x51c472c9,0x93cc834a,0x72a951c5,0x6a876aa8,0x834993ec,0x5a0449c3,0x6a876a67,0x7aca72c9,0x41256228,0x38e338e3,0x59c43903,0x72a77287,0x6a468b4a,0x62474162,0x51e56267,0x6246834a,0x7b0972a8,0x72e95a26,0x6a88834b,0x836b72e9,0x49a472e8,0x6aa88329,0x7b296aa8,0x59e57ae8,0x6aa83943,0x9c2d940c,0x8b8b834a,0x6aa793cc,0x62875206,0x4a063984,0x942e836c,0x3103730b,0x8b8c5207,0x72ea8b6d,0x62487aeb,0x62676268,0x29033964,0x7b6c5a47,0x41a55a48,0x8bac7b6c,0x6a687b0a,0x62284185,0x6a49832c,
-0x39044165,0x390330e3,0x39244144,0x41644124,0x414451c6,0x41644144,0x62685a26,0x59e651e6,0x41845a26,0x7b0a6aa8,0x5a466288,0x62686268,0x7b6b6aea,0xad12ad12,0x9cf1a4f2,0x8c2f9c90,0x83cd7bad,0x9450840e,0x9c709c91,0x940f9cb1,0x730b72eb,0x8bee7b6c,0x838d9c50,0x730b730b,0x6aea730b,0xb4d17b4b,0x5a87a490,0xa48e7b6b,0xa46ea48f,0xa42fac8f,0x7b4b732a,0x5226730a,0x940d72e9,0x838c93ec,0x93cd9c2e,0x9c2e8b8c,0xa42c93cc,0x838aa44d,0x8b8b7b4a,0x8b8b7b09,0x832a72e8,0x72e87b2a,0x72e97b0a,0x6a8893cd,0x7ae972c9,0x72a8832b,0xa40e834a,0x93ec72a8,0x72c872c8,0x9bcdac6e,0x7b097b09,0x72886a68,0x8b4b6a68,0x622772a9,0x7aea7b0a,0x622751e6,0x7ac97aca,0x62276a48,0x496559a6,0x51a64965,0x5a285a07,0x5a08832d,0x51e74144,0x51e759e6,
-0x59e85a28,0x41656249,0x832c51a7,0x62285a28,0x496472aa,0x6a6759e5,0x6a4559e4,0x62266a25,0x7aa97288,0x832b7aea,0x5a065a26,0x9bcc834a,0x7b088329,0x62477b09,0x626772a9,0x51a559e5,0x496559c6,0x51864905,0x51865186,0x41444945,0x59e54143,0x7ae86a66,0x7ae98b4a,0x72887ac9,0x8b6b82ea,0x62456aa8,0x72e772e7,0x6a866a86,0x7ac872a6,0x6a687289,0x38e359a6,0x494340e2,0x59e64123,0x6aa7938c,0x51c46225,0x8b4a6a46,0x5a056a88,0x5a258329,0x8b296246,0x72878b4a,0x72c851c5,0x8bcc838b,0x62a893ec,0x8bac836b,0x62676267,0x93cd832a,0x51e56ac8,0x8b8b838b,0x49c45a26,0x8b8b6aa8,0x49e5834b,0x6ac95a68,0x7b4b6268,0x4a068bad,0x836d5a27,0x394351c6,0x62476267,0x7b4a5a46,0x49c68b8c,0x6aa94185,0x6ae96ac9,0x62a87309,0x418549c5,0x7b0c41c6,
-0x5a287aeb,0x41444986,0x392328e2,0x39234985,0x41244144,0x62485a07,0x498551e6,0x416551a6,0x6aa949a5,0x52066288,0x5a475206,0x62685227,0x5a687b2b,0xad12ad32,0x630a9c90,0xa4f27b8d,0x94709490,0x5aa983ad,0x8bce6b0a,0x730c83ae,0x732b730b,0x8bee6aea,0x9c30940f,0x62a97b6c,0x52275a88,0x9c0e62a9,0x9c8facf1,0x836a93ed,0x8b8b7329,0xac8ea42e,0xacb0acae,0x7b4aac90,0x6ac86288,0x52065a67,0x5a46730a,0x9bec49a4,0x62677b0a,0x836a836a,0xa44e7309,0x7b098329,0x834a93ab,0x8b8c8b6b,0x8b6c7b0a,0x5a279c0e,0x8b4b6aa9,0x72c9938d,0x830a6a88,0x936c6227,0x6a8772c9,0x93ac834b,0x93cc93ac,0x59e58b4a,0x5a067288,0x6a686aa9,0x7aea830b,0x7ac96247,0x9bee6a47,0x7268830a,0x51a66a48,0x41454104,0x5a0751a5,0x4986728a,0x6a8949a6,0x6aa96a89,
-0x59e77aeb,0x49663903,0x830d6a6a,0x624849a7,0x59e672ca,0x49637288,0x620559c4,0x62066205,0x59e659c5,0x416359e6,0x5a066a67,0x72a872a8,0x62466a87,0x7ac86286,0x626672a7,0x72886a67,0x728959c6,0x6a08832c,0x49654104,0x49454945,0x41444964,0x620659c5,0x82e96206,0x7ae8832a,0x51c48b4a,0x8b6a7ae9,0x5a056246,0x7b087ae8,0x7ae96aa7,0x62477aa9,0x492451c6,0x410340e3,0x51644103,0x72878b2a,0x624651c4,0x72a872a8,0x72c872c8,0x62478b8a,0x72a85a06,0x6aa772a7,0x6aa8830a,0x6aa85225,0x5a665a46,0x834a7b49,0x62476246,0x832a72e9,0x6aa86287,0x72c8836b,0x836a5a25,0x6ac89bed,0x5a6751e6,0x834c7b4b,0x7b4b72ea,0x6aea838c,0x836b7b4b,0x730a836b,0x39424983,0x62885226,0x6a886aa8,0x62677b4a,0x6ac949c5,0x7b2a836b,0x6aea7b2a,0x49854a06,
-0x730a5a28,0x72ca7b0b,0x49866269,0x414428c2,0x392449a6,0x49a551c6,0x39243903,0x41844164,0x394351e6,0x6ac95206,0x6ac96a88,0x72e97b2a,0x5a276288,0xad329cf1,0x9c91a4f2,0xa4d19c90,0x7bada4d1,0x730b83ce,0x7b4c83ad,0x8bef6aeb,0x732b940f,0xb4f2940f,0x730b9c70,0x734b6aea,0x52076aca,0x6ac95a48,0x9c4e8b8c,0x83abaccf,0x62666266,0x83286a86,0xa44ca44c,0xbd119c0c,0x9c0eac8f,0x6aa8940e,0x942d6ac9,0x5a465a46,0x520662a8,0x62675a46,0x8b6b49c5,0x5a068b8c,0x6a886247,0x62275a07,0x49c65a27,0x51e672c9,0x51c65a07,0x728872aa,0x830a6a48,0x5a066248,0x59e66268,0x832b59e5,0x93ada40e,0x49a56a68,0x72ca5a27,0x7aea6a48,0x5a0672ca,0x834b72c9,0x6a6851c6,0x51e6830b,0x62284965,0x59e76a69,0x62284124,0x51c7938e,0x51e74165,0x7b2c5a48,
-0x59e7834c,0x6a8a6a8a,0x6a8a7b2c,0x6a494966,0x498572aa,0x72885a06,0x61e57ac8,0x49434143,0x59c64964,0x59c66a47,0x6a466247,0x6a477288,0x7ae972a9,0x62456246,0x832a9bcb,0x6a476247,0x8b2a7ac9,0x6a487ac8,0x72a97ac9,0x49645185,0x49444964,0x49454124,0x59e65165,0x83487ae8,0x7ae772c6,0x6a668b49,0x6a674983,0x7b098329,0x49a46a87,0x7aea7ae9,0x62077289,0x49444944,0x49434102,0x51a44963,0x72886a68,0x6aa66a67,0x5a466245,0x49a55a67,0x832a6247,0x7b097b09,0x62877b09,0x6ac89bed,0x7b295a46,0x6a877b08,0x8b2a72a7,0x7b2993cc,0x72e96288,0x5a066aa8,0x8bab6aa8,0x7b298bab,0x8bad8b8c,0x5206834c,0x41c42922,0x41a55206,0x72e95a68,0x838b6ac8,0x7b2b8b6c,0x520672ea,0x51e53963,0x72c972e9,0x7b2c730a,0x51c65a49,0x730972ea,0x6ac972ea,
-0x31233123,0x6aa96288,0x8b8d72eb,0x51c672ab,0x31034144,0x30e23103,0x5a074185,0x31434165,0x31023943,0x418449a4,0x49a53922,0x62476247,0x62676267,0xa512a4f2,0xacf2ad32,0xa4f2ad12,0x7b6c8c0f,0x836d838d,0x72ea6aa9,0x628972eb,0x6b0b6289,0x838d83ad,0x7b6c730b,0x5a687b2c,0x7b2b62a9,0x49e56268,0xa46e732a,0x940c93ed,0x8b8a9c2c,0x49835a25,0x836a6266,0x9c0c8b8a,0x9c0dac6e,0xa46f9bed,0xa48f9c6e,0x7b4b9c2e,0x83ac942d,0x730a62a8,0x62677b0a,0x938d836b,0x7ac96248,0x6a89834b,0x72a972a9,0x49c54143,0x498551c6,0x51864965,0x498551a6,0x49854964,0x51a651c6,0x626851e6,0x6a896aa9,0x5a276a89,0x72ca51c6,0x72aa72ca,0x72ca7b0c,0x836c72eb,0x6a685206,0x49a57aeb,0x8b2d5a07,0x51c77b0b,0x832c51e7,0x5a08ac92,0x5a284124,0x838d5a68,
-0x51c793ee,0x93ae72aa,0x4165834d,0x832b5a08,0x49646a89,0x936b7288,0x59c56a66,0x6a266206,0x494459c5,0x51854965,0x82e96a68,0x51a561e6,0x830a6a48,0x62467b09,0x6a668309,0x72a8830a,0x7aa86226,0x83098309,0x59e582e9,0x6a477ac9,0x49456207,0x49444905,0x410338e3,0x496251a3,0x6a646224,0x6a866a85,0x82e97b09,0x7aea51e5,0x7ac85a26,0x7ae97ac8,0x61e66a68,0x51656207,0x39024123,0x494430e2,0x6a4759e6,0x59e46a67,0x7b2a5205,0x5a46730a,0x5a265a26,0x6a886267,0x8b8c6aa9,0x72e8940d,0x72e85225,0x8b8b93cc,0x72a77ae9,0x390251a4,0x836a51e5,0x72e87b09,0x72c9834a,0x7b2a5a26,0x62677b2a,0x6ac95a47,0x628972ca,0x730a6ac9,0x41a462c8,0x62a85a45,0x836b6ac9,0x5a87838c,0x73295225,0x5a27836b,0x834c62a9,0x7b2c834c,0x41856289,0x730b6288,
-0x5a486aaa,0x41844185,0x6ac96268,0x8b6c7ae9,0x7b0b7b0a,0x49a562a8,0x31023944,0x49e628e3,0x390349a5,0x392449a5,0x49654144,0x41443923,0x30c23924,0xa512ad32,0xa4f2a4f2,0xacd2acf2,0x6aea8bce,0x8b6d93ce,0x51e76249,0x83ae72eb,0x7b4c7b6c,0x9c707b6c,0x7b6d9c70,0x6aa96aca,0x836c730a,0x6ac983ad,0x9c2d6aa8,0xacaeacd0,0x9c0c9c0c,0x49a493ab,0x41436247,0x5a064143,0x9c2d8b6a,0x9c0c93ec,0x83aca46e,0x9c6e8bcc,0x9c6da4cf,0x940c8bec,0x8b8c93ed,0x9c0d9bed,0x7ae9a40e,0x8b8c832b,0x72e972c9,0x7aea6aa8,0x7aca7ae9,0x51c66a48,0x59c75185,0x51e66a48,0x51c74986,0x6aaa4164,0x7aea7b4c,0x834c834d,0x51e651c6,0x7b0b93ae,0x730b732c,0x940f730b,0x6aaa62a9,0x6aaa6aaa,0x9c30ac71,0x5a086289,0x8b6d6aaa,0x5a288b6d,0x836d6aa9,0x7b4c6aaa,
-0x5207940f,0x838e6249,0x418672eb,0x93ce6acb,0x5a0772ea,0x6a687aea,0x59e56206,0x496461e6,0x6a6851a5,0x49446247,0x59a55185,0x72887247,0x61e57268,0x59e55184,0x62476246,0x62456226,0x62466a87,0x7ac86245,0x8b6a8b29,0x7aa9832a,0x51857269,0x41444944,0x49644102,0x496459c6,0x62254964,0x6a876a86,0x62466246,0x8b6b7aea,0x8309830a,0x51845a05,0x62066205,0x622759e6,0x390351a5,0x39034124,0x72884944,0x72877ae8,0x7ae9832a,0x626849a5,0x6aa872e9,0x6aa862a8,0x72c972e9,0x5a2672e8,0x836a7329,0x62466246,0x6a878b4a,0x832a59e5,0x7b29a40e,0x62a75a25,0x6aa772e8,0x72a87ae9,0x628851c5,0x836c93cd,0x730b6aa9,0x6ac9836c,0x732a6288,0x49c55a47,0x6ac96288,0x396449e6,0x836b62a8,0x62885247,0x836d8b8d,0x732b72ea,0x7b4b7b6c,0x7b4b6aeb,
-0x6aaa6aca,0x41845a68,0x416430e2,0x59e64184,0x72c96248,0x7b4b8b4c,0x6ac972c9,0x51e662a9,0x39243944,0x30e33944,0x39243923,0x49a63924,0x30e34185,0x9cf19cf1,0xa4f2ad32,0x62a9838d,0x8bad7b6c,0x51e75a27,0x62286aaa,0x7b6d6249,0x5248734c,0xa4b19450,0x7b4c83ad,0x732b8b8d,0x626849e6,0x7b2a8bcd,0x72e941a4,0xac8e83ab,0xb4b0b4f0,0x834aac8f,0x49a58b6b,0x39024144,0x7b0949a4,0x6a88836a,0xac8fa44f,0x9c4c93ec,0x8beb8bcb,0x9c4d9c4d,0xa46ea44d,0x6ac8a46f,0xac4e832a,0x93cc9bed,0x93cca42d,0x8b6b93ac,0x8b8c93ab,0xa3ee9bed,0x6a69830b,0x8b6d72aa,0x51c66228,0x836c5a28,0xa430acb1,0x6aca72a9,0x6aaa6aaa,0x7b4c9c0f,0x8bce6aca,0xa471a4b1,0x838d730b,0x838db513,0x72eb72eb,0x628a62aa,0x9c307b2c,0x6a8a7b4c,0xa4b19c50,0x7b2b730b,
-0x628993ee,0x72eb62aa,0x6269730b,0x9c2f6aaa,0x62688bae,0x62277b0b,0x62477288,0x7aca6206,0x51a56a68,0x59e659c5,0x51a572a8,0x51a551a5,0x59c551c5,0x7aa96247,0x7ac96a67,0x7b0851e5,0x62466a66,0x6a6672c8,0x6a6751c4,0x6a687aa9,0x620651a5,0x62466a47,0x39024964,0x41034984,0x49444944,0x72a86206,0x72a78309,0x624751a4,0x72c982e9,0x6a8772a8,0x72a77287,0x62466a66,0x51867289,0x390330e3,0x49654103,0x498451a5,0x6a685a06,0x6aa993cd,0x836b49e5,0x5a468bac,0x6ac849e4,0x93cd8b8b,0x6aa8940d,0x93ec72e9,0x832a93cc,0x7b09830a,0x5a056a87,0x7b2972e8,0x83697b08,0x8bab93ec,0x8b6c93ac,0x5a476268,0x41846268,0x72ea4184,0x7b2b93ed,0x836c6aea,0x7309838c,0x730a6288,0x522783ac,0x836b5247,0x312362a8,0x730a5226,0x39645247,0x52275226,
-0x5a683143,0x62a96ac9,0x5a276aa9,0x31234124,0x51c751c6,0x6aa951e6,0x7309730a,0x838c834a,0x7b2b836c,0x6aaa832c,0x51e75207,0x396449c6,0x30e23944,0x9cf19cf1,0x9c90ad32,0x730a7b8c,0x62286aaa,0x39245207,0x7b0b51e7,0x730b72ca,0x83ad9c50,0xb4f27b6c,0x6ac9940f,0x6aa95a88,0x62a96aca,0x730a6268,0x52466aa9,0xacaf93ec,0xa48fa48f,0x93edacb0,0x7b09a44e,0x72a972a7,0x39245a07,0x394338e3,0x7b4951e4,0xac6f9c4d,0x940ca46e,0xa4ae9c2d,0x8baaa46d,0x8b8b93eb,0x9c0b7b09,0x62458baa,0xb4cf834a,0x9c0c940c,0x938a9bec,0x93ab7b09,0x6a488b6b,0x6a69830b,0x6a8993ae,0x838d8bce,0x9bef8bae,0x6aca6aaa,0x838d93ee,0x83ad838d,0x7b8d7b8d,0x9c71940f,0x732c83ae,0x734c838e,0x626962aa,0x730b6aeb,0xa4917b4c,0x7b0b730b,0xacf3a471,0x6acb838d,
-0x8bae8bef,0x7b4c6289,0x5a285a48,0x9c50732c,0x62898bce,0x6aa9834c,0x72a96a89,0x72ca6a89,0x5a277289,0x5a266227,0x518551c5,0x51a56207,0x7ae951c5,0x8b4b93ad,0x72a972c9,0x7b095a06,0x6a88830a,0x62465a06,0x936c8309,0x62466a68,0x72c86a66,0x6a678308,0x518551a5,0x40e338e2,0x390438c3,0x59a64985,0x6a4759e6,0x624772a8,0x726872a8,0x62456a67,0x72c76225,0x72c88308,0x51a66a69,0x38e34104,0x38e34104,0x516538e3,0x72a96227,0x62276a67,0x624772c9,0x7b296267,0x6aa772e9,0x836b5a87,0x62675a26,0x72e98b6b,0x6ae95a46,0x7b2a6287,0x93cc8b6a,0x62668b6b,0x72e75a24,0x62458328,0x72c85a05,0x7b0a834a,0x5a466287,0x8bcc7b4a,0x418449e5,0x8bad734b,0x5a47834c,0x49c63144,0x52265a68,0x7b2b6ac9,0x732a730a,0x6ac97b6b,0x62c949e6,0x6ac98bcd,
-0x7b4b6287,0x730a732a,0x39446288,0x62895a48,0x31023102,0x41644984,0x5a064964,0x62676268,0x72e96aa8,0x836b6ae9,0x8bab836b,0x7b6b8bcd,0x8b8b836b,0xa512a512,0x732b9c70,0x416441a5,0x5a276269,0x6a8949a6,0x836c72aa,0x734b8bae,0x946f83ad,0x7b4c734c,0x838d7b8d,0x6aea732b,0x6aea6aca,0x8bee8bad,0x8b8c9c6f,0xa48f838b,0x8bcd9c6f,0xacef9c6e,0x942dacce,0xa46f9c4e,0x51e68b6c,0x392330c2,0x39223903,0x6a8849a4,0x93ad832b,0x9c4d9c0d,0x93eba46d,0x8b8a5a45,0xa42cb48e,0xac4d9bec,0x93eca44c,0x73289c2d,0x938b7b09,0x7ae88349,0x59c67288,0x51a65a07,0x6a88832b,0x836d93ee,0x8bee730a,0x940f93ee,0x8bee8bce,0x7b6c6aea,0x736b8bee,0x9c917b6c,0x7b6da4b2,0x8c0f7b6d,0x732b9450,0x7b6c6b2b,0xad13736c,0x6b0b7b6c,0x943083ad,0x62ca7b6d,
-0x940f83ce,0x8bef5228,0x4a286b0b,0xacb183ad,0x732b8bce,0x51e793ee,0x6aa959e6,0x72aa8b6d,0x6ac96269,0x72a96248,0x5a066247,0x62486247,0x72e96248,0x5a077aea,0x830b7ac9,0x5a06834b,0x832a7ae9,0x7b0a72c9,0x7b0a832a,0x51c47ae9,0x6a666266,0x59a56205,0x620659a5,0x41447268,0x40e44124,0x40e44104,0x51a54104,0x49846227,0x6a8749a4,0x62466a67,0x62466a86,0x8b6b6246,0x620793ac,0x51a66207,0x30c34104,0x410438e3,0x496440e3,0x6a677ae9,0x6a875205,0x834a7b2a,0x7b2a72e9,0x6ac8a44e,0x8bab6a87,0x6aa972c9,0x6ae98bac,0x834b6ac9,0x62a66a87,0x836a7b29,0x72c87b28,0x7b097b29,0x6aa77b29,0x5a665a26,0x7b097b2a,0x52055206,0x732b732a,0x418562aa,0x62893964,0x732a7b2b,0x49c57b0b,0x62a93103,0x836b8bac,0x6ae96aa8,0x734a83ac,0x8bad6ac9,
-0x20c162a9,0x7b4b5247,0x62886ac9,0x8b6c93cd,0x72e87b2a,0x59e559e6,0x412459e5,0x51a54964,0x620551a5,0x62675a26,0x5a466aa7,0x62a85a67,0x5a666287,0xa4f19cb0,0x8bada4d1,0x6aa972cb,0x39444144,0x9c505a07,0xac92acb1,0xacf2acd2,0x732b9c50,0x8c0e7b6c,0x6b2b6b0b,0x7b2c83ad,0x7b4c6aaa,0x72ea7b4c,0x940e62a8,0x8bcc8bcc,0xa48e9c6d,0xa4cea4ae,0xa48ea48d,0x9c4eb4f0,0x7b2a93cc,0x6aa96aa8,0x41244985,0x41443103,0x41653924,0x520549c5,0x93ab6aa7,0x8349938b,0x9bed8b49,0x72c8832a,0x7b0893cb,0x7b096a87,0x72e87b09,0x8b6b834a,0x49646247,0x51c759e6,0x6aa9836c,0x7b6c83ad,0x838d7b6c,0xb513838d,0xa4b1942f,0x736c83ae,0x944f7b6c,0x7bad9c70,0x6b0a9450,0xacf29cb1,0x7badacf2,0x8c0f7b8d,0xb55483cd,0x83ae942f,0x9c718c0f,0x732c83ce,
-0x9c919410,0x734c5227,0x62ca5a89,0x9cb08bee,0x7b8d83ad,0x730bb513,0x52076289,0x7b2c836d,0x72ea6aca,0x72c96aaa,0x49846226,0x59e65a06,0x51a559e7,0x8b6b6a68,0x62486a68,0x62684144,0x62477b2a,0x8b6b72c9,0x6a676247,0x6a4651e5,0x72a88b4a,0x59e56a67,0x72674983,0x62076a27,0x516559c6,0x38c240e3,0x410440e3,0x38e34103,0x72a86a27,0x83296246,0x6a878349,0x72c87288,0x6a675a06,0x62079bad,0x412538c3,0x38a340c4,0x410338c2,0x7aa84985,0x6aa793ac,0x62884184,0x5a467b2a,0x834a6287,0x7b0972c8,0x836b9c2e,0x5a664184,0x7309838b,0x834a6ac8,0x6ac793eb,0x8b8a5205,0x6a8793cc,0x7b496aa7,0x8b8b9c2d,0x49a45a46,0x62c751e5,0x6b0a7b6b,0x6aea5227,0x8bcc93ed,0x52276ac8,0x51e749c6,0x8bad6aea,0x312262a8,0x7b8a41c4,0x418483ab,0x8bad5227,
-0x6aca730b,0x39846289,0x732a49e5,0x62876ac9,0x6a6772c9,0x72477288,0x6a0661e6,0x61a67a47,0x40c140c2,0x49434943,0x5a464984,0x62a772c9,0x62476266,0x734c9cd1,0x730b730b,0x59e76a68,0x51c64986,0x52074985,0xacf29c50,0x8c0fa4d1,0x734c6b0b,0x8bce730a,0x7b8c9c91,0x83ae6b0b,0x836d83ae,0x7b6d9c50,0x52486aea,0x940d9c90,0x942b7b49,0xaccfa48d,0xa46d9c4d,0xb4efb510,0xa44da46e,0x93cc9c2d,0x51c6836c,0x59e76249,0x41444124,0x41434164,0x41433922,0x49844984,0x59c65164,0x51c559e5,0x8b6c7289,0x8b6b7ac9,0x51a57aea,0x51c54964,0x51855185,0x49a659e7,0x72eb8bae,0x7b8d8bae,0x8bee8bce,0x9cd17b6d,0xacf29cb1,0x8c4f9c70,0xa512a4d1,0xa4d1a4f2,0x840e9c91,0xad12a512,0xa4f2ad32,0x8c4f9cb1,0xa4f28c4f,0x83cd9470,0xad339470,0x736d9491,
-0xa4917bee,0x734b83ce,0x7b8d62ea,0x9c918c0e,0x94309c70,0x5227a471,0x6aca730c,0x838d62aa,0x5a897b6c,0x5a276268,0x7aea72ca,0x51a672c9,0x624859e7,0x51c559c6,0x6a676247,0x938c5a06,0x5a257288,0x832b72c9,0x72c88b6b,0x8b6b6287,0x7288830a,0x624659c5,0x6a2582e8,0x59c56226,0x72467267,0x6a266205,0x494461e6,0x410438e3,0x39024103,0x62676a47,0x72a97288,0x7b096a88,0x9c0c7ae8,0x62267ac9,0x40c34965,0x40c338c4,0x30e238e3,0x59e64144,0x6a685a06,0x5a6672e9,0x6aa849a4,0x6a878b8b,0x7b096226,0x72c87b09,0x9c0d836a,0x6ac88bab,0x8bcd72c9,0x62a86ac9,0x7b29836a,0x6ac76266,0x72e97b4a,0x49c451e5,0x836a7308,0x730972e9,0x836c8bcd,0x6ae95a48,0x51e56b09,0x6aa849c4,0x72ca730a,0x49c68b8c,0x6ac83122,0x6ac87b29,0x836c7b4b,0x732a72ea,
-0x7b2c940e,0x5a275a69,0x7b2b6289,0x6aa96aa8,0x59e749c6,0x51857268,0x69c540c1,0x59037a27,0x59035903,0x598571e5,0x412238c1,0x38e24943,0x49433903,0x944fad32,0x6aca6b0a,0x51c672aa,0x5a074144,0x732b6aea,0x9cb08bee,0xacf2ad12,0x5a888bcd,0xacd2734b,0x7b4c942f,0x8bcd732b,0x7b8d940f,0x7b4c8bef,0x9c709c70,0x7b8c944f,0x730862a8,0xa46d93ec,0xa4aeaccf,0xa48eacef,0xaccf9c6e,0x93eca46e,0x836b9c2e,0x93cd8b6c,0x6a886a88,0x38c372a9,0x51654944,0x41244104,0x49254944,0x49244944,0x51654924,0x416559e6,0x51665186,0x49454945,0x51a65165,0x51a651e7,0x838d8b8d,0x83ef7b6c,0x9c709c91,0x9450940f,0x94709c70,0xad53ad13,0xad53ad32,0xb553ad73,0x632a8c2f,0xa4f19cb1,0xad33ad33,0x9cb19d11,0x9cf19cf1,0x94b19cf1,0xad33a512,0x9cb29cd2,
-0xa4d19cd2,0x83cda4b2,0x7bad7bcd,0x94709470,0x732c7b8d,0x62ab736c,0x8bef8bce,0x838d7b2c,0x6b2b7bad,0x62486ac9,0x49666248,0x62486a89,0x496451a5,0x59e64985,0x83095a05,0x7aa87ac8,0x62066226,0x624659e5,0x83298b4a,0x6a678b6b,0x59e651a4,0x62255a05,0x82c77aa7,0x6a667ac7,0x72877aa7,0x6a477267,0x51a56206,0x59a55164,0x49654124,0x59e638e3,0x6a886248,0x72c87b09,0x8b496a87,0x59e56246,0x72487288,0x38c34925,0x30e338c4,0x30e23903,0x7b2a6ac9,0x62876ae9,0x6ac85205,0x7ae8a42d,0x51c46205,0x834951c3,0x93cbac8e,0x8bed6ac7,0x6288732b,0x9c4e93ed,0x6287836b,0x8bab6266,0x626762a7,0x7b0972c8,0x51e46ae8,0x6ac84183,0x6ae88bec,0x7b6b5a67,0x52066ac9,0x730a72e9,0x522651e5,0x6aa86ac9,0x72c97b2b,0x41643923,0x49c56aa9,0x6aca3103,
-0x6aca6aea,0x39656289,0x49e520c2,0x5206730a,0x6a4751c5,0x40c14964,0x50a15923,0x61034860,0x58c150a1,0x69846964,0x61c46183,0x8ae87266,0x61c58ae9,0x940eacf2,0x51c65a48,0x496559e7,0x6aa94985,0x9c709c50,0xad12a4f1,0x6b0b83ee,0x732b838d,0x9c2f6aca,0x838c93ce,0x9c5083ae,0x8bcea491,0x62ca6aeb,0x83ad732b,0x7b8c7b8c,0x62677b4b,0x73295245,0xa48ea48e,0x9c4d8bab,0xa48ea48e,0xacafa4af,0x9c4daccf,0x9c4d8bec,0x93cd836b,0x7aa99bae,0x62078b2b,0x62075986,0x51654925,0x518661e7,0x51854924,0x49664966,0x59c751a6,0x59e75186,0x49656208,0x6aa959c6,0xac917b2c,0x8bee83ad,0x83ee83ad,0x8c0facf3,0xb553b553,0xad53ad33,0xad33ad53,0xa532a512,0x8c2fad33,0xa4f28c4f,0xa512ad33,0x9cd19cd1,0xa512a4f2,0x9cf29cf2,0x9cf2a512,0x9cf29cf2,
-0xa4b1a4f2,0xad339c90,0x736c9470,0x9cd194b0,0x736d7bad,0x945083ce,0x83ae732c,0x83ae62ca,0x7b6da4b1,0x7b2c6289,0x41256228,0x518551c6,0x59c54984,0x498551a5,0x82e972a9,0x518459e5,0x72877ac8,0x93ab6246,0x7ac9a40e,0x626759e6,0x49846267,0x7ae94983,0x72a7938b,0x7aa74142,0x72667ae7,0x72877a87,0x6a676206,0x6207830a,0x41045186,0x41243904,0x49644124,0x7ac86226,0x6a468309,0x7ac87287,0x62267aa8,0x41044944,0x39044104,0x622738e3,0x6ac972c9,0x628772e9,0x8b6a6287,0x8b6a7b09,0x7ae88329,0x83088329,0x72c76246,0x62a8940c,0x6aa949c5,0x6ac96ac9,0x7b4b7b4a,0x834a6ac9,0x8bac836b,0x7b4a9c0d,0x62675226,0x7b4a7b4a,0x52265a46,0x62a8838b,0x734b49c5,0x5a4683ac,0x838b62c8,0x6a885a67,0x418572ea,0x628a3965,0x62676248,0x62697b0a,
-0x732b49e7,0x28e26288,0x838c5207,0x7b2a838c,0x622672e9,0x7a887247,0x50c36185,0x61036944,0x9a677164,0x696481e5,0x48c15922,0x6a054922,0x51637205,0x6aa9ad12,0x61c74924,0x41245186,0x51c64965,0x8bcea42f,0x730b6aea,0x7b4c836c,0x62686aa9,0x626972ca,0x8bad6a89,0x940f93ce,0x9c70acb1,0x94708bcd,0x62ea7b8d,0x732b6b2b,0x6aa9732b,0x834a5a27,0xacd093ed,0xacafa48e,0xa46eb4f0,0x940d8bcc,0xa4f09caf,0xa48e9caf,0x8b8c7b6b,0xa46da44d,0x93ec93ec,0x8b6b7b08,0x620772a8,0x72897aca,0x728959e6,0x51a649a6,0x836c5a28,0x6aaa6289,0x59e77b2c,0x72eb6a8a,0x83ad836c,0x942e9c70,0x94708c0e,0xb573a4f1,0xad32ad32,0xad33ad53,0xad53ad53,0xad33a532,0xad33a512,0xa512ad73,0xad12a512,0xa512ad12,0x840e9cd1,0xa4f29470,0xa4d1a4f1,0xa4f29cf1,
-0xa4f2a512,0xa5129cd1,0x9cd1a4f1,0xa4d2a512,0xa4d19490,0x94919cf2,0x8c2f6b4b,0x9c508bee,0x62a98bee,0x832b6aa9,0x5a074165,0x7b0b72aa,0x49846207,0x59e659c6,0x518461e6,0x6a467aa8,0x5a056205,0x936b7ae9,0x5a057267,0x72886a47,0x62477aea,0x7b0a6a88,0x41845a27,0x59c65a47,0x6a6749a5,0x59e659e6,0x8b2b830a,0x6a2859c6,0x62086a27,0x38c34965,0x494438e3,0x59e659a6,0x83095184,0x62267ac8,0x728872a8,0x498551a5,0x39044124,0x39034124,0x51c54164,0x7ae85a26,0x72e88b8b,0x9c0c7b29,0x73086a87,0x6aa78bab,0x83aa5225,0x62a98bed,0x5a486aca,0x7b4c6268,0x8bcd8bad,0x73298bac,0x52255226,0x52255a25,0x8bac72e8,0x62887b4a,0x8bac6ac9,0x5a677b4b,0x838c7b4a,0x62876288,0x6ac983ab,0x6aaa3944,0x49c56289,0x93ad72ea,0x6ac97b0a,0x83ac8b8b,
-0x8bed83ac,0x28e262a8,0x41652882,0x62886aa8,0x6aca5206,0x5a27730a,0x82aa6208,0x61847207,0x50e26984,0x618550e1,0x71e669a6,0x49017a25,0x72054902,0x5a28838c,0x59c65186,0x49654925,0x834c7aea,0x6b0b5a68,0x836d836c,0x5a2762a9,0x7b2c7b2b,0x62695207,0x6aea49e6,0x8bcd9c4f,0x736c6aea,0x83cd736c,0xa4b1a4d1,0x8c0e9c90,0x8bee944f,0x8b8c6ac9,0x73096ac9,0xacafa42e,0x944d9c4d,0x9c8e9cae,0x8bec8c2d,0x9c6ea48e,0x6b097b4a,0x9c4e8bec,0xa48e944e,0xa44d93ec,0x9c0dbcef,0x9bcc8b6a,0xac6fac6e,0x93ae8b6c,0x7b2b72ca,0x7b0c7b0c,0x6aaa72eb,0x7b2c72eb,0x9c50940f,0x83ac9c50,0xa4f183cd,0xa512ad73,0xad73a552,0xa532a552,0xad53ad53,0xa512a532,0xad32ad53,0xa512a512,0xa4f1a512,0xad12a4f2,0x8c0e9cb0,0xa4d19470,0xa512ad12,0xa4f2a4f2,
-0xa4f29cd1,0x9cd1a512,0xa512a512,0x9cd1a4f1,0x9cf19cf1,0x9cd19cf1,0x94b09490,0x940fa4f2,0x62c96289,0x49a67b2c,0x626872ea,0x5a065a07,0x61e659e6,0x620759e6,0x7268830a,0x61e66206,0x6a477288,0x6a876226,0x72676a67,0x72a94944,0x5a2672c9,0x72c96247,0x51c66267,0x72a9832b,0x7ac9832a,0x62065a06,0x6a687aa8,0x59c551a5,0x6a0759a6,0x516561e7,0x40e34124,0x41034103,0x6a474964,0x59e54963,0x5a065a05,0x394359e6,0x30c238e2,0x518538e3,0x390351a6,0x832a5a46,0x6a676267,0x6a877ae8,0x7b4a6246,0x836a8b8b,0x7b498bab,0x730a5a26,0x730a7b4b,0x5a486ac9,0x6ae95206,0x62a783ab,0x83ab7309,0x6b087309,0x7b0a836b,0x5a675206,0x62a972e9,0x72e95206,0x6ae9836b,0x5a675226,0x5a47732a,0x62aa6aea,0x62a841a5,0x72ea838c,0x49c44164,0x5a456aa8,
-0x72e95a46,0x39045a27,0x414330e3,0x5a475226,0x49c65a68,0x834c49e7,0x728993ad,0x7a6861e6,0x51025102,0x92a98247,0x61a47a27,0x69e461a3,0x41225182,0x49864185,0x516551a6,0x41454925,0x6b0b51e7,0xacb29c50,0x49e68bad,0x7b0b6a88,0x51e749a5,0x832b838d,0x5a887b0b,0x83ad62a9,0x5aa98c0e,0x83cd4a48,0xad12a4f1,0xad32a4f2,0x8c0ea4d1,0x8b8c83cd,0x52056268,0xa48f8b8c,0x942da4ae,0xa4af942d,0xa48ea48f,0x8bcc8bec,0x944d944d,0x524783ac,0x9c2f49e6,0x940d9c0d,0xa46c940c,0xac6cb4ce,0xa40c9beb,0xb4b09c0d,0x5a27ac90,0xb4b2834d,0x940fac91,0x940f8bce,0x9c907b8d,0x946f83ad,0xad53ad32,0x842ead73,0xad53842e,0xad53ad73,0xad73ad53,0xad33ad73,0xad33a512,0xad53a532,0x5288842e,0xb57483cd,0x734b9c90,0xad129470,0x734c9490,0x9cd19cb1,
-0x842e6b6b,0xa4f29cf1,0xa4f29cb0,0xa4f2a512,0xa5129cf1,0x9cd19cd1,0x9cb19cf1,0x8c0fa4f2,0x6aca7b6c,0x93ce5247,0x5a07a430,0x51e651c6,0x6a4851c6,0x49646a48,0x6a484944,0x6a278b0a,0x62064963,0x8b4a7ae9,0x62067ae9,0x622672a9,0x6a8859c6,0x5a276227,0x62276aa9,0x834b72c9,0x6a877aea,0x51a551c5,0x72886226,0x51a572a8,0x620759e6,0x62077a88,0x61c661e7,0x49444103,0x49444924,0x7aa84964,0x6a688b0a,0x62276207,0x38e34945,0x38e338e4,0x41244123,0x62474984,0x49846246,0x6aa872a8,0x62666246,0x72e97309,0x5a065a26,0x836b832a,0x49a45a47,0x49c54164,0x49c55206,0x7b6a5206,0x7b298b8b,0x41a451e4,0x62c962c8,0x6b0a5207,0x732a83ad,0x732a836c,0x52465246,0x732a6ae9,0x8b8c7b2a,0x730b8b8d,0x7b4b72ea,0x5a2772c9,0x6a886267,0x6aa75205,
-0x9bcd8b6a,0x62278b6c,0x288130c2,0x5a4630e1,0x6aea5206,0x5a677b2a,0x72a95a06,0x49646a67,0x6a055143,0x7a066183,0x71c569a4,0x48e08246,0x72264902,0x51a64164,0x51a659c7,0x5a2751a6,0x838d7b2b,0x49c56b0b,0x62896289,0x5a0749a6,0x62486aaa,0x5a685a07,0x9c30836c,0x6b0b942f,0x83cd62e9,0x946f840e,0xa51194b1,0xa4f2ad12,0x8c4fa4f2,0x7b6c6aea,0x5a477b4b,0x628751e5,0x944d7b6a,0x838b9c6e,0x940d8bcc,0x9c4e9c2d,0x8c0b9c6e,0x9c6f942d,0x6267730a,0x522572e9,0x72e86286,0x8baa7b28,0x7b4993ca,0x7b0972c8,0x62886267,0xacf193ee,0x8bcea4b1,0xb5327b8c,0xacf2acd1,0xb553b553,0xad53ad52,0x94f0ad53,0x9d128c4f,0xad73a533,0xad33ad52,0xad32ad33,0xa512ad33,0xad32ad12,0x736c9c70,0xad128c2f,0x732b8c0e,0xad12944f,0x5aa87bad,0xa4d19cb1,
-0x8c6f6b4b,0x9cb0a4f1,0x94b0a4f1,0x9cd19c90,0x62ea7bcd,0x840e8c4f,0x8c4f6b2b,0xa4b19cb1,0x83ad8bee,0x7b0b93ef,0x51a672ca,0x72a97aeb,0x51856227,0x61e65165,0x51a57247,0x6a475185,0x51a56247,0x938b72a8,0x51c57ae8,0x59c66207,0x59e66a67,0x93cc72c9,0x51c57b09,0x6a676a88,0x6a876226,0x72a87ae9,0x6a466226,0x624672c8,0x622759e6,0x6a684944,0x59e77aca,0x49445185,0x49244924,0x51645185,0x41233903,0x830b7289,0x49235185,0x39034965,0x410330e2,0x49443904,0x6a676a47,0x7ae85a06,0x6267836a,0x72c85a26,0x622772c9,0x7b096a68,0x7b0a8b8c,0x51c56a88,0x5a063902,0x51e572e9,0x626749a4,0x7b2a6ac9,0x838c7b4a,0x6b2b942e,0x6ac95227,0x52056ae9,0x732a49c4,0x732a93ed,0x52066288,0x7b2b730b,0x310251c5,0x522651e6,0x49a43943,0x6ac872c8,
-0x6a675a05,0x6a477ae9,0x30c24143,0x310230e3,0x6ac86267,0x49e549e5,0x6a886ac9,0x622651c5,0x49225183,0x514361e5,0x618350c2,0x59426184,0x7a667a25,0x72aa4165,0x49446207,0x72eb5a28,0x6aea6b0a,0xac71940f,0x59e77acb,0x8b4c7b2b,0x418549a6,0x838d6289,0x62a97b8d,0x83ee5a89,0xa4d1ad12,0xad329cd1,0x7b8c734b,0xad329cd1,0xad12a4f1,0x5a899cb1,0x8bed732b,0x5a47838c,0x836b4183,0x9c2dacd0,0xacd09c4e,0x9c8e9c8e,0x940c83ab,0x940da48e,0x8bab940d,0xa46e83ab,0x6aa77b29,0x62466286,0x62466aa8,0x6ac84183,0x49e57b4a,0x8bac7b2a,0x940e83ac,0x8c2e6309,0xad11b553,0x94b08c0e,0xad32ad53,0xb5b3ad32,0x632ba512,0xad33842e,0xb573b594,0xad13ad33,0xad12a4f2,0xa512a4f2,0x62ea9c90,0xa4d17b8d,0x8c0f83cd,0x9470acf2,0x8c0e6b0b,0x6b0b8c2f,
-0x9c9083ed,0x9c915aa8,0x4a06942f,0x83cd6aea,0x7bad6b2b,0x83eea4f2,0x83cd9470,0x838d734b,0x8bee8bee,0x41457b0b,0x49854104,0x496551c6,0x72486207,0x492459a5,0x59e55185,0x59c67a89,0x7ac95a05,0x72888309,0x51c559e6,0x6a687288,0x59c67aca,0x62264984,0x5a066206,0x832a59c6,0x72a772a8,0x728872c8,0x51e56225,0x72a76a26,0x6a8893ac,0x7ac96267,0x62286247,0x61e67aaa,0x30a25186,0x41234944,0x49444103,0x61e759c6,0x82aa6207,0x41034964,0x41244124,0x41444925,0x5a064124,0x72a87267,0x72a75a25,0x6a878329,0x7ae95a26,0x5a067aea,0x6a876225,0x51c56a67,0x49844143,0x62875a26,0x9c0d8b8c,0x5226836b,0x7b4b5206,0x736b8bcd,0x93ed838c,0x628772e9,0x836b7b4a,0x49c46268,0x6ac85a26,0x62276aa9,0x72e96a88,0x498449e5,0x5a056a88,0x6a675a26,
-0x8b4b6a87,0x6206830a,0x49655185,0x416430e2,0x5a666288,0x732b62a9,0x836b836c,0x6aa77b2a,0x7b0a6a67,0x49245a27,0x7a276a07,0x79846964,0x71a47184,0x61e759c6,0x49865166,0x6a895207,0x836c838d,0x8b8d72cb,0x51866208,0x620861e8,0x6a896228,0xa47172ea,0xacf2b512,0x8bee940f,0x83ad942f,0x734b83ad,0x83ed736c,0xad32a511,0xa4d2a4f1,0x8c2f9cb1,0x944f62e9,0x834b732b,0x5a266ac9,0x93ed7b0a,0x8bec942e,0x942d8c0c,0xa48e9c6d,0x8beb9c6d,0xa48d83aa,0xa46ea46e,0x836a9c4d,0x9c2d9c0d,0x5a266a88,0x5a666ac7,0x8bcc7309,0x9c0d940d,0x83cc838b,0xb512bd53,0x942e83ac,0x6b2a8c0d,0xacf2940e,0x8c0e83ee,0x8c0eacf2,0xa4b16b0a,0x83cdb554,0xad12734c,0x734ca4f2,0xacf26b2a,0x62a9acf2,0xa4b07b4c,0x72eb62c9,0x6b0bacf2,0x9c4f62a9,0x52287b8d,
-0x944f83ae,0x9c2f734b,0x836c93ee,0x83ad942f,0x93ef838c,0x734c5227,0x522783ce,0x62a9730b,0x7b2b6aca,0x394449a6,0x62276208,0x61e74965,0x494459e7,0x728961c6,0x59a559e6,0x6a687268,0x62066a68,0x6a6759e6,0x59e672a8,0x6a4751a4,0x62277267,0x72a86206,0x62477ac9,0x51a472c9,0x83095a05,0x59e572a8,0x72c86a47,0x51e45a25,0x626672e8,0x6a8872c9,0x59e65a06,0x5a075a07,0x72696228,0x494459c6,0x49244924,0x39034123,0x6a6759c6,0x620751a4,0x40e34965,0x41044104,0x59e63903,0x6226938b,0x5a2559e4,0x622659e5,0x62276a67,0x6a875a06,0x8b6b8b6b,0x59e56a66,0x41445a06,0x5a063923,0x624772e9,0x7b4a6ac8,0x7b6a7309,0x838c8bed,0x5a6762a8,0x7b4a7329,0x5a275a66,0x7309730a,0x41434184,0x6a686268,0x72c96247,0x7ae9834a,0x51e551c5,0x72e872e9,
-0x52066a87,0x624849c5,0x62677ae9,0x30e230e3,0x62883923,0x5a677b2b,0x41a428e1,0x7b2b6ae9,0x7b2b836c,0x832b7b4b,0x48e36a27,0x69645103,0x59235903,0x6a286a08,0x6a69726a,0x72eb6aaa,0x5a485a48,0x72cb834c,0x498559e7,0x59c74124,0x72aa72aa,0x9c507b0c,0xacf2b4f2,0xacf2acd2,0x730a9c70,0x7b4b4a07,0x83ee62c9,0xa5129cf1,0xa512a4f1,0x9470a4f2,0x7b6c5ac9,0x8baca4b0,0x7b2b6aa9,0x5a477b2a,0x944e83ac,0x9c6e9c6e,0x9c6da48e,0x942c93ec,0xa48eacae,0x72e89c0c,0x8b8b72e8,0xac6e9bec,0x93acb4af,0x8b8c7b2a,0x93cda42e,0x836b93ed,0xa46f730a,0x93eeb4f1,0x7b6c8bee,0x940e942e,0x734c6b0a,0x9c509c90,0xb4f3942f,0x9c4fb513,0xacf2a470,0x940f9c70,0xacd2b533,0x940e83cd,0x940facb1,0x93ee732b,0x7b6ca470,0x836c9c4f,0x93ee7b2c,0x838d838d,
-0x836c93ef,0x836cb4d1,0x93ce5a48,0x51c68b6d,0x52274985,0x6aeb5207,0x72ea72ea,0x416551e7,0x82eb6228,0x51a672aa,0x49655186,0x72896208,0x6a4872aa,0x59a55185,0x59e66207,0x59e551a5,0x5a066206,0x5a055a06,0x8b6b6a88,0x6a476a67,0x51a56a27,0x62274964,0x41426247,0x7b0949a4,0x6a6751c5,0x834a832a,0x62467ae8,0x624649a4,0x6aa893ab,0x7b2a5a05,0x832a93cc,0x72a972a8,0x59c66a48,0x59c64924,0x38e35185,0x51854124,0x62066206,0x62266a27,0x494459c6,0x410440e4,0x49644904,0x72a86206,0x51e46246,0x72c76a66,0x830a72a8,0x72a88b4b,0x72e972e9,0x6a676247,0x6a888309,0x72a84984,0x72a76a88,0x6aa772a8,0x73097ae9,0x730962a8,0x73096ac8,0x6ae97b6a,0x7b4a7b4a,0x62686287,0x5a076268,0x5a066a88,0x836b72c9,0x624672c9,0x49a35a26,0x6ae849a4,
-0x838c7b4a,0x7b0a8b8c,0x39235206,0x28a23904,0x836b5a27,0x39646288,0x7b2a5a27,0x39446287,0x52073944,0x72a98b6d,0x6a4759c5,0x72487a88,0x724782a8,0x72898b0c,0x6aaa59e7,0x62697b0b,0x62486268,0x498549c6,0x6a6949a6,0x51a66a28,0x6aeb51e7,0xacb29c30,0x93ee8bee,0x8bada491,0x5a686288,0x5aa83964,0x9c909450,0xa512a4f2,0x9cf29cf1,0xa4f2ad33,0x9c90acd1,0x942f83ad,0x83ad942f,0x6aea83ad,0x7b6b49e6,0x836b6aa8,0xa46e8bcc,0x9c4ca46d,0x93ebacad,0xa46da46d,0x7b09836a,0x522672a8,0x624749c5,0x6ac96268,0x7b4b7b0a,0x730a6aa8,0x72ea7b0a,0x6ac993ee,0x93ce6aa9,0x62696ac9,0x51e66269,0x7b2b6289,0x51e75a48,0x838d93ef,0x7b4c5a48,0x41c683ad,0xa470732b,0x41a5732b,0x62686269,0x5a484164,0x51c672eb,0x624872eb,0x72eb5a28,0x51e75a47,
-0x49a65a48,0x41856a8a,0x41653903,0x51c74985,0x6a696228,0x62896aa9,0x5a286249,0x51e76a89,0x51c64165,0x5a085a08,0x59c74966,0x59a651c7,0x620759e7,0x62276207,0x59c65185,0x6a4761e6,0x832a7288,0x49847288,0x59e659c5,0x622782e9,0x51c559e5,0x622659c4,0x51c459e6,0x62266a87,0x7ae972a8,0x5a056226,0x62675a26,0x49a47ae9,0x62676246,0x5a056aa7,0x7b0a6267,0x51c66a88,0x59e66268,0x49654144,0x38e34965,0x49644124,0x59c54943,0x7ac86a67,0x51856a47,0x39034144,0x41443903,0x59e559c5,0x62066206,0x496351e5,0x7ae959c5,0x834a7b09,0x6a877309,0x93ac834a,0x49857aea,0x6a674123,0x59e57288,0x834a6225,0x5a467b09,0x836a72e8,0x5a875a66,0x8bed8bab,0x6aa8838c,0x7b0a5a47,0x41438b4c,0x6a8730e2,0x51e57b09,0x72e849a4,0x72e8836b,0x7b4a7b4a,
-0x52056287,0x7b4a62c8,0x72eb836c,0x28a23904,0x62674184,0x832a6268,0x836b93cd,0x7b4b72ea,0x6b0a734b,0x7b0a6aea,0x61c57ac8,0x51644102,0x41027a89,0xa40f6a48,0x520793ae,0x93ce72eb,0x498551e7,0x51a65a08,0x624951c7,0x72eb6269,0x6aaa832c,0x9c706aca,0x6aea9c50,0x72eb5a68,0x5a4762a9,0x6aea7b4c,0x9cd18bee,0x9cf2a532,0x9cd194d1,0xad129cd1,0x730a8bce,0x838d83ad,0x8c4f83ee,0x9c509450,0x41a56289,0x520649e6,0x8bab6ae9,0x8369838a,0xb4afa46c,0xac6fac4d,0x8b4b8b8c,0xa450ac91,0x51e75a07,0x7b2b832b,0x5a266288,0x6aa872c8,0x72a96a88,0x72a949a6,0x51e76228,0x8b8d7b2b,0x7b0b7b2c,0x834c832c,0x832c938e,0x730b72aa,0x72ca72eb,0x836c834c,0x730b72ea,0x62896a89,0x6aaa6a89,0x7aeb72eb,0x6a696a69,0x51e75a08,0x624859e6,0x62486248,
-0x72ca6a89,0x728a832c,0x62286a49,0x59c76207,0x6a695a07,0x59e76a69,0x6a895a07,0x62686a89,0x7aeb72aa,0x830c832c,0x6a696a69,0x59e759c7,0x498559e7,0x59e64965,0x72887aa9,0x59e64143,0x59e66227,0x82ea6a47,0x59c572a8,0x59e56206,0x49646206,0x72a86a67,0x59e551a4,0x7b296a46,0x5a066a88,0x7ae97b0a,0x5a065a06,0x8b6b6247,0x6aa8832a,0x5a4651c5,0x49845a26,0x622751c5,0x62275a06,0x49646227,0x494430a2,0x51a559c5,0x41423902,0x83096a46,0x5a066a68,0x410359c6,0x412330c2,0x62064964,0x7b0a7288,0x7ae88b4a,0x72a86246,0x5a46834a,0x72c95205,0x5a0672c9,0x5a0651c5,0x498559e6,0x5a064985,0x6a877ae9,0x834a72a7,0x7b2a836b,0x940d7309,0x6aa87b6b,0x396449e6,0x62685206,0x30c24144,0x72e85a06,0x72c86a87,0x834a8b8b,0x838b7308,0x7b4a8bac,
-0x83ac7329,0x732a7b6b,0x624872ea,0x41254186,0x392330c3,0x72c87ae8,0x51e551c5,0x41855a47,0x29233102,0x62875a87,0x496349c4,0x72476a06,0x61a55964,0x72eb7b2b,0x6b0a732b,0x8bae732b,0x51a67b0c,0x6aaa49a6,0x5a697b0c,0x5a685228,0x942f62aa,0xa4d1a4b2,0x732b83ee,0x5a4862a9,0x418551e7,0x940f5a68,0xa512a4d1,0x94f29cf2,0xa5129d12,0x83eda4d1,0x734c8c0e,0x9c508bee,0x6b2b9450,0xa4f26b0b,0x6a8a9c91,0x394349c6,0x626741a4,0x52046266,0x6a8772c7,0x624772c9,0x51c65a06,0x6a696207,0x7aeb6aaa,0x832b72eb,0x624772c9,0x834a838b,0x5a0751e6,0x49855a07,0x834c6a8a,0x59e76a89,0x51e751c7,0x51e86228,0x72eb6269,0x834c832c,0x72eb7b0b,0x6aaa7aeb,0x5a286289,0x51e751e7,0x51c751a6,0x49a651c7,0x59c751c7,0x62285a08,0x59c751c7,0x5a086228,
-0x51a651c6,0x498549a5,0x51c651a6,0x6a4959e7,0x7b0b72aa,0x7b0b7b0c,0x832d834d,0x7b0b7b2b,0x59e7728a,0x59e851a6,0x62496a6a,0x51a64986,0x62286207,0x51a659e6,0x726859c6,0x62077289,0x726851a4,0x51646a48,0x72676206,0x61c559e6,0x6a476a67,0x62466247,0x59e55a06,0x620651a5,0x498451e5,0x5a064984,0x938c7aea,0x51e6830a,0x7ae96268,0x5a276a88,0x73096aa8,0x834a832a,0x6a886a87,0x6a286a69,0x49244965,0x49445185,0x41233902,0x62466246,0x8b4c832a,0x30e26227,0x39043924,0x49643924,0x5a074985,0x6a8772c9,0x6a875a05,0x6a866a87,0x626672c7,0x62266245,0x498451e5,0x39034143,0x6a4759e6,0x6a885a06,0x7309834a,0x62a85a26,0x7b4a83ac,0x8bad83ac,0x72ea730b,0x7b0b834b,0x41445a08,0x39224143,0x72c96247,0x49e46246,0x72e95a46,0x93ed7b6a,
-0x732a942d,0x49e649e6,0x72ea72ea,0x30c259e7,0x622730c3,0x51e46247,0x7b296286,0x5a486aa8,0x7b2a6289,0x5aa762c8,0x8bcb734a,0x59a4830a,0x718548e2,0x6aea5a49,0x6b2b734c,0x62aa62ca,0x832c7b2c,0x52085a07,0x7b6c7b6d,0x7bad6b2b,0x6b0b7bad,0x738c8c2f,0x83ae62ea,0x49c66b0a,0x7b2c5a28,0xa49193ef,0x94b1a4f2,0x95329512,0x8c0f94d1,0x6b0a736c,0x9c70736b,0x62c9736c,0x6b0a5268,0xa4929450,0x9c718c2f,0x730a9c2f,0x518549a5,0x59e66248,0x41443943,0x5a274143,0x51e66aa9,0x72a95a27,0x62686268,0x72ea6288,0x832ba42f,0x5a065a27,0x49a659e6,0x938d6268,0x5a08830c,0x5a085186,0x622972ab,0x8b6d59c8,0x51e7836d,0x62495a08,0x51c65207,0x51e749c6,0x59e85a28,0x49a66249,0x51c751c7,0x51a75186,0x496651a7,0x49664945,0x41244965,0x51864945,
-0x49654965,0x51c74986,0x49665186,0x41254986,0x414538e4,0x41454986,0x49863944,0x41654186,0x6a8a5a28,0x59e75187,0x5a086228,0x496651a6,0x62084966,0x49a56a49,0x51a551a5,0x72895a06,0x51856a47,0x726861c5,0x51a561e6,0x59a57268,0x72674963,0x72887aa9,0x6a687aa8,0x51846206,0x7ac87287,0x6a686a88,0x49855a27,0x834c59c7,0x49a66a89,0x8b8c51e6,0x5a05834a,0x7b296aa8,0x7ae96226,0x59e68b4b,0x41033903,0x51844924,0x390259e6,0x7ae93922,0x6a4782e9,0x390349a5,0x39044124,0x62084125,0x6aa97aeb,0x51a551a6,0x49835a06,0x72c751c5,0x62666286,0x6a877b09,0x41234143,0x38e351a5,0x72c951a5,0x51e66a67,0x730a6288,0x6b0a730a,0x7b8b5a88,0x730b8c0d,0x7b2b6aca,0x6a6972ea,0x49866aaa,0x51e430e1,0x52056266,0x520549e4,0x8bab62a7,0x834b8bac,
-0x520572e9,0x6ac949a5,0x62087b2b,0x30a138e2,0x392330c2,0x5a0438e2,0x6aa77b08,0x49e649e5,0x5a486a89,0x52063923,0x72e97309,0x414459e7,0x51037248,0x7b8d7b4c,0x524762ea,0x83ad732b,0x7b2c72a9,0x8bae9bef,0x9c90838d,0x62eb8c2f,0xa4f27bce,0xad13a512,0x734c83ce,0x836d940f,0x5a6949c6,0xa4d29c70,0x9cf294b1,0x8cd194d1,0x83ee9cf1,0x83cd5a88,0x8c0f9cb1,0x4a2762ca,0x6aca6aeb,0x9c926aeb,0x5a896b2c,0xad139c91,0x522893ef,0x6a8a51c7,0x414451c7,0x5a277aea,0x8b6c51e6,0x5a06834b,0x834a6a88,0x49a56aa8,0x830a5a07,0x51c672ca,0x8b6d51c7,0x62289bef,0x5a0849c6,0x5a0751c7,0x7aeb830c,0x6aaa51a7,0x51a672aa,0x832c832c,0x62686248,0x834c7b0b,0x5a4893ae,0x6a8a9bef,0x7acb8b4d,0x8b6d72aa,0x62286a49,0x5a08830c,0x5a085a08,0x6a8a7acb,
-0x8b8d6248,0x7b0b5a28,0x7acb832c,0x6a69830b,0x8b8d7aea,0x7aeb51c7,0x8bae49a6,0x39256aab,0x72ab6a6a,0x6a6a51a6,0x498651c7,0x49654965,0x59e751c6,0x41245185,0x62476207,0x59c54123,0x6a677269,0x61e659c6,0x59c57289,0x51a559e5,0x51c56a68,0x49644964,0x51a54143,0x8b2a72a9,0x7aea6226,0x7aea6a68,0x72a893ad,0x41245a06,0x72a951e6,0x310251e6,0x6a875a05,0x51e549a5,0x6a686a67,0x414359e6,0x5a064943,0x59c66a48,0x38e230e2,0x5a065a06,0x5a465a06,0x72a97aea,0x39044944,0x41253904,0x49853904,0x6a897aca,0x51e549c4,0x626649a4,0x6a866286,0x726772a8,0x6a677288,0x390338e3,0x51c64985,0x6ac951e6,0x524662c8,0x7b8c62c9,0x734983ab,0x4a065a87,0x5a476289,0x72a94185,0x49858b6d,0x30c13102,0x72e95a06,0x49c45a46,0x836b7308,0x8b8c8b8b,
-0x5a257ae9,0x72c86246,0x62077aca,0x41644985,0x412330c2,0x72a76226,0x52255a46,0x7b6b72e9,0x6aa87b4a,0x6a666a88,0x832a72c8,0x834b8b8c,0x38a25a07,0x7b6c8bcd,0x72eb6aea,0x62696aa9,0x6aca6aaa,0x942f730b,0x7bad83ce,0xa53294b0,0xa4f2a4f1,0x8c0e9cb1,0x6b0a7b4c,0x6b0b6b0b,0x8c707b8e,0x9cd18c70,0x9cd19d12,0x94d194d1,0xad13a4d1,0x9c71a4d2,0x6aeb7b6d,0x62a95248,0x7b4c628a,0x7b6d8bef,0x7b8d7b8e,0xa4f37bae,0x94709cf3,0x732c7b6d,0x62698b6d,0x834b6a69,0x5a077aea,0x93ad830a,0x6a6772c9,0x6a886a89,0x62687b0b,0x626949a5,0x9baf93ae,0x49864986,0x7aeb49c6,0x620872a9,0x5a286229,0x6a6951e7,0x59c76208,0x61c659a6,0x62676a67,0x49c651e6,0x51c649c6,0x62286248,0x62487aeb,0x832c6289,0x62696268,0x5207730b,0x628972eb,0x72cb72cb,
-0x836d6268,0x728a5a28,0x59e7728a,0x59e55a06,0x59c551c4,0x59e74164,0x49664946,0x41454966,0x51864945,0x49864946,0x6a69832c,0x51654986,0x49244965,0x6a4859a6,0x59a559c6,0x51a56a48,0x6a485185,0x6a287aea,0x6a884964,0x51a57288,0x5a076aa9,0x49644943,0x59e651a5,0x41644964,0x6a676247,0x518451c5,0x5a064984,0x72c97b0a,0x51c5832b,0x6a675a25,0x72a86a87,0x59e76a69,0x7aea5a28,0x6aa85a07,0x7b0a8b6b,0x392359e6,0x59c64964,0x41035165,0x6a4651a4,0x62476267,0x412459e6,0x41244105,0x61e74124,0x620659e6,0x6a6772a8,0x52065a06,0x62265206,0x6a6751c6,0x6a687aea,0x496451a5,0x41443923,0x72ea6a68,0x6aa76ac9,0x5a675246,0x7b6a838b,0x8beb7b8a,0x730a8bcb,0x834b72ea,0x49a5832b,0x49a54144,0x62476268,0x62466267,0x49a449a4,0x72c85a46,
-0x59e57ae8,0x41634121,0x6a696206,0x41245a28,0x30c338e4,0x624738e2,0x62a772c9,0x6aa86ac8,0x6aa65205,0x72e86a66,0x6ac7836a,0x6ac74a24,0x82e97ae9,0xac918bce,0x6aca9c2f,0x626951e6,0x6aca6aaa,0x6aea5a48,0xa4f28c0f,0x8c2fa4f2,0x83cd630a,0x942facd2,0x62aa838d,0x734c5a69,0x9c919450,0x9cf28c50,0x94b194b1,0x9cf19490,0x83ad8c4f,0x83ae9430,0x62ca6aca,0x6aaa8bae,0x62aa6289,0x7b4d62ca,0x83ef5a89,0x9cf2ad34,0x9cf294d2,0x9c919cd2,0x732b9c50,0x836c6288,0x7b0a838c,0x59e66288,0x624751c6,0x5a2772c9,0x72ea6aa9,0x8b8d6248,0x62299bef,0x62284966,0x620751a6,0x59c76a27,0x59e84966,0x72ca72ca,0x6a276a47,0x8ae982a8,0x5a467288,0x830b72a9,0x62077a89,0x59a659a5,0x49644964,0x49855165,0x51c66207,0x51a64965,0x49454985,0x51854965,
-0x49644964,0x494451a5,0x49245145,0x49a34943,0x62465205,0x49856247,0x82eb6a28,0x49856a68,0x5a274965,0x51c65a28,0x49856a8a,0x61e851c6,0x49645186,0x6a4859e6,0x61e66a27,0x61e64964,0x41446a48,0x72694944,0x6a687aca,0x5a2659e6,0x59e64985,0x624872c9,0x62474144,0x59e6832b,0x494472a9,0x7ae959e5,0x62467ae9,0x51a649a4,0x62477aea,0x62474984,0x832b936c,0x5a074964,0x59c68b4c,0x624751c5,0x72a86247,0x72a9832a,0x518659e7,0x51a53903,0x59e56a67,0x72a96246,0x390459e7,0x41254946,0x39034144,0x51e54143,0x390251a5,0x52064164,0x72a87b09,0x6a8872c8,0x51c659e6,0x30c24144,0x390330e2,0x51e64144,0x52265a26,0x7b496287,0x5a867b69,0x6ae85a86,0x836b8bac,0x62475a67,0x6aa972ca,0x416472c9,0x51e630a1,0x5a056247,0x7ae96246,0x8b8b836a,
-0x6a8772c8,0x8b6b834a,0x41446aa9,0x49874986,0x28c230c3,0x31023103,0x51e530e1,0x832a8309,0x6a877b29,0x7b096287,0x41a46266,0x836b5a46,0x8b8c93ed,0x5a695a27,0x836c5a68,0x52078b6c,0x62695a08,0x7b4c7b4c,0x83ce734c,0x9cf19490,0x9490a512,0x6aca8bee,0x6aca5a68,0x732c732c,0x9c9183cd,0x9cb19470,0x9cb09cb1,0x946f944f,0x6aeb83ee,0x62aa5aa9,0x7b2c6aca,0x730c7b2c,0x6aca6269,0x62aa734c,0x83ee734c,0x9cd29cf2,0x9cf29d13,0xa4f29cf2,0x8c2f9cd1,0x944e6b4b,0x62888bed,0x72c95a48,0x6a886aa9,0x72a95a07,0x51e67aeb,0x8b4c49a5,0x4966832c,0x59a759c8,0x59a661c7,0x6a6961e7,0x51c76249,0x5a0651a6,0x9b8a6a46,0x93499b6a,0x5a4672a7,0xa40e832a,0x830b9bad,0x62277268,0x8b4c938d,0x6a687269,0x62275a06,0x622772c9,0x6a2751a5,0x6a076a48,
-0x51c56227,0x7a696226,0x69e68289,0x7ae961c5,0x8bab8bcb,0x72a7834a,0x9b6a7287,0x8b4aac0d,0x498559c5,0x498551c6,0x62284165,0x496559e7,0x6a2859c6,0x518561e7,0x72a96227,0x59e65185,0x622751a5,0x494559e6,0x832c7aaa,0x6a6951c6,0x49856a69,0x72a96a49,0x49864965,0x938d72aa,0x6a686248,0x51e64965,0x6a8872c9,0x62076227,0x832a4144,0x7ae9832a,0x5a2672c8,0x6a6851c5,0x5a0751c6,0x62464964,0x72c9832a,0x51c65a06,0x39034985,0x49645185,0x626749a4,0x5a266247,0x5a086a89,0x41254125,0x412438e3,0x41234102,0x5a0651a5,0x51c551e5,0x5a2649a5,0x5a065a06,0x72c972a9,0x51a659c6,0x39034144,0x6aa951a6,0x8b8b834b,0x72e8836a,0x6b087329,0x836a7b4a,0x72e97b49,0x6aa872c9,0x39646227,0x394430e3,0x49a53923,0x52065a27,0x6ac85205,0x730a8bac,
-0x49c45226,0x72e96287,0x72ea62a8,0x41457aec,0x30a328a2,0x30e230a1,0x41424143,0x6a874963,0x62687ae9,0x5a675a26,0x7b2b6ac9,0x5a487b2b,0x6ac949e6,0x730b72ea,0x5a286aca,0x62695a07,0x836d72ca,0x8bce730b,0x732b9450,0xa4d1738c,0xa4b1ad12,0x734b83cd,0x734c730b,0x8bee7b6d,0x9c91a4b2,0x7b8d736c,0x8bee9c91,0x62895a89,0x6aea6aeb,0x6289732c,0x7b2c730b,0x62895248,0x62696aeb,0x734c5269,0xa4f3942f,0x9cf2a4f2,0x9cf29cf2,0x94f194d1,0x9d1294f1,0xa4f19cd1,0x734b8c2e,0x7b4b7b6b,0x6aa96a89,0x51e672ca,0x6a487aca,0x59e759e7,0x51a751a6,0x59665187,0x61866186,0x61e74944,0x6a8972cb,0x51c54984,0x936882e7,0xac8d9b89,0x5a678b8a,0xbd118bad,0x8bcdacf0,0x8b6b5205,0xac90b4b0,0x7b0a9bed,0xa46f6ac9,0x940db4f0,0x9c0e5a67,0x93acb46f,
-0x6267832a,0xabed9bcc,0x82e9abcd,0x7b2a59c5,0x942ea46e,0x83097b4a,0x93288b29,0xabcb9348,0x59a5932a,0x41444965,0x8b6d6a69,0x516559e7,0x6a2740e3,0x6a48932c,0x49444123,0x7ac96206,0x51c66a48,0x6a687289,0x72894985,0x41646248,0x7aeb51a6,0x5a07830b,0x51a638e3,0x6228830c,0x31034144,0x7aea4984,0x49a57aea,0x498551a5,0x5a0672ca,0x62464984,0x49c451e5,0x62676267,0x51c56247,0x72c872c9,0x83096267,0x51a57b0a,0x41243903,0x414451a5,0x72e96a68,0x72c972a8,0x620872aa,0x41045187,0x41244124,0x62064984,0x59e56205,0x7ae96267,0x72c96a88,0x6a8772c9,0x6a686a89,0x496551a5,0x38e330e2,0x62074124,0x6aa97b0a,0x7b295206,0x8bab8bac,0x49a36267,0x834a62a7,0x62687b09,0x5a076248,0x6a8959e6,0x18204144,0x62683123,0x8bab836b,0x5a477b4a,
-0x73295227,0x6ac97b4b,0x62896288,0x41456249,0x28a22082,0x30e228a2,0x390238e2,0x51a44984,0x8b6c6a68,0x52065206,0x62c9730a,0x5a6941c6,0x52076289,0x62696aea,0x6a8951e7,0x520772ca,0x7b0c5a07,0x6aca6289,0xa4f28bce,0x9cd1acf2,0xacf29cd1,0x94509cb1,0x7b8c7b8c,0xa4b19450,0x83ad942f,0x6aea7b6c,0x9c506b0b,0x62a98bce,0x6b0b62aa,0x732c6aea,0x5a8862a9,0x7bad730b,0x732c730b,0x7bad83ad,0x9cd1a512,0x9d129491,0x94f29cf2,0x95129d32,0x94d194f1,0xa5129d11,0x9c909cb0,0x7b4c8bee,0x6aa9834c,0x62484144,0x49866a49,0x62286a48,0x51a64966,0x618759c7,0x596669a7,0x59c769c7,0x51c651c7,0x6a6651a5,0x8b688b48,0xbceeac6c,0x7b2aa46e,0x93ed6ac9,0x6aa8a44f,0x834b49a5,0xa40f93ad,0x6247938d,0x93cd72a9,0x834b7b4c,0x832b6247,0x9bcd9c0e,
-0x62877b0a,0xa3ee93cc,0x82caabee,0x6ac94944,0xa4b0acd0,0x6288734b,0xb4aea44e,0x936a93ab,0x728a938c,0x49864124,0x49454986,0x6a284985,0x518559c7,0x59e65986,0x728982ea,0x59c64964,0x622772a9,0x59c651a6,0x51c64985,0x49a64144,0x72ca7aeb,0x622751e7,0x6a89728a,0x4986830c,0x41443903,0x8b6c8b6c,0x496451a5,0x39235185,0x622751c6,0x5a056247,0x72877aa8,0x7ac949a4,0x51c5830a,0x5a0551a5,0x62267ac8,0x5a274144,0x38e36207,0x412438e3,0x49854984,0x624851e6,0x6a496a69,0x49466229,0x49044104,0x49434124,0x728859e5,0x5a0672a8,0x62266246,0x6a885a26,0x59e56a88,0x51854964,0x39245185,0x392330e3,0x7b2b5a27,0x62887b2a,0x7b2a72e9,0x72e96aa8,0x622672c8,0x5a4651e5,0x59e66a67,0x41444985,0x28a23103,0x836b5a27,0x52067b2a,0x6ae95206,
-0x838c83ac,0x41c56287,0x72eb5a48,0x3124624a,0x830c4146,0x412472aa,0x30c128a1,0x51a530e2,0x626872a9,0x7b2b6aa9,0x62a962a8,0x5206732a,0x39243944,0x730b6aca,0x72ca8b6d,0x51e751c6,0x72eb6248,0x6aeb93ee,0x732b732b,0x946f736c,0x9cd1a4f2,0xa4f29cd1,0xa4d19c90,0x9c919cb1,0x94309c90,0x6b2c9430,0x62a962ca,0x9c30942f,0x6aca72ea,0x62a9736c,0x734c732b,0x9c9183ae,0x9cb1a4d2,0xa4f2a4d2,0x9cf294b1,0x9cf29d12,0x94d29d12,0x9d1294f2,0x9d1294d1,0x9cd294d1,0xa4919cb1,0x7b4c9c50,0x62485a27,0x51e76a89,0x59e751a6,0x498651a6,0x59c65186,0x598661e8,0x61a76187,0x7aaa7a8b,0x59c66227,0x72866206,0xac8d8369,0xaccfb52f,0x9c0ebd11,0x7a686a48,0x69e65164,0x59447a47,0x8a8971e6,0x72077a48,0x72077a48,0x61a582a9,0x720761a5,0x71e67a27,
-0x69c469a4,0x722769a4,0x69845964,0x69c57a27,0x59c55164,0x83ad5a47,0xb530ad11,0x93ab9c4d,0x8b4c9bed,0x51c64985,0x51a65186,0x49455165,0x6a075186,0x51856207,0x51a551a5,0x622772a9,0x72894964,0x518572a9,0x832b72a9,0x7b0b3924,0x49a67acb,0x51e751e6,0x72ca51c6,0x392472aa,0x6a483903,0x7289938c,0x59c63923,0x51a66a48,0x62277aca,0x7ae96226,0x41426a66,0x9bed72a8,0x49646226,0x72a86247,0x6a6772e8,0x726961e7,0x41446228,0x39033103,0x39434144,0x624851a5,0x8b4d830b,0x410451a7,0x410440e4,0x38e240e3,0x728851a4,0x62666206,0x59e55205,0x72e96267,0x5a066aa8,0x830b6a48,0x28a25185,0x51c628a2,0x5a076a47,0x628859e6,0x7b0a7b09,0x5a066a67,0x6a876a87,0x624651e5,0x93ad938c,0x62276248,0x49a66248,0x49e53943,0x7b4b6288,0x73098bac,
-0x732a6ac9,0x7b2a7b6b,0x51e66288,0x51e85a08,0x51c751a7,0x30e23944,0x30a230e3,0x496538e3,0x72c94965,0x5a278b4b,0x41843964,0x31023123,0x7aeb5a27,0x7b2c730b,0x7b0c72eb,0x7aeb834d,0x628972aa,0x940f6248,0x8c2fa4d1,0x7bcd6b4b,0x9cf1a4f1,0xa4f2a4f1,0x9490948f,0xa4f1a4f1,0x6b2a8bee,0x732b83ad,0x730b5a68,0x732b72ea,0x62aa730b,0x9c907bcd,0x9c918c2f,0x9cb19cb1,0x9cd19cd1,0x9cd19cd1,0x9cf29cf2,0x94f29cf1,0x9cf29cf2,0x9cd29cf2,0xa4d29cb1,0x9c709c91,0x7b2c8bce,0x7b0b6aaa,0x5a07836c,0x72aa51c6,0x5a2751c6,0x6a49728a,0x51a659e7,0x51865165,0x61c95987,0x6a486229,0x51c55a07,0x83296a67,0xad109c6e,0xad11a4d0,0x7aeaac90,0x822769a5,0x60e26922,0x81847984,0x71237123,0x68e27124,0x79636922,0x71227142,0x71027102,0x68e17102,
-0x70e168c1,0x81637922,0x68e268e2,0x68c17902,0x79e568e1,0x6aa87267,0x9cd0a4d0,0xa42dacd0,0x93ab93cb,0x49446aa8,0x59c751a6,0x51865145,0x51655165,0x620761c6,0x51a56228,0x832b6248,0x62276207,0x51c67269,0x6aa951a6,0x7aea93cd,0x416549a5,0x62486248,0x8b4c7289,0x41444985,0x830b51a5,0x49436247,0x62275a06,0x7acb59c6,0x51c572ca,0x5a055a26,0x72a85a05,0x51a46a88,0x51c582ea,0x6a674983,0x6a677ae9,0x72896227,0x59e659c7,0x62274944,0x51e66a48,0x72885206,0x6a276a88,0x494551e6,0x41044105,0x410338e3,0x51c45164,0x834a5a06,0x51e45a46,0x72c86a87,0x6a6772a9,0x498449a4,0x41255a07,0x392438e2,0x7aca5a07,0x6a88832b,0x59e651e6,0x39424123,0x6a886267,0x51e55a06,0x8b8c6a87,0x49666268,0x30e33924,0x5a274165,0x62a85a67,0x51e56ac9,
-0x732a5206,0x628872e9,0x5a486288,0x39256249,0x30e428c3,0x49454165,0x30c238e2,0x28a230e3,0x49c528c2,0x5a0749c5,0x412451c6,0x51e630e2,0x39447b2b,0x51e75a48,0x834c834c,0x6aaa5a28,0x72eb93ae,0x41a54185,0x94505a88,0x9cd1ad12,0x94d0a4f2,0x94f19490,0x9d11a532,0x9cf19cf1,0xa4d1a4f1,0x6aca8c0f,0x836c8bad,0x93ef7b2c,0x9c91a491,0x9cb19c90,0x9cd19cd1,0x9cf19cd1,0x94b09cf2,0x8c6f8c90,0xa53294b1,0x9cf29d12,0x94b194b1,0x52487bce,0x7b6d62ea,0x5a485a69,0x49c65a48,0x728a6a69,0x8b4d6a8a,0x41455a08,0x59c759c7,0x51c659e7,0x51655185,0x496759c6,0x728c4987,0x51a66a4a,0x51a45185,0x93cc7287,0xad12acd0,0xacd1ad33,0x61e6834c,0x61235944,0x61237184,0x9a8881e6,0x60c179a5,0x9a8881e6,0x79c579a5,0x8a06b34b,0x9a887184,0x71238a27,
-0x79238184,0x81a568e3,0x71037164,0x70e27924,0x692360a1,0x626769e6,0x9cf27b8d,0xa48fad12,0x83ac8c0d,0x5185730a,0x51865186,0x51454945,0x59a65186,0x51a55186,0x7aca7289,0x51e64144,0x51a659e7,0x51854144,0xa42f832c,0x51e66a89,0x6288832b,0x6a8949a5,0x6247832b,0x51c530e2,0x7aca6a48,0x496459e6,0x49854144,0x62486a68,0x496451a6,0x5a0659e5,0x62255a05,0x51a56206,0x51c559c6,0x59e551a4,0x7aa951c5,0x49847aea,0x41244945,0x496530e3,0x30e23903,0x5a274144,0x6a687b0a,0x8b0c72a9,0x410459a6,0x38c24124,0x496430c1,0x49c46a47,0x73095a05,0x51c56a88,0x6aa85a06,0x6227830a,0x30c24965,0x390430e3,0x624849a6,0x5a476a88,0x39034985,0x7ac959e6,0x72c88b4b,0x72c85a05,0x8b4b8b8c,0x72aa5a27,0x39246a69,0x520728c2,0x6aa872ca,0x7309730a,
-0x5a2649c5,0x72e9834b,0x520751e6,0x30e36269,0x51e73924,0x832c6a8a,0x49867b0b,0x30c42082,0x28c228a3,0x49864165,0x288138e2,0x412438e3,0x51a57289,0x8bad9c0f,0x72eb62a9,0x6a89834c,0x7aeb6269,0x93ee7b2c,0x62ea940e,0x9c906b4b,0xa4f1a4f2,0x94d19cd1,0x9cf194b0,0x9cf19cf1,0x9c90a4f2,0x7b4c8bee,0x83ad6269,0x51e76aaa,0x9c917b4c,0xa4d1a4d1,0x9cd19cd1,0x9cf19cd1,0x94f194d2,0x7bee94d1,0x630a630b,0x94b17c0e,0xad129cd1,0x9c70ad13,0x4a077b6c,0x49a64985,0x49a651c7,0x7acb49a6,0x51e7832c,0x726a7acb,0x7acb4986,0x51856a8a,0x51655165,0x49665165,0x5a096229,0x51c751c7,0x5a0651a5,0xb4d18b6c,0xa4d2a4b1,0x8baeacd2,0x51446207,0x79e66985,0x696471c5,0x69656124,0x69646964,0x820781e6,0x71a571a5,0x718479e6,0x82476944,0x81c68207,
-0x81859a88,0xa2a96902,0x58c28a27,0x79646903,0x58c27102,0x49455924,0x8bef5207,0xa4d2a4d2,0x9c90a4b1,0x51c78b6d,0x59865165,0x49455166,0x61c75186,0x516559a7,0x59e75186,0x51e659e7,0x51a64965,0x7aca7289,0x6a685a07,0x62676a48,0x6a678b8c,0x7b0a6268,0x49a55a27,0x59e67289,0x51c6832b,0x51854964,0x51c64985,0x498559e6,0x51a55185,0x6a876205,0x7ae98b4a,0x6a4751a5,0x51c57288,0x51c56a47,0x62264984,0x51c66247,0x41237268,0x41243904,0x41444985,0x832b6a88,0x6a676a67,0x7aa972a9,0x38e459c7,0x38e338c4,0x49443903,0x5a054143,0x5a267b2a,0x6aa86aa8,0x6a886266,0x51e66227,0x416551c6,0x30c230c2,0x6a8851c6,0x41846248,0x39023123,0x418430e2,0x51c551e6,0x6a875a25,0x498551e5,0x51c651a6,0x28a23944,0x49a63924,0x51e649c5,0x51e649e5,
-0x49e549a4,0x732a72c9,0x7b0a7b2a,0x414551c6,0x416651e8,0x49a64165,0x41454986,0x30c430e3,0x30c330a4,0x20612882,0x7a896208,0x30a24946,0x72695185,0x62895a48,0x7b0b7b2c,0x59e75a48,0x6aaa6a89,0x72eb5a68,0x9c709c70,0x7b6c7b8c,0x9c908c0e,0x9cf1a4d1,0x94d09d11,0x9cd19cd0,0xa4b1a4f1,0x730b8bee,0x832d836c,0x51e76269,0x8bcd6289,0xa4f2a4d1,0xa4f1a4f1,0x9cd19cd1,0x9d129cf1,0x9cd19d12,0x840e9490,0x52686b4c,0x7bad5aa9,0xb512acd1,0x6aa993ef,0x6aa96ac9,0x498649a6,0x51a751c7,0x62296208,0x59e74945,0x62297269,0x518651c7,0x61e751a6,0x49a661c7,0x6a8a72cb,0x59e751c7,0x5a0759c6,0xb4d18bcd,0xacd2acd1,0x72a99c10,0x7a487a68,0x79e66184,0x612471a5,0xab0b79e6,0x61038207,0x79e66965,0x698479e6,0x9aea8a68,0x822771a5,0x71859268,
-0x71846944,0x58e350c1,0x92488a68,0x58a16964,0x60c260e1,0x69456904,0x72696185,0xacf1ac90,0xacd2acd2,0x51a68b8e,0x51854945,0x51455166,0x49454944,0x49655165,0x51855166,0x5a075a28,0x62285a07,0x6228726a,0x72c951c5,0x51a56a88,0x72a951c5,0x8bac9bee,0x6a886268,0x72a95a27,0x51a66227,0x49a63903,0x5a076a69,0x6a684985,0x62475185,0x51e55a06,0x496451a5,0x620749a5,0x59e66227,0x5a2651c5,0x51a551a4,0x72897289,0x6a494964,0x30e33903,0x39034144,0x6a874143,0x5a257b09,0x5a076225,0x41045185,0x40e338e4,0x38e230c2,0x6aa851a5,0x6aa851e5,0x49c56287,0x7ae96a87,0x72a959e6,0x41646a88,0x30e330e2,0x624849a6,0x5a065a07,0x62485a07,0x5a066248,0x39223902,0x7b096a87,0x8b6b6aa7,0x62487b0a,0x310349a6,0x41442061,0x6aa86247,0x49c66267,
-0x6ac95a68,0x520662a8,0x6aa95226,0x49e67b0b,0x28a228e3,0x6a8949a6,0x5a2872cb,0x28a328a3,0x30c430a3,0x30c230c3,0x622851c6,0x30c34945,0x6a284124,0x7b2c8b8d,0x72ea62a9,0x6289832c,0x626949a6,0x93ee6268,0x6b2b8bee,0x9c4f942f,0x8c0e734c,0xa511a4f1,0xa512a511,0x9cb09cf1,0xa4b1a4f2,0x7aeb836c,0x6a8a7aeb,0x51c651c6,0x6aea5228,0xacf1942f,0x94909cb1,0xa512a4f1,0x94d19cf1,0x94b094b0,0xa4f2a4d1,0xa490acd2,0x5a6883ad,0x7b4c5228,0x732b940f,0x626949c6,0x6a898b6d,0x41444145,0x7acb6208,0x516551a6,0x59c759e8,0x51a651a6,0x59c751a6,0x51c76a29,0x51c651c7,0x51854965,0x7b2b6a48,0xa4918bee,0xa470a4d2,0x49236228,0x61c561c6,0x69a45944,0x71c57a06,0x71845923,0x61646964,0x822671a5,0x61847a27,0x7a275964,0x616469a5,0x820779e6,
-0x79e569a4,0x71648a47,0x71647144,0x69436963,0x60a26102,0x60a268a2,0x49226102,0x9cae6aa7,0xa491ad32,0x49657b4d,0x51654944,0x51665186,0x51465145,0x49465186,0x51c65186,0x7aca4165,0x59e7830c,0x6a2851c7,0x59e65186,0x414459e6,0x8b6c6aa9,0x6a897b0a,0x49856268,0x6a695186,0x30c24164,0x832c51c7,0x5a077aeb,0x41446268,0x6a677288,0x496451c4,0x51c549a5,0x498551a5,0x8b4c59e7,0x41646247,0x51a44143,0x59e75a06,0x62086a69,0x51a64985,0x41644985,0x8b8b72e9,0x72c76aa7,0x82e97ac8,0x51866a48,0x38c44904,0x390338e4,0x62683923,0x72c872c9,0x628762a7,0x5a265a46,0x6a886267,0x414459e6,0x39033924,0x51e64144,0x6aa96a67,0x49a56ac9,0x39243924,0x7b4a5a47,0x72e88b6a,0x72c972c9,0x5a076a88,0x39244165,0x30c330c3,0x49a53923,0x62895a47,
-0x732b7b4c,0x6ae96aea,0x838c7b4b,0x416572ca,0x28c228a2,0x6a8949a5,0x41446a68,0x30c228c2,0x28a228a3,0x49443902,0x49654124,0x41035985,0x59c64123,0x52285228,0x7b0b72eb,0x6aaa6269,0x6aea730b,0x838d838c,0x83ee942f,0xa4b18c0e,0x9cb1a4d2,0xa511a4f2,0x9cd194f1,0xa4f19cb1,0x8bada4b1,0x6aaa6aca,0x7aeb5a28,0x628972aa,0x6aea6aca,0x9470736b,0x9cd1a4f1,0x9cf19cb1,0x9d129d12,0x9d129cf2,0x9cb19cf2,0xa4f29cb1,0xa4d1acf2,0x62898bee,0x626941a6,0x41a672eb,0x8b6d6249,0x6a69936d,0x51c74124,0x7aeb936e,0x518659e7,0x51654965,0x59a759c7,0x59c85986,0x51c759c7,0x496551a6,0x830b7a89,0x93ad72a9,0x62278b8d,0x616469e6,0x8a688248,0x61436144,0x698469a4,0x7a0658e2,0x71c58247,0x69856164,0x59446165,0x8a685944,0x61648247,0x61645923,
-0x71c55943,0x79a5a2c9,0x610260e3,0x61236943,0x79446923,0x79237103,0x59226923,0x72c75162,0x9c2ea44d,0x49645208,0x49245165,0x51664925,0x49254924,0x6a695a07,0x62084986,0x620872ca,0x51c74145,0x498559e6,0x6a696a69,0x6aa93903,0x6248938d,0x51c64185,0x5a285a07,0x30e34985,0x7aea4985,0x72aa938d,0x49654986,0x6a894165,0x4164834d,0x624751c6,0x41645a06,0x830b59e7,0x51c65a07,0x41434164,0x7ac96206,0x49857aa9,0x49654144,0x49856a48,0x59e74145,0x5a266a89,0x72c851e5,0x7ae96225,0x49657aa9,0x41253904,0x38e238e3,0x39233923,0x51c54184,0x6aa862a8,0x72e97ae9,0x628851e5,0x498572a9,0x28a230e3,0x51c63103,0x6aa96268,0x5a485206,0x51e65207,0x51e549a5,0x49a45206,0x624749c5,0x72ca6268,0x41456a8a,0x39232061,0x520549a5,0x72ea6aa8,
-0x6b0a62a9,0x5a686b0a,0x49c65207,0x30e44185,0x28c220a2,0x62283924,0x49c66a8a,0x312430e3,0x20a120a2,0x51a63944,0x38e34124,0x7aa96207,0x30e25a27,0x8bce6aeb,0x62697b0c,0x52286248,0x7b6c6289,0x83ee62ea,0x8c0e9c90,0x945083ee,0xa511a4f2,0x9cd19cf1,0xad12a4f2,0xacf2acd1,0x838da491,0x6aa96aca,0x49865208,0x6aa95227,0x83ce7b6c,0x7bcd738c,0x9cf1a4d1,0x9cf29cd1,0x94d19cd1,0x9cf29cf1,0x8c9094d1,0xa5339cd2,0x7bad9cd1,0x8bef736d,0x5a69838d,0x49a65208,0x39444165,0x8bae6248,0x62498b6d,0x6a896a89,0x51c75a08,0x51a649a6,0x59a859c7,0x518751a7,0x59c751a6,0x69e659a6,0x616469c6,0x69846143,0x69c569c5,0x614371a5,0x79c671a5,0x61026924,0x81e679a5,0x698458e2,0x69648206,0x71a558c2,0x61447a27,0x79c66924,0x69648206,0x71e66185,
-0x59037185,0x81e66943,0x60c26943,0x79847984,0x60c16902,0x60e260c1,0x58e26102,0x59225902,0x59635142,0x59c661a4,0x51655165,0x51655165,0x49654945,0x51a64945,0x72aa8b2c,0x62485a07,0x72cb4985,0x62487b2c,0x626972ea,0x7b2b730b,0x62895a48,0x6aea6289,0x51e67b2b,0x72ea59e7,0x7aeb93ce,0x62485a07,0x51c66227,0x72eb6a8a,0x416549a6,0x49a65207,0x62284985,0x72a96a89,0x620651e5,0x6a274964,0x410359c5,0x41234102,0x41445185,0x6a294985,0x51c74986,0x414451e7,0x5a4651a5,0x6aa86a88,0x726959e6,0x40e36207,0x410440e4,0x5a073903,0x5a676aa8,0x6aa85205,0x6288730a,0x5a076268,0x5a085a07,0x30a24145,0x41853903,0x72ea6247,0x20c26268,0x416520a2,0x7b4b5a48,0x6aa8838b,0x51e75206,0x5a296228,0x28a23924,0x310328c3,0x7b095206,0x49c56287,
-0x5a875246,0x7b4b5266,0x5a288bce,0x28a330c4,0x290328c2,0x6a8a5a08,0x28e351c7,0x28e33924,0x28e220c2,0x5a0728c1,0x49456208,0x51c64945,0x832a7aea,0x62a9730b,0x8b4c72ca,0x834c8b8d,0x52486aaa,0x9c9083cd,0xa4b1a4b1,0xa4f2a4d2,0x9cd1a4d2,0x9cd19cf1,0xa4f2a4d1,0x9cb1a4d1,0x836ca470,0x72eb5a69,0x834c730b,0x940f838d,0x9c909450,0xa4d1a4f2,0x9cd1a512,0x9cf29cd1,0x94b09cf1,0xa5539cf2,0x9cd19cf2,0x9cb19cd1,0xa5129cf2,0x62aa8c0f,0x7b0b6aca,0x6249834d,0x41854145,0x49a649c6,0x9c3072cb,0x49868b4d,0x51a73903,0x62496a49,0x49455186,0x51654965,0x51a55164,0x69a561a5,0x69036944,0x71227123,0x69846943,0x71648206,0x9a4881c7,0x69037985,0x690268e2,0x61036903,0x79a579e6,0x79c668e2,0x612392a9,0x69446103,0x592379e6,0x79e66144,
-0x696479c6,0x79846943,0x59026943,0x69446964,0x60e360e3,0x68e260c2,0x60e260c2,0x60c26902,0x58e260e3,0x512450e2,0x49454945,0x41244924,0x49654925,0x8b2d6a69,0x51a6728a,0x51a651c7,0x520751c6,0x49c65a28,0x6aa941a6,0x41856269,0x6ac96aca,0x8bce7b2b,0x6aa9836d,0x72ea51e6,0x62685a27,0x6a887b0b,0x7b0b6248,0x41856a89,0x498649a6,0x6a89834c,0x6a6851c6,0x5a076227,0x49857268,0x518559c5,0x51a559e6,0x724851c5,0x496459a5,0x49854123,0x30c44145,0x62694145,0x6a887b0a,0x72c8832a,0x59c66227,0x496559c6,0x38e338a3,0x59e65165,0x62a86267,0x51e55a26,0x72c95206,0x5a068b8c,0x414451a6,0x30e23904,0x390330e2,0x52274985,0x394551c6,0x28e33104,0x6aa84185,0x520572e9,0x6ac95226,0x51e77b0b,0x31043104,0x30e230e3,0x49e54144,0x72a86246,
-0x41855206,0x72eb5a48,0x49656a68,0x30a330c3,0x31643104,0x52074185,0x30a24185,0x28a130c2,0x30c128a1,0x41643903,0x7aeb5a07,0x6a89832c,0x72c951c6,0x838d62ea,0x62897b4c,0x6aaa6289,0x7b6c6aca,0x83ce8bee,0x8c2f730b,0xa4d1acf2,0xa4f19cd1,0x9cf1a512,0xa512a512,0x9470a4b1,0x62c983ad,0x8bee732b,0x62a9734b,0xacd2838d,0x62e98c0f,0xa5128c2e,0x9cd19cb1,0x9cd19cf1,0x9cf29cb1,0x62ea8c70,0x83ce6b4b,0x8c2f8c2f,0x6b0b6b4b,0xa491944f,0x5a48834d,0x6a8a49a6,0x51a66aa9,0x6aaa6228,0x62286228,0x93ae834d,0x49667acb,0x62294965,0x5a076a69,0x516551a5,0x59655165,0x69646185,0x68c36903,0x79447103,0x71437123,0x61027963,0x714460e2,0x60e26903,0x71246103,0x61036903,0x69446944,0x58e360e2,0x61446964,0x89e660e2,0x61438a47,0x71a46123,
-0x60e26944,0x81c660c2,0x59237185,0x61646143,0x48e25123,0x61a56144,0x59246165,0x61456145,0x61455904,0x494459a6,0x51654965,0x61c75185,0x82eb59a7,0x59e7936e,0x62284966,0x51a761e7,0x5a086a89,0x62284145,0x49a66a8a,0x62696249,0x8bee834c,0x942f9c50,0x942f83ad,0x49c68bee,0x8b8d5a48,0x6aa96ac9,0x4a06732b,0x5a483944,0x39246aaa,0x62073944,0x59e76248,0x7aea6268,0x49854985,0x830a7aea,0x62276a47,0x39025a06,0x51e64964,0x412559e6,0x30e44145,0x7b0b6a4a,0x5a0649c5,0x62267b29,0x8b2c5a06,0x61c78b2c,0x38c338c3,0x51a44103,0x49a56a87,0x72e95a47,0x72c9730a,0x6a896a88,0x5a086a89,0x30c24145,0x51c63924,0x49a549c5,0x6a6a72cb,0x38e33104,0x49c549a6,0x62465206,0x730a6287,0x72ca732a,0x41455207,0x288230e3,0x390328c2,0x62274164,
-0x6a6a6a68,0x41865a08,0x28823903,0x28a22881,0x20c228a2,0x41643964,0x40c238e2,0x69e65144,0x41235985,0x5a487aea,0x51e63964,0x72ea6269,0x7b2c834c,0x734b8c0f,0x940f7b4c,0x5a07834c,0x62896a89,0x9c307b4c,0x8befacb1,0x946f83cd,0xa4f2a4d1,0x9cd1a4f2,0x9cf1a4f2,0x6b0a946f,0x83ce62c9,0x9c4f734c,0xa4f2acd2,0xa4d2a4d2,0xa4b19cd2,0xa4f2a4f2,0x9cd19cb1,0x9cf19cf1,0x9cd19cb1,0xa4f19cf1,0x8c2f94b1,0x6b2b7bce,0x52684a48,0x5a4862aa,0x6aca5207,0x51e65207,0x7aeb7b2c,0x624972aa,0x41444985,0x49c749a6,0x832c72eb,0x51a772ab,0x5a074125,0x61c772aa,0x59654924,0x694469c6,0x79457104,0x71037924,0x61436122,0x508158e2,0x61445903,0x61045924,0x69446124,0x50e26124,0x69856144,0x59036124,0x71857185,0x71446124,0x61026103,0x61236123,
-0x71246944,0x69446903,0x59446144,0x6a065144,0x6a477aea,0x93ad51e6,0x9befa450,0x9c0ea430,0x9bcf9c2f,0x7acb7acb,0x4986938e,0x498559e7,0x624951e7,0x496659e7,0x41456209,0x51c659e7,0x51c73924,0x6a4972aa,0x72ea5a07,0x9c0f7b0b,0x6aea7b6c,0x4a075a69,0x72eb6aa9,0x72ea732b,0x6aea8bad,0x730b5227,0x49e66aa9,0x49a66aea,0x7acb6a89,0x5a086228,0x5a076248,0x51a559e7,0x72a94144,0x5a478b6c,0x51a44143,0x59e65a06,0x62474163,0x59c66a89,0x6a486228,0x416451c7,0x49a44144,0x5a256267,0x72696227,0x38c351a6,0x38c44104,0x59e64124,0x6a6772e9,0x626749a4,0x6aa87b0a,0x41645a27,0x49854144,0x394451a6,0x30c230c2,0x41443924,0x49464985,0x390530c4,0x41854165,0x62665a26,0x416349e4,0x72ea5206,0x41656a89,0x28c230c3,0x390430e3,0x41654985,
-0x49e75a06,0x31043965,0x30c33103,0x286130a2,0x38e22881,0x69a54103,0x71847a06,0x8a6879c5,0x49236164,0x49a55a27,0x7b2b5a27,0x5a696aca,0x6acb7b4d,0x6b0a7b6c,0x41a55227,0x9c507b4c,0x7b2c7b2c,0x6aca72eb,0x7b8c736c,0xa4f1942f,0xa4f1a512,0xa512a512,0x9cf1a511,0xa4f19cd1,0xa4b1a4d1,0x6ae99c70,0x83ce4a07,0xacf2a4b1,0x942f9cb1,0x94708c0e,0xad32a4f2,0x9490ad32,0x62ea73ac,0x6b0a62ea,0x83ce734b,0xa4b18c4f,0x8befacf2,0x524762a9,0x416441a5,0x6a6951c6,0x5a086a69,0x72eb5a28,0x62697b4c,0x59a74165,0x496651a7,0x832c7acc,0x49c76249,0x49a64185,0x6a286a69,0x596651a6,0x61456165,0x59655924,0x832a59e5,0x93cd6aa8,0x6a897b4b,0x72687aca,0x72077228,0x6a075985,0x69c761e7,0x61656986,0x61446985,0x796558e3,0x692389e7,0x714458e2,
-0x61247165,0x59245904,0x724769e6,0x9c0e6247,0x5a889c0e,0xb5127b8c,0x9c709c91,0x6aca93ee,0x9c51838d,0x834c7b4c,0x8b8e93cf,0x5a488b6e,0x5a084166,0x41455a07,0x59e85a08,0x41653904,0x936d728a,0x412472aa,0x834c6a89,0x4a075a28,0x6aea49e7,0x5a485268,0x9c308bee,0x93ee83ad,0x8b8e7b2b,0x49e66aea,0x7b4c5a68,0x834c8bce,0x62485a07,0x72ca8b4c,0x5a075a27,0x59e651c5,0x7b2a6aa9,0x51a551c5,0x59e64984,0x6a277288,0x7ae96a67,0x41444985,0x6a4859e6,0x7aeb7289,0x6207832c,0x728851a5,0x51a56227,0x49445185,0x38e440e4,0x51a538c3,0x624751e6,0x6aa87b09,0x5a065226,0x6a895a07,0x30c33923,0x30c330c3,0x390330c2,0x51a64164,0x6a297289,0x28a34126,0x310330e3,0x52263964,0x7b0a7b09,0x62487b2b,0x416551c7,0x30c228a2,0x30c230c3,0x51855165,
-0x520759e7,0x18613924,0x30a328a2,0x592440c2,0x61856165,0x82279aea,0x712360e2,0x59237122,0x41235985,0x59e64164,0x7b6c6a88,0x526883ad,0x394641e7,0x9450a4b1,0x93ef8bce,0x52077b4c,0x628962a9,0x7b6c5a89,0x6b4b944f,0xa4f2738d,0x9cd1ad32,0x9cf1a4f1,0xa4f1a511,0xacf19cd1,0x83cda4f1,0x7b8c5a89,0x947083cd,0xa4d2a4d2,0x8c2f9cd1,0x736c7b8c,0x5ac962c9,0x83ee736b,0x83ee8c0f,0x8bee83ee,0x732c7b8d,0x52686aca,0x7b8d5a69,0xacb1a491,0x730b9c2f,0x5a075a27,0x5a285a27,0x41a65a07,0x93cf6269,0x72ab8b6e,0x59c76228,0x49864125,0x72cb6a89,0x6a8b72ec,0x49a651c7,0x728a6a8a,0x82cb7aab,0xac708b2b,0xa4d19c2f,0xad12acf2,0xa4d2a4f2,0xa471a4d2,0x9c2fac91,0xa450832b,0x59c67b2b,0x516551a6,0x618559a6,0x71655104,0x696571a5,0x61246923,
-0x6a086164,0x61e77aaa,0x93ee8b8c,0x8c0eacb1,0xa4d27b8d,0x630a9c90,0xa4d2734b,0x732b736c,0x7b6c940f,0x83ce5aa9,0x5a48730b,0x6aca7b2c,0x49a649c6,0x51e751e7,0x59e851e7,0x832c72aa,0x49656aaa,0x728a51a6,0x5a495a27,0x6289836c,0x62a9732b,0x5a485227,0x93ef62ca,0x5a48a471,0x52275207,0x5a285a28,0x838d7b2c,0x62aa6289,0x836c93ce,0x5a2772eb,0x51e749c6,0x626851e6,0x6a88832a,0x6a674984,0x7ac972a8,0x72877aa8,0x59e68b4a,0x62276227,0x49654145,0x416451a6,0x49643923,0x72c972c9,0x72686a68,0x494559e6,0x38a24124,0x72894924,0x7b0972a9,0x51e56246,0x72c96267,0x51c572e9,0x72a95a07,0x30a24965,0x28c230c3,0x59e64144,0x59e76228,0x30c34146,0x310330e3,0x49c53944,0x49c649a5,0x7b0b7aea,0x392459e7,0x30a330e3,0x30a230a2,0x288130a2,
-0x30812860,0x38c230a1,0x51245104,0x8a896164,0x79c6a2e9,0x79c56963,0x82668a66,0x7a057204,0x69e68287,0x518459c5,0x732a5a27,0x83ae83cd,0x184341c7,0xa4b1acb1,0x734c940e,0x838d7b6c,0x522762a9,0x7b8d5a89,0x736c9470,0x8c0e6b2b,0x948f8c2e,0xa4f1a512,0x9cf194b0,0x94b19cd1,0xa4d1a4f1,0x944f944f,0xa512a4d2,0xa4f2a512,0xa4f1a4f2,0xa4d19cb1,0x8c0e9c90,0x5ac97b8c,0x4a074a27,0x6b2b5288,0x9c9183ce,0xa4b1ad13,0x6aea8bef,0x6a895a48,0xacb193ee,0x9c30acb1,0x62497b4c,0x49454165,0x6a8a6229,0x5a695208,0x62486269,0x620872aa,0x49454124,0x938e728a,0x49e75a08,0x730c9430,0x9bae6208,0x5a689bce,0x8c4f83cd,0x94506b0b,0xa4b2acf3,0xad13a4d2,0xa4d2a4d2,0xad12b533,0x8bae83ee,0x5a28834c,0x7aca6268,0x59656a08,0x59445124,0x71e76185,
-0x72ca7269,0x730b7b6c,0x630a62ea,0x9cb18c2f,0xa4f2a4d1,0x9c91a4d1,0xa4d1a4b1,0xacf2a4b1,0xa4d1acf2,0xacf2a4d2,0x94509450,0x83ae9c70,0x730b5a89,0x6289838d,0x5a076269,0x41656a89,0x51e751c7,0x832c7acb,0x836c5a48,0x5247834c,0x524862a9,0x83ce62a9,0x7b2c8bee,0x39656aaa,0x6a8a51c6,0x62486a6a,0x62695a28,0x730b7b0b,0x6aea6aea,0x7b6c62a9,0x7b6c8bad,0x8bad8b8d,0x62067aea,0x830a4123,0x620672a8,0x6a266a47,0x6a6859e6,0x6a476227,0x51a56207,0x51a549a5,0x39034124,0x6a684943,0x62267ac9,0x7aa972a8,0x38e34965,0x30c23904,0x7ac85a06,0x62267ae9,0x7b0a6267,0x5a076227,0x62286a89,0x51a66a28,0x30c338e4,0x51e63924,0x51a65a07,0x30c33904,0x41653103,0x49a651a6,0x72cb5207,0x51e77aeb,0x30c33103,0x30a230a2,0x308130a2,0x38e13081,
-0x7a065143,0x610371a6,0x8a067124,0xa36c930a,0x69638267,0x61626122,0x93ca7286,0x71e48baa,0x59436943,0x51a43881,0x83ac7b2a,0x418662a9,0x51a85a29,0xa4b1ac91,0x8bee9c91,0x52276aea,0x838d6aea,0x9c90730b,0x8c4fad32,0x8c0f8c0e,0x7bac734b,0xa512a512,0xa512a532,0xa512a512,0x9cb1a4d1,0xa4f1a4f2,0xa4f1a4d1,0x9cd19cf1,0xa4f1a4f2,0xa4b19c90,0xacf1a4d1,0xacf2ad13,0x9470a4b1,0x732b83ce,0x4a275a89,0x732b5a89,0xa4b1940f,0x83cea491,0x5a685aa9,0x8bae72ea,0xa451a430,0x838d9c30,0x51e662a9,0x41654165,0x49653924,0x8b4c4144,0x59e68b6c,0x72a97aea,0x9c705a48,0x6aa9732b,0xac50a42f,0x83ad730b,0x630aa4d1,0x940f7b6c,0x7b2c7b2c,0x9451a471,0x94306b2c,0x9cb19430,0xa4d29cd2,0x7b8d942f,0x62ca7b4c,0x59c76a68,0x6a899bae,0x6a4851a5,
-0x6aca6248,0x94507b6d,0x9c909470,0x944f944f,0x9c909c90,0xacf1a4b1,0xad12a4f1,0x9cf1a512,0x9cf09cd0,0x9c9194d1,0x94509cb1,0x94508bce,0x9c509c70,0x8bae9c2f,0x49c672eb,0x51e759e7,0x624851a6,0x72ca7b0b,0x62895207,0x6aeb6ac9,0x942f838d,0x942fa491,0x5207730b,0x6a8a5a28,0x51c75a28,0x51a64185,0x52075a28,0x62a941a6,0x7b6c62c9,0x732b7b8d,0x9c2f7b6c,0x838ca471,0x5a2751e6,0x51c54985,0x62476227,0x49646206,0x62274123,0x7aa9a42f,0x622751c6,0x51a56227,0x41034944,0x82ea4964,0x8b0a8b2a,0x49846a68,0x41244124,0x41444124,0x72c851e6,0x418451c6,0x62885a06,0x5a2772c9,0x51a64165,0x412451a6,0x30c230c2,0x51854144,0x6a6949a5,0x39245a28,0x30e32882,0x51a63904,0x6228728a,0x38e45186,0x38c338e4,0x38c22881,0x72065984,0x69847247,
-0xa30979c5,0x69438a46,0x92a88206,0x720692c9,0x8ac77205,0x93289348,0x69e67a87,0x93097a67,0x61846a04,0x49436184,0x62474163,0x5a486ac9,0x59c87aec,0x6aea7b2b,0x62ca5a88,0x83ad7b6c,0x5a2872ea,0x62ca5a48,0xa4f2944f,0xa4f1a4d1,0xa511ad32,0x9cd0a512,0xa4f19cd1,0xa4f19cd1,0xa4f1ad12,0xa512a4d1,0x9cd1ad12,0xa512a4f2,0x944f9cb1,0x94708c2f,0xa4d19cb1,0xa4f2acf1,0xa4d2a4d1,0xa4d1acf2,0xa4b1a4d2,0x6aea7b8d,0x52285a68,0x5aa95248,0x7b6c6b0b,0x6aa97b2c,0x52075207,0x732b6269,0x93ee8bae,0x7b2b93ee,0x6227832b,0x836b51a5,0x8b6b93ac,0x9c0eb4d0,0xad52a490,0xa4f29cb0,0xacf2b512,0xad32bd53,0xb573ad52,0xacd1ad12,0xb4d2acb1,0xa491acb2,0x942fa4b1,0x947083ee,0x83ef73ad,0x83ee9c51,0x6aeb7b6c,0x62898bce,0x49e76aaa,0x5a2849c6,
-0x6aca5a27,0x838d6aca,0x8bee7b4c,0x83ad9c91,0x8bce734b,0xacd28bcd,0x83cda4b1,0x944e944f,0x7bac6b4b,0x5aa98c4e,0x8c0e5268,0x5a484a07,0x41845a68,0x9c0f6269,0x51c68b8d,0x51c651c6,0x62284165,0x6a8a728a,0x836d832c,0x7b4c836d,0x7b4c7b2c,0x93ef940f,0x5a686aea,0x39646269,0x39454165,0x51e75a48,0x628a49c6,0x5a695228,0x5ac96b4b,0x83ad62ea,0x9c70942f,0x6aea9c50,0x6ac949c5,0x834b834b,0x59e67b0a,0x62064122,0x834b7aa8,0x41435a27,0x6a064964,0x82eb8b4c,0x49244103,0x59e65185,0x82c87267,0x5a067ac8,0x38e33923,0x30c23904,0x6a684984,0x51c66227,0x72ea6a88,0x62895a47,0x38e36a89,0x49653924,0x30c34124,0x392330c2,0x41854165,0x28a130e2,0x30c230c3,0x412438e2,0x51644123,0x41234123,0x40e25124,0x69e648c2,0x8ac89b09,0x698469a4,
-0x71a471c5,0x9b298246,0x69e582e9,0x69c47226,0x72867224,0x8b089369,0x71a571e5,0x69e571c5,0x9b097a46,0x492269e5,0x498540e2,0x8b8d72ea,0x51e87b0c,0x836c51a5,0x7b6c83ad,0x62696aea,0x5a286249,0x730b51e7,0x9cb19c70,0xa4f19cd1,0x9cd1acf2,0x9cb0a512,0xa4f1a512,0x9cd09cd0,0xa4f1a4d1,0x9cb0a4d1,0xa512a4f2,0x9cf1a4f2,0x8c2fa4d2,0x62ea732a,0x62a962ca,0x7b4c6aea,0x7b8d7b6c,0xa4b1942f,0xa4b1a491,0xb513b533,0x94709cb1,0x732c83ee,0x41c65248,0x730c5248,0x93ee93cf,0x62897b4c,0x49c651c6,0x62885227,0x836b9c0e,0xa40e7309,0x8becac8f,0x9c4e9c4e,0x9cf0944e,0x946f94b0,0x9c70a4b1,0xa5118c2f,0x844f9cf1,0xad338c70,0x942fa4b1,0xa491a491,0xacf2a490,0xa512ad13,0xa512a513,0x9471a4b1,0x9c91a4d2,0x51e772eb,0x5a6972eb,0x49c749c7,
-0x7b2c6248,0x93ce72eb,0x942f8bce,0x8c0facf3,0x940f732b,0x6ac9838c,0x834cacb1,0x7b4c6268,0x6aea730a,0x732b8c2e,0x9c505a68,0x52276b0a,0x5a276288,0x6a484124,0x62289bee,0x730a59e7,0x72ca7aea,0x6a6972a9,0x72aa6a89,0x72ca6a89,0x7b2b7b2b,0x4a075a88,0x41a54a07,0x5a2849e6,0x7b4c7b2c,0x628972eb,0x5a485227,0x8bee732c,0x94508bee,0x942f9cb1,0x730b83cd,0x72ca5a48,0x93cd6ac9,0x7b2b9c0e,0x6aa95a26,0x62677b2a,0x41645a26,0x416451c6,0x82ca6a47,0x41246227,0x41044944,0x7a884924,0x8b2a9b8b,0x5a066a47,0x49656227,0x38e338e4,0x7aca5186,0x72a98b4b,0x62a851e6,0x6288838c,0x31034986,0x30c330e3,0x30c330c3,0x41453904,0x414551a6,0x30c33904,0x38c230a2,0x38c238c3,0x490240c2,0x69a569e6,0x8a8869a4,0x82469b0a,0x69c46163,0x9b0992a7,
-0x7a457a46,0x8b2992c8,0x7ae88b2a,0x82c86a46,0x7a469309,0x82677226,0x8a678a87,0x8aa87a06,0xa34a92e9,0x82669b49,0x40c25964,0x62484124,0x93ce7b0b,0x7b6c51a5,0x62ca7b6d,0x7b0c6aaa,0x7aeb8b4d,0x418559e7,0x944f732b,0x62ea7b8c,0xacf18c2e,0xa5119cb0,0x9cd194d0,0xad11ad32,0xa4d19cd0,0xa4f2acf2,0x9cd1a4d1,0x9cd19cd1,0x9c909470,0xb553ad12,0xa4f2ad33,0x7b8d944f,0x6aea734c,0x41e64a47,0x62ca4a28,0x6aeb736c,0x8bef7bae,0x8bee83ad,0x9c919450,0x5a498bce,0x49c64186,0x730b6289,0x838d834c,0x5a6772ea,0x93ed6ae9,0x9bec9c2e,0x9bcc9bec,0x49856267,0x8bac7b0a,0x5a485a48,0x624872ca,0x9c70730b,0x4a475268,0x940fa4f2,0x732c62cb,0x62ca6b0b,0x5a88732b,0x738c944f,0x9c916b8c,0xacf3b513,0x9c70ad13,0x62296289,0x49876a69,0x6a8a51e7,
-0x8bad832c,0x7b6c732b,0xa4f18c0e,0x94d09cd1,0x9cf29cf2,0xad53a4f2,0xa4f2a4f1,0xa4d19cb1,0x9c709cb1,0xacd1a491,0x8bee9c4f,0x9c4e93ee,0x8b6b93cd,0x6a687aea,0x6a686248,0x6a896228,0x6a6972aa,0x59e76208,0x51c659e7,0x39444965,0x41a53924,0x836d72ca,0x8b8d7b6c,0x9c709c30,0x41a56aea,0x6b0b4a27,0x9c708bee,0x94509470,0x942f9c70,0x52277b6c,0x52474a06,0x7b4b5207,0xa46f940e,0x41a56ae9,0x7b2a6ac8,0x72c86a88,0x4984730a,0x6a684124,0x59c66a88,0x49645165,0x49244103,0x49444925,0x62256a67,0x83297ac8,0x41445a06,0x38e34124,0x416430e3,0x30c23923,0x6aa949e5,0x72ca62a9,0x51e772ca,0x412551a7,0x30c328a2,0x390430c3,0x41254966,0x288230e3,0x38a23082,0x514338a2,0x61847a26,0x79c55101,0xb38bab49,0x71a49ac7,0x61426142,0x9b8a7a06,
-0x8b09a3cb,0x69a47206,0x7a8669a4,0xa3ab9349,0x8247a34a,0x61a35923,0xa3ec8b29,0x72068b6a,0x71a471a5,0x6a0569a3,0x934b8aea,0x30c26a68,0x62674163,0x49833923,0x838d7b4b,0x72ea72eb,0x5a286248,0x72eb72ca,0x7b6c834c,0x62c97b4c,0x49e65207,0x9c70734c,0xa4d1a4f1,0xa4f1a4f1,0xa511a4f2,0xa4f19cd1,0x9cf1a512,0x8c6fa532,0x6b0b6b4b,0x6aca6aea,0x72ea62ca,0x83ad7b6c,0x9c50940e,0x9c709c70,0x734c8bee,0x4a076b0b,0x4a0741c6,0x5aa962a9,0x628a4a07,0x94108bae,0x8b6d9bf0,0x5a0872cb,0x51c64185,0x93ad8b8c,0x7b09836b,0x7b0a7b2a,0x62267ae8,0x838b49a5,0x62a8a470,0xa491838d,0x8bcf93ef,0xa4d2acd2,0xa5339470,0xacf2b553,0x9c91a4d2,0xacf19c90,0x83ccacf1,0x9490944f,0x83ee6b8c,0x7b8d8c2f,0x9c719c91,0x72eb9c30,0x7b0b9bcf,0x6a495a08,
-0x93ee7b0b,0xa4f19c90,0x9cf1a512,0xa5119cf1,0x73cd9470,0xa51294b0,0xa4d29cd1,0xacf3ad13,0xa4f2acf3,0xacd1a4d1,0xa48fb4f2,0xa42eac90,0xa44e9c4e,0x93cd9c0e,0x93ad7b2a,0x51c65a47,0x41644965,0x620859e7,0x626859e7,0x8b8d730b,0xa4709c50,0x83ae9c2f,0x5a69732c,0x52273964,0x83ae7b4b,0x9470944f,0x734c7bcd,0x5a89734b,0x41a649c6,0x524741a6,0x49c65248,0x8bae5a68,0x836d9c30,0x396441a6,0x6ae972ea,0x7b4b5a47,0x59e793cd,0x6a6872a9,0x498459e6,0x39234123,0x41045185,0x6a4738e3,0x82e78b09,0x5a056245,0x49866247,0x41033904,0x30c238e2,0x624859c7,0x52075227,0x5a085a68,0x390449a6,0x30a338e4,0x30e430c3,0x41854145,0x30a130e2,0x49233081,0x61646185,0x826771a5,0x71e58a87,0x9ac869e5,0x81c49aa8,0x92c779e5,0x9b4aa349,0x6a258287,
-0xa36a7aa7,0x720692ea,0x93097a67,0x82a79349,0x8a877a66,0x8ae89309,0x72a77246,0x9b2a934a,0x69847a06,0x9b097a25,0x82a89b2b,0x5a056a26,0x41624163,0x49845164,0x72ca49c5,0x6aca834c,0x49c751e7,0x51c751e7,0x7b0b6269,0x624972ca,0x730b62a9,0x62685207,0x9c909c4f,0xad12a4d1,0x9cd0a4d1,0x9cd19cd0,0x94b09cf1,0xa5129cd1,0x9cd1a4f2,0xacf2a4d1,0x93eea490,0x838c93cd,0x7b4c7b6c,0x62aa6aea,0x7b8e734c,0x9c508bae,0x6aeb9c0f,0x398449a6,0x51c65207,0x59e76269,0x6a2959e8,0x72ab6a6a,0xa40f8b4c,0xb490ac70,0x62469bcd,0x7b294962,0x73098bcb,0xa4b08c0c,0xb512b512,0xacf2ad12,0xad13a4f2,0xad13ad33,0xad33ad12,0xa4d1a512,0xad12ad12,0xa4f19cb0,0xa4f1a4f1,0xa512ad12,0xad33ad13,0x9cb1a512,0x94508c2f,0x730b7b8d,0x7b0c9410,0x72a95a08,
-0x7b6c838d,0xad126b2a,0x8c4fad32,0x944e7bcd,0x8c0e8c4e,0x7b8c8c2f,0x83cda4d1,0x8c2f8bee,0x83ae7b8d,0x62c98bee,0x7b6b6ae9,0x83ab8b8b,0xa42e8bcc,0xa44eac8e,0x9c2d9c2e,0x5a27730a,0x836c6aa8,0x9c0f93ee,0x9c2fa430,0x7b4c940f,0x522762a9,0x312339a5,0x732b41a5,0x8bee942f,0x6aea83ad,0x39a55227,0x5a894a07,0x41855a88,0x628949e7,0x52075a28,0x7b4c5a48,0x628a93ef,0x396549e7,0x5a4972eb,0x72ea5227,0x838c8b6b,0x93ee7b4b,0x49c66aa9,0x51e651c6,0x7ae96a87,0x38e36227,0x726959a6,0x6a457aa8,0x72c772a6,0x410451c5,0x39035166,0x410330c2,0x5a285186,0x52085a48,0x62695228,0x51866a49,0x30a230c4,0x30a230c3,0x18612082,0x38c128a1,0x7a467a46,0x694369a5,0x820579a4,0x9b297a26,0x82269309,0x82268206,0x724671c4,0x934a9b4a,0x72266a05,
-0x6a057a46,0x93297a87,0x6a0582e8,0x72667246,0x82e77266,0x93499b8b,0x72267267,0x7a467a47,0x92e88267,0x7a057206,0x69c47a06,0x8b297a67,0x51e5834a,0x59a551a4,0x72c96206,0x93ce8b6c,0x838d93ef,0x72cb730b,0x7b0b7aea,0x62a96aca,0x8c0e6aea,0xad12b533,0xa4f1a4d1,0xa512a4f2,0xad12acf2,0xacf2ad32,0xb533ad12,0x9cb1a4d1,0x9cf2a4f1,0xa4f29d12,0x732b842e,0x732a6b0a,0x62ca6aea,0x6b0b62ea,0x62ea6b0c,0x5a8962ca,0x94306aea,0x9470a4d1,0x5a687b8c,0x49c65227,0x62276249,0x41235185,0x49a43923,0x9c2e6247,0x6ac993ed,0xad118c0d,0x9c2ea490,0x9c4ea4af,0x730b8bad,0xa4709c4f,0x836d732b,0x62aa9c70,0xa4b1942f,0x8bcd62a9,0x732a942f,0x8c2f7b8c,0xad3273ac,0x7bad738c,0xacf2a4f1,0xad33a4d1,0xacf2b533,0x838d9c70,0x5228838d,0x7b4c5a29,
-0x734c6b0b,0x9cf19490,0xa512a532,0x9cd19cd1,0x8c4f9490,0x83ee9cb0,0x7b8d9450,0x8bcd5aa9,0x5a897b6c,0x8bce83ad,0x6aa95227,0x73096268,0x62876aa8,0x7b4a72e8,0x942d940d,0xb4f2940e,0x9c0facb1,0x72aa8b6d,0x498551e7,0x49c64165,0x62485a27,0x93ce7b0b,0x72eb93ae,0x51e75a48,0x52274986,0x62896289,0x62696a8a,0x8bae6acb,0x730b8bae,0x7b2c7b0c,0x6aaa62a9,0x5a0772cb,0x5a49628a,0x62896289,0x6aca6aea,0x8bcd6aca,0x51e78bed,0x72c96269,0x620659e6,0x6a677ae9,0x40e34123,0x41034104,0x82c759e5,0x49a36245,0x62286227,0x30e34105,0x39443903,0x5a275207,0x496651a6,0x38a34926,0x30822863,0x30c138e3,0x38e230a1,0x59e64944,0x8a677aa8,0x71846963,0x92e992a8,0x7a467267,0x9b299309,0x93289308,0x7a877aa7,0x9b0a932a,0x824679e6,0x82c89308,
-0x8b2972a7,0x9349938a,0x9b8a9b8a,0x726682c8,0x72877aa8,0x82a78ac8,0x72467246,0x7ae86a66,0x938b8329,0x82878b09,0x79e58205,0x7a277a05,0x7a4792ea,0x62479bed,0x6a884943,0x7b0b832c,0x72eb6aca,0x9c2f93ce,0x72ea832b,0x83ad8bcd,0x6b0a62ea,0x6b0a734b,0x6b2b6b0a,0x62c96b0a,0x6b0a62ca,0x5ac962ea,0x6b0a5aa9,0x7bad732b,0x944f8c0e,0x9cb19c90,0x8bac8bed,0xb4d1942e,0x8c0eacd1,0x7bad738c,0x9cb17bce,0x8c4f9cd2,0x5288736c,0x6b2a5247,0xa470942e,0x93ee9c50,0x6aa97b2b,0x6aa972c9,0x41644984,0x9c8e62a8,0xacd09c6e,0x8bec9c4d,0xa46facb0,0x6aa85a27,0x49a57b4b,0x940e8bcd,0x8c0e6ac9,0x5a68acd1,0x8c2e944f,0xa4b162a9,0x8c2facf2,0xa4f29cb1,0xa5129cf1,0x9cd0a4f2,0xa5119cd0,0xa4d0a4d0,0xb4d1b532,0x52066aa9,0x626993ae,0x5a494186,
-0x39a541a6,0xa4b1838d,0xad33a4f2,0xa512ad53,0xad53a512,0xad32ad32,0xa512a4f1,0xa4f1a4d1,0x83cd9cb0,0xb533944f,0x8c0e83cd,0x8bac7b8c,0x7309838b,0x628772e9,0x940e62a8,0x7b4c72ea,0x41856a89,0x5a284986,0x72ca6a69,0x8b4c834c,0x834c8b8d,0x6a897aeb,0x62285a07,0x72aa6a89,0x62496a89,0x72cb5207,0x9c1093ce,0x836d93cf,0x6aca72eb,0x49a65207,0x62aa6aca,0x838e4a07,0x52286aeb,0x72ec72ec,0x6aea6a8a,0x6aea7b4c,0x834c5a68,0x51a67b0b,0x82ca51c6,0x41237268,0x49244924,0x49444104,0x62256206,0x6a466a45,0x51665a06,0x38e44105,0x30e330c3,0x310328e3,0x59e751a6,0x38a34104,0x38a238c3,0x40c240a1,0x6a275123,0x9bac8b2a,0x698482c9,0x69846183,0x9b4a7a26,0x9329a3ab,0x69a47a26,0x7a6669c4,0x9bcb934a,0x7a47936b,0x69c45964,0x9b8b82c7,
-0x7ae8938a,0x6a467267,0x72867245,0xac2d8b4a,0x6a269bab,0x72255962,0x9bab9349,0x72a78309,0x7a877287,0x7a677a87,0xab6a82c8,0x71c5a30a,0x82266964,0x72887ac8,0x498559e6,0x7aea6248,0x62696aa9,0x62685a48,0x5a686248,0x732b6ac9,0xa4b183ee,0x83cd9c70,0x8c0f83ad,0xacd2a491,0x9c70a4b2,0x9c909470,0x8c2f9450,0x734b83cd,0x6aca6aea,0x6a896aca,0x6aa96289,0x8b8d72ea,0xa4919c2f,0xa4b2a4b1,0xa5129cd2,0x9cd1ad33,0xa4f19cd1,0x72e9942f,0x5a466267,0x72aa6aa9,0x8b8d832b,0x6ae98b8c,0x732a49c5,0x83cbacd0,0x7b4a8bcb,0x62867b29,0x838c6aa8,0x7b4b6ac9,0x6ac98bcd,0x942e9c4e,0x9c6f83ad,0x8c2ea4b0,0x9cb0a4f1,0xa5329cf1,0xad32ad52,0xad32ad33,0xa512ad33,0xad33a532,0xa4d1b552,0xb512a4d1,0x7b0bac90,0x51a659e6,0x51866228,0x59c55185,
-0x6a6859e7,0x72ea49a5,0x83cd9c0f,0xad129c90,0xa512a512,0x94d19cf2,0xad32a4f2,0xad12a512,0x9cd0a4f1,0x9cd1a4d1,0xad13a4f2,0xacf1b511,0x940d9c6f,0x9c0e942e,0x6aea6ac9,0x7b0b6269,0x51c672ca,0x6a494986,0x6a6872aa,0x72ca6228,0x59e759e7,0x62686248,0x51e75a28,0x6aaa49c6,0x52076269,0x41a649c7,0x41a64165,0x396551e8,0x628949c6,0x7b6d5227,0x5a4883ad,0x9c716aeb,0x9c519410,0x93ef9c51,0x93ef940f,0x7b4c7b6c,0x62698bee,0x5a285a28,0x414351a5,0x51644123,0x514561a6,0x51854104,0x7ac86a67,0x6a676a67,0x59e87aca,0x38c44105,0x39044925,0x310330e4,0x30c228e3,0x28a130c2,0x490338c2,0x69446123,0x82a769a5,0x61a38ae8,0x82a869e4,0x93099308,0x722682a7,0x9b4a82a7,0x82079ae9,0xb36c71a4,0x7a669b6a,0x8b087a86,0x82e9934a,0x7aa77aa8,
-0xa38b8ae8,0x62059329,0x932a6a46,0x82e8938b,0x82a87a87,0x72477a88,0x83097266,0x93099b6b,0x61648247,0x8b098267,0x8b098b6b,0x7a067a66,0x71e571e5,0x82ea7aa7,0x49646a67,0x5a074123,0x72ea7aca,0x5a486aa9,0x5a685207,0x940f836c,0x9c509c50,0x732b838d,0x5a686aca,0x5aa95248,0x83ae6aeb,0xa4f2a4d2,0x9cb09cb0,0xa511a4f1,0xad12ad32,0x9c90a4d1,0x9c4fa4b1,0x62ca838c,0x52685a89,0x5a895268,0x734c6aea,0x945083ee,0x9c909cb0,0xa46ea48f,0x83298329,0x7ae9832a,0x6a467287,0x72c86a47,0xa42d8b6b,0x6aa99bed,0x5a276288,0x7b2b93ac,0x8bcd6288,0x942e732a,0x83cd9c6f,0xad11a4b0,0xad119cd0,0xb552b573,0xad73ad53,0xa553a532,0xad53ad73,0xa532a552,0xa4f2ad33,0xacd2a491,0xacb1b4f2,0x8bada450,0x59e75207,0x51a56247,0x69c569c5,0x59026143,
-0x59856144,0x59c559a6,0x5a684985,0x9c918bee,0x9cd29cb1,0xad33a4f2,0xa4f2ad33,0x9c909c90,0xa4d1a4d1,0x94709c70,0xa4b19c71,0x9c4f9c2f,0xac8fac90,0x9c2e9c4e,0x62a98bcd,0x8b8d7b2b,0x5a077b0b,0x62084985,0x49656228,0x52065a48,0x72ca49c6,0x41845a27,0x5a486268,0x6aca5a28,0x41c65a69,0x4a0739a5,0x52485a49,0x5a685248,0x5a895a68,0x52485a68,0x62ea5a68,0x62aa732b,0x62aa5aa9,0x62aa5a89,0x52475a89,0x52475247,0x5a695228,0x5a485208,0x51a551c6,0x69e661e6,0x6a076a07,0x41244944,0x622659e6,0x72a87ae9,0x41254164,0x40c438e4,0x38e440e4,0x30e330c2,0x30c238e3,0x494238e2,0x7a0561a3,0x92e971e5,0x6a0692c9,0x71a469a4,0x720471a3,0x93299b4a,0x72057a46,0x7a467a46,0x9b0a8267,0x7a6792a9,0x7a678267,0x8ae87286,0x938b9bab,0x82477a88,
-0x7a878267,0x82e97aa8,0x72477ae9,0x72468287,0x8b297aa7,0x8b4b8b6b,0x7a2682a9,0x8a887a26,0x8ac87a47,0x82c88268,0x72467aa7,0x936a7ac8,0x93498b49,0x49636226,0x728859e5,0x51a55a06,0x6a895a07,0x72ea72ea,0x52276aa9,0x7b2b6ac9,0x7b2b6ac9,0x836d9c2f,0x838d72eb,0x940f940e,0x8bcd83ad,0xa4f2a4b1,0xa4f1a4d1,0xa5119cd0,0xa512a532,0x9cf1a532,0xad32a532,0xad13ad52,0x7b8d9470,0x734c7b6c,0x5a8962ca,0x5a685a88,0x4a265227,0x49a449e5,0x51a451c4,0x6a4559e4,0x61e56a25,0xa40c8b4a,0xa40da3cc,0x5a268b2b,0x6ac98bac,0x9bee8bad,0xacd193ee,0xacb19c70,0xacd1b533,0xb532acb1,0x7b8ca4b0,0xad128c0e,0x8c2e7bac,0xb553b553,0xad33ad33,0xad12b552,0xa4909c70,0x7b2c83ad,0x62897b4c,0x59e751e7,0x59e661c6,0x61446185,0x81c579e6,0x68c26902,
-0x69847123,0x7a486164,0x620761e6,0x416449a4,0x7b6c5a89,0xa4d283ae,0xacd2a491,0x62a9838e,0x52286269,0x5a075207,0x5a2751c7,0x7b0a5a27,0x834b72ea,0x9c6fa44e,0x940e93ed,0x838c8bed,0xa42f8bee,0x8b6d93ee,0x836b834c,0x838c7b2b,0x7b4b838c,0x83ac7b6c,0x7b6c838c,0x83ad7b8d,0x7b8d7b6c,0x944f8c0f,0x8c308c2f,0x9c70942f,0x83ce8c2f,0x94709c90,0x8bee8c0e,0x83ad83ad,0x7b8c83ee,0x83ce7b8d,0x8c2f8c0f,0x7b8d8bee,0x838e8bef,0x730b6acb,0x51a56227,0x934c7aa9,0x49247269,0x38c24944,0x72c951a5,0x62076a47,0x49666a69,0x412430c3,0x40c340e3,0x40a240c3,0x51433861,0x932982a7,0x7a267a67,0x9ae88aa8,0x9ac89ae8,0x7a468a66,0x826692c8,0x72257a46,0x82a882a7,0x82c87a66,0x936b9b6a,0x936a934a,0x7aa782c8,0x8ac982c8,0x82c882e8,0x7aa882c8,
-0x7aa87267,0x936b8b49,0x82e98b4b,0x7a467246,0x72877246,0x82e98b4a,0x72266a47,0x7aa87206,0x8b6b8b09,0x7aa78329,0x72457246,0x7ac77266,0x7a879bab,0x6a4751c4,0x82ea7ae9,0x49a46a68,0x72c951c5,0xac70836c,0x730a9c4f,0x52065206,0xa450730a,0x93ce8bed,0x6aea8bce,0x7b6c6289,0x940e9c0e,0xacf2a46f,0xad12ad12,0xb573b532,0xad32ad52,0xb593ad53,0xad32b573,0xacf2ad32,0xa4b1b513,0x3144730b,0x41854186,0x5a2841a5,0xa42f8bcd,0x938b9bed,0x72a88309,0x8b6a8b6a,0x938a8309,0x62468349,0xa46e7b29,0x628772c8,0x72e9a48e,0x9c2e836b,0xacb1a42f,0x9c0fa451,0xa490838d,0x52276b0a,0x62a9732b,0x9c305a68,0x93ef6268,0xc595b4f2,0x940eacd2,0x7b4c8bee,0x52075a48,0x49a651c7,0x62276228,0x61c759c6,0x59236185,0x9a279228,0x89847944,0x68a08984,
-0x9a478184,0x592369a5,0x7a685964,0x59e66a07,0x49a56227,0x62484165,0x8b8d6269,0xb4d3a450,0x6aca9410,0x726972cb,0x6207830b,0x7aa951a6,0x62266226,0x5a2672c9,0x9c6f6aa8,0x5a889c6f,0x62895227,0x5a285a48,0x62885a47,0x6aa96a67,0x72e97b0a,0x730a6b09,0x6aea732a,0x732b6aea,0x52275a69,0x62ea5a89,0x5a896aeb,0x83ee5a89,0x942f83ad,0x5a89630a,0x8c2f7bad,0x83ce83ad,0x83ce9c90,0x94908c0e,0x9430a4d2,0x7bad736c,0x83ae8c0f,0x49e762aa,0x830a5a48,0x59c682c9,0x49244103,0x62274124,0x5a2672a9,0x62276227,0x30c34965,0x41234104,0x308138e2,0x61244083,0x61426143,0x9b0a7a05,0x92eab3ed,0x696371e6,0x820479c3,0xac0c8ac8,0x7246938b,0x61a35963,0x9b6a8287,0x83099bac,0x6a666a26,0x72866a86,0xabed8b2a,0x8269a38d,0x69e56184,0x9bab930a,
-0x7b098b8b,0x72677288,0x82c87a87,0x938c7ae9,0x7a89936c,0x7a4661c4,0x938b934a,0x6a8772c8,0x832972e8,0x6a8672e7,0x934982c8,0x7a468ae9,0x8ac97a27,0x93ab8b49,0x8b6b938b,0x59e67ae9,0x8b6c51c5,0x9c4fb4b1,0x838d838c,0x7b6c83ac,0x6b0a734b,0x6ae9734b,0x836b6ae9,0x72ea7b6b,0x5a476aa8,0x51c65a26,0x51e651e6,0x5a475226,0x72ea62a8,0x4a266ac9,0x49e649e6,0x52275227,0x59e851e7,0x412551e7,0x41653924,0x93ee834c,0x7b2a7b6b,0xb4aea44d,0xac6cac4c,0xa44ca42b,0xacceb4ee,0x7b4a838a,0xacf1a4b0,0x6ae96b0a,0x9c4e940e,0x836ba46f,0x836c72e9,0x62a941a5,0x732c6aea,0x8bce5227,0x62a99c30,0xac917b6c,0xbd13734c,0x6a8993ee,0x49855a07,0x620851a6,0x5a0751c6,0x62277aca,0x61a559a5,0x61236164,0x79447964,0x91a67924,0x796491c6,0x89e68185,
-0x9a06a247,0x89e67123,0x50c26964,0x71e66164,0x720769e7,0x830b7aaa,0x498559e6,0x6aeb4165,0x940f8bce,0x6aa98bee,0x8b8c7b2b,0x93cc7aea,0x72e972a8,0x5a6693ac,0x834b6aa8,0x624872ea,0x72a872e9,0x832b7aea,0x832a6267,0x8b4b7b2a,0x72c959e6,0x62477aea,0x51e66248,0x52066289,0x7b2b49e6,0x730b6aaa,0x5a69730a,0x942f8bce,0x62ca8c2e,0x732b3144,0x734c83ee,0x83cd83ad,0x942f630a,0x8c4e8bee,0x7b8c946f,0x7bcd62ca,0x49e79430,0x62883985,0x41436268,0x51854123,0x41044944,0x5a0751a5,0x936c72a9,0x38e372a9,0x410338e3,0x590440c2,0x48e248e3,0x93497a47,0x92e98b29,0x69649289,0xab4a79e5,0x7a459b09,0x9b097a47,0x7aa79b4a,0x8ac77266,0x8ae88b09,0x7a467a87,0xa36b8ac9,0x59c4934a,0x9b8b6a66,0x92e9a38c,0x7a677a88,0x83088ae9,0x7b0872a7,
-0x938c938a,0x61e5830a,0x93296a25,0x9bad8b6b,0x61e67aa9,0x72266a06,0x834a7267,0x82e893cc,0x61a37246,0x7ae86a05,0x9b8b938a,0x69a492e9,0x7a066984,0x8b4a7ae7,0xa40da40c,0x7aa99bac,0x59e64123,0x8bcd9c2e,0x83cd93ee,0xacf1944f,0x946e9cd0,0xacd09c8f,0xb4d0acd0,0x6ac88bac,0x938b72e9,0x9c0dac4e,0x8bac834b,0xa42fac50,0x840e83cd,0x8c4f8c4e,0x9cf19cd0,0xa4d1a4d1,0x93ee9c70,0x93cf8bae,0x72ca836d,0x62686268,0x6ae96288,0x6ac77b09,0x72e76ac7,0x940a8bca,0xacaea46c,0x8beca48d,0x730a7b4b,0x6aea5a88,0xacf18bee,0x6ae983cc,0x732a7b8b,0x8c0e6288,0x83ad6b2a,0x9c705227,0x734cacf2,0xb533944f,0x6268838d,0x51a549a5,0x59e66206,0x622859c6,0x61a66208,0x696569a6,0x69026123,0x79637102,0x9a269a27,0x69017983,0x9267c3ac,0xa2a979c6,
-0x70c38a06,0xbaea8145,0x692389e6,0x61447143,0x59235923,0x59a56185,0x6a6859c6,0x62896228,0x62ea5207,0x7b4a8c2f,0x838c7b4b,0x8c0c9c2d,0x8bcc62c7,0x62879c4e,0x52267309,0x832b72c9,0x6a69938d,0x82ca6a48,0x7ae96a48,0x7aea7ac9,0x8b8c832b,0x8b8d93ad,0x834c8b6c,0x5a27836c,0x834c8bad,0x838d93ce,0x72eb6289,0x39646aea,0x41a53944,0x732b6aea,0x62c96289,0x5a676aea,0x52675aa8,0x62e94a06,0x524762ca,0x732b62c9,0x836d6289,0x5227838c,0x49644184,0x49444964,0x41034103,0x5a074964,0x6a8872c9,0x30a24145,0x40e240e3,0x69845102,0x79e571a5,0x6a0569c4,0x9b4b9329,0x71a571c6,0x82457a05,0x8b497245,0x72888b2a,0x7a467a67,0x82c77a66,0x9b6a9b8b,0x826782c8,0x7a678a68,0x83297267,0x8b0a830a,0x824782a8,0x8b098267,0x9b8ba3ab,0x72468ae9,
-0x82e97226,0x7aa882c8,0x7aa882e9,0x7a877aa8,0x8b2982c7,0x934a936b,0x7a4782c9,0x9b2a7a67,0x7a467a46,0x8ae88287,0x7a877aa8,0x932a82a8,0x932a9b2a,0x9bcbcd51,0x9bac7287,0x59e59bac,0x51c651a5,0x6aa86248,0x942f7b4c,0x734b7b6c,0x6b2a944f,0x62c862a8,0x9c0c8b8b,0x9bcc93ec,0x72a793cb,0x8b8b6246,0x6267834a,0xacd1834b,0xad72b553,0x9d31a532,0x9d31a552,0xa552a532,0xa4f1a512,0x62aa940f,0x5a285207,0xa4908b8d,0x942f9c6f,0x836a8bed,0x83497b4a,0x93ea8baa,0x9c0bac6d,0x83498b6a,0x6ae96ac8,0xa4b0a44f,0x6ae9732a,0x9c4d942e,0x8bcc83ab,0x93ee8bcd,0xa47083ac,0xa4d2736c,0x9470b553,0x7b2b944f,0x51a549c6,0x59855185,0x61846185,0x618461a5,0x61445944,0x68c27144,0x99e668a2,0x8183b267,0x92676922,0x61a4ab49,0x9b2a9309,0x71c67227,
-0x716471c6,0x81a67964,0x8a277184,0x9267ab0a,0x61236103,0x61236984,0x59645924,0x5a075165,0x5a276a68,0x6b0a5206,0x8bcd8bcc,0x93ed9c6f,0x93ec7329,0x7329940d,0x732a9c2d,0xa42f8bcd,0x72caac50,0x62075185,0x72a96227,0x72ea72ea,0x5a487b0a,0x7b0b6a88,0x52276aa9,0x626951c6,0x49c65a27,0x49e65a48,0x628941a6,0x7b6c7b2c,0x5a075a27,0x834c6aaa,0x9c0f93ce,0x836c940e,0x942e730a,0x940d940d,0x8bcd93ed,0x9c2f9c0f,0x62888bad,0x51e551e6,0x516451a5,0x51245144,0x49244904,0x49434124,0x41444164,0x40c33903,0x50e240a2,0xa32a8206,0x7a057a26,0xa3099ae9,0x71e68227,0x8ae88ac8,0x7a257a25,0x9bcc9b8b,0x9b8b938b,0x7a258ae9,0x828792c8,0x82a78ac8,0x8aa88ae9,0x82c87a47,0x8b6b936a,0x9bad936c,0x82478ae9,0x7a657266,0x9b2a9309,0x7a2771e5,
-0x8ac88267,0x8b4a8329,0x7aa88b4b,0x82258267,0x72666a25,0x7aea8b4b,0x79e669e6,0x722779e6,0x9b4b8aa8,0x7a267a67,0x72268266,0x7b096226,0x7ae993ac,0xa44d7b08,0x93abb4af,0x6a266a46,0x4985830a,0x49a54144,0x9c50730b,0x8bcea490,0xb4d1838d,0x8bccbd32,0x8b6a6aa8,0x72e78bab,0x93eb72e8,0x6ac89c0c,0x7b4a6287,0x62a87309,0x7b8c62a9,0xacf19cb0,0xa512ad11,0x9cd1a512,0xacd29cd1,0x5a4893ef,0x62885228,0xa4d183ad,0x8c0d9cb0,0x8bab8bcc,0x93eb93aa,0x9beb9c0b,0x73088368,0xb4d093ac,0x838cacb1,0x93ee8b8e,0x6247730a,0x72e8832a,0xa42e7ae9,0x72c97b09,0x732aac90,0x8bee49c5,0x940fbd33,0x59e75a27,0x61c66a48,0x69a57a48,0x69446123,0x68e36944,0x81647944,0x9a6768e2,0x71439206,0x922681e5,0x718481c5,0x71e57a06,0xb46e7aa8,0x9bedb46f,
-0x8b2aa40e,0x49025984,0xab8b7a47,0x61228267,0xaaea9248,0x60e281a5,0x61246944,0x59236144,0x69c65945,0x59c661c6,0x62276207,0x936b836b,0xac6ea40d,0x8bcc93ed,0xacd1a4b0,0x946f944f,0x8c0e946f,0x7b4c83ad,0x6aca730a,0x6aca6ac9,0x62a972ea,0x730b6aa9,0x6aea732b,0x628962a9,0x736c732c,0x943083ad,0x732c9c50,0x49c63985,0x30e33924,0x72ca51e7,0x9c0f93ce,0x5a06730a,0x5a465a47,0x93ec7b2a,0x838c7b4a,0x626993ce,0x6a8951e6,0x5a0672ca,0x72485184,0x6a078aca,0x410438c3,0x6a6861e6,0x49656a68,0x38c238a3,0x616350e3,0x720571a4,0xbc0c92e8,0x8a88b3cc,0x69836943,0xab6a8266,0x930aabcc,0x72267a46,0x72867a46,0x9bab8308,0x93099bab,0x69c469a4,0xabcd9309,0x72a8938b,0x82a87a88,0x724682a8,0x9bcc7ae8,0x8ac9a3ac,0x6a0561a4,0x9bababab,
-0x726782e9,0x932a8ae9,0x8ae98ae9,0x82e97288,0x82a9932b,0x7a677a47,0x8b098ae9,0x7ac872a7,0x836a8309,0x8b0993cb,0x82c87267,0x72878b29,0x72877ac8,0x83289bcb,0x7b098b6a,0x498551a5,0xa4307aeb,0x49c672cb,0x5a6849c6,0x9c908bee,0x7b4b7b8c,0x940d9c2e,0x6ac87b4a,0x838a7308,0x7b29838a,0x6ac77b09,0x5a266246,0x7b0a72c9,0x8b8d7b2b,0xb512a46f,0x83ad9c90,0x730b83ad,0x626962a9,0x49c65a28,0x49c651e6,0x7b8c5227,0x736b7bad,0x62887309,0x6a876a87,0x7b286266,0x9c0b93ea,0xa44d9beb,0x9c4fb4f1,0x62675a47,0x7b4a72e9,0x836a8bab,0x832a834a,0x8b6b6247,0x52069c2e,0x9c2f51e6,0x5a4893ee,0x82ca6a69,0x7a486207,0x71a592a9,0x69435902,0x81647964,0xa22689a5,0x89c67144,0x71a49267,0x79e56964,0x61c569a4,0xac0e8aea,0xa46f9bee,0x9c8f9c6f,
-0x9c4fa4d0,0x938c9c2e,0x38a259e6,0x8a8869a5,0x8a279aa8,0x9a2768e2,0x79859a47,0x61237164,0x592350c2,0x59a561a5,0x7aca51c6,0x830a7288,0xac8f9bcc,0x7b2aa44d,0x946e8c0d,0x946f9c8f,0x41e6734b,0x62884a06,0x6ac96248,0x5a685a48,0x62a96aca,0x6aea6ae9,0x6b0a6aea,0x41a65207,0x29033944,0x7b2c62aa,0x394449e7,0x392449a6,0x49a66248,0x72ca51e6,0x72e97b0b,0x6a876287,0x72c85a66,0x8b8b7308,0x93cda42e,0x5a076aa9,0x51a66a89,0x72e949a5,0x82ea93ac,0x30a25165,0x41044104,0x59855165,0x40c34925,0x720540c1,0x71838a87,0xab496963,0x92e8b3ab,0x92a88266,0x92c89b09,0x826692a8,0xa3ac92e9,0x8205a34a,0x93287205,0x936aa3ca,0x7a8782c7,0x82a78ac7,0x82e88287,0x9b8b934a,0x69e5932a,0x8b097205,0x938b936b,0x7a688b2a,0x72667227,0x8b4a7aa8,
-0x936b9bcc,0x61c57a87,0x82e87225,0xa3ad936a,0x6a2682c9,0x720561c5,0x936b8288,0x7aa89b8c,0x59e46a66,0x7ac86a66,0x9bcc938c,0x72468309,0x6a0561a4,0xb4ae9beb,0x51a593ab,0x8b8d6268,0x6aaa7b0c,0x49a65a28,0x6aa949a6,0x940e9c0e,0x83cc732a,0x6ae983ac,0x93ed732a,0x93ec9c0d,0x834a93ec,0x93ab72e8,0x6268836b,0x7aea6248,0x6aa87aea,0xacb17b4c,0xacd2b512,0x62897b4c,0x5a286aaa,0x49853924,0x51c651c6,0x5a885227,0x6b2b5aa9,0x83cd83ad,0x942d8bcd,0x942c9c4e,0xa48c9c4c,0x93ec9c4c,0x8bab8bcb,0x730983ab,0x836a836a,0x7b287308,0x7b2a7b29,0x9c2eac8f,0x5a07834b,0x7b2b8b6c,0x72ca5a27,0x6a277b0a,0x9b4b6206,0x826792e9,0x71e57a26,0x69237184,0x69646923,0x59236123,0x69c671c6,0x9b6d7247,0x9badac0f,0x9c4f8bad,0x944f838c,0x83ce83cd,
-0x736c9470,0xa4709c90,0xa3ceac70,0x71e782ca,0x69236164,0x79a479a5,0x69637163,0x69c56983,0x72067205,0x62286a26,0x7aea59e6,0x6a887288,0xa44e7b0a,0x8baba44e,0x83cc942d,0x8bedacb1,0x5a276aa9,0x51c65a27,0x8b4b5a27,0x626849a5,0x7b2b72ea,0x730a7b2b,0x6268730a,0x39443103,0x6aaa4985,0x49a66269,0x30e33925,0x41443924,0x5a47834b,0x730a4184,0x7b4a838b,0x7b087b4a,0x8b8a93aa,0x8bab5a65,0x6247836b,0x5a285a07,0x8b8d5a28,0x6aa8832a,0x72896a88,0x41056207,0x518538e3,0x61a67a4a,0x48c348e3,0x69c45123,0x9aa77a25,0x8226a309,0x8aa77a05,0x82868266,0xabcca38b,0x82678ac8,0x7a867a66,0x92e97a46,0x82a78ae8,0x722582c8,0x8b2882a7,0x9b8a9b8a,0x7aa79329,0x7a877a66,0x8ae982a8,0x93297a87,0x726782c8,0x932a82c8,0x936a938b,0x7aa88329,
-0x9b4a7a87,0x72668b0a,0x932a7aa8,0x82a88ae9,0x8b0982c9,0x9329934a,0x7a6882a8,0x932b8288,0x7a4782c9,0x8b6a82c8,0x72e8834a,0x82a97aa8,0x8aa98ac9,0x8b6a8329,0x49a46a67,0x93ce7b0a,0x832d6aaa,0x51e7834d,0x6aa951a6,0xacf0942e,0xa4afa4b0,0xa48facf0,0xac4e93ed,0x9bccac6e,0x83098b29,0x62267b09,0x7b0a5a06,0x5a2872aa,0x942e7b4b,0x83ad838c,0x62a9734b,0x4a075a48,0x5a2849c6,0x72aa6aca,0x7b4c6aca,0x9c307b4c,0xa4f2ad13,0x838b8c0e,0xb4ef942c,0xbd0facce,0x940cb4ee,0x9c6e942c,0xa46f942d,0x9c6facd1,0x8bcb838b,0x7b087ae8,0x72e97b29,0x9c2fac4e,0x836c6268,0x7b2b72ea,0x834c9c0f,0x7aca51a4,0x72676a47,0x61a55984,0x82878aa8,0x7a6771e5,0x82a87246,0x932a932a,0x82ea8b2a,0xb4909bac,0x834ba42f,0x940e940e,0x83ada4d1,0x944f940e,
-0x944f7bad,0xa4b19c70,0x8b6c93ee,0x936b9bcd,0xc44ea36b,0x8267a36a,0x93097246,0xa38bb3ed,0x7aa87a87,0x5a06830a,0x59e659e6,0x6a877b0a,0x7b296aa8,0x8bec836a,0x8bcd8bcd,0x730a8bed,0x9c0e730a,0x3903834c,0x72aa5a07,0x6aa84123,0x836b8b8c,0xacb1a42e,0x5a068b8d,0x6aa95a48,0x51c672eb,0x72cb6269,0x416551c6,0x49856228,0x62486247,0x8b4b6a67,0x93ec93cc,0x72c7838a,0x940b7b28,0x836aa44d,0x5a476266,0x6aa95a67,0x62488b6d,0x7ae951c6,0x7b0b7b09,0x38e46269,0x412438c4,0x48e25144,0x69855103,0x92267985,0xabaab36a,0xab8aa3aa,0x7a669308,0x8ac782a7,0x82e882a7,0x6a867ae8,0x7ae86a66,0x93ab8b6a,0x8ae8938a,0x82868aa8,0x7a467a45,0x8b299b6a,0x6a257287,0x82a77226,0x934b82e8,0x7a88934b,0x82877a47,0x6a666a46,0x9b6c936a,0x7a687227,
-0x6a4682a8,0x936b7aa8,0x6a27934b,0x82866a25,0x7aa78286,0x8b4b9b6c,0x72277268,0x82a77247,0x9b6c7a68,0x7aa77287,0x728682c7,0x932b8ac8,0x7aea938c,0x8b6a8b6a,0x62475a26,0x624872a9,0x8b6d832c,0x51c77aeb,0x51c63924,0x7b2a6aa9,0x6ae97329,0x6ac972e9,0x72e87b2a,0x6a676247,0x6a6772c8,0x72a95a26,0x5a275a06,0x5a086248,0x62685207,0x6ae96aea,0x8bce734c,0xa491944f,0x8beea471,0x93cf8bae,0x5a487b0c,0x944f730b,0xa4f19cb1,0x72e8944f,0x93eb7308,0xa42c9c0c,0xb50fa42c,0x9c6dacef,0x732a8bcc,0x7b4ba490,0xb4af6ae8,0x72c89bec,0x8b8b832a,0x72ea93ed,0x940e7b2b,0x9bef6aa9,0x624893cd,0x72a87b0a,0x72a88b4b,0x6a467b09,0x6a466a66,0x8b2a7287,0x8b6b6a67,0x8b4a72a8,0x6ac86247,0x72c8832a,0x7aea832a,0x6aa98b8c,0x62688b8c,0x8b8c730b,
-0x7b4c72ea,0x7b4b49a5,0x7b0a5a47,0x62266268,0x83298309,0x72a77ae8,0x72a7938b,0x8b2a8309,0x72a87ac9,0x6a6872a9,0x62476a88,0x72a87ac9,0x62876a87,0x6ae86287,0x9c4f93cc,0x834b9c4e,0x7aea6aa9,0x49656268,0x72a96248,0x5a275206,0x730a6aa9,0x836c7b0a,0x8bad8bad,0x6289834c,0x624851c6,0x51e75a48,0x41654165,0x498451e7,0x5a264984,0x62467aca,0x6aa85a26,0x834972e8,0x9c4d838a,0x7b2993eb,0x7b4a836a,0x6ac96aa9,0x7b6c730b,0x834b836b,0x830b7ac9,0x41046a8a,0x490440e3,0x48e148e2,0xab6c7a27,0x8aa7b38b,0x7a2671e5,0x7a668a86,0xabcc9349,0x92e8b3cd,0x61c471c4,0x9c0c82e7,0x7aa79b8b,0x82c87288,0x82a682c8,0x9b8b8ae8,0x92c89b6b,0x6a256a25,0x9baa8b49,0x7ac88329,0x92e88ac8,0x934a8ac8,0x7ae982e8,0x83098b6a,0x72476a26,0x930a930a,
-0x82e97aa8,0x9b4b9329,0x8b2a934a,0x7ae87ac8,0x7a878b29,0x8ac98288,0x72e882e9,0x82a87287,0x9b6b9b4b,0x8b09934a,0x7aa782a7,0x7aa87ac8,0x72687ac8,0x6a879c2d,0x59e54122,0x93ce93ad,0x72cb5a28,0x416551c7,0x622759e7,0x626751c5,0xb4d09bed,0xc531bd31,0x836a8bab,0x9c6ea46e,0xa48f9c4d,0x832b72e9,0x7b0ba42f,0x72aa832c,0x942f72ca,0xb533ad12,0xad12ad12,0x732b9450,0x83ad7b6c,0x51c672ca,0x520751c7,0x940f838d,0x5aa9736c,0x41445227,0xac4f5a07,0x8329836b,0x8baa93ec,0x8beb940c,0xacaf7349,0xa46ea48f,0x8b8b93ec,0x72e993ac,0x93cc6a87,0x62a893ed,0x6aa88bac,0x8bad93ee,0x6a695a27,0x51c5832b,0x938c51c6,0x5a06832a,0x7b096a87,0x72e872c8,0x832a6a87,0x6a886a67,0x938c6a87,0x72a88b6b,0x8b4aa44f,0x834b834b,0x7b2a8b4b,0xa40e9c0e,
-0x8b6c832a,0x8b8c7b0a,0x8bac8bac,0x7309836b,0x8bab7b4a,0x5a667329,0x6aa893ec,0x72c9834a,0x834b830a,0x6a6851e6,0x6aa86246,0x72e86a67,0x72e8834a,0x832a72e9,0x7b4a72e9,0x93eda46f,0x51e672ea,0x51a64965,0x62484964,0xac90b4b1,0x39236aa9,0x8b6c6aca,0x49c66268,0x62476269,0x394451e6,0x6a892882,0x59e77aeb,0x59e66a89,0x72e949a5,0x6aa851c5,0x72e88b6b,0xa42c7308,0x83aa9c2c,0x83498bcb,0x72c8836a,0x9c2e730a,0x5a67838d,0x6aa95a68,0x6a8a834c,0x38c34125,0x48c24903,0x8aa96185,0x82677a26,0xabea9349,0x81c5a38b,0xa36a71c5,0x9b4ba3ab,0x82688ac9,0x82a78aa8,0x72877a66,0xa38c9b6b,0x79e69b0a,0x8b0869c4,0x9b8ca3cb,0x6a258b29,0x72047a66,0x8b4a6a25,0x936a9bec,0x61c48287,0x828669e5,0xa42d9baa,0x6a27936b,0x69e461c5,0xa3cc7a87,
-0x932aa3cd,0x6a057a68,0x7aa76a05,0x93ed8b8b,0x7267938b,0x69c45963,0x9bed8b09,0x728793cc,0x6a267226,0x7a887246,0xa3cd932b,0x72479bac,0x724659a4,0x5a468b6b,0x7b0a72c9,0x72ca6248,0x6a8993ad,0x41656248,0x7aca4985,0x834a936c,0x93cc7b29,0x7b298bab,0x8b6b834a,0x7b2972c8,0x7b0a8b4b,0x7b0993ac,0x730b72ea,0x5a275a48,0x7b8c6aaa,0xacf19c90,0xa4f1ad12,0x83cdad12,0x52285a68,0x52275a48,0x49c64165,0x9450734b,0x8c2f9c90,0x72ec8bce,0x41654965,0x51a649a5,0x414351c5,0xa44d836a,0x8b8a834a,0x7b299c4d,0x7b296286,0x8b8b834a,0x7b4a8bab,0x838c838c,0xac90940e,0x49e6836c,0x624851e6,0x5a4751e6,0x72a9832b,0x8b6c6247,0x832a7b0a,0x62068b6b,0x8b4a7aa9,0x59e57aa8,0x830a59c5,0x72c98b6b,0x8b8c832a,0x9bec72c9,0x838b93cd,0x7b0a8b8c,
-0x7b2a6287,0x7b0a834b,0x62886247,0x836b72ea,0x838b8bac,0x8b8c838b,0x834a834a,0x6a887b2a,0x62686a88,0x72a96227,0x6a676aa8,0x834a8329,0x6aa77b29,0x93cc72c8,0x9c2e9bed,0x6a888b8c,0x414459c6,0x72896227,0x72a951a5,0x93cd93ee,0x5a679c0d,0x7b0a6ac9,0x8b6c5a27,0x51e69c0e,0x6a695a27,0x41654965,0x496651c7,0x51c651c6,0x41435a06,0x834a6267,0x8bab834a,0x8baaa42d,0x6ac772e8,0x93cb838a,0x9c4e9c2d,0x6aa98bac,0x838c62a8,0x7b2c944f,0x412549c7,0x40e34904,0x69c540c2,0xab6ba34b,0x8a46a309,0x82a68245,0x9ae98ac8,0x8aa99aea,0x82469b09,0x93498287,0x9bac93ca,0x7a479b2b,0x9b4a7226,0x82a882a8,0x92e98288,0x82879b4b,0x8b4982c7,0x9b8a9bab,0x82a79b49,0x9b098267,0x82879b4a,0xa38b7226,0x722692e9,0x8b097a67,0x93ab938a,0x7a878309,
-0x9b6a7a87,0x7288934b,0x936b7aa8,0x8ae9930a,0x7b087ac8,0x83098329,0x82887aa8,0x9b8b8b0a,0x6a268309,0x8b2a82a8,0x8ae9934b,0x72667a88,0x72667aa8,0x49a46a87,0x8bad6268,0x62287b4b,0x838d72ea,0x41853924,0x7aea5a47,0x93ec9bed,0x8b8a7b28,0x8b6aa44d,0x8b6a6a86,0x93ab93cc,0x834a93cb,0x72e96a87,0x62887b0a,0x6aca6ac9,0x6b4b5a67,0xacf19cb0,0xa511ad11,0x946fb553,0x62c9730b,0x6a6972eb,0x5a483945,0x942f8bce,0x9c909c70,0x628a7bad,0x51e8626a,0x51e66a69,0x49655185,0x59c54985,0x624659e5,0x9c2e6ac8,0x8bab93ec,0x9c6d8beb,0x7b8b9c2d,0x8c0d83ab,0x93eeb4f2,0x72ea5206,0x5a078bad,0x832c49a6,0x51e66268,0x6a8972a9,0x6a876a89,0xa42e830a,0x72a8938c,0x72a97ac9,0x6a886a67,0x7b097b0a,0x834a72e9,0x73496ae8,0x734a7b4a,0x734a7b8b,
-0x93ac834a,0x8b6c6a88,0x7b0a72c9,0x62477b0a,0x834b72c9,0x834b6aa9,0x938c6aa8,0x5a076a88,0x62285a27,0x72a87aea,0x834a72e9,0xac8e9bec,0x72e88bcb,0x93cc7b29,0x626893cd,0x41644143,0x6a6849c5,0x7ae98b6c,0x8b8c51c5,0x93cd9c2e,0x5a478b8c,0x62684184,0x834b7b2b,0x394351c6,0x62686268,0x622830e3,0x41447aca,0x8b2c51c5,0x392349a5,0x72a8834a,0x9bec72c7,0x6ac7938a,0x8baa7b49,0x73288b89,0x9c2e93cb,0x7b2b8bac,0x5a486aca,0x730b72eb,0x51866269,0x48e35104,0x71e550e3,0x82469287,0x7a457a25,0x9ac88a66,0xa38ca34b,0xa32babcd,0x7a878aa8,0x7ae77ac7,0x8b0a8309,0x72477247,0x7ac77a66,0x93cb8328,0x82a98b4b,0x7a267a88,0x7aa77a46,0x9349a3cb,0x71e57a46,0x82877a26,0x8b4a7a87,0x82a88329,0x82878288,0x7aa77a46,0x936a9b8b,0x7a876a67,
-0x72678288,0x8b4b82e9,0x6a677b0a,0x7a677a47,0x83297a87,0x8b6b8b8b,0x826882c9,0x7ae882a7,0x8b4a72c8,0x7a667aa8,0x72677287,0x8b2a7a87,0x8b2a938b,0x51c55a26,0x7b0b6248,0x730a836c,0x730b62a9,0x4a066aea,0xa42e7b2b,0xb4cea44e,0x7b49acae,0x93cb6ac7,0x7b499c2c,0x8b8b6aa7,0x93ec9c2d,0x7b2a93ec,0x72e95a47,0x5a685a47,0x7b4b6ac9,0xacf19c6f,0xa4f1a4d1,0xa4b0a4d1,0x5a698bee,0x392438e3,0x5a284145,0x942f6aaa,0x9c90a4b1,0x940f9490,0x39856aca,0x59c751c7,0x726a7aab,0x516561c7,0x49654124,0x8b4b6227,0x6ae8940d,0x942b7b69,0x8bec9c8d,0x942e62a8,0x7b8bb511,0x730a836c,0x6a686a89,0x7aeb6a69,0x51c651a6,0x7b0a59e6,0x7aea7aea,0x72c8830b,0x7b0a832a,0x7b2a5a26,0x6aa87b2a,0x838b836a,0x9c6e7329,0x8bcc5246,0x7b6a942d,0x9c6e940d,
-0x7309838a,0x732a7329,0x7b4b940e,0x6ac97b2b,0x8b8c72ea,0x832b72c9,0x834c72a9,0x72ea93ad,0x7aeb72aa,0x72a95a27,0x8b8b8b8b,0x8b8b6266,0x9bec93ab,0x836aac4e,0x51a56a88,0x830a72c9,0x6a676227,0x72c972c9,0x72e97b2a,0xac6f8b6b,0x49c57b4b,0x6a885205,0x6a886a88,0x51e6832b,0x51c65a27,0x51a651c6,0x51c751c6,0x49844165,0x624649a4,0x7b096a87,0x7b298b8b,0x7b096266,0x83697308,0x838a940c,0xac8f8bab,0x730a940e,0x94308bee,0x5a077b4c,0x49034965,0x596448a2,0x9aa98a89,0x79e46122,0xb40bb3ca,0x8a88a34a,0x9b2a8aa9,0x82e98ae9,0x93aa82e8,0x932a9bcb,0x6a267226,0x938b934a,0x72868b29,0x8b6a7b09,0x83098b8b,0x93297aa8,0x8ac89b2b,0x828782c8,0x9b4a9309,0x82c78ac8,0x9bab93ab,0x8b4a93ab,0x82a87ac8,0x92e88ae8,0x7a878287,0x82c992e9,
-0x8b097a87,0x938b9b6b,0x936b938b,0x728782a8,0x7aa882e9,0x7ae882e9,0x72677aa8,0x8b4a7267,0x8b4a8b4a,0x8b298b29,0x724682a8,0x7aa87267,0x7aa88b2a,0x7aea4984,0x52077b0a,0xa4507b4b,0x62a9730b,0x62a97b8c,0xac70838c,0x93aa9c2d,0x9bcb9beb,0x6ac77b29,0x8baa8bcb,0xa46d8beb,0x83ab9c6d,0x940c836a,0x5a277b09,0x7aea830b,0x5a4751e6,0xacf183cd,0xa4d0b531,0x83acacf1,0x414451e6,0x49a649a6,0x5a283924,0x8bce730b,0xa4f19c90,0x8c0fa4b1,0x72eb83ad,0x51a66289,0x598659e7,0x51654945,0x41234924,0x59e651c6,0xa44e6a88,0x838c940d,0x7b6b83ab,0x734a8bcc,0xacafa4b0,0x834b838b,0x832b93ad,0x72c96a68,0x62276227,0x8b6c8b2b,0x832b7aca,0x72e98b6b,0x832a93cc,0x8b8c93ed,0x7b2a6aa8,0x832a8b8b,0xa42e93cc,0x7b4a5a47,0x7b0a940d,0x8bab7b2a,
-0x736a7309,0x63099c8e,0x62e97b6b,0x940e8bcd,0x9c2e940e,0xac90832b,0x6ac9836b,0x72e96288,0x836c838c,0x62266288,0x62466246,0x72c87b09,0xac8f9bed,0x8b6b9c0d,0x8b2a6226,0x59c58b2b,0x834a51a4,0x9c2da42d,0x940d8bab,0x9c0dbd11,0x5a065a06,0x5a2672e9,0x8b6c51c5,0x30e272ca,0x834b4164,0x41446a89,0x730b6a69,0x49a54144,0x72c97aea,0x7ae98b8c,0x8b8b72e8,0x836a838b,0x73098bab,0x838b7308,0x7b6b940d,0x7b4b62a8,0x6b0b940f,0x72ab5228,0x40e361c7,0x69a54903,0x8a068a27,0x7a048226,0xa3ca8286,0xa3ecac4c,0x71e582c8,0x8b297a46,0xac2da40c,0x8267936b,0x72257a06,0x93aa7aa6,0x932ba3cc,0x69c57a68,0x7ac769e5,0x9bcc8b6a,0x7a47936b,0x72066184,0x9bab82e8,0x938ba42e,0x61e47287,0x7aa66204,0x9c0c93aa,0x7a889bac,0x71e56184,0xa3cc92e8,
-0x8ae99bac,0x7a467a88,0x7aa77a66,0x940d7b09,0x7267936c,0x7a6661a4,0x93cb936a,0x7aa8836a,0x7a877aa8,0x7aa882c8,0x936b72c8,0x7a87936a,0x828769e5,0x624749a5,0xa43093ee,0x41a56a88,0xa4709c0f,0x41a53984,0xbd128bad,0x8349ac8f,0x93eb8369,0x8b8a8bcb,0x9c0cacae,0x838a834a,0xa46ea44d,0x93cc93cc,0x72e972c8,0x730a72ea,0x72ea72ea,0x9c4e838c,0xa4af9c2d,0x8bccb4f0,0x72a972e9,0x416559e7,0x41454145,0x7b4c49c7,0x9c909c70,0xa4b19c8f,0x8b8d9c50,0x41444144,0x6a684985,0x72a97aea,0x51a56227,0x62474184,0x6ac949a5,0x93cd8b8c,0x73298bac,0x8bcc7329,0xacaf8bac,0x6aa86ae9,0x832a7b4a,0x8bac93cd,0x72ea6247,0x834b8b4c,0x7b0a834b,0x836b72e9,0x9c2d8bcc,0x834bac8e,0x834a836b,0x8b6b832a,0x9bcd7b2a,0x6a677ac9,0x7ae9832a,0x936c830a,
-0x73297b2a,0x736b7beb,0x6b0a734a,0x83ac9c6f,0x940e6ac9,0x83ac836c,0x7b2a732a,0x8b8b8bac,0x834b7b2b,0x6a68832b,0x8b4b5a47,0x6aa87ac8,0x62676ac8,0xa40d7b29,0x7ae9832a,0x49a46a66,0xa46e834a,0x93ea9c2d,0xa44dac6d,0x6266838a,0x7ae96267,0x49846246,0x72886a88,0x5a073102,0x7aea51c6,0x5a48832c,0x49653924,0x51e65a28,0x49c549c5,0x6aa96267,0x7b4a7b4b,0x6ac86287,0x7b498bab,0x8bec8bab,0x9c2e940d,0x6288838c,0x730b6289,0x5a08832c,0x49034924,0x71a35121,0xb34a9a87,0xa36aabab,0x82459ac8,0x9b6a92e8,0x82e88b29,0x934a8ac8,0x8a68932a,0x930a8289,0x9b8b9b8b,0x7a878b29,0x932a7a88,0x72268ac9,0x9b298267,0x72a8932a,0x82e972a8,0x934b932a,0x7aa882e8,0xa3ab8b2a,0x7a479b4b,0x9b4b7a26,0x8b2aabcc,0x83087ae8,0x8ae98b29,0x7aa882a8,
-0xa3ac9b8b,0x61e582e8,0x934b7267,0x936a938b,0x82a97ac9,0x72477a88,0x83297aa8,0x9b6b938b,0x62057aa7,0x832a7267,0x936b9b8c,0x726782c8,0x7a677266,0x72c94164,0x7b2b834b,0x93ee8bad,0x5a685a68,0x6aa99c2f,0x8b8c5206,0xa48eac90,0x8bec8c0c,0x7b4a8bab,0x8bab72e9,0xa46eb4af,0x93cc8bab,0x7b298b8a,0x5a47832a,0x838c6267,0x51c57b0a,0xa44e72e9,0x93ec9c2d,0x9c4ea46d,0x496572ea,0x726a5186,0x39056a4a,0x52073925,0x62a86aea,0x730b5a88,0x93ee8b8d,0x72894165,0xbcd1a42f,0x93cdac4e,0x93cc9c0d,0x72c86ac7,0x6a87a42e,0x9bed8b4b,0x8b8b938c,0x8b8c72c8,0x8bac7309,0x7b4a7b4a,0x9c4e940d,0x9c2d9c4e,0x8bac7309,0x6aa8834b,0x7b2a7aea,0x8b8b7b4a,0x8b8b6ac8,0x93ed836b,0x834ba44e,0x93cc7b4a,0x836b72c9,0x62678b8c,0x830a93ad,0x93ad832b,
-0x7b4b7b2a,0x7b4a7b8b,0x940e7b8b,0x7b6c8bad,0x732a7b6b,0x732a6ae9,0x838c838b,0x8bcc7b4a,0x62678bac,0x7aea6247,0x938c7aea,0x834a72a8,0x62675a47,0x93ac9bed,0x51a45a06,0x7ac84983,0x9c0ca42c,0x9c6c940b,0x93cb9c2c,0x72c96245,0x5a267b09,0x6aa851c5,0x62476a88,0x938c834b,0x41654164,0x5a286a89,0x5a484165,0x41646269,0x836b5a47,0x93ee8bac,0x5a677b2b,0x7b4a7b29,0x836b6287,0x8bac8bcb,0x8bac83ac,0x93ee8bcd,0x52078b8d,0x6a6a5a07,0x38a14965,0x7a046182,0x8a6779e4,0x8ae9abab,0x82068226,0x7a878246,0xa3cb8308,0x82889b8b,0x92a88a87,0x72668227,0x938a8b8a,0x7a476a05,0x72467a67,0x932a7a87,0x7a478ae9,0x7a677a47,0x7ac87267,0x8b6b9b8c,0x7a6772a8,0x72268288,0xa36c7a87,0x7a478b0a,0x82a77226,0x7ae77a87,0x9bec9bec,0x7a877ac8,
-0x82e87267,0x83098309,0x72887aea,0x7a6782c8,0x932982a7,0x938c9bcd,0x7a8782e9,0x8ae97246,0x83297ac8,0x83097ae9,0x7a877aa8,0x936a8b2a,0x8b49938b,0x7b2b49a5,0x838d72ca,0x8bada490,0x62896289,0x6a898bad,0x6a684125,0x838b8bac,0x8bcc838b,0x940d6ac8,0x6ac89c4e,0x942d7b4a,0x7b29838b,0xa46eac6f,0x7ae96aa8,0x59e67ac9,0x7ac959e7,0x8b8b836a,0xa46e93ec,0x9becbcf1,0x51a56226,0x412451a6,0x49864966,0x52074125,0x7b6b730b,0x62897b4b,0x39234164,0x52074145,0x8b8d7b4c,0x9c4f93ee,0x9c2d942d,0x6ae88bab,0x8b6a8bab,0x8b298b49,0x8b4a7ac7,0x8b4ba3ed,0x72c893ac,0x8bcc9c0d,0x73497309,0xacd093ec,0x940d942d,0x62c88bac,0x834b62a8,0x9c4d940d,0x6ae87329,0x9c4e9c2d,0xa46e942d,0x9c4fa490,0x8bcc9c0e,0x940d7b8c,0x836c838c,0x730a7b8b,
-0x7b2a6ae9,0xb4b093ac,0x8b8c9c0f,0x8bac836c,0x83ac8bcd,0x72e98bcc,0x730993ec,0x8b4b834a,0x72887288,0x7aca8b2a,0x8b6c936c,0x62677b0a,0x834a6287,0x494372e8,0x59c551c5,0x93cb72c8,0x9bec8baa,0x9c4ca46c,0x8baa9c4c,0x93cb8b49,0x93ab7b09,0x9bedac2e,0x9bcd938c,0x59e69bcd,0x49854985,0x5a283924,0x28e36269,0x730a3965,0x5a275a47,0x73098bad,0x7b6c5a67,0x5246836a,0x62e87b6a,0x8bed6ac8,0x6b09940d,0x62896268,0x7acc5a28,0x51a67aec,0x514238c2,0xab287a45,0xa2e8bbaa,0x8a676942,0x9bcbabcb,0x930a82e9,0x9b6aa36b,0xa38ba3ab,0x8b098ae9,0x9b499b8b,0x7a477226,0x8b09932a,0x8b297aa8,0x8b4a8b09,0x938b93ab,0x72878309,0x7a6782c8,0x7a678288,0x8ae982c9,0x83097ac9,0x938b938b,0x936a93ab,0x72878309,0x8ae97a68,0x8ac892e9,0x72677267,
-0x7aa87a88,0x9b8b82e9,0x82e99bab,0x7a897288,0x72a87288,0x82c8934a,0x7a467226,0x7a877a68,0x9bec8309,0x72a8834a,0x7a887a68,0x7ae96a67,0x7b088b8b,0x93ce4164,0x7b4cbcf2,0x8b6c51e7,0x62699c0f,0x6aaa5a07,0x62485a07,0xac8fa42f,0x8bac836a,0x940d93ec,0x83ab93cc,0x838b93ec,0x9c4e730a,0x93cdac90,0x51c693cd,0x82e97ac9,0x6a486a68,0x938a72a8,0x9c2ba42c,0x93cb9beb,0x62688b8b,0x49864125,0x51c751c7,0x39244145,0x39233944,0x51e73944,0x41855a28,0x49e66aa9,0x49c549e5,0x51c549e5,0x6ac841a4,0x9bccac6f,0x8b6993cb,0x93898329,0x93cb938a,0x93aaa44d,0x8bcbac8e,0x93cc93eb,0x7b6a7328,0x940d9c4d,0x838b9c2e,0x9c2d9c6e,0x8bcc8bac,0x93ec8bcc,0x8bcc940c,0x7b098bec,0x93ed8bcc,0x7b6b7b6b,0x7b8b8bcd,0x942e732a,0x8bed6b09,0x730a940e,
-0x9bee8bcc,0x9bed6a88,0x838c7b4a,0x7b4b836b,0xa46f9c0e,0x7b4a93ed,0x73296ac9,0x7b299c2d,0x9c0e7ae9,0x72a98b8c,0x8b6b8b6c,0x5a0672c9,0x6a887ae9,0x72c85205,0x72c86246,0x83299c0d,0x49c35205,0xac8e836a,0xa40c9c2c,0xa40cb4ce,0x93cb93eb,0x6aa772e8,0x93cc8b8c,0x5a067ae9,0x72a97aea,0x5a085a28,0x310449a6,0x4a0649c6,0x8bac5206,0x5a26730a,0x6ac872c8,0x93ec62a8,0x83ab9c2d,0x7b4a8bcc,0x838c7b6b,0x7b4c836c,0x59e87b0c,0x390359c7,0x8ac85184,0xcc2cbc0c,0x7a05a308,0x7a0579a4,0xa44d8b08,0x934aac4d,0x7a2582a8,0x82e87a46,0xb44e9b8b,0x82c8a3ec,0x61a369c4,0x93697a67,0x83089bab,0x6a257a88,0x62866205,0xa3ec834a,0x82889b8c,0x61a45964,0xabed9309,0x7ae9a3ed,0x7ac87288,0x6a867ac7,0x9bcc8b49,0x8aa99bac,0x722661a5,0x936b9329,
-0x8ae9934a,0x82a882c9,0x8b098ac8,0x8b4b7ac9,0x82c9938c,0x7aa76a46,0x936b936a,0x8aea830a,0x82e97ac9,0x82e98309,0x934a82e9,0x830993ac,0x82c87a88,0x6aa949a5,0x7b4b6aa9,0x6aaa838d,0x93ee6289,0x62689bef,0x7b0a4985,0x940d9c2e,0x8bab836a,0x9c4e7309,0x72e8ac8f,0xa44e7b09,0x730a93ed,0x7b0a836b,0x8b6b72c9,0x38e25226,0x6a6851a5,0x6a457288,0x93a98348,0xac6dbcee,0x416472c8,0x51c84124,0x392451e7,0x62486289,0x7b0b6aa9,0x52485a28,0x730b9c30,0x9c0e93ed,0x72e993ed,0x8bec8b8b,0x72c972e9,0x8b8c5a26,0xa44d93cc,0x836993aa,0x62657b08,0xa44d8b8a,0x9c4c9c2c,0x838a6aa7,0x73288bcb,0xb5109c2d,0x9c0eb4f1,0x940d838b,0x7b4a6ae9,0x6ac893ed,0x8bcc93ed,0x836b9c0e,0x838b7309,0x6287730a,0x6ae9940d,0x940d730a,0x942e730a,0x7b2a8bed,
-0x9c4da46e,0x93cc8b8b,0x8bcc7b2a,0x7b4a93ed,0x730a72e9,0x6ac972e9,0xb4f17b2a,0x730a93ed,0x8bac8bcc,0x7b096aa8,0x8b4a8b4a,0x938c51c4,0x62468b6a,0x6a677287,0xa40d6247,0x49847b09,0x62674163,0x834a72e8,0xa42c9c0c,0x93ea8b69,0xa46dac8c,0x72a893aa,0x5a265a26,0xa42e6aa7,0x5a27832b,0x412551a7,0x41243924,0x62474124,0x5a06836b,0x6a6751c5,0x6ac85a05,0x6ac793cc,0x8bcc62a7,0x7b4a5246,0x6ac993ed,0x62685a07,0x830c6a89,0x38c25186,0xa36b6a07,0x7a459b49,0xa3498aa7,0x9309b38a,0x7aa78b09,0xa3ec936a,0x8a669b49,0xa3ab92c8,0x8b09a3ec,0x8b0982c8,0x93499308,0x72259308,0x9b6a82a7,0x72269329,0x8b297287,0x83098b4a,0x7a667aa7,0x7a878ae8,0x932a7a87,0x9b8c9b8b,0x59c4934b,0x9b6a6a05,0x9b6aabcc,0x724682c8,0x82a87a87,0x82c87a87,
-0xa38c938b,0x69e58aca,0x82e96a06,0xa3ed9bac,0x6a478b09,0x6a466225,0x938b72c8,0x934a9bed,0x59c57aa8,0x82e97267,0x9bcc8b6b,0x6a058b2a,0x6a2661e5,0x6a895a27,0x836d6a89,0x72eb8bce,0x83ad730b,0x838d7b2b,0x49c66aca,0x9c4e8bac,0x940c7b49,0x836b9c4d,0x7b0972e9,0x7b4a8b8b,0x93cd7b4b,0x834b7b2b,0x6a8872c9,0x72c98309,0x496559e6,0x49634964,0xa40b6a66,0x9c0cb48d,0x7b0b8b6b,0x31036228,0x7b0c6a89,0xac9093ce,0x9c0e8b8c,0x6289940d,0xa4b08bcd,0xa48e9c4e,0x9c4ea48f,0x9c0d942d,0x93eda44e,0x7ae959e6,0x8b8a51e5,0x7b09834a,0x7b298b6a,0x9bed836b,0x93ec7b09,0x5a466a87,0x7b2a7b29,0x7b6b7b09,0x9c4e9c2f,0x838c7b4b,0x8bac8bed,0x7b6a83ac,0x9c0d72c8,0x838bac6f,0x9c4f838c,0x83cc8c0d,0x940da4b0,0xa48f83ac,0x9c0d9c6f,0x9c0e9c2e,
-0x93ec940d,0x93ed838b,0x7b2a93ec,0x8bcc93ed,0x6ae97b2a,0x8bac6268,0x73096ac9,0x940d7b4a,0x940d9c4e,0x72c7838b,0x62467b09,0x7ac87b09,0x832a6247,0x6247834a,0x832a8b6b,0x7b095a26,0x51c572e9,0x7ae95a04,0x8349836a,0xa42b9c2c,0x9c0c93ca,0x9bedac6e,0x51c55a26,0x832a836a,0x7b0b72c8,0x39045a48,0x51a64165,0x49a43923,0x72a84984,0x62878b6b,0x7b085a46,0x7b297308,0x838b93ec,0x942e838b,0x7b2a838c,0x93ce93ad,0x51e6834b,0x49244124,0x822761a6,0x8a458a26,0x9b289286,0x9baab42d,0x8a478aa8,0x92c89286,0x936a8b08,0x82c89baa,0x82878287,0x8b098aa7,0xa36b9b8b,0x82278a87,0x8a668a26,0x83297266,0x82688b09,0x6a057a67,0x83497287,0x938b938b,0x7a478ae9,0x92e88267,0x930a92c8,0x8aa98aa9,0x82868aa7,0x9b8a8ac7,0x938a9bcb,0x7a87832a,
-0x932a7a47,0x728782c9,0x830a72e9,0x7a86934a,0x93497a87,0x936c9bac,0x726782ea,0x936a7aa7,0x7aa78b4a,0x9b4b7ac9,0x7a88932a,0x832a72a8,0x838a7b4a,0x9c0f51e5,0x52078bae,0x9c2f6aca,0x49e67b4c,0xa4507b0b,0x41447b2b,0x9c0d6267,0x9c0da48f,0x838b7309,0x834a9c0c,0x9c2d940d,0x62a87b2a,0x7b0a6288,0x51c56247,0x72895a27,0x51857248,0x8b4a61e6,0x83288308,0xa42d93cb,0x49c56ac8,0x62896289,0x9c2f6289,0x9c4e93cd,0x8bcc940d,0xa48e9c2e,0x9c4da46e,0xa44ea46e,0x93cca48f,0x838b9c0d,0x7b6a6267,0xa44e6287,0x834aa42d,0x72c8834a,0x72c85a46,0x8329832a,0x9c2d7b08,0x72c89c0c,0x93ec72e9,0x72e97b4b,0xa4708bac,0x93ed838c,0xa4b0acd0,0x940da44e,0x9c0d7309,0x838b7309,0x9c4ea48f,0x940e8bed,0x8bad836b,0xb511b4f1,0x7b4a940d,0x9c4e9c6f,
-0x940d7b2a,0x73099c0d,0x93ed942d,0x940d940d,0x836b838b,0x7b2a836b,0x6ac86287,0xa46e9c2e,0x8bac9c4e,0x836a7b09,0x7b086a86,0x7b098349,0xac6eac6e,0x83297ae9,0x72c8832a,0x62268329,0x8b4b6247,0x51c5832a,0x59e44122,0xa42c8349,0xa42ca44c,0x834a9beb,0x7b297b09,0x83298349,0x52067b09,0x5a286268,0x28c23923,0x41643903,0x83097b09,0x72a76a67,0x72c772a7,0x62867b08,0x73095a25,0x9c2e93ec,0x940e940e,0x7b0b8bce,0x418551e7,0x6a2730e3,0x9ae9a36b,0x92a88a46,0x9ae89ae9,0x8ae88aa7,0x8ae89329,0x9aea8a88,0xac0babac,0xabcca40b,0x7ac78ae8,0x82c88b28,0x93098ac8,0x828782a8,0x8a878246,0x938a9329,0x930a9b6b,0x6a4782a8,0x72467287,0x82a89349,0x7a887267,0x8ae97a66,0x9bab9b6b,0x934aa38b,0x7a668ac8,0x7a876a25,0x934a936a,0x72267226,
-0x7aa87a47,0x8b6b8329,0x7aa8832a,0x7a667a87,0x72877225,0x8b2a8b2a,0x72277a68,0x6aa76a46,0x8bac72e9,0x726772e8,0x82888288,0x83097a87,0x8b8a8b8b,0x520749a5,0x93ce7b0b,0x49e6730b,0xa491836d,0x6269628a,0x6aa9836c,0x9c2e730a,0x9c0d9c2d,0x836ab4d0,0x9c0c7b29,0x8b8ba46e,0x8bac72e9,0x6a88836c,0x728893ce,0x5a0751e6,0x494559a6,0x5a265185,0xa42c93ab,0xa42d9c2c,0x5a0793ac,0x72eb4985,0x7b4b7b4b,0x940dac90,0xa48e9c6e,0xa48da46d,0x9c4d9c6d,0xac8ea48e,0x5a679c2e,0x838b72ea,0x7b296266,0x8bab9c0d,0x8b6ab48f,0x832a72e9,0x8b498b4a,0x93cb8b6a,0x93cb8b69,0x9c0b93aa,0x6ac78bab,0x93ec834a,0x9c2d836b,0x834a838b,0x83cc8bec,0xa48f8bcc,0x838b9c2e,0x730a838b,0x83ac83ac,0x83ac836c,0x838c7b2a,0x9c4e9c6f,0x93ed836b,0x942da48f,
-0xacd0942d,0x8bccacf0,0x836b93ed,0x8bcc7b6b,0x8bcc942e,0x836b7b6b,0xa48e9c4e,0x836b93ed,0x8bcc7b29,0x7ae99c2d,0x9c0c8b8b,0x93eb8b6a,0x93ab8b6a,0x7ae893cc,0x9c0c938b,0x93cc8b4a,0x834aa42d,0x6aa86a87,0x51c55a26,0x8b498329,0x9c0b8b69,0x834a9c0c,0x52056266,0x93cb7308,0x7b0a72e8,0x6aa9832a,0x51c66248,0x51c530e2,0x6a4672c8,0x8b4a8b29,0x62466a87,0x832972e8,0x9c2d93cc,0x5a87838b,0x940f62a9,0x6aaa942f,0x51a65a07,0x594338c2,0x92a77a25,0xbc0cab6a,0x8286abac,0x7a456182,0xb48ea3cb,0x92eaabed,0x82878287,0x82e88b08,0xa3eca3ab,0x9309a3ec,0x69c469c4,0xa3eb7ac7,0x8ac8a3cc,0x82677246,0x7a8682a8,0x934b7ac8,0x92e99b6b,0x720569c4,0xabcc9b4a,0x7aa8932a,0x830882e9,0x7ae78b08,0x934a7ae7,0x932a9bab,0x7a477226,0x9b2a9b2a,
-0x7ae98ac9,0x938a8b4a,0x93299b8a,0x82e97247,0x72a78b6b,0x7aa77287,0x8aea8ae9,0x830a7ac9,0x936b8b4b,0x8b2a938b,0x82c97287,0x82c9934a,0x82a87a88,0x7b0b49a5,0x72eb7b4c,0x7b6d7b4c,0x6b0b6aca,0x838d8bae,0x62897b4c,0x7b0a51e6,0x7b299c2d,0xa42d6a87,0x8baaac8e,0x93ec836a,0x6ac9836b,0x7b4b93cd,0x9bae72ca,0x49647aca,0x51664965,0x6a664985,0x8b6a7ac8,0x93aba44d,0x72ea834a,0x51e651e7,0x838c730a,0xa4aeacb0,0xa48ea4ae,0xa48d9c6d,0x9c2c9c6c,0x5a46a46e,0x730a5a47,0x8b8c7309,0x7b4a93cc,0x8b8a8bab,0x836a93cb,0x9bed8b8c,0x72c8832a,0x7ae89bcc,0x6a867b08,0x72e77308,0x8bab838a,0x7b4a5a66,0x838ba48e,0x734983ac,0xa4af8bcc,0x9c4eacaf,0x93ed93ed,0x83aba46e,0xa4b0940d,0x940da46f,0x940e940e,0x732a9c2e,0x940d940d,0x942e940d,
-0x8bcc8bcc,0x940ca46f,0x940d732a,0x6ae98bcc,0x942e836b,0x7b2a7b6a,0xa46e7b6b,0x9c0da46e,0x9c2da46e,0x7b297b4a,0x7b298b89,0x9c0da44d,0x5a066aa8,0x51c55a06,0x72c86a88,0x93ab7b09,0x93cb93ab,0x8b6a9beb,0x6a677287,0x59e5830a,0x93ab7ae9,0x93ec9bec,0x72c87b49,0x73087308,0x7b2a836a,0x832b72c9,0x5a0772ea,0x72a86a88,0x624651e5,0xa40d93cc,0x72c78b6a,0x7b0872c8,0x5a6662a7,0x838c6267,0x9c70a470,0x628a83ad,0x40e359c7,0x512350e2,0xab8b7a47,0x9b49bbeb,0x8b4982e6,0x8b088b48,0xa36a8ae8,0xac0cac0c,0x82479b4a,0xa3ab7a27,0x9b8bac2c,0x82e88ae9,0x82c782c7,0x82c78ac7,0x9b8b9bcb,0x71e59b09,0x82e761e4,0xa3ec938b,0x72278b2a,0x7a467a67,0x9bab8287,0x936cabed,0x69c492e9,0x82c77a24,0xa3ec9bcb,0x7247932a,0x6a057206,0x934a7266,
-0x934aa3cd,0x69e47a67,0x82a869e4,0x9bac9b6a,0x7ac8938b,0x6a0561e4,0x9bac82e8,0x82a9a3ec,0x69c57206,0x7aa87226,0x93cc8b6b,0x7a878b6a,0x824669a4,0x93ad4985,0x5a277aea,0x93ef836c,0x5a696269,0x9c309c50,0x51e76aca,0x62684184,0x93ec93cc,0x8b8a8b8b,0x838a7b29,0x7b6a836a,0x730a7b6a,0xa44f7b4b,0x62277b2b,0x6a486a89,0x496551a6,0x6a6851a6,0x93ab72c8,0xa46eac8e,0x49a57b2a,0x730a5a26,0x9c2e7b4a,0x836ba48e,0x942c7b69,0x93eb9c4d,0x836a83aa,0x6288836b,0x7b2b49c6,0x6aa872ca,0x6aa88bab,0x72e88bab,0x7b09940c,0x834b834b,0x8b6b7b0a,0x7ae98b4a,0x8b6a8309,0x834a7b09,0x8b8b834a,0x8b6c9c2d,0x93cd8bcd,0x6ac98bac,0x93ed730a,0x838b940d,0x9c6e9c2d,0xa44f7b49,0x93ed93ed,0x7b6b93ee,0xa4d09c4f,0xa46fa4d0,0x838b940d,0x8c0d9c2d,
-0x838a7329,0x93ed836a,0xacd0838a,0x732a9c4e,0xa48f8bec,0x6ac88bcc,0xac8f83ab,0xa44e940c,0x838ba46e,0x8b8c836b,0x836a6247,0x7b099c0e,0x72c872c8,0x7b096a87,0x6aa76a87,0x6a87834a,0x7ac772a7,0x9bcb8349,0x7ae993ab,0x49a44985,0x72c95a06,0x9bec938a,0x6287938b,0x72c85225,0x836b93ab,0x6aa972e9,0x6aaa72ca,0x51e651e6,0x6aa872a8,0x72c872c8,0x7ae972c8,0x834a7b29,0x62a762a7,0x836c62a8,0x940f940f,0x52087b4d,0x41023903,0xa38c6a05,0x7a0682a9,0x8a668246,0xa36992c7,0xabccb42d,0x8a8892e9,0x82e78ac7,0x936a8308,0x82e89b6b,0x8ac87aa8,0x93098ac8,0xa38ba38a,0x8a669ae9,0x82c87a46,0x8aa87a87,0x82c88ac8,0x72468ac8,0x93497aa7,0x9b8b9b8b,0x8ac8930a,0x92e98ac8,0x92e99309,0x9b297a26,0x82879329,0x9b2a82a8,0x934b9b8b,0x72c8830a,
-0x9b6b7ac8,0x7a47930a,0x934a8288,0x82a79b6b,0x8b0982a7,0x834a9349,0x7aa872c8,0x9b4b8b2a,0x7a47930a,0x8b4a82a8,0x82e98b4a,0x82e982c9,0x82e98b2a,0x62074985,0x9c2fa430,0x5a885a48,0xa471a491,0x5a895228,0x93ee8bef,0x51e65a48,0xac8f9c0d,0x9c0c9c0d,0x72e893eb,0x836a72e8,0xa44e8bcc,0x72c99c2e,0x6a896a88,0x412451a5,0x49a64986,0x834a5206,0x93cba44d,0xa42d7b09,0x834bb4b0,0x5a464985,0xa4af93ed,0x73097b29,0x73286ae8,0x9c2d8bcb,0x49a483ab,0x834b4164,0x6aa96268,0x6ac96aa9,0x8bab8bcc,0x9c0c93cc,0x93ac832a,0x72c98b6a,0x7ae972e9,0x5a067ac9,0x6a878b4b,0x93cc7b0a,0x7b0a8b8b,0x7b2b7b4b,0x93cd8bad,0x93ee49c6,0x6aa9836b,0x9c2e93ed,0x838b8bcc,0xac8f7b4a,0x836b838b,0x838b83ac,0x942da4af,0x942e838c,0xa46f730a,0x8bcbacd0,
-0x93ed93ec,0x9c2d836b,0x6ac87b6a,0x9c2e9c4e,0x942d8bcc,0x93ec838b,0x9c0d7b4a,0x834a838b,0x7b2a72e8,0x5a268b8c,0x6aa88b6c,0x7b0a72c9,0x93cc8329,0x834aa42d,0xa42d93ab,0x8b6a9bec,0xa40c8b49,0xa3ccac4c,0x6a478b4a,0x518559c6,0x72a851a5,0x9bcc8b4a,0x6aa79bec,0x41633942,0x93cd832a,0x72ea93cd,0x52075a27,0x39234145,0x41434144,0x83095a26,0x72e872c8,0x72e8836a,0x8bec7b4a,0xa470940e,0x8b8dac91,0x41665a08,0x59e54123,0xa3aca3ac,0xa38ba3ac,0x8a2592a8,0x92a792a7,0x92a8ab6a,0x7a468aa8,0xa3a982c7,0x9bcca3eb,0xa3aca3ed,0x82669b2a,0x7a667225,0xa34a9b4a,0x7a0671c6,0x92888a46,0x9b6a9309,0x8aa89b2a,0x7a668267,0x7a877226,0x82e99b8b,0x7a467247,0x8a668246,0xa38b8aa7,0x7a479b4b,0x82667a05,0x72677205,0x8b6c936b,0x61c559e6,
-0x61c559c5,0x934b7a68,0x6a468b4a,0x7a667a67,0x82c77a86,0x8b8b9bac,0x72677ae8,0x82687267,0x934a7267,0x7a877aa8,0x7a477a47,0x8b0a8ac8,0x93ab8b6a,0x5a075a07,0x72ea6248,0x83ad8b8d,0x8b8e6aea,0x6aea83ad,0x834d6aca,0x5a2772ea,0xac6f7b0a,0x7b29a42d,0x93ec834a,0x9c0d9c0c,0x7b6a93ed,0x8b8c7b2a,0x62487b0b,0x41244985,0x6aa94145,0x9c0ea42f,0x9c0d9c0d,0x6aa893ec,0x72aa6aa8,0x62685a07,0x72e96aa8,0x5a66836b,0xa46e7b6b,0x62877b4b,0x72ea93ed,0x832a49c5,0x8b6b7aea,0x9bed9c0d,0x93cc9bcc,0x836a6266,0x62266a87,0x51a55a06,0x5a0651e5,0x51c559e5,0x7b2a6a67,0x6aa86a87,0x836b72e9,0x6a88940e,0x7b2a5206,0x72e972e9,0x9c0d8b8b,0x8bab9c2e,0x9c2d7b2a,0xa44ea46e,0x940d8c0c,0x9c2d942e,0x8bcca46f,0xacb08bcc,0x9c4e7b6b,0x93ed9c4e,
-0x8baba46e,0xa46ea46e,0x93ec7b2a,0x93ecacd0,0x940d7b4a,0x7b2a8bcc,0x8bac8b8b,0x7b09832a,0x7b2972e8,0x6a86834a,0x6a666a87,0x62678b6b,0x938d7aea,0x51857289,0x6a675a06,0x83297ae9,0x8b698b49,0x8b488b48,0x9b8b938a,0x6207a3ce,0x49844143,0x8b8b72a8,0x834a93cc,0x626749a4,0x93ad7b0a,0x8b8c8b8b,0x7b0b93cd,0x498551e6,0x6a8851a5,0x72887ae9,0x6a876a66,0x8b8b7b29,0x7b4a6aa7,0xa44fa46f,0x624872c9,0x5a0872aa,0x51024104,0x8ac771c5,0x82e79308,0xabcc9349,0x9ae9b3ac,0x8aa76983,0xac4ca40b,0x92e99bab,0xa34992e9,0x9309a38b,0xa3ab8aa8,0x9b2aac2d,0x71e571a5,0xa38b934a,0x8a8892e9,0x8ae98ac8,0x92e99b49,0x92e88287,0x8aa79b4a,0x7a877226,0x9b4a9b4a,0x8ac892c8,0x9b6a9b29,0x934a9309,0x8aa88aa7,0x7aa8930a,0x492461e6,0x30603061,
-0x514338a1,0x82e96a06,0x8b4a938b,0x7aa782e8,0x82a88ac8,0x8ac98ae9,0x7aa882a8,0x7ac87a88,0x9bcc936b,0x8b088b6b,0x82478a87,0x82e982a8,0x7ac88b4a,0x59e66226,0x72eb6288,0x9c2f93ee,0x5a275227,0x8bce9c70,0x6aca49e6,0x72ca93ce,0x93cd6247,0x9c0c93cc,0xac8ea46d,0x8bec9c4d,0x62a77b6a,0x62486267,0x728a5a07,0x412459c7,0x7b2b51a6,0xacafac90,0x93cb9c0c,0x834a8b8b,0x41645a27,0x938d6a89,0x7b0a832b,0x834a7b2a,0x834b6267,0x5a0793cd,0x93ce51e6,0x836b6267,0x93ab93cc,0x9c4dac8e,0x938a7ae8,0x59e5834a,0x830972e8,0x6a676a67,0x83297ac9,0xa42d93ab,0xa42d832a,0x836a8b6a,0x836a9c2d,0x9c2e7b29,0x5a265a27,0x7b0972e9,0x93ec9c0d,0x8b8b7b29,0x9c2d93ec,0x8bcc9c4d,0x93ed942d,0x940d83ab,0x8bec9c4e,0x838b6ac8,0xacaf6ac8,0x72e89c4e,
-0x7b29834a,0x9c0dac8e,0x9c6e7b2a,0x7b6a8bec,0xacafa44f,0xb4d09c4e,0x7b0a93cc,0x93ac72e9,0x7ae9938c,0x624672c9,0x83096267,0x72a86226,0x72c8830a,0x496459e5,0x728851a4,0x51836205,0x51a34982,0x51c451a3,0x8b2a7287,0x51856a27,0x51a54144,0x93ab72c8,0x72a793ac,0x49a54164,0x8b6b6a88,0x838b8bab,0x6ac97b2a,0x494459e7,0x51c559c6,0x72876a47,0x73086a87,0x7b29834a,0x93ec9c2d,0x834b7b6a,0x7aeb8b6c,0x410451c6,0x614340c2,0x69838205,0xa3698a66,0xa3cca3ec,0x82678aa8,0x82a68aa7,0xa3aa8ae7,0xa3cca3cc,0x7a259b4a,0x9b6a7225,0xb42da3cb,0x7a669b4a,0x6a057225,0x8b497246,0x9309a3cc,0x69e58aa8,0x7a8661a4,0xa3cca36a,0x72469329,0x69c469e4,0xb3ed8aa7,0x92e9b40e,0x69a38267,0x7a4571c4,0x9bac9b4b,0x49247aa9,0x30a130a2,0x410338e2,
-0x388038c1,0x59a54081,0x72a77a46,0xa40d8349,0x82a8abcc,0x71e46984,0xa3ec9329,0x82c89bac,0x7a677246,0x7aa87a87,0x9bab8309,0x7a879bcc,0x82a759a4,0x62689bcd,0x938c7aca,0x52276289,0x8bce940f,0x730b49c6,0x7b6ca491,0x498549a5,0x834b6227,0x9c2d9c0d,0x940b9c2c,0x836a836a,0x8bcc940d,0x6ae97b0a,0x49856248,0x51a55186,0x730a51c6,0x9c2d9c2e,0x9c0c9c4d,0x62467b49,0x51c65a26,0x626849a5,0x72a97aca,0x834b51c5,0x622772a9,0x626872ca,0x93ec49c5,0x836a8bab,0x9c0cac8d,0x8b8a8b69,0x626672c7,0x8b6b8b6a,0x938c832a,0x7ac9934a,0x8b2a832a,0x72c87287,0x7b2972c8,0x93ec9bed,0x832a7b2a,0x72e98b8b,0x5a26832b,0x72e972e9,0x832972e8,0x93ec8349,0x72e8ac8f,0x93ec8bcb,0x8bab93ab,0xa46e9c4e,0x6aa77b4a,0x8bcc8bac,0xac8f93cc,0x6ae88b8b,
-0x9c0c93ec,0xac6eb4d0,0x73297b4a,0x940c7b6a,0xa44eacaf,0x8bac8bac,0x938c72c9,0x832a72c9,0x6a88830a,0x62257ac9,0xa40d7ae8,0x834a72a8,0x72887ae9,0x7ac87288,0x8b2a9bcc,0x82e98b2a,0x7ae9936b,0x6a266a46,0x7aa86246,0x59c56a26,0x59e55165,0x8bab7ae9,0x7b2993ab,0x51c55a05,0x8b8b834b,0x9c2d93ec,0x834b93ed,0x62276aa9,0x51854124,0x62476a47,0x7ae86267,0x6ae77b29,0x8bab8b8a,0x938b93ec,0x59a56a47,0x40e35965,0x82675144,0x82878246,0xa34a92a8,0x82a79329,0xa38a9329,0xb40cb3eb,0x8a87a34a,0x9b8b8ae8,0x8ae89b6a,0x93298ae8,0x82a8934a,0x932a8aa8,0xababa3ab,0x72669b49,0xa38c7266,0x7a268ae9,0x93498287,0x7a879308,0x930982a7,0x9b4a9b8a,0x72468aa7,0xab8c8ac9,0x8a46a309,0xa34a79e4,0x51a58ae9,0x38a230c2,0x39044104,0x6a484144,
-0x514459a5,0x51634903,0x8b297246,0x832993ab,0x82877a88,0x8aa792e8,0x7ae87a86,0xa3ac934a,0x69a48288,0x932a8a87,0x834a93ac,0x7aa76aa6,0x7a468aa8,0x7acaac2e,0x6a8959e6,0x7b2b7b2b,0x7b4c732b,0x72ea7b6d,0x7b4c6aca,0x6289834c,0x832a59e6,0x7b0993cc,0x9c2c93cb,0x7b298bab,0x72e87329,0x6aa86aa8,0x62086268,0x496559c6,0x836c5a07,0x940c942e,0x8bab9c0c,0x72e9836a,0x498551e6,0x6a8959e6,0x72c972a9,0x51c551e6,0x72a97aea,0x8bad72eb,0x834a7b0a,0x9c0c9c0c,0x72e67b07,0x83288348,0x9bec8b69,0x7b097b09,0x72888b4b,0x8b2a8b4a,0x6a886a67,0x832b6a69,0x834b832a,0xb4d1a44f,0x72ca93cd,0x7b0a72ea,0x72e972a9,0x6a686a89,0x93cc7b0a,0x9c2c9c0d,0x834a8bab,0x834a93cc,0x9c0c838b,0x834b8bec,0x7b4a836b,0x9c2c9c2d,0x7b2993ec,0x940d836a,
-0xa46ea42d,0x72c88328,0x93cc93ec,0x8bab9c4d,0xa44e838b,0x7b4a8bcc,0x9bcd6aa8,0x52057ae9,0x7aa96227,0x59e57ac8,0xa3cb8b49,0x72a77b09,0x51a56a87,0x6a685184,0x51856a48,0x62275a06,0x7a8859e6,0x72888309,0x936a7287,0x62068b4a,0x49844163,0x938a6a87,0x6a87938b,0x394349a4,0x7b495a26,0x940c8bcb,0x838b940c,0x61e772a8,0x51645985,0x51a44123,0x83296a66,0x73288b8a,0x8b8a7b29,0x62478b8b,0x61a659c5,0x48e34904,0x8aa769a5,0xabcba349,0x8a879b29,0x92c88a88,0x930882a7,0x9b29b3ec,0x8a878a87,0x8aa792a6,0xabec9b29,0x9309a3ab,0x8aa882a8,0x82667226,0xa36aa36a,0x7a267a26,0x7a057a06,0x9b298267,0x72068ac8,0x7a057a26,0x8aa87205,0x9b2ab3cb,0x7a067a67,0x82468206,0x9b2a8247,0x59848288,0x38a148e1,0x41443081,0x6a496a28,0x49243082,
-0x49447227,0x7aa84122,0x7a278b0a,0x82668247,0x83287ac7,0x9bab93cb,0x7a4682c8,0x82a78267,0x936b7aa8,0x7a877aa8,0x7a4682a7,0x936b82a8,0x8b2a9b8b,0x83098b4a,0x624759e6,0x8b4c8b6d,0x72eb6228,0x6acaac71,0x7b0c51e7,0x72ab8b6e,0x6ac951c7,0x8bccac90,0x72e96ac8,0x8b8b8baa,0x6ac97b0a,0x62486a88,0x728a6a69,0x498559c6,0x8b8c6a88,0x9c8e9c2d,0xacafaccf,0x62266ae8,0x51a46a47,0x830b4985,0x7b2ba40f,0x72c97b2a,0x832a72c9,0x834a8b4a,0x8b4993cb,0x83498b69,0x936a9baa,0x936b934a,0x51c572a8,0x51c66227,0x51a64985,0x518551a5,0x41454965,0x6aaa49a6,0xa470838c,0xacb2b4f2,0x8b8da470,0x834c6269,0x62896289,0x72c972e9,0x7ae97b0a,0x832a7ae9,0xb4af72c8,0x836a93ac,0xac8ea44d,0x7b2993ac,0x72c87b09,0x8bab836a,0x6aa893cc,0x9c4d9c0c,
-0x8bcb7328,0x838a6aa6,0x838ba44d,0x8bab7b4a,0xa44ea44e,0x938c7309,0x72a9830b,0x51856228,0x82ea6a48,0x49a46a68,0x8bcc838b,0x6ac972e9,0x5a485a27,0x49c66289,0x51c64165,0x49a64986,0x496559a6,0x62074964,0x59e56a68,0x7ae959e5,0x41436247,0xa3ed7288,0x8b6ba40c,0x49857aeb,0x5a254983,0x940c8369,0x8b6c93cc,0x51856aa9,0x518540e3,0x59c54144,0x8b6b6a87,0x6a8693cc,0xa46d6ae7,0x5a488b8b,0x39043944,0x59c54944,0x92867225,0xaae9aac8,0x92c8a309,0xa3aa9329,0x9b2aa3aa,0x8aa871e5,0xa3ccabec,0x92e88b09,0xab8b9b49,0x9b4aabac,0x82e982a8,0x9309934a,0x82678247,0x9b299309,0x7a058a67,0x930992e9,0x8ac89309,0x7a677226,0x82278ac9,0x822781e7,0x82889ac9,0x61a561a5,0x516561a6,0x308140e3,0x516538c2,0x28814144,0x518538e3,0x724959a5,
-0x498582eb,0x832a51c5,0x8b2a938b,0x72258ac8,0x83087286,0x7ae98b6a,0x7a8772a7,0x8b2a7267,0x938b8b4a,0x8ae88b0a,0x7a468287,0x82877a46,0x7ac99b6b,0x93ac72a7,0x6227938b,0x938d5a07,0x7b0ca451,0x838d49c6,0x5207940f,0x93af6acb,0x5a286229,0x834b93ad,0x6aa87b4a,0x6aa86287,0x6a686a88,0x830b6a69,0x62287289,0x51a559a6,0x93cd72c9,0x940d942d,0x8bab8bcc,0x834aac8e,0x49435184,0x51854964,0x836b72ea,0x834b51c6,0x6aa7836b,0x8baa7b08,0x7ae88328,0x7aa7a42c,0x82e97aa8,0x51847247,0x51a551a5,0x41654985,0x49a551e6,0x830b72a9,0x836d7aeb,0x8bef8bae,0xad12a4d2,0xa470ad12,0x6a6972ca,0x5a48832b,0x836c8bad,0x72c96ac9,0x82e9832a,0x832a72c8,0xa40d8b6b,0x8b4a72c9,0x834aa42d,0x93cc8b4a,0x7b2a7ae9,0x834a7b2a,0x7b098b8b,0x9c2da44e,
-0x836a6a87,0xacaf8b8a,0x836b93ec,0x93ec834a,0x72e893ec,0x832a7ae8,0x6a6993ad,0x62084965,0x61e66a49,0x5a4751a5,0xb4f2940d,0xa470acb0,0xb513a470,0x834cb4d2,0x832c836c,0x49a65a28,0x59a75186,0x516659a6,0x6a484944,0x83099bcd,0x518459e6,0x830a59e7,0x62268b6a,0x496551a6,0x72a64983,0xa42d93cb,0x93eda44e,0x61e672a9,0x49445164,0x39234124,0x7aa85a06,0x6a666aa7,0x8baa8368,0x7b6d734b,0x30e35a49,0x9b6a59e6,0x9a87bbeb,0x79838a05,0x9b298225,0xbc2db40c,0x72469b6a,0x72467205,0xb42d9349,0xab8bbc6e,0x7a068267,0x8ac87a46,0xac2da3ac,0x82a7a3cc,0x61a369a4,0xabab8266,0x92e8a36a,0x61c47a25,0x724669e5,0xabcd8b0a,0x81c69b4b,0x590360e3,0x49235923,0x38c340e3,0x38a338a2,0x492538c3,0x39234965,0x51a63924,0x6a2751a5,0x9b8ea3ce,
-0x30a259c8,0x728751a4,0x72a772a7,0x934a7aa7,0x7aa89b8b,0x7a876a06,0x8b4a934a,0x7ac98309,0x930a82e9,0x7aa88ae9,0x930a82c8,0x8ac89309,0x7a676a05,0x8bcb6ac9,0x8baca44e,0x62686288,0x7b2b7b4b,0x62898bce,0x8bce6aca,0x51c772eb,0x520751c7,0x93ee832c,0x6ae8836b,0x6aa76287,0x6a8972c9,0x62286227,0x62286a48,0x49654985,0x93cc6a68,0xa48eacaf,0x8bca9c4c,0x938b8b8a,0x39037268,0x62274144,0x836b72c9,0x5206836b,0x7b296aa8,0x7b0872a7,0x83498baa,0x9bab8329,0x72688b09,0x49846206,0x59e65185,0x836c6228,0xac9093ee,0xac70b4b1,0x93ef9c0f,0x83ad8b8d,0x940e8bee,0xa470b4d1,0x41656a69,0x5a0759e6,0x942e9c2f,0x832a7b2a,0x834a7ac9,0x93eca3ed,0x93acac4d,0x93ac834a,0x7b29a44e,0x9c4e7b2a,0x9c2e93ed,0xa46f9c2d,0x93ed9c4e,0x93ed940d,
-0xa42d8bcc,0xa44eacce,0x836b72e9,0x836a834a,0x7b097b4a,0x72a98bab,0x62487aca,0x624851a6,0x59c66228,0x51e659e6,0x6aa96a88,0x62686aa9,0x7b0b6a89,0x9c0f8b8d,0xbcf2ac71,0x8b8da450,0x62287b2c,0x51c64986,0x49855186,0x72674944,0x51a57287,0x82e96a27,0x9bcc9389,0x49657aca,0x5a444141,0x9beb8369,0x8b8c93ec,0x61e772a8,0x51854944,0x51e53903,0x620559e5,0x938a8b09,0x9c4c8ba9,0x8beda4b0,0x61a551e7,0x89e48a27,0xab6aa2a7,0x7a878267,0xb34a9b09,0x92a8ab29,0x9beb8ae8,0x93aa942b,0x9aa79328,0xababa309,0x8a87ab6a,0xa3ab7a46,0x8ac8a3aa,0x92e88266,0x9b299b49,0x82469aa7,0x9b498ac7,0x69a592c8,0x8aea69e6,0x61e68b0a,0x38a14903,0x30a13881,0x38c338c2,0x51654104,0x38a35125,0x516540c3,0x38e34945,0x51a62861,0x82ca82eb,0x61e87269,
-0x518538e4,0x71e57a27,0x8ae871e4,0x938c938b,0x7a478ac9,0x7a667a46,0x9b4a82a7,0x934ba3cd,0x59447a68,0x8b2a7a07,0x938b93ab,0x722582c8,0x7a667225,0x836b51e5,0x9c0d9c0d,0x49e57b4b,0x836d5207,0x7b2c836c,0x5a4862a9,0x93ef8b8e,0x51e651c7,0x93cd836c,0x62676ac9,0x9c0e8bac,0x72a9834b,0x61e772a9,0x51854965,0x49245145,0x834a51a5,0xacadb4af,0xa46c9c6c,0x6a668369,0x496561e6,0x62074945,0x9c0e938c,0x6ac86aa8,0x834b8329,0x836b836b,0x7ac97b29,0x72c98b6b,0x59e66a47,0x51c651c6,0x93ce6a69,0xb5129c6f,0x838cac91,0x49a56268,0x51c54184,0x49a551c6,0x49e549a5,0x62685a47,0x518559e6,0x830b5a07,0xacb1ac90,0x62a8940e,0x9bec8b6b,0x9c4d938c,0x6ac78bab,0x8babbd30,0xa46e836a,0x836b9c4e,0xa46f834a,0xacd08bac,0xacb0ac8f,0xacd0acd1,
-0x7b498bec,0x9c4ea46e,0x7b2a93ed,0x93ec838b,0x7309838b,0x6aa86ac9,0x5a2772ca,0x624972aa,0x59e751c7,0x51a559c6,0x51c659e6,0x5a0651c6,0x51e65a06,0x51e651e6,0x7b2b5a48,0xacb19c0f,0x836da430,0x49866289,0x49654986,0x62265165,0x496359c5,0x6a664943,0x7ae88328,0x390359c6,0x7b076225,0x8b8a8348,0x8b8b93eb,0x62077ae9,0x41044944,0x49853903,0x51c451a4,0x7b086a45,0x9389a42b,0x52068329,0x48e240e3,0x89e56963,0x7a258a04,0xabcc9329,0x8a6782a8,0x82469ac8,0x9b898245,0x936abcaf,0x92a77a46,0x7a8592e8,0x9b6982c7,0x7265a3cb,0x8a878286,0x82868225,0xabaaa3aa,0x79c49246,0x69c471e5,0x720669a4,0x510369c5,0x38a238c2,0x30c130a1,0x62486a47,0x38e34165,0x41044104,0x49045124,0x48e35105,0x412338c2,0x41034164,0x830c51c6,0x51256a29,
-0x69e640a2,0x82a77a67,0x828782a8,0x72469b29,0x9b4a8267,0x9b4b9b6b,0x82879309,0x934a8268,0x82c982c9,0x8b0a8ac9,0x7a8782c9,0x9b4a8ae9,0x9b4a932a,0x7aea8b8b,0x9bed8b8c,0x834b93cc,0x41445a06,0x93ed6268,0x6a89730b,0x832d832c,0x5a486a8a,0xac906aca,0x72eaa46f,0x6aa95a47,0x7aea832b,0x7aeb72a9,0x51a66a69,0x51855165,0x6a8759e6,0x93ea8349,0x8bca9c2a,0x7ae99c0c,0x496559e6,0x49854124,0xa46e6267,0x49e4838b,0x938c6247,0x7b2a938c,0x834b8b8c,0x72a872c9,0x49655185,0x7aea51c6,0xacb1ac70,0x8bcda490,0x41845a47,0x62a85227,0x72886aa8,0x832a7b0a,0x6aa87309,0x51a56267,0x51a551a6,0x9c0f5a28,0xb532b4f2,0x940e940e,0x6267836b,0xac6d7b2a,0x73099c2d,0x836ab510,0x8bab838a,0x940d838b,0x8bcc93cc,0xacaf7b4a,0x8bac93ed,0x940d8bed,
-0x8b8b9c2e,0xb4f0a46e,0x8bcca48f,0xb4cf9c0e,0x7b4aa46e,0x836b7b09,0x624972a9,0x8b4d6a69,0x59e77aec,0x6a475a07,0x93ad6a68,0x8b8cac4f,0xa42e8b6b,0x6ac99c0d,0x49e66288,0x83ad49c5,0xa470a4b1,0x6aca8bae,0x492551c7,0x61e65165,0x51a46a26,0x62044943,0xa3ed8b69,0x4964934c,0x83484141,0x8b8993a9,0x8b8993ea,0x494359e5,0x390338e2,0x49644124,0x624651e5,0xa40c8329,0x938a8b69,0x6a077aa9,0x51025124,0x820571c5,0xb3698a46,0xab6bb38b,0xa38bbbed,0x93078aa7,0x9b08ab8a,0x8ac88aa8,0x9329a3ab,0x9b4982c7,0xa3cbabeb,0xabcba3cb,0x7a259b08,0x92a692a7,0x7a057a25,0x8a678246,0x7a0671c5,0x38816185,0x48e33061,0x38c34904,0x392330c2,0x41244143,0x6a6a4145,0x40e4728a,0x61a740c3,0x61c7828a,0x414438e2,0x7b2a72ea,0x8b6e72eb,0x38c26a29,
-0x61a440c2,0xa38b82a7,0x72469b8b,0x82677a06,0x72267247,0x8b2a9b6b,0x72466a26,0x6a267a87,0x9bac82c8,0x724682e9,0x7a677a67,0x82a97226,0x8ac9abac,0x93ab6a88,0x72c86a87,0x7b09938b,0x5a277b09,0x49854144,0x830b830a,0x7b0b6268,0x5a2793ad,0x93ed5a07,0x7b2b8b8c,0x7aea7b2a,0x72ea7aea,0x62686a89,0x62286a69,0x516559c7,0x7aa95185,0x93ca9bcb,0xa48c9c2a,0x9bed9c2b,0x5186830b,0x6a694145,0x6ac893ad,0x8bab8bcc,0x49c55a27,0x7b0a6a88,0x7ac97b0a,0x49a56248,0x498651a6,0x832b59e7,0xac91a450,0x49e57b2a,0x62a849e5,0x93ed72ea,0x8b8b9c0e,0xa42ea40e,0x938c9c0e,0x62267aea,0x498559c6,0xa4506269,0xad12acf2,0x8c2ead32,0x836b7b8c,0x93ac836b,0x8b8b834a,0x838bac8f,0x7b297b09,0xac8e8bac,0x732a9c2d,0x9c6e836b,0x8bec734a,0x942d9c2e,
-0x8bec9c6e,0x834b93cc,0x93ed940d,0x93ec8b8c,0x7b29836a,0x7b2a93ed,0x72a96a89,0x93ef6a8a,0x51e78b8d,0x6a896248,0xa42f7b0a,0x8b8c9c0e,0x9c4e93ed,0x8bab93cc,0x732993ed,0x41e54a05,0x9c90732b,0x83cea4b1,0x49455a49,0x51455145,0x51844964,0x6a055163,0x83088b28,0x41235185,0x83486225,0x8b898b69,0x8b698b89,0x6a477ae9,0x39034123,0x41444124,0x62664162,0x836a836a,0x93ab9c0c,0x59868b0a,0x49034082,0xc42d8ae9,0x8a26ab6a,0x81e589e6,0x8ae78225,0xb46dac0c,0x8287936a,0x82666982,0xac6d9b89,0x8ac9ac0c,0x7a467a26,0x7a258246,0xb3ec9ae9,0x8a67a38b,0x69647143,0x7a887a67,0x38615964,0x30a14081,0x494540e3,0x38e34945,0x722759a6,0x410459c5,0x49454145,0x51654104,0x59866186,0x410340e4,0x5a475a27,0x626841a5,0x626a838d,0x390228a2,
-0x82877226,0x82c78287,0x93498b28,0x932b7a68,0x82e98b4b,0x7a867267,0x936a8b29,0x83098308,0x8b29934a,0x82e98b49,0x8b097aa8,0x82889b2a,0x82877a27,0x62874984,0x7b296ac8,0x5a056ac8,0x93ec9c0d,0x59c651c5,0x51a551e6,0x6a696a68,0x7b2b5a27,0x7b2b6a89,0x836bacb1,0x7b2b72c9,0x6a887b0a,0x414451a5,0x59a65185,0x518559a6,0x59c64965,0x834972a7,0x9c2b8ba9,0x8b4aa42c,0x51866a69,0x49854125,0x8bcc72ea,0x7b2a7b4a,0x7aca7ae9,0x830b7aca,0x72c9934c,0x51a64965,0x496551c6,0x9bee6a89,0x72caa40f,0x51e64984,0x7b096aa8,0x93cd838c,0x938c93cd,0xa42e938c,0xac6fa42e,0x7aaaa42e,0x49854984,0xa4716aa9,0xa512ad13,0xa4f19cd1,0x7b2b9c6f,0x834b72c9,0x6aa872e9,0x836a8b8b,0x9c0d8329,0x93ecac6f,0x836a8b8b,0x9c4e8bab,0x93ec732a,0xa46dacaf,
-0xa46e9c4d,0x72e893eb,0x730ab4d0,0x93cc7b09,0x8b6a8bab,0x6aa8836b,0x72eb5a48,0x8bae6aaa,0x5a278bae,0x6aa951e6,0x7aea6aa9,0x62266a88,0x6ac86267,0xbcf09bed,0x730a836b,0x52067b6b,0x838d49c5,0x940fa491,0x51666aaa,0x49454905,0x51856206,0x6a874122,0x72879369,0x412359c5,0x62444142,0x9c0a93aa,0x72e78b8a,0x41034143,0x49254904,0x51a540e2,0x6aa772c8,0x730949c4,0x836a8baa,0x51e6730a,0x59844123,0x8a6771e5,0xc3acbb6b,0x79c471c4,0xab89a2e7,0x9349a3aa,0x92e982a7,0x93089328,0x82a782c7,0xbbeda36b,0x7984a30a,0xab2b8a06,0x8aa9b36c,0x71a569e6,0x596479c6,0x38813060,0x490338a2,0x492448e3,0x38e34944,0x59c738e3,0x6a2872aa,0x6a284924,0x7a8a8b2c,0x38e44105,0x726959a7,0x41236a48,0x836c51e6,0x7b0b8bcd,0x30e45a28,0x59c530a2,
-0x9b69abcc,0x69c47a66,0x7a8661c3,0xa42e932a,0x7a88934b,0x6a246a25,0x9baa7ac6,0x8b2a9bcb,0x61e47267,0x7aa87205,0xa3cd93cc,0x6a0582c9,0x72066184,0x52068b8c,0x838b4163,0x628793ec,0xa44e72e8,0x5a469c0c,0x832a7ae9,0x49855a27,0x51e649a5,0x49a55a27,0x9c0e832c,0x72ea836c,0x93cd834b,0x8b6c9bcd,0x8b4c938c,0x49246a28,0x62074903,0x9c0c936b,0x8bca9c0b,0x834a93eb,0x59c76a48,0x51c651a6,0x6ae95226,0x7b4a9c4e,0x72a96227,0x728882ea,0x59a56206,0x59e75185,0x41654965,0xac50830b,0x51c59bce,0x62674984,0x93cc6a87,0x8b8ca44e,0x72c972c9,0x6a686a89,0x8b6c93cd,0x6a88832a,0x51e649a5,0xacf2838d,0xa533a4f2,0x9cb0a533,0x8b6c732b,0x72caa40e,0x8b6c8b2b,0x9beda42e,0xac6fa42e,0x9c0ca46e,0x838a7b29,0x9c0c93ec,0x8bab7b09,0x942cacaf,
-0x9c4d7308,0x836ab4f0,0x93cc7b2a,0x6ac88b8b,0x9c4d834a,0x5a678bab,0x6aea5227,0x8bcf6268,0x6289940f,0x624849c6,0x49a572c9,0x498451a5,0x59c551a5,0x7ae96227,0x72a88b6b,0x72a98b2b,0x6a894985,0xac71a430,0x59a7830c,0x51464925,0x49445165,0x7ac94964,0x7a879bab,0x49844944,0x830872a7,0x93aa8b89,0x7b098b6a,0x51656a88,0x41044925,0x5a0640e4,0x62866226,0x8bab7b4a,0x940c83aa,0x496472e9,0x72054101,0x81a49286,0x7a2479a3,0x9ae88aa6,0x82258a66,0x7a058205,0x9b2a8a87,0x9b6aabcc,0x7a068aa8,0x7a0671e6,0x694479e6,0x61646124,0x48c25944,0x48e348e2,0x38a238a1,0x40e348e3,0x38c240e2,0x492438c2,0x72896a69,0x41244144,0x49244945,0x51864124,0x49654985,0x38c34125,0x41043083,0x7aa96a48,0x72e95a27,0x830b93ad,0x40c25145,0x72055964,
-0xa38a7a46,0x7a469328,0x93098287,0x7a889b4a,0x932a8288,0x936a9b8b,0x7a8782e8,0x934a82c8,0x82878b09,0x8b298287,0x7ac88329,0x930a7ae8,0x82a88ac9,0x7aea59e5,0x59e572a9,0x7b0972a7,0x72a851e5,0x8329a40d,0x8b6b5a26,0x62478b2b,0x72c972c9,0x49854985,0x6aa95a27,0x7b0a6ac9,0x72ea834b,0x72a96a88,0x6a687ac9,0x518559e7,0x62075186,0x7b2a7289,0x93eb8bab,0x834a93eb,0x51c66247,0x498551c6,0x940c730a,0x9c4e8bcc,0x6a688b8b,0x62066a26,0x518461e6,0x62085185,0x51856207,0xa40f934d,0x51847289,0x7ae96a26,0xa3ed72a8,0x832aac2e,0x498459e6,0x51c651a5,0x6a8849a5,0x62687b0a,0x62894185,0xad139450,0x9d129cf2,0x9c909d13,0x836c8bee,0x9bcd938c,0x936b832b,0x9bcdac4f,0x72e8938b,0x9c0d7b09,0xa46d93ec,0x9c2cb510,0xa44da48e,0x9c2d9c4d,
-0x838a8bcb,0xacaf940c,0xac6e93ed,0x93cbac8f,0x7b297b28,0x8b8b72c8,0x6ac96268,0xa4908bce,0x8beeacb1,0x41645a68,0x5a0651e6,0x59c651c6,0x518551c5,0x7a8859c6,0x9b6c82ca,0x62078b0b,0x59c759c7,0x7acb6a68,0x51866228,0x49255186,0x49444925,0x8b0a7267,0x624682e9,0x51c44964,0x9bc98b29,0x938993a9,0x7ae993aa,0x412451a5,0x41054104,0x41234124,0x834a5a05,0x5a458369,0x8b498329,0x48e27206,0x81c350e1,0x81e38a24,0x92e78224,0xb3ccabaa,0x9ac9ab6b,0x89e589e5,0x71a58205,0x61657a27,0x50a250a2,0x40c15102,0x40e33081,0x38c24923,0x512540c3,0x41035965,0x40c32840,0x40e45145,0x5a074945,0x38e34145,0x6a695a07,0x59e649a6,0x59e87289,0x5a284145,0x72aa7aea,0x51a659c6,0x49456208,0x72a930c2,0x9bee9bee,0x40e372aa,0x58e340a3,0x79c46964,
-0x82468225,0x9b4a8aa7,0x8268932a,0x82268288,0x7aa77a26,0x8b4a9b4a,0x7a4682c8,0x82a87a67,0x9b4a8288,0x726682a8,0x7a877286,0x82e97aa8,0x8ae99b6c,0x7ac95185,0x62078b0a,0x62064964,0x59e56a46,0x8b4a7266,0x72c872a8,0x830a93ac,0x9bed6267,0x5a479bed,0x624751c6,0x62886288,0x93cd72ea,0x834ba44f,0x7ac972a9,0x51c66a68,0x51654965,0x93cd6a88,0x940c93ec,0x9c2c9c2c,0x832a9c0c,0x62676246,0x62a76287,0x8bab83ab,0x622672e8,0x518459c5,0x59c551a4,0x59c759e6,0x51c751c6,0x9bae936d,0x498459e6,0x8b2a6a27,0x8b0a8b2a,0x62077ac9,0x51a65185,0x51c651c6,0x62486a68,0x49a65a06,0x732b49a5,0xa512acd1,0xad53a532,0xacd1b552,0x7289730a,0x6a88830a,0x6a4659e5,0x72c88b6b,0xa42d7ae9,0x93cbac8e,0xac8e8b8a,0x7b49bd10,0x9c0c93ec,0x8b8a8b8b,
-0xa48e8bec,0x8babaccf,0x8bacac6e,0x93eb9c4d,0x93cb8349,0x6ac88369,0x730a6288,0xacb1a451,0x9cb0acf2,0x51e7730a,0x51c65a28,0x624851c6,0x59a56a28,0x724859c6,0x62076a28,0x51a559c6,0x49a54985,0x498551a5,0x49864965,0x49665185,0x49654966,0x7aa96207,0x49a46206,0x83097ac7,0x83478327,0x93ea93e9,0x7b2a938b,0x39046248,0x390430e3,0x49644124,0x72e851e4,0xa40c93cc,0x72068b4a,0x50a25924,0x820458e1,0xab8aa349,0x69637a25,0x71e571c5,0x596461c5,0x59235123,0x49034903,0x48c348c2,0x40c248e3,0x40e240c2,0x51a64104,0x412451a6,0x38a340e3,0x40e340c3,0x49654104,0x38e24104,0x59c74965,0x39244124,0x49454985,0x62284965,0x41455a48,0x51c64165,0x49a651e7,0x39243944,0x51865186,0x41444124,0x8b6c72ea,0x38a26a68,0x61443881,0x9b2a9288,
-0x8a878aa7,0xab6aa328,0x9b2aa36b,0x82ca8a89,0x82c98b0a,0x82a78aa8,0x8b0892e8,0x92ea7287,0x934a9b2b,0x8b09a3ab,0x82e97287,0x82888ac9,0x8aa88288,0x51856228,0x726959e7,0x59c66a07,0x7b296a67,0x8b6b51c4,0x7287a3ed,0x93ab72c9,0x6a8772c8,0x51e693ad,0x51e64123,0x72e96268,0x9bed93cc,0x6a886267,0x62687b0a,0x62075a27,0x41045186,0x6aa94965,0xa46ea48f,0x93cb8beb,0x9c0b93ca,0x942c9c2d,0x83abb510,0xa46e8bcb,0x72a793ec,0x7a876a25,0x830a8ae9,0x51a66206,0x51a649a6,0x59e759e7,0x51a551a5,0x620659e5,0x72686a27,0x7a898b0a,0x59a651a5,0x498551a6,0x49854985,0x7b4c5207,0x942f8bae,0x9cf2ad13,0xa51294d1,0x7b4ba511,0x72676a88,0x72876206,0x72c87ac8,0x7b287b29,0xb48d8349,0x7b28ac8d,0xa48e8369,0x9c4da44d,0x942d9c2d,0x8bcca48f,
-0x9c6d6b08,0x6aa8a4ae,0x7329836b,0x9c0c834a,0x7b488baa,0x5a668bcb,0x7b4b8bac,0x732b6aea,0xa4d18c2f,0x8c0e9c4f,0x62696289,0x51c649a6,0x5a075a07,0x498551a5,0x620759e6,0x49a651c6,0x6aca6aa9,0x732b62e9,0x41645a47,0x5a086228,0x49654966,0x59a651c6,0x49844143,0x8b696a86,0x93c99be9,0x9c0a93c9,0x6248938a,0x39444144,0x38e44124,0x518530a2,0x9c0c8329,0x7b0a93ac,0x72487ac9,0x50c45125,0x50e250c3,0x41025102,0x48c240e2,0x40c248a3,0x490340c2,0x40e34903,0x41034103,0x41034903,0x72896207,0x38c359a7,0x41244124,0x39034124,0x61e67269,0x38a240e3,0x59e74945,0x38e351c6,0x390338e3,0x418528a2,0x832c830b,0x6a896208,0x5a0772eb,0x832d6228,0x72a993ce,0x830a6206,0x620782ea,0x412559e7,0x49654144,0x38c13923,0x69a44902,0xa38b8a87,
-0x9b09bc0d,0x72257a46,0x82877225,0xa3ce8b0a,0x7ac89bad,0x69e45184,0xa40c9329,0x82a9a3ac,0x6a057227,0x7aa76a05,0x938b936b,0x7a6892ea,0x7a4661a5,0x51c672ca,0x9bad6228,0x5a068b6c,0x626851c5,0x52467b09,0xa44e836b,0x6a6772e9,0x8b6b9bed,0x392349a5,0x5a075a27,0x8b8c834b,0x8b8b834b,0x8bac8b8c,0x7ae9834b,0x7aea7b0a,0x41246208,0x5a474945,0x93ec8b6b,0x93ca940c,0x940b93ea,0xa46c9c2c,0x9c6d9c4c,0x9c2ca46d,0x93aa9c0c,0x7aa88309,0x59c56a46,0x49a659e6,0x6aab6a8a,0x62696289,0x51c65a07,0x51854964,0x518551a5,0x51c651a6,0x51a65186,0x59e76208,0x93ee72aa,0xacd1ac6f,0xacf1b512,0xad329cb0,0xa4f1ad53,0x62886b0a,0x72267ac9,0x8b6a7247,0x8b8a8329,0xa44da42c,0x8b8a93eb,0xa44c93cb,0x72e893eb,0xaccf8bab,0x7309a46e,0x9c4e93ed,
-0x8beb7b6a,0x838a9c2d,0x8bcb836b,0x838a7b2a,0x834993eb,0x626672c8,0x836c93ed,0x62ca5a68,0xa4f18c2f,0xad12a4f1,0x9c919c70,0x7b8d734b,0x6aaa7b2b,0x730b730b,0x838d7b2c,0x940e7b4b,0xa4b0944f,0xa4f1a511,0x93eda4d0,0x6a8a6a89,0x728959e7,0x72a9830b,0x72875a06,0x8b8993aa,0x8ba88ba8,0x8ba98ba8,0x6a898b4a,0x410349c6,0x41044124,0x496438e2,0x7b096246,0x62687b0a,0x62497aea,0x38c44106,0x40e34104,0x40e440c3,0x41044905,0x40e340e3,0x49244924,0x49244104,0x51664945,0x49454104,0x41654925,0x51c73103,0x6a087acb,0x490340e3,0x59c66a07,0x41034124,0x38e338e3,0x41244124,0x49a66a8a,0x59e738e3,0x41656228,0x59e74966,0x49864985,0x51c65207,0x6a4859e7,0x9bcd8b4b,0x726982a9,0x82ec82cb,0x41656a6a,0x28e130c1,0x8ac84983,0x82a79329,
-0x9bab9308,0x72678b29,0x934a7aa8,0x8b2a9bac,0x7ac882c9,0x83098329,0x82c872a7,0x9b8c934a,0x69e58ae9,0x936a8287,0x832a938b,0x72687aa9,0x828882a8,0x59e65a27,0x62274985,0x49a56a68,0x51c64144,0x9c0d8b6c,0x72e96287,0x7ae98b8b,0x6a2772a8,0x51a559c6,0x83ad5a48,0x5a68734b,0x732a730a,0x62686268,0x6a887ae9,0x72ea72c9,0x6a477ae9,0x41244964,0x9bee6227,0x9c2da46e,0x8beb942c,0x8beb8bcb,0xa48c944b,0x93ea9c4b,0x938a9beb,0x51a57288,0x6aca51c6,0x93ef7b4c,0xad33a4b2,0x9c91a4f2,0x940f9c70,0x83ad6b0b,0x6aea734c,0x7b4c62ca,0x83cd7bae,0xa4d19c91,0xb533acd1,0xa4f1ad32,0xad33acf1,0xad12ad33,0x942f944f,0x72a9730a,0x69e561e6,0xa3ab8b09,0x7ac79369,0x8b697ae7,0x8baa8328,0x7b488baa,0x7b288bca,0xa46d93eb,0x7b28a48d,0xa48d93eb,
-0xa40ca40c,0x93ec7ae8,0xaccf8b8a,0x6a868beb,0xb4cf93ab,0x72889bec,0x72c96247,0x734b6268,0x9cf19490,0x9cd19cd1,0x9cd1a4d1,0xad53ad32,0xa5129d11,0xa512a533,0xad12ad32,0xad12ad53,0x9cd1a4f2,0xad53a512,0xb4f1b532,0x7aec8bad,0x626972cb,0x498551a6,0x51c44984,0x834872c7,0x83487b07,0x93cc93eb,0x7b0a8b8b,0x30c251c7,0x38e438e3,0x49854144,0x498451a5,0x49a44964,0x49646247,0x41244124,0x41244124,0x51044904,0x410461a6,0x410440e3,0x51665165,0x41045145,0x410440e4,0x7aaa5165,0x51867aab,0x51a73082,0x41046a28,0x38e34104,0x49a538e3,0x49654986,0x38e34965,0x7aeb4966,0x59c872ab,0x59e830c3,0x4965728a,0x8b4d51c7,0x30e46249,0x6a495a08,0x496559e7,0x49044144,0x82ca59a7,0x49867acb,0x38e33904,0x410330a2,0xab6b7a47,0x8a678a67,
-0x72268a87,0x9b4b7a87,0x7a47934b,0x8aa78287,0x934a8ac8,0x8329938b,0x828782c8,0x7a677226,0x9b4a7ac8,0x7a8782c8,0x82877a87,0x8ae88ae8,0x9b299b6a,0x7b095a26,0x51c65a26,0x7ac97ac9,0x622751a5,0x8b8c6a28,0x5a058b8b,0x9bed6a88,0x51448b4b,0x6a687228,0x83cd5a48,0x9c50a4d1,0x626872ea,0x72c97288,0x72a97ae9,0x7aea6aa8,0x6a477ae9,0x412451a6,0x624859e7,0x93cc72ea,0x942c8beb,0x940b9c4d,0xa46c9c6c,0xa48ca48c,0x7aea9bec,0x498551e6,0x93cf5a08,0xb513b513,0x83cd840e,0xad339cb1,0xa4d2a4d2,0xb513acf2,0xacf2acf2,0xad12ad12,0xad33ad33,0x94909cf1,0xa4f1a4d1,0xad53ad32,0xa4f2a512,0x62eb9490,0xa470734c,0x59e58b8d,0x82876a26,0x7ac76a05,0x72a68b29,0x7b087286,0xac8eac4d,0x7b298b6a,0x9c0c9c2c,0x7b08940c,0xac4ca42c,0xa44ba44c,
-0xa40da40b,0xb4ae72a7,0x72e78baa,0x9c2ca46d,0x7b09834a,0x9bcd61e6,0x41647aa9,0x946f730a,0x9d11a4f0,0xa4f19d32,0xa512ad12,0x946f9cf1,0x94908c4f,0xa5129cf1,0xad53ad53,0x9470ad33,0x9c709c90,0x7b4c7b6c,0x9c509c70,0x8bad942f,0x51e86269,0x62485a28,0x59e559e6,0x8baa8b6a,0xa42c9bea,0x836a93cb,0x51e67aea,0x49664125,0x41044965,0x496430e2,0x7ac86206,0x7ac88b29,0x51845a05,0x59c65165,0x494551a6,0x51244905,0x49044904,0x490348e4,0x49244924,0x514540e4,0x518661a7,0x59a65186,0x59876a29,0x41044925,0x6a285165,0x51a64985,0x49666228,0x5a0838e3,0x7aec8b4d,0x49a638e4,0x30c44945,0x412538e4,0x38e44945,0x492530c3,0x30e34125,0x6a696208,0x38c259c6,0x9b8d6a49,0x4986728a,0x624851c7,0x30c24144,0x514440e2,0x8a477a06,0x82469267,
-0x9b298287,0xa38ba36a,0x9b2aab8c,0x82879309,0x728782a7,0x9329934a,0x7a8882a7,0x8b097a67,0x9b8b8b09,0x9309934b,0x72667a88,0x8aa78287,0x7a6692e8,0x5a0649c4,0x51e65a06,0x7aca7289,0x62064964,0x7ac9938c,0x7309832a,0x7ac872c8,0x51a56a46,0x72896a48,0x734b5a06,0x7b8c7b8c,0x834b83ac,0x830a832b,0x834b834a,0x624672c9,0x62276227,0x7aca6228,0x49856a49,0x7b0951c5,0x9c6d9c2d,0x942b942c,0x9c4c940b,0x9c0b9c4c,0x93ad9c0d,0x49257269,0x938d59e7,0x6aca8b6d,0x8bce6aa9,0x6aea7b8d,0x838d838d,0x9c0fa40f,0xacb1a450,0x730b93ef,0x9c5083ad,0x8bad6aea,0x940f942f,0x8c2f8c0e,0xad33a4f2,0x8c2f9c90,0x838c83ce,0x6a8872e9,0x72467aa8,0x82c759c4,0x62468b49,0xa3ec93ab,0x7b097ae8,0x83298b69,0x93cc938b,0x7b087ae8,0x93aaa44c,0x8b898b48,
-0x9beb93aa,0x93aa8369,0x72c78369,0x8b898ba9,0x93ab8baa,0x834a59e5,0x41436227,0xad118bee,0x94d0a4f0,0xad339cf1,0x83adad33,0x51e76aca,0x49c649a6,0x9c3062a9,0x9cb1ad13,0x7b8d9cb1,0x72eb5a89,0x5a077aeb,0x72ca6248,0x52075207,0x41455208,0x72ca4986,0x5a067ac9,0x83288329,0x8b8a8b49,0x72a8836a,0x52065a46,0x39044185,0x51a53923,0x62266a67,0x726751a4,0x83098b2a,0x6226832a,0x41233923,0x49254945,0x49455125,0x41044905,0x61a64904,0x49445145,0x51655186,0x49454965,0x41244124,0x51c66228,0x49444124,0x620851a6,0x59c651e6,0x6aaa7b0b,0x39253924,0x51e75a28,0x51e84986,0x39054986,0x49864145,0x41244145,0x49854986,0x41044104,0x38c338c3,0x390238c3,0x72ca59c6,0x9bae938d,0x39246228,0x30e138e2,0x69845103,0x71846143,0xabcca309,
-0x9309a3cc,0x82878287,0x82e882e7,0x9bcd7b09,0x82c89bcc,0x724461c4,0x9bac8b29,0x7ac8936b,0x8ac87aa7,0x82e87a88,0x8b6a834a,0x7a469309,0x8a8769a4,0x7b0a6267,0x62688b8c,0x72a959c5,0x496459c5,0x8b4b6206,0x8329832a,0x82e993ac,0x61e65184,0x51856227,0x7b6c4985,0x83cd9c70,0x7ae96aa9,0x7ac98b4b,0x6ac8832a,0x622651c5,0x7ac97b09,0x5a0759e6,0x59e66248,0x51e55a06,0x7b6b5a06,0x9c6e9c4e,0x9c4d9c6e,0x9c0d9c0c,0x7ac993cc,0x598659e7,0x61c75186,0x518551a6,0x5a0759e7,0x62276269,0x51a64985,0x51c65a07,0x5a0859e7,0x622851c6,0x6a896aaa,0x8bac7aeb,0x7b4c62a9,0x62a95247,0xb5539c90,0xa4d2a4f2,0x8c0e8c2f,0x93cd732a,0x7ac9832a,0x61e482e8,0x7ac77286,0x9bcb8b28,0x93ab8308,0x72c79c0b,0x93aa72c7,0x93aa8b69,0xa3eaa40b,0x7b068327,
-0x7b078b48,0x8b898b89,0x7b077b27,0x9c0b9c2b,0x9c0c93ca,0x72e87b09,0x6ac96aa8,0xa4d18bed,0xa512a4f1,0x734c9cd1,0x49c66aea,0x51a64164,0x9bae7aeb,0x5a077aeb,0x52076aaa,0x5a4841a5,0x416451e7,0x61c851a6,0x5a0759e7,0x49a651e7,0x416549a6,0x5a074986,0x5a065a07,0x7ae86ac8,0x51e472c7,0x836a6aa7,0x418472c9,0x39243123,0x498449a5,0x49a44143,0x83296246,0x8b6a938b,0x7ae993ab,0x414451a6,0x49454965,0x59c75186,0x41044925,0x59c64945,0x414551a6,0x51a74124,0x62286a69,0x51c651c6,0x498659e7,0x6a494986,0x51a672aa,0x49a63944,0x51a649a6,0x624951c7,0x416551e7,0x8b8e6a8a,0x392472cb,0x6a8a51a7,0x414551c7,0x59e751e7,0x41043904,0x5a075186,0x30e24164,0x390330e2,0x82eb59e6,0x51257a8b,0x48813861,0x828669a4,0x8aa78ac7,0x93098a88,
-0xabaca3ac,0x6a0592e9,0x9b6a7a46,0x9baba3cc,0x82a88ae9,0x8aa892c9,0x8b497aa7,0x934a9bac,0x61c582a8,0x934a7287,0x932a9bab,0x7a267a67,0x7a068247,0x624693ab,0x51c651a5,0x620751a6,0x518459c5,0x72886a67,0x72a87b09,0x834a8b4a,0x6a4751a4,0x51a5936c,0x940e6a68,0x83ac942f,0x622772e9,0x59a56a27,0x6a8851c5,0x7ae972c8,0x93aa8b4a,0x72878349,0x72a87288,0x622772a9,0x30c24164,0x7b2b51c6,0x940d836c,0x9c2d9c0c,0x834aa44e,0x492459c5,0x51864925,0x51854965,0x49444964,0x51a651a5,0x59e75185,0x61e77289,0x62286a69,0x728a59e7,0x5a076a69,0x7aca7aea,0x628993ad,0x7b6c5227,0xa4d29c70,0xa4f2b533,0x83cda4d1,0x730aacd0,0x8b4a5205,0x5182832a,0xa40c7286,0x62257aa6,0xac4c8b49,0x8328a40b,0xb4ce8b89,0x9389ac4b,0x9ba98b68,0x9bca8b68,
-0x72c793ca,0xa44c9beb,0x83078ba9,0xac4d9beb,0x6aa78b69,0x5226838a,0xa4b0730a,0x9cb1a4d1,0xad129cb1,0x5a89a4d2,0x51e63964,0x624851c7,0x938e6a89,0x72aaa3ef,0x49854985,0x49654965,0x51a54965,0x518659a7,0x51c74986,0x62486228,0x624949a6,0x49656228,0x7aea59e6,0x834a836a,0xa44c8b8a,0x72c893cc,0x5a065206,0x9bcd7aea,0x6a88830a,0x62466a88,0x72c76246,0x8b6a836a,0x62277ae9,0x61e64144,0x412451a6,0x726a61e8,0x49654945,0x39244945,0x51a64145,0x414551a6,0x49a64125,0x9bae72aa,0x39246248,0x8b8d6228,0x6a8993cf,0x5a483945,0x62898bae,0x93af72aa,0x49a67b2c,0x626951c7,0x39045a29,0x390430c3,0x28a230e3,0x310330c3,0x38e330e3,0x498538a3,0x41643944,0x59c56226,0x59a74964,0x40a35124,0x694450a2,0xab698a87,0xab8aab8a,0x7a669309,
-0x9b4a8287,0x8ae9930a,0x8ae8932a,0x82879309,0xa34a92e9,0x9b6ba38d,0x7a8682e9,0x8ac982a8,0x830982a8,0x8b097aa8,0x7a268288,0x930982a8,0x930aa36b,0x624793ed,0x7ac972c9,0x72896207,0x59e66207,0x7ac8830a,0x938b8329,0x6a678b4b,0x59c551a4,0x49646206,0x83ee7b2b,0x8bed7bad,0x6a8893ee,0x59c54944,0x7b0a6a68,0x7ae972c9,0x9beb938a,0x8b6993ca,0x7ac98b69,0x72aa7ac9,0x72ea72a9,0x5a4872ca,0x6aa851e7,0x7b2972e9,0x93ab8b8a,0x51867ac9,0x49444965,0x49856207,0x72ca5a07,0x49456228,0x59e759c7,0x51c649a5,0x51a651a6,0x6aaa7b0c,0x6a6959e7,0x93ee51e7,0x7b4c93ad,0x6aea83ad,0x8c4f630a,0xa4f2a4b1,0xbd73b513,0x5a679c70,0x8b8c6288,0x8b6a938b,0x938b8309,0x6266a3ec,0x83298349,0xa40c7b09,0x8b499bcb,0x72a693ab,0x7ae76aa6,0x9c0b8b69,
-0x8bca93ca,0x8b8aa46d,0x9bcb72a6,0x7ae87ae8,0x83299bcb,0x524772e9,0x9cb07b8c,0x9c91a4d1,0x94709c91,0x49e7734c,0x834d49a6,0x8b8d7b0c,0x51e67b0b,0x6a4951c7,0x496559c7,0x51865186,0x51864986,0x51c649a6,0x72aa6208,0x41456228,0x624951c7,0x622859e7,0x72ea832b,0x6a876287,0x8b8a6aa7,0x7b298b6a,0x7aea7ac8,0x93ad8b8c,0x6a8772e9,0x62666266,0x8b8a7308,0x834a8b8b,0x5a066aa8,0x51855185,0x59a65186,0x498651a7,0x51864125,0x59e7830c,0x51c74144,0x7aeb72aa,0x49a65a08,0x834d6248,0x5a088b4d,0x5a284985,0x6aaa6a8a,0x41a66269,0x392449a6,0x62695208,0x49855a28,0x41453124,0x394528c2,0x51c76a6a,0x5a284144,0x38e46228,0x59c74986,0x39035186,0x392330e2,0x72ea5a07,0x30a26228,0x388240e3,0x79c55103,0x8a867a25,0x92e89b28,0x82a78287,
-0x8ac98287,0x9b8c9b2b,0x934a9bac,0x82468aa7,0x82888267,0x8b2a9b6b,0x7a467a87,0x8ae98247,0x936a8ae9,0x82878309,0x72058246,0x82887226,0x7a26930a,0x7b09bcf0,0x59c549a4,0x59c659c5,0x59c661e6,0x8b4a6226,0x93ab72a8,0x5a0693ab,0x61c64964,0x5a0759a6,0x9c9093ef,0x7b6c8bee,0x72ca730a,0x62487b0b,0x414351a5,0x49a44143,0x6aa75a26,0x93aa8349,0x936a93ab,0xac4d93aa,0x8b8bac4e,0x72c872a8,0x62676267,0x51e56287,0x72e85205,0x6a89834a,0x72ca5a07,0x7acb5a27,0x62688bae,0x834c5a48,0x51e67b2b,0x838d51c7,0x93ce836c,0x9c0fa470,0x5a07730b,0xa47062a9,0xa4b1b4f3,0x6b2b732b,0x6b2b630b,0xad33a4d1,0xb512ad12,0x8badb532,0x72ea72c9,0xa42e834a,0x8b6a9c0d,0x6a6772a8,0x72c86a87,0xbcaf9c0c,0x7ae8936a,0x8b499c0b,0xa42c8328,0x8328ac2b,
-0x83496a66,0x72a7a46d,0xa3cc7ac8,0x7ae88b49,0x832a936b,0x5a885a87,0x9c707bac,0xa4b19cb1,0x83cea4d2,0x418549e6,0x8c0e5a48,0x9c50acf2,0x41c66289,0x520651c7,0x49a56a69,0x59e751c6,0x622849a6,0x9bcf836d,0x51a6832c,0x518659c7,0x62287269,0x62285a08,0x5a2659e7,0x6a876267,0x8bcb834a,0x6aa87b4a,0x7ae96a88,0x7aea836b,0x5a466267,0x7b4a6a87,0x838a8b8a,0x834a838b,0x51a56267,0x49655164,0x61e84104,0x59e77a8a,0x59e74104,0x7aebac0f,0x41444986,0x6a6951a6,0x416572aa,0x62694144,0x52075a08,0x414551c6,0x49863924,0x62496248,0x624949a6,0x7b0b7b2b,0x5a2851e7,0x62698b4d,0x72aa4165,0x49866aaa,0x8b4c6a69,0x41246248,0x8b6d6249,0x51a672aa,0x624859c6,0x390351c5,0x40e44104,0x48e338a2,0x9b6a7267,0x9ac8ab8a,0x824671a4,0xa3ccabab,
-0x82e8936a,0x932982e8,0x93099349,0x8b4a8b09,0x8308936b,0x8aa77a87,0x936b9b6a,0x7a8782a8,0x93088ae9,0x82879309,0x93097a87,0x72068ac8,0x71c67a06,0x72e99bed,0x728872a9,0x72887268,0x61e66206,0x7ac96a68,0x8b6a8b6a,0x49a46a87,0x51654964,0x5a284945,0x8c2fa491,0x7b6d7b8d,0x6aca7b2c,0x832c6a89,0x8b8d834c,0x7b2b7aeb,0x93cb838c,0x9beb9c2c,0x832793aa,0x5a246285,0x8b6a6a86,0xa46eac4d,0x9c0d9c0d,0x5a47836c,0x51c451e5,0x6ac949c5,0x7b4b8bed,0xacb17b4c,0xa450acd1,0x8befa4b1,0x732b5a89,0xb533a4b1,0xacf1b532,0x9c2ebd33,0x51e649e6,0xbd137b4c,0xa491acf2,0x6b4b8c2f,0x83ad736c,0xacd18bed,0xacf1b4f2,0xacb1bd13,0x7b4ba450,0x7b295a47,0x93ab8bab,0x6ac85a25,0x834a6246,0x7ae89bcb,0x9bcb8329,0xa42cac2c,0x9beb93aa,0x938ab46c,
-0x83296aa7,0x9bcc72c8,0x61e58b2a,0x9bac82e8,0x41836a87,0x8bed6ae9,0xa4d28c4f,0x9c70a4b1,0x62898bce,0x5a893144,0xad139c91,0x5a899c50,0x7b4c4185,0x5a6883ad,0x52276269,0x730b730b,0xa450730b,0x8baeacb2,0x51a6628a,0x6a486228,0x51c659c7,0x5a0659e7,0x93ac7288,0x8bab9bed,0x72e87b49,0x6aa86ac8,0x7b4a6ac9,0x62477b6b,0x62665a46,0x73296ae8,0x940c83ab,0x6aa8838b,0x59e66a88,0x498540e3,0x51854945,0x8b4d82cc,0x41044985,0x51865165,0x49455186,0x49444125,0x49664945,0x414449a6,0x41243924,0x49854165,0x28c24145,0x5a283924,0x626849a5,0x51e76a89,0x62694185,0x392472ca,0x39443924,0x390330e3,0x31033904,0x41454104,0x41854985,0x51c628e2,0x7aca6a68,0x8aeb8b4c,0x38624904,0x7a4748e3,0xabecabcc,0x7a0692e8,0x72457a26,0xa3ec82a8,
-0x9bccac2e,0x6a047ae8,0x8b097246,0xac2e9bac,0x72869bac,0x722561c4,0x9bac8ac8,0x8b09a3cd,0x69a36a25,0x8ae869c4,0xa38ba3ab,0x61648a88,0x488250e2,0x8b6ab4f0,0x59e65a26,0x62066206,0x620659a5,0x7b099bac,0x8b8b834a,0x49a472c8,0x51455185,0x6aa94945,0xacf29c70,0x940e9c91,0x72ea7b2c,0x8bae7b4c,0x6248830b,0x49c651e7,0x9c0d6ac9,0x8bc99c2c,0x93ca93e9,0x6aa68349,0x6a666a86,0x8b6a72a7,0x8b8c8b6b,0x8bab8b6b,0x73088b6a,0x5a676aa7,0x732a5a88,0xacb193ee,0xacf2b513,0xa4f2a4d2,0xad32acf2,0xad11ad32,0xbd51ad11,0x942db510,0x49a462a7,0xacd172ea,0xb533b533,0x8c0e8c0f,0x6b0a8bee,0xbd5383cd,0xacd0bd33,0xb511b4f1,0x836ca48f,0x7ae872e9,0x8bab5a46,0x83299c0c,0x7aa75a05,0x496272c8,0x8b6a6a86,0x7aa76225,0x832993ab,0x7b086266,
-0x72a99bcc,0x82e96206,0x59e56a47,0x59e55184,0x72c96205,0xa46fa490,0xacf2acb1,0x520783ad,0x49c63985,0x738c62a9,0xacf2ad13,0x5227730b,0x6aea4a06,0xacf29c50,0x946f946f,0x94909490,0xb512acf2,0x72eb9c2f,0x5a086269,0x51a65a08,0x62276a89,0x6aa85a07,0x7ae97b09,0x72e87b09,0x6aa7836a,0x62876267,0x7b2b72e9,0x62466aa8,0x52265a26,0x7b6a5a46,0x8bcc8bec,0x7b0a838b,0x49a56aa9,0x41244124,0x49454945,0x59e751c6,0x49454944,0x49654945,0x51c75166,0x49a66208,0x5a074124,0x72899bce,0x49a64144,0x8b6e7b0c,0x51a76a49,0x6a497b0c,0x41454985,0x39044144,0x38e23903,0x30e33904,0x414530e3,0x832c6a8a,0x62287aca,0x936d6a89,0x5a088b6d,0x834c6249,0x938d8b8c,0x496582eb,0x40c230a2,0x9ac85923,0x82269a88,0xa3ac92c9,0x9369a3ab,0x7ac89369,
-0x9bcb934a,0x7ac88b49,0xa38b9329,0x8aa89b4a,0x9b8a8ae8,0x9b6ba3cb,0x822792e9,0xa36b8287,0x828782a7,0x92c88267,0x82678287,0x69e68aa9,0x388148e2,0x938b93ec,0x6a4772c9,0x6a486a68,0x6a8861e6,0xa40d6a68,0x6287938b,0x498451e5,0x61a659c6,0x62075144,0x6b0a838d,0x940f83cd,0x52076aca,0x51e75207,0x6a6851e7,0x62aa6289,0x8bcd7b4b,0xacad942d,0x9be9b4cc,0x8b699bca,0x6a667ac7,0x62466a87,0x51e549c4,0x93ac72a9,0x8ba993cb,0x72e88b8a,0x52065a26,0x52063123,0xb5338bce,0xa4d1b533,0xad12ad12,0xad10ad11,0xacaeb550,0x836893ea,0x62677b29,0x8bad51c6,0xb533b4f2,0x8bedb513,0x838c7b8b,0x9c0d732a,0xb510bd31,0x93eca46e,0xbd52acd0,0x6267a44f,0x62264984,0x9b8c9bcc,0x82ea830a,0x51c57268,0x51a559a5,0x59c659a4,0x496451a5,0x59c551a5,
-0x494451a5,0x49444944,0x62064963,0x51c45184,0xa42e7b29,0xa44e9c2e,0x6ae9838c,0x41a551e6,0x62a851e6,0xa49093ee,0x8beea4b1,0x5a475227,0x940e836c,0xad32a490,0x9cf1ad11,0xa5129cd0,0x838d8c2f,0x72ca838d,0x51a74965,0x72aa6228,0x6aa959e7,0x59e572a9,0x72c86226,0x8b8a7b09,0x62a7834a,0x5a466288,0x6ac941e6,0x832a8bad,0x73097b09,0x7b6a83ab,0x9c6f83cc,0x72e993ed,0x59c75a07,0x41035165,0x412440e4,0x41034104,0x9bae6208,0x51a68b0c,0x6a494144,0x5a077aaa,0x62284965,0x62487b0b,0x51c649a6,0x5a0751e7,0x72aa6a89,0x51e76a68,0x7acb6a69,0x30e251a7,0x41453944,0x49c63964,0x520749c6,0x7b0b72ea,0x59e75a28,0x5a076269,0x620751a6,0x7b2c61e7,0x6a89836d,0x38c24924,0x8b2951a4,0x7a2482a6,0x8a268205,0x8ac979e6,0x9329abec,0x82a77a66,
-0x726682a7,0xa3ed934b,0x7a26932b,0x8a668a66,0x8ac88266,0x8aea9b6b,0x8a467206,0x69e58246,0xa38b82c8,0x71a57a46,0x698579a6,0x30a15103,0x30a230a1,0x7b09ac6e,0x5a2651e5,0x59c56a67,0x9bad51a5,0x72a89bad,0x72e98b6b,0x49644983,0x72476a06,0x496461c6,0x62885a27,0x9cb17b8d,0x940facb1,0x6a89834c,0x5a485207,0x5a496289,0x732b5a28,0xacaea44e,0x9bea9c2b,0x8b689bea,0x7aa77ae7,0x62467286,0x62476246,0x5a275a06,0x93aa8329,0x93aa93aa,0x72c88b6a,0x41846a88,0x6aca3924,0xa4d19c2f,0xb552b512,0xacefbd71,0x9c4b9c4c,0xa40aac4b,0x7ae89baa,0x49a451c6,0xbd3293cd,0xa4b0b532,0x7b6b8bed,0xa46e83aa,0x9c2cacae,0x9c4d9c0c,0xacafac8e,0x9c0eac6f,0x72a9832a,0x7ac951a5,0x82a97a88,0x51857269,0x6a276a27,0x61e75185,0x51a56a48,0x6a4859e6,
-0x516459c6,0x51847248,0x7ac959e5,0x62467288,0x6a875a05,0x836b93cb,0x6aa872c8,0x72e95205,0x8bac836a,0xa491acb1,0x41a5730b,0x5a486a89,0xad128bad,0xacf1ad12,0xa511ad12,0x944f9cb0,0x6aca9c50,0x62694144,0x838e834d,0x5a286249,0x6aa97b0b,0x6a875a26,0x83498329,0x83298b6a,0x72c87b09,0x7b4b6ae8,0x5a897b6c,0x5a2749e5,0x52065206,0x8c0d6ae9,0x836b9c4e,0x5a075a87,0x39034123,0x51a661e7,0x72695165,0x41446a89,0x8b0b6227,0x620872ca,0x49853903,0x5a076248,0x49654985,0x6a8a59e7,0x7b0b72eb,0x39446248,0x5a2849a5,0x51e749a6,0x41656228,0x72eb49a6,0x52276aca,0x6aaa6a8a,0x418551e6,0x51c75207,0x49a64165,0x416549c6,0x5a274164,0x8b4d5a47,0x41047aab,0x51233882,0x9b487a86,0x92e7a3a9,0x9b098aa7,0x9b09a34a,0x82a78287,0x9b49abab,
-0x936a8ae8,0x936ba38c,0x9b6b9b6b,0x92e88ac7,0x82879b49,0x8ac98268,0x8ac89309,0x92e88286,0x9ae992e8,0x82279b2a,0x388150e3,0x38c23881,0x38e338e3,0x6a87a44d,0x622751a4,0x6a276227,0x6a686227,0x93ac9bad,0x51e57b09,0x59c54122,0x61a57227,0x49444924,0x52064144,0xad129470,0x5a27838d,0x51a651c6,0x9c70730b,0x7b2dac71,0x49c85a29,0x8bcb5227,0x9c0aa46c,0xa44b9be9,0x7b279c09,0x5a046a85,0x5a065a05,0x62486267,0x72c86247,0x83087ae8,0x9bcc93aa,0x7ac97ac8,0x51a56a68,0x5a6849a5,0x93ed7b6c,0x93eb940c,0xbcacac4c,0xabc9a3e9,0x9b6ab42b,0x62467267,0x93cd6a87,0xb510b4d0,0x8bcca48e,0x8bab838a,0xb4aea44c,0xa4ada48d,0xb50facce,0x834aac8e,0x8b4a8b2a,0x622659c5,0x82c96a07,0x49437a88,0x61e659a5,0x6a075163,0x51647247,0x59c65184,
-0x6a0761c6,0x518561a6,0x6a477ac9,0x6a8772c8,0x5a0549c4,0x624672c8,0x938c72a8,0x8b6a93ac,0xa44d8bab,0x5a079bcc,0x49a54965,0x8bcd6aa9,0x9c6f944f,0xacf1a4d0,0x9c8facf1,0x834ca46f,0x6a895a27,0x5a286269,0x52086a89,0x6aa96248,0x51c56ac9,0xa40c8329,0x8b698b4a,0x7ae893cb,0x6a876a87,0x7b4b7329,0x62a9730a,0x51e65227,0x62885a05,0x942e836b,0x5a26838b,0x49a549a6,0x41244124,0x41044124,0x934c5165,0x4164938e,0x72a94144,0x49a67aca,0x62486248,0x5a284124,0x8b8d9bef,0x7b0b49a6,0x8b8e9bee,0x62488b4c,0x6a694985,0x5a275a08,0x5a076269,0x7aeb72aa,0x5a276268,0x6aaa6a89,0x836d5207,0x72eb93ce,0x836d72ca,0x5a4872eb,0x8c2d730a,0x830c736b,0x5105722a,0x79e66145,0x718279c4,0x8ae679e3,0xb42cac0b,0x72269329,0x826669c4,0xb44d9329,
-0x8b08a40c,0x72467a66,0x83087266,0xa3cc9bcb,0x7a66932a,0x69c46183,0xabcc9308,0x82a79b8b,0x616371e5,0x40a15923,0x38a13081,0x308238a2,0x308238c3,0x6a46938a,0x72676a26,0x5a0651a4,0x8b4a8b6b,0x8b6a6a87,0x51647aa8,0x61c65184,0x598561a5,0x49444924,0x59e651a5,0x62695a07,0x5a486aca,0x622859e6,0x624872aa,0x59c76207,0x6a8a5a08,0x62686aca,0x940c6ae8,0x9c4ba4ae,0x83a983a8,0x8baa8bca,0x93cb8b8a,0x6ac9836b,0x5a486268,0x8b6a6a88,0x938aa40c,0x72a77ac8,0x5a066267,0x39234985,0x49854144,0x8b6b6248,0x93ca9bcb,0xb44bac4b,0xa3eaa3ea,0x8308ac2b,0x6aa672c7,0xa46c9c0b,0xacada44c,0x7b489c4c,0xb4eea46c,0xa4cdb50f,0xacad9c4c,0x51a49c2c,0x624659e5,0x7ac96205,0x62276a68,0x72696207,0x6a068b0b,0x6a266a26,0x728851a4,0x59a67aa9,
-0x6a2859c6,0x51855145,0x496459e6,0x6a686a88,0x6a875a05,0x7aa86246,0x9bcca40d,0x93abac2e,0x6a4672c8,0x498551c4,0x8b8b6a68,0x940d6aa8,0xa4afacf0,0x940d942d,0xa46facb0,0x72a97b0b,0x72ca7aea,0x51c66248,0x62475a07,0x59e66a89,0x7b086a66,0x7ae772c7,0x9bcb93ca,0x72c88329,0x7b0a6246,0x6a88834b,0x62685207,0x73096aa8,0x836a836a,0x8b8b7b09,0x93aca42e,0x41446206,0x41034103,0x49244924,0x6a694965,0x620872aa,0x59e77aea,0x62074965,0x8b4c8b6d,0x834d72eb,0x6249936d,0x59e86207,0x412559c7,0x49454145,0x39033904,0x39244124,0x39033924,0x59e74124,0x936d7acb,0x6a698b4d,0x5a076248,0x39444165,0x418549a5,0x51c63123,0x7b4c8b8d,0x6a296269,0x40a25966,0xa2e871c5,0x71c48a46,0xa38a8a66,0x7aa69329,0x9b4a82e8,0x93499b8b,0x82c88b49,
-0xac0c9b8a,0x6a259349,0xabac82c8,0x8aa8932a,0x932a8aa8,0x9b099b2a,0x82678288,0xa36b9b0a,0x388269c6,0x38a23881,0x30a238c2,0x38a23081,0x38c338c3,0x622672a8,0x69e66a26,0x72a86a67,0x7b2a72c8,0x7ac8832a,0x59435164,0x62076a07,0x49444964,0x6a4859a5,0x7aeb7aea,0x7aeb72eb,0x6aca72ca,0x93ee8b8e,0x624972eb,0x62086a48,0x59e751c7,0x72eb6a69,0xa46f8bac,0x9cceaccf,0x9c6c9cce,0x8c0b8bcb,0x7308940c,0x7b096aa7,0x834b8b6b,0x5a047287,0x83296a65,0xa40d9beb,0x6a88830a,0x6a486228,0x72a972a9,0x5a056247,0xb46d8329,0xa40aac6c,0xb44bac4a,0xb4aca44a,0x93a9ac8c,0x9c2b8348,0xa48cacad,0xa48da46d,0xb4efa48d,0x9c0ca46d,0xa44da44d,0x62277b2a,0x51c572a9,0x830a9bac,0x6a677a88,0x496459e5,0x51a44964,0x62066206,0x59c54964,0x59c66207,
-0x49444964,0x62275184,0x518551a5,0x6a677289,0x62055a05,0x832a59e5,0x8b6b9bcc,0x59e56a67,0x496351a4,0x6a885a26,0xa44d6266,0xac8da46d,0xa48eacce,0x9c4da44d,0x93eda44e,0x59e66aa9,0x51c65a06,0x72a85206,0x59e57ac9,0x6a466226,0x7ae872c7,0xa40b93aa,0x72e88b69,0x626772a8,0x6a896a88,0x6a886aa8,0x6aa86a87,0x6ae772e8,0x93eb7b69,0x72c98bab,0x49645a06,0x49654124,0x51a66207,0x38c338e4,0x59e74145,0x62285a07,0x6a497aeb,0x624859c6,0x49c651a6,0x51c65a08,0x41253904,0x41454125,0x40e45165,0x59c74944,0x39444145,0x7aea72aa,0x41446228,0x59e75a08,0x30e330c3,0x41455187,0x416551a6,0x30a230e3,0x49a64965,0x836c5a27,0x7aec8b4d,0x724aa3d0,0x48e238a2,0x71c46143,0xa38a8266,0x7a467a66,0x82258225,0x9b2a8a87,0x9329ab8b,0x7a877a86,
-0x82878287,0xa36a9b49,0x82478ac8,0x7a268267,0x932a8268,0x930aa36c,0x69c57a27,0x49036165,0x38c238a1,0x30c330c2,0x38e43903,0x28a230a2,0x288130c2,0x82c96226,0x59e582c8,0x8b4a6206,0x82e99bcc,0x59e68b2a,0x61e64943,0x51e66206,0x51a551c6,0x72ca6268,0x72ea6a89,0x6b0a72ea,0x838d6aeb,0x730b9c70,0x49c65a28,0x5a2749e7,0x62285a28,0x72ca6a69,0x7b4b7b0b,0x9c4e940e,0x8bcc83ab,0x9c4da48e,0x93ab93ec,0x72e87ae8,0x72877ae8,0x62256246,0x7ae86a86,0x8b6a938b,0x9bcdac6f,0x72a97ac9,0x49a372a8,0x9beb51c3,0x9bcbbcce,0x72a57285,0x9be98327,0xac8cc50e,0xb4cea44b,0x9c2baccd,0xbd10a44c,0xac6ebcef,0x7b09ac4e,0x83097b09,0x49856267,0x830c6228,0x8b2c82aa,0x9bacb450,0x9baba3ec,0x72a77ac7,0x51a47aa7,0x518559a5,0x6a285185,0x59a659c6,
-0x51a47247,0x934a59c4,0x72c77266,0x6a868b49,0x83296a66,0x9bcb72c7,0x49836a87,0x72874983,0x6a678309,0x9c0c6a67,0x9c4c9c0c,0x940ba44c,0xa4ad9c4c,0x8bcb9c6d,0x8bac7b4a,0x5a066287,0x834b6247,0x6aa78b4b,0x830972c8,0x8b6a7b29,0x8b8a8baa,0xb48ea44d,0x7b098bab,0x7b0a7b0a,0x52066268,0x5a665a26,0x83496ac7,0x83cb8beb,0x72e883ab,0x5a265a46,0x6a686a68,0x51c66227,0x494551a6,0x51a76207,0x49654124,0x494551a6,0x51864144,0x41244124,0x41654144,0x72aa6249,0x498551c7,0x6a496a89,0x6a284945,0x51a67289,0x59e74145,0x41455186,0x41243903,0x62496a89,0x49a64165,0x51a65a08,0x41454165,0x624851a6,0x30a251a6,0x93ee5a48,0x5a6a834d,0x49455a29,0x48c240c2,0x92e769c4,0xa38aa38a,0x92c7abab,0x9ac78a45,0x8a679a87,0x92879ae8,0x7a469ae9,
-0x932a7a47,0xab8bab6c,0x8ae9a36b,0x8ac97226,0x7a2792ea,0x69e57a27,0x40e25144,0x38a138c2,0x30a238e2,0x28c230e2,0x310328c2,0x41853944,0x5a4849c6,0x59e57ae9,0x832a4122,0x6a679bcc,0x8b4b82e9,0x492361e5,0x62266a26,0x72ea5164,0xb491b4b1,0x93ee9c0f,0x730a834c,0x7b2c732b,0x940f7b6c,0x8bce9c90,0x6b0a836c,0x93ee6a89,0x732aa450,0x5a475226,0x62476288,0x6a876247,0x7ae972c8,0x8349834a,0x8b8a8349,0x83898bca,0x72e67b67,0x7ae86aa6,0x5a0672a7,0x72a86206,0x8b2b830a,0x938b9bac,0x62246a66,0x9bc98b48,0x62248308,0x8b49938a,0x6a8751c3,0x93cb93cb,0xac4db4cf,0xb4ae93eb,0xb4eec54f,0xbcadb4ce,0xa40b9beb,0x8b69ac4d,0x93498308,0x7aa88b09,0xa3cd82c8,0x61e56226,0x8b097ac8,0x8b498b29,0x59847246,0x61e67a89,0x6a075985,0x7aa76206,
-0x6a248ae8,0x830682e7,0x83266a84,0x7b258306,0x8b878b66,0x7b068367,0x7b086a86,0x6a875a25,0xb46fa40e,0x9bec9bed,0x62458349,0xa48d838a,0xa46da46c,0xac8fb4d0,0x62677b2a,0x832a6a67,0x51c472a8,0x9c2c7b09,0xa44e93ec,0x9beb8bcb,0xac8dac8e,0x940ca44c,0x5a467308,0x626772e8,0x62875a47,0x6ae762a7,0x9c4c83a9,0x7309940b,0x8b8b6ac8,0x8b8c9bed,0x6a8872ea,0x59e751e7,0x51a672a9,0x51a65186,0x49654965,0x51864946,0x51866208,0x6a4982eb,0x41654144,0x49854986,0x49654986,0x41444966,0x41244124,0x49653924,0xa43072aa,0x5207a450,0x62696249,0x28c24986,0x6a694124,0x49867b0b,0x418549c6,0x72ca3965,0x7b0b8b6c,0x832b72cb,0x72ec72ca,0x39055a09,0x61a540a3,0x7a057a47,0x89a379a3,0x928681e4,0xbc0ca3aa,0x81c6ab4a,0x8a877184,0xabecab8a,
-0x8247a34b,0x7a0679e5,0x7a687226,0x82a992ea,0x48e26185,0x30a140c1,0x30c22881,0x38c130e2,0x394430a1,0x5a4849a6,0x7b4c6aea,0x83cd83ad,0x526862c9,0x5a2559e5,0x7b09834a,0x9bcc7b09,0x61e68b2b,0x51844944,0x498451a5,0x7aca6248,0x8b8d834c,0x498572ca,0x626841a5,0x6b0a6aa9,0xac9183cd,0x730ba4b1,0x51e75a27,0x51c65a07,0x628751e5,0x9c2e838b,0x93ad9c0e,0x938c93cd,0x832a7ae9,0xac4ea42e,0x8b699c0c,0x9c0a7307,0x83689c2a,0x72c872e7,0x5a2672c8,0x62475a06,0x72e96a68,0x83088329,0x7ac772c6,0x7ac68328,0x93a972a6,0x8309a3eb,0x5a066226,0x51c551e6,0x8b6a6247,0xbd10b4ef,0xbceeb4ad,0xb4acc52e,0xa40aac6b,0xac2aa40a,0xac0bac0a,0x9ba9ac2a,0x62258b27,0x61e56225,0x49435184,0x7aa86206,0x62076a47,0x61c57288,0x62056a46,0x9bca8307,
-0x8b269388,0x938893a9,0xa40a9bc9,0xa42ba40a,0x93889bc9,0x7ae8a40b,0x83297b08,0x62266a87,0x7aea6aa8,0x7ae77ae9,0x93ca9c0b,0x9c4ca44c,0xac8ea48e,0x6287838b,0x834b832a,0x72a9832b,0x93ad93ad,0x62477ae9,0x7b096246,0xacafa44d,0x8b899c4c,0x62857307,0x838a6ae7,0x7b2a7b4a,0x7b4a838b,0x9c4e8bec,0x838a9c2c,0x72e962a8,0x49c6730a,0x41653924,0x522751c6,0x72aa6aaa,0x49665a28,0x51c749a6,0x41254986,0x49244945,0x59c738e3,0x938eac50,0x622859e7,0x6a69830c,0x7b0b51c6,0x49656228,0x51a651c7,0x5a0751c7,0x30e34985,0x39643924,0x8b8d8bae,0x62695207,0x49e77b2c,0x498528c2,0x49c66269,0x41655a07,0x7aea51e7,0x6a8a7aeb,0x6229938e,0x38a338e4,0x614448e4,0xbb499aa8,0x694181e4,0xab489aa6,0x92e7a349,0x8a878a67,0x8ac89309,0x8ae97266,
-0x9aeaa34c,0x50e271c6,0x49034903,0x304040e2,0x40c238a1,0x38c138c2,0x4a063923,0x72c96289,0x838d834b,0x62aa732b,0x6b0b5268,0x7b8c83ce,0x6b2b62ea,0x6a87938b,0x8b8b7b09,0x8b2a8b4a,0x51646a27,0x59a659a5,0x72c951c5,0x5a487b0b,0x41443944,0x6a896a69,0x49864985,0x72ca6288,0xac918b8d,0x9c0facb1,0x5a2872ea,0x5a276248,0x5a275a07,0x72aa6248,0x8b4c7b2b,0x62477aca,0x6a895a06,0x7b2a830a,0x41426226,0x7b093942,0x8b8a9c0c,0x62676a87,0x93aa7b29,0x5a2672e8,0x7ae972a8,0x7ae872a8,0xa42c8b8a,0x9bcaac6d,0xb48c9bca,0x9bccac4c,0xa40ea3ed,0x49a58b2a,0x728859e5,0x72e882e9,0x9baa8309,0xa40b9beb,0xac4ba42b,0xac09ac6b,0xa3e8a409,0x9bc69be8,0x9bc99386,0x72a7ac4c,0x7a8959e5,0x7aca932b,0x7ae959c6,0x59c46a26,0x9ba99baa,0xa40a93a9,
-0x9bca9c0a,0x938aa40b,0xa3ccb44d,0x936c832a,0x5a068b0a,0x51c57268,0x41634144,0x62464183,0x7b086aa7,0x8b888b89,0xb4ad9bea,0xacad9c2c,0x7b4aa46d,0x7b2a72c8,0x6a89832b,0x72a96228,0x834c9bce,0x5a276248,0x8b6b6aa8,0x9c2c940c,0x9c0ba46d,0x9c4b8bea,0x8bca9c2c,0x9c2c942c,0x940d838a,0x732a8b8c,0x5aa8730a,0x520741c5,0x5a076248,0x41a551c6,0x28c23123,0x5a483965,0x6a4a7b0c,0x496549a6,0x39044965,0x40e438a3,0x51864104,0x59e76208,0x41454985,0x51c64985,0x72aa6207,0x414449a6,0x51e772aa,0x8b8d5a28,0x6aaa8b8d,0x7aeb6248,0x28c249a6,0x838d41a5,0x49e77b8d,0x834d6289,0x49854985,0x6a486a69,0x6a696a69,0x622851e7,0x412559e7,0x40e340c4,0x612348e2,0x79c47984,0x9b488265,0x79e47204,0x920579c5,0x9b4a9288,0x8ac9a3ab,0x51447226,
-0x51235144,0x40c240c3,0x38a140c2,0x308138a1,0x518538e2,0x7b0b6a69,0x6aca7b0b,0x62a86268,0x7b6c8bad,0x7b8c6aea,0x8bce8bee,0x83ed83ee,0x8c2f944f,0x93ac8b4a,0x8b8b8329,0x59c5938b,0x59a55164,0x59c65185,0x836c8b8c,0x72aa6aca,0x59e76269,0x5a0749a6,0x49645a27,0x9c0f6248,0xa450b4d2,0x7b2c8bad,0x6aaa72ea,0x6a896a89,0x72ca6aaa,0x6a8972ca,0x6a6972a9,0x6a686227,0x49845a06,0x72c95a27,0x93ad7b2a,0x7b0a834b,0x51a56227,0xac8e8b8c,0x6aa87b29,0x93ac72e9,0x624672e8,0xa40e8b8c,0x72e9832b,0x8b4a6aa8,0xac4dac6e,0xb4ac9beb,0x8b69bcce,0x7ac87287,0x51c56a66,0x72886a47,0x51856207,0x6a2651a6,0x8b4a7aa8,0xac4b9bab,0xac6bac6c,0x9bc9ac2a,0xb48cac4b,0x83298308,0xc4f2b46f,0x51a6938d,0x72a87aca,0x72864963,0x93aab46d,0x9bcb8b48,
-0x8b2a93ab,0x7ac9a3ee,0x620782ea,0x49654965,0x41455166,0x59e64143,0x8329832b,0x8b898b6a,0xac6ca44c,0xb48d9bea,0xb4aea42c,0x7b09ac6d,0x9c0d8b8b,0x6a87834a,0x7ac96a68,0x6a877b09,0x6a676266,0x93cc8329,0x93ec93cb,0x9c2c8bca,0x93ea9c2b,0x93eb93ca,0x9c2c940b,0x8bab93cb,0x7b4a940d,0x49c662a8,0x5a283964,0x72aa72cb,0x72eb72ca,0x72eb72ca,0x93cf8bae,0x628a730c,0x52085a28,0x5a0851e8,0x728a5a08,0x62087aca,0x41244944,0x6a494144,0xac10936d,0x59c68b2d,0x51a651a6,0x7acb4965,0x51c66248,0x62695207,0x49c65a48,0x8bee62c9,0x62896aca,0x6249732b,0x72eb41a5,0x52078b8d,0xa4706269,0x6aaa7b2c,0x8b6d8b6d,0x6a4972ab,0x39044145,0x40c23903,0x69435103,0xa2a789e5,0xab69a328,0x8aa7a34a,0x79c57a06,0x61846984,0x40a25944,0x40a240a2,
-0x48e240c2,0x40c340e3,0x38e238a2,0x72695165,0x51e67288,0x838d72ea,0x52286aca,0x7b8c6aca,0x944f8c2e,0x8c0e8c0e,0x8c0f8c2f,0x840e840e,0x842e842e,0x938c7ac8,0x72a88bab,0x51a451a5,0x62076227,0x6a894124,0x8baea430,0x7b4c836c,0x62895a68,0x6aa95207,0xa4509c0f,0x7b4b93ee,0x5a686a89,0x6aa95a48,0x49c66268,0x5a2851e6,0x52075a27,0x51c55207,0x59e651e5,0x6a4751c5,0x5a066247,0x5a465205,0x62a86ae9,0x838d6ac9,0x72eb8b8e,0x62676a88,0x93cc6aa8,0x7b49a44e,0xa42c93ca,0x832a8b8b,0x8b6b93ac,0x72a77ae9,0x7b0972a8,0xb4ada42c,0xac2cac4c,0xb44dc4ce,0xa3ec936a,0x7ac9ac0d,0x7ac96227,0x41436a68,0x59a551a5,0x62476226,0xac2d8b4a,0x8b4a9bcb,0xac2dac2d,0x83298b8a,0x8b2b938c,0x72a96228,0x59e6938d,0x7b094984,0x5a057ae8,0x72886266,
-0x51a55a06,0x494451a5,0x51a55184,0x498559e5,0x8b2a6206,0x834a834a,0x93cba42d,0x93aa9beb,0x93898369,0x93aa93ca,0x7b299beb,0x7b0972a7,0x7b29834a,0x8bab834a,0x834a8b6a,0x8b69938a,0x938a8369,0x9c0b93ea,0x9c2b9c0b,0x8baa8389,0xa42ca44d,0x93ec93eb,0x7309838b,0x730a8bac,0x49e65a26,0x62695a68,0x838d6aca,0x6aca8b8d,0x5a285227,0x5a696289,0x5a685a48,0x62896269,0x732c6aca,0x6a8a7b0b,0x51e75a08,0x6a496228,0x412451c7,0x39043903,0x61e74965,0x620761e7,0x496561e7,0x93ce59e7,0x62276a89,0x7aeb7b2c,0x72eb6268,0x6aca7b0b,0x6aca5a48,0x6aca7b2c,0x7b2c6268,0x51c6836c,0x7b0c7b0b,0x7aeb6aa9,0x622972ca,0x51a65a08,0x30e33904,0x40c13903,0xa2ea7a47,0x79e49288,0x82258a25,0x596371e4,0x51235123,0x40814904,0x40e33861,0x40c240e3,
-0x38e340e2,0x30c238e3,0x38e338a2,0x49254903,0x6aa94965,0x52276268,0x628949e7,0x946f83cd,0x842e8c4f,0x842f8c4f,0x844f8c2f,0x842f842f,0x842f840e,0x72c88b4a,0x494259c5,0x8b2a6a27,0x41437288,0x834b49a5,0xa491acb1,0x5ac9734c,0x730b734c,0x834c5247,0x72eb730b,0xacb193ee,0x93efa490,0x8bce8bcd,0x8bad83cd,0x8bce8bae,0x8bcd8bce,0x93ac83ac,0x93ac8b8c,0x72a88b6b,0x6a876a67,0x83ac7b0a,0x5a8872e9,0x72eb6b0a,0x5a286aa9,0x51e749c7,0x93ad6a89,0x9c0d93cc,0x93caac8d,0xac6c9beb,0x836a93ab,0xa42e9bed,0x8b8ba44e,0x62666ac8,0x83086a66,0x8b298b49,0xc4afa3eb,0xa3cbac2d,0xb46db46d,0x938a8b6a,0x7287a40d,0x59e559e5,0x59e66206,0x59c651a5,0x938c6228,0x51a46a67,0x59e56a67,0x82eb51a6,0x49868b2d,0x59e651a6,0x49634964,0x49844984,
-0x49a44984,0x5a064163,0x5a045a05,0x8b6a7ae8,0x93899349,0x8b699bca,0xac6d93aa,0x62468b49,0x62466a66,0x83486245,0xa3eb9389,0x8b6993cb,0xa42c9c0c,0xac6d93eb,0x9beaac6d,0xa42b9bea,0x9c2b93aa,0x7b2793ea,0x8bca8ba9,0x8369ac6d,0x9c2d8b8a,0x5a0672e9,0x72ea832b,0x520751e7,0x7b0b6289,0x5a476268,0x8bcd836d,0x6b0a6aea,0x7b2c7b4c,0x6aaa6aea,0x5a696aaa,0x52285248,0x49a641c6,0x7b0b6289,0x7aeb7b2c,0x7b0b72cb,0x59e7834c,0x41454124,0x40e34944,0x61e75165,0x49455186,0x416551a6,0x624851e6,0x41855207,0x6a894986,0x41647b0b,0x72eb5a48,0x6aaa6aca,0x62a96aca,0x72ea6289,0x72ca8b8d,0x7acb6a49,0x6a29728a,0x41246228,0x41034145,0x40c24903,0xa34b69a5,0x7a06b36c,0x48a150e2,0x40c148c1,0x40c340a3,0x596640c4,0x39236208,0x59c630e3,
-0x412461c6,0x494538c3,0x38c24924,0x30a238e3,0x49a630e3,0x6aca5207,0x51e772ca,0x62c949c6,0x8c4f83ee,0x8c2f8c6f,0x844f842e,0x844f844f,0x842f7c0e,0x59e55a26,0x938b82c9,0x49637aa8,0x51e64984,0x940e72ea,0x62ea7b6c,0x8c0f83ce,0x6aaa62ca,0x5a48838d,0x62896aca,0x49e649e6,0x838d5a69,0x730b940f,0x4a075248,0x838d5a28,0x6aaa9c0f,0x62284145,0xb4b1b491,0x93cd938d,0x52687b4b,0x83ee6b2a,0x83ce738c,0x730c7b6d,0x6229626a,0x51875a08,0x59e651a6,0x49c44164,0x9c0c7ae8,0x93c99c0b,0xbceeac4c,0xa44da44d,0x9becac6d,0x8b8b9c2d,0x62066a46,0x59e561e5,0x6a4559e4,0xa40b7ac7,0x9bcab46c,0xbcad9bca,0x83289bea,0x9baba42d,0x8b4a7287,0x72a99bac,0x82ea8b2b,0x72a94984,0x51a56a67,0x7aeb6a48,0x49856a48,0x518551c6,0x832a7288,0x6a876a88,
-0x72c78329,0x83497b08,0xa44d9bcc,0x8b6b8b6b,0x9bcca42e,0x830982ea,0x59e672a8,0x41434123,0x6a6759e5,0x93a88307,0x9c099bc8,0xac8bac6a,0xa46ca44c,0x8b8a9c0c,0x834993ab,0x7ac87b08,0x6a876a67,0x72c9730a,0x5a455a26,0x940c6ac7,0x5a477b29,0x730a72ea,0x7b4c5a27,0x6acaac92,0x628941a5,0x8bee93ef,0x9c2f7b6c,0x8bce9c50,0x6b0a732b,0x732b732b,0x838d732b,0x838d83ad,0x730b8bce,0x49c65a68,0x41a54185,0x49e649c6,0x6a895a48,0x494551c7,0x49254945,0x51454945,0x59c75186,0x39034965,0x8b6d6228,0x6a698bae,0x834d6269,0x31034165,0x5a275a28,0x41643945,0x8b8d830b,0x6a8951e7,0x72aa6a89,0x51c66228,0x498651a6,0x38c44104,0x40c438e4,0x612448c4,0x69237144,0x59445903,0x41434102,0x39034123,0x30c33103,0x59e730a2,0x38e37289,0x390430c3,
-0x38e34124,0x516538e2,0x38e35166,0x518538c2,0x30e34965,0x394430c2,0x6aaa49c6,0x62887b4c,0x524749e6,0x736c5aa9,0x8c4e8c2e,0x842e840e,0x844f842f,0xa40d7b29,0x82c982e9,0x494382e9,0x8b8c51a5,0x8beeacd1,0x9c508bce,0x6aea838d,0x7b6c8bad,0x836c49e6,0x6248834c,0x51c65a07,0x5a074986,0x49e65a08,0x49a651c7,0x49864145,0x418551c6,0x41653944,0x72aa72ca,0x8bad6248,0xacf2a491,0x8c4f9cf1,0x94b18c8f,0x838d9cb1,0x72cb6aaa,0x5a076a8a,0x62276a48,0x59a56206,0x40e24964,0x830851a4,0x93aa93aa,0xac6ca42c,0xacad9c0a,0x940bb4ad,0x9bab9bec,0x6a6751c5,0x5a056246,0x61e559e4,0x7ac86a46,0xac0c9349,0xa3eb9bcb,0xac4bc4ce,0xac4ca3eb,0x938aa3eb,0x59a5832b,0x72897ac9,0x72a96207,0x7aa88b4b,0x624751a4,0x6a476206,0x9bed8b4a,0x93cb93ab,
-0x8baa9bec,0xa42da48e,0x8b8b8b6a,0x6a887b0a,0x51c55a06,0x38e259e6,0x62253902,0x72c77ae8,0xa40b8b69,0xa44b9bea,0xac6c9c09,0x93ca9bea,0xa42c93ea,0x7ae89bec,0x6a866a86,0x59e66206,0x72ca72a9,0x51a66207,0x62886207,0x62686288,0x8bad7b2b,0x72ca7b2c,0x5a476aca,0x732b41a5,0x5a48732b,0x7b6b5a68,0x62a97b2b,0x9c9183ad,0x5227734c,0x5a685207,0x62ca5aa9,0x5a896aa9,0xa491836c,0x6aeb83ad,0x62a962ca,0x62895a89,0x62496269,0x41456208,0x49454104,0x40e44945,0x51a64925,0x41244124,0x51c64965,0x49a651c7,0x72cb6229,0x51c649a6,0x72ca93ad,0x834d4165,0x5a089bee,0x834c51e7,0x5a077aeb,0x830c8b6d,0x7acc830c,0x38c44905,0x38c338a3,0x50e240c4,0x50c258e2,0x40e348a2,0x39034123,0x41444985,0x38e43904,0x38e338e4,0x412538e3,0x38e34925,
-0x410438e3,0x40e34104,0x38c340e3,0x724938c2,0x49246a28,0x38e33904,0x28a228c2,0x49a630c2,0x5a486289,0x6aea5a48,0x8bee838d,0x8bee8bef,0x7bce8c0e,0x938c49e4,0x7a879b6b,0x620669e5,0x8bad7aea,0x9c9083cd,0x5a69838d,0x7b2c62aa,0x624872eb,0x72aa7acb,0x728a6a48,0x59e76a69,0x5a2851e7,0x5a0751e7,0x6a896249,0x7aeb7aeb,0x730a72ca,0x7b2b7b0a,0x39235a27,0x49c649a5,0x9c70732b,0x7bcd9470,0x8c6e7bed,0x734a7bcd,0x72e96b0a,0x6a676ac8,0x49846205,0x61c64964,0x61c66a27,0x49645165,0x62254944,0xa40b9bea,0xbccdb4cd,0xac6ba44b,0xac4db4ce,0xb4b0a40c,0x830a9bcc,0x5a077289,0x59e659c5,0x620659c6,0x8b297287,0x93a993aa,0xb46c9be9,0x6a45ac0b,0x8b0a6206,0x59856227,0x7ac96a67,0x51a36225,0x8b6a72a7,0x72879bcb,0x6a6759e5,0x7ae96225,
-0x72e99bcc,0x72c96288,0x416449a5,0x49644985,0x49a44184,0x72c751a4,0x7ae88309,0x9c0b938a,0x93889bc9,0xac4d9bca,0x7ae88309,0x834a9bed,0x5a255a26,0x9bec832a,0x7ae98b8b,0x62066a67,0x7aea6226,0x72aa8b6d,0x49c64165,0x72ca6269,0x628972ea,0x834c72ea,0x7b4c72eb,0x6aea8bac,0x5a485226,0x41a65227,0x72ea5a68,0x6b0b5228,0x732b7b8d,0x6aea5a89,0x6aca6b0b,0x6aaa6289,0x62c96aea,0x83ce6aea,0x7b6c8bee,0x944f7bad,0x7b0c8bce,0x62096a8a,0x41044945,0x59a759c7,0x51654103,0x51856228,0x51e73924,0x62696269,0x6a8a6a8a,0x39444145,0x418559e7,0x51e64165,0x392449c6,0x626949a6,0x51a76248,0x59c751a7,0x494659c7,0x38e438c4,0x38c338e4,0x40e24104,0x49244103,0x59655145,0x494440e3,0x498672aa,0x412538c4,0x38e35126,0x72694124,0x390482cb,
-0x726951a6,0x308259a7,0x410438c3,0x41034125,0x40e34104,0x496538e3,0x39044986,0x49653103,0x31033903,0x41853944,0x49e741a5,0x52075227,0x52275228,0x8b6b4983,0x7aa8a3cc,0x51e651a4,0x940e730a,0x940fbd53,0x6a8862a9,0x51c76228,0x7aab6249,0x7aeb72aa,0x8b4d8b2c,0x9c0f93ae,0x9befa430,0x9bef93ef,0x7b0ca430,0x51e76a6a,0x51e54985,0xac8f7b2a,0x8beea4b0,0x62aa5a88,0x9cb18c0f,0xa4d29cd1,0x524783ac,0x7b6c730a,0x6268730a,0x51a45a06,0x728759e4,0xac4e9bab,0xac2da3ec,0x6a889bcd,0x51c549c5,0x620649a5,0x7aa8832a,0xabcb82e9,0xac0bac0c,0xac2cbcae,0xb46eb46d,0x6205832a,0x72886a47,0x59c66227,0x5a2659e6,0xac8e93ec,0x9becbd10,0x7ac96246,0x5a067b2a,0x51e651c5,0x414449a5,0x9bed6a68,0x9badb470,0x5a06832b,0x59c651c5,0x518551a5,
-0x59c651c5,0x41645185,0x62276a68,0x7b2a7b0a,0x8b8b7b2a,0x834a7b09,0x9bec9bcb,0x624672c8,0x59a36205,0x72a86206,0x8b6b9bcd,0x936c9bad,0xac2da40d,0x938a93ab,0xac4da3eb,0x834aa42c,0x52066aa8,0x6aaa5207,0x93ce7b2c,0x62889c0f,0x8b6c5a27,0x5a06834b,0x626851c5,0x9c0f832c,0x93aea430,0x730c7b4d,0x6aca6aea,0x52476aca,0xa491a491,0x8bcea491,0x732b730a,0x52676b0a,0x62a95267,0x83cd62e9,0x9cb19c90,0x8c2f9cb1,0x5a4962ca,0x6249834d,0x40e34924,0x51665146,0x49254104,0x72697269,0x410451c6,0x72896228,0xa431834c,0x72aa6aaa,0x5a688bae,0x8b8d6289,0x522772eb,0x7b0c7b0b,0x938e6249,0x8b4d93ae,0x39046229,0x38e44125,0x390438e4,0x41244124,0x41444104,0x59c759c7,0x41044124,0x39044945,0x412430e4,0x49454945,0x41044944,0x30e44124,
-0x51c64124,0x412459c6,0x82cb4985,0x41257acb,0x498530c3,0x51a65185,0x412551a6,0x41243904,0x41243104,0x390438e4,0x30c33104,0x30c328a2,0x30c330c2,0x6a664183,0xac2db46f,0x41846206,0x8bac6ac9,0x732b8bcd,0x626972eb,0x728a6a68,0x5a2859c7,0x93ae93ce,0x72ea7b0b,0x62696aca,0x49c65a28,0x51e741a6,0x6a8a5a28,0x6aaa72ea,0x5a276228,0x7b2b6288,0xa4f083cd,0xa4f1b552,0x83ee9c90,0x6b0b732c,0x626962aa,0x5a686289,0x62475a27,0x938a7ae8,0x83088b6a,0x6a66938a,0x7ae86245,0x62477ac8,0x51c551c5,0x82ea72a9,0x6a276a68,0x7a676a06,0x72a67aa7,0xa3ea8b28,0xa40bac2b,0xac2cac2c,0x8b49a3eb,0x834972a7,0xbcce938a,0xac8eac8e,0xacaeacae,0xac6eacae,0x93ab8bac,0xa42ea40d,0x62267b09,0x9c0d7ae9,0x830aa3ed,0x7ac96227,0x7ae96a67,0x51c47288,
-0x498559e6,0x72a94985,0x728893ad,0x834b7b2a,0x62666aa8,0x394249c4,0x6a6759e4,0x7ac95a26,0x8b4a8b4a,0x7ac9832a,0x6a477b0a,0x62277ae9,0x51c551c5,0x7b095a06,0x9bec8b4a,0x9bec9c0c,0x8b8c9bec,0x626872ea,0x62485227,0x832b62a9,0x62267b0a,0x62475a06,0x62486247,0x6aaa6a8a,0x5a696269,0x62aa62a9,0x6aaa6289,0x62a972ea,0x62895248,0x732b72ea,0x7b4c7b4b,0x5a686aea,0x52474a26,0x738b5ac8,0x9470944f,0x94709c90,0x6a8a6b0b,0x7aec8bae,0x41255187,0x41054125,0x41044925,0x40e340e4,0x49854144,0x41854164,0x62696249,0x62695207,0x51e76aaa,0x836c72ea,0x41a56aca,0x7b2c51e7,0x5a0872cb,0x51a75a08,0x38e43904,0x39044104,0x41044105,0x49454124,0x41453904,0x61e761e7,0x412430e3,0x51a66a89,0x516530a2,0x51866208,0x390330e3,0x38e34145,
-0x728a30c3,0x518672ca,0x51a630c2,0x4145728a,0x51a63903,0x49856228,0x496530c3,0x30c259e7,0x82ec4965,0x286151a6,0x496538e3,0x30c24925,0x30a238e3,0x59e47b29,0x832a72a8,0x49845a06,0x9c706ae9,0x6aca944f,0x8b6d6aaa,0x49657b0b,0x6a8951a6,0x5a286249,0x49c649c6,0x520751e7,0x7b6c6289,0x72ea838d,0x62896ac9,0x5a276268,0x62495207,0x6aca6aaa,0xa4d18bee,0x736b840d,0x838d7b6c,0x8bce838e,0x8bad8bae,0x9c0e93cd,0x8b699bec,0x7ae88329,0x49836225,0x6a464942,0x728782e9,0x8b2a7ac9,0x49857289,0x59a651a5,0x61e659e6,0x61c461c5,0x6a2461e4,0x72856244,0xb42c8b27,0xa3eb9baa,0xb46db46d,0xb46cbcad,0xb4ada42b,0xac2ba44b,0xa44b9c0a,0x8b8aac6c,0x9bcb93ab,0x62257ae8,0x51c451c4,0x59e451c4,0x51e459e4,0x93ab8309,0x9baba3ec,0x9bec9bcb,
-0x62478b6b,0x51a54944,0x59c551c5,0x62265184,0x5a266267,0x8b6b7ae9,0x9bed834a,0x93ac93cc,0x5a067ac9,0x49a45a46,0x520651e6,0x51c649a5,0x834c6268,0x51c5834c,0x5a0551e5,0x7ae95a05,0xa42d9bec,0x62468b6a,0x62885a26,0x624772c9,0x5a275a27,0x72a96247,0x8bed8b8c,0x52277b2b,0x734b62a9,0x6ae96aea,0x7b8c83ad,0x524741a5,0x7b4c732b,0x52276aea,0x49e641a6,0x396441a6,0x5a884a06,0x940e838c,0x944f9c70,0x5ac9734b,0x8bef8bee,0x5a2962a9,0x392451a6,0x49244105,0x59854924,0x41245165,0x518659c6,0x51c63923,0x7acc7aeb,0x5a0730e2,0x392449a6,0x832c6249,0x5a076a69,0x6a89830b,0x830c7acb,0x41246228,0x38e430c3,0x38e44125,0x39043904,0x494538e3,0x39044124,0x49654945,0x40e338e3,0x390338e3,0x49454965,0x390438e3,0x38e34124,0x6a284104,
-0x41446228,0x41243924,0x59e738e3,0x412472aa,0x82eb3924,0x39036249,0x832c6248,0x498559e6,0x41654986,0x28c230e3,0x39043904,0x30a238c3,0x28a228a2,0x62468b8a,0x59e55a06,0x8b6c5a27,0x83ae93ee,0x940f9c2f,0x5a077b2b,0x59c749c6,0x62486227,0x5a076247,0x72ea5a27,0x9c50940f,0x6b0a83ad,0x7b4c730a,0x836c836c,0xacb19c0f,0x8b8e9c50,0x8bae8bae,0x62c9730b,0x940f730b,0x5227838d,0x522751e6,0x51c549c5,0x9bec7b09,0x5a458b8a,0x51c44982,0x7ac86205,0x82e89beb,0x59e46a45,0x9b6c6a46,0x6a479bcd,0x59a64964,0x59e661e6,0x59e559c5,0x61e559e5,0x61e561e5,0x72467286,0x72676a05,0x7aa77a87,0x936a8b29,0x7aa68b28,0x6a456a45,0x62456a44,0x72866a65,0x7b087b08,0x83086245,0x83299bcb,0x72a772a7,0x72666a66,0x5a0559e5,0x8b697ac7,0x72a87ae8,
-0x7ac88b4a,0x82e96226,0x938b830a,0x832a8329,0x9bec9bed,0x62477b09,0x62676247,0x51e65206,0x62885a68,0x730a5207,0xb4d1b4d1,0x5a69838d,0x8b8e6acb,0x72eb8b8e,0x7b0a6228,0x51a451c5,0x93ab7ae8,0x8b6a9bcb,0x7b088308,0x6ac86aa8,0x6a886aa8,0x5a276268,0x6aa95a68,0x8bcd6ac9,0x5aa86b09,0x6b2a6b0a,0x942f736b,0x83ad9cb0,0x62896aeb,0x62a962aa,0x9c4f7b4c,0x838d940f,0xacd1a490,0x9c2e9c4f,0x9c70940e,0x9c70a491,0x83ae942f,0x52276aca,0x496549a6,0x41254145,0x59864945,0x39035186,0x830b5165,0x39036a49,0x62075a07,0x832c3924,0x41246a28,0x728972aa,0x49864144,0x30e359e7,0x390430e3,0x30c33904,0x38e338e3,0x494538c3,0x51665166,0x30c24104,0x7aab7a8a,0x40e34124,0x59c759c7,0x49454104,0x728a82eb,0x59c64104,0x59a682cb,0x832c3904,
-0x622893ae,0x5a083082,0x414472ca,0x6a693923,0x49865a07,0x6a8a5a08,0x39445a28,0x59e74164,0x31036249,0x622849a6,0x30a24966,0x390428a2,0x412559e8,0x7ae8bccf,0x51c54983,0xac708b2b,0x6b0b93ee,0x5a6962c9,0x62295a28,0x7b0b72aa,0x5a286aaa,0x49c651e6,0x520751e7,0x5a685a27,0x7b4b6aca,0x730b7b4b,0x62895a89,0x5a685a48,0x730b62a9,0x62a9732b,0x7b4c4a27,0x8b8da470,0x5a276248,0x72c96288,0x6a8672a8,0x624672a7,0x51e449a3,0x72c75a25,0x8b499bcb,0x9bcb938a,0x7aa8938a,0x82e96226,0x830aa3cd,0x51c54123,0x51a551a5,0x6a686227,0x6a286a48,0x72486a48,0x62077a69,0x61c661c6,0x7a886a07,0x59c57288,0x59c559e5,0x934a8b2a,0xa3ec9b8b,0xa3eca3cc,0xac2dc4cf,0xa42d938a,0xac2da40d,0xa3cbac2d,0xac4dac2d,0x8b6bb46f,0x9bab7ac8,0x62468309,
-0x934b832a,0x83097ac9,0x6a8782e9,0x62267287,0x498451c5,0x31024123,0x8bad49c5,0xa4919c2f,0x7b4c9c71,0x62c95227,0x8bad940e,0x5a698bee,0x8b8f5208,0x730c9c10,0x7b0b62aa,0x51c56aa9,0x7ae851c4,0x9baa9beb,0x8b698328,0x72a87308,0x72a86aa8,0x8b8c8b4c,0x836b7b4b,0x6b29732a,0x8c0d83ed,0x83ac7b8c,0x6b0a7bad,0x732b5a69,0x734c8bef,0x6aeb62aa,0x6aeb6aeb,0x83ae83ae,0x5a686aca,0x5a885247,0x62896aca,0x732b62ca,0x62ca62ca,0x9c50838d,0x49867b0b,0x39043924,0x51654124,0x41044104,0x410438e2,0x39044124,0x30c338e4,0x59c74104,0x49444104,0x496561c7,0x38e330a2,0x39043904,0x412538e4,0x30c33904,0x59c73904,0x38e359c7,0x6a2861c8,0x410440e4,0x59c759c7,0x39034925,0x41444965,0x49444104,0x6a497aaa,0x41244104,0x61c76208,0x496538e3,
-0x59e87289,0x72ca30a2,0x7289a3ef,0x832c3944,0x4166832c,0x93ce7b0c,0x39436a88,0x6aca5207,0x39246a8a,0x51a651a6,0x51a64145,0x41244986,0x51a66a49,0x832a9c0d,0x5a0651c5,0xac709bce,0x62aa72ea,0x732b7b2b,0x72cb5a48,0x836d938d,0x93ce834d,0x8b8d9bef,0x83ad8bad,0x9c50940f,0x8bce93ee,0x8bce93ef,0x730b7b4c,0x732b7b0b,0x9c2f838d,0x9c2f9c70,0x838d8bee,0x62697b4c,0x6a685a07,0x6a477289,0x59c56a47,0x49834963,0x8b6951c3,0x8349a42d,0x93cb8329,0x72a793eb,0x62666246,0x59c559e5,0xa3ee82ea,0x51856a27,0xa40f6a68,0xbcf2b4d1,0x8b0cb491,0x830b6a49,0xa3afa3d0,0x62076a49,0x6a087269,0x59c661c7,0x69e661c6,0x62076a27,0x72686a07,0x72887288,0x62277268,0x62066227,0x72686206,0x6a277268,0x72486227,0x72687289,0x72887288,0x61e66a47,
-0x59c559a5,0x61c66227,0x41234943,0x41234123,0x41244164,0x834b49c5,0x6aa98b6c,0x9c0f9c30,0x8bef6aca,0x5a48acd2,0x83ad5207,0x628a838d,0x6acb5228,0x8bef93f0,0x5a485228,0x9bee9c0f,0x51c46aa8,0x832959e5,0xa40bac4d,0x83289bca,0x6a688309,0x7b0a6aa9,0x62a96aa9,0x7b8b83cc,0x62c962e8,0x62e962c8,0x7b4d730b,0x7bad83ad,0x83ad7bad,0x7b6d8c0e,0x5a695a8a,0x5a895a8a,0x5a685268,0x5a885268,0x62c962a9,0x62a96289,0x83ce734c,0xa4b1942f,0x6a8a9c50,0x51a64145,0x41244965,0x726961e7,0x39034965,0x49654985,0x40e44104,0x38c338e4,0x40e34925,0x41244104,0x30e338e3,0x41043904,0x39044104,0x38e34125,0x72494966,0x41036228,0x49454945,0x39034124,0x830b6a69,0x38e46208,0x59c74965,0x39044965,0x38e34123,0x6a2859e6,0x41244124,0x39244985,
-0x62286228,0x41653924,0x5a286a69,0x5a0730e3,0x39245a07,0x7b0c5a28,0x41856aaa,0x7b2c49e6,0x39245a28,0x62485a28,0x62284165,0x30c372aa,0x62484165,0x9babb4af,0x41436226,0x93ee6268,0x8beea490,0x7b6c8bce,0x624872ea,0x5a285a07,0x62296269,0x6a8a49a6,0x6aa97b2c,0x5a485a48,0x62695a28,0x838d7b4c,0x836c93ef,0x72eb6a8a,0x72eb836d,0x52265a26,0x5a2641c5,0x9bcd9c0d,0x72a9834b,0x49244964,0x49444924,0x938b4943,0x6aa67b08,0xac8d93ca,0x8b8a9c0c,0x7b096286,0x9bcc93ab,0x8b6a93ac,0x7aa97ac8,0x51c58b6b,0xc5337b0a,0x6b0bac91,0x830b6aca,0x620872aa,0x7b0b6208,0x6a48830c,0x7aca59e7,0xa3ef9b8d,0x59a58b2c,0x62276206,0x61e659e6,0x62076a27,0x830b6a48,0x61c66a48,0x6a286207,0x516559c6,0x51865985,0x59c751a6,0x7a896a28,0x49455a07,
-0x6a2861c6,0x62076a27,0x49255186,0x7aca51a6,0x41246a68,0xac916aa9,0x7b4cacb2,0x5a895207,0x9c51940f,0x730b7b8d,0x5a285208,0x9c4f836d,0x62aa6aca,0x62a97b6d,0x62c95a48,0xb4d2b513,0x6aa96aa9,0x62487b2a,0x83286246,0x93899bca,0x6a678329,0x51c64963,0x7b2a72e9,0x62a87309,0x732a7b6b,0x52275a68,0x52085a48,0x52685208,0x840e736b,0x8c2f8bee,0x94309450,0x8c308c30,0x83ce9450,0x9c509c50,0x6b2b83ad,0x734b730b,0x4a4762ea,0x944f62e9,0x7b4cb4d2,0x49654165,0x41044965,0x59e74944,0x30e24144,0x59c759c7,0x38c44104,0x38c338e4,0x38e44104,0x410438e3,0x41044104,0x390338e3,0x62084124,0x49a66a8a,0x496630c2,0x390459a7,0x7aaa4945,0x39036208,0x728a5186,0x30c36248,0x41244124,0x6a894945,0x288151a5,0x8b2c6a69,0x496559e7,0x518672aa,
-0x41244124,0x52076248,0x51c73103,0x41646248,0x62684165,0x52074185,0x51e76289,0x940f6aca,0x39457b2c,0x7b0b6aaa,0x6a896248,0x51e67b0c,0x51a63924,0xac6e9bed,0x494472c9,0x730a5185,0x8bada470,0x51e66aa9,0x6a686227,0x6a8a6a89,0x41455207,0x626951c7,0x7aeb72ca,0x52276a89,0x6aaa6268,0x730b6aaa,0x9c308b6d,0x6aca93cf,0x62696269,0x838c6ac9,0x834a8bac,0x72887ae9,0x49646a27,0x49254924,0x51654945,0x83094123,0x5a658b6a,0xa44d72e8,0x836aa46d,0x8bab5205,0xac6da44d,0x938b9bec,0x93aca3ed,0x62266a26,0x836c6a88,0x8c0e93ce,0xbd12acb2,0x834b9bce,0xbcd18b8c,0x830bbcd1,0x72aa51c6,0x72a98b0c,0x82eb6a68,0x59c66a68,0x72896a68,0x7aea7289,0x7aca6a48,0x518661c6,0x61e65186,0x62086a28,0x598651a6,0x82ca6a28,0x7acb8b0c,0x496459c6,
-0x59c76208,0x41055186,0x51864125,0x728a7aaa,0x59e751c7,0xa43072ca,0x628993ce,0x62895a89,0x838e6aca,0x93af942f,0x52086269,0x8bce93ee,0x5a487b4c,0x9c9062a9,0x62a99c50,0x7b6c838d,0x5a486aa9,0x93ad8b8d,0x62255205,0x93aa7b48,0x9bab938a,0x5a268329,0x72e95a27,0x5a676aa8,0x52265226,0x5a685207,0x6acb6aaa,0x7b8c730b,0x83cd8c2e,0x62ea7b6c,0x7b8d62eb,0x732b7b8e,0x8c0f9410,0x942f944f,0x8c0e8bee,0x62ca83ad,0x7b8c6b2a,0x83cd6b2a,0x8baeacd2,0x392449a6,0x49454966,0x41244945,0x41444144,0x41044104,0x41254104,0x40e440e4,0x38e44104,0x410438e4,0x59c64124,0x41036228,0x49864124,0x394451a6,0x51c630c3,0x39036228,0x414538e3,0x39244165,0x38e33904,0x6a4849a6,0x30e35a07,0x9bef4986,0x4165832c,0x6a894185,0x41446269,0x7aeb6207,
-0x39244985,0x7b0b832b,0x62483903,0x49869bcf,0x6a8951c6,0x62694184,0x52077b0c,0x730b49c6,0x49c6834b,0x72cb72ca,0x394451e7,0x6a6951e6,0x416551e7,0x9bcd9bec,0x59e56a67,0x6a886247,0xacb093ed,0x834b836b,0x6226830a,0x7aea6227,0xa46f9bee,0x93ad834c,0x7b0a8b8d,0x8b6b72ea,0x8b8d938c,0x5a088b6c,0x7b0b4985,0x6aca836d,0x93ad72ca,0x6ac88b8c,0x936b8bac,0x414359e6,0x51854984,0x51645185,0x41044104,0x832b3903,0x6a679bac,0xac6d7309,0x8b8aa42d,0x9c4d5a25,0x9c4d9c2d,0x72879c0c,0x622651c4,0x7b0972a8,0x9c2f6247,0x838d9c0f,0x8bcd9c50,0x9c0e6aa8,0x6aa97b4b,0x836c6248,0x6a68834c,0x7aca7aca,0xac2f7aea,0x82ebb491,0x518551a6,0x5a075185,0x59c56a48,0xb450830b,0x72699bae,0x7acb82ca,0x934d6a28,0x72696a28,0x51856207,0x51a651a6,
-0x7a8a61e7,0x61c77249,0x518659c7,0x41244986,0xa45172aa,0x49c6836d,0x7b2c5a68,0x626872ea,0x628a5a48,0x8b8f730b,0x6a8ab4d3,0x9bee6aaa,0x41a57b4b,0x9c7062a9,0x52079c50,0x94305a48,0x730cacb2,0x6aea49e7,0x836a93ed,0x6aa751e4,0x9bcb9c0c,0x7ae98b6b,0x72c86246,0x72e97b29,0x7b4b5a67,0x6268730a,0x6aca6269,0x732a836d,0x6ae95a88,0x4a275268,0x4a284a28,0x52485249,0x52485aa9,0x4a275269,0x52484a27,0x6aeb5a89,0x9490734c,0x9cb19c90,0x83aebd34,0x41654165,0x518651a7,0x51a64945,0x41244965,0x51664945,0x41044925,0x494561e8,0x496538e3,0x39035186,0x51854124,0x416551c6,0x6a694144,0x49a67acb,0x41653904,0x51863904,0x49656a49,0x5a073904,0x39035a08,0x936d51a6,0x496593ad,0x7b0b51c6,0x41656a89,0x41443903,0x30c34164,0x62493904,
-0x390251c7,0x7aaa72ca,0x51c73904,0x51c77b0c,0x5a273944,0x51e649a6,0x6aaa72ca,0x834c6249,0x6aa99c0f,0x62694145,0x41646a8a,0x62694144,0x4166832c,0xb48e93ab,0x62268b2a,0x832a7b0a,0x7b4a5a47,0xa44ea46e,0x936b8b4b,0x72888b4b,0x72c86246,0x93ac9bed,0x938b72c8,0x93cca42e,0xa40d93ab,0x7b2a834b,0x8b8ca42f,0x6a897b0a,0xa40d7ac9,0x7288ac4e,0x416459e6,0x51845185,0x59a551a5,0x620659c6,0x59e64964,0x51a551a5,0x9c2e9bee,0x72c86267,0xa46dbccf,0x838a83ab,0x8bcba48e,0x72e85a25,0x9bcbac2d,0x62067287,0x7aea51a5,0xacb1acb1,0x72a9834c,0x9c2f836c,0x93ceb4d2,0xa45172ca,0xa42fcd75,0x7b0b6228,0x72a993ae,0x62086228,0x728959a6,0x9bee9bce,0x49a58b6c,0x832b7aca,0x6a488b0b,0x59a659a6,0x6a0759a6,0x51a66227,0x49454944,0x8b0c7aeb,
-0x6a286a49,0x49454965,0x414551a6,0x628938c3,0x938d9bef,0x5a486269,0x8b4d6aaa,0x72ca8b4d,0x51c66227,0xac7172cb,0x834c8bad,0x51e65a06,0x93ee8b8c,0x5a4872ca,0x730b6aca,0x7b6d6269,0x7b6da4b1,0x7b8c49c6,0xb4d1b533,0x5a4793cd,0x72e849c5,0xac2e9c0d,0x8b6a938b,0x6aa8830a,0x5a276288,0x8bcd9c2f,0x62895a47,0x6ae96aa9,0x62a85a68,0x62a97b4c,0x522849e6,0x62aa5a8a,0x6aeb62aa,0x7b6c5aa9,0x83ae940f,0x7b8d732c,0x9c719cb1,0x7b6d734c,0x93cfa4b2,0x38e459c8,0x39044125,0x39244124,0x38e34144,0x30c238e3,0x494538e3,0x38e44945,0x49654104,0x39444986,0x414430e3,0x516551a6,0x30c34124,0x41043904,0x51c64986,0x41044104,0x51a64985,0x6a6930c2,0x6228936d,0x7aeb4124,0x51c69bcf,0x41443924,0x49a64965,0x414449a6,0x5a273944,0x30e349a5,
-0x392430e3,0x39233903,0x5a0759e7,0x6a8a30e3,0x622751e7,0x51c74165,0x836d8b6d,0x41654165,0x834c72aa,0x41446229,0x72cb6aaa,0x39243104,0x7b0b6a89,0x9bab8308,0x59e5832a,0x93cc72a8,0x5a457b29,0x7b096267,0x9b8ba3ec,0x938b8b49,0x72c78b8a,0x72e76a65,0x834a938a,0x9bcb8329,0x7ae89bcb,0xb4af834a,0x5a2693ac,0x72a86a68,0x7ac97ae9,0x51c561e6,0x496359a5,0x6a476a26,0x61e66207,0x6a486227,0x620759c6,0x49c572a8,0x8b8b6288,0x5a067ae9,0xa44e8b6b,0x9c2db4af,0x62a7940c,0x8b8a6ae7,0x9bab8b69,0x7ac89bab,0x62276a47,0x8b6d72ca,0x7b0b7b0c,0xac91a451,0x836c9bef,0x7b2c838d,0x8b6c7b4c,0x62486268,0x72896228,0x9bce7289,0x6a48938d,0x834c7289,0x6a886a89,0x620751c6,0x59c76228,0x6a285186,0x8b2c932c,0x61e78aec,0x72695985,0x6a487aaa,
-0x494559a7,0x49644944,0x498551a6,0x62483923,0x62686aaa,0x72ea7b2b,0x62486268,0x7aeb6a89,0x832c936d,0x5a4859e6,0x9c0f7b6c,0x49e66289,0xb4d19c2f,0x49a6732b,0xbcf47b2c,0x5a4893ef,0x83ac5a48,0x62a8730a,0x9c71a4b0,0x9c2f6b0b,0x51e5732a,0x83495225,0x9beca42d,0x72c88b8b,0x416351c5,0x83ac6247,0x49e57b4a,0x6a875a67,0x6aa95a46,0x730b6ac9,0x62aa732b,0x734c62aa,0x5a697b4d,0x62ca6aeb,0x6b0b62ca,0x62a962ea,0x5ac962ea,0x83ae6b2b,0x8baea471,0x41456229,0x51c74125,0x59c76249,0x49854145,0x49854965,0x494559e7,0x51853904,0x30e34965,0x59e74966,0x38e34165,0x39244124,0x59e75186,0x39044944,0x59e74144,0x38e35a08,0x7aaa61c7,0x49444165,0x624872aa,0x51863924,0x498559c7,0x414451a6,0x6a483924,0x6269830b,0x62484145,0x392472ca,
-0x82ec4986,0x30c25a28,0x6a895a07,0x832b4144,0x51a672cb,0x51c76249,0x6a694165,0x39246a69,0x834c4165,0x51e7834d,0x6a8a30e3,0x39247b0c,0x93ae4985,0xac4e7b29,0x62269bcc,0xac6f830a,0x626693cc,0x6a6672e8,0x7ae86a66,0xa3eb9bcb,0xac6e9beb,0x8b6a8b49,0x6a868328,0xac6d8b8a,0x7b089bcb,0x7ae972e8,0x8b8a834a,0x72a87b09,0x51856a47,0x6a275164,0x8b4a934b,0x72676246,0x59e66247,0x62076206,0x518659e7,0x41844985,0x8bab49c5,0x624693cc,0xa42d832a,0xa46d7b29,0x7309b4ef,0xac4c6aa6,0xa42cbccf,0x82c89bec,0x496461e6,0xa3ee8b4c,0xa4309bce,0x7b0b93ce,0x8bae6aa9,0x7b0b8bad,0x7b2b72ca,0xac509bef,0x72896a47,0xb42f9bad,0x6a489b8d,0x5a0751a6,0x7aca6aa9,0x5a075a27,0x6a49728a,0x61c759c7,0x7aaa7249,0x516559a6,0x51655166,0x51865186,
-0x51854965,0x51844964,0x6a886a68,0x39644985,0x5a685a48,0x8bad5a47,0x6248a42f,0x72694145,0x7aca830b,0x5a686a69,0x730b83ad,0x5a487b6c,0x7b2c6269,0x51e772aa,0xa4316a8a,0x49c68b4e,0x9c2f5207,0x6ac99c6f,0x7b8d62a9,0x7b4c730b,0x7b2a7b2b,0x51e56246,0x832a72a8,0x93ab9bcc,0x7b4a8b8b,0x49e45a47,0x6ac75246,0x8bac7b29,0x6ac97b4b,0x6aea730a,0x730c628a,0x5a897b4d,0x732c7b2c,0x732c62aa,0x62ca7b6d,0x62ca5a89,0x62ca6aea,0x7b8d5288,0x836ea492,0x51a749c8,0x59c751a7,0x59e7830d,0x51863904,0x41244945,0x41044965,0x390430e3,0x30c338e3,0x51864944,0x38e34145,0x39044124,0x41243904,0x38c34944,0x934d5186,0x30a38b2d,0x72895185,0x496559c7,0x620859a6,0x51a66208,0x59c74104,0x59e79bae,0x72aa3904,0x59e77aeb,0x51a63903,0x51a682ea,
-0x82eb5186,0x38e36249,0x6a6959c7,0x6a893903,0x5a087aeb,0x498659e7,0x7aea51a5,0x51a68b6d,0x5a0849c6,0x62697b2c,0x626849a6,0x834c7b2c,0x28825a07,0x9c0d6a87,0x622693cc,0xa40d6a46,0x72a8ac4d,0x8b8bac4d,0x6a466246,0x51e55a26,0x6a877ac8,0x8b4a5a06,0x8b2a8b6b,0x8b6a9bab,0x8b4a8309,0x51c5830a,0x62276206,0x51635184,0x59c551a5,0xb48e82e9,0x7ae8ac6d,0x72a86a86,0x62276226,0x62077268,0x49656a48,0x5a076268,0x8b8b49a5,0x72c8ac4e,0x9c0c6a87,0x93cb72c8,0x7ae8a40d,0x8bab6aa7,0xac6eac8e,0x628772e8,0x6a67834a,0x7aea72a9,0x9bad7aca,0x7aeaac50,0x8bad6aaa,0x940fa491,0x93ae730b,0xa40fb492,0x62077aca,0x9b8e830b,0x6a88830c,0x62485a07,0xcd559c0f,0x5a079bef,0x72aa51a6,0x59e77ac9,0x51a65186,0x728951a5,0x62078b2c,0x59c75186,
-0x726961e7,0x494559c7,0x51c65186,0x62484184,0x6aaa72ea,0xac908b8d,0x8b6c7b2b,0x49846a68,0x82ea6207,0x6a898b4d,0x7aeb51e6,0x7b0b8b6d,0x6a4951e7,0x6a69830c,0x59c751c6,0x728a72a9,0x7b0b59e7,0x7aea9bce,0x93ce6269,0x62487b0b,0x49855207,0x830a5a07,0x59e67aca,0x830a7ae9,0x9bcd938b,0x6a878b8b,0x52455205,0x730a5225,0x732b732b,0x5a4841a5,0x628a62aa,0x93ef838e,0x626972cb,0x52075a49,0x730c49e7,0x6b0a83ad,0x39a55248,0x94305aca,0x730ba491,0x51c74125,0x40e46a4a,0x410438e4,0x39044945,0x39244925,0x59c64103,0x390361e7,0x410438e3,0x38c330c2,0x41243903,0x49444965,0x51654104,0x494551a6,0x51864104,0x412459c6,0x41454104,0x51c649a6,0x39043924,0x7aaa6a49,0x59c64945,0x82eb9bcf,0x5a084124,0x59a67289,0x41244123,0x49655186,
-0x6a484124,0x41045a07,0x49854144,0x41445186,0x49656248,0x6a4859a7,0x414451c6,0x72ca6248,0x49a63944,0x7b0b834c,0x390351c7,0x5a073924,0x59e772aa,0x9c0d7b09,0x5a058bab,0xac4e72c8,0x72e893ac,0x8b6bbcb0,0xa42e6267,0x830ab4b0,0x6a8851a5,0x51a472a9,0x51a451a4,0x72a86a46,0x51e55a06,0x832a72c8,0x59c551c5,0x7ac97a88,0x6a877267,0x9bec8b6b,0x9babb4ae,0x72a85a26,0x62276267,0x620772a9,0x414459e7,0x59e66248,0x72884963,0x7b098b8b,0x7b296267,0x8b8b7b09,0x8b6aac6e,0x9c2c72c7,0x838ab4ef,0x93ec6245,0x726893ac,0x72896227,0x9bae8b2b,0x7b0b9bce,0xa45072ea,0x7b4c9c0f,0x8b8d7b2b,0xa40fa40f,0x62297aeb,0x7b0c51c6,0x8b8d93ce,0x5a2872ca,0xa47072a9,0x72cabcd2,0x6a4851a5,0x7aca72ca,0x51a66207,0xa3ef8b4c,0x8b4da3ef,0x498551c6,
-0x82cb82eb,0x49656a28,0x49654965,0x7b0b830c,0x62884165,0x6a899c0e,0xac707b0a,0x51c6834c,0x7aeb5a07,0x728a830b,0x8b6d6228,0x830bac0f,0x59e76227,0x834c7289,0x498559e7,0x936d7269,0x59e67aeb,0x72a959c6,0x5a2772aa,0x5a07834d,0x49a64145,0x6a495a07,0x5a076a69,0x51a54123,0x6a887288,0x93ec834a,0x8bab9bec,0x52066ac8,0x5a4851e6,0x49e66ac9,0x520641a5,0x7b4b6269,0x5a485a27,0x7b2c834c,0x62a96aca,0x62a96289,0x734c6b2b,0x9c9162ca,0x5a2893ef,0x49864124,0x59c759e8,0x514540e4,0x51866a28,0x49654945,0x41244103,0x38e34964,0x41044104,0x41444124,0x40e34124,0x496538e3,0x30e34103,0x41244124,0x59c65186,0x41244144,0x624859e7,0x7b0b4164,0x416572aa,0x726959c7,0x390461e7,0x59e76208,0x39234124,0x49654124,0x6a4861e7,0x498538e3,
-0x51a66207,0x49a63903,0x49a66207,0x41655a07,0x49a56248,0x6a496a48,0x414551c6,0x834c51c7,0x51e75a48,0x62284985,0x5a2859e7,0x39246a69,0x7aca5a28,0xa40e6246,0x5a269bed,0xa44e6246,0x72a8b46e,0x93cca42e,0x6a876a67,0x836b93ac,0x7b0a6a88,0x8b2a59e5,0x6206938c,0xb48f8b4b,0x6a879bec,0xb4908b6b,0x6a277288,0x8b2b82ea,0x62257ac8,0xac6e7ae9,0x8329a42d,0x6a666226,0x51a559e5,0x51855a06,0x496551c5,0x41434964,0x62264143,0xa42d93cc,0x7b295a45,0x72e8ac8e,0xb4af8b8b,0x7b299bec,0x9c0c93eb,0x93cb6ac8,0x8b4b93cc,0x832c51c5,0x832cb491,0xacb172ea,0x838da491,0x83cd940e,0x836d83ad,0x6aaa5a48,0xb471832c,0x72ca7aeb,0x836c6aca,0x72ea9c0f,0x6a895a48,0x72ca6a89,0x62485a27,0xb4d1a42f,0x49a66a89,0x93ad8b8c,0x830c832c,0x39046248,
-0x51c751a6,0x61e76207,0x624851a6,0x62485a07,0x51c66a89,0x7b0b51e7,0x832c834c,0x6aa97b0b,0x51c65207,0xa4107aeb,0x5a287b0b,0x938e6aa9,0x7aeaa3ef,0x7aeb6227,0x5a287b0b,0xa43051a6,0x51c69bef,0x8b6d6248,0x5a2872aa,0x62488b6d,0x59c759e7,0x620759a6,0x59c76248,0x49645185,0x61e64964,0x624659e6,0x7b2972a8,0x93cc8b8b,0x7b2a832a,0x5a476a88,0x49e55a46,0x51e54164,0x49c56247,0x62896268,0x62aa6aaa,0x62c95a89,0x7b8c6b2b,0xa4919c50,0x51e76aca,0x59a75a28,0x59a75166,0x41045166,0x49254124,0x41044104,0x51655165,0x51854104,0x38e34124,0x620830c3,0x49446a48,0x41243924,0x41243904,0x41044124,0x82eb4965,0x41448b6d,0x72aa51c7,0x6a6959e7,0x5a08830b,0x49654104,0x59e74965,0x38e34124,0x728a5a08,0x30c259c6,0x934d6208,0x51854945,
-0x830b938d,0x49854165,0x5a076a89,0x5a075a07,0x624851c6,0x52073924,0x51c66a68,0x62a96248,0x41857b2b,0x72a951a6,0x6a696208,0x49a57b0b,0x6aa94985,0x9bec834a,0x51e5830a,0x9bcc6a88,0x830a9bcc,0x8b6ab4af,0xac6f6a87,0x5a27a44f,0xac5072a9,0x59e67b0a,0x62267b0a,0x9bec72c9,0x72c88b4a,0x9c0d836a,0x6a676247,0x8b4a830a,0x626672a8,0xa44d834a,0x8b8bac6e,0x8b8b6267,0x622772c8,0x62477a89,0x51c67aaa,0x622738e3,0x496359e6,0xa46e8b4a,0x62877b29,0x834a9bec,0x9bcc72c8,0x9c0ca44d,0x8b8b940c,0xa44e6ac8,0x7aeaa42e,0x832b51a5,0x93efbcb1,0x8bad6aaa,0x8beea470,0x7b6c6aeb,0x83ad8bee,0x72ea7b4c,0xac91acb1,0x5a2893ae,0x9c2f6289,0x6aaa9c0e,0x72cb5a48,0xb4f27b4c,0x72ca838c,0x93ae93ce,0x49a55a48,0x624949e6,0x49a65a28,0x5a285a07,
-0x936d6228,0xac30b451,0x39036248,0x834c51c7,0x72ca93ce,0x7aeb51a6,0x6aa99bef,0xa40f9bef,0x62486268,0x72eb834c,0x5a288bae,0x836d72a9,0x93cfac71,0x5a0751c6,0x9bef9c0f,0x62696a69,0x72ca730b,0x624851e7,0x9bef8b8d,0x72aaa451,0x51c64986,0x51a651a6,0x516559e7,0x830b6a28,0x59c659c7,0x41444984,0x62274984,0x82e872c9,0xa3ed8b6b,0x8bab93cb,0x62877b08,0x6ac86aa8,0x7ae95a06,0x6aa95206,0x52275207,0x734c6b0b,0xacd29c70,0x626993ef,0x49863944,0x61e76207,0x49254945,0x49244945,0x59a63903,0x51a66208,0x724959a6,0x40e35165,0x39044124,0x39044104,0x41243904,0x622851c6,0x49654124,0x394451a6,0x414438e3,0x41654164,0x5a286208,0x8b4d3904,0x59e78b4d,0x49654965,0x8b4d5186,0x51857aca,0x7aeb59e7,0x41047269,0x728a5186,0x41034124,
-0x72aa832c,0x28c24145,0x628941a5,0x5a486aa9,0x836d5a27,0x51c66a89,0x5a485a28,0x41a549c6,0x6248838c,0x6aaa4144,0x6a89938d,0x5a273944,0x52075a07,0xa42d7b0a,0x51c5832a,0xac4e7ae9,0x72c893cc,0x836b9c2d,0x72e96aa8,0x8b6c93cd,0x72ca6a89,0x7aea6248,0x49a472e9,0xb4b08b8c,0x6aa893ac,0xac8f8b8b,0x6a676267,0x834b830a,0x52256aa8,0xa42d7b29,0x8b6ba40e,0x7ae96267,0x5a066a88,0x62276a48,0x59c659e6,0x62275185,0x496359c5,0x9bed7ae9,0x62477b29,0x8b8b8b8b,0x8b8b6a87,0xa44ea44e,0x9c4dac6f,0x9c0d6ac8,0x8b8cb4af,0x62276227,0x8bad834c,0x8bce8bad,0x940e8bce,0x8bcd6aca,0x93ceac91,0x8bad7b4c,0x940f93ce,0x72eb9c2f,0x8bad72ca,0xac91a450,0x6aaa834c,0x8bce8bae,0x730b940f,0x5a485227,0x6aa95a68,0x7b2c4185,0x6a89832c,0x936d8b6d,
-0x622851c7,0x6a697b0c,0x624972ab,0x5a0759e7,0x9bce7aeb,0x4185834c,0x6a895a28,0x830c93ce,0x6aaa6268,0xacb1836d,0x6ac962a9,0x72eb51e7,0x7aeb8bad,0x6a895a07,0x9c0f9c0f,0x628949a6,0x72eb93ad,0x836d5227,0x9c30b4f2,0x6acaac51,0x8b6d4986,0x61e8938e,0x51a64945,0x72696a29,0x51657269,0x6a894944,0x41647289,0x49644144,0x5a0551a4,0x832a7ae9,0x8b8b8b49,0x93ab93cb,0x7b098b6a,0x72ea832a,0x9c2f8b8c,0xacb19c50,0x834d9c50,0x416649c7,0x49454986,0x51654124,0x516561c6,0x6a0859a6,0x41244965,0x518659c7,0x490438c3,0x40e44925,0x51454104,0x41454124,0x41455186,0x49654104,0x38e33924,0x30c338e3,0x72aa5186,0x390472aa,0x8b4d5a28,0x49655a28,0x51864986,0x518659a6,0x62284124,0x49657aaa,0x496538e3,0x41044965,0x41244124,0x41245186,
-0x498551a6,0x49c551c6,0x49c63103,0x5a48836c,0x72eb49c6,0x49c56aaa,0x93ee7b2c,0x62a949e6,0x6aa96aca,0x51e751e7,0x62696a69,0x72eb6269,0x41a56a89,0xa42e9bcd,0x5a2672c8,0xa40d8b6c,0x9bed8329,0x72e9a46e,0xb4b08329,0x6aa9ac70,0xa42f72ca,0x5a476a89,0x5a066aa9,0x93cc7b0a,0x72e8836b,0x9c2d836b,0x7ac96287,0x7b2a72e9,0x62667ae9,0xac6e834a,0x93cdb4d0,0x7ac96a88,0x5a276a67,0x62486a68,0x72898b2b,0x49444964,0x49434944,0x9c0d6a88,0x626793ec,0x9c0d7ae9,0x5a266267,0xb4d093ed,0x838b9c6e,0xa46e7b2a,0x8b4ba42e,0x62485a27,0x72ca7b0a,0xb5138bce,0x6acab4d2,0xb4d2a450,0x9c30acb1,0x9c0f7b2c,0x9c2f8b8d,0x6248838d,0x93cd7b2b,0xa4308bae,0x62698b8d,0xa450940f,0x6aa98bae,0x6aea51c6,0xa450a491,0x5a0762a9,0x72ca51a6,0x49656a69,
-0x41444165,0x832c59e7,0x8b6db4b2,0x496549a6,0xa40f7b0b,0x5a078b4d,0x7aca51c7,0x7b2c5a28,0x7b2c9c0f,0x6aaa49e6,0xa47093ce,0x51c76248,0x93ee7b2b,0x51e6832c,0x7b2c93ad,0x5a0851e6,0x8bae7b2c,0x6aaa62c9,0x7b2c940f,0x6a89836d,0x622851e7,0x7acb7aeb,0x51865186,0x82eb7aab,0x41456208,0x7acb5186,0x498572ca,0x41443924,0x622759c6,0x30e24144,0x51a43902,0x72a76287,0x938c7ae9,0x8b6c93ac,0x9bee93cd,0x7b0b8b6d,0x416551e7,0x41245186,0x51864124,0x59c65145,0x6a287aaa,0x51a64944,0x30a24124,0x518640e4,0x49255165,0x51866a29,0x49654104,0x49454925,0x494551a6,0x8b4c51a6,0x41454966,0x59c66228,0x498630c3,0x6a497289,0x412338e3,0x72894985,0x49456228,0x6a2861e7,0x41444104,0x49253903,0x62486a69,0x59c73904,0x5986830c,0x72aa5165,
-0x28a25a07,0x8b6d6a89,0x49a66248,0x6aaa7b0b,0x62484985,0x6aaa834c,0x72eb5207,0x418572ea,0x830c5a07,0x6a6851c7,0x72eb8b6d,0x41a549a6,0x41c65207,0xac4e93cc,0x49c46a88,0xac6f93ac,0x8bab7b09,0x7b09ac4e,0x7b096287,0x8bad93ee,0x72a96268,0x72e951e6,0x49846a68,0xacaf93ad,0x7309834a,0x9c0d9c4e,0x7ae96a87,0x7b0a7b0a,0x62666aa8,0x9bcd7b29,0x8b6ba40e,0x72a96aa8,0x59e65a06,0x59c66a68,0x59e659c6,0x6a274964,0x59c57288,0x834a51c5,0x72a8a42e,0x7b2a5a06,0x622772a8,0x8bcc6287,0xac8fb4d0,0x834a8bcb,0xa42ea44e,0x62076a89,0x6aca7aea,0x7b4c6aca,0x628972ca,0xa450a470,0x836c8b8d,0x8bad7b4b,0x7b2c9c2f,0x6aaa6ac9,0x8b8d72ca,0x9befac71,0x832c7b0b,0x6a8a5a28,0x8b8d836d,0x628972ca,0x72aa8b8d,0x51a66a89,0x59e74144,0x9b8e7aea,
-0x6a6993ae,0x62694165,0x830c6a8a,0x59e77aeb,0x62484165,0xbcb2938e,0x4144832c,0x834c5a28,0x7b2c9c0f,0x72ca4185,0xac50938d,0x51c76269,0x9bcf832c,0x49a6830c,0x93ee6268,0x49a66aaa,0xac9172eb,0x6aca9c0f,0x93ef8b8d,0x522772cb,0x49654986,0x7aeb72ab,0x518659e7,0x8b6e61e7,0x518659e7,0x6a696a69,0x51c651c7,0x72aa6228,0x41444965,0x52064124,0x49a45a07,0x59e651e6,0x41433923,0x41434143,0x498551a5,0x41444104,0x41654144,0x41254125,0x82cb6a29,0x49256a49,0x49444945,0x51854103,0x51857249,0x51a74104,0x38c351a6,0x414438e3,0x51664124,0x49044124,0x49445165,0x41044104,0x410538c3,0x59a761e7,0x49654104,0x40e35186,0x59c651a6,0x6a683903,0x6a288b2c,0x39033903,0x7aca4965,0x49646a69,0x8b4c72a9,0x41456208,0x59c66a28,0x412440e4,
-0x51c66227,0x72aa49a5,0x52077b2b,0x6aca4144,0x498549a6,0x6a896248,0x6a8951c6,0x52078bad,0x628951e6,0x5a087aeb,0x72ca49e6,0x626872ea,0x7b0b5227,0x93ccac4f,0x6a886226,0x93cc9c0d,0xa42d72e9,0x6a889bec,0xb4d093cc,0x5a4793cd,0xa42f7b0b,0x6a8851e6,0x5a066a88,0xa42e8b8b,0x7b097b29,0x838b93ec,0x7b2a6246,0x832a7ae9,0x628672e8,0xa46e836a,0x836ba44e,0x6a886226,0x59e66247,0x5a076a27,0x7aa87288,0x62074944,0x51a67289,0x8b8b51e5,0x72e9a44e,0xa42f51c6,0x62478b4b,0x7b4a72c8,0xa44e838b,0x942db4f0,0x8b6b7b2a,0x5a066ac8,0x836c7b0a,0x836c7b0b,0x72ca72ea,0x834c6a89,0x93aeac50,0x8bae6248,0xbd12bd13,0x6a697b4c,0x7b0b6248,0x72eb93ae,0x7aeb5a07,0x62486a89,0x8b4c9bce,0x51a651a6,0x626959e7,0x7aeb830b,0x59c76a49,0x7aaa6208,
-0x6a8a7acb,0x49855a27,0x72ca5a07,0x62487aeb,0x7acb4165,0x938dac91,0x72ca6a69,0x7aeb5a08,0x59e7830c,0x5a2849a6,0x7b2b8b6d,0x5a077aeb,0x93ad6a89,0x49a5832c,0x9bcf6a48,0x49a66248,0x834c6aa9,0x93ee9c0f,0x836d6289,0x51e7836d,0x51e75a07,0x41453923,0x72a96248,0x414551a6,0x6a6951a7,0x5a086a8a,0x5a284165,0x7acb93af,0x30c36a6a,0x93ae5a28,0x626893ae,0x498549a5,0x51a649a5,0x494459c6,0x51854965,0x38c34925,0x6a494965,0x82cb9bef,0x51655166,0x49455186,0x7aca59e7,0x49644965,0x59c77289,0x392430a2,0x496559c7,0x518530c3,0x49654944,0x49244124,0x496559a6,0x7aaa4944,0x41047aaa,0x51865166,0x59e74124,0x5186728a,0x59c74945,0x494559e7,0x494430e3,0x728a6a69,0x6a494164,0x498682eb,0x59e738e3,0x61e75a07,0x41046208,0x41244104,
-0x41443904,0x39244124,0x62895a07,0x72aa30e3,0x30c359e7,0x7aeb5a08,0x49a56248,0x836c72c9,0x72eb5a48,0x626972ca,0x5a285a28,0x8b8d72eb,0x52075227,0x832aac6e,0x72c85205,0x93cca40d,0x93cc7b09,0x626793ab,0x9c0e72e9,0x7aea93cd,0x6a8872aa,0x8b6b72a9,0x5a066247,0xac4fa42e,0x7b4a6aa8,0x8349bd10,0x93ac6247,0x72c97ae9,0x6a8772a8,0x93ab8349,0x832a9c2d,0x62476227,0x5a0659e6,0x51c56a68,0x59e651a5,0x49645185,0x51855185,0x7b0951c5,0x9c0eacaf,0x9bed51a5,0x6aa8a40e,0x7b097288,0x8bab72e8,0xacaf9c4d,0x6ac8a42d,0x5a055a05,0xbd1393ad,0x5a488bad,0x8b4c6a69,0x8b6d9bcf,0x93ae8b6d,0x6aca7b2b,0x93ee834c,0x9bef832c,0x62288b6d,0x520751e6,0xb4b2838d,0x7aea834c,0x6a49830b,0x51854965,0x62074985,0x82cb82ca,0x6a4882eb,0x49645165,
-0x7aca51c6,0x832ca3ef,0x41444985,0x9bce6a89,0x49a57b2c,0x49a65a07,0xbcb272aa,0x49657aeb,0x7aeb4986,0x5a089bef,0x832b59e7,0x6248832c,0x7aeb51c7,0x93ae9bef,0x626951e6,0x938dac71,0x93ae72ca,0x72ea940f,0x9c306aaa,0x41a672eb,0x832c72cb,0x49656249,0x5a2849a5,0x496572aa,0x7b2c4165,0x6a8a93ae,0x49c73944,0x62086269,0x49a751a7,0x6a895a48,0x62496a8a,0x498549c6,0x6207832c,0x59c782eb,0x494540e3,0x620859e7,0x51a74965,0x622872a9,0x59c74145,0x728982cb,0x726951a6,0x41447aaa,0x51a63903,0x41454165,0x41245185,0x412438e3,0x59c64104,0x41244124,0x518659e7,0x518538e3,0x38e35185,0x724859c7,0x49255186,0x62086208,0x51a54124,0x51a64124,0x41035186,0x7acb6228,0x41244145,0x51a651c6,0x728a832c,0x6a494145,0x41047acb,0x830b4945,
-0x38e36207,0x5a075a07,0x6a6959e7,0x62694145,0x51c68b4d,0x624830c3,0x51c76acb,0x7b4b5207,0x41855a48,0x834d6269,0x5a2872aa,0x7b4c72eb,0x49c67b4c,0x72a8b4d0,0x9bcd51c4,0x72a8a40d,0xac6e93ab,0x72a87b09,0x93ab8bab,0x72a96246,0x8b4bac70,0x93ac4964,0x728772a7,0x9c0d9bcc,0x8b6a832a,0x72c8a44e,0x832a5a26,0x7b0a72a8,0x72c87ae9,0xa46e9c2d,0x72c9a44e,0x6a686248,0x6a6951c6,0x62478b2b,0x7aa97268,0x6a4751a5,0x7269932c,0x72a85185,0xa3ee9bcd,0x7aea6226,0x7ae99bcd,0x72e859e6,0x6ac8836b,0xa42d93ec,0xac6ea44d,0x51a47b29,0xb4d272ea,0x7b2cbd33,0xa4306269,0xa40fbc91,0x51c76a69,0x93ce7b0c,0x5a477b6c,0x7aea49e6,0xac50ac91,0x5a6872ca,0x7b6b6aa9,0x62698b6c,0x496551c6,0x9b6d6a49,0x49458b0c,0x51865165,0x82eb61e7,0x6a288b2c,
-0x51854965,0x936d728a,0x6a89936d,0x626851a6,0x72eb836d,0x6a893904,0x8b8d93ae,0x49866a69,0x830c59c7,0x6a89a3ef,0x8b6d51e7,0x72aaa430,0x832c59e7,0x72ca938d,0x830c5a28,0x7b2bac50,0x72eb7b0b,0x7b2c6aca,0x834c8b8d,0x41656a69,0x832c4965,0x412472aa,0x8b2c6208,0x51c78b2c,0x72ca72ca,0x62696269,0x8b8d7b0c,0x59e76a89,0x6a494965,0x62696249,0x624872ca,0x6a6949a6,0x622849a6,0x496559c6,0x51654124,0x8b4c7269,0x412472aa,0x51a64144,0x62286207,0x72aa6a49,0x49866208,0x49656a69,0x51c73924,0x30e24965,0x49454144,0x51a64144,0x62074164,0x59c64165,0x6a497289,0x830c6a69,0x30c359c7,0x72894124,0x30c36208,0x6a284966,0x30c34144,0x414530e3,0x51a65a07,0x49664124,0x72894985,0x51a65a07,0x9bee938d,0x41456a69,0x412459e7,0x6a484944,
-0x39036207,0x5a274165,0x6a8a6a89,0x39046a89,0x6a69832c,0x5a073924,0x62687aeb,0x72ea49c6,0x5a488b8d,0x5a2851e6,0x5a486aa9,0x834c49e6,0x730b9c2f,0x62679bec,0x9bec51c5,0x72a8a42d,0x9c0d93ac,0x5a466266,0x93cc7b29,0x5a067b2a,0x7aea72a9,0x7ac87aea,0x7ae959c5,0x9c0db46e,0x93ac72c8,0x6a87b4d0,0x8b6b6226,0x72a87aea,0x72a76266,0xa42d93cb,0x830aa40d,0x51e66a68,0x5a064144,0x59e672a9,0x622659e6,0x59e651a5,0x6a287aaa,0x72c94964,0xac4fac6e,0x7aa96a67,0x9bedb490,0x62676267,0x8bab8b6a,0x8b8b72e8,0xa42eac6e,0x62268309,0x9c2f72c9,0x8bceb4d2,0x51c75207,0x938d6a49,0x51e7938d,0x730b49a5,0x730b93ee,0x836c730b,0x93ae9c0f,0xacb18bcd,0x9c4f942f,0x7aeab4b1,0x51a64965,0x8aec7289,0x51867249,0x51455165,0x82cb7a8a,0x6a487269,
-0x494459c6,0xa3ef6a48,0x7aeb832c,0x624859e7,0x626872eb,0x730b6289,0x938d8b4c,0x41245a08,0x724961e7,0x7b2b72ca,0x62686a89,0x832c832c,0x5a086248,0x8b8d72ea,0x6aca836d,0x93ada451,0x6aea6289,0x9c3093ee,0x59e8836d,0x51c751c7,0x59e76208,0x6a4951a6,0x6a287acb,0x51a64924,0x8b6d8b4d,0x5a285a28,0x7b4c72eb,0x4965832d,0x624859e6,0x72aa7b0b,0x626951a6,0x832c8b8d,0x41856a89,0x6a493904,0x6a698b4c,0x49a64144,0x416451c6,0x6a473903,0x6a498b4c,0x51c64945,0x392451c7,0x59e74965,0x41454985,0x49653924,0x6a896a69,0x5a074165,0x626951c6,0x62486a89,0x41244985,0x832c6a49,0x59e76a28,0x62286228,0x49245185,0x59c751a6,0x62073904,0x414459c7,0x62086208,0x41454945,0x7aca3924,0x49a58b8d,0x7b0b49a6,0x4965728a,0x49654124,0x82ea7aca,
-0x41444985,0x51c65a06,0x72eb51c6,0x49867b0c,0x6aaa51c7,0x30e349a6,0x834c6a89,0x52275a68,0x8b8d6289,0x51e76228,0x6aaa72cb,0x6aea5a48,0x940f7b6c,0x51c56a66,0xac2e8b8b,0x8329832a,0x9bcdb48e,0x9bcc6a47,0x62679bec,0x93ac6a46,0x59e5936b,0x936b82e9,0x83096226,0x936ba3ed,0xa40c8309,0x5a46a44e,0x6a887ae9,0x8b2a8b4b,0x7ae86a67,0xb4afa42d,0x6247a40d,0x62276247,0x62274985,0x6a68832a,0x6a8859e6,0x49855185,0x51c659c6,0x59c54965,0xac6f8b6b,0x624772a8,0x938ca40e,0x6a8872c9,0x8b8b72a8,0x6ac893ac,0xbcf0836a,0x6a87a44d,0x838d5206,0x62c9b4f2,0x72ca836c,0x51c651a6,0x7b0b6a69,0xa49193cf,0x838ca470,0xa4509c30,0x7b0b834c,0xb4f2a470,0x7b2b83ad,0x836cb4f2,0x62076248,0x51a659c7,0x59a75185,0x6a087249,0x492459a6,0x8b0b59a6,
-0x830ba3ef,0x6a694144,0x938d6a69,0x72eba430,0x6aaa3103,0x9beeac91,0x498672ca,0x8b4d6a69,0x4945726a,0x9bef6a69,0x5a48938e,0x8bae7b2c,0x6a8972ca,0xb4d293ce,0x6aaa9bee,0x6aeaa470,0x8bce49e6,0x836c9c50,0x7aeb8bad,0x49864145,0x61e86228,0x518651a6,0x7aca6a49,0x51a65186,0x6a696248,0x62486248,0x52076269,0x7aea6249,0x7b0b7289,0x6268938d,0x62894165,0x93ad8b8d,0x416572aa,0x830c5a08,0x936d9bee,0x30c36208,0x938d6248,0x49657aca,0x41453904,0x59e73924,0x8b4d82ec,0x6a695a08,0x51c75a07,0x52065a27,0x7b0b6a48,0x8b8e6a69,0x5a075a28,0x7b0b7b2c,0x30c251e6,0x412430e2,0x72ca51a6,0x8b4c9bef,0x390351a6,0x93ae72aa,0x49864965,0x6208936e,0x494538c3,0x59a65986,0x41454145,0x51c65a07,0x5a276a69,0x622859c6,0x41454985,0x7aaa7aaa,
-0x49854965,0x6a6872ca,0x49c630c2,0x6269834d,0x41663924,0x416559e7,0x5a2830e3,0x49c66aaa,0x834d7b2b,0x41a572ca,0x836c49a6,0x5a488bae,0x6aca6aaa,0x5a0559e6,0x9bcc9bec,0x9bcc7ae9,0x7288ac0d,0x6a667267,0x82e9936a,0x7aa86a46,0x622682c8,0x59e572a8,0x9c0c5a05,0x8329ac8e,0xac8f8329,0x5a2693ac,0x7288834a,0x7ac98b4c,0x7b095a26,0x9bec93ab,0x6a8793ac,0x5a056aa8,0x49a44183,0x51e559e6,0x51c55a06,0x59e64984,0x72a9830b,0x5a264984,0xb4afa42d,0x62676a88,0x9bcda42f,0x6a8872a9,0x6a687ae9,0xac4f6a88,0x6a6782ea,0x8b2a9bcd,0x6aa94985,0x62c993ce,0xa4b18c0f,0x49e66aca,0xb4d293ce,0xa4b1a4b1,0xa4307b6c,0x8b4db491,0x5a485a27,0x8bad7b2c,0x834c8b6c,0x834c8b8d,0x9befa410,0x6a897aeb,0x6a686208,0x59e77acb,0x51a65165,0x6a2861e7,
-0x7aca7aca,0x498651c6,0x8b4d936d,0x51e772aa,0x72eb51c6,0x9bef93ce,0x49855a28,0x830c834c,0x51a651e6,0xac50832c,0x6269834c,0x7b2b72ca,0x62696247,0x8bae834c,0x5a488bce,0x7b2c6a8a,0x72ca7b0b,0x7b0b7b0b,0x9bef9bce,0x494459e7,0x59c749a6,0x59c65185,0x6a49728a,0x8b4d6208,0x49656a69,0x830c5a08,0x51857b0b,0x834c51a6,0x62696aaa,0x5aa85a48,0x7b8d7b8d,0x52275a68,0x7aeb51e7,0x62086a49,0x498559e7,0x51c64165,0x938e7aeb,0x49445a07,0x72ca49a5,0x7b0c938e,0x6a895a07,0x30e35a08,0x6a8930e3,0x5a287b0b,0x72a951c6,0x62696248,0x6a696a8a,0x62287b0c,0x49a63904,0x51a65a07,0x51a55186,0x72ca6a69,0x51e77aea,0x834c49a6,0x39256248,0x59e851a7,0x59c7728b,0x59874104,0x62285186,0x414551a6,0x5a076207,0x624751c6,0x41646207,0x832c7aca,
-0x41254985,0x5a076248,0x51c63903,0x830b7aeb,0x310351e7,0x62086249,0x51a638e3,0x5a2872aa,0x51c64165,0x8b6c9c0f,0x5a685227,0x736c7b4c,0x5a295a69,0x836b4163,0x7b4aac6f,0xac6f7ae9,0x62069c0d,0x9bcc9bac,0x6a057aa8,0x8b2a8309,0x72886a46,0x6a469bec,0x93ab72c8,0x83499bec,0xac4d8b8b,0x62467ae9,0x72c88b6b,0x7aea8b4c,0x93cc72c9,0xbcf0a42d,0x49839bec,0x7b096267,0x8b4a8309,0x6a67832a,0x832a832a,0x51a56a88,0x62475a06,0x62675a06,0xbcd193ed,0x6247834a,0xac4f8b6c,0x51a58b4c,0xac4f7aca,0x728859e6,0x938c938c,0x59e572a8,0x624851a5,0x6aca836c,0xbd338bcd,0x6aeaa450,0x93ce830b,0x72ca7b4c,0xa3ef6aca,0x938eac30,0x49e66248,0x72aa6269,0x6a6972aa,0x6aaa51e7,0x7b2b8b8d,0xa4308b8d,0x6248838c,0x38e35185,0x82eb6a49,0x41046a28,
-0x7acb59a6,0x8b2c9bae,0x6a697289,0x49854986,0x626951a6,0x7aeb9bcf,0x498551a6,0x624959e7,0x72aa7aca,0x72ca5a07,0xa450838c,0x8b8d5a07,0x72ea93ef,0xb4d28bce,0x5a487b0b,0xa430834d,0x51c772ea,0x51a651a6,0x7b0b6a48,0x49a65a07,0x6a284965,0x62077289,0x51854965,0x72aa59a6,0x51a67aaa,0x5a073904,0x622872ca,0x49a638e4,0x8b8d8b6c,0x52065a08,0x9c6f7b8c,0x41647b6d,0x9bce6aaa,0x6a28a3af,0x6a6938e3,0x7aeb8b6d,0x496549a6,0x7b2b4144,0x7aeb9bef,0x416551c6,0x41654124,0x59e75a07,0x7aeb72aa,0x41856228,0x62684985,0x5a07834c,0x82ec830c,0x310351c7,0x49864144,0x59e759e7,0x6a69832b,0x5a0772ca,0x6aaa5207,0x51e65a27,0x62086269,0x622972ab,0x41254965,0x59864945,0x62085165,0x41646a48,0x72ca59e6,0x51c66248,0x51c65a27,0x62086a69,
-0x61e74985,0x49866229,0x62284985,0x6a894964,0x49a6938e,0x51e72881,0x41456269,0x8b4e4166,0x5a066228,0x940e834b,0x41a66aca,0x7b2c626a,0x49a672eb,0x9bed5a46,0x72c993cc,0xac8f9bec,0x5a056aa8,0x8b8a7ac8,0x6a468329,0x8b4a82e9,0x6a666a47,0x62267ae9,0xbcf07ae8,0x6a879bec,0xb48e9c0c,0x62686a67,0x830a7b0a,0x6aa8832a,0x7b096a67,0x93cc93ac,0x6aa77b09,0x72c8834a,0x9bed836a,0x9bcc8bac,0x8b8c9bed,0x7b0a6a88,0x41445a06,0x72e951c5,0xac6fac8f,0x62676aa8,0xa40e72a8,0x51c5938c,0x72a851e6,0x7ac982e9,0x9bac6a67,0x6226936b,0x6a486205,0x940e7b0b,0x838d6ac9,0xac50bcd2,0x6a697aeb,0x93ef832b,0x62287aeb,0x82eb51c6,0x93aea410,0x59c66248,0x62276268,0x6aaa6228,0x62695a07,0x8b8d8b8d,0x832c6aa9,0x832ca40f,0x492459c6,0x59c75186,
-0x936d7269,0x62487acb,0x41254965,0x622951c6,0x72aa72ca,0x49864965,0x7acb832c,0x62284944,0x7aeb938e,0x7b2c4986,0x72eb9c2f,0x9c5051e7,0x838dac91,0x5a6872cb,0xa4307b2c,0x51e66269,0x72aa6a69,0x51a66228,0x5a0851c6,0x51c65a28,0x61e75185,0x936d934c,0x49656228,0x51a65186,0x51866a48,0x6a286207,0x51c64164,0x624872ca,0x51e749a5,0x5a686aca,0x730b5248,0x5a486b0a,0x6a486a69,0x59e782ec,0x72aa4945,0x8b4c9baf,0x41644144,0x936d7aeb,0x498672ca,0x41643923,0x5a074165,0x72ca832c,0x6a6951e7,0x6a8972aa,0x41445a07,0x49865206,0x6a895208,0x49a649a6,0x62285a27,0x626872aa,0x62486268,0x93ce8b8d,0x72c96aa9,0x9c2fa44f,0x6a697b0b,0x414559e8,0x390430e3,0x72896208,0x39034144,0x51a56228,0x51c651c6,0x6a895a27,0x62476227,0x4986832c,
-0x938e51c7,0x4986832c,0x7aea51e6,0x414459e6,0x728a51e7,0x41854986,0x6aaa72aa,0x41243924,0x62a97b0b,0x730b5228,0x72eb838d,0x418551e8,0x6aaa72ca,0x93ed93cc,0x7b2a72c9,0x9bedac6f,0x8b6a6287,0x6a878b6b,0x93ac6a46,0x59c48b6b,0x938b6a47,0x62066a67,0xac6d938b,0x834a7b08,0x836aac8f,0x93ab5a26,0x832a6a67,0x72a882ea,0x9c2d834a,0x9c2da48e,0x836a6287,0xa42d9c0d,0x9c0d93ec,0xa40dac6f,0x9bed93ac,0x93ad8b6b,0x49a56aa9,0x72c959e6,0xb4b0a44e,0x51e57ac8,0xb4906a88,0x51a5a3ee,0x5a0651a5,0x832a7288,0x6a466a47,0x8b2a7ac9,0x6a6882ea,0x93ce6a48,0x5a28ac70,0x834c72aa,0x6a8972ca,0xb4b193ad,0x726993ad,0x7acb6a49,0x7acb830c,0x6228728a,0x62484985,0x9bef936d,0x62487b0b,0x5a685a88,0x836c6269,0x72ca8b6d,0x622872aa,0x8b0b7268,
-0x51a67aaa,0x622851a6,0x49856228,0x93ae7289,0x830cac0f,0x62074124,0x59e77aaa,0x62085186,0x72ca7aeb,0x628951e7,0x8b8d730b,0x72ea6289,0x8b8da451,0x6a8a49a6,0x832d93cf,0x51c65a08,0xa3ef6a8a,0x41458b8d,0x7aea51a6,0x72eab492,0x49454985,0x6a4951c6,0x59c7728a,0x59e759c7,0x41244945,0x830c6208,0x496572aa,0x72896208,0x414459c7,0x8b6d6289,0x49a67b0b,0xa4305a48,0x59e7a40f,0x72494965,0x59a76a49,0x51c64986,0x51c76248,0x59c74985,0x41444985,0x59e74965,0x6a497aca,0x5a284985,0x72eb51e7,0x39236a89,0x6a8a3944,0x7b2c7b2c,0x6a8a72cb,0x416549a6,0x41644185,0x51c651c6,0x8b8d6a89,0x832b7b0b,0x5a497b0b,0x72eb5207,0x51e7730b,0x38e33104,0x59c74965,0x38e35186,0x59e73904,0x51a64944,0x62277aeb,0x6a6849a5,0x6a696a88,0x6a89832b,
-0x834c5a28,0x5a07834c,0x832c5a07,0x390351c7,0x728a49a6,0x41245a07,0x72eb49a6,0x41257b0c,0x732c5228,0x52276b0a,0x832c6228,0x5a077b2c,0x6a0851a6,0x7b2abcf0,0xa48f6ac8,0x5a46a46f,0x834a5a06,0x7ac9ac6f,0x93ac5a06,0x620693ac,0x7ae959e6,0x6a6772a7,0x9beca44d,0x8b6b6a87,0x7b29ac6e,0x832a6266,0xa3ed7ae9,0x62676a88,0xa46ea40d,0x8b8b8bab,0x8bab836a,0xac6e8bcc,0x834aac8f,0x93cc6a67,0x9bedac6f,0x938c832a,0x496472a9,0x93ac5a26,0x9bedc4f1,0x62266a88,0x938c6226,0x728893ad,0x620659e6,0x59e551c5,0x82e972a8,0x83097267,0x6a48936b,0x59e64985,0x8b8d9bce,0x51c651e6,0xac309bae,0x6a897b0b,0x8b2c830c,0x728a934d,0x6a696228,0xa3cf832c,0x49a572aa,0x830b72cb,0x7b4c8bad,0x72ea6aca,0x62696aea,0x93cf6aca,0x8b4ca450,0x62287269,
-0x416559c6,0x7acb51a6,0x410459e7,0xac107acb,0x5186936d,0x62085185,0x59e759e7,0x5a286228,0x7aeb6228,0x5227832c,0xac917b2b,0x72eb93ef,0x52276aaa,0x8b6c5a28,0x51c66a89,0x62288b4c,0x830c4124,0x6207936e,0x5a074985,0x936e830c,0x49656228,0x59e759e7,0x49654965,0x72896207,0x416551c6,0x49864124,0x49455186,0x41454985,0x51e74985,0x51e74965,0x49c65a48,0x830b49c6,0x6207938d,0x6a284145,0x49856a08,0x5a074124,0x8b6d9bcf,0x39034985,0x8b4c59e7,0x414582eb,0x41443924,0x7aeb51c7,0x52076a89,0x31033924,0x8b8d6269,0x49a66a69,0x51e749a6,0x5a0751c7,0x51e75a07,0x49c649a6,0x5a2849a6,0x834c7b2c,0x8b8d8b6c,0x72eb7b2b,0x5a2872eb,0x51c751c7,0x38e44966,0x49654945,0x82eb4165,0x59e6832b,0x62275a07,0x832b72a9,0x728972a9,0x6aaa72ca,
-0x7aca6a89,0x52076269,0x49a65a48,0x6aaa4966,0x39045a08,0x834c72eb,0x49665a08,0x72cb6269,0x49c64986,0x5a486aeb,0x5a2851e6,0x8b2c7289,0x4125726a,0x72e9836a,0xa42d9c0d,0x6aa872c9,0x7b2a9bed,0x6a876267,0x8b6b9bcc,0x82e96226,0x62069bcd,0x8b8b51a5,0x6aa8b4af,0xb4cf8b6b,0x6a8793ac,0x72c8834a,0x8b6b7ae9,0x6a685a06,0x9c0d8b6a,0x7b29ac6e,0xa48e7b6a,0xa46eb4d0,0x5a46834a,0x522549a4,0x9bed7b0a,0x5a26834a,0x51c549a5,0xa42e7ae9,0x8b8cac6f,0x62266a87,0x6a685a06,0x8b2a8b6b,0x59e651a5,0x6a478ae9,0x9bac7287,0x6a268b09,0x6a686a68,0x496559e6,0xb4d17b0b,0x5a0793ae,0x8b6d6248,0x62689bae,0x72aa51c6,0x832c72ca,0x59e76a89,0x728a6228,0x7aaaa3cf,0x72ca4144,0x7b4c9c50,0x942f72eb,0x6aca83ad,0x93ef49c6,0x728aa42f,0x41454144,
-0x82eb6228,0x4965726a,0x82eb51a6,0x62087aeb,0x726951a6,0x51c78b0c,0x624951a6,0x72aa938e,0xa43072ca,0x52078b8d,0x9c2f6aca,0x62a9ac91,0xa4305a28,0x6248a451,0x624851c6,0x830c9bcf,0x59c751c6,0x7aca72aa,0x622859e7,0x62088b4d,0x49854985,0x938e72aa,0x4965830b,0x51864144,0x62074965,0x62287acb,0x59e72881,0x72699b8e,0x59c74124,0x51a66a69,0x5a0730c2,0x6208830c,0x62284965,0x49866a07,0x59c74945,0x59c76208,0x72496227,0x49654965,0x62486a69,0x39044164,0x72aa51e7,0x49c759e7,0x49a649a6,0x49a54185,0x52075207,0x41853103,0x51e751e7,0x62485207,0x7aeb6aaa,0xac70836d,0x5a287b0b,0x8b8d5206,0x5a2793ae,0x51e74164,0x6a6a6289,0x494659e8,0x41244965,0x6a484986,0x49a54964,0x49a57aca,0x51c630e2,0x62276a89,0x8b4c5a06,0x51c76248,
-0x8b6d93cf,0x6aaa49a6,0x624893ce,0x7b2c49c7,0x416551e7,0x6a6a72eb,0x41454965,0x7aec4165,0x41658b6d,0x7b4c4185,0x41656aa9,0x726959c6,0x7a6a934e,0x8b6b5a26,0x93aba44e,0x6a686246,0xb46fa42f,0x624751c5,0x8b6b9bed,0x6a8759e6,0x8b2a9bcc,0xa42d6226,0x72e9a42e,0xa42d938b,0x72c87b49,0x6226834a,0x72e89bcc,0x9bec5a25,0xa44ebcd0,0x62868bac,0xa46e93ab,0xa44e9c2c,0x7b09a44e,0x41644163,0x49a44983,0x49a451c5,0x7aea5a06,0xbcf1a42e,0x6226a42e,0x6a885a26,0x6a4772a8,0x62476a67,0x61e659a5,0x72887aa8,0x59e56206,0x8b6b82ea,0x728872a8,0x51e5832b,0xa40e6227,0x8badbcf2,0x498651e7,0x830b6248,0x51a67acb,0x62286a49,0x8b4c72aa,0x51a672ca,0x728a59e7,0x8b8d93ad,0x4a066aa9,0xacd2838d,0x6aa99c0f,0x626872ea,0x62498b6d,0x620851a6,
-0x8b6d728a,0x4965832c,0x938e6228,0x49857acb,0x8b6d5a07,0x51c69bae,0x93ad59e7,0x7b0b7b2c,0x72ea7aeb,0x62687b0c,0x8bad6aca,0x72ca8bad,0xac508bae,0x6aaa8bae,0x51c651c6,0x9bae7aeb,0x4965728a,0x8b4d6228,0x6a89832c,0x6a89a3ef,0x51e66228,0x5a075186,0x51c65a07,0x7aeb72aa,0x49854986,0x7aeb8b2c,0x41444124,0x7aaa6a28,0x390361e7,0x59e76249,0x412430e3,0x8b2c6a69,0x59e75185,0x62288b0d,0x7aab4124,0x72aa93ad,0x49654124,0x5a0772aa,0x494451a6,0x6a696208,0x49864965,0x49a649a5,0x5a285a28,0x51e749a5,0x836d7b0b,0x51c67b2c,0x51c63903,0x6a896269,0x49a65a07,0x51e649c6,0x93ee72ca,0x72ca834d,0x7b0b6aa9,0x72eb832c,0x5a086aca,0x39043103,0x620872ab,0x61e730a3,0x41446207,0x62473902,0x49856207,0x8b6d8b4c,0x726959e7,0x5a076a48,
-0x7b2c72eb,0x62895227,0x6a898b8d,0x7b4c49a6,0x31046a8a,0x7aca6208,0x498651a6,0x49856a69,0x62494165,0x72ea832c,0x62286268,0x40e451c6,0x598640e4,0xb46f836a,0x624693ac,0x8b4b72c9,0x62275a06,0x938c830a,0x59e66a68,0x83097b09,0x5a0651e5,0xbcd0832a,0x6aa87309,0xac4eac6e,0x626672a7,0x7ac9830a,0x62468b8b,0x7b096a88,0xac6f93ab,0x49a493cc,0x9c2d6267,0x9c0dacaf,0x9c4d93ec,0x624693ab,0x51e551c5,0x6aa85a46,0xb4908b8c,0xa42ebcd1,0x5a267b0a,0x832a5a06,0xa3edac0e,0x62067ac9,0x518559e5,0x59c659a5,0x830a938c,0x938c6a27,0x6a67a3ed,0x49a56247,0x7aea51a5,0xa450a470,0x49a56aea,0x5a0851a6,0x938e72aa,0x49a67aeb,0x7aeb4165,0x6a698b8d,0x6a6951c6,0x6aaa832b,0x93ae730b,0x72eb838d,0x62896aaa,0x7b0b9c0f,0x498649a6,0xa3ef93ae,
-0x5a076248,0x6a6951e7,0x6a49728a,0x51a66208,0x51c64985,0x51c65a07,0x62486228,0x93ef6a8a,0x5207732b,0x8bce7b2c,0x8bae7b2b,0x7b0c72eb,0xac5193ce,0x51a6938e,0x49864986,0x51e759c6,0x5a075a08,0x830c728a,0x6228728a,0x728a61e8,0x72caac30,0x93ae5a07,0x49a69bcf,0x5a074985,0x624851c6,0x41455a07,0x59e74965,0x416551c7,0x7aeb51a6,0x41455a08,0x832c7acb,0x51c74124,0x59c78b4d,0x62286248,0x51a659e7,0x49a64985,0x49654145,0x59e76a69,0x72aa3904,0x6a89938d,0x49a638e3,0x832c832b,0x8b8d832c,0x41856aaa,0x49a64165,0x51e751c7,0x7b0b834c,0x93ce728a,0x72aa9bef,0x93ae834c,0x6aaa72ca,0x832c9c0f,0x8bae6269,0x832ca451,0x59e749c6,0x412451a7,0x59c74945,0x41244965,0x72aa72aa,0x41643924,0x414449a5,0x938d72aa,0x62487aeb,0x626972aa,
-0x5a485228,0x5a486289,0x5a6849c6,0x5a0772eb,0x41866248,0x72ca4986,0x6a497b0c,0x390449a5,0x62284144,0x6a696228,0x51e76a89,0x51c64986,0x30a14104,0x938cbcf1,0x51c45a06,0x9bac7ae9,0x51c56a68,0x936c8b2b,0x59e66a47,0x8bac938c,0x6aa751e5,0x834aa44e,0x9bec72c8,0x7ac89c0d,0x7b096aa7,0x8b6b72a8,0x5a068329,0xac8f832a,0x93ccbcd0,0x5a256267,0x5a667309,0xa46e7b2a,0x93cca46e,0xbd11a44e,0x9c2eb4af,0xb4d1ac8f,0xb4b0b4d1,0x7b2aa44f,0x62476246,0xb4906267,0x938ba3ed,0x6a478b4b,0x6a6861e5,0x498459c6,0x72886227,0x62267288,0x7b0951e5,0x6a68a42e,0x51e659e6,0xa4708bcd,0x72ca838c,0x6a69830c,0x6a696208,0x834c5a28,0x7aeb93ce,0x8b4c6228,0x832bac51,0x6a894986,0x9befa40f,0x62697b2c,0x7b0b51e7,0x72aa8b6d,0x498551c7,0x830c5a07,
-0x5186834c,0xac7151e7,0x59e79bcf,0x6a8959c7,0x49856228,0xb4927acb,0x5a08832c,0x940f7b2c,0x5a68732b,0xacb18bce,0x51e772a9,0xb4b2a430,0x728993ce,0x72ca6228,0x51a67b0b,0x6a6951c7,0x6248832c,0x93ce72aa,0x59e782ea,0x62485a07,0x6a687acb,0x9bef6248,0x6a69ac50,0x6a896269,0x5a4849a6,0x832c9c0f,0x6a893924,0x5a0893ae,0x6a894986,0x41656228,0x8b4c59e7,0x4965832c,0x72a982eb,0x49654165,0x830b8b6c,0x61e74945,0x59e78b2c,0x49653904,0x59c751c7,0x412451a6,0x6a894144,0x7289a450,0x72ea5a07,0x51e772cb,0x39253924,0x7acb3945,0x4986832c,0x6a696248,0x416551a6,0x39444185,0x93ce72ca,0x72ea72eb,0x9c0f9c0f,0x41456a8a,0x7b2c49a6,0x51c772ab,0x62283904,0x5a27830b,0x832c51a6,0x8b8c6a68,0x93ad8b8c,0x832c8b8d,0x72ca8b4d,0x6aca4165,
-0x52075a28,0x8bce940f,0x730b5a48,0x49c68b8d,0x7b0c6a89,0x414449c7,0x8b4c8b2c,0x49653904,0x62474165,0x51a651a6,0x51c761e8,0x38e33924,0x59435164,0x6267938b,0x832a832a,0x6a476206,0x7ac97ac9,0x6a476227,0x62277288,0x5a256226,0x93ab5a05,0x832ac4f0,0xa42d72a8,0x6a8793cc,0x7b0972c8,0x93ab6a66,0x7ae96247,0x9bcca42d,0x93ac93cc,0x51c45a26,0x62465a05,0x62666aa7,0x7b096aa8,0x8b8b7b29,0x9c2d9c2e,0xa44e9c2e,0x7b4b9c2e,0x72e96aa8,0x836b838b,0x93ac72a8,0xac4fb48f,0x5a06830b,0x9bad7ac9,0x51856226,0x49a56a88,0x9bcd7aca,0x62467ae9,0xac0e9bac,0x51e67ac9,0xa4506268,0x5a489c2f,0x7aeb6228,0x5a077b0b,0x62685207,0x7b0b7aeb,0x72ca7aea,0x72eb6289,0x7b0b72eb,0x6a8972aa,0x7aea7acb,0x51a65a28,0x5a27830b,0x5a287b2c,0x7aeb4986,
-0x41447b0c,0x8b2c5a08,0x51a682eb,0x7aca61e8,0x51867249,0x8b4d728a,0x51c66228,0x834c93ce,0x52275207,0xa4507b2c,0x72aa6aa9,0x93ae8b6d,0x6a69938e,0x7acb59e7,0x5a276a8a,0x6aa96a89,0x8baea450,0x93cd7aeb,0x59c78b8d,0x830c59a7,0x8b6d8b4c,0x6248728a,0x6aa972eb,0xa450836d,0x5207730b,0x7b0b7b6c,0x51c651c6,0x520751e7,0x834c5a08,0x41246228,0x6a8959e6,0x41456249,0x938e5a07,0x49655a28,0x62686aa9,0x59e74124,0x59e78b2d,0x6a694124,0x5207832c,0x728a4145,0x51a672ca,0x5a076a89,0x49a66248,0x5a286a69,0x6a6a4145,0x72cb72ab,0x622851a6,0x49c649a6,0x834c72eb,0x6a8972ca,0x520751e6,0x72cb730b,0x52076a89,0x49863924,0x62496aca,0x72cb3925,0x30e36249,0x5a284165,0x52265a48,0x93cd5a48,0x62a97b4b,0x62896aa9,0x72aa5a48,0x6a895227,
-0x834c8bad,0x6a896aea,0x834c6aa9,0x49a672eb,0x7aea5a28,0x622849a6,0x6a49832c,0x49864145,0x414451a6,0x59c672aa,0x518540e3,0x620651c6,0x72048267,0x49845a06,0xb48f9bcc,0x51c47ac8,0xb46f9bcd,0x49846206,0xb42f9bce,0x49a372a8,0xac8f836a,0x72c87b29,0xac4ea42e,0x6a876aa8,0x6a878329,0x7b0972c8,0x6a876226,0xac4e8b8b,0x51c58b4b,0x834a6267,0x834b9c0d,0x8b6a6287,0x7b099bcc,0x6a876225,0x6a676a87,0x62676267,0x7b2a72c9,0xacb093ec,0x836a9c2e,0x7ae9a42e,0x72c972c9,0x496459e6,0xac2f7289,0x5a069bed,0x5a0659e7,0x72a951a5,0x5a06830a,0x82ea6227,0x51c67248,0x8b8d51c5,0x7aca9c2f,0x61c751a6,0x72aa4945,0x72ea832c,0x498551e7,0x93ce7aca,0x5a2872ca,0x93ae832c,0x51c7832b,0x8b4d5a28,0x51a68b2d,0x7aca5185,0x9bcfb451,0x41255a28,
-0x6a895a07,0x59e75186,0x494559c7,0x6a2861c7,0x59a661c7,0x59e759e7,0x51e76a48,0x6a695a28,0x834c7b2c,0x834c7b0b,0x59c651c6,0x832c7aeb,0x5a076a69,0x49865a28,0x82eb51c6,0x832b9bee,0xa4509bef,0x7b2b8bad,0x51a672aa,0x6a696207,0x93ae72aa,0x836c832c,0x7b4b9c50,0x6aaa730b,0x49e76289,0x72ea732b,0x72ca6aa9,0x836d5a48,0x6a896289,0x6aa94986,0x51e7830b,0x728a4165,0x51c67aeb,0x6a696269,0x72ca6228,0x59a67acb,0x5a074144,0x59e672aa,0x51a64164,0x51e651e6,0x51a54986,0x938d834c,0x30c251a6,0x59e85a07,0x414530e3,0x498651c7,0x41653904,0x5a0830e4,0x6248830b,0x5a283123,0x31036269,0x41654185,0x49864185,0x7aeb51e6,0x6acb8b6d,0x41864a07,0x7b0b7b2c,0x6aa949c5,0x732b9c0e,0x6b0a41e5,0x736b8bee,0x9c0f838c,0x836d8bce,0x5a48834c,
-0x5a677b4b,0x8b8d730a,0x5a2872ca,0x7b0b5a28,0x39245a08,0x6a894165,0x6a89830c,0x51a63904,0x412572cb,0x622849a7,0x38e14964,0x72255963,0xc42cab8a,0x938ca42e,0x62266a67,0x7ae97ac9,0x62476226,0x6a476247,0x7ae96a67,0x62676a67,0x9bec93cb,0x8b4a8b4a,0x834ba40d,0x72a76a67,0x72c972a7,0x6a679bed,0xac6e7b0a,0x8b6bb4af,0x8b6a6246,0x836aa42d,0xac8fa42d,0x93ac9c0d,0xa42ea44e,0x6aa7832a,0x832a72a7,0x5a465206,0x93ed7b09,0x93ed9bed,0x7b2aac8f,0x62876267,0x7ae9832a,0x62276a88,0x72a951c5,0x7ae9ac0e,0x49645184,0x5a066206,0x7aa95184,0x72479bac,0x59a659a5,0x6a8851c5,0x832c8b8d,0x72aa51a7,0x49c68b4d,0x6aca5a07,0x59e76a69,0x62a95a07,0x5207836c,0x5a073924,0x7aca8b6d,0x6a495186,0x6a498b2c,0x6a895186,0xa3ef830c,0x51c77b0c,
-0xa3ef936d,0x516661c7,0x934d6208,0x4945726a,0x9bae82eb,0x620759e7,0x72aa832c,0x7aeb4964,0xa450b491,0x62086aaa,0x6a8a93ae,0x51c66228,0x8b6d6a69,0x59e7830c,0xa4506269,0x7b4cbcd2,0x7b2c6289,0x838c834c,0x5a078bad,0x7aeb7acb,0x9bae832c,0x7b0b8b6d,0x8b8d93ee,0x7b6c6aa9,0x6a897b2c,0x836d832b,0x832c832b,0x6aca72eb,0x6ac96aa9,0x72aa49c6,0x7b0b9bce,0x62283104,0x51e77aeb,0x72aa832c,0x728a51a6,0x59c7830c,0x728a4985,0x51c68b6d,0x8b2c4144,0x4165832c,0x728a51a6,0x626951c6,0x28c251c6,0x62286249,0x496630e3,0x41654965,0x39244985,0x392430c2,0x830b6a89,0x416551c7,0x41443924,0x49a64165,0x72ca6a89,0x72cb6a8a,0x624951c7,0x62699bef,0x730b6aaa,0x5a485a27,0x730a5207,0x732b838c,0x838d734b,0x732b838c,0x52275a89,0x730b836d,
-0x838d838d,0x8b8d836c,0x51e67b2c,0x9bee51c6,0x62275a07,0x5a077aeb,0x6a4959e6,0x39034145,0x41454986,0x41454966,0x7a675184,0x8a879ae9,0x8ac77a26,0x830b72a9,0x62066247,0xabee9bad,0x59c559e5,0x934b9bac,0x49635a06,0x9bcc6246,0x72e8a46e,0xac6f6aa8,0x6a87a40e,0x830a8309,0x832a72a8,0x624672c8,0x9c2d832a,0x7b098bcb,0x940c7b49,0xaccfa48d,0x93cc9c2d,0x830a9bcc,0x830a72a8,0x72a87ae9,0x7b098b6b,0x62466267,0xa42e7b2a,0x9c0da44e,0x7b099c0d,0x7ae95a05,0x93cc93ab,0x7ae9938c,0x624651e5,0x9bcc9bed,0x51a472a7,0x7ac97287,0x59e55a05,0x934b82e9,0x496459c5,0x51a55185,0x7aea72ca,0x8bae5a28,0x6aeaa471,0x51c65207,0xac51834c,0x4165938d,0x9c0f6249,0x6a498b6d,0x82ca59e7,0x5186728a,0x6a69728a,0x49855186,0x830c830b,0x59c76207,
-0x82ec7aab,0x518659c6,0x8b2c7a8a,0x61e76a28,0x7aaa7aaa,0x620859c7,0x728a8b0c,0x7aeb4965,0x9befac71,0x62486228,0x8b4d9bce,0x518659e8,0x8b8d7b0c,0x51c672aa,0x93ee6268,0xa470a450,0x732b730b,0xa44f940f,0x51c77b4c,0x6a486a89,0x7aea6a69,0x72ca830c,0x9bee832c,0x834c7aeb,0x62698b6d,0x834c51e7,0x72ca938e,0x628972a9,0x9c2f9c50,0x62696aa9,0x6a897b2b,0x72ca4185,0x6a696aa9,0x51c651c6,0x832c8b2c,0x59c76208,0x49654965,0x496649a6,0x62274965,0x49a65a08,0x6a896227,0x51c64985,0x39034165,0x51c651e6,0x51c63924,0x51e759c7,0x6a8a72ca,0x51a66227,0x39244144,0x39033944,0x62484143,0x51e66a88,0x9c0f6a89,0x72ec9c50,0x5a2849a6,0x416551e6,0x72cb72ca,0x7b4c6aa9,0x7b2c7b2b,0x7b2b93ce,0x732b5206,0x5a276aea,0x5a477b4c,0x940f6aca,
-0x838d8bce,0x6a8a7b2c,0x494559e7,0x62076228,0x6a484965,0x6248830c,0x7acb6248,0x496649a6,0x59e87acc,0x38a14104,0xa34a7207,0x82679b4a,0x82467a46,0x59e64964,0x6a886a47,0x7aa87aa9,0x61e659a5,0xa3cc938b,0x51846a47,0xac4d8b4b,0x72a87b09,0xa42dac6e,0x72a86267,0x72c88b6b,0x938b7ae9,0x7ae851e5,0xb4b0ac4e,0x6aa78b8a,0xb4ef93eb,0x940ca46d,0x72e9838a,0x72a86a87,0x6a887ac9,0x7b2a6a88,0x8b6b8b8b,0x62878b6b,0x8bab834a,0xa44e8b8b,0x72c8b4b0,0x7ae951e5,0x836bac6f,0x9c0d7b2a,0x4163832a,0xbccf6267,0x7ae9ac4f,0x624659c5,0x49436a67,0x6a065184,0x726759c5,0x496461e6,0x9bee6247,0x5a28a42f,0x6aaa730b,0x62486aca,0x72aa6248,0x62076a89,0x938e5a08,0x728aa430,0x5a0751c7,0x51a659e7,0x6a285186,0x51a66a28,0x59e76208,0x59c661e7,
-0x7a8a6207,0x59a74925,0x6a087aaa,0x51654965,0x51a659c6,0x59a74985,0x6a6972aa,0x72aa6a69,0x6a8a7aeb,0x5a0851c6,0x622859c7,0x72aa7aeb,0x51c66248,0x93ce72ca,0x832c5a28,0x8baea450,0x6aca5a48,0x93ef8bce,0x52077b4c,0x938d6207,0x51a67289,0x518551a6,0x72ca51c6,0x6269832c,0x6aa97b2c,0x5a085a28,0x830c6249,0x6269832c,0xacb28bce,0x6aca6aca,0x62a993ae,0xa4305a28,0x9bef9c0f,0x6a896a89,0x938d9bce,0x6a696228,0x5186832c,0x9bae4985,0x4165832c,0x7aeb49a6,0x41047acb,0x9bef6a48,0x28a15a07,0x7b0b6249,0x39246228,0x51c64165,0x49c649c5,0x62485a07,0x62696269,0x72ca6248,0x836c6a89,0x7b2b8b8d,0x7b6d730a,0x52287b2d,0x5a085a28,0x49655a07,0xa42f7b0b,0x730a8b8d,0x8bad8bad,0x8bce838c,0x6aaa6aea,0x51e76289,0x6a895a48,0x6aaa72ea,
-0x7b4c6aca,0x59e87b2c,0x8b4d6249,0x49656208,0x62284144,0x51a65a07,0x8b0c7aca,0x59c751a6,0x41446a69,0x6a273922,0x7a278268,0x82a78287,0x7a8682a7,0x72a93903,0x938bb44f,0x728859a5,0x7aa89b8b,0x6a675a25,0x7ac85a06,0x836a9bec,0x93cc6287,0x8b6ba42e,0x832a6267,0x72a86267,0x6a87938b,0xac6e72c8,0x93ccac6e,0x834a8b6a,0x9c2c8baa,0xa48ea46d,0x72c893cc,0x6aa86aa7,0x72a972c9,0x49646247,0x9c0d6247,0x832ac512,0x93ed5a26,0x93ecac6f,0x62677b09,0x7b0a7b4a,0xa42e9bed,0x7b2a93ac,0x6aa87b09,0x5a4649a4,0xb48fa42d,0x61e6938b,0x59e54143,0x59c57288,0x6a274943,0x51846a47,0x834c4943,0x6aaaac71,0x72eb49c6,0x834ca451,0x59e751c7,0x6a896a69,0x498659c6,0x830c6208,0x59a7728a,0x49655165,0x6a295186,0x59a782cb,0x59a64924,0x61e86a29,
-0x61e74945,0x59a782ab,0x59a64945,0x6a087248,0x59e74945,0x728a82eb,0x59e75186,0x938d9bcf,0x62085a07,0x728a7acb,0x51a65186,0x830b72aa,0x59e76228,0x936d7acb,0x5a278b8d,0x7aea8b4d,0x72eb51e7,0x6249834c,0x49866269,0x7acb4965,0x6228938e,0x7aea6248,0x49855a07,0x62696a89,0x626849a6,0x7b2c9bef,0x51c74985,0x49c659e8,0x730b51c6,0x72ea6aca,0x7b4c93ce,0x93ae5a48,0x834c832c,0x7b2b6269,0x6a69834c,0x832c6a89,0x49657aeb,0x938e4124,0x41458b0b,0x936d51e7,0x4144834d,0x624849a6,0x41646248,0x41243904,0x62294965,0x41656228,0x5a0749a5,0x416551e6,0x836d6a89,0x7b4c730b,0x940d7b4b,0x628862a8,0x9c2f940f,0x52076aaa,0x498551c7,0x7b2c5208,0x7b0b93ae,0x72ca6269,0x49e77b6c,0x7b2c732b,0x52076aaa,0x62695a27,0x6aca6289,0x6aca5207,
-0x8b6e7b0c,0x59e772cb,0x72aa6269,0x59e751c6,0x51864965,0x51a76208,0x51a64986,0x49444104,0x412238e3,0xa36b7aa8,0x59638268,0x9b497204,0xb40cac0c,0x622672c9,0x59e56a47,0x7ae959c5,0x93ac9bed,0x498351a5,0xac4e72a8,0x624693ac,0xb4b08bab,0x5a059bed,0x6aa872a7,0x836b6aa8,0x62477b29,0xa40e8b6a,0xac6eac8f,0x72c772e9,0xb4cfa42d,0x836a9c4d,0x72e972c8,0xac4f7b09,0x9beeac6f,0x5a26834b,0x8b8c6247,0x72c9ac6f,0x836a6267,0x7b0a8b8b,0x52055a26,0x9c0e7b0a,0x838b7b09,0x7b2a93ed,0x7ae97309,0x41635a27,0x8b6b59e5,0xa42eac6f,0x59c58309,0x9bcc72a8,0x390159e5,0x49634942,0x5a074123,0xa47093ce,0x49c76248,0x51e76228,0x59c74145,0x934c82eb,0x49456a69,0x936e728a,0x59a77aaa,0x72286a08,0x51864924,0x51657228,0x8aec5166,0x518682cb,
-0x59c64944,0x49657229,0x61c74925,0x72497aab,0x6a494124,0x8b2ca3cf,0x620859c7,0x8b0c8b2d,0x51a66207,0x61e86208,0x59e77248,0x59c661c6,0x728a7a8a,0x7aeb6a49,0x59e67aeb,0xb4b26a89,0x8bae93ae,0x62488b8e,0xa430832c,0x51857aca,0x51a65186,0x72895185,0x59e7830b,0xac9149e6,0x41a59c0f,0x93ae6aca,0x62486249,0x832c9c2f,0x7b2c5a48,0x6aca93ee,0x72ca5a07,0x5a686aca,0x6aaa7b0a,0xac917b0b,0x6289a410,0xb4b1834c,0x51a68b8d,0x51c66228,0x41254965,0x51c74125,0x39036228,0x624930c2,0x498672a9,0x51c730e3,0x49655a28,0x51c649a6,0x6a68832c,0x6aa96228,0x838d7b0b,0x6ac983ad,0x7b4b5a68,0x83ad8bed,0x732b7b4c,0x7b2d7b2d,0x62695208,0x834c49a6,0x6aaa6aca,0x93ce8bad,0x6268834b,0x72eb5a28,0x626972ea,0x6a896269,0x6a896269,0x834c51c7,
-0x72ca93ae,0x5a0751c7,0x51c66a89,0x7aeb49a6,0x6a6a59e7,0x622a936e,0x82eb59c7,0x40e25186,0x72254922,0x8a8792e8,0x9ac88a67,0x82a78aa7,0xa36a8ac7,0x6206832a,0x8b4a6206,0x6a877ae9,0x62679bcd,0x7ae951c5,0x7b2aac6e,0x9bcc5a26,0x9bedbcf0,0x72a86246,0x51e58b8b,0x9bec8b8b,0x73086246,0xb48fb4af,0x93aba40d,0x5a455a26,0x9c2d8b8b,0xac6ea46e,0x6aa793cb,0xac4f834a,0x834aa44f,0x72c872e9,0x9bee5a06,0x93add5b4,0x5a265a26,0x5a065a27,0x93ad6a67,0x832a7ae9,0x836a72e9,0x83298b8b,0x836b834a,0x5a0672a8,0x59e54163,0x9bcc7ae9,0x9becb48f,0x59e55184,0x49635184,0x62267288,0x498438e1,0xac91836c,0x49a56a89,0x9bcf6249,0x51868b2c,0x62485186,0x72497a8a,0x59c75165,0x49456a07,0x8b2c6a49,0x49457a8a,0x412459a6,0x61e84144,0x6a087a8a,
-0x61e74904,0x6a089b4d,0x62084965,0x51866a28,0x51864924,0x6a086a29,0x61e761c7,0x62087269,0x61c859a6,0x6a286208,0x934c932c,0x59a759c7,0xa3ce9bce,0x59e76248,0x5a286a69,0x6aaa6269,0x93ae7289,0x5a088b8e,0x9bae5a08,0x82cbb471,0x62285a07,0x494451c6,0x72ca5a07,0x5a486248,0x7b0b7b6c,0x6aca5a48,0x6aa97b0c,0x9c2f8b8d,0x628972ca,0x730b9c2f,0x940f7b4c,0x7b4c6aca,0x6289b4f2,0x93ee72eb,0x72ea93ee,0x838d72ea,0x51e872ea,0x59c7938d,0x6a4930a3,0x3904726a,0x38e33904,0x498638e3,0x49a64144,0x392451a6,0x6a8a4165,0x59a67aab,0x62278b2b,0x624851a6,0x41855a07,0x836c6289,0x732b5a69,0x5a487b4c,0x730b6aca,0x6aaa5a49,0x6a894986,0x834b5a68,0x8bce8bcd,0x72eb838d,0x6aea730b,0x7b0b49c6,0x5a487b0b,0x6a8a51e7,0x7b2c834d,0x7b0c6acb,
-0x59e751c7,0x6a897acb,0x5a2851e6,0x5a075a08,0x62094165,0x516659e8,0x72897249,0x40c240c2,0x71e45143,0x8a4569c4,0xb38aab48,0x8ac89b29,0x8a888aa8,0x51c56a47,0xac2e6226,0x51c4a42e,0x5a054963,0x9c2d834a,0x7ae98329,0xac4e9bec,0x8b6ba40d,0x832a5205,0x834a5a26,0x6a8793ab,0xac6e72c8,0xa40ca44e,0x7b09ac8f,0x49a35a05,0x9c0d6aa7,0xa44da46e,0x93cdac8f,0xb4b093cc,0x9bedb4d0,0x6aa87b0a,0x72c96288,0x93cdacb0,0x6a686aa8,0x72886a88,0x7ae972a9,0x834b7ae9,0x72878b4a,0xa44e93ac,0x72c87ae9,0x6ac88b8c,0x49c46267,0x7ae959e5,0x93ec834a,0x8309b46f,0x494261e5,0x728772a8,0x41434984,0xa40f6268,0x4185834c,0x9bae6249,0x59e78b2d,0x59c74945,0x830c936d,0x51865166,0x59c76207,0x59a65165,0x59a761e7,0x8b2c61e8,0x49656228,0x61c759a7,
-0x516559a6,0x51665166,0x51865186,0x51855186,0x59a759a6,0x51855165,0x8b0c6a49,0x51666208,0x59a659a6,0x59c75986,0x6a2861e7,0x622872a9,0x51a659a6,0x72eb51c6,0xa450bcd2,0xac718b8d,0x7acb8b6e,0x5a4972eb,0x496549c6,0x620759e7,0x93ad59c6,0x62489bce,0x832c4965,0x7b4cb4b1,0x9c506268,0x6269836d,0x8b8d8b8e,0x7b2b51e7,0x49c55a68,0x730b940f,0x72ea5a28,0x7b4c6aca,0x6aca838d,0x93ef8bae,0x52277b6c,0x9c506aea,0x7b0b836c,0x6a8aa3cf,0x728a4945,0x4945728a,0x59e74145,0x30e36a48,0x7b0b51c6,0x59c7728a,0x51c65a08,0x49654125,0x49245186,0x6a6972aa,0x6a696248,0x7b4c5207,0x5a4849c6,0x93ef8bce,0x8bae8b8d,0x5207836d,0x93ef72ca,0x730a834b,0x730b72ea,0x49a66289,0x6aca6289,0x49c64986,0x6aaa6aaa,0x7b0c6269,0x72cb834d,0x5a088b8e,
-0x834c51a7,0x5a4772ca,0x72ca832b,0x62693104,0x49874987,0x41255187,0x51654965,0x69c54902,0x7a468a87,0x82458286,0x92c78a66,0x8ac88ae8,0x8ae87a66,0x7ae9830a,0x72a85a06,0x498472e9,0x9bcc6246,0x72c89c2d,0x93cc7b29,0xac6fa42d,0x5a05834a,0x6aa7834a,0x9bcc6267,0x6ac87b09,0xa42d9c0c,0xb4afac8f,0x51e5836a,0x938b8b8b,0x5a465a25,0x9bec8bab,0xa46ea44e,0x93ccbccf,0x7b2a834b,0x6aa96287,0x72e96a88,0x9c0eb4b0,0x62876aa8,0x7aa872c8,0x728872a8,0x6a6772a8,0x7b099bec,0x8b6a72a8,0x8b6a8b8b,0x93cc6225,0x62668329,0x51a459a4,0x938b6a88,0x7ae99bac,0x8b4a8b4a,0x51846a67,0x41224943,0x93ad51c6,0x6268ac70,0x51a649a6,0x7a8a51a7,0x51867a8b,0x62286a28,0x49654925,0x7acb6a69,0x51c76a89,0x51854965,0x9bef59e6,0x4985830b,0x6a4959a6,
-0x49456207,0x61c75166,0x518661e7,0x59a74945,0x82cb7a8a,0x49456a28,0x598559a6,0x49455145,0x7a8a5166,0x59c68b4c,0x622759a6,0x830b936d,0x62486249,0x62485a28,0x9c2f93ce,0x9bef9c10,0x628993ae,0x9c306aaa,0x59e78bad,0x82eb830c,0x51c659e6,0x8b6d7aca,0x49a672aa,0x93ee6a89,0x732b8bce,0x6aca730b,0x51e76a69,0x9c2f5a28,0x49a6730b,0x7b2b93ee,0x5a4849c6,0x8bae6aea,0x9c30940f,0xacd1a470,0x93ee9c71,0xa491a470,0x72ea730b,0x728a7b2c,0x49654165,0x414551a7,0x51a638e3,0x30e36208,0x51c74144,0x8b2c59e7,0x41658b6d,0x51654145,0x496538c3,0x622859e7,0x41855a07,0x72ea51e6,0x836d5207,0x838dac91,0x6a696269,0x49a66249,0x5a485207,0x940f83ad,0x8bad8bae,0x5227732b,0x62686aca,0x5a085a28,0x5a2872eb,0x7b2c51c7,0x5a288b8e,0x62495a08,
-0x72ab6209,0x62685a07,0x51c67b2b,0xa3f06269,0x59c851e8,0x412559c8,0x59855165,0x7a465143,0x93288266,0xa38ba3ca,0x59a38287,0xa3cb7266,0x8b6a9bec,0x8b6bac2e,0x49836205,0x6aa851c5,0xa42da42c,0x7b096226,0xacaeac4d,0x832aa42e,0x7b096267,0x520572c9,0x7309a44d,0x93cb62a7,0xb4cfacae,0x9becac6d,0x72c86a87,0x8b6b93ac,0x51e46266,0x51e56205,0x5a256246,0x62666247,0x62875a46,0x7b096ac8,0x6ac98bac,0xbcf19c0e,0x72a8834b,0x728872c9,0x6a678b2a,0x8309936a,0x8b4a7ac8,0x59e56a87,0x8b4a834a,0x8b4a6225,0x93ab6a67,0x4963832a,0x5a063922,0x8b4a830a,0xa3cc9b8b,0x726782e8,0x72a87ac8,0x624859e6,0x8b6dac50,0x41244986,0x6a495186,0x49857269,0x7acb59a7,0x6248936d,0x6a894144,0x6228830b,0x93ae6248,0x49856228,0x51c659e7,0x830c51a6,
-0x938eac51,0x496561e7,0x51655165,0x51a65185,0x61e759a6,0x496559e7,0x59c74965,0x492559a6,0x6a494945,0x51867269,0x620751a6,0x5a285a07,0x8b4d59e7,0x7b2ca430,0x9c0f8b8d,0x62696aaa,0x62286aaa,0x72aa51e7,0x62487b0b,0x938e72aa,0x62286a89,0x622859e6,0xac509bef,0x62895a48,0x730b9c50,0x5a4841a5,0x6aaa7b4c,0x6a694165,0x6aca72eb,0x6289836c,0x93ee6aa9,0xa450940f,0x72eaa490,0x7b4b7b2c,0x83ac6aca,0x734b940f,0x62686aea,0x5a277aeb,0x72aa7b0c,0x41653924,0x30e359c7,0x412438e3,0x28814124,0x8b8d72ca,0x41656228,0x412451a7,0x49454965,0x5a074124,0x6a895a07,0x49a6836c,0x8b8d72eb,0x6aca6a6a,0x7b2c93ae,0x832c6248,0x7b0b93ce,0x7b2c836d,0x6aaa6268,0x8bae8b8d,0x39456a89,0x5a28832c,0x6a695a08,0x59c751c7,0x51c76249,0x62297aec,
-0x9bae51c7,0x39447aeb,0x51a651c6,0x72ab5a08,0x62284145,0x49246208,0x490240e2,0x71e55963,0xa38a9b08,0x82c89b6a,0x82a78266,0x82e882c7,0xa3ec8b6a,0x59e56a88,0x624651a4,0xa42d8b8a,0x62468329,0xbccf93aa,0xa42dac4e,0x6a678b6a,0x7ae97ac8,0x9bec51e4,0x5a45834a,0xb4ef93ec,0xa46d9c4e,0x7309b4af,0x8b6a6246,0x93abbcaf,0x7aa87aa8,0xa40d72c8,0x72e98b8b,0x628772c8,0xac8f7b6a,0x6267940d,0x6267834b,0xac6f7b2a,0x6a8893ad,0x7aa97288,0x7aa87a88,0x6a887288,0x936b6226,0x5a05936b,0x9bcb6a47,0x62057ae9,0x7ae98329,0x7ac96246,0x390272a8,0x59e54964,0x8b097ac9,0x936b8b2a,0x83099bac,0x51a54963,0x93ceac50,0x494451a6,0x6a0859a6,0x59a66a49,0x62284945,0x830bac30,0x5a0759e7,0x62286248,0x8b4d6a69,0x51c672a9,0x832c7aeb,0x51c66248,
-0x728959e7,0x6207934c,0x6a284965,0x72697aaa,0x518659c7,0x516559a6,0x51654945,0x62085166,0x49456a08,0x7aeb59a6,0x59e7832c,0x626851a6,0x6a695a28,0xa4508b8e,0xacb2a470,0x51e78b6d,0x8b6d72eb,0x59e8728a,0x62286a8a,0x5a0751a6,0x93ce72a9,0x72ca9bef,0x7b2c51e6,0x7b2ba470,0x942f6289,0x49c67b6d,0x8b8e72eb,0x6a895a07,0x836c93ce,0x7b0a834c,0x49e66268,0x838d5a48,0x7b4c9c2f,0x93ce93ef,0x83ad730b,0x942fa4b1,0x8bcd83ad,0x6289940f,0x93ae836d,0x51a65207,0x414472aa,0x6a683924,0x30e251a6,0x49a64165,0x7aeb6248,0x49a651e7,0x41444985,0x622772a9,0x72a949a5,0x5a276aa9,0x5a287b2b,0x7b0c7b0b,0x72ca6aca,0x93ee836c,0x62697b4c,0x834c7b4b,0x62695228,0x520772cb,0x49c76269,0x41655a07,0x7b0c7acb,0x49a649a6,0x498672cb,0x418551a6,
-0x5a074165,0x51c74986,0x7b0c832c,0x6a6930e3,0x830c59c7,0x40e26a49,0x69e54902,0x82268a87,0x82878aa7,0x8ac88287,0xababa34a,0x9329a38b,0x8ac87a86,0x6a674963,0xac8e938b,0x624693ec,0x9c2c72c8,0x940ca44d,0x938ab4ae,0x72886205,0x62258309,0x9c0d836a,0x9c0c7b2a,0x9c4da44e,0xa48eacae,0x6ac8838a,0x834a7ae8,0x8b6b9bec,0x62266a67,0xb4af7ae9,0xa44ecd51,0x7b498b8a,0x9c4d836a,0x628793ed,0x6ac98b8b,0xac907aea,0x7ae9a44f,0x7ac96a88,0x7aa97a89,0x830a59c5,0x72a86a67,0x7ae993ac,0x72c951e5,0x834b9bed,0x6226834b,0x7b0a7ac9,0x72a86267,0x41437268,0x51a44943,0x724759c5,0x8b4b8b6b,0x498451c5,0x9bce9bce,0x49445a06,0x49455185,0x8b2c6a28,0x4124728a,0x6a4959c7,0x72aa51a6,0x9bcea3ee,0x6248832c,0x51c651c6,0x9bce59e7,0x6a6aa40f,
-0x49654144,0x59e76208,0x59e74965,0x8b2c7acb,0x59c77aab,0x61e75986,0x51866a28,0x7a8a4945,0x51667a8a,0x7aca59c7,0x62289b8e,0x93ce51a6,0x72cb93ce,0x5a286248,0x5a0751e7,0x51c76249,0x6a6951a7,0x59e76229,0x9bce7aeb,0x6a6993ae,0x832b6248,0xac50a40f,0x51e68b6c,0x9c0f6269,0x5a47730a,0x834c93cd,0x6a8951e7,0x51e67b0b,0x72ca6269,0x7b2b9bef,0x7b2b6aca,0x8bce732b,0x834c7b2b,0xa490a470,0x9c509c2f,0x8bcea470,0x9c90732b,0x5247940e,0x8bae5a68,0x414472ea,0x496559e7,0x41244124,0x51e63923,0x30e34964,0x72a96227,0x832c51e7,0x7b0b7aeb,0x49c55a27,0x7b2a7aea,0x834b49c5,0x39446aca,0x836d730b,0x838d836d,0x6aa96aea,0x5a489c2f,0x836d6acb,0x6aca834c,0x49c651e7,0x49a66aaa,0x62286249,0x49665a07,0x6a8a4965,0x416572aa,0x7aeb6248,
-0x59e74986,0x59e86248,0x6a496208,0x72896228,0x6a4759c6,0x51634964,0x9b2a7a88,0xa32aab6b,0x82878ac8,0x7a258288,0xa34a92e8,0x828892e9,0x8aa78287,0xac6eac4e,0x6a8793ac,0x93cc6a87,0x93ccac4d,0xa42d93ab,0x51c472c8,0x83097b09,0x832a51c5,0x8329b4b0,0x9c2d836a,0xb4aeb4cf,0x8baa9c4c,0x6aa76aa7,0x6a467b29,0x9bacb46f,0x8b8a7ae9,0x93cc7ac9,0xc531b48f,0x6ae89c0d,0xa48e7b29,0x72e8ac8e,0x8b6b72e9,0x93cc7ae9,0x8bacbcf1,0x7aea6a48,0x8b2b6a88,0x59c66a88,0x72898b4b,0x93cc7b0a,0x62877b09,0x9bed51c5,0x6aa8ac4f,0x72c97b0a,0x832b7288,0x728851c5,0x59c46226,0x51a451a4,0x496451a4,0x51a54143,0x8b6b72c9,0x6a49832b,0x494551a6,0x6a075165,0x6a28728a,0x5a074104,0x61e86208,0x6a696208,0xb47193ae,0x938d7b0b,0x6228832c,0x6a485a07,
-0x59e759c7,0xa3ef9b6e,0x6a498b4c,0x518651a6,0x51854985,0x59c761c6,0x59e76207,0x59e75165,0x59a66a08,0x51855165,0x51a649a6,0x6a694966,0x832c830b,0xb4719bae,0x51a69bef,0x7acb6249,0x51656228,0x61e859c7,0x6a8951c6,0x93ae8b4d,0x6a4893ae,0x7b2b51c6,0x9c0eac90,0x628849a5,0x732bacb1,0x93ce6227,0x72aaa430,0x626951e7,0x93ce93ae,0x8b8d940e,0x62896268,0x9c309c0f,0x41a55227,0x838d838d,0x8b8d7b6c,0x7b6c838d,0x83ad838d,0x730a8c0d,0x93ce836c,0x62287b4c,0x41444144,0x49646248,0x59e64964,0x41654985,0x41654985,0x6aaa6248,0x834c7b0b,0x7b2b5a67,0x838c9c2e,0x838c7b4b,0x51c651e6,0x5a286aaa,0x838d628a,0x6b0a7b6c,0x8bce734b,0x52087b2c,0x6aca49c6,0x49866aaa,0x51e75a07,0x59c77acb,0x51a65186,0x49864965,0x496559c7,0x416451c6,
-0x9bef49c6,0x49868b6d,0x728a6208,0x62286a29,0x41034103,0x7a667267,0x8aa87226,0xa3099ae8,0x8ac892c8,0xab8cabcc,0x72058287,0xb40c92e9,0x8308a3ab,0x6a878b8b,0x834a5a25,0x9c0ca42d,0x8b8b8bab,0x5a06938b,0x8b6b51c4,0x51e48309,0xac8e8b8b,0x6ac76286,0x93cbacae,0xa46d7b49,0x72c8a46d,0x72e86aa7,0x72a78b6a,0x93ac9bac,0x72677ae9,0xacaf72e8,0xb4d0b4f0,0x8b8b834a,0x93ec838b,0x838bacaf,0x93cd6ac9,0x7aea6247,0x93eda44f,0x59e66a88,0x72896a68,0x62476a88,0x6a476a88,0x72c85a06,0x938b93ac,0x41435a46,0x938c5a06,0x6a8893ac,0x936c7ae9,0x7a885185,0x9b4b7247,0x7a677a88,0x7ac98b2a,0x416451c6,0xb4925a07,0x7aebbcd3,0x51864965,0x51665186,0x59a75186,0x51a65146,0x936e8b4d,0x5a277289,0x72aa7289,0x72ca7aeb,0x93ce8b6d,0x51e672ca,
-0x62896a89,0x51a64124,0x6a486a49,0x82eb5a07,0x728a934d,0x59c75a07,0x51a64944,0x51a661e8,0x6a495166,0x498572aa,0x7aeb59e7,0x832c51c7,0x62698b4d,0x62286228,0x49a651c6,0xa40f51a6,0x59e79bae,0x82eb61e8,0x51e77aca,0x51c651e6,0x8b4c8b0b,0x5a076a69,0x9c0f72ea,0x49a57b2b,0x9c0f72ca,0x6269730b,0x72aa7b0b,0x41853904,0x93ce7b4c,0x5a286aca,0x8bae72ca,0x72ca93ce,0x7b2b5207,0x72ca93cf,0x9c2f730b,0xacd1a4b1,0x8c2ea4d1,0x942f9c70,0x944f9c70,0x8b8e93ce,0x498572ab,0x51a67acb,0x41244165,0x62284985,0x62286248,0x624872ca,0x522749c6,0x6aa96aa9,0x836c6a88,0x7b2a93ad,0x6aaa41a6,0x52075227,0x8bce7b2b,0x838c7bac,0x5a285207,0x522872eb,0x7b0b732c,0x5a684185,0x41457b2c,0x498659e7,0x5a076a89,0x6a484145,0x51a6830b,0x5a073924,
-0x72cb5a07,0x72aa6a69,0x51a77aeb,0x620751c6,0x69c45163,0xb3eca38a,0x72059309,0x826669c4,0xabec9b29,0x8308a38a,0x72667286,0x8ae97aa7,0xabecabec,0x93cc6246,0xa40db48e,0x832a8b6b,0x72a88b6a,0x62476206,0x59e57288,0x93cc6267,0x6ac79c2c,0xacce7b29,0x83aa8bcb,0x8baa836a,0x9c2ca44d,0x72c88b8a,0x83497308,0x93aba46e,0x934a8309,0x93eb72e9,0xcdb2b4f0,0x836a93cc,0x8bab7b09,0x838ba48f,0x7b096267,0x728872a9,0xa4afac6f,0x624772e9,0x59e672c9,0x5a0672c9,0x72c851c5,0x5a266267,0x8bab93cc,0x6a667ae9,0x62266246,0x7b298b8b,0x51a549a4,0x620659c5,0x6a066a06,0x518561c6,0x6a485185,0x49857aca,0x9c1049a5,0x7b0ca410,0x59a761e7,0x49655186,0x51665186,0x516659a6,0x726959e7,0x728a6a49,0x832b8b6d,0x7b0b72ca,0x6a8872ca,0x5a266a68,
-0x93ce72c9,0x6288730b,0x832c8bad,0x496559e7,0x6a4959e7,0x726a6a69,0x832c6a49,0x7acb938e,0x72aa5a07,0x51c7832c,0x6a6951c6,0x6a8a4986,0x7aeb93ae,0x9bcf6a69,0x7aebac50,0x49864986,0x5a276229,0x62285186,0x72ca8b4c,0x7a8a6a49,0x494559c7,0x832b7aca,0x5a0751a6,0x7b0b9bef,0x7aeb49c5,0xac51ac71,0x72aa9bce,0x41a53924,0x7b4c8bce,0x730b72eb,0x7b2c6aea,0x626a8b8e,0x7aeb832b,0x51e86a8a,0x940e7b0b,0x7b6c83ad,0xa4b1acd1,0x734c5248,0x734c9c50,0x7b4c6aaa,0x418572ca,0x49855a08,0x51a66228,0x39234124,0x6a694986,0x7b2c6248,0x72ea6aaa,0x7acb7b0b,0x5a276268,0x6a886a89,0x5a487b2b,0x730b5207,0x6aca7b6c,0x9c307b2c,0x72cb834d,0x72ca7b2d,0x7b2c7b0b,0x62896268,0x4965834c,0x41856228,0x51c651c7,0x49864985,0x39444985,0x8b4e6a89,
-0x626a93cf,0x7acb6a69,0x38e359e8,0x6a065165,0x8a868aa8,0x8ac77225,0x8aa89328,0x93098ac8,0x93099b4a,0x8b487a87,0x93eb9c0c,0x82e88b4a,0x936b82c9,0x9bccacaf,0x936b836a,0x8b4b938b,0x49a46aa8,0x832b72e9,0x62466247,0x9bec938b,0x6aa772e8,0x940c9c0c,0x93aa940c,0x93cb836a,0xa44da44d,0x72e893cc,0x72e87b29,0x938b8bab,0x6a676aa8,0xa44d832a,0xc531b510,0x8b8a9c2d,0x8bab8309,0xacb0acd0,0x6aa8834a,0x62477ac9,0xac907b4a,0x5a069c0e,0x7ac96227,0x62264984,0x62266205,0x6aa77ac9,0xac4e72c8,0x72c8938b,0x72c86226,0x9bcc93ac,0x5a057b09,0x6a4649a3,0xa3aba3ec,0x49436a26,0x51a45184,0x498451c5,0x62884184,0xc4d2b4b1,0x936d93ad,0x51858b4c,0x51855165,0x51655165,0x82cb5186,0x498582eb,0xa40f72aa,0x7b0b49a6,0x9c0f93ae,0x7b2c93ae,
-0x52076aa9,0x5a066289,0xa4308bad,0xac50c514,0x6a896a89,0x49a66268,0x5a074986,0x59e76248,0x7b0c51c6,0x6a899bef,0x8b6d49c6,0x5a077acb,0x51c751c7,0x5a0851c7,0x8b6d82eb,0x51a682ec,0x830c6a69,0x51a66a48,0x8b4d6a69,0x938ea410,0x49a66a69,0x938e59e7,0x51a6a3ee,0x9c305206,0x51e772eb,0x9c0f8b6d,0x5a48834c,0x72ea4184,0x9410838d,0x49e66269,0x940f838d,0x51c772cc,0x938d72ca,0x6a6aa410,0x5a2749a6,0x942e6ae9,0x944fa4d1,0x8bef7b8d,0x62a9836c,0x93ee7b4b,0x522772eb,0x41657b0c,0x49c64145,0x6aaa72ca,0x522751e7,0x5a283925,0x6a8a6aca,0x6a895247,0x93ce93ce,0x49c549c6,0x838c940e,0x7b4c6ac9,0x8bcd838d,0x5a488bad,0x9c4f7b6c,0x72eb5247,0x728a93ce,0x61e840e4,0x4105724a,0x39033904,0x72aa6a89,0x72ea5a07,0x49a58b8d,0x5a685a28,
-0x628a8bef,0x51864946,0x51235143,0xabad7a28,0x72068aa9,0x8a468266,0x93498266,0x82c7a3ec,0x82a77aa7,0x8aa882a6,0xa3ada36c,0x6a677aa9,0x7ae77ae8,0x7ae97ae9,0x8b4b832a,0x59e572a9,0x624659e5,0x5a057b0a,0xac4e6a67,0x6a87a42e,0xacaf72e8,0x7b299c4d,0x6aa77308,0x5a466a66,0xa44e72c8,0x836ab4af,0x8b8b7b08,0x8b8ba40d,0x72c87b09,0x8bec6aa8,0xbd31b510,0x8b8b9c6d,0x836a93ab,0xb4d08bac,0x6a68834b,0x7b0aa40f,0x8bcc5a27,0x6a87a42e,0x59e551c4,0x7ae959e5,0x51c56226,0x72a86a87,0x7ac85a06,0x9becac4e,0x5a056246,0xac6e9bcd,0x93ab9bec,0xbcaea42d,0x7ac7ac0c,0x59c459a4,0x62266205,0x62266a67,0x51c54964,0xac90836c,0xa3eea44f,0x7289938d,0x59c67aaa,0x59a54944,0x51655185,0x498551a6,0x938e6248,0x520772cb,0x8b8e7b0c,0x6a8a6249,
-0x834c93cf,0x7b2c93ee,0x5a4851e6,0x8b8d836c,0x7b0b6289,0x7b0b9c2f,0x62898b8d,0x6a896268,0x5a276289,0x49a64986,0x6aaa49a6,0x93aea410,0x7b0c834d,0x49855a08,0x51c751a6,0x51c76208,0x6aa95186,0x728a8b2c,0x7b0b5a07,0x93ae8b8d,0x7aca6aa9,0x6269832c,0x8b8d6aaa,0x49e651c6,0x8baea471,0x93ce7b4c,0x39247b2c,0x836c51c7,0x49e75a48,0x72eb730b,0x72eb6aea,0x6aab628a,0x62487b2c,0x6aaa8b6d,0xacb1838c,0x8bce9c6f,0x62e9732b,0x8bee9cb0,0x9c2f8bce,0x940f9c2f,0x836d8bce,0x52276269,0x6aca6aca,0x49e75227,0x5a885228,0x49a572ea,0x7b2c6289,0x626872ca,0x730b730b,0x836c49e6,0x7b6c838d,0x62c98bee,0x8bad5227,0x52288c0e,0x836c49e6,0x6a8949e6,0x5a087aeb,0x61e84145,0x41245186,0x59e67aaa,0x59e66207,0x834c5a27,0x52087b0c,0x41a66a8a,
-0x416551c6,0x516438e3,0x92c97a47,0x69a48206,0x9b8b7a68,0x8ac98b0a,0x9b6a9329,0x936a9369,0x8b298b4a,0x9b2aabac,0x82888227,0x93ab934b,0x83298329,0x8b6b6267,0x4984832a,0x7b094163,0x51c48b8b,0x7ae84983,0x8b8bac8e,0x834a51e4,0x8b8bb4d0,0x8b6a7b29,0x72c87b29,0x834a72e8,0x72e97b09,0x7b0993ab,0x73096a87,0x93acac6e,0x6a875a06,0x83ab8b6b,0xb4f0accf,0x940cc572,0x7b4a8b8b,0xb4d1838c,0x7aea838b,0x72a95a27,0x7b2a6a88,0x938b9c2d,0x62065184,0x59c58b2a,0x72a96a67,0x624751a4,0x49847ae9,0x8b6b72c9,0x6a46938b,0x834a5a06,0xb4afac6e,0x93ab9bec,0x51847ae9,0x620559e5,0x7ac97267,0x51e56a47,0x8b8c5a26,0x72e96a88,0x8bad7b4b,0xb490ac70,0x62278b6c,0x7aca7aaa,0x496559e6,0x49655165,0x59e759e6,0x49854966,0x9b8e726a,0x4945728b,
-0xac91832c,0x9c0ea40f,0x6aa972ca,0xb4b1a471,0x5247838d,0x5a4841a5,0x62886aca,0x834c6aaa,0xa4709c0f,0x728993cf,0x834d7b0c,0x414451c6,0x7aeb51e7,0x6a8a8b4c,0x59e759c7,0x626972ca,0x51e75a07,0x7aeb6a89,0x7b4c6aaa,0x72aa940f,0x72cb4986,0x93ce9c0f,0x8bce730b,0x62689c0f,0xa4707b2c,0x940fa491,0x49c662a9,0x7b0b7aea,0x5a695208,0x6aea49e7,0x730b93ee,0x6aab4986,0x6aaa7b2c,0x62695208,0x6aaa5a28,0xa4d19c2f,0x8c0e83ee,0x9c50a4b0,0x62a96aea,0x8bae83ad,0x7b2b730b,0x49e75228,0x93ce7b4c,0x6289834c,0x83ad6aaa,0x7b4c7b4c,0x8b8c942f,0x838d7b2b,0x6aa97b0b,0x8c0e8bad,0x7b4c72ea,0x8bad8bee,0x62896288,0x6aca836d,0x834c5a28,0x728a5186,0x6249936e,0x51e728e2,0x49645a07,0x51a559c6,0x7aca82ea,0x6a296a69,0x628a51c8,0x496651c8,
-0x49235165,0xa38b6a47,0x8a87ab8c,0x69836983,0x934a7a46,0x9c0da44e,0x724582e9,0x82c87a45,0xac2e9bab,0x8ac89bad,0x7a457a45,0x938a7ac7,0x936ca42e,0x51845a05,0x6a6751c5,0x51a46226,0x624651e5,0xac6ea42d,0x6aa772e9,0xa46e93ec,0xa42d9c4d,0x6ac86aa8,0x93ec93ab,0x8b6a8bab,0x72e9832a,0x93ac72e9,0x8b6a6ac8,0x8b6b9c0d,0x8b4b832a,0x838b72e9,0xb511b530,0x83abb510,0x83ab7b4a,0xa46f838b,0x7b0abd12,0x6a886aa8,0x62476a88,0xb46e8b6b,0x49838b4a,0x620551c4,0x6a4759e5,0x494459e6,0x6a676207,0x834a51c5,0x7b099c0d,0x51e56225,0x62665205,0x51a45a05,0x7ae85a05,0x7ac96a47,0x6a277288,0x620672a9,0x8b8c8b4b,0x7b2b6248,0x72ea7b4b,0x9c2f93cd,0x9bef7b4c,0x938db4b2,0x82eb7aca,0x62286a89,0x51c66a89,0x51864986,0x59a651a6,0x49245986,
-0x7acb59c7,0x6a696249,0x6a89834c,0x93ee834c,0x83ad93ee,0x838d5a48,0x72ea7b4c,0x49e65227,0x5a4851e7,0x62486aaa,0x938d5a28,0x832ca430,0x496551e7,0x72ca6228,0x59e751a6,0xac309bcf,0x59e7830b,0x59e74986,0x7b0c6a89,0x732c9c30,0x5a286aca,0x93ce72cb,0x6248834c,0x942f836c,0x8b8e7b6c,0x7b2c93ee,0x5a4851c6,0x732c83ad,0x49e749c6,0x8bae6acb,0x5a487b6c,0x72cb5a28,0x836d6aca,0x52075228,0x838d6289,0x8bee942f,0xa4d1acd2,0x9c707b8c,0x93ef944f,0x9c509c50,0x5a486aea,0x730b9c2f,0x5a285207,0x5a696aeb,0xacb2730c,0x628849e6,0x5208838d,0x730b6aa9,0x62895a07,0x628993ce,0x730b838d,0x8bae5a48,0x62696aeb,0x6a69836d,0x82ec6229,0x62493905,0x51a67acb,0x6a6851c6,0x6a8859e6,0x624772c9,0x61c759c6,0x6a497aaa,0x49253904,0x490330a2,
-0x82675964,0x9ae89b2a,0x82a77a45,0x93499b8a,0x7a878b28,0x93ab7ac8,0x8b09a3ed,0x9b6a7246,0x9329abab,0x8b6982c7,0x93aa93cb,0x82c89329,0xabac8ac9,0x51c56a27,0x7b0a8b4b,0x51e44963,0xa44e7b29,0x7308a42d,0x93cb72e8,0xacaea44e,0x72c79c2d,0x5a256a86,0x8b8a834a,0xacaea44d,0x62668b8b,0xa44e7ae9,0x72a76aa7,0xa40ebcf0,0x7b0a6247,0x72e993ac,0xbd51acaf,0x9c6ebdb2,0x8bec7b49,0x834b93ed,0x9beebcf1,0x5a476288,0x6aa87ae9,0x83295a05,0x6226a42d,0x7ae94943,0x59e65a06,0x51c57288,0x832b51a5,0x51c56207,0xb48e93ac,0x834993cb,0x62a78349,0x72c85a45,0x8b6a6245,0x624672a8,0x938b8b6a,0x8b6b6a67,0x51e48b6b,0xacaf6aa8,0x93ecbd11,0x52275247,0x8bce730b,0x834c93ee,0xac7093ce,0x93ae93ce,0x62689bef,0x6a486a88,0x498551a6,0x51855165,
-0x724959a5,0x51c7832c,0x7b0b6a69,0x5a685a49,0x940f836d,0x49c67b4c,0xb4d283ad,0x834cb4d2,0x624851c6,0x59c772a9,0x49654165,0xa3ef51c7,0x51a6936d,0x51a64965,0x49854986,0x8b2c72aa,0x72aa93ae,0x62494965,0x730b834d,0x628a6acb,0x8bad93ce,0x6aaa7b0c,0x62486269,0x730b49c6,0x836d93ef,0x836d730b,0x62896289,0x5a2893ef,0x628951e7,0x8bae5a28,0x49c7732c,0x62695a69,0x93ce7b0c,0x72eb6289,0x838d838d,0x4a0762ca,0x944f83ad,0x83ad83ed,0x732b83ad,0x8bae7b2c,0x93ce93ee,0x6aaa7b0b,0x72aa6248,0x5a0872eb,0x834c6249,0x62694145,0x31034165,0x834c8bad,0x6aca4985,0x520793cd,0x8b8c9c0e,0x62a96269,0x5a085a28,0x49a66a89,0x7aec49a6,0x6a6a4945,0x61e77acb,0x7aca6227,0x6aca6a69,0x7aca4985,0x51a659e7,0x40e359a6,0x510340c2,0x7a675142,
-0x8a669309,0x82258225,0x82867a05,0xa3cb936a,0x82a78ae8,0x82a682c7,0x93ac82e8,0x83099bed,0x82c682a7,0x8b4982c7,0x93ac9c0d,0x82c88309,0x82c882c8,0x62479bcd,0x59e54143,0x93ac7b0a,0x93ec9bec,0x7b086ac7,0xa46d940c,0x9c2ca46d,0x7b088baa,0x51e48349,0x62665a25,0x9bec836a,0x7b0893ab,0xac8f7b09,0x626772c8,0x9becb48e,0x938b832a,0x73096ac8,0xb510bd31,0xacf0a4ae,0x73297bab,0x730a8bac,0xb4b0b4b0,0x7b0a6288,0x5a067aea,0x6aa751c5,0x8b6a9bab,0x494349a4,0x5a065a06,0x72c95a06,0x5a0672c9,0x8b2a93ac,0x7b0a5205,0xac8eb4af,0x93eb93eb,0xa46d9c0b,0x9bcb7b08,0x9bebac6d,0x93cb9bcb,0x72c78329,0x832972a7,0x7b4951e4,0xa4ae9c6d,0x730a9c4d,0x7b0b6ac9,0x62485a48,0x93cd7aea,0x9bcd9c0f,0x93cd93cd,0x93adac71,0x62486227,0x49655a07,
-0x59a651c6,0x49655166,0xa3ef6208,0x62489bce,0x834c5a27,0x52077b4c,0x8b8e5207,0x9befa430,0x622872ca,0xa40f8b4d,0x49856a69,0x62284145,0x51c66a89,0x82eb59c7,0x72cb8b6d,0x498549a6,0x5a076228,0x6a6949a6,0xa45193ef,0x51c772cb,0x93ae51e7,0x49a68b4d,0x93ae5207,0x6a6a834d,0x62696aaa,0xa4708bae,0x62487b2b,0x49a6832c,0x51c74986,0x7b2c7b2c,0x49e75207,0x6a896aaa,0x5a287b2c,0x730b51e7,0x9c30a491,0x4a276289,0xacf27b6c,0x732c9450,0x7b4c8bcd,0x62896269,0x8bad730b,0x72cb5a27,0x6a896a89,0x51e76a69,0x6a6a6207,0x7aeb4105,0x310349a6,0x93ce9c0f,0x7b0b59e7,0x7aeba410,0x62897b0b,0x72a95a28,0x49866248,0x6a495a08,0x7aeb59e7,0x622851c6,0x6a487aaa,0x49864985,0x6a297aab,0x61e740e4,0x41035165,0x59434923,0x69e469a4,0xa3699b08,
-0xa369abaa,0x82668a87,0x93098ae8,0x8aa78aa7,0x93289b49,0x8ac78aa7,0x9bcc938a,0x938b9bcc,0x8b298329,0x934a936a,0x830a82c9,0x934a9bab,0x8b288b29,0x59c551a4,0x8b6a832a,0x834a832a,0x5a2672e8,0xbd108bab,0x7b29ac6d,0xb4ee93ab,0x9c0cb4ef,0x72e77b28,0x8b6a8349,0xa44ea46e,0x6a8772e8,0x93ec834a,0x62666a87,0xbcd0cd72,0x6a886a88,0x834b7b09,0xc5519c0d,0xacefad10,0x730983ab,0x93ad8bcc,0xb51193ad,0x6aa8a42e,0x6a885a26,0x49a45a06,0xa44e7ae9,0x5a0593ac,0x59e66206,0x72a951a5,0x41637aea,0x6aa849a4,0x6266834a,0xa44d6246,0x940bbcf0,0x93aa7b49,0x6ae7a46d,0xa46d8baa,0x6a868bab,0xa42d8329,0x7b09b48e,0x730951a3,0x940c9bec,0xb4efac6e,0x832993ab,0x6aa7ac4e,0x62884142,0x7b0a832a,0xbd138bcd,0x8bcdbd33,0xa4918bee,0x51e77b4c,
-0x51a66269,0x51865165,0x59e65186,0x8b6d8b4d,0x72ca6248,0xc4f3b492,0x59e7938e,0x626849c6,0x49a66249,0x6a484965,0x7aca8b2d,0x51a75a08,0x51a651c7,0x5a074985,0xa40f8b0b,0x6a89a3ef,0x7aeb72aa,0x51e66248,0x8b6d6a89,0x6a8a728a,0x6aaa834d,0x6a286208,0x624951a7,0xa450ac71,0x49a65207,0x9bef72ea,0x72ea93ad,0x51c77aeb,0x8b6d6a8a,0x5a698b8d,0x62894186,0x834c7b2c,0x5a08834d,0x6a896249,0x7b2b836c,0xb4f283ad,0x944f9c90,0x9c70acd2,0x940fa471,0x41855a68,0x8b8d7b0b,0x8b4c93ae,0x62486228,0x7289830c,0x8b2d6a48,0x62084965,0x39246249,0x7aca72ca,0x51a64985,0x41446227,0x59e651e7,0x832c4965,0x49657aeb,0x6a2951a6,0x62075185,0x6aa951c6,0x6a696a69,0x49256208,0x4924722a,0x40c240a2,0x58e248e3,0xa36979e5,0x92c7b3ca,0x7a4569e4,
-0x7a458245,0xac0c8b29,0x8b09a40c,0x69a47a26,0xabeb8ac7,0x9329ac0c,0x82868287,0x82ca8287,0xac2f9bcd,0x82c89b8c,0x82667245,0xabcc9b2a,0x9b4ba3ad,0x834a834a,0x8b4b832a,0x6a67834a,0xa42d6287,0x836993ec,0x832972e8,0xac6d9c2c,0xac6d9c2c,0xa44dac8e,0xac8eac4d,0x5a268b8b,0x9bed72e8,0x8b6b8b8b,0x5a267b09,0xa40dac6e,0x8b6b8329,0x6a88832a,0xb4ef8b8b,0xad10accf,0x7309a4af,0xa42e7b0a,0x93cd72a9,0x836bbd12,0x62475a46,0x5a066226,0x830a6226,0x936bb490,0x59e54983,0x59e572a8,0x8b2a59c5,0x51a46247,0x7b098b2a,0x5a055a06,0xb48f834a,0x9babb48e,0x93cc93ab,0x9bec9c2d,0xbcf09c2d,0x9bacb4af,0x62268b6b,0x624649a4,0xac8f93cc,0x9beba44d,0xa40cbcae,0x938a7ac7,0x6a878349,0x8bac7b09,0x6ae98b8c,0x940f732b,0xa491acd2,0x9c719c50,
-0x620893ef,0x59c75186,0x494551c6,0xac306a49,0x5a08ac10,0x72ea6228,0x938e8b4c,0x72ca5a28,0x9bcfa410,0x498672aa,0xa43072ca,0x51855a28,0x9bcf936d,0x51a5728a,0x59e75185,0x5a087acb,0x938e51e7,0x72cb8b6d,0x7aebac71,0x6a8a4986,0x6208938e,0x8b4c4966,0x7b0c9bcf,0x62488bae,0x8b6d51e7,0x72ea8bad,0xa430832c,0x51c79bef,0x7aca4985,0x72cba430,0x49a63104,0xac91836c,0x62486249,0xb4d29c30,0x62899c0f,0x6b0a5207,0x6aeb732b,0x94505a68,0xa4509c2f,0x49a67b4c,0x832b7b0b,0x938da40f,0x7aca5a07,0x5a078b2c,0x8b0c59c7,0x41246a69,0x51c7728a,0x49454965,0x51c638e3,0x49a672ca,0x6a896a69,0x62494145,0x49665a07,0x59876208,0x6a6959e7,0x624872ca,0x620851e6,0x38a261c7,0x59035104,0x69636143,0x8a868225,0x7a658245,0xab8b9b28,0x7a25a38a,
-0x82c871e4,0x9b8b9bab,0x8b098b29,0x93698b49,0x8b298329,0xa3cb938a,0x92a7a38a,0xab8c8267,0x9b6babad,0x9b498b29,0xab2aab4a,0xa2a9a2c9,0x9a89a2aa,0x93ab6287,0x7b099c0d,0x8bab6287,0x9c0cac4e,0x62878b8b,0x7b0949c4,0xb4cea46d,0x9c0cac6d,0x9bccac4d,0x51c46267,0x7b2a49a4,0xac6eb48f,0xac6fac6f,0x62468b6b,0xac4eb4b0,0x6aa87ae9,0x7b096a88,0xcd92834a,0xa4aeb4f0,0x8becb530,0x7b0a5a06,0x832a7b0a,0x8bcca46f,0x520551e6,0x5a066a88,0x59e559e5,0xa3ed8b4b,0x59c57ac9,0x59a551c5,0x59e55184,0x59c56206,0x7aa94963,0x7ae99bac,0x72884963,0xac6e9bed,0x836bac6e,0x6ac86ae8,0x72e96ae8,0x51c56aa8,0x6a684984,0x62677288,0x83296226,0xb4aeac6e,0x9bec93ca,0xac4dbcae,0x834a8b49,0x52067b09,0x8bac6288,0x93cea42f,0x6aaa72ea,0x9c0f72eb,
-0x936db4b2,0x51e672ca,0x51865185,0x62084965,0x728a7aeb,0x5a074945,0x830b72aa,0x5a076a8a,0x93ad7acb,0x62498b4d,0x622851c6,0x51a651a6,0x9b8e7269,0x62289b8e,0x72aa51c6,0x5a076a69,0x622851a6,0x7aea6268,0xa4109bef,0x62086a48,0x624859e7,0x6a695a08,0xac309bcf,0x49a65207,0x5a683964,0xa4709c0f,0x72ea7b2b,0x72ca8b8d,0x49a63924,0x72aa93ae,0x6a893904,0x8bad9c0f,0x51e75a28,0x9c0e72eb,0x62487b0b,0xacb293ce,0x9c30942f,0x93ef940f,0x838d6aea,0x49a5730b,0x730a72ca,0x93ae72ca,0x6a8959e7,0x6a898b2c,0x51a64164,0x4985728a,0x496551a6,0x62085166,0x59a659e7,0x39046248,0x49864145,0x7aeb4164,0x62486a49,0x59a7830c,0x51c66228,0x51c66a89,0x51244104,0x61235123,0x79e57184,0x8a657a04,0xb3eaab89,0x7a459308,0x7a468265,0x92e98267,
-0x7a888b09,0x8aa882a9,0x8b288266,0x8bcaa44c,0x7ac87308,0x8aa782c8,0xa34a9309,0x82279b0a,0x92a68a67,0x9ac78aa6,0x91e69267,0x894499a5,0x81028943,0x836ab4af,0x72e86266,0x93ec93ec,0x93cb7b29,0x62466a87,0xa44d72e8,0x9c2cac4e,0x93cbac8e,0x836a72e8,0x834a93cc,0x6a687ae9,0x9bed72c8,0x8b6b9c0e,0x6267a44f,0xb49093ad,0x72a8938c,0x62267ac9,0x9c0d7ac8,0xbd72bd30,0x8becacef,0x62676aa7,0x6aa88b6c,0xa48f93ed,0x59e5836b,0x6a2751a5,0x51c56227,0x936b51c5,0x72a8a3ac,0x61e54102,0x61c58ae9,0x934b6206,0x518361e6,0x82e97aa8,0x62267267,0x83296225,0xacae9c2c,0x8bcb940c,0x6ac87b49,0x6a8772c8,0x8b6b7ac8,0x832a72a8,0x51e472c8,0x93cb6a86,0xa46db4ef,0xac8e93ec,0x7b099bec,0x938b832a,0x6a87832a,0x5a0651e6,0x51a551c5,0x620659a5,
-0x9bce72c9,0xa40fbcb1,0x5a077aea,0x59e65a07,0x51864965,0x496559c6,0xac317aeb,0x6a8aa430,0x6a694185,0x5a287acb,0x938d6a69,0x59e77aeb,0x62074985,0x830b82eb,0x7acb59e7,0x6aaa9bce,0xa42f72aa,0x626893ee,0x830c72ca,0x49856a69,0x6a2851a6,0xac309bae,0x51a6830b,0x72ea4144,0x6aea940f,0x62896269,0x730a6aa9,0x9bae8b8d,0x51a64985,0x830ca430,0x62483925,0x624872ea,0x6aaa51e7,0x834c7aea,0x5a286268,0x7b4c6aca,0x9c109c70,0x93ce93cf,0x51e75a28,0x5a275a27,0x62486a89,0x7b0b5a48,0x5a4749a5,0x9bce93cd,0x41855a48,0x62287aea,0x49454124,0x51654925,0x41454965,0x39444165,0x7b2c938d,0x6a896269,0x59e76228,0x412459e7,0x40e35166,0x492340e3,0x8ac96a06,0x92e89b49,0x72048265,0x82457224,0x92c78a66,0x828692e7,0x8aa68246,0x9b8ba369,
-0xa3cca3cc,0x82a8932a,0x8ae882e8,0x934982e8,0x82e89349,0x932a82c8,0xb3aca38c,0x7184ab6b,0x81837142,0x70c17921,0x89018101,0x890188e1,0x80e08921,0x62a75205,0xa46e8bab,0x93aca44e,0x72a88309,0x72a77ae9,0x93ec72c8,0x9c0cacaf,0x834972e8,0x9c2d93cb,0x72c893ab,0xa40d93cc,0x72e972e8,0x8b6ba44e,0x72a9a40e,0x9c0d7288,0x72c99c0e,0x72676246,0xa40d832a,0xaccfacaf,0xb530ad10,0x520593ec,0x836b836b,0x93ed6aa8,0x72e9ac6f,0x6a6851c5,0x49646227,0x622659e5,0xac2ea3cd,0x518472a8,0x5a066a67,0x5a075a06,0x7ac972c9,0x622751a5,0x8b4a9bac,0x51c559a4,0x6ac85a05,0xb4afa46d,0x940ca44d,0x8bab93ab,0x7ae9834a,0x836a93ec,0x834a8b8b,0x6aa76267,0x8bec5a87,0xa48eaccf,0xa42da46e,0x836a93cb,0x83297b08,0x6a677ae8,0x7ac972a8,0x6a067a68,
-0x516559a5,0x830a6227,0x9bce9bce,0x72aa8b2d,0x62086a69,0x620759e7,0x51a659e7,0x5a075a07,0x624851e6,0x7aeb7aea,0x62696aa9,0x72ca836d,0x730b5a28,0x6228832c,0x728949a6,0x72aa9bef,0x9bce6248,0x8b8da42f,0x8b8d9bce,0x51866228,0x72aa6228,0x938e9bcf,0x5a0759c7,0x51e75a28,0x8bae7b4c,0xa430a430,0x72ca8b6d,0x8b8d834c,0x51c66248,0x72eb8b8d,0x72ea4185,0x52278bce,0x72ab5a28,0x8b8d8bce,0x7b0c6289,0x72ca8b8d,0xa47193ef,0x838e9c10,0x7b2c5a48,0x51e6834d,0x834c6aaa,0x93ce51e7,0x41246248,0x832c6248,0x49a672ca,0x8b2c7aeb,0x516659a6,0x39044925,0x832c6228,0x51c772cb,0x624993cf,0x498651c7,0x41044945,0x48c248e2,0x7a475943,0x7a4792ea,0x8aa78247,0x930792c7,0x8ae78ae7,0xa369abcb,0x69837a25,0xb3eb8ae7,0x8b08abcb,0x82e982e8,
-0x83098b2a,0xac0c9369,0x8ae9abec,0x7a268286,0xac6e936a,0x82e99bcc,0x92e98ac9,0x8a8792c8,0x9a878226,0xa2c8b32a,0x79e38a25,0x71607981,0xb3079a24,0x9c0d838b,0x836a8bcc,0x7aa8832a,0x82e97aa8,0x62467aa8,0xa4ae838b,0x6a87940c,0xac8e72c7,0xac6da44c,0xaccdacad,0x7b49940b,0x838b836a,0xac907b09,0x834bac4f,0xb4af6a87,0x72c9b4b0,0x6a676aa8,0x832a7288,0xbd31c511,0x9cae9c8e,0x6b299c8e,0x8bab4a25,0x7b0972c8,0x93cd93cc,0x41446aa8,0x726861e6,0x5a2551c5,0x9c0c6a87,0x8b8bb4af,0x5a4849c5,0x51e69c0e,0x8b6c5a07,0x496472a9,0x7ac951c5,0x830a938c,0x494259c5,0x72a859e5,0xac4e93ab,0x9c0cac2d,0xa44da42d,0x838b8b6a,0x7b4a8bac,0x834a7b29,0x6aa87b09,0x8bac5a46,0x9c4d9c6e,0xac8fa44d,0x9bcbac6e,0x938b938b,0x6a466246,0x59a56a27,
-0x6a0661a5,0x51c67228,0x620751a5,0xa40f8b0c,0x8baea44f,0xbcd38bae,0x8b2ca3ce,0x8bad93cd,0x830b7b0a,0x6a69834c,0x72aa6228,0x6aca93ae,0x9c2f5a48,0x9c30bd33,0x7b2b834c,0x72cb8b8d,0x72ca5a28,0x6a697b0b,0xbcb28b6c,0x51c6832c,0x9bef72cb,0x728a93ce,0x62284985,0x93ad7b0b,0x6a69830b,0xa3ef7aeb,0x7aeba430,0x93ad6a69,0x41a56aaa,0x838d838d,0x7b6c5a48,0x6acb9c71,0x7b2c5228,0x93ce8bae,0x51c76289,0x93af72cb,0x6a8a8b8e,0x836e7b0d,0x49c649c7,0x5a286a69,0x6a895a27,0x7b2c4185,0x49867b0c,0x93ae6248,0x4164836c,0x6a494165,0x61e84966,0x518551a6,0x8b6d7aeb,0x51c75a08,0x41456229,0x51654945,0x51225164,0x79c35921,0x8a4671a3,0xb38bb38b,0x72059ae8,0x7a256162,0xabcc9b49,0x8ac8a36a,0x8ac88286,0x830882a7,0xa3cba3cb,0x7a46a3cc,
-0x9b8a7246,0x9bab9bec,0x8ae9934a,0x934a82c8,0x8b6a936a,0xa3cc9bcb,0x8ac89b6b,0x9b8b82c8,0x7226936a,0xb42ea36b,0xac4db48f,0x8b089b8a,0x8ae88ac7,0xa44ea42d,0x62878bab,0x93ab72c8,0x7ac98b0a,0x6a677ac8,0xa46d8b8a,0x7b0993ec,0xa44d834a,0x93caac6d,0xb4ef93eb,0x838bb4ce,0x836b6ac8,0x9bed9bec,0x8b6b834b,0x93ac6267,0x8b8bac6f,0x6a6772e9,0x83097ac9,0xa46e8b6b,0xa4efb531,0x83cb944c,0x51e55a26,0x72c8834a,0x9c0e8b8c,0x61e57b0a,0x6a676226,0x7ac859e5,0x51a45a06,0xb4af8b6b,0x5a0693cc,0x624749a4,0x49a57ae9,0x938c6a89,0x518572a9,0x7ac97288,0x7ac88b4a,0x496351a4,0x51e551c5,0x7ae96246,0xa40e834b,0xac8fbcd1,0xa42d93cc,0x7b2aa42d,0x832a8b8c,0x72a87288,0x62676267,0x72e96a87,0x834a8b8b,0x82e98309,0x72686a26,0x39036206,
-0x6a2751a5,0x62687268,0x7b0bac70,0x5a0851a6,0x62495a48,0x8b8e7b0b,0x72ab72ca,0x62896248,0x59e76228,0x8b6d72aa,0x6a899bce,0xb4d2a450,0x5a27838d,0x7b4c5a68,0x7b0b8b8d,0xa3ef93ce,0x7b2c7b0c,0x838c9bee,0x9bef7b2b,0x6a697acb,0xbcd28b6d,0x624893ae,0x72ca7aeb,0x8b4c5207,0xac71ac71,0x72ca938e,0x6a696a89,0x7b0b6a89,0x5a4872ca,0x8bae93ee,0x62aa5a28,0x836d93ef,0x51e749e7,0x6aaa628a,0x49a651e7,0x938e72cb,0x4166626a,0x7b0d7b2d,0x6a8951e8,0x72ca8b6d,0x626951a6,0x49a63944,0x72cb7b0c,0x72aa6a49,0x41246a69,0x49e74986,0x6a6949a6,0x51c649c6,0x59c77249,0x40e440a4,0x51655125,0x71c55124,0x7a0579a5,0xa38a9b29,0x8a859b28,0x92e771e3,0x92e8a36a,0x92a97a07,0x92a8ab4b,0x9b0a9267,0x9bcdabac,0x92c89b4b,0x8ae782a7,0x9b6a9369,
-0x8b098b29,0x82c78b08,0x9bab8b09,0x9bac9bec,0x8ae89b8b,0x832982e8,0x8b0a8b4a,0x9b6a82e9,0x8a668ae8,0x9b2a8225,0x82a99329,0xb4709b8c,0x832aa44f,0x836a936a,0x7b297ae9,0x7b097b2a,0x7ac88b6a,0x62466a46,0xacaea46e,0x6a866ac7,0xac6dac4d,0x8baaa44d,0x93ca8b8a,0x73097b69,0x9c2e7b4a,0x9bedbd11,0x7b29a40d,0x93ab6266,0x8bacb4b0,0x834b6227,0x6a886a47,0xacaf8b6b,0x9caea48f,0x9c6ead10,0x52057b49,0x834b6ac8,0x93cd7b2a,0x938aac6e,0x59c551c4,0x6247a3ec,0x62476a47,0x72e851c4,0x9becac2e,0x5a056226,0x72a88b4b,0x624849a5,0x624772a9,0x49846a48,0x82ea832a,0x7aa8832a,0x51a45a05,0x59e551a5,0x498451e5,0x7b096246,0x7b09834a,0xac4f8b6b,0x938ca3ee,0x9bce9bcd,0x7b0a830b,0x7b0a7b0a,0x61e57ac9,0x61e67a89,0x51855184,0x93ee7b0b,
-0x6a898b6d,0x5a2759e6,0x834d8bae,0x836e6269,0x628a93f0,0x49a73104,0x6208726a,0x6a8a4145,0x6aaa8b8e,0x5a073904,0x62289bce,0x8b8d5a07,0x730b93ef,0x838c6ac9,0x6a69836c,0x93ae6a69,0x6a898b8d,0xac7093ae,0x6a69830c,0x832c59c7,0x9bceac71,0x51a66a68,0x8b6c6228,0x6289a430,0x832c6268,0x9c0fa430,0x49c6832c,0x8b8d4185,0x51e77b2c,0x93ae730b,0x62695a28,0x8b8ea430,0x6a895208,0x8b6d9c10,0x51e751e7,0x93ae7b0b,0x496672ab,0x6a8a6a8a,0x498651c7,0x7b0b730b,0x7aeb51c6,0x51c67acb,0x9bcf8b4d,0x41655a28,0x41446228,0x7aeb51c7,0x5a295208,0x62084166,0x49246a29,0x6a075186,0x7a279b2a,0x79e479e5,0x7a048204,0xa38c8aa7,0x82458ac8,0x82a67a24,0xa34a8287,0x92e9abcc,0x8a678a87,0x82a78a67,0x9b6c9b8b,0x828782c9,0x82c78ae8,0xa3ec9349,
-0x934aa3cb,0x82e982e8,0x82e882e8,0x9b8b936b,0x7ac882e8,0x8b288308,0xa3cd938b,0x934a9bac,0x8ac882e8,0x8ac89308,0x8ae98aa8,0x8b2b8b0a,0xb3ee936c,0x7b297aa8,0x72e88349,0x7b087b29,0x72c86267,0x72e87ac8,0x9c2c9c0c,0x6a878349,0xac6d8329,0xb4aeac8e,0x9c0ca44d,0x9c4e9c4d,0xac6fa46f,0x9c0d9bcd,0x72c89bed,0x7ae86246,0xbcf1b4d0,0x832a72a9,0x72c86a47,0x93ed830a,0xa4afacd0,0x944e8c0d,0x7b2aacd0,0x93ac49c5,0x62677b4a,0xac6d8b6a,0x51a493ab,0x72686a67,0x5a065a06,0x62266206,0xa40d7ae8,0x7ae893ab,0x49a459e4,0x830a834b,0x6a4751a5,0x6a687ac9,0x49856206,0x938c832b,0x7289830a,0x51846206,0x624651c4,0x6a676a67,0x51a56206,0x51a55185,0x5a0651a5,0x51c66247,0x59a651a6,0x59a65184,0x59a561e6,0x51a559a6,0x41444164,0x836d72ea,
-0x9bce8b8d,0x62486a69,0x5a075a28,0x6a893904,0x7b0c93cf,0x49a74986,0x518759c7,0x49864966,0xa3ae7aec,0x414572aa,0x62285a07,0x51a64985,0xac718bae,0x6aca838d,0x8bae8bce,0x62485a28,0x6aa98b4c,0x9c0f72eb,0x59e77b0b,0x8b6d72aa,0x6a899bce,0x6aaa51a5,0x6aa972ea,0x940e8b6d,0x9c0fac91,0x6289834c,0x62695207,0x6aca7b0b,0x6a8993ad,0x7b2c49a6,0x624872ca,0x6a897b0c,0x39244145,0x62894185,0x5a086249,0x8b8e6aaa,0x49668b8d,0x7b0c38e4,0x49857aeb,0x7acb6228,0x51c751c7,0x622982ec,0x72cb6228,0x496559e8,0x49a651e7,0x59e76228,0x49455186,0x41254126,0x49844124,0x9b4a7287,0xab69a369,0x7a448a86,0x9b0892c7,0x82478aa8,0xab8b92c9,0x82a78ae8,0xa38a9309,0x9349a38a,0x934a8ae7,0x9b8aa3cb,0x82a77a87,0xa3eca3ab,0x7aa88b6a,0x932a8b09,
-0x8b098b29,0x938b8349,0x9b4aa3ec,0x7a877205,0x9c2c9c0c,0x8b098b8b,0x8ae882c8,0x8b2a8b09,0x93ec938c,0x7aa893cc,0xabcc8aa8,0x82879b8b,0x79e67a06,0x83298b6b,0x940d7b4a,0x836a8bec,0x6a879c0c,0x7b0859e5,0xac8dbcf0,0x6a868349,0x8b8a6a86,0x9c0c9bec,0xa44ea42d,0xbcd0ac6f,0x834bac4f,0x93ec8b6c,0x6a886267,0x93ccac8f,0x8b8b6a87,0x626793cd,0x6a677b0a,0x6aa75a06,0xacd0942d,0x940ca48f,0x9c4d8c0c,0x49a46aa8,0x72e97b2a,0x8bcb6ac8,0x8b6993cb,0x6a6749a4,0x59e67289,0x59e659e6,0x830959e5,0x9bac9bcc,0x62258b4a,0x5a065a06,0x6a676267,0x72e94964,0x51e572c9,0x59a44944,0x9bad8b4b,0x830a7288,0x51a57a89,0x72685185,0x72a87288,0x61c67aa9,0x72897228,0x59c659c6,0x518559c7,0x51855165,0x49645185,0xa40e6268,0x6a898b8c,0x596659c7,
-0x7aaa7228,0x830b6a68,0x936d9bce,0x51c76a69,0x7b2b72aa,0x49656208,0x930d5166,0x6a29934d,0x6a285166,0x6a487aab,0x6a4851c6,0x7acb93ae,0x72ea51a5,0x62688b8d,0x8b8d51c7,0x72ca9bef,0xac7093ae,0x9c0fa470,0x5a0672ca,0xbcb29bae,0x7aca830b,0x8b6d6a89,0x93eeb4d2,0x7b0b6268,0x93ef9c2f,0x836d730b,0x5a687b4b,0x7b4c7b0b,0x832d8bae,0x8b4d5a29,0x51a78b6e,0x6a694145,0x41256228,0x93ae51c7,0x6a89a410,0x5a283103,0x72aa834c,0x72eb51a6,0x39446aaa,0x6a4830e3,0x59e7834c,0x8b8e5a08,0x49865a08,0x51e84145,0x728a7acc,0x51a76a8a,0x598638e4,0x59855124,0x9b6b8b0a,0x71c38267,0x71c271a2,0xabcc82a6,0x92c8abec,0x69a37206,0x9bab7a25,0xa3ecb46e,0x720582e8,0x8b077a65,0xac6d93aa,0x7ac8a40c,0x6a257265,0x9bcc7aa7,0xa3eeac8f,0x722682e9,
-0x8b497267,0xa3ecac2d,0x82e98b0a,0x82e882c8,0x8b8b8309,0x9bcca42e,0x7a8682c8,0x9bcd8b29,0x8baba42e,0x7ac8836a,0x8ac982a7,0x7a278a88,0x82068a89,0x832a82e9,0x9c4e93cc,0x9c2da48e,0x5a0572e8,0x93ab5a05,0x9c2d9c2c,0x834993cb,0x62667b08,0x7b0a6a87,0xa42d834b,0x834b93cd,0x93cd9bcd,0x6a876aa8,0x6266834a,0xac6e93ec,0x72e98309,0x72a98b6b,0x624793ac,0x6aa872c9,0x940d834a,0x9c4e9c2e,0x7b4a83ab,0x52268bac,0x6aa849a4,0x7b2972e8,0x93ec9c4d,0x49a47308,0x72a859e5,0x5a066227,0x51c67288,0x9bed6a88,0x93cbac4e,0x5a2672e8,0x6a895a46,0x5a276206,0x6a4751a5,0x6a678b6b,0x51a54964,0x72a959e6,0x936c7aaa,0x6a277ac9,0x59e659c6,0x59c559e6,0x7aa96a47,0x82ca61e6,0x6a086a27,0x59a57248,0x59855165,0x51855145,0x7a6961e6,0x61e77228,
-0x7aaa7a89,0x49a55185,0xa40f6a89,0x6a69a410,0x6a284985,0x59c76a28,0x6a084945,0x82cb932d,0x51655986,0x61e761c7,0x496559c6,0x936d6a89,0x5a076a68,0x8b8d8b2c,0x6a896248,0x5a078b6d,0x9bee6248,0xa450acb1,0x62077b2b,0x938e936d,0x834c6248,0x7b2b9c0f,0x8bce6289,0x838ca490,0x9c4f838d,0x62887b4c,0x836c6aaa,0x730b9bef,0x836d732c,0x59e75a49,0x51c76a8a,0x7acb4124,0x59e7938e,0x49653904,0x832c72ca,0x41855a68,0x9bce6268,0x39246268,0x7b0b6248,0x5a086268,0x834d834c,0x626a6a8a,0x5a084165,0x5a0851a7,0x51a772cb,0x41254145,0x40e240e3,0x722569e5,0xa32a7a66,0x8a66b38a,0x7a6671e4,0x9329a36a,0x8ac88aa8,0xa38a9b2a,0x8b089329,0xa3ab82e8,0x9309abec,0x8b097a66,0x8b089b8b,0xa3ab82c8,0xa3ecabcc,0x7ac89b8b,0x9b8b82c8,0x8309936a,
-0x934a82e8,0x932a936a,0x93ab8b29,0x9bcca42d,0x82c88b4a,0x8b4a8b2a,0x936b8b6b,0x8b4a8309,0x8ac98b29,0xa3ac9b4a,0x92e9932a,0x71c69289,0x92878a47,0x72c872a8,0x8b8b8bcc,0x9bed834a,0x51c4834a,0x9c0c4984,0xa44eacaf,0x834993aa,0x93cb8b6a,0x72c8834a,0x6aa872c8,0x6aa86a68,0x6a886aa8,0x834a72e9,0x72e89bec,0x9bcc8b8c,0x7ae97b0a,0x93cc938c,0x7b2a7309,0x51e56247,0x940d6a88,0x83acacaf,0x940d838b,0x838baccf,0x628749c4,0x72e97b4a,0xa46e836b,0x72e8a44e,0x52055205,0x62476a87,0x7aea6227,0x59e66a69,0xac8f834b,0x8b8a9c2d,0x51c572e9,0x832a51c5,0x51a56227,0x624759e6,0x7aa97aea,0x59a65185,0x620751a5,0x938d6a28,0x620782ea,0x5a066227,0x49a451c5,0x59e659a6,0x59a65165,0x71e76a27,0x61656165,0x71a56944,0x59436165,0x49a45144,
-0x934c7289,0x49656a28,0x51e74965,0x7aeb8b4d,0x7aaa4965,0x7a8aa3ae,0x492459a6,0x82eb7a8a,0x59c77249,0x6a4851c6,0x59e76a48,0x62485185,0x622872aa,0x8b8d6a69,0x5a288b6c,0x72aa8b4d,0x62696248,0x9c2f7b2c,0x59e7836d,0x7aea936c,0x49a55a27,0xac507aeb,0x8badac70,0x9c4f93ee,0x838d732b,0x7b4ca470,0x836d5227,0x6aaaa470,0x7b0c49c6,0x39245a68,0x8b0c6a49,0x39246208,0x9bcf7289,0x49a672ca,0x93ee6249,0x522793ce,0x7b4c5a68,0x5a488b6d,0x5a683944,0x6aa97b4c,0x8b8e6269,0x498649a7,0x6a8a51a7,0x6a696a8a,0x49445a07,0x490351a5,0x7a6740c2,0x82668aa7,0x79e481e3,0x8a878225,0x7247932a,0x7a477a27,0x8ae88266,0xa3ec9b8a,0x82a78b29,0x82c78ac6,0x9b8b82e8,0x82a8938b,0x92a88aa8,0x82a88267,0x9b8ba3ed,0x82a77aa8,0x93299309,0xa40c8b49,
-0x8b099b8b,0x7aa782a8,0x8b4a82c8,0x8b4b9bcd,0x82a882c8,0x936a82c8,0x9beda40d,0x9b8b938c,0x92c88ae9,0xa36b8aa8,0x8aa892e9,0x82679b0a,0x8a878a87,0xa42ea42e,0x72c98b8c,0x8b2a7ae9,0x49837aa8,0xa42d59e5,0xa4aea46e,0x832993eb,0x93cc93cb,0xa44e93ec,0x8b6ba42e,0x836b8b8b,0x93cc836b,0x8bac7b4a,0x7b09836b,0xb4d09c0d,0x72e99c0e,0xa44f8b6b,0x834b7b0a,0x7b0a5a26,0x5a266a88,0xacb08bac,0x83aca48f,0xa48f7b8b,0x51e593ec,0x93ed6a88,0x73097309,0xa46ea44d,0x5a468b8a,0x832a72c9,0x51e65a27,0x832c6a69,0x62885a27,0xac8e9c0d,0x8bab940d,0x626772e9,0x7b0b49a5,0x51a66a68,0x62075185,0x8b4b8b0b,0x59c559e5,0x622759e6,0x728959e6,0x6247832b,0x93cd6a88,0x49a55a47,0x61e66227,0x59445944,0x71645903,0x81e68a28,0xb3aca30a,0x72469309,
-0x496559e5,0x41255185,0x51e74965,0x72ea728a,0x51a76228,0x6a286a28,0x51c76228,0x6a285186,0x5a076a69,0x728a51c7,0x7acb8b0b,0x5a0859c7,0x830b7b0b,0x59e76228,0x622772aa,0x938e7289,0x8b6d7aeb,0xb4b2ac91,0x7aea93ce,0x8b6cb470,0x832c830b,0x7b0a6248,0x942fb4d2,0x9c2f5a68,0x62c9940e,0x7b2b5a47,0x62696aca,0x730c93ce,0x72eb49c6,0x5a28836d,0x62694145,0x51c67aca,0x93ae49a6,0x93ceb491,0x52275a07,0x93ee8bad,0x41c65207,0x93ee838d,0x49c66a8a,0x940f838d,0x51e751e7,0x5a297b0c,0x41455a08,0x830c59e7,0x38e272aa,0x718440c2,0x51017143,0x826671e4,0x8ac67a45,0x9baaa3a9,0x9b8cabed,0x8aa892ea,0x8ac892e9,0x8b097aa7,0x9b6a9309,0x93298ae7,0xa3eca3ab,0x9b8ba3cc,0x92e99b09,0x936aa3ab,0x82a97aa7,0xa3cca3ac,0x830982e8,0x9b8b9bab,
-0x8b2a938b,0x9bab934a,0x8b299bab,0x934b7a87,0x9b8ba3cc,0x8b098b09,0x8b4a8b29,0x8b4a938c,0x9bada3cc,0x8a88932b,0x8aa67a05,0x9b89a3a9,0x82678286,0x93aca42e,0x6a47832a,0x82886a26,0x61a471e6,0xac4d59a5,0x9c6dacae,0x8b8a9c2c,0x93cc8b6a,0xac6f93cc,0x93cd93ed,0xac6fa48f,0x7b4a8bab,0x9bec93ec,0x9c2e7b2a,0x93cda46f,0x7ae972c9,0xa46f9bed,0x6ae97b2a,0x6247836c,0x622751e6,0x8bcd6aa8,0xa4af942d,0x83ab83ab,0x8b8ba46e,0x622649c5,0x7b298b8b,0x93eb7b29,0x9c2dac8f,0x49a56287,0x8b6c7b2b,0x5a4749c5,0x7aea7b0a,0x6a885a47,0xa44f93ed,0xa44e9c2e,0x62478b8c,0x59e64984,0x59e66a68,0x6a6851c5,0x6a686227,0x51855a06,0x62065185,0x62066227,0x8b8c6a67,0x72a96227,0x7aa9938c,0x7a476a06,0x69e55963,0xbbecb3cc,0x8a6692a7,0x9a679a87,
-0x8aca9268,0x82ea8b0a,0x59c56a27,0x59e651e6,0x412451a6,0x72695145,0x72aa8b4c,0x724959c7,0x6a69830c,0x51c651c6,0x8b2c7aca,0x6a495a07,0xa3efa3ef,0x51856248,0x936d830c,0x7aca6228,0x6a8a7289,0x8b8d7b2c,0x728a8b6d,0x832ba40f,0x8b6c6aa9,0x5227832b,0xa470730b,0x6289940f,0x6aca9c50,0x838d49c7,0x41a57b4c,0x83ad6aca,0x418549e6,0x834c72eb,0x41855a27,0x9c0f72ca,0x6aca838d,0x8bae5a28,0x7b2c93ee,0xacb193cd,0x72ea9c50,0x9c30838d,0x62aa9c0f,0x51e73965,0x5a485207,0x6a6a93af,0x728a728a,0x308151a6,0x6a074944,0x822569e6,0x692181c3,0xabca8a66,0x9349ac0c,0x7a877a87,0x82877a86,0xa3ac9b4a,0x932aa3ac,0x61c47246,0xac2d8b08,0x934aac6e,0x72467aa7,0x8b287aa6,0xac4d9baa,0x82c7938a,0x72457265,0xac6e8b49,0x8b4aac4e,0x6a467aa7,
-0x9b8b82c8,0xa3acac0d,0x7ac88b29,0x7aa76a46,0xabed936b,0x934aa3cd,0x6a877aa8,0xa3ed8b29,0x9badac2e,0x7a87830a,0x8aa67a66,0x9ac792e8,0x8227a2e9,0x8b8bac6f,0x6a467ae9,0x61645944,0x71c571c5,0xac0c69c5,0xaceea44d,0x836a9c8d,0x93ed8b6b,0x8b8c8b8b,0xa44fb48f,0x836a8bac,0x93cc8bab,0x8b8a838a,0xa46fa44e,0x93cd9c4e,0x5a266a88,0xbd1193ac,0x62a8a46f,0x624772e9,0x62275a07,0x732a5206,0x8c0d9c4e,0x9c6ea4af,0x8b6b838b,0x59e5832a,0x8b6a6246,0x7ae97ae8,0x9c2d8b6b,0x7b299c2e,0x6aa85205,0x7b0a93cd,0x5a265a26,0x730a7b0b,0x6ac96248,0x9c2e8bac,0xa44ea44e,0x6aa893ac,0x51c651e5,0x59e751c6,0x518561e7,0x59e651a6,0x59e559e6,0x59a659c5,0x518561c6,0x6a275184,0x61e67aa9,0x82a86a26,0x59e451a3,0xabcb7aa6,0xbb8ac42c,0x81239205,
-0xb38ba287,0xababbc2d,0x8ae88287,0x9b8b934a,0x6a07932b,0x598561a5,0x6a486227,0x516561c6,0x7acb6228,0x49456a48,0x59e751a5,0x49a559e6,0x938d6248,0x59c68b4c,0x9bce830b,0x7aca6a49,0x7b0b9bae,0x8b8d7b0b,0x59e66249,0xac4f8b2b,0x7b0b7aea,0x93ee9c0f,0x9c2f732b,0x836dacf2,0x9c509c2f,0x49c66aaa,0x72eb72ea,0x836d5a48,0x730b940f,0x5a684165,0x730b838d,0x5a4851e7,0x93ed72ea,0x732a836c,0xb4d2a470,0x838d8bce,0x940f940f,0x49e65a69,0x628949e7,0x6a896268,0x6a69836d,0x6a694986,0x72486208,0x490361c6,0xa36c7227,0x61a492e9,0x8a457a25,0x82a68a45,0xabcc8b29,0x7a06abcd,0xab8979e4,0x8b4aa36a,0x7aa982e9,0x8b498aea,0x8b298307,0xa3ec9bcc,0x82a7934a,0x9b6982c6,0x834993cb,0x9b8a8b49,0x9b89a3aa,0x7ae88b28,0x9bac8b6a,0x7ae9938b,
-0x9b8b8b2a,0x930a932a,0xa3cc9b6b,0x9beb9beb,0x82a89b6a,0xa3eda36c,0x7b088b4a,0x936b936a,0x83088b0a,0x93ab938b,0x9b098b4a,0x81e59ac9,0x92278a26,0x7ae9834a,0x72478b0a,0x81c658e2,0x79c59a68,0xbc6d7205,0x944cac8e,0xa48ea48d,0x730993ec,0x940d8b8c,0x836b7b4a,0xac8fac6e,0xa46d9c2c,0xacafacae,0xa44eb4f0,0x6ac97b4b,0x6a8872ea,0x93ed6287,0x8b8bacb0,0x51e649c5,0x59e66206,0x62886226,0xacd083cc,0x8bec8bec,0x832a7b2a,0x8b4a9bcc,0x5a056205,0x72a88b4a,0x93ec7b2a,0x93ec9c2d,0x52057329,0x72e86a87,0x5a0672c9,0x7aeb72a9,0x6aa86ac9,0x62885226,0x9c0d834a,0xac909c0e,0x5a069c0e,0x6a884964,0x7aea7ae9,0x9bcd93ad,0x6a88834b,0x51a651c6,0x59c66207,0x6a276a48,0x518561e6,0x59845164,0x72056184,0x8a469267,0xa2c79aa7,0x9ae7a2c7,
-0xa3289ae7,0x8a448a65,0xbbebab49,0xb40cb40b,0x8246a349,0x8aa98a88,0x69e67227,0x51245965,0x6a284924,0x59e77aca,0x7a8a51a6,0x62287aea,0x51a651a6,0x51a651a6,0x62084985,0x622872aa,0x8b4d6a29,0x9bef9c0f,0x832b93ae,0x93ad7aca,0x730b8b8d,0xb4f293ef,0x8beeb4d1,0xa4917b6c,0x6aeb838d,0x8b8d9c30,0x834d6249,0x5a278bae,0xa470834c,0x6aea8bad,0x7b4b6ae9,0x732a838c,0xa4707b6c,0x7b6c9c2f,0x9c2f732b,0x6288940f,0x834d836c,0x732b6aaa,0x838d6ac9,0x5a288b8e,0x7aeb6248,0x934d59c7,0x40e359a6,0x61a56185,0x824769c5,0x93297a26,0xa3caa3aa,0x92c8a389,0x92a78a46,0x92c89b09,0x82889b29,0x82c78b08,0x9b697a86,0x936aac0c,0x9309934a,0x8b097a87,0x9b6a9329,0x82a89b6a,0x8ac78ac8,0xa38b9308,0x936aabcc,0x8ae88b08,0x82e882c8,0xa40c8b29,
-0x7a878329,0x8ae98ac9,0x936a82c8,0x932aa3cd,0x82a882c8,0x7aa87a67,0xa40e9bac,0x7a87832a,0x8ae78b09,0xa3ab82e7,0x8289932a,0x8a6892a9,0x79a49ac9,0x72a772e8,0x720569e5,0x92268a26,0x81c59a67,0xa3cc69a4,0xad0fac8e,0x93cc9c8e,0x834a8bac,0x838b8bac,0x8b6c9c0e,0x72c872e9,0x834a72e8,0xb4f0a42e,0x8b8ca44f,0x834b7b0a,0x72a88b6c,0x93cd6a88,0x93edacaf,0x6a885a47,0x51c66247,0x62476247,0x8bcc49c5,0xa48eac8f,0x8bcc940d,0x9c0c93cc,0x624693cc,0x7b0a5205,0x7b09832a,0x9c4e93cc,0x8bab9c2d,0x49c46287,0x7aca7b0a,0x49a559e6,0x834b72a9,0x72e96aa8,0x9bcc5a47,0xa40ea46f,0x6a887b0a,0x7aea72ea,0x6a687aea,0x6a886247,0x7aea72c9,0x7aea830a,0x49a551c5,0x7288830a,0x8b2b6a67,0x51447aca,0x69a45142,0x8a068a26,0xab299a86,0xc44dbc2c,
-0x9ae7a38a,0x92859aa6,0xa3078a45,0x9b08bbca,0x82457a04,0x9b078a45,0xabeda36a,0x92eaab8c,0x61c67206,0x62276a68,0x6a0751a6,0x934dabf0,0x6a4959e7,0x82cb830c,0x62276228,0x620772aa,0x7a8a61e7,0x7aca7aeb,0x72aa72ca,0x72a97aea,0x834c9bee,0x7b0b6248,0x72eb940e,0x8b8d5a68,0x6aca838d,0x93cf7b4c,0x8bae838d,0x8bad9c0f,0x7b4c9c2f,0x83ce732b,0xa4b29451,0x6acb9430,0xa491836d,0x6a899c0e,0x8b6d7b2b,0x7b8c6aea,0x7b4c9c50,0x9c715207,0x4a077b8d,0x836c7b4c,0x7aaa5a08,0x59654903,0x59856185,0x8a888289,0x61835963,0x7a458286,0x9b4a9b09,0x8a678ac8,0x92c68a66,0xa3cb9b89,0x9b8ba38b,0x82a882c8,0x82e88ae8,0x936b9309,0x8ae98ae9,0x934982a8,0xa3cc9b8a,0x936babed,0x93098ac8,0x8ae99349,0x8b2a8ae9,0x934a936b,0x936a82e8,0xabac9bab,
-0x934a9b6b,0x9b8b8b4a,0x82e9936a,0x936a8ae8,0x8b49a3cc,0x9b8b932a,0x9b8b9b8b,0x8b499bac,0xa3ab9349,0x82879b6a,0x8ac97a27,0x82479aea,0x8a888246,0x51a451e5,0xa2878a47,0x89c481c5,0x8a05a286,0xb46e69a4,0x944dbd10,0xb4f0accf,0x7b2a8b8a,0xb4af834a,0xa44e9c0d,0x93cdac8f,0x72e972c8,0xbcd09bed,0x9c0d93cc,0x9bac93ac,0x62677ae9,0x8b8c8b8c,0xac8f8bac,0x5a278bcd,0x624759e6,0x59e659c6,0x5a067aa9,0x9c0d834a,0x9c8faccf,0x6ac87b8b,0x9c6e7b6a,0x49a46287,0x8bac7b2a,0x73096ae9,0x9c4ea46e,0x7b2a8bac,0x39635a06,0x8b0a832a,0x51a651a4,0x7aea72a9,0x8b8b72a8,0x9bcdb4af,0x72c86aa8,0x51a66a89,0x6a485a07,0x936c830b,0x72678b4b,0x7b095a06,0x6a87938b,0x72a851c5,0x8b6b9bcc,0x72887288,0x51837267,0xa3295963,0x8a669ac8,0xab8b9b29,
-0x9b09a349,0xc42ca369,0x9b08c42d,0x9b088225,0xb3a9c3eb,0x8a86a307,0xa36a9b29,0x9b0ab3ac,0x92e992e9,0x41246206,0x59a759a6,0x69e861c8,0x496559a7,0x9bae726a,0x5a068b6d,0x936c8b2b,0x82ca61e7,0xac50bcb1,0x8b4c6a89,0x832ca40f,0x62486a68,0x5a285a28,0x93ef72eb,0x9c50b4f2,0x834c6aea,0x8baea471,0x9c3072eb,0x6268a471,0xa4b17b0b,0x7baea4b2,0x838f7b8e,0x836d732d,0x5a485248,0x7b0ba470,0x938d59e6,0x5a889c0f,0x8bae6b0a,0x9c50836d,0x62ca8bcf,0x72ca6289,0x69e77289,0x50a248c3,0x82078248,0x7a4671e5,0x8ae68286,0xab8aa38a,0x7a468266,0xbc2ca36a,0x8aa7abab,0x82e87a87,0x82c98b09,0xa3ab8b09,0x9b4abc2e,0x72265984,0xb44eabcc,0x8309ac0d,0x82e87aa7,0x82e97ac8,0xbc6ea3cb,0x8b099b8a,0x7a676a26,0xac2e9bac,0x934aa3ec,0x7a477aa8,
-0x934a8ae9,0xac4ea40d,0x7266936a,0x7aa77266,0xb48e938a,0x82e8a3ec,0x7a677246,0x93ab932a,0x9b6aa3ed,0x8aa88ae8,0x82477205,0xa30aa32a,0x8aa88ac8,0xaaea8aa9,0xaa67baea,0x99e599c4,0x9206b288,0x9b8a6984,0xbd11ac8e,0xa48eb4f0,0x6aa893ec,0x9c0d834a,0xbcf1c552,0x93ccac6f,0x7ae8832a,0xcd3293ac,0x93aca42e,0x8b6b9c0d,0x72a872c9,0x940d72e9,0x8bac7b0a,0x836bacb0,0x5a265a27,0x59c659e6,0x498459a5,0x8b8b6267,0x9c6e8bec,0x942da4af,0xa46e93cc,0x838bacaf,0x6aa85205,0x8bac8bcc,0x942e732a,0x9c2eacd0,0x72c88b6a,0x49845a06,0x8b6c7288,0x51c55206,0xac8f72e9,0x7b099c0d,0x72e97309,0x6a686a67,0x5a066a47,0x62076207,0x72a85a06,0x62467ac9,0x9bac7ae8,0x7b0b6226,0x6a8872c9,0xa40c936b,0x6a878b49,0x72c75a45,0xa38ba3ec,0x89838a27,
-0xac4c9ae8,0xb42eb4ee,0x92869b09,0x8ac68265,0xb46da389,0xabccbcd0,0x91c39a87,0x93078204,0xbc70b3ed,0x8269abef,0x51855985,0x59c75145,0x6a497a69,0x51a659c6,0x62285a07,0x6a486228,0x51e66227,0x7aaa6247,0x6a6972aa,0x72aa5a07,0x8b6c8b4c,0x93ae836c,0x6aaa836c,0xa491940e,0x9c2f83ad,0x7b4c8bce,0x9c2f8bce,0x62898bae,0x9c7193ef,0x6aeb83ce,0x8baf7b4d,0x520772aa,0x62c9732b,0x7b2b5226,0x6a698b6c,0x93af6aaa,0xac519bf0,0x51a67b0c,0x8b4c6a49,0x5186728a,0x49245186,0x7a275184,0x79638a26,0x7a246101,0xac4d9b8a,0x8ae8ac2c,0x82458286,0x9b698285,0xabccac0c,0x79e6a2e9,0x930a8246,0xa3cda3ac,0x7ae98b2a,0x82e89348,0x934a82c7,0xac2ea3cc,0x72068b2a,0xabeb8ac8,0x8b0aa38a,0x936c936b,0x93aa9bec,0x83088b29,0xb3eda3ac,0x7aa88aea,
-0xabcc8b0a,0x934aa3ab,0xa38b934a,0x936aa38b,0x83298b29,0x9bec9bec,0x82c88309,0xa3cc9b4b,0x92e9932a,0xabac9b4b,0x92e98ae8,0x72469b4a,0x82878267,0x79838246,0xb2888123,0x9a07baa8,0x9247b2e9,0x9b6b69a4,0xacaeac6e,0xbcf0b50f,0x730993eb,0x72c893cc,0xb4b08b6a,0x8bacb4d0,0x836b6aa8,0x93cdbcf0,0x7b2a836b,0x72e98309,0x7ae96a67,0x834a93cc,0x8bac9bed,0x93cd93cd,0x416472c9,0x6a685a06,0x7ac94985,0x626772c9,0xa48e8bac,0x93ec9c4d,0x93ec8bcb,0x8bac7309,0x6ac99c2e,0x730a49e5,0x83ac940e,0x9c0d732a,0xa42eac8f,0x7288938b,0x5a0649a4,0x7b0a7aea,0x93ec6a87,0x8b8bac6e,0x6ac96288,0x6aa8832a,0x6a686267,0x7ae9938c,0x6a476a88,0x8bab72a8,0x830a6a88,0x6a89a40e,0x8b6b49a5,0x7ae8938b,0x6a26936b,0x59c459a4,0x92e96a05,0x92a792e9,
-0xabcba34a,0x92e89349,0xbbecb38b,0xbc2cc44d,0x8ae7a36a,0xb3ec9329,0x9287b36a,0xb36a9ae8,0x8aa8a36a,0xab6c92a8,0x598492ca,0x59a64964,0x8b0b8acb,0x498561c7,0xb4708b2c,0x6a687aca,0x9c0e93ce,0x6a497aca,0xac509bad,0x938c93ae,0xb491a450,0x51e67b0a,0x7b4c72eb,0x8bce93ee,0x9c70942f,0x9c4fa4d1,0x942f838d,0x8bcda4b1,0x8c0e83ad,0x6a89942e,0x6a684165,0x832b8b2b,0x62a8730a,0x838c5a87,0x9b8e9bce,0x51a77acc,0x622959c8,0x5a075a08,0x39043923,0x41054946,0x71e64904,0x698369e6,0x8a2679a4,0x92c78205,0x82c8a36a,0x9b6a8ae9,0xb38bb3ab,0x92c8ab6b,0x93098287,0x8ae89329,0x8ae99309,0x92e892e9,0x9bcb8b09,0xa3ccb44d,0x82c89309,0x8b098ae8,0x9b6a934a,0x82a88b09,0x82c88ae9,0xabec82c8,0x934ab40d,0x93099309,0x82e982c8,0x9bcc9bac,
-0x82c88309,0x92e98b09,0xa38b8b09,0x8b09ac0d,0x82e882c8,0x8b6a8b49,0x9bcc9bcc,0x932a8b09,0x7a8882c8,0xa38c9b2a,0x9b2a9309,0x8aa8ab6b,0x9b2a8267,0xbb8abbeb,0x9a46b2e8,0x92678184,0x8a47c3ab,0x82c95963,0xbd30bccf,0xacafacae,0x9c6dbd10,0xac8e7b4a,0x9c2d9c0d,0x72c9838b,0xb4af93cd,0x72e993cc,0x73097b2a,0x832a7b0a,0x6aa77ae9,0x49c46267,0x62a85226,0x9c6f940d,0x6a898bcd,0x59e651a5,0x5a275185,0x51e651c6,0x93ee6267,0x9c2db4d0,0x940d7b4a,0x9c0dacaf,0x940d8bac,0x62a883ac,0x83ac5a67,0x7b4ba46f,0xa42f7b2a,0x9beea44e,0x72e993ac,0x5a265a06,0x8b6b5a05,0x836b9c0d,0x72c872e9,0x72e96aa8,0x6a6872a9,0x7b09832a,0x9c0d93ed,0x7b2a7b09,0x5a26940d,0x836a93ed,0x72c85a46,0x7b0a8b4b,0x932a7ac8,0x79c57a06,0x69a371a4,0xb46da3cb,
-0x9ac89329,0x92c7a309,0xabcc8ac7,0xababbc2e,0x92e78ae8,0x92c6a307,0xbc6e9349,0x92a8a36b,0x92a68a87,0x92879ac6,0xb38cc3ed,0x51446a06,0x6a2859a6,0x61e76a28,0x6a896207,0x5a4772aa,0x9c2f732b,0x82cc93ae,0xa4309b8e,0x6a88832c,0x7aea7aeb,0x8bee7aeb,0x9c2e9c50,0x6b0aa491,0xa4b162c9,0x83cd944f,0x9c709c70,0x8bed8bce,0x49e683cd,0x93ad730a,0x51657289,0x82ea59e7,0x8b8d93ad,0x6aa98b8d,0x51864185,0x496659c7,0x49663904,0x51e659e7,0x8b4d832b,0x48e36a09,0x82065943,0x820481e4,0xa3498245,0x8a879b49,0x92a88a68,0x826792c9,0xa34ab3ac,0x82678288,0x8b0792a6,0x93ca8b68,0x934a9baa,0x82c882c8,0x8ae982a8,0x932a9b6b,0x8aa882a8,0x9b499308,0xa3cca3ab,0x9b8ba3cd,0x93298b09,0x9308a38a,0x930a9309,0x932a9b0b,0xa3ec8ae9,0xac2ea40c,
-0x9b8ba40d,0x93298b29,0x9b2a9b2a,0x934a934a,0x83089b6a,0xa3cb934a,0xac0da40d,0x8b099bac,0xa3ac934a,0x8288934b,0x928892c9,0xa2c98a27,0x8a888a47,0xa308c46c,0xa2e89aa7,0x9ae892a6,0x8267b38b,0x72678b08,0xb4cfa40c,0xb4f0b4f0,0x942daccf,0xa44e8beb,0x73099c2d,0x940d836a,0x9c0d9c2d,0x940d93ed,0x93ac93cd,0x9bed9c2e,0x834a8b8c,0x6aa872c8,0x5a466287,0x7b4b5226,0x93ee9c4f,0x41646a69,0x832b6a89,0x834b4964,0x51e572a9,0xac6f7b2a,0xa44eacaf,0x8bcc9c2d,0x72e9836b,0x9c4f838b,0x5a6783ac,0x8bcc6287,0x7b2a8bac,0x9bed836b,0x9c0d9c0d,0x832aa42d,0x62676267,0xa46f9c0d,0x72e9836b,0x6aa872e9,0x836b72c9,0x72c972c9,0xac8f9c0d,0x6a888b8b,0x628793cd,0x8bcb7b29,0x834b6a86,0x62478b6c,0xbcaf9bcd,0x69e5932a,0x69c471e5,0xbc6e9b4a,
-0xabaaac0c,0xb40c9b08,0x9b09bc0d,0xa38b92a8,0xa3cbb44d,0xabca9328,0xac0cb3ec,0xb3ccbc2d,0x93489308,0xa308aba9,0x8a879aa7,0x7207a34b,0x61c740e3,0x8aeb82ab,0x72a98b0b,0x838c7b4b,0x59e76289,0x8b4e7aeb,0x5a076a69,0x9c0f8b6c,0x6aaa8b6d,0x838d7b2c,0x62c9730a,0x9c4f7b8c,0x9c909c90,0x8bee83ac,0x8bee9c90,0x9c6f7b6b,0x730a838c,0x624872a9,0x82cb6a49,0x726982eb,0x49a65a07,0x5a076248,0x414449a6,0x624951a6,0x62486248,0x82cb8b4d,0x59456a08,0x694558e3,0x928879e6,0x8a858a25,0x9ba99b68,0xa32ba3ab,0x9b0a8ac9,0xa30ab38b,0x82868a67,0xa3aba3ab,0x8ae98ae8,0x93299b6b,0x8b6a936a,0x938c8b6a,0x9309abec,0x82a871c4,0xac0da3ec,0x8ac8936a,0x9b499308,0x93299329,0xabed9b8b,0x8287abec,0x8b296a04,0xac2dac2d,0x7aa8934a,0x92c892e8,
-0x93ab930a,0xa42d9c2d,0x7a669b6a,0x93087205,0xac8ea3ec,0x82a7938b,0x82a78266,0x9bed934a,0x9bcca46e,0x7a4682c8,0x92479288,0x922781c5,0x7a269aa8,0x92c8b40c,0xab49a308,0xab49a2e7,0x8267ab28,0x7a879b4a,0xb4b09bcc,0xb4efaccf,0xacafbd31,0x83ab8baa,0x7b4a7b49,0xa48f9bed,0x93ed9c2d,0xb4f0ac8f,0x940da44f,0xa46f9c4e,0x8bab9c0d,0x836a93ab,0x7309834b,0x6aa86ae9,0x836c5a47,0x7b0b9c4f,0x51a651e6,0x62476227,0x624751e6,0x5a466247,0xacaf8bec,0x836bacaf,0x9c4e8b8b,0x83ac8bec,0x9c6fa46e,0x5a4783ac,0x72e962a8,0x8b6b836b,0x7b097b09,0xa40d8b4b,0x9bedac8e,0x7b097b2a,0x93cc8bac,0x7b2a838b,0x73097b0a,0x9c0e7b09,0x8bacb4d0,0x93ac6246,0x6a88ac4f,0xb4b072e9,0x6aa8834a,0x93cc7b09,0x7b2ab4d0,0x6a8772a8,0x7a876a46,0x82468246,
-0xa3eb9b08,0xc46ec4ef,0x8ac7a36a,0x8b088aa7,0xbccf9bec,0x9b8ab4af,0x92668aa7,0x9b489ac7,0xd4efbc2c,0xa308c46d,0x81e58204,0xab6b9aa8,0x61c58ac9,0x6a085165,0x8b4b8b2b,0xa42f836c,0x72aa936d,0xac518b8e,0x6a8993cf,0x8b8d6aaa,0x62687b0b,0x7b4b6289,0x8bee940f,0x8c0e732b,0xa4b1acd2,0x62a9732b,0xb4f18bee,0x93ceacb2,0x9bef72aa,0x8b4eb472,0x51a759c7,0x82ec726a,0x4966728a,0x41654965,0x6a685a07,0x62886246,0x6aa98b8b,0x8b0d8b4c,0x48626166,0x694360e2,0xb3ab8225,0x9329b40c,0x6a247ac6,0x8b096a45,0xb3edabcc,0x92c8ab8c,0x72247a25,0xabec9307,0x9b4ab40d,0x71e58a88,0x930a7246,0xa3ecabed,0x82878b0a,0x82c782c7,0xa3cb82e8,0xa3ababec,0x722582a7,0xabcb8ae8,0x9b8babec,0x9309936b,0x8b288b09,0x938b8329,0xa3acac2d,0x82887a67,
-0x9beda38b,0x8baa93ec,0x9b6a936a,0x93299b4a,0x9b8b8b29,0xa3acac0d,0x8aa88ac8,0x93cb9b8b,0x932a834a,0x8a878266,0x82269267,0x9a889268,0x8aa88a67,0xb3cbb42d,0x8a45ab29,0xc3eaa308,0x92e88a86,0x932ab3ec,0xac6f7ae9,0xb4f0bd32,0xaccfacaf,0x838aacaf,0xacaf7b6a,0xa44eacaf,0xb4f0b4f0,0x8bacac8f,0xa44f93ed,0x93ac83ac,0x93ec9c0d,0x940c93cc,0x9c2da48e,0x730a7b4a,0x520672e9,0xa4706aa9,0x4144836c,0x6ac96a88,0x49a551e6,0x49e551e5,0x7b2a5a26,0xa48f9c0d,0x8baba48f,0xa44f8bcc,0x6b098bac,0xa4af940d,0x62888bed,0x6aa75206,0x8b6b7b29,0x62678bab,0x93ec6aa7,0xa42eac8f,0x9c0e8b8c,0x72e9a46f,0xacaf836b,0x9bedb4d0,0x7b2a7b09,0x93ab838b,0x6a469bcc,0x9c0e7b09,0x7b6a730a,0x8b8b942c,0x6aa8832a,0x498351e5,0xa38c7ac9,0x926692e8,
-0xb44db3ab,0x932a8b69,0xbc2db3ac,0xabebb44d,0x8b6a934a,0xb44ea42d,0x9287ab8b,0xcc2cab28,0xa349c40c,0xb36aa32a,0xbb6ac3ec,0x9287a2c7,0xa36bab8b,0x51857206,0xa40f82ea,0x6a496248,0x726982cb,0x7aeb7269,0x936d7aeb,0x7aeb8b4d,0xac71ac50,0x72eb7b0a,0xa471a471,0x7b6c940f,0x942f734b,0xa471acb1,0x9c0f93ef,0x830c9c10,0x6229728b,0x726a6a4a,0x6a4a7aab,0x41454145,0x5a075166,0x49a66a69,0x9c2e6ac9,0x6ae9940d,0x62486aa8,0x496572ca,0x71a548c2,0x9ac69aa6,0x8aa78225,0xa3cc934a,0x7a869b6a,0x9b8a82a7,0x930a9bab,0xa3ab932a,0xab8babcc,0x8aa79b09,0xab8b9329,0x92e99b0a,0x9b2a82a8,0x8ac89b0a,0x9bec8b29,0x9baba3ec,0x82e79b8a,0x9bab9b69,0x8309934b,0x93499329,0x93099329,0xa42d936a,0x9bcbac2d,0x82c88b29,0x932982c8,0x9b8b9b8b,
-0x8b098ae9,0x8b298b2a,0xac0d93ab,0x9b6aa3ac,0x8ae88b09,0x8b297aa7,0x9b4ba3ac,0x83097a88,0x7a468b08,0x9aa892a8,0x92678206,0x8246a309,0x92c98a87,0xb3cc9b8a,0xa2e8ab2a,0xb348b36a,0xc42ca2e7,0xabedc46f,0x7b6b72c9,0xbd319c6e,0x942dbd51,0x836a838a,0xa46e93eb,0xbd30bd31,0x9c2eac8e,0xacafa42d,0x7b2a8b8c,0x624672e9,0x72e86246,0x93ec836a,0xac8f940c,0x7b4a9c2e,0x7b2b7b4b,0x62885a47,0x7b099c2e,0x49a451e6,0x8b6c6a67,0x72e98b8b,0x59e56267,0x9bed6ac7,0xac8fac6f,0x732a8bcc,0xa46f940d,0x838b6b09,0xac6fa48f,0x72c98bcb,0x5a456225,0x9c0d7ae8,0x7b0a9c0d,0x7b2a6288,0x7b0a8b6b,0x93cc8329,0x73098b8b,0x7b297b09,0x832a834b,0x836b7b2a,0x62467309,0x9c4d9c0d,0x73096ae8,0x8bab93ec,0x9bac93ac,0x7a886a27,0x7a6761a5,0xb40cb40c,
-0x92e99308,0xa36a92c8,0xb40da36a,0xabecb48e,0x8ae89b29,0x934982e7,0xc46f9b8b,0xa3089b4a,0xa2c8a309,0xb36bab09,0xc3eccc2d,0x9ac7bb89,0x92e78a65,0x72889349,0x61e85185,0x61886a09,0x8b2c7a6b,0x49a56a69,0x9bae7b0b,0x6a696a49,0x7b2c6aaa,0x6aca7b2b,0x9c70732b,0xacd2acf2,0x834c7b6c,0xa4519c0f,0x62498b8e,0x8b0c5a48,0x9b6da3cf,0x51656a49,0x41434964,0x936c5a27,0x49657aca,0x72ca728a,0x834c6a8a,0x9befa430,0x38e36249,0x61c54904,0x6a4559a4,0xa3ca9389,0x8a879ae8,0x8aa78246,0xa3ac8ac9,0x82878b0a,0x82c892e8,0x8b498b29,0x9b2babcb,0x8aa89ac9,0x82c78285,0xa40b8b48,0x82889b4a,0x92c98a88,0x83297aa7,0x8b099bac,0x8aa882a8,0x8b0882a7,0xac4d9c0c,0x7ac8938b,0x8b288b09,0x936a72c7,0x8aea936b,0x93098ac9,0x93aa8b29,0x9c0da44d,
-0x8b299bcc,0x93298ae8,0x8b0a932a,0x934a936b,0x8ae88b09,0x9bcb9b8a,0xa3cda3cc,0x9309a38c,0x8a468267,0x8a069aa8,0x9ac89267,0xa2e89287,0x8a878246,0x9ae99bab,0xab298a46,0x9b07b3aa,0xa369b3aa,0x936a9b69,0x836b836a,0xacd09c4e,0xa48fa46e,0x7b099c2d,0xbd1193cc,0xacaeacaf,0x8becacaf,0x72e9836b,0x72c972e9,0x8b6b6ac9,0x8bcb9c2d,0x940d7b4a,0xa42e8bab,0x8b8b7b4a,0x6ac9834b,0x5a476aa8,0x9c2e93ed,0x83ac8bac,0x8bcc93ec,0x93ab8bac,0x72c87b09,0x624651e5,0xa42e7b09,0xa46facaf,0x8bab9c4d,0x8bcb7329,0x836a940c,0x836a834a,0x8b8b8b6a,0x72c7836a,0x6a676266,0x72c972c9,0x8b8b72e9,0x838b93ed,0x8b8b7b29,0x832b8b6b,0x62676aa8,0x93cd834b,0x7b096267,0x8369accf,0x9c0c6265,0xac6eb4b0,0xa3edb4b0,0x72278aea,0xa36a69a4,0xbc0dc46e,
-0x9b49abab,0xa3cb9b49,0xa36aa38b,0xa3aba34a,0x9b8aac2d,0xabcb8b08,0xb42dbc6e,0xabacbc4e,0x938a8b29,0x9b4aa3cb,0x9b08ab8a,0xa327b3aa,0x9b088a85,0xabccb3eb,0x51258ae9,0x59665966,0x82ec6a09,0x6a68830b,0x72aa5a06,0x93ae938e,0x9bcea410,0x8bce8b8d,0x72eb8bce,0x7b6c7b2c,0x7b0b93ee,0x832c6aaa,0x9befa410,0x51a76a49,0x59a659c7,0x59e65185,0x52056a67,0xac2e6268,0x728a9bad,0xac319baf,0x61e87aec,0x59a76209,0x69c76187,0x69e448e3,0x7a8682a6,0x93098ac8,0x82c78ae8,0x92e77a45,0xa3ada38c,0x9b8cabee,0x8b4982c8,0x8aa7abeb,0x93098aa7,0x9b6a9b8a,0x92e88b08,0x9b8b9b6a,0x932a9b6b,0x9bab82e9,0x8aa9abad,0x9b4a7226,0x938aa3ec,0x934a9329,0x9b499b49,0x8b4a936a,0xa3eda3ab,0x7287a3cc,0xa3ab6a26,0xa3ecb46e,0x9329934a,0x8b299329,
-0x9bac936a,0xa3eca40d,0x724692e9,0x9bab82c8,0xa42da42c,0x82a88b6a,0x8ae88ac8,0xa34a8ae9,0x9ae98a88,0x92679ae9,0x92889267,0x8a678a67,0x7a068a27,0xa34ac48f,0xab29a2e8,0xa34aa349,0xabcca34a,0xc4cfd510,0x8b2ab44e,0xb4f0836b,0x93edbd11,0x62677b4a,0xacae7b6a,0xb4cfbd10,0xa44ea44e,0x72e8a44e,0x6ac872e9,0x836b6268,0x9c6e9c4e,0x83ab9c6e,0x730a62a8,0x832a836b,0x834b6a87,0x49c48bac,0xb5118bcd,0x942d9c6e,0xacafa46e,0x93acaccf,0x8b4b6247,0x49a56246,0x728759e5,0x9c2d8b8b,0xacafa46e,0x7308940c,0xb4cf9c2d,0x7ac893aa,0x834972e8,0xa42da44d,0x8b8bac4e,0x628872ea,0x5a476268,0x62675a47,0x62876267,0x62266a88,0x7aea59e5,0x6a898b8c,0xa44e72e9,0x6ac79c2c,0x93cc6ae6,0x62478b6b,0x6a675a46,0x7a8859e5,0x8aa78ac8,0x92a78a86,
-0xa3eb92e8,0xbcafc50f,0x8225a3ab,0x9b698225,0xbcceac4c,0x9b6abc6d,0x8b098ae7,0x9b6b8b09,0xb4efb46e,0x9b8aac6d,0x82667225,0xd48db42b,0xa369cc6c,0x92c88aa6,0x6a067a26,0x596571e7,0x62085185,0x6a486a48,0x830b7a8a,0x832c72ca,0x6a6993ae,0x6aaa5a08,0x6a8a72cb,0x51e649c6,0x9c10834d,0x51c77acc,0x6a696229,0x5a086249,0x8b0b49a5,0x6a2761c6,0x728882ea,0x7ac97288,0x59a66a68,0x6a286207,0x492451a6,0x51054904,0x7a077186,0x7a465922,0x9308b3eb,0x72066143,0xac2c9bab,0x8ae8abca,0x7a487a67,0x934b7a88,0xb46dac2d,0x82869baa,0x72647205,0xb44c9389,0x9b6bac0d,0x69a48268,0x936b8ac8,0xa40eac4e,0x82278ae9,0x7a878246,0xbcaf938a,0x9329ac0c,0x7a457a66,0xa3cc9309,0x9b8cac0d,0x8b098b0a,0x7ac782c8,0xac2e8b6a,0x9b0ab40e,0x8aa77206,
-0xa40da38b,0x8b4b8bac,0x9b299349,0x8b089307,0x93ec93ab,0x932aa3cd,0x9ae97a67,0x7a47ab8b,0xbbcd9b0a,0x822792a9,0x8a679288,0x8a678247,0x7a468a67,0x9aa79b09,0xab4abb6a,0xc44da36a,0xab6bb3cc,0xb38c9ae9,0xbbcdd44f,0x7b0a8288,0xb4f0b4af,0x6ac8a44f,0xb4cf836a,0xac8facaf,0x836ba46e,0x72c88b6b,0x6aa86aa8,0x836b5a26,0x940da48f,0x8bcc7b8b,0x62876288,0x7ae972c9,0x7ae97b0a,0x5a676267,0x8bcb93ed,0x9c8e9c6e,0x9c6d9c6d,0x832a93cc,0x8b6b7b09,0x620559e5,0x51e56a67,0x6aa85a05,0xa44d838b,0x836aac8e,0xac8e8bcb,0x83499c2d,0x9c2c8349,0x8b8bacae,0x6aa872c9,0x72ea72c9,0x7b2b7b0a,0x6a8872c9,0x62676a87,0x72e972a8,0x7aca8b4b,0x832b5a46,0x8babac8f,0x83695a25,0xacaeac8e,0x836a9c2c,0x72687287,0x8b2a61c5,0xababbc0e,0x8a668266,
-0xbc8db3eb,0x9b49ac0c,0xa3cba38a,0xa3cbac0b,0xb40ba38a,0xbc4db46d,0x7a059329,0xc44eab6a,0xb40dbc4e,0x9b49a36b,0xab8ab3eb,0xabaa9b49,0xcc6ebc2d,0x81e5bbcc,0xa3297a05,0x61e57246,0x59855985,0x61a75986,0x7acb7269,0x620759e7,0x8b6e8b6c,0x5a086aab,0x9bef6aaa,0x832ca431,0x62095a08,0x7acb830c,0x6a297249,0x7b2c6249,0x61c751c7,0x598661a7,0x6a0869c7,0x51a559a6,0x622759c6,0x49643923,0x7a8772a8,0x50a15963,0x826658e1,0x7a468ae7,0x82a78267,0x8ae78ac7,0x932a8ac8,0xabcda3ac,0x6a258b09,0xabec9309,0x9b4ba38b,0x9b6a9309,0xa36aa3ca,0x930992e7,0xa3aaa3ab,0x82a782e8,0xabac9309,0x82a88ae9,0xa3cc9b6b,0x934a9bab,0x92e89309,0xa38aa38a,0x8b09934a,0x9b6a932a,0x8ae98ac8,0xac0d9b8b,0x9b4aac0d,0x92e98ae9,0x9b8b9329,0x932a9b6b,
-0x936a9b6b,0x83498329,0xac4d9bcc,0x938ba42d,0x83298b08,0x9b6a9369,0x9aeaa34b,0x92e98247,0x9aea8268,0x820781e6,0x82888a88,0x828782a8,0x8aa882a8,0xb34b79e5,0x9288ab2a,0x9b0992c8,0xa3299b4a,0x89c59a88,0xaa8899e6,0x72879ac8,0xb4cf832a,0x93eca46e,0x9beb7ae8,0xbcefbcf0,0x7ae993ab,0x8b8d9bee,0x628862a9,0x72c872e9,0x93cd7aea,0x624793cd,0x6a685206,0x832b7ac9,0x5a677b2a,0x8bcb6287,0x944d8c0c,0x7b698beb,0x8beb83aa,0x836a83aa,0x8b6b8bab,0x8b8b93ac,0x51e56a67,0x6aa76aa7,0x628651e5,0x93ec834a,0x9c0dac8f,0x8bab8b6a,0x836a93cc,0xac8f8b8b,0x73298b8b,0x8bac7b4a,0x7ae98b6c,0x8b4a7ae9,0x72c8834a,0x6a8772a7,0x7ae96a67,0x9c0d93ed,0x62676a87,0xa40d93cc,0x9bcc938c,0x838a9c0c,0x622672c8,0x7aa76a05,0x93299309,0xab89abca,
-0x9b688ae6,0x9b099b49,0xccafabab,0xab8abc4d,0x9ac8a309,0x93499329,0xa40c9bcb,0x9b299b8a,0x92c89ae9,0xb42d9b4a,0xbc2dccef,0xa309b3ac,0xab6aa309,0xab29ab29,0x7a25b38a,0x7a2561a3,0x7a2769c4,0x7a6992ea,0x59a65165,0x51856a27,0x726959c6,0x62687aca,0x51a74986,0x72cb51e7,0x59e76a6a,0x49245166,0x61e75986,0x51644945,0x492259a5,0x9ae969e5,0x82279288,0x92a99ac9,0x934a7246,0x514382a8,0xa3098247,0x50c07a05,0x92c771a3,0x92a78ac7,0x9b4a92a8,0xabcbabea,0x82879309,0x82c88287,0x9b6a9349,0x82868ae8,0x8a8892c8,0xa3eb8ac8,0x9b2ab40c,0x82878aa8,0x82e78286,0xa40b93a9,0x82e88308,0x82a88ac8,0x936b82e8,0x92e9a3ac,0x92c88aa8,0x830892e9,0x9bcc93ab,0x93099b6a,0x82a78ae7,0xa3cc82c8,0x8b29938b,0x82c77ac8,0xa3ed9b8a,0x9bcca3cd,
-0x8b08938b,0x8ae88ae8,0xa38b9349,0x934a9b4a,0x82c782e8,0xa36b9b6a,0x9aa992ca,0x79e592a9,0x822671a4,0x8aa8a309,0x930a82c9,0x934b8b0a,0x934b8b2a,0xc42eb3cc,0xbbaca36a,0xbc0dcc4e,0xcc6dc48e,0xd3ecdc4d,0x9a87aac8,0x9ae9ab29,0x832a6a26,0xacaeacaf,0x7b0893cb,0xac8e8bcb,0x8b8ca46e,0x93ce830b,0x62886aea,0x7ac97ae9,0x5a076247,0x72a96268,0x7aea7aea,0x6a88830a,0x7b4a6267,0x9c4f9c4e,0x7b4a838c,0xa46ea48f,0x8bcc8bcb,0x8bab940d,0x73087b29,0x9c2d834a,0x7b09a42d,0x62465a05,0x6a6772a7,0x6a875a05,0x9c2d7b0a,0x93cc93ed,0x8bac93ed,0x93ec93ed,0x83ab7b4a,0x732983ab,0x72e86ac8,0x6aa77ae8,0x83296aa7,0x8b6b8329,0x940cac6e,0x62876287,0xa44e7b29,0xa3ce9bed,0x6a88938d,0x5a265a06,0x82e85a26,0x8ae782a8,0xc44cabaa,0xb40bbc2b,
-0xa38abc4c,0x9b298ac7,0xb3cb9b09,0x9b29ab8b,0x9b089ae8,0xb44da38a,0xb46db4ae,0xababac0d,0x9b29a329,0x9b4aa38a,0xab8babed,0x92c8ab6a,0xab699ac8,0xc44cb3cb,0xab89c44c,0x8246a348,0x71e56983,0x8a6792a8,0xa38c7a07,0x61e68aea,0x72287a28,0x620861e7,0x498659c7,0x51a651c6,0x61c65165,0x69e661a6,0x6a066a06,0x7a267226,0xa3aa9329,0x82258286,0x81e48a25,0x92879205,0x8aa7a329,0x61838266,0x7a056143,0x82878267,0x828792e8,0x82668246,0x82a78266,0x9b299b29,0x82878287,0x93298aa8,0xabcca38a,0xa3abbc4d,0x8ae882c8,0x8ac89b09,0x9b299329,0x82a792e9,0xabcb8b08,0xa3eba3cb,0x8b29a3eb,0x9b8a82e8,0x82c89309,0xa32aa36a,0x8b09ab8b,0x9bab82e8,0xa3cba3ec,0x8b099b6a,0xa38aa38a,0x72679b4a,0x9bcc82c8,0x936aac0d,0x936a82e8,0x938b9bcb,
-0xa3ab8b6a,0xa3aaa3ab,0x7a469309,0xb3cc92e8,0x9b4aabec,0x82888ac9,0x92c992c9,0x8a468a47,0x8a67a2c8,0x828792e9,0x932b8288,0x832a8b2b,0x832a7b2b,0xb42dabec,0xa349abeb,0xab69ab29,0x9b699b28,0xab6b9b08,0xc4adb42c,0x8a87abcb,0x72268266,0xac6d8b4a,0x7b49ac8e,0xa48e838a,0x8bcba48d,0x7b4a8369,0x6ac8836b,0x726851a4,0x6ac972c9,0x62a87b4b,0x73096ac8,0x7b0a6267,0x8bcd9bed,0x7b2b732b,0x6aea7b4c,0x834c8b6d,0x834c8b6d,0x7b2a72ea,0x7b297b09,0x8b8b6267,0x938ba42d,0x62266247,0x8b8b938b,0x6a886267,0x51e56226,0xa44e7b4a,0x83ab9c2d,0x9c4e8bac,0x7329838b,0x9c4ea48f,0x7b097309,0xac8f940d,0x7b4a7b6a,0x7b29838b,0x62c86a88,0x940d838b,0x832b8b6c,0x936ca3ce,0x8b6c8b6c,0x51847288,0xb44e7aa9,0xa38bbc4d,0xa3099ae9,0xa36aa36a,
-0xa36b9b29,0xbc6ec46f,0x8245a3aa,0xabeb8a86,0xa42db48e,0xa34b9b8c,0xab2ba30b,0xa38ab38b,0xb46da3cb,0xa349bc4d,0x9b6a8aa7,0xbc8eb44d,0x9b8aac0c,0xab8a9b49,0xabccabab,0x8ac9a36b,0xa32a9309,0x81e49287,0xb44d9ae7,0x71e5934a,0xab6ca30b,0x7a687a48,0x72468b0b,0x9329936a,0x822771c5,0x8ac87a26,0x9368a3aa,0x8b0772a5,0xb3aca36a,0xa309bbcc,0xab4892a6,0x9246bb8a,0x9aa981e6,0x9b49ab8b,0x8aa77225,0xa34aa36a,0x9b4aa36a,0x9b6a8ae8,0x8aa8ab8b,0x82676943,0xa3ecb40d,0x8288930a,0x930a8ac9,0x82e982c8,0xac4da3cc,0x8226abec,0x932871c4,0xac2da40b,0x82479b4a,0x82478a47,0x8b2a8287,0xa3cca40d,0x72059309,0x93296a05,0xac6eac0c,0x8ac8938b,0x7a467a04,0x9bac8b09,0x9b8bac0e,0x7a8682a7,0x92e97a46,0xb44fabed,0x82e8a3cc,0x82c861e4,
-0xac0d9b6a,0x8b6aac2d,0x82e77ae7,0x9b4982a7,0x9b2aa38b,0x92c992a9,0x826792e9,0xab0a8a87,0x8a679288,0x8a888a66,0x8b098a88,0x7b0a936c,0x730a7b4b,0x82a761e4,0x9ae892e7,0xd46ebbab,0x9b69b40c,0xab499b29,0xa36ba34a,0xc44dcc6e,0x8a6792a7,0x83098267,0xacb0a42e,0x8bcc8c2d,0xa42e9c2d,0x7b098b6b,0x62676a87,0x72c972c9,0x5a685a07,0x51e6730a,0x62677b0a,0x7b0a72ea,0x7b2b6ac9,0x52277b2b,0x72aa7b0b,0x72ca832c,0x832c7aeb,0x832b830b,0x6aa872c9,0x6a8893cd,0x93ac7ae9,0x6a668b4b,0xa44e6a87,0x62669c0d,0x836b72c9,0x626772e9,0x7b4a62a8,0x8bec83ab,0x9c4da46e,0x8bcc9bec,0x9c0d93ec,0x93ed8bcc,0x9c4e9bec,0x8bac940d,0x93cd8bac,0x942d940d,0x6a478bac,0x59a56a26,0x7ac961e6,0x8ae98b0b,0x9b4a8ae9,0xc44ebc0c,0xa329cc2e,0x8ac87a26,
-0xbc4fb40d,0xa3abb42d,0x8b079b89,0x93899348,0xa42d93ab,0xb42eac4e,0x822692c9,0xb46dabab,0xac0bb46d,0x9b899ba9,0x93289b48,0xb46d9349,0xbc6fc4cf,0x7a26a36c,0xabac8267,0xccafb40d,0x9b08bc2d,0x9a8592a6,0xa3698a86,0xbc4db42d,0x82669b6a,0x71e571a4,0xac2d8b09,0xabccc48f,0x616269c4,0x8aa671c4,0xc46db3ca,0x8287abca,0x82257a25,0xa3088a26,0xc44cbc0c,0x8266ab6a,0x822571c4,0xb42d9b49,0x936aac0c,0x71e57aa7,0x8b098266,0xac0ca3eb,0x7a879329,0x7a877a68,0x9bcc8ae9,0x9bcb9bac,0x59847287,0xac0d9329,0x9b4aa3ac,0x93089309,0x92e892c7,0xa32992e8,0xab4bab8b,0x72068288,0xabaca38c,0x8b288b2a,0x93aa8b49,0x8b089bca,0x8b6a8308,0x936aac4d,0x8ae88ac8,0xa3ab9b6a,0x9b6b8b29,0xa3eca3ec,0x9b2aa38b,0x932a92e9,0x934a9bac,0x8ae98b2a,
-0x93299b6b,0x934a8ae8,0xabcba3cb,0x82879329,0x92c98aa8,0x8aa98267,0x9ac99ae9,0x9ac89b2a,0x8a679ac9,0x8a678226,0x82888a88,0x938c830a,0x7b6b7b4b,0xb3ec5101,0xbc0cccae,0x9b4aa38b,0xbbecb3cb,0xa349abab,0x9a87a309,0xc44da32a,0x8a67b3cc,0x82889b0a,0x8bcd6a68,0x9c4facf1,0x9c2d834a,0x7b49a46e,0x836a8b6b,0x5a486288,0x8bad7b2b,0x6268730a,0x5a275a27,0x498551c5,0x5a075a06,0x49a549a5,0x498451e6,0x51e64985,0x62475a06,0x6aa96247,0x6268834b,0x6a687b0a,0x834b830a,0x6a477b0a,0x836b5a26,0xa46e9bed,0x8b8b9c2e,0x8bab7b4a,0x51e47b4a,0x520549a4,0x8b8c62a8,0xb46fac4d,0x72c79c0c,0x8b6b6245,0x9bec93cc,0x836bb4f1,0x62275a26,0x5a256226,0x72a76246,0x61a46206,0xa38b82a8,0xc4aebc6e,0xab6abc0c,0xab298267,0xa309ab49,0xab8bb38b,
-0xa34b9309,0xa38a92e8,0xccaeb3cb,0xabcabc6c,0x9b299b69,0xab8babab,0x9b4aab8b,0xb3ebabac,0x9b49a389,0xb42ba3aa,0xbc4cbc6c,0x8ae8a3aa,0xac0d9b4a,0x930aabad,0xb3cc9b0a,0x9308b3eb,0xbbca9b08,0xc44cc42c,0xab69bbcb,0xaba98aa6,0xa348c48c,0x9b298245,0xb42db42d,0xa36b9b2a,0xabcba3ab,0xab29bbca,0x92e98a86,0xbb8bb3ac,0x79c49287,0xc3ecb38a,0x9b09ab6a,0xabeb9b6a,0xabebac0b,0x82a89309,0xa3eb9b8a,0x8a869b49,0xabcb8aa7,0x7a8782c8,0x9b8b8ae9,0x9b8aa3ab,0x828892e9,0x938a8b08,0x82c88b49,0x9b2a9b29,0x92679288,0xb3eba2e8,0xab4abc2c,0x9a68a287,0x92a89267,0xabac9b4a,0x82678aa8,0x82e882a8,0xa42c8b6a,0x7aa79c0b,0x82e88ae8,0x83097286,0x938ba42d,0x82c87267,0x72878ac7,0x9c0d830a,0x7aa79b6b,0x8ae98287,0x932a8b09,0x9b4aac2e,
-0x9b2992e9,0x7a468aa7,0x82a88a87,0xab6a8ac8,0x92e9b3cc,0x7a067a46,0x8a678a47,0x9ae98a48,0x9aa892a8,0x8a478a26,0x8aa88a67,0x7b0a8b2a,0x834a836b,0x930b6144,0xac0dabee,0xbc4eb44e,0x9b08a36a,0xb3ebb40d,0xa2e8ab29,0xab8a92c7,0xa309cc8e,0xbc6d9ae8,0x52058b69,0x9c4e730a,0x944da48f,0x94ad946c,0x7baa944d,0x7ae97b4a,0x72a972c9,0x7ac972a9,0x82ea7aa9,0x82ea832a,0x6a8872a8,0x51e56247,0x836a6ac8,0x9c0ca44d,0x62667b29,0x5a275a26,0x6a886206,0x72a9938c,0x7ae9832a,0x62677ae9,0x8b6b5a05,0x838b9c2d,0xac8f9c0d,0x8bcc9c4d,0x7b098b8b,0x838a6287,0x59c55205,0x7aa87267,0x72a86205,0x72a79bab,0x7a677246,0x7ae972c8,0x6a6772c8,0x8b497aa7,0x9b8a9349,0x8aa89b49,0x8ac79ae8,0xabeaa369,0x9ae792e7,0xa308a308,0xa3499ac8,0xb3abbc0c,
-0xa2a792a7,0x9205a2c8,0xb36b9246,0x81c5ab09,0xa26791e5,0x92269a05,0xa36aa328,0x924792a7,0xa287aa87,0xa3299267,0xababcc6d,0xa329a349,0x9b499b29,0xbcaea40c,0x9348b46d,0x9aa6a328,0x9b08a308,0xc44eb3cb,0x9b28abab,0x9ac792c7,0xab8a9ac8,0x9babb42c,0x93098ae9,0x8ae98ae9,0xc46f9b4b,0xab2abc0e,0x92a892a8,0x92e892c8,0xb3ecab6a,0x92a79309,0x92a79aa7,0xa3cb8ae8,0x936abcae,0x92a78ae8,0x8a679267,0x9b8a9309,0x82869308,0x8aa78a86,0x93088245,0x92e8abab,0x8a268205,0x81a589e5,0x92c88a67,0x79848205,0x79a48a05,0x8a267163,0x81c59288,0x81e679a5,0x92679226,0x92a792a7,0x9b0992c8,0x82268226,0x9ae992a8,0x8ae99309,0x8ae98b09,0xa3aba38b,0xa3cc9bab,0x9329a3ab,0xabcc9b6a,0x8ae98ae9,0x9bab8b09,0x93099bcc,0x9b8c934a,0xa38c8b2a,
-0x7205932a,0x9aa88247,0x9a889a88,0x82479ac9,0x9b099b09,0x8a4792a8,0x8a688a47,0x8a268a48,0x92888226,0x8a4679c5,0x7a268a87,0x9b6c8ac9,0x832a830a,0xa38c61a5,0x9bacac0d,0xbc8fb44e,0xbc4d934a,0x9329bc4c,0xab4992c7,0x9b8a9308,0xbb69cc8d,0xb3aab309,0x8b4a8b08,0x626772c8,0x9c6e7b4a,0x8beb9c6d,0xa46d9c2d,0x7309834a,0xac8e9c2e,0x6226834a,0x8b6a7b09,0x72e88329,0x59e56aa8,0x834a51c4,0xa46e9c4e,0x836a7b49,0x7329940c,0x51c55a26,0x832b51c5,0x7b2a5a06,0x72a88b8c,0x72c972a8,0x83296a87,0x6aa8836b,0x9c2d836b,0x9c4d9c6d,0x7247836a,0x9b8c8aea,0x71c57226,0x8a279268,0xc3ed9288,0x9a88cc2d,0x8a0681c5,0x9ae98a67,0x8a479ac8,0x9b098a87,0x9b08a349,0x92a77a25,0x8aa692c7,0x7a258245,0xa3078a85,0x9ac7a2e7,0x9ac8a2c8,0x9b099ae9,
-0xa30792e7,0xa2a8ab28,0xa2e99aa8,0xcc0dc3ec,0xab09bb6b,0x8a66aae8,0x9ae88ac7,0x9aa89b09,0xa2e89287,0x8ae9a329,0x8a678aa8,0x9226a2c9,0xa30881e5,0xb3eabbea,0xa3c9ac0a,0xabeb9369,0xb3abbc4d,0x92c892c8,0xb44cabcb,0xa32a9b8a,0xbbedbb8b,0xbc2ebc2e,0x932aab6b,0xac0ca3aa,0x9ac9a36a,0xa38b92c9,0x9308abcc,0xb3eb8ae7,0xbc4dbc2c,0x9349b3cc,0x9b898ae7,0x9b49abca,0xa36a9b09,0x8b28a38a,0x93098ae8,0xb38ba36a,0xa2e9bb8a,0x71e479a4,0x79e57a25,0x8a668204,0x8a668a86,0x92468206,0x92479247,0x82468a46,0xa38a8aa6,0xab4bbc0c,0x8a679289,0x8a678a67,0x82268a46,0x82469267,0x9b288ac7,0x82a88286,0x7a478287,0x82488a47,0x9a889288,0x7a2579c5,0x71c48266,0x8aa871c5,0x92c892e9,0x69848a47,0x7aa669c4,0x8b098b09,0x7a057a67,0x92c992c8,
-0x9aa992a9,0x92889ac9,0x9a888a06,0x8a27b32b,0x8a67a2e9,0x8ac88287,0x7a468a88,0x822771c6,0x8a468227,0x92a88a66,0x8a879ac8,0x722771e6,0x7a887a88,0xabed8ae9,0x934ab40c,0xb46ea3ec,0xbc4d936a,0x9348abeb,0xabcbc46d,0xac4d9349,0xab09c46d,0x9aa6b308,0xcc6ec3cb,0x82c9b3ac,0x51a56207,0x836b6a88,0x8b8b9bcb,0x838a72e9,0x83ab93ec,0x838a838a,0x7b097b49,0x72c87309,0x41a35a46,0xa46f6ae9,0x6b09940d,0x83ab6ae8,0x8349836a,0x6a887b49,0x51e54143,0x93ac832a,0x7b097ae8,0x6aa8834a,0x8b8b6246,0x7b29a44d,0x62866aa7,0x8bcb7b29,0x9b6d93ac,0x69e67a68,0x61237206,0x81a57964,0x9a6789e6,0x9226a267,0x81848184,0x92469226,0x91e69206,0x82668a05,0x9a869287,0xa2a8aaa8,0xa2e89a87,0xbbaaab49,0x9ae8b38a,0xbbcb9ae8,0x9288b36a,0x8ac88a88,
-0x8ac792e8,0x8aa78aa8,0xab6b8226,0xab8bab6b,0x7246a36a,0xa38b8ae8,0x92889b2a,0x9b2a92c8,0x8a679b09,0xc46f92e9,0xb38cccb0,0xbb2aa2e9,0xa266bb09,0x8a249225,0x9b288a65,0xc4aec4ae,0x9b6ab44d,0x8a868a87,0xb44e9b49,0xb46ecd10,0x92c8a38b,0x92ea8aa8,0xb42e9b4a,0xb44dc510,0x79e5a34a,0x9b6a7a46,0xb48db46d,0x8ae7a3ea,0x8a878aa7,0xa3cb92c8,0xbcceb4ce,0x7a87a3cb,0xa2e871e4,0xc48ebbec,0x8b28b42c,0x81a47a25,0x79847985,0x92479206,0xb34a9aa8,0xab4ac3ac,0x7a257a05,0x8a468aa7,0x8a2781e6,0x82869287,0x82a77245,0x9ae982c8,0x71c58a47,0x82668226,0x8a678247,0x7a058a67,0xa3ab8267,0x7a6782a7,0xbbcd9b4a,0x79a6b36c,0x922779a5,0x9a679226,0xaae8a2a8,0x9267a2c9,0x92a89aa9,0xa2c99ac9,0x9b0a9ae9,0x9b2b92e9,0xab4bb3ad,0x9ae97a26,
-0x82688266,0xa32a9b0a,0xa30a9ae9,0x8a469ac9,0x8227a2a9,0x92e97a47,0x9b4a9b4a,0x8288934a,0x828882a9,0x71e57225,0xb36b9ac9,0x9289a2c9,0x8aa992a9,0x8a878a88,0xbc0c9b0a,0xb44cc48d,0xabcb9b69,0xbc4eccf0,0xabcba36a,0xc4afc48e,0xb38babab,0xc3abcc4d,0xa289a2a8,0x9249a248,0xab8ea32c,0x59c67a89,0x62074985,0x7b096a68,0x93ed93cc,0x7b4b734a,0x9c2da46f,0x730972e9,0x41a46267,0x940d6ae9,0x6aa8838c,0x7329838b,0x836a6ae8,0x5a057b49,0x8b4b5a26,0x7b099bec,0x8b6b7ae9,0x8b8b9c2d,0x8b8b6267,0xb4afa44e,0x62668b8b,0x5a255205,0x5a065a26,0x72876a88,0x59636a27,0xc3ac9ac9,0x9aa7b34b,0x8a469266,0x9aa79aa7,0x92869266,0x92469a87,0xbb8caae9,0x92479247,0x81c6a288,0x9ac981c6,0xab2ab36b,0xa30992c8,0xb34a92a8,0x9aa89aa8,0xa36ba32a,
-0xa38cab8c,0x93098ae9,0xaac8ab6a,0x92a89a88,0x932b9309,0xabad930b,0xb3adab8c,0x9b2aabad,0xa32a9ae9,0x9aa9a32a,0xa36b92a9,0x8a677225,0x9a679a88,0xbae9b2c9,0xaaa8aaa8,0x9ac89a67,0xa3cba349,0xb46cac4c,0xa3abac0b,0xb48d9b8a,0x9b69b4ae,0x9b4992a7,0xac4dac2c,0x934a9bec,0xabeb9b8b,0x9308a38a,0x9bcb8b29,0xa3abac2d,0x8aa67a86,0xb42dabaa,0x93aba40d,0x9bcb936a,0x9b499baa,0xab2a92c8,0x9aa8a309,0x9a889267,0x8a279247,0x716481e6,0x9aa881e6,0x82279268,0x7a268a68,0x932a8aa8,0xa34aa34b,0x8a67a32a,0x9ac98a88,0x8a0679c5,0xa3099a88,0x8a678a47,0xa32a9b09,0x92a8a32b,0x82478a47,0x92a88a88,0x8a068a47,0xa2a99a88,0x89e581c5,0x8a059246,0x9a67aae9,0x9aa879c5,0x7a059267,0x72268aa8,0x92888267,0xab4a9287,0x9b29bbec,0x92887a46,
-0x9b0a92e9,0x93099b2a,0x93098ae9,0x8aa8a36b,0x92a88247,0x92c98287,0x934a932a,0x834b8b4b,0x8b6a7b2a,0x82c88b29,0x8a478246,0x79a59268,0x79e68206,0xabcbbc6e,0x9b08a329,0xb36aa329,0x9267ab09,0xb3ab9ac8,0xc3edbbed,0x9ac8bb8c,0xab8a8aa7,0xab6abbcb,0xa2c8aae9,0x82069245,0xc46fa34a,0x7206b3ad,0x618569a5,0x51435143,0x59e65164,0x59e66227,0x8b4b7288,0x8b4b9bac,0x49845a27,0xa470834a,0x62a86ae9,0x6ae89c0d,0x838a7328,0x73087308,0x93cc93ab,0x834a6aa7,0x834a8b8b,0x72a8834a,0xac8f72c8,0x9c2dac6f,0x9bed9bed,0x7b09836a,0x6aa862a7,0x6a67938c,0x61a47a87,0xa30a92e9,0x8a468a46,0x8a67a2e8,0xa3288245,0x9ac78a66,0x8205a329,0xb34a8226,0x9a888a27,0xaac99248,0x9aa9aaea,0x92c88aa8,0xb38cab6b,0xa2c99aa8,0xa30aab0a,0xab6ca30a,
-0x92caa34c,0xa2e99b0a,0x9aa89ac8,0xab0ac36b,0xa32ba2ea,0xab8d7a49,0xab8dabad,0x92c99b2a,0xa2c9ab0b,0xaaea9a89,0xa3298a67,0x9b0992a8,0xa34bab6b,0x92689ac9,0xa2c99247,0xa2e7c3cb,0xa3488a86,0xc4afbc6e,0x93699bca,0x9b899348,0xa3aa9b89,0x8b89a3ca,0x8b698349,0x9b499349,0xac8ea3eb,0xa34bb40d,0x8ae992e9,0x8b088b08,0x9b6aa3ab,0x930982c8,0x8ae99b4a,0xb42d8b29,0xa309c46e,0x8a469286,0x9aa89aa8,0x82268267,0x7a887206,0x7a6882c8,0x82478267,0x82688268,0x92698a48,0x8aa971e6,0x8b4a932a,0x8a888ae9,0x92888a68,0xa32a9aa8,0x82068287,0x92889ae9,0x9aea8247,0x8ac89b2a,0x82888aea,0xa30a9b2b,0x9aeaa32b,0x92888226,0x92c8a32a,0x79e58246,0x9aa89ac8,0x9b098a87,0xa34a9ae9,0x9b6b8ac8,0x9ae99b2a,0x82469ae9,0xa3ac8aa8,0x8aa88ae9,
-0x82668287,0x92e98aa8,0x92ea930a,0x9b2b8ae9,0x92c87a46,0x8ac98266,0x932b9b4b,0x7b4b8b6b,0x730a7b8b,0x932b8b4b,0x8a478287,0x81e59288,0x92889267,0xa38aac4d,0xabaaa349,0xcc4dbc2c,0xab29ab4a,0xab29b36a,0xa2a8a2e9,0xb308aac8,0xabcbb34a,0x8ac7a3ca,0xb38a92c7,0x8ac6ab8a,0xc44d9348,0x79c6a34a,0x8a498a48,0x82888289,0x71a57a47,0x71c56984,0x61646964,0x59846184,0x49225163,0x9bed6a47,0x838ba42e,0x940d836a,0x8bcb9c2c,0x8b8b8baa,0x7b097b09,0xac6e93ec,0x93ac8bac,0x62677b09,0xa40e8b8c,0xb48fa42e,0xa40ea42e,0x72e99c0d,0x7b296246,0x72877b09,0x69a47a66,0x820579e5,0xaae99a88,0xa3299aa7,0x92c892c8,0xa309ab6a,0x92a8a309,0xab4a92a8,0x9ac98246,0x9aa9ab0a,0x9aea9aa9,0xabaca36b,0xa34aa36a,0x9288ab4b,0x92a8b36b,0xa30a92a9,
-0xa30a92a8,0xa309a32b,0xbbabab2a,0x9aa8ab6a,0xab2b9aa9,0xab6c9b0a,0x92ca9b2b,0xa30a92c9,0xa2c99ae9,0xb38bb34b,0x92a8b3ac,0x8a88ab4a,0xb38d92ca,0xa30ab36c,0xb36b9ae9,0x9ac79ac8,0xa2c8ab29,0xa3299ac7,0xabeba38a,0xabaa9b89,0xbc2dc42c,0xac2dac4d,0x8b499bcb,0xa38a8b29,0x9bab9349,0x9b0a9b4a,0x8ae89309,0xabcb9b6a,0xabeca3ab,0x9b6bac2e,0x92e98ac8,0x930a9329,0x8a67ab4b,0xa30992a8,0x92a8b34a,0x92a879c5,0x8ae99b4a,0x82a87287,0x8ac98ae9,0x92ea8ac9,0x82478a89,0x8268a2ea,0x8b097a67,0x8a888ac8,0x8a478a68,0x9b4a9b0a,0x92e9932a,0x92888268,0x8a489aa9,0x7a677a27,0x7a6792e9,0x9b4b8ac9,0x9b2a9b4b,0x82a99b2a,0x8aa87206,0x8aa7a329,0x826792c8,0xab6a8267,0x92e9a32a,0x8ae99b4b,0x9b2a8ae9,0x82889b0a,0x9b2a8ac9,0x7a2661a4,
-0x92c88a67,0x82278a67,0x8aa98a88,0x92e992e9,0xa3298a87,0x82468267,0x932b930a,0x8bac834b,0x8b8c7b6b,0x934b832b,0x82688ac9,0x82069288,0x82468a67,0xa38ba3ab,0xc48eb40d,0xc550c52f,0xbcceb4ee,0x92c8abaa,0xbbaaab6a,0xa2c7ab09,0xc4efb3cb,0xb46eb4ef,0x8ac7b42d,0x9307a329,0xc42d92e7,0x69a5ab4b,0x92ca71c7,0x8ac97a69,0x89c49288,0x99e591c4,0x89a491a4,0x81e59226,0x826779e5,0x51637206,0xac6f8b4a,0x62a7836b,0x8bec7b6a,0x8b8a838a,0xa44d9c0d,0x93ec7b2a,0x836b9c4e,0x5a466267,0x834b72c9,0x8b8c836b,0x7aea8b8c,0x62476247,0x72a872c8,0x82466a26,0x79c56984,0x9a678226,0xaac9aa88,0x9aa7ab09,0xab8b9b08,0xb34b9ac8,0x8246b36b,0xbbec8a68,0xa30aab8b,0x9b0992a8,0xa34a9309,0xa3aba3ac,0xababa3ab,0x8a87ab6a,0x9287bbab,0xab4a8a47,
-0x9ac7a329,0xbbaba309,0xa36bb38c,0xa38b9b8a,0x92e89308,0x8226ab8a,0xab6b9ac9,0x9ae9ab4a,0xab8ba32a,0xa3aba38b,0x8ae9a38b,0xa2c9a34a,0xb34aaaea,0x92a89aa8,0x8a87ab6b,0xab6b9ae9,0x9ac99ae9,0xab08b32a,0xbc6e9b09,0xac0dccf1,0x9b0a9b4a,0x93099b2a,0xabec9b29,0xb42db48e,0x71c592e9,0xabec8287,0xb40cbc8e,0x8aa88ae8,0x8ae88aa8,0x938b82c7,0xb3edb44f,0x826792c9,0x8ac88ac8,0x92c892e8,0xa2a98a26,0x8246a2e9,0x92889ac9,0x8a888206,0x8a887a27,0x92e99b0a,0x8ac992e9,0x92c969e5,0x8a279a88,0x8a678a26,0x82878247,0x930aab6a,0x9b4b930a,0x82689b0a,0x9b098287,0x8a468a88,0x8aa792a8,0x9b2a92e8,0x932a9b4a,0x9b4b8b0a,0x82a79b6b,0xa34a7a26,0x8ae8b3cc,0x92ea7a27,0x9b0a930a,0xa32b92ca,0x92c99aca,0x8aa89b0b,0xab2b8a68,0x9ac88247,
-0x82269288,0x92898227,0x8a479aa9,0x92888a06,0x8a479247,0x8ac87a27,0x934a932a,0x7aca934c,0x834b8b8d,0x830b7b2b,0x82888aea,0x92888246,0x8a878226,0xb42dbc4e,0x9b8aabcb,0xa40ba3cb,0x83079baa,0xab49a36a,0xc42eb36b,0xcccfd4f0,0xa348a3ab,0xa369c42b,0x8b489b49,0x93499bca,0xbbab8a87,0x7a06b3ac,0x82498a89,0x92eb92eb,0x91e58207,0x8142aa87,0xb2868984,0x99e489a3,0x81e489e3,0x8aa89ac8,0x62265183,0x9bed832a,0x8b2a9bed,0xac2f8b6b,0x9c0eac50,0x8bcca42e,0x5a866ac8,0x6b087329,0x6aa75225,0x8b4a834a,0x62256a46,0x8b4a72a8,0x7a688b0a,0x61237226,0xa2886923,0x79a489e5,0xbb6aaae8,0x9ac89ac8,0x92c9ab6b,0xab2aa32a,0x9a689267,0xbbacc38c,0xa32a9287,0x9b2aab8b,0xa3cba38b,0x936a936a,0xabababcc,0x8a67a2ea,0xbbedb3ab,0xa2e9a36a,
-0xa309a309,0xbbeda32a,0xa34bab6b,0xa3aba38b,0x8ae8934a,0x9b09abcb,0x9ae9ab2a,0xa32992a8,0xabccabac,0xa38ca3ac,0x9309a36b,0xab098267,0x8a469288,0xab2aab09,0xab8b92c8,0xb40dabcc,0x92e8a3cb,0xbbcca329,0x9309b38b,0xbc6eb42d,0x9ae9b42e,0xab6b8a87,0xac2db42d,0x9bcb9bac,0x9b6a9bab,0x8ae88b28,0xabec9b4a,0xa36bb3ed,0x82c87a67,0xac0cb3ec,0x8b099b8a,0xab8c932a,0x7a6782a8,0xab6c9b4b,0x8a67a32a,0x9b099288,0x71e57a05,0x7a268a88,0x92c97a27,0x92ea9b0a,0x8b09930a,0x7a468288,0x92679ac8,0x92c99aa8,0x9b4b92c9,0x8aea8ac9,0x930b9b4c,0x932b92eb,0x71e68289,0xb38c9ac9,0x82478226,0x9309a34a,0x9b4b8ae9,0x7aca934b,0xa38c934b,0x7a668288,0xab6b9b4a,0x7a2692c9,0xa30a8267,0x9ac99ac9,0x8aa89b09,0x9aea9aea,0xa30b8a68,0x8b0a79e7,
-0x932a8b4a,0x8288930a,0x824779e6,0x9a879288,0x82268a46,0x82878267,0x936b8b09,0x8b2b830a,0x834c830b,0x832b834c,0x82a9934b,0x92c97a47,0x8a677206,0xbc4dc46e,0xbc8dc48d,0xb42cb44d,0xab8abc2c,0xb3abab8a,0x9b09b3ac,0xbd119bac,0xa328ccef,0xcc0b8a65,0xa3cabc0a,0x9b299bca,0xab0a9267,0x7a46c42d,0x9aeb79e6,0x92c98a89,0x8a069288,0x91e5a288,0xa205aa46,0x91c3b286,0x89e49204,0x9ae879c4,0x598392a8,0x518440c1,0x8b2b7aa8,0x7a897aca,0x7289934c,0x5a264984,0x83ab83cc,0x6ac67b69,0x9c0c62c6,0xac4d93ab,0x8308a3eb,0x83296246,0x7227a3cc,0x92685923,0x922681c5,0xbb4a81c5,0x9aa8b349,0xa2e9bb8b,0xbbad92a8,0x7a268aa8,0xbb2aab29,0xc36cb34b,0x8ac88227,0xabcb92e9,0x9b49a36a,0x9baba3ec,0xab6b92e9,0x9268bb8d,0xb3ccab8b,0x8a8892e9,
-0xb3aca32a,0x92c9b3cd,0xbc0dab4b,0xa34ab3cc,0x8ae88aa7,0xbc0db40d,0x8a678a87,0xc40ebbcd,0x8b2aab8c,0xabac932a,0xab6ab3ee,0xa34aa34a,0xb329a308,0x9288ab09,0x9b2ab3ac,0x9b8ba38b,0xabcca3ab,0xa32a9b29,0xc42de4f1,0xb3cb7a67,0xb3acabab,0x9b29a36a,0x936a9b8a,0x9b8a936a,0xbc8eb48d,0x9b8ba3ec,0x8a888b09,0xa36b9b2a,0x92e99329,0x8ae8abab,0xac0c7266,0x8288bc6e,0xab8c8aa8,0xa36cabac,0x9288a30a,0x82668247,0x7a269309,0x82489b0a,0xa30b92c9,0x8ac99b0b,0x8aea7a88,0x92e88b0a,0xa30a7a26,0x7a47ab6b,0x9b2a7206,0x932c932b,0x930c8aeb,0x71e7930b,0x388140c3,0xbb8d69c6,0x7a26a32a,0x92a87a26,0x930aa34a,0xa38d8aea,0x930a8b2a,0x8ae9a38c,0x69a58268,0xa30a7a06,0x69849287,0xa3099288,0xab6b9ac9,0x79e6a32b,0xa32c8248,0x832a7a48,
-0x9bcd834b,0x8b0a936c,0x82889b2b,0x71c47a26,0xab6a9ae8,0x7a66ab8b,0x9b2a69e5,0x936b9b8c,0x8b4c936b,0x82c98b6c,0x8ac982ea,0x92ea8288,0x928871e5,0x0,
-};
-
-// ******** End: Tiger565.pvr ********
-
@@ -1,14 +1,17 @@
 #import "GLView.h"
-#include "../Textures/Metal.h"
-#include "../Textures/Face0.h"
-#include "../Textures/Face1.h"
-#include "../Textures/Face2.h"
-#include "../Textures/Face3.h"
-#include "../Textures/Face4.h"
-#include "../Textures/Face5.h"
+#include "../../Common/Classes/Profiler.hpp"
+#import <string>
 
 #define GL_RENDERBUFFER 0x8d41
 
+std::string GetResourcePath(const std::string& file)
+{
+    NSString* basePath = [NSString stringWithUTF8String:file.c_str()];
+    NSString* resourcePath = [[NSBundle mainBundle] resourcePath];
+    NSString* fullPath = [resourcePath stringByAppendingPathComponent:basePath];
+    return [fullPath UTF8String];
+}
+
 @implementation GLView
 
 + (Class) layerClass
@@ -66,6 +69,7 @@
     
     m_renderingEngine->Render(m_theta);
     [m_context presentRenderbuffer:GL_RENDERBUFFER];
+    PROFILE_FRAME();
 }
 
 @end
@@ -2,14 +2,6 @@
 #include "Vector.hpp"
 #include <vector>
 
-extern const unsigned int Metal[];
-extern const unsigned int Face0[];
-extern const unsigned int Face1[];
-extern const unsigned int Face2[];
-extern const unsigned int Face3[];
-extern const unsigned int Face4[];
-extern const unsigned int Face5[];
-
 enum VertexFlags {
     VertexFlagsNormals = 1 << 0,
     VertexFlagsTexCoords = 1 << 1,
@@ -2,6 +2,9 @@
 #include <OpenGLES/ES2/glext.h>
 #include "ParametricSurface.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/AssetPack.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include "../../Common/Classes/PvrUpload.hpp"
 #include <iostream>
 
 #define STRINGIFY(A)  #A
@@ -10,16 +13,12 @@
 #include "../Shaders/Simple.es2.vert"
 #include "../Shaders/Simple.es2.frag"
 
+std::string GetResourcePath(const std::string& file);
+
 using namespace std;
 
 namespace ES2 {
 
-struct PVRTextureHeader {
-    unsigned int HeaderSize;
-    unsigned int Height;
-    unsigned int Width;
-};
-
 struct Framebuffers {
     GLuint Screen;
 };
@@ -79,6 +78,7 @@ private:
     Framebuffers m_framebuffers;
     ProgramHandles m_simple;
     ProgramHandles m_cubemap;
+    AssetPack m_assets;
 };
 
 IRenderingEngine* CreateRenderingEngine()
@@ -103,14 +103,23 @@ void PrettyPrintExtensions()
     cout << endl;
 }
 
-GLuint CreateCubemap(GLvoid** faceData, int size, GLenum format, GLenum type)
+GLuint CreateCubemap(const AssetPack& assets)
 {
+    static const char* FaceNames[] = {
+        "Face0", "Face1", "Face2", "Face3", "Face4", "Face5"
+    };
     GLuint textureObject;
     glGenTextures(1, &textureObject);
     glBindTexture(GL_TEXTURE_CUBE_MAP, textureObject);
     for (int f = 0; f < 6; ++f) {
-        GLenum face = GL_TEXTURE_CUBE_MAP_POSITIVE_X + f;
-        glTexImage2D(face, 0, format, size, size, 0, format, type, faceData[f]);
+        AssetEntry entry = assets.Find(FaceNames[f]);
+        PvrTexture face;
+        PvrError error = face.Parse(entry.Data, entry.Size);
+        if (error == PvrErrorNone)
+            UploadPvrTexture(face, GL_TEXTURE_CUBE_MAP_POSITIVE_X + f);
+        else
+            cout << FaceNames[f] << ": " << PvrTexture::GetErrorString(error) << ".\n";
+        assets.Release(entry);
     }
     glTexParameteri(GL_TEXTURE_CUBE_MAP, 
                     GL_TEXTURE_MIN_FILTER, 
@@ -122,36 +131,29 @@ GLuint CreateCubemap(GLvoid** faceData, int size, GLenum format, GLenum type)
     
 void RenderingEngine::Initialize()
 {
-    const unsigned int* faces[] = { Face0, Face1, Face2, Face3, Face4, Face5 };
+    // The pack stays mapped, but once GL has a copy of each texture its
+    // pages can go.
+    string packPath = GetResourcePath("Textures.pack");
+    if (m_assets.Open(packPath.c_str()) != AssetPackErrorNone)
+        cout << packPath << ": " << AssetPack::GetErrorString(m_assets.GetError()) << ".\n";
 
     // Load the background texture:
+    AssetEntry entry = m_assets.Find("Metal");
+    PvrTexture metal;
+    PvrError error = metal.Parse(entry.Data, entry.Size);
+    if (error != PvrErrorNone)
+        cout << "Metal: " << PvrTexture::GetErrorString(error) << ".\n";
     glGenTextures(1, &m_textures.Metal);
     glBindTexture(GL_TEXTURE_2D, m_textures.Metal);
-    {
-        PVRTextureHeader* header = (PVRTextureHeader*) Metal;
-        GLsizei w = header->Width;
-        GLsizei h = header->Height;
-        const unsigned int* texels = Metal + header->HeaderSize / 4;
-        GLenum format = GL_RGB;
-        GLenum type = GL_UNSIGNED_SHORT_5_6_5;
-        glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-    }
+    UploadPvrTexture(metal);
+    m_assets.Release(entry);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
     // Load the cubemap texture:
-    PVRTextureHeader* header = (PVRTextureHeader*) faces[0];
-    const unsigned int* faceData[] = {
-        faces[0] + header->HeaderSize / 4,
-        faces[1] + header->HeaderSize / 4,
-        faces[2] + header->HeaderSize / 4,
-        faces[3] + header->HeaderSize / 4,
-        faces[4] + header->HeaderSize / 4,
-        faces[5] + header->HeaderSize / 4 };
-
-    m_textures.Cubemap = CreateCubemap((void**) faceData, header->Width, GL_RGB, GL_UNSIGNED_SHORT_5_6_5);
+    m_textures.Cubemap = CreateCubemap(m_assets);
 
     // Create some geometry:
     m_kleinBottle = CreateDrawable(KleinBottle(0.2), VertexFlagsNormals);
@@ -206,6 +208,7 @@ void RenderingEngine::Initialize()
 
 void RenderingEngine::Render(float theta) const
 {
+    PROFILE_ZONE("ES2::RenderingEngine::Render");
     const float distance = 10;
     const vec3 target(0, -0.15, 0);
     const vec3 up(0, 1, 0);
@@ -1,1052 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT const unsigned int
-#endif
-
-A32BIT Face0[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x00000100,		/* dwHeight */
-0x00000100,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00010013,		/* dwpfFlags */
-0x00020000,		/* dwDataSize */
-0x00000010,		/* dwBitCount */
-0x0000f800,		/* dwRBitMask */
-0x000007e0,		/* dwGBitMask */
-0x0000001f,		/* dwBBitMask */
-0x00000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0xffdfffbe,0xfe97ffff,0xbc6cccad,0xac4bc4cd,0x9b47c4ed,0x208061a2,0x29010800,0x29003122,0x08201880,0x29025246,0xff3ce6db,0xdd53ff1a,0xddb6b3cd,0xffbeffdf,0xffbeffde,0xffdeffbe,0xff9bffdd,0xff9bff9b,0xff5aff7a,0xff5bff7b,0xff7aff9c,0xfed9fef9,0xbc91e5d6,0x8b0d9bae,0x62a96248,0x62a749a4,0x520449c3,0x394049c5,0x10401000,0x6ac849c4,0x626751c3,0x624772c9,
-0x49a36266,0x394149e4,0x5a463941,0x4182730a,0x4a045a45,0x182030e0,0x51e472c9,0x7ae87ae8,0x7ae872c8,0x7b299bec,0x418462a8,0x416249c5,0x4a063962,0x31014a27,0x7b6a2903,0x73287308,0x6b0a7329,0x28e10000,0x312228c1,0x416349e5,0x312149c4,0x418272e8,0x49a349a3,0x498351c4,0x392130e0,0x30e03941,0x51e53920,0x62876b08,0x62875a46,0x62666266,0x62876287,0x5a256ae8,
-0x51c45205,0x20c130e1,0x10203984,0x7b086a86,0x830772c7,0x6a868307,0x72c68348,0x72c672c6,0x186051e4,0x18602080,0x29011840,0x08400820,0x18e24206,0x00000000,0x08215aca,0x000020e3,0x00001882,0x184028e0,0x10600800,0x5a044141,0x5a435a04,0x62435202,0x62656aa6,0x72c76245,0x6aa76ac7,0x6a866265,0x72e76245,0x834972e8,0x7ae872e8,0x836a8349,0x8b8a8b8a,0x72a68349,
-0x7b2872c7,0x83697b28,0x8b897b28,0x7b0872e5,0x8bab7b08,0x836a834a,0x6aa76ac7,0x6ac772c8,0x62865a25,0x6aa76aa6,0x28a06aa8,0x418449a5,0x000049e6,0x00000020,0x00000820,0x00000000,0x00000000,0x00000000,0x00001000,0x00000000,0x00000000,0x20a30800,0x310030e0,0x10002880,0x28c15245,0x5a044143,0x51826a46,0x72a67a85,0x62037222,0x28c01020,0x30e030e1,0x5a4628c0,
-0xff9eff7d,0xff7cffff,0xb44cd551,0xac2abcad,0xb46bb44b,0x4940ac09,0x00000800,0x00001040,0x420418a1,0x630b4a67,0xffdfffff,0xffbdfffe,0xffffff5c,0xffffffff,0xffffffff,0xffffffff,0xfffdfffe,0xffbcffdd,0xff7bff7c,0xff5bff7c,0xff7cff5b,0xff3bffbd,0x9b6cee17,0x93ceac10,0x39655207,0x62883102,0x52046286,0x49c35a26,0x18201000,0x208051a3,0x5a26836b,0x49a351e5,
-0x49a351e5,0x49a351c4,0x416251e3,0x49c34161,0x28c04182,0x08005225,0x6ac7838c,0x72e87308,0x7b298349,0x7b6a83ab,0x20605a68,0x49a43901,0x10201000,0x39842922,0x10000800,0x5a473944,0x52476309,0x08005267,0x104018a0,0x39424162,0x10004162,0x5a0549e4,0x49a351c4,0x414249c4,0x392128c0,0x31203941,0x51e53940,0x52255a66,0x52045a66,0x5a465a45,0x6aa75a25,0x6aa76287,
-0x626672e8,0x20a049e4,0x18801840,0x72e86265,0x83287ac7,0x72a57ae6,0x72c78348,0x7b0872a5,0x30e16aa7,0x18802080,0x29001020,0x39843143,0x00200800,0x00000840,0x00001061,0x31043185,0x00000000,0x00000000,0x18800820,0x51824981,0x72c772e8,0x6a866266,0x6aa66265,0x6ac772e7,0x72c76a86,0x6a856a86,0x6aa772c7,0x836a72c7,0x72c772a7,0x8b6a7b08,0x8b8a8b8a,0x62027b07,
-0x83496244,0x7b077b29,0x83697b28,0x7b287b29,0x7b298369,0x834a7b29,0x6aa772e8,0x73086aa7,0x6aa76aa7,0x6ac76a87,0x392272e8,0x28c14184,0x18810800,0x00000000,0x00000000,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x42270000,0x41844184,0x20803102,0x51e50800,0x51e53120,0x20004940,0x59832000,0x7a668b08,0x51a26a45,0x392328a0,0x20402040,0x080049a4,
-0xff1bff3b,0xeedae658,0xf696ff5c,0xac4bbcac,0xac6cb44b,0xa409d5d2,0x39014920,0x18a11840,0x316318c1,0xffff18c2,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xfffeffde,0xffbdffdd,0xffbdff9d,0xff5cffbd,0xff3bfeda,0xdd95fe99,0x69c8c4d3,0x41856269,0x10204185,0x51e56287,0x49c35205,0x18402060,0x51e44141,0x51c44962,0x5a255a05,
-0x6a875a25,0x51c55a06,0x49a35a05,0x418249c4,0x39224182,0x9c2d3942,0x30e26287,0x51e24983,0x7b086a87,0x52456ac8,0x206028e0,0x41622020,0x08000800,0x28a01021,0x10200800,0x20801860,0x00000000,0x39643143,0x5a6620e0,0x5a463921,0x62883940,0x5a254182,0x392149a3,0x392049a2,0x30e04162,0x39413100,0x62673940,0x49e45225,0x52255a46,0x5a465225,0x5a465205,0x5a665a66,
-0x6ac86287,0x39625a65,0x080028c1,0x7b084a04,0x83288308,0x72a58328,0x7ac772c6,0x7b0872e6,0x31016264,0x20a02080,0x20c01860,0x29644a06,0x00000000,0x08401081,0x08400000,0x30e30000,0x00000000,0x00000000,0x20600800,0x72a649e4,0x7b08834a,0x72a76265,0x72c66aa6,0x6aa672c7,0x72c76266,0x72c86aa7,0x72e772c8,0x6aa68349,0x7b298349,0x83297b28,0x72e88369,0x8b8a7ac7,
-0x7b078349,0x7b286ac5,0x7b498b89,0x73087b49,0x7b29836a,0x72c8834a,0x6ac76ac7,0x6ac76aa7,0x5a456ac7,0x6aa76286,0x49845a45,0x62a93124,0x00000800,0x00000000,0x00000000,0x000020a1,0x08000000,0x00000000,0x00000000,0x20a20000,0x49e52902,0x39433964,0x080028e0,0x31005a47,0x394049a4,0x38804101,0x8b491800,0x6a6672a5,0x392051c3,0x288030c1,0x72e93922,0x18400800,
-0xde38ee99,0xd616cdf6,0xcdb5d5f6,0xac2af677,0xac2bac29,0xe653bcae,0x49207283,0x10001860,0x18a11861,0xf7df20c2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffefffe,0xfffefffe,0xffbdff9c,0xff9cff9c,0xff1bff9c,0xee57fefb,0x2000bb6e,0x41232000,0x08003102,0x28c10800,0x41815205,0x28402860,0x28801000,0x52053941,0x62675205,
-0x62875a67,0x6a876267,0x62675a46,0x6ae96ac8,0x390149a3,0x838b2880,0x30c028c0,0x5a244141,0x39616285,0x52256287,0x49c54184,0x30e11820,0x49e43943,0x39a40820,0x20a10000,0x208028e1,0x29011860,0x08001040,0x39421020,0x5a663101,0x62863961,0x5a464a05,0x49c449e4,0x49c349a3,0x39013900,0x39225a46,0x6aa849c2,0x49c449c3,0x51e362a8,0x41a249c3,0x49c449e4,0x52245a45,
-0x5a665204,0x51e56287,0x18413101,0x6aa62080,0x82e87ae8,0x7b067ac6,0x7ac77b07,0x7ae759e2,0x39216245,0x208020c0,0x18602080,0x5aca3122,0x00000000,0x08000800,0x28c20000,0x39240820,0x20e30861,0x00000000,0x41201820,0x8baa51a2,0x72c76aa6,0x6aa66265,0x7b088348,0x6a856a86,0x7b086a86,0x7ae87b09,0x7b087b09,0x72c67b08,0x73087b08,0x7b498369,0x83697b08,0x8b8a7b28,
-0x83698369,0x7b088348,0x836a8b8a,0x6aa672a5,0x73097b29,0x73097329,0x73096aa8,0x626672e8,0x628662a7,0x73087329,0x31015a45,0x100020a0,0x00001860,0x00000000,0x08000000,0x00000840,0x00000000,0x08200000,0x31032903,0x18821820,0x39843123,0x31213922,0x8bee3102,0x28c051c5,0x39004141,0x38c05160,0x51a182e9,0x41612860,0x28a14181,0x51e530c1,0x20804183,0x41634183,
-0x6268a44f,0x7b4b836b,0x62667b4a,0x93cb7b6b,0x93c99c0c,0xb4cea46a,0x9be9c4ef,0x49444900,0x20a13902,0xef9ea4d2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdeffff,0xff9effbe,0xff3bff9e,0xf67afeba,0x79c3ab8c,0x30e15142,0x730a4142,0x10000800,0x5a2541c2,0x28802040,0x39015a26,0x520541a4,0x62875205,
-0x5a675a46,0x62676247,0x62676287,0x52056ae9,0x5a264162,0x41a43101,0x416151e4,0x59e451a3,0x51e562a7,0x206049e3,0x28a028c0,0x310028a0,0x62a949c4,0x00005268,0x08003163,0x20e10000,0x31013963,0x31222080,0x31213962,0x41643142,0x41825a25,0x49a45226,0x49e44162,0x498351c3,0x41424161,0x41424163,0x5a473940,0x49825225,0x49a25a04,0x49c251e3,0x5a2649c3,0x52045a25,
-0x62665224,0x52056287,0x312151e5,0x62661860,0x830872a6,0x72a57285,0x7b086a85,0x6a866244,0x39218349,0x208028e0,0x20602080,0x20c228e1,0x00000000,0x18810800,0x28e20000,0x00000000,0x00000000,0x10200000,0x51a228a0,0x62256204,0x72c772c7,0x72a672e7,0x7b2872e7,0x6a8672e7,0x72c76a86,0x6aa672e7,0x7b2872e7,0x6a867b08,0x730872c6,0x7b288baa,0x8b6a6264,0x83498b8a,
-0x83498349,0x7b0872e7,0x73077b08,0x62855a02,0x59e472c8,0x72a76245,0x72e76aa6,0x52036285,0x6ae86286,0x6ae86286,0x5a676ae8,0x28c149e5,0x00003121,0x00000000,0x20a120c2,0x00000800,0x10200800,0x18401040,0x102028a2,0x312028c2,0x186030e1,0x28e020a0,0x62876ae8,0x41623901,0x49a23940,0x6a676a25,0x39214140,0x20402060,0x20602060,0x52053942,0x39623921,0x5a883122,
-0x9c7083ad,0x6aa75a06,0x7b6962c9,0x7b6a840e,0x836a72e8,0xa46da44d,0x93cabd30,0x50e28b48,0x30e228c1,0x8c7062eb,0xef7dad55,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xff3dffdf,0xee18fedb,0x7a47ccd2,0x7a666183,0x30a149a2,0x52055a45,0x62461820,0x5a036246,0x392049a3,0x5a4649c4,0x5a466267,
-0x5a466267,0x628749c5,0x62875a46,0x39416ae8,0x49c31800,0x59e53941,0x59e54141,0x51e25a04,0x18a03102,0x28a10000,0x28c03100,0x414228e0,0x49e43901,0x39445247,0x316341c5,0x10400000,0x080020c0,0x28e12082,0x28e020a0,0x6ae928e0,0x41a23942,0x51e45224,0x418351e4,0x49834181,0x49c33941,0x392051c4,0x51e472a7,0x49615a46,0x5a0551e3,0x51e449c3,0x520449e4,0x5a256266,
-0x520449e4,0x51e55204,0x30e05a47,0x5a261800,0x7ae672c7,0x72a672c5,0x7ac67ac6,0x72a672c6,0x49a38348,0x20c03121,0x18601840,0x20e128e1,0x00000000,0x29421881,0x18400800,0x206039a4,0x18811020,0x10000803,0x59e338a0,0x5a046224,0x72c76aa5,0x72e772e7,0x7ae76a86,0x72a672c7,0x6a8672c7,0x7b097ae8,0x7b087ae8,0x72c772e8,0x7b277b07,0x72e66ac6,0x836a7ae8,0x72e772e7,
-0x83698349,0x83498349,0x72a57b09,0x6ac751e0,0x6a857329,0x622451c2,0x73485a23,0x49a27b2b,0x62863100,0x6ae86aa7,0x41a562a8,0x31215226,0x29253122,0x00000000,0x28c22903,0x18604103,0x08200860,0x18a11840,0x41a40800,0x41835206,0x20601000,0x7b693101,0x30e06a87,0x41624982,0x51c34140,0x30e051c4,0x49c349e4,0x20403942,0x51e251c3,0x10001800,0x104049c6,0x5a696ae9,
-0x6aa96aa9,0x5a258bad,0x100041a2,0x8bec41a3,0x6ac87b6b,0x8b8a6245,0xb4eea44d,0x938ab4ae,0x38e27267,0x4a275207,0x9cb141e6,0xce177bae,0xf77cffde,0xffffffff,0xffffffff,0xffdeffff,0xffffffff,0xffffffde,0xffffffff,0xffffffff,0xffffffff,0xff5dffdf,0xfe99ff5c,0xbc2fccf3,0x6288de16,0x18206227,0x59e34141,0x5a246246,0x626651e2,0x41615a04,0x49c441a3,0x51e55a47,
-0x5a675a46,0x62875226,0x6aa75a66,0x41805a25,0x416249a3,0x62262040,0x39003921,0x5a256245,0x0000acae,0x30e00800,0x28c028c0,0x51e53962,0x39626288,0x49e541a4,0x08000800,0x10200000,0x08001040,0x420541c5,0x6b096b09,0x41c44a24,0x520549c4,0x41835225,0x49c449c4,0x52053920,0x41615204,0x394051e4,0x31004982,0x59e35a67,0x62864982,0x5a455a05,0x49c34182,0x5a465a25,
-0x52055225,0x51e551e4,0x41a351e5,0x49a31000,0x83287b07,0x72857b07,0x72a672a6,0x72c67b07,0x6aa78369,0x28e13962,0x184020a0,0x20e13102,0x00000000,0x41e60000,0x310020a2,0x62896ac8,0x000041a5,0x49821800,0x6a8659c2,0xa42e6a65,0x72c66245,0x72e76a86,0x83497b28,0x72c76aa6,0x72e86aa6,0x7ae872e8,0x72e87b09,0x7b287b28,0x6aa67b27,0x73088349,0x72c672c6,0x7b087b08,
-0x83698349,0x51e1836a,0x6aa57b27,0x7b6a5202,0x41206aa6,0x59e359e3,0x83ab5a04,0x41606285,0x5a455204,0x62a86ac8,0x31215a88,0x18801861,0x00001880,0x00000000,0x08000841,0x00000000,0x18401000,0x100020c0,0x5a473102,0x41834184,0x7b293921,0x73086287,0x41812880,0x30c03100,0x628741a2,0x51c36aa8,0x5a464183,0x390228e0,0x93ee1820,0x49c25204,0x39a420c0,0x28e11860,
-0x5a0751c6,0x30e15a06,0x49822880,0x41a46245,0x6ac7738c,0x59e46245,0x8bcb8bab,0xd5f3bd30,0x72875962,0x41c5730b,0x4a065268,0x7b8d8c0f,0x6b0b5a89,0x9cd283ce,0xde99ad75,0xef1be6fa,0xe6dae6da,0xf7bde73b,0xf79ef79e,0xffffffff,0xffffffff,0xffbeffdf,0xf679ff5c,0x69a5dd54,0x41417246,0x59e54983,0x41205182,0x62656247,0x62665a22,0x30e072c7,0x49c45225,0x5a2649c4,
-0x5a4649c4,0x5a265a46,0x6aa75a46,0x5a445a25,0x6a876a88,0x5a056266,0x392028a0,0x6a884141,0x5a246a66,0x49e30800,0x49c449c4,0x62886ac8,0x5a875a68,0x20a049a4,0x08000000,0x10200001,0x08000800,0x3a060020,0x6b496309,0x946f840b,0x28a03962,0x394249a4,0x49c449c4,0x51e44161,0x41825a24,0x49c24983,0x41825a04,0x5a047b4a,0x52036245,0x62866267,0x49a351e4,0x49c451e4,
-0x522649c5,0x49a45224,0x41a349a4,0x28801000,0x83297b07,0x7ae78349,0x7ae772a6,0x72a66a85,0x62666a86,0x31013983,0x18402080,0x292228c1,0x00000000,0x6b0c0020,0x39801882,0x41c649a3,0x080020c2,0x5a043061,0x62446245,0x72c96224,0x72e76245,0x72c66265,0x6a867b08,0x6aa672e7,0x72e86aa6,0x7b2972a7,0x6aa77b09,0x83496245,0x7b497b28,0x6ac7836a,0x7b2772c6,0x83498349,
-0x83497b28,0x83487b08,0x5a437ae9,0x73097b49,0x59e359c2,0x6a6559e3,0x732a836a,0x6a876a86,0x5a466286,0x52466267,0x00004184,0x39845a47,0x00000000,0x00000000,0x08010000,0x5a260000,0x28a04140,0x39421021,0x41a43942,0x41655226,0x28a25225,0x49a3b4f1,0x41824161,0x30e030e0,0x73297349,0x51c36ac9,0x52432080,0x30e0acb1,0x49a3836a,0x51e65a26,0x08001840,0x20a01020,
-0x5a486288,0x412251e6,0x49a338c0,0x62675a06,0x730a5a26,0x7b2a8bac,0x8bac6a87,0xacd0d5d5,0x6289a4b0,0x51c55a06,0x08004144,0x52273985,0x62ca4a07,0x52485aa9,0x738d5227,0xb554ad13,0x6b09736b,0x5a873101,0x9430734b,0xad549c91,0xfffef7dd,0xff3cff9d,0xf6dbfefb,0x7a88e617,0x5a246225,0x62466246,0x59e351c3,0x41616246,0x394172a7,0x6a6649c3,0x52056aa8,0x49c451e5,
-0x52055a46,0x52056287,0x51c35a05,0x418249c3,0x520449a3,0x626649a3,0x416351c4,0x6aa628a0,0x51e46aa7,0x62a84162,0x5aa85a87,0x52675aa8,0x52255247,0x29014a05,0x08001040,0x18001820,0x00001000,0x00000000,0x00000020,0x20a020c1,0x49e43942,0x39623122,0x41a33942,0x49a34182,0x392049a3,0x49826245,0x416151c3,0x72e84141,0x626672c8,0x52255204,0x41a34183,0x51e55205,
-0x49c45205,0x49c45225,0x49c349a3,0x416241a4,0x8b696ac7,0x8b698308,0x7ae772c6,0x6a856a65,0x5a2472e7,0x39425225,0x106020a0,0x318420c0,0x00000000,0x94700000,0x51e63983,0x5a475a67,0x10202880,0x6a6651c4,0x5a256a86,0x6ac76287,0x72c76285,0x6a656a65,0x6ac772c7,0x6ac772c7,0x6a8672e8,0x7b086aa7,0x626472a7,0x7b288348,0x7b497b28,0x8b8a7b28,0x73087308,0x7b2872e7,
-0x7b097b2a,0x6aa672e7,0x5a025a23,0x7b2972a6,0x834a836a,0x72e872c8,0x62666aa7,0x62a75a65,0x5a666287,0x49c56ac8,0x30e13121,0x418349a4,0x6ac941a4,0x20803102,0x41421020,0x28804982,0x5a055205,0x51e54142,0x30e03922,0x49c449a3,0x836b3922,0x39414183,0x39403920,0x39214182,0x394030e0,0x394230e0,0x734a4162,0x62666b0a,0x30c028c0,0x392149e3,0x20811000,0x18401860,
-0x6aa95a27,0x62476aca,0xbd735a26,0x52056266,0x6aa85205,0x7b6b730a,0x49407b29,0x59e48308,0x72882020,0x59e572a8,0x730a6a89,0x62895a68,0x4a075207,0x52274a07,0x51e65a89,0x20c241c6,0x6b098c0e,0x6ac98bee,0x5a686287,0x62ea5a88,0xbdd55ae9,0xce16de78,0xe658de17,0xc575cdb5,0x5a246a88,0x51a349a3,0x620551a4,0x51c272a9,0x8bcc7b0b,0x41626ac8,0x6ae97309,0x5a265226,
-0x51e549e5,0x5a265205,0x5a045a26,0x626549a2,0x5a453920,0x51e349a2,0x6a864982,0x498330e0,0x520449c3,0x522649a3,0x52475a88,0x52465246,0x49e549e5,0x416341a4,0x20203962,0x49a44982,0x186072c9,0x00000000,0x00000000,0x186020a1,0x49e41000,0x418328e0,0x41a341a3,0x49a349c3,0x5a0451a3,0x41625a04,0x59e451e2,0x49a24160,0x5a457b0a,0x520551e4,0x41a349c4,0x49c449a4,
-0x520549c4,0x52055205,0x49e35225,0x49836267,0x7ae76286,0x7b078349,0x83287ae7,0x72a672a6,0x72c772a7,0x310162a8,0x18a03101,0x4a261880,0x00000000,0x736d0020,0x39237329,0x49e55a67,0x30c04983,0x6a864981,0x62866a88,0x6a87732a,0x62656aa6,0x72c772e7,0x6ac77b08,0x7b285a45,0x7b08834a,0x7ae87b29,0x62446a86,0x83697b07,0x7b287b49,0x83697308,0x73287308,0x62455a45,
-0x41806ac7,0x6a6349e0,0x5a2351c1,0x7b297b08,0x8bab8bab,0x62666ac7,0x5a256265,0x62875a44,0x5a666266,0x28c05a66,0x20a01020,0x9c7128a0,0x39216268,0x41623921,0x39404162,0x6aa74160,0x498330c0,0x392151c4,0x310130e0,0x62a851e5,0x5a467b4a,0x51e34963,0x39215205,0x39413100,0x28c06aa7,0x41814161,0x416251e4,0x7b293942,0x51e472e8,0x18600800,0x18401860,0x186020a0,
-0x5a0651c5,0x5a265a26,0x9c4e6ac8,0x73089c6e,0x49615a45,0x6a8751c3,0x8b8b834a,0x830893ab,0x7b098b4a,0x72a86246,0x730a6206,0x41635a07,0x49a56248,0x49e64163,0x52485a88,0x39445207,0x184030e2,0x520549e5,0x520551e4,0x51e54983,0x100030e1,0x93cc3901,0x9cb0bd74,0x7b2ba4b1,0x5a265a24,0x8b8c51c5,0x28806287,0x72e749a2,0x6a666a86,0x6ac76a65,0x6267730a,0x62a849c4,
-0x52055a46,0x52055a25,0x51c45a04,0x6244836b,0x418351c4,0x310041a3,0x62444162,0x51c44962,0x51a451c4,0x080049a4,0x416339a4,0x10001820,0x20a03943,0x182020c1,0x28a01820,0x5a456a87,0x838b4982,0x00001000,0x00000000,0x314120e2,0x52054a05,0x41643942,0x39623943,0x392141a3,0x41625a04,0x49a251c3,0x49a38b6a,0x51e35a25,0x72e85a25,0x416151e4,0x49a44983,0x51e44183,
-0x49c449c4,0x418349c4,0x41a35225,0x496151e4,0x6aa65a04,0x7ae772e7,0x72c77b08,0x6a856a85,0x73086a85,0x39636ae9,0x106020c0,0x292218a0,0x00000000,0x6aea0000,0x736c1880,0x20805a88,0x51e249c4,0x18002060,0x520530e0,0x49e43100,0x52235a04,0x62665a25,0x62a762a7,0x72e85a45,0x73076ae7,0x73286ac7,0x62437328,0x7b697b07,0x72e77328,0x5a426284,0x5a456285,0x5a455a04,
-0x51c249a1,0x5a436244,0x414041a0,0x628651a1,0x730972e7,0x6ae87309,0x6a876aa7,0x5a456266,0x52045a25,0x51e441a3,0x51e441a3,0x20402040,0x59e530c0,0x30a030a0,0x49a251c2,0x5a256ac7,0x30a05a05,0x416238e1,0x41414982,0x7b4a5a46,0x39424163,0x49833941,0x416251c4,0x5a685a66,0x51e451e3,0x520451e5,0x28a03921,0x734a7b29,0x7b6b6ac9,0x20601000,0x28c02060,0x20801840,
-0x498351c3,0x51c34162,0x72e872e8,0x7b6b7b09,0x6a6583cd,0x49616224,0x622459c2,0x59c251c2,0x62666a65,0x6a666225,0x51836a86,0x6a4751a3,0x41224141,0x62a851a4,0x62685206,0x49a55206,0x6aa96268,0x49a37309,0x39416245,0x394149c3,0x6ac772e8,0x51c36265,0x49835a26,0x628649a3,0x72e95203,0x52054142,0x5a046ac8,0x41405a02,0x28801800,0x51e44981,0x30c051c4,0x416230c0,
-0x5a666287,0x5a466ac8,0x52046266,0x39005203,0x52256226,0x49e34183,0x59e628a0,0x51e459e5,0x39225a25,0x62a828a0,0x31220840,0x312220a0,0x28a01860,0x39221000,0x62665204,0x5a256266,0x41a251e3,0x10001840,0x00000000,0x29020000,0x52254a05,0x39433942,0x31013922,0x51e44183,0x41213901,0x51a351c3,0x51a349a3,0x49825a25,0x49a24161,0x5a245a05,0x49a449c4,0x49c451c4,
-0x41a34182,0x41a249e3,0x6ac84182,0x414049c4,0x72e751c2,0x72c77b07,0x7b0872c7,0x6a857b07,0x940c6a85,0x31016ae9,0x18a028c0,0x290120c0,0x00000000,0x52280000,0x080020c0,0x08003164,0x51c22080,0x30a05a04,0x08005a05,0x49e61040,0x5a2449c5,0x6a876266,0x5a666286,0x52235a85,0x5a635202,0x6ae65242,0x6ac67b49,0x72e77329,0x62856ac7,0x51e16ac5,0x62655a64,0x52035203,
-0x62a55203,0x62858c0b,0x62855223,0x7b2872e7,0x62457b28,0x62665a24,0x62665a45,0x5a046266,0x28c05a66,0x28e06aa7,0x414149c4,0x72c94143,0x49626a87,0x51c330a0,0x51e351a2,0x62665a45,0x51a34161,0x414149a3,0x30c15a06,0x4183940c,0x31015a26,0x49c44161,0x41614183,0x52053941,0x416230e0,0x51e41800,0x39612880,0x418328a0,0x18201000,0x20401820,0x31212080,0x39621840,
-0x5a455a25,0x41825a24,0x6ae762a6,0x6a86836a,0x6a856aa6,0x518151e1,0x626459a1,0x72867b28,0x7ae78328,0x72858328,0x836a9c0d,0x59c27246,0x72857ac8,0x5a0538e1,0x49e451c5,0x20803121,0x41841000,0x62256aa7,0x838b6266,0x6aa87b4a,0x6aa66ac8,0x838b5a04,0x72c82060,0x49e40000,0x624651e5,0x62a73121,0x5a2430e0,0x6ac76264,0x9c4e6246,0x08003942,0x18001800,0x18002040,
-0x5a4630e0,0x39425a26,0x62a66267,0x7b295a65,0x5a465a46,0x5a0530e0,0x6ae730c0,0x5a476286,0x49c45a67,0x6b293141,0x00406287,0x31220000,0x30c00800,0x5a245a45,0x5a455a04,0x5a456286,0x5a0551e3,0x39026266,0x00000820,0x4a260000,0x39834a05,0x28c02901,0x39424163,0x41a23101,0x49823942,0x520449c3,0x49c36266,0x5a055a25,0x59e45205,0x62a97309,0x7b2b5a66,0x62885a47,
-0x41624162,0x49e44162,0x5a2549c4,0x498128e0,0x72c751e3,0x72c67b08,0x7ae772a6,0x72c772e7,0x8bab6a65,0x18606aa7,0x18601060,0x290120a0,0x00001881,0x49e60000,0x28e03123,0x20600000,0x18201800,0x49c349c3,0x49c63900,0x00004a06,0x51e41000,0x39213900,0x20c06b08,0x5aa60820,0x62a43100,0x5aa462c4,0x73287329,0x62a65243,0x52235244,0x6ae65a44,0x62656ac7,0x51e349c2,
-0x5a025a24,0x6a855a42,0x6ae772c6,0x62857b6a,0x5a246ac5,0x41813920,0x628649c2,0x836b6286,0x18406288,0x394228e1,0x496241a3,0x41826246,0x10006a87,0x62455a45,0x51c230c0,0x49607b6a,0x62865a45,0x51a351e4,0x7b4b18a0,0x204028c0,0x41614984,0x418249a3,0x41424983,0x41823900,0x49c33100,0x49835a46,0x41a23961,0x206049e4,0x28c02081,0x20602080,0x206028a0,0x49c34182,
-0x62a87b4a,0x6a866265,0x6ae75224,0x6ac772e8,0x6a855a44,0x62446244,0x72e66244,0x8b697b08,0x7b088308,0x6a457ac6,0x7ae78329,0x7ac5a470,0x83089b68,0x7ac89c2c,0x5a2651c2,0x7b4b6267,0x7b499c4e,0x72c86226,0x49a251c3,0x62655a44,0x6aa75a23,0x6a668349,0x18203901,0x08003102,0x41215a26,0x28a12080,0x49a22060,0x836951e2,0x838b8bcc,0x6ae8838b,0x39001840,0x5a0449a3,
-0x5a465a25,0x49c46aa8,0x41a27309,0x6ac85204,0x5a464183,0x49831840,0x49a430c0,0x52041860,0x49e66ac9,0x29210800,0x08004a07,0x20800000,0x52042880,0x51e35a25,0x5a0351e3,0x622459e3,0x49c36267,0x626751e3,0x08001040,0x31640000,0x18804206,0x49c51880,0x49a44163,0x28e020a0,0x418249a3,0x5a255a25,0x49a35204,0x41835a25,0x30e049c4,0x5a477b4a,0x498451e3,0x49834162,
-0x39434163,0x49e44162,0x418328e0,0x62466287,0x62653901,0x7b0772e8,0x7ae772c6,0x72c77b28,0x6aa772a6,0x20a05a65,0x208020e0,0x20a028e1,0x00001881,0x49c50000,0x41a320a0,0x20801020,0x310049a3,0x51c449a3,0x30e13921,0x524828e3,0x522530e2,0x418349e4,0x104020a0,0x31600800,0x31603980,0x62e72920,0x5aa75246,0x5a665266,0x520541a2,0x62876286,0x62468bac,0x5a2451e3,
-0x41405a23,0x28804140,0x5a4449a0,0x6aa69c2c,0x49404140,0x59c24140,0x6a666a86,0x206072c8,0x310128c0,0x30e03921,0x39004182,0x7b496246,0x5a253941,0x5a2572c7,0x51e36244,0x62456246,0x7b097b09,0x39226aa8,0x4141836b,0x28a04162,0x498349a3,0x41423921,0x41624182,0x414130e0,0x392028c0,0x30c051c4,0x418228e0,0x18201860,0x10001840,0x206020a0,0x49c23901,0x5a256266,
-0x62645a44,0x6aa77b29,0x6a867b07,0x7b287308,0x72e76aa6,0x7ae98369,0x7ae89bed,0x72a472a5,0x7ac67282,0x838a8307,0x7aa47b07,0xa40d8b08,0x83067aea,0x7b088b8a,0x59e36264,0x5a246246,0x834c6a87,0x41605a45,0x5a2249a0,0x7b2a6265,0x7b096a86,0x7ae97309,0x598172c5,0x9c705a26,0x52477b8c,0x944e5a88,0x30e03941,0x6aa76aa6,0x834a7b08,0x93cd7b49,0x6aa77b29,0x51c45a25,
-0x626651e5,0x498349a3,0x28e041a2,0x628620a0,0x62866266,0x49c43121,0x41833121,0x41813941,0x290041a3,0x18601820,0x21020800,0x30e01800,0x5a046aa8,0x622551e4,0x5a025a04,0x49a24981,0x5a245a23,0x5a0551e2,0x28e24984,0x00000000,0x00000000,0x31221880,0x4a275267,0x39215a45,0x39605205,0x39404183,0x51c35a45,0x51e34101,0x41616267,0x72c95a24,0x72c94161,0x39215204,
-0x39414983,0x31004a03,0x41623981,0x496249c3,0x5a0449a3,0x72c76aa6,0x72e78348,0x62447ae7,0x72c86a85,0x20a06a86,0x18401880,0x208028e0,0x00201000,0x28a23966,0x416530e0,0x208028a0,0x49e52060,0x392128e1,0x204038e0,0x00000000,0x52065206,0x416451e6,0x00001041,0x20c018a0,0x29013162,0x29422942,0x20c13162,0x18600000,0x20803141,0x5a681020,0x31005204,0x20204962,
-0x7b265a04,0x9be98ba6,0x62635a24,0x38c03100,0x620151a1,0x61c259a1,0x51e24940,0x00005a45,0x20404142,0x41413942,0x51a46a86,0x416251c5,0x7b295a05,0x62466266,0x62456a87,0x834b59e4,0x7b297b29,0x624651c4,0x30e04960,0x30e03941,0x49c349a3,0x39013921,0x49a34182,0x390028a0,0x496259c4,0x51a34100,0x208049c4,0x18402080,0x208020a0,0x41823921,0x520451e4,0x5a256266,
-0x7b086a85,0x72c86a86,0x5a246265,0x6aa77b29,0x72c76a86,0x7ae872c7,0x8bab8b8b,0x6a8372c6,0xa3ee72a3,0x93eb8b49,0x7ac4938b,0x8b4882e6,0x7ac47ae6,0x7ae78b6a,0x6203a42e,0x8bab6a65,0x30c05a03,0x6aa76ac6,0x836a72c8,0x7b0a6265,0x836a5a24,0x7ac77b08,0x7ae87ae7,0x49c41000,0x51c42880,0x6ac89c4f,0x7b0972e9,0x51e48329,0x62666245,0x5a266286,0x7b4a49a3,0x8b8b6aa7,
-0x5a466287,0x49c35a04,0x41a341a3,0x52257308,0x49c362a7,0x392130e0,0x62a841a3,0x49e35225,0x41a43962,0x20813102,0x10001001,0x5a032020,0x5a056266,0x49804160,0x51c251c2,0x6aa65a03,0x5a0449a2,0x51c351c3,0x10405a06,0x20a21060,0x08200000,0x31012902,0x6b4b7b6b,0x30c049e5,0x41623942,0x394151e4,0x6b2a736b,0x49a26288,0x392051e5,0x39215a24,0x72e83941,0x51e45204,
-0x392149a4,0x49a25a25,0x41614182,0x9bec51c3,0x416149a3,0x62656aa6,0x6aa672e7,0x72a56a85,0x72e872c6,0x418372c7,0x290120a0,0x28c028e0,0x00001860,0x31210800,0x28a02080,0x39623121,0x418441a3,0x28a20800,0x18401820,0x00000820,0x00000000,0x00200820,0x31641880,0x314220e0,0x39633142,0x29422921,0x39833162,0x41a33142,0x41a341c3,0x08003102,0x41406265,0x30a04941,
-0x624251a0,0x5a018345,0x5a013940,0x5a0151c2,0x59e151c0,0x61e36a43,0x838b5a03,0x62467b29,0x49a34142,0x30e051e5,0x622630c0,0x51e272a8,0x418049c2,0x49c14180,0x5a036265,0x6aa659e2,0x28c051e4,0x39017b09,0x41822080,0x41424182,0x39414983,0x52044162,0x416230e0,0x51c372e9,0x51a36246,0x59e44961,0x28c030e0,0x18201820,0x30c22040,0x51e34161,0x51e45a45,0x5a255a25,
-0x834972e8,0x72e86a86,0x62446265,0x7b498369,0x7b287308,0x7b287b28,0x6b0772e7,0x8b8d836a,0x8baa8baa,0x93898bab,0x93ea7aa5,0x93aa9c0c,0x72a482c5,0x93279c0c,0x72637ac2,0x7b087284,0x93cd72e8,0x7b287b2a,0x7b497b6a,0x834b5a24,0x5a2372e7,0x72c67b48,0xcd7572c7,0x20602040,0x28e120c1,0x49823922,0x7b295203,0x6265a46d,0x51e451c3,0x49a36266,0x39215a44,0x6aa77309,
-0x62663921,0x416049a2,0x9c4e6ac8,0x52256267,0x51e328e0,0x28c05a26,0x52473942,0x4a255267,0x100041c4,0x20810840,0x40c01020,0x6a665a01,0x5a046266,0x51c45a04,0x5a0449a3,0x62265a24,0x62255203,0x624559e5,0x9c4e6266,0x10200820,0x00001861,0x28e00800,0x31643143,0x39026288,0x62673942,0x51e61840,0x41625204,0x5a2551a3,0x62464142,0x39405205,0x51e25a06,0x62666246,
-0x30e06267,0x49a251c3,0x518372c7,0x30c06225,0x416149a3,0x72c672a6,0x72e76aa6,0x6a657b07,0x6a876aa6,0x520572e8,0x28e11860,0x290128e0,0x18401020,0x31030800,0x28a11001,0x206028c0,0x41832081,0x4a063101,0x08000000,0x08200800,0x10001000,0x28c01020,0x28c028c0,0x39633142,0x20c039a3,0x29212101,0x20e018c0,0x41a33141,0x41a249c4,0x41a320c0,0x492038e0,0x59c24900,
-0xc50a6a24,0x7ae38b80,0x51a06ac5,0x59e259c0,0x6a856224,0x6a6672c6,0x73287aea,0x51e449c3,0x5a2549c4,0x49a16287,0x59e44161,0x5a054141,0x51c46a67,0x62665a45,0x49803940,0x208038c0,0x6a875204,0x08005a45,0x51c4730a,0x49c349a3,0x5a2549c3,0x416249c3,0x41626aa7,0x51e46267,0x9c2e72c9,0x308051e4,0x28a028c0,0x20202080,0x51c22860,0x5a246aa6,0x5a455a45,0x5a055a25,
-0x7b088349,0x6aa693ab,0x6a866a86,0x72c78b8a,0x7b0772e8,0x72a68348,0x72856263,0x7b496244,0x8bcb93cb,0x72e57b27,0x72846a83,0x82e67ac5,0x93a97284,0x8b4893eb,0x7b07a40b,0x6a448369,0x7b6a8328,0x62846aa5,0x72c77b49,0x7b086287,0x62445a23,0x7b4c72e8,0x8bed3900,0x392220a0,0x51e4942d,0x5a045a25,0x7b085a03,0x6aa7de36,0x41626265,0x49a28349,0x62664182,0xa44d51e4,
-0x10006ac7,0x5a043940,0x18604982,0x1880ad11,0x41c441a3,0x734b3982,0x000020c0,0x49e541e5,0x39423942,0x30a02922,0x72a73921,0x6aa76265,0x5a256245,0x62255a04,0x6aa751c3,0x5a2351e4,0x51e36aa6,0x72c849c3,0x62666aa7,0x18601880,0x08201820,0x39843965,0x18a03142,0x49c50800,0x522628c1,0x49c341a4,0x5a676ae9,0x498351e4,0x5a266267,0x41426aa8,0x62665a26,0x5205838b,
-0x31006246,0x49a34962,0x6a865a25,0x5a04ddf4,0x30a06a66,0x6a866a85,0x72c76a86,0x6a6572a6,0x72c772c6,0x5a458329,0x29001860,0x28a028c0,0x080028c0,0x41845268,0x39432080,0x394228c1,0x18201840,0x5a074164,0x08002041,0x18001020,0x18401840,0x20801840,0x20801020,0x184020a0,0x10201020,0x18801040,0x31011880,0x31403140,0x49c33942,0x18202061,0x51814100,0x62034941,
-0x9be46242,0x51a093a2,0x49603900,0x41204960,0xc530ac8e,0x7b4a72e8,0x41837309,0x5a465a46,0x49c24162,0x414149a4,0x624451c3,0x51e459e4,0x49615204,0x628749a3,0x416051a3,0x62a830e0,0x41626286,0x626649a3,0x49c251e3,0x51e351e4,0x414151e3,0x62876267,0x288059e4,0x49a22880,0x5a2538e0,0x308051c4,0x28604100,0x41604982,0x62655a04,0x5a256286,0x62665a45,0x5a256245,
-0x83498349,0x6a867b28,0x6a866a86,0x72a772c7,0x6aa68349,0x7ae66244,0x62846244,0x6a867307,0x836a8369,0x8b898328,0x83266221,0x7ae67b07,0x9c0c7ae6,0x8305940b,0x93ca72a4,0xb531a42d,0x59e26285,0x30e072e7,0x496059c2,0x6aa56285,0x41204160,0x838a6ae7,0x18603921,0xa46f28e0,0x20406287,0x730949a3,0x72a76ac8,0x49a37b48,0x49a393cc,0x72e85a25,0x49c34983,0x5a4549c3,
-0x7b097b29,0x416272e8,0x5a466266,0x6ac8734b,0x104020c0,0x18811040,0x18823963,0x41a33985,0x28c03921,0x51e32080,0x6a866245,0x6a6672c7,0x62666265,0x416051e4,0x626751e4,0x5a256246,0x5a245a24,0x52055a24,0x5a046a44,0x184072e8,0x10001021,0x08000000,0x39840800,0x39633102,0x31015206,0x312028a0,0x396362c8,0x836a4982,0x49a349c4,0x51c45a24,0x6a878b8b,0x62871840,
-0x51e35a05,0x62656225,0x49626245,0x834951c3,0x51e328a0,0x6aa651e3,0x7b286aa6,0x7ac772a6,0x72c76a85,0x7b297b08,0x20c028c0,0x392228e0,0x18603100,0x31440800,0x08000800,0x20801840,0x28c028c0,0x08000800,0x20801860,0x182028c0,0x18401000,0x20c01840,0x20c01840,0x10201820,0x20c03141,0x20a03101,0x31211020,0x39613120,0x18a13101,0x38a02020,0x1800ac90,0x61c351a3,
-0x72c459e1,0x7b4830e0,0x62647b29,0x51c36264,0x6a65b4d1,0x62875a25,0x418349e4,0x41832060,0x39416aa9,0x51c3836c,0x5a6730e0,0x51e35224,0x41204182,0x418351e4,0x394241c2,0x49c48bab,0x418151e3,0x5a463940,0x30e03920,0x49825a25,0x49a25204,0x394049c3,0x39204140,0x6a684162,0x49613080,0xa3eb4100,0x72868b29,0x62266a45,0x62455a25,0x62666266,0x6ac76246,0x5a255a25,
-0x72a78349,0x59e38328,0x6aa66245,0x6ac76ac7,0x836a72e8,0x8bab8369,0x62a57b28,0x7b286aa4,0x7b488389,0x82e86a63,0x7ae79389,0x7ae78307,0x93ca8307,0x832672e6,0x830872a5,0x72c67ac7,0x7b288b6b,0x9c4e7308,0x6aa57b27,0x73496ae8,0x62658bec,0x6aa85a26,0x080041c4,0x52430800,0x310262a7,0x7ac74163,0x51a251a2,0x838b6aa5,0x6aa849a1,0x51e35a45,0x6ae76aa7,0x41403940,
-0x28c04982,0x49c4944e,0x39629c4f,0x39834182,0x39637309,0x5a8949e6,0x39840800,0x10400000,0x31023942,0x59e32061,0x62246244,0x5a036245,0x5a045a24,0x5a0459e3,0x5a0651a3,0x5a046a87,0x51e35a04,0x51e35a03,0x5a046265,0x41646a86,0x08001020,0x00000800,0x10000000,0x08003123,0x312241a4,0x416351e4,0x51e56288,0x5a264182,0x626662a8,0x418251e3,0x498349c3,0x41829c4e,
-0x5a2451e3,0x9c0e7b4a,0x72e83100,0x6a6651e4,0x49a24141,0x72c75a25,0x72866a86,0x7ae85a03,0x6aa672c7,0x6ac77ae7,0x20a03122,0x31012900,0x206128e1,0x41850000,0x08002080,0x20403121,0x49a31800,0x394238e3,0x28c03920,0x41623100,0x30c14162,0x288030c1,0x394228a0,0x18004142,0x28a028a0,0x30e03941,0x28c030e0,0x392028e0,0x20210800,0x6a873920,0x51e493ef,0x51814960,
-0x5a244980,0x5a436ac6,0x6a668329,0x41618baa,0x206093cc,0x49c36265,0x83ab7329,0x392049a4,0x49a25a26,0x51e46267,0x51e53920,0x414051e5,0x52043100,0x39224160,0x6a894161,0x49c37b2a,0x416251e3,0x49a251e3,0x49a35a45,0x5a043100,0x51e349a2,0x51e359e4,0x39216245,0x28806266,0x8b067a63,0x93c9a3ea,0x7b2a93ab,0x59e472e8,0x52035a03,0x5a255a24,0x52256286,0x5a255a45,
-0x6a8572c6,0x8b8b7b49,0x6a867b28,0x72e87b49,0x7b49834a,0x83697b08,0x836a93cc,0x6aa65222,0x6ac672e7,0x61e16a84,0x8b8872c5,0x7ae59bab,0x726459e0,0x5a027284,0x6a627ae6,0x5a244980,0x8b897b27,0x62247b08,0x72e77ae7,0x83498b8a,0x62447b28,0x6ac7832a,0xc5b36ac8,0x41412080,0x9c4e8bec,0xcd9328a0,0x7b086224,0x8bab6265,0x5a255a23,0x41615a26,0x39419c2d,0x51c26286,
-0x7b4a72a6,0x51c228c0,0x49e35223,0x49e42060,0x10405a46,0x31443943,0x39630800,0x10000861,0x30e00800,0x6ac62860,0x5a246245,0x5a246245,0x62045a24,0x51a35a04,0x51a45a04,0x51e36226,0x51c24981,0x51c35a04,0x6a665a04,0x836a6245,0x08000800,0x18800800,0x31a51080,0x28e220e1,0x41a441c5,0x39214162,0x62873963,0x62673941,0x6aa949c5,0x51e551c4,0x41614182,0x51e451e4,
-0x49835a45,0x18405a04,0x49c372c8,0x41403941,0x51c24160,0x832851e3,0x72866a86,0x8b6a72a6,0x6a866a86,0x6aa772a6,0x20a03962,0x522628c0,0x08202901,0x6aaa18a1,0x5a270000,0x288049a4,0x5a042020,0x310051e4,0x49834182,0x5a2551e4,0x49c35a45,0x5a2451e3,0x49c35a45,0x39413940,0x52044162,0x49833100,0x41a249c3,0x20a04182,0x49a22040,0x28a02040,0x414038e0,0x38c05182,
-0x624551a2,0x41404162,0x5a044161,0x6a664962,0x5a4551c4,0x39405204,0x41836266,0x41624162,0x5a264161,0x51e34161,0x51c451c3,0x49a249a1,0x5a0549a3,0x18003900,0x28c08bab,0x496249a1,0x392051e3,0x182072e7,0x41816246,0x5a245204,0x5a455204,0x49a26225,0x416151a3,0x7ae76244,0x9bca9368,0x730893cb,0x20603920,0x49827308,0x73495225,0x49c33940,0x520451e4,0x520451e4,
-0x7b087b08,0x72c68b8a,0x8bac8309,0x6aa572c7,0x59e16a83,0x62437b08,0x7ae76222,0x62a58b6b,0x73297b48,0x6ac67b48,0x73058367,0x93cb7ae7,0x72a58b69,0x832872a4,0x6a858baa,0x8b6ba44e,0x83296aa6,0x7b088329,0x6aa57b27,0x62636aa5,0x6a6572e5,0x7b097b68,0x41c13920,0x73083120,0x73087b49,0x7ae75a24,0x83096a85,0x620461c1,0x7b0a942e,0x49e37b2a,0x6ac96ac8,0x5205b4f1,
-0x62665a05,0x62666ae8,0x62a63940,0x20c27b2a,0x29230000,0x18e141c5,0x10200000,0x10000001,0x6a8651e4,0x62666245,0x59e36244,0x6a866a64,0x59e45a24,0x62255a04,0x51e459e4,0x51e451c4,0x624551e3,0x5a246265,0x6aa75a05,0x5a246224,0x10007b29,0x20621000,0x49e70000,0x20801020,0x31223123,0x39214184,0x49c43963,0x49a449a4,0x418472e9,0x520549e5,0x62876266,0x49c35204,
-0x836a3901,0x41a17b09,0xa48da44f,0x49a0834a,0x5a035a42,0x72e751a2,0x72a67ae7,0x7ac77ae7,0x624572c7,0x6aa76225,0x28e151a3,0x28e02100,0x10603101,0x18400000,0x00010800,0x59c430c1,0x62446a65,0x51e33940,0x41624163,0x5a055204,0x52045a25,0x62455a24,0x7329838b,0x52255a26,0x51e55a26,0x5a2551e4,0x5a2649c3,0x18003901,0x414051e3,0x49a249a2,0x51c15a04,0x41415a04,
-0x51e44142,0x49a251c4,0x836a7b28,0x49a251c2,0x41616226,0x418251e3,0x5a4528a0,0x62865a05,0x520549e3,0x51e35205,0x49a24162,0x396051a2,0x49835a26,0x93cc1000,0x5a053921,0x49804982,0x49a24981,0x49c449a2,0x49a351c4,0x51e451e4,0x418149c2,0x51a35a24,0x49825a24,0xac6f5a05,0x6a87a40f,0x7b495201,0x8bab8bab,0x6a874182,0x49c149a2,0x49a249c3,0x52045a45,0x52045204,
-0x7b077ae7,0x72e77b28,0x72e66202,0x624472a6,0x72c772c7,0x41405a22,0x72c65a02,0x5a2230e0,0x8b8a72c6,0x9c2d9c2d,0x9c2da42e,0x6a838b67,0x72a68347,0x72a672a5,0x8b4a8baa,0x7ae993cc,0x6aa77b07,0x62648328,0x62236244,0x72c78bab,0x39006a85,0x08006ae8,0x59e16ac6,0x8b486a64,0x8b6a4960,0x39427b29,0x624451c3,0x28606a44,0x49a16245,0x5a444960,0x51e530e0,0x62a641a3,
-0x30e06a86,0x62a63100,0x20608bad,0x39823101,0x10403163,0x08001860,0x00001061,0x49c41840,0x6aa66266,0x62666265,0x51a25a03,0x59e459e3,0x72c75a04,0x72a77b08,0x5a0572c7,0x5a044983,0x5a046265,0x62656a86,0x5a035a24,0x5a245a23,0x30e159e5,0x20411840,0x104128e1,0x10400000,0x31013123,0x5a265a26,0x20606aa8,0x416349c4,0x49a449a4,0x520551e5,0x52055a46,0x41826266,
-0x498349a3,0x6ac749c3,0x6aa66ac7,0x72e551e2,0x49a249c0,0x624449a1,0x7ac772e7,0x83087b07,0x6a8672a6,0x6aa66a86,0x31006a86,0x20c03141,0x20e12080,0x39441041,0x100028c2,0x49a31000,0x204038c0,0x49c34182,0x49a351e4,0x49c35204,0x62654182,0x520449a2,0x52257309,0x5a255a45,0x51c35a25,0x5a0551e4,0x49c45204,0x59e54161,0x6a853921,0x62445a04,0x51e35a03,0x5a046a66,
-0x49a24161,0x5a4551e3,0x52046266,0x51a35a04,0x49a34982,0x62463942,0x62664162,0x41814983,0x49a23100,0x520449a3,0x51e472e8,0x416128a0,0x182030c0,0x51e572e8,0x5a2551e4,0x520449e3,0x41614161,0x62653920,0x392051e4,0x51c55a24,0x51c36266,0x6a665a03,0x5a2551c3,0x41414982,0x51c34160,0x28a07b0a,0x5a045205,0x49a24161,0x51e33940,0x49a15204,0x51e35a23,0x38e038e0,
-0x72c66244,0x72c76a86,0x7b287ac7,0x83296aa5,0x8b8a7ae9,0x72a47ae7,0x940e51e1,0x72c5834a,0x72856202,0x8bca72e6,0x8b898b8a,0x83497ae7,0x7ae793ca,0x72a67285,0x7ae693ec,0x62664180,0x6a8672e6,0x624372a5,0x82e77ac6,0x72e55a23,0x18407b46,0x49c26284,0x7b885a45,0xacf09c4d,0x38c051c0,0x9c6e7b6a,0x5a028329,0x62247ae8,0xa40d5181,0x392072a7,0x6ae84161,0x5a446286,
-0x6a876ac7,0x39621000,0xb50f49a4,0x41a420a0,0x29020840,0x310320a0,0x10021020,0x836a4922,0x6aa66245,0x62665a25,0x51c26224,0x6a865a03,0x7b085a25,0x59c35a04,0x62257286,0x5a0551a3,0x62455a24,0x62456245,0x5a236244,0x72c651c1,0x6ac76a67,0x18002060,0x08002080,0x18a118e2,0x41a43963,0x31014984,0x49a44163,0x51e53101,0x5a262060,0x5a2641a4,0x51e451e4,0x41425a25,
-0x6aa83901,0x39225202,0x7b2b6ac5,0x73055a04,0x28c0a48b,0x5a033960,0x728672c7,0x8b6a72a6,0x6a4572a6,0x72a76aa6,0x39007b08,0x28e03100,0x290120a0,0x08000800,0x49624184,0x28005181,0x20203040,0x51e45a06,0x520449a2,0x49a349c3,0x49a249a3,0x41825a24,0x73096aa7,0x41a24182,0x49a25a45,0x49a35a25,0x28c05204,0x59e44181,0x62444962,0x6a865a03,0x62456aa6,0x72e72860,
-0x49824140,0x51c44161,0x6aa76267,0x41414982,0x626730c0,0x49c472c8,0x52044162,0x310049c3,0x41404120,0x51e330c0,0x522549a3,0x51e449e4,0x5a0528a0,0x51c44183,0x51c451e4,0x73094182,0x51e34141,0x5a2349a2,0x51c34181,0x5a0649a2,0x41826287,0x49a34981,0x496251c3,0x5a043920,0x414151c3,0x62466265,0x49612880,0x51e259e3,0x626649c3,0x51e25204,0x41404981,0x28604962,
-0x72a672a6,0x72a67ae7,0x73086a85,0x93cb9c2d,0x83499c0c,0x8b8a8b8a,0x7b09938a,0x83488349,0x8b697ae7,0x72c68349,0x7b287286,0x7b487b48,0x83287307,0x83488b69,0x83498b6a,0x5a0472a6,0x39205a24,0x93cc7b08,0x8baa93ab,0x7ac67ac7,0x080059e3,0x5a655201,0x8bcb62c5,0x7b049c2a,0x59e272c6,0x8bcc6a66,0x7b078349,0x624572c7,0x6a454981,0x5a2559c2,0x31004141,0x31003920,
-0x416251c3,0x7b092080,0x5a455a25,0x31209c4d,0x20c22080,0x00000000,0x28601861,0x72e851c3,0x62256265,0x62446245,0x6aa76245,0x5a2451e4,0x6a666244,0x62456a86,0x6aa572a6,0x624451e2,0x62655a24,0x5a456265,0x5a246a85,0x6aa66265,0x628672e8,0x288051e4,0x08001000,0x18401861,0x208028e1,0x31022901,0x730a6ac9,0x62a83963,0x49a430e0,0x41a26287,0x62684183,0x72e849a3,
-0x72e86267,0x51c38bac,0x626549a2,0x72c75a23,0x6aa76aa7,0x49a35a65,0x7ae772e7,0x83078307,0x7aa68b49,0x7b0872c7,0x49a36a86,0x314228c0,0x310128e0,0x10000800,0x49822060,0x49614982,0x18002860,0x41824983,0x39413940,0x49c44183,0x5a2451c4,0x49a251e3,0x49a349a2,0x41614181,0x51e351e4,0x52045a25,0x51e43920,0x72e951e4,0x626751e3,0x6ac74181,0x62246265,0x62243900,
-0x41415a04,0x62255a04,0x496251c3,0x49836245,0x49625a25,0x414151c3,0x93cc2040,0x49834162,0x51e349a2,0x49c24161,0x52054182,0x20806246,0x310030c0,0x624651c3,0x49a34162,0x51c341a3,0x72c84983,0x5a0572e8,0x39205205,0x5a2549a2,0x5a045a45,0x6a8851c2,0x49c351e4,0x5a0451e3,0x49615a04,0x49814982,0x7b094981,0x51a44981,0x414051e3,0x520451e4,0x49636246,0x49405181,
-0x6a857b08,0x7ae87ae8,0x7b286a64,0x83298b8a,0x8b8a7b08,0x93aa8b6a,0x8b8b7b08,0x83298b69,0x83297b08,0x6a247aa7,0x62656224,0x5a244161,0x628549c2,0x5a035203,0x72e772a7,0x626572e7,0x5a0249a2,0x83687b28,0x93cbac6e,0x8328a3ed,0x39406a63,0x732a0860,0xa46e7ba9,0x93a98b89,0x62654960,0x6ac75a24,0x41616245,0x51a249a1,0x8b6af6b7,0x62656266,0x93cc8b6b,0x62876266,
-0x412159e4,0x5a245a45,0x39414141,0x49e428c0,0x000062a7,0x00000000,0x416220a2,0x832a6264,0x6a877b09,0x5a245a24,0x62445a03,0x624451c2,0x62654181,0x6aa75a03,0x7b298bab,0x6a876a87,0x62a76ac8,0x5a455a24,0x5a046aa6,0x72c76aa6,0x6a875204,0x51c45a45,0x18601820,0x10000800,0x20a028e1,0x10004184,0x20c020c0,0x41c43963,0x51e54182,0x5a2751e5,0x418128a0,0x520349a3,
-0x206072e8,0x6a8851e3,0x6a865a43,0x28806245,0x28a072c8,0x41623942,0x7ae75a24,0x7ac67ac7,0x6a448b69,0x72a672a6,0x62658b69,0x20a03120,0x31013101,0x18201840,0x49812080,0x49a18309,0x31022860,0x49824162,0x49a24161,0x498349a4,0x5a2449a4,0x41625204,0x498149a2,0x52034182,0x6a876267,0x49a351c4,0x5a464161,0x51c428c0,0xa4505225,0x5a4449c2,0x62036203,0x5a024120,
-0x498259e4,0x49624982,0x59e56aa6,0x72c94140,0x5a243921,0x51c34162,0x5a266265,0x51e45a25,0x51e451c4,0x6a8751e4,0x390249c3,0x41812880,0x51e45a45,0x49844162,0x498349a3,0x5a0449c3,0x5a055204,0x41635a05,0x62246a87,0x624651e3,0x52056267,0x622651e3,0x9c6f5a66,0x49a15a04,0x498372c8,0x62466246,0x51e372e8,0x6aa751c2,0x51e351c3,0x51a26224,0x6a454100,0x51205181,
-0x7ae77ae7,0x6a8572a6,0x72e851c1,0x7b287ae8,0x7ae78b8a,0x6aa67b08,0x72e77b28,0x72858349,0x728572a6,0x6a866a86,0x52036204,0x5a455a45,0x5a4551e4,0x626549c2,0x51c14982,0x498249a1,0x6a876265,0x6a437ac6,0x49817ae7,0x72a56204,0x6a6451c1,0x730820a0,0xac8d8beb,0xa44ca44c,0x6a6472a6,0x412072c7,0x6a866266,0x93cc4140,0x52054162,0x72e728a0,0x72c86ac7,0x72e951e5,
-0xe65672e7,0xac8f6aa7,0x416128c0,0x838b49c3,0x08003101,0x08000000,0x41202040,0x7b0749a2,0x62456a86,0x51e36245,0x49c15a24,0x5a046263,0x62256aa7,0x49a06244,0x62446a65,0x5a046aa6,0x520451c3,0x51e26265,0x51e349c2,0x62456a66,0x62466265,0x62875a46,0x10001840,0x10001000,0x31021860,0x20802060,0x394328e0,0x62883123,0x62a92900,0x62a86287,0x5a2549a4,0x6ac84161,
-0x39416266,0x39203941,0x498249a2,0x30c06245,0x41626a66,0x41a320a0,0x83085a04,0x7ac67ac6,0x8b4893aa,0x72a66a65,0x62457ae8,0x28e030e0,0x28c02900,0x206030e0,0x49821800,0x28602020,0x414128a0,0x49624161,0x49a351c3,0x418251c3,0x418251c3,0x49a25204,0x49a330e0,0x5a0549c3,0x6ac85a67,0x49a349c3,0x31005204,0x93ee5246,0x30e04142,0x39007b28,0x6a838b67,0x6265a44c,
-0x3941c572,0x8bac51e3,0x51e45205,0x392051c3,0x41604981,0x41626287,0x51c351c2,0x51e44981,0x51c35a45,0x49a349a2,0x49832860,0x49a34982,0x51c35a05,0x51c34982,0x416149a2,0x41204961,0x52046245,0x41624162,0x624551e4,0x51e45a03,0x39405203,0x51e45a03,0x5a253901,0x49a251e3,0x39206245,0x41616245,0x5a056265,0x49829bec,0x72877287,0x38e059e3,0x59a05160,0x40c05140,
-0x72a68b69,0x6a655a03,0x838a8b8a,0x832972c7,0x62457b28,0x6a866a85,0x72c66a86,0x83498348,0x72a77b08,0x62456a86,0x39207ac8,0x52255a45,0x62876286,0x6265838a,0x6a855a04,0x7b083900,0x6a666245,0x6a437ac6,0x83467ae8,0x728593aa,0x51a08b47,0x28c04962,0x83488bea,0x9c2b9c2c,0x7b297b2a,0x72a77ae9,0x626638e0,0x498272c9,0x5a033901,0x41208b8a,0x6aa65a04,0x5a4549c3,
-0x6a877b08,0x626551e4,0x28a05a25,0x39203901,0x10203901,0x08000800,0x41412820,0x72e772c6,0x6a866a86,0x51c36265,0x51e36266,0x5a2551c2,0x62666265,0x72c772c8,0x51e36a66,0x62446a86,0x52046245,0x49c25204,0x5a044160,0x62666a86,0x72e96266,0x5a456aa7,0x10006287,0x08001861,0x20a13102,0x31012080,0x394341a3,0x49c55a68,0x28a05205,0x52263100,0x41424163,0x5a2551c4,
-0x51c4838a,0x628649a2,0x30c028c0,0x414151c3,0x41415a05,0x082020a0,0x7b0749c4,0x83287ac6,0x8b488b49,0x7ac78328,0x72c78309,0x20803921,0x28c03942,0x182028e0,0x51a330c0,0x20002840,0x418230e1,0x49824162,0x52044982,0x49c351e4,0x628651c4,0x5a045a04,0x5a255a45,0x5a255a25,0x5a265204,0x41a45246,0x41842901,0x30c17b8c,0x59e46267,0x49a15a03,0x72c493c9,0x93eb6a84,
-0x49c32880,0x5a274160,0x83ab51c4,0x5a0451a3,0x49a051c3,0x51e35a45,0x62453920,0x41414981,0x5a0451e3,0x30c049a3,0x41215183,0x62256204,0x62664983,0x51a351c3,0x5a044981,0x6ac75a43,0x62865a24,0x49836286,0x51a36a87,0x51e36a67,0x5a266266,0x41624140,0x5a2449a3,0x5a044962,0x62444160,0x59e451e2,0x5a047b29,0x6a8759c3,0x59e36225,0x49804140,0x61c05180,0x69e161c1,
-0x7aa87ae8,0x72666a24,0x7b4972e8,0x72e772c7,0x6a6672e6,0x6a857b08,0x942d93ec,0x73066ae8,0x834a6265,0x6a667ae8,0x7b096aa7,0x51c34942,0x62665204,0x5a245a23,0x62656aa6,0x72a67b28,0x72c772a6,0xaccf83aa,0x72649c2d,0x832972c7,0x62248329,0x51e25a43,0xbd72a4af,0x18208349,0x4981832a,0x72e95a05,0x5a036aa7,0x72c74982,0x41205a04,0x7b296a66,0x5a266245,0x72e993cc,
-0x72c77ae8,0x72c772e7,0x6aa74920,0x39208c0e,0x51c24960,0x18004101,0x51c34121,0x72c77b07,0x626572c7,0x62655a04,0x622559e4,0x730872e8,0x5a045a24,0x72a77b08,0x62656a66,0x6a876265,0x62656245,0x5a0459e3,0x5a446aa6,0x62656ac6,0x5a256286,0x5a046aa7,0x28e16287,0x18601040,0x62896aeb,0x28a03102,0x39633122,0x39433963,0x31025a67,0x39223941,0x49a45205,0x6aa74182,
-0x72e96aa8,0x6aa77b29,0x72a86a87,0x41402020,0x41835a25,0x39833963,0x830618a0,0x83277b08,0x7ae78b69,0x83288328,0x7ac78307,0x28c03900,0x310228a0,0x30e03101,0x6a4549a0,0x28212020,0x41624983,0x51c451c4,0x5a2551e4,0x52255a25,0x62865a25,0x73296286,0x73297309,0x62876aa7,0x5a6720a0,0x41625206,0x49c43120,0x49c36ac8,0x6a4549c2,0xcd8d3900,0x6a62ac6b,0x41405a22,
-0x626649e2,0x51c46288,0x520451c4,0x49e351c4,0x51c251e2,0x5a015a03,0x49a151a2,0x49c349c3,0x626651c4,0x82e838e0,0x61e34920,0x49a16224,0x5a0451e3,0x624551c3,0x51e26244,0x8bec62a6,0x51e35a03,0x626651c3,0x626549c2,0x49a15a45,0x72c972c8,0x72e86267,0x5a255a25,0x59e38bcc,0x59c33900,0x836b4962,0x622472a7,0x49815a04,0x59e359e3,0x41203900,0x82c76a03,0x6a0240c0,
-0x6a247265,0x6a667b08,0x5a055a03,0x6244836a,0x72c65a23,0x6aa66aa6,0x62867308,0x6aa66265,0x6aa66a85,0x7b086aa7,0x7b087b09,0x49a28389,0x62456244,0x8b6a72c7,0xa44e72e8,0x7b088369,0x83288b69,0x93cc9c4e,0x7ac572e7,0x836a7b28,0x6244836a,0x836b7309,0x29018bcb,0x5a053921,0x41416245,0x6246bd11,0x5a045a05,0x62456a86,0x51c26245,0x72a76264,0x73086aa7,0x5a0451e4,
-0x72c74982,0x5a245a04,0x41624962,0x51e25a26,0x62256a45,0x6a876a65,0x62657ae8,0x6aa66a86,0x5a246265,0x62656a85,0x6a6651e4,0x6aa76225,0x5a255a45,0x62456265,0x5a246aa7,0x72a772c7,0x62456a86,0x62446245,0x7b297308,0x6aa66ac7,0x62866aa7,0x6aa76266,0x41c45205,0x08200820,0x18401040,0x30e24163,0x49c54184,0x396328e1,0x5a2649c5,0x39423941,0x41636aa8,0x49a43922,
-0x8bad93ee,0x626549a2,0x72e85a04,0x59e33900,0x49e45a45,0x30e13142,0x620518a1,0x7ae68b69,0x83288b48,0x83088b48,0x7ac77ae7,0x28e04161,0x312228c0,0x836949c4,0x59e25201,0x49832080,0x49a33942,0x51c451e4,0x51e549c3,0x6aa76246,0x62865225,0x6ae762a7,0x62a77329,0x49c46ac8,0x29011040,0x20603941,0x30e151e5,0x49c441a4,0x30e051c4,0xbd4d93e8,0x62455a23,0x49a15a04,
-0x7ae84161,0x39204141,0x49a33900,0x49814182,0x6a244981,0x62226a44,0x412061e3,0x520449a2,0x496251e4,0x59e36a87,0x59a26203,0x51e251c2,0x5a2459e3,0x62455a24,0x62246a85,0x51e45a44,0x5a046aa7,0x5a254160,0x51e349c2,0x51e46266,0x49c449a3,0x59e359e3,0x838a6aa7,0x49826ac7,0x51c35a24,0x7b2a8bac,0x59e36205,0x59e35a04,0x51815a03,0x62234120,0x51607244,0x512061c1,
-0x7b695224,0x6a8572c9,0x7b2951c2,0x6a636204,0x83497aa7,0x414072e9,0x7b086a85,0x7b096a87,0x6aa56aa7,0x72e77b29,0x72c872c8,0x93ab7ae8,0x7b4972a7,0x7b2772c6,0x938a8b8a,0x83277b06,0x62416a62,0x6aa64940,0x72e772c7,0x7b287b08,0x72a56ac5,0x10817ac7,0x4a050020,0x734a18a0,0x7ae90000,0x10411000,0x9bec40e0,0x5a257329,0x62656245,0x6aa66aa7,0x51e272c7,0x626749a3,
-0x49626225,0x72e849a3,0x7ae96a47,0x51c451c5,0x51c351c2,0x622572c8,0x622672c7,0x62656243,0x6aa572c7,0x62455a04,0x5a0472c7,0x62455a24,0x5a236224,0x51e36245,0x6a656a66,0x72c85a04,0x62456265,0x5a037b0a,0x73086aa6,0x626672e8,0x6a865a46,0x5a666265,0x41835205,0x08200800,0x10403143,0x394349e7,0x20a03122,0x208141a4,0x52053122,0x5a4649c4,0x838b7329,0x49c55a46,
-0x838c5a67,0x62672880,0x62447b4b,0x62456ac7,0x4a056a86,0x39822921,0x41860800,0x72a57b28,0x8b487ae7,0x83077ae6,0x938a8328,0x28c051e4,0x416128e0,0x28a23941,0x41c03960,0x312228c0,0x416249c4,0x498349c4,0x418251c4,0x520449c3,0x5a256286,0x6a876266,0x5a045a24,0x39435a87,0x31222080,0x52063941,0x28c049a5,0x49645205,0x4a0549a3,0x51c2acef,0x49c151e1,0x62454180,
-0x6a645a45,0x62a75182,0x51c34983,0x412149a3,0x72a56a44,0x62236a85,0x49826a65,0x520549a2,0x518230e0,0x59c15181,0x59c061e0,0x51a16202,0x62255a03,0x5a256245,0x62656266,0x5a055a03,0x49a372c8,0x5a0449c2,0x6a875204,0x5a045a03,0x5a046aa6,0x728651a1,0x6a666245,0x6a8651c2,0x6a855a24,0x62665a24,0x59e35a25,0x59e26244,0x51a359c3,0x412059c1,0x59a05120,0x59a25140,
-0x830961e4,0x626572c8,0x59e56245,0x498072a7,0x83497287,0x7ae97b29,0x20607ae9,0x5a455a04,0x72e77b49,0x6a86838b,0x6a866aa7,0x72a56aa5,0x624472a5,0x62435a23,0x7ae772c6,0x7ac772a6,0x83076a65,0x72e772a5,0x7b077b07,0x62647b08,0x72e672e6,0x18406225,0x00008bec,0x20c00000,0x8b4a730a,0x38e15962,0x390030a0,0x93ec8bec,0x62255a04,0x6a867b28,0x6ac772e8,0x390049c3,
-0x6a666246,0x41415a04,0x72e9b4d1,0x59e428a0,0x62446aa6,0x62456aa7,0x62455a25,0x5a435a23,0x5a256265,0x6aa65a03,0x6a666245,0x5a246265,0x6a8659e3,0x626551c3,0x7ac86a86,0x7ae76204,0x72c66a86,0x62656a85,0x6aa66ac7,0x624572e7,0x5a046266,0x62665a24,0x39426aa7,0x20c21000,0x292320c2,0x18403122,0x31221840,0x184020a0,0x626728a0,0x6ac849a4,0xa48f5a46,0x49c449c5,
-0x6ae93963,0x7b4a4121,0x72e6bd52,0x7ae87b49,0x622672a7,0x28e03901,0x18203101,0x72a57b07,0x7b078327,0x83278327,0x8b698327,0x28e05a04,0x30c03101,0x39835205,0x28c141a1,0x18400800,0x41a351e4,0x51e449a3,0x52045205,0x5a4551e3,0x51c349a3,0x49c35a04,0x6ae75a45,0x10004a05,0x20801840,0x41833921,0x416349a5,0x392128c1,0x49c34181,0xa48e2080,0x49a449a2,0x62865a26,
-0x49a28369,0x52246247,0x414151e3,0x5a045a24,0x61c16223,0x72426a01,0x51e46a65,0x49a44182,0x412049c3,0x59c14940,0x30e059c1,0x51a2a44e,0x5a0459e3,0x6a865a25,0x5a256245,0x5a046244,0x5a456246,0x5a456285,0x49804161,0x51a251a4,0x5a046245,0x5a036244,0x62435a02,0x51c35a04,0x51c25a04,0x6a6651e3,0x59e35a24,0x5a056224,0x49815a04,0x622351a1,0x59c17265,0x62234940,
-0x72e86245,0x832a8329,0x8b8c72c8,0x7b277b29,0x730793ed,0x72c66a44,0x5a445a04,0x49a13920,0x72e96265,0x6265838b,0x62656244,0x7b087b08,0x6a2472a7,0x622259c1,0x6a646203,0x72a482e8,0x72867ae6,0x5a216a83,0x62456a86,0x62646aa6,0x52045a23,0x106028a0,0x00004183,0x7b8b62e8,0xc5329c6f,0x9bcbb48f,0x72a78b8b,0x93ec5205,0x5a046a65,0x72c77b28,0x834a6a86,0x52033920,
-0x62462880,0x51e349a2,0x10200800,0x4141a48f,0x62456265,0x624551e4,0x5a036a66,0x41607b29,0x626751c2,0x5a246245,0x62665a04,0x5a245a04,0x72c86244,0x62446266,0x7ac96245,0x62438329,0x72a66a85,0x624472c8,0x6a865a24,0x6aa56286,0x62455203,0x5a245a24,0x51c35a24,0x184030c1,0x29031020,0x49e61000,0x28c11860,0x30e249c5,0x28c049e5,0x5a6672e9,0x5a4641a3,0x30e130e1,
-0x52261860,0x51e54982,0x7b07b4f1,0x7ae859c2,0x72c77ac7,0x49a47308,0x39413901,0x7ae67b07,0x83277ae6,0x8b487ae7,0x83477ae7,0x31216285,0x390128a0,0x08003101,0x10400000,0x20400020,0x41834163,0x41614182,0x730949c3,0x49a249c1,0x39404140,0x49c24181,0x62a76ae8,0x28e149c4,0x28c051e5,0x49a42080,0x41634184,0x5a8849a4,0x41614a05,0x7b8b4182,0x49a349c2,0x836951e3,
-0x3900938a,0x62a79c10,0x39004181,0x5a034982,0x62036202,0x59c26203,0x41416224,0x41624162,0x518230c0,0x496151a2,0x59e359c1,0x620459a4,0x51e46245,0x5a245a24,0x5a045a04,0x51c46244,0x62676267,0x51e351e4,0x51e35a25,0x51e36a66,0x83485a24,0x5a026a65,0x6a656224,0x62655a04,0x59e351e3,0x62456245,0x6a656245,0x8bcd51a2,0x31006286,0x72c76245,0x62236204,0x51e251e2,
-0x6a8772c8,0x51c26245,0x72877b09,0x9c2d834a,0x93ec8baa,0x39005181,0x72a67b08,0x72c66266,0x72a86a65,0x7b286ac7,0x72a78308,0x626572c7,0x7ae76aa6,0x72a67b08,0x7ac672a6,0x72848328,0x6a6559c2,0x72c78329,0x72c672c7,0x834972c8,0x7b4951e2,0x31623121,0x736a62c8,0x944f7bac,0xb48ebd31,0x93ccac6e,0x7b087b29,0x72a66aa6,0x51e372c8,0x5a045a05,0x52046245,0x41825a45,
-0x28e05a47,0x5205836a,0x5a256268,0x62661820,0x6a864142,0x51a36aa6,0x51e45a04,0x62656a86,0x6aa849c3,0x626551e3,0x49a25a23,0x6aa65a24,0x62666a87,0x72856a65,0x59e36203,0x7ac772a6,0x5a037ae8,0x72a7838a,0x6a855a23,0x62446264,0x7b286244,0x6aa68b8a,0x6a866aa7,0x08005204,0x18610800,0x520628a2,0x41633943,0x49a44163,0x41a33120,0x41827b4b,0x5a6649c3,0x7b277307,
-0x52267329,0x51e46aea,0x7b0838c0,0x8bcb8b69,0x8bcb8bcb,0x49a38bab,0x28a049c4,0x82e76266,0x83287ae7,0x83278b69,0x83078b48,0x392072a6,0x31013101,0x00003161,0x00000000,0x20800800,0x41833121,0x52054183,0x5a4649e4,0x52266266,0x6ae86ae9,0x52043961,0x292141e5,0x52463942,0x49a320a0,0x41a4b532,0x6ac93963,0x41844a05,0x49e43962,0x49e45a46,0x51e56266,0x83aa4160,
-0x5a258bcb,0x28e06287,0x498051a3,0x38e05a03,0x39004960,0x59e34980,0x49a251e3,0x30a030a0,0x6a6649a4,0x49a04941,0x496072c6,0x51e34960,0x49a25a25,0x6a8549a2,0x624551c3,0x62455a04,0x6aa7838b,0x51e35a25,0x5a254981,0x6ac73921,0x8bcb8baa,0x62457b08,0x5a235a03,0x62255a04,0x6aa76245,0x62465a04,0x5a4451a2,0x5a266266,0x51e251e3,0x72a75a24,0x51c272a7,0x622459e3,
-0x72a77b08,0x6ac79c0d,0x6a446a87,0x62046203,0x93cb8b4a,0x9c0c7ae8,0x7ac77ae7,0x49a26a86,0x62465a04,0x7b286286,0x622451c2,0x72e77b28,0x7b098b69,0x8b697ae8,0x62247ae7,0x72e66224,0x83496a85,0x73088b8c,0x72e76a85,0x41617b28,0x49e44160,0x00004182,0x7b6c4a05,0x9cafa4f1,0xb4aeb4d0,0xac6ebcf0,0x7b0893ec,0x51e3834a,0x6a866aa6,0x6a866225,0x5a4659e4,0x8bcc834a,
-0x62876aa8,0x5a2549c4,0x392051e5,0x39214984,0x62455a44,0x5a045a25,0x51e36245,0x624551e4,0x6aa851e3,0x62455a04,0x6aa75a24,0x51c35a05,0x72a76a66,0x6a8672c7,0x72c772e8,0x72a66a45,0x7b085a44,0x51c27329,0x6aa772c7,0x62457b08,0x6aa65a24,0x6a665a45,0x62656245,0x10406ac7,0x08001000,0x28c11000,0x838c1840,0x41a43102,0x62a86268,0x49c31880,0x41824182,0x39406285,
-0x418349c3,0x5a2549e6,0x624551a2,0xa46f51a4,0x8baa93cc,0x5a25838a,0x39415a45,0x8b4849a2,0x7ae68b69,0x93a98327,0x8b499389,0x51c38349,0x31013962,0x00003141,0x10610820,0x41830800,0x418349c4,0x49c451e4,0x5a4649c4,0x62a749a3,0x52466b09,0x52055a46,0x08003143,0x20c03102,0x28e04183,0x49c528e1,0x39834184,0x31015a67,0x41a36aa9,0x7b6a838b,0x41623941,0x62a651e3,
-0x62468389,0x6ac73922,0x83654980,0x51c272c5,0x59e251c2,0x59e45a03,0x288051c2,0x72e928e0,0x59e45a46,0x51a138e0,0x93cc1800,0x6a8672e7,0x5a245a24,0x62456a86,0x62255a25,0x62455a04,0x49a251e3,0x5a0551c3,0x5a2659e4,0x6aa65a46,0x5a246aa6,0x5a04832a,0x624572c7,0x6a866245,0x51e26aa5,0x5a056aa5,0x62644161,0x49a24982,0x520428c0,0xb5329c6e,0x62646245,0x59e259e2,
-0x51a26224,0x626451c2,0x7ae68b8b,0x6a4461e3,0x7ae88b28,0x6a867ac7,0x51a26a45,0x51e27287,0x520330e0,0x8bab6aa7,0x62442040,0x8b8b5a43,0x62236ac5,0x6a868309,0x624372a6,0x7b286a64,0x72c55a24,0x6aa67b28,0x62657b07,0x41608b8b,0x49a34981,0x49c35a87,0x6b491040,0xacf0ad11,0xb48ea44e,0xac6dd592,0x93cb9c0c,0x7b297b09,0x838a7286,0x49826286,0x49a15a04,0x51c259e5,
-0x41a349a3,0x41c26267,0x5a042880,0x498251c4,0x622551c3,0x51e35a25,0x6a8649a2,0x59e459e4,0x51c251e2,0x51c159e3,0x72c772a7,0x624572a6,0x72e84982,0x6aa672a7,0x6aa472c6,0x72a66a84,0x72c66a85,0x51e26a86,0x7b286265,0x5a246ac7,0x6a445a04,0x6a8551a2,0x5a2451e3,0x31226aa7,0x18401840,0x39642902,0x08001040,0x51c430c0,0x72c85a47,0x28804984,0x416351e5,0x520349c2,
-0x51e53942,0x5a2549c5,0x7b0872a7,0x28608329,0x6ac58b8a,0x73057b67,0x28a049a3,0x8b8930e0,0x83068328,0x83078b48,0x83278327,0x62267ae7,0x39644163,0x106128e0,0x00000000,0x31400800,0x39633943,0x41a43943,0x41c24a04,0x4a2549e4,0x522649e5,0x31424a05,0x10402903,0x18401841,0x20803102,0x312241a4,0x39433963,0x39833943,0x418362a8,0x52253982,0x6ac662a7,0x6aa651e4,
-0x39617b49,0x418249a2,0x83246a81,0x622551e2,0x5a244982,0x5a036aa6,0x49832060,0x498351a3,0x626651c4,0x942d5a25,0x836a9c6f,0x51a25182,0x51e351c2,0x5a245a24,0x62666a65,0x51e349c3,0x5a245204,0x51e349a2,0x5a043920,0x51a349a3,0x496259c3,0x62655a04,0x6ac75a45,0x59c37286,0x51e251c0,0x51e372c8,0x5a2651e3,0x51e36246,0x310028c0,0x5a255a04,0x5a246a86,0x38e05a04,
-0x83086204,0x7b08a44f,0x93aa7a86,0x8b8a8b8a,0x83497b08,0x83698349,0x83096224,0x6aa69bce,0x49827b28,0x72c78328,0x72c87b08,0x5a246aa6,0x62856245,0x62238baa,0xa40e72c5,0x8b8b7ae9,0x72c77ae8,0x5a034141,0x6aa76245,0x394072ea,0x28c030e0,0x52045a67,0x83ec4183,0xbd73ad11,0x9c2cbd31,0xb4f1acad,0x9c2dcdb3,0x7b28940b,0x7b2759e2,0x8b6aa42e,0x49616a87,0x51c44982,
-0x6ac772e8,0x30e03101,0x18004160,0x72e86227,0x6245838a,0x62466245,0x49a26246,0x5a245a04,0x51e351c3,0x390038e0,0x62445a01,0x8b897286,0x51c28baa,0x732872c6,0x624472a6,0x83497ae7,0x7b0772c6,0x624372a6,0x626672c8,0x62445a44,0x6a856265,0x5a246265,0x5a245a24,0x62675a04,0x10003102,0x18801880,0x39631860,0x51c44143,0x416149e5,0x416228c0,0x39214142,0x6ae86286,
-0x418349c5,0x49a33962,0x72a851a2,0x5a018b4a,0x730730e0,0x940c7b67,0x52034181,0x83692060,0x8b478b48,0x83488b48,0x8b488b89,0x62667286,0x28e130e0,0x00003121,0x08210000,0x10600800,0x20e10840,0x29213143,0x39833162,0x29223143,0x104020c2,0x29230800,0x29030800,0x28e21000,0x20a049e5,0x20a01840,0x39834184,0x41a449c5,0x41836288,0x944e3121,0x41e35225,0x4a063941,
-0x28a01840,0x626530e1,0x59e28347,0x72a751e3,0x838551e3,0x38e193e9,0x51c44161,0x498351e4,0x72e74982,0x834951c3,0x10007308,0x49606a45,0x5a0459e3,0x5a045a24,0x72e86224,0x51e35204,0x520451e3,0x20403921,0x414130c0,0x498349a2,0x7b095a05,0x59e55a25,0x62865204,0x51e472c8,0x62864161,0x51e3a46f,0x49c349a2,0x41815a04,0x62655a44,0x62655a45,0x5a246266,0x62246245,
-0x834a93ed,0x7ae7832a,0x93ab7285,0x83278b89,0x72c68327,0x7ae772e6,0x836b6a44,0x6264a48f,0x62446a85,0x72a66224,0x51a26244,0x51a372e6,0x72e75a23,0x7b297b69,0x6a25836a,0x7ac88308,0x5a2472c7,0x73096a86,0x8bac6246,0x62259c2f,0x51e45285,0x6aa862a6,0x62e762a4,0xad307baa,0xacefbd72,0xb4f0bd4f,0xacf0b531,0xb4d1acd1,0x624472c8,0x83076244,0x62646266,0x9c0b51c2,
-0x49818b8b,0x41213900,0x51827b4a,0x628659c3,0x836a9c0d,0x51c46265,0x5a0549a3,0x51a36a66,0x72c851c2,0x59e37b09,0x834b72e6,0x72c66aa5,0x51e37b08,0x7b0851e1,0x6aa66a85,0x62656247,0x7b077286,0x59e46225,0x624572e8,0x62455a03,0x6a866a86,0x6a8772c7,0x72c85a03,0x39006245,0x18811000,0x18a218a1,0x39420800,0x62674102,0x4983834c,0x28a049a3,0x49a349a4,0x72ea72e9,
-0x59e451e5,0x39014962,0x7ae87b08,0x83087ac8,0x8bca9beb,0x10007307,0x51e65223,0x49a24182,0x8b8993ca,0x8b488b69,0x7ae693a9,0x624572a5,0x310230e0,0x00003142,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x10a20000,0x20e30000,0x00002922,0x00000000,0x20a13123,0x41833942,0x522641c4,0x52055a65,0x5a471020,0x39a64a45,0x41c320c0,
-0x49c428c0,0x31004183,0x49a349c3,0x49a259e3,0x62235a24,0x7b2a38e0,0x498051c3,0x62663941,0x49415204,0x6a846224,0x51c25a03,0x5a2551a3,0x6a866245,0x62456265,0x62455a04,0x49825204,0x39213940,0x41836a88,0x41614183,0x51c45205,0x49833901,0x20201800,0x59e34121,0x72c872c8,0x6a87a44f,0x20804181,0x49824161,0x49e472c8,0x62246a86,0x520351e3,0x5a434161,0x62656284,
-0x832a93cc,0x72a68349,0x72867285,0xcd93834a,0x93cca44e,0x73097b09,0x836a8bac,0x7ae893ec,0x6a876a87,0x6a677b09,0x59c4938c,0x93ab5a23,0x6a655a03,0x6aa772e8,0x72a68bab,0x6a666224,0x62657b08,0x6a865a24,0x72e86a86,0x41207b4b,0x52255245,0x62873941,0x18204184,0x28c21000,0x9c0b6223,0x5a456ae6,0x940d6ac8,0x8bcca48f,0x5a247b08,0x5a248369,0x5a266aa6,0x62466246,
-0x72a86245,0x202072c8,0x72c88bcd,0x49c36a45,0x498230e0,0x59e46245,0x5a055a05,0x62466a66,0x51c36225,0x72a659e4,0x7ae87b07,0x7b086aa6,0x72c67b08,0x7b296243,0x6aa57286,0x62648b8a,0x72c672c6,0x622351a1,0x51c47b29,0x59e372c6,0x6aa66a86,0x7ac86245,0x7b096244,0x51e36245,0x10002880,0x00000800,0x310120a0,0x6aa851c5,0x414272ea,0x6a875a25,0x41625a05,0x520649c4,
-0x39215a66,0x28803900,0x9c0d93cc,0xa42c9bec,0x83aa8b8a,0x30e0838a,0x51e42080,0x49c24161,0x8b8993aa,0x83279beb,0x83288327,0x72c78327,0x29013941,0x000018a0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31430000,0x18805268,0x100028c1,0x28e13142,0x41843122,0x18803945,0x184028c0,0x39a40800,0x39833142,
-0x39631820,0x30e06aa8,0x52045a25,0x5a2459e3,0x51c23920,0x51e451a2,0x180051c4,0x414230e0,0x51c36287,0x52044982,0x51c36aa7,0x5a246245,0x62655a24,0x62446244,0x51e36265,0x30e03921,0x51c349c3,0x7b2951c4,0x28c049e4,0x5a2530e0,0x49a35a45,0x31014163,0x51e34162,0x49a328c0,0x5a2551e4,0x49a35204,0x392051e3,0x62a74181,0x390051e3,0x49c230e0,0x49c251e3,0x62446aa6,
-0x832872e7,0x62646224,0x72a56a63,0x940a8388,0x49a128c0,0x41206244,0x5a246a44,0x416049c3,0x51e25a03,0x626451e2,0x59e35a03,0x7ae972e7,0x832972c7,0x93ec72e9,0x6a86836a,0x59c37307,0x6aa66a86,0x5a4372e7,0x73086264,0x49825a45,0x6ac85a88,0x6ac849c3,0x6a8841a0,0x62473922,0x73291040,0x7b287b28,0x6a6672a7,0x7b495a66,0x6a6659e3,0x7329836a,0x392030a0,0x626449a1,
-0x6a856246,0x38e06a66,0x83ac62c9,0x730851c4,0x5a2441a0,0x6a667b09,0x51e46a86,0x5a256245,0x51e26246,0x6a466a84,0x51c07b08,0x83696a86,0x418072e7,0x72e86a85,0x626372a6,0x5a2272c7,0x83496242,0x7ac76a45,0x72c76226,0x72c76265,0x72e75a04,0x7ae872e8,0x72a76a85,0x6a866aa6,0x182059e4,0x10201000,0x20803101,0x62886247,0x30e03942,0x41836266,0x49a43922,0x52053941,
-0x5a033100,0x41626246,0x83ab7b29,0x8bab940d,0x7b6a9c2d,0x4120836b,0x49604101,0x38e03900,0x93aa8b69,0x93898307,0x8b69b48d,0x83288327,0x31224142,0x000020c0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x184010c2,0x20c10800,0x080020a0,0x730b3103,0x20a05227,0x31403982,0x20803100,0x08000800,0x080049e5,
-0x20a02080,0x51e46ac8,0x5a2549a4,0x5a2451c3,0x52044161,0x38c051e4,0x41412860,0x49845a26,0x62876ae9,0x8bed5a25,0x6a67732a,0x5a236225,0x5a236285,0x51e25a43,0x392051e2,0x28c04141,0x41626247,0x49c43920,0x394149e4,0x520430e1,0x52255204,0x49c45225,0x49c449e5,0x51e45a45,0x416249a2,0x5a2551c5,0x51e44181,0x5a4651e5,0x5a0349c3,0x418151e3,0x7b4a6ac7,0x51c2bcf0,
-0x6a646a64,0x83aa8327,0x6aa68369,0x416072e6,0x8369ff98,0x5a2528a0,0x52047308,0x31003940,0x73086266,0x6aa64160,0x62246a65,0x39005161,0x6aa630e1,0x72c76a86,0x5a045a24,0x7b0a5a25,0x6ac79c2d,0x6a666245,0x8bcd7b2a,0x394151e3,0x41c349e4,0x290049e4,0x59e451e2,0x286059e2,0x83496aa6,0x6a858369,0x6a666265,0x93cb8b8a,0x72c772c7,0x5a046aa6,0x62656a45,0x7b294141,
-0x51e36a86,0x72a75a05,0x72e838e0,0x51e46287,0x49a23920,0x6a665a04,0x624551e3,0x6a666245,0x51c26265,0x8baa6a66,0x6aa66aa5,0x628551e3,0x72c66aa6,0x62655a03,0x7ae672c7,0x51c16243,0x5a236a85,0x83486243,0x6aa772c7,0x72c872a8,0x51c26a65,0x7ae86a66,0x6a856aa6,0x72a672c7,0x39426246,0x18201020,0x49c53142,0x41634184,0x394230e0,0x49c45205,0x418349c4,0x41615a24,
-0x5a451800,0x51e27b09,0x5a2651e3,0x9c2e8bac,0x628651e4,0x8b6a72e9,0x7b294142,0x30e13941,0x8b687308,0x93898b69,0x9beb9c0b,0xa48e8327,0x392251e5,0x00001040,0x00000000,0x08200000,0x00000000,0x00200000,0x00000000,0x10201000,0x41422060,0x418330e1,0x00000800,0x29021860,0x29031080,0x39a40820,0x20e06b2a,0x31003940,0x52265204,0x20a051e4,0x18601840,0x10201000,
-0x28c11000,0x31004183,0x7b2a5204,0x836b6ac8,0x498349a3,0x6b091820,0x7ae94982,0x51e34141,0x62876aa7,0x49a35223,0x5a046a87,0x5a2451e2,0x836972a7,0x5a2449c2,0x30e030e0,0x72e85a46,0x49a428c0,0x418351c4,0x52054183,0x49c33942,0x39214141,0x52043962,0x52254183,0x5a465a46,0x5a444182,0x28e041a2,0x41a15224,0x39404181,0x6a8749c3,0x520449c3,0x39625225,0x41806286,
-0x72c772a6,0x62236ae7,0x5a248348,0x7b287ae9,0xa46e6aa5,0x6ac7836a,0x6aa73921,0x20404160,0x7b4a6aa8,0x5a0451e3,0x62867b2a,0x93cc9c6e,0x8beda40e,0x8bcc8c0d,0x7b4a7b6a,0x624451e4,0x7ae98329,0x7b286a86,0x7b2b6265,0x51e472c7,0x29213962,0x39a35247,0x51e53141,0x18205224,0x49a16245,0x62445a04,0x6a866245,0x7b286aa6,0x6aa772a7,0x834a8349,0x626472e8,0xb4d0834a,
-0x5a2551e4,0x5a046225,0x30e16225,0x5a23838b,0x59e451e4,0x72e85a04,0x6a8672c7,0x51e46245,0x62466aa7,0x72c65a24,0x6a856a86,0x62856ac5,0x5a025a24,0x59e36243,0x6a676aa6,0x51a272a7,0x7b086264,0x8b8972e6,0x5a235a01,0x62667b28,0x6a6659e3,0x52015a03,0x7b285a03,0x7ae76a65,0x73086a85,0x18211000,0x08004185,0x31215a46,0x20204163,0x51c44141,0x5a465205,0x30e15a05,
-0x72e85a06,0x5a037aea,0x28a051c4,0x31223120,0x49c35204,0x49c45205,0x942d5225,0x62a78c0d,0x93cb4183,0x93a993a9,0x93899389,0x8bcb8b48,0x31025a25,0x00000820,0x00000000,0x08000000,0x00000000,0x18201000,0x20401020,0x49e44962,0x51e44981,0x62466287,0x5a035a45,0x28e24162,0x20c10000,0x398439c5,0x7b8c18a1,0x41825204,0x41a15a44,0x41845a46,0x312220a0,0x28c041a3,
-0x41623942,0x52253100,0x41833941,0x73295a46,0x39623921,0x62046245,0x72a751e2,0x49813920,0x41406247,0x49a251c3,0x41404160,0x62656245,0x62666266,0x28a049c4,0x30e151e5,0x41625a25,0x498351c4,0x31014162,0x49c43101,0x49a31840,0x30e03901,0x28c04182,0x41a23961,0x418249c3,0x31203100,0x49e33961,0x28c049c3,0x41625204,0x416251e4,0x628649c3,0x20805224,0x62855203,
-0x834a8349,0x7b078349,0x59e26a85,0x6a644980,0x59e36a85,0x83494982,0x622572e8,0x20406225,0x5a675205,0x49c36265,0x93ed72e7,0x7308940d,0x73087307,0x6a86836a,0x6ac87b08,0x7ae96286,0x59c46245,0x62236224,0x93cc72e9,0x418372e8,0x41c43162,0x18803143,0x188020c1,0x10401020,0x41a120a0,0x626551c3,0x62655a24,0x6a866286,0x8b6a6266,0x62866a86,0x6265836a,0x72e76244,
-0x72e86ac7,0x51e46a86,0x41826aa8,0x72e89c0f,0x49636266,0x8329836b,0x7b086a87,0x49a26266,0x62456244,0x7b0751c2,0x72c66264,0x7b296244,0x62448369,0x72e75a03,0x62256265,0x6a866aa7,0x5a243960,0x7b296265,0x520272e8,0x72e772e7,0x62037328,0x5a246223,0x7b0872c7,0x62656aa6,0x62667ae8,0x18401820,0x41a41000,0x18401020,0x41835205,0x39616ac8,0x20602080,0x414259e4,
-0x5a2472e8,0x72e86a88,0x20806265,0x41631020,0x31214183,0x39415204,0x18203960,0x29013941,0x836820a0,0x7ac58b69,0x8b686a41,0x83088327,0x31006a87,0x00000000,0x28c10000,0x28c120c1,0x08000800,0x49c428a0,0x414251e5,0x49a351c3,0x5a266266,0x62466267,0x62666246,0x100051c2,0x5aa91881,0x08000800,0x49e5734a,0x51e328e0,0x49a25204,0x52263962,0x28e01840,0x312328e0,
-0x49c449c6,0x39631820,0x52253100,0x522541a4,0x62454162,0x51e451e4,0x62665203,0x49817b2a,0x6ac86287,0x41616287,0x41604981,0x51e45a85,0x52045a24,0x416228a0,0x286030c0,0x206072e9,0x208049a3,0x5a264983,0x41623963,0x310128c0,0x41a36266,0x28c04162,0x4a2539a2,0x49c449e4,0x49e43941,0x49a249e4,0x41a249c3,0x20a049e4,0x52053921,0x41813961,0x83ab41a2,0x41814181,
-0xb530d634,0x83298348,0x7ae88349,0x6a868bab,0x72e76ac6,0x7b295a66,0x30e05a45,0x6aa76245,0x62455a45,0x838b838b,0x8bab72e7,0x6ac79c0d,0x8bab6265,0x6a86836a,0x7ae86266,0x6a457286,0x72a66243,0x9c0e93ed,0xacae7b29,0x39621820,0x31632900,0x39842902,0x10811880,0x000018c1,0x106020e2,0x52044183,0x41615203,0x72c75a24,0x5a246286,0x5a256245,0x49826aa7,0x626551e3,
-0x5a4551e4,0x72c851c3,0x41615a06,0x628693cd,0x51a35a45,0x72c70000,0x6a866244,0x62656245,0x8b6b72c6,0x51c24981,0x7b289c2c,0x626451e3,0x51c15203,0x72c86a86,0x5a046245,0x62666a86,0x5a44836a,0x5a235a44,0x5a236a86,0x62436a86,0x730859e4,0x7ae88369,0x6aa76265,0x62657b07,0x62446aa5,0x100028e0,0x31220800,0x7b2a1840,0x72e96288,0x51a251e5,0x59e54121,0x41834121,
-0x52046266,0x416149c2,0x49c46aa7,0x30e15205,0x6aa85a46,0x838d4183,0x31203141,0x944e7b28,0x7b4918a0,0x8b688389,0x8b488b68,0x7b088b68,0x28c17308,0x20600000,0x28a02880,0x28c02080,0x206030c0,0x41823920,0x49a351c3,0x51e451e4,0x62656aa7,0x6a8649a2,0x5a256266,0x49a36286,0x108018c1,0x08000000,0x29201020,0x41815203,0x49c251e2,0x28e03100,0x10003101,0x10201020,
-0x18403101,0x28e13923,0x20a01820,0x49e53101,0x626651e5,0x5a454182,0x51e45a44,0x628783ab,0x5a05834a,0x39014942,0x83ab6a87,0x52043921,0x5a4549a2,0x416228c0,0x30c04121,0x5a2630e0,0x288049c4,0x28c03922,0x522520c1,0x5a674183,0x52263983,0x28e220c2,0x4a0618a0,0x41c43943,0x28a04182,0x312049c3,0x41834181,0x49c43101,0x182049c4,0x28e049c4,0x396349a3,0x394249a3,
-0xeed672e6,0x7ae6ac6d,0x8b698328,0x83687b09,0x8b8a8bab,0x6aa67ae8,0x73297308,0x59c26287,0x18406a86,0x830651e1,0x6ae76224,0x6ac75a45,0x7b098b8b,0x6ac77b2a,0x6a867b29,0x72c851c3,0x204072a5,0x73074962,0x30c06a85,0x41a428e0,0x28e22080,0x10602922,0x00000000,0x21030820,0x10601040,0x41e43183,0x5a255a45,0x5a456245,0x62666265,0x626662a7,0x72c85a66,0x6265accf,
-0x624572e7,0x62466245,0x6a8751e4,0x5a056266,0x6a866aa7,0x41636265,0x51c06266,0x6a666244,0x6aa65a04,0x6a857b29,0x8b8a6245,0x626572a7,0x6a675a45,0x6a666aa7,0x31007b08,0x62675a43,0x62435a24,0x62866ac8,0x62865a67,0x62656222,0x72e86aa6,0x72a772e8,0x62646244,0x7b287b28,0x6aa76aa7,0x18207b09,0x10200820,0x49a349a2,0x49e54183,0x49814981,0x51e330e0,0x28804162,
-0x39415a45,0x51e36286,0x5a466265,0x52042060,0x49a35a25,0x6ae94184,0x7b8b83cc,0x20a05225,0x49e61860,0x83896285,0x7b278bea,0x7b2a8368,0x30e27b09,0x18201821,0x392030e0,0x5a465a45,0x72c86ae9,0x62865204,0x418151e4,0x5a246267,0x626472e7,0x5a045203,0x6aa651e3,0x6aa76286,0x08000820,0x4a072080,0x39810800,0x52245a44,0x52035224,0x49a34162,0x28a03942,0x20a10800,
-0x49a41880,0x49c54983,0x100020c0,0x28a028c0,0x5a6551e4,0x62a6838d,0x28a049c2,0x628649a1,0x49a26246,0x938c6244,0x5a4559e5,0x52045204,0x28605a27,0x414130c1,0x59e54981,0x41625a46,0x51e44162,0x20a03962,0x41a24163,0x20801880,0x102020a1,0x08001020,0x52473143,0x29011880,0x4a263161,0x5a881860,0x310083cd,0x416228e0,0x28803900,0x184041a3,0x732a6ac8,0x204028a1,
-0x8bec93cb,0x8baa93ca,0x6a657b08,0x7b467b28,0x7b0672e7,0x62025a03,0x51a26a23,0x6a866a44,0x93cb6aa6,0x00002000,0x41821820,0x6aa76265,0x730872c8,0x6a866aa7,0x7b298b8b,0x72a772a7,0x83297ae9,0x73084100,0x52046266,0x394241a3,0x20c041a4,0x28a22901,0x52480000,0x00001881,0x00002944,0x62c831a4,0x52245a66,0x62655a25,0x5a256286,0x5a455204,0x51e55a25,0x49c35a25,
-0x62456a86,0x5a0549a2,0x72c85a46,0x5a256266,0x6aa66266,0x6aa851e3,0x6a878369,0x51e27b08,0x6a866265,0x7b088b6a,0x6a858369,0x62456265,0x62447b08,0x5a256a85,0x52056225,0x626649e2,0x49a26a66,0x520372e7,0x622472e7,0x83485a44,0x834972e7,0x62256225,0x5a2372a6,0x72a67b07,0x72c66244,0x5a456264,0x10000820,0x5a2528c0,0x6ac972e9,0x412272c9,0x51c572e9,0x6a8772e9,
-0x52043941,0x83695204,0x49c46286,0x416351e5,0x41820800,0x186028c0,0x20801860,0x00005a88,0x29030800,0x310228c1,0x836b72e9,0x73087308,0x28616ac7,0x5a4528a0,0x62665a45,0x51e36246,0x5a045a04,0x5a455a04,0x62876265,0x62655a23,0x520251e4,0x6ac76285,0x72c75a45,0x6ac77308,0x10202040,0x398449e5,0x18a01081,0x52243940,0x52035a45,0x416251e3,0x20804162,0x100028e0,
-0x39421841,0x10003920,0x20a049a6,0x31015225,0x39212080,0x7b4928e0,0x41600800,0x5a4528a0,0x72e76a87,0x418230e0,0x51e46aa7,0x30e06286,0x5a042040,0x49a35a25,0x30e049a2,0x41434182,0x31021840,0x39630800,0x208149c6,0x39421860,0x00003164,0x20a00800,0x10400800,0x08000000,0x08004a06,0x5a875a87,0x52251880,0x20a02080,0x20804183,0x41a46ae9,0x62664183,0x39603940,
-0x9c4e93cb,0x8bcb93ec,0x8b497ae7,0x62838ba9,0x62468348,0x838993cc,0x73096286,0x72e99c4e,0x7ae7a46e,0x72858308,0x2020a4b1,0x7b0930e0,0x6aa66287,0x72e87b48,0x6a886246,0x8b8a832a,0x8b4a8b4c,0x49c36224,0x41a25a46,0x49c420a0,0x080041a5,0x41667b6e,0x736d3944,0x00000000,0x10a20000,0x31639490,0x49e42080,0x5a0451e3,0x5a4549c3,0x52255a66,0x51c45204,0x5a045204,
-0xeeb672c6,0x41425a04,0x52055a25,0x8bab5a46,0x51c372e8,0x62676a85,0x62646245,0x5a265a25,0x72c772c7,0x6aa672a8,0x624472e6,0x5a455a23,0x5a0272e7,0x624551c1,0x6a886245,0x52035223,0x72e759e4,0x62246a65,0x6a656203,0x626562c6,0x72c68348,0x62456a85,0x5a2349a2,0x72e77b28,0x7b076264,0x7b4a72c8,0x10010800,0x51e428c0,0x41824163,0x624528a0,0x498151c2,0xacb04983,
-0x5a665204,0x5a0449c3,0x49a449a2,0x62675205,0x51c66288,0x08411000,0x00000000,0x08200000,0x18601020,0x49e43962,0x20a128c0,0x10201822,0x49c31840,0x5a2372e6,0x62885a04,0x51e26246,0x624559c1,0x62656286,0x62655204,0x6aa66a87,0x62646265,0x6aa76245,0x62656aa6,0x6aa76aa7,0x080059c3,0x28e13101,0x18602943,0x522449c2,0x49c25203,0x41425a25,0x39423921,0x41a43943,
-0x49c43142,0x51e651c5,0x28e04141,0x41a249e4,0x20823962,0x180028c0,0x5a063942,0x834a3100,0x72a66aa7,0x18402040,0x8bab1000,0x49c15a04,0x30e03941,0x5a056244,0x41614983,0x182030e0,0x28e328e3,0x31632944,0x20c01040,0x29013124,0x00211881,0x10201880,0x39c320e0,0x39831860,0x20c10800,0x28e16b28,0x520520e0,0x080020a0,0x6ae93142,0x10001840,0x39413120,0x30e049a3,
-0x93886a43,0x83488348,0x72a58b69,0x8baa8bab,0x838a8b8a,0x93ec942d,0x72a57b07,0x72c56263,0x9bea6223,0x18008348,0x3921b4d0,0x72e8838b,0x72e87b4a,0x73097b29,0x836b7b49,0x5a245a24,0x7b2a7ae8,0x41824981,0x5a667329,0x520551e4,0x62a75205,0x41845205,0x1040838d,0x00000000,0x00000000,0x5aa92103,0x28e07349,0x51e44182,0x520451e4,0x416249c3,0x41824183,0x41624162,
-0x41616245,0x836a8baa,0x5a055a05,0x5a266266,0x41625a46,0x39414982,0x49a249c3,0x62666ac7,0x62445a23,0x6a866265,0x6aa66265,0x72c88ba9,0x62446245,0x7ae88349,0x72e85a03,0x626551c3,0x6a865a24,0x83696245,0x72e76a86,0x62445a23,0x7b286a85,0x52026244,0x62436aa7,0x62456aa6,0x72c76a65,0x6a6572a6,0x20404983,0x51e43942,0x412149c4,0x39414983,0x5a2551e4,0x51c43921,
-0x41a36ac8,0x49c24181,0x39013940,0x394228a0,0x31003101,0x28806aa6,0x30c038e1,0x20a11060,0x312128c0,0x310049c3,0x18603100,0x6aa84183,0x6aa66aa7,0x62865a45,0x62866266,0x6aa66245,0x72e872c8,0x5a246266,0x5a2351e2,0x62865a24,0x5a456265,0x62866245,0x62466ac7,0x6aa76aa7,0x5a676ac7,0x002018c1,0x10401840,0x49c33961,0x416051e3,0x39204981,0x41614182,0x49a43941,
-0x520528a0,0x62675a67,0x49e45a27,0x398249a4,0x520549e5,0x41415a46,0x30c03921,0x30c149a1,0x30c03900,0x30c01800,0x5a667b6a,0x51c46ac8,0x72e95a45,0x51e349a4,0x8bac4183,0x392028c0,0x28c028c0,0x182020c0,0x18a128c1,0x00000000,0x00000000,0x29010800,0x102020c0,0x10405ac9,0x29424207,0x20c10840,0x20e20820,0x6b2b2941,0x08207bac,0x28c00800,0x49a341a3,0x28e041a3,
-0x49409c0c,0x7b0793a9,0x83488349,0x8b8a7b28,0x7ae56aa7,0x8baa7b06,0x93ab72a6,0x72a793a9,0x59e17b07,0x41209c0b,0x8328bcf0,0x72e8a44e,0x93cc93ed,0x72e85205,0x83ac838a,0x6a857309,0x6a875a04,0x51e36245,0x5a67730a,0x394249e4,0x8bed28a0,0x28c151c5,0x00001020,0x00000000,0x00000000,0x39a60000,0x39a40000,0x5a4528c0,0x49c251c3,0x52053940,0x416249c4,0x52044983,
-0x31007b6a,0x8b8a3940,0x49a35a25,0x49a349a3,0x5a255a25,0x49a35a05,0x6aa73921,0x62646a86,0x6aa76225,0x6a655a04,0x8b8972c6,0x72e651e3,0x7ae872c6,0x72c76246,0x6a8749a1,0x5a0472a7,0x5a246aa6,0x7b296245,0x7b0872a7,0x62256a85,0x7b086a86,0x62648349,0x62647b09,0x5a236264,0x83086224,0x72c67b07,0x20608347,0x5a254962,0x416230e0,0x39624121,0x6ac88bcc,0x41816287,
-0x18403101,0x62a86287,0x30c07b6b,0x62873902,0x20203942,0x726551e2,0x6ac672c7,0x310030e0,0x39613940,0x41a220a0,0x62866ac6,0x5a455a66,0x73085a44,0x62866aa7,0x62866265,0x62666a86,0x62666a86,0x5a255a06,0x6aa66286,0x5a245a45,0x6aa73941,0x6aa66286,0x62866a87,0x6a866286,0x20807b09,0x00000000,0x20c11020,0x39203961,0x49613940,0x498251c3,0x41813940,0x30e26287,
-0x10204163,0x28c20800,0x18204143,0x080020a0,0x312328c0,0x49631820,0x18206246,0x59e54122,0x28604141,0x51e44124,0x49a349c4,0x392151e4,0x080049c3,0x394220a0,0x49e6ad11,0x18002880,0x10401000,0x00000000,0x00000820,0x00000000,0x00000000,0x31231060,0x08003143,0x41c60800,0x18c00000,0x39840000,0x39c42901,0x08401060,0x08201060,0x28811821,0x41a328e0,0x39413941,
-0x8b6a9bec,0xa46e8baa,0x8b8a7285,0x72c78b8a,0x8b897b07,0x72c66a85,0x6a656244,0x93ec8b8a,0x72a57307,0x7ac672a6,0x834972c6,0x5a044962,0x72c86a86,0x6ac77b4a,0x72e86aa7,0x7b4a72c7,0x6aa66aa7,0x52266266,0x41625a05,0x41834183,0x20a13921,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31420820,0x41822060,0x31003100,0x41824183,0x49e441a3,
-0x394149c3,0x49826a67,0x41614962,0x59e441a2,0x5a0572c8,0x62a85a26,0x5a246ac8,0x6aa67308,0x6a8672c7,0x62447b08,0x7b086265,0x72e772c7,0x59e36aa6,0x6a656224,0x6a466224,0x5a036a86,0x51c26aa5,0x83694161,0x6a857b08,0x6a6572a6,0x72a66223,0x83496244,0x62456266,0x62445a24,0x93cb5a04,0x7ae78308,0x49838b8b,0x414251c4,0x418351e4,0x628651e5,0x51e55a25,0x49a34982,
-0x496151c4,0x28c030e0,0x49c12040,0x28c0c571,0x308028c1,0x7ac751a3,0x7ae66224,0x72c67b07,0x51c330e0,0x62657b28,0x62657308,0x5a455a24,0x62656265,0x52046286,0x72e751e3,0x51e251e3,0x520349e1,0x49a251e3,0x5a2572e7,0x5a456aa7,0x62666246,0x62646265,0x498251c3,0x49c351e2,0x28c03900,0x00001000,0x31011841,0x49a24162,0x49c449c3,0x394049c3,0x49c24161,0x18205a45,
-0x41634183,0x28811820,0x08001820,0x28c01860,0x392149c4,0x206051c4,0x20601800,0x39013921,0x414230c0,0x20204163,0x18004143,0x41824162,0x288028c0,0x08001000,0x31010000,0x28c03102,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x10200800,0x000020c2,0x08000840,0x000018a1,0x18c12903,0x00001060,0x08000800,0x08000800,0x18411040,0x498351e4,0x396130e1,
-0x7ae7ac8d,0x93ab6a44,0x8baa9bcb,0x8b698b8a,0x6a648348,0x6aa46a43,0x8b8a7b07,0xa46e6224,0x62237b28,0x9c0c7b28,0x93ab72a5,0x30e08369,0x7b0972e8,0x6aa77b29,0x6aa76286,0x7b2a7308,0x5a045205,0x9c8f7308,0x416251c3,0x5a673983,0x000049c5,0x10820000,0x3163734c,0x00005268,0x00000820,0x00000000,0x00000000,0x00000000,0x28e02060,0x184020c0,0x41623120,0x49e449a3,
-0x52263963,0x180049a4,0x496130c0,0x51c42840,0x412130e1,0x6ac951e5,0x72e86aa8,0x52045204,0x72c76265,0x62656aa7,0x7b287b28,0x626572e7,0x62446264,0x5a046223,0x72a75a04,0x6a856224,0x62668b8a,0x51a172c7,0x5a036223,0x7b0772c6,0x624372c5,0x6aa751a1,0x83497b08,0x59e451e3,0x62656a86,0xac6d7b08,0x5a2493cb,0x59e43900,0x9c0e5a25,0x51e56a88,0x62853900,0x41627b49,
-0x5a0549a3,0x41826aa6,0xacce3922,0x49636266,0x93a930e0,0x7ae68b68,0x8b6972a6,0x940c93ec,0x72c78349,0x7b287308,0x6aa67308,0x416151e3,0x6aa66ac7,0x72e86a86,0x72e86ac7,0x51c16aa6,0x62666285,0x51c26264,0x6a865a03,0x62466246,0x5a446aa7,0x5a456286,0x30e03100,0x62655223,0x5a255a25,0x18a12061,0x49c41820,0x39413900,0x49c36245,0x49e13940,0x51e35a24,0x39425a45,
-0x30e13101,0x41631820,0x20804984,0x18403120,0x39211000,0x41822060,0x41002020,0x41205a04,0x62476a67,0x18002860,0x39012040,0x41c33100,0x28c03942,0x08203163,0x00004184,0x28a01000,0x18602060,0x08001000,0x08000000,0x08201020,0x08000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x10000000,0x18600800,0x39822901,0x20803100,0x28c02880,0x28e030e0,
-0x8b699c0b,0x7ae67ae6,0x83078328,0x83077ae5,0x7ae67ae7,0x83487aa5,0x38c04961,0x7b077ac6,0x6a446a85,0x72e75a24,0x72c649a2,0x51a483ab,0x834a6244,0x72c86ac8,0x73096205,0x62646aa6,0x834a7308,0x9c4f5a25,0x41412880,0x39634a04,0x10200800,0x00200000,0x52050820,0x49e51000,0x000018c2,0x00000000,0x00000000,0x00000000,0x00000000,0x28e00800,0x416228e0,0x310049c4,
-0x10411020,0x49832061,0x49202080,0x728582a7,0x51a34940,0x41a33141,0x5a4649e5,0x6ac862a7,0x6ac76286,0x626572c7,0x62246a65,0x622372c6,0x59e359e3,0x7ae872a7,0x62037ae8,0x6aa66223,0x72c672a7,0x6a8572c5,0x6a2361e2,0x72c67285,0x83697307,0x6aa57308,0x62665a45,0x62866245,0x626572e8,0x520249c1,0x30e07b27,0x49604140,0x5a255a05,0x28c04141,0x28a06a87,0x51e46266,
-0x6aa751e4,0x5a05836a,0x41811800,0x51e35a24,0x72a572e6,0x72e67b07,0x83497ac5,0xa46e940c,0x72e78389,0x62667b49,0x62656aa6,0x52035a44,0x5a455a04,0x6aa75a45,0x51e26ac7,0x6aa76285,0x62855a24,0x62866a87,0x628672e8,0x5a6662a7,0x5a665a45,0x52255225,0x72e96286,0x62866286,0x5a256a87,0x204030e1,0x39413944,0x49a24183,0x520349c2,0x49e251e2,0x5a6641a1,0x100051e5,
-0x414228a0,0x51e43921,0x28c03941,0x18204182,0x39002060,0x39003920,0x38e030a0,0x5a2530c0,0x38e151c3,0x414130c1,0x6ac830e0,0x52244183,0x31444184,0x08000000,0x31231000,0x310162a8,0x28a028a0,0x18201000,0x18202040,0x10001000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x20801840,0x418128c0,0x49a349a3,0x39004161,0x49814960,
-0x8b698348,0x8b6a8b6a,0x938972a6,0x8bca838a,0x83078369,0xac8d82c6,0x9bcb8349,0x72e77ac6,0x72e77b07,0x7b077b28,0x5a236a86,0x836b6aa6,0x5a254181,0x7b2a732a,0x5204838a,0x5a627b28,0x6aa751e2,0x8c0c6aa8,0x10003942,0x10405245,0x31443142,0x000028e3,0x73081820,0x41624182,0x18603943,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x10600000,0x41e618a1,
-0x100041c5,0x10001821,0x182030a0,0x7aa38263,0x6a636a21,0x41833100,0x49a349e4,0x62875205,0x6a8728a0,0x6a856244,0x62447b07,0x7ae76a85,0x7ae87286,0x6a456a85,0x6a447ae8,0x7b286a85,0x6a856a64,0x93aa72c6,0x72c66aa5,0x6aa672c6,0x73087b08,0x5a246ac7,0x51e451e4,0x5a2451e3,0x51e351c4,0x5a2572e8,0x51c34161,0x6a2451e3,0xeeb793ec,0x41626245,0x72c73900,0x412030e0,
-0x20600800,0x62862880,0x52045204,0x52036287,0x83278348,0x83688b89,0x93eb6a42,0x93ec940c,0x83498389,0x72e76ac7,0x5a245a45,0x41604160,0x5a456286,0x62866286,0x62666286,0x62876285,0x5a456ac7,0x5a455a25,0x6ae86286,0x62866286,0x5a666286,0x5a255a45,0x5a465204,0x5a256246,0x6aa75a45,0x38e041a3,0x498259a3,0x49c24120,0x49a151e3,0x49c251e3,0x41a34182,0x30e228c2,
-0x392230c1,0x72ea4162,0x41632040,0x6ac928a0,0x2040cdd5,0x390030c0,0x6a663900,0x72c84983,0x080028a0,0x39224143,0x49e528a0,0x182028c0,0x10412081,0x20c00000,0x312020a0,0x10003941,0x20801840,0x28c03121,0x10201840,0x18001000,0x08001000,0x00000000,0x00000000,0x00200000,0x00000020,0x00000000,0x18200820,0x28a01840,0x310041a2,0x834a6266,0x62836aa5,0x940d83ab,
-0x9c4ba40c,0x7b068329,0x8b8a8349,0x938993aa,0x83278308,0x6aa572a4,0x9c0a49a1,0x9c0c9c0a,0x7b0893eb,0x7b486223,0xa44e59c3,0x51e372a8,0x414151c2,0x6aa86245,0x9c2c5a45,0x6aea836a,0x62a77b6b,0x93ec49a3,0x5205940d,0x10600800,0x8c2d2900,0x1000bcb0,0x18000800,0x61a36227,0x5a667b2b,0x080038e2,0x00000000,0x10000001,0x08001041,0x00001040,0x00000000,0x00000000,
-0x396328e2,0x29011000,0x08001000,0x82a56aca,0x72657aa6,0x49e50800,0x49c449e5,0x6ac73962,0x52055205,0x62457b4a,0x7b086a64,0x6a648309,0x83288306,0x83297ae7,0x72c77287,0x834972c7,0x7ae67285,0x72e8838a,0x83696aa6,0x83ab8bab,0x5a441820,0x940d51e4,0x41a25224,0x49c34182,0x7b0849a3,0x49c36266,0x49a451c4,0x62465a25,0x31225a04,0xee594121,0x49a049a2,0x49614961,
-0x180072c8,0x6ac849c4,0x628751e5,0x51e35a66,0x83678b68,0x72e58326,0x93ac6ac3,0x8bec8bcb,0x6ac77b29,0x62466a87,0x51e36266,0x7b096265,0x72c87308,0x52046286,0x6aa75a45,0x5a456286,0x7b496245,0x62866286,0x5a456286,0x49c351e3,0x5a465224,0x520562a7,0x628749e3,0x51e35204,0x52045a25,0x6a836267,0x4160c4cb,0x51e25a24,0x5a245a44,0x51e351e2,0x104041a4,0x30e25a69,
-0x28a028a0,0x310030e0,0x51e449a3,0x28a02080,0x51c31840,0x498149a2,0x6a864141,0x51c438e0,0x72ea72c8,0x39231820,0x18401820,0x28c02080,0x18421000,0x30c028e0,0x41621840,0x7bac39c3,0x314283ad,0x10203160,0x308220a0,0x18202860,0x10011000,0x31222060,0x100020c0,0x10001821,0x10001000,0x20801000,0x39413941,0x396028e0,0x49c23960,0x72e56aa4,0x7b277b06,0x5a048b4a,
-0x93ab7286,0x9c0b93cb,0xa44c9c2c,0x8b699beb,0x8b6882e7,0x7ae78b48,0xddf293a9,0x8b6993a9,0x83487ae7,0x9c4d51e2,0x9c4e72a7,0x72e772c7,0x49622880,0x626651c3,0x93ca6286,0x72e86225,0x6aa74162,0x51e46266,0x41835a46,0x10402903,0x6ac82901,0x5163934b,0x82a69307,0x49210800,0x28406a26,0x08008bcd,0x10610800,0x00000000,0x18600800,0x00000000,0x00000000,0x00000000,
-0x31430000,0x00003101,0x20a21040,0x41420800,0x7a8382e6,0x28e149a1,0x39423963,0x5a676287,0x5a675a66,0x5a455246,0x6aa67b28,0x6a8572c7,0x72c76202,0x72a56a65,0x62456a64,0x7b087ae7,0x6a8572e7,0x7b088baa,0x41623940,0x10203942,0x49a241a0,0x184049c4,0x628620a0,0x49e43941,0x51c349c3,0x49c349a3,0x49a372e8,0x51e46aa8,0x628751e4,0x6a664141,0x624659e4,0x7ae86224,
-0x7b296a87,0x288049a3,0x72e8834a,0x52046ac8,0x83478b69,0x73068327,0x7b086ae5,0x72e88bec,0x62866aa7,0x62866aa7,0x7b496266,0x72c8836a,0x6ac76266,0x51c46246,0x52046266,0x62865a45,0x5a455a04,0x5a456286,0x51e45204,0x49e351e4,0x49e441a2,0x626751e4,0x49c149c3,0x41813100,0x5a0451e3,0x9c085203,0x3920ac6a,0x52034982,0x51e35203,0x49a25203,0x080028e1,0x6aa93964,
-0x28c05204,0x20603941,0x206072ea,0x30e05a25,0x51e33901,0x414072c7,0x498251c3,0x30a03921,0x39224983,0x20602880,0x10001820,0x20801000,0x10010800,0x392128c0,0x20a03921,0x39a25226,0x49e449e5,0x51e449e3,0x41803100,0x416030c0,0x39212080,0x31203120,0x28c028c0,0x28a03920,0x18201820,0x20401800,0x51c230e0,0x49a049c1,0x6ac58388,0x6aa46aa4,0x7b276aa4,0x20202880,
-0x6a639348,0x93ab7b27,0x93eb93ca,0x83088b49,0x7ac69bca,0x8b699beb,0x93889388,0x82e67285,0x82e69388,0x940db4cf,0x7b2a72c7,0x5a046a85,0x51e36246,0x6aa659e4,0x51c230e0,0x38e02060,0x72a76a65,0x49a351e4,0x51e45a25,0x41c63965,0x93cb3123,0xa3689b4a,0x6940c4d0,0x62054121,0x30c030c0,0x734a6a68,0x20812060,0x00211040,0x28e21000,0x08000820,0x00001060,0x00000000,
-0x10610000,0x18802080,0x00000820,0x08000820,0x29205aa8,0x20802920,0x51e65226,0x52065206,0x5a4662a8,0x49e44a26,0x62665a26,0x6aa57308,0x8b696a43,0x8b4a7b08,0x72a67ac8,0x83288b69,0x49c36286,0x30e04161,0x39225a25,0x28c16268,0x416128a2,0x10005205,0x18401840,0x28c03941,0x41624161,0x394149a3,0x51e45a05,0x49c351e5,0x520549e4,0x51e559e4,0x49a24982,0x6ac86aa7,
-0x6ac64182,0x496251a2,0x418338e0,0x41835a46,0x93cb7ae8,0x7b6893aa,0x62a47b4a,0x73298bec,0x72e872e8,0x62466ac7,0x72e86a87,0x730872e9,0x6aa76266,0x7b096aa7,0x51e46ac7,0x626551e3,0x5a456266,0x49e45a25,0x51c349e4,0x52045a04,0x49c441a2,0x49c44183,0x6ac841a2,0x51e35204,0x5a455a24,0x9c4c7ae9,0x5a2328a0,0x520351e3,0x51e34160,0x6aa549a1,0x18613122,0x394220a0,
-0x39213921,0x39604162,0x39414161,0x31013900,0x49a2ac90,0x392051a2,0x39002880,0x49814981,0x28a03920,0x30c04162,0x286128a0,0x10001800,0x08003923,0x392128c0,0x31213121,0x39203120,0x41804160,0x7b064981,0x93ab8367,0x51c08baa,0x51e14140,0x414051e0,0x498049a2,0x390051a0,0x49a03920,0x59c44160,0x38e03900,0x59e16242,0x72c46242,0x73057b05,0x41406aa5,0x416328a0,
-0xabccfffd,0x83078b07,0x7b077b08,0xa42c938a,0x83689bea,0x8b687ac5,0x93aa9c0b,0x8b49bcce,0x7aa58308,0xa42ea40c,0x6a6593aa,0xb4d07b09,0x6a666267,0x6aa74962,0xbd515225,0xac4ebcf0,0x5a256245,0x62676226,0x396372e9,0x39434184,0x49e628e2,0x8ae81800,0x82669307,0xbc8ea3ea,0x83496a86,0x5a886247,0x18606287,0x00000000,0x10600000,0x20c20000,0x082018c1,0x00000000,
-0x18600000,0x20c10000,0x31231040,0x10001860,0x31431000,0x08000800,0x49c51040,0x6ae95206,0x6ae95a47,0x49e46288,0x5a4651e4,0x62665205,0x7b2872e7,0x838a72c7,0x41427b09,0x49833942,0x62664163,0x51e43900,0x28c04162,0x49c41000,0x288030e1,0x49a43921,0x392049a3,0x5a056267,0x30e06245,0x416151c3,0x62663921,0x416151c3,0x41a25a45,0x41825a04,0x6aa751e4,0x6a875a45,
-0x49614941,0x38e04982,0x41624100,0x41643900,0x51e320a0,0x72e76aa6,0x6aa66aa6,0x7b0849a1,0x62866ac7,0x6ac76ac7,0x62a76aa7,0x6ae87b49,0x5a457308,0x52256286,0x52256ac7,0x5a256286,0x5a255a45,0x6ac762a7,0x49a349c3,0x52256266,0x39415224,0x49c23120,0x62c85245,0x5a044181,0x7b296ae9,0x392049a3,0x5a445a25,0x49a351e3,0x59e35223,0x62a95204,0x08003964,0x4a051840,
-0x310049c4,0x5a253940,0x41422060,0x49a23901,0x49833901,0x28a030a0,0x52043921,0x49a32040,0x49a34121,0x416230e0,0x20804142,0x6ae85a25,0x10006ac8,0x30e03920,0x30e12080,0x52233120,0x5a224160,0x83267304,0x5a218325,0x62219c2b,0x7b246a82,0x7b248345,0x83458b66,0x7ae37ae3,0x8b668325,0x83468b87,0x83678b67,0x7b478327,0x72c672c6,0x28a06264,0x394130e0,0x41623920,
-0xffffffff,0x93abfffe,0x832a834a,0x8bab8b8b,0x93cb8389,0x8b88936a,0x93eb93aa,0xac8c93ec,0xb4af72c6,0x93a97ae8,0x72a659c3,0x9c2dbd31,0x51c251c4,0x51a36a46,0x836b49a3,0x59e4b4b0,0x51e46a87,0x7b496225,0x20803101,0x28e21860,0x52271000,0x61a251c3,0x93078b27,0x38809327,0x41831840,0x18203122,0x41224962,0x418459c5,0x00000000,0x00000000,0x10600800,0x00000000,
-0x00000000,0x290120c2,0x08000820,0x18201020,0x08001840,0x10001040,0x20a00800,0x52264a05,0x49c55226,0x5a665206,0x52056ac8,0x4a2551e4,0x7b4a3962,0x62477309,0x51c451e5,0x520549a3,0x31013922,0x31012040,0x49a349a3,0x30e028c0,0x182030e0,0x28804162,0x49c230e0,0x51e55a46,0x49c35a05,0x5a0451a3,0x30e04162,0x49c428c0,0x39623101,0x49a34963,0x41624162,0x28c05a05,
-0x51a24982,0xd5f728e0,0x40e141a1,0x41615984,0x41824141,0x7b4a4182,0x5a425a45,0x6aa66ac6,0x62866aa7,0x5a455a66,0x62866ac7,0x6aa762a7,0x6aa66ac7,0x6ac76aa6,0x5a666266,0x6a876ac7,0x5a455a04,0x626649e4,0x5a455225,0x49e46266,0x51c449e4,0x51e351e3,0x5a256265,0x7b2a6aa8,0x49c33962,0x39203920,0x49a25203,0x5a254181,0x51c25a23,0x20805a23,0x29430000,0x39621860,
-0x39421840,0x39212060,0x416249a3,0x41612880,0x51c42040,0x30a03901,0x418230e0,0x412151e4,0x18004121,0x49a24962,0x72e851e3,0x7b2a5a46,0x39205a46,0x28c03940,0x31202060,0x41813100,0x72e349a0,0x7ae47303,0x7b036a82,0x83458325,0x7b248b86,0x83038b65,0x83248344,0x83468b66,0x8b668305,0x834693a7,0x83458b67,0x72e67b06,0x49a17306,0x41404981,0x51824120,0x18003100,
-0x52266287,0x62444963,0x83497b08,0x836a7b08,0x7b289c0c,0x8b6893ca,0x93a959e2,0x8b8a8327,0x8b699beb,0x59e193a9,0x83077285,0x83297ae8,0x834aac4e,0x51e46a86,0x5a265a26,0x6aa75a46,0x72c89bec,0x62a86225,0x49848bac,0x31032081,0x18404184,0x28801820,0x7a6372c5,0x82a25120,0x6aa79c4e,0x6ac772c8,0x62466a87,0x51e55a27,0x106051e6,0x08410000,0x20c01040,0x10201060,
-0x00000000,0x28e20000,0x00001860,0x10001040,0x10001840,0x18601020,0x10401840,0x626762c9,0x49c45205,0x6aa85a46,0x62a87b6b,0x5aa85a87,0x524739a4,0x49a551e6,0x5a264163,0x62676267,0x522628e1,0x394149c3,0x41823940,0x51e33922,0x6aa751c2,0x31014983,0x49c42080,0xf6f972e9,0x49a2bd6c,0x626549c2,0x28a03941,0x49a41840,0x49634163,0x28a051a4,0x52033100,0x31004982,
-0x49814141,0x30e04981,0x41414162,0x62676a66,0x41614163,0x41a23900,0x62865204,0x6ac76ac7,0x6aa86ac8,0x6aa76286,0x62456266,0x522472c7,0x5a0549e3,0x49e26aa7,0x39606aa8,0x62655a24,0x62a75225,0x49c35a66,0x520451e4,0x49e45225,0x416141a3,0x392151e4,0x6ac76266,0x39416aa6,0x5a243941,0x41603920,0x312049a1,0x418141a1,0x51e35222,0x31645a66,0x41c40820,0x000020c0,
-0x20602080,0x31003941,0x41623941,0x202051a3,0x39211800,0x39014162,0x49c351e3,0x28805a45,0x30e051c3,0x51e451c3,0x206051e5,0x39004162,0x28a03900,0x51e34141,0x28e03120,0x51c05202,0x7ae37ae4,0x8b6572a1,0x83248b66,0x83248b85,0x83248345,0x834493a6,0x8b858b65,0x83258325,0x83259be8,0x62418325,0x72e48b46,0x5a247b07,0x5a0451c3,0x28a051e3,0x496249a3,0x30e11800,
-0x72c66a86,0x8bcb5a44,0x834a834a,0x49827b08,0x7b07a42d,0x83698349,0x93eb7307,0x93ca93eb,0x6a856a85,0x938b93cb,0x836a8b8a,0x83288329,0x93cc72c6,0x20408b8a,0x39634163,0x41835206,0x7b4a62a8,0xde365a25,0x62a85a67,0x392241a3,0x0800732a,0x5a046247,0xc50838c0,0xdd05d525,0xbd0deded,0xa44c1800,0x4983ddf5,0x51e549a4,0x6a676247,0x000062a9,0x10200000,0x10201040,
-0x00000000,0x31230000,0x18810800,0x10200820,0x102028e2,0x20813103,0x00001020,0x52060820,0x5a266ac8,0x49c46ac8,0x62876ac8,0x31425246,0x41a541e5,0x00001000,0x49a44183,0x394351e5,0x28e049c4,0x49c42080,0x5a253920,0x30a051e5,0x838a49a3,0x49c451c4,0x49c45225,0x30e03941,0x30c128a0,0x414230e0,0x28a04983,0x5a454983,0x72c77b49,0x49a46245,0x626751c4,0x49a34142,
-0x30e051e4,0x49813900,0x6aa77b08,0x28a049c3,0x41613941,0x394149a2,0x49a23100,0x6aa76aa6,0x6ac75a45,0x6ac76aa7,0x62866286,0x5a455a45,0x62665204,0x62666286,0x41625a24,0x5a255a04,0x5a255a66,0x5a6649e4,0x62666286,0x51e451e4,0x51c351e4,0x6a866a66,0x8bab7b08,0x41604181,0x49a25203,0x52045205,0x49c23920,0x51e24181,0x6ac75a44,0x08000800,0x080028e1,0x28e149c4,
-0x5a675a47,0x28c02080,0x72c730e1,0x390151a2,0x5a056246,0x5a044142,0x41614982,0x286049c5,0x38e13921,0x496230c0,0x41622040,0x41214983,0x41814962,0x390028a0,0x51e24160,0x83048367,0x6aa16a81,0x93878b66,0x8b658324,0x7b037b03,0x7b037b03,0x8b467ae3,0x83448344,0x7b048345,0x8b668325,0x93e98325,0x624472c6,0x20603900,0x41213900,0x390038e0,0x41414141,0x310028a0,
-0x62866a86,0x624451e4,0x73298bac,0x8baa8b89,0x73092880,0x8bac9c6e,0x93ec72e6,0x7b088b8a,0xa44d8349,0x8b698329,0xacaf8b89,0x7ae7a42c,0x93cc8b69,0x41417b09,0x49e51880,0x41c420c3,0x6aa87309,0x49836a87,0x5a664183,0x52053982,0x10005a07,0x49a31000,0xac2472c6,0xdd29e5ab,0xac47d569,0x28407284,0x49625a05,0x51e43920,0x5a255a27,0x6aa87b4a,0x20200000,0x08200800,
-0x00000800,0x18810001,0x39243944,0x10401840,0x18600800,0x18601000,0x08002081,0x29650800,0x59e55225,0x520551e5,0x836b6267,0x41c349c4,0x186041c5,0x182020a1,0x184028a0,0x18202080,0x00002902,0x416330e1,0x5a054183,0x30c028a0,0x51e35a24,0x49c34142,0x310049c3,0x416251e4,0x51e43921,0x51e45a26,0x6ac851e4,0x49a34183,0x62454983,0x59e449a3,0x498351a3,0x41636ac8,
-0x416251e4,0x41624182,0x39414182,0x51c35a24,0x41626245,0x41a33941,0x310051e4,0x52044182,0x72c86aa6,0x5a4572e8,0x72e86ac7,0x6aa66aa8,0x62466a86,0x62466aa7,0x6ac76aa7,0x62665205,0x5a455a45,0x52045a66,0x5a055205,0x49c35a05,0x518249a2,0x83ab72e8,0x52048b8b,0x30e04140,0x41614180,0x49c372ca,0x49a26266,0x49a151e3,0x41626266,0x31214184,0x6ae920a0,0x08005247,
-0x28a028c1,0x41822060,0x7308838a,0x51c48349,0x41626246,0x51c349c3,0x394149c4,0x39006245,0x41424163,0x51c33901,0x41424181,0x394051e4,0x392049a2,0x49825a03,0x72a45a02,0x7b048324,0x83258345,0x834593a7,0x72c38b65,0x62406240,0x83448364,0x8b659388,0x8b668b66,0x8b468b24,0x7b468365,0x30e05a22,0x52043920,0x49a25202,0x41615a04,0x624559e3,0x30e06a85,0x49823920,
-0x5a2472e7,0x51e26245,0x51a15180,0x6a867b29,0x7b286266,0x51e25a45,0x93ec5a44,0x8baa72e7,0x6a6672e7,0x8b4b6243,0x83299bec,0x83498349,0x8b8b8b8a,0x61e393ec,0x49844923,0x52256287,0x49845a26,0x39216246,0x49c43962,0x6ac82901,0x62686a87,0x39225a47,0x8b8b59e4,0x6a01b46c,0x7aa35940,0x518051a0,0x414038a2,0x5a0551c4,0x5a466266,0x41416ae8,0x08405a26,0x30c11860,
-0x08201840,0x10000800,0x39443103,0x292328c2,0x18410000,0x10201020,0x10001840,0x00000800,0x520549e6,0x62676267,0x41a47309,0x10004163,0x5a2649a5,0x30c151e5,0x100051c5,0x41635205,0x5a4728c1,0x28c01820,0x30e05205,0x31013100,0x62663920,0x5a665a04,0x49c35a66,0x49c34983,0x31003941,0x51e449a3,0x628751e4,0x498262a7,0x41425a25,0x51c449a3,0x51c351a3,0x49834983,
-0x39213921,0x49a33921,0x39213901,0x30e06266,0x5a2530e0,0x39623100,0x28e05a66,0x416128c0,0x62665a24,0x5a457308,0x5a2372e8,0x5a245a62,0x5a256265,0x62665a25,0x62466266,0x5a666aa7,0x51e449c3,0x396149e3,0x51e349c3,0x520449c3,0x838b6a87,0x5a4683ac,0x49c249a2,0x41604981,0x49a249a1,0x49c26aa8,0x49c249a2,0x49c351e3,0x396049c3,0x00001040,0x52270800,0x28a01000,
-0x418330e0,0x100051e4,0x30e11820,0x20605a27,0x20801840,0x41423941,0x31003940,0x51a330c0,0x6a283081,0x28402020,0x5a451840,0x28c051e4,0x416128a0,0x498049a2,0x83256a84,0x83468346,0x93a78325,0x93a78345,0x8b658325,0x7ae28323,0x83058344,0x832493c6,0x7b058345,0x83468345,0x49a15a23,0x41415a03,0x310051e4,0x30c03901,0x5a0451e3,0x41403900,0x498151e3,0x49a23940,
-0x628672e8,0x30e06a86,0x9c4d41a1,0x93cca44e,0x7b077b09,0x28c072a6,0x7b285201,0x9c0c5a45,0x8bab8b8a,0x6a858348,0x62226241,0x7ae7ac6d,0x93ab9c0c,0x73079bec,0x100028a0,0x6ae949a2,0x72c862a8,0x39016aa7,0x186028c0,0x6ae90000,0x6a676aa7,0x5a066246,0x5a656266,0x72e872c8,0x82e95940,0x8b09a40d,0x49412840,0x62675a06,0x52054182,0x734b5205,0x5a046287,0x08211020,
-0x10221000,0x20812060,0x39441000,0x316341a5,0x31233123,0x28c21000,0x08001840,0x00001020,0x4a050820,0x62675a67,0x73096ac8,0x41411840,0x5a264140,0x30e16267,0x39633902,0x18604183,0x62473923,0x39425a26,0x49a32060,0x49a34181,0x5a0530e0,0x20604182,0x418249e4,0x51c34162,0x5a2449a3,0x49a349a2,0x628749e4,0x392149c4,0x41426266,0x59e459e4,0x41624962,0x414249a3,
-0x30e05a04,0x41823921,0x30e04162,0x49825a04,0x39416a66,0x28e06aa7,0x39411860,0x41613941,0x5a466265,0x62666a87,0x62667308,0x62856ac8,0x5a0549a2,0x51e45a25,0x51c46aa7,0x5a465205,0x52255225,0x39604181,0x49a15203,0x5a246285,0x4a2772ea,0x52040800,0x418049a1,0x49814981,0x5a0349a1,0x49c16267,0x5a246285,0x6aa85a24,0x31425203,0x420528e3,0x10001000,0x39212040,
-0x39624182,0x62a728e0,0x394151e4,0x20602880,0x28c028c0,0x49a330e0,0x18003942,0x51c34161,0x51805180,0x51e34960,0x416249c2,0x49c43921,0x100051e4,0x41605a03,0x93c86aa4,0x8b6793a8,0x83458345,0x93c88b86,0x72c28b67,0x83248323,0x832593a7,0x832472c1,0x83258325,0x49c08346,0x41414981,0x39414963,0x6aa849c4,0x49821000,0x39205a24,0x496051c1,0x49815a03,0x49c24180,
-0x6aa77308,0x9bec6a86,0x9c0d9c4e,0x7b088349,0x72c78349,0x72e77b08,0x51e351e3,0x18406286,0x732941a3,0x83478b8b,0xc5707284,0x10007b28,0x93edc572,0x72e87309,0x522572e8,0x7b4a51e4,0x62a8732a,0x08007309,0x18601860,0x5a6618c0,0x6ac7836b,0x6aa86a87,0x39026246,0x5a251000,0x8b697b28,0xac8f8328,0x288059e4,0x52055225,0x62865a46,0x49c328c0,0x6aa649a3,0x10205a67,
-0x20620800,0x18402081,0x08000000,0x41a53143,0x49a549e6,0x20805207,0x20a02080,0x10601880,0x00000800,0x5a4520a0,0x184020a0,0x418249c4,0x49c32040,0x208072e9,0x39024184,0x41426267,0x5a474142,0x49c44183,0x49a351e4,0x39415a45,0x5a2541a3,0x51e54983,0x520449c4,0x41826265,0x51e451e3,0x49a35a45,0x52045a25,0x49a35a45,0x49e430c0,0x41623900,0x498330c0,0x51e43100,
-0x5a054162,0x31005a25,0x62464182,0x416349a2,0x288049a3,0x418251c4,0x390249a3,0x41811000,0x6ae83922,0x73087308,0x73086ae8,0x5a455a24,0x62465a45,0x73085a45,0x52255a45,0x418249e3,0x418149a2,0x5a244181,0x5a665204,0x9c705205,0x31005246,0x41a341a3,0x49a12900,0x416051c2,0x5a444181,0x41816288,0x5a2451c3,0x49e34182,0x20803100,0x49a53943,0x20801020,0x10002080,
-0x52053942,0x10000800,0x31003962,0x39223922,0x41642060,0x392130e1,0x51c33900,0x49812860,0x51826a66,0x49a24962,0x390038e0,0x206059e5,0x7b283960,0x39404160,0x83058367,0x7ae472c2,0x83257b05,0x7b057ae3,0x93c893a8,0x7ae37b03,0x8b678b87,0x83457b03,0x390093e9,0x41603960,0x28c051e3,0x39405a24,0x72c849c4,0x30c049a3,0x6aa76266,0x496130a0,0x208028a0,0x418249a2,
-0x72e872e9,0x51e36a86,0x836972e7,0x7b087b28,0x832993cb,0x7b297b08,0x93cd6ac8,0x52255205,0x626620a0,0x62667328,0x49627309,0x940d62a8,0x72e95225,0x7b6b5a46,0x62a79c4e,0x6ae96ac8,0x62c87b4a,0x290128c0,0x312262a8,0x41c23181,0x73083921,0x5a255204,0x39645a26,0x39621860,0x18007308,0x83297ae7,0x28807ac8,0x5a4662a7,0x5a675a46,0x51e46ac9,0x6b094162,0x62266ae9,
-0x288051e5,0x206028c1,0x080020a1,0x39640861,0x28e241c5,0x522741a5,0x102041a5,0x18a11020,0x106020e2,0x00000000,0x396128c1,0x0800730b,0x52041820,0x314228a0,0x7b0a0800,0x39213902,0x51e54963,0x49c43101,0x31005a25,0x5a454983,0x7b2949c3,0x51e51000,0x41416aa7,0x7b2a51e5,0x30c051e4,0x6a8751e4,0x5a0551c3,0x28a049a3,0x7b4b6267,0x5a056a87,0x6aa651c4,0x5a254182,
-0x51e451e4,0x52044162,0x5a2551e4,0x310049a2,0x49a34161,0x498251a3,0x49844183,0x51e549c4,0x31011000,0x73086286,0x51c36ac7,0x62656286,0x5a255a25,0x62665a25,0x49e45a25,0x41404981,0x5a243920,0x49a34161,0x62876267,0x628828c1,0x182028e0,0x28c149a4,0x41603962,0x6a8649a0,0x52033920,0x52034183,0x51e459e5,0x5aa8836a,0x18803984,0x08001881,0x08000800,0x39431000,
-0x49e44183,0x41832060,0x39425206,0x30e03921,0x39014142,0x30e03901,0x51c35a04,0x7b295a46,0x410072c7,0x59e43900,0x6a8649a1,0x51e34981,0x28c04161,0x5a433920,0x83456a83,0x83058b88,0x72c27b23,0x93878b65,0x83468b66,0x72c272a2,0x93a67b04,0x72c48324,0x5a034180,0x416249c3,0x51e53942,0x418149a4,0x418149a3,0x51e54161,0x41436246,0x31201840,0x39403901,0x49a24161,
-0x62456245,0x51a259e3,0x6aa68369,0x7b288baa,0x838a7b08,0x9c2d7328,0x836a7b4a,0x08006aa7,0x31216ae8,0x52665aa7,0x7b6a5205,0x418228e0,0x52056ac7,0x52477b4a,0x52045aa8,0x5a66838c,0x62a9a4b0,0x6b0a5205,0x83cd3143,0x29001840,0xde97a4d0,0x93ed5225,0x4a0530e0,0x73296b09,0x30c07b09,0x836a28a0,0x5a047b09,0x62465a26,0x5a265a25,0x5a666246,0x628728c0,0x62877309,
-0x6a885a27,0x08002902,0x10400800,0x10403123,0x41850820,0x18604185,0x522651e6,0x294220a0,0x00200820,0x00000020,0x4a4620e1,0x00000820,0x00000000,0x49c53963,0x49a47b8c,0x41632080,0x6a874163,0x416351e5,0x8bad5a66,0x49a34182,0x51e44182,0x41824142,0x5a254162,0x51e451e4,0x49c56267,0x498351c4,0x51c45a04,0x49c349a3,0x59e449a3,0x49836245,0x498251e4,0x49634141,
-0x49a34962,0x51e44982,0x416251e5,0x49a451e4,0x414249a4,0x49a251e4,0x49a44182,0x49e34182,0x7ae830c1,0x6ae77328,0x73085a65,0x51e37b29,0x51e45204,0x49a25225,0x49c249c2,0x51c34941,0x49814101,0x41624982,0x00000800,0x62a81020,0x28a01020,0x080028e0,0x4a0428e2,0x62654982,0x49e249c2,0x31003100,0x520330e0,0x10404a05,0x00000840,0x10610000,0x20c30820,0x28c00800,
-0x392149c4,0x20804183,0x41613942,0x30c02040,0x49c35a25,0x51e44983,0x6ac73100,0x5a4572e7,0x49625a04,0x394251c3,0x49a251e4,0x394051e4,0x31005203,0x520241a1,0x7ae28367,0x7b048325,0x93878326,0x93a88b46,0x83448345,0x834593c8,0x8b658304,0x414072e4,0x51e249a1,0x39203941,0x5a255a25,0x49a24183,0x51c43920,0x51c54142,0x39204162,0x41a36aa9,0x31003940,0x20c03982,
-0x7b2972e7,0x7b6a7b6a,0x940d7b2a,0x7b0993cc,0x6ac87ae9,0x72e883ab,0x62885a66,0x5a675a67,0x62a85226,0x5aa841a4,0x73295a46,0x418251e4,0x206051e4,0x08003942,0x6aea5227,0x29011020,0x10000800,0x62885227,0x6aa96268,0x52033942,0x6ac830e0,0x49c63942,0x28c00800,0x940d6ae9,0x6ac949e5,0x312149e4,0x62678bac,0x62676246,0x5a264142,0x6ac86246,0x39426ac8,0x62875a46,
-0x730a6288,0x6aea6b0b,0x10602941,0x41c60000,0x41856b2c,0x5a485a28,0x49c51000,0x082062c8,0x00200000,0x00000000,0x00000021,0x31840000,0x08400000,0x28e20800,0x310228a1,0x416330e1,0x41435a06,0x49e55205,0x49c349c4,0x51c52060,0x41833101,0x51e44183,0x51e449a3,0x30c04983,0x52044162,0x51c44162,0x51e449a3,0x51e349a3,0x5a043920,0x51e451e4,0x49825a04,0x392172e8,
-0x49834162,0x39424141,0x49823942,0x49c349a3,0x51e43921,0x49c449a3,0x39414162,0x20203900,0x7ae86aa6,0x626562a6,0x6ac762a6,0x5a456ac7,0x6ac76265,0x51e45204,0x41624982,0x5a034981,0x28605a02,0x6ac83900,0x00000800,0x28c03163,0x290120a1,0x000020e0,0x00000000,0x49c35247,0x41604181,0x49c13960,0x49c35a23,0x18603983,0x00000840,0x00000000,0x29430000,0x208128e1,
-0x31215225,0x10001000,0x206049e4,0x49a33922,0x51e43100,0x30e051e4,0x72c85204,0x5a246286,0x288059e4,0x5a24c551,0x206051e3,0x5a454161,0x28803921,0x49c051e3,0x8b677b26,0x83257b05,0x7ae58b46,0x8b478b67,0x9c097b04,0x83669be7,0x62448ba8,0x39004160,0x41813100,0x39203960,0x41604181,0x30e049c2,0x31003900,0x28803920,0x30c130a0,0x310049c5,0x51e528a0,0x7b6a62a8,
-0x832b7287,0x620459e4,0xa42f6a87,0x20e03922,0x18602100,0x080039c2,0x28600800,0x18815225,0x10825248,0x52460800,0x5a8762c9,0x5a465225,0x39645205,0x49e641e6,0x002041e6,0x10600820,0x18a0734b,0x52263943,0x080020c0,0x6ac85246,0x5a445a06,0x51e46246,0x5a4649e4,0x5a675224,0x102062a8,0x5a463123,0x6aa75a86,0x72e86aa7,0x834a6266,0x5a256a87,0x41836287,0x312151e4,
-0x31023102,0x00001000,0x00000000,0x00000840,0x10610000,0x8c300800,0x41a43964,0x084020c1,0x00001881,0x00000000,0x00000000,0x20e20000,0x000020a0,0x10000020,0x00001020,0x30e12080,0x39015a26,0x49c449a5,0x5a0449a3,0x39424182,0x5a0651c4,0x5a056247,0x418251e4,0x5a066267,0x5a2551c4,0x41626aa7,0x51c45a25,0x51e55a04,0x51e449a4,0x622651e3,0x498393ac,0x41004941,
-0x30e059e4,0x20803901,0x39003102,0x39424162,0x30e05a47,0x392230c0,0x51a151e3,0x83698388,0x7b4993eb,0x73076aa9,0x6ac872ea,0x5a045a46,0x49c25a05,0x62865a45,0x49626aa6,0x49a14981,0x62454961,0x49a21000,0x184049c1,0x39842902,0x4a465205,0x00000000,0x00000000,0x41a40000,0x498241a1,0x49c24180,0x39825a25,0x08401061,0x31620800,0x39653143,0x28e15a46,0x310128c1,
-0x41623120,0x51e51840,0x5a254142,0x51e55a26,0x5a0451c4,0x49823921,0x41816246,0x51a251e3,0x49824162,0x49c251c3,0x418241a1,0x39406aa6,0x30c01820,0x49c051e2,0x7b056240,0x93a87b26,0x8b868345,0x834693c7,0x8365a44c,0x93c993c8,0x41826ac6,0x49c33100,0x49c33941,0x49a251e3,0x51e34982,0x416149a3,0x51a349a2,0x41a151c3,0x49853901,0x41605a05,0x20803980,0x18413101,
-0xfef8e676,0xd6188b2a,0xbd13de37,0x72aade78,0x40a27269,0x6a265945,0x38c059e5,0x41842040,0x00001000,0x4a070000,0x00003143,0x62c97bad,0x51e641a5,0x41c549c5,0x49e63123,0x20c20800,0x00000800,0x52475227,0x52273983,0x6ac86ac8,0x8bcc6267,0x00005a27,0x08000000,0x18803162,0x736c2923,0x41c41880,0x5a4662a7,0x28c05a45,0x6aa85a25,0x51a32880,0x62a749e5,0x394251e4,
-0x31221860,0x210428c1,0x29030800,0x39a55a69,0x08200820,0x08200820,0x20801881,0x18c241c5,0x00000000,0x00000000,0x00000000,0x29030000,0x08001880,0x00200001,0x08000800,0x41431000,0x28c15206,0x30e16267,0x51e54983,0x51c44142,0x49a33942,0x49836266,0x51e46266,0x51e44983,0x628649c3,0x5a2549a3,0x6aa74983,0x51e449a3,0x5a045a04,0x49a259e4,0x41614981,0x38c04962,
-0x41834962,0x182030c0,0x62a841a4,0x62a87309,0x62676aa8,0x49a428c0,0x8b884982,0x9c0c8b89,0x9c4d93eb,0x41e45286,0x4a245aa6,0x526641c3,0x08204a05,0x5a6720c1,0x30c15226,0x28a030e0,0x838b30a0,0x20409c2e,0x08003941,0x10614a27,0x00000000,0x00000000,0x08000000,0x00000800,0x49c239a1,0x626541a1,0x5a666aa7,0x10800000,0x10602922,0x08205268,0x39a420e1,0x39423101,
-0x39414182,0x49a341a2,0x49c351e4,0x416251e4,0x49a24982,0x51e328a0,0x49c26266,0x392051a2,0x394051e2,0x51e34160,0x41623940,0x39201800,0x496228a0,0x6ac34981,0x83457b03,0x8b878b87,0x93c8a42a,0x8ba89c0a,0x9be97b24,0x41208b89,0x51e35203,0x5a4549a2,0x5a244161,0x49a24161,0x39215204,0x49a249a2,0x49803920,0x39414980,0x836a51e4,0x6a885205,0x31004183,0x00001060,
-0xffffce15,0x9c0cffdd,0xe69aeeda,0xffffffff,0xf7ffffff,0xbcb2ffdf,0x522793cd,0x2040836c,0x4a073963,0x290139a3,0x00001040,0x00000000,0x00200840,0x08000000,0x20600800,0x08005a49,0x00000800,0x5ac91060,0x396362a7,0x6287732a,0x00006247,0x000020a2,0x00010000,0x39e518a0,0x00000000,0x00000000,0x73096ae8,0x52046266,0x62876266,0x62666266,0x62675205,0x730928c0,
-0x10003963,0x00201020,0x41a54a06,0x000020a1,0x29231880,0x526839a5,0x28c020c1,0x00003984,0x00000000,0x00000000,0x00000000,0x00000000,0x314262c9,0x00011081,0x08000000,0x18003123,0x31033944,0x31013943,0x51e530c1,0x51c44143,0x49a351e4,0x49c349a3,0x416251e4,0x28c049c3,0x6a873941,0x49c349a3,0x498351e4,0x5a244182,0x51c349c2,0x5a256225,0x41426266,0x41004962,
-0x39214121,0x31014983,0x18403943,0x20801020,0x416141a3,0x6aa76a87,0x8b686aa6,0x9c0c93ea,0x836a93ca,0x000010a0,0x4a470860,0x00000000,0x08000000,0x29230820,0x41652081,0x20a03102,0x39432060,0x31001820,0x08003920,0x00000020,0x00000000,0x00000000,0x08000000,0x00200800,0x41e10000,0x418149c1,0x10406245,0x000020c1,0x00000000,0x10800000,0x08200000,0x39621000,
-0x41825226,0x41413940,0x52044182,0x52034182,0x414049a2,0x49814981,0x310049a3,0x6a865a03,0x416049a1,0x28c051e2,0x31016266,0x28a07b2a,0x392051e4,0x72e44981,0x7ae47b24,0x93e98346,0x9c2a8ba8,0xa42b93c9,0x496038c0,0x5a0359e3,0x49c249a1,0x41824160,0x310028c0,0x418251e3,0x626549c3,0x5a244182,0x5a043920,0x28a230c0,0x08001000,0x41820800,0x10003941,0x28e13940,
-0x946fad12,0xfffff75d,0xffdeb513,0xffffffff,0xffffffff,0xf6b9ffdf,0x6ac8ff7b,0x30c151c5,0x41e52060,0x62a962c9,0x49e65227,0x18603984,0x5a8841a5,0x7b8c6aea,0x28c162a9,0x08000000,0x000039a5,0x00000000,0x00000800,0x00000821,0x08200000,0x00000800,0x00000000,0x00000000,0x7b6c1860,0x6b2a41e5,0x9c8f83ed,0x52257329,0x62875a66,0x62676287,0x49c45a47,0x62a76287,
-0x41a562a9,0x106028c1,0x00001860,0x20c01020,0x08003122,0x10200800,0x41a662a9,0x31613163,0x00001060,0x00000000,0x00000000,0x00000000,0x49c50800,0x31233963,0x000020c2,0x28a01040,0x08001861,0x30c20800,0x49a44143,0x498449a4,0x414249a4,0x41a34983,0x31013921,0x51e528e1,0x5a255204,0x5a2551c4,0x49c449c4,0x626651e5,0x520472c8,0x5a056266,0x49a34182,0x30c051c4,
-0x51e53941,0x39443121,0x080028c0,0x10001880,0x20c05205,0x6aa849e5,0x8bcb7b4a,0x6ae87b8a,0x28e24a24,0x00004228,0x00000000,0x00000000,0x10610000,0x42060800,0x310220c1,0x52051000,0x520528a1,0x520449c4,0x39434a01,0x00000000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x5a6541c2,0x39633141,0x00000000,0x00000800,0x00000000,0x00000000,0x39840000,
-0x62465226,0x51c559e4,0x498251e5,0x414149a3,0x49c34161,0x49c35a24,0x51e35a45,0x5a2451e3,0x41614181,0x39205a25,0x49c35203,0xe65851e4,0x416130c0,0x62626264,0x8b678345,0x8bca7b04,0x41618b89,0x62442020,0x6a634982,0x392072c4,0x41814161,0x418249c3,0x394049c2,0x49a24162,0x498151c2,0x41604140,0x49a24180,0x28a03942,0x18002060,0x6ae951e4,0x30e07309,0x20a028e0,
-0x52ca5acb,0x6b6c9491,0xfffff7de,0xd659ffdf,0xb4d3b535,0x9bee4965,0x72c86266,0x496349c4,0x41834143,0x4a072922,0x18603964,0x5aa95a88,0x524641e6,0x83cc41c4,0x5a6839a4,0x52464184,0x31421860,0x39853184,0x4a2739a5,0x52685aaa,0x52263162,0x20a03123,0x41c35226,0x62885a26,0x10203102,0x6b2a736b,0x39a35246,0x6aa749e4,0x5a4683ab,0x62a86267,0x526749c4,0x398362c8,
-0x210241e5,0x62c90000,0x08005a47,0x39223943,0x20401000,0x18402020,0x00001881,0x28e12922,0x29033984,0x00000000,0x00000000,0x00000000,0x52060000,0x41634184,0x39633964,0x08000800,0x08000000,0x412251c5,0x28803101,0x18203902,0x5a2528a1,0x31215a05,0x41834183,0x7b2b4164,0x6ac74182,0x5a066286,0x49a351c4,0x62865a46,0x5a2551c4,0x416251e4,0x72e87b49,0x5a0551a3,
-0x41433100,0x49a62080,0x28c26287,0x10003123,0x39621020,0x00002080,0x738c0000,0x18803984,0x52670000,0x00000000,0x20e20000,0x18c318c1,0x00000000,0x00000000,0x39230000,0x20800800,0x10003962,0x18603982,0x08000800,0x08001000,0x08000820,0x08000800,0x00000000,0x00200000,0x18800820,0x4a263141,0x18a20800,0x31640860,0x20a12943,0x082020a1,0x00000020,0x31840000,
-0x5a465226,0x49c351a3,0x52044182,0x51e449a3,0x51e35204,0x51c351c3,0x416251e3,0x49a249a2,0x51e33920,0x51e349a3,0x28a05a24,0x418128a0,0x62653941,0x7b055a03,0x93e97b46,0x20a06aa5,0x41614140,0x41406245,0x418251c3,0x41412060,0x31004141,0x28a03920,0x49c23941,0x51e35a04,0x41613900,0x416151c2,0x28a130c0,0x30e128c0,0x41825a05,0x100049e4,0x31011000,0x08004161,
-0x00000820,0x4248632c,0x18c239e6,0x08402102,0x94306b2b,0x6ac9732b,0x6287730a,0x52275a46,0x20803984,0x41c52102,0x314341e5,0x39c50000,0x5a8862ea,0x31220800,0x394320a0,0x41a45a47,0x62a862a8,0x00002081,0x00000000,0x49e79470,0x20e283ee,0x29001020,0x20402060,0x5a062860,0x6a476a47,0x00003942,0x52057b8b,0x28c041a2,0x52266288,0x5a876ac9,0x4a265a87,0x00200000,
-0x080020e3,0x00000000,0x4a063185,0x20205a47,0x49c549a5,0x5a053102,0x208051c5,0x18403122,0x31642922,0x08000800,0x00000000,0x00000000,0x00000000,0x31223985,0x39633922,0x394441a5,0x08000000,0x49a328a1,0x49843080,0x31221860,0x49c441a4,0x49c449a4,0x102049e4,0x49c428a0,0x59e528c1,0x51a34142,0x51e55205,0x626651e4,0x6a875a25,0x51e449c3,0x10000800,0x49a14161,
-0x41424162,0x182051e4,0x18201820,0x10200000,0x418441a4,0x106041e5,0x00001882,0x10000000,0x5a2349a2,0x08006ac9,0x00000800,0x08001081,0x00000000,0x00200000,0x51e51060,0x10003101,0x080028a2,0x18401000,0x10001000,0x08001000,0x08000800,0x00000000,0x00000000,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x08000000,
-0x520451e5,0x5a4549c3,0x49a35a25,0x628649a3,0x5a454162,0x49c33920,0x7b294982,0x49a249a2,0x51e34140,0x39204161,0x51e44981,0x30c030a0,0x416128c0,0x6ae549a2,0x5a4349c2,0x30e05a02,0x39003900,0x62864162,0x72e8b4d1,0x49a34181,0x51e449c3,0x39403100,0x72c73920,0x41813920,0x62863940,0x30c05a45,0x49e45a05,0x182020a0,0x28a128a1,0x418251e5,0x20a02060,0x208020c0,
-0x522820a2,0x08202103,0x318510a1,0x08200000,0x39c620e3,0x41e652a8,0x28c149e5,0x524749c6,0x290241e5,0x62ea3184,0x18801040,0x6b4b0820,0x4a060800,0x5a8762a9,0x5a675a87,0x6ac95a47,0x310228c1,0x20a23964,0x08200000,0x31430820,0x00000800,0x41620800,0x6a6693ca,0xb48e8329,0x7ae6a42c,0x93cc8b68,0x00004185,0x4a0520a0,0x39434a06,0x5a465a67,0x106062a8,0x00000000,
-0x00000000,0x00000000,0x08200000,0x41a50000,0x5a47de98,0x5a265206,0x5a2651e5,0x39424183,0x00000820,0x080018a0,0x000020e3,0x00000000,0x00000000,0x20a00000,0x28e13122,0x28e03122,0x20c13141,0x18403143,0x39433922,0x18400000,0x28a10800,0x39220800,0x394328a0,0x28c028c0,0x5a251000,0x414249a3,0x18203942,0x5a2530e0,0x416251c4,0x49a34182,0x39418bab,0x51e23920,
-0x49c45204,0x1000836a,0x18404984,0x30e149a4,0x30c130e2,0x000028e1,0x18400800,0x51c249e4,0x626472e7,0x18203080,0x08001000,0x00000000,0x00000000,0x00000000,0x49a40800,0x28814182,0x28e11820,0x18202081,0x18201840,0x10001000,0x18601820,0x310228e2,0x28e030e1,0x08002902,0x00000820,0x00000000,0x00000000,0x18610000,0x00000000,0x00000000,0x00000000,0x10200000,
-0x62454163,0x5a0549c3,0x52044162,0x416251c4,0x49823921,0x51e349a2,0x49c349c3,0x51e351c2,0x49a249a2,0x5a0451c3,0x416230e0,0x418228a0,0x208049a3,0x28a049c2,0x49c15a24,0x5a455a45,0x39005204,0x49a249c3,0x49c34982,0x49c34161,0x41a35a66,0x28c05a46,0x39203940,0x394049c2,0x41814180,0x30c03940,0x6ac96266,0x20e049a4,0x080028e0,0x18605205,0x39411840,0x28e128e0,
-0x00201881,0x10c12923,0x000010a1,0x29442103,0x21030000,0x10600000,0x39a52902,0x31844a06,0x526820c1,0x082020e2,0x8c2f0000,0x00003184,0x62ea5aa9,0x6aea6b2b,0x6b0a6ae9,0x62675aa9,0x080051e5,0x20c22903,0x102028e2,0x4a471080,0x52260820,0x9beb9c4e,0xa40dbcef,0x82c58b28,0x9bcb9bea,0x62238306,0x00001840,0x29445aa8,0x08400000,0x08000000,0x10001061,0x00000000,
-0x00000000,0x00000000,0x00000000,0x10a20000,0x41a50861,0x5a4651e6,0x5a066246,0x62466247,0x080049a4,0x41842080,0x082020c2,0x08400000,0x00000000,0x00000000,0x186018a1,0x290028e1,0x31423142,0x49c628e1,0x00000000,0x08000000,0x00001020,0x10000800,0x28a028e1,0x5a6862c9,0x7329836b,0x49a249c3,0x41625a26,0x51c44182,0x49a34982,0x39225a25,0x38e051a3,0x59e36244,
-0x20405a46,0x310149a3,0x30e14143,0x49634142,0x10004122,0x28602040,0x72e66246,0x72c78369,0x72c66a84,0x72e88b8a,0x6aa46aa6,0x18203901,0x184028c0,0x00000840,0x20811861,0x18203962,0x100030e2,0x28c028a0,0x28a028a0,0x392228c0,0x28c051e5,0x18400800,0x206028c1,0x08000820,0x08000800,0x10411000,0x00000000,0x00000800,0x10201020,0x00000800,0x10201000,0x20601000,
-0x39205a04,0x418249c3,0x39603940,0x20802060,0x49a130e0,0x49c45a24,0x49a351e3,0x6a8649a2,0x59e351c2,0x204051c4,0x30e130e0,0x30e05a25,0x30c04161,0x30e03921,0x39403100,0x394128c0,0x30e028a0,0x416141a3,0x39204161,0x396049a2,0x39413941,0x31004162,0x104020c0,0x41815a45,0x28e03961,0x28e02900,0x106028a1,0x00000800,0x00000020,0x29200800,0x31003941,0x18402060,
-0x080020a1,0x00000800,0x08201060,0x18a10820,0x31655aca,0x00000000,0x20e20820,0x31852903,0x08200000,0x29035269,0x082062ca,0x00005227,0x39a51020,0x7b8d734c,0x5a885a89,0x6aa95a88,0x39436288,0x29034a07,0x102020a1,0x080028e2,0xacd1bd75,0x7b286285,0x8b6993cb,0x8b047aa4,0x61c18305,0x20009c09,0x08401000,0x00001061,0x08200000,0x20c00800,0x00000800,0x00000000,
-0x08000800,0x10610000,0x00000000,0x00000000,0x00000000,0x49e61881,0x5a465a26,0x62466a88,0x20e06a88,0x31013963,0x31434163,0x10600000,0x00000800,0x00000000,0x20800000,0x18602080,0x20c128e1,0x08000820,0x00000000,0x00000000,0x18a20000,0x08000000,0x28a01820,0x39224164,0x41825205,0x30e030e0,0x49c32060,0x414251e3,0x49a34161,0x51e34162,0x59e24981,0x286030a0,
-0x39013921,0x30a130e1,0x28a01000,0x41423901,0x30e23901,0x41433922,0x7b076225,0x7b276264,0x72a66223,0x6aa672c6,0x6aa66265,0x7b086a86,0x62836265,0x000062a8,0x08000000,0x30e01801,0x310028e0,0x31003100,0x28e030c0,0x52045224,0x49c34182,0x18406287,0x20611820,0x20a01020,0x10201840,0x10000800,0x08000800,0x08001000,0x10011000,0x49e31000,0x49814961,0x49c24141,
-0x31004182,0x51c351e3,0x08002060,0x628649e4,0x31003100,0x41624161,0x520349c2,0x51e351c3,0x498149a1,0x51e54162,0xc5746aa8,0x49831840,0x49c42060,0x41815a25,0x18002880,0x182028a0,0x28e01840,0x41423921,0x39014183,0x28c030e0,0x100028a0,0x416330e1,0x08006aea,0x28e11000,0x08001020,0x00000000,0x20a120e1,0x20a01020,0x10400800,0x39012020,0x30e128a0,0x39411820,
-0x40e26a06,0x18803080,0x31240800,0x10612924,0x10a22103,0x73ae39c7,0x10819cf3,0x00001082,0x41e70820,0x18a241e7,0x10402103,0x29035248,0x08002923,0x00004a08,0x62ea18a1,0x732a62c9,0x5a6749e5,0x4a065268,0x52680000,0x6aea3965,0xac8f3965,0x8b8b6aa7,0xac6e8b4a,0x83479c0b,0x9beb9beb,0x836bb4ce,0x18a00820,0x20813984,0x28c31000,0x39231880,0x10401000,0x08201861,
-0x31430800,0x20a13123,0x08201061,0x00000000,0x00000000,0x00000000,0x41420000,0x52875a25,0x5a675a46,0x416241a4,0x208030e1,0x186020a0,0x18810000,0x00003985,0x08000000,0x106020c0,0x00000800,0x00000000,0x08200000,0x10600021,0x20c20800,0x00000000,0x100028c2,0x10003922,0x30c11840,0x41823122,0x51e46246,0x392151e4,0x496272a7,0x51e44161,0x41824182,0x520449c2,
-0x41425a05,0x20605226,0x28c02040,0x390030e0,0x41854984,0x204020a0,0x62444141,0x72e872c7,0x83487b07,0x6aa65a03,0x72c76a85,0x62856aa6,0x6a676ac7,0x000041a6,0x18600000,0x20802061,0x30e02060,0x51e33100,0x730751e3,0x396049c2,0x39613940,0x5a4549c3,0x49835a25,0x49a249a2,0x414128c0,0x626641a3,0x41a34182,0x49c249e4,0x5a045203,0x498249a2,0x72e851c3,0x5a044981,
-0x414151c2,0x39204142,0x52046aa6,0x62a6734a,0x49c16265,0x51e54982,0x41613100,0x49a293ef,0x59e54963,0x18202860,0x418128c1,0x28c151c4,0x10002060,0x5a265a26,0x3121732a,0x41833942,0x31014183,0x41623121,0x18414162,0x39421000,0x6b4b1040,0x5a483923,0x52262900,0x10001000,0x18211821,0x29011820,0x10411860,0x30e20800,0x51e44161,0x100049a2,0x39203920,0x418330e2,
-0x7a876a25,0x20806226,0x00001061,0x18601860,0x18c31881,0x42281061,0x83ef6b6d,0x0000528a,0x39a63986,0x08202924,0x62aa2923,0x00000000,0x00000820,0x18c10800,0x00000000,0x4a070000,0x5a695aa9,0x08400000,0x31641080,0x102062a9,0x6ac783ad,0x942c7b49,0x8b499c2c,0x7ae78328,0x93aa8b89,0x18008b69,0x10601020,0x31431880,0x18202060,0x10000800,0x080049a5,0x39641860,
-0x28c11861,0x20a11020,0x20c20820,0x000018a1,0x00000000,0x08000000,0x10610820,0x6a8641c5,0x5a476ac8,0x49c37b2a,0x394249a4,0x20601040,0x10001020,0x29221861,0x08210000,0x08200000,0x00000000,0x00000800,0x08003123,0x00000000,0x08000800,0x00000840,0x00000000,0x10201000,0x28c01000,0x41c44183,0x39423922,0x310149a4,0x49606244,0x30c04143,0x28a03921,0x100030e0,
-0x39214142,0x20405a47,0x41422860,0x51e42880,0x08001000,0x18200800,0x52046266,0x7b086a66,0x9c2c9c0b,0x7b2872c6,0x6a866244,0x7b2872c6,0x6aa56ac6,0x000049e4,0x10600001,0x28a028c0,0x49a23920,0x72e749a2,0x49c26264,0x39614161,0x31003960,0x310049c3,0x39414182,0x49823941,0x49a249a2,0x41623961,0x41803962,0x39203960,0x392049a1,0x626549a2,0x624551e3,0x49a23900,
-0x498251e3,0x416151c4,0x49e35a24,0x5a656b08,0x418149c3,0x41824161,0x5a2551e3,0x51a34183,0x49a23940,0x30e030e0,0x18404143,0x49c33940,0x28803100,0x30e04162,0x49a34162,0x5a054162,0x396249a3,0x392149e4,0x41c42060,0x41a44a04,0x10810000,0x10201020,0x18601020,0x41830800,0x208028e0,0x10001820,0x734a1861,0x5a27734a,0x18403100,0x30e02080,0x394049c2,0x7b292880,
-0x72857aa6,0x8b4a72c7,0x28404101,0x41643964,0x29232060,0x00000000,0x6b2c39e7,0x08005aca,0x08200800,0x20e31061,0x28e318a2,0x7b6c62a9,0x39c562a9,0x5a8939a4,0x00005aa9,0x000020c3,0x00000000,0x00200020,0x18a10000,0x18401840,0x49c220a0,0x08006264,0x5a021020,0x9bec7ae7,0x7b0793aa,0x28207aa6,0x18a00800,0x398339a3,0x39624163,0x5a665227,0x93ed6287,0x28c16247,
-0x20602060,0x28c21020,0x00003144,0x10200000,0x18611860,0x08001861,0x18401020,0x00001040,0x49c449c5,0x6ac76aa8,0x732972e9,0x186041c4,0x20601840,0x20602060,0x63484183,0x00000000,0x18a10000,0x31233144,0x39642080,0x08000800,0x08000800,0x00010000,0x00000000,0x21002101,0x08001040,0x20a03142,0x20a01000,0x5a2620c1,0x6a454980,0x208051e3,0x39213100,0x5a263901,
-0x41834162,0x5a261820,0x20602880,0x522651c5,0x10003123,0x08003943,0x522530e1,0x836a5a25,0x93cb7b09,0x7b27a44c,0x72e772e6,0x730772e7,0x52025a45,0x314118a0,0x394028a0,0x28c03120,0x52024181,0x5a237b48,0x41614160,0x394049c2,0x31003120,0x39625224,0x41813940,0x49c35a24,0x41824182,0x39613961,0x418241a1,0x51e25204,0x5a0349c2,0x5a0351c3,0x498251e4,0x626551c3,
-0x51c34981,0x41823921,0x49a15a04,0x41817348,0x51e528c0,0x31005a24,0x392030e0,0x62454181,0x498351e4,0x100049a3,0x392028a0,0x39624142,0x418228c0,0x49c349a2,0x41214982,0x182030e0,0x31012060,0x30c028e0,0x208049a3,0x10201820,0x08001020,0x00001080,0x39822080,0x39213941,0x41845225,0x6aec1000,0x7b0a83ac,0x204028c0,0x39212060,0x39213100,0x28c03940,0x49c13100,
-0x8b48ac4c,0x72647aa4,0xddf38307,0x204038c1,0x29230800,0x08400800,0x00400000,0x39c74249,0x62cb528a,0x00000000,0x294518e3,0x29230000,0x62ea5288,0x08007bad,0x62a86b0b,0x108149c5,0x18c20000,0x00000820,0x312328e2,0x08003964,0x522562c8,0x41208367,0x9bed30a0,0x5160cdd3,0x38e02000,0x62248b89,0x39414141,0x49c54184,0x39433963,0x5a473102,0x62675a47,0x62875a26,
-0x182049a5,0x29031820,0x290320a1,0x08000000,0x08000820,0x000020a1,0x28e10800,0x188020a0,0x52060000,0x520441a3,0x73087329,0x31216ae7,0x51e428a0,0x312141a3,0x31213941,0x000062e8,0x28c10820,0x28a01820,0x20801820,0x49e55205,0x208028e1,0x00000800,0x00000000,0x08001841,0x18401020,0x08002102,0x08000000,0x10202903,0x184051c4,0x39423101,0x312128e0,0x28a051e4,
-0x51c54142,0x418259e4,0x20802080,0x18603102,0x5a267329,0x20a149c4,0x51e53982,0x836a6aa7,0x93eca46f,0x832893ca,0x6ac77ae7,0x6aa66286,0x62666286,0x62466266,0x39203921,0x624451e2,0x52036244,0x49a151c2,0x49a251c2,0x39413920,0x394149c3,0x41825a45,0x49a251c4,0x51e349a2,0x41825a25,0x41814181,0x41814182,0x49a351e3,0x51e45a44,0x51e451c3,0x5a2551c3,0x51c24982,
-0x5a246aa6,0x5a2549a2,0x51e349a3,0x51e44161,0x49a24182,0x49c33920,0x28a04181,0x41822040,0x39014162,0x20607308,0x28c02060,0x730b51c3,0x41833982,0x49c33121,0x39213921,0x39222060,0x28c03101,0x39413101,0x10403101,0x31231860,0x08001881,0x49e441a5,0x310049a3,0x39203941,0x310128c0,0x28a12080,0x28a01840,0x49c24182,0x5a234181,0x520241a1,0x39403940,0x41803940,
-0xcd30ac4c,0x82c6a3ca,0x7ae682c4,0x93aa8b87,0x08002000,0x10403143,0x08203163,0x188218c1,0x6b4d5269,0x00000000,0x00000000,0x10810000,0x080018c1,0x5a8720e2,0x6ac962e9,0x5a87732a,0x08005a87,0x20c21040,0x31231861,0x39441040,0x51e362a6,0xac6d72c6,0x72a45a03,0x8ae7d5f4,0xd5d45180,0x728693cb,0x5a046244,0x5a2651c5,0x5a266268,0x28c149c5,0x5a4641a4,0x5a675a67,
-0x5a055a26,0x51e56a68,0x10204183,0x39230000,0x28c128c2,0x39444184,0x31201860,0x31203100,0x08202080,0x41850000,0x6ae75a26,0x6ae87b48,0x49c34183,0x418441a2,0x20603122,0x41c34183,0x39031000,0x39221840,0x28a049c4,0x5a265a26,0x62655a26,0x62865a05,0x28c05a46,0x10001020,0x18400800,0x08000800,0x18800820,0x00000820,0x31210800,0x392120a0,0x49c420a0,0x5a454162,
-0x49c151e3,0x51e44140,0x29010800,0x49e54a04,0x00001000,0x18c00000,0x30e03943,0x4a251860,0x838a834a,0x83288369,0x7b4972e7,0x6aa66aa6,0x62665a24,0x62466286,0x392051e4,0x51e15a22,0x51e15a02,0x51e35a23,0x49a251e2,0x49c24181,0x41614161,0x49a35a04,0x41606aa6,0x49c25203,0x51e34180,0x62655203,0x51e33100,0x49c430e0,0x49c351e3,0x51e349a3,0x7ae85a04,0x5a456286,
-0x49825a45,0x41a351e3,0x31003941,0x51e430e0,0x28a03921,0x310049c3,0x28a03920,0x28a04182,0x39203920,0x5a2428c0,0x18001000,0x28c149a4,0x10002900,0x39623922,0x31004162,0x080028e1,0x394228e0,0x28c030e0,0x20a01000,0x28e03941,0x20803962,0x28a03101,0x28a04182,0x41824182,0x28c028e0,0x30e028a0,0x416149c2,0x520251e2,0x5a2351e2,0x49c151e2,0x49c04160,0x49e25202,
-0xac2c7a85,0x93889b88,0x83079368,0x93688306,0x59e48306,0x08000800,0x10a020a1,0x18c20840,0x00000840,0x00000000,0x00000000,0x00000000,0x08201082,0x5a683964,0x4a253162,0x62865266,0x5a4762a7,0x20c06b09,0x10400800,0x41643121,0x520349c2,0x832749a3,0x93476223,0x9367bc6e,0x8b687ae6,0x622293aa,0x72a759e1,0x49846a68,0x5a465a04,0x49e55a26,0x18203101,0x62675206,
-0x51e56267,0x6aa86aa8,0x5a466266,0x62686287,0x20601840,0x28800800,0x20c01020,0x31203141,0x28e23120,0x188118a0,0x29011060,0x73094204,0x41827309,0x39605204,0x314230e1,0x39423121,0x30e228e0,0x290220e2,0x30e13922,0x5a455224,0x51e45225,0x5a456246,0x62666246,0x5a255a46,0x206020a0,0x28a11840,0x10001880,0x28a21861,0x18402903,0x392128c0,0x30e030c0,0x52043900,
-0x5a456aa7,0x30e02080,0x93cc1000,0x100030c0,0x83694180,0x000049e3,0x20602080,0x08007329,0x6ac79c2c,0x7b288349,0x624493ca,0x72a66264,0x30e06245,0x62875a04,0x62877309,0x62646286,0x59e25a43,0x49a16224,0x5a2449e2,0x626559e3,0x314049e1,0x520241a1,0x62a56aa5,0x52035203,0x7309730a,0x62656266,0x62665a45,0x31004181,0x418272e8,0x41624161,0x626549a3,0x49a24182,
-0x5a6649c4,0x52044183,0x49a23941,0x498330e1,0x39402060,0x41814161,0x39833982,0x30e02060,0x39413120,0x41832080,0x18205a46,0x18402020,0x39403940,0x312028c0,0x20803942,0x20802080,0x394228c0,0x20803921,0x39412060,0x49c428c0,0x49e43940,0x418349c4,0x31205a27,0x49e328e0,0x20803121,0x28a03100,0x39003941,0x39604180,0x396049c1,0x6aa649e1,0x52225a42,0x49e25a23,
-0x9b89a3ca,0x93468ac4,0x83058b46,0x8b479388,0xa3ea82e6,0x6a658b07,0x10203901,0x084120c1,0x00000840,0x00000000,0x00200000,0x00000000,0x39850020,0x08001880,0x41c40000,0x49c51880,0x5a466ae9,0x49a47b2a,0x49e46ac7,0x30c030e0,0x49c249a1,0x93ec6ac7,0xbcd08bab,0x93ab93a9,0x9bca8b68,0xac6c9be9,0xac6c9bc9,0x72a78348,0x62877ae9,0x52265205,0x41645206,0x10002080,
-0x5a465207,0x62675a05,0x5a666266,0x62876aa7,0x626662a7,0x6aa75a45,0x186028c0,0x28e01840,0x188028e0,0x08000820,0x08201080,0x41c50800,0x730962e8,0x49a46ac8,0x20803961,0x31225a47,0x080062a8,0x18800820,0x49c41840,0x5a455a45,0x51e45204,0x5a455a25,0x5a055a45,0x51e55a26,0x5a455a45,0x5a2549a3,0x416249c3,0x20606a88,0x394320c2,0x41652080,0x188028c0,0x522649e5,
-0x39432080,0x5a4672e9,0x730828e0,0x51c24182,0x93eb72a5,0x20e16ae7,0x18205a69,0x52051041,0x7b288baa,0x7b078b8a,0x72c68369,0x83287b07,0x93ca72c7,0x20a06aa6,0x41833101,0x10003962,0x51a11000,0x62457ae8,0x5a036aa7,0x41426244,0x49e249c2,0x52045a65,0x7b086265,0x5a246ac6,0x392151a2,0x39214182,0x520330e0,0x184051c4,0x39004983,0x49c33921,0x418249a3,0x414151e3,
-0x39413961,0x5a255224,0x41825225,0x30c049a3,0x392130c0,0x39423942,0x08001040,0x10203982,0x39623121,0x5a2549a3,0x000049e5,0x10000000,0x39401820,0x310028a0,0x31012060,0x31003921,0x310151e4,0x31014162,0x28a028e1,0x208051e4,0x5a463980,0x20a01860,0x31203100,0x28e03100,0x39403940,0x31004181,0x39202080,0x41603920,0x41803940,0x51e130e0,0x49a03920,0x41804160,
-0xa3ecf677,0x72a4b44e,0x8b267a40,0x9ba89367,0x83268b46,0x9beb9388,0x8b2993ec,0x18601800,0x00000820,0x00000000,0x08410000,0x00000841,0x08200000,0x002039a5,0x39820000,0x100018a0,0x522683ad,0x206028a0,0x5a245204,0x83696265,0x41614182,0x8388942b,0x93aa8388,0xa40b8328,0xb4ce8b89,0xa40b9bca,0x93879ba9,0x7b088369,0x6aa772a8,0x62676a88,0x49e56267,0x39424163,
-0x18202040,0x62873942,0x5a466266,0x5a455225,0x62866286,0x5a2572c7,0x5a665a25,0x100028c1,0x210018a1,0x20c03142,0x292120c0,0x000118a0,0x31010020,0x838b62a7,0x41a349e4,0x10203142,0x41c34a05,0x104020e1,0x18600000,0x49e35224,0x398141a2,0x52265224,0x52245225,0x52254a05,0x522549c3,0x30e028a0,0x39213121,0x51e441a3,0x39432080,0x000041e4,0x104020c1,0x52051840,
-0x39633963,0x31014162,0x52245a46,0x41815202,0x394151e3,0x28e162a6,0x28c03102,0x39620000,0x6ac85a25,0x72e77b49,0x6ac66285,0x83286286,0x7b288b8a,0x6ac872e7,0x4a455a66,0x10403100,0x100049a4,0x20404963,0x626551c3,0x628851c4,0x41a228c0,0x310041a2,0x30e093cc,0x62a651e3,0x39603121,0x49c25204,0x310051e3,0x20801000,0x39213923,0x312049e3,0x49c42080,0x41416266,
-0x39205a04,0x41406285,0x412151c2,0x31214183,0x39213963,0x292128e0,0x394230e2,0x6ac86287,0x28a06288,0x28c03941,0x5a051000,0x392030e0,0x418128a0,0x31203940,0x31003121,0x182028c0,0x20a02060,0x208028e0,0x30e07329,0x314028a0,0x100049c4,0x31003960,0x730930e0,0x51e34181,0x206049c1,0x39203920,0x49a23940,0x39404160,0x49a151e2,0x51e24160,0x392049a1,0x49c13940,
-0xff7dde38,0x9b497a85,0x93479bac,0x8b268b46,0x93878b46,0x8b888326,0x6a458b69,0x20e08b89,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08204207,0x732c41e6,0x10201840,0x18400800,0x41831000,0x72c87b29,0x7b296aa7,0x62868b8b,0x72e772e7,0x836972e7,0x83498349,0x9beb8348,0x8b898348,0x8ba8a44c,0x7b2772e6,0x62866243,0x6ac872c8,0x626762a7,0x41a45a46,
-0x39014163,0x5a254163,0x5a465a46,0x62465225,0x52046246,0x628651e4,0x49e35a05,0x28e17b6a,0x08000800,0x310120a0,0x20e020e0,0x20e03141,0x00211080,0x29430000,0x6b2b5ac9,0x39853985,0x29224206,0x41e520e1,0x08200000,0x20a12901,0x6b2a1880,0x28c11880,0x20802080,0x41833120,0x418249c3,0x30e049a2,0x8bcc3121,0x31215a46,0x20e020e1,0x00000000,0x00000000,0x000020a1,
-0x39231000,0x4a0541a4,0x18603963,0x49c52081,0x39624184,0x000049e4,0x20e20000,0x10400840,0x20a03943,0x6a866a87,0x7b4872c7,0x6aa67308,0x72c66a85,0x72e872e7,0x4a2562a7,0x10001860,0x31035a08,0x39014122,0x6aa628a0,0x28e03920,0x39413100,0x312041a2,0x18002040,0x62a751e4,0x49c349c3,0x41834162,0x49a46266,0x49c36ac7,0x20815224,0x51e51000,0x5a2549a3,0x39205205,
-0x59c238e0,0x6a644140,0x39006a64,0x10002060,0x28c01000,0x4a2628c0,0x00001040,0x62c81020,0x51e43122,0x394241a2,0x394120a0,0x414130e0,0x396130e0,0x31203940,0x31211860,0x30e02080,0x20a03940,0x394030e1,0x312028c0,0x290028c0,0x49c33120,0x41a241a2,0x31203960,0x49a249a2,0x49a230e0,0x5a2449c3,0x416149a3,0x41604180,0x416051e2,0x51e249a1,0x5a445a23,0x520249c1,
-0xf6dce69b,0xb46eeeda,0xabecb4d0,0x83258b46,0x83068b46,0x93688b26,0x8b488b89,0x830693ea,0x20209c0c,0x18a20000,0x00001082,0x00000000,0x00000000,0x000018a1,0x39210800,0x522849c5,0x20a01000,0x62880800,0x310193ed,0x49839c4e,0x1000834a,0x6aa75a45,0x6aa76266,0x7b296a86,0x7b077b07,0x72c793cb,0x6aa51800,0x93ec7b0a,0x6aa67b07,0x838a6246,0x6aa87308,0x62876267,
-0x49c26a87,0x30c03922,0x5a4651e4,0x62665225,0x62866246,0x5a455a05,0x62656a87,0x62666ac7,0x30e17328,0x18401000,0x18c020e0,0x28e00000,0x086041e3,0x00000000,0x00000000,0x00000000,0x00000000,0x29010000,0x00000000,0x00000000,0x08200800,0x18400000,0x39632080,0x39621000,0x31003100,0x628649a2,0x18405a46,0x41a328c0,0x00000000,0x00000000,0x00000020,0x10800000,
-0x08001020,0x00000800,0x000018c0,0x39c320e0,0x08003161,0x086120c0,0x00200020,0x00000000,0x20c20820,0x6ac80800,0x5a456ac7,0x6aa65a44,0x6a857b28,0x52056a86,0x39823121,0x41a22900,0x20a028e1,0x51c42880,0x18204141,0x41a17b26,0x39613960,0x52043120,0x100049c4,0x49e42060,0x182049a3,0x39224163,0x28e03942,0x18401000,0x6ac81820,0x312049a2,0x39421840,0x310051e4,
-0x7ac56203,0x7ae57ac5,0x38e07284,0x520728e0,0x100028e0,0x080020a1,0x39c30821,0x20a01040,0x732949c4,0x39423100,0x10003963,0x6aa828a0,0x41814161,0x28c04181,0x28e03100,0x41821820,0x28e04182,0x49e341a0,0x39403940,0x39413921,0x41a13940,0x28c03960,0x520528c0,0x39404161,0x41815a26,0x30e028a0,0x392049a4,0x39603920,0x51e23940,0x5a434160,0x49a251e3,0x49c249c1,
-0xce1ac5b9,0xcdf9c5fb,0xbd13cdd9,0xc551bd32,0x7b06ac6c,0x93898326,0x830772a5,0x8b687b07,0x832793ca,0x18c23080,0x00001060,0x00001082,0x00000000,0x08200820,0x184041e7,0x20606268,0x41855a27,0x2080838c,0xc5741820,0x59c472a8,0x62867b07,0x730949a3,0x6a866286,0x5a247b08,0x72c672c8,0x6aa572c5,0x62037ae6,0x10002880,0x7b076aa7,0x72c672e7,0x72e86a85,0x6a8672e8,
-0x62666266,0x49c36aa7,0x49c23940,0x5a4549e2,0x52045204,0x5a256286,0x5a256266,0x6ac772e8,0x6aa76286,0x52046ac7,0x08011060,0x18a00820,0x210020e0,0x00001080,0x00000000,0x10820000,0x00000000,0x08201041,0x00000000,0x08000000,0x49c43102,0x39423943,0x41a33101,0x394130e2,0x41613921,0x51c45a45,0x20a05202,0x18403162,0x08001840,0x00000000,0x00000000,0x00000000,
-0x08400820,0x00002103,0x000041e6,0x00000000,0x00000000,0x00000000,0x20c20000,0x08000800,0x31440000,0x52053942,0x51e45225,0x49e35a66,0x51e36265,0x20a05224,0x39631860,0x28e12901,0x20c11040,0x08200000,0x28c03963,0x312049a3,0x414349c4,0x10403102,0x62870000,0x41623080,0x20c041a3,0x39634183,0x29004a06,0x520620a0,0x41a45225,0x49c34183,0x30c051c4,0x208028a0,
-0x62446a85,0x72a472c4,0x41816244,0x39623962,0x41633941,0x49a44163,0x18601860,0x20e02901,0x39205204,0x49824182,0x52042060,0x49835204,0x31203920,0x41a22080,0x28c028e0,0x39613960,0x41813941,0x41a04160,0x28e03140,0x418228c0,0x30e03941,0x31403120,0x41a13960,0x416128e0,0x30e03100,0x28c04181,0x414128a0,0x39403100,0x39603140,0x394041a1,0x416049a1,0x416051e2,
-0xb5b8bdd9,0xad36b577,0xa4f5a536,0xb514a4b4,0xa46f9c0f,0x83078389,0x7ae68327,0x7b079bea,0x83488348,0x5a258306,0x18600000,0x10401040,0x10610800,0x08000000,0x18401061,0x312228a1,0x28e1838c,0xc5941000,0x73085a45,0x9c4ea48f,0x41631840,0x39026ac8,0x72c76246,0x6a866265,0x5a247ae8,0x83698369,0x83487b28,0x6aa772e8,0x7b2851c3,0x72c772e7,0x72c672c7,0x93ca7ac7,
-0x6ac772e7,0x6aa76aa7,0x49e45a45,0x5a2549a3,0x5a255225,0x5a255a45,0x5a256aa7,0x52045a45,0x5a246265,0x6ac66287,0x29235284,0x10400000,0x188020a0,0x08610020,0x00000020,0x00000000,0x00000000,0x00000000,0x18401020,0x39221000,0x39014963,0x49c33101,0x394149c3,0x41614182,0x49a24182,0x51e45a24,0x00003981,0x10200820,0x10201880,0x00000800,0x00000000,0x00000820,
-0x10610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31620000,0x18412080,0x41a50000,0x28e028c0,0x52045225,0x49c349e4,0x39815224,0x29202900,0x104118a0,0x31620800,0x31221840,0x00000000,0x51c40800,0x418249a2,0x184049a3,0x00000000,0x18800000,0x00003164,0x29000800,0x20e01880,0x52070000,0x100049e4,0x182020a0,0x310028c0,0x41632880,0x62653941,
-0x5a2372c6,0x520228a0,0x10205203,0x28c01000,0x28e03100,0x186020a0,0x28e13942,0x08200000,0x41a25224,0x416228e0,0x39414962,0x52043100,0x5a453920,0x31203100,0x39803940,0x39403100,0x41815a44,0x31004180,0x41a228e0,0x08003943,0x39413921,0x39603120,0x28c03941,0x310041a2,0x31004162,0x30e06266,0x51e34180,0x20a04181,0x31005204,0x39203920,0x49c14180,0x51c14160,
-0x004210a4,0x426b18e5,0x94b49d15,0x8c7394b4,0x7bb08432,0x83cf7baf,0x6b0ab574,0x83068bcc,0x938872a5,0x83097b05,0x20808b8b,0x10201820,0x082018a1,0x00000000,0x6aa80000,0x7b4b49c5,0x52276aa9,0x6aea49e6,0x7b8b0800,0x93ec6266,0x52057b6a,0x2060836b,0x7b082880,0x7b075a24,0x83496245,0x72e78348,0x7ae872c7,0x72a77ae8,0x62658349,0x62245a23,0x72c66aa6,0x72c66a85,
-0x7b2872c6,0x72a77b09,0x62867b49,0x18206286,0x5a245225,0x52045a45,0x62665a25,0x5a255a25,0x5a455a24,0x72e85203,0x5a6662a7,0x00003121,0x08000800,0x20c11881,0x21040000,0x00000000,0x00000000,0x292420a2,0x184028c1,0x41623121,0x51e449a2,0x39205a25,0x51c351c3,0x51c35a45,0x51e56265,0x30e049a3,0x102049e4,0x10400000,0x00001040,0x29440000,0x00400861,0x00000000,
-0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28c03122,0x20c01040,0x08203141,0x18202920,0x394151c4,0x312049c2,0x41823120,0x31003961,0x00002901,0x396320a1,0x10203982,0x51e449a3,0x31023101,0x396128e0,0x398341a2,0x00000000,0x00000000,0x08410000,0x21024a26,0x31016287,0x10001000,0x30e13941,0x10003101,0x20802080,0x28c03121,0x51c25a25,
-0x390051c2,0x52262080,0x102041c3,0x20a041a3,0x41a328a0,0x49a35204,0x31213941,0x08002900,0x31001840,0x30e06a86,0x520430e0,0x20a049c3,0x28a15246,0x31202080,0x20c03141,0x312041a2,0x418149e3,0x31003120,0x28a05205,0x416251c4,0x310130e0,0x49c33100,0x102028e0,0x28e11040,0x18202080,0x394028c0,0x49c230e0,0x28c03940,0x184028c0,0x73283100,0x49e251e3,0x5a2251e1,
-0x18c32945,0x18e40000,0x10a30001,0x52ab4a4a,0x52cc52ac,0x4a8a52cb,0x18e42145,0x83ec2965,0x8328d5f4,0x72e78348,0x93cc7b29,0x51e54142,0x20801020,0x18802903,0x62676b0a,0x730a6288,0x6288732b,0x312341a5,0x18601061,0x7b4b6288,0x6ac86ac9,0x62677309,0x6a8749a3,0x72c76aa7,0x6a866245,0x83497b28,0x72867ae8,0x7b296266,0x6aa66265,0x6a856266,0x20406245,0x72c76a66,
-0x7b286aa6,0x834972c7,0x7329838a,0x416251e4,0x41822040,0x62666266,0x52036266,0x51e351e3,0x5a045a04,0x62856aa7,0x6ac76ac7,0x7b696265,0x08201880,0x20a01081,0x08001860,0x00001060,0x00000000,0x00000000,0x20801820,0x30c04181,0x51e251e2,0x51c36245,0x41823941,0x49a23921,0x392051c4,0x49a34182,0x000020e0,0x00000000,0x00000000,0x00000000,0x29012902,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31420840,0x41633983,0x290041a3,0x18802900,0x00000000,0x49e43162,0x62873960,0x398249a2,0x31403981,0x31653141,0x31012080,0x18401880,0x41823961,0x49a449c3,0x41a23121,0x31823940,0x206028e1,0x00001000,0x6b4c4207,0x18c10000,0x49e51880,0x18005a67,0x28c01840,0x28c02080,0x30e01000,0x39423921,0x5a2459e4,
-0x5a6649c3,0x28e120c0,0x30e028e1,0x208028a0,0x39413121,0x49e45a45,0x41c428c0,0x10401880,0x31212922,0x28e04162,0x49a24181,0x29004161,0x39421880,0x28e049a3,0x290041a3,0x41823121,0x49e449c3,0x49a33100,0x310230e2,0x396230e0,0x392141a3,0x28a128e0,0x5a473122,0x20c0a4f1,0x418241a3,0x49a241a1,0x31203100,0x28e049c2,0x394028e0,0x28a03120,0x522351e3,0x5a225a03,
-0x08400820,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18e4632c,0x00009cf3,0x632920e1,0x6aa77309,0x838b836b,0x20801000,0x4a061040,0x6b2a6b2a,0x5a686b2a,0x5a8862ca,0x398539a5,0x83ae20c2,0x6ac962c8,0x62686ac9,0x62896289,0x522649e6,0x6a867b4a,0x72e76a86,0x624572c7,0x6a677288,0x62657b08,0x5a2351c2,0x62655a04,0x62256286,0x62654161,
-0x6aa66a86,0x72e86ac7,0x52055a25,0x6ac75205,0x72e67b28,0x39005a23,0x51e45a03,0x5a0451c3,0x62656286,0x62455a45,0x6aa66265,0x6ae872e7,0x62c76287,0x20a01020,0x18802921,0x10201860,0x00001061,0x18a20000,0x41811020,0x62655a03,0x5a455a24,0x5a456246,0x49a23920,0x39214183,0x390049c3,0x41c241a2,0x00200840,0x08000000,0x00002902,0x00202903,0x39c41061,0x00003921,
-0x10610020,0x10601040,0x00001081,0x00000000,0x20800000,0x20a020a0,0x396341a4,0x39634162,0x42060800,0x00000000,0x31620000,0x72e849c2,0x41a249a2,0x39204181,0x186030e0,0x20a028e1,0x28c01020,0x28e11840,0x292120c0,0x28c11020,0x41832900,0x392128a0,0x39623101,0x18610800,0x20a049e5,0x1020730a,0x20a020a0,0x100030e0,0x10201860,0x52250000,0x184028c1,0x3102bd53,
-0x1800834b,0x49e61820,0x39220800,0x10002080,0x394028a0,0x49e41840,0x00003101,0x31213962,0x18605226,0x28e028e1,0x62660800,0x312030e0,0x49e341a2,0x28e03961,0x312028e0,0x28e04182,0x20402060,0x41614182,0x08004182,0x28a041a3,0x10003902,0x41833962,0x7b6b6ae9,0x28a01880,0x20a018a0,0x39614180,0x5a453100,0x39415a66,0x184028c0,0x39203120,0x5a2430e0,0x394049a1,
-0x00000820,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00400000,0x000010a0,0x730a0000,0x6aa85a46,0x2902940d,0x62a81860,0x5aa75a46,0x732b6b0a,0x5a686b2b,0x52485aa9,0x52485248,0x7b4b5227,0x52076ac9,0x4a0649e6,0x524741c5,0x7b295a46,0x62458baa,0x6a667ae8,0x416251a2,0x62c849e5,0x312018a0,0x5a654180,0x49c33960,0x5a245204,
-0x6aa66286,0x62866266,0x39426287,0x5a2549c4,0x7b0772c6,0x7b088348,0x5a046265,0x62256245,0x62665a25,0x6aa65a45,0x62666245,0x62656245,0x6ac75204,0x20405225,0x28e01860,0x20a028c0,0x00001020,0x18800800,0x52045a65,0x62256245,0x62866245,0x72c872e8,0x6ac76ac8,0x49c35204,0x416151e3,0x29003961,0x00000000,0x10400000,0x29003122,0x28c028e0,0x000018c1,0x290220c1,
-0x31002902,0x08001040,0x00000000,0x41a50000,0x41a341e4,0x4a0441a3,0x290141c4,0x20c02080,0x396541a4,0x00000000,0x18420000,0x5a453940,0x49c25203,0x418049c2,0x18812900,0x398220a0,0x18801840,0x20a01020,0x31833120,0x18800800,0x394220a0,0x31014162,0x41622080,0x30e02080,0x28a02080,0x28a02080,0x312049a3,0x20a02901,0x52054a05,0x310028e0,0x10003102,0x6a8830c0,
-0x100030e1,0x41823901,0x418341a3,0x41826ac8,0x20a03940,0x310162a7,0x29221020,0x20e11040,0x31414182,0x31411020,0x20602900,0x31213941,0x310028e0,0x28e03961,0x186020c0,0x39403101,0x39425a24,0x52062040,0x18401000,0x08201000,0x00000000,0x00000000,0x00000000,0x31002901,0x28e02100,0x416128c0,0x41a228e0,0x28e03100,0x312028c0,0x39404180,0x28c049c2,0x41604181,
-0x18a20821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29840000,0x20c20000,0x62a86ae9,0x6ac85a26,0x62876aa8,0x62866ae8,0x52266286,0x736c6b0a,0x6b0a62a9,0x52475aa9,0x52075207,0x41e649e6,0x418420e2,0x19022903,0x318531a5,0x7bce39c6,0x72c67b48,0x83298b49,0x00003983,0x00000000,0x4a020860,0x49e24a02,0x314141a1,0x080041c1,
-0x51e449e3,0x51e44183,0x20a06268,0x18205203,0x6a864185,0x72c67305,0x7b088348,0x72c772a6,0x5a236246,0x83275a03,0x62246264,0x62456224,0x52046245,0x6a676a86,0x28a072c8,0x28801800,0x20803102,0x28c02080,0x6aa75a05,0x73296a87,0x5a455a66,0x51a35a45,0x6a666205,0x310072e7,0x41825205,0x41c430c0,0x00000000,0x18200000,0x10403103,0x10601880,0x18630840,0x29010800,
-0x394251e3,0x18201800,0x49e42060,0x5a656266,0x41a162a6,0x31405223,0x4a0441a2,0x49a449a4,0x52231861,0x520249c1,0x5a6541a0,0x5a224180,0x5a646ac5,0x4a0249e2,0x00001881,0x28a028e2,0x6b073120,0x62c720a0,0x21003120,0x41e239e2,0x28e04182,0x39623962,0x41422060,0x51e430e0,0x416149a2,0x182049c3,0x10401800,0x00010000,0x18800000,0x20405205,0x18403121,0x51c41800,
-0x18202060,0x39004983,0x41624161,0x41401820,0x62c94162,0x00000820,0x00000000,0x00000841,0x39a341e3,0x31401880,0x396141a2,0x20a02900,0x31001860,0x186028e0,0x41a31880,0x39604181,0x28a03961,0x20e22080,0x10403143,0x08001881,0x08200000,0x00000800,0x18600800,0x08001040,0x084018e0,0x28a10000,0x28e028e0,0x29005244,0x628728e0,0x31003120,0x41612080,0x5a254182,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x5aa90861,0x7b6b6288,0x184051e5,0x6ac872e9,0x6a876ac8,0x51e46aa7,0x62ea62a8,0x6b2b5a88,0x5a885a88,0x41a55a68,0x41c65247,0x20a13144,0x00000000,0x294410a2,0x21242124,0x72e77329,0x93ab8328,0x00000800,0x00000000,0x314052a8,0x39805a63,0x31405202,0x08001860,
-0x312128e0,0x29013962,0x49a43940,0x392130e2,0x18601000,0x18400800,0x7b2a838b,0x6aa67b29,0x6ac66aa7,0x72a68328,0x72c66a64,0x6a866245,0x5a455a04,0x6a675204,0x8369834a,0x28c072e7,0x31003941,0x310020a0,0x51e45205,0x41836287,0x62874183,0x59c44183,0x7ae96246,0x41816286,0x30e028a0,0x29214983,0x00000000,0x10200800,0x20c11040,0x080120c1,0x08220800,0x182041c4,
-0x62655a24,0x51e25a43,0x520451e2,0x62875204,0x52243940,0x39823941,0x520649e4,0x49c33941,0x5a441040,0x62845a43,0x5a645a64,0x62a43940,0x52235a43,0x41a14181,0x00001040,0x6ac61040,0x73260000,0x18608bec,0x42033140,0x41e318e0,0x41823962,0x52043921,0x28a03921,0x49a330e0,0x51e34182,0x49a34160,0x208030e1,0x08401020,0x00000000,0x18800000,0x10001000,0x39426288,
-0x41627b4a,0x39203941,0x418249a2,0x39200800,0x084083cc,0x186018a1,0x18401000,0x398320a0,0x10200800,0x20c03965,0x52253983,0x310128e0,0x20c020c0,0x208028e0,0x312162c7,0x20c03961,0x312328e1,0x00001860,0x08201880,0x20c02901,0x18a018c0,0x080020a0,0x00000800,0x00000020,0x00000021,0x39a34a25,0x188020c0,0x29003121,0x20a02900,0x39212060,0x20c03101,0x9c6e62a7,
-0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18e24a69,0x5ac84227,0x7b4b62a8,0x49e56ac8,0x628728a0,0x72e87329,0x6aa76aa7,0x62a96ac8,0x62c96aea,0x62ea62a9,0x41a66289,0x41c549e6,0x000020a1,0x00000000,0x18c20000,0x21031903,0x7b4a5aa9,0x6ac76aa6,0x62847b49,0x8b8c6aa6,0x31404162,0x41c05241,0x4a405a62,0x398041a1,
-0x18a01061,0x10401080,0x182028c2,0x412028e0,0x51c149a0,0x000030e0,0x08000000,0x41a11860,0x5a443901,0x5a0372a6,0x72c672a5,0x72c78308,0x62656aa7,0x6a866ac7,0x72e96265,0x6a8872c9,0x6288838c,0x28e03961,0x5a875246,0x62875225,0x100049c4,0x100049a4,0x30e13902,0x41821800,0x20604161,0x31624983,0x18600000,0x292220a1,0x10400000,0x00000800,0x29a20000,0x392128c0,
-0x5a436286,0x5a2451e3,0x49c249c2,0x52245224,0x49a349c3,0x396251e4,0x39431840,0x18613123,0x52021880,0x5a435a63,0x6ae66284,0x5a4328c0,0x628549a0,0x41a13120,0x00001020,0x28a00800,0x6aa37304,0x31212080,0x528641c2,0x21000000,0x41a33962,0x28c06266,0x41613920,0x31002080,0x49a228c0,0x5a054143,0x416149a3,0x10204183,0x31611020,0x10011000,0x7b4928c2,0x28c04142,
-0x39204182,0x310030e0,0x416049a2,0x39623100,0x00000820,0x49c40000,0x41e41020,0x002020e0,0x00000800,0x28c11022,0x10201000,0x20803942,0x20a020a0,0x28e128e0,0x29002900,0x10403161,0x08000800,0x10204a06,0x00003984,0x18a01020,0x20c018a0,0x52670800,0x002020e1,0x41a541a5,0x00000000,0x08000001,0x00000000,0x730b1061,0x4a047329,0x18401840,0x00001060,0x4a051060,
-0x6b0c5249,0x945062ca,0x18815a69,0x10200800,0x00000800,0x08400800,0x00000000,0x00000000,0x21040000,0x41e5632b,0x6b08732a,0x7b497b4b,0x49c241a1,0x73096ac8,0x5a6762a7,0x5a865a67,0x526762a8,0x524762c9,0x5a485227,0x10205207,0x00000800,0x00000000,0x00000000,0x00000020,0x42480840,0x5a465aa8,0x730962a7,0x6a86836a,0x6ac67ac7,0x39806283,0x5a8341a0,0x41a041a0,
-0x398139a1,0x28c01020,0x100028c0,0x59e42060,0x51e351e3,0x41c25a44,0x28c03941,0x394128e0,0x18405225,0x72a672c7,0x72e77b28,0x72c772e7,0x730872c8,0x6aa77b29,0x62876286,0x49e45a25,0x62a862a7,0x41c4a490,0x39822900,0x5a675224,0x28e24983,0x28e12080,0x30e172e9,0x208049e5,0x28e01860,0x20c041a1,0x39a50000,0x080028e0,0x08200800,0x08200000,0x31202900,0x72e73100,
-0x51e25a44,0x5a455224,0x52245a65,0x39615224,0x41a25a45,0x18803941,0x000041e6,0x00000820,0x49e10000,0x62c55a43,0x62a65a64,0x626420a0,0x49e24160,0x316049c2,0x08400800,0x93cb20a0,0x30e0c592,0x29000800,0x186020c1,0x41611020,0x41843941,0x30e15205,0x41823941,0x30c04162,0x51c33921,0x39416286,0x30e049c3,0x5a4628c0,0x184083ec,0x20801020,0x73076ac7,0x31003100,
-0x39614181,0x39403100,0x5a2528e0,0x08002880,0x10001040,0x18601000,0x5aa55a84,0x28e15206,0x18810000,0x18811000,0x08001040,0x08002902,0x20c11060,0x102028e1,0x00000820,0x00000000,0x08400000,0x00000000,0x08004a47,0x00000800,0x20e11060,0x290220c0,0x08400800,0x20e30000,0x00000000,0x00000000,0x10600000,0x52664a06,0x3144734b,0x00000820,0x18802922,0x20c10000,
-0x62a96b0b,0x5aa95227,0x62a95aa9,0x6b0a6b0a,0x5a895a68,0x080049c6,0x31440000,0x10a14a48,0x00002103,0x41c62144,0x73292902,0x838a6ae8,0x41a351e4,0x6ae91860,0x5aa75267,0x52664a05,0x62c95a87,0x52475a68,0x62886289,0x10406a89,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x4a263164,0x5a6641e4,0x62a7732a,0x626572e8,0x72c651e3,0x5a0251e0,0x5a225a22,
-0x49c05a64,0x41805a43,0x49c25a24,0x412149c2,0x6ac66244,0x49a06aa6,0x39616aa5,0x310049a2,0x41824183,0x62455a04,0x6aa66244,0x6a666aa6,0x62866a87,0x6aa76aa7,0x62876286,0x394249c4,0x312220a0,0x10601061,0x10800000,0x18810000,0x62a93101,0x20801040,0x418351e5,0x41834184,0x28e13162,0x29212920,0x08000000,0x00000800,0x00000000,0x28e00800,0x30e04160,0x51e46aa7,
-0x5a245204,0x522449e3,0x520462a6,0x418149c3,0x522449e4,0x31425204,0x18801020,0x08001020,0x5a630800,0x62846ac5,0x6b076284,0x5a241020,0x418141a1,0x394041c1,0x21011020,0x30c15a47,0x49a53942,0x39411000,0x520428e1,0x5a0441a1,0x39623941,0x28c03941,0x28a03121,0x49a34142,0x41613941,0x41623921,0x39413941,0x59e449a3,0x39413941,0x41823100,0x49c35203,0x28c02060,
-0x20803940,0x41833922,0x51e51840,0x51c34983,0x73092060,0x62a6838b,0x6aa96288,0x52035a23,0x00003164,0x00000000,0x00000000,0x18a00000,0x314318a1,0x20a20800,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x39840000,0x00000820,0x10410800,0x28a13985,0x00000000,0x10810000,0x20e31040,0x10610000,0x00205248,0x39a50000,0x08001880,0x00000840,0x00000000,
-0x6aea62a9,0x62a96ac9,0x62c86ae9,0x732a6ac9,0x62886288,0x5208730b,0x5a4820a2,0x41e80800,0x104039a6,0x00001082,0x632b0820,0x314320e1,0x4a0641c5,0x41c50840,0x49e63143,0x62c97bad,0x6b4a5aa8,0x62a85a67,0x522751e5,0x62895a28,0x29247b2c,0x00000000,0x00000000,0x00000000,0x00000000,0x10a20000,0x31a53a06,0x5a8718c1,0x72c783ec,0x6aa66ac7,0x62856285,0x30e06aa5,
-0x62856aa5,0x52036285,0x41816284,0x5a042060,0x5a245a04,0x62656265,0x49e36aa6,0x41826aa6,0x31003962,0x6aa64142,0x6a856a66,0x52046a85,0x390151e3,0x5a054162,0x52046a87,0x49a45a05,0x20c028e1,0x00000000,0x00000000,0x08200000,0x18a10000,0x18400000,0x41e441a3,0x18a03101,0x08004a25,0x08000800,0x42070800,0x00000860,0x20800000,0x41823100,0x5a244182,0x522449c3,
-0x51e45a25,0x62866266,0x520449a3,0x49e45204,0x41a23962,0x18803981,0x29013122,0x080020c1,0x6ac64162,0x6aa67307,0x6ac76285,0x6aa528a0,0x5a6449e1,0x398149c2,0x080041a5,0x288028a1,0x28803940,0x28a028a1,0x41a241a3,0x416128e0,0x312051c3,0x416130e0,0x398028e0,0x41623920,0x41823961,0x39413100,0x51e44182,0x62655a23,0x416130c0,0x9c4d3941,0x28e07b29,0x20804162,
-0x10203120,0x10200000,0x39214183,0x41823940,0x394230e0,0x39821880,0x41e241c1,0x520449c2,0x00000820,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200800,0x41c320e0,0x41e61860,0x000018a1,0x18601860,0x10401860,0x18c220e3,0x08001020,0x20a11020,0x00000820,0x00000000,0x084018c2,0x08600000,0x000020a1,0x00000000,
-0x62ca62a9,0x62886aea,0x62a86ac9,0x730a6ae9,0x5a68732a,0x6aca730a,0x5a686aca,0x31646289,0x29240820,0x41e75269,0x00002103,0x08200000,0x00000000,0x10a118a2,0x00000000,0x00000000,0x10610820,0x5ac983ee,0x00000800,0x41851840,0x31231000,0x6b4c39a6,0x0000738e,0x00000000,0x00000000,0x00000000,0x00000000,0x31640000,0x62a7632a,0x62856a86,0x62656286,0x626572e7,
-0x62866265,0x52036286,0x51e45a24,0x5a466266,0x62876aa7,0x5a4551e4,0x41826aa7,0x41a249c3,0x18403941,0x414130a0,0x41616245,0x62656244,0x39213900,0x51e551e4,0x5a255a46,0x62676266,0x00003964,0x29031061,0x00200000,0x00000800,0x00000000,0x20600000,0x29222080,0x31440000,0x314020e0,0x00000820,0x18a11060,0x00000000,0x28e03122,0x41823101,0x52047328,0x52045224,
-0x5a6651e4,0x49c351e4,0x186051e4,0x41a24182,0x398141c3,0x83cd3140,0x08200800,0x00003143,0x73063101,0x7b277b27,0x8bcb6aa6,0x626428c0,0x62a55a22,0x41c249c2,0x52050800,0x392130e0,0x31003941,0x28c028c0,0x39221860,0x5a243120,0x394151e3,0x39413120,0x28e03140,0x396228e0,0x39223922,0x39404181,0x41824181,0x290028c0,0x208028c0,0x416328a0,0x30e028c0,0x10003101,
-0x310220a0,0x6ae90820,0x30e15205,0x41c33900,0x9c4e3141,0x312049e5,0x39631020,0x00003143,0x00000000,0x18c30000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x30e13920,0x30e03920,0x29003100,0x080049e2,0x20e13985,0x29420820,0x20c20800,0x18401000,0x08002903,0x29231040,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x20e310c2,
-0x62ea62c9,0x52274a27,0x6b2a6b0a,0x6ae95a67,0x5a67730a,0x730a6288,0x734a6aa9,0x946f6288,0x082039a4,0x5ac90841,0x00206aed,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08610000,0x7b8d41c6,0x836c1000,0x38e372ea,0x08002840,0x4a272903,0x8c0e62c9,0x00000000,0x00200800,0x00000000,0x00000000,0x10600000,0x6ac66a85,0x73076225,0x5a245203,
-0x49a249c3,0x62676246,0x624651e4,0x5a053921,0x49a36246,0x5a265a25,0x49e43140,0x52236286,0x6aa751e3,0x6aa749a3,0x5a456266,0x72c76245,0x5a2572e7,0x52045a25,0x62265204,0x20c06aa7,0x41a45206,0x00000800,0x10600000,0x39834160,0x000028c0,0x18810000,0x52473123,0x00002921,0x39423923,0x08003122,0x00000840,0x30e01000,0x49e23940,0x28c04181,0x520449a3,0x49e43962,
-0x49c351e4,0x41834182,0x49c33902,0x52034141,0x29003961,0x00003141,0x18804183,0x184020c0,0x6ae54160,0x73077b48,0x83c972e6,0x6aa528e0,0x628551e2,0x41c341a2,0x00002081,0x10200000,0x49e351e3,0x49c44182,0x310128c0,0x416120a0,0x31224161,0x29003961,0x4a043962,0x314120c0,0x28c049e4,0x39821860,0x31213960,0x20403121,0x31203100,0x52044181,0x20803961,0x186028e1,
-0x394328e1,0x08004184,0x30e22081,0x08000800,0x10811860,0x31a30000,0x00000801,0x00000000,0x00003144,0x00000000,0x00000000,0x00001061,0x00000000,0x00000000,0x00000000,0x10600000,0x20a01880,0x28e02080,0x498328e0,0x18a05206,0x00003164,0x00000800,0x08000800,0x08000000,0x00000821,0x08201000,0x00000000,0x00000000,0x00200000,0x00000000,0x08200000,0x00000000,
-0x5a885247,0x62c95227,0x62e95247,0x7b8b62a8,0x7b6b7b6b,0x6aa8732a,0x7b4b6288,0x942e730a,0x734b4a06,0x08005267,0x00005228,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29440000,0x62a91081,0x6aa77b2a,0x41827b29,0x08001820,0x39451841,0x62a949e7,0x736c736d,0x738e18c3,0x00000000,0x00210000,0x52250000,0x62456265,0x51e36245,
-0x52045a24,0x51e45205,0x62464163,0x5a266246,0x5a4551e4,0x41603941,0x28e01040,0x396149c3,0x51e33941,0x6a8630a0,0x52045a25,0x72c75a45,0x5a256245,0x62666266,0x5a056246,0x41a36ac8,0x29021840,0x39840800,0x10410820,0x5a464182,0x31226ae8,0x10400000,0x080041c6,0x8c0e41a3,0x39624163,0x10404a03,0x6ae90800,0x392049c2,0x31203940,0x51e449e3,0x62a762a7,0x49c35204,
-0x5a253921,0x39403940,0x49c34181,0x396151e3,0x312041a2,0x18603942,0x39823142,0x28e028e1,0x7b266264,0x7b277b48,0x83a97b68,0x62643100,0x5a445a23,0x4a0441a2,0x08001000,0x28a049a5,0x31205224,0x18403942,0x28a01000,0x394041a2,0x62c85224,0x28e020a0,0x18402900,0x39823141,0x31005204,0x31413120,0x18602080,0x28a10000,0x20802080,0x10001000,0x28e03962,0x31221000,
-0x398320a0,0x20e07bab,0x31420800,0x10201880,0x522549c3,0x31004184,0x00000800,0x00000000,0x20c21020,0x00000000,0x20e30000,0x00001881,0x00000000,0x00000000,0x00000000,0x29020000,0x10203140,0x314020e0,0x31203981,0x08001880,0x00000000,0x20c22943,0x18a218a1,0x08200000,0x10201061,0x08200800,0x00001041,0x10810000,0x00001061,0x4a280000,0x420641e5,0x00000820,
-0x52475268,0x732b4a06,0x62e96ae9,0x730a6ae9,0x7b4b62a8,0x7b2a838c,0x62c8838c,0x72ea7b4b,0x7b2b72e9,0x83ab730b,0x080028e1,0x00000000,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x8c4f0000,0x72e97ae7,0x836b7ae9,0x7b2a6266,0x7b2abd32,0x51e628c1,0x41c66289,0x736c5248,0x943041e6,0x62a94a27,0x10201001,0x6aa76286,0x6aa76aa7,
-0x49c35204,0x6a876aa7,0x5a056267,0x62676246,0x52046266,0x5a055204,0x186028e0,0x312041a2,0x31202040,0x6a856265,0x52045204,0x62256aa6,0x62466a66,0x5a256266,0x5a055a25,0x398251e4,0x000020e1,0x20402040,0x10004161,0x51c349e2,0x41605a04,0x00002923,0x00001061,0x30e11040,0x080028c1,0x5aa73984,0x5a4549e2,0x39403901,0x5a244162,0x522451e5,0x49c35204,0x520451e4,
-0x5a255a25,0x49a45a24,0x416230e1,0x41a25204,0x41c249c2,0x186041c3,0x39820800,0x20813100,0x6aa45a44,0x83687b68,0x8bc97b48,0x626430e0,0x49e35a44,0x49e349e3,0x18401860,0x39211800,0x392230e1,0x41811040,0x39424161,0x20c03100,0x28e062a7,0x41a51860,0x28c03141,0x20c02900,0x31204182,0x18402081,0x28c01880,0x20603962,0x394120a0,0x10004183,0x394228e1,0x41a60800,
-0x08010801,0x00000000,0x08410800,0x39630800,0x10a03121,0x00000000,0x00000801,0x00000000,0x28e20820,0x08003102,0x20c10000,0x00001020,0x00000000,0x00000000,0x00000000,0x18810000,0x00002101,0x28c00840,0x20c11000,0x000018a1,0x000041e5,0x21020000,0x08200800,0x082020a0,0x08001820,0x00000841,0x00000820,0x10200000,0x10401040,0x08000800,0x08200000,0x00000000,
-0x522762c9,0x62ea5aa9,0x62a96b2b,0x6ae97b4b,0x732a730a,0x7b4a7b4a,0x732a8bcd,0x6b097b2a,0x83ac732a,0x8bed6287,0x080083cc,0x00000000,0x18c30861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x6aa7734a,0x626572e8,0x836a72c6,0x6ac77b29,0x73096267,0x7bab6ac8,0x10205a87,0x62e93964,0x52266ae9,0x5a685a87,0x18605a67,0x5a665225,
-0x5a053121,0x62465204,0x41636267,0x520451c4,0x62675a45,0x62665a45,0x31205a44,0x418149c2,0x73075a44,0x72c772c7,0x5a046ac8,0x6aa66aa6,0x624651e3,0x416251e5,0x51e45a05,0x394141a3,0x49c51820,0x310049c3,0x5a2449a2,0x49c349c3,0x41624161,0x084149a3,0x08200000,0x10600000,0x28c11840,0x31002080,0x41a349e4,0x49824182,0x6aa85204,0x52044182,0x62865a66,0x626551e3,
-0x49c35204,0x49c449c2,0x62465a26,0x49c25a25,0x08003961,0x18600800,0x52254183,0x28c041a3,0x73045222,0x83687b27,0x940b8389,0x6aa52080,0x5a446265,0x49a249e2,0x10000820,0x836b4164,0x18801820,0x4a0428c0,0x00001080,0x10200820,0x732949e4,0x49a44162,0x28e04182,0x51e43941,0x20a03983,0x314128e0,0x28e028c0,0x188028e0,0x18803982,0x00001880,0x52260000,0x20c239a4,
-0x00000000,0x00000000,0x00000000,0x08000000,0x39841040,0x39632922,0x31643123,0x28e12903,0x210228e2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29240000,0x31430000,0x18a10800,0x10201881,0x18810000,0x00000861,0x00000800,0x00000000,0x00000000,0x00000000,0x39841880,0x08000000,0x18e10820,
-0x524741e6,0x62c949e6,0x62ea6b2a,0x732a6ac9,0x7b6b7b8b,0x7b2a734a,0x73096aa8,0x8bed7b4a,0x7b4a6b09,0x730983cc,0x08006b09,0x00000000,0x00000000,0x00000000,0x84100000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7b286b4a,0x7b077308,0x6ac76a86,0x7b497b29,0x62656265,0x72e88329,0x73097329,0x49a483ac,0x5a250800,0x4a0528c0,0x4a065227,0x20a10000,
-0x08003144,0x5a0551e7,0x49a328a0,0x52046287,0x5a2551c4,0x28c049c3,0x5a6472e8,0x52036285,0x6ac64181,0x6a866aa6,0x390028c0,0x62665a45,0x5a256aa7,0x49a449a4,0x39415a25,0x39414162,0x30e00800,0x52044182,0x28c06aa7,0x49c34182,0x52053100,0x5a8749c4,0x08001880,0x00000000,0x732a0000,0x52043121,0x41a15223,0x6ac63960,0x5a447b28,0x49c349c4,0x5a255a45,0x7b283941,
-0x204051c4,0x49a33100,0x49a33922,0x49e33921,0x31013920,0x41831000,0x49e41840,0x418349c4,0x6ac36284,0x83688ba9,0x8bca8389,0x5a4430e0,0x52235a64,0x49c349c2,0x20600000,0x310130e0,0x5a464964,0x49e33961,0x08001080,0x20a039a1,0x8bcc3100,0x41a33101,0x31003921,0x20804182,0x18803120,0x28e02901,0x10201040,0x100028c1,0x186028c0,0x000020c0,0x20a00000,0x00003162,
-0x00000000,0x00000000,0x00000000,0x08400000,0x10410820,0x00000800,0x10610021,0x10000000,0x00001842,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29230000,0x20e32123,0x31650000,0x08000820,0x18a14a28,0x000039a6,0x00000000,0x29230800,0x00001860,0x08200000,0x00000000,0x00000000,0x00000000,0x08200000,0x18601840,0x28e120a0,
-0x39a44a26,0x4a263984,0x7b8c4a26,0x7bab734a,0x7b4a736a,0x7b6a7b6b,0x83ac7b8b,0x8bcc7b6b,0x83ab83ab,0x6b09734a,0xacf27b4a,0x00000000,0x00000000,0x00000000,0x00009c72,0x08410020,0x00000841,0x00000000,0x00000000,0x00000000,0x6ae8842e,0x72e66ac6,0x62a47b27,0x834a72e7,0x834972e7,0x83298b6b,0x7b296266,0x72e8836a,0x72c87b4a,0x41a46a87,0x20c00800,0x08205a88,
-0x4a060800,0x00000000,0x62479c2f,0x834a6268,0x52054162,0x41614983,0x51e36225,0x49c35a24,0x62855a24,0x62666ac7,0x39404181,0x626530e0,0x6aa651e4,0x5a464163,0x39621840,0x51c42080,0x51e54984,0x5a2451c3,0x5a456aa6,0x5a244182,0x30e05a24,0x49e45204,0x28e03101,0x08203963,0x20801000,0x39611840,0x6aa649e3,0x72e76ac7,0x51e451e4,0x520472c8,0x51e35a04,0x08003942,
-0x10203101,0x41a41020,0x20c03982,0x49c441a2,0x394141a2,0x10002080,0x28a04183,0x31413142,0x72c46264,0x73278388,0x8bca7b68,0x522330e0,0x52036265,0x524449c2,0x29001821,0x28a030e0,0x31004162,0x28c049a3,0x188018a0,0x41a13162,0x9c8f5203,0x18601040,0x10203101,0x39813100,0x20a01040,0x10202080,0x208028e0,0x20e01860,0x18a01880,0x104020c0,0x28e10800,0x00000840,
-0x00000000,0x00000000,0x18c30000,0x00000000,0x00010000,0x39650000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x00000000,0x00000001,0x28e10001,0x08000840,0x082020c1,0x00000000,0x20800820,0x20c01040,0x29231060,
-0x5aa85a88,0x39845aa8,0x52675a88,0x6b296b09,0x7309734a,0x7b6b6b09,0x83ac7309,0x83ac7b6b,0x6ae9734a,0x734a734a,0x6ac96ae8,0x00002042,0x00000000,0x630b0000,0x08205a89,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x31414226,0x73286265,0x7b28838a,0x838972e7,0x6a8572e6,0x6a857b28,0x72e75a24,0x73077b28,0x6ac77307,0x6aa76a86,0x5a866266,0x20a15a67,
-0x08000800,0x18004104,0xa44f93cd,0x39220800,0x8c0d4143,0x31033943,0x51c33102,0x5a046265,0x418151e3,0x5a046aa7,0x62866286,0x6a865a45,0x62866286,0x39635205,0x39621840,0x49a349e4,0x414249c3,0x5a246ac7,0x6a866aa6,0x62666ac7,0x5a456286,0x72e828c0,0x28e05a66,0x08003963,0x208028a2,0x41823921,0x5a657308,0x6aa65a65,0x62466265,0x52046266,0x41614982,0x080030e1,
-0x100028a0,0x20a028c1,0x20a028c0,0x41841000,0x31003921,0x396249c3,0x39213921,0x29003101,0x6aa36284,0x7b688388,0x7b488388,0x5a234141,0x52236285,0x41c349c2,0x100020a0,0x30e041a3,0x416230e0,0x18604162,0x18a020e0,0x6ae74a05,0x41431000,0x416330c1,0x18401860,0x29003981,0x20a02080,0x20801000,0x18601860,0x20e028e0,0x29010000,0x4a261040,0x00000000,0x00000820,
-0x00000000,0x00000000,0x49e60000,0x39443943,0x10002081,0x000049e4,0x00001020,0x00000020,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x000018e2,0x00000000,0x29240841,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x31420800,0x29220800,0x08400000,0x00000000,0x00000000,0x08200820,0x08200000,0x00000800,
-0x5a675a47,0x52475aa9,0x4a455246,0x62e95aa9,0x83cc62e8,0x83ac732a,0x7b6b732a,0x7b4a7b4b,0x7b2a72e9,0x736b6b09,0x5a886b0a,0x000062ca,0x00000000,0x4a070882,0x732a732b,0x732b838c,0x10201020,0x00000000,0x00000000,0x08610000,0x10200000,0x62c45245,0x6ac77327,0x62866ac7,0x938a72a6,0x626593aa,0x73086ac8,0x836a7b09,0x7b287b29,0x628672c7,0x62666aa6,0x5a466246,
-0x28404184,0x9c101800,0x20201800,0x41848bce,0x41845206,0x30e14183,0x100051e4,0x62863922,0x626649c3,0x49c151e2,0x72e86a87,0x5a4572e9,0x6aa75204,0x31224983,0x41834183,0x396249c4,0x51e45205,0x49a35204,0x39216ac8,0x51e56aa7,0x5a455a26,0x31013962,0x39625205,0x28a03921,0x31010800,0x5a464a05,0x5a2451e3,0x62856266,0x72e86ac6,0x41c45a05,0x41623962,0x30e02060,
-0x49a54183,0x520649c6,0x314249a4,0x20a01880,0x39610800,0x31003100,0x28e03121,0x290028c0,0x72c36aa5,0x7b688388,0x7b488368,0x626428c0,0x52037b28,0x4a2349e2,0x39823942,0x31021020,0x28a030e1,0x31433123,0x20c13143,0x20a01040,0x204028c0,0x10603122,0x180020a0,0x39213921,0x290028e0,0x10201840,0x20803120,0x20803921,0x20a00800,0x10001020,0x08000000,0x18802902,
-0x00210000,0x00000001,0x00000000,0x28e00000,0x28c01020,0x18605227,0x080020e2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000861,0x08410000,0x00000000,0x10810020,0x00000820,0x184028e2,0x00000820,0x10200800,0x08200820,
-0x62885226,0x6b0a6b2a,0x526762a8,0x5aa762a8,0x6b295265,0x7b6b62c8,0x7b6b7329,0x736c7b6b,0x6aea7b8c,0x5aa85a87,0x62ea734b,0x4a0762a9,0x00000000,0x18a05268,0x7b6a7b8b,0x7b6c838b,0x732b83ad,0x41633943,0x08002060,0x00000000,0x00000000,0x00010000,0x5ac72922,0x63085ac7,0x62a67b6a,0x7b496ac7,0x7b287309,0x62846ac5,0x72e77b27,0x72e86ac7,0x626572e8,0x62866aa6,
-0x62886287,0x18a05247,0x18400800,0x20801800,0x416362a8,0x41623921,0x49e44142,0x39421840,0x5a455a45,0x7b485a24,0x51e36285,0x51e34181,0x416272e7,0x49a430e0,0x72e85205,0x5a665a66,0x52055a05,0x62676ae8,0x4a052901,0x522541c3,0x5a254a03,0x31213100,0x28e04162,0x41834183,0x39632080,0x41c428e0,0x104049e5,0x18603104,0x000028e3,0x08000000,0x30c13122,0x10002080,
-0x18201000,0x18401000,0x49c430e0,0x310139a4,0x31015a46,0x30e01020,0x28e03941,0x10002901,0x6aa36aa5,0x83888ba9,0x93cb7b47,0x52021000,0x52236aa6,0x49e349e2,0x41c40800,0x942e28e1,0x49e53963,0x00000000,0x10410000,0x28e11861,0x62675205,0x836a5a05,0x080028e2,0x39413100,0x39623121,0x31030800,0x28a049e2,0x20a028a0,0x28e00800,0x39631000,0x08001020,0x08203163,
-0x31633163,0x20c120e1,0x08000000,0x102020c2,0x49e33103,0x208049e4,0x10401040,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x312339c6,0x00000000,0x18610800,0x00000000,
-0x52065206,0x41a55a88,0x5a685a89,0x10400000,0x4a059c90,0x8bed2901,0x5a67940d,0x6b2b6b09,0x5aca5aa9,0x52675aa8,0x62e95a88,0x39845267,0x4a070020,0x734a20e1,0x83ab7b8a,0x7b6c838a,0x7b4b838d,0x734d62a9,0x62a97b8d,0x00004228,0x00000000,0x00200000,0x00200000,0x00000000,0x52a65aa8,0x7b498bcb,0x6ac77b29,0x72e8836a,0x6ac77308,0x72e772e7,0x6aa66ac7,0x6aa66264,
-0x5aa76287,0x00000000,0x28c10000,0x208030a0,0x626749e5,0x30e128c0,0x49e34183,0x51e64163,0x49a24161,0x6aa65a45,0x28c093ed,0x5a255a46,0x72e851e4,0x628751e4,0x20605a26,0x49e45225,0x51e46267,0x394349a4,0x18610820,0x08000800,0x31215a66,0x416241a3,0x52054183,0x310149c4,0x31221860,0x73293101,0x292120e0,0x29230820,0x20c220c1,0x10401040,0x30e11000,0x39423922,
-0x28a128e1,0x39424183,0x20a03961,0x28e028e1,0x182020c0,0x49c328c0,0x418228e0,0x31411040,0x72c36284,0x8ba98ba9,0x8bca8368,0x62845a24,0x52236aa5,0x41c349e2,0x396420a2,0x10201840,0x08200000,0x39630800,0x83ed3984,0x49c428c0,0x28c01840,0x40e02880,0x00003123,0x20802080,0x39422900,0x39440800,0x18603140,0x28e03961,0x28e020a0,0x6ae91020,0x10200000,0x00000000,
-0x20c20000,0x20c0734b,0x52481880,0x20805248,0x49e428a2,0x08008c0b,0x00010020,0x00000000,0x18405227,0x00202080,0x00000000,0x00000000,0x00000000,0x39e610a2,0x4a0762ca,0x00000861,0x00000000,0x00000000,0x18c30861,0x39c70000,0x00000000,0x00000000,0x00001082,0x00000000,0x00000000,0x10820000,0x31650000,0x00000000,0x00000820,0x00000820,0x29030800,0x294339e5,
-0x524649e5,0x6b0a62a9,0x5aa962c9,0x00005226,0x83ab0000,0x41e32901,0x00000820,0x104018c0,0x6b2b4206,0x62ea5267,0x52475267,0x39a441e5,0x52065267,0x83ac49c4,0x8bac83ac,0x7b4b836b,0x72e97b4b,0x732b6aca,0x730b7b2b,0x6aea6aca,0x732b732b,0x18001020,0x00000000,0x00000000,0x00000000,0x10820000,0x08204a27,0x000062a9,0x6ac73921,0x730872c7,0x6ac76265,0x5a6572e8,
-0x29246266,0x00000000,0xa4b01081,0x082049a4,0x31220000,0x41a33942,0x520549a3,0x39425205,0x49624183,0x414149c3,0x52054162,0x5a255a46,0x30e05a44,0x62456286,0x626751c4,0x52055a25,0x39225205,0x520551e5,0x290128e1,0x49c32901,0x49c33940,0x52053100,0x49a32080,0x51e45205,0x18603123,0x00001880,0x28e028e1,0x39633121,0x00000800,0x08000000,0x08001020,0x104028c1,
-0x28e11000,0x20801840,0x080030e1,0x28a01040,0x30e14163,0x31013942,0x394220a0,0x28e028c1,0x72c46ac5,0x93ea8ba9,0x8bcb83a9,0x5a231840,0x52036285,0x4a0449c1,0x18602061,0x10012903,0x00000000,0x08000800,0x6ae820c0,0x39624183,0x30e03121,0x624749a3,0x20e128c0,0x080062c8,0x30e01860,0x31213921,0x31213120,0x6ac828a0,0x10401020,0x08200000,0x00000820,0x00000000,
-0x00000000,0x00000000,0x18820820,0x00001041,0x00000020,0x000020a2,0x39a320e0,0x41a141c4,0x520249e2,0x080028c0,0x00000820,0x00000000,0x00000000,0x00002964,0x18c30840,0x00001061,0x18a20000,0x00000000,0x000020e2,0x08200000,0x738d0820,0x08000800,0x528820e1,0x082083ef,0x080041e6,0x00002943,0x08200000,0x00000000,0x00000000,0x10201000,0x31640800,0x08001860,
-0x5a675247,0x5a8862c9,0x62c95247,0x00004a06,0x10800000,0x52475aa8,0x000020c1,0x00002942,0x00000000,0x18c039a3,0x6b4a0820,0x292141e4,0x49c439a3,0x73093101,0x83ac7b6b,0x8bcd836b,0x7b4b7b4b,0x732b7b4b,0x7b4c732b,0x6ae962a8,0x7b4b6b09,0x7b4a7b2a,0x00005a49,0x00000000,0x00000000,0x00000000,0x00000000,0x31840000,0x41825247,0x62465a45,0x73096265,0x6ac86ac8,
-0x00006aa6,0x5a4551e5,0x41c341c3,0x18a141e4,0x39420000,0x208041c2,0x51e55205,0x30e13122,0x41426267,0x5a2630c0,0x522641c4,0x49c44a05,0x51c33100,0x41615a25,0x41625a24,0x5a2751e4,0x41a46ae9,0x49a45a47,0x39224183,0x62665205,0x49e44183,0x49c44182,0x20803942,0x41a351e4,0x102062a8,0x29020800,0x41a449c4,0x31413121,0x104028c1,0x08000000,0x20a118a1,0x10201020,
-0x310128c1,0x208028e1,0x49a320a0,0x418430e0,0x41831000,0x29002080,0x18603101,0x31013122,0x7ae56285,0x93ea93ea,0x8bca8369,0x5a441820,0x52036aa5,0x28e249c2,0x10200800,0x00000000,0x00000000,0x08000000,0x394220c1,0x62c73120,0x41a24183,0x41833941,0x310028e0,0x31203120,0x28a028a0,0x28c03940,0x28a051e5,0x186030e1,0x08205a69,0x00000000,0x00000000,0x00000000,
-0x00000000,0x08200820,0x000020c1,0x398220c0,0x31633963,0x398218a0,0x41a23982,0x39604a04,0x52025223,0x20605a46,0x084018a0,0x00000000,0x00000000,0x29230000,0x00000000,0x00000000,0x31650000,0x000018a2,0x00003985,0x31850820,0x10610000,0x10001040,0x18a10000,0x08005a88,0x20a118a0,0x00001040,0x00001041,0x08000000,0x08001060,0x00001061,0x00000000,0x00001020,
-0x6aea6aea,0x6aea732a,0x5227732b,0x396351c6,0x08000000,0x6b2b0820,0x00005227,0x08000000,0x084018a1,0x20e00000,0x00003163,0x4a250820,0x31421060,0x6b09736a,0x7b2a7b8b,0x838c836b,0x6ac983ac,0x6ac96ae9,0x7b4b730a,0x730a836b,0x62887b4b,0x838c7b4b,0x5a687b2a,0xa491732b,0x000020c2,0x00000000,0x00000000,0x00000000,0x29020000,0x49a36286,0x392149c3,0x49c349a3,
-0x49c449c4,0x49e45a68,0x20c01020,0x31422900,0x08003984,0x418449e5,0x10203943,0x186028e1,0x49c42880,0x49c44183,0x49c549c5,0x41a349e5,0x392049c3,0x6a6651e4,0x49a372c7,0x5a252080,0x28c14183,0x62675a67,0x62875226,0x522549c3,0x49c351e4,0x49c351e5,0x30e13101,0x314220a0,0x08003123,0x086120e2,0x520649c5,0x28e272e9,0x41635205,0x00000800,0x18600000,0x20803963,
-0x28c120a0,0x31013122,0x418328a0,0x18200800,0x39413963,0x102030e1,0x312120c0,0x18603142,0x83465224,0x8baa7b28,0x8beb8369,0x72c62080,0x52247b48,0x310241a2,0x080028e2,0x00001000,0x00000800,0x00000000,0x20c00860,0x00005244,0x20e020c0,0x20803100,0x310030e0,0x28c028c0,0x28c03941,0x39423121,0x184051e5,0x00000000,0x31031860,0x00000000,0x00001040,0x41e52923,
-0x20c01860,0x104018a0,0x28a020e0,0x28c02080,0x20c01840,0x18803142,0x10000800,0x10200000,0x20a01840,0x29213101,0x080028e1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29030000,0x00000800,0x106020c1,0x08400000,0x00000000,0x10200000,0x08001020,0x31640820,0x00001040,0x20c00000,0x00000000,0x00002902,0x00000800,0x08400800,0x08200800,
-0x6aa91020,0x7b4a7309,0x41a562a9,0x41a4730b,0x62890000,0x8bee5a27,0x000049e6,0x31650000,0x084083ee,0x6b2a62e9,0x5aa85ac8,0x08002902,0x6b2a0000,0x7b4a6b29,0x73097309,0x73297309,0x7309838b,0x6ac97b4b,0x732a6ae9,0x7b2a836b,0x7b4b7b2b,0x730a6aa8,0x732a5a26,0x7b6c7b4b,0x732b62c9,0x3102940e,0x08405227,0x00000000,0x00000000,0x626749e4,0x62671840,0x39222060,
-0x5a666aa7,0x31205a46,0x31415205,0x49c428e0,0x4a065227,0x39625206,0x18803982,0x184020a0,0x62883922,0x28a051e4,0x416228c0,0x49a35a25,0x51c35225,0x62455a04,0x626759e4,0x49836287,0x41623943,0x520549a4,0x10004163,0x520549c3,0x5a055a46,0x49c34161,0x080020a0,0x310220a1,0x18801880,0x00000000,0x394230e0,0x08004162,0x41a51000,0x18c10800,0x08200000,0x08000000,
-0x18811881,0x28a01020,0x28a04163,0x206028e1,0x20601000,0x10202080,0x18803122,0x20a03122,0x7b2741c3,0x8bca8baa,0x838a8baa,0x72c61840,0x5a447307,0x182049c2,0x28e11840,0x00001060,0x08000000,0x31850820,0x18a00860,0x31612921,0x39c40800,0x20801020,0x206028c0,0x28c03942,0x20603922,0x39423100,0x18a11840,0x10201840,0x00000820,0x28800000,0x10201040,0x290020a0,
-0x18a01880,0x39841880,0x28a020c0,0x18601820,0x08400800,0x00000000,0x00001040,0x18a00800,0x000028c1,0x290020a1,0x08201881,0x00000020,0x00000000,0x08200000,0x00000000,0x20c20000,0x08001882,0x20a00800,0x10001880,0x4a0641c5,0x00000000,0x00000000,0x18600000,0x082018c1,0x31645248,0x00000800,0x100020c1,0x31820000,0x10800820,0x10401881,0x29430820,0x08001041,
-0x51c22880,0x41827308,0x49a41820,0x49a44163,0x7b095205,0x838c6247,0x5a685207,0x00003984,0x4a05732b,0x41c43142,0x39a41020,0x000041c2,0x83ac7b8b,0x7b2a838b,0x732972e8,0x7b4a732a,0x73097329,0x730a6ac9,0x72e97b4b,0x838c7b4b,0x6ae972e9,0x6ac97b4b,0x730a730a,0x72ea730a,0x72e972ea,0x6b09734b,0x732a5a66,0x7b6b7b4b,0x10403943,0x62a81880,0x18005206,0x62472881,
-0x72c76246,0x52255225,0x49e449e4,0x39615225,0x41a451e6,0x522449e5,0x39603961,0x20801860,0x31013122,0x414251c4,0x20c01840,0x30e05245,0x41826ae8,0x39215a25,0x5a471800,0x41c462a8,0x520549a4,0x51e55226,0x51e549c4,0x416249e5,0x5a255a05,0x520451e4,0x392249a3,0x210220a0,0x18803102,0x20c120e1,0x28c03963,0x49a428a0,0x18404184,0x000020a1,0x00000000,0x00000000,
-0x00000000,0x00000800,0x18600000,0x20e20800,0x29020000,0x20a01040,0x20a03122,0x188020c0,0x7b0649e4,0x8bc98baa,0x8bea83a8,0x6aa52060,0x52236ac6,0x00005203,0x00000000,0x00000000,0x00000000,0x00000000,0x29010000,0x18a041c3,0x312218c1,0x10200820,0x208028c1,0x184030e1,0x20a028c1,0x186028a0,0x106028a0,0x10400800,0x20e30000,0x41430800,0x394228c0,0x080018a0,
-0x18a00800,0x310128e1,0x08002080,0x08001061,0x20e21020,0x08011040,0x08002102,0x00000000,0x31421040,0x39a420c0,0x29430820,0x08400000,0x318141c4,0x20c25246,0x00000000,0x00000000,0x000018a1,0x10201860,0x08003121,0x08000000,0x00210000,0x10610000,0x080018a2,0x00001020,0x524920e3,0x00000000,0x000041c5,0x18603963,0x18801860,0x08001061,0x08001040,0x00001020,
-0x624530c0,0x9c0e6247,0x41623100,0x62875a67,0x72e98bed,0x186072ea,0x31235206,0x20a13123,0x314283ee,0x4a0520e1,0x52475248,0x62c95246,0x8bec7349,0x72e87b6b,0x6ae97309,0x73096ae8,0x838b8bab,0x7b4a7b4a,0x836a7329,0x7b6b730a,0x732a838c,0x6ac96ae9,0x7b6b836b,0x72e972e9,0x6ac97b2a,0x6b096b2a,0x5a465245,0x6ac87b4a,0x49e449e4,0x10205204,0x28a11000,0x30c251e6,
-0x5a043901,0x51e45a45,0x39625225,0x396120c0,0x49c55206,0x49c349c4,0x522449c3,0x524649e4,0x310149c4,0x28a04163,0x520549e5,0x39213101,0x626741a3,0x5a054163,0x18603101,0x41a30800,0x39425a26,0x51e55205,0x49c45205,0x418372e9,0x62465a26,0x5a456286,0x51c46aa7,0x08201880,0x39425226,0x08200000,0x18601000,0x62872040,0x52253942,0x00001000,0x00000000,0x00000000,
-0x00000000,0x08000000,0x08001020,0x00000800,0x00000000,0x10800000,0x31632942,0x29212921,0x8b882901,0x8bea8bcb,0x8bea8368,0x626528e0,0x52236285,0x000049c2,0x00000000,0x00000000,0x00000000,0x00000841,0x08001080,0x10800000,0x39a33183,0x102020a1,0x00000020,0x52260000,0x188020a0,0x10402080,0x08201860,0x00001060,0x08000000,0x20601860,0x31221860,0x00001040,
-0x396349e4,0x102049e4,0x08000800,0x00005227,0x00001040,0x39a62102,0x29000000,0x18600800,0x29203141,0x20e23161,0x00000000,0x00000000,0x316139a4,0x31623161,0x29032080,0x00000820,0x08200000,0x08003100,0x394328e1,0x00000800,0x08000800,0x18c32103,0x18812903,0x08200000,0x5aaa0000,0x00000000,0x00005aa8,0x20c039a5,0x10411040,0x00000000,0x108018c1,0x08200000,
-0x00003123,0x5a245a44,0x51e24180,0x38e06265,0x49e55a26,0x29056aeb,0x396462a9,0x52275a89,0x20a11040,0x080041a5,0x000020c2,0x944e0000,0x8bcc7b69,0x7b6a940d,0x6ac87309,0x730a62a8,0x8bcc6aa8,0x7329836a,0x8b8a838a,0x8bcc836a,0x730a7b2a,0x7b6b83ac,0x7b4b7b6b,0x7b496ae8,0x6ac9730a,0x62e96b0a,0x42046307,0x5a451020,0x49c349e3,0x51e541a3,0x284028c0,0x51c52860,
-0x62863901,0x5a454182,0x5a2549c2,0x418251e5,0x5a875225,0x49c55a47,0x28c04183,0x312049a3,0x28e02080,0x39423942,0x52253963,0x49e55a46,0x49e549c4,0x394251e5,0x49e451c4,0x10203941,0x41841000,0x52055206,0x28c05225,0x49a441a3,0x51e44183,0x62465a26,0x51e46286,0x288051e4,0x41a451e4,0x10000800,0x28c028c0,0x49813941,0x20804981,0x18610000,0x10001000,0x00201041,
-0x10000000,0x08200000,0x00201860,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x83671060,0x8389940b,0x838a8368,0x62842900,0x5a4472e7,0x00005224,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10810820,0x29240000,0x39a50000,0x10400000,0x28c020a0,0x41e60000,0x00001881,0x00000000,0x08001881,0x00000000,0x31423102,0x10201040,
-0x20a020c0,0x20c020a0,0x20802080,0x10401000,0x08000820,0x08002922,0x10610000,0x104020e1,0x18e10820,0x00000000,0x00002104,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x5a880000,0x08000840,0x49c40000,0x10201820,0x288172ea,0x08200800,0x08000000,0x08000021,0x39c60000,0x08000800,0x20a21880,0x00000000,0x08000820,0x10600820,0x00200000,0x10800840,
-0x30a06243,0xa44c72e7,0x72c71800,0x412151c2,0x184051c3,0x18400000,0x31236248,0x10403123,0x08003143,0x20c262c9,0x94707bad,0x8c0e8c30,0x8bec7329,0x8bcc8bed,0x730a7329,0x730a7b6b,0x7b6a838b,0x8bcb838a,0x8bab7b29,0x7b098bcc,0x8b8c7b09,0x62c8732a,0x7b6b7b4a,0x6aa7838b,0x7b4a734a,0x6ae9736a,0x39826ae8,0x49e228e0,0x49c341a1,0x30e149a3,0x5a064163,0x39224984,
-0x41a41000,0x52255a25,0x31013940,0x312049a4,0x62c86287,0x6ae95a67,0x39623963,0x41833962,0x31213962,0x41834163,0x41a44a05,0x49e441c4,0x49e55205,0x49833942,0x39624142,0x5a4541a3,0x20813962,0x49a430e1,0x28e06aa7,0x39425225,0x41421000,0x30e03101,0x72c849c3,0x51e46266,0x5a4651e4,0x20810820,0x39213101,0x49813960,0x49a24140,0x49c241c0,0x31003100,0x00000800,
-0x00001040,0x41645227,0x00002080,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7b261060,0x8389940b,0x7b687b48,0x5a451881,0x5a246ac6,0x00005224,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08600000,0x00000000,0x10610000,0x00001060,0x28e20000,0x39840800,0x00000800,0x00200000,0x00000000,0x10201060,0x29210000,0x20801000,0x000028e2,
-0x18401020,0x28e120a1,0x28c12080,0x18601000,0x08001860,0x20e10800,0x00000000,0x20a11020,0x08410001,0x08400820,0x39a60820,0x00000000,0x00200000,0x000018e3,0x00000000,0x00000000,0x49e50000,0x39a30000,0x20600000,0x49c551e5,0x080041a5,0x00000000,0x08003164,0x000020a1,0x49e61860,0x28e320c2,0x08001040,0x00000000,0x10200820,0x000018a1,0x10600820,0x186118a1,
-0x72e87b48,0x72856a84,0x49817b27,0x5a4449a1,0x49c35a24,0x10421860,0x49e683ce,0x08200800,0x102020a1,0x10403143,0x62eb4a27,0x7b8c41e8,0x9c8f8bcc,0x8bec8c0d,0x7b2a8bcc,0x7b2b72e9,0x838b836b,0x838a72e8,0x8bcb8b8b,0x7b2a836a,0x7b2b834a,0x7b6a62a8,0x73097309,0x6ac76287,0x62c762a6,0x5245738a,0x18608bab,0x52235223,0x186041a1,0x41836aa7,0x52264183,0x7b4a5205,
-0x62c86ae9,0x5a455204,0x28c05a65,0x28c049c4,0x49c56287,0x41a45206,0x41840800,0x51e53922,0x41a34183,0x39423942,0x49e549c4,0x41a45225,0x52265225,0x39213942,0x49c34183,0x41a351e4,0x52045a46,0x310151e5,0x522528e0,0x5a2649e4,0x30e028c0,0x39414983,0x51e44142,0x52046266,0x41a428a0,0x20800820,0x31203961,0x49813120,0x49604981,0x416049a1,0x51e251e1,0x49c051e0,
-0x4a0351c1,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7b060800,0x8ba98bca,0x83898ba9,0x6aa849e4,0x5a235a24,0x00005223,0x00000000,0x00000000,0x00000000,0x00200020,0x00000000,0x00000000,0x00200000,0x00000000,0x00000840,0x18801881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20801040,0x08001820,0x18800800,
-0x314128e0,0x10201860,0x18602060,0x10600800,0x08001880,0x20e118a1,0x08400000,0x00000800,0x29420840,0x00005ae8,0x00000000,0x00000000,0x21040000,0x00000000,0x000018c3,0x00000000,0x51e40840,0x20c04184,0x49c54a45,0x49a37b6a,0x000041e6,0x28e10000,0x08200000,0x08000000,0x41644184,0x00000800,0x08001880,0x00000000,0x08000000,0x21000001,0x102020a0,0x28c03941,
-0x72e672e6,0x6a8472e6,0x62647b27,0x62655a02,0x5a235a03,0x49a449a2,0x39223943,0x28e128c1,0x20a05206,0x00000800,0x20801840,0x080039a4,0x7b6b5aa8,0x8bed7bac,0x7329942d,0x628762a7,0x838b72e9,0x7b497308,0x8b8b836a,0x836b8b8b,0x73097b4a,0x6ac97b2b,0x62a76ac9,0x73077b69,0x520349e2,0x62a55a65,0x6ae77b6a,0x52225a84,0x31203960,0x5a2649c2,0x6aa75a05,0x49835205,
-0x52055a67,0x52245204,0x39413120,0x520441a2,0x39425a47,0x39633101,0x39425226,0x39424183,0x39425a26,0x394249c4,0x39624183,0x41843963,0x520641a4,0x30e03941,0x41a32080,0x49c43942,0x51e351c4,0x5a0551e4,0x41a43100,0x312120c2,0x100041c5,0x49a43942,0x41a21860,0x62875225,0x39215a05,0x28a01000,0x49e44183,0x39203120,0x41604180,0x49a049c1,0x49c04180,0x49c14180,
-0x5a4351c1,0x51e25200,0x31414982,0x00001040,0x00000001,0x00000000,0x00000000,0x00000000,0x72e60000,0x83689c2b,0x8ba98389,0x6aa628c0,0x5a445a24,0x00005202,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x4a282944,0x08400000,0x00000860,0x00000840,0x10600800,0x08000820,0x00000000,0x08000000,0x20e10000,0x08001020,0x08001860,
-0x20a00800,0x10401020,0x00001020,0x10400000,0x18600800,0x39861040,0x734b1881,0x29010000,0x5a890800,0x00000840,0x00000000,0x00000000,0x08200820,0x00000000,0x00000000,0x20c11860,0x394249e5,0x4a055224,0x310051e4,0x00004163,0x20e24182,0x292041e3,0x00001020,0x00000000,0x39a30800,0x00001020,0x00000800,0x08200800,0x000018a1,0x08002920,0x08200800,0x18601860,
-0x626272e5,0x5a425201,0x72e572e5,0x5a023920,0x41615a02,0x49c33900,0x20803101,0x10203121,0x28c05a46,0x41631820,0x18603942,0x524741c5,0x62c85267,0x8bcd5a87,0x8bab8bec,0x6ac78bac,0x7b69836a,0x8bcb8b8b,0x836a8bab,0x836a838b,0x72c87b2a,0x72ea7b2a,0x6ac872e9,0x52036ae7,0x52037327,0x49e45a64,0x62a541a2,0x5a4249e0,0x49e25221,0x41636288,0x41424142,0x5a054142,
-0x5a463922,0x520449c2,0x30e049e3,0x418041a2,0x5a465a25,0x6ae94183,0x49a43963,0x394228e1,0x39423942,0x28c05226,0x102041a4,0x20803122,0x39831840,0x290020e0,0x49a349e4,0x52055205,0x62674982,0x49a34162,0x62a749a3,0x08006b29,0x520541c3,0x31223922,0x49c33942,0x418330e0,0x5a055205,0x394349a4,0x7badbd75,0x732a9c8f,0x7b4949e4,0x49a15a24,0x51e25a02,0x49a049c1,
-0x624349a0,0x62435a43,0x49c149a0,0x49c041a0,0x498349c1,0x000018c0,0x00000000,0x00000000,0x72c50820,0x8bca93ea,0x93eb8368,0x6aa63101,0x5a236286,0x00005202,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29010000,0x08003142,0x31010800,0x18400800,0x00001000,0x10200000,0x08000800,0x00000800,0x00000000,
-0x00001080,0x08000000,0x104020c1,0x10401061,0x312320a1,0x18801860,0x08000000,0x20e10000,0x000020c2,0x00000821,0x00000000,0x00000000,0x00003123,0x00000000,0x00000020,0x314020a0,0x10205226,0x20e228c1,0x31013982,0x00205a25,0x20a01000,0x08000800,0x00001861,0x00000000,0x00003161,0x21000820,0x18801060,0x10001060,0x18611000,0x080020a1,0x20810800,0x10002080,
-0x5a406264,0x62423920,0x6aa55a42,0x51c25a42,0x5a445201,0x520449e1,0x4a2549a4,0x41a31060,0x39623142,0x51e43942,0x18604182,0x41e541a3,0x10200820,0x10800000,0x9c4e7bab,0x83aa8bec,0x73287b29,0x838b838b,0x83497b29,0x8bab7b29,0x836a834a,0x834b7b4a,0x624572e9,0x52033920,0x52023960,0x7b695a65,0x41a041c0,0x5a433960,0x5a6441a0,0x39410800,0x51e53922,0x62473922,
-0x310128c1,0x49e45204,0x49e35a45,0x41a25a45,0x6ae85203,0x4a045226,0x5a674183,0x20a05a67,0x208028e0,0x41a451e5,0x418341a4,0x20c13121,0x00000000,0x20c00000,0x18602080,0x62a81860,0x30e141a3,0x49c328e0,0x41a35a25,0x41835a46,0x29001840,0x62875206,0x39423101,0x39214162,0x5a455a45,0x49a451e5,0x18403101,0x41834163,0xb4f10000,0xacefa48f,0xaccf9c4d,0x28e07b48,
-0x418049a0,0x49a049a0,0x51e151c0,0x51e251c1,0x418241a1,0x10803983,0x00000000,0x00000000,0x72e50000,0x9c4d9c2d,0x93ab8bca,0x6ac73921,0x52036ac7,0x000062a6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21240000,0x00000000,0x00000820,0x08000800,0x18811861,0x10200800,0x10200800,0x10200800,0x10200800,0x00002901,0x00000000,
-0x20e21881,0x00000800,0x080020c2,0x00000800,0x10800800,0x18c10800,0x10601040,0x31630000,0x31451040,0x41c42083,0x082028e1,0x20a00000,0x312162a6,0x080041c3,0x08201020,0x28e03102,0x080049c4,0x00000000,0x28e020c0,0x08010800,0x6b080820,0x08200000,0x000018c2,0x10400800,0x41c36b29,0x28e03180,0x62a841a3,0x52241040,0x08203963,0x00000800,0x31212080,0x20a128c2,
-0x7ac572e3,0x62636263,0x626451c1,0x390051c1,0x52033920,0x52255204,0x29013942,0x39435226,0x31221840,0x41a328c0,0x20e03101,0x10404183,0x29011080,0x41e520e1,0x8c0e4a07,0x8bcc8c0d,0x7309838b,0x7b6a8bab,0x7b09836b,0x7b2a7b2a,0x834a72e9,0x7b297b4a,0x6a8672e8,0x6a857b28,0x49a14181,0x49c25a63,0x41c041a1,0x5a636ac4,0x49e13960,0x416228e0,0x394120a0,0x39211840,
-0x49e46ac9,0x8bcb5204,0x396151e3,0x520349e3,0x41a15203,0x49e362a6,0x49c55205,0x31213963,0x184028e0,0x39220800,0x31213983,0x18802901,0x10813144,0x08200000,0x20800000,0x31413122,0x41625a68,0x41a341a3,0x520549c4,0x49e449a3,0x314251e4,0x39633942,0x18603942,0x310128e0,0x31213122,0x49c45a46,0x20603942,0x49c328a0,0x49624162,0x49c472c7,0x28e02080,0x9c70bd94,
-0x8c0da490,0x73076ae7,0x31405204,0x51e149e2,0x28e03940,0x20a21020,0x00000800,0x00000000,0x6aa50000,0x83889c2c,0x93eb8ba8,0x73082040,0x520372e8,0x00005a44,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000031a6,0x00000000,0x08410000,0x102028e3,0x10400800,0x00000800,0x08000000,0x00000800,0x00000000,0x000010a1,0x00000000,
-0x00000000,0x00000000,0x00000000,0x08200000,0x08000000,0x20e30000,0x18e32103,0x00001020,0x08000800,0x08007b6b,0x29003142,0x31413120,0xad1062a4,0x28c21840,0x310230e1,0x41a33963,0x10402060,0x00000020,0x41a518a1,0x18803982,0x6aea8c0c,0x4a045245,0x000018a0,0x31420000,0x31614a05,0x39803160,0x20c05204,0x7b47bdb0,0x1080944d,0x08203142,0x08001040,0x08001060,
-0x7b0493e6,0x49a05a22,0x49a16283,0x5a036a85,0x49c05202,0x10003980,0x29211860,0x5a872901,0x39435a46,0x28e01820,0x000028e0,0x20e139a3,0x000062ea,0x00000000,0x00000021,0x8c0d3184,0x83ed8c2e,0x73097b4a,0x6ae8734a,0x6ac87b4a,0x72c86ac8,0x838a7b29,0x7b097b49,0x49c27b49,0x5a456286,0x624251e1,0x52014a01,0x5a6341a0,0x396049e1,0x41825203,0x188028c0,0x416130e0,
-0x5a0549a3,0x49c35a45,0x28c06286,0x62853961,0x52046ac7,0x41a362a6,0x31025225,0x39633963,0x20a21000,0x31203942,0x39433922,0x10600800,0x31840820,0x10400000,0x28e20800,0x28c02080,0x41832881,0x5a063922,0x49c451e4,0x49c349e4,0x398349e4,0x39211840,0x292128e0,0x28c03121,0x520528a0,0x18603122,0x5a254162,0x49833921,0x20604983,0x49e35205,0x394149c3,0x00001041,
-0x18801840,0x31611861,0x836a2921,0x5a869c50,0x314249c5,0x208028e0,0x00010000,0x00000000,0x5a230000,0x93ea8bca,0x8baa8bc9,0x73083920,0x52046285,0x000051e2,0x00000000,0x00000000,0x00000020,0x00000021,0x10600800,0x00000000,0x00400000,0x000039c6,0x00000840,0x10000800,0x000018a2,0x002028c3,0x00001000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10411020,0x000041a1,0x49e22080,0x30e028e0,0xb55149a4,0x10003140,0x08000000,0x288028a0,0x29203982,0x00000000,0x00001060,0x8bef0001,0x18803982,0x49e31000,0x51e51880,0x208028e0,0x39c00800,0x420141e1,0x31a02960,0x21004222,0x52855285,0x294018a0,0x080020c0,0x00000000,0x18401861,
-0x6a8372e4,0x51c06a63,0x51c15a22,0x51c25a23,0x49c230e0,0x10011020,0x08403965,0x08000000,0x398141a3,0x49c32080,0x41a349a3,0x736b3162,0x1020734b,0x5a265a88,0x1040836b,0x734b3984,0x9c8f9c6f,0x734983cb,0x734a7b8b,0x73097b6a,0x7b297309,0x6aa77b49,0x6aa75a45,0x73078369,0x5a246ac6,0x41a04181,0x6ac56ae6,0x522241a0,0x41a15222,0x20a03120,0x184028e0,0x49831000,
-0x6aa849a3,0x520451e4,0x49e33920,0x49e34182,0x31005a45,0x20a05a45,0x41a341c3,0x31210800,0x314128e0,0x18602080,0x41c420c0,0x104020c0,0x39630000,0x4a2541a4,0x31633983,0x10403964,0x00000800,0x08001860,0x520530e0,0x49c349c4,0x396149e4,0x20c03961,0x08401080,0x31210820,0x208049a4,0x520549a4,0x6a8749a3,0x414151c4,0x49e44182,0x31005205,0x520428c0,0x00001000,
-0x10200800,0x08200800,0x39210800,0x41a33140,0x39623141,0x49e341a3,0x39423941,0x00000800,0x51c10000,0x93ea8388,0x93cb940b,0x730730c1,0x5a246a86,0x000051c2,0x39640000,0x00000000,0x08000800,0x18400800,0x28e030c0,0x00001060,0x00000000,0x000039e7,0x08000000,0x20811861,0x08000800,0x00201041,0x00001061,0x08000000,0x00000800,0x00000000,0x20e00000,0x18800800,
-0x10401020,0x08000800,0x00000820,0x00000000,0x00000000,0x08200000,0x00000000,0x41c42903,0x29017b8b,0x28e16ae9,0x41821860,0x28e041a3,0x52016b06,0x08203160,0x00000000,0x62ec0000,0x00000000,0x10611040,0x52460000,0x52051040,0x18400800,0x41a41080,0x18203943,0x42010800,0x29205264,0x29411900,0x29202100,0x210039a1,0x29205243,0x290120c0,0x080018a1,0x31221840,
-0x5a236a64,0x49805a01,0x51e24180,0x39005202,0x310051e2,0x49e34180,0x394041a0,0x080030e0,0x20a01000,0x41a25204,0x520351c4,0x082018a0,0x4a260800,0x5226940c,0x28c01880,0x39635a67,0x00000820,0x7b8a840c,0x732a7309,0x62a772e8,0x72c77309,0x73087b49,0x6a876286,0x628551e3,0x52036265,0x6ae662a6,0x62a562a5,0x62c45a43,0x62846ae5,0x62865a65,0x41c349e4,0x52034182,
-0x49a43100,0x5a4549c3,0x5a243920,0x396141a2,0x49e349c3,0x396149c3,0x39613961,0x49e33961,0x20a02901,0x18600800,0x00003166,0x08000801,0x41830000,0x210041a3,0x000041c3,0x00000000,0x00000000,0x08001061,0x39210800,0x416230e0,0x49e34182,0x18a02900,0x00010840,0x08000000,0x28c03942,0x41832060,0x41416246,0x41425204,0x30e03921,0x49c21000,0x310041a2,0x188049e2,
-0x29210820,0x29201060,0x184020e1,0x10001000,0x10201020,0x28e11880,0x28804163,0x20c23141,0x5a211040,0x8ba98bca,0x9bec8bc9,0x62862841,0x52046265,0x00005a44,0x31630000,0x00000000,0x00000000,0x10200800,0x28e020a0,0x00005247,0x00200000,0x00002124,0x08000000,0x08003165,0x08001000,0x00401061,0x00000000,0x31220000,0x28e13122,0x18401860,0x20611040,0x20a01020,
-0x28c03141,0x18614164,0x00001882,0x00000000,0x00000000,0x00000000,0x08000800,0x20e00800,0x39603961,0x184041e1,0x10006287,0x08000800,0x10000800,0x08200800,0x00000000,0x00000020,0x00000000,0x08205a89,0x080018a0,0x49e52900,0x00001000,0x39842102,0x49e5734a,0x41e10000,0x39a12920,0x296031a2,0x29004222,0x4a212940,0x292039a1,0x290120c1,0x102020c1,0x20a028c1,
-0x5a0151e0,0x5a025a02,0x30c051c1,0x51e349a2,0x49e251e2,0x52034181,0x51e35203,0x41a230e0,0x18403962,0x30e04181,0x41a23940,0x184028c0,0x73293942,0x5a665224,0x52237b49,0x62e941a2,0x00000820,0x18c10000,0x52456b09,0x73086ac7,0x7b495a65,0x73076ac7,0x41a25224,0x52234a03,0x312041a1,0x62c6944c,0x5a634a22,0x4a2339a0,0x5a443140,0x62666245,0x52245a45,0x52245203,
-0x51e44162,0x41a35225,0x28c05a25,0x28e028c0,0x49e33960,0x4a0449a3,0x28e05225,0x41a23981,0x18805224,0x108020c0,0x00000820,0x08400000,0x208049e3,0x39823120,0x18a03162,0x20e13163,0x08201040,0x104020a1,0x10400800,0x08001020,0x39822902,0x18a03982,0x10410820,0x00000000,0x08000000,0x41823163,0x49a349c3,0x41825a05,0x51e430e0,0x41824162,0x39223962,0x39423921,
-0x208049c5,0x18603121,0x28e120a0,0x39633943,0x08000820,0x00000820,0x18c20000,0x10402921,0x6a830820,0x93eb9c2c,0x93ec93ca,0x628649a1,0x5a456286,0x00005202,0x39830000,0x31001000,0x51e320a0,0x49c25ac3,0x29221061,0x00000820,0x10a20000,0x00000861,0x00000000,0x10401040,0x00000800,0x00000861,0x00000000,0x08000000,0x18400800,0x20a028c0,0x20a01860,0x206028c0,
-0x20a02060,0x20602080,0x08002080,0x00000000,0x00000000,0x00000000,0x00211020,0x00001041,0x31213942,0x5aa741a3,0x290220c0,0x10201880,0x20c01860,0x08000800,0x00000000,0x08400000,0x10400800,0x08200820,0x000020c2,0x39810820,0x10001020,0x106020e1,0x18a03982,0x39c20800,0x41e13160,0x4a432940,0x29011060,0x18e02940,0x18800840,0x086018c1,0x20c020c0,0x20c020a0,
-0x41617b49,0x49c15a22,0x30e05a22,0x39004140,0x52024160,0x49a249a1,0x30e04181,0x51e251e2,0x31003920,0x49c42080,0x418149c2,0x52052080,0x62879c6f,0x2100942d,0x41c362e7,0x4a450840,0x31633183,0x736c1080,0x31a20840,0x62c620e0,0x62c72920,0x310062a6,0x4a0441a2,0x49e25a85,0x524462a5,0x39813961,0x4a0241e1,0x39a16ae5,0x39205244,0x49c33941,0x5a455a45,0x49e451e4,
-0x49a45a26,0x52045204,0x28c04182,0x62865204,0x312049c3,0x31203921,0x49e34a04,0x4a0341a2,0x290049e2,0x10803141,0x00000820,0x31420000,0x39614162,0x20c03140,0x29222921,0x29013963,0x20c028c1,0x316320a0,0x10201820,0x000018c1,0x31630800,0x21014a04,0x08200000,0x00000000,0x00000000,0x20a10000,0x520430c0,0x414130e0,0x392151e4,0x49c42060,0x08001000,0x20602080,
-0x39424162,0x18401880,0x31412081,0x102020a0,0x18c20000,0x00000000,0x00000000,0x00000000,0x7b050000,0x93ea9c2b,0x9c4d93ca,0x6aa63920,0x5a656aa6,0x00005202,0x39620000,0x41603100,0x522049c0,0x5a2049c0,0x08400000,0x00000000,0x21030000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18600800,0x10001860,0x08000800,0x18602080,
-0x100028a0,0x31212060,0x00003941,0x08000000,0x18c20800,0x082041e6,0x08200000,0x000020e2,0x186028e0,0x00006ae9,0x00000000,0x10200820,0x10405206,0x10600000,0x00000000,0x20e10000,0x106041c3,0x00005227,0x10a10000,0x52460820,0x5a6728c0,0x00000820,0x29003161,0x42022940,0x31603160,0x000041e1,0x4a441080,0x084031a1,0x08001060,0x10800820,0x4a042902,0x18403121,
-0x41a17329,0x62444180,0x5a236264,0x31003941,0x31013941,0x08001840,0x310049c3,0x51e249a2,0x49c251e2,0x312128c0,0x62c628c0,0x52261860,0x39626b4a,0x42045a86,0x00000000,0x18c00820,0x7bce18c1,0x000039c5,0x52a639c2,0x00203161,0x00000000,0x520462a6,0x20c028c0,0x41a220c0,0x39812920,0x49e24a03,0x522341a1,0x20c041a0,0x41614182,0x5a454161,0x52255a66,0x41a35204,
-0x39624162,0x51e43921,0x49e44182,0x49e35a45,0x49e45224,0x41626ac7,0x49a328c0,0x39405224,0x394141a1,0x49c520a0,0x628928e2,0x49e43102,0x312141c4,0x31423141,0x20e15268,0x188020a2,0x18610800,0x31211000,0x00001040,0x00001040,0x00000000,0x00000000,0x00000000,0x00000820,0x00000000,0x00200000,0x62a741c1,0x49c34180,0x28a05a04,0x28c04983,0x08003102,0x10003101,
-0x10401020,0x290020c0,0x31013121,0x00003101,0x00000000,0x00000000,0x00000000,0x00000000,0x8b680000,0x8bca9c2b,0x8bec8beb,0x62651000,0x52226aa7,0x000049e2,0x18400000,0x39603940,0x51e06a84,0x49a04a00,0x00000000,0x00000820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000820,0x00000000,0x00000000,0x08201041,0x00000000,0x20601820,0x18601840,0x10201020,
-0x20a01861,0x396249e3,0x080041c3,0x18c20000,0x00001880,0x00000841,0x00003143,0x10800000,0x10403963,0x00000800,0x21030000,0x20c00000,0x08010840,0x08401880,0x08205246,0x52251860,0x102020a0,0x4a051080,0x20e020e1,0x20a02920,0x102041a2,0x08001880,0x29003961,0x31403160,0x52635262,0x4a2439a0,0x42051060,0x39c44a24,0x29213183,0x08400000,0x290020a0,0x6ac83102,
-0x39804180,0x62434180,0x5a6449a1,0x49a251e2,0x41812060,0x28e11000,0x390028a0,0x310030e0,0x41814181,0x28c03940,0x41c228c0,0x000051e6,0x00000000,0x4a050000,0x08207b8c,0x000039e4,0x00000000,0x18a139c5,0x39c42921,0x08400000,0x00001040,0x28e12080,0x41a11040,0x314041a2,0x6b063960,0x10402900,0x49c15a25,0x39805262,0x28c041a1,0x41632900,0x49c341a3,0x394149c3,
-0x394228c0,0x51e55226,0x49e45204,0x49a45225,0x39635206,0x4a053922,0x41a22920,0x52023940,0x28c05204,0x41c42080,0x39822900,0x4a0449e4,0x39824a03,0x316241c4,0x00007bab,0x10601040,0x39844a27,0x29011860,0x20e12922,0x18803144,0x290018a0,0x20c041a3,0x104028e1,0x08001040,0x10610000,0x10400820,0x28c01020,0x41625a26,0x18404142,0x41a349a3,0x62884183,0x18803962,
-0x10600000,0x31027b6c,0x28e03942,0x00002901,0x00000000,0x00000000,0x00000000,0x00000000,0x83270000,0x8bcaa44b,0x49e55204,0x72c71000,0x52225a45,0x000041a1,0x28c00800,0x39203920,0x5a405a42,0x51c05200,0x00000000,0x00002924,0x00000861,0x00000000,0x00000000,0x00000000,0x00000820,0x08000000,0x10410000,0x104028a0,0x316320c1,0x20603962,0x31221020,0x396220a0,
-0x10001880,0x28c22900,0x83ce1000,0x00000000,0x28e13983,0x08200000,0x000018a2,0x00000000,0x21030000,0x10201063,0x00000020,0x188139a5,0x08002923,0x00000820,0x52450820,0x396249c4,0x082049e2,0x39822922,0x106041c4,0x00004a24,0x41832900,0x31002080,0x41a241c2,0x28e04a02,0x31403160,0x294228e0,0x18c00000,0x10400000,0x188018a0,0x39841040,0x18601000,0x208028c0,
-0x52425223,0x49c26284,0x41a15221,0x31203900,0x39022900,0x30e02080,0x39623902,0x28c02900,0x41803102,0x41a149c2,0x208128e0,0x00003121,0x00000821,0x42253a06,0x62e818e0,0x00002923,0x10801080,0x10a10000,0x63290000,0x31810000,0x08202100,0x52280001,0x62a683ad,0x312041a2,0x10405224,0x31005244,0x524439a2,0x62a549e2,0x296141c2,0x41820000,0x29013982,0x312241a2,
-0x18603921,0x62c96aa8,0x41e30860,0x28c028e0,0x20a049c4,0x208049c4,0x5a454183,0x41a14162,0x62a85204,0x41a35205,0x52043961,0x398120a0,0x316139c2,0x41c44203,0x10603161,0x082020c1,0x08200000,0x102028c2,0x00002923,0x10203123,0x39623962,0x106028c0,0x18e218c1,0x00000000,0x10400800,0x08200000,0x49c428a1,0x5a4549e2,0x30e24184,0x394349a4,0x28e130e2,0x20a02060,
-0x394228c0,0x31613961,0x20e23161,0x29201060,0x00000000,0x00000000,0x00000000,0x00000000,0x51e20000,0x7b48944b,0x20a05203,0x62651861,0x5a436ac5,0x000141a3,0x20a00000,0x39604181,0x52005a41,0x39606260,0x00000000,0x00003985,0x00002944,0x00000000,0x00000000,0x00000000,0x08001081,0x28e20800,0x10202040,0x28e22901,0x10003140,0x20a02081,0x418228e0,0x39413902,
-0x20a03140,0x18201000,0x00203122,0x00000000,0x08204a05,0x00200840,0x31641060,0x00000000,0x18601861,0x00002904,0x29020860,0x00001840,0x00030000,0x08600860,0x08202920,0x62c80000,0x00005aa6,0x10602120,0x08200820,0x10202900,0x28e01040,0x20803120,0x20a049c1,0x49e249e2,0x522420a0,0x39813982,0x10801080,0x20800000,0x18401840,0x28c01000,0x18402080,0x186020a0,
-0x31003961,0x31206284,0x39420800,0x080028c0,0x18601041,0x312118a1,0x28c03121,0x20a02900,0x4a0228a0,0x41a13940,0x28e028e0,0x52451820,0x00000800,0x08200840,0x29222901,0x000020e2,0x4a480820,0x00000000,0x63295287,0x00003165,0x00000000,0x62ea3143,0x20c00800,0x31213962,0x6b482940,0x944d4203,0x29205244,0x20c03961,0x28e03961,0x41a34a05,0x39432080,0x52063141,
-0x6ac851e4,0x52463101,0x08000000,0x5a460800,0x41643101,0x52051000,0x30e049a3,0x41a11860,0x28e049e2,0x20a028e0,0x49e43982,0x41a241c3,0x4a243181,0x29002900,0x4a0318a0,0x31413981,0x524649e6,0x00000000,0x104018a0,0x10001880,0x20600800,0x28e03101,0x082039a3,0x08201840,0x39432080,0x20a12080,0x392228c1,0x5a2628e0,0x206051e6,0x10007309,0x41847b4b,0x49c52080,
-0x20801840,0x100028a1,0x10001000,0x18400800,0x10601861,0x08000800,0x080028e2,0x00000000,0x18400000,0x20805a46,0x080028c0,0x62653120,0x52026264,0x00002080,0x312020e0,0x41813100,0x52214a21,0x18804182,0x18c20000,0x00003984,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x10400000,0x08001020,0x080020e2,0x20a01860,0x08001021,0x00003985,0x104049c6,
-0x10201840,0x20a01860,0x29233123,0x08000820,0x4a2741c4,0x4a8a62ea,0x00000000,0x21030000,0x20a03145,0x08400800,0x00000000,0x08401020,0x20e00000,0x00000000,0x082062e8,0x08000820,0x08200840,0x39c50000,0x21010000,0x52453141,0x41c21860,0x39604181,0x396049c1,0x52033960,0x398141c2,0x20a11860,0x00000800,0x20a220e2,0x188020a0,0x20a01860,0x20a21860,0x20801840,
-0x080028c0,0x31020000,0x312041a3,0x08205245,0x20a10840,0x18820000,0x10200800,0x394128e0,0x31402080,0x28c05223,0x39413960,0x39412880,0x29203962,0x29005286,0x00004a03,0x00003144,0x00000820,0x00000000,0x19006b4a,0x00200020,0x00000000,0x41a528c3,0x52053983,0x52053142,0x000018c0,0x73690040,0x318120e0,0x20c028e0,0x18401860,0x28e11860,0x28e11020,0x49e55224,
-0x41a341a3,0x29203962,0x08010001,0x28e11000,0x49c241a4,0x100041a2,0x41833921,0x49c21860,0x41a220a0,0x52253141,0x41c33961,0x31613100,0x29213161,0x29401880,0x39413162,0x49843942,0x394149c4,0x00012102,0x20c01860,0x41a23142,0x39424a03,0x28c049e4,0x52665a46,0x52063121,0x416249a4,0x28c13921,0x080028c0,0x20801820,0x394428c2,0x30e14163,0x18201000,0x28a11000,
-0x49c530e1,0x5a055a06,0x52026a87,0x41e249e1,0x49c241c1,0x39014181,0x30c030c0,0x08201040,0x52230000,0x41813120,0x314249c2,0x72e720a0,0x49e25a43,0x00002080,0x52041860,0x31213100,0x28e01020,0x08001820,0x00200000,0x31851020,0x00000000,0x00000000,0x738e0000,0x08210000,0x00001000,0x00000000,0x31430800,0x08001041,0x10402080,0x18601020,0x00003164,0x08200800,
-0x28c20800,0x184041a6,0x20c13961,0x20a01060,0x00005226,0x00000820,0x00200000,0x000020e3,0x20a02904,0x08200800,0x00000000,0x08000000,0x28e00820,0x08000000,0x20e12940,0x18807b8a,0x00001061,0x18e018e0,0x736941e4,0x52245aa6,0x6b063980,0x31205223,0x52235223,0x20c020a0,0x49e34a23,0x08001020,0x00001060,0x20a00820,0x20811840,0x28e13140,0x10201861,0x18201021,
-0x208020a0,0x394128c0,0x52423960,0x62a45a64,0x28c03120,0x102028e0,0x28c020a0,0x28a03101,0x5a4541a3,0x182049a4,0x414151c2,0x62a741a1,0x39425206,0x08000800,0x000020c0,0xc6155ac9,0x312041e4,0x20e05243,0x4a460840,0x41e34a04,0x31012100,0x08001000,0x29021040,0x08003164,0x18810820,0x21015ac8,0x31a35ac8,0x080018c1,0x310128c0,0x100028c1,0x28c03122,0x5a6549e4,
-0x62a75205,0x20e12921,0x184020a0,0x28a018a0,0x418228c0,0x39623921,0x10001880,0x41821840,0x20a01840,0x5a653981,0x4a044204,0x18a020e0,0x39c25286,0x4a2239a1,0x18203981,0x31012080,0x5a464163,0x396251e4,0x41a33121,0x49a33101,0x41a349c4,0x290049a3,0x41c241c2,0x28c03122,0x39621840,0x206049c3,0x72e749a3,0x51e26aa5,0x6aa55202,0x52025a43,0x5a226283,0x5a235a02,
-0x51e25a22,0x5a235a23,0x51c251e2,0x49c151e2,0x41604160,0x28e04161,0x28a028c0,0x10001860,0x838a0820,0x41625a44,0x41a33901,0x62a63101,0x20805203,0x00001020,0x520428a1,0x418228e0,0x00000821,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x08200840,0x00000800,0x00000020,0x20c21020,0x00000820,0x10002081,0x00005205,0x082041e5,0x08001020,
-0x08000800,0x39431881,0x104028e0,0x18203162,0x000020c1,0x00000000,0x00000000,0x00003164,0x31631041,0x00000000,0x41c70000,0x08201041,0x18604162,0x28c01000,0x29221020,0x00000000,0x31421020,0x080020e0,0x18a04a06,0x39603161,0x394041c0,0x39814a02,0x20c041a1,0x49e249e3,0x188020e0,0x08201860,0x08000000,0x20601040,0x08201840,0x08011020,0x00000000,0x10201000,
-0x4a025a64,0x52425222,0x52426285,0x730862c4,0x49e162c4,0x41813940,0x39413921,0x312049c3,0x6ac849e4,0x20a020c0,0x00000000,0x31420800,0x188062c6,0x29004a05,0x00200800,0x6b4918c0,0x6ac8bd93,0x41e41880,0x42242100,0x31635226,0x28c15267,0x08000800,0x08009cb1,0x39a41020,0x31640000,0x29625ac9,0x420431a2,0x080039c3,0x28e02080,0x5a463123,0x628549e4,0x628772e8,
-0x41c341a2,0x10602100,0x18201000,0x20601840,0x49c34183,0x39415204,0x080020a0,0x29003962,0x18601060,0x188028e0,0x18803982,0x294039c3,0x29202900,0x316039a1,0x49a420c0,0x49c428a0,0x52265a26,0x49c451e4,0x51e32080,0x49c451e4,0x41824183,0x000049c3,0x10403942,0x28e13963,0x41816265,0x49c23940,0x5a445204,0x5a026284,0x6a6459e1,0x51c16a64,0x49805a02,0x520251e1,
-0x5a215201,0x5a235a03,0x498151c2,0x498149a1,0x39204160,0x28a03921,0x206028a0,0x10002080,0x7b281860,0x5a256aa6,0x20803921,0x62873121,0x102049e4,0x00200800,0x31202060,0x49a32080,0x49c27308,0x52034161,0x000049c2,0x00004207,0x00000000,0x00000000,0x08610000,0x00000000,0x08000000,0x10400000,0x08001840,0x08000000,0x08000800,0x18224184,0x292320c1,0x18403141,
-0x10603142,0x52450820,0x7b6b1860,0x08001060,0x10a20000,0x00000000,0x00000840,0x08201040,0x00001800,0x00000000,0x41a551e5,0x000028c1,0x62874983,0x41a36287,0x08010800,0x00000000,0x29414a25,0x20e03140,0x20e039a2,0x30e00820,0x49c25a65,0x39803160,0x29402100,0x08005a86,0x000018c1,0x08410000,0x00000840,0x20810820,0x08000800,0x08000800,0x5a271020,0x10001020,
-0x52413961,0x31205222,0x62a56264,0x62647307,0x5a435a43,0x41a26285,0x184028c0,0x312149e3,0x080020a0,0x00000000,0x00000000,0x41c50000,0x4a252920,0x52a42101,0x08400000,0x524339a2,0x41c33140,0x18803982,0x18811060,0x00000000,0x00000000,0x29450000,0x18811080,0x20e20000,0x29240840,0x10800020,0x10a00840,0x00000000,0x28e03982,0x72e73940,0x62657b49,0x628662a6,
-0x49c341a2,0x41a24182,0x5a063100,0x39216a86,0x28e05a25,0x49c41840,0x39623963,0x31022080,0x10202080,0x10802921,0x398120c0,0x49e320c0,0x29002900,0x312041a2,0x080030e0,0x28e120a0,0x31411040,0x49c449e4,0x520541a3,0x52055205,0x52044183,0x39843941,0x31430800,0x28a10800,0x62863920,0x5a237b48,0x51e151e1,0x51e05a22,0x5a2251c0,0x62426263,0x49605a22,0x51e15a02,
-0x5a245a04,0x31005a23,0x49c23140,0x940c8bcb,0x62869c4c,0x288049a2,0x28e03100,0x39621880,0x62653962,0x8bcb7329,0x49e53100,0x41822080,0x000028c0,0x18810000,0x392028e0,0x7b061000,0x5a017ac5,0x49a049c0,0x000051c1,0x00000000,0x00000000,0x08410020,0x00000000,0x18a20000,0x10000800,0x186028c2,0x08002080,0x08000000,0x18404184,0x20a00800,0x31015205,0x41833101,
-0x28e05245,0x188020a0,0x00002900,0x00000000,0x000020c2,0x00000000,0x00000000,0x39640000,0x000041c4,0xad133985,0x00000000,0x41a328e2,0x49a37b6b,0x49a549a4,0xacf249e5,0x39823982,0x20e018c0,0x31a22961,0x188020e0,0x49e31060,0x31401020,0x08200820,0x420420e0,0x08201040,0x00200860,0x08200820,0x08000000,0x18820800,0x10202082,0x10201860,0x10001000,0x314241a3,
-0x49c049c0,0x5a8341a0,0x5a4351e2,0x522272e6,0x49c15a22,0x41a15203,0x18803121,0x08003120,0x08210800,0x20c10000,0x20e25267,0xa4f10020,0x20c00800,0x29600000,0x3a041060,0x31813161,0x20e03161,0x18c18c0e,0x080039a4,0x422839c6,0x00000000,0x00000000,0x08203184,0x000039a5,0x18a22923,0x00002122,0x08400000,0x10001080,0x416141a2,0x62a67329,0x73287328,0x41a26265,
-0x18204162,0x396149c3,0x310051e4,0x51c451e4,0x51e449c3,0x5a6751e4,0x41c45205,0x20c03142,0x31614183,0x5a862900,0x08202901,0x41a21060,0x314049e2,0x41a241a2,0x5a464182,0x52255225,0x31225a67,0x51e43942,0x49c449c4,0x5a664183,0x41825205,0x39424162,0x186049a4,0x28c00800,0x626549a2,0x62655204,0x418151e3,0x51e35203,0x730851e3,0xc5519c0c,0xaccfacae,0x49e37308,
-0x310128e0,0x52453921,0x49c40800,0x080028c0,0x520420a0,0x390051e3,0x29003100,0x28c03121,0x390041c3,0x39419c4d,0x28c03921,0x206020a0,0x10204162,0x39420000,0x7ae528a0,0x82e572a3,0x5a017ac5,0x49a05a41,0x10813920,0x00000000,0x00000000,0x29450000,0x18c20000,0x31650000,0x00200800,0x10201000,0x310228e0,0x10600800,0x184028c0,0x18202040,0x10002080,0x30e05205,
-0x39623160,0x290241a4,0x39441040,0x08000800,0x18a13943,0x08400000,0x00000000,0x31021080,0x102062a8,0x080018a0,0x5a6662e7,0x00001000,0x39210800,0x49a41840,0x10403941,0x20e03982,0x084018a0,0x00000000,0x29202101,0x41c23180,0x18a03142,0x20a020e0,0x10601880,0x08200800,0x08200800,0x10411021,0x00001020,0x00000000,0x29430000,0x10003964,0x28e21000,0x10011001,
-0x62a341a0,0x62646ae4,0x41a15222,0x41a15222,0x5a434161,0x51c349a3,0x28c049a1,0x10404161,0x082041c5,0x4a0520c1,0x29222102,0x41c50000,0x20e041c1,0x52823160,0x4a243164,0x108031a2,0x10600000,0x21006b69,0x52880000,0x31645a88,0x21015aa9,0x082018c1,0x00000000,0x18a10000,0x10610000,0x20c10820,0x10401040,0x18011860,0x7b6a51e3,0x7329838b,0x6ac862a7,0x28e06265,
-0x52243100,0x49e449c5,0x52042060,0x28a030e0,0x28e13981,0x00004182,0x28e00000,0x31211020,0x210220a0,0x00000000,0x290041c4,0x210020c0,0x52252900,0x41c13140,0x5a474182,0x396149a4,0x106039a2,0x18603101,0x49c43962,0x5a4551a4,0x49c45204,0x51e54183,0x31214183,0x418349a4,0x5a445203,0x73086ac7,0x39413922,0x49c341a2,0x392151e4,0x49c34162,0x41825a25,0x41823100,
-0x414149a2,0x628749e4,0x28c028e0,0x28a03101,0x41a21840,0x41a249c4,0x39403961,0x290020c0,0x51e33920,0x1000a48f,0x28e228c0,0x31210000,0x18a03943,0x310028a1,0x72a351a3,0x832672a3,0x51c07283,0x418051e0,0x00003120,0x00000000,0x00000000,0x4a680000,0x00000000,0x00000820,0x08000840,0x082020e3,0x29230800,0x30e10820,0x20604163,0x204051c4,0x20c041e5,0x5a871040,
-0x20a13101,0x29021020,0x396118a1,0x62e9730c,0x10402922,0x18820800,0x08400000,0x31221860,0x942b0800,0x5aa44180,0x08001880,0x188028c0,0x10401040,0x39601840,0x29004a04,0x18603141,0x18a00000,0x29420000,0x49e318c0,0x29203980,0x41c22940,0x20e12940,0x08004a04,0x10200820,0x31031000,0x18612061,0x08401000,0x08005268,0x20810000,0x00000820,0x31221000,0x28c02080,
-0x62a45242,0x5a445202,0x28a049e1,0x180030e0,0x49c31000,0x18205222,0x51e34181,0x41c130e0,0x20a13141,0x10400800,0x18a00800,0x49e31080,0x10605a84,0x39e04a41,0x52850000,0x08202100,0x00000000,0x00002922,0x18a00000,0x41e44a05,0x20e120e1,0x10600000,0x08210000,0x08210801,0x00000000,0x00002944,0x08000000,0x10200000,0x7b8b3120,0x6ae97329,0x520462a8,0x52035a24,
-0x310049e3,0x28c04183,0x30e049c3,0x394149a2,0x522541a2,0x29200820,0x08003964,0x10400800,0x00000800,0x39c50000,0x20c020e0,0x39a25266,0x31001020,0x29204a03,0x20a01040,0x20c03121,0x18a039a2,0x20c11040,0x31620820,0x520549c5,0x5a4649a4,0x41634183,0x51e43942,0x208049c4,0x41623962,0x312149c4,0x41833943,0x62463100,0x51c45204,0x208049a3,0x49c349e4,0x5a243100,
-0x52045204,0x5a2449c3,0x39416286,0x30e028c0,0x31002080,0x49a330e0,0x41825a25,0x39823982,0x39623962,0x416251e5,0x10003120,0x31011000,0x108049c5,0x20a00800,0x41603940,0x62416aa4,0x49c06243,0x49c149e0,0x00001880,0x00000000,0x00000000,0x00000000,0x00202103,0x00000000,0x08000000,0x00003164,0x10200000,0x41830800,0x62663942,0x28a049a3,0x20a020a1,0x28e05205,
-0x28e15244,0x20a049c4,0x20e00000,0x104041a7,0x18a020c0,0x41e43142,0x290049e5,0x20a020a0,0x6ae51020,0x736741a0,0x20c05a64,0x29225246,0x18600800,0x20a04a05,0x39411860,0x00005265,0x41e30800,0x31212921,0x4a042900,0x31611860,0x20c04a04,0x080020c1,0x18801880,0x08001060,0x08000800,0x10001020,0x08001860,0x318520c2,0x00000800,0x08201060,0x10201020,0x18603122,
-0x62a349c0,0x62a55202,0x73076a88,0x49a349a2,0x6a862860,0x49a14141,0x52034982,0x5a4449a2,0x10202080,0x08011040,0x08000000,0x418041c2,0x20804180,0x21005262,0x31810820,0x000020e1,0x39e60860,0x08601902,0x08602142,0x00000000,0x00000000,0x00000000,0x08200020,0x10406b4c,0x00002965,0x00000000,0x08204205,0x31220000,0x83ac3122,0x41c241a3,0x7b6a3140,0x41a220c0,
-0x41a25203,0x5a655a45,0x184051c4,0x31203983,0x10004185,0x18c041c2,0x20a01040,0x10003102,0x4a2562e7,0x528762e8,0x00000880,0x7b4a0800,0x5a657308,0x49c35224,0x18a01880,0x08003982,0x314139a2,0x10411041,0x20801860,0x51e43963,0x49e43101,0x41633963,0x392249a4,0x520551e6,0x51e451e4,0x10400800,0x10400000,0x41c60800,0x51c43922,0x392149a3,0x41624982,0x39415a25,
-0x51e349a2,0x208049a2,0x30e049a2,0x41614162,0x5a243100,0x18603140,0x7b8b2081,0x28e120e0,0x31223960,0x41623100,0x20a04182,0x18401840,0x00000840,0x08000800,0x39408bcc,0x59c24161,0x41806244,0x104020c2,0x00000000,0x00000000,0x00000000,0x00200840,0x00002924,0x18a20020,0x00200000,0x00000000,0x18800800,0x398120e1,0x49e23960,0x28c03100,0x30e02060,0x62865204,
-0x20803941,0x416428e0,0x080028e2,0x10601880,0x000020e0,0x08001060,0x20a01840,0x39401820,0x10605206,0x4a032980,0x10605a64,0x39422921,0x39623142,0x52615a64,0x28a03940,0x310228c0,0x49c26ae8,0x314149e4,0x41e23981,0x5a6920e0,0x18802901,0x00003164,0x10203984,0x08200000,0x18401000,0x28c020c0,0x000049a4,0x080028c1,0x10200800,0x31231020,0x00000000,0x31204182,
-0x6aa54160,0x52026aa5,0x72c672e7,0x51c372e6,0x39206225,0x49a13941,0x49a25a25,0x20a030e0,0x20a041a2,0x18803983,0x18a00000,0x39407328,0x49e049c0,0x00203981,0x29610000,0x00400000,0x00000000,0x000018e3,0x00000000,0x10620000,0x00000000,0x840f0020,0x29231060,0x00003165,0x00000000,0x62ea0000,0x00000000,0x10200821,0x4a0420a0,0x20a03120,0x08003120,0x398020a0,
-0x08003120,0x5a443942,0x08003100,0x29011001,0x20c01860,0x39a120c0,0x394241e3,0x39831860,0x29012920,0x18a01080,0x08000000,0x72e87327,0x62c66ac7,0x4a043961,0x20e03982,0x52671040,0x398318a0,0x10600000,0x41a43943,0x39423963,0x312249e5,0x396220a0,0x39623982,0x524420a0,0x31010800,0x30e13121,0x20c13102,0x102028e2,0x49a40800,0x418251c4,0x49c349a3,0x49c349a3,
-0x49a249c3,0x836949c2,0x5a2449c2,0x418149a2,0x41814181,0x39625a86,0x10203121,0x30e03162,0x30e03940,0x41621000,0x41816286,0x310120a0,0x10600000,0x41841860,0x62635a25,0x49c36265,0x10203940,0x00000820,0x00000000,0x00000841,0x00000020,0x31850020,0x5aa90820,0x00000000,0x00000000,0x08000800,0x08000000,0x312141e4,0x5a2420c0,0x41824161,0x49a23920,0x62635a22,
-0x52041000,0x39432080,0x31000000,0x524528e0,0x20813141,0x186028e1,0x28e05224,0x31007b09,0x49e34162,0x312041e1,0x5aa45244,0x186039a1,0x18803942,0x39a03120,0x39803940,0x5a6341a2,0x4a015203,0x39813100,0x080049e4,0x10200800,0x18a02902,0x18a20840,0x104020c1,0x08000000,0x10001000,0x41832080,0x39411820,0x29221000,0x20c01880,0x31401060,0x41e418a0,0x102041e4,
-0x62a349c0,0x62846ae6,0x498051e0,0x5a235a22,0x49e26265,0x41815a23,0x5a464161,0x418151e4,0x5a454181,0x08004a25,0x4a440000,0x6ae53100,0x41605a21,0x08206262,0x21400880,0x00002122,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10810020,0x31650840,0x00002924,0x00000000,0x00000000,0x29440020,0x10600000,0x20c01860,0x31403121,0x39802900,0x20801020,
-0x49a41840,0x41811820,0x41a14181,0x39a03140,0x20c03120,0x080041a1,0x28e02920,0x49e320c0,0x20c03181,0x29441040,0x73263181,0x628572c8,0x62a66285,0x49e43941,0x18a02900,0x102118a0,0x080018a0,0x08000000,0x18401860,0x39841860,0x314239c4,0x104028e1,0x10402903,0x39850000,0x39624162,0x416349a2,0x394349a4,0x28e230e1,0x30e13102,0x49a349a3,0x39414182,0x49a34182,
-0x392049a3,0x62653920,0x418051e3,0x41814181,0x49c25203,0x184028e0,0x49c33960,0x390028c2,0x49e44182,0x30c028a0,0x41802060,0x312028c0,0x39825204,0x30e13961,0x6a424141,0x08206aa5,0x00000000,0x00000000,0x18820000,0x00000000,0x00000020,0x00006b6d,0x08400000,0x08400000,0x08200000,0x18a01840,0xb5542144,0x396041c3,0x390128e0,0x49e23920,0x18601820,0x5a253900,
-0x41814181,0x08003100,0x10402920,0x39611860,0x39213941,0x30e028c0,0x6b0928e0,0x6ac65204,0x41814140,0x31403940,0x20e05244,0x5a8520c0,0x39801040,0x398141a1,0x4a004181,0x28c028e0,0x52231840,0x31403101,0x18800800,0x39a30820,0x08002922,0x208020c1,0x106018c0,0x49c41860,0x29001880,0x39223121,0x20a02080,0x10401820,0x41e51020,0x20e039c3,0x20a01840,0x188318a0,
-0x5a637b47,0x41607b68,0x51e24980,0x62846264,0x5a445202,0x52044182,0x310049a2,0x10403962,0x20a13983,0x00000000,0x29005a88,0x52001860,0x6ae46a83,0x398262c3,0x21201080,0x000020e1,0x18c10000,0x00000000,0x00000000,0x00000801,0x00000820,0x00000020,0x528818c2,0x18820000,0x00000000,0x29030000,0x00200000,0x00000000,0x39640800,0x28e03121,0x41a228e0,0x49c128e0,
-0x62854180,0x52024181,0x39603980,0x41a13960,0x28e03960,0x29003981,0x52251880,0x31211840,0x29213160,0x5aa53121,0x62c66ae6,0x62a662a6,0x39a15224,0x20a03981,0x39413120,0x18c02900,0x29212900,0x29023143,0x10802923,0x18a01040,0x08201060,0x00000000,0x00000020,0x00000000,0x41a33983,0x41833942,0x498351e5,0x49834983,0x51c449a3,0x49834983,0x51e44182,0x5a0451e4,
-0x59e44983,0x28c051e3,0x31004181,0x72e74182,0x28c04181,0x51e45204,0x49a25204,0x5a465a25,0x418351e4,0x51c43921,0x39404143,0x72e85a05,0x28c24182,0x08000000,0x20800800,0x00005a66,0x10200000,0x31213962,0x082041a3,0x29431060,0x00000020,0x000052a9,0x08005acb,0x00000000,0x39851080,0x00001060,0x10618c4f,0x418220e0,0x29000800,0x30e01000,0x41804182,0x39605203,
-0x39633920,0x5a661020,0x41a23140,0x18203960,0x5a2528a0,0x28e03961,0x39403100,0x520241a1,0x4a046263,0x28e062c7,0x08201860,0x18a020e0,0x73050820,0x39406283,0x41805a42,0x31815a63,0x39603961,0x314049e1,0x39833981,0x10201840,0x00000800,0x104120a0,0x31202080,0x18603961,0x18600800,0x39423962,0x08001060,0x290128e0,0x29000800,0x20a041c3,0x10203121,0x080020a1,
-0x6ac56aa4,0x7b476ac5,0x5a657306,0x62655203,0x39616265,0x39403942,0x628651e4,0x08405206,0x08400001,0x00000000,0x6ae55a85,0x49c05a02,0x62c43981,0x49c15262,0x4a233982,0x39a24a03,0x41c6736a,0x10403143,0x00000841,0x00000000,0x000052a8,0x20e10000,0x29421060,0x10600800,0x00000000,0x08200000,0x08200800,0x00000000,0x08400800,0x08010000,0x20a00820,0x28e028e0,
-0x49e23960,0x416151e1,0x49e25223,0x39605a43,0x39823120,0x62a57328,0x41e149e2,0x29002900,0x62c528e0,0x5a635aa3,0x5a435a63,0x5a856ac5,0x20e062c6,0x31203140,0x41803120,0x29203960,0x39c220e0,0x20c02920,0x31832922,0x10800840,0x082039c4,0x00003164,0x00000000,0x00000820,0x39611880,0x520528a0,0x51c44183,0x51e451e5,0x49a351e4,0x49a349a3,0x392151c4,0x41214162,
-0x496230c0,0x39404182,0x49c351e3,0x5a043100,0x49c14160,0x51c33940,0x28a04182,0x626649e3,0x49c349c3,0x31004180,0x28a01820,0x59e330e0,0x51c151a1,0x6a436a83,0x28c05a22,0x8bc90800,0x52225202,0x41805202,0x000049e1,0x10400000,0x08212902,0x00006b4b,0x10600000,0x08200820,0x000039a5,0x08600000,0x10800820,0x30e020e1,0x20a03121,0x18405206,0x20406265,0x08001020,
-0x10801840,0x396331a3,0x20a00800,0x28a15203,0x398028a0,0x31203120,0x31005204,0x5a234180,0x41826245,0x28e04185,0x29001000,0x31614a25,0x39605a87,0x6ae46ae4,0x41606283,0x526428e0,0x49e23140,0x28e03980,0x208041a4,0x39831040,0x00010000,0x08000820,0x29001020,0x29205244,0x31416b07,0x5a451020,0x08002920,0x186028c1,0x41a33980,0x49e33961,0x418349a3,0x39432060,
-0x49c06282,0x51e24180,0x62645202,0x6aa65a24,0x5a445204,0x28c049c2,0x31403960,0x00005266,0x08210000,0x5aaa0820,0x6b0583ec,0x4a003940,0x62c36b06,0x294062e5,0x62e52940,0x318139a0,0x18801880,0x000018c1,0x00000000,0x4a280000,0x6b4b73ab,0x18a12943,0x082018c0,0x10203141,0x00003164,0x08210000,0x20e30000,0x00000000,0x00000000,0x18605268,0x39813941,0x41e23140,
-0x418141a1,0x28c049c2,0x31403960,0x28e03960,0x52243100,0x312020a0,0x20c041a1,0x290041c2,0x62857327,0x52635ac5,0x5a845a63,0x10805a64,0x39a118c0,0x49c23140,0x52234181,0x396049c2,0x41c33941,0x31414182,0x31624a25,0x186020e0,0x31440800,0x394318a0,0x39433122,0x39214162,0x39203962,0x30e14183,0x28c020a0,0x52054162,0x51e43101,0x394251c4,0x41424183,0x206030e0,
-0x41822880,0x39203920,0x51c35a04,0x62445a04,0x31005a04,0x418151c3,0x49e341a2,0x20a05225,0x51c34141,0x39413100,0x416230e0,0x49a23941,0x49605a02,0x72c56a84,0x7ae57b04,0x7b068325,0x39206aa4,0x51e04960,0x000020a0,0x080018a1,0x08204206,0x42050000,0x08200000,0x00003143,0x08203963,0x080020c0,0x18804a06,0x20a00800,0x20805a45,0x6ac849a4,0x28a128c0,0x5a873121,
-0x18803962,0x00000000,0x41611880,0x30e13900,0x31403940,0x52233120,0x29003961,0x418149e2,0x522341a0,0x31403940,0x20a03980,0x52264183,0x6ae628e0,0x08003940,0x4a0228c0,0x312028e0,0x28e10800,0x522420a0,0x20803961,0x18201000,0x00200840,0x18800801,0x30e041a1,0x29002080,0x49e341c1,0x39405246,0x49c35203,0x290028c0,0x18802080,0x39424161,0x288128c0,0x10003964,
-0x49a14180,0x628472e5,0x62855201,0x41617b29,0x62865202,0x6ac672e7,0x314051e2,0x00000800,0x6aea3143,0x526628e0,0x73277baa,0x52227306,0x39a020a0,0x31605241,0x10211880,0x31801881,0x08004203,0x00000000,0x00000800,0x4a480000,0x18c00000,0x00003985,0x31420000,0x316241e2,0x41c449e3,0x5a883123,0x000018c1,0x08200000,0x00000000,0x20c020c0,0x41c23980,0x52235243,
-0x39403940,0x41a23960,0x73493141,0x39214a04,0x186049c4,0x20a01860,0x290041c3,0x41e03960,0x418062a4,0x4a225aa4,0x29403180,0x20e12100,0x31802941,0x41812940,0x418149e3,0x31203940,0x394141a2,0x41c35225,0x49e43962,0x41833962,0x28a10000,0x41a328c0,0x51e46aa7,0x41a33962,0x418241a3,0x41a23120,0x41633101,0x28a03122,0x41623962,0x41624983,0x18004162,0x39224183,
-0x49c349a3,0x41824182,0x51e349a2,0x51c35a24,0x626649a2,0x18605a45,0x41623962,0x28a041a2,0x41833121,0x20806286,0x416130e0,0x51c228c0,0x182030c0,0x49404161,0x7ae472c3,0x7ac46a61,0x18206ac3,0x31402080,0x00001020,0x4a461881,0x20e1736b,0x18811881,0x00001060,0x08200840,0x10402922,0x4a060000,0x20a01020,0x18800000,0x20800000,0x28e05224,0x39605a44,0x00005204,
-0x314328e0,0x5a460000,0x5a444181,0x394051e1,0x39a020c0,0x4a225a63,0x39603160,0x39403960,0x41e23161,0x396239a1,0x31213120,0x28c03140,0x73073961,0x20a049c2,0x49e249e2,0x39603940,0x20c04a03,0x522349e2,0x49a33140,0x28c03922,0x100020a0,0x08001840,0x62856286,0x5a642080,0x41826245,0x312120c0,0x28c093ec,0x41824181,0x396228e0,0x41823121,0x080028c0,0x20a01840,
-0x5a617325,0x6b0651e3,0x49c25a23,0x6ac66266,0x5a235202,0x5a655222,0x62a56285,0x5a6649e3,0x62a762c7,0x73086286,0x73296b09,0x6ae46ae5,0x5aa15241,0x41a041a0,0x394162c6,0x41c249e4,0x29202920,0x000020e2,0x00000840,0x08400840,0x39a439c4,0x294320e1,0x62c70800,0x420218c0,0x21003160,0x39a12941,0x20c041e3,0x292320e0,0x10422121,0x31000800,0x49e15a44,0x41a241c1,
-0x39805223,0x20c049e2,0x208020a0,0x20a028c0,0x41813980,0x084028c0,0x31604a23,0x31603140,0x5aa44200,0x210041e0,0x18c02940,0x316031a1,0x41e15264,0x31412920,0x41c341a2,0x398149c3,0x31203981,0x49c628e1,0x416241a2,0x520551e6,0x51e441a3,0x520551e4,0x49a341a3,0x31214183,0x31003101,0x31005224,0x20c03121,0x31013121,0x18403140,0x41633101,0x49a33942,0x392130e1,
-0x49a372c8,0x49a351e4,0x41615a25,0x5a446265,0x39004181,0x6a8649c0,0x5a0449a2,0x20c149c2,0x18201021,0x5a464983,0x18001840,0x5a221820,0x6aa449c0,0x49e172e6,0x6aa54161,0x83265a20,0x000072c3,0x20c21040,0x10810800,0x00004a27,0x18c01060,0x29021880,0x6b2a39a3,0x10600000,0x20e00000,0x39a31882,0x20a01020,0x41a249c5,0x39407b4a,0x5a4520a0,0x30e051e3,0x39405a44,
-0x00001020,0x7b4749e3,0x5a846ac5,0x62a541a1,0x49c183a9,0x524241a0,0x312049e1,0x41c141a2,0x49c32900,0x41823101,0x41a14184,0x418120a0,0x418128c0,0x394051e3,0x31203960,0x522262a6,0x41a041a1,0x52223940,0x10003121,0x39410800,0x310049a2,0x10206285,0x51c41000,0x4141bd11,0x83895204,0x51c35243,0x41814160,0x31213940,0x39633140,0x31003940,0x51e34180,0x288030e2,
-0x73077b48,0x10206282,0x49c272e7,0x5a655a63,0x5a236ae8,0x62855a63,0x4a0262a6,0x6ae75224,0x5a6562a6,0x62866285,0x7b696287,0x5a6262a4,0x5aa23980,0x41a15262,0x10600000,0x31620820,0x08000000,0x08200000,0x00000000,0x10802943,0x18c10820,0x000020c2,0x18a05a85,0x6b0662e6,0x29402940,0x62e65a85,0x210018c0,0x41c362c5,0x5aa43140,0x49e25a44,0x41c141c1,0x5a6549e2,
-0x49e23120,0x41a23960,0x52243140,0x49c228e0,0x39405203,0x398249e3,0x41c21880,0x52643181,0x62e539c1,0x41e139a0,0x42234202,0x31603180,0x52832940,0x20a020e0,0x41a23140,0x39815224,0x52243981,0x18403122,0x31214163,0x51e45204,0x49a349e4,0x39625205,0x52053942,0x49a351e4,0x39414183,0x39614182,0x186049c5,0x20805226,0x28c13923,0x30e03101,0x49a330c0,0x49a33101,
-0x49a34162,0x414249c3,0x41824182,0x49c24182,0x49a249a2,0x6a855a03,0x6a855203,0x52253120,0x39201880,0x39403900,0x28a05204,0x62641840,0x5a4151c1,0x41817b26,0x62a328a0,0x624330c0,0x20806ac4,0x18811020,0x18601860,0x084020a1,0x41e40000,0x29234205,0x08200820,0x10600000,0x08201080,0x10601080,0x39621040,0x5a650800,0x31205205,0x5a443961,0x5a445203,0x51e351e3,
-0x104041c2,0x41a25264,0x20c049e3,0x52223120,0x73255a64,0x41805221,0x49c341a1,0x312020a0,0x73277b69,0x52223140,0x28e07325,0x41a228c0,0x416020a0,0x310049c2,0x31003140,0x41803100,0x398041c1,0x31205a64,0x394049c2,0x20a01820,0x310028a0,0x83aa3961,0x30e04160,0x49a05203,0x31204a02,0x20603121,0x396128e0,0x39a03120,0x080020a0,0x49c33120,0xc5732060,0x28a02880,
-0x72e67b26,0x398072c4,0x62853920,0x39401020,0x62646284,0x08005202,0x20a062a6,0x28a04181,0x62656244,0x5a441840,0x41e262a7,0x39804180,0x20c062c3,0x62c24a20,0x00005a83,0x00000802,0x002018c3,0x00000000,0x4206632a,0x00000800,0x08001060,0x00000800,0x31613180,0x5a842920,0x31403181,0x31806b27,0x31a018c0,0x5a654a01,0x41a062a3,0x52035a05,0x5a845a64,0x5a655243,
-0x520349c2,0x20803981,0x39a041c1,0x62a541a0,0x49e13960,0x5a6428e0,0x29401820,0x108041c2,0x31802920,0x41e13181,0x31a12960,0x316039e2,0x4a225283,0x20a00000,0x29004a04,0x522441a2,0x41a23982,0x52053981,0x49c428c1,0x49a33120,0x51e449c4,0x39625225,0x41836287,0x520549e4,0x49c35205,0x394149e3,0x49e220c0,0x396041c2,0x41831840,0x41634163,0x30c03942,0x51e449a4,
-0x39214162,0x498349a3,0x392049a3,0x39203941,0x51c25203,0x51e272a7,0x626472e5,0x28e05a23,0x418141a2,0x51e23940,0x39213940,0x5a033120,0x41615a23,0x39206245,0x62821000,0x51a06aa4,0x30a028e0,0x08000000,0x100049e6,0x4a260800,0x31830800,0x08403163,0x5ac80000,0x20e20000,0x41e52924,0x20e22920,0x18400820,0x5a650000,0x20a02080,0x49c16ac6,0x51e33900,0x72e749c2,
-0x49e25245,0x524262a8,0x28c03940,0x4a0120a0,0x5a4428e0,0x6ae76ac6,0x31211040,0x39803120,0x394228c2,0xb50f1860,0x31003960,0x41823120,0x28c01840,0x39603940,0x28e149c3,0x39603120,0x5a433940,0x49e35a43,0x30e05223,0x394130e0,0x28c03961,0x6ac628c0,0x836a5a44,0x39203921,0x39603980,0x39811000,0x52243160,0x188020a0,0x28e01000,0x5a455a43,0x418249a2,0x416330e2,
-0x73078389,0x51e16aa4,0x5a843140,0x5a434a00,0x7b693120,0x29024182,0x20e00800,0x62864a02,0x41a05a44,0x4a055a44,0x41a11860,0x4a0128c0,0x4a415240,0x5ac418a0,0x1061a4d0,0x00000000,0x00000000,0x18e30000,0x4a270820,0x00000000,0x00000000,0x18a141e6,0x31613980,0x7bc820c0,0x6b463982,0x39c13160,0x63066304,0x398062e4,0x49e25a85,0x52243120,0x31002900,0x28e05a66,
-0x398141a1,0x39403940,0x41a128c0,0x10003120,0x39402080,0x31003120,0x39825203,0x41c31040,0x4a4318a0,0x4a222920,0x4a435263,0x42212940,0x39c04222,0x39a22920,0x39815263,0x41a241c2,0x418241c2,0x41a33120,0x31223942,0x41a35205,0x52053962,0x49a349e4,0x5a254162,0x39424983,0x5a054983,0x5a2451e3,0x49c34161,0x20803920,0x28c06ac9,0x39213942,0x414249a3,0x20404162,
-0x31003921,0x5a254162,0x418249c3,0x41213921,0x41403900,0x62643900,0x624472e6,0x49e330e0,0x288020a0,0x41813920,0x418130e0,0x62655203,0x49e449a2,0x39401840,0x6ac228c0,0x186062a1,0x18613102,0x00000000,0x28c03942,0x28e21020,0x00011040,0x08003164,0x39830000,0x08001020,0x000062e8,0x20e03141,0x29003162,0x39402900,0x204030e0,0x49e35a25,0x39203920,0x62854161,
-0x31405a85,0x52232900,0x10406ae6,0x31603160,0x41a220e0,0x41c15244,0x31a03181,0x5a431860,0x41a15222,0x39403960,0x7b4541c0,0x10203120,0x394041a1,0x49a14180,0x31203120,0x394028c0,0x18404180,0x416051e1,0x416072e6,0x41a14160,0x20a03960,0x49c23960,0x18405a45,0x39403940,0x39605a45,0x31203940,0x41c141a1,0x41c03120,0x18201860,0x49c33941,0x62a628e0,0x31011000,
-0x62a462a4,0x49a15202,0x49e04a01,0x62a52080,0x522249e2,0x41625203,0x08000800,0x5a455a64,0x52025a44,0x31404161,0x41a25202,0x41c028e0,0x5ac35a81,0x39802940,0x41c339a2,0x00000000,0x00200000,0x00000000,0x39a60000,0x00000000,0x4a2810a0,0x00000800,0x31404a02,0x422183eb,0x52630000,0x73872100,0x4a406b48,0x41e05a64,0x29004a02,0x396141c2,0x314041c2,0x31603960,
-0x18802900,0x41812900,0x49e23120,0x4a014a00,0x62a541a0,0x31002080,0x31603120,0x20c049e2,0x21002900,0x39a039a0,0x29203180,0x52a34a42,0x42023a00,0x62c741e3,0x31404a24,0x31403960,0x31203981,0x31412900,0x18403102,0x49c41860,0x520549c4,0x49c449a3,0x39624183,0x41624983,0x41835205,0x39215a46,0x41814181,0x49c36aa8,0x5a6651e4,0x414249a3,0x498349a3,0x49a330e0,
-0x49834141,0x30c03941,0x41615204,0x30e04161,0x41405a04,0x624449a2,0x72c651c2,0x31206243,0x49823120,0x49a249c3,0x51e351e3,0x184049c2,0x628630c0,0x30e01840,0x6aa42880,0x62a85200,0x08001020,0x18a10000,0x31010000,0x080049c5,0x00010000,0x28e11040,0x30e03921,0x08200820,0x10605266,0x39a23162,0x10402920,0x31203120,0x49a46286,0x31005a25,0x30e028a0,0x20606286,
-0x396128e0,0x31423121,0x29202100,0x41e24a03,0x31407347,0x20800800,0x5aa44a23,0x52425a63,0x62a541c1,0x41c049c1,0x6ae49c6a,0x52424160,0x41805201,0x51e230e0,0x394049e1,0x31003961,0x30e05202,0x10006284,0x5a235202,0x522249c1,0x418149e1,0x39404181,0x41a03100,0x41803100,0x312041a0,0x5a835a43,0x41c041c0,0x39603980,0x28c128e0,0x39615a24,0x522341a1,0x39406aa6,
-0x83886283,0x5a833960,0x49c14181,0x52235223,0x31203140,0x4a034a02,0x942e1000,0x6aa75a66,0x49a26266,0x49c25202,0x73293100,0x8c4b0840,0x39e010c0,0x20e031c0,0x49e518c0,0x000062c9,0x00000000,0x00000000,0x08610000,0x00000000,0x08206b4c,0x31410000,0x10203161,0x4a025a82,0x5aa34202,0x4a225aa4,0x29404a22,0x630539c0,0x41e13180,0x31202920,0x41c16ac7,0x524349c1,
-0x396049c1,0x396049e1,0x31203140,0x522349e2,0x396139a1,0x52233980,0x20c020a0,0x49e22900,0x31804a22,0x526241e1,0x31804222,0x39e02960,0x39a13a00,0x29402940,0x294041e2,0x49c25a65,0x396149c3,0x20c041c3,0x00000800,0x41833962,0x49a44183,0x73095a46,0x31013942,0x416249e4,0x418349a3,0x51c451e4,0x49824962,0x416249a3,0x51e44142,0x418249c3,0x416249c3,0x418220a0,
-0x28c03921,0x18004142,0x49824142,0x51c349a2,0x51e25a04,0x39004981,0x49a26264,0x49a20000,0x41815a24,0x416051e3,0x416149a1,0x41814161,0x49c23920,0x206049a2,0x51a51040,0x0800942d,0x20a00000,0x41a428e1,0x396141c4,0x39213963,0x20c10800,0x18a028e3,0x290028c0,0x00000800,0x18c12101,0x08204a24,0x732a20e1,0x52440800,0x20a23101,0x310220a0,0x49e21880,0x31404a02,
-0x18a041e3,0x41e24a05,0x31611040,0x39a21060,0x6ae6acee,0x290120a0,0x39803981,0x5a425a63,0x5a4441a0,0x10003961,0x29205202,0x62844a22,0x49c241a0,0x394030e0,0x418051e2,0x41605a23,0x51e141a0,0x49c149a0,0x41605a23,0x31004160,0x62a53100,0x52231000,0x39603120,0x28e03961,0x52225223,0x49e149e0,0x52023980,0x41c05a42,0x28e03940,0x52251020,0x30e028a0,0x5a436264,
-0x52225a62,0x49e120a0,0x49e228c0,0x8c2b2900,0x18a039a1,0x41a15264,0x31215225,0x41615204,0x62653920,0x52035a24,0x4a2449e2,0x42012900,0x42404261,0x6b055b04,0x51e462c7,0x62846aa6,0x00001040,0x00000000,0x00002903,0x31641880,0x104018a0,0x6b270820,0x83ca39a1,0x6b257367,0x62e67367,0x39c139a0,0x21004221,0x4a225263,0x39c139a0,0x5a645244,0x396041a2,0x49e25202,
-0x522241a1,0x41c05222,0x4a033120,0x18a02900,0x6ae73140,0x524249e1,0x41c041a0,0x522339a0,0x5ac541e1,0x31e04a62,0x422131a0,0x63054221,0x4a234a42,0x52844202,0x39a139a0,0x5a444a23,0x49c34161,0x310128e0,0x41a20820,0x39213942,0x49834162,0x5a2651e4,0x51e53942,0x39213942,0x41a349a3,0x41624983,0x51c351c3,0x416259e4,0x49a34983,0x49a34162,0x394149a3,0x41824182,
-0x5a253901,0x414249a4,0x51c349c4,0x30a06aa6,0x51c33920,0x49815a25,0x62445a24,0x520349a2,0x49a26ac6,0x49a228c0,0x28a049c2,0x62653920,0x416151e3,0x51c349a2,0x00000800,0xeef78c0b,0x6b483160,0x49e33981,0x184041c2,0x28c03101,0x10600800,0x29410800,0x20a028e1,0x08000000,0x000020c2,0x29211080,0x4a050800,0x08000820,0x18605205,0x31400000,0x41c262c6,0x39613140,
-0x20e03160,0x7bc91080,0x29403160,0x00005a85,0x41c328e0,0x522541c3,0x31403960,0x52224180,0x20805223,0x28e07b6a,0x20e062a5,0x628441a1,0x5a434a00,0x72e54160,0x51e26284,0x41a030e0,0x39204180,0x51c15202,0x390051c2,0x39205a03,0x49c15a43,0x418128a0,0x31005a65,0x41c13100,0x314049e1,0x520220a0,0x31206ac6,0x29005223,0x394049e1,0xaccf3961,0x41616285,0x39203100,
-0x62a26ae6,0x20a041a0,0x39a020a0,0x4a2241e1,0x20e020e0,0x41e13181,0x00001860,0x20a00000,0x5a8628e0,0x41a249e2,0x28e06285,0x4a822100,0x5aa25ae4,0x7bc8944c,0x6b286b27,0x6a677308,0x00005a43,0x52660800,0x00003981,0x31403161,0x084039c0,0x39a13180,0x52424202,0x6ae462c4,0x000020c0,0x292041e4,0x31802940,0x31a02940,0x39a139c0,0x41a15264,0x31005244,0x41a041a1,
-0x49c151e1,0x41c15223,0x41a05a85,0x5a845a85,0x28e01880,0x41a03120,0x524141a0,0x41a25a83,0x4a222940,0x31804a43,0x42421900,0x29603a00,0x39c04a62,0x4a0241e2,0x49e349e3,0x310028e0,0x62663942,0x520549e4,0x41833942,0x49e44162,0x41a341a3,0x52261860,0x41a43963,0x39223963,0x49c43962,0x41833921,0x41623921,0x390028a0,0x49a249a3,0x51e45a04,0x418249a3,0x49c249c2,
-0x41425205,0x49825a04,0x390049c3,0x624659e4,0x39413921,0x520549c3,0x49e249a3,0x49c249a2,0x62456243,0x390051c3,0x414251a2,0x49624142,0x20604161,0x00003101,0x10400000,0x39406ae6,0x5a650000,0x39605a84,0x5a451000,0x39815a66,0x08002942,0x18a00800,0x000041a5,0x00000800,0x00000840,0x10000000,0x28e118c0,0x314020c0,0x4a0428e0,0x20a03961,0x52443960,0x4a4318a0,
-0x396128e0,0x4a0441a2,0x20803140,0x188028c0,0x39623981,0x39809c6f,0x522249e3,0x39405222,0x20c020e0,0x29203142,0x39a10820,0x6ac662c5,0x5a6462a5,0x520249e2,0x6b0662c5,0x51e16ac5,0x49a051e1,0x51e151e1,0x41605201,0x51e27306,0x49816243,0x72e65a44,0x41814181,0x4a0128e0,0x31203941,0x31003100,0x39403960,0x394041c1,0x418141a1,0x31005a45,0x288028c0,0x49a03900,
-0x62c27b68,0x73256ac3,0x49e162a4,0x52225a83,0x52233140,0x62a54a02,0x318018a0,0x524439a1,0x6b0841c2,0x522449c2,0x29005a45,0x3160a4d0,0x31600820,0x39c04a41,0x73280820,0x49825a65,0x104049e2,0x6b042900,0x4a2239e0,0x526439c1,0x4a4418c0,0x62e61080,0x52412100,0x522328e0,0x18802900,0x106041e4,0x31803180,0x39c03161,0x31604220,0x520420e0,0x5a4428e0,0x31203960,
-0x626349c0,0x5a656ac5,0x4a215a65,0x52427ba8,0x396049e1,0x39603960,0x52637b68,0x4a024a02,0x4a431080,0x3a0139c0,0x39e031c0,0x4a4352c4,0x210039a2,0x52441880,0x4a045224,0x52244182,0x41835a66,0x39424183,0x418349e4,0x49e44162,0x41a349e4,0x396349e4,0x28e149c4,0x418328c0,0x30e03942,0x30e03101,0x41424983,0x39424162,0x28a02080,0x51e449a3,0x52044162,0x418249e4,
-0x41424163,0x41823920,0x51a330e0,0x30c03900,0x28a05a25,0x41834161,0x208051e5,0x39203941,0x49814981,0x416151c2,0x51e330c0,0x5a043941,0x49a251e3,0x41c25a24,0x31402900,0xbd704a02,0x73483140,0x31204180,0x000041a3,0x5a462901,0x08003182,0x10403163,0x000041e5,0x08000000,0x1881734c,0x49c40000,0x28e10000,0x398239c1,0x49e35244,0x290020c0,0x52433120,0x4a023160,
-0x31403980,0x18803140,0x398041c1,0x18403101,0x39803140,0x31203100,0x62853120,0x396041a1,0x18a05a42,0x18800000,0x39803160,0x5a833160,0x524239a0,0x528341e0,0x526362c5,0x49e33960,0x62835a42,0x51c07b06,0x5a425a22,0x5a035a43,0x498151e2,0x39203920,0x62644140,0x49c04160,0x41a083aa,0x18203961,0x5a6549e1,0x31202080,0x52033940,0x52026ac6,0x31005202,0x5a223920,
-0x6aa26ac3,0x6ac46262,0x72c46240,0x5a215a42,0x49e14180,0x396149c1,0x42022900,0x31404a43,0x5a8520c0,0x28c049e2,0x4a0341c1,0x314341c7,0x52633160,0x52634200,0x62c54202,0x41836ae6,0x10204a21,0x5a649c4c,0x31805a63,0x39e11060,0x00204203,0x52650000,0x6ae57347,0x62a11880,0x6ac86285,0x5aa36b07,0x39804a01,0x42024a21,0x39c241e0,0x31410000,0x28a01060,0x398049e2,
-0x30e049c1,0x10003962,0x39601860,0x39604a21,0x524141a0,0x29003980,0x31202920,0x41c039a1,0x10802920,0x4a635282,0x31a04a60,0x31c02140,0x41e331a2,0x41843982,0x51e449a4,0x418141a2,0x49c45205,0x49e549c4,0x520449c4,0x51e449c4,0x39425205,0x49c449e5,0x394228c0,0x39223963,0x39425205,0x394128e0,0x28c03100,0x31202060,0x100028c0,0x20801880,0x39431020,0x51e64163,
-0x41a33962,0x39214141,0x414249a3,0x49a249a3,0x41825a24,0x310049a3,0x522449c2,0x418030e0,0x62435a43,0x41405a23,0x5a253920,0x49604121,0x41205a23,0x72e76a85,0x72e628e0,0x39413101,0x4a055a83,0x418120a0,0x186028c0,0x318041a1,0x08000000,0x20403922,0x10001820,0x10001820,0x28823101,0x49c28bc9,0x39851020,0x188018c0,0x31603163,0x20c049e2,0x41a13120,0x5a633960,
-0x20c03920,0x28e03981,0x310120a0,0x41c22900,0x206041a2,0x49e23100,0x28c03120,0x39606b07,0x29212922,0x08000000,0x4a251060,0x422318a0,0x4a2339c1,0x5a854a23,0x28c049e1,0x28c028e0,0x7b2828c0,0x624349c1,0x62425a21,0x416072a3,0x414030c0,0x51c34962,0x62435a22,0x39006223,0x62844140,0x28c049e1,0x28a02081,0x49c249e2,0x39203940,0x5a435202,0x51c05a22,0x624249a0,
-0x73257305,0x7b457b25,0x62634980,0x73066263,0x29003940,0x39603960,0x39a15243,0x41c24a23,0x49e320c0,0x28c028e0,0x4a033120,0x00003162,0x080039c1,0x18a020e0,0x5aa44a62,0x39605a84,0x208062c4,0x62a26b05,0x41c06ae3,0x29403160,0x62e852a4,0x29201060,0x62a341c0,0x6b045a64,0x52031860,0x49e12920,0x4a2141a0,0x31604a41,0x62c74200,0x18603180,0x394028e0,0x522528e0,
-0x39405202,0x41c04a22,0x41e23980,0x41a03980,0x310041c0,0x28e03960,0x39602900,0x52235243,0x4a425223,0x31a039c0,0x39c052a3,0x29802120,0x290118e0,0x184049c4,0x49c33941,0x396049c3,0x5a264183,0x39633942,0x28c041a4,0x31213942,0x41633942,0x49e53101,0x28c03963,0x312228c1,0x31213962,0x41633942,0x28c04162,0x10001840,0x00002081,0x10202060,0x20801020,0x49a43942,
-0x52053101,0x414228a0,0x41624162,0x41824162,0x30e049a2,0x184030e0,0x39213121,0x51e34162,0x62435a02,0x39205a03,0x49a24161,0x5a034140,0x414051c2,0x62655a03,0x080049a2,0x6ae64161,0x20603961,0x5a4449e2,0x522428c0,0x39803960,0x28e10800,0x51c51000,0x310030e0,0x18401840,0x20602080,0x49a349a4,0x41c141a1,0x18612900,0x29003161,0x104028e0,0x52233940,0x41804181,
-0x28e03960,0x734941e2,0x3962a4af,0x31402900,0x18203982,0x6ac75224,0x6ac83960,0x18401000,0x18802900,0x20c04a04,0x31832900,0x08200000,0x4a241060,0x318239c3,0x29204a04,0x20802900,0x39412060,0x6aa43940,0x59e151e0,0x6a846a63,0x51c23900,0x39205a03,0x624338e0,0x59e26a64,0x49e149a0,0x310062a6,0x28c028c0,0x41815224,0x51e33920,0x62645203,0x6a8451c1,0x498059e2,
-0x942b8bea,0x7b058366,0x6ae65a64,0x6a8572e6,0x39604160,0x20a049e3,0x20e01860,0x4a0339c2,0x49e33120,0x418262a5,0x52435225,0x83ec4201,0x4a0541e4,0x31603181,0x62c35281,0x41c03980,0x738339c0,0x62e06b22,0x4a015260,0x31a15ae2,0x41e010a0,0x108062c5,0x52604a01,0x732628c0,0x62a36b05,0x62e36ae6,0x41e062c4,0x4a2331a0,0x31804200,0x41a02920,0x310028a0,0x28e05203,
-0x29005244,0x10201020,0x18603960,0x49e241c0,0x41c049e1,0x39a049e0,0x4a0141c0,0x39822900,0x18a04a03,0x39e15283,0x3a0052c1,0x3a0031c0,0x39a04240,0x39413980,0x5a463940,0x62855a25,0x49c462a7,0x29013963,0x28a128a1,0x394228c1,0x41a43101,0x31223942,0x41c44183,0x28a03101,0x28e028c0,0x186028a0,0x206020a0,0x28c128a1,0x20401840,0x18400800,0x28e21000,0x31214163,
-0x310149c4,0x30c03100,0x41423921,0x41823941,0x626551c3,0x39424983,0x208020a0,0x49a230c0,0x6a845a23,0x51c25a03,0x41603920,0x622349a1,0x5a0151a1,0x62656243,0x49c16283,0x29004a02,0x51e26263,0x52035202,0x62a649e3,0x41803980,0x28e130e0,0x20603101,0x41a31840,0x31013121,0x394249a5,0x10003120,0x30e01820,0x29003941,0x49e40000,0x41820800,0x52233940,0x59e228a0,
-0x62a541a0,0x28e041e2,0x10401000,0x10003982,0x49c35a66,0x73096ae6,0x49e43961,0x10200800,0x10204a03,0x080020e0,0x20e00800,0x20c118a0,0x29631060,0x08601080,0x20e239c3,0x41c27348,0x62655a43,0x624328a0,0x49606ac4,0x5a026a84,0x62658368,0x310051c1,0x39003900,0x51a151a1,0x5a2430a0,0x942c4a20,0x28a03120,0x39204181,0x5a446ac6,0x49e251e2,0x72c66244,0x38e06244,
-0x7b4572e4,0x6ac36aa3,0x62a58387,0x31003140,0x39a23960,0x20e041e2,0x29021040,0x31211860,0x52233961,0x39615245,0x41825a66,0x00002940,0x080018c0,0x73676b07,0x526231a0,0x4a003160,0x73634a20,0x6b416b62,0x62e17ba3,0x41c04a40,0x73267345,0x73464a20,0x7b4841a0,0x7b465200,0x7b676ac6,0x52613960,0x41a041c0,0x41e13980,0x398128e0,0x20c041a1,0x398141c1,0x398049e2,
-0x49e23980,0x28e03962,0x31605223,0x31403980,0x292020c0,0x41a039a0,0x39815222,0x39803980,0x39a03180,0x52614a41,0x528139e0,0x52814a40,0x41e039e0,0x52243980,0xa48e51e3,0x52045a65,0x18403942,0x41833122,0x18800800,0x10200800,0x31220800,0x10003942,0x20a10800,0x18203923,0x41611820,0x392141a3,0x30e13921,0x28c12060,0x186020a1,0x28e03122,0x20c03121,0x394328a1,
-0x312130e0,0x31213942,0x20a03942,0x51c33120,0x51e449a3,0x5a255225,0x30c14162,0x20a10820,0x51e251e4,0x51e351c2,0x51c27b08,0x6a8551c2,0x5a2151c1,0x49816264,0x51e172e6,0x5a445a65,0x418051e2,0x49c22080,0x31415203,0x18803981,0x39629c6e,0x49c03960,0x416330c0,0x20a02080,0x18403941,0x7b6a41a3,0x39603921,0x20a01840,0x184028c1,0x184028c0,0x62a66ae8,0x626362a6,
-0x31003920,0x08001020,0x314141e3,0x100020a0,0x20801000,0x5a441000,0x290128e0,0x28e11860,0x52464a26,0x42050820,0x00000840,0x000018c0,0x00200000,0x10800840,0x42241080,0x18401840,0x6ac60800,0x5a235222,0x5a046ac5,0x49a06244,0x49806243,0x5a235a04,0x41614160,0x414028a0,0x390049c0,0x31003900,0x41a13940,0x522351e2,0x83686265,0x28e02080,0x72a57306,0x59e15a02,
-0x6ac36282,0x62435201,0x28a06ae3,0x31402900,0x5a443982,0x312049e1,0x5a2749e2,0x18205a45,0x312130e1,0x312049e3,0x6b0849e3,0x000031a3,0x00000000,0x6b072100,0x5a828c2a,0x52204a00,0x42604200,0x52c04aa0,0x840683e4,0x6b224a20,0x4a003960,0x420041e0,0x836841c0,0x49c06282,0x4a004180,0x52621040,0x20c041e0,0x31604a02,0x524541c0,0x6ac749e2,0x39a141c0,0x398020c0,
-0x31a120e0,0x41c041c0,0x5a8339a0,0x39605242,0x18803980,0x41803120,0x62c541a0,0x39603960,0x39a03160,0x6b274a44,0x41e16b26,0x52a262e5,0x39816304,0x39807b88,0x6aa649e2,0x418249e3,0x52253120,0x418349c4,0x20c03982,0x00003143,0x18401881,0x29413983,0x08000820,0x10001000,0x290128e2,0x49a328e0,0x206030e0,0x18602060,0x18611840,0x28c028c0,0x208020c0,0x182028c1,
-0x20a02080,0x39623942,0x39424162,0x49834181,0x498149a2,0x49a251c2,0x51c449c3,0x5a246287,0x41813941,0x51c151c2,0x51e26aa4,0x62446264,0x5a234160,0x51e05a04,0x30e051e2,0x28c02900,0x5a2330e0,0x394083aa,0x39624181,0x28e020c0,0x7b0262a8,0xe6b65a21,0x51e53923,0x20803942,0x080020c0,0x28c028a0,0x208072e9,0x28c028c1,0x00000800,0x28e1deb7,0x522530e0,0x6a8528a0,
-0x49c24140,0x31202900,0x29010000,0x394228e1,0x20a00800,0x394249c4,0x10001860,0x18602080,0x20c15246,0x20e12903,0x21010000,0x316110a0,0x210128e1,0x000018c0,0x52870840,0x28c020a0,0x20a03141,0x30e03982,0x49816264,0x49805201,0x392151c2,0x288051e3,0x72c651c2,0x6a857ae8,0x49824180,0x49c24140,0x39203100,0x20405203,0x30e03100,0x4a0241e2,0x62845242,0x624372a6,
-0x520262c5,0x20c062a5,0x314120c0,0x73482920,0x520349e3,0x41a149e2,0x49634121,0x30e25a26,0x18203102,0x000028e0,0x08003141,0x08002902,0x39410800,0x41836ac7,0x7b473981,0x6ae262c3,0x31e041e0,0x63414aa0,0x63415b00,0x52606b00,0x41c06b03,0x39606ae3,0x5a425241,0x83895a62,0x18600800,0x62c23980,0x4a005a63,0x39610800,0x28e13120,0x52663982,0x39c13160,0x41c22920,
-0x31604a02,0x31604242,0x31405a63,0x4a0239a0,0x29005263,0x398120c0,0x41a039a0,0x316039a0,0x52453180,0x49e36b06,0x52431020,0x41c25226,0x28e02920,0x39a03140,0x314041c1,0x5a464a03,0x39623962,0x51e441a3,0x4a0441a3,0x292041a3,0x082020c0,0x39632920,0x080028c0,0x08001860,0x28e10000,0x20a02900,0x184020c0,0x10003101,0x28e04163,0x28e028c0,0x10203963,0x08001020,
-0x41a330e1,0x394249c4,0x41a33942,0x30e03101,0x51c349a3,0x41615204,0x49a35204,0x624651c4,0x62455a24,0x5a2351e2,0x5a0351e2,0x72e56263,0x51806242,0x52021000,0x52025a43,0x310049e1,0x49c228c0,0x184028c0,0x838c49e3,0x31401880,0x51e128e0,0x10005221,0x310028e0,0x49e43121,0x20a11040,0x080041a0,0x6ae95a65,0x18800000,0x62870000,0x102020a0,0x62851840,0x5a031000,
-0x100049a1,0x31426ac8,0x41821020,0x08003942,0x31413141,0x18603960,0x28c00800,0x20803963,0x396141a3,0x29011840,0x20e01040,0x318239c2,0x104020e0,0x08001881,0x738d2900,0x10800800,0x000020c0,0x18202920,0x5a235a00,0x49e062a5,0x28a028c0,0x41413920,0x51c14180,0x39205a03,0x6a873900,0x20804120,0x41803920,0x49c249a1,0x30e049c2,0x524349e2,0x52425222,0x72e672c6,
-0x62c75a86,0x00000000,0x00000000,0x942c49e4,0x394062a6,0x73293940,0x498259e4,0x20a03921,0x310128e0,0x290141c1,0x4a064a25,0x398028e0,0x6ae641c0,0x39615a64,0x6ae20820,0x52005221,0x42405260,0x5b004a80,0x73a37c04,0x73427343,0x52607b83,0x5a8362c2,0x5a836b04,0x940b3980,0x186041e2,0x524262a6,0x5a644a02,0x28c049e1,0x18601000,0x08200800,0x20e03981,0x41e13160,
-0x29203160,0x39801080,0x396039a0,0x208041a0,0x39424a02,0x186028e1,0x312020e0,0x41e13120,0x420039a1,0x49e35a64,0x290041a2,0x49c33140,0x39604a04,0x4a013160,0x29005223,0x41c23141,0x49e43921,0x39623942,0x522449e4,0x08003961,0x00001020,0x31422101,0x28e028e1,0x28e12900,0x102020a1,0x20c01020,0x208020a0,0x49a328e1,0x20a03962,0x29001820,0x28e13102,0x28c028e1,
-0x28e220a0,0x394128a0,0x394228e0,0x30c03101,0x41824162,0x49a25204,0x394149a2,0x52043941,0x5a0459e3,0x51e25a03,0x416051e3,0x626349a0,0x6a646262,0x49c24141,0x41814181,0x310049e2,0x41a15204,0x31003940,0x5a671000,0x18402900,0x6aa43960,0x418262a4,0x41831000,0x18601000,0x18400000,0x310128c0,0x28c128c0,0x396420e2,0x49c61040,0x39623122,0x5a454182,0x62455a65,
-0x28c04161,0x41831860,0x39421840,0x00003101,0x31412920,0x100041c2,0x100028e0,0x08003140,0x62863100,0x29003962,0x290039a3,0x18c02920,0x10403162,0x18600000,0x83ce1000,0x00012080,0x29210000,0x396120c0,0x49c24181,0x51e26264,0x416149a1,0x41404161,0x72e749a1,0x30e06264,0x62665a02,0x49a251c1,0x31004180,0x41805a23,0x52225a23,0x5a434a02,0x39405222,0x49c08368,
-0x08011061,0x00000820,0x08000820,0x49a34180,0x18204183,0x41824a03,0x41614161,0x28c030e0,0x39604182,0x18205226,0x8bea28e1,0x6ac53961,0x5a635a43,0x5a4441a1,0x524262a6,0x7b465221,0x62e35aa0,0x52e05b00,0x5ac262c2,0x6b217ba3,0x5a817ba3,0x418062e1,0x31003100,0x836a6283,0x5a626283,0x83a87b67,0x41a141a0,0x62643100,0x394028a0,0x20a03140,0x31603140,0x39803140,
-0x31805241,0x31411080,0x4a223980,0x20a03983,0x41a03980,0x39a02900,0x41a141c0,0x29005aa5,0x31602920,0x4a242920,0x49e328c0,0x29003960,0x31411842,0x52623960,0x39805a63,0x41c01840,0x418149c1,0x5a455a45,0x6ae85204,0x41c13121,0x39a63164,0x084039a3,0x28e11880,0x41842080,0x31011000,0x39802900,0x39623101,0x31202900,0x186030e1,0x08003121,0x08003943,0x208028c1,
-0x08001880,0x39613941,0x41624182,0x312141a3,0x49c32080,0x49a24161,0x49c349c3,0x49a34182,0x418130e0,0x5a245a05,0x49a14160,0x5a024981,0x624459e1,0x100041a3,0x4a033942,0x18602900,0x4a0220e0,0x5a656ae7,0x28e062a6,0x73283140,0x6a854120,0x20604160,0x31400800,0x20803943,0x28c10800,0x626651c4,0x10001820,0x10601040,0x398120a2,0x08001041,0x41635203,0x72c630c0,
-0x28a030e0,0x18600800,0x310049e2,0x20c13922,0x312041e4,0x41a24a04,0x39631820,0x310028c0,0x41c149a3,0x29003121,0x312041a3,0x28c01880,0x418120c0,0x208028c0,0x52043101,0x184049a6,0x10007b6d,0x00003102,0x41e318c0,0x39616264,0x62636ac5,0x49803920,0x30e03900,0x51a372c6,0x5a024980,0x498049c1,0x62635a22,0x732751c0,0x4a0049e0,0x5a8562a3,0x524062a4,0x732362a3,
-0x5a653140,0x28c051e3,0x944c7baa,0x41a062c4,0x5a455a63,0x28a05203,0x41a249a2,0x28e01000,0x41a128e0,0x28a03960,0x314249c6,0x524239a1,0x5a844a21,0x4a021860,0x5a4341a1,0x62803960,0x52607361,0x630073a2,0x5aa08402,0x5a807362,0x63005a80,0x6ae25260,0x6ae47b66,0x9c2b7b46,0x49e06283,0x73266ac4,0x73045220,0x51e15a22,0x52224160,0x39802900,0x522241c1,0x62c43980,
-0x39c14a00,0x31602920,0x41c03121,0x292041a0,0x524241a0,0x41c141c0,0x29002900,0x31602900,0x29202920,0x29001060,0x31203962,0x39803120,0x29003980,0x5a634a02,0x39a04a02,0x316039a1,0x5a6449e2,0x5a666ac7,0x49c35225,0x416228a0,0x20e04a23,0x00001861,0x41813122,0x39223101,0x20a01860,0x31203961,0x10201860,0x208028e1,0x31211840,0x188020c0,0x18601040,0x20a01040,
-0x41a228e0,0x31420800,0x41a34183,0x39213921,0x41413962,0x520449a3,0x51e349a2,0x39413921,0x310049c2,0x49a251c2,0x39005a03,0x49814140,0x49a14160,0x418230e0,0x20a049e2,0x10001880,0x00001040,0x182028e1,0x51e31840,0x62837306,0x7b2672c4,0x41625a21,0x51e51000,0x49c428c0,0x20801840,0x41831820,0x49a55a25,0x39831880,0x08001040,0x41c41020,0x49836ac8,0x498228a0,
-0x7b4a49a2,0x7309732b,0x20a05205,0x18601000,0x18401860,0x10003963,0x28e01860,0x394049c2,0x396049c3,0x39822080,0x396120c0,0x41a32080,0x30e041a2,0x39404182,0x418228c0,0x28c01840,0x31210000,0x08404184,0x20a12102,0x52036283,0x49608367,0x30e04160,0x51e16266,0x624349c1,0x6a847b26,0x5a216aa4,0x5a425a42,0x5a625a22,0x62a35a62,0x6ae47b67,0x62c46b04,0x6ae36ae4,
-0x72e66285,0x49e241a1,0x836a7b29,0x7b287b4a,0x49e14a02,0x30e05a43,0x20c03940,0x49c41880,0x20a03100,0x28a03941,0x184049e3,0x420039e0,0x62e54a40,0x4a015ac5,0x5a443960,0x41427b68,0x7bc23120,0x83e47ba1,0x7ba47be3,0x6b017363,0x62c25a80,0x838683a8,0x62c16ae3,0x83864180,0x732562a2,0x396062a4,0x83686aa4,0x52214180,0x39605221,0x41c041a1,0x5a822900,0x5a824a20,
-0x292039a0,0x41e05245,0x526241c0,0x52435a85,0x4a204a01,0x31405241,0x4a214a21,0x41c04a01,0x31634a03,0x106041c2,0x312041a3,0x20a02900,0x31403961,0x31203120,0x28e03960,0x4a0341c1,0x41a149e2,0x5a455a66,0x49c349c3,0x51c35204,0x42025a64,0x39c120e0,0x20613122,0x41823120,0x290028e0,0x31013981,0x29001860,0x312141c2,0x20c028a0,0x18c23101,0x00000000,0x00000000,
-0x20a01020,0x28e039a1,0x418339a1,0x41622060,0x41614162,0x39414182,0x41825204,0x49a24161,0x5a4451e3,0x49a14980,0x5a035a24,0x41404981,0x39205a03,0x41a15a43,0x28c049e3,0x62863140,0x39440000,0x28e03100,0x38e03120,0x522051e2,0x41004960,0x08002060,0x394030c0,0x418228c0,0x30e049a3,0x100049a3,0x28c06ac8,0x20c01060,0x10201861,0x000020a1,0x39411800,0x498230a0,
-0x30c12880,0x18401840,0x18203940,0x206028a1,0x31202080,0x41a22900,0x49e328e0,0x5a645a44,0x49e05a64,0x39605a44,0x39803960,0x28e041a2,0x206120c0,0x31204183,0x5a443960,0x5a6728e0,0x29011000,0x20e21860,0x52240820,0x6aa46285,0x59e059e1,0x498049a1,0x6a864180,0x49c072c5,0x49c06ac3,0x62614180,0x628351e0,0x62c16aa4,0x62a362c3,0x83896b04,0x73247b87,0x6ac249c0,
-0x72e628c0,0x7307836a,0x62a55a22,0x73287309,0x31206ac5,0x5a643940,0x20c041a1,0x10401860,0x310141a4,0x524328e0,0x62c241c2,0x41a06b25,0x840a4a00,0x5a6320c0,0x5a844a22,0x08005223,0x20c01880,0x39a02100,0x6b217ba4,0x73827bc2,0x4a6141e0,0x73228c4a,0x83a762c0,0x6ac56b03,0x4a0049e1,0x31406b04,0x314041c0,0x62835221,0x6ac47b47,0x52215220,0x62a15a41,0x41c062c3,
-0x73664a21,0x49e062e4,0x41e039a0,0x41e041c0,0x31603980,0x52624a21,0x42004a21,0x31403140,0x31213140,0x29001020,0x5a4562c5,0x41a12900,0x52234181,0x4a033940,0x62843140,0x52435202,0x29003160,0x51c40800,0x49c35a25,0x5a2572e8,0x52645224,0x41a05243,0x310028e0,0x41a31860,0x20803120,0x39605a43,0x41c15242,0x30e041a2,0x41c330e0,0x18a03982,0x31041020,0x29012901,
-0x28e02080,0x41c341a1,0x39413121,0x39623941,0x394141a3,0x51e34182,0x418249a2,0x392149c3,0x51c23920,0x5a2351e2,0x41605a03,0x6a6351e2,0x496051c1,0x49a15a22,0x5a433940,0x20a041a1,0x39414161,0x394030e0,0x49a149a0,0x6ac34160,0x49e072e4,0x28c03920,0x28c04181,0x392028c0,0x39624182,0x49a14181,0x31423940,0x18606ac9,0x18a11880,0x10603164,0x30e028c1,0x51c26a66,
-0x394130e0,0x310228e2,0x18203943,0x180028c0,0x52021800,0x206030c0,0x49c23100,0x62855a43,0x520249c1,0x41a25203,0x41814180,0x52243100,0x208020a0,0x41606aa8,0x6a863920,0x20805203,0x31013101,0x080028c0,0x83cb0800,0x59e16265,0x49804980,0x49805a22,0x7b473901,0x498130e0,0x62636a83,0x62a35a20,0x62a25200,0x4a005201,0x41c062c3,0x5a816ae3,0x312062a2,0x6b0362a1,
-0x730772e7,0x6ac46aa5,0x080030e0,0x5a647b48,0x732862a4,0x6ac57369,0x41a15a43,0x20a03140,0x28c21860,0x18800800,0x52627346,0x41c17364,0x10405262,0x41a318a0,0x5a8441c1,0x83aa5a43,0x080062c6,0x08406b27,0x7c225ac1,0x73846b01,0x4a605240,0x42007384,0x4a4141e0,0x4a225260,0x6ae26b04,0x29007b64,0x5a826ae3,0x28e041c0,0x7b861860,0x6ac34a00,0x6b055a41,0x5a6062a2,
-0x4a015a82,0x41c03980,0x5aa362e4,0x62c34a00,0x52615a82,0x41e039a0,0x62e441c0,0x52625241,0x290039a1,0x398141e1,0x6b051860,0x522349e2,0x49e149e2,0x31403961,0x28e03120,0x4a015201,0x49e23980,0x29000820,0x41a34182,0x312049c3,0x524428e0,0x41c15243,0x49c141a2,0x52033960,0x49e23100,0x62a341a0,0x72e56ac3,0x41a06284,0x52025a45,0x49e36263,0x49c05202,0x52243961,
-0x524241e0,0x312041a1,0x394141c3,0x39414182,0x41624162,0x49823921,0x30c05a04,0x49a149c2,0x5a0351c2,0x41615a03,0x5a0349a2,0x6a843920,0x414051a1,0x62426aa5,0x51e151c0,0x5a2349a0,0x6a636a84,0x414072a3,0x49806a63,0x49a04180,0x49805a42,0x59e06221,0x39212880,0x39214141,0x28a141a1,0x49a149a2,0x080030e0,0x000020a0,0x41c43122,0x10605226,0x28805a67,0x390128a0,
-0x41643901,0x18203982,0x39403120,0x28a03920,0x39021000,0x626651e2,0x31204181,0x5a845a44,0x6ac56284,0x49e241a1,0x5a844180,0x396041a1,0x20406aa6,0x392028a0,0x41803920,0x41825224,0xa4703960,0x18404a02,0x312028c0,0x7b268baa,0x6a8472a5,0x72a572c6,0x31002881,0x39203920,0x49a06283,0x62836282,0x41606283,0x6ae35a61,0x62c362a2,0x5aa05a60,0x4a006b03,0x41e07324,
-0x6ae67306,0x52216ac4,0x41c15a62,0x6ae762e4,0x4a022900,0x296062e4,0x39c118a0,0x08205265,0x28e40800,0x41a55a87,0x31205ac7,0x52433162,0x5a637b48,0x52417309,0x31004183,0x20e03120,0x20c141c5,0x4a440820,0x948b4a61,0x5aa02900,0x7bc6946a,0x52405280,0x6b035a80,0x7b6483a5,0x4a005200,0x6ac37303,0x5a228385,0x392028c0,0x730451e0,0x5a815a80,0x6ac441e0,0x62c27345,
-0x528162c2,0x5aa25281,0x62a47b67,0x62c35a84,0x5aa25281,0x5aa362c4,0x52a25aa3,0x5aa54a42,0x29203180,0x29217b8a,0x4a033980,0x314020c0,0x5a6341a0,0x49e34180,0x314041c3,0x398041c1,0x526439c1,0x20e15ac7,0x314220a0,0x39604a01,0x73493120,0x49e25223,0x4a023140,0x28e03980,0x62635243,0x5a6249e1,0x62835a21,0x6ac55201,0x41a16264,0x52035202,0x5a426263,0x18405202,
-0x41803940,0x28e15a64,0x312128a2,0x416130e0,0x18613942,0x30e01860,0x30e03941,0x51e41820,0x51e43941,0x49804961,0x51a15a02,0x620259e2,0x51c151a0,0x62424140,0x83266a83,0x5a0149a0,0x6a637ac3,0xa4096221,0x7b269c0a,0x7b265a01,0x7b0551e1,0x49a072c4,0x51a14981,0x414130c0,0x394049a2,0x732849e3,0x10003941,0x18201860,0x20a16ac9,0xacd141a3,0x28c128a0,0x41404963,
-0x39002880,0x28e028a0,0x5a034140,0x39404962,0x49e36aa7,0x31203941,0x418149c2,0x310049e2,0x51e26264,0x5a235202,0x49c251e3,0x4a0341a1,0x41803961,0x498151c1,0x41805203,0x49e241a1,0x5a444182,0x31003940,0x28c02060,0x6aa43100,0x62616aa5,0x5a425a42,0x51c16263,0x28c049c0,0x520372e7,0x6ae45a43,0x524041c0,0x62c25240,0x524162c3,0x6ae46b24,0x52206ae3,0x62c36b04,
-0x7b477306,0x41a062a4,0x39403980,0x6b463182,0x41e139c2,0x420152a3,0x42027367,0x08001060,0x6b0a4a06,0x41c41040,0x00001880,0x398041e4,0x6ae63100,0x6ae53940,0x31200800,0x20e01040,0x31631040,0x00002923,0x42404202,0x73866325,0x296031a0,0x83e67383,0x83e59467,0x83c58c06,0x83857303,0x5a407b44,0x31005a60,0x73047b65,0x73046ac4,0x5aa37b66,0x4a2041e0,0x6ae26b02,
-0x62c26b23,0x41c05260,0x524062c1,0x4a004200,0x52614a01,0x31805aa3,0x41c24a42,0x318039c1,0x4a234a22,0x210018a0,0x5a8539a0,0x4a037349,0x49e149e2,0x28e049c1,0x39c039a0,0x29603180,0x20e03160,0x29222920,0x106020c1,0x4a232940,0x41e13961,0x41c13960,0x39603160,0x39a128e0,0x41c139c1,0x39605203,0x41603100,0x30e041a0,0x39804160,0x5a245223,0x6aa43940,0x5a6362c4,
-0x398062c4,0x10201860,0x31215225,0x30e04182,0x20a03121,0x28a01861,0x418251e3,0x28a03941,0x416149c3,0x38e12040,0x51a149a3,0x6a436244,0x41406202,0x62413920,0x72e36261,0x7b2472e3,0x72c27ae5,0x62217281,0x62625200,0x52208345,0x8b886ac3,0x93a84980,0x6a636243,0x51c23920,0x394049c2,0x52045204,0x39232080,0x52054183,0x100028c0,0x39623141,0x08006ac9,0x41416a86,
-0x18203100,0x5a2530c0,0x5a2451e4,0x62853900,0x39807b08,0x41a141a1,0x312028c0,0x5a435a43,0x51e251e2,0x39205a43,0x20802080,0x28e03120,0x5a643140,0x49c13980,0x7b286284,0x5a445222,0x49c15a43,0x39404180,0x31002880,0x5a213940,0x62a16284,0x51e06262,0x41606284,0x49a049c0,0x41a05202,0x6ae35221,0x5a6162c2,0x62a35a81,0x6b037324,0x5aa17b85,0x83c641e0,0x6b444a20,
-0x62a36b05,0x41a06ae5,0x41e05a82,0x31804a02,0x39c03960,0x39a05aa3,0x39c039a1,0x41c041c0,0x31814a04,0x62c820a2,0x00000000,0x39c20800,0x73081841,0x62a37b49,0x104049a2,0x28e01020,0x31211000,0x212041c3,0x212041a2,0x318039c0,0x634152a1,0x52824240,0x83c68404,0x8be883e5,0x7b628c05,0x9c489428,0x8be583a4,0x7b437324,0x83a66b00,0x39c07ba7,0x52804200,0x62e15aa1,
-0x526062a2,0x4a0062e4,0x4a404a20,0x526162c2,0x39a041c0,0x52834201,0xa50e62e5,0x5aa5d674,0x5a843980,0x522320c0,0x39813961,0x41a228e0,0x20c03142,0x31805244,0x4a414a42,0x31603180,0x41e04201,0x18a039a0,0x10603182,0x4a6318c0,0x41c20800,0x31403140,0x398041c1,0x31605243,0x31404a00,0x62857b88,0x6284b50f,0x41c05221,0x41c049c1,0x18403941,0x5a454182,0x5a6441a1,
-0x62627b26,0x5a834a02,0x18603941,0x39403120,0x18203923,0x394028c1,0x30c149c3,0x28c03101,0x39203941,0x18205203,0x414030e3,0x59e24180,0x51c26a64,0x62413920,0x72c36262,0x6aa172c3,0x5a007b03,0x5a007b03,0x72c272a2,0x6aa45a01,0x622449c0,0x628151c0,0x62446263,0x72e651c0,0x6ac55202,0x49a151e1,0x392049a2,0x41621820,0x28c04181,0x31403921,0x83487ae7,0x51c34140,
-0x10004161,0x414149a1,0x41811820,0x41a13960,0x41a23961,0x4a023960,0x52432920,0x49c141a1,0x30e051e2,0x39205202,0x41805203,0x4a0141a0,0x52423960,0x39a039a0,0x4a215221,0x28e05262,0x52233120,0x5a446b05,0x39403940,0x30e041a1,0x62633920,0x49e06263,0x51e16ae5,0x52006aa4,0x62835a21,0x5aa162a3,0x5a825a81,0x6ae15a82,0x6ae16ae3,0x5a405200,0x73246b03,0x6b037345,
-0x31203960,0x41827328,0x62c47326,0x4a216ae7,0x526241c1,0x31a05aa4,0x31605ac2,0x6ac439a0,0x5a881880,0x292062c9,0x00000000,0x08200800,0x5a846b27,0x30c049c1,0x41a04181,0x00203100,0x00000000,0x10600800,0x41e15a82,0x08602140,0x39c10000,0x5ae22100,0x5ae231a0,0x4a806340,0x5aa05ae0,0x94867361,0x94454a40,0x5ac08c43,0x6b218c26,0x39a04a20,0x4a0139e0,0x6b045280,
-0x4a604a41,0x5a8162e2,0x41c05241,0x4a0041e0,0x290041e0,0x5a853100,0x39c028e0,0x62e55263,0x396041a1,0x316041c1,0x522441a1,0x18803960,0x49c249e3,0x41e12920,0x5ae241e0,0x42004200,0x39c02120,0x4a015262,0x31424a23,0x4a0239a1,0x41a23121,0x31403980,0x39803980,0x62c45222,0x52425262,0x62845242,0x73255a63,0x6ae441a0,0x52233120,0x5a2428c0,0x522449e3,0x8bca3940,
-0x5aa262c3,0x49e06ac4,0x41a13960,0x41a128e0,0x394149c2,0x31011840,0x49c34162,0x28a05a25,0x49a12080,0x5a035a02,0x5a0230a0,0x72c64160,0x39205a03,0x72e44140,0x5a216a62,0x59e259e0,0x62626262,0x39205201,0x7b255a42,0x498072a4,0x51a04140,0x834759e1,0x6a828347,0x6ac46282,0x62837306,0x49a051e0,0x5a236244,0xb4f02060,0x28e15a24,0x628628e0,0x72c751e3,0x51c259e3,
-0x72e730e0,0x416028c0,0x49e328c0,0x41803961,0x30e03100,0x394028e0,0x6ac55a64,0x416049a1,0x49e249e2,0x49a049c2,0x62836283,0x522149a0,0x4a2141c0,0x4a0041e0,0x41c05aa3,0x39804a22,0x396028e0,0x39405201,0x416049c1,0x5a225a02,0x72e551c0,0x6ac349c0,0x6ac449c0,0x6ac441a0,0x62825a62,0x5a825221,0x5a8341c0,0x628149c0,0x522049a0,0x6ae35240,0x83a67b64,0x41e04a00,
-0x5223accd,0x39601880,0x7b6820c0,0x62e56b08,0x83e86b06,0x62e56b25,0x31804200,0x396041e1,0x18813101,0x52842901,0x21220040,0x10402920,0x49e11040,0x8ba741a1,0x41407305,0x20803940,0x08001020,0x29210000,0x526341c1,0x29405ae4,0x424131a0,0x31c04a06,0x63468c6d,0x5b0152c0,0x52a06340,0x6b637363,0x42007381,0x73a26b62,0x5aa052c0,0x5ae27364,0x31405ac0,0x41a162e1,
-0x18c02940,0x398041c0,0x41e05262,0x4a0041e0,0x49c041a0,0x52211820,0x420041c0,0x4a425262,0x52235a84,0x41a14a02,0x49e35223,0x52254a03,0x73483980,0x31403140,0x52c14200,0x4a4139e0,0x42014201,0x41a04a20,0x31203140,0x5a623140,0x396249c1,0x39604a00,0x4a013160,0x41e03120,0x5a824a01,0x49e05221,0x4a006ae4,0x49e05a81,0x522449e1,0x41825203,0x31203961,0x31003921,
-0x29002900,0x5a613140,0x524241c1,0x20601840,0x39424983,0x20802060,0x51e23921,0x39613941,0x49a23120,0x51804140,0x52025a02,0x41404160,0x498038e0,0x832530e0,0x51e051c0,0x49825a01,0x49a04980,0x41805202,0x51a17327,0x5a236241,0x41413920,0x6aa27b05,0x72c67b25,0x7ae972c7,0x49c15a44,0x39405a41,0x49e149a0,0x836a30e0,0x180049a2,0x730a41a2,0x5a034981,0x59e24962,
-0x49a13100,0x39205a05,0x52033100,0x49e23120,0x49c26ac6,0x41a04181,0x31005a23,0x628449c1,0x49e23960,0x5a6249c1,0x5a625221,0x52206282,0x4a005a61,0x42005281,0x5a835242,0x314041c1,0x5a623960,0x5a4241e0,0x49805201,0x6ac46a83,0x62427305,0x62822080,0x628262a3,0x62a35a61,0x5a628386,0x52424180,0x52225a83,0x39203980,0x39204161,0x49c349a1,0x39403960,0x6b054a01,
-0x52037b47,0x28c01820,0x5a635222,0x732741a1,0x62c53940,0x6b2539a0,0x41c041e0,0x49e239a0,0x29205243,0x5ac12940,0x62c15aa1,0x4a2083a6,0x00000820,0x5a8139c3,0x7b246262,0x62a449c0,0x00001820,0x73643140,0x6b027364,0x39803140,0x00005a83,0x5ae531c1,0x73a62940,0x52c14a60,0x42404a60,0x6b225260,0x52814200,0x4200a50c,0x63416322,0x73637383,0x62c25260,0x5aa17364,
-0x294039a0,0x41e041c0,0x31605aa1,0x52624a00,0x6b055aa3,0x62c45242,0x31604202,0x52a241e0,0x31403140,0x41a14a02,0x5a6649e3,0x41c141a4,0x49c23960,0x52a25243,0x5aa24200,0x63037364,0x5a8141c0,0x4a2062e1,0x39803140,0x31403160,0x49e15a62,0x52414a01,0x41a13160,0x396049e2,0x41c05222,0x49e15a62,0x524349c2,0x62845a83,0x5a4441c0,0x52045224,0x394149e4,0x31203120,
-0x29414a01,0x4a211080,0x62a44a00,0x208028e0,0x5a245a03,0x30e049c2,0x288030e0,0x41613100,0x416030e0,0x62444961,0x49a06244,0x49a06a64,0x49c15201,0x41406284,0x51c06aa4,0x59e172e5,0x51c172a4,0x39204180,0x41603100,0x5a436a84,0x51e151c1,0x41406263,0x394072e5,0x18008368,0x418149c2,0x62633920,0x5a026a84,0x5a435a02,0x28c03920,0x08005a24,0x5a036223,0x41604980,
-0x62645a02,0x51e25a03,0x628449e1,0x41a05201,0x41a05a64,0x520249e1,0x5a015a43,0x72e26281,0x6a8351c0,0x628372a4,0x62a36282,0x5a826ae3,0x39805241,0x6ae34a00,0x62c25a81,0x524162a3,0x524162a3,0x6ae45221,0x51e07ae6,0x51c06a63,0x62626a62,0x628328a0,0x5a416282,0x6ac462a3,0x41806ac4,0x41a15240,0x28c03120,0x49c149c2,0x52223120,0x39603120,0x394041a3,0x28a028e0,
-0x49c26ae7,0x418162a5,0x62666266,0x28c06287,0x28e03941,0x6ae641a0,0x080041e1,0x082018a0,0x7323946b,0x4a405240,0x6b435240,0x42007323,0x10600800,0x08000800,0x72e47323,0x626172e2,0x73426ac3,0x83c583a5,0x5a6062a1,0x28c039a0,0x39823180,0x5ac32100,0x42207bc7,0x5ae373a7,0x5ae46325,0x6b2262e4,0x73637ba6,0x63456b84,0x6b838445,0x52806341,0x736362e1,0x62e15aa0,
-0x5aa25aa3,0x52615ac2,0x314041e0,0x5a8341a0,0x73264a01,0x4a215243,0x422041e1,0x4a212920,0x62c562a4,0x20c03140,0x396120c0,0x4a027328,0x39605243,0x52813160,0x41e04a41,0x6b4462e3,0x4a405ac1,0x5aa341c0,0x62c42900,0x49e05260,0x5a825a61,0x62e46b04,0x4a2241c0,0x418149c2,0x49c04a02,0x522162a3,0x31405223,0x29005221,0x41a249e1,0x49c34181,0x49a34182,0x49c249c2,
-0x31804200,0x524352a4,0x6ae66264,0x312041a2,0x49c15a24,0x5a2451e2,0x392049a2,0x5a0430c0,0x5a2351e2,0x62435a22,0x41406263,0x416051e1,0x30c049a1,0x62635a22,0x49a06222,0x51a051e1,0x51a05a01,0x49606243,0x72e572a5,0x51c25a43,0x49a051e2,0x51c14140,0x49806aa5,0x5a4372c5,0x41603100,0x41404180,0x5a016ac5,0x5a414180,0x5a446285,0x628551e3,0x59e24140,0x624251c0,
-0x628351c2,0x62836262,0x5a437306,0x5a436282,0x4a013980,0x52015222,0x6a8349e1,0x72e26aa1,0x72e48364,0x51e16a84,0x41a049c0,0x62c35a82,0x5a8262a3,0x62c262c3,0x52405a61,0x52415aa1,0x628362a4,0x62824180,0x72c38328,0x7b058b67,0x51e06242,0x62853960,0x52205a62,0x72e762a3,0x39405200,0x31207b48,0x418149c2,0x28c03120,0x312028a0,0x39614181,0x41811860,0x31003960,
-0x39413961,0x39016a87,0x6a8751c3,0x6ac86266,0x51c349c4,0x62a65a44,0x524541c2,0x080020c0,0x62a00000,0x62e06303,0x5a816b22,0x524062c4,0x396028e0,0x418020c0,0x41e041a0,0x49e049e0,0x62c24a00,0x7b6262c1,0x7b447341,0x39606ae3,0x5a616b23,0x5ac24a00,0x39c041c0,0x52805281,0x31805282,0x294041e1,0x5b025ae1,0x42204a80,0x4a404a80,0x73627382,0x39a05241,0x52816b24,
-0x41c05261,0x526162e2,0x398141c1,0x52432904,0x4a013140,0x10603980,0x526439c0,0x39a02940,0x29213980,0x20c018a0,0x292018c0,0x39601040,0x52414a22,0x39e03160,0x52805ac2,0x42204220,0x52a14a60,0x4a2062e2,0x52413980,0x62a362a2,0x52205a62,0x6b0549c0,0x6ae56b05,0x7b485243,0x5a645a23,0x5a645a42,0x52035a44,0x49e35223,0x31205203,0x28c03961,0x416228e0,0x49e349c4,
-0x41e03980,0x4a2249e2,0x62a42900,0x28e05a43,0x5a0349c2,0x73074981,0x5a244182,0x390049a1,0x49a049c1,0x5a0159e1,0x51c14140,0x51c151e1,0x418128e0,0x51c14160,0x6a8551c1,0x59e159e1,0x8b6672a5,0x7ac572c5,0x51c07ae5,0x30e06262,0x51c228a0,0x626451c1,0x51e051c1,0x49a283a8,0x39006284,0x834772e6,0x51e16aa5,0x41806263,0x5a236263,0x52027b27,0x5a035a22,0x6a846222,
-0x49804140,0x62636242,0x62846aa4,0x5a425201,0x5a4249a0,0x51e149c0,0x49c049a0,0x6aa14160,0x62417b24,0x5a216222,0x62a26282,0x52006ac3,0x62a262a3,0x62826ac3,0x62a26b03,0x62c36ae3,0x5a615a42,0x73253100,0x628272e4,0x9be949c0,0x6a636aa4,0x626449a0,0x39603120,0x416249c1,0x49c228a0,0x20403940,0x39412880,0x182028c0,0x39613100,0x31003941,0x31203941,0x396041a3,
-0x418328c0,0x62665a25,0x5a2628a0,0x626672c7,0x08005a25,0x290049c1,0x314141c2,0x62e45266,0x62c27beb,0x4a4062e2,0x63035a82,0x5a816b03,0x62825a60,0x62c26ae4,0x39c049e0,0x4a003980,0x7b853140,0x83a55220,0x62a16ae1,0x4a003120,0x31407323,0x5a8262a2,0x5ac34a20,0x420052a2,0x39c039e0,0x420262e4,0x5ae16322,0x52c06ba2,0x42406343,0x62e052a0,0x31404200,0x4a0041e0,
-0x52815261,0x62c44a20,0x316041a0,0x290018c1,0x49e141c0,0x316141e0,0x00003140,0x294039a1,0x31623982,0x20e02940,0x318139c2,0x41e12920,0x41c041e0,0x41e141c0,0x52805ae2,0x632352a1,0x4a404a40,0x5aa14a00,0x62c36ae3,0x62a362c3,0x73036ae4,0x73065221,0x41a05202,0x49e25a84,0x52025202,0x5a645a63,0x41a23100,0x7b4a49c3,0x206028a0,0x30e028e0,0x208020a0,0x31001000,
-0x520149c1,0x184041e0,0x4a0162a4,0x31205242,0x31203100,0x5a453120,0x418149c3,0x498149a1,0x51c149a2,0x62434960,0x496059e2,0x62244140,0x30e030c0,0x72c649a2,0x5a014980,0x72836222,0x6a845a01,0x622359c1,0x6a846a63,0x5a015a22,0x41606244,0x83683920,0x51e15a23,0x49a05201,0x6a846283,0x51e15a22,0x51e16243,0x624351e1,0x5a026284,0x62633940,0x49c05a23,0x62226a83,
-0x62825200,0x62836aa3,0x62a35a41,0x5a4262a3,0x6ac45a62,0x6aa472e5,0x5a2051e0,0x6a8359e1,0x51e05a22,0x52005a40,0x62a36282,0x41a041a0,0x52205a62,0x5a616282,0x5a8249e0,0x524162a2,0x31005221,0x62a33960,0x7b0549a0,0x41405a21,0x41406243,0x49c06262,0x5a4349e1,0x28c04180,0x51e428c0,0x30e13920,0x39203942,0x28c03100,0x20803961,0x28c03100,0x31203100,0x49e31000,
-0x396062c5,0x52035223,0x62456225,0x41812060,0x5a6630e0,0x52035a66,0x4a243960,0x7b8a5ac6,0x10a04a44,0x62e418a0,0x4a005241,0x5a815242,0x4a005ac1,0x62c162c1,0x5ac04200,0x6b236302,0x6ae16b02,0x73225240,0x5a805260,0x734462c1,0x28c083a7,0x6ae47b86,0x39e05261,0x52a14220,0x52a14a62,0x294062e3,0x6b416b63,0x7be36ba1,0x7be46b64,0x73835ae0,0x632173c3,0x49e07b85,
-0x41a049e0,0x5aa25a82,0x41e139e0,0x49e141e2,0x524362a4,0x20c05a63,0x29403162,0x20a02940,0x31813181,0x39804a22,0x39814a44,0x4a223981,0x62c35241,0x4a005241,0x52815261,0x52a15ae2,0x63045280,0x5ac262e3,0x6ae36b04,0x6ac362c2,0x6ae37324,0x62c35221,0x41c039a1,0x6aa55a84,0x62635a22,0x5a4349a0,0x18601860,0x28c11840,0x20803961,0x49c23941,0x41813960,0x52033120,
-0x49e349c2,0x41c449e2,0x49e04a47,0x49e241c0,0x18603120,0x39410000,0x49a049c2,0x5a035a03,0x30e04160,0x49803080,0x51e15a01,0x39404160,0x396059e3,0x38c07b27,0x498151a1,0x7b2830e0,0x51816a64,0x6a646a23,0x6a646202,0x62435a01,0x62643940,0x5a0449a2,0x41404140,0x5a435a24,0x72e551e2,0x51c16a83,0x62636a84,0x51c06261,0x51c06262,0x622351e1,0x62635a42,0x626372c5,
-0x62826a83,0x52005a20,0x6ac36ac2,0x626249e0,0x6aa26ae4,0x62826280,0x62626aa2,0x6aa349c0,0x73065200,0x72e46282,0x73045a20,0x73056ac3,0x62a262a3,0x5a416ae3,0x62a36ac3,0x5a6241a0,0x39404180,0x51c43920,0x520028a0,0x52005a43,0x5a215a41,0x72c56283,0x5a215a21,0x5a245a45,0x41415a45,0x626551e4,0x41605a23,0x41813120,0x39403100,0x28e03101,0x41c23120,0x39a13140,
-0x5aa462c4,0x4a024201,0x5a246aa6,0x624672c8,0x62a76aa7,0x5a665204,0x41c33961,0x524241a2,0x108039a1,0x528239c0,0x20e05241,0x41e03980,0x4a415261,0x420039a0,0x52a039c0,0x42004a40,0x62a14a00,0x5a805200,0x6ae37344,0x62c25240,0x62c36ae4,0x734541a0,0x63226302,0x5ae15280,0x63425b02,0x6b826b82,0x63206320,0x52a05ac0,0x63234200,0x7be39cc9,0x74006340,0x49c06b21,
-0x41a05a61,0x62c35a61,0x6b0462e3,0x398041a0,0x41c15a64,0x4a224182,0x4a025242,0x29002920,0x5aa53180,0x5a8362e4,0x00007348,0x29003160,0x52415221,0x52405aa4,0x31803140,0x39c039a0,0x4a212940,0x6b035aa2,0x39c04200,0x49e03980,0x52405241,0x528162e4,0x4a0062c4,0x52025243,0x72e65a64,0x62a56263,0x49e43121,0x28e03102,0x49a35a45,0x28e02080,0x312049c2,0x41a249e2,
-0x310049c2,0x41c249c2,0x39803182,0x52423980,0x10203960,0x184049c3,0x51c15204,0x49a26265,0x39401860,0x41604161,0x41604180,0x498149a2,0x208049a1,0x49a14180,0x41803920,0x5a236aa5,0x49c172c6,0x62445a03,0x30e051e2,0x51e23901,0x72a66244,0x30a030c0,0x6a853900,0x6a8549a3,0x62634160,0x5a2072c3,0x7ae551e0,0x72a46a83,0x83484980,0x49a16a64,0x72c45a22,0x51e05201,
-0x6ac37b46,0x6ae37303,0x6ac26282,0x62a26ae2,0x72e45200,0x72e46ae2,0x6aa372e5,0x62826282,0x72e55a41,0x72e46ac2,0x6ae372c5,0x5a406ae4,0x6ae362a1,0x62826ac3,0x5a415a42,0x30e030e0,0x49a149c1,0x49c228c0,0x62a449a1,0x62443920,0x6a856a85,0x390072e6,0x49c03900,0x49c37307,0x49c23920,0x39203940,0x49a149a0,0x49e33120,0x31004181,0x396020a0,0x4a033981,0x316041a1,
-0x6b0662a4,0x6b077327,0x52445a64,0x39407307,0x5a6649e2,0x51e53921,0x52455a66,0x4a034a04,0x394128e0,0x526241c0,0x52834a61,0x630552a3,0x420052a3,0x39e04a20,0x73644220,0x39c06b43,0x62c320a0,0x7ba36b21,0x73657345,0x42005280,0x632352c0,0x4a406b64,0x7be45ac0,0x73a37c05,0x5ac06b82,0x4a4052a0,0x42204220,0x63015241,0x6b4762c3,0x31c04a81,0x7c645300,0x734673a4,
-0x73255240,0x5a824a00,0x6ae37345,0x31405a82,0x4a004a00,0x52423160,0x41a049e0,0x52223120,0x52415242,0x52614a60,0x18c02120,0x39a16326,0x398041e0,0x41e041e0,0x29605242,0x4a615281,0x39a02960,0x62c349e1,0x42005aa3,0x29604a41,0x00002980,0x52625ac3,0x31403980,0x28e03960,0x5a436284,0x62867306,0x522162a3,0x520449c1,0x394341a2,0x4a033102,0x62c65224,0x5a455a45,
-0x49a23100,0x28c04181,0x52003960,0x41805a21,0x7b495a62,0x20814182,0x28c241a3,0x5a2349e1,0x20a11040,0x28c03901,0x51e24161,0x28c051c1,0x39806aa7,0x5a433940,0x41615a42,0x41405a03,0x49a35a24,0x49c149a1,0x41823920,0x20402880,0x51e16ae5,0x39005203,0x390051c2,0x5a0238e0,0x51e15a44,0x6aa56285,0x5a2072e4,0x72c56262,0x8ba66281,0x496051c0,0x62826263,0x6ae362a3,
-0x52203960,0x4a0041a0,0x6ae341c0,0x5a6162c1,0x628162a2,0x49e062c1,0x62806ac1,0x6ac46b03,0x73446282,0x73247303,0x72c36ae4,0x52207b24,0x6b0462c2,0x5a615241,0x520272e4,0x5a234180,0x498138e0,0x49804981,0x62633900,0x49c041a1,0x51e25202,0x28c049c1,0x39603920,0x62855a43,0x41603960,0x51e15202,0x49e151e2,0x396128c0,0x31002080,0x31003961,0x39813960,0x31403160,
-0x20a05a84,0x5a855244,0x41a27b49,0x418149e3,0x5a455a65,0x73095204,0x52054162,0x41a35a66,0x20c041a2,0x5a814a00,0x42003180,0x41e13141,0x4a2041e0,0x41e03980,0x6b224a40,0x62e25260,0x41c03980,0x29202920,0x52417344,0x20e06b44,0x630252a2,0x39c04220,0x634073a4,0x73a17be2,0x8c467383,0x83e75ac1,0x62c37365,0x29007347,0x39c05242,0x63624260,0x10c06364,0x63037386,
-0x83856ae4,0x62c36b04,0x49e05241,0x39807324,0x4a204a00,0x5a825241,0x5a6241a0,0x52415a62,0x52614200,0x41e05261,0x10603180,0x41e13180,0x4a2041e0,0x52405aa1,0x42007b87,0x52a24a40,0x21004200,0x62c35222,0x52a25282,0x294039c0,0x52823180,0x52614a20,0x5a8262e3,0x39604180,0x52025a43,0x62655a23,0x41c06ae7,0x31004a00,0x49e249c2,0x41a241c2,0x52245223,0x184049c3,
-0x838b2080,0x49c049a1,0x62625a62,0x5a6241a0,0x52416282,0x18603100,0x20c020a0,0x28c03982,0x20801880,0x394030c0,0x49a230e1,0x51e35203,0x41a25a25,0x41a05202,0x00001840,0x51e34160,0x28a028c0,0x418249a3,0x180051c4,0x28c04162,0x51c14180,0x62446aa5,0x62446264,0x394030e0,0x51e25a43,0x72e53960,0x62626222,0x6ac272c4,0x83266a83,0x5a006241,0x6aa56261,0x62826ae3,
-0x49c06282,0x6b0349e0,0x6b037323,0x5a615aa0,0x520062c2,0x62a15a81,0x6ac26281,0x73046ac2,0x41a05200,0x6ae46ae3,0x49e05a62,0x73245a61,0x6b045a81,0x5a616b04,0x41805a62,0x72e66ac5,0x5a234160,0x418051e2,0x39404981,0x49c049a1,0x5a4349c1,0x394049c1,0x41805a23,0x51e16284,0x39603940,0x52025a23,0x52235a24,0x41a13940,0x41a05223,0x49c23120,0x29005223,0x39603120,
-0x20a05244,0x7b695a84,0x20a049e4,0x628630e0,0x6ac76ac7,0x73096ac7,0x52263121,0x62885226,0x39802080,0x5ac262c3,0x318139e0,0x316239e0,0x4a000820,0x5a805ac1,0x5ac05a60,0x62e15260,0x62c462e2,0x39a04a20,0x41c04a20,0x73854220,0x5ae252c0,0x52805ac1,0x6b426322,0x52a073c4,0x63027bc5,0x5aa04a20,0x5a805aa0,0x41a06b23,0x41e062e2,0x426031e0,0x42605302,0x42204a80,
-0x49e06b02,0x5a6141c0,0x5a8241c0,0x41c062a2,0x62c25281,0x62c25aa1,0x49e05240,0x52405240,0x296010a0,0x31803180,0x18a018a0,0x39802940,0x62c341e0,0x5ac27b87,0x4a619c8a,0x42204a40,0x41e35ae3,0x5a625aa3,0x5ac339c0,0x6b245282,0x63416323,0x41e06321,0x4a215262,0x4a015a82,0x41804180,0x49a23920,0x62c45221,0x49e162a4,0x312049e1,0x20c03982,0x20c05223,0x182041a2,
-0x5a6341a3,0x5a615221,0x5a415a61,0x41805a42,0x39606ae4,0x08004180,0x080028c2,0x28e00000,0x10203961,0x31003900,0x49a41800,0x41815204,0x310030e0,0x41c162a6,0x20c01020,0x51c251e3,0x30e04182,0x416041a1,0x49c26264,0x41803940,0x72e77b48,0x416051e2,0x41603920,0x310062c5,0x41613940,0x5a233960,0x7b056262,0x72c438e0,0x62406ac2,0x6aa36aa2,0x730362a2,0x5a415a61,
-0x73036ae3,0x5a807304,0x62c15aa0,0x62c25aa1,0x62a36ae3,0x6ae46ac3,0x62617304,0x6ae262a0,0x52206282,0x62a36ac3,0x5a816ac3,0x52405aa2,0x524162c2,0x5aa262a2,0x416049e0,0x416049a1,0x5a225201,0x49805201,0x52026a85,0x49c24181,0x396049c0,0x418041a1,0x41a151e2,0x522149c0,0x41606282,0x30e03100,0x312030c0,0x41803960,0x41c049e1,0x5a635222,0x31405223,0x41c241e2,
-0xe6d762a6,0x52245a66,0x49c38bcb,0x20a05225,0x08207328,0x316262e7,0x5a465a87,0x1822734a,0x28e01000,0x52614a20,0x5a824200,0x62c439a0,0x31605a65,0x5aa03160,0x73657363,0x31806b43,0x632339e0,0x62c16b03,0x6b0262c2,0x4a2041c0,0x6b644240,0x42005280,0x736462c2,0x4a006b44,0x73457345,0x39606ae4,0x62a53140,0x41e083c8,0x5ac25aa3,0x52c15261,0x31a06b44,0x73c34240,
-0x52025260,0x6b015a61,0x62c15240,0x62c23180,0x5a614a20,0x62c162c1,0x5ac16b02,0x41e16b22,0x29202960,0x210039c0,0x39a120c0,0x42002940,0x52414a41,0x5aa23160,0x5aa15aa2,0x52825aa0,0x62c549e1,0x4a0139a0,0x4a004a01,0x5ac24a00,0x62e14a20,0x52a15aa0,0x62a45262,0x5a625a62,0x73285a42,0x52235a24,0x5a415a23,0x208049a0,0x310041a1,0x08000800,0x41c039a0,0x8c0b3141,
-0x520349c2,0x5a226264,0x49e062a3,0x5a4041a0,0x6ac35a61,0x10215a63,0x08011060,0x18600841,0x20a11880,0x10003963,0x39222082,0x20803100,0x184028a0,0x18405206,0x41621000,0x5a234140,0x51c25a23,0x49c15223,0x51e149e0,0x41a15201,0x522249e1,0x49c13940,0x41805a22,0x41c15243,0x4a025a84,0x49c128e0,0x49c05a63,0x51e072c4,0x7b4572e4,0x62826aa3,0x62c26ae3,0x52404a00,
-0x39805a61,0x49e05aa1,0x4a006ae4,0x7b665a60,0x520062c2,0x52215221,0x62a26ae3,0x62826ac3,0x62a25a21,0x52615261,0x62e26b04,0x41e062e3,0x5a825261,0x41c05a83,0x41804180,0x49a03940,0x5a433940,0x49c06283,0x62847306,0x5a6351e1,0x49c16265,0x31203960,0x31403960,0x5a623140,0x51e149e1,0x39405a42,0x41803120,0x398041a0,0x524241a0,0x396041a1,0x49c262a5,0x28e03120,
-0xb512944e,0x31416aea,0x62e75a88,0x49e46ae8,0x106049e4,0x62c841c4,0x62874a05,0x49e128c0,0x4a201040,0x73267364,0x4a006b04,0x4a213960,0x41e11020,0x31a039a1,0x6b634a80,0x6b416320,0x73a24a40,0x52607b83,0x62e15260,0x52806b02,0x5ac06322,0x52625282,0x316062e3,0x62e47345,0x62e35a83,0x62c362a4,0x7ba73160,0x73656b03,0x6b647344,0x5ac16b23,0x31a07ba6,0x426052c0,
-0x5a804a20,0x5a807ba5,0x5ac06301,0x4a0039c0,0x62a25a61,0x62e06b02,0x5ac07382,0x63005260,0x4a205280,0x422039e0,0x4a405ac2,0x52a16b44,0x41e039a0,0x314010c0,0x4a2039a0,0x52625280,0x398041c0,0x39805222,0x39a083c9,0x62a262c3,0x5aa05aa0,0x4a4241c0,0x5a6141c0,0x52415a82,0x49c149e0,0x41605a22,0x5a625a25,0x5a6262a2,0x39803980,0x39611880,0x4a0339a0,0x41a14a23,
-0x28e03960,0x39405a45,0x5a624160,0x52206282,0x62c249e0,0x10405241,0x10002900,0x000020a2,0x41a228e2,0x08003982,0x20a03101,0x39424182,0x182041a3,0x18403940,0x5a4328e0,0x7ae66244,0x41806a85,0x62c42900,0x49e06b04,0x49e049c0,0x4a014a01,0x524262a3,0x49e049e0,0x52613960,0x73465242,0x5a225a22,0x6aa36284,0x6aa36aa4,0x5a416262,0x62826aa2,0x62e249e0,0x62a25a81,
-0x522162a2,0x5a815222,0x62a27b85,0x6ae45a82,0x6ac362c2,0x5a617304,0x5a607b48,0x72e449c0,0x5a826ac3,0x5aa15281,0x5ac15280,0x4a2062c3,0x62a36b04,0x62846ae4,0x62a341c0,0x73065201,0x39605202,0x418049a0,0x5a025a63,0x52007305,0x39403100,0x396049c1,0x39422080,0x31403101,0x520049c0,0x41c049e0,0x4a0162a4,0x5a643980,0x39603980,0x41805241,0x418049e1,0x39603140,
-0x00000800,0x10200800,0x18c00000,0x212018e0,0x4a0639a2,0x188020c0,0x52453162,0x080039a4,0x62e60800,0x52616b25,0x41e041e0,0x524162a3,0x28c05a82,0x422041a0,0x39e04a40,0x73845280,0x73637383,0x5a805220,0x62c162e2,0x73836b41,0x39e04a40,0x73455280,0x6b045262,0x5aa3b52f,0x73464a00,0x41a05a82,0x73266ae4,0x736541e0,0x5ac16b03,0x5ae24a41,0x41e05ae2,0x5ae16b43,
-0x62e06b63,0x63027384,0x6b206301,0x4a405280,0x5a6062e2,0x52807b43,0x5ae05ac0,0x6b6052c0,0x73a173c2,0x52807ba3,0x63226b83,0x52a14200,0x39c03180,0x528141e1,0x62c35a81,0x41805221,0x20c03140,0x5a633160,0x524462a6,0x524039a0,0x528049e0,0x39c13981,0x31802940,0x62a25a82,0x6ae46ae3,0x49c23980,0x62633100,0x62826283,0x5a634180,0x39804a21,0x312041a1,0x39a041c1,
-0x41813940,0x39603960,0x49e03940,0x49c06282,0x52615a41,0x520241a0,0x29003961,0x10205247,0x20a00800,0x52033100,0x312041a2,0x520341a0,0x49e441a2,0x49e241a2,0x49c141a1,0x51c151c1,0x6ac46263,0x62a45a63,0x62a362e4,0x62c362a3,0x62c349e0,0x62a36ae4,0x6ae45240,0x62c262a3,0x62a36b04,0x6ac44a00,0x5a426ac5,0x5a616ac3,0x39606282,0x62827304,0x520062a2,0x52616b04,
-0x4a004200,0x5a624a00,0x6b246ae3,0x41c062c4,0x5aa162a2,0x73255220,0x6ae47304,0x73466aa2,0x62a25a61,0x62e26ae3,0x62e262c2,0x62c362e4,0x62a341c0,0x6b065201,0x5a0249a0,0x5a0249a0,0x30e049c1,0x41803960,0x41803960,0x49c15201,0x31203100,0x520230e0,0x51e33961,0x39602900,0x628349e0,0x49c06283,0x5a415200,0x41a051e0,0x524249e0,0x52213960,0x39805a43,0x20a03941,
-0x000049e6,0x31840000,0x08200000,0x210120e2,0x20e118c0,0x10401060,0x39a40820,0x41e31040,0x39c03141,0x52413160,0x73455242,0x6ae462a3,0x62a37345,0x6b025a61,0x52815a80,0x52806b43,0x630162e1,0x318073a3,0x73835280,0x52807362,0x5ac262e2,0x6b446b65,0x6b0583c8,0x7ba83980,0x5a835a82,0x7ba87386,0x41c062a2,0x6b234a20,0x52a141c0,0x5ac241e0,0x52a16b44,0x73866b44,
-0x6b236b24,0x31605ac2,0x73835240,0x5aa07362,0x73826b21,0x73827361,0x63206b20,0x73a273a2,0x73c273c2,0x630073a0,0x4a805280,0x42204200,0x4a604200,0x62e36303,0x52405aa2,0x4a005a81,0x52424a41,0x396041e1,0x396141c2,0x4a0141c3,0x31410000,0x4a415ac5,0x294039c0,0x52a23160,0x62c162c2,0x5a816b02,0x5a2251e2,0x52017325,0x5a6062a2,0x4a014200,0x31203960,0x4a0239a1,
-0x28e03940,0x31002080,0x49c13960,0x62826aa4,0x62805200,0x62405220,0x52216261,0x52235a63,0x31403120,0x39605243,0x41a149c1,0x520249c2,0x31003100,0x522241a0,0x49e13960,0x62626262,0x39405a43,0x5aa25aa2,0x6ae36b24,0x73247324,0x62a37b85,0x5a827345,0x7b865a81,0x62a26b04,0x62a36b04,0x62a341a0,0x41607326,0x6ac45a62,0x6ae541a0,0x6ac36ae4,0x5a405200,0x62e362c3,
-0x62e36303,0x49e049e0,0x4a2049e0,0x5a614200,0x62a262a2,0x62c341c0,0x62a362a3,0x732651e0,0x62a35221,0x5a826ae4,0x5a835aa3,0x4a004a21,0x39804a21,0x39623120,0x5a2251e1,0x51e16264,0x31004180,0x396030e0,0x51e25a64,0x62645a24,0x52026284,0x5a244181,0x5a645222,0x41c13160,0x5a626282,0x41804180,0x41605a63,0x41803940,0x41805222,0x39803960,0x41803940,0x41a141a1,
-0x00000820,0x00000000,0x08400000,0x10401880,0x10603164,0x108018a0,0x316218c0,0x18a039a3,0x6ae35265,0x4a222900,0x6b652901,0x4a2049e0,0x39803980,0x52807366,0x73846b42,0x63025260,0x6b0283e6,0x84074a60,0x84067bc5,0x7b8683e7,0x7ba67ba6,0x73667344,0x52616b25,0x73456b25,0x6b657366,0x42204200,0x63247ba7,0x6b435262,0x62e352a1,0x73876344,0x6b4673c7,0x39e06b63,
-0x83e85ac1,0x18c03160,0x528162e3,0x5aa05ae2,0x6b205ac0,0x5ae06300,0x73e352a0,0x4a405b00,0x52805280,0x6b824a80,0x6b607be2,0x5ac05b00,0x73a55b00,0x39805281,0x6ae25aa0,0x7b656ae2,0x4a205240,0x41a15263,0x41a262a6,0x39a03941,0x49e25265,0x39c03980,0x4a2039c0,0x41a12900,0x62a162a1,0x4a015220,0x83885202,0x5a226284,0x62a272e5,0x4a006ac3,0x31205a64,0x49e341a1,
-0x29003140,0x31002060,0x39404a01,0x730349e0,0x62a05240,0x7b416ac1,0x7b2572e2,0x62c462c3,0x5aa35a83,0x4a2041e0,0x39404a21,0x51e141a0,0x312049c1,0x39403100,0x5a417304,0x6a835a22,0x62c362a3,0x42005a82,0x7ba55260,0x6ac36b03,0x73258385,0x52405a41,0x39406ae3,0x62c24180,0x62c34a00,0x4a226b26,0x39803980,0x41c03980,0x6a846a84,0x6aa55a20,0x5a6049e0,0x39804a00,
-0x5ac26b03,0x5a8262e2,0x62c362c3,0x62a26ae3,0x62c262a2,0x62e25220,0x4a003980,0x62a46ae3,0x49e25221,0x41a15a64,0x29203120,0x314028c0,0x83a76b25,0x39806ac5,0x51e25a65,0x62635a02,0x52025a43,0x5a4549c0,0x49c14141,0x49c151e2,0x41805a43,0x41804160,0x62844180,0x628549c2,0x49c05221,0x5a6249e0,0x52223940,0x49e049c1,0x62a75a43,0x524249e1,0x4a015242,0x41a13100,
-0x08001060,0x10610000,0x10610000,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x62a23961,0x6b229429,0x5aa362e2,0x49c162c4,0x526149e1,0x734341e0,0x5aa06b22,0x7383ad4a,0x73837383,0x5b016b62,0x73a252a0,0x7ba44a40,0x52605280,0x7b857ba6,0x73847ba6,0x5a8041e0,0x63037bc7,0x31806304,0x52812940,0x7be67bc7,0x73a6ad4e,0x63423a00,0x422052a0,0x10604220,
-0x00200020,0x41e02940,0x39c02100,0x4a404a61,0x4a005aa0,0x4a6073a2,0x52c052c0,0x632052c0,0x52c052c0,0x52a052a0,0x4a6052c0,0x5ae05ae0,0x4a604a80,0x42204220,0x63215ac1,0x526052a0,0x62c26b21,0x41c15a83,0x41c241c3,0x4a433961,0x52235263,0x4a4241c1,0x420041e0,0x52415261,0x6b0349e0,0x49c041e0,0x49e062c3,0x6ac45a82,0x5a4262a4,0x5a815a21,0x5a6162a2,0x52643160,
-0x292041a1,0x28e049e1,0x49e33942,0x6ac33980,0x62806ae3,0x8bc67b43,0x730249c0,0x73446b02,0x5aa26b04,0x52613140,0x62a339a0,0x5a425242,0x31205222,0x49e04a00,0x73036ae3,0x732362c2,0x62c26ae3,0x6b036b04,0x6b035280,0x520041e0,0x8bc762a1,0x5a6141c0,0x31404a00,0x62c34a00,0x6ae35a82,0x6b054a21,0x5a8341c0,0x5a833160,0x5a425a22,0x730572e2,0x5a6062a1,0x4a004a00,
-0x73645aa1,0x62a26303,0x62c36ae3,0x62a25a82,0x73275a82,0x6ae56ae5,0x6b057b67,0x62a35200,0x31406ac4,0x49c23940,0x49e25203,0x20c01020,0x6ae53120,0x31203960,0x51e23980,0x5a024140,0x5a2262a4,0x49c251e1,0x41814181,0x41804181,0x49c16264,0x28803920,0x5a447307,0x49a13120,0x394049e1,0x628349e1,0x39403940,0x314041a0,0x522341c1,0x5a2262a4,0x52015201,0x49c26aa5,
-0x18c01080,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x734b1060,0x7b8683cb,0x62818bca,0x5a644180,0x6b043140,0x73456ae3,0x5ac13980,0x94477363,0x52625ac1,0x41e041e0,0x5ae06301,0x52c073c4,0x736583e7,0x7ba762c3,0x83e66b24,0x8c088c27,0x734583e8,0x73844a61,0x52a26304,0x5ac25aa3,0x39e0948a,0x41e00840,0x4a604220,0x39c25ac2,0x4a415ae2,
-0x6b4262c4,0x632452a3,0x52a06323,0x5aa031a0,0x52607363,0x52a062e1,0x7bc46b61,0x52e073c2,0x528052a1,0x5ae04a80,0x52c052a0,0x4a404a80,0x6b836b61,0x42206322,0x52a05ae3,0x73a46362,0x5aa16b40,0x526341a0,0x31203981,0x29203120,0x41a14200,0x4a425a64,0x42005ac3,0x62c449e1,0x398041c0,0x41a05240,0x49e26ac5,0x62a349c1,0x49e15a42,0x5a6462a4,0x62c462a4,0x39803160,
-0x5a833120,0x312041a1,0x5a643100,0x52213960,0x73027304,0x6ae07302,0x7b256aa1,0x7b667b65,0x52615281,0x5aa35a82,0x5a816b04,0x6ac57327,0x6ae372e5,0x73447b66,0x5a607323,0x62e16b42,0x62a17324,0x5aa26b24,0x734462e2,0x49e041e0,0x7b667306,0x62a27b45,0x6ac462c2,0x62a36ae4,0x6ae37345,0x6b045aa2,0x6b045261,0x52216b04,0x5a425a21,0x83667b43,0x6b037323,0x6b035a80,
-0x62e25aa2,0x6b0462e3,0x62e36b04,0x4a0041c0,0x522162a2,0x31205221,0x41a028e0,0x52224180,0x41806ae4,0x418128e0,0x62a53100,0x39603100,0x39403140,0x31213120,0x41804a01,0x51e16284,0x520249c0,0x49c14180,0x39203940,0x5a446265,0x41a15a43,0x39403960,0x628551e3,0x418049c0,0x418141a1,0x49e151e2,0x31005a24,0x41805201,0x41a05a43,0x49804980,0x5a2251e1,0x41605a23,
-0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x42060000,0x00000820,0x6ac80840,0x62a68bab,0x7b8b1000,0x49c041a0,0x5a426ae4,0x8c275200,0x6b225260,0x6b437341,0x73a36b41,0x63204a60,0x73e17c05,0x7c056362,0x63018406,0x5ae18c2a,0x7bc77ba6,0x7be673a4,0x84277384,0x73657386,0x73866323,0x20c041e0,0x4a217b4a,0x41e11880,0x5ae23180,0x5aa36324,0x63025ae3,
-0x62e262e4,0x73665aa3,0x52827386,0x4a006b45,0x63034a20,0x6b216302,0x5ae25aa0,0x52a05ac1,0x63415ae1,0x63206322,0x6b616b60,0x7ba46b61,0x6b425260,0x5ae152a0,0x52c04a60,0x52a052a0,0x5ac16b42,0x52614a40,0x52243961,0x52635244,0x5aa45aa4,0x522441c0,0x5a6362a5,0x5a825241,0x5a625a62,0x5a626b04,0x39605a42,0x524241c0,0x52225a83,0x7b486243,0x6ac46ac3,0x41c06283,
-0x5a633960,0x31003100,0x208028c0,0x28e030e0,0x49e051e0,0x7b256260,0x5aa07b24,0x4a005240,0x526241c0,0x62a362c3,0x6ae46ae4,0x73056b04,0x7b467325,0x73437304,0x6ae25240,0x4a006b02,0x5a827ba6,0x4a2041c0,0x4a005240,0x5a623980,0x73463120,0x5a6062a2,0x73245241,0x6ae46b04,0x6b046ae4,0x62e37365,0x62e37364,0x62e36b23,0x6ac462c2,0x73037b24,0x8be86ae2,0x62a17b64,
-0x394062c4,0x41a141a1,0x290062e5,0x41a020a0,0x396128e0,0x20c028e0,0x39611040,0x49c25202,0x49a06b28,0x31002900,0x294128e0,0x290120c0,0x08203162,0x39403983,0x5a643120,0x39805202,0x5a6341a0,0x5a6462a5,0x39603120,0x418249a1,0x41413940,0x5a242080,0x49e228e0,0x49a149c2,0x31203940,0x39403940,0x522251e2,0x52024181,0x62844180,0x49c041a0,0x49c13920,0x5a4349a1,
-0x00000000,0x00000000,0x18200000,0x08000800,0x08001881,0x20c11020,0x000028e1,0xacaf1040,0x49e06ac6,0x838a28e0,0x5a416ae3,0x49c08367,0x73646ac5,0x73456ae2,0x41e07b64,0x42205aa0,0x5b006343,0x5b206bc1,0x73c46ba2,0x52a052c2,0x73c673a4,0x5ac152c0,0x6b644200,0x42206b43,0x4a605280,0x630352a1,0x5aa35a82,0x52637347,0x4a0062e4,0x52a23180,0x5ac552c2,0x63044220,
-0x734541e0,0x420039e0,0x39c039c0,0x39e039c1,0x316031a0,0x6b426302,0x52c06b21,0x52814a60,0x42005280,0x42203180,0x5a6249e0,0x4a404a00,0x52804a40,0x5ac15ae1,0x4a6052a0,0x528052a0,0x63224a60,0x5aa15ae2,0x4a2141e0,0x4a0139a0,0x5a825a82,0x41c23960,0x41e15243,0x39603120,0x49e05222,0x5a625a82,0x52225222,0x5a436ac5,0x62a55a83,0x7b486a85,0x6ae55a41,0x520162c4,
-0x31205222,0x39803960,0x31003120,0x394041a0,0x7b236aa2,0x73047323,0x62e14a00,0x41c041e0,0x6b045aa2,0x5a6041c0,0x524049e0,0x4a005a82,0x62a262a3,0x62c15a81,0x5a6062e2,0x39a06b02,0x5ac27345,0x62e46b05,0x528162c3,0x39604a01,0x6b053120,0x4a005a62,0x5a617324,0x62a16ae2,0x62e25220,0x5a827345,0x7bc662e2,0x6b255ac1,0x62825241,0x62a07323,0x49c05a41,0x416049a0,
-0x73065223,0x104028c0,0x72e80840,0x39603120,0x20c041a2,0x31213101,0x31213141,0x41814181,0x51e27baa,0x31402920,0x20c028e0,0x188020c0,0x10401020,0x30e01880,0x20a03961,0x5a645a43,0x41c049e0,0x39605a43,0x416149e3,0x39204160,0x41815203,0x394051e3,0x41a14182,0x418151e3,0x416049e2,0x41804180,0x49c25a23,0x396028e0,0x39603940,0x5a4449c1,0x49c14181,0x416051e2,
-0x00000000,0x00000000,0x00000000,0x08000820,0x18801040,0x4a060800,0x4a261020,0x08003122,0x62a57309,0xad0f20a0,0x944b62a5,0x5a8162a3,0x5a838c09,0x6b277326,0x73436b04,0x42806b42,0x52e052c0,0x74027c03,0x6b6352a0,0x63425b01,0x63436342,0x5ae15ae1,0x4a403180,0x6b646323,0x39e05ac1,0x526141e0,0x73245a83,0x5a623160,0x29404a01,0x39e04241,0x62e46b45,0x62a462a4,
-0x7ba76ae5,0x294039e0,0x4a434200,0x42004202,0x4a4141e0,0x42204a40,0x5b015281,0x4a605ae1,0x4a405280,0x42204a40,0x39e039c0,0x5aa241e0,0x4a2041e0,0x39c05ac2,0x63225ac1,0x5ae14a80,0x42005ae1,0x31804220,0x6b216b03,0x4a606b03,0x52625ac1,0x396041e0,0x31203120,0x52233120,0x41e04a21,0x41a05221,0x52425a43,0x41c05222,0x41a141c0,0x628441a0,0x5a624180,0x62a35201,
-0x520262a3,0x49c15222,0x41804180,0x49c049c0,0x734562a2,0x4a005a82,0x5a824a20,0x5aa35aa3,0x52225a62,0x4a0062a2,0x6b0462c2,0x62a462e3,0x49e13120,0x62c349c2,0x5a8262c3,0x6b045aa2,0x62e462e3,0x62c462c3,0x52825a83,0x6b0531a0,0x62c45262,0x5aa34a01,0x62c35aa2,0x6b246b25,0x5a8162e3,0x5ae44220,0x6b042960,0x39605221,0x29203960,0x83863980,0x310049a0,0x49c328a0,
-0x31204181,0x4a055a84,0x31411860,0x31003140,0x39423140,0x20a028e0,0x28e028e0,0x49a249a2,0x52038bcb,0x28e03900,0x290028e0,0x20e018a0,0x00001061,0x49c31880,0x28c06ae7,0x314041c1,0x398041e1,0x49e262a5,0x41623120,0x416020a0,0x51e33920,0x39207b49,0x31203100,0x310020a0,0x39204161,0x41614181,0x418049a2,0x41603940,0x62835a63,0x52025a63,0x520349c2,0x52034181,
-0x00000000,0x08410000,0x18a210a1,0x00001860,0x29230000,0x000020a1,0x00000000,0x20a06b09,0x18204183,0x10605246,0x31400000,0x20e018a0,0x00000800,0x52860820,0x6ae37347,0x6b6283e6,0x5ae273c4,0x634273a3,0x3a0073c5,0x39e04aa0,0x5b224ac0,0x422073a4,0x42205280,0x5ae24a40,0x42007384,0x73455221,0x62e5946b,0x41e27b89,0x39e06b45,0x5ae45ae4,0x39a06b46,0x5a8420e0,
-0x4a004a21,0x5aa34a61,0x4a405282,0x5ae33181,0x4a604a40,0x422052a1,0x4a604220,0x5b005ae0,0x5ae15280,0x63225b01,0x52815ac2,0x4a202960,0x62c262e2,0x4a4062e2,0x5ae04200,0x4a606301,0x42205b02,0x318041e0,0x52804a21,0x4a8052a0,0x4a204a40,0x62e35240,0x41e041c0,0x4a223140,0x39805242,0x39405222,0x522349e2,0x41803940,0x5a6549c1,0x49c13960,0x520049c0,0x62a35a61,
-0x5a4249e0,0x52005a62,0x6ac362a3,0x6ac37324,0x6ac47324,0x4a213960,0x6ae46b05,0x41a062c4,0x52023120,0x52213140,0x4a214200,0x41a14a20,0x394049e3,0x41a06ae8,0x6ae46283,0x526362c3,0x292041c0,0x41c12900,0x210041e2,0x5aa53180,0x526362c6,0x41c15a84,0x39804a02,0x28e03960,0x41e15242,0x31802920,0x10605a85,0x292020c0,0x18801880,0x51e23940,0x31006ac5,0x31013921,
-0x39403121,0x5a875203,0x39412900,0x312149c4,0x290020a0,0x29004183,0x20a020a0,0x28c03101,0x5a4528e0,0x312051c3,0x20e03120,0x20e018a0,0x08000800,0x20801880,0x39813961,0x398128e0,0x31204a22,0x41c25245,0x20803120,0x51e330e0,0x30c04182,0x39205a25,0x41823941,0x39613100,0x394030e0,0x31003940,0x49a151e2,0x49c05202,0x31006ac5,0x41606283,0x49c24181,0x49a23100,
-0x00000000,0x00000000,0x00000020,0x21020841,0x00000000,0x10400000,0x20800800,0x08001000,0x20e01860,0x21000000,0x00200000,0x00200020,0x00000821,0x00000000,0x42020880,0x7ba62960,0x5a8262c3,0x5aa45243,0x7ba56b03,0x73644a20,0x42607383,0x6b426341,0x5ac16300,0x6b445280,0x6ae662e3,0x31404a20,0x00000000,0x00000000,0x39c031c0,0x4a6139e0,0x5aa42900,0x29203980,
-0x5ac45a63,0x5ac36325,0x4a0041c0,0x6b235261,0x5ac26b06,0x630252a0,0x63226342,0x632052c0,0x4a405ae0,0x424031a0,0x6b425ac1,0x52804a00,0x42204a60,0x4a005ac2,0x42604a00,0x63224260,0x5ac15ae2,0x39c04a00,0x52a02980,0x52a04a60,0x5ac252a0,0x5a8041e0,0x5a806ae2,0x49e041c0,0x5a815aa1,0x398139a0,0x314028e0,0x41a23961,0x41803120,0x62833960,0x5a426263,0x5a605a61,
-0x62825a60,0x49e05240,0x6b036ac2,0x83a66ae3,0x41c05240,0x62a45a63,0x312049c1,0x39403980,0x292020e0,0x29402100,0x5a824a22,0x5a6549e1,0x31205224,0x49c25204,0x28e05244,0x28e03140,0x312128e0,0x4a051860,0x31213142,0x31823962,0x20e01060,0x314120e0,0x18a02921,0x314120c0,0x292039a3,0x29413162,0x31213142,0x08001840,0x30e020c0,0x31003941,0x6aa45a22,0x31004160,
-0x10203902,0x20a11020,0x29001860,0x312120c0,0x31413121,0x28e04182,0x28e028e0,0x292220a1,0x6ae83102,0x28c041a2,0x20c028c0,0x00001840,0x00000000,0x39a11040,0x29005243,0x28c02900,0x312028e0,0x314028e0,0x28c128e1,0x49e328c0,0x310049c3,0x39603120,0x394141a2,0x39613961,0x394141a2,0x39403961,0x49c149c1,0x51e249a1,0x41a049e0,0x62825221,0x41a13940,0x49c349a2,
-0x00000000,0x00000000,0x20e31081,0x39e50000,0x00000000,0x00000000,0x39620000,0x31811000,0x188010a0,0x08205267,0x39842902,0x08200801,0x00002921,0x108118a3,0x082018c1,0x20c00000,0x39615224,0x52665224,0x5a825a63,0x73846b23,0x63017383,0x736352a0,0x73837ba4,0x6b626322,0x6aeb6b26,0x00010020,0x00000000,0x00000000,0x39e02980,0x4a414220,0x20a07346,0x41e15263,
-0x39c141c0,0x4a4139a0,0x4a0062e3,0x5ac34a20,0x4a615240,0x52a14200,0x52804a60,0x6b634220,0x4a606342,0x5aa16b42,0x6b205aa0,0x52805240,0x6b636341,0x73455280,0x31a062e2,0x5ae131c0,0x6b236302,0x4a607384,0x31c029a0,0x63025ae0,0x62e352a0,0x4a006303,0x62e35a82,0x73447323,0x4a206b23,0x20a02900,0x41c13140,0x31403980,0x396041c1,0x49c062c4,0x39405a62,0x6b026282,
-0x7b446ae1,0x62a07b43,0x7b636ae2,0x6b0383a6,0x5aa562c3,0x62e65263,0x10212921,0x28e00820,0x398320e0,0x39a11880,0x522341e0,0x39822900,0x418328c0,0x39624182,0x418241a3,0x49c43982,0x31013942,0x10401840,0x310128c0,0x31413142,0x18a02900,0x31414a04,0x188018a0,0x316318a0,0x316241a4,0x290020c0,0x31212900,0x312220c0,0x31211860,0x18602901,0x5a645a65,0x62636284,
-0x28e03940,0x28c020c1,0x20c028c0,0x20a02900,0x28e028e0,0x28e03121,0x208020a1,0x20c020e0,0x8bcc20a0,0x18405a65,0x49e449c3,0x10201000,0x18800800,0x20e01880,0x52635224,0x20c028e0,0x31413100,0x312128e0,0x28c03141,0x39413961,0x49e32080,0x41a328e0,0x28e03920,0x31003961,0x31203940,0x39413961,0x51e249e2,0x52024981,0x49c05202,0x52013120,0x5a435a42,0x49c249c2,
-0x102120c3,0x00000000,0x00000000,0x00000000,0x00000000,0x39840000,0x10203141,0x00001020,0x00000000,0x29232923,0x39843143,0x28e21880,0x31432903,0x41c50000,0x31440820,0x18600000,0x31405244,0x41e239a0,0x10200800,0x52432900,0x84051060,0x42006b21,0x52817bc5,0x10401020,0x00000800,0x00000800,0x00000000,0x31820000,0x4a4031c1,0x3a004a60,0x6b066b05,0x49e25222,
-0x29205242,0x316039c0,0x6b446b24,0x41e05aa2,0x41e041e1,0x4a4039e0,0x39c04a40,0x5ae139e0,0x5b0152a0,0x6b205aa0,0x5ac06301,0x52c05ac0,0x5b015ae0,0x62e36b63,0x63404a40,0x4a415ae0,0x4a404220,0x5b024a40,0x42214280,0x4a604200,0x4a203a00,0x524162e3,0x732541a0,0x62c162e2,0x6b045aa1,0x39a05261,0x41a04a02,0x52015a84,0x49c15222,0x52403940,0x62a25200,0x62816282,
-0x734362c0,0x7b847343,0x62c07322,0x6b027b43,0x42005a62,0x084018c0,0x00000000,0x29402123,0x21003160,0x39823180,0x394141c5,0x18803101,0x31012080,0x20a04183,0x396220a0,0x20a03121,0x20c041a3,0x20803101,0x396241a4,0x398228e0,0x20c020e0,0x292120c0,0x18a118a0,0x080020e1,0x10601040,0x20e03162,0x20c020c0,0x28c02900,0x18c020c0,0x18c03163,0x20802901,0x73059c4b,
-0x31004160,0x18602080,0x39413120,0x20a03982,0x28c03121,0x29003100,0x20a020a0,0x29212940,0x942d1020,0x20604a04,0x20a03100,0x08001840,0x106028c1,0x292020c0,0x41a33160,0x314241c2,0x29002080,0x398328e0,0x49e441a2,0x31003981,0x41a25204,0x49c349e4,0x41823941,0x39203120,0x186041a2,0x288028e0,0x51c13940,0x49a151c1,0x30e05203,0x49c13940,0x52015200,0x396051e2,
-0x00000820,0x00000000,0x00000000,0x00000020,0x00000000,0x10200020,0x08000000,0x082039a6,0x00000840,0x08200000,0x00000000,0x08200000,0x00200800,0x08200000,0x20c20820,0x08000000,0x104020e2,0x20c041a3,0x83ab5244,0x41c251e4,0x00012902,0x00000000,0x00000000,0x00000000,0x00000000,0x7bcd3185,0x082018c1,0x4a411080,0x39c039c0,0x62c36323,0x18805222,0x4a0041e1,
-0x6b0462e4,0x42005261,0x41e04a20,0x4a207ba6,0x4a4041e0,0x5aa252a3,0x52615ac3,0x63224a61,0x52606b22,0x63016b05,0x5ac06b62,0x52a052a0,0x52a052c0,0x5ac052c0,0x5ac052a0,0x4a4052a0,0x52a152c0,0x4a6052a0,0x63416320,0x528052a0,0x52604a60,0x41e041c0,0x4a204a00,0x41c03140,0x62e262a1,0x62a25a61,0x4a014a00,0x39605a63,0x28e03120,0x5a6262a4,0x62a162c2,0x62a15a80,
-0x6b005a80,0x7b647b64,0x39816ae2,0x396020a0,0x21003120,0x108020e1,0x106018c1,0x396039e3,0x39a03120,0x49e32920,0x31423140,0x080020e1,0x31222902,0x312128e1,0x31212900,0x28c13943,0x28e13142,0x10202080,0x30e028e0,0x39643101,0x396228e2,0x186020c0,0x18800820,0x29220820,0x29213162,0x28e13122,0x28c028c0,0x18a03101,0x21002921,0x292118a0,0x28c020a0,0x39203962,
-0x5a856aa4,0x080049e4,0x31411020,0x312020a0,0x394320a0,0x20802080,0x28e21840,0x186028e1,0x8c0d1000,0x30e05a86,0x31203121,0x41a23100,0x28c128e1,0x522420a0,0x49c32900,0x31003981,0x310030e0,0x31214182,0x41823120,0x39423100,0x41813961,0x416128e0,0x49c35a25,0x5a4451e4,0x18201840,0x30e04164,0x49e241a2,0x5a643960,0x31003961,0x312028a0,0x49c15a43,0x5a233960,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29210000,0x10800000,0x00000840,0x00000000,0x000020e2,0x00000020,0x00000000,0x00000000,0x08000000,0x08000000,0x1880734b,0x104028c0,0x52430800,0x49e36267,0x000062e8,0x00000000,0x00000000,0x00000000,0x210018a0,0x2941738a,0x20a02920,0x5aa15220,0x4a404200,0x5a827363,0x62c56b25,0x6b045242,
-0x83c77365,0x6b4262e3,0x52616301,0x73455aa3,0x630462e4,0x39c05263,0x42005282,0x5ae15ac2,0x62c35a81,0x5a8241a1,0x39a04201,0x5b0039e0,0x6b6252a0,0x6b625ae1,0x4a605b00,0x4a606321,0x52c04a60,0x5b006301,0x5ae052c0,0x6b424a60,0x6b235b01,0x5a806b22,0x4a404a20,0x5ac14a00,0x62c162c1,0x6ae25a81,0x5aa15a60,0x41a05a61,0x29203940,0x4a003140,0x62e25260,0x6ae262a1,
-0x62c15a40,0x5a606ae2,0x41c349e0,0x31202900,0x52453160,0x18a03982,0x10602921,0x49e239a0,0x4a013980,0x4a0349e2,0x20e13120,0x00000000,0x20a00820,0x18602901,0x39623121,0x20a028e0,0x20a03942,0x312228e1,0x39423982,0x28e04183,0x31211860,0x28e028e0,0x20e02900,0x188018a0,0x188018a0,0x28e13122,0x208028c0,0x18802080,0x39a318a0,0x314120c0,0x208020a0,0x290018a0,
-0x39614161,0x208118a0,0x31204183,0x312028c0,0x18801860,0x20a03101,0x28e028c1,0x28c12080,0x6ae91840,0x30e05a46,0x39413100,0x20c028e0,0x28c028e1,0x29005245,0x41a13160,0x49c43120,0x39625a45,0x39623100,0x30e020c0,0x41633941,0x418228e0,0x28e03120,0x28c04182,0x41412880,0x18201840,0x30e02060,0x520320a0,0x5a4549c2,0x310020a0,0x39613941,0x5a234181,0x392049e1,
-0x00000000,0x00000000,0x00000000,0x00000000,0x000018e3,0x10600000,0x316241e6,0x294241c4,0x294239c4,0x00000000,0x00000000,0x108218c2,0x00000000,0x00000000,0x00000000,0x00000000,0x18a00000,0x18810000,0x5aa720c0,0x08200800,0x10400000,0x08810000,0x00000000,0x18c00840,0x7bca5266,0x41e05a63,0x42224221,0x73644a40,0x73844a40,0x6b037386,0x08405242,0x732520e0,
-0x52607385,0x73437343,0x31225aa3,0x210062e6,0x42004a41,0x52a339a0,0x39c04a42,0x5ac24a41,0x5ae35ac2,0x524241c0,0x62e24a01,0x62e36b04,0x41e04a40,0x4a4039a0,0x6b437344,0x4a206b02,0x5ac15aa1,0x52605ac0,0x63215ae0,0x4a805280,0x62e152a0,0x73225280,0x62e15aa0,0x526062c0,0x6b0362e1,0x5aa24a00,0x5aa05220,0x5a625a82,0x52635222,0x41c041e0,0x4a4141c0,0x7b856ae3,
-0x4a005aa1,0x6ae362a2,0x49e15a82,0x5a836b05,0x41c16b05,0x52023960,0x62c33960,0x5a625a82,0x5a6362a3,0x522462c4,0x20c03962,0x188120a1,0x41a32902,0x41a43942,0x290041c4,0x31213121,0x28e13101,0x310120a0,0x28c03962,0x28e03121,0x102028c0,0x18401840,0x18a00820,0x18801060,0x290120c1,0x20a01040,0x28e02920,0x314228c0,0x184028e1,0x188020a0,0x186020c0,0x31421020,
-0x20c139a3,0x29011040,0x49e339a3,0x31003100,0x28e13140,0x10601860,0x28e03101,0x18401840,0x28e120a0,0x30c05a67,0x51e43942,0x206028c0,0x29211840,0x3160e6d9,0x41a23961,0x20a03960,0x39211860,0x31214182,0x312130e0,0x394220a0,0x312128e0,0x28c028e0,0x49a23900,0x49c351c4,0x30e13921,0x39422060,0x49e41000,0x312149a3,0x39620800,0x28c030e0,0x62a628e0,0x41a13980,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x31830000,0x106018a0,0x18c10800,0x10810000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0x08202100,0x10201880,0x314320c0,0x734c8c0e,0x000041c6,0x29221060,0x62c63182,0x63055ac5,0x39802100,0x41e05aa2,0x7ba46321,0x5aa17384,0x4a405280,0x4a6162e3,0x632662e3,0x41c06b06,
-0x73646b03,0x31605ac1,0x29224202,0x108020a2,0x4a222980,0x52834a41,0x41e041e0,0x52a14220,0x39a04220,0x5aa35261,0x42003980,0x526141c0,0x5a644a00,0x49c149e3,0x5a8241a0,0x20c04a01,0x52415223,0x62c25a81,0x5b016b62,0x52a05280,0x62c15ac1,0x62e162e1,0x62c06b22,0x6b225260,0x4a405aa1,0x41e041e0,0x524041c0,0x62a36b05,0x49e15a83,0x41c02900,0x41c041c0,0x4a005a61,
-0x39603980,0x5a825a61,0x398062a2,0x5a825a82,0x52423980,0x52234a01,0x62a35a62,0x62c262c3,0x62c462c3,0x18805aa4,0x41c341a3,0x39a44a05,0x310220c1,0x39434184,0x312149e5,0x396220a0,0x20a03101,0x28e11840,0x28e03941,0x31013121,0x28e11020,0x08001840,0x00000800,0x18811060,0x082020e1,0x20a11020,0x28e01880,0x20a02080,0x20a028c0,0x18401000,0x10001020,0x20a01000,
-0x18a01880,0x292120a1,0x49e341c2,0x28c04161,0x29021880,0x18601060,0x20a020a0,0x10202081,0x18401840,0x41625a47,0x28e028a0,0x100028c0,0x31401840,0x28e05225,0x31203120,0x10003100,0x28c020a0,0x31003100,0x39413962,0x310128c0,0x30e030e0,0x08002902,0x49c328c0,0x30c03100,0x41632060,0x310028a0,0x28c03101,0x18602060,0x49e53102,0x28a01820,0x49a341a3,0x31204181,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x18a020e0,0x18a01060,0x18a10820,0x31230000,0x080062e9,0x7b6862a6,0x73417323,0x5a608388,0x6b227ba4,0x7ba47383,0x52807363,0x5ac15260,0x31804a40,0x42016303,0x63034a40,0x6b644220,
-0x5ae26323,0x42205ae3,0x398141e0,0x528418c0,0x39c02100,0x52825aa3,0x4a4152a2,0x4a415ac3,0x4a6052a2,0x31605ae3,0x5aa241c0,0x4a015220,0x73266283,0x6ae65a42,0x5a626ae6,0x41815202,0x49e128c0,0x5a815260,0x5aa241e0,0x31805261,0x29004a22,0x4a405240,0x62c341e0,0x6b226b02,0x63026b22,0x41e05aa1,0x420039a0,0x41c05281,0x52424a21,0x39603961,0x31402900,0x62c362c2,
-0x522041c0,0x52414a00,0x39a04a40,0x6b244a21,0x5aa362e3,0x18e03960,0x62a23160,0x6ae462c3,0x62c462a2,0x41a262a6,0x5a6549e3,0x49a249e2,0x290128e1,0x31023122,0x18601020,0x20a02901,0x28e11860,0x31221860,0x39433963,0x20e03102,0x08001860,0x08000820,0x31020800,0x18801060,0x00000840,0x31021860,0x39641840,0x20802080,0x18802080,0x31011020,0x10401880,0x394228c0,
-0x208028e0,0x41a228c1,0x310128e0,0x28e03940,0x10602081,0x18801040,0x18c018a0,0x20801000,0x08001860,0x39015a87,0x392130e0,0x18205a05,0x52052880,0x52041000,0x41a24a04,0x290049c4,0x49c428e0,0x30e04183,0x41624142,0x392130e0,0x18a03121,0x18803141,0x184030e1,0x52054162,0x18202040,0x30e01800,0x28e03940,0x18203122,0x18001021,0x30e13922,0x41833101,0x312049c3,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400820,0x31621060,0x20a183ad,0xa4b18bee,0x83ab7b8d,0x5a6149e3,0x73615aa0,0x73627ba4,0x7ba77384,0x5a805aa0,0x63015280,0x52404a20,0x39a05aa2,0x39c05261,0x7be86b43,0x63048409,
-0x5aa35ac3,0x42006b64,0x42205a81,0x63044242,0x4a415aa3,0x5ae34220,0x6b445ac2,0x4a606324,0x5ac16303,0x39e05ac2,0x49e062a3,0x62c462a2,0x7b476283,0x5a635242,0x4a014180,0x7b685a43,0x41805225,0x4a204a00,0x5aa25240,0x39c04a21,0x314041c3,0x52425242,0x62c341e0,0x4a003160,0x62e24a40,0x5ac15280,0x524141c0,0x524241e0,0x39803980,0x39a03140,0x524220a0,0x5a615aa1,
-0x62a362a1,0x4a405a82,0x316041e0,0x62c241c0,0x4a205a81,0x29604a00,0x41a04a42,0x41e05240,0x6ae55221,0x41a25245,0x52244a03,0x49c34a02,0x20a028c0,0x20a02901,0x20c028e1,0x28e02080,0x18403121,0x28c020a0,0x29013122,0x18a020a0,0x20a218a0,0x00000800,0x20c01860,0x188020e1,0x08001860,0x31422901,0x28e128e0,0x10201020,0x31211000,0x28e02081,0x18601880,0x31203121,
-0x28c03961,0x396228e0,0x28a11860,0x392128e0,0x188028c1,0x08000800,0x08000800,0x20c01840,0x08001000,0x498362a7,0x28a06286,0x31003921,0x5a443920,0x28a020a0,0x18400800,0x49e43962,0x49c449a3,0x41623101,0x41624142,0x39213941,0x10601840,0x18a00000,0x20c01860,0x30e03101,0x49e53122,0x30e028e1,0x31211820,0x10002060,0x30e10000,0x310220a1,0x28e120c0,0x41824182,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08610000,0x29041041,0x000018c3,0x000018c3,0x00000000,0x00000000,0x08000000,0x18800820,0x736a5266,0x10400000,0x41e48bef,0x5a6462e4,0x83e562c2,0x6b467363,0x4a606321,0x6b634a60,0x526062e1,0x4a407ba3,0x39805a81,0x31e041c0,0x5b0339e0,0x6b227be7,0x41c041c0,
-0x5b0352c0,0x4a606303,0x7bc252a0,0x52c039c0,0x292052a0,0x4a005a83,0x424062e2,0x63235ae2,0x5ae35ae3,0x62c462c3,0x62a362a3,0x52226b04,0x41c049e0,0x5a6349e0,0x5a4149e0,0x52015201,0x62a341c0,0x4a204a40,0x52404a00,0x5a6241e0,0x5ae34a00,0x31804220,0x52a24221,0x4a2062e4,0x4a404a00,0x526062c2,0x4a004a00,0x62c341c0,0x39603160,0x39403120,0x41a05202,0x5a835aa2,
-0x62a26b04,0x62c25260,0x62c47365,0x62c25aa2,0x4a2041e0,0x5aa262e4,0x734641c0,0x6ae562a3,0x39606ae6,0x31402900,0x49c241a1,0x41a23120,0x28e120c0,0x20a01860,0x31221880,0x210020e0,0x18a020c0,0x290120c0,0x18802901,0x18801040,0x31022923,0x20a01860,0x312120a0,0x20e01880,0x21012922,0x392128e0,0x31203120,0x21003100,0x28e02100,0x10001860,0x10600000,0x20a028c0,
-0x418149c2,0x5a443960,0x208028c0,0x20803962,0x39a33921,0x082120e1,0x18a00800,0x28e03121,0x39423962,0x39607b4b,0x390149a2,0x5a245204,0x5a425a63,0x10405224,0x10001840,0x28a01840,0x49a330e0,0x41624182,0x31203941,0x30e049c5,0x100028a0,0x20a02080,0x08000800,0x208020c0,0x10202080,0x208020a0,0x28c11000,0x000020c1,0x08200000,0x39641060,0x210320e3,0x41a30800,
-0x00000000,0x00000000,0x00000000,0x00000000,0x10820000,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x08210800,0x00000000,0x00000000,0x08610000,0x00000000,0x20c30000,0x18803144,0x00000000,0x08400820,0x18802921,0x5aa562c8,0x73457b67,0x31606b45,0x5ac26b44,0x42005ac1,0x42007ba6,0x6b416b41,0x6b015260,0x63244200,0x5ac27386,0x734462e2,0x6b255241,
-0x6b6573a6,0x6b246b05,0x7b845280,0x7b669c89,0x5a806ae3,0x63035241,0x4a206b23,0x6b235260,0x5aa26303,0x732462a2,0x62c35a62,0x6ae65221,0x5a836ae4,0x732649c0,0x5a416283,0x5a6241a0,0x5a425221,0x5ac25261,0x62c35aa2,0x4a2141e0,0x4a404200,0x41e04200,0x42204a61,0x62c262e3,0x4a204a20,0x6b034a20,0x5a816ae2,0x41a04a20,0x394049e0,0x41603100,0x49c049a0,0x62a349e0,
-0x49e05a82,0x62e35aa2,0x62c35ac2,0x62c262c2,0x528062c2,0x52405a83,0x4a015aa2,0x62c44a00,0x396051e1,0x20801000,0x49c228c0,0x49e25223,0x20a02921,0x10200800,0x20a02080,0x18601040,0x18801060,0x18801880,0x106020c0,0x10401040,0x29011860,0x28c02900,0x28c020a0,0x29003141,0x290028e0,0x394028e0,0x418149c2,0x31603980,0x290141a1,0x10002901,0x41c41880,0x39403961,
-0x418128e0,0x520249e2,0x31002900,0x39613941,0x39624182,0x18603142,0x18801000,0x28e03121,0x10202080,0x4161a490,0x41623920,0x5a443941,0x49a16284,0x20c15203,0x10003122,0x28e01840,0x41624142,0x39212880,0x10203100,0x18403962,0x314349c5,0x208020c0,0x18802901,0x186020c0,0x310228e1,0x30e128c1,0x20801820,0x08201040,0x10400000,0x314320e2,0xce5818a2,0x7b4c49e8,
-0x31860841,0x00000000,0x00000000,0x18c30000,0x00000000,0x00000020,0x00200000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31240020,0x08000820,0x52881060,0x00001880,0x08200000,0x10401020,0x29411040,0x28e018c0,0x18c020a0,0x5261946c,0x31615262,0x6b441860,0x83e66b25,0x5aa26b23,0x6b056b25,0x62a26b03,0x62c262a0,0x944a20e0,
-0x73258c0b,0x49e06ac2,0x30e07342,0x20e15220,0x4a010020,0x6b046b03,0x6ae36b04,0x6b0362c2,0x49c05a61,0x39405a84,0x4a003980,0x312041a0,0x5a6341a0,0x5a843960,0x52215a83,0x52215a62,0x5a635202,0x524141c0,0x524241e0,0x396041e0,0x62e35aa2,0x4a606b44,0x5b015ae1,0x63035240,0x7b856b03,0x6ae27364,0x62e149e0,0x6ae15aa0,0x52406ae1,0x39604a00,0x62c25a62,0x396062c2,
-0x5a8141c0,0x62c25aa1,0x41e05aa1,0x5a815a81,0x5a815a61,0x4a0062e4,0x31606b04,0x5a634a00,0x396149e1,0x28e03100,0x41815245,0x28e049c1,0x310220a0,0x18600800,0x310120a0,0x18802100,0x20e120c0,0x20c020e0,0x18603142,0x20a10800,0x29011860,0x41a13961,0x41a13981,0x520241a1,0x49a15223,0x522349e2,0x52235a64,0x5a6262a3,0x52415a42,0x29004a21,0x392030e0,0x49e14181,
-0x41a141a1,0x41a049c2,0x5a633980,0x39613960,0x418249e2,0x30e028c0,0x49843942,0x31014183,0x310120a0,0x41818bcd,0x5a244161,0x41613100,0x30e13100,0x20c02080,0x20803121,0x28a01000,0x30e028a0,0x28c04142,0x28c03100,0x08001000,0x18a00800,0x29011880,0x18a02922,0x00001060,0x20a01020,0x28c028c1,0x28c11840,0x29043964,0x18a21881,0x20e21040,0x292441e7,0x9cb00000,
-0x00000000,0x00000000,0x00000000,0x08400000,0x39a60820,0x29453165,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21240000,0x00000000,0x18a10840,0x41831000,0x184028e0,0x00000820,0x00011880,0x18600000,0x41e12940,0x4a033120,0x31421080,0x29204a00,0x28e062a5,0x522128e0,0x41a149e1,0x940c6ae5,
-0x49a05241,0x10204141,0x39210000,0x08000800,0x41c13143,0x31203980,0x312062a6,0x5a4349e0,0x39605a64,0x49c13980,0x41803120,0x49e149e1,0x522049c0,0x5a4362a3,0x208049c1,0x39605a64,0x31203960,0x4a003120,0x4a014a21,0x49e05a81,0x39c041a0,0x4a214a40,0x5b014240,0x4a006b23,0x62e24a00,0x6b0362a1,0x52605280,0x62c07b83,0x73227342,0x62826ac2,0x62825a21,0x5a815a41,
-0x62a162c2,0x5a816302,0x4a005aa2,0x5aa25241,0x5a624a00,0x5a826283,0x5a825241,0x5a635241,0x41a23980,0x28e13141,0x28c028c1,0x312120c0,0x28c11840,0x10002081,0x314028e2,0x39613961,0x29002920,0x29003961,0x08003141,0x20800000,0x49c320a0,0x5a6441a2,0x52425a63,0x520151e1,0x6ac55a43,0x62a37304,0x6aa362a3,0x62a262a3,0x62a26ae4,0x52225a83,0x524241a0,0x5a645a64,
-0x49c15a63,0x52015a43,0x62635a42,0x41413940,0x49a34162,0x30e03100,0x49a34182,0x392230e0,0x392130e0,0x51e42040,0x5a444160,0x41606285,0x28e030e0,0x312128c0,0x28c028e0,0x20603101,0x28a028a0,0x392230e0,0x28c01840,0x18601840,0x10401000,0x292528e1,0x000018c3,0x00000000,0x630b2103,0x28c118a2,0x31022080,0x736eb513,0x83f0f7df,0x10007b50,0x734c4184,0x836d83ad,
-0x00000000,0x524841e6,0x6b0b2923,0x000039e6,0x00000000,0x00000000,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08000820,0x080028c0,0x104020a0,0x00000000,0x08214a05,0x20804a03,0x31223942,0x30e13122,0x41805224,0x41813940,0x5a444161,0x5a647b88,0x41a249e2,0x184020a0,
-0x08203942,0x18802923,0x08202080,0x41a42880,0x292020a0,0x39603100,0x310049c2,0x418149c0,0x4a013980,0x49e041c0,0x522041a0,0x41c062c2,0x5a625a61,0x396141a1,0x41813100,0x52035a44,0x52435203,0x52413960,0x39a04a01,0x4a2041e0,0x39e04a20,0x5ae15ac2,0x42204a60,0x4a004a20,0x4a2141e0,0x5a815240,0x6b0262e2,0x7b637b62,0x7b405a60,0x6ae17b41,0x6ac07322,0x62c162a0,
-0x6b036b03,0x5a815260,0x41c062c3,0x5ac25241,0x5a615261,0x5aa35a82,0x4a215262,0x62c45241,0x49e35221,0x31003121,0x28c03961,0x41a31861,0x28c11880,0x28c03942,0x314020c0,0x31403120,0x31602920,0x28e03121,0x10402900,0x31210800,0x31003960,0x62a549c2,0x6ae46ac5,0x62846ae5,0x41805a41,0x62826282,0x5a416262,0x5a816282,0x62a35a82,0x628462a4,0x5a645223,0x51e25a43,
-0x41605a22,0x52215202,0x41604180,0x49a249e1,0x418228c0,0x30e03941,0x51c449a3,0x41824182,0x49c349a3,0x5a243921,0x41814961,0x49a15a44,0x5a445a43,0x28c03940,0x5a4628c0,0x28e028c0,0x30c028c0,0x416330e0,0x31013922,0x18401820,0x28e11840,0x188320c1,0x8c5231a8,0x8454bdfa,0xb577a4d6,0x3123e71b,0x08201881,0xc5f84207,0x316673f1,0xacb38371,0x414383ad,0x6aea1860,
-0x28e328c2,0x4a076b4c,0x10200000,0x10610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x52240800,0x08200800,0x08000820,0x31023162,0x31221860,0x28c028c0,0x312028e0,0x52034161,0x396030e0,0x31404180,0x18603140,0x000028e0,0x730683a8,
-0x20803100,0x30c00800,0x10001860,0x18801000,0x394039a0,0x394051e2,0x31203121,0x28a01840,0x41a03981,0x49e062a3,0x7b655a63,0x62a2942b,0x5a637305,0x49e249c2,0x49c241a3,0x5a6541a2,0x5a645223,0x52435a63,0x4a205240,0x5ac25261,0x5aa162e2,0x52405240,0x52605ac2,0x41e05aa1,0x4a2141e1,0x41c05a81,0x4a205280,0x73017b61,0x7b827321,0x73216b00,0x6ae07321,0x6aa162a0,
-0x6b027343,0x5a615a81,0x52625a81,0x62e44a21,0x6ac45aa3,0x6ae45a82,0x4a0041c0,0x41a05242,0x52026ac4,0x396220a0,0x31013982,0x310128a0,0x49c44162,0x310030e0,0x41a13960,0x5a4349e1,0x520241c1,0x28e020a0,0x41a341a2,0x41a220c0,0x4a0241c1,0x5a844a03,0x6ac45a42,0x72e56282,0x5a4372e6,0x62a362a3,0x5a626283,0x5a825221,0x52415a63,0x52435222,0x49a041a0,0x5a435222,
-0x41a15a64,0x6aa551e2,0x5a425a24,0x41814180,0xffff3983,0x6aa841c5,0x49a428c0,0x41624122,0x39223922,0x6245a46e,0x49814120,0x5a235a24,0x5a236264,0x28c04181,0x51e43920,0x30e06246,0x51c44983,0x30e04161,0x49853122,0x39014183,0x18803101,0x08641841,0x734fffdf,0xffff4a0a,0xffbfa4f5,0x7b4d28e2,0x6b0e2062,0x435041c7,0xefbf00a6,0x1820a4f7,0x204051c6,0x838c4163,
-0x00000800,0x00000000,0x10a20841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x31223961,0x08206ae7,0x184028e2,0x6aa620a0,0x20604982,0x498051a1,0x100049a2,0x288030c1,0x51e34160,0x10401000,0x08003963,0x31201020,0x9c279c48,
-0x18401000,0x39222080,0x28a12060,0x20801820,0x30e04182,0x30e04161,0x20805204,0x49c33941,0x41c049c2,0x49c15242,0x62a141c1,0x62a462a3,0x49c049e0,0x52225a42,0x49c43941,0x628449e3,0x5a435a43,0x5a835a83,0x41a03980,0x62e341e0,0x62c35241,0x41c05a82,0x4a0041c0,0x4a004a00,0x41c05242,0x4a005242,0x49e04a40,0x6b026ac1,0x73235aa0,0x7b6383a5,0x73027b63,0x7b437302,
-0x62e17b64,0x52205a81,0x52415240,0x52425241,0x5a634a01,0x62a35a82,0x62835a82,0x5a826ae4,0x6b045220,0x52225240,0x20a03100,0x41813961,0x49c049e1,0x4a0149e1,0x5a635202,0x62835242,0x628362a3,0x49c13940,0x41815203,0x41413960,0x51e25a03,0x51c25a03,0x5a235a23,0x51e15a23,0x522249e0,0x5a225a42,0x49a15a22,0x52025202,0x49e449c3,0x418151e3,0x62655a45,0x5a444161,
-0x418459e4,0x6ac65a6a,0x628551e1,0x51c35a44,0xff9f51e7,0x8bae5a6a,0x30c15a06,0x4142b4d1,0x51c45a06,0x62865204,0x498138e0,0x62434140,0x49e05a43,0x62a55a63,0x418151e2,0x498241a1,0x49624962,0x6a864981,0x5205836c,0x496149a3,0x20603900,0xb63c20c2,0xf77fd6dd,0xcdf55a6a,0xff5cf75c,0xde39b4f3,0xad3428c3,0x10e67bb0,0xffff9d57,0x6b0bc5f9,0x5aeec5d6,0x31620801,
-0x08610000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18600000,0x18405223,0x6aa66286,0x39403100,0x41402080,0x52013940,0x49a059e1,0x180038e0,0x49c02040,0x18202060,0x390049e0,0x31004160,0x52230800,0x6ac68389,
-0x51e33920,0x51e21000,0x28c03940,0x39214162,0x30c051e2,0x49c34160,0x39414182,0x312041a2,0x62a449c0,0x5a2262a2,0x6ae45a63,0x52404a00,0x5a635220,0x5a636263,0x28c049c3,0x5a6341a1,0x41a05221,0x628341c0,0x62c55263,0x39605aa4,0x49e25242,0x41804a02,0x52033940,0x312049c1,0x52423980,0x52415241,0x39a05241,0x52624a21,0x52404a20,0x72e262a2,0x62607302,0x73237b64,
-0x62c25a80,0x5aa24a20,0x52624200,0x4a0041c0,0x62c35261,0x62a25a62,0x5a605a81,0x62c262c2,0x52605240,0x628162a1,0x49e049c0,0x49c05202,0x524251e0,0x52225a62,0x4a015a83,0x41c05242,0x520149e0,0x5a435a42,0x5a245a45,0x62445a25,0x5a0449a2,0x51e35a04,0xfffe8bce,0x49c33121,0x49c341a1,0x41a349e3,0x396049e3,0x41824160,0xd6fa3964,0x39624182,0x5a6649e3,0x28c03941,
-0x72ef6267,0x6284ff7f,0x836951a2,0x38e03941,0x9c922862,0xc5b741a7,0xb51430e4,0xa45020a2,0x39005162,0x624628c0,0x49a13060,0x5a236a66,0x624351e2,0x41405a02,0x41805223,0x498151e3,0x38e04162,0x39204140,0x41406245,0x416051a2,0x38e03920,0x198f2102,0xdefdef7f,0x528d7a4a,0x51e7ff7d,0xde396aeb,0x526b28e3,0x5a8affff,0xffff7bb0,0x5aaa3187,0xef7f9cf6,0xff9fffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10820000,0x102020e1,0x28c01000,0x28e05200,0x7b293940,0x51c23940,0x520151e2,0x414051a1,0x18203900,0x41812060,0x39204162,0x5a023120,0x41802860,0x10000800,0x28e0940c,
-0x5a443900,0x206049c3,0x310049c3,0x28c03942,0x5a0551e3,0x41615a25,0x49c21860,0x49c25203,0x62645223,0x49e05a44,0x524241c0,0x4a013980,0x5a6241a0,0x5a6472e5,0x52035204,0x5a6341a1,0x41a05a63,0x62a53960,0x398149e2,0x396220c0,0x418149a3,0x520249c2,0x522549c2,0x49e341a2,0x41a149e2,0x4a013980,0x41c03980,0x41e14a01,0x49e14a00,0x41a05201,0x6ae341c0,0x524141a0,
-0x6ae341c0,0x52415aa2,0x52415aa2,0x39a039a0,0x4a004a00,0x5a6441c0,0x62a362a4,0x62c25a61,0x62c262a1,0x62c262c2,0x62a162a1,0x52205a60,0x62a16ac3,0x5a625a81,0x5a625241,0x5a435222,0x62a45a64,0x62645a43,0x49a149c1,0x624449a2,0x62454161,0x498251c3,0x62a96ac8,0x6ac79450,0x6ae92901,0xffbbc5d7,0x94524a08,0x83ac1840,0xf79fffff,0x30e04966,0x734a41a3,0x62aa1000,
-0x41851860,0x7b2abd35,0x72c95a05,0x3965e6b9,0x9c923987,0x732d6b0c,0x9c71de39,0x6248d638,0x6ac930e3,0x5a2562a9,0x51c52020,0x51e34982,0x6a855a23,0x41406ac6,0x6a646a85,0x49816245,0x20803900,0x10006288,0x20604160,0x41405a05,0x39014982,0x8c7220c0,0xf79fdf5e,0x836ece18,0x0000de79,0xbd33838e,0xb5536b0a,0x72eb7b4a,0x1882a4d2,0x524b4a0a,0xb598a536,0x83cfbe19,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x31230000,0x5a024980,0x41a049a1,0x39205203,0x392049c1,0x31006aa5,0x39004120,0x49c14140,0x392028c0,0x52014181,0x39203900,0x5a436a86,0x41833102,0x10004183,
-0x49c22040,0x62663920,0x5a2651e4,0x6a886247,0x41827b29,0x396130c0,0x52024182,0x52236285,0x73076285,0x52033940,0x4a015243,0x524249e0,0x62635a63,0x41c15201,0x310041a2,0x49e14181,0x39403120,0x41813120,0x28c041a2,0x418249e3,0x28c030e0,0x41a24162,0x49c449c3,0x394149a3,0x39603961,0x39804a02,0x314041c1,0x41c13960,0x52023160,0x39803140,0x4a014a01,0x420141e1,
-0x5a834a20,0x62a362e4,0x39a05aa3,0x4a004a00,0x49e05241,0x41a041a0,0x4a2041c0,0x62a262e2,0x62a15a60,0x6ae26ae3,0x62824a00,0x6ac15a60,0x62c472e4,0x62a562a4,0x5a446285,0x52235a64,0x49e25224,0x51e249c3,0x52025a21,0x49a2bd50,0x51c351e2,0x49a251e4,0x418951e7,0x41e4ce19,0xa4b2ce16,0x4a2620c6,0x39ea5a6c,0x62aa5ac9,0xffde39e6,0x41217a8b,0x6aea4184,0x18a1736c,
-0xffff1884,0xb4d36a4b,0x49c74984,0x51e65a6a,0x62cb5a48,0xe6bb1041,0x838e28a3,0x30e22081,0x6b2d6aec,0x41427baf,0x624530a0,0x93ab6226,0x72e75a24,0x622472e7,0x59e25a03,0x416151c2,0x28e04961,0x7bac7bcd,0x20414102,0x412151e4,0x38e14162,0xc73c18c1,0xf7bfc6fd,0x51e649c9,0x52086aaa,0x28a37b6d,0x832c0800,0x72c95226,0xde99cdf6,0x83f3bdb9,0x41e9d69c,0x83f3ef7f,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x10200000,0x7b282900,0x5a235a23,0x390051e2,0x62644140,0x49a21840,0x72c71000,0x38e04121,0x41621000,0x10001820,0x28c02080,0x39404961,0x52024160,0x28e07b69,0x49e3836c,
-0x49c251e3,0x08003962,0x18201860,0x182038e1,0x20200800,0x39001820,0x52025203,0x62855a43,0x28a049e1,0x522349c2,0x52444a03,0x41a15244,0x49c25202,0x5a645a64,0x39625a25,0x41833921,0x39615203,0x31003961,0x30e04181,0x28c04162,0x31213941,0x418228e0,0x30e03962,0x30e03961,0x398149e3,0x398049e2,0x39a13981,0x41a149e2,0x396041c2,0x41a23940,0x522249e2,0x4a023160,
-0x52225222,0x41c062a5,0x5a635241,0x4a0041e1,0x5a835a83,0x5a835262,0x5a825a83,0x5a8362c4,0x52214a00,0x6ae45a41,0x62a262a3,0x6ae36ac2,0x6ac362a2,0x6ac56263,0x5a425201,0x49a25222,0x49a14180,0x416149c2,0x49c3b4f0,0x49a25a23,0x392151c2,0x38e23920,0x39648bac,0x942e9411,0xffdd7b67,0x8c0f7b6e,0xff5dde98,0x7bae5a27,0xf77fad58,0x41435a28,0xacf23922,0x7b8ea4b2,
-0xc5b76b2d,0xcdd9bd15,0x3904ff5e,0x41446aeb,0x51c928e4,0x8bd2a493,0x5a06622a,0x5a494985,0x5a0a7b8e,0x39026207,0x41844143,0xd5b541a6,0x41404961,0x72c77b07,0x624472c7,0x518351a2,0x202059e4,0xacf3ef3b,0x93ed7b2b,0x51a3b4f1,0x39213901,0x95363164,0xf7bf424d,0x3925f7bf,0xcdf97288,0x30e4f71b,0x72eaf6dc,0x49843101,0x9c2f5205,0x08017b6d,0x9cb6d6de,0xffbd83d2,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29015228,0x39602900,0x41603100,0x30e04140,0x39205a43,0x41a230e0,0x28a03942,0x62652040,0x5a033901,0x182030c0,0x49e42080,0x49e20800,0x392030c0,0x626551e2,0x41631020,0x31203923,
-0x30e13900,0x000020a0,0x5a460000,0x20604982,0x49841820,0x49c35a05,0x626449a1,0x5a245202,0x49a24160,0x41a249e3,0x49e349c3,0x5a4449c3,0x6ac65a44,0x39603120,0x41a25a66,0x41a128c0,0x39612080,0x49e341a2,0x52244181,0x49c349c3,0x310041a3,0x394141a3,0x392149e4,0x394228c0,0x28e03121,0x4a0341c2,0x39613960,0x41c241a1,0x41a249e3,0x39413940,0x49c15203,0x52434a02,
-0x520249c1,0x49e15244,0x5aa45222,0x5a635263,0x5a634a22,0x49e25243,0x52425a63,0x4a015a43,0x39613100,0x522249a0,0x628341a0,0x6ac462a3,0x52016283,0x49c151e2,0x52025223,0x626549e2,0x52035a24,0x51e45a24,0x416049a4,0x5a047b2a,0x59e54140,0xcd9349a1,0x49a551a5,0xcd922082,0xbd928388,0x28c383ae,0xcdf86acb,0x41e9a4b2,0xef5f73b1,0x30e349c8,0xb55430c0,0x524962cb,
-0xffffffde,0x524bacd4,0xcdf8d67b,0x39047b4e,0xcdb749a7,0xde1cffff,0xef3b6b0d,0x52291800,0xbd56ad75,0x0800e679,0x39435a26,0x5a488bae,0x59a16aa7,0x61e372e8,0x51e27aa6,0x518351a3,0xff7e48e2,0x396549a6,0x6acb3903,0x5183ffff,0x310028a0,0x951520e2,0xdf5f8413,0x3902f77d,0xad154962,0xeedbcdd5,0x30c24986,0x62aa28e1,0x31435a68,0x398649c5,0x9d387c32,0xbd36f7bf,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20c00000,0x20a03962,0x49612080,0x6a853900,0x49804160,0x286051e2,0x18606286,0x18601882,0x7b2b3922,0x392151e3,0x10001000,0x6ae83101,0x5a443920,0x39206265,0x418351e3,0x30c230e1,0x28a04184,
-0x41814982,0x41621820,0x28a04162,0x5a2551e4,0x18203922,0x51c228a0,0x51e26a85,0x39405a23,0x51e45204,0x49c34182,0x39004182,0x520449c3,0x5a656ae8,0x39605a65,0x29003120,0x312041a2,0x39613120,0x62874182,0x51e34141,0x39414182,0x41a349a3,0x49a33941,0x39423921,0x39213942,0x394128e0,0x41a23941,0x5a245204,0x394041a2,0x39613120,0x41a24182,0x52245224,0x41c141e2,
-0x52225222,0x49a151e2,0x520249c1,0x520249c2,0x52235202,0x39404181,0x49c249c2,0x28c041a1,0x290028e0,0x49e24182,0x52043120,0x41a13920,0x49c25223,0x418149a2,0x520341a1,0x51e351e2,0x49c25203,0x51e45a05,0x49a24162,0x62646aa6,0x49c34182,0x520451e4,0x3104a4b1,0x838aacd3,0x732a5223,0xffff9cb0,0x41e8b554,0xb5997bf3,0x4a4cad57,0x4943de3b,0x41a74122,0xdf1ece9c,
-0xf79f8c13,0xffbf73b1,0x6b0ee6bf,0x396651e9,0xdedc41a7,0xdedeffff,0x9433ff9f,0x00000001,0x522aadfa,0x38e16b0c,0x100072c9,0xffff10a2,0x6a43b510,0x516130e0,0x49618b6a,0x38e24961,0x94344a09,0x18427b0e,0x0002de58,0x4122dd74,0x30e130e1,0xdf1c2922,0xf7ffd69a,0x732d73af,0xbdbb520b,0x83aeef1b,0x30c27b6c,0x20a228a1,0x49e71881,0x52286b0b,0x3a4d31ea,0x39ef4a4f,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x49c40800,0x39411840,0x49a228e0,0x41603900,0x39004141,0x41424140,0x28e028e0,0x20410800,0x49c34184,0x28c06265,0x100041a2,0x184049a3,0x39205a24,0x49c349c2,0x31206266,0x208028a0,0x394249a4,
-0x51e43941,0x6aa74983,0x28a05204,0x51c44182,0x62464162,0x5a035204,0x49a15a23,0x5a445a23,0x392149c3,0x394149a2,0x39213941,0x392149a2,0x49c25a45,0x41813120,0x41822900,0x28e03982,0x31003100,0x41823940,0x41624161,0x5a2549c3,0x49c34983,0x41623941,0x31013921,0x39213942,0x39413962,0x41814162,0x28e03941,0x41a249a2,0x41a23120,0x41c249c3,0x49e23981,0x52245a45,
-0x418049e2,0x5a2451e3,0x49c15203,0x49c151e2,0x41a249a1,0x418149c3,0x310020a0,0x31214182,0x312220a0,0x41823121,0x5a2549e3,0x49a249a2,0x49825204,0x49a34181,0x5a246266,0x5a236265,0x49a25203,0x51e44182,0x49a349a3,0x6aa65204,0x520451e4,0x624651e4,0x9c70734a,0x08409431,0x4a2939c6,0xbdf79c8f,0x5acb9c91,0xf73f8c55,0x8c739494,0x38e3fffe,0x49e94143,0xadba426d,
-0xce7da57a,0xf79f7391,0xf73fad35,0x6b2eb559,0xe75f2126,0x7bf3524a,0x6b11c61c,0x63519474,0xf77fefff,0x4964bdb9,0x20614163,0xf75d2105,0x59c272ea,0x59a36aa7,0x51c26a66,0x310351a3,0x94168c32,0x730dcdf7,0x416730e3,0x4963cd13,0x20803901,0x73d22920,0x530b9cf4,0x734effdf,0x84536aed,0x5a8b8bf3,0x28c2b514,0xad1459e7,0xef1c5249,0xcdf73124,0xc67c9d35,0x9454ce1b,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08401040,0x08001040,0x00000820,0x00000000,0x00000000,0x00000000,0x30e20800,0x39001820,0x39204120,0x5a032880,0x394251e3,0x20600800,0x28c051e4,0x20c13102,0x10006288,0x41413101,0x39205203,0x20402060,0x392230e0,0x30e03920,0x5a673900,0x49835205,0x418228a0,0x31003920,
-0x51e44983,0x6a8728a0,0x6a674983,0x72c851a4,0x496349a3,0x414030e0,0x62653920,0x49826245,0x418249c3,0x416249a2,0x39615a44,0x39203961,0x52254181,0x49c249a3,0x39814181,0x39603140,0x394130e0,0x31003941,0x39213941,0x39404182,0x39613941,0x39223120,0x39223101,0x49a34163,0x416241a3,0x49e44182,0x49e34161,0x49c349c3,0x51e449c3,0x49e449e4,0x418241a3,0x52033120,
-0x52025202,0x418049c3,0x49c251e3,0x51e349c2,0x49e45203,0x41a249a3,0x39823982,0x39623942,0x28e13121,0x394130e1,0x5a4449c2,0x418249c2,0x49a34182,0x5a0451e3,0x5a246265,0x49e15a23,0x39205203,0x732941a3,0x730849c3,0x39635a46,0x6a86e6ba,0x310172e9,0x416438e0,0xd67bad55,0xad96c65c,0xffbfc617,0xe71deefe,0xbdbabdfa,0xd65c9cb6,0x4943ef3c,0x39864984,0xce3b9cd6,
-0xce9c3a0c,0xef1fb59b,0x528fbdd9,0x63318c75,0xa556a517,0xbddd5ace,0xff9f5a90,0x420cce3d,0xc5da83b2,0xc5558c13,0x39446289,0xff9f6b4e,0x8b6a7b70,0x9c706aa8,0x51a34120,0x39234942,0x8c0f8bf2,0xff9e5a48,0x6b5272cc,0x4102a473,0x20a03901,0x000028c1,0x7bb0b5b9,0x292518a1,0x10428c0f,0xffff7370,0x30e283ad,0xf77e6aca,0x00000800,0x31235a89,0x8bee6b0b,0x51e4a472,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08010000,0x00000000,0x20c34206,0x00000000,0x00000000,0x00000000,0x08200000,0x51c328e2,0x5a0428a0,0x392028a0,0x39004141,0x39413100,0x39024984,0x62863922,0x396341a4,0x41a33101,0x51e349e3,0x392151e4,0x392128c0,0x18003901,0x41623901,0x394130c0,0x28c049e3,0x49c428a0,0x288051e5,
-0x416228a0,0x5a055a05,0x30a049a3,0x28604122,0x62464963,0x5a0372e7,0x51e449a2,0x41625a25,0x41823900,0x39204182,0x418330e0,0x49a24182,0x41624180,0x39613941,0x396149c2,0x396141a2,0x39213100,0x39625a66,0x28e04162,0x20802080,0x28c020a0,0x20803101,0x31013942,0x49e43942,0x41a34182,0x49a349e4,0x418249c3,0x49c35204,0x41a34182,0x49a349a3,0x418241a3,0x41823120,
-0x41a249c2,0x418049a3,0x418149c3,0x49e349c3,0x41a33941,0x39614182,0x39623982,0x396228e0,0x312228e0,0x39422080,0x5a254162,0x49c349c3,0x41624141,0x392051e3,0x62446244,0x49c05203,0x392049c2,0x6ac749c3,0x52244182,0x5a055205,0x49c46226,0x732b5a67,0x20c0ce58,0xdebb6248,0xce5bd69b,0x7bf2e77f,0xc61aa4d5,0x9cd87bf2,0x8bd2f7bf,0x5163eefa,0x18614983,0x8c15398b,
-0xe71fd6be,0xc61cd6be,0x8c565ad2,0x84345acf,0x8c346b71,0x4a6cbdda,0xb599ef3f,0xef5fffbf,0xbd9ab5b9,0x5a6be67e,0x62aa9cb4,0xce5b1883,0xa494f75f,0xffde5165,0x49624141,0x18825a25,0x28e3524a,0x7b4b7b0d,0xd6bec5dc,0x30a05a29,0x20803922,0x18c42080,0x7390ffff,0xc617e6fb,0xc5b8732d,0x9c54ffff,0x838e7b2c,0x83ce28a2,0x6aeb1820,0x5a483124,0x8c314165,0x41a56b0f,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x00200000,0x082110a1,0x08000000,0x08010000,0x00000000,0x51c31000,0x5a0472c7,0x498251c3,0x30e051c3,0x31004161,0x28a05a46,0x28e02880,0x6a873962,0x416251c4,0x51c438e1,0x41213961,0x38e14142,0x5a266247,0x8bac7b4a,0x51e37b4a,0x51e46286,0x28803900,0x49633901,
-0x59e559e5,0x416330e0,0x51c54143,0x39214943,0x49a26247,0x49a24161,0x39624141,0x28e02060,0x312128e0,0x49a349c3,0x52035204,0x31003941,0x20a03120,0x396041c3,0x396141c3,0x39413120,0x4a043962,0x28c149a3,0x28e21860,0x100028c0,0x28e11000,0x20a03963,0x39433963,0x416128a0,0x49c44183,0x41a24182,0x312049c3,0x49a349c3,0x39623942,0x41a23141,0x396341c4,0x20c028c0,
-0x41623101,0x31003941,0x39403960,0x41a14181,0x39413121,0x312030e0,0x28c03942,0x29022901,0x39433943,0x39a53964,0x49a36265,0x51e37308,0x41824182,0x626451e3,0x52255a44,0x49e25204,0x41a06284,0x6b0a49c4,0x49c46289,0xc59449c4,0x5a446ae8,0x7bf17bae,0x83eede99,0x284082e8,0xd69cc61a,0xdf1ededd,0xa5598c54,0xb5bbad79,0x94d8ad99,0x6226b5b9,0x182151e4,0xc63b8453,
-0xbdfbef5f,0xce7dce7d,0xf7dfc65c,0x9d17df1f,0xef7f39ec,0xef7f31ca,0xff9fbd5a,0x7bb3ad3a,0xc63aa515,0x29ab4985,0xd65bde9e,0xad9928e4,0xcdb8ffdf,0x49617b0d,0x49a251a3,0xad154164,0xb535a4f4,0x5229b4d5,0xe75f420b,0x49e628c4,0x39624102,0x28c53922,0xf7dfd71f,0xde99de5d,0x41a483cd,0x83ce8c0e,0x732e4a08,0x10415a6b,0x7b4b7b6c,0x418428e2,0xb5553124,0x5a49acd5,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001062,0x00000000,0x00000000,0x21030821,0x000020e2,0x29230800,0x52463144,0x080020e1,0x49a10800,0x49823920,0x51a251c2,0x30c05a04,0x836ab4f1,0x51c4732a,0x28a03921,0x6a873101,0x30c02880,0x28604122,0x41211800,0x41434943,0x5a264983,0x62873942,0x28a028a0,0x49612080,0x41623920,0x30e05a25,
-0x20602040,0x49a43101,0x39204161,0x41634161,0x30e04142,0x52044141,0x49a349a2,0x186041a3,0x28a01840,0x41824183,0x39614182,0x310041a2,0x838b41a1,0x41a23982,0x39414182,0x31203961,0x41c441a3,0x28a03101,0x10011860,0x29012080,0x28e02900,0x31223142,0x28e120a0,0x28c028c0,0x396241a3,0x39213962,0x41633962,0x41c33121,0x31223961,0x41e54183,0x00003185,0x290139a5,
-0x28c028c0,0x31203101,0x39403120,0x28c03961,0x394130e0,0x6b4a20a0,0x8c50e6fc,0x10207bad,0x418449c5,0xb5536aca,0x520351e3,0x62656285,0x41614162,0x6aa449e1,0x8bcc6285,0x49e25a45,0x41a149c2,0x5a4641a2,0x49a36288,0xa492838b,0x52475a28,0xe75f7bf0,0x41e9ad57,0xbd2fa46e,0xdedd836d,0xce7cc63a,0xce9de73f,0xc65bc65c,0xad79ce9e,0x5a46ffff,0x416551e4,0xbe1ad6bd,
-0xdefff7bf,0xbdfbce7d,0xc65ddeff,0x6330c61c,0x94d773b2,0xad98ad99,0x8c1462f0,0xb57bef5f,0xd69c4a4b,0xf7ff4165,0xf6dc9494,0x4a6b51c7,0x8c336b6f,0x6206626d,0x41625162,0xd67d41a3,0x31266b0e,0xef1d730e,0xa537b558,0xcdf64a0a,0x31014103,0x28c33101,0xfffff79f,0x7b2cff3f,0x3164732b,0xffff28e2,0x94321882,0x10639cb4,0x396441a6,0x41a56aea,0x7bae732b,0x83ad1040,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31430800,0x49c420a0,0x28e120a0,0x390049e5,0x51c11000,0x49814160,0x51c33900,0x412149a3,0x394351c5,0x39215a46,0x38e138e0,0x28a059e5,0x41424983,0x5a054122,0x6a882080,0x08002020,0x41623921,0x206028a0,0x52023101,0x5a234160,0x18004181,0x39004141,
-0x28c22080,0x31014142,0x396351e5,0x49a449e5,0x38e14162,0x39412860,0x39424182,0x28e03921,0x41623101,0x41a149c5,0x396149a2,0x39403961,0x7b4a6ae8,0x396241c3,0x394249e5,0x28a03922,0x41833983,0x28c13962,0x18601020,0x18403120,0x28e12081,0x312228e1,0x20a028c1,0x31014185,0x31213921,0x41633922,0x39033103,0x18611840,0xe79f41e7,0xd6dcf7df,0xc65ca557,0x5a897c11,
-0x20e120e1,0x394230e1,0x39403941,0x49a34181,0x62663960,0x41a05a45,0x9c4d8bec,0x4a267b8b,0x39235206,0x5a895207,0x628451e3,0x49826264,0x41434182,0x6a84838b,0x5a466285,0x49e27308,0x49c249c3,0x49a249c1,0x6ac84982,0x398349a3,0x49449c70,0xd6792081,0xdedcce9c,0xeebdf79f,0x39244145,0xb5d9df1e,0xbe1abdfb,0xce7ed6bd,0xd63dc65b,0x3126b5bb,0x418451c4,0xd69ece7d,
-0xdebee71f,0xc65cd69d,0xc63cce9d,0xbdfbb5ba,0xce5e94d6,0xbdfb7c14,0xb5bba517,0xa4f59477,0xd6bda517,0x94771000,0xad179435,0x20c4ff9f,0x84d4d69c,0x7287f79f,0x41425163,0x5ace2904,0x83d2bdd9,0x6b4f8bf2,0x9cb31001,0xff7c20c7,0x20a04102,0x310228e0,0x73515af0,0x18a1d619,0x290420a2,0x5249b555,0xb55620e5,0x39ca8c11,0x5249ad36,0xcdb541a5,0x7b8c5226,0x184062c9,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00010820,0x00000000,0x41830800,0x39421000,0x29223921,0x51e34182,0x39004982,0x41414982,0x30c051e2,0x41224162,0x41623921,0x30e051a3,0x416151a4,0x49836a67,0x62265a05,0x39014122,0x51a430c0,0xac706245,0x30c01000,0x49c35204,0x49825a45,0x392049a2,0x39205a04,0x180049a3,
-0x28a020a0,0x20a05a47,0x49c428c0,0x28c13962,0x20603942,0x418328a0,0x394328c0,0x39413963,0x49a44183,0x5a465205,0x418362a7,0x49e53982,0x418249c3,0x398249e4,0x28c05246,0x104028e1,0x39623142,0x41a341a4,0x39633142,0x396339a4,0x39433963,0x20a028e1,0x19240820,0xa557738f,0xffff5266,0xdebae71c,0xc5f8a4f4,0xb5f74208,0xf79f7bd1,0xe75ec5f9,0xa556ef5e,0x4aab6370,
-0x7bad6b0b,0x20a07b8d,0x31203982,0x49c35205,0x49c241a3,0x41a349a3,0x49e262a8,0x4184838b,0x390251e5,0x39629c2f,0x49c25204,0x51e351e3,0x39004162,0xde755a65,0x6ac67308,0x41a15203,0x49c24180,0x41a25204,0x310041a2,0x520551e5,0x7bcc49c5,0xce1862a6,0xd6bcd69c,0xffbf8c35,0x732d3968,0x6a6a38c3,0xb5b9eefd,0xc65cd67d,0xbdfbbe1c,0x7b6e9d17,0x39434143,0xbe5a94b7,
-0xcebeef9f,0xbe1bc65c,0xce9ece7d,0xc63dce7e,0xd6bebe3c,0xdf1dce7e,0xdeffefbd,0x62f1f75f,0xcdfbb59a,0x9cf830e4,0x520f7b93,0x30c3ef5f,0xffff20a7,0x8b4aa495,0x41454123,0xad796372,0xe6ff528d,0xa4f60824,0xb5773127,0xbd558c13,0x30e140e1,0x39232080,0x94b31066,0xc5d9ef1f,0x2923ef1a,0x29458c10,0x5aed1063,0x00005acc,0xd63b0842,0xc5d641a6,0x940fbd75,0x9c501020,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001082,0x108018a1,0x62c820c1,0x49c220a0,0x51e451e4,0x940d6aa7,0x51e351e4,0x51c36225,0x392051c3,0x51a330a1,0x20403920,0x414251e4,0x41212860,0x28a030e0,0x59e54143,0x39003901,0x498238e0,0x30a04142,0x49a34982,0x49a35a45,0x5a464983,0x49615a05,0x20603920,0x392051c2,0x51c34981,
-0x51e43941,0x18602080,0x49a34183,0x39221000,0x28a03942,0x20803922,0x31213101,0x39643963,0x49e53942,0x5a4649a3,0x31415225,0x310128e0,0x4a0351e3,0x31413942,0x39633962,0x39633983,0x312141a3,0x314241a4,0x39a43142,0x28e12922,0x39433142,0x3a053102,0xf7ff4146,0xd6169c0d,0xd596e638,0xd67ace59,0xbdb8ce1a,0xef5ed67b,0xdedce73d,0xd65ace5a,0xf77fef1e,0xb5bace9b,
-0x29a929e7,0x21034209,0x310020e2,0x51e46ae9,0x51e54182,0x62c749a5,0x5a8849e7,0x49c249c4,0x41615a24,0x5a255204,0x5a2462a7,0x49c26265,0x49624142,0x7b486266,0x41818bca,0x39605203,0x49c23960,0x41825a45,0x41825204,0x41a56288,0x39038bee,0x4143738c,0xc65b9c94,0x8c54e71f,0x7bb1e73f,0x8c11736f,0x39883926,0xbe1affff,0xbddbce9d,0x524ace9d,0x39634984,0xc69b422d,
-0xd6debe3d,0xce9dce9d,0xc65dd6be,0xbdfac63d,0xad9ee73f,0x214bc67e,0x94f98475,0xffffe75f,0xbd98a53b,0x5b7428c6,0xadb9d71f,0x3084c5fb,0x4a6b0025,0x41026acb,0x39853922,0xb5b96b74,0x739183f3,0x6b0f7370,0x62aeb517,0xa4f7ffff,0x28a049a4,0x49a53101,0xd71e0003,0x4a4d0865,0x736e5a8b,0x528a41e7,0x84131084,0xa472ffff,0xce5b0001,0x41ea630e,0x31451042,0x9cb2d659,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200820,0x08000000,0x08200000,0x08200000,0x49a21040,0x5a2449a2,0x7ae851a3,0x498128a0,0x72c75a03,0x838b51c3,0x520551a3,0x62044162,0x28801000,0x51c55a26,0x49a34962,0x624672c8,0x498230a0,0x49635a04,0x39016246,0x41416246,0x49824142,0x5a254182,0x416251e3,0x390028a0,0x41a049a1,0x5a055203,0x41623921,
-0x30e051c4,0x41842080,0x20602060,0x28a03102,0x5a461000,0x312120c0,0x49a43983,0x51e549c5,0x41a35205,0x394149c3,0x31204182,0x39823982,0x39423141,0x29004183,0x39423982,0x39425205,0x41833101,0x31013121,0x29213142,0x39433162,0x39233943,0xad3318a0,0xd69aeefc,0x83adce18,0x4986ff9e,0xff7f9c73,0x9cb4bdf9,0xe6dcde7b,0xd65bde9d,0xdefdce3a,0xe73ef79f,0xe71fe75e,
-0xb5f9d6fd,0x31c8df9f,0x39424a27,0x418341c4,0x39a549c4,0x312462ca,0xb577a4b3,0x5203730c,0x49c33920,0x51e351e4,0x41616ac7,0x6287838b,0x30e03121,0x39641040,0x62436286,0x41a0838a,0x418049c1,0x49c249c2,0x41a251e3,0xe6f9ffdd,0x6b2b9cb1,0x3965736c,0xffdf0000,0xdefe8c12,0x83f220c7,0x3948e6be,0xbdd91863,0x292773d3,0xd67eb5fb,0x734dce7d,0x41644142,0xce7e0803,
-0xceddd67f,0xce9dd69f,0xa57bc67d,0xbe1dad9b,0xb59fc65e,0xd6de8cb5,0x39ed8cb6,0xc63f7c13,0xde3dce3d,0x63521908,0x7c34ce9e,0x2084ce7b,0xd6ddefff,0x18607b4c,0x29253902,0xd6bcbe7e,0x73717bf2,0x9cb5ad3a,0x526d4167,0x426d20e6,0x28e02040,0x28c041a4,0x741310c3,0x8c543969,0xb59994d5,0x8c5320c3,0x5b2e1884,0x6ac85a8b,0x42097b6f,0xad574a2a,0x318820c6,0x5a8abdd8,
-0x10400000,0x08001861,0x00000000,0x08000820,0x39653165,0x00001020,0x49e50000,0x39853963,0x734a7b4b,0x62054162,0x41412860,0x6a8551e2,0x62666aa6,0x62265a25,0x9c4e6aa7,0x496251c4,0x49c430e0,0x08005205,0x08002080,0x38e05a04,0x624649a4,0x416272a7,0x5a0551c3,0x51e451e5,0x28804962,0x59e451c4,0x418249a3,0x30e14983,0x31012060,0x10005224,0x41622060,0x414228a0,
-0x30e130e1,0x10004163,0x18403122,0x20803943,0x31424183,0x4a053101,0x51e541a3,0x49c449a4,0x396149a4,0x41833963,0x31223942,0x31213101,0x31213942,0x29013141,0x39832901,0x39633942,0x39423942,0x31223101,0x41c53123,0x31432922,0x41c63984,0x838c730b,0xdebac554,0x49e6a470,0xffbeb4d3,0xbdb8e6dc,0xce3b9cd5,0xd65bbd78,0xce1aef5e,0xe6fdc5f9,0xe6fdef7f,0xf7bf94b4,
-0xc5fac5f9,0xce7cce7d,0x41842967,0x51e65227,0x52286aa9,0x9c529c72,0x18a58bf1,0x522441c6,0x49c24982,0x49a13960,0x5a2449c2,0xbd527309,0x28a03921,0xce196aeb,0x522583ae,0x41a262a7,0x39613961,0x520549c4,0x49e45205,0x9c9141a3,0x83ae9453,0x41a6bd95,0xef5f7390,0xe6be524d,0x9cf69473,0x00027bb1,0x73904a2a,0xb61bbdfc,0xd69c10a5,0xffffc63e,0x416449a4,0xad7a1884,
-0xc67cce3d,0xb5dcc61d,0xc65dc63e,0xc67cc63d,0xb5bbad9a,0xbe3cd6df,0xb5dbbdfc,0x296dc63b,0xb494bdf9,0xd71f7d1a,0x8cb7be1c,0x20a6ce7d,0xbdb9e79f,0x30c2b4d3,0x29254963,0xacf5f7df,0xcdfbb559,0x628c9c74,0xc63bb557,0xc63abdfb,0x30a159c6,0x20a028e1,0x210628e2,0x7b90bdd9,0xbdfcef5e,0x216a424d,0xceddefbf,0x734e2106,0xa4932903,0x5a8abd76,0x29067b4f,0x4166bd57,
-0x292562ec,0x28c2628a,0x18406288,0x10201000,0x00000801,0x5226be15,0x31443984,0x08002923,0x52066288,0x496259c4,0x59e149c1,0x9bea6a64,0x6a888327,0x49814140,0x49a04161,0x41605a03,0x51a33920,0x39420800,0x62657ae9,0x72e86a86,0x51c351c5,0x30c051e3,0x51c36246,0x41624962,0x49844162,0x41413921,0x30e04161,0x39224142,0x08001800,0x20802060,0x10203922,0x30811800,
-0x100030c1,0x28801800,0x49a428a0,0x208030e1,0x39842040,0x39631080,0x51e53963,0x41635a05,0x41634163,0x394249e5,0x39423101,0x31423963,0x39423962,0x39443102,0x39633922,0x41843943,0x39a43163,0x00002103,0xce389491,0x7b8e62eb,0x8bcf736d,0x7b0b49c7,0x30a2e638,0x51e78b8d,0xcd9693ef,0xf77fef1f,0xdeded67c,0xd67c8c33,0xc5f9eedd,0xd67cdebc,0xd6dde71e,0xbe3ac67b,
-0xef3e8bd3,0xc63bdede,0x4a24c63a,0x49c64a27,0x6aea49a6,0xcdb8732c,0x94525a4a,0x52256b0b,0x52023961,0x314049e1,0x5a6641c0,0x51c46ac6,0x28c03942,0x62aba4cf,0x5a8962cb,0x5247944f,0x49c362a7,0x49c441a3,0x5a2583ad,0x39a53101,0x62ec31c8,0x396362ea,0x9d178c55,0x10e8c65c,0x9cb618c6,0x6b4d9c96,0x18a6b537,0x9cf8deff,0x3a0cce7e,0x5aef9cf7,0x414351e5,0xd6be20c4,
-0xbe7c422f,0xc65dce3f,0xc65dc67d,0xbe3cb5fb,0xb5dbbe3b,0xce9f6b72,0xc65dc65d,0x73b4b5dc,0x4167bedf,0xa559e7bf,0xa559ad9a,0x4168c63b,0xd63cd73d,0x49842882,0x192630c0,0x19ab6415,0x31aa3a0c,0x6aed0022,0xbdb7d63a,0xbcd6c63a,0x392372ea,0x206030e1,0x630b3143,0x4a4b4a49,0x747632f0,0xd6deb5fb,0x6b70bd99,0x6370f7bf,0x49865229,0xc5952883,0x18621041,0x730b5a2a,
-0x00000000,0x31020800,0xa4b07b4b,0x41a328c0,0x51e54a45,0x394220c0,0x080049e3,0x39011000,0x51e51800,0x51c12020,0x72c58368,0x6a857ae6,0x72e97b07,0x5a245a25,0x39405a04,0x49a15a04,0x62454161,0x836a5a66,0x49a27b08,0x39406ac4,0x416172c6,0x5a2651e3,0x51c44181,0x498351a3,0x49834982,0x30c04983,0x626630e0,0x100049a4,0x08001800,0x20a03941,0x28e12060,0x38e13902,
-0x28a03922,0x28a051c4,0x28c11820,0x312230e1,0x524828c1,0x2840d617,0x49c52080,0x49a551e5,0x41833982,0x312341c5,0x20a13143,0x39843984,0x39434a46,0x730b6288,0x310249a4,0x49e5838c,0x8bcef73c,0x62ead658,0xacf39451,0xbd777b8e,0xacf46b2d,0xe67a5a6a,0x9c51b4f3,0x732d20a3,0xb4d41862,0xeefe730e,0xdeded67c,0xad57bdda,0xc5f99453,0xa4d59c94,0xce9cd6bc,0xdf3fdedd,
-0x49ebbe3b,0xad58e73e,0x5267dede,0x6b0b5248,0x39a56289,0x6a8b6aec,0x29055a6a,0x5a469471,0x52223961,0x49e141a0,0x520441a0,0x51e449c2,0x30e13921,0x28e420a1,0x398541a6,0x83ae62ca,0x41c583cd,0x52273964,0x41a46aca,0xbdd63122,0x7bd2ce5b,0x396783d1,0xad998c34,0xb5fb31ca,0x2128c61c,0x4a4c0002,0xce5c8bf3,0xc63c52cf,0xc63cb5db,0xbdfbef7f,0x41645a47,0xc5fa2905,
-0xc67f2969,0xc63cce9a,0xc65dc65d,0xce7dbe1c,0x190bc65d,0xc65cce9f,0xbe1cbe1c,0x94d8b5fb,0x21074acf,0xc63d8d19,0xbe3db5db,0x28c4d6bd,0xc57794b5,0x30e238a2,0x08613922,0xbe1bce7c,0x422c8c75,0xb5db7c13,0x7bf25b10,0x5a2b622b,0x30e23922,0x310230e1,0x08423964,0x08630821,0x9d37d6fe,0xb5b9b5b9,0x4a6c1065,0x8c34ef7f,0x3906b517,0x49e76acc,0x20c220a2,0x18403925,
-0x628620c0,0x49c49c90,0x4a250800,0x1840940d,0x08400000,0x18210001,0x62662080,0x518349e3,0x284038e0,0x8b694980,0x72c593ea,0x7ae66a85,0x8b8b6a84,0x41226a67,0x51c259e4,0x49a138e0,0x624572c6,0x4160acce,0x62437b07,0x49817b27,0x49614161,0x310049a2,0x49a372c9,0x49835a05,0x5a054982,0x288030c1,0x51e528a0,0x39203940,0x38c04983,0x312120a0,0x184030e1,0x410128a0,
-0x31011820,0x30e12080,0x20a028c0,0x31634182,0x7cb239a4,0xff9ddf1c,0x3964738d,0x5a685227,0x8bf03166,0x7baf6b0c,0xdeba5269,0x736ede9a,0x7b6d8430,0x6aa97b4c,0x31225206,0x522662a8,0x52046aa7,0x5a0693cd,0x8baf730c,0x9c9472cb,0xce398bf1,0x9cb4526a,0x9cd48c31,0xad587bd1,0x9c733166,0xeefd832d,0xc5fac5fa,0x9cb5ad58,0x8c125a4b,0xc5d9ef3e,0xc63adebd,0xd69cc5d9,
-0xcedfb5da,0x9c946ad1,0x83af4a28,0x62cb5229,0x62ea5aaa,0x41674a08,0x8c315229,0x522662ab,0x49e241a2,0x41a05222,0x520441a0,0x51e55a44,0x39633901,0x9c525a6a,0x28e25a6a,0xcdf78c10,0x83cf2103,0x31243925,0x3164a4d1,0x734dd678,0xbdf97bf2,0x2907e71e,0x9d179cd7,0xbe3b422d,0x73d3b5fc,0x422e9d36,0xa4f762f0,0x9d17ad9a,0xce7cad99,0xbe1b6314,0x39444a06,0x630e28e3,
-0xbe7c0888,0xbe1cc5fe,0xc65dbe3c,0xad79be3c,0xb5dba53b,0xbe1ebe1d,0xc65dadbb,0xb5dbc65c,0x00a7d67e,0xb5fcb69e,0xbe1db5bb,0x28c3b5b9,0x82ec4a49,0x31034902,0x20a038e1,0xbe5c0822,0x9cf87bf3,0xdebf8c57,0x52af6b51,0x10a5df3d,0x38e2942e,0x28a02080,0x420a3143,0x39c94a2a,0x8cd79d58,0xb5dabe7f,0x9473c5fb,0x49c6bdb8,0x49e83945,0xa4f36b0e,0x31433164,0x28e23122,
-0x08001820,0x41421840,0x208062a8,0x20a00800,0x184049a3,0x41826aa8,0x41614182,0x49824981,0x51a030c0,0x83276a83,0x83268b47,0x7ae68326,0x7b088328,0x496230a0,0x49a151c3,0x10004981,0x5a453100,0x4182838a,0x52044981,0x49a36ae9,0x41614120,0x30c04141,0x416151e3,0x498251e4,0x38e159e4,0x39431840,0x41634984,0x28c03100,0x49a328a0,0x204028a0,0x28a01800,0x392128c0,
-0x310128c0,0x41a43942,0x394230e1,0x21033102,0xce7b8431,0xde59c619,0x83ceac51,0x6b0b9c91,0xb57641c7,0x62cbbdb6,0xd639c69b,0xdebb1063,0x5a4983ce,0x52076acb,0xa491940f,0x49a45a26,0x52064183,0x62899c50,0x94106269,0xb5566aab,0xd67bd67a,0x9c93736f,0x5aab83f0,0xffffc619,0x834e83d0,0xc5996acd,0xe71f83f3,0x83d09494,0x838f8b6f,0x3108eede,0x8413b558,0xce5cb5b9,
-0xd67d9496,0xd69ec63d,0xef3d52ce,0x5a8a9c73,0x41a639a6,0x5a8a49e7,0x83d141e8,0x18618c52,0x4a015a44,0x41a05223,0x49c26285,0x49e449e3,0x31023942,0x6b2c9c94,0x8c3039a6,0x7b8f41e5,0x9c9220a2,0x62ed4a08,0x29233164,0x73907b8d,0xb5ba6371,0x20c59474,0x94d7a4f8,0x9d1939cc,0xb5dbb5da,0x5ad094d5,0xa5188435,0x52af5290,0xa5386b52,0x9cf79cb8,0x28c26aca,0x29472925,
-0x31abce9f,0xdf1fb5db,0x6b93ad9b,0xb5fca55a,0xadbbbe3d,0xbe5c73f6,0xb5fdbe3d,0xc67db63c,0x63b3f79e,0xc65dc69e,0xb5dbbe3d,0x3904be3b,0x392341a6,0x20a149a5,0x31243943,0xc63c20a2,0x8436ad99,0x73d3ad99,0xbdfa8434,0x8494526e,0x1840ac72,0x20802880,0x08432902,0x4aad420b,0x4a8e3a6c,0x4a8edeff,0x21498c96,0x310618c5,0x4a2c41ea,0x31440821,0x080062ea,0x31855249,
-0x39403961,0x39824161,0x6ac74182,0x52046a66,0x20405224,0x418272a8,0x30c051c4,0x41204981,0x6a8159e4,0x7b058b68,0x7ae68347,0x7b088348,0x6a868309,0x6a6651e4,0x5a0449a1,0x51a351e3,0x620451a3,0x5a045a04,0x496159c2,0x31003100,0x51c34140,0x5a0449a2,0x41223900,0x624759e5,0x28604982,0x28e01820,0x20403901,0x49a351c4,0x30e04983,0x49a24182,0x30e04162,0x39014182,
-0x390128a0,0x310128c1,0x18c028a0,0xc67939e6,0xde9bdefc,0xce79ce7b,0x5289ce38,0x59e76aeb,0x5249ff9e,0x9c51be18,0x9c74ef7d,0xbdd8be17,0x6aca634e,0x5207bd55,0x6acade38,0x39425206,0x6ac94184,0x5228732b,0x6acb7b6d,0xad168bd0,0xc5f9a4f5,0xb53762ed,0xd6789c72,0x83afb555,0x9c745aac,0x626d8c35,0xdf1fce9d,0x84126351,0x20629d14,0xb5787b6f,0xd71ebdfa,0xad79ce5d,
-0xd69ec5fb,0xbdfbc63d,0x9495ffff,0x7bd16b70,0x62cd9cd4,0x6b6e41ea,0x739118c4,0x7b6c7bf1,0x5a835a65,0x396041a0,0x49c249c4,0x41a37309,0x206128c0,0x8c13b575,0xb575acf5,0xbdb55a89,0x945120a1,0x73ce8c72,0x29472107,0x4a2b39c6,0x73927392,0x102483f3,0x9cf7ad39,0xb5da6b51,0xadbb8c76,0x94d67bf4,0xa5385af2,0x84145290,0xad79ad7a,0xa5388416,0x3103836d,0x00020843,
-0xc67d4aae,0xd6df426d,0xbe3cc65e,0xb61db61c,0xb61bb5fc,0xb61dbe1e,0x7c37be3c,0xff7fc5fd,0x6bb74084,0xbe1cc77f,0xbdfcbe1c,0x40c4c5da,0x290420e4,0x10a62926,0x20c2ffff,0x31c92924,0x422cb5d7,0x7bd4df1f,0x318abdfa,0xb5b9bd7a,0x49436209,0x20a030c1,0x000020a0,0x8c95ffff,0x31eb73f4,0xb5fc8c74,0x9d79d6ff,0x7c36ad9a,0x7bd3ad7a,0x3966c5d9,0x20a149e6,0x396662ec,
-0x49a149a1,0x62863961,0x628651e4,0x49a26a67,0x62664981,0x38e059e6,0x49616a66,0x51a059e3,0x620283aa,0x832672c2,0x83488b68,0x838a8b89,0x51c46aa7,0x72e94942,0x51c45a05,0x51e34982,0x38e059e4,0x49a34962,0x51e230e1,0x49a230e0,0x38c059e4,0x30c04142,0x59e44962,0x59e449a1,0x28a059e5,0x39423101,0x28c03942,0x51c45205,0x416230e0,0x39414983,0x30e04162,0x39414162,
-0x20a03942,0x20803102,0x39a63162,0xc5d82a24,0xe6fcce19,0xf79eef3d,0xb5b7d619,0x5a6a83ae,0x734d9c31,0xef3edebc,0xb596debc,0xd618ffbf,0x838e5aca,0x62aac5b8,0x6ac972eb,0x31235206,0x39244163,0x418549e7,0x62aa4186,0xbd7793f0,0xb578ce3b,0xa4f583b2,0xa535bdb8,0xa537be1a,0x94b69d18,0xdebdcedd,0xce1cbd99,0x73b27bd4,0x31a994f5,0x49ea7371,0xc61cad58,0x7bf3ce7d,
-0xa4f7c65d,0x4a6ece5c,0x6b51ce7b,0x845431ab,0x631052ce,0x949539cb,0x8c75630f,0x000083f3,0x62a45a45,0x396141a1,0x73096285,0x52063983,0x20c228c1,0x94b27b8f,0x52298c51,0x31855a89,0x20a24165,0x9cd44a48,0x94958c13,0x4a0b39c9,0x426c7bb4,0x00228c96,0x94965aae,0xa539b59b,0x94d894f8,0x8c977c15,0xb5baad7a,0x94966b51,0x7bd49cf7,0xbddcad5a,0x31249c91,0x8cb80024,
-0xce5e0003,0x8436c61e,0xadbcadbb,0xb5fc9519,0xb61cb61d,0x8cd7b61c,0xbe1dbdfc,0x0001ce7c,0x3ad20004,0xbe3db61d,0xb5bbb5fc,0x3924838f,0x002520e5,0xf7bfae3c,0x4186f7bf,0x08653944,0x63518473,0x73d4adb8,0xe6ffad9a,0xe6fd396a,0x38e25a2a,0x208030c1,0x106128a0,0x7c3410a5,0x94f6cebd,0x9d389d37,0xc67d1086,0xf7ffce7d,0x8c987bb2,0x8c11ef7f,0x31441040,0x08206b4c,
-0x41214982,0x62054982,0x59e351a2,0x49a272c8,0x49a22880,0x7ae851e3,0x6a656a66,0x59e45a04,0x6a8393ec,0x7b055a00,0x8b897b26,0x61e593aa,0x49c46a47,0x5a056267,0x49a25a04,0x624551c3,0x6a664982,0x30e038e0,0x41812040,0x59e551c4,0x38c03921,0x51c451a3,0x59e54142,0x286051a3,0x30e04122,0x39423962,0x49a33100,0x392128a0,0x414130c0,0x51c43941,0x418230c0,0x30e04182,
-0x39c43963,0x29632060,0xbcf39db5,0xffff2145,0xef5ddedb,0xdedbd67a,0xffff8c52,0xef7e5a48,0xcdf7b4d5,0xd69c9c51,0xad97c5d8,0x41c8c5d9,0x838e3126,0x7b6d83b0,0x730a49c6,0x5a683103,0x39653964,0x39865229,0x730c6aab,0xd61a838e,0xad587bb1,0xa515c63b,0x94967bd1,0x83f2b599,0xa53994b6,0xc5daf77f,0x9cd6526c,0xbe1b8c56,0xaddbb63c,0x52cf8cb7,0xc5fbce5d,0xc65cce7d,
-0x9cd74a8e,0x84359cf7,0x9cd62106,0x7bf4ad99,0x7c168c76,0xad9a52f0,0x63726372,0x6b4e7c14,0x5aaa7bce,0x52455a85,0x62883142,0x49a462a9,0x314628c1,0x7bd04a4c,0x39a55acb,0x84105aa8,0x31663145,0x424c0024,0x6310ad99,0x7bd2630e,0x9cf96372,0x0022c61d,0x6b517bb2,0x7bd4a539,0x8456ad9b,0xad9b94b7,0x7c356b93,0x84567c35,0x84579518,0x9d1a8477,0x3945e6bb,0xa55b0024,
-0x9d1631ab,0x42af9cba,0x8475ffff,0x8cb8a579,0xb5fcb5fd,0xb61cbe1d,0xb5fbbdfd,0xffffd67d,0xbe3d5371,0xbe1cdf7f,0xc5dabe3c,0x41645165,0x94fc39aa,0x8435324f,0xffffbddb,0x00443945,0x4a4fb5bb,0x7b938c96,0x9cd76b31,0x1025f73f,0x41a628e7,0x20603902,0x18a22080,0x4aad428d,0xbdfa10a5,0xad98bdfa,0x296b8cb6,0x00019d16,0x322e8433,0x49a862b0,0x28c449e8,0x29033165,
-0x5a6662c8,0x624551a3,0x5a2449a2,0x51e330c0,0x5a2559e4,0x72e830c0,0x5a246225,0x41216244,0x62826244,0x62228306,0x62246a61,0x61e35981,0x622540e0,0x28a04962,0x62055a05,0x51e451c3,0x416249a2,0x41403900,0x51e45204,0x51a349a4,0x38c040e0,0x496238e0,0x41424983,0x30c02060,0x396149a3,0x522620c0,0x49c34182,0x51e64164,0x418149a4,0x416130c0,0x39233942,0x214238e0,
-0xef3cefff,0x22686125,0x3924a5b6,0xdefdc63a,0xde9bf79e,0xdefbe71d,0x730cd63a,0x5a4972e9,0xb515d5d6,0xd63ba4f3,0x9cf56b0e,0x8c934a6c,0x7bcf6b8f,0x5acb7bd0,0x4a273985,0x52683123,0x5a6a3985,0x4a0862cb,0x8bef5a4a,0xbd994a2a,0xce5ba4f7,0x8453ad99,0xce9c9d36,0x94d6a537,0x8413bdba,0xbdba630f,0x39ac9cd6,0xc63cc619,0xbdfbc63b,0xadbbc63d,0x63518455,0x5af1ad7a,
-0xa53994b7,0x4a6d5b34,0xbd99f75d,0xb5dc7372,0x8c978c98,0x7bf5ad7a,0x84578453,0x8454424f,0x84546370,0x4a8a5a89,0x5aab428c,0x41636b0c,0x843128e2,0x9cd48c74,0x41c63186,0x62cc41e4,0x31867baf,0x7bf48c55,0x7bd38c77,0x6b707390,0x94f88435,0x006473d4,0xbdfa52ae,0x73d48476,0x8cb96bb5,0x84768476,0x84767c37,0x8cb8a55a,0xadbba57b,0xa57ba57b,0x2902a4f5,0xa55a18c5,
-0x006694f9,0x94d9ad7a,0xaddbb63d,0xb5fc9d17,0xad9ca57a,0xaddbb5dc,0xbdfabe1f,0x632e0804,0xb61eefff,0xb5fc9d3b,0x9c11be1c,0x39244984,0xdf3f1085,0xbe1c8d19,0xc63aaddc,0x082330c4,0xbe1d5b52,0x5a8f4a2f,0x396a7b73,0xc59a20e8,0xa43220c7,0x292230e2,0x292320a0,0xa55a424d,0x000131aa,0x00029cf7,0x3a0bc63c,0x7b927c35,0xa57b298b,0x8c3073b3,0x9c934209,0x418741c7,
-0x6a464942,0x59e44141,0x62266246,0x59e45a04,0x62256245,0x416051c3,0x5a2451e2,0x49a251e3,0x626659e3,0x7b0851c1,0x6a457267,0x496259c3,0x30a04963,0x41426246,0x51c351c4,0x51c359c3,0x414149a2,0x390130c0,0x38e04982,0x59e45a05,0x30a04921,0x28404942,0x51c44942,0x30c030a0,0x418351c4,0x41835a46,0x414230e0,0x28c041a2,0x39213100,0x41c45205,0x414418a0,0x7b4c3962,
-0xe6fbc65a,0xd67940a2,0xa51394d3,0xe73ee6bd,0xe71dffbf,0xeefcd69b,0x7b4e938e,0x62ab736c,0xbd366288,0xc5b9f73e,0xf7bf83d1,0x84328c94,0x5b0ea557,0x526a52ac,0x41c76aec,0x6aec28e3,0x5a8a20c2,0x4a09b556,0x5aab522b,0xad99ad38,0xdeddc65c,0xce9dcebe,0xad78b5b9,0x8c76b5ba,0x4a6ebe1c,0x84346b72,0xce5ca4d8,0xb5dbc61b,0xc65dad7a,0xbe1cb5ba,0xb5bba57a,0x9d39bdfc,
-0xc67dbe1c,0xbdfbb5db,0x21070024,0xbe1bc5fc,0xa55ab5fb,0xa57aa57a,0x8c974a6f,0x8456b5db,0xb5dac63d,0x18c45acc,0x20e58c73,0x39447b6e,0x8c7620a2,0x7c139d17,0x5a8a39c9,0x524928e2,0x31869472,0x9cf839cb,0x8c969497,0x6bb26b71,0xa5384aaf,0x214794d8,0x73946330,0x7c1594f8,0x8cb89d39,0x8cb88c97,0x8c978cb8,0xa57aa55a,0xadbb9d5a,0xadbbadbb,0x3166b5ba,0x8cb720e5,
-0xa55aa59b,0x94970025,0x8c97be3c,0x0065c69f,0x9d1abe1d,0xaddbb5dc,0xce5eb5fc,0x0004c67f,0x9d595312,0xad9cb63c,0x6229bdfb,0x00453925,0xb5ba0803,0xbdfca5bc,0xc63b9519,0x31651882,0x9cb5b556,0x5ad02909,0x62ef39eb,0x524dd67d,0x30e5c61c,0x20802881,0x290228e1,0x214a424d,0x63b36bf4,0x84549559,0x296973b0,0xef5fad79,0xc61b2927,0x6b71a518,0x3966736f,0x290420c3,
-0x49c25204,0x622593cb,0x51e249a1,0x62655a25,0x39215a04,0x5a054982,0x7b086246,0x72897b28,0x49a051a3,0x51c48367,0x62254120,0x62265a24,0x38c04963,0x51c36246,0x390030e0,0x39004962,0x416251a3,0x41604161,0x49424942,0x624649a4,0x204038e0,0x39014122,0x51c438e0,0x51e451c3,0x5a674182,0x30c05a04,0x41624162,0x41636267,0x49834184,0xf79c3922,0xab4ff7de,0xf7bd5ae8,
-0xeefbce5a,0xe65cffff,0xad95dedb,0xa536e67c,0xde9bf77e,0xffbfdefc,0x20c48289,0x6b2dad54,0x51a8a4b1,0xf75ec599,0xc5fade9b,0xb5b9bdda,0xbe3abe1a,0x3187ce9c,0x31253967,0x20c441c7,0x49e83144,0x4a0962cc,0xe6fd62ef,0xce9dc63d,0xdeddce7c,0xc65dd6ff,0x94d6b5ba,0xb59b7392,0x84768c96,0x9d18be1c,0xbdd96b33,0xb5bba518,0xc63cc63d,0xbe3dc65d,0xc65dbdfc,0xbe1cbe3c,
-0x8475b5db,0x73b2ad3a,0xa51808a4,0x94d8ce1c,0xad9bbdfd,0xad9aa57a,0xa5399cda,0xbdfe94d7,0xb5daa55b,0x41e96b70,0x3188ad36,0x31049c73,0xc63e28c3,0x9d188455,0x8c324a6d,0x6b0b41c5,0x528a630c,0x9cf873b2,0xa55a8436,0x9d395b30,0x420b8497,0x000283f4,0x7bf48c36,0x8c779d18,0x95189518,0x9d198455,0x94d88cb8,0x9d398cd8,0xa59b9d5a,0xadbbadbb,0x18c5b5bd,0xa57918c4,
-0xb5bb9519,0x4a4e5af0,0x94f894d6,0xa55c9d3b,0xb5fe1908,0xb5fcad9c,0x0847b61c,0x10a6adbb,0xa59bc6be,0x7c18a59d,0x38a38454,0x955c28c5,0xffff4189,0xbddc0005,0xb5bb9d7b,0x20a42907,0x4a6d4209,0x298b6395,0x524c8c95,0x526d8c13,0xc597c65c,0x30c128a1,0x18a128e1,0x9cf90866,0xd6bf428d,0xb5bba579,0x31687c31,0x422b4a6d,0x83afc619,0x95156b30,0x49e9b577,0x1862c5b7,
-0x412051a3,0x49807ac8,0x6a6751c2,0x5a048b8b,0x49a351e3,0x5a0338e0,0x72c74981,0x30c03920,0x49824141,0x5a2451e4,0x59e45182,0x414159e4,0x20205a04,0x412128a0,0x49a359c3,0x41625a04,0x49a351e4,0x5a464161,0x392051a4,0x498359e5,0x494238e0,0x30a030a0,0x39224983,0x62673942,0x392049a3,0x49a34182,0x31003941,0x30602120,0xdeb91a06,0x6ae7ddf1,0xb4d4ffdf,0xef9ee73c,
-0xd65ac575,0xd63ae75d,0xcdf9d618,0xad369c73,0xdedce75e,0xbd55ce3a,0x10839473,0x29653186,0xb535de39,0xce3bbdd9,0xdedeffdf,0xce7cc5fa,0x8c53ad77,0x3a085b0e,0x1883526a,0x6b2d39c7,0x62ed2105,0xb5b91864,0xbdda8c54,0xdefec61b,0xdeded6bd,0xd69dce7d,0xa57abe1c,0xb5fbad7a,0x9d19adba,0x7bf49d19,0x5b108455,0xbdfcb5bb,0xc63db59b,0xbe3dbdfc,0xbe3dbe3d,0xbe1cbe1c,
-0x9d39adbb,0xb5b98c77,0x424e31aa,0xad5a298c,0xad7aad7a,0x9cfaa55a,0xa53994b8,0xb5dca559,0xa578a538,0x52ef29a9,0x6bb29cf8,0x30c2736f,0x6b7228a3,0x739152ae,0x0000b599,0x73b14a4b,0x420839e7,0x6b727bf0,0x3a0e6372,0xa55a52ee,0x18ea8456,0x00422948,0x94d86332,0x426f6b93,0x84778456,0xa57b7c16,0x94b99d18,0xa59aa539,0xa57a9d5a,0xad9bad9b,0x4a4ba59b,0x10642083,
-0x94d89d58,0x00243a0e,0x9d1adf3f,0xa57ba57b,0x0004a55a,0xad7ab5dc,0x52b0c61c,0x39f0bdf9,0x0888addb,0xadbcad9a,0x3925628d,0xbe1d0843,0x6352a4d5,0x9d3aa55b,0x9d399d3a,0x28e4d69c,0x73b239c8,0x298b52d1,0x6b306b71,0x21277bf2,0xd69dad7a,0x30e23902,0x20e228e1,0x9d3a1929,0x845752f1,0x3a2da55a,0x73b2be3c,0x5acf9d59,0x296a2167,0x6b7031ca,0x49e96b0f,0x41c783ef,
-0x620572a8,0x6a664981,0x62264981,0x5a045a25,0x5a0451e3,0x51e372c7,0x6a867b09,0x51a230c0,0x51e34161,0x51c149a2,0x5a056266,0x51a351a3,0x49835182,0x59c351c3,0x49a34962,0x5a0559e4,0x5a0551e5,0x49834161,0x390038e1,0x30c04983,0x41013920,0x206030a0,0x5a2638e1,0x62476267,0x498251c4,0x414249a3,0x39623100,0x21a44964,0xf677defc,0x51e17a65,0xb597ad15,0xefbdffbf,
-0x5aabee17,0xe69be73d,0xacd3d5f7,0x9cd493f1,0xd69bdf1d,0xce3ae6fd,0xd63a6b92,0x5b2fd69c,0xd6bf524d,0xbdb9ce5b,0xe6fee6fe,0xc63abdd9,0x634fb598,0x2126634f,0x41e81884,0x314620e4,0x3a0b7bf2,0xb5b9d65c,0xc61bbdda,0xce9dd69d,0xd69dd6bd,0xce5cce5c,0xbe1cce7d,0xbe3dbe1c,0xb5dbb5db,0x9d17bdfc,0x8434420c,0xc61db5bb,0xbdfcc61c,0xbe1cbdfc,0xbe1cbe1c,0xad9abdfc,
-0xad7aad7a,0xf7bf9cd9,0x6b920847,0x94b7be3d,0x8c976b71,0xad7cad7b,0xad7a9d19,0xb5faa559,0xd6bcb59a,0xbdfbc63d,0x73f3ad99,0x30e2630d,0x7bd43104,0x5ad0ce7e,0x6b50b579,0x52af4a6c,0x422c7c35,0x7bf539c8,0x9cf9b5dd,0x94f96b95,0xa5bb8cd8,0x4aaf7c76,0x4a8f7bf5,0x74158456,0x5af15b13,0x18e8c65e,0x52f2422c,0x4a8c0004,0x9d199d3a,0xa57ba55a,0xce3b9d9b,0x18832062,
-0x0026a4f9,0x845794f9,0x94f80002,0xa55aa55b,0x9cfba57b,0xb5da52b0,0xf79f6b6f,0x21d00003,0xadbd8476,0x94b77c35,0x31248bf1,0x94f718e7,0x10ea83f3,0x73d6be1d,0x52d2b5dd,0x30e352ce,0x5b0e18c4,0x637294f8,0x31aa8474,0x4a4dd6fe,0x39eb0827,0x30c138e3,0x18a12080,0x6bb40002,0xa55a8456,0x6bd49d19,0x190694f7,0x94f8a55a,0x73d59d38,0xdedd8cd6,0x522b7351,0x31246acb,
-0x41206204,0x59c44120,0x5a046a66,0x51c351c3,0x5a246245,0x51c16244,0x62445a23,0x39204981,0x622551e3,0x51e349a2,0x41406265,0x49624961,0x49824962,0x49a251e3,0x52045a24,0x41614162,0x392151c3,0x49834982,0x414251a3,0x41624141,0x392130e0,0x28a049a3,0x5a454163,0x62676ac8,0x51c45205,0x30e051c5,0x28603963,0x01c73a03,0xcd93fffe,0x7b4a9389,0xad53c5f6,0xe6fcdf3d,
-0xad78c533,0xff5ce71c,0xcdf8a4f2,0xbdb8c5b6,0xd69cce7b,0xe6fdad77,0x08028453,0xad59a558,0x83f4a518,0xb5b9ce5c,0xce7cc63b,0x9cf6ce5c,0xa578bdb8,0x8c3310a5,0xa516cebc,0x94b7422a,0x52af9cf7,0x8c759cf8,0xc61c9d18,0xc63cce9d,0xbe1bc65c,0xce7dc63c,0xc65dc63d,0xc63cc65d,0xb5fbbe1c,0xadbb8cd8,0x9cf8a57a,0xbe1cad7a,0xbdfcb5db,0xb5fcbe1c,0xbe1cbe1c,0x9d19b5dc,
-0x9d39ad9a,0x0004a53e,0x637394d8,0xad7ac65e,0xa5395b10,0xa53a9d19,0x8cb68c97,0xd6bdef7f,0xad58ce7b,0xa518a518,0x9cf8a4f7,0x31035269,0xa5182903,0x7bf48476,0x7c144a8e,0x73f36b92,0x8cd88496,0x6bb45b12,0x320d94d8,0x5b73addc,0x94fa9d3a,0x845794d9,0x73d59d19,0x9cf96b94,0xc65f94d8,0x7c767c58,0x8cb97417,0x7c789519,0x9cd70003,0x951a94f9,0xb5989d7b,0x00002083,
-0x94f9f7df,0x8cb89d7a,0x21298497,0x94f99d1a,0x9d199d3a,0x9d3aa57a,0x743631cc,0xa59b953b,0x6bd48457,0xdeffaddb,0x31454a2a,0x94f85b2f,0x0026cdfa,0x192a214b,0x9d39953a,0x10436353,0xc5fa18c4,0x633152cf,0x39eb9d19,0x4a908c74,0x8cb752d0,0x28a130c2,0x100028a1,0xc69f10a5,0x3a507c14,0x6bb40003,0x8c965b31,0x94b994d8,0x4a4e7bd3,0xd69c8413,0x7b8e20c4,0x310328e2,
-0x5a034120,0x72c86a86,0x62254982,0x51e35a04,0x49a251e4,0x62654181,0x51e25a24,0x30a04161,0x51c249a2,0x62464160,0x49a24140,0x520451e3,0x59e351e4,0x49823920,0x49c34121,0x49a34182,0x498251e3,0x38e04982,0x41214121,0x49623900,0x498330e0,0x30c03900,0x39613922,0x49c45a26,0x51c451c4,0x20c14143,0x8b489cb1,0x01e741e2,0xcdd4e75d,0xd639cdd6,0xbd95ef1b,0xd67ae73e,
-0xdefccd76,0xac50f75d,0x8c2f840f,0xf75fad14,0xd6bcd6bc,0x8413b598,0x528ebe1c,0xff7fb5da,0xb599b5b9,0xad79a537,0xce5cc63b,0x8414ad58,0xad58ad38,0x6b0eb599,0x6b916bb1,0xbdfc0046,0x8c56ad99,0x9d18b5ba,0xc63cbddb,0xce7dce9d,0xce7db5da,0xc61cc65c,0xc63dc63d,0xc63cc65d,0xbe1cbe3c,0xad9bb5fc,0xad7ab5dc,0xb5bbad9b,0xbdfcb5fc,0xb5dbb5fc,0xb5dbb5db,0xa55ab5bb,
-0x4a905af0,0x29abce5f,0x52f194d8,0x5b32320c,0x9d397c36,0x94d99d19,0xb5db9d39,0xf77ef79f,0x9cb5dedd,0xad177bb1,0xa538b578,0x288120e3,0x73713124,0x3a2dce7d,0x635139ec,0x6bb37c15,0x9d198cb7,0x73d410c9,0x9d3a7414,0x84787c57,0x9d3a9cf9,0x9d3b94f9,0x8c986374,0x6353b5bd,0xf7df52d1,0x7c7694fa,0x5b349d5c,0x84b98cf9,0x19095b54,0xad7ac63d,0x49e9c63d,0x08003104,
-0x294a0001,0x84779519,0x194a8477,0x94f9b5ba,0x9d5a9d3a,0x94f99d5a,0x955a0887,0x9d5a7c78,0x84568cb8,0x632fad9a,0x21268410,0x94d79558,0x004562ac,0x7c17b5dd,0x95197c56,0xd65ca53b,0x18c51083,0x5b11ce7d,0x296a9cf8,0x7c166351,0x7bf4ce9f,0x28a14143,0x102028a1,0x84b718c3,0x63934a8f,0x94f87c15,0x7c558477,0x8c766bb4,0x00029cd8,0x10868475,0x41c61042,0x10004185,
-0x6aa75a04,0x51c25a24,0x39003920,0x41805a07,0x5a244161,0x628551e2,0x51e27308,0x5a444161,0x5a055203,0x5a046246,0x5a455a24,0x49824181,0x49a328a0,0x18405a26,0x520441a3,0x39015a45,0x49a351c4,0x51e349a2,0x412138e0,0x41223901,0x30e051a4,0x39204142,0x39414161,0x5a475a46,0x498449e5,0xf77dbeba,0xf6fbe6bb,0x09c88121,0xffdff7fe,0x4964ee99,0xde9aef1d,0xff5ef7bf,
-0xcdf8ac52,0x6207b514,0x7bef93af,0xff7fae18,0xc65b8c94,0xd6ddb5da,0xad9ae75f,0x7b926b92,0xc61bb5ba,0xbdbb9cf6,0xce1bb5ba,0x6351c5b9,0x738f5acd,0x734f18c5,0x84356370,0xc65ca559,0xd6bead99,0xbddbb579,0xc63cb5dc,0xc61bd6dd,0xce7cc61b,0xc63cc65b,0xc63dc63c,0xc61dc61d,0xbe1cbe3d,0xbe1cbe1c,0xb5dcbdfc,0xb5fcadbb,0xb5dcb5dc,0xb5dcb5dc,0xa55aad9b,0x6353adbb,
-0xaddc73f7,0x63519cf8,0x94f8ad5a,0x951894f8,0x426f29ab,0x8cb98477,0xbdfba53a,0xef1dffbf,0xb59ace5a,0xffbfce7d,0xc5f8e679,0x18613103,0x28e83986,0x94f77bf4,0x5b125b51,0x74157c15,0x8c9794f8,0xa59b7c76,0x9d1a8497,0x94d98c98,0x94f99d1a,0x95198497,0x8cb78c99,0xa57aadbb,0xa57b8cb8,0x847773f5,0x953a7415,0x84d98cfa,0x74377c98,0x42d19d7b,0x5a8b194a,0x104039a6,
-0x8c7520a4,0x94f894d8,0x8c778497,0xbddc0025,0x9d19a51d,0x9d399d5a,0x9d1a29ee,0x95399519,0xb5fd7436,0x9cb631cd,0x10c73105,0x9d18953b,0x0004a516,0xbe3e3a30,0x84978cf8,0x8c968498,0x108420c3,0xb5bb73f4,0x8c9639ab,0x94fa420e,0xc65d5b13,0x39023964,0x102030e2,0x3a0b2103,0x52d08476,0x5332c67e,0x73f58c97,0xbe3b6b94,0x9cda4aaf,0x7c575311,0x736eb5ba,0x290120e4,
-0x51e372c7,0x39005a03,0x41415a04,0x6aa751e2,0x39205204,0x626451c1,0x72c772e7,0x51e351e2,0x624649c3,0x5a256266,0x49a33941,0x41614163,0x522549a1,0x39411840,0x5a665a66,0x49c36286,0x51c451e4,0x41823941,0x414130c0,0x392130c0,0x31014983,0x41834142,0x41613921,0x62466246,0x41a441a4,0xffdfa67c,0xffbee69a,0x3166b265,0xf79edede,0xe75cc554,0xe6fcf7ff,0xeebcf7bf,
-0xac91c5b6,0x9bceb42f,0x8c10a513,0x6b4fb556,0xad588433,0xc67bd6bd,0xc65dd6de,0x73f3f7df,0xad7994d7,0xb5bace7c,0x7bf38cb7,0x73b39495,0x6b6ead58,0x7b71528c,0xad797c13,0xbe1cbe1c,0x9cb89d39,0xb59ade9e,0xce5cb579,0xc61bce5b,0xbdfbbdfb,0xb5dbb5db,0xb5dba559,0xbe1cbdfc,0xbe1cbe1c,0xb5fcbe1c,0xb5dcb5dc,0xb5dcb5dc,0xb5dcb5bb,0xb5bbb5bb,0x94d8b5dc,0xa57ba57c,
-0x94d8adbc,0x7c158456,0x426e6bb3,0x9519ad9b,0x9d3a6372,0x9cf973d5,0xd69dad7a,0xef1dffbf,0xbdbbbdd9,0xd619b5ba,0xc5b6acb2,0x208230e3,0xa59b0002,0x6bb46bf5,0x84979d3a,0x7c158456,0x8cb88456,0x4ab07c57,0x9d3a7c57,0x8cba94d9,0x94b98459,0x7c19a55d,0x73d66bb3,0x4a8f8457,0x8cb86374,0x7c575333,0x7c577c57,0x8d1a9d3b,0x8cfa84d9,0x8cfa8cd9,0x3a0a7458,0x1020bd75,
-0x39e91880,0x7c368475,0x6b9473f5,0x00036311,0x7c1673b4,0x84576353,0x9d3a951a,0x7c778cd9,0x951a7c77,0x106573d5,0x00243105,0x31cb94f9,0x00c95acd,0x6c377c5a,0xa5bb6bd4,0x94d89519,0x18a43986,0x73d3b5db,0xbe1e6352,0xa59b8c99,0xce7c7c16,0x28c130e1,0x10402080,0x4aad1081,0xadd9426e,0x322e426e,0x9d397c56,0x9cf794f8,0x6b9352af,0xadbd4ad0,0x6b319d3b,0x08209472,
-0x51e230c0,0x7b2a6266,0x49c23920,0x5a4472c8,0x49c05222,0x7b286263,0x51e25a44,0x49c35a03,0x5a256264,0x52245a46,0x41614182,0x6aa73962,0x5a455a66,0x49a15224,0x49c24161,0x39005204,0x39204182,0x49834141,0x39215a04,0x390030c0,0x39013900,0x49654984,0xa3a741a1,0x5a6772a9,0x214549c3,0xffbfcf7d,0xf7bec5b7,0x6921e46d,0xef5edebc,0xef5edefc,0xffdff79f,0xce19ef5d,
-0xab6cf71d,0xffbfac71,0xadb7adb7,0xe75eef9e,0xa4b693f3,0xa5589d18,0xb5fbce9d,0xc65ccebd,0xbe1cce7d,0xa539adb9,0xa5387c34,0x63719476,0x62ce8434,0x2929d65c,0xffff9455,0xadbb8454,0x7c5694f7,0xb5b94a2e,0xc598bd59,0xce5cde7c,0xad9ba518,0x9d199cf9,0xb5dca55a,0xbdfcbe1c,0xbdfcbe1c,0xb5dcb5dc,0xb5dcb5dc,0xb5bbb5bb,0xb5bbb5bb,0xadbcb5bb,0xa57a9d39,0xadba9d39,
-0xdeff9d59,0xad9bbe3e,0x94f98c97,0x951894d8,0x9d398477,0x73f69519,0xdebdad7a,0xdebcef1d,0xce1ec5fc,0xef1bad36,0xc512c593,0x10413943,0xa558ad38,0x110973d4,0x94f85b52,0x8c977c15,0x8c986bb3,0x8cb96bb5,0x95197436,0x94d994fa,0x8cd88478,0x427273f7,0xa57b320f,0x52ce73f5,0x8cb7420d,0x84596353,0x7c788cb8,0x94fa951a,0x94fa951a,0x8498951a,0x39c98498,0x20a1d659,
-0x08630840,0x63945b12,0x94f86394,0xb5fb8476,0x5312296a,0x000673b3,0x84988498,0x63d66c16,0x84788cf9,0xa4d58cf9,0x002620e4,0x84975b92,0x0086c65b,0x29cd7c35,0x951c7416,0x63726373,0x28e38410,0xa5380043,0x00250867,0x73d652f0,0x518594b4,0x28c030e1,0x184028c0,0x19061020,0x73d3dede,0x84555b94,0x5b11be1c,0x3a4e73d3,0x63931929,0x324d5b31,0xa5388cb6,0x4a284a6b,
-0x5a0351c2,0x418372e7,0x72e972e9,0x39206aa7,0x5a235a23,0x62655a43,0x51e26aa6,0x416251e3,0x5a453940,0x49c35a46,0x49c341a2,0x49e449a3,0x49c341a3,0x41825a45,0x39404181,0x624551e4,0x39003920,0x41833941,0x41823941,0x30e02040,0x41c451c4,0x6ae739a2,0x9202ff38,0x62856181,0x21864182,0xffff94f4,0xffffc5d7,0x7962ff9c,0xef7eff9d,0xfffff79f,0xf79ef79f,0xd639ef1d,
-0xbc70eedc,0x9cd340c3,0x4a07bd75,0xdf1d8c2f,0x5aadc556,0xcebece9d,0xcebec67d,0xcebecebe,0xadbad6df,0xbdfcbe3b,0x9cf894f7,0x4aae94b7,0x526c39eb,0x734fad37,0xa4f88c53,0xad9a8c96,0xa59bad9a,0xb59b8457,0xacf58bf4,0xce5dacd6,0xb5bab5ba,0xad9bb5bb,0xb5dca57a,0xbdfcbdfc,0xbdfcbe1c,0xb5dcb5dc,0xb5bbb5bb,0xb5bbb5bb,0xb5bbb5bb,0xb5dcb5bb,0xadbba57a,0xadbba57b,
-0xa57b10ca,0xa55a73d4,0x8cb7a59b,0x7c15a55a,0xa57a298c,0x7c589d1a,0xe6de9cf8,0xdedcef5e,0x9456a4d6,0xbd759c94,0x9c0dde57,0x208228c1,0x8c549cd6,0xbe3d94b6,0x94d78455,0xa5589d17,0x84786373,0x84787417,0x8cf98cb8,0x9d1a6bf6,0x73f57c37,0x6bd77417,0x6bb54291,0x5af252f3,0x6bb38477,0x73d68c96,0x8cd98497,0x84988cd9,0x951a951a,0x94fa951a,0x73708cfa,0x28e241a6,
-0x00220000,0x6394426f,0x845673f6,0x10e87c36,0x7c350846,0x63b5a4f8,0x849794fa,0x7c379d3b,0x951a8498,0xad36951a,0x63942105,0x320d951a,0x11499d37,0xaddd42af,0x9d3a5310,0x9d19d6ff,0x20c3738f,0x4ace10a5,0x52d07c36,0x7c577c36,0x39039452,0x30e13922,0x20a02080,0x00001040,0x29acb5fc,0x5b118498,0xadba6bd4,0x4a8e10c8,0x7c35298b,0x4af14a70,0x318a8475,0x62ec7bf3,
-0x39006284,0x6a875204,0x39407b48,0x628649c2,0x5a036266,0x6ac628a0,0x62a65a44,0x6ac75a66,0x51c34180,0x41a25205,0x52044182,0x5a256266,0x394151e4,0x49a33961,0x39404183,0x41824141,0x31004161,0x39224162,0x41623921,0x390049a3,0x490230c0,0x636a7ae6,0x5962e52e,0x69c47a84,0x00a34182,0xde38f7be,0xffffe6db,0x98e0ff7d,0xffdfffff,0xf79ff7bf,0xef1def7e,0x93d0cdd8,
-0xa4108baf,0x838f732c,0x8c7251e9,0x8baf73f0,0x3167be39,0x9d389d16,0xd6ffce9d,0xc67dcebe,0xbe3cce9e,0xc65dcebe,0x95199d7a,0x5b306352,0x20c618a6,0x3928c5da,0x398d39ab,0xb5db8c97,0x8cd8a57a,0x314c953a,0xa4d4628f,0xb59ab537,0xc69cc63b,0xb5bbbe1c,0xad9bb5fc,0xbdfcb5db,0xb5dbb5fc,0xb5bbb5dc,0xad9bad9b,0xb5bbb5bb,0xb5bbb5bb,0xad9bad9b,0x95198cb8,0x8c798cb9,
-0x7c1694f9,0x94d852f1,0x84979d3a,0x10ca9d19,0x94d994f9,0x94da94da,0xd65c9d19,0xce5aff9f,0xa518b598,0xeedca4b6,0x3922a491,0x08002080,0x7bb3bdd7,0xbe1c630f,0x94b68c75,0x5ad17b94,0x94f98458,0x8cfa4291,0x8cb88cf9,0x73f67c37,0x7c586bb5,0x84b9a57c,0x8cba8cd9,0x8cfa84d8,0x31ed21ce,0x9d3a00a4,0x7c578457,0x8cfa8cd9,0x7c7794fa,0x8cd98cfa,0x62ee8498,0x18a120a2,
-0x00420840,0x63946bb5,0x8c97addd,0x9d1a3a2f,0x10239cf8,0x953c522c,0x84b87c58,0x7c169d3a,0x94fa8478,0x62cc951a,0xadbc1064,0x9d1a52f2,0x006773d3,0x957c8d1a,0x21ab29cd,0x63939d1a,0x20c48cb6,0x09071863,0x635284b7,0x8d19ad9b,0x41634987,0x310128c0,0x28e23142,0x18421040,0x8c9942b2,0x4a90ad3c,0x4a906bb4,0xbddb4aae,0xbdfba518,0xdf3f422c,0x6b7273f3,0x630e4a8f,
-0x7b8aeed9,0x5a456a88,0x49a17b29,0x5a445a24,0x39205a23,0x5a453920,0x41615a44,0x49c35a45,0x41615204,0x418241a2,0x28e041a2,0x520549c4,0x39215205,0x51c449c3,0x49a349a3,0x49a44182,0x41614162,0x51e34182,0x20006ac8,0xffdc4140,0x5960bc6b,0xffff5a66,0xfe94ff79,0x62a79a02,0x434d49a2,0xff5cefbf,0xffffe6fb,0x98c0fffd,0xffff95b9,0xef3ef75f,0xce19ef3e,0xacd5cdf9,
-0x4924bd14,0xa492730d,0x20a32000,0x734d6b8e,0x00021842,0xb5dc10c7,0xd6dec67d,0xcebed6be,0xd6bec65c,0xbe3ccebe,0x8455adbb,0x63725b31,0x424dad9a,0x41eb0003,0xa53a9496,0xbdfbc63d,0xbdfbbe3c,0xaddbb61c,0xdedcad55,0xad99c5fa,0xcebdbe1b,0xb5fcc67d,0xb5bbb5db,0xb5dbb5db,0xb5bbb5db,0xb5dbb5db,0xb5bbb5bb,0xb5fcb5dc,0xb5dbb5fc,0xa57bad9a,0xa57bad9b,0x8c979d3a,
-0x94f9ad9b,0xa55b6b93,0x9d3aa53a,0x6bb47415,0xa55b8cb9,0xa55b9d3b,0xc61bad9b,0xd67bef3d,0xb559bdda,0xbd77ad37,0x4143cdb7,0x4a0628c1,0xce1ae6fb,0x9cb6debd,0x7c169cd7,0x8c9794d9,0x9d177bf6,0x94d973d5,0x94d99d19,0x74177c17,0x6bd66bd5,0x84789d5b,0x74168cda,0x94f994f9,0x3a705b74,0x3a4f7c78,0x6b96ad7b,0x73f65b35,0x95399d3b,0x741694f9,0x10639498,0x08005249,
-0x18431020,0x52d184b8,0x73f6be1e,0x84984291,0xde5c5311,0x4ab00002,0x94f97c17,0x849984b8,0x94f994d9,0x628b6353,0x6bd50064,0x94f942b1,0x0048b5fb,0xaddc6bf6,0x74359519,0x53128cf9,0x39888477,0x298910a4,0x8497953a,0x7c1494d8,0x28e24165,0x00002881,0x39233987,0x10401020,0x7bf573f6,0x8c77b59b,0xa59b194b,0x6b919cf8,0x31ca39eb,0x21272128,0x3a0c0004,0x7bd25b0f,
-0x5a245a23,0x5a446266,0x5a243901,0x626651e4,0x51e35205,0x28c051e3,0x62875a25,0x49c45a45,0x52055a46,0x49c43962,0x628749e4,0x49c449a3,0x49c33101,0x39423921,0x49a351c4,0x41414162,0x628549c2,0xacce30e0,0x9ba5abe9,0x5100a3a6,0x59205a45,0xf7df62a5,0xefffffff,0x7a04caa4,0x436e5160,0xde79f7df,0xfffff77d,0xa0e0ff9f,0xe7df0082,0xe6fdef3e,0xffdfd69b,0xe6dcad56,
-0xbe1aac32,0x93f1bdb6,0x18826a69,0x31e83a08,0x6b8f94f4,0xcebf4aee,0xce9dc67d,0xce9dc67d,0xce9dce9d,0xc63dadb9,0x73d394f8,0x843594b7,0x5310a539,0x63503a0c,0x9cd8a579,0xc63cad7a,0xbe1cbe3c,0xa538b5da,0xde7ae67a,0xad99ce9b,0xd6dcc63c,0xbdfcdefe,0xb5bbb5bb,0xb5dbad9a,0xb5dbb5db,0xb5bbb5db,0xb5dbb5ba,0xc65cbdfb,0xbdfcbe3b,0xa57bb5bb,0x9d19a57b,0x8cb88456,
-0xa57ba55a,0x94b852b0,0x8cf9a53a,0x9d1a9d5b,0x9d1a8c98,0x9d3a9d3b,0xc63cc61d,0xc5fbd67b,0xc5dbbdba,0x94759c77,0x3143c61a,0xd6171861,0xff7ff6bb,0xdebcb516,0x94d8ad38,0x73d49cf9,0x7c148c96,0x6b9373b3,0x8457a519,0x84b88478,0x73f68497,0x7c375b54,0x8cba5b14,0x5b338499,0x7c587c98,0x6bf663f7,0xad596373,0xd67d0024,0x8cd98cb8,0x429129ad,0x18857374,0x18401882,
-0x10001841,0x39ed7351,0xa53a52b1,0x94f794b8,0x52ad7bd4,0x422b1087,0x845794d8,0x6bd68cb8,0x7c168477,0x39455b32,0x9d3a0003,0x94f973f6,0x00658c96,0x94fa8c96,0x8cb984b9,0x52f2a57c,0x524b9cf9,0x528d18c4,0x73f68c97,0xad166bb4,0x18c23102,0x09291021,0x392494b4,0x10001820,0x7c360069,0x316952ad,0x6b720848,0x7bd4b5bb,0x843552af,0x39ca0024,0x6b914a6d,0x4a4d298a,
-0x5a6462a5,0x6ac65204,0x6ac77328,0x62a65a45,0x396149e2,0x28c03100,0x41803100,0x5a6741a2,0x5a266aa8,0x41635205,0x208049c4,0x51e53942,0x416241a4,0x41824963,0x49a349e3,0x6a844184,0x20805a23,0xe693c610,0xeed6f6b6,0xb3239b00,0xbbc83060,0xffff48c0,0xff7fffff,0x79a3ea63,0x3b0c51a1,0xf77eef5e,0xffffffdf,0xc160e7ff,0xa61b49a6,0xe6bce73e,0xac94cdb9,0xe69b7c35,
-0xb5b7cdb8,0x72cd8c31,0xb5767b8e,0xc5f76b6f,0x29a938e5,0xadbbad9a,0xc65ec67e,0xcedebe5d,0xbe5cc69d,0x8cb7addc,0x6373a57b,0x6bd5298c,0x741429cd,0xa53a2169,0xbe3da539,0xb5dbbdfc,0xbe1bc63c,0xbdd9b5db,0xc5f8e6fd,0xad79c63b,0xde9cb5db,0xbdfcd6bd,0xad9bb5bb,0xb5bbad9b,0xb5bbb5bb,0xb5dbbdfc,0xbdfbbddb,0xce7cbe3b,0xbdfbc65c,0xa53aad7a,0x94d9a55a,0x94d88c77,
-0xa55b8c98,0x94f94a90,0x8cf99d1a,0x63748cd9,0x9d3a94fa,0x9d3a9d3a,0xdefcad9a,0xbdb9c61a,0xb5bab579,0xa4f78c76,0x310494b6,0xc5552081,0xcdf9836e,0xc5da7350,0x9d18b599,0x7bf494b7,0x63718437,0x4a9073f4,0xa55aa578,0x8cb88c97,0x6bb58cb8,0x63745b33,0x8cb98479,0x53348cda,0x74178499,0x6bd66bf7,0x19287456,0xb5feb65f,0x10e710a7,0x8cb87c36,0x00007373,0x188220e4,
-0x10411862,0x5ab11862,0x18ea0007,0x6b7252b0,0x296b424f,0x10a673b3,0x5b100003,0x6b946b93,0x8c987c15,0x20c39518,0x639308a6,0x8cd87416,0x4a8e5b32,0x116c0003,0x95198cd9,0x7c777c78,0xc5d93a0e,0x000118a2,0x74160004,0x732f7bf6,0x20823123,0x64170024,0x30e494b7,0x182020a1,0x73b30843,0x4a6c7bb1,0x62f05aee,0x31885aef,0x3a0d0026,0x5ace9496,0x29289cd7,0x420b52ad,
-0x73086ae8,0x5a4672e8,0x5a676287,0x184030e1,0x31010800,0x49e45203,0x49a35204,0x5a465226,0x51e53942,0x49c43962,0x394228c0,0x49a45205,0x39614183,0x418349a1,0x9c889c6d,0xa465fffd,0xff7fff95,0xfffb7260,0xe6b3fff9,0x69a0fffe,0xb46bc321,0xffff71a1,0xfffeffff,0x8983e242,0x32aa6a22,0xf79eef7f,0xffffffff,0xb9a2fffe,0xd6bcff9f,0x9493bdb9,0x94f69432,0xd5d8c5d9,
-0x94117b2e,0x94117b6f,0xa515b575,0x8bb09cf4,0x5b2f6370,0xad7abe1c,0xbe1dc63d,0xbe3cbe3d,0xaddca57a,0xb5fca57a,0xadbbadbb,0x8cf89519,0x00048477,0xad7bb5dc,0xb5fc9d39,0xad9ab5db,0xc63cc61c,0xce3ad67c,0xdedbef1d,0xad9ace5c,0xc61bb5db,0xb5bbc63c,0xad9bb5bb,0xb5bbb5bb,0xb5dbadbb,0xbe1bbe1b,0xbe1bbdfb,0xce9dce7c,0xb5fbc65c,0xad7aadbb,0x9d18adbb,0xa57b94b8,
-0x4ab18cd8,0x8cb88457,0x953a9d1a,0x7416951a,0x9d3a8cb9,0x9d1b9d3a,0xce7bad7a,0xad59bdda,0xad79a518,0x94968c56,0x28e4a4f7,0x7b4e1840,0xc5da9cb5,0xbd99b518,0xa538c5fb,0x94d673b4,0x9cd67bf3,0xbddc8433,0x73f58414,0x8c98ad9b,0x73f68457,0x847863b5,0x74188499,0x639684b9,0x8cb98478,0x7c988cd9,0x94d85334,0x84b87458,0x7c165b96,0x004308c7,0x186439a8,0x104220e5,
-0x188220a3,0x28e520a3,0x83f6c5fa,0xad7c10eb,0x190a73f4,0x7c35214a,0x000118e6,0x63319496,0x73306330,0x28c3730c,0x7c3708c7,0xa57c9d3a,0x0087a57c,0x29cc6331,0x95196bd6,0x84988498,0x5a8d7c78,0x080220e4,0xa55a4a4d,0x72ab9497,0x08422923,0x84fa014b,0x8c328cb9,0x28a22060,0x29a91000,0x0004318a,0x41ec0003,0x7bd36b51,0x84967bf6,0x62cd1044,0x6b502969,0x10a78c35,
-0x396041a2,0x30e03940,0x10002080,0x28e03961,0x208028e0,0x394149c3,0x30e04162,0x49a34162,0x49c549a4,0x41634163,0x41643941,0x418441c5,0xfff98b8c,0xe65093e8,0xffddacc9,0xffbff655,0xff79ffbf,0x7200fd4f,0xe612ffdc,0xfffffffd,0xf75df5b0,0xffdf9a66,0xffdfffff,0x71e1ca02,0x4b8f6a02,0xffffefbe,0xffffffff,0xa941ffbc,0x734d9cb4,0xce1b6b90,0xce3bef3f,0xbdb8ad36,
-0xd61941e8,0x30e44967,0x41855a28,0x00c53144,0x94f75b70,0xbe3cce9e,0xc67dbe3c,0xbe5dc67d,0xb5fcbe3c,0xb5fcb5fb,0xadbba57a,0xa59badbb,0x94d8a5bc,0xa539a55a,0xbe1dbddc,0xb5bbb5bb,0xce7cc65d,0xd69bd6dc,0xe71df77d,0xbdbb9cd7,0xc63cc63b,0xb5bbbe1c,0xb5bbb5bb,0xadbbad9b,0xb5dbadbb,0xc63cb5db,0xc61bc61b,0xbdfbd69d,0xb5dac61c,0xa55aad7a,0xb579bddc,0xa57bad5a,
-0x6b948c77,0x8c7894d9,0x9d1b94fa,0x8cd99d1b,0x9d1a9d3b,0x9d1a9d1a,0xce3cad7a,0xc61bbdba,0xbdbabdfa,0x9cd79497,0x18827bf3,0x31050842,0x9434b4f6,0xb5998c13,0x8c96b5ba,0x94979cd9,0xa4d6ce3b,0x9c95b537,0xa53a9cf7,0x847731ee,0x74356bb4,0x6bb58477,0x8cd873f6,0x6bd68498,0x8cb97c37,0x7c787418,0x94f67457,0x8cda8479,0x53557c37,0x7c356bf5,0x3a8f39ea,0x10419cf7,
-0x10210000,0x18a31882,0xc5fa20c4,0x7bd4d6df,0x000918c7,0x84968c99,0x29465b11,0x8c330023,0x4a096b52,0x31045206,0x63930084,0x63748cf8,0x0004ad9b,0x106594fa,0x8cbab63e,0x6bd57c57,0x9cf68c97,0x18631882,0x10c82969,0x2904acf7,0x004320a2,0x84d82a70,0x9cd68478,0x28a22081,0x08251020,0x39ab6c15,0x84157393,0x2949318b,0x4a4d6b31,0x522b39aa,0x29694a0b,0x52ce2948,
-0x20601820,0x28a028a1,0x31013120,0x28c02080,0x5a455225,0x49a249e3,0x30e049a3,0x31014983,0x39433101,0x30e14183,0x41623942,0x9c2a49a4,0x9b4451c0,0x41607b24,0xfffee6d7,0xf656e5ce,0xfffdffdd,0xfffdfdaf,0xde57ffdb,0xffffffff,0xffffc36a,0xffffe532,0xffffffff,0x7200ca22,0x438e6222,0xff9effdf,0xffffffbf,0x9102f71b,0x4a08acf3,0x7bd2bdfa,0xa5169cf5,0x8b6fde3a,
-0x498793d1,0x30e4736e,0x21032882,0x2a0a1943,0xa5586391,0xa55a6b92,0xb5fbadbb,0xbe3cbe3d,0xbe1cbe3d,0xadbbb61c,0xadbba57a,0xadbbadbb,0x9d1ab5fc,0xad98ad7a,0xbe1cc65b,0xbdfbad79,0xe6fdce7c,0xf75eef5d,0xd69cf75d,0xbddba519,0xdeddc63b,0xb5fbc65c,0xb5bbb5bb,0xad9bad9b,0xbe1bbdfb,0xce7cb5bb,0xce9cce7c,0xbddbce7c,0xb5dabdfb,0xa55aa57a,0xb59ab5db,0xa55ab5ba,
-0x84979d39,0x94b973f6,0x9d1a9d1a,0x8cd99d1a,0x9d1a951a,0x9d1b9d1a,0xce3c9d19,0xd6bdce5c,0xb5babdfa,0x9cf79497,0x106339eb,0x21280002,0xbd5841aa,0xce1bb578,0x9cf8b579,0x94979cd9,0xad37b559,0xbdb8c5d8,0x8c768c55,0x4a718477,0x52f3a55c,0x8cf863b4,0x951c94fa,0x5b547c57,0x7c578478,0x7c376bd6,0x8cd58477,0x74166bb6,0x74178499,0x73b38cb8,0x6bd50005,0x1882ad58,
-0x080020e4,0x526a3145,0x000339a7,0x63958c98,0x002763b5,0x214b6bb5,0x19085b52,0x4a8d6330,0x41860001,0x31254986,0x31eb39e8,0x3a709d39,0x00478456,0x29298cda,0x63769d5c,0x74166bd5,0x73927c16,0x08021042,0x31ab4a2c,0x20a2628c,0x000228e3,0x6bf67457,0x6b737c59,0x28c320a2,0x00000800,0x630f5af0,0x1086318a,0x420c318a,0x4a4d39ab,0x186439ca,0x296839a9,0x528e1086,
-0x10203962,0x208028c1,0x20414164,0x39623942,0x49e35a46,0x39403960,0x41824142,0x28c03921,0x41a43101,0x41634163,0x41a23942,0x72826241,0x72c39366,0x6ac37ae2,0xf7586349,0xfffeff37,0xfefbef5c,0xa431b340,0xf77bd633,0xffffcdf5,0xffdf9921,0xffffff5c,0xff3bffff,0x61e3b981,0x4aeb69e2,0xffbff75e,0xffbeffff,0x9186e638,0x4a29c5b5,0x4a6cad57,0xb5b7a556,0xe5d87b2e,
-0x42291862,0x8baf2966,0x21436aaa,0x534f1163,0xa5788cf6,0xadbc52d0,0xb5db94d8,0xb61ca57a,0xb5fcb61c,0xadbcb5fc,0xa57a9d59,0xb5db9d39,0xa57bb5db,0xad7a9d19,0xce9db5bb,0xce7dbdfb,0xff7ddebc,0xf73df75d,0xd67ce6fc,0xb59abddc,0xd6bcce7c,0xbe1cc65b,0xb5bbb5bb,0xb5bbb5bb,0xc65cce9d,0xc65cbddb,0xd6bcce9c,0xc61cce7b,0xb5dabdfb,0xa55aa57a,0xad59b59a,0xad9abdfb,
-0x73f4a559,0x8cb98cb9,0x9d1a9cfa,0x953a9d1a,0x9d1a951a,0x9d1b9d1a,0xad599d1a,0xc63adedd,0xad59bdfa,0x94b6a4f8,0x10430844,0xb5fc0002,0x8bf20804,0xce1b9c94,0xa539bdda,0x9cf88c77,0x94949435,0xb576ce17,0x73d38c35,0x8cb894f9,0x00886373,0x5b556bd6,0x194a5313,0x53337416,0x84786bd5,0x94f98437,0x6bd15b31,0x7c588479,0x8cb97c37,0x0865a55a,0x6b9463b5,0x20c36b71,
-0x104162cb,0x00003986,0x18a539a7,0x6353190a,0x29ac94d9,0x63747bf6,0x7bf64290,0x73f30004,0x10847c36,0x28c41040,0x6b9118a3,0x320e4a6f,0x00066b93,0xb5dc7478,0x4290a5bb,0x63945b53,0x84357c17,0x18833126,0x73922928,0x28e35a49,0x00841861,0x7c589519,0x94f87cb8,0x28a228e3,0x00000800,0x630e1866,0x2128420b,0x39ab8434,0x39cb422c,0x18854a6d,0x296762ed,0x4a4d420c,
-0x394330e1,0x39424183,0x41624162,0x41613100,0x626430e0,0x49a26a44,0x49a34162,0x41834983,0x418349a4,0x52044183,0x5a005201,0x72a27b03,0x72e47ae4,0x83677ae5,0xfffc5241,0xfff7ffbc,0xfdacfe8f,0xc5707a85,0xc50f9b65,0xaa22ff99,0xf77dcefc,0xffddffdf,0xffdff71b,0x71e2eae5,0x640e59e2,0xffdeffff,0xff3cffff,0x9228c514,0x31269515,0x31679493,0x39c9528c,0x20c462ed,
-0x9cd552ad,0x5a08ad15,0x31657b2c,0x29687bf0,0xb5585b2f,0xadba7371,0x9d3aadbb,0xb61cadbb,0xb5fcb5fc,0xadbbb5dc,0x94f994d9,0xbe1ca59a,0x9cf9b5db,0xad9a8c97,0xbdfab5db,0xdedcce7c,0xf75def1d,0xef1cf75d,0xd67be6fc,0xc63ad6dd,0xd69be6fc,0xb5fbce5c,0xb5fbb5db,0xc65cbdfb,0xdefdd69c,0xd69cc63b,0xd69cc61a,0xc63bd67c,0xad79bdfb,0xb59bb5ba,0xbe1bb5db,0xbdfabe1b,
-0x73d69d39,0x84b9951a,0x9d1a953a,0x951a9d1a,0x9d1a951a,0x9d1a9d1a,0x9d1a9d1a,0xb59aa539,0xa559ad59,0x9cf5a539,0x10621883,0x6b932989,0x10438cb7,0xce7bfedf,0xbdface5b,0xa559b59a,0xad198436,0xbd97c5d9,0x73d49cb7,0x8cb67bf4,0x7c378c77,0x8cba320f,0x635473f5,0x7c770069,0x73b38496,0x5af16b32,0x8c985b12,0x741673f7,0xacf68c77,0x64370005,0x84b96bf7,0x10629496,
-0x08213144,0x39a71021,0x18e50000,0x6b9473f4,0x74177c56,0x7c5808eb,0x424f4290,0x19087bf4,0x62f194f6,0x20c4316a,0x10a41883,0x743452af,0x00878436,0x8cd88cba,0xa57b0004,0x8457ad7d,0x84378cb8,0x2042526b,0x84350001,0x20e241a7,0x19291883,0x6353218c,0xad9a216c,0x20c16b0d,0x00000800,0x18e70022,0x8c9531aa,0x296a31ab,0x18e831ab,0x29491065,0x18c631aa,0x4a71422e,
-0x41633962,0x49a341a3,0x51e44983,0x626551e3,0x62646aa6,0x62656a64,0x51e559e4,0x418351e5,0x49c44183,0x49e14182,0x7ae35a00,0x83057b04,0x72e57ae5,0x7b468367,0xf6d3d676,0xfeb9ff37,0xdccfff9e,0xa44b69a0,0xf7dffffd,0xff38ff32,0xfffff7ff,0xff9dffde,0xfffffffe,0x8140eb26,0x4bad4161,0xffdef7df,0xd514ffbe,0x79c7d5b8,0xa4524b0e,0x9cb420e6,0x9cf5630e,0x8c31e71d,
-0xc61a7c12,0x626a9c32,0x210551e8,0x73b1632e,0x104594d6,0xb5fc298a,0xadbcb5fc,0xadbbadbb,0xb5dcb5dc,0xadbbb5dc,0xad9b9d1a,0xb5bbadbb,0xa53aa57a,0xadbbad7b,0xbdb9b5db,0xef1de6dc,0xf73cf71d,0xff7ef75d,0xf79ef79e,0xef1cf77d,0xde7aff5e,0xbe1cdebd,0xc63cbdfb,0xce7cc61b,0xf79eef3d,0xe71ee71e,0xd69cce5b,0xc65bdebd,0xb5bac61c,0xb5dbad9a,0xce7cbdfa,0xc65bce9c,
-0x8cd8b5db,0x953b951a,0x94fa94fa,0x951a9d1b,0x9d1a951a,0x9d1a9d1a,0x94fa9d1a,0x9d3a9539,0xa5399cf9,0xad16b57a,0x10821020,0xb5daad78,0xa55aad99,0xef3d2022,0xd65cd67b,0x9d19bdda,0x9cd98498,0xc619c5d9,0x9cf8ad5a,0x6b748456,0x7c559d19,0x63758478,0x52b28cb7,0x7c597c77,0x0027006a,0x4a2d4a0c,0x7c353a0d,0x73b37c15,0x00029cb6,0x7c78322d,0x84577c37,0x20a38c55,
-0x104220c2,0x31469c94,0x31a820e4,0xc61f426f,0x743794d9,0xa59d84ba,0x52b08478,0x5b10212a,0x83f40043,0x00019494,0x5aed1022,0x843652cf,0x00466331,0x7c567c38,0x84770003,0x52d1192c,0x5af35312,0x2083a4f7,0x8c752082,0x20c25229,0x4a8f1043,0x6b948cb8,0x3a0e7c36,0x28c24a2b,0x00000800,0x63710022,0x39ea31eb,0x426f4a6f,0x63735b11,0x424d8435,0x10c852af,0x9d3939ec,
-0x41833101,0x51e449c5,0x6aa651c3,0x416072c6,0x62436244,0x626572a6,0x416249a3,0x41823941,0x49c349c3,0x49a03961,0x72e372e3,0x72c372e3,0x6ac46a83,0xe6d8ffdb,0xff9cffde,0xf75add92,0xe5f3f77b,0x3920aae1,0xbcceff59,0x7224e5d1,0xffffffff,0xf7bdffff,0xffffffff,0x71c3d9e2,0x11e64921,0xff9defbe,0xbcd4ee9a,0x6966bd97,0xa4927c74,0x08841043,0x18444a4a,0x10a449a8,
-0xb55673b0,0x62ec59e8,0x21056a8b,0x216718e5,0xa59a29a9,0xb61c4ad0,0xaddcb61c,0x9d5a8cf8,0xaddbadbb,0xad9badbc,0xa57aad9b,0xb5dcad9b,0xa55aa59a,0xaddba57a,0xc5dbb5db,0xef5eef3d,0xeedcf73d,0xff9eff9e,0xff7df75d,0xf77dff9e,0xeedcf75d,0xd69ddebc,0xce7cc63b,0xdebcd67c,0xff9df73d,0xe6fcf75d,0xd67bde9c,0xce7cde9c,0xc61bc63b,0xad98bdfa,0xdedcd69c,0xce3bce7b,
-0x9d39b5db,0x951a951a,0x94fa951a,0x951a951a,0x951a951a,0x951a951a,0x94fa94fa,0x94fa94fa,0xa5599519,0x628aad9a,0x10a31081,0xc61bad78,0xbddab599,0x71a552ef,0xc59aeefb,0x94d9ad59,0xa51994d9,0xdebbc61a,0xad79bd9a,0x9d197c15,0x52d18456,0x7c1694d7,0x424e73d4,0x9cf873b4,0xb579a539,0x08450002,0x83d36b72,0x4a0c2128,0x4ad10003,0x6bd77417,0x6bf57417,0x18a26b51,
-0x08201842,0x00225b31,0x00010822,0x4a6f8475,0x7c38424f,0x63758cba,0x3a2e8cd9,0x4ad06bb4,0x086773f6,0x316639e9,0x528b1022,0x94951085,0x0004422b,0x6bb37c17,0x845731c9,0xa53994b8,0x7c368c77,0x18a2296b,0x10412081,0x184218a2,0x10a70803,0x5b1173d4,0x4a6f316b,0x29037392,0x10001840,0x3a4d1061,0x21aa8cf7,0xb5db2149,0x5acf6b51,0x6331420c,0x52b052ae,0x31ac2109,
-0x49c451e5,0x51c251e4,0x51a151e1,0x59c16223,0x5a0359e2,0x49a16224,0x41624982,0x41614141,0x31203960,0x49a049c2,0x72c26a81,0x6a826ac2,0x628572c4,0xffda6285,0xffdede36,0xffbcffbd,0xee34ffbd,0xef3979a0,0xccccc550,0xbd12fffd,0xffffffff,0xfffeffff,0xffdfffff,0x5984e244,0x09c74102,0xe6baef9e,0xd5d8e67a,0xa34ebdd8,0xa4926b91,0x736e2905,0x93d06b0c,0x732c18a4,
-0x2905732d,0x6b0c7baf,0x5aec2945,0x29ca4a4a,0xaddb21ec,0xaddb8cd7,0xadfcae1c,0xa59ba59b,0xadbbad9b,0xa57badbb,0xa59aadbb,0xadbbadbb,0x9d5aadbb,0xaddbad9b,0xcdfbb5db,0xff9eff7d,0xf75df75d,0xef1cff9e,0xf73ceefb,0xffbeffbe,0xde9bffbe,0xe6fddedc,0xdebcdebc,0xe6bcdebc,0xff9df73d,0xef1df73d,0xd65bd69b,0xd65bdebc,0xd67cce3a,0xde9cc5d9,0xe6fcdedc,0xce3bce5b,
-0x9d1aad9b,0x951a951a,0x951a94fa,0x951a951a,0x951a951a,0x94fa951a,0x94fa94fa,0x94fa94fa,0xad7a9519,0x20a28475,0x10821061,0xdebcc659,0xce3ace19,0x3021d6fd,0xb599dd54,0x94baa4f9,0xa55a94f9,0xdebbd67b,0xad17c5db,0x6b5183f5,0x73b59cb7,0x63338c96,0x4a8f73b4,0x10870047,0x10c96b73,0x002573d4,0x00230065,0x3a4e0066,0x42b142d0,0x63b75334,0x6bd56395,0x20c37c14,
-0x08201021,0x632f6bb3,0x9cd40003,0x6b730864,0x8cb9426f,0x8cd97c57,0x8c9884b9,0x52f00888,0x73d610ea,0x2905420d,0x210620a3,0x5acd3147,0x21077bf1,0x8c347bb4,0x422e7390,0x10878c35,0x843652d0,0x62cd7bf5,0x102028c2,0x20a03124,0x5ad00823,0x10c9296b,0x194a1909,0x42086331,0x10202061,0x00430820,0x4b3163f5,0x318b322d,0x00040005,0x29296b50,0x9cf98434,0x8c767bf5,
-0xff796ac9,0x72c5d5d1,0x62235a03,0x5a246263,0x59e272e7,0x494151c1,0x39414161,0x39413920,0x41a13940,0x49a04981,0x72a36a80,0x6aa46aa3,0x73066264,0x5a8672e6,0xfffcef5a,0xcd90fef9,0xee36ee76,0xcced92c3,0xc407f5f1,0x284048a0,0xffffffff,0xffffffff,0xffdfffff,0x5963c8c1,0x00a03902,0xe6fac679,0xacb5bc92,0x8a8b83b0,0x9c7232ed,0x83cf0800,0x51c96aab,0x30a56b2e,
-0x522a1001,0x20a341a7,0x42094229,0xbdb92106,0xa5bb2a0c,0xb5dc94f9,0xaddbaddb,0x9d3ba5bb,0xa59bad9b,0xa59ba59b,0xadbba59a,0xad9badbb,0xa57aadbb,0xb5dbaddb,0xce5bbdfb,0xf75dee9c,0xff9ef71c,0xf77dffff,0xff9ef75d,0xff5eef1c,0xd63aee9a,0xe6dccdfa,0xe6fcef1c,0xef1de6fc,0xff9ef73c,0xeefdf73d,0xde9cd65c,0xde7be6dc,0xe6fcde9b,0xcdf9c5b8,0xeefdde9b,0xc63bd65c,
-0x951a9d3a,0x951a951a,0x94fa951a,0x94fa951a,0x951a94fa,0x8cfa94fa,0x94fa8cfa,0x94fa94fa,0xa5598cfa,0x1820ad99,0x630b1860,0xf73cff5d,0xe71ce6db,0xe75fef3d,0xd5f92803,0x94fa9cf8,0xb57a94da,0xe6ddde9c,0xce5bd65b,0x94b6ad79,0x4a2f7bb4,0x73d36332,0x00055b32,0x428f3a6f,0x7c374a91,0x63328c56,0x7c55428e,0x63944ab0,0x08eb5353,0x5b545333,0x218d7c76,0x28c34a4d,
-0x10205269,0x6b94424c,0x08230883,0x630f0843,0x424fa55b,0x52d37c37,0x63536bf8,0x00a884b9,0x94b873b5,0x7b904a90,0x18e520c5,0x086310a4,0x29673188,0x00030845,0x8434b599,0x7bf48455,0x7bf410a7,0x5aaf73d4,0x20a128c2,0x28e03103,0x94d90002,0x7bf40087,0x004973f5,0x73904290,0x10401861,0x08210800,0xa59b5332,0x7c567c77,0x216b29ad,0x212718c5,0x5af0318a,0x18e84a4d,
-0x9c4893ca,0x4120abe6,0x5a035a03,0x83485a24,0x51a272c6,0x49414120,0x39204140,0x39414141,0x41a13120,0x520141c1,0x62835a40,0x7b2762a4,0x62a47b48,0x7b8b4162,0xde97d6b6,0xe79df612,0xe570ff7c,0xe571d40a,0x8ae3a365,0x4121fe53,0xddb5f654,0xffbfff9e,0xff5eff9e,0x6103b123,0x00a130c1,0xff3cd679,0x49e9cd56,0x69c89cb6,0x4a4b0062,0x082059e8,0x31050800,0x628b8c51,
-0x20e52083,0x39875aab,0x8c94632d,0x8c548412,0xadba8cf7,0xa55ab5bb,0xaddbaddb,0x951aa5bb,0xa59badbb,0xad9ba59b,0xad9ba59a,0xadbbad9b,0xad9aadbb,0xbe3cbe3c,0xce3bbe1b,0xf73cde3b,0xffbeff5d,0xff9effff,0xf73cff7d,0xde9bf73c,0xc5b9c5b9,0xe6dcce3b,0xef1def1d,0xf75def3c,0xff7dff7d,0xe6fcf71c,0xe6dcde9c,0xde7ae6dc,0xdebbde7a,0xc5d9de9b,0xde7cd63b,0xc61bce3b,
-0x951a94d8,0x951a951a,0x94fa951a,0x94fa94fa,0x8cfa8cfa,0x8cfa8cfa,0x94fa8cfa,0x94f99d1a,0xc63c9d19,0x1820f7bf,0xf77d2081,0xff7dff9e,0xff7eef1c,0xb598e6dc,0x20a57393,0x9cf9a539,0xb57994d9,0xe6dccdf9,0xce3ade9b,0xa4f7a4d6,0x83f58415,0x424f6353,0x63b531ee,0x9d3a6394,0x6bd410ea,0x74150887,0x320d21ac,0x5312322f,0x5b547c78,0x4ad221ad,0x74176bd5,0x28c352ad,
-0x08002924,0x8cb931ca,0x39ca2128,0x08433167,0x7c1673b2,0x73d43a2e,0x42708c97,0x6bf74af3,0x52b10027,0x6b2f73b4,0x9cd60843,0x0002632f,0x002318c5,0x31cb0887,0x10c773b3,0x214b424d,0x73d473f4,0x739318e8,0x310341a6,0x290228e2,0x110a0003,0x426e7c36,0x52f252d0,0x9cd76394,0x10201881,0x08401020,0xaddd3a2e,0x84b66c16,0x74149d5a,0x00433a2a,0x212910a6,0x6b925af0,
-0xfed359c0,0x82616a00,0x51c251e2,0x6a8672a8,0x59c36264,0xb4ae3080,0x41613900,0x31003940,0x39404181,0x418041a1,0x6ae55a61,0x6ae662a5,0x49e15a65,0x7b891000,0xfefae73a,0xf6b7f77d,0xddd2ff7b,0xab43e632,0x8a20cc8c,0xf7df7265,0xee54f75c,0xff5ee71b,0xeefbf73d,0x60c388c2,0x10c22060,0xb431f75d,0xce5a72ac,0x61e76a2a,0x9d580908,0x8c3193ae,0x41a63966,0x188273ef,
-0x00011001,0x004118e3,0x4a4b6b6f,0x216a8434,0x9d187c75,0x9d39ad9a,0xa5bbadbb,0x953aa59b,0xa57ba55a,0xa57ba59b,0xad9ba59a,0xadbbad9b,0xbdfbadbb,0xc65cd6bd,0xc63bbe1a,0xf75df6dd,0xffbeff9e,0xf71cffbe,0xff7df75d,0xce5af75d,0xb57abd9a,0xde9ad69c,0xf75de6fc,0xf77df75c,0xff7dff7d,0xde9bf71c,0xe6fcdebc,0xd5f8e6fb,0xe71bee9b,0xbd78de7a,0xc5b9c5b9,0xad58c5fa,
-0x951aa55a,0x8cf9951a,0x94fa8cf9,0x94fa94fa,0x8cfa8cfa,0x8cfa8cfa,0x94fa8cfa,0x9d39a57a,0xce7ca57a,0x1800ffff,0xf7be30a3,0xff7dff7d,0xf71cef1c,0xd619de5a,0x0824851a,0xa53ab579,0xbddaad9b,0xc597d619,0xde7be69b,0x9496d63b,0x73937bf4,0x298c6332,0x5b955333,0x00496376,0x42714a71,0x5b53216c,0x63943ab0,0x63b5320f,0x74175b73,0x639529ce,0x6bf64292,0x28c25aee,
-0x18611041,0x84371927,0x10846b73,0x31a7632e,0x73b70001,0x4a9031cf,0x00266b31,0x7c778498,0x08688457,0x00016353,0x31891063,0x8c7431aa,0x11070043,0x7c354ab0,0x635229ab,0x5b530004,0x10a74a6e,0x10887c15,0x28e37baf,0x106028c2,0x5b9410e7,0x424e6bd4,0x73f50067,0x83f58498,0x08002903,0x08000800,0x6bd60003,0x74365b54,0x429029ae,0x31cc08a7,0x422d0003,0x298a296a,
-0 };
@@ -1,1052 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT const unsigned int
-#endif
-
-A32BIT Face1[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x00000100,		/* dwHeight */
-0x00000100,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00010013,		/* dwpfFlags */
-0x00020000,		/* dwDataSize */
-0x00000010,		/* dwBitCount */
-0x0000f800,		/* dwRBitMask */
-0x000007e0,		/* dwGBitMask */
-0x0000001f,		/* dwBBitMask */
-0x00000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x4a0841c6,0x31453966,0x20e42945,0x39a73186,0x294539c7,0x6b2e5aec,0x736c736d,0x52073165,0xc58cb52e,0x18611040,0x396530e4,0x29032924,0x188120e3,0x20a120e2,0x20e31020,0x20e320c2,0x29242904,0x29442965,0x20e318c2,0x314518a3,0x41c83166,0x31461062,0x29243145,0x28c32903,0x29033984,0x310328c2,0x080020c3,0x41e62103,0x396541e7,0x10201860,0x10600820,0x20c218a1,
-0x290320c2,0x31452923,0x31852924,0x39a63984,0x39853985,0x31453144,0x31653165,0x21023184,0x39a43142,0x39642902,0x20803963,0x398549a6,0x29233985,0x290220e2,0x20c120e2,0x29023123,0x396449e6,0x396418a1,0x28e120a1,0x28e120a0,0x29012080,0x08003964,0x00200000,0x52696b4d,0x29663987,0x08822145,0x212520e4,0x08203186,0x18a320e3,0x52ab0000,0x52ab424a,0x188218e2,
-0x10000800,0x39642902,0x10601880,0x08003964,0x08001040,0x28c10820,0x62cc49e7,0x62cc6aed,0x83b06aed,0x945283d0,0xa4b49473,0x838f9c53,0x732e8bf0,0x5aac6b0d,0x5acc6b4e,0x526b52ab,0x29455aaa,0x00001041,0x00000000,0x00000000,0x00000000,0x21240841,0x00000841,0x08000000,0x10001000,0x52053963,0x184028c0,0x62cb5a48,0x8bd07b8e,0x83b07b8f,0x186162ab,0x31041000,
-0x6b2c6b0c,0x18216b6d,0x28c23083,0x49c73103,0x6a8a5a49,0x28623924,0x18421821,0x20c320a3,0x394620a3,0x6aec5a2a,0x6acc734e,0x5b0c5aab,0x00001042,0x628a4986,0x6b4d6acb,0x83f0736e,0x7baf8c10,0x734e6aec,0x00005acb,0x00000000,0x00000000,0x00000000,0x20e30000,0x08000000,0x00000840,0x394241c4,0x28a04121,0x31004982,0x49c349a4,0x49c349c3,0x20c049c3,0x20c028e0,
-0x52694a28,0x42085269,0x318639c7,0x39a739a7,0x31662945,0x10612925,0x18820000,0x28e13123,0x316120c0,0x312428c2,0x41653924,0x39655a49,0x186128c3,0x18811881,0x31243124,0x21043144,0x21032944,0x290420e3,0x41e720e3,0x734d736d,0x3166630c,0x18c32925,0x29043166,0x30c32082,0x28e228c1,0x20c33123,0x31652904,0x000041a7,0x41a620c2,0x29223144,0x208020e2,0x10811040,
-0x28e21040,0x28e220c2,0x292320e2,0x39853143,0x31443985,0x31653965,0x39853986,0x39c53164,0x20c120c1,0x31643984,0x29233984,0x41c63984,0x31433123,0x31233123,0x20c220c1,0x20e220e2,0x31441860,0x312320e2,0x28e13943,0x41843123,0x39833963,0x10413122,0x18810000,0x41e7630c,0x212539e8,0x21042125,0x21042925,0x29452904,0x29242945,0x084218c3,0x3a280000,0x00000000,
-0x20a10800,0x18a028e1,0x20e20820,0x082020c1,0x080018a1,0x08001020,0x6acc4a08,0x62ec736f,0x83f0732e,0x83d08c11,0x94739c73,0x94319473,0x83af7b4e,0x5aab732d,0x4aab5acc,0x41e85acb,0x18a35acb,0x00000000,0x31860020,0x08414a69,0x00000000,0x00000000,0x00000000,0x39850000,0x41433922,0x30e04162,0x206030e0,0x62cc6b2b,0x83d07bcf,0x8c116b0d,0x28a362ab,0x734d49e8,
-0x943183cf,0x49a749a7,0x5a2930c3,0x62ab6aeb,0x838e6b2d,0x39455228,0x20c341c7,0x314528e4,0x734d62cb,0x6b0c6b2d,0x732d62ab,0x00005a8a,0x29240000,0x626a5a8a,0x7baf6acc,0x8c1183f0,0x738e7bcf,0x00000020,0x00000000,0x00000000,0x00000000,0x08201061,0x08204a08,0x08000000,0x08000000,0x39014163,0x392228c0,0x5a254983,0x51e451e4,0x186041a4,0x41831860,0x39823962,
-0x00000820,0x21040000,0x316641e8,0x39a73166,0x39c839a7,0x41e74208,0x39a72945,0x62aa5289,0x18602923,0x52492903,0x736e6b4d,0x734d736d,0x314462ca,0x290349e7,0x20c21020,0x290328e3,0x28e21040,0x290220e2,0x21042924,0x83ef630c,0x6b2c738e,0x738e738e,0x62eb62eb,0x31043985,0x28a228c3,0x29241881,0x290541e8,0x736e3167,0x104018c2,0x28e32903,0x39643985,0x5aaa3985,
-0x29033123,0x20e220c2,0x10202080,0x20a020a0,0x39853102,0x39a63965,0x41c73986,0x31653985,0x398441c6,0x314328e2,0x31432923,0x41c620c1,0x31643985,0x41a52923,0x29032923,0x31443123,0x28e22903,0x39653985,0x08003944,0x31222081,0x49c549e5,0x39a53943,0x00000820,0x18c339c7,0x31862104,0x10822945,0x18a218c3,0x21042945,0x10821082,0x10410000,0x18a12944,0x08000000,
-0x10600800,0x086020e2,0x29230000,0x18811060,0x080018a1,0x20c20820,0x6acc4a07,0x732e734e,0x83d06b0d,0xa4f483d0,0x94529432,0x94328bf1,0x83af7b6e,0x72ed7b8f,0x314662cc,0x524a41c8,0x000018c3,0x18c318e3,0x10a23186,0x00000000,0x00000000,0x00000000,0x00000000,0x20400800,0x41606ac8,0x18002040,0x28c02080,0x62ec6b0c,0x83f0736e,0x7baf83f0,0x62ab3186,0x7b6e6acb,
-0x62297b4e,0x62aa38e5,0x62cb7b4d,0x6b0c630b,0x736d6b2d,0x526983ef,0x83f06b4d,0x83f062ec,0x62cb6b0c,0x7bae62ec,0x6b0c734d,0x00003145,0x5acb0000,0x730d6aec,0x8c1083af,0x632c6b8e,0x086131a6,0x210410a2,0x00000000,0x00000000,0x08000800,0x10010800,0x000041e8,0x08401000,0x10000000,0x39202040,0x51e430c0,0x28c049c4,0x392120a0,0x39413921,0x31403140,0x28e028e0,
-0x41e50820,0x29035aa9,0x29042924,0x29053125,0x21043986,0x31652924,0x29453165,0x41e83165,0x31862925,0x6b2d39a7,0x738e7bcf,0x736e7b8e,0x39866b2d,0x29242904,0x10202944,0x31641881,0x29232923,0x18a23165,0x210220e1,0x4a490000,0x39c6630c,0x08200000,0x738d41c7,0x62eb62eb,0x39453986,0x31242904,0x39a73145,0x41e8736e,0x39663987,0x29032103,0x31233124,0x49e63144,
-0x290349e7,0x316441e6,0x39853164,0x312341c5,0x28e128e1,0x39653964,0x39c739a7,0x316539c7,0x314320c1,0x29023123,0x4a0618a0,0x28e23144,0x39643986,0x39a441a5,0x396520e2,0x392320a1,0x396428c2,0x41a63985,0x20e239a6,0x31023943,0x41e63943,0x39a43984,0x084020e2,0x20e439a6,0x41e82125,0x21042945,0x210418a3,0x210420e3,0x000020e4,0x10621061,0x292318c2,0x08000820,
-0x186120c2,0x290320e1,0x49e60820,0x08002902,0x00001040,0x20c218c1,0x62cb20e3,0x7b4e734e,0x7b6e7b4e,0x94527b8f,0x94329c93,0x8bf08c31,0x94519c52,0x732d83af,0x5a4a62cc,0x4a495a6a,0x4a285acb,0x41e83186,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x51c35a05,0x41403920,0x392128c0,0x182028c0,0x62ec28a2,0x7b8f83d0,0x630d7baf,0x736e20e4,0x628b730d,
-0x5a4a4186,0x8bf0732d,0x7b6e8c10,0x734d7b8e,0x6b2c8c10,0x736d6b4d,0x736e6b4d,0x62cb6b2d,0x6b0c6b2d,0x6b0c6b2c,0x6b2c62ec,0x00000840,0x62eb0820,0x7b8e734d,0x736e736e,0x00204228,0x08410020,0x528a6b4d,0x00000000,0x18420800,0x08001021,0x18820800,0x00004a29,0x080020c2,0x08200001,0x28e020e0,0x28e03100,0x10002080,0x312028a0,0x28e028e0,0x31413100,0x28c03121,
-0x184049e6,0x10600000,0x41c66b2b,0x41e639a6,0x4208734c,0x29243165,0x31663165,0x31863186,0x18c33145,0x4a2820e4,0x7bcf7bd0,0x62cb83f0,0x39862924,0x41e62904,0x28e31881,0x08001881,0x08000000,0x08000800,0x08000840,0x08600820,0x00000000,0x08201821,0x21030800,0x632c630c,0x5228736d,0x29042904,0x5a8a2925,0x29253166,0x290639a7,0x20c220e4,0x31642903,0x29033143,
-0x29232902,0x29033144,0x39643123,0x31023985,0x41843122,0x312420c0,0x39a639a6,0x318639a6,0x39a63165,0x20e149e6,0x29013164,0x39842901,0x39443984,0x39643102,0x39a63964,0x20404185,0x41843123,0x398541c6,0x39a539c6,0x28c130e2,0x31643943,0x31633143,0x000041e6,0x18c40000,0x212518e4,0x18c32945,0x210420e3,0x18c318a2,0x10822945,0x20c30841,0x00000840,0x08200820,
-0x18801060,0x100049e6,0x31431000,0x18801020,0x00000800,0x10402102,0x732d20c2,0x83af83d0,0x6aec7b8f,0x8bf1734e,0x8c317bb0,0x94528c11,0x94319c72,0x8c118bf0,0x6aec732d,0x6b2d6acc,0x4a28630c,0x62ec5269,0x00000000,0x00000000,0x00000000,0x00000000,0x39420800,0x49a15a23,0x39002880,0x30c04161,0x18402060,0x526a1000,0x84107baf,0x5acb6b4d,0x7baf5acb,0x732d734e,
-0x5acb738e,0x94927baf,0x734d8410,0x6b0c734d,0x62eb6b0c,0x62eb5aaa,0x41e75aaa,0x62eb41e8,0x62ec62cb,0x62ec5a8a,0x39a66b0c,0x10000800,0x62cb28c3,0x83ef8bf0,0x5acb630c,0x31a6630c,0x4a490841,0x000039c7,0x08000000,0x30a31000,0x39454146,0x41c841a8,0x080020e4,0x08201000,0x20800800,0x28c020a0,0x41823100,0x39213121,0x30e03101,0x28c02080,0x28e03121,0x28e020a0,
-0x30e23944,0x4a072922,0x39843123,0x312328e2,0x52aa3985,0x41e7630c,0x20e42924,0x31452104,0x31653145,0x18c22903,0x634d3186,0x21045aeb,0x29452945,0x20c22924,0x316541c7,0x20e33165,0x08001060,0x20e33164,0x210318a2,0x29030800,0x20c339a6,0x20821882,0x08412944,0x630b528a,0x62cb62cb,0x29033144,0x5aaa4a07,0x31463146,0x314639c7,0x28e418a4,0x31452905,0x316439a5,
-0x39852903,0x29443165,0x18c13163,0x31222922,0x20c020c0,0x39643122,0x39c63986,0x39a639a6,0x5aaa4a28,0x290241c7,0x208128c2,0x31423102,0x41e520e1,0x39843164,0x39433123,0x28e13943,0x39641860,0x39a639c5,0x20e22923,0x398518a1,0x29433164,0x18a12922,0x084020e2,0x20a320c3,0x210418a3,0x210539a7,0x10411061,0x20e420c3,0x20e42925,0x20e42924,0x39a50800,0x20c20800,
-0x314320c2,0x080020e1,0x28c220c1,0x18411020,0x00001881,0x28e23164,0x6b0c3165,0x8bf083af,0x7b6e83af,0x7b4e83b0,0x94329c52,0x9c529c53,0x9c738c11,0x7b6f9431,0x838f7b6e,0x7c107b8f,0x4a496b6d,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x31202080,0x49604981,0x41413920,0x30c04960,0x18404163,0x7b8f1821,0x7bd083d0,0x2945734e,0x630c5aab,0x8bf06b2d,
-0x6b4d736e,0x7bcf738e,0x520862ec,0x528a62ab,0x42083186,0x18c25269,0x20c30000,0x6b0c5a8a,0x62cb5aaa,0x5a6a62cb,0x100020a3,0x31051821,0x6b2d62cb,0x6b2d736e,0x21244a49,0x00000000,0x00000000,0x00000000,0x18211061,0x62ac5a49,0x49e95a8b,0x49c8522a,0x10400800,0x00200000,0x28e01000,0x31213120,0x396328e0,0x28c028a0,0x28a01000,0x392128e0,0x31223941,0x28c028a0,
-0x20c141a5,0x10402922,0x18801020,0x10201060,0x290328e2,0x4a2849e7,0x18c320e4,0x20c318a2,0x104120e3,0x290418a2,0x214520c3,0x29653186,0x29242124,0x39862945,0x39a62903,0x28e32924,0x28e32903,0x6b2c6b0b,0x5269736d,0x08402924,0x290418a2,0x18823124,0x294518c2,0x318520e3,0x41c71041,0x29032924,0x52692924,0x292528e4,0x6b2e632d,0x528a2946,0x31663146,0x31433144,
-0x41a53144,0x39a641e6,0x398539a5,0x39842923,0x29013984,0x28c020c0,0x29443985,0x21043165,0x29242924,0x31643965,0x20803943,0x18803964,0x314220e0,0x396441c5,0x39433964,0x208028e1,0x31233944,0x29232922,0x39a53164,0x18812943,0x29231880,0x29031881,0x20c218a1,0x31461061,0x18a30841,0x10832945,0x292420c3,0x292420c3,0x10822945,0x00000820,0x10600820,0x10600840,
-0x29221020,0x08002922,0x186020e1,0x18602080,0x106020c1,0x00001881,0x83af5a8a,0x8c11838f,0x732d83d0,0x7b6f83d0,0x94329432,0xa4938c11,0x9c939c93,0x8bf09432,0x734e8c11,0x84319451,0x00004208,0x00000000,0x00000000,0x00000000,0x00000000,0x49431000,0x41403900,0x49816244,0x39003900,0x20a03900,0x18201020,0x7b8f28a3,0x7bcf7baf,0x18a362ec,0x6b4e4a29,0x83d08c51,
-0x630c526a,0x52495acb,0x10001021,0x10820800,0x292418c3,0x08402945,0x62ca2904,0x5aaa5aab,0x5a6a62ab,0x52295a6a,0x49c74a08,0x6acc5208,0x7bae7b4d,0x0820630c,0x00000000,0x00000000,0x00200000,0x00000020,0x52090800,0x6b2e6aed,0x4a2962cc,0x49e849e9,0x08200820,0x00000000,0x31205225,0x28c028e1,0x31013962,0x20802060,0x28a01820,0x310028e0,0x20a03942,0x28c028c0,
-0x294383ee,0x10401860,0x10201040,0x104020a1,0x18600800,0x210420c2,0x20e420e3,0x08000821,0x20a31041,0x29243144,0x18e30841,0x212418c3,0x31652945,0x31453165,0x398518a2,0x312439a6,0x31245a69,0x52693185,0x5aaa4a28,0x39a641e7,0x6b0c62eb,0x186141c7,0x39a620e3,0x18c218a2,0x41c72903,0x29033124,0x080039a6,0x20e42905,0x6b2e6b6e,0x5aec7b8f,0x31455acb,0x39a53144,
-0x39853123,0x39a53164,0x31443144,0x31443165,0x39633164,0x39423122,0x318639a5,0x292439a6,0x31653165,0x31643986,0x39433123,0x39844184,0x18a018a0,0x49e63144,0x31223143,0x31021840,0x39644164,0x29432921,0x398520e2,0x31442903,0x29243985,0x290418c2,0x29042924,0x29051041,0x29052105,0x292518c3,0x188218a2,0x18c318a2,0x000018c3,0x10630820,0x20c10000,0x106020e1,
-0x39830000,0x10201060,0x10002922,0x100028c1,0x10600800,0x102018a2,0x7b8e6aeb,0x94529411,0x94529c72,0xa4b49c53,0x9c73a4b4,0x83b09452,0x9c729c52,0x83af7b6e,0x7b6e8bd0,0x52aa83cf,0x00000000,0x00000000,0x00000000,0x00000000,0x18010000,0x51e228a0,0x49603900,0x49814120,0x30e049a1,0x314220a0,0x10010800,0x7baf49c7,0x6b4e7baf,0x31460841,0x630d524a,0x528a5b0c,
-0x31a73186,0x20822945,0x28c31000,0x62ec62cb,0x62eb630c,0x00006b4c,0x5a890000,0x62cb5aab,0x6acc6acb,0x62cb626a,0x6b2c62ab,0x5a4a6b0c,0x6b4c732d,0x10815aca,0x00000000,0x00000000,0x00000841,0x00200000,0x6acd1861,0x734e6b2e,0x524a62ac,0x28e45a6b,0x00001882,0x00000000,0x290028e0,0x20a01860,0x20603121,0x31002080,0x28c03942,0x20a03121,0x39611020,0x28c028c0,
-0x20a32924,0x08000800,0x10600800,0x20e11880,0x188120c1,0x20a21040,0x21033124,0x20c22923,0x00002903,0x08000000,0x18a21082,0x212418e3,0x18c22124,0x31642123,0x18c120e2,0x29032923,0x31642903,0x31443165,0x31642944,0x29242903,0x6b2c41e7,0x41c7736d,0x39853145,0x31242903,0x31442924,0x292441e6,0x31452903,0x29042924,0x738e3165,0x632d736e,0x31665aec,0x29243165,
-0x31443144,0x39853964,0x31443164,0x31443985,0x20801881,0x314228c1,0x41c641a5,0x41c64207,0x29033144,0x39a63985,0x41643102,0x316428c1,0x28e23985,0x10601020,0x20a020c1,0x184028e1,0x28c11020,0x210220e2,0x18c13144,0x39a62923,0x10814a07,0x10812924,0x20c41082,0x18a318a3,0x294518a3,0x292520e4,0x210418c3,0x21042104,0x00000000,0x08620000,0x20e10000,0x08402902,
-0x00000000,0x08001040,0x20c020a1,0x28e11840,0x52481840,0x39860820,0x7b6f6b2c,0xa4d48c11,0x94739cb4,0x9cb49c93,0x9c939c93,0xa4f49c73,0x83f09cb3,0x7bb07b8f,0x736f9452,0x10a2526a,0x21030000,0x08201881,0x00000000,0x08000800,0x49631800,0x41206204,0x5a0359e3,0x41405181,0x390149a4,0x10202880,0x20820000,0x7b8e732c,0x5a8b734d,0x398728e5,0x39c720c4,0x5acb0841,
-0x00005acb,0x4a084a69,0x7b8e49c7,0x524962eb,0x4289526a,0x18000000,0x62293083,0x6aab5a29,0x72ec6aab,0x6acc6acb,0x6aec6aec,0x738e7b6e,0x6b2c630c,0x00000820,0x00000000,0x00000000,0x00000000,0x10210000,0x6b2d5aaa,0x5a8c5a8b,0x62cd41c9,0x29246b0d,0x000020c3,0x29020000,0x20a03101,0x28e028c0,0x39222080,0x28a03100,0x20601820,0x20602041,0x394120a0,0x28c03941,
-0x10410800,0x08001040,0x20e10800,0x18812923,0x290328e2,0x29033964,0x10202903,0x106120a2,0x29040000,0x31452944,0x00000820,0x18a118a1,0x31853164,0x29443185,0x29223144,0x29032902,0x31652923,0x31443164,0x31443144,0x39a63185,0x39a62923,0x41a66b4c,0x20613124,0x28e320a2,0x00003144,0x31442903,0x20c318a2,0x29231060,0x42082944,0x5aab4a09,0x39a7528a,0x31653165,
-0x39853164,0x31643985,0x31643164,0x31443164,0x28c128e2,0x18602080,0x41c62923,0x316439a6,0x29442903,0x31852923,0x39443102,0x39a63103,0x29033965,0x20c128e3,0x31022902,0x28e120a0,0x10201860,0x21022903,0x20c20840,0x39a71881,0x41e862ab,0x00000000,0x106218a3,0x188318a3,0x18c320e4,0x20e42104,0x316520e4,0x292518c3,0x18c31082,0x002118c3,0x31430820,0x18c118a1,
-0x08001060,0x10200840,0x20c03943,0x08001860,0x10611840,0x29240000,0x7baf5269,0x9c939c93,0x7bf09493,0x945283f1,0xa4d49c93,0x94b3a4d4,0x83f18c51,0x7bd083f0,0x52ab7bd0,0x00000000,0x18a20000,0x08000800,0x00000000,0x20001800,0x414151c3,0x51e251a2,0x51a14120,0x38e059e3,0x5a4830e2,0x184028a1,0x28620800,0x83af83ae,0x730d7b8e,0x6acc49e8,0x738e39a7,0x6b6d52aa,
-0x00000841,0x4a280000,0x5a8a5a8a,0x52295a8a,0x18001862,0x59e83904,0x838e730c,0x730d836e,0x730d7b2d,0x732d732d,0x734d732d,0x736e734d,0x08415acb,0x00000000,0x00000000,0x00000841,0x00000000,0x838e4125,0x7b8f7b6e,0x6aed7b6f,0x7b906b0e,0x31446b2c,0x08000000,0x20601040,0x39013901,0x28c128c0,0x31212060,0x39213962,0x30e230e1,0x31011000,0x41843941,0x5a884a05,
-0x10000800,0x00000800,0x10601061,0x080041e5,0x10000800,0x39653103,0x31443965,0x31443165,0x29032903,0x20811840,0x29243144,0x18a21040,0x292320c2,0x29233164,0x29032923,0x31442923,0x29033985,0x39643123,0x31443123,0x41c639c5,0x31442943,0x39453124,0x28e23104,0x31232081,0x31443124,0x29033965,0x39850000,0x10401020,0x314418a2,0x20e43165,0x39863125,0x29243186,
-0x29432943,0x31643964,0x39a541c6,0x31443985,0x39a53964,0x10602942,0x000020a0,0x39643985,0x29032923,0x20c22923,0x31442923,0x31653123,0x31642944,0x18a120e2,0x20c220c2,0x20c21881,0x208128a2,0x10400800,0x080020e2,0x20c30820,0x00000861,0x10622965,0x108218c3,0x08411082,0x084220e4,0x20e41083,0x18c420c4,0x10422905,0x18a318a3,0x10421083,0x10400000,0x104039a5,
-0x08000800,0x28c10820,0x186030c1,0x31020800,0x20a11840,0x39850800,0x8bf02904,0x8c3183f0,0x8c328c32,0x8c528432,0x8c529473,0x8c529cb4,0x738f7bd0,0x83f07baf,0x00006b4d,0x00001061,0x00000000,0x00000000,0x08000800,0x28c11800,0x38e051a3,0x62245182,0x49614960,0x30c030c0,0x52483123,0x20003985,0x72ac1820,0x83d07b6e,0x6b0c736e,0x83ef736e,0x5acb6b4d,0x10a20020,
-0x18a20000,0x62ec3145,0x62cb6b4d,0x10001841,0x390530c4,0x730d626a,0x8bf09c72,0x94109431,0x83cf83cf,0x736e7b8e,0x738e736d,0x736e736d,0x08000000,0x00000000,0x00000000,0x00000000,0x20820800,0x8c30736d,0x7bf07baf,0x6b6e632d,0x5aec6b6e,0x18a239a7,0x08200000,0x31023102,0x628849c5,0x520528c1,0x52264184,0x30c05a27,0x38e13901,0x5a2649a5,0x52475a67,0x732b62ca,
-0x41a52881,0x00000800,0x10400800,0x28e220a0,0x31232081,0x28e23102,0x21033944,0x28e339a5,0x39653965,0x20e33144,0x31653144,0x316539a5,0x080020e2,0x29232902,0x28e22102,0x20e220a1,0x39853144,0x28e21040,0x39843964,0x39852923,0x5a8939a5,0x41654186,0x31244185,0x31233924,0x39853144,0x29033144,0x31442923,0x20c23144,0x08001881,0x29032923,0x318520e2,0x29442924,
-0x31633164,0x39643964,0x39852903,0x290341e6,0x39a641e6,0x31633184,0x10403983,0x41a51020,0x29233165,0x292320e2,0x31233964,0x21032923,0x31642903,0x10602924,0x10402102,0x10401060,0x20812081,0x104028e3,0x20c20820,0x20c32103,0x18c32124,0x10622104,0x18c30841,0x00211082,0x20c42905,0x18a318c3,0x18c42104,0x18a418a3,0x18e418a4,0x10620842,0x08200820,0x188041a5,
-0x00000820,0x31020820,0x186028a0,0x28c11860,0x18401840,0x39a641a5,0x83d041a7,0x83f07bd0,0x7bb0738f,0x7bd0736f,0x845273b0,0x7c108432,0x738f6b8f,0x6b4f6b6e,0x10a139c7,0x00001061,0x00000000,0x08000000,0x18200800,0x5a4630c1,0x59c34120,0x622472c7,0x59e44982,0x39023920,0x62ca30e2,0x2001628a,0x838e4987,0x7b8f736d,0x736e83af,0x6b0c9451,0x2925528a,0x08200820,
-0x00000840,0x5acb528a,0x49c75acb,0x28422042,0x5a6a2883,0x9410732d,0x83cf8c10,0x9c729451,0x8bf09c72,0x6b0c734d,0x5acb6b2c,0x0000630c,0x00200000,0x10200000,0x10401861,0x10000800,0x7b6e3946,0x840f8c31,0x4229a4f4,0x62ed6b4e,0x4229528b,0x39a60841,0x18811082,0x62ca41c6,0x39855248,0x6aea62c9,0x62c949e6,0x39433943,0x5a4728e1,0x730b732b,0x734c7b6c,0x41c6736c,
-0x28e23964,0x08001020,0x29031881,0x08002923,0x102041a5,0x314320a1,0x31643143,0x39643165,0x39663964,0x31653185,0x31652904,0x21242944,0x210318e3,0x31443165,0x396539a5,0x31643124,0x31442903,0x31633164,0x41a53123,0x39a539a5,0x41a539a5,0x49c639a5,0x31033964,0x28a228a2,0x31033944,0x31442923,0x20e220c2,0x31443144,0x312420c2,0x18601881,0x20e320c2,0x39a539a5,
-0x18a03164,0x20e13123,0x31232921,0x41a639a6,0x41a641c6,0x31433965,0x29022922,0x39631860,0x29033184,0x39a520e3,0x29234a48,0x290320c2,0x20e320c3,0x20e220c2,0x39a60800,0x20e33164,0x20a228e3,0x29031881,0x290420c3,0x18a31882,0x21042904,0x20a20020,0x080020a2,0x00000000,0x00000000,0x20e41062,0x20e41883,0x086218a3,0x08621062,0x10820021,0x30c11000,0x18803943,
-0x10201041,0x10200000,0x10201860,0x28e11860,0x10201860,0x18402080,0x734e20c2,0x83d183f1,0x734f734f,0x7bd07bb0,0x73f18411,0x6b8f6baf,0x632e6b6f,0x20c35acc,0x10201020,0x10610800,0x00001040,0x00000000,0x41222020,0x41004983,0x51a33080,0x5a026224,0x28a03900,0x31033901,0x6b0c5a8a,0x49a74966,0x8c1172ec,0x7b8f83af,0x7b8e7b6e,0x5aaa6b0c,0x10413165,0x18a220c3,
-0x00001841,0x5a8a62cb,0x100041a7,0x72cb38c4,0xacf49c10,0x94319c72,0x83cf8bf0,0x94319431,0x83cf9410,0x6b2d730d,0x08006b0c,0x18200000,0x00200000,0x28c31061,0x18a120c2,0x000028c2,0x738e738e,0x18c38c51,0x08220000,0x31674a4a,0x296739e8,0x42080841,0x524820e2,0x49e649c6,0x6b0b5a69,0x6b0b62ca,0x7b2c4985,0x7bae6289,0x8c307bae,0x83ee8c30,0x628a5aa9,0x39645a47,
-0x4a07732c,0x312428e3,0x28e32903,0x39653144,0x20811881,0x28e22080,0x29023103,0x31433143,0x39663964,0x20e33165,0x29242924,0x29442945,0x29242944,0x210220e2,0x312320e2,0x31233164,0x39643985,0x31433984,0x31433123,0x41e63984,0x39853964,0x41853984,0x418541a5,0x31033924,0x39643944,0x20e22903,0x31233964,0x31441881,0x31243144,0x18813965,0x292320a1,0x31443144,
-0x29023164,0x29010800,0x20c13143,0x41a63984,0x41e741a6,0x29433965,0x39642923,0x08002902,0x398539a5,0x20e320e2,0x210320e3,0x292420e3,0x290320e3,0x29032903,0x290320e2,0x20e241c6,0x31243124,0x20e32903,0x18a218a2,0x18a21041,0x20e41062,0x290420e3,0x29041020,0x21042924,0x080020e3,0x00000000,0x104218a3,0x00010000,0x08620000,0x10621083,0x414320a2,0x39a420a0,
-0x20e01020,0x08000820,0x31034184,0x10201840,0x186020a0,0x184028c1,0x62cc1841,0x83f1734e,0x736f6b4e,0x84117bb0,0x5b0e6b6f,0x4aac5b4e,0x4a6a4a8c,0x292139a6,0x10202901,0x18811020,0x08000800,0x10001841,0x49832040,0x39206247,0x49a23922,0x30c04182,0x41613120,0x20823902,0x5a4a626a,0x6acb3925,0x8c118c10,0x7b6e9452,0x62ab62ec,0x5a8a6b0c,0x41a720a3,0x41655208,
-0x08003104,0x10211041,0x5a491882,0xa4738bf0,0xa4d4acf5,0x7b6e7b6e,0x8bf08c10,0x94318c10,0x6b0c83af,0x734d62cb,0x000018a3,0x10400800,0x08000000,0x20e228e2,0x18a128e2,0x420820a2,0x7bcf736e,0x08003186,0x10820000,0x000018e4,0x296618c3,0x00000000,0x6b2c20e3,0x62a9732b,0x4a0641c5,0x39442902,0x10406aea,0x840f83ad,0x83ce9c91,0x52488c2f,0x28c25268,0x41643923,
-0x83cf83cf,0x2925526a,0x290328e3,0x52492903,0x28c23165,0x208028e2,0x18601860,0x20e10820,0x49e71060,0x31243965,0x18a23144,0x21242103,0x29032924,0x20c22923,0x29033124,0x29221881,0x29013142,0x29023983,0x31633143,0x31213942,0x39633983,0x39654184,0x41a549c6,0x39643124,0x31233944,0x208149c6,0x31443944,0x18203124,0x31443103,0x28e33985,0x10202903,0x31031860,
-0x39443124,0x28c11840,0x290220e1,0x312420c1,0x39854a07,0x29033144,0x20c220e2,0x28e31861,0x4a0720c2,0x290439a6,0x31654a08,0x31441061,0x20e33165,0x4a074207,0x18a12924,0x08402903,0x104020e2,0x20c21061,0x31453145,0x188220e4,0x10622924,0x18822925,0x39863144,0x41c63144,0x20e33165,0x314620e4,0x29253186,0x21052104,0x08210020,0x18832125,0x28e220a2,0x31233123,
-0x292218a1,0x10002080,0x20a049e5,0x10003124,0x20612082,0x18612082,0x52491861,0x732e7b6f,0x8c127bb1,0x737083b1,0x4acd52cd,0x08a331e9,0x39830000,0x416241c4,0x082028c1,0x10000800,0x28611800,0x30e11840,0x41413080,0x208038e1,0x414228a0,0x102028e0,0x28c128a1,0x72eb28a2,0x5a2928a3,0x6b0d732d,0x734e8bd0,0x180149a8,0x5a8a49c8,0x52295a6a,0x6b0c41a7,0x5a8a62cb,
-0x4a2862cb,0x62ab5aab,0x8c11732d,0xa4f48c31,0x7b8f9473,0x83d0736e,0x7b8f8c31,0x6b0d7baf,0x7b8e7b4d,0x62eb730d,0x28c21020,0x080028c1,0x28c21840,0x31231840,0x20c220a2,0x7bcf20e3,0x734d83f0,0x20c32945,0x5aaa18a2,0x082020e4,0x106220e4,0x00000000,0x632b4207,0x10407bae,0x18601861,0x39a51880,0x7b8d2923,0x18a262ea,0x6b0b5aa9,0x39a52103,0x41a641c6,0x410361a6,
-0x7bad6b2c,0x7b8d7bae,0x31443985,0x39853165,0x41854a28,0x20a12903,0x29023943,0x20e11880,0x20a21060,0x39865269,0x20c22924,0x29442944,0x20e22944,0x28e32923,0x31233144,0x29023143,0x290220c1,0x18a02921,0x39843143,0x41a43963,0x28e13122,0x39643122,0x49e649c5,0x39643124,0x39443123,0x39444185,0x292328c2,0x20a15a48,0x18a13123,0x29033124,0x394420c2,0x39643123,
-0x182020a1,0x31231840,0x18811020,0x29032923,0x29032903,0x312439a6,0x20e33124,0x10203124,0x41c61081,0x294441c7,0x18a23165,0x082039a6,0x082020c3,0x41c73145,0x29032924,0x18a12923,0x29032903,0x29042924,0x20e420e4,0x10811041,0x20c31040,0x29243986,0x31652904,0x20e33165,0x29041882,0x31662945,0x29452945,0x29253165,0x18e42145,0x20e42925,0x39231860,0x28c13943,
-0x20c141a5,0x18401040,0x18802901,0x10001000,0x20611840,0x08001840,0x62ab3965,0x6b0e732e,0x7b917bb1,0x6b707b91,0x5b0e52cd,0x00001925,0x39633141,0x39424183,0x10201840,0x10000800,0x30c21000,0x30e04163,0x41204121,0x28a038c0,0x28c028a0,0x08001020,0x18402081,0x7b6d62aa,0x6aec6acb,0x7b8f734e,0x39056aec,0x5a094926,0x62ab6acc,0x28e45229,0x6aec6aec,0x5a8a5a6a,
-0x6b0c5aaa,0x6aec62cb,0x94726b0c,0x9452a4f4,0x83cf8bf1,0x8c319452,0x6aec7baf,0x83d07baf,0x734d8bf0,0x1882734d,0x312383ce,0x28c21000,0x20a130e3,0x20811020,0x20c21861,0x6b2d6b2c,0x528a6b2d,0x082041e8,0x29250000,0x18c318a2,0x000039a6,0x00000000,0x10801881,0x08200000,0x188020c1,0x5aaa3163,0x104039a6,0x52893144,0x39c63144,0x39657b8d,0x6a8a5228,0x93ae6228,
-0x18a139a5,0x41e62943,0x314441a6,0x31653986,0x4a283185,0x4185630c,0x29223123,0x39642902,0x41a63143,0x52896b2c,0x290320c3,0x41e752aa,0x290339a6,0x29031040,0x20a11861,0x20a228e2,0x314420a2,0x398539a6,0x39a53143,0x49e649e6,0x31413964,0x310228c0,0x39643101,0x39444185,0x41853944,0x41853103,0x39643964,0x208128c2,0x290328e2,0x31443144,0x312328e3,0x39444185,
-0x41853964,0x51e75207,0x080041a6,0x52481861,0x20c23965,0x5a693144,0x31442903,0x20c23144,0x736d5aa9,0x316539a6,0x29243165,0x29043145,0x00001882,0x104120e3,0x20c218a2,0x29032924,0x20c220a2,0x29043145,0x20c320c3,0x398620c3,0x29252924,0x31653986,0x31452924,0x29242924,0x292418a2,0x31872946,0x29452925,0x20e42925,0x21042145,0x20e418e4,0x49c51861,0x28c13102,
-0x18803143,0x18612080,0x31011860,0x10001841,0x18401000,0x290328c1,0x83cf3986,0x8bf19453,0x7bb183f2,0x7bd18c12,0x632e5b0e,0x20c10000,0x498251a5,0x49c44162,0x080028c1,0x20600800,0x41632040,0x39003100,0x51a26a44,0x310130a0,0x20a02060,0x00000001,0x00000820,0x8c117bae,0x734d83cf,0x6b0d734e,0x736d62ab,0x7b0d7b4d,0x6b0c732e,0x6b0c62ab,0x6aec6aec,0x62ab628a,
-0x6aec62cb,0x6aec5aab,0x8c11734d,0x7b8f9472,0x7b6e732e,0x83d08bf0,0x734e8bf0,0x83f083af,0x08417bcf,0x6b2c0000,0x310328c2,0x310328e2,0x28c228e2,0x20811020,0x7b6d28e3,0x08205aab,0x39a64a49,0x31654a28,0x108218a2,0x210418a3,0x00003165,0x00000000,0x18802902,0x080018c1,0x422618c0,0x52897bce,0x630b5248,0x6b0b5aaa,0x18813985,0x28a22081,0x93af72eb,0xd5f7ddf8,
-0x522641c5,0x31433985,0x31643164,0x39a63986,0x39a63145,0x41c64a28,0x5a8939a6,0x290239a5,0x106020c1,0x18601860,0x20c23123,0x08200820,0x18610820,0xb55441e7,0x39855aa9,0x31232923,0x20c12902,0x396420e2,0x31643143,0x310328e2,0x31023103,0x39632901,0x312328e1,0x41843964,0x31234184,0x524828c2,0x20e25a89,0x312341c6,0x20a128e2,0x314420a1,0x31033164,0x41a63124,
-0x39853964,0x41a63164,0x31444a07,0x398520e3,0x39245a89,0x6b0b28c2,0x41c75aaa,0x62ca5aaa,0x6b4d39a6,0x39c641e7,0x31653185,0x29033104,0x106120a2,0x18a22903,0x20c320c2,0x314518a2,0x20e32903,0x29452945,0x20e32924,0x20a32945,0x314520c4,0x29453145,0x29453186,0x20e32904,0x31653986,0x39a63186,0x31653186,0x20e32104,0x21252945,0x18c418c3,0x4a062924,0x20813142,
-0x28c03943,0x29031060,0x41641040,0x28e22080,0x10001020,0x180028c2,0x8c101000,0x9c73a4f5,0x7b909453,0x73b183d1,0x526c52cd,0x39420820,0x49c44183,0x498449c4,0x08001020,0x18401820,0x30e04983,0x628428e0,0x41207ae6,0x28a038e0,0x084128e0,0x18c20000,0x000020e3,0x83cf630c,0x83cf83f0,0x8bd083af,0x7b4d832e,0x8baf93f0,0x6aec7b4e,0x732d734d,0x62cb62cb,0x6b0c734d,
-0x5a8b62cb,0x734d526a,0x8c116b0d,0x83d08c31,0x945283d0,0x84108c11,0x7baf83f0,0x736e8c30,0x18a210a3,0x20811881,0x31233103,0x41653103,0x18202082,0x28c21861,0x6b0c62cb,0x18810800,0x528a1081,0x2925840f,0x080018a3,0x29442904,0x002018e3,0x18810000,0x396428e2,0x18a018c0,0x10602922,0x41c64a07,0x4a696b0b,0x20a262ca,0x41a62903,0x8bae6269,0xde188bcf,0xbd55d5f8,
-0x18403101,0x30e12060,0x28c128e2,0x39863165,0x41c739a6,0x31653986,0x31452923,0x62ca5a8a,0x18613965,0x18601860,0x28e23144,0x18801880,0x100020c0,0x20e21860,0x29441881,0x314439a6,0x314420c2,0x314339a5,0x316428e2,0x39643964,0x39633943,0x394328e1,0x39643122,0x394328e2,0x31233103,0x28c130e2,0x31235a68,0x31233964,0x28e23144,0x28e23103,0x31443123,0x20e26b0b,
-0x31442903,0x49e73144,0x39853165,0x188120e3,0x39243965,0x39c63123,0x62eb4a28,0x316562eb,0x312420c3,0x31652924,0x39852945,0x31243145,0x39862903,0x29043144,0x39a62903,0x29242904,0x31441041,0x29452924,0x21043165,0x20e418a3,0x31452905,0x316528e4,0x31863165,0x31653986,0x080020c3,0x294520e3,0x31663186,0x29253166,0x29453186,0x10832104,0x312320a2,0x080020c0,
-0x28e13123,0x080018a0,0x49e51861,0x28e22080,0x28c12060,0x10002080,0x8bf01020,0x9c94a4d5,0x94549c74,0x7bf29453,0x20c44a8c,0x49a34142,0x49e451e4,0x51a34183,0x18402880,0x39422060,0x28c03922,0x72e749c3,0x41616a64,0x29235aea,0x18e32103,0x20e32103,0x000020c3,0x83cf7bcf,0x83ef8c10,0x83af8c31,0x93f0836e,0xa492a472,0x8c109411,0x6aec730d,0x7b8e6aec,0x6b0c6b0c,
-0x62ec6aec,0x83af6b2d,0x7b8f9452,0x7bb08c31,0x9cd39c93,0x738f736e,0x7baf83f0,0x08414208,0x20c118e2,0x31031860,0x39443103,0x208228c2,0x20822081,0x310420a2,0x20e318a2,0x000020c2,0x52891081,0x1862630c,0x20e318a3,0x316520c3,0x000020e3,0x20c20000,0x10602903,0x080018a0,0x08000801,0x08201060,0x290241e6,0x10202081,0x734c62aa,0x732d62cc,0xde5ac5d7,0xa4d3cdf7,
-0x208028c0,0x28a028c0,0x418349a5,0x28c13122,0x28e228c1,0x20e22944,0x39663165,0x62ec3125,0x20613945,0x18401860,0x312318a0,0x31643964,0x29023144,0x18a11060,0x18811040,0x28e328e2,0x29033985,0x294320c1,0x292320c2,0x31443965,0x31633985,0x31233164,0x39444164,0x39643123,0x31023122,0x418528e1,0x39443102,0x314428e2,0x39643123,0x31442903,0x41c63144,0x41a63965,
-0x39a53985,0x31443165,0x31243965,0x31041881,0x31233103,0x28e23123,0x31443985,0x31241020,0x312428c2,0x20e320e3,0x29042904,0x41c720e3,0x31453124,0x29243165,0x10823145,0x294520e3,0x29041882,0x39862924,0x18a32904,0x18a32904,0x31852945,0x318518c3,0x31852924,0x316639a6,0x20e318a2,0x31453986,0x31663986,0x31453166,0x31863986,0x21252945,0x20a018a1,0x31033102,
-0x29013102,0x28e23184,0x39630800,0x310220a0,0x18202060,0x20401820,0x730e1000,0xad16a4d5,0xa4f5a515,0x73719d14,0x41643125,0x41a449a4,0x51c449c4,0x30a04983,0x186041a4,0x31224164,0x41422060,0x310062a7,0x18802900,0x212418c3,0x188210a2,0x18c320e3,0x18c32924,0x6b0d41c8,0x83af8c11,0x8bf18bf0,0x9c529431,0x9c93a493,0x83d08c31,0x62cc7b8e,0x83af83af,0x734e732d,
-0x62cc6b2d,0x734e6b0d,0x9c729c72,0x8c3183d0,0x738e9452,0x6b4e6b4d,0x08200821,0x314420e4,0x31441881,0x290220a1,0x20c12902,0x180128e2,0x20822062,0x73ae3145,0x396541c6,0x08000020,0x10012083,0x6b4d30e4,0x0820630c,0x29240000,0x000018a2,0x10200840,0x00002081,0x08000800,0x10001821,0x186020a0,0x10603145,0x4a073124,0x8bf06acb,0xc5d76b0c,0xcdf8d639,0x8c0fad34,
-0x28e128e1,0x18401000,0x416428c0,0x49c53964,0x28e23942,0x292320c2,0x41e73986,0x31663145,0x28c25a8a,0x18822924,0x18a020c2,0x20c120e1,0x39842922,0x20c22902,0x290320c2,0x186120a1,0x08000800,0x31440800,0x29032903,0x312328e2,0x39a541a5,0x39643143,0x28e23103,0x31023123,0x28c128e1,0x394328c0,0x39443943,0x31643964,0x31432903,0x39653123,0x39853144,0x49e720c2,
-0x29033144,0x41c63124,0x292441a6,0x30e32903,0x394430e3,0x31233965,0x39853123,0x31443165,0x31033103,0x21032904,0x31453145,0x39863986,0x31653124,0x31663144,0x39a63186,0x31860820,0x08403145,0x29043165,0x20c30800,0x18a320c3,0x31852105,0x10612103,0x29442944,0x29252104,0x314520c3,0x39863145,0x41e83166,0x31663166,0x316641c7,0x20e43186,0x28e12924,0x41a530e2,
-0x4a073964,0x18602922,0x31012060,0x208028a0,0x18402080,0x18002060,0x31062060,0xbd77acf5,0xa4d5b556,0x4187a4b5,0x41834183,0x5a4641a3,0x5a055a67,0x416228c0,0x522649a4,0x20a049c4,0x5a872900,0x18814a46,0x20e420e4,0x18e310a2,0x10820861,0x18a31082,0x39a620e4,0x83d04a09,0x734e7baf,0x9c5283b0,0xa4f4a4b3,0x94729cd3,0x7b8f7b8f,0x83d07baf,0x7b6e8bf0,0x83d07b8e,
-0x736e6b0c,0x83f0736e,0x94529452,0x7bcf9451,0x738e8410,0x0000632d,0x21041082,0x20e21062,0x188120a1,0x28e220a1,0x20c228e2,0x206220a2,0x630b28e3,0x41a68c10,0x100020e3,0x49c72882,0x52086b0c,0x841083af,0x00000000,0x18610820,0x08000800,0x00000800,0x18600800,0x31231020,0x31022080,0x10601000,0x5a895228,0x39853144,0x83cf732c,0xbdb6b596,0xad55bdd7,0x6b6d9491,
-0x840f736d,0x4a489cd3,0x10000800,0x31021840,0x310249a4,0x28a23102,0x4a293924,0x4a2841c7,0x39a641e8,0x29043986,0x18812903,0x20e120e1,0x20a02922,0x188128e1,0x20e22903,0x29032944,0x08000820,0x31241861,0x28e241c7,0x28e22903,0x31442923,0x396420c2,0x39432902,0x39643944,0x28e13122,0x39234185,0x28c13102,0x39433943,0x39853943,0x396539a6,0x31653985,0x398541e6,
-0x31643144,0x318539a6,0x39653145,0x31032904,0x39643964,0x39243944,0x41a64185,0x31243164,0x20a128e2,0x292528e3,0x29253145,0x29243166,0x20c32924,0x29453165,0x39a739a7,0x31652104,0x18a339a7,0x314420e3,0x20a320a3,0x294520c3,0x29662125,0x292410a2,0x296520e3,0x29452945,0x39c72104,0x318639a6,0x41e73145,0x398639a6,0x294539a7,0x31662905,0x28e23965,0x39442080,
-0x39643102,0x29223143,0x28c139a4,0x30e12080,0x28c13943,0x18004184,0x392528c1,0xb5979c93,0x9cd4ad56,0x732ea4d3,0x49c54184,0x49c449c5,0x39015205,0x41a438e1,0x41636ae9,0x28e03921,0x18e218c0,0x082118a3,0x20e318c3,0x108218c3,0x18821062,0x10621062,0x398620c3,0x7b8e734d,0x732d6b0d,0x94526b4d,0x8c529472,0x7baf83f0,0x7b8e7b8f,0x7b8f7b8f,0x83af83d0,0x7b4e7b6e,
-0x7b8f6aec,0x8c317b6e,0x945183af,0x62ec8c11,0x188220e4,0x20c30800,0x62ec3166,0x106120c2,0x20a220e3,0x28e320c2,0x28e320c2,0x000020a2,0x734c6b0c,0x000020c2,0x39041000,0x7b8f1882,0x62ab7b6e,0x18a2734d,0x294418c3,0x00002944,0x102041c6,0x08001040,0x28a12080,0x310228e2,0x28c21000,0x524930e2,0x418662eb,0x31254166,0x8c316b0c,0xad559cf3,0x5aaab576,0x738d5acb,
-0x62eb5aaa,0x94717bae,0x9450c5f7,0x312383cd,0x10403102,0x10400800,0x314520a2,0x39a628e4,0x39a74a29,0x31653985,0x29242923,0x31643164,0x39853184,0x290339a5,0x18a21040,0x31855a89,0x29232903,0x00000800,0x29037b6d,0x186020e2,0x20c220a1,0x290220c2,0x39442902,0x31233103,0x28e028e2,0x310220a0,0x39833963,0x20803923,0x39853123,0x31652902,0x41e73144,0x39a54a07,
-0x29233185,0x20e33144,0x312420c3,0x30e33145,0x39444185,0x31033944,0x39653944,0x31443165,0x20613924,0x29043124,0x39862904,0x31453165,0x10612904,0x29242924,0x31652925,0x20e43165,0x29252945,0x31453986,0x31662925,0x29252904,0x18e42125,0x18a22124,0x31653165,0x212418c3,0x29453166,0x29042945,0x39863986,0x41c739a6,0x39c741c7,0x316739c7,0x31233144,0x49e61020,
-0x31031860,0x10202901,0x39222902,0x30e12080,0x184028a0,0x20601840,0x41662080,0xa51583f1,0xa5169cf5,0xa4f5ad36,0x418441c5,0x5a4649c4,0x184049e5,0x6ae851e5,0x28e03962,0x314328e0,0x20e31881,0x294520e3,0x10821061,0x18a220c3,0x188220e4,0x20a31061,0x314520a3,0x6b2d734d,0x62cc6aec,0x7bcf738e,0x7bd07bcf,0x734d738f,0x734e736e,0x736e9431,0x83d08bd0,0x7b4e732d,
-0x7b8f83af,0x83f08bd0,0x94319431,0x080041e8,0x29240820,0x18a218a2,0x6b2c7bae,0x20c318a2,0x20c220a2,0x29032903,0x20c320c2,0x290420c3,0x20a2628a,0x08001000,0x28c24145,0x390551c7,0x8bf08bf0,0x20e42904,0x20e30841,0x18c33965,0x08004a07,0x31241881,0x312328e2,0x5a894a07,0x398541c6,0x41c65248,0x5a8a39a6,0x52493124,0x84505aeb,0x0000a514,0x42085269,0x5aaa41e7,
-0x42084a28,0x52694a48,0x4a2739a6,0x4a074a07,0x528941c6,0x5aca8c50,0x398639c6,0x5a8a39a6,0x39a76b0c,0x39853145,0x31442924,0x20e32924,0x31a61881,0x29232944,0x31643144,0x104020c2,0x39852923,0x10403144,0x104028e3,0x312320e2,0x188120a1,0x292320e2,0x31033163,0x41843102,0x39633963,0x312228e1,0x28e12901,0x418541a5,0x31431020,0x31243163,0x29032903,0x31652924,
-0x21033985,0x29033165,0x39653145,0x31243145,0x41a541a5,0x31034165,0x39653103,0x312441a6,0x31034165,0x41a73103,0x39863166,0x39a641c7,0x39862904,0x31860800,0x31863166,0x292420e3,0x42082945,0x31453145,0x20e32104,0x294520e4,0x18e42125,0x20e310a2,0x00001081,0x31860000,0x39a62104,0x31652945,0x316539a6,0x314541e7,0x39a73145,0x31662925,0x41a53165,0x31020800,
-0x41853943,0x18a02922,0x416341e5,0x39223101,0x180030e1,0x18204165,0x626a2080,0x9cd48c11,0x7bd094b4,0xa4d57bf1,0x49c6b574,0x49c45204,0x41843122,0x41825a67,0x28c03100,0x08201880,0x18c31882,0x08410820,0x082118c3,0x29451082,0x20c31082,0x20a31061,0x526a3145,0x736e7baf,0x6b2d6b0c,0x62cc736e,0x7b8f738e,0x736e8c31,0x83af6b2d,0x83d0736e,0x730d9431,0x6aec6b0d,
-0x83d083af,0x83d083d0,0x7b8f83f0,0x18410000,0x292420a2,0x29032103,0x108218a2,0x20e32903,0x20a220c2,0x20c228e3,0x312428e3,0x30e449e7,0x100028a2,0x20411800,0x30e330e3,0x9c938c0f,0x94319c72,0x08413125,0x10411082,0x29241861,0x080020a1,0x62eb28e3,0x5aaa41e7,0x5aca5269,0x524962eb,0x736d62cb,0x734d83ef,0x29255269,0x73ef7c10,0x4a697bcf,0x294539a6,0x420739c6,
-0x52694a49,0x5acb5aaa,0x52495a89,0x41a641a6,0x290341c6,0x62cb5a89,0x6b4c7bae,0x5a6941e7,0x28e32904,0x31442903,0x39863165,0x31653985,0x29443145,0x396520e3,0x18803165,0x000020c2,0x29241882,0x08001041,0x20c32904,0x52690000,0x20822904,0x290328e3,0x292420c2,0x18a03984,0x31233164,0x31433984,0x29022923,0x31432922,0x31433964,0x314339a4,0x31233144,0x39842903,
-0x39853164,0x20c12902,0x28e228e1,0x31244165,0x41c641c6,0x41a63144,0x29033144,0x396541a6,0x41a63965,0x41e73985,0x41e741c7,0x296641e8,0x39863186,0x084020c3,0x29252104,0x29253186,0x21042104,0x18c32924,0x210418c4,0x18a31062,0x18e418a3,0x08401903,0x18a22923,0x292518a2,0x292518a3,0x31863146,0x29022925,0x49e73924,0x184141a6,0x39a63186,0x29023966,0x20c11060,
-0x20c11860,0x310120a0,0x28e13101,0x310120a0,0x182020a1,0x10003102,0x5a491820,0x84319452,0x6b6e738f,0x6b6e6b8f,0x4a488451,0x4a0541e5,0x5a470800,0x39235206,0x08200800,0x318518a2,0x00000800,0x20e318c3,0x08000821,0x4a281882,0x20c320a2,0x20a30800,0x8bf03966,0x736e9452,0x62ec736e,0x734e6b4e,0x7b8f8c31,0x62ec7bb0,0x83d0734d,0x7b8f9c92,0x62cc838f,0x7b6e6b0d,
-0x8c108c11,0x83d08c31,0x18637b8f,0x20a21062,0x28e31040,0x188220c3,0x20e420c3,0x6b0b2944,0x20c320c3,0x188220a2,0x290428e3,0x000028e3,0x08000000,0x39243965,0x6b0c5207,0xa4d38c31,0x00009492,0x20c318a2,0x292420e3,0x20c23185,0x20c120c1,0x31442903,0x6b2c2903,0x630b840f,0x18a25248,0x5aaa3965,0x7bcf4a49,0xb575630c,0x31864208,0x42084a29,0x21033185,0x00000000,
-0x39c73186,0x52695269,0x52695249,0x396541a6,0x42073144,0x394441e6,0x314520a1,0x6aeb5269,0x290462aa,0x29033144,0x31652904,0x41c73986,0x20c23145,0x396541c6,0x31233124,0x10403123,0x08200000,0x4a085249,0x104120c3,0x08200800,0x28c33144,0x20c23103,0x10413144,0x39852903,0x31643143,0x31233164,0x31642902,0x31642902,0x39643984,0x31443964,0x290339a5,0x39853123,
-0x31653985,0x18a13143,0x310228c0,0x31643102,0x29432903,0x41a63164,0x31243144,0x20c220c2,0x29242903,0x294528e2,0x318639a6,0x31863166,0x18e431a7,0x18e23187,0x316618c3,0x29253166,0x21042104,0x39a618a2,0x10822925,0x18a318a3,0x210420e4,0x20e210a2,0x08401081,0x18830841,0x31662104,0x29453186,0x29223145,0x62a71000,0x310430e3,0x31852104,0x08003145,0x10401060,
-0x29010800,0x39833121,0x29013942,0x18603101,0x28a128c2,0x204028c1,0x62ab3923,0x84117bb0,0x632d632d,0x294673af,0x10a20001,0x18a152a9,0x41850000,0x41a549c5,0x002018a1,0x00000000,0x10821082,0x18c32104,0x316518a2,0x290418a2,0x28e41841,0x49e83105,0x94516b0c,0x7baf8c11,0x6b2d6b2d,0x7b8f6b2d,0x734e6b4e,0x736e62ac,0x8c118c11,0x736e7b8f,0x7b6e7b6e,0x94318c11,
-0x8c119451,0x736e8c11,0x5aac736e,0x20c27b8e,0x20c31881,0x20a220c3,0x106241c7,0x106120e3,0x20c320c3,0x20a220a2,0x28e328e3,0x10001041,0x524928a3,0x7b8e734d,0x84117b8e,0x73ce94b2,0x39c74a49,0x29042104,0x20c239a6,0x28e320e3,0x39643964,0x41c64a07,0x10812923,0x10610000,0x18811020,0x31651861,0x84102924,0x20e48410,0x292520e3,0x52493186,0x00005aca,0x08400000,
-0x31452944,0x41e73186,0x42074a48,0x31653165,0x31443144,0x5a8941e7,0x312441e7,0x31443144,0x31442923,0x29433164,0x314520e3,0x31652904,0x29243165,0x39642903,0x20813964,0x20e228a2,0x31236aea,0x00000000,0x00003186,0x00000000,0x31242903,0x28e328a2,0x31651881,0x20c220e3,0x314339a4,0x31643164,0x31643985,0x398441c5,0x29233143,0x39643964,0x31443984,0x39643164,
-0x20c13985,0x31643144,0x39643964,0x29033123,0x29032903,0x31440000,0x29033144,0x080020c2,0x39652903,0x314439a5,0x29652945,0x10a32945,0x21042104,0x292518c3,0x29451082,0x29452945,0x210420e4,0x20c318a3,0x20e42105,0x20c320e4,0x31870000,0x188118c2,0x084020e2,0x29231881,0x106220e4,0x10831883,0x20e32104,0x52255a88,0x4a076269,0x41e73966,0x18a239a7,0x290228e2,
-0x10200000,0x49c51860,0x28c13122,0x20a11880,0x416328e2,0x5a293102,0x6acc6a8b,0x73af8c11,0x528b632d,0x296610a3,0x18e310a3,0x188218e3,0x08000820,0x49c65268,0x00003965,0x18810000,0x10411061,0x10612924,0x52892904,0x5a8a62eb,0x41e82924,0x7bae5aaa,0x8c118411,0x736e7baf,0x6b0d630d,0x6b4e6b2d,0x6b2d62ed,0x83f07b6e,0x8bf083cf,0x9411734e,0x9431734e,0x83f083d0,
-0x83f09452,0x7baf83af,0x736e7b8f,0x208262cb,0x4a2828e3,0x104118a2,0x20c220c3,0x106118a2,0x52293125,0x31453966,0x6aeb4a08,0x52280800,0x83ae5a8a,0x7b6d8bef,0x7bef83cf,0x5acb73af,0x41e87bcf,0x21042104,0x3145736d,0x4a274a08,0x20e220e2,0x08003144,0x18811040,0x18811881,0x29043165,0x6b4d2924,0x18a24a49,0x39a75acb,0x630c39c7,0x31864208,0x20c220e2,0x29441060,
-0x39a63986,0x210339c6,0x31853165,0x31442924,0x29243165,0x41e62923,0x49e74a07,0x41c64a07,0x312328e2,0x31643164,0x20e218c1,0x18822924,0x21033165,0x396420c2,0x39643144,0x29233123,0x5a683984,0x20c149e6,0x08201020,0x00000800,0x41a63144,0x20823103,0x210318a2,0x292320c2,0x20e22902,0x31642903,0x39853985,0x29023164,0x29023984,0x39a43964,0x31232922,0x49e63964,
-0x396439a5,0x31232903,0x28e23144,0x39643124,0x31233985,0x20c23123,0x39651020,0x41a63985,0x18602923,0x316320e1,0x29033164,0x20e33144,0x20e41882,0x10411061,0x106118a2,0x210418a2,0x20c42925,0x39863986,0x294420e3,0x18a318a2,0x39a71061,0x292339a6,0x20e32924,0x18a10820,0x29043165,0x20e42104,0x29242925,0x41a53984,0x39a63163,0x39a73987,0x39a83166,0x20c13985,
-0x18a10800,0x418428e1,0x184041a4,0x312328e2,0x28c128c1,0x730c30e2,0x838f838e,0x7bf08c32,0x10c35acc,0x10c310a3,0x10c30862,0x082010c2,0x08000820,0x208118a1,0x31650800,0x10411881,0x20e31041,0x188118a2,0x29243165,0x62cb4a48,0x6b2c62ec,0x6b4d738e,0x3987738e,0x526a5aab,0x62ec62ec,0x62ed7baf,0x734d630d,0x83f07b8e,0x8bd07baf,0x9c729431,0x7baf8c10,0x947283f0,
-0x94529c93,0x7b8f7b8f,0x630d7b8e,0x41a720a2,0x4a289451,0x10612924,0x20c32903,0x08201061,0x7bae83f0,0x6b2c7b8e,0x8bef7b8e,0x6b0c62cb,0x5a69734d,0x184128a3,0x4a691061,0x39c70862,0x7bcf6b2c,0x18c32945,0x20c33186,0x20811882,0x20c12902,0x39642923,0x188020a1,0x292320c2,0x31453165,0x21042904,0x294520e3,0x106220e4,0x8c304a28,0x21047bcf,0x29031040,0x29232103,
-0x4a083145,0x422841e7,0x29243986,0x31652944,0x31652924,0x52693165,0x20c23165,0x31853965,0x41c63144,0x318539a5,0x31443165,0x10401061,0x28e32924,0x39643965,0x314439a5,0x20e23123,0x314420c2,0x5a6841c5,0x29034a07,0x316539a6,0x4a073985,0x20a241c6,0x20c31861,0x29032904,0x28e23103,0x29021040,0x29023143,0x39843963,0x41843983,0x290128c2,0x31023983,0x39633943,
-0x31243143,0x31443124,0x31852103,0x31232923,0x20e220c2,0x29033123,0x314441a5,0x28e23164,0x31233123,0x10403144,0x10200800,0x00001020,0x00000000,0x00000000,0x31652924,0x20e320e3,0x31653165,0x31452904,0x20e33145,0x20c33985,0x08202904,0x18800000,0x104020c2,0x31650000,0x29041862,0x31662925,0x29452925,0x31652104,0x21033985,0x31a741e8,0x39c83187,0x20822924,
-0x28e128c2,0x4a0520a0,0x18604184,0x18401860,0x10201000,0x5a6b28c2,0x941183b0,0x73af9452,0x10c331c8,0x10c310c3,0x192410c3,0x20c310c2,0x104120c3,0x4a083985,0x20a21861,0x08202903,0x18a220c2,0x528941e7,0x20e33165,0x29043165,0x5aab49e7,0x738e630c,0x000041e8,0x62ec2925,0x62cc6b4e,0x6aed5a8b,0x62cc6b0d,0x7baf6b2d,0x83cf9472,0x8bf08c11,0x736e83f0,0x8c517baf,
-0x8c119452,0x738e8c11,0x18a362ec,0x6b2d18a3,0x52aa7bcf,0x21032103,0x18c22945,0x39c70821,0xa5146b4d,0x18a2738e,0x10410800,0x39660800,0x4a29732d,0x20a33125,0x29452965,0x630c18c3,0x29663186,0x42083166,0x18a218c3,0x310328e2,0x31233103,0x20a128e2,0x31642102,0x39862924,0x20e32904,0x18c320c3,0x20e41061,0x39a618a3,0x39c7736d,0x20a220c2,0x29232903,0x21032103,
-0x39a63165,0x39a639a6,0x52483986,0x39a64207,0x39a63165,0x20e32903,0x398541c6,0x316539a5,0x39a53144,0x316439a6,0x29242103,0x29232924,0x29023144,0x20e23143,0x398420a1,0x29233144,0x39a54a07,0x29033144,0x318539a6,0x31443165,0x41c65248,0x312449e7,0x10403124,0x29242924,0x39443103,0x29023143,0x314328e2,0x29023142,0x31022901,0x20e13122,0x39431880,0x39433102,
-0x31442903,0x29033124,0x290320c2,0x20c220e3,0x31442903,0x28e22903,0x29033144,0x39a53144,0x20c14a07,0x39853123,0x292341a5,0x39a53985,0x20e339a6,0x18a32904,0x10612104,0x29032924,0x20e32904,0x39862925,0x10612903,0x29042924,0x31863166,0x08202104,0x294418c2,0x18a20000,0x00000821,0x21043146,0x29452924,0x314520e3,0x39c63144,0x39a839a7,0x29462966,0x31253146,
-0x31033124,0x28e12080,0x18603122,0x186028c1,0x312428e2,0x62cc5a28,0x8c117b8f,0x73af7bd0,0x08a30883,0x190410c3,0x18e310c3,0x20a220e3,0x20e31020,0x41a641c7,0x29041861,0x210320e2,0x4a272103,0x39a63165,0x188220c2,0x41c73145,0x4a6a1862,0x528a630c,0x18a318a3,0x734e7baf,0x630d6b0d,0x6b2e62cc,0x83d06aed,0x94729431,0x9c7283f0,0x94529c72,0x62ec83d0,0x947283d0,
-0x7baf9492,0x630c736e,0x18c34229,0x7bcf630c,0x20e33165,0x6b6d18c3,0x29247bce,0x5aab0820,0x10828410,0x00000000,0x4a082062,0x29256b0c,0x4a284a28,0x5acb62eb,0x10825acb,0x21042945,0x212539c7,0x108218e4,0x188218a3,0x31033103,0x310328c2,0x39443103,0x31642944,0x31453986,0x18812904,0x108218a2,0x10620820,0x39862904,0x18821882,0x18811881,0x20e320e3,0x29442945,
-0x41e74a07,0x39855268,0x31443165,0x39863986,0x314420e3,0x31852924,0x39852944,0x39853165,0x292420e3,0x31443985,0x39a539a5,0x31442944,0x39853144,0x28e22903,0x29033123,0x316439a6,0x398539a5,0x39a441c6,0x398541c6,0x41c63164,0x31854a27,0x39a639a6,0x29032924,0x39a52923,0x39653144,0x20c120c1,0x20c118a1,0x184028e2,0x28e11840,0x10003103,0x186028c1,0x28c128c1,
-0x31033123,0x29033144,0x290320a2,0x210320a2,0x20a120c2,0x10401020,0x28e21860,0x28e33964,0x41c63985,0x20e118a0,0x31643164,0x29022902,0x39853144,0x39863145,0x31453145,0x20e22924,0x31652903,0x31443145,0x29043165,0x314520e3,0x29243145,0x21042945,0x294518c3,0x18c21061,0x10822104,0x29450000,0x21042104,0x39a72924,0x31663145,0x29461041,0x29462966,0x31462925,
-0x39c73946,0x49c75aa9,0x28c03942,0x312330e1,0x100028e2,0x632d0800,0x7bf07bf0,0x21654a29,0x212508c4,0x18e32103,0x18a218e3,0x188218a2,0x20c31821,0x4a495248,0x630b2104,0x18802904,0x20c120e1,0x082018a1,0x08202903,0x41e820c3,0x0000526a,0x08213166,0x6aec20a3,0x630c528a,0x5aab524a,0x6b2d734e,0x94528c11,0x6b2d8c31,0x84105aab,0x84108411,0x4a096b2d,0x845173d0,
-0x738f8431,0x20e318c4,0x18a21081,0x29445acb,0x31452924,0x736d18a2,0x10615acb,0x738e0820,0x08203144,0x29243144,0x8410632c,0x108252aa,0x630c0821,0x10618410,0x18c32104,0x42081082,0x18c32945,0x29242104,0x394420c2,0x30e128e2,0x31443123,0x9cd38410,0x41e7ad35,0x20e32924,0x20c320e3,0x188218a2,0x20e31061,0x312439a6,0x18204165,0x20c220e3,0x290320e3,0x41e60840,
-0x39853144,0x29233985,0x29233164,0x20c33145,0x314420e3,0x31642924,0x31643164,0x31643165,0x18c23165,0x31652903,0x31853165,0x31442924,0x39853985,0x31233144,0x292420c2,0x29442924,0x7bae2944,0x39643965,0x314439a5,0x39a53985,0x31643164,0x39a63185,0x21033165,0x31653144,0x39653985,0x31233123,0x20a120e2,0x31231860,0x39423123,0x31023964,0x28c12901,0x28c11860,
-0x31033102,0x28e320c2,0x188120a2,0x290418a2,0x31233966,0x28e13964,0x28e228e1,0x49a63123,0x20c23985,0x290241c5,0x20c118a1,0x39643143,0x39863124,0x28e41882,0x41c720e3,0x21023144,0x41c62924,0x290420e3,0x31653144,0x39862924,0x29033165,0x21242945,0x08411082,0x20e318c3,0x21042924,0x29251883,0x29252925,0x31652924,0x39862904,0x29663145,0x21251083,0x6aec526a,
-0x7bcf7b4e,0x41a7840f,0x30e120c1,0x28c22060,0x18601000,0x5acb20c2,0x5aec7bf0,0x00630001,0x108210a3,0x31651040,0x18a218c2,0x734d3145,0x39863125,0x52482903,0x316562ca,0x08201040,0x20a120c1,0x18810820,0x18a13164,0x734d7baf,0x31253986,0x5a6a20c3,0x628b1862,0x630c62ec,0x736e62ec,0x94316b2d,0x7baf8c31,0x736e6b0d,0x738e7baf,0x736e83d0,0x6b4d6b4e,0x8c9273af,
-0x21042965,0x10812104,0x00000000,0x10810020,0x18820000,0x20e318a2,0x00000000,0x20c21881,0x10600800,0x31852103,0x21245aeb,0x20e32104,0x7baf5aaa,0x294518c3,0x10621082,0x08412124,0x18a318a3,0x20e32104,0x28e228e2,0x314328e2,0x949239c6,0x5acb9cb3,0x20e42945,0x188220e3,0x18a220e3,0x00001061,0x18813145,0x28e33145,0x10401881,0x314418a1,0x18c241c6,0x29232103,
-0x31653185,0x31443144,0x31643164,0x31653144,0x29243165,0x318520c2,0x31443185,0x39852903,0x31642944,0x29032903,0x29233144,0x29443985,0x31443165,0x39643144,0x31652903,0x29653165,0x84308c72,0x41648bce,0x31443144,0x39c54206,0x39a539a5,0x41c63985,0x39a739a6,0x29251862,0x31443985,0x398541a6,0x18803143,0x18603123,0x20a020a1,0x28c13103,0x29011020,0x41843122,
-0x28e228c1,0x186120c2,0x20c22903,0x18601861,0x312328c1,0x396341a5,0x312349c5,0x49a649c6,0x398541c6,0x31643985,0x20e23964,0x20c10820,0x318541c6,0x20a33145,0x29243986,0x210241c6,0x20c22103,0x29043145,0x314518a2,0x29443144,0x29032904,0x10822104,0x00000000,0x18c30000,0x21042925,0x00002925,0x21042925,0x29042925,0x29252925,0x29663166,0x4a4a2946,0x7b6e736e,
-0x736d7b8e,0x41c82145,0x18405247,0x18201840,0x10003965,0x29450820,0x00000000,0x08a20841,0x000018c3,0x20c31882,0x08201861,0x528a5aaa,0x18a241e7,0x28e21882,0x28e20800,0x08001880,0x18811881,0x080018a2,0x08000800,0x4a2920c4,0x30e47b8e,0x730d628b,0x6b0d62cc,0x630c62ec,0x734e6b2d,0x736e7b8e,0x734e736e,0x738e5aab,0x94727baf,0x734e83f0,0x736e7bcf,0x210552cc,
-0x29641903,0x106131a5,0x00000000,0x00000820,0x00000000,0x00000820,0x00000000,0x102028e2,0x082020e2,0x18a23144,0x08410040,0x18c32104,0x106220e3,0x210418c3,0x08215acb,0x18c31082,0x292418c3,0x29252945,0x28e23944,0x526828c2,0x84519492,0x2104526a,0x20e32104,0x20c220c3,0x106118a2,0x20e31061,0x31451881,0x294420c3,0x20e23144,0x20e320e3,0x20e22903,0x18c218e2,
-0x39653965,0x31243985,0x314420c2,0x31453185,0x29453144,0x20e33165,0x292420c3,0x31853144,0x31643165,0x292420c3,0x29043165,0x20c22903,0x39652924,0x318541a6,0x31853144,0x29642964,0x7baf2124,0x39449c92,0x41853964,0x41844164,0x31234185,0x41c62904,0x31664a28,0x41c820e4,0x28e33145,0x31642903,0x39853144,0x39841880,0x31440820,0x18a128e2,0x28c13964,0x310328a1,
-0x39243944,0x208128e2,0x18402081,0x52273102,0x49a541a5,0x31023942,0x31224163,0x41853943,0x41c641c6,0x41c63144,0x39643144,0x31643985,0x314428e2,0x31653965,0x210318a2,0x20e31081,0x20e23143,0x29043124,0x31243965,0x31243124,0x18823124,0x29042904,0x00000000,0x39a63186,0x21042104,0x21042104,0x294418c2,0x39862945,0x20e320e3,0x318641e7,0x21053166,0x6b6e6b4d,
-0x736c7bcd,0x21252966,0x738e52ab,0x28c341a6,0x186120a2,0x4a480820,0x08610000,0x29450000,0x20a22944,0x18411821,0x10412924,0x10616aec,0x18a220e3,0x41e718a2,0x00000800,0x08001040,0x08001861,0x39853965,0x39245228,0x736e5a6b,0x62ec524a,0x62ec62cc,0x5acb736e,0x630c630c,0x9c937b8f,0x8c3183f0,0x732d6b4e,0x6b4d736e,0x7baf7baf,0x7bcf738e,0x1041734d,0x31860020,
-0x00000000,0x00005acb,0x00000000,0x08002104,0x08201061,0x00000000,0x29030820,0x20c218a1,0x10610820,0x106120e4,0x00000821,0x31241082,0x10613125,0x52692103,0x10610000,0x000018c2,0x20e318c2,0x20c318c2,0x20c33145,0x39a64a08,0x294583ef,0x20e32924,0x21042924,0x18a218a2,0x106120c3,0x736d3145,0x6b2c736d,0x8c105aca,0x20c33165,0x18a120e2,0x20e320e2,0x00000000,
-0x39653144,0x5a8949e7,0x29443165,0x31653165,0x29242904,0x31442924,0x29443145,0x20e220e3,0x31853164,0x39863165,0x29243165,0x29032903,0x31442924,0x29232903,0x316420e2,0x29633165,0x21042123,0x734d4a48,0x41845207,0x49e649c6,0x41a541a5,0x41e74a08,0x41c741e7,0x6b2d2925,0x39c7526a,0x31443125,0x31651881,0x314439a5,0x20a120c2,0x290320a1,0x18602903,0x28e22080,
-0x312430e3,0x20613103,0x418428c2,0x41a53983,0x5a274184,0x49a428c1,0x41a43943,0x418541a5,0x39654a07,0x39843964,0x39643985,0x292220e2,0x20a241a4,0x29243965,0x00003144,0x10610000,0x31233985,0x312320c2,0x290341c6,0x290328e3,0x39863144,0x31663165,0x00000000,0x29040000,0x20e320e3,0x10612924,0x21032924,0x4a071061,0x31452924,0x31863985,0x31463166,0x4a4939c7,
-0x632bad52,0x29453186,0x632d2125,0x62ab39c7,0x20a25a6a,0x10610000,0x20e30000,0x292418a2,0x188218a2,0x29043945,0x10415289,0x20c31041,0x292320e3,0x20c20820,0x08001040,0x08000800,0x20e318a2,0x28e31881,0x62cb3124,0x6b2d736e,0x6b0d62cc,0x734e734e,0x738e6b4d,0x9c937baf,0x7bf07baf,0x738f7baf,0x734d7b8f,0x738e83af,0x62ec6b0d,0x5aab9472,0x00000000,0x00000000,
-0x00000000,0x00000841,0x08410000,0x00400000,0x00000020,0x10410000,0x184028c2,0x20a120c2,0x18a220e2,0x106218a3,0x18820820,0x10007b8e,0x18c328c3,0x18a22103,0x18a21081,0x10611061,0x210320e3,0x290420e3,0x9471734d,0x736d8c30,0x18a320e3,0x18c318a2,0x210420e3,0x00002945,0x6b6d2965,0x83ef7bce,0x18c22103,0x18c118a2,0x18c11060,0x20c118a1,0x00001881,0x08200840,
-0x39a55268,0x398541a6,0x398541a6,0x39853144,0x29452903,0x31453145,0x29042924,0x20e33165,0x29241881,0x294439a6,0x20e32924,0x290420e3,0x31442904,0x29243145,0x18a11041,0x212318a1,0x29842144,0x52683165,0x41a441a5,0x41844184,0x41a54a06,0x39a74a28,0x39a63986,0x6b4d5acb,0x41c7736e,0x31662905,0x294441c7,0x39853985,0x20a23165,0x29033965,0x28c23144,0x28e228c2,
-0x08002081,0x20a23144,0x31212080,0x20600800,0x49c54142,0x310241a5,0x49c43102,0x28e120a0,0x39433122,0x39a43983,0x312228e0,0x31223963,0x28e21880,0x29443123,0x29042944,0x08000820,0x41e61040,0x31443964,0x39853124,0x31242903,0x29233165,0x082018c2,0x29242923,0x18c20820,0x18c32925,0x210418c3,0x20e41062,0x31441881,0x294528e4,0x21252924,0x29662125,0x31a63166,
-0x31a631a6,0x318610a3,0x21042945,0x29252125,0x20c339c7,0x000018a2,0x29231040,0x29042903,0x526a41c7,0x5229632c,0x41e81001,0x292418a3,0x4a074a69,0x00000820,0x7bae0820,0x184118a1,0x18821020,0x08200800,0x62ab6b2c,0x6aec28e4,0x7b8f734e,0x736e734e,0x6b4e6b6e,0x00014209,0x73af6b4d,0x8bf07b8f,0x7baf734e,0x7baf630d,0x00000821,0x00000000,0x29452965,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x28c20000,0x18601861,0x08000800,0x10611881,0x18821841,0x10412925,0x72ec49c8,0x29041800,0x00001881,0x18610820,0x18c218c2,0x20e320e3,0x20e320e3,0x398620e3,0x000049e7,0x18821882,0x18822082,0x292420e3,0x62ec18c3,0x83ef8c30,0x6b0b736d,0x20e30000,0x290318a1,0x00001881,0x00000000,0x08200000,0x20e31840,0x18c318a1,
-0x41e718a1,0x31442903,0x52483124,0x31243985,0x31443144,0x31653144,0x29243165,0x31642924,0x29033164,0x39c62944,0x39a64a28,0x39a62924,0x20e32924,0x000020c3,0x18a11882,0x292420c2,0x29242944,0x31443165,0x8c0c39a5,0x8bca9c2b,0x5a895226,0x5a8a7bcf,0x4a293986,0x83ef6b4d,0x49e8734e,0x39663986,0x31653125,0x31443144,0x398539a6,0x28e22903,0x20813123,0x28a23103,
-0x39653103,0x4a2749e7,0x49c53122,0x39433963,0x49c649a5,0x49e849c6,0x312149e5,0x28e028c0,0x39632080,0x20a03983,0x41a33122,0x31023942,0x186028e1,0x10401840,0x31452924,0x08203165,0x39850000,0x314441c6,0x39653965,0x31242903,0x29243124,0x29243144,0x31443185,0x00202924,0x18a20820,0x29242924,0x20e320c4,0x20e21040,0x29242904,0x294518c3,0x21252945,0x31863187,
-0x18e318e3,0x29662945,0x20e42104,0x4a292925,0x29240801,0x18811881,0x08401060,0x18822103,0x39661842,0x62eb6aec,0x83ef39c7,0x62eb4208,0x080062eb,0x20c30000,0x5aaa1040,0x18000800,0x52493124,0x3125734d,0x736e736e,0x738e7bd0,0x7bef736e,0x4a6a6b6e,0x08410021,0x08410021,0x5acb83f0,0x08016b2d,0x6b2d1883,0x738f83d0,0x20e3738e,0x7bcf5acb,0x21247bef,0x00000020,
-0x08610000,0x00000000,0x00000000,0x08000800,0x39651020,0x28c21860,0x186120a2,0x20c21020,0x20a31862,0x734d0841,0x30c31821,0x732c8b8e,0x102030e3,0x20a228e3,0x18a218e3,0x18a220e3,0x00001882,0x28e31882,0x28c31882,0x000028a3,0x41e72924,0xbdb66b4c,0x7bcf9cd3,0x00004a49,0x18a20800,0x210318a2,0x00000000,0x00000000,0x08400000,0x188118a1,0x08201840,0x00000800,
-0x31442924,0x52892903,0x52693144,0x398541c6,0x41a639a6,0x31442903,0x39863124,0x5aaa3145,0x398541c6,0x630b41e7,0x41c74a08,0x41c7526a,0x10411882,0x29450800,0x10612104,0x29233103,0x290318c2,0x31652903,0x52673165,0x9c6b7b69,0x41a43102,0x6aec5207,0x39855249,0x4a295249,0x4a083166,0x39a73146,0x31453165,0x31643164,0x20e23164,0x28c128c1,0x39643923,0x18602081,
-0x314420e2,0x41c43144,0x394341a4,0x41a53963,0x4a2841a5,0x41e72903,0x4a084a08,0x39a64a08,0x20813103,0x41843102,0x39a42922,0x28e128e2,0x102028c1,0x29233122,0x29040800,0x31443185,0x29442925,0x314439a5,0x39653985,0x31443144,0x18812903,0x31443144,0x10813165,0x08202903,0x21031061,0x21042104,0x29242924,0x29452924,0x20e42104,0x20e30801,0x29452945,0x292520c4,
-0x292418c2,0x31662125,0x20e42104,0x00002925,0x292418a2,0x210320c2,0x10610000,0x106218a3,0x28a31000,0x8c105aab,0x082162eb,0x00000000,0x28c30000,0x10001000,0x10009410,0x30c32882,0x734e4a08,0x210462ec,0x632d4a29,0x6b4e738e,0x738e734e,0x00000841,0x00000000,0x00000000,0x08200000,0x630c39c7,0x84107bef,0x7baf738e,0x841062ec,0x7bef73ae,0x00000020,0x00006b6d,
-0x000039c7,0x00000000,0x00000000,0x20411040,0x10411820,0x7b8d3986,0x20e35269,0x292428e3,0x108218c3,0x20e418e3,0x8c106aec,0x524983f0,0x284130c3,0x18a128a2,0x188220c2,0x000020e3,0x08200820,0x630c41e8,0x8c507bae,0x00005269,0x00000000,0x29240820,0x738d9cd3,0x00000020,0x00000000,0x00410000,0x00000000,0x08200000,0x28e220c1,0x00002924,0x00001881,0x08001061,
-0x18a120e2,0x18c22103,0x39865249,0x39a65248,0x62aa41e6,0x49e741a6,0x31443124,0x29443985,0x52683165,0x31854a49,0x20e320e3,0x20e42904,0x29242925,0x29252904,0x39a63186,0x290320c3,0x29232903,0x31442923,0x29222924,0x39601840,0x39623122,0x838d4184,0x28e33124,0x6b4d3166,0x31664a09,0x31252905,0x31653145,0x29232923,0x31643985,0x28c13123,0x28c228a1,0x28c23944,
-0x31432903,0x31633985,0x31223943,0x41a53943,0x4a2849e6,0x4a084a28,0x4a285269,0x41e739a6,0x41a53985,0x310349e6,0x41a53123,0x41c53164,0x28c13163,0x39644184,0x316549e7,0x41c70800,0x39a620e3,0x29233164,0x31243144,0x31243144,0x20c23965,0x20c20800,0x10812903,0x08202923,0x31852103,0x210418c3,0x29242925,0x294520e3,0x292518c3,0x20e320c4,0x18a320e4,0x210420e4,
-0x18a218a2,0x29452925,0x316618c3,0x000020e4,0x106118a2,0x10a220e3,0x18c31061,0x082018a3,0x39661000,0x736d734d,0x080020e4,0x31240000,0x39440800,0x28e328a2,0x28a328c3,0x626a30e4,0x7b8f7baf,0x630c630c,0x00212925,0x10821082,0x00207bae,0x00000020,0x00000000,0x6b4d0000,0x10610000,0x843031a6,0x42297bcf,0x21041062,0x632c1082,0x52aa9492,0x00000000,0x00000020,
-0x00000000,0x00000000,0x18613124,0x10001861,0x5a8920a2,0x736d9471,0x52892924,0x18a228c3,0x210410a2,0x83ef3186,0xa514b575,0x9cb28c51,0x62089c51,0x10403904,0x20e320e3,0x8c301061,0x7bcf7bcf,0x94728410,0x00008410,0x41860840,0x18411861,0x29240800,0x18a20000,0x10411861,0x00000000,0x08200000,0x08000000,0x08000800,0x00000800,0x08001040,0x00000800,0x08200000,
-0x292439a5,0x29033185,0x39852944,0x31653985,0x314439a6,0x31443965,0x52483124,0x29233123,0x39853165,0x294541e7,0x20c32904,0x20e320e4,0x292528e4,0x39873125,0x31a739a7,0x41c64208,0x29032903,0x31643144,0x31652903,0x31213103,0x52054162,0x30e02900,0x5a484164,0x4a294a08,0x39664a29,0x41a762ec,0x314541e7,0x39a52923,0x31643164,0x41643123,0x39444164,0x28e24185,
-0x29033964,0x39633985,0x396341a4,0x39633963,0x4a0741e6,0x4a074a28,0x41c741e7,0x41c741e7,0x316539a6,0x31853165,0x31443145,0x31643986,0x28e32103,0x28e22081,0x39a63144,0x398539a6,0x39852925,0x31443123,0x29233965,0x28e32903,0x20a23144,0x10610000,0x08003185,0x10611061,0x21042104,0x294518a2,0x31652945,0x21042945,0x210520e3,0x21042925,0x29242945,0x002018c2,
-0x29442924,0x10822945,0x316618e4,0x314520c4,0x29042904,0x106120c2,0x18c20840,0x18a320e4,0x626a1842,0x6b2c6b2d,0x730b5a8a,0x41661000,0x5a494165,0x730b28a2,0x39663124,0x734e5a6b,0x734d7b8f,0x5aab736e,0x086218a3,0x39a50000,0x000018e2,0x00000000,0x00000000,0x00000000,0x736d0000,0x630c738e,0x00200861,0x212339e7,0x7bcf2123,0x528a0000,0x18c31082,0x00000000,
-0x08410000,0x18410841,0x10611000,0x08001861,0x29245aa9,0x08000000,0x94517b8d,0x08401841,0x00000020,0x19034208,0x29a63a07,0x840f10e3,0x6a49bd75,0x18a272eb,0xc5d71061,0x08404a48,0x6b4d2104,0x738e5aaa,0x000062eb,0x4a480000,0x21448c50,0x6b2c3145,0x294520e3,0x00000000,0x10210000,0x4a275249,0x10203124,0x20e10800,0x20a120c1,0x29031881,0x00000820,0x18823986,
-0x29243965,0x29243144,0x31442924,0x39851881,0x28e23124,0x31443985,0x312328e2,0x20e23964,0x314439a5,0x31653985,0x29233985,0x31442944,0x41e82924,0x39a73986,0x318639a7,0x420839a7,0x31664a28,0x29242924,0x31652924,0x394341a5,0x49e441a4,0x392241a4,0x41c649e6,0x422839a6,0x42084a49,0x39a639a7,0x39863986,0x20c23165,0x20c21060,0x41852903,0x39443944,0x28e33944,
-0x31441881,0x18802924,0x41842080,0x418441c4,0x31643964,0x39643144,0x316541a5,0x31853985,0x31653986,0x314539a6,0x39a639a6,0x314441c6,0x29233985,0x39852903,0x316539a6,0x20c33986,0x294420c2,0x39852903,0x31233944,0x31233944,0x39443944,0x29243124,0x18610000,0x00001020,0x20e41060,0x31462925,0x29462946,0x21041062,0x18c320e3,0x20e32104,0x21042924,0x29441081,
-0x08401081,0x086118e3,0x18c20861,0x29442124,0x210320e3,0x084120e3,0x18c318a2,0x208220a2,0x732d28a3,0x49e86b0d,0x39443146,0x83cf28c2,0x94728bef,0x732d9431,0x62cc7b8f,0x6b4d5229,0x6b4e6b4e,0x6b0d732e,0x00004a28,0x5aaa18a2,0x00007bae,0x00000000,0x00000000,0x106118a2,0x5aaa18a2,0x31652104,0x084018c1,0x294418a2,0x08612945,0x10c25aeb,0x00002124,0x6b6d0000,
-0x00000020,0x00001882,0x10001040,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10a20020,0x190310a1,0x736d0881,0xc596c5d7,0x9cb29cb2,0x6b4c4a28,0x5aaa1061,0x9cd38c31,0x31866b4d,0x082018a3,0x29040000,0x080020c3,0x20c218c2,0x31851061,0x20e30000,0x29032903,0x39853144,0x08202903,0x104020c2,0x20a11040,0x20a13143,0x290320a1,0x00000800,
-0x29233165,0x39853185,0x31453144,0x314420e3,0x29033144,0x396420c2,0x29033143,0x39a52903,0x292318c1,0x314439a5,0x31653144,0x41c641c6,0x39a541e7,0x31663985,0x316639a7,0x39c741e8,0x4208526a,0x29243165,0x41854185,0x39243104,0x41834184,0x52063942,0x41c66b0b,0x41e841c7,0x4a494a08,0x39a63145,0x20c30800,0x29033144,0x29242923,0x28a23144,0x396428e3,0x31243944,
-0x29032903,0x28e33165,0x184028c1,0x28e228e1,0x18814165,0x20c22924,0x39853144,0x31653985,0x398639a6,0x31653985,0x10403165,0x290320c2,0x20a11060,0x20c220e2,0x31442923,0x31652924,0x18a22923,0x39c63144,0x39243944,0x39643924,0x41654165,0x28e32082,0x31243124,0x18611000,0x20e32103,0x210439a7,0x31663186,0x29452104,0x20e43186,0x20e32945,0x29242944,0x108118a2,
-0x108220e3,0x18c318c3,0x210410a2,0x29442944,0x18a22103,0x20e318a2,0x10812103,0x28c30800,0x7bae732d,0x8bd08bf0,0x4a0883af,0x8c527baf,0x5a6b6b4e,0x1883736f,0x7b8f7b4e,0x7baf7b6e,0x738f83f0,0x41a73987,0x082020e4,0x00000820,0x00000000,0x20620800,0x4a4920a3,0x18a26b4c,0x29440820,0x18c30821,0x000010a1,0x00000820,0x10610820,0x10810841,0x00000000,0x00000000,
-0x00000000,0x10401020,0x6b2c0800,0x00000000,0x08000000,0x62eb3985,0x4a280000,0x00000000,0x00000000,0x00400000,0x00200040,0x10a22104,0x94b28c51,0x41860000,0x08402124,0x21031061,0x00001081,0x292320e2,0x186020e2,0x082020a1,0x08200000,0x00000800,0x00000000,0x20e218a1,0x20e32924,0x20e320e3,0x20c23985,0x08000800,0x20a120c2,0x316418c2,0x00000000,0x00000000,
-0x41c541c6,0x39a639a5,0x31443165,0x31452924,0x31653165,0x20a139a6,0x28e128c2,0x18c120c1,0x41c53143,0x29232903,0x314420e3,0x39a63164,0x39655248,0x31653165,0x31663985,0x41a73986,0x39863105,0x41c64a08,0x41a63965,0x418541a6,0x28c01020,0x41843120,0x62ea83ef,0x734d2924,0x42085acb,0x08005228,0x29231881,0x29032103,0x20a12903,0x312420c2,0x49a63144,0x28e349a6,
-0x28e320c2,0x20c22903,0x316320e2,0x41c65246,0x39853123,0x39a539a5,0x39642903,0x39843144,0x39852924,0x31643985,0x39c63185,0x31642944,0x18801040,0x28e228e2,0x21022903,0x29032943,0x31642103,0x29242923,0x314320c1,0x39234144,0x39643944,0x394328c2,0x28c128e2,0x20c31020,0x318618a3,0x39a63186,0x31663187,0x31453146,0x18a23986,0x10401882,0x18811061,0x20e220e3,
-0x000018a2,0x18c21061,0x210318a2,0x210320e3,0x20c220c2,0x102018c2,0x08001041,0x416618a2,0x7bae730d,0x7b8f7b8f,0x7bcf83af,0x39c8736e,0x736e62ec,0x524a6b0d,0x7b8f83af,0x7bd08c31,0x62ec7baf,0x62cb734d,0x738e6b2d,0x6b6d8c51,0x3124526a,0x20c30800,0x62ec2904,0x18a20000,0x18a21061,0x738e5aeb,0x5aeb9cd3,0x10610000,0x18212082,0x00200000,0x00000000,0x00000000,
-0x28c30800,0x000020a2,0x00000800,0x18400000,0x5aaa0000,0x00005248,0x00000800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x630c0840,0x00000841,0x10610000,0x084018a1,0x08200800,0x18811060,0x20e11040,0x18a020e1,0x290220e2,0x29022902,0x294341c6,0x20e21061,0x08003165,0x00000000,0x20812923,0x00001060,0x00000000,0x00000000,0x00000000,
-0x4a073985,0x39a641e7,0x31443985,0x18c23165,0x316541c7,0x39854a08,0x31443144,0x29033964,0x39863165,0x39863985,0x31443985,0x31652923,0x31243165,0x39853124,0x31642903,0x41c63164,0x314441a6,0x41e73165,0x394441a6,0x49c64186,0x28a03122,0x41833100,0x736c20c1,0x7baf0800,0x8c318410,0x20e2732c,0x31444a27,0x39a541e7,0x29024a07,0x20e33144,0x39243965,0x31043965,
-0x31443965,0x29032923,0x39643125,0x39841020,0x41c63985,0x39c541c6,0x290241e6,0x292328e2,0x316420e3,0x39a53165,0x21032944,0x18a12103,0x18813144,0x31643123,0x29432903,0x08402943,0x20e22103,0x31442103,0x39643143,0x39423943,0x39443942,0x28e249c6,0x41a528c1,0x39c620c2,0x41c72104,0x62ec1062,0x31463967,0x39865a6a,0x00006b2d,0x20e220e3,0x104018a2,0x18a10840,
-0x20e32104,0x18a218c2,0x210318a2,0x20e31082,0x000020e2,0x00000800,0x6b0c1041,0x3945734c,0x7bae41a7,0x83af7baf,0x6b2d734e,0x630d5aab,0x6b0d630c,0x7bcf7baf,0x6b6e73af,0x526a7baf,0x08626b4d,0x6b6d8430,0x00004a49,0x634d0000,0x28e3736d,0x20c33986,0x10823986,0x31653165,0x52aa4207,0x4a498c71,0x00001082,0x29041000,0x00001000,0x00000000,0x00000000,0x08001081,
-0x738d738e,0x08200000,0x10400000,0x5a491040,0x18c20000,0x00002103,0x18400000,0x00002944,0x00000000,0x00000000,0x00000000,0x10610020,0x08200820,0x10814a28,0x00000000,0x18c20800,0x00001040,0x08000820,0x28e220c1,0x10401040,0x20c11860,0x104028e2,0x20e220c1,0x082018a1,0x18c20000,0x18a11081,0x316420e2,0x08003985,0x00000000,0x00200000,0x00000020,0x00000000,
-0x41c64a27,0x398541a5,0x398541c6,0x312428e4,0x31442904,0x29443965,0x20e33144,0x31453164,0x29043165,0x39863144,0x31453145,0x29033185,0x4a0739a5,0x4a073164,0x41e641a5,0x41c75227,0x49a55228,0x41653964,0x41e641c6,0x418649c6,0x28813104,0x31223923,0x6b0c3984,0x7b8e1882,0x28a17b4d,0x20402081,0x29221060,0x10611061,0x49c62903,0x20e33184,0x31443144,0x290328e3,
-0x20e328e3,0x186020a1,0x41c620a2,0x31233124,0x41c63964,0x29013144,0x39642902,0x39a541c5,0x29223984,0x31443164,0x29653185,0x29033185,0x31443164,0x18813144,0x20e120e2,0x20a11040,0x39642903,0x08203164,0x20c02922,0x39633942,0x39443942,0x31233964,0x28e23964,0x312428e2,0x29242103,0x208241c7,0x6b0c28a3,0x738e7bae,0x08007bcf,0x10400000,0x31441040,0x00003145,
-0x188118a1,0x08411061,0x10611082,0x10410840,0x18001040,0x29431000,0x6b2d734c,0x29256b2c,0x5a8a62eb,0x736e736e,0x736e6b4e,0x630c5acb,0x6b4d6b2d,0x630c630c,0x00003165,0x00003165,0x08200000,0x83f00001,0x18e37baf,0x108118e3,0x20c33165,0x52293125,0x4a286b4d,0x21240020,0x00001062,0x00000000,0x18620020,0x83cf83af,0x41e79c92,0x00000820,0x39c70000,0x08400020,
-0x08000000,0x30e31841,0x28a21841,0x1020836e,0x104028c3,0x5aaa0800,0x00005289,0x10200000,0x00000840,0x00000020,0x20e218c2,0x29451880,0x0840736d,0x00000000,0x10200800,0x18201000,0x28c128e2,0x186028c1,0x29020800,0x10600800,0x104020e1,0x08001020,0x08201061,0x00200000,0x21030840,0x188139a5,0x00002903,0x00000000,0x08000000,0x00000000,0x00000000,0x00000000,
-0x41e641c6,0x41a52923,0x39853985,0x396541c7,0x31243145,0x29443124,0x29242903,0x290420e2,0x31653165,0x21032924,0x20c32904,0x31652924,0x62eb20e3,0x31235269,0x31443985,0x4a0741c6,0x49a44a06,0x41643943,0x4a0741c6,0x5a4849a6,0x52075228,0x31233144,0x7b8d62eb,0x7b8e7bae,0x102018a2,0x18602080,0x18601000,0x18404184,0x312328c2,0x39653164,0x39852924,0x29243965,
-0x29031881,0x39443965,0x20c23965,0x104020c2,0x20e120c1,0x314220e1,0x312320c0,0x29231060,0x39a420c0,0x29022901,0x41c520e2,0x31651880,0x20c23985,0x18812903,0x314420c2,0x41a520e2,0x080028e2,0x20c20000,0x398418c1,0x41a441a5,0x39434184,0x31223102,0x20803943,0x28e22901,0x08000000,0x20626aec,0x7b6e7b2d,0x8c318410,0x49e7736e,0x104028a3,0x20c21040,0x396520a2,
-0x20c320e3,0x29452925,0x31663165,0x290339c7,0x18402081,0x7bae39a6,0x2925736e,0x7b8e7b8e,0x62ec734d,0x7baf736e,0x632d6b2d,0x4a29630c,0x39a74a49,0x00000000,0x00000000,0x08409491,0x292420c3,0x20e420e4,0x18c320e4,0x00000020,0x4a490000,0x4208736d,0x00000000,0x00000000,0x00000000,0x18810000,0x396618a2,0x6aec732d,0x290449e8,0x18c28c30,0x18610800,0x10200800,
-0x10001041,0x28a21821,0x6aeb28a2,0x312462aa,0x316530e3,0x21033986,0x08001061,0x31650800,0x08400000,0x10610000,0x29231081,0x18611040,0x20a22903,0x18810800,0x29233124,0x18600800,0x18601020,0x20c11000,0x10201880,0x18a01020,0x18a02901,0x20e21040,0x31642923,0x18c218e2,0x00000000,0x00000000,0x00000000,0x00000000,0x18810820,0x00000000,0x41e718c3,0x00005aca,
-0x49e641c6,0x31433144,0x41a62903,0x39863965,0x31443986,0x29443985,0x39853985,0x290420c2,0x398620e3,0x314439a6,0x31452904,0x41e63165,0x41e64a07,0x29022903,0x4a273164,0x314341e6,0x394241a4,0x41a449e5,0x62ea39a5,0x520783ae,0x39867b4c,0x838d5269,0x20e32924,0xa4f320e3,0x734b736d,0x20e25267,0x10002060,0x30c22040,0x18813923,0x314439a5,0x39653144,0x41c641c6,
-0x39653124,0x28e34185,0x39653985,0x39643965,0x20e02922,0x186018a0,0x20e11040,0x31433143,0x18802922,0x102020c0,0x28e220a0,0x316428e1,0x10402924,0x312320a1,0x10413164,0x314441c6,0x31233144,0x29233144,0x29033185,0x418330e3,0x51c449c4,0x418351c4,0x31213121,0x000020c0,0x7b2d1000,0x41a7732d,0x83af6aab,0x630c83ef,0x7bee736e,0x3985734d,0x20e32903,0x39652904,
-0x31452904,0x29453186,0x31873165,0x31653186,0x734c4185,0x736e83ef,0x29263146,0x736d6b0c,0x7b8e6aec,0x5aab6b4d,0x10821083,0x31662104,0x526a3166,0x7baf738e,0x00000820,0x39e70000,0x104020e3,0x18c32925,0x000018c3,0x318510a2,0x7bef1061,0x002073ce,0x08410841,0x00000000,0x21230860,0x20c22903,0x290418a1,0x7b6e8bf0,0x62eb62ab,0x188241e7,0x10210800,0x102028e3,
-0x30a31841,0x08002841,0x7b8e30e3,0x5a496b4d,0x4a073103,0x39a62924,0x208220a3,0x00001860,0x00000000,0x00000000,0x08200000,0x10200800,0x20c11880,0x08001860,0x20c22923,0x20a02901,0x10201860,0x10401840,0x10400800,0x10601040,0x10201060,0x20c11060,0x10801060,0x082010a0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x00000000,0x00000820,0x10820000,
-0x398541a5,0x4a273964,0x39a55248,0x31242924,0x31242903,0x28e228c3,0x290320a1,0x396428e2,0x398541a5,0x28e22903,0x39852902,0x4a273165,0x31442923,0x39853964,0x31443123,0x39643985,0x418341a4,0x49c449c4,0x520651e5,0x416472ea,0x6aeb93ee,0x28c13964,0x31023122,0x18202081,0x31621881,0x08000800,0x18601840,0x41851020,0x39444185,0x5aaa3944,0x314420a2,0x83ae3965,
-0x7bae6b2c,0x39645289,0x394328c2,0x39853964,0x41a541a6,0x20c03163,0x18601840,0x18802922,0x10401881,0x08001020,0x18811060,0x39852903,0x29032925,0x28e320e3,0x39642923,0x20e220c2,0x290320c2,0x20e320e3,0x106120c2,0x39632923,0x51e451e3,0x51e55205,0x30e14183,0x08201860,0x62ca39a6,0x7b6e732d,0x8c3183af,0x62cc39c7,0x7b8f528b,0x83d07bb0,0x29054a09,0x734e2905,
-0x5aab5249,0x31463987,0x39873166,0x39861042,0x7baf83cf,0x292562ec,0x6b2d1883,0x62ec6b2d,0x6b0c6b0c,0x39251000,0x20e428c4,0x000018a2,0x41e76b0c,0x94710820,0x084018c3,0x83cf8c10,0x20c349e8,0x21042104,0x316520e4,0x29030000,0x39e7736e,0x0020738e,0x08200000,0x29241061,0x316520e3,0x20c23144,0x7b8e0820,0x83f0736d,0x49e75249,0x20a25228,0x314520a2,0x314420c3,
-0x7b4d62cb,0x28823966,0x62aa3124,0x102049e7,0x290428e3,0x20c32904,0x00001061,0x29039471,0x188120c3,0x210318a2,0x20e22124,0x29031881,0x106020e2,0x10400800,0x20a128e2,0x184028e1,0x10201840,0x20801860,0x18a020a0,0x18600820,0x100028e2,0x20a11860,0x10401060,0x00000000,0x10610020,0x00000800,0x08200820,0x000020c2,0x00000800,0x000041c6,0x00000000,0x29240000,
-0x396441c6,0x290339a5,0x734c39a5,0x5a6920c2,0x39656aeb,0x39643945,0x29033985,0x39a428e2,0x398420e1,0x31034185,0x394328e2,0x20c21040,0x39853984,0x5a8849e6,0x398541c6,0x4a0641c6,0x49a43943,0x5a4649e4,0x52265206,0x30e16267,0x30e028a0,0x52273963,0x206028e1,0x20612040,0x10001000,0x10401020,0x83ee20c2,0x522883ae,0x000020c2,0x20a120a1,0x28c11881,0x39641860,
-0x39867b8e,0x49e65268,0x39434185,0x29033123,0x104028e3,0x312320c1,0x29223944,0x18603984,0x08000800,0x08001040,0x736d0800,0x31656b0c,0x31253145,0x31243125,0x29033165,0x20c22903,0x28e22923,0x41a63144,0x29243165,0x20e23144,0x49825225,0x51e549a4,0x28804163,0x6b0b2902,0x6b2c6b2c,0x6b4d738e,0x73af7baf,0x41e8426a,0x732e738f,0x7bcf3147,0x29457baf,0x20c42905,
-0x7baf83cf,0x49c85209,0x734e838f,0x736e7b8f,0x738e6b2d,0x73af83f0,0x73af73cf,0x6b2d736e,0x62cb6b0c,0x31665a4a,0x41e74a29,0x10200000,0x00001860,0x18c20000,0x21030840,0x4a287bae,0x000020c3,0x210418c3,0x00000000,0x00000000,0x5acb6b4d,0x21042124,0x20e31081,0x20c31861,0x41e662ca,0x00000840,0x7b8e5248,0x20e483cf,0x8c102924,0x52691881,0x62ec62cb,0x5acb62eb,
-0x7b8f62ec,0x288262ac,0x31452082,0x20821020,0x20e31840,0x41e739a6,0x39a60820,0x08000820,0x20c220c3,0x082020c3,0x18a20840,0x10611881,0x20c21060,0x10603144,0x20801840,0x20801860,0x10202080,0x18401840,0x20c01020,0x20a12901,0x20812080,0x18800800,0x082018a0,0x00000000,0x00000000,0x20c20000,0x18a12903,0x08000820,0x18c218a1,0x000020e3,0x00000000,0x10610000,
-0x41c63964,0x41a53985,0x312441c6,0xad546b2c,0x52482944,0x41e752a9,0xa4d2bd96,0x5aa883ef,0x29233964,0x31233123,0x310228c1,0x28e128e3,0x4a063102,0x39863985,0x31444a08,0x39243164,0x52064185,0x28c049a2,0x62464163,0x31004182,0x41a44182,0x41835206,0x310028a0,0x18201000,0x10601820,0x08201040,0x738e5acb,0x8410840f,0x8c108c51,0x20c13986,0x18411040,0x62691820,
-0x20c283cf,0x10201880,0x41c53143,0x39641020,0x316418a0,0x41a52923,0x31033144,0x312328c1,0x394428c1,0x102028e1,0x08001040,0x20e21020,0x31453164,0x41c63165,0x31453145,0x20a141c6,0x18601860,0x18a11060,0x292420e3,0x29242904,0x418341a4,0x41424183,0x6b0a3123,0x734d736d,0x08205aaa,0x31860800,0x738e7bf0,0x2925526a,0x8c325acb,0x7bd07bd0,0x39e8526a,0x294639a7,
-0x314641e8,0x6b2d3166,0x49e8734e,0x736e6b2d,0x630c6b2d,0x106252ab,0x630c2104,0x5acc6b4d,0x734d6b2d,0x7b8e7b8e,0x10619cb2,0x9c720800,0x31033965,0x18c220a2,0x08402103,0x00001000,0x18c318a2,0x10814248,0x29040800,0x6b2d738e,0x00002965,0x18a21082,0x18a21081,0x5aaa1861,0x9cb2738d,0x8c5083ef,0x736d7bcf,0x9c928c30,0x28c31062,0x28a23945,0x5a8b3987,0x6b4e1062,
-0x738e738f,0x10005269,0x28e33165,0x20e320c2,0x39a53986,0x082020c2,0x20c11040,0x28e320c2,0x000018a1,0x10811060,0x18a10000,0x10800800,0x100020e1,0x08000800,0x10001000,0x314320e2,0x20a12923,0x29023143,0x28c120e2,0x208128e2,0x290220a1,0x20c220e2,0x29232943,0x08400000,0x210439c7,0x188118e3,0x00001881,0x08000000,0x522820c2,0x000020a1,0x00200000,0x00201061,
-0x39852923,0x398541a5,0x41a641c6,0x41c64a07,0x5a8941e7,0x6b2c94b1,0x83ef8c0f,0x52273164,0x62ca6b0b,0x39444165,0x392349a5,0x49c53944,0x20c128e1,0x41c75268,0x41a639a6,0x41a63985,0x49e549e6,0x30e04182,0x20802080,0x39414982,0x28e12080,0x18404184,0x184128a1,0x100028a1,0x10401820,0x4a282102,0x7bcf62ec,0x62eb630c,0x83cf630b,0x94508c0f,0x628aa4b2,0x49e762aa,
-0x29235aaa,0x316420a1,0x08000800,0x18610820,0x20e120e2,0x41a520c1,0x20812903,0x310328e2,0x30e23944,0x39631840,0x29033144,0x20e120c2,0x316420e2,0x31443985,0x41a641c7,0x39a441e6,0x31442924,0x39a64a06,0x39863165,0x39c63986,0x41a53144,0x30e33123,0x734d83cf,0x630c6b6e,0x18821082,0x21043145,0x210431a7,0x31662945,0x7bd0736e,0x630d18c4,0x5aec632d,0x29252946,
-0x84107bcf,0x94518c11,0x83f083d0,0x20e46aec,0x5acc62ec,0x524a632d,0x292518a3,0x6b2d18a3,0x29241041,0x62ec8c10,0x10000800,0x8bf08baf,0x7b6e8bf0,0x20c449e8,0x28c41842,0x20e328e4,0x212439a6,0x20c30000,0x5a291861,0x28c31020,0x10822925,0x084120e3,0x00000820,0x7bce28e3,0x7bce9cb2,0x20c31020,0x83cf20c3,0x6b2dad14,0x31255249,0x5a6b1042,0x3966734e,0x62ec18c3,
-0x62ec734e,0x29242945,0x312483ef,0x000018a1,0x08201061,0x20c220e3,0x28e24a06,0x20a21040,0x08400820,0x10800000,0x18a110a1,0x00002923,0x188218a1,0x080062cb,0x20811860,0x29020800,0x20c128e2,0x29022902,0x31032923,0x28a228c1,0x104020a1,0x00000820,0x00001041,0x18a10000,0x00000000,0x00000000,0x39860000,0x39850800,0x08001040,0x08201020,0x10610000,0x00000820,
-0x398439a5,0x4a073985,0x41a641a6,0x39a63985,0x7bad41c6,0x3965736c,0x62eb732c,0x316441e7,0x6b4c5a89,0x62683964,0x5a697b6d,0x31234165,0x316520e2,0x186141c6,0x524820a2,0x736c83ad,0x41c55a89,0x396249a4,0x310128c0,0x28602020,0x28a11800,0x18202020,0x18401840,0x20601820,0x08001020,0x83cf20e3,0x4a4852ca,0x20c141c5,0x00000820,0x394428e4,0x10003123,0x7b2d1800,
-0x732d730c,0x31023104,0x10001841,0x10002080,0x00001000,0x10600800,0x41a539a4,0x5a893144,0x4a272903,0x738d7b6d,0x9c918c10,0x31230000,0x29022922,0x7b8e39c6,0x10404a28,0x418428e2,0x4a073985,0x4a272102,0x29443145,0x39a62965,0x41c639a7,0x83cf5aaa,0x6b8e738e,0x19045aeb,0x29654a69,0x292439a6,0x10823166,0x28e320e2,0x08220000,0x318731a8,0x296739e8,0x31873187,
-0x5aec3a09,0x7bd09493,0x630c8c52,0x39c720c4,0x41e918a3,0x10820001,0x6b6e5acb,0x7bef6b6d,0x7bae7bcf,0x08005aaa,0x6aaa2021,0x8c107b8e,0x838f83d0,0x316562ac,0x738e7bae,0x8c307bce,0x00004208,0x08003145,0x83cf734d,0x41867b6e,0x20e318c3,0x00000000,0x18c220e3,0x00001040,0x20c20800,0x000020e2,0x738e0820,0x292441e8,0x632c39a7,0x738e632c,0x7bcf73af,0x10837bb0,
-0x41e80001,0x9cb27bf0,0x29456b2c,0x00000000,0x00000000,0x08000000,0x10400820,0x00000000,0x21030000,0x00000000,0x000018c1,0x00000000,0x00000800,0x30e30800,0x20c120a1,0x188120a1,0x20e22902,0x28e20000,0x210328c2,0x20a228e2,0x10002061,0x39850800,0x10409450,0x20c20000,0x00000841,0x00000000,0x00001882,0x49c71020,0x9c513986,0x29231060,0x29043165,0x082020e3,
-0x41843964,0x39644a07,0x4a063143,0x5a6949e7,0x7bce732c,0x4a078c0f,0x41e63144,0x4a274a27,0x6b2b4a48,0x31023964,0x18616aca,0x31234144,0x5a6941e6,0x83ce6b0b,0x31239c71,0x394328e2,0x396241c4,0x28c028c0,0x28a028a0,0x392149a3,0x28a02080,0x18401800,0x20602881,0x18202060,0x41c61840,0x18c23984,0x2923736c,0x18811020,0x20810800,0x18201020,0x416430e3,0x72ec49a6,
-0x8bf083cf,0x3144734d,0x10001020,0x31032080,0x39853944,0x28e228e1,0x080020e2,0x734c1040,0x83ae83ae,0x000062ca,0x5a893985,0x10403145,0x18601880,0x18a11861,0x314541e7,0x208120c2,0x41861861,0x188141a5,0x18611000,0x5acb3185,0x83cf6b2d,0x7b6d7b8e,0x1081736d,0x210318a2,0x39c720e4,0x6b4c5aaa,0x08000801,0x08000800,0x39c83166,0x31a839c8,0x31a831a8,0x31873187,
-0x39e82966,0x10a339e8,0x41e80842,0x18c341c8,0x7bf0736e,0xa5357bf0,0x29453187,0x39e79492,0x49e80000,0x20823104,0x730c6acb,0x62cc83f1,0x83d08c31,0x7bae7b6e,0x83ef7bae,0x080083ef,0x08000800,0x20c35a69,0x838f7b6d,0x62ab838f,0x00003166,0x10812124,0x08201040,0x31241040,0x18a220e2,0x00002903,0x7bcf5249,0x20e36b2c,0x18e30000,0x4a4952aa,0x318620e4,0x8c720842,
-0x94929491,0x31654a69,0x10822944,0x29030820,0x29233144,0x20e22903,0x314418c2,0x20e12102,0x31642903,0x108118c2,0x00000000,0x18800000,0x102020a1,0x188120a1,0x18a11040,0x29242923,0x08200820,0x00000000,0x00000820,0x18811040,0x20a21040,0x62aa4a07,0x00000000,0x08200800,0x000020e3,0x00000000,0x39850800,0xb57520c2,0x62eb8c30,0x290441e7,0x31652904,0x31651081,
-0x41c65227,0x52074144,0x396441a5,0x7b8d62ca,0x730b7b6d,0x080028a1,0x29023924,0x20c120e2,0x20c10820,0x20a11040,0x28c21820,0x39863144,0x5a689430,0x10003164,0x6aca72e9,0x30a128c0,0x186028a0,0x20801860,0x31012080,0x5aa941a5,0x41a5c5d6,0x392230e1,0x102028a0,0x31021860,0x41c61881,0x28a14183,0x28e21000,0x18610000,0x18201800,0x39841840,0x316541a5,0x7b8d5269,
-0x8c107bcf,0x7bae8410,0x310451e7,0x18a028c2,0x18611840,0x10202080,0x08000800,0x10401861,0x51c62881,0x28e228c2,0x318639c6,0x31654229,0x18600820,0x18601020,0x41e84a07,0x41a74a29,0x10001841,0x08001020,0x7baf4a08,0x7bcf734d,0x41a67bae,0x10001020,0x316530e4,0x18810000,0x5aab4209,0x7b8e83ef,0x7b8d8c10,0x080020e2,0x39863145,0x31a741c8,0x318739c8,0x41e839a7,
-0x08411061,0x31862925,0x00002104,0x00003125,0x318720e4,0x29442946,0x10812944,0x08201081,0x08210800,0x7baf734e,0x8bf0736e,0x7bcf8c10,0x734f7baf,0x62eb736e,0x106218a2,0x00005269,0x18212062,0x94312904,0x94928c10,0x738e9cb2,0x316620e4,0x39c72104,0x08202103,0x62eb0840,0x21032924,0x41c620e3,0x5aab736d,0x20c341e8,0x106118c2,0x20e318c3,0x21241081,0xa51318e3,
-0x29440000,0x00002143,0x00000000,0x30e10800,0x00000820,0x00000000,0x00000000,0x39c62123,0x84105aeb,0x00000000,0x20c20000,0x10620800,0x00000000,0x00000000,0x000010a2,0x42070000,0x08404227,0x10000000,0x18a21000,0x8c501882,0x41e72924,0x08000800,0x080028c3,0x08002082,0x10200000,0x94913965,0x9cb29492,0x39a6632c,0x31653185,0x10812965,0x00202924,0x4a480020,
-0x7bad83ce,0x3103730b,0x5227730b,0x734c7b8d,0x5a897b8d,0x41854184,0x39843944,0x29233143,0x31233143,0x20e241a5,0x206028c1,0x29033964,0x39842903,0x39433123,0x416430e1,0x18204164,0x20a028c1,0x18405226,0x20802040,0x51e72040,0x62685207,0x49846a67,0x49c528a1,0x08003943,0x20c20820,0x18401840,0x83ad1840,0x08000820,0x416430e1,0x41a42060,0x39854164,0x6aca3944,
-0x734d7b6e,0x204128a3,0x7bee736c,0x8c10840f,0x10201861,0x08002061,0x08000800,0x41c639a6,0x394441a5,0x41c55227,0x39863143,0x94715aab,0x49c583ef,0x39841840,0x31863144,0x628b4a09,0x41867b6e,0x18811020,0x6b0c734d,0x08000000,0x41051842,0x5a293904,0x08003104,0x62aa1020,0x8c318410,0x62ab8410,0x52077b4d,0x18811020,0x62cb3145,0x41e941c8,0x39873146,0x7baf738e,
-0x39c7736e,0x420718c3,0x41c718c2,0x4a0849e8,0x29c73166,0x29642166,0x00000000,0x18a20820,0x83f09cb3,0x83f08c11,0x83f06b2d,0x736e7b8e,0x2925738e,0x20c32104,0x00000800,0x94515a8a,0x5a4928c3,0x83cf5a8a,0x94714a29,0x94928c51,0x8c308c51,0x8c318c51,0x52694a69,0x42085aca,0x00002944,0x18a218a2,0x398620c2,0x5aaa6b0c,0x18e31041,0x5acb18c3,0x00000000,0x08610000,
-0x00000881,0x00000000,0x00000000,0x18600820,0x000020a1,0x00000000,0x08200000,0x00001081,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08000820,0x08200000,0x4a2839a5,0x310428c2,0x104030e3,0x41c63124,0x00003145,0x00002124,0x83ef20e3,0x8bef9451,0x9c719430,0xad14a4d3,0x9471b555,0x00006b4c,0x18c20820,0x18e30861,0x084018e3,0x94910000,0x00002103,
-0x7b8e7b8e,0x7b8e8bf0,0x52697bae,0xce17a4d2,0x6aeb8c2f,0x49e74164,0x39644165,0x39643984,0x31233143,0x31643964,0x28c13923,0x188020c1,0x290120e1,0x28e120e0,0x28a03102,0x28802060,0x62c92060,0x208062a8,0x20812040,0x5aa9c5d6,0x286120e2,0x30a12820,0x10402820,0x08001020,0x949252aa,0x52079c31,0x41a528c2,0x20c14a27,0x31032060,0x30c051e6,0x184030e1,0x10001820,
-0x20811000,0x290228e3,0x49a61000,0x39a46269,0x20c028e0,0x83ad1860,0x49e76aea,0x49e749e7,0x398541e6,0x5a8849e6,0x18800800,0x08200800,0x7b4b736d,0x10603964,0x6b6e734c,0x7b4e736e,0x62ab736e,0x49e749e7,0x6b0c3145,0x7baf83cf,0x83ae7bcf,0x93cf8bcf,0x41c69430,0x39041820,0x31863166,0x39863165,0x18003905,0x39a52061,0x83ef7b8e,0x62ac83b0,0x524a49e9,0x83f05acb,
-0x6b2c8410,0x20e220e2,0x20e40860,0x83cf5a6a,0x100039a7,0x18011000,0x7aec1000,0x83ef7bae,0x83cf1882,0x83f08c31,0x736e7b8f,0x7bcf7b8f,0x62eb83f0,0x00000840,0x41c72904,0x8c10734c,0x18c241e7,0x736e7baf,0x08002904,0x00000000,0x29250000,0x39c72945,0x4a480841,0x086162eb,0x20e37b8d,0x10401881,0x18a220e2,0xb55583cf,0x210318a2,0x18e32944,0x18a21061,0x000010a2,
-0x00000000,0x00000000,0x184018c3,0x00000800,0x20c21860,0x18811060,0x00000000,0x00000000,0x00000000,0x00000000,0x18610000,0x28e21020,0x18601860,0x10200800,0x10211000,0x08000800,0x08400000,0xb5968c50,0x6b0b83ef,0x10610800,0x94915269,0x9cf38c50,0x9cf39cd2,0x73aea534,0x00202944,0x10610861,0x39a61081,0x29442924,0x000018c2,0x00000000,0xc6173186,0x00000000,
-0x5aca5269,0x7b8d4a27,0x732ca4b2,0x52685268,0x83ae5aaa,0x83cf83ae,0x8c2f6b2c,0x41a54a06,0x396441c5,0x39643964,0x31233144,0x31023944,0x31632081,0x31023143,0x628a3964,0x18403944,0x31031800,0x62ea8c0f,0xad345a68,0xb596734d,0x7b8d6b2d,0x39026aea,0x5a673943,0x4a0549e5,0x8c5141c7,0xa4b28410,0x3103b554,0x29021040,0x392328c1,0x41843964,0x31013122,0x10001800,
-0x52473102,0x83ef9450,0x20a17b8c,0x100020c1,0x49c54184,0x18403944,0x28c21000,0x31854185,0x39a64a07,0x314541a6,0x182083cd,0x10001000,0x31051861,0x10206289,0x080020a1,0x62aa3124,0x7b8f7b8e,0x1040734e,0x6b0b20e2,0x8c1083f0,0x8c1083f0,0x9c739451,0x83af9c72,0x7b4c3123,0x4a29736e,0x42084208,0x8430840f,0x52288c30,0x7b8f0800,0x83af9452,0x734e7b8f,0x312549c7,
-0x41c72904,0x106118a2,0x41c70800,0x10417baf,0x730c8bd0,0x9c1072ec,0x7bce8bef,0x18822924,0x9cd362ec,0x7b6e734e,0x6b4d734e,0x7bd0738e,0x39a618a3,0x42080800,0x8c3083ef,0x00009471,0x94727bae,0x10627bcf,0x734d738e,0x08210821,0x00001082,0x18c32904,0x18822904,0x20e418a3,0x39e683f0,0x4a2818a2,0x39c66b0c,0x290410a2,0x18e20800,0x21230000,0x000018c2,0x00000000,
-0x00000000,0x00000000,0x08000000,0x20e120a1,0x20a128e2,0x188028e2,0x00000840,0x00000000,0x00000000,0x00000000,0x18a12924,0x20c218a1,0x10202903,0x10001820,0x28e30800,0x18601020,0x4a071882,0x00001061,0x00000800,0x41e70000,0xad549cb2,0x0020630c,0x08610020,0x00000000,0x39c63164,0x20e30841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x210318c3,
-0xa4d36b2c,0x62eb8c30,0x49e74a07,0x5a894a28,0x5a695aa9,0x62eb5248,0x94717bae,0xad139471,0x41c68bef,0x39855248,0x314439a5,0x39433102,0x31433123,0x30e23964,0x28a03123,0x49c649a5,0x30e23944,0x41a520e2,0x62ca3144,0x84108410,0x3186528a,0x5a8a4a07,0x208049a5,0x18403943,0x8c1049e7,0x39857bae,0x18001820,0x10001820,0xa4d24a47,0x08007bae,0xacd3acf2,0x10403144,
-0x08001000,0x28c20800,0x20602881,0x10001000,0x08001000,0x49e628e1,0x10001860,0x00000800,0x20e30800,0x49e74a08,0x49c649e7,0x52275a47,0x7baf6aea,0x62eb9470,0x31655a69,0x736d20e3,0x29057baf,0x186128e4,0x20c28c2f,0x00000800,0x18a20800,0x841083f0,0x83f08c31,0x8c308c0f,0x39c60840,0x736d20e3,0x528b8c52,0x7b8f18a3,0x736e83d0,0x83f083cf,0x7b8f83d0,0x31453125,
-0x526a41c7,0x000020c3,0x08210820,0x83af2905,0xad158bcf,0x8c11a4b3,0x8bb08c11,0x5aaa0000,0x20a20800,0x947262cc,0x83f08c11,0x10001883,0x10000800,0x7bae6b4c,0x00006b4d,0x08200000,0x62eb0820,0x6b4e738f,0x6b4d738e,0x736d5aec,0x20e32945,0x106220e3,0x19032104,0x292539a6,0x294420e4,0x39863145,0x528920e3,0x83cf8c50,0x296420c2,0x210318c2,0x00000000,0x00000000,
-0x00000000,0x10000000,0x28e32082,0x18811040,0x20e30800,0x10201881,0x082028e2,0x08000800,0x10601060,0x29020800,0x21023123,0x00002943,0x00001040,0x20a21861,0x94305a69,0x000041c7,0xbd9641c6,0x41e7a4f3,0x000083ef,0x292418c3,0x00000820,0x18c30000,0x31a52964,0x39c52963,0x00000860,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,
-0x39853985,0x31243144,0x732c4a07,0x39a55a89,0x4a284a28,0x52497b8e,0x41e739a6,0x4a285269,0x41a6736d,0x52285a89,0x41a549c6,0x51c65206,0x41a549a5,0x39863964,0x418462aa,0x39433102,0x730b49c5,0x4a4883ee,0x39643964,0x41c641c5,0x292441e7,0x7bad3186,0x6aea736c,0x41a54a07,0x186120a1,0x83ce0840,0x62aa9c91,0x39645227,0x31233103,0x20c23103,0x31046b0b,0x5228626a,
-0x310249c5,0x18201800,0x83ae49a7,0x28c29cb2,0x18001000,0x18202040,0x62a94165,0x08000800,0x00000000,0x526920a2,0x49e61861,0x390151e5,0x8c304985,0x8c719471,0x62caa4f3,0x10201020,0x94511040,0x4a089451,0x10001000,0x08001000,0x52893123,0x62ab18a2,0x7c108410,0x83ef8430,0x08000000,0x31441040,0x2946524a,0x8bf039c7,0x7baf83f0,0x524a62ec,0x83d083f0,0x5a8b62cc,
-0x8c518c52,0x31457bf0,0x41c720e3,0x49e839a6,0x945283af,0x94329472,0x08005a8b,0x188120e3,0x62cb2923,0x7bcf7bcf,0x8c518410,0x7bad8430,0x6acb1020,0x5aa97bce,0x08200000,0x39452904,0x20e441c7,0x29452905,0x39e82986,0x08622946,0x21242124,0x18e42124,0x214418e4,0x29242924,0x29242945,0x62eb1082,0x4207738d,0x39a62103,0x082018a2,0x08001061,0x00000000,0x08200000,
-0x316520e3,0x208218a2,0x206128c3,0x28c33104,0x08202061,0x00000000,0x00000800,0x08000800,0x29031060,0x210228e2,0x08000800,0x00001860,0x9c7120e3,0xacf31041,0x10a220c3,0x7bcfa492,0x4a698c50,0x4a280000,0x00005289,0x00000000,0x00000000,0x21230880,0x10812123,0x08410000,0x00000020,0x00000000,0x00000000,0x10820000,0x0020a514,0x00000000,0x00000000,0x00005269,
-0x4a075269,0x31443985,0x524849e7,0x39a54a07,0x526939c6,0x524862eb,0x41e75249,0x73ae5aaa,0x94307b8e,0x5a695a89,0x41843944,0x312249a4,0x28a03943,0x28e130e1,0x41631020,0x396349c5,0x39633983,0x41a43123,0x314339a4,0x52273963,0x41c63965,0x398541a5,0x734c4a07,0x28e27b8d,0x08201040,0x10200800,0x52483124,0x62cb5aaa,0x52498c30,0x10205228,0x8bef0800,0x8c307b6d,
-0x39a55269,0x62a94a07,0x83ef8c10,0x83ef7bce,0x18409c71,0x20a21840,0x18801020,0x41c74a07,0x20811820,0x945049a6,0x20603944,0x39203921,0x104151c4,0x20a21061,0x08001861,0x10400800,0x52491040,0x83f083d0,0x398583ce,0x94316aeb,0x102049e8,0x30e32903,0x08200800,0x18401041,0x10001000,0x39c61860,0x39c739a7,0x524a41e8,0x39c7734e,0x8c722946,0x8c518c51,0x83f08c11,
-0x8c318c52,0x318673cf,0x6b0c3165,0x62ac62ec,0x8c10732d,0x7bf183f0,0x84108431,0x290420e3,0x7bae20c2,0x0000738e,0x6b4d3186,0x7b8d7bcf,0x83ae8bcf,0x31447bae,0x39c620e3,0x29249cb2,0x18a32924,0x31872925,0x18e410e3,0x190410c3,0x004118e4,0x08820882,0x18c30862,0x18a22945,0x20e318a2,0x39c62924,0x002039a6,0x18c210a1,0x000020e3,0x00000000,0x18a20840,0x20e31082,
-0x20c31881,0x28e32103,0x39433144,0x39643123,0x396428e2,0x29023123,0x10201860,0x28e33123,0x396420c2,0x08002903,0x08003964,0x62cb0000,0x7b8e9471,0x20c3732c,0x8c30acf3,0x00405acb,0x18c20000,0x7bae39a6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31661062,
-0x52483123,0x31245248,0x39a63124,0x398541c6,0x31643164,0x526941e6,0x5aca41e7,0x52485aaa,0x5aaa7b8d,0x83ef5aaa,0x6b4b9471,0x49846287,0x49e54963,0x41225205,0x30e030e0,0x30e030e0,0x28c03100,0x49a328c0,0x7b6c2081,0x31435268,0x314341c5,0x39a53964,0x398341c6,0x7b6d2902,0x41e6736c,0x52460820,0x184020a1,0x520749e6,0x524830e4,0x94307b8d,0x108141c6,0x8c4f4206,
-0x10205228,0x31031840,0x632b8c50,0x39850000,0x28e35207,0x398662cb,0x3104acf3,0x736d3965,0x8c519471,0x83ce2944,0x942f52aa,0x39005a26,0x312328a0,0x73ad736c,0x738d9cd2,0x526962eb,0x8c3183ae,0x8c318410,0x08011042,0x83af39a6,0x41a69431,0x732d628a,0x20e23144,0x10001020,0x18201820,0x838e0800,0x4a081041,0x7bd0736f,0x6b6e8c51,0x41e852ab,0x294539e8,0x730d28e4,
-0x8c3183f0,0x18c4524b,0x28e439a6,0x83f07b8e,0x8c728c11,0x7bf094b3,0x18416b0d,0x6b2c0820,0x18a2630c,0x949210a2,0x10822965,0x7b8e2986,0x5aca5aaa,0x1020736d,0x49e70800,0x20e31882,0x20c22924,0x18c318c3,0x29262945,0x10832125,0x086218c4,0x10a30021,0x10820861,0x10610820,0x08401060,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29242924,0x20e220c2,
-0x18a220c2,0x29243165,0x20a12903,0x18400800,0x08001000,0x18610800,0x28c328a2,0x20a12903,0x7bae0820,0x398620a2,0x102083cf,0x8c3018a1,0x31853986,0x8c50a514,0x42088430,0x00000821,0x29441081,0x10a11081,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21240000,0x18c3b555,
-0x31643985,0xa4b25248,0x39655248,0x52693985,0x5aaa39c6,0x39a64a29,0x4a2841e7,0x526841e7,0x8c305269,0x734c7bae,0xa4f29c91,0x62896b0a,0x7b6c6289,0x5a476288,0x52263962,0x49e549e5,0x29013122,0x41a43962,0x28a14184,0x20a03943,0x28e13142,0x29003142,0x31623961,0x41e53963,0x20c23164,0x9c718c10,0x39a51020,0x39852923,0x316528e4,0x8bef5a89,0x41855a89,0x28c21820,
-0x28a128e3,0x10001820,0x31241040,0x29034a07,0x49c628a2,0x7b6d8bf0,0x000049e7,0x7bcf7b6e,0x8c308c30,0x31648c50,0x41654144,0x6acb730b,0x396449e7,0x10003964,0x10001820,0x08001820,0x7bcf0800,0x8c519472,0x84107baf,0xbdb6a513,0x8c305269,0x83cf9451,0x0000840f,0x18401000,0x10002040,0x184028c1,0x104041c6,0x7baf3986,0x73af8c51,0x316652ab,0x528a1082,0x83d04a09,
-0x7bcf7bcf,0x7bcf524a,0x8c309cb1,0x84119471,0x2966738f,0x73ae8431,0x08000000,0x83ce20c3,0x39e739c6,0x31866b4d,0x39853186,0x526939c6,0x840f83ef,0x20a2ad55,0x08001881,0x41c7ad34,0x20c32924,0x39a62924,0x000018a3,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x08000000,0x49e62924,0x18a118a1,0x29033165,0x188120e2,
-0x94513165,0x10412903,0x29241881,0x947141c6,0x9451a4b2,0x6b2d8c10,0xad1483cf,0x9cb283ef,0x94919cd2,0x1882840f,0x49e76b2c,0x31453985,0xce58736d,0x526939a6,0x31a60020,0x21030000,0x21033164,0x294520e2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x39643143,0x41a63985,0x732c3144,0x31445248,0x83f02924,0xa5147baf,0x83ef7bcf,0x62ea62cb,0x41e64a28,0x6b2c2923,0x83ce39a6,0x7b8d73ad,0x8bae730b,0x6aea836d,0x940f7b6b,0x9cb1940f,0x8c2f944f,0xd678a4f2,0x9c4fc5b5,0x30e149c4,0x49c33942,0x39423920,0x292049c5,0x188020c0,0x316441e6,0x312341a5,0xa5138c30,0x0000bdb4,0x52483986,0x10414a08,0x4a273144,0x4a681060,
-0x31034a27,0x39651840,0x08001020,0x31231861,0x31243964,0x49e728e4,0x8baf8bef,0x000049e7,0x29240841,0x080018c3,0x31641820,0x52897bce,0x20e241e7,0x94710800,0x9492840f,0x6b4c8c51,0x7baf0800,0x7bd0738e,0x294594d3,0x18c30861,0x21030841,0x7b8f6b2c,0x31856b2c,0x20802080,0x39232061,0x28c39c31,0x8c4f0820,0x8c512903,0x6b4d9472,0xa535738e,0x39e84208,0x841083f0,
-0x94728410,0x00007bae,0x00001060,0x4a2910a2,0x630c62ec,0x00000021,0x5a681040,0x8c301061,0x0000738d,0x00000000,0x08200000,0x18a20800,0x8c507bae,0x314420e3,0x29033124,0x20e318a2,0x31652924,0x00000821,0x00000000,0x00000000,0x10610000,0x00000000,0x00000000,0x08400840,0x10a11080,0x00000000,0x00000020,0x20e21020,0x00009470,0x00000020,0x41e620e2,0x08005248,
-0x08201041,0x08000000,0x840f1040,0x94518c71,0x082141e7,0xad76bdd7,0x7bcfa4d3,0x42088c31,0x18e30020,0xa4f30840,0x31247b8d,0x4a284a28,0x18c30800,0x00000000,0x18c30000,0x29233185,0x18a220e3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29650861,0x08410841,
-0x39853985,0x49c649a6,0x418549c6,0x6b0c3145,0x29245aab,0x4a283986,0x9cb24a29,0x83ef7bcf,0x83ef736d,0x83cf7b8e,0xad334a28,0x62897bce,0x94506aeb,0x8bee8bee,0x9c919c70,0x7b6d83ce,0x6b0b6b0b,0x734d8c2f,0x9cd2736d,0xce17a513,0x5a47cdb6,0x30e04164,0x52057b2a,0x30e13922,0x41a53944,0x396449e5,0x18813164,0x4a0641c5,0x28c22902,0x28e35a68,0x10408bce,0x31248c2f,
-0x08008c30,0x39236aaa,0x31233964,0x39643103,0x31031020,0x20a21861,0x5a8a20a2,0x4a08734d,0x08001040,0x41e618c2,0x10605249,0x39a620c3,0x21023144,0x62ea3985,0x8c3039a6,0x84107bae,0x5a899cb2,0x08400840,0x39a60000,0x39c64206,0x41c74a48,0x084139a6,0x7bcf6b2c,0x080062ca,0x4a073143,0x28e22944,0x10202060,0x840f5acb,0x4a6a83f0,0x41e71062,0x39c63165,0x52aa10a2,
-0x630c18c3,0x7bce8450,0x31443164,0x10611081,0x10201882,0x18820000,0x39a639a6,0x00003164,0x08200000,0x18811020,0x08001861,0x188220c2,0x29240821,0x29653165,0x210320e3,0x20e220e3,0x20a228e3,0x18c22923,0x18a13165,0x41c618a1,0x39a43165,0x08003124,0x00000820,0x00000800,0x00000000,0x00000020,0x00000000,0x00200000,0x4a280000,0x00000000,0x00000000,0xa4f33985,
-0x104041e7,0x00000800,0x00000821,0x20e21061,0x4a490820,0xa4f49cd3,0x08202944,0x20c31040,0x31652104,0xa514a514,0x9491a4f3,0x84108c30,0x10813165,0x00000000,0x18a10000,0x00000800,0x00000000,0x00000000,0x00000000,0x18820800,0x31443165,0x39a62924,0x5aaa39a6,0x29245aaa,0x00000820,0x00000000,0x00000000,0x08201061,0x4a0741e7,0x29442103,0x39862944,0x29043145,
-0x734c5a88,0x41656289,0x49e641a5,0x39a541c6,0x39a63144,0x41c73986,0x49c739a7,0x62eb5249,0x8c0f9c92,0x62cb6b0b,0x8c718410,0x29254228,0xa4d341a7,0x62896aeb,0x41a64165,0x734c6289,0x9c919c91,0x52485aa9,0xa5138410,0x732d9cb3,0x6b4c49c8,0xa4929cd2,0x730b9c70,0x5a273923,0x31434184,0x28c03963,0x39833102,0x944f3984,0x31023964,0x49e63963,0x41859c50,0x28c34185,
-0x5a286269,0x30e24985,0x20802080,0x49c620c0,0x9c719c51,0x6b4d9452,0x000020e3,0x4a070820,0x08003144,0x10400800,0x18a01882,0x08201020,0x00000820,0x08200800,0x18200820,0x18611861,0x00000800,0x00000000,0x00000000,0x39c618a1,0x398541e7,0x396441e7,0x20a23103,0x08001040,0x31440800,0x49c641c6,0x4a063943,0x10404a47,0x31651041,0x00001882,0x00000820,0x08200800,
-0x08000800,0x18c10000,0x080020e2,0x08000820,0x08000000,0x39e83986,0x39c739e8,0x29853186,0x18c22103,0x31653145,0x39863186,0x39a63166,0x31653986,0x08202124,0x21240820,0x18a00000,0x08001040,0x00000800,0x29441881,0x18a22944,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x000010a2,0x00000000,0x00000000,0x08200000,0x00000000,0x31650000,0x31444a07,
-0x00000000,0x00000000,0x20c30000,0x10800000,0x00000000,0x00000000,0x00000000,0x00000000,0x10810000,0x52881080,0x18a24227,0x31854208,0x6b0c3185,0x1882b575,0x41842923,0x00000000,0x29240000,0x20c30000,0x5a8a2904,0x188120c3,0x29040820,0x000020c3,0x00000000,0x08400840,0x29452103,0x00001082,0x08200000,0x83cf18a2,0x39852904,0x08203165,0x39a60820,0xa5139491,
-0x49c54164,0x41655a48,0x6aca3964,0x4a4762ca,0x41e739a5,0x62eb83ce,0x62cb5acb,0x42075249,0x4a2841e7,0x4a283165,0x73ae528a,0x949283f0,0x94508c51,0x8bcf8c0f,0x72eb7b2c,0x39445a69,0x39443123,0x31643984,0x3185630b,0x6b2c3145,0x630c83ef,0x732c630c,0x8bae6aca,0x6aca6aca,0x394320a0,0x52275227,0x28e14a05,0x28e141e6,0x28e24983,0x39445a69,0x290341a5,0x94501881,
-0x310328c2,0x418549e6,0x41844184,0x20605a48,0xbd9649a5,0x7c109c92,0x9c92a513,0x31233985,0x100030e3,0x10201000,0x20811800,0x41a6acf3,0x08000800,0x00000800,0x10000800,0x08001000,0x08201000,0x00000000,0x08000800,0x08201861,0x41c72923,0x4a0739a6,0x4a2841e7,0x18601860,0x08001000,0x10201000,0x28e220a1,0x10201000,0x08000800,0x08001020,0x18610800,0x00000800,
-0x00000820,0x00000000,0x10000800,0x08001000,0x41852903,0x318739a6,0x316639c8,0x29242945,0x31652944,0x29462945,0x29453186,0x31862945,0x21042104,0x29242104,0x29242904,0x29243144,0x08400840,0x00000800,0x00000000,0x00000000,0x00200820,0x00000000,0x00000820,0x10610000,0x00000000,0x00000000,0x08000000,0x08200000,0xad330820,0x39853144,0x00000800,0x00200000,
-0x000020e3,0x00000800,0x08000000,0x31651041,0x188118a2,0x31441881,0x08201041,0x082039a6,0x10402923,0x08200820,0x00000000,0x20e20840,0x62eb20e2,0x630b6b4c,0x102020c2,0x00000000,0x00000800,0x00000800,0x00000820,0x00000000,0x00000000,0x00000000,0x62eb4a48,0x00000000,0x00000000,0x00000000,0x00000000,0x31640841,0x290320e2,0x18611000,0xa4f339a6,0x83efa4f3,
-0x31034164,0x49c64165,0x41a55228,0x39644185,0x524849e6,0x00005269,0xa4d3b596,0x736d83f0,0x39a683ef,0x31443184,0x39a53165,0x39c73186,0x8c1062ec,0xa4d29451,0x20a2732c,0x41a528e3,0x49c64165,0x3984736b,0x49e63984,0x29246b0c,0x5acb4a28,0x9cd3a4f3,0x838d83ce,0x39445a48,0x394351e5,0x41633922,0x31213141,0x18809470,0x18601840,0x730b3943,0x41c66aca,0x41c641c6,
-0x28e241a5,0x5a484165,0x83ce5248,0x312562a9,0x29045208,0x526a3986,0x49a63945,0x28e12080,0x39633102,0x392341a5,0x20802040,0x10200000,0x00000800,0x00000000,0x31440000,0x080083ee,0x10200800,0x08000800,0x08001020,0x08001040,0x10401000,0x18401840,0xacf35a49,0x94708c0f,0x18400800,0x6aca1000,0x0800940e,0x08001000,0x08000800,0x18610800,0x10400800,0x00001040,
-0x00000000,0x08201000,0x31453185,0x398639a6,0x28c31882,0x108318a3,0x002110a3,0x316520e4,0x31660841,0x31662925,0x29243187,0x29232945,0x31852103,0x29242965,0x31453165,0x00001060,0x00000801,0x00000800,0x00000000,0xa4f30020,0x00000000,0x00000000,0x0000a4f4,0x00000000,0x00001040,0x000020e3,0x08000000,0x31440800,0x18a118a2,0x20e32944,0x00000000,0x10810800,
-0x29240000,0x316539a6,0x20e22903,0x20c21060,0x20c220c2,0x188120c2,0x94715aaa,0x20811000,0x00007b8e,0x10200800,0x10611041,0x31643185,0x20e30820,0x632c18c2,0x08001040,0x08000000,0x31454a28,0x000083cf,0x00000820,0x08402124,0x10610000,0x08200000,0x00000000,0x00000000,0x00000000,0x10820841,0x00000000,0x00200000,0x00200841,0x00003165,0x00000000,0x210318a2,
-0x72eb730b,0x41a541a5,0x41444985,0x39843924,0x312339a4,0x20c339c6,0x94715249,0x41c683ef,0x398562eb,0x39843985,0x31643985,0x39653124,0x398641a6,0x7b8d3145,0x18828410,0x3101a491,0x20a02080,0x39213922,0x39434184,0x29024a06,0x10812965,0x734c630b,0x7b6da4d3,0x49a46aa9,0x49c44183,0x31203121,0x414230e0,0x41857b2c,0x5a2730e2,0x18402080,0x102130e1,0x41c562ca,
-0x41a52902,0x62eb3985,0x41864186,0x62eb28c2,0x738d738e,0x526a5289,0x30a14a08,0x49c651e6,0x41a53124,0x39433102,0x52074185,0x10401020,0x292441e7,0x00200000,0x08000800,0x945183cf,0x31039c70,0x20c21020,0x4a4741e6,0x31234206,0x10201881,0x18001000,0x20402061,0x6b0b1881,0x28c26b2b,0x10001820,0x20410800,0x00001000,0x10000800,0x10801040,0x08001020,0x10001000,
-0x10001000,0x10401840,0x316639c7,0x31863166,0x31662925,0x39a739c7,0x318639a7,0x31653165,0x316620c3,0x29452966,0x21233187,0x08610860,0x00000840,0x00000800,0x08000800,0x08001000,0x08000800,0x00000800,0x00000000,0x00000840,0x00000000,0x00000820,0x00000000,0x08000800,0x9cb20000,0x00000000,0x08210021,0x00000000,0x00002103,0x39a60020,0x31454a08,0x39653165,
-0x39a639e7,0x318539c6,0x21032103,0x18a21882,0x10611061,0x08401061,0x20c31041,0x31242903,0x28e33124,0x00003124,0x6b2c0820,0x00000000,0x4a480000,0x41e71081,0xce592925,0xa4f38c51,0xc5f79cd3,0x00000821,0x08200000,0x00001061,0x00002924,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000820,0x21030840,0x20e30000,0x00200000,
-0x5a0651c5,0x72ca6a89,0x51a6830a,0x52073922,0x310328c2,0x420741e6,0x210339a5,0x736d736d,0x9cb29c92,0x31635a89,0x39833963,0x314341c5,0x31222922,0x28c12901,0x942f3144,0x28a03963,0x28c020a0,0x104028c1,0x314128e0,0x5a8928e1,0x31858430,0x20e31082,0x7b8d62cb,0x41433102,0x41635205,0x41a23962,0x39404160,0x394049a2,0x31224160,0x28a030e0,0xad1220a0,0x1020bdb5,
-0x10201881,0x10204a07,0x290339a6,0x312449e7,0x3185738e,0xa51418a2,0x39204a08,0x31013921,0x62a949c6,0x396441c6,0x41a61020,0x1000628a,0x18001000,0x28211000,0x51e838a3,0x000020c3,0x10401881,0x08000800,0x20c20000,0x28e24a07,0x520749c6,0x10003103,0x18201000,0x28a21860,0x41a53985,0x5a6828e2,0x206049a5,0x08001840,0x31041000,0x94318c0f,0x18207b2c,0x10001820,
-0x20601840,0x526941a5,0x398739c7,0x316639a7,0x29453166,0x318641c8,0x29461082,0x20e339a7,0x31462905,0x318639a6,0x00003165,0x00000000,0x00001860,0x314420c2,0x9c9162eb,0x5a895248,0x08005289,0x10001000,0x00000000,0x0000630b,0x420883ef,0x31650000,0x5aca1061,0x41c7b575,0x29443144,0x18403103,0x00003985,0x21040820,0x00000000,0x08200000,0x29658c71,0x316520e3,
-0x316539a6,0x20e339c6,0x29042924,0x18a218a2,0x18e320c2,0x210418a2,0x20e320e3,0x41e741c6,0x29033165,0x18a21040,0x00000000,0x00000000,0x00000000,0x08201061,0x21040000,0xa4f4ad35,0x6b4d9cb3,0x00000000,0x4a280020,0x10610000,0x08418c30,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00009492,0xa5134a48,0x00000000,0x00000000,
-0x49834983,0x728659c3,0x620451a0,0xac9172a7,0x31036acc,0x39a54185,0x29242102,0x292439a6,0x31453145,0x4a064a27,0x316241c3,0x524941a6,0x5a073145,0x39224185,0x398441c5,0x28a01860,0x392120a0,0x5aa85248,0x20a03962,0x20e262c9,0x9cd28c50,0xad34840f,0x940f83ef,0x392249c5,0x30e128e1,0x49c241a3,0x390130e1,0x51a34983,0x5a464120,0x28c06266,0x39a330e0,0x522820a1,
-0x62a9b533,0x31241020,0x08401040,0x83ef83ce,0x21039491,0x52693165,0x72a8730e,0x732b4985,0x102049c6,0x7b8d0000,0x2062730c,0x392428c3,0x838e5a28,0x62299450,0xb4f36aaa,0x83cf9410,0x31033985,0x186120c2,0x206028a2,0x182028c2,0x10201820,0x20601840,0x20604185,0x20401820,0x294328c2,0x738c39a5,0x6aab8baf,0x9c0f8baf,0x08001800,0x31060000,0x498451e7,0x628849c6,
-0x51e56a68,0x31242081,0x31862945,0x39c84a29,0x41c83186,0x528a9492,0x20e40841,0x21043165,0x83f09c92,0x18819450,0x29020800,0x080041c5,0x28e15207,0x632c18a1,0x2945840f,0x00000820,0x10000000,0x10001800,0x08201860,0x00000861,0x00000820,0x00000000,0x00000820,0x08000000,0x08200820,0x00000000,0x00000000,0x08400000,0x00200000,0x00000000,0x00000000,0x00200000,
-0x18a21081,0x10610820,0x082010a2,0x10401061,0x00000800,0x00000820,0x08200000,0x00000000,0x29030800,0x316528e3,0x00002103,0x00000000,0x08403124,0x00000840,0x00000000,0x00000000,0x000020e4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x000018c3,0x08410000,0x00000000,0x21040000,0x736d0000,0x00004a48,0x00000000,0x00000000,
-0x6a4651a3,0x59806223,0x62015961,0x49624940,0x5a6930c1,0x29032923,0x31853143,0x31653164,0x20e32944,0x5a8918c2,0x52277b8d,0x394428e2,0x41644184,0x39434985,0x41843923,0x30e020a0,0x39213942,0x18605a47,0x49c43122,0x28e128c0,0x28e12103,0x080020a0,0x9c9218e4,0xb576ad14,0x3061c575,0x30c038e1,0x41823901,0x7b294181,0x41624160,0x288283ac,0x28e0838c,0x312128c0,
-0x28e35a87,0x734b8bcd,0x104041c4,0x3123732a,0x39857bce,0x39864a07,0x7b8e2924,0x6aa9732c,0x100028c2,0x7bce1880,0xa5149471,0x29049472,0xa4f49450,0x9c93a4d3,0x7b8f83af,0x83d0a4d3,0x7b6d62ab,0x314439a5,0x41e63143,0x418539a5,0x310328a1,0x31231000,0x418549c5,0x102028c2,0x10001840,0x00001020,0x6aab0800,0x5208626a,0x49c741a6,0x52485249,0x49e762aa,0x31454186,
-0x9430734d,0x186020a1,0x18821040,0x10405269,0x10401860,0x080028e2,0x7b4c1020,0x94509470,0x10401882,0x102020a2,0x08000000,0x00000800,0x94713165,0x108262eb,0x08200000,0x10200800,0x10001000,0x18401840,0xa5330800,0x4a080040,0x20e30000,0xa514a4f3,0x4a490000,0x00000000,0x00000000,0x00000000,0x21044a49,0x08200000,0x00000840,0x00001061,0x08410000,0x00000000,
-0x00000000,0x08000000,0x10601040,0x18820800,0x10211882,0x10a21041,0x00002924,0x00001881,0x00000000,0x08400841,0x18a118c2,0x08202923,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x316518a2,0x20e32945,0x21042924,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x20c3ad34,
-0x62666a87,0x7a627243,0x8b267262,0x7aa57223,0x61e46203,0x08003080,0x7b8d6289,0x292339a6,0x39853165,0x31653985,0x8c103123,0x52075a49,0xbd347b4c,0x62886269,0x41844164,0x31004183,0x208028c0,0x08002080,0x51e6836c,0x20c22080,0x31439c91,0x18611020,0xa4f37b8e,0xb576b576,0xce17bd96,0x8bcecdd6,0x30e028a0,0x30e028c0,0x41614160,0x39413100,0x418241a3,0x41824182,
-0x31004182,0x184049c5,0x31003120,0x28c03120,0x000020c0,0x20c33123,0x9cd39cb2,0x49e63145,0xad13ad13,0x7befb594,0x18c30820,0x18a23186,0x949218a2,0x9c939cb3,0x94318c11,0x7b8e5a8b,0xa51483d0,0x31653985,0x10401060,0x290320c2,0x394341c6,0x396528c1,0x18611000,0x39243123,0x41a549e6,0x102020c1,0x734d1041,0x94529430,0x52695269,0x94518c0f,0x9c728c11,0x7b8f9c92,
-0x94519451,0x18605a28,0x10601000,0x20611060,0x31231860,0x100028e2,0x10201000,0x10001860,0xa4f318a2,0x41e79450,0x20820000,0x94511841,0x5a8a8c10,0x08000800,0x10401040,0x18005248,0x41851800,0x7bad9cd2,0x10403165,0x31035228,0x082018c1,0x00200020,0x10610000,0x29042924,0x00000840,0x20e24a07,0x00002903,0x00000000,0x10810000,0x00001061,0x00000000,0x00000000,
-0x08200800,0x18a118c2,0x29020000,0x18612903,0x28a21000,0x10403124,0x00000000,0x00000800,0x00000000,0x00000000,0x10600000,0x39864a27,0x00006b0c,0x00003165,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18a10000,0x08200000,0x10200000,0x00001040,0x08200000,0x00000000,0x00000000,0x00000000,0x00000800,
-0x8b8a8329,0x8b268b49,0x8b04a3a8,0x7aa45960,0x7ac67a85,0x62456a86,0x20c049c4,0x940f1040,0x39653144,0x39854a07,0x83ce2903,0x9cb27b8d,0xa4b28c10,0x52077b0b,0x52064185,0x28c05206,0x41a44163,0x5a6849c5,0x83ad41e5,0x94501020,0x5a699c70,0x41a683ce,0x31248c2f,0x29233164,0x29033144,0x41a54a07,0x30e130e1,0x39223922,0x30e030e0,0x5a053920,0x39224183,0x41824142,
-0x49c349c3,0x418228c0,0x49c328c0,0x30e13901,0x41633961,0x4a285a89,0x082039a6,0x9c913985,0x94b22924,0x31653986,0x41e73185,0x20e33165,0x29642103,0x9cb3526a,0x83f0738f,0xe6fc9cd3,0x31859cd3,0x7bae41e7,0x28e23985,0x312320a1,0x5a8928e2,0x31245227,0x41651000,0x39251000,0x41c641a7,0x39a54a07,0x18a241e7,0x4208738e,0x736e6b2d,0x526a3186,0x8c515aaa,0x08004a07,
-0x20621820,0x39635207,0x20c11860,0x08001860,0x10601840,0x29241020,0xbd957bae,0x20c13985,0x104020e1,0x10400000,0x8bef1861,0x736d8c0f,0x10217bae,0x31230000,0x31443144,0x41a649e7,0x08000000,0x08001820,0x20e20000,0x18602903,0x18a11840,0x00000820,0x00000000,0x00000000,0x00000000,0x00200000,0x00200000,0x00000000,0x08000000,0x21020820,0x18a11080,0x39a518a1,
-0x10601880,0x18a20000,0x31031020,0x18401020,0x28e128a1,0x41653923,0x08000800,0x00000000,0x20e30840,0x0000736d,0x08200000,0x52483165,0x08000800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x10610000,0x10a20000,0x00000000,0x108020e3,0x29230000,0x31640000,0x29444a28,0x00000000,0x39a639a5,0x000052aa,0x00000000,0x00000000,0x10826b4d,0x630c8c50,
-0x9c2d838a,0x93479bcb,0xb46ba3ea,0x93679b25,0x830782c6,0x72e872c7,0x5a665226,0x49a551e5,0x28c228a1,0x6aebbd95,0x31033923,0x102028e2,0x942f5207,0x49a672ea,0x394372eb,0x49c451e6,0x394251e5,0x39854184,0x94705aa8,0x41c583ee,0x5aca41a5,0xb534632b,0x31033985,0x5a8820a1,0x5a6828e2,0x5a4762ea,0x52066aea,0x5a686289,0x396472ea,0x41613942,0x414128a0,0x51c54163,
-0x39415a04,0x41613920,0x20803941,0x20802080,0x31213100,0x4a2749e6,0x29232923,0x00006b0a,0x18610800,0x39842943,0x29033144,0x526841c6,0x39a43984,0x41e83985,0x7bae0800,0x84107bcf,0x5aaa6b0d,0x39861041,0x20c249e6,0x30e35a68,0x5a8a3964,0x396420a1,0x520728e2,0x7b8e7b8e,0x10a19cb2,0x20e20840,0x41e74208,0x4a4839c6,0x10813185,0xad3339c6,0x39c618c2,0x734bad13,
-0xa4f33924,0x52489471,0x6b0a41e6,0x10005247,0x41e641a5,0x080062ea,0x00009450,0x31231020,0x18811060,0x10400000,0x8c109430,0x7bcf734d,0x31051062,0x00001040,0x29450020,0x29237b6d,0x18600000,0x08200800,0x00000000,0x41a51060,0x29442081,0x08200000,0x00001061,0x00000000,0x08000800,0x00000820,0x00000000,0x00000000,0x08000000,0x10400800,0x18a11040,0x20e20820,
-0x10001860,0x18811020,0x18401061,0x20801020,0x182028c1,0x31212080,0x18403943,0x10003963,0x39861020,0x31640800,0x6b0c18a2,0x000083cf,0x00000000,0x00000020,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x41e71061,0x08402943,0x08200000,0x21030000,0x210339c6,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,
-0x28c11020,0x8bca8c0d,0xa3ea9bea,0x82e69ba9,0x7ac682e6,0x49826224,0x18002880,0x31022880,0x5a475a68,0x28a14164,0x28802860,0x39233102,0x418449c5,0xa49293ee,0x62697b6d,0x624628a1,0x41435a06,0x39223942,0x394328c0,0x41e6a4b1,0x18a07b8d,0xbdd69cf2,0x39246aeb,0x41a45a67,0x62ea41c5,0x6b2b5268,0x62696269,0x734d6b0b,0x62a95269,0x49c56b2b,0x41614162,0x39204982,
-0x41a25204,0x49a35224,0x394049e4,0x20803940,0x20a02900,0x20802080,0x186028c1,0x000041e6,0x39a43164,0x31423983,0x29222902,0x20a020e1,0x41842921,0x20c128c1,0x29033123,0x39a52903,0x734c3984,0x10002081,0x49e63964,0x186120c2,0x290330c1,0x102041c6,0x390320a1,0x84308c10,0x8c3018a2,0x10201840,0x18811881,0x20603144,0x10401020,0x208028e2,0x08003102,0x8bcd1840,
-0x28e39c91,0x52498c52,0x08001840,0x28c11840,0x18401840,0xcdd762ca,0x39659c51,0x20c21020,0x10200800,0x18601040,0x41a63985,0xb5760800,0x94729472,0x2903ad13,0x08001020,0x080018a1,0x10a22944,0x00009491,0x52490000,0x5a895aa9,0x00000800,0x08000000,0x39a60000,0x000039a6,0x08003165,0x00000821,0x18a20800,0x18810000,0x18601040,0x08001000,0x00000820,0x00000000,
-0x10200000,0x10001820,0x100028c2,0x208128c2,0x20401000,0x30e01820,0x39624183,0x390230e1,0x08001000,0x630c0000,0x00002945,0x00000000,0x00000000,0x00000000,0x08001040,0x00000000,0x00000000,0x08200000,0x10810020,0x00000000,0x31a520e2,0x10402903,0x002039c7,0x00000000,0x00000000,0x00000020,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x18603101,0x310220a1,0x41a42902,0x8baa838a,0x6a467b28,0x83ad6226,0x6aa9d638,0x38e13943,0x39223901,0x72ea30e2,0x39435a26,0x28803922,0x28c130e1,0x41643923,0x5a4749c5,0x31029c50,0x39433943,0x39224142,0x31013102,0x20c028e0,0x394228c0,0x18a01060,0xad131040,0x4984a4b1,0x31443943,0x524839c6,0x52288bef,0x4a077b8e,0x62ca4207,0x628983cd,0x5a466ac9,0x41835a26,
-0x41a34183,0x49a44183,0x41a33120,0x5a4551e5,0x28c03961,0x20a02060,0x20c22060,0x18811020,0x31631040,0x188020a0,0x20c141c5,0x398439a4,0x10203142,0x102020a0,0x10401020,0x10201860,0x39a53164,0x18204185,0x18601840,0x49c628c1,0x39a53964,0x83ae8c30,0x0800838d,0x10001040,0x08001020,0x18401000,0x10201020,0x18401860,0x4a061820,0x4a275a89,0x7b8c8c0f,0x7b6c41c6,
-0x6b0ba4b2,0x31645aca,0x08000800,0x10000800,0x20202080,0x310428a2,0x941093ef,0x49a6b514,0x18614a07,0x9c9020a1,0x9471bd74,0xad348c30,0x8c719cb2,0x732c9cb1,0x732c3124,0x4a48deb9,0x18812903,0x6b2b39a6,0x10413144,0x18810820,0x41e63144,0x000018a2,0x08200800,0x4a0820c3,0x10611061,0x00000820,0x18810000,0x10200820,0x20803964,0x080020a0,0x31442923,0xad3318a1,
-0x20c21040,0x28e328e3,0x28e241a5,0x31034185,0x204128a0,0x20601820,0x28c030e1,0x184028e0,0x5a8930e2,0x00000820,0x00000000,0x00200841,0x18a20000,0x00000000,0x00000000,0x00000000,0x00200840,0x00000000,0x00000000,0x00000000,0x00003185,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x310120a0,0x18203101,0x28e028e0,0x41854185,0x4a063944,0x20a13164,0x20823964,0xad341841,0x6b2c49e7,0x1861ad13,0x31434a05,0x5a6762a8,0x39214183,0x390028a0,0x28a030a0,0x18202040,0x5a683963,0x41444164,0x28a04183,0x28a02080,0x28c030e0,0x20e12060,0x20c218a0,0x52689491,0x418549e7,0x31033943,0x62693964,0x5aca6b2b,0x5a8a8410,0x7b6c5a89,0x62887b4c,0x6268730b,
-0x18405a88,0x39633983,0x20a041a3,0x418228e0,0x20a0838b,0x208028a0,0x10002080,0x20601000,0x10400800,0x00201000,0x10810000,0x10403144,0x28c01880,0x28c228c0,0x62aa4206,0x3985a4d2,0x29044208,0x39a52923,0x100028c2,0x9cb228a1,0xacf441a6,0x10003965,0xbd531840,0x31447b8d,0x18001800,0x20820000,0x31221020,0x18602901,0x28e228c0,0xa4f2bd74,0x286162a9,0x7bce5aaa,
-0x29435268,0x082020e1,0x41e63163,0x20e239c6,0x9cf33164,0x83d0840f,0x9cb18c51,0x9470a514,0x0000a4b1,0x10002080,0x000020a1,0x080020e2,0x188141c6,0x18601861,0x20c21060,0x290318a1,0x20e220c2,0x20a11860,0x28e241e6,0x08205227,0x00000000,0x1060e6da,0x08200000,0x00000800,0x10600000,0x188118a1,0x00002102,0x31851060,0x28e35248,0x20a228e3,0x20c20840,0x08005a89,
-0x18600800,0x398541a5,0x29033144,0x39433985,0x41853943,0x314128e1,0x20c028a0,0x736d4207,0x18c25aaa,0x00000000,0x00000000,0x00000000,0x08000000,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x4a280800,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x21040000,0x000031a6,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,
-0x524841a6,0x39633984,0x28e139a4,0x312120a0,0x398428e0,0x8c0f4a27,0x418683ee,0x39853103,0x10200800,0x20c2734c,0x7b8e5249,0xcdf7acf3,0x7b4b5208,0x41626287,0x30e030c0,0x28c13100,0x5a8941c5,0x730b62a9,0x49e562a9,0x6aca49c6,0x520649e6,0x41a55a68,0x29243122,0x39853144,0x39646aea,0x310330e2,0x5227838d,0x292328e1,0x8bef1041,0x5a485a88,0x5a483964,0xc5746ac9,
-0x3123e6b9,0x39631860,0x41a549c6,0x28a01860,0x28e028c0,0x20601820,0x3944730a,0x30e26268,0x398541c6,0x42076b0b,0x5269bd95,0x18816b2c,0x39862903,0xacf32904,0x3124738d,0xacf37b6d,0x52493185,0x52697b8d,0xbdd58c50,0x292410a1,0x1040628a,0x396220c0,0x39404182,0x18400800,0x20402060,0x73ad8c50,0x28c16ac9,0x18401020,0x08002080,0x62a91800,0xa4911860,0x31441020,
-0x290241a5,0x20c05226,0x39843142,0x41e641c6,0x84103164,0xa4d39491,0x104028e3,0x18a00800,0x20c018a0,0x208028c1,0x18802060,0x10400820,0x08200000,0x292320e2,0x20c220a1,0x20c21881,0x29032903,0x10603144,0x29022923,0x734c28e2,0x08008c2f,0x10400820,0x000083ef,0x29240820,0x20c12902,0x104020c2,0x10601060,0x10401041,0x080018a1,0x08001020,0x106018a1,0x00001040,
-0x49e61881,0x20a13964,0x20c00820,0x292120e1,0x20c03162,0x41653122,0x52486aeb,0x42070820,0x00000820,0x00000840,0x00000000,0x00000000,0x10410000,0x00000800,0x00007b8d,0x00000000,0x00000000,0x00000000,0x18a10000,0x00001040,0x00000000,0x00000000,0x10824a28,0x000020c2,0x00000000,0x00200000,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x42280000,
-0x39a54206,0x39c639c6,0x6b2b39c6,0x394441a5,0x20e128e2,0x5acb1040,0x5aca5aca,0x31445a89,0x314441a6,0x20a25248,0x29022902,0x310328e2,0x6aeb5227,0x62896289,0x72c983ad,0x41c64183,0x62eb41e7,0x52487b6d,0x4a285a8a,0x31233985,0x4a0841c6,0x28e228e3,0x31445248,0x39853164,0x49c63103,0x28c15a48,0x31222061,0x208028c0,0x39644185,0x41854a05,0x730b5207,0x72ea72ea,
-0xc6178bcf,0x20a00800,0x28e01860,0x31012900,0x20801000,0x394330e3,0x5a272080,0x20604184,0x6b0b5228,0x292428c3,0x7b8d3144,0x10210820,0x39a641c7,0x8450738e,0x20a23986,0x31445228,0x314518c2,0x29046b2d,0x394549c7,0x62eb5a29,0x206028c3,0x18202080,0x20802060,0x20402060,0x9c71acf3,0x00001861,0x20811000,0x31241020,0x10001020,0x6248c5d6,0x9cd1bd74,0x18601840,
-0x31011860,0x20802080,0x31231820,0x31453123,0x39a63165,0x10203165,0x310228a1,0x100020a0,0x83ce49e7,0x31025206,0x20a12080,0x20a01020,0x39a41040,0x31441880,0x20c23144,0x20c220c2,0x18611061,0x29032903,0x20a13123,0x08201860,0x00001080,0x08400820,0x18811061,0x20e220e3,0x10601060,0x10802102,0x08200820,0x08000800,0x10400800,0x186120a2,0x08200800,0x29031060,
-0x29031881,0x08002903,0x08610800,0x00000000,0x08000820,0x20a01000,0x00001040,0x00000000,0x00004a48,0x00000000,0x00000000,0x00000000,0x738e9cb2,0xa51394b2,0x00000000,0x00000000,0x00000000,0x00000000,0x5acb18a2,0x00000000,0x29240000,0x31443164,0x10a12964,0x000041c6,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x39033924,0x29233123,0x39853164,0x314339c5,0x31632943,0x398541e6,0x39854207,0x62ca83ce,0x29033144,0x4a2839a5,0x39a53144,0x41a66b0b,0x524841a6,0x10401040,0x39640800,0x6b0b5227,0xad3362ca,0xb534c5d6,0x732c9c71,0x5aaa4a48,0x94517bcf,0x7b6d5aaa,0x396441c6,0x49e62903,0x41c5942f,0x39434184,0x39444184,0x41844184,0x312328e1,0x41843963,0x51e741a4,0x62686aca,
-0xbdb7bd55,0xb554a513,0x20a041c5,0x31013922,0x28a03101,0x206028c0,0x416328a0,0x28803902,0x49c64185,0x08616b0b,0x10822144,0x41c60000,0x732c0800,0x31040000,0x524928e3,0x4a075aaa,0xad357bef,0x9cb3bdb7,0x10418bf0,0x52693164,0x20c0bdb6,0x20802901,0x080028c0,0x10001860,0x18401860,0x734c1020,0x10001000,0x18001800,0x83ce30e2,0xacf20800,0x10403143,0x83cd3123,
-0x7bacb574,0x18601800,0x18201840,0x20c14163,0x39a541a6,0xbd5418a2,0x31236289,0x314483ae,0x18a10800,0x00002923,0x18402060,0x10200800,0x08001000,0x20c21880,0x20c23123,0x20a128e2,0x20c23985,0x18401000,0x18811860,0x10601020,0x08001881,0x20c21040,0x29031881,0x08203144,0x39e61060,0x18c20841,0x00000820,0x18811881,0x41c60000,0x0000ad54,0x00001040,0x18600800,
-0x18603144,0x28e30800,0x08205a89,0x10810820,0x00000820,0xef1c1041,0x20c21020,0x00000000,0x00000000,0x00001862,0x08200800,0x31864a28,0x08210000,0x10628410,0x00000000,0x00000000,0x08200000,0x9cb29cb2,0x08006b4c,0x00000000,0x00000000,0x00000000,0x00000840,0x00000000,0x20e20000,0x528a4a48,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x51e651e7,0x398549e6,0x39a54a47,0x39a53164,0x31443165,0x62ca5269,0x7b8d4a28,0x396439a5,0x398541c6,0x316541e6,0x39a65a89,0x396549e7,0x39854a07,0x94302903,0x4a286aeb,0x4a075249,0x39a539a6,0x28e341a6,0x396528c3,0x42073185,0x52484a49,0x41a683ef,0x52483985,0x28e239a5,0x290128e1,0x29013142,0x31033123,0x28c149e5,0x28a049c5,0x28e128a0,0x6aaa3122,0x6aca9c30,
-0xa4f4a4b2,0x5a896b2c,0x5a485a8a,0x49a549a5,0x31203943,0x310030e0,0x206049a3,0x204028a1,0x18611000,0x00201060,0x000010a1,0x41c61041,0x18820800,0x4a083145,0x18a241c7,0x10618c10,0x41e80820,0x20e44a29,0x4a692125,0x41c60860,0x62ea0820,0x290339a5,0x52289c91,0x39443123,0x102020a1,0x10001800,0x30e028a0,0x20a028c0,0x10000800,0x184028a1,0x186028e0,0x18402080,
-0x20602880,0x39432880,0x28a02080,0x08001840,0x41a41860,0x28c22081,0x41856289,0x18611020,0x10200800,0x10204a47,0x100030e3,0x18202080,0x10201000,0x18811020,0x20c220c1,0x00001881,0x10401061,0x18401840,0x08001820,0x28e220c2,0x31441881,0x29031040,0x188128e2,0x08001881,0x080020c1,0x28e20800,0x1061cdf6,0x29230800,0x00001061,0x52680800,0x29230820,0x20a13985,
-0x20a128e2,0x08000000,0x00000000,0xce380000,0x00000000,0x39a63165,0x39853144,0x10601040,0x736d9c51,0x1882c638,0x10612904,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x52682924,0x00000000,0x00000020,0x00000000,0x08200000,0x4a484227,0x082039a7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x52079c70,0x49e741a6,0x29032923,0x5aa920e2,0x4a286b0b,0x314441e6,0x396439a5,0x5a6939a5,0x396549e7,0x39653124,0x28e239a5,0x31033103,0x49c628e3,0x8c0f7b4d,0x49c56b2c,0x31643964,0x52693985,0x840f3985,0x4a274a28,0x42284a28,0x94505289,0x314420e3,0x398439a6,0x31642902,0x310228e1,0x20804163,0x18602080,0x39633943,0x28a03122,0x5a683943,0xa4b283ad,0x7b8d732c,
-0x312449e7,0x314441a6,0x41c6736d,0x732c62aa,0x52265a89,0x6a876287,0x5a465a05,0x30c049a4,0x30e328e1,0x00003985,0x00000000,0x10000000,0x52082080,0xa4f48c30,0x5a498410,0x318583ae,0x20e42925,0x39e839c8,0x290341c7,0x29032102,0x10810800,0x20e341e7,0x10810000,0x106020a1,0x20a11860,0x184049c5,0x28c11840,0x20401840,0x20a02080,0x186028a0,0x28c05a47,0x39614182,
-0x39224182,0x20603900,0x20602880,0x20402060,0x08001020,0x39641820,0x10401880,0x18401820,0x28e22040,0x7b6c1840,0x100020a0,0x31021860,0x28c13103,0x08003963,0x00000800,0x00000800,0x10201000,0x62690800,0x10201840,0x08000800,0x08403123,0x00001040,0x10400800,0x10001000,0x20c120c2,0x29432103,0x5aa983ee,0x08000860,0xad335aca,0x20e20840,0x20c20000,0x20802080,
-0x08001061,0x00001040,0x08200800,0x7bae1040,0x41c741e7,0x6b4c20c3,0x0000ce58,0x00002124,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x52680020,0x00000000,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x62aa83ae,0x39653985,0x41e639c5,0x316539a5,0x39852924,0x39a539a6,0x29032923,0x6b2c4a07,0x31443985,0x39653965,0x49c62923,0x396449e5,0x49c63123,0x39843123,0x31233964,0x28e23103,0x31233123,0x20c12902,0x41a53984,0x4a073144,0x6b2c5248,0x39842924,0x31642943,0x31633143,0x28c13102,0x39423922,0x31023102,0x31233964,0x83ce940f,0xa492b554,0x31448bcf,0x39a68c0f,
-0x28e341c6,0x7b8d83ce,0x8c0f8bef,0xc5d69450,0x730bd658,0x28807b8b,0x520551c4,0x206030c0,0x49c428e0,0x316249a4,0x31223141,0x10001000,0x10001000,0x18611861,0x3125734c,0x7bce39a6,0x83f09c93,0x31653166,0x31643125,0x31633984,0x292318a0,0x41a53964,0x316441a5,0x31233144,0x41841860,0xc5b65aca,0x39232060,0x30c13101,0x20802060,0x28a028e0,0x18401860,0x28c128c0,
-0x20803101,0x18006228,0x20801820,0x10202060,0x20a10000,0x18401000,0x18201840,0x18202060,0x10001000,0x41a520a2,0x41843122,0x396328e2,0x31223942,0x20601860,0x18401860,0x10201860,0x31023103,0x28c13102,0x312328c1,0x10202081,0x080020c2,0x08200000,0x00000800,0x0000e6db,0xce381061,0x00000820,0x00000000,0x08000000,0x00000820,0x00003985,0x104018a2,0x31445268,
-0x08000820,0x08000820,0x41c72924,0x080018a2,0x08000000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x318520e2,0x5aca39c6,0x080018c2,0x08210800,0x00000000,0x00200000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x08411081,0x00002104,0x00000000,0x00000000,0x10820000,
-0x3985736d,0x41a53143,0x41e63985,0x398641c6,0x94924a28,0xa513c638,0x49e6c5f7,0x39643144,0x39853144,0x39244165,0x41a55207,0x39233923,0x39233923,0x31223943,0x312128e1,0x736c41a4,0x31647b8d,0x31233984,0x39643123,0x41a541a5,0x4a2741c6,0x29032902,0x290328e2,0x20e32903,0x318320e1,0x31012060,0x49e73924,0xa4d29c91,0x62ca5248,0x7b8d9450,0x39243144,0x83ce83ce,
-0x2902a4d2,0x5228628a,0x49866289,0x5a0659e7,0x41a549c6,0x41a53985,0x414241c6,0x38c04122,0x206038a0,0x41833941,0x41413921,0x18003921,0x10002020,0x18001000,0x49c61820,0x4a287b8d,0x29053125,0x186030e3,0x20801840,0x20c028e2,0x20e020c0,0x18802900,0x394220a0,0x29233123,0x41c641c6,0x20816ac9,0x080020a1,0x20811000,0x20401820,0x28a02020,0x28c11820,0x18002880,
-0x206028a0,0x20601820,0x10002080,0x18201840,0x184028a1,0x18401820,0x18202060,0x30e21000,0x30e12060,0x28e23142,0x28c028e2,0x184028a0,0x18201820,0x28c02081,0x208120a1,0x100020a1,0x18610800,0x28e11880,0x10001860,0x39853964,0xc5b61040,0x00000000,0xb5740000,0x00000800,0x00000000,0x00000840,0x00000820,0x10201040,0x08202903,0x00000000,0x00000000,0x94928c51,
-0x1061f77d,0x00000000,0x00000000,0x292462aa,0x00002103,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000020,0x00000000,0x10810840,0x00000020,0x08410020,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x08200000,0x18811040,0x00000000,0x00000000,0x00200020,0x39c7a534,0x00000000,0x00000000,0x00000000,0x10610000,
-0x314339a5,0x20c22903,0x39633143,0x31642102,0x420639a5,0x736d4a27,0x7b8d83ef,0x4a076b0b,0x29233984,0x49c649c6,0x5a485207,0x31234a06,0x39443143,0x41843943,0x41844185,0x20a128c1,0x41841840,0x9c919470,0x41a583ad,0x62ca5a89,0xa4d2734c,0x314441e6,0xacf36b0b,0xad1362aa,0x8c109cb3,0x39669c51,0x6b2c7b4d,0x1061736d,0x62aa2944,0x398562aa,0x5a28732c,0x840f41a6,
-0x49c520a2,0x41424143,0x72ca5206,0x72ea4123,0x736c8bce,0x29033144,0x39852923,0x7ac730e1,0x28806a65,0x49a44162,0x394249e4,0x49e44183,0x418441a4,0x51c541a4,0x498451c4,0x20c21000,0x4a082904,0x39853986,0x28c23944,0x28e24165,0x20c13142,0x39421880,0x18403101,0x31232902,0x31433163,0x31034185,0x186028c1,0x5a0728c1,0x18403923,0x20601000,0x18201000,0x49a41800,
-0x28a04161,0x10002061,0x20402040,0x100028c1,0x182028a0,0x20602060,0x20601820,0x310030e1,0x30e13121,0x20a120c0,0x28e11820,0x18201840,0x28c11840,0x20802040,0x10201000,0x08200800,0x10200800,0x08001001,0x08001001,0x8bef0800,0x188128e3,0x734c1020,0x10403124,0x10811041,0x00009471,0x00000000,0x00000000,0x00000000,0x084039e6,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00200000,0x00000000,0x10820820,0x08200820,0x00001061,0x00000000,0x00000000,0x00200000,0x0000dedb,0x00000000,0x00000000,0x08200000,0x00000840,0x00000000,0x00000000,0x00000020,0x00000000,0x08000000,0x08000800,0x00000820,0x000018a2,0x00000000,0x08210000,0x00202104,0x00200000,0x00000000,0x00000000,0x00000020,0x00000020,0x20e30000,
-0x31634a06,0x31233144,0x310228e1,0x31632102,0x31432942,0x29453984,0x4a693186,0x62ca4a28,0x41a562a9,0x41653944,0x51e75227,0x41c54a26,0x52274a27,0x41a63102,0x52275a48,0x416349e5,0x39224163,0x39014962,0x39643103,0x41c55268,0x5a8941a5,0x398520c2,0x18613164,0x20c21881,0x5a8983ce,0x5a8839a5,0x49e728e3,0x41e741e6,0x52483985,0x41c64a07,0x49a64a07,0x736c5a69,
-0x62485207,0x6b0a6aea,0x93ed836b,0xac909c0e,0xa4f2c595,0x41c67b6c,0x21252902,0x59a33964,0x30c06203,0x49833941,0x7b6b62c8,0x6aea8bed,0x28c03124,0x416330e1,0x412249c4,0x28c228c1,0x31443985,0x52699c92,0xa4927b4d,0x20c228a2,0x29032922,0x41a41040,0x20a028c0,0x10603143,0x31424a05,0x18603103,0x100028e2,0x18201860,0x08001000,0x10001020,0x18202061,0x20601820,
-0x18001800,0x10001820,0x18402080,0x10002060,0x100049a5,0x20601820,0x20602081,0x20802061,0x208020a0,0x28c11880,0x18201000,0x18402040,0x10001800,0x08002081,0x08001000,0x20c10800,0x10401020,0x08001840,0x18201820,0x10401821,0x10401020,0x28e31040,0x20611000,0x0840f73c,0x00000000,0x00000000,0x00000000,0x18610000,0x000028e3,0x00000000,0x00000820,0x00000000,
-0x00000820,0x10600840,0x18610000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x08410841,0x18610000,0x10201040,0x08000000,0x08000800,0x00000000,0xdeda0000,0x00000000,0x00000000,0x39c72104,0x00000000,0x00000000,0x00000000,0xd69a0020,0x0861b5b6,0x00000000,
-0x41c64a07,0x396441c6,0x39a541c6,0x39a520e2,0x290228e2,0x39a62902,0x39a639a5,0x736c4a07,0x734c736c,0x4a076b0b,0x41a55207,0x49c63103,0x39643123,0x314441a5,0x62a93985,0x6a695a27,0x5207730b,0x39433122,0x394349c5,0x29025268,0x62ca3964,0x39a55227,0x524839a5,0x83ce62ca,0x4a076aeb,0x292339a5,0x41c63985,0x39654a07,0x31445268,0x41c63965,0x62ca732c,0x7b6d41a6,
-0x51e75a49,0x730b5208,0xb5349c91,0xa4b2a4d2,0xad34bd95,0x736c7bae,0x316462ea,0x30c12902,0x416249c4,0x49e43100,0x39424183,0x416328c0,0x39221840,0x20603942,0x41843963,0x310249c5,0x41643943,0x20c25228,0x18610000,0x62ab3145,0x41e72925,0x28e228e2,0x39433923,0x39643985,0x184049a5,0x18201020,0x10001820,0x20812060,0x10401000,0x10001020,0x18402061,0x20602040,
-0x10001840,0x20601840,0x20401840,0x18402060,0x18411000,0x18201000,0x28a12060,0x18600800,0x20603102,0x20802060,0x20a01860,0x18601860,0x10201020,0x10201040,0x10401861,0x18811020,0x10201841,0x08001861,0xde9928e3,0xc5f7d678,0x08000000,0x20c21061,0x08203144,0x00002904,0x10412924,0x10410000,0x00001020,0x10200000,0x18821040,0x00000800,0x08200820,0x08200000,
-0x10200800,0x10001820,0x104028c1,0x10400820,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29440000,0x00001082,0x840f0000,0x08200000,0xdeda1061,0x00000820,0x00000000,0x8c4f20e1,0x1061b554,0x08000000,
-0x41e64206,0x41a541e6,0x4a073985,0x7b6d62ca,0x41e6736c,0x294441a5,0x5a894a27,0x83ef83ee,0x736d8c30,0x62ca5269,0x4a074206,0x4a074a28,0x5a8949e7,0x7b8d62eb,0xc594bdb6,0xc554bd33,0x49c65a48,0x52074164,0x31233123,0x314328e2,0x4a073964,0x29233985,0x5248bdb5,0x290320a1,0x41a63144,0x396428e2,0x41c63965,0x39853165,0x522862ea,0x20a25a69,0x5a896aeb,0x41c68c0f,
-0x184149c6,0x6aca4165,0x83ef8c0f,0x736d7bae,0xbdb59471,0x949162eb,0x5a698c50,0x41843124,0x41623923,0x396228c0,0x28e128c1,0x31223122,0x41a428c1,0x28a13101,0x28a14163,0x310349a5,0x28e23122,0x41c641e7,0x31453124,0x31853124,0x28e339a5,0x5a6828a1,0x08001020,0x18813123,0x10000800,0x18001800,0x18201820,0x31022081,0x62c91840,0x51e75aa8,0x206130e3,0x20402040,
-0x10002060,0x18402080,0x20601840,0x18402060,0x18202060,0x18001820,0x18202060,0x08003103,0x18401820,0x31432080,0x8beece37,0x10201881,0x08000000,0x10200000,0x10610800,0x08000800,0x18611000,0x00000000,0x00001061,0x00000860,0x00000820,0x082083ef,0x83ef0000,0x10008c10,0x08000800,0x10411000,0x00000020,0x00000000,0x00000000,0x00000000,0x08000800,0x00000800,
-0x08001040,0x10401840,0x00000800,0x00000000,0x18810820,0x00000820,0x08000800,0x00000000,0x00000000,0x00000000,0x08200000,0x10400800,0x08000800,0x08000800,0x00000000,0x00000000,0x00000000,0x10810820,0x00000000,0x00000000,0x000094b2,0x00000000,0x00000000,0x52680800,0x00000820,0xa5140000,0x00007bce,0x08000000,0x08000800,0x08001020,0xef3c20e3,0x0000b596,
-0x52694a28,0x52485248,0x52692924,0x5a892903,0x186162ca,0x52483965,0x52483985,0x39a67bad,0x4a076b2c,0x5a6841c6,0x312341a5,0x31445247,0x736c736c,0x7b8d6b2b,0xeefbacf3,0xbdb5ce17,0x8c0f83ee,0x62898bce,0x6b2c7b8d,0x41851840,0x20c11860,0x28e220a1,0x49e63123,0x0800732b,0x18813985,0x49e762ca,0x62aa5aaa,0x49e741a6,0x314420c2,0x41c74a07,0x8bef1861,0x4a085228,
-0x39865249,0xa4d39c71,0x39a69492,0x526818a2,0x83ef5a89,0x316483cf,0x396420e3,0x41a54185,0x49c65a48,0x52063984,0x28c14184,0x31223102,0x31223922,0x39633943,0x39633963,0x312228e1,0x49e63123,0x312441e7,0x18a12924,0x30e320e3,0x186030e3,0x52073102,0x100030e2,0x10201840,0x10201860,0x20602040,0x18201820,0x10001800,0x41c51820,0x10201000,0x100049c6,0x20402040,
-0x20601840,0x20601820,0x51e51860,0x20812080,0x20401840,0x18602080,0x30e128c0,0x28c028c0,0x28c128c0,0x30e12060,0x100028a0,0x28a02081,0x20402060,0x28c11840,0x18402080,0xd67828a2,0xad34a4b2,0x00001061,0x10405a88,0x08200000,0x104020a1,0x10400820,0x20e30800,0x08001040,0x00000800,0x00000000,0x08000000,0x18a01861,0x184020c1,0x08201020,0x00000000,0x00000000,
-0x08400820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000840,0x08000820,0x10200820,0x18812903,0x10610000,0x10200800,0x00000020,0x00001060,0x08200000,0x1020c617,0x10200000,0x10200800,0x104018a1,0xfffe3144,0x18815aa9,0x08200820,0x00000000,0x00002103,0x00000840,0xa4d30020,0xad34bdd6,0x00009cd3,
-0x52892924,0xad33738d,0x7bad5aaa,0x41a641a6,0x396541a6,0x31643965,0x41e63984,0x31642923,0x4a074a07,0x41a520a1,0x28e13102,0x20a128e1,0x186020a0,0x31231860,0x39a53964,0x31443143,0x52483164,0x52695228,0x5aa9738d,0x20c26b0b,0x4a073985,0x8bee83ce,0x39446aaa,0x51e76268,0x39851020,0x4a0728e3,0x52283124,0x6b2c732c,0x7b6d83ce,0x7b6d3985,0x00000800,0x52493124,
-0x49e77b8e,0x7b8e6aeb,0x39867b6d,0x62ea62aa,0x7bae6aeb,0x41e683cf,0x41c74a07,0x39863145,0x5a885a68,0x6b2b734b,0x52056aeb,0x31223120,0x31023922,0x396228e1,0x31023121,0x20801840,0x31433964,0x396541a6,0x41e72924,0x394439a6,0x31023124,0x208028e1,0x416328a0,0x41a549e6,0x28e349e7,0x41643102,0x00001020,0x41641020,0x732c30e2,0x184049a5,0x10001020,0x18001820,
-0x18001000,0x28a11840,0x20806ac9,0x18401840,0x20801820,0x28c02060,0x20a028c0,0x206028c0,0x182028c0,0x182028a0,0x20601000,0x18601820,0x10001860,0x08000800,0x08005a67,0x184020a1,0x49e72061,0x00001061,0x10201020,0x10400800,0x10400000,0x10202902,0x00001020,0x08000800,0x10210800,0x08000800,0x10201020,0x18400820,0x10002080,0x08401020,0x106020e1,0x080018a0,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000039e7,0x10810000,0x000018c2,0x00000000,0x00000000,0x00000800,0x186020c1,0x10601880,0x08200800,0x31441020,0x31233164,0x18603124,0x00001020,0x00000020,0x08200000,0x00000820,0x00000000,0x00000000,0x00000000,0x528a0000,0x3124b575,0x4a280000,0x8c30ef5c,
-0x6b0b62ca,0x39a54a27,0x31443985,0x396541a6,0x28e228e3,0x398428e2,0x290341c5,0x31443964,0x31232903,0x29032903,0x29032903,0x31023964,0x30e15a68,0x28e030e1,0x18402901,0x18401000,0x20802080,0x20e220e1,0x29022902,0x29032903,0x39853124,0x41a53984,0x41a65208,0xb5134185,0x5acad638,0x62ca6b2b,0x524849e6,0x522841c6,0x398641c6,0x49e73124,0x20a23144,0x28e33965,
-0x294420c2,0x520849e8,0x5a696b0b,0x4a073144,0x41855a89,0x522849c6,0x41e75269,0x41c62903,0x5aca4a07,0x52274a07,0x5a893144,0x524662c9,0x20a02921,0x41824162,0x28e03100,0x39414182,0x28a13101,0x31632922,0x31642903,0x20e22902,0x39643144,0x31233144,0x942f0800,0x100020a1,0x186028a1,0x10001840,0x18401821,0x39434183,0x102028e2,0x18402080,0x20801840,0x184028a1,
-0x10000800,0x20801820,0x18001000,0x10001800,0x184028c0,0x208028c1,0x18401840,0x18202061,0x20804163,0x18401840,0x188020a0,0x9cb11860,0x08009c90,0x08000800,0xf73b0800,0x18601020,0x10001860,0x08000800,0x10400820,0x08000800,0x08000800,0x08000800,0x10209c91,0x10001000,0x00000000,0x08001840,0x08200000,0x08200800,0x10401860,0x08201040,0x08400000,0x00200000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00002104,0x10810000,0x39a51081,0x10402923,0x18810820,0x10401020,0x08001881,0x08400000,0x10601060,0x18811040,0x18611020,0x08001020,0x28e31000,0x18810000,0x00000800,0x18820800,0x736d1061,0x39c6f77d,0x08000000,0x08001041,0x00000800,0x00000000,0x00001041,0x00000000,0x00000000,
-0x4a075248,0x29242924,0x39a63985,0x5a895269,0x62aa3145,0x41c66aeb,0x39853985,0x396439a5,0x28e23964,0x6b0b3123,0x18a12903,0x39645a68,0x31233964,0x20801860,0x41a54184,0x28e23103,0x62a941c5,0x39a539a5,0x39434185,0x102028e3,0x7b6d39a6,0x100041e5,0x628928c1,0x7b4c3944,0x736c5227,0x4a284a07,0x49e639a5,0x49e65247,0x41c641c5,0x4a284a07,0x52286b0b,0x52485a69,
-0x5269736d,0x62cb62cb,0x5a695a69,0x6aeb62ca,0x52277b8d,0x83ce6289,0x29233144,0x314441c6,0x39852924,0x398541c6,0x39855227,0x41a53144,0x41838bef,0x31003941,0x39413941,0x20a028a0,0x41843962,0x314328e1,0x31432922,0x20c23163,0x29023144,0x41843143,0x396441a5,0x41c43102,0x9c703923,0x10201840,0x20811840,0x102030e2,0x52681840,0x18200800,0x10001820,0x28e11000,
-0x39643102,0x31024163,0x206030e1,0x20802060,0x20801820,0x20601840,0x10001840,0x080028e3,0x00000800,0x41a59450,0xad53c5d5,0x20c20020,0x31645248,0x28e21881,0x10203924,0x20811820,0x18401820,0x08000800,0x6b2b1040,0x00000000,0x08000820,0x00000820,0x00000000,0x08000800,0x08200000,0x08000800,0x08000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610000,0x08200000,0x08000800,0x08000820,0x08001040,0x08000800,0x08000000,0x00000800,0x08000800,0x08200800,0x102018a1,0xa4f320e3,0x39862904,0xbdf60820,0xc5d7c5d7,0x39c620e3,0x00000000,0x10410000,0x00004a28,0x00000000,0xa5130000,0xdedba4f3,0x000083ef,0x00000000,
-0xad146aeb,0x2945528a,0x5aaa4a69,0x52695aaa,0x41c641c7,0x6aeb41c7,0x62ca62ca,0x94709450,0x31443165,0x31023102,0x39853144,0x52075a68,0x7b8c30e3,0x41e65aa9,0x29235aca,0xacf35aa9,0xf73c7b8e,0x6b2c6b4c,0x398541c6,0x41c639a6,0x41e7738d,0xa4d2d678,0x49a26268,0x41204141,0x422649e4,0x52063122,0x49c53963,0x39634184,0x41c549e5,0x39a520c2,0x6aeb41c6,0x52694a08,
-0x41e63985,0x49e641e6,0xacf362ca,0x5aaa1881,0x62eb7bad,0xa4f37bce,0x188141e7,0x31443144,0x39652924,0x39453945,0x20e33144,0x08005a69,0x39422903,0x39623942,0x28e049e4,0x31203120,0x28c14164,0x10000800,0x186020c1,0x418528c2,0x4a0641a5,0x30e11860,0x39432080,0x20601840,0x10001820,0x18401820,0x18201000,0x20601000,0x20611820,0x18401840,0x20a00800,0x18402040,
-0xc5931840,0x182028a1,0x18203944,0x39641820,0x20801000,0x20c23102,0x20801860,0x20e12901,0x41a520c0,0x20609cd1,0x18402040,0x18603943,0x20801000,0x10002081,0x18400800,0x18201000,0x08000800,0x00003125,0x00000000,0x00000000,0x10400000,0x08000800,0x00000000,0x08200820,0x10410800,0x08000800,0x18a21882,0x00200000,0x00000000,0x00010000,0x00000000,0x21040821,
-0x00000000,0x08000000,0x08000800,0x18400800,0x00001020,0x10200000,0x734c0000,0x08400000,0x00200000,0x00000041,0x5a890000,0x10000000,0x8c0e1840,0x18a10000,0x08001040,0x18811020,0x00000840,0x31650000,0x41e718c2,0xd69a1061,0xef3dd69a,0x00000000,0xad348c30,0x00000000,0x00200000,0xef1b39e7,0x000062ca,0x08200840,0x00000000,0x29230000,0x08200000,0x18c20840,
-0x29233164,0x8c302964,0x21042924,0x41e783ef,0x52493145,0x62ca734d,0x31245248,0x5aaa3985,0x41c64a07,0x39643143,0x29233123,0x28a228c2,0x20c13103,0x29231860,0x31433964,0x39640800,0x31033964,0x41e63164,0x83ad62a9,0x62eb83ef,0x6b4c5aa9,0xad338c50,0x93eeb533,0xde78b512,0x49657b0b,0x39634a05,0x31221860,0x41a43963,0x20a028e1,0x28e23964,0x292339a5,0x290341c6,
-0x28e241c6,0x39643164,0x8c0f3965,0x94703985,0x31443164,0x39c61080,0x39854207,0x52695aa9,0x39855248,0x6b6c4207,0x4a078c2f,0x732c5248,0x732c62ca,0xc5968bef,0x49e4a4d2,0x418341c4,0x186028e0,0x18602080,0x20600800,0x18601860,0x20803102,0x20602080,0x182028a0,0x10001800,0x18401000,0x39035a27,0x100028a2,0x30e11820,0x20612040,0x18201840,0x18001800,0x28c12080,
-0x10001000,0x30e22080,0x208130e2,0x18401820,0x4a271000,0xad13ce17,0x18201020,0x18401840,0x10200820,0x080020a1,0x08000000,0x08001000,0x20801840,0x18611840,0x18601000,0x10002081,0x10001000,0x080018a2,0x39431040,0x08002080,0x08001020,0x08200000,0x10200800,0x08001840,0x00000020,0x00000000,0x00000020,0x00000000,0x08200841,0x18a20820,0x08001061,0x08200000,
-0x4a070000,0x00000000,0x00000000,0x00000800,0x08000000,0x08000000,0xbdb60800,0x00000000,0x8c510000,0xffff0820,0x00000000,0x10200820,0x10601040,0x0820ce17,0x00001040,0x10400000,0x00000000,0x084118e2,0x10814a28,0x08200000,0xf79e0000,0x5aaaef5c,0x08000800,0x00000800,0x10410800,0x08000800,0x42070800,0x7baef77d,0x00000841,0x08400000,0x08200000,0x08410840,
-0x290241a4,0x31a42102,0x294439c6,0x52693986,0x41c74a28,0x83ae83cf,0x28e34a07,0x316441c6,0x4a075248,0x4a284a07,0x52275248,0x49c64185,0x39033103,0x18401820,0x28e128e1,0x20801860,0x30c22881,0x39433964,0x396428e2,0x18a241e6,0x736c2944,0x9490b574,0x8c4f9c90,0xa5129470,0x72ead658,0x28e13942,0x41a43943,0x20a028c1,0x20e13102,0x4a065248,0x398449e6,0x39843984,
-0x28e23144,0x31443985,0x41c641a6,0x20e220c2,0x210220e3,0x316439c5,0x41e63143,0x41c62923,0x31443985,0x28c34165,0x52285248,0x39a641c6,0x6b4b732c,0x83ce630a,0x9450630b,0x9451d658,0xcdd7c575,0x39227b0b,0x30e151e5,0x30c030c0,0x180030c0,0x206030c0,0x184020a0,0x186020a0,0x28c02080,0x18401000,0x18201820,0x18202081,0x10001820,0x28a01000,0x51e52080,0x18404144,
-0x10202060,0x18201820,0x20602081,0x28812080,0x28a02860,0x08001820,0x20601860,0x28a01820,0x94701880,0x10202040,0x28e1f77b,0x080028e1,0x20812081,0x31422080,0x100020a1,0x10001020,0x08001000,0x10401040,0x00000800,0x10000000,0x08001000,0x10200000,0x10001840,0x10001000,0x08000800,0x08000800,0x08200800,0x10400840,0x20a01040,0x28e13984,0x18800800,0x08400840,
-0x00001041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x18611881,0x08200800,0x082020c1,0x00000800,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x6b6d0821,0xbdd6ffff,0x00000000,0x00000000,0x00000000,0x00000000,0x20a220c2,0x08001860,0x00000800,0x00000000,0x08400861,0x00000000,0x00000000,0x00000000,0x00000000,
-0x08001040,0x08000800,0x41c63124,0x94504a07,0x29046b0b,0x39853965,0x39a641c6,0x29233965,0x31653165,0x62ca4a07,0x6b2c41e7,0x5248630b,0x394349a6,0x41853943,0x394349c5,0x396428c2,0x28e23944,0x39643964,0x28e241c6,0x4a273985,0x62ca39a5,0x18814a07,0x52a94a07,0x94905288,0x39858c2f,0x396441a5,0x394328e2,0x28e228a0,0x41a52103,0x20c239a5,0x10602903,0x316420e1,
-0x52273984,0x41c641c6,0xad133985,0x206120c2,0x18a128c2,0x28e25268,0x52282923,0x396683cf,0x3103a491,0x31433164,0x39a66b2c,0x39a62944,0x398541c6,0x83ee4a28,0x5a8a6b2b,0x62ea3985,0xa4b1838d,0xb513c574,0x41a541c6,0x31023922,0x20606ac9,0x206051c4,0x312230e1,0x28a02040,0x184028a1,0x51e62081,0x184028a1,0x28e21000,0x102020a1,0xb5331000,0x0800ffff,0x18201840,
-0x184028a1,0x20603943,0x39021820,0x18202040,0x18401820,0x20804164,0x180028c1,0x28e11880,0x28e22902,0x20a02081,0x18401840,0x28c11020,0x00000800,0x31442080,0x52482903,0x314441c6,0x102062ca,0x08200000,0x00000000,0x00000000,0x10400000,0x08001861,0x080020c2,0x08000800,0x08000000,0x10200800,0x10601020,0x08200820,0x00000000,0x00000000,0x29240000,0x00000000,
-0x00000840,0x00000000,0x00000000,0x08000000,0x08000800,0x08000800,0x10401881,0x10401040,0x08001040,0x00000000,0x00000000,0x00000000,0x00000000,0x08001041,0x10813144,0x18a11040,0x20e30800,0x10611061,0x314418c2,0x20c20800,0x08200000,0x08200000,0x08200000,0x00001041,0xad134207,0x10410000,0x20e320c2,0x08001040,0x08000000,0x10810820,0x00000000,0x08000800,
-0x630b840f,0x5a695a48,0x4a065247,0x31845ac9,0x41a518a1,0x41c63144,0x4a075228,0x39a641c6,0x31443165,0x39a63165,0x20e33985,0x6b0b2103,0x5a683924,0x312349e6,0x39433943,0x312328e2,0x520628e2,0x41844184,0x20c25aa9,0x39a42923,0x314339a5,0x31233984,0x314420a1,0x41e63964,0x39853143,0x39a55248,0x520649e6,0x39843942,0x31643164,0x41a55a89,0x39843984,0x20e23964,
-0x49e61880,0x20c23144,0x316428e2,0x418541a5,0x4a0749c6,0x20c25a68,0x10203144,0x10404a27,0x31431860,0x20e22923,0x00000000,0x52690800,0x734c7bae,0x39c69c91,0x524962eb,0x62c95228,0xacf2a4b1,0xad13c595,0x49e6c5d6,0x39433922,0x30c128a0,0x5a674984,0x72e92060,0x288030c1,0x20802060,0x18401820,0x20601840,0x00001000,0x00001861,0x10001840,0x28e31000,0x18202061,
-0x18201840,0x18202061,0x28802081,0x182028a0,0x28c028a0,0x206028c0,0x20802060,0x18801880,0x08001860,0x00001000,0xb533b513,0x18400800,0x102049e6,0x39c520a0,0x20e239a5,0x10201881,0x31243124,0x104041a5,0x08000800,0x18611040,0x00000800,0x08001040,0x188120a1,0x08001040,0x10410820,0x10201881,0x31440800,0x10810800,0x10610820,0x18a20820,0x18801860,0x10200820,
-0x10601880,0x206020a1,0x28c11860,0x18601860,0x28e13923,0x184030e2,0x18801880,0x00001020,0x08000840,0x29450000,0x000018c3,0x00000820,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00001082,0x00000000,0x0000c5f7,0x41e818a2,0x630bffff,0x00000000,0x10400800,0x18820000,0x08200000,0x080041c6,0x08201882,0x00001081,0x00201061,0x00000000,
-0x290218a2,0x62c92902,0x52874a06,0x83ce632b,0x7b6c628a,0x4a06b513,0x4a0628c2,0x31644a06,0x39a54a07,0x314462ca,0x08001040,0x10612903,0x20a13185,0x20803964,0x20804184,0x310228e1,0x41643943,0x31233943,0x28c13943,0x292239a4,0x20c13122,0x52482922,0x52075227,0x394441a5,0x5a686b0b,0x080051e7,0x18202080,0x28e23122,0x20c13102,0x28a14a26,0x39643143,0x7b6c4a07,
-0x4a265248,0x736c5268,0x29025aa9,0x49e63184,0x7b8d732b,0x39437b6d,0x100020a1,0x39650800,0x31023123,0x5aa86aea,0x10400820,0x20e24a07,0x29020820,0x28c23143,0x31233103,0x49e63964,0x5a6962ca,0x6b2c41c6,0x5a485229,0x6aca30e3,0x51e683ad,0x8bac93ed,0xc5d59c4f,0x08008c2f,0x28e028c0,0x18401860,0x10002080,0x20814985,0x10001820,0x20801000,0x08001020,0x20811000,
-0x416428c0,0x28a01840,0x20602080,0x18203922,0x18202040,0x10001000,0x10001000,0x10001820,0x18402060,0x18602080,0x290120a0,0x394428c1,0x18601860,0x18601840,0x08000000,0x08000800,0x08000000,0x29240820,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x08000800,0x08200800,0x10000800,0x08000800,0x08000800,0x08200800,0x00000840,0x08200020,0x08200800,
-0x10600000,0x18401060,0x18401840,0x18821840,0x08201020,0x08001060,0x00000000,0x00000000,0x00000000,0x00000820,0x08000000,0x08000800,0x10001040,0x10001020,0x10201020,0x08000800,0x08000800,0x00000800,0x10401880,0x08000000,0x10601881,0x10400000,0x18801060,0x08001060,0x00001881,0x08401861,0x00007bce,0x00001041,0x00000000,0x00000000,0x00000000,0x080041c6,
-0x20e20000,0x41843942,0x186020a0,0x41e51080,0x5a4783ec,0x52473123,0x49c53101,0x31444184,0x18810800,0x5228a4b2,0x3965a4b2,0x18812923,0x39850000,0x31641040,0x5a685a68,0x394449e6,0x7b4c49c6,0x20c23144,0x62ea1040,0x41a583cd,0x10601020,0xbdb54a47,0x39445207,0x41a55207,0x3944730b,0x52074165,0x7b6d5a48,0x72c86226,0x51a44122,0x41844122,0x18811880,0x20c20000,
-0x20c028e2,0x28e12902,0x08400000,0x5aa95248,0x9c917bad,0xa4b1a4d2,0x4a073985,0x6b0b3965,0x10201040,0x1020b554,0x28e128e1,0x29021840,0x10203163,0x20a17bad,0x31033944,0x49c641a5,0x732c5a69,0x7bce6b0c,0x520762eb,0xd617cd95,0x418549c6,0x8bac6267,0xa4b1a4b0,0x18812903,0x41631840,0x396241a3,0x39433101,0x206128a1,0x10001000,0x39431820,0x18203103,0x20601000,
-0x20602080,0x20603943,0x20601840,0x18402040,0x18201840,0x18202080,0x20801000,0x18402060,0x00003123,0x20a01860,0x20a01860,0x31023943,0x18801860,0x08001880,0x10600000,0x08001861,0x08000000,0x18611861,0x08201861,0x10200820,0x18201020,0x08000800,0x00000800,0x00000000,0x292420c2,0x31642903,0x312328e2,0x31652903,0x002018a1,0x00200020,0x00000000,0x10a20000,
-0x10621882,0x10000000,0x18401020,0x18801840,0x00001060,0x00002903,0x00000000,0x00000000,0x00000000,0x00200840,0x18a00000,0x28a11880,0x08201860,0x104018a1,0x94501040,0x10200000,0x10200800,0x10401040,0x10003122,0x41640800,0x20801840,0x314318c1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610000,0x00001061,0x18811040,0x08001061,
-0x00000000,0x00000000,0x00000000,0x00000000,0x392018e3,0x39205a44,0x498330e0,0x20814142,0x00400800,0x29036b0b,0x104018e0,0x08000000,0x20a11040,0x00001020,0x52480800,0x5a894a07,0x6b2b5268,0x4a07ffff,0x5a685a68,0x5aa920e2,0x52487b8c,0x398583ee,0x734c7b8d,0x29035aa9,0x628841a5,0x31244185,0x734c5227,0xacd162a9,0xa42fd5f6,0xcdd59bee,0xa4d2cdf7,0x3985ad34,
-0x102020e2,0x20a11860,0x39842902,0x41a52902,0x186018a1,0x28c21040,0x28c30800,0x49c749c7,0x08003144,0x52480800,0x41e64a27,0x41a649e6,0x41c64185,0x42075268,0x4a275aaa,0x49e641c6,0x31659c91,0x7b8e62cb,0x41c76b0c,0x62ca5a8a,0x41c77b8d,0x946f8c0e,0xa4d1b553,0x3143734b,0x28a01000,0x206028c0,0x28c030e0,0x10002080,0x10001000,0x08001800,0x08001040,0x20401820,
-0x418528a1,0x20a13944,0x206020a1,0x18203102,0x10001800,0x416328a1,0x20602080,0x28a12081,0x28a02080,0x20611840,0x18401821,0x18401820,0x39831860,0x10202081,0x28e21840,0x182028c2,0x08001000,0x10200820,0x080020a1,0x000020a1,0x08000000,0x29433164,0x31643984,0x18c13184,0x00000020,0x00000000,0x21021060,0x08400000,0x08201060,0x00000820,0x10400800,0x10410800,
-0x00000000,0x00000020,0x00000020,0x08000000,0x00000820,0x00010000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000001,0x00000021,0x10610820,0x00000800,0x00001060,0x000020e2,0x00000820,0x002083ef,0x00000000,0x00000000,0x00000000,0x00000000,0x21020000,0x00000820,0x00200000,0x5ac90020,0x00000800,0x00000020,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x39830000,0x208020c0,0x206020a0,0x18213101,0x00000800,0x00000800,0x10410000,0x18a11060,0x082062ca,0x20c22923,0x00003965,0x08201061,0x08201060,0x20c220c2,0x41c66b2b,0x52685268,0x29233164,0x29231881,0x6b0b5268,0x942f8c0e,0xbd548bee,0x39643964,0x4a0718a1,0x5a685a68,0x8bad8bee,0xacd1a490,0x00009cd2,0x62ca0820,
-0x31434a06,0x392328e2,0x29232902,0x10401020,0x20a11880,0x31020800,0x208128e1,0x20a13103,0x20c22923,0x4a4741e6,0x20a128e2,0x10201020,0x28c220a1,0x8c0e7b6c,0x20a15227,0x62a95a89,0x000083ae,0x734c39a5,0x5aaa4a07,0x3964bd95,0x5a896b0b,0xc5b6734b,0x9c927b8e,0xc5b58bee,0x836dacd2,0x396349c5,0x28c020a0,0x28a128a0,0x08001820,0x10201800,0x18611040,0xacf328c0,
-0x28a128a1,0x10201840,0x28c11000,0x18401000,0x10001820,0x20601820,0x28a02060,0x20811000,0x20601820,0x18402060,0x20601800,0x10001820,0x18401840,0x10201020,0x20801860,0x20602060,0x6aca28a2,0x20c20800,0x20c21881,0x18201881,0x08002061,0x00000800,0x10200000,0x08400820,0x00200000,0x08200820,0x10400000,0x21010820,0x10600000,0x18810000,0x10600820,0x104018a0,
-0x10401860,0x18601860,0x10202080,0x5a881000,0xffbead13,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08200820,0x10201840,0x00000820,0x00000800,0x08000800,0x00000800,0x00000000,0xf79d0000,0x00000000,0x00000000,0x00000000,0x000062ea,0x10600000,0x00000800,0x00000000,0x08210800,0x00000000,0x00000000,0x00000000,
-0x00000000,0x18c30020,0x000031a6,0x00000000,0x00000000,0x00000000,0x18610000,0x940d0800,0x00000820,0x00000000,0x080039c6,0x08400841,0x00000000,0x20a20020,0x00000800,0x10400000,0x18a10000,0x082018a0,0x29021860,0x31843184,0x5a8939a5,0x39842903,0x39a520c2,0x732b20e2,0x49a5940e,0x31624163,0x41c63144,0x20803943,0x732a7b6c,0xad32ce15,0x4a0673cd,0x18c12102,
-0x18a120c1,0x41a53103,0x080020c1,0x41c53984,0x39842902,0x83ae0800,0x100030e3,0x41843123,0x20c241c6,0x210241c6,0x28e220e2,0x394262ca,0x416549c4,0x208030e3,0x20c23923,0x31441060,0x31441040,0x31642902,0x20e22902,0x188020c2,0x18a01860,0x290220c2,0x398441e5,0x6b2b5aa9,0x6b0a62e9,0x41e59c92,0x41833921,0x39423101,0x206028c1,0x10402061,0x00000800,0x18810801,
-0x30e24164,0x39441840,0x626720a1,0x206049a5,0x20601000,0x18401820,0x20801000,0x18202080,0x28c028c0,0x10001860,0x20803944,0x20602080,0x102020a1,0x10201860,0x08001020,0x18402060,0x10001000,0x10201841,0x00000800,0x10811081,0x00000000,0x00000000,0x08000800,0x08000800,0x000018e1,0x00000000,0x00000000,0x08000000,0x00000821,0x00000000,0x00000000,0x08000000,
-0x00000000,0x00200020,0x00000000,0x10400000,0x00000000,0x18000800,0x10400800,0x08000800,0x08200820,0x08000820,0x08200800,0x106018a1,0x08000820,0x10210000,0x00000000,0x08200000,0x08200800,0x08200800,0x00000800,0x08200000,0x00000000,0x08001021,0x10200800,0x10401040,0x08200000,0x3985e6fa,0x00000000,0x18a00841,0x20a020e1,0x00001080,0x10601020,0x00000000,
-0x00000000,0x5a253965,0x52264183,0x7b6b83ac,0x08003984,0x08200800,0x52040000,0x392028c0,0x41c249c2,0x00001880,0x10200000,0x28a10800,0x310218a0,0x28e22942,0x00001860,0x00000000,0x00000000,0x00000000,0x08000800,0x00000000,0x084039a5,0x62ea0000,0x18a04a47,0x52476ae9,0x10401880,0x20a01020,0x41843923,0x18606ac9,0x7b6c3923,0x4a261840,0x00007b6d,0x20e20000,
-0x20c13143,0x290339a4,0x20c21860,0x29020000,0x28e21881,0x41a53984,0x396420a1,0x312341a5,0x83ee7bad,0x20c241c6,0x18813144,0x18403144,0x6aea3102,0x31235a47,0x29013943,0x31243122,0x39643964,0x29223164,0xacd241a5,0x20c128e2,0x20a141a5,0x20c25207,0x08006aea,0x5aa90800,0xa4b1942f,0x08200000,0x39423101,0x30e14164,0x28e030e1,0x312228e1,0x28e141a4,0x10001860,
-0x18201840,0x310220a1,0x18202080,0x20402040,0x10201840,0x18402081,0x18401000,0x20602040,0x08002080,0x51e51820,0x10002060,0x20801000,0x31222080,0x628841c5,0x10003123,0x18601840,0x10201000,0x20802060,0x20812060,0x28c21861,0x39431840,0x20a10800,0x1060ad12,0x00000000,0x00000000,0x00000000,0x29030840,0x18c118a1,0x20e020c2,0x18c018c0,0x21001080,0x18c11060,
-0x18c018c0,0x106018c0,0x20c018c0,0x210120c0,0x41e62941,0x29032903,0x08001861,0x08001040,0x08200820,0x08200000,0x10410840,0x00000800,0x08000000,0x08201040,0x10200800,0x08201081,0x00000000,0x00000000,0x00000000,0x000018c2,0x00000840,0x00000820,0x00000820,0x00000000,0x18c20820,0x08200820,0x08000820,0x08000820,0x18601020,0x08001041,0x00000000,0x00000000,
-0x72856224,0x49c36203,0x18601800,0x08001860,0x08001000,0x18201020,0x734c940d,0x416272e8,0x49416265,0x49604140,0x28a02840,0x30c030e1,0x08001001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x8c709cb2,0x39a439a6,0x41c641c6,0x62ca2902,0x8bee8bee,0x520751e6,0x396341a3,0x28c149e5,
-0x18803143,0x080020e2,0x10601040,0x31440800,0x290241a5,0x20c22902,0x20a11020,0x396428c2,0x28e22922,0x18810000,0x18801060,0x18408c2f,0x28c13102,0x20801860,0x29033943,0x28e12923,0x28e22903,0x31644a06,0x49c649c6,0x62ca3964,0x49c649e6,0x49e64185,0x31443964,0x314441c5,0x39a55248,0x31231060,0x28c02080,0x20601820,0x39422081,0x10201000,0x39634184,0x41a428e1,
-0x18603943,0x10202081,0x18001020,0x10001000,0x18401820,0x10002081,0x20811000,0x18201840,0x18002081,0x20602060,0x20602080,0x08001840,0x10001000,0x18601000,0x10001000,0x18601820,0x10001000,0x182028a1,0x20811820,0x10201840,0x08001000,0x100028c1,0x00001060,0x08200000,0x08001020,0x10400800,0x08001040,0x08001020,0x08010800,0x31631060,0x52883183,0x000041e7,
-0x00000000,0x08000000,0x00000000,0x00000000,0x08000000,0x00000000,0x08000800,0x00000820,0x10401020,0x20811860,0x18a11040,0x10611040,0x00000000,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08000000,0x00000800,0x00000800,0x00001040,0x00000000,0x08400000,0x000041e7,0x08200000,0x08000820,0x08200000,0x00000820,0x00000000,0x00000000,
-0x93e97ae6,0x62658327,0x38e06243,0x51e351e4,0x49a23900,0x39022860,0x414230e0,0x100049c2,0x49223900,0x62456225,0x5a055a04,0x416059a4,0x49a138e0,0x41634140,0x00000000,0x00010000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4a061061,0x08000800,0x52250800,
-0x00003121,0x00000820,0x39840000,0x08000800,0x10403143,0x28e22902,0x18601060,0x394328e2,0x49e65a89,0x08003102,0x28e120a0,0x310220a0,0x20803121,0x20a141a4,0x4a063102,0x39a420c1,0x31432903,0x7b8d2903,0x41653964,0xbdb54185,0x5a686b2b,0x18811040,0x39645aa9,0xad149450,0x39a6b575,0x8c0f83cf,0x3103838d,0x18402081,0x18601000,0x18611860,0x10000800,0x10400800,
-0x10201020,0x08001820,0x10000800,0x10001820,0x10001020,0x20601000,0x18401000,0x20601820,0x10001000,0x18201000,0x18201820,0x10002080,0x10201000,0x10201840,0x39443924,0x39644184,0x208028c2,0x20812081,0x18601020,0x18201820,0x18812081,0x10201020,0x08400840,0x18611020,0x10401020,0x18601840,0x10601860,0x10001020,0x18401861,0x10201860,0x00000800,0x00000000,
-0x00000000,0x00000800,0x00000000,0x08000800,0x10200800,0x186028c1,0x08001880,0x10411020,0x10400820,0x08400800,0x00000800,0x20e21060,0x08400840,0x00000000,0x00000000,0x10400000,0x20c20820,0x08000800,0x08200000,0x00001060,0x00000000,0x00000800,0x08200820,0x08400860,0x18810000,0x104018a1,0x41c63123,0x00000800,0x18810000,0x08401881,0x08400000,0x00000000,
-0x18600800,0x288028c0,0x18211840,0x30e01000,0x39206ac6,0x72a64163,0x72864982,0x10006245,0x5a014160,0x51c251c2,0x49614960,0x51e43920,0x5a0351e2,0x39005a03,0x20001800,0x51e24120,0x520372e6,0x31226ae9,0x00000800,0x49c41000,0x28a059e5,0x28801800,0x08002880,0x00000000,0x00000000,0x00000000,0x20c20000,0x628962ca,0x734c6aea,0xad346b4b,0xb5749cd2,0x31633984,
-0x49a43903,0x394330c1,0x20a02060,0x10001840,0x20a21000,0x49e649e7,0x41841060,0x18402081,0x08001040,0x31022081,0x52683164,0x206139a5,0x28e21000,0x28e23123,0x39840800,0x31643143,0x31443964,0x10400800,0x20611020,0x08403964,0x31440800,0x18600000,0x39641881,0x522741a5,0x83ce6b0b,0x3143a4d2,0x734b7b8c,0x5a681860,0x31433923,0x628841a5,0x18601860,0x10400820,
-0x10001840,0x10001000,0x10001000,0x10201840,0x20611000,0x10001820,0x30e31840,0x20601840,0x10201860,0x18401840,0x18402060,0x182028c2,0x18402040,0x18401860,0x08001860,0x18401840,0x18201000,0x10202061,0x18601840,0x08001820,0x08000800,0x18a10800,0x08001061,0x00000000,0x08000800,0x10200800,0x10601840,0x10201860,0x10601820,0x18811881,0x18801040,0x108018a0,
-0x100020a1,0x188020a1,0x10401040,0x188020c1,0x08000820,0x08000000,0x10600820,0x10600840,0x08201040,0x10611040,0x08201040,0x10610800,0x08401882,0x10400800,0x08201040,0x10401041,0x00000820,0x00000800,0x08200000,0x29231060,0x00000820,0x18820000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000020,0x08400000,0x1060bdb5,
-0x62430000,0x39008349,0x49c65a46,0x62236a64,0x39208307,0x62447b49,0x08206244,0x49410000,0x49804101,0x41404140,0x49a14140,0x72e74981,0x188028a0,0x416120a1,0x620559e2,0x59e34160,0x410051c2,0x38e05a23,0x73074982,0x62467ae8,0x5a055a05,0x08003901,0x49a34964,0x41415a04,0x00001820,0x08000000,0x18200800,0x30a038c0,0x51e430c0,0x00005a66,0x00000000,0x00010001,
-0x28e20800,0x08000800,0xacb08bab,0x20a11820,0x00000000,0x18202860,0x83ce1000,0x18600800,0x39440800,0x18810000,0x10610800,0x29022903,0x184028a2,0x49a62060,0x41a51861,0x20c10000,0x10401020,0x28c23102,0x10001860,0x28a128a1,0x08403143,0x28e32103,0x31033944,0x20a15aa8,0x4a2818c2,0x188141e6,0x292320c1,0x39a43984,0x41e520e1,0xad33c618,0x00002944,0x10201881,
-0x18200800,0x08001840,0x18602081,0x204028e1,0x18001800,0x20601820,0x10001000,0x18202060,0x18402060,0x20802060,0x10001840,0x18201820,0x10001820,0x10200800,0x10200800,0x18201000,0x20411800,0x10201840,0x18402081,0x18400800,0x18402081,0x20811861,0x20802081,0x10400800,0x08001020,0x18611040,0x10200800,0x10001820,0x08001000,0x29012902,0x18a10840,0x20e11081,
-0x08201040,0x08000000,0x00200000,0x10411020,0x08200820,0x080018a2,0x08201040,0x00000800,0x10201020,0x00001881,0x08000000,0x10001000,0x10201020,0x18800800,0x10201041,0x08001000,0x08200800,0x20e020c1,0x10203163,0x08611040,0x00000000,0x00000000,0x10401040,0x08000800,0x00000000,0x00000000,0x18400800,0x10401840,0x10201020,0x18a14a27,0x00001060,0x08200820,
-0x08000800,0x41a33942,0x72e96288,0x6aa65203,0x7ae77307,0x836861e2,0xa4ce6265,0x08209c6e,0x00000801,0x00000820,0x08406ac8,0x00000000,0x00000800,0x62880820,0x51c16287,0x496259e3,0x72a759e4,0x8baaa44f,0x000020c1,0x00000000,0x10600000,0x4a0541e5,0x62446265,0x6aa672c6,0x72866a86,0x6a456225,0x6a436a23,0x498051c1,0x59e151c1,0x3964b4d1,0x206228e2,0x18625208,
-0x51e63965,0x30e251e6,0x41834183,0x94706ac9,0x39423984,0x20603900,0x00001020,0x08001020,0x20a120a1,0x08000000,0x10401020,0x52681020,0x00000820,0x41850800,0x41c65227,0x082020c1,0x10002061,0x10202081,0x208049c5,0x39633102,0x31449470,0x5a473144,0x28e128c1,0x29023123,0x20a12903,0x41841860,0x08002902,0x10200800,0x20823124,0x000041a4,0x18600800,0x00000800,
-0x10000800,0x10001000,0x10000800,0x10002061,0x10001820,0x10002060,0x31013103,0x10202080,0x10001820,0x18401000,0x18402080,0x20801840,0x18402080,0x28c22061,0x10001020,0x08002061,0x18202060,0x18401020,0x18401860,0x20a11860,0x18401840,0x10003102,0x18401020,0x20601020,0x10602901,0x18801040,0x28e21880,0x08001820,0x10600800,0x18801040,0x08001880,0x00000840,
-0x10600820,0x10600800,0x18811040,0x18612080,0x20c21040,0x10201020,0x10201020,0x10201020,0x08001861,0x00001020,0x00000000,0x10201000,0x00001840,0x00000800,0x10200800,0x18401860,0x18601020,0x10201040,0x08000800,0x08200820,0x00000000,0x08200820,0x10401881,0x08001060,0x00000000,0x00000820,0x08000800,0x10201020,0x00000800,0x08200800,0x00001881,0x10410800,
-0x6225acb0,0x10401000,0x5a843962,0x104020c2,0x08000800,0x5a246265,0x6ac68b89,0x73075a27,0x73245a66,0x5a6462a7,0x416459e5,0x49e43982,0x10204a05,0x08001000,0x00000800,0x000041a4,0x00000000,0x00010000,0x00000000,0x00000000,0x00000000,0x18620001,0x30e01860,0x39003920,0x00203121,0x394028c0,0x6a6651c4,0x624472a6,0x51a151a2,0x39203920,0x39404140,0x49e14160,
-0x20401820,0x51e24160,0x30e149a3,0x18a11820,0x184030e1,0x182059e6,0x08001020,0x62a91040,0x102049c6,0x00000800,0x10201861,0x10821020,0x00000000,0x10200820,0x00003944,0x4a271040,0x08001000,0x31023964,0x10001840,0x31221000,0x28c23985,0x31222081,0x396328e1,0x31233164,0x418428a1,0x18403102,0x316339a4,0x31633964,0x31223963,0x00001840,0x18201820,0x20a20820,
-0x10001040,0x08001020,0x20801000,0x20812060,0x20801820,0x28e03102,0x20402080,0x20a01840,0x100049c6,0x18202060,0x20601840,0x18002061,0x18401000,0x10001020,0x18201860,0x18001820,0x20602060,0x20811860,0x10202080,0x10001840,0x18801020,0x10402080,0x18601860,0x20601000,0x08001041,0x312320a2,0x418420c0,0x100028e2,0x10601020,0x106020c1,0x20e22102,0x108018a1,
-0x08000000,0x00000000,0x10000000,0x10201000,0x30e21820,0x10001000,0x20801840,0x20612060,0x10201040,0x08201040,0x10201040,0x10001000,0x18001000,0x18201800,0x18600800,0x10001840,0x20a21020,0x10400800,0x10401060,0x08200800,0x10610840,0x00000000,0x00000000,0x00000000,0x08200820,0x00000000,0x00000800,0x29010800,0x18802901,0x08000000,0x20e018a0,0x10601060,
-0x08200820,0x188020e1,0x106018a0,0x00000000,0x18200000,0x08000800,0x00001000,0x49804161,0x18604181,0x08000800,0x20801040,0x10201001,0x00000000,0x5a862121,0x208041a2,0x10801000,0x10200000,0x7b6b1820,0x940c8369,0x8b899c0b,0xd5b38367,0x4941c572,0x08001000,0x31230800,0x420449e3,0x39832903,0x39425206,0x41203900,0x20804160,0x6a864182,0x6a666265,0x6aa66aa6,
-0x51c45204,0x30e04161,0x28c04141,0x28c03922,0x20801821,0x59e52020,0x00000800,0x00000000,0x62240020,0x41204960,0x30c030a0,0x10401840,0x00000000,0x31020000,0x28e20000,0x00000820,0x18602903,0x00003922,0x49e61020,0x5a4728c1,0x100020e2,0x49e641a5,0x39643123,0x00001840,0x18801860,0x49e63143,0x186041a4,0x08001000,0x28e228a1,0x08001840,0x10200800,0x08200800,
-0x10000800,0x10001000,0x10001020,0x10001820,0x18401000,0x18201840,0x18201800,0x18201820,0x180028a1,0x20811800,0x10001800,0x10001800,0x10001840,0x10000800,0x20611800,0x20611840,0x18401840,0x10001840,0x18401840,0x20601860,0x18401840,0x20601840,0x18401840,0x18201840,0x186020a0,0x31233964,0x10204184,0x10200800,0x10402080,0x10201040,0x49e63144,0x08000000,
-0x08400000,0x20a11880,0x10001000,0x208028c2,0x28e13101,0x20a028c1,0x28c11860,0x08000800,0x00000800,0x10200800,0x18401000,0x08000800,0x18800800,0x102020e1,0x10400800,0x08200800,0x18a01880,0x18601060,0x10201060,0x10600800,0x08001040,0x10400800,0x082018a1,0x10400840,0x10610820,0x10610820,0x08001020,0x00001020,0x08201060,0x00001041,0x00001881,0x00000000,
-0x00000820,0x08000800,0x30e10800,0x30e03920,0x39210000,0x39200800,0x41213920,0x18600800,0x00000800,0x00000800,0x10602901,0x08400000,0x08000000,0x83486266,0x830693c9,0x62a76a87,0x52045204,0x20807308,0x080020a0,0x49c21000,0xa42a72a4,0xa40c93a8,0x49c249c3,0x7b2a4183,0x00000000,0x00000000,0x00000000,0x08000000,0x082018a0,0x08000000,0x10200800,0x49614183,
-0x39404161,0x49a249a2,0x41624162,0x30e028a0,0x41212060,0x59e26224,0x41844141,0x52066288,0x7b0849e5,0x5a023900,0x5a0351e1,0x290149c2,0x00000020,0x00000000,0x00000000,0x00000000,0x10400000,0x29024184,0x18810800,0x08002902,0x28c20000,0x39642081,0x28c220a1,0x18611840,0x00001881,0x00000800,0x08001060,0x00000800,0x00001001,0x08000800,0x10400800,0x00000000,
-0x10001841,0x10001000,0x20611000,0x10001000,0x18001820,0x20401820,0x18202061,0x206028a1,0x18201840,0x18401820,0x18201820,0x18001820,0x10001840,0x10001000,0x18401000,0x10001000,0x18401800,0x20601840,0x10001820,0x206028a1,0x20811840,0x18202040,0x10002040,0x10201000,0x18201820,0x310241a5,0x18602081,0x18403123,0x08001020,0x10601040,0x18600800,0x18c12903,
-0x41843985,0x20604164,0x00001000,0x100028c2,0x208030e1,0x208220a1,0x10401020,0x208020c0,0x10404a06,0x18601860,0x10001860,0x18611020,0x10000800,0x18401000,0x18201000,0x080018a0,0x18a10800,0x08001040,0x10401040,0x188020c0,0x18801040,0x20811860,0x00001060,0x00001040,0x00000820,0x39a641e6,0x00001860,0x29222903,0x39c52943,0x736e0000,0x39c53164,0x31432923,
-0x5a0351e2,0x7ae65a02,0x18001840,0x52049388,0x39028306,0x100030c1,0x62260800,0x38c13100,0x10000800,0x39c41060,0x62895247,0x08001020,0xa48f5a86,0xa469a46e,0x8b667b04,0x59e26a83,0x83277ae6,0x1860834a,0x30c01000,0x41604141,0x41406262,0x51e46243,0x00001820,0x08000000,0x42084207,0x62ea62ea,0x73096a88,0x10616aeb,0x08410000,0x00000000,0x00000000,0x00000000,
-0x31020000,0x28e04161,0x31212080,0x49c33120,0x41810800,0x416149a2,0x288030e0,0x08003941,0x18401820,0x30c02060,0x39613102,0x18602080,0x52480000,0x5a687b2b,0x18405a28,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00200000,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000841,0x00200000,0x08000800,
-0x08000800,0x10001000,0x10000800,0x10001800,0x10001000,0x18201820,0x18402081,0x10002020,0x18002060,0x18002061,0x20402040,0x20402881,0x18611000,0x10001000,0x18401820,0x18201840,0x10003903,0x28802060,0x20601840,0x18402060,0x20801840,0x18402060,0x18202060,0x20812060,0x18401000,0x28c21840,0x18200800,0x28c14164,0x10201000,0x28e11880,0x316420e2,0x316541e6,
-0x316339a6,0x30e128e0,0x10001820,0x30e11000,0x30a23102,0x30e11820,0x20c05225,0x10002080,0x20a028e1,0x208020a0,0x10203123,0x10401020,0x10000000,0x08001000,0x10201840,0x08001860,0x18812903,0x100020a1,0x10013943,0x08001021,0x00000800,0x10601860,0x082018a1,0x080041a5,0x10601060,0x00000800,0x08200800,0x28e11040,0x10001840,0x08000800,0x29030820,0x292420e2,
-0x51c059e1,0x62007283,0x7ae66a20,0x83477262,0x59e14940,0x5a036a83,0x51c06a84,0x59a138e0,0x6a456266,0x10005204,0x49826a87,0x51c43900,0x72c65a44,0x73877307,0x08214a64,0x08000000,0x00000000,0x51e51800,0x182030a2,0x10001820,0x18001820,0x20e01000,0x6b2949e4,0xa4d083ec,0x83cd5248,0x31636b2b,0x00200020,0x08001000,0x08000000,0x08200800,0x00000000,0x00000000,
-0x00000000,0x00000800,0x08000002,0x08000000,0x28e10000,0x4a061860,0x49e541c5,0x52275a66,0x7b8d6b2b,0x29220000,0x00001000,0x08000800,0x31011840,0x41212040,0x728872c7,0x00002840,0x49a41000,0x52064165,0x7b4b5a46,0x41a51000,0x49830000,0x20a04161,0x08003922,0x00000801,0x00000820,0x00000000,0x00000000,0x00000000,0x5aaa0820,0x18a20000,0x08613185,0x00000820,
-0x00001860,0x18400800,0x18001841,0x18201000,0x10000800,0x10001800,0x20802040,0x30c028a1,0x39223921,0x30e22040,0x39222060,0x20802060,0x10002080,0x18401860,0x18202060,0x28a03922,0x20602060,0x20402060,0x20602040,0x28c11840,0x28a02060,0x182028a1,0x20601820,0x20801000,0x10001820,0x10001860,0x186020a2,0xce171020,0x08000800,0x00000000,0x00000000,0x00000000,
-0x31220000,0x41824183,0x182028e0,0x20811000,0x496530e2,0x39224984,0x20602060,0x10000800,0x10201840,0x28c11880,0x28e21000,0x10601840,0x20a120c1,0x28c21020,0x08001840,0x08001000,0x18401000,0x10201020,0x41821020,0x30e13100,0x29033964,0x10401060,0x10600000,0x41c62903,0x5a893985,0x10001840,0x290328e2,0x28c02903,0x30e33943,0x29023123,0x4a061880,0x5a891040,
-0x28802020,0x28407283,0x7aa46200,0x51c172a5,0x38c02021,0x10000800,0x30c06a64,0x39014981,0x20405202,0x18400800,0x41402040,0x18212021,0x10000800,0x312228c1,0x5a253963,0x8b688b8a,0x51a17ae6,0x8b488327,0x52208bc4,0x52205220,0x8bea1000,0x08201840,0x00000000,0x08010000,0x5a6872ea,0x83888ba8,0x30c130e0,0x41a320c0,0x49c53102,0x7b6a72c9,0x5a65836c,0x732849c3,
-0x000018a0,0xa4914144,0x312062a6,0x00003141,0x00001040,0x00000000,0x00200000,0x00200000,0x08005a88,0x49c60000,0x6b0ae6b9,0x51e420a1,0xa46a9bca,0x93cb5204,0x61c1a40b,0x62438b67,0x6a866a42,0x31430000,0x49a249a2,0x41434162,0x38e151c5,0x10001800,0x41204963,0x624551a2,0x41614161,0x18204162,0x41623901,0x00001841,0x00000000,0x00000000,0x00200020,0x00000000,
-0x4a0739a4,0x62a95268,0x49a428e1,0x18602060,0x39421020,0x310020a0,0x8bac28c0,0x5a05834b,0x51c430c0,0x834a51a3,0x836b6a87,0x62258bcd,0x41414983,0x51e44982,0x28c030e0,0x310049c3,0x20602040,0x41632060,0x206028c0,0x39012880,0x414230a0,0x28a02880,0x202030c1,0x20811000,0x20601820,0x08001840,0x00000020,0x1000ffde,0x10201020,0x08000800,0x39843985,0x29223983,
-0x28e03983,0x28c02900,0x10203942,0x51e44163,0x41424183,0x41834163,0x414251a4,0x39214983,0x28c11840,0x20803923,0x10001000,0x20801820,0x10201820,0x10201861,0x1020eefb,0x08001820,0x18201000,0xd6171000,0xd6784185,0x20811860,0x49e751e7,0x526841a5,0x18800800,0x00000800,0xe6ba20c2,0x0800a4d2,0x31653965,0x314439a6,0x5aa96b4b,0x20a23123,0x102028a2,0x08202924,
-0x6a416221,0x72647ac4,0x6a227262,0x6a627282,0x61c24102,0x7b285181,0x6a866285,0x518051e1,0x61e161e1,0x51407285,0x6a626201,0x5a2051a0,0xe6b6940b,0x62465a65,0x29007b09,0x10001880,0x51e12040,0x62447b27,0x5a6149e0,0x5a2151e1,0x6a867b45,0x82e54961,0x62407283,0x6a247aa4,0x498193ca,0x10002883,0x20801000,0x30e21801,0x72c75203,0x1820a44d,0x59e41000,0x622538e0,
-0x62456265,0x83ab6287,0x5a245a24,0x62665a24,0x51e46266,0x39624182,0x39a341a3,0x00000800,0x08002903,0x00003985,0x00003144,0x00000000,0x00000000,0x18600800,0x30a00000,0x20607b29,0x41e30800,0x00000800,0x10200000,0x396128e0,0x59c43921,0x9bcc8b8a,0x622472a6,0x72a61800,0x28606225,0x18002000,0x72a561e3,0x204038e2,0x31434143,0x396341a4,0x080049e5,0x00200000,
-0x08000820,0x20c249a4,0x08000000,0xcdb43143,0x51e48bac,0x5a055a46,0x5a0372c7,0x51a12020,0x20a03940,0x28a06225,0x5a056246,0x49a249a2,0x5a034982,0x51c251e3,0x62246244,0x51c272c7,0x59e38b49,0x28a04981,0x412172a6,0x51e24962,0x7b286a85,0x41414141,0x5a0530a0,0x18405a66,0x39426246,0x39652880,0x00000000,0x10810000,0x7b4b6288,0x49e662c9,0x6ac862a7,0x08004184,
-0x30e030e1,0x310028e0,0x20803940,0x5a0451c4,0x6a666245,0x72a76aa7,0x6aa672e7,0x30a059e4,0x28a04142,0x20802880,0x20601000,0x0800730b,0x314328c1,0x39630820,0x9c717b6d,0x31249c91,0x31033965,0x20813944,0x5a896aeb,0xa4913144,0x520720a1,0x5a68d657,0x08203964,0x31441060,0x28e3d658,0x5a69a4b2,0x20a16b2b,0x31440800,0x39652903,0x18603103,0x418530e3,0x31441040,
-0x59846a41,0x7a8459a0,0x59a159c0,0x59a059a0,0x39003060,0x30c04120,0x51824142,0x49604960,0x180051c1,0x6a434921,0x51806a23,0x5a021800,0xa46c7309,0x83667b68,0x72c48366,0x8baa8346,0x5a248b89,0x8b651800,0x73236ac3,0x9bc88b46,0x8b849be9,0x10002020,0x832172c2,0x82a382a4,0x7a826a42,0x7b038b24,0xa4297ae3,0x72877ac8,0x5a0238c0,0x2060b4ec,0x9bc91860,0x28404100,
-0x18201000,0x10621000,0x08000000,0x10201000,0x08000000,0x30e40000,0x000049c5,0x08000000,0x10610820,0x000049c6,0x10400800,0x00001061,0x00000800,0x204039a5,0x30c21000,0x00001840,0x08004a07,0x10200800,0x00000000,0x00000000,0x39420000,0x18000800,0xac8facb0,0x08001000,0x28801800,0x7ac44961,0x72a67263,0x100049e5,0x104030e0,0x72ea20a3,0x6aa76287,0x5a0530c0,
-0x7ae959c4,0x414151c3,0x52036265,0x10205223,0x00000020,0x00200000,0x00010041,0x39210000,0x30e251c4,0x9bca30c0,0x416159c2,0x41815a26,0x620520a0,0x93cb6a85,0x628351c2,0x51a151a2,0x61e35181,0x622451c2,0x72885a03,0x7ae85a03,0x6a456a66,0x72c651c2,0x6aa54140,0xa44f6265,0x49a26245,0x20803962,0x310020a1,0x31203920,0x184251e6,0x39663105,0x31010800,0x20204142,
-0x52266ac8,0x08008bcc,0x62a77b6d,0x51e359e3,0x59e459c2,0x51834121,0xd5b49c6f,0xff1afefb,0x51a47ae9,0x38e230a0,0x30e3832b,0x51e7e678,0x5a484164,0x7b2c3103,0x312441a6,0x62eb0820,0xde591861,0x4a080800,0x08202924,0x188020e3,0x520628e2,0x39454165,0x28c34165,0x310328c2,0x312328c2,0x186020a1,0x21021040,0x20a20820,0x41a60800,0x210339c6,0x000018a2,0x00000840,
-0x59616a20,0x61e340c0,0x72628b07,0x6a438305,0x6a224940,0x51a05180,0x83264980,0x728451c1,0x72646222,0x59a07ac3,0x6a2161e1,0x9bea7242,0x83086a46,0x18002060,0x20004122,0x8b6d59c4,0x10010800,0x18201820,0x9c0749a0,0xb4acac6d,0x82e57b03,0x83047a84,0x728282e4,0x10201820,0x7aa382e5,0x282059c0,0x18401000,0x93a86260,0x83675a21,0x6a627b04,0x7ae46201,0x7ae472a2,
-0x7ac37281,0x6aa27ac2,0x08004141,0x00001061,0x00000000,0x08000020,0x10001820,0x41431000,0x41646288,0x51e42060,0x080049e6,0x49822080,0x61c16202,0x41236224,0x18205205,0x000041a2,0x00000000,0x39012080,0x51e393a9,0x8c2dbd51,0x28e20000,0x838b5a88,0x1020838b,0x62448347,0x7ac57a84,0x180069c2,0x10001800,0x8baa4162,0x08008329,0x28e30800,0x00000000,0x00001860,
-0x00000800,0x62a73942,0x628651e5,0x49836286,0x5aca49c5,0x28c10000,0x49a46288,0x08203101,0x00000000,0x08000800,0x28a01860,0x100020c0,0x5a241820,0x10001000,0x18206265,0x49605182,0x30a05a02,0x49614961,0x49814140,0x5a046a84,0x18003900,0x20401800,0x49c14141,0x49a051e2,0x51c34962,0x41623941,0x51e549c5,0x39215a47,0x5a463942,0x28e020a0,0x418049a2,0x41413920,
-0x30e05a46,0x08003101,0x72c81820,0x6a876286,0x62455a03,0x62453900,0xff3bb531,0xf697f698,0xf6d9e657,0xd617d5f6,0x734cff5c,0xef1bff9d,0x3186de79,0x00000000,0x41a60000,0x00000000,0x10610800,0x00000820,0x7bae0800,0x00000000,0x00000020,0x41e61081,0x29440000,0x00200020,0x00200000,0x83ee10a2,0x29232923,0x8c0f3164,0x52481861,0xa4f3a513,0x83cf9cb2,0x7bce6b2c,
-0x7a618283,0x728159c0,0x59c17261,0x7ac55180,0x7a8382e6,0x82e561c0,0x6a8259a0,0x516051a0,0x83047a83,0x516061a1,0x72018282,0x61c17202,0x518059c0,0x41604980,0x498051a1,0x20044140,0x20401800,0x6a826240,0x72017221,0x10002880,0x20001800,0x82e66223,0x28e05a41,0xc56e5a24,0x82a39346,0x72a27261,0xac498ba2,0x1000b50b,0x38e21800,0x18002860,0x28401801,0xa3ea2000,
-0x6a816aa0,0x7b037ae2,0x59e13960,0x498061e1,0x41604140,0x628451e0,0x310120a0,0x00001020,0x00000000,0x6ac61860,0x51a330a0,0x72644942,0x622361a2,0x6aa67264,0x18001800,0x63495225,0x08202924,0x29011000,0x00000000,0x10200000,0x00000800,0x00010000,0x08420001,0x4941a40c,0x834a4162,0x8b47bd0e,0xa44bcdb0,0x72e6ac6d,0x9c2b8b8b,0xacd0a42d,0x51e328c0,0x51a4a450,
-0x51c02840,0x102062aa,0x30e00800,0x00001000,0x18400800,0x080028a0,0x18601820,0x61e249e3,0x51c282e6,0x3941838a,0x39646ac7,0x00000800,0x08200021,0x18401080,0x10401000,0x41613901,0x51c32020,0x41404961,0x49826a64,0x1840938c,0x6ac76ac7,0x6ac89c4e,0x28a04162,0x496349a2,0x51e46a86,0x390051c3,0x49c351c4,0x49833120,0x39214982,0x62665a25,0x6a656a65,0x72c872c7,
-0x49824142,0x39202860,0x49833920,0xf71b0000,0x418228e0,0x41823100,0xad333921,0x7b8ead33,0x0000ff9e,0x18a24a28,0x00200000,0x080010a2,0x28a00000,0x394328e1,0x10202903,0x00000800,0x00000000,0x08000020,0x10402904,0x310320c3,0x28c141a5,0x392449a6,0x39243103,0x41843964,0x31233964,0x84103964,0x0000c618,0x00200000,0x00000020,0x00000820,0x00000000,0x08000000,
-0x514069e0,0x722161e0,0x59805980,0x724261a0,0x7a6382c4,0x514059a0,0x6a636a21,0x49406a44,0x82e561e1,0x7aa37a83,0x8ae47a63,0x6a037a62,0x180038c0,0x41404981,0x61c25160,0x51c06a44,0x51a059e0,0x6a404100,0x62406241,0x82e482c3,0x49409b88,0x39000800,0x5a2230a0,0x62437ae5,0x832651a1,0x180030c0,0xd5b230a0,0x73038366,0x62828b89,0x7b0572a1,0x6a6351a1,0x72857285,
-0xb48e38e0,0x180040e0,0x18001800,0x10000800,0x38e01800,0x52024141,0x390272c7,0x30a04140,0x392228a0,0x38e15a04,0x204030c0,0x10001000,0x00000800,0x18401000,0x39202060,0x6b4841c3,0x00000000,0x08001060,0x414230e0,0x41e45a26,0x62ea4a45,0x5ac94a07,0x41858bee,0x10001820,0x394272a6,0x62849c6e,0x51e4a46a,0x28812002,0x182028a0,0x5a060000,0x08001000,0x18001800,
-0x20600000,0x62c95ac5,0x6b0762c8,0x00001880,0x18003102,0x08003922,0x6a436aa7,0x6a2259e2,0x39206222,0x20203141,0x41634183,0x41a428e1,0x18a25246,0x8bab1881,0x7b6b6267,0x00000000,0x08000800,0x08000800,0x00000000,0x08200000,0x00000000,0x08200820,0x62673984,0x18401840,0x394049a1,0x5a0451a2,0x49c351a3,0x28602060,0x28a051c4,0x72e75a04,0x7ae97ae8,0x30e07ae8,
-0x39214182,0x5a4630e0,0x498449a4,0x30e030e1,0x49c54140,0x41e53900,0x08400800,0x00200000,0x00000000,0x08200000,0x10200860,0x08200840,0x20a11881,0x08000800,0x39640000,0x41e741e7,0x082020e3,0x39850000,0x314420a2,0x41a541a5,0x418441a5,0x41844184,0x41843964,0x41843123,0x29243985,0xffdfde99,0x39633123,0x314328e1,0x188028e1,0x188118a1,0x00000800,0x00200840,
-0x6a0082c3,0x6a215140,0x7a828ae6,0x59807243,0x61a08b04,0x598082a4,0x6a2259a0,0x6a226a61,0x59806201,0x51806a23,0x72648305,0x40c07a62,0x51a06a43,0x59c14920,0x69e06a01,0x59c161e0,0x38e06223,0x59e04940,0x180059e0,0x30e02060,0x72c52060,0x496182e7,0x622330a0,0x62236223,0x59c06241,0x59e06a41,0x62435a21,0x51c151a3,0x6a869c0c,0x626340e0,0x28601800,0x51c34141,
-0xac285183,0x83059bc5,0x08007aea,0x51e051a5,0x392051c1,0x51805a03,0x204038e0,0x49a14980,0x18005a04,0x38e01800,0x30e00800,0x20602880,0x938951e3,0x5a014140,0x624472a5,0x08003900,0x6ac830c1,0x10206245,0x08000000,0x08001040,0x52270800,0x10001000,0x83275a04,0x28e23122,0x51e54a07,0x08006b09,0x08001000,0x6224942b,0x51c351c2,0x62446aa6,0x49a16264,0x31006aa7,
-0x5a4351e3,0x7b4b3121,0x28a18bcb,0x182049c4,0x10000800,0x10004182,0x08001020,0x20401000,0x20805a02,0x61e23920,0x10001800,0x00000800,0x00005226,0x00000000,0x28c10800,0x28e25206,0x39640800,0x39843923,0x00000040,0x00000000,0x00000000,0x00000800,0x00000000,0x10000000,0x30c028c0,0x10000800,0x28a04181,0x51c23921,0x41624981,0x206051e3,0x41402060,0x41213900,
-0x5a053921,0x390130c0,0x206051c5,0x10202040,0x83ac49c3,0x000151e5,0x18810000,0x00001881,0x39633122,0x20c13942,0x41a53944,0x00000000,0x31653144,0x08205aaa,0x00000000,0x0000e6da,0x52485249,0x39842924,0x418441c5,0x41a34184,0x41a441c4,0x41c44183,0x39834183,0x39644184,0x00001081,0x39630820,0x39423943,0x41a441a3,0x39423101,0x31222922,0x28a028a0,0x08003142,
-0x72208ae4,0x6a2169e0,0x6a0161e0,0x72228ae4,0x49404900,0x51807aa3,0x6a625180,0x49606201,0x59e07283,0x728240e0,0x82c48b05,0x6a2282e5,0x72635180,0x8ac459a0,0x598069e0,0x61c09306,0x62006a21,0x72a46200,0x62006a41,0x8b677ae3,0x7b048302,0x18002880,0x28002000,0x41202000,0x59c25160,0x41406222,0x72c76263,0x5a0372e6,0x6a848b6a,0x49a06a84,0x6a637ae6,0x6ac68348,
-0x412072a6,0x20404960,0x49614961,0x6a626a84,0x6a4251a0,0x72855180,0x496082e5,0x49a151a1,0x288030e0,0x51a259c4,0x30c151e3,0x5a0430a2,0x6a4338e0,0x59c27ac5,0x51c26243,0x498138e1,0x5a042880,0x41426285,0x51e34140,0x520349a2,0x6ae74160,0x520628a0,0x182049a5,0x39421000,0x5a251000,0x08000000,0x30e12020,0x49c33920,0x62a63103,0x49840800,0x08200800,0x49c50000,
-0x08006288,0x10000800,0x6aa61000,0x628672e6,0x62662080,0x6ae849a2,0xacf17329,0x28a02060,0x10007307,0x6aa6836a,0xa48e2040,0x838cacaf,0x736c0000,0x5a873983,0x08000000,0x4a062902,0x00001880,0x39204185,0x30c130c1,0x520530e0,0x39410800,0x51e449a3,0x49e44182,0x41850800,0x20813942,0x41820800,0x31211860,0x39204982,0x520449a1,0x49405a04,0x41404140,0x392030a0,
-0x30c03080,0x5a4649a4,0x39221000,0x41824142,0x29003121,0x000028c0,0x39631000,0x5a2630e0,0x418451e6,0x39633942,0x08203102,0x00000000,0x08000000,0x31642903,0x208141a6,0x00001060,0x00000040,0x49c53144,0x41844184,0x41834183,0x41834183,0x41844184,0x49c54184,0x18403943,0x00001040,0x28c20800,0x41833963,0x49a43962,0x41833943,0x396341a4,0x39423121,0x20e12900,
-0x8ac361a0,0x61c08282,0x69e182c3,0x82a57a84,0x59c148e0,0x51807a84,0x7ae44920,0x8b4572a3,0x59c06a62,0x6a426220,0x72445982,0x61e161e1,0x49005160,0x7a416a42,0x82a48283,0x7a837a62,0x59a059a0,0x6a425180,0x7aa27ac3,0x62406200,0x7aa27ae4,0x72837ae5,0x6a436201,0x6a437ac5,0x62416243,0x41006204,0x49a57b69,0x51c36aa5,0x10002040,0x20200000,0x38c03900,0x10002000,
-0x18002020,0x6aa551a0,0x6a836a82,0x83086222,0x82e351a0,0x62016a42,0x7ac48b47,0x5a4159e1,0x49804140,0x59a06200,0x61e28b27,0x59c15160,0x59c040e0,0x6a4259c0,0x5a4459c2,0x39203921,0x39225a26,0x10005a25,0x08002020,0x08002860,0x51c51000,0x28a01800,0x626651e4,0x524462c5,0x59e24980,0x20607b48,0x41835204,0x00000800,0x10000800,0x28a020a2,0x5a8828e1,0xa4f39cb1,
-0x39815a65,0x83ca39c4,0x626828c0,0x00001000,0x5a245204,0x72c76246,0x83492020,0x30e01820,0x18405267,0x6aa72060,0x10001000,0x18205225,0x080028e1,0x08000800,0x41a51020,0x08203164,0x39840800,0x10003941,0x39404160,0x51c230e0,0x41614982,0x30e04161,0x20402880,0x39203900,0x000030e1,0x18800000,0x00000800,0x41631800,0x41623900,0x28e128c0,0x18600800,0x30e04962,
-0x51e34981,0x51c35a45,0x49c34141,0x51e43941,0x18802060,0x10204183,0x41a449c4,0x49e54183,0x626851e5,0x314249c6,0x41a51860,0x102028e2,0x18600800,0x41c52903,0x000041a6,0x00000000,0x10400000,0x394328e1,0x49c43983,0x49a449c4,0x41834183,0x416449a4,0x49c53922,0x41844184,0x182041a4,0x18613102,0x39420800,0x39623942,0x39413121,0x4a0541a4,0x396241c4,0x080049e5,
-0x82838ae4,0x7a628283,0x61e06a20,0x59a059c0,0x82859387,0x6a408ae5,0x72826220,0x6a416220,0x7ae37ae3,0x38a059e0,0x59817260,0x516038a0,0x69e182e4,0x82a38b05,0x828382c4,0x62007a61,0x38a082e5,0x62004900,0x72a17283,0x6a806a40,0x7ae372c1,0x51606200,0x518051a0,0x28014920,0x412059e1,0x41204940,0x49604120,0x59e34981,0x49a23900,0x51e25a04,0x49804120,0x5a016222,
-0x49805a21,0x51c06222,0x6aa551e1,0x49603900,0x7ae559c0,0x726251a0,0x6aa37282,0x49a051e0,0x6a634980,0x82e77aa4,0x51a09bc9,0x598051a0,0x722261c0,0x7ac569e1,0x30c06221,0x10004162,0x7aaa0800,0x41404983,0x51e328a0,0x49a24164,0x392151e2,0x836872c7,0x28806a87,0x49624981,0x30c05183,0x10206ac7,0x08004a04,0x28800000,0x5a2472e8,0x6a6651e4,0x496272c7,0x414428c1,
-0x728572a7,0x30e05a62,0x08001820,0x00000000,0x83694183,0x30e16266,0x49c33920,0x62671000,0x6aa57367,0x41407b49,0x18006203,0x51c51841,0x20401000,0x20802060,0x28807b09,0x000072e9,0x00000000,0x39210800,0x49622880,0x5a045a24,0x51c36246,0x39405a24,0x498251c3,0x5a055a25,0x51c459e4,0x28804983,0x49a359e4,0x30c05204,0x18202880,0x49c2a46e,0x31003940,0x39002000,
-0x51c24981,0x41403900,0x5a0451e1,0x41614983,0x6aca49c4,0x10200800,0x49c43942,0x49c45206,0x28c13943,0x39231860,0x20803102,0x49c54163,0x000028e1,0x00000000,0x00000000,0x20a11001,0x20a11000,0x39631820,0x49e549a4,0x418451e5,0x418341a4,0x00000820,0x49a520c1,0x416351c4,0x392249c4,0x18204123,0x29012080,0x39623961,0x31033943,0x39833122,0x41843963,0x39613921,
-0x61e07a82,0x59807a82,0x938738a0,0x6a227283,0x72228b46,0x6a607222,0x72828304,0x492059e0,0x6a635180,0x83056220,0x6a406a22,0x7ac46a20,0x722259c0,0x93667aa3,0x8b068ae4,0x82c46a00,0x72846a22,0x61c06a43,0x59a06201,0x51804920,0x38a04960,0x516040e0,0x38c140e1,0x28604102,0x518051c1,0x51c151a0,0x518259c1,0x414030c0,0x38c030c0,0x496138c0,0x51405160,0x59a04940,
-0x38e038e0,0x5a024961,0x30c03900,0x62014100,0x59a061e1,0x72835160,0x62627283,0x6a8251c0,0x410051a0,0x61e182e5,0x8b066a01,0x59807a84,0x7a8461e0,0x40e07a84,0x41214100,0x6a6451a2,0x59e49bcc,0x5a0238e1,0x51c08348,0x39005183,0x314130e0,0x20603120,0x41221800,0x72c372a5,0x72a751c2,0x10001000,0x7ac66a64,0x51c259e2,0x62856265,0x080028a0,0x08001040,0x49821820,
-0x28c07b49,0x5a038349,0x206028a0,0x10001000,0xa48e3920,0x28827329,0x18201000,0x62890800,0x39414162,0x51e4acd0,0x41832060,0x49846267,0x6ac73923,0x73078b8a,0x5a245a44,0x10206266,0x10003900,0x49a27b4b,0x416159e4,0x39011000,0x522341a0,0x28a03941,0x41414962,0x51c44983,0x51e449a3,0x5a246265,0x52044982,0x49a349a3,0x51c34121,0x39405203,0x39404181,0x39405222,
-0x5a233960,0x498141a1,0x30e04981,0x41416a85,0x41826245,0x28e062a7,0x41833942,0x100028c0,0x31011020,0x31020800,0x418349a4,0x394330e1,0x20803122,0x00002080,0x08001060,0x20a028c1,0x41a449e5,0x394241a4,0x18402080,0x28c03922,0x41832060,0x31821040,0x39433122,0x314328c0,0x10204a07,0x20803922,0x312328e2,0x394228c0,0x10203964,0x39633942,0x41a441a4,0x39424183,
-0x59e059e0,0x82e459a0,0x59a07aa4,0x7ac461c0,0x61e06201,0x72a282c1,0x62006220,0xa4086200,0x62206200,0x72826a40,0x62207261,0x83037ac5,0x7a836a60,0x7a8261c0,0x8b4782e4,0x518059a0,0x61e17263,0x62015160,0x51616a42,0x59c06a63,0x518051a0,0x61e24940,0x51c059a0,0x41204100,0x620259e2,0x51a04140,0x51c06222,0x41406244,0x51616a65,0x49204100,0x72435140,0x726359a0,
-0x51c14980,0x59c138a0,0x49a14160,0x7ac459e2,0x6a415180,0x7ac45180,0x49a059e0,0x59e072c3,0x72a37ac3,0x49207243,0x8ae47a62,0x6a418ac4,0x512082e3,0x72639346,0x620451a0,0x38c06a24,0x62414140,0x7ac53060,0x496051a1,0x392040e0,0x59c04980,0x49a04940,0x41803920,0x72c55a21,0x62414140,0x51c15a20,0x52044142,0x5a045a43,0x520359c5,0x39003941,0x10003900,0x59e12880,
-0x72c56224,0x7ac64980,0x416051c2,0x51e22000,0x62216242,0x08007284,0x836a3920,0x62a40000,0x08005a05,0x31221020,0x93ec7b2a,0x1840940d,0x51c549a2,0x8bcc7b2b,0x49a49c0d,0x30e030e0,0x394151e4,0x49e03120,0x39004160,0x49e16243,0x522249c2,0x20804182,0x30e030c0,0x414251c3,0x6aa74962,0x30e06a65,0x52045a03,0x49a31820,0x41614160,0x31204180,0x49c14180,0x73283960,
-0x41813960,0x416049e2,0x5a0351c3,0x51a14160,0x30e06a65,0x498430e0,0x208028a0,0x18401820,0x31021020,0x39224184,0x28a02080,0x314230e1,0x30e03122,0x28c230e1,0x290220c2,0x396328c2,0x41833942,0x20800800,0x39424183,0x28c028c0,0x28c04163,0x30e12080,0x10000800,0x20c11040,0x00000842,0x312228c0,0x49c63123,0x418328e1,0x20a13102,0x31224183,0x39833983,0x41634183,
-0x59a07aa2,0x72a28b45,0x7ae37ae2,0x726282e3,0x93666a20,0x59c06200,0x7ae372a2,0x7aa36a61,0x83038324,0x62008304,0x6a618324,0x7aa26200,0x62007ac3,0x61e06200,0x7aa37242,0x6a225980,0x6a426a01,0x61e06a21,0x7aa56a23,0x49204940,0x61e059a0,0x49006a41,0x30a04121,0x51a04960,0x59e24120,0x49a14961,0x6a425a02,0x49407265,0x59c15161,0x41204940,0x61c15160,0x49606a43,
-0x49213080,0x51a04960,0x5a014120,0x51a051a0,0x72a36a62,0x51a05a21,0x6aa16240,0x62623920,0x6a826220,0x6a6259e0,0x93476201,0x8b069388,0x6a018ac5,0x72a38304,0x8b457ae4,0x72847ac4,0x49604960,0x59e14980,0x6a626241,0x59c251c1,0x282030a0,0x728438e0,0x51805180,0x622251c0,0x59e172a4,0x59c19367,0x41604140,0x18203900,0x51c128a0,0x38e028a0,0x30a030e0,0x41805a02,
-0x62645201,0x626572e7,0x72c66aa3,0x390030c0,0x59c14980,0x51a15180,0x6a644960,0x6aa66267,0x628751e3,0x5a251000,0x10003941,0x18201000,0x52255a45,0x6ac85225,0x39403101,0x10001840,0x49a13122,0x49c25203,0x49a24182,0x49a162a4,0x52025202,0x49a33100,0x39203941,0x31004162,0x5a234161,0x51e35203,0x30e03100,0x418149a1,0x49e04160,0x62a349e0,0x39813960,0x18a03141,
-0x314018a0,0x49c03960,0x72e67305,0x6a8549a2,0x51c25a04,0x28c04982,0x5a451000,0x31011860,0x39424162,0x41a33942,0x31014183,0x392241a3,0x310130e1,0x30e13101,0x39433942,0x62a84184,0x396318a0,0x39214183,0x41635205,0x20a04183,0x20c020a0,0x28c03942,0x20801000,0x20c01880,0x18800000,0x29202901,0x49e43121,0x28e020c0,0x394220a0,0x31023943,0x39223963,0x18403942,
-0x6a418b46,0x7ac4a409,0xa40a7ae4,0x7aa18b46,0x59a06a42,0x6a6272a2,0x8b457b03,0x83257282,0x72a18324,0x72c26a40,0x7ae37ae3,0x82e36a41,0x7aa27261,0x61e07ac3,0x7a837261,0x6a016a00,0x51806201,0x59c061e0,0x61e15140,0x6a427a86,0x494040e0,0x6a0161e0,0x414038c0,0x51a26a44,0x59c24961,0x390038e0,0x72a33900,0x6a636202,0x59c04960,0x49807ac4,0x6a216a42,0x49806201,
-0x61e06201,0x624259e0,0x38e05a01,0x41004120,0x6a426201,0x49a06a82,0x628162a2,0x7b256a81,0x72e359e0,0x83257ae3,0x51c06240,0x5a006a83,0x83057262,0x51a06241,0x83036200,0x7aa372a2,0x6a846a62,0x38e051a1,0x6a654120,0x6a223080,0x72838b26,0x59e15161,0x496051a0,0x62216a62,0x6a416a41,0x72c58305,0x39005a24,0x6a854981,0x31004141,0x49a12880,0x51e059e1,0x39204140,
-0x51c23900,0x622572a3,0x20401000,0x49803900,0x51c051a1,0x62016a62,0x59a059a0,0x39407b28,0x18205a24,0x28a01800,0x08004160,0x10000000,0x49e26265,0x00003941,0xb50fa48f,0x49c2acaf,0x41601840,0x41826aa5,0x39202040,0x39403120,0x206051e2,0x416049c2,0x392041a0,0x20801000,0x39206225,0x30e03940,0x310030e0,0x418149a2,0x5a625203,0x398041a0,0x41a13140,0x31802920,
-0x396039c0,0x4a003940,0x49a249a0,0x59e349a2,0x51c25a04,0x28a04982,0x00004a04,0x39823963,0x39215205,0x41623121,0x39214183,0x41633942,0x39223963,0x39424163,0x39223922,0x312230e2,0x20a06b2a,0x39423101,0x416251e4,0x290149a3,0x31223122,0x31023964,0x208128c2,0x000020c1,0x10810000,0x10600820,0x00000000,0x10200000,0x20e11040,0x310228c1,0x31013921,0x39213942,
-0x59c07ae3,0x6a816a81,0x93665a20,0x82e47aa2,0x83027aa4,0x72608304,0x6a616220,0x7281a3e7,0x520051a0,0x59e05a00,0x93a75a00,0x7ae37ae2,0x7ac26a41,0x7aa38325,0x6a407241,0x494051a0,0x72826202,0x59816a21,0x386059a1,0x6a016a22,0x6a0159a0,0x61c059c0,0x498030a0,0x62024140,0x518059c2,0x49612880,0x51a151c2,0x6a6251c0,0x7ac459e1,0x6a435980,0x82e651a0,0x934659e0,
-0x7a827241,0x59a082e3,0x72435160,0x61e07243,0x72427aa3,0x5a405a01,0x6a815a20,0x59e04960,0x5a416261,0x5a206261,0x51c05a00,0x59e06261,0x49606a41,0x6aa372a3,0x52006241,0x51e06261,0x41204981,0x38e051a1,0x49414100,0x93264941,0x8b4682a4,0x7aa382e4,0x51a051a0,0x620251c1,0x59c159e1,0x5a0272a5,0x5a0451c3,0x41405a02,0x392030a0,0x38e01000,0x49814160,0x30c059e2,
-0x390038e0,0x61e16200,0x72a47264,0x49804960,0x59e051a1,0x8b067262,0x49404940,0x496038e0,0x39006264,0x496138e0,0x28a05a03,0x49c151e2,0x624549a1,0x10403102,0x18200800,0x49822060,0x51c04981,0x39415a61,0x310028a0,0x49a14180,0x31003940,0x28c06ae5,0x41613940,0x520449c2,0x41811000,0x41c13120,0x312028e0,0x39604180,0x31603960,0x7b8841c1,0x314041c1,0x39604a01,
-0x41c041c0,0x41c03140,0x49a049c0,0x418149c2,0x394151e4,0x206028c0,0x10003942,0x28c00800,0x28a03920,0x498228c0,0x49a43920,0x39214183,0x392230e0,0x41a44183,0x41834183,0x10000800,0x08200800,0x39213982,0x49c541a3,0x31021020,0x08001020,0x18803123,0x00003122,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x10600000,0x31202901,0x28e03942,0x31403962,
-0x59e07281,0x62416240,0x7aa251c0,0x6a608323,0x7ae26a40,0x59a04920,0x62005160,0x59a07aa4,0x6aa15180,0x83246a81,0x7aa26a20,0x62008b66,0x62007281,0x51c06a62,0x83036240,0x62206200,0x62018304,0x72826a21,0x62006a42,0x7aa259c0,0x72437aa2,0x61e24920,0x494038e0,0x49606223,0x518038e0,0x40e05181,0x5a024960,0x59a04100,0x59c059c0,0x61e161c1,0x7aa551a0,0x728359c0,
-0x82c482a4,0x7aa361c0,0x516061e0,0x8ae559a0,0x8b457242,0x62008304,0x9baa7ac3,0x9bc77aa3,0x62a15220,0x522062c2,0x62615a00,0x62207b24,0x83466a41,0x51e051a0,0x5a0172c3,0x5a2251c0,0x59e24160,0x41214120,0x82c59347,0x8ae48306,0x9b677221,0x930482e3,0x41009346,0x49804120,0x59e17284,0x51e15180,0x30e04161,0x62234140,0x38e03900,0x59c16a43,0x494059c2,0x412151a2,
-0x41003060,0x51605180,0x59c059c1,0x49807ac4,0x72a351a0,0x72437262,0x39006a42,0x6a646244,0x620338e0,0x7b066aa3,0x51c26a64,0x206051c2,0x39414160,0x10000800,0x41204982,0x7b273900,0x51e051e0,0x30e049c0,0x312049c1,0x39203100,0x41613960,0x41613960,0x49c12060,0x39202040,0x41604162,0x00000800,0x20a00800,0x31002080,0x29015225,0x73271860,0x316062a4,0x39804180,
-0x41c13140,0x41a04180,0x5a2349c1,0x394051e3,0x520549a4,0x51c551c5,0x418349c4,0x626651c4,0x41624142,0x31004161,0x31001820,0x39423962,0x206028c0,0x20600800,0x49632880,0x41624162,0x20a03942,0x396241a2,0x41634182,0x628828a0,0x18611860,0x18400000,0x31430820,0x31633963,0x00002121,0x10410000,0x00000000,0x00000000,0x10600800,0x41c33142,0x49e441c3,0x39414a04,
-0x40e06a42,0x82a572c3,0x49407241,0x8b44a449,0x40c069e0,0x69c08304,0x8ae27260,0x61e09326,0x82e47aa3,0x59c07ac2,0x7ac07aa3,0x59c06a60,0x728182c4,0x72e17ae2,0x6a806260,0x83037ae2,0x62007aa2,0x82e459c0,0x7aa58b27,0x82a482c5,0x61e26a01,0x6a024100,0x30806a43,0x498038c0,0x5a014980,0x39004120,0x51c04960,0x72845162,0x7a836a60,0x6a426201,0x51a059a0,0x59e159e1,
-0x51606a41,0x82c37aa2,0x61a05980,0x61c07a83,0x72a16a61,0x7ae293c5,0x59c06200,0x83228b44,0x72e27ac3,0x7b247303,0x49c06aa2,0x72c15a20,0x7ae46a60,0x51e07ac3,0x41a06a83,0x6ac651e1,0x622351c0,0x59e159c0,0x69e07242,0x51407242,0x82827aa2,0x8b0582e3,0x934682c4,0x59e15a02,0x41407ac5,0x620251a1,0x41006224,0x622351a2,0x516059e2,0x7aa56a42,0x49206a43,0x62024940,
-0x6a0259a1,0x492061e1,0x72836201,0x5a0259c0,0x72a44960,0x72c459e0,0x51a16a83,0x59e251c1,0x51e16a83,0x52003900,0x51e16a85,0x498049a0,0x30e05201,0x41601000,0x52015202,0x49a06222,0x6aa172c3,0x49e072e3,0x51c15a41,0x49c149c0,0x396028a0,0x7b273960,0x30e05a04,0x49a151c2,0x30e03100,0x31204182,0x10403961,0x29002900,0x39411860,0x39413941,0x39803980,0x31605263,
-0x396041c0,0x41a141c0,0x41814a01,0x392149a2,0x498349a3,0x31215205,0x10401860,0x00001000,0x394228a0,0x49831820,0x392230c0,0x41a228a0,0x39204182,0x28a05a24,0x416249c3,0x41414182,0x394149c3,0x49c23941,0x41833961,0x00003943,0x08400020,0x18c10820,0x18a02922,0x31423943,0x100020a0,0x39831040,0x20e12922,0x31213143,0x31011840,0x20803942,0x396141a2,0x39623940,
-0x7ae17b02,0xb48b6aa1,0x72a18ae4,0x82e359e0,0xb48a82e3,0xff5bac0b,0x72426a41,0x51806200,0x8b458b45,0x8b456200,0x726261e1,0x7ac26a61,0x7ac26200,0x59e059c0,0x72818302,0x83038b64,0x6a218b44,0x72828304,0x72a27281,0x724282c4,0x48c07220,0x72635160,0x59a05180,0x40e05160,0x51604100,0x59e25181,0x62034961,0x38c051a0,0x59c04920,0x7ac47263,0x62226a42,0x59c061e1,
-0x40c05180,0x7a826a20,0x8b248b04,0x8b0382c3,0x72a159c0,0xa4076220,0x83059386,0x8b28a3ea,0x6a827ac4,0x59e059e0,0x72a27ae3,0x832459e0,0x62014960,0x59e08324,0x7ae451c0,0x51a06a62,0x59a038c0,0x61e061c0,0x8ae36a00,0x8b248ae3,0x7262a3c9,0x7ae47b03,0x6a418324,0x41407ac4,0x622272a4,0x49404120,0x6a6259e0,0x6a635a00,0x59a06222,0x49606a42,0x6a626201,0x5a0172c4,
-0x59c07263,0x518082c4,0x51a07aa4,0x7ae559c0,0x49607ae5,0x728372a4,0x49406a83,0x51a04160,0x51c151c0,0x206030e0,0x49a04180,0x41614180,0x5a223900,0x59e04160,0x51e05a00,0x5a208344,0x51c06aa0,0x5a403960,0x62615a60,0x5a233920,0x41603920,0x18402080,0x206028c0,0x5a234981,0x30e04181,0x394120a0,0x28e030e0,0x20801020,0x31002920,0x52045a25,0x10001840,0x4a0120a0,
-0x39603940,0x20a03960,0x49c149c1,0x49a249a2,0x41415a24,0x08004182,0x41843982,0x396141c3,0x10006ac8,0x08006287,0x312020a0,0x41a23981,0x49a241a2,0x49a34141,0x41814161,0x51c34161,0x31214182,0x20601860,0x312328c1,0x41633964,0x39224143,0x49e63984,0x29000820,0x20a04185,0x20a02080,0x39833122,0x29213163,0x31222900,0x080028e1,0x41825a46,0x49e349e3,0x28e05203,
-0x7ae36a40,0x72826240,0x83428b05,0x83037ae4,0x6a208ae3,0x616340e0,0x72c261a0,0x59c06220,0x620061e0,0x59c061e0,0x7ac27aa1,0x7ac17aa2,0x622059e0,0x7ac172c0,0x93c69364,0x62007280,0x61e06a20,0x6a207261,0x72837283,0x72416a21,0x7a4082c2,0x59c07221,0x72447262,0x72616200,0x72827262,0x30a04940,0x6a454101,0x494140e1,0x516059c0,0x59c05180,0x51a07ac4,0x62225160,
-0x6a415980,0x82e38b04,0x7a8182e3,0x8b448b03,0x72a18b64,0x6a2059c0,0x308059c0,0x72c26222,0x41407263,0x9be759c0,0x6a209bc7,0x834559c0,0x7ae451c0,0x8b436a41,0x93868302,0x7b026240,0x82c36a40,0x72417a42,0x82e37a81,0x8b269344,0x83047aa2,0x7b0351c0,0x5a2072e3,0x41405a00,0x62214140,0x6a835a01,0x8b476a63,0x62218326,0x62226a62,0x518272a3,0x49405161,0x412051c0,
-0x61e07262,0x6a2282e5,0x51809ba8,0x49405180,0x5a025180,0x72c46a63,0x49604120,0x624351a0,0x72c572e4,0x390128a0,0x418049c0,0x5a224140,0x5a0049a0,0x7ae25a20,0x6aa06a80,0x624172c1,0x62617282,0x73027b23,0x20206ac1,0x41803900,0x49a13940,0x39413100,0x414149a2,0x39004161,0x41624181,0x28e03100,0x41a31000,0x314020c0,0x49c320c0,0x49c33962,0x41c049e2,0x41a12900,
-0x5a8041c0,0x52215241,0x49c15220,0x51e35a44,0x5a0449c2,0x5a455204,0x52263120,0x18407309,0x20802080,0x00004163,0x102028e0,0x396128e1,0x41813961,0x418249c3,0x49a24181,0x416249c3,0x28c03941,0x28e04182,0x31403961,0x39843121,0x39643984,0x39433943,0x10400800,0x100028a2,0x39823141,0x31423962,0x080018a0,0x20a00800,0x08000800,0x292028e1,0x49e35203,0x312041a1,
-0x728151c0,0x830459e0,0x82e47281,0x6a416200,0x8ae482e4,0x7a846a01,0x6200a3a8,0x82e47262,0x72626a21,0x7a8559a0,0x8b037260,0x8b028b06,0x7aa27aa1,0x72208b04,0x93447240,0x7a817240,0x93658b03,0x51808b44,0x62006200,0x8b048ae5,0x7aa382a4,0x61c082c4,0x7a8382a3,0x82c48ae4,0x69e07201,0x72418282,0x6a4161e1,0x61e17ac5,0x59a061c1,0x6a427242,0x6a616201,0x7ae372a2,
-0x93857aa2,0x7ae28303,0x9ba58b04,0x8b437aa0,0x728072a0,0x93657aa1,0x6a619ba7,0x6a814120,0x72a47ae4,0x30a038c0,0x496059c0,0x72a451a0,0x7ae47282,0x8b6672a3,0x7ae26220,0x83436a60,0x82e36a20,0x8ae38b03,0x724182e2,0x6200a3a7,0x620059c0,0x6a828b87,0x72e35a20,0x6a616200,0x62218b45,0x62225a00,0x62214920,0x72837ac3,0x6a426a63,0x6a427aa4,0x51a072a4,0x494059c1,
-0x7aa44960,0x83256a42,0x51a07ac4,0x49a05180,0x51c16222,0x51c159e2,0x5a4149a0,0x41606262,0x72835180,0x51806a83,0x5a0059e0,0x72a272e3,0x6a808324,0x7b028323,0x72c17ae1,0x72c27b02,0x6aa16280,0x62826282,0x39206aa3,0x28c030e0,0x5a2541a2,0x30e028a0,0x28c05a44,0x5a234982,0x31003100,0x31203100,0x39613941,0x39413100,0x28e028e0,0x39204182,0x31003961,0x41c13140,
-0x4a003960,0x41a05aa1,0x41605202,0x5a245203,0x310051e3,0x392049a2,0x20803100,0x41832080,0x41c320a0,0x10a13943,0x00000000,0x08000000,0x39611840,0x418249c2,0x51e351c3,0x31003961,0x49c43941,0x39413922,0x49c53121,0x30e04183,0x31212080,0x28c21000,0x30e13922,0x28c11820,0x10200820,0x312128c0,0x18601860,0x10603944,0x20c13143,0x398228e0,0x5a455a25,0x41a241a2,
-0x830559e0,0x72816a60,0x83056a20,0x28007262,0x7a626200,0x51406a00,0x7a622800,0x8b267241,0x59c040e0,0x9b889bc7,0x724182a2,0x8b03a3c8,0x5940a3c9,0x59409b66,0x93649304,0x6a018b24,0x82e29344,0x6a6182e2,0x72817aa1,0x8b0469e1,0x72618ae5,0x724148e0,0x7a838b04,0x8b0482a3,0x93469b87,0x82c39b67,0x8ae48b05,0x82e57aa2,0x8b257ac2,0x72827282,0x8b647ae3,0x83036a81,
-0x83238b43,0x72a182e2,0x8b039b65,0x82e28b02,0xb4a76200,0x39008303,0x30c03900,0x20209c48,0x20404960,0x28603080,0x39203920,0x38a04160,0x49214940,0x41203080,0x49407ae5,0x59c18305,0x82e3a408,0x82c37aa1,0x93668b44,0x93679387,0x83057ae4,0x5a0049a0,0x5a207b04,0x82e38b24,0x8b658303,0x7ae56221,0x83254960,0x61e16a62,0x7aa38326,0x6a006a21,0x61e07262,0x72427a83,
-0x6a627ae4,0x6a816a40,0x834659e0,0x51e17ae5,0x49a06242,0x49a030e0,0x628149a0,0x6a8251c0,0x62206241,0x59c06a62,0x728072a1,0x59e06200,0x72c17ac2,0x6a807ae2,0x72a07ae1,0x7ae36220,0x6aa25a40,0x31006aa4,0x52015a22,0x39423900,0x49c130e0,0x31205a43,0x418128c0,0x51e351e4,0x31203100,0x31003961,0x39603120,0x28e03940,0x31003100,0x39413940,0x31204181,0x39803980,
-0x4a204a20,0x41a041c0,0x51a151e1,0x5a0459e2,0x49a26245,0x49c251e3,0x6ae86286,0x732a41a4,0x20e22922,0x28e20000,0x10604184,0x41813162,0x39624160,0x394120a0,0x520449c3,0x41815205,0x394241a2,0x41834163,0x41a33942,0x41a33962,0x41833921,0x28e028e0,0x28c020a0,0x20802080,0x39623162,0x20a030e0,0x28c02080,0x18601840,0x08001040,0x20c00800,0x30e04182,0x418149c2,
-0x7aa27282,0x6a207282,0x59a08304,0x59a082e3,0x82a27aa3,0x6a008ae4,0x3040bc4a,0x72217a62,0x82a561e0,0x6a407261,0x61c061c0,0x9b666a21,0x8ae47224,0x82828ae3,0x59808282,0x51807ac2,0x7ae0de0c,0x93436a20,0x7aa27ac1,0x8b2482e3,0x82e382c2,0x7aa261e0,0x6a407281,0x7aa27aa2,0x8b0482c3,0x7a826a00,0x7ae38303,0x59e06a81,0x82e37261,0x72818b44,0x7b026a60,0x7b237b23,
-0x83436a80,0x72a16a80,0x72829346,0x496061e2,0x59a02840,0x30a05160,0x498330a0,0x6a605a20,0x494138e0,0x38e061e1,0x41404140,0x412038e0,0x62026a63,0x62026202,0x51825180,0x38c05a02,0x40e038e0,0x6a2159c0,0x6a425140,0x6a215160,0x62204940,0x62216221,0x51a04960,0x72627ac3,0x9bc77b03,0x62616aa2,0x412061e2,0x62016a21,0x51a072a2,0x93658b65,0xa3e88b04,0x8b248b25,
-0x59e18304,0x72636200,0x7ac38324,0x5a426a62,0x390049a0,0x51c051a0,0x62406241,0x6a418b45,0x7aa27ac2,0x8b247261,0x830382e3,0x6a616a61,0x59e072a2,0x49a072a2,0x5a216aa2,0x41806283,0x41606aa3,0x39403921,0x62645201,0x418051c1,0x41a04180,0x49a15202,0x30e028a0,0x41603100,0x49c31840,0x312049c2,0x5a634a02,0x39803120,0x5a4341a0,0x41a13120,0x49e13140,0x41c05242,
-0x49e05240,0x51e249e0,0x41404160,0x622551e3,0x41615a03,0x30c05a24,0x29015a25,0x18405a68,0x18800800,0x28c020c0,0x39423101,0x39213121,0x39414161,0x30e04162,0x41a23942,0x49e449e4,0x394128e0,0x39413962,0x41823941,0x39613921,0x39224163,0x41833962,0x20801000,0x28e10800,0x20803122,0x080020a0,0x39624a04,0x28e21860,0x31212081,0x41a34183,0x18601020,0x41c41860,
-0x83047aa2,0x8b458b45,0x7ae28b05,0x82c36a00,0x82a261a0,0xabe982a3,0x61c19325,0x93667242,0x7aa17a63,0x72818304,0x8b037261,0x8b238ae2,0x82a37a83,0xa3448aa2,0x6a617aa3,0x8be62880,0x94458be3,0x38e07281,0xa3e7a406,0x7aa182c1,0x6a407aa1,0x8b447ac2,0x72a27ae2,0x72a07b02,0x62006220,0x8b448323,0x7b036a60,0x83245a20,0x8b658b44,0x6a607ac2,0x83238303,0x6a808b64,
-0x72a18343,0x6a426a40,0x620059a0,0x51804900,0x6a017263,0x59a05980,0x49617aa2,0x7ac08ba3,0x72636220,0x49207242,0x620159e0,0x6a225180,0x51a07283,0x59e24960,0x30a07ac5,0x20204100,0x494030c0,0x59806202,0x7a837242,0x9b8782e5,0x7ae38b04,0x6a416201,0x6a426a62,0x49205160,0x51a059c0,0x6a4161e0,0x6a638325,0x7aa46a63,0x7ac36a61,0x7ac38304,0x830382e3,0x83047aa2,
-0x7ae47ac3,0x62206a42,0x728259c0,0x624172a3,0x8b656a82,0x7ae372a2,0x7ae46a61,0x93856220,0x93657ac2,0x62007261,0x7aa27261,0x6a406a61,0x6a616220,0x51e06a61,0x498072c3,0x626230c0,0x49c051e0,0x418128a0,0x49a149e1,0x49c249c1,0x28c04180,0x62634160,0x31003940,0x39203100,0x416049a1,0x20804181,0x6b0541c1,0x39804180,0x31403100,0x5a834180,0x4a205240,0x49e041e0,
-0x62a262c1,0x51e24180,0x51e349a1,0x5a2451c3,0x41416245,0x49825a24,0x10403100,0x49c50000,0x310128c2,0x28c028c0,0x418249c3,0x49c449e3,0x49a24182,0x31003100,0x28e03942,0x31211880,0x49c33100,0x310049c4,0x41623962,0x41824182,0x39421860,0x418328c0,0x41822900,0x39612900,0x49e23960,0x39813981,0x31413160,0x186028c0,0x39620800,0x29003121,0x49c55a86,0x20c03142,
-0x59806a20,0x8b257281,0x6a009325,0x82c3a387,0x69e069e0,0x6180abe8,0x69e08ae4,0x518082c3,0x7ac37262,0x7ae37ac2,0x7aa182e4,0x82c28b25,0x7a409b24,0x6a207a41,0x83647ac1,0x62c05240,0x7b817321,0x3900a446,0x51a0cd6c,0xac2ab48b,0x6a407ae0,0x72c16a60,0x7ae16a60,0x72c08342,0x83427b01,0x7ae17ae1,0x7b027b02,0x72c17b03,0x8b437aa0,0x72e28303,0x72837b23,0x6a405a00,
-0x69e07282,0x69e082a3,0x72216a00,0x72419304,0x7a8261c0,0x61a07a62,0x72a17222,0x51a072a1,0x61e07261,0xee3182c4,0x61e08b46,0x49405980,0xd56f59c0,0x8b6640e0,0x41006221,0x492059e1,0x59a038c0,0x59605980,0x9b8661a0,0x514048e0,0x69e17a62,0x622259c2,0x8ac67282,0x6a007241,0x82a382a3,0x51407aa2,0x72827284,0x492040c0,0x494040e0,0x59e04940,0x72a26220,0x6a6240e0,
-0x498051a0,0x6a626200,0x7aa27ae3,0x7ae27281,0x7ac27aa1,0x6aa159e0,0x62406a81,0x622038e0,0x7aa261e0,0x59e07b03,0x7ae37ae4,0x51a06a60,0x59a059c0,0x416059e0,0x52022040,0x41a05a23,0x39404a00,0x39204141,0x49c03920,0x41606aa3,0x390028c0,0x5a235a02,0x31004161,0x39406ac7,0x310030e0,0x49c22060,0x49c13940,0x28e04180,0x526149e0,0x52205240,0x52614a20,0x5a8139a0,
-0x5a405240,0x39005220,0x51e351e3,0x5a4551c2,0x62645a24,0x29003940,0x49c451e4,0x182030e2,0x39423942,0x39403121,0x39404181,0x41a15203,0x49a13920,0x394049e2,0x51c33940,0x41803120,0x396049c2,0x398149c2,0x39603140,0x312041c2,0x290028e0,0x292020c0,0x39c03160,0x52834a62,0x41c141e0,0x41a13981,0x41834a04,0x080049e5,0x20a01860,0x31410800,0x29004183,0x20c02900,
-0x93458b02,0x61a1a3a9,0x72435120,0x72207a62,0x82a482a2,0x72209326,0x93067221,0x7a8261a0,0x59805980,0x61c06a00,0x8b245980,0x82a25980,0x8ae39303,0x61c09303,0x522061c0,0x83c37341,0x5a412080,0x9c248ba4,0x6a80a444,0x7a806a20,0x7aa182e2,0x83217260,0x8b438321,0x93849ba5,0x83228342,0x7ae18b63,0x8b447280,0x93649be6,0xa3c79342,0x72e18b64,0x620059e0,0x410051a0,
-0x72206a01,0x7a618ae3,0x61c08282,0x7a629345,0x7a627a62,0x82e36a20,0x8b6561c0,0x6a4051a0,0x61e06200,0x59807222,0x72816a42,0x728340e0,0x72626a21,0x620161e1,0x59c06221,0x51807282,0x69e07262,0x6a0082c3,0x61e082e4,0x722182c4,0x61c08ae4,0x51806201,0x82a47aa2,0x8b057aa2,0x6a008b04,0x7ac361e0,0x7aa46200,0x6a019b88,0x82c45140,0x6a217262,0x7aa57284,0x6a6259a0,
-0x620140e0,0x59e072a2,0x62006a62,0x726072a1,0x728182e2,0x7b046a61,0x49606221,0x59c06221,0x82e36a61,0x82e47281,0x72825180,0x83246240,0x7aa36220,0x418051a0,0x414049c1,0x30c04161,0x10002080,0x30e02881,0x5a035a23,0x49e04160,0x39203100,0x62444160,0x204028a0,0x310030c0,0x39204182,0x418049c1,0x49c04180,0x41a06ac4,0x41c05241,0x5a614a00,0x52414a00,0x62c25a82,
-0x41a049e0,0x51c23960,0x51e35a03,0x49a24140,0x49613920,0x310149c3,0x30e03101,0x18406268,0x10003962,0x28c01000,0x39403941,0x49a15a44,0x41608368,0x5a4349c1,0x5a426283,0x6ac44a01,0x4a005a82,0x41e14a00,0x49e23140,0x52434a02,0x4a024a02,0x4a224a23,0x4a425264,0x4a423180,0x524339a0,0x41a241a1,0x28e03982,0x396128e0,0x41a25224,0x28e03982,0x28c03101,0x394149e4,
-0x5140e56f,0x50e0c48b,0x9b448ac3,0x9b458aa2,0x8ae38ac3,0x61a069e0,0x8ae361e0,0x92e29303,0xcc6d8aa1,0x930292e3,0x69e159a0,0x71e07200,0x93009b25,0x82818ac3,0x59e07261,0x20c03940,0x6ae083a6,0xa3e482c1,0xb448ac24,0xb407a364,0xa3429300,0x9b448ae3,0x8ae27a61,0x8ae1bc67,0x8b037240,0x83027240,0x72208b23,0x9b857220,0x93459b65,0x59c059c0,0x51805140,0x620159c0,
-0x8ac269c0,0x828182c0,0x722248c0,0x728261a0,0x61c059a0,0x7a827241,0x72829b66,0x40e061e0,0x51607aa2,0x7a627a84,0x72817243,0x6a217aa4,0x59807a84,0x59c04940,0x62016200,0x72414940,0x61e05980,0x82a26a00,0x8ae49345,0x7a6269e0,0x9b458ae3,0x49208304,0x82e46a01,0x6a0082a3,0x72818b85,0x8b0582c4,0x51407a83,0x7a6361c0,0x7ac382c4,0x49206200,0x49206200,0x83256200,
-0x8b256a20,0x51606a40,0x8b047aa2,0x93237aa0,0x8b459b65,0x59c051a0,0x6a618324,0x61e072a2,0x72c26240,0x93a75a20,0x49608343,0x7b036240,0x59c07282,0x6a645a01,0x49814120,0x38e030e0,0x28c04185,0x38e038e0,0x38e038e0,0x52018ba8,0x49a07b06,0x416049a0,0x49a24160,0x310028a0,0x31004141,0x31003901,0x314051e1,0x526041a0,0x52205a82,0x526062a1,0x522049e0,0x49e05200,
-0x39404180,0x52035203,0x51e349a2,0x51e35a03,0x310149a2,0x51c41000,0x498330c0,0x28a03941,0x20805a25,0x49e33100,0x41c04181,0x41a15221,0x28e05242,0x41a041a0,0x4a015a83,0x39804a00,0x5a624180,0x398049e0,0x31804a00,0x42035262,0x31412900,0x31802920,0x52632940,0x52632900,0x39a05241,0x29203960,0x31202900,0x29023981,0x41e33162,0x18603961,0x18401000,0x08000800,
-0x9b269ba7,0x69e092e4,0xa3668262,0x720082a2,0x82828282,0x8b248ac3,0x82a282e3,0x7a409303,0x7a0192e1,0x82819303,0x92c2a323,0x7a208260,0x8ae1bc29,0x7a608ac2,0x6a4082c2,0x72806200,0xb4099365,0x9b63abe5,0x82a1a3a3,0xa384a381,0x9b02aba5,0x7a619b85,0x826269c0,0x61607201,0x9b859322,0x82c182a2,0x82c27aa1,0x93438281,0x93649b84,0x7ac282e4,0x72617240,0x7aa259a0,
-0x82818aa2,0x6a027a81,0x28003000,0x82e45980,0x61a05180,0x61c09b88,0x59c04900,0x6a229366,0x59a15160,0x38a07242,0x6a416a02,0x518061e2,0x6a215980,0x6a627282,0x51806201,0x7a6259a0,0x7a827aa3,0x82c461a0,0xa3867a62,0xa3877a61,0x7a82a3a6,0x59808b24,0x7a8261a0,0x62008304,0x59c08304,0x59a05160,0x512061a0,0x7aa37261,0x728282c4,0x6a417282,0x7ac37ac3,0x6a8151a0,
-0x7aa359c0,0x59a059a0,0x61c06a22,0x7ac27261,0x72a359c0,0x51a04960,0x6a416200,0x82e38b45,0x72a27b03,0x8b656220,0x5a007ae3,0x72a272a1,0x6a426a62,0x49804980,0x41404981,0x39201800,0x416130e0,0x51c049a0,0x62416a63,0x49c05a60,0x51e04180,0x498151c1,0x49a151c1,0x41604160,0x51e251c1,0x41601000,0x41a04160,0x39601840,0x41c041a0,0x49e041c0,0x4a005aa2,0x522049e0,
-0x41a05a42,0x416030e0,0x51e33940,0x62445a03,0x49a26265,0x39416245,0x28a04141,0x28c04983,0x392149a2,0x39403100,0x49e241a0,0x31203100,0x39404180,0x4a005242,0x52215242,0x52413960,0x52223980,0x524149c1,0x31603140,0x422139c0,0x31803180,0x4a2239c1,0x52634a43,0x522341e1,0x31203960,0x29003960,0x31401880,0x42023981,0x42014a22,0x39823120,0x20a04183,0x28e03120,
-0x8b05a3a8,0x8ac18ac1,0x9b2669c0,0x8ac371e0,0x8ae38ac3,0x72417a61,0x82e382c2,0x9b048ac2,0x93038aa0,0xa36592e2,0xa3668aa2,0xa3658ac1,0x8aa292c3,0x8ac27a40,0x7a816a00,0x93857a20,0x72207260,0x824092e3,0x9b237a40,0xc4699b23,0xb3e69b61,0x69c08280,0x7a407220,0x82848aa3,0x9b868ae2,0x8ac29b45,0x93247240,0x82c14900,0x72209341,0x93067261,0x82a27200,0x7a4069e0,
-0x7a608ae2,0x51806a40,0x7aa261e0,0x59c08ae5,0x61825160,0x69e169e0,0x7ac47222,0x51615160,0x40c07284,0x40e04100,0x59a04920,0x51603880,0x49004900,0x72837244,0x622259e0,0x7a8259a0,0x82a369e0,0x7aa282e3,0x7a628ae4,0x72219325,0x82a382a2,0x8b249365,0x8b247261,0x6a838323,0x59c06a42,0x938782e4,0x6a0069e2,0x8ae359a0,0x59c082c3,0x61e05160,0x6a218b25,0x72818323,
-0x59c08b45,0x8300a3e7,0x722072a1,0x622082a3,0x6a226a62,0x62004960,0x51a06a61,0x7aa27aa2,0x6a624980,0x72c18b66,0x6a616221,0x59e07281,0x61e24960,0x622359c2,0x41204160,0x49805201,0x41406243,0x49804960,0x6a836222,0x6ac26281,0x624251e0,0x5a2349c1,0x41603900,0x30e03920,0x39001800,0x30e01820,0x39405202,0x39403940,0x4a005a60,0x5a814a00,0x52405240,0x52405220,
-0x5a434160,0x41615202,0x5a245203,0x5a0349a2,0x49c259e3,0x39205203,0x51e451e3,0x418051e5,0x41803940,0x186028a0,0x20801820,0x41805203,0x398030e0,0x52215221,0x41a05201,0x49c049e0,0x312041a1,0x39823120,0x31803160,0x318039a0,0x39a02940,0x316039a0,0x29403180,0x31404a02,0x290041a1,0x312020c0,0x39a03120,0x318041e1,0x20c03181,0x314120a0,0x49c33100,0x52254a04,
-0x7a618ae4,0x8b049324,0x722182a3,0x82c39345,0x72619345,0x7aa182c2,0x7a826a61,0x93268ac2,0x930261a0,0x82c27220,0x72018b02,0x8ae27a40,0x82a07a40,0x93229323,0x82c08b02,0x8ac28b01,0xcced6a00,0x93058ae3,0x8b037220,0xa3639302,0xabe592e3,0x8aa369c0,0x69c09b65,0x82619304,0x93248ae0,0x93247a60,0x72407a80,0x93439302,0x72209324,0x8ae369e0,0x8ae3a3a6,0x8ae37220,
-0x8b039324,0x6a027a83,0x726161e0,0x7aa27a81,0x82a48ae4,0x620161a0,0x8ae661e1,0x518061e0,0x61e25160,0x40c05981,0x51605140,0x51615160,0x59e25160,0x59c372a4,0x51805180,0x59604920,0x7ac35180,0x8b0461e0,0x388082c3,0x72216a20,0x6a005960,0x7a825980,0x6a207a81,0x51808b25,0x518151a0,0x59c07aa3,0x93257a62,0x72416a21,0x8b468b67,0x6a0161e0,0x93867281,0x83047ac1,
-0x7ae259c0,0x6a209c04,0x82e38b43,0x496051a0,0x7aa56241,0x6a626a21,0x6a217ae3,0x620072a3,0x620082e2,0x49606a62,0x622059e0,0x59e059e0,0x49806221,0x51c05a22,0x624251c0,0x39404960,0x49406222,0x49a051c0,0x414051c0,0x398041a0,0x5a425a22,0x520151e0,0x416049a0,0x39413940,0x416128a0,0x418141a2,0x52223960,0x49e05242,0x6ae262a2,0x6b026ae2,0x4a0062e2,0x5a416282,
-0x51e251e2,0x51e349a1,0x5a035a24,0x49e349e3,0x39414181,0x49c34181,0x41813920,0x49a05a64,0x41815201,0x49c120a0,0x49e25201,0x52434180,0x52423100,0x31603160,0x41c039a0,0x52423980,0x31404a02,0x29203980,0x41c13140,0x41a05243,0x4a224a01,0x41c15243,0x39a03160,0x39802900,0x28e049e3,0x41c13960,0x29403960,0x294041e0,0x31412920,0x394149e3,0x49e43962,0x28e13142,
-0x8ae48b04,0x93246a00,0x61c07240,0x82e37261,0x59e06200,0x6a207ae3,0x62006a20,0x72407aa1,0x7aa27aa2,0x7a817ac2,0x722069e0,0x82a07220,0x82a09323,0x9b4282a0,0x8ae092e0,0x82e29302,0x59c27a66,0x728638e0,0x72a530c0,0x9ba59326,0x9b649344,0x7a407200,0x8aa469c0,0x93229b44,0x9b4482a1,0x8ac27a60,0x61a08ae2,0xac28ac29,0x7a8161e0,0x59605980,0x7a617a82,0x934569c0,
-0x6a009324,0x82c46a01,0x8ac29303,0x92e39b45,0x61c07a62,0x59c07220,0x7a6259c0,0x8b497aa2,0x59c06201,0x59a059c0,0x59a15981,0x49406a01,0x62033060,0x496051c1,0x62234940,0x724059a1,0x69e07a80,0x61e05140,0x51209365,0x6a006a20,0x61c061c0,0x72a282e5,0x59e159c0,0x6a217a83,0xa3ec6a60,0x83048b45,0xa3a78ae4,0x7aa361c0,0x49006a44,0x7a617261,0xa3c79b63,0x51a08b42,
-0x6a407ac2,0x59c06200,0x62219ba8,0x5a015a21,0x7aa46241,0x62006a21,0x728259c0,0x7ac26a62,0x83038b05,0x7aa27240,0x72a28303,0x6a6159c0,0x49804960,0x49804980,0x6a625a01,0x41605180,0x6aa34160,0x418049c1,0x28e03940,0x28e020e0,0x20604121,0x5a215a22,0x41204160,0x31005a43,0x41612060,0x41803120,0x314028e0,0x49e05242,0x49e05220,0x6ae36281,0x62a149a0,0x49c05200,
-0x49a151e2,0x5a245a44,0x51c25a24,0x28e31840,0x20800800,0x49c049a3,0x418049a0,0x39406ac4,0x5a435a42,0x31405a63,0x52224a00,0x49e05a62,0x41c05222,0x41c041e1,0x398039a0,0x4a214a22,0x31603140,0x314041c1,0x41c13140,0x314041c1,0x398041c2,0x396041e1,0x316041e1,0x31202900,0x28e03120,0x39a03120,0x20e039a0,0x39c039a0,0x29403160,0x31213981,0x18602900,0x49e51020,
-0x82c282a2,0x82a27220,0x72407240,0x620059a0,0x62007281,0x72826a20,0x59c07281,0x61c06a40,0x7a616a00,0x72406a20,0x82a082a2,0x82c082a2,0xa3a3a385,0xa364a384,0x92e08aa0,0xbc2a92c2,0x200048e0,0x72c62820,0x6a642040,0x62214120,0x82a349a0,0x728082e2,0x8ae47240,0x9b639b44,0xa385b407,0xaba57200,0x82829322,0x932461e0,0x61a07222,0x82c27220,0x61c07a81,0x82c18ae2,
-0x7a6182c2,0x828271e0,0x82617200,0x9b66a385,0x61a07a82,0x598061e0,0x6a2059a0,0x7a845180,0x72636a02,0x7a837283,0x59c059c0,0x51616202,0x286040e0,0x516051c1,0x51405180,0x82a24120,0x8280edc1,0x7240c4a9,0x30602820,0x51605160,0x59c06a21,0x41008b27,0x83054940,0x93249324,0x8b057a62,0x83046a41,0x496059c0,0x49205180,0x7aa44900,0x8ae59346,0x82618ae2,0x82e29b85,
-0x7aa26a20,0x830482a2,0x51c059e0,0x51a072c3,0x59c07262,0x72626a20,0x59c06a41,0x6a207aa2,0x724082e2,0x830282c1,0x6a6151a0,0x72a35a20,0x59e03900,0x61c051e0,0x51c07262,0x28a04180,0x29003120,0x5a4428e0,0x52044180,0x310049e3,0x626249c1,0x41614160,0x39204981,0x204028c0,0x30e028c0,0x39401000,0x41c141a2,0x49c049e0,0x5a4062a2,0x628162a1,0x52005a40,0x626449a0,
-0x49c15202,0x49a049c1,0x498151c2,0x49c451e4,0x418441a3,0x52025a25,0x41a04180,0x41a05242,0x520441a0,0x52214a01,0x398041c0,0x4a0141c0,0x4a013980,0x52425242,0x4a013160,0x39a04a01,0x4a014a01,0x314041e1,0x396041a0,0x396128e0,0x31202900,0x188041c3,0x20c039c1,0x18c018a0,0x39c12920,0x420239c0,0x296039a1,0x39c04201,0x29403180,0x29003102,0x08001880,0x10001000,
-0x7a8082e1,0x61c07a41,0x82e382a1,0x7aa18b63,0x59e072a1,0x69e059c0,0x61a07220,0x6a209344,0x72407a81,0x72408b02,0x8ae19321,0x93038ae1,0xabc6a3a4,0xa365abc6,0x8260bc08,0x596092a1,0x20605161,0x72a659c3,0x93aa7285,0x51e330c2,0x83256285,0x9b646a00,0x9b447a60,0x7a4182a2,0xabc69b44,0x9b237200,0x61807a40,0x72208b05,0x7a4282a1,0x9b668b04,0x72408ae2,0x8ae2a3c5,
-0x72407a80,0x61808ae3,0x9b647a60,0x72208ac3,0x59807241,0x82626a00,0x72619b46,0x30606a42,0x51606200,0x59a04920,0x492059a0,0x494061e3,0x51605160,0x620159c0,0x7a625140,0xf6467263,0x8b20ed83,0x5980de2a,0x8b60ddc7,0x728182a2,0x61e17283,0x6a015980,0x7a8182e4,0x72209324,0x490082a2,0x7ae459c0,0x6a626a61,0x498093a6,0x83075180,0x59c159c1,0x8b046a40,0x82c37a82,
-0x82c27240,0x7ac37a81,0x5a004960,0x51c051a0,0x7ac38b25,0x7ac27282,0x72818324,0x83237ac2,0x9b857a81,0x83027220,0x59e07ae3,0x41406222,0x72a46221,0x728251a0,0x41814960,0x206030e0,0x18401820,0x49804140,0x41404960,0x6aa46243,0x390051a0,0x5a423920,0x39204160,0x52014180,0x418028e0,0x5a623120,0x4a0049e1,0x62625240,0x41a049e0,0x5a413940,0x62445200,0x49a23900,
-0x41612060,0x5a2451e3,0x51e349c2,0x39006a86,0x49c249a2,0x394041a1,0x100051e2,0x418020a0,0x39405221,0x49e15a62,0x316041c1,0x5a624a21,0x39804a22,0x4a213140,0x41e13980,0x41e041e0,0x31605242,0x316041e1,0x31205243,0x28e028e0,0x41c141c1,0x49e23120,0x31802940,0x29404a23,0x42025264,0x294039a0,0x41e23180,0x10602920,0x31802920,0x31013140,0x31012080,0x52273983,
-0x61c069e0,0x7a617a81,0x82e27260,0x93667ac1,0x6a408323,0x8ae18301,0x9b649302,0x82a19b64,0x8b207a60,0x93419302,0x8b009322,0x9b639322,0x69a08280,0x9b659b03,0x9bc79b45,0xa42b7ac3,0x62027285,0x62234140,0x100051e4,0x51e151c4,0x62c25a44,0x8ae282a1,0x69e09324,0x69e082c2,0x8ac282a1,0x72009b43,0x49008ac3,0x7a638303,0x8ae38263,0x59406220,0x8ae282c1,0x6a009b64,
-0x82c18ae2,0x93239b25,0xabe97aa0,0x49003840,0x8b2461a0,0xc4cc9346,0x722382e2,0x724082c5,0x72419326,0x59c082a3,0x7a846a22,0x49409ba9,0x49605180,0x6a414120,0x82e36a20,0xe5627204,0xac42d544,0x72403900,0xc4e3ee44,0x6a409b64,0x49415982,0x82c37a81,0x93447a81,0x51609b86,0x61e06a40,0x72a372a3,0x5a0051c0,0x59e06a83,0x59c14940,0x41208326,0x41207ae6,0x6a416200,
-0x726259a0,0x59c07262,0x51a082e4,0x59e06a83,0x59c08303,0x72817261,0x7ac26220,0x7ae28b64,0x82e37ac2,0x61e08302,0x414061e0,0x51c08326,0x62236a62,0x83682020,0x49413080,0x28a01800,0x518051a2,0x59e05180,0x624259a2,0x62615a21,0x62425a01,0x49a06242,0x49c04180,0x49e049c0,0x49c05200,0x41a05a40,0x628141a0,0x626149e0,0x6ae45200,0x41625a62,0x418130c0,0x522149c1,
-0x49a149a1,0x41a15223,0x49818368,0x59e36223,0x41a149a1,0x49a149c2,0x104028a0,0x41c14a01,0x39603940,0x39803960,0x39c03160,0x318039c0,0x316039c0,0x31802940,0x39a03140,0x4a005201,0x41e04200,0x31603160,0x4a214200,0x42204220,0x29204201,0x31803180,0x29204202,0x39e241e2,0x522441c2,0x41a149e3,0x28c04a05,0x39623941,0x41823121,0x312128c0,0x49c449a4,0x41833961,
-0x82e49b87,0x8ae369e0,0x7aa17220,0x83016a40,0x9ba78b43,0x8b029bc7,0x7a809b64,0x8ae37a80,0xabc79324,0x93239b65,0x7a40b3e7,0xa3857220,0x51207a40,0x596069e0,0xa4096a01,0x30c0ac29,0x41414141,0x204030c1,0x7b297b28,0x08002041,0x30e03922,0x82a17221,0x7a808ae3,0x6a0082c2,0x69c06a00,0x8ae48ae3,0x49804060,0x5920bc66,0x59608b01,0x8ae261e0,0x7a609324,0x7a807a60,
-0x722069e0,0x61a082a2,0x6a008ac3,0x6a016a00,0x72615140,0x72409b67,0x48e061c0,0x61813020,0x6a009346,0x6a627242,0x61e159c0,0x516059a1,0x61e259a0,0x8b4759a1,0x726238a0,0xe6053000,0x49a0ac20,0xacc730e0,0xa3e67280,0x72a17aa0,0x62015180,0x8b2482c2,0x8b246a20,0x59e072a2,0xac6b8304,0x62007281,0x624151c0,0x72c459e0,0x6a4372a3,0x494038e0,0x412059c0,0x728261e0,
-0x72825160,0x6a216a42,0x51c082e4,0x72c26a42,0x72828323,0x7aa26200,0x93658303,0x62006200,0x72807280,0x72607280,0x51808324,0x51c06200,0x51e151a0,0x5a026a64,0x390051a1,0x392030c0,0x72833900,0x51a072a3,0x51c04961,0x72c35a01,0x62613920,0x62616261,0x49c06282,0x62a349c0,0x52406ae4,0x522062c1,0x5a8149e0,0x62825a61,0x49e149a0,0x418128c0,0x20604141,0x18201840,
-0x51e24180,0x51e249a1,0x49c13940,0x418149a1,0x41603920,0x41804180,0x41c049e0,0x4a025241,0x41803960,0x314049e1,0x39c03160,0x18a039a2,0x294018a0,0x39c13160,0x41e139a0,0x00001060,0x29420800,0x31804a43,0x31a02920,0x39a039c0,0x4a224201,0x31a031a0,0x318039e0,0x31a12120,0x314141c3,0x188020a0,0x30e03120,0x41824161,0x41823962,0x49a349c3,0x30e041a2,0x52044183,
-0x8b027ac1,0x7a818ac2,0x8b036a20,0x93849367,0x61e07ac4,0x6a2059c0,0x8b028b23,0x9b859323,0x5940a387,0x7a609342,0xb408a3a7,0x9b24a385,0x59609324,0x8b285180,0xa3e96201,0x2060bc8b,0x49831800,0x08009c2d,0x20404984,0x418151c5,0x41a13941,0x93029323,0x72408ae3,0x8b048b03,0xa3c76180,0xccac8282,0xd5466180,0xd524fee5,0xac05a3c3,0x69c08b63,0x8ae28b22,0x724082a1,
-0x59409325,0x82a27a40,0x72227221,0x51607202,0x7a625120,0x7a637222,0x9b675980,0x6a207a84,0x69e07222,0x620061a0,0x61e07282,0x6a217263,0x51818304,0x59c059c2,0x69e059a0,0x6a408b06,0x7ae34981,0x49c293eb,0x51806a41,0x6a609ba8,0x83039386,0x7a818303,0x93659b85,0x49a06a60,0x498072a3,0x30607aa4,0x41206a24,0x59e14920,0x49606220,0x51a059e1,0x49805a01,0x83048304,
-0x83046a42,0x8b056a21,0x72c46a22,0x72c27283,0x8b248322,0x830359c0,0x59a07281,0x83247b03,0x7ac08321,0x72818302,0x40e059c0,0x5a006200,0x51c159e0,0x6a6251c0,0x496051e1,0x39003900,0x6a623900,0x414051a0,0x51c06a43,0x49a06221,0x62816a82,0x5a6151e0,0x49a06aa3,0x49c05a62,0x5a404160,0x39805220,0x8bc76282,0x30c06ae2,0x51e25a24,0x52011820,0x52405221,0x52005200,
-0x418049c1,0x41814160,0x52223940,0x41a13960,0x52013960,0x41603120,0x31603960,0x39803980,0x49e141a0,0x31603120,0x316041c0,0x39e062e4,0x42004a61,0x316139a0,0x31203980,0x41c428c0,0x00201081,0x08000020,0x39a02940,0x39c13160,0x29603180,0x39e039c0,0x39c039c0,0x31803160,0x39413961,0x31203141,0x28c02901,0x396249c2,0x520441a3,0x28e041a3,0x41a23941,0x39415a46,
-0x7a608ae1,0x7a407220,0x598069c0,0x93438b02,0x938482e1,0x9345ac09,0x728069e0,0x7aa161c1,0x8b03a3e7,0x59e1b48d,0x82a09b65,0xbc2b8ac5,0x9b663860,0x93468284,0xa3ea6a02,0x39409347,0x836c28a0,0x1820acd0,0x6aa63900,0x5a231820,0x8b845a20,0x9b849b64,0x9b669344,0x72208ae2,0x82a182c1,0x9b6569a0,0x92e26a00,0x4120abe3,0x72c08bc4,0xa421cda8,0x7a817ac0,0x69e140a0,
-0x598061c0,0x69e05980,0x6a005940,0x7a427aa1,0x7a8269e0,0x61e061c0,0x51407a82,0xd54fa3c8,0x5a006a00,0x624093a7,0x83026a40,0x62006a40,0x8b658b24,0x83446a81,0x9ba98325,0x83047263,0x83459365,0x20406261,0x6a416a61,0x61e04100,0x72a28304,0x62004980,0x412059a1,0x7ac451a0,0x38e06a82,0x518072a4,0x62024960,0x59e16a22,0x61e06a41,0x496059e0,0x6a616200,0x82c28b44,
-0x9bc561e0,0x62007a81,0x59c06221,0x83248325,0x8b666a61,0x7ac26a81,0x72e38323,0x51c06200,0x72a08321,0x8b238322,0x62004920,0x412059c0,0x6a818324,0x49606241,0x49804120,0x496030a0,0x622259e1,0x412072a4,0x49806a83,0x49a05a21,0x62a26281,0x730372e3,0x5a224160,0x520249a1,0x6ac35a21,0x5a2251e0,0x498049c0,0x30e01840,0x49a051e1,0x6a837b26,0x52205220,0x49e04a20,
-0x39604a01,0x52025221,0x41a13120,0x418028c0,0x49c15a64,0x5a234180,0x418049e1,0x39403100,0x28c05a43,0x39e03940,0x42204201,0x39c04a40,0x39a039c0,0x39e04a41,0x31403980,0x41a241a1,0x41a43983,0x100028c1,0x00000000,0x39a11900,0x318039c0,0x39e03180,0x4a223180,0x31803180,0x39c13180,0x31402960,0x20a03161,0x39421880,0x52053942,0x41824162,0x39625a66,0x418249a3,
-0x8b04a3c8,0x9b659324,0x62007a41,0x72605960,0x8b209ba3,0x2800a3e1,0x7ae4a3a5,0xa4245160,0xac289bc4,0x4902bc2e,0x8b049b66,0x6a226a01,0x9b6882e5,0xa3a9abe9,0x832640e0,0x204040e0,0x49a21820,0x626528a0,0x5a243920,0x51c23960,0x8ac06a00,0x93439b23,0x8b659344,0x18007ac4,0x48c02000,0xa3856160,0x71e05980,0xb403a344,0x7b209bc2,0x93a28361,0x7aa06220,0x72418ae3,
-0x82e37aa1,0x8b0482c3,0x93467a82,0xb4288ae5,0x82e29326,0x9365bc8a,0x61e082c2,0x8b258b24,0x62004900,0x72a46241,0x518059e0,0x51c051a1,0x38c051c0,0x28807ae3,0x38c11800,0x9ba56a64,0x1800a3e7,0x6aa12020,0x41006200,0x6a8159c0,0x51a07283,0x72a26201,0x72816a63,0x7ac37283,0x49407ac5,0x62226a83,0x7a8359a0,0x7a836a01,0x9ba67282,0x8b229ba6,0x61e09ba6,0x8b225180,
-0x8b219b84,0x7ac382c2,0x7ae351a0,0x72a26a81,0x62406a60,0x72607ae2,0x51a06a40,0x622051a0,0x728072a0,0x7ac27ac1,0x6a217ac3,0x934561e0,0x83447aa2,0x6a4259e0,0x6a217aa3,0x72625180,0x62017282,0x622251a0,0x51c06221,0x520051c0,0x8ba749c0,0x51e049c0,0x30e03900,0x41803920,0x62626aa3,0x39005a41,0x49c05200,0x5a6141a0,0x62627b46,0x62655a40,0x49e05200,0x5a8241c0,
-0x39605a62,0x41c141c0,0x39804181,0x4a0249e2,0x394020a0,0x28c049c2,0x418149e2,0x49e24180,0x41803960,0x31603940,0x318039a0,0x41e03180,0x39c039a0,0x39c039a0,0x52423980,0x39813100,0x49a34182,0x52474163,0x10205a46,0x00000800,0x41c40800,0x31802940,0x4a2339c1,0x18c018a0,0x294010a0,0x29401920,0x41e23181,0x39402920,0x30e041a2,0x39414162,0x51e43962,0x396141a2,
-0x8b446a40,0x7ac0a3e6,0x72616a40,0xa3e58b22,0x6a40cd2b,0xed81f647,0x9383b420,0x82e25180,0x7aa57280,0x82a2abe8,0x8286a3e9,0x82e4abc7,0xcd6e82e4,0x51824920,0x20208348,0x28a31000,0x08000800,0x6a844941,0x416051c0,0x6a847b09,0x9c0a6a85,0xa3c69b84,0xaba3b405,0xd52baba4,0xb3a3d4c9,0xbc25cc88,0xb406c447,0xdd6cbc88,0xb464d50c,0xd54ca405,0x8b41b468,0x72a46a41,
-0x49634981,0x28003041,0x28007245,0x28002800,0xb48c40c1,0x49203880,0x20205160,0x9b269385,0x59c030a0,0x59e159e0,0x7ae26240,0x9c098b87,0x7ae272e3,0x7b227b02,0x9c077ae3,0x30a07ac4,0x93643060,0xa42493a5,0x82e29345,0x8304a3c7,0x8b667285,0x72a16221,0x49607283,0x622159e0,0x20008306,0x82e56201,0x82c67245,0x620159a0,0x6a0159a0,0x40e11000,0x28002000,0xa384a3a6,
-0x6a0082a0,0x7ac259a0,0x83037ae3,0x59a08303,0x8b238303,0x72819bc6,0x620082e3,0x6a406a81,0xa3c57260,0x72608b22,0x6a0082a2,0x61e061c0,0x69e07261,0x622059a0,0x7ae37ae3,0x7aa48b24,0x7ac372a2,0x6a6172a2,0x5a406a61,0x5a006280,0x72e36261,0x51e16242,0x49a14161,0x51e249c0,0x49a149a1,0x51e14980,0x62824180,0x49c06282,0x62a35a40,0x49e049c0,0x4a0041c0,0x398062a3,
-0x39603120,0x20a03980,0x39613960,0x20801860,0x416028e0,0x30c049a1,0x412038e0,0x31203920,0x49e14180,0x41e13980,0x29602960,0x396031c0,0x41e14a01,0x39a03160,0x39a139a1,0x39803140,0x396149e2,0x418241a3,0x52463942,0x314362a8,0x00000820,0x290020c0,0x29202920,0x31803180,0x39e131a0,0x31802960,0x31803180,0x292039c1,0x31402940,0x39613960,0x416141a2,0x49a351e4,
-0x498093c8,0xac6a3060,0x6a40b4aa,0x7ae372c0,0xbd2a9be5,0x6ac0a463,0x9362c589,0x7240c4c9,0x7a619362,0x7a6382e4,0x200082c5,0x61a4b3eb,0x726348e3,0x284038a0,0x39022840,0x62672040,0xac6d5a05,0x51c26a22,0x10002020,0x7ae95a46,0xfe51e611,0x72a59b04,0x69c06a01,0x8b242820,0x5120b429,0x38c04100,0x48e0b3e8,0x28002000,0x41641800,0xedef1000,0x9ba7b427,0x180059a6,
-0x41005161,0x8b476a44,0x82e59ba7,0x9bc5b48b,0x82c48b46,0x7ae682c4,0x59a072a4,0x514059c0,0xb48b59e0,0x72c36a63,0x72a26241,0x5a207ac5,0x5a006262,0x72a35a00,0x51a15a20,0x8b239bc6,0x7aa19364,0x49206a01,0x38802800,0x51807a82,0x51802000,0x7ac55180,0x490051a0,0x8b2659e1,0x40c06201,0x62016201,0x8b465160,0x7a625180,0x724082a2,0x6a407262,0x72807ac1,0x8b22a364,
-0x9b669343,0x516059a0,0x308059c0,0x6a408304,0x7260a3e6,0x8b447260,0x82e36a60,0x8b416a61,0x8b429362,0x6a008b43,0x82e28ae3,0x72409344,0x82c28b04,0x7ac26a40,0x72a28b85,0x61e17261,0x7ac359e0,0x832472a2,0x62817ae3,0x31006260,0x62623940,0x30e072c5,0x62446a85,0x39403940,0x6a834140,0x5a416ac4,0x41806aa2,0x62a249e0,0x52215a40,0x41c04a00,0x28e03960,0x208020a0,
-0x20a03101,0x31213960,0x394028c0,0x31003120,0x39604181,0x28e03140,0x41414141,0x39615a22,0x186028e0,0x31604180,0x31a02960,0x41a03180,0x314039a0,0x49e141a0,0x39c02960,0x31803180,0x41e23980,0x39805244,0x526441e2,0x5a6641c3,0x7bed4a26,0x394320c0,0x20c02920,0x29402920,0x31802940,0x31802960,0x29602960,0x31812920,0x31a10880,0x20c02920,0x39403100,0x31203120,
-0x49a32040,0x6a4251a1,0x49418305,0x30e030e1,0x624172c0,0x73008362,0x9bc56220,0x8b42a407,0x51609385,0x28205180,0x93667aa2,0x40c082a4,0x624538a0,0x83088b27,0x28c02880,0xabeb8ae6,0x7b2661e0,0x284038c0,0x08003943,0x28800800,0xed2bc4eb,0x18005160,0x20001800,0x28202000,0x48e03880,0xb44a7203,0xfeb2bbe6,0xabc4ccc9,0xdd4cd4c8,0x6a03a3a5,0xaba52840,0xabe6b406,
-0xa3a8b449,0xac2a9bc7,0x82c27a83,0x62009ba5,0x494051a1,0x200059c0,0x7a6338a0,0x51407a64,0x49405160,0x38c04140,0x49604960,0x416038c0,0x41404960,0x5a005a00,0x5a017b03,0x62408324,0x62606aa0,0x83038322,0x8b048b03,0x51807a83,0x38a059e1,0x72a46202,0x51a24100,0x516059c1,0x492059e0,0x51604941,0x61e161c1,0x7a626a41,0xa3a57240,0x722061c0,0x8b0382a2,0x8ae1a385,
-0x7aa17a81,0x6a216201,0x61e07aa3,0x8b0372a2,0x72208b23,0x9b8482a1,0x6a0082c1,0x7ac07ae1,0xa3c59343,0x938569e0,0x728159e0,0x72607ac2,0x59e0a3e7,0x83448324,0x62406240,0x6a618b44,0x624172e4,0x6a8251c0,0x6ae46240,0x49a24a00,0x51e22880,0x10003920,0x390030e0,0x51e14180,0x51e13920,0x62a249e0,0x5a815a41,0x62c35220,0x41a049e0,0x41a04180,0x41a03980,0x41815202,
-0x628549c2,0x31203120,0x41a23120,0x39604a01,0x31604a22,0x49e13160,0x31203960,0x5a2341a0,0x41a049c2,0x31401860,0x29603180,0x39a14201,0x316041a1,0x398141c0,0x316041c0,0x31a039c1,0x4a2239a0,0x39c039a0,0x31803160,0x294041e1,0x4a233160,0x41e15264,0x31403981,0x39a03180,0x31802940,0x39e13161,0x318041e0,0x21202940,0x29402940,0x39e13180,0x39a141e2,0x39803980,
-0xbd0eac2b,0x7283a40a,0x72a330a0,0x38e09c08,0x51c051c2,0x498051c0,0x93a88305,0x72627ae2,0x8b43ac28,0x72825140,0x936759c0,0xac0b7aa1,0x30617ac5,0x30c06221,0x30c0ac8e,0xb449b42b,0x20401800,0x28802040,0x728349c1,0x72629366,0xd50ec4ca,0xcc69a364,0xd445cc87,0xd485c3e3,0xd4a7d4a7,0xed6bcc66,0xe58bed8c,0xc489fe71,0x38e05180,0xddcb3060,0x82c2b466,0x59e17224,
-0x18001000,0x28203040,0x51204080,0x38a040c0,0x49406225,0x72656a43,0x61c06a23,0x7a827221,0x6a417ac3,0x410059e0,0x7ae66a64,0x62806243,0x83826aa2,0x7b227b42,0x7b036a80,0x8b8651c0,0x41405a00,0x82e26a40,0x59c06a20,0x49604100,0x40e07ac4,0x49606a44,0x49404140,0x726338a0,0x7aa57aa5,0x51a06202,0x51606a22,0x8b046a41,0x61a09325,0x7a6161a0,0x82a28ac2,0x9b649321,
-0xabe69344,0x72628b44,0x830482e5,0x82e282e2,0x72407240,0x6a008ae2,0x82e282c1,0x72a08b42,0x72407240,0x83029323,0x59c072a1,0x7ae259c0,0x62208304,0x7b0372a2,0x72e26240,0x6a608323,0x7b0549a0,0x6a8172a2,0x6a856241,0x20404140,0x30e06264,0x41404981,0x39006aa3,0x626251e1,0x62816261,0x5a615a40,0x5a4149a0,0x5a6249c0,0x41a049e1,0x418041a0,0x52215a83,0x5a234180,
-0x62a53140,0x41c13140,0x31403960,0x39a03140,0x39603980,0x398041c1,0x314041a0,0x39603980,0x18803961,0x20e020a0,0x294141e1,0x316118c0,0x524241a2,0x39603160,0x21003960,0x4a423160,0x316041e1,0x4a2239c0,0x316031a0,0x31602940,0x316039a0,0x39802920,0x41e139a0,0x316041e1,0x39a13160,0x29402920,0x31a03180,0x318031a1,0x296031c0,0x21202960,0x21002100,0x29203140,
-0x72c27ae3,0x6a2161e1,0x9368a42b,0xb4ada3c9,0x49806a84,0x7ae71800,0x496328a0,0x6a8051c0,0x5a208362,0x30608b64,0xb40a2000,0x40e09baa,0x7a617aa3,0x18008b67,0x8b8d7aa5,0x7ae751a2,0x28402000,0xac2b7243,0x8b039b45,0xc4ac8260,0xfe2ef5ee,0x40c06181,0x6a003880,0x72437aa3,0x20404143,0x10002083,0x9b690800,0x20221802,0x18001800,0xedb02000,0x9b44b40a,0xa38569c0,
-0xc48aedef,0x7a629b46,0x8b2761e0,0x83047ae2,0x620159c0,0x514059c0,0x7a8361e2,0x7aa340e0,0x59a07283,0x496061e0,0x51e14960,0x5a404180,0x41205a21,0x62434980,0x39205a02,0x5a202860,0x51a04960,0x7ae18304,0x516061e1,0x620259c0,0x51807284,0x51406a43,0x38a05980,0x7a6361c0,0x7a8382e5,0x51a06a62,0x82e461e0,0x72816a22,0x62007a85,0x72206200,0x9b239302,0x9b649323,
-0x7a61a365,0x7a81b426,0x7ae09385,0x8b039364,0x69c082a1,0x93239323,0x8b438b02,0x934282e1,0x8b0261c0,0x7ac28b05,0x62206240,0x6a815a00,0x59e08342,0x5a016240,0x7b026220,0x72c08b64,0x83446a82,0x5a0072a2,0x38e08325,0x51c15181,0x28806243,0x72e451c0,0x6ac36283,0x41805221,0x41a051e0,0x4a0041a0,0x5a6262e3,0x41c05a62,0x41c03960,0x39a03180,0x41a03140,0x39603960,
-0x312041a0,0x31603980,0x31803180,0x39a039c0,0x314041e1,0x316039a0,0x28e03160,0x312028e0,0x31403180,0x104020e0,0x39c23162,0x29403160,0x39603160,0x41a049c0,0x29403160,0x31a139a1,0x31a039c0,0x4a2231a1,0x298039c0,0x42023180,0x29602960,0x31802960,0x31803160,0x296031a1,0x31604202,0x29202920,0x31c03180,0x212031a0,0x29602960,0x29802980,0x21002980,0x18c031a0,
-0x41013080,0x49404920,0x51c23900,0x4120a40c,0x38c06243,0x39211800,0x9c0c6a45,0x412159a2,0x49404961,0x7aa47aa2,0x61e08b46,0x72429b67,0xb3e89366,0x8b4740a0,0x18007ae5,0x51806a23,0x8b676222,0x82e382c5,0x59c07260,0x940a40e1,0xed4ad52a,0x18003040,0x10001800,0x28a01800,0x7a665121,0xdd90a3aa,0xaba5dd4d,0xac05abe5,0xa3e4abe4,0x932392e0,0x9323a384,0x8ae28ac1,
-0x8ae29344,0x722082c2,0x49408b45,0x61e07aa2,0x518059a0,0x72635180,0x7ac47ac4,0x59a07a83,0x61c061e0,0x72a37a83,0x62816a61,0x5a2049c0,0x62425a41,0x59e15a21,0x62625a21,0x39006224,0x51a04140,0x62008b45,0x6a217ac3,0x49406a22,0x49607284,0x726238e0,0x7a8361e0,0x6a0169e1,0x40e06200,0x59c15180,0x82e761c4,0x61c082e4,0x62005980,0x7a8059c0,0xb3e68ae1,0x82e2abc6,
-0x82e19363,0xa40682c1,0x6220ac48,0x7a808342,0x93029b63,0x8ac29323,0x93639323,0x82e17ac0,0x8ae282a1,0x61e09b65,0x83236220,0x72c07ae2,0x6a606200,0x7b216a60,0x7ae38363,0x83428b83,0x7b0372e3,0x6aa272c2,0x72a472a3,0x498072a4,0x59e372c5,0x62434960,0x41a049a0,0x41806ac4,0x52215201,0x49e05221,0x41a041c0,0x39805221,0x524249e0,0x4a0141c0,0x52015201,0x41a049a0,
-0x41a041c1,0x4a0141a0,0x39c03980,0x39c041c0,0x314039e0,0x41a13140,0x49e241c1,0x396041c1,0x29003161,0x294120e0,0x39c120e0,0x292041e1,0x28c02920,0x20a03101,0x18e120e0,0x21202940,0x31612940,0x318018c0,0x318139c0,0x31802940,0x29602960,0x318039e1,0x21202920,0x31603180,0x39a13180,0x42012940,0x29803161,0x21202980,0x29802980,0x29602140,0x21402960,0x39e22940,
-0xac4f6a46,0x5a0493cc,0x20401820,0x51e30800,0x59e14940,0x6a8430a0,0x41401840,0x62218306,0x40e25181,0x59c09367,0x38e09321,0xdd4d82c1,0xa363b409,0xa3a99301,0x7aa42000,0x82c77aa4,0x6a237aa3,0x1800a3ea,0x20212001,0xacaa3080,0xbca8cc29,0xb426b3c2,0xabe6a3a4,0xa367b408,0xa345b3c6,0xa383a363,0xa3e5ab85,0xa3829b60,0x9b839b42,0x724092e1,0x82c08ae2,0x82809301,
-0x72208ae1,0x69c05120,0x8b226200,0x82e46a41,0x72836a41,0x620051a0,0x83057ac2,0x51805160,0x61e16a21,0x62417242,0x6a836a63,0x6aa27b46,0x49804180,0x5a016242,0x51a051e0,0x62805a00,0x59c06241,0x6a207aa4,0x59c06a40,0x518059a1,0x49207284,0x61e06a43,0x7ac36a20,0x59606a01,0x59a06202,0x49605181,0x724261e0,0x6a427aa4,0x62006a41,0x72606a40,0x92e28ac1,0x7240a385,
-0x8b447261,0x7a818b01,0xff346220,0x8b006280,0x93229ba2,0x93229301,0x8b217260,0x82e07240,0x934382a1,0x82e36a00,0x494059e0,0x62208b84,0x83237ae1,0x8ba47ac2,0x72e06260,0x83038341,0x6a6051c0,0x5a0051e0,0x59e072a3,0x6a834940,0x5a216242,0x5a0051e0,0x41616a84,0x73064180,0x49c049c0,0x41a03980,0x41c04a01,0x396041a0,0x41a03980,0x522149c0,0x5a026243,0x5a425201,
-0x6ac66ac6,0x49e05a64,0x41a041a0,0x39c041a0,0x398039a0,0x39803980,0x39603980,0x39803960,0x31803180,0x31802940,0x31602940,0x39e03180,0x4a6241e0,0x316031a0,0x21612120,0x21002941,0x31803180,0x31602960,0x31a039c0,0x316031a0,0x31a12940,0x29602940,0x31803180,0x31602960,0x31602920,0x292020e0,0x29803180,0x31c12980,0x29602120,0x31c131a0,0x298031a0,0x29403161,
-0x28209ba9,0x38a06a05,0x30a04120,0x9bca4921,0x6a2393a9,0x182038e1,0x726359e0,0x6a226a22,0x82e382e4,0x61e09387,0x82c282c2,0xc4aa9b88,0xa36471e0,0x7220abc8,0x7a6282a2,0x8ae49b67,0x720369c0,0x72435940,0x7a659307,0xddb1bcce,0xb404cd08,0x92c0ab82,0x71e08aa1,0x71e0c468,0x7a207a40,0x92e27a40,0x9b22b3e5,0x82818281,0xa3848ae2,0x8ac19b64,0x9b239b23,0x7a209b24,
-0x8ac1a384,0x7a808ae2,0x7aa082a2,0x59a0a3e8,0x51805980,0x61e06a41,0x620082e3,0x59c040e0,0x7aa472a3,0x51c04960,0x5a613100,0x52206282,0x62427305,0x5a004980,0x59e08345,0x5a006a81,0x83448344,0x49406220,0x726261e0,0x61e059a0,0x49205160,0x72216201,0x59606a01,0x410059a0,0x61c17242,0x6a016a21,0x72416a20,0x830369e0,0x6a2061e0,0x7a618ae2,0xa3859321,0x93458ac2,
-0x72627281,0x72605140,0x9c2682e1,0x82e193e5,0xa3e682e1,0x72808b02,0x93836a20,0x93437240,0x6a407260,0x8b6551a0,0x622061e0,0x72c17ae2,0x624059e0,0x6a806220,0x8b8272c0,0x7ac26a80,0x61e17ac3,0x6a426201,0x62227ac4,0x6a827ac3,0x62615a21,0x834749a0,0x5a2149a0,0x5a625200,0x5a6341c0,0x62a35a83,0x49e062a3,0x62845221,0x62836ae5,0x520149e1,0x62435a43,0x62845a63,
-0x62a462a5,0x5a6362a5,0x5a635202,0x4a014a01,0x49e14180,0x49e05221,0x49c041a0,0x31a03960,0x31603180,0x31602940,0x29402900,0x318031a0,0x39a03180,0x29403180,0x316031a0,0x31a02960,0x31603160,0x31803180,0x316039c0,0x316039a0,0x29402940,0x29002920,0x31802960,0x31802940,0x39a13161,0x21002920,0x31a03180,0x29602960,0x31c131c1,0x29802980,0x298031a0,0x29602120,
-0x7a637a63,0x494251a3,0x10001000,0x30802000,0x6a633080,0x49405180,0x51a07242,0x72626a43,0x82c27aa3,0x8b029b46,0x61c082a2,0x8b049389,0xabc86a01,0x69e09385,0x93267220,0x7a6182a3,0x82c3a386,0xedf161e0,0x286051a2,0x5960e5d0,0x4920bc64,0x7a40bc47,0x7a2169c0,0x93028260,0x7a2069a0,0x92e37200,0x7a619b45,0x7a6169e0,0x69c07200,0x828048a0,0x7a4092e2,0x7a209b24,
-0xaba5a3a3,0xa385a383,0x7a60b3e7,0x8ae17220,0x8b017a80,0x82c1a3a5,0x8b228ae2,0x82c37260,0x59e051a0,0x6aa34980,0x62616240,0x30c051c0,0x49804160,0x72c25a20,0x6a626aa0,0x59e05a01,0x620172a3,0x518059e0,0x72635140,0x6a027aa4,0x7aa359c0,0x722282e4,0x82c461c0,0x518059a0,0x72407221,0x8ae282c1,0x8aa28ac2,0x69e08281,0x8b2382a2,0x93249b43,0xabe69321,0xa3c68ac2,
-0x516038a0,0x93437260,0x9bc482e1,0x82e19ba3,0x7a8282e1,0x7a607a81,0xa3a39b62,0x8b438b02,0x83449384,0x5a006241,0x830472e3,0x59e08304,0x8b628b64,0x6aa08b83,0x72c07b00,0x8b478342,0x6a217aa2,0x6a426a42,0x62417283,0x5a006220,0x62604160,0x49806241,0x51e15a21,0x49a249e2,0x49e249e1,0x41a249e3,0x41a149e3,0x49e249e3,0x49c15223,0x5a2349c1,0x52234a02,0x41c14a02,
-0x4a035224,0x49c24a03,0x522362a5,0x52025203,0x52235202,0x5a845223,0x5a435222,0x52235a43,0x4a024a22,0x52024a22,0x39a04a02,0x41e149e1,0x29403160,0x4a223160,0x292041e2,0x29603180,0x31602940,0x31403160,0x20e03160,0x39a01880,0x4a423160,0x31803160,0x29402940,0x31802960,0x29003160,0x29202920,0x39a02100,0x296039a1,0x212018e0,0x31c12980,0x21402980,0x29802140,
-0x48c061a0,0x9b668327,0xa3888282,0x82a47222,0x7a6469e0,0x59c16223,0x620059a0,0x49606a62,0x93467282,0x93249304,0x72a03020,0x3060bcee,0xabe882e3,0x82817a40,0x6a009304,0x8b027a61,0x6a007240,0x9b88b42a,0xabe8ccce,0x59e059c1,0x51a038a0,0x59605941,0x180082e4,0x7a615140,0x7200a365,0x69c09304,0x82a26180,0x61807a62,0x92e49b66,0x82617a41,0xa3648280,0x92e29b23,
-0x9b428ae2,0xa3858260,0xb3e69b44,0x8ac19302,0xbc4792e1,0x9b438280,0x9b429b23,0x82c09322,0x82c3a3e5,0x7ae28b65,0x83046a60,0x51e072c1,0x49605221,0x940772a3,0x626151c0,0x51e06261,0x51a059e0,0x51606a61,0x51205960,0x51407a64,0x59e07222,0x622259c0,0x59607a62,0x6a0159a0,0x8b038ac3,0x9b849b63,0x92e38ae0,0x8ae282c1,0x93019322,0x82a09b62,0xac0782c2,0x6a607aa1,
-0x59a059c0,0x9bc48b02,0xa4458b83,0x7ac17ae1,0x59c082e1,0xa3846a00,0x9b629b43,0x7a809342,0x72c48323,0x51e06260,0x622072c4,0x7b018345,0x8ba28342,0x5a6093e3,0x7ae072e0,0x7aa37260,0x30406a20,0x7ae472a2,0x72e36242,0x622051e0,0x626272c3,0x49a05a01,0x18203940,0x28e020a0,0x28c03100,0x52233960,0x41a23140,0x28e03961,0x39a13981,0x41a14a02,0x102020c0,0x18601880,
-0x314220c1,0x4a043141,0x52245aa6,0x5a444a04,0x4a2349e2,0x52444a02,0x52235223,0x5a645244,0x52035202,0x52234a02,0x52635203,0x52224a02,0x52224a22,0x49c041a0,0x418041a0,0x39603980,0x39603960,0x42023160,0x31603160,0x29405a83,0x31803160,0x29203180,0x29202100,0x29002900,0x31802940,0x398039c0,0x31a039c1,0x21001040,0x18e02120,0x10c01900,0x21820020,0x19200020,
-0x8ae68b06,0x92e59b47,0x8262a367,0x69c1a386,0x59807a23,0x59e14920,0x51807ac5,0x93a77ae4,0x93248b24,0x8ae39b65,0x72822800,0x3860bc8f,0xa3a7a3a4,0x7a619b44,0x7a409304,0xabc8a385,0x384069e1,0x51205980,0x3080abe5,0x38e03080,0x51a059e1,0x40c02840,0x8ae382c4,0x61e059a0,0x82a35960,0x82c37221,0x82e35980,0x7a815180,0x59c059c0,0x51607261,0x7a4159a0,0x61a082a3,
-0x69e08281,0xa3858281,0x82607a20,0x93027a20,0xa383a383,0x7a208260,0x9b64abc5,0x82a19b43,0x61a08ae2,0x61c06a00,0x49007aa1,0x7ac25180,0x5a006260,0x93c66242,0x51e051e0,0x5a4051e0,0x5a005a20,0x6a616222,0x7a817aa1,0x722061e0,0x6a017241,0x62007262,0x7a6082c2,0x82a27a61,0x7a819323,0x93429b63,0xb405ccea,0xa3c5a384,0x9b839ba4,0x7ac09342,0x9ba59363,0x83238322,
-0x93846a60,0xac459321,0x62409be4,0x7aa26240,0x6a417a60,0x8ac082e2,0xa3847a60,0x82c182a1,0x72806a01,0x62208b64,0x59c072c1,0x7ae051a0,0x94028ba1,0x94028381,0x7aa072e0,0x6a407280,0x7aa16200,0x72a38324,0x520149c0,0x628162a2,0x5a636aa3,0x51e35a43,0x52043100,0x5a445a45,0x41a149c2,0x41c34182,0x39824a04,0x312041c2,0x29001020,0x20c028e0,0x31011860,0x31222900,
-0x10601880,0x314220c0,0x39822922,0x31213981,0x52053941,0x18803942,0x28e11040,0x5a4549e4,0x49c349e3,0x49e24182,0x52235203,0x52235a64,0x52235223,0x52025223,0x52235202,0x522349e1,0x52435a63,0x52635263,0x52225243,0x52435222,0x398041c1,0x31604a01,0x39803980,0x31403140,0x290020a0,0x4a023980,0x18803180,0x294020e0,0x31602940,0x21002960,0x18c018e1,0x21411900,
-0x596061a0,0x49005981,0x49202820,0x48e05900,0x30205140,0x8b271000,0x7ae082c2,0x82c58345,0x72226a00,0x82e382a3,0x7a824900,0x82c29ba7,0xaba6b3e9,0xaba58ae1,0xb3c49b03,0xb3c5aba4,0xd52eabc7,0x6a21c48b,0x38603060,0x6a417aa0,0x7ae25a00,0x38c04981,0x41406a82,0x28404940,0x7a625160,0x59a25162,0x8b267285,0x51814940,0x41002820,0x38602820,0x59804900,0x618061a0,
-0x61a161a1,0x7a448ac3,0x93027201,0x8a8269c0,0x61809b02,0x9b228ac2,0x72207a41,0xa3666180,0x72414080,0x72016140,0x494069e2,0x8b025a00,0x82e27260,0x72a26a61,0x62415a20,0x72c16240,0x7b0459e0,0x83027a80,0x6a207240,0x72409343,0x82c17240,0x82a18ae2,0x72208ac0,0x9b239b24,0x7a609322,0x9b86a367,0xb425f5cf,0x7aa09b64,0xa3e47a82,0x83209382,0x8b437ac0,0x6a6172c0,
-0x6a814980,0x9be47ac1,0x83438360,0x6a4072e0,0x72207281,0x8ae07220,0x93229b83,0x7ac17262,0x7aa18b02,0x72a07aa2,0x8b418322,0x83407ae0,0x730072e0,0x8b618380,0x61e072a0,0x7b029384,0x93c66220,0x286072c1,0x62a372e2,0x41c14160,0x41823961,0x31003961,0x312041a1,0x20c028e0,0x29002900,0x310228c0,0x20e120a2,0x28e220e0,0x10000820,0x49e43121,0x39014163,0x292228e1,
-0x080020c0,0x18a03142,0x31401040,0x28c03940,0x396228e0,0x31213941,0x41833942,0x41835205,0x39813961,0x208041a2,0x08001020,0x41c23100,0x41a35225,0x5a8641c3,0x5a655a66,0x522441c2,0x52433140,0x5a435264,0x49e25222,0x5a035203,0x5a2151e1,0x52225222,0x5a445203,0x52035224,0x49c15243,0x5a445222,0x49e14a01,0x396049e1,0x39604a02,0x31802960,0x316039a0,0x29802120,
-0x48e05980,0x51005140,0x72436a23,0x40c07221,0xb4ef6a06,0x8b898ba8,0x51828328,0x61c06a82,0x61e082c3,0x6a217261,0x722161c0,0x93448b05,0x9b23b3e9,0xb3a67a40,0x9b219b21,0xb425aba5,0xbca87a60,0xcd2e6a20,0x72417243,0x61c0a3a6,0x6a427ae0,0x83438b87,0x62426aa1,0x59c34140,0x6a0159a0,0x40c05982,0x61e24960,0x6a44a408,0x492040e0,0x72636221,0x61c15161,0x490048e0,
-0x49008283,0x5960b409,0x8ac369e0,0x7a208ae4,0x69e07200,0x7a6261a0,0x6a007201,0x6a007200,0x61a061a0,0x9b2569a0,0x59807a41,0x7a804940,0x6a60a3c5,0x39007ae4,0x83226241,0x51608303,0x83027260,0x72607a80,0x82e19383,0x72608302,0x72205160,0x82809344,0x930182c0,0x93009b41,0x9b837a60,0xb467a3a4,0xd52a9302,0x93428b43,0xac248b01,0x7ae09362,0x8b629bc3,0x7ae17ae0,
-0x9be48301,0x8341ac46,0x5a006aa0,0x830272c2,0x8b228323,0x9bc48b03,0x72407aa0,0x7ae259c0,0x7ae282a1,0x8b436a20,0x9bc36a40,0x72e093c2,0xaca68ba2,0x8b428b80,0x9ba68b41,0x72c18301,0x51e05a20,0x7b277b02,0x206041a0,0x41a330e1,0x39613940,0x31202060,0x208020a0,0x08001880,0x08001000,0x10000800,0x10402080,0x18800820,0x20c01060,0x08000800,0x08000800,0x102020a2,
-0x08200800,0x10410000,0x08000800,0x18601040,0x398220c0,0x39623162,0x29002921,0x31003961,0x314120a0,0x20a02900,0x20c028e0,0x31411880,0x314128e0,0x20c020c0,0x186028e0,0x394120a0,0x4a0441c3,0x49e34a04,0x41c149e3,0x5a2449e2,0x5a435203,0x49e141a1,0x52235203,0x52245224,0x41a15203,0x52235202,0x49e149e2,0x52025222,0x52235243,0x4a235243,0x52234a22,0x39a04a41,
-0x38405100,0x724461c2,0x516082c5,0x49607244,0x30206a84,0x18002020,0x41623921,0x8b038303,0x7260a3a8,0x72416a00,0x7a825160,0x8ae37aa3,0x82a0aba8,0xab84aba8,0x93217a20,0x7a609363,0x8b62bca8,0x392051a0,0xd5a78300,0x6a216a00,0x7ac272a2,0x180030e0,0x62644140,0x30e049c1,0x6a0282c5,0x72445160,0x726459c0,0x30605180,0x41005180,0x6a025142,0x72216a20,0x82e16a00,
-0xa3857220,0x9b676a00,0x61607a61,0x828269a0,0x6a02cccd,0x51203860,0x61a17222,0x61e040e0,0x828469c1,0x82a26160,0x7a6271e0,0x69c0a3a9,0x59a07a60,0x7ae54980,0x61c06a82,0x6a408b04,0x8b2182a2,0x82e27240,0x7a8082e1,0x724082c1,0x7a807221,0x69e082c2,0x93019342,0xb405abc4,0x8ae09341,0xabe5cd08,0x3860c4a9,0xac083060,0x9ba38b22,0xa40482c0,0x9be18340,0x7b008b82,
-0xa3e59ba2,0x72e07ae0,0x6a8072e1,0x8b637301,0x83028b42,0x830172a1,0x6a408b64,0x6a4059a0,0x62209364,0x72807261,0x8b608b63,0x83408b60,0x7ac06a80,0x6200a424,0x8b637280,0x62406a60,0x6ae35a61,0x41807b45,0x18603121,0x10001020,0x41823940,0x31004182,0x310149e4,0x310020c0,0x31412900,0x31413140,0x10401880,0x18800800,0x28c03142,0x290020a0,0x080020a1,0x00000020,
-0x00200020,0x00200000,0x00000000,0x00000000,0x08210800,0x00000801,0x08210000,0x10001020,0x20801040,0x28c028e0,0x31413121,0x39633982,0x28e03961,0x28c020c0,0x188028e0,0x20802080,0x28e11860,0x18a028e1,0x10001060,0x20a02060,0x31412900,0x41c141a2,0x49e349e3,0x522449c2,0x52245204,0x52225a44,0x6ae65203,0x5a6462a5,0x396049e1,0x41a141a1,0x52025223,0x4a035a64,
-0x72848306,0x72417225,0x490238a0,0x10001840,0x82e71000,0x69c08306,0x61a061c0,0x7a40b3e8,0x8ac28ac2,0x724269c0,0x61e05980,0x93047aa3,0x82809324,0xaba4c46a,0x72407a40,0x51804920,0x59c0a408,0x28206a61,0x38a0ee6e,0x41009bc7,0x62405160,0x5a034160,0x08004122,0x39004981,0x59c16a43,0x38c038a0,0x83074940,0x30804940,0x6a455160,0x9bca7264,0x7a844920,0xd4e982a2,
-0x61c06a20,0x69e15960,0x59805980,0x59a15960,0x6a255161,0x49003060,0x40e05980,0x38a04920,0x48e048e0,0x61808ac4,0x93465140,0x5960c48b,0x51a061e0,0x59e049a0,0x6a816a40,0x62007ae2,0x62006a41,0x61e07260,0x72a16a60,0x82a26200,0x6a007220,0x9b239303,0x93018280,0x92e1bc45,0x82c17a60,0x61c059c0,0x8ae5b449,0xc4cabc89,0x93678b46,0x8b449ba5,0x6a208b41,0x8b628301,
-0x7aa082e0,0x9b828b00,0x832182c0,0x83218b43,0x72a08b41,0x8b638b42,0x7aa172a0,0x6a007260,0x83029344,0x51a05160,0x93c36220,0x7280a425,0x4980aca8,0x8be67b42,0x52007b64,0x39204160,0x28e051c0,0x20a03122,0x29011040,0x188020c1,0x52272901,0x20a11020,0x10601040,0x18601020,0x18201840,0x18601860,0x08200800,0x18600800,0x18401020,0x10201000,0x20802080,0x08200820,
-0x10001020,0x10401020,0x20e20800,0x20800820,0x18a02902,0x20c00000,0x08000800,0x10200800,0x18611020,0x18401840,0x08000800,0x10401040,0x188020c1,0x18800800,0x188018a0,0x312228e1,0x31422901,0x18802901,0x28e01080,0x18401840,0x20812081,0x28e028c0,0x28e028e0,0x312028e0,0x49c24181,0x49e341a2,0x5a455203,0x62c662a7,0x6ae76ae7,0x6b086ae8,0x62c65245,0x396162a6,
-0x61c35940,0x18003880,0x7a634940,0x9b868b25,0x8ac47221,0x93047220,0x82a37a61,0x7a4092e6,0x8ac37220,0x59807a22,0x6a016a21,0x8b037aa3,0x82a0a365,0xa363ab87,0x59607a60,0x6a0240e0,0x38a07282,0xa40b7ae1,0x72a28b45,0x726382e5,0x72826a61,0x410159a0,0x30c04100,0xe5b28307,0x494059c1,0x59a14940,0x8b484940,0x51615180,0x51816a22,0x30606a22,0xac295980,0x40a0a3e5,
-0xfed19ba5,0x69e17a62,0x726440e0,0x38804100,0x49214100,0x40e04921,0x51616a03,0x388040e0,0x492038e0,0x59405960,0x51405940,0x61c07a61,0x6a4182a4,0x59e151e0,0x59e06221,0x59a051a0,0x5a2051e0,0x624051a0,0x93648b64,0x61e093a4,0x6a0061e0,0x92e28ac2,0xa3638aa0,0x82809301,0x82a17220,0xa3a35140,0x8ae08ae0,0x40c0abe5,0x9ba651a0,0x7a806a40,0xabe7edd0,0x93429b84,
-0x9b63abe4,0x82a09b63,0x9b638b01,0x8b007240,0x9be482a0,0x59c09be5,0x72807ac0,0x8ae182e1,0x6a6082e1,0x7aa07aa1,0x83208b40,0x6a637ae0,0x30e03920,0x10611020,0x10610820,0x10410800,0x00000800,0x00000000,0x00000840,0x00000000,0x00000000,0x08000800,0x00000000,0x10601881,0x08001040,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x00000000,0x00000000,
-0x00200001,0x08200860,0x08000000,0x10001861,0x20c01020,0x28c11841,0x00000820,0x08000800,0x18601860,0x18201020,0x08001000,0x18800800,0x102020c1,0x08000000,0x00000800,0x00000000,0x00000800,0x18600000,0x28c118a0,0x28c020c0,0x31213121,0x10203102,0x18600800,0x20a028e1,0x28e028e0,0x39613101,0x18803100,0x312020a0,0x522441a2,0x6ae76286,0x62c76286,0x6ae86ac8,
-0x8aa49305,0xa386a387,0x71e07a61,0x7a4282a2,0x8ac27202,0x7a2161a0,0x7a606180,0x92e48262,0x8aa28261,0x62005980,0x82a47a62,0x9b4582a3,0x9b239b24,0x79e0a365,0x72207200,0x7aa29325,0x8b069366,0x49407263,0x61c14920,0x6a227aa4,0x6a635140,0x59a13080,0x728659a1,0x59c140e0,0x61e059c1,0x51805a01,0x938940e0,0x59a15161,0x410059a1,0x49004940,0x8300bcac,0x61e04900,
-0x28807ae1,0x7aa4b48b,0x51c030a0,0x38e04981,0x38a03080,0x40a093a8,0x40e05160,0x388040c0,0x40c040e0,0x61e04940,0x7a815940,0x61805960,0x82e37aa3,0x5a0072a3,0x72836200,0x59e051c0,0x5a206aa3,0x520151e0,0x8b446220,0x7aa261e0,0x82817241,0x9b018aa0,0xa3228240,0xc3e5c403,0x9302a342,0x9b819341,0xc4c4abc0,0x40c09342,0x6200ac27,0xd52be5ae,0x8ae07a80,0x69e09323,
-0x9b437a60,0x61a07aa0,0x7a607a61,0xabe3ccea,0x72609b60,0xa3c64080,0x7b0159a0,0x8b427aa1,0x8b427ac1,0xac25a3e6,0x72e09be3,0x6ac820c0,0x206149c5,0x20e330e2,0x08000000,0x00000000,0x000018c3,0x00000000,0x00200000,0x08610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x00000840,0x00000000,0x08001000,0x08001000,0x31221020,0x18c028e1,0x20a020c0,0x18401860,0x00001880,0x10600800,0x10600840,0x10400800,0x00000000,0x08000000,0x08000800,0x10401020,0x312028e0,0x41a328e0,0x20e039a2,0x28e02900,0x29003120,0x28e03120,0x29003141,0x20c01860,0x49e428e0,0x6b076ae7,
-0x82a18ac2,0x7a417200,0x7a8282e4,0x48e082c3,0x69c09305,0x93258aa3,0x72619b26,0xc48c59a0,0x69c06a01,0x59c07241,0x7a636a00,0x8ac37a82,0xa3449b24,0x8aa2a364,0x72217a21,0xabcaa3a8,0x594048c1,0x59a061e0,0x49204920,0x59804100,0x410061e1,0x494059c1,0x49604100,0x6a425160,0x6a015180,0x51405140,0x6a447264,0x62222820,0x49404940,0xfef66a22,0x41034980,0x7b205a00,
-0x30c02880,0x62441800,0x51c172c7,0x30a03900,0x282072a7,0x724340e0,0x6a0259a2,0x51607ac4,0xbca89342,0x9b868284,0x69e069e0,0x7ae35980,0x8b8551c0,0x49c05200,0x41805201,0x5a4151c0,0x49c05a20,0x5a215220,0x52005a40,0x8b4372c1,0x72409344,0xa3629302,0x8a80b3c4,0x92e0ab83,0x72408260,0xc484b403,0xcd06b402,0x59a07240,0xfe909324,0x9bc06200,0xa3e58b40,0x7220a3e5,
-0x82619323,0x8b0282a2,0x8ae17241,0x8ae082a0,0x8b02abe3,0xa3c79346,0x62037a82,0x61e17ac5,0x10005a01,0x72e27b23,0x20609be6,0x52044161,0x18200800,0x10201000,0x00003962,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08001020,0x10201020,0x00000800,0x00000000,0x00200000,0x08200000,0x00000841,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000000,0x18600840,0x20801860,0x00000800,0x08000820,0x10000000,0x28e20800,0x000020a1,0x00000800,0x08000000,0x00000800,0x08000800,0x08000800,0x20c11020,0x31011860,0x28c13962,0x08001000,0x28e120a0,0x184020a1,0x18401020,0x10000800,
-0x69e09303,0x6a218281,0x82a561e0,0x598059a0,0x72217280,0x6a207201,0x598059c0,0x51205100,0x69e06a00,0x6a007261,0x6a4261e0,0xa3a782c4,0xa344aba6,0x8280a365,0x722248c0,0x59825120,0x59e09347,0x51005100,0x6a007aa3,0x492059a0,0x51407264,0x41005960,0x51605181,0xff176a02,0xa40a8348,0x59c059c0,0x59a15120,0x51605160,0xac2a7262,0x38e04900,0x306159c2,0x412159a2,
-0x62415a01,0x30c0a44a,0x390051c0,0x20204120,0x38e02860,0xa42a30a0,0x59804100,0x51406a01,0x38604920,0x69c17ac0,0x7a4161c0,0x49808b62,0x732449e0,0x49c041c0,0x520049a0,0x5a206240,0x5a405a20,0x5a007b43,0x51e06aa0,0x724051c1,0x9b648ae0,0xaba58280,0xab819b00,0x7a608281,0x9b40bc45,0xcca4c465,0xc4a68ac0,0x82e18ac0,0xa3e28320,0x93609381,0xabe59b83,0xa386b427,
-0x82c37aa2,0xa3c55100,0xb3e7b427,0x9301b429,0x82a28260,0x62019326,0x28608b48,0x10002860,0x72c682e6,0x41803940,0x18005a05,0x28c00800,0x7b0a72e8,0x39026246,0x08000800,0x396520c2,0x10200800,0x00002104,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x10600000,0x00000800,0x00000000,0x00200000,0x20e30000,0x00000000,0x00000840,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00200841,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x29221060,0x18a01060,0x186018a0,0x28c01860,0x18602080,0x20802060,0x10201020,0x10001000,0x10410000,0x08000800,0x08000000,0x20e02921,0x10411020,0x394230e1,0x292239a2,0x39a10860,
-0x72018aa3,0x9367bc4a,0x8ae661c0,0x8b257a82,0x51407222,0x59c04900,0x6a2161e1,0x9b888b27,0x72217a82,0x61c07221,0x72626a20,0xabc78b25,0xb3c6a3a6,0xa386a364,0x7a84ccee,0x61e04900,0x51807aa4,0x59605960,0x8ae47242,0x62006a22,0x82e259a0,0x7a814100,0x82e3a405,0x72812840,0x72207a41,0x59805120,0x62026a00,0x51607a85,0x7ac45980,0x51a04920,0x41404941,0x72c44980,
-0x51a04120,0x7b0572c4,0x390038c0,0x28602840,0x38c22000,0x30612840,0x40804921,0x6a0040c0,0x51007201,0x61809326,0x59605160,0x52006200,0x628349e0,0x6aa241a0,0x834572e4,0x62405a20,0x626072e3,0x51e049a0,0x8b646a80,0x8ae25a00,0x8b009b64,0x8aa069e0,0xc4069b00,0xa3629b20,0xa3a2a382,0x9b60b423,0xac017a40,0xb423a3a1,0x8320ac04,0xb4e88361,0x30a049a0,0x49605180,
-0x8b265140,0x62004120,0x830459a0,0x61c059c0,0x61c07a82,0x518072a2,0x5a023900,0x6a844981,0x62856223,0x28a11840,0x18001020,0x31440800,0x08002902,0x00000800,0x00200000,0x00000000,0x08200800,0x104020a1,0x10201860,0x08201860,0x10000000,0x18201840,0x00000800,0x000020a2,0x29240000,0x52690000,0x41844a06,0x08002080,0x00000000,0x08000800,0x106120c2,0x398539a5,
-0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18601060,0x18601020,0x10600820,0x28c11840,0x208020a0,0x18601060,0x10601860,0x106020c1,0x10600000,0x00001041,0x00000000,0x20a20800,0x080028e2,
-0x8ac57a22,0x596071e1,0x512082a6,0x512048e0,0x72862800,0x7aa459c0,0x51804920,0x82c59ba9,0x6a2161e0,0x72627242,0x72626200,0xac089346,0xb3c6a365,0x51409b21,0x49004920,0x40c06a04,0x726140c0,0x61c15980,0x514082e4,0x82e36a42,0x934493a3,0x7a63c4ca,0x82e37a80,0xa4089b8b,0x286069e3,0x72219b64,0x61c069e1,0x51607aa5,0x59c05180,0x6a6159c0,0x41006a42,0x728451a0,
-0x49c051e0,0x62613920,0x5a0030a0,0x38e14943,0x286030c0,0x38c038a0,0x40c040e0,0x72206a01,0x40a05940,0x8b01a405,0xd545dda7,0x7b2293a5,0x524041a0,0x51e049e0,0x49805200,0x5a206240,0x6ac16260,0x72e25a20,0x622059e0,0x8b236a40,0x69c069a0,0xc4689b62,0xb3a1a340,0xab81b3e1,0xa3818aa0,0xabc561a0,0xccc79b42,0xaba07a60,0x7ae0b426,0x08001000,0x206130e3,0x416030c0,
-0x6a644960,0x59e059e1,0x5a224120,0x494049a0,0x388059e1,0x30806202,0x72e759c2,0x38e01800,0x414051a1,0x310341c2,0x394320c0,0x00200000,0x21020020,0x08001060,0x00001041,0x00000000,0x00000000,0x08410020,0x00000000,0x08000000,0x10211020,0x08000800,0x18406267,0x18801020,0x21033185,0x10600861,0x08405227,0x00000821,0x00000000,0x08000800,0x00000800,0x39841020,
-0x39842902,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08201061,0x00000000,0x08400820,0x20a01840,0x10201860,0x290118a0,0x08200800,0x18a020c0,0x18a11060,0x18a00800,0x10000800,0x10201880,0x08002080,
-0x6a018ae5,0x59607221,0x6a0261c0,0x8ae47243,0x8b057a62,0x61e061a0,0x72236a21,0x7a419beb,0x72217200,0x72627242,0x7a848305,0x9b858ae5,0xa3659b23,0x7a829b22,0x59a051a0,0x8b474100,0x59605980,0x61a07222,0x59c15140,0x59c07281,0x82a44920,0x82e2c4ec,0x51018b24,0x6a003860,0xa3e6b429,0x82a282c3,0x61c09365,0x40e07a84,0xb4485180,0x61e06a00,0x62007aa3,0x72848305,
-0x6a8372a3,0x51e05a20,0x51804120,0x412051a0,0x38a038e0,0x30a02020,0x48c038c0,0x7a827201,0xbc877220,0x61a08ae2,0x69a03040,0x51e038e0,0x49c05201,0x5a205200,0x52005200,0x730349e0,0x62806240,0x59e07b01,0x6a206a61,0x82e26a00,0x9b436a20,0xa3a37a40,0x9b409b61,0x8280bc26,0xcce8cca7,0x9b6171e0,0x7a207a40,0xff51bc44,0x30e030a0,0x39403100,0x28c11000,0x28c05224,
-0x41203900,0x28604980,0x39014121,0x390138c1,0x41413901,0x08003901,0x18211840,0x08001820,0x18801000,0x31231040,0x10601000,0x00000000,0x08000800,0x00000800,0x08202943,0x00000000,0x08000000,0x08000000,0x08000800,0x00000000,0x18810800,0x20c120a2,0x28c12901,0x08001041,0x00200000,0x00000000,0x00000000,0x00000000,0x08000000,0x18201820,0x31023143,0x08001880,
-0x00000000,0x00000000,0x000018a2,0x10810000,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000821,0x00000000,0x00000000,0x08000820,0x08200000,0x10400820,0x106020c2,0x08000800,0x08000800,0x20a228e3,0x20e21040,0x18802081,0x102020c0,
-0x61a07a42,0x59805100,0x8ae461c0,0x72427220,0x596082c5,0x72015100,0x9b897201,0x82a3a40b,0x61807221,0x61a07221,0x72437283,0x934482c4,0xa3869322,0x20009b43,0x28202020,0x41204941,0x6a024920,0x51407222,0x49405180,0x7ae161e0,0x726059a0,0xa3e6e5eb,0x7aa26a01,0x40c06a00,0x724061c0,0x93237aa0,0x61a05100,0x598061c1,0x7aa09362,0x6a6082e1,0x28608b43,0x51614940,
-0x49604940,0x49605a01,0x49205180,0x83465160,0x304038e0,0x38e038a0,0xee0a4900,0x9322e5cd,0x93225960,0xf66d7a80,0xfeaf6a20,0x7b216a61,0x5a205200,0x520049e0,0x5a6051e0,0x5a2062a1,0x6aa15a40,0x52005200,0x7ac259e0,0x8ae27220,0x9b018ae0,0x8ac0b3c3,0x9b22a3a3,0x9301bc46,0x7200bc26,0xabc08ae0,0xb422abc1,0x4140a3a0,0x49c341a2,0x10003101,0x18401880,0x10401880,
-0x30e03921,0x6aa73120,0x18202060,0x41832060,0x51e449a3,0x392328a0,0x10002060,0x00003103,0x00000020,0x00200000,0x00000821,0x28e30000,0x314428e2,0x18800800,0x08001020,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001061,0x00000000,0x00000000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,
-0x00000800,0x00000000,0x00000000,0x00000821,0x00000000,0x18a10000,0x082028e2,0x00000000,0x00200861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200800,0x000018a2,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x20c10820,0x08000000,0x20810800,
-0x61a061c0,0x61c061a0,0x8b247241,0x93277aa1,0x61c169e1,0xa3a861c0,0xc4ef61c1,0x82a382c5,0x61c06a21,0x51805160,0x6a636a23,0x9b658b05,0xabc89b64,0x5120a364,0x20001820,0x38c03080,0x40e04940,0x69e07222,0xff346a01,0x9345fe92,0x72407aa3,0x59c05960,0x40e061c1,0xfeebddc7,0x596038a0,0x49206a20,0x6a2072a2,0x93878b43,0x49205180,0x69e082e4,0x51604940,0x61c35160,
-0x51e051a0,0x496061e1,0x494051a0,0x49004120,0x51a069e2,0x28402840,0xccebcd0a,0xa3e4b463,0x490059a0,0xc4c861c0,0x7aa05160,0x59c06a20,0x62606240,0x72c27323,0x52006240,0x5a606260,0x7b2349a0,0x5a205a40,0x61e082e2,0x7a606200,0x82809b62,0x9b419b61,0x6160c487,0x8ac182c0,0xd52bd509,0xb3e0d4c3,0x51209b21,0x28e09364,0x08201060,0x00000000,0x08200000,0x08200820,
-0x08000800,0x18a10800,0x00000800,0x08200800,0x18600000,0x52273144,0x834b6288,0xac6e51c2,0x10001000,0x00005288,0x08400000,0x00000000,0x08000000,0x28c21861,0x08001000,0x00000800,0x18a20000,0x10200800,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000841,0x00001061,0x08610000,0x08410000,0x10610000,
-0x10610800,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x084018a2,0x08400000,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x18c20000,0x00000000,0x08000800,0x00000800,0x00000000,0x00000000,0x20a01060,
-0x7a423840,0x38605960,0x93438b23,0x49009363,0x82a361a0,0x72428ac4,0x512048e0,0x518059a0,0x494059e1,0x41204980,0x6a636a43,0x9b858b05,0xabc7abe6,0x61a0ab64,0x390030a0,0x414030c0,0x61c26203,0x516059a1,0x93244900,0x59a0bcaa,0x726261c0,0x724182e3,0x61c061c0,0x62208300,0x8b02b468,0x72416a01,0x51607283,0xb46b6a20,0xfeb06a21,0x9ba37a80,0x3880b4a8,0x9be49b69,
-0x6a6359a0,0x51a04960,0x49605180,0x38804120,0x7aa14900,0x938048e0,0xdd8b6160,0xac029b81,0x9b6561c0,0x618069c0,0x7aa08301,0x61a08b03,0x62408b43,0x52006a80,0x62205a00,0x62208343,0x72c16240,0x62007ae1,0x7aa07a80,0x9b639323,0x7a6082a0,0x8aa18b21,0x9b629b42,0x9b6282c0,0x8aa07a40,0x61c09b20,0xac659361,0x1860ff33,0x08400000,0x00000000,0x00000000,0x00000000,
-0x08000800,0x10400820,0x10201040,0x08411041,0x08200820,0x10000000,0x20401000,0x51c23900,0x2020b4cf,0x5a4449e5,0x4a073101,0x00000000,0x08000000,0xb55420a2,0x08001040,0x00000820,0x08201061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x08400000,0x39853164,0x18a32924,0x08001041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x08400000,0x29040840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001082,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x18410800,0x00000000,0x00000000,0x00000000,0x00000000,
-0x598061e0,0x72406a00,0x722161c0,0x828292e3,0x50e09324,0x69c07a41,0x59a06a21,0x7a627ac3,0x49606a22,0x41004940,0x7ac66a44,0xa3a582e4,0xb3e6bc06,0x61c0a362,0x28002880,0x40e04922,0x516059a0,0x59c159a0,0x596161a0,0x61c07241,0x7a6261a0,0x69e07a82,0x4920abe9,0x59a07282,0x518059a0,0x6a217aa3,0x494082e5,0xbccc6a63,0x59a082e3,0x49605180,0x51808306,0xff0f82a3,
-0x59804940,0x6a0082c5,0x51806a41,0xac0459a1,0xdd6c5960,0x82e0f62e,0x7260b446,0x40c05960,0x59809325,0xcd0a61e0,0x61c0fecf,0xcd4a7220,0x6240b4a8,0x7b027281,0x51c072e2,0x62206240,0x82c182c2,0xccea82a2,0x72209382,0x62005980,0x82e28301,0x72007aa1,0x6a008280,0xb40582c1,0xeda9d529,0x61c0c4c4,0x41801800,0x206051c3,0x080020a0,0x31211040,0x20a03101,0x28a12080,
-0x28c12080,0x18201840,0x08002020,0x00000000,0x00000000,0x08001840,0x30c00000,0x41401020,0x93ab30c0,0x10403101,0x6ae70800,0x41204960,0x7b0659e1,0x08203941,0x00000800,0x00000800,0x08200000,0x10420000,0x00001082,0x10610000,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18e30000,0x00002965,0x00000000,
-0x00000000,0x00000000,0x08200000,0x00002945,0x08201081,0x00001061,0x106028e3,0x08001020,0x08001000,0x18a21820,0x00000800,0x00000000,0x08000000,0x00000000,0x00000020,0x00000000,0x00000000,0x18610000,0x18601020,0x08201000,0x00000000,0x00000000,0x00001062,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000821,0x00000000,0x10200800,
-0x7a636180,0x69e069c0,0x61806180,0x720069c0,0x69e08262,0x930469e0,0x72437a82,0x59a061e0,0x5a005180,0x00002060,0x7a837263,0xa3a58b45,0xb3e6ab64,0x69e19301,0x61e161e1,0x51404900,0x59a140c0,0x72618306,0xb4496a21,0x7aa25140,0x9ba761c0,0x69e05960,0x59a061c0,0x728159a0,0x514048e0,0x494059a1,0x494061e1,0xac286a42,0x83029363,0x61c05160,0x6a4161e1,0x38603020,
-0x51806a41,0x61c04900,0x93657240,0xcd0aac07,0x9b849305,0x59605980,0xee0d8b22,0x61c09b85,0x82c39365,0x7a6240a0,0x7a606180,0x8b42e5ac,0x7ac359e0,0x62006a41,0x72607ac2,0x72607260,0x72406a00,0x72207a20,0x9b429342,0x93019323,0x61a07260,0x93027240,0x93237a40,0xa3857a40,0x49206220,0x20604980,0x7b0730c1,0x28801800,0x39612040,0x28e128c0,0x080028e1,0x28a11000,
-0x5a2351a3,0x93ca72c6,0x20406226,0x08001840,0x08001000,0x20610000,0x41421820,0x20603940,0x1820a4ae,0x28c11000,0x41810000,0x7b063900,0x6a624120,0xad116ac5,0x080041a4,0x00000000,0x08001000,0x00000800,0x18800000,0x5a8762ea,0x5a883983,0x31026b0a,0x00003122,0x08000000,0x29030000,0x08001881,0x00000000,0x00000820,0x10820000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x5aa82923,0x000049c7,0x102028c2,0x00002903,0x00000000,0x00000000,0x00000000,0x39a50820,0x10403165,0x20e30820,0x00000000,0x08200820,0x000018a1,0x08000800,0x00000000,0x10610000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x080020a2,
-0x72407a60,0x72209b46,0x93267a61,0x720169c1,0x93057220,0x61c07a81,0x516269e1,0x100028a0,0xdd4e38e0,0xb40bbc8b,0x7aa27a82,0xb40782c3,0xb3e7aba5,0x61c0ab63,0x7aa35180,0x6a436201,0x7ac582c5,0x61e05180,0x93246201,0x61c07260,0x7aa17201,0x51407a81,0x6a007240,0x59a061e0,0x59c06a20,0x8b436a41,0x59a061c0,0x9b855980,0x61e0ac09,0x59a059a0,0xb4865160,0x61e07aa3,
-0x8ae37200,0x62006a01,0x40c08ae4,0x7a60ddaa,0xbc67dd6a,0xac25abe9,0x61c07a60,0x9b8269c2,0x59605120,0x61a069c0,0x724061c0,0x61e07240,0x51a06a22,0x72604960,0x7a407a81,0x722061c0,0x8ac38ac2,0x82a08280,0x93008aa0,0xabc39b40,0x6a206a40,0x82c18b22,0x82c1a3c5,0x69e082a2,0x38e059c0,0x38e04120,0x412051a2,0x41415182,0x418130a0,0x20401840,0x51e51800,0x62660000,
-0x51a04100,0x49406200,0x38e051c3,0x38e04120,0x204038c0,0x28a0ac8c,0x208049a3,0x18800800,0x20601000,0x08001000,0x496118a2,0x38c05181,0x82c36a23,0x310272c2,0x18602080,0x314120a1,0x41832080,0x10003922,0x5a051801,0x39222020,0x31011040,0x49a34983,0x39223100,0x28e141a4,0x398428c3,0x6ac83901,0x080030e1,0x08000001,0x18e20000,0x00000000,0x00000000,0x00010000,
-0x00000800,0x00000041,0x10a20000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000001,0x10400040,0x00000000,0x08400000,0x00000000,0x00000000,0x08000000,0x20c20800,0x00000820,0x00000800,0x00000820,0x00000820,0x000018c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,
-0x72228ae5,0x61c069c0,0x7a607a60,0x82837201,0x722169e0,0x49606180,0xc5102860,0xabe8abea,0x82c4c48b,0x514059a0,0x7a826a00,0xaba69345,0xb3e7aba5,0x61a0ab83,0x6a2159a0,0x6a226a21,0x51606a02,0x620059a0,0x82c55140,0x51208ae4,0x7a655100,0x9ba461a1,0x7a827aa1,0x7aa1ac07,0x516061e0,0x9be36a40,0x59a07a60,0x6a0069e1,0x59a07a81,0x7a816a20,0x8ae35980,0x82a169c0,
-0xabe282c0,0x8b038b20,0xd50a5960,0x8ae07240,0xf66e7a60,0x9324feb1,0x6a2061a0,0x9ba55960,0x61c05160,0x6a0082a1,0x82c06a00,0x51609343,0x51605981,0x59805160,0x69e06a21,0x69e07220,0x93038aa2,0xa3839301,0xa3a39300,0x9b42a384,0x7a808b02,0x72406a20,0x8ae29323,0x7a627a61,0x83057261,0x622259e0,0x518151a1,0x39004940,0x51c26224,0x20605a04,0x39001800,0x38c06244,
-0x28405161,0x49801800,0x39016a83,0x30a07b09,0x18004140,0x41204960,0x39221800,0x10017b2a,0x100049e7,0x08000800,0x51c20000,0x38c061e2,0x61e338e0,0x51e2a40a,0x5a234140,0x6aa372e6,0x51e15a20,0x62452880,0x28a04122,0x202038e1,0x18002060,0x51e31000,0x5a2649a3,0x310128c1,0x28e11000,0x184030e1,0x186028a0,0x000018a0,0x00000000,0x00000000,0x00000000,0x314220a0,
-0x20c03121,0x00003162,0x08400000,0x00000000,0x00000000,0x00000020,0x00200000,0x00000020,0x41e60000,0x10602902,0x08210000,0x08200000,0x00000000,0x00000000,0x00000000,0x10400800,0x10610820,0x000018a2,0x00000000,0x00000000,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xa3889b47,0x72408ae4,0x7a419b67,0x61a061a0,0x82a35960,0x9b689b67,0x9329abe8,0x10202000,0x72261800,0xb4cacd6f,0x7a6361a0,0xabc69b65,0xb3e7bc27,0x61c0a343,0x494059a0,0x59a06201,0x59a06a21,0x51805180,0x72605180,0x9b658282,0x59808b03,0x726082e1,0x598040a0,0x620082c3,0x7ac06a40,0x82c09340,0x5980a3a4,0x61a09343,0x9340ac25,0xc4c59340,0x7a21bc83,0x8ae09b23,
-0x8b009b80,0xb4228ae0,0xa3809b60,0x8ae0ccc4,0x8283abe4,0x72205100,0x61c082c1,0x596082e1,0x6a2061a0,0x6a007240,0x8b207a61,0x59c069c0,0x6a0059e0,0x7a807261,0x82a17aa1,0x7a617240,0x82a27a41,0x8aa08aa0,0xabc5a386,0x72809b42,0x59a08b22,0x93437aa0,0x72407a80,0x82a382a2,0x8b029323,0x412093c6,0x62024120,0x6a636a63,0x498151c2,0x62246244,0x59c230a0,0x8b0461e0,
-0x30606a40,0x6a6459c0,0x62622880,0x62434120,0x51602880,0x728459c0,0x5a412000,0x28e051c1,0x00001860,0x00003122,0x6a850000,0x410059a1,0x82c659e2,0x8b477261,0x7ac57284,0x6a6259a1,0x6a207ac2,0x82e48304,0x72a37261,0x51626a44,0x51e16a88,0x51e54181,0x41635a25,0x28a02040,0x28a030c0,0x28a02020,0x41814160,0x52253982,0x20e12901,0x31832922,0x18810000,0x49a330e0,
-0x30e04982,0x000028a0,0x7bef0001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000021,0x4a270040,0x00001060,0x08200000,0x00000000,0x00000000,0x00000000,0x20a20800,0x5aa90000,0x00003144,0x5acb0840,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x7a816180,0x8ac2a365,0x49007a60,0x8b0382c2,0x83249b85,0x10003060,0x9baa1840,0xb409a3ea,0xa388d50e,0x200038e0,0x6a2259c0,0xabe78b04,0xb3e7bc68,0x6a00b3a5,0x6a427ac5,0x492059e1,0x518051a0,0x51814120,0x72435160,0x51007a23,0x620040c0,0x6a2161e0,0x61c06a00,0x59607242,0x82e09ba1,0x8b20ac22,0x72607a60,0x8b009340,0x5960b444,0x932061c0,0x9320a3a4,0xa3a1bca5,
-0x9b808b20,0x72207240,0x82a09320,0xa3a461c0,0x7a617a40,0x6a006180,0x61c09343,0x72806a00,0xac039321,0x82a07200,0xedea9b40,0x82c082c0,0x7241a3c6,0x6a007220,0x6a007a60,0x82c06a00,0x9b2192e1,0x82808ac1,0x9b228ae0,0x7a808b22,0xb4279302,0x9ba48280,0x722069e0,0x934582e1,0x6a207240,0x59c082e3,0x59a06a21,0x49404900,0x49604940,0x30a038c0,0x41206205,0x9b648ac2,
-0x6a009324,0x59e17aa1,0x5a0251c2,0x83077ae5,0x8b249be8,0x62227263,0x308072a6,0x62032860,0x59e47b07,0x08001800,0x72854985,0x30606204,0x72647283,0x82e47aa3,0x7aa482e4,0x59a07283,0x61e082c2,0x620259c0,0x72816220,0x498151a2,0x518351c2,0x41204982,0x416151c3,0x49823920,0x41623901,0x18402080,0x834b6aa9,0x31213101,0x41a33142,0x10203141,0x28e028c1,0x39405a45,
-0x39213900,0x20c22080,0x10410840,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x10600800,0x00000840,0x00000000,0x002018a2,0x00000020,0x00200000,0x00000000,0x10600000,0x08000800,0x5a883984,0x52481861,0x00001881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x31850000,0x20c220e3,0x00000000,
-0x93239344,0x69e48b46,0xcd0d6a85,0x1800bc67,0xdd502040,0x8aa7b42b,0xb46c93a3,0x10002880,0x41620800,0x93897b06,0x72a46a22,0xabe88b06,0xa385c46a,0x6a20ab44,0x492059c1,0x61e16201,0x51806222,0x51605140,0x82c259a0,0x61e07241,0x59a159e0,0x7a8159c0,0xcccc9341,0x8280b422,0x82c09341,0x722082a0,0x82c169e0,0x9b419ba1,0x8b008ae2,0xa3a27a80,0x9342ac04,0x7220cce9,
-0xa3c66a00,0xa3c57a60,0x72209301,0x72209b82,0xcce982c0,0xa36282a0,0x82a08ac0,0x82a07a60,0x8ae08ac1,0x9340a3a0,0x82c08ae0,0x72407ac0,0x72207a60,0x8ae182c1,0x7a607240,0x7a607240,0x8280abc4,0x7a609302,0xa3227a60,0x93448301,0x69c08aa1,0x93438281,0x8b037a60,0x93038ac0,0x726182c1,0x82e37261,0x72605180,0x516061e1,0x72615980,0x62007aa3,0x72615140,0xc4a9c4aa,
-0x72209b85,0x938482a0,0x6a428b43,0x7aa561c1,0x72824900,0x72428303,0x7aa57ac2,0x72c44980,0x30806201,0x59a07aa3,0xd5d19366,0x51a059e1,0x61e14960,0x59c06a20,0x51406a21,0x51a059a0,0x59a07242,0x51616203,0x7ac46a60,0x51c14140,0x49a030c0,0x620430a0,0x416030e0,0x49822880,0x39212860,0x49836a86,0x49841000,0x18202060,0x31221020,0x28e15226,0x10003964,0x41616a86,
-0x39413900,0x20a020a0,0x4a270000,0x08410000,0x00000000,0x00001082,0x00000000,0x00001061,0x290318a0,0x08610800,0x00000000,0x00000000,0x08200000,0x08200000,0x00000800,0x00000000,0x00000000,0x10200000,0x08401060,0x00000000,0x39850000,0x08200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21240000,0x41e72924,0x18a20820,0x08201020,
-0x10021803,0x49232060,0xc50c49a2,0xa388e5ce,0x93477b01,0x20403040,0x6a470800,0x72868b89,0x6a649beb,0x72c62040,0x72836a42,0x9b448ae4,0xa344a345,0x61c0a343,0x59e07a84,0x6a226200,0x59a07263,0x72625980,0x69c07241,0x62006a21,0x59c061e0,0x6a4059c0,0x512082e1,0x9b838ae4,0xb44582c0,0x72408b21,0xbc667240,0x7aa08300,0x7a808302,0xa3a49b62,0x8b016a00,0x72208b20,
-0x59806a20,0x61a069c0,0x7a6182a0,0xbc25a386,0xa360a382,0xbc029b20,0xac01dda4,0x7a607a60,0xa3e19320,0x9b6082c0,0x61c09361,0x72607a80,0x82c07240,0x82c18ae0,0x69e07260,0x8ac082a0,0x82a07a40,0x7a609301,0xa3c49b83,0x59808ac0,0x59808b03,0x7a818282,0x8ac37a41,0x59809b85,0x82c38ae4,0x7a8261e0,0x6a2182e4,0x69e059c0,0x7a627241,0x9326ac07,0xa3c67200,0x9b437200,
-0x726182a2,0xabe6b407,0x6a407a60,0x518061c1,0x92e64960,0xa3849342,0x59a09323,0x516059a0,0x726559c1,0x83259c0b,0x6a6261e3,0x61e16200,0x7aa37a83,0x720082e3,0x832582c3,0x728082e4,0x6a417aa3,0x28002840,0x59e04960,0x72a56a83,0x72c759e3,0x49804140,0x41404981,0x30c051c2,0x5a044141,0x49a16aa7,0x18002060,0x28c03900,0x52671860,0x41e50800,0x51e449c4,0x39213921,
-0x39623900,0x20c120c1,0x28e10000,0x31633143,0x31655267,0x000039a6,0x00000000,0x00000000,0x00000000,0x41e70000,0x00000000,0x00000000,0x00000861,0x00200020,0x20e21020,0x29032903,0x00200860,0x00000040,0x00000000,0x08200000,0x20c220a2,0x00000000,0x10600000,0x00000000,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4a073144,
-0x8b068ac5,0x6a848348,0xd5b04941,0x7aa2ac66,0x93a81001,0x8b2793c9,0x93899b88,0x30a04941,0x28604100,0x51806a42,0x6a4251a0,0x9b659b66,0xa3a5aba6,0x51209322,0x59a059c0,0x61e07242,0x6a2059a0,0x6a2069e0,0x82a28ae3,0x722061c0,0x69e061c0,0x92e16a00,0x6a009322,0x7aa069e0,0xa3c482e0,0x8b2182c0,0x82c07a60,0x82c09340,0x82a09342,0x62008b02,0x61e07aa3,0x724159a0,
-0x59a059c0,0x9b837a60,0x93227a40,0x932082c0,0x92c39300,0xaba192e2,0x7a4192e0,0x8ae09321,0x9342cd08,0x6a207260,0x724082c2,0x93427a80,0x72007a60,0x82e0a3c3,0x82807aa0,0x82c0a3c4,0x9b8282c0,0x82808280,0x82a09b61,0xb409a385,0x7a6161c0,0x50e07a62,0x72415120,0x51207a61,0x61a082c3,0x6a007a82,0x62008304,0x8b257262,0x7a4269e0,0x59407200,0x9b65a3c7,0x93249303,
-0x93654900,0x62007282,0x728182e2,0x72608303,0x7a606a00,0x93238ae1,0x7aa26a00,0x51607283,0x412059a1,0x596040e0,0x412069e0,0x7aa44940,0x51606a42,0x7a627a81,0x72837a62,0x61e082c4,0x726361a0,0x6a432800,0x62216a23,0x51c051e1,0x49806223,0x414030a0,0x51c251e2,0x624449a2,0x51c251e3,0x59e16224,0x30c059e3,0x39214162,0x20a028a0,0x49c31000,0x30e128c0,0x39015a25,
-0x10000800,0x49c449a3,0x39621860,0x10600800,0x31235ac9,0x39a50800,0x000020e2,0x00000000,0x00000000,0x29240000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31a520e3,0x394328e2,0x20e35227,0x00000000,0x00000000,0x00000000,0x00000000,0x08000840,0x080020a2,0x10600000,0x10200000,0x10610800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,
-0x20201800,0x40c03860,0x9bc840e2,0x9be7ee73,0x59c36202,0x100030a0,0x200030e2,0x496059e1,0x51605160,0x51c04980,0x7aa46a22,0x9b859345,0xa3659b24,0x61c07a40,0x720161c0,0xabe77a62,0xa3869345,0x8ae26a00,0x8b227a80,0x72208280,0x8aa082a1,0x82a0abe1,0x82c17200,0x82e07a60,0x72409341,0x8b008b00,0xcce59340,0x7a4092e3,0x72407280,0xac2961c0,0x59c17aa3,0x59a059c0,
-0x61c07240,0x82e15960,0x69a05140,0xb4238240,0x9b2082a0,0x92e07a40,0x61c092e1,0x82a282c1,0x722169c0,0x72206a00,0x8ae082a0,0x82c08b00,0x93218280,0x82c07240,0x93427a80,0xa3a47220,0x8ae09b82,0x7a609b82,0x69e08ae1,0x7a807200,0x72417261,0x69c15140,0x82a37201,0x61a069e0,0x7a218ae3,0x7a617a60,0x61e06a40,0x69e07242,0x61c06a21,0x828369e0,0x93058ae4,0x8b456a60,
-0x620059c0,0x62007262,0x7ac282e2,0x728072a1,0xa3c4a362,0x61c06200,0x72214920,0x82c66a01,0x49407ac5,0x38c06a42,0xddd2ac49,0x62023080,0x40c059e1,0x72807aa2,0x59a061e0,0x6a4059c0,0x7ac47ae4,0x51a172a6,0x49a05a21,0x412059e0,0x624451a2,0x83284961,0x5a2472e7,0x41606225,0x49804981,0x49606a24,0x59e251a2,0x39204140,0x39624123,0x18609c6e,0x102028c0,0x39011820,
-0x31001800,0x49822080,0x51c33921,0x312151c3,0x104020a0,0x080020c2,0x00000000,0x10403122,0x10601862,0x29240001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18810800,0x52271040,0x62881040,0x08001881,0x00000000,0x00000000,0x08200800,0x08000800,0x41a50820,0x10210000,0x31233964,0x10400000,0x41c62923,0x000018c2,0x00000020,0x00000000,
-0x82e37a62,0x7a858306,0x20005183,0xa3c8d570,0x8b267a85,0x7a838306,0x8b447aa3,0x8b038b44,0x51408b04,0x622338e0,0x728461e1,0xa3a69b86,0x9b44a365,0x61a08260,0x69e061c0,0x82a17a61,0x82a17220,0x72407a81,0x7a407a40,0x826071e0,0x8ac08280,0x8ae0a3c1,0x7aa0a3a2,0x6a007aa0,0x7a808b22,0x7a609ba2,0x69e07a40,0xa3c48ac0,0x6a207240,0x59a072a2,0x596059a0,0x59807221,
-0x69e07aa1,0x6a009344,0x9b637261,0x72209301,0x82a07220,0x82808b00,0x82c09320,0x72009362,0x6a007220,0x8b2082c0,0xa3a28b20,0x8ae08ae0,0x9b8182a0,0x82c09ba1,0x82c08b21,0x82a09b41,0x932082a0,0x8b017a80,0xa3a582a0,0x7aa37a61,0x51407a63,0x69c069e2,0x69e08ae4,0x82a261a0,0x720082a1,0x7a627a81,0x82c59325,0x722161c0,0x7a627a62,0x59805960,0x38a04900,0x61e05980,
-0x72837242,0x82e482e5,0x82e26200,0x72608b23,0x8b019b42,0x61e069e2,0x72626a00,0x61a05120,0xac0961c1,0x6a2359a0,0x7ae559c0,0x494051a1,0x518251a1,0x518059a2,0x620159c1,0x49209366,0x518072a4,0x30c06a65,0x49623080,0x49815a02,0x62244141,0x62246244,0x414059e3,0x30c051c3,0x5a242060,0x20208329,0x59e36246,0x41614140,0x39002040,0x72e83921,0x31005204,0x5a251820,
-0x49a349a3,0x20401840,0x5a0428c0,0x31004982,0x41414181,0x30c051c3,0x39415a44,0x312251c3,0x29221000,0x41850820,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x000018e3,0x00000000,0x10600000,0x31232101,0x00004a28,0x00200000,0x00000000,0x00000000,0x312220a1,0x10203965,0x08000800,0x08000000,0x00000000,0x210320e3,0x292341e6,0x20c23985,0x00000800,
-0x5a0072a1,0x620059e0,0x51624120,0x9325abca,0x6a2061a1,0x72605180,0xa3a97aa2,0x69e07220,0x51208281,0x620330a0,0x72a461e1,0xa3a69345,0x9b249b65,0x72218ac2,0x7a616a20,0x82a06a00,0x72207a80,0x82c07a80,0xa38192e0,0x8280abc0,0xc4a49300,0x72009b40,0x9322b425,0x82e07a60,0x8ae082a2,0x61a082c0,0xabe39321,0x7a808ae0,0xa3a77aa1,0x72617aa1,0x618059c0,0x69e069c0,
-0x82e3a3c5,0x7a808ae1,0x7a407a80,0x93028ac0,0x69e07a20,0xabc28b00,0x7a80a3c0,0x69e09361,0x9ba28ae1,0x82c09342,0x82819300,0x7a807201,0x82a07200,0x82c0a3c0,0x8ae09321,0x934082c0,0x82a09b61,0xa3847a40,0x69c09302,0x49007a41,0x6a025980,0x618040c0,0x59809b65,0x8b0282a4,0x82819b63,0x7a6369c0,0x59619347,0x6a217241,0x7a627a82,0x93676a01,0x620159c0,0x6a225160,
-0x59c061c0,0x51806a22,0x93246a21,0x934282a2,0x7240a3a4,0x72427a63,0x7aa382c4,0x82c27262,0x82a38ae5,0x7aa67284,0x72a27aa2,0x62244940,0x28606203,0x30a059e2,0x59e138c0,0x6a4261c2,0x40e07264,0x38e04962,0x5a054960,0x5a036a65,0x59e238e0,0x5a036a65,0x49615a04,0x390251c3,0x72c74963,0x416249c1,0x622449a0,0x51e34982,0x49a24160,0x62453900,0x30c05a24,0x20804181,
-0x30c049c3,0x51e54182,0x204028a1,0x18004962,0x492338e0,0x62042840,0x390059e2,0x30e030c0,0x18401800,0x49c50000,0x108220a0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x00000000,0x00000000,0x28c10841,0x00000820,0x00000000,0x00000000,0x00000000,0x10400800,0x39830820,0x39841880,0x08000800,0x00000000,0x00210000,0x10400000,0x186020a1,0x00000000,
-0x7a419ba6,0x82e482e3,0x61c061c0,0x724161c0,0x6a007261,0x8ae361a0,0x7a617a40,0x72207a81,0x7a427a60,0x41404941,0x832751a0,0x9b259324,0x9b64a345,0x93248280,0x7a607a61,0x6a0069e0,0x7a807240,0x8ac082a0,0xabc27a40,0x93027a80,0x72407a60,0x82c07a60,0x8280abc1,0xa3a269c0,0xabc29340,0x72007a60,0x930282a0,0x82a0ac04,0x82c082a0,0x7ac061a0,0x61a09363,0x72416a00,
-0x61a082a1,0xabc27240,0x82c09b60,0xabc4a3a4,0x7a407a40,0x7a407a60,0x934182a0,0x69e082c0,0x82e07a80,0x82a08ae0,0x69e07a80,0x7a617240,0x82c182c1,0x72607a60,0x93417aa0,0x9b828ae0,0x93429ba2,0x93017260,0x9b229302,0x59608260,0x7240abe7,0x82817a42,0x7a409303,0x9b259304,0x8ae27a61,0x728182e2,0x412051c2,0x6a225160,0x61a059a0,0x7aa469e1,0x61e259a0,0x51406a43,
-0x6a217aa3,0x51605180,0x6a007261,0x8ae19343,0x72609301,0x61a061a0,0x61a069e1,0x9b666a00,0x932461a0,0x93447260,0x5980abe6,0x51814920,0x5a045a03,0x38c030a0,0x62224960,0x49414940,0x496051a3,0x18006224,0x51a151c3,0x416159c2,0x624549a2,0x624551c3,0x310028a0,0x100028a0,0x628672c8,0x10003100,0x28801000,0x412030c0,0x62236245,0x51a16202,0x41204982,0x49a228a0,
-0x39414142,0x10003101,0x18401000,0x49841840,0x5a2451e3,0x62445a03,0x518259e3,0x59e35182,0x49813900,0x51e451e3,0x10003101,0x31629c6f,0x30e139a3,0x104028a1,0x00000820,0x00001861,0x39a50800,0x00000820,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x39840000,0x39633963,0x10600000,0x08000000,0x00000800,0x080018a1,0x00000000,0x00000000,
-0x72207240,0x72216a00,0x6a0169e0,0x93456a00,0x8ac18ae5,0x82819323,0x8b038ac1,0x6a007a61,0x69e182c2,0x5a023060,0x7ae651a0,0x9b258ae3,0x930392e4,0x8ae38ac1,0xabe97a60,0x72217a61,0x69e082a2,0x93009b62,0x93008ac1,0x8ac07a80,0x72607a40,0x6a007241,0x82a08ae0,0x934082a0,0x92e09ba0,0x82a09321,0xc4c6abe2,0x932069c0,0x8b22ac02,0x62007a80,0x72206a00,0xa3a37a60,
-0x8ae08ac0,0x7a607260,0x8b0082c0,0x69e0a3a7,0x7a808b00,0x8b207240,0x82a09b60,0x7a607a80,0x8b207aa0,0x82c07a80,0x72407a60,0x93449362,0x82e17a80,0x69e07240,0x82a08b02,0x8ac08ac0,0x93228ae1,0x9b428b21,0x9b439b43,0xbc669b42,0x8ae1b3e6,0x82a269e0,0x8ae39b65,0x7a418282,0x93248282,0x62225180,0x286030e0,0x6a224940,0x598059a0,0x492061c1,0x7a844940,0x49006a22,
-0x6a428b06,0x82e36a83,0x82a27a82,0x93239364,0x82e39b43,0x61c169e0,0x6a0261a0,0x7a838ae5,0x8ac37223,0x7a609305,0x82c69305,0x51807aa4,0x38e059e2,0x286038e0,0x51c16a64,0x49823920,0x6a836a44,0x51c359e3,0x49405a04,0x30c051c2,0x41424141,0x62464142,0x52044161,0x49a35a45,0x7b4928a0,0x182028a0,0x5a044161,0x51a25a04,0x7ac77b08,0x59e359e3,0x498251c3,0x30c051a3,
-0x41812040,0x206049c2,0x104028a0,0x30e20800,0x72e81020,0x5a246265,0x59c359e3,0x49604981,0x49423080,0x30c051a2,0x39003920,0x49c34182,0x28c15a46,0x08201040,0x104028e1,0x18600000,0x20c13122,0x29020800,0x10410800,0x08201020,0x08001881,0x000020a3,0x00000000,0x00000841,0x00000000,0x00000800,0x000018a1,0x00000000,0x39421880,0x39823982,0x39435a68,0x102030c0,
-0x93657240,0x8ac28281,0x82a19302,0x9b447a60,0x9b039b25,0x7a60ab86,0x930392e2,0x72208ae2,0x7a627a41,0x59e27263,0x72846201,0x9b659305,0x8ae29b65,0x7a816a00,0x72407200,0x61a07a61,0x82a37221,0x93207a60,0x8ae182c0,0x72207a40,0x93237220,0x61e07200,0x93039321,0x72408b00,0x7a607a40,0x93428280,0x7a809361,0x7a808ae1,0xb44782a1,0xa3e4a3e4,0x6a016a20,0x9b6082a0,
-0x8ae19321,0x93218ae0,0x8b209b61,0x7a807260,0x72208b20,0x72608ae1,0xa38482c0,0x93217a60,0x82a18b20,0x6a2082c1,0x72407200,0x93627260,0x7aa159a0,0x6a207aa0,0x8b017260,0x724082a0,0x72607260,0x82c082a0,0x8ae17260,0xccaa8aa0,0x59a0e56f,0x59609b46,0x82a182a1,0x7a6361e0,0x72627a63,0x59824941,0x286040e1,0x61c151c1,0x7a636a21,0x7a6269e1,0x93667a83,0x48c07222,
-0x82c49326,0x82a37262,0x6a2082e4,0x7a618b03,0x93658ae3,0x49207a84,0x40e059a1,0x492059a1,0x61a04940,0x9b268ac3,0x59a07240,0x51804900,0x38c06203,0x51a138c0,0x49607284,0x62034120,0x59e27ae6,0x7b297b09,0x414038e0,0x39005a23,0x310051c3,0x626630e0,0x51e55204,0x49826ac7,0x6ac72060,0x180051c2,0x20404160,0x49413921,0x620359c1,0x518159c2,0x414130c0,0x30c06245,
-0x498351a3,0x310028a0,0x49e449c4,0x08000820,0x18603123,0x416128c0,0x39004140,0x5a255a24,0x39004961,0x49a238e0,0x416151c4,0x390051c4,0x414151c3,0x290149c4,0x28c02080,0x00003162,0x39421020,0x31414183,0x20c03120,0x10201040,0x00000000,0x08200000,0x00002924,0x000041c6,0x00000000,0x08201882,0x00000000,0x00000000,0x00000000,0x49e41880,0x49e46ae8,0x0800940e,
-0x7aa06a00,0x8ae18ac1,0x69c09323,0x9b448ac1,0x8a809304,0x7a2092e1,0x8ae39304,0x7a619b65,0x69e069e0,0x51807222,0x7aa559c0,0xabc7a367,0x8ae29b65,0x8ae282c1,0x7a6169e0,0x61a082c2,0x69e069c0,0x82a08261,0x82a09b61,0x82c08280,0x7a808ae0,0x59607a61,0x82a29341,0x69c09b63,0x72207200,0x8b0361e0,0x8b006180,0x93437220,0x82c269e1,0x6a007240,0x82617240,0xa320b422,
-0x8ac09b61,0x82808ac0,0xabe5abc3,0x82c061c0,0x6a007a60,0x7aa07240,0x7aa27aa0,0x72607240,0x8ae382c1,0x6a207240,0x72207220,0xa3c39342,0x7a806200,0x93427260,0x82a07260,0x82e19342,0x6a2061e0,0x72608b43,0x59a07aa2,0x82c09323,0x72445980,0x9b4682e5,0x8b037a80,0x51409b87,0x61e07222,0x40e040e0,0x59a15981,0x82a35981,0x61c07a81,0x69e07221,0xabe87241,0x9b665940,
-0x7241abe8,0x6a017aa3,0x61a061a0,0x83036a20,0x61c061c0,0x49205140,0x49005980,0x492059a0,0x61a06a42,0x8b047a83,0x72025120,0x518059a0,0x62034940,0x61e251a1,0x518061c2,0x7a856a22,0x6a4438c0,0x51c459c4,0x51a249c5,0x59e438e0,0x28803900,0x39414141,0x20605a45,0x6a864982,0x39215a45,0x100051c3,0x5a053920,0x41613901,0x6aa63920,0x41623900,0x49a34121,0x49624962,
-0x5a254941,0x28c03921,0x28c01820,0x00000000,0x10000000,0x390128a0,0x30c04121,0x62464161,0x51a349a2,0x30c03901,0x49a22040,0x5a036246,0x59c451e4,0x41816225,0x28e03961,0x41e55246,0x290149c4,0x20611020,0x49e50800,0x184041a4,0x08200800,0x00000000,0x00000820,0x52690000,0x08000861,0x00001020,0x08000000,0x00001061,0x00000000,0x52261880,0x7b6a6ac7,0x31005205,
-0x6a017221,0x82818ac2,0x82618ae2,0x9b248280,0x9b0392c3,0x7a408240,0x82829b65,0x72017200,0x7a427a60,0x51608283,0x7ac561e1,0x9b649b45,0x93029302,0x6a007a80,0x82e361e0,0x9b4382a3,0x8ae27220,0x7a217a60,0x8ae08280,0x8ae0abe2,0x82c0abe1,0x93227a80,0x72008b01,0x9b429b61,0x69e08b02,0x6a216a00,0xa3c469c0,0x61a07261,0x61a061a0,0x69c059a0,0x82607a61,0x9b00a341,
-0x93218ae0,0x8ac09320,0x72008b00,0x69e07241,0x82a07220,0x7a807a60,0x6a207a80,0x72807240,0x82e16a00,0x72408ac3,0x9b8092e1,0x72409361,0x7a607a60,0x726182a0,0x82c07220,0x7a8182c0,0x83046201,0x7ac06a40,0x6a024940,0x51207a62,0xe5ef8b65,0x6a00a3a7,0x82c382c3,0x6a019b87,0x61a061e1,0x72437a62,0x62016a21,0x82a261e2,0x7a617a60,0x72209b67,0x6a007a82,0x72417a41,
-0x7a62bc69,0x6a2161e0,0x61c06a21,0x728282c3,0x6a2259e0,0x6a2161c0,0x7a8382e4,0x82a461a0,0x8ac47a42,0x6a018ae4,0x61e15960,0x51805140,0x620059a0,0x59806a42,0x7a8469e1,0x72637283,0x51814920,0x39214984,0x30c159e4,0x5a451800,0x520430e0,0x208028a0,0x7b2851e3,0x18204140,0x51c35a26,0x20404140,0x6a664140,0x49a15a04,0x7b0849a1,0x20203900,0x394030a0,0x414028a0,
-0x49a24161,0x186051c3,0x310283ac,0x00001880,0x00000000,0x31000000,0x51a24142,0x5a0430e0,0x390151c2,0x30e051e2,0x416030e0,0x49a22880,0x41833900,0x20a049c4,0x28c041c3,0x41c33982,0x52255a66,0x5a464a04,0x41c34183,0x310120a0,0x10402900,0x00000800,0x00002121,0x10201000,0x49e70000,0x20c230c3,0x00001020,0x08200000,0x000018a2,0x39220000,0x28e228a0,0x28e03120,
-0x726082e1,0x82a29b65,0x82c35120,0x7a417220,0x720082a3,0x69c082a1,0x7a82a386,0x594061c0,0x8ae47240,0x51807a83,0x8b076a02,0x9b65a387,0x71e09b65,0x69c07241,0x6a407200,0x93218b02,0xabe482c0,0x8ae09320,0x82a08ac0,0x72408280,0x722082c0,0x82c17a60,0x9b637220,0x69c082a0,0x720082a2,0x6a207a82,0xac05bc66,0x6a2059a0,0x61e05980,0x6a0082c2,0x7a407240,0x7a607a40,
-0x7a407200,0xb4219300,0x69e082c0,0x6a007240,0x8ae082c0,0x7aa08ac0,0x6a0082c1,0x61e082e2,0x6a2082c2,0xa3c282c0,0x7aa082a1,0x7a816a20,0x61e082c2,0x82e06a20,0x72a08b40,0x7ae27280,0x72a07ae2,0x6a406a60,0x724338a0,0x40c07a41,0x82a45161,0x82a361e0,0x72218282,0x6a0061c0,0x61c06a01,0x72426a01,0x59605940,0x82a29343,0x82817240,0x8b04a386,0x7a828b04,0x7a6082c1,
-0x59408ae4,0x82a37242,0x6a0182c4,0x72618b04,0x72006a41,0x82a27221,0x8ac37a62,0x93259325,0x93469325,0x7a848ae5,0x6a227243,0x59a05980,0x59a05160,0x82c45980,0x82c47222,0x61e16a02,0x41014921,0x30e030a0,0x41413920,0x5a263921,0x30e051c4,0x418251e3,0x72c76a65,0x51e46aa6,0x31002060,0x51c24161,0x6a864981,0x6a861820,0x41614161,0x20204161,0x30e030e0,0x49814982,
-0x498149a2,0x10003920,0x000030e2,0x00210000,0x00000000,0x10000000,0x51a23921,0x6a665a04,0x30c149a2,0x418230e0,0x49c24161,0x6aa76266,0x73095204,0x5a46b511,0x28c13121,0x28e162a8,0x49c43982,0x49e45225,0x52465224,0x5a466287,0x28e041c3,0x4a0439a2,0x08202100,0x00200000,0x00000800,0x00000000,0x28e35aa9,0x00000020,0x00000000,0x00000000,0x4a0641a5,0x084039c3,
-0x61c06a00,0x59a05160,0x724361c1,0x8b047a82,0x61c15980,0x59205960,0x61c08282,0x72218b04,0x722182c1,0x59806a01,0x8b076a22,0xa3879b47,0x7a809324,0x82816a00,0x6a407a40,0x9b8182e0,0x8b009320,0x8ae08ae0,0x8ae082c0,0x82e09b83,0x7a607a80,0x82c17a40,0x720192e3,0x69e08ae1,0x82847a41,0x6a406a00,0x6a208b02,0x8b039343,0x61e07a82,0x93437aa1,0x82817aa0,0x7a607240,
-0x8ae08ac0,0xb3a292e0,0x72407240,0x82c082c0,0x8b008b00,0x82e09322,0x7aa182c0,0x8b017ac0,0x83009341,0x7a807aa0,0x6a608b00,0x51a059e0,0x59a059e0,0x8b206220,0x7b217aa0,0x62206200,0x6a416221,0x7aa172a0,0x51607aa5,0x61e069e0,0x61a07282,0x8ac35121,0x61c069c0,0x82e382e3,0x8b04abe7,0x8ae49346,0x82a18ae1,0x82a19324,0x82a182a3,0x8ae38ae3,0x722082a2,0x7a415940,
-0xbc4aa388,0x82a48283,0x596071e1,0x726182a3,0x8ac36200,0x8aa28aa3,0x8ac38aa2,0x82a382a4,0x72017a62,0x61c15140,0x6a2261a1,0x59c16202,0x72647243,0x59605140,0x82a469e1,0x598061e1,0x41005180,0x498130c0,0x49824140,0x392028a0,0x52044160,0x39004182,0x412051c3,0x49e36266,0x51e451c4,0x39204141,0x30c051c3,0x59e451a3,0x390072c8,0x30e02880,0x498328a0,0x49a13920,
-0x6a6549a2,0x418151e3,0x100041a2,0x084020a2,0x18a020a0,0x49e21040,0x38c03921,0x5a2451c3,0x288030c0,0x49a330e0,0x41a149a1,0x28e04182,0x5a256286,0x49c472e8,0x31235206,0x00005206,0x838b28e0,0x49c21040,0x524628e0,0x49c44a05,0x49e441a3,0x5a054a04,0x20a220a1,0x83ac0800,0x000041a7,0x00000000,0x08001061,0x00000000,0x00000000,0x00000000,0x00000000,0x52251020,
-0x6a2061a0,0x61a05980,0x596069e0,0x51407242,0x61c061a0,0x61a061c0,0x72215960,0x7a6082c2,0x7a427200,0x59807a62,0x82e56a43,0x9b669ba7,0x82a09b24,0x72217a40,0x93419b62,0xabc28ae0,0x8ae0b404,0x7a608ae0,0xac04abe2,0x828269e0,0x7a607a80,0x82c09b63,0x72208ac2,0x7a417a61,0x69e07200,0x72606a00,0x72407261,0x724169e0,0x61e061c0,0x8ae18ae1,0x72209340,0x82e082c0,
-0xa3a29320,0x93408280,0x8b009360,0x8b008ae0,0x9b6082c0,0x9b609b40,0x7a609320,0x8b4082c0,0x72408b21,0x7aa07aa0,0x622072a0,0x61e06200,0x62006200,0x8ae17280,0x624082c0,0x59e05160,0x72c172a1,0x59a07280,0x61e148e0,0x72435160,0x598069e2,0x7a6161c0,0x93248282,0x8b048ac3,0x8b05abe7,0x8b247a83,0x7a6182a1,0x93239344,0x82817a40,0x82a39304,0x93457a62,0x6a219325,
-0x93257a63,0x828469e0,0x72228284,0x82a47241,0x82826a21,0x82a38283,0x9b87abc8,0x69c082a2,0x9b678ae6,0x6a227a85,0x72446a22,0x59a159a1,0x59e161e2,0x41206222,0x49607aa4,0x49605180,0x59e24140,0x518159c2,0x49615181,0x30a03900,0x51e330c0,0x62454982,0x30c030c0,0x412051c2,0x49813940,0x39005a04,0x28604161,0x414130c1,0x180030e0,0x28a028a0,0x5a0430e0,0x49615a03,
-0x51a251c2,0x28805a04,0x39613940,0x20a13962,0x20803122,0x28c028a0,0x418249a2,0x59e451c3,0x180049a3,0x51c42060,0x39404182,0x30e24182,0x18201000,0x39613942,0x00000800,0x4a065227,0x39424a03,0x28c03964,0x4a041820,0x104049e4,0x52446ac7,0x5a655a65,0x52255205,0x4a045245,0x10603141,0x00002902,0x28e21860,0x00001860,0x00000000,0x10a30000,0x00000000,0x00000000,
-0x8ac28281,0x51407261,0x69e17a44,0x69e17223,0x6a0261a0,0x72217241,0x7a637241,0x82a38ac4,0x72408ae3,0x59a061a0,0x8b0572a4,0x9b458b25,0x93029304,0x48e082a0,0x7a607a83,0x8a807a40,0x8b00a362,0x7a607a60,0x7a807a80,0x7a607220,0x6a407220,0x82806a20,0x61e18281,0x6a007ac2,0x7a827a61,0x6a007242,0x61e06a00,0x72407a82,0x6a406a00,0x7a607aa0,0x93619b61,0x82a07a60,
-0x8ac09b21,0x8b207a40,0x7a807a60,0x7a607aa0,0xa3827a60,0x7a6092e0,0x93027a60,0x7ac07a80,0x72607280,0x72608b02,0x6a607280,0x7ac16220,0x62006a40,0x82a17280,0x83237a80,0x72a17ae2,0x6a606a80,0x61e08301,0x93247a82,0x69e07241,0x82a37a83,0x9b45b427,0x82a29b65,0x61809324,0x6a00a3a6,0x8b0261c0,0xc4aa7200,0xb4499b45,0x93047200,0x82a392e3,0xccecee10,0x9b888ae4,
-0x724082a3,0x82a47a42,0x82a48284,0x7a847262,0x7a426a01,0x69e07a62,0x93468b05,0x72617a83,0x9b8a82e6,0x49409b8b,0x7aa56221,0x598061e2,0x62026a23,0x620251a0,0x6a227263,0x6a436a43,0x6a437244,0x59a161e2,0x496059c1,0x51836203,0x49a259a3,0x51c33900,0x39204982,0x41406224,0x59e359e3,0x62445a03,0x30e038e0,0x49814120,0x30e049a2,0x51a330e0,0x5a035a24,0x30c051c2,
-0x51c26243,0x49613900,0x28e05182,0x39621840,0x20600800,0x31002080,0x394149c3,0x51a351c3,0x41423900,0x5a254161,0x394149c3,0x20a02880,0x208041c4,0x312120a0,0x18802060,0x000039c5,0x39641020,0x10001840,0x41a32080,0x49e4730a,0x52441880,0x49c251e2,0x418149a1,0x628749c4,0x49c45226,0x30e14183,0x08003122,0x082041c4,0x20c20000,0x08001860,0x00000861,0x00000000,
-0x6a006a00,0x59607241,0x38405120,0x61c07222,0x59a06a01,0x6a017a82,0x598061c0,0x61e07a61,0x6a217241,0x49406a01,0x8b047ac5,0x9b659b87,0x8ac27a40,0x59607a60,0x93428ae4,0x61c082a1,0xa3c59b63,0x7a6069e0,0x69c08ac1,0x724082a0,0x82a17260,0x61e06a00,0x61a07aa3,0x596082e4,0x61c061a0,0x8ae359c0,0x61a07a82,0x6a006a20,0x6a006a00,0x72406a00,0x724069c0,0x72207240,
-0x72407220,0x72a082c1,0x72405980,0x82a07a80,0xa3a37a60,0x72209301,0x8ac38ae2,0x9b64abe7,0x6a207aa1,0x72606200,0x59e06200,0x72606a60,0x6a606200,0x82a159e0,0x82c282c1,0x6a607ac1,0x6a807ae2,0x5a008302,0xa3858ac2,0x93239b44,0x72209324,0x6a208b03,0x82c27a81,0x82a39304,0x59a06a00,0x61c09326,0x8ae2ac06,0x72207200,0x72408b04,0xabe8a3a7,0x7a835140,0x598082a3,
-0xabe97201,0x9b8740a0,0x9b888b05,0x8b067243,0x8ae58ae5,0x7a838305,0x9b868ae4,0x61e182a4,0x49207a63,0x6a227a84,0x72847242,0x6a2261e2,0x6a434960,0x7aa47284,0x6a226a63,0x6a236202,0x72846a63,0x62027284,0x6a2359c1,0x59c26a43,0x51c16a64,0x41204961,0x6a646a65,0x62026a44,0x51a14960,0x622338c0,0x30c04100,0x72a551c2,0x414051c2,0x5a0351a2,0x62225181,0x59c15180,
-0x59c16202,0x518259e3,0x498159e3,0x49c251c2,0x39205203,0x31003940,0x30e03921,0x51a34982,0x394149c2,0x394230c0,0x206051e5,0x39643944,0x080020a0,0x5a465226,0x41845a47,0x10003141,0x00000820,0x18601860,0x10001000,0x5aa628e1,0x72e862c7,0x52025222,0x5a4562a7,0x49c34182,0x310049a2,0x41a328e0,0x4a055206,0x418349e4,0x20a03142,0x29002900,0x312049e4,0x000041e4,
-0x61e06a01,0x618069e1,0x48e069e3,0x48c069e2,0x722161a1,0x61c061c0,0x51205140,0x6a007220,0x61c07241,0x59814140,0x8b2572a5,0x82c28b26,0x72207a20,0x69e082a1,0x82e28ae3,0x61a06a00,0xdd8db44a,0x69e0abe4,0x7a607a60,0x69e08ae1,0x8ae27220,0x6a0082c2,0x59a061e0,0x61c07a83,0x61e07241,0x724061e0,0x72408b02,0x726169e0,0x72407a80,0x72407a60,0x8b007240,0x82a082c0,
-0x82c07aa0,0x72819ba2,0x40e059c0,0x82c061e0,0x8ac08ae1,0x7aa07200,0x932482a1,0x72408ae3,0x82e082c2,0x7ae16a60,0x62007ae3,0x6a406a20,0x7ae17280,0x726061e0,0x72816a40,0x49c06240,0x62406240,0x5a007ae1,0xabc68281,0xb407a385,0x61807a61,0x934582c3,0xee10bc6a,0xa34582e2,0xc4cdcced,0xac097222,0x9b869b46,0x8b04abe7,0x9b6582a4,0x69e1a387,0xabe982c4,0x61a05980,
-0xcccc9b46,0x7a639b87,0x61a07242,0x8b057a63,0x8b048ae5,0x6a01a3ea,0x8b059346,0x6a236a23,0x51606a02,0x62227285,0x72646242,0x62037264,0x622361e2,0x59a059e2,0x72637263,0x59e26a43,0x726459e2,0x83067264,0x7aa561e2,0x72846a43,0x6a436a23,0x72856a44,0x72847a85,0x72856a43,0x51816203,0x59c24960,0x41404960,0x59e251c1,0x51a15a02,0x6a854160,0x59c172a5,0x6a4372a5,
-0x59e251a0,0x49604120,0x41614940,0x49c151e2,0x394151e2,0x392049c2,0x310049a1,0x30c03920,0x49a35203,0x418328c0,0x28c05a26,0x39432060,0x28c028e1,0x39834183,0x524649c4,0x396262a7,0x00003100,0x41a41060,0x28e21860,0x208028e1,0x62e83983,0x20406aa5,0x6aa76266,0x49a251e3,0x41a24161,0x39633121,0x41a23982,0x41a341a3,0x4a044a04,0x18603961,0x39623961,0x31434182,
-0x82c582a4,0x6a426a22,0x72427aa4,0x82a4a3a9,0x7a827222,0x7a606a21,0x59807261,0x82e47241,0x59806201,0x59e14940,0x82e572c6,0x7a817a83,0x8b0182c1,0x7a6069e0,0x6a006a00,0x51616a00,0xcd6e4920,0x9b62bc67,0x69e09b65,0x82a27a41,0x8b017240,0x72607220,0x59806a20,0x72618b04,0x7a817240,0x6a207260,0x82a182e1,0x82c16a00,0x7a807a80,0x8b008ae0,0x9b808ae0,0x93209340,
-0x7ac082c0,0x51407280,0x61c04900,0x93447200,0x82c17a80,0x72408ae2,0x69e17a81,0x72609b66,0x7aa17aa1,0x6a406a60,0x49605a00,0x62005181,0x728161e0,0x6a407281,0x62407281,0x62416a60,0x6a615a20,0x7ac372c3,0x7a618aa2,0x9b446180,0x82a382c4,0x7a2082c3,0x72629325,0x8b047281,0x6a434940,0x59a09bc9,0xabe87a24,0x5140b40a,0x69c18aa3,0x6a217244,0x830538a0,0x9b8a7244,
-0x40a09b68,0x6a237ac4,0x598159c2,0x72845980,0x934882e5,0x726369e1,0x72858306,0x62249388,0x83076203,0x7b0872a4,0x6a6469e2,0x62226a44,0x61e24960,0x59a07264,0x51806a22,0x6a227244,0x82c582c6,0x6a237a85,0x59a169e2,0x726482c5,0x82c47aa4,0x72637243,0x726472a5,0x6a446a24,0x410059c2,0x59c26203,0x41204961,0x51e159e2,0x6a645a22,0x6a4551c0,0x6a446203,0x61e26a64,
-0x49616a23,0x51a159e3,0x51c151c1,0x41603920,0x390049c0,0x49c15a23,0x49814140,0x41613920,0x49824961,0x39414982,0x204051e3,0x182030e2,0x10001840,0x49c33121,0x20803101,0x5a874a04,0x62c94a06,0x18802902,0x10603965,0x39835246,0x00001040,0x00000000,0x396228e0,0x414251e2,0x28e041a2,0x31413962,0x28e01860,0x39613983,0x41c44a04,0x5a665205,0x49e45a66,0x18403101,
-0x38603020,0x598059a1,0x49404920,0x72427222,0x7a6359a0,0x7a827a63,0x598059c0,0x61e06a21,0x59806a01,0x59e251a1,0x49605a02,0x82e37263,0x8b207a80,0x72407a60,0x82e27a61,0x72436a00,0x7ac56202,0x6a2061a0,0x61c082a1,0x69e07241,0x7a8082a1,0x82606a00,0x61a08a82,0x7a828b04,0x7aa161e0,0x82c17a80,0x722082a1,0x82a08ae1,0x93417a60,0x9b81b402,0x7a808ae0,0x9b609341,
-0x830182e0,0x59a07281,0x61a04120,0x72207a62,0x93239324,0x7aa29344,0x7a8361c0,0x724282c4,0x59c061e0,0x72617242,0x51a059e0,0x51c051a0,0x59e051c0,0x59e059e0,0x62207281,0x59e05a20,0x62406240,0x62005a00,0x8b045140,0x93047221,0x7a629366,0xabe87a41,0x41005160,0x49006a20,0xbcac8b46,0x7ac559a1,0x6222ac4b,0x9b895a00,0x7ac659c0,0x5a0351c3,0x722261c3,0x72855180,
-0x2000ee53,0x62027284,0x6a453080,0x62424100,0x72a351a0,0x936959e1,0x40e07285,0x30a07244,0x7b286202,0x51c34100,0x72657243,0x41005182,0x622351a1,0x7ac66a44,0x6a447285,0x62226224,0x72648307,0x6a236203,0x6a646203,0x72637ac6,0x7a846a43,0x6a236a43,0x6a435180,0x61e26a23,0x59e36204,0x59e351a2,0x49815181,0x49804140,0x5a0159e1,0x6a446241,0x620261e1,0x61e27264,
-0x494061c2,0x6a6559e3,0x498151c2,0x49806264,0x51c251e1,0x49a14160,0x51c14140,0x5a0349a2,0x39203940,0x52044140,0x49826a86,0x30e128c1,0x28c128a0,0x41634162,0x20404184,0x49c53121,0x18804a06,0x08001860,0x10810000,0x29233143,0x188018a0,0x080020a1,0x39430800,0x18201840,0x31420800,0x310028e1,0x314241c4,0x290041a3,0x41a22900,0x522451e4,0x5a665225,0x5a4449e3,
-0x49204940,0x62015160,0x59a06a42,0x72215180,0x7a417a62,0x59a07a42,0x82e46200,0x720161e0,0x51807243,0x51a24120,0x51a05a23,0x59c059c0,0x72617ae3,0x6a4061c0,0x72006a00,0x72007220,0x51c05140,0x72606a20,0x7a826a00,0x7a616a00,0x722169e0,0x618069e0,0x61e069e0,0x69e07241,0x7a807a62,0x82c09323,0x7aa08ac0,0x8b2082a0,0x82a08b00,0x8b008b00,0x82c08ae0,0x93228281,
-0x6a207a60,0x82c282c2,0x82a27a61,0x82a37261,0x82e37a81,0x72828ae3,0x59e07283,0x6a236a42,0x51c26223,0x6a6259e1,0x622072a2,0x6a616a81,0x5a0051a0,0x6a006240,0x5a007241,0x5a0072a1,0x62416ae2,0x6a626a82,0x61e27b05,0x92e69388,0x72837223,0x59804920,0x18006a02,0x7aa38b47,0x93ab7a24,0x5a690000,0x9cb4734e,0x0000736f,0x6370f75f,0xd6ff5b2f,0x52ceffff,0x39cb2106,
-0x9d376bb1,0xffffc61b,0xe6fead37,0x9cf6deff,0xd6ddef9f,0xcdd7ffdf,0x59626246,0x59e44963,0x5a289c10,0x638d3988,0x52aa3964,0x31230000,0x418262a6,0x7b6c5a05,0x08a35289,0x308020a4,0x52066a67,0x5a044a06,0x18000000,0x59a16224,0x7a8559a0,0x6a047aa6,0x61e27267,0x59e45a02,0x62046a24,0x51a26224,0x59c251a2,0x51a051c0,0x6a656a62,0x7aa26222,0x59e16a42,0x61e37264,
-0x51a16204,0x51a14120,0x39004100,0x5a024140,0x5a435a43,0x31004160,0x412051c2,0x51a251a1,0x51c259e3,0x49816223,0x390051c1,0x41612880,0x310020c0,0x520430e0,0x28c05225,0x49a41840,0x0840b553,0x10200800,0x51c520a1,0x00000800,0x31832102,0x39434184,0x290118a0,0x18803121,0x10003965,0x20a11020,0x18610800,0x41a20800,0x28e049e4,0x39423961,0x62a63960,0x41a25225,
-0x59806a43,0x51805140,0x72436a42,0x72415180,0x61c069c0,0x72627a83,0x61e159a0,0x69e25160,0x59e261e1,0x51a24981,0x51c149a1,0x51a059e1,0x69e06a61,0x7ac06a20,0xabc49342,0xa3627a60,0x516182a4,0x69e06a21,0x7a4082c2,0x7a6082e1,0x82a27241,0x724169c0,0x72417a81,0x6a007a62,0x61a06a00,0x6a008281,0x72208ac0,0x93617a80,0x7a807a80,0x82c082c0,0x9b619320,0x82809323,
-0x72817a60,0x8b039365,0x7aa282a2,0x9ba77241,0x82e482e3,0x6a416a00,0x41206201,0x51607ac5,0x59e259e3,0x59e17284,0x62406240,0x5a0051c0,0x6aa06a82,0x6a606aa0,0x624072a0,0x62606a80,0x6a607aa2,0x72826a61,0x20007263,0x5a6740e0,0xef1cc5d5,0xef7e62ed,0x31c8c65a,0xb5d9c639,0xd75fd71f,0xce9fce9f,0xc67dc65d,0xcedece9e,0xc67dc67d,0xce9dce9e,0xd6bec67d,0xd6dfce9d,
-0xcebddf3f,0xc63cb5b9,0xd69fd6de,0x94d673b3,0xce9dd6be,0xeedbdede,0x938d5205,0x834d93d0,0x93cfd616,0xce3ace5c,0xcebda493,0xa4951841,0x49856a8b,0x0800ff5d,0xbe1bffbf,0x39a6dedd,0xf77e5228,0xeebbc5d9,0xb597bd56,0xd59649a4,0xd5b359e5,0xff9b5183,0xffffffbf,0x5a2559e6,0x39236268,0x6ac87b2a,0x41415a25,0x6a636aa5,0x5a206221,0x72a46a82,0x62227aa4,0x496059c0,
-0x59e36204,0x59e34120,0x49a34120,0x51c151c2,0x6a824160,0x49805a21,0x5a014980,0x51c14960,0x49805a23,0x62446223,0x51c24980,0x30e04120,0x39013940,0x28805a25,0x41633941,0x5a473121,0x29015247,0x10601861,0x002020a1,0x4a272922,0x314220c0,0x732a20c0,0x18a05227,0x08003102,0x41841020,0x28c02901,0x00001020,0x08000000,0x4a022900,0x41a449e3,0x18801020,0x39416267,
-0x51806a02,0x59a05140,0x7ac56a21,0x6a006a42,0x72627200,0x59a05160,0x51606a02,0x6a236202,0x49824940,0x49813900,0x49604180,0x59a051a0,0x72806a61,0x932282c0,0xb3c5a363,0x928192c1,0x7a82a346,0xc4679343,0x9b238240,0x596082c1,0xa3a58282,0x72408ae2,0x598061c0,0x82a45980,0x72416a02,0x82a18282,0x6a209301,0x72406a00,0x7a607a41,0x82a082a0,0xa3c19340,0x82a061c0,
-0x596082c2,0x8b0561c0,0x82c47242,0x722382c4,0x7aa47262,0x51a061c0,0x61e261e2,0x61e459a1,0x59c26203,0x49406223,0x6a616261,0x51c06220,0x6a616241,0x6a837ae5,0x6a437ae4,0x62438327,0xd6398348,0xb55420c4,0xb5bb8b2a,0xdebdd63a,0xcedecebe,0xd6dfc67e,0xce9ec67e,0xd67dce5e,0xc67ec67f,0xc67fc67f,0xce7dce7d,0xce7ece7d,0xc67ece7c,0xc67ec67e,0xce7ece7e,0xc6bec69e,
-0xce9ece9e,0xce9ec67e,0xcebea559,0xd6dfbe3b,0xd6bece7d,0x93f0bddb,0x49a8c574,0xf75eb556,0x9c0ede7b,0x4146ffff,0x9d19ef3d,0xbd76be3b,0x6246b515,0xb535bd75,0xb5faf75e,0xffdf3125,0xde7b30e3,0xe73fad37,0xcdb86207,0xacb4bdb7,0x7b4c72ec,0x72ecc595,0xbe3affff,0x51e91000,0xad77a557,0x9471ef1d,0x6aa8c615,0x7ac672e8,0xa42e6222,0x72848b48,0x72637283,0x6a2682e8,
-0x59e45183,0x5a254961,0x5a043960,0x624451c2,0x7b226282,0x6a8172c1,0x49a05a40,0x626251c0,0x5a2151c0,0x72a672e5,0x51e26223,0x62435a02,0x394051e2,0x418041a0,0x206028e0,0x310141a2,0x49c349c4,0x6b08acd2,0x30a220c0,0x10201020,0x312149c4,0x28e12080,0x20e11040,0x10001860,0x20a01020,0x28e03141,0x08403963,0x00000000,0x00000801,0x10203120,0x28c249c5,0x49e428c0,
-0x59a159a0,0x6a217262,0x72847263,0x51806221,0x51804940,0x59c05180,0x59a06a01,0x51a16a02,0x49824981,0x416030e0,0x51c13940,0x59e051c0,0x82e36a82,0x8ac07a60,0x9b229b42,0xcccc8281,0x9b249342,0xb3e69b43,0x69e0bc47,0x8ae2abe6,0x932382a1,0x82a09b63,0x51a08ac3,0x61e15180,0x620159c0,0x6a205160,0x7aa161e0,0x82c282e2,0x82c28b02,0xa3847a60,0x8b0282a0,0x8b037a80,
-0x82a57222,0x82847a43,0x82a37a22,0x62006201,0x82c461e0,0x61e16202,0x59e46224,0x31441820,0x102020c2,0xf75c3944,0x6a647b09,0x8b8dac4e,0x6a854985,0x838d4982,0xb4f1a4b3,0x838cff9d,0x732f7b2c,0x9d59bdda,0xce3b626a,0xd69ed69d,0xc67dce7d,0xc67ece9e,0xc67ec67e,0xc67dc67d,0xc67dc67d,0xc65dc65d,0xc65dc65d,0xc65dc65d,0xc65dc65d,0xc65dc65d,0xc65dc65d,0xc67ec65d,
-0xc67ec67e,0xbe1cc67d,0xb5fba559,0xce9db5fb,0xd71fcebe,0x3126b598,0x5a8b7b8f,0x62ceffff,0x5a49b536,0xa492b5da,0xce7ca558,0xa4b4defe,0x836f7b90,0x6aee730e,0xe75ede9c,0xc63be71f,0x6acb5a8d,0xb558dedd,0x7b2def1c,0x0844e6ff,0x6aede6dd,0xad78ad36,0x62eece3b,0x31254184,0xe73edefe,0xe6fbce5b,0x7b49bd0f,0x7b05b4ad,0x93cb7ae5,0x6a207ac5,0xac4c8b48,0xcd51ddf3,
-0x72a95184,0x28a27b07,0xcdd6fffe,0xffffffde,0x7ae2a4ce,0x7ac072a0,0x62215a20,0x5a0151c0,0x6a6351c0,0x6a846a43,0x62226a63,0x7ac64980,0x5a226222,0x5a0051c0,0x392028a0,0x30c128a0,0x28c01840,0x49c449c3,0x6aea5205,0x5a8841a3,0x20814a05,0x10201020,0x312220a1,0x31233963,0x08001820,0x310128e0,0x18402080,0x10803984,0x00000000,0x20c01880,0x28e041c3,0x398141c2,
-0x620159a0,0x59c059a0,0x72836a21,0x496059a0,0x59c15160,0x61c061e1,0x61e061e1,0x49407243,0x39204981,0x390030e0,0x59e23920,0x622051a0,0x7aa26241,0xa3a47a80,0xabe69b42,0x69c0bc89,0x72006180,0x9302aba5,0x8281d52e,0xa385a3a5,0xa38482a1,0xaba4a385,0x51807a62,0x59e16201,0x6a4159a0,0x726161e0,0x69e082c2,0x72617a81,0x8b057a81,0x8ac382a2,0xa3e99305,0x59818b27,
-0x72854941,0x62456a85,0x6a866244,0x39853922,0x6aaa7b8d,0x5accc5b6,0x73b1d6bd,0xbdd9b5b9,0xa538c63c,0x9cd6b537,0xbd315229,0x5a8c7aa8,0x8c0fadb7,0x6b0cfffe,0xc5b6bd77,0x52078431,0xbdd9e71c,0xceffdebd,0x83905944,0xbe1cd69e,0xc65dad59,0xc63dc67d,0xc65dc63d,0xbe5dbe3d,0xbe5dbe5d,0xbe3dc65d,0xbe3dbe3d,0xbe3dbe3d,0xbe3dbe3d,0xc63dbe3d,0xc63dc63d,0xc65dc63d,
-0xc65dc65d,0xbe3cc65d,0xbe1cbe3c,0xb5fcb5fb,0xd6ffc67e,0x5aefdede,0xc61cb59a,0x83f48c55,0x51e8d63a,0xdebd1044,0xe6fec5da,0x4144ffbf,0xeefe5a07,0x6aa96acc,0xce1bacd3,0xd69de71e,0x72c939a8,0x49c97b4d,0xa4f4736f,0x834f51c7,0x8c55ff7f,0xe77fef7f,0xd6dbd6bd,0x7bf15207,0xdf1eef5f,0xfffdf77d,0x8b88acef,0x7ac39387,0x7aa57aa4,0x7a836a01,0xc53272c7,0xb46fff9b,
-0xa3ccb44e,0xbd126a43,0xbd12de98,0xe619ff3b,0x49a1e6b8,0x93607b04,0x6a807300,0x59e051c0,0x51a06a82,0x72c459e0,0x5a006241,0x62416a82,0x51e04980,0x5a206241,0x7ae36260,0x51c36260,0x41613900,0x28a03920,0x49c24982,0x10003901,0x5a663961,0x49c56288,0x394228c0,0x184020a0,0x18601020,0x31013101,0x520520a0,0x5a883123,0x0800a4d2,0x18c10000,0x20c13943,0x10201000,
-0x620159a0,0x726359a0,0x61e16a41,0x726361c1,0x724361e1,0x724361e1,0x72436a42,0x49817263,0x39004981,0x49813940,0x59e34981,0x5a014960,0x726051a0,0x9b627a80,0xb4477a40,0xabc57220,0xbc0a8261,0x93239302,0xac077220,0x7a00a343,0x93447220,0x8ac17240,0x51807220,0x620159e0,0x51c05180,0x82c37281,0x6a016a40,0x72a159c0,0x61c08b06,0x83087ae8,0xffbf9307,0xdebba4f4,
-0xd67d9474,0xbdb994d5,0xbdd9b598,0x8434b5b9,0x9474a538,0xad38730d,0xc61cb599,0xb579ad58,0x632e9496,0xc63ca4f7,0x832ba4f4,0xa517940f,0x738ebe1c,0x730fa4b1,0xd69b9c93,0x2145b5fc,0xe6ffef3e,0xce5dde9d,0xde7b8b6d,0xcebec69e,0xad7ace9e,0xbe3d9d19,0xb5dcadbb,0xbe3dbe3d,0xbe1dbe3d,0xbe1dbe1d,0xbe1dbe1d,0xbe3dbe1d,0xbe3dbe3d,0xbe3dbe3d,0xbe3dbe3d,0xbe3dbe3d,
-0xbe3dbe3d,0xbe5dbe5d,0xc65dbe5d,0xc65dc63d,0xce5dbe1c,0xbdfc6310,0xbe1bb59a,0xbdb97bd2,0x834d4a4a,0xd69ecdfb,0x8c12de7e,0xcd955a8c,0x93b151e6,0x8aea8bd1,0xff9f4125,0xffff0843,0x5a49de7a,0x39247aec,0xc65a7b50,0x1883acb3,0x9c55b537,0xdf3ee71e,0xbd98cede,0xffff49e7,0xe75fe75f,0xffffbd96,0x5224c5f7,0x7aa47a83,0x93699327,0x832672a3,0x8bab8b49,0x5962ac4e,
-0xac6f7ac9,0x7b49ac8d,0x6204ac2d,0xfffd6a66,0xfff9ffdb,0x8300ff99,0x72a08320,0x6a4172c0,0x6a616a60,0x62406a81,0x72c36a81,0x62216242,0x51a06241,0x93826a41,0x6a807b01,0x49406a81,0x51c251a2,0xa4ae5203,0x5a455203,0x39203921,0x20404983,0x5a465a26,0x5a265a26,0x10606268,0x00000800,0x08200800,0x28801020,0x18c020c0,0x41832901,0x080018a1,0x000020c2,0x42033121,
-0x59805180,0x72636a42,0x6a426a41,0x61e16a42,0x61c059c0,0x62005180,0x7aa46200,0x49815180,0x49614981,0x41604981,0x49613920,0x59c14960,0x6a406a62,0x8ae17a60,0xabe78280,0x69c0a3c6,0x93258282,0x72613860,0x93449304,0x7a609303,0x72407ac1,0x93229b85,0x62216a00,0x51a05180,0x72636a63,0x7a8072a2,0xac2e7264,0xac309c2f,0x734fbe5a,0xbe1ca517,0xc65dbe1c,0x7c14be3c,
-0xadbbce9d,0xad58ce9e,0xad99b5da,0xb5ba9d17,0x7b90ce5c,0xad59d619,0x8c54be3c,0x8c759496,0x7bf1a518,0x949483d2,0x62abc67c,0xad386b2f,0x5acbb5b9,0x6b9183ce,0x7b6f524b,0x83f4ce7c,0xc61c5acf,0x73d3c63c,0xf73e61e7,0xbe3dbe5d,0xb5dca539,0xad9bb5dc,0xb61cb61c,0xb5fcb5fc,0xb61cb5fc,0xb61cb61c,0xb61cb61c,0xb61cb61c,0xb61cb61c,0xbe1dbe1d,0xbe1dbe1d,0xbe1dbe1d,
-0xbe3dbe3d,0xbe3dbe3c,0xbe3dbe3d,0xb5fbb5fc,0x9cf7be1c,0xbdfaad79,0xce7ec5fb,0xd67cb578,0x9c934187,0xbdfae6bd,0x83f23989,0x62287bd1,0x628b30c2,0x51e65a8c,0x7bd049e6,0xd67cc5fa,0x08016b0f,0xef1c5a6a,0xad58630f,0xc61a9496,0x8c1583f3,0xffdfde7d,0x6b0bc65b,0xef5f49c9,0xe73fe75f,0xd69de71e,0x9450d6bc,0xa40d940e,0x9ba68b48,0x51407280,0xb4d06a66,0x61a293aa,
-0x7acb6226,0x62056a67,0xcd74bd11,0xa4505a06,0xb52d51a3,0x8b81c550,0x7ae09bc2,0x7ac08340,0x72c159e0,0x72a16a80,0x6aa07b23,0x624059e0,0x836359e0,0x93818342,0x7ae28361,0x72c38343,0x62016a00,0x41004120,0x39213900,0x30e02880,0x180030e0,0x49a43943,0x31004182,0x000028a0,0x18c20800,0x00000000,0x08001861,0x52481860,0x100028e2,0x39201840,0x08003142,0x00000020,
-0x598061c0,0x722282a4,0x72227222,0x72217201,0x82a17241,0x7a208280,0x72a371e1,0x49614120,0x49604960,0x414049a2,0x41404120,0x59e15181,0x7a8272c3,0x9b438ae3,0xdd4ca3a5,0xd4ebc449,0x5980fe51,0x69e0c489,0xb4699b86,0x6a009365,0x8aa08b03,0x8a837a60,0x61e27220,0x620259e0,0xa4b06244,0x730d8bf1,0x9cb56b4e,0x6b10a497,0x838fbdba,0xd6ffc67c,0x83f3b5ba,0xcddad63c,
-0x7c3494d6,0x949483f3,0x8c55a538,0x9495ad79,0x730e7bd3,0xb59a626b,0xa538b5db,0x94d77392,0xad9a94b6,0xc5fba538,0x9c949d39,0x631083f3,0x42057bf3,0xbe1b8c0e,0x732d7330,0xb5dcbdb9,0x84769cb8,0x5b53ad9a,0xa4b54146,0xbe1da57a,0xbe1dbdfc,0xb5dcb5dc,0xb5fcb5fc,0xb5fdb5dc,0xb5fcb5fd,0xb5fcb5fc,0xb5fcb5fc,0xb5fcb5fc,0xb5fdb5fc,0xb5fdb5fd,0xb5fdb5fd,0xb5fcb5fd,
-0xb61cb5fc,0xbe1dbe1d,0xbe1dbe1d,0xbe3cbe3d,0xa5179d17,0x4a6bad99,0xce5b5aef,0xef5fe6de,0xdedd49e9,0xb5776b4f,0xa517526b,0x6ace3988,0x7b4ed5da,0xa516c5b8,0x7370d67c,0xbdbbc63a,0xbdb9b539,0xa4f2bd56,0xce9ce6fe,0xc61b2989,0xce1ae73f,0x8c33f75f,0x28c2bd79,0xdedf5a6a,0xe73fdf1f,0xe73fdeff,0xc639c63b,0xcdd9d6dc,0xa40a93ca,0x72449321,0xcd6fa40d,0xff1a82e6,
-0xc57438e0,0x832bb514,0x62478bac,0xbd53c552,0xa42b940d,0xc5507288,0x72a059e0,0x93628300,0x72807b00,0x7ae17b03,0x72c08321,0x8b418321,0x93a38321,0x83218b62,0x41407b21,0x72c25a20,0x72a36a81,0x518259e2,0x49c338e0,0x41404141,0x418330e0,0x49a33100,0x51e55225,0x20a128e1,0x08000800,0x00000000,0x00000000,0x08400000,0x28a03122,0x49a32860,0x20603922,0x31633984,
-0x59a159a1,0x61c082c4,0x61c07241,0x8b0382a3,0xabe58b02,0x93209342,0x61c27220,0x49814100,0x41603920,0x39003920,0x41204981,0x49804120,0x8ae46a62,0x93038ac3,0xdd0ce56d,0x6180a3c7,0x728361a0,0x7a827262,0x82e37a61,0x51a193e7,0x8b6c3080,0xa3ea7288,0x622559a0,0x72cb6aa7,0x62aea4b4,0xc67da55a,0x41cbc61b,0xa558a5b9,0x4186bdf9,0x52ce9c34,0x4a2b94d6,0x9452acf6,
-0x84359cb6,0x94958415,0x94d7a538,0x8c548434,0x3947a518,0x9cf78370,0x845594b6,0xa538a538,0x41eb8c33,0x6b0f6330,0x524bad9b,0xad7a7bd2,0x7bd17414,0x9cf4bdb7,0x5a8c7370,0x8c76ad37,0xb5fc9cd8,0xb5fdbe1c,0x6aee624a,0x9d39a57a,0x9d19a55a,0x9d39a57b,0xadbbadbb,0xb5fdadbc,0xad9badbc,0xb5dcaddc,0xaddcaddc,0xb5dcaddc,0xaddcaddc,0xb5dcb5dc,0xaddcaddc,0xb5dcaddc,
-0xb5fcb5fc,0xb5fcb5fc,0xb61cb5fc,0xc65eb61c,0xa539b5db,0xad98b5db,0xadb99d18,0x41a77bd1,0x6b4f5229,0x0044c63c,0x8c56a538,0x7350c5db,0x9453acd5,0x632f9cd5,0xa537d6bd,0x9cb4bdfc,0xa537b599,0x83f25a8b,0xbe1abdd9,0x6b705b0f,0xd69e9cd6,0xad798434,0x4165ef1e,0xb5ba2926,0xdf1fd6de,0x9cf6defe,0xce9cdeff,0xce5ddf1e,0xf697a493,0x72a36a20,0xffbd7b4b,0xff1b4983,
-0x6a688b8c,0x51a5c513,0x41c5bd32,0x72eba4d2,0xac8a3922,0x51a06a82,0x8b6451c0,0x9be48301,0x7b218341,0x9c068321,0x8b838b62,0x83448ba3,0x93e87b22,0xa46acdcf,0x49a21800,0x310049a0,0x49806a64,0x59e051a0,0x5a0351a0,0x494051c2,0x39414141,0x39014162,0x28c03120,0x41a35204,0x28e049e3,0x20a21020,0x00000800,0x00000000,0x10400000,0x28e03102,0x51e54183,0x29014183,
-0x6a406200,0x7a836a21,0x7a8269e0,0x72208ae3,0x8ac18ae1,0x9b029b82,0x49207220,0x49614961,0x49804960,0x392072c6,0x30c04980,0x59e238c0,0x8ae46242,0x8ac39304,0xa345d4ec,0xff7959a0,0x4120a3ea,0xac2c5982,0x9c319b8d,0xf75fad18,0x9cb4ad59,0x51828b6d,0x72c94120,0x28c79c71,0x6acfc5fa,0x9d17a538,0x9476b579,0x7370d6de,0xb53749a9,0x9cb6a579,0x632ebdfb,0x5a6a6b0d,
-0xa5188c14,0x9cf76b93,0x94b694b7,0xad587c14,0x41a7b599,0x94b68bb1,0xad598c96,0x7bf3a538,0x7b91734f,0x62ce8434,0x8bd18476,0xad9bbddb,0xad7aaddb,0xbd99ad37,0x632f83d4,0xa4d762ef,0xa55a7bd4,0xcebf9d19,0x6aee626a,0x8c7694f8,0x94f9ad7a,0xa57a8477,0x7c358c97,0xa57b8cb8,0xadbbadbc,0xadbcaddc,0xadbbadbb,0xadbcaddc,0xaddcadbb,0xadbcadbc,0xaddcaddc,0xadbcaddc,
-0xaddbaddb,0xb5dcaddb,0xb5fcb5dc,0xad9cb5fc,0x8c76ad7a,0x9d38ad7a,0xadb99d39,0x3103c61a,0x7bb21020,0xb5dbc63d,0xa53bad9a,0xa4f6d69f,0xff9f4189,0xd6bed6bd,0xbe1cb5da,0xde9dc63b,0xb5d98c94,0xce5d528b,0xad78c63b,0x8434c65c,0x8c9794b5,0xbe1dc65b,0x4145ffbf,0xc69d9495,0xd6bed6bd,0xce9dd6de,0xdf1fdefe,0xcefdce9c,0x8b88bdd8,0x49a259a1,0xa533b514,0xf71b6a68,
-0x7ac98bad,0xac705143,0xe6576267,0xfffe8b8a,0x7ae6ff1c,0x93a95a40,0x72a37b26,0x8b856a63,0x622059c0,0x8b8493a4,0x93a393c4,0x8ba38b62,0xa46d8365,0x6ae78389,0xffffd69b,0x2881b4d7,0x72a57ac7,0x498051c0,0x59c272a6,0x59c26a44,0x414151c2,0x41624182,0x39615a27,0x39623961,0x204028a0,0x20611000,0x00001000,0x00010000,0x00000000,0x39621040,0x39223963,0x39424183,
-0x6a225980,0x6a217241,0x72417241,0x7a817220,0x8ae282c2,0x8260bc68,0x41406a01,0x498149a2,0x49a24981,0x49807ae5,0x49614140,0x62235181,0x724472e7,0x520959e4,0xa40d942e,0xcdf99c10,0xe73fbdb8,0xcdfad6be,0x8c973946,0xdebebdfb,0x7b4ed65d,0x69e7832c,0x31c72060,0x628a5acd,0xeefebd58,0xc63b296a,0x73918413,0xb5b9a558,0x4a0d7bd2,0x94b541eb,0x6b0e7350,0x83b262ce,
-0x947683f4,0x951894b7,0x8c9694f8,0x8c137bb2,0x62ad9495,0x7bb29cb6,0x6bb2b59a,0x630fa539,0x94965aee,0xce3b9d18,0x5acea538,0x8455ad17,0x8c736372,0x94b6bdf9,0x94b68c76,0x8454ad79,0x9d3994d8,0x73f69d38,0x20e783ae,0x73f59cfa,0xa57b8cb8,0x9d1aa57a,0xa57b8cb8,0xa59ba5bc,0x9d5ba5bc,0xa59ca5bc,0xa59ca59c,0xa59ca59c,0xa59ca59c,0xa59ca59c,0xa59ca59c,0xa5bba5bb,
-0xadbcadbb,0xadbcadbc,0xaddcadbc,0xb5dcaddc,0xa539ad9b,0x8c9a94b7,0x630f9498,0x39881064,0xa539ad7b,0xbe3d7c14,0xc65eb5db,0xbdba6350,0x29698c54,0xa559a559,0xc61c94d7,0x52b0d6be,0xb5dab5fb,0x9d18e71f,0xb5faad78,0xc65dc69c,0xc67dc65d,0xce9dce7d,0x41459451,0xbe3d9495,0xb5db9d39,0xdeffd6de,0xd6ded6de,0xdefedefe,0x2020d69c,0xacf35184,0xef3ece7b,0xb4b3832e,
-0xff9d8b09,0x6a8ac63a,0x944fd637,0x940dc5f8,0xbd11838b,0x944f7329,0x52216ae4,0x49e049e0,0x730549e0,0x626049e0,0x51c07b01,0x7b43ff17,0xf7bf72e3,0xffffbd97,0xf79ec5f7,0xd6bcf7bf,0x38a0ffff,0x6a8272c5,0x72c672a4,0x62226201,0x6a2361e2,0x39005a23,0x49633920,0x416128c0,0x30e03942,0x20603101,0x10001000,0x20801020,0x08002061,0x5a883163,0x31203100,0x20801820,
-0x59a061e0,0x82a37241,0x72217221,0x7a6169e0,0x7a827a81,0x72208ae3,0x41614900,0x41404160,0x49814160,0x28606244,0x59e34981,0x5a2351c4,0x28c7eebb,0xce9cdf1e,0x9cd7ffdf,0xadda8c96,0xc67ca578,0xb5d9bdfb,0x8c998bb0,0x1044ce5c,0x72cb5a4f,0x5163a40e,0x08843145,0xa4b4a455,0x72ebffff,0xa4f80844,0x5aaea4f7,0xce9d7bf2,0x8bf239ca,0x839041c8,0x83f249c9,0x8c349c95,
-0x843494d7,0x9d599cf8,0x84149d39,0x7bb20003,0x6b50a4f7,0xb5799c74,0x73d57bf4,0x7bb37bf2,0x949773b2,0x8c547bd3,0x73d394d8,0x84769475,0xad7a9518,0x94b6c61b,0x845594f7,0x94d7a559,0x7c568456,0x95188476,0x5aae62cb,0x9d198458,0x8477adbc,0x7c369518,0x94f994d9,0xa59b9d5b,0xa5bc9d5b,0xa59ba59b,0xa59ba59b,0xa59ba59b,0xa59ba59c,0xa59ca59c,0xa59ca59c,0xa59ba59b,
-0xad9bad9b,0xadbbad9b,0xadbcadbb,0xad9badbc,0x94d8b5dc,0xad9a94d8,0xb5793a2c,0x4a4bb599,0xb5bcadba,0xb5fcbdfc,0x5b52be1c,0x8475be7c,0xbe1cb5db,0xb5dbb5db,0xc63ca539,0xb5fc9d39,0xce7ebe3d,0xb5fb73f5,0xbe1b8cb8,0xbe1cc65d,0xc65cc65d,0x8454b5da,0x08a33944,0xb61badba,0xd6dece9d,0xd6bdd6bd,0xd6bdd6de,0xd6bdd6de,0x41a4df1d,0xb53551a5,0xb556f79f,0x834dd618,
-0xc553936a,0x5a265a27,0x83adacf2,0x940eff9d,0x7b8a62e8,0x94b1b595,0x73465244,0x52615240,0x5a425a62,0x62a062a1,0x6b227303,0x5a427b66,0xbe7a7b47,0xde5bef7f,0xbd95f73d,0xffdff7be,0xbc6fffdf,0x9bcbff9a,0x7ae751a2,0x6a626a42,0x61e261e1,0x7b46b4ce,0x62455a24,0x49824182,0x41623921,0x28a04162,0x28e028c0,0x10402080,0x18602901,0x41c51060,0x30e16aca,0x30c21000,
-0x512061e0,0x830561e0,0x7aa28ae4,0x61c06a00,0x82c47221,0x6a027242,0x41604120,0x39414161,0xff7f4142,0x48e0fffe,0x41404140,0x626649c1,0x8476c5dd,0xdf5fbe7e,0xad7ace9c,0xe77fbe1b,0xad59c65d,0xad596310,0xa4d7ad15,0xad5983d4,0x838fc59a,0x4102a42f,0xa4d43185,0x624972ed,0x734f526b,0xc65d5a8d,0x4a2c6b30,0x5a8d62ef,0x628c522c,0x72ac624a,0x9cd6834e,0x8c547370,
-0x7bf37bd3,0x7c1594d7,0x3a0c73b3,0x7b729cf7,0x4a4cad79,0xad599cb6,0x949773d3,0x73928c35,0x8c7694b7,0x949652cf,0x6b5194d7,0x8c977bf3,0x955a9cf8,0x9d199c94,0x73f5a55a,0x8c7794d9,0xa59ca57b,0x8cd96b72,0x29095a8b,0x84566b93,0x94d89cfa,0x84777c15,0xad9ba57b,0x7c578cd9,0xa57b9d7b,0xa57ba57b,0x9d7b9d7b,0x9d7ba57b,0xa57ba57b,0xa57ba57b,0xa59c9d7b,0xa57ba57b,
-0xa59ca59c,0xa59ca59c,0xa59ca59c,0x84b8a5bc,0x8cb863b4,0x94b88476,0x73d38c97,0x31258432,0xa55ab5ba,0x633394d7,0x9d1973f3,0x9d39addb,0xb5dbadbb,0xbe3da559,0xa57aa559,0xadba8454,0xb5fcb5db,0xbe3d9d59,0xadbba57a,0xc63dc65d,0xbe5cc67e,0xd6ddbe1d,0x4a8d3144,0xbe3cc65d,0xcebec67d,0xcebed6de,0xce5dbe3c,0xce5cd6be,0x4143c5f8,0x41a74164,0xbdb839a7,0x9c72524a,
-0x62cbacf2,0xf77fb576,0x62ea732e,0xe6fcad34,0x4a27ad12,0xc5f79cb1,0x8387730b,0x5a425a62,0x52225223,0x62c049e0,0x49e07b23,0xd67bd658,0xe77fd69e,0xffffffff,0x5a03a40d,0xff9eff7c,0xfffd4124,0x51628ae7,0xbd73ffff,0x72e6c551,0x62438347,0x51a151a0,0x72c76203,0x5a046a65,0x30c051c3,0x39003920,0x30e04143,0x28c14142,0x39221000,0x39831000,0x41c53983,0x28a030e0,
-0x51406a20,0x59c061e0,0x59606a01,0x61e161e1,0x8b4882e6,0x390061c3,0x41414121,0x39444983,0xad17b5b8,0x49007bd0,0x49414121,0x5a2449c2,0x5b700002,0xcebdc69e,0xc65dc67d,0xf7ffb5da,0xe73f4a8d,0xd69ebdfc,0x7b508c34,0xad79520d,0xcdfab5b9,0x30805985,0xb59a2146,0x9c958c32,0xc61bad9a,0x8435522b,0x63108434,0xad378414,0x72ec62cc,0x7b6f8bb0,0xad598c34,0x9cd78c55,
-0x6b938c76,0x9d198cb6,0x94b76b72,0x7b729d17,0x18c6c63c,0x8c769476,0x845594d7,0x9cf88c96,0x633173b3,0x8435a539,0x7bf38435,0x84569cf7,0x8d1a9d19,0x94f8bd78,0x94faa57b,0x9d3a8498,0x953aa59c,0x957c6b93,0x7b515aab,0x8435bd99,0x73f5ad7b,0x94d89d19,0x8cd88cb8,0x9d5a953a,0x9d5b9d5b,0x9d5b9d5b,0x9d5b9d5b,0x9d5b9d5b,0x9d5b9d5b,0x9d5b9d5b,0x9d5b9d5b,0x9d5b9d7b,
-0x9d7b9d7b,0xa57ba57b,0xa57ba57b,0xa59ca59c,0x9519a59c,0x84779d5a,0x31eb7c56,0xb55710e6,0x9d18528c,0x8c77ad9a,0xa57a9d38,0xa57ab5dc,0xb5fbb5dc,0xb5fca57a,0x94f8ad7a,0x94d88c76,0xbe3caddb,0xb61d9d39,0xb5fcb61c,0xc63dbe3d,0xc67dc65d,0x8453c65e,0xb5fb2926,0xc65dbe1c,0xc65dce7d,0xce7dce9d,0xc63cc65c,0xce5cc65c,0x3924c5d8,0x8c135228,0xef5fce9b,0xc5f95ace,
-0x7370bd78,0xce5ba536,0xa4f5bd9a,0xffdf9cd5,0xc5f9d65b,0x632c8c32,0x6ae841c6,0x7348732a,0x6ac66b06,0x5a80b50f,0x62a47324,0xffffff7d,0xef9ff7be,0xf7bfffff,0x7b068bcc,0xf73dde54,0xfffeacd4,0x9bacf635,0xffffb4f1,0xf77dacd2,0xd637ffff,0x41416268,0x72c76a65,0x59e272a4,0x51c272c7,0x414151e3,0x49c34142,0x28a030e0,0x20604162,0x28a02040,0x396249c4,0x416328c1,
-0x514059c0,0x72846222,0xcd6f4120,0xcd76ac4e,0x7a883924,0x4921d5d5,0x41424141,0x31e94143,0x49a9ffff,0x40c1b4f4,0x41614141,0x51e44983,0x5bb31800,0xa57ab59a,0xbe5cc67e,0xc65d73b3,0x9cd7ad7a,0x63317392,0x9475f77f,0x5aad83f2,0xacd49cf6,0x416551a5,0xce7e4bb1,0xad59bdfb,0x9d17be1c,0x420b41eb,0xa5384aae,0x83b141eb,0x524b7b4d,0x6b0f83d1,0x84358c96,0x8c769d19,
-0x94d88cd7,0x52aeb5da,0x9d399d3a,0x6310424c,0x7bf394f8,0x845694b6,0x94f88c97,0x9cf894b7,0x73f58436,0x7bf48c97,0x73b38c76,0x84568455,0x6c34a57a,0x9d1ab518,0xa59c94d9,0x9d7b953a,0x9d5ba59c,0xa57a7c77,0x6b719c74,0x94b7ad16,0x63937bf4,0x63537c36,0x94d994f9,0x951a953b,0x9d5b9d5b,0x9d5b9d5b,0x9d5b9d5b,0x9d5b9d5b,0x9d5b9d5b,0x9d5b9d5b,0x9d5b9d5b,0x9d5b9d5b,
-0x9d5b9d5b,0x9d7b9d5b,0x9d7b9d7b,0xa59b9d7b,0x9d7a9d7a,0x8c9684b7,0xb5bb7c35,0xe71f2149,0x41ca6331,0x6b94bdfa,0xb5db9d38,0x9d59a59b,0xa57badbb,0xb5dc9d19,0xad9bb5dc,0xaddb9d39,0xb5fcb5fc,0xbe1db5dc,0xadbbaddb,0xb61dbe1d,0xb5fcbe3d,0x0000b5fc,0xbe5e0043,0xbe3cb61b,0xc67dc67d,0xbe1cbe1b,0xbdfc8458,0xad78defd,0x31032881,0xc67c31a7,0xd69dc63c,0xce9d7bf2,
-0xce9db579,0xce9c5af2,0xad37d6de,0xc65a9c94,0xa517ef5f,0xd6bcdedb,0x8c53d69a,0xad54e6db,0x41e35224,0x5a24ce37,0x73265201,0xffffb531,0xef3f3967,0xf77eef5e,0xff9eff5e,0xfffe51e3,0xde37ff9f,0x59a49beb,0xffff8bae,0xd5b3cdb6,0xffdfff19,0xffbfffff,0x41818b09,0x59c159e1,0x518259e3,0x49a24961,0x5a4651c4,0x392051c4,0x49833900,0x39004141,0x390130c0,0x30e128a0,
-0x59a26a03,0xbcf3b4f0,0x7b8f730a,0xeedf2086,0x4123b514,0x498359c5,0x41424163,0x4a293984,0x2084e6dc,0x38e0b4d3,0x39204141,0x49c341c2,0x114a1000,0x73d3a579,0x84964a6e,0xbe1d5ad1,0xbe1dce7f,0xad9ace9e,0x9cf8ce7e,0xde7c7b92,0x726ad5fa,0x28413123,0xa5390003,0xbdfc6b72,0xad99a57a,0x7bf37372,0x94b694d7,0x62ee7bf3,0x83f27b8f,0x83f27bb1,0x9d198c75,0x8c977c35,
-0xadbb94f8,0x73b38c76,0xa5398c97,0x84157bf5,0x6b3183f4,0x84776310,0x9d1994f9,0x94d88c97,0x84368c97,0x843594d8,0x73b39497,0x8c769497,0x7cb694d8,0x9d1aacf8,0x9d3a94d9,0x953a951a,0x9d7b8cd8,0x6bb28cd8,0xa5596aef,0x84767b71,0xa55a9cf8,0x8cb894f8,0x94d99d3a,0x9d5b9d5b,0x9d5b9d3b,0x9d3b9d5b,0x9d5b9d5b,0x9d3b9d5b,0x953b953b,0x953b9d5b,0x9d3b9d3b,0x9d5b9d5b,
-0x9d5b9d3b,0x9d5b9d5b,0x9d5b9d5b,0xa57b9d7b,0x8cd86bb4,0x84367c76,0x63528456,0x7bf20000,0xa579322c,0x18a40000,0x9d5a8c75,0x8497a5bc,0xa57a9d3a,0xad9ba55a,0x9d39ad9b,0xad9b9d39,0xb5dcb5fc,0xb5fcb5fc,0xb5fcb5fc,0xb61cb61c,0xa579be1d,0x10c4be3d,0xa57b2127,0xc65eaddb,0xc67dc65d,0xc65dc65d,0xbe1cbe1d,0xc5dabdfb,0x39826289,0xb5dc39cb,0xb5dabe3c,0xc65cbe1b,
-0xdefe9cd4,0xce9cd6fd,0xd6bed6dd,0xd6bdbdda,0xdefcce7b,0xdedeef3f,0xef5fdf1e,0x83edde9a,0xde997b4c,0xce15bd98,0x8c0abdb1,0xe73db595,0xbd34f7bf,0xef5da4b2,0xc5973923,0xe637bdd5,0xc552e698,0xffbacd11,0xf6fcee7a,0xbcd06226,0xe75bff59,0xffbfffff,0xfffc6a08,0xa3ea8b27,0x5a046aa6,0x30e049a2,0x49c55a25,0x41424162,0x39004982,0x6a6828a0,0x41614962,0x20603921,
-0x49668288,0xffdfde7b,0xe73f3989,0xc59a8413,0x726a9411,0x41644143,0x41824164,0xee99328e,0x7c2f3904,0x30c061e6,0x390030e0,0x4a2d4925,0x00451840,0xbe3aad78,0xdf5fc67c,0x63d4a55a,0xd6fec69e,0xadbab5fb,0xb5bbc65c,0x7bb4c5bb,0x4984b430,0x4105b556,0xadda8cd4,0x7311c63b,0x94b88c77,0x6b52a538,0x8c9694d7,0x63308c75,0x6330422c,0x6b507391,0x73f452cf,0x9d3a9d1a,
-0x83f3ce5e,0x7c367c53,0x8cb88457,0x84578c98,0x73928475,0x94d88435,0x8cb794d8,0x8cb78456,0x84788478,0x849694f8,0x84776b93,0x8c986b93,0x7cb88457,0x8cd9b557,0x8cda5b53,0x7c367c37,0x94d98498,0x62ef8477,0x5ad22907,0x8c558c13,0x8c969496,0x8c988cb8,0x94d98c98,0x953a955b,0x953b953b,0x953b953b,0x951b951b,0x951b951b,0x951b951b,0x953b953b,0x953a953a,0x9d3b953b,
-0x955b955b,0x9d3b9d3b,0x9d5b9d3b,0x8cd99d5b,0x9d3a951a,0xa55a9d3a,0x73b47c15,0x63717c15,0x298a8c96,0x29696372,0x4a2b0822,0xdefdff5f,0xa57a94d6,0xa55aad9b,0x6bb4ad9b,0x9d59a57a,0xaddca5bb,0xaddcaddc,0xaddcaddc,0xb5fcb5dc,0x9d7ab5fd,0x0001ad7a,0x741518e6,0xbe3db5fc,0xbe5dbe3d,0xbe5dbe5e,0xa559be3d,0x8413b5dc,0x39a51821,0xbe1aef9f,0xcebecebe,0xc67cc67d,
-0x7bf3d6be,0xad79c61c,0xbe1bad78,0xce7dd6bd,0xce7dad78,0xce7dd6db,0xdebcd69c,0xad58e71f,0x7bcfbe3a,0xd6549d35,0x8451b513,0xfffebe18,0xef5edeba,0x94728c52,0x72a6eeb8,0x9ba97ac6,0x8bae8bd0,0xbcf08347,0xbd739beb,0x9347ee34,0x9b22cd0c,0xefbebd51,0x734d51c6,0x6a23c44f,0xad55ffff,0x52080861,0x51a45a05,0x51e64984,0x51e44161,0x51c151e2,0x49a04140,0x49813920,
-0x310540c2,0xd67b9495,0xd6df630f,0x83f3b5ba,0x4945c5b8,0x41a549a5,0x29264185,0xeefdcf3f,0x94d66a8d,0x30e038a1,0x394230e0,0xa5594983,0x10e64968,0x8c948475,0x3148c65c,0x00223989,0xe71f31ea,0xce9ed6de,0xa538ad7a,0x00007b92,0x51e87a69,0x49666acd,0x424c4a8b,0x7bd4ad78,0x84569cf8,0x73b38415,0x73b26351,0x84355b30,0x73d36b72,0x5aef5b10,0x84576bb3,0x95189d39,
-0x63310004,0x84989518,0x94f99d1a,0x6b9494d9,0x63527c35,0x9d397c15,0x7c369d19,0x94d88c97,0x8c989d1a,0x9d198456,0x8cb873d4,0x8c988477,0x74989d1a,0x8cd98c12,0x74178498,0x953a8cd9,0x845673f5,0xad38a55a,0x9cf983b2,0x6b2f9c75,0x7bd4528c,0x84776393,0x94d994d9,0x953a8d1a,0x951a951b,0x951a951a,0x951b951b,0x951b951b,0x951b951b,0x951a951a,0x953a953a,0x951a953b,
-0x953a953a,0x951a951a,0x953a951a,0x9d3b953a,0x9d5b9d5b,0x8c778cf9,0x73d473b4,0x6bb25af0,0x84566b93,0x63527bf6,0x8cb7296a,0x8cd87c56,0x73d4ae1d,0x9d188c97,0x84355af0,0x8cd85af1,0xa5bba59b,0xadbbadbb,0xaddcadbb,0xaddcadbc,0xb63cb5dc,0x2925c63d,0xa57a2128,0xbe1db5fc,0xbe3dbe3d,0xbe1dc67e,0xa559b5fc,0xad57b5dc,0x31662082,0xd69dc67d,0xce9dc65c,0xbe1bad9a,
-0xc61cce7d,0xc65dad99,0xc65cd6bd,0xce9dd6bd,0xce7cd6de,0xbdfbe73f,0xdedf2949,0xbdfbdede,0xffffc65c,0xa4b2df3e,0xef7feefe,0xdebcd69b,0xad77e71d,0xffbff79f,0x8bc87b6b,0x83658b66,0xac8f8bca,0xcd71a42d,0x5a02d5b1,0xddb3c511,0xfed67a64,0xff9ce631,0xef3d4184,0x9c528bae,0xffffb597,0xfffeffff,0x49a25205,0x49844141,0x628649c2,0x626451e2,0x93cb6246,0x41606245,
-0x39c94966,0xd6fee7bf,0x94f994b6,0xbddaadba,0x4185ad56,0x41e649c6,0x220b41c5,0xadb7a5ba,0xd69d734f,0x390138c2,0x41633901,0xb6de3123,0x08a4f67a,0xbe3c216a,0xb61ae77f,0xadba73d4,0xffffd6bd,0x18c69cd6,0x00010002,0x726abddb,0x5a494944,0x3904ac70,0x6b1041e9,0x31ecad98,0x847552ce,0x84346332,0x94d78c76,0x7c359d5a,0x7c358cd8,0x73f48476,0x8cba9d5a,0x29ca8cb7,
-0x9d9b7c14,0x9d7b84d9,0x94f994f9,0x94d894d9,0x7c367c16,0x9d3a8cb8,0x84768477,0x94f98cb8,0x94fa94fa,0x8c988457,0x8cb88456,0x8c988cb7,0x7cb99d3a,0x951aacf7,0x94fb8cd9,0x8cd88cf9,0x845573f4,0x7bb27c36,0x73b18bf4,0x7bb341ab,0x8c7683d3,0x7c367415,0x94f973d5,0x953a951a,0x8cfa951a,0x951a951a,0x8cfa8cfa,0x951a8cfa,0x951a951a,0x951a8cfa,0x951a951a,0x951a94fa,
-0x951a8d1a,0x951a951a,0x951a953a,0x951a951a,0x953a953b,0x8456953a,0x8c777bf5,0x635152f0,0x843652b0,0x8cb7ce5e,0x6b728d18,0x8c988434,0x0003a57a,0x7bf32949,0x7392420c,0x5b348476,0x9d7a9519,0xa59ba59b,0xad9badbb,0xadbcadbb,0xa5daaddc,0x18c2ad99,0xa57a73b2,0xb5fcb5fc,0xbe1cb61c,0xbe1dbe1d,0xc65ea55a,0x4a2ac65d,0x28e828e2,0xc63cd71e,0xbe1bbe1b,0xce7ebdfc,
-0xce9da558,0xb59abe1b,0xce7cbe1b,0xc65cb5b9,0xce7cce9d,0xd6fda53a,0xcebbcebc,0xd69dd69d,0xf79fd6df,0x9cd3e77f,0xd6bde73e,0xef7ec61a,0xf7bfdefe,0x8c11ffff,0x73089412,0x83887307,0x7b077b46,0x6aa58b45,0xa42b7b06,0xcdb1f6b6,0xd6589b67,0x9b2aa2ac,0xf7ff4163,0xffdfef7e,0xffdfef5e,0xff7cf7be,0x51a461a4,0x5a0530a0,0x49c249a0,0x52024160,0x49a25a24,0x624451e1,
-0x53924186,0x7c548cb5,0x8c979d18,0xcdf9b5ba,0x49c651a7,0x49a549a6,0xb61d39c9,0xbe3bb5fc,0xce189412,0x39003080,0x39223900,0x5b720864,0x2063ff5e,0xc63bc6df,0x10869cf7,0x73f40003,0x73b3ffff,0x8cb86bb2,0xd67ebdfb,0x2861f6ff,0x30e26249,0x28c23923,0x736f41ea,0xadb9528e,0x73d25aef,0x94d66371,0x53116372,0x7c368cd8,0x8cf98497,0x8cd97c57,0x9d5a8498,0x8c760005,
-0x7c378c98,0x955b953b,0x84788478,0x9d1a7437,0x84778cb8,0x9d7b8c97,0x7c368cd9,0x73f56bd5,0x9d3a8cb8,0x84988cd9,0x84978cb8,0x94fa84b8,0x74b7951a,0x953aacf9,0x84779d3b,0x6b9473f6,0x7bf46bb3,0x62ce6331,0x4a0b49ea,0x735041cb,0x73937bd3,0x8cd97c36,0x8cf98cd9,0x8cfa951b,0x951a8cfa,0x8cfa8cfa,0x8cfa8cfa,0x8cfa8cfa,0x8cfa8cfa,0x8cfa8cfa,0x8cfa8cfa,0x8cfa8cfa,
-0x951a8cfa,0x8cfa8cfa,0x951a8cfa,0x8d1a8d1a,0x951a951b,0x6bb48498,0x635373d5,0x5af06b93,0x843652b0,0x7c354a6e,0x6bb28cd8,0xa59bb5fb,0x74158c97,0x216a4a8f,0xc63f214a,0x9d5aa559,0x953a9d5a,0x9d7b9d7b,0xa59ba59b,0xad9ba59c,0x9d7aadbb,0x28e30003,0xaddbcedf,0xb5dcb5dc,0xb5fcb5fc,0xb5fcb5fc,0xb5fcbe1d,0x2084a53a,0x4aaf18a2,0xe77fce9f,0xbdfc8cb7,0xbe1c7c34,
-0xbddbce7d,0xb5babdfb,0xbe1bb5ba,0xc65cce7d,0x94f8d69e,0xcebcd6df,0xce9dd6be,0xd6bdc65c,0xe75ed6bd,0xad16debe,0xdf1ed6bd,0xdf1ece7b,0xb5fae73f,0x9cb3d6dd,0x9c91e6fd,0xc592732a,0x9c2b6245,0x59e26222,0xb4d1b4ce,0x82c5e654,0xddb0cd2a,0xffbeee57,0xef9d5205,0xef7edebb,0xfffff7bf,0xc3cde6dc,0x596261e5,0x72438309,0x5a456a46,0x49814960,0x49805a22,0x624459e2,
-0xa67d00c6,0xce9eb5db,0xbe1dc67d,0x82cdadf9,0x49c641a5,0x41c64985,0x9d7a322b,0xb5fcbe1c,0x7249d5ba,0x392138c1,0x39224121,0xb63d012b,0x48e3df1f,0xb5dd2ad0,0xb5babe5d,0x6b739496,0x9d18e75f,0xad9a0845,0xa4f7a59a,0x18a3edf8,0x9cb48412,0x418630e3,0x62ee736f,0x94b6212a,0x8cd76b72,0x52d09d18,0x8cb77c14,0x95399d5a,0x84b88cf8,0x953a9d5b,0x0024951a,0x7c777c56,
-0xa59a8477,0x84b88cfa,0x951a9d5b,0x7c168498,0x8c988457,0x951a5b52,0x8cfa9d5b,0x7c588499,0x94f98cb8,0x8cf98cf9,0x8cb98cfa,0x94fa8cd9,0x7cf8951a,0x8498acf9,0x7c377c77,0x73d55b33,0x5af073d4,0x49ea6b72,0x737173b1,0x6b3018a7,0x7bf473b3,0x743773d5,0x8cfa8cd9,0x8cfa8cda,0x8cfa8cfa,0x8cfa8cfa,0x8cfa8cfa,0x8cda8cfa,0x8cda8cfa,0x8cda8cda,0x8cda8cda,0x8cfa8cda,
-0x8cfa8cfa,0x8cfa8cfa,0x8cfa8cfa,0x8cfa8cfa,0x951a8d1a,0x73f78cb9,0x7c558478,0x3a0c8cb8,0x73b47c36,0x63338c77,0x84783a0f,0x6bd36bb1,0x845673d5,0x74356352,0x951a7436,0x10c700a7,0x953a8cd8,0x9d7b9d5b,0x9d7b9d7b,0xa57ba57b,0xa57ca59b,0x18632126,0xadbca55b,0xaddbaddb,0xb5dcb5dc,0xb5fcb5fc,0x94f8b5fc,0x2083b5d9,0x6bb21082,0xad5ba558,0xc65dc63d,0xad9a424d,
-0xb5dac65c,0xb59ab5db,0xce5dbdfb,0xad99ce7d,0xc67cd69e,0xc67dcebe,0xd6bdd6bd,0xce9dd6be,0xd6bdce9e,0xa4b5de9e,0xdeded6dd,0xd6bdd6dd,0xdf1dd6fe,0xd67cce9b,0xce1bef7f,0xd67a39c7,0x9c4dffdc,0x7b688367,0xff197308,0xacf0730a,0xac2693c8,0xbccc8b22,0xbd738b47,0xe71dd65a,0xf7bfe75e,0xb3edffbf,0x40c161c6,0xc44cffff,0x92c78aa4,0x6a449308,0x38e06a66,0x51a151a1,
-0x9d7b012a,0xbdfdb61d,0xce9fb5bb,0x59a7d5d9,0x49c64206,0x092741a6,0xad9bb65c,0xe69fb5fc,0x3060b556,0x30e03100,0x41424162,0xbe3c4c16,0x40e4c61c,0xae5e00a7,0xc67cbe3d,0xb61b29ad,0xbe1c94ba,0x7b7194d6,0x73510004,0x314628e4,0x7b4f4209,0x6aed28c3,0x630f2926,0x7c35424d,0x84568c97,0x8c979d19,0xa55b6b94,0x951a8497,0x951a84b8,0x9d7b7c57,0xad9b5311,0x7c378c98,
-0x8cd98478,0x953a9d7b,0x951a94fa,0x63947c78,0x8cb86bb5,0x94b86b93,0x8cda94da,0x7c788cfa,0x8cd98cfa,0x84d98d1a,0x8cda8cfa,0x8d1a8d1a,0x74b78cfa,0x953aad1a,0x84568cf9,0x7c158cb8,0x5aefa519,0x84141066,0x6b0f6b2f,0x84357b92,0x7c34426f,0x84788c77,0x84988499,0x8cfa8cda,0x8cda8cfa,0x8cda8cda,0x84fa84fa,0x8cd984fa,0x8cda8cda,0x8cd98cda,0x8cd98cd9,0x8cda8cda,
-0x8cda8cda,0x8cda8cda,0x8cda8cda,0x8cfa8cda,0x8cfa8cfa,0x7c988cfa,0x6bb48498,0x63526352,0x8c9873d3,0x7c1631cd,0x7c3673f6,0x52d031ec,0x6bf57416,0x63535b73,0x9d3aa55a,0x9539a57a,0x94f97c57,0x9d5b953a,0x953b9d5b,0x9d5b9d7c,0xa57a7435,0x080128e5,0xa5bcdedf,0xaddca5bb,0xaddcadbb,0xb5dcadbc,0xadbcb5dc,0x18a2d67c,0xb5da10a2,0xb5fab5bc,0x6b73be1d,0x6bb26bb3,
-0x73b07bf1,0xbdfaa539,0x7c1294d6,0xb5dcad7a,0xc65c9d1b,0xc67dc67d,0xce7dce7d,0xbe1bc61c,0xe71fce9d,0xc5b8e71f,0xdefece9d,0xce9cd6de,0xdedddefe,0xd69cd6bd,0xd6dcc63b,0xce79d6bb,0xde77de98,0x946dcdf3,0x9c70ce38,0x8c0e836c,0xb4cdcd95,0xa44aee74,0x8bcca42a,0xdebcf79e,0xef7eef5e,0xfe99f7bf,0x51845124,0xab8bc595,0xb3079283,0x8a65d532,0x82e7a3aa,0x188030e0,
-0x9d595413,0xd6dfb5fd,0xa4b6bdfc,0x49a6728a,0x418549a6,0x3b543965,0xcebfce9d,0xbdfc94f9,0x3901ff1c,0x28c03100,0x49c43922,0xa55a74d9,0x59e88cba,0x8d9c0865,0xce7fae1d,0xc65e31ee,0x94f9b5dd,0xa5378c76,0x59c7bdd8,0x524a20a3,0x836f5acc,0x6acc3925,0x5aef5a8b,0x8cd773d3,0x84976392,0x5b318c76,0x8c9894fa,0x74364af1,0x8cfa9d3a,0xc67f953a,0x8cb7f7bf,0x7c378c98,
-0x9d3b953b,0x6bf79d5c,0x8cd96bf6,0x8cd97c78,0x8cd97c57,0x7bf56332,0x8cfa94fa,0x7c78953b,0x8cfa8cfa,0x8cfa8cfa,0x8cfa951b,0x951a951a,0x7cf88cfa,0x8cd983f5,0x94f97c56,0x63938456,0x39cc3189,0x63726b52,0x6b2e83f1,0x73715a8d,0x74156b72,0x5b734290,0x74167415,0x8cda8cda,0x8cd98cda,0x8cd98cda,0x84fa84fa,0x8cda84d9,0x8cda8cda,0x84b98cda,0x84d984d9,0x84b984b9,
-0x8cda8cda,0x84b98cd9,0x8cda8cda,0x8cda8cd9,0x8cfa8cda,0x84d98cd9,0x63526373,0x3a0d6b72,0x63726331,0x73d59d1a,0x6bb48457,0x73d429ab,0x84978cd8,0x84988cb8,0x951a5b53,0x6c159dbb,0x9519194b,0x951a94fa,0x951a9d3b,0x7c578498,0xad585b52,0xce5a20c3,0xa59b420c,0xaddca59b,0xadbbadbb,0xaddcaddc,0xb5fbaddc,0x290520e5,0x9d192125,0x5af1d6ff,0xbe3d5b32,0x6b939d18,
-0xe79f6372,0xbe5da55b,0x9d1ca57a,0x84368459,0xc65cadbb,0xbe3cc65c,0xce7dc65c,0xce9dd69e,0xdedebe1b,0xa4d4e6de,0xd6dece9d,0xd6ded6bd,0x9476d6de,0xb59894b6,0xd69cd69d,0xc61a9cf4,0xef1dce7b,0xf79e836e,0x9495d69b,0xf77def3e,0xd5f1eed4,0x4120cd6f,0x8365e654,0xc5d77b89,0xe71def5e,0x6123f79f,0x38a25143,0x69c261c5,0xfdcdc46b,0xf7dfab66,0x9b07ffdf,0xff9c9b06,
-0xa5dc953a,0x9518adfc,0xff5ece7d,0x41844163,0x41444184,0x8cd90085,0xb5fd953a,0x9d58bdfb,0x30c18b4b,0x30e03921,0x41653100,0xc63fb6df,0xdddbad9c,0x6d3c1884,0xb5bda538,0x84b88457,0xb5fcadbb,0xa53a39ae,0x3104acb4,0x00028c71,0x41c69cb3,0x5a8a6acb,0x7c12630e,0x73f35af2,0x84358c96,0x6bb38c76,0x8cd87416,0x7c578cb9,0x94fa7437,0x18c88d18,0x8c589d3a,0x8d189519,
-0x73fa8cdb,0x7c787c78,0x8cb98498,0x84b884b8,0x8cd98cb9,0x63b55312,0x8d1a7416,0x8cda951b,0x951b8cd9,0x8cfa8cfa,0x8cfb8cfb,0x8d1b8cfb,0x849884ba,0x7c578476,0x8c9863b5,0x4a4e8477,0x7bf4a4d7,0x428f8c99,0x524b62ed,0x5acf62ce,0x7bf56b72,0x7c586394,0x84997c57,0x8cd984b9,0x84ba8cda,0x84da84da,0x84da84da,0x84da84da,0x84b984da,0x84da84b9,0x84b984b9,0x84b984da,
-0x84b984b9,0x84ba84b9,0x84ba84ba,0x8cda8cda,0x84ba8cda,0x849984da,0x63536bb5,0x52cf6331,0x426e73f5,0x7c367c36,0x7c568498,0x6373194a,0x84b973f5,0x42b07437,0x8cf984b8,0x8cd98cd9,0x3a4f7499,0x94fa8cda,0x95199d3a,0x94fa953a,0xa536a539,0x63b42925,0x194a0023,0xadddadfd,0x29ef7c59,0xadbd9cfb,0xce5da57b,0x739318a5,0xdf5f2905,0x4ab1ad9d,0xb61ba5ba,0x4a90be3d,
-0xadbbbe1d,0xaddbc67e,0xadbbadbb,0xbdfcbe3c,0xc65db5db,0xbe3cc65d,0xbe1cc63c,0xce7dce9d,0xc61abe3c,0x62cadf1f,0xd69ede9c,0x9d17ce9d,0xc65cc65c,0xce9dce7c,0xce7cd6bd,0xb537d6bb,0xce18c5b6,0xefbeef5d,0xdebddedc,0x8b6ff77f,0x52266aac,0xa44abd0b,0xd5f2ff57,0x8c7149c2,0xdeddc65c,0x69c4ef3e,0x41664923,0xa3ab6aa8,0xece88aa4,0xff3becea,0xff7befbf,0xaba8a3aa,
-0x7cba8d3a,0xa53894f9,0x38c2ad16,0x41633922,0x21054163,0xd6ffb69f,0x8497adbb,0x8b51ad7a,0x416382ab,0x39013100,0x41843100,0xb5dd6c77,0xcddbbe3e,0x7d7c2002,0xb5dabe3c,0x216d426f,0xb5bd214c,0xe6df6b33,0x630d2883,0x737173b0,0x28c53146,0x7350acf7,0xad9973b3,0x94b87c36,0x94d87c15,0x5b1173b3,0x5b539558,0x7c788cfa,0x84994ab1,0xa51994f8,0x8c968456,0x6bd79d3b,
-0x8cfa951b,0x8cda84d9,0x951a8cd9,0x84b97c57,0x74167c57,0x74167416,0x84997c77,0x8cfa8d1a,0x8d1a8cfa,0x8cfb8cfa,0x8cfb8cfb,0x8cfa8cfb,0x7c978cfb,0x74167415,0x424f8478,0x39ec52f1,0x94976b52,0x7c7673d6,0x420a630e,0x4a4d528d,0x8c776b31,0x6bf67c36,0x74378499,0x8cda7c78,0x84ba8cda,0x84da84b9,0x84da84da,0x84da84da,0x84b97cb9,0x7cb984b9,0x84b984b9,0x84b97cb9,
-0x84b984b9,0x849984b9,0x84998499,0x84b984b9,0x84ba84b9,0x84b984b9,0x63537437,0x3a2d73b3,0x7c366bb3,0x7c777c57,0x8cd87416,0x637252f1,0x84988457,0x84b98cd9,0x8cfa8498,0x8cfa8cfa,0x4ad17cb9,0x9d3a94d9,0x8cda953b,0x8cda84b8,0x0023a55a,0xad593187,0xb5fc0024,0x951a9d5b,0xa5bca59b,0x73d5a57c,0xa5176bb3,0xbdfb1085,0xcebe20e4,0x426f8458,0x9d5a8498,0xb5fda57b,
-0xb5dcb5fc,0xb61dadbb,0xb5dbadbb,0xbe3cb5db,0xa579b5fc,0xbe3cbe1c,0xbdfbbe1c,0xc63cbe1b,0x736fb61b,0xb537b579,0xb5dac5fb,0xce9dc63c,0xd6bdc65c,0xce9dd6de,0xd6bdce9d,0xad19ce7d,0xa4d6bd79,0xc552defd,0xdefed67d,0xc6397bd1,0xf79ce6fd,0xa46cacaf,0xfffd8bc9,0xf7ff8bed,0xe73edf1e,0x5902ffbf,0x51844902,0x7a457286,0xe4ca7a64,0xc42ca220,0xf73bff1d,0x9ac8cc0c,
-0xffff4a8e,0x10404a4b,0x30a03923,0x312230e2,0x228f3943,0xbe1bce9f,0xbe3d4a6d,0xef5fbdfe,0x48c1eedc,0x39213901,0x39413921,0x6bf44bd5,0xc5fbc6de,0x010a2082,0x94f8a59a,0xa5bc9d59,0x84356393,0x30c47311,0x5b903a0c,0x526e4a4d,0x41c639a7,0x84320064,0x94b86351,0x73b6be3c,0x7c165af2,0x31ccb59a,0x7c368cd9,0x42b19d3b,0x84f9951a,0x7bf4524e,0x631473f5,0x951a7c17,
-0x8cd98cd9,0x84b97c58,0x94fa8478,0x7c778478,0x6bd58cd9,0x84787c57,0x7c788478,0x84d984b9,0x8cfa8cfa,0x8cda8cfa,0x8cfa8cfa,0x8cfa8cfa,0x74368cda,0x74378497,0x6bb58498,0x528f7bf5,0x84577bf5,0x3a4e8c78,0x6b715b0e,0x528e5acf,0x5b116b72,0x7c786394,0x74378498,0x849a7c59,0x84b984da,0x7cb984b9,0x84b984b9,0x7cb984b9,0x7cb97cb9,0x7cb97cb9,0x7c997c99,0x7c997cb9,
-0x84b98499,0x849984b9,0x84998499,0x849984b9,0x84b984b9,0x7c7884ba,0x73b463b5,0x63326353,0x63936352,0x5b325312,0x5b337416,0x84763a70,0x6bf66bd4,0x7c588498,0x74177c58,0x8cd98cd9,0x8cd98cd9,0x9d1a0004,0x7c198d3c,0x7b917415,0x18c649a8,0x28a6be1b,0x00020004,0xa55aad9b,0xa55ba55b,0xa57a9d5a,0x1021adba,0xbe1b2989,0x5b112924,0xb5fb9d1a,0xadfba5ba,0xb5fcadbc,
-0xb61cadbb,0xb5fcb5fc,0xb5fbbe1d,0xadbbb5db,0x9d18ad9a,0xc63cbdfb,0xb5bab5bb,0xbddbb5da,0x0801be1a,0xd65cbdba,0xc65dc65b,0xbe1bc63c,0xc63bbe1b,0xc65cce9d,0xd6ded6de,0xdedecedc,0xd69da4f8,0x8c2bd6fb,0xd6ddb597,0xe73edf3f,0x4965acf6,0x51e4e719,0xa4d0ffbc,0xb5fa83cf,0xdf1de77e,0x60c1e71c,0x7b2b4922,0x7202b4b2,0xccad7265,0xe5b4dc69,0xff9e82ea,0x92ccffbf,
-0x845518c6,0xd659c67d,0x30e14081,0x31223102,0x9ddd3163,0xb5fbcebf,0x19099d19,0x498e4a8e,0x4121f7df,0x31003901,0x398428e0,0xc67e9576,0xc61b955b,0x00451822,0x9d17957c,0xa55a8478,0x84369d7a,0x10633947,0x526c7bf3,0x18c5a4d6,0xad374146,0xa5373169,0x08690004,0x9d1a9d19,0x426f8455,0x526e62f0,0x52f2424e,0x6bd58478,0x002573f5,0xa55bb59b,0x73f66333,0x8cd97c57,
-0x8cfa7c58,0x7c988cda,0x84b88cd9,0x7c377c77,0x84788cd9,0x74167416,0x84ba7c57,0x8cda84ba,0x8cfa84fa,0x84fa8cfa,0x84fa84fa,0x84da84fa,0x84987c99,0x8cb98cb8,0x94b77c37,0x5b1173f4,0x7c366bb5,0x7c358cb8,0x6b726b71,0x39cc5aef,0x6b9394d8,0x7c797c57,0x7c587438,0x84b97c99,0x84b984b9,0x7cb97cb9,0x7cb97cb9,0x7c997cb9,0x7c997c99,0x7c997c99,0x7c997c99,0x7c997c99,
-0x7c997c99,0x7c997c99,0x7c997c99,0x7cb97c99,0x7c997cb9,0x7c997c99,0x6c177458,0x5b536394,0x6bf45b33,0x6bb44af0,0x6bf642b0,0x63736373,0x7c585b32,0x7c996bf6,0x953c7438,0x8cb95b54,0x8cf984d9,0x00057458,0x94f973f5,0x082373d3,0x28e71884,0x39880001,0x424d39aa,0x9d390003,0x9d5a9d5a,0x8c768497,0x1084b599,0x5a6c39ab,0x526c2904,0x9d19b61d,0x8456a57b,0xadbcaddc,
-0xb5dcb5dc,0xb5dcb5dc,0xb5fcb5fc,0xad9ab5fc,0x94d89d39,0xadbaad7a,0xad59b5ba,0xad78ad7a,0xffffb579,0xc61abd78,0xc63cce1b,0xc63cbe1b,0xbe1bb59a,0xc61cc63c,0xc65cce7d,0xd6bdd6bd,0xdefece9e,0xce5bb597,0xce9d9473,0xe73fdf1f,0xd6ddce9c,0x9c2ca4af,0x49e639a5,0xce7abdd8,0xdf1ddebe,0x4902ff7e,0x418730c2,0x69c39bcd,0xff9b3860,0xfe15ff9a,0xde5af657,0xf699fefc,
-0x74396aae,0xff1dbe3c,0x290140e1,0x20e11901,0x951732ad,0xc65ea5dc,0x29ab5b51,0x6aef8415,0x4101b57a,0x30c030e0,0x39633100,0x3ab229cb,0x94759539,0x08653966,0xa5380929,0x9d5c8c99,0xcdfa9d39,0xa55918a5,0xa4f66330,0x732f63b1,0x73503945,0x08057bb2,0x94b78497,0x41eee73f,0x000318e8,0x422c4a6d,0x428f52cf,0x63517c15,0x5ace5b0f,0x8c984a2e,0x8cfb6b94,0x63956375,
-0x7c787c58,0x84998cfa,0x74168cda,0x74167c98,0x94fa8cfa,0x6bb57c37,0x8cfb8478,0x8cda8cfa,0x84fa84fa,0x84da84fa,0x84fa84fa,0x84da84fa,0x849884da,0x73d68477,0x73f473d6,0x7c156b93,0x84778457,0x6b9352f1,0x6b7352d0,0x52b07bf5,0x52d052af,0x7c586bb4,0x7c797437,0x7c997c99,0x7cb97cb9,0x7c997cb9,0x7c997c99,0x7c997c99,0x7c997c99,0x7c797c99,0x7c797c79,0x7c797c79,
-0x7c997c79,0x7c797c99,0x7c997c79,0x7c997c79,0x7c997c99,0x7c797c99,0x74787c79,0x6c176c17,0x741573f6,0x63744ad1,0x7c375312,0x73f55332,0x7c786394,0x5b537437,0x84988478,0x19094290,0x84988478,0x8cb984b9,0x296a08a8,0x4a6b8c75,0x73b10022,0x00019d5a,0x94b40863,0x0000ad97,0x8c349cd6,0x62ceef5f,0x00661883,0x10417c12,0x18c51062,0xa57a7c56,0xa57aad9b,0xadbcad9b,
-0xaddbaddb,0xb5dcaddb,0xb5fcb5dc,0xadbbb5fc,0x94f8adba,0x9d38a55a,0x9cf7ad79,0xc5fb9c96,0x94548c34,0xb577ce1a,0xb5da8bf3,0xbdfbc61c,0xbe1bb5da,0xbdfbb5da,0xc63cb5da,0xd6bdce7c,0xd6ddce7b,0xbe3bd67c,0xbdfbd6dd,0xdf1ed6de,0xdf1fdf1e,0x93acd65a,0xdedcef5d,0xc5d9ad13,0xd6fdce3c,0x5945ffbf,0xe79f0083,0xa4b08b6b,0xfffe72e8,0xf5d0abc9,0xb4f2ab8a,0xff3cd638,
-0x2927bd57,0x20000001,0x082028e1,0x29c528e2,0x9d7aa6bf,0x9518b61d,0xad9ba57b,0x7bb2a539,0x3922ffff,0x28a03901,0x396330c0,0xce7e0003,0x84559d9e,0x1065628d,0x3a2b08c7,0x9d3994d8,0x28c4e71f,0x426d6b2e,0x424d8cb5,0x5a4b8c76,0x41e941a7,0x7bf35acf,0x6b9352b0,0x94756310,0x422a39c9,0x216839ea,0x74156b94,0x424c9d19,0x4aae634f,0x63534a8f,0x7c587c16,0x7c988499,
-0x953984b8,0x8cf97417,0x6bf57c77,0x74577c98,0x6bf57416,0x5b1273f6,0x84998cd9,0x8cda8cfa,0x8cda8cda,0x8cda8cda,0x84ba8cda,0x8cda84ba,0x94b98cda,0x7c1652af,0x292952d0,0x6bb473b3,0x73d57c36,0x845652b0,0x6b9152ad,0x73b46b93,0x52d05af1,0x74787416,0x743784b9,0x7c997c79,0x7c997c99,0x7c797c79,0x7c797c79,0x7c797c79,0x7c797c79,0x7c797c79,0x7c797c79,0x7c797c79,
-0x7c797c79,0x7c797c79,0x7c797c79,0x7c797c79,0x7c797c79,0x7c997c79,0x7c787c99,0x74587458,0x74165bb5,0x6bd642d1,0x7c576395,0x63d55b74,0x63b66394,0x6bf87c99,0x63b57418,0x08e9a5bc,0x8436422d,0x84778456,0x00048498,0x000039aa,0x8cb618e6,0x0002a517,0xa53810e6,0x00035b0e,0x00020003,0xcede198a,0xbe3c2127,0x00448412,0x18e5420a,0x8d1a9518,0x9d7a9d5a,0xa5bba5bb,
-0xa5bba5bb,0xadbca5bb,0xaddcadbc,0xa559addc,0x94d7a57a,0x9d188455,0xa518ad9a,0x528e8c76,0xa51752af,0xad377bf2,0xc63ca495,0xad79b5da,0xbdfcb5ba,0xb5bbad7a,0xb5dbbdfb,0xd6bece5d,0xd69ece9d,0xce5bc65c,0xbdfabe1a,0xdefed6bd,0xd6ded6de,0xd639d6db,0xffff732c,0xdefedefc,0xe71fdf5f,0x3964e5f7,0xefdf00c4,0x82e6932b,0x394493ac,0xde57d657,0x51226a26,0x59a5d5f5,
-0x5a8dd67c,0x30c1acb4,0x312228a0,0x112a2100,0xa57b84da,0x8477ad7b,0x94f9be1e,0xd61a8436,0x38c383d2,0x28a03901,0x31222880,0xceff3923,0xad798d1a,0x28a53967,0x18e60002,0xf77e4a4c,0x29240000,0x5af039ea,0x845618e8,0x4187630f,0x6aee4a2a,0x52ae7391,0x7bf38c76,0x526c8c54,0x18a62927,0xa5594a4d,0xa5397bf4,0x08454a2c,0x5b327c56,0x6bd66375,0x84b96bf7,0x8cfa8d1a,
-0x8d1a8499,0x7c787c58,0x84b87437,0x7c778498,0x7c577457,0x6bb47c57,0x8cfa8cd9,0x84b98cfa,0x8cda8cda,0x8cda8cda,0x8cda84b9,0x84ba8cda,0x4a4c7c78,0x6b2f4188,0x73926b71,0x63327393,0x73d552f1,0x7c156b73,0x73b34a4d,0x6bb473f5,0x52f26373,0x63b67437,0x7c997c99,0x7c997c99,0x7c997c99,0x7c797c79,0x7c797c79,0x7c797c79,0x7c797c79,0x7c797c79,0x7c797c79,0x74597458,
-0x7c797c79,0x7c797c79,0x74597c79,0x74597c79,0x7c797c79,0x7c787c79,0x7c787c78,0x74587478,0x53337438,0x74374af1,0x5b7463b6,0x63954af2,0x6bf763d5,0x6c165b74,0x63b363d5,0x7c14a53a,0x19072149,0x7bf46b30,0x08c88456,0x10a30023,0x84b79d19,0x6b925b51,0x31a97bf3,0x94b831ab,0x19067c15,0x9cd57bd1,0x29890024,0x52d0630f,0x20c48c33,0x94f8ce7d,0xa57b9519,0xa59b9d7a,
-0xa5bba59b,0xad9ba5bb,0xad9badbb,0xa559a59a,0x9d39ad7a,0x9cf89d39,0x7c14a559,0x73b27bd3,0x8c54ce3d,0x6b0fad58,0xa5188bd2,0x9cb7c5fb,0xbdfb9476,0xb5babdfb,0xbe3cb5db,0xc65cc63c,0xb5bace9d,0x4a6dc65c,0xb5dac61c,0xd6deb5b9,0xdeffdefe,0xcdf9d6fd,0xc63a738f,0xceddce9d,0xdefdd6fd,0x3124a2ab,0xdf5e0045,0xb4f3bd97,0xacf5acf1,0x8cb46c13,0xe6dcd6bc,0x4944d5b4,
-0xacd7c63d,0x30e0834d,0x29012060,0x9e3d2944,0xbe7cad7b,0xce9fad7b,0xb5bcbe3e,0x7b70b59c,0x5966eeff,0x20a030c1,0x28e02080,0x8d5c3143,0x73b36330,0x39869454,0x8cb710a5,0xffff8c76,0x422a3964,0x52afdede,0x847773b4,0x20e69bf3,0x6b0f5aed,0x62cd4a2b,0x73926b70,0x7bb1630f,0x39ca420b,0x637152cf,0xd65e6332,0x94d85a8e,0x74375354,0x8cda7c78,0x74787c99,0x7c797cb9,
-0x84ba84b9,0x74177437,0x7c777436,0x84988478,0x6bb58498,0x6b947c37,0x7c798cb9,0x84996bd6,0x84ba84da,0x84ba7c58,0x84da7c79,0x7c597cb9,0x39a88cd8,0x524a4187,0x62f09475,0x73f56b72,0x53127437,0x7c1673f6,0x73d56332,0x74166bd6,0x63954af3,0x74587c78,0x7c997c99,0x7c797459,0x7c797c79,0x7c797c79,0x7c797c79,0x7c797459,0x74597c79,0x74597459,0x74587458,0x74587459,
-0x74597c79,0x74587458,0x74597458,0x7c797459,0x74587458,0x74597459,0x74587459,0x74587458,0x4b127458,0x6c1763b5,0x53347458,0x5b7442d2,0x745863d6,0x6bb36c37,0x53136373,0x31cb8476,0x31ab1929,0x000220e7,0x8cb60001,0x08868456,0x7c578c99,0x8c964aee,0x298a73f5,0x6b32b5b9,0x10638c95,0x20c56b0c,0xa5389496,0x94b70085,0x20e67bd0,0x94b96ace,0xa55b94fa,0xa57ba59c,
-0xa59ca59c,0xa59ca59c,0xad9ba59c,0x94b9a55a,0xa5599d19,0x94d79d18,0x8c979d17,0x6b518c75,0x94b6ad59,0x520bb59a,0x6b7139a9,0x7bf5420c,0xb5ba8c77,0xb5dbb5ba,0xb5fbad9a,0xc63cbe3c,0xc63dce5d,0xc65c9cf8,0xc63bad98,0xce9dce7c,0xd6bed6be,0xd6fcd6fd,0xcebcce5a,0xce9dce9d,0xdedddede,0x41246964,0xc65c32ad,0xce7bd6de,0xce19ad57,0xce9bdf3d,0xee98bd35,0x72c86227,
-0xe6dc8cf7,0x28c130c2,0x290220a0,0xdf5f10a3,0x8cb994fa,0x8c976374,0x9cf98c97,0xe67db59c,0x62497bd2,0x208030c1,0x28e028c0,0xa5793121,0x9cd74a6c,0x522c7351,0x52cf20e7,0xacd46b51,0x5aee49e7,0x94f9dedf,0x84358c98,0x739028a5,0x5a8c524b,0x526c3988,0x316a73b1,0x39a9c5fa,0x843339ca,0x31ec5b30,0x6b91a539,0x8cb96bd5,0x6bd67416,0x94fa7c58,0x747884da,0x8cfa7458,
-0x84b97c99,0x7c377437,0x84b87416,0x741673f6,0x7bf673f6,0x7c1652d2,0x7c786bb5,0x84b98499,0x63b67c78,0x7c588499,0x84b97458,0x743884b9,0x4a8c21ec,0x83d25aab,0x63315aaf,0x6bb46352,0x7c576bb5,0x52f17c57,0x7c166311,0x74377437,0x74176395,0x7c9942b2,0x6c177458,0x74597458,0x74597c79,0x7c797c79,0x74587c79,0x74587459,0x74587458,0x74597458,0x74387438,0x74387438,
-0x74387458,0x74587438,0x74387458,0x74387458,0x74587438,0x74387458,0x74587438,0x74387438,0x63b67438,0x74376c17,0x63d67438,0x74575354,0x7c785b75,0x6bf87458,0x74365334,0x4290320e,0x84563a2f,0x00048c76,0x39eb0002,0x19287bf3,0x6bb67417,0x5aaf0024,0x8c967c17,0x843418a7,0x18a48c75,0x00000800,0xad169cd4,0xa57b00c6,0x088273d3,0x843220a2,0x8c9894d7,0x9d5b9d3a,
-0x9d7b9d7b,0xa57ba59c,0xa57ba57b,0xa55aa55a,0xa55a8456,0x8c7773b4,0x296a6352,0x9cd79cd7,0x7bd26b30,0xbd589cf7,0xad79bdda,0xbddcad59,0xa579b5bb,0xbe1bb5da,0xc65dbe1c,0xbe3cb5fb,0xbdfcc61c,0xad9abe1c,0xc63bd6de,0xc63ca537,0xce7dc65c,0xd6ddce9d,0xce3cd67b,0xd6de9cf6,0xdefddede,0x31076124,0xdefed79f,0xdf1ece9d,0xdebbdedc,0xbd36c639,0x9410c576,0x62887b2c,
-0x51a8ad59,0x20a130c2,0x18e32922,0x0024ce9c,0x84363a30,0x84569538,0xad7bb5db,0x5a0bce7f,0x9c917370,0x28e038e1,0x28c028a0,0x29053100,0x94960863,0xa4f5526d,0x21072925,0x6a6b9434,0x84133145,0x7c17422e,0x62cf4290,0x528c3127,0x4a0a51ea,0x6b0e5aad,0x63104a4c,0x4a4ca4f6,0x6b507bd2,0x9d190885,0x7c730004,0x7c78957d,0x74377c78,0x94da7457,0x7c798cfb,0x84b97c79,
-0x74377458,0x5b545b94,0x741673f6,0x63b56bd5,0x52d16bd5,0x84578437,0x84996bd6,0x74178499,0x84997c99,0x84b97417,0x84b97c99,0x747984b9,0x6b737496,0x524d7392,0x73d4ad39,0x7c586bb4,0x74166bd5,0x63537c57,0x84578436,0x7c788498,0x7c785313,0x6bf78499,0x74376c37,0x6c186c18,0x74597458,0x74587458,0x74387458,0x74387459,0x74587458,0x74387458,0x74387438,0x74387438,
-0x74387438,0x74387438,0x74387438,0x74387438,0x74387438,0x74387438,0x74387438,0x74387438,0x74596c18,0x74376c17,0x63b57438,0x6bf65b95,0x6bf76bf7,0x6c367458,0x53353ab1,0x5b7463b6,0x52d18479,0x7c140046,0x8c7594d6,0x00657bf1,0x7bf573f6,0x5aee0000,0x7c537c14,0x18c810a5,0x62ed7bd2,0x18a320c4,0x31260881,0x6bf521aa,0x424c94d9,0x188428c4,0x7c566b71,0x9d5b9d5b,
-0x9d5b9d5b,0xa57b9d7b,0xa57ba57b,0xa5599d19,0x6b948cb8,0x7c1694b8,0x7c147bb5,0xad797bd3,0x7bd273b2,0x31079475,0x94b562ee,0xc63ca518,0xb5dbb5ba,0xadbaa579,0xbe3cbe1c,0xb5fbc65d,0xbe1cbe1c,0xa539b5db,0xb5dac63c,0x52cec65c,0xce5dc63c,0xcebdc65c,0xc6bcce9e,0xd6dece9d,0xdefddede,0x29474840,0xdefee7df,0xdefece9d,0xc5f8ce3a,0xac116b2c,0x732db4d4,0xffdde679,
-0x3041ff3f,0x188028e1,0x11093142,0xa5599d39,0x10a7bdda,0x84765b11,0xaddd9d9a,0x9c55a57a,0xcdd9528d,0x208030c1,0x28c02080,0x39433122,0x6330424a,0x94943189,0x18842083,0x39455aac,0x8c75b577,0x8c976b96,0x28a4ad38,0x8413528d,0x6b0f8c54,0xa4d67b91,0x5aae4a0b,0x7c332968,0x210931ca,0x4a8d5b0f,0x3a6f5b31,0x74377c98,0x8cd97c58,0x84b97c78,0x84b9849a,0x8cda84ba,
-0x74577c78,0x637363f6,0x7c166bb4,0x7c586bb4,0x6bd673f6,0x7c376bd6,0x7c786bf6,0x84997416,0x7c996bf6,0x84ba7c9a,0x84b984b9,0x7c9984b9,0x53117437,0x30e42906,0x84577bee,0x74387c57,0x7c577c58,0x5b327416,0x7c167c36,0x74378458,0x32525375,0x74796bf6,0x74595b75,0x6c386c18,0x74387458,0x74387458,0x74597459,0x74596c38,0x6c387459,0x6c386c38,0x74597459,0x6c386c38,
-0x6c386c38,0x6c386c38,0x6c386c38,0x6c386c38,0x6c386c18,0x6c386c38,0x6c386c38,0x6c386c38,0x74387439,0x74387438,0x6bf77438,0x63d663d6,0x63f76c17,0x5b956c37,0x63b55354,0x74377437,0x322e6374,0x10c85b32,0x528d18e8,0x29892106,0x5acb4a6f,0x420a0001,0x0847296b,0x08440003,0xb59939eb,0xb57818c4,0x00006b4d,0x8cf98476,0x63709519,0x31672106,0x94f62947,0x953a951a,
-0x9d5b9d3a,0x9d5b9d5b,0x9d5b9d7b,0x94f89d5b,0x84578cb8,0x84558c98,0x84359cd7,0x8c5583f4,0x7bd31066,0x5a8d6b51,0x524c7370,0x6b51a4f6,0x9d3962f0,0xad9aa57a,0xb5dbb5fb,0xb5fbb5fb,0xbe3cbe1c,0xc63cbdfb,0xbe1bc63c,0xb59b6333,0xce7c5aef,0xd6bcc65c,0xd69e8414,0xc63cce7d,0xdefcd69e,0x00c94103,0xdeddd71e,0xce9cbdfb,0xb577d6bc,0xce199412,0x6a6851a7,0x3922ffff,
-0x18a02842,0x28c120a0,0xa67f2945,0x9d19a59c,0xb5dcb5dc,0x2948df3f,0xad792128,0x20a6ef3f,0x62ac0020,0x20802020,0x28c02060,0x28e22901,0x633031e9,0x5aac4a6d,0x182241a7,0x31463986,0x9d18528c,0x4a2d9d5a,0x39a75a09,0x8c7552ce,0x62ee8475,0xa4f64a2b,0x4a0c18a5,0x84334a4c,0x9cf718e7,0x639039e9,0x74368cd7,0x849884b8,0x84d95b75,0x8cfa7437,0x7c787418,0x6bf663b5,
-0x74368cf9,0x3a2e6c17,0x73b4298b,0x6bf67c36,0x741773f6,0x741763b6,0x7c586395,0x6bf65b74,0x7cb97c99,0x7c997c9a,0x7cb97cb9,0x6bf77cb9,0x6bd67c78,0xff3a62ee,0x73d58c0c,0x7c588478,0x7c587c78,0x6bb45312,0x6bb55b32,0x7c988438,0x84da5bb6,0x4b146c18,0x74597459,0x74597459,0x6c187438,0x74387438,0x74597459,0x6c387459,0x6c386c38,0x6c386c38,0x6c386c38,0x6c386c38,
-0x6c186c38,0x6c386c18,0x6c386c38,0x6c386c18,0x6c386c38,0x6c386c38,0x6c386c38,0x6c186c38,0x6c186c18,0x6c176c18,0x6c176c17,0x6bf77438,0x6c186c18,0x63b563d7,0x5b744af3,0x63b56bd6,0x52f34ab1,0x52d04ad0,0x18e67bd3,0x4a8d10a4,0x08455aef,0x5aac0823,0x94daa57a,0x6bf284b7,0x73918434,0x739310a4,0x104231e7,0x194b7c35,0x6bb29519,0x632f18e6,0x630e0844,0x8cf98477,
-0x953a953a,0x9d3a953a,0x953a9d5a,0x94f894f9,0x9d1a94d8,0x84768477,0x5af07bf4,0x73928414,0x73929cb7,0x6b0fa4f8,0x94539cb5,0x73728c54,0x73f4ad59,0xbdfc8c96,0xb5bab5db,0xbdfbadba,0xbe1cbe3c,0xb5bbb5db,0xbe1bbdfb,0x9478c65c,0xad5ace7c,0xd6bdc65c,0xdefe9473,0xd69ed69e,0xd69bce1c,0x002738e2,0xdefedf5f,0xd6de8c54,0xef5fce3b,0x83b0acf7,0x836d3947,0x49223923,
-0x28c128a0,0x210228c0,0x9dbc21aa,0xa57cbe5d,0x8cf99d59,0xa539addd,0x3169318a,0x6aed9c54,0x9cd562ed,0x288028a2,0x20a02080,0x396428e1,0xdebc5310,0x420d31ab,0x10213926,0x088420c2,0x4a4d9516,0x8bd15aee,0x420a2904,0x7bf26330,0x0822ad77,0x08025a8d,0x31482908,0x422da518,0x83b15b10,0x218b1908,0x6bd57436,0x6bd67417,0x84b96c17,0x8c997437,0x8c9863b4,0x63f784b9,
-0x6bf67437,0x74367437,0x533342af,0x6bd65b55,0x7c9a7c37,0x6bb55354,0x53336bd5,0x84997c78,0x7c9a7c99,0x74597c99,0x7c995b75,0x74587c99,0x63d57438,0xa42c52ae,0x7437de58,0x7c988498,0x7c5884b9,0x849873f6,0x63736b93,0x5b5473d6,0x7c987438,0x743863d6,0x74587458,0x74586c38,0x74597438,0x6c386c38,0x6c386c38,0x6c386c38,0x6c186c38,0x6c386c38,0x6c386c38,0x6c186c38,
-0x6c186c38,0x6c186c18,0x6c386c18,0x6c186c38,0x6c186c18,0x6c386c18,0x6c186c38,0x6c186c38,0x6c386c18,0x6c186c18,0x6c186c18,0x6c386c18,0x6c386c38,0x6c186c18,0x63b663d6,0x6c166bf6,0x73f763b6,0x52b05af2,0x31a95b11,0x3a0c10a5,0x296810a7,0x08641084,0x9d1931ac,0x73d229ab,0x10840000,0x9cf5b59b,0x21250821,0x7c577bf4,0x9d3a192b,0x73930044,0x00048477,0x9cd74a2c,
-0x84987414,0x9d3b951a,0x953a955a,0x95198cf9,0x8cb78cd8,0x7c378477,0x73d47bf5,0x63316b72,0x63108414,0x8c348c75,0x5a8d9475,0x733141c9,0x7bf4ad59,0xad7a9cf8,0xa559b5fb,0xb5dbb5db,0xb5dbb5fc,0x9d39b5db,0xad9aad9a,0xa559ad79,0xadbaad9a,0x7c3331ad,0x6b7149e8,0xd6bdc65d,0xe6bbd67d,0x00a93925,0xd6bec65c,0xc63bad99,0xd6bdd69d,0xa4b48c12,0xf7bfbdb9,0x41a15a66,
-0x28c130e1,0x18e420c0,0xa5bc4b73,0x8cdaadfc,0xa59caddc,0xad9ca59c,0x7bb48c55,0x18a77371,0x94347b92,0x28802881,0x20602080,0x29022903,0x53103a0b,0xc61b424e,0x41455aac,0x190718a2,0x524c9454,0x39866acd,0x08423125,0x00022947,0x7bb194b6,0x63302908,0x0804cdda,0x633218c8,0x088462ee,0x5311530f,0x29ed320e,0x74378cda,0x7c797417,0x7c376bf7,0x73b46394,0x74178cb8,
-0x53137437,0x196c7c97,0x8cd94290,0x63745b33,0x74388cb9,0x84984ad2,0x322f4290,0x74377437,0x7c997c99,0x53347c99,0x7c997438,0x74587c99,0x6c374b13,0x4a6c7436,0x84998c76,0x84998499,0x7c7884b9,0x8cb98498,0x7c166372,0x3a706bb5,0x5b747458,0x6c176c17,0x74587458,0x6c387458,0x6c186c38,0x6c386c38,0x6c386c38,0x6c386c18,0x6c386c38,0x6c186c18,0x6c186c18,0x6c186c18,
-0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c176c18,0x6c386c17,0x63d66c18,0x63b663d6,0x5b746c16,0x63b56bf7,0x52b08c78,0x18c5426e,0x52cf632f,0x52cd5aef,0x10844a8c,0x7c1573d5,0x9cf62129,0x00020824,0x1083b558,0x52ad0844,0x6bd58cb9,0x00288498,0x00242148,0x63d573b5,0x00430024,
-0x39cc0000,0x9d19e73f,0x951a9d1a,0x8cd8951a,0x94f87c36,0x73d58c97,0x8c768455,0x7bd48c56,0x6b517bd3,0x8c557392,0xd65d7bd3,0x7351b558,0x94d69496,0x7c138454,0x9cf79d18,0xad9a9d39,0xad9ab5fc,0xb5bbb5bb,0xb5dbad7a,0xad9aad9a,0xb5fbbe3c,0xbe3cc63d,0xc63d8435,0xce7dc65d,0xd639d67d,0x00263945,0xc65cc67c,0xc61bbdfb,0x9495bdfb,0xacf59c94,0xbdb69c94,0x51e1938b,
-0x31023102,0x214528e0,0x3a7063f5,0xa59d84b8,0x9d5aa5db,0x9d1aa59c,0x8cb873f6,0x10a9ad79,0x7b4fb57a,0x28a14985,0x20802080,0x310228e1,0xa59b3124,0xa5370002,0x39244208,0x7bd01001,0x49ea526b,0x20c449e9,0xa4d520e5,0x18c7528d,0x0002294a,0x31690885,0x4a4c20c7,0x4a4b4a2b,0x4a6d0002,0x4ad04a8e,0x63529d39,0x74580027,0x8cb97458,0x74177457,0x5b746395,0x63b56c16,
-0x7c5763d5,0x53125b53,0x6c167c78,0x4af36394,0x74596bf7,0x42914270,0x6bf7320f,0x7c997438,0x7c997c99,0x3ab37c9a,0x7c797c99,0x7c797c79,0x74377c79,0x743863f6,0x7c997c58,0x84997c99,0x74168478,0x7c378c99,0x74167c57,0x8cfa73f6,0x63f53a72,0x5bb663d6,0x6c1863f7,0x6c387459,0x6c186c18,0x6c186c18,0x6c386c38,0x6c186c18,0x6c186c18,0x6c186c18,0x6c1863f7,0x6c186c18,
-0x63f76c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186bf7,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x63f763f7,0x63f76c17,0x6bb66bf7,0x5b119cf9,0x18e54a8e,0x63527c34,0x192929ab,0x00030000,0x73706b2f,0x10a541ea,0x6b4f5ace,0x10430821,0x7c158414,0x63746bf6,0x74378478,0x526c5aef,0x74166b71,0x5b718498,
-0xffff0001,0x00028414,0xc65dacf7,0x7c779d1a,0x94d773f5,0x845752d0,0x8cb78436,0x84137c14,0x83f45af0,0x6b519496,0x83f462f0,0x7371526d,0x9cb68c35,0xa4f783f1,0x8c9694d7,0xad7aa559,0xadbbad7a,0xb5dbbdfc,0xb5fbb5fc,0xbdfdb5db,0xad99b5db,0xc65dbe3c,0xc63db5ba,0xc67dbe3c,0xdefcd65c,0x194830c2,0xc63ccebd,0xc63bc63c,0xce9dbdfa,0xbd95c63b,0xcdf6c5b6,0x49a249a2,
-0x28e13122,0x955a4a4a,0xadbda5fd,0x8cfa8cdb,0x9d3b8499,0xad9c9d5b,0x9d1a94d9,0x41ed94b6,0x6aee8bf4,0x28809431,0x18402060,0x394320a0,0xc69f28a2,0x6b502127,0x41652928,0x39c81022,0x49e94a2a,0x62ec522a,0x8c74630e,0x8c53634f,0x5a8c3988,0x5ace2989,0x73902948,0x00033189,0x3a0c422c,0x21ab5b31,0x9d3b6bf6,0x6bf76c17,0x847842b2,0x5b9463d6,0x6bf67416,0x84997437,
-0x73f563b5,0x52f25333,0x6bb58478,0x63955b33,0x7c79194c,0x63b56bb5,0x745863b5,0x7c797458,0x7c797c79,0x32727c79,0x7c797459,0x74587c79,0x6c177c99,0x7c787458,0x7c797c79,0x7c797c79,0x7c5784b9,0x84578c99,0x847884b9,0x6bf65b33,0x74377c98,0x63d75b75,0x6c3863f7,0x6c384b34,0x6bf76c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,
-0x63f76c18,0x6c1863d7,0x6c186c18,0x6c1863f7,0x63f76c18,0x6c1863f7,0x6c186c18,0x63f763f7,0x63f763f7,0x6c1863f7,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x63f76c17,0x4ad163d6,0x19087bf4,0x2969424c,0x6b93192a,0x212c5b32,0x4a6b2147,0x20e69474,0x4a8d3168,0x5aab6b90,0x106320e4,0x3a2d18e5,0x6bd508c9,0x63b57416,0x00039d38,0x74150002,0x7c588497,
-0x18e89d7c,0x31ec20e6,0x4aae8d19,0x29890001,0x39ca8c54,0x9cd6526d,0x5aadadba,0x49eb3187,0x841452af,0x8c5583f4,0x5aef9496,0x62ce62ef,0x94967371,0x83d37bd1,0x94d7bdfc,0x9d188c76,0xad9aa559,0xbe1cb5fc,0xb5fbb5fc,0xb5fbb5db,0xad9aadbb,0xc63cb5fb,0x7392c63c,0xb5dab5da,0xdefdbdda,0x10c530e3,0xb5dad6ff,0xc63cb5da,0xb59abdfb,0x72a8bdf9,0xc5946266,0x49c36ac8,
-0x20c628c0,0xa59d8d3b,0xa5bbaddb,0xa59c8498,0xadbcadbd,0xa59c951a,0x8cb98cd9,0x5ad0a4f9,0x62d19495,0x30a19434,0x18201840,0x31021860,0x19083102,0x424e8c13,0x41458c74,0x00005aab,0x734e49e9,0x52ac0842,0x73d45b0f,0x739152d0,0x398983f1,0xad9b0005,0x5a8d6b2f,0x52cd0002,0x422c420b,0x11293a2d,0x7c783a70,0x74387c78,0x6c176bf6,0x5b7463b5,0x741663d6,0x84987416,
-0x5b335b54,0x637452f3,0x29ad5b10,0x6bd629af,0x6bf66bd5,0x4af26c16,0x74587c78,0x74387438,0x7c797c79,0x6c177c59,0x6c177c78,0x5b967459,0x6c187438,0x74587458,0x84b97459,0x84988499,0x8cd98cb9,0x94d994d9,0x73f68cb9,0x84574a90,0x74587437,0x6c385b95,0x5bb66c38,0x74596c18,0x6c185bb6,0x6c186c18,0x6c186c18,0x6c186c38,0x6c186c18,0x63f86c18,0x63f863f8,0x63d86c18,
-0x63d763d7,0x63f863f8,0x63f763f8,0x63f763f7,0x63f763f7,0x6c186c18,0x63f763f7,0x63f763f7,0x6c186c18,0x63f863d7,0x6c1863f8,0x63f763f7,0x6c1863f7,0x6c186c18,0x6c186c18,0x6c176c17,0x00885b55,0x422d2129,0x42910886,0x42b17417,0x6b927416,0x08860004,0x3127630d,0x632f5ace,0x1083528c,0x31672925,0x39ea7b70,0x84786bb4,0x63948457,0x20e48434,0xbe1c2969,0x8cf973f6,
-0x84988499,0x0025a5bb,0x9cf65aee,0xad189cf9,0x10a75b10,0x208539cb,0x9d190006,0x39ec0005,0x630f8434,0x5acf8c55,0x9cf78c74,0x420c4a4d,0x84147372,0x7bd3a518,0x9c966310,0x8cd594b6,0xadbba57a,0x9d5ab5db,0xadbba59b,0xa559ad9a,0xa559ad7a,0xb5dbadba,0x94d8be1c,0xbe1bc65c,0xbdfab5ba,0x21262000,0x7c159d5a,0xbe1cbe1c,0xbe3ca559,0xce7aa558,0xb4d1b514,0x62875a67,
-0x00ea2964,0x8cd9b63e,0xa57d6374,0x8cfa8cfa,0xa59ca57c,0xa5bda5bc,0x9d1a94fa,0x5b12a55a,0x49ee94d7,0x28819435,0x18201840,0x31222080,0x104220a0,0x6bd5428e,0x20a39412,0x39874229,0x080128c4,0x39e9524a,0x7c155b2f,0x7b927311,0x39cb20c5,0x52d08c97,0x1885630f,0x422b2968,0x4a8e3189,0x7c776bb3,0x7cb96c17,0x743784ba,0x5b957c58,0x5b957c79,0x6bd563d6,0x6bf67416,
-0x73d56b95,0x00038c37,0x73f6422e,0x74176375,0x74176bf6,0x6bf77437,0x6c187c58,0x74587c79,0x74587459,0x74586bf8,0x74587457,0x74585b96,0x7c997438,0x74587c79,0x7c787c79,0x849884b9,0x8cf98499,0x94f994f9,0x73d58c98,0x8c986354,0x63d77c58,0x63d76bf7,0x6c1863d7,0x53756c18,0x63d763d7,0x6c1863f7,0x63f763f7,0x6c1863d7,0x6c186c18,0x63f86c18,0x63f863f8,0x63b763f8,
-0x63f863d7,0x63d763f8,0x63f763d7,0x63f763f7,0x63f763f7,0x6c1863f7,0x63f763f7,0x63f763f7,0x63f763f7,0x63f863d7,0x63f763f8,0x63f763f7,0x63f763f7,0x6c186c18,0x6c186c18,0x6c1763d6,0x3a2f322e,0x216a5b52,0x5b546352,0x5b536395,0x5b126353,0x6b93298b,0x20e631a8,0x39ca632f,0x3a0a0864,0x29470001,0x39ea3189,0x6b9410c9,0x84787c16,0x10826b72,0x08869cd7,0x84b873d4,
-0x84988cb9,0x84567c57,0x000373b3,0x18a53188,0x9cb6bdda,0x0002a4d7,0x8456ad9c,0x94d752f1,0x29698413,0x8c557391,0x5acf6330,0x8c75528e,0x6b307372,0x94967371,0x9c96b59a,0x7c3110a4,0xa55994b7,0x9d39a579,0xad9ab5dc,0xa57a9d18,0xad9aad9a,0xadbaad9a,0xa579b5db,0xbe1bad79,0xbddabddb,0x20e540c2,0xb5bcbe5e,0xad9aadba,0xbdfbc65d,0x8b70ad38,0x3964bd54,0x39635226,
-0x957b08a6,0x8c987c77,0x7c577c77,0xa59caddd,0x8cf99d7c,0x951a951a,0xa59ba59c,0x4270a59b,0x7bb59d39,0x30c3bddb,0x18401820,0x20a02080,0x206028c1,0x41c60841,0x314652a9,0xa4b35b0d,0x18823966,0x528c20c4,0x6b734a8d,0x00234a6c,0x8cd75b70,0x73b352af,0x39a95ace,0x3a0a18c6,0x6372424d,0x63b573d5,0x74587437,0x743784b9,0x6c177c78,0x6c1784b9,0x6bd57c99,0xb5fe322e,
-0x62f1298c,0x5b1208aa,0x6bb46b75,0x74575332,0x63d55b53,0x531363b5,0x7c797c58,0x74597c79,0x6bf763d6,0x6bf642b3,0x63976c17,0x63b65335,0x7c796c17,0x74587438,0x7c787438,0x6c167c58,0x84b87c57,0x94f98cb8,0x635394d9,0x7c578c98,0x5b757417,0x6c1863d7,0x63f763f7,0x63d75b96,0x63f763d7,0x6c186c18,0x5b966c18,0x63f763f7,0x63f76c18,0x63d75bb6,0x6c186bf8,0x63f85376,
-0x63d763f8,0x63d763d7,0x63f763f8,0x63f763d7,0x63d763d7,0x63f763f7,0x6c1863f7,0x63d763f7,0x6c1863f7,0x63d763f8,0x63f763f8,0x63d763f7,0x63f763d7,0x6c1863f7,0x63f76c18,0x32305b96,0x6395110d,0x53334af2,0x63955333,0x53126395,0x52d15b53,0x52b131ad,0x6aee4209,0x1084632e,0x7c141928,0x632f0864,0x31892969,0x000652f1,0x52f37c16,0x18846b73,0x94f839cb,0x84360003,
-0x7c377c76,0x8cda5314,0x7c77a55c,0x0002196a,0x29051023,0x3a0b7bb1,0x8c97a53a,0x94b77c36,0x841383f3,0x9cf72107,0xad599cf8,0x7bd352ae,0x83f3422c,0x73926b51,0x8c346b30,0x4a2cb539,0x1085b599,0xd6beb59a,0xadbb9cd7,0xa539a539,0xb5bbb5db,0xa57973d3,0xbdbab579,0xbe1bad99,0xbdfbad99,0x30e46a27,0xbe1d5330,0xb5fbb5fb,0xc63c9d18,0xce7ac65b,0x5289732b,0x7b4a6287,
-0x6bd48475,0x6b937414,0x19299d18,0x21ad953c,0x84b829ed,0x8499951b,0xa59d8cda,0x0028a53b,0x73968435,0x2062c63e,0x18001800,0x18601840,0x186028c1,0x49a62060,0x292520c2,0x94123146,0x49873105,0x5aed1883,0x00037350,0x8c974a6f,0x63526bb3,0x83d27bd3,0x29272947,0x29a939c9,0x428f2169,0x53339d3a,0x84b94af2,0x7c793a91,0x84996c17,0x8c9984b9,0x21aa94d8,0x18e7318a,
-0x94b85b11,0x7c37420e,0x6bf56bd5,0x63956374,0x7c586395,0x63954af2,0x6bf76bd6,0x6c186bf7,0x63d67458,0x74584af4,0x42f35bb6,0x5bb66c18,0x74596c18,0x74596bf7,0x6c176c18,0x74387438,0x7c587c37,0x8cd98498,0x84795314,0x4ab18498,0x5b9642b2,0x63f76c18,0x537563f7,0x6bf76c18,0x6c1863f7,0x63f76c18,0x63f863d8,0x5bb763f8,0x63d763d7,0x63d763b7,0x63b763b7,0x63d763d7,
-0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d863f8,0x63d763b7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63f763f7,0x63d763f7,0x6c365b96,0x4af37438,0x5b535b92,0x6bf64af3,0x6bf74af3,0x4a8e6373,0x8c760887,0x528b0002,0x39ec1064,0x5b10296a,0x94951085,0x52ae0024,0x741631cb,0x5b9408e9,0x00026312,0x7c1420c4,0x424c9d39,
-0x7c777c16,0x84788498,0x73f65b32,0x9cf67415,0x18c5bdf9,0x8c3439c9,0x4a6fad79,0x8435a57a,0x41ea7390,0x18e76b6f,0x84146b31,0x7bf39476,0x62ee4a6d,0x62f07371,0x39aa6330,0x526e7bd3,0x73d48435,0xa539a55a,0xa5370003,0x83d3ffdf,0x83f39475,0xad18420b,0x9c72c5d8,0x20424166,0x00012906,0x28e31000,0xb5da52ed,0xbe1cb5db,0xb5dbc63c,0xce5bbe3c,0x5aaa9471,0x83ced639,
-0x0065424c,0x94d74a6f,0x52af31eb,0x63736374,0x84b87c36,0x9d9c9d5a,0x9d5b84d9,0x0888a55a,0xad7b8436,0x30e2d69f,0x18202081,0x20801840,0x28c12080,0x10202060,0x316541c5,0x390362cb,0x5a6a3104,0x00003125,0x5b310063,0x7bf39d17,0x7bf46351,0x00024a6d,0x29695a8c,0x8495428d,0x74346371,0x53117435,0x29ee955c,0x74577457,0x955a63d6,0x00470908,0x635442d0,0x4a2d21ac,
-0x4a6f5b32,0x6b946b73,0x52f35313,0x5b334291,0x4ad27c58,0x5b745b54,0x74386bf7,0x743863d6,0x63b67458,0x53345315,0x6c185bb6,0x745963f7,0x6c1763f7,0x63f76c17,0x6c1863f7,0x6c187438,0x74386c18,0x8cba7c38,0x4ab2b5ff,0x5b335313,0x5b7563d7,0x4b3463b6,0x53755375,0x63f763d7,0x63f763f7,0x63f763d7,0x63d763d7,0x4b3563f8,0x5b9663f8,0x63d75bb7,0x63d74b14,0x63d75b96,
-0x63d763d7,0x63d763d7,0x63b763d7,0x63d763d7,0x63d763b7,0x63b763b7,0x63d763b7,0x63d763b7,0x63b763d7,0x63d763d7,0x63d763d7,0x63d763f8,0x63d763d7,0x63f763f7,0x5b9663f7,0x2a0f63b5,0x42916395,0x4af34af3,0x74177417,0x5b136bf7,0x28e7318b,0x62ec39a8,0x002239c8,0x5b510064,0x5af173d4,0x2969528d,0x637118e6,0x3a6f29cb,0x74168498,0x08636b73,0x8c7641c8,0x318c6353,
-0x94d9ad59,0x7c578458,0x7bf77c57,0x63516373,0x31ab9495,0x3a2bb5db,0xad172906,0x73b2b579,0x4a0b20a6,0x8c54522c,0x8c554a4e,0x39eca538,0x7c142129,0x52d05b11,0xad9b7416,0x428d73f3,0x9d385b10,0x7bf48c96,0x95388416,0x0004f7df,0x00450004,0x7c350066,0xd6ff7457,0x94b8ffff,0xa59b73b3,0x3104defd,0x9d181864,0xad99ad9a,0xa579be1c,0xbdfbb5fa,0x8c319493,0xb575a577,
-0x39ec6b92,0x8cb68435,0x9d1a7c55,0x84777c57,0x84da9d7a,0x9d3a951a,0x84b97c98,0x006794fa,0xad59addd,0x10007371,0x18002061,0x18400800,0x28a028c1,0x28c12060,0x314428a1,0x39864a07,0x52287b8e,0x20c31000,0x6bb10843,0x5b30426c,0x8c764a8f,0x18c60002,0x39ec0024,0x94d76b93,0x849684b7,0x3a4e18e8,0x9d7b4ab0,0x214a426f,0x74340004,0x4b126c38,0x53126394,0x52af29cc,
-0x63733a0d,0x52f24291,0x7c377416,0x7bf65b73,0x320e6354,0x63545312,0x74797c58,0x42f45b96,0x6bf76c17,0x74585b76,0x63d63231,0x74597437,0x5bb65355,0x6c386c38,0x6bd763d7,0x63b77418,0x6c177438,0x00ca6bf6,0x6c177438,0x63d64333,0x53545375,0x221029f0,0x42f44b55,0x63d75376,0x63d863f8,0x63f763d7,0x63f75b96,0x63f763b6,0x5bb75bb6,0x4b1463f7,0x5b965b97,0x63d763f8,
-0x63d763b7,0x63b75bb7,0x5bd763b7,0x63d75bd7,0x63d763d7,0x63b763d7,0x63b763b7,0x63b763b7,0x63d763b7,0x63d763d7,0x63d763d7,0x63d763d7,0x63f863d7,0x63f763f8,0x53555bd7,0x42d25354,0x4af35b96,0x53545b75,0x73f85b96,0x73d66bf7,0x39cc0845,0x10430821,0x188320e4,0x428e2989,0x6b943a2e,0x29a96370,0x3a0c94b5,0x74365b31,0x7435322e,0x00237c15,0x20e8424a,0x6bd55311,
-0x4a8b2149,0x7c5983f7,0x84998479,0x84148cd9,0xa5381908,0x84136310,0x21085aad,0x9cd77370,0x73b27391,0x5ace2108,0x426e4a4c,0xa5596372,0x5b0f6b93,0x84576331,0x7c159d19,0x84555af2,0x4a8e4a8d,0xa559b5ba,0x5b308c96,0xa55a5b13,0x6b7473d5,0x7c159d39,0x8c978456,0x526f39ed,0xa5396b73,0x2061bdd9,0x7c333a08,0xb5baa539,0xb5fba559,0xb5dba559,0x7bf29d17,0xa516b5d9,
-0xe7bf3a4e,0x4251320e,0x7c584ad2,0xb5fe7c77,0x953aa59d,0x84998cfa,0x9d3b953b,0x31cd8cda,0x73938cfa,0x2061c5ba,0x08211820,0x10203124,0x208028a1,0x28c128c1,0x08202081,0x10410800,0x314528e3,0x41e94a29,0x00012946,0x73b1c61a,0x420b8414,0x2106422b,0x31eb3188,0x00020023,0x08650844,0x320c0003,0xef9fa55a,0x8cfa0067,0x74584b75,0x533363f5,0x53125312,0x73b38cb7,
-0x63d46374,0x63953a70,0x74374ad1,0x5b324ad1,0x4ad06bb4,0x6c185b74,0x42f33a71,0x5b9663f7,0x63d67458,0x6bf77438,0x6c175bb5,0x5b966c18,0x63f74b14,0x6c386c18,0x5b965bb6,0x6c186c18,0x63b66c17,0x6c170006,0x63b66bf7,0x537563f7,0x4b355375,0x6bf742f3,0x4b136c17,0x5b965b96,0x53764b14,0x5b965bb6,0x5b9663d7,0x5bb65355,0x3ab34b14,0x5bb63ab3,0x5bd65b95,0x4af45b96,
-0x5bb75b96,0x63b763d7,0x5bb763d7,0x5bb75396,0x63b763d7,0x63b763b7,0x63d763b7,0x63b763b7,0x63d763b7,0x63d763d7,0x63b763d7,0x63b763b7,0x63d763b7,0x63f763d7,0x5bb75bd7,0x63f64b34,0x53545b75,0x4b1463d6,0x74175b75,0x29ab6c16,0x62f039ac,0x08017bd0,0x212718c4,0x3a0e2149,0x39ee6352,0x420a9474,0x73d3420a,0x6bf66bd4,0x63745b53,0x00028457,0x000418e5,0x7c3673f4,
-0x21495af0,0xa5590865,0x84984ad2,0x8c568497,0x4a4d0887,0x294973b2,0x7bd35b0f,0x94742949,0x84347bd3,0x8c966b51,0x5b114a6e,0x633252b0,0xa53b6353,0x63527c16,0x94d8a55a,0x84569cf8,0x84566b73,0x8cb70005,0x8c778c96,0xad9a5aef,0xa57b8456,0x3a2f8cb8,0x94b7a55a,0x108694d8,0xce5c8c54,0x286273b1,0x94f731a7,0xad79b5bc,0xa5599d38,0xad7994b6,0x9d18bddb,0xa4f7b5ba,
-0x1990d73f,0xa5bb94fa,0x74585335,0x953a8cda,0x8cd9a5bb,0x7c796c58,0x94fa9559,0x214b3a0f,0x63539d5b,0x000072ce,0x84f70821,0x20616aac,0x28a12880,0x182028a1,0x20a21000,0x39253924,0x732d41c5,0x5b2f320a,0x39c9524b,0x10641043,0x3a2b0003,0x73d394b7,0x0885424d,0x52ce0023,0x63317bd4,0x84586b94,0x21eecedf,0x5b747c78,0x6bd54b13,0x5b335b73,0x7bf55b11,0x8478424f,
-0x3a7142d3,0x5333322f,0x53126c17,0x52f173d5,0x3a0d320d,0x74584a90,0x4b345354,0x63d66c17,0x3a5163d7,0x19ae7417,0x5b966bd7,0x63f763b7,0x6c186c38,0x6c186c18,0x63d763f7,0x6c1863f7,0x325063d6,0x63d76c37,0x19cf5bb7,0x63d74b76,0x5bb75bb6,0x5b964b35,0x535563f8,0x5bb663d7,0x5b965b76,0x53555355,0x63d74b14,0x53555b75,0x53545bb7,0x5bf65334,0x5bf66416,0x5bd65375,
-0x5b966bf7,0x53765bd8,0x5bb65bb7,0x5b965bb7,0x63b75bb7,0x63b763d7,0x63b763b7,0x5b9663b7,0x63b763b7,0x63d75bb7,0x63b763d7,0x63b763b7,0x63d763d7,0x63b763b7,0x5b9763b7,0x63d75375,0x4b345375,0x5b9563f7,0x6bb55b74,0x424e4230,0x947518e6,0x10430823,0x29484a4b,0x52af5af0,0x52cf5b31,0x28a23146,0x0004632e,0x5b936bb3,0x7c377438,0x08454ad1,0x94b50844,0x6b736b51,
-0x63525b31,0xd6ff18e8,0x7c577396,0x63928478,0x424ea55a,0x5acf52af,0x633131ab,0x08456b91,0x528e62ef,0x7c3673d3,0x635352d0,0x5af273b4,0x84578476,0x18e90867,0x84754250,0x6bb45b32,0x84567bf4,0xb61c6352,0xa53a10e6,0x73d48456,0x5b116331,0x94f873d4,0xa55a9d59,0xa538a57a,0x5a8c39a9,0x28c4bd56,0xa5592148,0x73b39d18,0x9d16ad78,0x9d18a559,0xb5bbb5ba,0xad78b5ba,
-0x957b957c,0x953a8478,0x8cb9adbb,0x218d29ef,0xa5de5b55,0x955bbe3f,0x8cb97c78,0x62f15b11,0xa51a6bd4,0x000072ee,0x7c370002,0x836e8391,0x20602080,0x080028a1,0x18200800,0x51e73103,0x186420c2,0x6b307bf5,0x4a6b4a2a,0x00018c73,0x218b7412,0x84775b32,0x4a6f8c98,0x7c153a0d,0x10c73a2c,0x3a6f08e8,0x745884b9,0x6c177c99,0x5b5363b5,0x5b5363b4,0x298c3a0e,0x4ad27416,
-0x5b754b13,0x6c1763b5,0x429063b5,0x5b1152d1,0x428f6bd4,0x4b146395,0x6c176bf7,0x64175354,0x533342d2,0x63b65b54,0x6c1863b7,0x4b345b55,0x5b9663d7,0x63b663f7,0x63d76c18,0x6c185375,0x9d7d7458,0x4b136c17,0x53555bb6,0x5b965b96,0x4b355b96,0x53555bb7,0x4b3542d3,0x42d35b96,0x53555335,0x4b144b34,0x53344af4,0x6c3963d7,0x4b1442f4,0x4b365376,0x42f542f5,0x4b5642d4,
-0x43354b56,0x43144b35,0x5bd75376,0x5bb75bb7,0x5bb75bb7,0x5bb763b7,0x5bb75bb7,0x63b75bb7,0x5bb763b7,0x5bb763b7,0x63b75bb7,0x63b763b7,0x63d763d7,0x63d763b7,0x63d763d7,0x5bb663d7,0x63d75bb6,0x5b955bd6,0x6bd54ad1,0x73b23a2b,0x31cb5b10,0x8c741085,0x210818e6,0x5b11426e,0x6b713a2e,0x18213147,0x6b7218c6,0x4aaf4acf,0x7c177c37,0x41eb5b73,0xb5b99cd6,0x6b920003,
-0x73d55b12,0x52ce31cd,0x8c7652cd,0x31cd5b10,0x7c365b32,0x9cd78c97,0x7393296a,0xa5388c96,0x7bd39455,0x847718e8,0x298c7c15,0x8c977bf5,0x739494d9,0xad7cb5dd,0x8cb7298c,0x7c164aaf,0x8cb79cf8,0x7c366b72,0x9d3a8c96,0xa55a9d19,0x9d194a6e,0xa57a7c35,0x9d399518,0x94d79d39,0x4a0a8c13,0x28a262ac,0x9cf82926,0x8c778455,0x7394420e,0x9cb88c97,0xb59ab5ba,0xbddab579,
-0x74384b36,0x94fa94fa,0x94d79d1a,0x6bd55b72,0xb63f8d1b,0x63b75356,0x94fb8cd9,0x41cc73f4,0x41ed8c96,0x08024167,0x52f10043,0x522920c6,0x20401020,0x08002040,0x10000800,0x30e320a2,0x62cf20a2,0x6b0f2947,0x422a62ed,0x5b110866,0x6c15218b,0x53136395,0x52d24ad2,0x8c9973f6,0x4a916bb6,0x74587458,0x7c797439,0x7c787438,0x5b536c17,0x4ad142d0,0x5b7310e9,0x6c386395,
-0x53347438,0x42d25bb5,0x7c365333,0x63935b32,0x5b536bb4,0x5b7542d2,0x5bb65b95,0x5b956c17,0x42905bb6,0x63d77c58,0x6c1863b6,0x63d74b14,0x537563f7,0x53756c18,0x63d75b96,0x63f75355,0x63d70006,0x63f65355,0x5b756bf7,0x63f75334,0x53964b34,0x63f85b96,0x53555376,0x5b9663d7,0x63b75334,0x5bb63271,0x74596396,0x5355090c,0x5bd763b7,0x4b355376,0x5b965396,0x63f75bd6,
-0x63d663d6,0x5b975bb7,0x53965bb7,0x5bb74b55,0x63d75bb7,0x5bb75b96,0x5bb75bb7,0x5b965bb7,0x5bb763b7,0x5bb763b7,0x63b75bb7,0x63b763b7,0x5bb75bb7,0x63d763b7,0x63d763d7,0x63f763d7,0x63d763d7,0x42d25b95,0x0088110a,0x21286b55,0x3a0c2129,0x94b56350,0x4a6e18e7,0x6352426e,0x1908298b,0x28a42927,0x31ab18e7,0x4aaf5310,0x63746b74,0x5aae5312,0x10845aef,0x5aef18c6,
-0x6b7473b5,0x3a0c73b5,0x0004bdfd,0x7c376b71,0x73d48478,0x73926352,0x73b37393,0x7bb352ef,0x63107351,0x73d48456,0x84367c36,0x7c145b11,0x63535af1,0x0006b5dd,0x00266bb4,0x94d97c15,0x7c158cb7,0x3a2f73d4,0x94b88c97,0xc65ea53a,0x94b78c97,0x94f8adbb,0x8cd78cb7,0x9cf79d39,0x83f19454,0x38e349c8,0x52cf20c5,0x7c139d18,0x9cfaad5a,0x733394d9,0x73728c14,0xa5379cf7,
-0x9d7d0024,0x7c577c37,0x5b736b94,0x951b5b74,0x95197437,0x951a6375,0x84986bf5,0xa4d77415,0x49a89cd7,0x00010800,0x632e39c9,0x396639a8,0x184028c4,0x18801861,0x08000800,0x31240000,0x528c41c7,0x39c8630d,0x52ce0001,0x73b35af1,0x63b58454,0x110b7c16,0x6396218d,0x6bd76bd6,0x7c797c79,0x74586bf7,0x74584b34,0x5b945b74,0x63734af2,0x31ac5b11,0x5b5573f6,0x63b65354,
-0x53545b74,0x52d24354,0x531242b2,0x426f3a90,0x4ad24a90,0x6bf75b96,0x64165b95,0x325263d6,0x08a95334,0x74387438,0x6c1763d7,0x6bf75b76,0x63f75b56,0x42b35b96,0x63f75b96,0x5bb65375,0x5bd77438,0x42f34b14,0x53752a30,0x53765bb6,0x63d763d8,0x535563d7,0x5bb65bb6,0x63d64af2,0x84b921ad,0x74165b53,0x7c9a63b6,0x4b145b95,0x63b65bb6,0x53755355,0x5bb65375,0x5bb75b96,
-0x5bb75376,0x5bb75b96,0x5bd75bb7,0x53765396,0x5b965bb7,0x5bb75bb7,0x5bb75bb7,0x5bb763b7,0x5bb75bb7,0x5b975bb7,0x63b75b97,0x63b763b7,0x63d763b7,0x63b763b7,0x63d763b7,0x63d763d7,0x5b7563d7,0x63b663d6,0x63952a0f,0x08a63a0e,0x73d531cb,0x52ce8cb6,0x424d5aee,0x5b325b11,0x21493a2d,0x5ace2948,0x841318c6,0x3a0e52f0,0x5b7442b1,0x7c157416,0x5af06331,0x1907ad79,
-0x31cb0023,0x52cf7393,0x7c36218b,0x00049d1c,0x08665b10,0x10e78455,0x5b1073f4,0x4a6d6393,0x63511087,0x73934a6e,0x7c1594b7,0x6b938cb8,0x318d3a2e,0x5af05af2,0xb59a20e9,0x8c568c96,0x94d85b31,0x5b118c76,0x94f88c97,0x8c979cf8,0x9d193a2d,0x84778476,0x94d894f8,0x9cf79d39,0x9c3394d5,0x08021023,0x5b2d18c3,0x8c76b5fb,0xa558a518,0xad9aad59,0x94978c56,0x94b68c96,
-0x52f300a3,0x6bb55312,0x7c7731cd,0x74577c57,0x8cd88cfa,0x84b95b54,0x8cb863d5,0xc59b94f9,0x41658c55,0x10220800,0x10820801,0x00001062,0x102028e3,0x18a01820,0x000018a1,0x00000000,0x00000800,0x73b13189,0x6bb25af0,0x6b7294d8,0x52f11928,0x63d64af2,0x53347c57,0x7c587438,0x7c796bd8,0x7c9963b6,0x5b547438,0x6c1642b0,0x216b5b94,0x4270426e,0x6c175333,0x537563d6,
-0x745763b6,0x21ae63d6,0x531242b2,0x31ed63d5,0x741752f1,0x5b9563b6,0x53576bf7,0x53745b97,0x73f63250,0x6bf842b3,0x29f16416,0x6bf863d5,0x4b145335,0x4b3563f7,0x63d763f7,0x32713271,0x5bd75354,0x325163f7,0x4b345375,0x3a925375,0x53755376,0x4b145375,0x42f35355,0x4b114b12,0x4af03a6d,0x194d0048,0x32506bf7,0x53754af3,0x537542f3,0x5b964b34,0x53755bb6,0x5b975356,
-0x5b965bb7,0x5b965bb7,0x5bb65b96,0x5bb75bb6,0x5b965bb7,0x5b965b96,0x5bb75b96,0x5b975b96,0x5bb75bb7,0x5b965b96,0x5bb75b96,0x5bb75b96,0x5bb75bb7,0x5bb75bb7,0x5b9763d7,0x63d763d7,0x63d763d7,0x325063d6,0x5b745b75,0x4a8f10ca,0x6bb56393,0x52ce4a8f,0x4a6e6331,0x5b1231cd,0x216a4ad0,0x21272148,0x10a66350,0x3a4d3a2d,0x3a504ab2,0x424f5b33,0x52b073d5,0x8c960004,
-0x2947526c,0x424d1884,0x73d44aef,0x84988478,0x10a60025,0x6b737c34,0x0866424d,0x6b716bb3,0x31ab39ec,0x7bd47bf4,0x73d431ab,0x73f56bb4,0x9d195b32,0x31ad6b93,0x39ca0004,0x422d422b,0x6b93bdfc,0x73f58cb7,0x8c976b73,0x8c968c76,0x08a76372,0x7c5694f8,0x94d88c97,0x9495ad9a,0x08029412,0xce5c52ce,0x4aac0843,0x4a4e190a,0x31aa8434,0xa5388434,0xad79b5ba,0x8c95a539,
-0x08e72188,0x194b7c97,0xa59d94fa,0x8cd85314,0x94fa8499,0x74375313,0x8cd98cda,0xb57994fa,0x28821864,0x00010800,0x18621022,0x396628e4,0x184020a3,0x20a11840,0x000020c1,0x00000000,0x52ce7390,0x52ae4a8d,0x4a8e3a2c,0x216a422c,0x4b120025,0x6bf663f5,0x74377c58,0x6c1863d6,0x7c797459,0x7c7963b6,0x6bd67458,0x3a4d5b54,0x7416194b,0x53325b73,0x6c174ad1,0x74376c17,
-0x53545375,0x3a905374,0x5b952a30,0x4ad17416,0x5b543230,0x63d663b5,0x6c1719ae,0x3a9163b6,0x63b60048,0x6c385375,0x535563d8,0x4af44b33,0x63d74293,0x53755355,0x6c185bb6,0x63d7114d,0x5b9763d6,0x19af4af5,0x53544b35,0x42f32a12,0x63d763d7,0x6bd663d8,0x112a5b34,0x000508a8,0x5b5463b5,0x42d24b13,0x19af4b35,0x112d19af,0x32723272,0x3ad43a92,0x5bd73ad4,0x53965bd6,
-0x5bb75bb7,0x5bb75bb7,0x5bb65356,0x5bb65b96,0x5bb65376,0x5bb65bb6,0x5b965bb6,0x5bb65bb6,0x5bb65bb6,0x5bb65bb6,0x5b965bb6,0x5bb75bb7,0x5bb75bb7,0x63b75bb7,0x5bb763d7,0x63b763b7,0x5b9663d7,0x535563f8,0x196c5b95,0x531242d1,0x63946394,0x6b716bb3,0x6372298a,0x52f23a4f,0x3a4d42b0,0x422c2969,0x39eb39eb,0x5b52424d,0x53343a91,0x53535333,0x63745b12,0x6b718456,
-0x2968316a,0x00040844,0x3a0b18c8,0x84566bb3,0x00668c97,0x6b9408c8,0x73d5426f,0x73f45af0,0x52ef6351,0x5b117c35,0x4ad02129,0x849773f4,0x52f15b52,0x63526352,0x21296b93,0x63932169,0x18e72149,0x94d76b92,0x19095b11,0x84367c15,0x52b07c15,0xa5597bd4,0x84357c55,0x734f9cb6,0x524c3127,0x8c537c35,0x426d0023,0x94b66bb3,0xad798455,0x6350a538,0xc5db8c74,0x9cb69cb6,
-0x088531c8,0x9d7c3a8f,0x849984b9,0x84d884da,0x7c376bf8,0x84987c58,0x63957437,0x73b45313,0x10422883,0x7c340001,0x20829494,0x00002904,0x20a262ab,0x10201840,0x18811040,0x00001040,0x5af10002,0x73d352af,0x73b33a2d,0x637110c7,0x955c5331,0x74163a71,0x21cd5353,0x5b7563b6,0x7c797438,0x63d77c9a,0x7c587c58,0x74147416,0x5b948cd9,0x5b7463d5,0x63d763d6,0x535563d7,
-0x5bb663d6,0x63d67479,0x63b55375,0x7c9821ad,0x63955334,0x21ad5313,0x5b977417,0x326f63d7,0x531442b1,0x5bb64b34,0x3ab24b14,0x42b342f2,0x6c186c17,0x5b9663f7,0x6c185375,0x63b784db,0x3a926bf7,0x3a936c19,0x42f55bb5,0x53755b76,0x6bd75bb6,0x7c1763b5,0x218b216a,0x218e3a4f,0x639563b5,0x42d23a91,0x42b34b35,0x4b155355,0x53555356,0x5bd75b96,0x53764b35,0x4b155376,
-0x53565376,0x53765b97,0x53964b55,0x5bb65bb7,0x5bb65bb6,0x5bb65bb6,0x5bb65bb6,0x5bb75bb6,0x5bb75bb6,0x5bb65bb7,0x5b965bb6,0x5bb65b96,0x5bb75bb6,0x5b965bb7,0x5bb763b7,0x5bb763d7,0x63d75bb6,0x53755bd7,0x29ef5334,0x6bd5112b,0x4ab2194b,0x6b9252f1,0x52f02149,0x6394320e,0x196b5332,0x6b9231ec,0x4aaf31ec,0x42af31ed,0x5b546bf6,0x74366394,0x4a90190a,0x216a4ab1,
-0x0865420c,0x52af5ad1,0x4a4dce7d,0x7bf4528e,0x63728455,0x8c985b31,0x3a0f73d6,0x633273b4,0x422e52d0,0x635252d0,0x4ab073b3,0x6bb46b93,0x5b537416,0x6bd55312,0x94b873d5,0x426f6b93,0x94d86b94,0xad590085,0x73d49cf8,0xb5bc73d4,0xbdfd8436,0x31a939eb,0x6b2f9cd6,0x1023522b,0x4a2c6b0f,0x9c74ce3c,0x29890843,0x8434b5bb,0x8c757bd3,0x8434a538,0x5a8c6b70,0x5a4d49ca,
-0x4a2b20c6,0x63b51108,0x74378499,0x533363b5,0x6c166bf6,0x8cf984b9,0x63b58cb9,0x8cb894fa,0x18a34966,0x63720864,0x39876b91,0x6b4d0000,0x18415269,0x08000800,0x10200820,0x18a118a1,0x08650000,0x3a2d52cf,0x00035b10,0xa59b52af,0x53334af0,0x53346c16,0x74175374,0x63956bd6,0x74587438,0x5b966c58,0x74797c58,0x6394a55a,0x4b136c38,0x6bf663b6,0x6bf75354,0x6c186bf7,
-0x6bf76bf7,0x6bf63ab2,0x6bf65b96,0x5b7500a9,0x42925313,0x42b1194d,0x639508eb,0x4af07437,0x5b955b75,0x4b1463d7,0x4af363b5,0x5b75114d,0x4b1463b6,0x53b763f7,0x53345375,0x74386396,0x5b962a10,0x63d65b95,0x63d85356,0x5b965375,0x10a88c99,0x29ee4af1,0x3a4f320f,0x53135333,0x323021ce,0x2a3042f2,0x5b966bd7,0x5bb663b6,0x42d34b34,0x5b965b96,0x5b965b96,0x53555b96,
-0x53965bb6,0x5bb65bb6,0x53765bb6,0x53965376,0x5b965bb6,0x5bb65b96,0x5bb65bd7,0x5bb65396,0x5bb65bb6,0x5b965b96,0x5b965b96,0x5b965bb6,0x5b965b96,0x5b965b96,0x5b9663b7,0x5bd75bb6,0x63d75bb7,0x5b9663b6,0x42915355,0x08ea6bf7,0x52f23a70,0x320d10e9,0x428e426e,0x6395324f,0x4b324b12,0x6bb44290,0x3a4e3a4d,0x5b5531ed,0x6bb56bf6,0x7c376bd5,0x63740886,0x8cb76bb4,
-0x19080002,0x52b05ad0,0x08866394,0x422d31ca,0x322d3a2d,0x4ad18d19,0x4af23a90,0x3a4f5b73,0x4a906b74,0x6bf57c15,0x4af163b4,0x53124290,0x6bf67c56,0x74377417,0x322e8498,0x004639ec,0x73d48457,0xa57b214d,0x00025330,0x6b92422e,0xbdb99cd6,0xa5598c35,0x00040002,0x5b10216b,0x52ae0001,0x62cd39ab,0x3a0a20c6,0x52cf4a8f,0x63517393,0x73d352cf,0x947494b5,0x528c62ed,
-0x6b7139eb,0x7417194a,0x63b57c58,0x74577437,0x7c987437,0x8cb884d9,0x74387c58,0x94338c77,0x29451821,0x526d5b0f,0x00009494,0x39876b2f,0x18212946,0x08000800,0x08000800,0x738e1881,0x00230842,0x5af039eb,0x63723a0c,0x424e6b72,0x63d5320c,0x42d27c98,0x74177458,0x5b5463b6,0x74586bf7,0x53767458,0x73f67438,0x6bf742b1,0x53347438,0x63d66bf7,0x6c177458,0x6bf76c17,
-0x74387458,0x6c173271,0x4af25bb6,0x8cda8cda,0x5b54194d,0x31ee3a91,0x7c375312,0x63940005,0x63b65b75,0x4ad25b54,0x29ef5b74,0x42d35bd7,0x53565b75,0x42f363f7,0xbe5e84ba,0x6bd900aa,0x5b954293,0x5b953a91,0x63b60029,0x845863d6,0x00050908,0x10ea73f5,0x429031ee,0x533442d1,0x4b135334,0x53543271,0x5b765334,0x5bb66396,0x4b144b34,0x53764b35,0x5b965b96,0x5b965b96,
-0x5bb75bb7,0x5bb65bb6,0x5bb65bb6,0x53765396,0x5b965bb7,0x53965b96,0x53965396,0x53965bb6,0x53965396,0x5b965b96,0x53965b96,0x5b965396,0x5b965b96,0x5b965b96,0x5b965b96,0x5bb65bb6,0x63b75bb7,0x6bf763b7,0x3a705334,0x42b129ef,0x63955b74,0x4ab0194b,0x29ec31ed,0x5b754af1,0x53545354,0x74374b13,0x639342af,0x63b629ad,0x5b7563b5,0x090b6395,0x10c90086,0x424f73d5,
-0x528e31cb,0x5b112128,0x63306373,0x5b1152ce,0x324e3a2e,0x4af208e9,0x6bf66395,0x73f631ee,0x52f152f2,0x5b535b32,0x5b747416,0x63b57436,0x74577437,0x7c787c78,0x7c377c78,0xad9c6394,0x8cb794d9,0x31ed6335,0x84779539,0x8cb773f4,0x00242949,0x531210c8,0xaddcadde,0x74368cd9,0xdeff52f0,0x6b0e422c,0x5b0f0843,0xbddc7c14,0x7bf473d3,0xad598c96,0x94548c54,0x94b57370,
-0x8cb931ee,0x42707c35,0x5b545333,0x74377417,0x7c987c98,0x8cd984b9,0x6bf77437,0x20419cb8,0x08400800,0x8bd18c74,0x29471043,0x080241ea,0x18208c32,0x08000820,0x08000800,0x62cc20c3,0x000139a8,0x7bd40023,0x19297415,0x3a2d6b72,0x42f26c14,0x74373a91,0x7c587458,0x5b757417,0x63d66bf7,0x4b1463d6,0x00054b14,0x6c584b96,0x5b957438,0x6bf663b6,0x6c175374,0x63d75b75,
-0x53557438,0x74375bb6,0x0005955d,0x74584270,0x198c7416,0x4a716bd5,0x3a4e5b32,0x639542b0,0x63d763b6,0x216b216b,0x42d229ce,0x5b955bb6,0x5bb76c17,0x6bf763f7,0x5b560005,0x5b746396,0x21ce5335,0x535463d7,0x6bb64ad3,0x21280048,0x114a4af1,0x322e0005,0x4ad052f1,0x21ae3a70,0x53545b95,0x3ad24b35,0x53555b76,0x4b345b55,0x53555bb6,0x53355b96,0x5b965b96,0x5b965bb7,
-0x53965bb7,0x5bb65bb6,0x5bb65bb6,0x53765396,0x5bb75bb7,0x53965b96,0x53965396,0x53965bb6,0x53965396,0x5b965b96,0x53965b96,0x5b965396,0x5b965b96,0x5b965b96,0x5b965b96,0x5bb65bb6,0x5b965bb7,0x5b755b96,0x3a505355,0x74165333,0x32507437,0x63d5090a,0x42b042d0,0x42b24af2,0x63d763d7,0x42f263d7,0x639342f1,0x5b353a6f,0x196d5333,0x74585b75,0x8cb72149,0x73f673f6,
-0x5aef6b52,0x00440044,0x5acf9517,0x298c52ce,0x6bd56394,0x5b754af2,0x74377417,0x63948cb9,0x53327416,0x74154af0,0x7c577c57,0x5bb56bd5,0x74375b95,0x7c987c58,0x849a849a,0x002684ba,0x7c563a2f,0x84b952d3,0x42507c58,0x74156bd4,0x528e6bb3,0x63f47415,0x94da94d9,0x94d89cf8,0x214a951a,0x83d17bf2,0x424d20c6,0x7bd38454,0x7c146b52,0xad797c14,0x5acd8c74,0x94b583d3,
-0 };
@@ -1,1052 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT const unsigned int
-#endif
-
-A32BIT Face2[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x00000100,		/* dwHeight */
-0x00000100,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00010013,		/* dwpfFlags */
-0x00020000,		/* dwDataSize */
-0x00000010,		/* dwBitCount */
-0x0000f800,		/* dwRBitMask */
-0x000007e0,		/* dwGBitMask */
-0x0000001f,		/* dwBBitMask */
-0x00000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x18c23186,0x292441e7,0x39c739c7,0x528b2966,0x6b4e6b6e,0x28e32945,0x5aab3965,0x84318410,0x734e83cf,0x732d730d,0x734e7baf,0x734e6b6d,0x734d6aed,0x736e734e,0x6b2c630c,0x314539a6,0x31453986,0x31653144,0x41664166,0x6aed4188,0x736e736e,0x734e7bb0,0x7b8f734e,0x83b083d0,0x738f7bb0,0x734e83d0,0x7b8f7b6f,0x526a736e,0x20e43146,0x20e33125,0x29243986,0x31443144,
-0x28e33124,0x290320e3,0x398520e2,0x31233965,0x31233122,0x28c128c1,0x294628e2,0x42084a49,0x316639e7,0x5acb4a4a,0x6b0d6b2e,0x20e352aa,0x184120c1,0x292428a2,0x39a82925,0x31673987,0x41c83987,0x396739a8,0x31463126,0x20812903,0x31243124,0x28e23103,0x52285207,0x31663186,0x39a73187,0x31c831a8,0x39c831c8,0x31c839e8,0x29672967,0x298739c8,0x31a82967,0x31a731a8,
-0x31c831a8,0x31c939c9,0x31a839c9,0x31c831c8,0x318731a8,0x39a83187,0x20e32925,0x41e983ae,0x31a731c8,0x31a82967,0x216631a8,0x29882967,0x00202967,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10a20000,
-0x21262946,0x21462126,0x29462126,0x29662967,0x31872946,0x21452966,0x31663166,0x29452945,0x31662946,0x31462945,0x31663186,0x39873166,0x31653166,0x31863186,0x31662945,0x29252925,0x18c320e4,0x20e32104,0x10402103,0x00001040,0x08400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x10400800,0x28e01840,0x20803943,0x10001000,
-0x10412925,0x210539a7,0x296631a7,0x738e39c7,0x7bf08410,0x314662ec,0x29253987,0x841083f0,0x52297baf,0x7b2e49a7,0x7b6e62cc,0x732d7b8f,0x7b8f8c11,0x62ec6b2d,0x41e739a6,0x318639a6,0x41e739a7,0x31652945,0x39a63145,0x62ab3166,0x7b8f7b8f,0x732e738f,0x734f7b8f,0x83f1734f,0x7b6f83b0,0x736f734e,0x83b07baf,0x49c8736e,0x20c32945,0x29242904,0x31653186,0x31453145,
-0x31243144,0x31442903,0x31243965,0x39853124,0x31023964,0x28e13102,0x39a628e2,0x42295acb,0x630c4a49,0x630c62ec,0x6b0d5acb,0x29043146,0x28e33124,0x314420e3,0x39873145,0x39a741a7,0x41a841c8,0x314641a7,0x39c739a7,0x28a23166,0x31434185,0x39853964,0x290341e6,0x31a83167,0x31a72966,0x39e93187,0x39e92146,0x39e939e9,0x318831a8,0x31a72967,0x318731c8,0x31a731a8,
-0x298731a8,0x31873a09,0x31a839c8,0x31a83188,0x318731a7,0x31873187,0x000031a7,0x39867b8c,0x298731a7,0x31c93188,0x29882988,0x29672988,0x31872987,0x000018e4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29660021,
-0x29462967,0x19052967,0x29462146,0x29662966,0x21462986,0x29662966,0x31672966,0x31462925,0x31663186,0x31862925,0x31873186,0x29463186,0x31663166,0x31663166,0x31862945,0x31652945,0x29252945,0x20c320e4,0x18a120c2,0x10400800,0x08201060,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x00000000,0x00000000,0x10000000,0x28c15a46,0x18000800,
-0x31451882,0x084239a7,0x39c72966,0x632d18c3,0x83f08410,0x734d7bf0,0x00006b2d,0x83f07b8f,0x28e5736e,0x49a83946,0x62cc734e,0x734d736e,0x5a8b734d,0x398641c8,0x29453986,0x318639c7,0x526939c7,0x29452924,0x39863145,0x41c82925,0x7b8f7b8f,0x7b6f6b4e,0x7b8f7baf,0x6b2e736f,0x83b07b8f,0x7b6f732e,0x734e736f,0x414662ec,0x20e43146,0x20e42925,0x39a62904,0x39861882,
-0x28e33124,0x31443124,0x31453124,0x29233145,0x31023123,0x28c23963,0x5a893104,0x6b8e7bae,0x630c630c,0x62cc6b4d,0x6b2d5b0c,0x28e33125,0x20c21882,0x39851881,0x31662924,0x31463166,0x29043965,0x20c32903,0x420839c7,0x100041e8,0x08001020,0x10400800,0x188120c2,0x29462925,0x31a72966,0x31a839c8,0x31a82987,0x39c839e9,0x318831c8,0x31a82968,0x31a731c8,0x31a831a8,
-0x29673187,0x29462987,0x31872967,0x31873187,0x31a839e9,0x31a72987,0x00002966,0x41a73964,0x29873187,0x29472988,0x216739c9,0x31a829a8,0x296731a8,0x29462966,0x002118e4,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18e40021,0x29462966,
-0x29662146,0x21262146,0x29662946,0x29462966,0x29662966,0x29462966,0x31872125,0x31663166,0x29453146,0x31663166,0x31662946,0x31462946,0x29463186,0x29452946,0x31663186,0x29453186,0x20e43165,0x292318c3,0x20e22101,0x20e118a1,0x080018a1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08001020,0x00200000,0x10001040,0x28c10800,0x49c54185,0x286128e1,
-0x41e83186,0x18a33186,0x29453187,0x4a2941e8,0x83d07bcf,0x7b8f7bcf,0x29253966,0x6b0d7baf,0x2905524a,0x31055a2a,0x392649e8,0x524941c7,0x41c83166,0x29453986,0x31862945,0x31652924,0x39a62924,0x31652945,0x29452945,0x4a4a3166,0x7bb0738e,0x6b4e7bd0,0x7b8f7bb0,0x6b2d734e,0x83f1736f,0x7baf734e,0x734e6b2e,0x28e55a4a,0x318628c4,0x29452104,0x39662104,0x31453145,
-0x31442903,0x316520c3,0x29043124,0x290341c7,0x28c120c2,0x312428e2,0x526a28e3,0x6b2c6b2c,0x6b2d6b0d,0x6b2d62ec,0x5aab6aed,0x31043125,0x20c330e4,0x31641860,0x20c33165,0x31453124,0x39863145,0x28e328e3,0x526a3187,0x182239a7,0x08001000,0x18620800,0x31863986,0x31882105,0x31a731a7,0x31c831a8,0x39c831a8,0x31c939c8,0x29682947,0x39c831a8,0x31a831a8,0x318739c8,
-0x31a83187,0x29672967,0x31872987,0x29673167,0x31a82987,0x31873187,0x004231a8,0x39454185,0x29873187,0x31872987,0x31a831a8,0x29872946,0x31c82987,0x29672967,0x29872946,0x21052946,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08820020,0x29662966,0x29662125,
-0x29662146,0x29662967,0x29462966,0x21252105,0x21052145,0x29252946,0x21052946,0x31662946,0x31462945,0x31663166,0x31863186,0x31652966,0x29252945,0x31653145,0x31663166,0x29453165,0x20c32945,0x18a218c3,0x10802923,0x20c120c1,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08001840,0x08000000,0x10000800,0x18601000,0x080020c1,0x49c530c1,
-0x316641e8,0x39a73166,0x31863166,0x318739a7,0x6b4d4a49,0x5a8b6b2d,0x524a20e4,0x39467baf,0x730d49c8,0x7b8f732d,0x29053125,0x39873145,0x39873125,0x29453986,0x29243166,0x31453165,0x39a63165,0x21043165,0x5aaa4a49,0x62ec4208,0x7baf734e,0x738f738f,0x7b8f738f,0x6b0d734e,0x732e732e,0x734e83f1,0x6b2e732e,0x3186526a,0x294539a7,0x20c32925,0x31452104,0x31453166,
-0x528a4a49,0x29044a08,0x39652904,0x31653986,0x20813124,0x20c328c2,0x528a3145,0x630c6b2d,0x5a8b62ec,0x62cb62cb,0x49e762ab,0x28c33124,0x28e328c3,0x29231881,0x41a63165,0x20c33965,0x39653145,0x290320c2,0x41e82925,0x186239c8,0x31653985,0x18623986,0x29241882,0x31a83187,0x29663187,0x21463187,0x31c831a8,0x31c931a8,0x39c93188,0x39c831c9,0x39e92987,0x31a739c8,
-0x31a83187,0x298731a8,0x31872967,0x29672967,0x29672967,0x29462987,0x31c82946,0x41c70000,0x29a739a8,0x29873187,0x31a831a8,0x29672987,0x31872987,0x29872967,0x29663187,0x31873187,0x108139c7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10a30000,0x21252125,0x21252125,0x21252146,
-0x21262126,0x29662967,0x29662946,0x29662125,0x29462966,0x29463166,0x31662926,0x31462945,0x31663166,0x31663166,0x29452946,0x31652966,0x39a63165,0x31453165,0x31452925,0x29452924,0x29242925,0x20e32924,0x20e120c1,0x188020c1,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18600800,0x00000000,0x08000000,0x00000000,0x10000800,0x41631820,
-0x29463166,0x318720c4,0x294539a7,0x31663186,0x39873166,0x398741e8,0x736e20c4,0x41c75aab,0x736e2925,0x528a736e,0x39a73166,0x39c7526a,0x39a72925,0x4a293187,0x296539a7,0x29652944,0x29452124,0x5acb2925,0x630c6b4d,0x62ec4a4a,0x7bd0736e,0x7b8f83f1,0x736e736e,0x7b8f630d,0x7baf734e,0x7b8f7b8f,0x734e7b6f,0x314662ed,0x29452924,0x210439c7,0x316520e3,0x318641e7,
-0x62cb5a8a,0x20c34a08,0x31241882,0x31453965,0x29043965,0x31442904,0x41a73986,0x49e841e8,0x310449c8,0x39243904,0x28623904,0x10002041,0x28a22061,0x20e21861,0x41852904,0x20a23123,0x39244165,0x31443123,0x4a293146,0x31653986,0x318620e4,0x18c32924,0x21040841,0x31c83186,0x29672987,0x31a718e4,0x31c839c8,0x39c931a7,0x31a83188,0x31a831a8,0x39c92947,0x39c839e8,
-0x31a83187,0x29673187,0x29462987,0x31872967,0x31a82967,0x39a83187,0x318731a8,0x39850000,0x298839a7,0x29872987,0x31a82967,0x29882987,0x31a72947,0x298731a8,0x21462967,0x31a82967,0x29464209,0x000110a4,0x00010862,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10c40000,0x212618e5,0x21262926,0x29262926,0x29462966,
-0x21252926,0x21462926,0x29461904,0x29462946,0x29462946,0x31463167,0x31663166,0x31463166,0x39873146,0x29453166,0x31452945,0x31253165,0x39662925,0x29253145,0x31453145,0x29452945,0x29042104,0x10823165,0x21022943,0x082018a1,0x08000820,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18401020,0x00000800,0x10000800,0x10000000,0x10002881,0x18001840,
-0x31872925,0x316639c7,0x31662105,0x31863166,0x31463187,0x39a73966,0x41e841c7,0x398639a7,0x41c72904,0x41e74a49,0x524a3986,0x5acb6b2d,0x62cc62ec,0x6b4d5acb,0x296662ec,0x31862104,0x318639e7,0x62eb2945,0x6b2c630c,0x39a73166,0x736e6b4d,0x83d07baf,0x6b4e7b8f,0x738f6b4e,0x7bb083d0,0x83d0734e,0x736f7bb0,0x4a096b0d,0x31662924,0x21043986,0x316520e4,0x31863165,
-0x39a739a6,0x29033144,0x28e31882,0x31243145,0x31243965,0x41c62904,0x398741e8,0x20c43986,0x18821842,0x20a22082,0x20822081,0x10402082,0x184020c2,0x20c020a1,0x28e228e2,0x208128c2,0x31033103,0x29243143,0x31442924,0x39a741c6,0x18c328e4,0x18c32925,0x316520e3,0x192531a7,0x212618e5,0x39c831c8,0x39e831a8,0x31a931a8,0x29a831a8,0x296829a8,0x31a82968,0x39c84209,
-0x31a839e9,0x31a73187,0x298739e8,0x29663187,0x29672987,0x31873187,0x29463187,0x5a891082,0x29872946,0x31a83187,0x29872967,0x31882967,0x21462126,0x31a831a7,0x29872987,0x39c82987,0x29462946,0x21052966,0x18e52126,0x29462967,0x212518e4,0x000031a7,0x00000000,0x00000000,0x00000000,0x00000000,0x18e40000,0x18e51925,0x294618e5,0x29463187,0x29462926,0x29462105,
-0x31872926,0x29862125,0x29662946,0x21252125,0x31873166,0x29462946,0x29252925,0x31463146,0x39863166,0x31653166,0x31663186,0x31452945,0x31663125,0x20e42924,0x29242925,0x29252945,0x29453165,0x31652104,0x20e22122,0x104118a1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x10000800,0x10001000,0x00200800,0x00000020,0x10001841,0x28201000,
-0x39e83167,0x31464208,0x316620e4,0x39a72945,0x39a739a7,0x292541c8,0x29053166,0x292539c7,0x39862904,0x294539a7,0x4a293146,0x630c738e,0x6b2d6b2d,0x62ec62ec,0x52ab630d,0x52aa5aec,0x31863186,0x528a3186,0x5aab6b2d,0x39a73166,0x736e6b2d,0x7b8f6b2d,0x734e6b2e,0x6b2e7baf,0x7bd0630d,0x736f6b0d,0x6b2d736f,0x3987732e,0x21042924,0x29452945,0x292520e4,0x29453186,
-0x31453166,0x20e339a6,0x29041882,0x39652904,0x31243124,0x39853124,0x41e841e8,0x20e43966,0x290320e4,0x28e328e3,0x08003103,0x20e21840,0x18602924,0x20c028e2,0x28e220c1,0x28c228e2,0x28e228e2,0x290320c1,0x29232903,0x31652923,0x31662925,0x10822924,0x31862104,0x21662125,0x29872946,0x31a731c8,0x31c83187,0x31883187,0x29a831a8,0x318831c9,0x39c939ea,0x39e839a7,
-0x31a831c8,0x39e831a8,0x31a731c8,0x31c831a8,0x31a72987,0x31a83187,0x39a831a8,0x5aaa31a7,0x298839a7,0x31872967,0x318731c8,0x29682967,0x29662967,0x31a82946,0x29672987,0x21262146,0x21262126,0x29672946,0x29872967,0x29462126,0x29872126,0x21462186,0x000018e3,0x29450020,0x294531a6,0x21252945,0x21462945,0x21462146,0x21262105,0x29462105,0x21262126,0x21052946,
-0x29462966,0x21252946,0x21052966,0x29462966,0x29462125,0x29252905,0x31662945,0x39662925,0x39863166,0x39a63166,0x31663165,0x31453165,0x31452904,0x29252904,0x29253165,0x29252945,0x31652925,0x29442104,0x20c22943,0x082020e2,0x08200820,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x30c21000,0x00200800,0x10200000,0x20820800,0x08001021,0x28001001,
-0x528a5aec,0x318639c7,0x20e41082,0x31873186,0x5aaa3146,0x39a66b2c,0x41e83186,0x31653186,0x39a73125,0x39a639a6,0x31452925,0x6b2d5aab,0x6b2c6b2d,0x6b4d736d,0x62ec736d,0x630c6b2d,0x42295aec,0x422939e8,0x31864a08,0x39873166,0x6b4e62ec,0x6aed6b2e,0x6b2e83d0,0x736e734e,0x7b6f734e,0x7b8f6b2e,0x736f7bb0,0x31467b4e,0x290418e4,0x312520c3,0x29242925,0x31653165,
-0x31453986,0x31662925,0x20e32944,0x31452903,0x31453165,0x29442904,0x41c84a09,0x398739a8,0x316639a7,0x290320c3,0x18a11060,0x18811881,0x20c220e2,0x20c12902,0x28e22902,0x28e228c1,0x28e228e2,0x28e23143,0x29041882,0x39862904,0x29453165,0x21253186,0x18e418c3,0x29462125,0x318831a7,0x29882968,0x31a83187,0x31a931a7,0x31c939c9,0x39e92988,0x3a0931c8,0x39c839c8,
-0x31a731a7,0x318731a7,0x29663187,0x31c831a7,0x298731c8,0x39c839a7,0x39a841e9,0x31663167,0x29882946,0x318731a8,0x31873187,0x29462946,0x29872987,0x29672967,0x29462967,0x29462966,0x29462947,0x29672125,0x21262146,0x29672946,0x31872126,0x31872966,0x31a72966,0x21452146,0x31a72966,0x29462966,0x21462125,0x21462125,0x21062126,0x29462106,0x29262926,0x29252105,
-0x29452945,0x29462125,0x29662946,0x31662946,0x29253166,0x31463146,0x31662946,0x31662905,0x31453145,0x31453145,0x31663166,0x29253166,0x31453145,0x31253165,0x31662945,0x29452104,0x18c22103,0x29232103,0x18a13144,0x10201880,0x00000000,0x08200000,0x08000800,0x00000000,0x08000800,0x08001020,0x00000800,0x08201841,0x00000000,0x00001000,0x28a01000,0x72858b8b,
-0x738e738e,0x4a6a6b6e,0x31663166,0x39a73187,0x52695acb,0x4a28526a,0x29453186,0x39864208,0x39a741e8,0x31452904,0x39663165,0x62cb4a49,0x4a495aaa,0x736e6b2c,0x6aec5acb,0x6b6e6aec,0x42294229,0x5aec52ab,0x29454a49,0x29253146,0x6b2d3986,0x6aed736f,0x736f7b8f,0x83b07b6f,0x6b2e732e,0x6aed732e,0x734e732e,0x31465229,0x20c33166,0x29241882,0x21043166,0x41e82925,
-0x316539a7,0x31663986,0x31442924,0x31652924,0x31453165,0x29242904,0x41c83166,0x39c839a8,0x39c839c7,0x20e43987,0x188220a2,0x082020c3,0x290320c2,0x188020c1,0x28e228e2,0x20a13123,0x310228c1,0x28e22902,0x28e320c3,0x398641a6,0x31653966,0x21042924,0x21042104,0x31a82966,0x318839e8,0x31882967,0x31c831a8,0x31a831a8,0x29883188,0x31a829a8,0x298731c8,0x31a831a8,
-0x316739a7,0x29663187,0x29463187,0x31a739a7,0x298731a7,0x31873187,0x39c839c8,0x10643147,0x29881083,0x29872967,0x21462967,0x29872967,0x29672946,0x31882967,0x29463167,0x42084208,0x21262926,0x29462966,0x21262105,0x29462967,0x21462967,0x214631a7,0x21452146,0x21462966,0x29872946,0x29862966,0x21262966,0x19052946,0x21262126,0x21052946,0x21262126,0x29252926,
-0x29662966,0x21252945,0x21042946,0x31662125,0x31462945,0x31253146,0x29453166,0x31253146,0x31453145,0x316620e4,0x29253145,0x31452924,0x31453166,0x31453145,0x31662946,0x29452104,0x20e32924,0x29242103,0x29232924,0x10001040,0x00000800,0x18410800,0x00000000,0x08000000,0x10401020,0x08000800,0x10000800,0x00000820,0x00000000,0x10000001,0x93cb1000,0x7ac7cd72,
-0x7bd08410,0x6b6e83f0,0x41e83166,0x39a739a7,0x292439c7,0x318639a7,0x3165528a,0x420841e7,0x41e74208,0x39663166,0x39863166,0x4a0820e4,0x41e841c7,0x5a694a29,0x49e83986,0x6aec5a8a,0x5acb6b0d,0x528a630c,0x2925528a,0x21252945,0x6b4e2104,0x7bb0736f,0x83b083f1,0x736f7b8f,0x734e7b8f,0x736f6b2e,0x62ab7b8e,0x31053946,0x292420e4,0x29242104,0x31453165,0x41e83145,
-0x398639a7,0x314539a7,0x31653986,0x31653145,0x20a220c3,0x28e420c3,0x316620a3,0x39a739a7,0x41c841c8,0x294639a7,0x29042925,0x31653986,0x39a63166,0x31652904,0x39653144,0x31443144,0x28e23123,0x28e228e1,0x316541e7,0x31663165,0x31873186,0x21463167,0x31872966,0x296731c8,0x39c831a8,0x31a831c9,0x31a839c8,0x31a831a8,0x31a82967,0x318831a8,0x31a82147,0x31a831a8,
-0x39c73187,0x31873187,0x21262966,0x29673187,0x31872987,0x31873187,0x39a83987,0x29063167,0x29462967,0x21262146,0x21462146,0x29872967,0x31672987,0x31a72946,0x290331a8,0x62a95a88,0x39855248,0x29462104,0x21462926,0x29672966,0x29872146,0x21262946,0x21462967,0x29662166,0x29463187,0x29662146,0x19052946,0x21062967,0x29472926,0x21052926,0x29262126,0x29462105,
-0x18e42946,0x29452926,0x29452125,0x31662925,0x31863146,0x29252946,0x29453166,0x31662945,0x29452945,0x31653186,0x29252945,0x29043166,0x31662924,0x31462105,0x31662945,0x21042104,0x20c320e4,0x28e318a1,0x20e12944,0x00001080,0x00000820,0x00000000,0x00000000,0x08000000,0x00000800,0x00000020,0x00000000,0x00000000,0x00000000,0x10000000,0x416030e0,0x280040e1,
-0x7baf736e,0x6b2d83f0,0x4a0920e4,0x29253166,0x18a33187,0x294539a6,0x62eb6b2c,0x39a72945,0x41e83166,0x10623986,0x41c73145,0x39a73145,0x49e84a28,0x41a639a7,0x31253965,0x62cc4187,0x6b6e62ec,0x42296b4d,0x29663186,0x18e42946,0x736e5acb,0x7bd0738f,0x7bb0738f,0x734e83b0,0x736e734e,0x734e734e,0x3946734e,0x290520a3,0x31662966,0x290320e3,0x28e43145,0x41c73145,
-0x41c739a7,0x29252904,0x31652924,0x39a639a6,0x188228e3,0x08001020,0x18a31020,0x41e841e8,0x41e84a09,0x31663186,0x31453145,0x31863986,0x316539a7,0x29243144,0x39653986,0x28e33985,0x31453986,0x31243123,0x41a739a7,0x41c841c8,0x39a741e8,0x31c841e8,0x31c731c7,0x31a72987,0x39c831c8,0x31a831a8,0x31a831a8,0x31a73187,0x31882967,0x296731a8,0x31c92967,0x31873187,
-0x31a72946,0x31873187,0x31873187,0x21462967,0x31a72967,0x31673187,0x31673187,0x31473147,0x21462967,0x29462967,0x29462946,0x29672946,0x294731a8,0x29873167,0x4a462946,0x5a476287,0x62896aa9,0x292320c1,0x294518a3,0x212620e4,0x21262146,0x29672967,0x21462126,0x31a72146,0x29462966,0x21252146,0x21262967,0x21051905,0x29462926,0x21262126,0x29462105,0x29262946,
-0x21252125,0x29452125,0x21252925,0x31662945,0x29463146,0x29452946,0x29452945,0x29252925,0x29452924,0x29452924,0x31452945,0x31653145,0x29453165,0x29452946,0x29252946,0x21042104,0x290420e4,0x396520c2,0x29233185,0x08000820,0x08000800,0x00001020,0x00000000,0x18402081,0x00001000,0x00000020,0x00000000,0x08000820,0x08000800,0x20611000,0x180051c5,0x30801800,
-0x6b2d5aab,0x6b6e736e,0x39876b4d,0x314618c3,0x292439a7,0x31253186,0x7bae5aab,0x316539a6,0x29252925,0x31852904,0x41c639a6,0x41e741c7,0x39a739a6,0x31452925,0x31442924,0x31442924,0x6b0d4a08,0x632d6b4d,0x29665aec,0x39e82946,0x6b6e6b2d,0x7b8f73af,0x83d0738f,0x734e736f,0x6b0e62cd,0x734e732e,0x3145734d,0x31862924,0x39c739c7,0x29242945,0x29032924,0x31652904,
-0x39a63966,0x29042904,0x29033144,0x29042903,0x28e33145,0x20c220a2,0x10211881,0x316728e4,0x39a739a8,0x29263187,0x31453145,0x39a72904,0x31453166,0x21032903,0x31442924,0x31443144,0x31453965,0x31663165,0x39a841c7,0x41e94209,0x39e939c8,0x31a939c8,0x39e939e9,0x31883188,0x31c839c8,0x31a831a8,0x31a831a8,0x39a731a8,0x31a839e8,0x31a72967,0x31a831a8,0x298731a8,
-0x29872946,0x31873187,0x31873187,0x21672146,0x31872166,0x29663187,0x31873187,0x31a82967,0x29672967,0x21262146,0x29872967,0x29662966,0x29462967,0x31672967,0x4a051882,0x62675a67,0x41856248,0x29033164,0x4a271881,0x10623986,0x29463187,0x29662105,0x21462146,0x29662925,0x29462946,0x29462146,0x21262146,0x29262126,0x21262105,0x21262105,0x29262125,0x21052125,
-0x21252105,0x292520e4,0x29252125,0x29252925,0x29452925,0x29253146,0x29252925,0x31652945,0x29242945,0x29452104,0x29453165,0x31662945,0x31662925,0x29462945,0x29253145,0x20e32904,0x290320e3,0x20e32904,0x10602924,0x10002902,0x186020a1,0x10001000,0x20a11000,0x18401860,0x08000000,0x08200000,0x00000000,0x00000000,0x10001860,0x10001000,0x18001000,0x51612000,
-0x41e739a6,0x7baf730d,0x738e630c,0x41e818a3,0x31662925,0x41e83186,0x5aab0000,0x29043186,0x20e420e3,0x31852904,0x316520c3,0x39853986,0x31253145,0x316620e4,0x20c31062,0x29243985,0x734e3986,0x734e736e,0x294539e8,0x52ab2946,0x6b4e6b4e,0x6b2d632d,0x736e736f,0x6b0d83d0,0x41875229,0x734e6aed,0x394649c8,0x39c73186,0x39c739c7,0x292439a7,0x292420e3,0x41c720c3,
-0x41c739a7,0x29042904,0x29243145,0x398520e3,0x28e33144,0x28e32923,0x186128e3,0x21051061,0x39c83187,0x41c82926,0x31453986,0x39a620e4,0x292441e8,0x18c220e3,0x188120c2,0x28e320a2,0x31243145,0x29042924,0x39a828e4,0x39c839c8,0x39c841e9,0x31a931a8,0x29682968,0x39c93188,0x318731a8,0x318831a8,0x39c831a7,0x39c839e9,0x31c84229,0x31a731a8,0x31c831a8,0x29672966,
-0x31a72146,0x31a72966,0x29672966,0x29873187,0x29662167,0x29463187,0x31663167,0x29462946,0x21462126,0x21462126,0x29673187,0x29672987,0x29462967,0x31672106,0x5a660820,0x62685226,0x28c14163,0x39843164,0x52471881,0x08206b0b,0x318739a7,0x31662925,0x21052946,0x31662926,0x29462946,0x21462946,0x21261905,0x21052126,0x29262105,0x20e52946,0x29262125,0x29462125,
-0x29462105,0x20e42946,0x31462105,0x29452946,0x29253165,0x29252946,0x29452925,0x29452945,0x31652945,0x20e43165,0x29452945,0x31663165,0x29252925,0x31662925,0x31452924,0x20e32924,0x20e320c3,0x29242924,0x20e32924,0x00000820,0x08001040,0x10001000,0x20a01880,0x31231840,0x08000000,0x00000800,0x08200000,0x08000000,0x08000800,0x10001020,0x18001000,0x49623900,
-0x51a85a48,0x7b6e6aec,0x6aec734d,0x4a491882,0x31861904,0x294541e8,0x73cf41e8,0x20c341e7,0x18a320c3,0x29042924,0x29042924,0x29243165,0x20e318a2,0x41e71081,0x20e320e4,0x41e72945,0x62ca39a6,0x732d732d,0x29053946,0x62ec3166,0x734e6b4e,0x734e630d,0x7bb07baf,0x6b0d6b2e,0x39263926,0x52096acc,0x31663966,0x318639a6,0x39c739a6,0x316539a6,0x39863145,0x31652924,
-0x398641c7,0x20c33165,0x31652923,0x31853165,0x20c22944,0x294320e3,0x29242943,0x29042903,0x21052925,0x29662926,0x10623146,0x316539c7,0x20c42924,0x20c320c3,0x10600800,0x20c220c2,0x188220c2,0x29042904,0x39872904,0x42093188,0x39a839a8,0x39c839a8,0x31a831c8,0x31a83188,0x39c939c8,0x31a939c9,0x31c83187,0x39c831c8,0x39c831a7,0x298739a7,0x29a731a8,0x29872967,
-0x31873187,0x29872966,0x29672986,0x29672987,0x31872987,0x296631a7,0x29662966,0x31872946,0x21262946,0x31873187,0x29672946,0x29662967,0x29472146,0x31452946,0x51e549e6,0x49c45206,0x312330e1,0x39643123,0x41e60800,0x10404a27,0x31673144,0x29252946,0x21052966,0x21251905,0x21053167,0x21052126,0x21262126,0x210520e5,0x21052125,0x210518e4,0x29462125,0x29462926,
-0x21252125,0x29252125,0x292520e4,0x29452925,0x29453186,0x29252925,0x29053145,0x29243145,0x29242925,0x29253166,0x29453145,0x31652945,0x29252945,0x31652925,0x20e33165,0x20e32903,0x20e318a2,0x292420e3,0x292420e3,0x08000000,0x08000000,0x10201860,0x08201061,0x28c11000,0x00000000,0x00000020,0x10000000,0x31440800,0x52482903,0x5a8a5a8a,0x49c449a5,0x41625184,
-0x3924c5b2,0x734d6aec,0x628a7bae,0x528a3945,0x39c741e8,0x62eb2925,0x52cb62eb,0x20e42925,0x31662924,0x31453165,0x31441041,0x21032924,0x18c220c3,0x18c32104,0x29252924,0x39a63165,0x29033165,0x41a76aec,0x31463105,0x630d2925,0x7bb073af,0x6b2d738f,0x734e736f,0x732e734e,0x310528c4,0x30e430e5,0x28e43146,0x31653186,0x29453186,0x39a63165,0x316539a7,0x31653986,
-0x39a63166,0x29253165,0x292320e2,0x21033185,0x20a220e3,0x20a120c2,0x20c228e2,0x20c320e3,0x41e818c3,0x29665aab,0x10622926,0x29453165,0x316641c7,0x18822903,0x18a10800,0x18811881,0x08001860,0x290520c4,0x31871882,0x31a831a8,0x39a83187,0x31a83188,0x29462967,0x31a83188,0x39c839c8,0x31a93188,0x31a839c8,0x39c839c8,0x39a839c8,0x29873187,0x298729a7,0x29663187,
-0x31a73187,0x39e831a7,0x29672987,0x29672987,0x29662946,0x39c831a7,0x29463167,0x29662966,0x29672946,0x31663187,0x294639a7,0x21462946,0x29272967,0x18812946,0x5a2541c5,0x41835226,0x41c53942,0x41a53164,0x52471040,0x28e14a06,0x39a81061,0x29463166,0x210518c4,0x294618e5,0x21052946,0x210518c4,0x21262106,0x21252105,0x21252125,0x296618c4,0x21252125,0x29662946,
-0x18c42946,0x29252105,0x31452925,0x31652925,0x29452945,0x29452925,0x29053145,0x29242925,0x29042925,0x31453145,0x20e42904,0x29452945,0x29252925,0x29242925,0x31453145,0x29032904,0x18822903,0x188118a2,0x18a220c2,0x08000000,0x08200800,0x10001000,0x08001000,0x10001821,0x00000000,0x396418a1,0x31433984,0x49a449e6,0x28a04163,0x28c13102,0x18002020,0x10001840,
-0x62ed3984,0x734d7b8e,0x39456b2d,0x39664987,0x316639a7,0x318639a6,0x318639c7,0x188220e3,0x314520c3,0x106120e3,0x29041882,0x106118a2,0x20e320c3,0x31653165,0x294520e4,0x188239a6,0x20c22103,0x31043986,0x29053125,0x736e3187,0x736e7bd0,0x736f6b4e,0x6b0d6b0d,0x524a6b0d,0x31053925,0x28a42063,0x314618a3,0x31652104,0x39a63165,0x39a639a7,0x39863186,0x29242924,
-0x316520e4,0x39a73166,0x20e32944,0x29233144,0x28e320e2,0x208120c2,0x18c22081,0x20c420c2,0x528b2925,0x528b5aab,0x4a095a8b,0x29453165,0x39862924,0x18822904,0x39852924,0x20a120c2,0x188228e2,0x18831884,0x29261883,0x39a831a8,0x39c831a8,0x31a839a8,0x31873187,0x29672988,0x316739c8,0x21272947,0x31a831c8,0x39a831a8,0x39c839c8,0x29a739c8,0x29872967,0x318731a8,
-0x29863187,0x31c83187,0x39e939e8,0x29673187,0x318731a8,0x29663166,0x29663166,0x31662966,0x29462946,0x31872946,0x31873187,0x31872967,0x21062146,0x00002967,0x5a255227,0x5a466287,0x31433922,0x39a53144,0x49e62903,0x18405227,0x31663965,0x31873167,0x29663187,0x21262126,0x21052105,0x212618e5,0x21052105,0x29462105,0x21052125,0x29662105,0x21252926,0x21052125,
-0x21052105,0x31662125,0x31453146,0x29453145,0x31663186,0x29252925,0x31253125,0x20e42925,0x29042925,0x29252925,0x21042925,0x29252924,0x31653165,0x29452945,0x29253145,0x20c32903,0x290320e3,0x20c320e3,0x000018a2,0x08000000,0x08000000,0x20a01020,0x18201000,0x41a428c1,0x18601860,0x00001040,0x00000000,0x00000000,0x00200000,0x08000800,0x00200000,0x10000000,
-0x7b8d3104,0x7b8e7b6d,0x312441a6,0x28e33145,0x31453965,0x18a341c7,0x20c33145,0x186220e3,0x316620e4,0x08202103,0x20e318a2,0x080020c2,0x29232903,0x29453145,0x632c4a6a,0x08203186,0x31650800,0x31453125,0x29462104,0x734e5a8b,0x6b2e7baf,0x7bb0736e,0x738f734e,0x31246aec,0x39863145,0x39a73986,0x31453145,0x39a62924,0x29453186,0x31663186,0x398639a6,0x29043165,
-0x20c33165,0x29241062,0x20e32903,0x20e320c3,0x20e33144,0x290320c2,0x290318a1,0x39663144,0x29043166,0x5aab4a29,0x632d5aec,0x42294a4a,0x29463167,0x20c33165,0x21032924,0x29442964,0x294420e3,0x29054a29,0x31662926,0x39c83187,0x41e941e8,0x39a841e9,0x31873188,0x29672967,0x31a82967,0x29673167,0x31a731a7,0x39c831c7,0x316739a7,0x31873187,0x21872987,0x29672146,
-0x29663187,0x4a6a31a7,0x39c739e8,0x318639c7,0x31872945,0x29462946,0x31872946,0x29662946,0x29672926,0x29662946,0x31873187,0x29673187,0x29262946,0x28c11862,0x5a475a67,0x52466288,0x29014184,0x39843984,0x394320a1,0x208049e5,0x31663985,0x31662945,0x29453166,0x21053187,0x210620e5,0x21062946,0x210520e5,0x20e420e5,0x18c42105,0x18e42925,0x21052125,0x18c42105,
-0x29462105,0x29452946,0x29252925,0x31662924,0x31653165,0x20e43145,0x29043145,0x29042904,0x31663145,0x29043165,0x31652925,0x29452945,0x31452924,0x31653145,0x20c22103,0x20c33144,0x290420c3,0x188120c2,0x00001081,0x10200000,0x28e21880,0x20613964,0x10201000,0x18200800,0x08000800,0x00000000,0x08000000,0x00000000,0x10200800,0x00000000,0x08000800,0x00000000,
-0x314528e4,0x41c741a6,0x28c33925,0x396520a2,0x31452904,0x18822904,0x18822904,0x28c318a3,0x39c720a3,0x104018a2,0x31443144,0x29033144,0x31853165,0x528a3186,0x632c630c,0x10c252aa,0x29442144,0x296518e3,0x39a72945,0x738f6b2d,0x736e7baf,0x734e6b2e,0x6b4e732e,0x20a341a7,0x41e72925,0x41c720c3,0x31653165,0x29453186,0x29253165,0x20e43166,0x31453986,0x20c33986,
-0x29042924,0x29041041,0x20e318a2,0x29243165,0x28e33144,0x210420c2,0x292320e3,0x39663144,0x29052925,0x526a20c4,0x6b4e5acc,0x630d630d,0x4a2a5acc,0x20e32104,0x210418a2,0x39a72925,0x31463166,0x31873187,0x21052946,0x31872125,0x420939c8,0x31a8524a,0x31a83187,0x31a731a8,0x31a83167,0x316741e9,0x31873187,0x39c831a7,0x39a739c8,0x31673987,0x21662987,0x31873187,
-0x4249422a,0x42294a6a,0x39c739c7,0x39a739e8,0x294639c7,0x31a73187,0x31a72946,0x29662946,0x31873167,0x31872946,0x31872966,0x29463167,0x29472926,0x28e10000,0x5a674a05,0x5a475a67,0x49c55a67,0x49e53142,0x52265a67,0x208041c4,0x39a741c6,0x29253166,0x29453166,0x29662146,0x21052126,0x29462105,0x29262106,0x20e42926,0x21052925,0x29252946,0x18e42125,0x210518c4,
-0x21052125,0x21042946,0x31452925,0x31453166,0x29042925,0x29242925,0x29242904,0x292520e4,0x31453145,0x29252925,0x29252925,0x29242925,0x20c33165,0x29243165,0x20e32904,0x20c320e3,0x18a21882,0x316420e3,0x20c20800,0x00000000,0x00200000,0x08000800,0x08001020,0x10001000,0x10001000,0x08000800,0x08200820,0x08000000,0x00000000,0x08000800,0x08000000,0x00000000,
-0x396528a3,0x52283966,0x10202904,0x39652903,0x28c418a1,0x39862904,0x18a22904,0x31c718a2,0x41c64208,0x20a30800,0x314539a6,0x29443185,0x41e72944,0x630c41e7,0x5acb630c,0x5acb528a,0x29663187,0x29651904,0x6b2e62ed,0x734e6b2e,0x7bb06b2d,0x732e734e,0x6b0c734e,0x20c33145,0x29453165,0x20c33145,0x31652924,0x314520e3,0x39a62924,0x398639a6,0x39861882,0x396620e4,
-0x18c42104,0x18621883,0x20e318a2,0x29232924,0x28e33144,0x29041881,0x29243145,0x20e32924,0x18a32905,0x39c82905,0x62ed524a,0x5aec62ed,0x5acc630d,0x42285aec,0x210418e3,0x31862105,0x318739a7,0x31673167,0x39c83187,0x318731a7,0x39a739c8,0x294641c8,0x21262946,0x39a83187,0x31672967,0x29672946,0x31863166,0x31863186,0x31873987,0x39873167,0x298731a8,0x21052146,
-0x31a72947,0x420831c7,0x39a741c8,0x39a739a7,0x318639a7,0x39a73186,0x31863186,0x29663187,0x31672946,0x31463167,0x31662925,0x29463166,0x21452966,0x41c40000,0x522662a8,0x5a675a26,0x5a875a47,0x312241a4,0x52266ac9,0x10005206,0x31863986,0x31663187,0x29252945,0x29462946,0x21052105,0x21052105,0x29262105,0x18e42105,0x210518a4,0x21052125,0x29052105,0x21042125,
-0x210518e4,0x210520e4,0x312520e4,0x31452925,0x31452904,0x31452903,0x29242944,0x31452924,0x31652904,0x29243145,0x29043145,0x31452904,0x31653145,0x29242924,0x29032924,0x31652944,0x41a63985,0x104020c2,0x00000000,0x00000000,0x00000000,0x08001041,0x08000000,0x10001000,0x182028e2,0x10201000,0x00000820,0x08000800,0x10000000,0x08000800,0x08000800,0x00000800,
-0x31453165,0x5aaa5aca,0x10412904,0x20a23985,0x28e31861,0x18a23144,0x20e320e3,0x29241881,0x10203144,0x398518a0,0x39a639a6,0x296439a6,0x39a63185,0x5aeb3186,0x630c6b4d,0x31874a49,0x18e43186,0x3a0918e5,0x738f630d,0x6b4e6b4e,0x730c6b4e,0x394562ab,0x41c75208,0x18822904,0x18a20820,0x18a218a2,0x31652924,0x29032924,0x39863144,0x31453145,0x20e441e7,0x18a32904,
-0x29253166,0x290420c4,0x20e32924,0x290320e3,0x29032924,0x29040800,0x20e32904,0x210420e3,0x18a320e4,0x210520e4,0x5acc5aac,0x632d630d,0x632d632d,0x5acc5acc,0x31865acc,0x39872945,0x39c739a7,0x31673167,0x29663187,0x318731a7,0x31863187,0x31a839a7,0x29462946,0x31882946,0x29263167,0x29462926,0x31663166,0x29253987,0x31873186,0x31473187,0x29662946,0x29462946,
-0x29871906,0x39c82165,0x398741c8,0x420839a7,0x39c739a7,0x39a739a7,0x31863186,0x29662946,0x29662966,0x318739a8,0x29462946,0x29462925,0x21252946,0x41c40000,0x62a85205,0x62876287,0x5a475a67,0x52265226,0x520662a8,0x20816ac9,0x318639a6,0x31463146,0x29252925,0x31672105,0x18a42946,0x18a42126,0x20e520e5,0x18e42105,0x21052105,0x21052946,0x210520e5,0x21042966,
-0x212520e4,0x29252105,0x31452925,0x29243145,0x39852925,0x31654a48,0x31452924,0x29443145,0x31852924,0x31453145,0x29253145,0x31442904,0x29043145,0x83ef41e7,0x39856b0c,0x28c228e3,0x28e21860,0x10200800,0x00000000,0x00000000,0x00000000,0x10200820,0x18001000,0x18401000,0x18401840,0x08001000,0x08200000,0x08001841,0x20820000,0x08000800,0x10001000,0x00000800,
-0x316518a2,0x39a62924,0x290320c2,0x18a22924,0x31443124,0x29242923,0x290420e3,0x41642903,0x18601000,0x31443143,0x39653985,0x292439a5,0x39a62903,0x632c18c2,0x2925632c,0x20c31042,0x422962cb,0x630d52ac,0x736f738f,0x5a8b736f,0x49a75229,0x30c33946,0x20e338c3,0x18a218a2,0x21031081,0x20e320e3,0x29243145,0x29043124,0x314420a2,0x29243165,0x29053165,0x18c33186,
-0x31662125,0x39a720e4,0x20e33165,0x29242945,0x18a220c2,0x290420e3,0x20c328e4,0x18c320e3,0x31662945,0x29462966,0x5acc39a8,0x62ed5aab,0x5aec6b2e,0x5aec5acc,0x62cc5aac,0x31673167,0x41e839a7,0x18c43146,0x31873166,0x316739a8,0x39a839c8,0x316739c8,0x31a831a8,0x31a82987,0x31a831a7,0x29672967,0x290539a7,0x31663966,0x31863166,0x31663166,0x29462966,0x29672946,
-0x21462967,0x39c82988,0x420841e8,0x39c74208,0x41e839c7,0x41e83186,0x31653165,0x29463146,0x29262926,0x31663166,0x31663166,0x20e43166,0x20e42105,0x49c418a0,0x52054163,0x5a465a66,0x6aa86287,0x5a465a46,0x62675a47,0x18405205,0x318639a5,0x31863166,0x31462105,0x21052125,0x18e42966,0x210518c4,0x21052105,0x20e418e4,0x21052105,0x21252105,0x21052125,0x21252946,
-0x20e420e4,0x29242104,0x28e42945,0x31463145,0x49e73145,0x41a549e6,0x314541e6,0x31452924,0x31653145,0x29443145,0x31243145,0x31243965,0x41c73986,0x29242924,0x20c22903,0x28c228c2,0x312228c1,0x080020a0,0x00000000,0x00000000,0x10001020,0x20a01840,0x10001000,0x18402060,0x20a020c0,0x08001020,0x08200800,0x00000800,0x00000000,0x31240800,0x10200800,0x00000800,
-0x29242903,0x18c22924,0x20c22923,0x292420c2,0x18813965,0x210320a1,0x29242944,0x28c13164,0x31021840,0x31643144,0x29033144,0x292420e2,0x39a618a1,0x6b4c18a1,0x082139a6,0x31466b0c,0x630d62cc,0x632e632e,0x6b4f7bd0,0x6b0d6b4f,0x28c43105,0x208228a3,0x20e31841,0x20c220e3,0x21032103,0x39853145,0x39853165,0x398641a6,0x31642904,0x31443165,0x39663985,0x21452945,
-0x29452104,0x29452945,0x20e33165,0x20e32104,0x106118a2,0x290420e3,0x18a220e4,0x29453165,0x31662946,0x31a72946,0x5aac2925,0x62cc6b2e,0x528b5a8b,0x62ed5aec,0x62ec5acc,0x39874a09,0x39a73186,0x31673167,0x39a73146,0x31873187,0x420939c8,0x398839a8,0x298731a8,0x29672967,0x31a831c8,0x21462146,0x39862925,0x31663146,0x31862946,0x29663166,0x29662946,0x21463187,
-0x29462146,0x29462167,0x39c739e8,0x31863186,0x39c739a7,0x41e739c7,0x31653186,0x31663167,0x29463146,0x39863166,0x316639a7,0x21053166,0x20e420e4,0x49c43984,0x49e56267,0x522549e4,0x62675a46,0x62676287,0x62675a67,0x20a16287,0x39c741c6,0x31663166,0x21053166,0x29462105,0x21252125,0x18c418e4,0x29262125,0x210520e5,0x20e520e5,0x210520e4,0x21052105,0x18e42105,
-0x20e418a3,0x29452925,0x31452945,0x29043145,0x5a883144,0x52276b0a,0x314539c5,0x316520e3,0x31442924,0x29243165,0x29043145,0x31242904,0x210328e3,0x20e32103,0x29033144,0x28e228e3,0x18603102,0x106020a0,0x08000000,0x08200800,0x08001000,0x10000800,0x10001000,0x28a12060,0x10002080,0x00001000,0x00000000,0x08000800,0x00000800,0x08000800,0x08000800,0x00000800,
-0x29042924,0x20e32924,0x28e328e3,0x31443124,0x10203164,0x29023123,0x316420e2,0x20802922,0x31231840,0x292328e2,0x20c22903,0x316420e3,0x39853185,0x28e320e2,0x20c41861,0x62cd5aab,0x6b6f732f,0x73b06b8f,0x738f738f,0x6b2e736f,0x30e43105,0x28e32062,0x20c31020,0x20e32903,0x20e318c2,0x29043165,0x39a63165,0x39863145,0x39a53145,0x398539a5,0x29043986,0x21253187,
-0x31462125,0x31863166,0x18c339a7,0x29043165,0x18a22103,0x290420e3,0x18a218a3,0x316518a2,0x39a739a7,0x31872946,0x524a2946,0x6b0d62cc,0x632d5a8b,0x5aec52ab,0x7b8f62ec,0x316739a8,0x31872945,0x39a839a7,0x398739a7,0x31873987,0x41c83987,0x39883987,0x31a739c8,0x29673187,0x296731c8,0x296731a8,0x4a093146,0x31863987,0x29453186,0x21053166,0x31872966,0x296731a8,
-0x29462967,0x21261926,0x31a739c7,0x39873186,0x39a73987,0x420839a7,0x420841e7,0x31663167,0x29463167,0x41c73166,0x318641e8,0x21052946,0x10622105,0x41843984,0x5a467309,0x5a255a25,0x62875a26,0x52066287,0x6aa85a67,0x10203101,0x39a72903,0x29452945,0x29252926,0x29462925,0x210518e4,0x212518e4,0x10832125,0x20e42105,0x29252905,0x29462105,0x18c418e4,0x294618c4,
-0x292520e4,0x21042905,0x29252924,0x290320e3,0x4a055a88,0x6b2a62c8,0x292441e6,0x29242924,0x31442924,0x31653165,0x522862cb,0x28e33124,0x31442904,0x31443144,0x31243124,0x39433924,0x102028c1,0x186020a0,0x10000000,0x08001020,0x18201000,0x20c01860,0x20412061,0x18401840,0x186028c1,0x00001000,0x00000000,0x10000800,0x10000800,0x10200800,0x08000800,0x00000800,
-0x20e220e2,0x31453144,0x31652924,0x20c21881,0x20c220a1,0x29232923,0x20a12903,0x20c21860,0x31443964,0x29033143,0x31442924,0x39a63165,0x20e239a6,0x18812903,0x29031040,0x4a2a4a08,0x6b4e6b4e,0x7bb06b4e,0x7b906b4e,0x732e7bb0,0x31043125,0x186128a3,0x08201040,0x290320c2,0x29453165,0x18c22944,0x31653165,0x20c228e3,0x39653124,0x31443144,0x31253966,0x19043186,
-0x21042945,0x29453166,0x31863146,0x31452925,0x292541c7,0x21043165,0x318639a6,0x318618c3,0x39a73166,0x31863166,0x41c83166,0x630d6b0d,0x630d6b2d,0x6b4e62ec,0x62cd6b2d,0x29464a4a,0x39a73166,0x31863187,0x31863166,0x41e839a7,0x39a839a7,0x39c841c8,0x39e831a7,0x296731c8,0x298731a8,0x21262987,0x29262906,0x41e82965,0x31662925,0x29463166,0x29662946,0x29462946,
-0x29672967,0x21262126,0x31a72147,0x39a739c7,0x31863186,0x39a639a7,0x39a741c7,0x31663987,0x29463166,0x31453125,0x29453166,0x21252104,0x000020e4,0x416320e2,0x6ac86267,0x5a466287,0x62a75a46,0x5a6662a7,0x62665a46,0x186030c0,0x316620e2,0x31253165,0x29052926,0x21252105,0x210518e4,0x10a32925,0x20e42105,0x21052125,0x21052105,0x212518c4,0x210520e5,0x21052926,
-0x290520e4,0x21042925,0x29242905,0x392520e4,0x6ac85a66,0x6b2b5a87,0x20e339a6,0x29242924,0x28e33124,0x39653124,0x83ce6b0a,0x292441a6,0x31443965,0x39653965,0x28e23165,0x28c128c1,0x102028e2,0x184020a1,0x10400000,0x08001040,0x10000800,0x10001000,0x18202061,0x28a11820,0x08001000,0x08000820,0x08000000,0x20210800,0x18001000,0x10001000,0x08000800,0x00000800,
-0x20e32924,0x31443145,0x398662ca,0x20a12923,0x31441020,0x28e23164,0x29022903,0x28e23164,0x39643144,0x39853985,0x31853164,0x39c639a6,0x39a639c6,0x29033124,0x39a63965,0x20e53166,0x6b0d5aac,0x736f734f,0x7b90734f,0x734e734f,0x20825209,0x314428c3,0x20c220e3,0x18a21881,0x29241082,0x21032924,0x31653986,0x396520a2,0x20c22903,0x206128e3,0x28e428a3,0x29452925,
-0x21043186,0x294639a7,0x31463166,0x20c32925,0x29453145,0x31863186,0x528a5aaa,0x294539a6,0x31663166,0x31863186,0x29253145,0x6b0d524a,0x630d6b4e,0x738f5acc,0x62ed6b4e,0x3147630d,0x39a720e4,0x39a73166,0x39a73187,0x318739c7,0x39a73187,0x41c839a7,0x298631a7,0x31a839e9,0x31a731a8,0x21462967,0x21462146,0x292518e3,0x31863186,0x29463166,0x29462966,0x29462946,
-0x214631a7,0x21472147,0x31a72967,0x39a73186,0x39c73166,0x41c739a7,0x398639a7,0x39663966,0x29252945,0x31463146,0x29453146,0x18c42925,0x00002125,0x51e53143,0x6aa85205,0x5a266267,0x5a665a26,0x6aa76287,0x5a266287,0x20803901,0x31453985,0x29042925,0x20e52105,0x21052946,0x210518e4,0x294618c4,0x21252105,0x18e418a4,0x29462105,0x18e418e4,0x18a32925,0x210520e4,
-0x21042104,0x210418a3,0x29042925,0x30e32904,0x83cd49c4,0x42277bac,0x20e32924,0x29242904,0x29042904,0x312528e3,0x31442903,0x39653986,0x39853965,0x31443985,0x31423123,0x28c01860,0x18401840,0x10001840,0x18200800,0x08001840,0x18411020,0x20810800,0x10001840,0x18202080,0x10001000,0x00000820,0x10200820,0x18000800,0x10000000,0x10001820,0x08000800,0x00000800,
-0x20e320c2,0x31652924,0x4a694a28,0x29031060,0x31642923,0x28e22923,0x290220c1,0x31642903,0x39c53164,0x39a63965,0x398641c7,0x398639a6,0x314539a6,0x39852904,0x39c62924,0x29053165,0x632e3146,0x630d632e,0x62ed7bb0,0x62cc736f,0x28c35208,0x20c230e3,0x108118a2,0x29241081,0x294420e3,0x296539c7,0x31452925,0x20c32904,0x20e220c3,0x18411861,0x20e42081,0x31653986,
-0x31863186,0x31453966,0x31463146,0x292420e4,0x29043145,0x42082924,0x41c84a49,0x31463986,0x31662904,0x31463166,0x39873146,0x522928e4,0x62ac62ab,0x62cc62ed,0x62ec630d,0x39c85a8b,0x29242946,0x39a73166,0x31863187,0x31252925,0x292520e4,0x316628e4,0x39873987,0x31a731a7,0x214631a8,0x29662987,0x21262987,0x29252126,0x31462125,0x29253146,0x29263166,0x29252946,
-0x294631a7,0x19252126,0x29662146,0x39a739a7,0x39c739a7,0x398639c7,0x398641a7,0x39663986,0x31663165,0x31252905,0x21053146,0x18e42925,0x10800000,0x5a2620c1,0x62676287,0x62675206,0x5a465a46,0x5a675a46,0x62876267,0x20a041a4,0x29253165,0x29252925,0x29252925,0x18e41905,0x18e410a3,0x18c42946,0x20e52105,0x20e42105,0x18c42905,0x18a420e5,0x18c420e5,0x20e420e4,
-0x21042925,0x29052104,0x20e42105,0x31253166,0x292428e3,0x31453144,0x31442924,0x29242924,0x31653145,0x29042924,0x31242904,0x31243144,0x39853985,0x314439a6,0x29013144,0x186028c1,0x31222901,0x10201840,0x18601860,0x10000800,0x10001860,0x10001840,0x20602060,0x18811840,0x08000800,0x08000000,0x00000800,0x08000000,0x08000800,0x00000000,0x00001020,0x00000000,
-0x39853144,0x29043145,0x31853165,0x20e320e3,0x21433165,0x29432943,0x20e22923,0x29032102,0x31443184,0x39853144,0x39a639a6,0x398520c3,0x31653165,0x29243165,0x21032923,0x20e420e3,0x632e3146,0x736f6b4e,0x62ed7bb0,0x3946732e,0x392428a3,0x18811861,0x18c21881,0x21032104,0x39a73186,0x62ec630d,0x29464229,0x29452966,0x29242125,0x20e32104,0x292441c6,0x31662924,
-0x20e32944,0x28e43145,0x31462925,0x39853145,0x20c320e3,0x29452904,0x29253165,0x31463145,0x31663145,0x39a73987,0x39a73146,0x18623166,0x628b20c4,0x62ec62ec,0x5acc630d,0x5aac5acc,0x29243987,0x31663166,0x31663187,0x31253146,0x29053146,0x29252905,0x31672946,0x31673187,0x296731a7,0x29672967,0x21462967,0x296610c4,0x20e52925,0x29252905,0x29253146,0x29262946,
-0x29672967,0x21262146,0x10e41905,0x31863166,0x39a739a7,0x31453165,0x396641a7,0x41863966,0x31653165,0x29053966,0x29453125,0x21252925,0x21030000,0x49e54a26,0x52265a46,0x5a4651e5,0x5a266287,0x49a45205,0x49835226,0x314349e5,0x29252924,0x18a32104,0x29252905,0x19042125,0x10c41904,0x210518e4,0x20c418c4,0x20e518c4,0x21052105,0x20e420c4,0x18e420e4,0x210418c3,
-0x18c32925,0x21042905,0x210420c4,0x28e420e4,0x290328e3,0x29242904,0x20e32924,0x29242924,0x20c32924,0x29043144,0x31643124,0x31443124,0x41a63985,0x31243965,0x18a020c2,0x18601840,0x186028c0,0x18401840,0x186020a0,0x29021000,0x10201020,0x18401000,0x28a02060,0x10002060,0x00000800,0x08000020,0x08000800,0x00000800,0x00000000,0x00000820,0x08000000,0x00000800,
-0x41c63165,0x39a54a27,0x29252923,0x316518a2,0x29853a07,0x21032124,0x29442944,0x29242944,0x31252904,0x41e75248,0x29043145,0x39c73165,0x41e741e8,0x18a241e7,0x29450000,0x21052104,0x62ec2946,0x632e6b4e,0x6b2e6b2e,0x41e96b0e,0x28e318c4,0x18611860,0x080020c2,0x18c42104,0x5aec4a4a,0x6b2e5aec,0x2105630d,0x296718e5,0x21252146,0x21252125,0x39a63165,0x20e32903,
-0x292420c3,0x20c32904,0x3126526a,0x290428e5,0x20c328e3,0x290420c3,0x29042925,0x292520c3,0x39863185,0x39a63986,0x31452925,0x29243165,0x20e418a3,0x6b2e62cb,0x5acc5a8b,0x5aac5aab,0x31a7422a,0x29253186,0x29463167,0x21052926,0x29052925,0x29052904,0x31253125,0x29462905,0x29462946,0x29862986,0x21052126,0x29462946,0x21252946,0x18a318e4,0x29462926,0x21252946,
-0x31c72125,0x19252145,0x29662166,0x29452125,0x39863987,0x31653166,0x39863986,0x31453145,0x29253166,0x29053145,0x210528e5,0x10a220e3,0x31830881,0x52055aa7,0x52055a26,0x52055a26,0x62676287,0x5a0551e5,0x20604143,0x31441020,0x20c43165,0x31452905,0x21042925,0x18e42945,0x10a32105,0x210518c4,0x20e518e4,0x20e52925,0x20e42925,0x18a420c4,0x18c42105,0x18e418c3,
-0x212518e4,0x20e418e4,0x212518e4,0x29042905,0x20e32904,0x28e420e3,0x29242903,0x39852103,0x29242924,0x290420e3,0x290420e3,0x31853965,0x31653164,0x20e32923,0x18a01020,0x10401860,0x08001860,0x18601000,0x18202080,0x10001000,0x20611000,0x208030e1,0x18201820,0x08001020,0x00000000,0x00000000,0x10200000,0x08001020,0x08000800,0x00000800,0x10000800,0x00000020,
-0x316541e6,0x398541c6,0x29043164,0x528a3987,0x5aec630d,0x39e731a7,0x4a6939e7,0x528b52ab,0x39a7526a,0x398641e7,0x39a63986,0x39a639c7,0x39a639c7,0x080020e3,0x29243145,0x18c42103,0x62ec2105,0x630d632e,0x734f734f,0x630d6b2e,0x10412926,0x186120a2,0x10402903,0x29662104,0x632d630d,0x6b4e630d,0x5acc632e,0x52cc4a8b,0x39c852cc,0x39c8526b,0x20e318a2,0x29242924,
-0x39a63145,0x18823124,0x3986528a,0x31243945,0x20a228e3,0x28e428e3,0x20c32904,0x31452904,0x39852924,0x39a739a7,0x31663166,0x39863145,0x20e42925,0x630d3986,0x62ec62cc,0x5acc62ec,0x5acb5aed,0x31862946,0x39a83187,0x31463187,0x29252926,0x31463145,0x31252925,0x29263146,0x31873166,0x29872966,0x21462987,0x21252146,0x21252946,0x18a318e4,0x18c418c4,0x21052946,
-0x21661925,0x29662125,0x21052125,0x18e42125,0x31652925,0x39863145,0x31653986,0x31253966,0x39863986,0x28e53165,0x18c42926,0x08202104,0x4a062943,0x522662e9,0x520551e5,0x62875205,0x62676267,0x5a265a26,0x28c228a0,0x31452922,0x20e43125,0x28e42904,0x29252946,0x18e42105,0x18c418c4,0x210518a3,0x20e42105,0x18c420c4,0x20c42925,0x20c420e4,0x212510a3,0x210418e4,
-0x10a318c3,0x18a318e4,0x18e418e4,0x29042905,0x20e42904,0x20e420c3,0x29032924,0x39862924,0x29042904,0x29042924,0x31452924,0x210328e3,0x20e32903,0x21032103,0x20c11040,0x20e11880,0x10001840,0x18201841,0x10001840,0x10002081,0x182028a2,0x20602060,0x08001860,0x08001000,0x00000000,0x08200000,0x10000800,0x08002082,0x08000800,0x08000800,0x08001020,0x08000800,
-0x316518a2,0x316428e2,0x528b39c6,0x62ec62ec,0x632d62cc,0x528b630d,0x52ab528b,0x84116b2e,0x6b4e8411,0x2123526a,0x18823985,0x4a2841e7,0x10622945,0x21042104,0x29032104,0x18e418a2,0x5acc3187,0x7bd06b4e,0x62ed8411,0x62ed62ed,0x210562cd,0x18c11082,0x00201060,0x318618c3,0x5acc62ec,0x630d6b4e,0x5aed5acc,0x62ed632e,0x6b6f6b4e,0x62cd7bd0,0x18a22925,0x20e318a2,
-0x292420c3,0x28c33165,0x310328e3,0x39242082,0x28e44185,0x31452904,0x31443986,0x290320c3,0x31243124,0x39863145,0x29243145,0x29453145,0x21042925,0x31662125,0x5a8b62ec,0x62cc62ec,0x62cc5aac,0x31455a8a,0x39a739a6,0x31673167,0x31862946,0x31253146,0x29253146,0x31662966,0x29462946,0x29462966,0x21262146,0x21252125,0x21252965,0x19042125,0x21251925,0x19052146,
-0x21662145,0x21471905,0x29862146,0x18e42166,0x29452145,0x31453165,0x31253166,0x31443145,0x31663166,0x29253145,0x28e428e5,0x29222082,0x41a42922,0x52266267,0x628751e5,0x5a465205,0x62a86aa8,0x39226a68,0x20a11040,0x20e43185,0x20c42925,0x31662905,0x210420e4,0x210518c4,0x18c418a3,0x18c42946,0x18e418c4,0x210518c4,0x18a42105,0x18c418a3,0x18c420e4,0x10830862,
-0x20e51063,0x212520c4,0x18a318c3,0x18c320e4,0x108218c4,0x210520e4,0x29042904,0x29242904,0x20e33144,0x290320e3,0x29042924,0x29232904,0x20c22924,0x21022923,0x102018a0,0x10610820,0x00000860,0x18200801,0x20601840,0x18401820,0x28a11820,0x10001000,0x10000800,0x08001041,0x00000000,0x08200000,0x18210800,0x00000000,0x18820000,0x18201020,0x10000000,0x18810800,
-0x316518a2,0x290328e2,0x6b2d62eb,0x6b0d630c,0x632d62ec,0x6b2d5aec,0x31a739c8,0x73af528b,0x7bb08c52,0x3186630d,0x104128e3,0x18c32925,0x29452904,0x18c32924,0x20c32924,0x294618a3,0x6b6e5acc,0x8c528411,0x7bb08c32,0x6b0e5acc,0x5aab630d,0x10813165,0x210318a1,0x296618e3,0x630d630d,0x632e6b4e,0x62ed630d,0x630d5acc,0x738f738f,0x6b0e734f,0x29242945,0x10612903,
-0x29241040,0x28c32924,0x18611000,0x28e328c2,0x28e33944,0x31452903,0x29243145,0x290420e3,0x20a220c3,0x31453124,0x31453145,0x29253165,0x42082105,0x41e83187,0x62ec5aab,0x5acc62cc,0x5a8b5aab,0x2904526a,0x39a73145,0x31873167,0x21453187,0x314639a7,0x39873166,0x29663187,0x21252946,0x29462925,0x21462966,0x21052966,0x31862145,0x21052945,0x212418e3,0x21462926,
-0x19052146,0x29862965,0x630b39c7,0x630b4207,0x21043165,0x39662945,0x398639a6,0x29442924,0x29043145,0x29253145,0x20a320c5,0x292228e2,0x418341c5,0x52053963,0x5a265205,0x62675a46,0x72e96288,0x28a172c9,0x20e220a0,0x29252964,0x290418a3,0x29052905,0x21042104,0x18c418e4,0x18a32105,0x086210a3,0x18c420e4,0x21052105,0x20e420e5,0x20e51883,0x210518c4,0x18a418a4,
-0x18c41883,0x18c32925,0x108218c3,0x20e418a3,0x18c320c4,0x108320e4,0x20e428e4,0x18822903,0x29242924,0x29242924,0x39853165,0x29032904,0x20e220e3,0x18a02902,0x102020e0,0x00000820,0x08000000,0x20611840,0x18202080,0x10002080,0x20802060,0x10002080,0x186028c0,0x08200800,0x00000000,0x10200000,0x08001000,0x10200800,0x08400000,0x28a11020,0x10000800,0x00000000,
-0x31852903,0x29043124,0x5acb4a68,0x6b4d6b0d,0x630d6b2d,0x632d5aec,0x4a4a630d,0x6b4e526b,0x738f7bd0,0x41c86b2e,0x20830801,0x6b2c528a,0x5aab62eb,0x420841e7,0x318641e8,0x31a731a7,0x738f630d,0x8c5383f1,0x83f18c32,0x5aac6b0e,0x630d5acc,0x18824a49,0x21232924,0x422918e4,0x630d630d,0x6b2e6b2e,0x62ed5aed,0x528b5aed,0x6b0e5acd,0x6b2e6b0e,0x29245acc,0x20c32903,
-0x18a21061,0x186120c3,0x30e32082,0x31033124,0x20a12081,0x316528e2,0x292428e4,0x290420c3,0x28e31861,0x20a220c3,0x31662904,0x42092904,0x5acb5aab,0x5aac5acb,0x5aab5aac,0x5aab4a4a,0x62ed5aab,0x290441e8,0x31253145,0x316728e5,0x31863166,0x39873966,0x31463125,0x29462105,0x21052946,0x29262125,0x29462126,0x21252146,0x29452144,0x29052946,0x6b4b3185,0x5aea5ae9,
-0x42274227,0x4a465267,0x62a75287,0x62e87329,0x39a741c6,0x31652945,0x29252925,0x29243144,0x29253166,0x20c42924,0x082020c5,0x314341a4,0x41834a05,0x6aa851e5,0x5a2649e5,0x51e55a26,0x628751e5,0x20606267,0x316328e1,0x20c42964,0x29052104,0x20e420e4,0x29252905,0x18e418c4,0x18c418c4,0x086218c4,0x10a318c4,0x18e42105,0x18c418c4,0x18a32105,0x20e518c4,0x108318e4,
-0x210518a4,0x21041883,0x20e418e4,0x18c320e4,0x20e420e4,0x20c420c4,0x290420e4,0x29043165,0x29042924,0x29043165,0x29242924,0x29232903,0x18a020e2,0x08600820,0x102018a0,0x08000000,0x18610000,0x20402060,0x18202080,0x288128a0,0x10001840,0x10001840,0x10200800,0x08001880,0x00000000,0x10000000,0x08201800,0x10001000,0x00200000,0x39232081,0x00001020,0x00000000,
-0x29442124,0x18c33165,0x41c62924,0x630d630d,0x62ec62cc,0x734e62cc,0x62cc738f,0x6b2e6b2e,0x6b4e6b4e,0x630d738f,0x630d5acc,0x62ec5aec,0x6b6e630c,0x5acb630c,0x52aa5acb,0x5acc5aab,0x630d5aec,0x947283f1,0x736f83d1,0x62cc630d,0x5aac5aac,0x21252905,0x29872925,0x5aec4229,0x6b6e5aec,0x734f5aac,0x62ed62ed,0x736f5aed,0x630d6b2e,0x6b4f6b0e,0x08015acb,0x28e30800,
-0x000018a2,0x08001000,0x29042925,0x31442903,0x28c21861,0x20a228c2,0x20a22904,0x290420c3,0x20a220a2,0x20c320c3,0x292520a3,0x52aa2925,0x52ab632c,0x5acc736f,0x5aab630d,0x62ec5aac,0x5a6b528a,0x31453986,0x31452904,0x29462925,0x29462926,0x31463167,0x39673146,0x29663146,0x29462947,0x29672946,0x29463187,0x19252946,0x29452125,0x62ca2103,0x62a662c8,0x73087b49,
-0x6b086b08,0x6ae86b08,0x62a76ae8,0x6ac77308,0x4a265a87,0x314520e3,0x31653165,0x29053125,0x31452925,0x20c42905,0x080020a4,0x62883963,0x41a45206,0x51e56287,0x51e551e5,0x41a44a05,0x52065225,0x18404163,0x396520a0,0x20c42925,0x20e420c4,0x21042925,0x20e420e4,0x18e418e4,0x10c41905,0x18c418c4,0x108318c4,0x18a42125,0x18e418c4,0x18c418c4,0x18c418c4,0x18a420c4,
-0x20c418c4,0x18a318a3,0x18a318c4,0x21042105,0x290520e4,0x20c418a3,0x21042104,0x20c320c3,0x29242904,0x29242903,0x29032924,0x20c22903,0x28e120a1,0x10401880,0x10601040,0x10200800,0x18201800,0x18402081,0x28a01000,0x18203942,0x28c12060,0x18401000,0x20812080,0x08001880,0x00000000,0x18600000,0x08001820,0x18000800,0x00200800,0x10200800,0x00000000,0x08000000,
-0x21032103,0x29243186,0x316539a6,0x6b2e5aac,0x62cc6b2e,0x6b2d5aac,0x62ec736e,0x6b4e736f,0x83f07bd0,0x7bb07baf,0x630d6b2d,0x4209632e,0x296631a8,0x29662966,0x4a4831a7,0x6b4e5aab,0x738f6b2d,0x83f07bb0,0x6b2e736f,0x5a8b6b4e,0x31675a8b,0x29452926,0x52ab31a7,0x5aec5aec,0x6b2e630d,0x736f630d,0x62cd5a8c,0x630d630e,0x6b0e630d,0x62cd736f,0x20a33146,0x28e20000,
-0x20e32924,0x18822945,0x290318a3,0x290339a5,0x31033124,0x20c31860,0x20a21041,0x28e320a2,0x20c320a2,0x28e320a2,0x290420e4,0x4a082925,0x528b5a8a,0x5acd5acc,0x5aac5acc,0x6b0d5acc,0x49e86b2d,0x31453145,0x29243966,0x29263145,0x21052105,0x29262925,0x31463146,0x29662905,0x29462926,0x29462946,0x21262946,0x19052967,0x39a52925,0x5a865287,0x6aa65a66,0x6ac77308,
-0x6ac772e8,0x62a76b08,0x62865a66,0x628662a7,0x4a056ae8,0x20e320c2,0x31453145,0x31252925,0x20c43125,0x20c42905,0x186020c4,0x28e120c0,0x41634184,0x520651e5,0x49c549c5,0x418449e5,0x51e54a05,0x20802040,0x396520a1,0x20e42925,0x29052905,0x29252104,0x20e42105,0x18a31083,0x20e520e4,0x292618c4,0x18c420e4,0x18c410a3,0x108318e4,0x18c41083,0x10a318c4,0x18830821,
-0x106318a3,0x20e518c4,0x18c320e4,0x18a318a3,0x18c318c3,0x20c420e4,0x18c32104,0x292420c3,0x29032903,0x20e320e3,0x292420c3,0x20c120e3,0x20e020e1,0x10203123,0x18811040,0x08000800,0x18401000,0x18001000,0x18401840,0x28c01840,0x18401820,0x20803102,0x102020a0,0x08001860,0x08000800,0x20a10800,0x00002081,0x10000800,0x10411020,0x00000000,0x00000000,0x00000000,
-0x292418c3,0x294520e3,0x39c72964,0x6b4e62cc,0x5aac6b2d,0x526a3987,0x6b4c6b0c,0x734e6b2d,0x7b6f83b0,0x7b8f7baf,0x6b4e734e,0x4a6b6b2e,0x29674a2a,0x212518e5,0x210518e4,0x5a8b2105,0x738f630d,0x734e630d,0x62cd62cd,0x62cc6b0d,0x4a29526a,0x18c420e4,0x52ab2946,0x630d5aac,0x6b2e62ed,0x6b2e62ed,0x62cd5acc,0x5aac6b4e,0x734f62cd,0x6aed6b2e,0x20e42063,0x08000000,
-0x29242903,0x20e42904,0x29242924,0x31652925,0x28c23165,0x20c228e3,0x314528e3,0x20c320e3,0x20a220c2,0x18a218a1,0x20c320c3,0x29042903,0x5aac526a,0x6b0e528b,0x526b5aac,0x62ed62ec,0x39875a4a,0x31453145,0x29042925,0x18c43125,0x294620e4,0x31462946,0x31462926,0x31663166,0x29462946,0x21461905,0x29662946,0x21452146,0x39e54a27,0x62a85a87,0x72a76ac7,0x72e87b08,
-0x72e872c7,0x62866aa7,0x73085a45,0x6ac76aa7,0x5a666b08,0x20c43142,0x290428e4,0x29452945,0x20e42925,0x18a32105,0x10202105,0x28c020c0,0x51e53942,0x5a265205,0x49c551e5,0x520649e5,0x49e549e5,0x28e21840,0x314528c1,0x20e420c4,0x212520e4,0x21042125,0x18c32104,0x20e41062,0x20a41883,0x20e418c4,0x21042925,0x18c418e3,0x20e52105,0x18e418e4,0x19051925,0x20e520c4,
-0x20e520c4,0x18c41883,0x20c418a3,0x20c418a3,0x290418c4,0x290428e4,0x210418c4,0x210418c3,0x20e32924,0x20e32904,0x292418a2,0x20e220c2,0x104020c1,0x104018a1,0x080020a0,0x18610800,0x10201840,0x10001860,0x20801840,0x20c028c0,0x10001860,0x20803943,0x100020a0,0x08001000,0x10001000,0x08001000,0x10202040,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,
-0x21042104,0x39e72103,0x5acb39a6,0x738f7bb0,0x6b0d736e,0x20625a6b,0x41863944,0x62cc5a49,0x7b6e83af,0x734e7b8f,0x6b2d6b2e,0x630d6b2e,0x31a8630d,0x210520e5,0x106318c4,0x31672905,0x6b2e62cc,0x6b2d734e,0x62ac62ed,0x62cc5a8b,0x5aab62cc,0x18a341c8,0x5acc39c8,0x5aec5acc,0x5acc6b4e,0x6b2e736f,0x62cd6b4e,0x5acc5aac,0x62ed630d,0x6b0e6b0e,0x20c320c4,0x18c218a2,
-0x294520c2,0x29452945,0x31653165,0x31863165,0x28e33186,0x104020c2,0x20e320c2,0x20c22924,0x18611881,0x292420a2,0x18822903,0x29042903,0x526b2904,0x62ed5a8b,0x62ec6b0e,0x4a29528b,0x28e43946,0x31252904,0x31663145,0x21043145,0x292518c3,0x31463167,0x29053126,0x31662926,0x29672967,0x21462966,0x19042105,0x31862145,0x4a264a26,0x6ae96287,0x624572c7,0x6a876ac7,
-0x6aa76aa7,0x62867308,0x6ac762a7,0x6aa76ae8,0x6ac883ab,0x41e64a26,0x20c318a2,0x210420e4,0x210520e4,0x20c420e5,0x080018c4,0x31221860,0x5a6728a0,0x51e549c4,0x49c54184,0x522649e5,0x522649e5,0x100020a1,0x292428c1,0x292528e5,0x18e418c3,0x210418c3,0x18e418e4,0x106320e5,0x20c420c4,0x292520e4,0x210420e4,0x18e42945,0x18c41083,0x18c418c4,0x210518c4,0x20e418c4,
-0x20c41883,0x20e41883,0x108220e4,0x18c320e4,0x20e418c3,0x20e318a3,0x21042104,0x18c318c3,0x20c320c3,0x29043145,0x290320c2,0x20c12903,0x188020e2,0x18801060,0x00001020,0x10000800,0x10000800,0x10000800,0x20a11000,0x10002080,0x28e01860,0x10002081,0x10001860,0x10000800,0x08000800,0x08000800,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x21052905,0x29452924,0x630d4208,0x736f83f0,0x632d734f,0x18005269,0x20401820,0x202028a2,0x524a3945,0x62ab5208,0x7b6e6aac,0x6b4f7390,0x5aed6b2e,0x424a5b0d,0x29262146,0x31673167,0x736e5a8b,0x630d734e,0x62ec630d,0x62ec5acc,0x62cc5aab,0x20e44a29,0x62ed4a29,0x5aed5aed,0x6b2e62ed,0x734f62ed,0x62ed62ed,0x6b0e5acc,0x6b2e62ed,0x632e630d,0x20c3632e,0x20c21881,
-0x31642943,0x29243165,0x210439a6,0x31862945,0x21033186,0x29042924,0x290320e3,0x106120c3,0x188118a2,0x20c31061,0x29042904,0x18a320e4,0x41a818a3,0x62ed526a,0x314662ec,0x29253146,0x31462905,0x20e420e5,0x526a526a,0x21043166,0x29462104,0x31262105,0x290520c4,0x31462925,0x29a73187,0x29862986,0x21251906,0x49e53985,0x6ac86b08,0x6ac76aa7,0x51e46a87,0x72c86266,
-0x6aa76ac7,0x62a762a7,0x6a877308,0x6ac772c7,0x72e872c7,0x526649e4,0x20e428e2,0x18a418a3,0x316620e5,0x18c42105,0x00001083,0x31010861,0x5a262040,0x5a4651c4,0x49e541a4,0x626751e5,0x522649c5,0x18404184,0x29042924,0x20e43126,0x21042105,0x18c320e4,0x18a31083,0x28e520c4,0x20a420e5,0x29252105,0x21052105,0x18c31082,0x20c420e4,0x18831083,0x10421883,0x20a32905,
-0x18831022,0x18c32083,0x20e42104,0x18c32905,0x316620e4,0x20e42104,0x106228e4,0x18a320e4,0x18822904,0x20e318a2,0x18a120e3,0x20c018a1,0x10001880,0x10002081,0x00000800,0x08000800,0x100028c1,0x10203121,0x28c20800,0x20601020,0x18001000,0x10001840,0x08001040,0x20411000,0x10001000,0x08001000,0x10001820,0x00000800,0x08000800,0x00000000,0x00000000,0x00000000,
-0x31863166,0x29243185,0x6b2d3186,0x6b2e7bcf,0x6b0d5aac,0x20615249,0x10201000,0x20e22081,0x30c420c3,0x41254166,0x6b2d3925,0x6b0e734e,0x6b0e6b0d,0x632d5aed,0x4a4b5aec,0x5a8b5aac,0x630d5aab,0x62ec62cc,0x6b2d62ed,0x5acc736e,0x62cc630d,0x21055aab,0x5acc526a,0x630d630d,0x5acc6b2e,0x5acc6b2e,0x5aac6b0e,0x5acc6b2e,0x62ec630d,0x6b2e6b2d,0x21056b4e,0x18a21061,
-0x29032923,0x316518c3,0x31653145,0x20e32945,0x21043166,0x290418c3,0x29043145,0x20e33144,0x188120e3,0x20c21881,0x29041882,0x20c420e4,0x188320c4,0x62cc41e8,0x31464a2a,0x20e520e5,0x292620e5,0x20e520a4,0x18a31883,0x21042104,0x29252945,0x29262946,0x29262905,0x31672905,0x21463167,0x29662146,0x39a62925,0x520541c5,0x49c449e3,0x6ac76266,0x5a055a05,0x7b096287,
-0x6a876aa7,0x62a75a25,0x6aa762a7,0x62456aa6,0x72c75a04,0x526649e5,0x21234a06,0x20e418c3,0x20c42905,0x108318a3,0x00001083,0x31020000,0x28a02080,0x49a428c0,0x51e549a4,0x5a2651e5,0x52265206,0x184051c6,0x18a23124,0x20e42905,0x294518c4,0x18e418c3,0x18a410a3,0x20c420c4,0x20a41883,0x18c318a3,0x18e420e4,0x18a31082,0x20e520c4,0x18c420e4,0x102220c4,0x18a32904,
-0x10421883,0x108328c4,0x20e420e4,0x20e418c3,0x21042105,0x290518a3,0x20a320a3,0x292418c3,0x290420c2,0x290320c3,0x10801882,0x290120e2,0x080020c1,0x18401000,0x08001840,0x10401000,0x080020a0,0x18402080,0x10001840,0x28a11000,0x10001800,0x08000800,0x10000800,0x10001800,0x31012080,0x18202060,0x18401840,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,
-0x29452945,0x29242945,0x39863164,0x62ed6b2d,0x5a4a41e9,0x082028a3,0x20c10820,0x31032923,0x21242924,0x29652925,0x39873966,0x52293966,0x6aee6acc,0x7b8f6aed,0x528b6b0d,0x5acc5aed,0x62ed5aab,0x5acc62cc,0x630d5aac,0x5aac630d,0x62cc62ed,0x29465aab,0x5acc5aab,0x62ed526b,0x62cc6b0e,0x5aac630d,0x62ed630d,0x528b62ed,0x5aab5acc,0x6b4e62ec,0x39c862ed,0x29452125,
-0x29242924,0x31863165,0x31653165,0x31453165,0x21243186,0x290420e3,0x20c320e3,0x20e318c2,0x20e320e2,0x20e33165,0x28e420e3,0x106220c3,0x18a320a3,0x312628c4,0x20e53106,0x20e520c4,0x18a42905,0x290520c4,0x20e418c3,0x20e418c3,0x290520e4,0x18c418c4,0x29862946,0x31673187,0x21452125,0x21252966,0x41c541c6,0x522551e4,0x5a4662a6,0x62865a46,0x5a256246,0x6aa76a87,
-0x5a255a45,0x628662a7,0x5a467308,0x6aa66286,0x62865a04,0x4a065205,0x29625267,0x21042103,0x31462926,0x20e41083,0x00000000,0x28c20000,0x30e120a0,0x28c12060,0x51e53943,0x51e549c5,0x49e549e5,0x184051c6,0x29243165,0x108220e4,0x18c32925,0x20e42104,0x18a41062,0x18831863,0x186320e4,0x20e420e4,0x08411083,0x10620021,0x10420801,0x08420842,0x08010822,0x20c420e4,
-0x20830801,0x18a328e4,0x20c42105,0x20e420e4,0x084218c3,0x210418c3,0x20a320e4,0x20e42104,0x20e320c3,0x20e32924,0x18a120e3,0x18a020c1,0x18401880,0x10002081,0x10001800,0x18202060,0x18602900,0x20801861,0x10001840,0x10001020,0x10001000,0x08000000,0x10200800,0x18401000,0x20602080,0x182028c1,0x10002040,0x00000800,0x00000000,0x00000000,0x00000000,0x00000820,
-0x39874a29,0x29031062,0x28e32944,0x732e6b2e,0x62ab62cc,0x08001841,0x18a10820,0x21042924,0x20e32945,0x20c420e3,0x28a420e4,0x310528c4,0x628b3946,0x734e734e,0x5aac62cc,0x62ec62ed,0x62ec5aab,0x5acc62cc,0x62ed62cc,0x41c95aac,0x5aab5a8c,0x5acc5aac,0x5acc4a4a,0x5aed630e,0x62ed6b0e,0x62ed6b0e,0x6b2e630d,0x5aac62cd,0x5aac6b0d,0x734e526b,0x738f630d,0x4a4a5acc,
-0x528b632d,0x29464a29,0x39a63165,0x29453165,0x29442945,0x290418a2,0x18a220c3,0x20c22103,0x20e318a2,0x29452104,0x29453146,0x292520e4,0x18e418e4,0x20c420c4,0x20e41063,0x290520e5,0x20e42105,0x18c420e4,0x290518c4,0x18c32905,0x29051062,0x21252926,0x29262946,0x29462946,0x21252926,0x42072125,0x52064a05,0x5a665a67,0x5a465a46,0x72e85a26,0x5a056ac8,0x5a466266,
-0x51e45a45,0x6aa76246,0x62466266,0x6ac76246,0x62a76aa6,0x49e56266,0x52665a67,0x08202902,0x420818c3,0x106320e5,0x00000842,0x00000840,0x18600000,0x208030e1,0x30e128a0,0x520649a5,0x418449a4,0x08002922,0x106120e3,0x20c420a4,0x292520e4,0x18a318a3,0x18a418a4,0x10a318e4,0x18c318a3,0x210520c4,0x088210c3,0x00410020,0x00000800,0x20c31062,0x186220a3,0x104220a4,
-0x10421862,0x10820801,0x108220e4,0x20c418c3,0x20e318c4,0x18a220e3,0x18a220e3,0x20e22903,0x186128e3,0x20a220a2,0x208128e3,0x186028c1,0x28c020a0,0x10001840,0x18401020,0x28c020a0,0x20a028e1,0x08001820,0x18201000,0x10001840,0x18a11840,0x08200800,0x20a01840,0x20801820,0x10003101,0x18401800,0x080018a0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x316641e8,0x29031062,0x20c32945,0x6b2c4a28,0x39865aab,0x00003966,0x10810000,0x18c20800,0x20e33165,0x52ac31c7,0x29254a8a,0x18a320e4,0x310520e4,0x62ed51c8,0x6b2e62ed,0x5aac5aac,0x62cc5aab,0x630d5acc,0x5aab5aac,0x28e55aac,0x526a3126,0x62ed5aac,0x39a84a4a,0x6b2e5acc,0x62ed62ed,0x6b0e6b2e,0x5acc630d,0x62ed62ed,0x41ea5acc,0x5a8c1043,0x6b4e62ed,0x5aec6b6e,
-0x632d630d,0x5aec5acc,0x29242104,0x18c32104,0x18a220e3,0x20e32904,0x314420e3,0x18a220c2,0x29242103,0x31452945,0x29052925,0x29252925,0x08a318e4,0x10a318c4,0x20e410a3,0x29253146,0x29252925,0x106218c4,0x108318c4,0x20e420e5,0x18c420e4,0x29462925,0x29462946,0x29252905,0x21253146,0x5aa920e4,0x49c45a66,0x5a6662a7,0x52255a46,0x72c86aa7,0x5a256267,0x5a465a46,
-0x62665204,0x6aa76aa7,0x5a255a25,0x49a25204,0x5a455a24,0x62676266,0x5a4772e9,0x20e139c3,0x31862104,0x10832967,0x00000001,0x00000000,0x00000000,0x18200800,0x28a03923,0x49834142,0x49c549a4,0x08203984,0x20c420a2,0x20e420c5,0x29252925,0x210420c4,0x21050842,0x18e41083,0x210420c4,0x10a30821,0x086210c3,0x08610881,0x000018a3,0x10610800,0x08001020,0x10400800,
-0x20832083,0x18a30801,0x18a318a3,0x210418c3,0x292418c3,0x18a320e3,0x18a21882,0x292320c2,0x29032923,0x20e320e2,0x20a220e3,0x312228e2,0x20a02080,0x08002080,0x31011000,0x28e120c0,0x18611020,0x10400800,0x10002060,0x20612060,0x00000800,0x18200800,0x18402060,0x18401860,0x10001840,0x10001820,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,
-0x20e42945,0x18c30820,0x18823986,0x522820c3,0x208228c3,0x00002924,0x18820000,0x39a62904,0x41e71082,0x62ec6b2c,0x5acb6b2d,0x210418c3,0x18831062,0x49871842,0x6b2d62ab,0x4a4a62ab,0x62ec62ec,0x62cc5aac,0x62cc630d,0x524b5aac,0x4a4a2906,0x630d5acc,0x41e95acd,0x630d524b,0x62ed630d,0x630d6b2e,0x62ed630d,0x5acc630d,0x52ac5aac,0x5aac3188,0x6b0e5aac,0x62ed6b0e,
-0x5aac62cc,0x5a8b630d,0x18c35aec,0x20e310a1,0x20c22103,0x20e320c2,0x290320c2,0x290420c3,0x29442924,0x29452944,0x29662945,0x19052104,0x19051905,0x106318c4,0x18a418e4,0x29462966,0x29662925,0x29462966,0x21052925,0x18a318c4,0x21052945,0x21042945,0x21043166,0x29472926,0x21252105,0x52473185,0x49e45205,0x52255a46,0x52045a45,0x5a465225,0x5a466aa7,0x52045a45,
-0x7b2a5204,0x5a257b29,0x6a876a87,0x72e86a87,0x628849c4,0x6ac86aa8,0x52256aa7,0x292249c4,0x21032944,0x21053145,0x088310a4,0x00000000,0x00000000,0x00000000,0x18200820,0x28c030a0,0x41c54183,0x08004164,0x29041061,0x20e41884,0x20e42925,0x18a320e4,0x10831083,0x18a30822,0x20e41883,0x18c318c3,0x002018c3,0x106110a2,0x10401882,0x00001020,0x08000800,0x08200000,
-0x18a21882,0x10421882,0x18a320e4,0x10621883,0x20e320e4,0x20c320c3,0x29031882,0x310320a1,0x290328e2,0x28c218a1,0x30e228a2,0x28c22060,0x310228c1,0x28c13122,0x20c028e2,0x10002081,0x10000800,0x396228e1,0x182028c0,0x20823942,0x18201800,0x10200800,0x18201840,0x08001020,0x10001840,0x10001020,0x08201820,0x00000000,0x08410000,0x528818a1,0x52477b6c,0x41a449e6,
-0x292520e4,0x106118a3,0x106120c3,0x290420e3,0x29041821,0x10612945,0x528a39a7,0x62eb5aeb,0x39c620e3,0x62cc4a28,0x6b2d630c,0x10a3528a,0x21252945,0x18a32905,0x29253125,0x292541e8,0x6b2d526a,0x6b0d5acc,0x5acc630d,0x62cd5aac,0x52ac3987,0x5acc630d,0x5a8c5acc,0x6b0e5a8c,0x5acc5aac,0x5aac630d,0x630d6b2e,0x5acc630d,0x528b62ed,0x62cd630d,0x5acc6b2e,0x62ed630d,
-0x526a630d,0x62ec6b2e,0x18c45acd,0x20e31082,0x18c318c2,0x29252104,0x18812125,0x18a21882,0x18c21061,0x18c310a2,0x21042945,0x10a418e4,0x10a40883,0x18c410a4,0x21252125,0x29662926,0x31873166,0x31872966,0x21252946,0x18c42946,0x29452925,0x20e43166,0x18c33146,0x212620e5,0x29452126,0x5a464a27,0x51e45a46,0x520449c4,0x52045a45,0x5a466286,0x62875a25,0x52045a25,
-0x62676286,0x6aa772c8,0x6ac76246,0x62876aa7,0x5a455a66,0x52057308,0x5a466266,0x52674a05,0x29433185,0x21052904,0x000110a4,0x00000021,0x00000000,0x10a20000,0x00000000,0x28c020a1,0x52064163,0x10403103,0x20e420c3,0x20e420c4,0x29252105,0x10622925,0x10831083,0x18a31083,0x20a228e3,0x20e32924,0x18a22903,0x08200000,0x10401061,0x20c21040,0x10200800,0x10410800,
-0x290320c3,0x18a30000,0x10620000,0x20e320c4,0x20c320e3,0x106220c3,0x20a21041,0x208128c2,0x186028e2,0x28c22903,0x30e228e2,0x28c22081,0x28c13123,0x28c128c1,0x080028e2,0x10201020,0x10201000,0x28e11840,0x31211880,0x182028c0,0x18202081,0x10201840,0x10400800,0x08000800,0x08200800,0x08000800,0x62c883ac,0x4a065a87,0x4a264a06,0x49e45a66,0x49a449a4,0x6ac849a4,
-0x294420e2,0x188118c2,0x084018e2,0x290320e3,0x10612103,0x18a220e3,0x52ab62eb,0x62ec52ab,0x20a228e4,0x49e720c3,0x62ec5a8b,0x20e4526a,0x4a6a4249,0x210410a3,0x20c320e4,0x29253145,0x6b2d62ed,0x62cc5acc,0x62cc6b2e,0x5acc526b,0x4a095aab,0x630d62ed,0x62ec6b2e,0x630d6b2e,0x5acc62ec,0x5aac6b2e,0x630d62cd,0x632e630d,0x5aed52ac,0x5acc5acd,0x6b0e52ac,0x5acc62cd,
-0x62cc62ec,0x62ec62cc,0x21065acc,0x4a2a18e5,0x294639e8,0x4a8b4a4a,0x292539e9,0x104118a3,0x20c21040,0x21030860,0x18e41905,0x41e93a08,0x3187420a,0x10a42146,0x31a718c4,0x29052946,0x20c420e5,0x29252925,0x29662105,0x29462125,0x29453187,0x18c32945,0x20e43166,0x210518e4,0x31642946,0x5a665a46,0x52055a66,0x52255a25,0x62666286,0x5a665a66,0x52255a25,0x520549e4,
-0x49a351e4,0x520451e4,0x5a255a25,0x5a465a25,0x41a25a25,0x49c45204,0x5a665a46,0x52055a66,0x39e55a88,0x18c42925,0x08422126,0x00011083,0x00000000,0x00000000,0x00000000,0x18000020,0x312330e1,0x08002061,0x31451820,0x18822905,0x20e420a3,0x082128e4,0x210518a3,0x20a20841,0x102020e3,0x08003144,0x106120a2,0x00000840,0x08000000,0x10610800,0x08201041,0x28e31020,
-0x104028e3,0x108220a2,0x084118c4,0x20e418c3,0x20e420c3,0x188220c3,0x20e21882,0x18a02902,0x20c218a2,0x20a128e3,0x28e228c2,0x29033103,0x21022903,0x18001860,0x08000800,0x20801840,0x20802080,0x31202080,0x184020c0,0x18402060,0x20a01860,0x08000800,0x08000000,0x10000800,0x08000000,0x7b2a1841,0x62a86aa8,0x5a676287,0x5a676ae9,0x49c35a26,0x6aa84162,0x6a866a88,
-0x28e31861,0x20e32903,0x08003165,0x5aa918a1,0x00002103,0x4a480820,0x4a6a5aaa,0x318739c7,0x28e30000,0x398620c3,0x41c72904,0x106249c8,0x5acb3187,0x18a32125,0x39a62925,0x290541e8,0x62ec5acc,0x62ec5acc,0x62cc6b2d,0x62ec5acc,0x41e9528b,0x6b4e736e,0x5a8b62ed,0x62cc62cc,0x62ed62ed,0x62ed5acc,0x62ed5aac,0x630d632e,0x528b528b,0x526b526b,0x5aac62ed,0x526b5acc,
-0x5acc5a8b,0x62ec5acc,0x526b5acc,0x526b4a4a,0x5acc5aab,0x4a6b528b,0x4a8b52cc,0x10832967,0x20e318a2,0x10a30040,0x422918e4,0x528c52ab,0x5aec528b,0x10a44a6b,0x212510c4,0x312620e4,0x312628e5,0x20c42905,0x18c420e4,0x294618e4,0x20e43146,0x29252946,0x29452945,0x296618e4,0x41c62926,0x5a465a87,0x5a465a46,0x5a2549c4,0x5a255a66,0x5a455a46,0x49e46286,0x5a256287,
-0x520549a3,0x5a0451c4,0x5a2549c3,0x62664182,0x5a656287,0x52255204,0x5a465225,0x52255246,0x4a266288,0x18c33985,0x10a318c4,0x10a40862,0x00000002,0x00000000,0x00000000,0x00002104,0x18800800,0x10203945,0x28e33124,0x29051083,0x20c320c4,0x188320c4,0x000018c3,0x10200000,0x20a21881,0x18812903,0x10602903,0x08400000,0x08000000,0x10611882,0x10611041,0x00000800,
-0x28e320e2,0x188320c2,0x104220c4,0x20c30000,0x18a31882,0x20c320c3,0x28e220a2,0x29032903,0x290328e3,0x28e220c2,0x310328e2,0x28e23103,0x206128e2,0x00001861,0x18401020,0x20601000,0x186020a0,0x20a01840,0x30e120a0,0x18602080,0x20801020,0x00001000,0x08000000,0x00200020,0x10000801,0x62675223,0x5a676ac8,0x5a4662a8,0x5a255205,0x520449c3,0x6aa86ac8,0x5a2472e8,
-0x30e32081,0x20c22903,0x188120a2,0x41c62103,0x00001881,0x528a1882,0x31863185,0x62ec1082,0x314518a3,0x20c341a6,0x30e33104,0x310530e5,0x630c526a,0x20e44a49,0x420841e8,0x29052986,0x62ec5acc,0x5aac62cc,0x62ac62ec,0x62ec5acc,0x5aab528b,0x632e62ec,0x62cc6b4e,0x62cc62cc,0x62ec630d,0x5acc6b0e,0x62ed6b0e,0x5acc5aed,0x52ac5acc,0x526b5acc,0x526b52ac,0x526b526b,
-0x5aab62cc,0x5a8b4a4a,0x5aac4a4b,0x52ab4a6b,0x528b5aab,0x5b0d5aab,0x4a6b52cc,0x29675b0d,0x18e310c2,0x39e818e3,0x424a4a8b,0x5aac4a8b,0x52ac5aac,0x422a422a,0x10a32125,0x312618a4,0x28e53126,0x20e520e4,0x21052925,0x20c418e4,0x20c420e5,0x21042905,0x29252105,0x29262926,0x42062105,0x52255a66,0x49c45225,0x730862a7,0x5a465204,0x52255a66,0x5a255204,0x5a666aa7,
-0x49a35225,0x62664162,0x498349c3,0x41a351e4,0x5a256aa7,0x49e43962,0x5a665a46,0x49c45225,0x52255a25,0x31864a27,0x190410c3,0x10a40882,0x10830003,0x08620021,0x00210021,0x00200000,0x00000000,0x10000000,0x20a21000,0x290418c4,0x292520e4,0x104220c4,0x082118a3,0x08000821,0x000018a1,0x106128e3,0x10401040,0x18c220e3,0x082010a1,0x00000800,0x00000820,0x00001020,
-0x18811020,0x18831040,0x10621062,0x18a320e4,0x106118a3,0x20c320c3,0x29022904,0x28e32904,0x20a22903,0x28a220e3,0x208128a2,0x18a120a1,0x00001881,0x10000000,0x10001800,0x20a028e0,0x28c128c1,0x20802080,0x100028c0,0x18602080,0x100020a0,0x00001000,0x080020e2,0x00000000,0x418328c0,0x522649a3,0x62877309,0x49a35a66,0x6a8649a3,0x62876ac6,0x72c86ac8,0x522372e7,
-0x29033964,0x20c23965,0x28e30800,0x29242903,0x00000000,0x31441881,0x184120e2,0x6b2c3145,0x5a8a62eb,0x20e34a48,0x28e320a2,0x20a22904,0x630c4a08,0x316662eb,0x18c32946,0x210518e4,0x52ab2946,0x5aab6b0d,0x41e95a8b,0x5aac522a,0x4a095aab,0x6aed5249,0x5aac7b8f,0x5aab6b2d,0x62ec5aac,0x630d5aac,0x5aac62ed,0x5acd5acd,0x5acd5aac,0x526b528b,0x5acc52ac,0x528c528b,
-0x526b5aac,0x5acc5acc,0x526b528b,0x528b5aac,0x5aac52ac,0x52ac5acc,0x528b52ac,0x528b630d,0x296610c4,0x528b4a4a,0x52ab5acc,0x630d52ab,0x5acc62ed,0x52cc52ac,0x29874a6b,0x20c418e4,0x18a418a4,0x18a318c3,0x292520e4,0x20c420e4,0x188318c4,0x290520e4,0x18a318c4,0x21052105,0x52272125,0x62666287,0x5a2549e4,0x5a665a66,0x52045205,0x52256266,0x62865225,0x62866ac7,
-0x49c36ac8,0x524649e4,0x524541a3,0x5a2649e4,0x41a25a46,0x6ac849c4,0x5a675205,0x52055a46,0x49c449c5,0x41c549e5,0x20e42103,0x08a310a3,0x08a40042,0x00220863,0x088310c4,0x00420883,0x00200883,0x20c21041,0x20e30000,0x188320c4,0x208320c4,0x000020a3,0x108218a3,0x106120c3,0x20a21000,0x20a21020,0x10411040,0x18a21061,0x08000841,0x10410820,0x08001861,0x00000800,
-0x10200000,0x10211021,0x10411020,0x18611861,0x20e31861,0x20e320c2,0x21032103,0x18812903,0x20c21881,0x28e32903,0x290328e3,0x102020e2,0x10000800,0x08001000,0x184028a1,0x28c130e2,0x18402060,0x20602080,0x10200800,0x18401840,0x08001000,0x18611040,0x18601020,0x28c10820,0x39423923,0x51c451a4,0x5a055a26,0x72c93920,0x5a435a24,0x72e86aa7,0x6aa772e8,0x6a866aa8,
-0x31233985,0x31443124,0x20a20800,0x082020e2,0x29040800,0x28e23124,0x080020c2,0x6b2c6b0c,0x4a496b2c,0x21243186,0x20e32103,0x28e320c3,0x5aaa3124,0x21055aaa,0x10622925,0x42092104,0x42292946,0x5acc6b2d,0x41e95a8b,0x5aab41a8,0x39465aac,0x526a2083,0x526b6b0c,0x5aac5aab,0x5acc62ed,0x5aac5acc,0x62cd62ed,0x5acc5aac,0x5aac5aed,0x526b528b,0x5acc52ac,0x5aed4a4a,
-0x528b528b,0x62ec5a8b,0x5a8c526b,0x5aac526b,0x4a6b5acc,0x528b52ac,0x6b2e62ed,0x5a8c5a8b,0x422939e8,0x526a528b,0x4a6a4a6a,0x62ed528b,0x4a6b528c,0x52cc528b,0x4a6a52cc,0x20c431a7,0x20c41863,0x188320e4,0x210420e4,0x292518a3,0x188320c4,0x18c420c4,0x20c420c4,0x292518e4,0x49e618e4,0x5a465a46,0x522549e4,0x5a265a66,0x52045205,0x5a2551e4,0x6ac76266,0x5a666266,
-0x52256ac8,0x5a665225,0x49e44a04,0x49c349e4,0x41c349c3,0x5a875246,0x520562a8,0x62675205,0x520549c4,0x52675a47,0x294439c3,0x08831904,0x08630884,0x00020863,0x10840043,0x18c50864,0x18c40863,0x00001061,0x31651061,0x20a31883,0x28c420c4,0x00001062,0x08210000,0x08200000,0x20c21000,0x18810800,0x18811020,0x08201040,0x10200000,0x18411861,0x08001861,0x00001861,
-0x00000000,0x10400800,0x08001040,0x18611861,0x20e31882,0x20c32103,0x20e320c2,0x18a220c2,0x28e320a2,0x28e328e3,0x186020c2,0x20800800,0x28a11000,0x28a128a1,0x10003100,0x180020a0,0x180028a1,0x10201840,0x08000820,0x10000800,0x18402060,0x10200800,0x20e22903,0x20611860,0x39423102,0x49a43901,0x72e95a05,0x62656ac7,0x836a6ac7,0x72c76aa7,0x72e76265,0x628672e9,
-0x39643964,0x30e33924,0x29030820,0x292418a2,0x31853165,0x20c220c3,0x00001040,0x5a8b528a,0x3166528b,0x18c318e4,0x18c32904,0x28e328e3,0x39862904,0x20e42925,0x39e82104,0x630d5aab,0x5acc5acc,0x62cc7baf,0x3126528b,0x4a292905,0x31255aab,0x28c31821,0x522928c4,0x5a8b2905,0x62cc6aed,0x5acc630c,0x5acc62ed,0x5a8c62ed,0x5aac526b,0x5acd62ed,0x62ed6b2e,0x5acc52ac,
-0x5acc5aac,0x5a8b528b,0x526a528b,0x524a526a,0x4a4b528b,0x528b526b,0x5a8b62ed,0x528b62cc,0x528b4a4a,0x4a6a528b,0x5acc526b,0x526b528c,0x528b526b,0x528b528b,0x526a5aac,0x18c44a4a,0x20e52926,0x18c320c4,0x18c318a3,0x29262925,0x10631083,0x18c42905,0x210420e4,0x20e418a3,0x4a071081,0x520551e4,0x520549e4,0x52255205,0x5a466ac8,0x62875a66,0x6aa76287,0x62866aa7,
-0x52055225,0x51e45a46,0x418349e4,0x418249c3,0x5a463941,0x5a865a66,0x5a465225,0x5a465205,0x52055205,0x52464a05,0x39a54a05,0x10a32103,0x10c508a4,0x00010043,0x08630002,0x004308a4,0x08630863,0x18a30001,0x20c41041,0x20a32905,0x18a320c4,0x000120e4,0x00000862,0x10001020,0x28c21800,0x00000000,0x106110a1,0x104120e3,0x10001040,0x10001841,0x00000000,0x08201061,
-0x00000000,0x00000000,0x00000000,0x18610000,0x28e31040,0x104020a2,0x20c31862,0x18811881,0x20c220c2,0x104020e2,0x00000000,0x18600800,0x208028c1,0x28c01000,0x30e130e1,0x20803102,0x082028c1,0x08000000,0x10200820,0x18210800,0x10002080,0x10200800,0x20c22903,0x31231881,0x51c551e5,0x62665205,0x7b296286,0x6ac77308,0x6aa66286,0x73086245,0x72e87b09,0x62666aa8,
-0x20a13103,0x208128c3,0x20c21881,0x31442904,0x31653145,0x18a20800,0x18c20820,0x39a739a6,0x526a18a3,0x21253186,0x29662987,0x20e43166,0x290420e4,0x398620c3,0x5acc5aab,0x632d632d,0x632d62ec,0x62ed6b0d,0x31265acc,0x39a720c4,0x5acb5a8a,0x106128e4,0x526a1883,0x2904526a,0x49e82083,0x5aac62cc,0x62cd62cc,0x62ed5aac,0x6b2e5aac,0x5acc5aac,0x5acc632e,0x630d52ac,
-0x5aac526b,0x5a8b5aac,0x41a75249,0x41e928c4,0x4a2a5acc,0x5a8c52ac,0x4a4a524b,0x526a4a4a,0x4a091863,0x4a6a528b,0x52ac526b,0x52ac4a4a,0x5acc528b,0x528b4a6b,0x5aec526b,0x294652ab,0x20c420e5,0x20c418a3,0x18a32925,0x18c41883,0x292620e5,0x18c420e5,0x20c418a3,0x18c318a3,0x398418c2,0x49a35205,0x5a465205,0x5a466266,0x62666287,0x5a466287,0x5a665a46,0x6aa76aa7,
-0x5a255a46,0x52055a66,0x52255a46,0x41833120,0x6ac85205,0x5a665a67,0x62875225,0x52055205,0x5a875a66,0x5a875a87,0x4a054a26,0x39e54226,0x08a410a3,0x00220043,0x08840884,0x004310a4,0x08430043,0x00010042,0x18821062,0x21042904,0x18a318c3,0x18a31082,0x08201062,0x182020c2,0x28e31841,0x186120c2,0x41c73985,0x39855269,0x08000800,0x00001020,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x20a218a1,0x20c21861,0x29040800,0x186128e3,0x188118a2,0x08000000,0x08401000,0x20602081,0x18002080,0x28a128c1,0x28a028c1,0x18202060,0x00001020,0x00000820,0x10000820,0x208120a0,0x18212080,0x10400800,0x18811881,0x49e51881,0x51c54143,0x72e872c8,0x7b29836a,0x72e96aa7,0x6ac87b09,0x73087308,0x7b296aa7,0x6a86834a,
-0x20a220a2,0x290320c2,0x28e320c3,0x292420c3,0x29243986,0x00001082,0x10611081,0x42082924,0x31663166,0x528a2966,0x5acb630c,0x528a630c,0x210439a7,0x4a2920e3,0x62ec62ed,0x6b0d6b4e,0x630d62ed,0x5acc62ec,0x42095aec,0x20c40822,0x528a526a,0x20e31082,0x42293987,0x52ab632d,0x28812021,0x522928c3,0x5a8b62cc,0x5a8b5a8b,0x5aab628b,0x62ed62cc,0x5acc5aac,0x5a8c5a8c,
-0x528b526a,0x52495aac,0x204130a3,0x20c40800,0x4a6a4a2a,0x5a8b52ab,0x528b5aab,0x520a524a,0x41e828e4,0x5aab526a,0x422a528b,0x52ac5acc,0x528b4a4a,0x4a4b4a4a,0x526a528c,0x20e5526a,0x18a31022,0x18a31083,0x20e42105,0x210518a4,0x18a418c4,0x18a318c4,0x108218c4,0x18c12104,0x41c43964,0x52055205,0x5a665a46,0x626662a7,0x62666287,0x5a465a46,0x5a255a66,0x62666287,
-0x6aa75a46,0x62a75a87,0x41625a04,0x5a673100,0x52455245,0x4a055a86,0x62875a46,0x5a465a66,0x62a85246,0x62876287,0x41c35246,0x41e549c4,0x21244a26,0x10a410a3,0x08420042,0x10c410c4,0x00220002,0x00000000,0x10821082,0x18a30000,0x20c41062,0x10620800,0x102120c3,0x10401041,0x106020c2,0x10201000,0x08403103,0x00000000,0x10210000,0x00000800,0x00000000,0x00000000,
-0x00000000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x29040000,0x00000000,0x10200000,0x28c21000,0x18a12061,0x104120a1,0x08000800,0x286128a0,0x18201820,0x00000000,0x00000800,0x18601861,0x20801840,0x208028c0,0x08000800,0x20410000,0x28e20800,0x392330e2,0x5a463901,0x72e86aa7,0x7ae872e8,0x72c86266,0x7b097b2a,0x72c86aa7,0x7b087b29,0x72e87b29,
-0x28e328e3,0x20c22903,0x20c31861,0x4a0820e3,0x210362cb,0x20c31061,0x29243165,0x29253165,0x20c42104,0x20e42125,0x6b4d6b4d,0x62ec62ec,0x39a75acb,0x528a20e3,0x630d5aed,0x6b0d6b4e,0x5aac630d,0x5acc5aab,0x52ab528b,0x08221884,0x528a2925,0x10a220e3,0x62ec4229,0x632d6b6e,0x28e31821,0x208220a2,0x30e43925,0x310428c3,0x39863925,0x62ac41a7,0x62ed62ac,0x62ed5aac,
-0x5aac528b,0x28a35a8b,0x10201000,0x10620800,0x4a4a4209,0x5a8b5acc,0x528b4a4a,0x3946522a,0x39861821,0x528b4a4a,0x422a4a6b,0x528b4a4a,0x5aac5aac,0x4a2b526b,0x5a8b4a6b,0x41c862cc,0x292618a3,0x20e420c4,0x18e418e4,0x20e418e4,0x20e518a4,0x18c320c4,0x18a318c3,0x49e620c2,0x49e45a47,0x5a465205,0x6aa76287,0x73096266,0x6aa75a66,0x5a666266,0x52256ac8,0x62875a46,
-0x6ac85a25,0x5a465246,0x5a2651c3,0x5a6749c4,0x52255245,0x52055a66,0x524541c3,0x5a465a25,0x62876287,0x5a676287,0x52455a87,0x49e55a66,0x52684a05,0x10c431a5,0x08630042,0x084218e5,0x000118a4,0x084118e4,0x00000841,0x08210821,0x00000821,0x20a31883,0x08001862,0x10600000,0x106118a2,0x08000800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x08200800,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x20c20820,0x186020a1,0x188128e2,0x000020c2,0x10010000,0x20201020,0x08003943,0x08000800,0x10601020,0x312218a0,0x290220a0,0x28a11860,0x08000800,0x31431040,0x28e130e2,0x49a42880,0x62876aa8,0x6ac75a26,0x6a876aa7,0x72e86a66,0x72e87b09,0x628672c8,0x72e86266,0x6aa77b09,
-0x20c228e3,0x106120a2,0x28e341c6,0x632c2103,0x3165632c,0x20e318c3,0x528a4a28,0x4a49630c,0x21252125,0x29452104,0x6b2d6b0d,0x62ec62ec,0x39e862ec,0x528b2145,0x736e5aec,0x62ec734e,0x62cc62cc,0x5acc5aac,0x4a6a20e5,0x29254a4a,0x18e30862,0x18c31082,0x528b31a7,0x6b2d6b4e,0x10002041,0x186020a1,0x29021881,0x28a128a1,0x18612060,0x28c31882,0x41a75a49,0x5a4a5229,
-0x528a4208,0x28c428e4,0x28e31841,0x20c31082,0x526a4a4a,0x528b62ec,0x526a5acc,0x284230e4,0x186220c4,0x4a4a4229,0x4a4a528b,0x52ac526b,0x526b5aed,0x524b524b,0x526c526b,0x3987524b,0x292620e5,0x18c40001,0x00010822,0x10421083,0x186318a3,0x18c420a4,0x31a618c3,0x41c449e5,0x5a255a46,0x5a6649e4,0x62a76287,0x62865205,0x52056aa7,0x62a75a46,0x5a256aa7,0x52255a45,
-0x6b0962a7,0x730a5225,0x52065206,0x49e55a66,0x52056287,0x5a875a66,0x52255a87,0x62a75a25,0x52056287,0x49e45205,0x52056287,0x52265a46,0x5a875226,0x294462a8,0x088418c4,0x18c41063,0x00000001,0x10420821,0x00000000,0x00000000,0x08210841,0x10621062,0x08400820,0x08200820,0x08200800,0x18821021,0x00000000,0x00000020,0x00000000,0x00000000,0x10200000,0x08200800,
-0x00000020,0x00000000,0x31650820,0x18a23185,0x29430820,0x002020e2,0x00000000,0x00000000,0x18c10840,0x20c10860,0x188120e2,0x00000800,0x08000000,0x20401000,0x08003143,0x08000000,0x08001020,0x29011860,0x10400800,0x10820820,0x00000000,0x310228c2,0x51c538e2,0x62666287,0x5a255225,0x5a245a46,0x41613940,0x72e96246,0x72e87309,0x62466aa7,0x72e87b49,0x7b2972e8,
-0x10203965,0x28e31861,0x290320c2,0x39862924,0x20c23986,0x294520e3,0x630c41e7,0x4a6a5aeb,0x18a310a3,0x4a492945,0x6b2d736e,0x524a628b,0x29454187,0x5acc2125,0x736e5acc,0x62ec734e,0x5a8b524a,0x62ec62ec,0x5acc41e9,0x528b62ec,0x18c310a3,0x29662104,0x62ec5acb,0x5acc6b2d,0x20602882,0x18602080,0x29032903,0x28a128c2,0x28e230e2,0x28c218a2,0x20421861,0x28622021,
-0x180130e4,0x10210800,0x28e31841,0x18a21061,0x526a4a29,0x528b528b,0x41a7524a,0x08002083,0x20a30000,0x4a6a4a4a,0x528b4a4a,0x528b4a4b,0x526b4a6b,0x4a0a5a8c,0x4a6b528b,0x2905524b,0x186320e4,0x18a30842,0x106310a4,0x18a318c4,0x082218a4,0x18a220e4,0x41e61881,0x49e549c4,0x62875a46,0x5a665a66,0x5a256266,0x5a455205,0x62875a45,0x52055205,0x39625a25,0x6ae96ac8,
-0x730a732a,0x72e97309,0x62673922,0x49e55a67,0x52265a67,0x52465a67,0x5a8762a7,0x5a465a25,0x5a665205,0x52055a46,0x5a2551e4,0x5a675225,0x5a675a67,0x4a2762c9,0x08832945,0x08210021,0x08220801,0x210420e4,0x00000841,0x00000000,0x00000000,0x00000000,0x10600800,0x10401060,0x08000800,0x00000820,0x00000000,0x00000000,0x08200000,0x08000800,0x08000000,0x08200000,
-0x08200800,0x28e20000,0x4a063985,0x736b39a4,0x6b0a5aa8,0x29646b2b,0x18c20000,0x00000020,0x10811060,0x10810000,0x00000840,0x00000000,0x00000000,0x10000800,0x18402041,0x08000000,0x20a120a1,0x188028e2,0x08000820,0x08000820,0x31241861,0x39643102,0x414230e2,0x72e86aa7,0x5a4672e8,0x51e35a66,0x62454160,0x72c86a66,0x72c872e8,0x72e85a45,0x6aa67b28,0x7b297b29,
-0x10200800,0x10400800,0x20e23144,0x208220a2,0x30e23104,0x00001840,0x52aa0840,0x2104528a,0x21042104,0x5acb18a3,0x736e62cc,0x39055a2a,0x20c43105,0x5acc2925,0x62cc5aec,0x5a8b6b0d,0x5aab5a6b,0x5aab6b2d,0x6b4e5acc,0x62ec630d,0x422852ab,0x528a2124,0x5aab5acb,0x526a5acb,0x20601800,0x28c21840,0x18a120c2,0x206030e2,0x100028a1,0x20a11881,0x18812081,0x18610800,
-0x20a21020,0x18401840,0x10601000,0x10800840,0x4a4a41e7,0x4a4a4a4a,0x28e4526a,0x10a21042,0x31a718a3,0x52ab4a4a,0x4a6b4a4b,0x528b526b,0x5acc526b,0x526b4a4a,0x42094a2a,0x31453166,0x20e320e3,0x18e42125,0x18c410a4,0x18c41063,0x10431062,0x394418c1,0x41c428e1,0x5a6749e5,0x5a466aa7,0x6ae86266,0x5a2562a7,0x52255205,0x52255204,0x52055205,0x49c45a25,0x836c5a47,
-0x83ad83ad,0x62678bad,0x49a43961,0x49e55248,0x5a875205,0x5a866287,0x52455a66,0x5a255a25,0x5a665a66,0x5a465a66,0x52255a46,0x5a465205,0x5aa85226,0x5a665246,0x39c662a8,0x00211083,0x10421042,0x088210a3,0x08410061,0x00000000,0x00000020,0x00000000,0x08001041,0x00002924,0x08000000,0x00000000,0x00000000,0x00000000,0x08000000,0x08000800,0x08000820,0x00000800,
-0x41a53984,0x7b6c49e6,0x5a657b6c,0x7b4962a7,0x73295225,0x526862c8,0x29435268,0x00001081,0x00000000,0x00000000,0x00000000,0x00000000,0x08210000,0x10400000,0x00000000,0x18600001,0x310228c1,0x104020a1,0x08201860,0x10200000,0x392328c2,0x394328c2,0x6aa749a4,0x6ac87309,0x6ac86287,0x5a266287,0x72a851e4,0x6ac86245,0x62466aa7,0x72e86286,0x59c259e2,0x836a7b09,
-0x08001020,0x290420c2,0x20e320c3,0x18612903,0x29033965,0x084028e3,0x31651061,0x18832925,0x290518c4,0x5a8a4a29,0x62ec5acb,0x314649e9,0x290428e4,0x29252904,0x528b526a,0x5a8b5a8b,0x5aab5a8b,0x29265a8b,0x5aac3167,0x62ec6b2d,0x4a6a5aab,0x62ec2125,0x6b4e5acb,0x28e45a8a,0x18001000,0x39841040,0x28c228e2,0x208120a1,0x18a020a1,0x10402923,0x186120c2,0x20c21861,
-0x10401020,0x10400820,0x20a11840,0x08201000,0x526b4208,0x2083524a,0x28c43105,0x10621021,0x4a4a39a7,0x4a294a4a,0x4a4b4a2a,0x528b5aac,0x526b528b,0x18842946,0x20c420c4,0x18a318a3,0x18821882,0x20c318a3,0x18a318a4,0x188318a4,0x08000820,0x39642924,0x52483985,0x5a6749e4,0x62866246,0x72c86aa7,0x5a466287,0x5a466287,0x52055225,0x52265a86,0x51e55205,0x7b4b734a,
-0x7b2b836c,0x5a266267,0x41825a47,0x49e45205,0x5a6649e5,0x52255a67,0x5a6662a7,0x524649e4,0x52256287,0x52465a66,0x51e45205,0x5a6751e4,0x52265a67,0x51e54a05,0x4a664a05,0x002120e4,0x10630842,0x10a30022,0x088210a2,0x08200000,0x00000000,0x00000841,0x29040000,0x10410800,0x00000020,0x08000000,0x00000000,0x00000000,0x08200800,0x00000000,0x7bae0800,0x4a275a68,
-0x49c549e5,0x62a862a9,0x6ac76287,0x6ac77b29,0x73096ac7,0x72e96267,0x6ae97b4a,0x630a8bed,0x00000040,0x00000000,0x00000000,0x00000000,0x08201882,0x00000000,0x08000000,0x10000800,0x10600000,0x18a11040,0x08201020,0x28e20000,0x41a53943,0x52054184,0x62466287,0x62876287,0x6ac86ac8,0x5a256287,0x626672e8,0x72c85204,0x5a456266,0x72c86286,0x51c26ac7,0x834a8b6b,
-0x29031040,0x29252924,0x29041061,0x41e80841,0x41c64a49,0x31653144,0x294520e3,0x20e52905,0x5a8b2105,0x5aaa62cb,0x41e8526a,0x31463105,0x290428e4,0x18c33145,0x29462925,0x5acc526b,0x4a29524a,0x31464a09,0x39872105,0x62cc62cc,0x39a75a8b,0x4a493125,0x316662ec,0x100028e3,0x20a01840,0x20c10800,0x208028c2,0x28c228e2,0x18a028c2,0x20a11860,0x20a220c2,0x08001020,
-0x08001881,0x10401020,0x20a11860,0x08001840,0x52692103,0x08003945,0x20e40801,0x29a618c3,0x42094229,0x42294229,0x5aac4a2a,0x528b4a6b,0x4a4a528b,0x20a539a8,0x20e420c4,0x316641a7,0x106218a2,0x20c218a2,0x20e418a3,0x08220842,0x106118c3,0x28c23143,0x30e33103,0x5a253900,0x62666266,0x6a876a87,0x62a76266,0x51e45205,0x5a6651e4,0x520649e4,0x49c45226,0x5a685226,
-0x6aa86287,0x5a675226,0x41c46287,0x522649e4,0x4a0549e5,0x62a77309,0x5a465205,0x52255205,0x52265a67,0x62a85a46,0x52254a05,0x4a056287,0x52055205,0x51e55205,0x420549e5,0x00225267,0x10830842,0x08610862,0x18a208a1,0x08400000,0x08200000,0x00000000,0x08200800,0x00000881,0x00000000,0x00000000,0x00000820,0x00000000,0x00000800,0x10820000,0x6ae93963,0x4a055aa8,
-0x49a449a4,0x62255a06,0x72e872c7,0x73086ac7,0x6ae77308,0x6ae862a6,0x7b086ac7,0x734a7b29,0x4a26734a,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x10000800,0x08001820,0x08001881,0x08001040,0x10200800,0x31021860,0x39643102,0x5a464163,0x5a466266,0x5a666aa8,0x6aa76ae8,0x5a256287,0x62666aa7,0x72e86286,0x626572e8,0x6aa86266,0x7b096aa7,0x72e78349,
-0x29011880,0x18a32944,0x18a22104,0x4a2941e8,0x314539a6,0x31a64a29,0x39a72924,0x31a72125,0x5acc31a7,0x524a62ec,0x20c32924,0x18a22904,0x290420c3,0x20e42904,0x292520e4,0x5aac4a29,0x524a5aac,0x4a6a4a4a,0x5aab528b,0x62ec630d,0x30e45acb,0x5acb28e4,0x28e36b2c,0x20a11860,0x28e21860,0x312328c1,0x186020a1,0x10001860,0x290228c1,0x208128e2,0x080020a1,0x10611040,
-0x10401881,0x08000860,0x080020c2,0x08000800,0x20621861,0x10201000,0x10831041,0x4a4a4a2a,0x4a4a41e8,0x4a6a4a4a,0x5aab4229,0x4a4a528b,0x4a4a52ac,0x422a4a6b,0x318618a4,0x29455269,0x20c220a3,0x20c320c2,0x292518a3,0x104220e4,0x08000800,0x31233164,0x310330e3,0x5a664184,0x6aa75a25,0x6aa772c8,0x62876267,0x41835205,0x49e45a46,0x628749e4,0x49e449e5,0x52266287,
-0x5a2651c5,0x5a465a26,0x31215a47,0x5a673982,0x51e45205,0x5a675a25,0x4a055205,0x52465205,0x62a75205,0x52265246,0x5a465226,0x41c45a26,0x52054a05,0x4a265205,0x4a264a05,0x292239a5,0x08610000,0x18c21062,0x08600840,0x10a20000,0x00000020,0x08410000,0x00001081,0x000018c2,0x00000000,0x00000000,0x00000000,0x00200000,0x08000000,0x6a672081,0x5a876267,0x49e55a68,
-0x49a449a4,0x6aa86267,0x62656ac8,0x62866aa6,0x72e872e8,0x73086aa7,0x72e87308,0x6ac86aa7,0x524562e8,0x18e27349,0x00000000,0x00000000,0x00000000,0x08000000,0x184128c3,0x08001040,0x08002060,0x08000820,0x31231880,0x39453943,0x28e24165,0x62663901,0x72e86ac8,0x62876287,0x6aa76a87,0x72e86246,0x6a876aa8,0x7b2972c8,0x622549a3,0x6aa672c7,0x72c77b08,0x72c68349,
-0x31642923,0x29252944,0x5aab41e7,0x31664208,0x29243166,0x31855269,0x4a6a3165,0x5aab4a4a,0x5aab5acc,0x31665aab,0x20c31882,0x20c320e4,0x29242904,0x210420e3,0x4a494a49,0x62ec528a,0x526b526b,0x5acc528b,0x5acc630d,0x630d62ed,0x28c44a28,0x5acb3125,0x28a25acb,0x20a120a1,0x20a128c1,0x20801860,0x18401860,0x31023102,0x31231860,0x10201881,0x10202081,0x10401061,
-0x18611061,0x10400000,0x20c21881,0x10400800,0x20621881,0x208220a2,0x18c41020,0x422939c8,0x42294229,0x4a4a4a6a,0x526a4a6a,0x4a2a4a4a,0x4a6b4a4a,0x422a528b,0x20c33146,0x29042904,0x188128c4,0x18c220e3,0x18a31062,0x106220e4,0x29030800,0x31032924,0x28e33124,0x5a6741a5,0x62865204,0x6a876267,0x62665a66,0x52256287,0x5a465205,0x52264a04,0x49e55a46,0x5a265a46,
-0x5a4649e4,0x5a265226,0x418341a4,0x52464a25,0x52255205,0x52464183,0x5a465205,0x52265246,0x73295205,0x734a62a8,0x62875246,0x49c449a4,0x49e55225,0x41c55246,0x41c44a06,0x294239c4,0x39a45267,0x00002943,0x21040000,0x18c30001,0x10610020,0x08210821,0x08610000,0x18a218a2,0x00000000,0x00000000,0x00000000,0x00000000,0x52051860,0x62465205,0x62a87309,0x41a45227,
-0x51e44142,0x6aa76286,0x72e97b29,0x6aa76267,0x6aa772e8,0x62866aa7,0x6a8672c8,0x7b4a838b,0x7b4a6ae8,0x6b096ac8,0x19029cb0,0x00000000,0x00000000,0x10200000,0x08200000,0x08200800,0x08001061,0x30e21840,0x31233101,0x31033102,0x28e03102,0x6ac74983,0x62a76ae8,0x6a876287,0x72c86ac8,0x62666287,0x6aa76ac8,0x72e87b09,0x7ae86a86,0x6a8572c6,0x7b286aa6,0x8b8a8b68,
-0x29442944,0x20e42923,0x41c752aa,0x20e32903,0x29032924,0x29043144,0x31663145,0x4a2a41e7,0x5aab5acc,0x29035a8b,0x10621882,0x292528e4,0x20e43145,0x292520e4,0x528b39a7,0x4a09528a,0x62ec5aac,0x5aec5acc,0x632d62ec,0x5acc5aec,0x28a328e5,0x526920a2,0x208141e7,0x184028a2,0x20a11860,0x29031020,0x206020a1,0x188120e2,0x184020e2,0x18811840,0x18602923,0x28a21020,
-0x20a21861,0x18820800,0x08000820,0x18611040,0x104020c2,0x208220a2,0x31c720a2,0x42293a08,0x424a422a,0x4a4a526b,0x4a2a524a,0x4a4a528b,0x4a2a4a4a,0x424a4a4a,0x28c44209,0x18611882,0x20a128a3,0x20c21861,0x290420c3,0x106218a3,0x31450820,0x312420e3,0x28e328e3,0x4a053123,0x62254141,0x5a2551e4,0x5a264983,0x52256287,0x5a665226,0x41c35205,0x5a465205,0x41a35246,
-0x62874a05,0x5a475224,0x49e53141,0x52265206,0x52255a46,0x49e45245,0x52455245,0x52465205,0x6ac872e9,0x6aa77329,0x5a465a46,0x49e53983,0x4a0549e5,0x49e54a05,0x4a0549c5,0x41833982,0x49c549e5,0x41e65288,0x084118c1,0x108208a3,0x00200861,0x00000000,0x18c30000,0x084118c2,0x20e32104,0x08001841,0x00000000,0x51c449e4,0x628751c4,0x62676266,0x62c86ae9,0x31224a26,
-0x49a33901,0x62465a26,0x7b497b2a,0x6ac76aa7,0x6ac672e8,0x72e76aa6,0x72c751e3,0x834a7b29,0x72e67b28,0x73085a43,0x52677b2a,0x000039c5,0x08210800,0x08000000,0x08001882,0x00000000,0x10200800,0x28e02060,0x28e120a0,0x290128e1,0x30c13101,0x72e872e8,0x72e86aa7,0x6ac872c7,0x72c86aa7,0x5a456aa8,0x7b096ac7,0x72c87ae8,0x836a7308,0x72a672c7,0x72a66a44,0x8b4972c6,
-0x29243185,0x29452103,0x39865aeb,0x31442904,0x29243144,0x31652904,0x314539a6,0x10833145,0x5aac41e8,0x1882524a,0x18821882,0x29041882,0x18c32904,0x292520c3,0x41e82945,0x20c45aab,0x6b2d4a2a,0x5acc5aec,0x632d5aec,0x528b5acc,0x28a320a4,0x10611060,0x20a12082,0x28c228e3,0x20a120a1,0x10810800,0x20e21880,0x20e21040,0x20a128e2,0x31231861,0x20811040,0x186020a1,
-0x188120e2,0x00000800,0x08201020,0x08001040,0x20c21040,0x18411861,0x42091041,0x526a528b,0x42094a0a,0x526a4a29,0x4a2a4a29,0x4a2a4209,0x4a4a4a4a,0x52ac422a,0x188339a8,0x18811882,0x28a21000,0x186120a2,0x20e318c2,0x290418a2,0x18c220c2,0x29242924,0x290320c2,0x41a43103,0x62674162,0x5a265a25,0x5a054162,0x5a666267,0x52055205,0x312049e5,0x5a465225,0x52465a46,
-0x52465246,0x52065a65,0x52053120,0x62a849e6,0x62a75a46,0x52255246,0x52255a46,0x52055226,0x52055206,0x5a255205,0x49e55205,0x49e449e5,0x52255a46,0x49e549e5,0x49e55a67,0x20a05205,0x52065226,0x41e55226,0x39845226,0x210418c2,0x00201082,0x00000000,0x00000000,0x00000020,0x00000020,0x00000000,0x6ae91060,0x49a45a66,0x6aa751e4,0x628751c4,0x5a87734a,0x39835247,
-0x6aa730e1,0x62876aa7,0x7b2972e9,0x6aa772e8,0x7b097b09,0x72c86266,0x72c76a66,0x7b296ac7,0x62456aa7,0x6ac75a24,0x5a667308,0x52675a87,0x00004a26,0x08000000,0x08001881,0x00000800,0x18800820,0x31022880,0x396328c1,0x31223943,0x49833922,0x6aa751c4,0x6aa77308,0x6aa75203,0x6ac86267,0x62866287,0x72c86ac7,0x628672e7,0x834a8b8b,0x7ac77b08,0x83287ae7,0x8bab8bab,
-0x29242924,0x420820e3,0x39865acb,0x29043144,0x29242904,0x31453165,0x29043165,0x314620e4,0x5a8b4209,0x20a239a7,0x18821882,0x20c31882,0x21042924,0x21042945,0x20e42925,0x20e44a29,0x6b0d2105,0x5acc5acc,0x5acc630d,0x630d528b,0x1062524a,0x10200860,0x18601821,0x28c220a1,0x102020a1,0x4a681081,0x20e118c1,0x20c220a1,0x18601881,0x29031020,0x18401881,0x10002081,
-0x10201881,0x10810800,0x00001040,0x00000000,0x18611061,0x20622903,0x41c81882,0x524a524a,0x4a0a4a2a,0x4a09526a,0x4a2a4209,0x4a2a526a,0x4a4a4a2a,0x52cc39e9,0x28e45aac,0x18a120a2,0x28c22082,0x28e320c2,0x20e21881,0x20e318a1,0x104020e1,0x31243145,0x31442903,0x41a428e2,0x520641a4,0x49a349a4,0x5a2551c3,0x52465226,0x49e45a46,0x41c35205,0x49e541c4,0x52255a66,
-0x4a056287,0x41a549e3,0x41a420a0,0x49e55a67,0x52466287,0x52465225,0x52055a66,0x49c45226,0x5a266aa8,0x5a465a46,0x49e549e4,0x4a0549c4,0x52054a05,0x49e55205,0x39633963,0x396028e2,0x49c53943,0x520549e5,0x39a43962,0x29454a26,0x08410000,0x00000020,0x00000000,0x08400000,0x08400000,0x20810841,0x59e561e5,0x51e55226,0x49a36a87,0x62465205,0x5a8762a8,0x39625268,
-0x628751c4,0x52055a25,0x6aa75a25,0x62865a25,0x72e96ac7,0x834a834a,0x72c772c7,0x836a6266,0x7b087b4a,0x6ae87b29,0x72e86ae7,0x6b0962a7,0x52484a25,0x10403144,0x4a061880,0x080039a5,0x18601880,0x184028a0,0x18400800,0x41c43963,0x49634163,0x6ac74182,0x72e872e8,0x72e86285,0x7b097b29,0x62655a46,0x72e972e7,0x72e86a86,0x7b297308,0x830872c7,0x93cb8bab,0x8bab8bcb,
-0x29242924,0x62eb20e3,0x28e562cc,0x20e43145,0x18a220e4,0x31452904,0x39c73986,0x39e83166,0x42295acc,0x20e32925,0x18a220c3,0x18c320e3,0x29242103,0x20e32924,0x18a31061,0x18833986,0x5acb20a3,0x630d62ec,0x5acc62ec,0x5aec5acc,0x39c7528b,0x18c20861,0x20e21882,0x18802903,0x18a12903,0x528920c2,0x29654a89,0x20e218a1,0x20a118c1,0x080020a1,0x184020c2,0x20a128e3,
-0x104028e3,0x00200800,0x08000800,0x18610800,0x18821861,0x18621041,0x20a420a3,0x522a522a,0x49e9524a,0x522a522a,0x31254187,0x4a0a4229,0x4a4a41e9,0x4a4a4a4a,0x10624a4a,0x000018c3,0x18811041,0x20c21881,0x20a21861,0x20e228e3,0x18a10820,0x31242924,0x31443124,0x29232903,0x39434164,0x390238e2,0x5a265205,0x52055226,0x52265225,0x522549e4,0x49e549e5,0x5a2649c4,
-0x520551e5,0x52055205,0x39633142,0x4a0549c4,0x52055246,0x5a465225,0x5a4662a7,0x49c45225,0x51e55a46,0x5a465205,0x5a4649e5,0x52265a67,0x5a464a05,0x524749e4,0x314149e5,0x52065a47,0x39625205,0x418441a4,0x394341c4,0x31643943,0x00001081,0x00000000,0x10820020,0x20e31061,0x10200000,0x5a4649c5,0x41835a26,0x5a265a46,0x62676ac8,0x51e45205,0x5a6862c9,0x41c341e5,
-0x6ac87309,0x6aa76287,0x7b297308,0x62456266,0x62665a24,0x72e86246,0x6ac76ac7,0x730872e8,0x6ac76aa7,0x73087308,0x7b697308,0x5a876b08,0x5a8862a7,0x49a449e6,0x5a6749c3,0x310449c4,0x18401860,0x398420c1,0x28c01841,0x49a43922,0x310149c4,0x6ac649a3,0x72e972c8,0x72e872c8,0x6aa872e9,0x6aa772e9,0x72e86286,0x72c76aa7,0x72c772e7,0x83497b29,0x83498b8a,0x7b088349,
-0x31443144,0x6b2c62eb,0x39666b2d,0x526a20c3,0x20e34a29,0x20e31881,0x41c83166,0x31464a09,0x20c42905,0x20e42904,0x18a22924,0x18c22103,0x20c241e7,0x18c218c2,0x20c31081,0x28e320c3,0x5aca28e3,0x736e630d,0x5acc738f,0x5aec52ab,0x528b52ab,0x19032104,0x188110a2,0x18811860,0x08402102,0x42281881,0x52ab52ab,0x18a220e3,0x20c11882,0x080028e2,0x10201860,0x08002081,
-0x28e31881,0x00001020,0x00000000,0x20a20000,0x10411882,0x188220a2,0x28a320c3,0x31041841,0x310430e4,0x10001841,0x18421801,0x41e949c8,0x422a4209,0x4a4b39c8,0x20e64a4a,0x18a31063,0x10401021,0x188120e3,0x18611881,0x10401861,0x39850820,0x31242923,0x312420c2,0x29033144,0x418530e3,0x416430e3,0x5a4649a4,0x49c45205,0x52264a04,0x52254a05,0x49e449e5,0x51e43921,
-0x62875226,0x52255205,0x39623962,0x398328e1,0x5a255205,0x52055225,0x5a676287,0x52055226,0x49c451e5,0x51e549a4,0x5a6741a4,0x41c45226,0x4a0549e5,0x49e45205,0x398128e0,0x52275a47,0x4a064a05,0x28e028c0,0x41a43142,0x41c441c4,0x39c741a5,0x00000000,0x00000841,0x08000800,0x498349c4,0x5a6749a4,0x51e56287,0x5a263961,0x6ae96287,0x49e562a8,0x41e662c9,0x59e53102,
-0x72e97309,0x62466aa8,0x6aa76aa7,0x6aa66a87,0x5a456a66,0x6aa76266,0x72c872e8,0x6ac7838a,0x62866a86,0x6aa76aa7,0x62666aa7,0x72c86aa7,0x6aa872e9,0x51c36a87,0x524451e4,0x52265245,0x00000000,0x08001080,0x394228c1,0x41833922,0x394249a4,0x62654162,0x730972e8,0x62666ac7,0x836a6aa7,0x6ac76ac8,0x72e872c8,0x6aa77ae8,0x7b0872e8,0x7b087b28,0x72e87b28,0x83697b29,
-0x62eb3165,0x734e736f,0x62cc6b0d,0x5a8b4187,0x18622945,0x18a320a3,0x5acb3186,0x310562cb,0x20631822,0x20a320a3,0x210320e3,0x20c218a2,0x20e32924,0x20e320c3,0x10811081,0x18822103,0x41c720c3,0x62eb528a,0x5aac630d,0x5acc526b,0x5acc5a8b,0x4a8b4a6a,0x21244229,0x18a12923,0x188120e2,0x10600820,0x5acb5289,0x4208528a,0x29244a49,0x00001040,0x28c220a1,0x18401840,
-0x20c428e3,0x00001881,0x00000000,0x08000000,0x00001882,0x20e420e4,0x18a320e4,0x18201021,0x208220a2,0x10211882,0x00001041,0x41c80800,0x422a4a09,0x4a6b52ac,0x18c44a2a,0x18a40842,0x08210001,0x10410820,0x18a11861,0x08201881,0x29242103,0x29042923,0x28e33124,0x396528e3,0x28e23143,0x31033124,0x41633102,0x52265205,0x52055a66,0x4a0549e5,0x41c449e5,0x522641c4,
-0x49e55205,0x39624162,0x39a43963,0x290020e1,0x522541e4,0x52045205,0x5a475a66,0x5a675246,0x4a055205,0x52055205,0x52055226,0x522651e5,0x520549e4,0x5a475226,0x41a35205,0x41c45226,0x49c549c5,0x4a0641c5,0x51e42901,0x41e439a4,0x21003163,0x31650000,0x08200820,0x41230800,0x52054143,0x62a85a67,0x52056287,0x6ac86287,0x5aa762a8,0x39a35267,0x20e13143,0x6a8741a3,
-0x62666ac8,0x72e85205,0x6aa76ac7,0x6aa76a86,0x6a877308,0x72c872e8,0x7b086aa7,0x834a72e8,0x72e87b09,0x6ac772c8,0x6ac772c8,0x6aa86266,0x62867309,0x52255204,0x49c25204,0x398249e4,0x104028c1,0x10000820,0x39422060,0x39424183,0x31014163,0x51c33941,0x7b0972e9,0x6ac77308,0x6aa77308,0x6ac76266,0x7b0972e8,0x72c772e8,0x83498349,0x7b288b8a,0x83498329,0x8b6a7b28,
-0x62cc41e8,0x6b0d6b2e,0x62ec734e,0x20a33105,0x18c418c3,0x294518c3,0x4a692105,0x392662cb,0x30e51001,0x18622904,0x20e320c2,0x20e320c3,0x20e318a2,0x20e318a2,0x10611081,0x18a320e3,0x18a31062,0x41c72904,0x526b5a8b,0x526b5aab,0x5acc526b,0x52ab5acc,0x4a8b4a8b,0x18a23187,0x318610a2,0x10612104,0x4a0820c3,0x528a4a6a,0x4a49528a,0x08001882,0x28c220a1,0x18201860,
-0x4a081861,0x10613985,0x08001882,0x00000800,0x00000000,0x188218a3,0x10a31882,0x000020e4,0x00000800,0x082018a2,0x00000000,0x00010000,0x39e94209,0x528b4a4a,0x082241c9,0x08221063,0x10620021,0x08201881,0x080020c2,0x20e21040,0x29232103,0x18613985,0x28e33124,0x29242903,0x29233123,0x31022903,0x394428c2,0x41c45a47,0x41a449e5,0x41a341a4,0x52255226,0x41c449e5,
-0x41833101,0x31013941,0x31633122,0x39833122,0x49e45267,0x49c35a46,0x51e549a3,0x49e45a46,0x524649e5,0x49c45a46,0x49c449c4,0x520549c4,0x52464a05,0x49e649c4,0x52255206,0x4a055226,0x418449c5,0x41c44a05,0x39a33963,0x398339a4,0x28e13163,0x29221060,0x4a054183,0x522641a4,0x6ae96287,0x5a465a67,0x5a465205,0x73097329,0x62c86ae8,0x52465267,0x20e12902,0x5a263901,
-0x62466aa7,0x5a456aa8,0x6aa76aa7,0x7b4972e8,0x6ac76ac7,0x6aa772e8,0x6aa77b29,0x6a876aa7,0x7b497b09,0x62866266,0x6ac772e8,0x62656266,0x62866aa6,0x62866286,0x52256287,0x52255a66,0x5aa85205,0x10403163,0x18401000,0x39633922,0x31015226,0x49a23921,0x62877b29,0x72e86266,0x6aa772c8,0x72e86aa7,0x72c86aa7,0x5a2572c8,0x7b297ae8,0x83497b29,0x836a8329,0x7b298349,
-0x4a293145,0x632d630c,0x6b2d62ec,0x292618c4,0x10a31083,0x31a62105,0x4a8b2946,0x39675aab,0x5a6b5a8b,0x28e32905,0x18c32945,0x210320e3,0x18c320e3,0x21032103,0x18e310a2,0x18c318c3,0x08421082,0x29041041,0x62cc5249,0x528b5aac,0x528b526b,0x4a4a5aab,0x52ab528b,0x29874229,0x42294a29,0x31874a4a,0x18610000,0x52295209,0x4a4a52ab,0x18201883,0x18601840,0x20a120a1,
-0x526920a1,0x20a22903,0x08201061,0x00000800,0x00000000,0x00211063,0x18830841,0x106218a3,0x08610000,0x00000020,0x00000000,0x10210000,0x39c739c7,0x522a4a6a,0x108320a4,0x00221083,0x20e30001,0x106120e2,0x188120e3,0x29440820,0x18a22923,0x20c22903,0x31242903,0x29032903,0x31242924,0x29033144,0x28e12901,0x41c44162,0x41a441a4,0x4a053963,0x52664a05,0x41a441a4,
-0x392230c1,0x5a8549a4,0x314228e0,0x4a052901,0x5a665266,0x20c05205,0x5a4628e1,0x52055a46,0x52255a67,0x5a465205,0x49a34183,0x52054163,0x49c449e5,0x4a2541c4,0x39414a05,0x49c54162,0x41c44a05,0x41c441e5,0x29413183,0x29833184,0x18e120e1,0x5a471000,0x62686288,0x62a76266,0x628762a7,0x5a8662a7,0x5a465a66,0x6ae86ac8,0x62c962a7,0x4a265aa8,0x206041a4,0x72c86246,
-0x72e85a25,0x5a4572e9,0x72e872c7,0x730872c8,0x7b2972e8,0x72e872e8,0x6a867b09,0x6ac772c7,0x6ac76aa7,0x62866aa7,0x6aa76ac7,0x62457308,0x6a876ac7,0x72e86286,0x51e45204,0x52256266,0x4a055a66,0x394241a3,0x080020a0,0x39633982,0x41634163,0x414028a0,0x6aa86225,0x62866266,0x7b096a87,0x72a772e8,0x7ae872e7,0x6a6672c7,0x72e77b08,0x7b288349,0x7b297b28,0x83698369,
-0x31653165,0x41e73165,0x29253166,0x29250862,0x18a32926,0x29452946,0x5aec2987,0x6b2e5acc,0x62ed734e,0x29043146,0x28e32924,0x29442924,0x31852945,0x18a218c3,0x10a218a2,0x4a292104,0x29254a49,0x18c320e4,0x418728c3,0x4a4a4a2a,0x5a8b528b,0x4a6a526b,0x6b6e528b,0x4a8b5b0d,0x5acc5acc,0x528b4a6a,0x10621082,0x49e820a4,0x526a528a,0x208220c4,0x10000800,0x10002081,
-0x20a21820,0x20a21020,0x20e31040,0x00000800,0x00000000,0x00000001,0x00420862,0x00220000,0x08620041,0x00000041,0x00000000,0x10420041,0x41c830e5,0x49e9420a,0x084220c4,0x29461084,0x00000001,0x10400820,0x106120e3,0x108120e3,0x18c218a1,0x39852923,0x290320a2,0x28e32924,0x31243124,0x29033124,0x18603143,0x4a053922,0x49c45205,0x4a0549c4,0x52465226,0x310249c5,
-0x20a02901,0x520351c5,0x39833122,0x4a263163,0x52255267,0x4a0528e0,0x5a8749c4,0x5a465206,0x49e54a05,0x41a451e5,0x39013922,0x49c428c0,0x52055226,0x4a0541a4,0x392041c4,0x51e649e4,0x41e541e5,0x39c439a3,0x29023163,0x21012942,0x208028c1,0x49c551e5,0x6aa872e9,0x72e872e8,0x62a76ac8,0x6ac86ae8,0x62875a66,0x62c86287,0x62e86b08,0x52675aa8,0x62873122,0x73096246,
-0x6aa75a26,0x5a257309,0x6aa75a25,0x6aa772c7,0x8bcb72e8,0x6ac772e8,0x6ac772e8,0x72c86aa7,0x7b097308,0x62867b09,0x72c76ac7,0x72c87308,0x6aa77308,0x6a875a45,0x628662a7,0x62876aa7,0x52056267,0x52265225,0x41a541c4,0x28c01880,0x310128e0,0x39204141,0x6a8659e3,0x6a876a87,0x72e872e8,0x62456aa7,0x72a76aa6,0x6a8672a6,0x6aa67b08,0x7b288b8a,0x836a7ae8,0x83497b29,
-0x29233164,0x29242903,0x29053146,0x31a70842,0x210510a3,0x298618e4,0x632d4229,0x736f630d,0x5aac6b2e,0x39863947,0x314520a2,0x292420e3,0x21032924,0x18c320e3,0x18e32103,0x528a2124,0x4208526a,0x10a218e3,0x39e80020,0x31874a2a,0x526b4209,0x5aab4a4a,0x630d52ab,0x630d738f,0x42295acc,0x4a6a4a6a,0x212531a7,0x39a71842,0x524a526a,0x104162cc,0x10000000,0x18411861,
-0x08001800,0x104020c2,0x10400000,0x00000800,0x00000000,0x00011063,0x00010021,0x18e50001,0x31e81925,0x29873a29,0x110410c4,0x18a32146,0x186228a4,0x4a2a1043,0x10a441a8,0x10a40022,0x00001063,0x000018a2,0x18810000,0x29441081,0x29242924,0x31243164,0x39653965,0x29032903,0x29032903,0x28e328e3,0x28e23144,0x41a44184,0x522649e5,0x39a33963,0x39a341e4,0x28e149e5,
-0x21012942,0x31004142,0x316328e0,0x18a02922,0x62a75246,0x5a875225,0x49c449e5,0x52065206,0x41a441c4,0x30e15226,0x414228c0,0x49c44162,0x49e551e5,0x318349c4,0x30e03983,0x49c551e4,0x41e54a05,0x31834a05,0x314441e5,0x18802921,0x30811000,0x52466aa8,0x52045205,0x62876266,0x6ac86287,0x62c76ac8,0x6ac86287,0x5a666287,0x4a245a46,0x20e039a3,0x6ac749e4,0x624672e9,
-0x940d6aa7,0x7b096287,0x6a876ac7,0x5a256266,0x62667308,0x6aa76ac7,0x6aa76aa7,0x6aa76246,0x624672e8,0x5a256ac7,0x62666266,0x72e86a87,0x6aa76a87,0x72c76aa7,0x73087b49,0x62876aa7,0x5a256246,0x52256a87,0x49e55a46,0x626641c3,0x41627308,0x41403920,0x626538e0,0x5a046ac7,0x5a255a05,0x72a751e4,0x7b0972c7,0x72a76a85,0x5a2572e8,0x72c772c7,0x7b286aa7,0x7ae87b28,
-0x4a0741c6,0x31453165,0x18a33167,0x18e40001,0x212518e4,0x212510c3,0x7bd04229,0x6b0d8c11,0x41676aed,0x52692083,0x31253125,0x314539a6,0x20c320c3,0x29243145,0x29042903,0x528a2924,0x420852ab,0x10c241e7,0x3a081904,0x296641e8,0x4a6a4a2a,0x524a4a4a,0x62ed5a8b,0x6b6e6b6e,0x4a4a5acc,0x526a528b,0x52cc4a8b,0x31674a6a,0x5aac522a,0x4a4a526a,0x000010a2,0x00000000,
-0x20611840,0x18811000,0x18811041,0x000020e3,0x00000820,0x08420001,0x31c82125,0x42294209,0x42094229,0x4a4a3a08,0x4209422a,0x31a7422a,0x10211062,0x4a093987,0x08224209,0x08210001,0x08000800,0x00001040,0x18c22903,0x20e320c2,0x29242904,0x29042923,0x292420e3,0x290420e3,0x29032903,0x398520c1,0x31433965,0x52052901,0x49e55205,0x41a44183,0x49c53963,0x39434184,
-0x18a03142,0x31423101,0x39a43963,0x28e139a4,0x522649e4,0x52255a26,0x4a055205,0x49e54163,0x49e541a4,0x41844a05,0x418449c5,0x52264184,0x41c55226,0x4a2641c5,0x310141c5,0x49c44183,0x520649c5,0x39843983,0x29223143,0x104020a1,0x31011000,0x6a875a06,0x5a055a25,0x5a2551c3,0x5a455a66,0x6aa76286,0x73096aa7,0x73296ac8,0x5a676287,0x39615204,0x62876266,0x5a265206,
-0x628749a3,0x626662a7,0x7b4a6246,0x6aa76aa7,0x6aa76aa7,0x62866266,0x72e872e8,0x7b2972c7,0x6ae87b29,0x62667b29,0x6ac76aa7,0x6aa76266,0x72e86a87,0x62866ac7,0x62866ac7,0x6ac76246,0x62666aa7,0x5a666266,0x52046aa7,0x6aa76266,0x5a053942,0x31001820,0x626649a3,0x49a349a4,0x624551c3,0x5a045a25,0x6aa76266,0x6ac77b09,0x6ac772e8,0x628672e7,0x7b297ae8,0x7b287b29,
-0x31243144,0x39872944,0x29263166,0x294618c4,0x10a318e4,0x21461905,0x8431630d,0x7b2e8c11,0x286351e9,0x62eb49c9,0x29453186,0x31453166,0x31652904,0x39a63145,0x41a73985,0x632d5aab,0x4229632d,0x00422925,0x29861904,0x4a6a4229,0x4a4a4229,0x4a4a4a4a,0x5acc5aac,0x630d62ec,0x5acc52ab,0x4a6a528b,0x630d52ab,0x5aac5aec,0x526b522a,0x4a4b526a,0x39e64229,0x00000840,
-0x18810800,0x20a22081,0x18a218a2,0x10820820,0x00000000,0x4a6a31a7,0x4a094a4a,0x4a2a4a2a,0x41c84a29,0x4a0941c8,0x422a4a4a,0x422a424a,0x19041882,0x4a4a41e9,0x00023187,0x10821063,0x08200800,0x20e20800,0x29032903,0x29043164,0x20e220c3,0x314420c2,0x29243145,0x20e32924,0x18812903,0x41c63164,0x20e23964,0x41832901,0x39834a05,0x52265227,0x41a44184,0x396349c5,
-0x29223142,0x41a43143,0x41e54a06,0x310139a4,0x52055225,0x5a675205,0x398349e5,0x41833101,0x49c55206,0x39433963,0x416341a4,0x49c549c5,0x49e549e5,0x39c541c4,0x20a020e1,0x41a44163,0x41a449e5,0x39a439a4,0x20a13143,0x10202902,0x28a01840,0x520549a4,0x62666a87,0x72c86267,0x62867308,0x5a666ac7,0x62876286,0x6ae86287,0x62886ae8,0x39626ae8,0x52065205,0x5a465a26,
-0x49c449e4,0x624662a7,0x62876aa7,0x62867309,0x72c86286,0x624672c8,0x62666266,0x7b2972c8,0x72e86266,0x62867309,0x62666266,0x6aa76246,0x62456266,0x5a246ac7,0x6aa76286,0x62866266,0x6ac76ac7,0x5a666aa7,0x6ac75a46,0x52046266,0x416151e3,0x28e03942,0x30c028c0,0x49c34163,0x49824982,0x6aa64982,0x626672c7,0x624672e8,0x72e872c8,0x6ac76ac7,0x7b2872e8,0x72e772e8,
-0x29043165,0x294639a6,0x31673146,0x212518c4,0x18e42966,0x424a2105,0x632d634d,0x6b0d6b2d,0x20643988,0x62cc5209,0x31863186,0x29243165,0x31663165,0x5acc4229,0x5a8b5acc,0x6b4d62ed,0x4a295acb,0x39c73166,0x31c731c7,0x52ab4208,0x42295aec,0x4229526a,0x5aab630d,0x526a62ec,0x5aec5acc,0x4a6a52ab,0x6b4f5aed,0x52ac630d,0x524a2106,0x526b4a4a,0x31874a2a,0x18611061,
-0x08000800,0x18821061,0x18a220c3,0x00000000,0x00000000,0x42294229,0x28e64a2a,0x49e928e5,0x28c341a8,0x20a41821,0x422941e9,0x420a3a09,0x002139c8,0x4a0941c8,0x10431863,0x10410802,0x08000820,0x316510a1,0x29033144,0x20e32924,0x290320e3,0x31442903,0x29242924,0x314518c2,0x20c228e3,0x29033123,0x20803123,0x49a428e2,0x39424184,0x41a44163,0x39634184,0x41c44a05,
-0x39833163,0x39833943,0x49c55206,0x394249e5,0x5a2641a3,0x52063922,0x41a449e5,0x312220a0,0x39633943,0x418341a4,0x28e14183,0x39633962,0x41c441a4,0x42064a05,0x28c039a4,0x49c63142,0x39a43163,0x39643984,0x108041a5,0x00000820,0x206020a1,0x49833922,0x62256266,0x72e86aa7,0x72e86aa7,0x62a76ae8,0x62866286,0x73296286,0x83ec7b4a,0x7b8b736a,0x39425246,0x5a466ac9,
-0x52055a26,0x5a254183,0x62665a25,0x6aa77b29,0x6aa76aa7,0x5a4572e8,0x6aa76aa7,0x62877b4a,0x72c86aa7,0x6aa76aa7,0x6ae86aa7,0x6a877309,0x72e872e8,0x72e872c7,0x72e86aa7,0x5a456aa7,0x5a246286,0x62875a24,0x5a456a87,0x49a46ac8,0x08003120,0x29001020,0x39833963,0x418230c0,0x39414162,0x6aa751c3,0x62646aa6,0x72c872e8,0x7b496ac7,0x628672e8,0x72c76a86,0x72a66a87,
-0x31653144,0x316639a6,0x31663166,0x21252105,0x10a32125,0x21252125,0x636e5aec,0x632d6b2d,0x20a339a7,0x39a73125,0x20e43145,0x29452925,0x31862925,0x630d4209,0x41e952ab,0x4a0941e8,0x29053125,0x41c84187,0x39c8526a,0x5acb4229,0x528b52ab,0x528b4a4a,0x5acc5acc,0x526b526a,0x630d4209,0x5aec52ab,0x6b4e630d,0x5a6b734f,0x314641c9,0x4a6b4229,0x39c84209,0x10000800,
-0x10200800,0x08200800,0x10610820,0x10610800,0x21250000,0x42094229,0x100141c8,0x10011001,0x20411000,0x08001000,0x31661022,0x4a4a4a29,0x42094a4a,0x292541e9,0x080118a4,0x08000821,0x00001040,0x20e22944,0x29033144,0x29042103,0x292320c3,0x29442923,0x29232903,0x18a22924,0x31242903,0x31442903,0x39433102,0x49c53964,0x416349e5,0x31224163,0x396341a4,0x526641e4,
-0x41e541e5,0x41a43963,0x312241a4,0x31223122,0x394220a0,0x39634183,0x31223963,0x29021860,0x31023122,0x41833122,0x28e220a0,0x31223964,0x49e53122,0x39a539a4,0x31013984,0x41844184,0x20e118a0,0x31632102,0x00002122,0x00000020,0x30c00800,0x5a063922,0x6aa759e4,0x5a456aa7,0x6ac76ac7,0x6ac76286,0x62667b49,0x6ac86aa7,0x62e86ac8,0x4a2562c8,0x39833963,0x52066288,
-0x49c44183,0x626662a8,0x6ae872e8,0x72c87309,0x6a876ac7,0x6a875a04,0x6ac87b09,0x62876287,0x5a056aa8,0x6aa76aa7,0x62a76ac7,0x6aa76ac8,0x730872c8,0x7b297b29,0x62667b29,0x6aa76a86,0x626551e3,0x6aa86266,0x62666aa8,0x49845a47,0x102049e4,0x290020a0,0x31213120,0x41623101,0x418249a2,0x6aa75a24,0x6aa66265,0x73087b29,0x6a866aa7,0x5a246265,0x62656a86,0x72c77b09,
-0x31653985,0x39663166,0x4a6a20a3,0x29254a4a,0x20e42105,0x21041083,0x526a2945,0x528a5acb,0x21042925,0x10411882,0x39c70000,0x4a6a4a6a,0x5acb4208,0x49e9528b,0x31663146,0x4a492946,0x4a6a4a6a,0x52492924,0x41c741e7,0x526a39c7,0x528b4a49,0x528b4229,0x5acc4a4a,0x4a2a528b,0x62ed4a09,0x5aac5a8b,0x62ec5aab,0x5a6b5aac,0x080028c3,0x4a6a4a0a,0x42094a29,0x00001062,
-0x28c20800,0x08201020,0x000020e3,0x00410000,0x42082987,0x30e54a29,0x08411001,0x08410841,0x18411841,0x00001020,0x08000000,0x39872083,0x41e94a2a,0x186341e8,0x082018c3,0x18c218a2,0x20e30000,0x31642103,0x28e32924,0x290330e3,0x20c220e3,0x292420e3,0x31442903,0x20e320c3,0x20c23124,0x316420e2,0x31233123,0x49c53964,0x39633983,0x49e549c5,0x49e541a4,0x52464a05,
-0x626751e5,0x39425205,0x28e13942,0x29013101,0x39432921,0x49a53963,0x31633944,0x20e220c1,0x394320a0,0x41c541a4,0x18a03163,0x31423142,0x41a43122,0x20e120c0,0x20e118a0,0x208020c0,0x20e220c1,0x18c23164,0x21220000,0x000020e2,0x28810000,0x5a264162,0x62455a46,0x6a876aa7,0x6aa76286,0x6ac87309,0x6ae86ae8,0x7b2972e8,0x7b6a72e8,0x4a465aa8,0x31203162,0x49c36b0b,
-0x52055205,0x522549a4,0x62667309,0x5a456286,0x6ae85a66,0x730972e8,0x6ac86287,0x5a255a66,0x72c86a87,0x6a8772e9,0x6ac772e8,0x62666ac7,0x834a6286,0x72c76ac7,0x72e872e8,0x62866286,0x72c87308,0x5a666ac7,0x62875204,0x41a45a25,0x520541a4,0x394228e1,0x41623100,0x5a465a46,0x62665225,0x49c35a46,0x73086265,0x7b297b49,0x73086ac7,0x62656aa7,0x6aa76a86,0x62456aa7,
-0x39a639a6,0x39a641c7,0x4a492925,0x29464a4a,0x4a4a2946,0x31864a6a,0x21252945,0x21042125,0x20e320e3,0x210318a2,0x42082945,0x630c630c,0x6b2d5aec,0x5a8b738e,0x29052925,0x31a73166,0x5acb5aab,0x41e83145,0x39863986,0x31652945,0x42294a28,0x5acc4229,0x526a528b,0x526a4a2a,0x528b526a,0x528b526a,0x526a5aac,0x208362ac,0x18412883,0x42094a29,0x4a094229,0x00000841,
-0x20e20820,0x29440800,0x106139c7,0x08820820,0x4229422a,0x08003987,0x00001883,0x00000000,0x10200800,0x08201041,0x08000000,0x10631001,0x314620e5,0x20a428e5,0x08400841,0x00001081,0x18c22103,0x292418c2,0x18812923,0x290328c3,0x18c228e3,0x31442944,0x29033164,0x314420c2,0x29033144,0x29233164,0x312328c2,0x39433123,0x41c43963,0x52065206,0x41a449c5,0x49e55205,
-0x52055a46,0x49c449e5,0x28e13122,0x41c53142,0x39434a06,0x416449c5,0x316441a5,0x29023164,0x49e528e1,0x314241c4,0x20e12901,0x39841860,0x39a528e1,0x18a03122,0x398320e1,0x290141a5,0x31631060,0x316418c1,0x212218c2,0x00000000,0x18000000,0x5a2730e1,0x62666246,0x62666a87,0x6a866286,0x732962a7,0x72e86ac8,0x62a76ac8,0x62a77309,0x526762a8,0x290041c3,0x730a62c9,
-0x5a4662a7,0x62876ae8,0x62666287,0x73297b09,0x5a4662a7,0x73097309,0x6ac862a7,0x6aa8838b,0x62876aa7,0x6aa772e8,0x624572c8,0x72c86aa7,0x7b096ac7,0x5a457b29,0x62866286,0x62465a45,0x72e87308,0x62666aa7,0x5a256286,0x49c449c4,0x41a341a4,0x20a01040,0x6aa849c4,0x6ac862a7,0x72e97b2b,0x72c86ae9,0x72e872e8,0x7b29836a,0x730872e8,0x62656266,0x6a866265,0x5a2472a8,
-0x21032924,0x29642944,0x29672925,0x29462947,0x29463166,0x31862125,0x18c32945,0x18c32965,0x20e42104,0x4a492945,0x4a4a4a6a,0x630d526b,0x62ec526a,0x398741e8,0x396649e8,0x39c72905,0x52ab5aec,0x20c42925,0x31253145,0x29452124,0x4a2939c7,0x4a494249,0x5aac5acc,0x4a2a526b,0x4a6a4a2a,0x524a526b,0x62ec5a8b,0x10215a8b,0x18812082,0x4a2920c2,0x42294209,0x00000001,
-0x18811062,0x20a20000,0x10412082,0x39e818a2,0x4a0941e9,0x18820800,0x08200820,0x08410000,0x100018c3,0x08400800,0x00000800,0x00000800,0x20a40021,0x18411822,0x106118a3,0x21022103,0x290320c2,0x28e320c2,0x290320e2,0x28e32923,0x18a128e3,0x29232923,0x20e22903,0x398520e3,0x20a120c2,0x29233965,0x316420e2,0x28c14165,0x41e549e5,0x398539a4,0x20e041c5,0x41833142,
-0x41a349a4,0x49a449c4,0x290149a4,0x41a441e5,0x39434183,0x41c53102,0x29023122,0x39632922,0x41623922,0x20e12080,0x314231a3,0x31233163,0x39853964,0x31423143,0x41843142,0x318339a4,0x41e52101,0x18c03183,0x20e20000,0x00000000,0x18000000,0x62a738e2,0x62666246,0x6a866aa7,0x6ac86287,0x62866285,0x6ae87309,0x6ae872e8,0x6ae86aa7,0x52876b09,0x41a541a4,0x72e86288,
-0x6ac862a7,0x62876ac8,0x6ac76aa7,0x7b4a6ac7,0x7b2962a7,0x6ac86aa7,0x628772e8,0x72c86287,0x5a466287,0x6aa76287,0x62676266,0x6aa77b2a,0x72e872c7,0x6aa76aa7,0x73086a87,0x72e872c8,0x6aa76aa7,0x62865a45,0x5a255a45,0x52255205,0x39425246,0x398228c0,0x20405a26,0x6a676226,0x6ac86aa7,0x72e872c8,0x72e77308,0x7b0972e9,0x72c86aa8,0x5a456286,0x72c86aa7,0x6ac77b29,
-0x29233144,0x39853164,0x10622903,0x20e42104,0x29662105,0x31862925,0x21042945,0x18a32104,0x39e81082,0x52ab4a49,0x4a2939c8,0x5aac4a09,0x524a526a,0x524a4a29,0x18a33987,0x420928e4,0x2925528a,0x5a8b2925,0x3146524a,0x20e42925,0x31452904,0x31a73a08,0x5aac528a,0x5a8b524a,0x4a294a29,0x524a4a4a,0x526b526b,0x18a3526a,0x18a11000,0x39c71020,0x42094209,0x39e839e8,
-0x10200000,0x08000000,0x10400800,0x42290861,0x41c84209,0x00000800,0x31860000,0x00000000,0x08000000,0x00000800,0x10820000,0x00001082,0x20e40021,0x080020c3,0x00000800,0x210220e3,0x20c220c2,0x18811060,0x20c218a2,0x396618c2,0x20e22904,0x292420e3,0x29032924,0x31442924,0x290328e2,0x41c63964,0x39642102,0x28c13944,0x39a43122,0x39643163,0x31413163,0x394349c5,
-0x396241a4,0x520549a4,0x39a45205,0x312139a4,0x41a43962,0x29013142,0x20c020e1,0x310239a4,0x39411860,0x290028c0,0x31223983,0x39642901,0x20a128e2,0x28c120a0,0x41843963,0x292241e5,0x294218c0,0x29221080,0x18c01080,0x00002102,0x18000020,0x59e43881,0x62866267,0x6aa76a87,0x6ac86287,0x62876286,0x6ac86ac9,0x6ac87309,0x73296ae8,0x528762e9,0x5a484184,0x5a253943,
-0x6ac86287,0x5a466ac8,0x6ae86ac8,0x6ac86ac7,0x6aa75a46,0x52255a26,0x62666ae8,0x6a8751c4,0x62876287,0x62666287,0x6a875a25,0x628672e8,0x5a456aa7,0x6aa76246,0x6ac76266,0x62667b29,0x72c76ac7,0x5a456aa7,0x520451e4,0x4a055a46,0x186041a3,0x41833983,0x28a03942,0x622551a3,0x6a876267,0x7b4972e9,0x6aa66aa7,0x72e972c8,0x72e86ac8,0x62666286,0x6aa76aa7,0x72e872e8,
-0x21022922,0x28e12902,0x31443102,0x210431c4,0x29462106,0x21042125,0x29652946,0x294539e7,0x5aec2945,0x5acb6b4d,0x630d630d,0x6b2d6b2e,0x5aab736f,0x6b0d736e,0x29253946,0x42292925,0x21044a49,0x6b0d4a4a,0x4a2962ec,0x28c428c3,0x292528e4,0x29453186,0x528b31a7,0x4a4a4a29,0x42094a4a,0x4a2a4a4a,0x526a526b,0x39e84a8a,0x08001040,0x29451061,0x4a2941e9,0x42094a4a,
-0x20e339c7,0x10200840,0x08001020,0x420818e3,0x20e439c8,0x08001021,0x20e40000,0x08410000,0x10001061,0x00001882,0x19050042,0x18c331c8,0x190318c3,0x208218c2,0x18c318a2,0x10a118c2,0x20e31881,0x186128e3,0x18810820,0x28e32923,0x29032904,0x20e32903,0x31442903,0x20e32903,0x29032903,0x31642903,0x29032102,0x28e13944,0x39633122,0x39853983,0x4a043984,0x49c641a5,
-0x416249a4,0x31014183,0x39633942,0x41c441e5,0x49e549c4,0x31423142,0x290228e1,0x186039c4,0x5a654162,0x62856283,0x39835245,0x314320e1,0x30e11060,0x49c52080,0x41a44184,0x21013983,0x316320e1,0x18a03142,0x10612101,0x00000000,0x00200000,0x41832040,0x62865a26,0x6ac76266,0x73096aa7,0x730a6ac8,0x7b298bad,0x7b297309,0x6ac872e8,0x4a4762a8,0x5a683943,0x51e45206,
-0x5a256287,0x73096287,0x5a456ac8,0x72e86ac7,0x6ac87309,0x7b6a6ac8,0x6ae86ac8,0x62877b09,0x6ae86ac8,0x5a4562a7,0x72e85a45,0x6ac76aa7,0x5a2572e8,0x62865204,0x626672e8,0x6ac76aa7,0x62666266,0x5a456a86,0x49e35225,0x41a45a46,0x102028e0,0x41a44184,0x30e03920,0x498130c0,0x72e86ac8,0x72c77b2a,0x6ac76aa7,0x834a7b09,0x6ac86ac8,0x62666266,0x72e872c7,0x72e86aa7,
-0x39832922,0x28e13144,0x312339a4,0x20c33944,0x29253166,0x29452105,0x31a62925,0x21252124,0x39e82104,0x632d5acc,0x5aec52ab,0x7bcf632d,0x6b4e8c51,0x62ac6b4e,0x5acb4a09,0x5acc5acb,0x3187526b,0x6b0d5a8b,0x5a6a62ab,0x41a749e8,0x20c320a3,0x29662144,0x62ec4229,0x4a29526b,0x4a4a4a4a,0x52ab4209,0x4a6a4a4a,0x4a29528b,0x18c30801,0x39c82103,0x42094209,0x42294209,
-0x18c34a4a,0x00001882,0x00200820,0x41e831c7,0x084241e9,0x08200801,0x00010000,0x00001083,0x00000020,0x00000820,0x420929c7,0x39c74a2a,0x00000040,0x20c31882,0x314420c3,0x18a120e3,0x314420c2,0x20e320e2,0x20e23144,0x290420e3,0x20e32904,0x18a22903,0x29242904,0x29033144,0x31442903,0x41e62061,0x31242103,0x312328a2,0x31633985,0x31842923,0x41c539a4,0x39634184,
-0x31013101,0x29013963,0x31023102,0x41a45206,0x49a449c5,0x31643943,0x314339c5,0x28a041a4,0x62424182,0x6ac56aa2,0x20c05a24,0x20a11880,0x41833101,0x522641c4,0x314241a4,0x20c11020,0x31643984,0x21023162,0x00000820,0x00000000,0x00000000,0x49632060,0x5a456287,0x62666245,0x6ae86ac8,0x73095a66,0x6ac86aa7,0x730972e8,0x6b296ac8,0x5a8862c8,0x51e641a3,0x52066267,
-0x5a466287,0x6ac86267,0x6ac87b2a,0x5a466ac8,0x62a86287,0x62677b2a,0x72e86267,0x6ac87b29,0x62876aa7,0x5a666266,0x62467309,0x51e46266,0x6a875a45,0x5a455a25,0x6ac86a87,0x6a8672e7,0x6aa76287,0x5a665a66,0x49e449c4,0x20a049c5,0x41840800,0x314220a0,0x39413101,0x62664182,0x72c86aa7,0x6aa76aa8,0x72e86266,0x72e872e8,0x6ac772e8,0x6aa76a87,0x72e76aa6,0x7b287308,
-0x4a053163,0x29223164,0x31443123,0x41c741a5,0x210552aa,0x29452905,0x42282945,0x18e44208,0x21042125,0x6b4d528a,0x6b4d4a49,0x630c630c,0x6b2d8410,0x526b5aac,0x5a8b5a6b,0x5aab5acb,0x5a8b5a8b,0x5aab5aab,0x5acc5aab,0x4a085aab,0x39a628e4,0x31862965,0x5acc4208,0x21254209,0x4a6a39e8,0x528b4a4a,0x526b4229,0x526b4a6a,0x39c80801,0x4a4a41e8,0x42294a4a,0x4a2a31a7,
-0x1061524a,0x10400800,0x18c30840,0x4a2939e8,0x082139c8,0x10821063,0x08220001,0x08410000,0x10820020,0x00620021,0x4a4a29c7,0x20c341e8,0x108220e3,0x20c31882,0x20e31861,0x20e22924,0x20c22903,0x188120e3,0x210320e2,0x20e320c2,0x20c32924,0x20e32924,0x290420e3,0x31443144,0x20c22903,0x398528c2,0x31243164,0x312330e3,0x29033123,0x420620e2,0x39a539a4,0x41a43963,
-0x18202060,0x31033102,0x49c53102,0x49e54184,0x28c149e5,0x41e53984,0x316341c5,0x28a03143,0x72e54162,0x414272a6,0x394328c1,0x396441c5,0x310120c0,0x31433962,0x21023143,0x20a120e2,0x188020e1,0x20e12101,0x18e218c2,0x00000880,0x08200000,0x39011000,0x624551a4,0x73086aa7,0x5a665a66,0x7b4a6ac8,0x6ac872e8,0x72e86ae8,0x6b297309,0x6aea734b,0x418441c3,0x72e94184,
-0x6ac86287,0x73096267,0x6ae96ac8,0x62675a46,0x6aa85a46,0x520562a8,0x6aa76287,0x73096ae8,0x5a466266,0x5a665a46,0x5a455225,0x6ac75a44,0x6aa76aa7,0x6a876246,0x72e96aa7,0x72c86aa8,0x6ac86ac8,0x73096287,0x4a045204,0x20c028e1,0x39423943,0x18401840,0x49c33941,0x52034181,0x7b295a25,0x62666aa7,0x730972c8,0x72e872c8,0x6aa76aa7,0x72e872c8,0x72e872e7,0x626672c7,
-0x39853184,0x31633985,0x39a52902,0x528a5269,0x20e44a09,0x18c32945,0x6b6d52ab,0x294662eb,0x29453166,0x4a6a2125,0x632d39c7,0x41e852cb,0x7b6e5a8b,0x3167524a,0x31663987,0x39a739c8,0x314639a7,0x31663166,0x31863186,0x29445269,0x4a0839a6,0x29252924,0x52cb3966,0x21453a08,0x42293186,0x4a6a52ab,0x5acc528b,0x4a4a4a8b,0x31661863,0x4a4a4208,0x4a2a526b,0x39c84a4a,
-0x186241e8,0x00200000,0x19040000,0x524a4229,0x10421863,0x00000842,0x29870000,0x004210c4,0x31a70000,0x39e939e8,0x424a424a,0x20822967,0x20e320a2,0x290318a2,0x31241861,0x20a220e3,0x18c218a2,0x20e32904,0x18a220e3,0x29032903,0x20c32903,0x20e22904,0x21033165,0x39a63144,0x31243144,0x290341a6,0x29042904,0x29033124,0x29032903,0x31432903,0x39a44a05,0x418549c5,
-0x31223102,0x398541a5,0x39642903,0x41644184,0x18403922,0x20c128c1,0x20c13964,0x28e13943,0x31004162,0x312241a4,0x20a03102,0x29022902,0x290118a0,0x294320e1,0x18a13143,0x108018a1,0x10400000,0x39a41060,0x18e22902,0x00000000,0x10000000,0x39001820,0x626551e4,0x6ac87309,0x6aa76ac8,0x62a76ae8,0x6aa77309,0x73096ac8,0x73096aa8,0x5aa8734b,0x39634a27,0x62a84184,
-0x52265205,0x6ac86267,0x62875a46,0x62876ae9,0x62675a67,0x62676287,0x5a465a67,0x6ac872e9,0x52466287,0x52055205,0x5a2549e4,0x72a77b49,0x7b096246,0x6ac76286,0x6ac85a46,0x6ac85a05,0x6aa76287,0x49c35a44,0x52265a26,0x206028c0,0x18204163,0x31015a87,0x39623100,0x49c26246,0x6a877308,0x7b496ac7,0x7b296ac7,0x73086aa7,0x72e872e8,0x72e872c7,0x72e672e8,0x628572e8,
-0x4a074206,0x29013985,0x312439a4,0x39865a89,0x18a33966,0x39e82104,0x9cf352ab,0x2925630c,0x29453166,0x10822966,0x632d4a6a,0x4a294a49,0x6b0d2905,0x31455249,0x20c31882,0x316520a2,0x21042103,0x31a52123,0x29442944,0x29442924,0x20e32924,0x29042904,0x42082904,0x18a22944,0x4a4918e4,0x5acc528b,0x528b5acc,0x4a2a52ab,0x20e41042,0x528b4a6a,0x4a2a4a6a,0x4a2a4a4a,
-0x10003146,0x21440800,0x31a831a8,0x42094a4a,0x10621042,0x08620842,0x3a2939c8,0x192539e9,0x31c82967,0x422a4a4a,0x424a4209,0x20a32105,0x20c31061,0x186118a2,0x28e31881,0x20a220a2,0x18a218a1,0x292420e3,0x20e218a1,0x28e32903,0x20e32903,0x29232903,0x18a12944,0x398520e3,0x31243144,0x31443144,0x29043145,0x29032904,0x31443144,0x292220e3,0x41a439a4,0x39443964,
-0x186028c1,0x28e220c2,0x312320c2,0x39223122,0x18603922,0x20c11040,0x314318a1,0x310120a1,0x39622080,0x39634184,0x20c028e1,0x20c120e1,0x000018c1,0x292318a0,0x10601080,0x08201881,0x28e21060,0x31433163,0x18c02102,0x08610840,0x00400000,0x10200000,0x51a34983,0x6a876287,0x6ae87b29,0x62876ac8,0x6ac86ac8,0x72e972e8,0x73097b4b,0x5ac962e9,0x31025247,0x5a2649a5,
-0x5a465205,0x5a466287,0x5a265a26,0x62675a46,0x520649c5,0x62676267,0x836b836b,0x6ac8732a,0x49e47309,0x49e45a67,0x5a255205,0x836a8bcb,0x62865a05,0x5a257b49,0x62465a25,0x5a256287,0x6aa76ac8,0x626551e3,0x18207b09,0x39413900,0x62865a66,0x39004162,0x5a475225,0x52035a25,0x62666a87,0x6aa76286,0x72e87b29,0x6aa772c8,0x6ac76aa7,0x6aa66a86,0x51e24980,0x5a4572e8,
-0x18603102,0x30e31000,0x31643164,0x29033965,0x314520c2,0x212520e4,0x73af4a29,0x316652ab,0x31663166,0x20e42104,0x5acc4a6a,0x29255acb,0x6b0c49c8,0x28e441a7,0x188128e3,0x20c31881,0x29242903,0x396520a2,0x31653145,0x18822103,0x18a230c3,0x20e320e4,0x314518a2,0x20e32924,0x4a492905,0x4a4a528b,0x5a8b5aac,0x4a6a5acc,0x10213187,0x4a4a4a29,0x4a2a4209,0x42094229,
-0x000039a7,0x29860000,0x3a0931c8,0x41e93a09,0x000118e5,0x39c80001,0x42094229,0x31a839e9,0x3a0939e9,0x422a4a2a,0x4a4a4a6b,0x08224a4b,0x18820821,0x29241021,0x18812904,0x18611881,0x20e32924,0x290320c3,0x29242924,0x20c220e3,0x294420e2,0x21231881,0x21032103,0x29031881,0x398428e2,0x29243144,0x31242903,0x20c220c2,0x20e32903,0x28e220c2,0x31423143,0x28c14184,
-0x08001881,0x20a220a2,0x20c228e3,0x20e020c1,0x18c139a3,0x084020e1,0x18a020e0,0x10202901,0x49a41840,0x4a053982,0x20c139a3,0x18a00800,0x31433143,0x294120e1,0x18c118c0,0x08400000,0x29433163,0x29432923,0x29232902,0x20c10820,0x00200000,0x10000800,0x59e549c4,0x72c86a86,0x6ae87309,0x73096ae8,0x6aa77329,0x6ae972e8,0x732a6ae9,0x52897b8c,0x398562ca,0x62885206,
-0x6a8751c4,0x62464983,0x5a675a05,0x51e55a46,0x52065a67,0x5a476ac8,0x7b4a836b,0x6aa77309,0x62a86ae9,0x62c75a67,0x51e45246,0x93ec93cc,0x62666287,0x6aa772e9,0x5a255a46,0x5a255a25,0x5a256aa7,0x5a456246,0x51a04101,0x522349a3,0x51c56246,0x41624183,0x51c44983,0x62863100,0x6a8772a8,0x62466226,0x7b0972e8,0x6aa77b2a,0x6aa772e8,0x72c86aa7,0x730859e2,0x5a246ac8,
-0x29013122,0x20a020a0,0x29033144,0x31242903,0x41c70800,0x29453166,0x42292104,0x29253186,0x29252946,0x08212946,0x5acb52ab,0x49e8526a,0x6b0c3966,0x29055249,0x31242904,0x08201881,0x290420c3,0x188228e3,0x398520c2,0x28e35249,0x18a11820,0x398618c2,0x29244a08,0x29043165,0x4a6a2925,0x52ab52ab,0x62cc62ed,0x4a29526b,0x18213987,0x4a092924,0x52ab41e9,0x42294a4a,
-0x000041e8,0x424920e3,0x3a09422a,0x41e9422a,0x084239a8,0x31c818c4,0x422a4209,0x3187424a,0x422a3a09,0x39c8422a,0x52ac4a4a,0x39e94209,0x18c310a3,0x188220c3,0x290318a2,0x186120c2,0x290318a2,0x290418a2,0x18c220c2,0x08000840,0x20c21881,0x210318a1,0x31852924,0x28e33124,0x290320c2,0x29032903,0x28e32924,0x21032903,0x31242923,0x31642903,0x29013163,0x28e141a4,
-0x20a21861,0x188120c2,0x18a11861,0x39641881,0x21023123,0x08403143,0x210118c0,0x28e120c1,0x20c020a0,0x29222922,0x18802902,0x31432903,0x10603143,0x10801880,0x31432942,0x18802922,0x31842922,0x294320e1,0x08202102,0x18a120e1,0x00000000,0x10000800,0x62464963,0x72a76225,0x73096ae8,0x73297329,0x6ac86ac8,0x73096ae8,0x730a7309,0x62ea62c9,0x4a075aa9,0x732a3122,
-0x49c45226,0x62875205,0x5a465206,0x62875a26,0x5a266aa8,0x49c44184,0x6ac86266,0x62667b29,0x62a85a67,0x62c77309,0x49a35a66,0x732949c3,0x5a056aa7,0x6a876a87,0x62665a66,0x62666286,0x28805205,0x59c149a1,0x6a256a44,0x28a149a0,0x394128a0,0x39224143,0x41a541a5,0x39014142,0x41613900,0x624651e3,0x6a665a25,0x72e86a66,0x7b296aa7,0x72e8834a,0x7b296204,0x628672e8,
-0x49c528c1,0x41853944,0x29033964,0x39653985,0x20e318a2,0x21252905,0x29453166,0x31462945,0x292539c8,0x18834209,0x5aec52ab,0x5aab528b,0x7bae5a6a,0x314662cb,0x29032904,0x18a220a2,0x20e31882,0x20a220a2,0x29042903,0x290439a6,0x18a13104,0x106118a1,0x20c32924,0x31651882,0x52aa5aab,0x5aec52ab,0x526a5acc,0x39675a6b,0x30e341a8,0x526a1020,0x4a2a4a09,0x4a4a4a6a,
-0x08414a29,0x31e831a6,0x3a09422a,0x39c839c8,0x29464209,0x422a2967,0x4a6a3a09,0x3a094a8b,0x422a3a09,0x422a422a,0x420a4a2a,0x31c94a2a,0x086131c7,0x18820041,0x20e318a2,0x20c21881,0x10612904,0x292418a2,0x20c220e2,0x29031061,0x290320c2,0x210320e3,0x20e218e2,0x31243124,0x20e22903,0x31242903,0x31443144,0x29231881,0x28e32103,0x20c21881,0x41c420e1,0x28c14184,
-0x188128e3,0x188120a2,0x18c21861,0x188118a2,0x316320c2,0x18a020e1,0x294218a0,0x29223143,0x20e020c0,0x10601040,0x18801860,0x31232903,0x31431880,0x292120c0,0x31642942,0x31633984,0x31642102,0x29222943,0x294320e1,0x20c220e2,0x00001081,0x08001041,0x62463060,0x7ae86a87,0x73097309,0x7b29838b,0x6ac87b29,0x732a6ae8,0x6ae97309,0x62ea62c9,0x41e64a27,0x7b6b49e5,
-0x62c9732a,0x49e562a8,0x49c45247,0x628762a8,0x52056287,0x5a265a26,0x49c45225,0x73095a25,0x6b0962a8,0x5a66732a,0x624649e4,0x5a465a45,0x5a465205,0x62466267,0x52055a66,0x52045a25,0x18003940,0x51221801,0x61c26a26,0x49a359c1,0x18202040,0x30e21820,0x28c220a1,0x20601000,0x49632040,0x51c38b6b,0x622559e4,0x6a876a86,0x73087b49,0x6ac77b09,0x6ac872c8,0x6aa66ac8,
-0x39a53144,0x41c63124,0x41a539a5,0x49e73124,0x41e720a2,0x29255aab,0x41e82946,0x29662925,0x00422125,0x4a6a39e8,0x526a630c,0x5aab62ec,0x524a5a6a,0x20a341e8,0x18811862,0x18a218a2,0x292418a2,0x28e32903,0x18c220e2,0x41e73165,0x20c23165,0x20c21881,0x10601081,0x41c71882,0x4a6a5aab,0x528b4a4a,0x528b5aab,0x5aab528b,0x524a524a,0x39653125,0x528b526b,0x42094a4a,
-0x186249e8,0x422920c3,0x4a2a4a2a,0x39e94209,0x422a39a8,0x41e931a8,0x420941c9,0x4a2a4a4a,0x3a09528b,0x42094209,0x39c94a2b,0x420a420a,0x296639c9,0x18821082,0x20c320c3,0x20e41882,0x18c318a3,0x20e318a2,0x18a22944,0x20a22103,0x20c228e3,0x31442923,0x31643164,0x28e33124,0x314428e2,0x18813144,0x31433985,0x20c220c2,0x290320c2,0x316420c2,0x41a41060,0x292241a4,
-0x18c22103,0x31441060,0x20e30800,0x21030840,0x18c020e1,0x292218c0,0x294320e2,0x29013163,0x29222902,0x20c120c1,0x104020c1,0x290128e2,0x39843963,0x39843984,0x31633143,0x28e22923,0x312339a5,0x31432902,0x29222922,0x00202943,0x00000000,0x08001020,0x51a32020,0x72c76a66,0x72e872c8,0x7b297b29,0x6ac87b29,0x72e86ac8,0x72e96ae8,0x6b0a6ae9,0x31845268,0x732a49c5,
-0x6ac85225,0x62a86ae9,0x39423963,0x72e95225,0x62675a46,0x52265a47,0x5a2672e9,0x6aa75a46,0x6ac862a7,0x62c87b4a,0x6aa75a87,0x6ac86287,0x6aa86aa7,0x62876287,0x5a665a25,0x51e35204,0x200051c3,0x62044922,0x62237265,0x39222020,0x08003964,0x39a50800,0x08200000,0x00001861,0x10203164,0x39431821,0x5a046a87,0x51c36245,0x6a8651e3,0x6a668329,0x72a76aa7,0x6aa76aa7,
-0x39c520a1,0x396539a6,0x314441c6,0x20c23965,0x41a61861,0x526a62ec,0x52ab5aac,0x21252125,0x212510a3,0x528a528a,0x5a8b734e,0x62cc526a,0x18a341c8,0x28e43987,0x18811882,0x18a220e3,0x292318a2,0x210318a2,0x210318c2,0x29242104,0x29042944,0x108128e3,0x18a12903,0x41a71882,0x528a4a49,0x528a4a6a,0x5aab524a,0x526b5a8b,0x5aac62ec,0x18213126,0x41e93126,0x4a2a39a8,
-0x184149e9,0x42090800,0x42094a2a,0x420941e9,0x41c94a2a,0x4a2a3988,0x420939a8,0x39e9526b,0x422a528b,0x42094a4a,0x422a41ea,0x420a4a2b,0x31c839c9,0x18a30842,0x20e420e3,0x20c320e4,0x20e31082,0x20c21881,0x188120e3,0x10401061,0x20e32903,0x312339a5,0x28e23103,0x29032903,0x31232903,0x29232902,0x31233123,0x20e220c2,0x31242902,0x29033124,0x41c41860,0x39634184,
-0x212318c2,0x18a110a1,0x20e320e2,0x18c21061,0x18c020e1,0x316420e0,0x39843184,0x188020c0,0x31422901,0x104020e1,0x08201060,0x18401881,0x31633102,0x29013964,0x20e120c1,0x31433964,0x396441a5,0x29023164,0x20e12902,0x000020e2,0x00000000,0x10400000,0x41412040,0x6a876225,0x6aa76a87,0x6aa76ae8,0x72e86ae8,0x73297309,0x73097309,0x6b0a7b6b,0x41e55267,0x49e54184,
-0x62c85226,0x62a85a67,0x5a4662a8,0x5a4649c4,0x51e56ac8,0x6aa872e9,0x5a476287,0x49c45205,0x7b6b6ae9,0x83ac6ae9,0x62a77b6c,0x5a256266,0x52255a46,0x5a466287,0x73085a66,0x5a456266,0x59e549a2,0x59a26181,0x72657286,0x288241a2,0x18a128c2,0x186128e3,0x08000820,0x00000000,0x00000000,0x000028e2,0x30c01000,0x39203901,0x7b0851e3,0x51e46aa7,0x498259e4,0x624651e3,
-0x39a53164,0x41a53985,0x49c53123,0x39443943,0x10413964,0x52ab41e9,0x5acc5aec,0x21462125,0x296710a4,0x5aec5aab,0x4208528a,0x526a2925,0x42083166,0x20c44a49,0x082120a3,0x18a218a2,0x20e31061,0x210418c2,0x10812103,0x18e318c2,0x4a493165,0x4a284a49,0x28e349c7,0x29041882,0x4a29524a,0x422939c7,0x4a4a526a,0x4a6a528b,0x528a528b,0x20023966,0x29041842,0x290420c3,
-0x28e449e8,0x39a60820,0x4a094209,0x39c94a09,0x41c84a4a,0x39a84a0a,0x41e941e9,0x4a2a39a8,0x420939c8,0x39c8524b,0x41c94209,0x4a0a41e9,0x4a2a4a2a,0x18c341e9,0x18c31062,0x20e31082,0x18821041,0x10611062,0x20e220c2,0x20a21061,0x20c31882,0x20c12903,0x28e22903,0x28e22903,0x312320c1,0x31232903,0x312330e2,0x290320a1,0x18a120a1,0x20a01020,0x31421060,0x41843123,
-0x18c12923,0x29432123,0x18c20860,0x18a118c2,0x398220e1,0x31222901,0x29013143,0x31633143,0x290241a5,0x18a12902,0x18801860,0x20a01840,0x39833943,0x39833983,0x31423963,0x39843983,0x31433164,0x39643964,0x31633144,0x000020e1,0x00000000,0x28a00800,0x38e02060,0x6ac74962,0x73086ac7,0x62866ac7,0x7b4a6ac7,0x73097309,0x72e872e8,0x5a8862c8,0x29624206,0x628841a4,
-0x732a49e5,0x62a75a67,0x732a6287,0x6ac96ac8,0x6ac962a8,0x62a849e5,0x522662a8,0x6ae95a47,0x49a47309,0x5a265a05,0x52055a46,0x626772e9,0x62875205,0x62666287,0x6266732a,0x624572e8,0x62254164,0x7a872000,0x62047265,0x102051e3,0x10001000,0x18200800,0x4a063123,0x10201061,0x106018a2,0x08000800,0x294420a2,0x00000000,0x10001000,0x10000800,0x08002060,0x392130e0,
-0x398528e2,0x29023143,0x49e65206,0x39643964,0x20c33123,0x42094a09,0x422952ab,0x21262946,0x31a818c4,0x4209526a,0x29452925,0x290520c4,0x5a8b3166,0x18623987,0x18c42905,0x10821083,0x18a318a3,0x18a218c2,0x29242104,0x29442104,0x4a692104,0x6b4d52cb,0x20c45269,0x49c820c4,0x29455aab,0x41e818c3,0x528b4a4a,0x632d5aec,0x526a5acc,0x08004187,0x20c318a3,0x4a082904,
-0x100128a4,0x08000800,0x41e94209,0x39c839c8,0x41e94209,0x4a0a41e9,0x28e639a8,0x39472084,0x41e941c9,0x41e93988,0x39a841c9,0x41e939a8,0x4a2a41e9,0x39c839c8,0x20c30001,0x084118a2,0x18a31882,0x18a20800,0x20e318a2,0x20a21881,0x20c320a2,0x20c228e2,0x290220c2,0x314428e2,0x20c220c2,0x31432903,0x39433102,0x28e23102,0x20c12903,0x20a120e2,0x39a520c2,0x31233123,
-0x31a52903,0x39a43184,0x21223184,0x29230860,0x4a033142,0x20e128e0,0x18a020a0,0x10602901,0x20c12923,0x188020c1,0x20c120a1,0x41841860,0x41c43963,0x39843984,0x41a43163,0x396339a4,0x39a53964,0x31443964,0x29223123,0x00002922,0x00000000,0x18600800,0x28801000,0x7b297b09,0x72e86aa7,0x6ac76ac7,0x72e88bcb,0x62877b29,0x732a6aa7,0x52a962ea,0x29634226,0x62a86ae9,
-0x628749e4,0x62a85a67,0x73097b6a,0x6aea7309,0x62887b6c,0x49e54a05,0x49e55226,0x51e66ac9,0x5a0551e4,0x838b5a05,0x62886287,0x52265205,0x62665a46,0x52055225,0x49a262c8,0x6a874161,0x200051c4,0x62254940,0x30604122,0x392449a5,0x18410800,0x41441000,0x184049a5,0x39642081,0x08203185,0x18611040,0x00001861,0x00001881,0x39641881,0x20e03963,0x00001040,0x18200800,
-0x398441a5,0x290139a4,0x49e649c6,0x418441a5,0x18c31020,0x41e841e8,0x29264a29,0x212518c4,0x19051905,0x10c331a6,0x29660862,0x41e82125,0x526a4a6a,0x39a72946,0x39664a09,0x188320c4,0x28e420a3,0x20c320e4,0x188220c3,0x10612103,0x31c72104,0x62ec52aa,0x18c341e8,0x528a4208,0x4a495a8b,0x212520e4,0x210539e8,0x422a39c8,0x52ab4a4a,0x20824a69,0x19030841,0x4a6939e7,
-0x20e43166,0x082120c3,0x41c818a4,0x41c84209,0x20a44208,0x08011843,0x10221864,0x08010801,0x29260801,0x31673988,0x396741c8,0x41a83987,0x41c941c9,0x398841c9,0x08213167,0x10820801,0x18c30841,0x104120e3,0x20c320a2,0x188220a2,0x106120c3,0x20e22103,0x28e22903,0x29032923,0x29023143,0x28c228e2,0x31432902,0x31432902,0x20c22902,0x292320c2,0x290218a1,0x20a120c1,
-0x20c21881,0x420539a3,0x316341e5,0x31033162,0x31002080,0x20e13962,0x20e13122,0x28e220e1,0x18a120e2,0x28c21861,0x396320a1,0x418441a4,0x39634163,0x398341a4,0x41c43983,0x316341c5,0x39a43163,0x31642923,0x29423163,0x00000840,0x00000000,0x10000000,0x30802041,0x59e338e0,0x73086ac7,0x72c87b29,0x6ae86aa7,0x7b4a6ae8,0x736c6ae9,0x52486b2b,0x5a4741a5,0x838c730a,
-0x49e562a7,0x628762a8,0x7b6b6ae9,0x522649e5,0x5a465226,0x52253983,0x5a477309,0x5a2649a3,0x62676247,0x73096aa8,0x7b4b7309,0x51e47b4b,0x5a665a46,0x5a465205,0x520549a4,0x5a0551e3,0x41016a47,0x6a8638e0,0x10003120,0x396420a1,0x20401000,0x49a35a05,0x20805a46,0x184020a1,0x20a11881,0x316541c6,0x20c318a2,0x10001061,0x00000820,0x08000000,0x206028c1,0x08001000,
-0x39843964,0x4a0539a4,0x39645206,0x39443943,0x00002081,0x20e44209,0x18a439a7,0x210518a3,0x10622104,0x19040881,0x212410a2,0x52ab4a49,0x6b4d4a29,0x62cc734e,0x394662cc,0x10422905,0x28c41883,0x290420e4,0x28e320c3,0x188220c3,0x20c320e3,0x31662945,0x420820e4,0x526a52ab,0x526a5acb,0x29054a29,0x20c4520a,0x10820841,0x39a74a29,0x20a220e3,0x10611082,0x420818c2,
-0x20a320e4,0x10410000,0x18220801,0x18631863,0x104218c3,0x10220000,0x08010801,0x08420801,0x08010801,0x20a40801,0x29053146,0x28e528e5,0x28c43126,0x20e51022,0x29253167,0x08211062,0x10611061,0x18821882,0x20a22904,0x10611882,0x18812924,0x28e220e2,0x28e220c2,0x18a03123,0x20e120e1,0x208020c0,0x20c12922,0x20c13164,0x106018a1,0x18a11881,0x188118a1,0x188120c2,
-0x20c11060,0x396320c0,0x398349e5,0x20c12901,0x41a13101,0x20a020a0,0x31633163,0x10601880,0x20a11881,0x18602061,0x20a020a1,0x39432080,0x41843102,0x41c541a4,0x41e53122,0x39a441c4,0x31633163,0x318439a4,0x08402902,0x00000000,0x00000000,0x18400020,0x18201021,0x59e438c0,0x62866aa7,0x73087308,0x838a7308,0x7b4a7308,0x6b0a6b09,0x41e662ca,0x6ac94a06,0x6288730a,
-0x52465226,0x62a75225,0x49e562a7,0x6ae96ac9,0x62885206,0x49e56ac9,0x6aca49e5,0x520549c4,0x72c86267,0x5a266a88,0x62886267,0x49c462a8,0x72e95205,0x5a266287,0x52055205,0x41634161,0x28a06a67,0x49844123,0x102020c0,0x18602081,0x20201840,0x62674984,0x28c251e6,0x10001840,0x20c20800,0x18811881,0x314418a2,0x18a239a6,0x00000840,0x394220c2,0x39603120,0x28e028c0,
-0x52264a06,0x41c64a07,0x39434184,0x31224184,0x08003963,0x4a0941c8,0x29452905,0x31452925,0x18a320c3,0x10a30862,0x62ec2966,0x39a8736f,0x526b4a09,0x7b8f62ed,0x4a2a5a8b,0x39864a09,0x398749e8,0x29052925,0x4a093166,0x396649c8,0x10621083,0x210420e4,0x18e40841,0x5acb2945,0x52294a49,0x49e9524a,0x28c449e8,0x20822062,0x18821882,0x31651882,0x186220c3,0x20821041,
-0x20c41883,0x08220001,0x08220801,0x00000001,0x00000000,0x00010000,0x00010001,0x00010001,0x08010001,0x08010801,0x08010000,0x10410000,0x00000800,0x00000000,0x31a80001,0x18e32966,0x18a20841,0x10621061,0x10211041,0x18820800,0x18a21882,0x20c228e3,0x290220e2,0x28c128e1,0x31223122,0x41a42901,0x18601880,0x20c02922,0x104018a0,0x20c21881,0x20e21881,0x290318a1,
-0x18c118a1,0x396320a0,0x49c549c5,0x20a03102,0x5a8528e1,0x29222900,0x29222902,0x20a118a1,0x20a11860,0x08402102,0x102018a1,0x39433143,0x396341a4,0x31423983,0x41c439a4,0x396341c4,0x41c53964,0x31843984,0x00003124,0x00000000,0x00000000,0x18410000,0x28e01020,0x49612880,0x62666a87,0x6ac77b29,0x7b297b29,0x7b297b49,0x6b2b6b29,0x4a265aa9,0x734b5247,0x41a462a9,
-0x6ae96ac9,0x51e56ae9,0x62a85226,0x62c85226,0x7b4a49c5,0x49e55a47,0x6ae95a45,0x5a686aea,0x39434164,0x418449a4,0x62875206,0x6ac8838b,0x6ac85205,0x41c4734a,0x39425205,0x28a13101,0x20402000,0x49c628e1,0x20812081,0x10011861,0x20a11861,0x28e128e2,0x20a01840,0x20401000,0x102028c2,0x28e320a1,0x18202903,0x18000000,0x52473103,0x394128e1,0x30e03900,0x41843901,
-0x29012922,0x52683984,0x396449c5,0x31223122,0x08003963,0x4a2918a3,0x526a3166,0x18a23166,0x18a20820,0x420910c3,0x83f06b8e,0x39a75aab,0x41e939a7,0x734e5acc,0x62ac6b2e,0x526a62cc,0x526a5a8a,0x526a526a,0x31255a8b,0x39873125,0x39874a29,0x294620e4,0x18e441c8,0x42082104,0x524a630c,0x522a62cc,0x396662ab,0x08001821,0x188218c2,0x084018a2,0x08001061,0x08000000,
-0x10621042,0x18a40821,0x10631063,0x00000001,0x00000000,0x00010841,0x000118a3,0x00210001,0x00000821,0x00000000,0x00000000,0x08001082,0x00000000,0x00000000,0x00210000,0x08610842,0x41e720e4,0x39863966,0x18821862,0x20c31882,0x084018a3,0x290320a2,0x20c118a1,0x28c128c1,0x20a01860,0x41a449c4,0x314218a0,0x10601040,0x28e220e1,0x188120e1,0x18a118a1,0x082018a1,
-0x18a11060,0x31223102,0x396341a4,0x20a03102,0x20c028e1,0x20e13142,0x29013122,0x29231020,0x290220a1,0x18c13984,0x08201080,0x314220e1,0x316328e1,0x398441c4,0x31422922,0x31023963,0x31232902,0x31853163,0x00000000,0x00000000,0x00000000,0x18410000,0x41a31840,0x38e11820,0x6a665a25,0x6aa76aa7,0x6ac76aa7,0x73287308,0x5aa8734a,0x39a55aa8,0x6b0a5a68,0x5a87732b,
-0x732a5206,0x394362c8,0x628841a4,0x62c862a8,0x6ae95246,0x5a475a67,0x52065226,0x49e641a5,0x416449c5,0x62684184,0x49c46aa8,0x49c45205,0x5a675205,0x49c45205,0x49e449e4,0x10002080,0x10001000,0x20813963,0x28c21000,0x28a31820,0x31031861,0x18604185,0x08000800,0x10002060,0x18611860,0x18811840,0x182020e3,0x00000800,0x38e31820,0x396430e2,0x310149c4,0x41a33920,
-0x290120e1,0x292120e1,0x41853943,0x39633963,0x104049c5,0x42080001,0x29252104,0x000018a3,0x18e31904,0x630d10a3,0x7bcf73af,0x83d06b2e,0x4a4a630d,0x83b06b2e,0x7bb07b8f,0x6aec6b0d,0x4a095aab,0x62ec5a8a,0x39665aab,0x5aab20a3,0x41e8528b,0x29053166,0x18c32104,0x420810a3,0x5229524a,0x49e9524a,0x5a8b4a29,0x102028a2,0x10611041,0x188220c3,0x10000820,0x08001021,
-0x08421062,0x18830001,0x10831043,0x08410001,0x00000000,0x00000021,0x08421062,0x31660021,0x31a731c7,0x000029a6,0x00000000,0x00200000,0x00000000,0x00000000,0x00220000,0x00000001,0x08410000,0x20c31862,0x10411882,0x20e420c3,0x20e31862,0x18821861,0x20a120c2,0x28e120a0,0x39433963,0x20c028c0,0x20c02901,0x18a018a0,0x29012922,0x188120c0,0x20c21860,0x10600820,
-0x10600820,0x312228e1,0x31023102,0x20a128e1,0x312328e2,0x18a020c0,0x20c020e1,0x290220c1,0x20e12901,0x18a12922,0x18a118c1,0x20a01060,0x20e13122,0x31633163,0x31421880,0x104020a0,0x29230820,0x00002964,0x00000000,0x00000000,0x00000000,0x20610000,0x4a051020,0x496330c0,0x62255a05,0x72e86aa7,0x6ac76ac7,0x72e86ae8,0x5ac96b29,0x31845247,0x7bac7b8c,0x5a875a68,
-0x52065a47,0x522662a8,0x6ac96ac8,0x52065a47,0x5a676288,0x394362a8,0x41853943,0x41843943,0x49a53943,0x62675a26,0x51e549c5,0x62a751e5,0x520572e8,0x41a46ac8,0x31213121,0x30e23122,0x10200820,0x20612861,0x18402881,0x28c320a2,0x31231820,0x28c24186,0x08001820,0x31651881,0x00001041,0x08000000,0x18401040,0x20621000,0x08201020,0x08001820,0x20a00800,0x10006a89,
-0x49e63164,0x312241e5,0x41843983,0x41c53984,0x20c13983,0x20e40000,0x41e82104,0x21450000,0x296618e4,0x52ec10c3,0x843173d0,0x94739452,0x6b0d7bd0,0x7b8f6b2d,0x73af736f,0x6b0d6b2e,0x396749c8,0x528b49c8,0x526a6b2e,0x62ac524a,0x41c8526b,0x186220a3,0x18a220e3,0x19241082,0x4a6a4a49,0x31462966,0x4a494a49,0x20c31883,0x20c21881,0x18621041,0x00000000,0x41e81882,
-0x39c84a4a,0x106318a4,0x08220822,0x00000801,0x08830841,0x00000021,0x10630021,0x41e939c8,0x31a731c8,0x212531c8,0x00012987,0x00000001,0x00000000,0x00000000,0x00000000,0x00000862,0x00000000,0x18821040,0x18821862,0x20c31021,0x18a220a3,0x20a320c2,0x18a128e2,0x18a11040,0x28e128c0,0x18403102,0x29022902,0x39842902,0x314120a0,0x28e22100,0x08003144,0x10201020,
-0x08201040,0x20a120c1,0x20a02902,0x20c128c1,0x20a120e2,0x10601060,0x31231060,0x29012901,0x39633963,0x18802923,0x20e218a1,0x20c11060,0x29013122,0x31622922,0x18c039a3,0x10000800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31221020,0x30a03942,0x62665a25,0x6ac862a7,0x6aa76ac8,0x732972e9,0x62a96b09,0x52485227,0x7b8c734b,0x5a47732a,
-0x5a467309,0x62a84163,0x6ae95226,0x734b62e9,0x41845247,0x4a476aea,0x314339a5,0x29233123,0x41843943,0x838c49c5,0x49e549e6,0x49c549e5,0x52267b6b,0x10005205,0x39621020,0x18401840,0x20821000,0x20c21841,0x184120c2,0x20821000,0x30e41841,0x28a220a2,0x08001860,0x18400820,0x30e328c3,0x18613102,0x08002903,0x18401020,0x28a11000,0x00000800,0x29233144,0x39841880,
-0x398528e2,0x20e03143,0x41845a67,0x41e539a4,0x28c24a26,0x00000000,0x10a34a28,0x10a22946,0x004110a2,0x5b2d2987,0x84116baf,0x8c528c32,0x6b2e83d0,0x6b2e6b0d,0x6b8e630d,0x7b6f83d0,0x5a6b62cc,0x4a4a41a8,0x5aab5a8b,0x62cc6b0d,0x28e441c8,0x20821842,0x188220e3,0x10c31082,0x21252125,0x10210862,0x4a4941e8,0x41c73146,0x08002103,0x00001061,0x21240861,0x4a4b4a4a,
-0x528b5acc,0x39884a2a,0x10621083,0x00010822,0x08220021,0x19041883,0x21250001,0x316639c8,0x39a839c8,0x39e831a7,0x18e431c7,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18610000,0x10411021,0x188220a3,0x18a220a3,0x186220c2,0x18a118a1,0x18a020c1,0x100028e2,0x28e12080,0x188018a0,0x290220c1,0x5a671880,0x104020c0,0x08001881,0x18a00800,
-0x18a118a1,0x10601060,0x28c220e2,0x18a030e2,0x20e12902,0x20c11880,0x18a020a1,0x290128e1,0x39633943,0x29222943,0x18a11060,0x31422923,0x20c120c0,0x20e120e1,0x210239a4,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18820020,0x398320c1,0x30c028c0,0x52055a25,0x6aa76287,0x73296ac8,0x6b097309,0x62ca6b09,0x5a895268,0x52276aea,0x62a86ac9,
-0x5a675a46,0x942f62a8,0x49e57b6c,0x4a2762c9,0x49a549e6,0x736b41c5,0x6aea6b0a,0x41e53984,0x49c549e5,0x41a441a4,0x520549c4,0x49e55246,0x52256ae9,0x18804183,0x08200000,0x00000800,0x18611841,0x20e22081,0x18611881,0x18412062,0x28a31841,0x10000800,0x18a11041,0x20810000,0x18400800,0x28a11840,0x28e23102,0x5a896289,0x31445227,0x20e23964,0x18401881,0x08000800,
-0x29021880,0x31023943,0x394328e1,0x39834183,0x28a14a05,0x00001040,0x2144528a,0x002110a2,0x21452166,0x6b6e4a4a,0x7bcf73cf,0x62ab838f,0x630d526a,0x4a6a4a09,0x5aec5acc,0x7b6f73af,0x5a4b6aed,0x41e9526b,0x62ed5aac,0x5aac6b2d,0x524a41e8,0x49e8526a,0x108320a3,0x292518c3,0x10621083,0x188220c3,0x29243144,0x18821861,0x08001041,0x00201082,0x42093a08,0x39e939e9,
-0x4a4a5aac,0x4a0a4a2a,0x102239a8,0x00001802,0x00210000,0x00010841,0x08610821,0x31872966,0x29063167,0x39a839a8,0x29673a09,0x08610001,0x00000000,0x08000000,0x10a40021,0x10c40883,0x00010001,0x00000000,0x18411000,0x18611821,0x18821861,0x108120c3,0x108118a2,0x188118c2,0x20a118a1,0x20a118a1,0x186028a1,0x18820000,0x00000800,0x10600800,0x20c21881,0x29221880,
-0x20c12903,0x10201860,0x28e220a1,0x28e220c1,0x28e22081,0x106020a1,0x20c120a1,0x29011880,0x312120e1,0x31423142,0x29021060,0x21013964,0x18c13164,0x20e11060,0x00001081,0x00000021,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x396320a1,0x30e11000,0x49c449a4,0x5a255225,0x7b6b5a66,0x62e97309,0x7b6c6b2a,0x62ca3985,0x524762e9,0x52266b09,
-0x5a266288,0x732a72e9,0x734b83cc,0x52066b0a,0x52476268,0x7bac5aa8,0x6b0a734b,0x41c562a9,0x5a475226,0x49e549c5,0x522662a8,0x6ac94a05,0x4a265227,0x10600000,0x00001062,0x08000800,0x20c31882,0x20c320a2,0x08001861,0x18201020,0x28a220a2,0x186120a2,0x29222943,0x314441c6,0x20c11040,0x30e34a27,0x08001860,0x08000800,0x00003103,0x08400800,0x00000000,0x00000000,
-0x31233143,0x41843122,0x20803963,0x41843963,0x080028e1,0x4a690000,0x190410a2,0x29871905,0x21464a6a,0x73af4a6b,0x7baf8410,0x28e449c8,0x4a0920e4,0x08622945,0x39e839e8,0x6b2e6b4e,0x62cc62ac,0x4a095a8b,0x5aac4a29,0x5aab5acc,0x4a294a4a,0x52295249,0x18a31021,0x21040841,0x08210841,0x188218a3,0x18821061,0x00001061,0x08410840,0x29460020,0x4a6b4229,0x52ac528b,
-0x5aac5acd,0x4a2a4a4a,0x20a44a09,0x00001001,0x00000000,0x00210021,0x10620001,0x18a50863,0x10231884,0x39c831a8,0x31a839e9,0x29872967,0x00200021,0x00000000,0x29461082,0x31a72146,0x18e52126,0x000010a3,0x20a20800,0x18821041,0x10410800,0x18a118a2,0x18811061,0x10610820,0x20c128e2,0x10402923,0x10400800,0x00000000,0x08400800,0x10601040,0x29031881,0x29021860,
-0x080020a1,0x20a11881,0x10601860,0x208020e2,0x39431000,0x104028e2,0x18801880,0x29012902,0x106018a0,0x39a43142,0x39843163,0x31433143,0x29233143,0x29230820,0x08010000,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x41831000,0x20603942,0x626751c4,0x62876287,0x838b72e8,0x62e97b6b,0x732b734b,0x52473984,0x736b6b2b,0x7b4b730a,
-0x62a85a26,0x732a7b2a,0x6b0a6b09,0x5207734b,0x6b096289,0x62a84a26,0x31436b0a,0x5a475226,0x5a675a47,0x62a8730a,0x5a465246,0x5a465a67,0x31214a05,0x10202901,0x00000020,0x10000800,0x206128c3,0x28c130e3,0x49e53943,0x20811860,0x31034185,0x524741c5,0x4a4739a5,0x10203124,0x10400800,0x18401861,0x08001840,0x31023123,0x49c43943,0x4a0541c4,0x00004a07,0x00000000,
-0x31223963,0x39433983,0x41843963,0x28e03943,0x00000800,0x528a0821,0x088310e4,0x6b4e4a8a,0x29261966,0x94935acc,0x9411a4f4,0x398649a7,0x18a339a6,0x18a32104,0x4a4a4208,0x62ed5acc,0x7bb062cc,0x49e97b8f,0x4a2a20c4,0x5acc5acc,0x39a85a8b,0x20435a4a,0x18830801,0x20c41062,0x188318c4,0x18832904,0x10410000,0x00000861,0x00010000,0x29c80021,0x4a6b424a,0x632e4a8c,
-0x526b5acc,0x522a5a6b,0x20644a0a,0x00001001,0x18620000,0x00010800,0x42091083,0x08423a09,0x00011083,0x318739a8,0x4a4b4209,0x39c839c8,0x00013187,0x00000000,0x31a72946,0x29662966,0x296618c4,0x08412104,0x00000000,0x10610000,0x18811881,0x00001881,0x18c10840,0x00000800,0x188118a2,0x000020a1,0x10810000,0x08000000,0x00000800,0x08001040,0x08000800,0x18a120e1,
-0x20c31040,0x18810800,0x20a10800,0x20a120c1,0x106020c1,0x20c12922,0x29021880,0x38e020e1,0x51c34120,0x31211860,0x31423942,0x29423983,0x20e22922,0x00001060,0x00011083,0x08420001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28c01840,0x28c04183,0x62676ac9,0x732a6267,0x7b4a72e9,0x7b8a734a,0x5aa96b0a,0x5a8841c5,0x628839a5,0x524662a8,
-0x6b09734a,0x6b2b62a8,0x7b6b5a88,0x4a065a67,0x5a477bac,0x52065226,0x41e55267,0x49e541a4,0x6ae949e5,0x5a475206,0x520549c4,0x62666ac8,0x49a45204,0x49c449c5,0x20612060,0x28603101,0x49845a26,0x52063902,0x28803122,0x08001840,0x00000820,0x10610000,0x20c31882,0x292420e3,0x31243124,0x52283985,0x49c46288,0x39233943,0x29233943,0x20804163,0x31851061,0x528931a5,
-0x20a03122,0x394320a0,0x39432080,0x186041a5,0x00001000,0x4a4941e7,0x108410e4,0x5acc3a08,0x294600a3,0x9cf48c52,0x49a88bf0,0x20a32083,0x29043986,0x18a318a2,0x5aec62cc,0x62ec5acc,0x83f183f0,0x3146736f,0x41e82105,0x528b62ec,0x31874209,0x39461001,0x186341e8,0x292620c4,0x20e44a29,0x526a4a29,0x18a30801,0x00000001,0x00420000,0x3a092125,0x4a6b424a,0x528c422b,
-0x52ac5aac,0x4a0949e9,0x28c54a2a,0x08210801,0x00000000,0x00010820,0x29872125,0x39c839c8,0x422a39e9,0x39a839c9,0x526b39a8,0x31a84a4a,0x21053187,0x08210000,0x31660801,0x316739a7,0x20e43166,0x082120e4,0x00000820,0x08200841,0x10401041,0x00000820,0x108020e2,0x000020c2,0x20c20820,0x188120e2,0x08201060,0x104020c2,0x000020c2,0x102020e2,0x28e22903,0x188020c1,
-0x10201040,0x20a118a1,0x20c13144,0x312318a0,0x20c120e2,0x18a128e2,0x20a11040,0x496118a0,0x52025a21,0x396320a0,0x39833122,0x29422922,0x18613163,0x00010000,0x00010000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28e128e2,0x28a028e1,0x62465a26,0x838b72e9,0x83ac838b,0x6b297309,0x6b0a83ac,0x526762c9,0x5226734b,0x5a674a05,
-0x6ac95a67,0x7b8c7b8b,0x52265a68,0x83cd5206,0x6ac97b6c,0x41a441a4,0x4a055246,0x49e53963,0x524649c5,0x5a4762c8,0x6ac95a25,0x522549c4,0x18403101,0x396228e0,0x31244a06,0x38e03963,0x30e03900,0x30e01840,0x49c430e0,0x29045247,0x20c32103,0x18a21061,0x20c320e3,0x20c22904,0x18a21021,0x392420e2,0x41843963,0x49a55205,0x20c15206,0x00000820,0x00200000,0x084020e3,
-0x20a01860,0x396328e1,0x41a528e0,0x20802061,0x00000800,0x29454a49,0x108410e4,0x294639e8,0x422a3229,0x8c528411,0x18017b6e,0x28e42083,0x526a4a28,0x4a094a28,0x528b62ec,0x736f630d,0x734e7baf,0x41a862ac,0x5aab3146,0x5aac5a8b,0x4a2a5aab,0x5a6b5a6b,0x41c84a6a,0x290520e5,0x18c339a7,0x4a293125,0x106318a4,0x08430001,0x42293188,0x42094229,0x4a4b4209,0x422b3a0a,
-0x5acc4a4a,0x422a4a6b,0x41e94a6a,0x20c44a0a,0x00000800,0x08420000,0x39e839a7,0x31a839e8,0x39c939c8,0x420939e9,0x39a839c8,0x39c8420a,0x31a741e9,0x00000000,0x00000801,0x080120a4,0x10421022,0x000018a3,0x00000000,0x10610000,0x18811882,0x18a21040,0x10800000,0x18a21060,0x106020c3,0x20c21881,0x28e21881,0x08001880,0x186118a2,0x20c11880,0x290228e1,0x18602923,
-0x18802902,0x08201860,0x28e220c2,0x29021860,0x20a120a1,0x188020a1,0x29231060,0x51a218a0,0x20a06a86,0x396328c0,0x39a43963,0x294239a4,0x08002942,0x00210000,0x00010000,0x08420021,0x00000021,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x312128c1,0x31012080,0x51c35a25,0x62a65204,0x6b096ac7,0x6b0883ac,0x5a8862c9,0x52275a88,0x49e5734b,0x41845a67,
-0x49e541a4,0x6aea6287,0x62a85a88,0x62a95226,0x4a055227,0x52263963,0x52673163,0x52263963,0x418449c5,0x51e549e5,0x62875a66,0x28a05a26,0x30e31820,0x10001000,0x00000000,0x39211840,0x41434143,0x41853923,0x28e33944,0x20c32904,0x20c320e3,0x20c320e3,0x20e31882,0x20e320c3,0x28e320c3,0x30c118a1,0x394230c0,0x414449a4,0x39843943,0x18821881,0x000020c2,0x08603165,
-0x312128c0,0x28e241a5,0x20a13102,0x10400800,0x00000000,0x31a652aa,0x20e50000,0x5b0d39c8,0x52cb632d,0x9493738f,0x4987838f,0x312528c4,0x39e720e3,0x39e839c7,0x52ab3186,0x7b8e738e,0x4a0962ab,0x29253967,0x42292966,0x52ab5acc,0x526b4a29,0x526b5aac,0x4a09526a,0x310620a4,0x290520e4,0x18a32925,0x00001021,0x00620862,0x4a6b2188,0x4a6b422a,0x4a2a4a4b,0x39c9422a,
-0x42094229,0x422a4a6b,0x41c9422a,0x39a749e9,0x18831882,0x00210862,0x21260000,0x00010022,0x31a82126,0x31c839c8,0x39a839c8,0x39c931a8,0x39c839e9,0x00000001,0x00010001,0x10220801,0x10421022,0x00000842,0x00000000,0x00200000,0x18a218a2,0x08200840,0x08400000,0x10611040,0x08401881,0x29231040,0x18a11860,0x10410800,0x080018a1,0x18a01060,0x314328e2,0x20c22923,
-0x18811040,0x186028e2,0x104028e2,0x20c220c1,0x20c220c2,0x106020c2,0x106020a1,0x312020e2,0x20a049e3,0x49c420a0,0x41a449e4,0x294339a3,0x08200800,0x00010000,0x08420002,0x08420842,0x00010821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20601860,0x30c11840,0x5a446246,0x73087308,0x62a77b6a,0x62c86286,0x528862c9,0x41e439a4,0x6aea6b0a,0x524662e9,
-0x7b6c6ac9,0x83cd41a5,0x6b2a6b0a,0x62a85a88,0x6ae8732a,0x732b730a,0x5a8862c9,0x39a441e5,0x49c549c5,0x51e55226,0x4a466ae9,0x00000000,0x10610000,0x18c30841,0x10410840,0x28e31861,0x310420a3,0x290320a3,0x20e31881,0x18a218a2,0x106120e3,0x20e318a2,0x20e320e3,0x292520c3,0x20e320e3,0x394420e3,0x416228e1,0x49a349c5,0x31643964,0x20e32123,0x00000020,0x18c20001,
-0x418328e0,0x39643944,0x08003924,0x396528a2,0x00000800,0x002039e7,0x528b0000,0x5b0d630d,0x4a6a5aec,0x7bd06b4e,0x6acc7baf,0x188230c4,0x086118a2,0x39e82945,0x18e42945,0x41c85acb,0x524a4a29,0x21044186,0x528b31a7,0x5aac4209,0x524a4a4a,0x62cc5aab,0x5a8b5a8b,0x20843946,0x31452905,0x106118a3,0x00001042,0x00010000,0x42090063,0x4a2a4229,0x4a4a41e9,0x31a84a2a,
-0x39e939e8,0x39e93a09,0x292639e9,0x10621022,0x08211062,0x00010021,0x00000000,0x00000000,0x29860000,0x31a831a8,0x316731a8,0x29673187,0x398739e9,0x10830000,0x00000821,0x08220001,0x18630801,0x18a31083,0x000018c3,0x00000821,0x10600000,0x10611061,0x00000841,0x00000000,0x20e318a2,0x10611040,0x000018c2,0x08610001,0x10400860,0x28e23143,0x28e22902,0x18a11040,
-0x080028e2,0x39851881,0x28e220c2,0x10601880,0x188120c1,0x20a118c1,0x290220c1,0x188018c1,0x29012081,0x41833963,0x39a43962,0x00201061,0x00010000,0x00220801,0x00010022,0x00010001,0x00010821,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x28a01020,0x38e12060,0x62856a87,0x72e87308,0x6ac762a7,0x5a676ae8,0x5ac962c9,0x41e43983,0x62c96b2a,0x4a266b2a,
-0x62884184,0x8c0e6ac9,0x732b6aea,0x5a676b0a,0x5a666ae9,0x7b4b5a67,0x52886b2b,0x31634a26,0x522649e5,0x83cd7b6b,0x08005267,0x18820800,0x08000800,0x18610800,0x08201861,0x080020c4,0x292418a2,0x20a218a2,0x10611881,0x18a21882,0x20c220c3,0x20e320e3,0x29032904,0x290420e4,0x18a22924,0x396420e3,0x51e649c5,0x416341a3,0x31643984,0x312320c1,0x084020c0,0x31431880,
-0x39854a27,0x20801860,0x10200800,0x41c628a1,0x00000000,0x000039e7,0x4a8b4a8b,0x632d5acc,0x3a0952cb,0x62ec4229,0x62cc6b2d,0x290541a8,0x18820800,0x296520e3,0x18e32104,0x5aab630c,0x39a75aab,0x28e43105,0x41e82105,0x4a4a526a,0x52ab5acc,0x5aac526b,0x5a8b5aac,0x30c55a4a,0x29252925,0x18a320c4,0x31662925,0x00021043,0x00830042,0x39e91925,0x08422987,0x18830842,
-0x31e810a4,0x3a294229,0x398841c9,0x18831823,0x18821021,0x00210821,0x00210021,0x00000000,0x10a30841,0x3a0939c8,0x318739a8,0x31672946,0x20a528e6,0x18c41863,0x00010842,0x00210001,0x18a30821,0x20e41062,0x082020e3,0x08201061,0x00000000,0x18a218c2,0x10611061,0x00000000,0x20a12081,0x00000841,0x00000000,0x08200000,0x00000800,0x312318a0,0x104020a1,0x188120a1,
-0x00000800,0x18811080,0x18a10840,0x10600820,0x18c118a1,0x20e21880,0x20e22102,0x106020c2,0x39a520a1,0x312141a3,0x00001860,0x00010001,0x00000001,0x10630821,0x08210000,0x00010001,0x00010863,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x31211820,0x39211840,0x72c84982,0x6a6672c7,0x7b2972e7,0x6ae87b29,0x4a8862e9,0x39834a26,0x628862a8,0x520641a4,
-0x39833963,0x51e55a47,0x7b2a49c5,0x6b0972e9,0x6ac8730a,0x7b6c41a4,0x526762a9,0x6aa751e6,0x62877309,0x6b2b7309,0x00005268,0x10200000,0x08001861,0x188118a2,0x20c220c3,0x20c418a3,0x18811882,0x08400000,0x000018a1,0x20e20000,0x210320c2,0x29242924,0x29242945,0x21052925,0x29042924,0x39853145,0x41a44163,0x49e54184,0x41635206,0x41834163,0x394349c5,0x082020e0,
-0x10203144,0x08000800,0x49c528e3,0x18a14164,0x00003145,0x00000861,0x4a8b10a3,0x5aec39e8,0x4a6a5acc,0x632d528b,0x62ac62ed,0x31465a6a,0x080020c4,0x18e320e3,0x4aaa2104,0x736e7bcf,0x41e862cb,0x31a75a8b,0x31872105,0x4a4a4229,0x62ec4a4a,0x5aab4a29,0x52ab62ec,0x18634a29,0x20c420c4,0x20c318a3,0x18831883,0x18a320a3,0x084218c4,0x082018a3,0x08411041,0x18a20841,
-0x00200000,0x29870062,0x42083a08,0x396641e8,0x00001041,0x00010021,0x00210842,0x00000000,0x39c70000,0x212531c7,0x29463167,0x00010022,0x31a83188,0x18a42926,0x000118a4,0x00210001,0x00000000,0x21040000,0x29452945,0x00002945,0x00000000,0x18a20000,0x18821882,0x080020a2,0x00000820,0x00000000,0x08200000,0x000018a2,0x08001881,0x20e20800,0x39850800,0x20a11060,
-0x00000800,0x20e21040,0x18a118a1,0x10601060,0x18a120e2,0x18c120e2,0x18a120c2,0x080018a1,0x312318a0,0x10620020,0x00010000,0x00000001,0x00010821,0x00010001,0x08010822,0x00221063,0x00010001,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x28e11820,0x41222060,0x5a254962,0x5a046265,0x7b29836a,0x73297b09,0x632a7bac,0x29215287,0x5a676288,0x5a4749c5,
-0x394341a4,0x39433963,0x5a264184,0x6ac95205,0x3983730a,0x730a4a05,0x52475247,0x52055206,0x73095a46,0x5247836b,0x00000860,0x18820800,0x18411882,0x10001861,0x20c320e3,0x290320e3,0x084020c2,0x00000800,0x000018a2,0x00000020,0x18a120c2,0x20e32924,0x210420e4,0x29252104,0x29252904,0x31042904,0x41843103,0x5a266268,0x49c551e6,0x49c449e5,0x31023943,0x18800000,
-0x210118c1,0x10610000,0x20c21020,0x10201881,0x29440800,0x10620000,0x42294208,0x29a70000,0x21861904,0x634e5b0d,0x528b5aac,0x528b5aac,0x20c32946,0x20e31862,0x21442945,0x4a6a39e7,0x31a731c7,0x5acb5aab,0x314641e9,0x42092125,0x4a6a3a49,0x42294a6a,0x4a4a5acc,0x316652ab,0x314618a4,0x28e43125,0x20e42905,0x102120a3,0x10411062,0x10410000,0x10411062,0x20c32904,
-0x00000020,0x00200861,0x10820000,0x29663186,0x00000000,0x29660000,0x41e839c8,0x39a739a7,0x08420802,0x31860861,0x190431c7,0x08620000,0x31672166,0x39882946,0x000220e5,0x00000000,0x00000000,0x00000000,0x292420e4,0x41e73186,0x00002904,0x00000000,0x10822965,0x18811861,0x00000000,0x00000000,0x18c20000,0x08001060,0x18811060,0x080020c2,0x188020a1,0x20e21080,
-0x00000020,0x10810000,0x188118a0,0x18c21061,0x20c210a1,0x20e22923,0x10401040,0x10601880,0x10800020,0x00212926,0x00000021,0x00010001,0x00210001,0x00010000,0x08010001,0x00011083,0x00210002,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x30e11040,0x30a11000,0x49824121,0x62256225,0x7b296246,0x836a7b29,0x736b83ab,0x41c462a8,0x52463961,0x39636288,
-0x49c53943,0x6ae95a67,0x6b096b09,0x52256b2a,0x398341c5,0x39633102,0x732b5227,0x62677b2b,0x730a5a05,0x31a57bad,0x08200000,0x29041000,0x20c320c3,0x188220c3,0x290320e2,0x29033164,0x18811882,0x08000000,0x20c31882,0x210320c3,0x082018c1,0x18c30000,0x28e42904,0x294520e3,0x29252924,0x29042924,0x41863123,0x62875a47,0x51a559e6,0x186020a0,0x18601020,0x28e13142,
-0x00000000,0x42080000,0x6aec734e,0x20c35aab,0x08820821,0x5aec1904,0x3186738e,0x18e40841,0x420918c4,0x634d4a6a,0x528c4a4a,0x5acc528b,0x290441e9,0x104120c3,0x292420c3,0x10a218c2,0x21244a69,0x5aec4229,0x314662cc,0x000128e5,0x3a094a4a,0x4a6a4a6a,0x4a4a39c8,0x31a752ab,0x18a41883,0x10821083,0x4a294208,0x10821062,0x08421082,0x20c30842,0x08211062,0x000020e4,
-0x08001041,0x18a30820,0x18e418c3,0x00001082,0x00000021,0x19050021,0x41c839c8,0x316641c7,0x00000801,0x00210020,0x19040021,0x316710a3,0x318841e9,0x41e93187,0x18e53987,0x00000001,0x00000000,0x00000000,0x29450000,0x31652945,0x00002925,0x00000000,0x00000000,0x000018a2,0x000018c2,0x08200000,0x084018a2,0x10400820,0x08200840,0x18a10800,0x08001020,0x10801881,
-0x08202103,0x00000000,0x20c20000,0x10611061,0x20e218a2,0x20c21040,0x20c20840,0x10801080,0x210318e2,0x00010822,0x00210041,0x00210001,0x00010001,0x10630001,0x000118a4,0x00220001,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31020000,0x38e12061,0x41413900,0x51e449a3,0x836a6246,0x5a456ac7,0x732a6ae9,0x41c562e9,0x39633100,0x62886ae9,
-0x41a45a47,0x52266288,0x732a732a,0x5a465aa8,0x49c56288,0x6ae95226,0x8bcd7b4c,0x62886288,0x6b4a5a87,0x10814206,0x08201061,0x08001000,0x10201882,0x20c21860,0x318439c5,0x10411882,0x18a20800,0x20c32903,0x188220e3,0x18c32103,0x210320e3,0x18c318e3,0x00000000,0x20e30000,0x20a32924,0x28c420e4,0x28c11020,0x10001020,0x10001000,0x31200800,0x186028e1,0x20c01880,
-0x5aaa5269,0x20e4526a,0x42093187,0x000039e8,0x10c318a3,0x630c5b2d,0x39875aab,0x29261062,0x39a70842,0x4a8b2125,0x420a4a4a,0x4a2a41e8,0x41c7528b,0x30e43125,0x398649e8,0x08a11061,0x31c60860,0x528a2104,0x5acc62ed,0x10423946,0x00422105,0x39c80862,0x31671083,0x42094a4a,0x188349e9,0x39c718c3,0x528a4229,0x108220e4,0x088310c3,0x188210a3,0x20e420c3,0x10410800,
-0x10211041,0x08001041,0x08620841,0x00000000,0x00000000,0x08830000,0x290539a8,0x00001062,0x00000000,0x21450021,0x420939c8,0x39a831c8,0x294639a8,0x39c83187,0x31883988,0x00000001,0x00000000,0x08410000,0x29450000,0x31863186,0x084120e3,0x00000020,0x00000000,0x21240000,0x18811040,0x000018a2,0x00000840,0x00000000,0x00001061,0x18800020,0x080020c2,0x20c21060,
-0x10810820,0x29441060,0x080018a3,0x10a118a2,0x18a11060,0x20e218a1,0x080018a1,0x106020c2,0x18a30860,0x00010001,0x00000041,0x00010001,0x00210001,0x08210000,0x00010000,0x10630002,0x00010022,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18800000,0x39021820,0x51a351a3,0x51c44982,0x5a456a87,0x6ac75a45,0x6b2a732a,0x5aa841e5,0x49e53961,0x6b096ae9,
-0x6ac9732a,0x6ae97b6b,0x62c86b09,0x49e55a88,0x62c85206,0x5a475a67,0x838d62a9,0x6ac893ee,0x738b5246,0x10812123,0x08000841,0x08001000,0x18800800,0x396420c2,0x29022903,0x292520a3,0x18811882,0x18a21882,0x106120e3,0x20e41882,0x21042945,0x21242124,0x08820861,0x00000820,0x20e420e4,0x20c32904,0x00201040,0x10400001,0x31203142,0x28c13121,0x104020c0,0x208028e0,
-0x18a32925,0x20c420e4,0x108318e4,0x39c70021,0x21252125,0x31862966,0x29255aec,0x002120c4,0x29454208,0x31a718e4,0x10c531c8,0x4a2918c5,0x526a52ab,0x41c83146,0x41c74a28,0x18821020,0x20c320c3,0x31a718e4,0x528a4a6a,0x18a34a09,0x41c80801,0x20e43166,0x10a30821,0x39c71082,0x21054a6a,0x318718a3,0x526a526a,0x10831063,0x10630042,0x18a30862,0x398639a7,0x08211041,
-0x08210800,0x31650841,0x18a32104,0x084218c3,0x4a092125,0x08221062,0x08210821,0x00000000,0x00000821,0x31870862,0x420939c8,0x398831c8,0x20e51083,0x294620e5,0x39a93187,0x00001063,0x00000000,0x00200000,0x18a30000,0x31653166,0x002018a2,0x08410000,0x00000000,0x00000020,0x21030800,0x10811081,0x00000861,0x00001061,0x18a10820,0x18a11081,0x10801060,0x18a218a1,
-0x084018c2,0x294418e2,0x18a120e2,0x188110a1,0x18a10820,0x18a218a1,0x104018c2,0x10601881,0x00010020,0x08620001,0x08420001,0x00010021,0x00010000,0x00010001,0x08210001,0x00011063,0x00210001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20c10000,0x39012080,0x51a251c3,0x5a0251a1,0x62444980,0x72e86265,0x5a467309,0x49e441a3,0x416251e5,0x83ac4183,
-0x7b4a7b6b,0x838d732a,0x62c8736c,0x73096b09,0x62676ac8,0x62886aa9,0x9c50730a,0x734b836b,0x5aa973ac,0x18a30840,0x10411061,0x28e00840,0x39843142,0x20a23964,0x20c420c3,0x292520e4,0x18822904,0x082020c3,0x106118a2,0x212518c3,0x29452125,0x18e41904,0x18e42145,0x108210a2,0x00210001,0x00000020,0x31422923,0x31213141,0x20c028e0,0x102020a0,0x20a03122,0x186020a0,
-0x18c42945,0x18c32945,0x086210a3,0x5acb52ab,0x31674a6a,0x10821062,0x31462104,0x42082925,0x10a310a3,0x210518c4,0x088439c8,0x52ab2946,0x62ec5acb,0x4a4941c8,0x186128e3,0x10611861,0x20c320e3,0x21252104,0x39c72125,0x316641e8,0x4a090821,0x18c33125,0x18a31062,0x18e41082,0x18c34a49,0x18a320c4,0x108220e4,0x000120e5,0x4a4910a3,0x4a094208,0x28e420e4,0x10421883,
-0x39661041,0x20e31062,0x18a31082,0x086220e4,0x00010001,0x08420822,0x08211042,0x000020c4,0x00000000,0x3a092986,0x420931c8,0x398831a8,0x31673167,0x21253167,0x294831a7,0x00002946,0x00000000,0x00000000,0x08410000,0x21043165,0x00002925,0x00000000,0x00000000,0x00200000,0x00000000,0x10811082,0x000018a2,0x00000000,0x18a20000,0x10601060,0x104018c1,0x20c218a1,
-0x10a11060,0x18a118a1,0x00201060,0x18a218a1,0x188118a2,0x18a118a1,0x10401881,0x20c31881,0x00020841,0x00000041,0x00010000,0x00220000,0x00010001,0x00210000,0x08620001,0x08420000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10600000,0x38e11840,0x51c25a04,0x51c259c3,0x5a0351c3,0x51e35a23,0x6ac76ae7,0x5a044982,0x41625a46,0x72e83920,
-0x7b296aa8,0x6ac972e8,0x73095a46,0x5a065a46,0x6aa86247,0x5a47732a,0x8bce7b4b,0x734b5206,0x108173ad,0x00000000,0x08001082,0x39643143,0x29024184,0x10410800,0x18a31041,0x18c318c3,0x292420c3,0x18a220c3,0x18e31040,0x18e418c3,0x18c32945,0x18e42125,0x10c32125,0x000018e3,0x39830000,0x20c03162,0x20c02900,0x28e03101,0x188020a0,0x18401020,0x186020a1,0x080020a1,
-0x29252105,0x29462905,0x52ab2945,0x62ec62ec,0x31255aab,0x292520c3,0x29453165,0x00001061,0x18c35269,0x31a72125,0x4a495aec,0x4a6a52ab,0x526a4208,0x31454a29,0x20a21020,0x106220c3,0x18a32925,0x20e420e4,0x31662925,0x39c73166,0x526a41c8,0x39a7528a,0x108318c3,0x10421042,0x106218a3,0x18831883,0x18a318a3,0x106218c4,0x39c81062,0x39a74a09,0x29251062,0x106218a4,
-0x10830001,0x18620000,0x20e51063,0x08210001,0x00001063,0x00210000,0x10420021,0x08011063,0x00410801,0x00010042,0x31c82167,0x39e83a09,0x31674209,0x296739a7,0x31673167,0x00002105,0x00000000,0x00000000,0x00000041,0x31452904,0x18a33986,0x212439c7,0x00000000,0x00000000,0x00000000,0x00000000,0x10401061,0x00001040,0x00000841,0x10601061,0x10801080,0x10610820,
-0x00000840,0x31650820,0x08610000,0x18c318e3,0x08410020,0x08401061,0x18a11081,0x210418e2,0x00210021,0x00010001,0x00010001,0x00010021,0x00010022,0x00210022,0x08420000,0x00220001,0x00210822,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20201820,0x59c34122,0x59e359e3,0x59e259e3,0x6a8659e2,0x6aa76265,0x5a2449c3,0x51e462a7,0x51e349c3,
-0x51c35a04,0x51e44982,0x51a349c3,0x5a254982,0x6aa86a87,0x62466ac8,0x942f7b2a,0x944facd0,0x000052a7,0x08400000,0x290331a4,0x00003123,0x00001060,0x10410000,0x00001041,0x18c30000,0x084118c3,0x18820820,0x18e41041,0x18c42125,0x10841905,0x10a22105,0x10a10000,0x28c02901,0x31013141,0x31203962,0x28c02080,0x18602080,0x29012080,0x20801040,0x104020a1,0x10201880,
-0x19041904,0x5b0c2986,0x52ab4a6a,0x49c85a4a,0x28e428e4,0x29252904,0x29252945,0x39c739c7,0x3166528a,0x29452966,0x5acb52ab,0x41e762eb,0x28e32904,0x28e32904,0x20c33965,0x104120c3,0x20a33166,0x318620e4,0x292520e4,0x39c818c3,0x62cc39a7,0x398762cc,0x082120a3,0x08010001,0x08210000,0x10610000,0x18c41082,0x42294208,0x08212104,0x00411062,0x08220041,0x18a31042,
-0x18c420c4,0x20c31883,0x21052925,0x08011883,0x00000842,0x00000000,0x00010000,0x00210821,0x00210801,0x00420022,0x31a810c4,0x31c731e8,0x39c831a7,0x00210842,0x18e50862,0x00000842,0x00000000,0x00000000,0x00000000,0x29243166,0x41e83986,0x29652945,0x00201082,0x00000000,0x00000841,0x00000000,0x10a20000,0x10a20020,0x00000000,0x18810000,0x08201061,0x00001082,
-0x10810000,0x00001081,0x00001081,0x10a20000,0x08610841,0x08210000,0x08200000,0x00010841,0x08220862,0x00000842,0x00210862,0x00010001,0x00010022,0x08420001,0x00010001,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20402040,0x51a238e0,0x59c351a2,0x498251a2,0x5a246a45,0x5a456244,0x5a246a86,0x5a255225,0x626651e5,
-0x51e530c0,0x49a351c4,0x5a464982,0x51c44183,0x416351e5,0x834a6287,0xde78838c,0x7baca48f,0x18a11860,0x5aa83164,0x20e341c6,0x10a20840,0x00001082,0x00000000,0x00000000,0x00000000,0x10820000,0x31442102,0x210420e3,0x18a418c3,0x08200000,0x20e139a5,0x20e020c0,0x31213122,0x28e03141,0x310120a0,0x20c020c0,0x20a02080,0x18601860,0x10001860,0x6ac93922,0x59e351e3,
-0x29662125,0x52ab4a6a,0x528a5acb,0x398641c7,0x20e32904,0x29242904,0x18c32104,0x528a0000,0x29454209,0x106218a3,0x5acb3186,0x29044a08,0x29042924,0x41c74a28,0x49e85a8a,0x08213104,0x314541c7,0x316520e3,0x318618c3,0x42094229,0x62ed4229,0x52095aab,0x28c528c4,0x08421883,0x00010001,0x08420000,0x20e40862,0x41e941c8,0x086218a4,0x00011082,0x29452105,0x21050821,
-0x18c318c4,0x10a318c3,0x108318e4,0x08620862,0x002110a3,0x00000000,0x10830000,0x08421083,0x00010001,0x00010001,0x00000000,0x00010000,0x00000000,0x08410841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29253986,0x31863145,0x21253165,0x00000000,0x00000000,0x08210000,0x00000000,0x00000000,0x10610000,0x10400000,0x10620000,0x08200800,0x08001040,
-0x08200800,0x08610840,0x00400841,0x10820862,0x08611062,0x08400040,0x00001061,0x00000001,0x10610021,0x00210000,0x00210021,0x00410042,0x00010021,0x00010021,0x00010042,0x00010001,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30e01860,0x51e451a3,0x51a351a4,0x5a0451c2,0x62456245,0x6a867b08,0x72c76265,0x5a256aa7,0x49a35204,
-0x5a2649c4,0x5a465a46,0x49e451e5,0x62465a46,0x5a4651e5,0x41835a46,0x73096a87,0x39637329,0x52262901,0x290341a5,0x18e320e4,0x10c318e3,0x00000862,0x08610000,0x000010a3,0x00002104,0x39a70821,0x00000000,0x29030000,0x41830820,0x20803142,0x28e03121,0x20802901,0x20a028e0,0x31021840,0x10001020,0x18801840,0x312120a0,0x39413141,0x52055225,0x836a72c7,0x728551a1,
-0x10c32125,0x21252966,0x4a6a2925,0x29043166,0x29042925,0x210420c3,0x29252925,0x39a70821,0x316641e8,0x188318a3,0x62cc3187,0x18813986,0x31652924,0x4a2862cb,0x52294a28,0x20e341a7,0x314520e4,0x20e320e4,0x4a6a2104,0x4a4a528b,0x5acc52ab,0x49e95aac,0x208328e5,0x292520c4,0x10a310a3,0x108310a3,0x10e410c3,0x42094229,0x39e84209,0x39e84208,0x4a2931a7,0x18c339a7,
-0x18c30001,0x18e420e4,0x000118a3,0x00010001,0x000018c4,0x00000000,0x08630000,0x294618e5,0x00011043,0x00000862,0x08620000,0x00010021,0x00000000,0x00210021,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29253166,0x29242924,0x20c32924,0x00000000,0x29041882,0x18a22903,0x20c120a1,0x00000840,0x00200000,0x20e22103,0x28c420e2,0x186120a2,0x39423102,
-0x41a23100,0x39633963,0x10201880,0x10421041,0x08211862,0x08400821,0x08200840,0x00000000,0x10610800,0x10821062,0x00000000,0x00210021,0x00000021,0x00210000,0x00000021,0x08420001,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20601840,0x51e430c0,0x62456226,0x62456224,0x72c772a7,0x62446a86,0x62455a03,0x52045a25,0x49a36286,
-0x414251a3,0x49a34962,0x5a066a66,0x62456267,0x5a6649c3,0x62a75a46,0x49e55a06,0x52055a67,0x208149e5,0x18a21861,0x18e320e4,0x19042124,0x08a31083,0x004110a3,0x00211082,0x21040000,0x10610000,0x29020000,0x28e020e1,0x18801880,0x18601860,0x31013101,0x314220a0,0x20a028c0,0x186028e1,0x28c11860,0x20801860,0x52044183,0x62656265,0x6a8672a6,0x72867ae7,0x6a4459e2,
-0x10a32945,0x210410a3,0x5acb3186,0x39a65269,0x20e339a6,0x29243145,0x10622904,0x5a8a3145,0x31455aab,0x18c320e3,0x4a282104,0x00003165,0x4a2839c6,0x41a649e7,0x39c641c6,0x290439e6,0x39863165,0x39863165,0x39e820c3,0x4a6a4209,0x528b630d,0x18a4524a,0x18631842,0x31a70001,0x10a33187,0x10c40862,0x00210021,0x31e80082,0x39e7426a,0x3a084229,0x18a34a6a,0x29041883,
-0x10411041,0x18c31083,0x00000001,0x08210021,0x00000000,0x08632105,0x00000021,0x31a718e4,0x08220862,0x08420000,0x00000821,0x08420000,0x08010021,0x00000801,0x00000000,0x00000021,0x00000000,0x00200000,0x08400861,0x31250820,0x20a120a4,0x208028c2,0x20803922,0x28c12080,0x18402080,0x31213143,0x418351e4,0x10202080,0x28e02901,0x30e12080,0x41632080,0x31203921,
-0x31213121,0x49a34162,0x49a24162,0x31213100,0x51e449e4,0x41614162,0x5a4549a2,0x39624182,0x08003121,0x08410820,0x00210021,0x00010001,0x00000021,0x18810000,0x00000820,0x10620801,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28e13144,0x39012860,0x51a24120,0x6a6659e3,0x72e772c7,0x72e672c6,0x5a446285,0x59e46266,0x6a664982,
-0x414251e4,0x51815a05,0x5a4559c2,0x52046aa6,0x41a251e3,0x49a462a7,0x6ac85204,0x31015a66,0x10801040,0x00001080,0x210320e3,0x08632104,0x10a418c4,0x08820863,0x00000000,0x00000001,0x31432901,0x106020c2,0x20c01880,0x10601040,0x20e11880,0x28c01860,0x18a02900,0x20a020a0,0x310030e0,0x6ae73100,0x62446285,0x6a857ae7,0x62456a65,0x6a856a65,0x6a646a64,0x9bca7b06,
-0x21040000,0x4a293186,0x39a62104,0x29244207,0x29043185,0x31441882,0x106220e3,0x314518a3,0x290441c7,0x21042904,0x31862104,0x106139a6,0x52695289,0x29242904,0x42083165,0x41c75aaa,0x398718a3,0x4a294a49,0x29453146,0x4a6a2966,0x526a632d,0x526b4a4a,0x28a42083,0x18830801,0x084218a3,0x190518e4,0x004110e4,0x10c30862,0x004110e4,0x214510a2,0x21041904,0x10830821,
-0x10822124,0x10621062,0x08420821,0x00000000,0x00000000,0x000110a3,0x00210020,0x31a731c7,0x08621083,0x00010001,0x08210000,0x08420000,0x18c30001,0x00001042,0x08410000,0x00000000,0x00000000,0x18a20000,0x29232903,0x20a30000,0x41a241a3,0x31213941,0x28e03942,0x310230e1,0x20c120a0,0x41a41040,0x310141a3,0x18403121,0x28e03101,0x310141a3,0x28c062a8,0x28c04182,
-0x28e049c3,0x39014182,0x41824162,0x39414161,0x30e028e0,0x41625a45,0x30e04161,0x39413941,0x39623940,0x29033122,0x00420820,0x00010021,0x10620000,0x00000841,0x08000000,0x08421063,0x00000842,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x312120c1,0x28a02880,0x414130e0,0x6a6649c3,0x5a037ae8,0x6a876244,0x5a256ac7,0x49a34962,0x51c34982,
-0x5a0351e2,0x620349a1,0x62456223,0x5a246a86,0x49a26286,0x41835a66,0x49e428e0,0x5a664183,0x20e11040,0x08202102,0x18c20000,0x004118e4,0x002110c3,0x00000000,0x00000000,0x20e01880,0x18601880,0x20a10800,0x290118a0,0x20e01040,0x188018a0,0x28e03101,0x20a020a0,0x310128e0,0x51c349a2,0x72e77b08,0x72c67b08,0x72a56a85,0x6a6472e6,0x7ae672a6,0x72a57ae6,0x83286aa5,
-0x18c318e4,0x20e418e4,0x20e320e4,0x18c32103,0x188218c2,0x18a20820,0x290320e3,0x41e80800,0x29043986,0x20e320e3,0x31862945,0x21032924,0x4a485289,0x41e828e3,0x526a528a,0x524a526a,0x39a84a0a,0x42084a28,0x18c320e4,0x4a4a2105,0x5aab5aec,0x4a4a526b,0x2884522a,0x10221822,0x00211083,0x21051083,0x08a310c4,0x08610841,0x18e418e3,0x00000041,0x19040021,0x004110a3,
-0x00611903,0x08413166,0x00011083,0x00000862,0x00000000,0x00200862,0x00210000,0x296618e4,0x00210021,0x21050001,0x318639a7,0x080120e4,0x10620801,0x00000000,0x00000000,0x00000000,0x00000000,0x188220a2,0x28e22903,0x392028e2,0x41624182,0x31204141,0x394128e0,0x392128e0,0x20a02900,0x28e020c1,0x394230e0,0x414228c0,0x49e428a0,0x39223101,0x416328a0,0x39413921,
-0x49a33100,0x39214182,0x31003901,0x31213941,0x49a23100,0x49a249a1,0x51e34141,0x39623921,0x5a054143,0x49c33920,0x39423942,0x00001860,0x00000820,0x20c40841,0x08010801,0x08010822,0x00000001,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0x18a00000,0x28e10800,0x28e028c0,0x418320a0,0x59e420a0,0x72e77286,0x41605a24,0x51e149c1,0x5a034981,0x626451e2,
-0x5a046266,0x5a246266,0x6ac76ac7,0x51c35a24,0x49c35a24,0x520541a3,0x41833941,0x52454a05,0x52685226,0x10820820,0x000018a2,0x004018c3,0x00000000,0x20e118a1,0x18a020c0,0x10401860,0x18801860,0x18801860,0x29011880,0x20c020c0,0x18a020e1,0x31212901,0x49e33942,0x7b086a86,0x7ae77b07,0x83089389,0x72c67ae7,0x72e572c6,0x7b0672a4,0x7b077b07,0x7ae68327,0x83488368,
-0x18c30000,0x20e30000,0x20e420e4,0x21042925,0x292520e4,0x292431a5,0x20c32944,0x5a8a0800,0x292418a2,0x20e320e3,0x31662104,0x318639a7,0x41c73986,0x524920c3,0x736e632d,0x734e736f,0x6b2d83f0,0x314549e8,0x20e43145,0x5aab2946,0x524a52ab,0x526a5a8b,0x5a6b5aab,0x186320a4,0x00221043,0x18e410a4,0x18e310a3,0x18e32104,0x08612945,0x00210841,0x10a30841,0x00410021,
-0x00412124,0x10a310c3,0x00002104,0x08410000,0x00000000,0x00210000,0x00000041,0x10c40001,0x298731c7,0x31870883,0x31a741e9,0x082139c8,0x00001042,0x00000000,0x00000000,0x00000020,0x10821062,0x28e11860,0x30e128c1,0x41824182,0x392130e0,0x31214983,0x41a34182,0x39213941,0x31023942,0x20a02080,0x310128e0,0x392120a0,0x52053101,0x30e120a0,0x49a42080,0x49a23921,
-0x41614161,0x31003121,0x39213941,0x418249a3,0x39204161,0x41614161,0x39414182,0x28e028e0,0x49a249a2,0x416230e0,0x414249a3,0x39843921,0x00210820,0x108318a3,0x00010021,0x08620021,0x00000000,0x00000000,0x08200000,0x00001081,0x00000000,0x00000000,0x20e10000,0x18810000,0x394228c0,0x39223921,0x39012080,0x41404161,0x5a036a85,0x62656244,0x62456266,0x62456265,
-0x72c75a45,0x62865204,0x62655a25,0x5a464182,0x5a466aa8,0x6aa749a2,0x52256ac7,0x5a2549c3,0x5aa75245,0x00009c90,0x00000000,0x08400000,0x084018a1,0x18c020e0,0x18a12922,0x29011040,0x10601880,0x186018a0,0x186028e2,0x394120a0,0x49a35a45,0x59e44983,0x72c66aa6,0x72c76a87,0x8b697b07,0x7b077b07,0x7b268348,0x7ae68b68,0x7ae672a5,0xa42b8348,0x93ca9beb,0x7b0772c4,
-0x10821061,0x18a30000,0x4a495aab,0x21042925,0x210418a3,0x210420e3,0x20c32924,0x4a281881,0x290420e3,0x20e318c3,0x29462945,0x39c7528a,0x316641e7,0x29042925,0x7baf4a29,0x7baf738f,0x732d83af,0x522962cb,0x396639a7,0x4a4a2125,0x5acc528b,0x5aac630d,0x526a528b,0x4a295a8b,0x00011063,0x18e40001,0x10c310c3,0x108218c3,0x10821082,0x108210a2,0x10c30862,0x08820861,
-0x00410041,0x00000020,0x00000000,0x00001082,0x00000021,0x00002104,0x00001904,0x31a70021,0x29a731c8,0x39a82987,0x39c839c8,0x188339a7,0x00000801,0x00000000,0x00000000,0x00000000,0x186020a2,0x20a01060,0x30e128c0,0x49c33100,0x39214182,0x394149c3,0x39213941,0x20a03121,0x28c028a0,0x20c028e0,0x290028c0,0x312120c0,0x49c43101,0x28c03101,0x39632060,0x626551e4,
-0x418249c3,0x39623941,0x418249c3,0x49a33921,0x41624182,0x62455204,0x41824162,0x28e03100,0x6a864161,0x6a8730e0,0x416151e4,0x41834161,0x00213144,0x00010000,0x00010001,0x08420000,0x00000000,0x00000000,0x20e20000,0x00000000,0x00000000,0x00000000,0x310220a1,0x18602901,0x20a01840,0x18403101,0x30e11840,0x49a24962,0x51c35a04,0x5a035a24,0x5a255a24,0x6aa76267,
-0x49a149c2,0x62655a44,0x51e351e3,0x51c351e3,0x52054141,0x8bab49a2,0x49e43962,0x52255a45,0x5a665a03,0x31845a87,0x00000020,0x10400860,0x18a11060,0x10601060,0x10801880,0x10601040,0x10401880,0x18601880,0x62663101,0x49a26267,0x51e33920,0x6a855a24,0x59c06a24,0x72a56a63,0x72c672a6,0x7b0772c6,0x83288348,0x7aa672a4,0x8b488307,0x93aa93ca,0x7b078b89,0x7b0972c4,
-0x00000000,0x5aec18a3,0x420962ec,0x188318a3,0x18c318a3,0x106118a2,0x29442103,0x630c630b,0x20e341e7,0x29452925,0x29654208,0x62eb4a89,0x31455aab,0x39653124,0x630c2925,0x630d5aec,0x738f6b6e,0x526a734e,0x41e839a7,0x5aab528a,0x5acc528a,0x4a6a5aec,0x524a52ab,0x41e862cc,0x10631863,0x086210a4,0x210418e3,0x10a218e3,0x18e318c3,0x108218c3,0x18c32104,0x00200841,
-0x10a20861,0x210418c3,0x21250000,0x10a20841,0x00001082,0x00420000,0x39e831c7,0x088208a3,0x39a831a7,0x31a839c8,0x42093187,0x084239a8,0x00000021,0x00000000,0x00000000,0x10600841,0x18a11020,0x31223102,0x31013942,0x49c330e0,0x39213962,0x28e049a3,0x31214162,0x28a03100,0x418230e0,0x31003941,0x28a028a0,0x394251e4,0x310128c0,0x392228e0,0x49c43942,0x394149c2,
-0x41825204,0x416249a3,0x28c04162,0x498249c3,0x49a249c3,0x49c251e4,0x39403920,0x31407b4a,0x41414141,0x49823920,0x49c251c2,0x28e151c4,0x08215246,0x00010001,0x00010001,0x00200001,0x00000000,0x10410000,0x08001881,0x00000000,0x00000000,0x00000000,0x208028e2,0x18403122,0x182028c2,0x20602080,0x208028c1,0x39413100,0x620451c2,0x622559c3,0x5a046245,0x5a2551c4,
-0x73297b49,0x6aa76ae8,0x5a245a45,0x49c25a04,0x41204160,0x83ab6ac6,0x5a45838a,0x62665a85,0x940c62a6,0x83ec8beb,0x08603162,0x002018a1,0x20c10840,0x10200800,0x08401880,0x18801860,0x31412900,0x49e43983,0x49835225,0x51e34162,0x5a0451e3,0x6a866a65,0x72c772a6,0x7b286265,0x72a66a65,0x83498328,0x7ae682e7,0x72c772c5,0x83498349,0x8b288b28,0x7ae68b48,0x72c67b07,
-0x00000821,0x526a0001,0x526b528b,0x18c32104,0x210418a3,0x20e318c2,0x294418a2,0x632c62eb,0x20e341e7,0x31662945,0x29453186,0x6b2c5b0c,0x31245a8a,0x28e43124,0x420820e4,0x630d5acb,0x5aec5aec,0x734e6b2d,0x4a094a09,0x41e84a29,0x42092925,0x5aec5acc,0x62cc52ab,0x18834a09,0x082220a4,0x18c310a4,0x18c318e3,0x18c318c3,0x18c318c3,0x18e418c3,0x18e318c3,0x18e30841,
-0x10820861,0x18c318c3,0x10a30862,0x00000821,0x00200000,0x00411925,0x00420862,0x39e81925,0x292539e8,0x00220001,0x31870821,0x000118e4,0x00000000,0x00000000,0x10820000,0x08400000,0x08000800,0x18401020,0x31213101,0x39623942,0x39013962,0x41a33921,0x39623121,0x41623921,0x394149a3,0x20803121,0x30e03101,0x28c04183,0x30e03942,0x394130e0,0x310028c0,0x39613120,
-0x41824182,0x49a33101,0x31003962,0x394149c3,0x49a230e0,0x41815a45,0x416151e3,0x51e25a04,0x416151e3,0x49824981,0x520449a2,0x41624983,0x30e13942,0x00213143,0x00010001,0x00000001,0x00000000,0x18a10000,0x00001020,0x00000000,0x00000000,0x00000000,0x28a21000,0x28c13122,0x20c01880,0x08001881,0x29011860,0x208020c0,0x49a33901,0x49a36246,0x5a0551e4,0x62a75a66,
-0x6a855a03,0x5a456244,0x62665a25,0x39824183,0x7ac928a0,0x7307838a,0x52045204,0x620449a3,0x836972a7,0x9c4d8baa,0x526583ca,0x18c110a0,0x18a00840,0x20e020c0,0x39623141,0x49c35225,0x4a035224,0x52245224,0x52035204,0x59e45203,0x624551c3,0x6a656a65,0x6a656a65,0x6aa672e7,0x7ae77ae7,0x72e87ae7,0x6a657285,0x8b498328,0x8b698328,0x72e77b07,0x6aa67308,0x624572a7,
-0x5aac52ac,0x4a4a4a2a,0x4a6a4a2a,0x20e43145,0x210320e4,0x20e318c2,0x21231081,0x39a639e6,0x294520e3,0x420831a6,0x39a631a6,0x7b8d6b0c,0x31244a07,0x20e32903,0x18a22904,0x630c39a7,0x31865aec,0x738e5aab,0x49c77b8e,0x20e428c4,0x18c418c3,0x528b39e8,0x5aab528b,0x28c53146,0x104220c4,0x10620821,0x20e32103,0x108110a2,0x18e40861,0x18c310e3,0x20e318c3,0x29242924,
-0x10a318c3,0x18e518c4,0x31a70862,0x000018e4,0x00200020,0x00410021,0x00000041,0x10e41904,0x31c72146,0x00010000,0x08410000,0x00210021,0x00200000,0x00000000,0x08400000,0x20c10820,0x102020a0,0x28e13123,0x394128a0,0x49824162,0x39213901,0x41623921,0x394149c3,0x39413921,0x39204182,0x39414182,0x31213121,0x39413941,0x28a049a3,0x624551e3,0x49c34182,0x39213941,
-0x310128c0,0x41623962,0x394128c0,0x39214182,0x31203120,0x31004182,0x414130e0,0x5a445203,0x51e351c2,0x49824161,0x418151e3,0x41824161,0x41823941,0x5a883900,0x10001020,0x10600800,0x00000000,0x08000800,0x00000820,0x00000000,0x00000000,0x31430820,0x29012901,0x290320c0,0x08000800,0x20811840,0x18801860,0x398220c0,0x49c428e0,0x31205204,0x41424983,0x49a24982,
-0x5a2549a2,0x52035a45,0x49c451e4,0x416341a2,0x49c33100,0x51e45a66,0x520449c3,0x72a749a4,0x93cb8349,0x834893cb,0x8b898b69,0x3a039c4c,0x20e01081,0x49e33961,0x5a246286,0x51e35204,0x52046aa6,0x5a455a45,0x52045204,0x51c351e3,0x62655a04,0x72c772c7,0x72c672e7,0x72c76aa6,0x72c76aa7,0x72e772c7,0x7b086aa7,0x7b077b08,0x72c772e7,0x62856aa6,0x5a4472e7,0x49c351e2,
-0x52ac5acc,0x4a4a4a4b,0x630c5aac,0x20e441e8,0x18c220c4,0x18e30840,0x20e318c2,0x18c32104,0x29452104,0x5aeb528a,0x41e83a07,0x5aca6b2c,0x312439a6,0x31452924,0x20c33145,0x5acb1883,0x6b4d738e,0x736e62ec,0x5a6a736e,0x396628e4,0x296618e4,0x5acc39c8,0x5acc528b,0x2084522a,0x20a41863,0x186220c4,0x18a220e3,0x18e318c2,0x292518c2,0x10a218c3,0x18c21082,0x18c22924,
-0x10a318c3,0x108218c3,0x00000020,0x00000861,0x08610000,0x08620000,0x00210021,0x10a318e4,0x00000001,0x00010021,0x00000001,0x08410021,0x00000000,0x00000000,0x00000000,0x31221060,0x31422901,0x28e12080,0x39214162,0x39413941,0x39413941,0x49a249a3,0x51e43941,0x51e44162,0x416128a0,0x416241a3,0x39413921,0x39413941,0x62663941,0x49c36245,0x39414182,0x31003100,
-0x31014162,0x28e028c0,0x39624162,0x49e43121,0x39613941,0x49823100,0x49a34161,0x62656285,0x626551e2,0x49a251c3,0x30e049a2,0x41825a25,0x39413921,0x41a14982,0x30e04181,0x41a24182,0x08002080,0x00000000,0x00000000,0x00000000,0x00000000,0x312239a5,0x31213102,0x20c020e0,0x292220c0,0x20a03102,0x31423943,0x39613100,0x28c03141,0x51e53101,0x41824162,0x520441a2,
-0x624551c3,0x62866265,0x5a676a87,0x41a33982,0x396249c3,0x49e45204,0x51e449a3,0x6a6551e4,0x9bec8b8a,0x8ba97b08,0x93888347,0x83679c0b,0x622493c9,0x5a0459c3,0x5a455a45,0x51e35204,0x62655204,0x62655a45,0x5a456265,0x62455a24,0x6a8651e3,0x72c76a86,0x7b2972c7,0x626672a7,0x72e8a44d,0x72e86aa6,0x62666a86,0x730872a7,0x5a256aa7,0x5a247b29,0x180028a0,0x28e149c3,
-0x6b4e630d,0x630d6b4e,0x630c526b,0x18624a09,0x00001062,0x21031082,0x292520e3,0x21043166,0x4a282945,0x528a5acb,0x4a292104,0x52496b0c,0x31243144,0x29042924,0x314520c3,0x21250842,0x6b6e738e,0x5aab4a4a,0x730c7baf,0x290528e5,0x21252945,0x42092105,0x5acc5acc,0x5a4a62ac,0x10423105,0x18a320a4,0x18c22924,0x18e32103,0x18a318e3,0x08611062,0x082018e3,0x18c30000,
-0x084118e4,0x10a210c2,0x08400860,0x00000881,0x08610000,0x00010001,0x31871062,0x08211062,0x00010000,0x00010842,0x00210000,0x00000841,0x00000000,0x00000000,0x08610000,0x20c11881,0x31213121,0x28c02080,0x392149a3,0x30c03921,0x28a03941,0x49c349c3,0x39414982,0x28a03921,0x49823920,0x49c33962,0x39413941,0x31214162,0x52043100,0x49a24982,0x41824182,0x28e04162,
-0x41623942,0x39414182,0x41824182,0x39423100,0x392041a2,0x49a228e0,0x416249c3,0x41814161,0x51c351c2,0x41614141,0x41624140,0x41623101,0x418249a3,0x41615204,0x39014141,0x49a451e5,0x18824141,0x00000000,0x00000000,0x00000000,0x00000000,0x39422902,0x28e03942,0x29203141,0x20e02941,0x186028e0,0x31013983,0x20a03120,0x20803141,0x30e33943,0x39623120,0x31203120,
-0x30e030e0,0x5a264161,0x52265a26,0x6ac85224,0x52045204,0x418249e4,0x62a751e4,0x5a035a24,0xa46e8baa,0x8b6793ec,0x936793c9,0x8bcaa42b,0x944c8bc8,0x524462c6,0x5a255a45,0x5a245204,0x52045204,0x520451e4,0x52045a24,0x5a246265,0x6aa66265,0x72c76266,0x7b2972c8,0x5a046a86,0x6a866266,0x72a772c7,0x6a866aa7,0x62866a86,0x184049e4,0x20804162,0x39231800,0x080020c0,
-0x000020e2,0x18e410a3,0x62ec41e8,0x18c36b0c,0x00000841,0x21040841,0x19042124,0x31862104,0x39e82945,0x21452966,0x6b2c41e8,0x526a736d,0x20e328e4,0x20c23144,0x292420e3,0x10a318a3,0x73cf2145,0x6b4d738e,0x41e8734d,0x526a5229,0x21052945,0x39e8420a,0x62cc5aac,0x5a8b5aac,0x4a095249,0x188220e4,0x20c21881,0x18a31862,0x10831882,0x10622105,0x08410841,0x084120e3,
-0x00000000,0x00200840,0x00000000,0x00000000,0x00410000,0x00000021,0x10832966,0x10620000,0x00001062,0x31460001,0x00010021,0x00000001,0x00000000,0x00000000,0x10600840,0x20811020,0x41623921,0x312230e1,0x310028c0,0x39423100,0x31213921,0x39214182,0x30e03941,0x39214182,0x62663962,0x49a249c3,0x31004162,0x39413962,0x836a3100,0x394151e3,0x52044141,0x392149a3,
-0x72e851e4,0x41624983,0x418249a3,0x41824182,0x39425204,0x28c03121,0x41823941,0x31004162,0x41614161,0x30e03940,0x31003940,0x30e03121,0x28a028e0,0x41624162,0x49a330e0,0x39214142,0x20c049a3,0x00000000,0x00000000,0x00000000,0x18600000,0x20803963,0x41833962,0x31213963,0x31413121,0x20a03121,0x31203141,0x20c028e0,0x31213982,0x52253942,0x41833982,0x10001861,
-0x49c330e0,0x39213962,0x51e449a3,0x51e449c3,0x49c35204,0x49c349e4,0x49e46266,0x6a866aa7,0xa42d9c0d,0x8b6993eb,0x9bea93c9,0xa42b8347,0x93ec9c2b,0x49c35a45,0x5a455a25,0x51e45a25,0x5a255a05,0x62456266,0x5a256245,0x62656aa7,0x83496a86,0x6a866aa6,0x5a256266,0x5a455a24,0x6ac76265,0x72c86266,0x31025a87,0x10000000,0x39421000,0x30c03922,0x28a04142,0x28a01840,
-0x00000000,0x00000000,0x10820000,0x29242924,0x00000000,0x00200000,0x18e418c3,0x18c318e4,0x4a492945,0x31c72986,0x7bae630c,0x52296b2d,0x29043104,0x29243165,0x29042924,0x10c420e4,0x39e81905,0x6b6e5aec,0x31656b0c,0x42083166,0x39e931c7,0x62ec4a2a,0x62ac6b4e,0x3987526a,0x20a34a09,0x18a220c3,0x20c32904,0x20e42924,0x20e42904,0x20e418c3,0x000020e4,0x00000000,
-0x08610000,0x00000020,0x18a20000,0x00000820,0x00000000,0x08a30000,0x10632966,0x00011062,0x00000000,0x00010000,0x00000000,0x00000862,0x08410000,0x08200000,0x18a11061,0x28c21040,0x49834162,0x20803922,0x41822080,0x208028e0,0x30e13121,0x498228e0,0x41624162,0x41824182,0x39413921,0x414128c0,0x39413941,0x41613121,0x49a14162,0x41414983,0x49a24161,0x39404181,
-0x62865204,0x41814141,0x418149c2,0x394141a1,0x39423941,0x310028c0,0x30e03121,0x51e34182,0x5a2549a2,0x39404181,0x49c35a24,0x394230e0,0x30e03101,0x39213921,0x41825a45,0x39413901,0x394249c4,0x00002965,0x00000000,0x00000000,0x28e20000,0x39423942,0x398228e0,0x31413942,0x290028e0,0x28c03142,0x312128e0,0x31413100,0x39823941,0x31413141,0x31213121,0x39432061,
-0x41824182,0x41623941,0x51e449c3,0x49c34983,0x5a455204,0x49c35225,0x49c45205,0x7b285a05,0x8baa9c2d,0x93cb8baa,0x9bea93ea,0xa44c93c9,0x838aacef,0x52045a04,0x51e451e4,0x5a455a45,0x5a455a25,0x62665a25,0x72c76aa7,0x6a8672c7,0x6a866245,0x62456225,0x62665a45,0x52056287,0x39626287,0x49e51820,0x00000000,0x20601820,0x288051e6,0x28803901,0x412449a4,0x28a01840,
-0x08000840,0x00000000,0x00000000,0x6b4d0000,0x00000000,0x08410020,0x18e40841,0x18c32104,0x52aa2124,0x21252965,0x736e5aec,0x5229630c,0x31253105,0x20e32925,0x292320e3,0x18e43145,0x422918e4,0x6b6d6b4d,0x41c74a28,0x4a2941c7,0x29672145,0x632d632e,0x6b0d732e,0x28e5522a,0x318541e8,0x39c718a2,0x39c62104,0x31455249,0x20c42904,0x18c318c3,0x00000000,0x00000000,
-0x00000000,0x00200000,0x00000000,0x00000820,0x00200000,0x10c30882,0x08012146,0x29251883,0x00010802,0x00010001,0x00000000,0x00000000,0x08400800,0x00001041,0x08200820,0x20e21860,0x39413921,0x186028e1,0x312141c3,0x31413962,0x20c01880,0x51e43941,0x5a044161,0x41813940,0x39413100,0x41824182,0x28c03962,0x51c43121,0x41626aa7,0x49833941,0x41614161,0x49c249c3,
-0x416051c3,0x8b8c49a2,0x49a251e4,0x31004182,0x41624162,0x28a03101,0x5a253921,0x5a2551e4,0x49c34161,0x51a251c2,0x49a351c2,0x52054161,0x39014983,0x41623921,0x41824162,0x39413100,0x39014162,0x000030c0,0x00000000,0x00000000,0x28e10800,0x31222901,0x39624183,0x39423101,0x39813963,0x20c05246,0x41c43120,0x39623981,0x398249a3,0x39a33141,0x31623162,0x39423942,
-0x39423962,0x49c44183,0x5a4649e4,0x49e45205,0x520551e4,0x49e45205,0x520551e4,0x830849a2,0x8bab93ec,0xacae93ab,0x93caacae,0x93c88ba9,0x8bcb93ea,0x52255a45,0x51e551e3,0x5a4651c4,0x5a465a26,0x62655a25,0x62656286,0x6a666245,0x62466246,0x62466246,0x6aa86226,0x49a46ac8,0x00003121,0x10200800,0x08000000,0x49c530e3,0x10001000,0x28a11000,0x39232060,0x51c549a5,
-0x10401880,0x00001000,0x00000000,0x08410020,0x00000020,0x000018e3,0x21040000,0x10a210a3,0x39e718c3,0x29462965,0x630c52eb,0x5a8a6b2c,0x29043905,0x29042924,0x314420e3,0x20e43145,0x292520e4,0x52aa31a6,0x39c73166,0x20e441c8,0x42292986,0x7bd0632e,0x522a62cc,0x28e53987,0x31c6524a,0x316518c3,0x41e741e7,0x18a43146,0x084120e5,0x000018c3,0x00200000,0x00000000,
-0x00000840,0x10810020,0x00003145,0x00001041,0x10c20000,0x190408a3,0x10832125,0x42092986,0x108318a4,0x00000021,0x00000000,0x08410000,0x08000820,0x18a11041,0x18600820,0x104020a1,0x28a028a0,0x10403101,0x396228c0,0x20c02900,0x18801880,0x5a454162,0x39214162,0x28a04142,0x41824162,0x41823121,0x31004162,0x49a33941,0x5a2530e0,0x5a2549a2,0x49a151e3,0x49c24182,
-0x51e34962,0x628749c0,0x416149a1,0x416230e0,0x418349c3,0x39413101,0x51e441a3,0x310049a2,0x5a444181,0x51c351c3,0x30c06244,0x49a24161,0x49a34161,0x390151e4,0x392151c4,0x39213100,0x39413100,0x30e128c0,0x00000000,0x00000000,0x28e120c0,0x31423142,0x398341a3,0x39413120,0x31403942,0x41a35205,0x41a341c3,0x52053981,0x49c349e4,0x39413962,0x41834183,0x49c44163,
-0x49c441a3,0x51e449c4,0x520549c4,0x520549c4,0x49c45225,0x49c449e4,0x5a265a66,0x936b5a05,0x93eca42d,0x9c2d93ec,0xa44d9c2c,0x93eb9c0c,0x49e483cb,0x31003962,0x6ac83100,0x51e451c4,0x5a255a46,0x5a265a05,0x6aa76246,0x72a76a67,0x6a866245,0x49626245,0x30e049a3,0x10201880,0x20c23123,0x00000000,0x00001020,0x28a13985,0x41831000,0x310128e1,0x30c030e1,0x39023923,
-0x18a02901,0x00001040,0x00000000,0x00000841,0x00200000,0x00000000,0x00000000,0x10820000,0x21242124,0x21452144,0x632d52cb,0x5aab6b0c,0x29043986,0x31452904,0x316539a6,0x31643985,0x20a320e3,0x52691082,0x31654208,0x10620800,0x3a0810a3,0x7bd0632d,0x524a62cd,0x28e53987,0x31462905,0x18c318a3,0x20e439a7,0x20e420c3,0x082020e4,0x00000000,0x10820000,0x00000000,
-0x00200000,0x39c618c2,0x29243165,0x000020c3,0x10820000,0x10c30861,0x00a30021,0x3a093a49,0x082218a4,0x00000001,0x00000000,0x10400020,0x00001881,0x08000800,0x18811061,0x39841020,0x18401840,0x20c03121,0x20c11020,0x41623161,0x20a13122,0x41832900,0x31403940,0x49c351e4,0x31004182,0x31013101,0x41624163,0x41615a44,0x49c24161,0x5a455204,0x418251e3,0x49c34182,
-0x5a244982,0x62864181,0x31215204,0x31214182,0x41834182,0x31013962,0x49c249a3,0x49a24982,0x52045203,0x49a26265,0x520451c4,0x41424162,0x49c34162,0x41622880,0x41822880,0x39214182,0x41623900,0x31005245,0x00000020,0x08400000,0x290020c1,0x31413121,0x49c44184,0x41a341a3,0x416251e4,0x49c44163,0x5a464182,0x49a33942,0x39424163,0x49a44163,0x498351e5,0x416351c4,
-0x49c449a3,0x5a4551e4,0x49c45204,0x520541a3,0x49a349e4,0x51e449a3,0x5a256aa7,0x7aa76aa6,0x93cca42d,0xa44e9c0c,0x8bcba46e,0x944c838a,0x31a19ccf,0x31201860,0x5aa85204,0x520449a3,0x52055205,0x522549a4,0x622659e5,0x520359e3,0x49c24981,0x10004183,0x6b086ae8,0x00000000,0x00000000,0x00000000,0x30e30800,0x39231000,0x41423102,0x49834142,0x41634162,0x520549a3,
-0x41c53984,0x08003144,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x002010a2,0x29652124,0x42292145,0x62cc630c,0x31463986,0x31453146,0x29043145,0x31443144,0x31852944,0x20c32924,0x39a63186,0x292518c3,0x292520e4,0x082231a7,0x632d5aab,0x104262ab,0x20a42926,0x18c418a3,0x20e420e4,0x18c32905,0x18831862,0x00000821,0x00000820,0x00000020,0x18c30000,
-0x00200000,0x39c60000,0x20e32904,0x000020e3,0x00000000,0x08a30000,0x31c710c4,0x4a09424a,0x000120c4,0x00200001,0x00200000,0x08200841,0x10401882,0x08001081,0x00000800,0x20c11860,0x396228c1,0x31214183,0x30e028c0,0x49c349e3,0x102020a0,0x310120a0,0x41834183,0x31013101,0x49c34182,0x41a33921,0x51e449c4,0x5a455a04,0x622551e4,0x6aa672a8,0x41614141,0x51c35204,
-0x5a245a24,0x41624181,0x31003921,0x49a33962,0x31003921,0x418341a2,0x49a249c3,0x498251c3,0x6ac649a2,0x51e351e2,0x49c349c3,0x49c349a3,0x39014142,0x39013921,0x416230c0,0x49c34161,0x51e54183,0x390149e5,0x00000800,0x10400000,0x39621880,0x31203141,0x31213121,0x31423962,0x39213921,0x49c44163,0x418349c3,0x41624183,0x418249a3,0x39413100,0x41634163,0x520549a3,
-0x49a349e4,0x49e45205,0x49a349a3,0x52055225,0x49a34183,0x51e451e4,0x5a255a45,0x6a255a45,0x93cca46e,0xa46e9c0c,0x940c93ec,0x946e9c2d,0x102010a0,0x72c828c1,0x940e93ee,0x520493ec,0x398349e4,0x39633162,0x39413901,0x184028a0,0x62a90800,0x49631000,0x9c2c6aa6,0x0000840d,0x00000000,0x08200800,0x18201840,0x414330e1,0x39414162,0x41634183,0x49a44983,0x51e449a3,
-0x49e62903,0x41a54a06,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x10a218c3,0x18e32965,0x630d424a,0x524a6b0d,0x188218a3,0x314520e4,0x29243145,0x29032923,0x39852923,0x29252924,0x31862104,0x29453165,0x31663166,0x10632945,0x422820e5,0x20e541c7,0x20e41062,0x292518a3,0x29251082,0x4a493166,0x08212925,0x08201883,0x00002924,0x00000841,0x18c30000,
-0x00000000,0x296518c2,0x20c220e3,0x00002924,0x00000000,0x00000861,0x422929a7,0x08224a4a,0x00000000,0x00000001,0x00000000,0x18a20020,0x10611041,0x10610800,0x18821881,0x18601020,0x41a330e1,0x39214142,0x51e449a2,0x49a33921,0x20a120c0,0x18400800,0x28822081,0x182028a0,0x28c02080,0x39423101,0x39213101,0x39005204,0x49805a45,0x62656203,0x51e349c3,0x41824982,
-0x51e44182,0x31004181,0x41824183,0x416249c3,0x310049a3,0x51e441a2,0x49c249a3,0x498151c3,0x72e749a2,0x416249c2,0x39214142,0x49c33941,0x31003941,0x28a03901,0x5a453921,0x41824161,0x20603102,0x38c02061,0x000020c0,0x29220000,0x31412900,0x41a33961,0x39823141,0x41a33942,0x31013962,0x41833102,0x30e03941,0x49833942,0x49a249a3,0x39414161,0x41424163,0x49a349a4,
-0x41a34183,0x49e43942,0x49e449c3,0x52055a25,0x51e449e4,0x5a255a25,0x5a2551c4,0x6a455a25,0x93aba44e,0x9c2da44d,0x8b8a93ec,0x31429c2c,0x28a110a0,0x93ca5222,0x942aa44d,0x9c4daccf,0x210062e8,0x08003162,0x52063941,0x39633925,0x000028e1,0x49223101,0x93ca51c2,0x0820a4d0,0x00000000,0x6b2b3164,0x39221000,0x41633941,0x49c24182,0x51e55205,0x51e449a4,0x418351c4,
-0x314318a0,0x31420800,0x000028c2,0x00002923,0x00000000,0x00000000,0x00200000,0x00420000,0x4a6a52cc,0x6b0d5b0c,0x41a76b4d,0x188228e4,0x31453145,0x31453145,0x29032103,0x39a63144,0x31442924,0x29451882,0x29453186,0x4a494a29,0x29244a28,0x39a61041,0x39a72924,0x4a4918c3,0x52495aaa,0x31663166,0x28e520e3,0x39a741e8,0x00001062,0x00000000,0x00000020,0x00000841,
-0x00001061,0x00000840,0x00002103,0x10820020,0x08611061,0x08a30061,0x41e939c8,0x000120c5,0x00000000,0x00000000,0x08200840,0x18820000,0x08210820,0x18811061,0x106020c2,0x290120a0,0x310128c0,0x39203941,0x49823920,0x41414161,0x28c03101,0x18203962,0x20802080,0x41843942,0x20602080,0x41823921,0x51e43900,0x59e449a3,0x62446265,0x52038329,0x51c449a3,0x39415204,
-0x41424162,0x416149c3,0x49c43941,0x49c35a46,0x49a24182,0x49a26aa6,0x49c349a2,0x51e34161,0x49826245,0x498249a2,0x392149a3,0x49e44182,0x41413921,0x416230e0,0x39013921,0x28c149e4,0x288028c1,0x39211000,0x08001820,0x20a01860,0x39623982,0x314141c3,0x29013942,0x41623100,0x418349c4,0x41834183,0x49a44183,0x49c35206,0x49c449c3,0x39213942,0x52064183,0x49834142,
-0x49c449c4,0x49c449e4,0x520451e4,0x52255a65,0x41825225,0x522549c3,0x5a2551e4,0x622551e5,0x9c2e8b8b,0x9c4ea44e,0x83cb9c4e,0x39c46b0a,0x62073122,0x8b486264,0xacaea40b,0xa46cacad,0x628593eb,0x00002900,0x20a10000,0x182041a4,0x41640000,0x49c36268,0x49a330c0,0x00000000,0x49851820,0x204028a0,0x39223901,0x41624142,0x49a44183,0x41a349a3,0x41824182,0x41a34182,
-0x290320c2,0x08001020,0x292328e2,0x08206aea,0x00000000,0x00000000,0x00000000,0x00010000,0x4a4a5b0c,0x736e73af,0x39877baf,0x10011882,0x39663145,0x20e33145,0x312420e2,0x29242903,0x29043145,0x20e420e4,0x316520e3,0x4a2839a7,0x29252945,0x210420e3,0x31462925,0x526a1062,0x6aec7bae,0x29033144,0x082120e3,0x39a70000,0x00002925,0x00000000,0x00000000,0x10820861,
-0x28e30000,0x00000820,0x00000000,0x20c239a6,0x00000000,0x004110a4,0x104331c8,0x08220842,0x00000000,0x00000000,0x10a20000,0x08200840,0x104118a2,0x18601060,0x082020a1,0x29011880,0x28c041a3,0x30c03920,0x390051c3,0x41414161,0x394128e1,0x41823941,0x49c34182,0x20803100,0x28c11020,0x418241a3,0x51e451e4,0x496249a3,0x624451e3,0x394051a3,0x30e049a2,0x39413100,
-0x41623921,0x414149a2,0x49c23900,0x41614982,0x49a251e3,0x49c36ac7,0x51c33920,0x49e43962,0x39205a24,0x498249c2,0x416249c4,0x39414162,0x51e43941,0x416228a0,0x39414162,0x20803941,0x28811000,0x52251801,0x18201000,0x39421880,0x39624184,0x39623982,0x39623141,0x39414182,0x41a33942,0x41844184,0x31013963,0x39413962,0x41834182,0x41a33962,0x5a4751e5,0x49e449c4,
-0x41a341a3,0x520549c4,0x522551e4,0x5a455225,0x5a255204,0x5a665a66,0x7b295a45,0x59e46247,0xac8f838b,0x940ea48f,0x942f9c4f,0x31023143,0x51634984,0xa46ea44c,0xb4cfac4c,0xa42bac8c,0x9c2ba40a,0x4a258c4b,0x10001060,0x5a471840,0x5a050000,0x52256aeb,0x20806225,0x18001820,0x31015206,0x51c45204,0x498249a3,0x51c449a2,0x62465a05,0x522549c4,0x49a349c3,0x49e451e4,
-0x08000800,0x41a61020,0x188120e2,0x290220e2,0x000041a5,0x00000000,0x00000000,0x00610061,0x5b2d31c7,0x7b8f7bcf,0x30e462ec,0x290428e3,0x312428e3,0x31242903,0x290330e3,0x290320a1,0x31452903,0x20e32945,0x08214229,0x4a2939a7,0x39a74a49,0x29663186,0x39e82945,0x7baf39e8,0x628a630b,0x104028e3,0x084118c3,0x10620000,0x20c339c7,0x00001062,0x08000820,0x10621061,
-0x21031881,0x082018a2,0x39a60000,0x106239a6,0x00010000,0x00012926,0x00020843,0x10830863,0x08000000,0x00000000,0x08400000,0x00000000,0x104018a2,0x18810000,0x10601040,0x39421040,0x39414162,0x41423921,0x41614162,0x41625204,0x418249a3,0x49823921,0x41823921,0x39013901,0x39624183,0x394151e4,0x49a23920,0x49a23920,0x51e351e3,0x498351c3,0x28c03921,0x310030e0,
-0x6ac74982,0x5a4549a3,0x5a455a25,0x498249a1,0x51c249a2,0x5a2451e3,0x51e451c3,0x20a05204,0x30e03941,0x49a251c3,0x39413920,0x49a330e0,0x39413941,0x49a34182,0x416230e0,0x20402060,0x28a01800,0x41821000,0x20601000,0x39413101,0x39424184,0x312249c4,0x29013121,0x39634163,0x41c43121,0x41833983,0x31413962,0x520541c3,0x5a2549e4,0x49c441a3,0x520551e4,0x49a33962,
-0x49a44183,0x41624183,0x520551e5,0x51e45225,0x52045205,0x62455a25,0x5a4551e4,0x5a056225,0x9c0d8bcc,0xacb09c2d,0x4a279c8f,0x52260000,0x836a6227,0xac8ea44d,0xb4ceac8e,0xa46ba44b,0x9c0aa44b,0x8bc99c0a,0x394262e7,0x08201880,0x28a00000,0x1000730a,0x62870800,0x20406269,0x59e54983,0x6aa86a67,0x5a046247,0x5a246225,0x8baa7b49,0x62877b2a,0x5a666267,0x520449c3,
-0x10201020,0x10200820,0x29230800,0x312341a5,0x08201881,0x00000000,0x00000000,0x19241904,0x845131c7,0x5a6b83d0,0x20c330e4,0x20c320a2,0x398520a2,0x31042903,0x28e228e3,0x18a220c2,0x29042904,0x00002103,0x18e4632d,0x526a41e8,0x528a62cc,0x4a495acb,0x52cb528a,0x8c317bcf,0x41865a49,0x28e42082,0x00001061,0x084218a3,0x188220e4,0x20e41041,0x000018a2,0x29250000,
-0x00000000,0x00000020,0x292420c3,0x08210820,0x41e931a7,0x20c44209,0x10a418a4,0x00200021,0x10001061,0x10410800,0x08201082,0x000018c2,0x00000841,0x20c20800,0x10400820,0x390120a1,0x39413962,0x310030e0,0x39005a25,0x49a34982,0x41624162,0x41623941,0x624628c0,0x39213921,0x28c04183,0x49824161,0x416151e3,0x49815a24,0x49a349a2,0x414251c3,0x41824162,0x30e03962,
-0x52044162,0x5a2449a2,0x52036265,0x51c27308,0x51c34981,0x51c251e3,0x51c449a2,0x41a35204,0x41624983,0x51e451e4,0x41a349a2,0x49c34182,0x51e449c3,0x520449c3,0x394051e3,0x20603921,0x28a030e1,0x414230c0,0x52053101,0x416228e0,0x39834163,0x28c03121,0x312120c0,0x41834183,0x39633942,0x396241a3,0x49e43962,0x49a349e4,0x49c449c4,0x49e45205,0x520549c4,0x39214183,
-0x49a449c4,0x49a449a4,0x522549a4,0x52055a46,0x5a2551e5,0x62866266,0x5a2551c4,0x62666245,0x8bac93cc,0xa49093ec,0x20e1a4b0,0x626649c5,0x8b8a7ae9,0xac8ea46e,0x9c2bac6e,0xb4aca46b,0xacac9c0a,0x9c0aa44b,0x83688bc9,0x29016b08,0x41c40000,0x00001020,0x184028a0,0x51a32860,0x6aa76245,0x6ac76245,0x624572e8,0x6a6659e4,0x7ac76a66,0x72e96ac8,0x5a456aa8,0x5a455a45,
-0x080020a1,0x080028e3,0x00000000,0x39640800,0x08400800,0x00000000,0x00000000,0x298610c2,0x84315aec,0x49e88c31,0x18a31883,0x080018a2,0x312418a2,0x292328e3,0x18812903,0x20c220c2,0x18a11061,0x31862924,0x39e873ae,0x524a2104,0x6b2d4a49,0x4a495aab,0x7c10630c,0x7b0d9c72,0x30e530a4,0x18822925,0x08421082,0x18c318a3,0x10621062,0x10a20021,0x00202124,0x00000841,
-0x10211000,0x31a53164,0x21252925,0x420939e8,0x41e839e9,0x102120c4,0x08001041,0x18831021,0x20c320c3,0x082118a2,0x18a21081,0x10400000,0x10600000,0x18a120e2,0x29021040,0x49a420a0,0x41624162,0x41623983,0x49c34162,0x51e34182,0x416249c3,0x39014182,0x39215a25,0x392149a3,0x49a33961,0x51e32060,0x49c349a2,0x41815a04,0x49a34981,0x520451c3,0x416249a3,0x49a36266,
-0x51c349a2,0x5a0351a2,0x51c25a04,0x626651e2,0x49c14140,0x51c251e2,0x6a873900,0x41614161,0x49c34161,0x49c33941,0x39413921,0x49a349a3,0x41823941,0x51e351e4,0x30e06245,0x49a34182,0x52053101,0x180028a0,0x30e072c8,0x416249c4,0x41a34183,0x39623962,0x49a428a0,0x416349c5,0x49e54183,0x41a262a9,0x5a464161,0x49a35225,0x52055205,0x51e44183,0x49c44183,0x394249e4,
-0x41634163,0x522551e5,0x49a35225,0x5a264983,0x5a255a26,0x6a876266,0x59c45a45,0x836a7286,0x8bcc9c0c,0x9c50a4b0,0x49c44185,0x93ee6287,0xa44e9c2e,0x93eba46e,0xb4ceac8e,0x9c0a9c0a,0x9c0ba42c,0xa44c9beb,0xac8da44c,0x73478baa,0x5a4749e4,0x00200000,0x20601840,0x39203900,0x624551c3,0x5a245a04,0x5a255a03,0x62048329,0x834a6a86,0x5a255204,0x62875a66,0x62875225,
-0x080018a1,0x08000800,0x10400800,0x100020a1,0x080028c2,0x00000000,0x00000000,0x18e41903,0x84317bf0,0x31058c11,0x20e420c4,0x080018a2,0x20e320c3,0x29232103,0x28e228e2,0x082020a1,0x10811040,0x39c72945,0x4a6a7bcf,0x39a71082,0x526a528b,0x212539a7,0x7bf0738e,0x524a41e8,0x10423966,0x18823986,0x10821062,0x106218a3,0x4a2918a3,0x084239c7,0x296610a3,0x4a495acb,
-0x290541c8,0x10833147,0x42093187,0x39c939e8,0x29254209,0x18831863,0x00000801,0x20e40801,0x18a320c3,0x00001082,0x084020e3,0x104118a2,0x31441882,0x20c21881,0x18801040,0x41631860,0x28e04183,0x310120a0,0x41823941,0x49a33100,0x498251e3,0x390049a2,0x416249a3,0x41825204,0x628749a2,0x28c03901,0x5a4551e3,0x51c249c3,0x418249a2,0x49a34161,0x39003921,0x41824182,
-0x51e45a04,0x62246265,0x49815a03,0x5a044981,0x49a14161,0x416072e6,0x6a8651e3,0x5a044982,0x41825a24,0x49c349a2,0x49a351e4,0x52255225,0x49834182,0x52044162,0x49a34182,0x41824182,0x41613100,0x10003922,0x41a33901,0x394249e4,0x31213942,0x396241c4,0x41a43942,0x31003962,0x6aa84142,0x39416ae9,0x52054963,0x49c449e4,0x49e45205,0x41a349c4,0x52055a25,0x49c44183,
-0x51e54183,0x522551e5,0x520451e4,0x5a2651c3,0x62875a05,0x5a255a26,0x62255a05,0x93ec7ac7,0x8bcc9bec,0x1000942e,0x49632080,0xa4705a06,0x9c0da44f,0x9beb9c2d,0xac8dacaf,0xa44cac6c,0xac6dac6d,0xacaea44c,0x9c0ba44c,0x9c4da44c,0x8be89c2a,0x8ba77b06,0x836bacce,0x39004982,0x5a256266,0x51c35a25,0x39204160,0x59c351c2,0x62665a04,0x62866aa7,0x62876266,0x62875a46,
-0x310228e2,0x31233123,0x316520c3,0x30e52883,0x49e92042,0x100020a4,0x00000800,0x4a8a2145,0x7bf06b4d,0x39c7736e,0x20c320a3,0x18a22924,0x086118c2,0x20e32104,0x20e218c2,0x31852924,0x31443165,0x4a492924,0x31a7630c,0x20a318c3,0x18c328e4,0x20e42104,0x08830862,0x298610c3,0x29054a4a,0x41e82946,0x108218c3,0x082120c3,0x420918e3,0x41e94a29,0x39e84a2a,0x3a0831a7,
-0x42094a2a,0x39c8420a,0x4a4a422a,0x4a094a4a,0x080128c5,0x00021062,0x00000001,0x18c30000,0x10411882,0x10610000,0x000018c2,0x10a10000,0x31240000,0x18811840,0x10401040,0x30e01860,0x20804163,0x208018a0,0x41623100,0x49824162,0x5a044141,0x20803121,0x394128c0,0x41614161,0x30e04182,0x41623941,0x49c328a0,0x49c249c3,0x49834181,0x51e36266,0x51e351e3,0x72e84141,
-0x51e26265,0x5a2351e2,0x39204160,0x51a24161,0x51e36224,0x6aa649a2,0x5a245a03,0x49824981,0x51c35a24,0x520349c2,0x41a251e3,0x5a055204,0x51c351c2,0x49a251c3,0x49a249a3,0x51e549a1,0x08002080,0x10001001,0x39223922,0x41633963,0x49e44163,0x49a349a3,0x41a349e4,0x394249c4,0x52044162,0x41625225,0x49a349e4,0x49c46246,0x51e45205,0x49e45205,0x49e451e4,0x52053942,
-0x52054162,0x51c441a3,0x51e549c4,0x520449a4,0x51a26a87,0x5a2451a2,0x5a056246,0x93ab8b2a,0x8bcd9bcc,0x18409490,0x51a54144,0xa46fac70,0x8b8bac8f,0xa44c93ab,0xac8eb4ae,0xac6da44c,0x9c0b93ca,0xa42c93ca,0x940c93aa,0x9c4cac8e,0xa46d9c4c,0x72c693ca,0x49816284,0x520330e0,0x62875a67,0x5a266287,0x39204162,0x62465a05,0x62456245,0x49c45a25,0x52044182,0x5a045a25,
-0x49c728c3,0x6b0c5269,0x5a8b5aab,0x6aec6acc,0x6b0c732d,0x6aec7b8f,0x41863966,0x29253966,0x4a4939a7,0x39a762ec,0x20e320c3,0x29441081,0x08402924,0x29442104,0x290320e3,0x62eb4a07,0x292341c6,0x39a739c6,0x5aec5acb,0x10423166,0x528a3967,0x10822945,0x00000021,0x10c40862,0x4a2939e8,0x4a4a4229,0x42094209,0x18831842,0x4a4a18a3,0x21054209,0x31870822,0x4a4a3a09,
-0x42094a2a,0x4209420a,0x420941e9,0x41e94a4a,0x080120a4,0x08220862,0x08410001,0x00010821,0x00000820,0x00001062,0x10610820,0x20e32103,0x000018c2,0x00001881,0x18a11060,0x30e13984,0x18203942,0x5a661880,0x30e04142,0x49824162,0x390051c3,0x418228e0,0x39414182,0x39214982,0x30e04162,0x28e03100,0x39413100,0x39404161,0x6a864161,0x51c36286,0x49a24982,0x5a048369,
-0x51c251c2,0x51c459e4,0x622472e8,0x5a036265,0x41415a03,0x49a251e3,0x41615a04,0x39004982,0x62654982,0x52036285,0x49e351e3,0x51c33940,0x51e351e3,0x5a0451c3,0x51a351c3,0x30e049c2,0x08002080,0x10001000,0x394230c0,0x41833942,0x31014163,0x41834183,0x41624183,0x41a349c4,0x31004162,0x62a75225,0x5a2551e4,0x49e449a3,0x41a349c4,0x52054183,0x62665225,0x416249c4,
-0x49e441a3,0x51c449e4,0x49c449c4,0x51e451e4,0x49a349c3,0x52045204,0x6aa751e4,0x9c2e9bcc,0xacf293cc,0x30c21020,0x5a0651e5,0xa46ea42f,0x9bedb4f0,0x93eb8b8a,0xac8d93ca,0xac6da44c,0xa42b9beb,0xa42ba44c,0x9c0b93ca,0xac8da42c,0x93ea9bea,0x62648baa,0x6aa86aa7,0x52043920,0x62675a46,0x6a876267,0x51e35a05,0x51a44183,0x5a0549a4,0x39403940,0x31002040,0x39214142,
-0x734e6b0d,0x736f6b2e,0x736f7bb0,0x7baf6b0c,0x736e7b8e,0x7bae630c,0x5a696b0c,0x4a094a49,0x5a8b49e8,0x210441e8,0x20c32904,0x20e32104,0x18c21082,0x18e218c2,0x20c220e2,0x39a641c6,0x29032103,0x41e82965,0x6b6e632d,0x29252966,0x20e428e5,0x20c42905,0x00000861,0x08a30062,0x4a8b08c3,0x5acc528b,0x5aab4a29,0x18435a0a,0x39c828e6,0x29064209,0x00420842,0x4a8a31c7,
-0x526b4a6b,0x39e94a4a,0x4a4a422a,0x20c4420a,0x10421022,0x00010000,0x10620001,0x00001883,0x08210000,0x20e30841,0x084018a2,0x18c31061,0x00001062,0x00000840,0x20e21881,0x30e028e1,0x41833102,0x30e03101,0x310049a3,0x49824162,0x41423900,0x392141a3,0x41a349a3,0x51e34162,0x416149a3,0x62865a66,0x51e34161,0x39203941,0x49c24161,0x62655203,0x5a2472c7,0x5a2351c2,
-0x62645a24,0x51c25202,0x5a245a03,0x622351e3,0x62444981,0x5a0349a2,0x62446a85,0x49825a04,0x6aa64161,0x5a4551e3,0x41a251e3,0x62445224,0x62456a66,0x51a351e4,0x59e459e4,0x28a04181,0x08001020,0x28e11000,0x39434182,0x392241a4,0x31214183,0x49a33942,0x41834162,0x51e451e4,0x626649c3,0x62875a25,0x5a255a66,0x5a255a45,0x41835205,0x41834183,0x5a255a66,0x520549c4,
-0x49c449c4,0x51e441a3,0x51e551e5,0x520449c4,0x520549c3,0x62876ac8,0x83296266,0x940d93ac,0x08007bac,0x514328c4,0x93ec940d,0xacafa44e,0xac8facaf,0x9c0bac8e,0xa42b93ea,0xa42ca42c,0xa42c9beb,0x93c8a44c,0x9bea93c8,0xa40aa42b,0x8b679bc9,0x6aa68baa,0x10406223,0x6286834a,0x62876ac8,0x30c05226,0x28e22060,0x414383ac,0x28602880,0x10002040,0x394130c0,0x31003941,
-0x734e62ed,0x8c117b8f,0x6aed83d0,0x62ed62ed,0x732d734e,0x736e7b6e,0x734d6b2d,0x5a8a5aab,0x5a6a62ab,0x18a220e3,0x18821061,0x292420e3,0x20c320c2,0x292418a2,0x20e318a2,0x20e32924,0x292420c2,0x4a2820e4,0x5acb5aaa,0x39a741c7,0x28e53166,0x20e42105,0x108310a3,0x00410042,0x31e808a3,0x526b426a,0x5acc5aac,0x526b526b,0x5aac524b,0x41c8528b,0x08421062,0x3a0918e5,
-0x4a4a4229,0x41e84209,0x4a4a3208,0x188341e9,0x00010801,0x00010000,0x10210000,0x20c420a3,0x000020c2,0x18a20820,0x00000820,0x18a20000,0x10400840,0x188118a1,0x10601040,0x28e11060,0x41833922,0x39624162,0x49834163,0x498251e3,0x49a249c3,0x49c33920,0x31004162,0x51c351c3,0x41615a04,0x62655a25,0x51c349a2,0x5a244982,0x416151a2,0x62655a24,0x51e45a24,0x7ae87b08,
-0x51c25a03,0x51c25a03,0x51e35a23,0x51e25a24,0x51c251e2,0x7b076a85,0x51c35a03,0x392051c2,0x6aa659e3,0x5a0351e2,0x51e36245,0x62455a24,0x5a035a03,0x51e34140,0x51a351e3,0x18004983,0x08001020,0x394328a1,0x41624183,0x51c451e4,0x49834163,0x392149a3,0x49c449c4,0x49c449c4,0x6ae95225,0x52257309,0x6aa751e4,0x52255225,0x522549e4,0x52055205,0x51e45a46,0x41a351e4,
-0x51c451c4,0x51e45a05,0x5a2549c3,0x72e86266,0x6a8751e5,0x520572c8,0x5a245a05,0x8bed6a87,0x3143836b,0x5a2551a3,0x9c0ea44d,0xa42da44e,0xa44cac6e,0xa42c9beb,0x93a9a42b,0xa44ba44c,0x9c2a9c2a,0x93889c2a,0x9bca93a8,0xa3e9a40b,0x93678b46,0x49608308,0x93cc5a03,0x942da48f,0x41a46266,0x7b2b30e1,0x28a051e5,0x942e3982,0x08007b2b,0x39625202,0x41a48bee,0x41624163,
-0x524a6b0d,0x6b0d6b0d,0x6b0d7b8f,0x62ec7b6f,0x736e7b8f,0x62ec732d,0x6aec6b2d,0x72ec6aec,0x20834187,0x29042924,0x292420c3,0x20c320e3,0x18a23144,0x18c21061,0x29442104,0x39854a28,0x39855249,0x31652104,0x6b4d2104,0x41e83987,0x20a339a7,0x108320e4,0x108308a3,0x00410062,0x29a708c4,0x5aac426a,0x528b5acc,0x526b5a8c,0x4a4a524b,0x41a84a0a,0x20c53146,0x42092946,
-0x42094a4a,0x00000021,0x39e80021,0x08424a29,0x00000001,0x00000000,0x10610000,0x20e30000,0x18a20800,0x08411081,0x18c218a2,0x084118a2,0x10401081,0x08201040,0x00000820,0x28c01880,0x28c03101,0x20a028c1,0x41622880,0x41824182,0x28c04162,0x418249a2,0x39413901,0x390049a2,0x6a8551c2,0x49c151e2,0x49a151e2,0x51c249a1,0x51c24961,0x51e24161,0x414051c2,0x72c751c2,
-0x49a25a24,0x416051e3,0x5a035a03,0x626551c2,0x72c75a04,0x5a2451c2,0x49a259e3,0x392030e0,0x59e351c2,0x51c26246,0x520351e2,0x62655a44,0x59e45a24,0x622559e4,0x414149a3,0x286130c0,0x18002040,0x416328a1,0x49c34183,0x51c449a3,0x498351c4,0x49834162,0x41424142,0x520541a3,0x414149c4,0x72e83921,0x49c35a46,0x52055204,0x5a465a66,0x49e449a3,0x51e449c4,0x41835a25,
-0x51e549c4,0x520451e4,0x51e351e4,0x49a26266,0x5a265a24,0x73096267,0x6a866246,0x8bcd6266,0x40e01860,0x9c0d8bab,0xa44d9c0d,0x9c0ba46d,0x9bebac8d,0x9c0ba44c,0xa42b9bea,0x9beaa44c,0x9c0a9c0a,0xa42a9c0a,0x93899bea,0x93679bca,0x832682e5,0x28207ae6,0x8b4861e2,0x9c0c93cb,0x1840940d,0x18401000,0xd54f7a86,0x940cc52e,0x41006a65,0x732949a3,0x62a87b6a,0x396249c4,
-0x736e6aed,0x734e734e,0x6b0d62cc,0x62ed6b2d,0x6b2d62ec,0x6b2d6b2e,0x734d6b0d,0x5a0962ec,0x28e43905,0x4a285249,0x20c32925,0x316618c3,0x20e41082,0x29451082,0x318639e7,0x39a74208,0x52695aab,0x20e339a7,0x734e3126,0x524a62ab,0x20c44a29,0x002118a3,0x10a31083,0x08620883,0x31c808a3,0x4a4a422a,0x630d526b,0x4a4a62ed,0x4a4b4a4a,0x5aab39e8,0x4209526a,0x316741e9,
-0x08022926,0x00010000,0x39a831a8,0x18e54209,0x00210001,0x00000000,0x10a20861,0x31a60861,0x10002103,0x08202904,0x31452903,0x10820840,0x082018a2,0x08400860,0x18c10000,0x314318a1,0x20a028a0,0x20a020a0,0x39212060,0x51e43101,0x39214182,0x39414162,0x39213921,0x59e33920,0x51e34161,0x624451c2,0x49814160,0x62454982,0x62445a24,0x62454140,0x62647b07,0x72e76265,
-0x626551e3,0x62866ac7,0x62456aa7,0x51e351a2,0x7b085a03,0x622451c2,0x5a244141,0x62256a86,0x6a866244,0x51c272e7,0x520349a0,0x624449c2,0x624472e6,0x41a15a03,0x18404182,0x10000800,0x28c21820,0x49a41820,0x49a249a3,0x49a349a3,0x498349a3,0x39414182,0x418341a3,0x49c449c4,0x49c449c4,0x418349a3,0x51c449c4,0x49c451c4,0x520551e4,0x49c44183,0x520551e4,0x51e45205,
-0x520549a3,0x49c449e4,0x5a255205,0x51e45a45,0x62655a25,0x62455a24,0x5a255a45,0x838b5246,0x51a34920,0xa42d9c0d,0x9c0ca44d,0xa44c940b,0x9c0ba42c,0xac4ca42c,0x9c0ba42c,0x93ca93ca,0x93a993ca,0x93ca9bea,0x93a993ca,0x93898b68,0x5a6572e7,0x200030a0,0x6a034962,0x934a8307,0x93aa7ae7,0x82e79bca,0xbc6a7222,0xbcacac29,0x93eabcee,0x8b8ba44e,0x83ac72c7,0x49a44a06,
-0x6b0d7b6f,0x6b2e7bb0,0x732e62cc,0x5acc6b4e,0x6b4e6b2e,0x734e6b0d,0x730d736e,0x30e46aab,0x526a3946,0x41e75aab,0x20e31062,0x20e43165,0x18a32104,0x21242945,0x31452104,0x62cb5acb,0x62cb62eb,0x28e44166,0x5aab3126,0x4a2962cc,0x2905526a,0x10a318a4,0x18c410a3,0x002118e4,0x3a2a0062,0x4a6b424a,0x4a4a526b,0x5aac4a4a,0x4a4a528b,0x318718c5,0x4a4a4209,0x4209422a,
-0x4229422a,0x41e939c9,0x422a422a,0x102241e9,0x00011022,0x08410861,0x08810841,0x086118c2,0x18820841,0x29240800,0x188220e3,0x000020c3,0x08600000,0x00000820,0x18c10000,0x104020e2,0x20c11040,0x20a02901,0x28c02080,0x28c02080,0x20604182,0x394128a0,0x41623921,0x51a14182,0x414049a2,0x51e351c2,0x41406a66,0x59e349a1,0x416072c6,0x5a044160,0x51e251e3,0x62456265,
-0x62446245,0x6ac76265,0x28c03100,0x49a241a3,0x416051a2,0x51c24981,0x5a2449a2,0x62455a25,0x498259e3,0x5a035202,0x5a4451e3,0x72c66265,0x6a866a85,0x31034161,0x08401860,0x4a250000,0x100028e0,0x416230e0,0x41823920,0x51c44182,0x416249a3,0x49c34162,0x49e45205,0x41834183,0x49a349a3,0x49a35225,0x51c449c4,0x51e55205,0x52055205,0x51e451e5,0x52055205,0x52055a46,
-0x49e449c4,0x520551e4,0x6a875a46,0x52045a45,0x62455a25,0x62456245,0x62866246,0x51e46246,0x93eb3920,0x93ec8bec,0x9c0c93ec,0x9c0b9c2b,0xa44ca44c,0x9c0ba44c,0x9c0b9c0b,0x8b899bea,0xa42ba42b,0x93ca9c0b,0x7b4893ca,0x5a247b28,0x20c041a3,0x08000000,0x18201820,0x72654941,0x8b477a85,0x82c682e6,0xaba59b25,0xd5aed50d,0x9c0cd591,0x288059e3,0x8c0d8349,0x394262a8,
-0x8c116b2e,0x83d083f1,0x62cc8bf1,0x734e6b2d,0x732d736e,0x734e6aec,0x6aec7b6e,0x4a293946,0x4a2962cb,0x10013146,0x18a31062,0x18a31062,0x18c318c4,0x29043165,0x62cc39a7,0x5a8a6b0d,0x5a6a62cb,0x29043925,0x528a41e8,0x524a5a6a,0x2925526a,0x10a320c3,0x086318c4,0x006208a3,0x422a0042,0x4a6a528b,0x42094a4a,0x528b4a4a,0x41ea4a4a,0x00420023,0x4a2a39e9,0x526b4a4a,
-0x4a6b4209,0x420a4a4a,0x4a2a422a,0x41a949e9,0x00001803,0x002018a2,0x00200861,0x10a20000,0x108118a2,0x290418a2,0x18a22104,0x20e30000,0x10810840,0x106018a1,0x18a00820,0x10801060,0x28c21840,0x31014162,0x312228e0,0x520441a3,0x49a33961,0x49a328c0,0x414249c3,0x41614141,0x51a24161,0x5a0351c2,0x838a5203,0x6a656265,0x51e372c7,0x51c251e3,0x51e351e3,0x5a035a03,
-0x59e35a24,0x62247b08,0x10202880,0x51e32900,0x51e45a24,0x49a24982,0x51c36225,0x62455a24,0x5a235a23,0x6a855a24,0x7b076245,0x5a036a84,0x49c16a85,0x18404161,0x18c01020,0x5a470800,0x18203122,0x41624182,0x49a24182,0x39414161,0x416251c3,0x49c249c3,0x51e449c3,0x5a054163,0x51e449a3,0x51e551e4,0x49a35a05,0x52045205,0x5a455a45,0x520451e4,0x5a265a26,0x498349c4,
-0x5a2651e4,0x49c451c4,0x5a055a25,0x51e449c3,0x5a456266,0x5a255a45,0x5a255a45,0x51a37309,0x9c2da44e,0x9bec8b8b,0xac6ea42d,0x9beb9c2b,0x9c0b9c0b,0x9beb9bea,0x8b8993aa,0x9bea93a9,0x93a99c0b,0x9bc993ca,0x7b488369,0x5a666ac6,0x31634a25,0x08001881,0x39432081,0x49634103,0x832751c1,0x8b268b88,0xfe948b07,0xde10e58d,0x51a22840,0x8b6d93aa,0x206049a4,0x39423121,
-0x83f18c11,0x83d083b0,0x732e83d0,0x736f6b0d,0x7b8f734e,0x83af7b6e,0x6acc734e,0x5a8a628b,0x39665a8a,0x18832083,0x18a318a3,0x18a31883,0x292520c4,0x08202104,0x62ec41e8,0x62ab5a8b,0x396649e8,0x41e728e4,0x5269630c,0x526a3105,0x3987528a,0x18e420e4,0x10830883,0x00620022,0x3a0908a3,0x4a4a5aab,0x39c84a4a,0x42092967,0x4a2a41e9,0x212631a8,0x422a4209,0x4a2a4a4a,
-0x4a4a4209,0x31a8526b,0x62cd528b,0x522a5a8c,0x18c31002,0x18c32104,0x00000000,0x18a220e3,0x18c218c2,0x106120c3,0x10610841,0x000018a2,0x18a10000,0x18c20000,0x10601060,0x20e141c5,0x20801880,0x28e028c0,0x186020a1,0x41633102,0x18003121,0x41422060,0x41824162,0x51c24141,0x41415a03,0x30e04161,0x72e749c3,0x62645a24,0x51e349a2,0x49a251c3,0x51e34161,0x51c249a2,
-0x62446265,0x6a866245,0x49c451e3,0x416120a0,0x51e451e3,0x51e36266,0x72e85a04,0x51c351e3,0x5a0351e3,0x5a035a24,0x6aa56245,0x62446263,0x49624160,0x10001840,0x00001000,0x10400000,0x39620800,0x51e43941,0x51e44182,0x416249a3,0x49c449c3,0x416149a2,0x51e451e4,0x51c351c3,0x62665a04,0x51e55a25,0x5a055a05,0x62a75a25,0x52255a45,0x49c35225,0x5a0549a4,0x49a45a05,
-0x5a0551e5,0x5a055a26,0x62466266,0x6aa75204,0x6aa76246,0x52046ac7,0x5a256266,0x832983ac,0x9bec6a66,0x93cb8bab,0xa46ea46e,0x9c0b9c2c,0xa42c9c0b,0x9c0b9c0b,0x9c0b9c0b,0x9c0b93ea,0x9bea93ca,0x93ca93ca,0x5a457308,0x6ac86265,0x29235247,0x31232923,0x520628c2,0x4a0549e6,0x41224963,0x20002020,0x41207b09,0x4161b4f1,0x72c84141,0x41825a05,0x394141a4,0x392149a4,
-0x6b2d8c11,0x6b2e83d0,0x7baf8bf1,0x83b08c11,0x8c117b8f,0x734e7b8f,0x62ab732d,0x62cb62ab,0x20c362cb,0x18621862,0x18a32925,0x18c418a3,0x10822104,0x18a22104,0x526a5269,0x4a08524a,0x31253966,0x5b0b39c7,0x5249630c,0x5a6a3966,0x10422945,0x10a320c3,0x108310c4,0x00830042,0x31a810e4,0x52ab528b,0x4209422a,0x4a2a39e9,0x4a6a4a4b,0x424a4a6a,0x528b39e9,0x4a4b5acd,
-0x4a6b4a2a,0x528b4a6b,0x524b4a4a,0x41a741a9,0x10821842,0x10a21061,0x18611082,0x290320a2,0x18c218c2,0x20e339a6,0x18a21081,0x00000000,0x10811082,0x10810000,0x21020820,0x21023164,0x20a02901,0x28a028a0,0x39443944,0x10001020,0x416228a0,0x39214182,0x51c451c3,0x51c359e3,0x49a26aa6,0x51e351e3,0x49a25203,0x41605a44,0x51e35a23,0x49816245,0x41615a03,0x6a866aa7,
-0x62245a03,0x51c34982,0x5a0451e3,0x72e8836b,0x51e349c3,0x51e349a3,0x5a0451c3,0x7b086265,0x62655a24,0x5a046a85,0x62636265,0x41805a21,0x18004160,0x10005a26,0x08001020,0x08010000,0x316018c3,0x49a249a3,0x51e449c3,0x41624983,0x49a34162,0x418149c3,0x49a349c3,0x5a245a24,0x5a0451c4,0x520551c4,0x62665a05,0x5a456a87,0x628649c3,0x41625225,0x520449a2,0x51e551e4,
-0x5a2551e5,0x5a255a46,0x51e451e4,0x49c35a45,0x6aa75a25,0x62666ac7,0x6ac76286,0x72e88bed,0x9c0c6246,0xa42d9c0d,0xac6e9c2d,0xa40b9c2c,0x9c0b93ca,0x9c0b9beb,0x9c0b93ca,0x93c993a9,0x83489bea,0x6a868347,0x39415245,0x39224183,0x21035227,0x39853985,0x41c549c6,0x20202020,0x39423921,0xb5117b4a,0x59e651e6,0x8b8d5a25,0x416349a2,0x41e528e1,0x39413963,0x39424183,
-0x83b09c73,0x94328c11,0x8bf16b2e,0x94529431,0x83d083d0,0x5a6b6aec,0x31862925,0x5aab526a,0x20e33165,0x18a31882,0x18822904,0x18c318c3,0x212418c3,0x10c31082,0x528a31a6,0x3987528a,0x4a093987,0x62ec62ec,0x62eb6b0c,0x08004167,0x4a0949e8,0x086218a3,0x10a310a3,0x4a8a1905,0x08832986,0x316620e4,0x212618c4,0x420939e9,0x528b3a09,0x4a4a4a4a,0x4a294a4a,0x42294229,
-0x528b4a6a,0x42094a4a,0x4209524a,0x29044a4a,0x18a20800,0x000018c3,0x294539a6,0x108210a2,0x20e318a2,0x18c220e3,0x18a21061,0x21033986,0x00000841,0x21020000,0x18c12923,0x31033143,0x20803102,0x186030e1,0x392228a0,0x39423942,0x31003942,0x31003100,0x51e430e0,0x5a4549c3,0x41414162,0x730849c3,0x49824982,0x51c249a2,0x51a25a03,0x51e351c2,0x30e049a2,0x836a5a45,
-0x624551e3,0x49836245,0x62444983,0x62245a04,0x51c351e3,0x51c26aa7,0x5a246245,0x6a856244,0x5a026a86,0x62645a24,0x5a015a43,0x51c259e1,0x18002840,0x49c328a0,0x00001040,0x08000800,0x39423942,0x41824182,0x41614182,0x394049c3,0x49a249a2,0x41614182,0x52045204,0x51e35a45,0x49c351e3,0x418249a2,0x52045204,0x52045a25,0x49c349c3,0x49e44182,0x520451c4,0x520451e4,
-0x5a2549a3,0x5a055a25,0x5a455a25,0x52045225,0x51e451e4,0x5a455a45,0x940e6a86,0x5a248bad,0xa44e7b09,0xa46ea44e,0xa44c9c4c,0x93ea93ca,0x9c0b9c2b,0xa42c9c0b,0x93aa9c0b,0x93a99389,0x7b088328,0x31215a65,0x41c44184,0x28e241a5,0x41e62903,0x31235a69,0x394341a5,0x392249c4,0x626772e9,0x730a49a4,0x180049c3,0x20a06ac9,0x39623121,0x39003921,0x7b4b49a5,0x39413921,
-0x94328bf1,0x7b6f8c11,0x8c327b8f,0x8c119431,0x628b7b8f,0x188328c4,0x20e418c3,0x39a62925,0x18a320e3,0x398620e4,0x20c320e4,0x292420e3,0x108220e3,0x18e40020,0x5aeb2125,0x3166528a,0x526a20c4,0x62ec630c,0x62cb526a,0x292552ab,0x39c73105,0x10a30841,0x10a318c4,0x4a8b39e8,0x4a4a528b,0x104220c4,0x08420842,0x10a40863,0x006310a4,0x39e931c8,0x4a29526b,0x4a6a4a4a,
-0x4a294a29,0x526b4a6b,0x4a294a2a,0x2904526b,0x082120e4,0x084018c3,0x18c21082,0x18a218c3,0x08201081,0x18a22103,0x000018a2,0x08612103,0x084118c3,0x10600820,0x18c11060,0x28e23964,0x39433102,0x30e13102,0x39413941,0x41823962,0x30e03100,0x28a028a0,0x49833921,0x416149a3,0x49624162,0x5a0351c2,0x51c33920,0x51c349a2,0x626659e4,0x49c26a86,0x49a251e3,0x5a2549c2,
-0x51a351c2,0x49814981,0x51c15a03,0x51e251e3,0x414151e4,0x5a046a66,0x62655a24,0x72c66aa6,0x5a2372e7,0x51e151e2,0x49406242,0x51a2a44a,0x20201000,0x28a01000,0x080020a0,0x100020a1,0x41623922,0x520449c3,0x51c34161,0x49a24161,0x49a251c3,0x49a24982,0x5a2549a2,0x62456265,0x52045a45,0x49a24182,0x5a4551e4,0x5a255225,0x51e45204,0x5a665225,0x51e451e4,0x52045225,
-0x51e45a45,0x5a4549a3,0x5a456246,0x5a2549e4,0x6aa751c4,0x62866a87,0x942e6a87,0x62046265,0xac8fa42e,0xa46eac6f,0x93ca940b,0x9c0b9c2b,0x9c0b93ea,0x93aa8b69,0x8b8993aa,0x72e77b28,0x28c04182,0x20a028e1,0x52475207,0x18611040,0x31440800,0x41633123,0x41a441c4,0x396230e1,0x18004141,0x496330e0,0x49824120,0x49a43941,0x41624183,0x414230e0,0x49c44183,0x51c44162,
-0x94117b6f,0x8c1083f0,0x734e83b0,0x8bd083d0,0x28a46aec,0x10a32063,0x18e410a3,0x210420e4,0x41e839c7,0x29043145,0x20e420c3,0x20e43186,0x18a318c3,0x31861082,0x526939a7,0x31454208,0x62cb3145,0x29256b4d,0x41a62904,0x20c34a08,0x294520c2,0x10a30021,0x08821083,0x4a6a2986,0x528b5aec,0x31474a4a,0x20c52906,0x00230844,0x00020823,0x42092167,0x42095aac,0x528b4a6a,
-0x4a2a4a2a,0x42294229,0x528b4249,0x28e439a7,0x18e32925,0x18c31082,0x18c210a2,0x210318c3,0x082020c3,0x08001062,0x08200820,0x106120c3,0x00000000,0x20e22964,0x41e61040,0x294341e6,0x31013122,0x28e03942,0x39414182,0x41623941,0x41833941,0x30e051e5,0x39214142,0x39214182,0x520449c3,0x5a0551c3,0x51e47b09,0x72e85a03,0x51c15a03,0x6ac75a03,0x49e262a6,0x5a4451e2,
-0x392049a2,0x41815203,0x52045203,0x51e35a45,0x5a0451e3,0x62456245,0x62656aa6,0x7b2872e7,0x51e26265,0x5a235201,0x8ac18386,0x4120b48a,0x20002820,0x18402040,0x100020a0,0x20802860,0x49a34162,0x5a244182,0x49c349a2,0x49c349a2,0x41614182,0x51e349a2,0x51e349a2,0x5a256286,0x5a455a45,0x5a455a24,0x522551e3,0x5a455204,0x52045225,0x52255225,0x5a4549e4,0x49c36266,
-0x51e45a25,0x51e449c3,0x62875a45,0x5a256287,0x5a256a87,0x5a456266,0x940e7329,0x93cb7b08,0xa48fa46e,0x9c0da44e,0x9c2c9c2d,0x8bc993eb,0x8ba98bc9,0x72e88349,0x312449e5,0x392349a5,0x62885226,0x20c141a4,0x210318c2,0x00202924,0x28c10800,0x39634163,0x5a875246,0x41623962,0x49a349a4,0x62873940,0x49c349c4,0x31016267,0x49a349c4,0x62675205,0x418349a5,0x28c03900,
-0x83d083d0,0x83d08c10,0x7b6f7b8f,0x62cc83af,0x184241a7,0x18c41082,0x18c318e4,0x528a3186,0x39a76b4d,0x184230e4,0x4a2920e4,0x18a2526a,0x18c318c3,0x39c71882,0x39a62945,0x29042945,0x62eb526a,0x20c22903,0x20c33145,0x39862924,0x00000000,0x086218a4,0x18e410a3,0x210518e4,0x526a4a6a,0x4a2a4a2a,0x41e94a2a,0x3188420a,0x39e94209,0x41e94a2a,0x4229420a,0x42294a4a,
-0x08231884,0x3a0918e4,0x526a4249,0x08622945,0x00000021,0x18c310a2,0x292418e3,0x20e318c2,0x18a21882,0x000020e3,0x29242904,0x08202904,0x10611081,0x082018c2,0x20e118a1,0x39a53163,0x39633942,0x41834162,0x41a33941,0x51e44182,0x31013921,0x39214163,0x5a4572c8,0x49a24181,0x51e451e3,0x72a74982,0x51c272a6,0x51e249a1,0x5a0451c3,0x49a14981,0x626551c2,0x418149c2,
-0x51c35a24,0x52035a44,0x5a255204,0x5a044181,0x62455a04,0x6a866265,0x5a246265,0x7b076245,0x51e16a85,0x208049c1,0xc4e85a45,0x59c0ac47,0x51a24941,0x10004160,0x31012060,0x418230c0,0x51e451c4,0x416151e3,0x41613920,0x5a254182,0x51e349a3,0x418149c2,0x49a24162,0x5a245a24,0x628651e3,0x5a455204,0x5a456266,0x52255a66,0x5a4549c3,0x62866286,0x62865204,0x5a255225,
-0x5a2551c4,0x5a055a25,0x5a665204,0x5a256ac8,0x6ac76245,0x62665a25,0x9c2e7308,0x72a78b6a,0x9c2d9c0d,0xa44e9c2e,0x93cb9c2d,0x8bc993eb,0x41c47b29,0x41a53984,0x316441c7,0x41a53144,0x5a675a67,0x318449e5,0x08402124,0x00000000,0x30c01000,0x49a44163,0x52255205,0x62a762a8,0x49e449c4,0x49a45203,0x49a34162,0x7b0a3901,0x6aa94143,0x49c449a4,0x418351e5,0x41434142,
-0x84118c11,0x7b6f734e,0x732e7b6f,0x5a4a730d,0x18a33105,0x210510a3,0x210418c4,0x634d52ab,0x5a6a6b6d,0x31255229,0x42075aaa,0x39854a28,0x18a220c3,0x20e420a3,0x526a39a7,0x6aab62cc,0x39057b2d,0x28e320c3,0x20c328e3,0x398528e3,0x18c31040,0x084218a4,0x08420021,0x00010842,0x52cc52ab,0x5acc528b,0x528b4a6a,0x4a2a4a6b,0x42094a4a,0x4a4a4209,0x42294229,0x4a294209,
-0x20c44a29,0x31c80843,0x4a6a4a6a,0x000018a3,0x00200862,0x29030040,0x20c318a2,0x290420c3,0x08201061,0x290318c2,0x10600000,0x106118a1,0x18a22924,0x10a120e2,0x292318e2,0x31833143,0x418341a4,0x39213962,0x30e14163,0x30c13901,0x31423101,0x51c349e5,0x622359c3,0x49e35203,0x52035203,0x62656265,0x49a25a04,0x5a035a04,0x6aa66265,0x6a8651c3,0x5a0372a6,0x51c35a24,
-0x6ac75a65,0x51e36265,0x5a246265,0x5a045a44,0x59e351e3,0x6a856203,0x62456265,0x6ac76ac6,0x622359e2,0x20e11840,0x49e12923,0x6a62ac8b,0x62035141,0x28a17b25,0x51842060,0x49a23080,0x5a045a24,0x520451c3,0x49824182,0x51e349a2,0x51e351e3,0x392051e3,0x49c249a1,0x6a6551c3,0x626551c2,0x5a245a45,0x5a455204,0x52046266,0x5a665a45,0x5a666aa7,0x49c349e4,0x49a35a25,
-0x51e45204,0x520451e4,0x5a055204,0x62665204,0x62466266,0x62665a45,0x942d9c4e,0x8349836a,0x9c2d8bcb,0x9c2d9c2d,0x9c2d9c2d,0x4a067b4a,0x41a63985,0x41a641c6,0x420639a5,0x49e649a5,0x4a273143,0x39c541c5,0x00002945,0x00000000,0x41621000,0x51e45a46,0x5a2449c3,0x8bcc8bab,0x62a67b4b,0x41611840,0x49834161,0x418259e4,0x49a46ac7,0x72ea51c4,0x416272e9,0x394351e6,
-0x736f6b0d,0x7b6f7bb0,0x7b4e730e,0x394672ec,0x20e428a4,0x21052125,0x42081083,0x736e6b2d,0x49c8736d,0x28e42904,0x20a23165,0x29041882,0x316620c3,0x62ec4a4a,0x8c116b4d,0x732d8bd0,0x38e56acc,0x20c328e3,0x31243145,0x31242903,0x18c31861,0x18e42125,0x00420042,0x08830863,0x5aed4a8b,0x5aec528b,0x52ab5acc,0x528b526b,0x4a2a422a,0x526a4a4a,0x4a6a4a4a,0x4229526a,
-0x42094a4a,0x10630843,0x21253167,0x18c31083,0x10a20841,0x20c20000,0x18821882,0x10411882,0x20c11041,0x31640820,0x188120c2,0x20c220e2,0x000018a1,0x08600820,0x10810840,0x292218c1,0x41a43983,0x394249a3,0x5a063922,0x30a028a0,0x418328e1,0x51c35205,0x6a244120,0x62854160,0x6a865a44,0x52035203,0x51c25a03,0x72e76a86,0x624572e7,0x5a035a24,0x6a856a85,0x51e26264,
-0x5a0372c7,0x5a245a24,0x51e351e3,0x626649c2,0x62246a86,0x72c67285,0x5a246224,0x498051c3,0x59e33900,0x28a06226,0x30c13964,0x62244961,0x31003900,0x288128c0,0x51a31820,0x5a2451a2,0x51e349c3,0x418251c3,0x41614182,0x51e349a2,0x418149c2,0x39203100,0x624551c3,0x498151c3,0x5a034982,0x62865a04,0x62655a25,0x5a455a25,0x5a456ac7,0x5a456286,0x52045225,0x51e45a25,
-0x5a455a25,0x52255a45,0x51e45225,0x626672e8,0x62666ac7,0x6aa76266,0x940da48f,0x72c772e7,0x9c2d93ec,0x9c0c9c4d,0x9c6e93ec,0x398439a5,0x41c63985,0x41e741a6,0x4a065228,0x6ac949e6,0x41a54a27,0x084020a1,0x00001082,0x31020000,0x5a0628c0,0x5a255225,0x100051e4,0x732851c3,0x62a87b6a,0x28803122,0x49a330e0,0x49c44983,0x836c8b8d,0x49a44983,0x41833101,0x41835a47,
-0x84117bd0,0x83d073af,0x732d83d0,0x28a4728c,0x526930e5,0x18e42924,0x6b6d39c7,0x7b4e7b8e,0x28a35a29,0x28e420e3,0x18a22924,0x41c80000,0x736f4a49,0x84106b4e,0x94529c93,0x62cb8bd0,0x38e5730c,0x28e328e3,0x20e320e3,0x290420e3,0x00002924,0x420839a7,0x18a32104,0x00422125,0x4a6b4a4a,0x52ab4a6a,0x41ca30c6,0x4a6b526b,0x3a093a29,0x4a4a3a29,0x4a4a4a4a,0x4a6a4a4a,
-0x28c44a09,0x00010802,0x39a71063,0x18c318e4,0x18a218a2,0x20e31061,0x18a21081,0x084018c2,0x18a118a1,0x29440840,0x316418a1,0x10402902,0x21032944,0x20c318a2,0x18a120c2,0x18801860,0x39423102,0x41833962,0x51e62880,0x310128a1,0x51c549e5,0x202051c4,0x496151c3,0x5a2451a3,0x62855a23,0x62657b28,0x51e251e2,0x72e65a43,0x62446aa4,0x72a651c2,0x622459e3,0x5a215202,
-0x498149a1,0x51e35204,0x5a045224,0x5a2451c3,0x62055a04,0x7b4972c7,0x5a046286,0x62886223,0x62674963,0x49c56aa9,0x200028a1,0x414048e0,0x28c11820,0x182020c0,0x59e26266,0x62245a03,0x51e36a85,0x49825a04,0x51e349a2,0x49a251e3,0x49a251c3,0x51e34982,0x5a0459e4,0x51c351e4,0x51e35a24,0x51e349a2,0x5a456aa6,0x5a456ac7,0x51e451e3,0x498272e8,0x5a256265,0x520451e4,
-0x62665a25,0x5a665204,0x5a255a45,0x51e45225,0x6a666266,0x8b8a6a45,0x8bcb9c2d,0x836b6a64,0xa48ea42d,0x83cc8beb,0x39645245,0x39643985,0x49e641e6,0x49e649e6,0x5a885227,0x732b49e6,0x42065288,0x00200840,0x00000000,0x28c02060,0x5a266287,0x5a265a25,0x10005205,0x49a50821,0x52277329,0x31213140,0x41a33941,0x394149e4,0x49c34162,0x41a25a46,0x4a0630e1,0x41a441a4,
-0x6b6e6b4e,0x7b8f8431,0x6aed732d,0x206351c8,0x5acb3946,0x21042924,0x738e5aec,0x6aec7bae,0x28c328c3,0x20e320e3,0x4a4941e7,0x62ec4a29,0x736e6b4d,0xad359493,0x734e9c72,0x730c7b6e,0x30c45a29,0x20a220a2,0x290320c3,0x20e320c2,0x00002904,0x39c739a7,0x10833187,0x004218c4,0x4a8b422a,0x4a4a528b,0x18643147,0x00220001,0x29a708a4,0x4a4a422a,0x39c84209,0x42294209,
-0x18422926,0x00021843,0x39c80022,0x210439c7,0x08410000,0x21030820,0x106018a2,0x10811060,0x084018e2,0x10810840,0x29232923,0x210320e2,0x186118c2,0x31441020,0x18801881,0x18802923,0x31213943,0x41a33982,0x206030c1,0x30e14163,0x41224183,0x412059e4,0x498138e0,0x5a445a03,0x49a23940,0x49c35a24,0x51c25a44,0x5a035a23,0x5a036264,0x5a036aa6,0x622472c6,0x5a436285,
-0x5a2449a2,0x5a245a24,0x5a045a24,0x72c76265,0x7ae86266,0x7b888369,0x5a236ac6,0x7ae96a45,0x72e87288,0x72a872c8,0x59c272c8,0x72a46a22,0x100028a0,0x20803102,0x6a445a04,0x5a035a03,0x5a035a03,0x5a045a04,0x51c26244,0x6ac751c3,0x51e372c7,0x41615a03,0x51e351e4,0x624551c3,0x41615a24,0x5a036265,0x73086245,0x5a246ac7,0x52045a24,0x62655a25,0x626572e7,0x6a876aa7,
-0x5a255a25,0x52045a25,0x52045a45,0x51e46266,0x62456ac7,0x9bcb6a86,0x93cc93ec,0x940c8307,0x6ac893cb,0x39835a87,0x41e639a4,0x49e64a07,0x41c641c6,0x4a0741c6,0x4a277b8d,0x5aa93985,0x18a13164,0x00001081,0x31230000,0x5a0530e0,0x5a255a05,0x62665a26,0x30e16266,0x20a12901,0x52253942,0x49c349e2,0x51e44182,0x49c45225,0x394249c4,0x5a2749a3,0x4a063963,0x312228e1,
-0x6b2e632d,0x83b08c72,0x730d734e,0x28a45188,0x21042083,0x39c718a2,0x5b0c632d,0x20e3630c,0x106218c3,0x210410a2,0x5aec52ab,0x6b4d630c,0x8c327baf,0x7bcf9452,0x7b6e7b8f,0x38a46b0d,0x20c32042,0x20a220c3,0x316520c3,0x18a22904,0x18a218a2,0x39e80000,0x188339e8,0x214510a3,0x52ac4a6b,0x528b5acc,0x29054a6a,0x00010002,0x00620883,0x08c30863,0x422929a7,0x528b4a4a,
-0x39464a09,0x10631043,0x10830001,0x00002925,0x106118a3,0x104118a2,0x18c20000,0x18e218a1,0x08200840,0x18c218a2,0x20e220c2,0x29032903,0x28c318a1,0x28e22082,0x18a11880,0x20e21880,0x31211840,0x41833962,0x41624182,0x49624162,0x41213901,0x51a23920,0x620659c4,0x51e159e2,0x5a2349c2,0x5a456265,0x7b2851e3,0x6a866265,0x6aa55a04,0x62246244,0x6a857ae7,0x62865a44,
-0x62456266,0x624572a7,0x41605182,0x72e86a85,0x6ac76245,0x52227b69,0x622341a0,0x82867266,0x5a257267,0x51a26224,0x7a846a65,0x6a226a86,0x100059e2,0x30e01000,0x62255a24,0x622459e3,0x62446265,0x5a245a24,0x51e351e3,0x51c34981,0x51e35a24,0x626551a2,0x5a2549a2,0x5a0459e4,0x49825a03,0x41614140,0x62666244,0x5a455a45,0x62866245,0x6a866266,0x628672c7,0x62865a45,
-0x5a255225,0x62866286,0x52255a66,0x52045225,0x72866266,0x8b6a8329,0x8bcb8b8b,0x6ac78329,0x734b7328,0x39843185,0x31643143,0x4a075247,0x4a074a07,0x4a0741e6,0x4a484a69,0x21245269,0x10812104,0x00000000,0x30a12060,0x62674161,0x62465a25,0x62466266,0x41816287,0x6ae85a06,0x41806aa9,0x416251e4,0x49a349c3,0x41844183,0x418349a4,0x312049c4,0x4a0628e1,0x28c13122,
-0x6b6e5acc,0x83b073af,0x72ed730d,0x30e46aab,0x000030e4,0x18c32104,0x29043186,0x18c318c3,0x210410a3,0x18e418c3,0x62ec526a,0x738e5aec,0x83d06b6e,0x7b8f838f,0x730d7b4e,0x51c86aec,0x28a349a7,0x210420a3,0x630c5aab,0x20c339a6,0x29242904,0x41e70820,0x08834a29,0x42090863,0x52ab528b,0x5a8b524a,0x312641e8,0x00011043,0x08830842,0x00420001,0x31c80021,0x528c39e9,
-0x4a2a4209,0x08222084,0x00000001,0x084118a4,0x10611082,0x00000820,0x29032102,0x10611060,0x21030020,0x00002924,0x20c220c2,0x184020e3,0x20a128e3,0x208028c2,0x28c120a1,0x28e11840,0x396228e1,0x39214162,0x418249c3,0x62874182,0x49c26286,0x498149c2,0x62445a03,0x51e26264,0x394051e3,0x5a657309,0x5a035a45,0x5a436223,0x73297b29,0x6a656245,0x7b066aa5,0x51e26264,
-0x62845a24,0x6a656224,0x7b4972c7,0x7b2972e7,0x626572a7,0x39607307,0x41200800,0x8b2961c4,0xa44e7266,0x6a466a47,0x6a447aa7,0x416051a0,0x18005a42,0x5a042041,0x51e25a04,0x62246245,0x6a656224,0x62246245,0x5a036a86,0x51c25a03,0x5a0459e4,0x62455a04,0x6a865a04,0x5a045a24,0x49826245,0x49c23100,0x52046286,0x62866265,0x6a866245,0x6a866266,0x5a456a86,0x6aa65a24,
-0x7b2972e8,0x62667308,0x624672e8,0x62255a25,0x72a76a66,0x7b298b8a,0x8bab7b49,0x8bec8b8b,0x39a4732a,0x39a541c6,0x49e649e6,0x41c54184,0x41c549e6,0x39c75248,0x39a64207,0x00002104,0x00000000,0x28e20840,0x49c33921,0x5a456266,0x5a256246,0x5a456266,0x51e462a7,0x626851c3,0x6ac86ae9,0x5a254182,0x416251e4,0x39423101,0x39634183,0x39423963,0x28e13942,0x08001881,
-0x5aec3167,0x83d073af,0x83d083f0,0x5a6a734d,0x10013145,0x18c341e7,0x18c32104,0x18e418c3,0x18e418e4,0x086218c3,0x5acb4a49,0x632d630c,0x8c316b4d,0x732d8bf0,0x7b6e732e,0x62cb6acc,0x41c75a8a,0x420820c3,0x734d62eb,0x29243145,0x294420e3,0x316518a2,0x000118a3,0x52ac39e9,0x528b632d,0x528b5aab,0x49e9524a,0x10433967,0x082210a4,0x00222926,0x21460863,0x526b4a4a,
-0x4209526b,0x18434a2a,0x00010862,0x08410862,0x20e30841,0x29650820,0x292418e2,0x104018a1,0x20c31882,0x104020a2,0x18610800,0x20822061,0x31032082,0x20a11860,0x28c120a1,0x31223943,0x39424184,0x5a453921,0x51e33100,0x520530e0,0x49a25204,0x416151e3,0x51c251e3,0x41404980,0x49a14160,0x49e241a0,0x62443120,0x6a845a02,0x7b896a84,0x72c78368,0x7b0772c6,0x51c26ac6,
-0x62656244,0x7ae76a85,0x5a437285,0x72e65a63,0x73066aa5,0x31205a23,0x6a867a88,0x834a93ac,0xa44e934a,0x61e48b8b,0x622482e8,0x39824980,0x20005a24,0x5a254941,0x5a036a85,0x62456224,0x62446a65,0x5a046245,0x62256a86,0x49a272a7,0x51c36226,0x62656a66,0x5a255a04,0x51e35a04,0x5a2451c3,0x62865a24,0x62865a46,0x51e36265,0x51e35203,0x7ae85a04,0x628672e7,0x72c76286,
-0x6aa76286,0x6a876266,0x62866266,0x62666246,0x6a665a25,0x83497b29,0x8369838a,0x6ac86aa5,0x398441c4,0x522739a5,0x49e64a06,0x52474184,0x49c641e5,0x31653965,0x08402104,0x00000000,0x00000000,0x310128c0,0x62665184,0x62665a45,0x62666286,0x62456266,0x51e36266,0x6aa959e4,0x6ac86aa8,0x49c43961,0x416249c4,0x398249c4,0x184020c0,0x08001020,0x10201861,0x732b0800,
-0x080020e4,0x5aec31a7,0x7bcf5acb,0x732d6aec,0x39866b0d,0x102120a3,0x18c34208,0x18e31082,0x21042104,0x296618c4,0x21042964,0x632c630c,0x8c117bcf,0x62ac7b8f,0x6b0d732e,0x62ec62ec,0x41a662ab,0x420820c4,0x62eb62eb,0x20e32903,0x188218c2,0x08003165,0x08432925,0x6b2d39e9,0x42296b4e,0x5acc6b6e,0x5acc4a4a,0x526b5acc,0x18a44a4a,0x08021063,0x31471885,0x4a2a4a2a,
-0x4a2a524a,0x41a8522a,0x00001883,0x00000881,0x18c20000,0x20e30840,0x082018a2,0x080018a2,0x18a220e3,0x20c228e3,0x316520a2,0x314420c2,0x20a241a6,0x310320a1,0x184030e3,0x28a02060,0x49a43101,0x49c33921,0x31003100,0x310020a0,0x51e35204,0x49c249c2,0x520349a1,0x62655203,0x41616265,0x62456265,0x5a0359e2,0x62667286,0x5a637b07,0x73075a44,0x83486264,0x628572e7,
-0x8baa51e3,0x83488328,0x6aa57b07,0x6ac66264,0x5a0272c6,0x41203920,0x940d8b4b,0x8bac9c0e,0x8b2a9bed,0x7ac88bab,0x72a77ac8,0x20a14181,0x10000800,0x62244961,0x5a236a85,0x72a76286,0x6a856203,0x72a66a86,0x6aa66224,0x6a866a85,0x62656265,0x62246265,0x5a246245,0x6a6651c2,0x5a045a04,0x5a046245,0x62455a25,0x5a456245,0x418151e4,0x5a446265,0x5a456266,0x62656265,
-0x62866286,0x62866aa7,0x72e96245,0x7b0872c8,0x6ac76266,0x730883aa,0x73296aa6,0x39643163,0x396541a6,0x49e549c5,0x41843963,0x522749e5,0x10824a27,0x084020e3,0x00000000,0x00000000,0x30c20800,0x39223080,0x5a256287,0x6aa75a25,0x5a456286,0x62866266,0x5a256266,0x5a4651c3,0x6aa86287,0x49c44182,0x41a34183,0x41824183,0x28e00800,0x18600000,0x62463901,0x72e86ac8,
-0x08202925,0x39e81082,0x632d52ab,0x5acb630c,0x5269630c,0x20c328c4,0x18c32104,0x210420e3,0x29452945,0x41c72904,0x18c32123,0x73ae5aeb,0x83af73ae,0x62ec62cc,0x630d6b2e,0x6b0d736e,0x310462cb,0x210320c2,0x29042924,0x290320e3,0x290420e3,0x08202924,0x08230801,0x5acc39e9,0x528b5acc,0x528b5acc,0x52ab4a6a,0x5aab526b,0x4a29528b,0x42094209,0x41c94a2a,0x41e91063,
-0x52ab4209,0x526a5a6b,0x10622084,0x00000000,0x10810861,0x18a20820,0x18a21881,0x18811882,0x10400820,0x10201020,0x312420a2,0x20e328e3,0x28c220a2,0x186020a2,0x208020a2,0x20a028a0,0x39423102,0x392128c0,0x62863100,0x30e04182,0x49c23941,0x41614181,0x62455204,0x6a866245,0x5a2351c1,0x5a045a44,0x6a645a02,0x6a657ac7,0x62847284,0x62638389,0x72e56243,0x6aa672e7,
-0x7b076a85,0x93aa93aa,0x62647ae7,0x7b0772e6,0x6a856aa5,0x6a0459c1,0x9bce9bab,0x8bad836b,0x9c0d8bab,0x72c993ed,0x72887aea,0x10004163,0x28800000,0x62655182,0x62435a23,0x6a456aa6,0x62647265,0x72a66245,0x6aa66224,0x62656a85,0x6a856245,0x62656265,0x62656265,0x62655a23,0x62256265,0x62455a04,0x6a865a24,0x5a456245,0x7b296265,0x6aa77308,0x7b086ac7,0x73086ac7,
-0x6ac76a86,0x6aa77b08,0x73086286,0x62666286,0x73086245,0x7b497b69,0x39835a46,0x41a53984,0x49e54185,0x41623122,0x49e54141,0x522741a4,0x00003164,0x00000000,0x00000000,0x10200000,0x30e130e1,0x62465a46,0x62665a46,0x62665a45,0x62666246,0x6a876a87,0x62466286,0x5a254982,0x62a76287,0x49c43941,0x418341a3,0x39624162,0x186028c1,0x312030c0,0x83699c0c,0x83497ae8,
-0x000010a2,0x00200020,0x39c810a3,0x632c4aaa,0x4207736d,0x312518a2,0x20e32104,0x20e32924,0x31853186,0x20e318c2,0x10622104,0x738e6b0c,0x41e8528a,0x632d52ab,0x62ec6b4e,0x732d6b4e,0x28c45229,0x28e328e3,0x20e320e3,0x20e320c3,0x20c32924,0x39852924,0x18a43124,0x526b2947,0x42095aec,0x422a10a4,0x5acc630d,0x526b5aac,0x4a4a526b,0x5aab526a,0x20c54a2a,0x21260842,
-0x424a424a,0x4a2a630d,0x18831882,0x08001862,0x08000000,0x20a21061,0x18211882,0x08200800,0x00001040,0x188128e3,0x20c22903,0x18400800,0x20c23944,0x186020e3,0x18801820,0x29023984,0x41643122,0x30e049a4,0x39203920,0x520549c3,0x28e028e0,0x51e328c0,0x52023920,0x5a4349c1,0x62443900,0x30c06263,0x7b078369,0x72c77b28,0x51c26a65,0x62846243,0x5a646aa7,0x72c66244,
-0x72e66264,0x8b8a7328,0x7b287b08,0x6ac593cb,0x83056a63,0xac2b6a42,0x82e79326,0x7b2a938c,0xa46f7b6b,0x72c99c0e,0x72e97b0a,0x20a17b4b,0x10001061,0x62455a03,0x6a845a24,0x72846aa6,0x726572a6,0x72a66a45,0x728672a6,0x7b287286,0x62445a24,0x72a66a85,0x62446a65,0x62456224,0x6aa66224,0x6a866245,0x6aa759e4,0x6aa672a7,0x6aa65a45,0x6aa672e7,0x62856ac7,0x72c76a86,
-0x7b297308,0x628672e7,0x62666245,0x5a665a25,0x7b286ac7,0x522562a6,0x310149e4,0x5a4849c6,0x30e14163,0x7b8b5a46,0x49e55226,0x398549c4,0x00203163,0x00000000,0x00000000,0x18400800,0x5a254162,0x5a456267,0x62255a25,0x6a8772a7,0x6aa772c8,0x6aa76aa7,0x62666aa7,0x49c45a46,0x4a2541c4,0x39222901,0x31003961,0x200028e2,0x41223080,0x83288b69,0x7ae78b69,0x83498369,
-0x00000000,0x00002104,0x39e84a8a,0x62eb2124,0x188249e8,0x28c33145,0x20e31882,0x21032103,0x20e320e3,0x29452944,0x31652924,0x62eb5aaa,0x20e44208,0x52ab2966,0x630d6b4e,0x7b8e6b0d,0x28c45a6a,0x28e320a2,0x20c320c3,0x20e32924,0x18a22924,0x28e32924,0x10631040,0x528b0001,0x31a75b0d,0x4a4a1905,0x52ab5aec,0x526a5aab,0x4209526b,0x522a3167,0x20843167,0x18e51043,
-0x528b4209,0x4a4a528b,0x290541c8,0x186218a3,0x00000800,0x10202903,0x20621882,0x08001841,0x290320e3,0x20a220a2,0x186118a2,0x310328e3,0x20a21840,0x28c228e3,0x20e12081,0x29232902,0x39021840,0x31013101,0x20803941,0x49c449c3,0x10005205,0x206028c1,0x5a444182,0x5a666286,0x834830c0,0x62236a84,0x836893c9,0x7b496aa5,0x6aa67b28,0x520249e1,0x6ac57308,0x6a856265,
-0x52026aa5,0x73077347,0x72c68348,0x6ae68369,0x72646243,0x9ba99bc9,0x93499305,0x836b8b4a,0x9c2e836c,0x836ca44f,0x8b8c8b8c,0x18a183cd,0x202020a1,0x5a045a24,0x51e26264,0x6a446244,0x6a447285,0x938a7ac7,0x7ac78308,0x6aa672a6,0x834872a6,0x62447b07,0x72a672c6,0x62456224,0x62456245,0x6a856245,0x72c76245,0x72e77ae8,0x73076286,0x62658369,0x6ac66ac7,0x62456aa6,
-0x83696ac7,0x62867b08,0x62a76ac7,0x628662a7,0x52046266,0x5a875a45,0x28c120a0,0x39423942,0x62a849c5,0x52265a47,0x41c45226,0x5a883963,0x00001080,0x00000000,0x00000820,0x626828e1,0x62466287,0x5a256246,0x62465a45,0x62256246,0x72a76a66,0x72c772c7,0x6ac76286,0x49e55246,0x398341e4,0x31003142,0x182028c1,0x39012080,0x83297ae8,0x83498b8a,0x83498b69,0x93cb93cb,
-0x00000000,0x00000000,0x31a631a6,0x186220e4,0x28c32082,0x100030e4,0x082020a2,0x292418a2,0x21031082,0x21032945,0x29643185,0x52a95289,0x20c418a1,0x5acc2966,0x6b2d6b2d,0x732d736e,0x28833125,0x18822082,0x20e32103,0x188218a2,0x20c22924,0x396520e3,0x00002903,0x39e80021,0x21255acc,0x52ac31a8,0x6b2e5aec,0x5aab5a8b,0x62ec62ed,0x3106524a,0x20c53946,0x420920e5,
-0x42293187,0x4a29526b,0x49e85a8a,0x20832925,0x08002083,0x20c31881,0x10001882,0x00001861,0x31443144,0x10203124,0x39851881,0x20a21040,0x29241820,0x28c13124,0x18602080,0x312320e1,0x30e120a0,0x498328c0,0x51e55205,0x52052060,0x28a03942,0x498328c0,0x51e349a3,0x31603981,0x72e66244,0x5a017ae7,0x73057b26,0x83aa6ac4,0x5a656ae7,0x72e662a5,0x5a43836a,0x626572c6,
-0x5a035a23,0x49e162c5,0x6aa47b27,0x51e38b89,0x72666a84,0xa3ea938a,0xb46d9326,0x834b93ca,0x940e836b,0x8b8c9c0e,0x62a972c9,0x42076b2c,0x51e428a1,0x62246244,0x62645a24,0x8b686a85,0x83478326,0x9bcb8b29,0x72867ae7,0x72a56a65,0x62247264,0x72a672a6,0x62246a65,0x7ae86a85,0x7b085a24,0x72c672e6,0x6aa76264,0x6ac772a7,0x62856266,0x62656285,0x6aa66aa6,0x72e87b08,
-0x7b287b49,0x6a867b08,0x5a666286,0x5a255a66,0x5a045a66,0x62876286,0x418541a5,0x49e64185,0x52075a27,0x52465a27,0x62876288,0x18805205,0x42272942,0x00000020,0x08000800,0x30e00800,0x5a255a25,0x5a256266,0x6a865204,0x72c76a66,0x6a666a66,0x72c76a66,0x72c76aa7,0x52056287,0x41c43162,0x100020c0,0x59e328c0,0x8b6a72c8,0x8b498b49,0x83498b8a,0x83498328,0x8bab8b8a,
-0x00000000,0x00000000,0x00000000,0x62ec31a7,0x730c7b8f,0x202149a7,0x00001000,0x18e22103,0x18c118c1,0x20c22102,0x316420e2,0x292341e6,0x210320e2,0x5acc39c7,0x6b2d5acc,0x730c6b2d,0x28c33104,0x18a128c2,0x29042103,0x20e320c2,0x20e32924,0x20c22924,0x084020c2,0x080120e4,0x528a630c,0x31a82967,0x5aec4a6a,0x5acc630d,0x732e630d,0x524a524a,0x42094a09,0x39c810a3,
-0x42094229,0x4a4a4209,0x312552ab,0x18621842,0x080020a3,0x104120c3,0x000020e3,0x29230000,0x20e23144,0x20c220c2,0x28e320a2,0x28e328e3,0x28e23144,0x20a220c2,0x18a120a2,0x31232902,0x186028a1,0x31213122,0x28a03941,0x39423921,0x39823141,0x28a02080,0x49e44162,0x31213982,0x72e76286,0x626172e6,0x8ba993ca,0x62a56264,0x62666ac7,0x6ac86265,0x6aa47b28,0x62436aa4,
-0x51e15a22,0x49c15201,0x83488bab,0x59a16a85,0x7ac982e8,0x82e493aa,0x9388a409,0x836ba44c,0xa45093ce,0x8bcea470,0x732b93ee,0x318662ca,0x392220e2,0x51c35a25,0x626559e3,0x7ac672a6,0x83268306,0x832793a9,0x72867b07,0x728672a6,0x83278b48,0x72a56244,0x6a856a85,0x6a457ac7,0x7b286a67,0x7b2772c6,0x72e772c6,0x72e772c6,0x7ae75a45,0x72c66a86,0x6aa66ac6,0x72e76aa7,
-0x7b286aa6,0x6ae87308,0x62865a66,0x52255a66,0x49c362a7,0x6ac951e4,0x49a54185,0x5a4749e6,0x5a275a27,0x5a476aa9,0x39627b6b,0x290220a0,0x18e31060,0x00000020,0x00000020,0x49411040,0x6aa76266,0x6a866246,0x6aa75a25,0x6a866266,0x6aa76a86,0x72c76a86,0x6aa76aa7,0x62a772e8,0x49e54a04,0x186020e0,0x7b0859e5,0x83487b08,0x8b698369,0x8b698b69,0x7b088328,0x732a7309,
-0x00000000,0x00000861,0x31c831c8,0x9cb36b6e,0x7b6e9452,0x494572ec,0x00000800,0x210218e2,0x292310a1,0x316418c1,0x41e63144,0x20e43143,0x4a2941e9,0x630d630d,0x6b4d630d,0x520862ec,0x208228c3,0x20c220a2,0x20e318a2,0x290418a2,0x29032904,0x102020e3,0x082028e3,0x106239a7,0x528a18c4,0x31c773af,0x52ab4a4a,0x5acc5acc,0x6b0d630d,0x41e95a8b,0x420939a8,0x39c83187,
-0x528b4209,0x526a526b,0x29054a49,0x10420800,0x102120c4,0x18a220a3,0x08411040,0x08400000,0x294320c2,0x188120c2,0x31241881,0x314420a2,0x188120c2,0x08401040,0x49e61060,0x31233164,0x28c13943,0x31212901,0x39833983,0x31025226,0x314128e2,0x28c03942,0x39623962,0x20a04a05,0x41616ae8,0x8b6972c6,0x7b278b89,0x5a645a23,0x5a245a65,0x5a435223,0x620351c1,0x6a856aa5,
-0x5a436aa4,0x41606ac6,0x5a036285,0x62255a03,0x7b09938d,0xa40d8bac,0x9bca938a,0x93ee9c0c,0x9c0f93ef,0xb4d293ee,0x8bee838c,0x294462eb,0x30c020e1,0x5a0351c3,0x6aa65a24,0x7ae76224,0x8b688326,0x93c98b88,0x72867b06,0x83086a44,0x7b076a64,0x6a848327,0x72a672a5,0x72c66223,0x7b286a87,0x7b0772e7,0x6a8672e6,0x5a046aa6,0x6a866ac7,0x72e76265,0x6aa67307,0x6aa672c7,
-0x6ac76ac7,0x6ae86265,0x6aa77329,0x49e45204,0x6ac85a46,0x5a275a26,0x51e64185,0x5a685a68,0x5a475207,0x72c872ea,0xbd518b89,0x294062e6,0x00203162,0x00000000,0x00000000,0x6a851800,0x6aa76286,0x5a456266,0x62466266,0x6a866286,0x6a866aa6,0x6a8672c7,0x6ac76a87,0x62a76ac7,0x39606aa7,0x496230e0,0x7b2959c3,0x834972e7,0x72e78348,0x83498349,0x7329836a,0x41c51840,
-0x00000000,0x08830000,0x4a8b2126,0x8c3173af,0x838f83d0,0x5a497b0d,0x10201800,0x294320e3,0x29020840,0x20e22903,0x31444a07,0x39e720e3,0x5aec52ec,0x6b0d6b8e,0x630c630d,0x39655aaa,0x20a220c2,0x312428e3,0x20e320a2,0x20e320e3,0x28e320e3,0x10203103,0x104028c2,0x18e30000,0x39c718c3,0x4a8a4a6a,0x4a4a526a,0x62ec524a,0x5a8b5acb,0x2926524a,0x29052105,0x18831062,
-0x18c418c4,0x10620822,0x31670001,0x18a339c7,0x186220a3,0x08411821,0x00001082,0x10a10000,0x21021881,0x20a128e2,0x21023164,0x18a118c1,0x20c218c2,0x106020e2,0x316318a0,0x30e128c1,0x10403122,0x20e23164,0x41832080,0x312241a4,0x394228e1,0x41a33142,0x208020a0,0x39a341c4,0x30c03962,0x6aa47b28,0x72c66263,0x626472e7,0x51e349c2,0x6ac549e2,0x7ae66264,0x83688348,
-0x62646aa5,0x62655a42,0x5a045225,0x7ac95183,0x8b6b9c2e,0x8bcd9bed,0x8bac940e,0x7b6d8bac,0x8bae8bae,0x93cf8bce,0x6b2c8baf,0x4207630b,0x20802902,0x49a23922,0x624551e3,0x7b086a65,0x83066aa4,0x72a48326,0x72a57b05,0x8b4972a5,0x7b077284,0x7ac67ac6,0x7b078328,0x72a672a6,0x6a856a87,0x7b076244,0x72e78b89,0x62446a86,0x6a666a85,0x834872e7,0x83486aa6,0x5a046aa6,
-0x6a856265,0x628749a2,0x41a362c8,0x49c44161,0x62665225,0x49844984,0x51c54164,0x5a476267,0x5a476247,0x93ed72c9,0x72e87b29,0x3163840e,0x000020e2,0x00000000,0x00000000,0x62454122,0x62665a25,0x51e46245,0x5a2551e4,0x62866286,0x628672e7,0x626572c7,0x62456a87,0x62666aa7,0x39416286,0x498349c3,0x72a751a2,0x83897b08,0x72e77307,0x5245836a,0x39412060,0x31223942,
-0x00000000,0x31e90000,0x5b0d52cc,0x83f05b0c,0x8bb08c52,0x6aab836f,0x206159e8,0x41e61861,0x292339a5,0x4a072903,0x20e33165,0x190420c2,0x5b0c39e8,0x5aaa632d,0x5269528a,0x20c24a29,0x292420a2,0x39853124,0x290318a1,0x20e320c2,0x20c320c3,0x100028e2,0x31641820,0x00200820,0x29450821,0x424918e4,0x41e841e8,0x5aab4a49,0x524a5acb,0x18831883,0x10421883,0x10830822,
-0x08421083,0x00011042,0x29250823,0x524a5249,0x208320c4,0x08002082,0x186120a2,0x08000000,0x18a11881,0x398520e2,0x29233164,0x20c22923,0x20c22924,0x312318a1,0x21013943,0x394328e1,0x28e13122,0x08202902,0x31223121,0x28e13942,0x396220a0,0x31413962,0x28e220c0,0x31623983,0x30c03922,0x52016aa6,0x8b898369,0x728572e6,0x72857ac7,0x940d6aa5,0x6a8493ea,0x7ae58306,
-0x7ae56a84,0x5a046242,0x6a896a46,0x8b4b7aca,0x9bedac8f,0x7ae8a42e,0x8b6a7ae8,0x83ae836b,0x940f9c30,0x93f09c10,0x7b8f8b90,0x4a47526a,0x394218a0,0x41403942,0x6a856265,0x6a8672a6,0x7ac56263,0x72c48b67,0x93ca7ac5,0x7ae68348,0x8b4872a6,0x72a58327,0x7ae772c6,0x62446a64,0x7ae75a03,0x72a672a6,0x6aa67ae7,0x6aa76aa6,0x72e86aa7,0x6a8572e7,0x62446aa6,0x8bcc6aa5,
-0x62468b6a,0x52256a66,0x41a441a4,0x49e54162,0x39424983,0x49a56a87,0x5a2751e5,0x6aa98bed,0x5a066247,0x62a86ac9,0x6aea5a67,0x4a265247,0x000041e6,0x08200000,0x10000000,0x62452020,0x62456245,0x6a866a86,0x62466aa6,0x62866266,0x6ac76266,0x730872e7,0x72e86aa7,0x6aa76266,0x6ae75a45,0x20806ae7,0x72a75182,0x72e87ae8,0x940c7b09,0x30c049c4,0x49c53101,0x41c449e4,
-0x00000000,0x32090000,0x634e1105,0x83f16b4e,0x94529472,0x7b0d8baf,0x18006a4a,0x318530c3,0x41c65268,0x290339a6,0x20c220c2,0x10e21903,0x214410e2,0x21032165,0x08402104,0x20a318a2,0x20a220a3,0x31442903,0x29033124,0x20e320c2,0x210320e3,0x10202924,0x28e01000,0x00001020,0x18c32945,0x29a70062,0x4a2931a7,0x41e92905,0x18833967,0x08211042,0x20c41082,0x10420801,
-0x20e41062,0x10421883,0x20e518a4,0x522a528b,0x10004186,0x00001841,0x29441881,0x18a20800,0x31241861,0x104028e2,0x31842102,0x31433164,0x18602902,0x41a549c5,0x20c128e2,0x39842902,0x30e24184,0x28e120c1,0x20c02901,0x39833142,0x28e13983,0x20e049c4,0x4a2741c4,0x41e53983,0x28803101,0x7b0751e2,0x834893cb,0x83288367,0x72c672c6,0x836b6203,0x83057ae7,0x7ac58327,
-0x7a2382c6,0x62057203,0x7b8c7b2a,0x8bad93ce,0x93cbb4af,0xa40dac8f,0x8309832a,0x9c917aca,0x9c30a471,0x9c529c52,0x7b6e8baf,0x52486b2d,0x41623142,0x49c24183,0x7ac551c2,0x62446a85,0x62226264,0x83077284,0x830793ca,0x8b687ac4,0x72a48b69,0x72658b68,0x72a572a5,0x72c672e7,0x7b0872c6,0x72a68308,0x83497ae6,0x728572a7,0x8bab72c7,0x7b097b29,0x62a5a46f,0x6aa76ac7,
-0x730862a7,0x62466a85,0x418451c4,0x52264164,0x522649a3,0x59c56287,0x6a676226,0x6a88836b,0x62876267,0x62885a46,0x52485a47,0x4a475248,0x00002102,0x00000000,0x18000000,0x5a036a67,0x622551a3,0x626672a7,0x62456a86,0x6a866266,0x72e86a87,0x6a876ac7,0x72c76a86,0x62866246,0x41a25a65,0x51e428e0,0x418230e0,0x7b4a730b,0x08001840,0x31204182,0x524549e4,0x39623100,
-0x18c30000,0x08c40000,0x634e3a4a,0x8411738f,0xacf49473,0x7b0d9431,0x30e46209,0x39451000,0x28e349e7,0x20e32903,0x20c220e2,0x18e32103,0x18a218e3,0x18c31082,0x18c21082,0x292420e3,0x20c23144,0x290320c2,0x31442903,0x20e320e3,0x31442924,0x100020c2,0x20600800,0x082020c2,0x00000000,0x31c70000,0x526a3a29,0x4a0939a8,0x102249e9,0x21041063,0x39a7526a,0x31463146,
-0x4a094a29,0x41c8522a,0x5a8b4a09,0x5a4a49e9,0x100049a7,0x08400800,0x106118a2,0x08000820,0x28e328e3,0x10402923,0x31643143,0x20a12903,0x31023984,0x39643964,0x29023123,0x31435227,0x28c249c6,0x31430800,0x39843142,0x310139a4,0x39423121,0x524641a3,0x41c420e0,0x39433102,0x38e03922,0x51e28b8b,0x7b275201,0x8b898b6a,0x6a857b07,0x5a4372c6,0x83266a63,0x72647ac5,
-0xbc8f9b8a,0x934aa3ec,0x838c4922,0xa44f9c30,0xac6eb4b0,0xacb0ac8f,0xa44fac6f,0xb4f3b4b1,0xa452a472,0x9c319c32,0x730d9411,0x52686aec,0x41623982,0x49e44183,0x72c66285,0x6a656a85,0x7aa66a86,0x83078306,0x7ae68b8a,0x72a67ae6,0x72a47ae6,0x6a657ac6,0x7ae67ae6,0x72e78ba9,0x72c793eb,0x72c68b49,0x8b896aa5,0x620372c6,0x8bab7b08,0x626672c8,0x62a76ac7,0x51e46286,
-0x836a838b,0x72a86246,0x394351a4,0x6b0a3102,0x5a466aa8,0x51a472e9,0x832a5a05,0x62467b4a,0x72e96ac8,0x62896aa8,0x5a895a68,0x4a475248,0x00002922,0x08410000,0x18000000,0x41615a05,0x5a045a04,0x6a876a66,0x6a666aa7,0x6aa76266,0x72c86266,0x6aa76ac7,0x72c76a86,0x6ac76286,0x5a456aa6,0x20403961,0x62463100,0x9c4f3963,0x41825225,0x39223942,0x39213102,0x312130e1,
-0x000039c7,0x3a4a10a3,0x73d0530d,0x94b373af,0xa4b4ad76,0x8b8f9c51,0x6a8a7aec,0x39445a49,0x28c33924,0x4a2820e3,0x18a22924,0x20c318a2,0x20e320c3,0x20e320e4,0x18c318a2,0x212420e3,0x52aa4a48,0x290341a5,0x290320c2,0x29032903,0x21032903,0x10003985,0x08001820,0x00002902,0x00000000,0x31a70000,0x528b4a6a,0x18a439a8,0x4a0918a3,0x4a295a6b,0x62cc5aab,0x734e6b0d,
-0x62ec734d,0x732e7baf,0x5a6b6aed,0x5a6b522a,0x28a35a49,0x18a20800,0x18a22903,0x29030000,0x18612903,0x08003123,0x31642923,0x314318a1,0x396420a1,0x39444184,0x290241a5,0x31232902,0x206049a5,0x292328e3,0x10402902,0x310120c1,0x49c449e4,0x41e64183,0x20c03162,0x310228a1,0x51c430e1,0x7b0751e2,0x6aa67b29,0x93a97b26,0x7ae793aa,0x62647b07,0x83298b49,0x9b4882c5,
-0xc4d0b490,0xbc90b470,0x6227934b,0xa450a471,0xb4aeb48f,0xacb1a46e,0xb4f2a470,0xac92b513,0xa473ac94,0x9c52a473,0x9c11a493,0x4a07838f,0x310120c0,0x522549a3,0x834941c3,0x6a656224,0x7ac77ae7,0x82e67284,0x72a48328,0x7ae66a65,0x7ac58327,0x7aa672a5,0x7ac67ae6,0x6a857b28,0x7b288b89,0x6a656a66,0x6aa572c5,0x6a646264,0x72e8838a,0x49c351e4,0x628749e3,0x5a256a87,
-0x7b2a732b,0x7ae96a67,0x3943ac8f,0x62c94163,0x628783ac,0x51c57b4a,0x72a85a06,0x8b8a7b49,0x49c5838b,0x5a685a46,0x5a685a47,0x41e55248,0x000020e1,0x00000000,0x20200000,0x5a0451e4,0x622551a3,0x62667286,0x62466a87,0x6aa76a87,0x72c86266,0x6ac76aa7,0x62456a66,0x6ac76aa7,0x62856286,0x49833941,0x51c53941,0x28c11860,0x312041a3,0x31032080,0x30c24161,0x41833103,
-0x10a23186,0x29a80000,0x7c31632e,0xad359cd4,0xacd4ad15,0x7b4d8bd0,0x83ae9431,0x39247b6d,0x29232081,0x630b39a6,0x29033145,0x188220e3,0x20e320c2,0x20e32104,0x108218a2,0x20e318a2,0x5aab4208,0x314462eb,0x31443124,0x292418c2,0x314420e3,0x08002944,0x10001861,0x41e61040,0x00000000,0x42290000,0x4a4a528b,0x4a2a3167,0x526a4a29,0x4a4a5aab,0x39c82926,0x52ab4a6a,
-0x528b528b,0x83f173af,0x62ab6b4d,0x5a2a3946,0x20624146,0x10410000,0x08001061,0x20c21020,0x082020c2,0x10002081,0x39853964,0x31233964,0x31233964,0x28c13943,0x310328c2,0x31033123,0x10002881,0x290218a0,0x31431040,0x4a250800,0x39625a87,0x20a03983,0x20a049c4,0x31025226,0x52044183,0x72c651c3,0x7b476284,0x83687327,0x51c26ac6,0x516059e0,0xa3cd7245,0xacd0bd11,
-0xc553acb0,0xcd95d5d5,0xcd75c534,0xacb1b4f3,0xcd31b4b0,0xac8fac8f,0xac91acb1,0xb4d4b4d3,0xb4f4b4d4,0xb4d4b4f5,0xc536bd15,0x838eac72,0x41633143,0x49c33121,0x416051e3,0x624372a4,0x72a46243,0x72857aa6,0x7aa582e7,0x72a57ac5,0x83288307,0x93aa72c6,0x83287b07,0x72c67ae6,0x72e78349,0x5a036a64,0x72c76a85,0x730772c6,0x62a86aa7,0x41a449a4,0x62a749c5,0x62677b2a,
-0x6aa76aa8,0x6a877b29,0x416259e4,0x62a941a4,0x7b295a87,0x626651e4,0x6a876287,0x7b28834a,0x62667b08,0x5a475a46,0x5a685a67,0x41e64a06,0x108220e1,0x00000000,0x18000000,0x51e359e4,0x6a855a24,0x6aa76245,0x628672c7,0x62466246,0x6ac76a86,0x62877b09,0x6ac772e8,0x62656aa6,0x62865a45,0x49c149c3,0x41426285,0x28e03921,0x522528c0,0x39004162,0x6ac849c4,0x520449c3,
-0x00002104,0x21870021,0x73b031e8,0xa4f59493,0x7b8f9c73,0x7b8e7b8f,0x522883f0,0x39445249,0x20a11840,0x736d5269,0x29243165,0x18a23165,0x20e320e3,0x18c320e3,0x18c31062,0x18c318a2,0x5acb18a2,0x49e762eb,0x20c33124,0x29041040,0x31442904,0x10403144,0x10000800,0x29440820,0x00000000,0x39e80041,0x4a4a526a,0x4a294209,0x39a74a2a,0x31a720e4,0x00010041,0x10c408a4,
-0x42493a49,0x7bd0634e,0x6acc83f0,0x51e95a09,0x184230c4,0x00000000,0x00000840,0x10200800,0x312320c2,0x20a13944,0x29033985,0x41a520c2,0x31023123,0x288028e2,0x20811820,0x28e32081,0x49a61800,0x314320c1,0x08001881,0x292220a0,0x398241a4,0x312128e0,0x396228e0,0x5a875a87,0x520449a4,0x6a863920,0x6ae77b68,0x416162a5,0x41414181,0x82a96203,0xbd53c532,0xacf2b512,
-0xa4d29c91,0xbd34cdd5,0xcd95b4f4,0xacb2bd34,0xc510b4b0,0xac8fbd11,0xacb1acb0,0xbd15acb2,0xc576bd35,0xbd36b4f5,0xcd97cd97,0xac72d597,0x31023163,0x52044183,0x6aa45223,0x6a856244,0x7ae56a84,0x7ac67285,0x7ac57aa5,0x83077ae5,0x72c672a5,0x8b898b69,0x7ae68328,0x72c67ae6,0x6aa6836a,0x6ac67b48,0x6a857308,0x62657b07,0x5a274182,0x626762a8,0x49e53964,0x7b6b7b8c,
-0x5a4672e9,0x62456ae8,0x838b7ac7,0x41c44184,0x72c941a3,0x62666aa8,0x62676247,0x72a672a7,0x6aa76265,0x49e56287,0x52685a47,0x5a8841c5,0x10821880,0x00000000,0x30c00000,0x62456a86,0x5a246265,0x6aa66a86,0x6aa76aa6,0x62666aa7,0x62866266,0x6a876267,0x62666aa7,0x52046245,0x5a666266,0x49c35225,0x39215205,0x41824162,0x41823100,0x39005a46,0x6aa75a05,0x72c77ae9,
-0x10614a28,0x31c70000,0x84302986,0x736e8451,0x732d6aec,0x838e7baf,0x28c15208,0x084020a1,0x18a118a1,0x20e43165,0x6b2d6b4d,0x29046b0c,0x18a21821,0x18a320e3,0x18c31883,0x18c318c3,0x52ab18c3,0x62ec630c,0x186220c3,0x18a31062,0x20c32925,0x184030e2,0x08000000,0x29021020,0x00001060,0x10a32104,0x42294a6a,0x398741c8,0x082220a4,0x08010801,0x08630041,0x00420022,
-0x3a090882,0x4a6a428a,0x62cc734d,0x522962ab,0x18424146,0x08011021,0x00001882,0x20811020,0x39840000,0x290220c1,0x29023143,0x39853123,0x41651020,0x30e228c2,0x28a128a0,0x30c228a1,0x522651e6,0x08000820,0x080039a4,0x31633143,0x5aa74a05,0x520641c4,0x312049c4,0x39625225,0x41625a26,0x626449a3,0x20c028e0,0x414028c0,0x596238a0,0xbcf18b6a,0xacf2b4f2,0x94929450,
-0x6ac96b2b,0xacf3bd55,0xcdb7bd75,0xacd2bd35,0xddb3bd12,0xacd1c552,0xacd2acd2,0xbd35b514,0xd5d7c595,0xd5b8d5d8,0xde19d5d8,0xcd95de19,0x29023123,0x30e04143,0x7b275a04,0x7b068308,0x7b276aa5,0x834872c6,0x83077ac6,0x936a72a6,0x7ae67ae6,0x7b076a85,0x7b077b27,0x6a857b28,0x6aa66aa6,0x7b286aa6,0x5a246aa6,0x62026265,0x62a76224,0x62686288,0x52075207,0x52054184,
-0x62a662c7,0x7b095204,0x7ae88b4a,0x51c53100,0x72e828a0,0x62a762a7,0x6aa77329,0x6a8772a7,0x5225940c,0x5a676287,0x5a6749e5,0x31834a26,0x08411060,0x00000000,0x5a040800,0x62246224,0x6aa66265,0x6a8672c7,0x628762a7,0x49c35a46,0x52045204,0x418249a2,0x6ac84163,0x62876aa7,0x49825a04,0x39414161,0x39204182,0x49a349a2,0x62666a87,0x49634162,0x6aa63921,0x72e86245,
-0x20c23985,0x00210800,0x83f05acb,0x6b2d738e,0x7b8f6b2d,0x6aec9451,0x28a128c3,0x20e228c1,0x29231060,0x29242944,0x7bae630c,0x30e45a6a,0x18a330c4,0x21041021,0x29454209,0x18e41082,0x528a10a3,0x62ec632d,0x31043966,0x106218a3,0x20a220e4,0x188130e2,0x10001000,0x206028c2,0x08003103,0x18c40000,0x528b2105,0x082220e4,0x08011063,0x08421042,0x10a40021,0x10830002,
-0x4a4a0842,0x39c84a8b,0x62ab5249,0x31054a29,0x39661822,0x524a4a29,0x41a65249,0x20202082,0x18601040,0x10201881,0x188118a1,0x290320c2,0x39641860,0x30c13944,0x414430e2,0x416438e3,0x312251e5,0x08203143,0x39a55267,0x20e139a5,0x316239a4,0x39435a46,0x39413942,0x31013942,0x41a328a0,0x6ac651e3,0x41815a24,0x494128c0,0x932a61c4,0x8bacac4f,0xa4b1acd1,0x28c3736d,
-0x390330a2,0xc596b4f4,0xbd96de59,0xacf3bd75,0xcd51b4f2,0xc594cd93,0xacd3c555,0xc596b4f4,0xc575cdd7,0xde18d5f7,0xee7ae659,0xee79ee9a,0x28a06a88,0x62673903,0x73076266,0x72c57b07,0x7b068369,0x7ae66ac5,0x93897ac6,0x7ac67ac6,0x83277ac6,0x93a972c5,0x6aa572e6,0x6a8572e7,0x6aa66a86,0x626672c7,0x41a36266,0x6a65de55,0x5a669b8b,0x62695a26,0x5a4849e6,0x41a45a48,
-0x28803100,0x7b095a04,0x6a2572a7,0x49a44961,0x49a249c3,0x49a25a23,0x62a783ab,0x83ab730a,0x62a77309,0x5a865a45,0x52265a66,0x31834a05,0x00001080,0x00200000,0x6a660800,0x62456a65,0x6aa672c6,0x6aa672a6,0x51e562a7,0x418249c4,0x39413962,0x49a249a2,0x39203920,0x41824982,0x41613920,0x28c04141,0x49a43920,0x49a35a05,0x31006a87,0x9c6f4162,0x416093ed,0x62246204,
-0x10002081,0x00002080,0x734e5acc,0x6b4d6b4d,0x83f06b4d,0x52087b8e,0x208128a2,0x18a11000,0x18c10000,0x4a6a18e3,0x7b6e738e,0x4187628b,0x20c43926,0x6b2d3987,0x28c5630d,0x526a20c4,0x630c62ec,0x6b2d6b0d,0x20835a6a,0x08211862,0x20e31062,0x28c22903,0x20a01020,0x10002060,0x10202081,0x08410000,0x08620841,0x31670842,0x106218a4,0x190418a3,0x39872925,0x18831042,
-0x4a490863,0x41c84a4a,0x520a30e6,0x49e8528a,0x102241c8,0x524941a8,0x39865249,0x08001882,0x31240000,0x20c23985,0x188120c1,0x10403144,0x30e21841,0x498428c1,0x52064984,0x39034164,0x39834964,0x20c24184,0x188018a0,0x28c11860,0x21201000,0x396249a3,0x312151e4,0x39425266,0x28c020c0,0x38e051e5,0x41635a46,0x518359a4,0x9b8c7a47,0x93cdac50,0x52897bad,0x31243124,
-0x41a649a6,0xc5b69c91,0xb555ce17,0xad14ad14,0xd5b3b514,0xc595cd91,0xb514c575,0xd5f8bd56,0xd596cdd6,0xde18de18,0xee9aee99,0xee9aee9a,0x4122cdb5,0x62456287,0x49a14141,0x73067307,0x72e572e5,0x6aa572e6,0xa42c72c6,0x72a67285,0x7ae77ae7,0x7b077ae7,0x72c772e7,0x62646a84,0x62456ac7,0x5a465224,0x52045a26,0x41634181,0x6aa8cd50,0x624872a9,0x5aa95a68,0x52066289,
-0x30c03900,0x8b8c6246,0x7ae8a44e,0x7b096a46,0x52233920,0x41208bab,0x7b6b62a7,0x946f62c8,0x49826aa8,0x7b4a7285,0x520551e5,0x41845a68,0x00001880,0x00000000,0x62661800,0x7b086aa6,0x72c66aa6,0x6a866a85,0x392262a7,0x28c01000,0x7bac3162,0x5a254183,0x41603920,0x5a455a26,0x49a35a04,0x49a25205,0x51c45a04,0x622630e0,0x49a23921,0x390051e3,0x20408b6a,0x6a8659e3,
-0x10201020,0x104220a2,0x7bd0630c,0x630c736e,0x83cf7bcf,0x2882736e,0x39443104,0x08202081,0x18a118a1,0x5aec18e3,0x7b6e738e,0x6b0d6b0d,0x62ec6b0d,0x7baf6b0d,0x526b6b2d,0x734e62cc,0x734e738e,0x62ec6b2d,0x28c451e8,0x10421042,0x292420c4,0x31033103,0x10001020,0x31021820,0x20812081,0x00000000,0x10620840,0x08210822,0x08420842,0x004118e4,0x4a09526b,0x186339a8,
-0x42292966,0x398752ab,0x314628a5,0x4a094a29,0x41c84a09,0x312520c4,0x41a65208,0x312420a2,0x10411020,0x20c21881,0x102041e6,0x29030800,0x28a13103,0x39224164,0x41854163,0x202030e2,0x31024102,0x39842080,0x41c50800,0x20a02901,0x31213963,0x5a2628c0,0x49e55205,0x41634183,0x39213902,0x5a2551a4,0x5a053101,0x93ce4102,0xb4f2bcf2,0x9450b514,0x62ea840f,0x62ec6b2c,
-0xa4b39431,0xbd96ad35,0xad35c5d7,0xa514a4f4,0xbd52ad14,0xbd74c5b2,0xc5d7bd95,0xd639cdf8,0xd5d7cdd6,0xddf8d5d8,0xeebbee7a,0xe6bae6bb,0x9c30ce37,0x390151c5,0x5a0351a3,0x628449a2,0x7b495a45,0x62656a86,0x6a856aa6,0x6a857ae7,0x83288327,0x83078b69,0x7b076aa6,0x72c76264,0x51c449a4,0x5a2649c4,0x51e45a47,0x522549c3,0x6aa88c0c,0x6a896a88,0x62886268,0x6ac9942f,
-0x496149a3,0x72a75a06,0x72448308,0x59e26a23,0x834a5180,0x838b5a45,0x29213960,0x62c85267,0x62855a87,0x6a869c2b,0x62666a65,0x39425a66,0x00000820,0x00000000,0x6a862040,0x62668349,0x62866aa7,0x62876286,0x310051c3,0x390030e0,0x9c8f7309,0x52055a46,0x49a34161,0x51c36aa7,0x39413941,0x49a251c4,0x30e051a3,0x49844162,0x498259e4,0x28606265,0x72a74141,0x72e84941,
-0x28c01020,0x41c71860,0x734d62eb,0x6b0c6b2d,0x6b0c5aaa,0x41c72924,0x20614186,0x18a21000,0x08411081,0x42290821,0x734e6b8e,0x7b8f732d,0x6b4d83cf,0x6b0d6b4d,0x62ed6b2d,0x734e734e,0x62ec6aec,0x5a6a62cb,0x20a328c4,0x082118a3,0x20a31062,0x290328e3,0x18400800,0x20811800,0x30e31000,0x00000000,0x00000821,0x08421042,0x08630000,0x42690863,0x20c44a49,0x10822925,
-0x632d52ab,0x5a8b6b4d,0x28c43946,0x4209524a,0x526a526a,0x31054a4a,0x31251862,0x18623104,0x08003966,0x31241882,0x184030e2,0x08000800,0x18403124,0x31033944,0x30a128c1,0x39033081,0x41434143,0x00003944,0x39a30000,0x4a055a45,0x49a362a7,0x520728c0,0x10004183,0x30a128a0,0x38c15205,0x392149c4,0x41224122,0xbd766268,0xa4f3b555,0x8c31ad96,0x62ea630b,0x736e49e7,
-0x84117bd0,0xad578c53,0x9cb4a516,0x9cb39493,0xbd93a514,0xa532a4ce,0xb595a512,0xde9ac5f8,0xd5d9cdd7,0xde1bd5fb,0xe6dcde3b,0xb5d6d679,0xad549534,0x41a441a5,0x51c45205,0x41825a45,0x49c351e4,0x49a25a85,0x62246264,0x72a76a86,0x7b0772a7,0x72a77286,0x836a6265,0x49c46ac8,0x4a054184,0x72eb5a28,0x51e55a48,0x49e549a4,0x628741a3,0xacd25a47,0x7b2b93ee,0x6aca7b4c,
-0x62675a67,0x8bcb6a66,0x8b6a93cc,0x72e8ac6f,0x7b2759c3,0x5a654940,0x52465208,0x398228c1,0x7b6b5267,0x72c36266,0x6a457b27,0x39425205,0x000020c0,0x08000000,0x72c738c0,0x6aa76aa7,0x72e86ac8,0x5a246287,0x6aa84162,0x838b2881,0x41625205,0x31003100,0x49a33900,0x5a244182,0x498449c4,0x414149a4,0x628749a2,0x51c430e1,0x51c45183,0x392149a2,0x5a04b4d0,0x5a0349a0,
-0x39633122,0x6b0c3123,0x734d734d,0x314541c8,0x186128e3,0x62aa5269,0x184028e3,0x18a21020,0x18a21082,0x5acb0000,0x6b0d634d,0x7baf734d,0x6b4d6b0d,0x734e6b2d,0x6b2d6aed,0x62ec49e9,0x6b2d62ec,0x41876b0c,0x10011842,0x104220c4,0x18831862,0x20c228e3,0x206028a1,0x10001840,0x18201820,0x00002903,0x08410000,0x00011883,0x004208a3,0x4a6a2167,0x292539c7,0x21454208,
-0x73af5aec,0x6b0d8c31,0x39875a8b,0x4a2949c8,0x526a524a,0x28e54208,0x188228e4,0x10413966,0x20a320c3,0x00000800,0x8bef3964,0x000062ca,0x39641020,0x08003103,0x10004164,0x41232000,0x20402860,0x104041a6,0x00001081,0x49c451e6,0x6aa749e4,0x30e228c0,0x10003962,0x38e23943,0x72684984,0x49435143,0x732b51c5,0xad359430,0x849194b2,0x6b2d532b,0x4a4739c6,0x632d5a8a,
-0x843273b0,0x8cb48432,0x8c528c73,0x84118c73,0xa4f29d14,0x94b1a4f0,0x9d139cf2,0xc638a555,0xcdf9d639,0xcddacdfa,0xdebbde5c,0x52ebce79,0x298521a6,0x49e520c2,0x496249c4,0x6aa749e3,0x52056287,0x62655a66,0x49614981,0x51c259c3,0x6a866223,0x7ae96a66,0x7b6b72e8,0x41a46ac8,0x5a6749e5,0x72eb5a68,0x49c55227,0x5a476288,0x418349c4,0x62685206,0x72ca836c,0x5a6862a9,
-0x83ac62c9,0x6aa76267,0x9bec7b49,0x93cc940d,0x834872a7,0x5a666a22,0x52476288,0x188028c1,0x52253984,0x8348836a,0x62248b8a,0x41834182,0x00003121,0x08000000,0x834940e0,0x6a876a87,0x6aa85a46,0x41825225,0x312041c3,0x30e13921,0x394128e0,0x49c34161,0x39014162,0x49a33920,0x392049a2,0x51e351e3,0x418328c0,0x414330e0,0x49835205,0x51c551c5,0x51a351c3,0x41416aa7,
-0x39643943,0x7b8e5247,0x4a296b2d,0x28a32063,0x5a492061,0x62cb7b8e,0x18813104,0x18c218c2,0x18c218c3,0x52ab2104,0x6b2d6b4d,0x6b2d732d,0x736e6b0d,0x6b0d630d,0x62cc6b0d,0x39a762cc,0x6b0d4a09,0x20a362cb,0x18422063,0x10621883,0x20a318a3,0x314428e3,0x206030e2,0x18401800,0x18401840,0x000020e3,0x29450000,0x08420000,0x00010041,0x00000883,0x10820000,0x11042165,
-0x6b8f632d,0x62ac736e,0x49e96acc,0x41e83966,0x4a4941e8,0x20a34208,0x28e428c4,0x28c328e4,0x20a328e4,0x31451882,0x18a21882,0x20e23165,0x10002903,0x20811000,0x38e34184,0x412430c2,0x49842860,0x39853103,0x20e039a4,0x5a0562a7,0x52056246,0x100049a3,0x28c24162,0x288049c5,0x61e64102,0x72ea59a4,0x8c519450,0x6b8d7bf0,0x00003248,0x10c30882,0x5b2b0040,0x6b8f4a6a,
-0x84535b2e,0x7c326bd1,0x7c528473,0x7c328452,0x8c938473,0x7c508cb1,0x6b8f740f,0x8cf36bce,0xce19d679,0xd63bd67c,0xce7ae6bd,0x636db5d6,0x00002185,0x312210c2,0x62456267,0x62876267,0x62675a26,0x5a255205,0x59c351c3,0x620559e3,0x6aa759e4,0x8b8c838b,0x734c83ad,0x52064164,0x49e55a47,0x520749e6,0x6b2b62aa,0x628983ee,0x49e46267,0x626949c5,0x836c940f,0x62a96aaa,
-0x62c95aa9,0x41e462a8,0x7b2941a1,0x6aa77b8b,0x83496225,0x836ba40b,0x4a2728e0,0x396220c1,0x49c349e4,0x7b0693aa,0x7b278307,0x31016a84,0x00003142,0x08000000,0x6aa759c4,0x72c86245,0x62876266,0x42055225,0x18202920,0x20801840,0x28c06287,0x30e030e1,0x20803941,0x288051e5,0x51c430c1,0x41634163,0x20404142,0x52062880,0x49e55a27,0x41803920,0x496049a2,0x624651c2,
-0x392328a0,0x62aa6aeb,0x49c7738d,0x41a61841,0x4a083124,0x5a697b8e,0x18a11882,0x210420c2,0x10a218c3,0x5aeb2945,0x630c630c,0x524a5acb,0x6b4d6b0d,0x630c62ec,0x630c6b2d,0x5a8b630c,0x6b0d3966,0x396662ec,0x10212063,0x20c320a3,0x4a2928c3,0x39653124,0x208120a2,0x102028a1,0x18202061,0x082028e3,0x08200000,0x00003165,0x00220822,0x00000042,0x39e72965,0x5b2d08c3,
-0x6b0d6b6e,0x734e6aed,0x5aab62cb,0x42085aab,0x52494a29,0x18835249,0x188220c4,0x41e83165,0x18825249,0x29043966,0x28e341c7,0x08003986,0x28e320e3,0x10400800,0x30e241a5,0x392349a5,0x184028a1,0x31435207,0x29212121,0x49c439a3,0x18806287,0x30e14183,0x41443902,0x58c44083,0xa3ef8a6a,0x9c32c514,0x6b8e9493,0x10a25aeb,0x00000000,0x29432964,0x6bae3a07,0x632e52ab,
-0x5b2e5b4e,0x638f6bb0,0x530e530d,0x4aec4aed,0x42cc430c,0x530b532d,0x118442aa,0x532c1184,0xc5d8a575,0xce5ace5a,0xbe38d69a,0x32079d34,0x00000000,0x08000000,0x51a36ac9,0x5aa75a25,0x5a254182,0x498351e4,0x62466a87,0x6a8749a2,0x7b4b7b4b,0x940e838d,0x5a4883ae,0x52264a07,0x5a665206,0x49843922,0x5a684984,0x52485269,0x62aa62ca,0x62aa5228,0x62ea62ca,0x62ca62aa,
-0x62a962ca,0x5a685a68,0x5a663961,0x5a470000,0x72e76ac7,0x7b8b836a,0x20801860,0x394230e1,0x20804143,0x72c672e8,0x834859a1,0x39209c0c,0x00006ac9,0x18000000,0x6a666a46,0x62676aa8,0x5a465a46,0x39a441e4,0x10201860,0x10001000,0x28a128c0,0x18003101,0x418328e0,0x18402080,0x28e03121,0x49a53941,0x39431820,0x28804122,0x5a043921,0x49834161,0x5a0451c3,0xcdb56226,
-0x51c71840,0x7b6d5a8a,0x49c7734c,0x5aca0800,0x52492924,0x182120c3,0x18a10000,0x18c21040,0x18c118e2,0x39e74228,0x29243166,0x188320e4,0x42283166,0x528b2145,0x6b0d6b2d,0x734e6b2d,0x6b2d6aec,0x6acb6b2d,0x28632863,0x18821041,0x290420c3,0x29233103,0x31243144,0x20e32923,0x10001820,0x30e22902,0x00000000,0x21042924,0x08021083,0x00000801,0x00a43a08,0x630c4229,
-0x736f6b6e,0x62cc62ed,0x6aec6b2d,0x318762ec,0x4a08526a,0x396641e8,0x20e449e8,0x41a741e8,0x39c74228,0x082120e3,0x20c349e8,0x084028e3,0x394418a2,0x08203165,0x08001860,0x10203965,0x080028a1,0x20c15227,0x210139c3,0x49e54a25,0x31226287,0x49a33943,0x72ca4164,0xd597c515,0xd619d5d9,0xb536bd98,0x19049493,0x19040000,0x08410000,0x21020000,0x29c618e3,0x426b3a29,
-0x00222167,0x10c32166,0x08c31104,0x00210082,0x00a20082,0x00610000,0x10620040,0x00600000,0x9d142165,0xbe38b5f7,0x8cd3adb7,0x2165536d,0x00200000,0x00200000,0x5a260820,0x41c36aa8,0x626649e4,0x5a2551c4,0x51c25a25,0x8bad72c8,0x7b4b83ce,0x8bcd730b,0x49c54184,0x49c55227,0x498451c5,0x62665204,0x49c46266,0x41c641a5,0x52485268,0x41c65a89,0x5a8a5228,0x5a895228,
-0x62ca62a9,0x5a493985,0x49c449a5,0x732b62a9,0x416128e0,0x62a75224,0x20802080,0x5a4649c5,0x30e03921,0x8bcb93ee,0x7b097328,0x7ae472c6,0x10006aa6,0x10000000,0x62667b4a,0x5a056a87,0x52065a06,0x084039c4,0x00000000,0x31221040,0x31011800,0x20403902,0x18200800,0x18405a67,0x100028a2,0x28611000,0x10001800,0x28812020,0x30c04963,0x730a730a,0x496251c3,0x93ed51c4,
-0x734d6b0c,0x6b0c732d,0x10006aab,0x6b2c1841,0x31445289,0x000020c2,0x08600800,0x004018c2,0x18e21903,0x18c33165,0x106118c2,0x10a310a3,0x39c71083,0x528b39e8,0x732e736e,0x6b0d6b0d,0x6aed6b0d,0x6b0d6aec,0x30e55a2a,0x20c320c3,0x18621062,0x312420a3,0x20c22904,0x20c220c2,0x18201840,0x188028c1,0x00000800,0x29251062,0x08221083,0x08410001,0x08c32987,0x6b4e52ec,
-0x6aec6b2d,0x31455209,0x630d39e8,0x4a6a526a,0x5a6a5acc,0x5aaa5a8b,0x41475a8a,0x20a41022,0x29864a49,0x31661945,0x39863126,0x18c220e3,0x10600000,0x20611020,0x418449c6,0x18203921,0x20a25207,0x00000800,0x4a053142,0x628841e5,0x28e12080,0x49e55206,0x9c502860,0xcdb8cd97,0xd61ad63b,0xbd97c5b8,0x31c7a535,0x000031c6,0x08400020,0x18a10000,0x088010c1,0x00010000,
-0x08a20021,0x00000000,0x18a10840,0x29230000,0x18a120e3,0x00000840,0x18810000,0x18600800,0x11021861,0x6bce532c,0x08e37430,0x00000020,0x08200000,0x00000841,0x41a33985,0x51e5838b,0x5a2551e4,0x5a056246,0x72e86266,0x7bab93cd,0x416451e6,0x628951e6,0x62685227,0x5a275227,0x5a466247,0x5a2451c6,0x49c36266,0x52474a06,0x52075206,0x62cb5a69,0x62cb5269,0x62ca62eb,
-0x52485248,0x62894a27,0x522649e6,0x39213141,0x51e541a1,0x5a4649c2,0x630a3901,0x41623122,0x38e051a3,0x5a024942,0x6a446284,0x62236244,0x59c37ae8,0x18a12860,0x62e87b29,0x5a465a25,0x39845247,0x00000000,0x00000000,0x00000000,0x10400800,0x4a061840,0x08001020,0x20a01040,0x08200800,0x00001020,0x18000800,0x30c12020,0x30a11800,0x418151e4,0x416151e3,0x30c151e3,
-0x83cf736e,0x5a6a6b0c,0x180051e8,0x6b0c0800,0x20c24a48,0x31441040,0x18c21041,0x08000840,0x18c218a2,0x108118a2,0x108318c3,0x10a310a3,0x4a6a0862,0x738f632d,0x734e732e,0x6b0d62ed,0x6b2e6b0d,0x41c85a8b,0x49e95aab,0x208328c4,0x10411841,0x28e320a3,0x20c23124,0x20c22903,0x184020a1,0x312228e1,0x00001040,0x4a290000,0x08410821,0x42080000,0x31c80883,0x6b0d528b,
-0x5a4a62cc,0x08422905,0x088210c3,0x18e410e3,0x528a52ab,0x5a8a5acb,0x41a85a8a,0x4a6a18a4,0x216531a7,0x104310e4,0x526920e4,0x00000840,0x41a62124,0x080020a2,0x080020a1,0x180030e0,0x30c22061,0x08000000,0x10002080,0x31021020,0x396320a0,0x30c10800,0x72cb61e7,0xd61ac597,0xde7bde5b,0xbd97c5b8,0x4a6a9cd4,0x00000000,0x31850000,0x00002103,0x00000000,0x18620000,
-0x00000000,0x10201882,0x398320c1,0x31421860,0x208028c2,0x18a11060,0x31021860,0x394328e1,0x184038e3,0x004010a0,0x20e22984,0x08001840,0x000020c2,0x39c60000,0x20820000,0x49c46269,0x62861820,0x5a455a45,0x83696ac7,0x5a2672e8,0x5a486288,0x5a475a27,0x62885227,0x62265a26,0x6ac86a88,0x49a172a8,0x51c25a04,0x49a451e5,0x49a451e5,0x5a896268,0x62ca5289,0x62ca6aeb,
-0x5a695aaa,0x6aaa5228,0x52065a28,0x41834183,0x73094181,0x6aa83120,0x49c451e5,0x20605a27,0x59e151a4,0x8b8a72a8,0x72a66202,0x6a8538e0,0x7ac38307,0x830493a7,0x73287b28,0x52465aa6,0x000039a5,0x00000000,0x31650000,0x00002904,0x20a20000,0x000020e2,0x00000820,0x08210000,0x00000000,0x18400800,0x30e04142,0x62a651c2,0x5a656ac7,0x41605a04,0x49c249a1,0x62a84181,
-0x7b8f83af,0x62aa6aeb,0x08001801,0x39851000,0x20e320e3,0x184139a6,0x00200000,0x20c320c2,0x20c220c2,0x10601881,0x108220c3,0x18c41083,0x4a6a18e4,0x7b8f738f,0x6b0d6b0d,0x6aec6b0d,0x6b2d62cc,0x4a0962ec,0x62cc526a,0x39265a6a,0x28832883,0x20e41862,0x20e320e3,0x20e320e3,0x100020a1,0x310228a0,0x000028e1,0x08610000,0x00002945,0x3a080841,0x5aec2987,0x62cc736f,
-0x38e5626b,0x10822083,0x08820000,0x10c310a3,0x31c71905,0x528a3a28,0x31865aaa,0x528a2966,0x39e81082,0x08020802,0x41e75aab,0x000039a6,0x31040000,0x30c31800,0x10002882,0x20013901,0x20402040,0x20811001,0x49625162,0x31431020,0x51e63965,0x59a65207,0x83af93cf,0xc619a4f4,0xde5be69c,0xbdb8d63b,0x73b0ad77,0x00000000,0x00000000,0x00000000,0x00000000,0x10200800,
-0x31224184,0x20a03963,0x31223943,0x39633942,0x28e128c0,0x418328c1,0x41834163,0x30e13943,0x31024164,0x29023124,0x392120c0,0x31234183,0x18403943,0x00010800,0x39c60000,0x52063123,0x62865a66,0x5a468bec,0x72e9732b,0x52266287,0x52066288,0x5a6949e6,0x62885a27,0x832a51c5,0x6aa872a8,0x5a4672ca,0x51c36264,0x498251c2,0x49c34962,0x41845a26,0x62cb5a89,0x52485a89,
-0x62ca62aa,0x628a5248,0x41845208,0x6aa749e4,0x416051e3,0x6a8830e0,0x51e46288,0x6a6738e1,0x7ae99bcd,0x72a78b6a,0x51a059e2,0x6ae67b28,0xac4ba42a,0x9c2aa44b,0x210183eb,0x528952a8,0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x00010000,0x00000000,0x10200800,0x208120c0,0x392228a0,0x62054942,0x6ac751c3,0x62456286,0x6ac75a45,0x39615a25,0x49c33100,
-0x732d7b6e,0x62aa6acb,0x20612041,0x210428e3,0x62cb4a49,0x5a297b8e,0x10411000,0x39a65a8a,0x29043145,0x18412082,0x18c320a3,0x10a31083,0x31870862,0x6b2e6b4e,0x6b0d730e,0x6b2d6b0d,0x62cb62cb,0x62cc62cc,0x62ec62ec,0x62ab5a8b,0x10012883,0x314520a3,0x20e32925,0x20e32904,0x184020a1,0x28c01000,0x00003964,0x00000000,0x00002104,0x296539c7,0x5acc4229,0x5a6b736f,
-0x41675a6a,0x20a330e5,0x20c420e4,0x08420821,0x29460842,0x528a4a28,0x528a5aaa,0x630c5acb,0x00000000,0x29462905,0x5b0b5acb,0x39a64a68,0x10000000,0x28621800,0x28612020,0x49224103,0x40e061c4,0x40a061a2,0x72464900,0x310251c3,0x20604185,0x20004164,0x8c317b6d,0xa55673af,0xce5ace3a,0xb597d65b,0x84119494,0x00002945,0x00000020,0x08200000,0x00001041,0x28e220e2,
-0x310228e1,0x20a03943,0x18801860,0x394228e0,0x310228e1,0x28c03943,0x49c44163,0x39213121,0x498349a4,0x418349e4,0x49a349a4,0x39425a46,0x49843101,0x08003123,0x00000000,0x41c620c3,0x51e65a27,0x41825225,0x31425224,0x62a86ae8,0x5a686288,0x628a6289,0x5a475a27,0x5a066a67,0x6aa76a86,0x72c96a88,0x49a349a4,0x51c45a25,0x51e45a26,0x51e551c4,0x6aaa5a47,0x5a685aa9,
-0x5aaa6aeb,0x52075248,0x49e65a48,0x498349e6,0x39205a24,0x62663920,0x30e05204,0x626730e0,0x7b2a6aa8,0x836a7b08,0x6a866aa7,0x9c2d7329,0x940672c5,0x732983a7,0x08811080,0x08201080,0x00000000,0x00000000,0x20c10800,0x20a028e1,0x20c02901,0x30e028e0,0x20a028e0,0x28c10800,0x08001860,0x49e54163,0x51a24982,0x72c859e3,0x6aa77b49,0x5a656286,0x49c26ac7,0x6ac75a04,
-0x6aec732d,0x20824186,0x28c12061,0x5acc2904,0x6b2d6b6e,0x7b2d734e,0x20634125,0x734d5aab,0x6b0c736d,0x204249a8,0x18622082,0x18c418a4,0x084220e4,0x62ed5aac,0x734e730d,0x62cb5aac,0x62cb6b2d,0x6aec62ec,0x6b0d62cc,0x730d5a8b,0x28834167,0x188228e4,0x188220e4,0x21032924,0x182020a1,0x310128c0,0x102051c5,0x00000000,0x00202945,0x294539e7,0x5aec4209,0x7b6f83d0,
-0x6acc732d,0x28c44146,0x312528e4,0x39a84a29,0x31673166,0x39c72924,0x528a4a29,0x73af736e,0x0021632d,0x630c4a49,0x29a64a8b,0x42082144,0x28a35269,0x28a34124,0x49436249,0x724338a2,0x596148c0,0x40a05140,0x7a866182,0x41430800,0x416430c1,0x30a23103,0x7bcf5a89,0x428b0882,0xc65aa556,0xad97bdb8,0x6b6e8c73,0x002018e3,0x10210000,0x20a320c3,0x08000800,0x418428e1,
-0x49e53943,0x28c14184,0x49e53963,0x310149e5,0x41843142,0x30e14184,0x62673922,0x49a36ac7,0x62466a66,0x416349c2,0x5a256247,0x62a76246,0x5a0728e0,0x41433101,0x10e31040,0x39851062,0x628949a7,0x5a695a49,0x39a35a67,0x62a841c4,0x62886ae9,0x52085a28,0x6ac95a27,0x624772c9,0x6aa76265,0x6aa951e5,0x72c872ea,0x62676a87,0x41616247,0x5a055a05,0x51c66268,0x6b0b5a68,
-0x6b0b5a89,0x62695aaa,0x628962aa,0x52045227,0x30e03900,0x520328a0,0x49c35a64,0x39421860,0x51c48bcd,0x5a257b29,0x838b6247,0x2080944e,0x49a320a0,0x39a33121,0x00000000,0x00000820,0x00000000,0x08200000,0x41823943,0x20a14182,0x31012060,0x39823182,0x28a22080,0x20a10800,0x100028e2,0x49e430c1,0x51a249a2,0x72e86223,0x72c86aa7,0x5a456ac7,0x6ac66286,0x51e34982,
-0x41a7732d,0x186128c2,0x18c31882,0x7b8f4229,0x7b6e83d0,0x732d6b0d,0x39463926,0x83af6aec,0x732d6b0c,0x626a7b4e,0x28e43105,0x20c31862,0x20c43145,0x62ec39a8,0x6b0d6b0d,0x62ec6b0d,0x6b0d6b2d,0x6aec62ec,0x6aec6b0d,0x730d62ab,0x28a45229,0x08411063,0x106220e4,0x106118a2,0x204028c1,0x288030c1,0x20403942,0x00000000,0x29450000,0x19044a49,0x4a8a4249,0x734e6b4e,
-0x732d6b0c,0x4a0941a7,0x4a2a5aac,0x736f6b2e,0x6aec738f,0x524a62cc,0x39a74a29,0x738e6b2d,0x5aeb630c,0x31a73186,0x19244248,0x10611924,0x00001041,0x9c72734d,0xa471838e,0x7aa68bef,0x8aa29325,0x61616160,0x6a237204,0x49835183,0x41844984,0x31243123,0x42074208,0x08410000,0x9d157c11,0x847394f5,0x6baf8492,0x00002985,0x00000800,0x31441041,0x314420e3,0x28e128c1,
-0x39433943,0x49e63964,0x41c441a5,0x39834183,0x39a449c4,0x41c520c1,0x5a4649c5,0x62876287,0x6aa76267,0x5a256246,0x62876287,0x62876266,0x39636287,0x49a451e5,0x080049a4,0x20c21861,0x41a65a69,0x62497b0d,0x49e64165,0x5a265207,0x5a465a26,0x5a486268,0x5a0751e6,0x7ac872ea,0x626772a8,0x5a466ac8,0x9c6e49a3,0x6aa8940d,0x6a876a88,0x5a057ae9,0x62a97b0a,0x734c62aa,
-0x52685a68,0x5a694a07,0x6a8962aa,0x5a276268,0x31004142,0x520230e0,0x52055a44,0x390130e0,0x6ac849a3,0x39214983,0x72e75a25,0x39216286,0x10003980,0x21010800,0x00005aaa,0x00000000,0x08600820,0x18620000,0x20801020,0x39423961,0x31203100,0x20a028c0,0x10201020,0x28a11020,0x10001000,0x4a0530c0,0x51a449a3,0x5a2551c3,0x72e87b08,0x62866ac7,0x62865a66,0x39215a25,
-0x20c22924,0x10e21081,0x632d18a3,0x734e7bef,0x7b6e7b8e,0x6aed732d,0x52092063,0x83af7b8e,0x7b4d7b6e,0x72ec7b8e,0x3105628a,0x28e42083,0x31264187,0x62ec41e9,0x62ec62cc,0x62ec6b0d,0x630c62ec,0x6b0d6b0c,0x62ec6b0c,0x5a6b6aec,0x20832905,0x08211883,0x20a418a3,0x20e320c3,0x206028c2,0x49832040,0x412328c1,0x00000000,0x29450000,0x000039c7,0x424931c7,0x5aab5acb,
-0x6b4d62eb,0x4a0941e8,0x6b0e524b,0x83f07b90,0x5a6a736f,0x4a495a8b,0x39a74a49,0x6b4e62ec,0x08614a49,0x39c62944,0x00814249,0x10620020,0x21241862,0x738e5269,0x62ab0800,0x938b732d,0x932182c3,0x69c192e3,0x51406181,0x39226204,0x41433902,0x524949c6,0x10a22944,0x00000000,0x6b6f1905,0x5b4e4aed,0x4a8a6bcf,0x10610000,0x29243945,0x29232904,0x294320c1,0x39833122,
-0x41a43122,0x49e65a27,0x49c449c5,0x39835a46,0x41c43963,0x41e641a4,0x522541e5,0x7b297309,0x5a056a88,0x7b0951e5,0x49a36ac8,0x5a676ae8,0x41635246,0x59c549c4,0x394249a4,0x08001020,0x51e841c7,0xa41093af,0x49c672ca,0x62675a27,0x5a6651c5,0x52065226,0x62276a89,0x6a466247,0x72c87a88,0x20406a66,0x416159e4,0x5a476266,0x72c872a9,0x498393ac,0x626872a8,0x6aeb6aeb,
-0x5a685a89,0x5a494a27,0x72eb6aeb,0x62075a48,0x62666227,0x28c05a25,0x62463920,0x51c46246,0x72c949a4,0x51e449a4,0x62884181,0x49c46267,0x186028e0,0x31831860,0x00000000,0x00000000,0x10600000,0x10601040,0x49e520a1,0x28e041a2,0x182028c0,0x18402080,0x080020a1,0x18401020,0x08001000,0x62a84141,0x49a351e4,0x626651e3,0x836a72e8,0x62666ac7,0x62666286,0x51e451e4,
-0x18820000,0x08411882,0x738e39e8,0x83af738f,0x7b8e83af,0x5a6a7b8e,0x5a8a28a3,0x7b8e7baf,0x62ab732d,0x62eb5a6a,0x5acb62eb,0x62ab5a6a,0x5aab62ec,0x62ec5aab,0x62ec62cc,0x62ec6b2d,0x6b2d5acb,0x6b0c736e,0x62ac62ed,0x6b0d5aac,0x3147524a,0x08221883,0x18831063,0x18a218a2,0x310228e2,0x41841820,0x41632080,0x08001000,0x08610000,0x00212945,0x4a6a4249,0x42085acb,
-0x6b2d62ec,0x5aab632d,0x83d062ec,0x84108c11,0x52297bcf,0x28843125,0x318628e5,0x52ab738e,0x39c629a5,0x10a22124,0x004110a2,0x21040020,0x10820800,0x31450000,0x734e30a3,0x836c628a,0x82816a23,0x8b058ae3,0x6a4361a0,0x498359c2,0x41a53964,0x10a23165,0x00201082,0x00000000,0x11040000,0x21651145,0x21240062,0x20c21080,0x29032903,0x20e220e3,0x29433184,0x49a50800,
-0x52063102,0x49a54164,0x522749e6,0x49e441e6,0x5a6741a4,0x41845206,0x49c55226,0x524641a3,0x62a85a46,0x6a6672c8,0x522551e4,0x41e45226,0x49a339a3,0x5a4549c4,0x30e049a3,0x08000800,0x5a693965,0x93f09c31,0x6aa993cf,0x51e672ca,0x6a876247,0x7b4a72c8,0x6a886a89,0x82886ac9,0x7203a286,0x49424942,0x41a451c5,0x5a2751e5,0x93ee6aa9,0x6a469bcd,0x6245a42d,0x5a487b4b,
-0x5a685a68,0x62695227,0x5a075a28,0x8b8d7b0b,0x832c7b2b,0x30c06247,0x7b2a5161,0x5a4672e9,0x5a2551a3,0x62665a46,0x62872860,0x5a675a26,0x100028c0,0x080028e2,0x00000000,0x00000000,0x082041e6,0x39a42101,0x398341e5,0x20a03983,0x31421860,0x188120c0,0x20601020,0x28c030e1,0x49c530e2,0x626741a3,0x49a36267,0x49a24181,0x72c751c3,0x72c8836a,0x5a256286,0x49c249a2,
-0x18611020,0x000120e3,0x630c2104,0x83af738e,0x62cb732e,0x4a08734d,0x4a0820c3,0x4a28734d,0x29033985,0x31660800,0x5acb528a,0x6b2d6b0d,0x62ec734e,0x5aab62cc,0x5aab5229,0x630c5acb,0x6b2d6b0d,0x734e6b2d,0x6b0d6b0d,0x6b0d62cc,0x5a8b7b6f,0x10423146,0x18830821,0x290320c3,0x310320a2,0x28601800,0x310128a0,0x080030e3,0x00000000,0x19042965,0x5acb39e8,0x528a6b4d,
-0x6b2d6b2d,0x632d6b4d,0x4a4a2946,0x7baf736e,0x62cb734e,0x29045a8a,0x52ab39c7,0x10a3632d,0x39a631a5,0x00000861,0x29650020,0x080018e3,0x00000000,0x00000000,0x6b4d628a,0x310441c7,0x498341a5,0x7b074980,0x5a049beb,0x28e249a3,0x18c220e3,0x18e32945,0x00200000,0x00000000,0x00400841,0x10c10040,0x398420e2,0x396428c2,0x18a120a1,0x29021080,0x41c53163,0x4a063143,
-0x396341a4,0x49c549c6,0x52475227,0x316241c5,0x5a675a46,0x5a675a67,0x49c549e5,0x5a6749e5,0x5a6749e5,0x7b4a6aa8,0x52057b2a,0x4a255225,0x41835246,0x51e44183,0x626651e4,0x18805a06,0x730a0800,0x9c0f8b8d,0x9c2fb4b2,0x72e972a9,0x5a266268,0x6a886246,0x62676267,0xb42c6a88,0xfeb5fed4,0x59e559e5,0x6aa96288,0x62895a47,0x6a886aa9,0x72876226,0x72658b29,0x62696a87,
-0x5a485207,0x5a485a48,0x940f8bce,0x8b8d83ad,0x834c8b8d,0x7b086a88,0x6a673900,0x830972a7,0x49427226,0x7ae96a45,0x6a457267,0x62277aa7,0x286059c5,0x208030e1,0x00000800,0x10610000,0x18c01040,0x39a42921,0x39842942,0x5aa739a4,0x318341e4,0x20c03983,0x28e01020,0x39423942,0x39224162,0x52065206,0x51c55206,0x41624162,0x5a0551e4,0xa46e5a25,0x5a456ac7,0x18004182,
-0x00001021,0x00000000,0x42082104,0x732d7bef,0x39462904,0x396662ab,0x314520a3,0x28c24a08,0x208128e2,0x184020a1,0x5acb528a,0x732d6b0d,0x730c6aec,0x31255a6a,0x41e828e4,0x528b4208,0x7baf6b2d,0x7b8f734e,0x62cc734e,0x6b0d6aed,0x6b2d734e,0x10023166,0x10421042,0x312428c3,0x312328c2,0x20801840,0x28c028e0,0x08203164,0x00000001,0x29455acb,0x52694228,0x42084a49,
-0x528a4a49,0x5acb738e,0x29252105,0x630c41e8,0x62eb5aec,0x41e74a48,0x4a690821,0x18e34a49,0x21243165,0x29443165,0x318610a2,0x08000841,0x28e31061,0x18831041,0x7baf6b0d,0x20a32904,0x29043125,0x6b2a3985,0x30e26266,0x294530c4,0x08412145,0x10a239e7,0x00000020,0x00000000,0x08400840,0x29642102,0x31430820,0x41842923,0x20a23102,0x28e13124,0x20a03943,0x41a42901,
-0x4a265247,0x41845226,0x4a064184,0x62a85227,0x51e55226,0x5a6749a4,0x5a475a67,0x5a064a05,0x62675205,0x62876aa8,0x52265205,0x49e55205,0x4a055205,0x52255205,0x52255a46,0x18405a25,0x72ea0800,0x9c2f72ea,0xa4919c50,0x62678bcd,0x62676288,0x72e96288,0x6aa86287,0xa44b72a7,0xde51ee53,0x62896268,0x5a275a07,0x5a276228,0x6aa96288,0x72a8a44f,0x6a05c42b,0x51a5836a,
-0x52075207,0x838c72eb,0x8bce7b6c,0x7b6c838d,0x8b2a8b8c,0x72c86246,0x69a159c2,0x9bac7287,0x598293ab,0x72875981,0x92c87266,0xb1e2a220,0x6a889ae7,0x28a03922,0x00202880,0x18400800,0x084020c0,0x39842921,0x4a054205,0x41e539a4,0x18a04205,0x10601040,0x18410800,0x41433943,0x49833901,0x51c55206,0x4a0651e5,0x49c341a4,0x4a0449e6,0x08005205,0x08001060,0x18200000,
-0x18612082,0x18a228c3,0x18412083,0x7b4d6b0c,0x20a33105,0x18821862,0x188220a3,0x186028e3,0x18602081,0x20a21020,0x5aab39c7,0x6b2d6b0d,0x62ab6b0c,0x18423105,0x39c720a3,0x5a8b4208,0x736e630d,0x6b4e734e,0x732e6b0d,0x6b0d6b0d,0x734d6b2e,0x39665aab,0x28e42042,0x20c228e4,0x28e23103,0x10002060,0x18401000,0x18803963,0x00000000,0x42080000,0x4a494a49,0x2945528a,
-0x39a718e4,0x5acb62ec,0x10622925,0x29663166,0x42075acc,0x18a220e3,0x632c528a,0x18c36b6d,0x00002924,0x1040734d,0x314520c3,0x10401041,0x31243144,0x290420c3,0x83f06b2d,0x29252925,0x28e43125,0x10632905,0x418628c2,0x18e449c7,0x08612104,0x00001082,0x00000000,0x00000000,0x18801060,0x106020c2,0x29433184,0x20803163,0x28c13101,0x28e13102,0x31421840,0x41a42901,
-0x31423142,0x52065206,0x52475a47,0x4a2641a5,0x6ac862c8,0x5a6749c5,0x4a055206,0x49845226,0x62675226,0x5a464183,0x62a862a8,0x52054a05,0x4a254183,0x52055226,0x52255225,0x39235a66,0x30e21840,0x8bce8b8d,0xa49193ee,0x5a26838c,0x730a5a47,0x730a6ac9,0x72e972e9,0x62256a46,0x838ba46c,0x730b6aca,0x6a895a27,0x5a486268,0x72ea6aca,0x51c45a27,0x8becf718,0x6a8872c9,
-0x8bce51e6,0x83ad834c,0x7b6c83ad,0x62a8838c,0x72e86a87,0x6a4359e3,0xb3eda40d,0x936a938a,0x61e47286,0xb42d9b89,0xdd0f8180,0xffb9ffb9,0x4983dd90,0x390251c4,0x41835204,0x31022860,0x29001840,0x31011020,0x316318a0,0x31633163,0x398318c0,0x18810000,0x08000800,0x39221000,0x52053901,0x520549a5,0x5a4649a4,0x6ac97b8c,0x208083ac,0x00000000,0x08001000,0x392228a0,
-0x49c749c7,0x18a23104,0x390538e5,0x208320c3,0x20622021,0x18821842,0x188220c3,0x100028e3,0x18610800,0x20612060,0x5a8b1062,0x6b2d6b0d,0x31456b0c,0x31052082,0x62ec4a09,0x5acb630c,0x736e7b8f,0x738e736e,0x6aed734e,0x6b0d6b0d,0x7b6e732e,0x730c734e,0x186338c4,0x20a21862,0x28e220a2,0x100028a2,0x18201000,0x39432080,0x00000000,0x31860020,0x29254228,0x41e82945,
-0x29450000,0x52494a29,0x18c32925,0x39a739c7,0x42074229,0x31852104,0x00003166,0x420852aa,0x000039a6,0x49e72904,0x10614a29,0x6b2c3966,0x20c362eb,0x312520c3,0x83f05a8b,0x31652925,0x28e43125,0x18a32904,0x31453146,0x10a341a6,0x10a231c7,0x00000000,0x00000000,0x18e30000,0x20c11040,0x10203944,0x08402943,0x184018a0,0x418428c1,0x31223963,0x312228c1,0x29014a05,
-0x316139a2,0x41a46288,0x524749c5,0x42055a88,0x62675ac8,0x5a475a46,0x41845226,0x72c95226,0x62a86267,0x5a476ac8,0x52267309,0x5a465a46,0x52665226,0x394241c4,0x5a4649a3,0x51e549a3,0x10000800,0x62686aa9,0xa4708bce,0x62886ac9,0x7b4b5a67,0x6ac96288,0x6aa872c8,0x7ac86a66,0x6aca6b0a,0x62685a27,0x6a896289,0x6a896248,0x6aca6289,0x8b6b7b2a,0x6288630a,0x5a056227,
-0x93ee834c,0x730b8bae,0x62a85a68,0x5a466ac8,0x7b6d6287,0x40c08b6b,0xedf372a5,0xac4c938a,0x8b08ddf4,0xbc2a9349,0xe4aaa301,0xdeb2a427,0x8baaffb8,0x49842040,0x28201860,0x10205162,0x39602041,0x31001800,0x29223141,0x18c039a4,0x08201080,0x00001041,0x08000000,0x390128e1,0x624751a4,0x49a45206,0x51c35a26,0x10203184,0x10006ae9,0x41413121,0x52245204,0x59e459e3,
-0x6aeb62aa,0x62cb6b0c,0x736d6b2d,0x49c76aec,0x180130c4,0x18212042,0x20a22062,0x290320a2,0x10401860,0x18401020,0x39c71881,0x736e630c,0x49e85aab,0x5a6a524a,0x630c6b0c,0x5acb526a,0x736e6b0d,0x738f7b8f,0x738f7bb0,0x62ac6b2e,0x83af6aed,0x83af8bf0,0x28835a4a,0x20a32082,0x20c128e3,0x182028c1,0x20601820,0x51e528a0,0x00000800,0x08400000,0x31654248,0x39a63165,
-0x18a31062,0x528a39a7,0x20e31041,0x316520c3,0x41e741e7,0x00002945,0x08620000,0x39c60000,0x10811061,0x29020000,0x08003185,0x188241a7,0x28c31841,0x39663904,0x31652905,0x41e839a6,0x20c43166,0x39a83966,0x316618c4,0x31862965,0x00002104,0x00000000,0x00000000,0x20e23124,0x29221040,0x18801880,0x28e12922,0x20a03984,0x416320a0,0x28c03942,0x20a01860,0x41833121,
-0x39634a05,0x4a0549e6,0x41c43983,0x39c44205,0x4a454205,0x5a6762c8,0x5a4672e9,0x6aa85a26,0x6aa872e8,0x62885a26,0x520549e5,0x5a265a26,0x52055a46,0x31215a67,0x5a666266,0x5a465205,0x10201000,0x51e749c6,0x72ea838d,0x5a26734b,0x62675a47,0x628851e5,0x6ae96268,0x730a6aa8,0x62686268,0x6aa96aa9,0x6a8972ea,0x7b0b93ce,0x730b6248,0x836c6289,0x62e95a87,0x838c5226,
-0x7b2b8bce,0x72ea6aa8,0x51e65a27,0x62875a47,0x61e47b4a,0xac2cc4af,0xf69792e6,0x82a671a1,0x922382c8,0xfe92d40b,0xf6d1feb5,0xff78dd47,0xac2a9b8b,0x30808327,0x6a452880,0x59e27287,0x59e44141,0x59e46a66,0x49e55a45,0x29222942,0x39c520e2,0x394249c3,0x41212860,0x51e530a0,0x49c228a0,0x49c44162,0x52055205,0x28c249a3,0x28c25a68,0x41814161,0x49604140,0x39203900,
-0x51e82062,0x186241e8,0x7bae62cb,0x732d736e,0x38e45a49,0x18412042,0x20a22062,0x49e71861,0x188020c2,0x100020a1,0x10811020,0x6b2d41c8,0x6b2d6b4d,0x62cc5acb,0x6b2d6b2d,0x62ec528b,0x6b4d630c,0x734e630c,0x7bd07b8f,0x6b0d7b8f,0x8bf06b2d,0x83cf9411,0x412672ec,0x28a31000,0x20c228e3,0x100028c1,0x28c01000,0x206030c0,0x00001000,0x00000000,0x39a739e7,0x29452925,
-0x084218a4,0x52693166,0x314520e4,0x31650800,0x526a1081,0x20c418a3,0x00001042,0x18c22945,0x39c60000,0x39640000,0x08005248,0x20e320c3,0x31042082,0x49e74986,0x31663145,0x4a294208,0x31253146,0x29053146,0x19042966,0x00001903,0x00000861,0x00000000,0x184020c2,0x20c03984,0x292220a0,0x18a01040,0x29012901,0x208020c0,0x28a028e1,0x31213942,0x41a34a05,0x5a4649e5,
-0x4a065247,0x52065207,0x4a065a47,0x31a33182,0x39a34205,0x628762a7,0x6ae96287,0x72e9834a,0x62666a87,0x5a465a46,0x5a466287,0x59e55205,0x62876a88,0x62875a46,0x626662a7,0x52056aa7,0x10001000,0x6aca51e7,0x6a6872eb,0x52065206,0x626762a8,0x39435a47,0x62886ac9,0x7b2b6aca,0x62896aca,0x72ea6ac9,0x6ac972ea,0x6aa951e5,0x8b8d7b0b,0x72ca6289,0x62c86ac9,0x94705267,
-0x7309840e,0x6aa97286,0x5a485a08,0x62875a07,0x62436aa7,0xff9a7ac7,0x9b486980,0x9aa5e5b0,0xb3659ae8,0xfef1fffa,0xfff7ab85,0x7260eece,0x8b057a65,0x72417262,0x7ae77224,0x51628329,0x72866a86,0x8bab7ae8,0x5a4751c3,0x08213163,0x5ac90000,0x51c44120,0x51e34141,0x310061e5,0x41630800,0x522549a4,0x41a35225,0x62a84163,0x20a03122,0x20802080,0x18201820,0x18002020,
-0x106020a2,0x292520c3,0x738e6b2d,0x83cf62ec,0x51c87baf,0x208230a3,0x28e320a2,0x4a692904,0x20a13144,0x10001840,0x18821880,0x62ec18a3,0x7bcf62ec,0x6aec630d,0x6b0c62ec,0x5acc62cc,0x62ec630d,0x6b4e630d,0x83f0736e,0x6b2d7baf,0x62ec6b2d,0x83cf83d0,0x49266aec,0x20832083,0x20a228e3,0x18203123,0x18201820,0x498430c1,0x10202880,0x00000000,0x5aaa18c2,0x526a41e7,
-0x28c43987,0x29044187,0x10611021,0x20e32103,0x18e318a3,0x21050000,0x18e42925,0x18c22104,0x20e22924,0x39a63985,0x39250000,0x28e33925,0x62ca1861,0x7b8d5a89,0x62ca3986,0x39a75248,0x28c33125,0x31464186,0x39e818a4,0x00000000,0x00200000,0x10600000,0x104020c2,0x28c11860,0x18a03983,0x31420000,0x49c43122,0x28e03963,0x49c54184,0x41624184,0x39213121,0x41843943,
-0x398339a4,0x31423162,0x41a341c4,0x294141a4,0x41c32121,0x6a875a66,0x5a466267,0x6a876ac8,0x62866266,0x6aa76aa8,0x62666aa8,0x51e56a87,0x72a86246,0x5a456267,0x62675225,0x49c46266,0x20a12080,0x6b0b5228,0x93ef83ae,0x5a266268,0x62685206,0x51c56a88,0x5a476267,0x62475a05,0x6aa96247,0x6ac96ac9,0x72c96ac9,0x7b0a7b0a,0x9c2f834b,0x72ea72ca,0x62a8732a,0x62c85a67,
-0x62678bcd,0x7b4b6246,0x52075a49,0x6ac95a07,0x59c37b2a,0xcdd22860,0x82838b48,0xd3e4ff99,0x8aa0fe31,0xff35dd8d,0x61e0d5d1,0x82818240,0x72a38263,0x92e769e2,0x7aa59b69,0x8b4882c7,0x72a68308,0x72c859e3,0x494151a2,0x08002080,0x51c60800,0x31004161,0x59e451c2,0x62446266,0x49824981,0x62a74963,0x20805a48,0x41825225,0x394151e6,0x6ae849a3,0x290020a0,0x394249a3,
-0x39e620c2,0x5acb5aeb,0x736e736e,0x736e83cf,0x732d736e,0x28a33925,0x186120c3,0x5aaa20c3,0x20a16b0b,0x18602081,0x18820000,0x4a291883,0x736e630c,0x734d6b2d,0x6b2d6b2d,0x5acc62cb,0x62ed5acc,0x630d5aac,0x6b4d6b0d,0x734d83d0,0x6b2d62ec,0x83af7b8e,0x49e86b0c,0x20a32082,0x20a23124,0x20803103,0x30e12880,0x41634142,0x20a049a4,0x080030e3,0x41e80000,0x62eb738e,
-0x28c44a08,0x29045229,0x18821862,0x00001081,0x18e34a49,0x108310a2,0x10a318a4,0x10a218e4,0x00000800,0x292341c6,0x29040000,0x396549c7,0x62aa28c3,0x314462aa,0x31641041,0x29052903,0x30e43925,0x31464186,0x108318c4,0x00000000,0x00000000,0x10402081,0x20c20000,0x41843963,0x396320c0,0x39623142,0x41a341a4,0x28e03121,0x5a4749e5,0x41834184,0x41624183,0x41a54184,
-0x39a43963,0x4a0541e4,0x49e55246,0x41c441a4,0x41c341c4,0x52054a05,0x7b096246,0x72c86ac8,0x62867308,0x62666aa8,0x72c86287,0x62676267,0x7ae96267,0x5a657309,0x49c55a46,0x418351e4,0x41a428c0,0x5a895a69,0x9c71734c,0x6ac96268,0x6a886288,0x62475a27,0x7aea5a06,0x62266a67,0x62886a88,0x628872e9,0x72e96aa8,0x6aa88b8c,0x6a896a88,0x834c72ea,0x6ac972e9,0x6aa76267,
-0x73087309,0x6ae84120,0x6aaa6aca,0x52285a48,0x93ad7b4c,0x7ac672c8,0x6a229389,0xffd6bcab,0x8220f670,0xe6f3f610,0x716061a0,0xff9bf56c,0xa3eb7227,0xa388b42b,0x7243edd1,0x40e071e3,0x38e06a25,0x9c0d59c3,0x6aa76ac8,0x49623941,0x51e51040,0x62466246,0x6aa76245,0x6a867b09,0x5a2472e7,0x41824161,0x20602080,0x100020a0,0x31025a45,0x418341a3,0x52250800,0x7b8b7309,
-0x20a220a2,0x5b0d526a,0x7b8f736e,0x7b8f83af,0x736d736e,0x4a0862eb,0x20823125,0x5a8a3946,0x39246aec,0x4a074a28,0x20822082,0x188220a2,0x6b2d5acc,0x736e630c,0x6b4d6b2d,0x5aab630c,0x5aab5acb,0x5acc528b,0x732d6b2d,0x736e736e,0x6aec62cc,0x6b2d732d,0x6b0c62cb,0x28a33966,0x208228a3,0x310230e3,0x28c13943,0x28c03101,0x39643943,0x31231840,0x39860000,0x6b2d6b0c,
-0x39264167,0x41a62083,0x000020e3,0x4a2862cb,0x31651061,0x08010842,0x18632925,0x00001042,0x18a11880,0x002028e3,0x20a20000,0x1861734d,0x5a8941a5,0x31453965,0x39652925,0x28a31841,0x41453904,0x398649a7,0x00001082,0x00000000,0x29030000,0x184020a0,0x10002080,0x20a028c0,0x20e03983,0x39623121,0x31214a05,0x49c53162,0x41a44a05,0x41c441a3,0x49a549c5,0x418449c6,
-0x31423963,0x41a341a5,0x39833982,0x52675226,0x5a4662a8,0x5a465245,0x6ac86ac8,0x72e87308,0x838a7308,0x72c86aa7,0x73086286,0x5a2572c8,0x72a76266,0x52037b09,0x52045a24,0x49e53121,0x28e228a0,0x5a895a89,0x8c0f4a07,0x6aca730c,0x6ae96aa9,0x6aa96268,0x7ae97ae9,0x62469c2d,0x51e56a88,0x6ac972ea,0x72ea6ac9,0x832b836c,0x8bcd7b4b,0x7b0a7b0a,0x8b6b72a8,0x6a86832a,
-0x72e86a86,0x30e05226,0x6ac95a26,0x6a896267,0x9c2e72ea,0x62658b8b,0x4100ffbc,0xff965980,0xff34ff32,0xbc04b343,0xdd6dcc68,0xff579220,0x596092e4,0xabe8ee75,0xabeafe95,0x8b28b48d,0x83077285,0x49816203,0x5a2559e4,0x49a16245,0x28803921,0x5a256265,0x6aa85a45,0x62666aa9,0x6aa762a8,0x62446a86,0x6ac76265,0x080020c0,0x00001060,0x51a42902,0x39831000,0x62a8838c,
-0x184130c3,0x528a1041,0x6b4d6b2d,0x62cb734d,0x83cf6b0c,0x630c1062,0x526a6b4d,0x62cb526a,0x28a241a6,0x6b2c62eb,0x5a8a5a8a,0x20c428c3,0x6b0d20e4,0x6b4d6b4d,0x734e6b4d,0x526a62ec,0x528a52ab,0x632d526b,0x6b2d6b2d,0x6b0d62ec,0x628b62cc,0x6b0c5a6a,0x630c62cb,0x206249c8,0x28c328a3,0x31233103,0x39432080,0x39423922,0x41a53963,0x31233123,0x08000000,0x62ec4a29,
-0x41a762ab,0x52292084,0x08202924,0x00000800,0x20e31041,0x20e53167,0x392618a4,0x398649c8,0x20e31081,0x10000800,0x312420c3,0x396662cb,0x31445268,0x20e43144,0x314439a7,0x416520a2,0x5a294166,0x29044187,0x00000020,0x00000000,0x20c20000,0x184020c1,0x49c528c2,0x28c13963,0x39a33122,0x310120a0,0x08003101,0x49c541a3,0x5a464a05,0x396241a3,0x41a53943,0x416441a5,
-0x4a055206,0x52055226,0x41c43141,0x52055a47,0x6ac85225,0x49c43121,0x62a76ae8,0x6ac76aa7,0x6aa77b29,0x730872e8,0x730872e8,0x7ae86ac7,0x72a77ae8,0x6aa66a87,0x51e56aa7,0x28c05245,0x734b41a3,0x5a895a89,0x62aa5228,0x6aaa93ef,0x5a676aaa,0x6a886267,0x8b8c72a8,0x9b8aa46e,0x62268b4b,0x836c6aa9,0x730b6268,0x62886aca,0x8bcd944f,0x72a94984,0xbd128b6b,0x6a868b8b,
-0x72e972c8,0x49a2838b,0x62885a05,0x62695206,0x6a875a27,0x28c093ec,0x2060eef9,0xffd95900,0xff38ff12,0xab64dcef,0xfe52feb3,0xfef2ed2a,0xa3c9f610,0xbc6c5100,0xabc8cd2f,0x7b06bcee,0x9c2d93cb,0x5a24cd92,0x7b285a04,0x62676225,0x6ac772c8,0x2880a44e,0x51e349a2,0x72e97309,0x6aa77329,0x62445a24,0x5a2462a5,0x62a87329,0x522541a1,0x41a362a8,0x100028c1,0x10000800,
-0x18002021,0x20e31060,0x42080841,0x39a65a8a,0x210420e4,0x41a718c3,0x734d6b2c,0x41e75aaa,0x10612944,0x6b2d5acb,0x6b2c6b2d,0x208241a7,0x31261800,0x5aab4a49,0x4a095acb,0x39e839c8,0x4a6a424a,0x738f52cb,0x6b2d62cc,0x62cc6b0d,0x6aec6aec,0x396749e8,0x62eb62ac,0x39a65a8a,0x416530c4,0x31033123,0x39222080,0x39223943,0x39643102,0x20a13944,0x00000800,0x632c2945,
-0x526a5aac,0x39873146,0x000018c3,0x41c70841,0x4a6a6b4c,0x20c40841,0x94938c31,0x8c31c619,0x000041c8,0x10002082,0x30e42883,0x732d626a,0x29234166,0x398639a6,0x29044a28,0x52492904,0x83ae62ea,0x31455a8a,0x00000841,0x00000000,0x310218c1,0x20c128e1,0x39213942,0x41a349a3,0x290041a3,0x39014162,0x41823920,0x51c55a25,0x41c449a4,0x4a0539a3,0x396449e5,0x52264183,
-0x5a466ae9,0x49e55206,0x41834183,0x418349c4,0x5a465205,0x49a349c4,0x6aa75a45,0x5a455a25,0x72e87b49,0x6aa86287,0x72c872c8,0x7b4972e8,0x6ac77b49,0x62467b29,0x5a666287,0x39612900,0x7b6b28a0,0x5a895248,0x52495248,0x83cf6aab,0x5aa95249,0x942f62a9,0x6aea9c0d,0xa44c7ae9,0x6266d5d3,0x62a94a07,0x4a275a88,0x5a676289,0x838c49c3,0x62a86ae9,0x836b6267,0x8bcc6ac8,
-0x7ae98b8c,0x6a87b4af,0x8bed59e5,0x52067b8c,0x83896288,0x0800942d,0x2840a4b2,0xff347120,0xc468c4ca,0xbd0e9260,0xffd5cc49,0xffd6e7f7,0xd5d68304,0x9ba879c0,0x7aa5e5f1,0xc572eed8,0x9c4f6aa8,0x6244b512,0x62864940,0x49c059c1,0x832a6265,0x7ae872e8,0xb51172e9,0x5a2430e0,0x51c26263,0x62866225,0x62866265,0x6a867b49,0x49c43921,0x49e341a2,0x396141a2,0x39614181,
-0x184028a2,0x08413964,0x526a2925,0x29045249,0x39a71061,0x29044a29,0x31642924,0x29442924,0x39a620e3,0x6b2c6b2d,0x734d734d,0x41a76b0c,0x10012062,0x10610000,0x18832924,0x00420000,0x424a31c7,0x7b8f632c,0x7baf7baf,0x6b0d7b4e,0x6aed732d,0x6acc5a8b,0x6aec6acc,0x522962cb,0x49a63925,0x5a273923,0x31012080,0x20603943,0x49c63922,0x28e23964,0x00000800,0x5acb0841,
-0x528b4a6a,0x08214a09,0x00000820,0x18a20000,0x08410000,0x18a30000,0x528b3166,0x738f4229,0x08002905,0x392520a2,0x39451000,0x7bae0800,0x20e33945,0x39865269,0x39652904,0x62aa41a6,0x31255a69,0x20c33966,0x00200020,0x00000000,0x20a01040,0x31431840,0x520449c4,0x41622080,0x39414182,0x5a2549a3,0x49834182,0x41436aa8,0x49c449c4,0x418241a3,0x6aa849e5,0x62876267,
-0x51e55205,0x41835206,0x5a465205,0x49e449a3,0x52056266,0x39215a46,0x49a349c3,0x6ac76246,0x6aa77b29,0x62668bab,0x730872e9,0x6aa76a87,0x6aa772e8,0x5a256aa7,0x52257329,0x28e03101,0x62a81000,0x5a695228,0x49e84a07,0x8bef83ae,0x62ea7b8e,0x942f5268,0xc59451c4,0xc5726267,0x8bcd9c4e,0x5aa96b0b,0x4a684a07,0x6b2b3985,0x52275a87,0x940e5a47,0x72c9836b,0x8b8c836b,
-0x6a8793cd,0x7ae96aa7,0x7b4a72c8,0x6aa86ac9,0x8bec838c,0x10206b08,0x30a0838b,0xff357204,0xa2e1fe6e,0xed09fe71,0xf5d1feb4,0xff57ffb6,0x93279326,0xf6b69b05,0x83059345,0x6ac84982,0x6ae662a6,0x622262a5,0x83297a86,0x49a15162,0x62465a24,0x38e04162,0x31204181,0x51c34140,0x39206265,0x30e05a04,0x73086267,0x49a27329,0x49a43101,0x416251e4,0x52245a45,0x418251e4,
-0x20c22081,0x526b1041,0x4a296b0d,0x20c30000,0x4a292904,0x314462cc,0x21022102,0x20e318c1,0x5aaa20e3,0x6b4d736d,0x6b2d6b2d,0x734d5aeb,0x10203125,0x08410000,0x102020e4,0x00000000,0x4a6a0862,0x7b8f634d,0x83d07b8f,0x6acc6aec,0x730d6b0d,0x732d732e,0x72ec62ab,0x628b730c,0x6ac949c6,0x390151c4,0x31023101,0x208028c1,0x49c61840,0x28c128e2,0x00002904,0x10a20000,
-0x4a6a4229,0x6b6e52cc,0x00000000,0x08000000,0x00000000,0x08420000,0x4a2a0000,0x6b4e3187,0x18215aec,0x30e428c3,0x29252924,0x6b2c3165,0x29243185,0x31653185,0x41c73145,0x41c73124,0x29053125,0x41a741a7,0x00201082,0x08000000,0x208028e2,0x39a428e1,0x394241a4,0x418330e1,0x398241c3,0x52044162,0x626751e4,0x51e551e6,0x624651e5,0x5a036267,0x62666a86,0x6ac77b49,
-0x6aa86287,0x5a675206,0x5a256266,0x394241a3,0x5a466287,0x73086ac8,0x626651e4,0x62866246,0x72e86a87,0x7b296267,0x7b49834a,0x730872e8,0x628672c8,0x6aa76286,0x41a37309,0x28e128c1,0x62a83922,0x62aa62aa,0x6aab5269,0x8bef9c91,0x83ce7b8e,0x6aea5a89,0x942f72c8,0x6b4c5ac9,0x62ea62ea,0x42284a49,0x3a072945,0x39c739a6,0x6aaa41e7,0x8bce5a48,0x834b6aa8,0x834b8bad,
-0x72e993ac,0x7ae972c7,0x7b0a72c8,0x52266247,0x9c4f6288,0x28e05225,0x20002920,0xfffac384,0xc468dd2b,0x8b65c5f4,0xdcaafe51,0xa3a1bd2e,0xa46ab3c8,0xabc9bccd,0xcd31b46b,0x8bed6a24,0x5a058b6c,0x726651e1,0x7a628ae6,0x6a675180,0x62256a66,0x49a25a24,0x39013900,0x51e36265,0x286038e2,0x51846a65,0x628651a1,0x52043100,0x51c44162,0x52055225,0x62675a46,0x5a465225,
-0x20622083,0x632c3986,0x394562ec,0x31451801,0x6b4d526a,0x31244a49,0x20e22903,0x212318a2,0x52ab2103,0x6b4d738e,0x6b2d5aab,0x6acb6b0c,0x20412904,0x20c31000,0x18821881,0x00001081,0x31a70000,0x738e630c,0x736e7baf,0x7baf736e,0x6b2d736e,0x8bf083d0,0x730d6aec,0x72ec6aec,0x7b496ac7,0x392072e7,0x20a03922,0x39233123,0x28a130a1,0x28c12060,0x00001881,0x00000000,
-0x29e82966,0x528b52cd,0x10a35acc,0x18a20020,0x00000000,0x00000020,0x736e18c3,0x73906b2d,0x2083736f,0x394520c3,0x294539c7,0x4a482945,0x49e739c6,0x732c732c,0x41c741c7,0x39862904,0x20a33946,0x29052925,0x000018a3,0x08000000,0x41843123,0x49c549c5,0x51c45a26,0x51e449e4,0x28e02060,0x59e530a0,0x62265a05,0x5a256a67,0x72e86246,0x7b2972e8,0x8b6a7b09,0x7b0972e8,
-0x626772e9,0x5a266247,0x6ae96a88,0x73095205,0x5a266287,0x7ae86266,0x83296aa7,0x7b4972e8,0x6aa772e8,0x7b4972c8,0x7b09838a,0x730872c7,0x62666286,0x62a76ac7,0x28c06266,0x000028e1,0x6b2b20e2,0x52487bad,0x9c715a28,0xacf4b556,0x947183af,0x526983ef,0x7b8c5a88,0x5aaa5a8a,0x5aab734d,0x08204a28,0x00001081,0x00000820,0x5a6818c1,0x49e66289,0x6ac96aa8,0x7b2b732b,
-0x7b0a72a9,0x838b8b6b,0x7b4b72e9,0x59e76ae9,0x5a27834c,0x28a05a44,0x38a00800,0xffb9fd8e,0xc4ecdc04,0xd4c9e56d,0xff99edef,0xff34e611,0x9c6dff79,0xb48ca42e,0xb4aed54f,0x73096205,0x51c251c4,0xfe741800,0xa40b8ae5,0xcd71cd70,0x414051c2,0x51e46a87,0x39203920,0x30e172c8,0x10005a86,0x61e02000,0x59e382e5,0x62251800,0x72c70000,0x62c82080,0x62a85a67,0x62875225,
-0x18412062,0x632c5aab,0x394562ec,0x52291842,0x7bcf736d,0x49e76b2c,0x290320c2,0x18e318a1,0x42082124,0x41e85acb,0x62cb62cb,0x5a8a6aec,0x394541a7,0x39253986,0x20a228a3,0x20c23165,0x20a30800,0x62ec1082,0x7baf83f0,0x8c3183f0,0x736e7baf,0x83af8c10,0x7b4e7b6e,0x6aab730c,0x73086286,0x28c15a46,0x28e13942,0x39233964,0x30e22040,0x10003102,0x000018a1,0x00000000,
-0x19270061,0x4a2a422a,0x31a752ac,0x18a32103,0x00000000,0x00000000,0x6b4d0841,0x736f526b,0x5209736f,0x39453945,0x18c33165,0x31663165,0x49e739a7,0x49e749e7,0x49e73145,0x39863124,0x28c43105,0x312539a7,0x00004a49,0x29230000,0x41a449c4,0x41c541a4,0x5a0549c4,0x51e45205,0x41624142,0x5a2551c4,0x6a6751c4,0x6aa772c8,0x5a256267,0x730872e8,0x93ab72a7,0x72e78baa,
-0x7b088b8a,0x72877ac8,0x62256a66,0x72c772a7,0x83696245,0x7ae86265,0x624672c8,0x73086aa7,0x7b296ac7,0x836a6ac7,0x73087b29,0x7b4972e8,0x62667b28,0x5a455a25,0x39416ac7,0x08210000,0x31640000,0x52074a07,0x8bae5a28,0x4a08ad15,0x8c5083af,0x4a280000,0xad545aa9,0x52494a28,0x5b0c52aa,0x000039a6,0x00002924,0x18a30000,0x00000000,0x41c620c1,0x5a695248,0x62ca5a8a,
-0x732b940e,0x7b6c7b4c,0x6aca9c70,0x8b8e7b6c,0x83ad940f,0x08005226,0x7a454163,0xa3a7fffa,0xb3c5e62f,0xabc5de33,0x62a4bd0b,0xac8a41e2,0xcd93ddf2,0x9bab6a28,0x9becac8c,0x8b4be676,0xbcce59a4,0xbd0ecd32,0x62256a86,0xd5f3a40b,0x834b7b2a,0x51e459e3,0x080049c4,0x5a2449c3,0xa4097328,0xfeae8aa0,0x4100a3c5,0x59e338e0,0x412028c0,0x5a876287,0x49a45205,0x49a31840,
-0x41e71882,0x7bcf6b2d,0x39467b4e,0x6aec2945,0x7bae730c,0x41c7738e,0x18a220c3,0x18e420e3,0x296618a3,0x39a74a49,0x62ec6b0c,0x49e862ab,0x39664a08,0x41a65a49,0x290420a2,0x20e32904,0x18a31082,0x000118e4,0x7bf06b4d,0x7bcf738f,0xa4d47baf,0x8c10a4f4,0x6acb7b6e,0x49446248,0x18004903,0x106128e3,0x182049c7,0x39222060,0x28c130e1,0x208030e1,0x00003944,0x00000000,
-0x18e60000,0x52ab3208,0x000010a2,0x29650000,0x00000000,0x00000000,0x312520e3,0x738f6b0d,0x6b2d738e,0x396620a3,0x18e32124,0x42082965,0x20c32945,0x39853965,0x416628e3,0x39253124,0x628b3124,0x08411883,0x00005289,0x41a40000,0x52261820,0x392130e0,0x51e43921,0x49833100,0x62663942,0x6aa76266,0x7b0a7ae9,0x6ac96aa8,0x732962a8,0x59e47b08,0x9bcb8308,0x7ae89bab,
-0x72a77ae8,0x7b0893cb,0x7ac66a66,0x7aa76a64,0x6aa66a66,0x72c76244,0x6a667ae8,0x72c76a86,0x7b29838b,0x7b496a87,0x73087349,0x6aa76a86,0x7b287b28,0x62a86266,0x39617329,0x00003142,0x52481040,0x526841e6,0x9c1041a6,0x9c939431,0x7bf09431,0x420810a3,0x00000020,0x42080000,0x738e52ab,0x08207baf,0x00000000,0x39a71061,0x00004208,0x00200020,0x5a8a3985,0x7bae4a28,
-0x8c0e83ce,0x6aea7b8c,0x730b6aea,0x940f49c6,0x83ce9c30,0x49a46aca,0xc4ce7b2a,0x6ae7feb4,0xb50f7307,0xee71ff57,0x10004961,0xb4ee30e0,0x6205e635,0x8b8c59c5,0x7b4acdd5,0x7aa86205,0x4120ac2d,0xb48e6a25,0x6aa67ac6,0x836b82c6,0x5a266a24,0x51e36225,0xc53351e5,0x49825a03,0x72c31000,0xf626c4e8,0xee28e563,0x59629368,0x49224141,0x39215205,0x41830800,0x39622880,
-0x41c71041,0x7bcf6b4d,0x4a4a7bcf,0x732d3165,0x5a4a1841,0x3145736d,0x18c31882,0x210420e3,0x5acb4229,0x5acc62ec,0x62ec6b2c,0x41a75249,0x52494a08,0x4a087b8e,0x20e428e3,0x18c320c3,0x18c318c3,0x08221082,0x73af2945,0x7bcf83f0,0x9472736e,0x94729cb3,0x72ec8bcf,0x20204986,0x00000800,0x20c220a2,0x18203103,0x28c11840,0x30e128a0,0x18801840,0x10213964,0x00000000,
-0x088218c3,0x00000000,0x00000000,0x08610000,0x00000000,0x00000000,0x20e21040,0x6b6d6b2c,0x5aab4a29,0x28e44a08,0x212410a2,0x18c32945,0x398639a7,0x31645208,0x30e43124,0x310430e4,0x418751e8,0x31663105,0x00000820,0x41c41081,0x62c93942,0x39213942,0x62665205,0x5a055a04,0x72e84183,0x7b097308,0x62666aa6,0x72c77b29,0x7b097b08,0x6a456a66,0x938b8b4a,0x93caa40b,
-0x93ab8b6a,0x8b8a8baa,0x9389836a,0x83087ac6,0x626572c7,0x6aa65a23,0x72e772e7,0x7b088349,0x6a6572c7,0x62c77b29,0x7b2862c7,0x7b296266,0x624572c7,0x730972e8,0x39615a86,0x186020a0,0x52484a07,0x520841c7,0x5a8a5a6a,0x8c318c31,0x73af8431,0x39c76b4d,0x294520e4,0x5aec528b,0x6b4d5acb,0x526a738e,0x08202945,0x18a241e7,0x00000000,0x00000000,0x41c70800,0x52495aaa,
-0x6b0b6b2c,0x5aaa7bce,0x7b6e4a28,0x9c727baf,0x9451a4d3,0x2080732c,0x6287730b,0x41c6ad31,0x6b0b62ca,0xb4f03984,0xb4f2a44e,0x7b08d5f5,0x59e56a86,0x838d9bee,0x72c851e5,0x93ec93cc,0xf69693aa,0xa40d8326,0x82c5d5b2,0x59c39c0c,0x6204b4d0,0x5a048b8a,0x8bcc41a3,0x59c30800,0x624528c0,0x8ba43100,0xb484bce2,0x72436a24,0x620472c9,0x730a5a06,0x51c46a67,0x59a53901,
-0x394630e5,0x7baf736d,0x526a7bae,0x62ab528a,0x080028c3,0x106120c3,0x20e31082,0x294518c3,0x6b6e4208,0x736e6b2d,0x62cc734d,0x396749e9,0x736e5a4a,0x5208734d,0x28c428e4,0x316620c3,0x18c320e4,0x29662145,0x630d0822,0x736f6b4e,0x7bb0738f,0x94318bf1,0x8c109c72,0x414672ec,0x08001000,0x08000000,0x28c228e3,0x18201020,0x31213962,0x28e241a4,0x31233924,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x49a50820,0x6b4d2903,0x39652924,0x294441c6,0x294518a2,0x316639a7,0x39a74208,0x49a63965,0x29032041,0x52283985,0x30e451e7,0x20e43966,0x08402924,0x398418a2,0x392028c0,0x41c41820,0x49a349c4,0x62874183,0x62465a25,0x72c872c8,0x72c76266,0x62258349,0x72c76266,0x8b498b8a,0x9bab938a,0xa3ebac4c,
-0x8b698349,0x8b69938a,0x9bca8b69,0xa42e8b49,0x6aa68328,0x73085a04,0x7308838a,0x72e78369,0x7b086a86,0x7b09834a,0x72e86a87,0x7b496ac7,0x628672e7,0x6ae87329,0x312162a7,0x30e13120,0x5a896268,0x41e75269,0x5aab4a08,0x84538452,0x5b0c738f,0x31c74249,0x42085acc,0x5aec41e8,0x31454a08,0x41e93167,0x00000000,0x00000000,0x00000000,0x08200000,0x10400820,0x08001021,
-0x00000820,0x31650000,0x630b5aca,0x73af83f0,0x7c0f8c71,0x6b4c73ad,0x39856b2b,0x7b6d732c,0x734c732b,0x5a26734c,0x51c26246,0x30603902,0x7aea49a0,0x9c0e93cd,0x93aa6a88,0x83289bee,0xde177b68,0xa46d30c0,0x83497b08,0x832a7287,0x516282e8,0x30a06a65,0x59e359c3,0x51a28b69,0x5a244120,0x834851e4,0x49607305,0x936a2000,0x61e4938a,0x72c75182,0x5a4651e4,0x82694945,
-0x182228a4,0x734d62cb,0x6b0c738e,0x28a362cb,0x00001800,0x18a20800,0x18c320e3,0x18e42103,0x632d39e8,0x7baf6b4d,0x736e736e,0x62cb62cc,0x8c10732d,0x626a7bae,0x18623946,0x18c31041,0x4a292104,0x62ec630c,0x000049e9,0x738f5aac,0x6b0d734e,0x8bd0628b,0x84109431,0x836e7b6e,0x10004166,0x00000000,0x41850800,0x10201020,0x18202061,0x39433101,0x28c25a48,0x00000000,
-0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x30e23103,0x4a2841a6,0x83ae41e7,0x7b8e62eb,0x39a62945,0x31872104,0x396618a3,0x30c24986,0x39243104,0x310449c6,0x392551e7,0x39874187,0x39a63165,0x41a40820,0x5a253962,0x4a055a46,0x41416287,0x6aa86a87,0x6aa76246,0x834a7308,0x83696a66,0x72c78b6a,0x7b298329,0x8b298349,0x93aa8b49,0xa42ca40c,
-0x7b0793a9,0x93aa8b8a,0x8b698b8a,0xb4ae93aa,0x7b078327,0x62655a24,0x8bcb7b49,0x72c78349,0x72c78349,0x72c772e8,0x62666286,0x836a6265,0x7b6a8369,0x6ac76ac7,0x41822900,0x62881860,0x52485207,0x41c75249,0x738f7b6e,0x29878c73,0x10610000,0x08610861,0x00000820,0x00000000,0x00000000,0x10200800,0x41e81880,0x00000000,0x00000000,0x31030820,0x31440800,0x10601060,
-0x00001880,0x4a270000,0x000018c1,0x4a684207,0x7bee73ce,0x630b632b,0x52485288,0x52477b8d,0x52676b0a,0x5a883163,0x72a730e1,0x72c861e3,0x7b4b8baa,0x8bcd9c2e,0x72a7940e,0x7b086a25,0x30e0ff9c,0x836a93eb,0x8b8b7b29,0x8bcd72a8,0xcd937b09,0x8bec7b29,0x6ac893ec,0x30c05a04,0x622572c6,0x41612040,0x39209c2c,0x8b6b8329,0x38a09bed,0x41206a25,0x69e56204,0xa3ae50a1,
-0x28c428c4,0x526a3145,0x738e736d,0x180172ec,0x00002001,0x41e70861,0x29244a28,0x18c318a2,0x630c39c7,0x734e736e,0x736e83d0,0x6b4d736e,0x7bae7bcf,0x39466b0c,0x20a32083,0x21041062,0x5acb39a7,0x62cc734e,0x28c562ac,0x630d62ed,0x62ec7baf,0x734e62ac,0x6b6d734e,0x83af8c10,0x38c472ec,0x00000800,0x18603124,0x10200800,0x18200800,0x39643101,0x180028e3,0x00000800,
-0x5a691040,0x00002124,0x00000000,0x00000000,0x00000000,0x10003125,0x28e230c2,0x41c728e3,0x9430840f,0x734d9471,0x318639a6,0x39a72945,0x39462925,0x41646249,0x414551e7,0x30c328a2,0x28e45228,0x314628c4,0x00002924,0x5a870000,0x5a455205,0x5a8751e5,0x5a045205,0x73096aa7,0x72e86ac7,0x838a72e8,0x7b088349,0x8b6a7b29,0x7b0893ec,0x8b497b28,0x938aa3ec,0x9beb9bca,
-0x8b688ba9,0x9beb93aa,0x8b698308,0x8b8993aa,0x7b088b89,0x5a457b08,0x73086aa7,0x7b2972e7,0x6a8672c7,0x6ac67307,0x836a7b28,0x73087b28,0x7b49836a,0x62c76286,0x41a22080,0x62482080,0x522862a9,0x4a295269,0x9cd37b6e,0x00000001,0x10610020,0x4a071060,0x08402123,0x00200000,0x39221820,0x416428a2,0x31663122,0x00000000,0x08010000,0x49c63104,0x5a6820c2,0x39a541e6,
-0x31223963,0x949028e1,0x632a5ae9,0x10a1736c,0x00000840,0x10814207,0x18a13144,0x6b0a2902,0x290141e5,0x4a270800,0x528841a4,0x51c35a06,0xad12b4f1,0x52471040,0x7ae78b8c,0x8bcb6a23,0x6aa45a44,0x93cd93ee,0x8beda44e,0x8bcd836b,0x7b098bcd,0x9bcaa40c,0x412059c3,0x7ae76a65,0x18006aa6,0x5a033901,0x6aa749a4,0xa42ea42e,0x832ab4b0,0x51828287,0x71e64921,0xb533d5b6,
-0x39263925,0x39c71842,0x6b2d734d,0x39a7632c,0x08000800,0x734d4208,0x20c3528a,0x18a320c3,0x39661882,0x6b0d4208,0x736d7bcf,0x39a7734e,0x7baf6b0d,0x310462ec,0x4a2928c3,0x5a8b526a,0x62ec62ec,0x5a8a62cb,0x30e54a08,0x6b4e2926,0x7b8f83f0,0x62ec734e,0x7b6e736e,0x6b0c7b6e,0x6aeb730c,0x18005a28,0x184028c2,0x18201000,0x100028a1,0x39633122,0x20a030e2,0x208020a0,
-0x51c630e2,0x00005a28,0x00000000,0x00000000,0x00000000,0x28c21882,0x104120a2,0x39653965,0x83cf2924,0x39856aeb,0x10613164,0x7b4d1062,0x41644165,0x49845a07,0x41864985,0x51e728c3,0x49c749a7,0x39873106,0x00002905,0x41c51061,0x39625a87,0x62a762a7,0x72c86aa7,0x72e86a66,0x72e872c8,0x73097b6a,0x72a77b08,0x83698329,0x8b697ae7,0x8b6972c7,0x93aa93aa,0x8b898348,
-0x8b698b89,0x93ca8348,0x93ca8b89,0x8b8a93ca,0x7b088baa,0x6a866aa6,0x7b2872e7,0x834972c7,0x83697b29,0x6ac78349,0x940c838a,0x6ae77b6a,0x6ac7838a,0x49c25a45,0x18403120,0x416430c1,0x52274164,0x41a75208,0x0800ad34,0x108152aa,0x10810000,0x00000000,0x08001040,0x4a2439a3,0x390051e4,0x39213921,0x20803100,0x00000000,0x310420a2,0x20611000,0x392130e1,0x18401860,
-0x4a0528c1,0x5a673121,0x10202922,0x52474a05,0x00003164,0x00200000,0x08200800,0x290239a4,0x188018a0,0x62ca3142,0x6b0c5aa9,0x83cc7b6e,0x62e96b4a,0x39c462e9,0x9c2c7349,0x7ac5cdb1,0x72c728a0,0x93cc7ae8,0x940d8bac,0x93cc9c0d,0x72e86a88,0x62c8b533,0x49616aa6,0x8b6b5a04,0x62247265,0x72c77308,0x6ac84142,0xa450836b,0xb4b0bcf1,0x79a29329,0x9b28a327,0xc4f3bcb1,
-0x4187628b,0x10431822,0x6b0c39a6,0x3966630c,0x28e41021,0x6b4d4a08,0x20e42925,0x20e420c3,0x20c418a3,0x39a718c3,0x526962eb,0x08005aab,0x7b8e62cc,0x5aab7b6e,0x6b0c4a29,0x6b0d6b2d,0x6b0c62ec,0x5aab5a8a,0x28c44a08,0x5acc1063,0x83d0736e,0x734e7b8f,0x7b8e734d,0x62cb5a6a,0x49c76aeb,0x30c34145,0x392430e3,0x204030e1,0x18202041,0x52262060,0x28e03922,0x18201840,
-0x5a471820,0x000059e7,0x00000000,0x00000000,0x08200000,0x18611861,0x29040800,0x39653124,0x7b8e3985,0x39855a69,0x39851060,0x940f3145,0x51e48bae,0x498359e4,0x5a4851c5,0x41c64a07,0x41863945,0x290528e5,0x210418c3,0x10400000,0x5a456ae9,0x52046286,0x7ae76aa6,0x72e87b09,0x7b2a51e3,0x52047b89,0x83296a86,0x8ba97ae8,0x8b8a8b89,0x8b8a9bcb,0x83498349,0x8b698327,
-0x83488b68,0x8b698b89,0x8328a42c,0x93cb8b69,0x83688baa,0x62656244,0x6ac772e7,0x7b087b08,0x834972e8,0x73087b28,0x838a7b29,0x6aa67b49,0x52045a65,0x520328c0,0x208028c0,0x62674143,0x5a896268,0x5a285a28,0x20a2ad33,0x00003144,0x18a10000,0x08600000,0x31430800,0x4a046287,0x28a049a3,0x416251e4,0x5a264182,0x39650000,0x080028a2,0x08001861,0x10200800,0x08010000,
-0x10000000,0x39221800,0x31203120,0x20803941,0x08011000,0x10600800,0x00001040,0x20c00800,0x08200800,0x10600800,0x20c11881,0x41a44a06,0x41e41060,0x314441e5,0x7b482941,0x28e09bc9,0x7b086225,0x836b6266,0x9c4e8bac,0x832a942e,0x8b4b6224,0x6aa728a0,0x622472e7,0x6a633900,0x59c26a23,0x286072a6,0x49824101,0x836b30c0,0xc531ac8f,0xd4f0d531,0xdd72d4ef,0xe5d5edf5,
-0x732e732d,0x39665a8a,0x62cc3966,0x42085acc,0x520918a3,0x732d526a,0x41e762ec,0x41c728e4,0x2924526a,0x20e33165,0x082118a3,0x31251021,0x630d62ec,0x6b0d6b4d,0x6b0d62ec,0x6b2d6b0d,0x62cc6b0d,0x5a6a5a6a,0x180349a8,0x62ed2926,0x7baf7baf,0x7bae736e,0x838e83cf,0x730d6aec,0x72ec730d,0x30a259e8,0x28a14164,0x20601800,0x18001820,0x10001800,0x28c01860,0x28c02081,
-0x51a43100,0x31224163,0x00000800,0x31450840,0x08010800,0x00001863,0x18621882,0x31863145,0x316562eb,0x52695a8a,0x20c349e7,0x8bcf49e7,0x7b29a450,0x59e37b49,0x52065a05,0x31446289,0x39a639a6,0x292662cc,0x21030822,0x08200821,0x41624a05,0x62a649c2,0x83496aa6,0x62657ae8,0x7b096aa5,0x6a856a85,0x7ac87ac8,0x7b078b89,0x93ca8b68,0x8b6993aa,0x9beb8328,0x93aa938a,
-0x8b698b89,0xac6da42c,0x83078307,0x8b489389,0x73078369,0x5a237308,0x72c76286,0x83698349,0x7b086a66,0x6aa77308,0x6b087308,0x62a762a6,0x51e55a66,0x31004182,0x51e628a0,0x6a676267,0x62485a27,0x51c65a08,0x9c2f7b2b,0x41a61020,0x00000000,0x00000000,0x628841c5,0x39415204,0x41a349c3,0x39213921,0x396251e4,0x31021000,0x18201000,0x18200800,0x10001000,0x20411000,
-0x20201000,0x30a04100,0x310038e0,0x414149a2,0x41403900,0x20803920,0x104028c2,0x49c14181,0x10002080,0x206028a0,0x10200800,0x08001860,0x290120c0,0x31a339a4,0x5aa75267,0x52476b08,0x7b496aa7,0x838b838b,0x9c2e7b2a,0x8bcb942d,0x72e78bab,0x39006265,0x5a246a86,0x6a656a44,0x6a6672c7,0x62255a04,0x41227ae9,0x71e269c4,0xcd0ebc8c,0xddb3ddb2,0xee14ee35,0xfe77f635,
-0x6b2d62ec,0x5acb630c,0x630c4a49,0x5a8b5acb,0x18832105,0x734d49c8,0x6b4d7b8e,0x52695269,0x736d6b2c,0x630c6b4d,0x5aab5aab,0x188320e4,0x62ec62cb,0x6b0d630c,0x732d6b2d,0x6b0d732d,0x62cc6aec,0x5a6a62ab,0x28c54a09,0x62ed3988,0x83d0738e,0x83cf83d0,0x94317b6e,0x8bf09471,0xa4929431,0x6a899410,0x10002060,0x10003904,0x18202880,0x08001800,0x28e10800,0x10002080,
-0x392030e0,0x180049c2,0x8b8d59e5,0x10015208,0x29052083,0x10212083,0x312528a3,0x29652904,0x4a0820c3,0x83cf62eb,0x39865a69,0x10006aeb,0x6a868b6a,0x7ae78328,0x62886226,0x31854a27,0x39a64a28,0x080128e4,0x41e718c5,0x10400000,0x49a349e5,0x524472e7,0x7ae87b49,0x6aa672e8,0x6a868349,0x8b8b72c6,0x83097b09,0x834872c6,0x8b898b69,0x93a993ca,0x83289c0b,0x8b498b49,
-0x9c0b8348,0x93aa93ca,0x8baaac6d,0x93898369,0x7b498368,0x834a5203,0x72e76aa7,0x5a457308,0x73087308,0x7329838a,0x52456ae8,0x62c86ae8,0x49a45266,0x288028c0,0x7b0b28a0,0x6a88836b,0x520772ea,0x626851c6,0x93ed72c8,0x10006227,0x00000000,0x08410000,0x39627b8c,0x49e33941,0x49a349c3,0x49c351e4,0x39824142,0x31010800,0x49841000,0x392230e1,0x72e851c5,0x49635143,
-0x5a0572c8,0x51a15a24,0x62235a02,0x498172c6,0x62226a85,0x6ac651e2,0x62844182,0x62645a44,0x204049a1,0x5a245203,0x416130e0,0x184020a0,0x394028c0,0x31433982,0x00003143,0x4a470000,0x7b4b7b6c,0x8bcc8bee,0x7b097309,0x8369940d,0x8baa8349,0x6aa65a04,0x49a151e3,0x62246a65,0x72c76a86,0x5a036225,0x59c47ae8,0xb3e971e3,0xd52ebc6b,0xf676dd92,0xee35f655,0xf636f676,
-0x6b4d5acb,0x62ec630d,0x5acb62cc,0x528a528a,0x20e4528a,0x5aaa0801,0x4a2862cb,0x28a320e4,0x6b4d5a6a,0x5acb20c3,0x6b4d7b8e,0x21042925,0x526a39a7,0x6b2d6b0d,0x7b8f6b4d,0x62ec6b4e,0x6b0c62cb,0x5a8b5a8a,0x41e8526a,0x528b4a09,0x6b2d6b2d,0x736e738e,0x730c734d,0x62cb8c10,0x8c508410,0x100049a6,0x18401800,0x10003100,0x18402060,0x20601840,0x18201820,0x20802080,
-0x30a01800,0x7ae77b48,0x5a266a87,0x20013040,0x20831842,0x28212041,0x62894965,0x31675228,0x41c73986,0x83f06b2c,0x418651c8,0x62664a07,0x72637a86,0x8b8a7ac6,0x6acb51e5,0x31852924,0x31245228,0x310530e5,0x4a282924,0x106141c7,0x51e32901,0x72e75223,0x7b496ac7,0x7b076aa6,0x7b088369,0x83298308,0x93aa93aa,0x93ca93aa,0x8baa9bea,0x8baa8b8a,0x9ba98307,0x7b069bca,
-0x8b8a8b8a,0x8b6993cb,0x93eb8baa,0x83698baa,0x7b478349,0x6ae74160,0x838b7b49,0x7329838b,0x5a667309,0x62a76287,0x524562e7,0x4a4539a3,0x186039a3,0x41233101,0x59e65a06,0x5a266206,0x49646226,0x6a686248,0x7b2a6247,0x3901ac90,0x08201000,0x93ed2081,0x41a23961,0x41a249c3,0x51e449e2,0x392051e4,0x20a05a06,0x28a10000,0x41423922,0x39014963,0x5a259c0d,0x59c36a45,
-0x62856aa6,0x72a68baa,0x7b078308,0x7b0772c6,0xacd08349,0x51c06aa6,0x62634160,0x6aa64160,0x62656244,0x62446a85,0x392051e2,0x31204981,0x30e228e0,0x10601860,0x00000000,0x082020c0,0x5aa91860,0x5a887bce,0x730a6268,0x942d7b8a,0xa4af3101,0x52057308,0x732949e3,0x7ae88329,0x72a66a23,0x59a27ae8,0xa3ed9bed,0xccad48a0,0xd4ced4ee,0xe614e5f2,0xfeb6f696,0xfef8fe96,
-0x31663146,0x526a4a29,0x2104528a,0x5acb39c7,0x41e85acb,0x5a8a1883,0x42082904,0x20833145,0x104128c4,0x4a491062,0x736e6b4d,0x20e42945,0x5aab20c4,0x630c6b2d,0x6b2d6b2d,0x6aec7baf,0x5a8b524a,0x524a5a8b,0x630d5acc,0x5acc62cc,0x6b0d62cc,0x732d6b2d,0x396662cb,0x41c75a8a,0x29044a28,0x18402082,0x18403924,0x31023922,0x39221000,0x30e13101,0x10001820,0x20801820,
-0x41003900,0x830993ec,0x62487288,0x38a340a2,0x30c34966,0x49234124,0x942e72c8,0x290428e2,0x4a293166,0x736e3166,0x392462eb,0x6a655a27,0x6a448b28,0x72c759c1,0x52075a05,0x39c62903,0x31242903,0x20c449a7,0x31874229,0x082018e4,0x5a241880,0x52044181,0x72e76aa6,0x7b086aa6,0x83498369,0x9beb93aa,0x8b4993aa,0x9beb93aa,0x83698b89,0x93eb93ca,0x83279389,0x9389a40b,
-0x83498b8a,0x93eb93cb,0x836993eb,0x8b898b89,0x7b2893cb,0x522451c3,0x6ae87308,0x49c349c3,0x6ac85225,0x41c26265,0x41c34a23,0x31813982,0x100039a1,0x51a528a0,0x622651c5,0x62676227,0x72896247,0x8b4c93ae,0xa46e4142,0xc5538b8c,0x20001800,0x5a041800,0x31613120,0x394141a2,0x41621840,0x30e04183,0x522730c1,0x20401000,0x30c049a3,0x49834142,0x62037ae7,0x62436a64,
-0x7ac659e3,0x6a836a85,0x624472e5,0x7b0672a5,0x624472c5,0x5a436ac5,0x416049c1,0x62436284,0x416051e2,0x51c15a23,0x51c14140,0x49c23920,0x182062a7,0x20e05a66,0x00000000,0x186020c1,0x08002901,0x39a52964,0x7b4b942e,0x73295a66,0x62a762a7,0x62e7944e,0x628741a4,0x8b6a8308,0x6a658349,0x6a247265,0xb4909bed,0xdd2fbc6d,0xe550e590,0xf696ee13,0xfed8fed8,0xfed8fed8,
-0x20c318a2,0x20e30800,0x084118a3,0x5a8b2925,0x31464a49,0x62ab1883,0x528928e4,0x18a241e7,0x106120c3,0x420818a3,0x52696b2c,0x20c32903,0x630c2145,0x738e7bcf,0x630d632d,0x62ec6b4d,0x526a49e8,0x62ab5aab,0x736e630c,0x6b2d738e,0x5a8b5aab,0x6b0d5aab,0x4a2962ab,0x62cc62ec,0x28e43966,0x18203105,0x10200800,0x20a020c0,0x30c21800,0x18203100,0x28c02880,0x30a030c0,
-0x51625181,0x62066a46,0x41646228,0x83ae51c6,0x40e38bcf,0x9c705965,0xac508b8c,0x28e45aa9,0x42084a49,0x738e39a7,0x62677c10,0x93a88b29,0x83067244,0x72c86a43,0x5a283921,0x41453945,0x30e33124,0x20e441c7,0x20e56b0d,0x21032966,0x52042902,0x51e45225,0x836a6a86,0x7b077b28,0x93aa7ac7,0x83278348,0x93aa8348,0x93ca8b89,0x8b8993a9,0x8b6a72c6,0x6a648348,0xa40da40c,
-0x8b698349,0x8b698328,0x8b8993cb,0x93ca8348,0x7b088bab,0x41a25a45,0x52035a44,0x49c441a2,0x51e451e3,0x49e34182,0x39823961,0x292039a3,0x28e00800,0x6a477b2a,0x7b2c51e6,0x836d7b0b,0xa47193ee,0xa430a471,0x6a6728a2,0xa40f7267,0x28209bce,0x73282040,0x41826206,0x522551e3,0x394149a4,0x30e138e0,0x62a983cd,0x10001000,0x41836267,0x51a22881,0x7ae76a65,0x9c0d834a,
-0x5a016a44,0x72858325,0x72a47284,0x51e07ae5,0x51a04961,0x51a04960,0x5a234140,0x62637284,0x418051e0,0x41406aa4,0x41813900,0x394051c3,0x18601820,0x0000a4d2,0x08200800,0x20a01020,0x28a03161,0x42060000,0x4a075246,0x41c341c4,0x41a25245,0x73483141,0x6b6820e4,0x9c2c72c7,0x938a9bac,0x6a6459e3,0xbcf2938a,0xe5b2b42e,0xf5f2edd2,0xff18fe75,0xf6d8ff5a,0xff1aff1a,
-0x20c31882,0x28e418a3,0x080020a3,0x4a292925,0x4a094a29,0x10613986,0x6b0c5a8a,0x10415269,0x00001061,0x62cb0821,0x20a241c7,0x21042924,0x6b4d31c7,0x630c6b4d,0x6b2d39c7,0x6b0d6b0d,0x6aec62ec,0x524a5a8b,0x736e630c,0x738e7baf,0x62ec630d,0x6aec6b2d,0x528a5a6a,0x630c6b2d,0x41873966,0x31034a08,0x18601040,0x20611000,0x18001800,0x18201820,0x5a4730e1,0x30813080,
-0x7ae959e5,0x5a07836c,0x93cf838d,0x9c719c30,0x59656249,0x93ce8b8d,0x49648b4c,0x28e43164,0x42082104,0x736d630c,0x730983ef,0x8b677ae7,0x7aa58b27,0x51e46202,0x49c74163,0x41652041,0x49c73965,0x41e82903,0x210520e5,0x39861925,0x416228e2,0x6a865a45,0x72e77ae8,0x7b077b08,0x8b8a7b08,0x93ca8b69,0x8b699beb,0x8b698348,0x8b8993a9,0x832972c6,0x8b6872c6,0x9beb9389,
-0x8b698b8a,0x8b698328,0x72a67b08,0x6a646a85,0x72e77308,0x418151e3,0x41815203,0x52054181,0x49a23941,0x520449c3,0x4a044161,0x20c039a3,0x6ac91800,0x6a889c50,0x9c505a27,0x9c70a491,0xbd13b4d2,0xa450acb2,0x62888b6d,0xa40f59e6,0x9b6dbcd2,0x61e52000,0x396051a2,0x5a465204,0x51e42080,0x59e551e4,0x49846287,0x10000800,0x5a46836b,0x30c02040,0x72a56204,0x83097286,
-0x72c493a9,0x7ae66a62,0x6a436a63,0x62426222,0x72c54960,0x51e16a84,0x7b073920,0x7b064981,0x51e149c0,0x5a036aa5,0x394051c2,0x416051e1,0x6ac828a0,0x104149c5,0x10001800,0x10001820,0x41422900,0x080020c0,0x524728e2,0x31203142,0x18605224,0x6288acd1,0x62e70800,0xa46e7b6a,0x9becbcd0,0x93a98baa,0xa3ec6a24,0xf5f37225,0xfe96f633,0xff19ff18,0xff5aff5a,0xff1aff1a,
-0x28a34166,0x20c318a3,0x18222063,0x5a8b20e4,0x62ec5acb,0x528a4a29,0x5aaa6b4d,0x18a21881,0x18a21061,0x6b2d6b2c,0x416628c3,0x18a21861,0x39e74249,0x528a4208,0x62ec52ab,0x6aec5acb,0x6aec6aec,0x29056b2d,0x738e62ec,0x7bcf7baf,0x6b2d6b2d,0x4a096b2d,0x5aab524a,0x6b0d6b0d,0x31055229,0x41863966,0x10201020,0x28e128c2,0x498230e0,0x49824942,0x6aa949a5,0x72694124,
-0x8c10832d,0x8bf08bef,0x94318bcf,0xad13bd35,0x5a497a8b,0x51245a08,0x59c54081,0x29252923,0x29661082,0x42083186,0x7b696289,0x7ac583a9,0x9b8d7264,0x72c8ac2f,0x30e35a09,0x39243904,0x396530e3,0x29253145,0x29463146,0x29052125,0x418228e3,0x72a751e4,0x72e772e8,0x8b6a7b2a,0x730783aa,0x8b698348,0x83487b07,0x834893aa,0x7ae77ae6,0x8b8a7ae6,0x93ca8348,0x7ae79388,
-0x8b8a93cb,0x834993aa,0x8b698b89,0x7b077b07,0x6aa67b28,0x522428a0,0x49e33120,0x49c44181,0x51e35204,0x39415224,0x31624182,0x39431040,0x6ac94961,0x62886aa7,0x94706ae9,0x83ce8c0f,0xa471acb2,0xa450a450,0x5a4893ef,0xa4705a07,0x9c51a470,0x1800a42d,0x206051c4,0x30e02080,0x28a06264,0x49628b8b,0x832a6a04,0x10200800,0x51e56aea,0x38c02020,0x62036a45,0x83087aa6,
-0x49606a64,0x72c56a62,0x6a837284,0x6a855a01,0x7b285a22,0x62655a65,0x418151c1,0x628551c2,0x49815a22,0x30e03920,0x49a151e3,0x62866265,0x30e051e2,0x10012060,0x83ab3101,0x51c26244,0x49012080,0x394059c2,0x41c339a2,0x10401040,0x31213961,0x62a649e3,0x5a653923,0xa4af62a7,0x93eba48f,0x8baa940b,0x7a238ae6,0xe57069c3,0xff5afeb6,0xff5bff7a,0xff5aff3a,0xff3aff3a,
-0x390528a3,0x626a49c8,0x62ab5a8b,0x62eb5acb,0x31665aaa,0x4a49526a,0x29034a29,0x084118a2,0x6b4d4a49,0x734c8410,0x30c33924,0x10610800,0x18c318a2,0x39c72965,0x210439c7,0x5a8a526a,0x39865249,0x00001841,0x6b4d0841,0x73af738e,0x7b8e738e,0x39a86b0c,0x62ab4a2a,0x62cc6aec,0x49c86acc,0x18212002,0x18401840,0x72ea3102,0x49c56a89,0x41644163,0x41454984,0x8b6d6228,
-0x7bcea471,0x7bce7bce,0x83ef8c50,0xa4d3bdb6,0x8b6ea492,0x836d832d,0x4a067b4c,0x102241a6,0x29053125,0x31242104,0x834951c5,0x7ac572c6,0xc5736aa4,0xb4d3c575,0x180051e7,0x30e41841,0x204130a3,0x312530c3,0x20c42925,0x314639a7,0x31222924,0x73084163,0x730872e8,0x6aa76ac7,0x72e772e8,0x8b497ac7,0x72a68328,0x7b0793ca,0x7b087ae7,0x938a8349,0x8b499bca,0x9beb8b69,
-0x83278327,0x93ca93cb,0x8b8a8b48,0x72c672c6,0x498262a6,0x41813941,0x39204181,0x49a24141,0x49a349a2,0x416051e4,0x18604162,0x62461000,0x72c8834a,0x5207a44f,0x522762a9,0x5a6762a8,0x93cd6247,0x940ea490,0x6a695206,0xa4506248,0xb491b4d2,0xb512b4f1,0x20c07b29,0x20801000,0x2040836b,0x8b496245,0x62a76a44,0x08210000,0x31208bee,0x30001820,0x6a648309,0x7b0772c6,
-0x51a05a22,0x6a635a20,0x6a4359e1,0x83276243,0x6aa55a22,0x5a637b27,0x41405202,0x52034180,0x416049a0,0x39203100,0x72a68bac,0x41606aa6,0x9b8c30e0,0x08201820,0x62a749e6,0x72c8834b,0x8b6972a6,0x49818349,0x28c03122,0x100049a4,0x10001860,0x396228a0,0x520541a3,0x41834183,0x942d944e,0x72c58b8a,0xc4ef7224,0xddd2c46c,0xff39ff17,0xff9aff7a,0xff5aff19,0xff5bff5b,
-0x6aab5a6a,0x83f0736e,0x732d732e,0x4187730c,0x294628c4,0x18a33187,0x00211082,0x630c31a7,0x84106b6e,0x7b6d8410,0x41245a69,0x20c31841,0x29650020,0x294510a2,0x31c72104,0x5a495aab,0x41a75a49,0x00000800,0x00000000,0x422918e4,0x7bcf738e,0x41e97bef,0x5aab39c8,0x5aab62cc,0x49c85a6a,0x28623926,0x08001000,0x410351c6,0x392338c2,0x39453145,0x943049e8,0x9c929430,
-0x086183ce,0x21440881,0x31c66b8d,0x8c303a07,0x9430a4d3,0x941093af,0x9c319c51,0x28a25a29,0x416630e5,0x51e741c7,0x7b275a05,0x6a655a22,0x410451c4,0xd619cdb8,0x5a08624a,0x38c44946,0x30c330c3,0x394530e4,0x20833125,0x292528e4,0x18623144,0x72e81060,0x72e86aa7,0x7b296ac7,0x39206ac7,0x9c0c6265,0x9bec8b6a,0x83297b08,0x93aa8b6a,0x8b698b8a,0x938a9beb,0x8b898b48,
-0x9bcb93aa,0x93a9d5f3,0x93cb9368,0x62658328,0x30e06286,0x39403100,0x5a445a24,0x28c06285,0x5a2449c3,0x39203922,0x410230e0,0x93cd59a4,0x82ea8b6c,0x5a682860,0x52275a47,0x5a675226,0x6a666226,0x38e06a66,0x6a8872c7,0x93ed6247,0x93adac90,0xb5129c4f,0x180051a3,0x18601840,0x2860a490,0x82c67243,0x72e87ac7,0x18610800,0x10405205,0x30800800,0x59e28b4a,0x51a172c6,
-0x5a026a85,0x6a6451e1,0x62227285,0x62424960,0x51a04980,0x38c04140,0x39204140,0x6ac77b48,0x628528c0,0x28e049e2,0x30e05224,0x28804981,0xbc8f72e8,0x48a01000,0x72a88309,0x7b295a64,0xd615942e,0x5a25de77,0x30e05a03,0x20602880,0x30c030e0,0x39003920,0x080020c0,0x5a871020,0x28c049e4,0x5a038349,0xcd31ac8f,0xee54edf3,0xfef7f6b6,0xff7bff7a,0xff9cff7b,0xffbcff5b,
-0x83d06b2d,0x8c1183d0,0x7b6e8c30,0x2883626a,0x20a328a3,0x18a220c3,0x108218e3,0x630c31c7,0x8c72630c,0x7b4c83af,0x18206269,0x20c20820,0x108220c2,0x29663186,0x52ab18e4,0x5aaa5aab,0x31045228,0x00200000,0x00000000,0x00000000,0x632c10a2,0x736e7bef,0x5aab3987,0x6b0c6b0d,0x6aec62cb,0x628a5a6a,0x182151c7,0x62695a28,0x30e451e7,0x62cb2082,0x8c10732c,0x83cf8bf0,
-0x39c68c91,0x21242965,0x39e718e3,0x83ef18e3,0x9c318c31,0x9c519c31,0x8b6ea471,0x38e493af,0x41a54124,0x51c641a6,0x62447ae6,0x7b287285,0x49663922,0x7b0d6a8b,0x72ab7aed,0x59c88b4e,0x518750e5,0x39865a69,0x49e83966,0x39a63986,0x394528e5,0x522728e2,0x62655a23,0x6ac77b49,0x6ac76265,0x838949e1,0x8b6a9bcb,0x7ae88329,0x83498329,0x9bca8b69,0x8b699baa,0x93aa93ca,
-0xa42da40c,0x8ba993ea,0x8b8a9c0b,0x834a7ae7,0x3920834a,0x41815203,0x5a255a04,0x72e85a05,0x51c35a24,0x41404160,0x72a751a2,0x8b8dacd1,0x514193cd,0x6ac88b28,0x52055a25,0x7b086a67,0x93ea836a,0x83aa9c6c,0x83287b48,0x7a868307,0xbcb09b89,0x834ba42f,0x284069e2,0x31022081,0x7b0649e4,0x7a228b86,0x7a857263,0x41441840,0x08001840,0x59c21020,0x6a656224,0x51c14160,
-0x5a026265,0x6a6451e1,0x49806242,0x7b074960,0x51a04980,0x20404120,0x49a12880,0x10005a44,0x10003101,0x206028e0,0x41a21000,0x30e02040,0x18607aeb,0xbc494081,0x7ac6c531,0x518130e1,0x942f5a44,0xa4d0ad31,0x28c06aa5,0x520549c4,0x520428a0,0x498138e0,0x41625a05,0x28813942,0x10002080,0x41a37b8c,0xb4d08349,0xfeb7cd92,0xe655ee95,0xff9bff39,0xffdcffdc,0xff9cff7b,
-0x7b6e8bf0,0x94728c31,0x624a8c10,0x20c31862,0x29253105,0x18821062,0x10c310a2,0x39e80000,0x8431736e,0x5a697b8e,0x08004186,0x290320c2,0x18e30000,0x29455acb,0x5aec39c7,0x6b2c62ec,0x5208732c,0x08201000,0x00000000,0x00200020,0x08418410,0x83f0632c,0x7b8f7baf,0x736e736e,0x62ab6b0c,0x52495a6a,0x734d732c,0x5249628b,0x62cb5a8a,0x83cf62cb,0x8430734d,0x8410738e,
-0x29444207,0x298631a6,0x29652985,0x4a495b0c,0x94318c10,0x9410a4b3,0x8b6e9c51,0x72ab6a8a,0x49236a49,0x6a464984,0x62036a65,0x4a056a64,0x626a3984,0x9c728bd0,0x7b0d9411,0x8baf8b8f,0x83ae83ae,0x7b8e9430,0x416549c7,0x39a63924,0x29452905,0x080018c3,0x62875a85,0x6aa77b29,0x73088b8b,0x7b286286,0x7ae88b49,0x8b6a8349,0x83498329,0x8ba993aa,0x93eba44c,0x93aa8b89,
-0x9bca93ca,0x93ca8baa,0x940b8ba9,0x6aa67b28,0x49a23920,0x416251e3,0x62657308,0x51e36aa6,0x516159e3,0x49015121,0xb4b08b09,0xa3edb4b0,0xbcd04941,0x6a858327,0x9c0b72a6,0xd5d49c0c,0x83264961,0x83488b89,0xb50f8b89,0xc4abac8c,0xbc8bfe70,0xff786a63,0x6224fe92,0x38c02860,0x288072a7,0x8ac5d591,0x6a2182e3,0x62253080,0x18002860,0x59801000,0x6a646202,0x6a655a03,
-0x416072c6,0x62445201,0x412072a6,0x412030c0,0x41204981,0x38e259e4,0x51a33900,0x30e0836a,0x30e21800,0x31001821,0x28a02080,0x6203836a,0x30005162,0xe614aba7,0x3840c48c,0x308030c0,0x83aa0000,0x940c6ac7,0x6286a4f1,0x72e85a24,0x394049a2,0x390051e3,0x49a24162,0x28a03120,0x20801840,0xad337329,0xc5b4a4b0,0xf7bd9c70,0xd6fabe17,0xff5ce71b,0xffbdffbd,0xffbcffde,
-0x8c1183f0,0x8bf09410,0x180162ab,0x28e31800,0x20c33186,0x20c21061,0x21252103,0x000010c3,0x738e5aeb,0x526973ae,0x00001060,0x210320e2,0x21240860,0x18e42945,0x632d2987,0x7bef736e,0x7a8b9410,0x39852882,0x39863165,0x294439a6,0x526a5269,0x73af630c,0x8c317c10,0x7b6e8c10,0x732d7b6e,0x62cb628b,0x734d6b0c,0x5a6a6b0c,0x62ab62ab,0x6b0c734d,0x8c3062cb,0x4a287bae,
-0x18820800,0x29650000,0x10824208,0x10621082,0x94318c11,0xa4719c72,0x94109c10,0x9c317b4d,0x62a9a492,0x6a666a88,0x72a56a84,0x414351a1,0x7bae41a6,0x9c328bf0,0x8bd0acb4,0xa4729c31,0x93cfacb3,0x39243903,0x93ef4986,0x49e75a69,0x396641c7,0x18c32125,0x5ac50820,0x5a257329,0x5a254181,0x72c76265,0x7b0872c7,0x93cb7b29,0x93ea93ab,0x73058baa,0x8b8a8348,0x8b898348,
-0x8b8993ca,0x73278369,0x73286ae5,0x20806ae7,0x41413922,0x49813920,0x51e151c2,0x41404140,0x300048c0,0x938b7287,0xb490bcaf,0x3820c511,0x72207202,0xa42da389,0x6a846a83,0x2040d571,0x59e02000,0x72825180,0x7ac36200,0xb4ab7261,0xde31ff96,0x7ac3cd8e,0xa46c9c0a,0x6a0559a3,0xc55172a9,0x7ac5e5f1,0xb449ac4a,0x3060ddb3,0x08005180,0x620230a1,0x6a8472a6,0x6a855a21,
-0x5a024140,0x498151e1,0x414172c6,0x49a22020,0x61c36246,0x08003900,0x41615201,0x30a12820,0x20611800,0x20601820,0x28401000,0x726130a2,0x722038e1,0xdd6faccf,0xf693a3c8,0x62a5ff7a,0x944c3123,0x52435aa4,0x944f942e,0x730a5a24,0x5a0272e7,0x51c14981,0x49e25a24,0x30e14180,0x39202060,0x520630e0,0xc5d68bac,0xadb6f7bf,0x7c508cd2,0xdefb94b2,0xff5cef3c,0xff9dffbe,
-0x7b6e8c11,0x7b6e83af,0x52085229,0x29045a69,0x104120e3,0x188220c2,0x18e418e3,0x212410c3,0x5acb18e3,0x41e7632c,0x00001060,0x18c22924,0x4a691061,0x2105632c,0x52ac52ab,0xa4d3738e,0x61e8838e,0x29233924,0x31652924,0x18c32945,0x42292104,0x5aeb6b4d,0x9492632c,0x9410ad14,0x7b8e8c10,0x62ab6b0c,0x6b0c62ab,0x5a8a62cb,0x62cb5a8a,0x6b0c6b0c,0x62eb62aa,0x08210821,
-0x84100000,0x00000000,0x210410a2,0x39c831a6,0x83cf0000,0x941083af,0x8bcf836e,0x9c519c31,0x83ad9c30,0x93cd730a,0x7ac88b6a,0x51a551c4,0x836e38e4,0xacd48bf1,0xa472a473,0x94119411,0x8bcf9c51,0x490438a2,0xa4718b6d,0x41a69c71,0x314641a7,0x31662945,0x4a233163,0x7b4962a6,0x62866285,0x6aa66265,0x836a72e7,0x8b8a7b08,0x940bb4cf,0x8ba993ca,0x624493ea,0x83278348,
-0x93c98b68,0x626572e6,0x5a865224,0x18003962,0x62443901,0x49823920,0x49a051c1,0x69e430e0,0xa3ec8225,0xbcd0c511,0xac4ebcd0,0xb44e7a87,0x82a28b06,0xe6338b26,0x72846242,0x30001800,0x82836901,0x59c09387,0x7ac359c0,0x830282e3,0xcdae9bc9,0x7ae4b4ab,0x7b087ae6,0xd57261e4,0x284038c1,0xbccd6a63,0x7241b48c,0x7ae46220,0x6aa88307,0x59e12020,0x51a193aa,0x51c26201,
-0x51c16224,0x5a024140,0x390051c1,0x62045181,0x280030a0,0x28804120,0x20012040,0x20002880,0x18002040,0x28401800,0x28406a86,0x72213881,0xf6338ae6,0xfeb25a44,0x2080ff14,0x2080bd53,0x20801000,0x49e220a2,0x944faccf,0x62a57b49,0x9c0c7308,0x5a026223,0x49c14981,0x5a0449e1,0x39212080,0x39423941,0x52262080,0x0861bdd6,0x19030020,0xa53439e7,0xe6dbc638,0xff9dffbe,
-0x736e736e,0x734d6b0c,0x83cf836e,0x39665aca,0x10411000,0x20c23145,0x08211081,0x21040801,0x10a21082,0x31452965,0x00000800,0x000020e4,0x4a490841,0x088318e3,0x7bf16b4e,0xac929cb3,0x726a93af,0x290330c3,0x39862924,0x29442103,0x086220e3,0x5aeb31a7,0x6b8d6b6e,0x9cb28c51,0x7b8e9451,0x734d83af,0x6aec62cb,0x7b8e6aec,0x5a8a6aec,0x6aeb6b0c,0x00005a8a,0x4a49ad35,
-0x9cb30000,0x08009451,0x42284208,0x42094a49,0x104139a7,0x93cf8bf0,0x7b6d93cf,0x9c518bae,0x940f93f0,0x730a9450,0x59c37286,0x59e67286,0x830d48e4,0xb4f59431,0x94119c52,0x8bcf9411,0x9c729c92,0x836d72ca,0xa492ac92,0x3165838d,0x39a73986,0x20e53187,0x39822902,0x49e26ac6,0x6ac728a0,0x6aa76265,0x8b8a72c7,0x7b0772c7,0x836993a9,0x93cb8369,0x6aa47b47,0x8b688347,
-0x7b078b68,0x62867b06,0x28e05206,0x310120c0,0x30c02060,0x518249a2,0x49605161,0x9c4e7a64,0xc4f28bab,0xbcd0b4af,0xb42dbcaf,0x9bab9308,0xabed9bcb,0x38c0b48f,0x38c32000,0xe54dc425,0xfe54f651,0x6220a447,0x62006220,0x51a082e3,0x6a407282,0xa46b8366,0x93cd7285,0x51a330a0,0x516138a0,0x72e67ae6,0x9b87ac8d,0x9ba8a40b,0x72657aa4,0x59e06a45,0x49804140,0x49604920,
-0x51c14981,0x72a74160,0x938b6a87,0x7a257a87,0xa3ed938a,0x6a049b6c,0x28404920,0x5a0438c2,0x28603080,0x40e138e1,0x30c051a3,0xab855960,0xcd6fffda,0xbd10b48c,0x30a0ce13,0x10200800,0x31001000,0x5a653961,0x942d83aa,0x942e4204,0x30e08baa,0x6a846a85,0x5a227284,0x418049a0,0x30e06266,0x416249c3,0x41823100,0x00001880,0x00000000,0x10c32985,0xce181925,0xffbeef1b,
-0x6b0c736e,0x62ec6b2d,0x738e630c,0x4a086b2c,0x10401041,0x20a220e3,0x18a21082,0x20e30820,0x18c20000,0x210318a2,0x00002104,0x20e40000,0x18e42125,0x73af2947,0x947283f0,0x9c10b555,0x51c77b2d,0x30e428a3,0x292420e3,0x20e33144,0x21252104,0x39e84249,0x738e5aec,0x8c5183ef,0x83cf83f0,0x6b0c7b8e,0x732c7b8e,0x7b8e7b6d,0x734d7b8e,0x732c7b6d,0x5249732c,0x39a63145,
-0x18a3526a,0x39863986,0x4a0839a6,0x41e84a29,0x30e441c7,0x943093f0,0x834cacd3,0x9c708bae,0x20e2840e,0x18006aeb,0x5a057287,0x49c66ac9,0x392549a6,0x93cf6aab,0x830b5a08,0x28e25a28,0x9c716ac9,0x9c30a471,0xa492acd4,0x5a285a27,0x49e849a7,0x31464208,0x210318c3,0x62863983,0x6a6651e3,0x5a456ac7,0x62856ac6,0x72a67b28,0x7b288b8a,0x83898348,0x73057b26,0x8b687b07,
-0x73067b07,0x52235a45,0x28e030e1,0x72a83921,0x59a38309,0x6a4359c4,0xbccdc510,0xacb0ac8e,0xb490c512,0xc511c4f1,0xbcb0cd52,0xb48fb46f,0xb4b0c4f1,0x8b88b48f,0xfeb261e5,0xcca9e58d,0x2000cd2c,0xac2bfed3,0x492072c2,0x8b6661e0,0x8b269386,0x9bcb6a61,0x7ae872c7,0x51826224,0x30a0c552,0x7ae793ed,0x72c54980,0x93e993e8,0x72e78b48,0x7b28832a,0x8b497ac6,0x8b6ab4cf,
-0x6a8659a4,0x080051e4,0xb48eb4ae,0x9bcc8b6a,0x6a26ac6e,0x9ae782a7,0x71e4d50f,0x51c350e1,0x7ae84120,0x282072c5,0xabea9368,0xff98e5d0,0xa40bcd91,0x7b88acad,0x9c4e4a03,0x00001040,0xce370000,0x8c0d5ac9,0x52863982,0x00001081,0x83898bec,0xac6d72c6,0x83498b6a,0x39606aa5,0x522272e8,0x20803940,0x39413940,0x18803962,0x00200000,0x00000000,0xa5130020,0xff7de6fa,
-0x630c73ae,0x5aec5b0c,0x736e630c,0x398662ec,0x20c22925,0x20a20000,0x00000000,0x10610000,0x39a60020,0x31852103,0x0821630c,0x5aec18e4,0x4a6a39c8,0x7bd05acc,0xa4f48c72,0x838ead14,0x6acb72ec,0x20424186,0x20c320e3,0x18a32904,0x39a739e9,0x41c84a29,0x62ec526a,0x7bcf736d,0x7b8e83f0,0x732c7b8e,0x734d7b6d,0x734d6b0c,0x6aeb7b6d,0x7b6d62cb,0x5249734d,0x524949e8,
-0x4a284a28,0x31664a08,0x7b8e4a08,0x52086b0c,0x7b2d49a7,0x9c518baf,0xb513b513,0x9490b554,0x5aa95ac9,0x94303123,0x942f834a,0x83ae944f,0x730b49c6,0xa4917b2c,0x4964b4f3,0x41635a27,0x52071000,0x9430ad13,0xacf3b535,0x730a7bad,0x39643964,0x29465ac9,0x41e72924,0x520362c9,0x624549a1,0x5a4572e8,0x6ac75a44,0x72c66285,0x5a247b69,0x6ac56264,0x7b287307,0x83698389,
-0x6a848b89,0x52035224,0x51c41820,0x28402020,0xd50c69c0,0x620069e0,0x8b68b46c,0x9c4eac6e,0xb4f1acb0,0xc533b4d1,0xbcb0c532,0xac4ebcaf,0xac6fa3ec,0xa42bac8e,0xa4099388,0xd5cfbd0c,0x28c0c56f,0x8348b50c,0x59c05180,0x8b657282,0x72829368,0x6a627ac4,0x72857ae6,0x204059c3,0x6a046a05,0x7ac77aa8,0x7b494181,0x5a4562a8,0x72856a86,0x72856a62,0x83287ae7,0x7b087b06,
-0x5a056a46,0x7b296aa7,0x9beb3920,0xff1aa42c,0xac4e38c0,0x8ac6b44d,0xddb2feb5,0x8265d592,0x38a038a1,0xa3eb7aa6,0xbc4df655,0xc4ee7a83,0xc50dff38,0x10005a00,0x10201020,0x00000000,0x08000000,0x7b4a0000,0x082039a5,0x08800840,0x9c709490,0x83086ae7,0x59e051a1,0x394072e7,0x6ac76aa7,0x5a456aa8,0x93ed49c2,0x5a885266,0x00000000,0x31852103,0x10401861,0xeeda3985,
-0x632d738e,0x39e86b4d,0x5acb4a49,0x39864a29,0x18823145,0x10001882,0x00201041,0x08200000,0x21030000,0x39c72945,0x00210000,0x6b6e52cb,0x8c118c52,0x841083f0,0xacf49c93,0x7b6e83af,0x62cb62cb,0x28a349c7,0x290330a3,0x31862945,0x5aaa528a,0x62ec62ec,0x5acb5249,0x6b4d6b4d,0x6b2c7bae,0x734d734d,0x7b6d7b6d,0x6b0c62cb,0x5a8a62aa,0x62cb5a8a,0xa4d35aaa,0x4a294a29,
-0x5acb5249,0x4a295249,0x947283f0,0x9c728c51,0x93f09431,0xacd2ac93,0xacd2a492,0x5ae99cb1,0x39a43184,0x20a130e3,0x9450838d,0x8bef8c50,0x940f838e,0xa49183ad,0xa450acd2,0x4a27a491,0x10001000,0xa4b2628a,0x9c91ad14,0x8c0f83cd,0x41e75205,0x83cf6aeb,0x31652924,0x838c3145,0x51a25a04,0x6245834a,0x5a656ae7,0x72e67b49,0x62856264,0x73076265,0x8bca83a9,0x93aa7ae7,
-0x30e06ac4,0x392028c0,0x18001840,0x93a92000,0xfed4c4ee,0x8b65c50d,0xac0cac2b,0x83a9bd0f,0x6a66cdd4,0xc552a450,0xbcf0bd31,0xbcd0b4af,0x9c0bac6e,0x6a24b4cf,0xac688b46,0x42038ba5,0x10200800,0x59a12000,0x82e45161,0x61e09387,0x8b487a83,0x82e68b27,0x83076a61,0x9c0a7ae6,0x8b68bd31,0x72867265,0x6ae96a88,0x5a466287,0x6a646aa6,0x7ac572c5,0x7b288328,0x83298307,
-0x7aa98b4a,0x18404123,0xb4ae1000,0x83267aa5,0x5a039349,0xf695a369,0xc48ddd6f,0xbc4cf656,0x82e57265,0x514248e0,0xc50fddd2,0xbc8ccd71,0x832659c1,0x00007263,0x08000000,0x00000000,0x20c20821,0x00004a47,0x00000000,0x00000840,0x62ea0000,0x73280000,0x6aa47b07,0x41605a22,0x7b4a72c7,0x41a262c8,0x520549c3,0x6b093962,0x000039c6,0x10402903,0x39631040,0xad133984,
-0x632d18c3,0x29456b4d,0x4a290820,0x290441c7,0x20c31882,0x08200800,0x00000000,0x00000000,0x29240000,0x18e30000,0x422a0822,0x945283d0,0xa4d4acf5,0x7b4e83f0,0x8bf0a4b3,0x732d7b8e,0x62ab6aec,0x396562cb,0x39662863,0x526a5269,0x4a495acb,0x62ec5aaa,0x5acb5249,0x734d62eb,0x5aaa62eb,0x734d732c,0x6aeb734d,0x62aa62cb,0x52695a8a,0x31455249,0x41e73145,0x4a294a08,
-0x83ef3145,0x41e74a08,0x94923165,0x9cd383ef,0x9c51a4f3,0xad13ad14,0x94b19cb1,0x49e69cb1,0x10202902,0x8bee30a2,0x8c0f83ad,0x83ae736c,0x7b4b1000,0xacd28bcd,0xb4b1a470,0x9c4fb4d2,0x28a05a47,0x732c1000,0x840ea4f2,0x83ec4a46,0x31035a27,0x080049a5,0x39053925,0x51e64165,0x51e56aea,0x626451e3,0x730841a2,0x49c16ac7,0x4a036aa7,0x6ac65a65,0x28c049e3,0x51a04140,
-0x20204160,0x59c25180,0x492159c1,0x83062040,0xbd0dbcab,0x9be9c54e,0x7b2593ca,0x7b6ab4ef,0x72e849c4,0xa42fa46e,0xb4b0c533,0xac6fbcd1,0x38a09c0c,0x51a030c0,0x5180ac6b,0x00011840,0x10a10820,0x61c040c0,0x9b8861e0,0x8b678b67,0x7ae58327,0x7ae48b26,0x7a827a81,0x2840ac4b,0x49606a25,0x8b48a40a,0x6ac86a87,0x52255205,0x72856266,0x83077ae7,0x8b697aa6,0x39403940,
-0x7b2a93ec,0x18615a06,0x82e659c2,0xac2b7ae8,0x72439349,0x92a28b08,0xff16abe9,0x8b2748c0,0x1000c4ce,0x6a012040,0xacceacef,0x8c0ad653,0x7b87a4ef,0x08006264,0x102020c0,0x00000800,0x62ca0000,0x00001061,0x00004a27,0x00200000,0x7b8c630b,0x31630020,0xad110000,0x8bcbacb0,0x49e249c1,0x526562a6,0x6b28944e,0x20e20000,0x9cf36b2c,0x00000000,0x31640000,0x28c130e1,
-0x31860000,0x52aa4a69,0x00000861,0x41c70800,0x20e32904,0x00000000,0x00000000,0x00000000,0x296539c7,0x19050042,0x738f528b,0x94528c11,0x734e9472,0x83f0734e,0x72ec7b8e,0x6b0c5a49,0x62cb6b0c,0x5a6a62ab,0x52293105,0x4a082904,0x41e762ec,0x49c841a7,0x52894a29,0x6b0b62cb,0x41c662eb,0x734d732c,0x62cb732c,0x5a8a732c,0x5a8a5228,0x4a495a8a,0x31c739a7,0x4a494229,
-0x732c49c7,0x422883af,0x00004a69,0x8c5183ef,0x736d9492,0x9c919491,0x7bab8c0f,0x08003162,0x30601880,0x8bce6a69,0x7b8c83ad,0xa4d26b0a,0x6a892923,0x39218b8c,0x8b2c7b09,0x7b0a1800,0x52078bce,0x00004184,0x20e15269,0x5a663962,0x7b4c6269,0x28216aaa,0x61e87acc,0x30a27aec,0x62678b2a,0x3920834b,0x6ac549e1,0x312051e2,0x39603940,0x41c34183,0x416028e0,0x626251e1,
-0x4960b4ae,0x82e77ac6,0xbccf82c8,0x8b697ae7,0xaccd93c7,0x9be99c4c,0x83488b88,0x416249c3,0x73084981,0x93ac61c3,0xacb0bcf2,0xbcf1b4f1,0xa4ad93ac,0x9bcbbd50,0xd5707265,0x00001000,0x18200001,0x69e082a2,0x92e58282,0xa42b9369,0x7aa39b89,0x6a417ac3,0x9bc96a20,0x7262a3c7,0x38607aa1,0xa44ac52d,0x72887ac6,0x51216288,0x7aa5830a,0x7a818346,0x6a42ab45,0x310049c0,
-0x5a275226,0x18204120,0xcdd293ec,0xee54c58f,0x7a44938b,0xc4cdbccf,0xccacb449,0xbc6cd4ec,0xee99d5f5,0x49a15203,0x6ae328c0,0x49e20800,0x0800e718,0x18206ac7,0x31021000,0x08200800,0x00000000,0x00000000,0x00000000,0x00000000,0x41e7630c,0x00000000,0x31626b29,0x83cc7bab,0x526583cb,0x7bcc5265,0x08200000,0x4a290000,0x00002104,0x00000000,0x00000000,0x414220a0,
-0x00000020,0x08612124,0x00000000,0x52691881,0x31855a89,0x00000000,0x18e30000,0x00000000,0x00000000,0x73af18e4,0x84118431,0x83d07baf,0x41c87b8f,0x7baf7b6e,0x72ec7baf,0x4a0828a3,0x62cb5a8a,0x6aec6aec,0x52495a29,0x5a8a2925,0x62eb62cb,0x28c45a8a,0x4a285249,0x62eb6b0b,0x41c762cb,0x734d62aa,0x6aeb6b0c,0x524962cb,0x5aab62cb,0x4a29526a,0x4a094a29,0x51e95209,
-0x49865208,0xa4f249c6,0x42284207,0x52690000,0x000020e4,0x62eb4a48,0x29210000,0x20a01880,0x72aa30e1,0x8c2f9c2f,0x08205aa8,0x7b6c1020,0x7b6c0820,0x18005a67,0x6a262860,0x49836a47,0x62064964,0x52074143,0x52670000,0x18801860,0x72ca1800,0x8baf51e7,0x8b8f9bf0,0x836d93cf,0x5a675a06,0x52254184,0x62a76ac6,0x292139a5,0x31223141,0x31220800,0x5a042060,0xbd136a87,
-0x61e172e4,0x7ac68b27,0x72a682e7,0x6aa56a85,0x838c8bab,0x73057b28,0x62479c2c,0x30c24944,0x622751a3,0xb4b1bcd1,0xa44fc573,0xacd1ac90,0x93cb93ed,0x72a172a5,0x6a426a61,0x28604981,0x51e21000,0x9b668283,0xfed4a3a8,0x9bcacd50,0x9b678305,0x5140b42a,0xd5918b25,0xb48ba3c7,0x3860b48c,0xac6bbd0d,0x72c593c8,0x82457286,0xa362bb24,0x2000a42b,0xfe51f653,0x10003922,
-0x100020a0,0x20002841,0x5a848b8b,0xff3893e8,0x7ac8e636,0xc50feeb8,0xee94e633,0xf6d7b530,0x38a06a22,0x284061a2,0x310061e0,0x20c128a3,0x20a10800,0x080028e1,0x28c028c1,0x00000800,0x08000800,0x00000000,0x00000000,0x00000000,0x00000841,0x00000000,0x000020c3,0x00000000,0x00000000,0x00006b4d,0x5aaa20e3,0x00005aaa,0x00003165,0x18e331a6,0x08000000,0x41024163,
-0x00200841,0x00000000,0x00200000,0x4a085269,0x18c20000,0x000018a2,0x00000000,0x000039c7,0x00000000,0x6b6e52ab,0x73af7bf0,0x6b2d8c11,0x4a09734d,0x83cf838f,0x626a7b8e,0x5a8a28a3,0x5aab62ec,0x62cb732d,0x28e441a7,0x62ec41e8,0x732d62cb,0x394641e8,0x52895229,0x5a8a5aaa,0x5aaa6b0c,0x7b8e732c,0x6b0c6b0c,0x5a6962aa,0x5aab5a8a,0x39a75249,0x49c84208,0x9bb07b0e,
-0x38c451c8,0x000051c6,0x10610020,0x082039a6,0x00003165,0x00000000,0x08000000,0x31423142,0xac936267,0x9cd1a491,0x0800a4b1,0x52485227,0x8bce2903,0x834a8bcd,0x6a453040,0x5a2482eb,0x832a4102,0x00005184,0x104062ea,0x9c913121,0x6a69830c,0x7b4d6a49,0xa4719410,0xc574b4f3,0x1020940f,0x52260800,0x18a072e7,0x00000001,0x10000001,0x10201860,0x286028a1,0x10000800,
-0xc4ee6246,0x8306a409,0x72c782e6,0x6aa772a5,0x520449a3,0x7b0b6267,0x41a17b0a,0x51834101,0x72485183,0xcdb4c535,0xac91b531,0x9c309c0f,0x7ae89c6f,0x7ae36a63,0xddb293a7,0x6a204960,0x72a5bcef,0xabe97201,0xd52edd4f,0x9beabd0f,0xcd0b8b45,0x7a609324,0x93a66a20,0x72809363,0x2800c4ec,0x93a76a43,0x51a072c2,0x9c46bc8d,0xfef1ff96,0x59c0d571,0xee536a84,0x20603100,
-0x20601000,0x38c21800,0x10202860,0x93cb30c0,0x834aac6f,0xa44d83ad,0x7b885205,0x6a431040,0x93c8a449,0x30a0ff7c,0x6ae41820,0x00000800,0x10413162,0x10400800,0x18203102,0x00001881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x52aa4207,0x000010a1,0x00000020,0x08600860,0x08200000,0x39a72103,0x00006b2d,0x08000820,0x00200000,0x28c10800,0x72474984,
-0x08610000,0x00000000,0x526910a2,0x000039a7,0x00000000,0x00000000,0x00000000,0x00000000,0x42294a8a,0x6b6e4249,0x630c6b4d,0x4a28734d,0x5a6a41e8,0x28c26acb,0x49a649e6,0x6aec3103,0x6aec6aec,0x626a6acb,0x28e430e4,0x62cb4a28,0x732d62ec,0x628a62ab,0x62cb62cb,0x5aaa5269,0x7bae6b0c,0x7b6d62cb,0x6b0c7b6d,0x5a6a5a6a,0x526a4a49,0x4a495269,0x5a094a28,0xbd359c10,
-0xb4b2ac92,0x520893ae,0x00004a28,0x39c62924,0x18820000,0x39863145,0x31021861,0x41a43122,0x9cd283ce,0x9cb29c91,0x39c59cd1,0x20a139c5,0x38c26289,0x8b4c5144,0x6a676a48,0x730a9c0e,0x8b8d5a07,0x5a06acd1,0x41854944,0x7b6d0000,0x8bcf83ce,0xa4b2a491,0xb513a471,0xc595c575,0x83cdad33,0x52260000,0x5a67b532,0x41c54164,0x00000840,0x00000800,0x10020000,0x182030e1,
-0xd5b293aa,0xb48ebcf0,0x51408ae8,0x496059e2,0x624649a2,0x62036265,0x51c24981,0x8b6a59e3,0xb4d18309,0xb4d1c533,0xa491acd1,0xa470a450,0x7ae78bed,0x72a56a85,0x51c38ba9,0xc5913920,0x5a23942c,0xd5729369,0xd56fcd4e,0x7b068326,0xe5d08b05,0xff9a5980,0xa3e78304,0x7aa19be7,0x38a0cd8d,0x94091800,0x8b6582c3,0xcd0ecd70,0xff78cd4c,0x50807260,0x30c0d5ac,0x39429c4c,
-0x20401000,0x41214980,0x20002020,0x836b59e3,0x5a875a46,0x5265ad11,0x5a22838a,0x30c06ac5,0x282038e1,0x28402000,0x72a63860,0x18605a24,0x08400000,0x10401061,0x08200820,0x00001061,0x00000000,0x00000000,0x00000000,0x31650000,0x00002945,0x00000000,0x08410000,0x00000841,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x18a10020,0x93ad49c6,
-0x00000000,0x4a691082,0x08205aca,0x00000000,0x00000000,0x00000000,0x00000000,0x00410000,0x4a694249,0x632d4229,0x630c526a,0x7baf7b6e,0x62ca8c31,0x62073903,0x28c12020,0x62ab20a1,0x62cb734d,0x5a4a626a,0x28c338e4,0x6b0c3145,0x7b6e6b2d,0x6aab734d,0x4a085a8a,0x5a8941e7,0x7b8e6b0c,0x83cf7b8e,0x6aeb734d,0x4a085249,0x41e84a29,0x39c741e7,0x9c110000,0xc555a451,
-0xacd3acb2,0x5228acb2,0x314583ef,0x08200000,0x20c21081,0x41c741e7,0x52084165,0x418651e7,0x31c62943,0x10820841,0x5a8939c6,0x41853164,0x49a541a6,0x834c51a5,0x7b0a9c0f,0xa4b27b2b,0x8b6da4f2,0x7a89a450,0x93ad5165,0x7b6d3124,0x8befa4d2,0x83ae9c30,0x83cea4d2,0xad13a4f3,0x83adacf3,0x7b6b41c5,0x52061880,0x29032081,0x10610000,0x7bee3985,0x10401880,0x9c2e7309,
-0xad108bcc,0x82c46a24,0x720161c0,0x59e16202,0x622659e3,0x62856245,0x7b284181,0x30e09c0c,0xbd127267,0xa490b4d1,0x940f9c6f,0x838d72eb,0x62247b4b,0x520372e6,0x62666265,0x62a7c5d4,0x5a2562c7,0x8b6b8369,0xac2ea40b,0x7aa57a86,0xbd0c7ae4,0x61e059c0,0x7aa2ac29,0x6a208b46,0x8326accb,0xd6131800,0x7aa27aa4,0x7ac34960,0xc4c7ac06,0xf60de5ad,0x3920abeb,0x28a128e0,
-0x20403942,0x72c638e0,0x38802840,0x51c11820,0x080030e0,0x62883940,0x6245838c,0x39006263,0x52011820,0x414072e6,0x9c0dd4ef,0x20602020,0x10001000,0x00004a07,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x000020e3,0x00000000,0x00000000,0x00000000,0x10620000,0x000018a2,0x00000000,0x00000000,0x00000000,0x00000882,0xbdb54a49,
-0x52693165,0x18a24a28,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00210000,0x31c710a3,0x4a4939e8,0x39860000,0x6b2c6b0c,0x62ca738e,0x41226289,0x62a82860,0x62ec30e2,0x72ec732d,0x51c7626a,0x28c330c3,0x62eb4a28,0x732c6b2c,0x52285228,0x39665a49,0x528a41c7,0x736e6b2d,0x62cb7b6e,0x5a8a732d,0x4a085249,0x6b4d4a08,0x41e9528a,0x836e0000,0xb4d3b4b3,
-0xa450b4d3,0x20a2bd34,0x5a8a4a29,0x31664a08,0x39863166,0x49463946,0x7aebac72,0x42074165,0x31c631a6,0x4a494208,0x4a4939c7,0x41a741e8,0xacb27b2c,0xbd346269,0xacb1b513,0x5a8720a0,0x838d8bee,0xac90acb0,0x836b7287,0x4a4841e6,0x94529cf3,0xa490a4b2,0x9c703944,0x08007b2b,0x29015227,0x5226730b,0x62c93983,0x732c28e2,0x7bce4a68,0x318439e6,0x082041e6,0x6b0a4a06,
-0x5a665a67,0x7ac67286,0xcccc9bea,0xbccdc4ab,0x8b899c0b,0x9c4d8348,0x93aa8b8c,0x62464942,0xb4d14101,0xbcf2bcf2,0xa470ac70,0x8bac838c,0x93a82820,0x59e38347,0x5a876266,0x52065227,0x5a2662a9,0x51c56268,0x61a37aa8,0x7ae78328,0x7ac26222,0xc50eb4ab,0x69e09384,0x72619345,0xa48e6a22,0x498130a0,0x51a08b67,0x61c059c0,0xbcaba3c8,0xfed2e5ed,0x5243de30,0x10003943,
-0x080028a0,0x20004921,0x620482a6,0x28a05a25,0x39003900,0x10001800,0x20a01840,0x52022060,0xd6342920,0x51a4accf,0x4140ff59,0x10002801,0x10402080,0x18811060,0x00000000,0x00000000,0x10610820,0x00001061,0x00000000,0x00000000,0x528a0000,0x20e31061,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18e22122,
-0x10814a28,0x00000820,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08820000,0x00214229,0x21040000,0x738e62ec,0x41646b4d,0x41423922,0x206030e1,0x5a8a1800,0x7b2d7b6e,0x49a76acb,0x49c64124,0x734c4a28,0x6b0c6b2c,0x6aab6aeb,0x5a6a5a69,0x4a693986,0x736d6b0c,0x7b6e732d,0x5a8a5a8a,0x39a74a08,0x4a494a08,0x398741e8,0x6aaa51c7,0xbd14b4b2,
-0xbcf3acb2,0x6aebc575,0x28e42904,0x28e43145,0x310428e4,0x72ec4166,0x9c119c52,0x29858bf0,0x39e731a6,0x39c739c7,0x4a084208,0x396641e7,0x51a65a48,0xb5139450,0x5a687b6c,0x30c241a5,0x62891860,0xacb1a491,0x626793cc,0x00001881,0x9c920840,0xb533b513,0x7b2b8bcd,0xce166aea,0x18600800,0x6ae91840,0x83ad41e5,0x10201881,0x00001081,0x39e739a6,0x42284207,0x314449e7,
-0x418339a4,0xac6f7b07,0xee32e652,0xd591ee31,0x7286ac8e,0x72c87286,0x72456a44,0x61e46a24,0xa44e938b,0xac8fac8f,0x9bcc9c0d,0x202038c0,0x61e0edcf,0x82c7a3e9,0x5a477286,0x49e65206,0x5a475227,0x6a475a06,0x9b8b6205,0xa44fac70,0x6a62a46d,0x6a616a81,0xa3866a00,0x8ae5a3a9,0x72427262,0x30c06a65,0xac6c6244,0x6a426200,0x7a679369,0xef149c09,0x08008bca,0x18201841,
-0x18202040,0x40802800,0x40c0c3ea,0x180072a8,0x20005180,0x20202000,0x206151c5,0x5a241820,0x62655203,0x49c349c4,0x6a446225,0x30a02001,0x000061a2,0x00000000,0x00000000,0x00000000,0x18c3528a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0x082018a2,0x08400800,0x00000800,0x00000000,0x00000000,0x39851061,0x10604a06,
-0x00000840,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x31a60000,0x108239c7,0x31860862,0x210439c7,0x39a60000,0x52895aaa,0x31025a89,0x288028a0,0x30e12040,0x39c71820,0x7b4d734d,0x51c76aab,0x20c24144,0x6b4d528a,0x732d738e,0x5a6a6aec,0x628b62ab,0x41a828e4,0x738e6b4d,0x6aec7b8e,0x524962ab,0x39a739c7,0x31662905,0x31662925,0xb4f38bce,0xbd54c596,
-0x3903bd13,0x9c919430,0x29041041,0x31873965,0x41863187,0x93f08baf,0xbd74a472,0x31a6736d,0x39e739c7,0x39c739a6,0x42084208,0x626a4208,0x5a284924,0x5a898bee,0x41c541a5,0x51e63964,0x18815207,0xacf19c50,0x838bb512,0x00207c31,0x5a8b0000,0x8bce9cb2,0x49c472ea,0x398418a0,0x00009cb2,0x7b4c6aea,0x83ed4a26,0x738d8c0f,0x39c54a48,0x00000000,0x20e30000,0x41c749e7,
-0x5a27734b,0x9bcc6a67,0xbcf1c530,0xbc8c8b05,0x938b8b26,0x72a58308,0x7a864940,0x6a027264,0xb4af9369,0x9349b4f1,0xa40c8ae6,0xc50ef6d4,0xe673ff56,0xb44d8b67,0x82c7ac0c,0x52275a27,0x61e75a27,0x82aa61a6,0xb4907a89,0xa44eac70,0x3860a3eb,0x830472a0,0x93667aa2,0xcd30d571,0x8ae69ba9,0x40c01000,0x8307ddd4,0x93ec8b48,0xb4f0bd10,0x28e059c4,0x08003984,0x10000800,
-0x61e42840,0x61403840,0xcce9a302,0x59e13020,0x59e54120,0x41422020,0x28414142,0x20204963,0x180028a1,0x18001800,0x38e02040,0xde1449a2,0x0841ff5a,0x00000000,0x00000000,0x29650000,0x00000000,0x00000000,0x08200800,0x28830800,0x08201000,0x00001020,0x00000000,0x00000000,0x08200800,0x08000000,0x184028e2,0x08000800,0x28c120a1,0x18400800,0x102028c1,0x29212901,
-0x08000000,0x08000800,0x08000000,0x00000000,0x00000000,0x00000000,0x08410000,0x39a731a6,0x42084a49,0x18c34208,0x42080000,0x62ca5a89,0x31025248,0x10003921,0x28a228c1,0x6aec5a89,0x832d7b2d,0x626a7b4d,0x28c32883,0x6b2c5aab,0x62cb630c,0x4a0862cb,0x4a0962cb,0x39663946,0x736e736d,0x6acb7b6e,0x5a495a8a,0x20e439c7,0x41a73187,0x526a41c8,0xacd29c71,0xde38bd54,
-0xb4f3e69a,0x4a07a491,0x49e72904,0x41c75a69,0x520941a7,0x941193f0,0xc5b6c576,0x31663145,0x31863986,0x41e749e8,0x41c73966,0x520841e7,0x8bee72ca,0x5a895248,0x49c641c6,0x498551e7,0x5a6851c6,0xacd14165,0x8bcc944e,0x420873ef,0x00000841,0xde5841c6,0x5a879c4f,0x20e13984,0x10802102,0x52683143,0x52681080,0x4a271881,0x00204a48,0x4a4918c3,0x00002924,0x39860000,
-0x730a4a06,0x9bec93cc,0x830772c6,0xac4a9367,0x7ac6ac2a,0x8b499bea,0x72236222,0x82839b69,0x9bcb8b07,0xac4ebcf1,0x9329936b,0x61a07a64,0x61e27ac5,0xb4ae9b8a,0xb48dac6d,0x72489388,0xa3cf6a08,0xa3efb451,0xa42fbcb2,0xb4b0a40e,0x59a2a3cc,0x62007262,0x9bc99367,0x30609389,0xc48d2000,0x8ae92800,0x7245f77c,0xac6f7266,0x9c2eb4d0,0x10209bcd,0x18201000,0x18002040,
-0x30203081,0xa3415960,0xb3a1fe0e,0x49409284,0x72a64120,0x10007b09,0x10001800,0x20402860,0x20002000,0x28803080,0x30e01800,0xe6767b69,0x0000d657,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000800,0x00010000,0x5a052081,0x18605206,0x00000000,0x08000000,0x62881000,0x28e20000,0x28c12080,0x10201000,0x18403103,0x28e21860,0x28e11860,0x20c03162,
-0x08000000,0x00000000,0x10000800,0x00000820,0x00000000,0x00000000,0x00000000,0x4a282124,0x6b2c630c,0x4a284a49,0x296452a9,0x52683185,0x5247630b,0x18203144,0x526a1000,0x7b2d83af,0x838f836e,0x51c8836e,0x20c430e4,0x5acb39e8,0x5aeb52a9,0x522962cb,0x4a095a6a,0x41c839a7,0x6b4d630d,0x62cb62cb,0x5229732d,0x4a2939c7,0x39c7526a,0x31863987,0xbd959cb2,0xcdb7c5b6,
-0xbd75d659,0x5a8aad34,0x7bcf8450,0x4185b575,0x93b00800,0x9c529bf1,0x93cda4b2,0x41c649c6,0x51e749a7,0x83ae72eb,0x396541c7,0x732b4a08,0x6b0a83ad,0x526862c9,0x5a0749c6,0x72aa4985,0x49e572ea,0x9cb13104,0x7bcd946f,0x10821903,0x39c618c3,0x18200841,0xd6d88c0e,0x418420c0,0x00000000,0x0000ad12,0x00000000,0x18a20000,0x00000000,0x000039e7,0x29653186,0x10202903,
-0x51e60800,0xa42b8b8a,0x6a236201,0xa42ca3ed,0x9c0bbd0e,0x83086a86,0x93a99bcb,0xa3859324,0xab82ab65,0xc4f3bc6b,0xb46fc552,0x82a58b26,0x62047a64,0x7aa66a45,0xb44dac2d,0x7a66ac6e,0xb450ac2f,0xcd13bcb1,0xa40ec512,0x942ea40e,0x49409bea,0x6220a409,0x62046200,0x93041000,0xcd0d8260,0x8ae8c4ae,0x72877266,0xb4b0a42e,0xbd11bcf1,0x1000b4b0,0x10001801,0x20001800,
-0x59c128c0,0xffbdf652,0xdca7d4c7,0x9b48aba1,0x410059e1,0x92237203,0x41822840,0x410138e0,0x20201800,0x40c02020,0x8b0a3860,0x49e58bac,0x00000000,0x00000000,0x08610000,0x00200000,0x00200020,0x00000000,0x20621020,0x30e21840,0x6b0b8bce,0x51a36227,0x00001000,0x39221820,0x396449c6,0x20803944,0x49a61840,0x20a01820,0x39443102,0x28e22081,0x206030e1,0x28e128c1,
-0x18800000,0x00000000,0x08001000,0x20a12080,0x00000000,0x00000000,0x00000000,0x31650000,0x62eb528a,0x10825acb,0x00200000,0x4a480000,0x6b0b840f,0x5a893984,0x8c1062cb,0x7b2d8bd0,0x838f7b4d,0x41667b4d,0x28e42062,0x210418c4,0x5acb4a48,0x522962cb,0x5a8b5a6a,0x4a2949e8,0x738e6b2d,0x62cb7b8e,0x52296aec,0x39a741e8,0x39a741e8,0x42084208,0xad34ad54,0xa4b2acf3,
-0xa4d3c5d7,0x9cb2ad13,0x62ca83ef,0x20612081,0x93f07b4d,0x7bae838e,0x51e66aeb,0x94306268,0x94308bcf,0x9450acb2,0x49e741a6,0x8bef5a69,0x7b4b83ad,0x5a48734b,0x51a54185,0x93ad6248,0x5a47940e,0x7bad1020,0x62ea62c9,0x00200040,0x39a6528a,0x7b8d6b2c,0x736b6b0a,0x3122730a,0x52073964,0x18810800,0x00000000,0x00000000,0x08000000,0x08003165,0x316520c3,0x49c63965,
-0x18001020,0x28807b29,0x49607284,0xcd2ed570,0x940d8ae6,0x10004982,0x200040e0,0xfef59b62,0x9b63ccec,0x9328b44a,0xac4ebc8e,0x9c0b9c0c,0x9bcbb4cf,0x7286ac4d,0x936a8308,0x7246ac2d,0xc4f1bc90,0xa3edc4f1,0xb4b1b4b0,0x3840a42f,0xd5b07ae7,0x8b66a40a,0x6a617ac3,0xcd4e8b25,0xee74ffb8,0xa3ec7266,0xac6fac8f,0xa42eb490,0xb4b0bcf1,0x93ccac6f,0x08001000,0x20001800,
-0x59603060,0xd5068ac2,0xe5acfdcb,0xee53edf0,0x204051c2,0xffbaff79,0xac2ccc8c,0x412272c8,0x28402840,0x40e14102,0x28602000,0xb4f17ac7,0x00000000,0x08610000,0x00000000,0x20a31041,0x10002082,0x39450800,0x28a21820,0x41446268,0x186028c1,0x51c451c5,0x30e251c4,0x31023943,0x5a6749e5,0x30e151e6,0x39423943,0x20a028e0,0x10203963,0x28e23123,0x182028c1,0x102020a0,
-0x4a055a67,0x080049c5,0x18401000,0x00000800,0x00000000,0x000010a2,0x00000000,0x00000000,0x528a3186,0x00004208,0x00000000,0x52681060,0x7bad5aea,0x736d5248,0x94518410,0x8baf9411,0x8baf836e,0x6a8b7b6e,0x20c430e4,0x10631084,0x632c4229,0x5a6a62cb,0x526a62cb,0x6b0d6b0c,0x83f0738e,0x62ab7b8e,0x418662cb,0x39c841e8,0x420941e8,0x4a4839a7,0x424839c7,0xad149cb2,
-0xb534b534,0xd659c5f7,0x59e72081,0x5a085186,0x30626249,0x30413882,0x30c23041,0xbd958bee,0x9cb28c50,0x9cb2bd95,0x52495228,0x7b4c62cb,0x62487b6c,0x49856aa9,0x498551a6,0xb491bd13,0x83aca46f,0x52481860,0x00006aeb,0x10a25acb,0x41e77bef,0x738c2924,0x10005a88,0x41841840,0x000028a1,0x08000800,0x00000861,0x00000000,0x31450000,0x18411020,0x49e83945,0x72aa5207,
-0x38c29c0d,0x836b0800,0xf692c551,0x284059a2,0xab2659e2,0xff99fe93,0xd4a86201,0xdd0b8240,0xbc04c448,0xfe2fc48b,0xb3a2fdd0,0x82e5a365,0xac8fb42c,0xac2da46e,0x8b497ac7,0x9b8ba3ec,0xd572cd31,0xbcd0c4f1,0xbcd2bcf0,0x9cafac4f,0x6246a46f,0x93cbbd0d,0x8b289ba9,0x9ba67ac3,0xb42bd50d,0xc512b46f,0xacd1b4f1,0xacb0b4f2,0xb4d1a44f,0x18009c0e,0x39012800,0x20001820,
-0x71c07241,0xdd0c79e0,0xee90ddcc,0x6ae4a46b,0x414072e7,0x938b5182,0xd6576aa8,0x08001840,0x41214121,0x28404962,0x38c01800,0xbcf1eed8,0x00000800,0x08410000,0x00000000,0x00000020,0x10610000,0x10000000,0x622740c2,0x40e151a4,0x52052860,0x5a066a86,0x30e15a67,0x49a43121,0x39223901,0x51e438e1,0x39633941,0x41a53922,0x31213142,0x39642080,0x28a028a0,0x31222080,
-0x49e449e4,0x10002880,0x18401000,0x00002081,0x08200000,0x08200820,0x00000000,0x00000000,0x00000000,0x00000000,0x31a50000,0x20c25ac9,0x290339a5,0x94926b0c,0x9c928c10,0x836e9c51,0x72ec836e,0x49878baf,0x20e33905,0x21252105,0x738e528b,0x62cb6b0c,0x62cc62eb,0x736e6b4d,0x8bcf736e,0x7b6e83af,0x4a085249,0x4a2941e8,0x420841e8,0x420739c7,0x39a63185,0xa4d38c10,
-0x8c0fa4f3,0x394462ca,0x494551c7,0xa4317aec,0x59668b2d,0x830c82ac,0x832c8b0c,0x940f93ef,0xa4d2940f,0x9c518bae,0x5a2841e8,0x6a895a07,0x6aa96aa9,0x5a2772ca,0x93ae6a89,0x832a6a88,0x5227a490,0x39857b8d,0x000039c6,0x20e40000,0x52890821,0x00000820,0x28c16aa8,0x392230c0,0x6a683902,0x49843902,0x31025a47,0x62a96288,0x48e14860,0x30e228c2,0x6a893944,0x72885186,
-0x8b2a9bcd,0x41005162,0xfed57b05,0xf695fffa,0xf6d5ee54,0x8b68cd91,0xdd6e82a4,0xdd6ce58d,0x9320bc25,0xedadb3e3,0xe52aedac,0x9ae2cc46,0xa3ea8ae3,0xac90938a,0x9c2d934a,0x82c87aa7,0xc511c511,0xc531cd31,0xac6fbcd0,0xacb1ac90,0xa42d940e,0x72412000,0x7a837ac3,0x724282a3,0xc4eeb48c,0xd5d5c4f1,0xac90acb1,0xac70b4d1,0x9c0dac8f,0x30624122,0x40e15184,0x9b049b45,
-0xcc87a365,0xf670ff33,0x7b027aa1,0x6ac35a21,0x6a6341a0,0x100051a2,0x10001800,0x59e51820,0x20003061,0x30601800,0xac6c7265,0x28601800,0x10607306,0x00000000,0x00000000,0x082041a7,0x28822883,0x49a52881,0x41218bac,0x498351c4,0x7ae94142,0x7b0a6287,0x41836267,0x49e541a4,0x396349c5,0x39634184,0x41c45a47,0x5a8849c5,0x39224a05,0x31223943,0x31021000,0x28c03142,
-0x41434163,0x39224183,0x08000000,0x00000000,0x20a10000,0x10202080,0x000020e2,0x00000000,0x00000000,0x00000000,0x00000000,0x29030800,0x082120e2,0x8c5162cc,0x8c109451,0x7b2d7b2d,0x8b8f836e,0x8b8f8baf,0x392559a8,0x528a2944,0x738e630b,0x62ec732d,0x62ec5aab,0x83f06b4e,0x94319451,0x7b8e83cf,0xa4b3ad14,0x4a293166,0x42294a29,0x4a4841e8,0x524841e7,0x9c914a28,
-0x9430a4d2,0x41434184,0xac51832c,0xacf3ac72,0x9c10a431,0xac9293cf,0xbcb1b4b3,0x39234124,0x51854965,0x51c651c6,0x520739a5,0x5a0749a5,0x72ca6aa9,0x838d5a27,0x59a48b2c,0xa4b1832b,0x41c55ac9,0x29244207,0x18c220e3,0x000039c6,0x00001062,0x10000000,0x8b8a5982,0x6ac772e8,0x6a686247,0xac908b8d,0x5a0630c1,0x282030e1,0xe5d1ddae,0x498483cb,0x7b0a51a5,0x72666a26,
-0x93ab6a24,0x59a25141,0xcd7082c4,0xa44cb4cf,0xb4cea46c,0x6a238307,0xd4ab6a63,0xff15dd6d,0xd54a7220,0xd509ab85,0xf5ade56e,0xed4af56a,0xaba7bc07,0xbcf2a368,0xa44e9349,0xbcb0b490,0xcd32c511,0xbcafd573,0xbcf1c511,0x9c2ea42e,0x7ae86a88,0x40c02000,0x72a25980,0x7a818b04,0xb4cd9347,0xcdd49c2d,0xac909c6f,0xa44fbd12,0x9bcbb4f0,0x40c02000,0x40a05161,0xcd71ac8e,
-0xc489cd0e,0xc4aafe4f,0x20002060,0x18201800,0x20001800,0x18002000,0x18003080,0x20602000,0x20002020,0x41021800,0xc571836a,0x8b2a4120,0x51e26284,0x184030c2,0x18a00800,0x28e21860,0x18204164,0x49a35a45,0x8b8c93cd,0x7b6b836b,0x8bcd7b4b,0x49e57b8b,0x49a549c4,0x52265246,0x41844184,0x5a6749c5,0x5a474a05,0x52683983,0x41424184,0x41843982,0x310249c5,0x30c02060,
-0x51c44121,0x49835a67,0x00002061,0x08000800,0x10400840,0x186020e2,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x39c60020,0x5aab41e7,0x9c928410,0x93f0a493,0x9410acd4,0x7b4d8bd0,0x93d0836e,0x49c772ab,0x4a083166,0x738e6b0c,0x6b0c738e,0x736e5a8a,0x8c3083ef,0x7b4d8c10,0xbd767b4e,0xad55c618,0x42085aab,0x39c739c8,0x41e731a6,0x4a063144,0x8c4f41e6,
-0xb575ad34,0x8bce8c30,0xb4b3ac72,0xa472b4f4,0xac729c10,0xc534bd14,0xbd53ac72,0x49c549c5,0x5a4849c6,0x520772ca,0x51c65a47,0x7aca6a69,0x8b2c7b0b,0xacd293ef,0x8bad72c9,0x8b8da491,0x41c65248,0x18812923,0x00001061,0x00000000,0x00000000,0x59c538c1,0x938a9c0c,0xbd735a46,0x180051c5,0x30805183,0x30a14121,0x61e31820,0xdeb6ffdc,0x4921942d,0x7a458286,0x6a2293aa,
-0xcd72936a,0x61c27224,0x9beaa3c9,0x93ea940a,0xaccd9c4c,0x72837b06,0xb4689348,0xc4caa3c3,0xe671d56f,0xedcef630,0xfdeef5ee,0xfef4fe92,0xe4edfe93,0x9c0bcc89,0x8ae7a40e,0xc511bcd0,0xbcf1cd73,0xbcf0bcd0,0xcd73bcf0,0xb4d2ac91,0x1820836b,0x6a209325,0x7a627241,0x7aa37aa2,0xc50f8ac5,0x7b27ffd9,0x5a057349,0x6a886226,0x38c06266,0x7200ed8e,0x8b49ee97,0x7ae78329,
-0xac0a9c0b,0x40c0fe72,0x30003800,0x180038c0,0x10002800,0x10002000,0x18003080,0x40e240c2,0x7ac728c2,0x834b69e2,0x7b496a87,0x7b2a1020,0x732928a0,0xb514944e,0xa4b183cd,0x6aea3964,0x41845a47,0x5a246ac8,0x8bcc734a,0x7b4b838b,0x8bee732a,0x6b098bed,0x41a228c0,0x418449c5,0x310141a4,0x41633942,0x49a441a3,0x310151e5,0x28803921,0x416330e1,0x206028c0,0x10002060,
-0x41614161,0x9c4f30e0,0x180020a0,0x10000800,0x10201840,0x10400800,0x08000820,0x08000820,0x00001882,0x00000000,0x00200000,0x528a41e7,0x630c5aaa,0x8c108410,0xacb3acb3,0xa4b39c31,0x94109c31,0x8b8f93d0,0x41a661e8,0x292541e8,0x630c6aec,0x736d7baf,0x83ef83cf,0x83ef8410,0x838e9c72,0x0000838f,0xb514a4b3,0x41e89452,0x31a639c7,0x41e73186,0x528841e6,0x31646b4b,
-0x736c2922,0xb5347bce,0xbd55c596,0xacd3b514,0xacb3b4d3,0xd5f7bcf4,0xacf3d5f7,0x8bef6289,0x9c92a4f3,0x8c109c72,0x728bac92,0xa3ef934e,0x6a69a430,0x9c5193ce,0x9c91b534,0x83cea491,0x18810800,0x08001020,0x08200000,0x10000000,0x836b49a6,0x41228b6c,0xc530a44d,0x28a051a3,0x30a02020,0xfe52c48c,0x59a09327,0x93ec6a25,0x5a25b591,0x82445120,0xccecabc9,0x93287285,
-0x93cb9368,0x93696a05,0xac4db44c,0x72869c2c,0x6a637ae6,0x72e47b26,0xbcac9bca,0xd52f9346,0x20608344,0x40e082e8,0x92a082a6,0xedcefe0e,0xe56baba5,0xcd2ffe92,0xac4eb46f,0xb4b0b48f,0xcdb4cdb4,0xa44eacb0,0xb511cdb4,0xacb0acd2,0x59601000,0xd54dfe92,0x82a38ae3,0x61e08b05,0xff366a20,0x30621800,0x30801802,0x30e030a0,0xd6134981,0xb48bee30,0xb4b07265,0x938ab48f,
-0x7b077aa6,0x40e0acae,0x51006161,0x40604060,0x69c15121,0x89e2abca,0x20003080,0x41002000,0x93486a22,0x5a44cd30,0x28c13983,0x6ac828a0,0x62669c4c,0x18200000,0x418351e5,0x49c43924,0x832a4163,0x5a255a04,0x5a0459e3,0x72e87b08,0x41415a04,0x49a249c2,0x522530e0,0x186028c0,0x182020a0,0x30c11820,0x28a03901,0x28c03102,0x30c028c0,0x30c04163,0x51833901,0x28c23902,
-0x41613940,0x83ab6ae9,0x28a06268,0x00001800,0x28e10800,0x18401820,0x18611820,0x00000000,0x00000800,0x00000820,0x00000000,0x632c0861,0x83ef6b6d,0x8c109c92,0xa4729c72,0x9c728bd0,0x8b8f9411,0x834e8baf,0x41a65186,0x39a741a7,0x83cf632d,0x7baf7bce,0x738e734d,0x7b8e8c30,0x838f8c51,0x394551c7,0x5a8a0000,0x4a0841c7,0x39a74a28,0x41e631a5,0x52484a07,0x736c734c,
-0x31644a07,0x9c91a4d2,0xad14bd75,0xa472a4b2,0xbcf4a472,0xd63893cf,0xa4b2b555,0xb534acd3,0xad14bd96,0xb5149451,0xddd8d5d7,0xd5b8c4d4,0x9c10bcd4,0xbd359c10,0x4121a4f2,0x39641820,0x00000800,0x38e01800,0x102048c2,0x416328e3,0x410161e6,0x624630c2,0xa40bac4d,0x41002822,0x9c2e72e8,0xff55eef5,0xfffcff35,0x7266b4af,0x51c35a44,0xdc8b59a1,0xb3c9ee10,0x7ac79326,
-0x83078b48,0xa3ec59c4,0xa44cb46e,0x62046a65,0x62645a22,0xbcf1accf,0x72208365,0x20008b82,0x30001800,0x6a213820,0xd4643000,0xfe92fdcb,0xed6ce4ea,0xf631e5ad,0xbd0fcc8f,0xbd32bcb1,0xa4f09ccf,0xad32b594,0x83cca4cf,0xa48dacf1,0x82802841,0xbccbdd6d,0x8b249b43,0x83058b25,0x284072a1,0x8b08ac6d,0x82e550e1,0x8369a40f,0x7b079c6c,0xcd8fc52f,0xb4cfa40a,0x72c89c0d,
-0x72c77b08,0x620472a6,0xcd32f6d7,0xff59ff18,0x6262d50d,0xd5d14960,0x69c372e6,0xc531ac4d,0xddd39c30,0xb511ef3a,0x10005a67,0xe6d91840,0x31051020,0x28c01000,0x18402880,0x9c8e5a45,0x182030c1,0x5a242861,0x498040e0,0x496059e2,0x59e251e2,0x41406204,0x310028c0,0x28e05265,0x28c049a4,0x28e14925,0x20812080,0x28201020,0x41432880,0x496130c0,0x48c06122,0x49012820,
-0x310030e0,0x5a264161,0x28e06ac7,0x000020a0,0x20c00000,0x186020a0,0x100028e2,0x00001020,0x00000000,0x00000000,0x00000000,0x39e70000,0x8c516b6d,0x9c72acf4,0xacb39431,0x94518baf,0x9c319c51,0x8baf9410,0x41456208,0x28c349a6,0x734d5a89,0x630c83cf,0x6b4d1882,0x84108410,0x6a8b83cf,0x38e43904,0x08002022,0x62cb83f0,0x41e84a08,0x524841c6,0x62eb4a07,0x5aaa4a28,
-0x52685268,0x947162ca,0x9c91a4d3,0x9c92a4f3,0xad34a4b3,0xad14c5b6,0x9cb29cb2,0x94508c30,0x9cb28c71,0xd679a4d2,0xffdece58,0xd67adefb,0xd659f77e,0xb575a4f3,0x18403123,0x00001020,0x41021020,0xabcc4162,0x3120ff38,0x7b0b38e0,0x390151a3,0x40c04902,0xacae7ae7,0xcdb34162,0x838c940d,0x9bec7b09,0xc4f1c4ee,0x69e49bab,0x51c36a45,0xddae6203,0xabe9ee95,0x82c48b24,
-0x93aa9bcb,0x8b495981,0x93aab4cf,0x72846224,0xb513c552,0x6a847308,0x51006aa5,0x594140c0,0x40804020,0x78c07980,0xf506c320,0xfe0ffe4f,0xfe52fdce,0xf69171e0,0xdd937a42,0x9cb1ddf4,0x000039c5,0x6b2b630a,0x8bcd7b8c,0x18007329,0xcdb22020,0xcc68c4cb,0x8ac4abc4,0x9b878ae5,0x93468b04,0x9ba9bccf,0xb44b9324,0x9beea40d,0x6a659bed,0xa42b72c6,0x9bccbcaf,0x4962ac8f,
-0x838b838b,0x72e77b29,0x71e08b27,0x9aa2ab46,0xff38cd50,0xe6344982,0xff39e675,0x72c8a4b0,0x8bec8b89,0x4184a48f,0x18200800,0x5a631000,0x20402080,0x83698bcc,0x28e330c2,0x28a11000,0x30e02040,0x30e06267,0x416038e0,0x49605a02,0x30c03900,0x28a03940,0x390030c0,0x308049a4,0x30a030c0,0x28002000,0x69406183,0x69a171e3,0x6a2248c0,0x7a2161c0,0xcd2d9304,0x9325c4cc,
-0x39204161,0x39214940,0x6ac87b2b,0x10003181,0x18600021,0x10201840,0x206020c0,0x00002081,0x00000000,0x10610000,0x00000000,0x00200000,0xa4f45aeb,0x9c729c92,0x9c51a4d3,0x94718bcf,0x9c319c72,0x93f0a492,0x51a772ab,0x31034986,0x62cb3144,0x08200820,0x528a0000,0x7baf7bcf,0x830d7b4e,0x51876a29,0x100059a8,0xa4d3ad14,0x394641e8,0x4a273985,0x4a2841e7,0x52484a28,
-0x41c65268,0x524839a6,0x949183ef,0x734d9492,0x9cf39451,0xa513a554,0x9cf39cf3,0xa5139cd2,0x8c508c70,0x5aca5aeb,0x00007b2d,0x1903b5b6,0xce58ad75,0x5268b595,0x38e24103,0x206130e2,0x6a886a67,0xd5f77288,0xb551ee76,0x41834923,0x5a056a47,0x69e35921,0x6ac793ab,0xad525a42,0x6aea838b,0x6a665a25,0x6a0761e4,0x82665162,0x72e76a24,0xb487a40b,0xb3a6ac2b,0x8ac5bcac,
-0xb48e8308,0x8b4869c0,0x8b699c4d,0xcd3172a6,0xad32ac6e,0x9c0a9c2e,0x9b6149c1,0x7a807a80,0xa2e2d52b,0xfe4ddd94,0xfda9feb3,0xfdeefe0d,0xfef2fe91,0xfef6b3a1,0xa3c8ff14,0x6b8da44d,0x00000000,0x08400000,0x39200800,0x38c11000,0x72e359c0,0xcce9a406,0xa383c4a8,0x72007200,0x69e09b46,0x7283c50c,0xb44cc4cd,0x9becb4af,0x6a666a65,0x8b896a86,0x7aa58348,0x2020a42d,
-0xbd52b531,0x7ac75a46,0xb44e6a86,0xc592ff9c,0xac6fd5f4,0x7b07b4af,0x6ac872c6,0x8ac572a7,0xb5728304,0x20a12860,0x30e20800,0x10001820,0x28602880,0x20401000,0x200038a0,0x624659e4,0x62661800,0x9c4f5a05,0x5a215a23,0x49816a63,0x51a151a1,0x61c25141,0x416040e0,0x40e04120,0x40c24962,0x93498b27,0x9ba8ac0b,0xbc8cb4ac,0xb48bac4b,0xbcadb46d,0xb44ab469,0xac2cb4af,
-0x49c249c2,0x39205a04,0x6b0a5a67,0x41a3730a,0x08000800,0x18001020,0x28c128a1,0x000028c1,0x00000000,0x00000000,0x00000000,0x08410000,0x94714a69,0x8c109431,0x94519431,0xa4d3a4b3,0x9c319c51,0x93af8baf,0x59e8938e,0x28e23985,0x31643985,0x00002923,0x4a6918c2,0x62cb6b0c,0xa4b36b0c,0x94108bd0,0x28c3a492,0x9c729c31,0x520851e8,0x51e75208,0x4a274a27,0x39a541e6,
-0x420641e6,0x41c63164,0x42284a89,0x39c631a6,0x7bae0840,0x62eb9491,0x8c4f7bae,0x630a5288,0x7bce1081,0x31a539c6,0x296418c2,0x10815aca,0x736d2944,0x41843144,0x830c49a6,0x72474944,0x20204963,0x38a040a1,0x72e972c8,0x8b8c7b0a,0x6a266206,0x93cc6a26,0x940d940d,0x6b0b83ad,0x52275268,0x83295226,0x9c2ea46f,0xb46fb490,0xd5d4938b,0xc50ecd92,0xbcaccd2e,0xa3a9abeb,
-0xc4cf6a41,0xac6d93a8,0x62038bcc,0xc54fa44d,0xacd1cdb2,0x20623102,0x304030a0,0xa28081e0,0xfed4fd07,0xfe90fef5,0xfeb1feb1,0xfe50fe2f,0xfeb2fe50,0xc4a9ee71,0xf64fabe8,0x1020f6f5,0x00000000,0x08000000,0x28001000,0x59c069c2,0x8b2659e0,0xcceb8b02,0xabc4c488,0x7a00a3a4,0xc48a92e1,0xff15c52d,0x8ae4abe9,0x9b89b44c,0x62447ac6,0x5a0359e3,0x82a36a20,0x72647a85,
-0x6a44938a,0x6ac76a45,0xa3ab836a,0xe5d2dd50,0x8ae7ff38,0x72c77aa6,0x72c97ae8,0xb510836b,0xa4b0acef,0x10000800,0x20600800,0x10011000,0x20411000,0x28412880,0x52044944,0x29008b6b,0x10001820,0x49a35a05,0x940cac8e,0x9bedb511,0x83249388,0x9b89bc8c,0x61e29be9,0x59c17264,0x8b479beb,0x93a882e3,0xbc8ca40b,0xc4cdb46c,0xbccdbc8d,0xc4cdac29,0xbc6bc4ac,0xabc8b42a,
-0x49c249a2,0x39004182,0x6b0a5204,0x49e4838d,0x08002080,0x20400000,0x28a02060,0x000030e1,0x00000000,0x00000000,0x00000000,0x39e70000,0x7baf73ae,0x83af83cf,0x943183af,0x9cb38c10,0x7b0dacd3,0x9c10836e,0x51a7830c,0x31443123,0x39c53964,0x41e72903,0x62eb5aaa,0x8baf732d,0xacf483cf,0x9c729c92,0x624aad35,0x51a638e3,0x51c751a6,0x5a4859e7,0x39c55228,0x4a4741c6,
-0x41c64206,0x41c639a6,0x4a6939e7,0x29445289,0x082020e3,0x210341e7,0x084018a0,0x4a463183,0x18e2630b,0x422731a5,0x108139e6,0x318510c1,0x18813185,0x30e23102,0x8b8d6248,0x594382ea,0x38e1836c,0x8b4b2820,0x72a88b6b,0x72676226,0x8b0a6a47,0xbd127268,0x6ae96ac8,0x49e662ea,0x52475267,0xacd183ee,0xb4d0acd0,0xa44fb490,0xcdb4a44f,0xb4ce8bab,0xac0ab4cd,0xabcba3a8,
-0x9bc99b89,0x9c4d9c6d,0x51606286,0x93c9a44e,0x10006286,0x30e02080,0x9b005140,0xff51fe4f,0xf6b2ffb3,0x9b217a60,0xfe6fff96,0xf64ffe2e,0xddd0fef4,0xabeaac2b,0xfe91bc8e,0x1040b4ec,0x00000000,0x18000800,0x59603040,0x4920b42b,0x8b467ac3,0xcccb6a20,0xbc46dd4e,0xd4c9d467,0xfe0cb3e4,0x8281d4e9,0xac0961e1,0xc48aac4a,0x6ac67a85,0x62456ac6,0x936872a5,0xa3c79325,
-0x7a848b26,0x62867ac6,0x83696aa6,0x8ae7ee55,0x71e1b3cb,0x72867264,0x730a7309,0xa4af736b,0x18406287,0x28821842,0x7b4c0800,0x10201000,0x18210800,0x410028a0,0x62057ac6,0x3100940d,0x51e430a0,0x49c11020,0x7ae759e2,0xacae8b6a,0xa40a93a9,0x93679b89,0x93886a00,0x93ca93ca,0x7ae4ac6d,0x9bc89b89,0xac2ba40a,0xbcadc4ee,0xac2bc4cd,0xbc4aa3c7,0xb44abc6c,0xabe9bc4a,
-0x418149c2,0x310028e0,0x62a83940,0x5a876aea,0x28e03982,0x08001860,0x18001820,0x000028a2,0x00000000,0x00000000,0x39850820,0x528a3165,0x8c317bcf,0x8bf08c10,0x9c528c10,0xacd4a472,0x93f0acd4,0x8b6d8b8e,0x49a66a8a,0x41a620a2,0x31453986,0x5a6920e3,0x732d732c,0x945183af,0x8c319cb3,0x94319431,0x94109411,0x8b8e6aab,0x9c1072ec,0x730b7aca,0x41c65a68,0x4a2741c6,
-0x41c64207,0x39c741e7,0x422839e7,0x4a483a07,0x4a494207,0x5aaa41e7,0x19022963,0x31842122,0x004010e2,0x42072964,0x08602103,0x31640000,0x20e32944,0x41a53103,0xac104985,0x8289a42f,0x51447aa9,0x514361a4,0x51e65a27,0xa42f6aa9,0xac2fb470,0x8b4b7ac9,0x5a67730a,0x41c55268,0x5a885267,0xa4d17b8c,0xb4f1a4af,0x9bccac4f,0xcdd493ac,0x62a96b29,0xac0b9c0a,0xb42bac2a,
-0x8b46c4ee,0x7ac7b48f,0x6a445181,0xb48da42c,0x10002800,0x30a01000,0xd4e959c0,0xffb3ff52,0xfe4eff94,0x58e0cbe6,0xf60efef2,0xe5adfdec,0x6a42e631,0xa3aa9369,0xb44a9327,0x2061f715,0x10000800,0x62042040,0xd52c6a01,0x61c0a3a7,0x83247aa3,0xa3e661e0,0xf630d56e,0xfff8f58c,0xfe32fce4,0xfffce60f,0x72407260,0xd54fc4aa,0x7b47ddaf,0x72c8834b,0xac096ac6,0xdd6cd54c,
-0x9367a3e8,0x72e79348,0x72e76ac5,0xff1993eb,0x83087285,0xb4f2a42d,0x52059c4f,0x18405204,0x28c141a3,0x18401821,0x100028e2,0x184028c1,0x08001000,0x82e72060,0xa42e6a23,0x9c2ee677,0x5a481860,0x28807b2a,0x6a424941,0x7ae46a63,0x93a79be9,0x9bc89bca,0x93889b67,0x9bea9be9,0x83049bc9,0x82c38b27,0x93669365,0xb44bac2a,0xbc6cb44b,0xb42ab42a,0xcd0ebc8d,0xb42abc6b,
-0x290020c0,0x39823120,0x41c44182,0x6b2a6b0a,0x52057bac,0x30e128c0,0x18000800,0x00000800,0x00000000,0x20e20800,0x31441061,0x8c3039c7,0x83cf8c30,0x945183f0,0x8bd09431,0xb4d4a493,0x9c31ac93,0x51c793ef,0x20a241a6,0x7bce5289,0x31655aca,0x732c62eb,0x7b8e7b6d,0x7b6e732d,0xa4d39c92,0x9411acf4,0x94118baf,0x9c719c31,0xb5339430,0x628893ce,0x4a27734b,0x41c639c5,
-0x39c64a07,0x318639c6,0x41c64207,0x41c641e7,0x316539a6,0x31864a28,0x31a54a28,0x8c5039e6,0x10a10000,0x08602103,0x00000000,0x29030000,0x29243965,0x398541a6,0x9bef3944,0x9b8cb4f2,0xb4d2bcb2,0xb4f2ac70,0xa4f2a512,0xc595d678,0xcd94cd95,0xbcd1cd94,0x49e593ed,0x41c55268,0x52475247,0x946f1020,0x9c8f9c8f,0xb4d093ed,0x72c9c511,0x41c44a05,0xbc8c8b6b,0x8aa4bc6c,
-0xac08b46b,0x6a64ac4c,0xac6d6a63,0x20003060,0x388040a0,0x596040c0,0xccc961a0,0xffd5ffb6,0xffb5ff93,0xffd8fffa,0xf5eee652,0xc4ccedad,0xc4ad8b26,0xd551ac2c,0x9367bcce,0x28608b67,0x28201800,0x8b2761e2,0xe610a3ea,0x82c39b26,0x7b264940,0xc4ecc50d,0xac05b3e6,0xd60fe58c,0xfeb1ddcd,0xdd49fe90,0x7a80bbe5,0xbc8c9b84,0xc52cd54c,0xa4b06a87,0xde53a4ce,0xe630e693,
-0xbcccb48b,0x8368ddb1,0x30e059e2,0x59a14142,0x93ab4120,0x7b8a7b29,0x73296ae9,0x208028a0,0x184028c0,0x10001000,0x18205227,0x39223102,0x30e249c4,0xbd114143,0x7b289b89,0x52678bab,0xef1a0820,0x3100a471,0x5a012840,0x6a624980,0x7ae372a3,0xa40a93a7,0x93689b69,0x93478b46,0x93677ac3,0x93688b66,0x9366a3e9,0xbcadb44b,0xbccdbccd,0xbc6cc4ad,0xbc6bbc4b,0xc46cbc4b,
-0x312020a0,0x396241a3,0x41c341c3,0x5a474183,0x7b6b730a,0x49e26ae9,0x18003101,0x00200800,0x08000000,0x082020c1,0x42074a48,0x8c118451,0xa4b39452,0x9410a4b3,0xac939410,0xa4b2a472,0x8b8e9c30,0x49866a8a,0x4a0728c3,0x840f83ef,0x734d630b,0x8bf083ef,0x72ec7b6e,0x100030c4,0x94929cb3,0x945183af,0x9c51a492,0xa492a492,0xacb2acd3,0x5a06bd33,0x520759e5,0x51e749c6,
-0x41e64a07,0x39853985,0x314539a6,0x39c73986,0x39c63186,0x316539c6,0x420739c6,0x94914207,0x420731a6,0x188110c2,0x10200000,0x398641a6,0x41c741a6,0x41c741c7,0xb4d28bef,0xb492bcf3,0xcd34b491,0xcdf6d5b6,0xb575d658,0xcdf7b575,0xd5b5d5d6,0xbcd1c533,0x52068bac,0x4a065227,0x52884a27,0x63096b4b,0x942e7bab,0xac8f83cc,0x520593cc,0x41a44a06,0xc48d6a87,0xb429bc2b,
-0x9325cced,0x72e782e4,0xb4f18bca,0x9b661800,0xc40679e0,0xd3e3d407,0x6a00ab83,0xfff86180,0xff54ffd7,0xededfed2,0xe58de5ab,0xbc6bd52c,0x82429326,0xac6da3ca,0xbccfc530,0x834ab4d0,0x7aa44940,0x7ac572c5,0xbcaa8ae6,0x8b67e633,0x6aa74101,0x08007ae4,0x8b22f674,0x9b857ac2,0xc4abe5ae,0xff359b66,0x6a01b468,0x9ac4a3a6,0xcdf1d5ae,0x62669c2c,0x5a663961,0x52454183,
-0x72c4cdb2,0x9bcaddf2,0x28604940,0x28007a85,0xff593060,0xacf1942d,0x18400800,0x20811860,0x08001040,0x18400800,0x204049c5,0x100028a1,0x838effbd,0x28c21820,0xe697f717,0x000062a8,0x00000000,0x9c6eacd1,0x51621000,0x6a846222,0x7b067ae5,0x9bca8325,0xa42cbcce,0xa44cbd10,0x936793a8,0x9ba89388,0x9be9a40a,0x9b889386,0x9bc8ac0a,0xc4ccb46b,0xb3e9bc4b,0xc48dbc0a,
-0x31202080,0x41c33941,0x20a04182,0x41c43982,0x6ae95226,0x7b2b7b4b,0x206049c3,0x10211000,0x108020a2,0x39641060,0x6b0c5acb,0x9cb373cf,0x9c92a4b3,0x9411a4d3,0xacd4b514,0x93efb4d4,0x9bcf93cf,0x30e35186,0x526920a3,0x840f7bce,0x83ef7bce,0x83af83ef,0x83af83cf,0x6aec28a3,0x9c921862,0xacf43986,0x9c529410,0x94519451,0xb513a4d3,0x7b0ba490,0x728a6a69,0x6a285145,
-0x51c7728a,0x41a63985,0x41a641a6,0x398541c6,0x41e73985,0x41e74a08,0x420739a6,0x39c641e7,0x18c21081,0x20c21903,0x41c60840,0x49e73965,0x41c741a6,0x41c741c7,0xacd25a8a,0xbd13cdb6,0xac91ac71,0x9c70acb1,0x5aaa41c6,0xb4f39470,0xd5b5bcf2,0x9c0ec553,0x72e9a490,0x5a6849e6,0x4a274a27,0x52485aaa,0x62c962c9,0x944e736b,0x5a676b2a,0x49c54a06,0xcccd4162,0xbc4acced,
-0xabcad530,0xac4e9364,0x2040c552,0xbced4940,0xff34f693,0xfdabfeb1,0xfed5fe90,0xac2addef,0xdd4d8346,0xedeefe50,0xd50cd50b,0xb3a8c48a,0xfeb4b3e6,0xbccf6981,0xbcefbccf,0x4160a42d,0x83056a43,0xa40b6aa6,0xd5917263,0x20606244,0x280048e0,0xdcad2060,0x8b67e5cf,0x59615141,0xd5518b26,0x9c0ba3ea,0xbcac7ac2,0xfed48b22,0x10408ba7,0x082020a0,0x080028e0,0x08001000,
-0x38c02880,0x280059e2,0x30004902,0x69c19b28,0x93cb3002,0x20c062a6,0x102028c1,0x18400800,0x10201841,0x18401820,0x10002061,0x18001820,0x08001000,0x08000800,0x208028e0,0x00005207,0x00000000,0x9c6f0840,0x282030e2,0x6a8551c0,0x83277ae6,0xac4c72c4,0xb46dc510,0x9389ac8d,0x8b269388,0x83069367,0x9ba98b26,0x9b86a409,0x9ba68b04,0xabc99b67,0xb40cc44c,0xffbddd31,
-0x290028c0,0x28e02900,0x20c03120,0x520441a2,0x49e549e4,0x5a476ae9,0x208049a5,0x49a43901,0x00001000,0x29031860,0x9cb339c8,0x9cb38c51,0xacf49c93,0xbd359c72,0xa452cdb7,0x9c30a472,0x5986832c,0x30e238e3,0x41c73986,0x83ef7bae,0x738d8c50,0x83af736d,0x8c108bf0,0x6b2c7baf,0x8bf02062,0x49e849e8,0xa4728bd0,0x62eb6b2c,0xacf39471,0xac92bd94,0xb4b2ac51,0xac71a451,
-0x83ceb4f3,0x49c749c7,0x520751e6,0x398549c6,0x49c73985,0x4a0849c7,0x41e739a6,0x294539c7,0x18c20861,0x20e210a1,0x52482103,0x4a085208,0x41c749e7,0x41a64a08,0x7b8d3986,0xb4f3bd75,0xc554c574,0x7b8ba46f,0x4a2841c6,0x18005a89,0xcd94b471,0xc553bd12,0x7b4bc594,0x49e65247,0x5a894a27,0x52485249,0x5a685a68,0x6aa95227,0x62675a47,0x49e55247,0xabc96267,0xc48babe8,
-0xabc9bc6b,0x7a86b40a,0x494159e2,0xa3c6ac28,0xff34b488,0xffb8fef2,0x71e3de53,0xa44cc4ee,0x9385a44b,0xe5aefe4f,0xccabdd2d,0xabe9bc29,0xfed4cced,0xb48efffc,0xc510c510,0x4160b4cf,0x6a427ae5,0x72e7b4d0,0x7ac78305,0x28200800,0x1041bcef,0xf7fc51a0,0x9327ddee,0x69e44921,0xc4d29bea,0x6ac7bcd0,0x38c08323,0xee936a20,0x4122de53,0x41202040,0x20a128e0,0x080028c3,
-0x282128a0,0x30002820,0x7aa74060,0xf676b4b0,0x28a04140,0x41a36285,0x08001000,0x18601000,0x20412041,0x18001821,0x08001800,0x62070800,0x20613923,0x10001000,0x4a270800,0x000041e4,0x00000000,0xa4900000,0x72a7834b,0x62244120,0x7ae772a6,0x9bec72a4,0xa42ca42c,0x9b889bc9,0x8b679367,0x8b478b67,0x938993a8,0xaba99367,0xabc99b68,0xbc2a9b47,0xff1acc8e,0xfffeff9c,
-0 };
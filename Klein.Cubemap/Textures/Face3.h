@@ -1,1052 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT const unsigned int
-#endif
-
-A32BIT Face3[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x00000100,		/* dwHeight */
-0x00000100,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00010013,		/* dwpfFlags */
-0x00020000,		/* dwDataSize */
-0x00000010,		/* dwBitCount */
-0x0000f800,		/* dwRBitMask */
-0x000007e0,		/* dwGBitMask */
-0x0000001f,		/* dwBBitMask */
-0x00000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x94769cd5,0x8c7794f8,0x9d189d19,0x8c769cf8,0x8c559cf8,0x84137350,0x73717bd2,0x5aad5ace,0x6b9218c6,0x4a8f52f0,0x5b334ab0,0x84987416,0x8cd98cd9,0x84788498,0x7bd494b8,0x5b100046,0x73b573d4,0x6bf55332,0x6bf663b5,0x84b98499,0x8cb984b8,0x8cb98cb9,0x8cb984b9,0x8cd98cd9,0x8cb984b9,0x849984b9,0x84b98499,0x84998499,0x84b984b9,0x84b984b9,0x84b984b9,0x84b984b9,
-0x84b984b9,0x849884b9,0x84988cb9,0x84788498,0x84b88498,0x84b88478,0x7c787c98,0x74578499,0x6bd57437,0x63956395,0x5b537438,0x196c5332,0x53324ad1,0x5b5373f5,0x4ad16bb4,0x5b335312,0x5b336bd5,0x63b54af2,0x7c587417,0x745773f6,0x32306bf6,0x6b921109,0x5b326bb6,0x5b546bd5,0x42713a51,0x53145b33,0x7c375313,0x7c578477,0x84787c57,0x84988478,0x84b88498,0x94b794b8,
-0xad379cd7,0xbdb8c5d9,0xc5d8bdb8,0xc5d8c5f8,0xcdd7c5d8,0xd618d5f8,0xd618d618,0xde59de38,0xe679e678,0xde37e638,0xddf5ee99,0xff19e616,0xff19ff3a,0xf657f6d8,0xf675edf5,0xe530cc8b,0x9b8b8a85,0xd510bc4a,0xabcacd2f,0xffbdff9d,0x4942c5b4,0x28402081,0x3964de17,0xac2c93cd,0xf6767a45,0xe6b9abc9,0xdd51f676,0xfef8fffd,0xc4d0fffd,0x0820fffb,0xee77a3ce,0x6165bcf2,
-0x4a6e0844,0xa5370000,0x1861d6de,0x394420a1,0x1000a492,0x18a25208,0x39643986,0x28c20820,0x41c63123,0x732c4a07,0x5a4728e1,0x39813964,0x290028e0,0x29002900,0x31a12100,0x29202920,0x28c028e0,0x29002900,0x28c028e0,0x41e21880,0x51e33122,0x41a241a0,0x52225222,0x6aa64160,0x61a23900,0xf48969c0,0xfffffe92,0x73228b02,0x49a072e3,0xee557b22,0xf79b8b86,0xde96cdf0,
-0x94b78435,0x94d894f8,0x95199d39,0x94f894f8,0x84148c96,0x73927bf4,0x6b306b50,0x5aee7371,0x31c97b8f,0x6bb452ef,0x531273b4,0x7c376bd5,0x7c588498,0x84b87c98,0x94d88cf8,0x84574a6f,0x73f56374,0x5b126374,0x84786bf5,0x84b88498,0x84b984b8,0x8cb98cb9,0x8cb98cb9,0x84b984b9,0x84b984b9,0x84b984b9,0x84b984b9,0x84b984b9,0x849984b9,0x84988499,0x84b984b9,0x84988498,
-0x849884b9,0x84988498,0x84988498,0x84988498,0x84988498,0x84788498,0x84988478,0x7c788498,0x7c986bd5,0x74377c78,0x74575b74,0x196b5b93,0x6bd58d1a,0x53336bf5,0x428f10e9,0x52d252f2,0x6bb56395,0x6bd66394,0x7c587c37,0x63d67437,0x42d17457,0x08676395,0x63747c36,0x4ad17c57,0x53125b33,0x53136bf6,0x63b55b75,0x6bb663b5,0x84777c77,0x8c978c98,0x8cb88c97,0x94f894d8,
-0xb5379d18,0xc5f8c5d7,0xcdf9c5f8,0xcdf8cdf9,0xd5f8cdf8,0xd618d618,0xd638d618,0xe659de38,0xe678e678,0xeeb9e658,0xee57e678,0xff39ddd5,0xff39f73a,0xf71af6d8,0xee17ee97,0x5162cd72,0x7ac89b6a,0xfffc8b8a,0xfed8ef19,0xde57ffff,0x5a46ff5a,0x30a028a1,0xf6fa3902,0x38e0a42c,0xd59338a0,0xd5d4de15,0xf696fe98,0xfffdfffd,0xf65238c0,0x1000e6d8,0x2000f6b9,0x94731000,
-0x94b79cd7,0x9c941023,0x18405a69,0x28c128c1,0x102049a6,0x188128e3,0x184020a1,0x20611000,0x28c02080,0x41a449c5,0x5247838c,0x39615aa8,0x20e020e0,0x21202100,0x41e341e4,0x5ac63982,0x396249e3,0x39622900,0x62e93121,0xd6551020,0x4a24ce34,0x52656ae7,0x8c0c7bc8,0x312062a4,0x416041a0,0xb42772e4,0x92a18a60,0xde115160,0x7b224180,0xff9a7301,0xdef4bd4e,0xedaed58d,
-0x8cd74a6c,0x8cb87c55,0x9d198496,0x73d49cf9,0x84158c77,0x84157bf5,0x6b3173f3,0x6b716b51,0x21075a6b,0x6b724a6d,0x73f573f4,0x7c786bb5,0x84987416,0x84987437,0x94998cd8,0x6bb44a72,0x52d17c16,0x63536353,0x6bb56bf5,0x6bf66395,0x8cd97c78,0x8cb98cb9,0x84b984b9,0x84b984b9,0x84b984b9,0x84998499,0x84998499,0x849884b9,0x84998499,0x84988498,0x84b984b9,0x84b984b9,
-0x849884b9,0x84988498,0x84988498,0x84988498,0x84988498,0x84788498,0x84788478,0x84788478,0x74377437,0x6bf67437,0x63947436,0x9d7c8cfa,0x6bd563b5,0x4ad25b74,0x635329ce,0x5af3298c,0x53135b54,0x5b535b54,0x6bd673f6,0x74577417,0x63f65b55,0x7c78196c,0x6b934ab0,0x427029ad,0x53334af2,0x63954270,0x63b57417,0x63757c77,0x84787c57,0x8cb78c98,0x94d88cb8,0x9d1894f7,
-0xb578a538,0xcdf8c5b7,0xd639ce19,0xce18d638,0xde39d658,0xd618d618,0xde39d638,0xe659de58,0xe678e678,0xe698e678,0xeed8e698,0xfef9e677,0xff1af6fa,0xee97ff1a,0xeeb7e678,0x4943e658,0xbd1230e1,0x50c12880,0xff79bc0d,0xddf4ff3b,0x49a81820,0x30c02060,0xbd10cd74,0x28606a03,0x9bed3000,0xfed9f6ba,0xff3af6b5,0xff9cff7a,0xffdaff7d,0x82ebcd71,0x5a2840a0,0x94549433,
-0x9cf68c74,0x83b03146,0x52072081,0x208020a1,0x08001840,0x522849e7,0x10002081,0x10000800,0x31021860,0x290041a4,0x5a8962c7,0x394218a1,0x10801880,0x18c020e1,0x31638c2e,0x39c2b553,0x20c02900,0x41a241c3,0x28c062c7,0x59a0ded8,0xffbe9c0d,0xbdd2ce18,0xbcf19c4b,0x28a0cdd0,0xd67562c1,0x49a06b86,0x8b039b66,0x524059e0,0x5a8162a1,0xcd0d93c6,0xffbbc485,0x8ae28b22,
-0x28e79434,0x8cd873d4,0x94d894b7,0x8c9794d8,0x8cb894d8,0x73f48476,0x8c958476,0x83f37bf3,0x5aad8c54,0x6331420b,0x4a705af0,0x63945b11,0x6bf65b94,0x84987437,0x73f68498,0x84776bb6,0x6373298c,0x53325311,0x6bf55312,0x74577457,0x84b97c78,0x84b984b9,0x84b984b9,0x84998cb9,0x849984b9,0x849984b9,0x84998499,0x84b98498,0x84988499,0x84998499,0x84788499,0x849884b8,
-0x84988498,0x84988498,0x7c988498,0x847884b8,0x7c788498,0x7c788499,0x7c787c98,0x7c787c78,0x6bf67437,0x5b7463b6,0x5b545334,0x74375b54,0x63b57416,0x4af24ad1,0x63526393,0x6b7531ed,0x4af26394,0x5b544291,0x63956396,0x74377436,0x6bf66395,0x7c77324f,0x83d6294b,0x5b1273f5,0x21ac5b32,0x74164ad1,0x6bd47c56,0x6bf77c56,0x74176bf6,0x8c988498,0x94d894b8,0xad589cf8,
-0xbdb8ad78,0xce19c5d9,0xde59d659,0xde39de59,0xde58de79,0xd638de38,0xde59d638,0xde58de58,0xe678de58,0xeeb8e698,0xe699de57,0xf697eeb9,0xf719f719,0xee97eed8,0xe5f5e656,0xbd32c552,0x82e89c2e,0x1000ac4d,0xee9748a2,0x4983ff7b,0xad335207,0xc5934962,0xac6ede78,0xee37ac6e,0xff7a48c1,0xcd30d46d,0xdd2dbc67,0x3963f71a,0xabc9ffdf,0x28a0c46c,0x8b6e1820,0x8c12d67b,
-0xdebc94d5,0x49c62905,0x5a681860,0x186120a1,0x08001040,0x31231881,0x08001881,0x102020c2,0x20a020a0,0x52472901,0x8c0e5287,0x29224a06,0x10601060,0x18801880,0x526820e2,0x3161942f,0x41a228e0,0x39413961,0x62443100,0xb46ef695,0x82a5a4ae,0xffbbe6d9,0xff38bd09,0xa4ac4140,0xd6979d2f,0xb50bdeb6,0x9ba5ac29,0xa4f06a81,0x7b87c675,0xee527a80,0xdc88d4a6,0x5960e50a,
-0x5acea517,0x94f88c75,0x9d1994d8,0x94d89519,0x9d1994f9,0x84358456,0x84358476,0x73927bd4,0x73727372,0x424d4a4c,0x73b36351,0x7c5673f4,0x6bf56bf6,0x84787457,0x7c378478,0x7c166bf5,0x4a907c16,0x53127c77,0x5b745313,0x74377437,0x84b97c78,0x84b984b9,0x8cb98499,0x84998499,0x84998499,0x84998499,0x84b98499,0x84998499,0x84998499,0x84998499,0x84988499,0x84988498,
-0x84788498,0x84988498,0x7c987c98,0x84787c98,0x84788478,0x7c788478,0x7c787c98,0x7c787c78,0x6bd57457,0x74577c77,0x6bf66bf6,0x53136bd5,0x63b47436,0x63b56c15,0x08885b32,0x73d4426f,0x5b536bd5,0x53334ad2,0x74165334,0x74377457,0x74377417,0x63947436,0x10e96394,0x29cc6393,0x3a30320e,0x52f252f2,0x5b3373f6,0x63967c57,0x84787c57,0x8c988498,0x94d88c97,0xc5daad38,
-0xcdd8c5f9,0xd638ce18,0xe6bade99,0xe699e6ba,0xde79e699,0xde58de58,0xde59de58,0xe678e678,0xe678e678,0xeeb8e698,0xee77e698,0xe5f5d5d5,0xfef9ff19,0xd591f6b8,0xbc4dc4cf,0x82e8d531,0x7286c4ef,0x6a866aeb,0x8a479c0f,0x6aa98205,0xee96eeb8,0xb5115182,0xde57f6b9,0xf6d8cdb4,0xff7afed9,0xe5b2e551,0xb592fffd,0xfffffffd,0xbba9fe32,0xdf1b7bad,0x940e49a4,0xad14de37,
-0xad35debc,0x0800f73c,0x41e62080,0x00009450,0x18a162ea,0x29031881,0x18601060,0x29020820,0x4a051880,0x52691880,0x52677c0e,0x20c13182,0x10601060,0x39a520c2,0x5a8849c5,0x41a362a7,0x208028c0,0x28e01840,0x9baa30e0,0xc52fb3e9,0x940cef7e,0x9bcbde57,0xedb0ff59,0xfffebc28,0xef3dffdf,0xc56de6f7,0x6222e62f,0xfffdfffa,0xc5d2f7fd,0xfe106a20,0x51807240,0x51a07221,
-0x8c768414,0x84966b30,0x8cb78476,0x8c7794d8,0x8c988458,0x94f88457,0x8c568cd8,0x74148435,0x52ad6b92,0x4a4d7371,0x6bd35b0f,0x3a4e5af0,0x7c576bd5,0x8cb98499,0x8cb88498,0x6bd58499,0x6bf46bf5,0x6bd56bd5,0x63956393,0x7c786bf6,0x849984b9,0x84b98499,0x849984b9,0x84998499,0x84998499,0x84998499,0x84b984b9,0x7c9884b9,0x84998498,0x84788499,0x84788478,0x84788499,
-0x84988478,0x84988498,0x84987c78,0x7c787c98,0x84787c78,0x7c787c78,0x7c787c78,0x7c787c78,0x6bf77458,0x7c987437,0x63746bd5,0x7c37322f,0x6bb56bd5,0x218c5312,0x3a4f5331,0x31ee320e,0x7c776c15,0x63b45b53,0x5b755b55,0x74377418,0x74377457,0x6c157456,0x322e42b0,0x39ec7c35,0x52d29d59,0x5b335b74,0x53136bd6,0x63b55333,0x84787417,0x8c978478,0x9cf894b7,0xd639bdb8,
-0xd638d639,0xde79ce38,0xf6faee99,0xeed9f6fa,0xe679e699,0xde58e679,0xe678de58,0xde58e678,0xe677e677,0xeed9e678,0xe656de57,0xdebacdf3,0xf6f8e636,0xc511e655,0x9c0bbcd2,0x51419b8a,0x838c59e4,0x9beccdb4,0xeeb9cc8e,0xbd335a26,0x41615183,0xddd551a4,0xc554ff5c,0xac2cb4ef,0x49633944,0xfffd71e3,0xffffff5c,0xd42cd3ea,0x8bedad32,0xff37ffff,0x6ae81800,0x0800e658,
-0x736cb554,0x10613965,0x396420e2,0x52691860,0x20c34a07,0x10401040,0x08000000,0x20c10800,0x10201840,0x8c4f28e1,0x29019490,0x084018a1,0x106120c1,0x10001881,0x7b0962a8,0x18405183,0x9c8e8c2f,0x52054a25,0x392020a0,0xf71b4120,0xfffdffff,0xe52dff38,0xff5f5160,0xff7ab44a,0xfffefffe,0xb529ff9d,0xc614ce12,0xffdefe91,0xef3dffff,0x6a2059e0,0x59c04920,0x51c051c1,
-0x9cf78455,0x84358c54,0x84549d17,0x73d48c76,0x84788436,0x8cb88457,0x94b88cb8,0x73d48436,0x63107bf4,0x526d528e,0x63512969,0x424e6b93,0x74575b94,0x8cd97c78,0x84b88498,0x74178478,0x7c567c58,0x53325b53,0x7c785b95,0x7c587417,0x84998498,0x84b98499,0x84998499,0x84998499,0x84b98499,0x84988498,0x84998499,0x84988498,0x84998499,0x84788498,0x84988478,0x84788499,
-0x84988498,0x84788498,0x7c787c98,0x7c788499,0x84787c78,0x7c787c78,0x7c587c78,0x7c587c58,0x5b547c58,0x5b964af3,0x63946bb5,0x63945b53,0x63947c77,0x3a6f5b53,0x84987c76,0x53129d5b,0x4af33a51,0x63b55333,0x63b55b54,0x74377437,0x63b66c16,0x324f42b1,0x63b5324f,0x31ec0004,0x5b3329ac,0x63746394,0x4ad26c17,0x74575b54,0x84577c78,0x8cb88478,0x9cf894d8,0xd65ac5d9,
-0xd658d639,0xeed9de99,0xff3bf6d9,0xf6faf71b,0xe699eeb9,0xde58e679,0xde58de58,0xe678e678,0xcd94e678,0xd5b3bcb0,0xe616ddf4,0xc4cec490,0xc44e7ae8,0xcd54c4f1,0xac6ec532,0x6204938b,0xe699d5d5,0xac6ea42c,0xb46e93cd,0xa3ecbccf,0x49012840,0xeef75a05,0xffbbeeb7,0x18007aa8,0x29031040,0x28000840,0x732b5a64,0xbd92fffa,0xa428ffff,0xff7cffff,0xe6d84920,0xd6369c4f,
-0x1860bd33,0x292320a2,0x18811881,0x62ca0800,0x290418a2,0x10600800,0x08000861,0x29220800,0x28c11840,0x8bad49c4,0x186030e2,0x08000800,0x10400800,0x39641881,0x39223963,0x18203902,0x412093ad,0x834959c4,0x39223100,0xffff2800,0xfffefffe,0xf6b7bc2e,0xc48af633,0xf7dfabc8,0xffffffff,0xe6dbffde,0xed6ed632,0xe696ff7b,0xffdcf7ff,0x40c05140,0x518051a0,0x8b684120,
-0x9cf773b2,0x314a8c74,0x8413a4f7,0x6b72424c,0x7c166b93,0x84587c16,0x84788c99,0x845794f9,0x73937bf5,0x528e6b51,0x4a6e6b30,0x63735b11,0x6bf563b4,0x84786bf6,0x847884b8,0x6bd77417,0x73f68499,0x7c776393,0x63b56bd6,0x63b563d5,0x84997437,0x84b98499,0x84998499,0x84998499,0x84788499,0x84988498,0x84998499,0x84988498,0x7c788499,0x84998498,0x84988478,0x84788499,
-0x84988498,0x84788498,0x7c587c98,0x7c787c78,0x84787c78,0x7c787c78,0x7c587c78,0x7c587c58,0x5b757438,0x5b946c36,0x4ab16394,0x53136394,0x6bd573f5,0x320e5b33,0x5b53320d,0x429021ad,0x63d45b73,0x53135b54,0x53335312,0x7c587c57,0x42b37437,0x5b9563d6,0x42915b95,0x4a6f320c,0x6bd4296c,0x53325332,0x74175334,0x7c787438,0x7c377437,0x84978478,0x9cf89d39,0xde7abd98,
-0xe6dad639,0xf71ae6fa,0xff5bff3a,0xf6faf71b,0xe699eeb9,0xde58e679,0xe679de58,0xd616e678,0xde57de16,0xde37de37,0xe656d616,0xee58e696,0xc590cd75,0xcd55de15,0xa40e8308,0x6a666a66,0x9b8bb40c,0xa44fbd94,0xd5d559a3,0xc572de36,0x314228e1,0x5121ff39,0xedd38287,0x5b0aff19,0xbdb0be35,0xf7bbfe95,0xf7dafefa,0xffbba2c6,0xccabffbc,0xfffcffde,0xe6faff35,0xd61593ed,
-0x10005163,0x2923ffbe,0x08001040,0x08000800,0x62cb0000,0x08400820,0x20c339a6,0x28e218a2,0x20a11861,0x18602080,0x10001860,0x08000800,0x08000800,0x20801040,0x206020a0,0x286041a4,0x30e0c573,0x28a05a65,0x39008349,0x89c03880,0xeceaf7ff,0xa2a0a9e0,0xabc1cc0c,0xedadfe2f,0xff59ffbb,0xf677ff39,0xffffd50a,0xc365ee39,0xffdeffff,0x59a06a21,0x49a14140,0x38e05a03,
-0x9d197bf5,0x9cb68415,0x318b9493,0x6bb352d0,0x7c156b72,0x74368457,0x8cb88cd9,0x8cb98cf9,0x74148c98,0x4a2d6331,0x422c6310,0x53115aef,0x6bb563b5,0x7c586bd6,0x84788498,0x7c588498,0x7c786bd6,0x5b9463b5,0x6bd67417,0x639563b6,0x743863b5,0x84988499,0x84997c98,0x84998499,0x84788498,0x84998499,0x84788498,0x84998499,0x84788498,0x84788478,0x7c788478,0x84788478,
-0x84787c78,0x84788478,0x7c787c78,0x7c587c78,0x7c787c78,0x7c587c78,0x7c587c58,0x7c587c58,0x7c787457,0x7c586bf6,0x4ad15354,0x5b53216b,0x63d552f2,0x5b74196c,0x6bf64af1,0x53332a0e,0x63b56374,0x6bd67437,0x53344af3,0x63d65b54,0x6bf67c57,0x741663b5,0x5b535333,0x00885b53,0x424f29cc,0x52f24291,0x74167437,0x74377c57,0x7c577457,0x8c977c78,0xa5189d18,0xeebbb537,
-0xf73bf73c,0xf6faf71b,0xff1af71b,0xf6daf6fa,0xe699eeb9,0xde58e679,0xde58de58,0xd5d6e638,0xe658d5f6,0xe657e637,0xe636ddf6,0xeed8ddf5,0xde35cd94,0x8b0a72c7,0x62267ac8,0xac6f6a67,0xf6f8834a,0xb44d3840,0xcdd68bcc,0xe5b1a42d,0x312230e2,0xff19ff9d,0xb44fc572,0xff3ade78,0xf6b7c4ae,0x49c2ff5f,0xee12f7f9,0xfffafff9,0x81e0ffbc,0xffddffff,0xfffcff9e,0x9aa6ff1a,
-0x00001020,0x41e6b4b0,0x00000800,0x10400800,0x7b8d0820,0xb5551041,0x41c6ad14,0x18403123,0x18601860,0x20a11040,0x00000800,0x08000000,0x29030800,0x10401040,0x18401840,0x72e962a9,0xf73a20c1,0x28a030a0,0x598030c0,0xab845980,0x92e5ff5a,0x308061a0,0x61c161c0,0xecec89c0,0xfe95fbc0,0xabc6feb4,0xfef8fffe,0xefffffbb,0xfffced95,0x41c1fe77,0x6aa45a23,0x7b635a25,
-0x84767c35,0xa5386b92,0x9d1741cb,0x73b36bb3,0x6bb37c15,0x74166353,0x84b87c77,0x8cf98cd8,0x84d78cd8,0x73926b73,0x63105ace,0x73f45b30,0x6bd563b4,0x6bf673f6,0x8cb98499,0x849984b9,0x6bd67c58,0x63b56bd6,0x5b947457,0x63957417,0x7c797437,0x7c987c79,0x7c988499,0x84988498,0x84788498,0x84788498,0x84788498,0x84988498,0x84788498,0x84788478,0x84788478,0x84788478,
-0x84788478,0x7c788478,0x7c787c78,0x7c787c78,0x7c787c78,0x7c587c58,0x7c577c78,0x7c587c57,0x74377457,0x74377437,0x6bd55b74,0x4af152f1,0x3a7052f2,0x5b735333,0x63d57416,0x4af26bd6,0x5b5352f2,0x74367436,0x6bd67458,0x63956395,0x5b747436,0x5b546395,0x63955313,0x29cc5b52,0x298c5b31,0x6bd66bb5,0x63946394,0x7c587436,0x7c576bf6,0x84567c37,0xa4f894b7,0xeedbbd98,
-0xf71af71b,0xf71bf6fa,0xf6f9f71b,0xeeb9f6d9,0xe679eeb9,0xde58e678,0xde58de58,0xe638de37,0xde17e678,0xd594e636,0xd615e5f6,0xe636cd53,0xbcf1bcd1,0xacb0de58,0x30a049a4,0xbd126ac9,0x3060a3eb,0x18603921,0x08004901,0x61e61000,0xddd41000,0xff7af77b,0x50c2a46d,0xc531eefa,0xfef9b3eb,0xffbef7fe,0xe4cd8982,0xdc053820,0xabeaff38,0xc531ffff,0xe5d3ffff,0x30a1fffd,
-0x00001020,0x29035a68,0x00000800,0x29242923,0x524920c2,0x5a491862,0x10405228,0x18401020,0x31645268,0x08200820,0x00000820,0x00000000,0x08000820,0x08001040,0x28e11020,0x39421880,0x6a035a44,0x6ac84980,0x492059c2,0xf7fe5160,0xce13f7fe,0x28407286,0xc5312840,0x720161c1,0x91a048a0,0xf4c8b2c0,0xde55fffe,0xffbdffff,0xfffefeb4,0xff796100,0x72e49c4b,0xcdd25203,
-0x84554a8e,0x52d073b3,0x4a4d6b31,0x73b36310,0x8c978476,0x7c167c37,0x8cb88477,0x8cb884b8,0x84988cb8,0x7c157c15,0x63306b92,0x6b934a6e,0x6bb46373,0x7c786bd6,0x7c987c98,0x847884b9,0x6bb57c58,0x74177458,0x7c387c58,0x6bf763b6,0x84987c78,0x7c788498,0x84998498,0x84988498,0x84997c78,0x84988499,0x7c787c78,0x84988498,0x7c788478,0x7c787c78,0x84787c78,0x84788478,
-0x7c787c78,0x84787c58,0x7c787c78,0x7c787c78,0x7c587c58,0x74577c57,0x7c787c58,0x7c577c57,0x74377c57,0x63f67458,0x42d163d5,0x42b163d5,0x63b55b74,0x6bd53a70,0x63946bd5,0x639542b1,0x4ad24291,0x5b945312,0x74167416,0x63b57416,0x5bb47416,0x7c775332,0x5b756395,0x5b9242d0,0x84760887,0x7c1673f5,0x7c367c15,0x741673d5,0x7c376bd5,0x7c375b53,0x9cf78456,0xeefbde5a,
-0xf6faf6fa,0xf71bf71b,0xf6baf6fa,0xee99eeb9,0xe658ee79,0xde17de58,0xde18de17,0xe678d5f6,0xcdb5c574,0xc512b48f,0xe657de17,0xd5f5d5d5,0xd5f6e697,0xbd12bd33,0x3943838c,0xde154964,0x61c54943,0xee97bcef,0x2060f6d7,0x59e54102,0xd5f51000,0x7ac6ee77,0x938cddf6,0xa44efef8,0xffffff9b,0xfeb7e592,0x83a993aa,0x7a437bab,0xffffffd9,0xe671ffdf,0xd3c6f7de,0x18003840,
-0x08200800,0x08201060,0x00000000,0x29031081,0x10201020,0x940f1000,0x10003923,0x08001040,0x10403963,0x08200000,0x00000000,0x00000000,0x08000840,0x00001061,0x18601060,0x20a020c0,0x72c58b6a,0x8bab8baa,0x51a16a63,0xe71a4080,0xfffcffff,0x9348fef8,0xac0ccd2f,0xfe9640c0,0xc4abcced,0x92a169a0,0xff56a2a3,0x8a62ec04,0x6860ff59,0xa42b6221,0xee31f6d7,0xd449d4f0,
-0x4a6c10a5,0x94d84a6e,0x7bd37bd3,0x84548413,0x5b326bb2,0x84777c37,0x8cd88c98,0x84b884b8,0x8cb88477,0x845773f6,0x7c1573d5,0x39ed73b3,0x7c5773f5,0x84997417,0x7c787437,0x84787c78,0x7c588478,0x84996bf7,0x84988478,0x63b67c58,0x7c787438,0x84987c78,0x7c988498,0x84988498,0x84987c78,0x84788478,0x7c787c78,0x84788478,0x7c988478,0x7c787c78,0x84787c78,0x84788478,
-0x7c787c78,0x7c587c58,0x7c787c78,0x7c587c78,0x7c577c58,0x7c577c58,0x7c577437,0x7c577c57,0x74377c57,0x63b67437,0x4b1363b6,0x6bd56c17,0x63d563b5,0x63945354,0x74376bd5,0x4af25b94,0x320f5b54,0x533442b2,0x32505354,0x6bf75b95,0x7cb95374,0x196d42b1,0x5b536bf6,0x00044af1,0x3a0d4a90,0x73b46332,0x6bb47c15,0x4ad16354,0x63946394,0x6bb57416,0x94b68c76,0xeebad5d8,
-0xf71beeda,0xff3bff5c,0xeeb9f6fa,0xe678ee99,0xde58e658,0xde17de38,0xddf7ddf7,0xcd95d5d6,0xd5d6de17,0xd5f6bd12,0xd5d5d617,0xc593d5d5,0x93adde36,0x832b9bee,0xacd1f6fa,0x9c2d8b8c,0xac4fe677,0xcceeff79,0xff39ee76,0x30e2a40d,0xfed90800,0x2880c572,0xe5d2eed9,0xc532ff18,0xff18a3cc,0x7a86feb7,0xffb7f79c,0x7b07ef59,0xef9b71c0,0xffbcfed6,0x8228ec6c,0x108130a2,
-0x0000738c,0x00001882,0x08400000,0x28e339c5,0x28e21861,0x20a128c1,0x08001820,0x10400800,0x08000800,0x00000000,0x00000000,0x00000000,0x08000000,0x10400800,0x10200800,0xcdd418a0,0x414028a0,0xac6c3900,0xfef7e654,0xffffbc4a,0xfd2bf674,0x61e2bc4b,0x594048c0,0x620093a9,0xf6528aa4,0x51815160,0xa347c3e8,0x71a069e0,0x598260e0,0xee737243,0xff9addeb,0x59c0d58e,
-0x2084a4b4,0x7c3573d4,0x73f494d7,0x7c144a8d,0x8c975aef,0x7c358435,0x73f67c56,0x6bd67416,0x6bd673f6,0x73f67c36,0x73f673d5,0x6bb27c37,0x6bf55ad1,0x6bd66bf5,0x6bf67c38,0x7c787c58,0x74177c78,0x84787c58,0x7c788498,0x6bf77c79,0x7c787c98,0x7c787c78,0x84997c78,0x7c788498,0x7c987c78,0x84788478,0x7c787c78,0x7c787c78,0x7c787c78,0x7c587c78,0x7c787c98,0x7c787c78,
-0x7c787c78,0x7c587c78,0x7c587c58,0x7c577c58,0x7c577c58,0x7c587c57,0x74587437,0x7c587458,0x74377457,0x63d67437,0x4af363d6,0x74376c17,0x63d64b54,0x4af263b6,0x63955313,0x53134af2,0x5b536374,0x4af342b1,0x53135b54,0x6c1763b5,0x63b54b12,0x4ad36bf6,0x21cf3a90,0x112b5333,0x31ee73f6,0x52cf0026,0x7c13a558,0x7c375b52,0x7c3773f4,0x73f67c16,0x94b78c77,0xe638bd37,
-0xff3beeb9,0xff7cffde,0xee99f71a,0xe658e678,0xde38de38,0xd617d617,0xcd95d617,0xde17d5f6,0xc554d5f6,0xd5f6c574,0xd5f6de37,0xcdd5de17,0xcd94c533,0xacb0c533,0x836cde37,0x7b4a5a06,0xd5b2a4af,0xccedff17,0xff9ab4f1,0x1020bd11,0xb44c38a2,0x2880e6b8,0xa3284121,0xff7ae615,0xdd2deef9,0xe5b1ffff,0xff36ffbc,0xcd91fffe,0xfffdef59,0xd573fffb,0x30e29ae7,0x6aeaffff,
-0x08000820,0x10600820,0x3184630b,0x39a52902,0x18000800,0x28a030c2,0x10001860,0x20e22923,0x00000000,0x00000000,0x00000000,0x08200000,0x00000800,0x10400000,0x10400800,0x7ae71880,0x100093ec,0x51603100,0x61c2d550,0xf6f7ff1b,0x6180d54f,0x30a05140,0x6a2451a1,0x38e03100,0x30804120,0x51c04100,0x724161a2,0x308069c2,0xddd04940,0xff3759e0,0xfdae9aa1,0x30e071e0,
-0x39a962cf,0x73f418c5,0x5af15af1,0x7c1473b3,0x7c158c76,0x4a8f6bb3,0x7c3673f4,0x7c776bb4,0x8cb97c57,0x7c378477,0x6bb57c16,0x84567c56,0x7c3539eb,0x63745b73,0x74377416,0x74377c58,0x7c787c78,0x7c587c58,0x74577457,0x6bd663b6,0x7c787c78,0x7c787c78,0x7c787c78,0x7c787c78,0x7c787c78,0x7c788478,0x7c987c78,0x7c787c78,0x7c787c78,0x7c787c78,0x7c787c78,0x7c787c78,
-0x7c587c78,0x7c587c58,0x7c577c58,0x7c577c57,0x7c577c58,0x7c577c57,0x7c587c57,0x74387c58,0x74377c57,0x74376c37,0x6c175b74,0x6bf66c17,0x6c1763d7,0x5b546bf6,0x4af26bf6,0x3a504ad1,0x63945b33,0x4af35334,0x6bd65333,0x5b7563b6,0x5b746c16,0x008a5b74,0x5b345b73,0x21ad5b74,0x10ea6bf6,0x7bd46b93,0x4a6e8c55,0x7c154270,0x73f57c34,0x7c576373,0x9cd88c97,0xcdb8ad17,
-0xff1be5f8,0xff7cff9d,0xe678f719,0xde38e658,0xd617de17,0xd5f7d5f7,0xd5f7d5f7,0xd5f6cdd6,0xc594d617,0xde37cdb5,0xde37d617,0xde37de17,0xbcf2c533,0xc553c553,0xf6fa7b2a,0xbcf093cd,0xcdf56a24,0x93abedf2,0xa3ccff7c,0x182030c0,0xb46fc4f2,0x4161f71a,0x61c5e677,0xf73acd52,0xf673ff3a,0xfffbfffd,0xfffdfffe,0xbccdffff,0xf7dcffff,0xc5b3d5b1,0xeefb30c1,0x31221860,
-0x00000800,0x20e20800,0x2902d616,0x31443964,0x10000800,0x20a11840,0x10200800,0x18a10820,0x08410000,0x00000000,0x00000000,0x08000000,0x08400820,0x08000840,0x08200800,0x30e02080,0x836aa44e,0x20803901,0x8b8a30c0,0xde335140,0xa32850a0,0x414059c2,0x18404161,0x290020c0,0x29604a01,0x7ae66a63,0x61a0a44a,0x30803081,0x59e32040,0x61c159a0,0x59605980,0x41a16202,
-0x0868296c,0x10c741e8,0x8cb89d7b,0x94b78c77,0x6b936b72,0x845673b4,0x84558c76,0x73d46351,0x84367c15,0x84587c17,0x84778477,0x73d46374,0x318a6b52,0x6bb4296a,0x63b65b33,0x7c787457,0x7c577c78,0x7c377437,0x6bd67c37,0x63955b75,0x7c787c79,0x7c587c58,0x7c787c79,0x7c787c78,0x7c987c98,0x7c787c78,0x7c787c78,0x7c787c78,0x7c787c78,0x7c787c78,0x7c587c78,0x7c587c58,
-0x7c587c78,0x7c587c58,0x74377c57,0x74377437,0x74387437,0x74377438,0x74377457,0x74377437,0x74377438,0x6c177437,0x6bd66bd6,0x74177417,0x74177417,0x63b66bf7,0x3a905b74,0x53334af2,0x53344291,0x533463b6,0x63956bd6,0x6bf65b74,0x63d46bf6,0x194b6bd5,0x6bb473f5,0x7c5763b4,0x63946374,0x84566332,0x63326b72,0x3a2e5b53,0x8c955b12,0x7bd48c16,0x94d673b2,0xb578b557,
-0xd577bd58,0xff3bf6ba,0xe699f71a,0xd618de59,0xd5d7d5f7,0xd5f7cdd6,0xd5f7d5f7,0xcdd6d5f7,0xde17cdb6,0xd617cdd6,0xde37d5f7,0xe658c554,0xc554bd13,0xa42ec554,0xa42fc512,0x8b29b48e,0xf71ac5b5,0xe5f6a3ca,0x9c0e4982,0x20008ac7,0x598169e4,0xce79fef8,0xf617eedb,0xff37e6f9,0xfef8ff7a,0xffffff99,0xfffffffe,0x50c0fffe,0xef97f7ff,0xff15ff1c,0xfef82100,0x10206ac9,
-0x00000000,0x41a50840,0x732b30e3,0x0000c5b5,0x08200800,0x20e20820,0x08001060,0x00000000,0x00000000,0x00000000,0x00000800,0x08200840,0x10401040,0x10610800,0x18a018c1,0x28801000,0x7b265981,0x2000c4ef,0xf738c5b3,0xef9dccd0,0x62858283,0x310051a3,0x3a0418c0,0x7baa954f,0xffb8add3,0x8ac8a4ad,0x1020f650,0x7265ef5c,0x49606a45,0x41203900,0x39003900,0x39614181,
-0x9d398c97,0x526c8496,0x8c9710c7,0x8cb78457,0x63318455,0x7c158456,0x6b7273d4,0x633273f4,0x63526332,0x6b945b12,0x73d57c37,0x73d46394,0x52cf6b52,0x63725acf,0x5354218c,0x6bf66bf6,0x74586bf6,0x73f68478,0x639573f5,0x5b755354,0x7c587437,0x74377437,0x7c787c79,0x7c787c78,0x7c787c98,0x7c987c78,0x7c787c78,0x7c787c78,0x7c787c78,0x7c787c78,0x7c587c78,0x7c587c58,
-0x7c787457,0x7c587c58,0x74377c57,0x74377437,0x74387437,0x74377417,0x74377457,0x74377437,0x74377438,0x74377437,0x6bf66bf6,0x74177417,0x74177417,0x6c177417,0x5b7463b5,0x53135333,0x5b545b74,0x74175354,0x74176bf6,0x74176395,0x32306bd6,0x110a112c,0x4ad15312,0x84785b33,0x5b535b73,0x52d031cc,0x7bf56b31,0x63535b33,0x6b724ab0,0x94967bb3,0xad379495,0xb578b557,
-0xcd77b537,0xff1be658,0xe678eefa,0xd5f7d618,0xcdb6cdd6,0xcdb6cdd6,0xcdb6cdb6,0xcdb6cd96,0xd5f7cdb6,0xd617d617,0xde17d5f7,0xe658e658,0xcd95d5d6,0xa40ecd95,0x9bedac4f,0xb512cdd5,0xff7bee14,0xbcd1de57,0x30e2abca,0x10006a88,0xa326bd32,0xffddbc8e,0xac6bfffe,0xc50feef9,0xfffdf675,0xffffffff,0xfffffeb6,0xff7aff56,0xfffff7ff,0x4000fe52,0x2060fdd6,0x080020a1,
-0x00200000,0x9c702104,0x10205207,0x29043164,0x4a070000,0x00001061,0x00000800,0x00000000,0x00000000,0x00000000,0x29440800,0x08002123,0x10400820,0x08200800,0xffff1860,0x38e051e5,0x49e44981,0x82a75a03,0xf677f613,0xff9bcc8a,0xc5d3ac4c,0x52a43980,0xef9cef9b,0xefbbef3f,0x8180dc0b,0x38c069c0,0xfffc38a0,0x6a62fef5,0x4a02cdb1,0x30e13101,0x394028e0,0x41a23120,
-0x8cda8cd9,0x9d189d1a,0x298a3146,0x8c766332,0x73938475,0x6b726b52,0x73f473f4,0x422e8476,0x63525b32,0x63936b93,0x7c166b94,0x6b937c57,0x4a6d7bf4,0x52f052ae,0x5b93320d,0x4ad36395,0x4ab33210,0x63945311,0x6bb563b4,0x639563b5,0x7c587437,0x74176bd5,0x74386bf6,0x7c587c79,0x7c787c78,0x7c787c78,0x7c787c78,0x7c787c78,0x7c787c58,0x7c787c58,0x7c587c78,0x7c577c57,
-0x7c577c58,0x7c577c58,0x74377c57,0x74377437,0x74387437,0x74377438,0x74377437,0x74177437,0x74177438,0x6c377458,0x7c587437,0x74177417,0x6c177417,0x63d67417,0x6bf66bf6,0x5b745b74,0x5b546bd6,0x5b545334,0x63956bf7,0x63966bd6,0x4af34272,0x29cd5b72,0x52f13a2e,0x5b533a70,0x63746bb5,0x52d03a0e,0x6b736311,0x63746bb5,0x52b06b94,0x9c968c34,0xb577a4d5,0xb557ad57,
-0xc577b558,0xf6faddd6,0xde58eeda,0xcdb6d5f7,0xcd96cdb6,0xcdb6cdb6,0xcdb6cdb6,0xcdb6cd96,0xd5f7cdd6,0xd617d617,0xcd95d5f7,0xde17de17,0xc554cdb5,0xb4afcd95,0xb4afb4af,0xe615c4f0,0xccd0d5b4,0xcd30ee16,0xbc6d8b4c,0x10001000,0x2800b4b0,0xbdd7de15,0xff1accf1,0xfef7ee76,0xfffeffdd,0xfffdffff,0xffffff39,0xffff4900,0xcd2cffff,0xf77b5902,0x00000840,0x00001040,
-0x00000000,0x10200820,0x104120a1,0x29040800,0x29030800,0x20e30000,0x00001080,0x00001061,0x00000000,0x00000000,0x10810800,0x62cb0860,0x0800736c,0x10400820,0xf71a28e2,0x30c128a2,0xbd97d614,0xc532944d,0xa3468ba9,0x898069c0,0xc4ce92e6,0xbd51d592,0xf6f9deb8,0x89c3ffff,0x208148e0,0x18013060,0x8a651800,0x7b25b42b,0xe77ddeba,0x8c2c73a9,0x31412901,0x39613120,
-0x9d199d19,0x8c9794d8,0x18c69d17,0x4a8e1967,0x83f45b11,0x73b35af0,0x6b726351,0x84568c97,0x63525b32,0x635373d5,0x73d56b94,0x5b336b94,0x73b35b12,0x422d4a8e,0x6bd552f1,0x7c577416,0x74166bd5,0x3a2e7c35,0x5b334290,0x63b56bd5,0x74177c57,0x6bf76bd6,0x7c787437,0x7c787c78,0x7c787c78,0x7c787c79,0x7c787c78,0x7c587c58,0x7c587c58,0x7c587c58,0x7c787c58,0x7c587c58,
-0x7c577c58,0x7c577c58,0x74377437,0x74377437,0x74387437,0x74377438,0x74387437,0x74387438,0x74177438,0x74177437,0x74177438,0x74177417,0x74177417,0x53336bf7,0x63b55354,0x63d65b74,0x53545b74,0x5b745b95,0x63b66bf7,0x63b66395,0x5b545b75,0x63734af1,0x52f14ab0,0x52f2110a,0x5b744291,0x4ad129ce,0x63726373,0x7bf57c36,0x6bb38456,0xbd7783d3,0xbd77bdb8,0xb577b577,
-0xbd77b578,0xee98cd97,0xde38f6ba,0xcdb7d5d7,0xc597c5b6,0xc596c597,0xc596c596,0xcdb6cd96,0xcdb6cdd6,0xcdd6d5d6,0xd5f6cdd6,0xcdb5de37,0xc573d5d6,0xa44fb4b1,0xc532b552,0xee97b46f,0xddf5eeb9,0xe677bcaf,0xcdb258c0,0x08001020,0x9b27fef9,0xddf5ee96,0xddb240a0,0xff7bfdd1,0xff39fe96,0xfffffffd,0xfffdf73b,0xfffebca8,0xff99fffe,0x20002860,0x082072ca,0x00000020,
-0x00000000,0x00001061,0x08000800,0x08218c10,0x4a2918c3,0x5aa918c3,0x08200840,0x00000020,0x00000000,0x00000000,0x10610020,0x41e73965,0x186020a2,0x10201860,0x83ab1800,0x39212060,0x9b686a01,0x71c3b3ed,0x7aa47264,0x49402820,0x494059c0,0xab67bc2a,0xff17fed6,0x61407840,0x10401840,0x10201040,0x414028a1,0x59602860,0xefddffff,0xd6b5ff38,0x31213961,0x39613961,
-0x9d1994f9,0x94f994d8,0x7b906bb3,0x63512927,0x7c14214a,0x8c566b92,0x63505af0,0x4ab0422e,0x6b934ad0,0x63747c36,0x847873d5,0x637373d5,0x5b326353,0x52cf428e,0x42906bd3,0x7c377436,0x6bb573f6,0x63536b94,0x5b115af0,0x63934ad1,0x63b573f5,0x6bf66c16,0x7c587417,0x7c787c78,0x7c587c78,0x7c587c58,0x7c587c58,0x7c587c58,0x7c587c58,0x7c577c58,0x7c587c57,0x7c577c78,
-0x7c577c58,0x7c577457,0x74377437,0x74577437,0x74387437,0x74387438,0x74377458,0x74177437,0x74377417,0x74177437,0x74177417,0x74177417,0x74177417,0x63d663b6,0x5b745b74,0x5b7563b6,0x63b55333,0x5b954b13,0x741763b6,0x63b66bf6,0x5b745313,0x531042b0,0x4a8f5310,0x5b735332,0x32505b74,0x4ad142d1,0x6b937415,0x6b946b93,0x94968456,0xb576acd6,0xc5b7c5f8,0xad36b597,
-0xbd77b598,0xe658cd57,0xde38ee7a,0xcdb7d5d7,0xc596c596,0xc596c576,0xc596c596,0xcdb6c596,0xcdb6cdb6,0xd5f7cdd6,0xcdd6cd95,0xde17d617,0xbcb1d5d6,0xcdd6b4f2,0xc574de98,0xff19b4cf,0xbc2cdd73,0xcd51bcf2,0xffffc470,0x10004985,0xbceec553,0xfffeddd4,0xfe965983,0xef39cd0e,0xf698ee53,0xff58ff38,0xfffbf54f,0xffdc8b87,0x38a0ddd3,0x51e71000,0x00200800,0x00000000,
-0x00000000,0x18a25acb,0x00001000,0x18a41042,0x00011063,0x08833a09,0x08200000,0x00000000,0x00000000,0x18c30000,0x10401081,0x5a481020,0x3962cdd5,0x20802900,0x5a462080,0x9bec9c8f,0x49825a66,0xffbc4920,0xc5949cd0,0x51e249c2,0x51423900,0x72216a23,0x6960cc0c,0x188030a0,0x08201061,0x08200820,0x31012080,0xb450c551,0x92005000,0xfed76940,0x29409c0c,0x31203120,
-0x94f88cb8,0x73f58476,0x6b916332,0x2148630e,0x52f152f0,0x6352424e,0x52ae73d4,0x52d0630f,0x6b936b73,0x84577c16,0x6bd56394,0x52f16373,0x52f05312,0x5b525b32,0x6372426f,0x6b954270,0x6bb56b94,0x6bb46bb4,0x5b115b32,0x5b525b32,0x42b13a2e,0x63b563d5,0x7c586bf6,0x7c587437,0x7c587c58,0x7c587c58,0x7c587c58,0x7c587c58,0x7c587c58,0x7c587c58,0x7c577c58,0x7c577c57,
-0x7c577c57,0x74577c57,0x74387438,0x74387438,0x74387438,0x74377438,0x74387438,0x74177417,0x74177437,0x74177417,0x6c176c17,0x6bf76c17,0x6c176c17,0x6bf76bf7,0x6bf66bf6,0x63b56bf6,0x53545b95,0x6bd663b6,0x6bf76bf7,0x6bf66bf6,0x42d35b54,0x39ee5332,0x214a31eb,0x531242b1,0x7c166bb4,0x6bd563b4,0x6b946b94,0x84366b93,0x84148c76,0xce389c73,0xce58d679,0xad17bd98,
-0xb577bd77,0xd5f7c577,0xd638e658,0xcdb7cdd8,0xbd96c597,0xbd76bd96,0xbd76bd76,0xc5b6c595,0xcdb7cd96,0xcdb6cdb6,0xcdd6cdd7,0xcdb5d5f7,0xbd54b4f2,0xde77cdd6,0xcd53e678,0xd573c593,0x9ae861e3,0x6182ee36,0x83099bcd,0x2860ffff,0xd550c553,0xff18bc09,0xdd0fac2d,0xfffeff79,0xd429ff38,0xfef8f5b2,0xde9af56d,0xfe74a36a,0x1820ffbb,0x7b6d3144,0x31c60000,0x00000000,
-0x00000841,0x1082630c,0x10820000,0x73f31883,0xd6ff0001,0x42096370,0x00000000,0x00000000,0x00000000,0x18c20000,0x18a20840,0x49a42903,0x39635a05,0x312028e0,0xff3a3962,0x4a255287,0x844f49a5,0x9cb0bd75,0xbdd5ff9d,0x6ac482c9,0x392072c6,0x28406a21,0x41022800,0x18601860,0x08200800,0x10400820,0x210018a0,0x28a04122,0x30e02080,0x59e230c0,0x4a24fffd,0x41813120,
-0x8c977c15,0x63347c16,0x7bf673d6,0x4a8e7c36,0x6bb4420c,0x635273f5,0x6b726b94,0x52d06331,0x5b325b32,0x6b946373,0x73f56bb4,0x63946bf5,0x52f25332,0x637373f6,0x6b957415,0x31ce4a90,0x52f23a2f,0x63535b33,0x5af15b11,0x6bb46b93,0x52f2426f,0x5b544ab1,0x74387417,0x7c786bd6,0x7c587c79,0x7c587c58,0x7c787c58,0x7c587c58,0x7c587c58,0x7c587c58,0x7c577438,0x7c577c57,
-0x7c577c57,0x74377c57,0x74387438,0x74387438,0x74377437,0x74177437,0x74377417,0x74377417,0x74177417,0x74177417,0x6c176c17,0x74176c17,0x6bf76bf7,0x6bf76c17,0x6bf66bf6,0x63b56bf6,0x53555355,0x6bf66bf6,0x6bf66bf6,0x4af363b6,0x5b7563b5,0x52b15332,0x4a6e29aa,0x3a4f5b73,0x73f552f1,0x73b494d8,0x637173d2,0x5af1424f,0x8c758c55,0xcdf78bd1,0xde59e69a,0xb536c5d8,
-0xbd77bd77,0xcdb7bd57,0xd618e618,0xc5b7cdd8,0xbd76c597,0xbd76bd76,0xc576bd76,0xc576c576,0xcd96c576,0xcdb6c595,0xcdd6d5d7,0xd5d6d5f6,0xcd95cd95,0xe637d5f6,0xd636c574,0xd678cdf6,0xb4afacd1,0x61c4836c,0x3060ee78,0x1800de16,0x8ac4fef7,0xcd50cd51,0xee15ac4b,0xfef97100,0xff39f675,0xd5d4fed4,0xbc8ca42c,0xf654e530,0x08003000,0x41e80800,0x00201040,0x10810000,
-0x00000841,0x10615aab,0x10832945,0xce1952ac,0x8bae39a6,0x08403124,0x00000000,0x00000000,0x00200000,0x08410020,0x18a22924,0x940e62ca,0xc5b42080,0x20c028c0,0x69602040,0xfffdff18,0xfffeef5b,0x7ae6ef9d,0xff9df654,0xff9b7a60,0x518249a1,0x51606220,0x00201860,0x08200000,0x20c20840,0x18600820,0x18602921,0x10401880,0x29011060,0x30c028e0,0x69e2fe53,0x52013120,
-0x7c566bf4,0x73f57416,0x84578c98,0x84577c37,0x52b14a90,0x73f57c15,0x845573f5,0x4a907c35,0x73f57bf5,0x5b116332,0x63955332,0x74377416,0x5b546bd5,0x73f67416,0x52d16b95,0x4ab06b94,0x73f66b94,0x424f52f1,0x4a9052d1,0x3a2e424f,0x52d152f1,0x4ad152f1,0x5b955354,0x6bf75b95,0x7c587438,0x74587c58,0x7c587c58,0x7c587c58,0x7c587c58,0x7c587c58,0x7c587c58,0x74387438,
-0x74387438,0x74377438,0x74387437,0x74377417,0x74377437,0x74177437,0x74177437,0x74177417,0x74177417,0x74177417,0x74177417,0x6bf67417,0x6bf76bf7,0x6bf76bf7,0x6bf66c17,0x6bf66bf6,0x6bf663d6,0x6bf66bf7,0x63b66bd7,0x63b663b6,0x4af263b5,0x42b063b5,0x52f142b0,0x4b124290,0x7bf65b33,0x73938434,0x94d67c32,0x73b46352,0xad387393,0xbd56b556,0xde38de38,0xc5d8ce18,
-0xbd77bdb7,0xc577b557,0xd638d5f8,0xc5b7cdd7,0xbd77c597,0xbd56bd77,0xbd77bd56,0xbd76bd76,0xc576c576,0xc5b6c5b6,0xcdb6cdd7,0xd5d6d5d7,0xde17d5f6,0xc574d5b5,0xe616de16,0xee98e657,0x9c0cd616,0x7226c553,0x2820cd95,0x3082e5f7,0xd5d5ee12,0xef5ccd51,0xfffed656,0xfffdd5f5,0x1800dc67,0xffddef3b,0xde36fed5,0x50c0e4ef,0x0000bd54,0xa514526a,0x10c20820,0x41a61020,
-0x18c318c3,0x00003186,0xad3528e4,0x41c7c5f8,0x08000800,0x08000800,0x00000000,0x00000841,0x00000000,0x00200000,0x21030000,0x28a24a06,0x62676ac9,0x29007309,0x7ac64160,0xb4adaccf,0xb40ad615,0xff79f75b,0x9aa581a0,0xff1671e2,0x4180738a,0x20408b27,0x00200820,0x00000000,0x08200800,0x18800840,0x18802901,0x186020a0,0x18801880,0x41c12900,0x49c23920,0x4a013921,
-0x6b9452d0,0x7c776394,0x847773d5,0x73f57c36,0x52d08477,0x7c154a90,0x84977c15,0x4a8f6bb4,0x6b735af1,0x63326b73,0x741652f1,0x7c576bb5,0x5b746bb5,0x73f67c57,0x7c166b95,0x5b3252d1,0x4ab052d1,0x52f16353,0x637352d1,0x52f25b32,0x5b124a90,0x429052f1,0x5b9542d2,0x6c187438,0x7c587438,0x7c587c58,0x74387c58,0x74387438,0x7c587438,0x74587438,0x74387438,0x74387438,
-0x74387438,0x74377438,0x74377437,0x74387437,0x74177438,0x74177417,0x74177437,0x74177417,0x74177417,0x74177417,0x6bf76c17,0x6bf76bf7,0x6bf76bf7,0x6bf66c17,0x63f66bd6,0x63f663f6,0x6bf663f6,0x6bf66bd6,0x6bd66bf7,0x63d76bd7,0x5b7563f6,0x4ad15332,0x42b05312,0x4ad25b53,0x73d54ab1,0x62f18c76,0x94b683f4,0x6b529495,0xa5177c14,0xcdb8bd97,0xd638d618,0xce19d659,
-0xb577bdb7,0xbd77b577,0xde59d5f8,0xbd97cdd7,0xbd77c5b7,0xbd56bd77,0xb556b536,0xbd56bd76,0xbd76bd56,0xc596c596,0xcdb6c596,0xcdd6cd96,0xd5f6cdd6,0xd5f6e658,0xcd53ddf6,0xe657cdb4,0x8b6ad5f4,0x59a48b8c,0xacb11800,0x938b6a28,0xe636c530,0xcccda40c,0x8ac4ff99,0xe50efef7,0xef5bc5b4,0xff9bfe94,0xffdbff39,0x62077246,0x10613903,0x1061ffdf,0x5b2c0841,0x3a4dbe3c,
-0x08411082,0x000041c7,0xce18d659,0x41e739a6,0x00001081,0x00000000,0x00000000,0x00202104,0x00000000,0x10810000,0x292439c6,0x20401861,0x31a43164,0x526639c4,0x62e762e9,0xf718fffe,0xffdcefff,0x6940fed4,0x414059c1,0x59003920,0x724469a1,0x108028a0,0x00200840,0x00000000,0x08400820,0x18a01060,0x18602901,0x108018a0,0x08201060,0x292039a3,0x31403140,0x4a023140,
-0x631273b4,0x7c574ad1,0x7c368457,0x63737c16,0x84758457,0x4a8f3a0e,0x73d56373,0x7bf573f6,0x63327bf5,0x73d46b73,0x320e4ad1,0x74166bd5,0x6bb57c37,0x73f67c57,0x5b3273d6,0x5b325b12,0x63745b33,0x63736353,0x424f52f1,0x4a904a90,0x52d14ab0,0x5b326373,0x63b65333,0x74587459,0x7c587417,0x7c587c58,0x74387437,0x74387438,0x74377438,0x74587438,0x74387438,0x74387438,
-0x74387438,0x74377438,0x74377c58,0x74177437,0x74177417,0x74377417,0x6bf77417,0x74176bf7,0x74177417,0x74177417,0x6bf76c17,0x6bf76bf7,0x6bf76bf7,0x6bf66bf6,0x63f66bd6,0x63f663f6,0x6bf663f6,0x6bf66bd6,0x6bd66bf7,0x63b76bd7,0x63b563f6,0x52f363b4,0x5b336bb5,0x63b55b53,0x6b9473d6,0x62d27bf5,0x8c349c77,0x6b729c95,0x9cd6a537,0xc597b556,0xde58cdf7,0xce19d659,
-0xb577bdb7,0xbd56b537,0xd638cdd8,0xbd97cdd7,0xbd97c5b7,0xb536bd77,0xb556b515,0xbd56b556,0xbd55bd56,0xc596c596,0xcdb6c596,0xc595cd96,0xd5d6cdd6,0xcdd6d5d6,0xddb4d5d5,0xde36e657,0xde15c531,0x48e1de16,0xffbd1000,0xef3b3041,0xd552bc8d,0xffbbe6b9,0xff9ae638,0xbc2cb36a,0xfed7f73b,0xffdb5840,0x92c7ee13,0x72cc1800,0xdeba3902,0x528a9472,0x21259493,0xa5365aee,
-0x20e462eb,0x08000821,0x28c33166,0x18a21040,0x00002924,0x00000000,0x00200000,0x00000000,0x00000000,0x18e30000,0x210431a6,0x10811882,0xae158cf4,0xbd936bac,0xf7ffd6b7,0xffdbfffe,0xa42cffdc,0x9c0eab03,0x5a057225,0x316138c1,0x20a04940,0x10001081,0x00000020,0x08200000,0x10801060,0x18a00840,0x104041e4,0x10a01880,0x52c8fffe,0x21009cd1,0x4a443160,0x49c13140,
-0x8c9673d4,0x31ec4ab0,0x8cb873f5,0x73d47c15,0x7c1573f5,0x3a0c6331,0x63734aaf,0x73f57c16,0x63736bb4,0x422e73d4,0x63533a0e,0x7c567436,0x53338477,0x74167417,0x73f66375,0x4a907c16,0x6b946b94,0x42706b94,0x52d15b12,0x426f3a4e,0x5b736353,0x639552f2,0x5b755b74,0x74787458,0x74387c58,0x74387c58,0x74387438,0x74377c58,0x74387438,0x74387438,0x74387437,0x74387438,
-0x74387438,0x74177417,0x74377437,0x74177458,0x74177417,0x74177437,0x74177417,0x74177417,0x6c176c17,0x6c176bf7,0x6bf76bf7,0x6bf76bf7,0x6bf66bf6,0x6bf76bd6,0x6bf763d7,0x6bf763d6,0x63d76bf7,0x63d763d7,0x6bd76bd7,0x63d66bd7,0x6bd663d7,0x53536bd6,0x5b945333,0x63b563b5,0x5b9463d5,0x5af14ab1,0x8414524e,0x94969475,0x9cd79476,0xbd37ad36,0xd618c5b7,0xcdf7de39,
-0xb577bdb7,0xb556b537,0xd639c5d7,0xc597cdd7,0xbdb8bd76,0xad16bd98,0xad36ad16,0xb536b535,0xb556b556,0xbd56bd76,0xc596c576,0xbd55c596,0xcdd6cdd7,0xde17cdb6,0xcd95de17,0xbcb0d5b5,0xf6b7ac2e,0x1800d5d5,0xd61628e3,0xff9d2840,0xff5ae678,0xffbdfe96,0xff18b44b,0xffdbddb5,0x82e7ff5b,0xaa41e5f4,0x7ae9d550,0x1000bd34,0xde17d637,0x0000732d,0xde99940f,0x734def1c,
-0x10627b8e,0x31660821,0x08001041,0x10410800,0x00000820,0x00000000,0x00000000,0x00000020,0x00200020,0x42281081,0x2903630d,0x73ad1061,0xfffff7be,0xdd6ede95,0xff78fffd,0xd4adfe53,0xdd0efdf0,0x51a27a63,0x5a245a04,0x28e020c0,0x104020c0,0x00001060,0x08401060,0x41e61080,0x082018a0,0x18a00820,0x18a02100,0x18601080,0xad11e654,0xbe17bdb4,0x2962ceda,0x312020c0,
-0x298c8456,0x7c147c57,0x94d84a8f,0x5b326373,0x6b734a8f,0x5acf6b72,0x10e92989,0x08890888,0x31ce3a0f,0x31ac4a8f,0x002710c9,0x008a0007,0x5313194d,0x7c578cda,0x6b956395,0x73d573f6,0x5b124ab0,0x63736374,0x424f4a90,0x52d24250,0x53116353,0x53335b33,0x63b55b94,0x74386bf7,0x7c587438,0x74387438,0x74387438,0x74387438,0x74377438,0x74177437,0x74377437,0x74387438,
-0x74377417,0x74177438,0x74177417,0x74177417,0x74177417,0x74177417,0x74176bf7,0x74177417,0x6bf76c17,0x6c176bf7,0x74176bf6,0x6bf66bf6,0x6bd66bf6,0x6bf76bd6,0x63d76bf7,0x63d663d7,0x63d663d6,0x63d763d6,0x6bd66bd6,0x63d66bd6,0x6bd663d7,0x5b7463b6,0x63956395,0x5b7563b6,0x6bf66bf6,0x73f65b54,0x8c357352,0x9496ad38,0xa4f79476,0xbd37ad16,0xc597bd57,0xd618d618,
-0xbd98c5d8,0xbd56bd77,0xcdd7bd96,0xbd97c597,0xbd78bd77,0xacf6b537,0xacf6acf6,0xb535ad15,0xb535b535,0xbd55bd56,0xbd55bd76,0xcd96c576,0xcdd6c575,0xd5f6d5d6,0xcdb5de37,0xbc90bcd1,0xe5d48ac8,0xac706247,0xd67872eb,0xf73a2860,0xff39c510,0xff9b7245,0x48e0ffdc,0xddd65a41,0xeef9ff7a,0xbcf0e66f,0xd5d5d5d1,0x49e6a4b2,0x48e2c5d7,0x83f13165,0x9bcee678,0x730cbd55,
-0x080020a3,0x398618a2,0x31041041,0x08000800,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x630b3185,0x39862945,0xa42e6b2c,0xffdcffdc,0x8aa2ff5a,0xaa816140,0xbba7bbc5,0x5120dd2e,0x51a23900,0x28c03941,0x20e220c0,0x10401081,0x10601881,0x08601080,0x20c01080,0x082018a0,0x10600820,0x18c01080,0x29613162,0xce5872a5,0xf79eef5b,0xb594ffdf,0x39606b26,
-0x8498218c,0x847773f6,0x4aaf6352,0x73b4424e,0x635273d6,0x73726b92,0x19294a6d,0x6bd5424e,0x84988cd9,0x847873f5,0x8cd86bb4,0x74366bf5,0x63956bd5,0x63966bb6,0x7c17320f,0x6b936b75,0x84354a6f,0x3a4f218c,0x63746bb5,0x5b335b33,0x63b46395,0x63b563b5,0x5b955333,0x74387437,0x74387438,0x74387438,0x74387438,0x74377437,0x74377437,0x74377438,0x74377417,0x74177417,
-0x74377437,0x74177437,0x74376c17,0x74177417,0x74177417,0x74177417,0x6c177417,0x6c176c17,0x6bf76bf7,0x6c176bf7,0x6bf76bf7,0x6bd76bf7,0x6bd76bf7,0x63d76bd7,0x63d763d7,0x63d763d7,0x63b66bd6,0x63d663d6,0x6bd66bd6,0x63d66bd6,0x63d663d6,0x6bf66bf6,0x6bd66bd6,0x4af363b5,0x533363b5,0x6bb429ef,0x94966310,0x9cf6a517,0x9cb79476,0xbd77b537,0xc597bd77,0xcdd8cdd8,
-0xc5b7c5b7,0xbd97bd97,0xbd57b556,0xb577bd77,0xb558bd77,0xa4f6ad17,0xad16a4f6,0xb515ad15,0xb556b536,0xbd56bd35,0xbd14bd35,0xc555c576,0xcdb6c575,0xc555d5b6,0xd5f6de17,0xacb09bcd,0x1000bcd0,0x940e1000,0xf79a1000,0xffbb2840,0xffbcbcad,0xffbdef7b,0xb4cdffdd,0xffbbff59,0xe6b7fffe,0xe678ffb7,0x38e1e637,0xcdd651e7,0x8c2feeb9,0xa492deda,0x6aaa8bce,0x20a283ae,
-0x20a2ff7d,0x20c33145,0x08000000,0x5aeb2904,0x00000000,0x00000000,0x00002124,0x00000000,0x31650820,0x7bcf62ea,0x10627bae,0xfffdac91,0xfff9fffd,0xfffff613,0xc591b46b,0x41205a22,0x390030e0,0x310030e0,0x314120e0,0x108018a0,0x10800820,0x106020e1,0x00000840,0x31a41060,0x18c03183,0x106039a4,0x294118e0,0x6b6a4a25,0xffde7bcd,0xff9de6b8,0xccd0ffff,0x18e06243,
-0x7c578498,0x84578457,0x52d173f5,0x5b126bb3,0x4a905af2,0x6311424e,0x08056330,0x3a6f0066,0x3a6f7436,0x63736bb5,0x6bb56394,0x73f65312,0x6bb573f6,0x74175b54,0x73d56bd6,0x39ed5b32,0x00476b73,0x5b736394,0x53124af2,0x73f66374,0x6bf67417,0x533352f3,0x6bf663b6,0x74587438,0x74387438,0x74387438,0x74387437,0x74377437,0x74377417,0x74377437,0x74177437,0x74177417,
-0x74177437,0x74177417,0x74177417,0x74177417,0x74177417,0x6bf77417,0x6bf76bf7,0x6bf76c17,0x6bf76bf7,0x6bf76bf7,0x6bf77417,0x6bd76bf7,0x6bd76bd7,0x63d76bd7,0x63d763d7,0x63d663d7,0x6bd66bd6,0x63d663d6,0x63b663b6,0x63d66bd6,0x6bd663d6,0x6bd66bd6,0x6bd66bd6,0x6bd563b6,0x53336395,0x4ad15b73,0x94b74a4f,0x94969cb7,0x94968c56,0xc5b8bd77,0xc5b8c5b8,0xc597c597,
-0xc5d8cdd8,0xbd97bdb7,0xb536b556,0xb556b536,0xad17b556,0xa4f6a4f6,0xad16a4f6,0xacf5acf5,0xb535b535,0xb515bd35,0xacb3b515,0xb4b2bd14,0xcd95c555,0xd5d7cd95,0xcd32cd95,0x9c2e8b2b,0x41852080,0x1000b553,0xdd940000,0xff7c3000,0xfffefffe,0xf7deffff,0x7aa5ff9c,0xd5d3eeb7,0xfffffffe,0xfefbeef7,0x51e559e5,0xf73b6ac9,0xe719eeb8,0x936dffdd,0xc594838c,0x2903d679,
-0x10411020,0x29048bef,0x10413145,0x000020e3,0x00000000,0x00000000,0x10a23186,0x4a481060,0x20c218c2,0x00001881,0x18a30821,0xab064142,0xff3dfffe,0xc58dffdc,0xac70ff79,0x8328a4d0,0x18a0b594,0x39835287,0x9c6e5a46,0x10601060,0x18a00820,0x08401060,0x08400820,0x08201060,0x18801040,0x20e11060,0x632a3162,0x5b8c2962,0xff9df7bd,0xffbeeef9,0x60e0fffc,0xadb44a03,
-0x84b77c57,0x741673f6,0x73f57c16,0x73d47c36,0x7c358cb7,0x4a0c9d18,0x39ea62ee,0x00020864,0x4af14ad1,0x6bf65353,0x6bf65333,0x5b946bf6,0x74367c98,0x4af26bd5,0x73d46394,0x3a0e73d4,0x5b333a2e,0x5b535b53,0x42914ad2,0x63b66395,0x74177438,0x63956395,0x74176bf7,0x74377437,0x74387437,0x74377417,0x74177437,0x74177417,0x74177417,0x74177417,0x6bf77417,0x74177417,
-0x74177417,0x74177417,0x74177417,0x74177417,0x6bf77417,0x6bf76bf7,0x6bf76bf7,0x6bf76c17,0x6bf76bf7,0x6bf76bf7,0x63d763d7,0x63d763d7,0x63d663d7,0x63d663d7,0x63d663d6,0x63d663d6,0x63d663d6,0x63d663b6,0x63d663d6,0x63d663d6,0x63b663b6,0x63b663d6,0x63b663b6,0x535463d6,0x42b24b13,0x63b55353,0x84375b12,0x84159497,0x9c978416,0xd619c5b8,0xc5d8cdf9,0xc597bd97,
-0xc5d7c5d7,0xbd97c5b7,0xad16b556,0xad16ad16,0xa4f6ad16,0xa4f6a4f6,0xad16a4f6,0xad16ad16,0xb5159c53,0xb556b535,0xb515b535,0xb514b4f4,0xbd55b4d3,0xbd14c595,0x8b2b9bae,0xa4716a47,0xbd75bd33,0x5206d5f6,0xffdd8bad,0xff9d9b09,0xff99f7dc,0xfffeffbe,0xcd51ff59,0xfffbf7ff,0xfffffffd,0xffddffff,0x4080f7ff,0xff9cfffe,0xeef8edd3,0xbcd0f5d2,0xff9b0800,0x6208ac92,
-0x29030800,0x10613985,0x18c31061,0x00000000,0x00000000,0x00000000,0x4a6a0000,0x39c639c6,0x31645247,0x41e73164,0x002239c7,0x72251062,0xfe2ffe54,0xbc4cfffa,0xff57fffd,0x8b8ab389,0xde1472a5,0xb552ef1b,0x20c028c0,0x08402942,0x10800000,0x08200860,0x18c00840,0x6b0bde77,0x10804a27,0x4a456b8b,0x83cc2922,0xef3c94d3,0xf77cffbe,0xffbdf75c,0x7b05ffdb,0xf77d842f,
-0x63925b32,0x6bf57437,0x6bb473f6,0x73f48456,0x94d96bb4,0x528e5b11,0x108539ca,0x52ad4a4c,0x5b731948,0x6bf66bd5,0x6bd563b5,0x63b55b74,0x74167c78,0x9d3b7416,0x6b746bd5,0x3a2e39ed,0x5b126353,0x63746394,0x63b56374,0x63954af2,0x639563b6,0x6bf76bf6,0x74377417,0x74377437,0x74377437,0x74377438,0x74377417,0x74377437,0x74177417,0x74177417,0x74176bf7,0x74177417,
-0x74177417,0x74177417,0x6bf77417,0x6bf76bf7,0x6bf77417,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x63d76bf7,0x6bf763d7,0x63d663d6,0x63d763d6,0x63d663d6,0x63d763d6,0x63d663d7,0x63d663b6,0x63d663b6,0x63d663d6,0x63b663d6,0x63b663b6,0x63b663d6,0x63d663b6,0x63b56bd6,0x5b7563b6,0x4b133ab1,0x74175b54,0x7bf67bf6,0x9cb77c16,0xde59cdf8,0xce18de59,0xc5b7c5b8,
-0xcdf8c5d7,0xc597c5d8,0xb536bd56,0xa4f6acf5,0xa4f6a4f6,0xa4f6a4f6,0xa4f6a4f6,0xad16ad16,0xacd5acf5,0xad15b535,0xbd36ad15,0xacd4b4f4,0xbd14834d,0xcd96c575,0xac50b4b2,0x30a1d5d6,0xde364984,0xff9cd5d5,0xff7cff3b,0xfffffe75,0xffdcffbb,0xfffeffff,0xfffefffd,0xfffdffff,0xff9affff,0xe56fdfdf,0xfed9a2a1,0xff7abcd0,0xb4d1fe14,0xeed9a389,0x9bef7b2b,0x180072aa,
-0x28e30800,0x082018a2,0x21043165,0x00000000,0x00000000,0x00000021,0x4a6a5b0d,0x528a62ec,0x39856b2c,0x29652924,0x959b31c9,0x7309be3b,0xe637ff18,0xfe76c4ad,0x79a0c283,0x93888ae5,0xd5f5cd72,0x8c2fd657,0x18801880,0x18c11060,0x08400000,0x108010a0,0x39a30840,0x72c7b44d,0x3982732a,0x41e4deda,0x5a889c6f,0xef3bef5d,0xffdeffbd,0xff7cef3b,0xd698eeb7,0xffbfef5d,
-0x7c368cb7,0x7c358cb8,0x6bd54ad1,0x73f76c17,0x631252b2,0x08847bf4,0x42700024,0x298a73d4,0x212831aa,0x74565b94,0x7c577417,0x21ad951a,0x84b95b55,0x194c7c78,0x218c0048,0x4ad163b4,0x53124ad1,0x63945312,0x637463b4,0x4ad25b53,0x63d66395,0x74377438,0x74377437,0x74387417,0x74377417,0x74177417,0x74187418,0x74177417,0x74377418,0x74177417,0x6c177418,0x6bf77437,
-0x74177417,0x6bf77417,0x74187417,0x6bf76bf7,0x6bf77417,0x6bf77417,0x6bf76bf7,0x6bf76bf7,0x63f66bf6,0x63f66bf6,0x63d763d7,0x63d663d7,0x63d663b6,0x63d763d7,0x63d663d6,0x63b663d6,0x63d663b6,0x6bd763b6,0x63b663d6,0x63b65b96,0x63b663d6,0x63b65b96,0x63b663b6,0x63b663b6,0x5b9563d6,0x63d64b14,0x6bf763b5,0x6bf663b6,0x9cb683f6,0xee99d658,0xe679eeba,0xce18ce38,
-0xd639ce39,0xc5b7cdf8,0xb536b555,0xad36ad16,0xa517ad16,0xa4f6a517,0xa4f6a4f6,0xad16ad16,0x9c74acf5,0xacf5acf5,0xacf5b536,0xacb4a4d4,0xbd35acb3,0xb4f3acb3,0x93efbcf3,0x20a1834c,0xc512acb0,0x936c93cd,0x4840f5d6,0xfe96ffff,0xfffdffbe,0xfffeffff,0xffffffff,0xfffeff5a,0xe77ffffe,0x49636120,0xcd115000,0xfffdccaf,0xcc8d9b0b,0xf6badd94,0xa432d69a,0x0000ac50,
-0x104120c3,0x08400820,0x0000ad34,0x00000000,0x19442124,0x10839d19,0x4209b597,0x7baf630d,0x31a739c8,0x10842986,0xbdfc94d7,0xac2fb5fa,0xfed4e677,0x288092e4,0x4a2228c0,0x72a72980,0xcbc692e5,0xef77d77f,0x10402861,0x00000820,0x08800020,0x18c010a0,0x39411040,0x39604182,0x416341e4,0x72c6e75c,0xde995224,0xf73cff9d,0xffdeffbe,0xffbdf75c,0xffbee6da,0xfed9ffdf,
-0xb5dd29ac,0x63528457,0x6bd56bb4,0xad598c37,0x0004420b,0x84773a0e,0x73d573d5,0x214a8477,0x5b314ab0,0x7c370025,0x7c777c57,0x3a509d5b,0x21ad0048,0x7c788499,0x73f77c58,0x63946394,0x4af25b53,0x4ad16394,0x63b473f6,0x4ad24270,0x5b544ab1,0x74377417,0x74377437,0x74387417,0x74377417,0x74177437,0x74187418,0x74177417,0x74177418,0x74177417,0x6c177418,0x74376bf7,
-0x74177437,0x6bf77417,0x74187417,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x63f66bf6,0x63f66bf6,0x63b663d7,0x63d663b6,0x63b663b6,0x63b663b6,0x63d663b6,0x63b663d6,0x63b663b6,0x63b663b6,0x63b663d6,0x63b65b96,0x63b663b6,0x5b9663b6,0x63b663b6,0x63b663b6,0x63d663d6,0x63d65b95,0x6bd66bd6,0x63d66bd6,0xbd998416,0xeebae6da,0xeeb9f6da,0xd638de59,
-0xde59de59,0xc5d7ce18,0xb556bd76,0xad36b537,0xa4f6ad16,0xa4f6a517,0xa4f6a4f6,0xacf5a4d5,0x9412a4b4,0xa4b4a4d4,0xb516acf5,0xacf5b515,0x9c10ad15,0xb4d2bd14,0x9c0fa471,0x94702000,0xcdb4acb1,0x4123b4f2,0x1800fefa,0xe635ff9c,0xfffdffdd,0xfffdffff,0xffdffffe,0xfffeff5b,0xff38ffdb,0xcd9979ea,0xbcd11040,0x79c23060,0xbc8eee36,0xd595fe98,0x40e3e6fb,0x29031800,
-0x62cb18a2,0x00000800,0x00002944,0x00000000,0x21880841,0x18e57bf3,0x4229738f,0x422962ec,0xa5574a4a,0x00032167,0xadba3a2d,0xc5f89d18,0x6161ffbd,0x0141a46e,0xce974b6b,0x7a84b510,0x30805180,0x6921ba00,0x10400820,0x00000820,0x10a00840,0x212010a0,0x630a31a5,0x49c13940,0x6aa96286,0x4920f75a,0xe71a8c2e,0xf73cff5c,0xffbeff9d,0xf77cff9c,0xfffeff9d,0xcd4fff5b,
-0x10ea0006,0x000573d5,0x00040004,0x002610a6,0x7c787c78,0x7c587c77,0x7c168477,0x3a4f8cb7,0x63945b54,0x29aa7c36,0x00040065,0x7c376394,0x74177c59,0x7c577438,0x63557417,0x6bb57417,0x53335b53,0x5b335b53,0x5b535b53,0x4ab14af2,0x63b642b1,0x74377437,0x74377437,0x74177417,0x74177417,0x74177437,0x74186bf7,0x6bf77418,0x74176bf7,0x74177417,0x74177417,0x74177417,
-0x74176c17,0x74177417,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x63d76bf7,0x6bf663f6,0x63f66bf6,0x63d663d6,0x63d663d6,0x63d663d6,0x63b663b6,0x63d663b6,0x63d663d6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b563d6,0x63b663b6,0x63b663b6,0x63b66bd6,0xbd789476,0xf6fbeeb9,0xe678eeb9,0xde58e658,
-0xee9ae679,0xce18d659,0xbd97c5d7,0xad37bd77,0xa4f6a4f6,0xa4f6a4f6,0xad16a4f6,0xa4b4a4d5,0x9c53a4d5,0xacd49411,0xacf5a4d4,0xad15a4d4,0xacb3ad35,0x6a897b2d,0x18209c10,0xb47283ce,0xcdd5c553,0xff5b2080,0xabccfffd,0xffdcff5b,0xfffdff9b,0xfffeffff,0xffdefffe,0xffdcf719,0x3800fd50,0xce18be3b,0x94510800,0xde582881,0xf719ee98,0xf6d9ff1a,0x9c72cdb5,0x6b0c1020,
-0x08001040,0x00001041,0x00000000,0x94b30000,0x3a2d10a4,0x422a9cf6,0x84314209,0xa5356b4e,0x426c426a,0x8cd87c56,0xa5594a6e,0xd69bb5ba,0x31a0bd33,0xcf7affff,0xf7bdffff,0xff59ad52,0x20a051c3,0x422541e3,0x102018a0,0x10800820,0x004031a3,0x5ae718e0,0x6b09ffff,0x390049c2,0xeefa51e2,0xa512ddb2,0xf75cce78,0xef3bff7c,0xff9dffbe,0xff9dff9d,0xffdeffde,0xe6d9eef9,
-0x84b97c78,0x8cd97c56,0x7c367c77,0x63b5a55a,0x84b97457,0x84998499,0x7c578499,0x741763b5,0x63955333,0x6c1563d5,0x6bf53a4e,0x74377437,0x6bf66bd6,0x7c587c58,0x63b67417,0x6bd57417,0x4ab16395,0x5b336374,0x52f24a91,0x42905b33,0x73f66374,0x6bf75b96,0x74186c18,0x74187418,0x74177418,0x74177417,0x6c176c17,0x6c176c17,0x6c176c17,0x74176c17,0x74177417,0x6bf77417,
-0x6bf77417,0x6bf76bf7,0x6bf76bf7,0x74176bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x63d76bf7,0x63d763d7,0x63d663d7,0x63b663d6,0x63b663b6,0x63b663b6,0x63b66396,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x5b9663b6,0x63b663b6,0x63b663b6,0x63b663d7,0x63b663d6,0x63b663b6,0x6bd763b6,0xcdd89cb6,0xee99e679,0xe679ee99,0xe679e659,
-0xe699e679,0xd638de79,0xc5d7d5f7,0xb557bd97,0x9cd6a516,0xa4f6a4f7,0xa4f6a4f6,0x9c93a4d5,0xad16ad15,0x9c739412,0xacd5a4d5,0x7b6fa494,0x9c529432,0x838d9c52,0x83ae6a69,0x93f05a69,0xeeb9d5f7,0xeefa2840,0xc4915122,0xeffeeffc,0xfffffeba,0xffffffff,0xfed9ef9b,0x48e0b3c9,0xe6db7a66,0x28e472cb,0xd679ac91,0xac50c596,0xffbbeed8,0xe698e656,0x3986bd54,0x10410800,
-0x00000000,0x42080821,0x002118c3,0x29678c72,0x6b2f0864,0x41ea7370,0x62cc41ea,0x7390420a,0x8c952168,0x7c359d18,0xb59a426e,0xd67bb5ba,0xff3849c7,0xfffffffd,0xd4eeffff,0x59c2dd2f,0x28c12080,0x398328a0,0x000018e1,0x10c00860,0x00204a88,0x51e32120,0xb4efff5a,0x522172c4,0xbcd08ba9,0xef7db595,0xff7cff7d,0xef1bff5c,0xff9dffbd,0xffbeff9d,0xffbdffbd,0xe52dffff,
-0x84b98499,0x849984b9,0x74167c37,0x84d919af,0x7c988499,0x84988498,0x63957c37,0x4af26bb6,0x6bd66c16,0x74166bd6,0x5b727c57,0x74373a70,0x74377c58,0x74387438,0x74177c58,0x73f66395,0x531373f6,0x52f26353,0x5b124a90,0x4ad14270,0x5b545312,0x63d65b55,0x74186bf7,0x74177417,0x74177417,0x6bf77417,0x6c176c17,0x6c176c17,0x6c176c17,0x74176bf7,0x6bf76bf7,0x6bf76bf7,
-0x6bf76bf7,0x6bf76bf7,0x6bf77417,0x6bf76bf7,0x63d76bf7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d663d6,0x63d663d6,0x63d663d6,0x639663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x5b9663b6,0x5b9663b6,0x5b965b96,0x5b965b96,0x63b663b6,0x63b663b6,0x6bd663b6,0x741663b6,0xbd77b578,0xd5d7c576,0xe639de19,0xe679e679,
-0xe699e679,0xde78e699,0xce18d637,0xbdb8cdd8,0xa4f6a516,0xad16ad57,0xa4f6ad16,0xa4d5ad15,0x9c94a4d5,0x49e99c53,0x83b0a4d5,0xa4b48bf2,0xad15a4b4,0xee7aad15,0xbd15b555,0xd638d5f7,0xe637cdb6,0xe616b450,0xff3c1800,0xe44cfcd2,0xff58f54f,0xffbdff9b,0xed2cffb9,0xffb8e75b,0xeefaffff,0xb536a411,0xc5566a6a,0xac91b535,0xff5be657,0xde59ffbd,0x62cc28c3,0x08410000,
-0x21464229,0x5accb5b9,0x00010001,0x18e62947,0x5aed528d,0x31680002,0x29289cf5,0x7c122988,0x3a4d08a7,0x4a8e7c54,0xb5ba5b31,0xbddab59a,0xd5f6d67a,0xffffe635,0x5900f77d,0x49a348e0,0x20a11880,0x10801040,0x08200860,0x52a918e2,0x4247e73b,0x4a0328e0,0x4a03ff3a,0x946d7347,0xce78838c,0xf77cf75d,0xff5cff5c,0xf73bff5c,0xff7cff9d,0xffbeffde,0xff19ff7c,0x71a0ff9b,
-0x84b984b9,0x84b984b9,0x63957c98,0x84997438,0x7c798499,0x7c798499,0x63b67c78,0x6bf77438,0x6bf763b6,0x6bd67458,0x7c997c17,0x000684b8,0x6bf67416,0x74387417,0x74377438,0x7c3763b5,0x4ad16bd5,0x52d173d5,0x52f24ab0,0x6b95192b,0x42b15af2,0x5b755354,0x6c1763b6,0x6bf76c18,0x6c176c17,0x6c176c17,0x6bf76c17,0x6c176c17,0x6c176c17,0x6bf76c17,0x6bf76bf7,0x6bf76bf7,
-0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x63d76bf7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d663d6,0x63d663d6,0x63d663b6,0x63b663d6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63966396,0x63b663b6,0x5b9663b6,0x5b9663b6,0x5b9663b6,0x5b965b96,0x5b965b96,0x63b663b6,0x5b965b96,0x63b663b6,0x7c3663b6,0xacf79495,0xb556a4b5,0xde19cdb8,0xe679e679,
-0xe678e678,0xe679e679,0xd658e679,0xce39d658,0xb557bdb8,0xb557b556,0xb536b536,0xad36b537,0x83b1a4d4,0xacd6a495,0xa49362ad,0xa4f49452,0xb4f4a4b4,0x51e9c596,0x5a49b515,0xcdd6d5b6,0x5144ddf7,0x10008b6c,0xff7bffdf,0xee98cd52,0xff58ffff,0xbac7fdd2,0xeed7ff7a,0x71a2ff7a,0xeeb9f71a,0x5a8c0000,0x8bb1b558,0x518559c9,0xef3bffdd,0xe658ff5b,0xbd9772ed,0x08420001,
-0xe73f2948,0x08a552cd,0x18c50001,0x8c7518e6,0x73b11907,0x4a6d39eb,0x633118e6,0x63517c34,0xa57a10e8,0x94d89517,0x9d1939ed,0xad9aad9a,0xff7dde7b,0xfe35f71b,0x49a32800,0x41a328c0,0x108010a0,0x08601080,0x18c10860,0x84506b2b,0xe75cf7ff,0x83cd2900,0xbd73ffde,0xde9772e7,0xef3bde99,0xf75cf75c,0xf75cf75c,0xf75cff7d,0xffbdff7c,0xffbdffbe,0xe635ff1a,0xac2ae5f3,
-0x84b98499,0x84b984b9,0x3a917cb9,0x7c787c79,0x84997c78,0x7c797c79,0x74387c79,0x74177438,0x74387437,0x74177438,0x7c7873f6,0x7c585b56,0x42b184b7,0x9d3b112b,0x84788cda,0x84985b33,0x9d3b63b4,0x6b94ad9c,0x4ab029ad,0x3a2f4a90,0x53135b13,0x5b965334,0x6c176bf7,0x6c176c17,0x6c176c17,0x6bf76c17,0x6c176bf7,0x6bf76bf7,0x6c176bf7,0x6c176bf7,0x6bf76bf7,0x6bf76bf7,
-0x6bf76bf7,0x6bf76bf7,0x6bd76bd7,0x6bf76bd7,0x63d76bf7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d663d6,0x63d663d6,0x63b663d7,0x63b663d7,0x63b663b6,0x63b663d6,0x63b663b6,0x63b663b6,0x63b663b6,0x63966396,0x63b663b6,0x5b9663b6,0x5b965b96,0x5b9663b6,0x5b955b95,0x5b965b96,0x63b65b95,0x5b965b96,0x63966396,0x6bd563b6,0xa4f79cb6,0xb556acd6,0xd5d8bd56,0xde59e679,
-0xe678de58,0xe679e679,0xe6b9ee99,0xe6daeeda,0xc5f8d679,0xbd97c5f8,0xbd97b577,0xb556bd97,0x9c94bd77,0x526c8c13,0x6acd83b1,0x9c539c74,0xa3d09c52,0xacd52002,0xcdb78bd0,0xb493724a,0x30e37aab,0x080030e3,0xbd32f699,0xe5b4cd73,0x9a87ee58,0xee36d4f1,0xffbcef1b,0xac9069e2,0xee16eeb9,0xa4d59472,0xc59862ce,0x936d7b2e,0xf6b9dd75,0xa451e659,0x949420a5,0x00010002,
-0x4a6c7bd2,0x420ab5b8,0x52adbdf9,0x9cf739ea,0x6b50422c,0x31899cd6,0x3a2d08a6,0x4a8eadb9,0x741473f4,0xa539adba,0xad9bbdfc,0xad9aad9a,0xcd78b599,0x91e5c454,0x730affbd,0x1060a46e,0x31a40820,0x10801900,0x296318e0,0xa5149cf3,0xe71cef3c,0xffdd49a2,0xbdb5ff9d,0xe6b9940d,0xde78e699,0xff3ce699,0xf75cf75c,0xf75cf75c,0xff9dff9d,0xffdeffde,0xe6b9ffbd,0xffbad616,
-0x84b97c58,0x7c797c58,0x74593a73,0x84998499,0x7c798499,0x7c797c79,0x7c797c78,0x74387c58,0x7c587438,0x74577c58,0x7c9a7437,0x6bf763d7,0x74377458,0x74577458,0x214a8cf9,0x31ec29cc,0x10cb31ed,0x8c987c16,0x63535b12,0x4af16bd4,0x6bd64b12,0x63d66bf7,0x6c176c17,0x6c176c17,0x6bf76c17,0x6bf76c17,0x6bf76bf7,0x6bf76bf7,0x6c176bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,
-0x6bf76bf7,0x63d76bf7,0x6bf763d7,0x6bd76bf7,0x63d76bf7,0x6bf763d7,0x63d663d7,0x63b663d6,0x63d763d6,0x63d663d6,0x63b663b6,0x63b65b96,0x5b9663b6,0x63b663b6,0x5b9663b6,0x63b65b96,0x5b9663b6,0x5b9663b6,0x63b663b6,0x63b663b6,0x5b755b95,0x5b755b95,0x5b755b95,0x63b65b95,0x5b955b95,0x63b65b96,0x63966396,0x6bb663b6,0x9c768c36,0xc598bd56,0xcdd8c598,0xde59de58,
-0xe658de58,0xe699eeba,0xf6b9e699,0xf6faf6fa,0xeefaff5c,0xcdd7de59,0xcdd7c596,0xc597cdb7,0x9c54c597,0x9c9483d1,0x6b2f83d1,0x83902947,0x7bb23947,0x735041eb,0x8bf0732f,0x734e83b1,0x1020ce38,0x1000bdf8,0xf656d5f5,0xb4b1e573,0xcd33c595,0xc4b2b432,0xf636f719,0xde363942,0x2000e617,0xb537a4d6,0xad1483f1,0x6a8affff,0xcd768b8e,0x7a8ec4f6,0x7bb14a2b,0x6b502948,
-0x41ea4a4c,0xad766b4f,0x5aecad36,0x6b2f9cb5,0x318a4a6c,0x2a4d10c7,0x110aa5ba,0xad9a6330,0xad796b92,0x0889adba,0xad7aa55b,0xad9aad9a,0x8456ad9a,0xacd46330,0xd59351a7,0x10c020a0,0x62e93164,0x214139e4,0xffde2921,0xdeb9ce38,0xc553ef5c,0xffdf838b,0xe6b8ff7b,0xe75dc5d5,0xf71beefb,0xc554f71b,0xff5cff7c,0xff5df73c,0xffdeffbe,0xffbefffe,0xff5df7fe,0x82c8ef9d,
-0x7c586bf6,0x5b5584b9,0x7c996bf8,0x84998499,0x7c798499,0x7c797c79,0x7c587c78,0x7c587c79,0x74387c58,0x7c587c58,0x3a9263d6,0x6bf763d6,0x74587458,0x74577458,0x6bb46bf6,0x63734a90,0x3a0f31cd,0x3a2f214b,0x63536b94,0x4ad152f1,0x63b55b95,0x6bf77417,0x6c176c17,0x6c176c17,0x6bf76c17,0x6bf76c17,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,
-0x6bd76bf7,0x63d763d6,0x6bf763d7,0x6bd76bf7,0x63d76bd6,0x6bf763d7,0x63d663d7,0x63b663d6,0x63d763d6,0x63d663d6,0x63b663b6,0x63b65b96,0x5b9663b6,0x63b663b6,0x5b9663b6,0x5b965b96,0x5b9663b6,0x5b9663b6,0x5b955b95,0x5b955b95,0x5b755b75,0x5b965b95,0x5b755b95,0x63b65b95,0x5b955b95,0x63b65b96,0x63966396,0x6bb663b6,0x94758c36,0xcdf8c5b7,0xcdd8d5f8,0xde59de58,
-0xe658de58,0xe699e699,0xf6b9e699,0xff3bf6fa,0xff5cff9d,0xe679e699,0xcdf7cdd6,0xcdd7cdd7,0xacf5b534,0xa4d59474,0x94539c94,0x5a6b9453,0x2928bd58,0x29087bb2,0x734f7b91,0xa4b39c53,0x72ab8b8f,0x2800de79,0xd5f57ae9,0xde77de15,0x3924c534,0x9bcf6a4b,0xd551ed53,0xee79dd73,0xe638bcd2,0xa4d5b558,0xff5dc5d8,0xdeb8ffff,0xde79acf2,0xa4f59452,0x83f283f2,0x94953189,
-0x39c96b50,0xa4f5420a,0x73af9c94,0xb578a4f7,0x39eb94b6,0x6bf429ab,0x9d5a84b7,0x4a8e8c96,0xb5db7c34,0x94faadba,0xad7aad9b,0xad7aad9a,0xad9aad7a,0x8bf083f2,0x30e1ff1c,0x39e62942,0xb5948c70,0x318239e5,0xffff2922,0xf73be6da,0xfffdf75c,0xff5cff7b,0xee98f73a,0xeedad593,0xf71beefb,0xff3cf71b,0xff5cde17,0xff9dff5c,0xfffeffde,0xffbefffe,0xdd52efbd,0x8bcdc44d,
-0x7c586bd6,0x7c796395,0x7c985bb6,0x7c787c79,0x7c797c78,0x7c587c79,0x7c587c58,0x7c587c79,0x7c587c58,0x4af47457,0x63f66bf8,0x63b66bf7,0x6c376c18,0x74386c17,0x6bb56bf7,0x4a716b95,0x6b946b95,0x52d16b94,0x4a904a90,0x53134a91,0x74175b96,0x6c177437,0x6c176c17,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x63d76bf7,0x6c176bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf763d7,
-0x6bd76bf7,0x63d663d6,0x63d763b6,0x6bd763d7,0x63d66bd7,0x63d663d6,0x63b663b6,0x63d763b6,0x63b663d6,0x63d663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b65b96,0x5b9663b6,0x5b955b96,0x5b755b95,0x5b755b75,0x5b955b95,0x5b955b75,0x5b955b95,0x5b9563b6,0x5b955b95,0x5b955b96,0x5b755b96,0x63966396,0x63b56396,0xb5588c77,0xd618cdf7,0xd5f7de38,0xde58d618,
-0xde38de38,0xe699de58,0xf6dae699,0xff5bff1b,0xff9dff9d,0xde78ff5b,0xde37de78,0xd617d617,0x9c93b513,0x9cd59cb5,0x7bb183f2,0x9c9520c5,0x6b7241eb,0x41ed73b3,0x5aae7b93,0x8b6f9473,0xa4b483d0,0x3905c5b7,0xcdd6a4f5,0xb411cd75,0xc5f8bd76,0x7b4e83b1,0xbc52a451,0xcd949c70,0xe6fdac70,0xc5d8b536,0xff3cce18,0x7aa8fffe,0xa3f0fefc,0x8c539432,0x3168bdb9,0x5aef31a9,
-0xc63b528d,0x83b1528c,0xf7bf9c31,0x73709474,0x5b71528d,0x94d88cd7,0xa59abe3e,0x4aaea579,0xad9a9d38,0xa55bad9a,0xad9aad9a,0xad9aad7a,0x73d2b5db,0x94508c73,0x4a27ac90,0x8470a533,0xffffffdf,0x5266d678,0xef1cc659,0xff1ceefb,0x9388ff7b,0xff3cffde,0xddf6f71a,0xeefcde17,0xf71cf6fb,0xef3cf71c,0xf73bd554,0xff9dff7c,0xfffeffde,0xffbdffde,0x6922ee75,0xefffcedc,
-0x74166bd5,0x7c795b75,0x7c986c18,0x7c797c79,0x7c787c79,0x7c787c78,0x7c587c58,0x6bd67438,0x6bf663d6,0x63954ad2,0x63b66bf6,0x74386bf7,0x74387438,0x6c177438,0x6bf763d6,0x6bb663d5,0x5b344291,0x6bb56bf6,0x4ad15b53,0x63954af2,0x63d75314,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x63d76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,
-0x6bd76bd7,0x63d663d6,0x63d663b6,0x63d763d6,0x63d663d7,0x63d763d6,0x63b663d6,0x63d663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663d6,0x5b965b96,0x5b9663b6,0x5b955b95,0x5b965b96,0x5b965b96,0x5b965b75,0x5b955b96,0x5b955b75,0x5b755b95,0x5b755b75,0x5b755b95,0x5b755b95,0x5b955b95,0x63b65b95,0x63b563b6,0xb4f88c56,0xd5f7d5f7,0xd5f7de38,0xde38d618,
-0xd617de37,0xde38de17,0xf6dae658,0xff5bff3b,0xff3aff5b,0xeed9fefa,0xde37f6fa,0xe699e699,0x9452b555,0x4a0a7b2f,0x6b0f2907,0x422b39aa,0x73b26b31,0x52d010a7,0x6b517c14,0x945439ca,0xc5970801,0xee9bb473,0xd617bd35,0xcdb7a450,0x8c128bf1,0x3127d61a,0x8bd172ed,0xbd368bb0,0xad366a6b,0xbd5683af,0xff5cde38,0xf6baf699,0x5a2bac11,0x002362ee,0x4a4b2105,0xad573189,
-0x630e62ee,0x10835acc,0xd618d5f6,0x31a93127,0x6393bdfa,0x8cd7adbb,0x9d398c97,0x8cd8a55a,0xa57aa55a,0xa55aa57a,0xad7aad7a,0x9d59a57a,0xb5b89d18,0x8c0f4a49,0xa5535aa9,0xd699e73c,0xff7aff9d,0x4a45bc2b,0xd5f7f75c,0xeefbeeda,0xffdef77d,0xff3bff9c,0xc553eeb9,0xeedaeefa,0xf73cef1b,0xef3cef3c,0xf6baf6ba,0xff5cff5c,0xf7deffbd,0x9265ffbc,0xffffffbe,0xffdeef9d,
-0x531363b5,0x84997c78,0x7cb97438,0x7c797c79,0x7c787c79,0x7c587c58,0x74177c58,0x74587c58,0x63b67458,0x63955b75,0x63b663d6,0x743863d7,0x74387438,0x6c187438,0x63966c17,0x4ad26396,0x63955b54,0x6bb66375,0x53135334,0x63956394,0x5b755314,0x63b65b75,0x6bf763d6,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x63d76bf7,0x6bf76bf7,0x6bf76bf7,0x63d76bf7,0x6bf763d6,0x6bf763d7,
-0x6bd76bd7,0x63d763d7,0x63d663b6,0x63d763d6,0x63d663d6,0x63d663d6,0x63b663d6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x5b9663b6,0x63b65b96,0x5b955b95,0x5b965b95,0x63b65b96,0x5b955b75,0x5b755b95,0x5b955b95,0x5b955b75,0x5b755b75,0x5b755b75,0x5b755b95,0x5b955b75,0x5b965b96,0x63b55b96,0xacd78436,0xd617d5f7,0xd5f7de18,0xde18d617,
-0xd617d617,0xddf7d5d6,0xf6dae638,0xff3bff3b,0xff5cff3b,0xf71bff5c,0xeeb9e678,0xb4d2fefa,0x62cc83ae,0x7370bd97,0x7bf394b5,0x7bd23a0b,0x8c966b51,0x7c1573b3,0x10a66352,0x6b6f7c14,0x9c726b0d,0xe6392822,0xe6bacdd8,0xb4b5c555,0x18447b50,0x84740002,0x39caad38,0x8c54ad37,0x9d18a4d7,0x9c955a8e,0xfefbb517,0x3967d5b7,0x420c1865,0x39a97bd2,0xef5f8413,0x62ee39a9,
-0x7bd15aad,0x738e83f1,0x9c116249,0x000339ca,0xa5797bf4,0x9d17a558,0x9d599d5a,0x9d599d58,0xa55aa55a,0xad7aa55a,0xa57aad7a,0xb59aad7a,0xceb9c639,0xffffdf3c,0x83ee6b8c,0xffbdffbd,0xedf4f6d6,0xf79c6244,0xde58e69a,0xef1be6ba,0xffdeffde,0xff3bff9d,0xeefbde78,0xeefaf6fb,0xf73cef1b,0xf71cf73c,0xc513f71c,0xff5cffbc,0xf657ff5c,0xf7dfd637,0xffffffff,0xffbeffbd,
-0x74377457,0x6bb77c98,0x7c798499,0x7c787c78,0x7c787c78,0x7c587c58,0x7c587c58,0x74377c58,0x6bf67417,0x63d66c17,0x6bf76c17,0x74386bf7,0x6c187438,0x74186c18,0x6bf77417,0x5b756c17,0x5b755b75,0x53346395,0x533463b5,0x6bd65313,0x639663b5,0x5b965314,0x6bf763d7,0x63d763d7,0x6bf76bf7,0x6bf76bf7,0x63d763d7,0x63d763d7,0x63d663d7,0x63d763d7,0x63d763d7,0x63d763d7,
-0x6bd76bd7,0x63d763d7,0x63d663d6,0x63b663d6,0x63d663d6,0x63d663d6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x5b965b96,0x5b9663b6,0x5b955b95,0x5b955b95,0x5b965b96,0x5b965b96,0x5b755b75,0x5b755b75,0x53555b75,0x5b755b95,0x53555b75,0x5b755b75,0x5b755b75,0x5b955b75,0x5b955b95,0x63b65b95,0x945573b5,0xd5f8c576,0xd618d618,0xd618d5f7,
-0xde18de38,0xd5f7de18,0xf6b9d618,0xff1aff1a,0xff3bff1a,0xffbcff9c,0xe698ff3a,0xef3bfef9,0xa4f4eefa,0x9c528c12,0x420bb4f4,0x52ad8cd5,0x7bf46331,0x5ad04a6e,0x84350046,0xad388c56,0xa4f4acd5,0xb4f42001,0xd5d8b515,0x9c93c576,0x0003acd7,0x9cf66b70,0x8c5531aa,0x292994b6,0x8c969d17,0x8c551087,0x9c549c75,0x39eb8bf3,0x7c144a4c,0xa4f65aee,0x843239c9,0x41e92927,
-0xce5a7bb1,0xd638bdd6,0xcdf8bd33,0xa579bdb8,0x94b7a579,0xa5598c96,0x9d199d39,0xa539a539,0xa55aa53a,0xa55aa539,0xa55aa55a,0xbe1aa579,0xf7bdde9b,0xffbdfffe,0xffbcf7bd,0xfffeff9d,0xe5aff6b8,0xf79dc571,0xde59de79,0xff5ceefa,0xff7dff9d,0xff7cff9d,0xeefaf6fb,0xf6fbf71c,0xeefbf73c,0xf75cf71b,0xef1beefb,0xa3cbe636,0xef1bc4b1,0xffdef77c,0xffffffde,0xf77dffdf,
-0x74177c77,0x73f87437,0x7c797c79,0x7c587c78,0x7c587c58,0x7c587c58,0x7c587c58,0x74177437,0x74177417,0x63b663b6,0x6c177438,0x6c186c17,0x74386c18,0x74176c18,0x6c177417,0x535463b5,0x5b745b74,0x63954ad2,0x6bd66bd6,0x63965b55,0x63966bd7,0x5b756bd6,0x63d663b6,0x6bf76bf7,0x6bf76bf7,0x63d76bf7,0x63d763d7,0x63d663d6,0x63d663d6,0x63d763d6,0x63d663d7,0x63d663d6,
-0x6bd76bd7,0x63d663d6,0x63d663d6,0x63d663d6,0x63d763d6,0x63b663b6,0x63b663d6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x5b965b96,0x5b955b96,0x5b965b95,0x5b955b75,0x5b765b75,0x5b755b96,0x5b955b75,0x5b955b75,0x5b755b75,0x5b755b75,0x5b755b75,0x5b755b75,0x5b755b75,0x5b955b75,0x5b955b95,0x63b55b95,0x84156bb5,0xcdb7b535,0xde18d5f8,0xd618d618,
-0xde58de18,0xd5f7de18,0xe658d5f7,0xfef9fefa,0xf6b8fef9,0xf71aff19,0xff3bff9c,0xf6f9ffbc,0xde78d5f5,0x9c526b2e,0xf75b4167,0xacf5de58,0x4a6e18c7,0x39ed4a6f,0x7bf45ad0,0xa5185b52,0xad15bd78,0xacb3ffbf,0xc576cdd7,0x9433cd97,0x08a739eb,0x5b0f8475,0x9cf6a4f7,0xa5189496,0x841494d6,0x63324a90,0x83f48414,0x73f46b92,0x31aa4aaf,0x62ce8413,0xad569474,0x8c52bdf9,
-0xad33e6b9,0xac4fb533,0xbd1259c5,0xb5d9e6bb,0xa559b579,0x9d189d18,0x9d199d39,0xa539a539,0xa539a539,0xa539a539,0xa55aa55a,0xb579a579,0xf6dbcdf9,0xffffffbe,0xff7cffbd,0xffddff7c,0xffdfbbaf,0xfffefffe,0xe6fbef1b,0xf6fbe658,0xff5cff5c,0xffdeffde,0xeedaff5c,0xf71cf71b,0xeebaeefb,0xe6faeedb,0xf71cef1b,0xd6fbee7a,0xfefdef3c,0xff7dff5c,0xff7dff5c,0xff5df73c,
-0x63b47436,0x74177c78,0x7c787c79,0x7c587c58,0x7c587c58,0x7c587c58,0x7c387c58,0x6c377438,0x74587458,0x74385b95,0x6c176bf7,0x6c187438,0x6c186c18,0x6c186c18,0x74176c17,0x53346bd7,0x6bf65b75,0x4ad25b95,0x6bd76395,0x5b7563b6,0x6bf763d7,0x63b66bf7,0x6bf763d7,0x6bf763d6,0x6bf76bf7,0x63d763d7,0x63d663d7,0x63d663d6,0x63d663d7,0x63d663d6,0x63d663d7,0x63d663d6,
-0x63d663d7,0x63d763d6,0x63b663d7,0x63d663b6,0x63b663b6,0x63b663b6,0x63b663d6,0x63b663b6,0x63b663b6,0x63b663b6,0x5b9663b6,0x5b965b96,0x5b966396,0x5b965b95,0x5b965b76,0x5b755b75,0x5b765b76,0x5b755b76,0x5b755b75,0x5b755b75,0x5b755b75,0x5b755b75,0x5b755b75,0x5b755b75,0x5b755b75,0x5b755b75,0x5b955b75,0x63b55b95,0x9c977c36,0xcdb7b556,0xd5f8cdd7,0xcdd7d5f8,
-0xd5f8d5f8,0xd617d5f7,0xe618de38,0xfefaf679,0xff5cff19,0xfe97ff3a,0xff39fed8,0xe6d8ff19,0xf7bcfffe,0x7b4dc596,0xffbdc576,0x7b907207,0x6351424c,0x6b923a0c,0x5af25af1,0x5acf7bf4,0x5a2aacb5,0xb4d440e4,0xc576bd56,0x6b2fce19,0x5b108475,0x73b28434,0xc65a94b6,0xbdba0824,0x94b6b579,0x8435a539,0x9cf76b91,0x8cb78434,0x52cf8455,0x5b0f10e7,0xc618b597,0xe71ba534,
-0xe6fa946f,0xde78bd75,0xb554ac91,0xbdb9e6bb,0xa559ad79,0xa5599d18,0xa5399d19,0x9d199d19,0x9d399d39,0x9d399d39,0xa57aa55a,0xad79a519,0xe6fcc5d9,0xffffffff,0xff7cffbd,0xddd2ffbe,0xffffbdd6,0xffffffff,0xff7bf77c,0xeebae6da,0xff3ce699,0xfffeffbc,0xeedaffbc,0xe6baeeda,0xdebadeba,0xe6fade9a,0xb3eef71b,0xf73cf77e,0xe6baef3c,0xf73cf73c,0xfefcf6fc,0xe65ae67b,
-0x7c575b73,0x74377417,0x7c787c78,0x7c587c79,0x7c587c58,0x7c587c58,0x74387c58,0x74587438,0x6c377437,0x743863d6,0x6c186bf7,0x6c177438,0x6c186c17,0x6c176c18,0x74176c17,0x5b556bd7,0x5b536395,0x5b545b95,0x63b65b54,0x6bf763b6,0x6bf76bf7,0x6bf76bf7,0x63d763d7,0x63d663d6,0x63d66bf7,0x63d763d6,0x63b663d7,0x63d663d6,0x63d66bf7,0x63d663b6,0x63d663d6,0x63d663d6,
-0x63b663b6,0x63d663b6,0x5b9663d6,0x63b663b6,0x63b663b6,0x63b663b6,0x5b9663b6,0x63b65b96,0x5b955b96,0x5b9663b6,0x5b9663b6,0x5b965b96,0x5b955b96,0x5b965b95,0x5b755b76,0x5b755b75,0x5b755b76,0x5b755b75,0x5b755b75,0x53555b75,0x5b555355,0x5b755355,0x5b755b75,0x53555355,0x5b755b75,0x5b755b75,0x5b755b75,0x73d65b95,0xb55894b6,0xcdf7bd77,0xd618cdf7,0xcdd7d5f8,
-0xcdb7d5d7,0xd618cdd7,0xe658de59,0xee58ddf7,0xff1afed9,0xf677f6d9,0xff5af6b8,0xfffef73b,0xf677fffe,0x8baf9411,0x5a0ac576,0x20c6c61a,0x31ab6351,0x3a2d5acf,0x63533a0e,0x00246b72,0x20a57b71,0x93afff3e,0xd618e639,0xce19bd96,0x63516350,0x31cb9cf8,0xee5ba4f6,0x6b2ece1a,0xa538b579,0x7c158c77,0x212994f8,0x8c768c76,0x6bb273b3,0x4a6d29aa,0xde39ad37,0x9b6a40c2,
-0xff5cffbc,0xde78f75c,0xe678ff9d,0xb599ef1c,0xa559ad79,0xa559a559,0x9d19a539,0x9d199d19,0x9d399d19,0xa5399d39,0xa57aa55a,0xce1ab599,0xeefade7a,0xfffeffde,0xff9dffbd,0xffddff3a,0xffffffff,0xffffffff,0xff9cfffe,0xc555eeb9,0xe67ae659,0xff9df6ba,0xde59ff7d,0xd618e67a,0xde79eebb,0xfe3ae6ba,0xd6bc9491,0xeefce6da,0xeedcd65a,0xc597de19,0xb432ee19,0xbaaac4d4,
-0x63955b74,0x74586bf6,0x7c787c78,0x7c587c79,0x7c587c58,0x7c587c58,0x74387c58,0x74377438,0x6c376c17,0x74386bf7,0x6c186c17,0x6c177438,0x6c186c17,0x6c176bf7,0x74176c17,0x63b66bf7,0x63b56396,0x5b545b54,0x6bd65334,0x63b65b75,0x6bf76bf7,0x6bf76bf7,0x63d763d7,0x63d663d6,0x63d66bf7,0x63d763d6,0x63d763d7,0x63d663d6,0x63d663d6,0x63d663b6,0x63d663d6,0x63d663d6,
-0x63b663b6,0x63d663b6,0x5b9663b6,0x63b663b6,0x63b663d6,0x63b663b6,0x63b663b6,0x5b9663b6,0x5b9563b6,0x5b9663b6,0x5b9663b6,0x5b965b96,0x5b955b96,0x5b765b95,0x5b755b76,0x5b755b75,0x5b755b76,0x5b755b75,0x53555355,0x53555b75,0x53355355,0x5b755355,0x5b755b75,0x53555b75,0x5b755b75,0x5b755b75,0x5b755b75,0x84375b75,0xc5d8a4f5,0xcdf7c5d8,0xd618cdf7,0xd5f7d618,
-0xcd96cdd7,0xd5f7c596,0xde38de38,0xe5f7de38,0xfed8e617,0xee57ff5b,0xde77f6d9,0xff5bff5a,0xf676ff9d,0xc597acd4,0x7b6f8bd0,0x8c135189,0x63518434,0x5b315acf,0x843752d0,0x94b68456,0x29060824,0xbd1549ca,0xcdd6ddb6,0xe6fade79,0x94b68c75,0x8c966b92,0x20e7bdba,0xbdd8e6dc,0x9cf7ad37,0x84367c17,0x739352af,0x84356311,0x8c9631cb,0x9d187c14,0xbcf45a6e,0x9a89cdb6,
-0xff5afef9,0xfffefffe,0xee97ffde,0xb599e6bb,0xa559ad79,0xa559a559,0x9d19a539,0x9d199d19,0x9d399d19,0xa5399d39,0xa559a55a,0xeefdbdd9,0xf71beedb,0xffddffbd,0xff9dffbd,0xffbcf79e,0xffffffff,0xffffffff,0xfffefffe,0xd5f8d5f5,0xde39cdb8,0xff5bf73c,0xd619eedb,0xd619d619,0xd5d7de19,0xc69b6249,0xe67bd63b,0xe6dcd619,0xe6dce69b,0xe71ce73d,0xeefbce38,0x71868289,
-0x63b56bd5,0x745863d6,0x74587478,0x74587458,0x74587458,0x7c587458,0x74387438,0x6c187438,0x74386c18,0x6c176c18,0x6c176c18,0x6c176c18,0x6c176c17,0x6bf76c17,0x6c176c17,0x6c176bf7,0x6bf763d6,0x63d65b75,0x63b65b75,0x63b65b75,0x6bf763d7,0x6bf763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d663d7,0x63b763b7,0x63d763d7,0x63d763d7,0x63b663d7,0x63b763b7,0x63b763b7,
-0x63b763b7,0x63b763b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x5b9663b6,0x63b65b96,0x5b9663b6,0x63b65b96,0x5b955b96,0x5b955b95,0x5b765b95,0x5b765b96,0x5b755b75,0x5b755b75,0x53555b75,0x5b755b75,0x53545b75,0x53555b75,0x53555355,0x53555355,0x5b755b75,0x5b755355,0x5b755b75,0x5b755b75,0x5b755b75,0x6bb55b95,0xc5d99c55,0xd618cdd8,0xde39d618,0xd5f7d618,
-0xc597cdd7,0xcdb7c596,0xd617d5d7,0xde18d5f7,0xff1ad5d6,0xee98ff1a,0xee16fef9,0xee16ee78,0xeed9fe96,0xbdb68c10,0x41a8bdb6,0x62ceb578,0x6b92422c,0x7c15426e,0x9cd76b72,0x6b718415,0x62ef0003,0x834ff71f,0xe6578b2c,0xb533de78,0x7bf39cf7,0x6330424d,0xa4f69cb6,0xe6dabd96,0x9d17ad77,0x18c773b3,0x5b117bf4,0x84558c96,0x73d45b10,0x94b773d4,0x7b729cf7,0x9c926aed,
-0xffffffbd,0xfffefffe,0xff9dffbd,0xbdf9de7a,0xad79b5b9,0xa55aad7a,0x9d1aa539,0x9d199d19,0x9d199d19,0x9d199d19,0xad38ad7a,0xd639bdb9,0xf7bdffde,0xfffeffff,0xff9dffde,0xffffffbd,0xffffffff,0xffffffff,0xfffeffff,0xbd36e618,0xcdd8cdd9,0xd5d8f6dc,0xcdb9d619,0xcd78a494,0x9494cdfa,0xc61bbe1c,0xd69bce5a,0xd63ac5b8,0xff7deefc,0xdd55ef9d,0x9145cc0f,0x28814102,
-0x5b945b74,0x6c175b95,0x74587458,0x74587458,0x74587458,0x74387438,0x74387438,0x74387438,0x74387438,0x6c186c17,0x6c186c17,0x6c176c17,0x6c176c17,0x6bf76bf7,0x6bf76bf7,0x6c176bf7,0x6bf76bf7,0x63d76bf7,0x63b66bf7,0x63d763b6,0x63d66bd7,0x63d763d7,0x6bf763d7,0x63d663d6,0x63b763b7,0x63d663d6,0x63b763d7,0x63d763b6,0x63d763d7,0x63b763b7,0x63b663b7,0x63b663b6,
-0x63d75b96,0x63b65b96,0x63b663b6,0x63d663b6,0x63b65b96,0x63b663b6,0x63b663b6,0x63b663b6,0x5b965b96,0x5b955b95,0x5b965b96,0x5b955b75,0x5b965b95,0x5b765b76,0x5b755b76,0x5b755b75,0x5b755b75,0x53555b75,0x53545b75,0x53555b75,0x53555355,0x53555355,0x5b755b75,0x53545b75,0x53555355,0x53555b75,0x5b755b75,0x5b555b75,0xacd67b94,0xcdd7bd57,0xd618d618,0xd5f8d5f8,
-0xcdd7d5f8,0xcd96cdb7,0xd5d7cdb7,0xe658d5d7,0xe637e658,0xff5bee37,0xddd6e658,0xf636ddf6,0xeeb9ee97,0xa451d617,0xb557febb,0x6b104a0a,0x6351632f,0x631173d3,0x94b694b7,0x528d18c7,0x8c756331,0x7b2f8bf4,0xee77ee7a,0xe69af6f9,0x52ae9cd6,0x7bf36351,0x83b1422c,0xddf7832d,0xad57c5d8,0x94d6ad98,0x6b926b73,0x94d79d17,0x6b536351,0x73d58c96,0x9cf79cf8,0x93efbd56,
-0xfffff6f9,0xfffffffe,0xff5cffff,0xd69be6bb,0xadb9c61a,0xad79be1b,0x9d1aa539,0x94f99d19,0x94f994f9,0x9d1994f9,0xb5b9b5ba,0xe69abdba,0xfffeffff,0xfffefffe,0xffbdffde,0xffffff9c,0xffffffff,0xffffffff,0xfffeffff,0xb598d618,0xde1b9412,0x9c12cdd8,0xa454c598,0x526cd61a,0xc61abdfa,0xc5fabdd9,0xce19c61a,0xcdf9bd97,0xf73cef1c,0x70a0ec93,0x28a060e2,0x28622040,
-0x63d67c78,0x6c175333,0x74587458,0x74587458,0x74387458,0x74387438,0x74387438,0x74387438,0x6c186c18,0x6c186c18,0x6c176c18,0x6c176c17,0x6c176c17,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x6bf76bf7,0x63d76bf7,0x5b9663d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d663d6,0x63d763d7,0x63b663d7,0x63b763b7,0x63b763b7,0x63b763b7,0x63b763b6,0x63b663b6,0x63b763b7,
-0x63d763b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b65b96,0x5b9663b6,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b755b75,0x5b755b76,0x5b755b75,0x53555b75,0x5b755b55,0x53555b75,0x53555355,0x5b555355,0x53555355,0x53555355,0x5b755b75,0x53555355,0x53555335,0x53555355,0x5b755b75,0x53555b75,0x7bd46375,0xbd77a4d5,0xd5b8bd36,0xd638de39,
-0xd618d618,0xcdd7cdd7,0xcdb7d5f8,0xe638d5d7,0xd5b5ee99,0xff1ae637,0xde16f6b9,0xe5f6f6d9,0xde17ee58,0x9c33acb3,0x7b9349cb,0x5a6c8c15,0x8433c5b6,0x7bf57bf4,0x7bd38436,0x0045316a,0x52ae6310,0xa4d6424e,0xcd13bd14,0xce38f6fa,0x8473ad77,0x7bd2a516,0xde59de7b,0xcdf87b0d,0xde59d618,0x94d794b6,0x6b937c35,0x94b78c96,0x5af06b71,0x94f69d17,0x949594b7,0xcdf5bd75,
-0xfffeff1b,0xfffeffff,0xff9dfffe,0xf71cf75b,0xc5fad67a,0xad79bdb9,0x9d19a559,0x94f994f9,0x95199519,0x94d89519,0xb57a9cf8,0xeeb9ce1a,0xffbdfffd,0xfffefffe,0xfffefffe,0xfffff7dd,0xffffffff,0xffffffff,0xfffeffff,0xad15cdd7,0x9c13d67b,0xb537c599,0x8c1472ee,0xc61b8c96,0xbddabdda,0xbe3ab599,0xc5d8ce3a,0xbe78c577,0x78a3ff7c,0x38a17185,0x18821800,0x8c910883,
-0x6c166c16,0x74587458,0x74587437,0x74387458,0x74387438,0x74387438,0x74387438,0x6c187438,0x6c176c18,0x6c186c18,0x6c176c17,0x6c186c17,0x6bf76bf7,0x6c176bf7,0x6bf76bf7,0x6bf76bf7,0x6bd76bf7,0x6bf76bd7,0x63d763d7,0x63d763d7,0x63d763d7,0x6bf763d7,0x63d663d6,0x63d663d6,0x63b663d7,0x63b763b7,0x63b663b7,0x5b9663b7,0x63b763b7,0x63b663b6,0x63b663b7,0x63b663b6,
-0x63b763b7,0x63b663b6,0x5b9663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x5b955b96,0x5b9663b6,0x5b965b96,0x5b756396,0x5b765b76,0x5b765b76,0x5b765b75,0x53555b96,0x53555355,0x5b755355,0x53555b75,0x53555b75,0x5b555b75,0x53355335,0x53555355,0x53555335,0x53345b75,0x53555355,0x53555355,0x53545354,0x5b755b75,0x5b755b75,0x73b56355,0x9c769475,0xc598acb5,0xde59d638,
-0xde58de79,0xd618d5f8,0xcdb7d618,0xd5f7d5f8,0xe657e658,0xeed9eeb8,0xde36f73a,0xe637ff3b,0xd5b7c4d2,0x3169bd56,0x5b1073b3,0x8bd26b72,0xc618bd54,0xa4f68413,0x10659495,0xbdfb7bb3,0x63518435,0x524e6312,0xa432732f,0xe6faff5b,0xce59deba,0x9c72f73d,0xbd16b516,0x93f3d5b8,0xddd9a494,0x63319cb7,0x6b738456,0x8c758476,0x8c956b92,0x847694f7,0x8c349cf8,0xde36ce18,
-0xfffeffbd,0xffddffff,0xfffeffbd,0xf75cffdd,0xce3ae6fb,0xb5b9bdf9,0x9d39a559,0x94f99d19,0x95199519,0x9cf894f9,0xa53894d8,0xde17c598,0xffbbffbd,0xffffffdd,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,0xffdeffff,0xce19cdf7,0xd5baa4d5,0xacf6a4b5,0x9d183188,0xbdd9be1b,0xc61bc61b,0xbdb9c61b,0xc5b8ce1a,0x7001d556,0x51446041,0x10202040,0x322b0863,0x52a9f7ff,
-0x6c177417,0x7c587c58,0x74387458,0x74387438,0x74387438,0x74387438,0x74387438,0x74386c18,0x6c176c17,0x6c176c17,0x6bf76c17,0x6bf76bf7,0x6bf76bf7,0x63d76c17,0x6bf76bf7,0x63d76bf7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x6bd763b7,0x63b763d7,0x63d763d7,0x63b763b7,0x63b763b6,0x63b763b6,0x63b763b7,0x63b763b7,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,
-0x63b663b6,0x63b663b6,0x63b663b6,0x5b9663b6,0x5b9663b6,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b76,0x5b765b75,0x5b755b75,0x5b765b96,0x5b755b55,0x53555b75,0x5b755355,0x5b555b75,0x53555b75,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555335,0x53345355,0x53555355,0x53545354,0x53555355,0x5b555354,0x6b955b75,0x84368415,0xc5179c55,0xde38cd76,
-0xe6baeeba,0xde59d617,0xcdb7de38,0xe638cd96,0xf71aeeb9,0xffbdeed9,0xff59f73a,0xe678ddf5,0xc577d5f7,0x8434a495,0xce5bc5b8,0x732d7bf2,0xde99e6b8,0x8b909453,0x6aee8bb1,0x6b928c96,0x39cb94b6,0x4aaf6b93,0xa49652d0,0xff9cf657,0xe659ff3b,0xff1dc4b4,0x8c15ad39,0x83d58c34,0x84368456,0x6b947c37,0x6b947c35,0x94b67c35,0xad379cd6,0x8c9894d7,0xa5388c96,0xff9cde18,
-0xffffffff,0xfffeffff,0xfffffffe,0xfffeffff,0xef1cef3c,0xbdf9dedc,0x9d58ad79,0x95189d19,0x94f894f9,0x94d89519,0x9cd79cf8,0xe5b7d65a,0xfffdff19,0xffffffbc,0xfffeffff,0xfffffffe,0xffffffff,0xffffffff,0xffbdffff,0xef3cf73b,0xacf6b557,0x8c553929,0xb579b5ba,0xb579b59a,0xc619c5f9,0xbd56ce39,0xc514c576,0x410438a2,0x10201840,0x00621862,0xbdf99538,0x8b6fbdb7,
-0x6bf65334,0x6bf76bf6,0x6c176c17,0x74387458,0x74387438,0x74387438,0x6c187438,0x6c186c18,0x6c176c18,0x6c176c17,0x6bf76c17,0x6bf76bf7,0x6bf76c17,0x6bf76c17,0x63d76bf7,0x6bd763d7,0x63d763d7,0x63d763d7,0x6bf763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63b663d7,0x63b663b6,0x63b763b6,0x63b663b6,0x63b65b96,0x63b66396,0x63b663b6,0x63b663b6,
-0x5b9663b6,0x63b663b6,0x63b663b6,0x63b65b95,0x63b663b6,0x5b965b96,0x63b65b96,0x5b765b96,0x5b965b96,0x5b965b76,0x5b755b76,0x5b765b75,0x5b755b76,0x5b755b75,0x53555b55,0x53555b76,0x53555355,0x5b755355,0x53755375,0x53355355,0x53355335,0x53355335,0x53355355,0x53345355,0x53355335,0x53545354,0x53345355,0x5b555355,0x63755b55,0x7bf57394,0x83f47bb4,0xdd979bf5,
-0xe679ee79,0xde58de58,0xd5d7d638,0xcdb6bd35,0xf6faee78,0xff5aff5b,0xff3aff3a,0xff9cff1a,0xa494e6da,0x7bb149ee,0xeed9ee98,0xf73bce36,0xe6daff9c,0x73119453,0x10847371,0x6b936351,0x8434298b,0x7c3531cc,0x83d47c15,0xd4f5ac14,0xb494cd76,0x635241cb,0x73b473b3,0x63938cb7,0x7c3673d5,0x8c988437,0x6bb48456,0x4a6f7c35,0x7c358c96,0x94b794d8,0xbdd89cd6,0xff9de659,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xff5cffbd,0xd69aff7d,0xa559be1a,0x95189d19,0x8cb894d8,0x73d68477,0x73736b95,0xbd76acd6,0xffdfeeb9,0xfffdff9c,0xffdfffdd,0xffffffdd,0xffffffff,0xffddffff,0xfffeffff,0xff9dff3b,0x9cf78c12,0xa5386bd3,0xad18ad58,0xbdb9b579,0xbd97c619,0x6208bcd3,0x48e47a89,0x18413103,0x00000820,0xffff62ec,0xce7bc63b,0x3968acf6,
-0x3a506bd6,0x4b13218d,0x5bb763d7,0x6bf76c18,0x74587439,0x74387438,0x74386c18,0x6bf76c18,0x6c176c18,0x6bf76c17,0x6bf76bf8,0x6c186c18,0x63d76bd7,0x6bf76bf7,0x6bd76bf7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763b6,0x63b763b7,0x63b763b7,0x63b763b7,0x63b663b7,0x63b663b7,0x63b663b6,0x63b663b6,0x63b65b96,0x63b663b6,0x63b663b6,
-0x5b9663b6,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b76,0x5b765b75,0x5b965b76,0x5b755b76,0x53555b76,0x5b755b76,0x53555b75,0x5b755b75,0x5b755b75,0x53555b75,0x53555b55,0x53555355,0x53345b75,0x53555335,0x53555355,0x53355334,0x53145355,0x53355334,0x53355335,0x53545334,0x53545354,0x5b555355,0x5b555b55,0x63b56395,0x6bb56bb5,0x8bd66b54,
-0xd597b475,0xe678de39,0xd638e65a,0xc576d618,0xee98e658,0xee35fefa,0xff1cff3a,0xff7dff3c,0xd5b7ffde,0x6b315acf,0xcd55b4d5,0xeed9dd73,0xfefafffd,0x83b37b71,0x4ad17bb3,0x6352298c,0x7bf331ad,0x7bf5214a,0x84366b93,0x83f56b73,0x52908c56,0x5b10528f,0x8c765b11,0x5b3273d5,0x7c157c36,0x84788478,0x73f68457,0x63736393,0x7c377c36,0x94d88cd8,0xee7ade7b,0xffbdee79,
-0xfffefffe,0xfffffffe,0xfffeffff,0xffffffff,0xffdfffff,0xf77cffde,0xad9ace59,0x95189d39,0x8cd79d19,0x8cb88cd7,0x8c988cb8,0xbdba94b8,0xf77cc557,0xff5cffbb,0xfffefffe,0xff5affdf,0xffddffbb,0xfffeffdf,0xffddfffd,0xff9ef739,0xb5b8f75d,0xbddbbdb9,0x422d31cc,0x7bd241eb,0x94116b0d,0x72ec93cf,0x38c35944,0x08000820,0xadd70861,0x938e6249,0xd5b9ff5f,0x8bb19c54,
-0x6bd65b94,0x63b65334,0x533563b7,0x5b966c18,0x745863d7,0x6c187438,0x6c176c18,0x6bf76c18,0x6c176c18,0x6bf76c17,0x6bf76bf8,0x6bd76bf7,0x63d76c18,0x63d76bf7,0x6bd763d7,0x63d763b6,0x63b663d7,0x63b663d7,0x63d763d7,0x63b663b6,0x63d763b6,0x63d763b6,0x63b763b7,0x63b763b7,0x63b763b7,0x63b663b7,0x63d763b7,0x63b663b6,0x63b663b6,0x63b663d7,0x63b663b6,0x63b663b6,
-0x5b9663b6,0x5b965b96,0x5b965b96,0x5b965b96,0x63b65b96,0x5b965b96,0x5b965b76,0x5b765b75,0x5b755b76,0x5b755b76,0x5b765b76,0x5b755355,0x53555b75,0x5b755b75,0x5b755b75,0x53555b75,0x53555b55,0x5b755355,0x53555335,0x4b345335,0x53345355,0x53355334,0x53555314,0x53355355,0x53355335,0x53545334,0x53545354,0x5b555355,0x5b555b55,0x63956395,0x63746374,0x63545b74,
-0x93d36b14,0xe658cd98,0xde79ee9a,0xc555d5f8,0xe617de17,0xfedaf6da,0xf6b9ff1b,0xf616feb8,0xbd57fed9,0x63315ad0,0xc4f47b0f,0xed95c492,0xddf8fe58,0x4a4f526e,0x639352b0,0x29ab5b11,0x4a6e7bf5,0x73d439ed,0x7bf573d4,0x84156332,0x845652b0,0x4a8e31ab,0x6b938c76,0x84574ab1,0x6bb38497,0x84578cb8,0x6bd573f6,0x73d57c56,0x84787c36,0x95188c97,0xb516b558,0xff9cd5b7,
-0xffdeffdd,0xffbdffde,0xfffeffdd,0xffffffff,0xffffffff,0xffbdffff,0xc63ae71b,0x9d39ad79,0x94f89d19,0x94d894f8,0x8cb894d8,0xad599cd8,0xedb8a495,0xfed9f5f6,0xff7bff5b,0xffffffde,0xffdeffdf,0xf6f9fffd,0xff5bff19,0xeef9ffdd,0x9c119c4f,0x95198cb6,0x9d38adbb,0xa4f6a517,0x7b4e8c11,0x51a7834d,0x10012082,0x42490020,0x5a2a49c8,0x7b0e3967,0xacd549c9,0xcd9693cf,
-0x74176395,0x6bd66bd6,0x73f76395,0x6bf863d7,0x74387438,0x6c176c17,0x6c176c17,0x6c176c17,0x6c176c17,0x6bf76bf7,0x6bf76bd7,0x63d76bf7,0x63d763d7,0x63d76bf7,0x63d76bf7,0x63d76bd7,0x63d763d7,0x63d763d7,0x63b663d7,0x63b663b6,0x63b663b7,0x63b65b96,0x63b763b7,0x63b663b6,0x63b763b6,0x63b763b6,0x63b66396,0x5b965b96,0x63b663b6,0x63b65b96,0x5b965b96,0x5b965b96,
-0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b76,0x5b755b96,0x5b755b75,0x5b755b76,0x5b755b75,0x5b755b75,0x5b755b75,0x53555355,0x53555b75,0x53555355,0x5b755b75,0x53355355,0x53555355,0x53555334,0x53555335,0x53344b34,0x53355335,0x53345334,0x53345335,0x4b145334,0x53345334,0x53545354,0x53345334,0x5b555b54,0x5b5563b5,0x5b555b55,0x63756335,
-0x63945b94,0xde3893b3,0xe679ee9a,0xcdd7d5f8,0xee59de58,0xeed8f69a,0xac12e638,0xb495b414,0x74357350,0x63734ab0,0x83d47b71,0x9bd18352,0x8350bc95,0x42716b53,0x5b114ad1,0x3a4e424f,0x5b327c15,0x6bb4424e,0x63933a0d,0x5b126bb3,0x94b752d1,0x4a8d0885,0x84356372,0x73d56353,0x6bb48456,0x7c167c16,0x84987c16,0x7c367c56,0x84788c98,0x8c968456,0xa4d794d8,0xff3bd5d9,
-0xff9dff9d,0xff7cf73b,0xfffefffd,0xffffffff,0xffffffff,0xffffffff,0xdeb9f75c,0xa559c5f9,0x95189d19,0x94f89518,0x94d994d8,0x9cd79cf9,0x94b79cd7,0xff9dbc74,0xffdeffde,0xffbcfffd,0xfffffffe,0xfffeffff,0xff9cff3b,0xffdedf3b,0xb61aef7c,0xb5b9dedd,0xad98adba,0x9cf68c54,0x5a6aad15,0x29246249,0x19461843,0x630d0002,0x21c80083,0x6b0f4a2b,0x6b0d9452,0x18023043,
-0x63733a0d,0x7c384ad1,0x6bd77437,0x74377417,0x6c177437,0x6c176c17,0x6c176bf7,0x6c176bf7,0x6c176c17,0x6bf76bf7,0x6bf763d7,0x63d76bf7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763b7,0x63b663b7,0x63d763b6,0x63b663b7,0x63b663b6,0x63b663d7,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,
-0x63965b96,0x63965b96,0x5b965b96,0x63b65b96,0x5b765b96,0x5b765b96,0x5b755b76,0x5b755b96,0x5b755b75,0x5b755b75,0x5b755355,0x53555b75,0x53755355,0x53555355,0x53555b55,0x53555355,0x53555355,0x53355b55,0x53345334,0x53345335,0x53345334,0x53355334,0x53345334,0x53345334,0x4b145334,0x4b145334,0x53345334,0x53345334,0x53345b54,0x5b545b34,0x53345b54,0x63955b74,
-0x63956374,0xb4747374,0xddb7ccf6,0xc576bcb4,0xd5b7d638,0xac54c555,0x7bd49392,0x62f16b33,0x63726b31,0x63945b53,0x6b734af1,0x6b536352,0x5ad07394,0x192b424e,0x63946394,0x5b3229ad,0x6b945b12,0x6bd4216d,0x52f252f3,0x63947c56,0x8c9673b4,0x6351ad9a,0x63527c36,0x847652f1,0x7c355b32,0x845794d8,0x7c778437,0x84577c77,0x84578c98,0x8c988478,0x9cd78cb7,0xfefbc5b8,
-0xff3bff5c,0xff1bff5c,0xfffeff1a,0xffffffff,0xffffffff,0xffffffff,0xf75cffdd,0xb5b9defc,0x9d18ad3a,0x94d894f8,0x8cb894d8,0x8c768c97,0x73d48c96,0xd4f39476,0xed73f5f5,0xfffdfe99,0xffffffdd,0xffbdffdf,0xff1bfefa,0xff1aff3b,0xeefbff3b,0xce5be6dc,0xad57b599,0xacf5a4d4,0x5a4a628b,0x08432945,0xef7f39a9,0x84320023,0x8c737bf1,0x83d0630e,0x624bde5b,0x630e0843,
-0x422d52af,0x6bb45b52,0x32106395,0x74794b14,0x63d65355,0x6c176c17,0x6c176c17,0x6c176c17,0x63f76c17,0x6bf76bf7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63b763d7,0x63b763b7,0x63b763b7,0x63b763b7,0x63b763b7,0x63b763b7,0x63b663d7,0x63b663b6,0x63b663b6,0x63b663b6,0x63b66396,0x5b9663b6,0x63b663b6,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,
-0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b96,0x5b765b75,0x5b965b76,0x5b755b75,0x5b755b75,0x53555b75,0x53555355,0x53755355,0x53555375,0x53555355,0x53555355,0x53555355,0x53355334,0x53355335,0x53345334,0x53345334,0x53345334,0x53345334,0x53345334,0x53345334,0x53345334,0x53345334,0x53345334,0x5b545334,0x5b745b55,0x53545b74,0x5b755b54,
-0x6bb55b74,0x63957393,0x73b47394,0x93f37394,0xcd77cdb7,0x7395ad16,0x63545b94,0x5b334ad2,0x63545b32,0x63745b33,0x63946bd6,0x5b126bb5,0x3a2e4a90,0x29cd3a70,0x531263b4,0x63523a0e,0x63744a90,0x63930048,0x5b335313,0x5b547415,0x84578456,0x428f73f5,0x637473d5,0x84766b94,0x7c366374,0x7c368497,0x7c778437,0x84787c57,0x84788478,0x84788478,0x9cd894b8,0xf6bacdd8,
-0xf6dbde18,0xddd8e639,0xffdde638,0xfffeffde,0xfffffffe,0xffffffff,0xfffeffff,0xce59ff9c,0x9d18c63a,0x8cb894f9,0x8c978477,0x84778476,0x94b58477,0xa4f77c35,0xacd79496,0xedd8bcf8,0xffbdfe99,0xff1bffde,0xe65ad639,0xe639d5f8,0xcdb8d5d8,0xce39cdd8,0x6aab9452,0x52295229,0x3167522b,0x3a2a18e5,0xb5b973d1,0x41c931a9,0x737020c5,0x59876acc,0x83f14106,0x52296b2c,
-0x7c135aef,0x196a2149,0x090c0088,0x53346bd6,0x5bb66418,0x6c1863f7,0x6c186c18,0x63f763f7,0x63f763f7,0x63f763f7,0x63f763f7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d75bb6,0x63d763d7,0x63d763d7,0x63d763d7,0x63b763b7,0x63b763b6,0x63b663d7,0x63b663b6,0x63b663b6,0x63b663b6,0x5b965b96,0x63b663b6,0x5b9663b7,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,
-0x5b965b76,0x5b965b96,0x5b965b96,0x5b765b96,0x5b765b75,0x5b765b76,0x5b755355,0x5b755b75,0x5b755b55,0x53555355,0x53555355,0x53555355,0x53755375,0x53755375,0x53345355,0x53555355,0x53555355,0x53355335,0x53345334,0x53345334,0x4b145334,0x4b144b14,0x4b145334,0x53345334,0x4b145334,0x53345334,0x53345334,0x53345334,0x5b545b54,0x63955b75,0x5b546395,0x5b745b54,
-0x6bb46b74,0x6bb56bb5,0x6bb56bb5,0x83f56bb5,0xbd379c54,0x74369cb5,0x5b346374,0x3a715333,0x5b745b54,0x4af25334,0x6bb563b5,0x4ad152d1,0x4ad03a70,0x4af152f2,0x4ad14ab1,0x428f5312,0x63b43a4e,0x639429cd,0x5b745312,0x6bb67416,0x6bb67416,0x3a506bf5,0x5b736bd5,0x7bf57c15,0x6bd56374,0x7c577c57,0x7c577c77,0x7c777c78,0x84777c77,0x8c988477,0x8cb894d8,0xc517acf7,
-0xe65ade1a,0xc577c537,0xff1bde19,0xfe98e596,0xfffeff9d,0xffffffff,0xffffffff,0xeefcfffe,0xa538bdfa,0x8cd894f8,0x8c988c98,0x8c988477,0x84778457,0xb5999cf8,0x9c98c5fa,0xad18a4f8,0xff3cd599,0xf73bff7c,0xcdd8e6ba,0xcdd8d5f9,0xacf7d5fa,0xc5b9bd98,0x4968728c,0x29465229,0x08a51907,0x00020044,0x9cb473b0,0x4b0f52ce,0x49a74a6b,0x10011842,0x5a294186,0x39652021,
-0x63516331,0x63746332,0x6bb66bb5,0x4af37417,0x63f73a92,0x6c186c17,0x6c1863f7,0x63f763f7,0x63f763f7,0x63d763d7,0x63f763f7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63b763d7,0x63b763b7,0x63d763d7,0x63d763d7,0x63b763b7,0x63b763b6,0x63b663b6,0x63b663b6,0x5b965b96,0x63b65b96,0x5b965b96,0x63b65b96,0x5b9663b7,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b96,
-0x5b965b96,0x5b965b96,0x5b766396,0x5b765b76,0x5b755b75,0x5b755b75,0x5b755b75,0x5b755b75,0x53555b55,0x53555b75,0x53555355,0x53755355,0x53755375,0x53555355,0x53555355,0x53555355,0x53555335,0x53355314,0x53345334,0x53345334,0x53345334,0x53345314,0x4b145334,0x4b144b14,0x53345334,0x53345334,0x53345334,0x53345334,0x5b545b55,0x63745b75,0x63746395,0x5b745b54,
-0x6b946bb5,0x6b9473d6,0x6b956b95,0x7bf573d6,0x73947394,0x63747c35,0x5b555333,0x53344ad2,0x5b745b75,0x5b745b75,0x531363b5,0x53334af3,0x4ad14ad1,0x429052f2,0x5b535b53,0x4ad1428f,0x4af15b32,0x6bd53a4f,0x73f67416,0x743673f6,0x10eb73f6,0x6bb66bd4,0x6bf66bf5,0x63737c57,0x7c3773f6,0x7c377c37,0x7c577c57,0x7c577c57,0x84777c77,0x84788478,0x84778cb8,0x94d88c97,
-0xa5179cd8,0x9cf8a4d8,0xacf8a518,0xcd79a4b7,0xf73bddb8,0xfffffffe,0xffffffff,0xef1bffff,0x9d38bdb9,0x8cb894f8,0x84778cb8,0x84578457,0x8cd98c98,0x9cf88cd8,0x94d794b7,0xa4d6b5bb,0xe699c598,0xff7cff3c,0xc597e69a,0xad16cdb7,0xcd37d5d9,0x48e5722a,0x398730e5,0x4a093125,0x31a89494,0x4a2b52cd,0xa4b57b91,0x626b526b,0x00002905,0x39661863,0x398620c3,0x29050821,
-0x31ab0886,0x5b134a90,0x4b144ad2,0x6c176bf7,0x63d663d6,0x6c186bf7,0x63f763f7,0x63f76c18,0x63f763f7,0x63f763f7,0x63d763f7,0x63d763d7,0x63d763d7,0x63d763f7,0x63d763d7,0x63d763d7,0x63d763d7,0x5bb663d7,0x63d75bb6,0x5bb65bb6,0x63b65bb6,0x63b65b96,0x5b9663b6,0x63b663b6,0x63965b96,0x5b965b96,0x5b9663b6,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,
-0x5b965b96,0x5b755b96,0x5b755b96,0x5b965b96,0x5b765b76,0x5b765b76,0x5b755b96,0x53555b75,0x5b755b75,0x53555355,0x53755375,0x53555355,0x53555355,0x53555355,0x53555355,0x53355355,0x53355355,0x53345334,0x4b144b14,0x53345334,0x4b144b14,0x4b145334,0x4b145334,0x53345314,0x4b144b14,0x4b144b14,0x4b144b14,0x53345335,0x5b555354,0x53545334,0x5b955b74,0x5b545b54,
-0x6b956354,0x6b9473d5,0x6bb46374,0x639563b4,0x63955b74,0x5b756bd6,0x53535b74,0x5b745b53,0x5b545b95,0x5b755334,0x53334ad2,0x42b15b74,0x3a705333,0x52f25312,0x53126bb5,0x531242d1,0x63b44ad1,0x741663b5,0x74166bf6,0x74166bd5,0x53126bb6,0x63946394,0x7c566bd5,0x7c3773f6,0x6bf56bd5,0x7c577437,0x7c377c57,0x7c577c57,0x84777c78,0x84778477,0x8c988477,0x94b88c97,
-0x94f894d8,0x94d894f8,0x94f894d8,0x94f894d8,0xcd179cb7,0xff9ced98,0xffffffde,0xffbdffff,0xb5d9d6ba,0x7c179d19,0x8c987c56,0x84568457,0x94d994d8,0x94d994d9,0x94b894d8,0xbdf99cf7,0xde59cdd8,0xf75bfefa,0xad13d657,0xacf5bcf4,0x28006167,0x39662881,0x4a2a41e8,0x49e82946,0x7bb041a8,0x10635aed,0x20e66b4d,0x10424166,0x6b2e41c8,0x18834a29,0x5aab0001,0x31660801,
-0x422d0045,0x08c85b11,0x6bf6426f,0x743863b6,0x63d66bf7,0x6c186c17,0x63f763f7,0x63d763f7,0x63f763d7,0x63d763f7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d75bb6,0x5bb663d7,0x63d75bb6,0x63d75bb6,0x5bb65bb6,0x5bb65bb6,0x5bb65bb6,0x63b65bb6,0x5b9663b7,0x5b965b96,0x5b7663b6,0x5b965b96,0x63b65b96,0x5b9663b6,0x63b663b6,0x5b965b96,0x5b765b96,0x5b965b96,0x5b965b96,
-0x5b965b76,0x5b765b76,0x5b765b96,0x53555b76,0x5b755b75,0x5b755b75,0x5b765b75,0x53555b76,0x53555355,0x53555355,0x4b345355,0x5b555375,0x53555355,0x53555355,0x53355355,0x53355335,0x53345334,0x53345334,0x53354b14,0x53144b14,0x4b144b14,0x53344b14,0x4b144b14,0x4b144af4,0x4b145314,0x53144b14,0x4b144b14,0x53345334,0x53345334,0x53335334,0x5b545333,0x53346395,
-0x5b345b34,0x6b956b95,0x63956b95,0x5b546374,0x74175b74,0x5b756374,0x6bf56395,0x5b7563b4,0x5b545b75,0x63955b54,0x5b746395,0x53136395,0x42914af2,0x4ab13a70,0x5b746bb5,0x4af242b0,0x74165b33,0x73f66394,0x7c3773f6,0x73f67416,0x63744291,0x639473f6,0x74366bd5,0x74167436,0x741663d5,0x7c577c57,0x7c577c57,0x7c577c57,0x84577c57,0x84778457,0x8c988477,0x94b88c97,
-0x94d894b7,0x94b794d8,0x94d894b7,0x94b894b7,0xa51994b7,0xedd7cdda,0xffddfef9,0xff9dfffe,0xe6dce699,0x73d5d69b,0x7c368cb7,0x94d88cb9,0x8cb994f9,0x94f98cb9,0x84568436,0xa4f78c98,0xcdb8bd57,0xe617e638,0xd535ff5c,0x8acb834c,0x18811820,0x420941c6,0x5aab6b2e,0x524a7b8f,0x314628a4,0x08017bcf,0x3166522a,0x29251044,0x8c3118a3,0x20c439c8,0x10422946,0x62cc5aec,
-0x39cb52af,0x3a2e29aa,0x198c426f,0x63b6196d,0x5b755b95,0x5b965b95,0x63f763d7,0x63f763f7,0x63f763f7,0x63d763f7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x5bb65bb6,0x63d75bb6,0x63d75bb6,0x5bb65bb6,0x5bb65bb6,0x5bb65bb6,0x63b65bb6,0x5b965b96,0x5b965b96,0x5b7663b6,0x5b965b96,0x63b65b96,0x5b9663b6,0x5b965b96,0x5b965b96,0x5b765b96,0x5b765b96,0x5b965b96,
-0x5b965b96,0x5b765b76,0x5b765b75,0x53555b76,0x5b755b75,0x5b755b75,0x53555b75,0x53555355,0x53555355,0x53555355,0x4b345375,0x5b555375,0x53555355,0x53555355,0x53355335,0x53355335,0x53345334,0x53345334,0x53354b14,0x53344b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144af4,0x4b144b14,0x53144b14,0x4b144b14,0x4b134b14,0x53345334,0x53335334,0x5b545333,0x5b745b54,
-0x53345334,0x63556355,0x63756355,0x5b545b34,0x74175b54,0x5b756374,0x6bd56395,0x5b745b94,0x5b745b75,0x53335b54,0x63955b75,0x4ad24af2,0x42b16394,0x63955b54,0x6bb56bd6,0x5b535b53,0x42905b33,0x5b535b53,0x741673f6,0x6bd57416,0x63945b34,0x63b57416,0x74367416,0x74167437,0x6c166bf6,0x7c577c57,0x7c577c57,0x7c577c57,0x84577c57,0x84778457,0x84788477,0x94b88c97,
-0x8c978c97,0x94b78c97,0x94d894b7,0x94b994b7,0x9c968cb8,0xb4b89d38,0xff3bd516,0xee99fffe,0xf6fbf6ba,0x9cf8c596,0x84787c14,0x8cb88cb9,0x847894d8,0x8c988478,0x94d894d8,0x94977bf7,0xcdb8bd58,0xbc30c534,0x938dccd3,0x286071e7,0x392418a1,0x630d5acb,0x7baf4a4a,0x4a09ad35,0x730c51e8,0x18629cb2,0x31490801,0x108231c8,0x210339c7,0x294639c7,0x39a85aac,0x7bae1924,
-0x73d36352,0x3a2d1908,0x5b544ab0,0x63f75375,0x63b74af3,0x63f763b6,0x63f763d7,0x63f763f7,0x63f763f7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x5bb75bb6,0x5bb663b7,0x5bb763d7,0x5bb75bb7,0x5bb75b96,0x5bb75bb7,0x63b663b6,0x63b663b6,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,
-0x5b765b76,0x5b765b76,0x5b755b75,0x5b755b75,0x53555b75,0x5b755b75,0x53555b75,0x5b555355,0x53555355,0x53555355,0x53355355,0x53355355,0x53555335,0x53355355,0x53355335,0x53345335,0x4b145334,0x53345334,0x53345334,0x53144b14,0x53344b14,0x4af45314,0x4b144b14,0x4b144b14,0x4b144af4,0x4af44b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b135334,0x53345314,
-0x53345334,0x5b545334,0x63955b74,0x63b65b74,0x5b7563b5,0x63745b74,0x63746395,0x5b546394,0x5b545b54,0x5b745b54,0x53136395,0x5b545334,0x63b55b95,0x63955333,0x6bd66395,0x6bf55333,0x53535b54,0x63b563b4,0x6bf67416,0x5b336bb5,0x6bd54270,0x6bd56394,0x74367416,0x74377c37,0x7c577416,0x7c577437,0x7c577c57,0x7c577c57,0x74367c37,0x7c787c78,0x84778457,0x8c978497,
-0x94b88c97,0x94b794b8,0x94b794b7,0x94b794b7,0x94d794b7,0xa4d794b6,0xff1ae6bc,0xddd6eeb9,0xc515ddf8,0x8c95830e,0x8cb8a558,0x84578cb8,0x8cb88478,0x84778c98,0x84568456,0xa4f88c97,0x626c7b71,0xcdb6c537,0x50a2d513,0x086130c0,0x39a818e4,0x630d6b2e,0xb55662ed,0x31256b4d,0x414520a2,0x10013925,0xa4f57b90,0x21057bd0,0x18a31062,0x5acc1083,0x630c39c9,0x206339c8,
-0x5b327415,0x4a6f0047,0x63745b32,0x63d56bf6,0x53555b94,0x5b965b96,0x63f763f7,0x63d763f7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x5bb763b6,0x5bb65bb7,0x5bb75bb6,0x5bb75bb7,0x5b965bb7,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b966396,0x5b965b76,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b96,0x5b765b76,0x5b765b76,
-0x5b755b76,0x5b755b76,0x5b755b75,0x5b755b75,0x5b755b75,0x53555b75,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53355355,0x53345335,0x53355335,0x53345335,0x53345334,0x53345334,0x53344b14,0x53144b14,0x4b144b14,0x4af44b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x53344b14,0x53344b14,0x4b134b14,0x53344b14,0x53145314,
-0x53345334,0x53545334,0x5b545b74,0x5b545b54,0x5b746c16,0x63745b54,0x63956395,0x5b355b54,0x5b745b74,0x63955b74,0x53135b54,0x5b955334,0x53125313,0x6bd66395,0x63956bd6,0x63b45b54,0x5b745b74,0x639463b4,0x63946bf6,0x63746bb5,0x63944ab1,0x74165b74,0x74167436,0x74167416,0x74167437,0x7c377416,0x7c377c37,0x7c377416,0x74167c37,0x7c577416,0x84778477,0x7c368477,
-0x84778477,0x94b78c97,0x94b794b7,0x8c978c97,0x8c768c76,0x8c368c36,0xff9cf6fb,0xb431ff7c,0x8390b473,0xa4957bb1,0x74156b31,0x7c168c97,0x8c987c37,0x8cb88478,0x635252f1,0x7bf63a10,0x8c138456,0x50e59c11,0x20e220a3,0x3a0a422b,0x7c1331a9,0x39c96b2f,0x6b4e736f,0x10427bd0,0x20a31062,0x106330e5,0x9c722104,0x10624a09,0x20e50801,0x632e73b0,0x5aaba515,0x18c420e5,
-0x6bb57416,0x29ab52b1,0x4a9073b4,0x5b5331ef,0x63966bf5,0x6bf763b7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d75bb6,0x63b763d7,0x5bb75bb7,0x5bb75bb7,0x5bb65bb7,0x5bb65bb6,0x5bb65bb6,0x5b965b96,0x5b965b96,0x5bb65b96,0x5b965bb6,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b76,0x5b765b96,0x5b765b76,
-0x5b755b76,0x5b755b75,0x5b755355,0x53755b75,0x5b755375,0x53555b75,0x53555355,0x53555355,0x53555b55,0x53555355,0x53355355,0x53555335,0x53555335,0x53355335,0x4b145335,0x53344b14,0x53345334,0x53345334,0x4b144b14,0x4af44b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144af4,0x4b144af4,0x4af34b14,0x4af34af4,0x4b144b14,0x53144b14,0x4b144b14,0x4b144b14,0x4b145334,
-0x53345314,0x53345334,0x5b555334,0x5b545334,0x53345b54,0x5b545b55,0x5b745b54,0x5b555b55,0x5b755b55,0x5b755b75,0x4af25b75,0x53136395,0x5b5463b5,0x6bd55b54,0x63b55b74,0x63b55b74,0x6bd66bb5,0x6bd56bd5,0x63956bd5,0x6bb55b54,0x6bd56374,0x7c3773f6,0x6bd57416,0x6bb56bd5,0x63946bb5,0x741673f6,0x74367416,0x7c577c57,0x52f26bd5,0x6b947c37,0x84778457,0x7c368457,
-0x73b47bf5,0x8c978456,0x8c978c77,0x8c568c56,0x739473b4,0x7c157bf5,0xf636c474,0x4905de17,0x626da432,0x5aaf62af,0x73d67393,0x7c167c36,0x8c988436,0x52f1424f,0x63d56395,0x84968476,0x49aa7bb2,0x20a43064,0x3a0920e4,0x5b0f2147,0xb5ba39ca,0x526b420b,0x841083d1,0x082239a7,0x08410000,0x4a2939c7,0x5a494a49,0x39e73985,0x528c528b,0x2947a536,0x39c7732d,0x6b4e4aaa,
-0x7bf67c15,0x52ef6352,0x2108528d,0x4a8e4a6d,0x53533a4f,0x63b76bd6,0x63d763b6,0x63d763d7,0x63d763d7,0x63b663d7,0x5bb663d7,0x5bb65bb6,0x5bb75bb6,0x5bb75bb7,0x5bb75bb7,0x63b65b96,0x5bb65bb6,0x5bb65bb6,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965bb6,0x5b765b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b76,0x5b765b96,0x5b765b76,0x5b755b76,0x5b765b76,
-0x5b755355,0x5b755b75,0x53555355,0x53755355,0x5b755375,0x53555b75,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53355335,0x53355335,0x53355335,0x53345335,0x53345334,0x53345334,0x4b144b14,0x4b144b14,0x4af45334,0x4b144b14,0x4af44b14,0x4af44af4,0x4af44af4,0x4af44af4,0x4b144af4,0x4af44af4,0x4af44b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,
-0x4b144b14,0x53345334,0x5b545334,0x5b545334,0x5b545b54,0x5b545b54,0x5b545b54,0x5b555b54,0x5b755b55,0x5b755b75,0x5b545b75,0x53346395,0x63956395,0x63955b75,0x6bd55b74,0x63b563b5,0x6bd66bb5,0x6bf663b5,0x63956bd5,0x6bd55313,0x6bf66bd5,0x74166bb5,0x74167416,0x6bd67416,0x6bb56bd6,0x63956bd6,0x639473f6,0x5b535b33,0x63745312,0x7c176b94,0x84768456,0x73d48456,
-0x6b528435,0x84569497,0x7bf57bf4,0x7c157bf4,0x84556b52,0x94b794b7,0xc4d4a4b6,0x5146feda,0x83f23905,0x63318454,0x73d473d4,0x4aaf73d4,0x73d5298c,0x84778478,0x63318c97,0x49caa4f7,0x10a51863,0x3a2b10c6,0x52ee2989,0x73922149,0x39ec528f,0x630f6371,0x31462927,0x08430002,0x21043186,0x62ec4a6a,0x396662ec,0x52493166,0xad169452,0x524a8c31,0x3145528a,0x39e962ec,
-0x08c7428f,0x94b831ed,0x10a58436,0x318a4a8c,0x42b041ed,0x5b954b33,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x63d763d7,0x5bb763b7,0x5bb763d7,0x5bb75bb7,0x5bb65bb7,0x5bb65bb6,0x5bb65bb6,0x5bb65bb6,0x5bb65bb6,0x5bb65bb6,0x5b965bb6,0x5bb65b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b76,0x5b555b96,0x5b765b76,0x5b965b76,0x5b755b75,
-0x5b755b75,0x53555355,0x53555b75,0x5b555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53355355,0x53355314,0x53345335,0x53345334,0x4b145334,0x4b145334,0x4b344b34,0x4b144b14,0x4b145334,0x4af44b14,0x4af44b14,0x4af44af4,0x4b144af4,0x4b144b14,0x4af44af4,0x4b144b14,0x4af44af4,0x4b144b14,0x4af44b14,0x4b144b14,0x4b144b14,
-0x4b144af4,0x53344b14,0x53345334,0x53345354,0x53345334,0x53555334,0x53545355,0x53345b54,0x53555355,0x5b755354,0x5b745b75,0x5b755b75,0x5b745b75,0x63b56395,0x6bd56bb5,0x6bd56bd6,0x6bd56bd6,0x6bd66bd6,0x63956bb5,0x63955b54,0x63b56395,0x74166bf6,0x74167416,0x74167416,0x6bf56bb6,0x74366bf5,0x74367416,0x53127436,0x73f44270,0x84566bb3,0x214b5b12,0x31ee218c,
-0x320e3a6f,0x4ab05312,0x5b13322e,0x18e87c17,0x83d3528f,0x8c549c95,0xa2cea434,0x9bd0cbcd,0x41cb5aab,0x528e420b,0x5a8e39cc,0xa5570803,0x83f583f3,0x7c767bf4,0x524c73f3,0x00431023,0x53500085,0x29ec7434,0x9d598496,0x94d58454,0x84750044,0x422b4a6c,0x20e583d1,0x1083528c,0x5aab5aab,0x39c741e8,0x4a093166,0x29069c92,0x294539c8,0x104228e5,0x20c41042,0x94b3defc,
-0x74367c57,0x7c3663d5,0x7c3629ac,0x10e96351,0x53324a6f,0x53544af2,0x5b9663d7,0x63f763d7,0x63d763d7,0x63d763d7,0x5bb663d7,0x5bb75bb7,0x5bb75bb7,0x5b965b96,0x5bb65bb7,0x5bb65bb6,0x5bb65bb6,0x5bb65bb6,0x5bb65bb6,0x5bb65bb6,0x5b965bb6,0x5b965b96,0x5b965bb6,0x5b965b96,0x5b965b76,0x5b765b96,0x53755375,0x5b965b96,0x5b765b75,0x5b755b76,0x5b7663b6,0x5b755b75,
-0x53555b75,0x53555355,0x53555355,0x5b755355,0x53555355,0x53555355,0x53355355,0x53555335,0x53555355,0x53345335,0x53355355,0x53355335,0x53345335,0x53345355,0x53354b14,0x53344b14,0x4b144b14,0x4b344b34,0x4b144b14,0x4b144b14,0x4b144af4,0x4af44af4,0x4af44af4,0x4af44af4,0x4b1442f3,0x4af44af4,0x4af44af4,0x4af44af4,0x4af44af4,0x4af44af4,0x4b144b14,0x4b144b14,
-0x4b144af4,0x4b144b13,0x4b144b14,0x5b545334,0x53345334,0x53545334,0x4b145354,0x5b545334,0x53555355,0x5b755354,0x5b955b75,0x5b745b75,0x63956395,0x6bb55b74,0x6bb56bb5,0x6bd66bd5,0x6bd56bd5,0x639563b5,0x63956395,0x639563d5,0x63b56bb5,0x73f673f6,0x74167416,0x741673f6,0x6bb57416,0x6bd56bd5,0x63746394,0x73f66bd5,0x6b9452f2,0x63534a90,0x73f63a2f,0x84786394,
-0x63b46bf6,0x73f56bf6,0x63736373,0x7c787c16,0x74357416,0x84b77415,0x5b109d7a,0x188673d3,0x5b735b72,0x74366bd3,0x73f45332,0x18c9426f,0x10220846,0x51ea28e5,0x08021823,0x320d00a4,0x6bf47414,0x8cb73a4d,0x008894f8,0x39aa424e,0x9493528c,0x21060843,0x31878c32,0x2946422a,0x526a4208,0x316641e8,0x62ab528b,0x216a2947,0x84124a6d,0x31662105,0x10621082,0x730d5a6a,
-0x63746395,0x63745374,0x3a703a70,0x4ad129ad,0x3a6f6bb4,0x3ab15333,0x5b965375,0x63d763d7,0x63d75bb6,0x63d763d7,0x5bb663d7,0x5bb75bb7,0x5bb75bb7,0x5b965b96,0x5bb65b96,0x5bb65bb6,0x5bb65bb6,0x5bb65bb6,0x5bb65bb6,0x5bb65bb6,0x5b965bb6,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b76,0x5b765b96,0x53755375,0x5b965b96,0x5b765b75,0x5b755b76,0x5b765b96,0x5b755b75,
-0x5b765b75,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53355355,0x53345355,0x53355334,0x53355335,0x53345335,0x53345355,0x53354b14,0x53344b14,0x4b144b14,0x4b344b34,0x4b144b14,0x4b144b14,0x4b144af4,0x4af44af4,0x4af44af4,0x4af44af4,0x4b1442f3,0x4af44af4,0x4af44af4,0x4af44af4,0x4af44af4,0x4af44af4,0x4b144b14,0x4b144b14,
-0x4b144af4,0x4b145334,0x4b144b14,0x53344b13,0x53345334,0x53345334,0x5b755334,0x5b545b55,0x53555355,0x5b755b75,0x5b955b75,0x63955b75,0x63956395,0x6bb563b5,0x6bb56bb5,0x6bd66bd5,0x6bd56bd5,0x73f66bb5,0x6bf66395,0x73f66bd6,0x6bf56bd6,0x73f673f6,0x74167416,0x63b573f6,0x4ad26bf4,0x63957417,0x6bd55b54,0x63947416,0x6b955312,0x5b136354,0x6c174af2,0x63946bf6,
-0x743663d5,0x6bf57c78,0x6b9373f5,0x8c777c36,0x8c788435,0x8c987bf5,0x320c6310,0x21498454,0x4a6e6bb3,0x7c54ad98,0x63107c35,0x84556b50,0x73d17390,0x00010000,0x11ea0064,0x849653f6,0x428f322d,0x4a8f84b8,0x953894b7,0x29085b0f,0x318583f1,0x41c80001,0x39880802,0x31672105,0x39c74a29,0x31663186,0x41a73187,0x8c978cb5,0x1000524b,0x08826b4e,0x08620862,0x296639c7,
-0x5b95112c,0x29ee63b5,0x63b54af3,0x53124290,0x4af25333,0x63f742d2,0x5bb65355,0x63d763d7,0x63d763d7,0x63b663b7,0x5bb75bb7,0x5b965bb7,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5bb65bb6,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b76,0x5b765376,0x53765b96,0x5b765b76,0x53755b75,0x5b755375,0x53555355,
-0x53555355,0x5b755355,0x53755375,0x5b755375,0x53555b75,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53355355,0x53345335,0x53345334,0x53345334,0x4b145334,0x53345334,0x4b144b14,0x4b344b34,0x4b144b14,0x4af44b14,0x4af34b14,0x4af44af4,0x4af44af4,0x4b144b14,0x42f342f3,0x4af34af3,0x4af44af4,0x4af34af3,0x4af34af4,0x4af34b13,0x4b144b14,0x4b134af3,
-0x4b134b13,0x4af44b14,0x4b134af4,0x53344b14,0x53345334,0x53345334,0x53345334,0x5b745b54,0x53545355,0x5b555b55,0x5b755b75,0x63945b75,0x63956395,0x63b563b5,0x63b563b5,0x63b563b5,0x6bb56bb5,0x6bb56bd5,0x6bd66bd6,0x6bf66bd6,0x6bd56bf6,0x73f673f6,0x74166bf6,0x63946bf6,0x5b335b53,0x6bf56394,0x5b746bb5,0x74165313,0x6bb57416,0x5b546bb5,0x74376bf5,0x7c3773f6,
-0x7c577c77,0x74367c57,0x63537416,0x84368457,0x8c968456,0x6371424f,0x6bb37bf5,0x210862f0,0x7bd452cf,0x5af2296b,0x212a18ea,0x4a2b31ab,0x00023189,0x00240023,0x84766415,0x21ac8c76,0x5b328498,0x4a6e52cf,0x73922989,0x10a5528c,0x00001083,0x18c418a4,0x21062966,0x5aac6b2e,0x296731a8,0x29062106,0x39e92946,0xbdda4a6c,0x11060884,0x21c752ab,0x00628453,0x3a0a3a29,
-0x112d3271,0x74175b94,0x4b125334,0x29ce6395,0x5b966bd6,0x63f75bd6,0x5b965355,0x63d763d7,0x63d75bb6,0x63b663b7,0x5b965bb7,0x5bb75bb7,0x5b965bb7,0x5b975b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b75,0x53765b76,0x53555b76,0x5b755376,0x53755b75,0x53555375,0x53555355,
-0x53555355,0x53555355,0x53755375,0x53555375,0x53555355,0x53555355,0x53355355,0x53355335,0x53355335,0x53555355,0x53355335,0x53345314,0x4b145335,0x53345334,0x4b145334,0x4b144b14,0x4af44b14,0x4b144b14,0x4b144b14,0x4af44b14,0x4af44b14,0x4af44af4,0x4af34af3,0x4b1442f3,0x42f342f3,0x4af34af3,0x4af34af3,0x4af34af3,0x4af34af3,0x4af34b13,0x4b1442d3,0x4af34af3,
-0x4b134b13,0x4b144b14,0x4b134b14,0x4b144b13,0x4b135334,0x53345334,0x5b545b55,0x5b545b54,0x53545334,0x5b555b54,0x5b755b75,0x63945b75,0x63956394,0x63956395,0x63b56bb5,0x63b56395,0x63b563b5,0x6bb563b5,0x6bd66bd6,0x6bd66bd5,0x6bd56bd6,0x6bf66bf6,0x73f66bf6,0x5b536394,0x6bd66bd6,0x63746bf6,0x63956bb5,0x6bd56bf6,0x6bd663d5,0x6bf66374,0x74377436,0x7c377c37,
-0x7c577c57,0x63b47c56,0x63746394,0x84576bb4,0x8cb68477,0x84555b12,0x73b218e8,0x422c7391,0x6b9352cf,0x5b115af1,0x3a0b7c15,0x3967632f,0x00240023,0x31ec4af0,0x63736bb3,0x94d8426f,0x7bd56353,0x41eb62f0,0x28e662ee,0x08235a8b,0x31a718e5,0x31873187,0x18e54209,0x5aac528c,0x4a4a736f,0x10c52926,0x08432106,0x31ca9495,0x328c5b70,0x42ad3a0b,0x3a4a5b6f,0x2a0a52ce,
-0x63b55b54,0x4af25b95,0x42b36c16,0x42d24ab2,0x6bd75354,0x63d76bd7,0x63d763d7,0x63d763d7,0x5bb663d7,0x63d75bb7,0x5b965bb7,0x5b965b96,0x5b965b96,0x5b965b96,0x5bb65b96,0x5b965bb6,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b76,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x53765376,0x53765b76,0x53765376,0x53765376,0x53765376,0x53765376,0x53555355,0x5b755355,
-0x53555355,0x53555355,0x53555375,0x53555355,0x53355355,0x53355355,0x53355335,0x53355335,0x53355335,0x53355335,0x4b145355,0x53344b14,0x53345334,0x4b145334,0x4b144b14,0x4b144b14,0x4b344b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4af44af4,0x4af34af3,0x4af34af3,0x4af34af3,0x42f342f3,0x4af34af3,0x4af34af3,0x42d34af4,0x4af342d3,0x4af34af3,0x4af44af4,0x4af44af4,
-0x4b134b13,0x4b144b13,0x4b134af3,0x4b134b13,0x4b134b14,0x53345334,0x53345b55,0x5b545334,0x5b545334,0x5b745b54,0x5b745b74,0x5b756395,0x63955b75,0x63956395,0x63956395,0x63b563b5,0x63b563b5,0x6bb56bb5,0x6bd56bb5,0x6bd56bd6,0x6bd66bd6,0x6bd66bd6,0x6bf66bd6,0x6bf663b5,0x6bb56bf5,0x6bf66bf6,0x6bd56395,0x639573f6,0x74166c16,0x6bf57c37,0x74167c37,0x6bf57436,
-0x7c377c16,0x7c167c37,0x63937c36,0x7bf46331,0x84357bf4,0x528f9cd8,0x296a18e9,0x08454a0c,0x63304a6d,0x6b51528f,0x4a0a3188,0x00030802,0x53501948,0x10e96bd3,0x6b72424f,0x52d152b2,0x5b10428f,0x314852ae,0x18e52907,0x4a6a738f,0x4a6a31c7,0x6b4f2106,0x52ac52ac,0x29277390,0x08a42168,0x11062147,0x19471906,0x6c146bd3,0x63f4957a,0x21cbbe5e,0x63b163b1,0xa559adda,
-0x531242b0,0x63b65354,0x32515bb5,0x63b65b54,0x63b65395,0x63d763d7,0x63d763d7,0x63d763b6,0x5bb663d7,0x5bb75bb7,0x5bb75bb7,0x5b965b96,0x5b965b96,0x5b965b96,0x5bb65b76,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765376,0x53765b96,0x53755b76,0x5b755b96,0x5b965b96,0x5b965b96,0x53765376,0x5b765376,0x53765376,0x53765376,0x53765355,0x53555355,0x53555355,0x53555355,
-0x53555355,0x53555355,0x53555355,0x53555355,0x53355355,0x53355335,0x53555335,0x53355355,0x53355335,0x53355335,0x53345334,0x53345334,0x4b145314,0x4b145334,0x53344b14,0x4b144b14,0x4b344b14,0x4b145314,0x4b144b14,0x4af442f3,0x4af44af4,0x4af44af3,0x4af34af3,0x4af342d3,0x42f342f3,0x4af34af3,0x4af34af3,0x42d342d3,0x4af34af3,0x4ad34af3,0x4af44af4,0x4af44af4,
-0x4af34af3,0x4b134b13,0x4b134b13,0x4b134b13,0x4b144b14,0x53144b13,0x53345334,0x53345334,0x5b545334,0x5b545b54,0x5b755b54,0x5b755b75,0x5b755b75,0x63956395,0x63b56395,0x63956395,0x63b563b5,0x6bb56bb5,0x6bb56bb5,0x63d56bb5,0x6bd66bd5,0x6bd56bd5,0x6bf66bd6,0x6bf66bf6,0x63756375,0x5b7463b5,0x73f66bd6,0x6c1673f6,0x6bb56bf6,0x73f67437,0x6bd56bb5,0x637473f6,
-0x6bb573f6,0x73f573d5,0x84367c37,0x5aaf8c75,0x4a6e4a2d,0x10877bf4,0x63516351,0x084539aa,0x39ca2949,0x4a2b420a,0x00030823,0x9d370844,0x6b726351,0x110973d4,0x7bf45b12,0x7c168c99,0x5aef426d,0x31893189,0x420a2106,0x29662966,0x21052946,0x52ac6b4f,0x19270885,0x218852ee,0x6bd21107,0x31ea322b,0x4b1121aa,0xadbba59b,0xa57aa59a,0x7c16a59b,0x7c967414,0x6bd394d8,
-0x4b124b12,0x53344b34,0x5b7563b6,0x4b143ab2,0x5b964b14,0x63d75bb6,0x63b763d7,0x63b763d7,0x5bb763b7,0x5bb75bb7,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b96,0x5b765376,0x5b965b96,0x5b765b96,0x5b765b76,0x5b965b96,0x53765376,0x53765376,0x53765b76,0x53555376,0x53765376,0x53555376,0x53555355,0x53755355,0x53555375,
-0x53555375,0x53555355,0x53555355,0x53555355,0x53355335,0x53355335,0x53355335,0x53355335,0x53355334,0x53345334,0x53345334,0x53345334,0x4b344b14,0x4b144b34,0x4b144b14,0x42f44b14,0x4b144b14,0x4b144b14,0x4af44af4,0x4af44af4,0x4af44af4,0x4af34af4,0x4af34b14,0x4af34af3,0x42f342d3,0x42f342f3,0x4af342d3,0x4af342d3,0x4af34af3,0x4af34ad3,0x4ad34ad3,0x4af34af3,
-0x4af44af4,0x4af34b13,0x4af34af3,0x4b134b13,0x4b144b13,0x53344b14,0x53145334,0x53335313,0x53145314,0x53345b54,0x5b545b54,0x5b755b75,0x5b755b74,0x5b756395,0x5b756395,0x5b755b95,0x63b66395,0x63b563b5,0x63b563b5,0x6bb563b5,0x6bd56bd5,0x6bd56bd5,0x63d56bd5,0x5b7463d5,0x6bf66395,0x6bf663d5,0x63b563d5,0x73f673f6,0x6bf67416,0x73f66bd5,0x6b946b94,0x4ad26bb5,
-0x7c166354,0x73d573f4,0x6b925b12,0x4a4eb517,0x84136b32,0x84568c75,0x31aa2149,0x18e718c8,0x20e60045,0x00020002,0x632f0003,0x739273d1,0x4a8e39cb,0x73d3216a,0x8cb773f4,0x6b937c35,0x39ec31ab,0x298818e6,0x08a531a9,0x216710e5,0x31c90884,0x6baf31c9,0x3aae08e6,0x4af05b51,0x741331eb,0x196a0044,0xa57a7c77,0xadbbadbb,0xb5bbb5bb,0xad9aad9a,0xad9aa57a,0xa55aa559,
-0x5b544b12,0x63d64b13,0x63d663b6,0x4b145b96,0x53554b34,0x63d763d7,0x5bb763d7,0x63b75b97,0x5bb763b7,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b96,0x5b965b76,0x5b765b96,0x5b765b96,0x5b965b76,0x5b765b76,0x53765376,0x53765376,0x53765376,0x53555376,0x5b765376,0x53555355,0x53555376,0x53555355,0x53555355,0x53555355,0x4b344b34,
-0x53555355,0x53355355,0x53355355,0x53355335,0x53355335,0x53355335,0x53355335,0x53355335,0x53355335,0x53345355,0x53355334,0x53345335,0x4b344b14,0x4b144b34,0x4b145334,0x4b1442f4,0x4b144b14,0x4b144b14,0x4b1442f4,0x4af44af4,0x4af44af4,0x42d34af4,0x4af44af4,0x4af342d3,0x42d342f3,0x42f342d3,0x4af342d3,0x4af34af3,0x42d342d3,0x4af34af3,0x4af34af3,0x4af34af3,
-0x4af34af3,0x4b134af3,0x4b134b13,0x4b134b13,0x4b134b14,0x53135334,0x53145313,0x53345313,0x5b545354,0x5b545b54,0x5b745b54,0x5b955b74,0x5b755b74,0x63955b75,0x5b756395,0x63955b75,0x63955b95,0x639563b6,0x63b563b5,0x6bb563b5,0x6bd66bb5,0x6bd56bd5,0x6bd563b5,0x63b563d5,0x6bd66bd6,0x6bf66bf6,0x6bb56395,0x74166395,0x73f673f6,0x6bd56bd5,0x7c1673f5,0x63735b73,
-0x63536333,0x63326b93,0x63514a6e,0x6b516330,0x62f0422c,0x31ac2109,0x298a4a8f,0x39ea31aa,0x210662cd,0x00220843,0x4a8d6350,0x18e8424d,0x5b31422d,0x426e6351,0x422d52f0,0x4a8f5b31,0x31eb216a,0x29ca530f,0x29a92168,0x21a94acc,0x198800c5,0x322d3a6d,0x743542cf,0x84f96c56,0x747763d4,0x9d597c97,0xa57aa5ba,0xad9ab5bb,0xad9aadbb,0xad7aad9a,0x9d39a57a,0x9d199d3a,
-0x5b764af4,0x63f663d5,0x6bf76bd6,0x53755bb6,0x63d74b14,0x63d763d7,0x63b763d7,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b76,0x5b965b96,0x5b965b76,0x5b965376,0x5b965b96,0x5b965b76,0x53765b76,0x53765376,0x53555355,0x53555376,0x53555b76,0x5b965376,0x53555355,0x53555355,0x53555355,0x53755355,0x53555355,
-0x53555355,0x53355355,0x53555335,0x53355355,0x53355335,0x53355335,0x53555335,0x4b344b34,0x53345335,0x4b344b34,0x4b144b14,0x4b344b14,0x4b344b34,0x4b344b34,0x4b144af3,0x4b144b14,0x4b144b34,0x4b144b14,0x4b144b14,0x42f34b14,0x4af44b14,0x42d34af3,0x42d34af3,0x42f342f3,0x42d342d3,0x42d34af3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d34af3,
-0x4af34af3,0x4af34af3,0x4af34af3,0x4af34af3,0x4af34b13,0x4b144b14,0x4b144b14,0x53335353,0x5b545b54,0x5b745333,0x5b745b74,0x5b745b54,0x5b745b75,0x5b955b74,0x5b755b95,0x5b755b75,0x63956395,0x63956395,0x63b56395,0x63b563b5,0x63b663b5,0x6bd66bd6,0x63b563b5,0x6bd66bd5,0x6bd56bd5,0x63b563b5,0x6bd55b94,0x6bd56395,0x7c166bf5,0x73d56353,0x7c1573b4,0x6b946bb4,
-0x426e6331,0x4a6f6b93,0x4a6f4ab0,0x424e212a,0x63104ab0,0x73b452af,0x53514af0,0x31ea424c,0x4b0d0045,0x0001ad97,0x52cfad16,0x214b52f1,0x4acf1929,0x94b652f0,0x73d34a6e,0x4aaf52cf,0x3a2f6bd3,0x29ea3a6d,0x4aad4b0d,0x7c5621aa,0x7c366bd5,0x63f46c15,0x8cd85b53,0x9d399d39,0x94f99cf9,0xad9b94b8,0xb59aad99,0xb5bbb5ba,0xb5bbb5bb,0xa57aad9a,0x8cb8a57b,0xad9ba57b,
-0x4af36bf7,0x53765b76,0x63d75b96,0x5b965b96,0x63d75bb6,0x5bb663d7,0x63b763d7,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b76,0x53765b96,0x5b965b76,0x53765b96,0x5b965b96,0x5b965b76,0x53765b76,0x53765376,0x53555355,0x53555376,0x53555355,0x53355355,0x53555355,0x53555355,0x53555355,0x53755355,0x53555355,
-0x53555355,0x53354b35,0x53355335,0x53355335,0x53555335,0x53355335,0x53555335,0x4b344b34,0x53345335,0x4b344b34,0x4b144b14,0x4b144b14,0x4b344b14,0x4b344b14,0x4b144b34,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x42f34b14,0x4af44b14,0x4af44af3,0x42d34af3,0x42f342f3,0x42d342d3,0x4af342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x4af342d3,0x42d342d3,0x42d342d3,
-0x4af34af3,0x4af34af3,0x4af34af3,0x4af34af3,0x4b134b13,0x4b144af3,0x4b144b14,0x53335353,0x5b545b54,0x5b545333,0x53545b54,0x5b745b54,0x5b745b54,0x5b955b74,0x5b755b95,0x5b755b75,0x63956395,0x63956395,0x63b56395,0x63b563b5,0x639563b5,0x63b563b5,0x63b563b5,0x6bd66bd5,0x6bd56bd5,0x63b56bf6,0x5b545b94,0x63946bb5,0x7c166bd5,0x6bb46b94,0x73d473d4,0x4ab06373,
-0x31cc31cc,0x4a8f39ec,0x39cc6b93,0x84356b73,0x63306352,0x5ad05af0,0x4a6b6b30,0x09261065,0x42eb530e,0x8c32a4f3,0x9d1839a9,0x63535331,0x5b5152f1,0x8c9531cb,0x424f5b0f,0x73f531ed,0x741663b3,0x21cb7414,0x64150044,0x8cf92a0e,0x7c5784b8,0x84b88cf9,0x94f87415,0x9d39a55a,0xa55a9d19,0xad9b94f8,0xb5bbadba,0xb5bbb5ba,0xb5dbb5db,0xa539b5db,0x94d88c97,0xad9b9d19,
-0x63f66bf6,0x5bb65b95,0x4b554b35,0x63b663f7,0x63d763b6,0x5bb65bb6,0x5bb75bb6,0x5b965b96,0x5bb75b96,0x5b965bb7,0x5b965bb7,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b96,0x5b965b96,0x5b965b76,0x53765b76,0x5b765b76,0x53765376,0x53765b76,0x53765376,0x53555376,0x53555355,0x53555355,0x53555376,0x53555355,0x53555355,0x53765355,0x53355335,0x53555355,0x53345375,
-0x4b355355,0x53555355,0x53355335,0x53355335,0x53355335,0x53355335,0x53555335,0x4b345355,0x53344b14,0x4b344b34,0x53354b35,0x4b344b14,0x4b344b34,0x4b344b34,0x4b144b14,0x4af44b14,0x4b144b14,0x4af44b14,0x4b144b14,0x4b1442f3,0x4af34b14,0x4af44af3,0x42d342d3,0x42f342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342b3,0x42d342d3,0x42d342d3,0x42d342d3,0x4ad34af3,
-0x4af34af3,0x42d34af3,0x4af342d3,0x4af34af3,0x4b134af3,0x4b144b13,0x53345334,0x53335b54,0x5b545334,0x53135334,0x5b545334,0x5b745b54,0x5b745b54,0x5b545b74,0x5b755b75,0x63955b75,0x63956395,0x63946394,0x63956395,0x63956395,0x63b56395,0x63b563b5,0x63b563b5,0x63b563b5,0x63b563b5,0x5b746bd6,0x5b535b74,0x5b335b33,0x6bb46394,0x5b126bb4,0x424e4a8f,0x52d15b12,
-0x424e6352,0x6b935af0,0x84346b93,0x528e5b10,0x29896310,0x10871908,0x002310c7,0x7bf321a9,0xde59ad15,0xe6dcb3ef,0x845552ef,0x00475b52,0x74148477,0x7bd28cb6,0x637173b3,0x5b126374,0x7c556374,0x5bb56bd5,0x94f884f9,0x84b88cb8,0x8cd98cd9,0x94f98cd9,0x8cd88cf9,0xa55a9d39,0xa579ad7a,0xad9bad9a,0xb5bab5ba,0xadbab5ba,0xa57aad7a,0xa53aad7a,0x9d3aad9b,0xad9badbb,
-0x5b9563b6,0x5bb65b96,0x63d763d6,0x63d763d7,0x63b763d7,0x63b75bb7,0x5b965bb7,0x5b965b96,0x5bb75b96,0x5b965b96,0x5b965b96,0x53765b96,0x5b765376,0x5b965b96,0x5b965376,0x53765b96,0x5b965376,0x53765376,0x53765376,0x5b765b76,0x53765356,0x53765376,0x53555376,0x53555355,0x53555376,0x53555355,0x53555355,0x53555355,0x53555376,0x53555355,0x53555355,0x53355335,
-0x53355335,0x53555355,0x4b354b35,0x4b355355,0x53354b35,0x4b355335,0x53344b35,0x4b344b34,0x4b344b34,0x4b144b35,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4af44b14,0x4af44b14,0x4af44af4,0x4b144b14,0x42f342f3,0x4af342f3,0x42d34af3,0x42f342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d24af3,
-0x4af34af3,0x42d34ad3,0x4af34af4,0x4af34af3,0x4b134af3,0x4b134af3,0x4b134b13,0x53545334,0x53335b54,0x53345334,0x5b545334,0x5b545334,0x5b545b54,0x5b545b54,0x5b755b75,0x63955b75,0x63956395,0x63956395,0x63956395,0x63956395,0x63956395,0x63b66395,0x63b563b5,0x63b56bb5,0x63b56bb5,0x6bb56bb6,0x63b46bb5,0x63736374,0x426f52d1,0x63745b33,0x63526332,0x52d052d0,
-0x31ec216b,0x52f04ab0,0x5b106372,0x10c82128,0x6351424d,0x5b0e4a8d,0x1967636f,0xa51484d5,0x8b8dbd13,0x6b2e1800,0x7bf473f3,0x63737415,0x841673f4,0x739310a6,0x6b936b93,0x73d47c15,0x84778456,0x8c978497,0x94f994d8,0x94f98cb7,0x94f894d8,0x9d1994f9,0x9d19a539,0xa57aa559,0xb5bbb59a,0xb5bab5ba,0xb5bbbddb,0xad9ab5ba,0xb5bbb5bb,0xb5dbadbb,0xa57aa59b,0x9d5a9d7a,
-0x63b64b13,0x5bb65b95,0x63d75b96,0x63d763d7,0x63b75bb6,0x5bb75b96,0x5bb75bb7,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b96,0x5b965b76,0x5b965b76,0x53765b76,0x5b765376,0x53765b76,0x53565b96,0x5b765b96,0x53765355,0x53765b76,0x53555355,0x53555355,0x53555355,0x53555355,0x53555376,0x53555355,0x53555355,0x53555355,0x53355355,0x53355335,0x53555355,
-0x4b355335,0x4b355335,0x4b354b15,0x4b144b35,0x4b354b35,0x4b354b35,0x4b344b35,0x4b344b34,0x4b344b34,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144af4,0x4b144b14,0x4b144b14,0x4b144b14,0x4af44af4,0x4af44af4,0x42f34af4,0x42f342f3,0x42d34b14,0x42d34af3,0x42f342f3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,
-0x42d342d3,0x4af342d3,0x4af34af3,0x4af34af3,0x4af34af3,0x4b144af3,0x4b134b14,0x53335334,0x53135333,0x53345334,0x53345334,0x5b545b54,0x5b545b54,0x5b745b74,0x5b745b74,0x5b755b74,0x63955b75,0x63956395,0x63956395,0x63956395,0x63956395,0x63956395,0x63b56395,0x6bb56395,0x6bb56374,0x63955b34,0x5b336374,0x31ed4290,0x426f52d1,0x5b12424f,0x5b1152d1,0x6b727c15,
-0x63527c35,0x3a2e5b11,0x5b31298c,0x4ad04ad0,0x528c7bd2,0xce394209,0xfffe5a07,0xa490c532,0xe678acb1,0x943172aa,0x7bd3a4d5,0x7c150045,0x9d187c14,0x212b8454,0x5af073b3,0x73f573f5,0x73f573f5,0x95198cd8,0x94f994f8,0x8cb894f9,0x94f994f9,0x9d399d19,0xa55a9d19,0xad9aa57a,0xb5dbb5ba,0xbddbb5db,0xb5dbbdfb,0xb5bab5ba,0xbdfbbdda,0xc61bc61b,0xa57aa57a,0x9d7ba5bb,
-0x4b334b12,0x5bb64b13,0x5bb663d7,0x5bb763b7,0x5bb75bb7,0x5bb75bb7,0x5b965b97,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b96,0x5b765b96,0x53765376,0x5b965376,0x53765b96,0x53555376,0x5b765376,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53565355,0x53355355,0x53355335,0x53555355,0x53354b35,0x53355335,
-0x53355335,0x4b145335,0x53555335,0x4b355335,0x4b145335,0x4b354b35,0x4b144b35,0x4b354b14,0x4b144b35,0x4b144b14,0x4b354b14,0x4b344b35,0x4b144b14,0x4b144b14,0x4af44b14,0x4b144af4,0x4af44b14,0x4af44af4,0x4af44af3,0x4b144af4,0x42f342f3,0x42d342f3,0x4af342d3,0x42d342f3,0x42d342d3,0x42d342d3,0x42b24ad3,0x42d342b3,0x42d342b3,0x42d342d3,0x42d342d3,0x42d342d3,
-0x42b24af3,0x4af342d2,0x4af34af3,0x4af34af3,0x4af34af3,0x4b134b13,0x4af34b13,0x4b144b13,0x53345334,0x53345334,0x5b545334,0x5b545b54,0x5b545b54,0x5b745b54,0x5b545b74,0x5b745b54,0x63955b95,0x5b546395,0x63956395,0x63955b95,0x63956395,0x63955b75,0x5b545b75,0x4ad25313,0x53535b54,0x4af263b4,0x52d15b33,0x63535b12,0x52b05b12,0x5b115af1,0x52d052d0,0x4aaf3a2e,
-0x9d576b93,0x424e8cf6,0x6bd4320d,0x7bf45311,0x416883b1,0xe53583f0,0xedb23880,0xff3aff9b,0x7247ac91,0xcdd89c52,0x83d2acb3,0x8c559496,0x63316b50,0x73b38435,0x63733a2e,0x6bb36373,0x94d87c15,0xa57aad59,0x94d89cf9,0x94f994f9,0x9d199d19,0xa55a9d39,0xa57aa559,0xb59bad7b,0xbdfbb5da,0xbdfbbdfb,0xbddac61b,0xbdfbbdba,0xc65bbdfa,0xce5bce5b,0xb5bbc63b,0xa59badbb,
-0x5b7442d2,0x53555b96,0x63d763d7,0x5b9663b7,0x5b965b96,0x5bb75bb7,0x5b965bb7,0x5b965b96,0x5bb75b96,0x5b965b96,0x5b965b96,0x5b965376,0x5b965b96,0x5b765b76,0x5b965b76,0x53765376,0x53555376,0x53765376,0x53765376,0x53555376,0x53555376,0x53555355,0x53555355,0x53555355,0x53765355,0x53555355,0x53555355,0x53555355,0x4b355335,0x53354b35,0x53354b35,0x53355335,
-0x53355335,0x4b354b15,0x4b354b35,0x4b154b35,0x4b144b35,0x4b354b14,0x4b354b35,0x4b144b35,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144af4,0x4af44b15,0x4af44b14,0x4af44af4,0x4af44af4,0x42f34af3,0x42f342f3,0x42d342f3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42b342d3,0x42d242d2,
-0x42d242d3,0x42d342b2,0x42d242d3,0x42d34af3,0x4af34af3,0x4b134af3,0x4b134af3,0x4b134b13,0x53345334,0x53345334,0x53345334,0x53345b54,0x5b545354,0x5b545b54,0x5b545b54,0x5b745b74,0x5b755b75,0x63955b74,0x5b755b75,0x63956395,0x63b55b75,0x5b756395,0x5b756395,0x5b745b75,0x5b535b74,0x63945b33,0x635352f2,0x5b3252f1,0x29cd4a90,0x429031ed,0x4af14af1,0x63726373,
-0xce188c54,0x94b58390,0x63517bf4,0x8c347bf4,0x8b8dbd77,0xa40f832b,0xff590800,0xf6b9feb7,0x41a7e615,0xa4934986,0x8bd08bd0,0x9d16ad16,0x52af8414,0x5ad07c14,0x5b524ad0,0x73f473d4,0x94d88477,0x9d39a518,0x94f99cf9,0x9d1994f9,0x9d399d39,0xa55a9d39,0xad9aad7a,0xb5dab59a,0xce3bc5fa,0xc63bce3b,0xbdfac61a,0xc5fabdfa,0xd67bce3a,0xe6dcde7b,0xb5fbd69b,0xa59badbb,
-0x533442b2,0x63d763b6,0x5bb663d7,0x63b75bb7,0x63b763b7,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b96,0x53765b96,0x5b965b76,0x5b965b96,0x5b765b76,0x53765376,0x5b965b76,0x53765376,0x53765376,0x53555376,0x53555355,0x53765355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x4b554b55,0x53554b55,0x53554b35,0x4b355335,0x4b354b35,
-0x4b354b35,0x4b354b35,0x4b354b35,0x4b144b35,0x4b354b35,0x4b144b15,0x4b354b14,0x4b144b35,0x4b354b14,0x4af44b14,0x4b144b14,0x4b354b14,0x4b144b14,0x4b144af4,0x4af44b14,0x4af44af4,0x4af44af4,0x4af44af4,0x4b144b14,0x42f342f3,0x42f342d3,0x42f342f3,0x42d342d3,0x42d342d3,0x42d342d3,0x42b342b3,0x42b342b3,0x42d342b3,0x42b342d3,0x42b342b2,0x42d342d3,0x42b342d3,
-0x42d242d2,0x42d342d2,0x42d342d3,0x4af342d3,0x4b134af3,0x4af34af3,0x4b144b13,0x53145313,0x53145313,0x53335333,0x53345333,0x53345334,0x53345334,0x5b545334,0x5b545b54,0x5b745b74,0x5b745b74,0x63955b74,0x5b755b75,0x63956395,0x63955b75,0x5b755b75,0x63956395,0x63955b74,0x5b735b74,0x5b535b53,0x42505312,0x3a2f31ee,0x5b534ab1,0x5b745b74,0x6bd46394,0x73d46bb5,
-0xf6dba4b5,0x9cb3e69a,0x5b106330,0x73516332,0x72898b8f,0xc635bd32,0xfffc0020,0xab287180,0x62cb7269,0xbd356aab,0x7b2f8bb0,0x7bd4a495,0x8c968455,0x8c756330,0x6bb46352,0x7c3673f6,0x94d98457,0xa5599d18,0x94f99cf8,0x9d1994f9,0xa5399d19,0xad7aa539,0xb5baad7a,0xc63bbdda,0xce1ace3b,0xd6bcd67b,0xce3ac63a,0xcdface3a,0xe69bd63a,0xeefdeefc,0xbe5bdedc,0xa59badba,
-0x4b1463b6,0x63d763f7,0x63d763d7,0x63b75b96,0x5bb763b7,0x5b965bb7,0x5bb75b96,0x5b965b96,0x53765b96,0x5b765b76,0x53765b76,0x5b765376,0x5b765b76,0x53765376,0x53765376,0x53765376,0x53765376,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x4b355376,0x53555355,0x53355335,0x53354b35,0x4b554b55,0x53354b35,0x4b354b35,0x4b354b35,0x53354b14,
-0x53355335,0x4b354b35,0x4b354b35,0x4b144b35,0x4b354b35,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x42f44af4,0x4b1442f4,0x4af44b14,0x4af442d4,0x4af44af4,0x42f44af4,0x4af44af4,0x4af442f4,0x42f342f3,0x42f342f3,0x42f342f3,0x42f342f3,0x42d342d3,0x42d342d3,0x42d342d3,0x42b342b3,0x42d342d3,0x42d342b3,0x42b342d3,0x42b342b3,0x42d342b2,0x4af342b3,
-0x42d242d2,0x42d242d2,0x42d342d2,0x4ad342d3,0x4af34af3,0x4af34af3,0x4af34af3,0x53345313,0x53345314,0x53335333,0x53345333,0x53345334,0x53345334,0x5b545354,0x5b745b54,0x5b545b74,0x5b745b74,0x5b745b54,0x5b755b75,0x5b755b75,0x5b756395,0x5b755b75,0x63956395,0x63956395,0x63745b53,0x42704ad1,0x52f252f2,0x63944ab1,0x5b744af2,0x4af25b74,0x74156bd5,0x73d473f5,
-0xd5d79c76,0xad55eeda,0x63107bd2,0x836f6b30,0x8c2e4166,0xf7dcded8,0xff5b6ac8,0xe635fffc,0x7c0f83ee,0x836e83af,0x83b17b4e,0x6b5283f3,0x84568c96,0x8c977bf4,0x74168c97,0x7c368cb8,0x8c778c78,0xa53994d8,0x9519a539,0x9d199519,0xa55aa539,0xad7aad7a,0xbe1ab5da,0xd65bc61b,0xe6fcde9c,0xe6fce6fc,0xd65adebc,0xd63ad65a,0xeefbe6dc,0xf75df73d,0xd6ddef3d,0xa57ab5fb,
-0x42b2112b,0x53755355,0x63d75b96,0x63b763b7,0x5b9663b7,0x5b965bb7,0x5b965b96,0x5b765b96,0x5b965b76,0x5b765b76,0x53765b76,0x5b765376,0x5b765b76,0x53765376,0x53555376,0x53765376,0x53765376,0x53555376,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53764b35,0x53355355,0x53355355,0x53555355,0x4b554b55,0x53354b35,0x4b354b35,0x4b354b35,0x53354b14,
-0x4b145335,0x4b354b35,0x4b354b35,0x4b144b35,0x4b354b35,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x42f44af4,0x4b1442f4,0x4af44b14,0x4af442d4,0x4af44af4,0x42f44af4,0x4af44af4,0x4af44b14,0x42f342f3,0x42f342f3,0x42f342f3,0x42f342f3,0x42d342d3,0x42d342d3,0x42d342d3,0x42b342b3,0x42d342d3,0x42d342b3,0x42b342d3,0x42b342b3,0x42d342b2,0x42b342b3,
-0x42d242d2,0x42d242d2,0x42d342d2,0x4af342d3,0x4af34af3,0x4af34af3,0x4af34af3,0x53135313,0x53145314,0x53335333,0x53345333,0x53345334,0x53345334,0x5b545354,0x5b745b54,0x5b545b74,0x5b745b74,0x5b745b54,0x5b755b75,0x5b755b75,0x5b756395,0x5b755b75,0x5b755b75,0x5b745b74,0x4ad15b74,0x5b534290,0x3a6f5b53,0x6bb55353,0x6bd64ad1,0x5b7463d5,0x6bf56394,0x73d56bb5,
-0xcd758393,0xce38f75a,0x73938433,0x4a28acf6,0xeed9f7fe,0xff9cff5b,0xf77cff1a,0xd4effef8,0xb514e6ba,0x9c72ac12,0x83b293f1,0x84158414,0x73b48c96,0x845673d4,0x7c578c77,0x8c988c98,0x8c988c98,0xa5199cf8,0x9d39a559,0xa5399d39,0xad7aa55a,0xb59bad9a,0xc65bbdfa,0xdebcd67c,0xef1def3d,0xef1cef3c,0xe69beefc,0xf73deedc,0xf75cf73c,0xf75cf75d,0xe73eff5d,0xadbbbe3c,
-0x53554b13,0x5bb64b14,0x5bb75bb7,0x5bb75bb7,0x5b965bb7,0x5b965b96,0x5b965b96,0x5b765b96,0x53765b76,0x5b765b96,0x5b965b96,0x5b965b96,0x53765b96,0x53765b76,0x53765b76,0x53555376,0x53765355,0x53555376,0x53555376,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53354b35,0x53355355,0x53355335,0x4b355335,0x4b354b35,0x4b354b35,0x4b354b35,
-0x4b355335,0x4b144b35,0x4b144b35,0x4b144b35,0x4b144b35,0x4b144b15,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4af44b14,0x4af44af4,0x4af442f4,0x4af44af4,0x4af442f4,0x4af44af4,0x42f44af4,0x42f442f4,0x4af44af4,0x4af34af3,0x42d342d3,0x42f442d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42b342b2,0x42d342d3,0x3ab242b3,0x42d242d3,0x42b342d2,0x42b242b2,0x42b342b3,
-0x42d242b2,0x42d242d2,0x4af342d2,0x4af34ad3,0x4af34af3,0x4af34af3,0x4af34af3,0x53134af3,0x53135334,0x53135313,0x53145313,0x53335314,0x53345333,0x5b545b54,0x5b745b54,0x5b545b54,0x5b545b54,0x5b745b74,0x5b745b54,0x5b755b74,0x63955b75,0x5b745b74,0x5b755b75,0x4b125b74,0x53135313,0x53535b74,0x63b542b1,0x5b756395,0x5b946395,0x639563d5,0x6bb55b74,0x3a0f6374,
-0xccf57332,0xeefaff1b,0xacb2b575,0xf71a5184,0xfe56fed9,0x5900ed52,0xfe76f636,0xde14c40c,0xd5f6e636,0xc576b4f3,0xa4f7732e,0x94768c76,0x7c157c14,0x7c366bb3,0x84578c97,0x8c988c98,0x94d88cb8,0xa539a518,0xa5399d18,0xa539a539,0xad79ad5a,0xc5dabdba,0xdebcd65b,0xef1ce6fc,0xf77ef77e,0xf73cf73d,0xf75df75d,0xffdfffbe,0xff9effbe,0xf73cf75d,0xd6bcf75d,0xb5fbbe1b,
-0x3a916bf7,0x5bb64b34,0x5bb75bb7,0x5bb75bb7,0x5bb75b96,0x5b965bb7,0x5b965bb7,0x5b965b96,0x5b765b96,0x5b765b76,0x53765b76,0x53765376,0x5b965376,0x53565376,0x53765376,0x53765355,0x5b965376,0x53555376,0x53765376,0x53555376,0x53555355,0x53555355,0x53555355,0x53355335,0x53555335,0x53354b35,0x53355335,0x4b354b35,0x4b354b35,0x4b354b35,0x4b144b35,0x4b354b35,
-0x4b354b35,0x4b144b35,0x4b144b14,0x4b144b35,0x4b154b14,0x4b144b14,0x4b144b14,0x4af44b14,0x4b1442f4,0x4af44af4,0x4af442f4,0x4af44af4,0x4af44af4,0x42f442f4,0x4af442f4,0x4af44af4,0x4af44af4,0x42f442f4,0x4af34af3,0x4af34af3,0x42d442d3,0x42d342d3,0x42d342d3,0x42d342d3,0x3ab242d3,0x42b342b2,0x42b242b2,0x3ab242b2,0x42d23ab2,0x42b23ab2,0x42b342b3,0x42b342b2,
-0x42d242b2,0x42d242d2,0x4ad242d2,0x4ad24ad3,0x4af34ad3,0x4af34af3,0x4af34af3,0x53135313,0x53134af3,0x53135313,0x53145313,0x53335334,0x53345333,0x53345354,0x5b545334,0x53345334,0x5b545b54,0x5b545b54,0x5b745b74,0x5b745b74,0x5b755b74,0x5b545b54,0x5b755b95,0x53325334,0x5b945b74,0x639563b5,0x63b55b54,0x639563b5,0x5b945b75,0x63b542b1,0x52f25b33,0x52f3216d,
-0x7b9163b3,0xff1bee99,0x59e5de57,0xfdb4f6f9,0xd510e4f0,0xacd0fed8,0xfe35c46f,0xee16cd54,0xde17ee37,0x8bcf9c30,0xa4f7bd76,0x7bd473b2,0x6bb46352,0x84778477,0x94f89518,0x8cb88cb8,0x94f88cd8,0xa559ad59,0xad99ad7a,0xa53aad59,0xb5daad7a,0xde7cc5fa,0xef1be6db,0xf75def1b,0xff9eff9e,0xff7dff9d,0xffffffbe,0xffffffff,0xffdfffff,0xff9eff9e,0xdefdff9e,0xb5dbbe1b,
-0x5bb67438,0x5bb65bb6,0x5bb75bb7,0x5b965bb7,0x5bb75b96,0x5b965b96,0x5b965b96,0x5b965b76,0x5b765b96,0x53765376,0x53765b76,0x53765376,0x53765376,0x5b965376,0x53765376,0x53555376,0x53555355,0x53755375,0x53555355,0x53555355,0x53555335,0x53555355,0x53555355,0x53764b35,0x53355355,0x4b355355,0x53355335,0x4b145335,0x4b144b35,0x4b354b35,0x53354b35,0x4b144b14,
-0x4b144b35,0x4b144b14,0x4b144b14,0x4b154b14,0x4b144b14,0x4b144af4,0x4b144b14,0x4b144af4,0x4af44af4,0x4af44b14,0x4af44af4,0x4af44af4,0x42f44b14,0x42f442f4,0x4af44af4,0x42f44af4,0x42f442d4,0x42f442f4,0x42f34b14,0x42d342f3,0x42d342d3,0x42d342b3,0x42b24ad3,0x42d342d3,0x42d342d3,0x42b342b2,0x42b342b3,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,
-0x42b242b2,0x42d242b2,0x4ad242d2,0x4ad34ad3,0x4af34ad3,0x4af34ad3,0x4af34af3,0x53134af3,0x53135313,0x53145313,0x53135314,0x53335334,0x53335333,0x53545334,0x53345354,0x53345354,0x53345b54,0x5b745b54,0x5b745b54,0x5b745b74,0x5b745b74,0x5b755b54,0x5b955b75,0x63955334,0x639463b5,0x63956395,0x63b56395,0x63956395,0x5b545b75,0x63b65354,0x639563b6,0x6bd55b95,
-0x9cb66bf5,0xff7cf659,0xeeb94183,0x9b4e934c,0x7aaaa3ce,0x72eb51e6,0xe5b669e7,0xbc92c4f4,0xac92abef,0x838f8bcf,0x83f4c5b8,0x6b938c36,0x7c356b73,0x8cb873f4,0x9d59b5da,0x8cd88cd8,0xad7a9cf8,0xb59aa518,0xa559b59a,0xad59a538,0xcdf9bd78,0xe6dce71c,0xf73ceefb,0xff7dff7d,0xffdeffde,0xffffffde,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0xef3dffbe,0xc63bce5b,
-0x2a0f4b13,0x42d33251,0x5bb75376,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b76,0x5b965b96,0x5b965376,0x53765b76,0x53765b76,0x53765376,0x53765376,0x53765355,0x53765355,0x53555376,0x53755375,0x53555355,0x53555355,0x53555355,0x53555335,0x53355335,0x53355335,0x53355355,0x53554b35,0x4b355335,0x4b354b35,0x4b144b14,0x4b144b35,0x4b144b14,0x4b144b14,
-0x4b144b35,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x42f44b14,0x4b144b14,0x4af442f4,0x42f44af4,0x4af44af4,0x4b144af4,0x42f44af4,0x42f442f4,0x42f442d4,0x42f442f4,0x42f442d3,0x42f442f4,0x42f34b14,0x42d342f3,0x4ad442d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42b242b2,0x42b342b3,0x42b242b2,0x3a9242b2,0x3a9242b2,0x42b242b2,0x42b242b2,
-0x42b242b2,0x42d242d2,0x4ad342d2,0x4af34ad3,0x4af34af3,0x4af34af3,0x4af34b13,0x4af34af3,0x53134af3,0x53134af3,0x53135313,0x53135313,0x53345313,0x53335334,0x53345333,0x5b545b54,0x53345334,0x5b545b54,0x5b545b54,0x5b545b54,0x5b545b74,0x5b755b54,0x5b755b75,0x63955b74,0x63956395,0x63956395,0x639563b5,0x639563b5,0x63956395,0x63b56395,0x429163b6,0x6bd563d6,
-0x8c1473f5,0xbc2fdd55,0x93aeff7b,0xacd5834c,0x94b37b2f,0x9cb393f1,0x72cd734f,0x941372ee,0xa4947b2f,0xad16c597,0x52ae7b90,0x6b725b11,0x8c966bb3,0xdf3da537,0xb5dadf1b,0xa57a94f8,0xa539a539,0xc61aad59,0xa559b59a,0xbd98a539,0xff1ceebb,0xff7dffde,0xff7df73b,0xffdeffbe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdeffde,0xffffffff,0xf77effdf,0xe6fce6fc,
-0x53343a50,0x5b965bb6,0x5bb75376,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b96,0x5b765b96,0x5b965b76,0x5b765376,0x53765b96,0x53765376,0x53765376,0x53765376,0x53555376,0x53555355,0x53555355,0x4b555375,0x53555355,0x4b355376,0x53555355,0x53355355,0x53355335,0x4b355355,0x53354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x53354b14,0x4b154b15,0x4b144b14,0x4b144b14,
-0x4b354b14,0x4b144b14,0x4af44b14,0x4b144af4,0x4b144b14,0x4b144b14,0x4af44b14,0x4b144af4,0x4af44af4,0x4af442f4,0x4af442f4,0x4af44af4,0x4af44af4,0x42f44af4,0x42f442f4,0x42f442f4,0x42d342f4,0x42f442d3,0x42d34af4,0x42d342f4,0x42d342d3,0x42d342d3,0x42d342d3,0x42d33ab2,0x3ab23ab2,0x42b242b2,0x42b242b2,0x3a9242b2,0x3a9142b2,0x42b242b2,0x3a913a91,0x42b23a91,
-0x42b242b2,0x42d242d2,0x42d242d2,0x42d342d3,0x4ad342d3,0x4af34ad3,0x4af34af3,0x4af34b13,0x4af34af3,0x53145313,0x53335314,0x53344b33,0x53335313,0x53135313,0x53335313,0x53345334,0x53545333,0x5b545334,0x5b545b54,0x5b545b74,0x5b545b54,0x5b745b74,0x5b745b54,0x5b756395,0x63956395,0x5b955b95,0x63956395,0x63b563b5,0x5b5463b5,0x6bd66395,0x63b44ad2,0x637373f6,
-0x522d6b94,0xccf2626d,0x7b2bfef9,0xbd77d618,0x8bf4b559,0x94537330,0x7b919474,0x8c147b92,0x83f37bd4,0x734f9c94,0x83f49c74,0x3a2d8c76,0xd69b7bd1,0xf6fbe6db,0xef7cff9d,0xb5bad67a,0x9d189518,0xce5abddb,0xb5babe1a,0xd5f9ad58,0xff9dff7b,0xffdeffff,0xffdeffbe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdeffff,0xffbeff9d,0xffdefffe,0xffdfffde,0xce9ce73e,
-0x5b765355,0x5bb65bb6,0x5bb75b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b96,0x5b765b96,0x5b765b76,0x53765376,0x53765376,0x53555355,0x53765355,0x53755375,0x53555375,0x53765355,0x53555376,0x4b554b55,0x53555355,0x53555355,0x53555355,0x53355355,0x4b354b35,0x4b355355,0x53554b35,0x53355335,0x4b354b35,0x4b354b35,0x4b354b35,0x4b144b35,0x4b354b14,0x4b144b14,
-0x4b144b35,0x4b144b14,0x4b144b14,0x4b144af4,0x4b144b14,0x42f442f4,0x4af44af4,0x4af44af4,0x4af44af4,0x4b1442f4,0x42d442d3,0x4af442d4,0x4af442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42d342f4,0x42d342d3,0x42d342d3,0x42d342d3,0x42f342d3,0x42d342d3,0x3ab23ab2,0x3ab23ab2,0x42b242b2,0x3a9242b2,0x42b23a92,0x3a923a92,0x3a923a92,0x42b242b2,0x3a923a92,
-0x42b242b2,0x42d242d2,0x42d342d2,0x42d342d3,0x4ad242d3,0x42d24ad3,0x4af34af3,0x4af34b13,0x4af34af3,0x53134ad3,0x4b135313,0x53134b33,0x53135333,0x53135333,0x53335b54,0x53345334,0x53345333,0x53345b54,0x5b545334,0x5b745b54,0x5b545b54,0x5b745b74,0x5b755b74,0x5b755b75,0x63955b75,0x63956395,0x63955b75,0x5b745b95,0x53135b54,0x53135313,0x5b5352f2,0x426f5b12,
-0x5af0420e,0xb4d36bb3,0xc575feda,0x7350bcf5,0x73725a8e,0xa5178414,0x63316310,0x84156330,0x8c7573b4,0x8c129495,0xad589cb5,0x84548c74,0xeefa9472,0xff9df75c,0xf6fbfffe,0xad78d6ba,0xce7d9d19,0xc5fadebb,0xad59b599,0xd536a518,0xffbdff9c,0xffdeffff,0xfffeffbe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xff9dffff,0xffbeff9d,0xff9dffbe,0xdefcf77d,0xbdface7c,
-0x53765376,0x5bb75bb7,0x5b965b96,0x53965bb6,0x5b965396,0x5b765b96,0x5b965b96,0x5b965b96,0x53765376,0x5b765b76,0x5b965376,0x53765376,0x53755376,0x53755375,0x53555375,0x53555376,0x53555355,0x53555355,0x53555355,0x53555355,0x53355355,0x53355335,0x53555355,0x53355335,0x53355355,0x4b144b14,0x4b354b35,0x4b144b35,0x4b354b14,0x4af44b14,0x4b144b14,0x4b144b14,
-0x4b144b14,0x4b354b14,0x4af44b35,0x4b144af4,0x4af44b14,0x4af44b14,0x4af44af4,0x42f44af4,0x4b144af4,0x4af442f4,0x4b144af4,0x42f44b14,0x42f442f4,0x42f442d3,0x42f44af4,0x42f442f4,0x4af442d3,0x42d342d3,0x42f442f4,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,0x42b23ab2,0x3a913a92,0x42b23a91,0x3a923a92,0x3a913a91,
-0x42b242b2,0x3a9242b2,0x42d242b2,0x4ad242d2,0x4ad34ad2,0x4ab24ad3,0x4af34ab2,0x4af34ad3,0x4af34af3,0x4b134b14,0x4b134b13,0x53144b13,0x4b135314,0x53345313,0x5b545313,0x53335333,0x53345333,0x53345334,0x53345334,0x5b545334,0x53345b54,0x53345b75,0x5b745b75,0x5b755b75,0x5b755b75,0x63b56395,0x63b56395,0x5b955b75,0x5b5563b6,0x53125b33,0x5b126353,0x4a903a0e,
-0x5b735333,0x94345b53,0xa3d1ac13,0x9475bd56,0x73b34a4e,0x53126352,0x84766372,0x6bb46352,0x84348436,0xad379cf6,0x7c159455,0xb5578c75,0xe658ce5a,0xff7dffbe,0xff3dffbd,0xdefbf77d,0xbd99de7c,0xad99bdda,0x9d38a539,0xedf8bcf8,0xfffeff7d,0xffdefffe,0xffffffde,0xffffffff,0xfffeffff,0xfffffffe,0xfffeffbe,0xf77dffde,0xff3deedb,0xff7dff9d,0xe6ddef3c,0xcdfad67c,
-0x5bb75bb7,0x5bb75bb7,0x5b965b96,0x53965bb6,0x5b965396,0x5b965b96,0x5b965b96,0x5b965b96,0x53765376,0x5b765b76,0x53765376,0x53765376,0x53755376,0x53755375,0x53555375,0x53555355,0x53555355,0x53555355,0x53355355,0x53555355,0x53355355,0x53355335,0x53554b35,0x53355335,0x53355355,0x53355335,0x4b354b35,0x4b144b35,0x4b144b14,0x4b354b14,0x4b144b14,0x4b144b14,
-0x4b144b14,0x42f44b14,0x4af44b14,0x4b144af4,0x4af44b14,0x4af44af4,0x4af44af4,0x42f44af4,0x42f44af4,0x4af442f4,0x42f44af4,0x42f442f4,0x42f442f4,0x42f442d3,0x42f44af4,0x42f442f4,0x4af442d3,0x42f442d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,0x3a713ab2,0x3a913a92,0x42b242b2,0x3a923a92,0x3a913a91,
-0x42b242b2,0x42b242b2,0x42d242d3,0x4ad242d2,0x4ad34ad2,0x4ab24ad3,0x4af34ab2,0x4af34ad3,0x4af34af3,0x4b134af3,0x4b134b13,0x53144b13,0x53135314,0x53135313,0x53334af3,0x53335333,0x53345333,0x53345334,0x53345334,0x5b545334,0x53345334,0x5b755334,0x5b745b75,0x5b755b75,0x5b755b75,0x63b56395,0x63b56395,0x5b955b75,0x5b345b75,0x4ad14270,0x424f424f,0x4ad15b33,
-0x53126394,0x63536bb5,0x6b306373,0x947594d6,0x9cd78c55,0x84768414,0x637373f6,0x73f57c35,0x94b78456,0x84359d18,0x94b87bf4,0xe75ca4f7,0xfedbff5d,0xff3bddb5,0xffdfffbd,0xdebbff9e,0xb579ad37,0xa559ad79,0xa4f89d19,0xfedbde1a,0xffddffbd,0xfffefffe,0xffffffff,0xffffffff,0xf77dffde,0xf75cef3c,0xff9deefb,0xef3cff9d,0xff1de6bb,0xff9dff9d,0xe69bf73c,0xeedce6dc,
-0x5b965b96,0x5bb75b96,0x5bb75bb7,0x53965b96,0x5b965396,0x5b965b76,0x5b765376,0x5b765376,0x53765b76,0x53765376,0x53765b96,0x53765376,0x53765376,0x53755375,0x53555375,0x53765355,0x53555355,0x53555355,0x53555355,0x53555355,0x4b355355,0x53555335,0x4b354b35,0x53355335,0x4b355335,0x4b144b14,0x4b144b35,0x4b144b14,0x4b354b35,0x4b144b14,0x4b144b14,0x4b144b14,
-0x4b144b14,0x4b144b14,0x4af44b14,0x4af44af4,0x4af44b14,0x42f44af4,0x4b144af4,0x42f442f4,0x42f44af4,0x42f44af4,0x42f442f4,0x42f442f4,0x42f442f4,0x42d342d3,0x42f442f4,0x42f442f4,0x42d342d3,0x42d342d3,0x42d342d3,0x42f442d3,0x42d43ab3,0x42f342d3,0x42d342d3,0x3ab23ab2,0x3ab242d3,0x3a923ab2,0x3a923a92,0x3a913a92,0x3a913a91,0x3a923a91,0x3a923a92,0x3a923a92,
-0x42b23a92,0x42b242b2,0x42d242b2,0x4ad242d2,0x4ad34ad2,0x4ad34ad3,0x4ad34ad3,0x4af34ad3,0x4af34af3,0x4af34af3,0x4af34af3,0x53134b13,0x53135314,0x53134af3,0x53135313,0x53335313,0x53345333,0x53135313,0x53345333,0x53345334,0x53345334,0x5b545b54,0x5b745b54,0x5b745b54,0x63955b75,0x5b755b75,0x5b755b95,0x5b755b54,0x5b345313,0x42904270,0x42703a2e,0x63b55b74,
-0x5b336bd5,0x5b126374,0x7bf27395,0x73f39474,0xa4f6a537,0xad99bdd9,0x9d379d58,0x84578c97,0x7c368475,0x73f76bd5,0x84767c57,0xff1dad59,0xa496d598,0xddb7c578,0xff7dfe9a,0xc599e69a,0xa559ad79,0x9d199d39,0xb4f99d1a,0xff9df678,0xffbdff9d,0xfffeffde,0xffffffff,0xffffffff,0xdebaef5c,0xeefbe6da,0xff5df6db,0xef3dff5c,0xd63adebb,0xfffeff9d,0xff9eff9e,0xff9dff5d,
-0x63b763b7,0x5b965b96,0x5b965b96,0x5b965b96,0x53965b96,0x5b765396,0x53965b76,0x5b765396,0x53765b76,0x53765376,0x5b765376,0x53555376,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53355355,0x53355335,0x53555335,0x4b355335,0x4b354b35,0x4b354b35,0x53354b35,0x53354b35,0x4b144b14,0x4b354b35,0x4b144b35,0x4b144b14,0x4b144b14,0x4af44b14,
-0x4af44b14,0x4b1442f4,0x4af44af4,0x4b144af4,0x4af44b14,0x42f44af4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42d342f4,0x42d342f4,0x42f442f4,0x42f442f4,0x42d342f4,0x42d342d3,0x42d342d3,0x42f442d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x3ab242d3,0x3ab23ab2,0x3a923a92,0x3a923a92,0x3a913a91,0x3a913a91,0x3a923a92,0x42b23a92,
-0x42b242b2,0x42b242b2,0x42b242b2,0x42d242d2,0x42d242d2,0x42d342d3,0x42f342d3,0x4af34af3,0x4af34af3,0x4af34af3,0x4af34af3,0x4b134b13,0x53134af3,0x53135313,0x53135313,0x53135313,0x53335333,0x53345314,0x53345334,0x53345334,0x5b545334,0x5b545b54,0x5b545b54,0x53745354,0x5b955b74,0x5b755b75,0x5b746395,0x53125333,0x5b3342b1,0x3a4f4ad1,0x5b533a70,0x639542b2,
-0x5b7463b5,0x7c356bf6,0xad779cf7,0x7c349d16,0xbd388c34,0xce39cdd9,0x9cf8ad38,0x8cd8a537,0x6bd68437,0x7c376bf7,0x8cb77c57,0xd5fab559,0xa4f8ad38,0xbd18a4d7,0xd639de1a,0xad39bd98,0x9d18a539,0x94f99d18,0xdddb9cd9,0xff9dff7c,0xffbeff3c,0xfffeffde,0xffffffff,0xef5cfffe,0xe6dbe6db,0xe6bce6db,0xdebbc5da,0xde9bef1d,0xde5ace5c,0xfffeff7c,0xffdefffe,0xff9dff9d,
-0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x53965b96,0x5b965b96,0x53965b76,0x5b765376,0x53765b76,0x53765b76,0x53765376,0x53765376,0x53765376,0x53555355,0x53765355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x53355335,0x53354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b14,0x4b144b35,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,
-0x4b144af4,0x4af44af4,0x4af44af4,0x4af44af4,0x4af44af4,0x4af44b14,0x42f442f4,0x42d442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42d342d3,0x42d342f4,0x42f442d3,0x42f442f4,0x42d342d3,0x42d342d3,0x42f442f4,0x42d342d3,0x42f442d3,0x42d342d3,0x42d342d3,0x42d33ab2,0x3ab242d3,0x3ab23ab2,0x3a923a92,0x3a913a92,0x3a9142b2,0x3a923a92,0x3a923a92,0x3a923a92,
-0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42d242d2,0x4af342d2,0x4af34af3,0x4af342d3,0x4af34af3,0x4af34af3,0x4af34af3,0x4b134af3,0x53134b13,0x4b135313,0x53135313,0x53135313,0x53135313,0x53145314,0x53345314,0x53345334,0x53345334,0x53345b54,0x5b545b54,0x53745374,0x5b745b74,0x5b755b54,0x53135b54,0x4ad25313,0x4ab15333,0x4ad15b53,0x63956395,0x5b545313,
-0x63b66375,0x7c365b75,0xdebab578,0x9cd6ce39,0x9c768c75,0xb5179454,0x9496ad17,0x9cf89c97,0x7c578477,0x7c577457,0x84787c37,0x8c779497,0x9cd89497,0xad599cf8,0xa558b579,0x9d19a4f9,0x9cf99cf9,0x94d894d8,0xc5389cd8,0xff7cff5b,0xffbdfefb,0xfffefffe,0xffffffff,0xff7dff9d,0xe6dbeefb,0xce5aef1c,0xbdd9ad39,0xbdd9ce5b,0xcddaad7a,0xffbeef1b,0xff9dff7d,0xffbeff7d,
-0x5b965b96,0x5b965b96,0x5b965bb7,0x5b965b96,0x5b965b96,0x5b765b76,0x5b765b76,0x5b765b76,0x5b765b76,0x53765376,0x53765376,0x53555376,0x53555355,0x53555355,0x53555376,0x53555355,0x53555355,0x53555355,0x53355355,0x53355335,0x53555355,0x4b354b35,0x4b354b35,0x4b354b35,0x4b144b35,0x4b144b35,0x4b354b35,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,
-0x4af44b14,0x4b144af4,0x42f44af4,0x4af442f4,0x4af44af4,0x42f442f4,0x42f442f4,0x4b1442f4,0x4af442f4,0x42f442f4,0x42d342f4,0x4af442d3,0x42d342d3,0x42d342d3,0x42f442f4,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342f4,0x42d342d3,0x42d342d3,0x42b342d3,0x42b342b3,0x42d342d3,0x42d342b2,0x3ab23ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a91,0x3a923a92,0x42b23a92,
-0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42d242b2,0x42d242d2,0x42d342d2,0x42d342d3,0x4af34af3,0x4af34af3,0x4af34af3,0x4af34af3,0x4af34af3,0x53134af3,0x53135313,0x4b134b13,0x53344b13,0x4b144b14,0x53134b13,0x53135333,0x53345334,0x53345334,0x5b545b54,0x53555354,0x5b545b54,0x5b755b74,0x5b545334,0x4af26395,0x4b135313,0x5354322f,0x5b955b95,0x5b965354,
-0x63b66396,0x7bf663b6,0xef1ade5b,0xa4d7ce39,0x7bf68435,0x949783f6,0x9cf79cd7,0xa5388c55,0x94f8ad79,0x74178c97,0x84787417,0x8c988477,0x94b88c98,0x9cf994b8,0x9cf89cf8,0x94d994d9,0x94d994d9,0x94d994d9,0xbd198cb9,0xff3df6d9,0xff3bf6db,0xfffeffbd,0xffdefffe,0xffbdffbc,0xf77dff9e,0xce5aef1c,0xbdfabdd9,0xad9abdbb,0xc61bad58,0xeefcde9b,0xdedcdedc,0xeedbd65a,
-0x5b9663d7,0x5bb75b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b765b76,0x5b765b76,0x53565b76,0x53765376,0x53765376,0x53555355,0x53555355,0x53555335,0x53555355,0x53555355,0x53555355,0x53355355,0x53555355,0x53555355,0x4b355335,0x4b354b35,0x4b354b35,0x4b354b35,0x53354b14,0x4b144b14,0x4b144b14,0x4af44af4,0x4b144b14,0x42f44b14,0x4af44af4,0x4af44af4,
-0x4af442f4,0x4af44af4,0x42f44af4,0x4b1442f4,0x42f44af4,0x4af44af4,0x42f442f4,0x42f442f4,0x4af442d3,0x42f442f4,0x42d34af4,0x42f442d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42f442d3,0x42d342d3,0x42d342d3,0x42d342d3,0x3ab342d3,0x42b342b3,0x42d342d3,0x3ab23ab2,0x42d33ab2,0x42b242b2,0x3a9242b2,0x42b23a92,0x3a923a92,0x3a923a92,0x42b242b2,
-0x42b23a92,0x42b242b2,0x42b242b2,0x42d242b2,0x42d242b2,0x42d242b2,0x42d242d2,0x42d242d3,0x4ad34ad3,0x4af34af3,0x4af34af3,0x4af34af3,0x4b134af3,0x53134b13,0x4af35313,0x4b134b13,0x4b144b13,0x4b144b14,0x53135334,0x53335333,0x53345333,0x53335b54,0x53345334,0x53545334,0x5b545b54,0x5b545b54,0x4b135b54,0x53334af2,0x4b135313,0x53345354,0x5b745b95,0x53545354,
-0x63966395,0x841663b6,0xee79bd17,0xbd98de99,0x6bd6ad9a,0x841673f6,0x8c769497,0xad389476,0x94f8a518,0x7c578497,0x84777c77,0x84578478,0x94b88478,0x94d894b8,0x94b894d9,0x94d98cb9,0x8cb98cb9,0x8cb88cb8,0x9cb88cb9,0xe69ae67a,0xff1bf6db,0xffdeff9d,0xffbdffde,0xe6dcef3c,0xd67ad67a,0xce3ad67a,0xc61bce5b,0xa55bb59a,0xb57aad3a,0xd67bcdfa,0xd65bd61a,0xe67bde7b,
-0x5b965b96,0x5b965b96,0x5b965b96,0x53965396,0x53965396,0x53965376,0x5b965396,0x5b965b76,0x53765b76,0x5b765376,0x53765376,0x53555355,0x53755355,0x53555375,0x53555355,0x53555355,0x53555355,0x53555355,0x53355355,0x53355335,0x4b354b35,0x53354b35,0x4b354b35,0x4b354b35,0x4b144b35,0x4b144b35,0x4b354b14,0x4af44b14,0x4b144b14,0x4b144b14,0x4af44b14,0x4af44af4,
-0x4af44af4,0x4b154af4,0x42f442d4,0x42f442f4,0x4af44af4,0x42f442f4,0x42f442d3,0x42f442f4,0x42f442d3,0x42f442f4,0x42d342f4,0x42f442d3,0x42d342f4,0x42f442f4,0x42d342d3,0x42d342f4,0x42d342d3,0x42d342d3,0x42d342f4,0x42f442d3,0x42d342b3,0x42d342d3,0x42d342d3,0x42d33ab2,0x3ab242b2,0x3ab23ab2,0x42d242d2,0x3ab23ab2,0x3a923ab2,0x3a923a92,0x3a923a92,0x42b23a92,
-0x42b242b2,0x42b242b2,0x42b242b2,0x42b242d2,0x42b242b2,0x42d342d2,0x42d242d3,0x4ad34ad3,0x4af34ad3,0x4af34af3,0x4ad24af3,0x4af34af3,0x4af34af3,0x4af34b13,0x4af34af3,0x4af34af3,0x4b134af3,0x53135313,0x53135313,0x53335313,0x53345333,0x53345334,0x5b545334,0x5b545334,0x5b545354,0x5b545b54,0x53345334,0x53555b75,0x53545334,0x5b755b75,0x5b955b75,0x5b965b95,
-0x5b955b96,0x6bd563d6,0xde3a8c36,0xd5fae67a,0x63b58c56,0x9cf87c16,0x8c76a519,0xb5b9ad19,0x94f9a518,0x94b78c99,0x8cd894b7,0x8c978497,0x8cb88cb8,0x8cb98cb8,0x8cb88cb9,0x8c988c98,0x84b984b9,0x8cb98cb9,0x94d88cb9,0xcdb7ad18,0xff5cf6fb,0xf71bff5c,0xdedbf77b,0xce3bbdb9,0xce1bc5fb,0xce7bdebc,0xb59bb5fb,0xb59ac5fb,0xce1bbdb9,0xde9bde9b,0xef1deefc,0xf73cff7d,
-0x5b965b96,0x5b965b96,0x5b965b96,0x53965396,0x53965396,0x53965376,0x5b965396,0x5b765b76,0x53765355,0x53555376,0x53765376,0x53555355,0x53755355,0x53555375,0x53555355,0x53555355,0x4b355355,0x53555355,0x53355355,0x53355335,0x4b354b35,0x53354b35,0x4b354b35,0x4b354b35,0x4b144b35,0x4b144b35,0x4b354b14,0x4af44b14,0x4b144b14,0x4b144af4,0x4af44b14,0x4af44af4,
-0x4af44af4,0x42f44af4,0x42f442d4,0x42f442f4,0x4af442d3,0x42f442f4,0x42f442d3,0x42f442f4,0x42f442d3,0x42d442f4,0x42d342d3,0x42d342d3,0x42d342f4,0x42f442d3,0x42d342d3,0x42d342f4,0x42d342d3,0x42d342d3,0x42f442d3,0x42f442d3,0x42d342b3,0x42d342d3,0x42d342d3,0x42d33ab2,0x3ab242b2,0x42d33ab2,0x42d242d2,0x42d33ab2,0x3a923ab2,0x3a923a92,0x3a923a92,0x42b23a92,
-0x42b242b2,0x42b242b2,0x3a9142b2,0x42b242d2,0x42b242b2,0x42d342d2,0x42d242d3,0x4ad34ad3,0x4af34ad3,0x4af34ad2,0x4ad24af3,0x4af34ad2,0x42d34af3,0x4af34af3,0x4af34af3,0x4af34af3,0x4b134af3,0x53135313,0x53135313,0x53335313,0x53345333,0x53345334,0x53345334,0x5b545334,0x5b545354,0x5b545b54,0x53555354,0x5b755b75,0x5b755354,0x5b755b75,0x5b955b75,0x5b965bb6,
-0x63d65b96,0x73f65b95,0xacd694b8,0xa4d6bd57,0x6bd58c36,0x8c977c36,0x9cf894b7,0xce1aad39,0xad78debc,0x9d19ad7a,0x8cd894d8,0x8cb88cb7,0x8cb88cb8,0x8c988cb8,0x8cb88c98,0x8c988c98,0x84b984b9,0x8cb98cb9,0x8cd98cb9,0xcdd9a4f8,0xde9ad63a,0xde7ad65a,0xce5be6dc,0xc61bbd99,0xc5dabdba,0xad79ce3a,0xa5199d1a,0xc63cb5ba,0xdebdce3c,0xdebbde7b,0xe6bbde7a,0xf75deefb,
-0x5b965b96,0x5bb75b96,0x5b965b96,0x53965396,0x53965396,0x53965396,0x5b765396,0x5b965b76,0x53565376,0x53765376,0x53555355,0x53555355,0x53755355,0x53554b55,0x53555355,0x53555355,0x53555355,0x53355355,0x53354b35,0x53355335,0x4b354b35,0x4b354b35,0x4b145335,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b35,0x42f442f4,0x4af44b14,0x4b144b14,0x4af44af4,0x4af44af4,
-0x4af44af4,0x4af442f4,0x42f442f4,0x4af442f4,0x4af44af4,0x42f442f4,0x42d342d3,0x42f442d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42f442d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42b342d3,0x42d342b3,0x42d342b3,0x42d342d3,0x42d342d3,0x42b242b2,0x3ab23ab2,0x42d242d2,0x3a923ab2,0x3ab23ab2,0x3a923ab2,0x42b23a92,0x42d242b2,
-0x42b242b2,0x42b242b2,0x42b23a92,0x42b242b2,0x42d242b2,0x42d242d2,0x42d242d2,0x4ad34ad2,0x42b24ad3,0x4af34ad3,0x4af24af3,0x4af34af2,0x4af34af3,0x4af34af3,0x4af34af3,0x4af34af3,0x4af34b13,0x53135313,0x53135313,0x53335313,0x53345313,0x53345334,0x53345334,0x53345334,0x5b545b54,0x5b545334,0x53555b54,0x5b755355,0x5b755b75,0x5b955b95,0x5b955b75,0x5b955b96,
-0x5b955b75,0x6bd55b95,0x8c168415,0x9cf79c97,0x84b994b7,0x8c977c16,0x9cd78c55,0xc5989cf6,0x9cb7bd98,0x94d8a519,0x8cb894d8,0x8cb78cb8,0x8cb88cb8,0x8c988cb8,0x8c988c98,0x8c988cb8,0x84b984b9,0x8c988498,0x84b98c99,0xa5399cd8,0xbdfaad59,0xb5babdda,0xad99b59a,0xb5baa558,0xbdb9bd99,0xbe19e6dc,0xad3aa559,0xad9aad59,0xbdb9bdba,0xef3dde9b,0xe69beedc,0xf73cef1c,
-0x5bb65bb6,0x5bb65396,0x53965396,0x53965396,0x53965bb6,0x53965376,0x5b765396,0x53765b76,0x53765376,0x53765356,0x53765376,0x53765376,0x4b555376,0x53555375,0x53555355,0x53355355,0x53355355,0x4b355335,0x53555355,0x53355335,0x4b355335,0x53354b35,0x4b144b35,0x4b354b14,0x4b144b14,0x4b144b35,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144af4,0x42f442f4,
-0x42f44af4,0x42f44af4,0x42f442f4,0x42f442f4,0x42f442f4,0x42d342d3,0x42f442d3,0x42d342f4,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d442d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x3ad342d3,0x42b33ad3,0x42d342b3,0x42d342d3,0x42d342d3,0x3ab23ab2,0x3ab23ab2,0x42d33ab2,0x3ab23ab2,0x3a923ab2,0x42923a92,0x3a723a92,0x3a913a91,
-0x42b242b2,0x42924292,0x42b24292,0x42b24292,0x42b242b2,0x42d242b2,0x42d242d2,0x42d342d2,0x4ad342b2,0x42d342d3,0x4ad342d3,0x4ad34af3,0x4af34af3,0x42d342d3,0x4af342d3,0x4af34af3,0x4b134b13,0x4af34af3,0x53134af3,0x53135313,0x4b145314,0x53344b13,0x53145334,0x53345334,0x53345334,0x53345334,0x53555b54,0x5b755b75,0x5b755b75,0x5b755b75,0x5b955b75,0x5b755b95,
-0x5b955b96,0x63965b95,0x6b956b76,0x94b69c97,0x94d8ad59,0x845694b7,0x8c569497,0xa5388c56,0xa5389456,0x94d89d18,0x8c988cb7,0x8c988c98,0x8c788c98,0x8c788c78,0x84988498,0x84988498,0x84b984b9,0x84b984b9,0x8c9984b9,0x8cb88c99,0x94f994b8,0xa539ad9a,0x9d199d19,0xa51894f9,0xd63ac5da,0xdebcde9b,0xb5babdfb,0xb559a539,0xbddbbdba,0xd67bce3b,0xc5fac61b,0xce3bc5d9,
-0x53965bb6,0x53965bb6,0x53965396,0x53965bb6,0x53965396,0x53965396,0x5b765396,0x5b965376,0x53555376,0x53765376,0x53765376,0x4b565376,0x53754b56,0x53765375,0x53555355,0x53555355,0x53555355,0x53355355,0x4b355335,0x53355335,0x4b354b35,0x4b354b35,0x4b144b14,0x4b144b35,0x4b354b14,0x4b144b14,0x4b144b14,0x4af44af4,0x4b144af4,0x4af44af4,0x4af44b14,0x4af44af4,
-0x42f442f4,0x42f442f4,0x42f442f4,0x4af442f4,0x42d342f4,0x42d342d4,0x42f442d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42b342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42f342d3,0x42d33ad3,0x42d342b3,0x42d342d3,0x42d342d3,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,0x3a923ab2,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a9242b2,0x3a923a92,0x3a923a92,0x42b23a92,0x42b242b2,0x42d242d2,0x42b242d2,0x42d242d2,0x4ad242b2,0x42d342d3,0x4ad342d3,0x4ad34ad3,0x42d34ad3,0x42d342d3,0x4af34af3,0x4af34af3,0x4b134b13,0x4af34af3,0x53134af3,0x53135313,0x4b135313,0x4b144b14,0x53145314,0x53345334,0x53345334,0x5b545b54,0x53555b54,0x53555355,0x5b755b75,0x5b755b75,0x5b755b75,0x5b955b75,
-0x5b955b75,0x5b955b95,0x6bd56396,0x9cb8a519,0x7bf59497,0x8c988436,0xad79b5db,0xad59ad59,0x94f89d19,0x8c988cd8,0x8c988c98,0x84788c98,0x84788478,0x84788478,0x84988498,0x84988498,0x84988498,0x84988498,0x8c988498,0x84988c99,0x8cd98cd9,0x94f9951a,0x94d994d9,0xa51a94d9,0xd63abd99,0xe69bd67a,0xbdbadedc,0xce3bb559,0xc61ac61a,0xbddbb5da,0xb5dbb5da,0xbddabdda,
-0x5bb65bb6,0x53965396,0x5b965396,0x53965396,0x53765396,0x53965396,0x53765396,0x53765376,0x53765376,0x53555355,0x53565356,0x53755375,0x53555375,0x53555375,0x53555355,0x53555335,0x53555335,0x53355335,0x4b355335,0x4b354b35,0x4b354b35,0x4b144b35,0x4b144b35,0x4b354b14,0x4b144b14,0x4b144b35,0x4b144b14,0x4b144b14,0x4b144b14,0x4af44b14,0x4af44af4,0x42f442f4,
-0x42f442f4,0x42f442f4,0x42d342f4,0x42f442d3,0x42d342f4,0x42f442d3,0x42f442d3,0x42d342f4,0x42d342f3,0x42d342d3,0x42d33ab3,0x42d342d3,0x42d342d3,0x42d342f4,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42f43ab3,0x42d342d3,0x42d342d3,0x42b342b3,0x42b342b3,0x42b342b3,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,0x3a923ab2,0x3ab23ab2,0x3a923ab2,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3ab23a92,0x42b23ab2,0x42b23a92,0x42b23a92,0x42b242b2,0x42d242b2,0x42b242d2,0x42d242d2,0x42d242d2,0x4ad342d2,0x4ad34ad2,0x4ad34ad3,0x4ad34ad3,0x4ad34ad3,0x4ad24af2,0x4af34af3,0x53135313,0x4af34af3,0x4af35313,0x53135313,0x53145314,0x53145314,0x53345334,0x53345334,0x53545354,0x53555355,0x5b755355,0x5b755b75,0x5b755b75,0x5b755b75,0x5b765b76,
-0x5b755b96,0x5b965b75,0x6bd66396,0x84168436,0x73f58416,0xad7a8456,0x94969cd8,0x94b794b8,0x8cb78cd8,0x8c988cb7,0x84788478,0x84788478,0x84788478,0x84988478,0x84988478,0x84988498,0x84988498,0x84998498,0x84998498,0x84b88499,0x8cd88cf9,0x8cb984b9,0x8cb994d9,0x9cf994d9,0xc599a539,0xde9bd67a,0xd61ae6bc,0xd69bce5b,0xce5cd69c,0xad9bbdfb,0xbddba559,0xc61bce9c,
-0x53965396,0x53965396,0x53965396,0x53965396,0x53965396,0x53965396,0x53765376,0x53765376,0x53765376,0x53555376,0x53565356,0x53755376,0x53755375,0x53554b55,0x53555355,0x53555335,0x4b355355,0x4b355335,0x4b355335,0x4b354b35,0x4b354b35,0x4b154b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b1442f4,0x4af44af4,0x42f44af4,0x42f442f4,
-0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442d3,0x42d342d4,0x42d342d3,0x42d342d3,0x3ad342f3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42f43ab3,0x42d342d3,0x42d342d3,0x42b342d3,0x42b342b3,0x3ab342b3,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,0x3ab23a92,0x3a923ab2,0x3a923a92,0x3a923a92,
-0x3a9242b2,0x3ab23ab2,0x42b23ab2,0x42b23a92,0x42b242b2,0x42b242b2,0x42d242b2,0x42b242b2,0x42d242d2,0x42d242d2,0x4ad342d2,0x4ad342b2,0x4ad34af3,0x4ad34ad2,0x4ad34ad3,0x4ad24ad2,0x4af34af3,0x4af34af3,0x4af34af3,0x4af24af3,0x53135313,0x53135313,0x53345314,0x53344b13,0x53345334,0x53345334,0x53545354,0x5b755355,0x5b755b75,0x5b755b75,0x5b755b75,0x5b765b76,
-0x5b965b96,0x5b965b96,0x63b66396,0x6bb56bb6,0x73f673f6,0x8c578457,0x8c978c97,0x8c978c98,0x8c988c98,0x84778c98,0x84788477,0x84788478,0x84788478,0x84788478,0x84787c57,0x84988498,0x84988498,0x84998498,0x84998498,0x84788478,0x847884b9,0x8cb98478,0x94d98c99,0x9cf994d9,0xc579a4d8,0xe6bbe6ba,0xe6bbe69a,0xc61adedb,0xbdbabdda,0xad5ab59a,0xb579ad7a,0xdebdc5da,
-0x53965396,0x53965396,0x53965396,0x5b765b96,0x5b765b76,0x53765b96,0x53765376,0x53765376,0x53765376,0x53765355,0x53555355,0x53555355,0x53555355,0x53555355,0x53555355,0x4b555355,0x4b554b55,0x4b554b55,0x4b354b35,0x4b354b35,0x4b355335,0x4b144b14,0x4b144b14,0x4b354b35,0x4b144b14,0x4b144b14,0x4b144af4,0x4b144b14,0x4af44af4,0x4af44af4,0x42f44b14,0x42f442f4,
-0x4af442f4,0x42f442f4,0x42d342f4,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342f4,0x42d342d3,0x42d342d3,0x42d342d3,0x3ad33ad3,0x42d342f3,0x42d33ad3,0x42d342d3,0x42d342b3,0x42d342d3,0x42f442d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42b342b3,0x42b342b3,0x42b342b3,0x3ab33ab3,0x42b242b2,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,0x3ab23a92,0x3ab23a92,0x3ab23ab2,0x3ab23a92,
-0x3a923a92,0x3a723a92,0x3a923a72,0x3a924292,0x3a923ab2,0x42b242b2,0x42b242b2,0x42d242b2,0x42d242b2,0x42d242b2,0x42d242d2,0x42d242d2,0x4ad242d2,0x4ad24ad3,0x4ad24ad2,0x4ad34af3,0x4ad34ad3,0x4af34af3,0x4af34af3,0x4af34af3,0x53135313,0x53135313,0x53145314,0x53145334,0x53345334,0x53345334,0x53545355,0x53555355,0x5b755355,0x5b755b75,0x5b755b75,0x5b765b75,
-0x5b965b75,0x63b65b96,0x639663b6,0x63b663b6,0x74166bd6,0x7c377417,0x84587c37,0x84788458,0x84788478,0x7c788478,0x84788478,0x7c587c78,0x7c587c78,0x84788478,0x84987c78,0x84788498,0x7c787c78,0x7c787c78,0x7c978499,0x6c376bd7,0x8c987437,0x8cb973f7,0x8cb98cd9,0xad1994fa,0xeebbd5f8,0xe69bf6fc,0xeefcf6fc,0xd67be6dc,0xc5dbc5fa,0xb59ab5ba,0xb59ab59a,0xce3bbdda,
-0x53965bb6,0x53965396,0x53965396,0x5b965b96,0x5b765b96,0x53765376,0x53765b76,0x53765376,0x53555376,0x53555355,0x53555355,0x53555376,0x53555376,0x53555355,0x53355355,0x4b554b35,0x4b554b55,0x4b554b35,0x53354b35,0x4b354b35,0x4b354b35,0x4b144b35,0x4b144b14,0x4b354b14,0x4b144b14,0x4b144af4,0x4af44af4,0x4af44af4,0x42f44af4,0x42f44af4,0x42f442f4,0x4af44af4,
-0x42d342d3,0x42f442d3,0x4af442f4,0x42d34af4,0x42d342d3,0x42d342d4,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x3ad33ad3,0x3ad33ad3,0x42b33ad3,0x42d342b3,0x3ab342d3,0x42b342f4,0x42d342d3,0x42d342b3,0x42b342b3,0x42d342d3,0x42b342b3,0x42d33ab3,0x3ab342d3,0x42b342b3,0x3ab23ab2,0x3a923ab2,0x42d242d2,0x3ab23a92,0x3ab23a92,0x3a923ab2,0x3ab23ab2,0x3ab23ab2,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3ab242b2,0x42d33ab2,0x42b242b2,0x42b242b2,0x42b242d2,0x42b242b2,0x4af342b2,0x42d242b2,0x42d242d2,0x4ad242d3,0x4ad24ad2,0x4ad34ad2,0x42b24ad2,0x42b24ab2,0x42b24af3,0x4ad24af3,0x4af34af2,0x53134af3,0x53135313,0x53135314,0x53345334,0x53344b14,0x53545334,0x53545354,0x53555355,0x5b755355,0x5b755355,0x5b755b75,0x5b765b76,
-0x5b965b96,0x5b965b96,0x63b65b96,0x6bd663b6,0x74176bf7,0x7c377417,0x84577c37,0x84377c37,0x7c577c57,0x7c577c57,0x7c787c57,0x7c587c78,0x7c587c58,0x7c587c58,0x84787c78,0x7c787c37,0x74377c78,0x7c787437,0x84b97417,0x63d66bf7,0x7c367416,0x7c176bd7,0xa5197c15,0xb538ad18,0xeedbeebb,0xeedbe69a,0xff7df73c,0xf73cffbe,0xde9be6db,0xde9cde9b,0xdebce6dc,0xd67ade7a,
-0x53965bb6,0x53965396,0x53965396,0x53765b96,0x5b765376,0x53765b96,0x53765355,0x53765376,0x53555376,0x53765355,0x53555355,0x53765355,0x53555355,0x53555355,0x53355355,0x4b355355,0x4b554b35,0x4b554b55,0x53354b35,0x4b354b35,0x4b354b35,0x4b144b35,0x4b144b14,0x4b354b14,0x4b144b35,0x4b144b14,0x4af44af4,0x4af44af4,0x4b144af4,0x42f44af4,0x42f442f4,0x42d342d3,
-0x4af44b14,0x42f442d3,0x42d342f4,0x42d342d3,0x42d342d3,0x42d342d4,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x3ad33ad3,0x3ad33ad3,0x42b33ad3,0x42d342b3,0x42f442d3,0x42b33ab3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42b342b3,0x42d33ab3,0x3ab342d3,0x42b342b3,0x3ab23ab2,0x3ab23ab2,0x3a923a92,0x3ab23a92,0x3ab23a92,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23a92,0x42b23ab2,0x42b242b2,0x42b242b2,0x42b242d2,0x42d242b2,0x42b242b2,0x42d24af3,0x42d242d2,0x4ad242d3,0x4ad24ad2,0x42b24ad2,0x42b24ad2,0x42b24ab2,0x4af342b2,0x4ad24af3,0x4af34af2,0x53134ad3,0x53135313,0x53345314,0x53345314,0x53345334,0x53545334,0x53545354,0x53555355,0x5b755355,0x5b755355,0x5b755b95,0x5b765b76,
-0x5b965b96,0x5b965b96,0x6bd663b6,0x6bf76bd7,0x74176bf7,0x74177417,0x7c377c16,0x84377c37,0x7c577c57,0x7c377c57,0x7c377c57,0x7c587c37,0x7c587c58,0x7c587c58,0x7c587c78,0x7c377c37,0x74377437,0x6c167416,0x53345b74,0x74796395,0x6bb46bf6,0x84786bb6,0xbd789cb8,0xcdb9c598,0xe69ad639,0xf71bf6fc,0xff9dff5c,0xffddffde,0xff7dff9d,0xf6fbf6db,0xeefbef3c,0xeefbeefb,
-0x53965396,0x5b965396,0x53965396,0x53965396,0x53965396,0x53765396,0x53765376,0x53565355,0x53565356,0x53765376,0x53555355,0x53555355,0x53755355,0x4b555375,0x4b554b55,0x4b554b55,0x4b554b55,0x4b354b55,0x4b354b14,0x4b354b35,0x4b354b14,0x4b354b14,0x4b154b14,0x4b154b15,0x4b144b14,0x4b144b14,0x4b144af4,0x4b144b14,0x4b144af4,0x4af44af4,0x42f442f4,0x42f442f4,
-0x42f442f4,0x42d342d4,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342b3,0x42d342d3,0x42b342d3,0x42d342b3,0x42d342d3,0x42d342d3,0x42b342d3,0x3ad33ab3,0x3ad33ad3,0x42b33ad3,0x42b342b3,0x42d342b3,0x42d342d3,0x42d342d3,0x42d342d3,0x42b342d3,0x42b342b3,0x3ab33ab3,0x42d342d3,0x3ab23ab2,0x3ab33ab3,0x3a923ab2,0x3a923ab2,0x3a923ab2,0x3a923ab2,0x3a923a92,0x3a923ab2,
-0x3ab23a92,0x3a9242b2,0x3a923a92,0x42b23a92,0x429242b2,0x3a9242b2,0x42d242b2,0x42b242b2,0x42d242b2,0x42d242d2,0x42d242b2,0x42d242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42d242d2,0x4ad34ad2,0x4ad34ad3,0x4af34af3,0x4af34af3,0x4af34af3,0x53135313,0x53145314,0x53345314,0x53345334,0x53545354,0x53545354,0x53555355,0x5b755355,0x5b755b75,0x5b955355,0x5b965b75,
-0x5b965b95,0x63b65b96,0x6bd66bd6,0x73f66bf7,0x741773f6,0x74377c37,0x7c377437,0x7c577c37,0x7c377c37,0x7c377c37,0x7c577c57,0x7c387c57,0x7c587c38,0x74387c58,0x6bf67457,0x6bf77c37,0x63b652f5,0x6bd663d4,0x74175b54,0x74367c57,0x74177c78,0x9cb76353,0xcdf9bd99,0xde5ade5a,0xeebbe69b,0xff5df73c,0xffdeffbe,0xffdeffde,0xffdeffde,0xff5cff7d,0xeefbff7d,0xff3df71c,
-0x53965bb6,0x53965bb6,0x5b965396,0x53965b96,0x53965396,0x53765396,0x53765376,0x53565355,0x53565356,0x53765376,0x53555355,0x53555355,0x4b555355,0x4b555355,0x4b554b55,0x4b554b55,0x4b554b55,0x4b554b55,0x4b354b35,0x4b354b35,0x4b354b35,0x4b154b14,0x4b154b14,0x4b154b15,0x4b144b14,0x4b144b14,0x4b144af4,0x42f44b14,0x4b1442f4,0x4af44af4,0x42f442f4,0x42f442f4,
-0x42d342f4,0x42d34b14,0x42d34af4,0x42d342f4,0x42d442d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42b342d3,0x42b342b3,0x42b342d3,0x42b342b3,0x3ad342d3,0x3ad33ad3,0x42d33ab3,0x42b342d3,0x42b342d3,0x3ab342d3,0x42d342d3,0x42d342d3,0x42b342b3,0x42b342b3,0x42b342b3,0x42d342d3,0x3ab23ab2,0x3a923ab3,0x3a923a92,0x3a923ab2,0x3a923ab2,0x3ab23a92,0x3ab23ab2,0x3a923a92,
-0x3ab23a92,0x3a923a92,0x3a923a92,0x3a923a92,0x42b23a92,0x42b23a92,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242d2,0x42b242b2,0x42b242b2,0x42d242b2,0x42d242b2,0x4ad34ad3,0x4ad34ad3,0x42d34ad2,0x4af34af3,0x4af34af3,0x53135313,0x53145314,0x53145334,0x53345334,0x53345354,0x53545354,0x53555355,0x5b755b75,0x5b955b75,0x5b955b75,0x5b955b95,
-0x5b965b96,0x6bd663b6,0x6bd66bd6,0x74166bf7,0x74167416,0x73f67417,0x74177c37,0x74377417,0x7c377c37,0x7c377c37,0x7c577c37,0x7c387c57,0x7c587c38,0x6bd67c58,0x743763d5,0x5b757c37,0x4af34af3,0x53135334,0x7c386bf6,0x8c977c57,0x7c168c98,0xb5589cf8,0xcdf8bd99,0xde3acdb8,0xf6fcde5a,0xff9df73c,0xffbeffbe,0xffbeffbe,0xffbeff9d,0xffdeffde,0xffbeffbe,0xff5cff5c,
-0x53965396,0x53965396,0x53965396,0x53765b76,0x5b765b96,0x5b965376,0x53765376,0x53565355,0x53565356,0x53765376,0x53765376,0x4b565376,0x53564b56,0x4b555356,0x4b554b55,0x53354b55,0x4b355355,0x53355335,0x53354b35,0x4b354b35,0x4b144b35,0x4b154b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4af44af4,0x4af44af4,0x42f44af4,0x42f442f4,0x42d442d4,0x42d442d4,
-0x42d44af4,0x42d342d3,0x42f442d3,0x42d342f4,0x42d342d3,0x42d342d3,0x42b342d3,0x42b342b3,0x42d342d3,0x42b342b3,0x42b342b3,0x42b342b3,0x42b342b3,0x3ad342b3,0x42b33ad3,0x42d342b3,0x42b33ab3,0x3ad33ad3,0x42d342d3,0x42b342b3,0x42b342b3,0x42b342b3,0x42d342d3,0x3ab342b3,0x3ab33ab3,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,0x3a923ab2,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x42923a92,0x42b23a92,0x3ab23a92,0x42b33ab2,0x42b342b3,0x42b242b2,0x42b242b2,0x42b242d2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242d2,0x42b242b2,0x42d242b2,0x42b242b2,0x4af34af3,0x4af34af3,0x4af34af3,0x4af34af3,0x4af34af3,0x4af34af3,0x53144af3,0x53345334,0x5b755334,0x5b755354,0x53545355,0x5b755b75,0x5b755b75,0x5b955b75,0x63966396,
-0x63b663b5,0x6bd663b6,0x6bf66bd6,0x6bf66bf6,0x74177416,0x74177417,0x74177417,0x74177417,0x74377437,0x74377437,0x74387437,0x7c587438,0x74587c58,0x6bf77458,0x741763b6,0x6bd77416,0x29cf3a6f,0x74165313,0x7c587c58,0x94b87c58,0xce1c94fb,0xa517ad79,0xb516a4f7,0xde9be69b,0xde7ade5a,0xf71bef1b,0xff9eff7c,0xff9dff9d,0xfffeff9d,0xffffffff,0xffdfffff,0xff9dffbe,
-0x53965396,0x53965396,0x5bb65396,0x53765b96,0x53765376,0x53765376,0x53765376,0x53565355,0x53565356,0x53765376,0x4b564b56,0x4b354b56,0x53565376,0x4b555335,0x4b554b55,0x53354b55,0x4b355335,0x4b354b35,0x4b354b35,0x4b354b35,0x4b144b35,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4af44af4,0x42f44af4,0x4af44af4,0x4af442f4,0x42f44af4,0x42f442f4,0x42f442f4,
-0x42d442d4,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42b342b3,0x42b342b3,0x42d342b3,0x42b342b3,0x42b342b3,0x42b342b3,0x42b342b3,0x3ad342b3,0x42d33ad3,0x42b33ab3,0x42b342b3,0x3ad33ad3,0x3ab33ab3,0x42b33ab3,0x42d342b3,0x42b342b3,0x42b342b3,0x3ab33ab3,0x3ab33a92,0x3a923ab2,0x3ab23ab2,0x3a923ab2,0x3a923a92,0x3a923ab2,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a9242b2,0x3a923a92,0x42b23a92,0x3ab23a92,0x42b23ab2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42d242b2,0x42d242b2,0x42924ad2,0x42d342d3,0x4af342d3,0x4af24af3,0x4af34ad2,0x53144af3,0x53145313,0x53345334,0x53345334,0x53545354,0x53555354,0x53555b75,0x5b755b75,0x5b755b75,0x5b955b95,0x63966396,
-0x63d66bd6,0x6bd663d6,0x6bf66bd6,0x6bf66bf6,0x6bf67416,0x74167416,0x74177417,0x74177417,0x74377437,0x74377437,0x74387437,0x74177c58,0x74377437,0x74387437,0x5b543a71,0x5b547416,0x00ab6bd6,0x7c587c77,0x7c587c78,0x94d97417,0xbd9894fa,0x7bf58cb7,0xc5799435,0xd67bd67b,0xc5b8c5d9,0xde7bc5b8,0xf71cf73b,0xff7dff3c,0xfffeffde,0xffffffff,0xffdfffff,0xffdeffbe,
-0x53965396,0x53965396,0x53965396,0x53965396,0x53765396,0x53765376,0x53765376,0x53565376,0x53565356,0x53765376,0x53765376,0x4b565376,0x53554b56,0x4b355355,0x53355335,0x4b555335,0x4b554b55,0x4b354b35,0x4b354b35,0x4b144b14,0x4b354b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b14,0x4af44af4,0x4af44af4,0x4af44af4,0x42f442f4,0x42f442f4,0x42d442f4,0x42f442d4,
-0x42d442f4,0x42d442f4,0x42f442d3,0x42d342f4,0x42d342d3,0x42d342d3,0x42b342b3,0x42b342b3,0x42b342b3,0x3ab342b3,0x3ab342b3,0x42d33ab3,0x42b342b3,0x42b342b3,0x42b33ab3,0x42d342b3,0x42b342d3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x42b33ad3,0x42b33ab3,0x42b33a92,0x3ab33ab3,0x3a923a92,0x3ab33ab3,0x3ab23ab2,0x3ab23ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab242b2,0x42b23ab2,0x42b242b2,0x42b242b2,0x42d242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42d242b2,0x42d23ab2,0x42b242d2,0x42b242b2,0x42b24ad2,0x42d242d2,0x4ad242d2,0x4af24af2,0x4af34af2,0x4af34ad3,0x53145313,0x53345314,0x4b345334,0x53545354,0x5b555354,0x5b745b75,0x63955b75,0x63956395,0x63956396,0x63b663b5,
-0x6bd663b5,0x6bd66bd6,0x6bd66bf6,0x6bf673f7,0x74177416,0x74177417,0x74177417,0x74177417,0x74387417,0x74387417,0x74387438,0x74387438,0x74587438,0x53336bd6,0x7c374af2,0x53137416,0x7c585b94,0x84787437,0x84788478,0x9d187c16,0x84578456,0x7c167c16,0xad79a519,0xad58b579,0x9cd7ad79,0xad189cf7,0xde9cc5da,0xff5ceebb,0xfffffffe,0xffffffff,0xffdeffff,0xf77dffde,
-0x53965396,0x53965396,0x53965396,0x53965396,0x53965396,0x53765396,0x5b765376,0x53565355,0x53565356,0x53765376,0x4b565376,0x4b554b56,0x53554b55,0x53355355,0x53355335,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b144b14,0x4b144b35,0x4b144b14,0x4b144b35,0x4af44b14,0x4b144b35,0x4af44af4,0x42f44b14,0x42f44b14,0x4af442f4,0x42f442f4,0x42d442f4,0x42d442f4,
-0x42d442d4,0x42d442d4,0x42d342d3,0x42d342d3,0x42d342d3,0x42b342d3,0x42d442d3,0x42b33ab3,0x42d342b3,0x42b342b3,0x42b342b3,0x42d342b3,0x42b342b3,0x42b342d3,0x42b33ab3,0x42b342b3,0x42b342b3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x42b33ad3,0x3ab33ab3,0x42d342d3,0x42b33ab3,0x3ab33ab3,0x3a923a92,0x3ab23ab2,0x3a923ab2,0x3a923ab2,0x3a923a92,0x3ab23ab2,0x3a923a92,
-0x3a923a92,0x3a923ab2,0x3a923a92,0x3a923a92,0x3ab242b2,0x42923ab2,0x42b24292,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x3ab242b2,0x42b23ab2,0x42b242b2,0x4ad242b2,0x4ad242b2,0x42d242d2,0x4ad242d2,0x4af24af2,0x4af34af2,0x4af34af3,0x53145313,0x53345314,0x53345334,0x53555334,0x5b755355,0x5b755b75,0x63955b75,0x63956395,0x63966396,0x63b563b5,
-0x6bd66bd6,0x6bd66bd6,0x6bd66bd6,0x741673f7,0x74177416,0x6bf77417,0x74177417,0x74177417,0x74377417,0x74387437,0x74377438,0x74387438,0x7c587c58,0x5b7463b6,0x5b333a71,0x6bd673f7,0xa59d7416,0x74175b74,0x74377c57,0xa5796bb5,0x94d84aaf,0x8cb86bb4,0x94f794d8,0x8c7694b7,0x94787bf6,0x9cd98c57,0xce1aad19,0xff3be65a,0xfffffffe,0xffffffff,0xffbeffde,0xe6fcf75d,
-0x5b965b96,0x5b965b96,0x53965396,0x53965376,0x53965396,0x5b765396,0x53565376,0x53565356,0x53565356,0x53565356,0x4b565376,0x53355356,0x53355335,0x53555356,0x4b555355,0x4b554b55,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b14,0x4b154b14,0x4b154b15,0x42f44315,0x4af44af4,0x42f44b15,0x4af44af4,0x42f442f4,0x42d442f4,0x42f442f4,0x42d442d4,
-0x42f442d4,0x42d342d3,0x42b342d3,0x42d342b3,0x3ab342d3,0x42b342b3,0x42b342d3,0x42b342b3,0x42b342b3,0x42d342b3,0x42b342b3,0x42b342b3,0x42b33ab3,0x42b342b3,0x42b33ab3,0x42b342b3,0x42b342b3,0x3ab342b3,0x42f43a92,0x3ab342d3,0x3ab342b3,0x42b33ab3,0x42b33ab3,0x3ab33a92,0x3ab33a92,0x3a923ab3,0x3ab23ab2,0x3ab23ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x42b23a92,0x3ab23a92,0x3a923ab2,0x3a923a92,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42d242b2,0x4ad24ad3,0x4ad24ad2,0x4ad34ad3,0x4af24ad3,0x4af34af2,0x53135313,0x53135313,0x53345314,0x53545334,0x5b755354,0x53555355,0x5b755b75,0x5b756395,0x63966396,0x63b66396,0x63b663b6,
-0x6bd663b6,0x6bd66bd6,0x6bf66bd6,0x6bf77417,0x6bf76bf7,0x74176bf7,0x74177417,0x74177417,0x74177417,0x74377417,0x74387437,0x74387438,0x7c587c58,0x63b663d6,0x3a714ad2,0x849a4ab2,0xa57c7417,0x74377c37,0x7c587417,0x94d87c58,0x6b9473f5,0x94f89d39,0x84576355,0x94b99d1a,0x94f97bf6,0x9cf99d18,0xcdb9b57a,0xffbde6ba,0xffdeffde,0xffdeffde,0xff5dffbe,0xe6bcf73d,
-0x5b965b96,0x5b965b96,0x53765396,0x53965376,0x53965396,0x53555396,0x53565376,0x53565356,0x53565356,0x53565356,0x4b565376,0x53355356,0x53355335,0x4b355356,0x4b355355,0x4b554b55,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b14,0x4af44b14,0x4b154b15,0x42f44315,0x4af44af4,0x42f44b15,0x4af44af4,0x42f442f4,0x42d442f4,0x42d442f4,0x42f442f4,
-0x42d442d4,0x42d342d3,0x42d342d3,0x42d342d3,0x3ab342d3,0x42b342b3,0x42b342d3,0x42b342b3,0x42b342b3,0x42d342b3,0x42b342b3,0x42b342b3,0x42b33ab3,0x42b342b3,0x42b342d3,0x3a9242b3,0x42b342b3,0x3ab342b3,0x3ab342d3,0x3ab342d3,0x3ab33a92,0x3a923ab3,0x3a923a72,0x3ab33a92,0x3ab33a92,0x3a923a92,0x3ab23ab2,0x3ab23ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x42b23a92,0x3ab23a92,0x3a923ab2,0x3a923a92,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42b242b2,0x42d242b2,0x4ad24ad3,0x4ad24ad2,0x4ad34ad3,0x4af24ad3,0x4af34af2,0x53135313,0x53135313,0x53345314,0x53545334,0x5b755354,0x5b755355,0x5b755b75,0x5b756395,0x63966396,0x63b66396,0x63b663b6,
-0x6bd66bd6,0x6bd66bd6,0x6bf66bd6,0x6bf77417,0x6bf76bf7,0x74176bf7,0x74177417,0x74377417,0x74177417,0x74377417,0x74387437,0x74387438,0x74587c58,0x42917417,0x3a505354,0x4ab131ee,0x849973f6,0x3a727c37,0x74175b56,0x7c587417,0x84985b53,0x849794d9,0x8c9894d9,0x94b894b9,0x94d994b9,0xa5199d18,0xcddab559,0xf73ceefb,0xff7cff7c,0xffbeff7d,0xff9eff7d,0xf73dff7d,
-0x5b965b96,0x53765b76,0x53965396,0x53965396,0x53765376,0x53765376,0x53765376,0x53565356,0x5b765356,0x53565356,0x4b564b56,0x4b355356,0x53365356,0x4b555356,0x4b554b55,0x4b354b35,0x4b554b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b144b15,0x4af44af4,0x4b154b14,0x4b154b15,0x42f442f4,0x4af44af4,0x42f442f4,0x4af442d4,0x42f442f4,0x42f442f4,0x42d442d4,0x42d442d4,
-0x42d442d4,0x42d342d3,0x42b342d3,0x42d342d3,0x42d342d3,0x42b342b3,0x3ab342b3,0x42b342d3,0x42b342b3,0x42b342b3,0x42b342b3,0x42b342b3,0x3ab33ab3,0x3ab342b3,0x42b33ab3,0x42b342b3,0x42b33ab3,0x42b342b3,0x3ab33ab3,0x3ab342b3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x42b33a92,0x3a923ab3,0x3ab33a92,0x3ab242b2,0x3ab23ab2,0x3ab23a92,0x3a923ab2,0x3a923a92,0x3ab23a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23a92,0x3a923ab2,0x3a923a92,0x42b242b2,0x42b242b2,0x3a9142b2,0x42b242d2,0x42b242b2,0x42d242b2,0x42b242b2,0x42b23a92,0x42b242b2,0x4ad24292,0x4ad34ad3,0x4ad34ad3,0x4af24af3,0x53134af3,0x53135313,0x53135313,0x53145314,0x53545334,0x53345355,0x5b755355,0x63955b75,0x63966395,0x63966396,0x63b66396,0x63b663b6,
-0x6bd66bd6,0x6bd66bd6,0x6bf66bf7,0x6bf76c17,0x74176bf6,0x74177417,0x74377417,0x74177417,0x74176c17,0x74377417,0x74387417,0x74387438,0x74387417,0x63957437,0x29ee6bd6,0x63945b33,0x847808ca,0x6bd66bd6,0x74177437,0x53377c58,0x6c167c79,0x847873d6,0x84788456,0x94d994d9,0x94d994d9,0x9cf99cf8,0xd5dab57a,0xeefcf6fb,0xde9af73c,0xf71cf6fb,0xff7df71c,0xe6dbf77c,
-0x5b965b96,0x5b965b96,0x53765396,0x53765396,0x53965376,0x53765396,0x53565376,0x53765356,0x53765376,0x53765376,0x4b565376,0x53565376,0x4b554b55,0x4b554b35,0x4b554b55,0x4b554b55,0x4b354b55,0x4b354b35,0x4b344b35,0x4b354b35,0x4b154b35,0x4b154b15,0x4b144af5,0x4b144b14,0x43144314,0x4af44af4,0x42f44af4,0x42f442f4,0x42d342f4,0x42d342f4,0x42f442d3,0x42f442d3,
-0x3ad442d4,0x42d442d4,0x42d342d3,0x3ab342d3,0x42b342d3,0x42b342d3,0x3ad342b3,0x3ad33ad3,0x3ad33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab342b3,0x3ab33ab3,0x42b33ab3,0x3ab342b3,0x42b33ab3,0x3ab33ab3,0x3ab342b3,0x3ab33ab3,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23a92,0x3ab23ab2,0x3a923ab2,0x3ab23a72,0x3a923a92,0x3ab23ab2,0x3ab23a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x42b23a92,0x3a923a92,0x3ad23ad2,0x3ab23ab2,0x42d342d3,0x42d242d3,0x42b242d2,0x42b242b2,0x42d242b2,0x42b23ab1,0x42b242b2,0x42d342d2,0x42d342d3,0x4af34af3,0x4af34af3,0x4af34af3,0x53135313,0x53135333,0x53345334,0x53545354,0x53545354,0x5b755355,0x63955b75,0x63966396,0x63966396,0x63b663b6,0x63b663b5,
-0x6bd66bd6,0x6bd66bd6,0x6bf76bd6,0x6bf66bf7,0x6bf76bf7,0x6bf77417,0x74177417,0x74176bf7,0x74176c17,0x74377417,0x74377437,0x7c587458,0x74587c58,0x5b756c17,0x53547438,0x52f24af2,0x216b298f,0x5b146bb4,0x7c787417,0x53777c78,0x74377c37,0x8c997c38,0x94d89d3a,0x9cf99cf9,0x9cf99cf9,0x8c778437,0xeeddad17,0xbd98d67b,0xce3ab577,0xde39cdd8,0xd5f7de58,0xd659e6db,
-0x5b965b96,0x5b965b96,0x53965b96,0x53965396,0x53765396,0x53765376,0x53565376,0x53765376,0x53765376,0x53765376,0x53564b56,0x4b554b35,0x4b554b55,0x4b554b55,0x4b354b55,0x4b354b55,0x4b554b35,0x4b354b35,0x4b344b34,0x4b354b35,0x4b154b35,0x4b154b15,0x4af44af4,0x4b144b14,0x43144314,0x42f44af4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42d342f4,0x42d342d3,
-0x3ad43ad4,0x42d442d4,0x42d342d3,0x42d342d3,0x42b342d3,0x42b342b3,0x3ad342b3,0x3ad33ad3,0x3ab33ab3,0x3ab33a93,0x3ab33ab3,0x42b33a92,0x42d33ab3,0x3ab342b3,0x3ab33ab3,0x3ab33ab3,0x3ab342d3,0x42b33ab3,0x42b342b3,0x3ab33ab3,0x3ab33ab3,0x3a923ab3,0x3a923a92,0x3ab33ab3,0x3a923a92,0x3ab23a92,0x3ab23ab2,0x3a923ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x42b23a92,0x42d23ab2,0x3ab23ab2,0x3ab23ab2,0x42b23ab2,0x42b242b2,0x42b242b2,0x42d242d2,0x42d242d2,0x42d242d2,0x42d342d2,0x42d342d3,0x42d34af3,0x4af34af3,0x4af34af3,0x53135313,0x53135313,0x53345334,0x53545354,0x53555355,0x5b955355,0x63955b95,0x63966395,0x63966396,0x63b663b6,0x6bd663b6,
-0x6bd66bd6,0x6bd66bd6,0x6bf76bd6,0x63b56bf6,0x74176bd6,0x6c177417,0x74177417,0x74177417,0x74177417,0x74377417,0x74387438,0x7c587438,0x74377458,0x74577477,0x5b955b95,0x29cd3250,0x29ac0889,0x741652d2,0x7c986bd7,0x32938498,0x84998458,0x8cb88498,0xa53aa53a,0xa539a55a,0xa539a55a,0x84558456,0xbdf9a538,0x84139d38,0x8c548c55,0xac94b537,0xd639d639,0xef1ceefb,
-0x53965396,0x5b965b96,0x53965396,0x53765396,0x53965376,0x53765376,0x53765355,0x53765376,0x53765376,0x4b565376,0x4b564b56,0x4b355376,0x4b564b35,0x53354b55,0x4b555335,0x4b354b55,0x4b354b35,0x4b344b34,0x4b344b34,0x4b344b34,0x4b144314,0x4b144b14,0x4af44b14,0x4b144b14,0x43144315,0x42f44314,0x4af442f4,0x42f442f4,0x42f442d4,0x42f442f4,0x42d342d4,0x42d342d3,
-0x3ad43ad3,0x3ad43ad4,0x42f342d3,0x42b33ad3,0x3ad342b3,0x42b33ad3,0x3ab342b3,0x3ad33ab3,0x3ad33ab3,0x3ab342b3,0x42b342d3,0x3ab33a92,0x3ab33ab3,0x3ab33ab3,0x3ab342b3,0x42b33ab3,0x3ab342d3,0x42b342b3,0x42b342b3,0x3ab33ab3,0x3ab33ab3,0x3ab33a92,0x3a923a92,0x3a923a92,0x3ab33a92,0x3a923ab3,0x3a923a92,0x3ab23a92,0x3a923ab2,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x42b33a92,0x42b242b3,0x42d342b2,0x3ab242b2,0x42b242d3,0x42d342d2,0x42d242d3,0x42b242b2,0x42d242b2,0x42d342d3,0x42f342d3,0x4af34af3,0x4af34af3,0x4af34af3,0x4b134af3,0x4b144b14,0x53145314,0x53345334,0x5b555334,0x5b755b75,0x5b755b75,0x5b755b95,0x63966396,0x63b663b6,0x63b663b6,0x63b663b6,
-0x63b66bd6,0x5b956bd7,0x5b745b75,0x6bf76bf6,0x6bf76397,0x6bf77417,0x6bd67417,0x74187417,0x74176c17,0x74377437,0x74387438,0x7c587438,0x7c587c58,0x7c596396,0x745763f6,0x29ef5b74,0x9cfa31cd,0x84778457,0x7c196396,0x31d06c37,0x849a7c57,0x84998499,0x94f994fa,0x9d3a94d8,0x94d76333,0x73f473b5,0xb5b99cf7,0x62f07c16,0x94976310,0xb5789475,0xc5f9ad78,0xb493bd16,
-0x53965396,0x5b965b96,0x53765396,0x53965396,0x53765396,0x53765396,0x53765376,0x53765376,0x53765376,0x53764b56,0x4b564b56,0x4b565356,0x4b554b56,0x53354b55,0x4b554b35,0x4b354b55,0x4b354b35,0x4b344b34,0x4b354b34,0x4b354314,0x4b144314,0x4b144b14,0x4b144b14,0x4af44af4,0x43154314,0x42f44314,0x4af442f4,0x42f442f4,0x42f442f4,0x42d442f4,0x42d342d4,0x42f442d3,
-0x42d442d4,0x3ad442d4,0x3ad33ad3,0x42b33ad3,0x3ab342b3,0x42b33ad3,0x3ab342b3,0x3ab33ab3,0x3ab33ad3,0x42b33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33a92,0x3ab33a92,0x3a923ab3,0x3a923a92,0x3a923ab3,0x3a723a72,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x42b23a92,0x42b242b2,0x42b242b3,0x42d342b2,0x42d342d3,0x42d242d3,0x42d342d2,0x42d242d3,0x42d242d2,0x42d242d2,0x42d342d2,0x4af34af3,0x4af342d3,0x4b134b13,0x4af34af3,0x4af34af3,0x4af34af3,0x53144af3,0x53345334,0x5b555b54,0x5b755b55,0x5b955b75,0x63965b95,0x63966396,0x63b663b6,0x63b66396,0x639663b6,
-0x639563b6,0x5b555b75,0x6bf74ad3,0x63b663b7,0x5b545b74,0x74176bf6,0x6bf77437,0x74186bd6,0x74177417,0x74377417,0x74377438,0x74387438,0x7c587458,0x63b67c58,0x5b7663d7,0x32105333,0x320f52d2,0x7c363a50,0x73f74ad3,0x10ec7c7a,0x84798498,0x8cb98499,0x94f99d1a,0x7c1673d5,0x6bd46bd6,0x84575b13,0x94b894d7,0x420f5b33,0x7c149d19,0x8c779d18,0x8c347bf4,0xe67b8bd2,
-0x53965396,0x53765b96,0x53765b96,0x53965396,0x53965396,0x53765376,0x53765376,0x53765376,0x53565376,0x53765376,0x53564b56,0x53764b56,0x4b555376,0x4b354b55,0x4b554b55,0x4b554b55,0x4b354b55,0x4b344b35,0x4b144b14,0x4b154b15,0x4b354b15,0x4af44b14,0x4b144b14,0x4b144b14,0x4af44af4,0x42f44af4,0x4af44b14,0x42f442f4,0x42f442f4,0x42f442f3,0x42b342d4,0x42d442d4,
-0x42f33ad3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x3ab33ad3,0x3ad33ab3,0x3ab33ad3,0x3ab33ab3,0x42b33ab3,0x3ab342b3,0x3ab33ab3,0x3ab33ab3,0x3ab33a93,0x42b33ab3,0x42b342b3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3a923ab3,0x3a923ab3,0x3a923a92,0x3a923a92,0x3a723a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23a92,0x3ab23ab2,0x42b23ab2,0x42b242b2,0x3ab23ab2,0x42b242b3,0x42b342d3,0x42d242d3,0x42d342d2,0x42d342b3,0x4af342b3,0x4af342d2,0x42d342d3,0x4af34af3,0x4af44af4,0x4af34af4,0x4b134b13,0x4b134af3,0x4af34b14,0x53145314,0x53345334,0x5b555b54,0x63955b75,0x63b66396,0x63965b96,0x63966396,0x63b663b6,0x63b663b6,0x6bd663b6,
-0x5b965b95,0x6bd65b75,0x5bb46bb6,0x53543a92,0x5b545375,0x639563b6,0x74177417,0x6bf75b96,0x74187418,0x74177418,0x74377458,0x74387458,0x7c587c58,0x74387c58,0x5b964af2,0x5b5663b4,0x324f5b74,0x5b324ad1,0x73f65b96,0x8c787c79,0x6bd76395,0x8cb97c58,0x8cf994fa,0x84b88cf8,0x73b69d3a,0x7c3652f1,0xb5b97c55,0x5b92adbc,0x951b5b54,0x6b928cba,0xb579c61b,0xad179cf7,
-0x53965396,0x5b765b76,0x53765b76,0x53765396,0x53965376,0x53765376,0x53765376,0x53765376,0x53765376,0x4b564b56,0x4b564b56,0x4b565356,0x4b554b56,0x4b554b55,0x4b554b55,0x4b354b35,0x4b554b35,0x4b354b35,0x4b144b14,0x4b154b15,0x4b144b15,0x42d342f4,0x42f442d4,0x4b1442f4,0x4af44af5,0x42f44af4,0x42f442f4,0x431542f4,0x42f442f4,0x42f442f4,0x42d442d4,0x42b342b3,
-0x3ad33ad3,0x3ad342f3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x3ab33ad3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x42b33ab3,0x3ab33ab3,0x42d33a92,0x3a923ab3,0x3a923a92,0x3a923a92,0x3ab33272,0x32723ab3,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23ab2,0x42b23ab2,0x3a9242b2,0x3ab23ab2,0x42b342b3,0x42b342b3,0x42d242b3,0x42d342d2,0x42d342d3,0x4af342d3,0x4af34af3,0x4af442d3,0x4af34af3,0x4af44af4,0x4af34b14,0x4b134af3,0x4b134b13,0x4b135334,0x53345314,0x53345334,0x5b555334,0x5b755b75,0x5b966396,0x63965b96,0x63b663b6,0x63b663b6,0x63b663b6,0x6bd663b6,
-0x4b146bf7,0x4b145355,0x63b56c17,0x5b3563b5,0x53134272,0x53335334,0x6bf76395,0x6bf763d7,0x73f77438,0x6bf77438,0x74177c58,0x7c587437,0x7c587437,0x5b757c58,0x6c377458,0x5b744272,0x7c586bf6,0x11297c78,0x7c378497,0x84586bf8,0x74187418,0x84986bf6,0x84b88cd9,0x74178cb8,0x31ee8476,0x73b56bd3,0x94b78457,0x4ad1424e,0x6bf48478,0x31cb5b32,0x7bf494b7,0xad189497,
-0x53965396,0x5b965b96,0x5b965b76,0x53765376,0x53965376,0x53765376,0x53765376,0x53765376,0x53765376,0x4b564b56,0x4b564b56,0x4b565356,0x4b554b56,0x4b554b55,0x4b554b55,0x4b354b35,0x4b554b35,0x4b354b35,0x4b144b14,0x4b154b15,0x4b354b15,0x42d342f4,0x42d34af4,0x4b1442f4,0x4af44af5,0x42f44af4,0x42f442f4,0x42d43ab3,0x42f442f4,0x3a9342f4,0x42d442d4,0x42d442d4,
-0x3ad33ad3,0x42f33ad3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x3ab33ab2,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3a923ab3,0x42d33ab3,0x3a9242d3,0x3a923ab3,0x3a923a92,0x3a923a92,0x32723ab3,0x3a923a92,0x3a723a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23ab2,0x42b23ab2,0x3a9242b2,0x3ab23ab2,0x42b342b3,0x42b342b3,0x42d242b3,0x42d342d2,0x42d342d3,0x4af342d3,0x4af34af3,0x4af442d3,0x4af34af3,0x4af44af4,0x4b144af3,0x4b134b14,0x4b134b13,0x53344b13,0x53345334,0x53345334,0x5b555b54,0x5b755b75,0x5b966396,0x63965b96,0x63b663b6,0x63b663b6,0x63b663b6,0x639563b6,
-0x53345334,0x42d342b2,0x112c21cf,0x4ab021cd,0x21ce4290,0x5b7463b6,0x5b756395,0x5b952a10,0x6bf76bd7,0x6bd64af3,0x743863b6,0x5b757417,0x7c586bf6,0x6bf77c58,0x6c3763b7,0x29d06c16,0x741629ee,0x42d25b94,0x6bd60005,0x7bf742d3,0x745973f7,0x84787c37,0x84988cb9,0x5b548498,0x426f9d38,0x63549d59,0x5af26b95,0x3a2f7c36,0x5b514271,0x94b77c56,0x637373d5,0xa4b87bd5,
-0x53965396,0x5b765b96,0x53565396,0x53965376,0x53765396,0x53755376,0x53565376,0x53765356,0x53765376,0x53764b56,0x4b564b56,0x4b564b56,0x4b554b56,0x4b554b56,0x53554b55,0x4b354b35,0x4b354b35,0x4b354b35,0x4b154b15,0x4b144b14,0x4b144b14,0x42f44b14,0x42d442d4,0x4b154af4,0x43144314,0x42f442d4,0x42f442f4,0x3ad342f3,0x42f342f3,0x3ab342f3,0x3ab342b3,0x42d442d4,
-0x3ad43ad4,0x42f33ad3,0x3ad33ad3,0x3ad33ad3,0x42b33ad3,0x42b33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab23ab3,0x3ab33ab2,0x3ab33ab3,0x3a923ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3a923a92,0x3a933a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a723a92,0x3a923a92,0x3a923a92,0x3ab23a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,0x3a923ab2,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342f3,0x42d342d3,0x4af34af4,0x4af44b14,0x4af34af3,0x4b144af3,0x4b144b14,0x4b134b14,0x4b144b13,0x4b144b14,0x4b144b14,0x53345334,0x53545354,0x53555355,0x63955b75,0x63b66395,0x5b965b96,0x63b65b96,0x63b663b6,0x63b663b6,0x63b663b6,
-0x5b955b75,0x5b9563d6,0x63955b54,0x4b135b74,0x63743a70,0x63956374,0x6bd65b75,0x63b55b55,0x74175b75,0x42b27417,0x63d642b2,0x5b757437,0x5b543a92,0x7c587c58,0x74386bf6,0x74377c58,0x8cda7c77,0x63b5194e,0x218b7c78,0x7c3752cf,0x7c787c58,0x74377c78,0x6bf67c78,0x63b57c57,0x218c7c98,0x8c986b95,0x73f610ea,0x63338478,0x5b1229ad,0x73f67c37,0x9cf973f5,0xa518a518,
-0x53965396,0x5b765b96,0x4b565b97,0x53965396,0x5b765396,0x53765376,0x53765376,0x53765356,0x53765376,0x4b565376,0x4b565356,0x53564b56,0x4b354b35,0x4b554b55,0x53554b55,0x4b354b35,0x4b354b35,0x4b354b35,0x4b154b15,0x4b354b35,0x4b144b14,0x4b154b14,0x4b154b15,0x4af44af4,0x43154314,0x42f442f4,0x42f442f4,0x42f342f3,0x42f442f3,0x42b43ab3,0x42d442d4,0x42d442d4,
-0x3ad43ad4,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x3ab33ad3,0x42b33ab3,0x3ab342b3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab2,0x3ab23ab3,0x3a923ab3,0x3ab33a92,0x3a923ab3,0x3a923a92,0x3ab33ab3,0x3ab33ab3,0x3a923a92,0x3a923a92,0x3ab33a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a723a72,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23ab2,0x3ab23a92,0x3ab242d3,0x42d33ab2,0x42d342d3,0x42d342d3,0x42d342d3,0x4af342f3,0x4ad342d3,0x4af44af3,0x4af44af4,0x4b144af4,0x4b144b14,0x4b144b14,0x4b144b14,0x4b144b13,0x4b134b13,0x4b144b14,0x53545334,0x53545354,0x53555b75,0x63955b75,0x5b966395,0x5b9663b6,0x63b663b6,0x63b663b6,0x63b663b6,0x63b663b6,
-0x533463b6,0x63b65b96,0x63955354,0x5b765b74,0x63955b55,0x42b10047,0x196d5b73,0x218c298d,0x6bf64291,0x6bd65333,0x63d65b74,0x74575bb5,0x5b757478,0x741708ea,0x74386bf6,0x6bf67458,0x7c587c59,0x7c397c78,0x8d1a08eb,0x42504a6d,0x74376bb5,0x6bf75334,0x6bd68498,0x63b55353,0x6bd66bd7,0x31cd6b74,0x5b337c37,0x216b7c17,0x73b652d1,0x94d98c98,0xa55994f9,0xc61bd69c,
-0x53965396,0x53765396,0x4b564b56,0x53775376,0x4b565377,0x53765376,0x53765376,0x4b355356,0x53765356,0x53564b56,0x4b565356,0x4b564b56,0x4b554b56,0x4b354b55,0x4b354b35,0x53355355,0x4b355335,0x4b344b35,0x4b154b15,0x43144314,0x4b144315,0x4b144b14,0x4af44af4,0x4af44af4,0x4af44af4,0x42f44af4,0x42f44af4,0x42d33a92,0x42f442f4,0x42d33a92,0x42d442d3,0x42d442d4,
-0x42d342d3,0x3ad342d3,0x42b342b3,0x42b342b3,0x3ab342b3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3a923ab3,0x3ab33ab3,0x3ab23ab3,0x3ab33ab3,0x3a923ab3,0x3ab33a92,0x3ab33ab3,0x3ab33ab3,0x3ab23a92,0x3ab23ab2,0x3a923ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a723a92,0x3a723a72,0x3a923a92,0x3a923a92,0x3a923271,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23ab2,0x3ab23ab2,0x42d33ab2,0x42b242b2,0x42d342d3,0x42f342d3,0x42f342d3,0x4af342f3,0x4b144af4,0x4b144b14,0x4b144b14,0x4b144b14,0x53344b14,0x4b144b14,0x4b144b14,0x53344b14,0x53345334,0x53345334,0x53545354,0x5b755b75,0x5b755b75,0x5b965b95,0x63b65b96,0x63b65b96,0x63b65b96,0x63b663b6,0x63d663d6,
-0x5b955b75,0x42d25355,0x42b23230,0x63b64b34,0x63b55b75,0x4b125353,0x29ac7416,0x6bd53a2e,0x429152f2,0x6bd64ad2,0x4ad242b2,0x6bd642d2,0x5b556bd6,0x74185b75,0x4ad13a51,0x5b557c58,0x7c587417,0x74377417,0x5b545334,0x39490005,0x73f54af2,0x6bf763b5,0x53535313,0x4b336bd6,0x8cd9951c,0x6bd694da,0x5af34271,0x84365b34,0x94b88c98,0x8cfa8cda,0x9cfa94d9,0xb5dbadba,
-0x53965396,0x53765396,0x539642f4,0x53765396,0x53764b16,0x53765376,0x53765376,0x4b355356,0x4b565356,0x4b354b35,0x4b564b35,0x4b564b56,0x4b554b56,0x4b554b56,0x53354b35,0x4b354b35,0x4b354b35,0x4b344b35,0x4b154b15,0x43144b35,0x4b144315,0x4b144b14,0x4b144af4,0x42f44b14,0x4af44af4,0x4b1442f4,0x42d342d3,0x42f43ab3,0x3ab342f4,0x42b33ab3,0x42d442f4,0x42d442d4,
-0x42d342d3,0x3ad33ad3,0x42b342b3,0x42b342b3,0x3ab342b3,0x3ad33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3a923ab2,0x3ab33a92,0x3a923a92,0x3a923a92,0x3ab33ab3,0x3a923ab3,0x3ab23ab2,0x3ab33ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x32723a72,0x3a723272,0x3a723a72,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23a92,0x3ab23ab2,0x42d33ab2,0x42b342b3,0x42d342d3,0x42d342d3,0x42f342f3,0x4af442f3,0x4b144af4,0x4b144b14,0x4b144b14,0x4b144b14,0x53344af3,0x4b144b14,0x53344b14,0x53345334,0x53345334,0x53545334,0x53555354,0x5b755b75,0x5b955b75,0x63b65b95,0x63b65b96,0x63b663b6,0x63b663b6,0x63b663b6,0x5b9563b6,
-0x63b65b95,0x4b135354,0x5b755b95,0x5b955b95,0x5b9663d7,0x53556396,0x53555334,0x52f36395,0x29ac196b,0x63737436,0x427029ad,0x94fb298d,0x74577417,0x6c167437,0x42b36bf7,0x3a50849a,0x74387437,0x7c587c78,0x7c587c78,0x00246c37,0x7456422d,0x63956bd6,0x743763b6,0x32707437,0x8497318d,0x216d42f4,0x5b13951a,0x84783a2f,0x8cd98cd9,0x8cfa8cd9,0x94da94da,0x951a94f9,
-0x5b965b96,0x42f55396,0x5b965376,0x4b355396,0x53765376,0x53965376,0x53765376,0x43154b35,0x4b564b15,0x53764b56,0x53564b56,0x53565356,0x4b555356,0x4b554b55,0x4b354b55,0x4b354b35,0x4b354b35,0x4b344b35,0x4b354b15,0x4b154b15,0x43154b15,0x43144315,0x43144315,0x43144314,0x4af44af4,0x42f442f4,0x42f43ab3,0x42f342b2,0x3a923251,0x42b442d3,0x42d342d4,0x42d342d3,
-0x42d342d3,0x42d342d3,0x42b342b3,0x3ad342b3,0x3ab33ab3,0x3ab33ab3,0x3a933ab3,0x3a923a93,0x3ab33a92,0x3a923a93,0x3a923a92,0x3ab23a92,0x3ab23ab3,0x3ab23ab2,0x3ab33ab3,0x3a923ab3,0x3a923ab3,0x3ab23ab3,0x3ab23ab2,0x3a923ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x32723a92,0x3a923a92,0x32723a72,0x3a723a72,0x3a923a72,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23a92,0x3ab23ab2,0x3ab23ab2,0x42d33ab2,0x42d342d3,0x42d342d3,0x42d342d3,0x42f342f3,0x42f342f3,0x4af44b14,0x4b144af4,0x4b344b14,0x4b344b14,0x4b344b34,0x53344b34,0x53345334,0x53345334,0x53345354,0x53545354,0x53545354,0x5b765355,0x5b965b75,0x5b965b76,0x5b965b96,0x63b65b96,0x63b663b6,0x63b663b6,0x63d663d7,
-0x63d663b6,0x63b663d6,0x63d663d6,0x5b9663d7,0x63b66bf7,0x5b755b96,0x4af342b2,0x194c3a71,0x63b563b5,0x214c5353,0x6bb310c8,0x3a0e73f5,0x74176353,0x6bb673f6,0x63b663b6,0x320f3250,0x7c586397,0x7c597456,0x7c587438,0x7c9b7c78,0x420a0084,0x63746395,0x74574ad3,0x53345354,0x7416b5db,0x845908ec,0x3a305314,0x8cd9951a,0x8cda8cb9,0x8cda8cb9,0x8cda8cda,0x94fa8cda,
-0x5b965b96,0x42d45396,0x5b965376,0x42f45376,0x4b355376,0x53754b35,0x53765396,0x53563ad3,0x53564b35,0x4b565376,0x4b564b56,0x53565356,0x4b555356,0x4b554b55,0x4b564b35,0x4b354b35,0x4b354b35,0x4b344b35,0x4b154b15,0x4b154b15,0x43154b15,0x4b154b35,0x43144b35,0x43144314,0x42f44af4,0x42d44af4,0x327242d3,0x32513ab2,0x32513a92,0x42b33a92,0x42d33a93,0x42d342d3,
-0x42d342d3,0x42d342d3,0x3ab342d3,0x3ad33ab3,0x3ab33ad3,0x3ad33ad3,0x3ab33ab2,0x3ab33ab3,0x3ab33a92,0x3a923a92,0x3a923ab3,0x3ab23a92,0x3ab33ab2,0x32923ab2,0x3a923ab2,0x3ab33a92,0x3a923a92,0x3ab33ab2,0x3ab23ab2,0x3a923ab2,0x3a923a92,0x3a723a92,0x3a923a92,0x3a723a92,0x3a713a92,0x32723a72,0x3a723a72,0x3a923a72,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a72,0x3a923a92,0x3a923a92,0x3a923ab2,0x3ab23a92,0x3ab242d3,0x3ab23ab2,0x42d33ab2,0x42d342d3,0x42d342d3,0x42f342d3,0x42f34b14,0x4b1442f3,0x4af44b14,0x42f44af4,0x4b344b14,0x4b344b34,0x4b344b34,0x53344b34,0x53345335,0x53345335,0x53345334,0x53545355,0x53555334,0x5b765b75,0x5b965b75,0x5b966396,0x5b965b96,0x63b663b6,0x5b965b96,0x63d663b6,0x63d663d6,
-0x63d663b6,0x63b663d6,0x63d663b6,0x63d76bf7,0x63b66bf7,0x53345b96,0x5b754af3,0x63965b75,0x52f44af4,0x21ce5335,0x52b15b74,0x428f0087,0x00066bb4,0x74165b73,0x743763b5,0x6bf77437,0x63b57c57,0x5b754293,0x7c796bd6,0x74597c58,0x00a642b0,0x7c787bf4,0x7c587c78,0x198d84db,0x7c575b53,0x847710ea,0x7c589d7b,0x8cb97c37,0x8cd98cd9,0x8cda8cd9,0x8cda8cda,0x8cfa8cda,
-0x5b965b96,0x4b363ab3,0x5b965b96,0x4b155356,0x53765376,0x53755376,0x4b354b35,0x53565376,0x53564b35,0x4b565376,0x4b564b56,0x53565356,0x4b555356,0x4b554b55,0x4b564b35,0x4b354b35,0x4b354b35,0x4b344b35,0x4b154b15,0x4b154b15,0x43154b15,0x4b1542f4,0x43144314,0x43144314,0x42f44af4,0x42d44af4,0x42b33a92,0x42d33a92,0x42f42a30,0x3a9342d3,0x42d342b3,0x42d342d3,
-0x42d342b3,0x42d342d3,0x42d342d3,0x3ad342d3,0x3ab33ab3,0x3ab23ad3,0x3ab33ab2,0x3ab33ab3,0x3ab33a92,0x3ab33a92,0x3a923ab3,0x3ab23a92,0x3ab33ab2,0x3ab33ab2,0x3a923ab2,0x3a923a92,0x3a923a92,0x3ab33ab2,0x3ab23ab2,0x3a923ab2,0x3a923a92,0x3a723a92,0x3a923a92,0x3a723a92,0x3a713a92,0x32723a72,0x3a723a72,0x3a923a72,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a72,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23a92,0x42d33ab2,0x3ab242d3,0x42d33ab2,0x42d342d3,0x42d342d3,0x42f342d3,0x42f342f3,0x4b1442f3,0x4af44b14,0x4b144af4,0x4b344b14,0x4b344b34,0x4b344b34,0x53344b34,0x53555335,0x53345335,0x53545354,0x53545355,0x53555375,0x5b765b75,0x5b965b75,0x5b966396,0x5b965b96,0x63b663b6,0x63b663b6,0x63d663b6,0x63b663d6,
-0x6bf763d7,0x535463b6,0x63d65334,0x63d75b96,0x63b66bf7,0x63b65b96,0x63b66bd7,0x6bd76bf7,0x74167416,0x42d263d5,0x63553a51,0x5b3173d4,0x112a3a2d,0x000500a8,0x5b535333,0x7c997c58,0x00286bb7,0x3a7184b8,0x7c7963b6,0x74377c58,0x00c76c18,0x7c7820c6,0x7c797c57,0x322f3a93,0x5b7363d5,0x3a308437,0x6bd60069,0x74177c57,0x84998499,0x8cda8cd9,0x8cda8cda,0x8cfa8cda,
-0x4af44b35,0x53965356,0x3ab35396,0x53765377,0x53565396,0x4b354b35,0x53755356,0x53765375,0x4b554b35,0x53755375,0x4b564b56,0x4b564b56,0x4b564b56,0x4b554b55,0x4b354b55,0x4b354b35,0x4b354b35,0x4b154b15,0x4b154b15,0x4b154b15,0x4b154b15,0x43154315,0x43144314,0x42f44315,0x42f44af4,0x42d342f4,0x42b242d3,0x42d23ab2,0x3ab221ef,0x42d33ab2,0x42d442d3,0x42d442d4,
-0x3ad33ad4,0x42b342b3,0x3ab342b3,0x3ad33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3a923ab3,0x3ab33ab3,0x3ab33a92,0x3ab33a92,0x3ab23ab3,0x3ab23ad3,0x3ab33ab2,0x3ab33ab2,0x3ab23292,0x3a923ab3,0x3ab33ab3,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a723272,0x3a923a92,0x3a923a72,0x3a723a72,0x3a723272,0x3a923a72,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x42b33a92,0x42b23a92,0x42b342d3,0x42d342b3,0x42d342d3,0x42d342d3,0x42f34b14,0x4b144af3,0x4b344b14,0x4b144b34,0x4b344b34,0x4b344b34,0x4b144b14,0x53345334,0x53355335,0x53555335,0x53755375,0x53755355,0x5b755355,0x5b965b55,0x5b965b96,0x63965b96,0x5b965b96,0x63b65b96,0x5b965b96,0x63d75b96,0x63d75b96,
-0x63d763d7,0x5b965b96,0x533463b7,0x4af35b95,0x63b66bd7,0x5b545b75,0x32305313,0x6bd66bd6,0x53346395,0x6bf66395,0x63b66bd6,0x5b756bf7,0x4ad24b13,0x00a5110a,0x5b306393,0x5b5208c7,0x112a3a6f,0x7c1610c9,0x7c163a31,0x74387c58,0x74377c79,0x08850045,0x7c5773d5,0x8d1b7c78,0x5b124a8f,0x7c37adbc,0x849808a9,0x84997417,0x8cb98cb9,0x8cd98cd9,0x8cda8cda,0x8cda8cda,
-0x4b355355,0x53755397,0x53964b34,0x4b5542f5,0x43154b55,0x53765377,0x53755376,0x53765375,0x53564b35,0x4b555375,0x4b564b56,0x4b564b35,0x53564b56,0x4b554b55,0x4b154b35,0x4b355335,0x4b354b35,0x4b154b15,0x4b154b15,0x4b154b15,0x43154b15,0x43144314,0x43144314,0x42f44315,0x42d44af4,0x42d342b3,0x3a924b14,0x3ab242d2,0x42d32a30,0x327242d3,0x42b43a92,0x42d43ab3,
-0x3ab33ad4,0x42b342b3,0x42b33ab3,0x3ad342b3,0x3ab33ad3,0x3ab33ab3,0x3ab342b3,0x3ab33ab3,0x3ab33a92,0x3ab33ab3,0x3a923ab3,0x3ab23a92,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,0x3a923ab3,0x3a923ab3,0x3a923a92,0x3ab33a92,0x3a923a92,0x3a923a92,0x32723272,0x32723a72,0x32713271,0x3a723272,0x32723272,0x32723a72,0x3a923a72,0x3a923a92,0x3a923a92,0x3ab23a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923ab2,0x3a9242b2,0x42d342b3,0x42b342b3,0x42b342b3,0x42d342d3,0x42f342d3,0x42f342f3,0x42f342f3,0x4b144b14,0x4b344b34,0x4b344b34,0x4b344b14,0x53345334,0x53344b14,0x53355335,0x53555355,0x53755375,0x53755375,0x5b755b75,0x5b765b75,0x5b965b76,0x5b965b96,0x5b965b96,0x63965b96,0x63b663b6,0x63b663b6,0x63b763b7,
-0x63b75b96,0x63b663b7,0x42d242d3,0x4af242f2,0x320e5333,0x3a904af2,0x5333322f,0x4ad23a71,0x218c7c37,0x21ac52f2,0x3a714af1,0x5b744af3,0x74376c17,0x5b946c17,0x08865b74,0x5b0f31ea,0x00242969,0x3a0c6b30,0x8c9752d0,0x42946bd7,0x7c786c18,0x00046c16,0x73d40004,0x63f88437,0x31eb3a2e,0x6b946353,0x73f57c37,0x8cb98499,0x8cb98cb9,0x8cd984d9,0x8cda8cd9,0x8cda8cda,
-0x5b965375,0x53555b96,0x53753293,0x3ad342f4,0x53754b76,0x53765376,0x5b765376,0x53765355,0x4b354b35,0x4b354314,0x4b154b54,0x4b554b35,0x4b354b55,0x4b565335,0x4b554b35,0x53354b35,0x4b355335,0x4b344b35,0x4b144b14,0x43154315,0x43154315,0x42f442f4,0x43144b15,0x43154315,0x42f44314,0x42d342f4,0x3ab23ab2,0x3a923271,0x3a923271,0x42d342b2,0x3a923271,0x3ab33ab3,
-0x42d33292,0x3ab23ad3,0x3ad33ad3,0x3ad33ad3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab2,0x3ab33ab3,0x3ab33a92,0x3a923ab3,0x3a923a92,0x3ab23a92,0x3a923ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a723a92,0x3a723a92,0x32723a72,0x3a723a72,0x3a723272,0x3a723a72,0x3a723a92,0x32713a72,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3ab23ab2,0x3a923ab2,0x3a923a92,0x3a923a92,0x3a923ab2,0x42b23a92,0x42b242b2,0x42d342b2,0x42b342d3,0x42d342d3,0x4af34af3,0x4af34af4,0x4af44af3,0x4b144af4,0x4b144b14,0x4b144b14,0x4b344b34,0x4b354b35,0x53354b35,0x53555335,0x53755375,0x53755375,0x53755375,0x5b765b75,0x5b765b76,0x5b965b96,0x5b965b96,0x5b965b96,0x63b66396,0x63b663b6,0x63b663b6,0x63d763b7,
-0x5b7663b7,0x63b563d7,0x32504af2,0x53143230,0x6bd529cf,0x29ee4290,0x322d194b,0x298d3a0e,0x08c95b32,0x214a0047,0x29ac216a,0x63743a2e,0x4af35313,0x3a713a30,0x741729ce,0x4ad173f6,0x08860004,0x4a4c0844,0x4a6f0004,0x52f1296a,0x7c797c38,0x84997c79,0x18e93a2d,0x7c576b93,0x10e808ca,0x3a0e422d,0x741794b9,0x84b984b9,0x84ba84ba,0x8cda8cda,0x8cd98cd9,0x8cda8cda,
-0x4b345b96,0x42f35b96,0x3ad34315,0x32924335,0x53755396,0x53965376,0x53555376,0x53965355,0x3a923ab2,0x4b354314,0x42f45375,0x4b154b15,0x53355376,0x4b355356,0x4b1542f4,0x4b354b35,0x4b354b15,0x4b344b55,0x4b144b14,0x43154315,0x4b154315,0x3ad34314,0x43144314,0x43144314,0x42f44314,0x42b33ab3,0x4b133271,0x3a923a92,0x42d32a30,0x42d33a92,0x3ab13271,0x2a303a91,
-0x3ab33ad3,0x3ad33ab2,0x3ad33ad3,0x3ab33ad3,0x3ab33ab3,0x3ab33ab3,0x3a923ab3,0x42b33a92,0x3ab33ab3,0x3ab23ab2,0x3a923a92,0x3a923a92,0x3ab33a92,0x3ab23a92,0x3a923ab2,0x3ab33a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a723a92,0x3a723a72,0x3a723a72,0x3a723272,0x32723272,0x32723272,0x3a723a92,0x32723272,0x3a923a72,0x3a923a92,0x3a923a92,0x3a923271,
-0x3ab23a92,0x3ab23ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x42b242b2,0x42b342d3,0x42b342b2,0x42d342b2,0x42b342d3,0x4af34af3,0x4af34af3,0x4af44af3,0x4b144af4,0x4b144b14,0x4b144b14,0x4b344b34,0x4b354b35,0x53354b35,0x53555335,0x53755355,0x53755375,0x53755375,0x5b765b76,0x5b965b96,0x5b765b76,0x5b965b96,0x5b965b96,0x5b965b96,0x63d763b6,0x63b763b6,0x63d763b7,
-0x5b9663d7,0x42d35334,0x4af342d3,0x5b555b95,0x5b754af3,0x4ad25b75,0x218c218d,0x5b33426f,0x4ad26bb5,0x5b125b74,0x52f052d1,0x52b173f5,0x00473a2e,0x31ee0006,0x6b944ab2,0x6bd67437,0x7c3773f6,0x10668c97,0x63313189,0x00032949,0x73f56b93,0x74387437,0x73b25b12,0x3a0e7c15,0x3a2f7c77,0x7c154a6d,0x84b994d9,0x84ba7c79,0x8cda84b9,0x84ba84ba,0x8cd98cd9,0x8cd98cd9,
-0x5b964b35,0x22126395,0x4b144b35,0x53553293,0x53355b75,0x53565356,0x4af45376,0x4b154b14,0x4b133ab3,0x42d44b13,0x43144314,0x4b554b35,0x4b354b55,0x4b354b14,0x4b353a93,0x53354b14,0x4b354b14,0x4b354b35,0x4b144b14,0x4b144b35,0x4b144b14,0x42f44b14,0x42d44314,0x43144314,0x42f44314,0x42d33ab3,0x3ab242b3,0x42d242d2,0x42b33271,0x429342b3,0x3a503a91,0x32702a0f,
-0x2a113271,0x3ab33ab3,0x3ad33ad3,0x3ad33ad3,0x3ab33ab3,0x3ab33a93,0x3a933293,0x42b33ab3,0x3a923ab3,0x3ab23ab2,0x3ab33ab3,0x3a923293,0x3a923ab3,0x3a923a93,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a723a92,0x3a723a72,0x32723272,0x32723272,0x32723251,0x32923292,0x32723272,0x3a923272,0x3a923a92,0x32713a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23a92,0x42b23a92,0x42b242b2,0x42b342b3,0x42d342b3,0x42d342d3,0x42f342d3,0x42f442f3,0x4af442f4,0x4b144af4,0x4b344b14,0x4b344b34,0x53345334,0x53355335,0x53355335,0x53755355,0x53755375,0x53755375,0x5b765b75,0x5b765b76,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x63b65b96,0x5b965b96,0x63b663b6,0x63d763b7,
-0x5b755b96,0x63b65b75,0x63d75b96,0x5b965355,0x4af463b6,0x53355b56,0x6bf763b6,0x5b756bd7,0x6bd663d6,0x5b536bf7,0x429142b1,0x29ad29ad,0x110a29ce,0x6bf5322e,0x74366bb4,0x31ee5b33,0x00461109,0x00260046,0x00040005,0x52ae0886,0x08022106,0x5b7473f4,0x00264a91,0x9d1ab5db,0x6bd20005,0x7c350006,0x84970005,0x84b984ba,0x84ba84ba,0x84ba84ba,0x8cd98cda,0x8cfa8cd9,
-0x53555355,0x53764af4,0x53553ab3,0x537632b3,0x4b355354,0x53555355,0x4b154af4,0x32315334,0x53335314,0x42b342f3,0x42d34b34,0x4b554b35,0x53555355,0x4af55335,0x4b355335,0x42f44af4,0x4b144b35,0x4b354b35,0x4b144b14,0x4b144af4,0x4b144b14,0x42f342d3,0x42f43ab3,0x43144314,0x42f44314,0x3ab342f4,0x3a9242b3,0x42d23250,0x3a913a91,0x427242b2,0x29ce3a50,0x329121ce,
-0x42b32a30,0x3ad33ad3,0x3ab23ad3,0x3ad33ad3,0x42b33ab3,0x3ab33a93,0x3a933a93,0x3ab33a93,0x3ab33ab3,0x3ad33ab3,0x3a933ab3,0x3a923a93,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923ab3,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a72,0x3a723a92,0x32723272,0x32723a92,0x32723272,0x32723272,0x32713292,0x32513272,0x3a923a72,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23a92,0x3a923ab2,0x42b242b3,0x42b342b2,0x42d342b3,0x42d342d3,0x42f342d3,0x42d442f3,0x4af442f4,0x4b144af4,0x4b144b14,0x4b344b34,0x53345334,0x53355335,0x53355335,0x53555355,0x53755355,0x53755375,0x5b765355,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x63b65b96,0x63b663b6,0x63b763d7,0x63b663b7,
-0x63d763b7,0x63b763d7,0x63d763d7,0x63d763d7,0x5b7663b6,0x5b965b96,0x63b66bd7,0x6bf76bd7,0x6bf66bf6,0x535363b6,0x5b535b74,0x6bb54ad1,0x5b545313,0x73f65313,0x08a94ad1,0x5b545333,0x63756375,0x52b35b54,0x52f16354,0x31eb3a0e,0x18c60864,0x10831063,0x6b5152cd,0x845610a7,0x10c88478,0x00441906,0x847752cf,0x84997c79,0x84b984b9,0x84ba84ba,0x8cb98cb9,0x8cda8cd9,
-0x5b965355,0x3ab23a93,0x42d35bb6,0x53552a52,0x42f45b75,0x42f34b14,0x4af44b14,0x4af35b75,0x4ad33a6f,0x32923a70,0x42b35335,0x53965355,0x53554b34,0x4b354b35,0x42b35355,0x537542d3,0x42d542d4,0x4b154b15,0x4b354b14,0x4b3442d3,0x42d242f3,0x42d33a91,0x431442d4,0x43144314,0x43144314,0x42d44af4,0x3a7242d4,0x3a922a10,0x32313251,0x3a703a71,0x2a0f29cd,0x42b121ce,
-0x32513271,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x3ab33ab3,0x3ab33a72,0x3ab33a92,0x3a923a72,0x3ab33ab3,0x32923ab2,0x3ab23292,0x3a923ab2,0x3ab33ab3,0x3ab33ab3,0x3a923a92,0x3a923a92,0x3a923a92,0x3a723a92,0x3a923a92,0x3a723a92,0x3a723a72,0x32723a72,0x32723272,0x32513272,0x3a923a72,0x32723251,0x32513a72,0x32713272,0x3a713271,0x3a723a92,0x32723272,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a72,0x3a923a92,0x3ab23a92,0x42d33ab2,0x42d33ab2,0x42d342b2,0x42d342b3,0x42f342d3,0x42f442f3,0x4af442d3,0x4b144af4,0x4b144b14,0x4b144b35,0x4b354b35,0x53355335,0x53355335,0x53755335,0x53765375,0x53765376,0x5b765b76,0x5b965b76,0x5b755b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b966396,0x63b763b7,0x63b763b6,0x63d763b7,
-0x5b9663b7,0x63d75b96,0x63d763d7,0x639663d7,0x63d763d7,0x5b765b75,0x63b66bf7,0x4af34af3,0x537542f4,0x4ad25bb6,0x29cf5313,0x42b24af3,0x31ad08eb,0x425031ad,0x6bb57c59,0x5b546bf5,0x00a921ad,0x53120048,0x6bf55b33,0x6bf56bd5,0x6c166bf5,0x08653a2d,0x08420001,0x526d1045,0x9496420b,0x21482929,0xbdbb0824,0x6bf78cba,0x84b984b9,0x84ba84b9,0x84ba84ba,0x8cd98cba,
-0x3a925375,0x21cf5335,0x4b345355,0x53352a52,0x4b145b55,0x535542d3,0x4ad33a92,0x32315314,0x321042d1,0x42f342b1,0x42f45355,0x4b554b35,0x4b354b55,0x4b144314,0x4b354b35,0x4b3442d3,0x42d35355,0x4b1542f4,0x42f44b14,0x3a9242f4,0x42b23a91,0x42d33250,0x42f342d4,0x43144314,0x43144314,0x3ab342f4,0x429242d4,0x29ef42d3,0x429142b2,0x427042b2,0x21ce29ad,0x322f21ce,
-0x3ab32a10,0x3ad33ad3,0x3ab33ad3,0x3ad33ab3,0x3ab33ab3,0x3a723a92,0x32513a92,0x3ab33a92,0x3a923a92,0x3ab33ab2,0x3ab23ab3,0x3a923ab2,0x3ab33292,0x3ab33ab3,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab33a92,0x3a923a92,0x3a723a92,0x3a723a72,0x32723a72,0x3a923a92,0x32513272,0x32523a72,0x32513251,0x32513a72,0x32713a92,0x3a713271,0x3a723a92,0x32723272,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a72,0x3a923a92,0x3ab23a92,0x3a923ab2,0x42d33ab2,0x42d342b2,0x42d342b3,0x42f342d3,0x42f44b14,0x42d34b14,0x4b144af4,0x4b144b14,0x4b144b35,0x4b354b35,0x53355335,0x53355335,0x53755355,0x53765375,0x53765376,0x5b765b76,0x5b965b75,0x5b755b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b966396,0x5b965b96,0x63b763b6,0x63d763b7,
-0x63b763b7,0x63d763b7,0x63d763d7,0x5b9663d7,0x63b65355,0x53345b75,0x6bd76bd7,0x5b346396,0x4b145b75,0x5b5463d7,0x74174ad2,0x63b66396,0x5b545313,0x52d26354,0x74175b34,0x6bd76c17,0x53346c37,0x741729ce,0x73f67417,0x74377c58,0x84b97437,0x84767c56,0x298b2129,0x00020823,0x00220022,0x422c7c12,0x086220c5,0x84998cb9,0x84b984b9,0x84ba84b9,0x8cda84ba,0x8cd98cba,
-0x42f33a92,0x42d55b95,0x42f35b96,0x4b142211,0x5b965b95,0x53754b35,0x533542f3,0x218e29cf,0x31f042d1,0x4b343a70,0x53554af4,0x4b145376,0x4b354b35,0x42d34314,0x4b144b35,0x42f12a10,0x3ab24b33,0x4b134b14,0x42f43ab3,0x4b343ab3,0x29ef3250,0x42d32a10,0x42f342d4,0x431442f4,0x42d442f4,0x42f442f4,0x42b242d4,0x322f3250,0x320e3270,0x21ad4ad1,0x29ee218c,0x32304af2,
-0x3a923ab2,0x3ad33ab2,0x3ab33ad3,0x32922a51,0x3a923ab3,0x3a923272,0x2a313231,0x32723a92,0x32723272,0x3ab33272,0x3ab33ab2,0x3ab23292,0x3ab23ab2,0x3a923ab2,0x3ab33a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a723a72,0x3a723a72,0x32723a72,0x3a723a72,0x32723a72,0x32513a72,0x32523272,0x32513a92,0x3a923272,0x3a923a92,0x32723a92,0x3a723a72,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923ab3,0x3ab23a92,0x3ab23ab2,0x3ab242d3,0x42d342b3,0x42d342d3,0x42f342d3,0x42f442f3,0x42f442d3,0x4af44af4,0x4af44af4,0x4b354b35,0x4b354b14,0x53355335,0x53355335,0x53555355,0x53765375,0x5b765b76,0x5b765b76,0x5b965b76,0x5b965b75,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x63b663b6,0x63b763b6,0x63b763b7,
-0x63d763b6,0x63b763d7,0x53345b76,0x63b663d7,0x53555b76,0x5b765355,0x63b64ad3,0x4ad25334,0x6bd65b54,0x6bf773f7,0x6bf77417,0x5b556bf7,0x5b755b75,0x42b26bf7,0x4ad35333,0x5b765334,0x53135354,0x6bb65b34,0x7c387c38,0x7c587c38,0x6bd67438,0x3a505b75,0x00040004,0x18e80026,0x41ec2107,0x00030004,0x20c410a2,0x74176b90,0x6bf67438,0x7c586bf7,0x6bf77c58,0x9d3b7c38,
-0x63b65b75,0x42f33ab3,0x42f33a71,0x4b344af4,0x43145374,0x2a315376,0x533563d7,0x4af25313,0x42f229ee,0x42d44b13,0x4af44b35,0x535542d3,0x42f35355,0x4af342d3,0x4af34af3,0x32304af3,0x32514b13,0x42f342d3,0x3a923a92,0x53354af4,0x32303a91,0x2a2f3250,0x42d33ab3,0x42f44b14,0x42d34af4,0x429342b3,0x29ef42d3,0x320f198c,0x194c3a70,0x218d3a70,0x21ef194c,0x21ce2a0f,
-0x3a713271,0x42b33ab3,0x327242b3,0x3ab23a92,0x32513a92,0x2a1021cf,0x32723a92,0x3a923272,0x2a303271,0x3a923292,0x3a923ab3,0x3ab33a92,0x3a923a92,0x3a923ab3,0x3a923a92,0x3a923a92,0x3a923a92,0x3a723a92,0x32923292,0x32923292,0x3a723292,0x3a723272,0x3a723252,0x32723272,0x32723a72,0x32723272,0x3a723a72,0x32713272,0x3a923a92,0x3a723271,0x32723272,0x3a923a92,
-0x3a723a72,0x3a923a92,0x3a923a92,0x3a723a92,0x3a923a92,0x3ab33a92,0x3a923ab3,0x42b33ab3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42f442f4,0x4af44af4,0x4b144af4,0x4b144b14,0x4b144b14,0x4b354b35,0x53355335,0x53555355,0x53765355,0x53765376,0x5b765b76,0x5b765b76,0x5b965b76,0x5b965b76,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x63b763b6,0x63d763b6,
-0x63b763d7,0x63b763d7,0x63b75b96,0x3ab25355,0x53353ab2,0x5b965335,0x4af33250,0x3a716396,0x42b24af3,0x63b65314,0x5b956bf7,0x53344af3,0x4af36396,0x53143210,0x322f4291,0x7c583a70,0x63b63a50,0x4ad26395,0x52f329cd,0x00683230,0x112a4290,0x53123a0e,0x7c178498,0x84996375,0x84787c58,0x73f58478,0x00010003,0x21260822,0x7c35422c,0x84ba84b8,0x8cd98498,0x9d198457,
-0x4af35354,0x4b3421cf,0x2a5042b2,0x5b963a93,0x4b344b54,0x5b765396,0x3a5142d3,0x5b954291,0x2a0f21ce,0x53352a0f,0x53554b35,0x4af442f4,0x4b1442d3,0x4af342d3,0x4af342d3,0x3a9142b2,0x3a913230,0x4b343271,0x4b144b34,0x53145315,0x4af33a91,0x2a303a92,0x42b33ab3,0x42d34af4,0x4af442b3,0x42b23a71,0x29ce29ef,0x3a70218c,0x29ee3a70,0x2a0e3a50,0x3270196c,0x3a9142d2,
-0x3ab23271,0x3a923ab3,0x3ab33231,0x3ab23a72,0x3a933ab2,0x3a922a10,0x2a303a92,0x32503a91,0x3a923a92,0x3ab23292,0x3ab33a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923ab3,0x3a923a92,0x3a923a92,0x3a923a92,0x32923292,0x32923292,0x32723292,0x3a723272,0x3a723a72,0x32723272,0x32723272,0x3a723252,0x32523252,0x3a923272,0x3a923a92,0x3a923a92,0x3a923272,0x3a923a92,
-0x3a723a72,0x3a923a72,0x3a723a92,0x3a923a92,0x3a923a92,0x3ab33a92,0x3ab33ab3,0x3ab33ab3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x42f44b14,0x42f442f4,0x4af442f4,0x4b144b14,0x4b354b35,0x53354b35,0x53355335,0x53555355,0x53555355,0x53765376,0x5b765b76,0x5b765b76,0x5b765b76,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x5b965b96,0x63b663b6,0x63b663b6,
-0x63d763b6,0x535563b6,0x42b142d3,0x637542d2,0x5b944291,0x5b955b95,0x3a714b13,0x5b756396,0x42924af3,0x53344ad3,0x5b755313,0x53124b13,0x74165b74,0x6bf66bf6,0x32306bf6,0x84567bf7,0x31ed3a0e,0x0046190a,0x00670045,0x52f25b12,0x63947c37,0x7c5729ae,0x7c797c58,0x7c997438,0x7c987c78,0x84997c98,0x94fb7c38,0x00420887,0x20e40022,0x84778c75,0x8cb88cb8,0xad5a9cf9,
-0x63b563b5,0x42b242d2,0x21ef3a91,0x53554b34,0x4b554b15,0x5b765376,0x53555b96,0x6394110b,0x4b134af2,0x4af34b13,0x4b344b34,0x42f44b15,0x4af33ab2,0x42d23a91,0x42d24b13,0x53334af3,0x198e5334,0x42d33ab2,0x4b343ab2,0x4af44ad4,0x29ee2a0f,0x2a0f3a70,0x42f43a91,0x42d33a92,0x42d342d3,0x3a703a71,0x320f4291,0x3a6f320e,0x29ce218c,0x198c2a0e,0x42b23a71,0x3a714af3,
-0x42b1322f,0x32313a72,0x32513271,0x3ab33ab2,0x2a303ab3,0x3a923ab2,0x3a9121cf,0x21ce322f,0x32512a30,0x3a923272,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x32923a92,0x32923292,0x3a923a92,0x3a723a92,0x32923292,0x3a923292,0x32723a72,0x3a723a72,0x32723272,0x32723a92,0x32723272,0x32723272,0x32723272,0x32723272,0x32713a72,0x3a923a92,0x3a923a92,0x3a723a72,
-0x3a923a72,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab33a92,0x3ab23ab2,0x42d342b2,0x42d342b3,0x42d342d3,0x42d342d3,0x42f442d3,0x42d342f4,0x4af442f4,0x4b144af4,0x4b354b14,0x4b354b35,0x53354b35,0x53555335,0x53555376,0x53555355,0x5b765b76,0x5b765b76,0x5b765b76,0x5b965b96,0x5b965b76,0x5b965b76,0x5b965b96,0x5b975b97,0x5b965b96,0x63b663b6,
-0x63d763b7,0x4b135b75,0x322f3270,0x4af342b2,0x08eb320f,0x4ad221ae,0x4ad263b6,0x5b5421af,0x63b65b75,0x53556bd7,0x6395114c,0x63955b54,0x427063b5,0x5b3373f6,0x4af26bf7,0x320e320e,0x5b125af2,0x18c931ec,0x10ea426e,0x7c378458,0x53347438,0x6c174b15,0x7c587c58,0x74387c79,0x84997417,0x84997c78,0x7c788499,0x7c177417,0x0023216a,0x00010043,0x9477ad5a,0xc61cb57a,
-0x325029ef,0x63b62a0f,0x116e5b75,0x4b144b54,0x5b964b14,0x53555375,0x53555376,0x5b533a70,0x3a714af2,0x4b144af3,0x4ad34af3,0x533442b3,0x2a1042b1,0x42d23250,0x42b23a91,0x42d34b13,0x42d242d2,0x32713251,0x4b3442d3,0x42b342d3,0x320f114c,0x2a0f4ad2,0x3a923a92,0x4b1442f4,0x3a723a92,0x2a2f42b3,0x320f3250,0x42b13a6f,0x21ad196c,0x2a2e322f,0x3a713a92,0x32502a0f,
-0x325029ef,0x3a712a2f,0x32513a71,0x42b23251,0x3a713a71,0x2a0e3a50,0x21ee2a0e,0x322f3250,0x3ab23ab2,0x3a923a92,0x3a923ab3,0x3a923a92,0x3a923a92,0x3a923a92,0x32923a92,0x3ab23292,0x3a923a92,0x3a723a92,0x32923292,0x3a723292,0x3a723a72,0x3a723a72,0x3a723a72,0x3a723272,0x32513272,0x32723272,0x32723272,0x3a723a72,0x3a713a72,0x3a923a92,0x3a923a92,0x3a723a72,
-0x3a723a72,0x32723a72,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab23ab2,0x3ab23ab2,0x3a923ab3,0x42b33ab3,0x42d342d3,0x42d342d3,0x42d342d3,0x42f442d3,0x4b144af4,0x4b144b14,0x4b144b14,0x53354b14,0x53555335,0x53555376,0x53765355,0x5b765b76,0x5b765b76,0x5b765b76,0x5b965b76,0x5b965b76,0x5b965b76,0x5b965b96,0x63b75b96,0x5b965b96,0x63b65b96,
-0x63b663b6,0x4ad35355,0x3a504b13,0x29ee320f,0x4af24af3,0x5b754af2,0x6bf65b54,0x218c5335,0x63b57c78,0x63d663d5,0x112b5b96,0x3a715b54,0x3a504af2,0x63955333,0x7c585333,0x4ad108a9,0x5af14a70,0x73d44aaf,0x7c3873f7,0x5b546375,0x6c3863b6,0x7c997437,0x7c787458,0x7c597c79,0x7c797c79,0x84997c79,0x84998499,0x84998499,0x84998499,0x00665312,0x20420822,0xe69bddf8,
-0x32713250,0x42d242f2,0x220f42f3,0x42f44313,0x53554b15,0x53765355,0x4b355355,0x118f21ce,0x3a726315,0x53133a70,0x4af24291,0x3a713a70,0x3a7129cf,0x3a714ad2,0x3a913a92,0x4ab242b2,0x4290322f,0x3a71194b,0x42d342d3,0x4b1342d2,0x3a7021ce,0x2a0e112b,0x32713251,0x42f33a92,0x42d342f4,0x3a9142f4,0x320f21cf,0x322e214d,0x429108a9,0x322f2a2f,0x29ee3a90,0x42b1218d,
-0x21ae3a71,0x3a713a70,0x3a713a71,0x32503a91,0x322f21ce,0x198c29ce,0x3271324f,0x3a912a0f,0x3ab23272,0x3ab23ab3,0x3a933a93,0x3ab23a93,0x3a923ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a72,0x3a723a72,0x3a923a72,0x32923a72,0x3a723292,0x3a723a72,0x32723272,0x3a723251,0x3a723a72,0x32723272,0x3a723272,0x32723272,0x3a723a72,0x3a723a72,0x3a723a72,
-0x3a723a72,0x3a923a92,0x3a923a92,0x3a923272,0x3a923a92,0x3a723a92,0x3a923a92,0x3a923a92,0x3ab33a92,0x3a933ab3,0x42b33a93,0x42d342b3,0x42f442d3,0x42f442d3,0x42f442f4,0x4af44af4,0x4b144b14,0x4b145355,0x53354b35,0x53555335,0x53355355,0x53765376,0x53765355,0x5b765b76,0x5b765b56,0x5b765b76,0x5b965b76,0x5b765b96,0x5b965b96,0x5b965b96,0x5b765b96,0x5b755335,
-0x5b965b75,0x42b14af3,0x4af35b54,0x53145334,0x5b765b75,0x53155b76,0x42b24b14,0x63964272,0x216d29ce,0x00686375,0x4ad26bd6,0x7c385333,0x63735b34,0x52f25332,0x5b544af2,0x42706395,0x845710e9,0x5b5452d2,0x7c586bb6,0x00a98cfa,0x63967417,0x74397438,0x5b955b96,0x74387417,0x7c597438,0x84997c59,0x849a8498,0x84998499,0x84b97c99,0x5b957c78,0x00000001,0x59a71841,
-0x196d4290,0x42b14b13,0x42b15b54,0x327142f2,0x42f342f4,0x4af44b34,0x43145355,0x10e76395,0x42d05333,0x4ad2320e,0x42b13a2f,0x320f29ee,0x3a715334,0x42b14ad2,0x4271322f,0x3a514ad2,0x218c31ee,0x3230196c,0x42f342d3,0x42b242d2,0x21ae21cf,0x322f3230,0x3ab23a71,0x42d342f3,0x42d342f4,0x4b1342d3,0x31ef3251,0x4aaf4ab2,0x3a7029ed,0x21cd198d,0x21cd21ee,0x29ee3a50,
-0x320e196c,0x322f29ee,0x3a50322f,0x322f3a50,0x320f322f,0x324f090a,0x220f42b1,0x3a913250,0x3ab23ab2,0x3ab23ab2,0x3a933a93,0x3ab23a93,0x3a923ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a723ab3,0x32923a72,0x32723292,0x32723272,0x3a723272,0x3a723a72,0x3a723a72,0x32513a72,0x32723272,0x3a723a72,0x3a723272,0x3a723a72,0x3a723a92,
-0x3a723a92,0x32513a92,0x3a9242b3,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab33a92,0x3a923ab3,0x3ab33a92,0x3ab33a93,0x3ab33ab3,0x42d342b3,0x42d33ab3,0x42f442d3,0x42f442f4,0x4af442f4,0x4b144b14,0x4b354b35,0x53354b35,0x53355335,0x53555355,0x53555355,0x53555355,0x5b765355,0x5b765b76,0x5b765b76,0x5b765b76,0x5b965b96,0x5b965b96,0x5b965b96,0x4ad463b7,0x3a705354,
-0x4ad24ad2,0x4af24ad2,0x5b954af3,0x4af35b95,0x5b7542b2,0x53345b54,0x53535b95,0x63b54af3,0x10eb6375,0x6bd673f7,0x4b136bf6,0x000563b6,0x5b73320d,0x194c6373,0x3a5042b1,0x42915313,0x63955b33,0x63976375,0x74387437,0x743a7438,0x6c1563b5,0x42b36bf7,0x2a0f7c98,0x7c586bd6,0x7c596bd7,0x4ab27c59,0x849a8498,0x6bd66bf7,0x74178499,0x5b547c59,0x18410022,0x18202882,
-0x00274ad1,0x5354322f,0x4ad15b53,0x4313094a,0x3a9200eb,0x42d34b14,0x4b1442d3,0x7bb23a91,0x42b129f0,0x324f4291,0x53134291,0x4ad2114b,0x4af34292,0x31ee4291,0x320f320f,0x29cf4270,0x42903a2f,0x4ad24af1,0x4b144b14,0x4af3090c,0x5314196d,0x533342b3,0x3ab23251,0x3ab23ab2,0x42f44b14,0x42f33ab3,0x320f3a92,0x19494270,0x3a50196a,0x21ee21cd,0x320f322f,0x42b13a50,
-0x29cd112a,0x42d242d2,0x42703a4f,0x29ad320f,0x194c31ed,0x21cd322f,0x3a91324f,0x3ab23a91,0x3ab23ab2,0x3ab23ab2,0x3a933a93,0x3ad33a93,0x3a923ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a723a72,0x32923a72,0x32723292,0x32723272,0x3a723272,0x3a723a72,0x3a723a72,0x32513a72,0x3a923272,0x3a723a72,0x3a723272,0x3a723a72,0x3a723272,
-0x3a723a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a723a92,0x3a923a92,0x3a923a92,0x3ab33a93,0x42d33ab3,0x42d342b3,0x42d33ab3,0x42f442d3,0x42f442f4,0x4af442f4,0x4af44af4,0x4b354b35,0x4b144b35,0x53355335,0x53555355,0x53555355,0x53555b76,0x5b765355,0x5b765b76,0x5b765b76,0x5b765b76,0x5b965b96,0x5b965b76,0x5b965b96,0x5b565b96,0x5b7442b2,
-0x52d231ee,0x32306395,0x535442b2,0x42d263b6,0x4af25bb6,0x320f4ad2,0x112b00a9,0x63940068,0x4ab25b54,0x6bd6216d,0x5b745b54,0x63755313,0x53115b34,0x3a5029cd,0x5b346394,0x52f26395,0x74177437,0x63b87418,0x74386c37,0x6bf67438,0x6bd6110b,0x4af46c37,0x32506c35,0x63b67438,0x4ad27417,0x951c5b75,0x7c797416,0x63b67c59,0x7c586bf7,0x00240046,0x41450002,0x080093cf,
-0x4af329ee,0x53753a92,0x42b15b75,0x3a704290,0x4af3114c,0x537421ef,0x42f45394,0x7bf54b34,0x3a916373,0x320f4ad2,0x3a2f4290,0x427031ee,0x4290194c,0x196b3a2f,0x2a0f21ad,0x4af23a71,0x53334af2,0x320f42b1,0x32504b13,0x3ab142d3,0x196d006a,0x4af342b2,0x21ef112c,0x42d33a92,0x42d342d3,0x327142f4,0x42b242d3,0x214a4291,0x112a218b,0x3a7029ee,0x327129ee,0x322f42b1,
-0x320f196b,0x31ee4291,0x322f29ad,0x320e10ea,0x19ac29cd,0x326f198c,0x327142b2,0x3a923230,0x3ab33272,0x3ab23ab3,0x3a933a93,0x32933a93,0x3ab33ab3,0x3a923293,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x32923292,0x32923292,0x32923292,0x32923292,0x32723272,0x32923292,0x3a723a92,0x32923292,0x3a923a92,0x3a723a72,0x3a723272,0x3a723a72,0x3a723a72,0x3a723a72,
-0x3a723a72,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab33a93,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab33ab3,0x42d33a92,0x42b342d3,0x42d342b3,0x42d342f4,0x42d342d3,0x42f442d3,0x4af442f4,0x4b144af4,0x4b144b14,0x4b354b14,0x53354b35,0x53554b35,0x53555355,0x53555355,0x53765355,0x53765376,0x5b765b76,0x5b765b76,0x5b765b96,0x5b965b76,0x5b965b96,0x5b965b96,0x322e4af3,
-0x31cd29ab,0x6b944a90,0x29ce322f,0x21ad218d,0x3a4e08ca,0x4ab03a6f,0x31ef29ad,0x4ad26bd5,0x42904290,0x6bb529cd,0x42b25b73,0x5b754292,0x63756bd6,0x196b5b54,0x53104aaf,0x6bd76b96,0x6bf76c17,0x63d77438,0x6bf66c18,0x5b9463d6,0x216b6394,0x00670067,0x4290426f,0x73f57c55,0x74366bd5,0x3ab18cd9,0x3a4d5bb6,0x004410e8,0x10850023,0x9cb9398b,0x7bf494b8,0xeedab4d6,
-0x6bb50003,0x5b943270,0x00495333,0x42d152f2,0x32503271,0x3ab33ad3,0x4b353a92,0x6b945b96,0x21ce320e,0x218d42b0,0x42904270,0x426f214b,0x322e4a90,0x322e3a70,0x3ab229cd,0x3ab23ab3,0x4b143291,0x4af12a0f,0x42d23a71,0x3a904af4,0x21ce21af,0x32513a92,0x21cf3a91,0x32713271,0x4b1442f3,0x00ca3ad2,0x196d3a91,0x422d320f,0x21cd0087,0x21ce2a0f,0x32513251,0x322f4ad2,
-0x29ed192a,0x3a0e3a0e,0x0089320f,0x42903a50,0x322f4ab0,0x324f3250,0x3a9121ce,0x42d32a30,0x3a923ab3,0x3ab33ab3,0x3a933ab3,0x3ab33a93,0x3ab33a93,0x3a923ab3,0x3a923a92,0x3a923a92,0x3a923ab3,0x3a923a92,0x32923292,0x32923292,0x32923292,0x32923292,0x32923292,0x32923292,0x32723a92,0x32923292,0x3a723a92,0x32723a92,0x3a723a72,0x3a723a72,0x3a923a92,0x3a923a72,
-0x3a923a92,0x3a723a72,0x3a923a72,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab33ab3,0x3ab33a92,0x3ab33ab3,0x3ab342b3,0x42d342d3,0x42d342d3,0x4b1442d3,0x4af442f4,0x4b144af4,0x4b354b14,0x4b354b35,0x53354b35,0x53555335,0x53555355,0x53555355,0x53555355,0x53765376,0x5b765b76,0x53765b76,0x5b765376,0x5b965b76,0x5b965b76,0x5b765b96,0x29ed5b75,
-0x39ec39cb,0x52af318c,0x5b123a0d,0x4ad1424f,0x52f23a4f,0x3a2f3a50,0x42714ad1,0x3a714ad2,0x29cd4a92,0x7c166bb4,0x0045216b,0x4ad27416,0x6c186395,0x6bf663d6,0x08a652f1,0x63730867,0x535563d6,0x74585b75,0x53556c17,0x320e4af2,0x52d06373,0x52d07c35,0x000110a7,0x00020024,0x00650003,0x00030024,0x00030004,0x6b311085,0x74179cf9,0x741673f6,0xa4b78c98,0xff3ce63b,
-0x00a8320e,0x4af26c37,0x3a706c17,0x08c952f1,0x53343a90,0x4b3442d3,0x3ab24b34,0x3a9142f3,0x53340067,0x53330088,0x53324ad2,0x10a8296a,0x110a29cd,0x322f4290,0x4b1419ae,0x53554b34,0x4b344b14,0x5b944b34,0x3250196d,0x006742d2,0x00ca21ce,0x3a713250,0x114c4af3,0x323042b2,0x3ab242d2,0x32713ab2,0x3a713a71,0x000429cd,0x3a7121cc,0x322f3a91,0x3a712a0f,0x10c94270,
-0x298b1929,0x3a4f3a2e,0x3a4f190a,0x194b42b0,0x116d112b,0x19ce222f,0x3ab23270,0x3ab33ad3,0x3ab33ab3,0x3a933ab3,0x3ab23ab2,0x3ab33ab2,0x3ab33ab2,0x3ab33ab3,0x3a933292,0x3a933a93,0x3a933a93,0x32933293,0x3a923a92,0x32923292,0x3a723292,0x3a923a92,0x32923292,0x32923292,0x32923292,0x32923292,0x3a723a72,0x3a923a92,0x3a923272,0x3a723a72,0x3a923a92,0x3a723a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab33a92,0x3a923a92,0x3a923ab3,0x3ab33a92,0x3ab33ab3,0x3ab33ab3,0x42b342b3,0x42d342d3,0x42d342d3,0x42f442d3,0x4af442f4,0x4b354af4,0x4b354b14,0x4b354b35,0x53354b35,0x53355335,0x53555335,0x53555355,0x53555355,0x53765355,0x53765376,0x53765b96,0x5b765376,0x53765b76,0x5b965b96,0x53765b96,0x320d42b2,
-0x39ed39ed,0x31cd4a4e,0x3a0e424f,0x4a913a2f,0x4ab152f2,0x6bb54291,0x4ad34af3,0x6c175334,0x5b5442b2,0x5b545b33,0x31ed4ab0,0x0004190a,0x53116b73,0x73f50048,0x8436296c,0x52f073d5,0x31eb8497,0x00010000,0x00450003,0x00240025,0x00040024,0x6b93318b,0x8c76422d,0x00046331,0x7c166332,0x73935af1,0x7c156333,0x84587c17,0x8c798478,0x8c998cb9,0xa4d79498,0xff5de63a,
-0x42d142b1,0x4b134b13,0x9d3a5b95,0x42d2196b,0x5355220f,0x4b344b14,0x535542f3,0x5b7400ec,0x53540047,0x4ad1112b,0x53324291,0x218b4a8e,0x53122a0e,0x4af20088,0x42f35b95,0x4b344b34,0x42f34b34,0x4ad34b14,0x00aa0007,0x00270048,0x2a30092c,0x4af342d2,0x2a0f3a91,0x42d242b2,0x42f33a91,0x3a9142f3,0x3a712a30,0x535152f2,0x3a91220d,0x2a2f3a91,0x21ad29ee,0x10e93a4e,
-0x29ab1949,0x1129194a,0x218b298b,0x2a2f0087,0x32923290,0x3ad33ab3,0x32713ad3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab23ab3,0x3a933ab2,0x3a933a93,0x3a933a93,0x32933ab3,0x32923292,0x32923292,0x3a923292,0x32923a92,0x32923292,0x32923292,0x32923292,0x32923292,0x3a923a92,0x3a923a72,0x3a923a72,0x3a923a92,0x3a923a92,0x3a923a92,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab33a92,0x3a923a92,0x3a923a92,0x3a923ab3,0x3ab33a92,0x3ab33ab3,0x3ab33ab3,0x42b342b3,0x42d342d3,0x42d342d3,0x42f442d3,0x42f442f4,0x4af44af4,0x4b144b14,0x4b144b14,0x4b154b35,0x53555335,0x53555335,0x53555355,0x53555355,0x53765376,0x53765376,0x53765376,0x5b765b96,0x5b965b96,0x5b765b76,0x5b965b96,0x4af15b75,
-0x3a0e5b12,0x422f5b12,0x08a8424f,0x5b335b11,0x320f4a90,0x639552f2,0x5b765b75,0x42d25b95,0x5b545bb6,0x3a2f3a50,0x3a2f31ef,0x4a4f6bd5,0x0888422e,0x00060065,0x00060866,0x10e90887,0x298b216b,0x18e70864,0x73d5528e,0x52d16353,0x6b94192b,0x4af36395,0x0027320e,0x84587c16,0x7c387c59,0x845873f8,0x7c1673d5,0x6b958438,0x847873d6,0x8cb98c99,0xc599b57a,0xff5de65a,
-0x637411ae,0x42b029ce,0x6bb54b12,0x537400c9,0x42f33a71,0x53553ab2,0x5b755355,0x32505334,0x4aaf5313,0x3a700047,0x3a2e52f2,0x29ef4af3,0x42b14af3,0x5b5321ce,0x21ef6c15,0x3ab23ad2,0x42d33271,0x42f342d3,0x6bf63a70,0x00475b33,0x327142b2,0x42b33ab2,0x322f4b13,0x4ad208c9,0x42b242d3,0x3271198e,0x3a713a72,0x4af14290,0x32702a0f,0x3a913a91,0x424f4291,0x108731ac,
-0x298b1909,0x194a08c8,0x110a29ed,0x32713a2f,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33293,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab2,0x3a923ab3,0x3a923ab3,0x3ab33ab3,0x32933293,0x32923292,0x32923292,0x32923292,0x32923292,0x32933292,0x32933293,0x32923292,0x32923292,0x32923292,0x32923292,0x32923a92,0x32923292,0x3a923292,0x3a923a92,0x3ab23292,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a723a92,0x3ab33a92,0x3a923ab3,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923ab3,0x42b342b3,0x42b342b3,0x42b342b3,0x42d342b3,0x42d342f4,0x42f442d3,0x4af44af4,0x4b144af4,0x4b144b15,0x4b354b35,0x4b354b35,0x53355335,0x53555355,0x53555355,0x53555376,0x53555355,0x53765355,0x5b765b76,0x5b965b76,0x5b765b76,0x53145b76,0x2a0f5334,
-0x42905332,0x218c42b0,0x52f03a4f,0x5af1318c,0x29ad3a0f,0x4a90422f,0x63964a91,0x63b663d6,0x2a105376,0x3a4f3a50,0x4ad24ad2,0x5b324250,0x6bd652f2,0x63750007,0x63955b54,0x73f64ad1,0x00473a4f,0x52f25b32,0x6bd84291,0x63d74ad2,0x6bb508eb,0x00058cb9,0x4ad24ad1,0x7c587437,0x7c787c99,0x84b85333,0x3a4f7416,0x5b757416,0x8c788478,0xa5189cf9,0xde9ccdb9,0xe6bcde7a,
-0x747a0024,0x63d463d5,0x08e96394,0x4af300c9,0x42f342b2,0x53555355,0x4b135355,0x3a714af3,0x29ab3a50,0x112b0006,0x00675b54,0x53544b13,0x53334b13,0x4ad24b33,0x42b029ee,0x4af34ad3,0x42d33271,0x4b342a30,0x320f6395,0x090a194b,0x2a514333,0x42b33ad2,0x3a903a70,0x196c3a70,0x4af23a90,0x42d33a92,0x3a913a72,0x320e52f1,0x3a913a90,0x42d23270,0x31ee4ab1,0x39ec192a,
-0x1929216a,0x194a218b,0x2a0f114a,0x32912a0f,0x3ab23ab3,0x3ab33ad3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab23ab3,0x3ab33a92,0x3a923a92,0x32933292,0x32923292,0x32923292,0x32923292,0x3a923292,0x32933292,0x32933293,0x32923292,0x32923292,0x32923292,0x32923292,0x32923292,0x32923292,0x3a923292,0x3a923a92,0x32923292,
-0x3a923a92,0x3a923a92,0x3a9242b3,0x3a923a92,0x3a923ab3,0x3a923a92,0x3a923ab3,0x3a923a92,0x3ab33a92,0x3ab33ab3,0x42b33ab3,0x42b342b3,0x3ab342d3,0x42d342d3,0x42d342d3,0x42f442f4,0x42f442f4,0x4b144b14,0x4b144b14,0x4b354b35,0x4b354b35,0x53554b35,0x53555355,0x53555355,0x53355355,0x53765355,0x53765355,0x5b965b76,0x53765376,0x5b764b35,0x53555b75,0x4af24af3,
-0x320f29ce,0x63955b74,0x3a6f5334,0x004631cc,0x424f422e,0x3a2f31ce,0x4af331ed,0x42d34b14,0x218d3a92,0x4ab1216c,0x63946394,0x298c18e8,0x63950007,0x6bd77417,0x5b756bf7,0x008852f4,0x5b747c58,0x53147417,0x3a51218d,0x53337417,0x298b31ed,0x73f76bd5,0x741729ce,0x7c587437,0x63b67459,0x6bd43a71,0x84793a30,0x73f77418,0x94997c17,0xbd99a519,0xeefcde5b,0xd65ade7b,
-0x42f073f6,0x639563b7,0x0086320e,0x3a912a0f,0x53553271,0x5b965bb6,0x4b342a30,0x3ab13271,0x19475334,0x10ca10c9,0x192a52f2,0x42914270,0x42d24b14,0x53343271,0x196a4af3,0x32525351,0x3ad22a31,0x42d34af4,0x52d15b34,0x3a7084b9,0x3ad35333,0x3a924312,0x42b24b14,0x29cd4b12,0x00ca3a6f,0x42d23250,0x322f42d3,0x08c8426e,0x21ad3a8f,0x3a913a91,0x31ad3a70,0x214910c8,
-0x322e0086,0x42d10088,0x2a0f3250,0x32713a91,0x42f342d3,0x3ab33ad3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33a93,0x3ab33a93,0x3ab33ab3,0x3a933a93,0x3ab23292,0x32923292,0x3a933292,0x32923293,0x32923292,0x32923292,0x32923ab2,0x32923292,0x32923292,0x3a923a92,0x3a923a92,0x3a923a92,0x32923a92,0x3ab23ab2,0x3ab23ab2,
-0x3a923a92,0x3a923a72,0x3a923a92,0x3a923a92,0x3ab33a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab342b3,0x42b33ab3,0x42b342b3,0x42d342d3,0x42f442f4,0x4b1442f4,0x4b144af4,0x4b144b14,0x4b354b14,0x4b154b35,0x4b354b35,0x4b355335,0x53555355,0x53555355,0x53555355,0x53765376,0x5b765376,0x5b765376,0x53564b15,0x5b564ad4,0x5b544ad2,
-0x4ab152f3,0x535529ed,0x3a3042d3,0x2a0d4ad1,0x52d0428f,0x4a9152f1,0x53333a0f,0x63b64ad2,0x00886c16,0x296b0025,0x00040002,0x08661066,0x0068190a,0x849831ee,0x29ce4292,0x6c1863d6,0x6c166c16,0x42d15bb5,0x4b134ad2,0x10c92a0e,0x4ad20004,0x63b56bd5,0x7c596bb8,0x73f87c38,0x73f87c7a,0xad9c31ce,0x5b535af3,0x5b565313,0x9d1973d6,0xbdfaad5a,0xe6fdd67c,0xbdfad65c,
-0x00035b54,0x63956396,0x090973d6,0x5bb64b34,0x5bb642f3,0x4b144b34,0x53553251,0x4b3442d3,0x00245b55,0x190b0888,0x00265b33,0x3a714270,0x327142f3,0x4af33ad2,0x5b5542d2,0x429221cb,0x3ab23230,0x53344af3,0x3a2d320e,0x3a9100a9,0x112d4af2,0x325042b1,0x323029ef,0x4ad142b1,0x42f2324e,0x42d23ab2,0x2a0f3ab2,0x00663a2d,0x3250196b,0x29ee29ee,0x29ab31ed,0x19080004,
-0x322e29cc,0x2a0e3ab1,0x42d221ef,0x3a923a91,0x3ab22a30,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33a92,0x3ab33a93,0x3ab33a93,0x3ab33ab3,0x3a933a93,0x3ab23292,0x32923292,0x3a933292,0x32923293,0x32923292,0x32923292,0x32923ab2,0x32923292,0x32923292,0x3a923a92,0x3a923a92,0x3a923a92,0x32923a92,0x3ab23ab2,0x3ab23ab2,
-0x3a923a92,0x3a923ab3,0x3a923a92,0x3ab33a92,0x3ab33a92,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab342b3,0x42b33ab3,0x42b342b3,0x42d342d3,0x42f442d3,0x42f442f4,0x4b144af4,0x4b144b14,0x4b354b14,0x4b154b35,0x4b354b35,0x4b355335,0x53555355,0x53555355,0x53765376,0x53765355,0x42d35376,0x5b765b96,0x53555355,0x32105314,0x323042b2,
-0x3a4f320f,0x320f320e,0x52f25b74,0x3a4e320e,0x3a2c29ab,0x294b31cc,0x52f1422e,0x63b56bb5,0x218c3a90,0x5b3131ec,0x000439ec,0x6b9331ab,0x5b344ab1,0x74175b54,0x6bd76bd7,0x63b66bf7,0x21af4af4,0x3a902a10,0x53134af2,0x3a2e29ed,0x74376bd5,0xa59d7c58,0x00880089,0x533208e9,0x8cf97436,0x63715b10,0x73f773f4,0x8cd87c36,0x7bd68437,0xad58a539,0xce5bb599,0xad79c63b,
-0x2a8f5375,0x53535353,0x63d60007,0x42d242f3,0x4b145354,0x3ab24b14,0x4b1442f3,0x42d45355,0x19495b56,0x4a90426e,0x5333422e,0x29ef5313,0x4b133a91,0x4b145354,0x42b03a91,0x4ad042b1,0x4af44270,0x4ad34b14,0x31cb6bd5,0x325142b2,0x531442b2,0x3a904291,0x32302a2f,0x29ed322f,0x4af229ab,0x3a913ab2,0x198d2a30,0x194a298a,0x3a912a0d,0x218c3270,0x29a9424e,0x10e80004,
-0x218d29ee,0x29ef2a0f,0x2a302a30,0x3ab221ef,0x32923ab2,0x3ab33ad3,0x3ab33ab3,0x3ab33ab3,0x3ab33ad3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3a933ab3,0x3a933ab3,0x3ab33a93,0x3ab33ab3,0x32933293,0x32923ab2,0x3ab23ab2,0x32933292,0x3ab23293,0x32923292,0x32923292,0x32923292,0x32923ab3,0x32923292,0x3a923a92,0x3a923a92,0x3a923ab3,0x3ab23a92,0x32923292,0x3ab33292,
-0x3a923a92,0x3a923a92,0x3a923a92,0x3a923ab3,0x3a923a92,0x3a923a92,0x3ab33a92,0x3a933a92,0x3ab33a92,0x3ab33ab3,0x42b33ab3,0x42b342b3,0x42b342b3,0x42d342d3,0x42f442d3,0x42d342d3,0x42f442f4,0x4af44af4,0x4b144b14,0x4b144b15,0x4b354b35,0x53355335,0x53554b35,0x53555335,0x53555355,0x53555355,0x53555355,0x3ab35335,0x4af342f4,0x29ef3250,0x53344291,0x5b765b76,
-0x53125333,0x31cc6373,0x429052d0,0x3a0c29cc,0x08642108,0x39cb2107,0x424d39cb,0x00c9216b,0x08a8196c,0x10a73a2e,0x3a0d4a90,0x52d252d0,0x3a305333,0x531452f4,0x6bd64ad3,0x53545b95,0x4b125353,0x63b55353,0x0006322f,0x94f8a57b,0x6c166b97,0x6bf75b75,0x32104293,0x74177416,0x53126c17,0x63533a0e,0x18e81089,0x84586b54,0xb5789cd7,0xa539a518,0xad98a518,0x298ace9b,
-0x5b538499,0x6bf60004,0x53125354,0x3a4f0005,0x3a715354,0x32515354,0x4b353ab2,0x4b5542d3,0x6b525313,0x10876330,0x2a0e0004,0x42d2220e,0x2a1121ce,0x4af34b15,0x4ad2198d,0x42b14291,0x6396324e,0x4ad24292,0x00866bb5,0x42f33a91,0x3a7142f3,0x42f20027,0x42b121ce,0x322f4af2,0x322e0047,0x42b13a90,0x320e3a4f,0x31ed10e8,0x324f21ac,0x214b3a50,0x00250887,0x3a6f216b,
-0x114c29cd,0x2a2f42d2,0x114c21ef,0x21ef3271,0x3ad33a92,0x3ab23ab3,0x3ab33ab3,0x3ab33ab3,0x3ad33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3a723ab2,0x3a923a93,0x3ab33a92,0x32513292,0x32933a93,0x3ab33a92,0x3ab23ab2,0x3ab23292,0x3ab33ab2,0x32923ab2,0x32923292,0x3a923a92,0x3ab23292,0x32923ab2,0x3a923a92,0x3a923a92,0x3ab23a92,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,
-0x3ab33ab3,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923ab3,0x3a923a92,0x3a923a92,0x3a933a92,0x3ab33ab3,0x3ab33ab3,0x42b33ab3,0x42b33ab3,0x42b342b3,0x42b342d3,0x42d342d3,0x42d342d3,0x42d342f4,0x4af44af4,0x4af44af4,0x4b354b14,0x4b354b14,0x53354b15,0x53355335,0x53555335,0x53555355,0x53555355,0x53555355,0x42f45355,0x429121ce,0x196c29ce,0x52f252f2,0x5b355313,
-0x3a913a70,0x5b33218d,0x218b3a6f,0x29492169,0x39aa2949,0x21282108,0x39ab1085,0x73f64a4f,0x00054a90,0x422e5b33,0x214b6b73,0x63955b54,0x53146395,0x53344ad2,0x4ad25334,0x53335334,0x29ee42b2,0x31ed4b12,0x7c370047,0x3a900888,0x196d4291,0x8cfb110c,0x3a716bf7,0x7c587438,0x63d77439,0x320e3a90,0x3a2f52f2,0x84575b11,0xce7d6b93,0x00038c54,0x10020803,0x8bf32085,
-0x74385334,0x00a739cb,0x5b534ad2,0x00064ad1,0x63d55bd4,0x21cf42f1,0x53755355,0x3ad34b14,0x10665b34,0x29070001,0x21ce0024,0x4b354b34,0x4b3542f3,0x32314b34,0x5b7521cd,0x4ad13230,0x08e93a71,0x42904290,0x4af34291,0x42f342f3,0x42d23291,0x3a906374,0x42b1112d,0x4af342d2,0x29ed0006,0x429121cd,0x29ec2a0d,0x5b530004,0x4270324f,0x086639ec,0x110810e7,0x21ac218b,
-0x427121cd,0x32503a91,0x2a0f3271,0x3ab23271,0x327242d3,0x42f42a51,0x3ab33ab3,0x3ab33ab3,0x3ab33ad3,0x32723ad3,0x3a933ab3,0x3ab33ab3,0x32723a92,0x3ab33ab3,0x2a513a92,0x32923251,0x32933293,0x3a923a92,0x3a923292,0x3ab23ab3,0x32923ab2,0x32923a92,0x3ab23ab2,0x3a923a92,0x3ab23a92,0x32923ab2,0x3a923a92,0x3a923a92,0x32923a92,0x3ab23ab2,0x3ab23ab2,0x3ab23ab2,
-0x3a923a93,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab33a92,0x3a923ab3,0x3a923ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x42b342b3,0x42d342b3,0x42d342d3,0x42d342d3,0x42d342f4,0x42d442f4,0x4af44af4,0x4b144af4,0x4b144b14,0x4b144b14,0x4b354b35,0x53355335,0x53355335,0x53555355,0x53555355,0x53555376,0x43144b35,0x42b142b2,0x00a9322f,0x5b3331ee,0x4b124af3,
-0x42b15b54,0x53543a71,0x42915b74,0x426e3a0d,0x08453a0c,0x52ae1065,0x1909424d,0x3a0d6b71,0x214a6b93,0x5af24ab0,0x39ed52d2,0x63d74ab1,0x4ad363b6,0x53344292,0x53335313,0x4af23210,0x3a4f4af3,0x6332194b,0x73d66b73,0x4af26354,0x7c5963b6,0x5b7442b1,0x74187418,0x7c587417,0x74387459,0x639563d6,0x42d16334,0x086518c5,0x18870004,0x83514a0c,0xb557bd36,0xb559b557,
-0x5b965355,0x08c831ef,0x537421ad,0x5b953a70,0x53110028,0x5335090a,0x4b345376,0x53755355,0x21884af3,0x00010000,0x32910003,0x53545355,0x42f34af3,0x4b344b34,0x42b26bd6,0x42b121ce,0x5b744ad2,0x4ad1320d,0x3a510088,0x325142f2,0x42b242d4,0x31ee4ad3,0x3a712a0e,0x42913a50,0x218c192a,0x216c29ad,0x216b322e,0x29cc10e8,0x3a0e3a6f,0x19080046,0x192910e7,0x2a0e08e9,
-0x322f3a70,0x21ad19ee,0x3a913a91,0x3230220f,0x32723a92,0x3ad32a51,0x3ab33ad3,0x3ab43ab3,0x3a923a93,0x32513271,0x3ab33272,0x3ab33ab3,0x32513ab3,0x3ab23ab3,0x2a313ab2,0x3a922a10,0x3a923a92,0x3a933a93,0x3ab23ab2,0x3ab23ab2,0x3ab23292,0x32923ab2,0x3ab23ab2,0x3ab23ab2,0x3ab33ab2,0x3ab23292,0x3ab23ab2,0x3a923ab2,0x3ab23ab3,0x3a923ab2,0x3a923a92,0x3a923a92,
-0x3ab23ab3,0x3a923a92,0x3ab33a92,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x42b33ab3,0x42b33a92,0x42b33ab3,0x42d342b3,0x42b342d3,0x42d442d4,0x42d442f4,0x42f442f4,0x42f442f4,0x4af44b14,0x4b354af4,0x4b144b14,0x53555355,0x53554b35,0x53354b35,0x53554b35,0x53555355,0x53555355,0x42d45355,0x535542b3,0x42d34b14,0x53543a50,0x3a7029ce,
-0x42b121ce,0x531329ef,0x42b25334,0x4ad242d1,0x6393426f,0x31ca31cb,0x426f422c,0x190839ec,0x320c212a,0x52d24af2,0x3a7029ae,0x5b956394,0x63d763d7,0x4b145b96,0x5b333230,0x42904291,0x08a95b13,0x424f52d1,0x10ea10c9,0x63545b32,0x425031ee,0x63957417,0x63b75334,0x63b663f6,0x63d66c39,0x0004218c,0x10a80005,0x3a2d2129,0x7c156b72,0x8c146b92,0xc5b88370,0xad38c5b9,
-0x5b755334,0x004573d7,0x21ee00a9,0x5b747437,0x4a8f5b74,0x42f442b1,0x53554b35,0x4b335b96,0x3a6e3a51,0x00220000,0x42f3218b,0x3a924b34,0x42f34b14,0x4b3542f3,0x090b5334,0x42b121ae,0x3a914291,0x31ec6b94,0x4b121109,0x42d3092c,0x4b144af4,0x00064af4,0x320e42b1,0x320e4af2,0x31ed0088,0x29cd320e,0x3a0d322e,0x31ec5b10,0x426e2a0e,0x00252129,0x10e81928,0x3a7021ac,
-0x42d242b1,0x3a9219ae,0x21ef42b2,0x3ab22a50,0x21cf42d3,0x32723ad3,0x3ab33ad3,0x2a313a92,0x32712a10,0x32713251,0x32933a93,0x3ab33ab3,0x32513252,0x3a923ab3,0x2a313292,0x3a923251,0x3ab33ab3,0x3a723a73,0x3ab33292,0x3ab23ab2,0x3ab23ab3,0x3ab23292,0x32923ab3,0x32923ab2,0x32923292,0x3ab23ab2,0x3ab23ab2,0x3ab33ab3,0x3ab23a92,0x3ab33ab2,0x3a923a92,0x3ab33a92,
-0x3ab33a92,0x3ab33a92,0x3a923ab3,0x3ab33ab3,0x3ab33ab3,0x42b33ab3,0x3ab342b3,0x3a923ab3,0x3ab33ab3,0x3ab342b3,0x3ab33ab3,0x42d342b3,0x42d342b3,0x42d442d3,0x42d442d4,0x42f442d3,0x42f442f4,0x42f442f4,0x4af44af4,0x4b144b14,0x4b144b35,0x53554b35,0x4b354b35,0x53355335,0x53555355,0x53355376,0x53555355,0x4af44b14,0x4ad25334,0x52f34af3,0x53145334,0x2a1042d3,
-0x3a714ad2,0x429229ce,0x4af34af3,0x3a504af3,0x53333a2f,0x31ab3a2e,0x31aa10a6,0x214918e8,0x4a9052b0,0x63764290,0x192b4272,0x63b629ad,0x53145b95,0x53355335,0x42704b14,0x29ec4af2,0x424f52f1,0x31cd52f1,0x08886b95,0x428e426f,0x6bb35b51,0x4ad25313,0x112b29ee,0x00270007,0x4a8e0045,0x7c378c97,0x3a317c37,0x52d27418,0x635573d7,0x6b526bd5,0xde5a8391,0xc5d9cdf9,
-0x4af15b94,0x002463d6,0x42b263b6,0x00494b13,0x4b136bd7,0x4b35196b,0x4af44b54,0x53555335,0x4ab23210,0x00890066,0x4b1342d2,0x2a0f42f3,0x3a714b34,0x53343a92,0x00694af3,0x3a713271,0x52d14291,0x0885214a,0x216a0864,0x42f24af2,0x53344af4,0x29cd4b14,0x29cd5b52,0x3a2e218b,0x42900047,0x4ad329ef,0x008842b0,0x424d298a,0x10e731ec,0x08c70004,0x320c1928,0x21ed21cc,
-0x090c3a92,0x3ab242d3,0x3ab2198e,0x3ab2114d,0x32313271,0x32523a72,0x329142b3,0x2a5019ae,0x3a7121ce,0x3a923a91,0x42b33ab3,0x3a923251,0x32512a31,0x32513a92,0x29f03251,0x3ab33a92,0x42b33a92,0x3a923272,0x3a923a92,0x3ab33a92,0x3ab33ab3,0x3ab33293,0x3ab23ab2,0x3ab23ab2,0x3ab33ab2,0x3ab23ab2,0x3a923a92,0x3a923a92,0x3ab23a92,0x3ab23ab2,0x3ab23ab2,0x3ab33a92,
-0x3ab23ab2,0x3ab33ab3,0x3a923ab3,0x3a923ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x42d33ab3,0x3ab33ab3,0x42b33ab3,0x42b342b3,0x42b342b3,0x42b342b3,0x42d442d4,0x42d442d4,0x42d342f4,0x42f442f4,0x42f442f4,0x4b144af4,0x4b144af4,0x4b354b14,0x4b354b35,0x4b354b35,0x4b354b35,0x5b565315,0x53555335,0x53555355,0x53354b14,0x4a905b33,0x4ab14a90,0x5b346355,0x3ad34b55,
-0x21cd112b,0x531363b5,0x4ad35b54,0x4ab45b55,0x4ad24af3,0x4af2320f,0x000321ac,0x4a8e0002,0x3a2f3a2f,0x4af45b54,0x53143230,0x53330026,0x53345b95,0x42b24b13,0x42b042d1,0x4a8f21cd,0x4a8e424d,0x424e298a,0x427052f1,0x10ea5312,0x4ad04a90,0x63954af1,0x74587437,0x00057438,0x7c787c98,0x74387418,0x74187c79,0x6bf763b6,0x63b66396,0x84387c18,0xd63b6331,0xc577d63a,
-0x6bf65b75,0x10c7196d,0x4b147459,0x53345bb5,0x637429cf,0x6bf70005,0x42d35355,0x3ab25b76,0x6bd65313,0x42f30067,0x42f25354,0x4b3342f3,0x42d33271,0x42b242b2,0x08eb42d2,0x2a0f4af3,0x52f252f2,0x298910e8,0x08a71908,0x3230198c,0x4b144292,0x429042d3,0x426f426f,0x3a6f320e,0x429031ed,0x4291324f,0x00054a90,0x39ec31ab,0x19080045,0x29ab4a6d,0x19291929,0x42f2196b,
-0x32503230,0x2a102a30,0x3a923ab2,0x3ab23271,0x2a103250,0x4af43230,0x196d3a72,0x3a913270,0x3230196d,0x3ab32a30,0x3a923ab3,0x2a313a92,0x21ef3ab3,0x32303ab2,0x3a9221ef,0x3ab342b3,0x3a723a92,0x3ab33251,0x3ab33ab3,0x3ab33a92,0x3ab33ab3,0x3ab33293,0x3ab23ab2,0x3ab23ab2,0x3ab33ab2,0x3ab23ab2,0x3a923a92,0x3a923ab3,0x3ab23a92,0x3ab23ab2,0x3ab23ab2,0x3ab33a92,
-0x3ab23ab2,0x3ab33292,0x42b33ab3,0x3a923ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3a923ab3,0x3ab33ab3,0x42b33ab3,0x42b342b3,0x42b342b3,0x42b342b3,0x42d442d4,0x42d442d4,0x42d342f4,0x42f442f4,0x42f442f4,0x4b1442d3,0x4b144af4,0x4b144b14,0x4b354b35,0x4b354b35,0x4b354b35,0x53353a92,0x53555335,0x53555355,0x4af35335,0x4a9029ee,0x4ab152f2,0x4ab25314,0x53345334,
-0x194c21cd,0x5b754af2,0x6395112b,0x3a715b54,0x3a7142b2,0x5b545b54,0x216942b1,0x39eb0004,0x4ad25b12,0x32303a71,0x53355b76,0x6c3663b6,0x53345334,0x42d24af3,0x3a8f42b1,0x31cc196b,0x6331422d,0x52f10886,0x08c90006,0x3a0f4290,0x006631cd,0x5b145b32,0x31ed0027,0x8c970005,0x741763b5,0x6bd76396,0x7c597c58,0x74387c59,0x6bf77c59,0x84587c38,0x6b307bf5,0xbcf6bd57,
-0x743800cb,0x10c77437,0x42f37c9a,0x5b955bb5,0x18e96bd7,0x63748477,0x3a715b76,0x4b134b13,0x110a4ad1,0x4b143af2,0x4b344b13,0x431342d2,0x32304b13,0x3a904af2,0x216c0068,0x00895312,0x52f25333,0x296a0003,0x5b103a4d,0x3a910068,0x4ad34af3,0x4af142b3,0x320e29ac,0x3a4f29ed,0x4ad03a6f,0x4290324f,0x3a0c294c,0x002420e7,0x19081065,0x214b1928,0x218b29ac,0x42d1322e,
-0x2a2e21ad,0x3ab23251,0x42d33251,0x327121ef,0x322f116d,0x32713a70,0x3a7021ef,0x320e3a70,0x2a1021ce,0x42d342d2,0x3ab342b3,0x32513ab3,0x42d33a92,0x21ef3a92,0x3ab32a30,0x3a923ab3,0x32513251,0x3a923251,0x3ab33ab3,0x3ab33a92,0x3ab33ab3,0x3ab23a93,0x3ab23ab2,0x3ab23a92,0x32923292,0x3ab23ab2,0x3ab33ab3,0x3a923a92,0x3ab23a92,0x3ab23ab2,0x3ab23ab2,0x42d33ab3,
-0x3ab23ab2,0x3ab33a92,0x3ab33ab3,0x3ab33ab3,0x3ab342b3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33a93,0x42d33ab3,0x42b342d3,0x42b342b3,0x42d442b3,0x42b342d4,0x42d442d4,0x42d342d3,0x42d342f4,0x4af44af4,0x4af442f4,0x4b144b14,0x2a314b14,0x4af44b14,0x42d342d3,0x42b34b14,0x42d24af3,0x4b143a93,0x53554b35,0x5b765355,0x31ee4290,0x425052b1,0x3a514ad3,0x4af23a50,
-0x42b14af2,0x53134291,0x5b5342d2,0x324f5b74,0x4ad24af3,0x53134ad2,0x5b955334,0x00045352,0x5b54422f,0x4b145b75,0x53765355,0x21cd4b15,0x42d24b13,0x325042d3,0x29ed218c,0x29cc3a70,0x1908426e,0x63335b31,0x4ad15b54,0x52d25332,0x6b9352f1,0x000210c9,0x00049475,0x4a945af2,0x5b763230,0x6bf75b77,0x7c597417,0x74387c58,0x6bd67c59,0x74166bf7,0x7bb48458,0xc536b4f5,
-0x08ca6bd6,0x7c1408a8,0x53b65354,0x5b965355,0x531300cb,0x639652d0,0x323042f0,0x3a703a91,0x00a663b4,0x3ab14b13,0x4b1419af,0x42b24af3,0x21ae4af3,0x3a702a0f,0x21ac3a50,0x5b330047,0x422d426f,0x3a2d0023,0x427052d1,0x3a5052cf,0x42b242b1,0x42703a91,0x192b4ab0,0x320c426f,0x08e84ad0,0x31cc21ac,0x00250045,0x2107420b,0x00250864,0x3a7010e8,0x429029ed,0x112a320e,
-0x324f21cd,0x3ab23ab2,0x3ab23251,0x2a4f092c,0x32502a0f,0x3a91196c,0x3a703ab1,0x29ee08ea,0x3a7121ae,0x42d33271,0x3a923ab2,0x32513a92,0x3a923a92,0x327119ae,0x3a923ab2,0x32713271,0x32512a30,0x3a923272,0x3a923a92,0x3ab23a92,0x3ab33ab2,0x3ab23ab3,0x3ab23ab2,0x3ab33ab3,0x3ab33ab3,0x3ab23ab2,0x3a923a92,0x3a923a92,0x3a923a93,0x3a923a92,0x3a923a92,0x3ab33a92,
-0x3ab33ab3,0x3a923a92,0x3ab33a92,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x42b33ab3,0x3ab33ab3,0x42b33ab3,0x3ab33ab3,0x42d342d3,0x42b342d3,0x42d342d3,0x42b442d4,0x42f442d4,0x42f442f4,0x42d44af4,0x4af44af4,0x198d42f4,0x535442f3,0x42d342d3,0x42d33a92,0x42b04290,0x53343a91,0x53555335,0x53554b35,0x39ed324f,0x52f239ee,0x31ef5313,0x4ad24291,
-0x52f24ad2,0x29ef5b73,0x323021ce,0x5b344af3,0x112b4ab1,0x324f29cd,0x531252d2,0x3a4d5333,0x533418e7,0x63965bb5,0x53765b75,0x42f35355,0x4af36c17,0x42b24af3,0x63943a50,0x5b53320e,0x425052f2,0x42b13a0f,0x63955b54,0x42d15b53,0x322f6394,0x00466392,0x4a6e18c6,0x73f74a91,0x6bd66bd6,0x6bf76bd7,0x63d67c59,0x74386bf7,0x6bf763d6,0x6bd663b6,0x73d563b5,0xcd998352,
-0x7c9a63d7,0x63b363b6,0x4b3508e7,0x3a925375,0x3a4f7459,0x39ef9d5a,0x3a4f5b51,0x52b24290,0x2a301968,0x42f25374,0x32704b33,0x4b134b13,0x3ab04af3,0x4ad2326f,0x4ad35313,0x00465b53,0x18a539eb,0x3a0e0004,0x31ee52d1,0x00254a72,0x42903250,0x424f29cd,0x3a4f4ad0,0x00254290,0x42af1109,0x10665af0,0x29ab0024,0x006631eb,0x194a10e7,0x29ed2a0e,0x3a4f3a4f,0x29cd0088,
-0x2a0e2a0e,0x32713271,0x42b1322f,0x3a6f196c,0x114c322e,0x3a4f21ad,0x08ea218c,0x218d29ee,0x3a913a70,0x3a923271,0x3a923251,0x2a303251,0x21cf3ab2,0x32502a10,0x3a923271,0x2a30198e,0x3ab23271,0x3ab22a51,0x3a923a92,0x3ab23a92,0x3a933ab2,0x3ab23ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab23ab2,0x3a923a92,0x3a923a92,0x3a923a92,0x3a923a92,0x42b342b3,0x3ab33a93,
-0x3ab33ab3,0x42b33ab3,0x3a923a92,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x42b33ab3,0x3ab33ab3,0x3ab342b3,0x42b342b3,0x42b342b3,0x42d342b3,0x42d342b3,0x42d342d3,0x42d342d3,0x42d442d4,0x42f442d3,0x3a9242f4,0x323042f4,0x42f442f3,0x3a2f4b14,0x42b1218d,0x4b133ab2,0x4b1442b2,0x3a7008ea,0x535529ef,0x42d34af4,0x533442f4,0x5ab0216b,0x190b426f,0x3a505313,0x4ab25313,
-0x429052f3,0x42715332,0x42925313,0x32525315,0x63964af4,0x42925b55,0x5333320f,0x29ac3a4e,0x5b100825,0x5b966376,0x5b9663b6,0x537663d7,0x745863b7,0x4b1463b6,0x5b755334,0x42b14af2,0x42913a70,0x63b53a91,0x53555b54,0x08e963d7,0x53530047,0x088652f2,0x84347391,0x637452b0,0x6bd76396,0x74186bf7,0x6bf77417,0x63b663b6,0x63b65b75,0x63b65b75,0x53136bf7,0x8c154a6f,
-0x63d763b6,0x298b8cda,0x63fa0002,0x5b755334,0x53134b14,0x10c87415,0x00276353,0x31ec6374,0x21cd0088,0x42d242d2,0x42d242f2,0x3a704ad2,0x320f42d1,0x4ad2218c,0x42915313,0x5ad04af2,0x004418e8,0x3a2e2149,0x3a7029ed,0x428f4ab0,0x426f1149,0x216c4ab0,0x428f0005,0x29cc4ad0,0x428f216b,0x10c80086,0x218b4ab0,0x3a6e0066,0x196a1129,0x3a3031ef,0x112a196b,0x320f29cd,
-0x3a913a91,0x21ce3230,0x322f21ee,0x196a192a,0x21cd10e9,0x29cc3a70,0x192a1129,0x3a3029ad,0x29ce29ef,0x3a9229ef,0x32303a92,0x198d3251,0x114c3271,0x32713271,0x3a922a30,0x32513271,0x32512a31,0x3ab33ab3,0x3a933a93,0x3ab23a93,0x3ab33ab2,0x3ab23ab3,0x3ab23ab2,0x3ab33ab2,0x32923ab2,0x3ab23ab2,0x3ab23ab2,0x3a923ab2,0x3a923a92,0x3a923a92,0x3ab33ab3,0x3a923ab3,
-0x3ab33a92,0x3a923a92,0x3ab33a92,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab342b3,0x42d33ab3,0x42b33ab3,0x42d342d3,0x42d342b3,0x42d442d3,0x42f442d4,0x42f442d3,0x42d342d4,0x4ab34272,0x320f4291,0x4af34290,0x42903a71,0x42904ab1,0x32725334,0x3a914b13,0x4af34b13,0x53134a92,0x42d442b4,0x32305334,0x422e3a4f,0x5af131cc,0x4ab14ab1,0x4ad34ad3,
-0x216c5b54,0x52b04a70,0x5b545b34,0x5b965b55,0x53765355,0x32725b96,0x3a915375,0x63753210,0x0065216d,0x5b977bd5,0x63d76396,0x5b9763b7,0x74596c39,0x5b955b95,0x53344b14,0x535442d3,0x5b535b74,0x5b545b94,0x42926bf6,0x218d6bf6,0x3a505b54,0x6b9252f0,0x212831ab,0x52b14a6e,0x6bb66395,0x74186395,0x641863b6,0x63b642f4,0x5b967438,0x6bd75b55,0x5b346bd6,0x422d7c36,
-0x63b663d7,0x426f6bd6,0x4b140023,0x5b755b75,0x5b543a72,0x00045b52,0x426e426f,0x00666b92,0x2a2e5311,0x4b133270,0x3ab23271,0x42b14af2,0x535329ee,0x218d42b1,0x3a905313,0x52af42b1,0x21280025,0x29ab10c7,0x3a4f2a0e,0x00274270,0x4a8f5b73,0x4ad04a8f,0x426f214b,0x18e90004,0x0025424d,0x424e1929,0x08a8192a,0x218c4290,0x322e4270,0x3a4f3a6f,0x2a0d0066,0x3a50322e,
-0x3a703a71,0x32502a0f,0x298c322f,0x190931cc,0x29cd31cc,0x10c8192a,0x218b298b,0x29ce194b,0x429129ce,0x32513230,0x3a923ab2,0x090b3ab2,0x2a0f092c,0x32513ab2,0x32713a92,0x21ef3251,0x3ab33ab3,0x3ab33ab3,0x3a933a93,0x3ab23a93,0x3ab33ab2,0x3ab23a93,0x3ab23ab2,0x3a923ab2,0x3ab23ab2,0x3ab23a92,0x3ab23ab2,0x3ab33ab3,0x3a923a92,0x3ab33a92,0x3a923a92,0x3ab33ab3,
-0x3ab33a92,0x3a923ab3,0x3ab33a92,0x3ab33ab3,0x3ab33ab3,0x42b33ab3,0x42b342b3,0x3ab33ab3,0x3ab33ab3,0x42b342b3,0x42d342b3,0x42d342b3,0x42d33ab3,0x42d442d3,0x42d442d4,0x42d342f4,0x3a9242d4,0x3a513a51,0x422f3a50,0x3a9031cb,0x3a4f322f,0x29cd3a4f,0x3a915b13,0x42d342b2,0x42b23a91,0x198c42b3,0x5b33320f,0x53334ab2,0x296b31ed,0x422e424f,0x296a2129,0x5b32426f,
-0x3a0e5b33,0x41aa4a8f,0x5b545ab0,0x5b765b76,0x5b965335,0x5b965b96,0x3ab45356,0x2a302a11,0x42b119ae,0x106610e7,0x63b65313,0x5bb65b96,0x29ef5b76,0x5b9642d3,0x5b9663d7,0x5b756396,0x5b556bd6,0x4ad34af3,0x322f4290,0x6bf65b75,0x5b745313,0x5af10024,0x63725b12,0x52f210a7,0x6bb65b54,0x5b556375,0x7c586bf7,0x6c177417,0x5b953a91,0x639563b6,0x7c587c77,0x5af26396,
-0x5b7563b6,0x531352f4,0x1129422d,0x63973a91,0x53345315,0x08655334,0x5b0f8c34,0x3a2e0043,0x322f4290,0x3a913ab1,0x42b14b12,0x42903a4f,0x3a4f4290,0x322f4290,0x4ad3324f,0x422e4291,0x10c50002,0x196b2169,0x3a913250,0x42d142f2,0x000452f1,0x08883a0c,0x320d4250,0x3169528e,0x424e0004,0x11094a6f,0x29cd21ac,0x29ed322e,0x3a2f29ee,0x29cb10ea,0x21ce3a2e,0x2a0f21cd,
-0x32503a91,0x32503ab2,0x31cc52af,0x3a0d296a,0x08c829ac,0x424e1108,0x3a4e216a,0x4ad23a2e,0x32302a0e,0x3a922a10,0x42d342b3,0x32502a10,0x3a923251,0x29ef3292,0x2a103251,0x3a923a92,0x3ab23a92,0x3ab33ab3,0x3a923a92,0x3ab23ab3,0x3a923ab2,0x3ab23a92,0x32923ab3,0x3ab33ab2,0x3a923a92,0x3a923ab3,0x3a923a92,0x3a923ab3,0x3a933a92,0x3ab33a92,0x3a923a92,0x3a923ab3,
-0x3ab33a92,0x42b33ab3,0x3a9242b3,0x3ab33ab3,0x3a923ab3,0x3a933ab3,0x3ab33a93,0x3ab33ab3,0x42b342b3,0x42b342b3,0x42b342b3,0x42b342b3,0x42d442d3,0x42b342b3,0x42d442d4,0x42d442f4,0x42d342f4,0x42714272,0x4a9031ee,0x3a50190a,0x429042b1,0x218c322e,0x52f252f2,0x3a713a70,0x4b1429ef,0x218c3a52,0x5b114a2f,0x39eb39cb,0x422f29ac,0x31cb216b,0x5aef0845,0x4a6e3a0d,
-0x39ac31ab,0x52d25290,0x42b252f3,0x5b766395,0x4b145356,0x53555b75,0x5b965b96,0x53765376,0x53565376,0x00033a92,0x5b966373,0x5b755377,0x00045b75,0x6bb74a90,0x5b965bd6,0x53143a73,0x6bd65b55,0x3a915b54,0x3a703a50,0x73f55313,0x4ad44ab2,0x637329ac,0x63936bb4,0x4a9008a8,0x5b745b53,0x6b954ad3,0x74587417,0x63b77438,0x63d52a0f,0x6bf763b6,0x63953231,0x323163d6,
-0x5b9563d6,0x639463b6,0x00045310,0x53547457,0x5b953a92,0x52af4af3,0x39ca0843,0x3a2d10a6,0x4af2218c,0x3a913a91,0x322f42d1,0x08e94270,0x3a50320e,0x53334291,0x320f090a,0x52af3a2e,0x4a4d18e6,0x42d00886,0x53344af3,0x3a715355,0x08a74250,0x31ac0004,0x000352ef,0x000318e7,0x428f31ec,0x29ed0067,0x216b4290,0x429021cd,0x3a2f4290,0x4af131ee,0x42b13a71,0x3a70324f,
-0x42d23a91,0x31ed3a70,0x21290046,0x424e0866,0x29ab426e,0x3a0d2169,0x3a4e31ec,0x320f29cd,0x325121cd,0x3ab23251,0x3ab23a92,0x196c21ef,0x42d33a92,0x42d33292,0x3a723251,0x32523a93,0x3ab23ab2,0x3a923ab3,0x3ab33a92,0x3ab33ab3,0x3a923ab2,0x3ab23ab3,0x3ab23ab2,0x3ad33ab3,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab33a92,0x3ab33ab3,0x42b33ab3,0x3a923a92,0x3ab33ab3,
-0x3ab33a92,0x3ab33ab3,0x3a923ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33a92,0x3ab33ab3,0x42b33ab3,0x42b342b3,0x42d33ab3,0x42b33ab3,0x42b342d3,0x42d442d3,0x42d442d4,0x42d442d4,0x42f442f4,0x429242f4,0x29ce4291,0x3a2e3a6f,0x31ee216c,0x3a4f3a70,0x4af14290,0x42704291,0x3a504b12,0x4b134b13,0x11094af3,0x422d39cd,0x39aa18e7,0x4a7039ed,0x298a4a8f,0x420c1086,0x39aa4a2c,
-0x292a4a6e,0x52d25ad1,0x42b25313,0x42925b75,0x5b765334,0x4b1442b3,0x5b965b96,0x53765b96,0x5bb75376,0x32505b96,0x63741066,0x63b663d6,0x53346396,0x53110007,0x6bd763b4,0x4af3008a,0x63965b75,0x5b755334,0x3a4f4ab1,0x5313320d,0x08a96375,0x298d3a2f,0x5b5352f2,0x3a2e7c36,0x426f3a2d,0x637452b1,0x74376bf6,0x74387c58,0x63966bf7,0x74374af2,0x53135314,0x5b547417,
-0x4b133a71,0x4af142b0,0x00026bd7,0x42b15bb4,0x3a703a91,0x528f21ae,0x290718c5,0x298b39ac,0x3a904ab0,0x32703a71,0x531342b1,0x42904ab1,0x31ef29cd,0x196c52f3,0x3a905333,0x108531ed,0x18e831c9,0x092931ec,0x42b242b2,0x53345355,0x000452f3,0x39cc31cb,0x080318c5,0x426e10a7,0x004629cc,0x4ab142f1,0x322e3a6f,0x00a9090a,0x42903a90,0x4b133a2f,0x3a904b14,0x21cd324f,
-0x32502a2f,0x08c808a9,0x31ab214a,0x3a0d426e,0x19291909,0x216b29aa,0x08e9216b,0x320f31ed,0x3230324f,0x198e116d,0x3a912a30,0x32500028,0x3a723231,0x21ef3271,0x3a923271,0x3a923272,0x32723292,0x3ab23ab3,0x3ab33a92,0x3ab33ab3,0x3a923ab2,0x3ab23ab3,0x3ab23ab2,0x3ab33292,0x3a923a92,0x3a923a92,0x3a923a92,0x3ab33a92,0x3ab33ab3,0x42b33a92,0x3a923a92,0x3ab33ab3,
-0x3ab33a92,0x3ab33ab3,0x42d33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab342b3,0x3ab33ab3,0x3a923ab3,0x42b342b3,0x3ab342d3,0x42b342d3,0x42b342d3,0x42b342d3,0x42d442d4,0x42d442d4,0x42d342f4,0x3a723ab3,0x218c29ce,0x424f5311,0x4ad229ac,0x29ad29ad,0x427029cd,0x3a2f3a50,0x3a9029ed,0x4b13198e,0x4acf4af3,0x3a0d31ab,0x290741eb,0x39ee39ab,0x298a298b,0x1086422d,0x41cb2107,
-0x73734a4d,0x52f24a2e,0x5b7552f3,0x4b134292,0x53345333,0x53345334,0x5b965356,0x5b965b96,0x3ab35b96,0x4b563a92,0x194a08c9,0x5b765b33,0x4b364b14,0x00a55b74,0x5b744ad1,0x63d67438,0x42b24ad2,0x4b134ad3,0x29cb4ab1,0x63965331,0x196b6bd6,0x31ce73d5,0x84790027,0x5b126353,0x0886426d,0x5b5352b0,0x74387417,0x6c377c58,0x531563b6,0x5b547458,0x29ce6376,0x6c367c17,
-0x4b14090c,0x4b135334,0x31ec5b54,0x29ad0024,0x5b744af4,0x53315313,0x00441908,0x108739ec,0x3a4f3a0d,0x42d221cf,0x4af34b13,0x4af23270,0x42b242d2,0x4b133a91,0x4af22a0f,0x002431ec,0x112908c5,0x7c5752f1,0x4b1342f2,0x42924af3,0x20e852f0,0x31684a4c,0x10a70002,0x11293a2d,0x42d2322f,0x29ed42b1,0x214b31cd,0x29ce320e,0x002729ce,0x42b23a50,0x2a2f3a91,0x3a2e196b,
-0x008708c8,0x31ab10c7,0x18e82129,0x424d18e8,0x298a10e8,0x216a10a7,0x218c31ed,0x21ce3a4f,0x42d22a0f,0x32503230,0x4af23a50,0x3a713a71,0x19ad3271,0x3ab33271,0x32313a92,0x3a923ab3,0x32723292,0x32723272,0x3ab33ab3,0x3ab23ab3,0x3ab23ab2,0x3ab33ab2,0x32713ab3,0x3ab33ab2,0x3ab23ab2,0x3a923a92,0x3a923a92,0x3ab242b3,0x3a933ab2,0x42b33ab3,0x42b342b3,0x3ab342b3,
-0x3ab33a92,0x3ab33ab3,0x42b33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ad33ad3,0x3ad33ab3,0x42b33ad3,0x42b342b3,0x42d342d3,0x42d342d3,0x42d342d3,0x42d342d3,0x29ef3ab3,0x3a0e3a2e,0x3a2e4270,0x320f4291,0x31ed4ad0,0x426f3a4f,0x3a2f4290,0x214b29ac,0x29ad4270,0x63533a0e,0x31ac422d,0x318a39ec,0x31ab39cc,0x4ab0424f,0x422d3a2d,0x316918c6,
-0x39cc5af0,0x42704a4f,0x5b555b34,0x4ad342d3,0x4ad35334,0x5b755313,0x5b765355,0x5b965355,0x5b965b97,0x4af45bb7,0x00052a0f,0x53136b94,0x42d25b55,0x00254292,0x29ad5b31,0x5b555b74,0x322f42d2,0x429031ed,0x29ac4ad1,0x637452d0,0x428f5314,0x74376374,0x4ad28476,0x42704290,0x5b524af1,0x5b110886,0x63b56bb5,0x5b7563b5,0x63b65b75,0x32116bd7,0x63d75b95,0x53335314,
-0x6bd50027,0x531284b9,0x5b326bd5,0x29cc0023,0x5b530027,0x63934ad2,0x19070003,0x31ab10c7,0x218c29ac,0x4b1342b2,0x53345b75,0x4af34af3,0x4b145355,0x53345355,0x4af23230,0x00450887,0x52f210e7,0x08c84ab1,0x2a0e5b74,0x4a9142b1,0x08022968,0x08024a09,0x426d0002,0x3a700005,0x4ad34af3,0x42d03a70,0x4a900888,0x3a704af2,0x32503a90,0x3a914292,0x08c9092a,0x216a0026,
-0x18e80866,0x424d31cb,0x216a39ec,0x10c72149,0x10e71908,0x216b298b,0x3a2f31cd,0x3ab23a70,0x42d33a92,0x3a913250,0x00aa42b2,0x3a9129ce,0x2a4f090b,0x32313a92,0x325142b3,0x32723251,0x3ab32a31,0x32513272,0x3ab33292,0x32923a92,0x3ab23ab3,0x32723ab3,0x22103a92,0x3ab33ab3,0x3ab33ab2,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x42b342b3,0x3a923ab3,
-0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x42b33ab3,0x3ab33ab3,0x3ad342b3,0x3ab33ad3,0x3ad33ad3,0x3ad33ab3,0x3ad33ad3,0x42d33ad3,0x42d342d3,0x42d33ab3,0x42d342d3,0x42d342d3,0x3ab342d3,0x4ad442f4,0x31ed4ab0,0x190a216b,0x31ef216c,0x42af31ed,0x21ab29ac,0x428f322e,0x3a0e298c,0x29cd4290,0x4a8f10e9,0x39ec18e8,0x298a52af,0x4250426f,0x42b242b1,0x214a110a,0x00242989,
-0x4a6f298a,0x31ce420e,0x42b25b34,0x42915334,0x32105b33,0x5b556396,0x53344b14,0x4af45335,0x5b964b34,0x5b965b96,0x3a2e5355,0x531218e7,0x42f242b2,0x29cb42b2,0x63326b92,0x42b23a70,0x322f29ef,0x3a2e4ab0,0x424e4af0,0x4a90424e,0x216a31ce,0x29ed4ad1,0x5b327c36,0x53337416,0x53325353,0x52ae29ab,0x63956b75,0x5b755b54,0x63b65354,0x53547416,0x63d66bf7,0x63b66377,
-0x29ae0065,0x533229ee,0x7c573a70,0x00027372,0x000642b0,0x84560046,0x00040825,0x31cb0046,0x29cd4a8f,0x42b25313,0x53125314,0x325000ca,0x32713a71,0x42d34b14,0x531342f3,0x08a71908,0x198a422c,0x29cd5b53,0x42b129cd,0x4a4f52d1,0x08024a09,0x08420822,0x116b29aa,0x4ad442d3,0x531242b2,0x0004218c,0x29cd29cd,0x4af24ab2,0x3a90112a,0x00683a90,0x320d320e,0x0866320c,
-0x298b31ec,0x08a70887,0x21290026,0x4aae08a6,0x296a10c8,0x3a2f31ed,0x3a9229ef,0x3a923271,0x3a9242d3,0x32503a52,0x42b14270,0x196d4290,0x327121ae,0x3ab342d3,0x32513292,0x32723ab2,0x3a923271,0x3271198e,0x32723272,0x32523a93,0x32723a93,0x3a923272,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x42b33ab3,0x42d33ab3,0x3ab33ab3,0x3ab33ab3,
-0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab342b3,0x3ab33ab3,0x3ad33ab3,0x3ab33ab2,0x3ab33ab3,0x3ad33ab3,0x42b342b3,0x42b342b3,0x42d342b3,0x42d342d3,0x42d342d3,0x42d342d3,0x3a9242d3,0x42d342d3,0x42905313,0x31cd424f,0x42b14290,0x31cc192a,0x4aaf29ab,0x29ac216b,0x42b1194a,0x42924b13,0x29492929,0x422e2929,0x52f152f2,0x3a2f3a2f,0x4af442b2,0x428f4291,0x31cb29cc,
-0x29a92107,0x3a505af2,0x4ab24291,0x21ac5313,0x535529cd,0x4af34b13,0x29ef5b55,0x4b144af3,0x5b975b96,0x53555b77,0x3ab25355,0x52d00004,0x53334290,0x3a704ad2,0x4af10867,0x53136375,0x194c4271,0x424f3a2e,0x190929ac,0x528e10a7,0x29cc4aaf,0x006652d1,0x3a0e4a8f,0x3a305332,0x320d216c,0x00026bd4,0x63956bd5,0x5b9563b5,0x63b55354,0x73f67417,0x7c577c58,0x53146396,
-0x00258478,0x194c63d5,0x426f0089,0x08236373,0x428e1928,0x0866216a,0x000320e8,0x4a6e3a2c,0x112b0005,0x2a0f4290,0x3a8f4ad2,0x32505355,0x3a925b95,0x42d34b34,0x42704b34,0x00660065,0x08e80044,0x7c164ad1,0x6373320d,0x3168424e,0x08011823,0x00033167,0x4af4196c,0x42d44af4,0x4ad13250,0x4ab00005,0x42b14272,0x004608c8,0x31ed31ee,0x3a2e0067,0x190929ab,0x42703a2f,
-0x218c194a,0x216b3a4f,0x3a2d10c9,0x422d10a7,0x3a0e39ed,0x320f31ef,0x32713210,0x3ab242f3,0x32513ab3,0x32303a72,0x00063a2e,0x29ce4290,0x325029ee,0x3ad342d3,0x2a513292,0x3a923272,0x42d33a92,0x3a923251,0x3ab23ab2,0x22103271,0x42d33271,0x32713272,0x3ab22a31,0x3ab33a92,0x3ab33ab3,0x3ad33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ad3,0x3ab33ab3,0x3ab33ab3,0x3a923ab3,
-0x3ab33ab3,0x42b33ab3,0x3ab342b3,0x3a923ab3,0x3ab33ab3,0x3ab342b3,0x3ad33ab3,0x3ab33ab3,0x3ad33ad3,0x42b342b3,0x42b342b3,0x42d342b3,0x42d342b3,0x42d342d3,0x42f442d3,0x42d342d3,0x4af33a92,0x42b24af3,0x31ee4ab1,0x52d131ee,0x10a83a0d,0x39ed214a,0x424e216b,0x29ce192a,0x53344b14,0x39ca52ae,0x4a2d2128,0x10c84a70,0x6331298c,0x42733a2f,0x4ab25b55,0x52d142b1,
-0x0044296a,0x3a504aaf,0x3a504ad2,0x114c31ee,0x4af33250,0x2a0f5b75,0x21ad42d2,0x42b33230,0x53354ad4,0x53765b96,0x42f342f4,0x10a721ad,0x42d15b32,0x3a704ad2,0x6bb50888,0x192c6395,0x320f6bb6,0x31cd5b32,0x4a8f52d0,0x294941ec,0x29ab6352,0x10e93a2e,0x3a0e29ac,0x4ad0218d,0x53126374,0x00043a6e,0x6bf639ec,0x63b55333,0x4af24af2,0x533342b1,0x6bd64b12,0x743742b1,
-0x8cda6395,0x5b534ab1,0x216b52d2,0x6aee4ab0,0x426e0003,0x7c57192b,0x000331aa,0x298a0866,0x298b8435,0x2a0e4ab0,0x322e3a4f,0x4b133291,0x42d34b34,0x53344b14,0x31ee4b34,0x18e71086,0x29cd2168,0x190a4af2,0x5af06bb3,0x204441c9,0x29251042,0x42b10004,0x429342b3,0x4af33a92,0x0026320e,0x4b1352f1,0x42b442f3,0x320d320c,0x194b4270,0x29cc428f,0x3a2c0004,0x42714270,
-0x21cd322e,0x3a7029cd,0x3a2d08a9,0x320d08a7,0x298d2a0e,0x3a933a71,0x42f442d4,0x42d342d3,0x3ab33272,0x42923ab1,0x4270194b,0x21ce31ee,0x3a912a2f,0x3a923a92,0x2a123ab3,0x3ab23a92,0x198d3250,0x3a913250,0x3ab232b2,0x2a0f2a71,0x32513ab2,0x3a923ab2,0x32713ab3,0x3a933a93,0x3ab23ad3,0x3ab33ab2,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,0x3ab33ab3,
-0x3ab33ab3,0x3ab33a93,0x3ab33ab3,0x3ad33ab3,0x3ab33ab3,0x3ad33ab3,0x3ad33ab2,0x3ab33ad3,0x42b342b3,0x3ab342b3,0x42d33ab3,0x42b342b3,0x42d33ab3,0x42d342d3,0x42d342d3,0x42d342d3,0x32713272,0x320f4271,0x29cd4290,0x298c4ad1,0x10c831ed,0x298c31cc,0x3a0e10a8,0x53330025,0x42d342f3,0x21294aaf,0x318918e7,0x3a0c3168,0x316a31ab,0x52f331ad,0x42915334,0x29cd3a4f,
-0x0004322d,0x4a8f3a0c,0x4ab1428f,0x6374320f,0x42f45b75,0x3a922a10,0x5b754b34,0x42d45bb6,0x5b965b95,0x4b1521d1,0x42d24b15,0x00034ad1,0x63335ad1,0x42926395,0x52b05311,0x4af24ad2,0x3a5031ef,0x637429ae,0x212a424e,0x1909420c,0x73d452af,0x31ab3a0e,0x424f212a,0x53125312,0x428f42af,0x000652f2,0x5b5410c6,0x74176375,0x3a506bd6,0x298c216b,0x3a0f31ee,0x42714271,
-0x42915b54,0x74370006,0x3a2f52f3,0x0026216d,0x00050002,0x5b355b95,0x0024630f,0x002410a7,0x18e94aaf,0x42d14ab0,0x324f31ee,0x42f33ab2,0x42d34b34,0x535542d3,0x74164b34,0x3a0c0003,0x3a4f0085,0x4ad14291,0x41ec3a0d,0x100228e6,0x0065422b,0x4b134b14,0x42b33a51,0x00a95333,0x426e0045,0x4b135333,0x32314b14,0x29cc29cb,0x29ed4ab1,0x0887320d,0x42904ad0,0x3a304ab1,
-0x42d13a6f,0x3a903a6f,0x31cc214b,0x3a2f29ab,0x3a923a70,0x42d442d4,0x42d342f4,0x42d342d3,0x327242f4,0x21ac3a92,0x320e216c,0x21ad3a2f,0x2a303a90,0x3a923251,0x3a723ab3,0x2a0f2a30,0x325021ef,0x324f3a70,0x19ae2a0f,0x21ce3230,0x3ab23250,0x2a3142d3,0x32923271,0x3ab33ab3,0x32723ab3,0x3ab33ab3,0x3ab33ab3,0x3ab342b3,0x3ab33ab3,0x42b33ab3,0x3a9242b3,0x3ab33ab3,
-0x3ab33ab3,0x3a933ab3,0x42b33a93,0x3ad342b3,0x3ad33ab3,0x3ab33ad3,0x3ab33ab3,0x3ad33ab3,0x42d342b3,0x42d342b3,0x42d342d3,0x42d342b3,0x42d342b3,0x42d342d3,0x42f442d3,0x42d342d3,0x42b142d3,0x29ac29ab,0x21ac3a0e,0x214c218c,0x424e31ed,0x422e4a8f,0x422e31cc,0x002610c8,0x3a0d1109,0x29aa31ec,0x41ea3169,0x39eb1064,0x6b934a4e,0x108818e9,0x4ab1110a,0x5b534290,
-0x3a0d4ad1,0x31cc10c8,0x3a2e426f,0x52d24ab1,0x53565b75,0x5b765356,0x53355355,0x53565b96,0x5b9642f4,0x53755b96,0x3a923271,0x00244290,0x39ee2948,0x63b65b34,0x5b104ab1,0x5b5329cd,0x4ad15312,0x3a0f5b74,0x422d190a,0x10a7422d,0x52d0426e,0x31ab31ad,0x63737bf5,0x53335b53,0x29ac31ed,0x298d3a4e,0x5b342109,0x74587c38,0x4ad26bd6,0x52f252f1,0x6b9452b2,0x3a4e63b4,
-0x42903a4f,0x63d7216b,0x53345355,0x5b3442d3,0x0026194b,0x63545b54,0x0004424e,0x39898c76,0x190952cd,0x194b4a8f,0x0068428f,0x4af342b0,0x43144af1,0x4b144af3,0x52d14ad3,0x530e0003,0x424e0044,0x29ac4b12,0x73702949,0x10840801,0x10ea0886,0x4b133a92,0x32915334,0x52d029cd,0x4b14428f,0x3ad33291,0x00064313,0x3a6e0025,0x190a320d,0x4a8f426f,0x42b24290,0x42b23a71,
-0x324f194d,0x4b1229ee,0x31ed214a,0x320f29ac,0x42d329ef,0x42f442f4,0x42f442f4,0x3a9342f4,0x42f33a93,0x10e93290,0x324f0066,0x29ce218d,0x2a0f21ae,0x3a913a92,0x3a713251,0x325029ee,0x32503230,0x21ee2a2f,0x3a4f10e9,0x32303a91,0x32503a71,0x32523ab3,0x3a923a92,0x3a923ab3,0x3a723272,0x3ab33ab3,0x42b342b3,0x3ad33ab3,0x3ab33ab3,0x3ab33ab3,0x3a923ab3,0x3ab342b3,
-0x3a923ab3,0x42b33ab3,0x3ab342b3,0x3ab33ab3,0x3ab33ab3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x3ab342b3,0x42b342b3,0x42d342b3,0x3ad342b3,0x42d342d3,0x42d342d3,0x42d342d3,0x327142d4,0x4ab14292,0x18e918c8,0x429031ed,0x3a4f42b1,0x31cd3a0e,0x298c426f,0x18e93a0e,0x29063968,0x39ea0843,0x422c8435,0x29492127,0x39cc39cb,0x52b0212b,0x212a6332,0x210a31ab,0x00040888,
-0x5311194a,0x108731cb,0x4a6f6b72,0x52f331ee,0x5b975314,0x53354b35,0x5b965376,0x4b145376,0x4b144b35,0x4b345356,0x535442d2,0x42ae324f,0x5af10022,0x3a5052d1,0x1928192d,0x52d1298c,0x42b14ad2,0x424f4ad1,0x08674270,0x19488433,0x296b31ec,0x31cc4ad0,0x31ad5b12,0x31ed31ca,0x29ab29cc,0x19096372,0x8458210a,0x74165b54,0x3a916bf7,0x29ec5333,0x7c774af1,0x21ad4291,
-0x0005424e,0x4b335b11,0x5b7563b6,0x6bd663d6,0x00246bb5,0x5b1263b5,0x000331cb,0x18c852cf,0x52d06350,0x320e10c8,0x19ac6373,0x32515353,0x2a514b12,0x4b345b95,0x3a0d5313,0x3a0b0023,0x00250045,0x426f6374,0x18a552ae,0x00240801,0x4af25311,0x42b342b2,0x53324b33,0x31ed5312,0x3a904290,0x3a903a91,0x31ec218c,0x3a4e3a6e,0x53120066,0x320e4ab0,0x4b133a70,0x42b23a71,
-0x3a6f4af2,0x322f29cd,0x00264a8f,0x3a303a2e,0x42f442b2,0x42f442f4,0x42f442f4,0x42b342f4,0x42d342d4,0x42900005,0x3a90112a,0x196b2a0e,0x3a91194c,0x3a9142b2,0x29ee42d2,0x32503a71,0x19ad114c,0x008829ed,0x322f3a4f,0x29ef198d,0x3ab23230,0x325121f0,0x3a923a72,0x32513ab3,0x3ab33252,0x3ab33ab3,0x42b342b3,0x3ab23ab3,0x3ab33ab3,0x3ab33ab3,0x3ab342d3,0x3ab342b3,
-0x42b33ab3,0x42b33ab3,0x3ab342b3,0x3ab33ab3,0x3ab33ab3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x3ab342b3,0x42b342b3,0x42d342b3,0x3ad342d3,0x42d33ad3,0x42d342d3,0x42d342d3,0x42f342d4,0x29ad322f,0x31ac4a2e,0x31ed214b,0x322f3a70,0x214b39ee,0x424f3a2e,0x190910ea,0x31273148,0x210718a5,0x296a18e9,0x420c424c,0x296a2969,0x424e18e9,0x298b52f1,0x39ed422e,0x5b3452b1,
-0x4ab021ac,0x4a6f5af1,0x39ed0006,0x52f24ab1,0x53355b75,0x533542b4,0x5b765376,0x5b765355,0x53555355,0x42f35bb7,0x4b135374,0x429142b1,0x08860065,0x5b331929,0x08a63210,0x5b326bb4,0x426f424f,0x5b12424f,0x318b3a0e,0x63712989,0x5af04a6e,0x00263a2e,0x4a6f8456,0x42904a8f,0x426f426f,0x08883a2e,0x633252ae,0x6bd54290,0x21ef6395,0x63947437,0x84775b53,0x110a6bf7,
-0x3a4f3a2f,0x6c160886,0x63d65354,0x639563d6,0x004373f6,0x5b115b52,0x00052149,0x298d422d,0x18a75aef,0x4af1214a,0x21ed4ad1,0x3a715353,0x118e4b12,0x53754af2,0x4aaf4af2,0x3a0d0003,0x000352cf,0x10874a8f,0x00025aef,0x3a0d1085,0x3a5008ca,0x3a9342b2,0x39ec4af2,0x53126373,0x324f4290,0x0065320e,0x214a4a8e,0x110921ab,0x3a705311,0x29ee4af2,0x4b143ab2,0x114d3a91,
-0x196b218c,0x110a3a90,0x3a2d216b,0x3a30424e,0x3ab34af3,0x42f442f4,0x3a9342f4,0x327242b3,0x42d342b3,0x092b29ac,0x198b320f,0x21ab21ab,0x42b13a4f,0x3a7142b2,0x29ee2a0f,0x3a70114c,0x198b324f,0x3a2e08a8,0x3a703a2f,0x21ce2a0f,0x2a2f42b2,0x3a922a31,0x3ab342b3,0x3a923a92,0x32723ab3,0x3ab33272,0x3ab33ab3,0x3ab33ab3,0x3ab33ad3,0x3a923ab3,0x3ab33ab3,0x3ab33ab3,
-0x3ab33ab3,0x3ab33ab3,0x42b33ab3,0x3ab33ab3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x42b342b3,0x42b342d3,0x42b342b3,0x3ad342b3,0x42d33ad3,0x42d342d3,0x42f442d3,0x32713ab3,0x428f2a0e,0x4a8f39cc,0x3a4f426f,0x42d242d1,0x3a2e4ab2,0x214b192b,0x420d39ee,0x20c63149,0x49eb20a6,0x318c0027,0x31aa39cc,0x39eb2949,0x3a2e298a,0x296b0867,0x39ec10a8,0x218c29cb,
-0x5b333a30,0x42906333,0x298b52d1,0x4ab229ad,0x53765314,0x535642f4,0x5b765b76,0x53765b96,0x53765355,0x5b965b96,0x4b1342f2,0x4b1142d1,0x00014a92,0x5af07391,0x088673d7,0x426e31cb,0x31cb422c,0x428f6b71,0x422c218b,0x21077bf4,0x84140003,0x63934ab0,0x426d10e7,0x6bb531ce,0x63334ab1,0x425052d2,0x52ad0884,0x6bd5426f,0x7c9a5313,0x53336394,0x4ab16375,0x429029ef,
-0x3a2f52f2,0x00054290,0x4b5563b6,0x4b3463d6,0x426d63b6,0x84560003,0x00043a0b,0x000373b3,0x10a65aef,0x3a2d0004,0x52f15b52,0x3a6f21cd,0x198d5333,0x535442d2,0x63324ab2,0x31ac0045,0x10e74a6e,0x296a5b52,0x00420001,0x4a9052b0,0x3a2f320e,0x42d242d3,0x00450887,0x3ad05312,0x29ab3a8f,0x10860065,0x00454a6d,0x31ee424e,0x3a703a50,0x21ee322f,0x3ad34ad3,0x29ee3a71,
-0x218c196b,0x194a3a4e,0x29ac0004,0x42d24ad1,0x42f43ab2,0x3ad442f4,0x42f43ab3,0x3ab33a92,0x322f42d4,0x4af242d1,0x218c320e,0x21ac110a,0x2a0e3a70,0x21ce3a70,0x21ee3250,0x29cd2a0e,0x08c8194a,0x298b214a,0x29ed21cc,0x3a91196c,0x3251322f,0x32913ab2,0x2a303ad2,0x42d32a30,0x3ab33a92,0x3ab33ab3,0x3ab33ab3,0x3ad33ad3,0x3ab33ab3,0x3ad33ab3,0x3ad33ad3,0x3ab33ad3,
-0x42b342b3,0x3ab342b3,0x3ad33ab3,0x3ad33ad3,0x3ad33ab3,0x3ad33ad3,0x3ad33ad3,0x42b342b4,0x42b342b3,0x42b342b3,0x42b442b3,0x3ad442b3,0x3ad33ad4,0x42d43ad3,0x42d242d4,0x21ac3ab2,0x424f4a90,0x212a3a0c,0x216b298c,0x42d242b2,0x52f34af3,0x3a303a6f,0x4ad252f3,0x20e831ab,0x292a3169,0x318b4a8f,0x2109296b,0x318a2127,0x52b1298b,0x4a9052d1,0x10c7422e,0x4a6e318b,
-0x31ed29ad,0x29ad298c,0x39f05312,0x39cc214b,0x5b534a90,0x53753231,0x53555355,0x53353a92,0x4b145b76,0x53755355,0x53755b96,0x114b3270,0x2128322e,0x52af0884,0x08667bd4,0x6331296a,0x31cb1929,0x00452107,0x7bd56311,0x7bf318e8,0x8413420c,0x31cc212a,0x216a0887,0x298d6373,0x4af26374,0x194c4270,0x18e54aad,0x008618e7,0x635452d0,0x5b547c37,0x53334af2,0x6bf663b3,
-0x4ad16bb5,0x74155b33,0x743708e8,0x5b965355,0x63965b95,0x00440086,0x000583f3,0x10a6424c,0x21284a8e,0x00022108,0x4aaf39ec,0x5b743a4f,0x32303a70,0x4b1342d2,0x3a2e3a50,0x5b1110c7,0x190752cf,0x10868455,0x632e1042,0x194973d3,0x428f3a6e,0x322f21ee,0x5b540026,0x53114ad2,0x21680005,0x31480844,0x4a701067,0x42d23a4f,0x4b134314,0x2a2e3250,0x2a0f3270,0x426f196c,
-0x31cc29ab,0x5b103a2d,0x29cc31ab,0x42d242b0,0x3a9242f3,0x42f43ab3,0x42f442f4,0x42d33ab3,0x42913ab3,0x4ad23250,0x08a83a2e,0x42b0194a,0x327029ee,0x21ad3a90,0x324f29ee,0x3a2e196b,0x21491929,0x31ed194a,0x29ed29ed,0x21ce3a50,0x21ee2a0f,0x2a302a2f,0x3ad22a51,0x32513271,0x42d33251,0x3ab33272,0x32933293,0x32933ab3,0x3ab33ab3,0x3ad342b3,0x3ad33ad3,0x3ad33ad3,
-0x42b342b3,0x42b33ab3,0x3ad342b3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,0x42b342b3,0x42d342b3,0x42b342b3,0x42b342b3,0x3ad342d4,0x42f33ad4,0x4af43ad3,0x21cd21ef,0x42b23ad1,0x29ac4270,0x298b296a,0x3a4e298c,0x4af33a50,0x321042d2,0x4ad33a2f,0x4af43a92,0x318b192a,0x39ed424f,0x18a639cb,0x4a6d0804,0x4a4e5aaf,0x424f298c,0x298c31cd,0x3a0d39ee,0x52af2129,
-0x5b1252f2,0x31ef5b12,0x53344271,0x3a715b55,0x4a7031ea,0x53144252,0x4b354af4,0x4af442f4,0x5b765b96,0x3a925b96,0x325142f3,0x21cf3250,0x218b5333,0x41ab0023,0x18e873b2,0x4a8f4a8f,0x00043a0d,0x000431aa,0x00260003,0x4a8e8435,0x29071086,0x5b126354,0x4ad26bb6,0x63730047,0x4ad029ac,0x5b346393,0x00046b94,0x9d170885,0x52ce10c6,0x6bd652d2,0x29ce7c78,0x63b663b5,
-0x63b50007,0x533342b1,0x3a4f424e,0x63d65b74,0x5b544b35,0x00038478,0x00024a2b,0x424b31ca,0x635118e9,0x426d298a,0x3a0c0024,0x3a4f192a,0x29ee5311,0x4ad35333,0x73b53230,0x31cb0003,0x39894a6d,0x104252cd,0x63501042,0x298a3a2c,0x08e9426d,0x218d4af2,0x42f14af3,0x218b00c8,0x086529aa,0x31aa0844,0x4ab139ed,0x4b143ab2,0x4b3442f3,0x322f63b5,0x08a942b1,0x298c3a0e,
-0x29ab216b,0x18e731aa,0x298b2169,0x3a924290,0x325142b2,0x4af442d4,0x42f442f4,0x3ad242f4,0x4ab2010b,0x29ce0008,0x429029ed,0x21ad320d,0x116c322f,0x29ee19ad,0x2a0d114b,0x18e81109,0x19292128,0x218c320e,0x322f21ad,0x21ee320e,0x19ce220f,0x3250114c,0x32712a30,0x32712a30,0x3ab33a92,0x3ad33ad3,0x3ad43ad4,0x42d33ab3,0x3ad342b3,0x3ad43ad3,0x3ad33ad3,0x3ad33ad3,
-0x42d342b3,0x42b342b3,0x3ad342b3,0x3ad33ad3,0x42b33ad3,0x3ad342b3,0x3ad33ad3,0x3ad33ad3,0x42b342b3,0x42b342b3,0x42d442b3,0x42d342d4,0x42d342d3,0x3ab342d3,0x3a3042b3,0x42b2116c,0x31ee3a0e,0x218b298c,0x52f131cb,0x3a913a70,0x4291198d,0x42914af2,0x42d24af3,0x424e3a0e,0x18e9296b,0x296a39cc,0x08243189,0x00255aae,0x210a424e,0x39ee420e,0x42b05b12,0x08ca6374,
-0x4ab1296b,0x4ad24af3,0x42d25b54,0x4af35334,0x18e910e9,0x5b544ab3,0x4b355355,0x4b354b35,0x53765b96,0x4b345376,0x32505355,0x3a504b13,0x53314b12,0x00634af1,0x428c0001,0x31cc296b,0x000318ea,0x63315ad0,0x52f25b13,0x00053a6f,0x18c71909,0x5b336352,0x63755b53,0x218b42b1,0x10e708a6,0x6b93424e,0x429063b4,0x294a31ab,0x31aa6331,0x5b546350,0x5b745333,0x5b945333,
-0x110c6bd7,0x218e3a51,0x31cc4291,0x4af26bb5,0x53355b75,0x7c355b14,0x00020002,0x426d0045,0x298b39ee,0x29ab4a90,0x19293a0b,0x0088194a,0x198b110a,0x21ad114a,0x318b4ad2,0x21490003,0x00011908,0x08000000,0x5acf39eb,0x31cb10c7,0x4aaf0065,0x42b00087,0x00c8320f,0x422d218a,0x00020023,0x3a2e39ec,0x4ad24291,0x327142f3,0x4b1342d3,0x3a90194b,0x31cd08ca,0x4a904a90,
-0x0045298b,0x00041908,0x42901909,0x3a713a51,0x32713250,0x42b33ab2,0x3ad442f4,0x3ab242f4,0x42f3110c,0x21ad4af3,0x29cd112a,0x42d1322e,0x2a0f322f,0x3a4e21ee,0x29ed29cc,0x3a0c1109,0x3a4f3a0d,0x31ed320e,0x08c929ed,0x08ea322e,0x196c112b,0x325021ad,0x42f33ab2,0x3a923a92,0x42b342d3,0x3ad33ab3,0x3ad33ad3,0x42b33ad3,0x3ad342b3,0x3ad33ad3,0x3ad33ad3,0x3ad33ad3,
-0x42b342b3,0x42d342b3,0x3ad342d3,0x3ad33ab3,0x42b33ad3,0x3ad342b3,0x3ad33ad3,0x3ad33ad3,0x42b342b3,0x42d342d3,0x42b342d3,0x42d342d4,0x42d342d3,0x42d342d3,0x427142d3,0x4af23a91,0x42b229ef,0x088952d2,0x3a2f3a4e,0x3a9108c9,0x3a502a0e,0x3a7129ef,0x3a914af3,0x3a0d5b12,0x39ec31ab,0x422d316a,0x18a62948,0x29270844,0x106518a6,0x20e70844,0x52d15af0,0x5b555b55,
-0x00064b13,0x320e4ab0,0x42b24ad1,0x42b142d2,0x214a2a0f,0x53353a2e,0x53764b15,0x53765b96,0x32515376,0x4b145355,0x4b133251,0x4af242b2,0x21cd5313,0x0003194c,0x29280001,0x5b3231cc,0x5b324ad0,0x10880886,0x42734a91,0x6bf76bd7,0x000573f6,0x31ee73d4,0x63754ad1,0x00475b75,0x73f531ed,0x00058478,0x52f0426e,0x63520004,0x8c570005,0x424c0047,0x53335b11,0x63748479,
-0x63958499,0x3a9063b5,0x4a90298e,0x3a0d18a5,0x29ae5b54,0x63755b34,0x00020845,0x39cd10a5,0x42af4ad0,0x216a426e,0x0887528f,0x3a4f3a6f,0x21cd320d,0x3a6f112b,0x6bb45333,0x294910c4,0x08022928,0x08211042,0x18e639ea,0x004431a9,0x10e8296a,0x324e194a,0x29ac6374,0x00034aaf,0x296a2127,0x42704a90,0x3ab242d3,0x21f05335,0x42d24b35,0x192b52f3,0x42ae29ce,0x52f35312,
-0x19070025,0x318b1086,0x218c39ee,0x21ae29ee,0x4b133a72,0x42d34b13,0x4ad442d3,0x08873af4,0x3231196c,0x429142f3,0x429142b1,0x32503a50,0x32304af3,0x19273a4f,0x10e91929,0x1109216b,0x112a196b,0x110929ac,0x21ac08c8,0x1109196a,0x3a71320e,0x3a723251,0x3ab342d4,0x327242b3,0x3ab33ab3,0x3ad342d3,0x3ad33ad3,0x3ad33ad3,0x3ad43ad3,0x3ad43ad3,0x3ad33ad3,0x3ad33ad3,
-0x3ad33ad3,0x42b342b3,0x42b342b3,0x42b33ab3,0x42b342b3,0x3ad342b3,0x3ad33ad3,0x42b342b3,0x42b342d3,0x42d342b3,0x3ab342d3,0x42d442d3,0x42d442d4,0x42d442d4,0x31ee42b2,0x196d320f,0x320f196c,0x194b3a2f,0x3a2f196c,0x2a0f21ac,0x3a2f3a70,0x42914291,0x4ad34af3,0x3a0d4ab1,0x39ec41ed,0x420c18c8,0x41ca2928,0x630f0844,0x31aa422c,0x000331aa,0x08650003,0x4272422e,
-0x4af24b54,0x4aaf194a,0x5b553a2f,0x3a713a93,0x4270320f,0x3a4d29af,0x53755315,0x53765376,0x53555b96,0x5b965376,0x32515b76,0x63752a10,0x3a903a70,0x4acf324e,0x29280003,0x73f57c15,0x422e6b53,0x4a6e2149,0x52f2422d,0x53156bd7,0x4b315b74,0x398a0024,0x298d6b94,0x6bb529ac,0x63b65313,0x74177437,0x11085b54,0x4a2c10e7,0x7c566334,0x212873b2,0x00278412,0x3a2f29ad,
-0x5b745334,0x63b56bd6,0x298d4a90,0x424e5b11,0x5311298a,0x63743a2e,0x000239ec,0x298a0003,0x322f424e,0x29cc4a90,0x192931ab,0x53324ad1,0x320e42b0,0x63945353,0x216a5b95,0x31ca5aee,0x10620864,0x29676b6f,0x106552ad,0x5aef0024,0x00460005,0x4af35b32,0x426d29ad,0x20e80004,0x3a0e39ed,0x29ce214c,0x325119ae,0x2a103a92,0x4af23251,0x4270192b,0x320e320f,0x3a4e322e,
-0x2149216a,0x218b298a,0x42903a2f,0x4af242d1,0x42f33a92,0x3ad23250,0x3ad23ab2,0x112b5353,0x3a9242d2,0x112c3ab2,0x21ad3a70,0x3a71322f,0x090a42b2,0x08c7428f,0x3a6f216b,0x3a6f3a4f,0x29ed3a6f,0x008729cd,0x1109196a,0x320e320d,0x42b24271,0x3a923a71,0x3ab33a92,0x3ab33ab3,0x3ad43272,0x3ab33272,0x3ad43ad4,0x3ab33ab3,0x3ad33ad3,0x3ad33ad4,0x42d442d4,0x3ad33ad3,
-0x3ad33ad3,0x42b342b3,0x42b342b3,0x42b342b3,0x42b342b3,0x3ad342b3,0x3ad33ad3,0x3a9342b3,0x42d342b3,0x42d342d3,0x42d342d3,0x42d442d3,0x42d442d4,0x42b342d4,0x3a2f29af,0x196d3a71,0x29ce29ce,0x3a6f322f,0x29ad3a70,0x08c9320f,0x429029cd,0x4290320e,0x320e4ab0,0x4a903a2e,0x4a6f214b,0x39cc5ab0,0x4a4d20e8,0x00054a6e,0x420c318a,0x2129424d,0x39eb422c,0x31ab0864,
-0x53136374,0x4aaf3a2f,0x53144a90,0x32105375,0x533229ce,0x00474ad3,0x4af55b53,0x5b765b76,0x5b965b96,0x5b764b14,0x5b965b96,0x5b555355,0x00894af3,0x42905b94,0x0003322d,0x52f141ab,0x29cc4a90,0x10c85310,0x18e80005,0x52f2322d,0x08c8320e,0x10440864,0x843439ea,0x5b3373f5,0x53337417,0x74387417,0x6bd66bd6,0x00246bb5,0x84343a0b,0x318710a7,0x3a4d0003,0x5b544ab1,
-0x537400a9,0x42d1951b,0x31ef298b,0x21493a30,0x0886420a,0x004710c8,0x00028415,0x00030003,0x29ce214a,0x39ee52f1,0x088731ab,0x42b0320e,0x322f322e,0x00474b12,0x00045313,0x31a994b6,0x08410001,0x29882126,0x08650003,0x00045aef,0x52d152d0,0x324f4ab1,0x00021948,0x41cc2949,0x298d298c,0x4af34af2,0x2a1042d3,0x21ee3a91,0x00873ad2,0x5333196b,0x192b4ab1,0x08e729cc,
-0x10c83a2c,0x320e216a,0x31ee29ad,0x4af33a90,0x32503a92,0x2a0e42d2,0x1a0e3290,0x3a920066,0x3a9242b1,0x42913272,0x196c3a70,0x32503a90,0x326f008a,0x424e0025,0x29cd424f,0x194b218c,0x29cd218b,0x08e80067,0x218b320d,0x192b29ac,0x29ef216d,0x32723a71,0x42f442b3,0x3a9242f4,0x42d43ab3,0x3ab33ad3,0x3ad43ad4,0x3ab33ab3,0x3ad33ad3,0x3ad33ad4,0x42d442d4,0x3ad33ad3,
-0x3ad33ad3,0x42b342b3,0x42b342b3,0x42b342b3,0x42b342b3,0x3ad342b3,0x3ad33ad3,0x42d442b3,0x42d342b3,0x42d342d3,0x42d342d3,0x42d442d3,0x42d442d4,0x4af542d4,0x42903a71,0x4ad242b1,0x194b198c,0x322f320e,0x32104ad1,0x214b3a50,0x428f18e9,0x31ed3a6f,0x31cc214a,0x52b1426e,0x4ab04270,0x39ac420e,0x4a8f2929,0x5270422e,0x10a60024,0x298a18e7,0x39ca2949,0x00046310,
-0x19280844,0x3a2d21cc,0x4ad2214b,0x3a714b34,0x4b313a91,0x4af34b14,0x4af30048,0x5b765b76,0x5b765b96,0x4b3563b7,0x5b965356,0x3ab35b96,0x4af342f3,0x4ad14af2,0x002308c9,0x52f230c7,0x63765b36,0x320d3a30,0x00027415,0x08870024,0x3a0e0046,0x39a92988,0x21091065,0x00070067,0x5b543230,0x6bf66bd6,0x42f16bf7,0x29ab21cc,0x10850882,0x39a773af,0x7c36a516,0x31ee7c58,
-0x2a0f8cfa,0x00897c78,0x214a426f,0x4a8f424e,0x19283a0d,0x63710023,0x00014a2c,0x10c70002,0x194a216a,0x52f15b12,0x00454a6f,0x31ed426e,0x4ad110c9,0x4ad1320e,0x00025b10,0x00010002,0x08210001,0x10630822,0x4a2b20c5,0x52d10846,0x42914ad1,0x533242b1,0x31ec0024,0x42524291,0x3a104290,0x4b134b13,0x42b25314,0x110b2a0f,0x3a2e31ed,0x42b1196b,0x19073a2e,0x10c608a6,
-0x214a31ec,0x4ab03a6f,0x42b13a50,0x325042d1,0x3a9121ce,0x218c2a0d,0x218b4ad1,0x3a925312,0x3ab23a92,0x3a7042b1,0x320f29ee,0x322f4291,0x29cc29ed,0x42904290,0x00463a2e,0x10e90067,0x0067194a,0x216b29ac,0x3a2e3a6e,0x2a0e3a2f,0x3a903250,0x32703a91,0x42d33ab3,0x3ab33ab2,0x3ab33292,0x3ad33ad3,0x3ad43ad4,0x3ad43ad3,0x42d43ad3,0x3ad342b3,0x3ad33ad3,0x3ad43ab3,
-0x3ad43ad3,0x3ad33ad3,0x3ad43ad3,0x3ad33ad3,0x42b33ad3,0x3ad342b3,0x3ad33ad3,0x42d442b3,0x3ad43ad4,0x42b342d4,0x42d442d4,0x42d342d4,0x3ad342d3,0x42b33ad3,0x42d242b2,0x3a5029ee,0x42d142b0,0x110a218b,0x4ad23a70,0x42904ad2,0x4ab00087,0x428f426f,0x4a8f422e,0x298b31cc,0x42903a4e,0x53135313,0x42504a91,0x4ab14a91,0x08444a90,0x210818e7,0x31ac39cc,0x00651908,
-0x00022169,0x00010043,0x00240002,0x4ab26bd3,0x42d13210,0x4ad35354,0x3a0a4ab0,0x5b565314,0x5b965b55,0x5b555355,0x53344ad3,0x5b555334,0x4b133a72,0x42d25334,0x21690026,0x420c0002,0x4ad46395,0x743763b5,0x08865311,0x84550002,0x739431cb,0x52f352f5,0x3a0d5b33,0x39eb0865,0x29cc6372,0x6bb54a90,0x73f53a30,0x3a2e5b12,0x52ad0024,0x210518c6,0x7bf53187,0x63955b14,
-0x74176bf7,0x7c785313,0x31eb0005,0x0046420c,0x63934290,0x5acd4a4d,0x08020000,0x11290002,0x6b524aaf,0x52f13a0e,0x10c6212a,0x216b1108,0x428f192b,0x637129ed,0x526d1907,0x08210843,0x41e85aac,0x31670001,0x18e63147,0x31ee3a2e,0x08ea3a50,0x00450066,0x42911109,0x42b329cf,0x3a315b54,0x42b23250,0x42d221ef,0x531142b0,0x426e426e,0x00040005,0x190729aa,0x424f298b,
-0x3a0e192a,0x3a6f29ed,0x42b129cd,0x324f4af2,0x196b3a70,0x3a0d29ec,0x08c731ab,0x42d24291,0x2a103271,0x42d2196c,0x21ad0048,0x42d121ad,0x3a4e0929,0x320d320e,0x31ed21ab,0x1909298b,0x19291109,0x29ac3a2e,0x2a0e322e,0x320f29ef,0x324f322e,0x32502a2f,0x42d33a92,0x3a923271,0x3ab33292,0x3ad33ad3,0x3ad43ad4,0x42d43ad3,0x42d43ad4,0x3ad442d4,0x3ad43ad4,0x3ad43ad4,
-0x3ad33ad4,0x3ad43ad3,0x3ad43ad4,0x3ad33ad4,0x42d43ad3,0x3ad442d4,0x3ad33ad4,0x42d442b3,0x3ad43ad4,0x42b342d4,0x42b342d4,0x42d342b4,0x3ad342d3,0x2a103ad3,0x090a42b2,0x321042b1,0x322e3a6f,0x320e4ab0,0x218c4291,0x214a4ad1,0x00884a8e,0x42905b53,0x39ed3a0d,0x29cc31cc,0x3a4f4ad0,0x3a922210,0x52f44ad3,0x4ad252f3,0x422e4270,0x528d0004,0x108739ec,0x52d26354,
-0x3a4f0069,0x3a4e5332,0x422c426d,0x00230003,0x535310a7,0x32103a91,0x08673a30,0x5b942149,0x3a914af3,0x3a713270,0x42b142d2,0x5b7542d1,0x3a925334,0x32104292,0x4acf3a91,0x10840003,0x31ce428f,0x18ea5af3,0x420d10e8,0x000310c7,0x00050004,0x94d93a2f,0x849729cc,0x08432127,0x08640002,0x6b710004,0x53116351,0x42706bb4,0x08458c97,0x00466b51,0x18c418a5,0x84762988,
-0x21ef5396,0x63d75b96,0x8cb963b6,0x6b93194a,0x52f108c8,0x4a6d6b94,0x00014a6a,0x424e0002,0x3a0f29ac,0x52d10026,0x0824426e,0x7c142128,0x428f31ec,0x52ef08c8,0x424b0023,0x00010002,0x188320e5,0x28e51883,0x4a6d2906,0x29ad0068,0x5b124ad1,0x63730066,0x29ef5312,0x42d23250,0x3a915b75,0x21ee3271,0x2a0e3290,0x0866298b,0x10c8216a,0x18e70003,0x29692969,0x21ac424e,
-0x3a6f29cd,0x29cd29ed,0x21cd3a6f,0x21cd198c,0x00463a4e,0x31ca31ec,0x73f60845,0x3a91194b,0x2a0e3a91,0x3a4f320e,0x322d0025,0x194a3a6f,0x31ed3a6f,0x1949110a,0x29ab08a7,0x192a214a,0x216b1109,0x322f112b,0x3a713250,0x32303a91,0x2a0e320f,0x21cd322e,0x32513230,0x32732210,0x3ab33251,0x3ad33ad3,0x42d442d4,0x42d442d4,0x42d442d4,0x42f442d4,0x3ad33ad3,0x3ad43ad4,
-0x3ad33ab3,0x42d43ad4,0x3ad342d4,0x42d43ad4,0x42b342d4,0x3ad442d4,0x3ad33ad4,0x3ad43ad3,0x3ad43ad4,0x3ad442d4,0x42d43ad4,0x42d342d4,0x42d342d3,0x08c942d3,0x2a0e21cd,0x3ab13a90,0x42914ad1,0x00871109,0x53325332,0x10c729ab,0x4aaf0004,0x190939ed,0x088710c8,0x0066296a,0x3a6f29cc,0x4af33a91,0x3a924af3,0x3a304b13,0x31ed29cd,0x106510a7,0x52b1296a,0x533452f3,
-0x42913230,0x4ad35b33,0x73b40027,0x425039ee,0x00253a4f,0x5b5108a7,0x52f3428f,0x4a8f0867,0x531452f1,0x53544b12,0x322f4b13,0x42b13a91,0x4b343250,0x5b534b13,0x6bb44290,0x000129cc,0x5ad17bd4,0x424f0068,0x29ce6395,0x7c342169,0x94d594f6,0x00030002,0x00230024,0x00020002,0x00011084,0x08421084,0x08030824,0x00250866,0x00030001,0x8c552926,0x00025b10,0x31852904,
-0x53954b54,0x53345b96,0x63b65b96,0x00067c16,0x10e94ab0,0x63515b33,0x10630843,0x63720042,0x29ad3a0e,0x84565b12,0x31aa0045,0x08877bd3,0x426e08c8,0x10840886,0x08830822,0x528c0001,0x08011063,0x18a30822,0x637218a5,0x42704290,0x00064ad1,0x5b134aaf,0x5b754292,0x2a0f3250,0x3a925334,0x429008ea,0x29ec4b11,0x52af18e8,0x298b52af,0x00240003,0x31ac39eb,0x42b0426f,
-0x110a3a2e,0x29cd10ea,0x08c921ac,0x29ac29cd,0x298a0024,0x4a4d31aa,0x3a4f420d,0x2a0f29cd,0x08c84291,0x0087322e,0x08e8322e,0x428f0066,0x08a8218c,0x0065322e,0x0887320d,0x00673a0d,0x424e194a,0x29ee322f,0x29ef3250,0x4290322f,0x3a6f320e,0x21cd324f,0x21ae21ce,0x42d33a71,0x42d342d3,0x3ad33ad3,0x42d442d4,0x42d442d4,0x42d442d4,0x3ad342d4,0x3ad43ad4,0x3ad43ad4,
-0x3ad33ad4,0x3ad43ad4,0x3ad43ad4,0x42d43ad4,0x42d442d4,0x3ad342d4,0x3ad43ab3,0x3ad43ad4,0x3ad43ad4,0x3ad43ad3,0x42d43ad4,0x42d342d4,0x42b342d3,0x194c218c,0x21ae322f,0x3a7129ef,0x08ca114b,0x42d14b12,0x4ab221ad,0x21890887,0x4291216b,0x3a2f29ad,0x422e422e,0x52f02149,0x004608e7,0x2a0d3a8f,0x3a9021cc,0x42af322f,0x53124ab1,0x00033a4e,0x3a0f422d,0x53344ad3,
-0x4af33ad3,0x4af32a0f,0x53145335,0x32103a91,0x427252f3,0x00233a2e,0x19290023,0x08865b31,0x5b145b0f,0x535552f3,0x42b34af3,0x3a913a72,0x42b13a71,0x10c9322f,0x00870005,0x0003192a,0x526d2906,0x004752d1,0x00480027,0x63538cb8,0x5b305b31,0x31690865,0x00037bf4,0x94d86b93,0x18e739eb,0x31892128,0x4a4d5aef,0x63524a8f,0x00850004,0x00020002,0x318810e6,0x18600800,
-0x63b67437,0x3ad33ad3,0x4b346396,0x7c366bb5,0x52af39cd,0x5af04a8f,0x00012948,0x00250002,0x29ad3a6e,0x3a515312,0x08866bd3,0x10c84a6d,0x0045426e,0x00012148,0x08012105,0x20e40801,0x18630801,0x18a31863,0x320e3a4d,0x52f442ef,0x002508a6,0x4af331ce,0x4b134b14,0x4b324b12,0x53124af3,0x21ac3a6f,0x08884ab1,0x52d15b12,0x52d029ac,0x106518e6,0x29ae39eb,0x008910eb,
-0x4ab04290,0x428f4ad1,0x42b03a2e,0x192a4290,0x4aaf0045,0x21684a6e,0x324e428f,0x323042d1,0x29eb29ce,0x29cc320d,0x08a6298a,0x00a810e7,0x320d322e,0x088608a8,0x4ab13a0d,0x21ab218c,0x29ed194b,0x42b0324e,0x21ae3a91,0x320e2a30,0x29ed324f,0x2a0e21ac,0x42b13a4f,0x32923251,0x42f342f3,0x42d342d3,0x42b342b3,0x42d442d4,0x42b342d4,0x3ad442d4,0x3ab342f4,0x3ad442d4,
-0x42d442d4,0x3ad43ad4,0x3ad43ad4,0x3ad43ad3,0x3ad43ad4,0x3ad33ad4,0x3ad33ad3,0x3ad33ab3,0x42d442d4,0x42d342b3,0x3ad442d3,0x42d33ad4,0x2a5042d3,0x29ee3a90,0x42b14291,0x114c196d,0x3a92198e,0x3a71322f,0x2a0d29ef,0x428f198a,0x3a714b12,0x4af342d2,0x298b4271,0x4a6f298b,0x3a4e424f,0x192a08c9,0x4aaf1949,0x1109320c,0x42704290,0x31ec10e9,0x422f0846,0x533552f5,
-0x19d04b14,0x4b143210,0x53354b35,0x42f44b14,0x4af33a92,0x42d35355,0x00234270,0x18c60002,0x3a2c0003,0x4b335314,0x4b145334,0x32915334,0x42b15333,0x31ad216c,0x110b08c9,0x00044ab0,0x39ab0000,0x5b5373b6,0x7c787416,0x4b137418,0x00033a10,0x73f452cf,0x4a6f3a0d,0x5b537c37,0x426f5b73,0x84787c56,0x7c56192b,0x3210218d,0x7c567416,0x424f73d5,0x00010044,0x100018a1,
-0x63d66bf6,0x5b9663b7,0x7c99118f,0x53133a71,0x296b7c16,0x6b520004,0x08227393,0x21ac0001,0x5b345b53,0x31ee5313,0x00045b32,0x4aaf420c,0x426e31ec,0x00012989,0x00010000,0x08015aac,0x31461022,0x422e18c5,0x52f15b11,0x10ea4271,0x08a708a3,0x4b144af1,0x42d35334,0x2a0e42d2,0x08873a6f,0x190a4ab1,0x00250046,0x194b29ed,0x088742b1,0x086610a5,0x29cc31ec,0x4af131ed,
-0x31ee4270,0x29cd3a6f,0x4ad0194b,0x3a6d0088,0x29ab31ca,0x52f00046,0x4ab01909,0x21ab42b0,0x298a0005,0x00252149,0x08640865,0x29aa2989,0x3a2d0003,0x426f1929,0x10e9298c,0x1969426f,0x3a4e29cc,0x320e29ee,0x3a4f08e9,0x112b322e,0x08ea29ed,0x29ef42d1,0x42d24291,0x3ad342d3,0x3ad33ad3,0x42d342d3,0x42d442d4,0x42d442d4,0x42d442d4,0x3ad442d4,0x3ad33ad3,0x3ad43ad4,
-0x42b442d4,0x3ab33ad4,0x3ad43ab3,0x3ad43ad4,0x3ad442d4,0x3ad442d4,0x3ad33ad4,0x42f43ad3,0x42d442d4,0x42d342d3,0x3ad342d3,0x42f43ad4,0x3ad342b3,0x3a714292,0x21ae4af3,0x2a1042d3,0x112c42d2,0x42914ad2,0x320f196c,0x002742b0,0x32303a91,0x4af34b13,0x3a2e4291,0x212a214a,0x31ee0066,0x296b52b1,0x00041908,0x31ec31cc,0x00255310,0x424e3a2d,0x212910a7,0x53354ad3,
-0x2a525335,0x4b355b54,0x4b354b35,0x53555355,0x53554b14,0x4b145355,0x42f319f0,0x3a4d52f3,0x00210844,0x63742947,0x533442b3,0x3ad25355,0x21ad3a70,0x39ee52f2,0x5b754ab1,0x320c4af2,0x31880003,0x7c3973b6,0x5b7429af,0x73f85b14,0x42af0004,0x3a2f6394,0x298c0047,0x6bb55333,0x4ad152f2,0x7c785312,0x5b3563b5,0x7c565312,0x4ab273f7,0x73f67c37,0x31ee4af3,0x00420001,
-0x4b134af3,0x74386bf7,0x19cf6bf7,0x218d7c9a,0x635252f2,0x00013a0b,0x0001630f,0x42700001,0x52f34291,0x5311192c,0x00255b13,0x4a8e7bd3,0x298a7c35,0x00002989,0x00000000,0x08010842,0x20c4522a,0x5b5339ee,0x4af110ea,0x0003216a,0x535139cb,0x4b1342f2,0x42b042d3,0x00860108,0x31ab10c7,0x63124a4f,0x52d352d3,0x4af24b12,0x00044ad2,0x4a8e2148,0x29ce5311,0x08ca0069,
-0x29ad08ca,0x320e29cc,0x218c4ab0,0x4a914ad1,0x00256353,0x10c93a0d,0x00040006,0x00240005,0x296a0003,0x00030002,0x084420e6,0x00430002,0x3a2c0885,0x00641928,0x00460024,0x006500a7,0x08c70004,0x19691989,0x004521ab,0x42903a2d,0x42b24ad1,0x42b24291,0x3a7129cf,0x3ad33251,0x32924314,0x42d33ab3,0x42d442d4,0x42d442d4,0x42d442d4,0x3ad442d4,0x3ad33ad3,0x3ad43ad4,
-0x42b442d4,0x42d43ad4,0x3ad442d4,0x3ad43ad4,0x3ad442d4,0x3ad442d4,0x3ad33ad4,0x42f442f4,0x42d442d4,0x42d342d3,0x42f442d3,0x42f43ad4,0x42d442d3,0x42b13231,0x3a50218d,0x42b23271,0x3a7108eb,0x42913250,0x218d320f,0x00062a0e,0x3a91196d,0x3a714af3,0x428f218d,0x214a214a,0x4ab1214c,0x002620ea,0x294a4a4e,0x00052109,0x4aad31ea,0x08a829cb,0x000339eb,0x4b144af2,
-0x2a524af4,0x53554af3,0x4b354b14,0x53355355,0x53754b14,0x4b344af3,0x5b3442f3,0x42b35334,0x74144b15,0x00030004,0x53755b94,0x53953a92,0x3a2f4b13,0x4a50216c,0x42d20047,0x08e87478,0x00010825,0x74374a70,0x63745333,0x00044ab2,0x3a736bd3,0x53346395,0x63b55333,0x110a29cd,0x08ca4ad2,0x4ab14291,0x3a4f5b74,0x42716376,0x73f57c57,0x3a505334,0x4af27417,0x63528c99,
-0x53967457,0x6c386c17,0x63f76c38,0x3a713250,0x6bd542d2,0x31aa31cc,0x00010001,0x190a0042,0x21ad4270,0x42707437,0x2169322f,0x3a0d31cb,0x31ca0046,0x00002146,0x10610800,0x20c41042,0x294a52ad,0x216b4a8f,0x10e808c8,0x5b300003,0x428f4acf,0x08e8426f,0x21ab0066,0x53126394,0x531542b2,0x42d35b55,0x4b134b34,0x42b142f3,0x3a4e0067,0x4ad23a4f,0x324f5333,0x4ad242b1,
-0x29cd5313,0x192929ab,0x4a906373,0x31ec3a2e,0x00040003,0x4ab04a6f,0x422c424e,0x4a6c0003,0x00446b6f,0x21480885,0x296a10c7,0x3a2e5b10,0x21ac3a50,0x4a8f3a6f,0x424e0046,0x08a65b31,0x298a426e,0x10c80046,0x42b0324e,0x42b129ee,0x4af33a91,0x3a7142b2,0x3a723a72,0x3a923251,0x3ad32a30,0x3ad342f3,0x42d342d3,0x42d442d3,0x42d442d4,0x42d442d4,0x42d442d4,0x42d442f4,
-0x3ad33ad4,0x3ad43ad4,0x3ad43ad4,0x3ad442d4,0x42f43ad3,0x3ad43ad4,0x3ad33ad4,0x42b342b3,0x42d442d4,0x42d342d3,0x42f342d3,0x42d342f3,0x4ad442d3,0x3a92198e,0x32313a92,0x32512a10,0x4ad342b3,0x320f3230,0x42b242b2,0x5312090a,0x325029ce,0x3a703a71,0x3a2e3a52,0x4a8f31cc,0x212a0045,0x52d152d2,0x31cc426e,0x424e318b,0x00451086,0x31ca2148,0x10c610c7,0x4ad10866,
-0x3a925314,0x533542d3,0x4b145335,0x53765355,0x4b1442d3,0x4b144b35,0x53555355,0x3ab242f3,0x4af34af3,0x00465334,0x3a2c0044,0x4ab35313,0x4ad14291,0x320e4ad1,0x4a900888,0x214a4290,0x0023214a,0x73b26b31,0x10a77415,0x42b14ad0,0x533363b5,0x32515313,0x4af2196c,0x5b532a0d,0x5b53320e,0x4af35b33,0x112b5313,0x637594fa,0x84596355,0x192c8499,0x31ec218c,0x29ab8476,
-0x4b1342af,0x3a925b96,0x63f763f7,0x42d363f7,0x74174b14,0x00024290,0x00010001,0x63720042,0x5b73192a,0x08a95b54,0x3a0b0006,0x29ab0045,0x6bb129ec,0x00000041,0x10620000,0x10a518a3,0x52b1422d,0x5b113a2e,0x00640024,0x29aa52ae,0x0065218a,0x31eb0045,0x5b72424f,0x3a5242b1,0x5b565334,0x53555356,0x3ad24b13,0x198c4312,0x42b029cc,0x196d42b1,0x43134af3,0x42f33291,
-0x29ec42b2,0x08a718e8,0x00040004,0x10c7296a,0x52f1422d,0x426f3a2f,0x0024320d,0x39ea2148,0x3a2d08a5,0x0004424e,0x218b426e,0x322d426e,0x42d129cd,0x0888322f,0x4a9031ed,0x10e8214b,0x08861908,0x216b29ac,0x196c090a,0x21cf0069,0x3a9129ef,0x323142b2,0x3a9342b3,0x32713251,0x42f33ab3,0x42f342f4,0x42d342d3,0x42d442f4,0x42d442d4,0x42d442d4,0x42d442d4,0x3ad442f4,
-0x42f442f4,0x3ad43ad4,0x3ad43ad4,0x42d43ad4,0x3ad442d4,0x3ad442f4,0x42d43ad4,0x42d442d4,0x42d442d4,0x42d342d3,0x42f342d3,0x42d342f4,0x42d442d3,0x3a524ad4,0x42b32a11,0x42f4114e,0x42d442d4,0x42d342f3,0x429242f4,0x3a7042b1,0x21ee4290,0x42d23a70,0x3a0e4292,0x214a296a,0x4a90298b,0x420e31ae,0x18e831cc,0x212a3a0d,0x52d02149,0x084639ec,0x420b0003,0x3a2c0001,
-0x42913a50,0x53544291,0x4b144b13,0x3a924b35,0x3a9242d3,0x4b3542f4,0x53554b34,0x3ab25355,0x4af34af3,0x42d35334,0x00011949,0x531010c4,0x3a2f3a2e,0x3a4f5312,0x216b31cd,0x39ed29ac,0x00440006,0x62f12107,0x73d40047,0x4ad25b53,0x7417218d,0x112d4292,0x63b563b5,0x29ce5b94,0x5b535312,0x63b57416,0x63d64af2,0x00460004,0x29ab0046,0x73d68477,0x6b9173d4,0x7bf20023,
-0x63d663f6,0x6bf75b96,0x63d76bf8,0x6c1863d6,0x194d7c79,0x00015b53,0x08002124,0x426e0000,0x5b753a4f,0x53536395,0x19086bb4,0x4aaf10a6,0x3a0b428f,0x00000000,0x10412924,0x296a2927,0x427052d2,0x00232169,0x4a2c1065,0x00041085,0x422c3189,0x4acf320c,0x3a4f29ed,0x4b3442d2,0x4b145376,0x4b553ad3,0x21cc4af4,0x08c9320d,0x5333426f,0x42b13250,0x32503a91,0x429142d2,
-0x00240045,0x4a8f0844,0x5b124ab0,0x42913a0f,0x322f196c,0x52f24ad2,0x422c29ac,0x002439eb,0x320d39ec,0x322f3a6f,0x10c852d1,0x29ec216a,0x320d194a,0x3a4e218a,0x73b40067,0x322f10ea,0x3a4f3a4f,0x4291320f,0x322f3a70,0x21ce3ab1,0x3a712a0f,0x3ab221ae,0x42d34b14,0x3a9242d3,0x42d33292,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f3,0x42d442f3,0x42d442d4,0x42d442d4,
-0x3ad442f4,0x3ad43ad4,0x42f442f4,0x3ad442d4,0x42f442f4,0x3ad43ad4,0x3ad43ad4,0x3ad33ad4,0x42d442d4,0x42f442f4,0x42f442f4,0x42f442f3,0x42d442d4,0x4af43ab3,0x42d43ab3,0x42f442d4,0x42f442f4,0x42d442d4,0x3a9242f4,0x29ee3a90,0x196c4ad2,0x42d342d2,0x4ab242d2,0x19083a0d,0x52d2424e,0x216b52f1,0x31ac39ed,0x320d39ed,0x4a903a0d,0x3a0f4ab1,0x31cd3a0e,0x00210001,
-0x428f3a2b,0x21ad3a71,0x3a504ad2,0x42d24ab3,0x21cf3270,0x4af43251,0x42f24af4,0x4ad14291,0x4ad042b0,0x0046198b,0x00240005,0x08420002,0x3a4d2989,0x426f426e,0x426f428f,0x5b735b11,0x6b920046,0x528e0043,0x429108a9,0x63b64af2,0x3a500089,0x63954291,0x53535333,0x29cd112b,0x8cb90086,0x52f173f4,0x00260005,0x528e08a7,0x3a0c422c,0x00041929,0x41eb1908,0x10853168,
-0x63d65375,0x53756c18,0x6bf76c18,0x5b955bb6,0x5b356c18,0x000152f2,0x082139a6,0x5b110000,0x3a71426f,0x63b442b1,0x5b10194a,0x428d0001,0x00007c35,0x10410800,0x5aac0820,0x29ec2949,0x212931ee,0x29260001,0x08230824,0x31893169,0x39ec2969,0x3a4d52f1,0x429129ed,0x3ad33ab2,0x32513272,0x42f34b35,0x298a21ad,0x3a4e08e7,0x3a714291,0x42d129ef,0x3ab1114b,0x00040087,
-0x3a0c31cb,0x52f2298a,0x218c3a70,0x3a704af1,0x08ca322f,0x3a6f4291,0x0003320c,0x39eb422c,0x112a52f0,0x4290196c,0x19294270,0x08a72149,0x00454aae,0x29ab10e7,0x31ee10e9,0x42b2322f,0x3a7042b1,0x29ef3230,0x2a0f42b2,0x2a0f3251,0x32302a0f,0x2a1021cf,0x327142f3,0x3a923251,0x42f43ab3,0x42f442f4,0x42f442f4,0x42f342f4,0x42d342f4,0x42d442f3,0x42d442d4,0x42f442d4,
-0x42d442d4,0x3ad442d4,0x42f43ad4,0x42d442d4,0x42f43ad4,0x42d442f4,0x42f442d4,0x42d43ad4,0x42d442d4,0x42f442d4,0x3ad342f4,0x42f442f3,0x42d442d4,0x42d442d4,0x42d442d4,0x42f442f4,0x42f442f4,0x42f442f4,0x325142d4,0x4af242d1,0x3a9129ce,0x4af42a10,0x4af34b14,0x29ac320f,0x42b23a2e,0x4ad15333,0x424f31ed,0x3a0e4a90,0x29cd3a2f,0x4272320f,0x216d4af3,0x214831ec,
-0x00230001,0x00864a6d,0x00030025,0x3a4d5b52,0x533329cd,0x4ad25313,0x639352f2,0x428e0005,0x63935311,0x52d15b53,0x42504a91,0x00044ab0,0x19270023,0x296a422c,0x4a6e3a0c,0x218b422d,0x6b935b11,0x29680005,0x53343a0e,0x5b75110b,0x21ad7c78,0x4b3442f3,0x4ad163b5,0x42905b73,0x31aa420e,0x4a8f3a0d,0x29cd6373,0x422d6352,0x52af6b72,0x08666372,0x7bd352d0,0x73902107,
-0x53545b95,0x5b565356,0x4b145bb7,0x327142f4,0x5b5242f3,0x000129ac,0x08013147,0x426f0000,0x31ef214b,0x194b29ad,0x63513a4f,0x5b0d0064,0x00010001,0x18624229,0x21481083,0x5b2f52ce,0x00010001,0x20e51043,0x39eb4a2c,0x3a0d426e,0x322d31ab,0x21ab29cc,0x4af3324f,0x4b145334,0x3a924b14,0x3ab23251,0x008652f1,0x3a50218d,0x322f42b1,0x4ab121ad,0x00041109,0x428f424e,
-0x21ac196b,0x429031cd,0x42b23a71,0x42b13a92,0x29ee42b2,0x18e8320d,0x2968298a,0x3a2d08a6,0x00c83a4e,0x3a6f3a6e,0x10e810c7,0x10a70003,0x29ab5b10,0x4270298c,0x42d34291,0x3a713a71,0x42b23a71,0x3a913a91,0x29ef4af3,0x2a103a71,0x2a104af3,0x325029f0,0x3a9129ef,0x42d33251,0x42f43ad4,0x42f442d4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,
-0x42d442f4,0x42f442f4,0x42d442f4,0x42d442d4,0x42f442f4,0x3ad442f4,0x42f43ad4,0x3ad442f4,0x42f442f4,0x42f442f4,0x42f43ad4,0x42f442f4,0x42f442f4,0x42f442d4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x29ef42f4,0x21ae3230,0x43143a92,0x3ad33ab2,0x4af442f4,0x42914af3,0x42b221ad,0x3a514af5,0x42723a0e,0x42b14ad3,0x32513a70,0x3ab34b14,0x4af34b14,0x218c322f,
-0x00024a8f,0x39ea0000,0x5b331087,0x3a0f4ab2,0x18e8320d,0x008831cc,0x53334a8f,0x218d216c,0x42924ad3,0x42915b55,0x3a4f42b1,0x42714ad2,0x0041322d,0x39a90843,0x31ab424c,0x192a296c,0x29ac6b93,0x0002190a,0x6b9652f0,0x29f05334,0x5b745334,0x74385b75,0x4b123a70,0x29ac2a0d,0x3a0c0004,0x298d94b7,0x52f24a91,0x4a6f52b1,0x7c348455,0x73f410c7,0x5b116372,0x08658454,
-0x6c187438,0x63d76bf7,0x539542f2,0x21ce3a51,0x08e94ad2,0x18e6ad9b,0x08210801,0x4aae10a3,0x3a2e52f0,0x320d4290,0x7c544af0,0x00210864,0x00000000,0x00004228,0x633052ab,0x00020044,0x524c0843,0x420c4a2c,0x4a8e41eb,0x6373192a,0x3a4f31ed,0x3a2e320d,0x53345333,0x3a914b13,0x4ad329ef,0x3a505334,0x53100004,0x3a4f5b73,0x320d3a90,0x00035311,0x5af00886,0x29cd194b,
-0x320e320e,0x53544af2,0x42d23a91,0x42912a10,0x4ad129ce,0x426e0025,0x08651908,0x428f29ab,0x3a4d08c7,0x000310c9,0x296b2969,0x29cd4a6f,0x3a0d29ac,0x320e08a9,0x4b143230,0x32504af3,0x3a713250,0x4b133ab1,0x3a9221cf,0x3a7142d3,0x32514af3,0x42b23230,0x42b242b2,0x3ab22a30,0x3ab33ad3,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,
-0x42f442f4,0x42f442f4,0x3ad43ad4,0x42f442d4,0x42f442f4,0x42f442d4,0x42d442d4,0x42d442d4,0x42d442d4,0x42f442f4,0x3ad342f4,0x42f442d4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x2a0f42f4,0x32503251,0x43143a91,0x42d33292,0x4af44af4,0x320f4af3,0x4af33a4f,0x4b144af4,0x4b153ab2,0x53345315,0x4b143251,0x4b155335,0x42b24b14,0x52f14290,
-0x08a63a6e,0x00010002,0x3a2d4a6b,0x52b152d1,0x3a714a71,0x00ab5355,0x4b334ad3,0x42924272,0x5333320f,0x218d5313,0x4270196c,0x42b14291,0x29ac3a6f,0x00010004,0x21081083,0x424e4a6d,0x4ab05b12,0x0003426e,0x5b3331aa,0x4b146bb6,0x325021ce,0x6bf642b1,0x5b525312,0x08650064,0x84369cf9,0x73d4426e,0x9d3b1909,0x4a906bb4,0x84350025,0x5b0f2989,0x00030045,0x00030001,
-0x5b957c99,0x63d663b6,0x4ad25333,0x6bd63a70,0x298c3a50,0x5af00004,0x08000001,0x84762967,0x4a8f31ec,0x4af04af1,0x31885b72,0x00000822,0x10830021,0x10420000,0x08620000,0x10c93a0b,0x6353424f,0x52af5290,0x298b0004,0x31ec3a2e,0x21ac426f,0x4af24ad0,0x090c4b33,0x42d2198e,0x3a725354,0x00253ab2,0x428f3a4d,0x5b754b32,0x00441947,0x42af0002,0x3a6f08ea,0x3a7142d1,
-0x42903a70,0x3a4f3a70,0x3ad23270,0x42b24313,0x00034af1,0x4aae3a4f,0x39eb3a2c,0x426d31cb,0x00040024,0x08ca218c,0x32100049,0x42d34292,0x4af342d4,0x429129ef,0x19ac3a71,0x3a71326f,0x3a702a0f,0x3a702a0f,0x325042d2,0x3a923a71,0x42d33271,0x3a9242f4,0x32723251,0x3ab23271,0x3a9342f4,0x431442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x431442f4,0x42f442f4,
-0x42d442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x431442d4,0x42f442f4,0x42f442d4,0x3ad442f4,0x42f442d4,0x42f442f4,0x42f442d4,0x42f442f4,0x42f442f4,0x42f442f4,0x431442f4,0x42f442f4,0x42f442f4,0x42d342d4,0x32704b34,0x43143af3,0x43144314,0x42b34af4,0x42b242d2,0x429142d2,0x4b1442f3,0x4b153a93,0x43144b35,0x4b355375,0x42f44af4,0x4ad23a52,0x320e4291,
-0x214a298b,0x31aa52d0,0x63500003,0x31ab18e8,0x31ce298b,0x3a7152f3,0x42d35b34,0x5b755b75,0x3ab24b15,0x42b100ca,0x29ad42d1,0x4ad13a2e,0x426f4290,0x29ab3a0d,0x00010002,0x424e41ea,0x4ad25b74,0x21293a6c,0x420a0823,0x4b145b54,0x3ab142b1,0x428e5332,0x10a67bd4,0x298b39ed,0x6b756b74,0x6b956b95,0x296a4251,0x00252988,0x00020000,0x000110a4,0x31cb10c6,0x8c765a8d,
-0x535663b7,0x5b965b95,0x63b663d6,0x7c796395,0x52f25334,0x422b73b4,0x08210001,0x428f31c9,0x29cc5b32,0x3a4d216b,0x000231eb,0x00000802,0x08424a29,0x08010800,0x63521064,0x3a0e10ca,0x5b323a2f,0x2128422e,0x31cc1907,0x29cc3a2e,0x3a6f298b,0x42f2426f,0x198d21ee,0x42d229ef,0x42b24af2,0x00862a0e,0x19695b11,0x10e80024,0x18e70002,0x29ed0065,0x429029cd,0x4ad26bf6,
-0x322e21ad,0x3a6f4290,0x08ea112b,0x194b21cd,0x5b100004,0x10a63a0d,0x00045aef,0x426d0044,0x4ad0422d,0x42b25333,0x42b24b13,0x4b1442d2,0x3a913a72,0x3a504af3,0x324e4ad2,0x21ae2a0e,0x3a9142d2,0x2a0f3250,0x4af33a91,0x3a923a71,0x42d342f3,0x4b1442d3,0x3a923ab3,0x3ab23ab2,0x43144315,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x431442f4,0x42f442f4,
-0x42d442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f43ad3,0x42f442d4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442d4,0x42f442f4,0x42f44314,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42d33272,0x4af34b14,0x431421f0,0x43144314,0x42b34af4,0x4af342b2,0x3a715313,0x4b354b14,0x4b3542d4,0x4b144b35,0x4b352a31,0x42f34b14,0x4af24b13,0x00883230,
-0x3a2e428f,0x3a2d426f,0x00021928,0x4a6e31cb,0x39ee10c8,0x3a304250,0x4b146375,0x53345b76,0x3ab242d4,0x53545375,0x63b55334,0x53320006,0x52f231ee,0x3a2d320e,0x18c60065,0x19060021,0x635352f0,0x4aaf42af,0x41ea0003,0x63955b32,0x42905333,0x1908196a,0x318b52af,0x39ed296b,0x10a80005,0x52b110a8,0x00034ab0,0x6bb30003,0x00240024,0xa5382148,0x73b63a2e,0x31ae190a,
-0x63f500c8,0x63d66c17,0x74376bf6,0x84997437,0x42d28cfb,0x00424af1,0x08430001,0x5b746bb1,0x29ee3a70,0x00a7322e,0x10220003,0x10411842,0x08010800,0x29051022,0x4ab0424c,0x4ab1322e,0x637352d1,0x088510a7,0x635210c7,0x31ed428f,0x42b029cc,0x324f3a4f,0x4b1242d2,0x3a903a90,0x0025324f,0x218a0025,0x1907420e,0x00200043,0x318818a6,0x3a503a6e,0x29ed21ab,0x3a7129cd,
-0x3a6f21ad,0x320e2a0e,0x5332218c,0x0005194b,0x00050003,0x08230003,0x00450844,0x5b300003,0x42b24290,0x42d33a91,0x42d23ab2,0x42b342f3,0x3a503a91,0x42d13a50,0x21cc21ac,0x322f196c,0x3a9142b1,0x42b12a0f,0x2a0f3230,0x327142d2,0x3ab342d3,0x42f442f4,0x4af442b3,0x42f33a92,0x431442f4,0x431442f4,0x42f442f4,0x431542f4,0x431442f4,0x42f442f4,0x42f442f4,0x42f442f4,
-0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442d4,0x42f442f4,0x42d442f4,0x42f442d4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x3a713a93,0x4af43ab2,0x4314096f,0x43144314,0x2a313ab3,0x3a713251,0x3a705313,0x4b353ab2,0x4b354b35,0x4b344b35,0x43133271,0x21ce42d2,0x00273a70,0x4af15b74,
-0x42b142b1,0x320e3a70,0x0002218b,0x5af00063,0x084752d0,0x29ad4a70,0x53553a50,0x5b964b14,0x3a7142d4,0x53554b34,0x42d25335,0x21ad29ee,0x4af35b33,0x198c3a70,0x39ec6373,0x000329a9,0x84361883,0x3a4e4af2,0x08034aae,0x73f68455,0x5b325b53,0x635031cb,0x31ac0865,0x4a8f3a0d,0x73d473f4,0x08476332,0x3a2b2148,0x94f78455,0x73f673d7,0x94d831ec,0x63b57416,0x19095b93,
-0x74577c78,0x00895313,0x5b750088,0x63d76c17,0x63953a91,0x000142cf,0x20c510a3,0x422f39ea,0x5b734ab1,0x08646373,0x10830842,0x08000002,0x10430001,0x633020c7,0x427010e8,0x29ad29cd,0x31cd3a0e,0x21495b10,0x08872969,0x216a0025,0x3a2f5b11,0x218c08e9,0x5b5342b0,0x112b5333,0x000452f1,0x00034a6e,0x00012168,0x29260000,0x10862927,0x3a2d0004,0x3a6f426f,0x320e3a2e,
-0x3a4f4ad1,0x00464ad0,0x00040005,0x4a6e0024,0x31eb6331,0x10a610a6,0x216b422d,0x5311428f,0x4ad35352,0x5b940006,0x21ce42f3,0x42f23250,0x21cd3290,0x194c29ee,0x322e3a4f,0x3a71320e,0x320f322f,0x3a7029ee,0x2a1029ef,0x3ab242b2,0x4b144af4,0x42f442d3,0x42f43ab3,0x32724314,0x431442f4,0x42f44315,0x43144314,0x431442f4,0x431442f4,0x431542f4,0x42f442f4,0x42f442f4,
-0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x431442f4,0x42f44314,0x42f442f4,0x42f442f4,0x431442f4,0x42d442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x43154315,0x42d33272,0x4b144b14,0x42f44af4,0x42f442b3,0x3a913231,0x42d34b14,0x42b14ad3,0x42d4324f,0x4b144b35,0x43144b14,0x4ad12a10,0x29ee29cd,0x42f2324f,0x3a914b13,
-0x29ce3a70,0x3a704af2,0x29eb3a6f,0x21070000,0x4a9052d0,0x424f0005,0x533452f2,0x4b145b76,0x42d34b34,0x3ab23ab2,0x4b143a92,0x63b53ab2,0x08ca3a50,0x218c5b53,0x52b0214a,0x841429ac,0x00020001,0x4a8e29a9,0x000231cd,0x7bf418c6,0x110b4ad1,0x3a0d6b93,0x6b7239ec,0x1087298b,0x7c1618ea,0x5b3210a8,0x00025af2,0x29ce52d1,0x5b335313,0x218d6bf6,0x5b747436,0x088808c9,
-0x6bf742f4,0x74187458,0x7c1673f8,0x6c170007,0x52f263d7,0x10840002,0x08020000,0x0045422b,0x5b555332,0x10220044,0x21670801,0x28e310a4,0x420b0801,0x00475b53,0x004631ed,0x320d5331,0x00044aaf,0x29690865,0x4a8e10a7,0x298b216a,0x29cc29ab,0x322d196a,0x2a0d5311,0x3a6e3a8f,0x00030003,0x004352ce,0x00000000,0x00010001,0x420b0823,0x4a8e3a2d,0x53100044,0x196a0066,
-0x00660005,0x000429ab,0x00041906,0x4ad25ad2,0x08c83a91,0x4a8f216b,0x42b2110a,0x42b242b2,0x4af242d1,0x3a6f3a50,0x322f29cd,0x42905b53,0x1109320d,0x29cc322e,0x42d1320e,0x3a504290,0x320f29ee,0x21ce2a0f,0x4af33a92,0x4b1342d2,0x42d342f4,0x43144af4,0x431442f4,0x431442f4,0x42f442f4,0x43144314,0x43144314,0x42f442f4,0x431442f4,0x42f442f4,0x42f44314,0x42f442f4,
-0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f44314,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x43144314,0x4af44314,0x4af44af4,0x4b154af4,0x42f44b15,0x42b142d3,0x4ad34af3,0x29ab214b,0x3a9221cc,0x4b354b54,0x3a714b14,0x31cd216c,0x4a90192a,0x42b1320e,0x2a0f3230,
-0x4af34291,0x218d42b1,0x2a2e42b1,0x000108c7,0x4a8f0022,0x004652b0,0x42b1426f,0x42b35334,0x4b144af3,0x4b144b34,0x5bb65375,0x53345376,0x637421ae,0x112a3a70,0x3a0d296b,0x6b7442b0,0x00040068,0x08420000,0x0024630e,0x31cc0022,0x21ad3a4f,0x63324a70,0x52f15b32,0x08a83a2e,0x212a4aaf,0x7c587c15,0x6bb429ac,0x63956394,0x6bf65b33,0x7c777437,0x5b940089,0x428f0887,
-0x6c385b96,0x6bf76c18,0x6bf66c17,0x00268c79,0x7c5663b7,0xbdd90001,0x08421043,0x4ab018e9,0x114929ae,0x18c41062,0x29464a4c,0x18a31001,0x4a6f18c3,0x216b18eb,0x4a8f298b,0x6bf50025,0x10c629cb,0x29681065,0x0003298a,0x426e194a,0x29ab31ec,0x3a4e424e,0x4aaf218b,0x000208a6,0x31ea4a8c,0x00000002,0x20c418a3,0x528d20e4,0x31cb52b0,0x428f5b72,0x000231e9,0x39eb0024,
-0x42b05b32,0x4ab052f3,0x4ad20865,0x4ad34b35,0x006652f2,0x194a424e,0x4af229ee,0x3a703a70,0x3a902a0e,0x3a503a90,0x5b545312,0x29cc112b,0x52d008c8,0x2a0e3a0e,0x3a714290,0x326f3250,0x198d00ea,0x42b14291,0x32503250,0x4b1442b2,0x4b1442d3,0x3ab24b14,0x3ab33ab3,0x43154315,0x43144315,0x43144314,0x42f44b15,0x43144af4,0x4af44314,0x43144af4,0x42f442f4,0x42f44314,
-0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x43143ad4,0x431442f4,0x42f442f4,0x42f442f4,0x3ad442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f44315,0x42f442f4,0x431542f4,0x42f44314,0x43144314,0x4b154315,0x42f442f4,0x19ad3210,0x4b143230,0x427052f3,0x4ab24250,0x4ad32a30,0x53144b14,0x4a8f3a2e,0x3a2e10e9,0x3a4f320e,0x3230322f,
-0x325142b2,0x21ee42d3,0x4b124af2,0x08c72a0e,0x428f0000,0x42904ad3,0x00464270,0x42b25b53,0x53345353,0x42b242b2,0x5b954b13,0x5b764313,0x4ab25b76,0x29ee5313,0x0868110b,0x5b5442b0,0x4ad16396,0x00420066,0x5acc0841,0x31880001,0x6bd45af2,0x5b524a90,0x4ab15b13,0x008742b1,0x214a6372,0x94da08a7,0x73d40004,0x6c186395,0x3a903a70,0x4b148498,0x298c3a4f,0x845694f9,
-0x63f763b6,0x53555b96,0x63d75334,0xbe3f6395,0x00430003,0x4a2c2127,0x31cb0822,0x4ad16b95,0x00632168,0x8cf90001,0x0822422c,0x528c1883,0x5af32969,0x52d1218d,0x6bb3298c,0x214a214a,0x31c90885,0x10842106,0x422b0022,0x31cb2128,0x4ad04a8e,0x422c428e,0x192710c7,0x00000042,0x00000000,0x4a292925,0x31871083,0x00023168,0x00021908,0x00230004,0x42090001,0x31891084,
-0x29ed3a2e,0x00460909,0x4b144b13,0x4ad24af4,0x426f0047,0x53113a0e,0x42b042b0,0x42b0324e,0x322f322e,0x322f29ee,0x42b142b2,0x320d3a6e,0x29cc08e8,0x429042b0,0x29ad3a70,0x196a29cd,0x31ee320d,0x3a903a70,0x3a713a91,0x42d342d3,0x3a9242f3,0x42f43251,0x42f44314,0x43154b15,0x43154315,0x43144315,0x4af44af4,0x43144af4,0x4af44314,0x431442f4,0x42f442f4,0x43144314,
-0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x431442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x43144314,0x431542f4,0x43144314,0x4af44b15,0x4af54b15,0x3a914b14,0x4af33250,0x3a5052f3,0x320f4ab1,0x42d221cf,0x42925333,0x31cd4ab0,0x3a2f216c,0x322f21ad,0x32304b12,
-0x4af35335,0x3a715334,0x42d34b13,0x29ae3a91,0x000200a6,0x29ed212a,0x637331ee,0x00661108,0x4af25b74,0x31ee4ad3,0x4af34ab1,0x4af45334,0x42f45b96,0x327142f3,0x42b1116d,0x08c90069,0x63967c98,0x29ee5b56,0x08220084,0x08010001,0x52f1422b,0x298b52d1,0x4ab052f1,0x00664ad0,0x8c7518e7,0x4ab07bf3,0x63732129,0x74387437,0x090a114c,0x63714ace,0x18eb6b94,0x424f73f6,
-0x6bf763d7,0x6c185b95,0x74396c16,0x6bf77457,0x00201088,0x08858cb6,0x84560802,0x426d7437,0x084220c4,0x214718a4,0x08230021,0x5b322147,0x52f4adb9,0x3a706375,0x428f31cc,0x10a5320e,0x29870043,0x18e50864,0x00000021,0x528d31aa,0x10c61907,0x52ce0045,0x18a43a2c,0x00000000,0x08230001,0x00011043,0x00010001,0x00030003,0x31a90003,0x635110c5,0x2949630f,0x6b100000,
-0x63524ab1,0x3a0c1085,0x004510c8,0x08860003,0x73d43a2c,0x639373b4,0x428f3a2f,0x3a4e08e8,0x429021ad,0x21ad3250,0x3a4f3230,0x3a4f090a,0x29ed4af1,0x008742b0,0x006629cc,0x424e298b,0x19ad21ac,0x19ad3a90,0x21cd3a90,0x3a9121ce,0x32713a71,0x42d342d3,0x42f442d3,0x4b154314,0x43144315,0x43154b15,0x43154315,0x43144315,0x42f44314,0x431442f4,0x43144314,0x4af44af4,
-0x42f442f4,0x42f44314,0x431442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f442f4,0x42f44314,0x42f442f4,0x42f442f4,0x42f44314,0x431442f4,0x43144314,0x42f44315,0x42f44314,0x431542f4,0x43144314,0x4b134af4,0x21ac4af4,0x218d4ad2,0x29ad52f3,0x29ee42b0,0x4ad34b33,0x4ab14ad2,0x4ab14291,0x18ea4a70,0x42f329cd,
-0x42f44b14,0x42f44af4,0x42b24b14,0x6bf74b14,0x0001216c,0x425052ac,0x4af34b32,0x53113a4f,0x52f10085,0x298c5af2,0x4ab13a2d,0x4af44af3,0x4b145b75,0x4b354b14,0x53743ad2,0x4af24ad3,0x3a713a50,0x63955b75,0x00036396,0x10221002,0x528d3166,0x3a4d52d0,0x422d4a6e,0x1909320c,0x52b0422e,0x63548c77,0x31ee73d5,0x74376394,0x5b767c77,0x29890023,0x94557bd3,0x6353296c,
-0x3a735b56,0x6c177458,0x5b956c17,0x6bf663d6,0x10a70002,0x18c57c16,0x73d60002,0x08826bb5,0x7c321081,0x208373b2,0x00420000,0x00652969,0x6bd773f4,0x4ad35b75,0x4ab031cf,0x39880004,0x08410001,0x00000001,0x29053167,0x62ec8410,0x31a71082,0x00222106,0x00000001,0x00220001,0x39c90842,0x10a52968,0x29891906,0x3a0c5af0,0x3a2e298a,0x2a0d424f,0x528d52d0,0x31a9528e,
-0x18c80025,0x4af45af3,0x53545354,0x424e42d2,0x5331426e,0x4af06393,0x298b4af0,0x00050004,0x29ab216a,0x19290087,0x112a42af,0x31ed110b,0x3a4e21ac,0x110808c8,0x08a829ab,0x218b3a2e,0x112a216b,0x3a4e428f,0x3a4f322e,0x3a923a50,0x3a923a91,0x4b143ab2,0x4b3542d3,0x4b354b35,0x43154b35,0x4b354315,0x43154315,0x4b3542f4,0x43154314,0x43144314,0x43154315,0x4af44af5,
-0x42f442f4,0x42f442f4,0x42f442f4,0x42f44314,0x42f442f4,0x431542f4,0x431442f4,0x42f442f4,0x42f44af4,0x42f44314,0x42f442f4,0x42f442f4,0x43144314,0x42f442f4,0x431442f4,0x4b354314,0x42f44314,0x43144314,0x43144315,0x43144314,0x43154315,0x42d442f4,0x42d242d3,0x4b134af3,0x3a2f4290,0x21ad5333,0x3a0e218b,0x4ad23a70,0x4af35334,0x3a714ad3,0x4291322f,0x42d33230,
-0x4b354b35,0x42f44b35,0x42d342d3,0x5b723a92,0x000108c7,0x41ec0000,0x53154250,0x3a704ab2,0x00661108,0x29490005,0x298c18c8,0x5b554270,0x5bb75b96,0x4b145bb7,0x42d363f7,0x32713a92,0x112b4b33,0x7c376bd4,0x63975b74,0x10644af0,0x29061042,0x52ce4a6c,0x39cb2148,0x3a0c31eb,0x424f4a90,0x42704a8f,0x5b548458,0x00077c37,0x216f84b9,0x00036bd5,0x94963968,0x5ad1424d,
-0x63d56c36,0x63d66bf7,0x5b955335,0x114a63d6,0x7bf40021,0x10632149,0x52f16b70,0x108310e6,0x42705a8b,0x18a218a2,0x00001001,0x002339ec,0x63d67c57,0x6bd57458,0x086729ac,0x08220866,0x08000000,0x00000801,0x10220801,0x00010001,0x00000001,0x00000001,0x42291082,0x84134a6b,0x422e39ec,0x4a4c0024,0x424d29a8,0x3a2e426e,0x3a2e31ed,0x4a6e29ac,0x424b4a2c,0x000252b0,
-0x0004422b,0x0049110b,0x53134ad2,0x192a5b34,0x42d231cd,0x42925335,0x31aa4ab1,0x4a6d0886,0x6bb22148,0x4aae08a6,0x21ac0907,0x322e08eb,0x320c196b,0x08861149,0x4a8f2149,0x194a3a2e,0x3a2e214a,0x426e426e,0x3a2e3a4d,0x21cf29ad,0x42f34af3,0x42f44b14,0x4b144b35,0x4b354b35,0x431542f4,0x4b354315,0x43154315,0x4b354b15,0x43154b35,0x43144314,0x43154315,0x4af44af5,
-0x42f442f4,0x431542f4,0x42f44315,0x42f44314,0x42f442f4,0x431542f4,0x431442f4,0x42f442f4,0x42f44af4,0x42f44314,0x42f442f4,0x42f442f4,0x43144314,0x42f442f4,0x431442f4,0x42d44314,0x42f44314,0x43144314,0x43144315,0x4b354314,0x43154315,0x43144b35,0x3a9129f0,0x42b23a50,0x42913a2f,0x4290320f,0x298b3a6f,0x2a0e52f2,0x4b1452f5,0x3a725335,0x32503a71,0x535552f4,
-0x4b354b14,0x4b354b35,0x3ab24b35,0x29cd3251,0x00014ab0,0x10020000,0x29ee73b3,0x3a4e4290,0x3a2d196b,0x00042989,0x39cc0843,0x531452d1,0x5b964b14,0x5bb763d7,0x42d45bb7,0x32715bb8,0x08e9220f,0x322f3a0c,0x5b320067,0x10a65333,0x18421041,0x528c2925,0x5b0f39ea,0x318a2968,0x4a6f212a,0x52d16332,0x112b52d2,0x7c5963b5,0x4ab45333,0x5bb57c38,0x30e50865,0x39ac31a9,
-0x74177c58,0x3ad27416,0x74374b13,0x00025314,0x41eb0001,0x10410822,0x10237bb2,0x10851042,0x30c352cf,0x30e328c1,0x18a54a2a,0x08441064,0x00440065,0x00440023,0x08640802,0x08010843,0x00001062,0x10630001,0x83d218a4,0x000139a7,0x00010801,0x39ca2947,0x296939ea,0x422b2128,0x214931cc,0x19084a8d,0x52d031cb,0x4ad242b1,0x4ab03a51,0x1907424e,0x420b31a9,0x4a6f31cb,
-0x29ce5b33,0x5b530024,0x63d55355,0x53120067,0x42b14ad1,0x42b14b13,0x31ab426f,0x212939ec,0x298b0004,0x31cc192a,0x53323a4d,0x08a61108,0x1909320b,0x4acf0004,0x4ab0216a,0x5b10216a,0x218c31cc,0x194b08c9,0x21cd21ac,0x4af33250,0x42f44ad4,0x4b354b14,0x4b354b35,0x4b354b35,0x4b154b15,0x43154315,0x43144314,0x43144315,0x43154314,0x43154315,0x43154315,0x43154315,
-0x431442f4,0x43144314,0x43144314,0x431442f4,0x42f442f4,0x42f442f4,0x431442f4,0x42f442f4,0x42f44314,0x42f44314,0x42f44314,0x43144314,0x431542f4,0x42f442f4,0x42f442d4,0x431542f4,0x431442f4,0x431542f4,0x4b354314,0x4b154314,0x42f44315,0x3ab242f4,0x21cd42b2,0x53344ad2,0x42d34b15,0x3a2f3a71,0x296b52f2,0x52b0212a,0x3a92320e,0x4b1442d4,0x32103230,0x4b144af3,
-0x4b354b35,0x42f45355,0x42d23a92,0x4af342d2,0x323129ee,0x0003198a,0x10840001,0x31cc10c5,0x5b134aaf,0x08453a2e,0x29692907,0x5b3110c7,0x52d3426f,0x5b9763b7,0x5bd742f4,0x5bb65376,0x320f5b75,0x0005110a,0x39ee4a90,0x6bd54270,0x00000002,0x18820800,0x39a820c4,0x4a4d31ca,0x63310845,0x426f3a2d,0x31cd194b,0x74174270,0x63b66bf7,0x8cfa112b,0x08654af1,0x39471001,
-0x42b27438,0x3ab27416,0x63b65354,0x0001320d,0x20a40000,0x7bd11882,0x10000002,0x20e40800,0x28a120c2,0x20a23944,0x18441023,0x084320a4,0x73d37bf2,0x52cf8c96,0x5b0e94b6,0x0000528c,0x08220801,0x62ed0001,0x318b6310,0x20c40000,0x31ea3987,0x4a6e52cf,0x296a31cb,0x29490845,0x52ef10c7,0x52ae10e7,0x4270320d,0x31ee5333,0x298c320d,0x422b2149,0x10630063,0x4ad152f0,
-0x3a503a70,0x00a84251,0x10c95313,0x00896b93,0x4b3352f2,0x5b535333,0x3a0c0066,0x29ab2129,0x52d052f1,0x29ce52f2,0x08e94af1,0x10e70064,0x1908296a,0x3a0d31cc,0x192a1929,0x08c708a7,0x29cd10c8,0x3a2e3a6f,0x21ac4af1,0x4af35313,0x42f442d4,0x43154b14,0x43144b35,0x4b354b15,0x4b354b15,0x4b354b35,0x4b154b15,0x4b154315,0x4b154315,0x4b354315,0x43154315,0x4b154315,
-0x431442f4,0x43144314,0x43144314,0x43144314,0x42f442f4,0x431442f4,0x43144314,0x42f44314,0x42f442f4,0x43144314,0x42f44314,0x431442f4,0x43144314,0x42f44314,0x42f44314,0x43144315,0x42f44314,0x43154315,0x43144315,0x43154315,0x4b154314,0x42d342f4,0x4b124291,0x4b342a0f,0x4af34af4,0x322f3250,0x424e214b,0x294b4a8f,0x4af4296c,0x4ad45335,0x32103a71,0x32724b13,
-0x53555355,0x42d34b14,0x32503ab2,0x53134af3,0x42513230,0x4ab33a4f,0x00027c57,0x00010002,0x298b2167,0x18e7296b,0x21480002,0x210839eb,0x004510a6,0x53134aaf,0x5bd64b55,0x53545bb7,0x531442f2,0x63554ad3,0x428e0887,0x533273f6,0x000052f0,0x08200800,0x524a0800,0x000339c9,0x39cb18a6,0x5b123a2d,0x5b125333,0x5b534250,0x537463b5,0x63b56bf7,0x6352216c,0x10844a8d,
-0x4af27c98,0x5b545b74,0x7c985313,0x18830001,0x20a20000,0x20810800,0x18201020,0x28a049c6,0x28a230e1,0x528d2081,0x6373420b,0x00034a8e,0x6bf73a6f,0x63b54292,0x18c80005,0x000218c8,0x736f0002,0x4a4b2105,0x00020001,0x52ce0001,0x424e4a90,0x4aaf4aaf,0x31aa1908,0x31aa1907,0x5b0f2148,0x296a0887,0x4ab04290,0x4ad0322e,0x52ef2129,0x10a42107,0x5b3039c9,0x4af23a30,
-0x53134291,0x08873a10,0x31cc3a4e,0x531352b0,0x198c3230,0x08e829cd,0x31893a4d,0x4ab24aaf,0x320f3a4f,0x11294ad1,0x19290004,0x004510e7,0x426e212a,0x192a426e,0x088710e8,0x216a31cc,0x426f0887,0x320e322e,0x3a4f29cc,0x3ad23270,0x4b354b35,0x4b154b15,0x4b154b35,0x4b354b15,0x4b354b35,0x4b154b35,0x4b154b15,0x4b354b35,0x43154314,0x43154b35,0x4b354315,0x4b154b15,
-0x42f44314,0x431442f4,0x42f44314,0x42f442d4,0x431442f4,0x43144314,0x43144314,0x431442f4,0x43144314,0x42f442f4,0x42f442f4,0x43144314,0x43154315,0x43154314,0x43144314,0x43144314,0x43144315,0x43144314,0x43144b15,0x43144b15,0x4b154315,0x3ab24af4,0x3a5042b1,0x4b144ad2,0x4b144af4,0x53134b34,0x3a0e31ed,0x39ec39ee,0x00ca52af,0x4b145334,0x4af3320f,0x53554af3,
-0x42d342d3,0x42b342b3,0x42d23a92,0x42b24b13,0x3a2e4af2,0x3a2e4290,0x11096374,0x00220886,0x52ac0000,0x4a9231ac,0x21291109,0x298a8415,0x00030885,0x192818e7,0x53545b11,0x4af44b34,0x53334af3,0x4ad35333,0x5b114af2,0x5b13424f,0x190952f1,0x18820000,0x18610800,0x62d09cb4,0x210818a7,0x52af39cb,0x53116333,0x6bb54ad1,0x53327c57,0x53344ad3,0x08a75b74,0x73b23a0c,
-0x3a50322f,0x3a706bd5,0x00246395,0x7baf0001,0x18600821,0x20811040,0x28a01020,0x31013102,0x49a530e2,0x5b126b0e,0x84ba5b53,0x0003296a,0x5314a59b,0x5b745b54,0x4a904a90,0x00033a0e,0x00012967,0x00020002,0x62ee0022,0x4ab00887,0x52f13a4f,0x29893a4c,0x0044528e,0x212831aa,0x422d6371,0x21284aae,0x088731cc,0x298a0004,0x422b3189,0x31280001,0x424f4aaf,0x2a2e42b2,
-0x4af33a91,0x5b1021ae,0x4ab00045,0x29ed4291,0x09095332,0x216a1949,0x52ae6b71,0x216d52d0,0x00050087,0x52f05b10,0x31ed52f0,0x422e0067,0x31cd31ac,0x4a9131ed,0x52f1426f,0x426f10c9,0x29cd29ad,0x3a2e42b0,0x29cd218b,0x3ab23250,0x42d44314,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b15,0x4b154b15,0x43144b15,0x4b154b35,0x4b354b35,0x43154315,0x43154315,
-0x43144315,0x43154b15,0x42d442f4,0x42f442f4,0x43154314,0x43144314,0x43144314,0x431442f4,0x43144314,0x42f44314,0x42f442f4,0x42f44314,0x43144314,0x43154314,0x42f442f4,0x431442f4,0x43144315,0x43144314,0x43154b15,0x4b154314,0x4b154315,0x3a9142d3,0x53333a50,0x2a0e42b1,0x3a5029ce,0x4ad242d3,0x31cd322d,0x39ec31cd,0x4ab0318b,0x4ab1218c,0x320e4af2,0x42d23a91,
-0x4b1342f3,0x42d242f3,0x32503a71,0x29ce42b1,0x192a426f,0x29ac214b,0x1108110a,0x3a2e3a2e,0x00010004,0x39ed0844,0x63116352,0x4aae6332,0x29aa52f0,0x08643a0b,0x18e70002,0x53125b31,0x5b744b12,0x3a714292,0x00474af2,0x10ea4ab0,0x4ad052f1,0x18620002,0x08000800,0xa4d62083,0x296a2969,0x63315aef,0x5b310847,0x4a7073f5,0x63d58498,0x5b746395,0x63747437,0x422c10c7,
-0x73f55312,0x6372424f,0x004373f4,0x41aa4a6b,0x18401880,0x10002080,0x28c120a0,0x31023121,0x41c93944,0x42b16372,0x190a42b2,0x4a8c0021,0x63958436,0x00053210,0x5b343a2e,0x632e0065,0x00030002,0x7bd30844,0x5b114ab0,0x10c91109,0x5b51214b,0x18c618e7,0x39ca18a5,0x5b315b10,0x212939ec,0x39cc4a6e,0x0865296b,0x420b1086,0x082231a9,0x298818c5,0x324f424f,0x4ad242b1,
-0x2a0f42b1,0x0845110a,0x0025424c,0x000410e9,0x00020064,0x6b700002,0x08455aee,0x5b311907,0x52f06372,0x3a0e424e,0x5311426f,0x192929cd,0x63934aaf,0x4ad20067,0x3a0e4af1,0x5b123a2e,0x3a2f29ad,0x29ad218d,0x29cd194a,0x42f23ab1,0x42d44b14,0x431542f4,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b15,0x4b354b35,0x4b354b35,0x4b354b15,0x4b354b35,0x4b354b35,0x4b354b15,
-0x43144314,0x431442f4,0x42f442f4,0x42f442d4,0x43154314,0x43144314,0x43144314,0x43144315,0x4b1542f4,0x43154315,0x431442f4,0x43144315,0x43144315,0x43144315,0x43154314,0x43144314,0x431442f4,0x43144314,0x43154315,0x4b154315,0x4b154315,0x43144b35,0x531352f3,0x4ad121ae,0x31ed426f,0x428f3a50,0x4ad04ab1,0x52d13a50,0x29cc29ac,0x216b52f1,0x42903a4f,0x29ee324f,
-0x322f320e,0x3a904ad1,0x31ed4af1,0x5af13a2d,0x10c7298b,0x18e910c7,0x6374426f,0x298c3a2f,0x21484290,0x08230001,0x422c7bb1,0x002429cb,0x000110e7,0x00030002,0x08012106,0x18e50001,0x52af6b70,0x42913a30,0x429152f2,0x298a10c9,0x4a8e426f,0x086439ec,0x08202104,0x28e41842,0x08021883,0x63107371,0x5b305af0,0x08674a6f,0x7c358476,0x7c35320e,0x31ef6bd6,0x0046190a,
-0x322d8477,0x73d35b11,0x08430002,0x082252ac,0x20801840,0x206020a0,0x394328c0,0x41e73923,0x52af4a09,0x533252f1,0x7c3642b1,0x31ca0884,0x6bf773b6,0x4ad16bd7,0x39ec29ee,0x00001904,0x29470001,0x6b73422d,0x5b3252d1,0x63524270,0x00032149,0x18852108,0x20e70803,0x29ab31ab,0x29490886,0x214939eb,0x29682989,0x318939eb,0x29680023,0x424e420c,0x42b14270,0x322f4af2,
-0x29ce4ad2,0x00030023,0x10a42989,0x08221926,0x29670021,0x296839e9,0x2928630f,0x3a0c52ae,0x5b31424e,0x6b9431cc,0x42904290,0x429029cd,0x216b322e,0x218d320f,0x298c3a6f,0x216b29ac,0x4290192b,0x3a6f29ce,0x320e4270,0x2a0e4af3,0x2a313230,0x4b3542f4,0x4b554b35,0x4b354b35,0x4b354b35,0x4b354b35,0x43154b35,0x4b354b55,0x4b354b35,0x4b354b35,0x4b354315,0x4b354b15,
-0x4b154315,0x4b354b35,0x42d44314,0x42f442f4,0x43154314,0x43144314,0x4b354314,0x43154315,0x43144315,0x43144314,0x42f44314,0x43154315,0x43154314,0x42f44314,0x431442f4,0x431442f4,0x43154315,0x42f44315,0x4b154b15,0x43154314,0x4b354b35,0x4b154b55,0x4af342b3,0x216b42b2,0x4a6e296a,0x29ab214b,0x322e31ee,0x4a91320f,0x298b4ab0,0x320d214a,0x428f218b,0x4ad14ad1,
-0x3a0e31ed,0x320e298b,0x29cc29cd,0x212a3a2d,0x52d031ac,0x190a18e9,0x31ed52f1,0x00060005,0x4ad008c7,0x0023194b,0x4a8d0002,0x3a2e5b13,0x5b535312,0x320e3a2e,0x21264aaf,0x10a52968,0x00430022,0x29490043,0x52f21086,0x63722129,0x31ec4a91,0x10a51908,0x31660022,0x10210800,0x312628e4,0x4a2c7b91,0x0004296a,0xa559ad9b,0x00250025,0x08890007,0x52d210ea,0x4aae426e,
-0x53115b31,0x31896393,0x42090002,0x1020520a,0x188020a0,0x30c11040,0x39633942,0x739128e6,0x637131aa,0x006694f8,0x63733a2f,0x426d4271,0x6b785290,0x4a907c37,0x00404a6d,0x18a20020,0x422d0001,0x5b5331ed,0x08eb63f4,0x73d429ce,0x29480044,0x31a94a2b,0x31aa4a4c,0x31aa422c,0x2129420c,0x39ec52ae,0x4a6d31a9,0x08850044,0x18c72948,0x424f1909,0x42d142f2,0x214a3a6f,
-0x3a0c0003,0x5af23a0f,0x10a6528f,0x292618e7,0x31892947,0x5b1039ec,0x084518e8,0x426e0886,0x5b533a4f,0x73f64ab1,0x00871109,0x5b325311,0x090a3a2f,0x08a9112b,0x192a216c,0x218b3a2e,0x4ab14ab1,0x3a704271,0x429152f3,0x3a70322f,0x42d33250,0x431442b3,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b154b15,
-0x43154314,0x4b154314,0x42d44b35,0x431442f4,0x4b154b15,0x43154b35,0x42f44315,0x43154315,0x43144315,0x43154315,0x43154315,0x43144315,0x43154b15,0x431542f4,0x43144315,0x43144314,0x43144315,0x42f44b35,0x4b154315,0x4b354315,0x43154b35,0x43154315,0x3a934b15,0x3a504ad3,0x2949316b,0x296a296a,0x192b214a,0x42503a4f,0x424f3a0e,0x216b31ed,0x196b29cc,0x42904270,
-0x52af298c,0x31ac4a6e,0x298b214a,0x214a31ed,0x192b31ac,0x31cd3a0e,0x6b944ab0,0x322f110a,0x4af3320e,0x00673a91,0x00010025,0x63732167,0x42924290,0x42b13230,0x218e5314,0x31ed39ed,0x320e4271,0x4a4a0023,0x00220802,0x9cd54a4b,0x4ab06334,0x4aae31ec,0x10630001,0x00010843,0x10220800,0x4a0b5a6c,0x10c773b4,0x9d3a6372,0x00040045,0x084573b3,0x52cf5af1,0x9d175b0f,
-0x29ed6372,0x00024a8e,0x31863168,0x18601021,0x18802080,0x41632080,0x6b2d3143,0x4a4e4a2c,0x4ab152d1,0x4aaf5b11,0x214910e9,0x6b9229ac,0x192d420c,0x10a44b12,0x00000842,0x10410000,0x00240001,0x324f5332,0x4ad25332,0x10a60086,0x6b50528d,0x00233189,0x10864a4c,0x004410c7,0x214918e7,0x528e10c7,0x00032128,0x52ef298a,0x4a8f52af,0x4ad24af1,0x320c5333,0x298a0004,
-0x5af03a0b,0x39cc31cc,0x00220001,0x18c50001,0x08850001,0x39cb31cb,0x10c85aaf,0x110a298c,0x53335313,0x52f35334,0x5b744290,0x4af229ce,0x08ea3a50,0x3a504291,0x53334ad2,0x42904291,0x42b14ab2,0x53344b13,0x42b23a71,0x42d25334,0x42f342d2,0x42f442f4,0x43144314,0x4b3542f4,0x4b554b55,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b154b15,
-0x43154314,0x4b154314,0x43154b35,0x4b354b15,0x4b154b15,0x43154314,0x4b154315,0x43154b35,0x43144315,0x43154315,0x43154315,0x431442f4,0x4b154314,0x43154b35,0x43144315,0x43144314,0x43144315,0x4b3542f4,0x4b154315,0x4b354b35,0x4b354b35,0x43154315,0x4b354b15,0x53144b14,0x422e4ab1,0x424f29ac,0x320e4ab0,0x216c42b1,0x4a90214a,0x52f23a0e,0x5b533a4f,0x3a2f110a,
-0x3a0d52b0,0x296a4a8e,0x214b31ec,0x426f3a0d,0x4a90216b,0x4ab03a2e,0x216d5311,0x3a71320e,0x4ad24ab1,0x3a4f42b3,0x0002196b,0x10c50822,0x5b334aaf,0x5b555b33,0x3a7142b2,0x4ad23a30,0x53336bb6,0x3a0d320d,0x00220002,0x21050801,0x31ca0044,0x31aa422d,0x000220e7,0x5aad2926,0x08021022,0x10231863,0x63307391,0x6b9452d0,0x4aaf4ad0,0x298b4aaf,0x29aa73f3,0x94b84a8f,
-0x428f0005,0x10220024,0x20a33126,0x20a02080,0x186020c0,0x39633963,0x73d35aaa,0x63714a8f,0x42d010e8,0x426e31cc,0x00036372,0x84565b4f,0x00000001,0x08000863,0x41c70801,0x526b2904,0x002218a4,0x00030003,0x10c90088,0x10842146,0x106441ca,0x18c51064,0x29691065,0x3a0b6b91,0x2968424b,0x00032989,0x39ec0003,0x216b4ad0,0x320d3a4e,0x535542d1,0x002308c9,0x41e92926,
-0x20e7420a,0x08640843,0x633018c8,0x6b7231aa,0x4ab25ad0,0x53765b15,0x63554b35,0x531552d4,0x53755375,0x090d42b3,0x533442b3,0x21ce3a92,0x42923ab0,0x3a715b75,0x53354af3,0x42d33251,0x4af34b13,0x42f442d3,0x3a9242f3,0x4ad34b34,0x535542d3,0x4b1542d4,0x4b354b35,0x4b554b35,0x4b554b56,0x4b354b55,0x4b354b55,0x4b354b35,0x4b354b35,0x4b554b35,0x4b354b35,0x4b354b15,
-0x43154b35,0x4b354314,0x43144315,0x4b354b15,0x43154b15,0x43154b15,0x4b354315,0x43154315,0x42f44315,0x43154314,0x43154315,0x4b354315,0x43154314,0x43154314,0x43144315,0x43154b15,0x4b354b15,0x43154315,0x4b154b15,0x4b354b35,0x4b354b15,0x4b354b35,0x4b154b15,0x4b144b35,0x4b145315,0x53135314,0x3a2f3210,0x3a0e3a70,0x216b31ed,0x4ab029ac,0x4ad24291,0x194b29cd,
-0x3a2d296b,0x298b4a6e,0x3a0d31ab,0x42b152b0,0x52d13a50,0x5b325b12,0x2a0f114b,0x4b144250,0x5b355b14,0x4b143a93,0x3ab13a91,0x00038cb7,0x10c710a4,0x631529ac,0x4af342b2,0x5b734b12,0x32715334,0x5b9421cf,0x00880028,0x522d0044,0x00030021,0x4a2b0003,0x00036351,0x83f30801,0x41ea41ec,0x08010001,0x39c81062,0x5b334a6e,0x5b524ab0,0x52f14ab0,0x422f6b75,0x635008a6,
-0x19297c35,0x5a8c0003,0x28e120c5,0x28c12901,0x31021840,0x29033102,0x4ace4a8b,0x0084428d,0x424d29aa,0x426d3a2c,0x08633a2c,0x00440084,0x10420000,0x39a81021,0x63106310,0x41ea3187,0x41ec7bf3,0x4a6d9cf9,0x00010802,0x08420022,0x5acd1083,0x18c76b2f,0x73d3318a,0x426e426e,0x6bb40066,0x00242148,0x63530865,0x08884a91,0x5b525b10,0x00031129,0x31a862ee,0x39c920e6,
-0x00020863,0x5b32420d,0x53126375,0x08c80026,0x5b5442b1,0x5b765b55,0x53565376,0x4b3542d4,0x4b145355,0x53764b14,0x42f42a31,0x5b765355,0x531321af,0x4b155334,0x2a103ab3,0x325121f0,0x42f34b34,0x4b1442d3,0x4b3442d3,0x4b145375,0x4b354b14,0x43145355,0x4b554b55,0x53355335,0x53355356,0x4b564b35,0x4b564b56,0x4b554b55,0x4b354b56,0x4b354b35,0x4b354b35,0x4b354b35,
-0x43154b15,0x4b354315,0x4b154314,0x4b354315,0x4b354314,0x43154b15,0x43144315,0x4b154b15,0x43154315,0x43154315,0x43154b35,0x4b154315,0x43154315,0x43154315,0x43154315,0x43144315,0x4b354315,0x43144b35,0x4b354b15,0x4b354b35,0x4b154b15,0x4b354315,0x42f44b35,0x3ad34b35,0x29ef4b14,0x42b25335,0x3a5029ee,0x3a4f42d1,0x29ad31ed,0x29cc08a8,0x322e192a,0x42904ab2,
-0x216b4290,0x4a6f10c8,0x424e4a8f,0x4ab231ee,0x3a4f320f,0x29cd29ee,0x320f29ce,0x53345b33,0x4af43ab2,0x53143a93,0x5b7542b2,0x322f4af2,0x000110e7,0x63520842,0x3a724af3,0x42925b55,0x42b242b2,0x4af34ad2,0x6bd54ad2,0x5b535b33,0x3a2e4ab0,0x00053a0e,0x084310c5,0x08420001,0x39aa524d,0x08245acf,0x18620801,0x5aad2905,0x6b9552b0,0x4ad16394,0x63956bd5,0x00259d3a,
-0x190531c9,0x41ea28e4,0x29021881,0x28c128c1,0x310328e1,0x4a2828c2,0x19252104,0x29a70884,0x00230883,0x08640864,0x00000002,0x10610000,0x632f0800,0x214c5311,0x004652d2,0x00045b2f,0x53556373,0x1084196a,0x39cb1043,0x31897bb3,0x08240000,0x0003526d,0x4a8e18e6,0x63310886,0x00464270,0x424f0002,0x00045311,0x73d22127,0x00238c95,0x20e70024,0x420a420b,0x00022947,
-0x429052cf,0x42f34af2,0x116c4b14,0x008842b1,0x53353a71,0x4b355377,0x42d45376,0x4b3542d4,0x4b144b14,0x537529f1,0x53554b14,0x53345376,0x3a922a10,0x42f34b15,0x53555355,0x42d33251,0x3ab25355,0x3a924b13,0x42d34b34,0x4b145355,0x53554b14,0x4b555355,0x4b554b35,0x53355356,0x53355335,0x4b554b55,0x4b554b55,0x4b554b35,0x4b354b55,0x4b554b35,0x4b354b35,0x4b354b35,
-0x4b354b35,0x43144315,0x43154b35,0x4b154b15,0x4b154b35,0x4b354b15,0x4b154b35,0x4b354b15,0x43154b15,0x4b354b15,0x43154b35,0x43154b35,0x4b154315,0x4b154315,0x4b154b15,0x43154315,0x43154315,0x4b154b15,0x4b354b35,0x43154b35,0x4b354b35,0x4b354b35,0x3ab34315,0x32513ab3,0x2a1042b2,0x29ef3a31,0x3a5121ad,0x5333322f,0x5313322f,0x3a4f5313,0x112929ec,0x5b5431ee,
-0x10a75b11,0x296a0004,0x3a2e10a7,0x42716353,0x29ed4ad2,0x322e08c9,0x4af23a50,0x53555b13,0x3a9242d4,0x4b145375,0x5b743230,0x4b144291,0x216b3ab1,0x08640023,0x53526350,0x5b554292,0x3a505313,0x4af26bd6,0x53546bf6,0x63d43250,0x5b555b54,0x53745b75,0x08c55b52,0x08010002,0x31683146,0x53127bf4,0x00022149,0x20621001,0x84979cd7,0x4ad38479,0x5b3331f0,0x94d98cb9,
-0x08640003,0x29666b0f,0x20c23123,0x28e21840,0x186128e2,0x10611041,0x08621042,0x00010842,0x08830001,0x00000021,0x00000001,0x31861042,0x4a6f0821,0x110d73d6,0x18e84271,0x94952988,0x00054ad1,0x10841063,0x31cd4270,0x422e52d2,0x088462f1,0x08640003,0x84345ace,0x21491086,0x000210c7,0x18e81066,0x420b6b92,0x00040003,0x422b10a6,0x39eb4a8d,0x082320e7,0x3a0b2948,
-0x3a505b53,0x5b753230,0x3a705b95,0x53324ab0,0x5b765374,0x4af55355,0x32515b77,0x4b355bb7,0x5b963a73,0x53554b14,0x53555355,0x53555355,0x21ce3a91,0x4b144b14,0x32715355,0x42f34b34,0x4b3442f3,0x53555355,0x4b353a92,0x535642f4,0x4b564b56,0x4b564b56,0x4b555376,0x53564b35,0x4b555356,0x4b554b55,0x4b554b55,0x4b554b55,0x4b354b55,0x4b554b55,0x4b354b35,0x4b554b35,
-0x4b154b35,0x4b354b35,0x43154b15,0x43154315,0x4b354b35,0x4b354b35,0x42f44315,0x43154b35,0x43154b15,0x43154315,0x4b154315,0x43154315,0x43154314,0x43144314,0x4b354b35,0x43154315,0x4b154315,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b15,0x53553a93,0x29ef5314,0x3a713230,0x4af34292,0x53143a51,0x2a0f3a51,0x216c42b1,0x218b4ab0,0x31ce31ed,
-0x6331298c,0x000352ce,0x19080001,0x42904ab0,0x31ed52f1,0x426f31ee,0x42915312,0x53343a51,0x3a923251,0x4b143a92,0x42923a72,0x5b953a50,0x4b134af3,0x00017417,0x19070000,0x3a9129cd,0x6bb773d6,0x4af45336,0x218f3a71,0x3a916bd6,0x74176395,0x6bf763d6,0x533263b5,0x0884530f,0x20c41001,0x84554229,0x3a2d5b32,0x10020823,0x6b4f1882,0x7c5731cf,0x94f97c16,0x425052d2,
-0x10a30001,0x20c28454,0x20a11860,0x08001060,0x00000800,0x00000000,0x08010001,0x08420801,0x29251042,0x29473188,0x08420021,0x20e59cb4,0x8c972905,0x53118477,0x52cd2989,0x31a96b8f,0x18c33125,0x21495aed,0x4ad242b2,0x3a515b76,0x8c984250,0x08447bd4,0x21270003,0x00442127,0x00020001,0x4a8e6330,0x000318e6,0x08663a0b,0x53125af2,0x00044a6e,0x52d21949,0x4ad35313,
-0x42914271,0x4af34af3,0x42b13250,0x5b534ab0,0x53555b94,0x5b9642d3,0x32525355,0x42f45376,0x53755356,0x53354b35,0x53765355,0x53555376,0x42f342d2,0x42f329f0,0x3a923a92,0x3ab242d3,0x53555355,0x42f33271,0x3ab33ab3,0x4b5642f4,0x4b564b56,0x53764b56,0x4b355376,0x4b564b35,0x4b555376,0x4b565356,0x4b564b56,0x53564b55,0x4b354b56,0x4b564b56,0x4b554b55,0x4b354b35,
-0x4b354b15,0x43144b35,0x4b354b15,0x4b354b35,0x4b354b35,0x4b354b15,0x4b354315,0x43154b35,0x4b354b15,0x4b354b35,0x4b354b35,0x4b154b15,0x4b354b35,0x4b154b15,0x4b354b35,0x4b354315,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b344b15,0x3a923a91,0x4b354b35,0x4b354b35,0x4b354b15,0x4b154b35,0x42715314,0x53125312,0x426e3a2e,
-0x00046bd3,0x29491087,0x00037391,0x00250005,0x214a216b,0x426f29ac,0x3a503a2f,0x4af34ad3,0x327242d3,0x5b764b35,0x4af33230,0x53544291,0x3ad45354,0x42d44b33,0x00010088,0x5aef18c4,0x6bb631ee,0x53354b13,0x4af25b95,0x6bd742b2,0x000800aa,0x00cb0029,0x4ad221ae,0x5b534af3,0x08010000,0x10411022,0x39cb39aa,0x18e86b71,0x18a41062,0x210a83f1,0x6354190b,0x8c988477,
-0x0002736f,0x082018a3,0x00000000,0x08200000,0x10000800,0x398828c4,0x49ea62ee,0x082241ea,0x4a8e7370,0x31695310,0xa55618a5,0x422a8436,0x00030803,0x00450865,0x00000001,0x20c50000,0x10631063,0x4ab1426e,0x320f3a2f,0x5b953a70,0x635463d6,0x4aaf10e9,0x000418c6,0x10a20001,0x4a0b3988,0x0023420b,0x531010e4,0x320e4290,0x3a0e4270,0x52d00004,0x3a5042b0,0x29ef322f,
-0x4af34af2,0x3a714af3,0x3a6f3a6f,0x29ed5b11,0x4b135b74,0x4b144b14,0x4b1442b3,0x4b344af4,0x5b964b35,0x53764b35,0x53764b14,0x4b145376,0x3ab242b3,0x3ad34b14,0x53333271,0x535542d2,0x32724b35,0x32713271,0x53553a92,0x4b554b35,0x53764b56,0x53765356,0x53765376,0x4b555356,0x4b554b56,0x53565356,0x4b554b55,0x4b554b35,0x4b354b56,0x4b555356,0x4b555376,0x4b564b35,
-0x4b354b35,0x4b354b15,0x4b3542f4,0x4b354b35,0x4b354b35,0x4b354b15,0x4b154b35,0x4b354b35,0x4b354315,0x4b354b35,0x4b354b35,0x4b354b35,0x4b154b15,0x4b354b35,0x4b354b35,0x4b354314,0x4b354b35,0x43154315,0x4b354b35,0x4b354b35,0x4b354b35,0x43154b35,0x4b354b35,0x116d4b15,0x4b3529ef,0x4b354b15,0x4b364b35,0x4b564315,0x4b354b35,0x4ad35314,0x42504ad1,0x4a90420f,
-0x4a6f1088,0x08664a6f,0x6b920004,0x08874a6e,0x08640003,0x424d31ca,0x32504ab1,0x42b24b12,0x3a5042b2,0x5b965333,0x3a5142b3,0x42d242b2,0x5b754b14,0x4b355355,0x32703ab3,0x004310c7,0x7c130024,0x53355b55,0x5b766bf5,0x5b955315,0x63b65355,0x5b755b76,0x63d63a92,0x6bf67c79,0x10e419a9,0x00002044,0x08651064,0x00420803,0x106018a2,0x6b0c1882,0x8c799cf9,0x5b727416,
-0x1904426b,0x00000000,0x00000000,0x31241000,0x4a0a9c51,0x41ea3168,0x1044420a,0x10456b30,0x31ce0004,0x84355b32,0x6bb50844,0x0863296b,0x83f20803,0x84348435,0x08210001,0x08223186,0x106418a4,0x3a2f7c15,0x3a4f4ab1,0x29ad3a4f,0x10e90047,0x63736392,0x18c652ae,0x18c50823,0x00001082,0x4aac0021,0x528f6310,0x424e5b31,0x00240067,0x3a4e39cb,0x4af342b1,0x53343a91,
-0x320f42b1,0x5b53218c,0x08a8322f,0x4ad1426e,0x3a70320e,0x32303a92,0x3a915334,0x53553a91,0x53355376,0x53965355,0x4b355b96,0x4b354b35,0x53554af4,0x42b25355,0x42b129ef,0x3a514b13,0x4b3442f3,0x53555355,0x53765355,0x53765376,0x53765376,0x53765376,0x4b554b55,0x53565356,0x53764b56,0x53565356,0x4b554b55,0x53764b35,0x4b554b56,0x4b555356,0x53764b55,0x4b564b35,
-0x4b354b35,0x4b354b15,0x4b3542f4,0x4b354315,0x4b354b35,0x4b354b15,0x4b354b35,0x4b354b35,0x4b354315,0x4b354b35,0x4b354b35,0x4b154b35,0x4b154b15,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x43154b35,0x43154b35,0x3ab24b35,0x4b153a71,0x4b354b15,0x4b364b35,0x53764b16,0x4b354b35,0x42b25335,0x3a0d216c,0x298c296b,
-0x3a0e4a90,0x426f31ee,0x52f24a8f,0x424f4a91,0x29284a6d,0x00040844,0x3a4f29ac,0x4ab252f3,0x320f320e,0x42b23210,0x3a515335,0x5b335313,0x63b65b54,0x42f45b96,0x32915b96,0x08a64ab2,0x10831065,0x639420e8,0x63d75b56,0x4b144ad3,0x63b66bf7,0x5b756c18,0x6c1763d6,0x5b9663d5,0x00852a0f,0x39a70020,0x004462ce,0x08840023,0x29242105,0x18820800,0x9d3a20a5,0x4ad17c18,
-0x08001881,0x00000000,0x28a30020,0x6310c5b8,0x739252af,0x6350426e,0x10a64a6d,0x3a0b4a4d,0x31ed428d,0x84ba5b33,0x320d8cb7,0x18c50005,0x00030823,0x006310a6,0x00000000,0x422918a3,0x422d8412,0x192b0025,0x08ca6bb5,0x635310c9,0x31ef216b,0x42900068,0x00030886,0x39ab62ef,0x31481885,0x08457392,0x52cb0823,0x00240003,0x39ab2969,0x5b334ab1,0x194c42b2,0x42b1320f,
-0x32303a50,0x2a0e4af1,0x3a6f21ad,0x192b1929,0x2a2e4290,0x3a70112b,0x3ab13a91,0x537442f2,0x4b354b14,0x4b143a92,0x53555355,0x3a725335,0x5b9642f4,0x53334b14,0x2a0f42b1,0x4af43a91,0x53545b54,0x4b144b34,0x53555376,0x42f45355,0x4b354b55,0x53765376,0x4b565376,0x53564b56,0x4b564b56,0x53565356,0x4b564b56,0x4b564b56,0x4b565356,0x4b554b55,0x4b554b55,0x53564b55,
-0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b154b35,0x4b354b35,0x4b154315,0x4b354b35,0x4b154b35,0x4b354b35,0x4b354b15,0x4b354315,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b154b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x42d44b34,0x4b154b34,0x4b554b35,0x4b364b35,0x4b353252,0x4b354b56,0x112c4292,0x212852d0,0x424e39ec,
-0x4271196c,0x32303a30,0x4ad04ab1,0x3a0e428f,0x3128318b,0x20e86b10,0x00450044,0x00230025,0x218908a3,0x3a505b31,0x422f4a92,0x5b126354,0x63b66bb5,0x53965334,0x53954b35,0x6bd83af2,0x00026bd6,0x08210843,0x6c17428e,0x53545b95,0x63b65355,0x63b63a92,0x74396c17,0x747a42d6,0x21ad7476,0x082100e6,0x53134a0b,0x00446b94,0x08210001,0x08000800,0x28e41020,0x73b39cf8,
-0x00000800,0x18410800,0x5a8b20a2,0x21085a8d,0x73b373b3,0x633052f0,0x420b318a,0x3a0c52d0,0x6bb34a70,0x0004216c,0x5b0e320e,0x4a8d0002,0x9cb76351,0x08210002,0x5acc1883,0x4a8b3168,0x94d652cf,0x00040003,0x3a2c52cf,0x424f52b0,0x6bb55b74,0x192a5b13,0x4a4e0003,0x10854a4d,0x52b1420c,0x4a8f5b12,0x0001526c,0x00010000,0x424e422b,0x5b5352f2,0x52f129ce,0x42925b54,
-0x322f218c,0x29cc4290,0x3a2d29ad,0x3a4f214c,0x428f4ad1,0x218c3a2e,0x3a70322f,0x42f34b13,0x53763ad4,0x42f43a94,0x43144b55,0x4af44b35,0x3a935b76,0x53343ab3,0x29ce21ee,0x3ad2322f,0x42b242d3,0x3ab33271,0x42d33251,0x53754b34,0x4b355376,0x53765376,0x53765376,0x53765356,0x53765376,0x4b564b56,0x53765376,0x53564b56,0x4b564b56,0x4b564b35,0x4b564b56,0x53565356,
-0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b154b35,0x4b354b35,0x4b154b35,0x4b354b35,0x4b354b35,0x4b154b35,0x4b354b35,0x4b354b35,0x4b354b15,0x4b354b35,0x4b354b55,0x4b154b35,0x4b154b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b554b35,0x4b354b35,0x4b354b35,0x53355335,0x4b564b35,0x4b554b56,0x53354b35,0x4b155356,0x4290320f,0x212a52b1,0x3a0d31ac,
-0x42b13a2e,0x53123250,0x32305b74,0x0888216c,0x298b4a6f,0x31cd39ed,0x298a424e,0x000110a7,0x00010001,0x00010001,0x08630844,0x00021083,0x31cc0001,0x5b756b94,0x4b154af4,0x63d65bb7,0x5b9763d6,0x00011949,0x08630001,0x6bf77c36,0x6bf763d6,0x8d1c4af3,0x63f82a52,0x6c176c17,0x5bb663f7,0x00445354,0x73d21863,0x296b31f0,0x000352cf,0x08200001,0x10410800,0x6b713146,
-0x08000800,0x30c21860,0x39a94a07,0x298b8c74,0x6b936bb5,0x21282989,0x52ae0003,0x2129298a,0x0004424f,0x0002426c,0x294810a7,0x214a2987,0x18c729ad,0x20c420a3,0x422d0801,0x39eaa538,0x10a839ed,0x52ad10a6,0x088718e7,0x63957c57,0x63d65355,0x00050005,0x29887c15,0x6b710865,0x63964ad2,0x74157437,0x10a40003,0x8c730001,0x52cf0844,0x08c929ce,0x31ef322f,0x218c4ad2,
-0x320d3a6f,0x194a21ad,0x4aaf212b,0x42af298d,0x218b322e,0x428f320d,0x4af429cd,0x4b365335,0x42f45376,0x53764b36,0x4b354b55,0x5bb74b35,0x3ab13a72,0x21cf00a9,0x4af24b33,0x537542d2,0x3a714af3,0x53344b13,0x4b343ab2,0x4b344b34,0x537642f4,0x53765376,0x53765376,0x53764b55,0x53765376,0x53765356,0x53764b56,0x4b564b56,0x53565376,0x4b564b56,0x4b564b56,0x53564b56,
-0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x43154b35,0x4b354b35,0x4b354b15,0x4b354b35,0x4b354b35,0x4b154315,0x4b354b35,0x4b354b35,0x4b354b15,0x4b354b35,0x4b354b35,0x4b354b35,0x43154b35,0x4b354b15,0x4b354b35,0x4b354b35,0x4b554b15,0x4b354b35,0x4b354b55,0x4b355335,0x4b554b55,0x4b554b55,0x53354b55,0x42f54b35,0x533442d3,0x5b134ad2,0x53124270,
-0x4291320f,0x53124af3,0x29ce5333,0x6372320e,0x4ad24a6f,0x4ab25313,0x5b124a91,0x422a424d,0x08430002,0x00023168,0x00000022,0x00000000,0x00000002,0x00010001,0x29670884,0x000231ca,0x8c7641ec,0x6bb463b4,0x00210002,0x10820001,0x42b2424e,0x6c5842d3,0x6bf87418,0x5b956bf7,0x5bd66c17,0x096d42f3,0x08210064,0x3a4e3169,0x5b137416,0x3a2d216b,0x08220022,0x28e31882,
-0x10610800,0x52292061,0x31685aad,0x5af0424d,0x31eb424d,0x422c20e7,0x5af018a7,0x422d10a7,0x8496214b,0x18a5528d,0x00022106,0x52cf3a2a,0x18c60026,0x20c2ad16,0x112a2946,0x000552f0,0x4a8d422d,0x6b9331cc,0x4acf1909,0x3a2f5b52,0x00062a50,0x53112129,0x0845190a,0x53355b51,0x53345354,0x00440088,0x39a818c5,0x18e652cc,0x29aa528d,0x3a6f29cd,0x533452f2,0x426f5312,
-0x194a1109,0x4a903a2e,0x31ec4ab1,0x3a2d3a2d,0x31ec31cb,0x320d192b,0x4b144290,0x5b965355,0x5bb65bb6,0x4b545376,0x5b964af5,0x00064b14,0x53552a4f,0x53544b14,0x4af35b75,0x42b25334,0x4b133a71,0x4af33a92,0x4b143a92,0x53764b34,0x53764b35,0x53755356,0x4b555376,0x53555376,0x53564b55,0x53765376,0x53765376,0x53765376,0x53765376,0x53765376,0x53765376,0x4b565376,
-0x4b354b35,0x4b354b35,0x4b554b35,0x4b354b35,0x4b354b35,0x4b554b35,0x4b354b15,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x43154b15,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b15,0x4b354b35,0x4b554b35,0x4b354b35,0x4b354b35,0x4b354b56,0x4b354b56,0x4b554b55,0x4b554b55,0x4b354b35,0x4b353ab3,0x3ab35355,0x4ad25314,0x3a4f4a91,
-0x320f3a4f,0x3a5052f3,0x3a4f3a71,0x5b334ab1,0x4ad252f3,0x3a713a71,0x4a8f5314,0x10c7424e,0x424d4a8e,0x52d3426d,0x6bd4192b,0x52cd5b71,0x00010884,0x00000001,0x00010001,0x00010001,0x00010001,0x08840000,0x00000002,0x00000000,0x00200020,0x6c177414,0x6c387419,0x6c185bd7,0x32725375,0x8cfc3ab2,0x108421cd,0x4a2d28c4,0x5b737c15,0x216c7c58,0x31eb5332,0x18621021,
-0x18411000,0x08425a8a,0x5acc3169,0x29272106,0x4a2c2106,0x318a6310,0x4a6e5acf,0x52ae5acf,0x320e4a91,0x00003a2e,0x29050001,0x000220e6,0x20e60864,0x10431884,0x7c1573b3,0x00240045,0x5af02108,0x4a6f4a6f,0x3a0d6372,0x31ec08e8,0x29a80003,0x39ec6bb4,0x426d0843,0x32706bf6,0x0004196c,0x6b734a4e,0x5b316b93,0x00246351,0x00244a8c,0x428f31cc,0x4b135b33,0x218900a7,
-0x31cb1929,0x52f15b12,0x216b3a2f,0x21293a2d,0x214910c7,0x429031ec,0x5b965b54,0x5b965bb7,0x4b555376,0x4b554b15,0x3a924b15,0x535542d2,0x4af35355,0x42d35355,0x4af35335,0x2a0f3a91,0x4b1342d2,0x4b143a72,0x42d34b14,0x42f44b14,0x43145355,0x53765356,0x43145376,0x4b355376,0x53765376,0x53765376,0x4b565376,0x53765356,0x53765376,0x53764b56,0x53765376,0x53764b56,
-0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b55,0x4b354b35,0x4b554b35,0x4b354b35,0x4b354b35,0x4b354b15,0x4b354b35,0x4b354315,0x4b554b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b55,0x4b354315,0x4b354b35,0x4b354b35,0x4b354b35,0x4b564b35,0x4b354b55,0x4b354b55,0x4b554b55,0x4b354b56,0x32934b56,0x42f43ab3,0x53555355,0x42d221ef,0x42f24b14,
-0x426f218b,0x3a2f4290,0x5313424f,0x3a504291,0x4af35b34,0x4ad34ad3,0x216b52f3,0x00253a0e,0x426f320e,0x32524290,0x63b64af3,0x53564af3,0x4b155336,0x218b4af3,0x10e81908,0x10a7296a,0x00240004,0x00020003,0x00000000,0x00000000,0x00000000,0x00211062,0x7c152969,0x6bd67417,0x4af26bd6,0x63b57417,0x092a63b7,0x18a40021,0x5b338415,0x741773f6,0x4ad16c18,0x00012169,
-0x39232060,0x080120c5,0x29060001,0x3146528b,0x316818a3,0x420d4a6c,0x52af298a,0x6bf56332,0x53114290,0x42098477,0x18820041,0x08440820,0x52cd4a6b,0x528d1085,0x18e931cc,0x18878414,0x19091087,0x533173f6,0x52f16bb3,0x10e56bb0,0x4a6d2967,0x18e6424c,0x2a2e426c,0x004508c8,0x741610c7,0x5b7563d6,0x29cd5312,0x00045312,0x5b0f1929,0x42700887,0x52d04a90,0x10e810c8,
-0x422e39eb,0x006631ec,0x10a62149,0x21283a0c,0x39ec2108,0x42913a0d,0x53765355,0x53965375,0x53765376,0x53954314,0x5b9642d3,0x5bb64b34,0x42d35396,0x53555375,0x3a915355,0x4b1342d2,0x42b242d3,0x531542d4,0x4af442b3,0x42f45335,0x53764b14,0x537642f3,0x4b355376,0x4b354b34,0x53754b55,0x53765376,0x53765376,0x53765376,0x53765376,0x53765356,0x4b555376,0x53765396,
-0x4b554b56,0x4b354b55,0x53564b35,0x4b554b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b154b15,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b55,0x4b354b35,0x4b354b35,0x4b354b35,0x4b564b56,0x4b565356,0x4b354b56,0x4b354b56,0x4b554b55,0x3ab35376,0x4b3542d4,0x42935315,0x53552a0f,0x53345354,
-0x298b5b13,0x42b03a0e,0x42923a4f,0x4ab14292,0x42f24a92,0x53335354,0x3a4f4af2,0x000431ee,0x53146374,0x53555b96,0x42d43273,0x5bb65b97,0x5bb74b34,0x5bb74b35,0x42d55b96,0x5b966c18,0x4b345b96,0x8cba4b34,0x18e76376,0x00000020,0x00001020,0x08030000,0x10a210a3,0x39cb0000,0x6bb6a53c,0x639663d6,0x43113291,0x084308c6,0x8c785a8d,0x7c387439,0x42d163d7,0x7c33324c,
-0x8c3283f0,0x41e93147,0x526b0822,0x4a2a3988,0x39ea4a2a,0x5ad0426d,0x31ab39cc,0x53325b11,0x7c575b73,0x2944426d,0x10410000,0x737431a7,0x002231cd,0x73b21043,0x216b0004,0x10c76b93,0x320d6b93,0x320e4ad0,0x3a0f5333,0x29680002,0x63320002,0x00230863,0x08250024,0x847731ab,0x5bb56395,0x5b745354,0x3a2f42b0,0x00244ad0,0x29aa428d,0x426e0003,0x00243a0d,0x426d3a0c,
-0x296931aa,0x214918c7,0x108639eb,0x424d31aa,0x52d031cc,0x429121ac,0x537542d3,0x53755bb7,0x53555bb7,0x4b335bb7,0x5b965bb6,0x5bb65375,0x42d35375,0x4b343ab2,0x42d32a10,0x2a0f5334,0x3a7142b2,0x53555355,0x53355314,0x4b355314,0x53554b35,0x4b554b55,0x537642f4,0x4b5542f4,0x53765376,0x53764b56,0x53765b97,0x53765376,0x53765376,0x53565376,0x53764b56,0x53765376,
-0x4b355376,0x4b554b55,0x4b564b55,0x4b564b35,0x4b354b35,0x4b354b55,0x4b354b35,0x4b564b35,0x4b364b36,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b55,0x4b354b56,0x4b354b35,0x4b564b35,0x4b354b35,0x4b354b35,0x4b154b55,0x4b554b35,0x4b354b35,0x4b564b35,0x53565356,0x4b554b56,0x4b554b55,0x4b555356,0x4b554b35,0x53565356,0x29ee3a51,0x4b134b13,0x53345355,
-0x298b0069,0x533329ac,0x320e4ad1,0x5b3242b1,0x5334196c,0x32305314,0x3a2e4b13,0x000431ee,0x53143a30,0x5b764af4,0x4b155376,0x53565b96,0x4b355356,0x53355376,0x5bb663f8,0x4b355bb7,0x63f75b96,0x6bf763d7,0x64385b76,0x6bd863d8,0x09087c98,0x00000002,0x08410001,0x000018c3,0x10a31060,0x196c94b7,0x63d65bd6,0x00437458,0x634f1062,0x74377c17,0x3a717457,0x63937418,
-0x29682127,0x4a0a28e5,0x20e52906,0x41ea83d1,0x635041ca,0x4a6e216a,0x21094a6e,0x320e7c15,0x322e3a6f,0x00000063,0x5a8a0861,0x2129420c,0x08223a6b,0x73b21002,0x29cc0866,0x08663a4e,0x42b06bb3,0x320e196a,0x0004324e,0x08230002,0x00430823,0x420a0002,0x73b46371,0x53965b54,0x4b764b35,0x29ed4b34,0x42904ab1,0x31a9428e,0x29aa1107,0x426e3209,0x31eb0025,0x298910c6,
-0x00442149,0x210720e7,0x4a8e0865,0x4a8f422c,0x42905b31,0x4ad229ee,0x537642b2,0x53765375,0x53765b96,0x4b3321d0,0x5b964b14,0x4b544af3,0x3a924b34,0x21ef4b34,0x3a913ab2,0x32503250,0x4b134af3,0x53334b13,0x53555334,0x53554b14,0x53755355,0x3ab34b55,0x42f43ad3,0x53964b35,0x4b554b14,0x4b565376,0x5bb74b15,0x53765376,0x53765376,0x53565376,0x53764b56,0x53765376,
-0x4b355376,0x4b554b55,0x4b354b55,0x4b554b35,0x4b354b35,0x4b554b35,0x4b554b55,0x4b564b35,0x4b364b36,0x4b354b35,0x4b354b35,0x4b354b35,0x4b354b35,0x43154b35,0x4b354b35,0x4b354b35,0x4b564b56,0x4b354b35,0x4b564b35,0x53764b35,0x4b554b56,0x4b354b35,0x4b355376,0x53565356,0x4b554b35,0x4b554b55,0x4b554b35,0x4b555376,0x4b365356,0x3a6e4af2,0x3a7121ce,0x42b242b2,
-0x426e52f2,0x427031ed,0x6394194b,0x322e4290,0x0026196b,0x4ad1426f,0x218c5333,0x00666b95,0x53145313,0x5b975355,0x4af553b6,0x5bb65bb7,0x6c3963d6,0x53554b14,0x5bb64b35,0x63d763d7,0x53555bb6,0x63f85375,0x5b7863f9,0x6bf863b8,0x6bf96bf8,0x637563b6,0x00000021,0x08000000,0x10011000,0x39ea1021,0x743673b4,0x4b536c77,0x18c50001,0x53336332,0x63d43a70,0x7c998498,
-0x316839a9,0x20e662cd,0x422b2106,0x4a6d6b71,0x2147420c,0x21695ad0,0x4aaf52ef,0x2a0b52d0,0x08200043,0x000018c4,0x8c321062,0x210718c5,0x08219cf6,0x002520a5,0x29ab3a0d,0x00260887,0x4af16354,0x0885216a,0x00000001,0x20c41843,0x10c31883,0x2a2f4aaf,0x42d33271,0x5b564b14,0x6bf75315,0x6bf53a70,0x53124271,0x31c8298a,0x5acf0044,0x39ea31cb,0x39ea3189,0x00030003,
-0x420a3189,0x086631a9,0x0887424d,0x29cd3a4e,0x4af2194c,0x327042d1,0x4b145354,0x5bb75b96,0x008a3ab3,0x42f35b74,0x53965396,0x53544b35,0x29ce5395,0x53125b54,0x08ca29ee,0x29ee0048,0x3a703250,0x3a923a91,0x42d342d3,0x32513a92,0x4b3442f3,0x323042d3,0x2a0f42d2,0x4b145b96,0x537542f4,0x53765376,0x53765376,0x53765376,0x53765376,0x53765376,0x53765376,0x53765376,
-0x4b564b56,0x4b354b56,0x4b364b35,0x4b364b16,0x4b354b56,0x4b354b35,0x4b355356,0x4b154b35,0x4b354b35,0x4b354b35,0x4b554b35,0x4b354b55,0x4b364b35,0x4b354b16,0x4b354b35,0x4b564b56,0x4b355356,0x4b554b55,0x4b554b35,0x4b554b35,0x4b554b56,0x4b564b56,0x4b564b35,0x4b355376,0x4b565376,0x53564b55,0x4b564b56,0x4b564b56,0x53554b56,0x00884ad4,0x4b54196c,0x42d25355,
-0x42904ab1,0x4ad042b0,0x08c929ee,0x10ca31ee,0x29ac52f2,0x4b134ad1,0x531352f2,0x535331cd,0x5b963ab2,0x53555355,0x5b965bb7,0x63b75bb7,0x53965bb7,0x5bd74b56,0x43155bb7,0x4b355376,0x53755bb7,0x6bf763f7,0x5bb76c18,0x63d763f8,0x63d74b35,0x63d75b96,0x5bb55bd6,0x00210003,0x00000000,0x00000000,0x000218c1,0x74369d39,0x00036c56,0x94b73126,0x63b57c38,0x3a705354,
-0x106420e6,0x4a2b6b0e,0x31eb62ef,0x6b71422d,0x7c120886,0x18e70025,0x21aa31ea,0x080008a7,0x18631041,0x08020800,0x21069454,0x630e2126,0x10820001,0x3a0d420b,0x190942b0,0x4a8e5b11,0x4b116bb5,0x08210023,0x6b9020e4,0x4a4d6332,0x6bb008a4,0x3a9031ed,0x535463b6,0x3230116c,0x0087092b,0x00660066,0x31eb0043,0x52cd31c9,0x31c90000,0x10642147,0x000220c6,0x422b7bf2,
-0x10a518e6,0x298a4a6c,0x4ad0426e,0x42904ad1,0x53335313,0x2a4f4af2,0x4b3542f3,0x5b965355,0x42d2008a,0x5bb65b74,0x32924b55,0x00073272,0x426f110a,0x31ed5b53,0x42b10088,0x4ad24ad2,0x3a914b13,0x4af45354,0x533542f4,0x32515355,0x4b533a92,0x3ab03ab1,0x3a90324f,0x3a723251,0x4b354314,0x53765376,0x53765396,0x53765376,0x53765376,0x53765376,0x53765376,0x53765376,
-0x4b565356,0x53764b56,0x4b564b56,0x4b364b36,0x4b564b36,0x53564b35,0x4b354b35,0x4b354b55,0x4b564b35,0x4b354b35,0x4b354b35,0x4b354b55,0x4b364b55,0x4b354b16,0x4b354b35,0x4b554b55,0x4b564b56,0x4b554b55,0x4b354b56,0x4b354b56,0x4b554b35,0x53564b35,0x4b354b56,0x4b565356,0x4b354b56,0x4b564b56,0x4b564b56,0x53564b56,0x53754b56,0x53125b76,0x53744af2,0x4b1342b2,
-0x3a504ad2,0x427042b0,0x5b5429ae,0x31ce52f3,0x298c3a0e,0x53334ab1,0x5b3363b5,0x6c17194b,0x5b965375,0x433542d3,0x53764b56,0x63d75b96,0x5bb763d7,0x5bd75376,0x63f863d7,0x53765bd7,0x53755bb6,0x63f763d7,0x6bf86c18,0x537663d7,0x63f85376,0x4b1563d7,0x74596c18,0x953b5bd7,0x00000021,0x00200000,0x10000800,0x08210800,0x00028498,0x39a81021,0x6bb58c77,0x63945333,
-0x4a0a3147,0x5af018e5,0x29a952cf,0x002452ce,0x6b4f52ce,0x31e931a8,0x00020022,0x08000000,0x20a31882,0x294b8c33,0x94767c35,0x528c2128,0x212520e5,0x4a90424e,0x3a2f4a90,0x951a42b0,0x002329ab,0x6b2f0002,0x6b934a4b,0x19276374,0x004539cb,0x29ed4ad0,0x4ab06bf5,0x08e8194a,0x52f0426f,0x63926bd4,0x108639ed,0x08642948,0x08430001,0x08620822,0x000220e5,0x10640002,
-0x002418e6,0x29ab31ab,0x3a6f31cb,0x42905332,0x42d15312,0x42b1322f,0x53552a0f,0x00463250,0x00060004,0x196d2a10,0x29cd3a4f,0x21ad21cd,0x5312322e,0x42b129cd,0x4af25313,0x322f3a91,0x42d242b2,0x42b242b2,0x3a925375,0x4b134b14,0x32914b34,0x42915313,0x3a5021ae,0x42d23a71,0x53554b14,0x53965376,0x53765397,0x53965376,0x53765376,0x53765376,0x53765376,0x53765376,
-0x4b564b55,0x4b564b56,0x4b365356,0x4b364b36,0x4b354b36,0x4b554b56,0x4b554b55,0x4b554b55,0x4b554b55,0x4b354b35,0x4b554b35,0x4b554b56,0x4b564b56,0x4b364b35,0x4b364b36,0x4b354b35,0x4b354b55,0x4b554b55,0x4b564b56,0x4b354b56,0x53564b56,0x53565356,0x53564b56,0x4b564b55,0x53564b55,0x53764b56,0x53764b56,0x4b564b56,0x4b564b56,0x010d5376,0x5335112c,0x21ef5b95,
-0x429163b5,0x110b320e,0x5b554ad2,0x63955b75,0x216b31ce,0x10a97c36,0x5b110007,0x63b6322e,0x53964b34,0x53554314,0x094e42d3,0x5bb75bd7,0x5b9763b7,0x5b975b97,0x63d763d7,0x5b975bd7,0x6c193253,0x6c1863d6,0x6bf86c18,0x4b576c18,0x5bd753b7,0x6c186bf8,0x535663f7,0x53965bd7,0x3a4f5b96,0x00000002,0x00000800,0x00000800,0x104118a2,0x10410800,0x7c16630d,0x29ad7c98,
-0x106339a8,0x7c141084,0x635031ab,0x002310a4,0x00010043,0x00010001,0x00000001,0x206120c3,0x41e91021,0x53126352,0x10865b31,0x29266330,0x4a6d18a2,0x424f29cd,0x63744a90,0x004431ec,0x00010023,0x294a422d,0x5b10424d,0x10c51086,0x52d073d2,0x00250044,0x08850045,0x296a7bf4,0x42d14ab0,0x4af14af2,0x39cb6374,0x52cd0023,0x18e418c4,0x18c42926,0x18a50823,0x08237370,
-0x21282948,0x190810e8,0x218b216a,0x320e21cd,0x3a703a6f,0x3ab13a90,0x00a729ee,0x6393218b,0x5b736394,0x53555b96,0x322e112a,0x198c5b93,0x5b334af2,0x2a0e52f2,0x42f242b1,0x5354322f,0x29ef5334,0x4b3342d2,0x3ab12a2f,0x42f33270,0x4b132a0f,0x29ef5b75,0x3a714ad2,0x53345354,0x4b354b35,0x53965376,0x5b974b55,0x53765397,0x53965376,0x53765376,0x53765376,0x53765376,
-0x4b565356,0x4b554b35,0x4b364b55,0x4b365356,0x4b564b36,0x53564b56,0x4b565356,0x53564b55,0x4b564b56,0x4b564b56,0x4b554b56,0x4b354b56,0x4b555356,0x4b364b35,0x4b364b36,0x53764b35,0x4b554b56,0x4b554b55,0x4b554b56,0x4b554b55,0x4b564b55,0x4b564b56,0x4b554b55,0x4b354b55,0x4b554b56,0x4b564b56,0x4b564b56,0x4b564b56,0x53764b56,0x4b555376,0x53764314,0x53765376,
-0x29ef4af3,0x42b15b75,0x32514af2,0x08eb42d3,0x3a2f4ad2,0x6374192b,0x4ad14291,0x53354270,0x5b965396,0x5b965bb7,0x53764b35,0x63d74b15,0x63b763d7,0x63d863b7,0x63d75bb7,0x5bd75376,0x3ad45397,0x63d85397,0x5b9663f8,0x5bb76bf8,0x43164b36,0x53765bb7,0x5b9763b7,0x4b36641a,0x5b765bb7,0x29cb6bf8,0x00000001,0x08000000,0x10811061,0x082020a1,0x526b2061,0x84570004,
-0x18e5c619,0x00003146,0x00010002,0x00010001,0x00000001,0x00000000,0x28e30800,0x08401861,0x4a6d4a4a,0x4ab17c37,0x4a6d31eb,0x20a31906,0x52f0526b,0x4ab1426f,0x3a4b6375,0x08821905,0x18c752cd,0x5b1052f0,0x210731ca,0x10a510c4,0x00231066,0x10e72949,0x00240002,0x318a0001,0x29f06b94,0x4b114af2,0x3a0b1908,0x318818a5,0x00009cf4,0x422910a3,0x294820e6,0x10a50003,
-0x4a6c424b,0x31aa1908,0x4aaf29cc,0x3a4f10e8,0x4af23a6f,0x31ed6bf6,0x4af01929,0x4ad44af2,0x42d37439,0x53742a10,0x08c84b12,0x08e90887,0x53125312,0x3a703a4f,0x4af24af2,0x5b955333,0x3a90114b,0x4b1308ea,0x29ee4af2,0x00880007,0x008919ad,0x6c1729ef,0x53544b13,0x42f33ab2,0x42b43a93,0x53764b35,0x5bb65376,0x5b765396,0x53765b76,0x53975396,0x53965396,0x53765376,
-0x4b565356,0x4b565357,0x4b564b36,0x4b564b56,0x4b564b55,0x4b554b56,0x4b564b35,0x4b565356,0x4b554b56,0x4b354b55,0x4b554b56,0x4b564b55,0x4b364b55,0x4b564b36,0x4b554b35,0x4b554b56,0x4b364b36,0x4b564b36,0x4b565356,0x4b564b56,0x4b564b36,0x53764b55,0x4b564b55,0x4b564b55,0x4b355376,0x4b564b56,0x53765356,0x53565376,0x4b565376,0x53765376,0x53765376,0x53765376,
-0x3a9242f4,0x42b25376,0x5334198f,0x4af24af3,0x4af35353,0x42d25354,0x4ad252d2,0x53765b75,0x5b965376,0x5b955335,0x53755376,0x63d75355,0x63d763b7,0x63d763d7,0x63d763d7,0x63d763f8,0x63f863b7,0x5b975b96,0x63f763b8,0x63b663f7,0x6c186c18,0x6c1963d7,0x6c396c18,0x63d76c38,0x74587458,0x00cb7479,0x00037478,0x00000001,0x08200820,0x10601040,0x10001840,0x73d47b4f,
-0x10631042,0x00000000,0x00000001,0x08220001,0x29051063,0x734e2925,0x10413965,0x62ee1861,0x18e80003,0x006608a7,0x41ea10a6,0x28c418c4,0x52b04a6d,0x4a91426f,0x08430046,0x94b50042,0x21286b70,0x52cf6b92,0x18c510e6,0x29481085,0x63518433,0x214952b0,0x4a2c73b1,0x0003632e,0x214a18e7,0x10c831cd,0x7bd22107,0x5acd5aad,0x000010a3,0x296610a3,0x18e618c5,0x5acd528d,
-0x298910c7,0x422d18c7,0x1908424d,0x29ed6b72,0x112929ed,0x4aad0005,0x10c82989,0x00020025,0x00230024,0x00640025,0x1929216a,0x3a0e4aaf,0x42915354,0x110a5b33,0x194a3a4f,0x00260026,0x3a6e1149,0x5b3273d5,0x4b134af3,0x4b134af2,0x53343a91,0x74585334,0x42b23250,0x42d33251,0x5b9642d3,0x53764b35,0x53765396,0x5b965396,0x53965b76,0x53975396,0x5b975396,0x53975396,
-0x4b355376,0x4b364b56,0x53765357,0x4b564b55,0x4b564b56,0x4b564b36,0x4b565356,0x53565356,0x4b564b55,0x4b554b56,0x4b354b55,0x4b555356,0x4b364b56,0x4b354b56,0x4b564b56,0x4b564b56,0x4b364b56,0x53574b36,0x53564b36,0x4b364b56,0x4b554b36,0x4b565356,0x53565356,0x53765356,0x53765356,0x53765376,0x53765356,0x4b565376,0x53765376,0x53765376,0x53765376,0x53765376,
-0x5b965376,0x32305355,0x3a914af3,0x4af3194c,0x42b35355,0x5b755b76,0x63b63a31,0x5b965b55,0x5b964b35,0x5bb642d3,0x4b354b15,0x5bb73292,0x63d75b96,0x63d763d7,0x63d763d7,0x63f863d7,0x63f863f8,0x63f86bf8,0x53765bb7,0x5b975356,0x6c176bf7,0x63b863f8,0x6c386c18,0x74387459,0x6c386c38,0x63f76c38,0x4b755353,0x0000196a,0x00000020,0x00000000,0x10401861,0x4a2a1840,
-0x08000800,0x83f03105,0x0842b597,0x000018c3,0x4a091062,0x00000842,0x000020e4,0x632e1883,0x5b2e424c,0x420c0025,0x31475acc,0xad5818e2,0x84587bb5,0x10a55b11,0x18e20020,0x524f4a4a,0x18851887,0x10640823,0x00440885,0x8c545ace,0x420d4a4d,0x21287c15,0x000210c6,0x00010002,0x00010001,0x00010001,0x00020000,0x00010803,0x08010001,0x10420000,0x00020000,0x00020002,
-0x00030003,0x00230004,0x00030023,0x00030004,0x10a60044,0x00010844,0x52ef420c,0x4af11109,0x53534290,0x8cfa5312,0x00034a8f,0x00020001,0x4acd0003,0x424b7c55,0x296b8c76,0x424e1909,0x6394110a,0x4af32a10,0x112d112d,0x42b2198e,0x63b65b95,0x4b345b75,0x42f342d3,0x53555b96,0x4b154b15,0x53964b56,0x53965396,0x53965396,0x5b975396,0x53975397,0x53975397,0x53965396,
-0x53765356,0x4b564b55,0x4b554b56,0x4b565376,0x4b564b56,0x53764b56,0x4b565376,0x4b564b56,0x4b564b56,0x4b564b56,0x53574b56,0x4b565356,0x53564b36,0x4b364b35,0x4b365357,0x4b564b55,0x4b555356,0x4b364b36,0x4b365357,0x4b564b56,0x4b565376,0x4b564b56,0x53764b35,0x53764b56,0x53564b56,0x53765376,0x4b565376,0x53765376,0x4b565376,0x53765376,0x53765376,0x53965376,
-0x53755396,0x53544b55,0x3ab242f3,0x42d342d2,0x53545b55,0x53554b14,0x4b1542d3,0x5b764b55,0x5bb74af5,0x5b9653d7,0x4b565b55,0x5b775396,0x63d763b7,0x63d763d7,0x63d863d7,0x63d763f8,0x63f863f8,0x5bd763f8,0x53765376,0x53575bb6,0x3a941970,0x53765376,0x63d84af4,0x6c386c38,0x74386c17,0x74596bf7,0x5b957459,0x21283a92,0x322f9d39,0x00000002,0x00000000,0x18411020,
-0x10002883,0x18422063,0x08020000,0x4a4a3987,0x524b39a7,0x4a09528b,0x000041e9,0x210720a4,0x0066294b,0x424d6332,0x18830002,0x63512105,0x63314a90,0x00010023,0x20e43186,0x08421063,0x10631042,0x18c50844,0x188520c5,0x6b924a4e,0x00236330,0x00030002,0x62ed0002,0xa51783f2,0x108452ac,0x18c50001,0x316773af,0x83f141ea,0x00002105,0x10420822,0x3a4b52ac,0x3a2d424c,
-0x6b9352cf,0x52cf31ec,0x73d46bd3,0x426e424f,0x31ca4acf,0x31eb4a8e,0x422e31cc,0x42d16393,0x42905312,0x42d1322f,0x5312218d,0x3a2d5b52,0x216a7c34,0x00041108,0x422e424e,0x52b08c97,0x7c370088,0x5b753230,0x53335333,0x3a9063d6,0x42d3196f,0x42f34af3,0x32713251,0x3ab24b14,0x4b144b35,0x53965397,0x53965396,0x53965396,0x5b975396,0x53765397,0x53975397,0x53965396,
-0x53765356,0x53764b55,0x4b555376,0x4b565376,0x4b564b56,0x53764b56,0x4b565376,0x4b564b56,0x4b564b56,0x4b564b56,0x4b364b56,0x4b565356,0x53564b56,0x4b364b35,0x4b365357,0x4b565376,0x4b555356,0x4b364b36,0x4b565357,0x4b564b56,0x4b565376,0x4b564b56,0x53765376,0x53764b56,0x53564b56,0x4b564b56,0x4b565376,0x53765376,0x4b565376,0x53765376,0x53765376,0x53965376,
-0x53965375,0x5b765376,0x53764af4,0x5b764b35,0x43135b96,0x42d32a30,0x5b765355,0x63d74b35,0x53965b76,0x535632b3,0x2a3163b7,0x53764b35,0x63d75376,0x63d763d7,0x63d863d7,0x63f863f8,0x63f863f8,0x5bb763f8,0x6c193ad4,0x63f763f7,0x53556c38,0x5bb763d7,0x53565376,0x6c184b14,0x745863b6,0x6c387438,0x63b663d7,0x004542d3,0x63b55311,0x00245353,0x00000000,0x10200000,
-0x8cb78c96,0x7c3594b8,0x39a96b0f,0x00010002,0x4a0b41e9,0x20a520c6,0x00013167,0x6b4f420a,0x6351420d,0x73d33a0d,0x18a220e8,0x5b31424c,0x000031ec,0x10610000,0x08021862,0x10621022,0x62cf2927,0x4a4c39ca,0x63735311,0x10e85b12,0x08860064,0x49ea52ae,0x000020e5,0x00030023,0x84137bd2,0x4a6b18e5,0x00010842,0x10632927,0x188339c8,0x18a36b2d,0x29cb0865,0x3a2f5b52,
-0x53124270,0x3a6f4ab1,0x52f34ad1,0x4af14272,0x3a2d42b0,0x218b31ec,0x10c9320e,0x4af2194b,0x323042b2,0x533242d1,0x3a6f4b11,0x429142b1,0x52f2218e,0x10c95b12,0x19098c77,0x3a2e0046,0x639463b4,0x3a712a0f,0x3a7242b3,0x42d33251,0x63f863b6,0x53552a31,0x4b1442f3,0x5b965bb6,0x5bb65355,0x53975376,0x53765376,0x53965bb6,0x5bb75396,0x53965397,0x53765b97,0x53965397,
-0x4b565356,0x4b565356,0x53764b56,0x4b565356,0x4b565376,0x4b565376,0x53764b56,0x4b564b56,0x4b565376,0x4b565376,0x4b564b56,0x4b564b56,0x4b564b56,0x4b364b56,0x4b365357,0x4b554b56,0x4b554b56,0x4b564b56,0x53565356,0x53764b56,0x4b564b56,0x4b564b56,0x53765356,0x53765376,0x53764b56,0x53765376,0x53764b56,0x53565376,0x53765356,0x53765396,0x53565376,0x53765376,
-0x53965396,0x5b775396,0x5b975b77,0x53975b97,0x42f25376,0x4b154b34,0x5b965335,0x5b962a52,0x4b355b97,0x539732b3,0x5bd75bb7,0x4b763293,0x5b963af4,0x63d75bb7,0x63f863d7,0x63d763d7,0x63f863f8,0x63f85bb7,0x5b7763f8,0x5bb75bb6,0x42f45356,0x63d75b96,0x63d84af4,0x53557459,0x6c1829ef,0x63f76c17,0x5b9663f7,0x00246439,0x63b58477,0x7c587c57,0x0802218d,0x00000020,
-0x74587417,0x94d98cd9,0x739194d8,0x10a32927,0x4a4b0003,0x6b2f2126,0x0002734f,0x6bb431aa,0x637329ac,0x52af3a0e,0x18c420e6,0x20e97c13,0x00000001,0x10200800,0x39cb3145,0x31ab9cd6,0x3a0c8435,0x4acf422c,0x218b52f1,0x088510e7,0x6371632f,0x5b516b94,0x4a6c422c,0x106420e6,0x00030023,0x29680003,0x52cd6b6f,0x0002630e,0x6b0e18c5,0x8c5341c9,0x74350002,0x4270320d,
-0x5b744b12,0x4af24af1,0x196c3a70,0x4af24290,0x424e29cc,0x6394426e,0x320f3a6f,0x00666bb5,0x4ab13a2f,0x2a0f4270,0x00ca21ae,0x327029ee,0x5b3329ee,0x5b12320f,0x194b9519,0x84775b32,0x298c426f,0x322f29ed,0x42d24af2,0x3ad33ab1,0x2a315376,0x198e3a92,0x4b143ab2,0x4b345355,0x4b145355,0x53964b35,0x53965396,0x53965b96,0x53965396,0x53975396,0x53975397,0x53975397,
-0x53765376,0x4b565376,0x4b765376,0x53764b56,0x53765376,0x53565376,0x4b565356,0x4b564b56,0x4b564b56,0x4b564b56,0x4b564b56,0x4b564b56,0x4b564b56,0x4b564b56,0x4b554b56,0x4b565356,0x4b565356,0x4b564b56,0x4b564b56,0x53764b56,0x53764b56,0x53765376,0x53764b56,0x53564b56,0x53764b56,0x53765376,0x53565356,0x53765356,0x53765356,0x53765376,0x53765396,0x53765376,
-0x53765376,0x53965376,0x53975396,0x5b975397,0x42d45376,0x5b975bd7,0x42d55397,0x5b975bb7,0x42f35bd7,0x53764314,0x5bb75bd7,0x5bd85356,0x63f85376,0x63d763f8,0x63d763d7,0x63d763d7,0x6bf863d8,0x63f863f8,0x63f76bf8,0x5b965b97,0x5b966c18,0x6c184b14,0x6c386c18,0x53555396,0x4b135374,0x53755375,0x53555bb6,0x194c5376,0x6bd64a8d,0x5b757416,0x8cfa6bf6,0x00000004,
-0x6bf763b6,0x7c787437,0x84557416,0x5acd0824,0x18c518c6,0x4a4d8432,0x00029cf8,0x5b112128,0x63730887,0x424b5b32,0x42070820,0x00001042,0x08220000,0x8c7528e5,0x8cb7a539,0x84765b52,0x5b31428e,0x2149424c,0x10e70886,0x6b9452d0,0x5b535333,0x53334ad1,0x086652f1,0x10c86352,0x630f3189,0x00039494,0x39eb0001,0x41ea4a2b,0x20e6b599,0x00020803,0x29ec0043,0x320e42b0,
-0x84994290,0x218c4af2,0x42d021ac,0x320d5332,0x31ec324d,0x5b535b11,0x4ab0192a,0x4ad1216b,0x218c0027,0x3a714ad1,0x4b1342d2,0x53355333,0x4b144292,0x29cf3a91,0x53334ad2,0x3a90324f,0x42b13a50,0x194b4291,0x5b740027,0x5b754af2,0x4b345b75,0x42f34b33,0x53753a92,0x53755375,0x53764b14,0x53965396,0x53755396,0x53965396,0x5bb65396,0x53975396,0x53975397,0x53975396,
-0x53765376,0x53765376,0x4b765376,0x53564b56,0x53765376,0x53764b56,0x4b555376,0x4b564b56,0x53765356,0x4b564b56,0x4b564b56,0x4b564b56,0x4b564b56,0x53765356,0x53565376,0x4b565376,0x4b565376,0x4b564b56,0x53764b56,0x53565376,0x53765376,0x4b565376,0x53765376,0x53765376,0x53765376,0x53765376,0x4b555376,0x53764b56,0x53765376,0x53765376,0x53765376,0x53765376,
-0x53765376,0x53975396,0x5bb75396,0x5b975397,0x53965396,0x53975b97,0x53775397,0x5b975b97,0x53775b97,0x5bd72a31,0x5bd75bd7,0x5bd85bb8,0x63d75bd7,0x63d763d7,0x63d763d7,0x63f863d7,0x6bf863d8,0x6c186bf8,0x6c186bf8,0x6bf86c19,0x63f86c18,0x5bb66c18,0x5b985377,0x63d77417,0x4b345bb6,0x42d37499,0x42f37459,0x749a8499,0x94b80865,0x53347c78,0x63957416,0x7c587417,
-0x849894fa,0x63b573f6,0x63516374,0x31883168,0x41ca1084,0x6b714a2c,0x00224a4d,0x7c350004,0x428f1109,0x10a38456,0x10611882,0x08010800,0x9cb718c5,0x192a210a,0x635273f5,0x3a6f29ab,0x31cb426e,0x10660866,0x6b9231a9,0x42b1218c,0x42b031ee,0x5b747c57,0x296b0067,0x31ec73d4,0x528e52ae,0x63304a6e,0x08444a6d,0x318a0866,0x5aef6311,0x10a7318a,0x002318e7,0x2a2c0088,
-0x29cd6bd5,0x198c4af2,0x42905b73,0x428e5b33,0x298b1928,0x0867422f,0x428e29cb,0x6bb35b31,0x00055312,0x4ad129ee,0x42d36bf6,0x4b144b14,0x53555335,0x4b143a92,0x53354af3,0x4b134af3,0x322f3a92,0x112b5313,0x29cd3a90,0x3a5029ce,0x2a303271,0x2a103251,0x3a924b14,0x42d33ab3,0x5bb65b96,0x53555b97,0x53965396,0x53965bb6,0x5bb75bb7,0x5bb75397,0x53975397,0x53975397,
-0x53765376,0x53765376,0x53765376,0x4b765376,0x53765376,0x53765376,0x53764b56,0x4b565356,0x53564b56,0x53764b56,0x4b564b55,0x4b554b76,0x4b564b76,0x4b564b56,0x53764b56,0x4b554b56,0x53765376,0x53764b56,0x53565376,0x53565376,0x53765376,0x53765376,0x53765376,0x53565376,0x53765376,0x4b555376,0x53765376,0x53765376,0x53765376,0x53965376,0x53765376,0x53965376,
-0x53965376,0x53975396,0x5b975376,0x53975397,0x53975397,0x53975397,0x5bb75b97,0x5b975b97,0x53565bb7,0x5bb75bd7,0x5bb75bd8,0x5bd75bb7,0x5bd75bd7,0x5bd75bd7,0x63d763d7,0x63f863d7,0x6bf86bf8,0x6bf863f8,0x6bf86bf8,0x6c396bf8,0x6c186c18,0x6c186c18,0x53766c39,0x5bb763f8,0x537663d7,0x5bb542d3,0x7c9963d8,0x32916c17,0x94d80025,0x4b135b75,0x74577c9a,0x7c3773f5,
-0x84788478,0x73f58498,0x31ca6372,0x31684a2b,0x18c73168,0x5b315b10,0x94977c15,0x422c0001,0x52cf10e7,0x10405b0f,0x08001061,0x8c320800,0x5b122947,0x3a4e7c57,0x63913a4d,0x426d08a6,0x18c60045,0x84343167,0x31ed4a6f,0x29cc5b32,0x53314ab0,0x08877417,0x4a8e5b53,0x424c4aae,0x4a8e18c7,0x216b6393,0x3a2d52cf,0x08a673b3,0x212a0025,0x845639ec,0x637273d3,0x00030043,
-0xa5372988,0x000110e6,0x00230023,0x296a3a4c,0x7c146351,0x422e31ab,0x3a2e5b31,0x216b3a0d,0x3a4f110a,0x4ad2112b,0x4af36395,0x5b9642f3,0x53555376,0x3a925335,0x53353a92,0x63b55334,0x31ee6bf6,0x3a4f112b,0x53136394,0x42b1320f,0x42f33ab2,0x535542b2,0x32515b75,0x53763ab2,0x53764b35,0x4b564b56,0x4b564b56,0x53765b97,0x5b975b97,0x53975397,0x5b975b97,0x53975bb7,
-0x53765397,0x53765376,0x53765376,0x4b765376,0x53764b76,0x53765376,0x53565376,0x53765376,0x53765376,0x53765376,0x4b765376,0x4b764b76,0x53764b76,0x53765376,0x53765376,0x53765376,0x53565356,0x53765376,0x53765356,0x53765376,0x53765356,0x53765376,0x53765376,0x53765376,0x53765376,0x4b565376,0x53765356,0x53765376,0x53765376,0x53975356,0x53765376,0x53965376,
-0x5b975397,0x53975b97,0x53975397,0x5bb75397,0x5bb75bb7,0x5bb75396,0x5bb75397,0x5b975b97,0x5b975bb7,0x5bb75bb7,0x5b975bb7,0x63f75bd8,0x63f75bd7,0x5bd763f7,0x63d763d7,0x63f863f8,0x63f863f8,0x6bf86c18,0x6bf86bf8,0x6bf86bf8,0x6c186bf8,0x6c396bf8,0x63d763f8,0x63d85b97,0x5bb75b96,0x42d363d7,0x745884da,0x19ce42b2,0x216a0004,0x6bd673f5,0x218e6bf8,0x84da6c17,
-0x7c7884b9,0x73f57417,0x422b426f,0x41ca41ca,0x31cb41ea,0x52f194b7,0x9cd66b93,0x00240002,0x29690024,0x00001061,0x08200000,0x214829a7,0x318e318b,0x216a31ab,0x00033a0d,0x08420001,0x10640002,0x00040024,0x00020003,0x00020844,0x00030003,0x00200003,0x00230001,0x29480023,0x002531a9,0x5b115b51,0x192a31ed,0x5b335b33,0x7c3652d2,0x0000318b,0x63930003,0x000052ee,
-0x6b7152ad,0x00020023,0x00020022,0x635139ea,0x10c7528e,0x3a0d0003,0x31cc192a,0x002631ed,0x4ad13a4f,0x53546395,0x53544af3,0x4b1463d6,0x5b963ab2,0x63d75bb6,0x198d3251,0x4af55355,0x5b555b75,0x114c4b33,0x535342b2,0x21cf52f1,0x42d242b2,0x53554b14,0x537542f3,0x42f44af4,0x53555376,0x5bb75396,0x53765376,0x53765396,0x4b564b55,0x5bb75397,0x5b975b97,0x5b975bb7,
-0x53765376,0x53575357,0x53765357,0x53565376,0x53765376,0x4b565376,0x53765376,0x4b565356,0x53565376,0x53765376,0x53764b56,0x4b765376,0x53765376,0x53765376,0x53765376,0x53565376,0x53765376,0x53765376,0x53765376,0x53765376,0x53765376,0x53765376,0x53565357,0x53775377,0x53565376,0x5bb75356,0x53565376,0x53965376,0x53765376,0x53765376,0x53765376,0x5bb75376,
-0x5b975b97,0x53975b97,0x53965b97,0x5b975396,0x53975bb7,0x53975397,0x5bb75bb7,0x5bb75bb7,0x5b975bb7,0x5bb75b97,0x63d85bd7,0x5bb75bd8,0x5bd85bd8,0x5bd85bd8,0x63f863d7,0x63d763d7,0x63f863f8,0x6bf863f8,0x63f86c18,0x6c186bf8,0x6c3963f8,0x6c186c18,0x6c386c18,0x63f86c18,0x6c3863f8,0x6c386c37,0x3af24b54,0x00877457,0x002684b8,0x4af26b30,0x3a933231,0x8cda2a30,
-0x74377c78,0x4ad07416,0x8c5531eb,0x8c752969,0x296a31aa,0x6bb46331,0x52d06352,0x210318e6,0x10811081,0x00000000,0x00000000,0x00010001,0x21270002,0x00210022,0x00020021,0x00000002,0x4a4b0822,0x5acf52cf,0x8435424c,0x73d25b0f,0xa5590865,0x63528c97,0x08628414,0x00010001,0x4aaf4a6d,0x8cb7298b,0x6bb44270,0x63954291,0x63b44af3,0x4ab07c15,0x4ad1424c,0x73b24a6e,
-0x00021084,0x10a51084,0x08652968,0x31ab1066,0x5b12294a,0x6b73424f,0x214a4ad0,0x63733a2d,0x192b216c,0x4b13320f,0x6bf75334,0x5b965b95,0x5b755b96,0x3ab25b75,0x327163d7,0x42d4198f,0x42d35bb7,0x3a9242d3,0x3a71114d,0x42d24ad1,0x4b333a91,0x42f34b14,0x5b965b96,0x4b145bb7,0x4b155bb7,0x5bb65355,0x5bb65bb6,0x5bb65bb6,0x5bb75bb6,0x5bb75bb7,0x5bb75397,0x53975376,
-0x53765376,0x53575377,0x53765357,0x53765376,0x53765376,0x53765376,0x53764b56,0x53765376,0x53765376,0x53765376,0x53765376,0x4b765376,0x53764b76,0x53765376,0x53765376,0x53565376,0x53565376,0x53965376,0x53565376,0x53565356,0x53765376,0x53565356,0x4b565357,0x53775357,0x53765356,0x53764b56,0x53765376,0x53965376,0x53965356,0x53765376,0x53965bb7,0x53965396,
-0x53975b97,0x53975397,0x5b975397,0x53975396,0x53975b97,0x5bb75397,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bd75bb7,0x5bd75bd7,0x5bd85bd8,0x5bd75bd8,0x5bd85bd7,0x63d763d7,0x63f863d7,0x6bf863f8,0x6bf86bf8,0x6c186bf8,0x6bf86c18,0x6c186c18,0x6c396c18,0x6c186c38,0x74396c18,0x63d863f9,0x74586c38,0x5bb663f7,0x42b242b1,0x08eb4ad3,0x6bd42107,0x74366bd5,0x6bf76bb5,
-0x6bd67c58,0x428e5b52,0x420c4ace,0x8455424d,0x0886298a,0x4ab0528f,0x6bd57c56,0x0840422b,0x10400820,0x08200000,0x00020000,0x18a42926,0x108418c3,0x31a83168,0x7bd1528c,0x31688453,0x5acf318a,0x420c2969,0x6b942169,0x08866371,0x3a0e6371,0x08a76bb4,0x086418e5,0x10a539ca,0x00040003,0x00070023,0x31ee08a8,0x32514b34,0x6bd663f7,0x63734ab0,0x00a552f1,0x52ce6370,
-0x18e40023,0x29689cf6,0x4a2d630f,0x420e18c8,0x4a914a6f,0x3a0d420f,0x424e7c36,0x192a6bb4,0x322f194b,0x42d25312,0x6bf742d3,0x5355114c,0x4b145375,0x4af33a92,0x4b344b14,0x3ab363d7,0x42f44b56,0x53554b14,0x42b263d7,0x4af36375,0x6c175354,0x53553ab3,0x53754b14,0x5bb75335,0x4af45376,0x5bb64b55,0x5bb65bb6,0x5bb65bb6,0x5bb75bb6,0x5bb75bb7,0x5bb75397,0x53975b97,
-0x53765376,0x53575377,0x53765357,0x53765376,0x53765376,0x4b565376,0x53975376,0x53765376,0x53565376,0x53765376,0x53765376,0x4b765376,0x53764b76,0x53765376,0x53765376,0x53565376,0x53565376,0x53965376,0x53765376,0x53564b56,0x53765376,0x53565356,0x53775357,0x53575357,0x53965356,0x53975376,0x53765376,0x53765376,0x53965376,0x53765376,0x53965356,0x53965396,
-0x53975b97,0x53975397,0x5b975397,0x53975396,0x53975b97,0x5bb75397,0x5bb75bb7,0x5bb75bb7,0x5bd75bd7,0x5b975bd7,0x5bd75bd7,0x5bd85bd8,0x63f85bd8,0x5bd863f8,0x63d763d7,0x63f863d7,0x6bf863f8,0x6bf86bf8,0x6c186bf8,0x6bf86c18,0x6c186c18,0x63f86bf8,0x6c386c38,0x74396c18,0x743a6c1a,0x6c585b96,0x32727458,0x322e7438,0x6c153a8f,0x94d60044,0x5b546bb6,0x5b757c37,
-0x5b546bf6,0x31ca4ad0,0x39eb4a4d,0x21296b92,0x31a831a8,0x743731eb,0x00238cf9,0x00002923,0x08000000,0x522a1000,0x94989cb7,0x52d094b8,0x39ec52af,0x52f273b4,0x3a0d52d3,0x422e6352,0x31ac0026,0x9d18528e,0x10c82129,0x29890005,0x192a294a,0x39eb0025,0x73b318c6,0x5af039ee,0x5aef2989,0x3a2c52ef,0x00022968,0x00230043,0x73f52128,0x42516bd3,0x6b714ab0,0x3a0a0001,
-0x084339c9,0x422e52f0,0x424e39ec,0x424e4aaf,0x52d1422d,0x29ed73d5,0x42703a2e,0x6bd5218c,0x3a704af2,0x32504b32,0x533442b2,0x3ab242d2,0x114d3291,0x42d319af,0x5b9563b7,0x4b3463f7,0x5b965376,0x5b755334,0x4b1463b6,0x42d342d3,0x53755b96,0x42d35355,0x4af442f4,0x5b965376,0x4b554b55,0x42f45376,0x5bb75376,0x5bb65bb7,0x5bb75bb7,0x53965bb7,0x5bd75bb6,0x5bb75bb7,
-0x537653b7,0x53765376,0x53765376,0x53575376,0x53765377,0x53765376,0x53765396,0x53565376,0x53765397,0x53775357,0x53765377,0x4b765376,0x53764b76,0x53765376,0x53565376,0x53765376,0x53765376,0x53765376,0x53764b56,0x53764b76,0x53765376,0x53765396,0x53775377,0x53575377,0x53765376,0x53565356,0x53775377,0x53965377,0x53765376,0x53765376,0x53975396,0x5b975396,
-0x53765bb7,0x53975b97,0x53975396,0x53975397,0x53975397,0x5bb85397,0x5bb75b97,0x5bd85bb7,0x5bd75bb7,0x5bd85b97,0x5bd75bb7,0x5bd85bd8,0x63f85bd8,0x5bd75bd7,0x63f763f7,0x63d763d7,0x6bf863d8,0x6bf863f8,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c386c38,0x74596c38,0x6c386c38,0x53567459,0x21ee6c17,0x2a0f4b33,0x7415322e,0x3a0b0004,0x4a6f0046,0x74166bd4,
-0x3a705b74,0x52ad3a0c,0x6b3052ae,0x8415424d,0x002273b1,0x4a8f6b92,0x20c10863,0x00001040,0x10610820,0x843618a1,0x73f67bf6,0x4ab08478,0x216b8497,0x4b348c98,0x84557459,0x426d424e,0x21496b92,0x000410a6,0x08450005,0x10a50025,0x00250004,0x00021907,0x5b3010a6,0x4ace4ad0,0x194810c7,0x6bb46bb3,0x6bb363d5,0x8c940000,0x21470003,0x00220003,0x31aa422d,0x004310e6,
-0x00015aee,0x298c10e5,0x3a0d298b,0x5b114a6e,0x29ac10e8,0x320e3a6f,0x29ad3a2e,0x53125b53,0x533342b1,0x3a714b12,0x2a0f5b95,0x29cf5334,0x6bd729cf,0x537663b6,0x5b9763d7,0x535663f8,0x5b9663d7,0x63d75375,0x4b145bb6,0x42d342f3,0x5b965356,0x4af45355,0x63b74b35,0x4b355356,0x5bd75396,0x53764b55,0x53975397,0x5bb75bd7,0x5bb75bb7,0x5bb65bb6,0x5bb75bb7,0x5bb75bb7,
-0x53765397,0x53765397,0x53965376,0x53775376,0x53765377,0x53765376,0x53765376,0x53765376,0x53765376,0x53775377,0x53765377,0x4b765376,0x53764b76,0x53765376,0x53765376,0x53765376,0x53765376,0x4b565376,0x4b765376,0x53765376,0x53565376,0x53765376,0x53774b77,0x53775377,0x53765376,0x53775377,0x53775377,0x53975377,0x53765376,0x53765397,0x53975397,0x53975397,
-0x53765bb7,0x53965b97,0x5b975397,0x53975397,0x53975397,0x5b985397,0x5bb75b97,0x5bb75397,0x5bb75bb7,0x5bb75bb7,0x5bd763d8,0x5bd85bd8,0x5bd85bd8,0x5bd85bd8,0x63f863f8,0x63f863d7,0x63f863f8,0x6c1863f8,0x63f86bf8,0x6c186c18,0x6bf86c18,0x6c186c39,0x6c187438,0x6c3863f7,0x63f76c38,0x4b566c38,0x53742230,0x42f24b33,0x42b02a0e,0x00441908,0x18e74a8d,0x4ab039ec,
-0x3a0d52f1,0x4a4c31aa,0x424c420a,0x7c378476,0x4a8e428e,0x108229cb,0x18a11060,0x00001000,0x10410800,0x5b5318a5,0x53335b74,0x847808c8,0x7c574270,0x5b557c9a,0x19085311,0x108652cf,0x00440865,0x10c60843,0x739439cd,0x7c158456,0x6b7418e9,0x63726b95,0x7c34bdfb,0x000231ca,0x4aae10c6,0x218b214a,0x63b53230,0x002294d8,0x5acd9494,0x31c90843,0x18e60002,0x00034a4c,
-0x00030002,0x08450002,0x73f47bf4,0x635231cd,0x29cd5b11,0x0047322e,0x322f112a,0x531229ad,0x53553a90,0x42b163b6,0x32514af2,0x63b56bf8,0x53753af3,0x63d75b96,0x63f863d7,0x5bb663d7,0x5bd75bd8,0x4b5563f8,0x5b765b96,0x42d35b96,0x53355376,0x53765355,0x5bb75b97,0x53765355,0x5bb65bb7,0x5bb75376,0x5bb75bd8,0x5bb75bb7,0x5bb75bb7,0x5bb65bb7,0x5bb65bb6,0x5bb75b97,
-0x53965396,0x53765376,0x53765376,0x53775376,0x53775377,0x53775377,0x53575377,0x53775377,0x53775377,0x53775377,0x53575377,0x53765377,0x4b765396,0x53765396,0x53765376,0x53765376,0x4b764b76,0x5bb75356,0x53575376,0x53765377,0x53765376,0x53765376,0x4b774b77,0x53775357,0x53775377,0x53575357,0x53775377,0x53765377,0x53975396,0x53965376,0x5bb75396,0x5b975b97,
-0x53975397,0x5bb75397,0x53975397,0x5b975b97,0x53975bb7,0x5bb75397,0x5bb75b97,0x5bd85bb7,0x5bb75bb7,0x5bb75bb7,0x5bd75bd7,0x63d85bd8,0x5bd85bd8,0x63f85bd8,0x63f763f8,0x641863f8,0x63f863f8,0x6bf86bf8,0x6bf86bf8,0x6c186c18,0x6c186c18,0x6bf86c18,0x63d863d7,0x5b9763d8,0x53765b97,0x5bb763d8,0x749963d7,0x5b946c16,0x21cd3a90,0x08641988,0x5af083f2,0x18e8ad5a,
-0x73b3298b,0x39896330,0x94f8424a,0x424f8c98,0x18a45b2f,0x104118a2,0x104120c2,0x08008411,0x20a20800,0x63324a6d,0x424e6bb4,0x94f75b11,0x3a6f73f3,0x00044b13,0x00020002,0x10840043,0x5aae3168,0x7c152147,0x29ce7c37,0x425008a9,0x74386b95,0x5b757438,0x00263a0f,0x3a0b0065,0x424c08a6,0x7c560886,0x84b97c39,0x8c755b14,0x18a618a5,0x63500003,0x422b0002,0x00230043,
-0x31683168,0x00010002,0x00260024,0x298b2129,0x00054a8f,0x320d21ab,0x322e218b,0x74166394,0x4af342f2,0x4af363d6,0x6bf75b74,0x3293194d,0x4b154b35,0x63d75b76,0x63f763d7,0x5bb763f7,0x63d75356,0x5bd75bd7,0x53555376,0x4b355335,0x53764b14,0x5bb75b96,0x4b555356,0x5bb75bb7,0x5bb75bb7,0x5b965bb7,0x5bb75bb7,0x5bd75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,
-0x53965397,0x53965bb7,0x53765396,0x53775376,0x53775377,0x53575377,0x53775357,0x53775377,0x53775377,0x53575377,0x53575377,0x53965377,0x53765396,0x53765376,0x53765376,0x53765376,0x4b765376,0x53765376,0x53575376,0x53765377,0x53765356,0x53765376,0x53775377,0x53775377,0x53775377,0x53775377,0x53775377,0x53975377,0x53975397,0x53965396,0x53965397,0x5b975376,
-0x53975397,0x53975397,0x53975397,0x5bb75b97,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bd7,0x5bb75bd8,0x5bd85bb7,0x5bd75bb7,0x5bd85bd8,0x63f85bd8,0x63f863f8,0x63f85bd7,0x63f863f7,0x6bf863d8,0x6c1863f8,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c186c18,0x6c386c38,0x74386c18,0x74586c18,0x43147478,0x42b15334,0x3ab12a2f,0x004419cc,0x7c130022,0x39ec7bf6,
-0x637173f3,0x734f3189,0x0005736f,0x9d187cb6,0x20c20000,0x29221020,0x637139a7,0x10010822,0x08000800,0x18c50822,0x00020843,0x08430022,0x10a40002,0x00010002,0x00010001,0x632f18c5,0x6bd58c96,0x52f27c78,0x08a96395,0x63953a30,0x74597459,0x6bf66c38,0x6bb55355,0x6bd57416,0x63946353,0x3a2e951a,0x00050046,0x00031909,0x08440865,0x8435630f,0x08835b51,0x6b6f2126,
-0x4a2d422c,0x31a92967,0x000210a3,0x4acf0002,0x31cb1949,0x00451908,0x4ab1216b,0x3ab05b53,0x090c4ad2,0x953b3210,0x21ce6bf6,0x7c7a7438,0x63f75335,0x5bd74b56,0x5bd763f7,0x63d763f8,0x5bd75397,0x5bd85bd8,0x5b9663d7,0x4b355355,0x4b344b35,0x5bd75bd7,0x4b564b56,0x5bd75397,0x5bd85bb7,0x5bb75bb7,0x5bb75b97,0x5bb75bb7,0x5bb75bd7,0x5bd75bb7,0x5bb75bb7,0x5bb75bb7,
-0x53965bb7,0x53965396,0x53975396,0x53965396,0x53975376,0x53965397,0x53765396,0x53965396,0x53775377,0x53765396,0x53775376,0x53775377,0x53775377,0x53775377,0x53775377,0x539753b7,0x4b775397,0x53965396,0x53765396,0x53765376,0x53765396,0x53765376,0x53775377,0x53975356,0x53775377,0x53765376,0x53965397,0x53765396,0x53965397,0x53965396,0x5b975396,0x53975397,
-0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5b975bb7,0x5bb75bb7,0x5bb75bb7,0x5bd75bb7,0x63f85bd8,0x5bd85bd7,0x5bb75bd7,0x5bd863d8,0x5bd863d8,0x63f85bd8,0x63f763f7,0x63f763f8,0x6bf863f8,0x6bf863f8,0x6bf86bf8,0x6bf86bf8,0x6c186c18,0x6c396c18,0x6c186c39,0x74596c38,0x6c386c38,0x74597459,0x53356c38,0x3af263f7,0x74363a90,0x31eb116c,0x29280843,0x41ed5acf,
-0x00459d19,0x7bf24a6c,0xce7e7c35,0x002152b0,0x18601060,0x39a62903,0x080020e3,0x18621020,0x10410800,0x08010800,0x20c40001,0x00010001,0x00010001,0x08420002,0x08431063,0x00030002,0x19280003,0x00678458,0x7c160026,0x743873f7,0x74597459,0x5b9563d7,0x6bb76bf7,0x74397418,0x6c1729b0,0x63b56396,0x9539194a,0x8c980006,0x422c4a6f,0x8c587c34,0x6b70216b,0x2968634f,
-0x41ec0844,0x29476b51,0x6b702126,0x00035ace,0x00030002,0x320b6b91,0x318b4acf,0x8cd8ad7a,0x63d5218b,0x42d229ce,0x42b15b95,0x198e63d6,0x537663f8,0x5b965bb7,0x63d763f7,0x63f763d7,0x5bd763f8,0x63f85bd8,0x5bb75376,0x53765b76,0x5bb65b96,0x5bb75bb7,0x53975b97,0x4b155376,0x5bb74b56,0x5bd85bd7,0x5bd85bb7,0x5bd85bb7,0x5bb75bd7,0x5bd75bb7,0x5bd75bd7,0x5bb75bd7,
-0x53765397,0x53965397,0x53765396,0x4b765397,0x53975397,0x5b975377,0x53765376,0x53765397,0x53775397,0x53975376,0x4b775376,0x53975397,0x53975377,0x53775377,0x4b775377,0x53764b76,0x4b565377,0x4b764b76,0x53765396,0x53965376,0x53765397,0x5b975b97,0x53775397,0x53765396,0x53775377,0x53975376,0x53765397,0x53965396,0x53975397,0x5bb75bb7,0x5b975bb7,0x5b975397,
-0x5bb75bb7,0x5b975bb7,0x5bb75397,0x5bb75bb7,0x5bd75b97,0x5b975b97,0x5b975bd8,0x5bb75bb7,0x5bd75bb7,0x63f85bd7,0x5bd85bd8,0x5bd85bd8,0x5bd863f8,0x63d863f8,0x63f763f8,0x641863f8,0x63f863f8,0x6bf863f8,0x6c186bf8,0x6c186c18,0x6c186c18,0x6c396c18,0x6c396c39,0x6c386c38,0x74597459,0x6c186c38,0x63d87459,0x19ae63d7,0x4ad23ab2,0x428f08c9,0x4a0b0023,0x528e316a,
-0x298b190a,0x74355ace,0x31ec7436,0x10600002,0x28e20800,0x00004a27,0x10000800,0x18821821,0x08001021,0x3105628a,0x20c449e8,0x83f0734e,0x734e39a7,0x00013166,0xbddabdd9,0x20e64a4c,0x00220002,0x08670022,0x00466310,0x6bd68479,0x74386bf8,0x74594b14,0x6c1763d6,0x6c166c37,0x63b65b79,0x6bf85b77,0x53346bf8,0x08ca8c9a,0x426e6374,0x424e0025,0x6b716372,0x108562ef,
-0x5af018c6,0x420b18a8,0x18e75acd,0x4aae420c,0x4a6e6b92,0x6bb431cc,0x429052d1,0x3ad142b1,0x53344271,0x5b558cd9,0x4af24b13,0x32724b13,0x21f16c18,0x53965395,0x63d763f7,0x63f763d7,0x53766419,0x63f85bd8,0x63d75b96,0x53555b96,0x5bd763d7,0x5bd75bd7,0x63d85397,0x5bd85396,0x5bd85bb7,0x5bd85bd7,0x5bb75397,0x5bd85bb7,0x5bb75bd7,0x5bd75bb7,0x5bd75bd7,0x5bd75bd7,
-0x53765bb7,0x53965397,0x53975396,0x53975397,0x4b775396,0x53765377,0x53765b97,0x53765397,0x53775377,0x53975397,0x4b775376,0x53975397,0x4b775377,0x53775377,0x53975377,0x53765396,0x53775377,0x53965396,0x53965396,0x53965376,0x53765376,0x53765376,0x53775397,0x53975396,0x53775397,0x53975376,0x53975397,0x53965396,0x53975397,0x5bb75bb7,0x53975376,0x53765397,
-0x5bb75397,0x5bb75bb7,0x5bb75397,0x53965bb7,0x5bd75b97,0x5bb75b97,0x5bb75bb7,0x5bb75bd7,0x63f863d8,0x5bb763f8,0x5bd85bd8,0x5bd85bd8,0x63f85bb7,0x63f85bd8,0x63f763f8,0x641863f8,0x63f863f8,0x6bf863f8,0x63f86bf8,0x6c186c18,0x6c186c18,0x6c396c18,0x6c396c39,0x6c386c38,0x74597459,0x63f76c18,0x53576bf7,0x2a514b35,0x29ef7439,0x6bd53a2e,0x39680044,0x7bf218e8,
-0 };
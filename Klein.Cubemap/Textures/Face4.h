@@ -1,1052 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT const unsigned int
-#endif
-
-A32BIT Face4[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x00000100,		/* dwHeight */
-0x00000100,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00010013,		/* dwpfFlags */
-0x00020000,		/* dwDataSize */
-0x00000010,		/* dwBitCount */
-0x0000f800,		/* dwRBitMask */
-0x000007e0,		/* dwGBitMask */
-0x0000001f,		/* dwBBitMask */
-0x00000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x20a028e0,0x29002080,0x39413961,0x39613140,0x49834982,0x31214984,0x30e13942,0x39223922,0x186120a0,0x29241020,0x8c314208,0xacd49cd3,0xacd49c32,0xacb3b515,0xa473bd35,0x9c10a472,0x7aab9bf0,0x31424103,0x398641e7,0x52693165,0x7b8e6b2c,0x83cf83f0,0xad3483af,0x9cb2a4f3,0x4a0828a3,0x8bf09c52,0xa4d3acf4,0x41e762aa,0x84305289,0x31448c0f,0xcd75a491,0xb513c554,
-0xbd75b4d3,0x7b6da4f3,0x62286a49,0x51654945,0x8b8e5986,0x6249a451,0x49c75208,0x29043145,0x18e32103,0x290310a1,0x4a283165,0x5a8a5249,0x41a641c7,0x418741c7,0x51e828e4,0x7b4bb513,0xb513bd13,0x62a9cdb5,0x4a0762aa,0x6aea4a07,0xb4d1a4b1,0xcd75ddf5,0x5a0372c8,0x4a064184,0x52884a06,0x4a274a47,0x522639a4,0x49c34a05,0x6a876a87,0x59a2832a,0x92c361c4,0xb3e7d52d,
-0xc46ab3e8,0x9367bc0a,0x7aa24960,0x9b659bc7,0xbcec9343,0xa48cb4ca,0xc531e5f1,0xc530d5b2,0x93459beb,0xd54ee5d0,0xbc6abc8c,0xbc6abc4a,0xfed3ccec,0x6a24e631,0xc531c4ef,0x72a5a44d,0x7ac36a62,0x6a437a63,0x18404160,0x20202000,0x71c130a0,0x7a825140,0xe5d4ff79,0x7aa0ffbe,0xbd31bc8e,0x4141b4af,0x6a8338e0,0x49805180,0x39601860,0x28a04161,0x28803920,0x10001820,
-0x30601800,0x92e861c3,0xc512abed,0xb4b0c532,0x18004121,0x18223960,0x08001000,0x18401000,0x20201820,0x18201800,0x10002080,0x30e11840,0x39220000,0x188128c1,0x5a690000,0x00000000,0x00000000,0xa4b30861,0x59c2bd53,0x6a4461e3,0x6a246203,0x62016a42,0x83267aa2,0x59a06a81,0x83058326,0x83068305,0x9bc99bc9,0xa3a99388,0xc42cb3cb,0xff19f5b5,0xffdfff7d,0xfffffffe,
-0x31413962,0x28e020a0,0x49e33141,0x394049c3,0x39413120,0x41623920,0x31013100,0x38e23921,0x20a12060,0x29441040,0x94b35b0b,0x9c92ad35,0xad149c72,0xad14b535,0xacd3acf4,0xa451acb3,0x8bce93ef,0x38e44905,0x312449c7,0x39653124,0x41c73124,0x7b8e41e7,0x94318bcf,0xa4b39c92,0x5a294166,0x94318bf0,0xb57683ef,0x4a0739a6,0x21244a07,0x31653185,0xbd555a89,0xc596c5b6,
-0xb534c5b6,0xa4d3b534,0xb4f4a4b2,0x832dac92,0x9c10830c,0xc5b6c596,0x838e9451,0x30e46269,0x18613104,0x290420a2,0x52493965,0x5a6a5a8a,0x396649e8,0x41a73966,0x398628e4,0xbdb641c6,0xb574b574,0x4a478c2f,0x4a075248,0xa4b24a07,0xbd13b534,0xbd54c554,0x6245838b,0x41a549a4,0x4a275227,0x4a2741e7,0x49c55206,0x5a065227,0x93297287,0x8ae6ac4e,0xc4d0a3c9,0xb429fe95,
-0xccacb409,0x7a83d50c,0x93456201,0x7aa08b03,0x6a616a60,0x72c172a1,0xb4cc93aa,0x9389ac4c,0xcd6f6a64,0xbc8bb4aa,0xd56fb46a,0xc4edddb1,0xcd4dc4ed,0x9346ac6c,0xcd51c551,0x6a437ae7,0x82a482e7,0x49207220,0x18005a01,0x7a232000,0x932361e0,0x61a069e0,0x72405961,0xb46c7201,0xb4d0bcf0,0x2000a42d,0x38e12000,0xb4cd2821,0x39016243,0x38e03900,0x30c03901,0x38c22841,
-0xdd454880,0xb4b0b491,0xcd52ddf5,0xbcd0ddd4,0x30812060,0x100028a0,0x10001020,0x08001840,0x08002881,0x7b2c1000,0x100051c5,0x31024985,0x62872040,0x20815a47,0x316528e3,0x00000000,0x00000000,0xad147bef,0x59c29c4e,0x62017203,0x61e159c0,0x83247284,0x8b467ac4,0x938882e5,0x82e58305,0x8b2682a4,0xa3688b05,0xbcd17225,0xff5cf6b9,0xffdfffbd,0xffffffdf,0xffdeffff,
-0x41a320c0,0x39613942,0x28c03100,0x396228e0,0x41614184,0x41413100,0x39213921,0x39413942,0x080028c0,0x292320a0,0x6b6e630b,0xad14ad14,0xbd76b555,0xad14a4d3,0xa493a4b3,0xac939431,0x93f1acb4,0x49258b4d,0x39454966,0x312428e3,0x31653145,0x5a8a41e7,0x7b8e7b4d,0x9451b535,0x94319410,0x94319451,0x9cb39c92,0x4a075aa9,0x42284a28,0x31a52945,0xbe1639c6,0xb5d594d1,
-0xb574a513,0x840f9471,0xa4929430,0xac92bcf4,0x9c10ac92,0xacf3a4b2,0x9c719c71,0xa4b29430,0x28a39430,0x392530e4,0x522841c7,0x5a8a5228,0x41a75a6a,0x39663125,0x4a284186,0x000041c7,0x31448c2f,0x41e66b0b,0x41e74a27,0x28e35269,0xc595b534,0xad12eeda,0x9c30c595,0x5a47a470,0x49e75206,0x4a484a28,0x49e66288,0x51c55a68,0xac0c72a8,0xdd8fb42a,0x6a83d591,0xc4abac08,
-0xd4aabbe8,0xa385f610,0x726082a0,0xb46cac4a,0x72a1b4ac,0x8b247ac3,0x8b279366,0x9beba3ec,0x93c88327,0xac2aabe9,0xa42a8b87,0xc50dbccd,0xb4abc4cc,0x5140ac2b,0xb46fc552,0x9b4a82e7,0x7a857201,0x8b078ac5,0x28005a00,0xfe51b344,0xb46c82c3,0x38809b88,0x932648e0,0xc532c531,0xa44cac8e,0x6a438325,0x62014920,0x20008b26,0x40e04100,0x59817242,0x38a038a0,0x8aa24940,
-0xd5f0fef5,0xcd526224,0xddf5bd11,0x7248cd53,0x20202860,0x10001800,0x41622040,0xa46f49a4,0x18201000,0x30e21000,0x08003101,0x30a07ae9,0x8c2f49c5,0x39c7ffde,0x00000000,0x00000000,0x6b0c20a3,0x5a69732d,0x8b6acdd5,0x61c17223,0x61c061c0,0x8b287285,0x82e593a9,0x8b268b06,0x92e78ae7,0x82869b07,0xff5c8288,0xff7dff9d,0xffffffde,0xffdfffff,0xffbfffff,0xff5dffdf,
-0x39403100,0x39413100,0x28c028a0,0x31002880,0x49a351c5,0x49c33940,0x39213100,0x41823942,0x28c03941,0x29223142,0x634d5269,0x9cd394b2,0x9c9294b2,0x8c31a4d3,0x9c52a4d3,0xacd49c31,0x93afa472,0x7aeca431,0x49467a4a,0x39444186,0x31653944,0x4a0741c7,0x8baf5a6a,0x9c529c31,0x9c729431,0xb5559451,0xa4f39cb2,0x5208cdd8,0x52695248,0x41e741e7,0x31a631c6,0x21244228,
-0x632c4207,0x31654a68,0x8bcf5a89,0x9c30acb2,0x9c10b4b3,0xa472ac72,0x734c9c51,0x9cb28c50,0xa4519430,0x49654926,0x5a085a28,0x5a4a5a08,0x41c75229,0x522849e7,0x5a894a08,0x4a0839a6,0x52696b2c,0x4a284a28,0x4a075a68,0x31444a07,0x94301040,0x8c509c71,0xce17ad54,0x832cbd34,0x49e56a48,0x42064a27,0x5a275207,0x6a484984,0xac098308,0xee32feb2,0x82e5cd2e,0x82a2c4ee,
-0xed8ee54e,0xc448c469,0x932492e2,0xabe98ae3,0xa42a8b46,0x62407aa4,0xbd2fbccd,0x72a5ac8e,0xac6d8306,0xcd71de33,0x9bc88386,0xac6aa42a,0xac8cb4ac,0xac8f72a6,0x9bccc532,0x9b8a9b6a,0xb48e8b07,0xcd12ac6d,0xf5ad7241,0xc4a9fef3,0xb46d9347,0x8b678b47,0x8b07b46c,0xbcf0c552,0x61e2938a,0x59208b02,0x62017a00,0x596138a0,0x938561a0,0x2800a3e7,0x83073060,0xe52bbc28,
-0xc511fff9,0xa46e9387,0x8b29ac6e,0x59434942,0x18003081,0x30c11800,0x10201000,0x28801000,0x18401000,0x41e51000,0xdd509bcd,0x10005162,0x00000000,0x00000020,0x00000000,0x31860000,0x000010a2,0x10200800,0xc4d1c555,0x72426160,0x72435180,0x93487aa5,0x8ae67ac6,0x8a859327,0x9b2aa349,0xee57b46f,0xfebae637,0xffdfffbd,0xffffffff,0xffdfffff,0xffbfffbf,0xff9dffbe,
-0x18201860,0x39413100,0x184028e0,0x18202881,0x41613920,0x41a44983,0x39403941,0x394128c0,0x31003941,0x28c020a0,0x6b2c20c1,0x7bef7bef,0x8c108c71,0x83ef736d,0x94317b8e,0x9c928c10,0xa492a4b3,0x8bcf9c72,0xa45193f0,0x390459a7,0x316528e3,0x4a0841e7,0x93f07b4d,0xa47293f0,0x9c729451,0xa4d38c10,0x4a089cb2,0xc5d7b596,0x59e74985,0x4a0741a5,0x29443185,0x4a484228,
-0x3a074228,0x41e641e6,0x83ef39c6,0xbd75b513,0xacb2b534,0xbd75a471,0x8c109c71,0x945183cf,0x93ef9c71,0x834da472,0x59a76208,0x7aec6a29,0x51a759e8,0x41c74a08,0x31653145,0x39864a08,0x41e74a07,0x41c639c6,0x52685268,0x49e75aa9,0x39644a07,0x52486ac9,0x8c505248,0xa4b1acf2,0x72e9b4d2,0x52685268,0x5a895249,0x730b6aa9,0xcd718b8a,0xc4acee10,0x8ac5a388,0xccab8ac5,
-0x7a60e58e,0xd4cbf5cf,0xa323c449,0xa366abc6,0x6a429325,0x7a2261e0,0x40c069e0,0x49408b26,0x83078b88,0x9bc8b46d,0x8b668b47,0x9be98326,0x93aa93a9,0xb4b0a40d,0xbcd1bcf1,0xbcb0ac2e,0xbcd0bcf1,0xc4f1bcf0,0x8b48dd73,0xabe8ee0c,0x6a01a3c8,0xb44b9b67,0x9b89c4ef,0xb4d0bcf0,0xedb06204,0xab40cc67,0xab23dc45,0x696079c0,0x7ac082e4,0x9349a408,0xcd8f6a20,0xffbae6b6,
-0x2000d5cf,0x20003040,0x6a076a07,0xab673800,0x10002000,0x18003922,0x734a30e1,0x10007b6b,0x28e20800,0x08600800,0xeed7c572,0x734b3943,0x00000000,0x00000000,0x00000000,0x00000000,0x10001021,0x93692020,0xee78f71a,0x8245ab8a,0x822471a2,0x8a858aa5,0x8ac792e8,0xfeb98ae9,0xff5cf6b9,0xff5cf6bb,0xff7dff1c,0xffdfff9e,0xffffffff,0xffffffff,0xffbfffdf,0xf6fbeedb,
-0x310028a0,0x31003921,0x49a33941,0x28a030e1,0x39212080,0x39204162,0x39403941,0x394128e0,0x18403941,0x30e130e1,0x08201880,0x00213184,0x7bf04a8b,0x7b8e83f0,0x736e83cf,0x947183f0,0xa4f49cb3,0x7b6ead14,0xa451acd3,0x414582ed,0x39643923,0x420741c6,0x9c928430,0x9c729431,0x8c319472,0x6acb838e,0x94719450,0xacb28bf0,0x72694945,0x48e351a6,0x41e73164,0x29a529a5,
-0x42073186,0x39c639c6,0x4a2739c6,0xc5d783ef,0xb514ad14,0xacb3b4f4,0xa4b2ad14,0x39a65a89,0x93ef7b4d,0xa4319c10,0xa471a451,0xa471a471,0x5187eedb,0x418551e8,0x41c73944,0x41e73986,0x4a085249,0x49e74a08,0x8c1062ca,0x4a075aaa,0x5a4751e7,0x5a885227,0x62ea5268,0xcdf71881,0x93ee9c2f,0x4a474225,0x840e5288,0x7b6c83ce,0xbc4db4af,0xc469cd50,0xbc4cabc8,0xe5d0c4cd,
-0xfef2fe91,0xccaacceb,0xbc28d4cb,0x72208260,0x7a4261a0,0xac0a9326,0xa3c7b44a,0x8b2761e0,0x93688ae8,0x8b268b46,0x8b459367,0x93668b45,0x7aa58b67,0xc512bcd1,0xb4d1bd12,0xbcd0c532,0xbcd0b46e,0xe5d4bccf,0x8264c4b0,0xa3a9c48d,0x82837aa5,0x8ae27200,0xbcb09b69,0xac90b4b0,0xcca93080,0xfe2ef504,0xff36ffd9,0xc427fef6,0xac6c9325,0x9b897a40,0x9b867280,0x6a416a60,
-0x51a17aa1,0x724172e4,0x6980fed6,0xff97fe70,0x392148c0,0x180028a1,0x730a3901,0x290262a8,0x00000000,0x08002965,0x52c9de99,0x18e39cf2,0x00000000,0x00200000,0x00000841,0x10000800,0x28802842,0xa3ebb4ce,0xf6daff7c,0xc28ba205,0xcb6de533,0xd5d68ae8,0xff3aff5b,0xff3cff3c,0xee99fefb,0xff5dff5b,0xff9ef75c,0xffffffbf,0xffdfffdf,0xff7effff,0xfefcffff,0xacd2f6fa,
-0x49a43962,0x41834183,0x18403941,0x31203961,0x39213120,0x39203921,0x49a34141,0x39613941,0x312128c0,0x30e020a0,0x08002080,0x08610820,0x738e0021,0x83cf7baf,0x6b2c83cf,0x83ef736e,0x9cd38c30,0xacd49cb3,0x9c319c71,0x41655a09,0x41a520a1,0x41e741c6,0xa4b37bcf,0x94318c10,0x94729c72,0x9c925aab,0x8c3018a2,0xa4519c51,0xa3cf40c3,0xac50bd14,0x39654184,0x318539a6,
-0x39a63185,0x39a62924,0x41e73164,0x4a2841e7,0xbd75b554,0xbd75a4d3,0x20e3a4d3,0x4a286b2b,0x93ef5207,0xa431a472,0xac929c10,0xa492bd14,0xb4b3bd55,0x5a489430,0x52486269,0x29244a28,0x4a084a08,0x524949e7,0xbdb6ad34,0xcdf7de9a,0x732b6289,0x6aca7b6c,0x41855a28,0x10005a48,0xbd13cd95,0x49e651e6,0x41c64a07,0x72cb5207,0x8b057a45,0xabc7abe6,0xbc8dc4cd,0xbccdbcce,
-0xfef4cd4d,0xbc68c4ea,0xcccad4eb,0x8ac18ae1,0x82417a00,0xbc4aa366,0xac07c4aa,0x8b079307,0x82c47283,0x932582c4,0xa3c99b66,0x93269367,0x8b699bc9,0xc573c533,0xb4f1a490,0xbcd0a42e,0xac4ec4f1,0x82c82000,0xcd31c4d0,0x8263a367,0x72857222,0x8307a3ea,0xcd94936a,0x9baca450,0xb3e36200,0xfdcbedab,0xff34e528,0xe5b0f5ef,0xcd715980,0x72809b45,0xa3a782a3,0x38809385,
-0x10001040,0xdd6e7b04,0xd52ca343,0xcca9fed3,0x18004920,0x18001800,0x10202040,0x08406aea,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x31450000,0x100018a2,0x18001820,0x9bcb6202,0x8b6b936b,0xffbeff5c,0xffffffbf,0xffdef79d,0xfed9f71b,0xff3bff1b,0xff3cf6fb,0xff9dff5c,0xff7dff7d,0xffffffbe,0xffdfffff,0xffffffff,0xffdfffff,0xffdeffff,0x6aa9eeb9,
-0x31202060,0x30e128e1,0x39413921,0x39424163,0x394149a4,0x28c04162,0x310128a0,0x28c028c0,0x208030e0,0x31003941,0x10001820,0x294420c0,0x18e42104,0x7b6e6b4d,0x52297b8e,0x6b2c18a3,0x9471736d,0xb5159451,0x9c10a4b2,0x41855a29,0x31243184,0x318639a6,0x94317bae,0x734d9431,0x9c7283f0,0x6b4d8c71,0x41e73165,0x5a083965,0xa410b471,0xd5d6c534,0x3965de58,0x292439a6,
-0x31853186,0x31852944,0x39a641c6,0x39854a07,0x94710800,0x9c719cb2,0x94b1acf3,0x4a683a07,0x93ef49c7,0xa452b4d3,0xb4d3ac92,0xb514c534,0xacd3b4f3,0xb5139c92,0x29249410,0x4a283165,0x49e749e7,0x52495228,0x106118a2,0x6b2c7bae,0x49e749c7,0xacb2c5b6,0x51c649a6,0x62286a89,0xbd33acb1,0x51e6a3ce,0x416541c6,0x62cb72ca,0xb40a72a5,0xcd0db407,0xb4aeb46c,0x9beab4ad,
-0xb48c93c9,0xe5d09ba8,0xccaaf5f1,0xb3c7a384,0xbbc7ab66,0xccadc429,0xabc8cccd,0x6a00abc8,0x9bc77ac2,0xbc4a9305,0xac2bccec,0xabc89bc9,0x8369abea,0x942eacb2,0xa48fa4b0,0xbcf1b4b0,0xac6eb48f,0xf67630a0,0xdd93934a,0xa40cc4ee,0x6a868348,0xbcd2832a,0xb4f2bccf,0x40e0834c,0xed495960,0xed6cfe70,0xd4e87aa0,0xb48dc4eb,0x9c087a61,0x6a009b46,0xd5b2b4ae,0xac49ac0a,
-0x6a427a83,0xde53e677,0xd486f5af,0xcc67f60d,0x18013901,0x18001800,0x08200800,0x08601881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20000800,0x61e34965,0xa3cc7264,0xff3b8b27,0xffffff7d,0xf77bffdd,0xff3bff3b,0xfefafed9,0xf6fbff1c,0xff5cff1b,0xff7dffbd,0xffffff3c,0xffffffff,0xffdfffff,0xffffffff,0xffdfffff,0xee79ff7e,0x6289730a,
-0x52266b0a,0x208028e2,0x30e02880,0x39423901,0x49a34162,0x31213100,0x39413941,0x28e028c0,0x28e03141,0x28c030e0,0x31012080,0x310228a0,0x20c341c6,0x83cf6b0d,0x626a838e,0x52294187,0x94717bae,0xa4b39cb3,0x72ec9430,0x418649c7,0x41854185,0x318528e2,0x39a6526a,0xad34a514,0x94719c92,0x9cf3a514,0x5aaa9cb2,0x82ab4165,0xbcd3ac10,0xcd75bcd3,0xb5134984,0x41465a08,
-0x39c741c7,0x31443985,0x39853985,0x4a075248,0x41e73144,0x52075228,0x39855208,0x4a284a07,0x62494a28,0xb4f3b4d3,0xbd34bd34,0x8c0fb4f3,0x9c71b534,0xbd96b534,0xbd959430,0x41a63144,0x4a085228,0x520849c7,0x41865207,0x5a074986,0x51a65a28,0xde58acb1,0x836bc574,0x6aa89c2e,0xb4d14142,0x9beee637,0x5a685206,0x6acb5a8a,0x93698b8a,0xcceebcad,0x9bcaac4b,0x8349acae,
-0x8ae57ae6,0xc4ec9346,0xff36ee32,0xfeb4ff36,0xf611f672,0xdd6fedef,0xc4acc4cc,0xf651d52d,0xa44abd0c,0xe5f2c4ee,0xbcacbccd,0xdd2dbcab,0x51c1fe91,0x316428c0,0x5a460000,0xbcf19bcc,0x9bac938b,0xb48ea3ec,0xcd52cd51,0xc532cd52,0xb490b4d0,0xd5d5bcd1,0x8babcd73,0x20001801,0xf54ab406,0xd4a5e507,0xddaeeda9,0xa40961c0,0x93a77262,0x8ae382c3,0x41008b49,0xa3e9d550,
-0x8b049b66,0x82c39bc7,0xedac7a40,0xddedf64f,0x20201840,0x39639c0d,0x00002924,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x20001821,0x69a12020,0x72647244,0x938a934a,0xff9c7a83,0xff9cff3c,0xff1bff5c,0xfedaff1b,0xff3cf6da,0xff1bff1b,0xff9dff5d,0xffffffbe,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xff5cffdf,0x6268de38,0x51c55a26,
-0x7bae736d,0x5a887b6d,0x414249a5,0x41623901,0x31003921,0x41822060,0x396249a3,0x29003921,0x314141a3,0x310128e0,0x31015205,0x290230e1,0x29040800,0x7b6e6b0d,0x7b0d8bd0,0x51c872cc,0x7bcf5a6a,0x8c3083cf,0x730c83cf,0x41a649a6,0x49c641a6,0x29643103,0x42082945,0xa4f30820,0xa4d39472,0x9cf38c51,0x8450a534,0x7b0c9471,0xbcf4acb3,0xbd13cd76,0xa450c533,0xb4b3ac71,
-0x522849c6,0x41e741c6,0x316539c6,0x39a541c6,0x49e739c6,0x4a075228,0x4a075269,0x4a074a27,0xac924a07,0xcd96ac72,0xcd96bd14,0x5248b4d3,0x41c749e7,0x7b4d3145,0x5a693945,0x398549e7,0x522849e7,0x51e8626a,0x51e749c7,0x59e74965,0x620872aa,0xc595730b,0xad11bd94,0x944e9c70,0xb4b16246,0xeeb8cd94,0x62075964,0x72eb5a68,0xc5738bee,0x9ae4cd0e,0x72a68b06,0x832972e8,
-0x93258baa,0x7282a366,0x8b8751e0,0xaccea42c,0xe673e6b4,0xd58fee32,0xc4ecbccc,0xcd4dd56f,0xa40b9c09,0x93a893a9,0xcd0e8b67,0xffb7c4cc,0xd592cd8e,0x180030c1,0xddd451c2,0x8b49fffc,0xac6eac2d,0xd5b4bcf0,0xd5b3d5b4,0xcd52cd52,0x9c0cb44f,0xb48ebd10,0x20004142,0xa40a1000,0xdca8fe91,0xee0fe5ad,0x7ae3cd2b,0x7ac59bab,0x9366a3e9,0x9bc89bc8,0x30405163,0x10002020,
-0x28602880,0x9b659ba6,0xf692e5b0,0xf6b4cd0c,0x7b2a2840,0x734c1000,0x000039a5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x40a01820,0x61e45983,0x59a17266,0x8b287284,0x8b278b69,0xf6fbff9c,0xff3bfefa,0xfedafefa,0xff3bff3c,0xfedaff3b,0xff9df69a,0xffdeffbd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd617ffff,0x730b836d,0x5a276a88,
-0x524841a5,0x7bad83ce,0x3963732b,0x414228c1,0x30e138e0,0x312030e0,0x28e028e0,0x31413921,0x28e020a0,0x18603101,0x310128a0,0x39a53122,0x4a4918c3,0x83af738e,0x94118bf0,0x832d838f,0x49c749a7,0x630b3145,0x316541c6,0x5a69732c,0x520749e7,0x18403924,0x210320e3,0x08402944,0xad349cd2,0x00009cb3,0x39e72945,0xc5b61061,0xcd96ac52,0xc555b4d3,0xb4f3bd13,0xb4d29c50,
-0x49c7bd55,0x49e649a6,0x398541a6,0x41e75248,0x420739a6,0x7b6d41e7,0x5aca9c71,0x4a48528a,0x39035227,0xa451bd14,0xb513bd34,0x5a0772cb,0x5a485aa9,0x5a485a69,0x5a695a28,0x398549e7,0x31243144,0xbd555a69,0x9451a4d3,0xbd138baf,0xd638b4b2,0xacf2b533,0xb533b553,0x944eacf1,0xb5328bcd,0xd574c574,0xac2fdd94,0x6a886206,0x938a834a,0xabe89b88,0x8307a3a9,0x6a8772a8,
-0xac0a9bcc,0x6a61bc8c,0x61e24960,0x59a16202,0x7ae661e3,0xa44b9bca,0xac2a9be9,0x9bc9ac2a,0x93a88347,0x8348a44d,0xa42a9389,0x9ba89be8,0x51c46a83,0x72831800,0x93ea9c0c,0x6a8672c6,0xa42eac8f,0xc552bcf0,0xcd72cd72,0x40c0d573,0x28003840,0x20002000,0x28601800,0xbcefa44c,0xd52bee31,0xc52c7aa2,0x7ae57ae4,0xacae7ae6,0xd5d06202,0xa490bc6a,0x7b6a49a3,0xc50eac6b,
-0xa46b8b67,0x7ac5bd0f,0x8b04dd70,0x9ba99364,0x20612840,0x0800bd73,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28201000,0x724440e0,0x518082c6,0x83078327,0x7ac67263,0x49008b8a,0xff1beeda,0xfed9feba,0xf6dafeda,0xff3cff5c,0xf69afeda,0xff5dff9e,0xffbeff7d,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xffbeffff,0x83adb595,0x730b7b4c,0x6a886268,
-0x28e24164,0x6b4b4a47,0x7b8c7bce,0x49c46aea,0x62463922,0x28e04162,0x20a02060,0x20c028c0,0x28c01880,0x28c11820,0x28a049a4,0x312428e0,0x736d528a,0x7b8e7bcf,0x94119c72,0x7b6d7b2d,0x5a08836e,0x41e74a08,0x4a074a08,0x41e741c6,0x49c641c6,0x39444185,0x39a53984,0x21031061,0xa51318a2,0x10828c51,0x10a20000,0x080039e7,0xc534bcf4,0xb4b2c534,0xbd54cd55,0xacb2b4d2,
-0xacf3bd34,0x7b4c6a69,0x41c63144,0x4a085228,0x41c741e7,0xad545a8a,0x9cd2b575,0x5aaaa514,0x628a5269,0x93af72cb,0xacd2b514,0x38e3acb2,0x5a2851e7,0x52085a48,0x52075207,0x49a649c6,0x41864165,0x41863945,0xc5b62082,0xbd54bdb6,0x9c2fde38,0x83ee5206,0x944f6b2a,0x8bed9c6f,0x39627329,0xc4f2bd13,0xd594cdb4,0x7aa8b40e,0x8b286a45,0xc48c9b88,0xbcacbcac,0x62268b29,
-0xb44c69e4,0xb4cbc50e,0x72446aa5,0x9bab7244,0x59815982,0x726440c0,0x82a47a84,0x82c59b88,0x518251a1,0x7ac672a6,0x7ac37a84,0x72827ac2,0x308059e2,0x7aa36a21,0x9bea9389,0x830882e6,0xcd73c552,0xbcf0cd52,0xd5d4cd72,0xf6b5a3ea,0xbcc8bbc9,0x61c0d56e,0x8305c50f,0x7ae48b27,0x51a09ba8,0x72a4de11,0x83268306,0x6a4472a5,0xa42851c2,0x2040de32,0x6a665a25,0xff999c2c,
-0x6a829c29,0xacae8b8a,0x4960c531,0xac8c7ac4,0x8c4f1820,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x18200000,0x7ac55143,0x72427243,0x82c57243,0x7a857264,0x8b487aa4,0xcd747aa6,0xee99f698,0xff1bf679,0xff1bff5c,0xf6fbfefb,0xff7df6da,0xffbeff7d,0xffffffde,0xf77effff,0xffffffff,0xffffffff,0xffffffff,0x6b2cd679,0x6ae96b2b,0x6288730a,0x51e56267,
-0x52273964,0x314341e5,0x6b0b3964,0x730a7b8c,0x28a02881,0x310028a0,0x31004163,0x31203100,0x28a02080,0x31011000,0x39422901,0x396428e2,0x7baf6b2c,0x83f07bcf,0x9c729451,0x93cf9411,0x7b2d9c10,0x39c649e7,0x41e839a7,0x4a284a28,0x49c64a08,0x30c228c1,0x18823144,0x2144630b,0x39c62944,0x9450a4d3,0x00201882,0x39c60800,0xc575938e,0xc534bd14,0xbd13bd34,0xb4f3bd13,
-0xc5d6ce17,0xbd75acf3,0x41c672ea,0x4a294208,0x4a084a08,0x524839a6,0x736d3986,0x526a7bae,0xacd39451,0xacb39430,0xa471a4b2,0xacd3acf3,0x59a6d617,0x59c76208,0x59c75186,0x51a651c6,0x61c761c7,0x51865145,0x51a659e8,0xd5d79c50,0x7b0a93ee,0x5a475a06,0x5a675a47,0x6aa76ac8,0x5a256266,0xc51372e9,0xcd53ddd4,0xc4d0d573,0x8ae782a5,0xc44bbc4b,0xbc29bc2a,0x8265bc09,
-0xbc4b8222,0xe634e550,0x7ac8ac0c,0xa40da44e,0x51606a24,0x72016a00,0x69a06160,0x61a06180,0x49614920,0x622259e1,0x72834940,0x72838305,0x6a214100,0x93278b07,0x83478b47,0x93497282,0xb4f1acae,0xbd11ac8f,0xbcf0d5b3,0x9beab48c,0xcd0dfef4,0x9b4869e0,0x93686a21,0x938882a5,0x93ec4940,0x7ae67307,0x72837283,0x6a446a21,0xa44a6a65,0x72c89c4c,0x518372c7,0x62846286,
-0x7b4a83a9,0xacd09c4f,0xb4af93ea,0x72659c0a,0x000041a3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xa40c0000,0x7a837285,0x82a37aa5,0x83277ac5,0x72439389,0x93aa9349,0xd5f67245,0xfefbee77,0xff1afefb,0xff1cfefb,0xf69aff1c,0xff5dff7d,0xffffffbe,0xffdfffff,0xffdfffdf,0xffffffff,0xffffffff,0xa513ce38,0x62cb6b0c,0x62a862ca,0x62676247,0x5a2549a3,
-0x414451e6,0x31644144,0x31443964,0x5a68630b,0x62475a69,0x51e56247,0x31004163,0x184028a0,0x28a028c0,0x20811860,0x31013942,0x20c23141,0x83ef41e9,0x7baf7bcf,0x8bf083cf,0x8bcf9411,0x5a4993cf,0x39a63986,0x41e839a7,0x4a084a08,0x41a641c7,0x31033924,0x41c73144,0xad74738e,0x29242924,0x9c910000,0x41867b4d,0x08001021,0xb4d38b0c,0xb4f3cd96,0xbcf3d5f7,0xbd14bd14,
-0x30a16ac9,0xacd2940f,0x7badbd33,0x41e841e7,0x41c739a7,0x52494a08,0x4a284a28,0x526a4a49,0x62cb4a08,0xacf38c10,0xb5349c91,0xacd2b554,0x7b0bb4f3,0xa431b4b2,0xa471ac92,0xb4d2a450,0xbcd3bcf3,0x61c7ac10,0x51e76228,0xbd754164,0x8bacacf2,0x5a67834b,0x5a675226,0x836b8bad,0x6aa8834a,0xe6375a05,0xd594d594,0xcd31c511,0xa367abea,0xdcc8b3a7,0xed2de4eb,0xd447feb3,
-0xff55e52c,0xac4cd4aa,0xac2d5985,0xac8fac6e,0xbc4e7265,0xe56fedb3,0x8ac4edb0,0xf63382c4,0x6a0282a5,0x620259e1,0x8b897ae5,0x61c0bd0e,0x7a837aa3,0x93689b89,0xa42b9b89,0x93488b46,0xb46fa42d,0xac2d938b,0xa3c88b48,0x3060bcef,0x9365e5d1,0x9b677a83,0x6a626a21,0x93cb7ae5,0x72c551e3,0x62216200,0x93aa8305,0x62647285,0xd6147328,0x6ac86aa7,0x732a6ae9,0x6b0962e9,
-0x634b6b6b,0x8c0d73ce,0xc551bd2f,0x2080bd0f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x6202ac0d,0x8b478b47,0x72a3a3cb,0x7aa36a62,0x8b476a23,0x8b298b69,0xde175142,0xf699ee57,0xfefaf6ba,0xff1cff3c,0xff1bf6ba,0xff3cff3c,0xffdeffbe,0xffffffff,0xffffffdf,0xffffffff,0x9492d6b9,0x7bcda4f3,0x41a65248,0x41835206,0x59e55a05,0x72e87b09,
-0x7b2c93ce,0x39a34123,0x4a275a47,0x83ce2903,0x5a065a69,0x72e938e2,0x41226227,0x18004122,0x41824164,0x10001820,0x394341c4,0x20e14a26,0x736d2901,0x8c308c30,0x83f07bcf,0x93f09472,0x38c44987,0x41e72924,0x4a074a28,0x31664a08,0x398639a7,0x39243145,0x39c62061,0x00005aca,0x2944ad54,0x21030840,0x943083ae,0x20206a49,0xa4315165,0xd5d7bcf3,0xc595c555,0xbd54bd33,
-0x51049bee,0xa46f48a1,0x944facd2,0x4a4941e5,0x41e75269,0x52494a29,0x42084a07,0x4a284a49,0x528a528a,0x9cb239a6,0x4a28ad34,0xa4b29450,0xa471a491,0xb4d3a471,0xb514bd34,0xa471bd34,0xc534c534,0xc514cd95,0x5a07bcd2,0x93ee5a68,0xbd548bce,0x943083ae,0x62a96289,0x8bac7b2b,0x73097b4a,0xc4f272a8,0xcd32ddd5,0xcd12ddd4,0xd4cbb44b,0xfdeff58d,0xfe2ffe2f,0xfef4fed2,
-0xed4cfd8c,0xd52ffdf0,0xb47058c0,0xac2dbcd0,0x92a48b04,0xbc2babc7,0xd4acbc69,0xbc8bc48a,0xa366b44b,0x8ba9a44a,0xc57093cb,0x7a8251a0,0x8ae582c2,0x8b499bc9,0x93069348,0x9347a368,0xbccc7ac2,0xc4abac08,0x7aa2c4ac,0x48e05122,0x9346c4cb,0xa3a9f650,0x9c6dcdf4,0xe6763920,0x72e87307,0x93eb51e3,0x8b8b8bab,0x52066ac7,0x31410800,0x62a83983,0x630b6b6d,0x00000000,
-0x31844247,0xad326b4c,0xad10a510,0x00008bec,0x00000000,0x00000000,0x00000000,0x00000000,0x10000041,0x622430c0,0x93466a00,0x8b2782a4,0x7ac38b26,0x6a619369,0x7ac572a3,0x51c08bec,0xde37b512,0xee79ee79,0xf6baff3c,0xff1cff1b,0xff1bff3c,0xffbeff5d,0xffbeffbe,0xffffffff,0xffdfffff,0x94b1dedb,0x738d7bee,0x526852aa,0x52075228,0x62255a05,0x6a6649a3,0x62247ac7,
-0x62286228,0x31025207,0x4a072080,0x5aaa41a6,0x62696b0b,0x5a476247,0x5a06730b,0x286049a5,0x52054164,0x41643943,0x28e15a26,0x39641040,0x6b2c1020,0x528a8410,0x83cf738e,0x8bf083cf,0x38e4626a,0x420741e7,0x4a284a28,0x39a73986,0x41a641c7,0x31243965,0x18a22082,0x31a662eb,0x39e75289,0x08200000,0xa4d3bd96,0x9c30b4d2,0xb4d3ac92,0xcd76b4f3,0xc574a471,0xbd54bd54,
-0x59c6b4f2,0x9c0f8b0b,0x83adc554,0x420841a5,0x5a8a528a,0x52694a28,0x41e75249,0x4a284a28,0x528a4a29,0x630b5269,0x5aa941e7,0x49e75a89,0xa491bd34,0xa430b4d3,0xb4f3b4f3,0xbd55bd14,0xbd13a450,0xcd75d596,0xb4d2c513,0x6aca5a47,0x93ee7b2c,0xb534de57,0x62a993ef,0x73096288,0x7b2a834b,0xcd332880,0xddd5d5b4,0xedf6ddb4,0xd54ec4cd,0xfe2ef5ee,0xfeb4f5ef,0xf672d4c9,
-0xed6dff16,0x9b46fd8c,0xcd33bc90,0xac2cbcb0,0xe56ca3a8,0xf54edd0c,0xee32fe0f,0xfef6ff38,0xeeb5eeb5,0xc530c52f,0x51622860,0x82a261c1,0xa3689b45,0x9b46abaa,0xa3879b67,0xa3c8b409,0x8b047aa1,0xb4489ba5,0x9ba68b04,0x82a35980,0xd52e9346,0xfed69325,0x51816a03,0x7b694181,0x83aa7b89,0x7b6a7b4b,0x520683a9,0x49e6ad11,0x62c83963,0x20e34a06,0x00000000,0x00000000,
-0x31850860,0x62ea4227,0x7bac4206,0x000041e5,0x00000000,0x00000000,0x00000000,0x00000001,0x48a01840,0x82e59366,0x8ae58326,0x72827a83,0x7ae37ac2,0x72a26221,0x6a436a63,0x5a01ffbe,0xde37d616,0xf6daee78,0xfedaff1b,0xfefbf6ba,0xf6fbff1b,0xffdeff3d,0xff9eff7d,0xffbeffff,0xd678ef5c,0x630a8c2f,0x62ca62ea,0x52475aa9,0x49c65a48,0x6a465a05,0x6a866245,0x7ae76245,
-0xad33b574,0x7aea838d,0x20e24184,0x8bef4a07,0x8c0f8c0f,0x730b8bad,0x626883ae,0x51a36289,0x100030e1,0x628830e1,0x30e138e2,0x49e6732b,0x736e62a9,0x18a34a49,0x736e6b4d,0x947183ef,0x7b4d8bcf,0x29248c30,0x52482924,0x52493986,0x41c741e8,0x416541a6,0x20e328e3,0x00000000,0x10810000,0x000039a6,0xa513bdd6,0xad34ad34,0xc575ad34,0xbd14c575,0xbd54cd75,0xc554cdd6,
-0xad12bd33,0xb4d3b4d2,0xc554c534,0x4a494164,0x62ab4a29,0x52485249,0x5aaa5269,0x39c74a49,0x52694a49,0x5aaa52aa,0x5a894a28,0x20a25a89,0xa4719c51,0xac92acb2,0xa471ac71,0xb514b4f3,0xc554bd34,0xcd75c534,0xcd95cd54,0x5a286aca,0x6a8851e7,0xacb24163,0x7b6c8bee,0xacb0acb0,0x62269bcd,0xcd3472e9,0xddd5d593,0xcd12e5f5,0xf693bc6b,0xfe11e60f,0xf671fe71,0x9b42de12,
-0x51a08a81,0xe52bfe72,0xddd5bc6d,0xa3ebc532,0xdd4d3020,0xee92ff15,0x2000d5cf,0x59402040,0xa408c468,0x38e05183,0x61804960,0xccea8ac1,0xcc68dced,0xd467ed6c,0xc469c427,0xa3c7c4ab,0x82c19303,0xa3a9b42a,0x48c0ccef,0x8b038ae5,0xa3888b23,0xe5926a01,0x30e0a3c9,0x08001860,0x31860001,0x738b5ae6,0x00000000,0x4a480000,0x39c639c6,0x39c8528a,0x21242965,0x08410000,
-0x00000000,0x002110a3,0x5aca1083,0x7bef0000,0x00000000,0x00000000,0x00000000,0x20000800,0x93462040,0x8b048b68,0x8b058282,0x7ac282a4,0x8b2982e4,0x8b4a9388,0x49407ac5,0x72484a04,0xd5f6bd74,0xfefbee79,0xee99f6da,0xf6fbee78,0xff7df6da,0xfffeff5c,0xeedbff9e,0xce17e699,0x5a889c91,0x49c662a9,0x4a066aca,0x49c549e5,0x72a851e5,0x62256a87,0x72c772c7,0x7b086a45,
-0x8bce838d,0xa4d2b554,0x51e75a07,0x62aa28c3,0x730b72eb,0x836d7b4c,0x30e130e3,0x5a674163,0x49c53102,0x49c65a68,0x41845206,0x08201040,0x10814a07,0x4a2952a9,0x84104a29,0x94108410,0xacb293f0,0x83cfad14,0x41c60800,0x4a2841c6,0x41c74207,0x7b0c734d,0x206149a6,0x00003145,0x10620000,0xa4b22904,0x00000000,0x9cb20000,0xacf3b596,0xb4f4c555,0xcdb6a472,0xc575c575,
-0xb513c575,0xd5d6b4d2,0xc573cd95,0x39c649a4,0x52494a29,0x526a5249,0x5a8a5a8a,0x62cb5269,0x52695a8a,0x62ca5249,0x52695aaa,0x62695a89,0x93ce6207,0xa471bd13,0xb4d3a471,0xc5b6a492,0xb4f3acf2,0xcd75c534,0xac51a410,0x59e66268,0x72a96a68,0x6a8872a8,0x5a266aa9,0xbd32836c,0xc594b512,0xbcf2ac91,0xc552cdb3,0xcd93ddf5,0xb3c6ac2a,0xa3c88b06,0xac08bc8a,0xa3657a80,
-0xdce9e52c,0xfef3fdac,0xbc49ff13,0x82093000,0xe54cfe73,0x00004960,0x28012020,0xdd0c3800,0x8b24dd2d,0x38a14980,0xa3884942,0xedafe56e,0xfed4f60e,0xdd0cfe51,0xdd4eed8e,0xabeafeb6,0xabe8e58d,0xd50cb3e7,0x2000a3e8,0xa3a7b46a,0x4080b46a,0x2000ddd0,0xbcef59e2,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x190318e3,0x00000000,0x00000000,
-0x00000841,0x00000020,0x00000840,0x00201061,0x00000000,0x00000000,0x10000000,0xa3885143,0xac0982c4,0x9b869326,0x82e3b44a,0x6a207a81,0x8b898b05,0x72628327,0x7ae77b06,0x6aa772a6,0xe658cdd6,0xfefbfefa,0xf6dbe637,0xf6baff5c,0xff7df6da,0xff3cff7d,0xe699f73c,0x5a48ff3c,0x5a675226,0x6aaa730a,0x51e749c6,0x62673983,0x7ae84983,0x72c751c3,0x6aa672c7,0x6a867b08,
-0x30e36acb,0x7b8d5a89,0xbd14ad54,0x93cf8bae,0x5a28834d,0x72ea6269,0x5a677b2b,0x316441a4,0x62a95a89,0x3965838d,0x734c9471,0x6b0b5248,0x28c35248,0x7bae5aaa,0x83f05acb,0xa4929472,0x28c38baf,0x7bae7bae,0x080041a6,0x41c641e7,0x734d39a6,0x93ef83cf,0x5166836d,0x08000800,0x00000000,0xa4d3a513,0x00009cd3,0x08410000,0xacd339c7,0x94107b2c,0xa4712062,0xb4d29c50,
-0xbd13b4f3,0xc534b4d2,0xcd95bd14,0x61a69bee,0x52495a08,0x4a295249,0x526a5aaa,0x5a8a526a,0x5aab5aaa,0x5a8a5aaa,0x5aca62ca,0x624862ca,0xb4f3a3ef,0x496593cf,0x5a0830a3,0x7b4c2081,0xacf33985,0xde37acd2,0xc595cd95,0xb4d2bd74,0x9c2ea450,0x72c9a44f,0x6a886267,0x7b097ae9,0x72c89bed,0xb4f161e4,0xe636cd93,0xcd53cd73,0xff543880,0x93269b24,0xc4adc4ac,0xee53a3e7,
-0xf631f674,0xf62efe2f,0xfe70feb3,0xfdb0f5f1,0xdd2afd69,0x58809aa3,0x79a04000,0x92c0e4ea,0x8aa2a344,0x38401800,0xff9792c2,0xdd8eabc4,0xee50dd8b,0xe52de5ae,0xa3a5e54d,0xabe69ba6,0xdd6ee5ae,0x4100cd90,0x512140a0,0xa3a68b23,0xac063060,0x40c26a22,0x30a0ee34,0x18820020,0x29652945,0x31a62124,0x00000841,0x00200861,0x0000632c,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x59a13060,0x7a2082a5,0xbc2b9b43,0xb44c9b64,0x82a28b67,0x93478282,0x82828b04,0x83077263,0x6a637ae7,0x5a265a02,0xf6facdd5,0xf6baee78,0xff3cfefa,0xee58eeba,0xeebaf6fb,0xf6fbff1c,0xde38eeba,0x9c6f5227,0x62886ac9,0x62895a47,0x49a56289,0x5a475a25,0x6a6672a8,0x7ae86a87,0x7ae872e7,0x72c77b08,
-0x49e762cb,0x6b2b41a6,0xc59694b2,0xbcf4c596,0x8b4d9bd0,0x622893ae,0x51e651c6,0x41843943,0x31223122,0x292320a0,0x7bce630b,0x5248734c,0x6b0b62ca,0x18c341a6,0x736d7bce,0x94b283ef,0x49c7736d,0x39863145,0x398641c6,0x41c75228,0x7b6d3986,0x9c719410,0x51869c31,0x7b6d0800,0x6b0c1000,0xbd750000,0xc5d7acf3,0x00000000,0x0800734d,0x9bf0acd3,0x51a7ac52,0xa430b492,
-0x9c50838d,0xa450b4d2,0x93efb4f3,0xb4b29c0f,0x5a289bef,0x526a528a,0x5a28628b,0x628a626a,0x5a685228,0x62aa5a89,0x5a685aa9,0x8b8e62c9,0xb4d3b4f3,0xac50a471,0x6a48936d,0x18204082,0x08001000,0xbd965aa8,0x9491c617,0xd617c617,0xd5949c91,0x942e93ad,0x72c9a44f,0x938a8b4a,0x9bcc9bcb,0x41428b6b,0xcdb4b4d0,0xbcd0bd32,0xfeb1bced,0xcd4fe5af,0xcced9b88,0xbcacc4ee,
-0xc4adb46b,0xfe50dd2c,0xf5edfe4f,0xfe71fe30,0xff56ff14,0xfe4fedce,0xfe31fe50,0xffd8fed2,0xfe6eff56,0xe5afc487,0xd5b0ffb6,0xa3c3c489,0xc52cd58d,0xdd4ccd0c,0xff15edf0,0x93658303,0xf652edf0,0x6a22ac2b,0x82e49386,0x726282c4,0x2860d56f,0x8306d56f,0x93ab9bea,0x00000000,0x10a20000,0x08610841,0x00000861,0x00000000,0x00000000,0x00001061,0x00000000,0x08000000,
-0x18810000,0x51e61020,0x00000800,0x00000000,0x00000000,0x59c21020,0x9ba86a03,0xb42a9326,0xa365c46b,0xa3a98ae3,0x9b868b04,0x8b059325,0x6a407a81,0x72837ac3,0x72c56a65,0x72e86a23,0xd5f6bd94,0xf6baf6da,0xf6fbee99,0xee79f6da,0xf6dbee99,0xe679e679,0x6ac983ac,0x83ac736b,0x7b4b732a,0x5a683943,0x5a275227,0x62876287,0x62245a04,0x838b6245,0x72e67b28,0x8bab6aa5,
-0x6b4c630b,0x5229630c,0xbdf79cd2,0xde39d659,0xc555c576,0x9bafd596,0x41634924,0x20c03102,0x31023102,0x29032902,0x6b4c5aaa,0x5a89736c,0x3965736c,0x18820000,0x20c349e7,0x8c507b8e,0x418683cf,0x39852904,0x4a074a08,0x396541a6,0x7b8e6b0c,0x9c318baf,0x93ae8bcf,0x180059a7,0x08005a49,0x08000800,0x9cb26aeb,0xa4f3b5d6,0x080049e7,0x7b4dac92,0xa471ac92,0xa451acd3,
-0xacb2a491,0xa491a470,0xa471a471,0xbcf3b4f3,0xa4709bee,0x5a486a69,0x834c6289,0xb4d2a450,0xa491acd2,0x41845a47,0x5a085a07,0xac9272aa,0xac71bd34,0xc574b4d2,0xee58bcf3,0x6ac8c4b1,0x392151c4,0x00001820,0x00000000,0x630c0000,0xe699b596,0xc5f5c5d6,0x9c2fa4b1,0xa3cca3ed,0x934ab44e,0x9b6a7a87,0xc4f07ac7,0xb4adb48f,0xd5cfd5ce,0xbcaed5b1,0xbc6ca3ca,0xb44acd0e,
-0x7a859baa,0x9b687224,0xe5add54f,0xfef4fe4f,0xfeb1ff36,0xddacfe92,0xedaaddab,0xfe50edad,0xfe8ffff8,0x9bcaf671,0xa3cabcce,0x82c69368,0x934993aa,0xcdb1a3ea,0x9388cd90,0x82e382e2,0xa408a408,0xcd2fa406,0x93a79365,0x3080a40b,0xc4edff56,0x8b458b46,0x52069c2c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20c00800,0x10202080,
-0x30c11840,0x49844162,0x000059e5,0x18810000,0x49000000,0xa3a52800,0x92e2a366,0xa3a9bc6a,0xa3659323,0x7a809304,0x8b248b04,0x93879326,0x8b489b89,0x6a437ac5,0x6a456222,0xb5116a45,0xe678c594,0xe638fefa,0xde17fefb,0xde38eeba,0xe679ee79,0x6289de57,0xbd73732a,0x7b8c0800,0x6b097b4b,0x52275246,0x624662a9,0x5a4651c4,0x7ae772a7,0x72a68369,0x8b8b7b29,0x7ae78307,
-0x5acb62eb,0x630c738e,0x8c514228,0xde9ace39,0xe67ade7a,0xac51e639,0x392259a6,0x39e53122,0x28810800,0x20a020a0,0x18c20840,0x62eb2945,0x83ef8c30,0x398683ef,0x7bae6b4d,0x31445289,0x314441e7,0x39a53164,0x104039a6,0x6aec28c4,0x8c30838f,0x836e9410,0xa4b2626a,0xac92a472,0x6a296209,0x38e35165,0x94711021,0x18827bae,0x39459c92,0x9c5193af,0xb4d39c31,0xb4f4b4d3,
-0xa491a491,0x3924acb2,0x51854944,0xacb2b491,0xac92acb2,0x82cbb4b2,0x8b6d59a6,0xacd2ac71,0xa471a471,0x93cea471,0x93ce836d,0x9bef9c0f,0xbd54bd13,0xac91b513,0xcd34acb2,0xd595e617,0x30607a66,0x100038c1,0x00010000,0x08000001,0x08200000,0xbd95a514,0xcd93a511,0xc512b4d1,0xbcd1ac6f,0xee56ddf5,0x936a936a,0xb4ad938a,0xacadc52f,0x9307834a,0xac2c9b8b,0xb44d9347,
-0xabcc7a65,0xbcf0cd31,0xc4edb46e,0x8284cd0f,0x8ae66181,0xd50fd54e,0xe56ce5ac,0xcd0cdd4c,0xc4cdb4ab,0x82e782c5,0x8b8b8b4a,0x82c87a87,0x8b28936a,0x93ad7a43,0x72618b67,0x7aa19ba7,0xb48ac50d,0xcd4c9be6,0x61e4c4ab,0x93a830a0,0xac08bcad,0x8b688324,0x00006264,0x00000000,0x00000800,0x08400000,0x08001081,0x00010000,0x00000000,0x00000000,0x31003120,0x41611860,
-0x51824100,0x59824161,0x18604123,0x18000000,0xac2c6a63,0x9b65b44c,0xb3e9abe8,0xbcecb46c,0xa409a363,0x9bc69326,0x7a609365,0x8ae49b66,0x7ae48b05,0x6a4482e5,0x72877286,0xa47059c3,0xc575c575,0xe638d596,0xff3ce638,0xeeb9eeba,0xe658eeb9,0x62c91840,0x8c0d28c0,0x5a864a04,0x5a885a89,0x5a875aa9,0x498349c3,0x7ae959e4,0x8349834a,0x6a8572e7,0x72a67b08,0x6a8572c6,
-0x630c6b4d,0x841073ae,0x528a8410,0xad345aeb,0xbd96ce39,0x8bafb535,0x59e66208,0x5a276248,0x18601840,0x28c128e2,0x20c21040,0x18811860,0x4a270800,0x6b0b8c0f,0x736d4185,0x41e66b2c,0x29232103,0x4a2841c6,0x7b8e83ce,0x18824a08,0x8c51736d,0x8bcf9431,0xb5148bcf,0xbcf4ac92,0xbd35b4f4,0x39458b6e,0x94519430,0x0000736d,0xcdf72924,0xac926aab,0xa4729c31,0xb4f4b4f4,
-0xa491c574,0xac71bd34,0x9c0fc534,0xb4d2c534,0xac71b4d2,0xb4b2c514,0xac71a410,0xa4b1b4d2,0xacb28b8d,0x72caa471,0xb4b2a450,0x6a8aa471,0xa47093ef,0xb4d2bd34,0xbcf2c575,0xb4b1c554,0x7a688247,0x9bce832b,0x38a03880,0x08001800,0x00000840,0x08000000,0x392320e2,0xd594c573,0xc512ddd5,0xac6fbcd0,0xcd72c552,0xd592b4d0,0x82e8a42d,0x9b8a7ae7,0xc511c4d1,0x9bccb48d,
-0xc4b07225,0xff18ddd3,0xb46cddf4,0xdd71b44b,0xc4effef8,0x9b66bc8d,0xe56aedeb,0xa3a6d50b,0x7aa28b43,0xb46e7244,0xbd12ac6f,0xac6e7a88,0x8b4ab48e,0x7ae8b48f,0x93877ae5,0x624059e0,0x7ae39386,0x61e2abe9,0xac8b6a86,0x9bc78346,0x9ba77ac3,0x9c2c9c08,0x1861ce34,0x52270000,0x28c15207,0x18403963,0x59a33943,0x18404921,0x08000800,0x522428e0,0xcdf55204,0x832951c3,
-0x6a67b4b1,0x288061e5,0x00002040,0x51e230e2,0xac2aa40b,0x9b668b05,0x9320bc8a,0x92e39b63,0xa40992e3,0xa3e9a3c7,0x8ae39367,0x82c482c1,0x7ae47ac4,0x7ac66a43,0x6a656a64,0xacd14940,0xc575b513,0xddf7cd75,0xde17e658,0xde38ee79,0xa450d617,0x5a886aa8,0x524628e1,0x6b0a62a8,0x52264a05,0x418239a4,0x72c751c3,0x7b2972c8,0x6a856265,0x72e67b28,0x7ae772e7,0x728693cb,
-0x39a618a3,0x8c51528a,0x52aa9cf3,0x8430634c,0xbd969471,0x9411ad14,0x7a8a832d,0x62495186,0x736d628a,0x28c25207,0x18403102,0x39441840,0x7b8d5227,0x5227736c,0x94700800,0x39a562eb,0x39a52923,0x18a11881,0x83cf0800,0x8c519471,0x83ef7bae,0x8bef9c72,0x83af83cf,0xac722062,0xacb3acd3,0xb535acb3,0xa4d283ae,0x0820ad14,0x10610800,0xa4519410,0x9c51b4d3,0xa4928bcf,
-0xbd34acd2,0xc554ac91,0x9c31a472,0xc575d5d7,0xc554a471,0xbcf3ac91,0xcd75c554,0xacd2d5d6,0xacb2730b,0x940fa450,0xb4b27b0b,0xa450a471,0x9c309c0f,0x9c30940f,0xacb1a471,0xcdb5c574,0xa42fc4f2,0x6a26ddf6,0xcd325142,0x4925bd12,0x00001800,0x08000000,0x20410000,0xa40e1000,0xddd5e616,0xcd73ddd4,0xb4f1cd93,0xac4ebd32,0x82e98b2a,0x72457a85,0xc552bcf2,0xc511b4ce,
-0xc4d1e5d4,0xbcf0ddf4,0xc4eed5b3,0xe5f4e593,0xac2efe98,0xbc4cc510,0xedadfef2,0x9b85d4ea,0xabc87a61,0xcd11ac0c,0xb533ac4f,0x8267a42f,0xc532b3ed,0x6a86acf2,0xa3e98b87,0x59c29bc9,0x72c0b48d,0x83273100,0x62209b87,0xac4c6a62,0x72c4ddd0,0x080049c0,0x10203162,0x52265247,0x51e551c5,0x51c44142,0x620559e5,0x51e24963,0x30e07305,0x52026ac5,0x5ac749c0,0x306051c3,
-0x5182de76,0x8bad5960,0x3921a42e,0x5a044a24,0x9385a40a,0xaba8a3c7,0xc48abc6b,0x8ae49b83,0xa4099b04,0x8b4482e3,0x93458b44,0x82e5a3a8,0x72a47ac5,0x6a236a63,0x59e36202,0xa4906a65,0xcdb6cdb6,0xd596e638,0xd5f7de18,0xcdb6cdb6,0x51e7bd54,0x6ae95a47,0x62c86287,0x524762c9,0x52663162,0x6aa75aa7,0x62666a44,0x7b2872a7,0x51c16264,0x6aa56244,0x62247b08,0x83096a66,
-0x084018a1,0x6b4c0000,0x31864a49,0x8c5173ae,0xad1494b2,0xa472acb3,0xacb2b514,0x49e7a430,0x526841c6,0x7bae83ee,0x524883ae,0x10203965,0x00002903,0x39221000,0x944f28a0,0x31440800,0x39a53165,0x20c220c2,0x734d18a2,0x41c71061,0x736d83cf,0x83ef738e,0x8c1083ef,0x93f05227,0xacd4a492,0xb514a4b3,0x490559c7,0x62cb6b0c,0x20c24186,0xa4f3630b,0x842f9430,0x7aec3924,
-0xb513b513,0xc575b4b2,0xbd54bd54,0xbd74c595,0xb4f3acf3,0xc575bcf3,0xc555cdb6,0xb534de38,0xa471a4b1,0xa471a430,0xb4b29c0f,0xac91b4f3,0x8b6ca470,0xa4706aa9,0xa40f9c0f,0xa40f93ce,0xc513ac50,0xac50b4b1,0xbcd1d574,0xcd95b4f2,0x1800b4f2,0x20202040,0x20201800,0xbcf259c5,0xbd11d5b4,0xcd93d5d4,0xcd73cd93,0xc532cd73,0xbcb1b490,0xbd12b450,0xd594bcd1,0x934ad593,
-0xd48a9b46,0xfdccfe10,0xd4e9d4ea,0xd4ce8221,0xdceebc4c,0xff1669e1,0xf5eefed3,0xc44cdd2c,0xabc9abc8,0xb46cc46c,0xbcf17a86,0xbcd0c512,0xc532b48f,0x6a42a40d,0x8328ac4c,0x9beab4cd,0xc52c72c2,0xc56fde53,0x28807b27,0x9c0a8308,0x188030e0,0x00000000,0x082020e3,0x41a441c6,0x18203101,0x51c32880,0x624551c4,0x7b485a03,0x5a459c2c,0x6aa7730a,0x28805a04,0x7b094142,
-0x49208b49,0x83096204,0x1820838c,0x9bac30a0,0x8b0561c1,0xa3c79325,0x8b04bc8b,0xabe682e2,0x7ac18281,0x83048b43,0x9b889386,0x8b479347,0x72648b07,0x62028b47,0x72e86a64,0xbd3393ec,0xde17d5f6,0xddf7cd95,0xd5d6d596,0xcdb6cd95,0x6a893924,0x41a562a9,0x5a875a88,0x4a0549e4,0x62a71860,0x6a876287,0x836a72e8,0x72e8836a,0x73096aa8,0x834a6286,0x93cc72c7,0x7ae88329,
-0x00001081,0x08400840,0x6b4d39e7,0x84307bcf,0xa4d3a514,0xb4f49411,0xbd95bd35,0x30e37aec,0x080028c2,0x08400820,0x83ef5aaa,0x6b2c83cf,0x734c8c30,0x51e662a9,0x10004984,0x08000000,0x08002903,0x18a241e6,0x4a075aaa,0x39865228,0x00000800,0x62cb0841,0x6b2c5a89,0xbd3420e1,0xb515a4b3,0xacb3b515,0x40c4a471,0xacf3836e,0x5249738e,0x00001040,0x10003986,0x18001000,
-0xb4f3b4f3,0xacb15a07,0xc595942f,0xa4d20800,0x9c50ce17,0xbd55bd54,0xe69ac5b6,0xc5d6cdd6,0x93efc595,0xac71b4b2,0xac91a471,0x832b834d,0x9c2fa490,0xb4d2a470,0xac91ac71,0xb4d2b4d2,0xb4719bef,0xbd12ac90,0xc573bd12,0xf6fabcd2,0x28806248,0x39203060,0xb4d18b6b,0xac4f8b4b,0xbd52bd52,0xb4d0c552,0xbcf1cd73,0xc532b4d0,0xb4b0c4f2,0x9bedc552,0xbcf1c532,0xbcafbcf1,
-0xff35ee13,0xfe71ff97,0xff14ff14,0xff56fed5,0xffd8ffb8,0xf6b2ee73,0xee51fe51,0xd54fffd8,0xbc4ac4ed,0xbc4bb409,0x82c7bc6c,0xddd5e636,0xb4f0c512,0xac0d9b89,0x72a5b48e,0x9c4dac8e,0x41806a83,0x10001840,0xffdc3101,0x08009c6d,0x08001000,0x10600820,0x00000020,0x52051840,0x6aa649a3,0x62447b28,0x72a68348,0x9c4e72a6,0x49a1acf0,0x5a436ac7,0x20003921,0xa3ec2880,
-0x82c88b27,0x9bcc6a24,0x30c1b4f3,0xc4ce59e4,0x9b63abea,0xabc7a385,0xc48d9344,0x8b02b46b,0x6a008ae2,0x8b2459e0,0xa3c88304,0x61e082e4,0x7aa76a41,0x61e27a86,0x7b2a72a6,0xcd94b4b2,0xe678d5d6,0xd596d5d6,0xcdb6d5b6,0x51a6e679,0x9450c595,0x5a477b6c,0x52672901,0x394149a3,0x520530c0,0x6ac772e9,0x73087b09,0x72e76ac7,0x62656aa6,0x6ac87b09,0x7b285202,0x6a667b07,
-0x21032944,0x00001082,0x18e30000,0x841094b2,0xb57694b2,0x9431bd55,0x8bce9451,0x30e351c7,0x20e23944,0x00000800,0x08400800,0x630c4228,0x6b0c6b2c,0x9450738d,0x5a29836d,0x08002062,0x00000000,0x08201061,0x39850820,0x49e74a07,0x100030e3,0x29031000,0x29033964,0x52483164,0x9c923985,0xac73a472,0x38e3c575,0xc596836e,0x49c77b8e,0x20c349c7,0x51e71881,0x7b0c834d,
-0x41044924,0xbd54bcd3,0x4985d616,0x39642861,0xbd54ad12,0xacf3a491,0x9cd2a4d2,0xad13ad13,0xacf2a491,0xcdd6cd95,0xb4d2c534,0xac71bcf3,0xa430ac71,0xa470a430,0xac71a450,0xbd13bcf2,0xc4f3bcd2,0xb4b1b4d2,0xc573acb1,0x7b2b9c0e,0x8b6c8bcd,0x410151c4,0xa3cc38a0,0xcd747b0a,0xa46fbd12,0xbcf1bd12,0xac90c532,0xb4d1bd12,0xbd12c532,0xc4f2c512,0xc4f1c512,0xd593c511,
-0xf5f08aa5,0xfdeefef2,0xf5acf671,0xc467d4c8,0xd52dd50b,0xc48accec,0xbcecbc29,0x9ba9a3ca,0xc4abcd0e,0xe5d1ccec,0x8b08b48d,0xcd74e615,0x72a6cd72,0x8b2772a6,0x5a25a40d,0xc55149a2,0x184028e0,0x5a6649e4,0x39221020,0x7b0851a3,0x62a94182,0x08013984,0x00000000,0x41a20000,0x5a246266,0x8bcc7308,0x5a235a43,0x72e672e7,0x62226244,0x62856266,0x30802000,0x82e6ffdc,
-0xa38ba3a9,0xd595d513,0x2820a4b1,0x934759a3,0xb429a3e9,0x93449b65,0xc48aa3c6,0xabc78b03,0x61a08b03,0x8b027a81,0x93448b02,0x7a829324,0x72859b88,0x6a447aa6,0x836a72a6,0xc553bd12,0xd5d6cd95,0xde17d5d6,0xbd34e678,0x51c549a5,0x49845a27,0x41625a47,0x51e428c0,0x73092080,0x72e97b4a,0x7b097309,0x62667ae8,0x5a245a24,0x73086a86,0x62446a86,0x728651c3,0x9c0e8349,
-0x18c22945,0x18c22124,0x00002104,0x4a690020,0x9cd38c71,0x94319cb3,0x93efa4b3,0x394472cb,0x31233965,0x000020e2,0x00000000,0x000062eb,0x21030000,0x9c92840f,0x9cb29c92,0x72ec9c51,0x00002082,0x00000000,0x39850800,0x41a64207,0x39434186,0x10201820,0x314420c1,0x21022943,0x31440800,0xb4f4acb3,0xbcd3c535,0xbd14a431,0x83cfb514,0x186162aa,0x18611040,0xa4b2a4b2,
-0xb4f3b4b2,0x7ae9c534,0xc5548b8d,0x5a06b533,0x182049c4,0xa49272eb,0x947183ce,0x940fad33,0x940f9430,0xb4d293ae,0xbd13a451,0xb4d2c534,0xac71bcd3,0xac91b492,0xac50a470,0xa42fb4d2,0xcd74bd33,0xa470bd54,0x9c2ec553,0xb4f2ff9c,0xa4b2a490,0xc512b533,0xac6f93ac,0xbd34acb1,0xbd12de16,0xb4d1cd73,0xbd12b4d0,0xbd11a44f,0xcd73bcf1,0xd574c553,0xc512d574,0xcd72cd72,
-0x92a2c4ae,0xfdeffded,0xfed2fe4f,0xe56bf5cd,0xaba6bbe5,0xa3a6b3e7,0xb48abc09,0xa3cb9b89,0xc4ccb42a,0xb44acccb,0xcd2fa3ea,0xe615cd51,0xb4ce8349,0x7284b4af,0x72c75183,0x72e77b09,0x49c34182,0x31003920,0x38e049c3,0x6aa759e3,0x28c11840,0x000018a0,0x00000000,0x390062c8,0x5a2451e3,0x41625a44,0x6a856ae5,0x62436a85,0x39606284,0x51a26a87,0x726561e5,0xdd71ac2c,
-0xf6579b68,0xeeb9f6bb,0x4961cdb4,0x8ae3cd4f,0xac0aa3c8,0xac29b44a,0x932482c1,0x8b02bc6a,0x8ae29b66,0x93657a80,0x9364b44a,0x8ae56a00,0x726482c6,0x62037285,0xbd1282e8,0xbd33c553,0xd5f6cd95,0xe678d5d6,0x6287e658,0x6aa86268,0x62684984,0x49c449c5,0x41836ac8,0x730951e4,0x72c77ae8,0x6a657ae8,0x72a751a2,0x72e86265,0x72e97b09,0x59e36245,0x72a79bec,0x93ac93cc,
-0x18c220e3,0x20e320e3,0x188218a2,0x00000000,0x52aa0000,0x9cd3ad75,0xb4f4a514,0x8b8ea431,0x314449a6,0x20e22923,0x000028e2,0x00000020,0x00000000,0x18e30000,0x83ef7bcf,0x8c2f8c30,0x29039450,0x00000000,0x00000000,0x41c649e7,0x39433965,0x184020a0,0x20a11000,0x29433164,0x18802922,0xa4720000,0xbcf4c535,0xd5b7e639,0xa4f3c576,0x39653165,0x392349e7,0x3945730c,
-0xc595b4b2,0xcd33de17,0xac4f6a47,0x516272a8,0xa4705163,0xacf22060,0x3986b554,0x8c109cb2,0xacb2a492,0x6a499c50,0xacb2b4d2,0xc534cdb6,0xb4d2cdb6,0xb4d2b4b2,0xc533ac71,0xb4b1bcf3,0xbd12ac90,0x5246838c,0x418328c0,0x10000800,0x9c4f942f,0x8badd658,0x72eade17,0xad122080,0xc573b4f1,0xb4d1b4d1,0xa40eac6f,0xb4d1ac6f,0xcd73cd94,0xcd53bcf1,0xcd74ddf5,0xbc8dbcd0,
-0xa385dd71,0xfdeffe0e,0xf60ffe0d,0xfed4fe50,0xbc6bfe92,0xcd2fccce,0xc4eebccd,0x9ba9c510,0xcd0da42c,0xd52ecd2e,0xac2b7a43,0x9c0bf6f6,0x9c6d6aa6,0x8bcb72c7,0x6ac772e8,0x62c77309,0x206051c3,0x6aa75a66,0x62244183,0x6a856a65,0x6b096ac7,0x084041e6,0x08000000,0x51c36aa7,0x30c06265,0x49a251e2,0x62446265,0x6aa66264,0x5a4649e2,0x72a672c7,0xd50e9ba9,0xbc6bc48c,
-0xfef9f635,0xdebaffbd,0x5a02732b,0x93249346,0xac2b92e2,0x92c382c2,0xac099bc7,0x9b45a3a7,0x72409b86,0xabc9a386,0x93238ae3,0x9b8982c4,0x62047ac5,0x72657aa6,0xc533acaf,0xc554c534,0xcd95cd95,0xd616e658,0x834a940d,0xcdf67b0b,0x6a675a26,0x49e47b4a,0x41816286,0x6aa651e3,0x6a656244,0x7b086a65,0x6aa693cd,0x72a76244,0x83496245,0x7ac772a6,0x7aa682e7,0x6a658b28,
-0x21032924,0x18a220e3,0x20e320e3,0x082020c3,0x00000000,0x08400000,0xa5139cd2,0x9430acf3,0x42073985,0x20e341e6,0x000020c2,0x00000000,0x00000000,0x00000000,0x10810000,0x084118a2,0x00000000,0x00000000,0x4a282944,0x314428e3,0x310341a6,0x396320c0,0x08000800,0x18e218a1,0x31840820,0x39051020,0xf6dbac72,0xe659e659,0xb554c5b6,0x62695a8a,0x6a695208,0x9410acd3,
-0xc57538e3,0xcd74cdb6,0xbcd2b491,0x6205cd74,0xb4d2a40f,0x8bee30e2,0xa4d2a4d2,0x18825a8a,0xacd3a492,0xac91a4b1,0xb4b2b4f3,0xcdb6d5f7,0xf69ae659,0xb4d2cd75,0xb4b1bcd2,0xbd13ac70,0xbcf2c532,0x41a56268,0x838c8bed,0x72a8734b,0x6287832a,0xbd331040,0x9c70e678,0x72ca5a27,0xee77e615,0xbd127ae9,0xbcd1bcf2,0xac6fb490,0xbcf1ac90,0xcd53cd73,0xd594d594,0xfeb6cd31,
-0xe5afddb1,0xfef2fdec,0xedf2dd4b,0xedefb469,0x40c0f6d3,0xb44cac0a,0xb44cac2c,0x59e493cc,0x6aa63901,0x18203120,0x9b6930a0,0x5a25c4f0,0x31231000,0x41836aa9,0x39222060,0x51e16a85,0x8bcc6287,0x838b6ae8,0x72c76287,0x5a04836a,0x39841840,0x00011061,0x62c90000,0x62456ac7,0x72c64981,0x30e03900,0x5a0372e8,0x7b296aa5,0x5a436283,0x6a835a01,0xd4eebc6d,0xfeb7d4ed,
-0xffdeff7b,0xacf3ffdf,0xde120800,0xa3e8a3e9,0x9b458aa2,0xa3a98ac2,0xabc8a3a8,0x93457a80,0x9b66abc9,0x9304bc4b,0xa3a89323,0x83069ba9,0x72647aa4,0x72667265,0xcd74b4d0,0xd5b6cd74,0xcd95d5d6,0xcdb5acb1,0x7b2a7b2a,0x6a87836b,0x93cc51e4,0x72e86287,0x7b286286,0x83696aa7,0x6a867b29,0x72e86aa7,0x6aa6836a,0x626572e7,0x72e78bab,0x93ab6244,0x9c2d72c7,0x6a2572a7,
-0x42076b4c,0x18a22924,0x290420c3,0x20c22904,0x000018a2,0x18a10860,0x18810000,0x39a63986,0x29033985,0x20c328e4,0x20c218a1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x398541a5,0x18803144,0x31230800,0x10613102,0x210318c3,0x20e30820,0x20e40000,0xce59a514,0xc5b7ad14,0xad55cdd7,0x310441c7,0x93d06aec,0xacb3a472,
-0x51c6836c,0xc575bcb2,0xbcd2c513,0xbcf3c4f3,0xc554cd95,0xad33cdd6,0x10413164,0xe71b1082,0xb533a491,0xa4715207,0xc555c555,0xb4b2d5f7,0xe658b4f3,0xe679e679,0xd5f6d5f7,0xde37cdb5,0xcd54ac91,0x6b0ae6d8,0x52285208,0xa470628a,0x4183acb0,0x10002080,0xb512cd94,0x8bceb4f3,0xac509c0f,0xc552bcf1,0xcd73cd73,0xb4f1cd53,0xb4d1c532,0xbcf1bd12,0xde36d5d5,0xcd10e5f6,
-0xdd6e7265,0xfdcdfe2e,0x9387ff77,0x82c7d590,0xe5f3d5b1,0xd594bc8e,0xb46bc510,0x41009baa,0x30207246,0x8b482000,0xc4f0c4ef,0xbd52d553,0x00000000,0x10001042,0x18031000,0x20600000,0x08003101,0xbd93944c,0xf75a1881,0x8bab3922,0x18009c6f,0x08000000,0x62670000,0x49a25a24,0x6a6551e2,0x7b0872c7,0x49c130c0,0x62646aa5,0x6ac83900,0xbccf59e4,0xde12cd30,0xffbdeed8,
-0xffffffff,0x9451ce18,0xa40c28a0,0xa3e88b46,0x9b448b25,0xb3c8a385,0x7a609323,0x9b45a386,0x9ba882e2,0x9b86a3a9,0x8305b42a,0x7aa49388,0x6a249b8a,0xbcf19bab,0xbcf3bcd2,0xddd5d5d5,0xeed8d616,0x6a886aa8,0x6ac7834a,0x51e55204,0x6ac77309,0x5a226245,0x624472c7,0x8bac836b,0x7b2972c7,0x6a8572e9,0x6a8672c6,0x7b086245,0x72a6834b,0x834972c7,0x6a667b08,0x7ac772a6,
-0x294520e3,0x20e320e3,0x20c320e4,0x29042904,0x18a220e3,0x10600000,0x10614a28,0x39a65248,0x29243986,0x290420c3,0x20c218a2,0x000018c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x10400000,0x08001040,0x18601882,0x10200800,0x39c61000,0x52695aaa,0x000039c6,0x00000000,0xd69a18a2,0xad96ce9a,0xbdd7c638,0xbd96b5b6,0xacd39c51,0xacd3acd3,
-0x51a693ef,0xc57559c7,0xbcd2bcf2,0xc534bcd2,0xb512c595,0xa512b533,0x082039a5,0x18400800,0xbd340800,0xb4d2c575,0xd618e69a,0xcd96cd96,0xc534b4f3,0xcd75d5d6,0xe678e659,0xc554cdb5,0xbd13bcf3,0x5247b4f1,0x6269628a,0x52075a28,0xb4d272e9,0x28603922,0x20403902,0xacd29c0f,0xddf6bcd2,0xc573bd12,0xbcf1cd73,0xbcf1cd73,0xb4d0bd11,0xcd11bcf1,0xccf1bc6f,0xe5d3c4f2,
-0xd4ced573,0xf62efe90,0xbcedd56a,0xc4efd571,0xd551bcf0,0xcd52d572,0xac0bc4f0,0xbcadf675,0x7244c4ce,0xc4f0a3eb,0xcdb3cd32,0xc5f4b511,0x10010820,0x720240c2,0x48a0ab86,0x83485120,0x83cc7b69,0x18206ac7,0xbd73acb1,0x9c2e2860,0x1040cdd5,0x00000000,0x6a665225,0x6aa56244,0x5a246285,0x6a856a85,0x49a051e3,0x41406a85,0x41a15a03,0x72c54160,0xff7aff19,0xff9dfffd,
-0xf77dffff,0x0800ce18,0xa42b3921,0xbcae9ba8,0xabc7a3ca,0xa3a88ae4,0xa3c8bc4a,0x93039304,0xa3c79b85,0xa3a79326,0x93689346,0x7ac47ac4,0xac2d8b48,0xc533b46f,0xd5b5cd95,0xcd95cdb5,0x836cc574,0x8bcd3103,0x7b0a7309,0x72e972c9,0x62866286,0x626451c3,0x7b086265,0x836a8bcc,0x93ab7b28,0x624572c8,0x7b088349,0x6aa4836a,0x62436a86,0x7b0872a6,0x7ae872a7,0x62257266,
-0x106139a6,0x18a20000,0x29042904,0x31443144,0x29033144,0x20c23124,0x41e72903,0x31450800,0x316539a6,0x20e32925,0x20c320c3,0x20e21881,0x00001020,0x00000000,0x00000000,0x20e218e3,0x41c641a6,0x314441a5,0x10400000,0x00000000,0x08000000,0x10000800,0x08611000,0x41e70000,0x62eb39a6,0x00000000,0x18a30000,0x39c74a69,0x000031a6,0xb596adb6,0x51679c31,0xc4d42801,
-0xc535b4d4,0xcd95728a,0xd5f6de17,0xcdb5b513,0xa4b1ad12,0x9470bd94,0x396441e6,0x61c73903,0x1820ff9d,0xac915207,0x93efbd34,0xac92acb2,0xcd95d5b6,0xd5f7b4f3,0xd5f6c575,0xc554bd13,0xc554cd75,0x4164cd94,0x52085207,0x5a6872eb,0x49635a06,0x72a86246,0x728738c0,0x6a8851a5,0xcd95bcf2,0xbd32bcf1,0xd594b4b0,0x9bcc9bcd,0x938ba3ec,0xac6e8309,0xd592ffdb,0xc4cf7ac9,
-0xbc2ac4ef,0xff36ff13,0xc510cd6f,0xddb2b46b,0xd593c512,0xbcf0d5b4,0xd533c4f1,0x38c0c510,0xd570bcad,0xbcf1ac6c,0xbcafc550,0x7a65936b,0xcc8d6140,0xffd83860,0xfeb1c428,0x5a86ee95,0x08000000,0x00000000,0xc5720000,0x180093cb,0x940e0800,0x8b2a1020,0x51c26243,0x6a8572c6,0x72e730e0,0x62437306,0x5a2251c1,0x41805a03,0x30e04140,0xa42c4141,0xff7cff3a,0xffdeff9c,
-0xd699ffff,0x18200820,0x9bea9bea,0x93678b27,0x9b67ac0a,0xbc8dbc8c,0xa3c8a3a8,0x93228ae2,0x93658b24,0x93458b03,0x7ac482c4,0x8b477aa4,0x8ae97aa4,0xcd55c4f2,0xcd75de17,0xc575cdd6,0x2060838d,0xc5954985,0x41626ac9,0x62666a87,0x6a855a04,0x7b2972c8,0x72e772c6,0x7b4972e7,0x624451e2,0x8b6b8b8a,0x7b287ae8,0x72c68349,0x7b079bed,0x832872c7,0x62457b08,0x62246a65,
-0x00002103,0x08204208,0x21031061,0x20c328e4,0x39862904,0x31033145,0x30c230c2,0x20c228e3,0x290428e3,0x20e318a3,0x18a21862,0x188120e3,0x000018a2,0x00000000,0x00000000,0x00000000,0x290241c6,0x394428c2,0x31233964,0x52485248,0x080041e6,0x08000800,0x08000800,0x398520e3,0x31864229,0x398539a7,0x39860000,0x528a5acb,0x31864208,0x19243186,0xbcf43125,0xb493bcd3,
-0xd5b7cd76,0xbd34acd2,0xc575cd95,0xb533c554,0xb551acf1,0x18a05a66,0x39a62902,0x82eb9430,0xffde7b2b,0xac91bd13,0x30c31000,0xb4f393ef,0xc575cdb6,0xd5b6b4f3,0xcd95cd95,0xbd13cd75,0xb4f3cdb6,0xacb1cdd5,0x7aaad575,0x5a688b2c,0xb4d37bcd,0xacb19c4f,0xacd1d5f6,0xacd2b554,0xd5f6bd33,0xbd12ddf6,0xd5b4de16,0xc512a44f,0xb44ebcf1,0xb46f9bcc,0x938b936b,0xa40b934a,
-0xe653feb6,0x40c0feb2,0xb4af9b8a,0xd551c510,0xdd73b46f,0xcd52dd93,0xbcf0bcf0,0x9b8bc4f0,0xff147ac3,0xcd51bcf0,0x6a64b4cf,0xf6128b68,0x9b4948c0,0x8ac6f634,0xe631d54f,0x10005203,0x10001020,0x00000000,0x9bcd1020,0x20401820,0x9c308bcc,0x6a868baa,0x39006a85,0x62445a03,0x41424160,0x6aa59c2a,0x7b076aa5,0x41406264,0x410051c1,0xc5b51840,0xffdeef1b,0xffffffff,
-0x8430bdf7,0xa42c2080,0x9367a42b,0x9bea9388,0xabc9ac2b,0xabeac4cd,0xabe7bc8b,0xa3e68aa2,0xa3a79325,0x7aa38ae4,0x6a418b06,0x7b057284,0xcd7482e7,0xd596d5b5,0xc5d6cd96,0x39443964,0x41e662ca,0x732a5a68,0x72e9730a,0x49a349a3,0x6a667b09,0x72c772c8,0x72c76aa6,0x62645a03,0x836a6ac7,0x6a657b49,0x8b8a6224,0x83298b8a,0x72e87b08,0x7b0993ec,0x62456204,0x9c2e8bac,
-0x18c20840,0x08200841,0x39c73185,0x6b2d39c7,0xa5148c51,0xbd55bdd7,0x284193f0,0x52283103,0x39663944,0x20e43145,0x18821882,0x18a21882,0x104018a2,0x20e21861,0x18c318c2,0x00000000,0x08000820,0x08002081,0x08001041,0x10610820,0x6aeb3185,0x08005aa9,0x00001020,0x10a20000,0x528a528a,0x4a2849e8,0x6b0c3985,0x39e7528a,0x31863186,0x21242104,0x9c103186,0xc576de39,
-0xc555c575,0xd5f7c554,0xcdb6b534,0xacf2d617,0x730849c5,0x18607b6a,0x00201000,0x8b8d0800,0xa450acd1,0xac91b4b1,0x1000832c,0xbd34b491,0xacd249a6,0xb4f3a4b2,0x8b6db4d2,0xcdb6c575,0xbcf3c554,0xc554b513,0xb4d2cd74,0xeefac554,0x6aaac5d6,0x93cdb4f2,0x9c0e4984,0x9c90836b,0xcdd6acb1,0xde36bd53,0xc553b4b0,0xc532b4d1,0xc512cd53,0xbcd0c553,0xcd72c511,0xb46ecd32,
-0x82e7abec,0xcd51a42b,0xd5938b6a,0xac0dbcb0,0x8b089349,0xccee69a1,0xc531bc8d,0xc510cd52,0xff37dd73,0xa40bb48e,0x9366ddb2,0xedf13060,0xd552abeb,0xc48df656,0x0800abaa,0x20600800,0x3923b4f2,0xacd01800,0xa44bff9c,0x1800ff99,0x30c11000,0x72876224,0x51a04980,0x62444960,0x73085a23,0x83475a22,0x41605a03,0xa44d6242,0x49a451e3,0x7b4a28c0,0xb554b533,0xdf1ba554,
-0x412218c2,0x7b077287,0x8b069c0a,0x9bc98b26,0x9346ac0a,0x9326a3a8,0x9b678aa1,0x9324ac09,0x82c39ba7,0x7aa37a62,0x72837264,0x728472a4,0xd5f5e656,0xc575de17,0x4164d5f7,0xb533730b,0x62a96b2b,0x49c55a68,0x52256ae9,0x62254161,0x72a76a87,0x6a647286,0x6a8772c8,0x626551c2,0x7b297b29,0x72a67308,0x83086a86,0x72a66224,0x6a446a44,0x72c772e8,0x940c6264,0x834a8b8b,
-0x08400000,0x18a11060,0x39a60000,0x630c5269,0x5269736d,0x84105acb,0xc596b5b6,0x30a393af,0x7b2d0000,0x212441a6,0x39452904,0x29042924,0x392518a2,0x00001000,0x00000000,0x10610000,0x08202924,0x10001000,0x41854144,0x00000800,0x00000000,0x00000800,0x00000000,0x00200000,0x5acb528a,0x5208528a,0x4a283165,0x42284207,0x19032164,0x29443185,0x4a072944,0xe679ac31,
-0xde38d5f7,0xc595cdb6,0xb4f33964,0xa4b0b514,0x6ac7ac8f,0x30e06225,0xa4d23102,0xcd55bd75,0xbcf2b4f3,0xbd33acb1,0x2881c534,0xb4f330c2,0xbd34acd2,0x0800d5f7,0xbd549c50,0xb491b4f3,0xb4f2c554,0xbd14b4d2,0xc534c533,0x9beec533,0x82ea6a06,0x93ac8b8d,0x936b8b2a,0x9c4e9c2e,0x6aa96268,0x6a4759c5,0x18005163,0xbcafa3cc,0xbc4cccd0,0xe5d5d5b4,0xcd13d594,0xcd52bcd0,
-0xde15d5b3,0xcd73ac4f,0xc4f1d594,0xc532cd73,0xedb0a3ec,0xe5ade50c,0xa44accee,0xbcf0c530,0xfeb18b07,0x20009b23,0x9c2dc52c,0x8b2861c0,0xf677d592,0xfeb7f677,0xe5d4e5f4,0x20001800,0x836c1820,0x00000801,0x28001000,0x49213820,0x6a445981,0x51a159e2,0x6aa559e2,0x39207b07,0x41606aa4,0x5a027b28,0x6aa551e1,0x624672e7,0x522593ab,0x62035a04,0x18e1732b,0x10600841,
-0x41603142,0x7a848b29,0xa40b7aa4,0x8ac4bc6d,0x9b879367,0x9b88a3a8,0xa3c89b66,0x93049b44,0x83058b44,0x82e47284,0x6a4272a3,0x6a677ac6,0xcdb5ee77,0xa491cdb5,0x10003943,0x49e65a68,0x52286289,0x5a27630a,0x414049c4,0x72e75a45,0x62877b09,0x62656a87,0x72e8838b,0x5a038369,0x730872c7,0x72c75a24,0x7ae872a7,0x7b078b6a,0x62444981,0x51a16223,0x59e36a65,0x72a67286,
-0x00000000,0x00000000,0x00000000,0x10a20000,0x292531a6,0x29653186,0xbdd84a49,0xdd76d639,0x41458b2d,0x7b8e8bcf,0x41a76b0c,0x7bae734c,0x8bef83ef,0x62497b8e,0x20413904,0x000028c2,0x00000000,0x30c20000,0x08001000,0x08001000,0x08000000,0x00000000,0x00000000,0x00000000,0x29450000,0x418739c7,0x62eb3145,0x10610800,0x210318c2,0x39a62124,0x29242103,0xbd556229,
-0xde17d5f7,0xc5b5d5b6,0x844fb5d4,0x8c2fad95,0x38e062c9,0x59856a25,0x38e37268,0x93ee51c6,0x49445a28,0xcd95a450,0xd5d6c554,0xb4d3ac91,0x9c50bd55,0x72ebbd55,0xad13a471,0xb4f3acf2,0xac71bd13,0xc534b4b2,0xc533ac91,0x6a26cd95,0x7a4769e5,0x72268b2a,0x8b0a7226,0x622582e8,0x51c451a3,0x8b6b8b6c,0x830972a8,0xddcfd592,0xfe93f64f,0xbc6cff74,0xd5737a86,0xd5b3e635,
-0xc531ddd4,0xbcd1d594,0xddd5cd53,0xbcd1d593,0xee11d531,0xd4cadce9,0xac28abe6,0xb46e59e3,0xff77b42d,0xff93ff99,0xac8efef8,0xddb4b44d,0xe5f5ee77,0xee36e615,0xddd4ee36,0x51435162,0x180071e4,0x40a12822,0xe5f271a2,0xf5f3feb1,0x72a4c4f0,0x728659e2,0x72a54981,0x416072c6,0x41603900,0x41604180,0x6a844160,0x728540e0,0x61e44960,0x7ae84941,0x20c1c5b6,0x41834184,
-0x82e72840,0x93489366,0x8306ac0c,0x82e48b04,0x9b88a3aa,0xa3a8a3c9,0x8b039b88,0x9305a3c8,0x72637aa4,0x62207ac4,0x72647284,0xee9882e8,0xde78de37,0x6aea7b6c,0x52068bce,0x49e64185,0x628849e6,0x414249c4,0x51a25a45,0x62866ac7,0x9c0d6266,0x7b0772e8,0x72a64961,0x72c86245,0x72c672c6,0x8b8a72a6,0x728693eb,0x6a657ae7,0x7ae76a65,0x836a8349,0x72a77ae8,0x6a257286,
-0x00000000,0x00200000,0x00000000,0x10610820,0x08200820,0x10821061,0x528a4a29,0xce58a514,0x934dde58,0x62ca2800,0x8c3083af,0x7b6e62cb,0x8c309c71,0x9cb2a4d3,0x5a899451,0x08400840,0x31650800,0x39223963,0x31033923,0x18202060,0x5a273902,0x106149c6,0x00200000,0x52693185,0x00000881,0xa4f32124,0xad559cb2,0x00003144,0x292441a6,0x00000840,0x00000000,0xde990000,
-0xde38c5b6,0xbd14cd95,0x1880d5d6,0x00002921,0xe6daad33,0xe658c595,0x61a6c555,0x49037a69,0xc5349c30,0xb4b2b492,0x7b4cc553,0xb553d638,0x394449e6,0x9c91838d,0xb514ad13,0x9c91acd2,0xc554c534,0xc534bcf3,0xbd13bd13,0xc533cd95,0xf6b9bcd2,0xd594bcf2,0xddd5c533,0xe616d594,0xb4d19c4f,0xbcf2a44f,0xee97de36,0xac4c8b8a,0xff78f691,0xff7bff58,0xeeefffda,0x3100ff99,
-0xe6158b69,0xcd73cd74,0xcd73d594,0xd594e656,0xff56ee55,0xee52ee32,0x83659b65,0x8baba44a,0x8a85dd92,0xee53e5b1,0x9beade32,0xbccf8285,0xc551cd52,0xee97d5b3,0xd5f4ee76,0xbcf2f698,0xbd32a40e,0x7ac37b07,0xe54dd50c,0xcccdcccd,0x51a1ac0a,0x59c26203,0x72a672c6,0x49816264,0x93a9a42e,0x626949a1,0xbd53b553,0x5163938c,0xac2fac6f,0xcd74c533,0x1860942f,0x596130c0,
-0xb4adac2d,0x7ac48326,0xa3c79bc8,0xbccc9b88,0x93879347,0x82c59387,0x93469346,0x9bc78b25,0x83069bc9,0x7ac582e6,0x7aa78b89,0xeedaddf6,0x5a47d617,0x8bee62a9,0x83ad28c1,0x526820c1,0x5a0549c5,0x6a876a46,0x6a8672c8,0x62856266,0x8bab93eb,0x5a037b07,0x6aa76284,0x6a657286,0x6aa66a85,0x83288b6a,0x72c772a6,0x6aa672c7,0x72c87b08,0x72c872c7,0x59e37ae8,0x8bab51c2,
-0x00000000,0x00000000,0x00000000,0x31850000,0x20c35289,0x7bae5249,0x94b32924,0xa534a514,0xcdf6c5f7,0x40a3ac51,0x945130e4,0x83cf8bef,0x9471734d,0x7bae7bae,0x83ce20e3,0x62ea9450,0x08201881,0x10200800,0x10201861,0x10200800,0x208028e2,0x41e718a2,0x31445a8a,0x000062eb,0x7bee2965,0x00000000,0x83ef5aaa,0x39851861,0x08414a07,0x08600000,0xc617bdd6,0x00001081,
-0xcd9583ae,0xc575ddf7,0xffbcacb2,0x080020e0,0x28815a47,0xd5f7ddf7,0xbd54cd96,0xacb2bd33,0xb4f3a471,0x93aea451,0x8c0fa470,0x4a071882,0xa4d2ad33,0x9cb2c595,0xb575a4b2,0xacf3bd95,0xbd54b534,0xc554c575,0xb4d2c534,0xcd74b4b1,0xc533bcb1,0xcd53bcd1,0xcd54ddf6,0xddd5bcf2,0xd5d5cd94,0xcd94c533,0xcd73c573,0xc4f1a3ec,0x59c3b4ad,0xff7ee5b3,0xfe2ffffc,0xfe51fef3,
-0x2060ff17,0xcd73bd12,0xd5b4e616,0xe615d5d4,0xedd2d572,0xff78fed4,0x18207aa5,0x72031820,0xdd724900,0xa3edc4ee,0x08002800,0xc5108345,0xc573accf,0xddb5e656,0xe616e616,0xb4d1de16,0xb512b4b1,0xff38cd98,0xcccafef3,0x20008282,0x30a05981,0x6a6572a6,0x51a26223,0x72e76244,0x38e09beb,0x6aa551c1,0xcd936244,0xddd5ddd5,0xd574ddd5,0xf6b9e657,0x10002040,0xa3cb38e0,
-0x9bca9bca,0x8b269bea,0xabea7aa2,0xa3e9ac08,0xa3c9a3c8,0x8b46a3e9,0x9b6782a4,0x7aa49367,0x8b2782a5,0x8ac77aa5,0xe636bc6f,0xe6baee99,0x62886269,0x49c54184,0x5a4851e6,0x5a8849e5,0x6a676a88,0x832a6a66,0x6a8672a8,0x62657b08,0x6aa77b08,0x7ae76ac7,0x8b8c8b8b,0x72a68b6a,0x83496aa6,0x8328834a,0x8b8a5a24,0x5a0372c7,0x72c86245,0x7b09834a,0x7ae772a7,0x8b8b8b8a,
-0x08000800,0x00002104,0x00000000,0x00000000,0x08000840,0x08403144,0x29452944,0x7bf0526a,0xb5d694b3,0xad13c5b5,0x9410ac52,0x186183ae,0x00000800,0x00000000,0x39850800,0x6b2b2924,0x5a897bad,0x106039c6,0x18a20000,0x52690820,0x08002904,0x08000000,0x52080000,0x10203986,0x00000000,0x00000000,0x08210821,0x4a680840,0x1081a533,0x00000000,0x00000000,0x00000020,
-0x82eb732c,0xd5d7c575,0xb554cdb7,0x9c0f8c0e,0xce17a451,0xddf7a4d2,0xbcf4cd95,0x9bf0cd55,0xac71bd34,0xcdb6940f,0x7badce36,0x5269738d,0xad14630b,0xa513b596,0x31a518e2,0x08602103,0x8c512945,0xc575b533,0xc554bcf3,0xcd74bcd2,0xddf6e616,0xddd5ddf6,0xd5b5cd53,0xd5b5d5b5,0xb491cd33,0xc553bd12,0xb46fd5b5,0xbd1040a0,0xacaeb4cf,0xbd0fcd52,0xfdf3bccc,0xfe90f650,
-0x9baddd50,0xb490e616,0xde15d5b4,0xddb4cd73,0xd5d2d5b3,0xd54afe72,0x9bc892a0,0x28205982,0xddf5ccf0,0xd571ff18,0x30603040,0x28201800,0x5a471020,0xbdb4a4b0,0xb573d677,0xc553bd53,0x9c71b513,0xbd510000,0xc5d3ffba,0xf674ff7a,0xcd72e634,0x30a09bec,0x72c76a64,0x62445a03,0x834851a1,0x2820c532,0xbcf18ac8,0xacd2c595,0xee37de37,0xf6d9d5b5,0x180030c1,0x9baa3060,
-0xb46da40a,0x9368a3ec,0x9345b44c,0xa3e9ac0a,0x93879bc8,0x83058b26,0x82a49326,0x7aa582c5,0x7a448264,0xff3b9b28,0xddf8f6db,0x940f9c51,0x49c56aaa,0x730b49c5,0x41a549e6,0x41624983,0x72e95206,0x7b096225,0x7b288b8b,0x5a446aa7,0x7b096aa7,0x62457b09,0x83898389,0x7ae76a86,0x7ae772e7,0x730872e8,0x62257b49,0x6a856266,0x6a876a87,0x626672c8,0x6a877ae7,0x8b6a93cd,
-0x08000820,0x00000000,0x39a60800,0x29232103,0x00000000,0x398520e3,0x420718a2,0x84102925,0x8410736d,0xc596ad34,0x8bef9c51,0x1820ac72,0x00001000,0x00000000,0x00000000,0x31850000,0x4a281061,0x41c64a07,0x10403144,0x10200000,0x00000000,0x00000000,0x00000000,0x10205269,0x08410840,0x00000000,0x00000000,0x08405289,0xa5344a49,0x00001081,0x00002985,0x00000000,
-0x10210000,0xcdf7cdf7,0xd678de38,0xad54ad95,0x3985bdd6,0x5a4941c6,0xbd14c535,0x9c10c555,0xb4f3c555,0xbd95b4f3,0x5a899c91,0x39e74a27,0x5aaa52aa,0x41e65aaa,0x210239a5,0x4a272923,0x398641e7,0xa4711861,0x9c30b513,0xc533bcd3,0xddf6ddf6,0x7ac9ddf5,0xddd6b490,0xde16cd74,0xc553bd12,0xcd94bd33,0xcd73c593,0xc4f1bc70,0xc4f1bc8f,0xd553cd73,0xabebcd10,0xffb7edd0,
-0xc5328b27,0xb490c533,0xd594bcd1,0xd574cd53,0xd572bcb0,0x6280f653,0xb495bc8a,0xc4ecac8c,0xc4afe592,0xdd73d532,0xffdaa3cb,0xdd4bff36,0x39016a42,0x08201020,0x00001060,0xad129c2e,0x0820acf2,0x10200820,0x18001820,0xee54cd71,0xde16d594,0xc553cd94,0x69c2ac0c,0x28204900,0x30a0a42d,0xe6552020,0x49a27b08,0x622672e9,0xcd338b6b,0x20a1ff9c,0x59c430a1,0x9beb93eb,
-0x8b28a3ec,0x93488306,0xbc6b9326,0x8b248ae3,0x9367b40b,0x8b279ba8,0x7a838b06,0xbcb07225,0xfffeff5a,0xfedbff7c,0xde39ee59,0x4164a491,0x20a05a27,0x6267730a,0x51e65a67,0x49a45a46,0x49a2832b,0x72c8832b,0x836a7308,0x72c7834a,0x7ae86aa7,0x62446a86,0x7b08836a,0x7b288349,0x6a666a87,0x5a257b08,0x62658b8a,0x72c851e4,0x7b2a838b,0x6aa66267,0x83297ae8,0x62638369,
-0x00000000,0x00000000,0x10210000,0x08001040,0x082020e2,0x6b0b2923,0x738d6b0b,0x8c307bcf,0x84104a29,0xacd3a4b3,0xa4b29c51,0x51c7a4b2,0x20201800,0x08001000,0x00000800,0x00000000,0x00000000,0x00000000,0x00200000,0x316520e2,0x002039a6,0x00000000,0x00000840,0x41c70800,0x5aaa5aaa,0x5289630b,0x630c5269,0x000039c6,0x00000000,0x000094b2,0x00000000,0x00000000,
-0x00000000,0x39a60800,0x39a5a513,0x08402903,0x62eb18e3,0x6acb4a28,0xc534c534,0xc534bcf4,0xbd349c51,0xd699d638,0x29443164,0x4a2839a6,0x5acb5aaa,0x31645289,0x31644206,0x39853164,0x62cb4a48,0x62ea5289,0xcdb6a491,0xbcd1bcf3,0xcd94ee57,0xcd74e637,0xd5d5acb0,0xddf6ee98,0xcdb4d5f6,0xc553cd94,0xbcd1b4b0,0xc533bd12,0xd594cd74,0xe636cd32,0xcd33c512,0xbcafc4b0,
-0xbcf2b44f,0xe636bcf1,0xb4d1ddd5,0xe5f6ddd5,0xcd31e5f5,0xf617c4cd,0x7280d4cd,0xedd071c0,0xe5afe654,0xac2cedd0,0xb46dc553,0xdd6dff96,0xfffe8b89,0x00007bae,0x6b0a0000,0x8c107b6d,0xbd95c5f7,0x10000800,0xcd721800,0xddd5ddd5,0xbcd0d5b4,0xb48f5162,0xff9aac0d,0xac70bcb0,0xe677de57,0xbd94d637,0xbd96c5b5,0xff9ece38,0xf6bce69a,0x1000ff1b,0x514238e0,0xa42c93eb,
-0x9ba98307,0x9b487ae5,0x9305ac09,0xa3c8abe9,0x9b459b88,0x8ac582a4,0xff9d7224,0xf6dbfedb,0xff1dff1c,0xde5aff9f,0xb4f4ff3d,0x5a4851e7,0x6ac96289,0x6ac9730a,0x62886aa8,0x7b084982,0x51c26225,0x72e872a7,0x6aa76286,0x6a4572e8,0x59c361e3,0x51a16203,0x832972e7,0x6a447ac7,0x7ae872a7,0x72e872e8,0x6a665a04,0x6aa893cd,0x62876266,0x832a6a85,0x83288308,0x6a438308,
-0x00000000,0x00000000,0x00001061,0x20c11880,0x734c3103,0x6b4c8c0f,0x62ca6b2c,0x8c510000,0x83ef4a49,0x72ec9472,0x00001000,0x9c31838e,0xa4b19410,0x18a12903,0x10400000,0x000041c6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x20813164,0x49e62903,0x5a8a5a8a,0x4a286b2c,0x42070000,0x632c52aa,0x00004228,0x00000000,0x00000000,0x00000000,
-0x08000000,0x29030820,0x00003164,0x31a61061,0x29235aaa,0x5a894a48,0xde399bf0,0xbd35c576,0x51a693ef,0x38e34924,0x41c65269,0x4a075248,0x5aaa41e7,0x5aca62eb,0x52485aaa,0x41c64a27,0x398539a6,0x528a5aab,0xacb2a491,0xc534ac92,0xcd95cd54,0xd5b5de17,0xc533cd74,0xcd94de16,0xcdb5bd32,0xde16c553,0xbd12c533,0xcd94ac90,0xc553cd53,0xd594cd93,0xd5b4d5d5,0xbcd1ee36,
-0xc532d5b4,0xee77cd73,0xc512ddf5,0xd593d594,0xddf5d5b4,0xee71ac6d,0xbc2cbc8b,0xfed4b3aa,0xf5eded6c,0xcd8edceb,0xbcd0a3cd,0xc52e9367,0x1020b4f0,0x842f0000,0x00000000,0x00001061,0x6b090000,0x8bccb4f1,0xde35b4d1,0xf657e636,0xb490d594,0xbcf0a40d,0xf676d572,0xd5d5e5f5,0xc554d5f5,0xb556bd97,0xad5694b4,0xc5b7bd76,0xd5d7d5f8,0x6aa9e678,0x8b4a7b27,0x93aa9389,
-0x72a49368,0xa3ea8325,0xbc8cbc8c,0x93259ba7,0x9b477a42,0xcc50a3eb,0xff7efefa,0xffdfffbf,0xffdfffff,0xff9effff,0x6a69b4d3,0x51c56a68,0x93ed51e5,0x5a465a05,0x62666aa7,0x6aa86aa7,0x5a2651e4,0x72e872e8,0x5a256aa7,0x624472c7,0x830a8309,0x83087ae7,0x6a447ac7,0x51a27285,0x7b0972a7,0x7b096225,0x7ae96a87,0x62266a86,0x6a466226,0x72e87ac7,0x62037b08,0x6aa672a6,
-0x00000000,0x00000000,0x00000841,0x00000000,0x18810000,0x8c5062ca,0x41e7738e,0x62eb2904,0x738e2104,0x94117baf,0xa4728bef,0x4186a492,0x10203945,0x00000020,0x00000000,0x00000000,0x41a628c2,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39c70000,0x5a8a5249,0x29444a28,0x4a282103,0x5aeb4a48,0x08415289,0x00000000,0x2945632c,0x00200020,
-0x39430000,0x39a43963,0x5aa94206,0x316541e7,0x10812103,0x62aa4a48,0xb5143082,0xb4f4d618,0xbd75bd34,0x8b6ec576,0x49c65208,0x4a28730c,0x4a4939a6,0x5acb528a,0x5aab528a,0x5aaa5269,0x5a8b5a8b,0x5aaa4a49,0xa4b25a89,0xbcf2b514,0xcd95bcf3,0xbcf2bcd2,0xbcf3ddf7,0xd5b5bcf2,0xb4d1b4d1,0xc553c553,0xbd12c553,0xcd73cd74,0xcd94cd53,0xddd5d5b4,0xddf5cd74,0xcd53d573,
-0xc532c511,0xb4b0b48f,0xc531de15,0xc532b4af,0xe5f5ee77,0xd572cd31,0xf615ee35,0x9308dd72,0xd58fff38,0xf673ee32,0xa4d15204,0xb553ffdb,0x08000000,0x00000000,0x08200800,0x00000000,0xa4f018a2,0xacd1a4b1,0xcdb3c594,0xe615d5b4,0xf71bde36,0xd635cdf5,0xde16f6b8,0xcdd6e657,0x9d14bdd6,0x7bf194b3,0x8c737412,0x9cf39cd3,0xde39c5d7,0xf71bde38,0xa3eb4940,0x9bcb9389,
-0xa3ebb46e,0xa3ca9bca,0xa3ca9ba8,0xff7c7aa6,0xff7fff7d,0xfffff7bf,0xffffffff,0xd6baffff,0x3144ad13,0x39235aaa,0x6a88836b,0xcd9472c9,0x730972c9,0x5a056aa8,0x72e949a3,0x6ac872e8,0x626672c8,0x6aa76ac8,0x62456246,0x72877ae8,0x7b0793ab,0x83497ae7,0x6a4572a6,0x7b086a86,0x72c87ae8,0x7b097ae8,0x832a6aa7,0x7ae78349,0x72a65a04,0x9c0d8329,0x83497aa7,0xb4f07ac7,
-0x00000000,0x08000000,0x080020c2,0x10601080,0x31441880,0x29241040,0x00000820,0x20e341c7,0x949283ef,0x94518410,0x94729cb2,0x838e9410,0x18419c31,0x00000000,0x00000000,0x8c300820,0x6b2c7b8e,0x20a220a2,0x182128a3,0x7b6d20c3,0x00001041,0x41a50860,0x31442903,0x29450820,0x4a4939a6,0x39c73186,0x08610861,0x00000000,0x21040000,0x00000000,0x00200000,0x8410b5b6,
-0x28e139a5,0x41c541e5,0x62ea5a67,0x528a630b,0x31854a69,0x39a63185,0x730c5228,0xbd34acd3,0xad14bd75,0xac92cd96,0xb555a493,0xbd56bd76,0x39857baf,0x5acb4229,0x528a62cc,0x5aab5aab,0x526a5acb,0x5aab5acb,0x52a95aaa,0xd5d67aca,0xcd74ac50,0xcd74c553,0xc534cd95,0xc533de16,0xbd12c553,0xc533c554,0xbd12cd74,0xc553bd12,0xc573c512,0xddd5c573,0xddf6d5b5,0xbcb0bcb0,
-0xbd11bd10,0xcd93c531,0x9bedc551,0x72c7ffbc,0xc532bd12,0xddf5d5d5,0xf6b9fed9,0xd592ee56,0x28603040,0x20202802,0x00001820,0x10000000,0x10001000,0x18001000,0xcd531800,0xce5783ae,0x1860acd2,0x9490ad12,0xb554b5b5,0xd616eed9,0x9c31bd74,0x9c4f6aca,0xc5b59c4e,0xa534a534,0x426a8431,0x31ea10e6,0x6b904ace,0x08200000,0xb57552ca,0xeefcde9a,0xac4d3880,0xa3ca938a,
-0x726492e5,0xde16bcef,0xc515e657,0xddd8d597,0xf7bef6bc,0xffffffdf,0xdf1cffff,0x4a28bd97,0x39015226,0x51a48329,0x59e5a4b1,0x6a8772c9,0x6ac86ac8,0x62665205,0x5a4672e8,0x6a8772e8,0x7b295a25,0x624672e8,0x7ae86266,0x7ae77b09,0x8b696a65,0x7ac67ac6,0x93ab6a85,0x6a657aa7,0x8b8a59e6,0x7ae972a5,0x7b066245,0x938b72a7,0x82c57ac6,0x836a8b69,0x8b6a7ae7,0x7b0651a0,
-0x00000800,0x08000000,0x00000000,0x108120c2,0x18a120e3,0x080020c2,0x39a51040,0x83ef1062,0x39a741e8,0x62cb0861,0x9c728c10,0x20828bcf,0x28a37b6d,0x10202041,0x08400840,0x83ef0000,0x8c309451,0x83cf8c10,0x943093f0,0x8bef7b8e,0x49868c10,0x29033904,0x18812903,0x00000820,0x08400000,0x00200000,0x738e2104,0x00000000,0x00000000,0x002018e3,0x00000000,0x00000000,
-0x49e63144,0x41a51040,0x4a275a67,0x5aeb2944,0x5acb6b2c,0x5aea62eb,0xacf32923,0xcdf7b534,0xb534bd96,0xb595ad54,0xbd95a4f3,0xd638b4f3,0x39a6ad34,0x738e4a49,0x4a4ab597,0x5aab528a,0x5a8b5aab,0x5acb5a8a,0x39c55aaa,0xd5d651a5,0xd5b4cd95,0xc533cd94,0xcd95d5b5,0xd5b5cd94,0xd5d5cdb4,0xbcd2cd75,0xcd74cd74,0xc512c533,0xac4fcd73,0xc4f1d574,0xbcb07288,0xff57ee74,
-0xc4f0ddd2,0xee36cd53,0xddd4ddb4,0xbd10cd31,0xcd73c552,0xd594cd73,0xddd5d594,0xf677d574,0xffbb30a0,0xfe51f5ed,0x00004880,0x20800000,0xddb359a1,0xab68dd93,0xcd74c46e,0x10008b69,0x6ae91020,0x0000736c,0x00000000,0xcdd6ad13,0x180120a1,0x18002021,0x00002840,0x00002124,0x3a091904,0x424a8431,0x00210001,0x106120e4,0x00000060,0xf73dc5f8,0xbccf1000,0xabecbc6d,
-0xeefaeeda,0xb4b3c5b6,0xbd5572ac,0xff9ecdb6,0xffffffdf,0x9431d659,0x412451c7,0x9c4d6ae9,0x18006a86,0xde56accf,0x62468b6b,0x7b0a6a87,0x5a466ac8,0x5a465205,0x6ae86287,0x5a456245,0x72e86267,0x7ae86aa7,0x624659e4,0x72867ae8,0x8b697ae7,0x8bab8b8a,0x72c68329,0x7ae77ac7,0x72c78348,0x72c57288,0xb51172a5,0xacb0b531,0x6a66cdb3,0x9c2d8b49,0x7b07834a,0x6a855180,
-0x29231020,0x00000840,0x00000000,0x18a218a2,0x106018a3,0x290318a2,0x20c23164,0x00000820,0x5aaa2924,0x41c73186,0x83cf4a29,0x730cb514,0x72ab628a,0x208138a3,0x42072903,0x10612103,0x00000000,0x8c1083ae,0x8c1083ef,0x8c1083cf,0x838d9451,0x18603124,0x188020a1,0x00000820,0x00000000,0x10820000,0x00200000,0x00000000,0x00000000,0x00200020,0x00000000,0x00000000,
-0x10400820,0x00001040,0x39a549e6,0x6b4c4a28,0x6b2d5aaa,0x5aea630c,0x41e76b6c,0xc5d75aaa,0xce18732c,0x83cf41c6,0x62aa4a88,0x61e759c7,0x62ca6a69,0x5aab4229,0x4a295a8b,0x524a526a,0x5aab5aab,0x5acb62eb,0x42274a28,0xb4b29bce,0xc532c554,0xd5b6cd94,0xcd54e637,0xd5d5d5b5,0xe657de16,0xcd95e658,0xee78ee78,0xddf6de16,0xcd12cd73,0xd572cd12,0xac2dcd11,0xcd50cd51,
-0xcd31ee34,0xd551cd50,0xbc8e8b48,0xee97b44e,0xac905a05,0xcd53f6b8,0xd5b4c533,0xe5f5bcb1,0xc48bedf4,0xe5b0ff15,0x0800bc6f,0xffd90862,0xff1893a8,0xfed8dd71,0xac0dc4f1,0x72ab5142,0x41426aa6,0x00003144,0x00000000,0x10000820,0x28612061,0xcdcd3900,0x21027284,0x00000020,0x19050000,0x00000000,0x00000000,0x08401001,0x52ca0000,0xc6184228,0xfef8d5f6,0xc575f697,
-0xde18de39,0xbd34cd95,0xff7dc555,0xeedcff5d,0xbd96cdf8,0xacb3ad14,0x28c1bd32,0x93cc3081,0xeeda9bed,0x8bcdd618,0x93cda42d,0x5a067b0a,0x5a465226,0x62876287,0x5a256267,0x5a255204,0x62465a46,0x51c45a25,0x6a866a87,0x7b0872a7,0x72a67ae7,0x7ac67285,0x7ae88b89,0x7ac77ac7,0x20409bcd,0x7ae859e2,0x938a8b4b,0x6a858327,0x8ae88b49,0x7b298329,0x83498349,0x93ca59c2,
-0x18811061,0x10612903,0x10401881,0x108118a2,0x20c283ee,0x526920a2,0x29033185,0x00000000,0x6b6d2124,0x000039e7,0x9cd294b2,0x5249dedb,0x49e77b4d,0x28e37b4d,0x00001020,0x41c739a6,0x8bef3124,0x6acb8c30,0xbd753945,0x8bf08c10,0x736c83cf,0x08003144,0x10400820,0x104020c2,0x106120e3,0x00005289,0x00002924,0x00000000,0x00000841,0x42280000,0x0000e73c,0x00000000,
-0x08000000,0x39a42942,0x39850820,0x630c5aa9,0x528a5aaa,0x528a6b2c,0x528a5aab,0x5aaa5289,0xbdd65aca,0x39a6de99,0x31444a28,0x8bcf6289,0x72cb9c30,0x4a084986,0x4208526a,0x4a294208,0x5aaa526a,0x630b6b0b,0x5a896b0b,0xd5b69c91,0x38c1d574,0xc512bcf2,0xcdf5d5d5,0xcdd5c594,0x49c49c8d,0xac911000,0xde16cdb6,0xe636ee57,0xd573d594,0xddf6cd53,0xc532ee57,0xddb4cd52,
-0x8b28cd31,0xff58f6f8,0xabe8fe72,0x2820c4cb,0x7ae938e0,0xc533b48f,0xddf5d5b4,0xddf5ee77,0x9bedd593,0xf677e5f4,0x5a67f676,0xe6975aa8,0x72861000,0xe5f4e615,0xcd31d593,0xd5b5de37,0x838c836c,0x102051c2,0x08200001,0x6a8538e1,0x6223ee77,0xb4ceacae,0x10408326,0x00200000,0x00000000,0x00000000,0x31440000,0x08001881,0x00000000,0x6b4c18e2,0xeedace38,0xf6fbde59,
-0xde9ac5d7,0xcd96d658,0xc618acb3,0xa514bdb6,0x628a9471,0xcd9583ce,0xb44fb4d1,0xde37d552,0xac90ffdf,0x6a87ac4d,0x59e57ae9,0x62886267,0x6ae86267,0x62a75a66,0x6ac872e9,0x72c85a46,0x6a676246,0x6a867ae9,0x83298349,0x622472a7,0x72a672a6,0x6a6672c6,0x6a867b08,0x82e793cc,0xff764160,0x72a672e6,0x9c2c7b08,0x7b077b69,0x83297ae7,0x938b7ae8,0x6a037aa6,0x59e34141,
-0x08001040,0x20e20820,0x08002903,0x398520c2,0x31443144,0x316520c2,0x08002924,0x00000000,0x10810000,0x08600860,0x19021902,0x52893a07,0x62cb5aaa,0x18611861,0x83cf1881,0x9451a513,0x8c0f9471,0x8c108c51,0x0800628a,0x00000000,0x08200000,0x18a20000,0x08200000,0x62ea0840,0x39c74a28,0x7bae52aa,0x00004208,0x00000000,0x00200000,0x00000000,0x00000020,0x00000000,
-0x6aaa1020,0x49e61020,0x31840840,0x42065248,0x29453184,0x4a494208,0x62eb62eb,0x4a485aaa,0x10815aaa,0x7b8d1061,0x20e339c6,0xc595b513,0xc5d7bd75,0x7b0ccd96,0x41e85a8a,0x41e84208,0x9c7149e9,0xad34b555,0x94309c71,0x62685a69,0xa3cdd5d5,0xc5337267,0xb512bd32,0xb512bd53,0x7b08bd31,0x9c2e72e8,0xc553d5f6,0xddf6d5b4,0xee57cd53,0xee57e616,0xddf5ddf5,0xddf4d593,
-0xf676d573,0x7284c551,0xfff7f799,0xee53ff34,0x7ae9f6d5,0xdd94ddd4,0xc4f1b48f,0xcd73cd53,0x51e5ddf6,0xe5f561e5,0x7b6ce5f5,0x00000800,0xd616acd0,0xbdd6e6b8,0xce37c5f6,0x9c70acf2,0xa46ff6f9,0x5a248bec,0xc5332001,0x2040bccf,0x40e12860,0xa3eb6202,0xa4911800,0x00200861,0x00000000,0x00000000,0x49e52103,0x18604184,0x10000800,0x0040a4f2,0xad569cf3,0xb596d67a,
-0xad35bd96,0xef5cce18,0x0861b596,0x528952aa,0x100062ea,0xc533ad13,0xde38834c,0xd678ffdf,0x28a172c9,0x7b6b732a,0x62476267,0x5a465a67,0x6aa749c4,0x51c45a46,0x62676a87,0x6aa76266,0x6a8772c8,0x6a8772c8,0x72a7834a,0x8308836a,0x7b088b49,0x9bec6a85,0x83298308,0x6a446a44,0x82e782c9,0x83497ac6,0x8bca8349,0x6a858369,0x8b6a93cb,0x936a8b29,0x938a7b08,0x8b6a8349,
-0x294420e3,0x106120e3,0x39651841,0x4a071040,0x18601861,0x08201860,0x18810820,0x10813985,0x29440000,0x31642923,0x08400000,0x086018c2,0x00005aea,0x08203124,0x082018a2,0x9471840f,0x8c5183ef,0x9471a4d3,0x5228a492,0x00001040,0x00000000,0x00000000,0x10414a48,0x10410800,0x00002924,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00200820,0x18820000,
-0x28e30800,0x00000000,0x29033165,0x08200000,0x31861082,0x528a4a69,0x632c4a69,0x632c632c,0x42084a48,0x5aaa4a48,0x734d5269,0x6aeb20e3,0xcdd7b513,0xcd95c575,0xac52cd95,0x49c649a6,0xbd55c596,0x9c30acb2,0x5a275a48,0x72c96269,0x8b6cc4f3,0xd5b4cd54,0x728793ac,0x6a4651c4,0xac6ebd11,0x622682e8,0xde16b512,0xee77ee57,0xe616de16,0xe636ddd5,0xddf5de15,0xee57ee57,
-0xee36dd94,0xdd73d573,0xff33a3ab,0x7245ac49,0xddd4d593,0xb46eddd4,0x8b6972a6,0xc512bcf1,0xc4f1de36,0xddd5d5b4,0x1000f698,0x10000000,0x52886b0a,0x004120e2,0x18810000,0x10200000,0x52036aa7,0x83696a88,0x6a662000,0xa44c82e7,0x6a454960,0x62648ba9,0x39641000,0x00000000,0x00000000,0x00000000,0x418220a0,0x28a05204,0x30e22880,0x08000000,0x18e45289,0x94d49cf4,
-0x94927bcf,0x000073af,0x00000841,0x08201082,0x10401081,0xef1b62ca,0xde59ffbe,0x392230a1,0x7b0a6246,0x72c85205,0x51e572c8,0x6aa76aa8,0x62676246,0x72e86a87,0x62466aa7,0x72e972c8,0x72c86a66,0x6a666a66,0x6a666a87,0x72a672c6,0x72a68b49,0x72867ac7,0x83286a66,0x938a72a7,0x72c672c6,0x72a68349,0x7ae87ae7,0x7ae87ae8,0x8b8b9c0d,0x8b6a834a,0x72a79bcb,0xa44d8bab,
-0x3185630c,0x62eb39c6,0x20e3c5d7,0x100030e3,0x188128c2,0x08201020,0x188120e2,0x29231881,0x18c22123,0x42070000,0x08204207,0x084018c2,0x4a4839a5,0x736c20e3,0x10200820,0x4a281880,0x00001040,0x00000800,0x94714a08,0x4a48ad33,0x00000000,0x29440000,0x9431840f,0x000083cf,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x00200841,0x62cb3165,
-0x732c8bef,0x732b20c2,0x29033144,0x4a496b4c,0x5acb5aaa,0x632c5acb,0x52ca52aa,0x52895aeb,0x630b5aaa,0x528a5289,0x4a484a69,0xdedaad54,0xbd960800,0xeeb9cdf6,0xac50c554,0xc5556a28,0x5a08d5f7,0x6a896a89,0x5a0751c6,0x310230a1,0xe637d5b5,0xcd73cd74,0xbcf1d593,0xbcd0a42e,0xa44eb4af,0xa46f93ad,0xddf6f71a,0xcd53cd54,0xddd5d5b4,0xd5b4d594,0xe615cd52,0xee57ee57,
-0xfefafefa,0xd573ff1b,0xf610ac0e,0x4942ff15,0xcd73ac90,0x8b698b8b,0xd5928328,0xd5b4c532,0xcd32c573,0xddb4d5b4,0x8b0addf5,0x202069c5,0x08201800,0x000028e3,0x08000000,0x18201000,0x20403901,0x6ac6ff3a,0x9c4d3080,0x72a572a6,0x6aa68348,0xfffcacae,0x00008c0e,0x39850820,0x080028e2,0x080041a4,0x7b285a03,0x7b285204,0x18002880,0x290128a0,0x4a8a0860,0x0000528b,
-0x0000ad55,0x00000000,0x9cd30020,0x00002965,0x29450000,0xbdd7630c,0x30c2a4f4,0x410193ad,0x72e97b2a,0x5a4649c4,0x5a26836b,0x6a876aa8,0x72c86aa7,0x72e86267,0x6aa76225,0x72a8834a,0x622572a7,0x626672a7,0x83086a87,0x72a65a03,0x83495a04,0x836a72c8,0x62048b49,0x72a67aa7,0x7ae772a5,0x83298b6a,0x7ac78b6a,0x830872c7,0x72868b49,0x93497286,0x8b487ae7,0x9bca8b49,
-0x00000000,0x39650000,0x6b2b2924,0x31033104,0x20a11841,0x080028e2,0x314428c1,0x08200800,0x18a10800,0x188118a1,0x41e69c91,0x10612924,0x00005aaa,0x420620e3,0x28c239a5,0x186020a1,0x20801840,0x31240800,0x08000000,0x00000000,0x00000000,0x10620000,0x7bcf8410,0x42087bef,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x8c310000,0x00000000,0x00000000,
-0x7b2d6acb,0x6b4bad14,0x39c639c5,0x420852aa,0x4208632c,0x630c4a49,0x632b4a69,0x5aca5289,0x5a89630b,0x426862a9,0x31854a48,0xef7c31a6,0x10402965,0xe658bd74,0xc534de17,0x83adde17,0x7b2c1840,0xd5d7de38,0xd5b6b513,0xf699ddb6,0xb491c573,0xcd73d5b5,0xcd73ee57,0xc573c573,0x8b8be5d5,0xbcf12880,0x7b2a30c1,0xcd73bcf2,0xc532d593,0xe615e636,0xddf5c552,0xee77ee77,
-0xee98ff5b,0xddf5ee77,0x7ac6d5b4,0xee35ac4c,0xbcd1d574,0xa3ede616,0xcd73d594,0xd574e5f6,0xddd5cd94,0xd573e5f5,0xf657ddb4,0xccafddb3,0x51a36a24,0x28005182,0xa4af4902,0xc4f0d5f5,0xe6148b2a,0x6a456a66,0x7ae838c0,0x93e9cd91,0x28a030c0,0x10004163,0x08600000,0x292220e3,0x20a01040,0x5a0328a0,0x62856202,0x5a236265,0x288251e4,0x18601000,0x00411081,0x42080000,
-0x4a693185,0x00000861,0x00005aeb,0x00000000,0x00000000,0x94920000,0xd5d5ad14,0x6a868b2a,0x62266205,0x5a056267,0x62876246,0x7b0972c8,0x72c85a45,0x6a876a66,0x62467ae9,0x62466245,0x72c772c8,0x834a72e8,0x8b8b93ab,0x6a45836a,0x83298329,0x83498329,0x7b089c2c,0x83298b6a,0x834a6a66,0x518272a7,0x72c872c7,0x8b699bed,0x7ae78328,0x938aa42d,0xac2d9bcb,0xa40ca40c,
-0x00000000,0x10410000,0x316520c2,0x4a074a07,0x20813985,0x18401840,0x18c21861,0x000020e3,0x18c11060,0x188118a2,0x9cb22923,0x20e239a5,0x316541c6,0x31852103,0x52082924,0x18203103,0x20a13943,0x31230820,0x10001020,0x08001000,0x08000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x00000000,
-0xd6ba0000,0x83eeb595,0x18a10860,0x00200000,0x18c30000,0x630c5aeb,0x52685acb,0x08405aca,0xc5b6ce37,0x736cbd95,0x20e22944,0x52aa738d,0x082031a6,0xc5b5d658,0xde57de37,0xc5f67b6c,0x83cec5d6,0xc5f6de99,0xacf3c5d5,0xe678d5f6,0xddd5c573,0xd594c532,0xcd73d594,0x6a27bcd1,0x59c57ac9,0x82a67a85,0xc532ac4e,0xcd53cd52,0xddf5d5b4,0xd594e636,0xddf5d593,0xddf5d5b4,
-0xc512cd73,0xddd5cd73,0xe5d5b4d1,0xe5f5d574,0xddd4ddd5,0x5163c511,0xb46fc512,0xb4b0d594,0xcd53bcd1,0xd553e5d5,0xd553ee16,0xe553e593,0x51c3bcb0,0xac8db4cf,0xc595e676,0xe5f5d5b5,0xd594ee38,0x000038e0,0xac8e4141,0x93ebff39,0x3921acd0,0x18400800,0x00400000,0x31436b2c,0x5a864a24,0x93eb83ab,0x5a0372c6,0x626459e2,0x28a15a05,0x10001000,0x00001061,0x08410000,
-0x18c22965,0x00000000,0x00000000,0x00000000,0x00000000,0x73ae0861,0xd5f69471,0x8308ddd5,0x6a476a05,0x6a8759c5,0x72e859e5,0x72c86aa7,0x6a876266,0x6a877b29,0x72c872a8,0x7ae86a86,0x7ae86a66,0x72a76266,0x7ac872c8,0x62046a63,0x6a667286,0x62246a65,0x7ae77ae7,0x83086a86,0x7ae893ab,0x72e87ac8,0x93cc9c2e,0x938a834a,0xac4da42c,0x9bcb8b69,0xac4d9bcb,0x9beb9bcb,
-0x21043166,0x20a21040,0x20c30800,0x31652924,0x31a439c6,0x31432102,0x08001040,0x29240840,0x00000820,0x10610000,0x736d0000,0x18816aec,0x31853985,0x318531c6,0x7bee4a69,0x28c06b4c,0x310220a0,0x20a13963,0x314441a6,0x312428e3,0x8c0f62ca,0x83ce83ef,0x000041e7,0x00610021,0x08000000,0x00001061,0x9cd339a6,0x08001061,0x4228736d,0x20c34a69,0x528a20a3,0x316562eb,
-0x5aaa5269,0x08000000,0x6b4c62ea,0x082162ea,0x18c3738e,0x18e30000,0x39c62124,0x31832123,0xcdd64a25,0x9cb1de9a,0x4a062903,0x0820a4d1,0x00002103,0x73691062,0xcdf5b574,0x840cc595,0x00201061,0x00000820,0xbdd50000,0xbdb52964,0x6aa8b532,0x72467aa7,0xa3ecac2d,0xd5d5cd93,0xc552bcf1,0xcd52d593,0xddd4c532,0xd5b4c4f1,0xd5b4cd73,0xde16ee56,0xac90bd12,0xe616c532,
-0xbcb0ddd4,0xcd53d573,0xa38b938b,0xd573e5b4,0xbcb1a3cd,0xe615cd12,0xcd52e615,0xc531936a,0xd5b4c532,0xd594ee36,0xee36ee57,0x934ac511,0x4900cd11,0xfffb6220,0x6a27a42d,0xcd344922,0xe657d595,0x6267de57,0x5204a44d,0x5a69acaf,0x08000000,0x4206bd94,0x00000821,0x42080000,0x52668c0e,0x7b6a7b8a,0x83488b8c,0x6ac75a01,0x30e05a24,0x28a20800,0x4a2818a2,0x00000020,
-0x29440000,0x000031a6,0x00000000,0x00000000,0x00200000,0x00201903,0xd6364a47,0xddf5ff7b,0x6a468b29,0x72c77246,0x6aa77308,0x6aa76ac7,0x7b096246,0x6aa86287,0x6aa8834b,0x7b097b2a,0x72876a45,0x83296205,0x72c78329,0x83298308,0x6a868329,0x7b29836a,0x6a666a66,0x834a834a,0x836a83aa,0x7b0882c9,0x8b6a836a,0x832893ab,0x83288b69,0x938893a9,0xa3cba40c,0x9369aba9,
-0x00000000,0x20c30000,0x18a20000,0x00000020,0x00000000,0x20a20000,0x42075269,0x31651040,0x41c60800,0x4a280000,0x738d83ef,0x31236acb,0x20c20800,0x18c218c2,0x632b52aa,0x52069c91,0x28e21020,0x316420c2,0x7b8d6b0b,0x7bae83ae,0x630b62ca,0x83ce83ce,0x94318c30,0x08410000,0x00001020,0x00000820,0x00000000,0x08210820,0x42280000,0x7b8e52aa,0x630c62ec,0x6b4d736d,
-0x316562cb,0x6b2c9451,0x18a25249,0x08411061,0x52aa5249,0x00200000,0x20e37bcf,0x00000860,0x41a620e2,0xb534734d,0xd637d618,0x00000000,0x00000000,0x18410000,0x2080f73c,0x5ae85a68,0x9cd17bcd,0x630c0000,0x00002944,0x08200000,0xcdf5cdf6,0xbcf1e656,0xcd32ddd5,0xddf5de16,0xcd73ddf5,0xd5b3e615,0xcd52c512,0xddf5e615,0xc511bcf1,0xd5d4e616,0xc553cdb4,0xd5b4ddf5,
-0xddf5e5f6,0xddb4ddd5,0xd532e5f5,0xd553ccf1,0xe5f6dd94,0xddb4ee37,0xee36ddb4,0xe615e615,0xbcf08309,0xfeb8d594,0xee77ddf5,0xff9dff3a,0x6962bcaf,0x9b8a8aa5,0xcdf572c8,0xde169c0e,0xac8fc574,0xf6f9c532,0xa48f49a4,0xacf11840,0x3923b552,0x734ceefa,0x08000000,0x528a2945,0x6b4a7bce,0x5a645285,0x836a8368,0x72c76244,0x49c35204,0x41a520a0,0x08411081,0x42284208,
-0x00000000,0x29240820,0x00000000,0x08410000,0x00000000,0x10810000,0xe6d9ad54,0xfffff77e,0x9babb46f,0x51c47ac8,0x72c86ac7,0x7b2972c8,0x7309834a,0x6aa872c8,0x72e97b4a,0x72c87ae8,0x72c77ae8,0x938a8b49,0x8b6a8b6a,0x72c772c7,0x7ac76a66,0x72e87b29,0x8b6a72c7,0x83497b08,0x626693cb,0x834a832a,0x83298bab,0xa42c8329,0x8b8aac8e,0x8b698b48,0x938a9baa,0x9349a3aa,
-0x00000000,0x7bef0020,0x08203165,0x00000000,0x39e60000,0x31650020,0x10400820,0x31443144,0x20e320c2,0x108018c1,0x7bcf736d,0x41435a28,0x18c228a0,0x084010c2,0x296410a2,0x49a618a1,0x49e75a69,0x62cb3986,0x08003985,0x5a894a07,0x6b0b7b8d,0x31442923,0x294439a5,0x390420a2,0x72ea5a27,0x29046aeb,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x528a0000,
-0x29040820,0x947239e7,0xbd96c5b7,0x08208c10,0x00007bcf,0x10822945,0x00000020,0xd6790000,0x0000f7df,0xc5d70800,0xde38c576,0x4a27fffe,0x6aeb0000,0x7b4a0800,0x18805225,0x840eef1a,0x00004a26,0x00007bae,0x00000000,0x00000000,0x000020c2,0xde58732b,0xff1bee99,0xee97cdb4,0xd5b4ee56,0xee36f677,0xee56ee36,0xcd73e615,0xd573ddd4,0xac90c532,0xac90b4b0,0xf6b8c512,
-0xff3bee99,0xfeb8fed8,0xfefaf677,0xf677f6b9,0xe5d5e5d5,0xfeb8f678,0xf657f657,0x9b6bff5a,0x9349ee35,0xf6778b4a,0xff5bf677,0xedf7e637,0xedf4ccf3,0xbd71f677,0x10001840,0x62c820c2,0xd5b462a8,0x38e238a0,0x18810820,0x28c10000,0x5205732a,0x8c313164,0x62cb7b8e,0x39c75acb,0x31a439e7,0x398418a2,0x5a8762a6,0x7b49a490,0x5a856266,0x00004a26,0x00000020,0x20c21881,
-0x00000000,0x31430000,0x29221880,0x08000000,0x29040000,0x08002924,0x08000000,0xe678d617,0x7ac89bac,0x6a667246,0x834b7329,0x6aa87b2a,0x6aa772c8,0x626772e8,0x49a36266,0x832872e7,0x8bab7b28,0x8b498369,0x72c77ae8,0x7ae872c7,0x6a8672a7,0x7b0759c3,0x7ae88b49,0x6a248308,0x832959c3,0x8b6a940d,0x938b7b08,0x83288329,0x93aaa42c,0x9bcb9bec,0xac4d8b49,0x82c79bcb,
-0x528a5aab,0x00004207,0x00000000,0x00000000,0x00000000,0x20c218a1,0x630b1081,0x3144bdb6,0x420618a1,0x5aca3165,0x5aa93985,0x83ae83ce,0x00001000,0x08400000,0x31650880,0x62eb4a48,0x9cb29471,0x5a8a7bae,0x39253945,0x390430c3,0x28c230c3,0x29033144,0x39c53964,0x41e64a27,0x522749c6,0x62cb6b0b,0x83ef6b2c,0x00002924,0x00000000,0x00000000,0x00000841,0x10828410,
-0x7bce2124,0x00200000,0xc6589491,0xad34b5b6,0x62eb5289,0x7bcf62eb,0x39e762eb,0x84305aca,0x7bcf7bef,0x52697bae,0xf77d18a2,0xce37de9a,0x208183cd,0x28810000,0x6aa593cf,0x6b063921,0x000028e2,0x0000ce58,0x00000000,0x18810000,0x18401860,0x00003144,0xc5d6f77c,0xddf5d615,0xb4b07b2a,0xd5b4cd73,0xddb4cd32,0xddf5d573,0xd573ddf5,0xc512c4f1,0xa3edbcd1,0xe637fefa,
-0xfedaddb5,0xf6b9f697,0xee77ff5c,0xfeb9edf6,0xf657f698,0xff9cf6b9,0xffddff7c,0xd574ffbd,0xcd32cd32,0xbcd0cd73,0xe657e616,0xddd4d5b4,0xee56f657,0xe675cd31,0x20402040,0x7b8aef18,0xd5d41800,0x1040ddd4,0x7b6dd619,0x94712904,0x2922a4f2,0x62ec6b4d,0x21241081,0x4a494a69,0x39e639e6,0x00000820,0x41630000,0x41a35a26,0x9c4e8bcd,0x184020a1,0x18401820,0x28c03101,
-0x10602900,0x18a00000,0x31431881,0x312239a4,0x18601840,0x314320a0,0x204020c2,0xa44f4185,0xd5129bec,0x7b09ab8a,0x5a057288,0x6a6672a8,0x6aa872a7,0x72c87b09,0x72c77b28,0x7b088329,0x8b6a7ae8,0x936a7ae8,0x59e472a7,0x72a88329,0xd5d38b8a,0x93ab8308,0x72a672c6,0xa44d7b07,0x836a8bcb,0x834a7b29,0x93cc7b29,0x936b8b6b,0x830693aa,0xa3aa8b07,0xbbccb38b,0xfffeddb5,
-0x00000000,0x10a24a48,0x39e77bef,0x00002945,0x00000000,0x00000860,0x18c318c3,0x10a20000,0x8c712964,0x736d630c,0x2924738d,0x8c2f4227,0x62aa6b0b,0x49866aca,0x29442060,0x6b0c4207,0x6b2c734d,0x8c30736d,0x7b8e7bce,0x732c6aca,0x28c26aca,0x18a12903,0x292320e2,0x31842923,0x5aa95268,0x62ec736d,0x6b2c5aca,0x7bee738d,0x10c1630b,0x39c74227,0x00200000,0x00200000,
-0x5aea39e7,0x52aa4207,0x39c60000,0x00000000,0x736d6b2c,0x528a630b,0x00000000,0x00202124,0x08410000,0x000018a2,0x00007bce,0xad542144,0x62a96b4b,0x100028c0,0x49611820,0x41811000,0x31220800,0x18815227,0x00000000,0x18000000,0x20801000,0x00001881,0x7b8c0000,0xc5122880,0xddf59bab,0xd593ddd5,0xc511c512,0xd5b4d593,0xfeb8ddd4,0xe615ddb4,0xc532ddd4,0xc4f1c4f1,
-0xfe99f699,0xe5f5e5f5,0xedf6e5f5,0xe5f6dd94,0xf698fed9,0xfefbee78,0xff5cff7c,0xfed8fed9,0xffbde616,0xf677ddd5,0xdd94d573,0xe5f5dd94,0xffbdf697,0xe5f5f6b8,0x83271800,0x39230800,0xc531cd53,0x9c91ac71,0x29241882,0x20e43186,0x00000860,0x4a4839c6,0x39a64207,0x39a35228,0x106018a0,0x39c42122,0x31415ac8,0x312141e3,0x49c63963,0x186049e5,0x206030e0,0x39212860,
-0x39613921,0x000028e0,0x29011020,0x20802901,0x20601000,0xbd323963,0x6a679c4f,0x6a07a430,0xffffd554,0x61e5eebb,0x72e872e9,0x6a876aa7,0x7b096a66,0x62665a25,0x8b8a6a86,0x93ab7b08,0x8b6a8329,0x83087ae8,0x72c77ae8,0x724572a7,0xacd04142,0x83298329,0x832872c7,0x834993a9,0x8bcb7b28,0x8bab8369,0x8b49834a,0x7ae78308,0x72a67286,0xffdfff7c,0xffffffff,0xffffffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10a20841,0x08601081,0x5aca2103,0x52a95aca,0x210341e6,0x9c717bce,0x414472ec,0x18a14124,0x840f0000,0x840f9492,0x00003165,0x8c306b6d,0x9c919cb1,0x28e383ef,0x29030800,0x316420a2,0x314339a5,0x4a276b2b,0x5a6920e2,0x632b52a9,0x736c41e6,0x842f7b8d,0x39e718a2,0x00004a89,0x002018c3,
-0x00000000,0x00000000,0x00000000,0x00000020,0x08200820,0xffffdeba,0x000018a2,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x942f3144,0x100072e9,0x20c11000,0xffbdc5d5,0x20a07b6a,0x10401060,0x10201861,0x08000840,0x10200800,0x00001881,0x18400820,0xe5f5c553,0xddd5cd94,0xc531cd93,0xcd73cd73,0xee57ee77,0xf6b9ddd5,0xfedad5b5,0xdd94e616,0xd594e5f6,
-0xf6d9ee98,0xff5bfefa,0xfeb8e5f6,0xff3cee77,0xf6b9fefb,0xff1aff1a,0xfeb9fefa,0xff5bff3b,0xf6b8f719,0x7aa8ddb4,0xe616ddb4,0xee77d594,0xff5bff1a,0xfef9f6f9,0x61e5ddb4,0x38800800,0xf6dae5f5,0x2944e659,0x4a4920e3,0x21032925,0x29660000,0x3a072144,0x31842923,0x29013142,0x316318c0,0x42043162,0x398341e4,0x398320c0,0x49e51040,0x39433983,0x416249a3,0x30e028a0,
-0x39401000,0x20603101,0x39831000,0x28802080,0x49a52080,0x8bee8bad,0x8b4c2840,0xffffee18,0xffffffff,0x71e6ffff,0x72c75a25,0x6ac872e8,0x626672e9,0x6aa76245,0x834a7b09,0x7ae882e8,0x82e782c7,0x82e89c0d,0x6a858308,0x6a227245,0x82c99c2e,0x8bab7ae8,0x836a834a,0x9c0da42d,0x8bab8bab,0x8bab72e8,0x7b088b8b,0xa44e6a86,0xffffffde,0xffffffff,0xffdfffff,0xe6daffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10a24a69,0x4a480020,0x41e62103,0x39c62944,0x8c30738d,0x7b6d7b6e,0x082051c7,0x18c20000,0x00000020,0x9cd36b4c,0x42080000,0x8c30bdb5,0x8c0f62ca,0x9c71a4d2,0x00000800,0x08000800,0x18a11040,0x10400000,0x188018a0,0x08003965,0x10001020,0x00001841,0x00001040,0x00000000,
-0x00000000,0x00200000,0x00000000,0x08200000,0x00000000,0x42078c50,0x6b6d738d,0x00000000,0x00000000,0x08200000,0x31650000,0x000041e7,0x000020e2,0xffff0800,0x10201840,0x7b8c734b,0x00002081,0x49e55206,0x000020a2,0x31030000,0x18400800,0x10200000,0x00000820,0xe6980800,0xc4f1d5b5,0xe615e656,0xddf5d5b4,0xcd73f6b8,0xee78cd53,0xf71bee78,0xf697fed9,0xddd5e616,
-0xee57e617,0xff9df638,0xff7cf71b,0xff9dff5b,0xff5bffbd,0xff3af6d9,0xee37fed9,0xe698ff3b,0xbcd1cdb4,0xd5b4bcb0,0xd593f6b8,0xf6d9d573,0xf6b8fefa,0xddb4feb8,0xcd12ee16,0x51437a89,0xee9972a8,0x0000d5f8,0x10810800,0x10810020,0x29242924,0x39843164,0x292041c3,0x3162a4f0,0x21012901,0x39c31060,0x39a32921,0x39a33983,0x18602901,0x312120c0,0x414228a0,0x39214182,
-0x10003941,0x31021000,0x394230e1,0x41224141,0x496130c0,0x6a8a30a0,0xf73dff9e,0xffffffff,0xffffffff,0x6983ffff,0x6a8772e7,0x7ae872c7,0x6a468349,0x59c47267,0x620459e3,0x62237ac5,0x8b288b28,0x82e88349,0x8b6a6a65,0x6a457264,0x83079c0d,0x836a8329,0x72a793cc,0x83698baa,0x72a68307,0x8b8a7ae7,0x9beb8baa,0x6ac87ae7,0xffff944f,0xffffffff,0x9c50ffff,0x6aa87b6b,
-0x080041c6,0x002018c2,0x0820b576,0x00000841,0x00000000,0x08200000,0x00000000,0x00000000,0x29650000,0x00000840,0x00000000,0x08400020,0x18c239e7,0xce38b595,0x4a284207,0x42075249,0x00000020,0x00400000,0xa4f33185,0x000041c6,0x4a280000,0x9c915aa9,0x18819cb1,0x08000800,0x00000000,0x08000000,0x10600820,0x080028c2,0x49c62082,0x08000800,0x08000800,0x00000000,
-0x00000000,0x00000000,0x18c20000,0x00000000,0x00001040,0x00000000,0x00000000,0x00002103,0x00000000,0x00000000,0x00000820,0x08200841,0x10402944,0x08005226,0x49c56ac9,0x94700800,0x62c9a4f2,0x5a89630b,0x00005ae9,0xce170800,0x18000000,0x00000000,0x00000000,0x10611082,0xddf5de78,0xd5b4f6f9,0xe5f5ee36,0xcd53d594,0xe616cd32,0xeeb9ee57,0xff5bf6d9,0xe5d5fefa,
-0xfeb9d552,0xfffef6da,0xf71bfffe,0xf698ff1a,0xe636ee57,0xee98fed9,0xf6b8ff1a,0x730af6b9,0xb4b02040,0xee15cd52,0xee97cd32,0xff1afefa,0xf659ee78,0xf7ddff9d,0xfebbff9d,0xe615e616,0x9b6dcd53,0x2122ac91,0x39c63123,0x31244a07,0x104120a2,0x292120e2,0x21002921,0x106039a2,0x29223963,0x18c02962,0x00000820,0x20e12901,0x41832102,0x396249c4,0x20a00800,0x20801820,
-0x20401000,0x18403921,0x49624162,0x61a46a46,0x696671a4,0xfffff73c,0xffffffff,0xffdfffff,0xffffffdf,0x7226ffff,0x7b096ae7,0x6a656a85,0x62466a87,0x832a7b0a,0x7ac87288,0x93cb8329,0x8b4982e8,0x7ac87ae7,0x7aa682e8,0xbd1261e3,0x93ac72c6,0x7aa78b6b,0x41828bab,0x6a85b4ef,0x72e87b29,0x836a72a6,0x83898348,0x8b8a7b08,0x6aa872e8,0x52066288,0x6aa89c4e,0x62666266,
-0x00000000,0x00000820,0x00000000,0x00000020,0x00000000,0x00000000,0x08200820,0x00000000,0x00000000,0x00200840,0x528994b2,0x000010a2,0x00000040,0x10a20020,0x29242924,0x31242904,0x4a284a07,0x000018a2,0x00000000,0xbd962904,0x08003986,0x00000000,0x00000000,0x00000841,0x08003164,0x000018a1,0x08200800,0x08001020,0x6aea0000,0x3145ce38,0x10200800,0x08210820,
-0x00000000,0x00000000,0x4a480000,0x20e30000,0x8c300820,0x000018a2,0x08200820,0x08400841,0x00000000,0x00000000,0x00000000,0x00000000,0x18800000,0x20e120e1,0x08003163,0x4a680000,0x10812123,0x08200020,0x41441000,0x38e37aa9,0x39241800,0x00001041,0x00000000,0x00000000,0xd61620c2,0xe615e656,0xd573cd73,0xe5f5e5f5,0xddd59bcd,0xddd5f699,0xff3bddd5,0xff9dff9d,
-0xff3bddf5,0xffbdf6fb,0xfffeff9d,0xf6b8f71a,0xde16f698,0xf657fef9,0xc512c512,0x1800d594,0x59a38b28,0xd552c511,0x7a66cd32,0xee78c4f1,0xee37fed9,0xff1bf698,0xffbcff5b,0xf6faffbd,0xcd13ff3b,0x3984f699,0x31233102,0x290120a1,0x184020a0,0x102028c1,0x39613142,0x29011880,0x20e13122,0x31631880,0x29012922,0x20e041a4,0x31003120,0x30c030e0,0x30c03921,0x18002840,
-0x30c030a0,0x18004981,0xa3ad6a66,0xff9fee17,0xf77dffbf,0xff3dffff,0xf6dbe659,0xff5cff3c,0xff9eff9e,0xcd95ff9e,0x62247226,0x72868b2a,0x6a6672a7,0x72a77286,0x72a659c2,0x9baa7ac7,0x8b498308,0x7ac67ae7,0x40c072c5,0x93cce635,0x9bed834b,0xef1a3922,0xeed84984,0x6a877b29,0x8bcb6ac8,0x83498308,0x7b068368,0x7b287ae7,0x6aa8838a,0x6aa86aa7,0x73086266,0x6aa76aa7,
-0x08000800,0x00000000,0x08210820,0x08410000,0x00000020,0x00000000,0x00000000,0x29650000,0x00000000,0x00000000,0x00400000,0x08400000,0x00200000,0x08200861,0x00000000,0x49e70000,0x49c741a6,0x41c63986,0x18a2630c,0x08000000,0xb5758c0f,0x00001040,0x00000000,0x00000000,0x18210000,0x00001820,0x08200000,0x08400000,0x62ea1881,0x0000c617,0x08001882,0x00000800,
-0x00200000,0x00200861,0x00000000,0x18820000,0x08410000,0x08403165,0x18c27bce,0x39c60840,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x41e741c4,0x000018a2,0x00010000,0x00000020,0x00000020,0xeedb41a7,0xde57e678,0xf6fade57,0x00007bae,0x00000000,0x00000840,0xeed90000,0xddf5eeb7,0xddd5ddd5,0xff3af677,0xff7cf678,0xfe99fed9,0xee37e5f6,0xffbeff7d,
-0xff9dff3b,0xffdeff9d,0xff3cee79,0xd5b4ee17,0xc512ee57,0xd553cd53,0xcd12e5f6,0xf616cd52,0xe5d5edf6,0xfed8ee36,0xfefafeb8,0xe616fefb,0xf698f6b9,0xfeb9f678,0xe5b5f637,0xe636cd53,0xc513e698,0x1020ee17,0x28a128c2,0x49c41820,0x31003941,0x41443922,0x62664183,0x18003921,0x10601000,0x08000800,0x080028c1,0x00001862,0x51c32860,0x72c72880,0x40c059a2,0x72c56a64,
-0x83277b06,0x72a872a6,0xf6baa3cf,0xe6dade59,0xfeddff1c,0xf659e659,0xff3cff9d,0xf699fedb,0xe679e658,0xee9af6db,0x6205e616,0x72a77265,0x82e872a6,0x6a457ac7,0x8b4b6206,0x8b087a85,0x8b49938a,0x1800d572,0xb46d4100,0x72c8eeb8,0x10001000,0x8b8bff5c,0x6aa651e4,0x8baa8348,0x626672e8,0x6aa76a85,0x62c78348,0x6ac783ac,0x7b2a5a46,0x62867328,0x83496aa6,0x6aa77b29,
-0x943128e4,0x5a69b534,0x18411841,0x080028a3,0x10200800,0x00001020,0x00000000,0x08610000,0x00000000,0x00000000,0x00004208,0x00000000,0x00000000,0x00000000,0x18c28430,0xad146b2c,0x00004a07,0x18a25248,0x41e739a6,0x08204a49,0x00000000,0x00000000,0x00000000,0x00000000,0x08002924,0x10200800,0x00000000,0x00000000,0x08000800,0x10601020,0x00000000,0x08000800,
-0x00000000,0x39c70861,0x00000000,0x00000000,0x00000000,0x00000000,0x08410020,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x08000000,0x08000800,0x00200000,0x00000000,0x00000000,0x00000000,0x18a20000,0x9cb20000,0x0000738d,0x08200000,0x00000000,0x00000000,0x00000000,0x31640000,0xee57ee57,0xff7bff1a,0xee78ee57,0xff5bf6b9,0xee78ff3b,0xff7cf6fa,
-0xff9dff7c,0xff7cffbd,0xe616ee78,0xde15d594,0xcd73d5d4,0xd573ddb4,0xc4d0d573,0xd573d593,0xf657e5f5,0xd594ee57,0xfed9f698,0xddf6f698,0xe616e616,0xee77f6b9,0xe636ff1a,0xddf6ee77,0xff7cc512,0x5965ff3d,0x50e16122,0x48206182,0x920892c7,0x71249228,0xe55471a5,0x00000800,0x41842080,0x18800000,0x29211881,0x182028e0,0x48c05141,0x720548e1,0x8ae87a66,0x6a2682e9,
-0x8ac748c0,0x20007225,0xf6baff1b,0xfefcf6ba,0xf6fbff1c,0xf6dbee9a,0xf71cff1c,0xf6daff1b,0xe658f6da,0xddf7ee9a,0x6a46d5d6,0x83087286,0x72c88329,0x72a77ae9,0x8b6a7b08,0x6a657ae7,0x8b4b6a64,0x938ab48e,0x940f93cc,0x1000acd2,0xf71b0800,0x836b6a88,0x72e893cb,0x8b8b72e8,0x7b288bcb,0x6ac86ac7,0x6246836a,0x62656287,0x6aa65a45,0x72c87b2a,0x7b297b08,0x51e36aa6,
-0x9c929471,0x9c929c71,0xb5559451,0x00001882,0xa49252aa,0x10006209,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x9cb20861,0x080083ef,0x00000000,0x31651881,0x62a941a5,0x000028c2,0x00000000,0x00000000,0x00000000,0x20810000,0x10200800,0x18c21060,0x08000000,0x00001860,0x080010a2,0x080020c3,0x08000800,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08610000,0x08412945,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000020,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0xee57d574,0xf6b9ddd5,0xfeb9ff5b,0xfed9ff9c,0xfefaff5b,0xfef9fef9,
-0xffbeeed9,0xff7cffde,0xddf5ff1a,0xfef9d5b4,0xcd72c552,0xbcd0cd52,0xddd4d573,0xee36e5f5,0xff5af677,0xee57f678,0xd5b4e616,0xee78e636,0xf6b9f678,0xee77f6b9,0xee77ff1a,0xb4b0cd73,0xee58ddd5,0xff9dfefb,0xffdeef5d,0xff9efffe,0xcc92ffde,0xf618e596,0xf6daff9d,0x79c47aa7,0x82666183,0x488071c4,0x59646963,0xa3ac8aea,0xff9dfed9,0xddb5ff7c,0xff1af71a,0xee58ff7c,
-0xff3bffbd,0xe637f6da,0xf6baddf6,0xfefbfedb,0xee9af6bb,0xe659e639,0xd5d7e679,0xb4f3cd95,0xac71b4f3,0xc575bcf3,0xbd11c555,0x728672c7,0x73098308,0xcd956ac8,0x93cdd5d5,0xc574ee78,0xde18bcf2,0x08007b08,0x62eb0800,0xe6dace17,0x10005207,0x6aa86247,0x72a76a66,0x7b29836a,0x73296ae8,0x62876ae8,0x5a247309,0x62675a24,0x72e97b09,0x834a7b4a,0x7b296aa7,0x7b286aa6,
-0x94929492,0x9c929c72,0x1861a4b2,0x8c10ad14,0xa4d39472,0xacb3a4f3,0x4a084186,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x31860000,0x00000000,0x00000000,0x524918a2,0x20e35208,0x00000000,0x00000000,0x00000000,0x10000800,0x10200800,0x8c501060,0x08000000,0x00000800,0x00000000,0x08200000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00200840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0x10410841,0xb4f31040,0x1060a492,0x00200000,0x00000820,0x18a20000,0xff1be658,0xff1aff1a,0xe657eeb9,0xfef9ee57,0xff5bee78,0xff1aff7b,
-0xff3bf6b9,0xfefaff5c,0xddb4ee77,0xff79d5b4,0x1800ee76,0xb48fcd31,0xdd93ddb4,0xfe77ee35,0xf657ee16,0xddb4ddb4,0xd594d593,0xe616d573,0xfed9ddf5,0xee57f6b8,0xf6b8f698,0xf699ee58,0xf698ee57,0xeeb9f6fa,0xffbdff5c,0xff5cfffe,0xee79ee99,0xfedaf679,0xff3cff7c,0xe5d6feb9,0xe5d6edb5,0xff1bfefb,0xfefaf75b,0xf6baee78,0xee78f699,0xe637f6b9,0xddd6d5b5,0xddf6e616,
-0xd5b5ee98,0xe617ee78,0xff3cddf6,0xee9ade17,0xee79ee9a,0xde38c555,0xd5b6de38,0xd5d6d5d6,0xbd34d5d6,0xbd13bd13,0xc574c574,0xcdd6bd54,0xe678cdf6,0x30e228a1,0x736c3144,0x49a530e2,0x93cc8b2b,0xde78bd35,0x0000de78,0x8c0f1061,0xd679e6fa,0x00001881,0x838b9c4f,0x7b275a25,0x7b8b9c8f,0x5a873100,0x6ac872e8,0x51e47b2a,0x7309a48f,0x6aa67b07,0x836a7b08,0x7b098bac,
-0x210318c2,0x52aa0020,0x08417bae,0x00000000,0xbd764a08,0xd659b555,0x000062cb,0x08410000,0x4228ad75,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb5757bef,0x31445a69,0x4a075aaa,0x39a63985,0x00000800,0x10400000,0x00009c71,0x41a51860,0x10000800,0x08000800,0x00000840,0x00000000,0x29450000,
-0x0820f77d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x41e70000,0x5aeb0020,0x18c262ea,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000deba,0x00000000,0x00000000,0x00000000,0x9c910800,0x08005207,0x00000800,0x00000000,0x00000000,0xdeba18c2,0x18c331a6,0xd5d518a2,0xfed9ee36,0xf6b8f6b8,0xf6b8fed8,
-0xe616feb9,0xfed8e657,0xee57e5d4,0xe636ff3a,0xe5d4ddb4,0xe5f5edf5,0xfed8f677,0xffdcfed9,0xf6f9ff3a,0xddd5f677,0xee56e615,0xee57ddd4,0xf6b8ee77,0xf6b8d5b4,0xf6b8ff5b,0xfefae616,0xff5bff1a,0xe637fefa,0xee78f699,0xee78f6b9,0xfebaf6da,0xff1bff1b,0xf6dafefb,0xff3cff1b,0xff3cff5d,0xf6daff3b,0xf6b9f659,0xee79f6d9,0xee78ee58,0xe637ddf6,0xddd5ddf6,0xe637ddb5,
-0xe636de16,0xee78e637,0xe658ee79,0xe659de38,0xd5f7ee7a,0xde18de18,0xd5f7d5f7,0xde37d5f6,0xbd13cd95,0xef1ccd95,0x83efdedb,0x000039c5,0xd6381020,0x0000d637,0xa4d21040,0x7b4dc5b6,0xa4f40020,0x188083cd,0x10401040,0x00008bee,0xb575f77d,0xce38c618,0xad34c5f8,0xd6971060,0x39840820,0x5a883985,0xbd31836b,0x72e972e9,0x7b29836b,0x8b6a72e8,0x938a8bcc,0x7ac782e8,
-0x00000000,0x00000000,0x73ae0000,0x20e352aa,0x4a28deba,0x08001061,0x39863104,0x00001061,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00002945,0x00000000,0x18e30841,0x52895aeb,0x4a074a28,0x31444a27,0x00000820,0x00000800,0x10200840,0x00001000,0x10401061,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x31041000,0x08610000,0x00000000,0x08210841,0x31652924,0x08201041,0x41e77bad,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0xce59d659,0x0000ffff,0x100028c2,0x10202082,0x00200000,0x18810820,0x188120c3,0x38c03104,0xee78d593,0xee57ee57,0xde15e636,
-0xe616ddd4,0xee16ddb4,0xe615dd94,0xee77e636,0xee36ddd5,0xe5f6f677,0xfef9ee36,0xff7dff7d,0xff9cff5b,0xff1aff3c,0xee36f636,0xddf5cd93,0xddf6e636,0xf6b8ee78,0xff1af6d8,0xfedafeda,0xfebaee58,0xff1cff1c,0xee79fefb,0xee99f6ba,0xff1bf6ba,0xff3cff3c,0xffbeffbf,0xffdfffdf,0xff5cff9d,0xf699feda,0xddd5ee78,0xd5d6ddf6,0xe658cd75,0xee79e638,0xe638d5d6,0xee38f679,
-0xe678e658,0xde18cdb5,0xd5b6c575,0xddd7ddf7,0xddd7ddd7,0xcd95d596,0xcdb5bd13,0xddf6ddd6,0xcdd6eefa,0x00000000,0x00000801,0x00000000,0x2020d638,0xef5b4185,0x180062ca,0xde9a41c7,0x10201000,0x08000000,0x29242922,0x52480800,0x18810000,0x00000000,0x29040020,0x000039a7,0x00000000,0x736c0020,0x62676ae9,0x834a72c7,0x832a93cc,0x8b4a836a,0xcd727ae8,0x82e75961,
-0x08000000,0x00000000,0x00000000,0x8c302103,0xc5f7b595,0x18819450,0x08203985,0x00000000,0xc6180000,0x08208c31,0x00000861,0x00200020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31864a28,0x39c7c5f7,0x080020e2,0x08401060,0x10000800,0x31233102,0x18820000,0x00000000,0x00000000,0x00000000,
-0x00200000,0x00000000,0x00000000,0x00000000,0xffffce18,0xffffef7d,0x00000000,0xd679ffbf,0x00000000,0x41c63986,0x528a39e6,0x316539c7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x94713945,0x08200841,0x00000000,0xf79ef79d,0xe73cd6db,0x8c91ffbe,0x00000020,0x00000861,0x28e33124,0x93ac5a08,0xf698ddd5,0xe616f6b9,0xee97fed8,
-0xee36f698,0xd553ee16,0xf697fe98,0xe615ee77,0xcd53e615,0xff1aee36,0xddf5ff1a,0xff7cff3b,0xff3bfefa,0xff3bff1a,0xf6d9feb9,0xee77e637,0xee57d5b5,0xfeb9ff3b,0xee78feb9,0xfefbfefb,0xff3bf71b,0xff7cffbe,0xff7cff5c,0xff5ce6ba,0xff9dff7d,0xff5ceeda,0xff3cff7d,0xf69afefb,0xf659d596,0xe5f7e617,0xcd74c513,0xcd54c533,0xcd95cd95,0xf699ddf6,0xff1bee58,0xff1bf6da,
-0xee99ee99,0xe638de37,0xc555de17,0xe638ddd7,0xddd7e658,0xcd55cd75,0xcdb5c574,0xd5b6c554,0x9bcf9bce,0x00005165,0x10001041,0x49e75a48,0x734c0000,0x1820acd2,0xb5752882,0x080020c2,0x39850820,0x28e241c6,0x000020e4,0x08201000,0x736d0000,0x08200000,0x08002924,0x00002904,0x00000000,0xdedb2965,0x9c903964,0x6ac76ac8,0x72e87b49,0x9c707b6b,0xf79df7bf,0xfffeffde,
-0x00000800,0x00000000,0x00000000,0x00000000,0x18a218c2,0x00003165,0x29043165,0x000020c3,0x00000000,0x00000000,0x00000000,0x08410841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000882,0x00001882,0x00000000,0x18401820,0x49e60000,0x9cb21881,0x00000000,0x00200000,0x00000000,
-0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x4a480000,0x188118a2,0x41e739e6,0x00000821,0x00000000,0x00000000,0x18e30000,0x00000861,0x00000000,0x00000000,0xacb320a2,0x6b4dffbf,0x00200000,0x00000020,0x10610000,0x10820000,0x00001841,0x00000000,0x08000000,0xacf01882,0x832b7b2a,0xee57d5f6,0xee57f698,0xe636ee56,
-0xf698f6b8,0xf657fed9,0xf697feb8,0xe615ee36,0xd573d593,0xde369bcc,0xe656ee98,0xde16f6d9,0xf678ee78,0xff1be5f5,0xeeb9ff5d,0xddf5f699,0xf698d5b5,0xf679fed9,0xfedae638,0xf699f6ba,0xfebaee58,0xfefbfeba,0xff1cfefb,0xfe9acd55,0xee18ee38,0xf679f659,0xe638ee79,0xf6bade38,0xf6fbf71b,0xf6baff3c,0xfedaee79,0xee99ee78,0xee78e637,0xd5b5f6da,0xd5b6ddf7,0xc595cdb5,
-0xd5d6cdb5,0xde18d5d6,0xee79c575,0xee59e638,0xe618ddf7,0xddf7ddf7,0xcd95d5f6,0xee78d5b6,0xd617d617,0x0840c5b5,0xffff1000,0x4a074a48,0xb574cdf7,0xcd75b533,0x7b0c5a89,0x10401061,0x08000000,0x18821000,0xad342122,0x1081b534,0x106039a5,0x20829c71,0x08611041,0x4a495249,0xa534bdd7,0x00000841,0x62c90000,0x6aca83ac,0x730a732b,0xff9f1020,0xbd74ffdf,0xde1572a7,
-0x08002903,0x00000000,0x000018c3,0x41c62104,0x9cd220c2,0x00003185,0x00000000,0x08410000,0x00001061,0x00000000,0x00200000,0x000010a2,0x6b2c0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00002924,0x000018a2,0x00000820,0x08200000,0x00000000,0x00000000,0x00200000,0x00200000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x0000dedb,0x00200861,0x00000000,0x00000000,0x00000000,0x08000841,0x00000000,0x00000000,0x00000000,0x7b8ef75d,0x41c60800,0x10411020,0x00200000,0x00000000,0x10410840,0x10201840,0x00000020,0x00000000,0x732a1860,0xcdb5cdd5,0xe698d617,0xeed9eefa,0xef3ae6f9,
-0xde77ff7c,0xde36bd12,0xf697de56,0xfeb8e615,0xffbbe615,0xcdd5ffdd,0xcdd50800,0xbd53d617,0xfefaee98,0xee98f6d9,0xe616fefa,0xcd74f678,0xfed9ee57,0xe638ee99,0xff1bf6b9,0xff1bfeda,0xee9af6fb,0xff3ceeba,0xeebaf6ba,0xf6baf6db,0xff7df6ba,0xf77df75c,0xffbfff9e,0xf73bff9d,0xfefbfedb,0xff3cfefb,0xfedbfefb,0xe638ff1b,0xee78de17,0xcd75ddf7,0xd596de17,0xb4d2c554,
-0xa450ac91,0xc554cd95,0xd5d6e617,0xee99de17,0xddf7ee99,0xd5d6cdb6,0xcd95cd96,0xd5d6de17,0xa3eed5b7,0x39213860,0x00001860,0xc5d7eefb,0xb554bd75,0x8c0facf3,0x8befad34,0x106128a1,0x10410800,0x00007bae,0x42085269,0x29049cb2,0xa4d31041,0x000062cb,0x7baf3186,0x39c76b4d,0x00000881,0x00000000,0x00002102,0x00001060,0x10610000,0x5227ffde,0xbd74a512,0xf75cef3b,
-0x002020e2,0x00000000,0x39a60861,0xc5d6ad75,0x41e649e6,0x000039a5,0x08000000,0x00000000,0x00000820,0x00000000,0x00200000,0x00000000,0x10610861,0x1881b575,0x5248bd75,0x00001020,0x00000861,0x00000000,0x00000000,0x00000000,0x29452945,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x94718c71,0x0000736d,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0xff9e0020,0x8410bdb7,0x00000000,0x00000000,0x00000000,0xbdb70841,0xffdeef3c,0x0000ce38,0x00001082,0x08000000,0x18611020,0x18400800,0x10401840,0x084028e2,0x20c20000,0x18610000,0x10413103,0x0000ad55,0x08200820,0x39431880,0x83cd41a3,0x00006aea,0x18a231a5,0x42070840,
-0x08202903,0x72e91000,0xe656de16,0xee55bcd0,0xc4cffed7,0x18002820,0x59a240e0,0x30804120,0xd5d551a5,0xee78e657,0xf6b9ee78,0xfed9f678,0xfed9ee78,0xf6daff9c,0xff1bee99,0xf6fbff9d,0xff5cffbd,0xff7cff7c,0xff3cff9d,0xff9dff3c,0xf6fbe618,0xf75cffbe,0xee99ff5c,0xee18e658,0xe658f6ba,0xf6daf6db,0xee59e658,0xddf7ee79,0xc554de17,0xddf7de17,0xd5b6d596,0xcd75c554,
-0xd5d6c574,0xcd95ee99,0xe658d5d6,0xd5d6e618,0xcd95c555,0xcd95d5d6,0xcdb6c575,0xc534cdb6,0xc533bd34,0x20612000,0xff3c4143,0xacf3cdb6,0x10401020,0xb5541040,0x6aeb0000,0x2104c5d6,0xb5550000,0x0000ce18,0x21040000,0xcdf70000,0xde790000,0x845183f0,0x5aaa7bae,0x08415acb,0x630b0000,0x31232903,0x210128e1,0x10401061,0xffff0820,0x08003164,0xff9da4d0,0xa4b283ae,
-0x00200000,0x00000000,0xd69a0020,0x8c51ffff,0x00200820,0x31650000,0x39a6ce58,0x00001081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x94710840,0x1861738d,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x10810000,0x00000000,0x00000000,0x00000000,0xad750000,0x08401061,0x9471a514,0x738e840f,0x00000020,0x00000000,0x00000000,
-0x000039e7,0x00000000,0x00000000,0x00000000,0x0000c638,0x00000841,0x00200000,0x00000000,0x08200000,0x10601020,0x00000000,0x00002104,0x00000000,0x00000000,0x00000000,0xffff8430,0xf75dff9e,0x39c6c658,0x00001821,0x100028c2,0x00007bad,0x29034a28,0xde99c617,0xad143165,0xffdfffdf,0x000094b2,0x00000861,0x18601861,0x000030c0,0x10600000,0x18a13184,0x10600820,
-0x08001081,0xacd14163,0xddf5de36,0x39032860,0xfff86205,0xfff88b48,0xff96aba5,0xf6d5ffb9,0xffdc3101,0xcdb4eeb8,0xe657e697,0xf6b8eeb9,0xe616feb9,0xddb6ddd6,0xe5f7cd75,0xf6faf699,0xddf7ffff,0xff1bff1b,0xee79e658,0xfe99ff1b,0xde18934c,0xff7dfefb,0xee98cd95,0xff9cff1b,0xff5cf73b,0xff7dff7d,0xf71bff7d,0xf6dbf6fb,0xee9ade18,0xe659ee9a,0xde18e639,0xc534cd95,
-0xc554de17,0xde17cdb6,0xe659d5d6,0xb4f3c555,0xcdb6cd96,0xbd54b513,0xbd14c555,0xb5147b6d,0xf73c9430,0xc595a4d2,0x832cbd75,0x00004986,0x29031040,0x1040a4f3,0x20a23144,0x080028e2,0x18a20000,0x00007c0f,0x00000821,0x0000738e,0x7bcf7bcf,0x2965630c,0x0861630c,0x08200000,0x28c11860,0x49c53964,0x08001840,0x4a061060,0x31412901,0x208072e8,0x28a06244,0x5a8993cb,
-0x00000820,0x00000000,0x00000000,0x08400000,0x00000820,0x08200820,0x00000000,0x18e31081,0x00000000,0x00000000,0x00002104,0x00000000,0x00000000,0x00000000,0x00000000,0xad340000,0x00002103,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x10410000,0x10410820,0x00000020,0x00000000,0x294510a2,0x00000820,0x08411061,0x00000000,0x00000000,0x00000000,
-0x00200000,0x00000020,0x00000000,0x00000000,0x31660000,0x00000000,0x00000000,0x00000000,0x18401000,0x4207628a,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00002945,0x00200000,0x00000020,0x6b4d1062,0xffffffff,0x08409d33,0x18a20800,0x00000800,0x10202081,0x52890000,0x00000020,0x08201040,0x08000800,0x732b3921,0x0000ffff,0x082018c2,0x08001040,
-0x30e120c1,0xa46f5a27,0x28805a27,0x0000e675,0xa4b00800,0x39c5ce5a,0xfffefffe,0x49e3d5b2,0x51c32860,0xbd31c592,0xb4f072e8,0xeed8a48f,0xe677ee98,0xff5ce698,0xeeb9eeb9,0xeeb9f6ba,0xc554e658,0xe6781000,0xfefbf71b,0xe638fefa,0xf6fbfefa,0xf6baff3c,0xf6faf6fa,0xff3bfefb,0xff7dff7d,0xff7dff7d,0xff7dff9d,0xff1cffbe,0xee9aee9a,0xf6dbde18,0xc555d5f7,0xde17cd95,
-0xc575b4f3,0xe638bd34,0xde18e658,0xcd96d5f7,0xbd33c534,0xc554cdb6,0xb514c575,0xc5d7d639,0xef1cd67a,0xb535a514,0xb535ce18,0xffbeb555,0x18a20000,0xc5d739a6,0xdebbb575,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x738e0861,0x00007bcf,0x00000020,0x31640040,0x39633963,0x312241a4,0x20a03943,0x49e249e5,0x5a6662a6,0x30c06265,0xac6d6a65,0x08204100,
-0x00000000,0x00000000,0x00200000,0x08410000,0x00200000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x41e80000,0x00000000,0x00200000,0x08200820,0x00002124,0x00000000,0x00000000,0x00000000,0x6b2b0000,0x5a890000,0x39a55a89,0x20820800,0x00000040,0x00000000,0x00005aaa,0x00002944,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000861,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0xcdb70000,0x0000e679,0x00001041,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x08000000,0x08000800,0x10000800,0x08200800,0xde791041,0x18c3ffff,0x00000000,0x1020ffff,0x30e10000,0x28403080,0x31011000,0x18801860,0xd6153101,
-0x39427b8c,0xb4d128e0,0xacaf6a85,0xa44f83ac,0x186049c4,0x31412080,0x49c14141,0x39003921,0x28c172e9,0x20811000,0x49a5f79c,0x9c2f7b0a,0xce17acd1,0x41e6c5d5,0xd5d6b533,0xcdf7e698,0xde78ef3b,0xe6baff7d,0xde99ce58,0xe678de99,0xe678e678,0xee58f6d9,0xe677ee78,0xeed9eed9,0xeebae699,0xeebaf69a,0xee79e6b9,0xf6daeeba,0xe699f6da,0xee9aff3c,0xee79d5f7,0xd5d6d5f7,
-0xe639d5f7,0xe659ff5d,0xd5d6cdb6,0xcd95cd75,0xff9dc534,0x20816289,0x18211000,0x31450800,0x08410000,0x00000000,0xce79b576,0x000041c7,0x39656b2c,0x18821020,0x4a0828e4,0x5a6a5249,0x83ae6b0c,0x08003965,0x18c32904,0x73ae52aa,0x00006b6d,0x00000000,0x00000000,0x20a13124,0x314228e1,0x312128e1,0x5a4641a2,0x7aa86205,0x49426a44,0x8b6b5983,0x9b8cddd6,0x00206268,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x08410000,0x08410000,0x00000000,0x10610000,0x00000841,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x18a20000,0x10611041,0x83ef0000,0x00007bce,0x00001041,0x00000000,0x08410000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000020,0x00000800,0xf71c1000,0xef1bff7d,0xbd96ffde,0x000020a2,0x10a24a69,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x080010a2,0x28201000,0x7b29942c,0xffff30e1,0x082020c2,0x082020a2,0xff7d0840,0x39441000,0x8bac28e2,0xacd1f6f9,0xffdcf676,0x3a07ff9c,0x28c00800,
-0x72c9b513,0x20402880,0xcdd5a450,0x51a14141,0x10003920,0x83ce3981,0xf7daffff,0x1020f73a,0x3964fffe,0xeefaff3b,0x00001880,0x08001000,0x00000800,0x18001820,0xfefa6a48,0x1881a4b1,0xbd74838d,0x0000bdd6,0x10610881,0xde58630b,0x2923eefb,0xbd74c5b5,0xee79ee58,0xddf7f6da,0xee9ae659,0xe6b9de79,0xde17de58,0xe679e659,0xf6dbf6da,0xde59f6db,0xe658eeba,0xddf7d5d6,
-0xd5d7d5d7,0xe639d5f7,0xd5b6cd96,0xcd75ddd7,0xa3efc554,0x2820c4f3,0x20413840,0x10400800,0x00000000,0x00000000,0x00000000,0x080028c3,0x9c920800,0x524928e3,0x20835a6a,0x7b4d5a89,0x49e70800,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x18600000,0x28e12080,0x28a028c0,0x49c320a0,0xf71bf6fc,0x830ad656,0xd5947ae7,0xffbef6ba,0xfedaff7d,0x31231000,
-0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x10a20000,0xbdf718c3,0x10a2ffdf,0x00000020,0xd6790000,0x00000000,0x000020e3,0x398541e7,0x94911061,0xb534ef3c,0x00000800,0x00000000,0x08410861,0x29650000,0x10610000,0x9c921081,0x00000800,0x00000000,0x00000000,0x31a60000,0x00000000,0x738e5aeb,0x8c2f4a07,0x318541a6,0x9cb20841,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0xce590020,0x00000000,0x94910000,0x20811000,0x1060ad74,0x9cb2ffbe,0x10610000,0x18e30841,0x00000000,0x00000000,0x41e618a1,0x10620800,0x29230820,0x93f01881,0x9bed7aeb,0x5120ff7b,0x18602080,0x10002041,0x00003124,0x31210000,0x20610800,0x7b6d3925,0x7b2bff7d,0x28003042,0x10001800,0x20a11860,
-0x51c42840,0x7b296a66,0x51000800,0xff3bff78,0xffddc574,0x5269fffd,0x00000000,0x0000ffbe,0x52481883,0x31859470,0xe71c0000,0xb596ffff,0x20000800,0xddf54143,0x20203902,0x28001800,0x49851820,0x08000000,0x08002021,0x10001000,0x18a10000,0xce783164,0x8c50bdd6,0xb5957bce,0x39c6c5f7,0x4a282924,0xde58c617,0xd5f6cd73,0xd617bd34,0xeebade79,0xde17de18,0xde38e638,
-0xde17d5f7,0xde17d5d6,0xe679ddf7,0xf6daee99,0xcd55f6ba,0xd5d7e658,0x1800c5b5,0x52272000,0x00000800,0x08000000,0x51e80000,0x08001821,0x31052061,0x41873925,0x624a5229,0x6acab554,0x72eb59e7,0x18602861,0x00001841,0x00000000,0x00000000,0x20a20820,0x31420800,0x41823922,0x51c549a5,0xffff5183,0x828a6a09,0xffff51c7,0xffdeffff,0xffffff9e,0xcd34ffde,0x18004101,
-0xbdb662eb,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00200000,0x00000000,0x00000000,0x08210000,0x94910000,0x080020e3,0x00001882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x736d0000,0x106139a6,0x00000800,0x00000000,0x00000000,0x00000000,0xad3439a7,0xc638ad75,0x08405aca,0xf79d4a28,0xce3818c3,0x00000841,0x00206b6d,
-0x00000000,0x39c718a2,0x00000000,0x00000000,0x00000841,0x00000000,0x08210000,0x00000000,0x10000800,0x20811000,0x9410e6da,0x08000800,0x00000000,0x00000820,0x00000000,0x29241081,0x00003985,0x00000000,0x00000000,0x7b6d0000,0x9c4fa471,0xd5d5de16,0x940fc594,0x8bad5226,0x8329ac90,0xd56efef6,0x72a8ff7a,0x188130e1,0x730a0000,0x51a46245,0x496138e0,0x39011000,
-0xac6f5a05,0x49e5bdb4,0x18801840,0xf77d0060,0x62aade99,0x08001041,0x08001881,0x28e23985,0x08001000,0x1861734c,0x00001040,0x00000000,0x9bed0800,0xd5b4ee77,0xe657cdb4,0xddb5f698,0xfedaf699,0x38c15a26,0xd5b46a06,0x28005163,0x31a51000,0x00000000,0x00001061,0x00000000,0x08610840,0x08400000,0xc595736d,0xfffff6d9,0x732ce699,0xcdf6e699,0xcdb6d5d6,0xd5d6cd75,
-0xde17e658,0xde17e638,0xe679ee79,0xe658de38,0xff1cff1c,0xe618ff1b,0x5a48c534,0x5a077aaa,0x31425226,0x28804183,0x6a696aa9,0x5a0830e3,0x6b0c9c10,0x62cb5aaa,0x5a4862aa,0x40c47acb,0x720982ab,0xff1d722a,0x08001840,0x18000800,0x416438e3,0x30c03901,0x310020a0,0x418349c4,0x18205163,0xffffffdf,0xffbfffff,0xffffffff,0xffffffdf,0xffffffff,0x93ecffff,0x830aa40f,
-0xd679c618,0x082039e7,0x00000000,0x00000000,0x00000000,0x00200020,0x00000000,0x00000000,0x00200000,0x00000000,0x10820000,0x18a20000,0x08203185,0x29440800,0x10200840,0x00000800,0x632c0000,0x0000b596,0x00000000,0x00000000,0x62eb0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x10810000,0x0821ef5c,0x00000000,0x21040000,
-0x00000020,0x10410000,0x0000732c,0x41e60820,0x84107bad,0x62cb4a49,0x7b8e6b0c,0x00001082,0xd6da0020,0x1840bdd6,0x2000ee9a,0x72eb2000,0x4207f7be,0xffff0820,0x5aebffff,0x00000840,0x00000000,0x00000000,0x00000000,0x08000000,0xffdd0800,0x5ac73164,0x8c2c3985,0xbd75ce38,0xddf2f73b,0xffdfffdd,0xce36fffd,0x20c118a1,0xff9bce36,0x28806249,0xe5941000,0x59c24922,
-0xeef9ee97,0x51819c2e,0x31815120,0x49a32941,0x20a028a0,0x49a528c0,0x18403964,0xf73b4a06,0x520751e5,0x18411000,0x3123a471,0xd6371040,0xa42eac6f,0x2020cd73,0xee9830a0,0xe616de36,0xdd94e616,0xde16ee78,0xcdf5cdb5,0xde37ddf8,0x08219470,0x08210000,0x00000821,0x00000820,0x00000000,0x0000630c,0xce180000,0xde58cdf6,0x732ccd95,0x28c21840,0xc595bd74,0xde38e679,
-0xf6daeeba,0xe658eeba,0xe679e638,0xe638e658,0xee59ee99,0xbcf3e638,0xedd7c534,0x7aca9c0f,0x93ae830b,0xd575832c,0x9bceac30,0x7acb9bce,0x830c830c,0x72ab832c,0x40627a8a,0xff9ffebc,0xffffffff,0xbdd7ffdf,0x622659c5,0x5a6772c9,0x6ac75205,0x4a246aa8,0x49a24182,0x100049a3,0xffffffff,0xffdfffdf,0x5a685a2a,0x4a6a51c6,0xffffc619,0x1840d659,0x7a894903,0x7ac77aa7,
-0x00000861,0x00200000,0x00000000,0x00200000,0x29040000,0x000020e3,0x000039c6,0xa5340000,0x00200000,0x00000020,0xc6173185,0x10820000,0x10610000,0x00003165,0xbd75736d,0x62abacf3,0x21041041,0xf79ead75,0xa4f3528a,0x0820ad34,0x4a083986,0x08000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39a65acb,0xa4f318c2,0x83ef7bae,0x94729cd3,
-0x84107b8e,0x83af734d,0x10412903,0x7b8ea4d3,0x7bcf734e,0x736e736e,0x732c7bcf,0x9cf3ffff,0x00200020,0xffbe0000,0xd617ff7c,0xff7dffbe,0x39a6eeda,0x08410000,0x10200841,0xffffff9e,0x2103ffff,0x00000000,0x00000000,0x00000000,0x08200861,0x00000000,0x08000000,0x00000820,0x00001000,0x20803102,0x522549e3,0x8bed7309,0x10000000,0x1820c4f1,0x51a6d5b5,0x48c0f6b7,
-0xddd238e0,0x51604100,0xcd51ee95,0x8b6c41c4,0x50e15124,0xff173000,0x83aefffc,0x51e56ac9,0xe6985a27,0x18201861,0x38a10800,0x49232020,0xddd4f677,0xc4f1e5f5,0xc4d2c4f1,0xee57cd74,0xddf6d5b5,0xd5b5cd94,0xc553d5d5,0xe658cd74,0x000020c2,0x00000000,0xbd74ad33,0x1820a450,0x00001000,0x62eb0000,0x10200000,0x000028e3,0xf75b5a69,0xd637bd74,0x00007bae,0xd6789491,
-0xde37e658,0xe658e658,0xde17d5f7,0xe679ee79,0xe658f6db,0xcdb6cdb6,0xee59f69a,0xfedaddb6,0xcd95de17,0xfefcf69a,0xe638e679,0xff5dff1c,0xff3dfedb,0xfefbf6db,0xffffff9f,0xffffffff,0xffffffff,0x59c6ffff,0x20203922,0x520551c4,0x628751e5,0x5a0459e4,0x59e56266,0xffff30e2,0xf73dff9f,0x61a87b2e,0x390469c9,0x4986838e,0x10412082,0x40a238a3,0x936c5184,0xee35b48f,
-0x00000000,0x00000000,0x2124dedb,0x10820000,0x29044a49,0x00000000,0x00000000,0x08200000,0x8c1041a6,0x00000000,0x00000000,0x000018c2,0x00000000,0x08200840,0x00200000,0x00001061,0x00000020,0x00000000,0x00000000,0x00000000,0x00200000,0x7b2d0000,0x00000800,0x3124ad14,0x00000000,0x00000841,0x00000000,0x00001082,0x00001061,0x00000000,0x00000000,0x736d738e,
-0x00000000,0x734d41e8,0x31656b2c,0x7bcf6b2c,0x52ac4a6b,0x52cc52ac,0x29c6634f,0x39c673ae,0x00000020,0x00000000,0xe6795207,0xffdff71b,0x736dff7d,0x00000000,0x00000000,0x00000840,0x0820ffff,0x18827b8e,0x00000841,0x08200000,0x00000000,0x08000840,0x00001061,0x52690820,0x20c21041,0x39a41020,0x29015265,0x28c120e1,0x59e82860,0xffdcffde,0x1060d553,0xffbb1040,
-0xffb8ffd9,0xbd6df756,0xff38fffa,0x49a4832a,0xcdb45205,0xff9fffdd,0x59a47acd,0x59e46204,0x516269e4,0x61c43880,0xb4b07a87,0xf677f6b8,0xee56ee37,0xff39f697,0xddd5e656,0xcd74d594,0xd5d5e637,0xbd1230c1,0x9bace657,0x49024902,0x100028a1,0x102020a2,0xacb020a1,0xf6b9a44f,0x2061836b,0x08200000,0x08002124,0xcdf71040,0x318562ca,0x526983ce,0x00000000,0xeefa0000,
-0xf71bd617,0xde79de79,0xeedbeefb,0xe679eebb,0xff3cee9a,0xe658ee99,0xee5aee7a,0xde39ee7a,0xf6fcf6fc,0xf6dcff5d,0xe67bf6dc,0xffdfff5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x82a948a4,0x72c872c8,0x38e04162,0x59c359e4,0x624651c4,0x49a659e5,0xf6fcff5e,0xff5eff9f,0xff5df6fd,0x6249acb3,0x9c3061c8,0x49253904,0xf6bc38a3,0x51024965,0x936969c1,
-0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x00000000,0x00000800,0x08200000,0x00000840,0x00000000,0x00000000,0x630c0000,0x0000ad55,0x08001060,0x080020a2,0x00004a08,0x00000000,0x00001061,0x10413985,0x080062cb,0x00000000,0x00000000,0x00001861,0x00000000,0x1082b595,0x00000000,0x08400000,0x10610000,0x00000000,0x9cf30000,0x00000000,0x00000820,
-0x62cb5269,0x00000000,0x738e0000,0x00000821,0x00000000,0x634e0000,0x7bce6b8f,0x10a22124,0x00000020,0x00000820,0x10611081,0x08410840,0x08610000,0x00000020,0xf75d0000,0x1061ffff,0xef5d0840,0xeefcf77d,0x0000ffdf,0x1061ffff,0x08200000,0x00200000,0x00000000,0x102083ae,0x00001881,0xffff2945,0x00002101,0x080018c0,0xa4d24184,0xbc8d3923,0xeed8fffc,0xd573d5b3,
-0x08005a46,0x9cae1020,0xe677d677,0x59825182,0x72446a04,0xa48fa44d,0xff9b6ac8,0xff1aff1a,0xe615ff9c,0xe5d5cd32,0xf677ee36,0xe616d593,0xf6b8e5f6,0xe635ddf5,0xee58e637,0xde16e657,0xde57de16,0x2000e678,0xde1792e8,0x4123e678,0x516430a1,0x61e67268,0xee37e616,0xcd74cd74,0x7b2bd5f6,0x9430bd75,0xef5c0000,0x6b2c3185,0xbd95eefb,0x080020c2,0x08003164,0x08000800,
-0x39850800,0x41c73124,0xd618de59,0xde5acdd7,0xeebbeedc,0xff9ef71c,0xff7effdf,0xee9bde39,0xf6fcee7a,0xff5ee67a,0xff9fff5e,0xffffffff,0xffffffff,0xffdfffff,0xffbfffff,0xff9fffbf,0xffdfff9f,0x6206b492,0x62257288,0x62066247,0x6a477267,0xa3ef7a89,0xff7dffdf,0xff3eff9f,0xf6fdf71d,0xeefdff3d,0xde9bde9b,0xe6dcd639,0xffbfff9f,0xee5aff3d,0x9baeb4b2,0x8a858b0a,
-0x000062eb,0x00000020,0x00000000,0x00000000,0x08200020,0x00200000,0x00000000,0x08202104,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0x08001040,0x0800c5d6,0x104041e7,0x20c2630b,0xb5542902,0x08208c10,0x83cfe6fb,0x8bf0bd96,0x08001861,0x080020e3,0x39860000,0x18e30840,0x08410000,0x00001082,0x00000000,0x00000000,0x00000000,0x00000861,0x00000000,
-0x00000820,0x000018a2,0x00000000,0x00000000,0x00000861,0x39c70000,0x00000000,0x00001081,0x00000000,0x00004207,0x00000000,0x21040840,0x00000000,0x00000000,0x52692924,0x83cf0000,0x084128c3,0x00000000,0x08200000,0x00000000,0x00000841,0x5aaa0820,0x08000000,0x00000820,0x00000000,0x49652860,0x8c3041c5,0x842f0000,0x29230020,0x31611040,0x6aa7cdf4,0x6aa98bac,
-0x394220a1,0x49e639a3,0x7b4b41e5,0xff5b8b2b,0xffbdffbd,0x72a8ff7c,0xff5aee56,0xc4f2de16,0xe5d4cd73,0xee36e5d5,0xf6b8ee36,0xf698e636,0xfef9f698,0xde15e5f5,0xddf6ddd5,0x18002000,0xde36ac6f,0xe698ff5b,0xd5f6de36,0xf6b9e678,0xf6b8f6d9,0xe657f6b9,0xff5bd5d5,0x20209bee,0x38e22000,0x30a21800,0x1800ff3b,0x18001800,0x20419c0f,0xffff0800,0x0000d658,0xc5d6734c,
-0xb554d658,0x41650000,0x00003103,0x10005227,0xef1c6aeb,0xd659eefc,0xd6181882,0xff9ee6db,0xef5dff9e,0xeefcf77d,0xc639de9b,0xbd97ad35,0x7b8fb576,0xce19e6dc,0xf6fdef1d,0xeedcf71d,0xe6fbeedc,0x6a27f69a,0x6a687268,0xcd7593cf,0xffbef6da,0xef3deedb,0xff5eff5e,0xf71dff5e,0xeebbeedc,0xde9cf6fc,0xeefdde7b,0xef1eeedd,0xff7ff75f,0xffbfff7f,0xffffffdf,0xf6faff7e,
-0x08610841,0x08410000,0x00003165,0x00000000,0x00200000,0x00000841,0x10610000,0x00000000,0x00009cf3,0x00000000,0x00000000,0x00000000,0x00000020,0x20e30000,0x20e30020,0x9cf3bdb6,0x5aaab595,0x08000820,0x08001861,0x10400820,0x62aac5f7,0x1821e6ba,0x08000000,0x0000ce38,0x00000000,0x00000000,0x00000020,0x08410000,0xf79d0000,0x528ace38,0x00000800,0x00000000,
-0x21230000,0x08400861,0x08200000,0x00001061,0x00000820,0x00000000,0x00410000,0x00000020,0x00000000,0x00200000,0x00000000,0x0000bdf7,0x00000000,0x00000000,0xffbe0020,0x0000ffbe,0xff9effbe,0x00000020,0x08410000,0x00000020,0x00000000,0x00000820,0x6aa7734b,0x6b2bff7b,0x5aa94a27,0xacd048e0,0x20c20820,0x18610000,0x00000820,0x39621020,0xfffc49e4,0x8c0e4a06,
-0x4a272923,0x7bac5a67,0x41833143,0xe678bd34,0xe636ee36,0xf6b8ff19,0xee56e615,0xe5d5ee98,0xe636ff5a,0xff3ae636,0xf6b9ee97,0xf6b8fef9,0xee56f6b8,0xf6d8e636,0xde58f73a,0xd637cdf6,0xb512bd32,0xf6fa4164,0x498428c1,0xff5bf6d9,0xf6baff1b,0xeeb9ee99,0xf6faf6fa,0xee78e617,0xee57f6d9,0xcd94cd74,0xe677ee78,0xde17ee98,0x4144d595,0x10002061,0xc5750800,0xb533c5d6,
-0x100028e2,0xcdd60800,0x628928e3,0x08000800,0x38e33903,0x202030a2,0x5aaa28c2,0x08001861,0x83ef0020,0x0861b575,0x00000000,0x736dffff,0x30e52924,0x9c5230e5,0xcdb7bd96,0xcdb7cdd8,0xcdb7d619,0xcdb628a3,0xde39cdd7,0xe6bbeebb,0xff7eff5e,0xff3df71d,0xf6fdff5e,0xe67be67b,0xde9bde5a,0xeefee6dc,0xf73eff5f,0xeefef73e,0xf71eeede,0xeeddf73e,0xf6ddf6fd,0xf6dbf6de,
-0x00000000,0x00200000,0x00000000,0x00200000,0x528a0000,0x00000000,0x00000000,0x00000820,0x00008410,0x00000841,0x00000000,0x08610000,0x00000000,0x00000000,0x0000738d,0x002039a6,0x10820000,0xbdd79492,0xbdb6deba,0x000018c2,0xa4b241e7,0xf77dcdf7,0x00001000,0x18a21040,0x08200000,0x00000000,0x00000000,0x00000000,0x10610000,0x9cd20000,0x00000800,0x29241061,
-0x39c60800,0x08200820,0x42070000,0x10810000,0x082018a2,0x00000000,0x00000000,0x18a118a2,0x00000000,0x00000000,0x00000000,0x00000000,0x21040000,0x630c0000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x08200000,0x00000000,0x41e60000,0x00001840,0x6b0b0800,0xbdd60820,0x08001060,0x7b6d2924,0x18a24227,0x31441020,0xd638ff7d,0x732b9c70,
-0x62e94a06,0x5a0762cb,0x49a36226,0x28406246,0xf6b8ddd5,0xf6b8f697,0xd5b4fef9,0xf678e677,0xf697fed8,0xf697ff3a,0xfed9fef9,0xe5f5e637,0xe616cd52,0xb4d0cd52,0xcdd6acd1,0x10000000,0xe699c594,0x08007b8d,0xbd331020,0xf73bf71b,0xe678cdf6,0xd5d6cdb5,0xc533c574,0xcdb5b513,0xde36d656,0xee78d5d5,0xd5d5de16,0xd5d6d5d5,0xff1cd5d6,0xe658ee99,0xd5d7e679,0x2000f6ba,
-0x5a4841a5,0x62699c0f,0xce58bd54,0xd657deda,0x9c30e6b9,0xff5c51c6,0xd679d638,0x62e94a26,0x10402903,0x08000820,0x10000820,0xbd9562ca,0x0800c5f7,0x945041a5,0xb535c5d7,0xcdb7b4f4,0xe67abd56,0xf6dcde59,0xeebcee9b,0xeedce69b,0xeebce67a,0xcdb8cdd8,0xde3ae6bb,0xe6bbd65a,0xffdff75e,0xf73effbf,0xe6bce6bc,0xf73ff75f,0xe6bde6bd,0xd61ae69c,0xde5bde3a,0xe6bbde7b,
-0x00200820,0x00000020,0x00000000,0x00200000,0x00001082,0x18a20000,0xa5130000,0x08610820,0x00000020,0x00000000,0x00000000,0x00200000,0x00000000,0x20e30000,0x08400000,0x00000000,0x00000000,0x00000020,0x31650000,0x316539c6,0x41c62944,0x20411040,0x18a20820,0x18821882,0x10813165,0x08000000,0x00005aeb,0x00000000,0x18a20000,0x00000000,0x0000bd96,0x00005aaa,
-0x4a28ff5d,0x94308bcf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x398520c2,0x00000000,0x00000000,0x00000000,0x00000000,0x08200020,0x00200000,0x10820000,0x738e0840,0x000041e8,0x00000000,0x00000000,0x08610020,0x00000000,0x08000821,0x106239a6,0x28e40800,0x310141a4,0x83ed2020,0x08200000,0x080018a1,0x94712103,0x29220800,0x9cb02943,0x102020e1,
-0x39426ae8,0xc551de98,0x59e48307,0x8ac72860,0xf697cd73,0xc552ee56,0xac4ec511,0xf678d5b4,0xee56feb8,0xf6b8e636,0xff1af6b8,0xd594e657,0xf677e5f5,0xd5d4f6b8,0xff5c5a26,0xa4b1d616,0x29230000,0x00001040,0x3123e6da,0x1060f71b,0xde170820,0xde37d5d6,0x6268bd33,0xacb15a48,0xd636f75a,0xde16cd74,0xb4f2cd94,0xde17c553,0xc554ddf7,0xc534d5f7,0xee99d5d6,0xffbecdb6,
-0xcdd6de58,0xe658d5d7,0xffffd658,0xb594ff5d,0xa491d637,0xc595e678,0x08006acb,0xffffffff,0x08006b0b,0x18804a07,0x41a420a0,0x29040800,0xf77e0000,0x9c92d659,0xb4f4d659,0xa492bd35,0xbd561000,0xde3aeefc,0xe69ce65b,0xe69beebc,0xf6fdf71d,0xf6fdeebb,0xff5eeedc,0xef3df77e,0xeefde6dc,0xe6bceefd,0xef1ef73e,0xe6ddef1d,0xde5cde5c,0xd63ade7b,0xde3ade5b,0xde9cde7b,
-0x00001081,0x00000000,0x00000020,0x18c30000,0x00000000,0x4a280000,0xa513b595,0x10613165,0x08000000,0x00001081,0x4a4839a6,0x00000000,0x08200000,0x00000000,0x000018a2,0x00000000,0x00000000,0x00000820,0x39a65aca,0x18821061,0x62aa41e7,0xef3cd658,0x0000ff7d,0x080020c2,0x62ea20c2,0x00002081,0x08200000,0x00000000,0x10611041,0x0000a4f3,0x00000000,0x00005269,
-0x18001000,0xef1cff9e,0x00009cd3,0x00000000,0x00000000,0x10810000,0x00000000,0x00000000,0x00004a48,0x00000841,0x00000000,0x00000000,0x00000000,0x39c70000,0x00000000,0x08200000,0x10610000,0x0820ffbe,0x080041c6,0x10400000,0x08200800,0xc5d78c30,0x104041c7,0xd6581040,0x20812081,0x18a10000,0x084018a2,0x08000840,0x00000000,0xc5d62923,0x210120e1,0x4a06e71a,
-0x288028a0,0xb531940e,0x7309ff79,0xe6d97309,0xeed8eed9,0xa40dddb4,0xe616ddb4,0xddd5ee57,0xff3aee16,0xf6b8fefa,0xe636e616,0xfef9f698,0xee57ee98,0x2860ee57,0xc594a44f,0x00001020,0x838dd617,0x730bc5d6,0xffdd1800,0x10201000,0x18001000,0x28400800,0x5a2751e6,0x28405a27,0xd617c574,0xc574de17,0xde38de37,0xc5b5e679,0x20611840,0xc574c575,0xc595d617,0xbd34bd14,
-0xc595bd54,0xcdd6c5b5,0x5a690800,0x1840acf3,0xc5b55a68,0x5a48b513,0xf75cffdf,0x2820eedb,0x20822000,0x83ad2882,0xef1bff5c,0xad34c5b6,0x0000b595,0xad14ffbe,0xb4f4b555,0xd6187b4d,0xcdb8bd36,0xf71dde5a,0xeeddf71d,0xe69beebc,0xe69be67b,0xeedcde7b,0xeeddf71d,0xe6bce6dc,0xeefde6bc,0xeefdeefd,0xe6ddeefe,0xde9ddebc,0xe6bde6de,0xe6bdde9d,0xde9ce6dd,0xd67cdebd,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb59662eb,0xad14a513,0x41e7c5d7,0x00001061,0x10810020,0x00000820,0x00000000,0x00000000,0x00001061,0x00000020,0x00000000,0x00000820,0x738d0000,0x83ef62cb,0x00000820,0x00000000,0x00000000,0x18810000,0x6b0b0000,0x0800a4d1,0x08000800,0x080028a2,0x31851060,0x00000000,0x39850000,0x08004185,
-0xffff5a69,0x20c3bd96,0x29440000,0x000083ef,0x00000000,0x00000000,0x00000000,0x18a20000,0x10a2ffff,0x08201040,0x41e620c2,0x31641040,0x00000000,0x00000000,0x21032944,0x10610800,0x000020c3,0x0800eefb,0x08004207,0x10200800,0x00005228,0x00003985,0x08001041,0x29030800,0x39649c50,0x08200000,0x10600820,0x20a00000,0x08201840,0x0000e6fa,0x10601080,0x39a32942,
-0xffbd62ca,0x5a876ae9,0x62876b08,0x3102d616,0xc5541000,0xff9cf6d8,0xee78ffdd,0xff1afed9,0xff7cfeda,0xf6daff1b,0xf6b8ff1a,0xe616e637,0xe616ee57,0xddf6f6d9,0xb532c553,0x0000cdd5,0xffbd28e3,0xacd1ff7c,0x942eff5b,0x51c19c2d,0x730b3921,0x51624142,0xb5334144,0x8bac72c8,0xb5124164,0xd616942f,0xffffbd53,0x08203944,0x20813143,0x30e230e2,0xce1749e6,0xcd95cd96,
-0xc5d6bd75,0xbd75ef1b,0xbd7528e3,0x5207c5b6,0x1020e6b9,0x00001840,0x39a6738d,0x4185cdd7,0xce58b4d3,0xbd95b534,0x8c0facf3,0x18620000,0x62eb0800,0x39a66b2c,0x180149c8,0xde390800,0xf71dde5a,0xe69beebc,0xe67be69b,0xde5ade5b,0xe67be69b,0xe6dcde7b,0xde7be6bc,0xe6bce69c,0xe6bdeedd,0xef1eeedd,0xf77fff5f,0xf75fffbf,0xe6deef1e,0xd65ce6dd,0xcdfacdfa,0xc5fabdf9,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000010a2,0x840f0020,0x10612924,0x00000000,0x00000820,0x00000000,0x00000000,0x08200000,0x00000000,0x00000000,0x00200000,0x08000000,0x00000000,0x08000000,0x18a11060,0x62ebbdd6,0xef3c0000,0x31850800,0xf77cbdb6,0x08000000,0x00001840,0x18400800,0x10410800,0x31241041,0x10201081,0xff9effbf,0x0000ce38,
-0x0000c5d6,0x00003986,0xf79e0820,0x8c30ffbe,0x31a61081,0x000018a2,0x10400000,0x00000800,0x7bae28e3,0x106162eb,0x10201040,0x186020a1,0x10601020,0x108162ca,0x00000000,0x00000000,0x00000020,0x08200000,0x000020e3,0x00000000,0x20e36b0c,0x00003124,0x00000000,0x00000000,0x1020ffff,0x5a690800,0xe6baffff,0x10001861,0x188128a1,0x10401020,0x39833143,0x52474a05,
-0x4a265a88,0x62a86287,0x62a8ad11,0x498351e5,0x180051c4,0xee57fefb,0xfeb8fed9,0xff3aff1a,0xfedaff1a,0xff1aff5b,0xee58ff1a,0xee98f698,0xee77de16,0xddf5de16,0xde57d5f5,0xffff1800,0xeeb9ffff,0xff3b7b4b,0xeed9ac50,0x30a0ff5b,0x41844100,0xde58838c,0xac71b4f2,0xff7cbd33,0x30c21000,0xacb29c50,0xa471940f,0xacf4cdb6,0x00000020,0x630b7bef,0xd617cdf7,0x39a6b554,
-0x00000820,0x29242103,0x1060ad53,0x08000840,0xce175248,0x83cee6fa,0xb5341020,0x732bb513,0xbd95de99,0x3186b534,0xf77c0000,0x1020ad13,0x10003165,0xbdb7c5f7,0xbd569c52,0xcdb8cdd8,0xd5f8cdd8,0xde3acdb8,0xd61ae65b,0xde5ade5b,0xe69cde7b,0xe6bce6bc,0xdebcf73e,0xf73ee6dd,0xf73eef1e,0xf75effbf,0xf77fffbf,0xe6feffbf,0xde9dd65b,0xd67cde9c,0xb598bdb9,0x3188ad78,
-0x00000000,0x00000000,0x31860000,0x00000000,0x00000000,0x00000841,0x00000000,0x00000000,0x00000840,0x29241081,0x18a20820,0xffffb575,0x632ce6fb,0x08202103,0x08200820,0x00000000,0x00000000,0x00000800,0x62ca20c2,0x62aa5a69,0x20c35228,0x00000000,0x00001840,0x106162ca,0x39a620e3,0x082028c2,0x08000800,0xffdf0841,0x00209471,0x102028e3,0x10610000,0x08000800,
-0x0000630b,0xffff0800,0x00000000,0x00000820,0x00000840,0x18c30000,0x18820000,0xffdf1040,0x00000000,0xd6387bce,0x10005a28,0x00001840,0x39a51881,0x10413144,0x00000000,0x20e30020,0x08400000,0x18a22904,0x00000820,0x00000820,0xdebb39a6,0x10411061,0x62aa0000,0x08000000,0x28e3732c,0x00001840,0x1840ffde,0x28e22081,0x10205247,0x28e21881,0x41c31860,0xa4f120e0,
-0x41e420c1,0x62454a26,0x72867ae7,0x5a4638c1,0x49204983,0xc5127204,0xfed9e5f5,0xf698fef9,0xff5bfeb9,0xfefafefa,0xfed9ff1a,0xddf6f698,0xd595ddf6,0xde17d5d6,0xc5b5a44f,0x08000800,0x0000b513,0x1820bd74,0x7ae9a40f,0xff3bff1a,0xeedafef9,0xbd54d617,0xcd95bd33,0xde37940f,0xff3bc554,0xc5d6c5b5,0x5a68ef1b,0x080020a1,0x08400000,0xc618ce59,0x10609cb2,0x29440800,
-0x18a2ad75,0x08200000,0x00001060,0xb533c5f7,0x5a885a68,0x29021020,0x83adbd74,0x31023102,0x00002903,0x00001881,0xff9da513,0x5aa97bad,0x18600000,0x8c505268,0xb556c5d8,0xc597c597,0xc597c577,0xd5f9cdb7,0xd5d9d5f9,0xde9bde3a,0xe69ceedc,0xde7bde7b,0xde9cde7b,0xe6dde6bc,0xe6ddde9c,0xd67cef1e,0xd69bd67b,0xe73fdedc,0xc63ac63b,0xb598ce7b,0x4a4b632e,0x39c72925,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0x00000000,0x20e30000,0x00000020,0x00000000,0x00000000,0x00000000,0x08201040,0x00001861,0x00007bcd,0x52890000,0x00006b2c,0x00000000,0x0000ce38,0xad54c5d6,0x00004a07,0x52274a28,0x41a67b8c,0x18a22903,0x49e7734c,0x8c0fd679,0x10400800,0x28e27bcd,0x4a071000,0x00200020,0x20e20000,0x21031881,0x00000820,
-0x00000840,0x6b4d0000,0xef5cffff,0x08200020,0x00001040,0x08200000,0x00000861,0x00000000,0x528a0000,0x10400020,0xffbe0000,0x4a28f79e,0x7b8d3945,0x00003143,0x00000000,0x00000820,0x00000020,0x18a120e2,0x10610000,0x08410800,0x08000800,0x080049e7,0x51645a89,0x08004985,0x18600800,0x49e70800,0xe6da4a28,0xce38fffe,0x20e1deba,0x10000800,0xa44f72ca,0x5a276b0a,
-0x838b62a8,0xd5f55a27,0x93cdb511,0xff9cc553,0xcd125a27,0xc553ffdc,0xeeb8ff3a,0xf6b9f657,0xff5cff5b,0xffbdff5c,0xff9dffbd,0xff1bff7c,0xee79ff3b,0xd5f6f6da,0xd5f6c574,0xcdb6c554,0xddf7ff1b,0xa40effdd,0xe637c533,0xe617e5f6,0xe678de16,0x28e1ffff,0xd637bd74,0xd5f6a4b1,0xcdb53103,0x6288bd55,0x4a471040,0x00001060,0x08210820,0x39a51060,0x0020deda,0x00000820,
-0x00000820,0x39a41881,0x39a61060,0x10000800,0x39421861,0x9c2f2080,0x946fef1b,0x31433922,0x18805267,0x52265226,0x49c53983,0x52263102,0x52485a69,0x1883736d,0xbd96c5d8,0xb535bd76,0xcd98bd57,0xd65acdb8,0xeefde6dc,0xde9ce6dd,0xd65ad65a,0xd67bd67b,0xce5ad65a,0xc61ad69b,0xce5bc5fa,0xd6dcd6bc,0xce7bb5b8,0x29260001,0x4a6b630e,0x5aec630d,0x526941e7,0x29240840,
-0x00000000,0x00000000,0x00000000,0x10611041,0x00003145,0x18a20000,0x00001061,0x00000000,0x00000020,0x082039a6,0x08200000,0x00000000,0xd6790000,0x000018a2,0xffffa4f3,0x00001060,0x6b0b3185,0xd638e71b,0x08200000,0x20e30000,0x08202944,0x08200000,0x62aa0000,0x08000800,0x08200000,0x00000820,0x00000000,0x186118a2,0x00001081,0x00001061,0xef5c0000,0x94918c71,
-0x00000000,0x08200000,0x08600000,0x10403185,0x7b8e4a28,0x18611000,0xdeba8bef,0x00002124,0x08009450,0xffffa4d2,0xbd969c71,0x20e3bdb6,0x9c701000,0x2903ce37,0x9cf3ffff,0x08204207,0x00000861,0x08200000,0x184020a2,0x00007b6d,0x18611020,0x39440000,0x838d72eb,0x49c6b513,0x10200800,0x08001881,0x000018a2,0x18c20000,0x18805268,0x28803143,0xce591860,0xde987b6c,
-0x28c13101,0xeef95204,0x9450eeda,0xff9dff7d,0xee976287,0xde78fffd,0xff9dfffe,0xffdeff7b,0xf79cf77c,0xff7cff5c,0xff5cff7c,0xf73dff7d,0xff3cff7d,0xe658eefb,0xe658de38,0xee99ee58,0xcd74ee98,0xddf6ddd5,0xd595d5b5,0xddd5d595,0xe657d5d5,0xd636acf1,0x5a4728c1,0x9470ef1b,0x206030e2,0x41a34184,0x18803980,0xbdd59450,0x18a10000,0x00004a47,0x08000000,0x29020820,
-0x31659cb2,0x20c22924,0x002020e2,0x18401880,0x41623962,0x416328c0,0x31415246,0x39643920,0x186028e1,0x080028c0,0xde780800,0x31235227,0x29233142,0x39a70000,0xbd76acf4,0xc5b7c5b7,0xd63ad63a,0xde9be69b,0xd67bde9b,0xde9bd67b,0xd65bce1a,0xc5d8cdf9,0x9cd4b597,0x94939cd5,0x39a8630d,0x42090843,0x524a2925,0x4a4a4a2a,0x528b52ab,0x39e84229,0x39c73166,0x41e74207,
-0x00000000,0xffff5269,0x0020f77d,0x00000841,0x08000000,0x9c910800,0x00002924,0x10a10020,0x630b0000,0xe6fb0000,0x52890841,0x00000000,0x00200000,0x00000000,0xe6ba1061,0x10611040,0x10610000,0x00000000,0x08000000,0x00001861,0x10408c0f,0x6b2b0800,0x08000800,0x00001061,0x00000000,0x106062aa,0x0000ffff,0x41a50000,0x000020c2,0x294320a1,0x734c0000,0x00000000,
-0xb5740820,0xffff20e4,0x08200000,0x00000000,0xffffb575,0xe69920a2,0x20810800,0x28c22081,0x7b2b3965,0x100049e7,0x4a270000,0x31660800,0x5a89ffff,0x20c283ce,0x18810800,0x00001061,0x20a00840,0x732a1040,0x00001860,0x7b6d836e,0x9c4f0000,0xc5b65206,0xb5555248,0x2040ac8f,0x20202000,0x31441881,0x000062ca,0x000018a2,0x08000000,0x08006aca,0x18002040,0x62c83922,
-0x62a949c5,0xffbda514,0x62465183,0x4a054983,0xee585267,0xff3a72ca,0xff5bff5b,0xff7cff7c,0xff9cff7c,0xff7bffdd,0xe637ee78,0xb4d1ddf6,0xdd95f6d9,0xde16e637,0xf678ee98,0xee78ee78,0xf6b8ee77,0xe636e657,0xe637e657,0xcdf5e657,0x41238bcf,0xa4d17b2b,0x6b0b3164,0x31442903,0x39403101,0x41e439a1,0x28e2de9a,0x00001861,0x20e11081,0x20e11881,0x18811020,0x10211040,
-0x082020c2,0x18a10800,0x10601060,0xf73cffbd,0x00001881,0x08000800,0x28c01820,0x20803962,0x00001040,0x08001082,0xff7cef3b,0x72eb6aa9,0xa51483cd,0xb576c618,0xc5d8bdb7,0xcdf9ce19,0xd65bc5f9,0xce1bce3a,0xc5b8bd99,0xce1acdf9,0xb537c5b9,0xb556a4f5,0x5accc5f8,0x5acc52ab,0x5aaa4a49,0x5269526a,0x4a084a07,0x39a65249,0x5a6a4a28,0x4a284a28,0x41e839c7,0x314520c3,
-0x00000000,0x00000000,0x00000000,0x10610000,0xffff4228,0x9cb2ffff,0x08200000,0x21030000,0x08200000,0x00000820,0x00000000,0x00000000,0x10405aaa,0x31452923,0x00003144,0x08400000,0x08200820,0x9cb10800,0x08004a27,0x000039a6,0x00000800,0x2903c5f6,0x08201020,0x00001061,0x29430820,0x49e762aa,0x21041020,0x39a50000,0x942f1040,0x106049e6,0x00000800,0x00000000,
-0x188118c2,0x00001041,0x52890000,0xffff0840,0xffff0800,0x5248ffff,0xd6588bef,0x10001020,0x0000ef1c,0x08206b0b,0x000039a5,0x31450000,0x9c910820,0x18601040,0x08001000,0x08005a48,0x732b28e2,0x31221020,0x41a50000,0x39443924,0x7b2b0000,0xffff1000,0x00001000,0xacb03101,0xfffffffd,0xe6ba62aa,0x1040ff9d,0x31640800,0x18201080,0x08002081,0x49a44984,0x49e53922,
-0xa47049e6,0x3943ff5d,0x52066a88,0x622730e2,0x08000800,0xff9de699,0xf71ade57,0xfedaf6da,0x1040e679,0x834cde98,0xf6d9f6d9,0x2880b4d1,0xe617c553,0xe698ddf6,0xf6b9e657,0xe616fefa,0xddf6ddd5,0xee77e636,0xe637ddf5,0xcdb5d5d5,0x080030c2,0xffffff9d,0xeedad617,0x000020a1,0xd678ce38,0x0800ad11,0x29020800,0x00000820,0x18c11040,0x00000000,0x10400800,0x20c01860,
-0x082020a1,0x08402921,0x39830820,0x20811040,0x31231820,0x10003964,0x30e028a0,0x31013942,0x316320e0,0xa4f37bee,0x7bada4d2,0x00008bae,0x00004a07,0xa5149c93,0xad15a4f4,0xad15ad15,0xbdd8ad36,0xb536b577,0xb556bd78,0xb536bdb7,0xb5368c12,0x62cc41c8,0x5aab5a8b,0x42294228,0x4a2839c7,0x5a8a4a28,0x4a285249,0x52694a08,0x4a2962ec,0x4a085249,0x39a739c7,0x20e420c3,
-0x00000000,0x00000000,0x00000820,0x00000000,0x00200000,0x52480000,0x00004a27,0x00000820,0x00000000,0x00000000,0x00000000,0x6b4b0000,0x00200020,0x00000000,0x18610000,0x31651040,0x18a2deba,0x208120c2,0x00000841,0x00000860,0x08002964,0x10200800,0x08001861,0x00000000,0x10600000,0xff9d3144,0x31650000,0x62ca0000,0x31630820,0x28c018a0,0x30e20800,0x00000800,
-0x41c6bdb5,0xa4f22924,0x840fad55,0x08000000,0x394520e3,0xbd960000,0xbdb61061,0x1041d69a,0x310320a2,0x2021bcd3,0xffff5268,0x5a89e6db,0x0800732b,0x10001020,0x20601020,0x20606a88,0x836c7b4c,0xbd1230c0,0xd638ffdf,0x20a17b4b,0x942f732b,0x51e6cdf6,0x498428a1,0x20a262a8,0x7b2b3903,0x0000a4b2,0x6acaa490,0x39c53102,0x52071040,0xd5b4cdd6,0x18600800,0x730b72ea,
-0xeedac594,0xc595836c,0xe699f71b,0x6aebc5b5,0x8bceffff,0xffde1020,0x08003103,0x9cb01060,0xffff5a48,0xb533f77c,0xf6d9ee9a,0xf6b9ff3b,0xf6b9f6d9,0xffbef71a,0xff3cffbe,0xf698f698,0xf698fef9,0xee98f6b8,0xfefaee98,0x18001800,0x38a00800,0x30c051a4,0xffbe1000,0xcdf61020,0x18200800,0x10400800,0x106041c5,0x00001020,0x08000000,0x18a10000,0x08001881,0x20c10800,
-0x20c03983,0x29412941,0x18412941,0x20401841,0x30e02880,0x206049a3,0x18601820,0x184028c1,0x29041881,0x00000841,0x21040800,0x8c50732d,0x8c518bee,0x082162ec,0xb576d67a,0xa4f4b577,0x62ed5a8c,0xa4d4ce1a,0xb5d7d63a,0x7b8e6b4e,0x4a085249,0x4a285269,0x42275248,0x42484207,0x4a684a27,0x4a284a47,0x5a895a8a,0x52494a28,0x5a8a526a,0x4a08526a,0x420839a7,0x000020c3,
-0x00000000,0x00000000,0x00000000,0x10810000,0x00001081,0x00200000,0x00000000,0x00200820,0x21240020,0x00005aeb,0xbdd720e3,0x00008c30,0x00000000,0xad331060,0x00001040,0x00001041,0x31247b8e,0x10400800,0x000018c1,0x18a10820,0x292420e3,0x08000800,0x39a60000,0x08000000,0x08000800,0xffff28c3,0x00000000,0x4a481881,0x10200800,0x28e10800,0x62ca3103,0x18a2b575,
-0x5a481000,0x0800ce17,0x00000800,0x10610800,0x000041e7,0x39a50000,0x00003143,0x18811040,0x08001000,0x104028e3,0x188030c2,0xbd750000,0xbd957bae,0x7b2bf75c,0x52670000,0xffff62a9,0xf6fbd618,0xd5f7ff7d,0xd5f7bd54,0x31037b4c,0x93ee0800,0x00003942,0x206030e2,0x8bee2903,0x62a95207,0x20614185,0xa4d10800,0x310341a5,0xff7c4185,0xee79cdd6,0xf71bffbd,0xffbeffff,
-0x39233923,0x59e493ed,0x5a47a3ca,0x4101730a,0x72ea30e1,0x7b8d28c1,0xe6d99c70,0x83ab6a88,0x7b8c1880,0xd5f649a5,0x1800f6fa,0xe678ff1b,0xde58f71a,0xe6584985,0xf6daf6da,0xff7cffbd,0xff3affbc,0xee99ee98,0xe678e639,0xd5d5c554,0x7ac9cd94,0x6a47ff1a,0x51e6eeb9,0xcdb51820,0x28a11800,0x31231840,0x08001020,0x00000000,0x00000000,0x00000000,0x00000800,0x08200000,
-0x29210820,0x29203182,0x31623982,0x18603983,0x20801020,0x28a03962,0x080020a0,0x18600800,0x290220c1,0x31640800,0x00000000,0x10205a8a,0xef1cad14,0x522a526a,0xb576ad35,0xc5b7b4f4,0x8c315a8b,0x5aac0000,0x526a4a2a,0x4a283987,0x41e74a29,0x41e73165,0x4a284207,0x4a494a28,0x4a2841e7,0x4a285269,0x52485269,0x5aaa3985,0x4a0841e7,0x4a0841e8,0x314541c7,0x31450800,
-0x00001061,0x08410000,0x00000000,0x3166736e,0x00000000,0x00400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001061,0x31850000,0x10200000,0xa4f31020,0x10409471,0x10205227,0xffdff77d,0x41c61860,0x41e67b8d,0x00000800,0x00001061,0x08000000,0x08000000,0x730bf71b,0x08002081,0x00000800,0x0000630b,0x6b0b0000,0xce17ffbd,0x396320e1,0x28c36268,0x20a20800,
-0xacf29450,0x18611020,0x08008c0f,0x10410800,0x00000800,0x08000000,0x00201060,0x8c0f3165,0x18604a27,0xad32de79,0x314428c1,0x83ee18e2,0x730b1081,0x00000800,0x0000c617,0x62687b4c,0x93ef72eb,0x41855a28,0x732bf73b,0x184028a2,0x20601000,0x18406ac9,0x18202040,0x08000800,0x18203123,0x20812081,0x20c27b8d,0x10000820,0xbd750800,0x6287ffff,0x41022040,0x82c740e0,
-0xe6986247,0xeeb76a69,0xe4ecf717,0xf6b6fe72,0x628720a0,0x186049a3,0x0800e6da,0xf7386aa7,0x10401020,0xc5741000,0xe6991820,0x18600000,0xff3bde98,0xa450f73b,0xeeb9e658,0xd575e678,0xe698ff3a,0xe617ee77,0xee99e638,0xd5b5c554,0xd5b5ddf5,0xe6162840,0xe637ffbd,0xff1bfefa,0xff5cff9d,0x20c03984,0x5a473101,0x104049e6,0x312149e5,0x08001000,0x106018a1,0x10600820,
-0x31613162,0x41c341e3,0x18a039c3,0x10200000,0x10001860,0x208028e1,0x18412081,0x104020a1,0x18801060,0x00001020,0x18c10000,0x7b8e6b0b,0x6b0cad14,0x734e1042,0x7baf0000,0x5a8a6acc,0x526a526a,0x4a49528a,0x39a7524a,0x41c739a6,0x41e83166,0x524941e7,0x31854207,0x4a4841e7,0x4a284a49,0x52495aaa,0x4a085269,0x4a085249,0x4a284a28,0x4a0841e8,0x4a085249,0x5a8a3965,
-0x00000000,0x00000820,0x00000000,0x00000000,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x52890000,0x8c30deda,0x00000000,0x08200000,0x08000800,0x39440800,0x49c62081,0x18401860,0x29640000,0x00000000,0x10600000,0x29443184,0x18811882,0x62886b0b,0x10002080,0x29031820,0x18800000,0x00001040,0xc5d60000,0x100020c2,0x3943bd54,0xc5f71860,0xc5d73985,
-0x8c4f9470,0xc5f69471,0x4a480800,0xd6790000,0x4a073165,0x18a118a1,0x00002923,0x188118a1,0x00001020,0x8bed0000,0x0840a4f2,0x00000000,0x10001060,0x08003965,0x39851881,0x62ca0000,0xffff3123,0xde99f75d,0x0000bd53,0xb4f2d678,0xff5b0000,0x180083ac,0x100030a0,0x4a682080,0x30e20800,0x08403985,0x9c500800,0x8bce1860,0x83cd20e2,0x0800e6b8,0xff9c28c2,0xfffffffe,
-0x72e972e9,0x8b6c28c2,0x9c2eddf6,0xa48effff,0xd6564182,0x30e0de97,0x52676ae8,0x7b4bc5f5,0x732bd679,0x736cf77c,0x9491fffe,0xf6fbffff,0x28a0732b,0xe637ff7c,0xe658e638,0xff9cff5c,0xf6daff7d,0xe699f6fb,0xee99de58,0xd5b6cdb6,0xf6fbe679,0xd5b6de38,0xe657d5b5,0xde17d5f7,0xde17d5f6,0x08008b4b,0x1840830b,0xff7cfefa,0x20401000,0x290120a0,0x18402080,0x31411020,
-0x28e03961,0x28c02900,0x208041a1,0x00001000,0x39840000,0x31230820,0x31432902,0x080020e2,0x10000800,0x10402080,0x39841040,0x83ae1881,0x5a8b1000,0xc5f8a4d4,0xe6dcce19,0x20e3ff9e,0x398741a7,0x39863987,0x41a541a5,0x41c74a07,0x49e73986,0x4a295269,0x4a0741e7,0x42074a49,0x4a285249,0x5a8a4a28,0x5aaa5a89,0x5a895269,0x52485a69,0x52485248,0x5a683985,0x62a92902,
-0x00000000,0x00000000,0x29440000,0xe71b736d,0x0000ad54,0x00000000,0x00000000,0x00000000,0x00000000,0x18c21082,0x08402924,0x10610820,0x00001081,0x08610800,0x08000000,0x734c1861,0x08000000,0x00000000,0x21030000,0x08200841,0x08000000,0x08000000,0xf75c5aaa,0x41c6ffff,0xa4f30000,0x20a0acf2,0x10201020,0x10400000,0x290220a2,0x290362aa,0x18a23123,0xc5f7f75d,
-0x18a1e71b,0x31650000,0x082020e3,0x000039a6,0x10608c0f,0x08000000,0x00003985,0x21033985,0x10201881,0x00000000,0x62ea1060,0x10600000,0x00001060,0x10400000,0x106120e3,0x10600000,0x08000000,0x10401000,0x18600000,0x730b834a,0x0841ff9c,0x8b6a2040,0xffbbbd10,0x1000c553,0x31230800,0x08000000,0xacd25227,0xfffe1861,0x18801881,0x20e318a0,0x212494b2,0x94505a89,
-0xd6797bef,0xffffef1b,0x61e34163,0xad1238c0,0x6ac9f75b,0x7b6c732a,0x31026aea,0x310328e1,0x5a475227,0xde573964,0xacf2c5b5,0x38e2732b,0xfffd28a0,0xde17f75b,0xee99f6da,0xe6d9ff9d,0xee99fefb,0xe658f6fb,0xcdd6de38,0xf6dbeeba,0xf6daff1c,0xf6dbff3c,0xf6fbf6fb,0xff1bff1b,0xee9af6db,0xcd74e658,0xff9dde17,0xde18e638,0xf6dad638,0xf699ee79,0x000072a9,0x00000820,
-0x29023163,0x18a020c1,0x186020c2,0xad131881,0x5a8962a9,0x5a8941c6,0x10401860,0x28e11000,0x31032080,0x08200800,0x00000000,0x00000000,0xad56ffbf,0xc5f8ce19,0xbdd8ad35,0x8c51bdb7,0x31655a89,0x41c63145,0x52475226,0x52475a68,0x52474a26,0x49e749e7,0x52494a08,0x52894a28,0x52895a89,0x6b2b4a27,0x62ea5aa9,0x62aa62ea,0x5a895a89,0x5a695a89,0x20c25268,0x5a8962a9,
-0x00000000,0x084110a2,0x00200000,0x10400800,0x00000000,0x00000020,0x00000000,0x00000000,0x1081ce38,0x83ee1040,0xdf1b9c90,0x10610000,0x18c20840,0x20a20000,0x10009430,0x08201882,0x00000840,0x08200020,0x10a00020,0x0820a4d2,0x00000000,0x08000000,0x29040000,0x104118a2,0xf79d39a5,0x18c2ad54,0x000018e2,0x00001040,0x08200000,0x00001061,0x00200000,0x10820000,
-0x08200800,0x20e20820,0x00003184,0x082020e4,0x08405269,0xad133184,0x20e20820,0x106139a6,0x39c60820,0x00000000,0x08200820,0x08201060,0x00000800,0x83ce2902,0x106028e2,0x10001020,0x18404165,0x31222080,0x08000000,0xffff3985,0x5a288bee,0x10006aca,0xd6372081,0x836b4984,0x734bf77b,0x18002840,0x08206a49,0x5a07ffde,0x20c094b0,0x39633142,0x39832080,0x41e539c3,
-0x4a264a27,0x49a45a67,0xf699ffbc,0x30c02840,0x41a428c1,0xf77c9c6f,0x5a05730c,0xffdd4164,0x310228a0,0xf71a9bee,0x10401840,0xffffe6fa,0x28605a48,0xe6da30e1,0xa4f2e6da,0x9450d638,0xe6fbd679,0xe6daef3b,0xb4f3d637,0xcd960800,0xd5f7d5f7,0xb4d351e7,0xde58eeda,0xe67aeeba,0xff3dee9a,0xeebbf6bb,0xe679de39,0xde58de38,0xd638d5f7,0xf71cff5d,0xd679d679,0xef3be6fa,
-0xce17fffe,0xb594ffdd,0x08600840,0x206020e2,0x08001820,0x08003964,0x20811000,0x18202060,0x08000800,0xf71c734d,0xc618acf4,0x4209ce59,0xbdd8c619,0xad76ad56,0x08410000,0x00000020,0x00000000,0x52680820,0x6aaa5266,0x5a6662a8,0x5a466ae9,0x52275206,0x52684207,0x526862ca,0x4a065288,0x52885aa8,0x4a475aa9,0x52485268,0x6b0b62ca,0x52685269,0x290362ca,0x5a895a89,
-0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00001020,0x00000000,0x52890020,0x08202124,0x10600000,0x10600000,0x00000820,0x08006b4c,0x082018a2,0x08000000,0x00000800,0x20e30840,0x18e30000,0x08200860,0x18810820,0x08000820,0x00000000,0x08000000,0x08000800,0x00000800,0x000010a1,0x00000820,0x39a50000,0x00001060,0x08200820,0x00001061,0x00000820,
-0x00000000,0x08402103,0x00000820,0x00000000,0x00000000,0x08000000,0x10401060,0x00001060,0x00001060,0x08200000,0x08200000,0x9c910000,0x08000820,0x49e60000,0x5ac90800,0x20813964,0x20a15227,0x08004184,0xef1b9470,0x08006b0b,0x41e62903,0x31030800,0x10201861,0x18207b0b,0x00000800,0x08005268,0x52271000,0x72c93944,0x4a050000,0x39432922,0xff5b3122,0x7b4b41c3,
-0x49a53103,0x39235a88,0xe6987b0a,0xff5ccdf6,0x6247b534,0x314351e5,0xeef9ffde,0xffbcde36,0x28a0fffe,0x20404124,0x20c1bd33,0x72c883ef,0x5a057ac8,0xffffc593,0xd657ef1a,0xad74ce78,0x9490b594,0xd658b574,0xcdb6d637,0xeebacdd7,0xf6fbeeba,0xee9aee9a,0xffdfff5d,0xf6dbff9e,0xde39de39,0xd618ff5d,0xd638cdb7,0xd617cdd7,0xc5d7d638,0xd659bdb6,0xad340800,0x08005a69,
-0x10600000,0x39e63985,0x10810840,0x00000000,0x29020800,0x08002923,0x10001861,0x08000800,0xc5d7a4d3,0x9c72bd96,0xce38de7a,0xbdb7ce59,0x4208c5f8,0x29450821,0x00000020,0x18e31082,0x20a20000,0x18604a07,0x520441c4,0x62a85a68,0x5a466ae9,0x52275a67,0x5a885aa8,0x52685247,0x5aa85247,0x52485ac9,0x62ca62ea,0x62ca6b2b,0x62aa62aa,0x62aa62ca,0x52483123,0x52485248,
-0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00001081,0x082010a2,0x00000000,0x00005248,0x6b8d4a06,0x00000000,0x10610000,0x00008c10,0x00200841,0x08200000,0x00000020,0x18a20000,0x00000000,0x08200000,0x08000820,0x08201020,0x08200820,0x10410820,0x00000000,0x21030000,0x00000000,0x18810000,0x0820f77d,0x10400000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x10600000,0x08200020,0x00000800,0x736c0000,0x08005269,0x08200000,0x10400840,0x18a10820,0x08201040,0x10601040,0x20e11040,0x000018a2,0x42073144,0x730b1040,0x628a6ac9,0xc5954185,0x1860fffe,0x20c21881,0x288120a1,0x18401820,0xbd74b513,0x20811861,0x18402060,0x30a10800,0xfefa6267,0x51e52901,0x734a3902,0x49e541e5,0xeef941a4,0x7b0b28c0,
-0x9cb09c90,0xb4d3a4b2,0x832c6228,0x8b4b4965,0x10000800,0x624638c1,0xc5f65a27,0xff5b5a26,0xeeb8eed9,0x31a5ce58,0x28e30000,0xa5130000,0x1020a4d1,0x00003143,0x39a428e1,0x28c21040,0x10403984,0x00007b6c,0xe69a83ce,0xeebacdd7,0xee9af6db,0xe679e659,0xe659e659,0xf6fcde39,0xeebbeebb,0xc5d6deba,0xce38bd75,0x18c20000,0x9cd2ffff,0xbdf7c618,0xad14a4d2,0x730c51e7,
-0x188120c2,0x084120e2,0x10610000,0x00000000,0x00200000,0x18c20820,0xa4b13944,0xbd976aec,0xbd97b535,0xc618bd56,0x00000000,0x08202945,0x42282103,0x00206b8d,0x00000000,0x00000000,0x18200800,0x52023102,0x10003941,0x628720c0,0x6ac862c8,0x49e55245,0x49c549c4,0x39a339c4,0x5aa85247,0x5a895288,0x5ac962ea,0x732c5a89,0x62aa62ca,0x6aeb62ca,0x62c949e6,0x41c65a68,
-0x00200000,0x00000000,0x00000020,0x00000000,0x00000000,0x526931c6,0x00005aca,0x00000000,0x00000000,0x08400000,0x00000000,0x18c20000,0x18812103,0x08000000,0x08000800,0x08200820,0x00000820,0x08000000,0x08002903,0x08200000,0x08005aca,0x08000800,0x08201881,0x00000800,0x08400000,0x10810000,0x00000820,0x08400800,0x08000000,0x08000000,0x20e418a2,0x00000000,
-0x00200000,0x00000000,0x00000000,0x20e30000,0x10403186,0x104018c2,0x00000000,0x08000000,0x08000000,0x00000820,0x00000800,0x00001040,0x10610000,0x00000800,0xb57420c2,0x10000000,0x00001020,0x31431000,0xb512c594,0x00005227,0x20a0a46f,0x18401000,0x18005a48,0x28a03902,0x6a882060,0x00001800,0xc5736ac9,0x3944a42d,0xbd535a27,0x8b8d72e9,0x8bada491,0xffdeacd2,
-0xa44f836c,0x5a48acd0,0x838d8bef,0x20a1940f,0x51c4eef9,0x51e66247,0x3944acf2,0x5a489c90,0x00001861,0x00000800,0x18810800,0x10000820,0x28c14185,0x000049e5,0x29200000,0x314228e1,0x31023102,0x30812820,0xddf7fefb,0xde39e659,0xd5d7e67a,0xde39bd55,0xe6bade59,0xf71cf71c,0xf73cde59,0x2102ffff,0x298318c2,0x10401060,0x084018a0,0x000018a1,0x10800000,0xce181041,
-0x4a072103,0x00001881,0x00000000,0x10401040,0x00000000,0x8c510000,0xdebace18,0xf77ec5d8,0x630cffbf,0x6b0b4208,0x39a639a5,0x29454a27,0x08400000,0x18c241e7,0x00200000,0x106020a2,0x31223122,0x392249c4,0x5a033920,0x49a449a3,0x626749a4,0x62a762a7,0x52255a46,0x526741e4,0x5a885aa9,0x4a475aa9,0x528862c9,0x62ea62ea,0x6b0b5268,0x6aea62ca,0x5a885aa9,0x41c55a68,
-0x00000000,0x00000000,0x00200000,0x10210800,0x08000800,0x08401882,0x00000000,0x08200000,0x00008c50,0x00000840,0x00001061,0x10610820,0x08200000,0x00000000,0x00000000,0x00000800,0x08000820,0x00001041,0x00000000,0x00000000,0x00000840,0x08000800,0x00000000,0x10810000,0x18601020,0x18a10000,0x08200820,0x18a21061,0x08000000,0x10400000,0x10403124,0x08000800,
-0x08000000,0x08000000,0x20c20800,0x20c11020,0x20c21880,0x20c21081,0x00000000,0x08200000,0x00002924,0x10400000,0x18a218a1,0x00000000,0x08000000,0x00000800,0x30c220a2,0xc5d52060,0x3944732b,0x18601000,0x00003122,0x08001880,0x288030a0,0x8bee72e8,0x20a1eeda,0x51e51000,0x30c26ac8,0xff5c9c30,0x832ac533,0xa47040c0,0xa4708bcf,0x836ccdb4,0x49a5b513,0xff7c6267,
-0xff9d9430,0x51e651c5,0xffffff5c,0xacd16248,0x51c42860,0x49c53943,0x08001000,0x2081b533,0x28a23963,0x28e20800,0x2903d658,0x10008bee,0x49c43103,0x18400000,0x18601000,0x08000000,0xcd756aaa,0xe699ce17,0xee9af6fb,0xf6dbf6bb,0xf6fcff3d,0xf6dbf6fc,0xc596eebb,0xbd559c51,0x1820a492,0x20c020c0,0x39a320c0,0x28c028e0,0x18a020c0,0x08600020,0x21222122,0x292318a1,
-0x082041c6,0x00000000,0x00000000,0x7b8da4b2,0x00000800,0x94710000,0x7bcfb575,0x10200000,0x000018e2,0x29422963,0x00000000,0x00000000,0x08000000,0x08001020,0x104020e2,0x72e83901,0x49a22040,0x100049a2,0x51c230e0,0x416328c0,0x208020a0,0x62a85246,0x52055a67,0x41e54a05,0x5a8862ea,0x62c962c9,0x52885267,0x62ca630a,0x734c62ea,0x62ca5a89,0x5a8862c9,0x4a065227,
-0x00000000,0x00000000,0x00000840,0x104020e3,0x08000000,0x082020c2,0x10600820,0x00000000,0x524828e3,0x08408c2f,0x08403184,0x08400860,0x52692943,0x00000000,0x08000000,0x08000820,0x00000000,0x00000000,0x00000000,0x00000820,0x08410000,0x18601000,0x08001040,0x08000000,0x00000820,0x00001860,0x20820000,0x08201061,0x08000820,0x10201000,0x206120a1,0x00003945,
-0x29031881,0x10003103,0x18601040,0x312420a1,0x08000800,0x08000000,0x10200000,0x002018c1,0x08400000,0x08000000,0x20e27b8d,0x18601080,0x734c5248,0x0800c5d6,0x000028c2,0x52283983,0x08001881,0x31221040,0x08404206,0x49c539a5,0xbd53c573,0x52071800,0xeefac5b5,0x6ac9d637,0xc57449a5,0xcdd6ff7d,0xfffeffbd,0x100059a5,0xac8fcd74,0xbd738bcc,0x4164940e,0x38e230e1,
-0xffff93ef,0x72ea6289,0x204028c1,0xb5536aa9,0x52076289,0x83acf73b,0xb532c594,0x00006b0b,0x1060d677,0x000041c6,0x18a220c2,0xc5956b0b,0x2081ffff,0x20a16aca,0x5aa93163,0xff3cffff,0xf6fbee99,0xffbfeefc,0xff9effbf,0xfefdff3d,0xf71cff1d,0xde59eebb,0xf73dff9e,0xc5f7d639,0xbd75bd76,0x18a04a05,0x20801060,0x28c028e0,0x29203101,0x104018c0,0x18a10020,0x10201061,
-0x08001060,0x00000000,0x00000000,0x080041e6,0x4a49ce18,0x000018c3,0x00000000,0x000020a0,0x08200800,0x20e21040,0x00003143,0x00000800,0x41a42903,0x10400000,0x7b296288,0x5a466266,0x62665204,0x5a055a04,0x100028a0,0x18801020,0x104020c0,0x10200800,0x62a862a8,0x4a265266,0x5a686288,0x52266288,0x52885227,0x5aa95a88,0x62ea62c9,0x5a8862c9,0x62a962c9,0x52275227,
-0x398420e2,0x10a12924,0x18810820,0x9cb2ce58,0x08202903,0x20c20800,0x62eb0000,0x00200000,0x08410000,0x082039c6,0x00000000,0x18a20000,0x00000840,0xffffb595,0x0000bdb6,0x39641020,0x102020a2,0x00000820,0x00000000,0x00000000,0x08610000,0x10201000,0x08201041,0x00000820,0x00000820,0xbdb51880,0xeeda0000,0xff9e7bae,0x08000000,0xbd951840,0x3923eeda,0x000020a2,
-0x10400000,0x20a21840,0x10401881,0x28c20820,0x41c60800,0x18607b6d,0x28811020,0x00001840,0x08003123,0x10408bee,0x00002923,0x104039a5,0x10406b0b,0x08003985,0x41e58bcf,0xad32d638,0x08001020,0xffdd1880,0x6ae90000,0x526941c5,0x0000deba,0x0800f75b,0x838d49e6,0x5227eed9,0x49e53142,0x41a449c5,0x838d1861,0x72ebc594,0xff9af73a,0x7288e656,0xbd93bd53,0x39029c6f,
-0x51e74164,0xbd746aea,0xd637ffff,0xa4d11000,0x41855a47,0x41a441a5,0x6288cdf5,0x1040e6da,0x734b49e6,0x00001040,0x20a13985,0x18400000,0x08003123,0xd6586b2b,0xff7def1b,0xeedbef1c,0xeefcff3d,0xffdff79e,0xffffffff,0xffdfffff,0xffdfffdf,0xeefdf73e,0xcdb7de39,0xacf38bf0,0x49c76aea,0xacf20800,0xde78fffe,0xbd74942f,0x20c1bd93,0x08000800,0x00000000,0x18600000,
-0x00001081,0x00000000,0x526983ef,0x00000820,0x00000800,0x00000000,0x31020000,0x186028e0,0x524418a0,0x080020e0,0x41830800,0x732b5a26,0x396349c5,0x10001000,0x30c00800,0x49c33941,0x182028c0,0x000030c1,0x73691020,0x18003140,0x49c351e5,0x39212060,0x6aa828a0,0x31215a45,0x5a865a87,0x39a45225,0x41e55227,0x5aa84a47,0x736b5ac8,0x5a885a88,0x4a065267,0x5a885a88,
-0x08000800,0x08000800,0x10604a27,0x08000000,0xc5f70820,0x10605aaa,0x41e60840,0x082018c2,0x08400000,0x00200000,0x00000000,0x00000000,0x00000000,0xc5f70000,0x18a139c6,0x08001881,0x28c33985,0x000028c2,0x00002904,0x00200000,0x00000020,0x00000820,0x08001040,0x08000800,0x10410000,0x106020e1,0x00003944,0xffff20a2,0x00000820,0x20610800,0x38c21860,0x6aa9d5d5,
-0x30a1cdd6,0xf79eff9c,0xe6b9ef5b,0x418528a1,0x08002081,0x08000000,0x8bee5a08,0x41641820,0x4a27bd94,0x62891881,0x398630c1,0xce17730b,0x1820ffff,0x08201020,0x102018a1,0x00000800,0x31235a89,0x08200000,0x732b0800,0x28c13985,0x10001820,0x41840000,0x2080d637,0x08002080,0x1840cdd6,0x000093ed,0x28805a05,0x41832880,0x31015a67,0x49c63122,0x31211860,0x0800d658,
-0x000028e2,0x5a26f6f9,0x5aa928a0,0x522783cd,0x942f5206,0x20e23143,0x62a90800,0xbd533923,0x83ee5a48,0x49e61040,0x2080cdb5,0xb5551000,0x28c10000,0x62e91860,0xbd75d678,0xff7dd638,0xf79efffe,0xf73eef1d,0xef3effff,0xf75ef75e,0xf77fef3e,0xffbfff7f,0xde7bf71d,0x41438bef,0x20401800,0xacd220a2,0xd6b9cdf5,0x5a672100,0x000028e1,0x00000000,0x29020800,0x00001081,
-0x0000acf4,0x20c21061,0x5a6762e8,0x290130e3,0x00001040,0x18610000,0x28a130e2,0x4a053102,0x5a8639a3,0x39424a04,0x30a01000,0x414130a0,0x39603921,0x18013921,0x39403101,0x51e56ac7,0x41c51020,0x10001000,0x416228e0,0x5a445a45,0x6ac86287,0x62666ac8,0x51a251c2,0x49c26265,0x41a249c3,0x49c449a4,0x39a449e6,0x52463983,0x52465aa8,0x5a885a88,0x62a86b2a,0x5aa85246,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4a490820,0x00004208,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18c20000,0xffbe9c91,0x08003985,0x28e30800,0x29431040,0xce170800,0x086041e6,0x10400000,0x08000800,0x10401020,0x08001040,0x10410800,0x00000000,0xce5820c2,0x18a2ffff,0x31030800,0x94105227,0x736dffbe,
-0x08000000,0xad5428a2,0x9c710000,0x28c228c3,0xe678ffff,0xa4b2ffff,0x69e5ef1b,0x10004922,0x41850000,0x4185ef1b,0xbdb630c1,0x18610000,0x18601060,0x186028e1,0x62891000,0x00003944,0x10202903,0x18601860,0x10400800,0x5a891040,0x28e20800,0x10001840,0x20800800,0x41850800,0x838d41a5,0x5a684184,0xc5742081,0x1840cdd6,0x41843964,0x416449e6,0x3121acd1,0x290249e5,
-0xef1a732b,0x10009c8f,0x734b8c0e,0x6b0b6aea,0x316483ad,0x524762c9,0x10403964,0x838d940f,0x00000800,0x08200000,0x41c55a48,0x080020c1,0x28c2acd2,0x5a688bee,0x3143a4b1,0x29027bad,0x29240820,0xffdf2925,0xff7fffdf,0xf77ff73e,0xce19ffff,0xdebccdf9,0xe6bce6bc,0x6b2bde39,0x31221820,0x9c6e3983,0x18401860,0x62883962,0x39c56b09,0x10600820,0x00000000,0x00000000,
-0x08001840,0x18a01000,0x20a00000,0x390028c0,0x182049a4,0x414228a1,0x10410800,0x28c128c2,0x49e33961,0x5a055a65,0x51e05a02,0x10204140,0x5a470000,0x6ae762a7,0x51e330e0,0x52033100,0x396028c0,0x20811840,0x208049c4,0x52035a24,0x6ac85225,0x72a86ac8,0x5a046ac7,0x628651c3,0x49e349c2,0x41a249c4,0x4a263963,0x5a885246,0x5aa85a67,0x4a265267,0x62e95a67,0x4a055a88,
-0x08201040,0x08000820,0x00000000,0x00000000,0x10821061,0x08210000,0x08410820,0x00000000,0x00000000,0x08400000,0x00000000,0x18e30000,0x21044a69,0x00000000,0x10610840,0x10810800,0x00000840,0x0000e6fa,0x00000800,0x08001880,0x39c60000,0x5a892964,0x29239c91,0x10401020,0x62a92902,0x10605aa8,0x00000000,0x00000820,0x00006bad,0x10001040,0x41032902,0xa49028a1,
-0x20c2f75c,0x9c700000,0xffbf83cf,0x1840de39,0x1000838d,0x00000800,0xff1effff,0x9d35e6dc,0x2040ff1b,0x3103c5d6,0x106130c1,0x39650000,0x310320c2,0x39243963,0xb5136a89,0xe679e699,0x41c61020,0x5a0751c6,0x10401881,0x28a36aea,0x31223923,0x39441860,0x28e24185,0x08000800,0xffdd2080,0x316483ce,0xde79ff5d,0xffff8bf0,0x52075228,0x49e63944,0x41c449c5,0x292262c8,
-0xacf25268,0xffdc2922,0x104062c8,0x736d5a88,0x39644207,0x18603123,0x290249e6,0x10004165,0x10406269,0x18a20000,0x18801041,0x52065aa9,0x08003923,0x00005227,0x31631040,0xad121060,0xa4d2946f,0x9c929c92,0x20e50000,0xf75e9452,0xffffffdf,0xef3eff9f,0xef1de6bc,0xbd559cd2,0xeef9e6b9,0x52453962,0xc61520c0,0x0800632b,0x20c03122,0x3163fffd,0x31623160,0x49e31820,
-0x28a01860,0x20e02080,0x184041c2,0x20a00800,0x08000000,0x10000800,0x28c03943,0x6ae662a6,0x5a246264,0x6a866265,0x62246224,0xa44c30c0,0x52442020,0x5a46acef,0x6ac75a24,0x6aa86266,0x626659e6,0x72e96a69,0x49c26ac8,0x5a456285,0x62a75225,0x62266aa8,0x6aa77b29,0x62876246,0x52045a44,0x39616267,0x52674183,0x52465a87,0x62a85a87,0x4a0649e5,0x62c862a8,0x5aa85267,
-0x18a120c2,0x00000800,0x08000000,0x00000000,0x00001041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x20c10000,0x082020c1,0x00000000,0x00200000,0x10401060,0x188020c2,0x00001020,0x08200000,0x184018a1,0x28e03943,0x18603122,0x10400800,0x10800000,0x08401061,0x00000000,0x08000000,0x9c501020,0xde785a48,0x942fffde,
-0x838c6aea,0x7b6d2081,0xd6796289,0x8b8cc575,0x5267ffbc,0x1861ce37,0x28a21881,0x834d4145,0xb534ff9d,0x9c30de99,0x7bed2081,0xbd95ffff,0x102020a1,0xd5d6acd2,0x08006a89,0xce580800,0xcdd69c71,0xe6dade99,0x0800acf1,0x8bcf1840,0xa4714124,0xff7c6268,0x20817b4c,0x18401020,0x31231020,0x208028c1,0x49e728c2,0xb4d3a491,0x49e6a472,0x08000800,0x41e65227,0x5a473963,
-0x5a8862c9,0x734b62c9,0x940f83cd,0x4a076aca,0x20c2bd74,0x83ee62ca,0xce37a4f2,0x62aa1000,0x188183ae,0x080018a2,0x000020e3,0xffdeb554,0xffffa491,0xd638734c,0x28e383ce,0x6269cdf7,0xf73c62aa,0x83cf524a,0x4a090000,0xdebcce39,0xe6fdf75f,0xe6fde6fd,0xe6dcef3d,0x732a3985,0x31635a87,0xef1a7b8c,0x73496aea,0x1040a4d0,0x6b4818a0,0x31603163,0x10602941,0x21001080,
-0x41c32940,0x4a053142,0x28c01040,0x39443121,0x6ac720c1,0x39204982,0x28a028c0,0x396051e3,0x41815a44,0x20603940,0x20604162,0x72c830c0,0x72c73922,0x49a34982,0x3921a46f,0x622672c8,0x6aa859e4,0x6aa86ac8,0x73086ac8,0x6aa749a3,0x206072e8,0x39016246,0x62669c2d,0x5a456286,0x73096ac8,0x52045a46,0x49e541a3,0x522541a4,0x62a85a67,0x4a055205,0x62e962c9,0x62885206,
-0x4a4741c5,0x94915269,0x000041c6,0x29032081,0x00000000,0x00000000,0x21040000,0x18a10000,0x18a120e2,0x000020e2,0x00000000,0x00200000,0x00000000,0x08200000,0x10610800,0x00000000,0x10600000,0x08200840,0x10400800,0x08200800,0x10410000,0x28c10820,0x28e128c1,0x18603141,0x000041c5,0x082020e2,0xc6170000,0xb57462ca,0x00005aa9,0x00000800,0x000020c2,0xd6783144,
-0x18413965,0x49c641a5,0x630b2061,0x62a9b513,0x0000630b,0x51e67b8d,0xff7d0000,0xeefbffff,0x7b8db534,0x39042061,0x0000626a,0xffff1820,0x5a89ef1b,0xde176289,0x18411800,0x736c0000,0x62aa1040,0x20c2f73c,0x94508c2f,0x62cb4a08,0xffbea491,0xde799430,0x8baeacb2,0x0800a4b2,0xc5d61020,0x10205a69,0x18003904,0xeeba836d,0x94508bcf,0x6b0a5a68,0x314362ea,0x8bed1000,
-0x6b0a62c9,0xacd29c4f,0x8bcfb533,0x8bee51e7,0x4a079c91,0x840e3985,0xffff83cd,0x39a64a27,0xce589491,0x83eead54,0x31234207,0x4a081040,0xc5d6a4b2,0x9c91de99,0x20a2ff9d,0x208251e7,0xce173124,0x102183f0,0xa4d59472,0xc5dab557,0xce1ace1a,0x0823a4d5,0xc61939c8,0x1880b575,0x52467b8c,0x41e341e3,0x41c22900,0x41c241a2,0x31603120,0x31602921,0x10601080,0x10401080,
-0x31631020,0x314120c0,0x28e11040,0x08001040,0x41613941,0x418249a2,0x49e44183,0x51e228a0,0x5a4451e2,0x49a13920,0x49823920,0x20403101,0x6a863901,0x62454982,0x30a06288,0x6a67e677,0x5a4672a9,0x08003100,0x72c872e9,0x72ea5a25,0x72e8836a,0x62656265,0x5a255a45,0x62666266,0x522462a6,0x39205a44,0x51e55a25,0x52055205,0x52055a26,0x49e55a87,0x52676b09,0x62a85a47,
-0x108120c3,0x08201040,0x5aaa0000,0x08201061,0x20e218a1,0x312420c2,0x3144b554,0x83ef1061,0x00000000,0x00000000,0x10610000,0x10613165,0x732c5269,0x6aaa838e,0x10412061,0x00000800,0x10600000,0x08200000,0x00000800,0x00000000,0x08000820,0x28e24a07,0x102020a1,0x31222080,0x08201040,0x49e63143,0x10400800,0x08005a89,0x28c23124,0x18601000,0xde582061,0x28c20000,
-0x20c21881,0xce17de79,0x0000d617,0x39446b2c,0x628962aa,0x20a15228,0x51e77b4c,0xf77db4f3,0x62a9a491,0xacb36acb,0x30e428a3,0x6acb1800,0xeebb51e7,0x18417b2d,0xb575ffbf,0x3165ef1b,0x18811881,0x31441040,0x7b8da4d1,0x41c67b8e,0xad123123,0x08003985,0x41c78bce,0x39230000,0x31034164,0xc5965227,0x6acb0000,0x1820cdd7,0x83efde99,0x49e7c5f6,0xa4d2ffff,0xd5f7ff9d,
-0xd617a4b1,0x9c50730b,0x93efa491,0xbd75de58,0x62a94a07,0x31846b0a,0x52883144,0x52682923,0x52683143,0x39a42902,0x5ac93964,0x31642943,0x290320e2,0x00001881,0x41c6ad13,0x0000b575,0x7b8df75c,0x39a720e3,0xc61a7350,0xef1eef5f,0x8433ce1b,0x9cf4422a,0x39c42943,0x52864a47,0x52265246,0x39815247,0x31416b08,0x41a220a0,0x20c028c0,0x29401880,0x10601060,0x31623182,
-0x316018a0,0x41a12901,0x49e33960,0x522541a3,0x51e34162,0x414151e3,0x5a0430a0,0x59e228e0,0x51e26243,0x39004981,0x30e03920,0x5a244160,0x180030c0,0x620451e1,0x6245bd11,0x4162ac6e,0x5a4572c9,0x41830800,0x73296aa8,0x5a2672e8,0x5a0528c0,0x6a877b29,0x6aa56286,0x7b285a44,0x7b497309,0x390172a6,0x7ae96a68,0x49626aa7,0x6aa83901,0x62a97b6c,0x52266ac8,0x5a476ac9,
-0xd65920c3,0x6b0ca4f3,0x5268736d,0x5a894a07,0x8c5062ea,0x188141e7,0x08201881,0x7b8d8c30,0x08001041,0x08002903,0x00001081,0x3985736d,0x734d7bae,0xc5757bae,0x4a286aeb,0x62eb18a2,0x08200000,0xde9ace17,0x7baee6db,0x39c66b2b,0x08002103,0x29030000,0x20801040,0x10200800,0x83eec5f6,0x52276b0a,0x49c67b8e,0x30e3a471,0x30e351e7,0x08001820,0x28c251e7,0x20a25a68,
-0x08200000,0x41c61040,0x28e31000,0x52284207,0x41851861,0x732c4185,0x1821de78,0xc5d6ffff,0x30c228a2,0x9c31c596,0x52089c71,0x52083945,0xf75dde79,0x9c5128e3,0x62ca2082,0xbdd62924,0x6aebffff,0x00005aa9,0x3143d638,0x83ee1040,0x00005a68,0x734b3985,0x4a263123,0x9430734c,0x62693944,0xcdb6c594,0x5a69ffbe,0x39453965,0xad130800,0x94500800,0x83ae3985,0xff1bc595,
-0x628993ef,0x41a5940f,0x6aca5a69,0x3144732b,0x4a075a89,0x08406b0b,0x082062ea,0x4a074185,0x41a53123,0x8bee1040,0x0000734b,0x10600840,0x10201040,0x734c8c0f,0x00001881,0x20c21020,0x20e241c6,0x18a20840,0xce1ad65b,0xff7fde9c,0xacf6bdd9,0x28e10800,0x292020c0,0x4a2539a3,0x52255225,0x49c46b07,0x6ae762a4,0x41a15a64,0x18a041e2,0x41c239c1,0x316020c0,0x526339a0,
-0x21001880,0x292041e0,0x41823140,0x31201840,0x30c03100,0x72c75a24,0x6a655a24,0x622372e8,0x72a75a03,0x834972a7,0x7b286a86,0x414051e1,0x394138e0,0x72c78bcb,0x7b094142,0x6ac95a05,0x31006288,0x7b6a4983,0x20802060,0x72e851a3,0x72c86ac8,0x72e86aa7,0x8bab5a24,0x9c4c8bca,0x28c05a67,0x41628349,0x83296225,0x59a27286,0x6a4659e4,0x30c10800,0x10003922,0xacd11840,
-0x42071061,0x41e718a2,0x41c72082,0x10600820,0x10600800,0x20c252a9,0x9cb2630b,0x6b0c41e7,0x20c383ef,0xad54840f,0x8c51c618,0x62eb83f0,0x736eb596,0x9c91ad34,0x6b2c9c91,0x83ceb554,0x31654207,0x734c2923,0xad149c92,0xad139cb1,0x9c91734c,0x20c27b6d,0x7b8d5248,0x104041a6,0x9c915a88,0x31443985,0x30e4ffff,0x39043924,0x3924ff5d,0x20c249e6,0x83cf732c,0xffffff9e,
-0xdeb9ff9d,0xce170800,0x08009c50,0x28e3e699,0x00004986,0x416528c2,0x5a693124,0xa4919c71,0xcdd76acb,0xd619836e,0x7bae840f,0x1061bdb6,0xff9e0820,0x28c3ef1c,0x5a8a5a48,0x20e10000,0x940f28c2,0x41c60000,0x00000000,0x39847bad,0x5a882922,0x31223164,0xb51249c5,0x29020000,0x3944ad33,0x1020bd74,0x39851881,0x28e28bef,0x186028c2,0xce181840,0x524941e7,0xa4d25a89,
-0x7b6c28e2,0x62ea9cb1,0x9c5062ea,0x7b6d4144,0x52486b2b,0x52493944,0x08201882,0x5ac920e2,0xacf20800,0x72e90800,0x732a3942,0x10401860,0x18820000,0xad148c10,0x20620000,0x945049c6,0x08006aea,0x10810000,0x94538411,0xe71fce1b,0x3062a515,0x28e03100,0x41e320e0,0x49c45225,0x6ac56285,0x184051c3,0x62c67b89,0xbd736b0a,0x6ae45aa4,0x49e03960,0x52423980,0x49e25a84,
-0x52235203,0x39603980,0x39613120,0x31003961,0x6a8541a1,0x62467b07,0x7ae87ae8,0x72c66a85,0xac6e82e7,0x49a30800,0x6a65a46e,0x62238327,0x39004961,0x30c04961,0x498330c1,0x30e0bd52,0x6aa67308,0x20606245,0x20606ac5,0x626530e0,0x6a8651e4,0x7b297b49,0x51e36ac6,0x6a646a45,0x18003920,0x7b085a24,0xb4d09c0d,0x72c38347,0x72c393a9,0x93ec8b89,0x838a51e4,0x51e2836a,
-0x734c3144,0x20c30840,0x52691041,0x0000ffde,0x42071040,0x31641081,0x082020c2,0x6b2c1060,0x18a20000,0x082039a6,0x41e74a48,0x8c512925,0x94928410,0xad34b575,0x6b0b3985,0x94719cb2,0x08205aca,0x62eb39a6,0x4a070000,0x31854207,0x18810840,0x4a076b0b,0x83ef4a07,0x52696aeb,0x732b20c2,0x6b0b5248,0xa4721041,0xde594186,0x8bcf49c7,0xd67af75d,0xad13ce39,0x9cb28c0f,
-0x20c24a07,0x94501861,0x6aeb6aca,0x1020940f,0x08001000,0x310483ad,0xcdd73945,0x83ae732c,0x1840acd2,0x8c307bce,0x00002904,0xffbe6b2c,0x3124bdb6,0xffff6b0b,0x186183ee,0xff9eff7d,0x736d7b8d,0x5a8920a1,0x31431000,0x18401020,0x528828c1,0xa4d2ce17,0xffff0000,0x3164ad13,0x52285aa9,0x3965730b,0xa4d29430,0xc5b5e6da,0x7bada4d2,0x6b2cbd75,0x9451e6fb,0xb5347b6d,
-0x62caef1b,0x5acb6b2c,0xbd769471,0x7b6d732d,0x08205228,0x08208c10,0x52493145,0x8c0f7b8d,0x4a28d658,0x208128e3,0x62ea3102,0x20e3b554,0x528a6b2b,0x841039a7,0x52296b4d,0x840f20c3,0x39a639a5,0xad3439c6,0x4a4a41c8,0xc61b0002,0xf75fdebd,0x41a45246,0x62e741e3,0x62865265,0x41a141a2,0x83ed2920,0xef5cffff,0x52452983,0x52605a64,0x62c16b02,0x4a026283,0x62c662c5,
-0x39603961,0x28e041a0,0x28e028c0,0x49e33121,0x9c0b6aa6,0x93a96244,0x8b897b28,0x7ae772a6,0x6a857b28,0x51a08b48,0x83278b48,0x7ae74140,0x72a659e3,0x72871800,0x392151a4,0x52032080,0x62856ac6,0x28a06265,0x7b4930e0,0x836a7308,0x8baa8349,0x62667b29,0x418272c7,0x62448328,0x728659e3,0x59e272a7,0x6a847ae5,0x8b676a63,0x7b05b4ae,0x8b6a7ae7,0x72c78348,0x626549a1,
-0x08000800,0x08001020,0x29240820,0x3165736d,0x316518c3,0x8c514a48,0x7bae630c,0xce595268,0x20e3b595,0x00000000,0x08200000,0x20c31061,0x7bae7b8e,0x3965bdb6,0x31851881,0x31854a07,0x00000000,0x732c20a2,0x314441a5,0x8c309491,0xa4d2ad54,0x10613165,0x00001040,0x41a55227,0x31036aea,0x7b2c6aca,0xce592924,0xe6db7b8e,0x08415228,0x318620e3,0x18a20840,0x94719492,
-0xd699ffff,0x39a583ee,0xde7841a6,0xeedbef1b,0xff5d9c71,0x732d7b6d,0xdebaad13,0x00009cb1,0x7b4d2061,0x18815248,0x08001020,0x10410821,0x39a620c3,0x6aead659,0x83ad5a88,0xcdf60800,0x41c73165,0x31231020,0x41c67b6c,0x62892923,0x18205247,0x31431000,0xc5d53984,0x10204a27,0x20c21880,0xa4d2732b,0x62a90800,0x41653143,0x736e2081,0x4a285a8a,0x83cf9451,0x7bae4a28,
-0x6b2c4a28,0x6b4c8430,0xce1873ae,0xbdb75229,0x526ab576,0xa4f36b2d,0xad149451,0x62eb5269,0x31654a28,0x1881bd54,0x29230800,0x29453144,0x8410630c,0x738e738e,0x9cb4e71c,0x84115aac,0x6b4ef7bf,0x9cb362cc,0x5aed3146,0xd67cd69c,0xd69dce5c,0x29201080,0x20c05244,0x39803140,0x41a03120,0x314020e0,0x41a11020,0x49c27309,0x5a4251e3,0x52206282,0x62a55262,0x4a235244,
-0x4a233140,0x49c13980,0x52435a43,0x7b487b69,0x93ca8389,0x8b898b68,0x72c58ba8,0x6a8272c4,0x93a85a00,0x9ba88b26,0x7ac57282,0xff7a2040,0x72a67b07,0x7ae76a64,0x8b8b6aa6,0x9bec6a86,0x6a856a85,0x73076243,0x5a238389,0x83285a43,0x6a8672c7,0x30c01800,0x10007ac8,0x7ac66224,0x72847284,0x8ba87ae6,0x8baa7ae5,0x8b877b25,0x730372e3,0x49606241,0x18203924,0x6a85ac6a,
-0x20e35a69,0x10810820,0x00000840,0x08400000,0x21241081,0x39e718c2,0x29443185,0x00002924,0x10a20840,0x00000000,0x00000020,0x31652103,0x4a073165,0x41a62903,0xa4f27b6d,0x292483ce,0x10611061,0x31436b0a,0x20c241e6,0x000018a1,0x18a11061,0x18817bae,0x52273184,0x000020c2,0x416528c2,0x08005227,0x00000000,0x00000000,0x840f20e3,0x18c2736d,0x5aca5aaa,0x000062eb,
-0x00000000,0x08200000,0x41e72903,0xc5f75a89,0xf73c6aec,0x83ae5a69,0x1881ad13,0x00001060,0x10000000,0x10601881,0x9c927b4c,0x4a489cb3,0x0000e6fb,0x5a897bce,0x62ea5aa9,0x31447b8d,0x29041061,0xc5d6ffbe,0xad13bd95,0xff5c9c91,0x83ceef3b,0x7b8d3965,0xa4b23123,0x28c21020,0x736ce6da,0xbd95ad14,0x4a074a07,0x7b8d41e6,0xe6db83ae,0x49e818a2,0x39a75a8a,0x62cbb555,
-0x8c309471,0x7b8d8c30,0x736dad34,0x18c3ad14,0x39876b4e,0x52493186,0x83f04a08,0x29240820,0x39864a28,0x39863985,0x52695a89,0x41e73185,0x7bf039c7,0x42074229,0x4a2aef3d,0x83f19473,0xa536c5f9,0xc6199cd5,0x3167b577,0x0001630c,0x29210000,0x398239a3,0x396141a2,0x31203940,0x396041a1,0x41c24a03,0x41c24a03,0x312028e0,0x20a04182,0x5ac262c4,0x5a855a84,0x52852940,
-0x62c641a1,0x6ac662e6,0x62855a64,0x62657328,0x83277b49,0x83688348,0x412093c9,0x62414160,0x93a76242,0x93679bc8,0x72647ac3,0x51e36244,0x8b69cd91,0x834872e7,0x8b8a72c7,0x51c26244,0x72a57b06,0x61e26a85,0x72c66a64,0x5a0349a1,0x38e0ac8d,0x8baa5a24,0x7ae77b08,0x59e26203,0x72c372a2,0x72c572a3,0x62836aa4,0x8b8951c1,0x8b899c2b,0x51c238e0,0xbd4fc571,0x5a0351a0,
-0x00000000,0x00000000,0x00000000,0x949239c6,0x3165ad55,0x42072104,0x31650000,0x29443985,0x29245acb,0x10612945,0x08610000,0x106118a2,0x10401040,0x734c0000,0x31645269,0x41e72903,0x10400000,0x20c120c1,0x10201881,0x00001061,0x29033144,0x39a41061,0x080039a4,0x9c702923,0x208149c6,0x21034a27,0x18c14a47,0x214452aa,0x630b31c6,0xce382945,0x31650000,0x00003185,
-0x31850000,0x292310a1,0x736effdf,0x4a4a0000,0x6b2c6b4e,0x840fd6ba,0x4a0710a1,0x9cb19450,0x83ee0000,0x4a273985,0x188241c6,0x296531a6,0x10c24228,0xce380000,0xad339471,0xc5d583ce,0x7b8e8c30,0x20c3b555,0x5a6949e8,0xa4d36aeb,0x084139a6,0x8befe6fb,0x732cd639,0x5a494a08,0x0800ce18,0x9c72524a,0x7b8e7b6d,0x8c3162aa,0xb555bd96,0x83cfce38,0x5a8a734d,0x734e9cb3,
-0x736d62cb,0x7b4d732c,0x94516aec,0x4a2962cb,0x5acb528a,0x7b8e4a4a,0x5aaa736d,0x4a494207,0x52494a28,0x528a62ec,0x39c77bcf,0x83f07bcf,0xbdd7528a,0x6b4dad55,0x4a4a1062,0xb5779493,0x9cd59cb5,0xad98ad98,0x29269d16,0x29412102,0x31443162,0x41423963,0x20a03142,0x28c03941,0x62a641c2,0x5a855245,0x31403120,0x41a141c0,0x18a03941,0x29032923,0x522441c3,0x21004a25,
-0x62a67b8a,0x93ec7328,0x93ec3120,0x7b287327,0x7ae67307,0x83277b07,0x72c58347,0x6a8272a4,0x83467b27,0x83059385,0x93a88325,0x41609c0b,0x8bcbacae,0x7308836a,0x72e58369,0x7b077b07,0x4160a42b,0x834a7ae6,0x6a869c0d,0x6aa58b69,0x62644960,0x7b2772e6,0x83278348,0x83078327,0x72c58327,0x7b068326,0x7b0872c5,0x72e46a83,0x83698347,0x83499c2a,0x83088b68,0x83487285,
-0x00000000,0x00000000,0x00000000,0x08200000,0x18810840,0x00000800,0x10200000,0x31850000,0x08610840,0x18e30000,0x632c73ae,0x630b83ef,0x39a62924,0x18a139a6,0x20c228e2,0x52684a48,0x08001881,0x290318a1,0x292320e2,0x29242903,0x39851040,0x29033123,0x31441080,0x398541e6,0x28e349a6,0x29231881,0x00002924,0x39851040,0x000018c2,0x39a60840,0x106120c3,0x00000000,
-0x3a073164,0x632b39e6,0x5aeb31a6,0x18e32944,0x39e71081,0x29442944,0x316520e3,0x39a53185,0x18c218c1,0x08601080,0x00000820,0x18e21081,0x296418a1,0x7bcfbdf6,0xb55583af,0x314583ae,0x83f018a2,0xde9a5a8a,0x18a2d659,0xc5f88c10,0x2104c659,0xa4f44a28,0x41e88c10,0xb576ad55,0xef1cad54,0x83af7b6f,0x7baf8c11,0xb577bd96,0xcdf98c32,0x9c93d659,0xad15acf4,0x526a83f0,
-0x4a29736e,0x7b6ea4f4,0x526abd76,0xad353146,0x4a496b4d,0x6b2d9451,0x9c928c30,0xa4f47bae,0x94518c30,0x8c318c52,0x6b6f7baf,0x83f1a515,0x736f528b,0x8c73c5d9,0xb598f79f,0xb5b9d69c,0xb598c63b,0xad98bdfa,0x73af2967,0x31840000,0x10400000,0x30e23102,0x20a10800,0x31423101,0x314041e4,0x314049e2,0x41a14a04,0x41807b48,0x310151e3,0x41e41060,0x49e34182,0x082039a3,
-0x73670000,0x5a417b26,0x00003100,0x00000800,0x8b896b06,0x72c58347,0x72e672e5,0x838883a7,0x72c47b67,0x5a007ae4,0x72828325,0x83694100,0x93ab8baa,0x83298369,0x73078389,0x838a8bc9,0x51a193aa,0x8348c52f,0x72e87ae9,0x5a0672c7,0x8b498b6a,0x83478b88,0x83278b68,0x7b068b88,0x83477ae5,0x5a236aa5,0x72e75a43,0x62436ac6,0x72a76263,0x7b286284,0x62646285,0x49c072e6,
-0x00000020,0x00000000,0x00000020,0x08000020,0x316428c3,0x28e12923,0x29012901,0x08400840,0x21240000,0x39c65b0b,0x21040020,0x83efef3c,0x29240840,0x18812924,0x08001860,0x18c118a2,0x20811860,0x29032903,0x10603144,0x6b2b4a48,0x294473ad,0x4a277bcf,0x29035268,0x39a53985,0x184030e3,0x106049e6,0x526818e2,0x29254a08,0xa4f35a8a,0x5a8a7bce,0x29037bae,0x29037b8d,
-0x002018a1,0x4a482944,0x10601880,0x18803164,0x10a218a1,0x08202103,0x4a683165,0x39c65289,0x5ac92123,0x42060860,0x39c54205,0x31850840,0x5aca5289,0x08a152a9,0x29243184,0x294439a6,0x2945630c,0x4a694249,0x5aec52cb,0x7b8e3a08,0x6b2d6b4d,0x4a083186,0x5aab18a3,0x528a9cb2,0xdebc734d,0xad579cb4,0xce1ae6fd,0xd65b8c12,0x6aeec5f9,0x5a8b62cd,0xbdb7bd76,0xbdb89cd4,
-0x9c928c10,0xce18ad35,0xc5f8ce18,0xdebbd67a,0x9493c5f8,0xb5b8e6fd,0xb5b7ce7b,0xf77fdebc,0x9cf4ad56,0xde9cef3e,0xd67bbdd9,0xdedc9cf5,0xbe19ef5e,0xe75fe73d,0x94f5cebc,0x4a6a4a6a,0x29864229,0x19241924,0x18e229a6,0x210139c6,0x39830000,0x30e10800,0x104020a0,0x49e528e1,0x41c24a05,0x49e33960,0x418262c7,0x28a07b49,0x41605a63,0x41a46266,0x41c341a3,0x18800800,
-0x52004183,0x7b408b62,0x72e36ac0,0x6aa36aa2,0x49a05200,0x6ac26aa3,0x6aa46aa2,0x626272a4,0x62016263,0x6a827262,0xa44ba429,0x93eb93ca,0x7b088b89,0x7b298349,0x93a87b07,0x93a97ae5,0x9bea8b88,0x7ae78349,0x204072c6,0x838a72e7,0x8b898349,0x8b478b47,0x8b6793a8,0x7b067b05,0x62216221,0x72c66283,0x6a866264,0x6a856aa6,0x49826a84,0x5a436264,0x628528a0,0x62626284,
-0x28e20800,0x314428e2,0x29031880,0x00000800,0x314420c2,0x31432943,0x20c03142,0x00200820,0x00000020,0x00000000,0x00000000,0x00000021,0x00000000,0x28e21061,0x080020c2,0x31231881,0x29032903,0x31023103,0x31442903,0x31642903,0x20c12943,0x184018a1,0x18a21861,0x106141c6,0x104020a2,0x08400000,0x18a20000,0x00001082,0x08410861,0x104118e3,0x10200800,0x00001020,
-0x00000000,0x29650000,0x08201041,0x18825aaa,0x10a20000,0x21040000,0x29232103,0x52684207,0x73ad4207,0x62eaa512,0x314483ad,0x39c64a47,0x62eb4a48,0x31853165,0x41e65268,0x52892943,0x73ae4a48,0x5b0c8c92,0x4a494208,0x738ebdd7,0x5a8bce79,0xa4d49493,0x5acc9472,0x6b2d6b2d,0xc61a73af,0xa516bdd9,0xd65b736f,0xc61aad36,0xbdb8bdd9,0xc619bdd8,0xce5ace5a,0xd67adedc,
-0xdebbdebb,0xef3dde9a,0xdebbef1c,0xef3cf75d,0xf77de71c,0xdedcd67a,0xe71dce7a,0xdedcdedd,0xdf3edf1e,0xd69cce7c,0xd6dcc63b,0xd6fcef9f,0x634f73d0,0x6b906b90,0x4a4a4a6b,0x39e739e7,0x08812123,0x318518c2,0x10401081,0x31440840,0x41a341a4,0x18601860,0x49c43942,0x4a0520a0,0x49a33922,0x628749c4,0x520549c4,0x5a4449e3,0x6aa66285,0x41e249c2,0x184041c3,0x41605a44,
-0x8b8541a1,0x8b818b41,0x8323a406,0x8ba693e7,0x72e57b05,0x5a226aa4,0x730572e4,0x83488367,0x8b898b8b,0xa44b8b47,0x832693a9,0x8b8a93ca,0x838993cb,0xb48a7b08,0xb48db4eb,0x8baa9c2b,0x93a98b68,0x8b688348,0x72e75a24,0x5a431820,0x93c93900,0x8b888b87,0x93889c09,0x6a8382e7,0x62636a84,0x5a4362a4,0x51c26285,0x62436243,0x5a036a85,0x51c230c0,0x520051e1,0x49c051e1,
-0x20e30000,0x18a020c1,0x20a12901,0x08200820,0x292320c1,0x29232923,0x290220c1,0x41c62943,0x29033164,0x10810000,0x10601040,0x10401881,0x31233985,0x28e22903,0x29032903,0x31443124,0x29232903,0x31233123,0x31233144,0x210220c2,0x18a020e2,0x28e11880,0x210228c1,0x080020e2,0x104020c2,0x18600000,0x08410000,0x00000000,0x00000000,0x00000000,0x08000000,0x31241861,
-0x41a620a2,0x39853984,0x292339a5,0x18800000,0x08401081,0x39a610a2,0x210220e3,0x21222923,0x318418c1,0x29023123,0x41c52922,0x212231a4,0x20e20840,0x316431a5,0x294339c6,0x29432943,0x31443985,0x318518c2,0x21032944,0x296439e6,0x29242964,0x18c22924,0x39a63186,0x39e83a08,0x4a4a31a7,0xa515630d,0xc63a8432,0xb598c63a,0xce3ac61a,0xc619c5f9,0xce7bce5a,0xd67bd67a,
-0xe6fbdedc,0xef1cef1c,0xef1cef1c,0xf79eef3c,0xe71ce71c,0xdebcdebb,0xe73de71d,0xad97cebb,0x94d5adb8,0x843294b4,0xb5b78432,0x426a73af,0x5b2d5b0c,0x5aed636e,0x4a6952cb,0x31c639e7,0x18a01080,0x10403143,0x10400820,0x188020a1,0x41823121,0x39613941,0x41815a65,0x416128c0,0x288028a0,0x28c05205,0x5a665a66,0x6ac65244,0x5a445203,0x394349c3,0x524341c2,0x62856aa5,
-0x7b0220a0,0xac66a444,0x93a6a423,0x838593c8,0x834751e0,0x7b277b27,0x7b288368,0x83297b07,0x6a858bca,0x8b699bca,0x72a68328,0x83698b88,0x7b267b07,0xc50ea44d,0xa40aa42b,0x83278b68,0x8b888347,0x832672c5,0x93eb8bc9,0x498293eb,0x83698b89,0x93a88b46,0x938893c8,0x7b057ae5,0x834872c6,0x5a436285,0x5a4349a1,0x5a223920,0x418049a0,0x31004140,0x51e04980,0x8ba76aa2,
-0x08001840,0x20400800,0x18801861,0x10410800,0x00000800,0x00000000,0x00000001,0x000020e2,0x000018c2,0x00000000,0x08000000,0x29232923,0x290228e2,0x29232902,0x29222902,0x20c12902,0x314320c1,0x31023944,0x312320a1,0x20a11880,0x290228e2,0x31032923,0x000028e2,0x00010000,0x18a01040,0x18801040,0x00000000,0x00000000,0x00200000,0x08200041,0x00000000,0x00000000,
-0x00000000,0x20c12943,0x104141c7,0x18c018a1,0x21032101,0x00000821,0x10400000,0x10600820,0x31433163,0x10403163,0x49c430e1,0x31835a46,0x39c43983,0x318418c1,0x41c620e2,0x290341a6,0x39a53985,0x41c649e6,0x316439a5,0x39c539e5,0x398531a4,0x31a52924,0x39c73186,0x4a8939c6,0x42085a8a,0x5aab526a,0x4a6a5aab,0x8c9373b0,0x9d1594d4,0xb5b8b5d8,0xb5d8b5b8,0xd67bc619,
-0xef3dd69b,0xe71cf75e,0xef3def3d,0xd69ae6dc,0xd6bbdedb,0xc618d67a,0xbdd8b5b7,0x632e8412,0x634e634e,0x632d632c,0x52ca5aec,0x3a0852aa,0x31c74249,0x4a294a6a,0x4a494a49,0x318439c7,0x29222922,0x104028e2,0x396520c2,0x10001860,0x62a828c0,0x49c128c0,0x49c25a44,0x624649c1,0x49c451c4,0x49e45a46,0x31214183,0x62870000,0x62855a44,0x838a5a65,0x62a65245,0x6a8672e7,
-0x83236a86,0xac879c02,0x7b21b4c6,0x8bc98b44,0x7b277b44,0x83288348,0x83488b89,0x83ab93ed,0x83697b28,0x838a8baa,0x6ac67b08,0x6aa372c4,0x7b258368,0x93c88ba7,0x93a893a7,0x83478b88,0x7b049388,0x7b457ae5,0x83478388,0x836938e0,0x83697b49,0x8ba88bc8,0x93c993c9,0x7ac58327,0x7b086aa6,0x5a236aa6,0x62846ac4,0x52015a23,0x498051c0,0x51a030a0,0x49a06264,0xac888364,
-0x28c01860,0x00000000,0x00201062,0x00200000,0x00000020,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0x314428e2,0x31432903,0x31432902,0x31643123,0x29233143,0x31432923,0x31023123,0x310328e2,0x39642923,0x290220a1,0x394318a0,0x39223102,0x31003921,0x10001000,0x41a34183,0x00000000,0x00000800,0x31431040,0x18808c2e,0x00002902,0x10003943,
-0x188028e1,0x5a8839a4,0x42044205,0x20c039c3,0x08202921,0x10400820,0x39640000,0x28e03943,0x520541a3,0x5a464183,0x520449e4,0x49c45225,0x41e441a3,0x39633983,0x398441c4,0x41c54a26,0x41c541e5,0x524741e5,0x39845206,0x39c55267,0x41e64a47,0x10402923,0x39863144,0x52893986,0x528a4a28,0x526a524a,0x420839e7,0x8c5262ed,0xa5366b4e,0xa556a536,0x9cf59cf5,0xbdb8ad77,
-0xce3ac5f8,0xd69ad65a,0xce19d69b,0xb596c5f8,0xc639bdf8,0xbdd7c619,0x8c72b5b7,0x52cb6b6e,0x4a4a4a6a,0x31c731a6,0x39e731a7,0x31c62145,0x296531a6,0x39e639e7,0x298531c6,0x4a4618e2,0x39c54a47,0x28e23144,0x28e30000,0x182020e1,0x39425205,0x31003941,0x62856265,0x5a245203,0x49824182,0x62875a46,0x5a4641a3,0x49e362c6,0x49c26ac7,0x628728e0,0x316062c7,0x62834160,
-0x73055a83,0x6ac36a62,0x7ae65200,0x7b478368,0x7b277b27,0x72e78348,0x83698b8a,0x72666202,0x940c93ec,0x6aa77b49,0x628572c7,0x7b466263,0x83468ba8,0x8b878b87,0x93888b66,0x8ba89be9,0x7b258368,0x8b888ba9,0x9c4c93ea,0x8bcb8369,0x836a8349,0x7b288369,0x93a98b69,0x8b8b93cb,0x83688348,0x6ae572c6,0x39605a42,0x41805201,0x52014180,0x59e06222,0x51e149a0,0xb4eb9c29,
-0x62a85206,0x000018a2,0x00000000,0x08000800,0x18811861,0x10400800,0x31213142,0x00002080,0x10810000,0x10a20861,0x29023164,0x31441881,0x31433164,0x39643123,0x31433984,0x31632922,0x39643163,0x41853943,0x39444184,0x31233143,0x10401020,0x39421040,0x31433942,0x20c020c0,0x18202880,0x310128a0,0x39613100,0x31001860,0x20803940,0x39411860,0x39833942,0x49a33962,
-0x41641000,0x18801060,0x39a54a27,0x39610820,0x41e341a2,0x20802921,0x28a03101,0x41824163,0x41623101,0x41835205,0x52045224,0x49c35224,0x418349a2,0x39634182,0x292249e4,0x39a44a05,0x41c44a05,0x398328e1,0x41a36aa8,0x39e55246,0x39c52963,0x49e54a47,0x31243123,0x41e73145,0x108239a6,0x316639a7,0x39e74a48,0x84324a6a,0x9cd452cc,0x8c737c11,0x94b48c73,0xad369cd5,
-0xbdb8bdb7,0xce59c5f8,0xc618c5f8,0xad55c5f8,0xbdd7b596,0xb596bdd7,0x8410a514,0x42496b6d,0x18c42125,0x18e310a2,0x08611904,0x19030020,0x298510a2,0x29642965,0x190231a5,0x000039c5,0x4a471060,0x00006b0b,0x5a890000,0x6aa918a0,0x418428e0,0x52023120,0x5a245a24,0x49c26265,0x6aa651e3,0x49a45a25,0x522651e4,0x62856ae6,0x6ae75a45,0x5a4549e3,0x5a6749e4,0x62856286,
-0x7b476b08,0x62856ac2,0x51e251c3,0x838872e6,0x62848349,0x83696aa5,0x93ab8b8a,0x838a8bac,0x7b29836a,0x8baa72e8,0x836a8bab,0x8ba872a5,0x9c299408,0x93e89c09,0x83268b86,0x83667b05,0x83878368,0x834793ca,0x83a99c2c,0x8b8a7b29,0x7b497b28,0x72e66a85,0x7ac77b08,0x62a57327,0x62436a84,0x6ae572e6,0x7b286283,0x5a226265,0x520151c0,0x5a415a21,0x93c95a41,0xd611aced,
-0x5a685226,0x00003964,0x00000000,0x10810000,0x18600000,0x314328e0,0x20a02922,0x00002901,0x20c00820,0x18a10000,0x082020e3,0x31222903,0x39633162,0x29223143,0x31433963,0x31633964,0x39843964,0x39643943,0x08003144,0x08000800,0x31631040,0x28e32902,0x41830000,0x396141a2,0x082028a0,0x30e028c1,0x49c34182,0x522649c5,0x10207b2a,0x49e45246,0x08003921,0x00004184,
-0x41833964,0x292362e8,0x41a50800,0x49e441c4,0x39613101,0x416320a0,0x41835a26,0x31014162,0x5a255204,0x39415a46,0x41805204,0x41c349c1,0x418241c2,0x41a23961,0x49e43961,0x396341a4,0x39613121,0x52465266,0x520549c4,0x41c449e5,0x41a349e5,0x5a2541a3,0x18613984,0x39c641c6,0x18a21881,0x20e31882,0x42083986,0x9cd4632d,0x949352ab,0x94737bf1,0x8c528411,0x9cd48c52,
-0xb596b576,0xc619a515,0xd69abdb7,0xad35ce38,0xad35a514,0xb597c5d8,0x8411ad35,0x3a09630d,0x00000861,0x00000000,0x00001082,0x00000861,0x10c218c2,0x292220e2,0x10404a27,0x10403963,0x39a41880,0x39a55268,0x18a12902,0x41c41881,0x208041c4,0x51e43941,0x41a35204,0x6ac651c3,0x39216266,0x49e462a7,0x6ac75204,0x73277b48,0x73076ae6,0x5a447b48,0x52247b49,0x7b6949c3,
-0x6aa55a44,0x62846ae5,0x39405a23,0x6ae75a65,0x8b896286,0x832993ca,0x834a8349,0x72e88b8b,0x7b286265,0x62a65204,0x49c262a7,0x7b0672e6,0x62408366,0x834593a8,0x93c77b04,0x8b6772e4,0x7b067b27,0x72c572c6,0x83477b47,0x6ac672c6,0x72e772e7,0x6aa672e7,0x49a25a44,0x52035203,0x52235a64,0x62a66ac6,0x51e16ac6,0x6a834180,0x392049c0,0x62646243,0x49a049c0,0x52025222,
-0x7bad3163,0x00001040,0x00000800,0x00200020,0x00000000,0x31431881,0x394241e5,0x00002921,0x18801040,0x000018a1,0x08203144,0x39830000,0x20c03162,0x20e03142,0x31643964,0x41a53984,0x41c64a06,0x31221020,0x31221000,0x396241c4,0x31213961,0x49c43982,0x41633101,0x28c03941,0x28e10000,0x31203121,0x418230e0,0x49c46aa8,0x08003121,0x39423143,0x394341a1,0x080049c3,
-0x394220a0,0x208020a0,0x20c03963,0x312149e6,0x39611020,0x49a33942,0x41622080,0x39215a46,0x522549c3,0x41a16aa7,0x49e37b4a,0x52244181,0x49e34a03,0x31003100,0x52043920,0x41a220c0,0x31412080,0x52655ac6,0x522549e4,0x49a45245,0x498349c4,0x49c351e4,0x080028e1,0x20c23165,0x08201060,0x10611040,0x39a620c2,0x738f31a7,0x94938411,0x84117bd0,0x84118c32,0x9cb38c52,
-0xb596b556,0xb576ad55,0xc618b576,0xb576d67a,0xad15b556,0xad56bdd7,0x7bf09cd4,0x298652cb,0x00001082,0x00000000,0x08001061,0x10810800,0x18a12103,0x31020820,0x31422080,0x18603142,0x4a0541c6,0x52474a05,0x08201060,0x314120a1,0x49e31060,0x418251e4,0x51e53962,0x39206285,0x628530e0,0x5a456286,0x51e341a3,0x5a646286,0x62a64181,0x41a262a5,0x62863120,0x08005244,
-0x49c128c0,0x626462a4,0x52034160,0x4a035a65,0x6aa36ac7,0x834772e5,0x832a7b08,0x7308838a,0x6aa6836b,0x7b686aa5,0x6ac57308,0x72e45a42,0x6a807b06,0x8b6693a8,0x72c493c8,0x73067b26,0x7b079c0a,0x83488368,0x7b278348,0x7b497b28,0x7b498baa,0x6aa67307,0x5a456ac7,0x5a446264,0x5a4462a5,0x62a65a64,0x62447307,0x49806263,0x5a2249a0,0x5a235a22,0x51e051e0,0x41815a42,
-0x290220e1,0x39832080,0x312328c0,0x00000000,0x00000000,0x00000000,0x00000820,0x00000000,0x10200000,0x20c13143,0x41a50000,0x292118a0,0x31002920,0x39a23141,0x20c12921,0x00200000,0x00000000,0x18400000,0x39633963,0x10003961,0x184041a3,0x290028c0,0x20a03961,0x184020a0,0x10003941,0x18400020,0x28a049a3,0x28e041c2,0x41822080,0x41a30800,0x41821860,0x18605a25,
-0x49c441a4,0x10402081,0x4a044a04,0x28e041a3,0x312120c0,0x4a043100,0x394128c0,0x18603941,0x51e44182,0x628549c2,0x41827b49,0x524549c3,0x31404a04,0x100039a1,0x41c33120,0x396220a0,0x62a63121,0x5a667329,0x49c449e5,0x394241a2,0x310149a4,0x39225a26,0x4a073143,0x08000000,0x08200820,0x00000000,0x20a33965,0x94733126,0x73b0634e,0x7bd06b8f,0x84118431,0x9cd38c31,
-0xbdb7b596,0xb596ad55,0xbdd7b555,0xb596ce59,0xad35c5d8,0xa4f4bdd7,0x73af9493,0x29854249,0x00000861,0x00000000,0x52693186,0x08200000,0x10400000,0x39a418a0,0x31433122,0x39633943,0x49c420a0,0x394220a0,0x18a041c4,0x39421040,0x418341a3,0x51e551e5,0x416349c4,0x51c22880,0x5a0351e2,0x186028e0,0x52235224,0x49e13120,0x52245243,0x49e341a2,0x18805a66,0x20e04a24,
-0x73073121,0x7b476283,0x5a646285,0x41a25a44,0x7b4849e3,0x72e67307,0x73096aa6,0x834a6a87,0x62a672e9,0x522349e1,0x6ac57b69,0x73075a42,0x6a8272e4,0x93a64140,0x62a57b25,0x9c4c7304,0x83689c2c,0x8b8a9c2a,0x8b688b89,0x7b497b47,0x73087b8a,0x83496265,0x836a72e7,0x5a4472e8,0x5a444160,0x626428a0,0x51e45a45,0x5a2451e0,0x6aa46243,0x62847306,0x6ac55a43,0x5a6341a0,
-0x20e02901,0x31201040,0x00001860,0x00000000,0x00000020,0x00000820,0x20c21860,0x08201040,0x00000000,0x00000000,0x08200820,0x08001060,0x31012921,0x104020a0,0x08000800,0x00000800,0x00000000,0x31220000,0x20601840,0x39412080,0x28e12040,0x418328e0,0x312441a3,0x28e00800,0x10404184,0x20a03102,0x418228e0,0x41822900,0x20800000,0x73092081,0x41631000,0x18404183,
-0x20a049a4,0x206030e0,0x52064184,0x314228e1,0x20805205,0x41a228c0,0x49a23141,0x520441a2,0x49c341a3,0x41a35a46,0x39403120,0x4a0428e0,0x39825225,0x52444a04,0x6ac841e4,0x10200800,0x49e42080,0x52455246,0x52265a66,0x6aea5207,0x20805a67,0x288028e1,0x10601020,0x41c60000,0x10611882,0x39c70000,0x20c31040,0x8411522a,0x6b4e8c92,0x7bd06b4e,0x7bf08411,0x9cb383f0,
-0xb575b576,0xad55a514,0xbdd7c5f8,0xbdb7bdb7,0xad35bdd7,0xa4f4b576,0x6b4e94b3,0x10c231a7,0x00000000,0x00000000,0x08000000,0x08402924,0x20c11081,0x39a32922,0x39a33162,0x520541a3,0x31421860,0x20a01000,0x398320a0,0x39420800,0x39633121,0x41833922,0x10003922,0x41643101,0x28a00000,0x392228a0,0x28c02080,0x6ac75223,0x6ac74181,0x5a455a24,0x5a666ac8,0x29215aa7,
-0x29204205,0x6ae58bca,0x62845a42,0x6ac662a6,0x730762a6,0x73077b27,0x834a7b28,0x5a0572e8,0x5a467b4a,0x6ae86266,0x72e89c4c,0x73275a24,0x8b877b05,0x5a0193a8,0x72e67b04,0x7b277b47,0x8bc97305,0xbd0facad,0xacefa48c,0x834972c5,0x72c772e7,0x8b6a7b28,0x6aa58369,0x7b285a44,0x6ac65a23,0x39406ac6,0x62863100,0x7b2972e8,0x5a4362a6,0x62855a64,0x41804160,0x310028e0,
-0x31203140,0x20a049e5,0x20a13101,0x00000000,0x30e10000,0x41833942,0x20803101,0x208028c0,0x000028e2,0x00000000,0x10600000,0x18604185,0x28a020c0,0x08001820,0x10004164,0x08201000,0x00000800,0x41842060,0x206030e0,0x39202060,0x100030e0,0x20c01040,0x31011840,0x10011841,0x18603922,0x290128a0,0x398349c6,0x00001000,0x31005227,0x20802060,0x392220a0,0x41811860,
-0x51c43901,0x20805a67,0x41a45a06,0x31413983,0x41a33982,0x52244a04,0x31003961,0x41623921,0x39424962,0x396141a3,0x49c44183,0x398149e4,0x20c03161,0x310020e0,0x10004984,0x6b091020,0x62646ac7,0x31005204,0x52063102,0x10001820,0x08001820,0x18813144,0x39850800,0x29240000,0x00000000,0x00000000,0x08000800,0x738f62cc,0x6b4e7bd0,0x73af738f,0x7bd07bd0,0x94927baf,
-0xad55b575,0x9cd2ad34,0xc5f7c5f7,0xbdb6c5f7,0xbd97bdb7,0xa4f5b576,0x632da4f5,0x00202145,0x00000841,0x42280881,0x00000020,0x00001061,0x208020c2,0x41e73964,0x31823984,0x39623121,0x39226267,0x102041a4,0x31622080,0x18603142,0x20a03101,0x49a328c0,0x52261040,0x10011020,0x10201841,0x08003944,0x08004184,0x6ac83100,0x62855203,0x72e75203,0x62885246,0x49e55225,
-0x188039a3,0x734839a3,0x41c06b06,0x628662a4,0x62856ac7,0x62646285,0x5a436aa6,0x6ac86ac7,0x5a464162,0x73096ac8,0x7b4772c7,0x6a847307,0xac4d8347,0x7b048347,0x6a8451e0,0x7b2872e7,0x93a972a4,0x7b28cd93,0xbd308b68,0xac6e59e0,0x9beb93aa,0x9bcb7b25,0x8bc98b8a,0x7b497308,0x626472e5,0x9c2c8329,0x52028367,0x49a37306,0x5a436ae6,0x41a049c1,0x49c03920,0x49a149c0,
-0x20a01000,0x28e11840,0x20a01020,0x18601860,0x41833122,0x31013961,0x29001840,0x00003943,0x00000000,0x00200000,0x31220841,0x28e02900,0x41833964,0x392228c0,0x20c03963,0x18602080,0x20c020c0,0x31003962,0x18201820,0x30e12040,0x31004162,0x20a23163,0x10000800,0x31213943,0x20802060,0x10205a25,0x18803121,0x5a663962,0x49a349e4,0x39603120,0x10001840,0x41841000,
-0x414251c4,0x49e4730a,0x418451e5,0x39432101,0x398349c4,0x41a25245,0x39015204,0x6ac74162,0x28c028a0,0x41a31880,0x49c420c0,0x31844a05,0x62e820c0,0x39845267,0x20a120c1,0x00003943,0x49c45a46,0x28a00800,0x08003121,0x39440800,0x49e628e3,0x18813985,0x29031040,0x08000000,0x08200000,0x00000000,0x20e420a3,0x5b0d632d,0x632d5aed,0x7bd073af,0x738f738f,0x9cd46b4e,
-0xb596b596,0xad54a514,0xc5f7c5f7,0xbdd7d658,0xc5f8bdb8,0xad15bdb7,0x52cca4f4,0x21242146,0x00000000,0x3a070000,0x00000861,0x08200000,0x10001860,0x18201000,0x39611860,0x49c44a04,0x28a03942,0x49e45a66,0x526620a0,0x290120e1,0x184028e1,0x31021840,0x10003922,0x28c128a0,0x8bac3102,0x00000000,0x72e91880,0x49e41000,0x5a666ae7,0x73295205,0x49e54a05,0x520549c4,
-0x41e44a04,0x5a655a86,0x7307b530,0x5a433940,0x628662a4,0x62657b28,0x49c05a43,0x7ae930c0,0x72e87b29,0x5a053101,0x8389940c,0x83698bca,0x9c4c8348,0x83889c4c,0x62437b26,0x83686264,0x6aa38b88,0xc5706260,0xbcceb48b,0xb4aed5f3,0x93a98b88,0x832793ca,0x8ba993ca,0x83486a86,0x8b897ae8,0x7b486aa4,0x9c0b8bca,0x49c16aa3,0x6aa52060,0x41a049e2,0x41605a23,0x5a644a03,
-0x18403141,0x28c12061,0x29001020,0x41823120,0x396241a2,0x39423100,0x10003962,0x31231040,0x080028e2,0x00000000,0x20c10000,0x31203963,0x39223120,0x39621020,0x28e03942,0x28e03120,0x39622080,0x20802080,0x28803922,0x28804143,0x28a01840,0x08000801,0x396028e1,0x28e228e0,0x31213922,0x39632060,0x08001000,0x08001860,0x208020a1,0x20803120,0x628728e0,0x18403941,
-0x51c42040,0x418349a5,0x41c54184,0x31223983,0x52053963,0x49e35a65,0x416241a2,0x20604162,0x394230c0,0x9c6e1840,0x41a30800,0x5aec41c3,0x316318c1,0x49e741e5,0x08001040,0x732b0000,0x10205a67,0x394149e4,0x41a33121,0x08000000,0x20c228e2,0x18815248,0x00000000,0x082020e3,0x08200841,0x20e33165,0x39c74a28,0x630d52cc,0x5acc5acc,0x7bf073af,0x6b4e7baf,0x9c936b4e,
-0xb575b575,0xbdb6a4f3,0xb595c5f7,0xad55c5d7,0xbdd7b576,0xbd97c5d8,0x52ccad56,0x00002146,0x000039e7,0x00000040,0x00002985,0x18600000,0x10000000,0x28824184,0x5a253923,0x396262a7,0x41836267,0x52263122,0x4a055205,0x39831040,0x28c01860,0x49c328a0,0x51c44983,0x30c06a86,0x51c41800,0x5a0593ac,0x310051c3,0x39417b69,0x5a465203,0x73096287,0x396341a4,0x62a749e5,
-0x5a865aa7,0x6ac741c3,0x9c4e5a67,0x7308cdb2,0x7b298369,0x7b087b29,0x8b8a72e9,0x7ae68b6a,0x5a666ac8,0x7b296ac8,0x838a838a,0x8baa7b08,0xaccd9c2c,0x940c9c4c,0x83678b69,0x93c99c0a,0x834693e7,0xac8cf6d6,0xa4289be8,0xa44c93ea,0x8367acac,0xa46aa42d,0x93eb8347,0x7ae78348,0x7b0772e5,0x62847ae8,0x8349838a,0x52416262,0x93ea5a43,0x39606284,0x310049e1,0x41c21860,
-0x20a03121,0x31611880,0x31613982,0x31004182,0x49c41020,0x39624162,0x39823121,0x31423942,0x00002901,0x00000800,0x20e00000,0x31011840,0x28e02080,0x39223921,0x10401820,0x20c03981,0x41a23120,0x29003120,0x49e43982,0x10001000,0x20a02081,0x39812900,0x31402920,0x20a11040,0x18403121,0x49a428c1,0x29423962,0x318420c2,0x20c00840,0x312220a0,0x734a3943,0x31220800,
-0x39623962,0x396249c4,0x41c539a3,0x39a441c5,0x41c52902,0x39614a25,0x41623962,0x31213961,0x18403121,0x5a2593ed,0x41c349e3,0x4a253141,0x41c40800,0x10200820,0x52882922,0x18403143,0x30e049a3,0x28a06ac7,0x28e028e1,0x00001000,0x28e241c6,0x000018a1,0x104041c6,0x00000800,0x188218a2,0x4a0839a7,0x5aab4a08,0x4a6a4229,0x5aec4a6a,0x7bd06b6e,0x52ab73af,0x94726b0d,
-0xad35b575,0xad34ad34,0xa513c617,0x9cd3c617,0xb576b576,0xb596bdb7,0x52abad55,0x18e32946,0x08400000,0x08400861,0x00000000,0x104020e3,0x310349e5,0x206028a1,0x28a04163,0x52253121,0x49c33941,0x49a36286,0x39633921,0x31012901,0x4a0449e4,0x51a428a0,0x39226a87,0x18603961,0x184049a3,0x182028c0,0x00003903,0x000041a5,0x72ea0840,0x49c69c70,0x28c1942e,0x51e449e4,
-0x08003142,0x5a4583cc,0x49c36ae6,0x6ac75a45,0x30e06ac6,0x30e049e0,0x20204140,0x72c75a04,0x8bab9c2e,0x8b6a8b8b,0x93ca8b6a,0xa46d8baa,0xa44ca44d,0x9c0ba44c,0xacae8b89,0xb4efbd0f,0x9c0ac551,0xc5509c0b,0x9be8ac8c,0x9c29a409,0xb4aeac6c,0x8ba78ba7,0x93eb7b26,0x7b4993ec,0x6aa58368,0x5a0272c5,0x6ac48368,0x49a06261,0x72c66261,0x52015a20,0x29004980,0x418030e0,
-0x31412941,0x7baa3160,0x31602940,0x31413961,0x49a45205,0x39623921,0x20a041a3,0x39823963,0x41e641c4,0x52485226,0x08000020,0x41623942,0x41633921,0x312249a4,0x20a03962,0x29223140,0x08203163,0x316018a0,0x29003140,0x18403942,0x31403961,0x20e03120,0x18403161,0x28e01000,0x41a33920,0x31003940,0x5a874181,0x5a6883ab,0x312041c2,0x20e028c1,0x29002922,0x28e049e4,
-0x41a33121,0x20c02921,0x10603162,0x20e03144,0x082039a3,0x52263982,0x208049e3,0x28c02080,0x52045204,0x5a45940d,0x5a453981,0x52451860,0x49e318a0,0x20a15a46,0x00001040,0x52250000,0x100049e4,0x20a028e0,0x49a31000,0x08002041,0x08000000,0x10202923,0x10403124,0x08000000,0x10411861,0x62eb5a8a,0x39c739a6,0x422931c8,0x5aac4a4a,0x84116b6e,0x630d738f,0x947262ec,
-0xad55b575,0x9cb29cd2,0xbdb6b575,0x9cb3b595,0xbdb7bdd7,0xb576ad55,0x4a49a514,0x21032104,0x08400820,0x21240000,0x10810840,0x39640000,0x30c228a1,0x206030e2,0x39224164,0x41a35205,0x52055a47,0x6ae85a45,0x39625204,0x49c45205,0x4a055205,0x51e43101,0x49a33921,0x49c45a46,0x416128c0,0x39413101,0x20c03920,0x18803982,0x20a028e1,0x184020a1,0x41c20800,0x62a78bec,
-0x10405224,0x41823120,0x5a4428e0,0x52245a64,0x49c26285,0x6aa549c0,0x7b2972c6,0x62246aa6,0x62646ac6,0x72c77b48,0x8b898b6a,0x9c2c8baa,0xa46dacae,0x93eb8369,0xacae9bec,0xbd0fbd0f,0xb4edd5b4,0xb4adb50d,0x9be9bd2e,0x93e98b86,0xa44cc52f,0x93c893a8,0x28c08346,0x93eb8368,0x72e58369,0x52015a20,0x62836aa5,0x6a8472e5,0x6aa47304,0x6a8472e3,0x62a36aa3,0x394062c4,
-0x4a243981,0x42024a23,0x39a14201,0x312241a3,0x41a420a0,0x18803121,0x5aa81040,0x29010800,0x18804a05,0x52473183,0x08000800,0x28a028e0,0x18604184,0x20a10800,0x310149c6,0x41c341a3,0x00002920,0x41e12940,0x396041c0,0x292020e0,0x29402940,0x39c04a42,0x21002940,0x312028e0,0x49c328e0,0x39614182,0x28e049e3,0x18802920,0x52663141,0x186020e2,0x418320a0,0x39633963,
-0x41a43942,0x20c03941,0x080049c4,0x28e02900,0x394249e4,0x41a441c4,0x39624a05,0x39623982,0x10404a04,0x628649a3,0x52453100,0x20a06b29,0x62876ae8,0x734b28c0,0x62e639a3,0x20e05a85,0x39412060,0x102020a0,0x00003142,0x52270800,0x1881732b,0x18a220c2,0x00000000,0x08000000,0x00000000,0x31043165,0x39a628c3,0x4a484a48,0x5acc4a4a,0x7bf0632d,0x6b6e73af,0x9cd36b4d,
-0xbdb6b575,0xad34ad35,0xc5f7a4f4,0x9492c5f7,0xbd97bdd7,0xbdb7bdb7,0x4a499cd3,0x00412986,0x21232964,0x00001081,0x10601081,0x28a21081,0x10001840,0x39223123,0x62886288,0x51e549a4,0x41833942,0x836a49a3,0x49a33921,0x7b4b3982,0x62676b08,0x41831000,0x49c449c4,0x396249e4,0x312120a0,0x49a349c2,0x418251e5,0x49e35204,0x20802080,0x418320a0,0x39403100,0x4a045244,
-0x522449e3,0x62a65a65,0x524562a6,0x51e35204,0x5a245a65,0x31005a43,0x7b086ac5,0x62646265,0x73076ac6,0x6aa66286,0x83686aa6,0x7b078b8a,0x832959e3,0x20406244,0x73068369,0x8b678348,0x7b257b06,0x51c17b07,0xac4bac8c,0x93c78323,0x9be79be8,0xbcef9c2b,0x8368a44c,0x5a433920,0x8bc93100,0x72e67b27,0x6aa46ae6,0x62825200,0x5a426a83,0x52006ae3,0x62a25201,0x41805a41,
-0x42033181,0x39a14a23,0x316141c2,0x49c43101,0x20a02080,0x080028e0,0x41a53983,0x0840734b,0x000039c6,0x18a00820,0x4a053121,0x18603142,0x10000800,0x18401840,0x31002080,0x39c23100,0x39813181,0x31603181,0x52223960,0x318041e0,0x318039c0,0x29604201,0x29603180,0x31404a23,0x41a228c0,0x41824182,0x29003961,0x18c03182,0x00000000,0x10000000,0x41832901,0x310130e1,
-0x49c43922,0x4a043961,0x39613961,0x20a02900,0x312162a6,0x398341c3,0x39423963,0x398241c3,0x28c05226,0x28e03962,0x52665204,0x28c05a87,0x730920a0,0x18a049a4,0x41e241e3,0x29007348,0x49c47b4a,0x49e62080,0x20c10800,0x29230800,0x08203144,0x000018c2,0x00000000,0x00000000,0x31440820,0x080039a5,0x41852061,0x42072923,0x4a6a39c8,0x7baf632d,0x6b4d8431,0x9cb26b4d,
-0xc5f7bd96,0xad34ce59,0xbdb68c31,0x9cd3b575,0xbdd7ad55,0xbdd7b596,0x42088c72,0x18e30882,0x10a10000,0x00000000,0x10810000,0x31230860,0x18600800,0x30e03102,0x418320a0,0x184028e1,0x39625a26,0x51e349a2,0x5a464161,0x41834a04,0x51e44a04,0x418262a7,0x394249c4,0x310149e4,0x41a220a0,0x39211000,0x28a04181,0x18805204,0x184041c6,0x418349a4,0x418249c3,0x52645a45,
-0x49e428c0,0x39616286,0x7b8b3941,0x73273962,0x5a2462a5,0x628351e2,0x6ac56ac4,0x73077b27,0x72e8838a,0x5a247b09,0x7b2872e7,0x7b086a86,0x836a7b49,0x62648baa,0x7b4751c3,0x6aa493eb,0x7b0593ca,0x9c6c72a6,0x94098be8,0x93e88366,0x6ac08b88,0x72c572c4,0x72c572e5,0x9c4c942c,0x10001000,0x7b281000,0x7b276285,0x7b067305,0x6aa37305,0x41c062a2,0x6ac33960,0x52006282,
-0x20e020c0,0x39803960,0x20c03160,0x20601840,0x20801000,0x39a33983,0x39a439a3,0x18c00800,0x00001040,0x20e00820,0x31413141,0x31013140,0x20801020,0x28c028e0,0x49e53982,0x31612920,0x29413141,0x18a02941,0x39a020e0,0x318031a0,0x298031a0,0x31c031a0,0x39e13a01,0x41c141e1,0x396028e0,0x290020e0,0x39c12940,0x28e02900,0x08001020,0x5a262080,0x28c141a4,0x52043942,
-0x392249a4,0x10001840,0x29003960,0x522528e0,0x39823942,0x41834182,0x49c43921,0x49c441a4,0x49e52921,0x49a43942,0x418241a2,0x73295204,0x5a474183,0x10604183,0x5a867b8b,0x18802901,0x418328e0,0x20c141a4,0x290262a8,0x00003964,0x20e20000,0x10200000,0x10401861,0x20a120c2,0x10200800,0x20a128e2,0x41e728a1,0x49e71860,0x5aca3186,0x738e630d,0x7bf07bcf,0x94926b4d,
-0xc5f7b575,0xa514bdd7,0xbdd77bcf,0xad35ad35,0xb576ad15,0xa534b597,0x21248c51,0x08400840,0x00000000,0x10610000,0x41c60000,0x100041a5,0x20a13964,0x394228e1,0x41633122,0x39213121,0x396228c0,0x5204838a,0x52047308,0x52055225,0x5a045a45,0x52023940,0x49a33100,0x51e46266,0x49c36246,0x31006266,0x6aa74183,0x49c23940,0x5a255244,0x5a253921,0x18402080,0x28a01000,
-0x628528c0,0x18405223,0x41a16284,0x5a6483a9,0x416162a4,0x628472e6,0x940c5a42,0x7b498baa,0x940c7b69,0x8ba98beb,0x62638368,0x6ac7acaf,0x72e87308,0x838a6aa6,0x394072e6,0xd6346ae6,0xe675e697,0x41a0c590,0x52007304,0x8bcb62a2,0x5a0193e9,0x72e56aa3,0x62436283,0x6ac74160,0x6ac830e0,0x28c07b4a,0x7b275a23,0x8bab7b28,0x51e05a43,0x4a003940,0x49e049c0,0x62836aa3,
-0x290120e0,0x31402920,0x208120a0,0x08001862,0x10200800,0x08000800,0x08000820,0x294120c0,0x000039c4,0x18600000,0x39430800,0x41832901,0x29013942,0x39623942,0x20a02900,0x08000800,0x08201040,0x20e01880,0x5aa52940,0x42013180,0x31a02940,0x52c53180,0x29602140,0x39603160,0x31212920,0x316039a0,0x39c139a1,0x28e03120,0x28e028c0,0x18601840,0x28c03922,0x28c028a0,
-0x41413100,0x392162a7,0x28e02900,0x28e041a3,0x39823121,0x31013100,0x28c03121,0x39433942,0x41c52922,0x20a13984,0x41a33962,0x49e46ae8,0x52460800,0x31420800,0x20e04a25,0x10201040,0x5a4641a3,0x18a028e0,0x31642102,0x00000000,0x31442103,0x00001080,0x41c520c1,0x18602903,0x10810000,0x31233964,0x00001840,0x41c528c1,0x5aca39e7,0x736e5acc,0x738e6b4d,0x9cb36b2d,
-0xbdb6b596,0xa514bdb7,0xbd968c30,0xad35b576,0xbd97bd76,0xad55bdb7,0x31a68c51,0x00001882,0x00002924,0x18a10840,0x29231081,0x20a11860,0x208128c1,0x39223102,0x30e13122,0x41a33121,0x414149c3,0x7b0949c3,0x5a455a45,0x49e45205,0x6aa749e3,0x5a235a24,0x520351e2,0x49a23920,0x52035204,0x52027308,0x30e030c0,0x49c16a86,0x30e03940,0x51e35a24,0x41835225,0x6ac75a45,
-0x5a455a44,0x6ae86ac7,0x39601840,0x49c25a44,0x49a13120,0x62833920,0x31005a42,0x41815a43,0x8bca7328,0x93ca7b69,0x9c0a8388,0x72e78bc9,0x7b487b48,0x83696ac6,0x9c4a6285,0x93a872c3,0x62628345,0x6ae68b87,0x5a813100,0x8bea6b04,0x83657b45,0x6ae541a0,0x62a55a64,0x41a05a62,0x10005203,0x28c06ac6,0x62646aa5,0x628562a5,0x51e16ae5,0x6ac372e6,0x5a616ac3,0x6ac45a62,
-0x39813981,0x41c23120,0x20403920,0x49c13940,0x312151e5,0x41633961,0x632a3962,0x10200861,0x39631020,0x00002121,0x00000800,0x31820000,0x18a018c0,0x08001881,0x18803163,0x10802902,0x08211060,0x20e31061,0x20a03122,0x39c13180,0x298039a1,0x29404242,0x29403180,0x318031a0,0x29203161,0x21002940,0x39c031a0,0x314020a0,0x186041c1,0x62a74a04,0x49c43942,0x5a6728e1,
-0x49c441a3,0x49e428c0,0x39635a46,0x31011860,0x292028c0,0x20c020c0,0x5a4720c0,0x39243123,0x39c541e6,0x39e639c6,0x41e541e5,0x52874205,0x52674205,0x29222963,0x39845268,0x210241e5,0x39a239a2,0x18e118e1,0x18e24206,0x00000000,0x00001061,0x104118e3,0x49c63103,0x18613924,0x00000000,0x00002923,0x00000000,0x292218c1,0x4a894a07,0x6b4d5acb,0x62ec630c,0x8c10630c,
-0xbdb6ad54,0x9492b596,0xa5149472,0xc5d7a514,0xb596c618,0xc5f7bdd7,0x20e39cb2,0x00000000,0x00000000,0x08400000,0x08200800,0x10401061,0x49e63984,0x20a020c2,0x62a83122,0x39625205,0x498359c4,0x628628e0,0x5a454140,0x5a475246,0x41623963,0x49c251e3,0x62865a45,0x41a141a2,0x52235224,0x5a435a41,0x41a0836a,0x5a017b27,0x49a14161,0x51c34140,0x624649a2,0x62a54a02,
-0x10201020,0x31220000,0x31003141,0x9c6c6ac6,0x6b243100,0x49c05a82,0x41625a63,0x62835200,0x834851e1,0x93eb8369,0x73069c2c,0x6ac47303,0x7b6872c5,0x6ae67327,0x73068368,0x7b059c2b,0x7b057b05,0x9c2a83a8,0x62a26ac3,0xbd90942b,0x7b666ac4,0x5a6462a4,0x5a85838a,0x49a183a7,0x520528c0,0x5a464182,0x6aa61840,0x5a236265,0x5a236a85,0x72e772e7,0x41806282,0x730630e0,
-0x52045a66,0x4a045a86,0x30e14162,0x20a03102,0x39621820,0x28c05a66,0x00001880,0x00200000,0x00000000,0x00000000,0x18e22902,0x08002102,0x20c00000,0x316139c2,0x39823982,0x000020c0,0x08000800,0x00000800,0x08400000,0x39a139c1,0x298039c1,0x21202980,0x31803180,0x31803160,0x318039c0,0x31802920,0x29202940,0x6ae741c3,0x9c6e28e0,0x5a466287,0x41a44183,0x6ae96287,
-0x30e141a3,0x5a465a67,0x41835246,0x20a05226,0x20e03942,0x39a43163,0x522641e5,0x4a075227,0x316441e6,0x39a54227,0x52674a46,0x4a265ac8,0x52684a26,0x20c10860,0x29432943,0x39c53164,0x41c42901,0x000039c5,0x10812963,0x00000000,0x00000000,0x00000020,0x10000000,0x00000800,0x00000000,0x00000000,0x00000000,0x31643184,0x528941e7,0x5aec5acb,0x5acb528a,0x6b0c526a,
-0xbdb6ad34,0x9492b596,0xa514ad34,0xbdb7a514,0xbdb6bdd7,0xb595bdd7,0x00008c50,0x08200000,0x00000000,0x31440000,0x08201060,0x00000000,0x18600800,0x18600000,0x52053101,0x522641a3,0x310149a3,0x28e01020,0x49c351c3,0x41842901,0x41634184,0x5a445224,0x6ae849c3,0x522483ab,0x62855224,0x628462a3,0x7327a46d,0x49a16ac3,0x62848368,0x49a26a85,0x28c030e0,0x41636266,
-0x20801000,0x080028c0,0x20800000,0x28e02080,0x41c03961,0x5a6249e0,0x9c2b6ac4,0x49c02080,0x6aa56263,0x7b276244,0xa44d6264,0x7b268348,0x6ac56aa4,0x8ba97306,0x7b676ac5,0x93e96ae6,0x7b058b66,0x7b4649c0,0x6ac48387,0x62844a01,0x7b467326,0x522283a8,0x31003940,0x102049c3,0xa48f5202,0x83497b49,0x73083100,0x6aa549a3,0x51e251c2,0x628462a5,0x628462a3,0x39605201,
-0x08003964,0x28e00800,0x186120c1,0x31201000,0x310128c0,0x10000800,0x20c041e4,0x20821060,0x292020a1,0x00000820,0x00001041,0x10600001,0x314241c3,0x292141c3,0x31602900,0x28e02920,0x41a028c0,0x31203981,0x49e339a1,0x39a13160,0x214041e2,0x29402980,0x29602120,0x296031a1,0x31812920,0x31803180,0x20c02100,0x29003981,0x39633102,0x10200800,0x49c428e0,0x41a45246,
-0x418341a3,0x31423963,0x396349e5,0x31214183,0x39843142,0x41e63985,0x52875247,0x42075288,0x39a55248,0x528839c5,0x41e541e5,0x52665aa8,0x29233163,0x41e531a4,0x316341e6,0x31840840,0x422639c4,0x41e62943,0x18a11080,0x000041e7,0x00000000,0x00000000,0x10410820,0x30c11800,0x00001082,0x00410000,0x08200800,0x41e620c1,0x4a4839a6,0x5acb630c,0x4a6a5acb,0x83af39c7,
-0xbdb6a4f3,0xa514c618,0xc618ad55,0x9472ad34,0xbdb7b575,0xa513a514,0x292462eb,0x00200840,0x08410841,0x10810881,0x31430820,0x292318a0,0x5a680820,0x28c039a5,0x52053983,0x104041a4,0x082039a3,0x31212922,0x28c030e0,0x39435a67,0x18803102,0x41a249e4,0x49e46ac7,0xa48e49c5,0x52235204,0x5a435a23,0x7b6762a4,0xac8e7b28,0x52013920,0x83476a84,0x41806264,0x41a35a45,
-0x49c230e0,0x416251c5,0x49c27b2a,0x314141a2,0x31606b05,0x49e05a62,0x7b256ac4,0x6ae55220,0x5a2272e3,0x5a025a22,0x5a248bc9,0x834893aa,0x5a4372e5,0x5a436ac5,0x6ac66283,0x5a8462c7,0x51e051c0,0x732549e0,0x6aa4a48c,0x31403980,0x73074a01,0x20c041c0,0x6a846aa5,0x9c2cb52f,0x93ecbd2f,0x8389838a,0x83696ac6,0x72e67b49,0x39003920,0x394049e1,0x62a462a3,0x30e05222,
-0x41c320c0,0x312149a3,0x20a03140,0x18803121,0x20801860,0x312228e2,0x31613983,0x20c020e0,0x31013963,0x08203162,0x08000000,0x290149e5,0x18800800,0x39841040,0x20e00000,0x21203161,0x29602940,0x31403160,0x29013180,0x00000000,0x000020c2,0x20e10000,0x20e02960,0x29201880,0x29202920,0x10603180,0x18802900,0x10403142,0x41a40800,0x5a6549c4,0x39825224,0x52263121,
-0x41c449c4,0x49c449e5,0x314141a3,0x418241c3,0x29024a04,0x41c63964,0x41c54206,0x4a265aa8,0x292341e5,0x39c539e6,0x528739a5,0x528739c3,0x18a04205,0x39a52943,0x420539c5,0x20a03983,0x29623142,0x29434206,0x29640000,0x18a23164,0x00000000,0x10800000,0x20801020,0x30a22880,0x10602081,0x000020c2,0x10611861,0x318539c5,0x526839e6,0x5acb62ec,0x4a286b2c,0x8c0f39a6,
-0xb575ad13,0xc5f7bdd6,0xc5f7a514,0xa4f38c71,0xb5969cb2,0x94919471,0x18c35aaa,0x00000020,0x084118c2,0x10801061,0x39a50000,0x10400820,0x10203143,0x41634184,0x520649a4,0x39a43101,0x6ae90000,0x396420c2,0x080049e4,0x39636287,0x41833922,0x52253962,0x39425a26,0x39614182,0x628651e4,0x6ac65224,0x62a449e1,0x8beb7b47,0x7b47942b,0x93ea72e6,0x5a447307,0x7b4962a6,
-0x73085225,0x20803941,0x100049c3,0x186041a2,0x31209c4c,0x398028e0,0x62a349a0,0x5a2272e4,0x6a855a20,0x5a035a02,0x62856aa5,0xa46e6aa6,0x8ba88baa,0x5a636283,0x62a451e1,0x52236ac6,0x5a4249e1,0x730541a0,0x940b7325,0x4a027305,0x62c641a1,0xa48f6ae7,0x7306b50f,0x7b076aa3,0x93ec8389,0x7b277306,0x8b698baa,0x7b067306,0x83687b47,0x6ac54180,0x5a627b46,0x62a362a3,
-0x31023963,0x310128c0,0x310049e3,0x41a13981,0x292039a0,0x39613981,0x10402900,0x39622100,0x39823982,0x39414183,0x18402080,0x20e018a0,0x102018a0,0x18a02902,0x296020e0,0x31a131a0,0x29603180,0x31a03180,0x20e03180,0x39603980,0x20e03120,0x000018a0,0x292018a0,0x420239a1,0x29202920,0x00002901,0x08000000,0x00000000,0x396239e3,0x18602080,0x290041c2,0x28c03122,
-0x49e64184,0x49c45a46,0x49c41880,0x398241a3,0x31634183,0x41e65247,0x4a274a47,0x4a065247,0x41c539c5,0x29430000,0x318339c5,0x41e439c3,0x29423162,0x21210820,0x31822942,0x28e039c3,0x52863162,0x10a10000,0x29430020,0x08402964,0x21023164,0x31841060,0x28e10000,0x28c01000,0x314130c0,0x28c03121,0x28e11000,0x42072923,0x42273185,0x6b4d5aab,0x5acb6b4d,0x83ef6b0b,
-0xb575b555,0xbdb6ad54,0xb595ce38,0x9cb3a513,0xce3883ef,0x8c309492,0x4a28630b,0x000039a5,0x08200000,0x08410000,0x10810000,0x08000000,0x18401060,0x100049e5,0x49c46267,0x52473101,0x39635247,0x31221060,0x39825a07,0x28c03983,0x31213121,0x4a0549c4,0x39613941,0x41813121,0x520349c4,0x314049e1,0x5a426ac6,0x49e15a43,0x20c01000,0x080020a0,0x7b6b1020,0x20c00800,
-0x31001000,0x52456266,0x8bec3141,0x00000800,0x52434a25,0x100020a0,0x49e1bd31,0x62837304,0x49815200,0x6a8551e1,0x72e76244,0x6aa65a24,0x6ae493eb,0x52016262,0x52016aa4,0x4a023980,0x62836263,0x7b665220,0x628583a8,0x39a049c0,0x314249c3,0x93cb6285,0x83888369,0x72a472c4,0x73086ac4,0x6ac672e7,0x8b8a8b8a,0x83678b89,0x7b277b27,0x6ac47b47,0x52226283,0x49e06284,
-0x39421860,0x5a6528e1,0x41a249e3,0x396041c0,0x41c13961,0x31605244,0x39a12920,0x39603160,0x31203120,0x39613981,0x290041a2,0x08002900,0x10801882,0x29402940,0x31803160,0x212039c0,0x29403160,0x31a02940,0x29201880,0x31802940,0x39a13160,0x29402100,0x29402940,0x31801080,0x29202940,0x29222900,0x080118a1,0x39641860,0x18800000,0x10200800,0x41e33122,0x10600000,
-0x418428c0,0x41a23942,0x4a0441a3,0x39825244,0x4a0649e3,0x316441e6,0x4a4739c5,0x39c55288,0x106039a4,0x294220e1,0x41e42922,0x318320e0,0x31834a47,0x39c40840,0x4a053183,0x49e441c4,0x4a254182,0x08200000,0x00000000,0x08000020,0x29450000,0x08000800,0x39c131a0,0x41e062e4,0x31405aa3,0x49e141a1,0x396049e2,0x4a2751e6,0x4a0739a6,0x7bcf5249,0x7bae630c,0xad3462eb,
-0xb575b575,0xbdb6ad14,0xb575ce38,0x9c92c5d7,0xad559471,0x8c10a4f3,0x41e5630a,0x28e21860,0x00206b4d,0x4a270000,0x31640000,0x31640000,0x39643983,0x41621840,0x28e13942,0x39623121,0x31026ac9,0x41843943,0x51e55226,0x49c36288,0x5a4641a3,0x5a455a25,0x62866266,0x72e85225,0x62a662a6,0x52045204,0x39606ac6,0x39403960,0x000049e3,0x314149e3,0x41845246,0x000018a0,
-0x5a874203,0x29003984,0x18400000,0x20a03961,0x93ed838a,0x41613100,0x732820a0,0x49e05a23,0x52005a61,0x838a51e4,0x5a258389,0x520549c2,0x8bcc49c3,0x62417306,0x522249c1,0x08405243,0x08000800,0x62a628e1,0x83893940,0x62c33120,0x49c16284,0x72856245,0x8327a46d,0x9c4d7b47,0x6ac57b47,0x6ae67306,0x7b287b49,0x6a858368,0x7b077b27,0x62837b48,0x72e56263,0x6ae45240,
-0x20800000,0x398128c0,0x524341c1,0x39603100,0x31604a01,0x39c03140,0x526339c0,0x316039a0,0x29602960,0x29204202,0x318039c0,0x29802980,0x39c02980,0x294031a0,0x31a03180,0x39e031a0,0x39a131a0,0x18a02940,0x18a03142,0x31604202,0x39c22920,0x29403140,0x29202920,0x29202940,0x39802940,0x316041e1,0x29212940,0x42043980,0x00000000,0x08603120,0x31230000,0x20c03143,
-0x41624163,0x49e54184,0x39833102,0x49c441c3,0x20e149e5,0x39c539e6,0x4a2539c5,0x31834a25,0x18a10000,0x29432903,0x39a34a26,0x31832920,0x29422101,0x10802101,0x736cb573,0x10601060,0x000018a1,0x10600820,0x00002103,0x00000820,0x29200000,0x62c34200,0x62e262e1,0x41c05240,0x39a05aa3,0x41806ac5,0x5a8349c3,0x41a35a45,0x4a2649e5,0x736d734c,0x630b6b2c,0xb5556b0c,
-0xbd96ad14,0xc5f7bdb6,0xad34bdb6,0x8c309c92,0xa514a4f3,0x94509492,0x08206b2b,0x00000820,0x00000000,0x31830820,0x10620000,0x00000801,0x20a01880,0x51e43101,0x10201840,0x28e03141,0x416228c0,0x20c05245,0x520449c4,0x39625a45,0x49c349c3,0x49e249c2,0x52245a44,0x62865204,0x418249e3,0x6ae76287,0x62a45223,0x6ae64a02,0x39613120,0x31033983,0x18401020,0x08203983,
-0x00005247,0x29010000,0x188039a3,0x62a76ac7,0x628628e0,0x52043940,0x416183aa,0x398062c8,0x49e05200,0x49c141a0,0x312028e0,0x49e23961,0x62a66285,0x6a647b48,0x6a866284,0x00003960,0x00000000,0x00000000,0x62c60820,0x7b685284,0x28e03960,0x9c0a7b27,0x83268368,0x7b286ac4,0x6ac56ac3,0x9c4c7b49,0x7b286285,0x72e57b27,0x834772e5,0x7b0872e6,0x6aa57b28,0x8ba97b68,
-0x29426b4a,0x41a241a2,0x18401860,0x41c33941,0x4a235204,0x318039a1,0x212039c0,0x29603180,0x29603180,0x31a02140,0x31a03a01,0x29603a01,0x298031c0,0x318039e0,0x292031a0,0x29202100,0x21002120,0x39a30860,0x18a020c0,0x29202920,0x29402920,0x31802961,0x29603180,0x29602940,0x29412940,0x29403140,0x210039c1,0x41e318c2,0x10201020,0x4a254a04,0x08200800,0x08200820,
-0x31213942,0x39a441e5,0x4a063184,0x398539a4,0x00000000,0x00000020,0x41c431a3,0x41c42921,0x00000000,0x31651081,0x08201060,0x08202941,0x000018a1,0x00002941,0x314439a4,0x00000840,0x08400000,0x00002924,0x398641e4,0x39843164,0x298039a0,0x31a010c0,0x39e04220,0x4a404a40,0x41e039a0,0x31603980,0x418049c0,0x5a8549c2,0x52465225,0x6b2c736c,0x62eb7bce,0xc5d68c50,
-0xad13ad34,0xbdd6b575,0xb554c5f7,0x736c9471,0xa4f39470,0xad139470,0x318483ee,0x00000820,0x00000000,0x39a03980,0x526139a0,0x20e21860,0x18604a27,0x10001840,0x20c20800,0x41c23103,0x41c33121,0x49e43962,0x49c328a0,0x39413941,0x51e46265,0x392049c2,0x62636263,0x62855223,0x5a656286,0x522562a8,0x5a635a84,0x628341a0,0x62845201,0x18001840,0x00000840,0x49e27308,
-0x41835a42,0x31231020,0x10004165,0x18603982,0x730720c0,0x5a445223,0x28e07b2a,0x08610800,0x522330e0,0x184162a1,0x49e241c1,0x1840bd52,0x73075a42,0x62656aa6,0x628551e2,0x10208c0b,0x10401040,0x18401021,0x000020c0,0x6ac541c5,0x3920940b,0x6ac4836a,0x62627ae6,0x51e049c0,0x7b477b27,0x62a57b46,0x942b6283,0x72857b47,0x8beb6ac4,0x83456ac3,0x7b4872e6,0x8bca940c,
-0x31413982,0x20a041a3,0x31004182,0x49e33120,0x31403981,0x29203981,0x29602940,0x31802960,0x42024201,0x29802960,0x31a031c0,0x31a031a0,0x39e031a0,0x39c131a0,0x31a018e0,0x39c02960,0x31a039c0,0x39e031a0,0x39c239e1,0x29203161,0x29604202,0x31a02100,0x29203180,0x29403180,0x31a02120,0x10802100,0x20e20000,0x41e310a1,0x20a03980,0x08203122,0x18a22925,0x08400000,
-0x00000000,0x08200820,0x41e61040,0x29030000,0x00001020,0x000020e2,0x00000000,0x00000020,0x41e60000,0x08402944,0x52870000,0x20e239e4,0x00001060,0x29423163,0x08201080,0x29022903,0x20e30840,0x10a20001,0x00000820,0x39a01080,0x21405ac2,0x3a0031e0,0x3a003a00,0x39c04a20,0x41e039c0,0x5a8141e0,0x6ac349e0,0x62a55a42,0x5a8662c6,0x6b2b6b0a,0x62ea83ce,0xb5759c91,
-0xb575c5f6,0xbd95a4d2,0xb575ce38,0x62eb9470,0x9c917b8d,0xa4d28c2f,0x39c58c2f,0x20a01040,0x102020a0,0x39a04a00,0x5ac17363,0x63004a20,0x31406b03,0x28a028e0,0x00001040,0x31413101,0x28e028c0,0x8bcc1840,0x49e43942,0x206041a3,0x520351e4,0x392049c2,0x83876263,0x49a16263,0x5a2493eb,0x5a445a44,0x62845a43,0x524249a0,0x62a53980,0x5aa162a2,0x5a626ae5,0x5a6349e1,
-0x08005a23,0x41a320c0,0x7329732a,0x6ae82901,0x62856ac7,0x49a251e3,0x30c05203,0x080041a2,0x00000000,0x8be818e1,0x208020c0,0x93ec2900,0x7307838b,0x62657307,0x41616aa5,0x52245222,0x6b0883ab,0x10207b69,0x20801000,0x08000000,0x18a01080,0x6aa43960,0x72e472a4,0x6ac46262,0x83696aa5,0x7b48836a,0x83aa5a63,0x6a859c2c,0x93ec8367,0x7ae5acae,0x83878b88,0x9c2c940c,
-0x392028a0,0x41a341a2,0x41c23961,0x314028e0,0x39813100,0x31813160,0x29413160,0x31802920,0x29602120,0x21402980,0x31e04a62,0x296039e1,0x31c039e1,0x29602960,0x316039c1,0x39e10000,0x318118c0,0x29202120,0x10a02140,0x31603140,0x39e039a1,0x31a02940,0x31a12960,0x18e02940,0x21002101,0x31a32140,0x21220880,0x420152a5,0x00000000,0x00001020,0x10a20000,0x00002944,
-0x08200000,0x10410800,0x00000820,0x29232903,0x29440000,0x00000000,0x10400000,0x290141e4,0x10a11080,0x00000000,0x210141e6,0x000018e0,0x00001080,0x18c00020,0x10405267,0x08001040,0x00000820,0x31831080,0x39a50000,0x41e139e1,0x3a214a41,0x3a003a00,0x4a816323,0x420041e0,0x52405260,0x73056262,0x72e66ac4,0x62c56285,0x6ae762c6,0x6b0b6b2a,0x83ce9470,0x9450738d,
-0xad13bdd6,0xbd95bdb5,0xad13ce38,0x83ce83ef,0xa4f383ef,0x945083ee,0x52889490,0x62853940,0x31405202,0x39a03980,0x5aa25261,0x52205aa0,0x52805a60,0x41c04a20,0x21015243,0x18805205,0x62c728c0,0x100049a3,0x49c33921,0x39203921,0x418030e0,0x208049c3,0x6ac47b27,0x730672e5,0x6a856244,0x41404960,0x49c02860,0x5a424180,0x41c05242,0x52015a83,0x5a8262c4,0x49c05aa1,
-0x41a049c0,0x5a644a40,0x20a020c0,0x39613101,0x08005225,0x52043921,0x30e07b09,0x28e03100,0x08001040,0x08011040,0x732739c0,0x7b677b47,0x184051e3,0x41825203,0x6ac65a23,0x49c249c1,0x41815224,0x62c55242,0x31425a85,0x28a02060,0x5a4549a1,0x49805a62,0x62424140,0x72e472e4,0x73054180,0x8bcb836a,0x9c6d8bea,0x72a5a46d,0x93ec8367,0x51e072c6,0xa44a3100,0x93ea8369,
-0x39615224,0x31004181,0x41a039a0,0x294041e2,0x21002920,0x31602940,0x39c13160,0x29604a02,0x31803160,0x29802980,0x29602120,0x29602960,0x29802980,0x29802960,0x31802980,0x31802960,0x31803180,0x21202940,0x29402921,0x29402100,0x29402940,0x29603180,0x31a02940,0x29203180,0x31802120,0x31803180,0x29801900,0x4a634a62,0x00000020,0x08200000,0x08000000,0x29030000,
-0x00001082,0x10400000,0x18a20000,0x10402103,0x082039a5,0x39c539a4,0x6b2b39c5,0x39a520e2,0x00000000,0x00000000,0x10600820,0x084018a0,0x21441061,0x00000020,0x20a30000,0x10400820,0x42235aa6,0x10a02960,0x42004a21,0x31e04240,0x298029a0,0x4a406303,0x4a405aa1,0x4a204a20,0x4a0041c0,0x73046260,0x73057305,0x73267307,0x62a66ac6,0x6b4b6ac7,0x738c83ed,0x7b8c732b,
-0xad13a4b1,0xad13ad33,0xa4d2bd95,0x8c0e9491,0xa4f283ee,0x94518c4f,0x6b2a8c2f,0x396049c2,0x49e141a0,0x62c43980,0x62a249e0,0x41c05a82,0x5ac12960,0x63035261,0x4a404a20,0x31a039e0,0x20e02940,0x18a11882,0x52671080,0x39a33142,0x28e03941,0x49c349a3,0x41c01840,0x5a636284,0x5a033100,0x62234981,0x626451c1,0x392049a1,0x4a0139a0,0x41c05221,0x31203960,0x41c041c0,
-0x522149e0,0x41a03980,0x5a6241a0,0x8bc95a43,0x39405203,0x39004140,0x49a10800,0x20803920,0x206028a0,0x52235224,0x62a36ae4,0x62836ac5,0x942cb4ee,0x52023940,0x52035a43,0x49c26ac6,0x49c06aa4,0x628441a0,0x49a062c3,0x52638ba6,0x30e05a62,0x5a635202,0x62836262,0x6a825a21,0x51c16263,0x6aa54980,0x838a9c4d,0x9c2a7b48,0x7b078366,0x41407b04,0x00004982,0x6ae68387,
-0x49c35204,0x41a03960,0x31203960,0x31602920,0x318120e0,0x31603160,0x29403160,0x29602940,0x31a03180,0x29602100,0x31a12980,0x31a12980,0x31c12140,0x31c031a0,0x31802960,0x318131a0,0x18e02940,0x29402960,0x29403161,0x21202940,0x31a02100,0x318018e0,0x3a003180,0x318031a0,0x42012960,0x3a004200,0x42012940,0x00000880,0x0820632b,0x00000000,0x18c20820,0x000020c2,
-0x00000020,0x00000000,0x10820000,0x188218c2,0x00000000,0x42062922,0x18a018c1,0x00001080,0x00000000,0x41e418a0,0x08200821,0x106018c1,0x000020e2,0x10820020,0x00000000,0x52a40000,0x31606284,0x29602940,0x3a004a60,0x19403200,0x29602980,0x398039c0,0x5a605a60,0x5a807342,0xa46a8bc5,0x72e49408,0x52006281,0x6ac46ae5,0x62a66ac6,0x738b62a6,0x736b6b2a,0x736b6b09,
-0xacd28bee,0xb5948c0f,0xb574a4d2,0x83eea4d2,0xad13a4d2,0x9450a4f2,0x62e99470,0x49e05a43,0x41a05222,0x49e04a01,0x522249e0,0x08003100,0x31010800,0x316041c2,0x4a204a20,0x5b026303,0x52a252a1,0x08605ae6,0x296310a0,0x83ed0020,0x52064184,0x20a01000,0x41a349c3,0x62843920,0x5a0249e1,0x5a036a64,0x49816223,0x7b4851a2,0x5a8328e0,0x39605a83,0x52217326,0x49e07b66,
-0x4a0141c0,0x5a6283a7,0x49c041c0,0x7b683120,0x838a3940,0x49c341a2,0x59e26ac6,0x52025223,0x6ae33900,0x52016aa3,0x6ac37b26,0x62635a41,0x396049a1,0x62a362a5,0x6ac65a43,0x730762a6,0x6ac449c1,0x08205a62,0x31400000,0x73057345,0x6ae46281,0x5a4249c0,0x51e15a22,0x626351e1,0x730672c6,0x73067b45,0x41627b48,0x8b697b47,0x93c87b25,0x5a007b05,0x41802060,0x7b675243,
-0x49e24181,0x522328e0,0x39813120,0x42023180,0x42232120,0x41e231a1,0x29401080,0x296010a0,0x29203180,0x29602960,0x29802980,0x31a02140,0x296031a0,0x31a02140,0x21402980,0x21212960,0x21602140,0x31602960,0x29402120,0x31603180,0x39a03180,0x31604a21,0x524139c0,0x41a049e1,0x39a039c0,0x52824221,0x31614a41,0x18a10000,0x000020e2,0x000020e1,0x31850000,0x18a10820,
-0x29640860,0x00000000,0x00000000,0x00000800,0x29430000,0x18c118a1,0x18c11080,0x08402943,0x4a4018c0,0x42054a40,0x00000000,0x00000000,0x00000000,0x00000000,0x52633182,0x29605222,0x39e03180,0x4a814200,0x31e039e0,0x39e02180,0x52804aa2,0x6a806ae2,0x9c0593c4,0xbd09bce9,0x8ba4a487,0x7b248b85,0x62627b25,0x6aa451e0,0x62a56ac7,0x6b2a62a7,0x6b2a62c8,0x7b8b5aa8,
-0x940e8bee,0xb5749450,0xc5d5a4b1,0xb574bd74,0x94509c91,0x736cad53,0x5a25734b,0x416049c2,0x31403940,0x49c041c0,0x52216aa4,0x082049e0,0x31420800,0x00000000,0x420539a4,0x5b002980,0x52a14240,0x39a041c0,0x4a633980,0x00000020,0x18401881,0x00001020,0x20c018a0,0x208049e4,0x28e049a1,0x6a846a64,0x5a036a84,0x9c0b6243,0x39805201,0x39602920,0x522520a0,0x522262a4,
-0x290062e4,0x49e13960,0x29003960,0x5a856b08,0x6aa70000,0x28e03100,0x72e76a85,0x41803100,0x49c049c2,0x62837303,0x7b4649e0,0x62a36262,0x31405222,0x52215a62,0x39604a01,0x62a549c1,0x49e05222,0x5aa24a00,0x7b657324,0x73455221,0x62e45a84,0x62835201,0x41805a01,0x72e56283,0x52028389,0x8b897b46,0x72a58baa,0xac6d8b89,0x8b896242,0x49a093e9,0x49803100,0x31201860,
-0x41a13120,0x522441c2,0x39603160,0x29602960,0x29202960,0x39803180,0x31803161,0x296031a1,0x31a03180,0x29602980,0x214031a0,0x298031c0,0x29602940,0x31a02960,0x29603a21,0x318031a0,0x31802940,0x29804221,0x31a02960,0x39c039a0,0x318039c0,0x314041e0,0x41c05262,0x41a04a01,0x4a414200,0x312041e0,0x20e03181,0x08001040,0x39a320e1,0x18c11080,0x39c53143,0x736c0000,
-0x08400000,0x00000820,0x08200000,0x08200000,0x00000000,0x00000000,0x08600000,0x108018a0,0x3a004a82,0x00003a01,0x000018c1,0x00000840,0x29230000,0x29202101,0x49e04a21,0x29805a21,0x3a4029a0,0x21603a20,0x31a031c0,0x39c04a20,0x62c14220,0x93c69406,0xa426a467,0xcdadcdad,0x51a1f6d5,0x62615a00,0x62826282,0x62636262,0x5aa56b08,0x736b62a7,0x83ed734a,0x7bac83ed,
-0x9c70940f,0xc5d6bd95,0xbd95a4b1,0xad539470,0x9c918c0f,0x83ee8c4f,0x62a66ae9,0x49e05a42,0x4a0041a0,0x41a05242,0x41804140,0x41805a41,0x396051e1,0x30e05222,0x10a07327,0x31610820,0x5a6239c0,0x4a204a20,0x4a405280,0x39825261,0x00000840,0x29440840,0x10801081,0x10200000,0x49a128a0,0x62236a64,0x51e15a03,0x7ae67b07,0x39a05201,0x4a0139a0,0x18e04200,0x20c041e0,
-0x100020a1,0x29400000,0x00001040,0x00000820,0x628428e0,0x6ac641a0,0x51c13920,0x83a85a44,0x39202060,0x5a815a41,0x20805201,0x732741a0,0x62a362c4,0x4a015201,0x312041a0,0x520349c1,0x73676b06,0x734641e1,0x62c4b54e,0x83c749c0,0x6b0418a0,0x6ae46283,0x62828366,0x62436283,0x7b286264,0x7b483920,0x83276b06,0x832893a9,0x8b8972c4,0x52007b47,0x7b2551e0,0x6ac49409,
-0x41a13980,0x29402940,0x21401900,0x296031a1,0x29602980,0x296031a0,0x39c131a0,0x296018e0,0x214031a0,0x29802980,0x296031a0,0x31804201,0x31a018c0,0x29803180,0x4a6231c0,0x39c04220,0x4a204200,0x42004a41,0x39c04200,0x42004a41,0x41a13180,0x29003980,0x318041e1,0x39c13180,0x39c03160,0x20e04202,0x00000820,0x20c00000,0x00205245,0x00000000,0x18a218e2,0x39a54a07,
-0x00001060,0x10616b4b,0x08400020,0x00000000,0x00002122,0x00000000,0x00000821,0x21800000,0x00400060,0x00000020,0x190018c0,0x4a422180,0x42404220,0x5aa14a61,0x31805241,0x21204200,0x426031a0,0x420041e0,0x5a605a81,0xb54c83a4,0x93c9accd,0x72c2a46a,0x41607b44,0x6aa172e4,0x62826ac3,0x5a2049a0,0x59e05a01,0x5a236221,0x62866285,0x6ae77329,0x942e5a66,0xbd749c91,
-0x9c91a513,0xce38c5f7,0x9c919470,0x9c91942f,0x9450bd74,0x8c0e83ee,0x5a426ae9,0x52213960,0x394049c0,0x39403940,0x31002880,0x49a04180,0x520151c1,0x49c149e0,0x6a845a43,0x628362a5,0x41c120c0,0x41c041a0,0x946b4200,0x39c039a0,0x31622100,0x00000000,0x00000000,0x08200800,0x082039a5,0x626620a0,0x41616245,0x38e05204,0x49e05a42,0x398041c0,0x52434a22,0x52632900,
-0x5aa239a0,0x4a425243,0x524239c0,0x52400800,0x184028c0,0x942b3961,0x51e24160,0x49c06ac6,0x7b0562a4,0x49c06a83,0x41c14180,0x62a35a63,0x52215200,0x290041a0,0x396041a1,0x73071020,0x73076aa5,0x5203a48c,0x73058368,0x83a77b46,0x83c84a21,0x73046282,0x5a416ac3,0x6ac56264,0xa44e5204,0x7b896263,0x73067328,0x83267b28,0x7ae58347,0x7b256aa3,0x6ac47b67,0x7b466283,
-0x29002100,0x31603180,0x21402140,0x29802140,0x29802960,0x296031c1,0x31a131a1,0x29602960,0x29602980,0x298018c0,0x21202940,0x31802940,0x31a02960,0x29403180,0x39e23a01,0x42012120,0x39c04201,0x31603180,0x31803180,0x08201080,0x28e018a0,0x10001000,0x18a03121,0x08001060,0x21001040,0x29402941,0x108018c0,0x29001060,0x39a03180,0x4a4341e2,0x08401880,0x41e50820,
-0x4a275267,0x08000000,0x18a020c1,0x29221080,0x10603163,0x20c12923,0x42021080,0x21403182,0x29a03a02,0x18e00840,0x31c039c0,0x298029c0,0x31a029c0,0x4a004200,0x4a005a82,0x94495220,0xb4cbbd0d,0xb4ecbd0c,0x93c8a46b,0x83869c49,0x72e272e1,0x62606aa1,0x52006240,0x5a005a20,0x49e05a40,0x49c049a0,0x5a2151e0,0x5a4351c0,0x5a4449c2,0x62a76b09,0x8bee730a,0xb5339c91,
-0xbdb6ce17,0xc5f6c5f6,0x94509cb1,0x83ad9470,0x9c91acf2,0x8c2f7bad,0x5a647b8d,0x394041a1,0x39403100,0x41602080,0x28c03100,0x30c04141,0x30e02880,0x49e03920,0x49c03960,0x62c45a64,0x5a437324,0x08003922,0x29204a23,0x52a15ae2,0x41e06b24,0x00006b66,0x00000000,0x00000000,0x312320e2,0x20800000,0x28a04180,0x28c03900,0x41a151e2,0x49e01880,0x6b065262,0x39805aa2,
-0x62e339a0,0x4a625ac4,0x62a34a41,0x41e13980,0x5a445263,0x31005a44,0x39004982,0x62a530e1,0x7305944b,0x49a04160,0x62816261,0x31005221,0x62a249e0,0x49e15a82,0x6ae55241,0x28e05a43,0x49e15a41,0x7b4949a1,0x52225a42,0x6b0549c1,0x4a015262,0x7b6783a7,0x73267366,0x62a56283,0x62866b06,0x18a020c0,0x944c7baa,0x6a845a45,0x8b6872e6,0x62629c0a,0x7b265221,0x6ae26ae4,
-0x21202120,0x21202960,0x29602960,0x29602120,0x29802980,0x20e12941,0x212118a1,0x31a03a00,0x29402960,0x31a02160,0x29402100,0x31c131a0,0x21212102,0x000018e1,0x00200840,0x19000040,0x10802940,0x29212943,0x31a02100,0x31802920,0x4a4239c0,0x31804a21,0x29002100,0x5ac22920,0x20c139a0,0x08003982,0x08200001,0x5a870000,0x39c04a41,0x314039c0,0x00003962,0x00003145,
-0x00004a26,0x39e60840,0x5a875267,0x528118c0,0x4a005aa3,0x5aa05a62,0x4a204a20,0x4a204200,0x52405220,0x3a0041e0,0x31e04280,0x19401920,0x5a812981,0xb52d41c0,0x9c4a9c6a,0xa48aa46a,0xac8ba46a,0x93e9a42a,0x93c78366,0x8b868ba7,0x7b476a84,0x83868bc8,0x62a28386,0x6aa472e5,0x73068ba8,0x62646a85,0x62848388,0x7b896264,0x52043981,0x62e87329,0x8c0f62c8,0xa4d283ee,
-0xb554ad13,0xce17bd74,0x8c2fc5f6,0xa4d1b533,0x8c2f9470,0x949183ee,0x6ac783ed,0x7b265a22,0x7329836a,0x62c57307,0x49605242,0x49a06a84,0x498151c1,0x394328c0,0x312020a0,0x39613121,0x524249c1,0x62854a01,0x08205a61,0x5ac641c2,0x39c04240,0x63075ae3,0x00002921,0x00000000,0x08400000,0x000020c0,0x28c00000,0x20a03960,0x39203942,0x310030e0,0x6b235a43,0x4a204a21,
-0x18e01900,0x31c06b86,0x39c04220,0x39a05ac2,0x4a0052a3,0x39802920,0x62843940,0x49c15a65,0x30e049c2,0x39203120,0x62a35a23,0x5a2041a0,0x5a4149c0,0x51e13940,0x62a55a62,0x72e78389,0x62857307,0x6ac78389,0x5a446286,0x41804160,0x52c15243,0x4a405b02,0x83a78c27,0x7b6762a3,0x62a55240,0x210039a0,0x31612940,0x62868beb,0x72e87b09,0x7b466aa3,0x8b8851e1,0x62a37b46,
-0x39a139e2,0x29203180,0x29602940,0x31a12100,0x29602960,0x5ae52960,0x21202961,0x29600000,0x29603180,0x31a039c3,0x210039c1,0x21010000,0x10800000,0x18a02121,0x08200000,0x00000000,0x10601061,0x10400800,0x00001021,0x4a213160,0x41e04a21,0x39a03180,0x31a03160,0x39a03180,0x41e139a0,0x420139c0,0x20c04202,0x5ac62920,0x39a20800,0x31204220,0x41e239a1,0x4a244a03,
-0x29205285,0x10400820,0x104020c1,0x49e10000,0x626249e0,0x72c283a6,0x83467b03,0x498072c4,0xacaa93e8,0xb50c9be7,0x41c03940,0x8be662a1,0xa4acb52b,0xa48ba48c,0x9c2a9c4a,0x93e79c29,0x8ba78b87,0x8ba59c07,0x8b868b86,0x72e48345,0x7b259be9,0x49818346,0x30c030c0,0x51e13940,0x390051e1,0x8b894140,0x39203940,0x5a6549a1,0x52452900,0x5a876ae9,0x732b5226,0x8c2f8c0f,
-0xacf2ad13,0xd658bd94,0xb554bd74,0x7b8cad33,0x83ce7b8c,0xa5129490,0x20a05246,0x5a452060,0x52035a44,0x83894182,0x62635223,0x28a06283,0x62861840,0x310149e4,0x188028c0,0x31211840,0x28c03100,0x6ae63120,0x62a562a4,0x5aa55a44,0x00003161,0x000018e0,0x8c0f0840,0x8c3018c2,0x31840000,0x39a420e0,0x10201040,0x08005a86,0x52431860,0x5a633120,0x49c23941,0x62c16b04,
-0x7be76324,0x6b654a40,0x6b454220,0x42004a60,0x52614200,0x83c849e0,0x49c35204,0x31201880,0x522251e2,0x5a2349c0,0x10006284,0x62436264,0x5a252880,0x6ae36284,0x4a001860,0x6ac441a0,0x83a96aa5,0x6ae76ac6,0x52016ac7,0x31204982,0x39e118a0,0x946a52a0,0x526262e3,0x62c47ba7,0x8c096b07,0x5aa36b23,0x10806b29,0x8bcb5a65,0x7b497b09,0x83689c2c,0x6aa26aa2,0x7b2872e5,
-0x39e139e1,0x29603180,0x29602140,0x21202960,0x00002982,0x00200002,0x18c10000,0x00011920,0x29601080,0x10611900,0x08800860,0x00202121,0x00200000,0x20e031a3,0x08201040,0x080139c3,0x00000000,0x18a01080,0x29402100,0x20e01060,0x318020c0,0x39a039a0,0x39c04a40,0x210039c0,0x316031a0,0x39c02940,0x39613980,0x42013180,0x6b444a40,0x4a214a22,0x52415aa0,0x41c041c0,
-0x18a020c0,0x31613140,0x39a32960,0x7b842922,0xa4698325,0xa48872c1,0x8baaa489,0xa44cacae,0xa46aac8c,0xa4acacaa,0xad309cac,0x8c28944e,0x93c89408,0x8bc88367,0x93e98be8,0x72e48ba8,0x6a658364,0x49604140,0x93e872c3,0x836672c3,0x72c26a63,0x72e56a63,0x49a03920,0x392051e1,0x51e14980,0x51c449c1,0x51e35a24,0x5a456265,0x5a6749e4,0x62c8732b,0x7b8c62e9,0x7b8d83ce,
-0x9470b533,0xbd749c91,0xce17bdb5,0x734bc5f6,0x9cd183ad,0xa511ad33,0x49e25245,0x41e239a1,0x28e028a0,0x394128e0,0x10000000,0x10004183,0x4a041020,0x6ae820e0,0x10001000,0x18613123,0x208030e1,0x31201000,0x51e23100,0x52236264,0x630762a4,0x0800840b,0x00200000,0x00000820,0x00000840,0x52833142,0x21006b47,0x5a806b48,0x52a16b04,0x31801080,0x39405a64,0x31003921,
-0x6b224a20,0x52a06b42,0x4a6139e0,0x39c06303,0x41c04a40,0x4a0241c0,0x5a6241a0,0x41a249c0,0x41803920,0x62635a42,0x39405201,0x62644180,0x62a06265,0x5a405220,0x49e03960,0x5a4428a0,0x72e67b47,0x940c6ac5,0x836b83aa,0x31005201,0x08002082,0x31601060,0x6b6552a4,0x5ae36b45,0x5aa17ba8,0x63257b89,0x5ac64a22,0x6a8728e0,0x8b8b6aa7,0x7b458ba9,0x83668348,0x7b675a60,
-0x18e02100,0x18c01900,0x31a118e0,0x00002921,0x08400021,0x188018c0,0x29203161,0x210218c0,0x10c00820,0x21402961,0x31603160,0x29203180,0x29403160,0x4a222920,0x39614201,0x39a041c1,0x41e341c1,0x39603140,0x31803160,0x4a0249e1,0x4a225244,0x6b063180,0x39603960,0x396049c0,0x41c12920,0x52433160,0x5a635a43,0x62c55223,0x83a98c0b,0x6ac57b67,0x73476ae6,0x52435263,
-0x4a0141c0,0x942a49e2,0x8beaa48d,0x8bc8940b,0xac8a942a,0xbceda449,0xacacb4ac,0x8be98be9,0x72e6940a,0x628472e5,0x28a05201,0x28801000,0x51c051e2,0x93c872e3,0x628151e0,0x6aa272c2,0x72e372e4,0x6a817b04,0x72c35a00,0x416072c2,0x7b044980,0x59e25a21,0x51a16243,0x51e249a1,0x49a149a1,0x51c43100,0x52254163,0x62a75264,0x5a6749c4,0x736c83ee,0x62ea6b2b,0xb5348c2f,
-0xad12bd74,0xb5749490,0xce17ad13,0xd658d637,0xad539470,0x9451ad33,0x39204a04,0x20c04181,0x41832080,0x416349a3,0x62a7836b,0x7b6a3100,0x73087328,0x316149e3,0x18820800,0x104028e1,0x18401020,0x18601000,0x39411860,0x396028e0,0x526349e0,0x4a023980,0x4a035a65,0x312239a3,0x39a262e7,0x21003160,0x18a01880,0x41e05283,0x39a04a00,0x41c15242,0x41a13920,0x39013900,
-0x6b252920,0x4a8052c0,0x52a06b64,0x422052a0,0x73664220,0x6b445a81,0x62e44a00,0x52426b04,0x39607b68,0x5a645242,0x52015a84,0x39205202,0x49c072e4,0x49e05a41,0x310049c0,0x28e062a4,0x52025a25,0x6ac730e0,0x51e38bcb,0x72e56aa6,0x08001020,0x21200000,0x10a03160,0x73857386,0x7be76b43,0x52616b44,0x5a643120,0x5a471880,0x41826287,0x9c4b93eb,0x9c4b93ea,0x83877b45,
-0x42022960,0x31a031c0,0x212039e0,0x21001900,0x31602940,0x31803160,0x31803140,0x29004a23,0x31603982,0x31603160,0x41c13980,0x39c039c0,0x39a03180,0x41a03180,0x51e15223,0x5a4441a0,0x49e26b06,0x49c25a22,0x52245224,0x312041c2,0x62a77309,0x4a015222,0x49e149c0,0x41c041a0,0x6ac55a64,0x522241a0,0x5a645203,0x6ae662c7,0x8bca72a5,0x39615a43,0xa46d49c3,0xa48dacce,
-0xacceacae,0xacceacce,0xb52facce,0x8365cdf2,0x83247b24,0x41408b66,0x7b238365,0x6a816a61,0x7b046262,0x6ac36ac3,0x8ba76ac4,0x83237b25,0x72c47ae3,0x72e56aa3,0x7b056241,0x7b246a83,0x72c27b25,0x72c27b03,0x51c05a00,0x51a04980,0x30c04980,0x28802880,0x38e04140,0x18403121,0x10201860,0x10001800,0x392338e3,0x41831020,0x41a428c0,0x736c6b2b,0x4206736c,0xb5348c0f,
-0xbd74ad13,0xb594b574,0xc5d6a512,0xb554b533,0xbdb59c70,0x9c718c0f,0x20604a05,0x08201020,0x18a020c1,0x41a341c5,0x49c33141,0x18206286,0x520428a0,0x29015204,0x29020800,0x08201040,0x290128c1,0x08002102,0x18610000,0x18600000,0x20c06266,0x41a141e2,0x49e35224,0x49c128e0,0x49e249e2,0x31604203,0x294039a1,0x292020c1,0x29414201,0x39c12940,0x41605223,0x28a06285,
-0x29402940,0x6b8452a1,0x63635b01,0x39e06343,0x630152a0,0x4a207343,0x7ba56b22,0x4a0041e0,0x396041a1,0x310062a4,0x41805222,0x39605a22,0x6aa43980,0x5a4249c0,0x41805221,0x31006b05,0x41a21020,0x39425a87,0x6ac76287,0x834b49c3,0x18604182,0x21200000,0x6b2539a0,0x5ac16324,0x63427bc7,0x62a35ac2,0x18206281,0x52043921,0xacd13942,0x7b4751e4,0x940bacaf,0x9409accc,
-0x21402120,0x21402120,0x21402140,0x31812120,0x31a02960,0x39c14201,0x316039c1,0x31603160,0x63063180,0x52643980,0x73483980,0x41a03960,0x62c649e0,0x83696ac8,0x522351e2,0x52025a23,0x7b485a23,0x52236ae7,0x18803140,0x31003120,0x51e35a44,0x62445a45,0x41803940,0x5a635202,0x5a855a64,0x6ae662a5,0x41806ac6,0x392149c1,0xa46e8bab,0xacafa48f,0xc571b4ef,0xff39accf,
-0x93eabd2f,0x39005a02,0x7b2549a0,0x8b676a83,0x93a78b46,0x7ae472c3,0x93a88b66,0x7b268b88,0x72a47b05,0x7b067b06,0x83468346,0x8ba88b87,0x6ac38b87,0x73067b25,0x49816aa4,0x18606ac4,0x51e13900,0x49c049a0,0x5a226a42,0x39403940,0x30c028c0,0x180028c0,0x10001820,0x08000800,0x10001800,0x18211000,0x41841820,0x31412921,0x41a420c1,0x734c7b2c,0x7b8c6b0b,0xbd957bad,
-0xb573ad12,0x9c70b532,0xb574c575,0xbd95bd75,0xad13ad33,0x732d8bef,0x08003162,0x00000800,0x00000820,0x08000000,0x08001000,0x18400800,0x18601860,0x10402901,0x08000800,0x00000000,0x08200800,0x00003145,0x7b6c0800,0x0800838a,0x39601000,0x10003940,0x28e141a1,0x5a451840,0x31205202,0x18c018a0,0x31613161,0x210020e1,0x21002120,0x18a01080,0x28c020e0,0x5a6428e0,
-0x5aa43141,0x42003a00,0x5b214a40,0x52a05b00,0x736252c1,0x4a0062e1,0x52405280,0x6b0262c2,0x62c25aa0,0x41e062e4,0x49e23980,0x5a4249e0,0x396049e0,0x396049a0,0x28e03140,0x52025a22,0x39403920,0x18603920,0x8bed1000,0x626549e2,0x18405203,0x49c028c0,0x526241c0,0x63024a00,0x6b467366,0x41e04240,0xd5f35a23,0x62651800,0x8b8b6266,0x182051c2,0x08206ac4,0x62636264,
-0x21202941,0x31802960,0x29602960,0x31a03181,0x31a03180,0x31603180,0x31803160,0x31803160,0x39c03160,0x52225222,0x734862c5,0x73077328,0x72e683c9,0x5a225a42,0x52225a43,0x41a15a42,0x7b497b68,0x6ae77308,0x6ae962a8,0x6ac77308,0x6ac772e8,0x49a36ac7,0x62a662a6,0x6ac76286,0x73287329,0x72e862a7,0x7b297b4b,0x7b296aa6,0x394149c2,0x49a25a45,0x51e14181,0x28e028a0,
-0x41a06ac5,0x9c2b8ba9,0x41a072e6,0x5a415a41,0x6ac36242,0x7ae36aa2,0x62428324,0x6aa36aa3,0x62226a83,0x51e151e1,0x390051e1,0x51c02880,0x49c06242,0x414049c1,0x31203900,0x00007b68,0x10401000,0x18201820,0x28a11800,0x10001000,0x10002080,0x18202020,0x28812040,0x18202060,0x10001000,0x18202060,0x52243921,0x39833161,0x41a320c0,0x62ea5227,0x7b8d7b8d,0xad3483ef,
-0xad127b8c,0xa4708bcd,0xce17cdf6,0x9450ad33,0x8c0fbd95,0x7b6ea4b2,0x188041e5,0x00001020,0x08200800,0x08000820,0x08000000,0x10201000,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20a10000,0x6ae783ab,0x18003102,0x498051c1,0x30e05a05,0x5a0528c1,0x418172e9,0x08001880,0x00001860,0x4a471060,0x084018c0,0x10a00000,0x08202921,0x39a11840,
-0x20e02920,0x31805283,0x39c041e1,0x52c06322,0x5aa06343,0x5aa14a20,0x738462e2,0x20e04a21,0x526141e0,0x6b0462c2,0x31403980,0x49e05a63,0x52005a41,0x51e16282,0x522049e1,0x49a141a1,0x20a049e1,0x080028a0,0x20c03121,0x49a228a0,0x5a243920,0x41a03960,0x39a05244,0x62e36b06,0x73a62940,0x62a44a21,0x39607b46,0x28a01000,0x62678bcc,0x18806ae9,0x08003940,0x29002901,
-0x31813181,0x31a02980,0x29603180,0x31803180,0x31603180,0x39a03980,0x522441c1,0x730962c7,0x6ac86aa7,0x52435a65,0x520151e1,0x62635a62,0x5a436283,0x52045223,0x62855a44,0x6aa86ae7,0x6ae662a6,0x7b697309,0x6ac76ac6,0x6ac77b69,0x5a4562a6,0x290028c0,0x72e849e3,0x73076ae7,0x73076ac7,0x49c25a43,0x31203100,0x73083120,0x51e25221,0x62c74141,0x62656264,0x186041a2,
-0x20a03122,0x10001800,0x20611000,0x30e11840,0x30e03100,0x59e25202,0x49616a64,0x51c26244,0x51e05a03,0x5a204140,0x5a215a21,0x59e04180,0x5a224140,0x49e04160,0x522249e0,0x6ac649e2,0x4a0362c5,0x39804a22,0x290028e0,0x20a03161,0x39413982,0x41404962,0x30a04121,0x180030c0,0x41613100,0x39222060,0x5a665225,0x31623962,0x5a463982,0x62a95a47,0x5a689470,0xb55483cd,
-0xad126b0b,0xb57383ad,0xc5b57b8c,0x94507bad,0x8c0fa4d1,0x736ca4f2,0x21014a47,0x08001880,0x10000800,0x10000800,0x08001842,0x10001000,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x8bac2081,0x8b886ac5,0x6aa46a84,0x62c71800,0x51c430a2,0x49826aa7,0x0000940c,0x29210000,0x00000000,0x31830040,0x08400000,0x08002922,0x31800000,
-0x000018c0,0x52846b27,0x29603140,0x62e218e0,0x52c04a20,0x52c24201,0x3a004a60,0x52605a60,0x42004a20,0x52605240,0x5aa462e4,0x6ae44a03,0x5a6241c0,0x49c05221,0x5a4349e0,0x41805a63,0x49e14180,0x49c35a05,0x5a451860,0x41c0c593,0x5a435222,0x73075241,0x62c562c6,0x840a39a0,0x4a604240,0x6b455ae1,0x7b096ae6,0x7ae58bab,0x7b69836c,0x838b7b4a,0x10004140,0x08600000,
-0x31803180,0x29402920,0x4a433140,0x52436b26,0x4a225223,0x5a634a02,0x41c14a02,0x52035243,0x4a0241a1,0x4a015a63,0x5a645223,0x6ac66286,0x62866ac7,0x5a445a66,0x312049e2,0x394141a1,0x310028c0,0x28e01820,0x31003960,0x41822080,0x39413100,0x4a024182,0x41c14a03,0x39613960,0x418149c2,0x39413941,0x49c228e0,0x28c03940,0x186028e0,0x106028c0,0x30e11820,0x10401840,
-0x312120c0,0x28e01860,0x52042080,0x52033941,0x418149a2,0x51a13940,0x49803920,0x416051c1,0x5a226a85,0x416051e1,0x5a6149c0,0x6ac33100,0x52006242,0x51c062a3,0x51c05201,0x28805a21,0x39204980,0x498049a1,0x498251a1,0x20a041c3,0x31402900,0x39203920,0x414330c0,0x31003941,0x28a03101,0x30c12060,0x41c31000,0x39824a04,0x524639a3,0x732b62c8,0x5a897bad,0x8c0f6b0b,
-0xbdb4a4d2,0xad129cb0,0x9c91bd94,0xad136b2b,0x942fb554,0x8c2f9450,0x29215247,0x316218a0,0x49c441c3,0x18603122,0x49c349c5,0x31213941,0x20c11860,0x104020c1,0x08001040,0x00000000,0x00210000,0x08400840,0x00000000,0x20c10000,0x626462a7,0x18604180,0x18200800,0x49a35a06,0x7b4972e8,0x7b8a0800,0x39623160,0x10800800,0x00000000,0x00000000,0x422310a0,0x20e018a0,
-0x39a42120,0x29000000,0x4a2218e0,0x52626b46,0x41e03140,0x39a041e0,0x41e141e1,0x5a612900,0x5a814a00,0x52604a20,0x29205261,0x52222900,0x418049e0,0x5a4241a0,0x49e15a62,0x62a45a43,0x28c03100,0x5a646287,0x62855a83,0x28c07b6a,0xbd335226,0x41a049a2,0x41c062c4,0x31a020e0,0x31807ba7,0x73666b45,0x52235223,0x93ec6ae5,0x8bab72e8,0x838b5225,0x41824983,0x18a10801,
-0x5a467329,0x6b086ae7,0x5a456286,0x49e25a43,0x39a04180,0x41a341a2,0x49e339a1,0x52254a04,0x5a665a46,0x49e35205,0x41c34a04,0x396041e1,0x41a141c1,0x31203960,0x49e23140,0x49c249e1,0x30e03940,0x39623102,0x41a249c2,0x49c349e3,0x18603100,0x28e128e0,0x20c020a0,0x00000000,0x10001000,0x20801000,0x310028c0,0x18202060,0x290128c0,0x00001020,0x49821861,0x39a15224,
-0x41c249e3,0x41a249c3,0x5a453962,0x5a256286,0x520349c4,0x49e25a23,0x51c15223,0x39403100,0x312041a0,0x394141a0,0x30e030a0,0x31204141,0x10002080,0x00000800,0x18601882,0x08001020,0x00000800,0x08200820,0x00001040,0x08200021,0x08000000,0x28a01000,0x18402060,0x10001861,0x10002040,0x41631000,0x396141c2,0x4a2549e3,0x49c44a25,0x6b0b6288,0x8c0f6aea,0x83ee7b8d,
-0xc5d5bd74,0xb553c5f6,0x8c2fce37,0xa4f28c0f,0x94509cb1,0xb575942f,0x1060ad32,0x10412902,0x08002080,0x18211860,0x30c11020,0x20802880,0x08000800,0x10401840,0x52071880,0x18401860,0x208028c1,0x00000820,0x08000000,0x00200000,0x00000000,0x00000000,0x20600800,0x39213921,0x18421021,0x73090800,0x62655184,0x6b075a45,0x000010a0,0x10820000,0x08000000,0x20a12922,
-0x18e018c0,0x086018a0,0x41a30000,0x20c041c2,0x62664a03,0x52026ac4,0x41803120,0x52213941,0x5aa15aa2,0x4a2062e2,0x20c05241,0x5a6420a0,0x394049e1,0x49c041a0,0x5a425220,0x62635a22,0x5a436aa5,0x18205a22,0x52213980,0x10005222,0x20614165,0x49c351e5,0x4a0262a5,0x6b4639c0,0x632239e0,0x6b254200,0xbd714181,0xb5347b6a,0xac6e93ea,0x73096ac8,0x39218bcb,0x7b484160,
-0x520349e2,0x6ae77308,0x62866ac7,0x5a8662a6,0x41a43961,0x524562c7,0x49e44a04,0x49c341a2,0x41a341a3,0x31003100,0x20c02900,0x49e23962,0x312041e2,0x49e149c1,0x4a0149c1,0x41a049e2,0x41a241a3,0x418249a3,0x31203101,0x20a028e0,0x208020a0,0x28c128a1,0x31423101,0x10000800,0x18001840,0x31021860,0x39412900,0x31213941,0x188028c0,0x31022901,0x398220c0,0x08001880,
-0x31410800,0x396028e0,0x39614a03,0x08203100,0x184220c0,0x18200800,0x18802080,0x10201020,0x20a028e0,0x31203941,0x28e03120,0x20a028c1,0x312041a3,0x18c118c0,0x00001081,0x10801060,0x08000800,0x00001040,0x20a03962,0x29013983,0x394139a3,0x39223120,0x31013101,0x208030e0,0x28a028a0,0x41822060,0x49e33920,0x52245225,0x5a885287,0x62ca62c9,0x942f83ce,0xacd2940f,
-0xc5b5bd34,0xacf2b573,0x6b0ac5b5,0xce16734b,0x83ce7bad,0xbdb6b533,0x41e59cd1,0x18803142,0x20a128e1,0x208028c1,0x28c028e1,0x10001860,0x08000800,0x08001800,0x18401840,0x18201000,0x20811820,0x28e128e1,0x10611880,0x00000000,0x00000000,0x00000000,0x10410000,0x08001020,0x10000000,0x20a05226,0x730730c0,0x52025a44,0x394262a5,0x08203142,0x08000800,0x946f49e5,
-0x18c018c1,0x08400800,0x20e01080,0x188028e0,0x418120e0,0x62a541a1,0x52026284,0x520249e2,0x49e141a2,0x41c049e0,0x49e141a0,0x39604181,0x52013960,0x6ac44180,0x49c04180,0x5a634180,0x62845a62,0x41605203,0x528449a0,0x52034a43,0x28e062a6,0x28a0a48e,0x522262a6,0x6b064a21,0x6b2362e2,0x422062e2,0x73498428,0xd635bdb3,0xff58d614,0x5a245a24,0x83698bab,0x41a26261,
-0x62c662c7,0x62a762a6,0x62865a66,0x7b6a62a8,0x31215a67,0x28e02900,0x184020c0,0x312128e0,0x28e028c0,0x28c028c0,0x41a341a3,0x396049c3,0x49c341e2,0x20801860,0x208028a0,0x20802060,0x18401800,0x20601000,0x28c030e1,0x208028e0,0x18201840,0x10002040,0x08001000,0x20a01020,0x184028a0,0x188020a0,0x20c11881,0x20e21860,0x08203163,0x00001060,0x00001061,0x00000000,
-0x08000000,0x10401020,0x106018a0,0x41a428e1,0x39611820,0x28c03140,0x39632080,0x49e23121,0x000049c4,0x626651e4,0x5225942c,0x41c46aa8,0x31432940,0x108120a1,0x4a482924,0x000020e3,0x08400800,0x08200820,0x00001041,0x00000000,0x00000000,0x08200000,0x08000820,0x10001861,0x18002040,0x41622880,0x39613100,0x524549e4,0x52474a26,0x734c62e9,0x83ce5a68,0xa4916aca,
-0xd617de58,0xbd94c5b5,0x8c2fb574,0xad139c91,0x942f83ce,0x840f9c70,0x41c57bad,0x310128e0,0x102020a0,0x10001040,0x18401000,0x20a03101,0x39201880,0x39604161,0x18402080,0x30e20800,0x10001000,0x00000800,0x00000800,0x00000020,0x6b2b0000,0x00000000,0x08000820,0x000020e3,0x20e20820,0x31411040,0x30e030c0,0x39203900,0x51e130c0,0x31603120,0x10403120,0x080018a0,
-0x10600000,0x10611041,0x00200000,0x106139c4,0x312018a0,0x39603120,0x49c13940,0x28e04180,0x73075202,0x52035a64,0x31003960,0x39405203,0x41803980,0x28a03120,0x49e04180,0x62635221,0x5a225a42,0x5a246ac5,0x49c03920,0x52413980,0x312041c0,0x52052080,0x41e120c0,0x6ae55a63,0x62e37345,0x6b4462e3,0x6b436b45,0x7b874a21,0xbd508bc9,0x7327e696,0x6a646a63,0x6ac56aa5,
-0x6b0862a7,0x520472e8,0x31003942,0x186020a0,0x31212900,0x290020a0,0x31403120,0x39603981,0x31203982,0x20c01880,0x28c02900,0x10403140,0x29003102,0x18401020,0x30e128e0,0x28c02060,0x20811840,0x396228e0,0x41824182,0x390128c0,0x310130e0,0x28a03922,0x08002040,0x10201040,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x20c10860,0x28c049e5,0x20a00800,
-0x49c61860,0x10202900,0x080018a0,0x08001861,0x31641880,0xa4d062ea,0x8c0e83ec,0x080018a0,0x524649c5,0x9c4eacd1,0x8bcdde96,0x080028c2,0x00001040,0x00000020,0x00000000,0x00000000,0x00000000,0x00000020,0x28e21020,0x08001880,0x29031040,0x30e03142,0x392328a0,0x100030e1,0x20601800,0x18401000,0x31003120,0x5a465224,0x39835226,0x83ee734b,0x5a685248,0xa4d15267,
-0xcdd5c5b5,0xce37d637,0xc5d5b553,0x9cb1a4b1,0x83cdad33,0xa4f2944f,0x41636b0a,0x20801860,0x20812080,0x28a11820,0x18202081,0x18801820,0x28c020e0,0x41623961,0x28c028e0,0x41a328a0,0x39423942,0x18401000,0x08001000,0x00200000,0x00000000,0x00000820,0x00000000,0x00000820,0x18a10000,0x10400000,0x520372e9,0x08005a24,0x39403980,0x41805a43,0x5a426283,0x28e128c0,
-0x18a31000,0x00000820,0x08205227,0x00000000,0x000052a7,0x18600840,0x520249c3,0x41c149e0,0x4a0241a1,0x41a13960,0x49e249c1,0x5a235223,0x312051e1,0x41a13100,0x52023100,0x52425242,0x62835a62,0x5a636283,0x62a46ae6,0x522320a0,0x20a03980,0x520451e3,0x732828c0,0x62a55a44,0x62c24a00,0x63034a00,0x4a406302,0x424039c0,0x5a2241a0,0x9c2c7b47,0x41408347,0x390072a5,
-0x28e01840,0x206030e1,0x20801820,0x29003942,0x28c02080,0x41a220a0,0x28c02900,0x18801880,0x10410800,0x20a020c0,0x08000800,0x18401860,0x29003120,0x290020c0,0x31002900,0x20603120,0x39413961,0x31013942,0x30e130e1,0x18602900,0x20a128e1,0x08201040,0x00000800,0x00000000,0x08000800,0x08000000,0x10201000,0x18801060,0x31241040,0x28c01881,0x20801860,0x100028c0,
-0x732a3122,0xa4f09c8f,0x736b9450,0x00003162,0x18601040,0x00003962,0x188020e1,0x20a20820,0x31020800,0x396228e1,0x31023122,0x18801020,0x31230000,0x00200800,0x08000000,0x00000800,0x000018e2,0x00000000,0x00000000,0x00000841,0x08010000,0x00001020,0x392151e5,0x416430e2,0x18402060,0x49e41860,0x5a4649c4,0x73096266,0x526762a8,0x5a68734b,0x7b6c7bad,0x9c705247,
-0xb533acd1,0xc5d5cdf6,0xbd94acf2,0xb594acf2,0x62c99470,0xa5139470,0x41835268,0x20803982,0x18603922,0x18402080,0x28c02080,0x102028c0,0x30e128e2,0x18402080,0x30c21820,0x18401840,0x28c13943,0x10202060,0x18601840,0x00000800,0x00000000,0x00000861,0x00000000,0x00000000,0x00000000,0x31640021,0x188030c0,0x102028c1,0x10000800,0x62827b26,0x39404180,0x08205244,
-0x082041c4,0x00000000,0x18c218a1,0x00000000,0x10400841,0x20805225,0x62463920,0x49c26285,0x41a13960,0x41603960,0x49e24180,0x626562a5,0x5a436285,0x39204180,0x52033940,0x5a833120,0x5a223960,0x49c14180,0x62855a84,0x49c16285,0x522228e0,0x41616264,0x49c320a0,0x41815a65,0x6ac45242,0x5aa25202,0x4a606b43,0x5ac06b64,0x6b246303,0x73247303,0x62c34a00,0x6ae449a0,
-0x416230e0,0x20a03140,0x28c03941,0x10001860,0x100028c2,0x10001020,0x10401860,0x18a10800,0x10401880,0x28e12080,0x31403961,0x20a028e0,0x310028c0,0x29003100,0x28a018a0,0x208028a0,0x20a01860,0x08200840,0x08400000,0x00000000,0x00000000,0x08000000,0x08000000,0x20a21020,0x20a02080,0x18601840,0x18402901,0x10001000,0x20c13942,0xb5315aa8,0xa4d0c572,0x39836ae8,
-0x10001860,0x62e62901,0x738a2920,0x102062c7,0x52451860,0x9c4d838a,0x9c8f8bab,0x31223121,0x18403962,0x20a13123,0x00000000,0x08000000,0x30c11060,0x49a530a0,0x20601820,0x39612060,0x18601880,0x20c30800,0x00000000,0x00000001,0x00000020,0x18600000,0x20a20800,0x394428e3,0x39652924,0x39022040,0x390028a0,0x5a8751e5,0x5a6841c4,0x6b0b734c,0x5a89734c,0x83ed41e5,
-0xa4f28bee,0xa4d0cdf6,0xbd947b8b,0xce17942f,0x9cb19c70,0x83eea4d1,0x394262c9,0x39413961,0x30e04182,0x52455a66,0x41626ac8,0x49c351a3,0x5a665203,0x49a29c4d,0x6aa76265,0x18603942,0x10200000,0x10001860,0x31021860,0x318228e0,0x000020a0,0x18830000,0x00000000,0x00000000,0x08400000,0x08400000,0x00000000,0x00000000,0x6b290000,0x398120e0,0x10003141,0x49c51860,
-0x080028c0,0x00000000,0x10800000,0x00002923,0x49a20800,0x7b2a30e0,0x51e40800,0x41404160,0x49a44983,0x28c02040,0x39803100,0x39203941,0x312030e0,0x31004181,0x5a6449c2,0x41c15263,0x39805221,0x20a05222,0x62855a63,0x62855a84,0x522149c1,0x5a424a01,0x62643900,0x39813961,0x62a65a45,0x6ae541e2,0x6b456ae5,0x4a604220,0x4a605ae2,0x4a6052a1,0x4a606b25,0x62825260,
-0x08001020,0x10001840,0x00000000,0x18401840,0x08001020,0x08001000,0x18601860,0x18a01060,0x188018a0,0x290028e0,0x20a128e0,0x20a120c0,0x00000000,0x08000000,0x00000800,0x00000000,0x00000000,0x00000000,0x18820820,0x10001000,0x08201000,0x10410800,0x080020c1,0x41c41060,0x732a49c5,0x5a687b6c,0x394228e2,0x520549c4,0x6ac78bab,0x62871820,0x39416287,0x10002080,
-0x838a3941,0x31826b28,0x29014a24,0x73091060,0xfffeb532,0x62e9c636,0x5a465247,0x31428bcc,0x49e51840,0x9c905a89,0x00000000,0x00000000,0x08200000,0x00000800,0x49a41000,0x312028e0,0x52035223,0x838749c1,0x944cb54f,0x08003961,0x00000000,0x18c21000,0x00001082,0x18200800,0x08000800,0x20a00800,0x39621020,0x49e562a9,0x6b2b39a4,0x6b0b62ca,0x290362ca,0x9cb1944f,
-0xacf2ad12,0xc5d4c5d5,0xbdb5734a,0xd678a4d1,0xa4d2bd74,0x738c9450,0x418341e5,0x20602080,0x20a028e0,0x49c428e0,0x28c05a46,0x28a049a2,0x51e42080,0x5a433100,0x7b294160,0x5a466ac8,0x10200840,0x10201840,0x102028e0,0x08001000,0x00000800,0x080018a2,0x00000820,0x00000000,0x00000841,0x10810000,0x00000820,0x00000000,0x29030000,0x10605288,0x20e12902,0x00001880,
-0x4a271000,0x10810000,0x00003185,0x31621081,0x20600800,0x28a03900,0x62856ac7,0x39206a85,0x49c13940,0x52245202,0x49c35a46,0x20c041a1,0x392120e0,0x49e24162,0x396128e0,0x41a32900,0x31005223,0x39404a01,0x41a15a43,0x62653960,0x5a436264,0x39605a64,0x212039c2,0x31606ae6,0x73485a86,0x41a05264,0x5ae462a3,0x5ae26b24,0x52804200,0x4a6052a1,0x6b446324,0x6b045ae3,
-0x18821861,0x20a13121,0x18412081,0x20811840,0x18402080,0x20800800,0x20c03962,0x000020c0,0x18a020c0,0x20801860,0x10002080,0x00000000,0x00000000,0x00200000,0x08000000,0x10200800,0x08000800,0x00000000,0x18610800,0x10811081,0x184020e2,0x20c20800,0x18a10800,0x08001860,0x18400800,0x20811861,0x49e43944,0x49c43921,0xd6776aa7,0x6aa783cd,0x51e351e4,0x62455a24,
-0x940dde77,0x52283964,0x31635a86,0x734a0800,0x310049c4,0x00003100,0x00006266,0x20a00800,0x10001000,0x08000800,0x00000000,0x00000000,0x00000000,0x18820800,0x39221020,0x5a642080,0x392028a0,0x72c33940,0x6aa16240,0x5a006241,0x52216264,0x20a04984,0x08000000,0x08000800,0x10201881,0x20a018a1,0x4a053964,0x524762a9,0x732b5268,0x6b0b736c,0x5a89732b,0xad13b554,
-0xbd948c0e,0xad32ad33,0xa4b1bd92,0xbd74942f,0x9c91b533,0x840e8c2f,0x28c05a67,0x10002881,0x00000801,0x10001000,0x20401000,0x28a01800,0x39004161,0x5a4349a1,0x6aa65a23,0x6266acaf,0x28c03141,0x49c151a4,0x730a5a26,0x41a583aa,0x00002921,0x08005aa9,0x00000020,0x00000821,0x52aa0000,0x00002124,0x08200000,0x00000000,0x00000000,0x00000000,0x39e50000,0x00003185,
-0x732b0800,0x18c10000,0x08200000,0x10200000,0x31005a47,0x310130c0,0x182028a0,0x39002040,0x41616245,0x49a31820,0x49e23960,0x52666287,0x20a01040,0x28c01000,0x31003100,0x208028e0,0x20812062,0x52223962,0x28e03120,0x414241a1,0x62851840,0x52035a44,0x39605aa3,0x526320e0,0x39610800,0x5a436b06,0x29403960,0x42205ae3,0x5ae26323,0x422052a1,0x6b456303,0x52a36b86,
-0x29002900,0x28e028c0,0x29001880,0x312120c0,0x18402080,0x10411060,0x08000000,0x10811061,0x00000000,0x00000000,0x08000800,0x08201081,0x08200020,0x08200000,0x08000800,0x18600820,0x18801860,0x20e118a0,0x10401060,0x00000000,0x00000000,0x00000800,0x08000800,0x39842902,0x20c039a4,0x41c541c4,0x312320a1,0x082018a1,0x08000820,0x10200800,0x944d6289,0x5aa72921,
-0x39c49450,0x29021880,0x10400800,0x082039a3,0x10400800,0x20e31060,0x49e52104,0x5a8762a8,0x6ae97b6b,0x00001040,0x52893185,0x08204207,0x08200840,0x000028e2,0x00010820,0x52431080,0x49a049a1,0x72a36262,0x7ae472a3,0x6a6372a3,0x59e159c0,0x49c051c1,0x41624983,0x31014162,0x520449a4,0x49822880,0x520749a2,0x62c94a05,0x5aa939c5,0x734c9450,0x736d83ce,0xce17ad13,
-0xbdb5b553,0xa4f2b573,0xb532ad12,0xa4b162c9,0x8c0f62ca,0x840fa4b1,0x106062e9,0x10211020,0x00000800,0x41a528e2,0x39633964,0x31424183,0x49e54182,0x18605205,0x10203121,0x29010800,0x396220a0,0x83ab72c8,0x734b942e,0x62e9944e,0x00000800,0x10601881,0x08004a27,0x10401020,0x18a11020,0x29232123,0x4a4873ad,0x08400000,0x00000820,0x00000000,0x00000000,0x08000000,
-0x310228e2,0x00002080,0x31440000,0x000062ea,0x28c04183,0x18203942,0x18003941,0x18004142,0x62452060,0x31405a25,0x52243120,0x10004181,0x20802080,0x08001860,0x08000820,0x39624184,0x20a028e1,0x28c128c0,0x51e31000,0x310049e3,0x5a443100,0x5a445a44,0x52235223,0x29405283,0x41c239c1,0x290039a3,0x52652900,0x62e44a42,0x73856324,0x42606322,0x6b435b02,0x29006b02,
-0x28e128c0,0x28e01840,0x20a13120,0x28c11840,0x00001020,0x00000000,0x00000000,0x08000000,0x082020c2,0x082018a1,0x08001020,0x00200000,0x00000000,0x20c20000,0x42061080,0x08405247,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x31430000,0x312349e6,0x10400800,0x00001020,0x00000000,0x4a4720e2,0x10403984,0x31634a06,0x00002922,0x08000000,0x00000000,
-0x08200000,0x39c520c2,0x39853163,0x00002903,0x00000000,0x00000000,0x18a20000,0x00000000,0x00001061,0x08411061,0x00000000,0x00000000,0x00200000,0x10400000,0x31240000,0x41413923,0x41602060,0x498049e0,0x6a826221,0x51a04980,0x5a016201,0x49c05a01,0x39204162,0x49834984,0xa42c5a46,0xa42bb48d,0x416449c3,0x52684a26,0x526941e6,0x41e783ef,0x62eb9450,0xbd7483cd,
-0xb553b553,0xcdf6ce16,0xbd949c90,0x732b9c91,0xb5536aea,0x9450bd74,0x18c039c5,0x100028c1,0x18811020,0x10401861,0x20601881,0x18601860,0x104020e1,0x18601880,0x08000800,0x08000800,0x39a41040,0x18202040,0x00005246,0x08000800,0x62e91020,0x000041e5,0x18205a48,0x41a541c5,0x08004a07,0x00000000,0x00000000,0x39a60000,0x080018c2,0x10400000,0x20a20000,0x00000000,
-0x100028e2,0x08001020,0x10602922,0x31420000,0x394249e5,0x28c04162,0x41823942,0x41621820,0x520430e0,0x49a23100,0x20a049c2,0x41c430e0,0x4a260800,0x08000000,0x29020000,0x10001000,0x08000800,0x28e03141,0x28e03120,0x41613100,0x418151e3,0x49c249e3,0x4a027329,0x4a442920,0x52835ac4,0x39614a43,0x840a7346,0x736962e8,0x39c04a43,0x63425b22,0x52c05ac2,0x5aa45261,
-0x188020c0,0x20c220a1,0x10610820,0x00000000,0x00000000,0x00000840,0x00000840,0x10401061,0x10200800,0x08001020,0x31441061,0x18a20800,0x08000800,0x00000000,0x00200000,0x00000000,0x00000000,0x08200000,0x00001061,0x6b2b1060,0x00005248,0x000041e7,0x00000000,0x08400000,0x082018a2,0x18c20000,0x08200000,0x00000000,0x08005268,0x08200000,0x39a63165,0x20e320c2,
-0x00200020,0x00000020,0x00000000,0x00000000,0x00000000,0x00200000,0x086118e3,0x00000040,0x00000000,0x00000820,0x080039a5,0x10200000,0x080028c1,0x08000800,0x00001020,0x28a03943,0x49812880,0x49a04981,0x62426242,0x6a844980,0x49406a84,0x6ac372c3,0x49e33942,0x41423901,0x8b487b09,0x8b688b69,0x49e651e3,0x31654206,0x52483144,0x52487b8e,0x736d7bae,0xa4d29450,
-0xbd73a491,0xce16c5b5,0xce17ce37,0x8beeb533,0xa4d1732b,0x94709450,0x20e262ea,0x104020c1,0x10400800,0x00000800,0x10600000,0x10200800,0x08201040,0x00000000,0x00000000,0x00001060,0x00000000,0x00000000,0x00000000,0x08200820,0x00000000,0x00000000,0x10200000,0x00001020,0x00000000,0x00000000,0x00000000,0x18820000,0x10220800,0x18811882,0x08000800,0x31233923,
-0x08002081,0x18810000,0x312320c1,0x942f3164,0x082020c1,0x00000800,0x08000000,0x20801020,0x10000000,0x08001020,0x20803122,0x100028c1,0x28c028c1,0x082020e0,0x00200000,0x080018c2,0x10203983,0x10400800,0x20801880,0x28c03121,0x31203982,0x28e03962,0x49c13960,0x5a8541a2,0x4a0120a0,0x5a845241,0x49e27b68,0x5a835202,0x5aa44a01,0x6b634220,0x6b655b03,0x73676b64,
-0x00000000,0x00000000,0x08200800,0x00000820,0x00000000,0x08200020,0x10600000,0x08200000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10410000,0x08000000,0x4a263163,0x4a0741e6,0x000031a6,0x00000820,0x00000000,0x00000000,0x08200000,0x00000000,0x00000820,0x00000000,0x188020a2,0x00000000,0x00000800,0x00000000,0x18c30020,
-0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08200000,0x18a218a1,0x20c120c3,0x00001000,0x39421880,0x6ac85a25,0x31231840,0x08201860,0x31010800,0x72c630c0,0x62846ac5,0x62646a83,0x5a4330c0,0x39005222,0x62636aa4,0x28e03942,0x41223901,0x93a993cc,0x93a993a9,0x392372e7,0x4a074226,0x62cb4a28,0x736d62eb,0x5aaa4a48,0xa4b28bef,
-0xc594b533,0xb553ce16,0xce378c2f,0xbd96ad33,0xad139430,0x83ce9c91,0x39a5736c,0x314328e2,0x20a12902,0x28e21860,0x10003102,0x39433102,0x20a13943,0x20c04a06,0x10002081,0x41841880,0x29036aea,0x08410820,0x08200000,0x08000020,0x00000800,0x10200000,0x08001000,0x39441000,0x000020e3,0x10600000,0x00000000,0x00000820,0x28e00800,0x4a0141a0,0x28e041a4,0x20c128e1,
-0x08200000,0x00005249,0x08200000,0x39837b8c,0x08004a25,0x312320a1,0x10211840,0x20801821,0x39821000,0x41c65226,0x080020c1,0x18800800,0x29001000,0x28a00800,0x00000000,0x08001000,0x20e21020,0x00000801,0x08000000,0x28e11880,0x28e049e4,0x10205266,0x20a02901,0x4a0249e2,0x4a023960,0x62e441e0,0x41c062c5,0x31404180,0x4a226b27,0x63035ac5,0x63455b03,0x39a05ae2,
-0x08200000,0x08000800,0x08000800,0x08000800,0x00000800,0x00000000,0x00000000,0x00000020,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0x20a13123,0x29221060,0x08202902,0x08000000,0x08410000,0x18810000,0x08401040,0x08200000,0x00000000,0x188120c2,0x20e23164,0x10401040,0x00000000,0x00000800,0x00000000,0x00000000,
-0x08200800,0x08000820,0x00000000,0x08200860,0x08200000,0x20e40000,0x00000000,0x00000800,0x18801020,0x39413920,0x39415224,0x08001000,0x41422880,0x102030e2,0x08002081,0x18600000,0x39001840,0x41404140,0x28a04161,0x41831000,0x18203121,0x29021820,0x208028c1,0x49833080,0x8b897ac8,0xac2ca40c,0x520651c5,0x4a275247,0x62cb62ea,0x7bae5aaa,0x83ef8c2f,0xbdb58c30,
-0xbd93acd1,0xbd53c5d4,0xbd94944e,0xb5549c90,0xad13a4d1,0x8c309cb1,0x21024a07,0x29013963,0x28c04183,0x49c530e2,0x51e54163,0x52065205,0x72a65a25,0x628593aa,0x51c372c7,0x4a033100,0x28e02901,0x5a665a66,0x398320a0,0x31425a68,0x08000000,0x41a341a5,0x20606ac9,0x100020a1,0x10211040,0x28a01000,0x5a025202,0x6aa551c0,0x62854141,0x28e04a02,0x28c04183,0x00001000,
-0x00000000,0x39850861,0x18803984,0x00200840,0x00000000,0x5a273985,0x31231860,0x08206b0b,0x08003942,0x41831820,0x20a028e0,0x00001020,0x39840800,0x28e139a4,0x08000800,0x08001881,0x00001041,0x10400820,0x28e20000,0x08201000,0x52261020,0x29401020,0x10403142,0x41c21020,0x49e23120,0x41a141a1,0x316041c1,0x31405a63,0x62e63140,0x52645aa5,0x39e05ac3,0x6b4773c8,
-0x08000820,0x00000800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x08200000,0x10201040,0x00001020,0x00000000,0x00200000,0x00001082,0x10820000,0x080018c2,0x31430820,0x08002902,0x00000000,0x00000000,0x00000000,0x00000000,0x10610820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08610000,0x00000000,0x7b083122,
-0x72a64140,0x49816a84,0x08001000,0x39443123,0x31231040,0x20c120a1,0x18801880,0x28e020a0,0x18402060,0x18202080,0x182020a0,0x100028c0,0x414330c1,0x08005a24,0x102028c2,0x08001000,0x7ae549a4,0x7b4693ca,0x310230c0,0x39430800,0x08002080,0x082120a2,0x31001840,0x39004942,0x6a864943,0x49627ae8,0x52274164,0x62ea62aa,0x5aaa5289,0x41c6736d,0x9cd239a6,0x944f7b6d,
-0xbd52bd74,0xbd73c5d4,0xad128bcd,0xbdb5a4d1,0xa4d2a4d2,0x8c30b554,0x29435247,0x394328e1,0x49c44183,0x5a2649a4,0x51e551e5,0x49c44183,0x5a035a24,0x83466244,0x7ae55a02,0x62856265,0x52046286,0x6ae76ac6,0x7b485a44,0x62a76ae8,0x41836ae7,0x5a2628c1,0x28a01860,0x6aa65203,0x18006aa5,0x6ac43980,0x5a016a84,0x6aa35a01,0x49c16ac3,0x28e05a64,0x20a25206,0x00000000,
-0x00000000,0x00000000,0x00000820,0x000018a1,0x000039c6,0x31430000,0x00001060,0x20a10800,0x41c439a4,0x5a675266,0x394228c0,0x104028c0,0x5aaa0000,0x00000820,0x20c20000,0x102020c1,0x08000000,0x08000000,0x00000000,0x41a420c2,0x5aa841a4,0x18a120a1,0x39a318a0,0x00203182,0x29002080,0x49e339a0,0x39623120,0x41c141c1,0x5a6341c0,0x62c739c2,0x4a624222,0x63055ae5,
-0x00000000,0x00000000,0x00200020,0x00000000,0x00000000,0x08200000,0x106028e2,0x08620800,0x08410021,0x28c30800,0x000018c3,0x00000020,0x00000000,0x00000000,0x00000000,0x18811081,0x08002923,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410861,0x00000000,0x00000000,0x28a01000,0x72ca1000,0x31252080,0x31400820,
-0x312030a0,0x51e249c0,0x49a44183,0x41c61840,0x10001860,0x18401080,0x08001840,0x30c01860,0x49c14181,0x394149c3,0x41810800,0xc5716aa6,0xc5507ae7,0x310172c6,0x72e77b4a,0x49a13920,0x93ca8ba9,0x93a993c9,0x51a27ae7,0x39603960,0x290139a2,0x20801840,0x20a01880,0x412238e0,0x49824182,0x41434142,0x52283945,0x52486b4c,0x62aa4a07,0x62eb83ae,0x738d736d,0xb554734c,
-0xc593acf1,0x8beec5d4,0xacf2942f,0xad33bd94,0xb554bd94,0x7b6c9c91,0x316341c5,0x41c52923,0x520641a4,0x5a874a05,0x41844a05,0x39425206,0x62046265,0x622259c2,0x7b057b05,0x62246264,0x52036265,0x62646223,0x72e75a02,0x72a75a42,0x62446284,0x72c65a24,0x726449a1,0x83677b26,0x28408305,0x7b077b08,0x6a8372c5,0x626259e1,0x520072e4,0x20c05243,0x000018c0,0x00001020,
-0x00000000,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x18210000,0x00000000,0x00000000,0x00000000,0x39830020,0x314241a3,0x000020c0,0x00210000,0x00000000,0x20c23144,0x41e71881,0x08210800,0x10410000,0x10600000,0x31441860,0x18805a87,0x08001040,0x20c01880,0x20c03120,0x31613100,0x39423140,0x10205225,0x520441c2,0x102018c0,0x52433121,0x628562a4,
-0x00000841,0x00000000,0x00000861,0x00000000,0x18810000,0x00000820,0x00001860,0x08001020,0x10001840,0x08000000,0x10801080,0x00000000,0x00000000,0x00000000,0x00000000,0x108118a2,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x49c42060,0x28801000,0x41405203,0x49823920,
-0x18803961,0x18204183,0x08001020,0x08001000,0x000020e2,0x080020a0,0x28c25247,0x39201820,0x31003100,0x62857327,0x9c2b6264,0x72c67306,0x72e78368,0x73278369,0x7b497b68,0x39406265,0x62626aa3,0x8b688367,0x7b078b89,0xa48d1820,0x28c03161,0x5a473122,0x20801840,0x41601820,0x5a0549a3,0x498449a3,0x6aca51e7,0x41c6630b,0x52488c0f,0x5aaa7b6d,0x4a487b8d,0x94507bad,
-0xbd52b512,0xbd73acf0,0xce16acd2,0xd658bdb5,0xad136aea,0x52488c2f,0x316241a5,0x20c13123,0x41844184,0x41a449c5,0x49c45a67,0x49e45206,0x5a245a65,0x39205a03,0x49608347,0x62855a24,0x5a246265,0x62a56264,0x6ac649c1,0x62654180,0x72e66243,0x6aa57b07,0x6a6451e2,0x8b467ac4,0x51808b26,0x51e17b06,0x72a36a82,0x5a216221,0x62837b05,0x08001000,0x00001020,0x00000800,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000039a6,0x00001040,0x00000000,0x00000000,0x00000000,0x10400800,0x18a020e1,0x082039a4,0x00000000,0x00000000,0x00000000,0x002018c1,0x08200840,0x20c10800,0x08001060,0x00001020,0x10400000,0x00000800,0x314220e0,0x39a31020,0x31411060,0x292120c0,0x4a050000,0x41c43981,0x62c75223,0x5a6541a0,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x28a041c5,0x41433923,0x00200020,0x00000000,0x00000000,0x00000000,0x398518c3,0x00003985,0x08610000,0x00000000,0x00000000,0x00000000,0x20a21060,0x00001060,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x28e20000,0x418220c0,0x180051c3,0x20603902,0x080030c1,0x10401040,
-0x18e10020,0x18c12121,0x106062ea,0x00000000,0x08200000,0x00000000,0x31221080,0x498120a0,0x8bc97307,0x836672c5,0x7ae58b67,0x838793c9,0x83487b26,0x62458369,0x6aa78b69,0x6aa56265,0x8b894981,0x72a572c5,0x93ca9bca,0x6a859c4c,0x5aa57308,0x49e37328,0x398141c2,0x18401840,0x20201840,0x41232040,0x52485a49,0x49e75aaa,0x52284a07,0x52485248,0x7b8d7b8d,0xa4b15247,
-0xa4afb532,0xbd53944e,0xbd74acf2,0xde78ad12,0xad13734c,0x8c0f7bad,0x29224a06,0x31232922,0x39633122,0x39434184,0x39624184,0x20c03121,0x52244161,0x20804162,0x49a349a3,0x5a4549e4,0x51e449c4,0x5a653961,0x7b495224,0x72e85202,0x72e75a22,0x62446a85,0x6a646264,0x6a4282e4,0x51a07ac4,0x38e072c7,0x7b054160,0x49806201,0x5a607b25,0x18801860,0x00001080,0x000041a5,
-0x08411061,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00001881,0x10820000,0x00000000,0x00000000,0x00000020,0x00000000,0x31041041,0x000020c2,0x00000000,0x00000000,0x08200000,0x29020000,0x20c11060,0x08001860,0x00001040,0x18a10000,0x00000840,0x00000840,0x49e60820,0x10800000,0x00000820,0x20e25288,0x29002920,0x4a0228c0,0x28e05223,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08610000,0x00001081,0x00000000,0x00000000,0x00000000,0x18c20000,0x00002903,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x18601880,0x392030e0,0x20a049a2,0x31220800,0x00001880,0x20c03962,
-0x31640000,0x000020e3,0x5a890800,0x41c64a27,0x00000820,0x10200000,0x28a01000,0x93c86264,0x72e56222,0x7b067b47,0x7b069c0b,0x6a846263,0x5a236263,0x39404180,0x208049a2,0x31018baa,0x102028a0,0x39206244,0x93a92020,0x628572c7,0x394128a0,0x5a4420a0,0x52247b2a,0x10006288,0x51a330e1,0x51c46205,0x31225225,0x4a074206,0x5a893144,0x52697b6d,0x526983ce,0x83ce83ae,
-0xa48fa4b0,0xacf0bd52,0xc5b58c0d,0xc5b5acb2,0xb5539c91,0x94718bee,0x28e239a5,0x31633163,0x41851860,0x41a539a4,0x49c449a5,0x31004183,0x52034181,0x28a05a25,0x28e02080,0x100041a2,0x41a341c3,0x31003100,0x18605204,0x28c02900,0x5a252040,0x51c330c0,0x62653920,0x20207ac5,0x62218b27,0x6a647b06,0x72e63900,0x6ac349c0,0x5a226ac4,0x28e03120,0x00000820,0x41e62924,
-0x29040000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x29241062,0x00001061,0x00000820,0x00000000,0x00000000,0x00000000,0x18c21081,0x00000000,0x39851881,0x00000000,0x00000000,0x00000000,0x00000000,0x10001040,0x10201000,0x10200800,0x10810000,0x08200000,0x00000820,0x18800000,0x08200000,0x4a2718c0,0x4a470820,0x00000000,0x28a018a0,0x6b083982,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x106118a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20c20820,0x31231881,0x100020a0,0x51c33100,0x104028c0,0x00000800,0x000020c2,0x62ea0000,
-0x00000000,0x20e118a0,0x08001860,0x188020a0,0x00000840,0x10600000,0x62833120,0x6a436284,0x72e56aa4,0x72e68348,0x51e15221,0x20c030e0,0x0800838a,0x08005267,0x29016b07,0x102020c0,0x6ae91860,0x49e26286,0x49c230e0,0x6aa71840,0x52247b27,0x49c28beb,0x28e049c4,0x28c12080,0x832928c0,0x83697ac7,0x628793cb,0x526749e5,0x5a892922,0x52487b8d,0x8c10736d,0x9cb18c0f,
-0x944db512,0x8c0cb511,0xb5318bcc,0xa4d2a490,0xad33b554,0x7bae9470,0x392341c5,0x31632901,0x39623943,0x728251c1,0x59e04960,0x52235223,0x51e23962,0x10004162,0x49a330e1,0x20a220c0,0x39830840,0x39a23141,0x208041c2,0x10601880,0x100020a0,0x10201000,0x39411860,0x00002080,0x6a833900,0x72a46262,0x7b066a84,0x62636aa4,0x626372e6,0x41a241a1,0x00001881,0x00001081,
-0x00000000,0x31440000,0x39a55aaa,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10610000,0x00000000,0x00200000,0x00000000,0x00000000,0x08412925,0x00000000,0x00000000,0x08000000,0x08000820,0x18611861,0x00000000,0x00000840,0x00001061,0x00000000,0x00000000,0x39a40800,0x18c12102,0x10600000,0x00000000,0x18400800,
-0x18a15248,0x082120e4,0x08410000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31860000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x08001041,0x00001060,0x08000000,0x08001041,0x00000800,0x18a00800,0x28e120a1,0x394149c3,0x00000800,0x186041a1,0x18a02901,0x4a261040,
-0x00000800,0x39620000,0xa4ae7326,0xad105201,0x08007309,0x51e46ac9,0x72e67308,0x7b277b27,0x83486264,0x6a6449a0,0x28e05224,0x41a25a24,0x41823960,0x31623982,0x398320e1,0x20e15267,0x08001040,0x62a45223,0x10203961,0x104020a0,0x18201000,0x18201000,0x20602060,0x31025205,0x49a31800,0x8b895a03,0x52259c0c,0x49e45a67,0x6aeb3983,0x6aeb62aa,0x8c0f6aeb,0x9cb0acf2,
-0xacf0acf1,0xbd518bca,0xb511b511,0xa4b18c0d,0xb5749c70,0x942f942f,0x31423164,0x41843963,0x49814183,0xccecc4ac,0xc48ac4aa,0x5a625a01,0x520441a0,0x18603961,0x28e041a2,0x29240800,0x20c11060,0x29003100,0x20a01020,0x10003982,0x102028a1,0x20a00000,0x08001860,0x394241a2,0x51e08baa,0x72e67306,0x49605a42,0x93eb4160,0x6ac47326,0x00005a65,0x08004206,0x18c20000,
-0x00000000,0x00000000,0x49e518a2,0x00002060,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001041,0x00000000,0x00000000,0x00000000,0x00000000,0x18c32945,0x00000000,0x00000000,0x00000000,0x00000000,0x10600000,0x00000820,0x28c21020,0x00000800,0x00000000,0x00000000,0x00000020,0x20a10800,0x10620800,0x29030800,
-0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000820,0x10400840,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x10201881,0x08002061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18810800,0x41a43143,0x732949c3,0x52047b49,0x31201020,0x522528e0,0x62a728e0,
-0x734962c7,0x73076b07,0x5a441000,0x6ae76ac7,0x28e041c4,0x398249e3,0x62861040,0x20803100,0x39404182,0x08000000,0x39630800,0x39423983,0x210049c4,0x08403163,0x00000000,0x00000000,0x00400000,0x39631880,0x4a0718c0,0x08000820,0x6b0b20c3,0x00001860,0x00000000,0x20a11860,0x30e03101,0x59e338c1,0x5a468349,0x52275226,0x7b8d5206,0x41c662ca,0x5aaa736d,0x942f9c91,
-0x9c6e9c8f,0xbd72accf,0xbd52b4f1,0xb5548c0d,0xad138c0f,0x9430942f,0x18a041c5,0x418428c1,0x5a033922,0xccebe5af,0xc4a9c4ca,0x418051e0,0x39803960,0x30e05a64,0x41a228e0,0x08403160,0x18c10800,0x10401020,0x31403982,0x41815224,0x8beb41a1,0x39405224,0x39004161,0x51e34121,0x8369940c,0x49806ac4,0x28e030e0,0x39640820,0x10203142,0x00000000,0x00000020,0x29240000,
-0x00000000,0x00000000,0x00000000,0x52061880,0x00001020,0x00001081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10600800,0x08001881,0x00000000,0x00000000,0x00000000,0x31650000,0x00000000,0x00001061,0x00000000,0x00000000,0x00000000,0x08000000,0x08000000,0x000028c2,0x00000800,0x00000000,0x00000000,0x08200000,0x10402923,0x10600800,
-0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00001062,0x00000000,0x00000000,0x00200000,0x00000000,0x00200000,0x00202924,0x00000000,0x10600820,0x10200840,0x08201881,0x104041e6,0x00002924,0x10201000,0x08001000,0x00000000,0x00000000,0x00000000,0x08201060,0x18602100,0x08001880,0x732a3984,0x6aa75a66,0x83ac72e8,0x942c3120,0x5a46730a,0x62667b29,
-0xad0e7b68,0x49c07307,0x62845a22,0x10403120,0x102062e7,0x394228e1,0x49e31000,0x310028c0,0x18a01080,0x39841040,0x20c2736b,0x00000000,0x00000020,0x00000000,0x00000000,0x00200000,0x00000821,0x082018a3,0x00000000,0x00000000,0x08400000,0x00000000,0x00000000,0x00000000,0x08200800,0x31020800,0x7b4b2040,0x62886b0b,0x524830e2,0x6b0b732b,0x52486aea,0x8bed6aca,
-0x9c4da4b0,0xbd72acae,0xb4afc5b3,0xb554b532,0xad139c70,0xa4d18c2f,0x18a13141,0x41a43102,0x73073924,0xdd6cedf1,0xcd0cd4ec,0x72e68345,0x5a6549c1,0x62851820,0x51e24181,0x7b493941,0x08405264,0x41a23940,0xad106ac6,0x6ae683c9,0x83ab49e2,0x72e57b27,0x51c04160,0x5a021800,0xa46eacd0,0xa46e2040,0x00000800,0x18816268,0x41a50000,0x080020c1,0x00000000,0x00000000,
-0x000018a1,0x00000000,0x00000000,0x4a070000,0x18a04184,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18c30000,0x00000000,0x00000841,0x10820000,0x00000000,0x00000000,0x00000000,0x000010a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x10400800,0x00000800,0x08000000,0x18811020,0x00000000,0x00000000,0x08010820,
-0x106120e3,0x00000000,0x00200000,0x00003186,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39a50000,0x188018a1,0x20a12902,0x08003123,0x28c21000,0x10611881,0x00000000,0x00000000,0x00000000,0x20a10800,0x10401840,0x39a53144,0x18610800,0x08000800,0x10601860,0x10602922,0x83cc3963,0x73086ae8,0x7b6b7308,0x184028c1,0x83cc7309,0x62c81020,
-0x316318a0,0x49e35206,0x290149e3,0x08202903,0x00000000,0x00001061,0x10610000,0x00001061,0x00000000,0x10400800,0x00000820,0x00003163,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x00000000,0x00000000,0x000018a2,0x00000000,0x00000820,0x08000000,0x31021020,0x730a30c0,0x49c55268,0x398549a5,0x736c5aa9,0x526818a1,0x942e5a68,
-0x8bcba4d0,0xb5119c4d,0xb4cfb552,0xacf2acf1,0xacf2a4d2,0x5a6883ee,0x080020c0,0x29011860,0x498530e0,0xdd8dbccf,0xc50cd50b,0x41c17b26,0x28c03980,0x7b286ac6,0x62654181,0x41a249c2,0x73281860,0x83888368,0x83688ba9,0x6244c570,0x8b869c0b,0xac8fa46c,0xcdb36a86,0x28603920,0xbd2f940c,0x082020e0,0x00000000,0x084041a4,0x41c518c1,0x20e21880,0x082018a2,0x08000000,
-0x000020c2,0x39e70000,0x00000000,0x00000000,0x08000820,0x00000000,0x00000820,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x526a0000,0x00200000,0x00000000,0x08200000,0x000039c6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20a220c2,0x00000020,0x08000800,0x08000000,
-0x5aaa5a8a,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200821,0x00000020,0x00002923,0x18a13145,0x20c12902,0x00210800,0x00000000,0x20c10000,0x00000800,0x00000000,0x00000000,0x312228c1,0x100018a0,0x18802020,0x20c03122,0x00201040,0x00200000,0x31630000,0x5a883983,0x20a041e5,0x39413121,0x39430800,0x00001000,0x29415a86,0x31622100,
-0x00000820,0x20a00800,0x18a11001,0x00000020,0x00000000,0x00000000,0x00200000,0x00000020,0x00000000,0x00000000,0x20e10000,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00001882,0x00200020,0x08201081,0x20c03142,0x39621860,0x49e528c0,0x52064a27,0x52483923,0x6b0a6b0b,0x83ad20c2,0x7b4b732b,
-0x9c4da4b0,0xb510acae,0xacafa4d0,0xa4f2a4b0,0xa4d2acf2,0x522783ce,0x10602921,0x18601840,0x28a11820,0x9ba94905,0x59a3bc6b,0x08002060,0x39411860,0x39003940,0x730830e0,0x28e12060,0x18406285,0x62434140,0x51c149a1,0x6a6672c7,0x38c0d5b1,0x41808b67,0x39203920,0x416351c3,0x6ac551e2,0x3921a44c,0x00001820,0x108020e1,0x20e10820,0x18a141c5,0x08000820,0x10400000,
-0x00001040,0x00000000,0x00000000,0x00000820,0x5aa80000,0x00000000,0x10400800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08001020,0x00000841,0x102028c2,0x08001060,
-0x00000000,0x00000000,0x00000000,0x00000800,0x08001040,0x186018a1,0x08201040,0x00003164,0x00000841,0x00001060,0x00000821,0x08410000,0x10400000,0x00000820,0x00000000,0x00000840,0x00000000,0x00000000,0x00000000,0x20a11840,0x00000000,0x08000000,0x20e13982,0x29013142,0x52465286,0x31235a67,0x41622040,0x20c13102,0x00000000,0x00000000,0x080020c1,0x18a01880,
-0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39e62103,0x00000840,0x00000000,0x00000000,0x08410000,0x00000000,0x10200000,0x29240820,0x00000000,0x00000000,0x08000800,0x00001861,0x10210820,0x31022061,0x31013101,0x51c528c1,0x51e34161,0x8b496265,0x62a86a65,0x7b6c5aa9,0x6b2b5a89,0x8bcd8bce,
-0x8bcbacd1,0xa48e9c4d,0xa4b0acae,0xacf2ad12,0xa4f29c90,0x7b6d8c2e,0x316320e0,0x418441a4,0x18603963,0x416328c0,0x39424183,0x102041c3,0x18401000,0x72836242,0x72838325,0x080038e0,0x8c0c0800,0x9c4c940b,0x7b684140,0x51c272c9,0x8b484141,0x62408346,0x41807b26,0x52033940,0x5a2230e0,0x30e0acad,0x398262a7,0x084018c1,0x00002102,0x20c21040,0x20e20800,0x00001881,
-0x08410000,0x00000000,0x00000000,0x10610000,0x08000000,0x08007b8d,0x20c30800,0x10403144,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000018c3,0x082020e3,0x00000000,0x10610841,0x00000000,0x00000000,0x00000000,0x00000841,0x00000000,0x10001000,0x00000820,0x00000000,
-0x00200000,0x29031040,0x08000000,0x10200800,0x18604a07,0x080028e2,0x080018a1,0x00003985,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x10202080,0x08000000,0x18400800,0x00000800,0x41a32901,0x52675245,0x080051e5,0x18810800,0x08200800,0x00000000,0x00000000,0x00000000,0x42070000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x000018a1,0x00000840,0x00200000,0x00000000,0x21040000,0x00000000,0x20e30000,0x00001860,0x000018e3,0x00000000,0x18201020,0x000028c1,0x10200820,0x18201000,0x18401840,0x41631860,0x9bcc4943,0xa42c8b48,0x72a89c0b,0x83ce838c,0x732b734c,0x83ac8bcd,
-0x940c940e,0xaccf9c2c,0xa4b0a46d,0xa4d1a4f1,0x9cb19c90,0x62aa8c2f,0x20e13162,0x20803102,0x312128c1,0x20c01020,0x310149e4,0x312241a3,0x31001880,0x93a87b05,0x8326a40a,0x186051e0,0x628728c1,0x31001820,0x72e71040,0x836962a5,0x28a01000,0x080030e0,0x8b6949a3,0x7b293920,0x62635a23,0x6aa66264,0x4183942e,0x00000000,0x10610000,0x08000820,0x20c10820,0x00003144,
-0x00000000,0x00000000,0x00000000,0x08200000,0x08605a69,0x18410820,0x00000000,0x18411840,0x08000800,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4a480000,0x00000000,0x00000000,0x21240020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00410000,0x00000000,
-0x39831020,0x288028e0,0x31022080,0x10401860,0x10400800,0x00001020,0x00000000,0x00200000,0x00000000,0x00000020,0x00000000,0x00000000,0x29020000,0x00003123,0x49e60000,0x000020c1,0x00200000,0x08400000,0x08000000,0x39420800,0x41821880,0x41624182,0x186041a1,0x41a320c0,0x49c45225,0x08001020,0x08000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00005acb,
-0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x08610000,0x00000020,0x00000000,0x00000000,0x31640841,0x00003143,0x00000000,0x00000000,0x08000800,0x00000000,0x31441861,0x10403165,0x00000000,0x08000000,0x20801860,0x29031881,0x00001061,0x20e11040,0x10201840,0x5a063101,0x9c4d6267,0x940c93eb,0x8baaa46e,0x7b6d7b6c,0x838d6aeb,0x942e8bcd,
-0x8bca9cb0,0xacd0944c,0xad119c8d,0xad33ad33,0xad33ad13,0x3923ad13,0x418341a4,0x51e449c4,0x418328e0,0x39423101,0x49e45a46,0x392049c4,0x49c349c3,0xbcec93ca,0xac6cac8b,0x398393ca,0x31403981,0x52265a26,0x51e52080,0x7b284142,0x30c03920,0x10001840,0x20602080,0x18001000,0x41c31840,0x41a41020,0x31013122,0x4a045a85,0x08410000,0x08410000,0x082041c7,0x00000800,
-0x08410000,0x00000020,0x00000000,0x00200000,0x00000000,0x00007bcd,0x00000820,0x08000800,0x08001000,0x00000000,0x00000000,0x08000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000841,0x41e80000,0x00000821,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08400000,0x00000000,0x00000000,
-0x5a064162,0x30c03121,0x31021840,0x08001020,0x00000000,0x00000000,0x00001061,0x08410000,0x00000000,0x00000000,0x00000000,0x10400840,0x290320c2,0x082020e2,0x49a50840,0x18a11021,0x08000800,0x10400800,0x10200800,0x28c01000,0x49c33140,0x52435a24,0x290049e2,0x6ac841a3,0x20a11020,0x00002903,0x00000000,0x00000000,0x00000000,0x00000000,0x000018c3,0x630c5acb,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000841,0x00000000,0x080041e6,0x186020c2,0x080020a1,0x20613102,0x084028c2,0x20a11880,0x00000000,0x10401060,0x08000840,0x20604184,0x106120a0,0x084018a2,0x10400800,0x28a01060,0xe71c38e0,0xf73bffde,0xce37942e,0xa4d1de98,0xa4b3842f,0x83ed8c2e,0x9c918c2f,
-0x9c4e9c6f,0xad129cae,0xb573acf0,0xbdb5b594,0xad33b574,0x2081ad33,0x41c40800,0x49c33961,0x20a041a2,0x5a4628e0,0x41824183,0x5a6449e3,0x52235223,0xd5cf8349,0xb4accd6f,0x31216a85,0x00000001,0x00000800,0x18800820,0x6ac66ae5,0x28a08bca,0x8bcb6286,0x080041a3,0x10001000,0x08200000,0x00000000,0xe6981861,0x9c6e8c0c,0x944e7308,0x10200000,0x08201041,0x00000000,
-0x00200000,0x0000630c,0x00000000,0x00000000,0x00000000,0x39a50000,0x00000000,0x08200000,0x00000800,0x08200040,0x00000000,0x18411061,0x18c31020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20e30000,0x00000000,0x00000000,0x00000000,0x00000000,0x000018c3,0x00000000,0x00000820,0x00000000,0x00000000,0x00000000,
-0x6ae628e0,0x41603920,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10400820,0x00000000,0x00000000,0x00000000,0x08000800,0x00000800,0x39431860,0x31011000,0x10001840,0x39621840,0x29003120,0x49c349e4,0x49c449c3,0x31204a02,0x312149c0,0x41a35a66,0x08012080,0x00003123,0x292318a1,0x00000000,0x00000000,0x00000000,0x00000000,0x000041e7,
-0x00000000,0x00000000,0x00000840,0x0000a513,0x00000000,0x00000861,0x00000000,0x00000000,0x10400800,0x00000000,0x20c20840,0x18203923,0x41832080,0x41825225,0x28c13922,0x08201020,0x20e23142,0x00000000,0x08000000,0x10610800,0x28c02901,0x18a020a0,0x10201020,0x10600820,0x49c22080,0xfffff635,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7beffff,
-0xdedba514,0xfffff7be,0xffffffdf,0xffffffff,0xf79df7be,0xd6faffbd,0x4142ffdf,0x49823900,0x49a349c3,0x414228a0,0x41424983,0x72e749a2,0x5a2372e8,0xb48f6245,0x93c9d592,0x30c06a85,0x00000821,0x00000000,0x00000020,0x00000000,0x20200841,0xb4ee4983,0x838883a7,0x5a876b08,0x000020e3,0x10610800,0x08000800,0x7b2962e9,0x10005223,0x39434a01,0x00000840,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x10410000,0x20e120e2,0x52467b4c,0x08200000,0x00000000,0x00000000,0x08000841,0x18810800,0x00201040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x084118a2,0x00000020,0x00000000,0x00000000,
-0x186020a0,0x18803963,0x18600800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20e20000,0x00000000,0x08000800,0x18400800,0x28c03120,0x49e320a1,0x08001020,0x5a6520a0,0x290041a2,0x62a73962,0x4a0441c3,0x4a043982,0x398041c3,0x524541a3,0x314020a0,0x41c24a03,0x20e13141,0x00002903,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x736d5aca,
-0x00000000,0x00000000,0x00007bcf,0x00002944,0x29230000,0x20e21060,0x00000000,0x00000000,0x18820840,0x00000000,0x08001061,0x208028c1,0x41831840,0x28e028c0,0x18402080,0x10811860,0x08203123,0x00000000,0x00000000,0x000020a1,0x310228e1,0x188028c1,0x102018a1,0x28a00800,0x936c30a2,0xffbfe698,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdfffff,0x59e0acd2,0x394130c0,0x31003962,0x41623921,0x49a351e4,0x6a8649a2,0x414051e3,0x7b0851c1,0x93ab938b,0x51e26a85,0x29021020,0x10604a07,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x63092921,0x00000820,0x08200820,0x00000000,0x08600000,0x5a264182,0x73293100,0x0000734a,0x00000800,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10411060,0x41c63165,0x20e31882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18a20000,0x08002124,0x00000000,0x00000000,0x08200840,0x00002124,0x00000000,
-0x18603962,0x08000000,0x18603102,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18610800,0x292218a0,0x39412900,0x49a22880,0x62455204,0xa4d03963,0x52068bcd,0x312020a0,0x524520c0,0x08001860,0x39820800,0x08001860,0x39c22080,0x08003984,0x08001860,0x10401000,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x108020e3,0x318518c2,
-0x08410000,0x00000000,0x00000000,0x000041e7,0x18600000,0x39833964,0x000018a0,0x08001040,0x10610800,0x20e20000,0x104018a2,0x18201860,0x28a030e1,0x39613962,0x312320a0,0x104020a1,0x10211861,0x00200000,0x18a20000,0x10401020,0x18402080,0x18801020,0x10401881,0x49401821,0x83498282,0xffdfff9e,0xf7bef7be,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7feffde,0x4161f77c,0x41413920,0x39413100,0x41623921,0x206028a0,0x49c330e0,0x59e55a25,0x5a016225,0x624472e5,0x49803920,0x49c24162,0x420041c3,0x00002104,0x00000000,0x00000000,0x00000000,0x00010000,0x00000001,0x21040000,0x106141c7,0x10600820,0x39630000,0xa48f3164,0x942c4183,0x31425225,0x10203161,
-0x00000861,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39a61081,0x20e30800,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x000018a1,0x00001061,0x00000000,0x00000841,0x00000000,
-0x20a30000,0x08001061,0x00000800,0x29220000,0x21015a88,0x00001060,0x00000000,0x08000800,0x10201061,0x20e11040,0x28e01840,0x49e349e4,0x4a045244,0x39626286,0x4a0562c8,0x62a749e4,0x28c028e1,0x41a42080,0x18803122,0x20c00000,0x00000800,0x00000000,0x00000820,0x31656b2a,0x18801880,0x18805247,0x08200820,0x39640800,0x39651840,0x08200800,0x732b2922,0x29231880,
-0x000010a1,0x00000000,0x08200000,0x00000000,0x28e21040,0x20a03943,0x20c11020,0x102020e2,0x08000000,0x080020c2,0x08001860,0x28c11041,0x28c03102,0x312128e1,0x20a128c1,0x20811000,0x080018a1,0x08000820,0x08000800,0x18601020,0x20802080,0x186020a0,0x18601860,0x498028c0,0xb46dac08,0xef5eff9e,0xf77ef77f,0xffffffdf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffcffbd,0x9babffff,0x41404100,0x39214983,0x49823941,0x31013921,0x49a341a3,0x30e028a0,0x390030e0,0x39408b8b,0x5a2449a2,0x414049a3,0x49e328c0,0x73295a65,0x31630800,0x00001081,0x00000000,0x00000000,0x00000020,0x00000000,0x00000000,0x10600800,0x39830820,0x31010000,0xbd52942d,0x4a017329,0x392149a3,
-0x08401000,0x10210000,0x00003145,0x00000800,0x084020e1,0x00010820,0x00000000,0x29241040,0x10610000,0x00000820,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31650000,
-0x00000000,0x00000000,0x00000000,0x08000000,0x18c02081,0x18a00000,0x41642922,0x00000800,0x31621040,0x314120c0,0x39825226,0x52455a67,0x49c35224,0x6ae741c3,0x41c33141,0x18a049e4,0x08001880,0x52061000,0x084039a4,0x00000820,0x10403142,0x00000000,0x08200841,0x08405ac8,0x080020c1,0x080041e6,0x10003963,0x31641040,0x31850000,0x18600000,0x104041c5,0x29032903,
-0x00000820,0x00000000,0x00002103,0x00000000,0x31420820,0x39613942,0x208028e0,0x186028c1,0x08000820,0x102028e2,0x08001060,0x28c11881,0x28e22080,0x186028c1,0x20601840,0x20a11840,0x20c20800,0x10400820,0x08002081,0x18601020,0x31012080,0x20802080,0x28e128c0,0x61e049a0,0x2860a42b,0x7aa9d5f6,0xf77eef5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdeffff,0xfffdffbc,0xff9df719,0x7a807ac3,0x31006a40,0x30e03921,0x28c04162,0x418349a4,0x31203922,0x49a23961,0x5a438bcc,0x51c25a04,0x6a856aa5,0x93ab6247,0x72e64980,0x39405245,0x39415226,0x31216286,0x00006b2a,0x00000000,0x00000000,0x00000000,0x08200000,0x10400840,0x49c541c4,0x7b694183,0x73085224,0x31013900,
-0x290049c3,0x52270800,0x20a01880,0x188062a7,0x10203981,0x28e13143,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x08003164,0x39640800,0x28e141a6,0x314139a2,0x186049c4,0x29221860,0x5a464a25,0x4a055205,0x49e43962,0x49e462a7,0x39a249e4,0x106020e0,0x08000000,0x000018a0,0x20c10000,0x00000000,0x31640000,0x104020a1,0x080018a0,0x41c33983,0x08000800,0x00000000,0x18803143,0x10201000,0x08003984,0x20a20800,0x41a60800,0x290220a1,0x082020c2,0x106020c1,0x18a20840,
-0x08200000,0x18c30000,0x00005aaa,0x08200000,0x18601860,0x18403962,0x208128e1,0x28c11840,0x08000800,0x08201040,0x10401020,0x10001881,0x20a12080,0x18201020,0x208020a0,0x188020a0,0x18401020,0x20404163,0x5202a42d,0x10000800,0x28a06246,0x30e03901,0x39204141,0x624149a0,0x93ab7263,0xeefbcdd6,0xf79ef77e,0xffffff9f,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe654f73b,0xfffffffd,0x8ae1fffe,0xa408ac28,0x6240ac28,0x41824142,0x39623100,0x39413941,0x28c01840,0x39203940,0x93ed5204,0x52033920,0x834951e3,0x49a07b09,0x7b0751c2,0xa44f6aa6,0x62447307,0x62a67b28,0x62e79c4d,0x62a739a2,0x00000020,0x08200821,0x18822924,0x31431861,0x28e21040,0x51e26286,0x7b088b89,0x6a866aa6,
-0x52034181,0x62a649a2,0x5a6628e1,0x62a85245,0x08001000,0x20a128c2,0x20821820,0x00001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x20a10800,0x20a02900,0x18803962,0x41a33101,0x520549e4,0x52454a05,0x41c420a0,0x39824a26,0x20a03141,0x41a328c0,0x6ae83121,0x188041c4,0x20e10000,0x732a28e3,0x082039a3,0x39a40000,0x00000000,0x41c50000,0x31633142,0x20c01060,0x18001040,0x10001820,0x00000000,0x29010820,0x41a42080,0x00003122,0x08000800,0x08201040,0x08000800,0x08202923,0x20e21060,0x08200000,
-0x00000840,0x00000820,0x08000000,0x18a10000,0x08000800,0x31023942,0x20a11860,0x31021020,0x18801880,0x186020c1,0x10400820,0x186020c2,0x20a120a0,0x396320a0,0xf73b28a0,0xa48f0800,0x41a230e0,0x51a34141,0x8327e5f3,0x494230c0,0x51c36a66,0x41624162,0x51a330a0,0x62425a01,0x93ab6a22,0x9c304985,0xffdfc5f7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffbdffff,0xfffeffdd,0x9c09ffdf,0x93a79bc9,0x7aa39be8,0x39214162,0x20a030e0,0x39413941,0x208028a1,0x5a2530e0,0x28a03921,0x41621840,0x39004121,0x30a059c4,0x51e372a6,0x6ac66a86,0x41208bcb,0xb510bd71,0x8baa6283,0x310049e3,0x08002900,0x420639e4,0xbd932923,0x20c149e6,0x10201040,0x41417b4a,0x836972e7,0x51e26265,
-0x7b285203,0x31205a44,0x29008bec,0x31208beb,0x31423982,0x08003941,0x08001000,0x00000000,0x00001061,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x31811060,0x39411840,0x52453962,0x52245224,0x62865a65,0x52045a45,0x292341c3,0x08202922,0x4a240800,0x210149c4,0x39a30000,0x080039a2,0x20803142,0x184028e0,0x31220800,0x39835205,0x00000000,0x31630000,0x08200000,0x20a02080,0x20a028c0,0x10001000,0x00000800,0x20e00000,0x18400800,0x18203943,0x10001000,0x082020c2,0x00000000,0x08204a06,0x00000820,0x20c20000,
-0x21030000,0x18a20000,0x08000820,0x28c10000,0x18401040,0x28e13102,0x28e22080,0x184028c2,0x20a01840,0x18801840,0x18401820,0x28a02860,0x404028e0,0x8c4eff96,0xff7a79a1,0x83484140,0x8b8a6203,0x728693cb,0x8b6750e0,0x5161a36a,0x4161a42e,0x41414121,0x49a130c0,0x622472a7,0xee366a03,0xd658a4b3,0xffffffbd,0xfffff7ff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffbdffff,0x93c98ba9,0x8b4693a8,0x31213121,0x30e03101,0x394228a0,0x41a349e5,0x6ae828c0,0x39213100,0x31213121,0x28a03101,0x51e35a04,0x51c25a03,0x41414140,0x30c072c6,0x9c0b4140,0xacaf72a6,0x51c251c2,0x39645205,0x52272080,0x9c4d62a8,0x39626ae8,0x08001860,0x940b51e5,0x51e27b49,0x7b088b89,
-0x62236a65,0x626530a0,0x08000000,0x100020c0,0x28c03100,0x72e849e3,0x51e520a0,0x08000000,0x08000000,0x184030e2,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x52244a03,0x5a6549e3,0x6ae962a5,0x62855a65,0x5a665a64,0x49c241a3,0x316341c3,0x7b6c41c4,0x1040ad12,0x00001060,0x10400840,0x10402921,0x31402922,0x39633140,0x5a6762c9,0x20603122,0x082028c1,0x39c50000,0x082018a2,0x396328e1,0x29003121,0x08001020,0x00010000,0x41c52923,0x10001860,0x20c03943,0x18803962,0x000020a2,0x00000000,0x314320c1,0x39842902,0x08000820,
-0x00001060,0x00002103,0x18a10000,0x18601061,0x100020a0,0x28c12080,0x10201840,0x18202081,0x20a01840,0x186028a0,0x38c01880,0x6204eef6,0x6060fffb,0xff98f5b1,0xff378a42,0x61c1b46c,0xddb2dd91,0x7ac63920,0x48c01800,0x59c14920,0x28805a04,0x5a054121,0x49a23920,0x6a664961,0xac4f5960,0xff7dd639,0xffbdff7c,0xfffffffe,0xffdfffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf79dffff,0x93eacdf5,0x7b058367,0x28c028c0,0x31014162,0x41c428c0,0x41a320a0,0x418249c4,0x49c33121,0x28e049a3,0x49a23921,0x5a0451c3,0x414051c2,0x498130c0,0x520251e1,0x30c05202,0x49e372e7,0x41406a85,0x72e99c0d,0x10003121,0x940c1861,0x18806287,0x18601020,0x18201000,0x62657b28,0x9c2d49a1,
-0x5a036a85,0x59e36224,0x41624161,0x39411860,0x28e049e3,0x6ac70800,0x186049c2,0x520620a0,0x31021000,0x18001020,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x39615a46,0x62c951e4,0x62c87b8a,0x41c05244,0x836b2920,0x18605a25,0x29200001,0x49e43982,0x100020a0,0x00210000,0x29400000,0x52062080,0x18205a47,0x41814184,0x30c14182,0x39423921,0x20c05225,0x41c51040,0x31210800,0x28e12901,0x290028e2,0x00201840,0x00000000,0x20c00000,0x28c020a0,0x31013943,0x31013942,0x08001840,0x00200840,0x20e10020,0x29030800,0x28e220c1,
-0x10401881,0x10400000,0x00001082,0x20801080,0x20a028e1,0x104020a0,0x10602080,0x39032080,0x312030c0,0x414120a0,0xc3684105,0xac4dff56,0x4800f756,0xfffcf5eb,0xbd2a5900,0x62256160,0x6aa4a44b,0x7a852880,0x390051e3,0x59a330e0,0x3940acce,0x49821040,0xa44e2060,0x7b072080,0xfed91800,0xf75cbd12,0xfefacd73,0xfffeffff,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffdaffff,0xfed9ffbd,0xffffac4c,0x5a02ce58,0x28e02900,0x392228c0,0x28a030e1,0x394230e0,0x31213101,0x396230e1,0x28a04182,0x52252080,0x41a249a2,0x28a23120,0x49a33940,0x62455203,0x5a045a04,0x392030c0,0x520351c2,0x310251a2,0x31411081,0x20801860,0x000028a0,0x00001040,0x49601840,0x72c76245,0x5a03836a,
-0x5a036242,0x6a646a86,0x41224961,0x49c351a2,0x72e849c3,0x39216286,0x394049c2,0x6aa75a23,0x184030e1,0x10201020,0x00001001,0x00000841,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000821,0x00000000,
-0x52044181,0x49a162c6,0xa42d5a03,0x28a04143,0x62a851e5,0x00201000,0x52682922,0x39620800,0x10000800,0x00000000,0x29010000,0x31223121,0x29005206,0x100020c0,0x39412080,0x20a028c0,0x18401840,0x41a420c1,0x28c128c2,0x18401000,0x39622900,0x290228e1,0x00000820,0x20e218a1,0x39621040,0x30e13943,0x18603943,0x31241841,0x08000000,0x10400840,0x18a11020,0x00001860,
-0x08001020,0x20c11020,0x10200800,0x20801860,0x208028c1,0x186020c0,0x31213101,0x5a0493ec,0x8b2849a2,0xa3eba44d,0xbb4751a2,0xc4efd5b0,0x5940fff7,0xd5b24140,0x59a048a0,0xcd126a03,0xb4ae8b06,0x1800b4ae,0x8b093040,0x83498b08,0x7aa77a87,0x4162d594,0x62454121,0xe6d9d5b2,0x51c39caf,0xf75cbcf1,0xffdee73a,0xfffeff9d,0xffffff9d,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffefffe,0xffdeffff,0xcd53fffd,0xb42cffdc,0xacac4900,0x49c23920,0x4142bd51,0x39423101,0x394228c0,0x392128c0,0x39624162,0x20a03941,0x28a03101,0x41a220a0,0x30e028e0,0x28c02060,0x51c330e0,0x390059e4,0x39203920,0x28a04981,0x310030e0,0x08000800,0x00000000,0x08200000,0x28c24185,0x5a041000,0x5a248369,0xa44d5a23,
-0x72c68327,0x5a236a65,0x51a24981,0x520338e0,0x416049c2,0x51e24180,0x28a04141,0x49c349c2,0x31003101,0x20a04161,0x49c63101,0x00003985,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x49e13100,0x00003940,0x00001880,0x00000001,0x39a50000,0x08001040,0x18820000,0x20803125,0x28a120a0,0x08001860,0x28e028e0,0x41a43962,0x39830800,0x08001020,0x08001801,0x18400000,0x10201860,0x394228a0,0x10002080,0x39430800,0x312128e2,0x39403981,0x416328c0,0x00001020,0x39421000,0x20804163,0x10002081,0x10000800,0x20a11081,0x10401020,0x20a10800,0x188118a1,
-0x08201860,0x10400800,0x30e22081,0x28c128e1,0x080028c1,0x30c01000,0xfffc7b09,0x6242f6d6,0x9c298b27,0x514059c0,0x7182d595,0x92a58241,0x50001820,0xfffc82c0,0x48c040c1,0x40404960,0xbbeb8b07,0x18405162,0xcd932020,0x3000ac8f,0x4101938b,0xa4f1836a,0x82c62880,0xe636ff9a,0x2882a536,0xffbda44f,0xfefcde9b,0xffdeffdd,0xffdfffde,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xff9cffdd,0xeebbe632,0xe673cd2b,0xf738d531,0xffbc6226,0x62436a82,0x3900b4cd,0x39423100,0x28c030e0,0x31013121,0x392128a0,0x39224182,0x41623942,0x392249c4,0x28a030e1,0x418328a0,0x39002080,0x49623921,0x49a35a24,0x39224982,0x30e1838d,0x102030c0,0x08000020,0x6b0820c1,0x62236ae7,0x51e15a22,0x93cb93eb,0x30c030e0,
-0x72c56224,0x626451c0,0x51e072c6,0x28c06243,0x20605203,0x52044182,0x5a243940,0x31004181,0x5a044142,0x5a244981,0x39423920,0x00003102,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x002010a2,0x00000000,0x00200800,0x00000000,0x00000000,0x00005aab,0x00000000,0x00000000,
-0x396149a2,0x49a34183,0x39627b49,0x082030e0,0x00000000,0x00000000,0x186028e2,0x39434164,0x312249e6,0x10003123,0x396328e0,0x28c11000,0x31211840,0x08002080,0x41c53123,0x20c062ea,0x102020c1,0x314128e0,0x39421020,0x520641a5,0x39623962,0x39423142,0x39423101,0x08401040,0x39431040,0x10203142,0x08001020,0x208020a0,0x20601000,0x10402081,0x10000800,0x18601840,
-0x18601860,0x28a02060,0x28a030c1,0x00001000,0x9c0b3020,0x28403921,0x8a8492a6,0xfe757a65,0xee76b428,0x7a21c50f,0x40e0ff79,0x72012800,0x40c05181,0x28607ac5,0x83471000,0x41418347,0x8b4a2840,0x30e05162,0x40e02040,0x49846247,0x8b096ac8,0x8bccff59,0x93ac6a88,0xe6fbff19,0xbd77b5f7,0xff7c71e2,0xde9af79e,0xffddff7d,0xffbdf79d,0xffffffff,0xffffffff,0xfffefffe,
-0xffffffff,0xffffffff,0xffffffff,0xffddffff,0xeeb8ff9c,0xf6f7ee76,0x82e4f79e,0xee977aa4,0xa389ff17,0xb4cd51c3,0x416128a0,0x412028a0,0x49c35a02,0x310028c0,0x28e02060,0x20a020a0,0x20a03141,0x28c03121,0x31021000,0x30e020a0,0x498441a2,0x39403941,0x30e030e0,0x30e04141,0x08000800,0x394141a2,0x20c128e0,0x10001860,0x6a836ac4,0x416051c0,0x7b6a3901,0x62668b8b,
-0x72c66223,0x6a837ae8,0x72c65a02,0x51c25a02,0x51e35a03,0x390049a2,0x49c249a2,0x41a24182,0x49a25225,0x390038e0,0x39204962,0x394151e3,0x00001040,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18c21061,0x00004207,0x00000000,0x18c30020,0x29040000,0x08410821,
-0x08403983,0x00000000,0x00001020,0x31421040,0x000020e0,0x08001860,0x394330e1,0x41a65a47,0x310320a2,0x080041a6,0x18800800,0x184049e5,0x39621000,0x31231860,0x10200800,0x41e40800,0x29212921,0x39423121,0x41a33122,0x39423942,0x39423961,0x416249e4,0x30c13962,0x28e03101,0x28e03142,0x20a13122,0x20801840,0x186028c0,0x20a12081,0x186028a1,0x18401020,0x18601020,
-0x18601840,0x28e028a0,0x30603120,0x6a6669e5,0xc50e48c0,0x82a78306,0xddf3dd30,0xe530aba8,0xe5b2ac49,0xf5f348e0,0x59c0ee76,0x8346bcae,0x40a059a3,0x30c0d592,0x8ae72860,0x522459c3,0x41a52080,0x20a03982,0xc53149e5,0x39226aeb,0x4102838e,0x5a46cd51,0xac6facb0,0xe6dc9430,0xa4f5b5d5,0xee997a64,0xc5d7defc,0xfeb9ac71,0xff3aeed9,0xffbdff9c,0xff9cffbd,0xfffeffdd,
-0xfffefffe,0xffffffff,0xffffffff,0xff5bffff,0xee32ff19,0xf677ff3a,0x8307fffd,0x61c2b4f0,0xffb9ee74,0x49616245,0x286030c0,0x20602040,0x28a04162,0x39616244,0x28e04163,0x28e020c0,0x18601840,0x31013100,0x394330e1,0x08004163,0x20601860,0x30c12040,0x30e15a05,0x39014983,0x498393ed,0x38e04140,0x30e04141,0x62444980,0x51e18306,0x49a06242,0x8bec9c4e,0x836949a3,
-0x838acd93,0x6a857327,0x6a646244,0x5a026223,0x49805a23,0x49a14160,0x41824161,0x41814182,0x41825a45,0x5a046224,0x49a249a2,0x49623920,0xb48ea42e,0x000028a0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000062ab,0x31250840,0x000020c3,0x00000000,0x18810000,0x41851020,
-0x49e441a2,0x62e85a87,0x41c42900,0x49e42080,0x18403120,0x398228e1,0x62ca5a88,0x4a075a68,0x39853144,0x41852903,0x31205225,0x31214182,0x31021820,0x49e63122,0x18400000,0x31020800,0x310228e1,0x31213121,0x41c43983,0x31013963,0x31413962,0x52255206,0x49c43142,0x28e020a0,0x31013121,0x18403142,0x28e03101,0x102020a1,0x20a01860,0x106020a1,0x10601060,0x20a01880,
-0x28a018a0,0x208030e0,0x28a04121,0x20205122,0x93885161,0x69c140c0,0xee15a308,0xd52efe75,0xdd508ae7,0x72637b48,0x622261e3,0x3860dd4f,0x30a072a8,0x8bca2880,0x72862880,0xb4f23901,0x4a075a47,0x5227ce16,0x41852902,0x52065207,0x51a451e6,0x930b8b8b,0x8bab3142,0xb5b89c52,0xdebce71e,0xdcef5a43,0xff7ecd54,0xf71bef1b,0xff9dff9d,0xff7bffbd,0xffbeff19,0xfffefffe,
-0xfffefffe,0xffffffff,0xffffffff,0xd5f4ffff,0xfed6bc8d,0xffdeff9c,0xffdbe6b8,0xbcd0a4af,0x72c5fffc,0x392172e7,0xffbc8b6a,0x51a361e5,0x30a03901,0x51e30800,0x4161940c,0x31213962,0x20c028e1,0x28c128c1,0x31021020,0x41c428e0,0x28c149e5,0x08006ac9,0x41621000,0x730951e4,0x626630c0,0x30e049c0,0x28a03100,0x6a854160,0x62236aa4,0x8b8a4140,0xa42d59e5,0x6a868b8a,
-0x28c0838a,0x5a237b26,0x62234980,0x7b0851c2,0x49816aa5,0x5a0259e2,0x49615a03,0x414151a2,0x5a675204,0x51a35a47,0x39004981,0x59e451a2,0x59e36a45,0x000038e0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18820000,0x08001061,0x00000000,0x00000000,0x29030000,
-0x10602902,0x08001020,0x29001860,0x41c22080,0x20c01000,0x52474a05,0x49e65227,0x52285248,0x41c64a07,0x28c13985,0x31202080,0x39423920,0x41a45a25,0x394341a4,0x49c5a4f2,0x31221020,0x418441a4,0x20c03962,0x31013121,0x20811840,0x31413122,0x41a349c5,0x31013942,0x31213101,0x29003101,0x310128e1,0x28e028e1,0x28c120a0,0x20c028c0,0x188020a1,0x18600820,0x30e028a0,
-0x312051e4,0x18200800,0xf6f72820,0x3080c4ae,0x72c67b08,0x7a04bccf,0xe656b40b,0xb554f6f9,0xbcd038c0,0x7b2849a3,0xa40da44c,0x62035204,0x38c07286,0x5a2530a0,0x624720c1,0x5a67834b,0x5248730a,0x5a8920c2,0x41c7a514,0x94303925,0x6aec41a6,0x31439c70,0x000051c6,0xc61abd77,0xa536c61a,0x62023164,0xcdf8cd33,0xff5cef1b,0xf6fbff7c,0xfed9f6db,0xffbcff9d,0xffdefffe,
-0xffddffdd,0xfffefffe,0xfffefffe,0xe655fffe,0xc572acae,0xc46cff79,0xffdbfed6,0x82a7a3ec,0xc550e5f4,0x49828b89,0x5204a46e,0xc53130a0,0x49833900,0x6aa68348,0x7b2830e0,0xfef893cb,0x208028e1,0x20802080,0x20801840,0x20801840,0x62a85a47,0x396362a8,0x28a028c1,0x62a66ae8,0x41805203,0x30e030e0,0x30e03920,0x49c149c1,0x49a05a22,0x834872c7,0x624472e7,0xa46d3900,
-0x62233921,0x6aa551a0,0x59e24140,0x72c759e2,0x5a2349a1,0x59e25a03,0x62655a03,0x5a045a04,0x62455a24,0x5a045a25,0x624449a2,0x49814982,0x39404140,0x206059a1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x20612081,0x10001000,0x310020a0,0x394128e0,0x49e43101,0x524749e6,0x52485247,0x5a8a5227,0x52485a89,0x39423904,0x49c43100,0x41623942,0x4a0549a3,0x41843942,0x10201000,0x20c02080,0x31412901,0x28e12080,0x28a02060,0x10200800,0x290120a2,0x39423122,0x312220a0,0x310128e1,0x28c01860,0x28c03101,0x28e02922,0x416330e0,0x28e130e0,0x18602081,0x31202124,0xfffc59c3,
-0x31209c0d,0xd5b1ff7a,0xbccfff7b,0x7349ee59,0xff19c5b4,0x8a64c5b3,0xc4f3c510,0x93f0f75c,0x18203923,0x836a3924,0x6a057286,0x49627226,0x10005227,0x20a06aa9,0x310118a0,0x41a45a67,0x52073943,0xad343144,0x41e75289,0x7bae3165,0x520862ca,0x41c14183,0x94713165,0x6aee8c33,0xc63abdfa,0x6a64b553,0xe69b7266,0xf73b7ae8,0xff7cef1b,0xff9bff1b,0xffffff9c,0xffddfffe,
-0xffbdffbd,0xfffeffdd,0xfffefffe,0xfffefffe,0xcdb4fffe,0xe5b4f697,0x5160f634,0xff1a9baa,0xfffeb48e,0xa53241c3,0x944d4a04,0xfef90820,0x38c06a85,0x72e48ac7,0x10002040,0x51e36245,0x208028a0,0x20801880,0x186020a0,0x10201040,0x18201840,0x28c130e0,0x49e64183,0x626651e4,0x41805203,0x39403920,0x28e041a1,0x7ae85a44,0x5a006242,0x62416221,0x834a7b28,0x838a5a04,
-0x7b085a04,0x6a859c0c,0x5a044981,0x72e73900,0x41207b07,0x5a235a03,0x6a6551a2,0x62677309,0x6a6651e3,0x62656a67,0x5a465a04,0x51a26a86,0x41004120,0x6a454940,0x7b2a30a0,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x39213100,0x00003942,0x31005226,0x312141a3,0x398128a0,0x524649e3,0x6b2b732b,0x6aeb736c,0x396449c6,0x28a030e1,0x394228e0,0x31213121,0x39634183,0x41a41880,0x28e15226,0x31011880,0x30e03101,0x312220a0,0x39223942,0x314128c0,0x28e120c0,0x31013121,0x312228c0,0x28e13142,0x290120c0,0x39632901,0x6a8772e9,0x628749a4,0x83aa72e8,0x302041a3,0x0800f71b,0x9be8a3aa,
-0x48a09368,0xff9aff59,0xbc90dd71,0x938cc532,0xabec938d,0xabea7224,0x8aa6bcd0,0xa556ee37,0x52283104,0x7b8d0800,0x10002860,0x41c43964,0x10203963,0x20a028e1,0x080039a4,0x312028e0,0x39433121,0x292441c6,0x62cb630c,0x6b2d6b0c,0x6aeb4a09,0x52482902,0x9cd57bb2,0xcdfaad37,0xb575bdb7,0xb552bdd6,0xff1abc8c,0xcd7438c2,0xa4915a06,0xfefbf6f9,0xfffdff7c,0xfffefffe,
-0xffbdffde,0xffbdffbd,0xffddffdd,0xffdeffbd,0xffddffbd,0xc4cbe675,0x9348ac09,0xffbcf6f9,0x5181de57,0xc553ffbd,0xf6766140,0x414130a0,0x30808b8a,0x41603880,0x51c24121,0x28a07b08,0x28a03120,0x20a02080,0x394220a0,0x20a028c0,0x10401860,0x080020a0,0x20a01000,0x30e03100,0x52035a24,0x52025202,0x52023120,0x7b086aa6,0x72e872a6,0x6aa751e4,0x72c76aa7,0x7b297308,
-0x9bec6245,0x6a855a04,0x49414140,0x39214120,0x6a646a85,0x51a16244,0x59e359e3,0x51a251c2,0x51e36264,0x39006225,0x52254161,0x51c259e4,0x51a25a03,0x51814120,0x412259e4,0x41a551e3,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x39634183,0x08003963,0x49c341a4,0x100028a0,0x5a664164,0x62c962a9,0x62ca6aea,0x498562c9,0x51e53923,0x18201840,0x28e02060,0x28a028c0,0x41a328c0,0x39631020,0x31213121,0x39013941,0x39013901,0x39422901,0x39223942,0x208028c1,0x28e120c1,0x31013101,0x418328e0,0x39633942,0x5a675205,0x5a665a46,0x51a4a46f,0x49a44183,0xa42f838b,0xb44b0800,0x7b06def6,0x9bcae5b2,
-0xcd30edd1,0xce96f696,0x8bd08bab,0x730a8c50,0x8b6c730b,0x8b2bb44e,0x8c0fbcd4,0x7c51a452,0x943041c7,0x9cb359e8,0x6b4d1000,0x5ac973ef,0x08007b8c,0x18801862,0x20803142,0x31403962,0x312362a7,0xa4b241c6,0x62ec20c4,0x314662ec,0x39c55a8b,0x4a283165,0xb5d7528c,0xde5cad16,0x734cffff,0xe6565a06,0x4102ff5c,0xffbdffff,0xff5cff7c,0xffbeff9c,0xff1aff7c,0xffbdff7c,
-0xffbdffbd,0xff7cff9d,0xff9dff9d,0xef1bffbd,0xff9dffbd,0xffbdff9d,0xe696e698,0xff99d5d3,0xf7bcf77c,0xde98fffc,0x208051e4,0x28a03100,0x51610800,0x7b072000,0x62432040,0x49613900,0x20800800,0x28c01840,0x31222901,0x18603101,0x188120c0,0x080018a0,0x20a01000,0x51e43121,0x41823901,0x41605202,0x51e241a1,0x5a425a44,0x72e73920,0x6ae76ae7,0x41606a87,0x49c372e7,
-0x93cb7b08,0x6a857ae8,0x59e34140,0x6aa74982,0x6a646aa6,0x622351c2,0x62245a03,0x414051a1,0x62444140,0x62656aa6,0x18604981,0x62243921,0x728551c2,0x59c25181,0x5a055141,0x522259e6,0x20c141a3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x18403102,0x20a12060,0x31221880,0x312228e1,0x49e54184,0x5a675226,0x62a85a67,0x5a475247,0x28c13102,0x184028c0,0x28e03921,0x30e03100,0x394149c4,0x39413941,0x414241a3,0x39204142,0x31013901,0x39423901,0x39213100,0x31013921,0x39424162,0x39614162,0x5a6649c4,0x49c37308,0x52057b2a,0x8bac5a47,0x6a87832a,0x5a466ac8,0xcdb3a42e,0xbbca3060,0xffdbff35,0xa4f1d677,
-0xedb5bc8f,0x9471c513,0x7bcfad35,0x31248c30,0x49646269,0xa4b29bee,0xd6179c71,0x94b43986,0x6aeb7bd0,0x526a5229,0x7bd094b3,0x18a22105,0x10810860,0x18a01880,0x18602921,0x29003962,0x41625204,0x62c93942,0x6bb0ad15,0x5acd632f,0x4209632d,0x5aad6b6f,0xc61a41ea,0xdebaa4f5,0xff7cdeb9,0xf73af719,0xf73c72a9,0xf75cff5a,0xffbdffbd,0xff9cff9d,0xffbdff7c,0xff1affbd,
-0xff3aff3a,0xff7cff7c,0xff7cff7c,0xff9cff9c,0xffbdffbd,0xff9cff9c,0xf75cde15,0xe6b9bd32,0xf73aff9d,0xf719acb1,0x418393ee,0x08007b29,0x5a282080,0x414072e9,0x20c030e0,0x416130c0,0x20805a43,0x396220c0,0x28c020c0,0x20803122,0x188028c1,0x10401060,0x20802080,0x30e03942,0x39203920,0x39414181,0x41813900,0x5a246265,0x51e36245,0x6a866a86,0x39205a03,0x52045a26,
-0x72a79c0c,0x8b8b6246,0x7b09832a,0x72c57b08,0x6a647b07,0x49a07b06,0x49a15a02,0x5a026223,0x6a8551c2,0x834872a6,0x6a866264,0x41401800,0x51a251a2,0x38e051a2,0x6a4559e3,0x59a338e0,0x51e359e3,0x10401860,0x00001041,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,
-0x10002060,0x41a31820,0x08000000,0x41842080,0x4a055a87,0x39435227,0x28a030e1,0x30e120a0,0x30e128a0,0x6ac928e0,0x41414162,0x39204121,0x41814141,0x39414981,0x41424162,0x41424183,0x49a54163,0x5a265205,0x496251c4,0x51c34982,0x51e349a2,0x520451e3,0x62a75a06,0x628651e4,0x5a466267,0x418430e1,0x6267c553,0x49a462a8,0xacaf832a,0x82035182,0xddf3c56f,0xb592e6b6,
-0x9c739430,0x52aa732d,0x52aaa515,0x39a66b6c,0x30e48c11,0x7baf836e,0x5228734d,0x7c11526a,0x312541e9,0x8432630c,0x21469d15,0x7bcf4a8b,0x0800630c,0x5aa662ea,0x6ae820c0,0x28e03100,0x28e05a45,0x7b2e836c,0xe75e3126,0xa5586b70,0xad998434,0x6350a559,0x94b694d6,0xf73dd65b,0xffbcffde,0xbd91fffb,0xde7b8346,0xfffe5840,0xff9dffbd,0xff9cff7d,0xf73bff9d,0xff3bff7c,
-0xff5bff7b,0xff7cf73b,0xff7cff7c,0xff9cff9c,0xf77cffbc,0xff7bff7c,0xffbdff19,0xffbdffbc,0xe698ffbd,0x8b47ee77,0x8c0d2860,0xde350000,0x8bcb30c0,0x3121accf,0x6ac728c0,0x39001820,0x3120a4ab,0x10400800,0x41c41880,0x20a03942,0x18802080,0x20a11880,0x28c228e1,0x28a028c0,0x39413920,0x416230e0,0x51e351e4,0x51c351e3,0x5a235a24,0x49a15a03,0x51c35a24,0x18004161,
-0x39002020,0x6aa65a24,0x7b096a86,0x624451c3,0x6a8559e1,0x6a8372e6,0x62446a85,0x62236264,0x62235a02,0x62656244,0x51816244,0x51c251a2,0x51a251c2,0x410040e0,0x59e24940,0x51a24120,0x836b5a23,0x5a4451c2,0x39224982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x184030e1,0x10200000,0x20a03943,0x20803101,0x30e13922,0x30e049c3,0x394130c0,0x39413100,0x41613920,0x41614162,0x496130c0,0x59e35182,0x51a251c3,0x41824982,0x41634183,0x312349a5,0x49c41020,0x7ae74983,0x516261e4,0x49625182,0x49834962,0x392051c4,0x51e549c3,0x5a6749a4,0x6ac949c5,0xbd7449c5,0x838c7b4c,0x83298bee,0x6a447b2a,0xdc8dbc6c,0xe612b40b,0x942fd5d4,
-0x8c13a4d3,0x7bf162cd,0x841073af,0x62eb6b4d,0x5a6a7baf,0x734d6b0d,0x83f15aaa,0x5b2d39a8,0x94935aac,0x6b4fad76,0x94d6ad99,0x42096350,0x10812945,0x31414a06,0x52473140,0x394120a0,0x41a33120,0x5a8d3123,0x526c41ea,0x084439a9,0x6372b61b,0xa51831cb,0x9cf8bdfb,0xf73cce1a,0xde36ffbc,0xf79dffff,0xfffd79e1,0xfeb8ffdd,0xff7cff9c,0xff5bff7c,0xff3aff7c,0xff5bff7b,
-0xff7bff5b,0xff3aff5b,0xff7bff5b,0xff9cff7c,0xff5bf73a,0xffbdff9c,0xffbdffbd,0xffbdffbd,0xee55ffde,0xfffcee56,0x49c449c2,0x000051c4,0x3100f719,0x41422020,0x10006264,0x49812880,0x30a08bcb,0xffffffdc,0xfffe62a8,0x310141a4,0x29002080,0x20c028c0,0x20a01860,0x186020a0,0x41a420a0,0x31013921,0x59e549a4,0x51c34962,0x520351e3,0x41615a24,0x49c44181,0x5a255204,
-0x28c028a0,0x7b083100,0x72c66266,0x7b2972a6,0x6a8572c7,0x7b286244,0x5a246aa6,0x5a2359c1,0x72a56a65,0x62444980,0x49804120,0x59e24120,0x6a8638e0,0x5a0251a1,0x49404940,0x41006203,0x496059c1,0x624472c6,0x49805a24,0x18603900,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x184030e1,0x18001840,0x208028c1,0x20a020a0,0x30c03121,0x49a32880,0x414151c4,0x49814961,0x5a0351a2,0x626551c2,0x498059e2,0x390059c3,0x62254961,0x396451e5,0xa42fc595,0xce7ab575,0xb4d0c5f6,0x8b087287,0x61e47286,0x494151c3,0x624651c3,0x498259e4,0x5a6749c4,0x416349a4,0x734b6b0a,0x52077b2c,0x9c309430,0x6a677b6d,0xa44e93cd,0xdd526a25,0x7ac74040,0x94329c30,
-0x8c547bb1,0x9494d63b,0x738f9d16,0x5acc6b2d,0x7bcf8c52,0x6b2d5acb,0x62ed7bd0,0x5aec736f,0x62cc8c52,0x4a4a9cd5,0x19076330,0x632e10a5,0x18c2632d,0x42043123,0x39643141,0x41612900,0x49c420a0,0x7b902904,0x528d422b,0xad784a2b,0xe75f94d6,0xb5ba9d18,0xad9aad9a,0xef1aff9e,0xffbdeed9,0xf7beffbc,0xfef9fe97,0x3080ff9b,0xf6f9ff7b,0xff5bff1a,0xf6faff3a,0xff3aff5b,
-0xff3aff5b,0xff5bff5b,0xff5bff5b,0xff7bff5b,0xff9cff7b,0xffbdff9c,0xffbdffdd,0xffddffbd,0xb4afffde,0xa42c82e7,0x28c072e8,0xf73b8bca,0x6a664123,0xff9bffbc,0x30c06a64,0x41604983,0x51a0fffb,0xcdd2ff9c,0xcdf3ef1b,0x39624142,0x312120a0,0x20a11860,0x208020a0,0x28e11840,0x182028e2,0x18401860,0x20601000,0x38e03942,0x49a251c3,0x49823100,0x5a463941,0x49a36246,
-0x7b095204,0x41613100,0x308051e3,0x392059e3,0x8b897b08,0x7b277b28,0x5a236264,0x7b286a43,0x49606a65,0x51c26aa4,0x62454980,0x498051e2,0x6a854980,0x49806244,0x728551a2,0x41206202,0x49604960,0x39206244,0x624451c2,0x286051c2,0x18801840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x20802060,0x20c02901,0x310020a0,0x28c02040,0x49823940,0x39213920,0x72c83900,0x59e25a03,0x5a024960,0x51c35a24,0x624459e4,0x28806244,0x9288fffe,0xbd35ffff,0x9c126a8c,0xce1a83d1,0xac4fe71c,0xa40e7a87,0x61e372c7,0x49a26245,0x41824982,0x5a675a67,0x31236ac9,0x49a549c6,0x5207732c,0x52695a48,0x9c108c30,0x8b6d938f,0x9bee72ca,0x9bccffff,0x72cb5125,0x7bd183b0,
-0x73d2a537,0xc63a4a6c,0x5acd7bf1,0x94b4528c,0x6b6f62ed,0x73af73d0,0x73b073d0,0x4a6b422a,0x5aac9492,0x5a8d6b2f,0x4a6b7c12,0x8c52632e,0x10a15aeb,0x39855289,0x73ad39a5,0x392020e0,0x5aaaa4d1,0x8c32c5f8,0x7b91a4f6,0x8c547370,0x63529d38,0xb5bb9d18,0xadbbadbb,0xee9ad61c,0xff7cf71b,0xf6b8ff9c,0xff3beef8,0xfffedd75,0xff1affbd,0xff3bff3b,0xeeb9ff3b,0xf6faf6fa,
-0xff1aff1a,0xff3af71a,0xff3bff3a,0xff5bff5b,0xff7cff7b,0xff9cff9c,0xffbdffbd,0xffddfffe,0x7b07f73a,0x39001020,0x41829c2e,0xee7628c0,0x9c90ef1a,0xa46dfffe,0x30c051a0,0x9bcb38e0,0x48a0ffff,0xffdefffc,0xfffffffd,0x41404982,0xef3818c1,0x28a0bcd2,0x20802901,0x18a020c0,0x20801880,0x18a13164,0x18401020,0x20811840,0x41632081,0x30e04162,0x41a25205,0x5a4549c3,
-0x30a051c3,0x51e34982,0x72c76245,0x72a65a24,0x834930c0,0x72c56a85,0x72e66265,0x62455a23,0x7b278b8a,0x62035202,0x62445a03,0x62046244,0x5a224160,0x6a646243,0x93a98328,0x51a172a6,0x59e24100,0x41406264,0x6a664120,0x416251a1,0x51a351c3,0x00003942,0x00000000,0x00000000,0x10820000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x28c02080,0x39422080,0x49a228c0,0x7b293960,0x49a3c574,0x49a251e3,0x51c251c2,0x6a844981,0x51c16223,0x30c06203,0x834d6a65,0xffdfffdd,0x8a87ff7f,0xc5b7d5d5,0xc5d8acf5,0x8432ce1a,0x838dbd97,0x7ac9bd15,0x51416aa7,0x49834962,0x628751e4,0x6b2c62a9,0x5a69bd96,0x41a639a5,0x4a085aaa,0x4a4a734e,0xa4b45acd,0x6aec8bd1,0x9c7262cb,0x31456aec,0x49874146,0x83f39453,
-0x7bf29cf6,0x84326b70,0x6b4ec5f9,0x5aed526b,0x6b6f4209,0x9cf5a516,0x84748453,0x52cd6370,0x4a6b3188,0x73904a2b,0x6b9073b1,0x6b91634f,0x29664a8d,0x39a6528a,0x634d39c7,0x6ac82962,0x7baf41c6,0x9cb439e8,0x94b594b6,0xad79a537,0x8cb67c34,0xadbb94b7,0xb5dbadbb,0xc5d9b57a,0xf6faff7d,0xc552ff7b,0x93cd8b2b,0xf6d9ee98,0xfef93860,0xf71beed9,0xf6faf71b,0xeeb9f6d9,
-0xf6faeeb9,0xff3af71a,0xff1af6fa,0xff5bff3a,0xff7cff7b,0xffbdff7c,0xffddffbd,0xfffeffdd,0xf719fffe,0xf6d77b29,0x28c2ef5b,0xe697de98,0xee99f71a,0xbcceff17,0xc58f72a3,0x49629326,0xff78ff39,0xf75cf719,0xf7dffffc,0x414061c1,0x7240d5d3,0xad10c572,0x31004140,0x290128e0,0x104020a0,0x18801880,0x310318a0,0x20a11000,0x10001020,0x20802080,0x49e45a26,0x39204161,
-0x51c23900,0x51e25a03,0x624451e3,0x51e25a24,0x51e24140,0x72c651e2,0x62445a24,0x626472e8,0x93eb3920,0x49c16ac7,0x72a66ac5,0x6a656a64,0x49805a01,0x5a026263,0x62628328,0x62426223,0x6a856a86,0x49a16223,0x62044140,0x39406245,0x41602880,0x28c06245,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x49a13920,0x49a24140,0x39204161,0x496059c4,0x498151a3,0x51e45182,0x5a0159c1,0x72c651e2,0x526561c0,0xffffa512,0xffffffff,0xff18e698,0xde97ff1a,0x6390cc93,0x8c54f71c,0xad559495,0xde5bdf1c,0xef5f2906,0x6206b4f6,0x622759a5,0x5a684183,0x7b6e62ea,0x4a485a8a,0x2925528a,0x5aab4a08,0x73b14a6c,0x422c7bb3,0xa4b5ad17,0x73907b90,0x7b71a4f5,0x9495422b,0x94757371,
-0x94955aef,0x8c328c53,0x7b905b2e,0x8453adb8,0x7bf26b6f,0x847494b5,0x94d6ad99,0xa5589d37,0x21463a0b,0x7bd19474,0xa537ad57,0x8cb6530f,0x31889518,0x526b4a2a,0x6b6f6b90,0x28a208c0,0x31651061,0x734fce19,0x4a8ead79,0xbdfa8415,0x9d386b51,0xa57a94b8,0xb5bbad9a,0xb5bbad7a,0xf71be6bb,0x7b4cbd95,0xe6da838a,0xe679fe77,0xfef959c6,0xf6faf73a,0xf6daf6fa,0xee98e657,
-0xeeb9ee98,0xee98f6d9,0xf6f9f6d9,0xff3af71a,0xff7cff5b,0xffbdff7c,0xffbdffbd,0xffddffdd,0xffdbfffe,0xa44da4d1,0xde577244,0xb552e6f8,0xfef87b27,0x592040e0,0x9b86fffb,0xf73849a0,0x9beaf696,0xeed8f79e,0xf7fffffc,0x49405940,0xc679ff9b,0x8c2dfffd,0x51a24940,0x28e24141,0x00001840,0x10401880,0x18401880,0x394320a0,0x184028e1,0x41851000,0x41624162,0x51e45a05,
-0x41604182,0x49a249c1,0x51e349c2,0x62242880,0x418049a2,0x51e25202,0x72c67b08,0x834851e2,0x8b8b7ae9,0x7b286ae7,0x6a666ac7,0x6a656244,0x628359e2,0x83497b26,0x6a824980,0x5a016aa5,0x72c672e6,0x5a026243,0x62226240,0x62264981,0x41412880,0x41624982,0x10206a86,0x00010000,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x416149a1,0x49813900,0x51e351c2,0x496051a3,0x498059e4,0x52024982,0x61e05a21,0x6ac54980,0xfffffffb,0xfffff7bf,0xffffffff,0xff5cffbe,0x93eeffbe,0xd63be69a,0xa4f56a49,0xbdb7ad56,0xbd98b5d8,0xbdfae6fe,0xffbfb557,0x49649bce,0x49e651c6,0x52296b2c,0x528a41a7,0x526b3166,0x5acd632e,0x9d168c94,0x8414ad7a,0x9cb6ad37,0xa4f683d2,0x73507bd1,0x8413bdd9,0xa4f7420b,
-0xc5fb9495,0x8432634f,0x8c126390,0xa537636f,0x7bf37bf2,0x6b919cf7,0xad999d17,0x63717c34,0x94938cb5,0x632f4a0a,0x8454420a,0x52ef52ef,0x318873f4,0x528c738f,0x5aef8433,0x31054aac,0x5aab7b6e,0xbdd9acf5,0xb5baa558,0xbddb9cf8,0xadb9d6bb,0xa559ad7b,0xb5bbad9a,0xad9aad9a,0xd659ce19,0xeebae6ba,0xf6fae678,0xff3b59c6,0xde1593ac,0xf6fafefa,0xf6daf6fa,0xcdb5d5f6,
-0xeeb9de16,0xee98ee98,0xf6f9f6d9,0xff3af71a,0xff7cff5b,0xffbdff7c,0xffbdffbd,0xffddffdd,0xff7bfffe,0xf719a4f1,0xffbdff9a,0xff5cff7b,0xddd6de16,0xe698a42a,0xde12fffc,0xff3a9bca,0xcd10ff7a,0xfffcd696,0xf7ffff9b,0x41203840,0xf7befffe,0xfffeffbd,0xacef0800,0xc5944121,0x7b4a51c3,0x186020a1,0x20a01860,0x31021860,0x100028c1,0x186020a1,0x310128a0,0x49c33921,
-0x41613901,0x5a244161,0x51c351e3,0x498130a0,0x20604982,0x5a234181,0x6a866245,0x6aa66aa6,0x6aa76223,0x51c38bad,0x6a866ac7,0x51c06244,0x8baa4120,0x62426264,0x83296a84,0x51a04980,0x6a6472a5,0x832972a5,0x62246a65,0x5a034120,0x414249a3,0x5a4328a0,0x49e46266,0x00002081,0x00000000,0x000039e7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x49a15a03,0x498149a2,0x49824161,0x498051a3,0x49a051a4,0xaba65a03,0x6b0250a0,0xffffc634,0xf7fff7ff,0xfffcffff,0xffffffff,0xffbeff3a,0x6962f697,0x41a85122,0x9cf4734b,0x8c12b597,0xd6dd5b2e,0xcebea537,0xcdbac61b,0x62287acb,0x31034144,0x62ed41c7,0x6b8f2926,0x31aa9d16,0x847673d3,0xbe1ca558,0x8c55a518,0x9d18bddb,0x6b519496,0x83d239aa,0x6b308433,0x8c134a2c,
-0x8c548413,0x74138454,0x62ee1906,0x94954aac,0x7bf27bd2,0x9d179495,0x847694f7,0x9cf873b3,0x5aedad99,0x528d8c31,0x21493189,0x73f373d3,0x21268496,0x420a528b,0x7c728453,0x3144532f,0x94533147,0xa51641a8,0xbdfaa577,0xad78b5ba,0xb5dabddb,0xa559a55a,0xb5bbad9a,0xad9aad9a,0xce19b599,0xac92d639,0xe5d6de39,0xff5beefc,0xff9ef6b8,0xf6fa5a46,0xeedaf71b,0xeeb8e677,
-0xde37c574,0xf6d9de16,0xf6f9f6d9,0xf71af6fa,0xff5cff3a,0xffbdff7c,0xffbdffbd,0xffddffbd,0xfffeffdd,0xf7bdffdd,0xffffffdd,0xf719fffe,0xf6f8ff9c,0xffffbd2e,0xac25fff9,0xff9beefb,0xf75affbd,0xfffdfffe,0xeffffe71,0x4980ac4b,0xffdfd656,0xffffffff,0xd5b38b07,0x28004920,0x828348e0,0x9c8ee6d7,0x20a01880,0x31022080,0x20a020a0,0x28c120a0,0x310228c1,0x394130c0,
-0x41622060,0x5a054982,0x51e34183,0x51e351e2,0x51e35a04,0x41815a24,0x5a036245,0x62455a04,0x39406245,0x8bcc6284,0x6a867b09,0x6a665a03,0x62628308,0x72e76aa4,0x72e36aa4,0x6aa56242,0x6aa54140,0x8baa6a64,0x6aa7838a,0x49c06284,0x59e56aa6,0x18002861,0x5a2549a3,0x394040e0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x49827308,0x51c349a1,0x51e449a3,0x39015204,0xacf230e1,0xffffff5e,0x5a00c280,0xffffffbd,0xffffffff,0xff9bffff,0xff7cffff,0xf75affff,0x6962e590,0x7b2c9410,0xdedc83d0,0x9c53c5f9,0xa5598cb5,0xce9dbe3c,0xd65cc67d,0x9c116a8b,0x52095249,0x424b2947,0x6b92630f,0x94f794b6,0x94d7c63d,0xad79bddb,0x8c55b59a,0x9cf794b6,0x3a0b62ef,0x631073b2,0x524c524c,0x31487bb2,
-0x8c958413,0x73d273f3,0x8c758454,0x84138454,0x84129495,0x84558413,0xa559adba,0x9d18a559,0x4a6b3a0b,0x8c75ad36,0xad79a538,0xb5fb8454,0x212663b2,0x738f39e8,0x5b2f630e,0x00018455,0xbd79732f,0xa4f5a4f6,0xb59ac63a,0xad79bdf9,0xce7cbdd9,0xb5dbb5b9,0xadbaadba,0xad9ab5ba,0xc5f9b599,0xa4f47b90,0xee78e75c,0x5a07de39,0xee37ee99,0x7a45b554,0xe6b9cdf5,0xde37de57,
-0xe657b4d1,0xe657d5d5,0xf6d9f6b9,0xf6d9f6d9,0xff3bff1a,0xffbdff7b,0xfffeffdd,0xffbdffdd,0xfffeffdd,0xfffefffe,0xfffffffe,0xfffefffe,0xfffeffff,0xe5aeffdc,0xff17fffe,0xfffefffe,0xff9dfffe,0xf75afffd,0xffffef19,0x4960e5f3,0xffff836b,0xfffdffde,0x6a03940b,0x28204941,0x82e848c0,0x6140cb87,0x394041a4,0x29003121,0x208020a0,0x186020a1,0x20a01860,0x18401840,
-0x41a33101,0x49c34181,0x5a4451c3,0x49c349a2,0x30e06245,0x51e251c2,0x51e35a04,0x5a2449a3,0x49c35a26,0x6a863920,0x59e472c9,0x6ac76266,0x5a046aa7,0x62847b28,0x6a8572e6,0x62235a22,0x51c25201,0x7b486243,0x39406aa5,0x72e78bab,0x28805a45,0x204062a7,0x39204162,0x41415a05,0x08002860,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x414059c3,0x51a449a3,0x398551e4,0xffffffff,0xffffffde,0xffdff758,0x5a64baa0,0xffffffff,0xffffffff,0xfffefffe,0xfffeffff,0xfeb4f735,0x6a65ffbc,0x6ac949a4,0x73af39a6,0x9d36ad77,0xad77b578,0x9d17a579,0xbddbce7d,0x8c13a4d6,0xc67c7bd2,0xa59994d7,0xb5fb73d3,0xbe1cbe1c,0xbe1bbe3c,0xbddbad9a,0x8434a518,0x8c369456,0x5b1194b7,0x6b926b93,0x5aee6b71,0xbdda9495,
-0xa59aa539,0x9d39a57a,0x7bf38454,0x630f7bd3,0x7bf27bd2,0x94f78434,0x8c9594f7,0x9d17b5da,0x6b906bd3,0x6393be19,0x5acf8434,0x6bd49cf7,0x18c6320c,0x39ea62ce,0x10c66b50,0x7c329d18,0x6aee41c8,0xbd987bb1,0xad99defc,0xad79b5d7,0xc5fbb5d9,0xd69bce3a,0xbdf9be19,0xb5b9bdda,0xc5fba517,0xce19b577,0xfe99e6db,0xd638ee5a,0x7ac9de58,0xce98e71a,0x936c7228,0xeeb8fef9,
-0xe657d5f5,0xe656de15,0xd5f6ee97,0xf6f9eeb8,0xff3aff1a,0xffbdff5b,0xffdeffdd,0xffbdffdd,0xfffeffdd,0xffffffff,0xffffffff,0xfffdffdd,0xffdeffdd,0xfffcffdd,0xffbfffff,0xfffeffff,0xffffffff,0xffffffff,0xfffffffe,0x4960fffc,0xf6d73941,0xfffdffff,0x616092c5,0x10002880,0xe611ff5a,0xffdfd6bc,0x6243c5b6,0x39213920,0x186028a0,0x208028c0,0x18402080,0x28a02060,
-0x208028c1,0x41615205,0x39414161,0x5a2428a0,0x498251c3,0x414238e0,0x51e46265,0x51e351e4,0x626549a2,0x414151c3,0x59e472a8,0x72c76286,0x730949c3,0x7b287308,0x72c672e7,0x62446a86,0x520172a7,0x730751e2,0x41a17308,0x7b296266,0x5a2449c2,0x7b4ad5f6,0x288049a2,0x30e01820,0x204028c0,0x51c52860,0x00001800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x620538e0,0xacf23922,0xa515bdb6,0xfffdf7ff,0xffbef79e,0xfe92f6f6,0x31e279c1,0xfffeffff,0xfffdffff,0xfffdffdd,0xf71be6d6,0x92c4ef3a,0xc4ee7286,0x41c65a26,0xa4f4b5d7,0xb5da8412,0xad79a538,0xce9ec67d,0xc63cc63c,0xbdfbad99,0xc63cbdfb,0xc61cc61c,0xb5fbce5d,0xbe3cc63c,0xc63cb5ba,0xc5fbad99,0x8435ad38,0x8476ce7e,0xa5599d39,0x6bf394f8,0x52ce6350,0x94558c34,
-0xa55ab5ba,0x6371b5fb,0x8c558434,0x84337bf3,0x73d3422b,0x7c347c34,0xa5989d18,0x8475b5da,0x847594d6,0x9d38ad99,0x5b105af0,0x9d598c96,0x004494d7,0x3a0b62ce,0x7c158cb6,0x94d75b31,0xb5372926,0xce398c34,0xce5bde9c,0xce1bb557,0xbdbabdfa,0xc619c61a,0xc5f9ce3a,0xc61ace3b,0x9475bdda,0xbdb8bdf9,0xd595acb3,0xd616de58,0xd636ff3b,0xeef9ff19,0x69e5d638,0x8b4affbb,
-0xe657e5f3,0xe677e698,0xeeb9eeb8,0xf6d9e699,0xff1af6fa,0xffbdff7b,0xffbdffdd,0xffddffbd,0xfffefffd,0xffffffff,0xffffffff,0xfffeffff,0xfffffffe,0xffffffff,0xfffefffe,0xffffffff,0xffffffff,0xffffffff,0xfffdffff,0x4980ffdb,0xff9c2020,0xfffefffe,0x2860d510,0xd5b32860,0x72024080,0x79a0e58e,0x410072eb,0x41838baa,0x49813921,0x00000800,0x188020c0,0x29020820,
-0x28e128e1,0x312120a0,0x39404182,0x20603940,0x28a03922,0x39214142,0x5a0549a3,0x51c45205,0x414251e4,0x51c34162,0x39414182,0x5a046ac7,0x182051e4,0x6a8772c8,0x622359e2,0x72c76264,0x6a657ae9,0x31005201,0x73086aa6,0x10007b4a,0x6ac66aa6,0x624749c2,0x6a876a88,0x62875a46,0x180049a1,0x51c52840,0x28a02880,0x00005aa8,0x00000000,0x00000000,0x00000000,0x00000000,
-0x49846248,0x734d8bce,0x7b4e6b0e,0xb510f73d,0xe71dfffe,0xfe55ef3c,0xd6b85940,0xee98ff9d,0xffbaffff,0xf6b9a42d,0xe6b7fedc,0x3986abe8,0xc511cdd9,0x630b6aa8,0x526ac618,0xc63c9cf5,0xd6debe1b,0xc65dc67d,0xc61cc63c,0xad9abe1c,0xc63cc61d,0xce5dc63c,0xbdfbb59b,0xc65dc65d,0xbdfba538,0xad38c63c,0x63314a2c,0x8c9652cf,0x8c96a559,0x53109cf8,0x6b916330,0x7bb27392,
-0xa57aad59,0x94d78c96,0x84547bf3,0x9d1894b6,0x8c9531eb,0x9d389d18,0x94d7a579,0x94b8a57a,0x9d1994b7,0xc67e9d5a,0x84768476,0xa5798476,0x08869d59,0x7bf37350,0x52f08456,0xad9973d4,0xb5160002,0xb5789474,0xcdfab517,0xd69b9413,0xbddaad78,0xce3ac63a,0xc5d9ce3a,0xad37b578,0xbdbace1b,0xbdb8bdd9,0xffde8bf1,0xd658c5d7,0xeed94963,0xd6368bab,0xffbee636,0xde369c2e,
-0xde36c573,0xe698d616,0xeeb9eeb8,0xf6d9eed9,0xff1af6fa,0xff9cff5b,0xffbdffbd,0xffdeffdd,0xfffefffd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffddffff,0xffffffff,0xffffffff,0xffffffff,0xffbdfffd,0x4961f719,0xbc8c2860,0xff79ffdb,0x3080bccf,0xe6153080,0x82e67ac7,0xb4cbf68e,0x4920fffc,0x51c23900,0x51a41800,0xff3c9bef,0x3120ff97,0x08001040,
-0x18401840,0x39613123,0x31213941,0x100028c0,0x41421840,0x20603921,0x41824162,0x62465205,0x28c049a3,0x49c451e4,0x18406a87,0x51e45a25,0x5a2551e4,0x28a05a04,0x62244961,0x41618349,0x7b085a24,0x62856a86,0x49e351e2,0x6ac75a44,0x52026ac6,0x49a16286,0x626649a2,0x51e46287,0x39006aa8,0x416230c1,0x49824121,0x51e541a2,0x000018a1,0x62ca0000,0x00000000,0x52690000,
-0x1820628a,0x83ae836e,0x9c726aac,0x62e85287,0xfffdf79b,0x3880de78,0xa4f45182,0xde94e6b8,0xe6f9c5b7,0xde9be6fb,0xddf5d637,0xce7c93ac,0x9470b492,0xb5368c30,0xa516524b,0x8475ad77,0x73d1c65c,0xadbcd6df,0xbe3dc63d,0xb5fcc63d,0xbe3dbe1c,0xbe3dbe1c,0xbe1cc63d,0xc63dc61c,0xc63cc61c,0xad59ad78,0x845673b4,0x6b93a53a,0x7bd41909,0x7bf429ec,0x7c138455,0x8c1483d3,
-0x8cb794b6,0x8c96a57a,0x9d178475,0xa55ab5db,0xadbb7c35,0x9d59b5fc,0xad9b9518,0xa57aa59a,0x94d88cb7,0x8cd78cf8,0x8cd85b52,0x9cf98477,0x10c873d4,0x73d46b52,0x843552b0,0x8c959d1a,0x93d23a4c,0x528f7371,0xb57ab59a,0xad58a518,0xbdbabd99,0xc5dac5da,0xbdb8c5d9,0xc5f9b577,0xa5179cd6,0xc5d9ad78,0xff3cdedc,0xcdd7cdd7,0xfefbe69a,0xe678bd12,0xde36f6f9,0xbcf0ee97,
-0xc594de15,0xde36de57,0xe699eeb8,0xf6f9eeda,0xff1af71a,0xff5cff3b,0xff9cff9c,0xfffeffbd,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffefffd,0xfffefffe,0xfffeffff,0xfffeffff,0xff5af7dc,0x4161fed4,0xcd524141,0x4961ff7b,0xbdb3ffb9,0x8b4b2880,0xf6f7d679,0xef5b6980,0x492072a3,0x38e049a1,0x4140c54f,0xff58e653,0x51c140e0,0x100028e0,
-0x20811880,0x30e11861,0x49c32060,0x39624183,0x396228c0,0x312128c0,0x396228e0,0x49a351c4,0x39424162,0x5a4649a4,0x49a36267,0x49c30800,0x51e34182,0x51e34141,0x49c25a26,0x51c351e3,0x28806245,0x730751c2,0x52056b07,0x6aa55222,0x51e56265,0x49c05a63,0x5a2651e3,0x72c96ac8,0x414351c4,0x30a03940,0x498338e1,0x080049a2,0x49e50800,0x000018a1,0x18a11060,0x00000000,
-0xbd34f6da,0xff5d838e,0x62aa732d,0xffff62aa,0x29015a89,0x59c041a3,0xc5534160,0x31002040,0xef1aeefb,0xd639e6dc,0x51c4ac6f,0xad98b554,0xa4f3c5b8,0x9453a4f5,0x9cd59cb5,0x9cf5a516,0xb5f9a536,0xb61d7c55,0xbdfcc63d,0xbe1cbe1c,0xbe3dbe1c,0xbe3dbe1c,0xbe1cbe1c,0xc63dc61c,0xb5bace5c,0x8c55ad38,0xa5597bf5,0xb5daad99,0x73b4a538,0x84765310,0x63917c35,0x528e52ae,
-0xa5186b50,0x7c349518,0x94f8be1c,0x9d39a579,0xb5bbb5dc,0xadbba539,0x9d3994f8,0x9d398cb7,0x8cb79518,0x95399518,0x53116393,0x7c158cf8,0x006673d4,0x7bf52969,0x29ab6b73,0xad998c78,0x51a9a619,0x52af8434,0x6b314a2d,0xc61ba518,0xb5babdba,0xb579b579,0xb598bdb9,0x9cd5a516,0xb578ad57,0xb537ad57,0x2882b576,0xde39cdf8,0xff1bbd55,0xcd94cdb4,0xde37c553,0xbd12bd32,
-0xe677acb0,0xcdd5de57,0xeeb9eeb8,0xf71af6fa,0xff1af71a,0xff5cff3b,0xff9cff9c,0xfffeffbd,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf79dfffe,0xffffffff,0xffffffff,0xffffffff,0xfffff7dd,0x4940f6f8,0xffbc2860,0xcd70ff58,0xddf57aa6,0x18002880,0xfff9b44b,0xffff5982,0x7282e77c,0x8b473920,0x3900d5d1,0x93045980,0x3920bc4a,0x30e01820,
-0x30e128c0,0x396228c1,0x188030e1,0x28e02080,0x31211020,0x184028e1,0x394220a0,0x49a34162,0x28a03922,0x6ac851e5,0x41425a66,0x6a8751c4,0x412030c0,0x49a23900,0x626751e3,0x498151c3,0x6a856246,0x62445a03,0x7b4a6265,0x52017328,0x6ac55202,0x4982836a,0x5a0551e4,0x5a466ac9,0x62266265,0x20004981,0x5a2651c4,0x312149c3,0x102083ab,0x08205a67,0x00000000,0x080062ea,
-0x9bce72ca,0x943083ae,0x62879c4f,0x51e549e5,0xacb0c5b4,0x41607b07,0x7bab7307,0x836a8bec,0x9c303942,0xcdf8cdfa,0xa576e6ba,0xadb98cd5,0xbdd8adba,0x9cb5ad58,0x94749d17,0x6ac94a2b,0xc67b4a28,0xbe3d7c35,0xb5dbbe3d,0xbe3dbe1c,0xbe1cbe3d,0xbe1cbe1c,0xbe1cbe1c,0xc63cbe1c,0xce7dce7d,0xad19a4d7,0xb5fa94f8,0x7c1594b8,0x8c966332,0x7c358435,0x7c558455,0x7bf494d8,
-0x74566393,0xaddb9d18,0x8c777c35,0xa57a9d19,0xad9aadbb,0xad9ab5db,0xa55a9518,0x9d399d19,0x8cb794d8,0x951884b7,0x84b78497,0x52b08cf8,0x10c773f4,0x7bf59cd6,0x8c966b73,0xa5588437,0x0000adf7,0x52efad99,0xad7a6b71,0x9cd694b6,0xa559ad38,0xb59aad79,0xbddaad99,0xa517b579,0xb578ad37,0x0822b5b9,0x4165d69b,0xd618d5f8,0xcdb6cdd7,0x48c0c572,0xeebbd5b6,0xd616d616,
-0xddf4de57,0xe698eeb8,0xf6faeed9,0xf71af71a,0xff1af71a,0xff5cff3b,0xffbcff9c,0xfffeffbd,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xf6f7eed7,0xfffeffff,0xffffffff,0xffffffff,0x5980ffbd,0xed713942,0xcdd4a306,0xf75bbcf0,0x28402880,0x72a5fef9,0xffdbe614,0xfffaf614,0x7aa24102,0xe6108327,0x0040c5b6,0x51a251a0,0x28806244,
-0xbd104181,0x520428a0,0x20a03120,0x20801020,0x31421860,0x312220a0,0x28c02080,0x310028a0,0x288028a0,0x49c328a0,0x5a053962,0x6aa75204,0x41416266,0x49814161,0x41815a05,0x51c351c2,0x51c24982,0x6a4451c2,0x838a6245,0x7b2a8bab,0x6ac572e7,0x41814181,0x5a465a04,0x39206288,0x51e551c1,0x626651c4,0x6a876287,0x30e04182,0x418151c2,0x6a674983,0x30e17309,0x52270800,
-0x4986832c,0x5a684186,0x3102a491,0x6aa88bad,0x7b295205,0x396051e2,0x49c349a1,0x8bea8beb,0xbd737328,0x6b0a838c,0xb5b8a4d4,0x9d17b5da,0xb598c63c,0xad37b599,0x9494b577,0xcebcce5c,0xa538b5b9,0xbdfca559,0xbdfcbe1c,0xbdfcbdfc,0xbdfcbdfc,0xbe1cbdfc,0xbe1cb5fc,0xbe3dbe1c,0xd67cce5c,0xb558b558,0xa538ad78,0x94d88477,0xa59b8cb8,0x8cb87c56,0x6bb37c36,0x9d398476,
-0xa59b94f8,0x9d39a57a,0xadbba57a,0xa59aad9b,0xad9aad9b,0xaddbad9a,0x8497a59a,0x8cf894f9,0x9d5a8cf8,0x953994f9,0x6bd49d7a,0x84568498,0x10a694f8,0x7bf49496,0x94f88c96,0x9d199cf8,0x1127c599,0x0025c5fb,0xa518a558,0xa5388455,0x94d78435,0xa559a539,0xad79a559,0x9cf7a518,0xb598a538,0xbdb8a4f7,0x6accad16,0xce18c575,0x7b4cc5d7,0x7a67bd33,0xef1ae5f6,0xeed9e677,
-0xeed9de57,0xde36ddd4,0xf6faeeb9,0xf71af71b,0xff3af73a,0xff7cff5b,0xffddffbd,0xffdeffdd,0xfffefffe,0xfffefffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xf79bffde,0xfffbff9b,0xfffffffd,0xfffffffe,0xffffffff,0x59a1fffe,0xf6984141,0x30405900,0xc5732020,0x28803900,0x20008ac9,0x822240c0,0x8ae44060,0xbd2f4140,0x9bc8a3c9,0xeed33060,0xff3651a0,0x392028a0,
-0x93e75180,0x8323a489,0x49a16263,0x31213120,0x310128e0,0x29012080,0x28e120a0,0x28e01000,0x30e03921,0x41824182,0x39413900,0x622549a2,0x62446a66,0x416251c3,0x49a349c3,0x498230c0,0x498149a1,0x5a2351c2,0x62445a43,0x7b086aa6,0x7b087b08,0x6ac77308,0x51c45a45,0x6a676aa8,0x51e430c0,0x28a051c4,0x59e45a25,0x5a2428a0,0x624549a2,0x52043941,0x310051c4,0x524628e0,
-0x7aeb6a68,0xffff7350,0x7b4b49c3,0x49e46aa8,0x6ac641a2,0x522151c2,0x73285202,0x39414163,0x62a59c6d,0x8cb40880,0xad79c65b,0xce7cbdfa,0x83f2a558,0x8bf17bb1,0x630e732e,0x8c95ad98,0xb5dba538,0xb5fc9d39,0xb5fcb5fc,0xb5fcb5fc,0xb5fcb5db,0xb5dbb5db,0xb5dbb5db,0xbe1cb5fc,0xb558bdfa,0xc5fabd98,0xa579b5b9,0xadbb8cb8,0x73f69d3a,0x847794d9,0xa55a8cb8,0x9518a59a,
-0xa57aa59a,0xad9ba57a,0xa59aa59a,0xa59aa59a,0xad7aa59a,0xa59aad9a,0x9d7aa57a,0x9d5a9d5a,0x84b79539,0x95398cb8,0x9d3a8cb9,0x73f47c75,0x7bf34aaf,0x84559cd6,0x8c767c14,0x94d87c15,0x8d5a9cf8,0x7bf3bd78,0x9cf6b5b8,0x9cf77c13,0x84779cf8,0x9d399d1a,0x9d399d39,0x8cb79d39,0xa538a539,0xad387b92,0xbd768bf2,0xc5b6c596,0xc5f7cdf7,0x6207c5d6,0xff59bc90,0xff5bff9c,
-0xff7bf73a,0xff9df6d9,0xf71bef1b,0xf73aff1b,0xff3af73a,0xff7cff5b,0xffddffbd,0xfffeffde,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffeffff,0xfffdfffd,0xffdcf7bb,0xffbdf676,0xfffffffc,0xffdcfffd,0x38a0ff9c,0xeeb628c0,0x62052800,0x6266ff3a,0x20401800,0x18209c0c,0x9c2cc50e,0x7262dd90,0xfef740e0,0x5120b4cd,0xfef58b27,0xe675fed4,0x59e17ac6,
-0x7ac37ae6,0x93677240,0x6a856a44,0x39813120,0x39613960,0x31203120,0x18603101,0x31011840,0x392130e0,0x41414182,0x39203941,0x5a0451e3,0x59e35a25,0x49835a04,0x39214141,0x416130e0,0x51e149a0,0x6a425a22,0x622259c1,0x6a8659c0,0x72c77b08,0x7b29836a,0x72e76285,0x62255224,0x5a054142,0x180051a3,0x51e46a87,0x30c030c0,0x51e351e4,0x5a266267,0x51c46266,0x49a249a2,
-0x30e2728a,0xde987b0e,0x52267b6b,0x5a055a67,0x5a225267,0x392049c0,0x20603940,0x5a444182,0x52045224,0x5b0e9d53,0xb5dab5b9,0xb577c67c,0xce3b730d,0x9c73ce3a,0x94f56b2e,0x94d87c33,0x94b7bdfc,0xb5dcb5dc,0xb5dcb5dc,0xb5dcb5dc,0xb5dcb5dc,0xb5dcb5dc,0xb5dcb5dc,0xad7aad7a,0xce1b9cf8,0xb578bdb9,0xa539bdfb,0xadbbadbb,0xad9b9d19,0x9d1a9d5a,0x9d3a7c37,0xa57aa57a,
-0xa57aa59b,0xa57ba57b,0xa57ba57a,0xa57aa57b,0xa57aa57b,0xa57aa57a,0x9d7aa55a,0x8cb89d7a,0x95199d3a,0x9d3a8497,0x8cf994f9,0x29ab8cb8,0x298a7414,0x7c1394b6,0x63526b92,0x8c977c36,0x9d3a7c15,0xde7a2864,0xc5fae6dc,0x94b69cf8,0x9d199cf9,0x9d199d19,0x9d199d3a,0x9d399d19,0x94b69cd8,0xa5160005,0xcdf941ca,0xbd55cdb7,0xbd75c5b6,0xbd53ddf7,0xfef7b40d,0xffbdff7c,
-0xfffffffe,0xffbcfffe,0xff5bffbc,0xff3aff5c,0xff3aff3a,0xff7cff5b,0xfffdffbd,0xfffefffe,0xfffefffe,0xfffefffe,0xffbafffe,0xf7ffffba,0xfffffffd,0xfffffffd,0xfffffffe,0xfffefffe,0xffbbff35,0xff38feb2,0xffdfff5c,0x3060ffb9,0x410130c0,0x72249369,0x93286a43,0x20602880,0xd5d32800,0x9ba8ee11,0x59e1ac8d,0x7ae7c552,0xb46a9b88,0x8b06fef9,0xbcf08303,0x49604960,
-0xd5cfb4ce,0x93c8b4cc,0x62246a63,0x31005a23,0x49a33100,0x39423120,0x28c03921,0x28c128c1,0x20803942,0x28c04183,0x394128c0,0x51c24182,0x49a251c2,0x5a2551e3,0x30e04983,0x41214141,0x62644981,0x72e66244,0x6a848327,0x6a6651c1,0x62236242,0x93cd8b6a,0x7b297b29,0x5a245a04,0x51a351a4,0x940e3900,0x52044140,0x30e03100,0x100049a3,0x8bcc1000,0x496159e4,0x51c54982,
-0x18007b0a,0x838e30e1,0x9c4e7309,0x72e762c7,0x6263bd72,0x41414160,0x31215203,0x41a10800,0x41a349a2,0xbe5bb618,0x6b9173b2,0xad37b57a,0xb598d69c,0x9cb5bd97,0x7c337c12,0x94b77c35,0xb5dcb5bb,0xb5dcb5dc,0xb5dcb5bb,0xb5dcb5dc,0xb5bbb5bb,0xb5dcb5bb,0xb5dcb5dc,0xad7aadbb,0x9497b5db,0xa559a518,0xa57b9518,0xadbbad9b,0x9519a59b,0x94d98cb8,0x9d399d1a,0xa57ba57b,
-0xa55aa57a,0xa55aa55a,0xa55aa55a,0xa55aa55a,0xa57aa57b,0xa55aa57a,0xa59ba55a,0x95399519,0x953a84b8,0x9d3a8cd8,0x953a8cd9,0x74356394,0x10c78cd7,0x52af2969,0x7c3673b4,0x845694d8,0x847694f9,0xfe783949,0xc5b7e6ba,0xb59aad37,0x9d198cb8,0x94f994f9,0x9d199d19,0x9d189d39,0xad7b9cd7,0xb5b8318b,0xbd773148,0xcdd7d618,0xbd75b534,0xdedab4d2,0xee36934c,0xff9bfeb6,
-0xffffffde,0xfffefffe,0xff9dffdd,0xff3bff3b,0xff5bff5b,0xff7cff5b,0xffddffbd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xffdbff3a,0xef58ff36,0xffddff5b,0xfffffef6,0xfffefffe,0xff7bff7a,0xffb9ff9a,0x8204fefb,0x28208a61,0x6a8630c1,0x8328fffb,0xa42d9beb,0x18212040,0x20001840,0xd5519b6a,0x4940ddf2,0x38a09389,0xb4489b87,0x2060c593,0xac2afef6,0x6a828305,
-0x72a16a62,0x7b05ac4a,0x59e36222,0x52035a23,0x51e528c0,0x418228c0,0x39423942,0x28c020a0,0x30e030e0,0x39413101,0x41825a25,0x5a0549c3,0x5a0351c4,0x5a0551c3,0x418251c4,0x51e44161,0x5a0351a1,0x72a56a85,0x7ae67b07,0x622472a6,0x83086242,0x7b4951e3,0x72e77b08,0x62656245,0x51e330c0,0x49424160,0x51e549a2,0x7ae87b09,0x41623900,0x41609bed,0x414059e4,0x392051c3,
-0x6a458308,0x8bcb3923,0x940d7308,0x4a243900,0x41809bee,0x73477329,0xce155243,0xe71d83ac,0x5a08e6da,0xa4f718e3,0xc65cdf1e,0xce7cd69c,0xa516c63b,0x84735a8a,0x9d398c94,0xb5dca55a,0xb5bbb5dc,0xb5dcb5bb,0xb5bbb5bb,0xadbbadbb,0xadbbaddb,0xad9badbb,0xadbcb5bb,0xadbcadbc,0xad9bad9b,0x9d19a57a,0xa59b9d3a,0xa59ba59b,0xa57aa59b,0x84777c16,0xa55a94f9,0xa55aa55a,
-0xa55aa55a,0xa55aa55a,0x9d5aa55a,0x9d5a9d5a,0xa57ba57b,0xa55a9d5a,0x9d3a9d5a,0x9d5a9539,0x953a8cd8,0x9d3a953a,0x8cf98cf8,0x7c564ad2,0x6bb229cc,0x6372424c,0x84576373,0x73f56373,0x94d78477,0xfcd38e3c,0x41a6ff9d,0xa4f79451,0x94f88cb8,0x9cf96bb4,0x9d189cf8,0xa55aa559,0x214a8cb7,0xbdba8415,0xbd772967,0xc597bcf5,0xc596bd96,0xeeb793ef,0xab8bd5f6,0xfe33ee98,
-0xfffef7bd,0xffbcffdc,0xf6d9ff9b,0xff3bff1a,0xff7cff5c,0xff9cff5c,0xffbdff9c,0xfffdffdd,0xfffefffe,0xfffefffe,0xffddfffe,0xff36ee13,0xf7ffe7ff,0xc409fed6,0xfed4dc4c,0xf7ddff78,0xcbeaff5c,0xffdaf737,0x8204ff7c,0x8b28f75a,0xb4d128a0,0x40e01800,0xa3eaf6b8,0x204030c0,0x7b0859e5,0x30a030a0,0x51c228a0,0x20603940,0x824149a0,0xbc4bac6c,0x8240cc8b,0x62019365,
-0x5a224120,0x7ac37b25,0x5a246202,0x49e26265,0x41613120,0x8bca5a04,0x396141a2,0x49a44183,0x20a03941,0x31003942,0x39624182,0x49c23940,0x520549c3,0x52055a05,0x416351e5,0x39014141,0x6a854982,0x6a846263,0x72c67b07,0x62667b07,0x834a5201,0x7b4b940d,0x5a45836b,0x62445a24,0x5a2551e4,0x30e051e4,0x20404981,0x41205205,0x518328c1,0x498251e4,0x49823080,0x59e451a3,
-0x390051e5,0x52023940,0x49e36ae6,0x83ac9c2c,0x31006264,0x62a66ac7,0xd6566aa6,0xbd97ad33,0xf75e9450,0x10836229,0xce7dbeff,0x9cf7c61b,0xbdfbb5ba,0xb5b98c13,0x7c5594b5,0xb5bb9d59,0xb5bbb5bb,0xb5bbb5bb,0xad9bb5bb,0xadbbadbb,0xadbbad9b,0xad9bad9b,0xad9bad9b,0xa59ba59b,0x94f9a57b,0xa57ba55a,0xa57ba59b,0xa57aa57a,0x8457a57a,0x9d3b6bb4,0xa55a9d3b,0x9d5a9d5a,
-0x9d5a9d5a,0x9d5a9d5a,0xa55a9d5a,0x9d5a9d3a,0x9d5aa55a,0x9d3aa55a,0x95399d3a,0x95399539,0x951a951a,0x8cd98cf9,0x7c578cd9,0x5b525312,0x84559519,0x84771908,0x8c9873f4,0x84776b94,0xa55894d8,0x3861c61a,0xff3bff1b,0xb598bd75,0x6b938497,0x8c977c36,0xa5789d18,0xa538a558,0xbddc9497,0xb599a538,0x732e0001,0xc597eedc,0xcdf7cdf8,0xc513acb2,0xf739cd93,0xffbce615,
-0xff9cf719,0xfed9fefa,0xff1aff1b,0xff5bff1a,0xff7cff7c,0xff9cff5c,0xffbdffbd,0xffddffdd,0xfffefffe,0xfffefffe,0xfffffffe,0xff9bffff,0xcdd3b4cf,0xfffdfffd,0xf699b46e,0xffffdd72,0xf676ff9d,0xff5993a7,0x8b49ff3a,0x8b2871e4,0x9bee28a0,0x40e0f696,0xb4b1e634,0x28814983,0x8baacd73,0x20206a88,0x5a04836a,0x730530e0,0xbd532060,0x59c4ee36,0xc5902860,0x5a216244,
-0x39404180,0x83676284,0x52035a02,0x49e249c2,0x31202900,0x31403940,0x28c049e3,0x41624182,0x41814181,0x31203120,0x41824182,0x31003940,0x51c451e4,0x51c451c4,0x49a451c5,0x39014962,0x62454983,0x72c56a85,0x7b077ae8,0x72e77ae7,0x72e76ac7,0x8bcc83ab,0x6ac7834a,0x62446aa6,0x5a4572e8,0x49a35a45,0x51e34982,0x62664162,0x28a00820,0x62453921,0x6a8651a3,0x5a044162,
-0x5a25730a,0x5a044141,0x41a23980,0x944f5a24,0x834a4160,0x62a65205,0x49e67b69,0xacd4b591,0xb5da62eb,0x4104de19,0xcede0005,0xce3cce5d,0xb5bbce3c,0x94b68415,0xaddb94b6,0xb5bbadbb,0xb5bbb5bb,0xb5bbb5bb,0xad9bad9b,0xad9bad9b,0xa59aad9b,0xad7aad9b,0xa57bad7a,0xa59ba59b,0xa57bad9b,0xa57ba57b,0xa57ba57a,0xa57aa57a,0x94ba7c56,0xa55b9d19,0xa55a9d3b,0x9d5a9d5a,
-0x9d5a9d5a,0x9d5a9d5a,0xa55a9d5a,0x9d399d3a,0x9d399d3a,0x9d3aa55a,0x95399d3a,0x95399539,0x951a951a,0x8498951a,0x63b473f6,0xa59b63b3,0x7c566bf4,0x7bf67c14,0x9d1a7c35,0x8cb97c16,0xa55994d8,0x42ab93f4,0xf6faf6b9,0xce5ae658,0x63938496,0x94f88c98,0xa558a579,0xad38ad38,0x73710845,0x8c33b5b9,0x418862ad,0x9c11a4f4,0xcdd7ce18,0xd6b9e658,0xee58fe97,0xfed9ed93,
-0xedf3ffbd,0xf71ae698,0xff1af71a,0xff1bff3a,0xff5cff5b,0xff9cff5c,0xffbdffbd,0xffddffdd,0xfffeffdd,0xfffefffe,0xfffefffe,0xee78f73b,0xff14fdcf,0xa34b9282,0xf676b3c8,0xeef8fe54,0xef7bef9c,0xe6769a21,0xff19eef6,0x61c371e2,0x414330c1,0x30807287,0x41426a85,0x206072a9,0x4161ff5a,0x72e91000,0x410128c0,0x4181c592,0xc5914160,0xb40aaba7,0x82c5ac90,0x61e1a408,
-0x39403980,0x62653962,0x41815203,0x4a034181,0x29202900,0x29003140,0x31003961,0x39403961,0x41814181,0x39613120,0x20a04182,0x39203120,0x49a33100,0x49a449a3,0x49846267,0x30c04162,0x5a044142,0x6a856a65,0x7ae77b08,0x83687ae7,0x4160834b,0x5a456ac7,0x6aa6834a,0x62456244,0x5a253100,0x72a76266,0x51e36246,0x51405a24,0x8ae851c4,0x30c08bab,0x494172c7,0x624651c4,
-0x51e4a48f,0x72e851c4,0x8bcc5a46,0xa46d62a9,0xac904160,0x8389bd11,0x49c3de34,0x52476ac7,0xe71d9c90,0xff7def7e,0x2a0c60a2,0xce7ddeff,0xb5bac61c,0x9d59b5ba,0x9d3a94f8,0xad9ba57b,0xa59bad9b,0xad9ba59b,0xad9bad9b,0xad9bad9b,0xa57ba57b,0xa59ba59b,0xa57ba57b,0xa57aa57a,0xa57ba57b,0xa57aa57b,0xa57aa57b,0x9d3ba55b,0x9d5ba55b,0x9d3a9d5b,0x9d1a9d5b,0x9d3a9d3a,
-0x9d3a9d3b,0x9d1a9d3a,0x953a953a,0x9d1a953a,0x953a9d3a,0x953a953a,0x953a953a,0x951a953a,0x951a951a,0x84b88cf9,0x74377c78,0x741642b0,0x5af052f1,0x63542108,0x8cd96354,0x94d88457,0x8c978477,0x84da9d38,0xbd154926,0x8412e659,0x6b726351,0x8c756b92,0xa5389496,0x9cb69cd6,0xad579455,0xad1694b4,0xc5d88c32,0xc5f793d1,0xd639b514,0xbd13de17,0xff5acdb4,0xfef9e657,
-0xf6b7fe96,0xee78ee58,0xff1af6fa,0xff1af6f9,0xff1aff1a,0xff7cff5b,0xff9dff9d,0xffbdffbd,0xffddffbd,0xfffefffe,0xffb9fffe,0xfffba2c8,0xffffc570,0xff798b28,0xeebbee74,0xcc691800,0xfe93dc8a,0x3060bd94,0xff5bffd9,0xffdbd635,0x520728a0,0xacd09cae,0x286051a3,0x1800834b,0x83495205,0xff79cd72,0x0800ac4b,0x30e03121,0x28804160,0xd5f29349,0x72c67ae7,0x5a0283ca,
-0x52242080,0x5a243960,0x39604141,0x49e341a2,0x39603961,0x394141c2,0x31204182,0x394130e0,0x49a24181,0x312049c3,0x39413100,0x310041a3,0x28803921,0x41824983,0x39224983,0x30e13922,0x41623901,0x6a8651e4,0x6a8672e8,0x72e87b08,0x52045a25,0x624551c3,0x73086286,0x626572a7,0x6a886aa7,0x49a27b0b,0x624572e7,0x51c15a25,0x59e34981,0x49c27309,0x5a0330a0,0x41425182,
-0x836a6287,0x41815204,0x6ae76ac8,0x41a07b4a,0x30c04982,0x41614180,0x5a443100,0xad12940c,0xcdb5df1c,0xf79fef7d,0x38e4f71b,0xd6de2128,0xad5ab5da,0x9d39b5bb,0xa57a9d39,0xa59ba59b,0xa59ba59b,0xa59ba59b,0xa57ba59b,0xa57ba57b,0xa57ba57b,0xa57ba57b,0xa57ba57b,0xa57aa57a,0xa57aa55a,0xa55aa57a,0xa55aa55a,0xa55ba55b,0x9d5aa55b,0x9d3a9d5b,0x9d1a953a,0x9d1a9d1a,
-0x9d3a9d1a,0x9d1a9d1a,0x953a953a,0x9d1a953a,0x953a9d1a,0x951a951a,0x951a951a,0x951a951a,0x951a951a,0x8cf98cd9,0x74577c77,0x7c576bf5,0x3a2c5312,0x8c9773f3,0x7c788c97,0x94d88478,0x84b88cd9,0x84fa9497,0x41292847,0x9495acf5,0x84135b0f,0x94544a6c,0xb5587371,0x6b10c5db,0xb578bdf9,0xbd98ad77,0xcdf9bdb8,0xcdf872ed,0xd5f8bd35,0xcd95bd54,0xe697ff3b,0xf719ffbc,
-0xe5d4ff5a,0xff9cee78,0xf6d9ff5b,0xf6f9f6f9,0xff1af6fa,0xff7cff5b,0xff7cff9c,0xff9cff9c,0xffddff9c,0xfffefffe,0xfffefffe,0xff7bde56,0xfffcff58,0xff7afe95,0xff7dbbc8,0xff59fffd,0xc4aee615,0xfed95962,0x7160fed8,0xe5f3dcce,0x288130c1,0x18002000,0x394230e1,0x20602040,0x834a1000,0xcd918349,0x6ac51800,0x390093ec,0x310049c3,0x9c4b30a0,0x30a0ff39,0x6a84a40b,
-0x72e86ae7,0xd6768bad,0x39613920,0x5a854a03,0x312041a2,0x31003960,0x310028c0,0x28c03120,0x18403920,0x39413942,0x30e028e0,0x418228c0,0x5a253921,0x41624142,0x41633921,0x39213942,0x41623921,0x41a33921,0x6ac862a7,0x5a056287,0x520451e4,0x39204141,0x628649c3,0x59e46266,0x836b6aa7,0x72a872c9,0x62456246,0x49806a86,0x51a251c2,0x52035a25,0x51c14140,0x93ec4941,
-0x6245b4f0,0x49c15a45,0x41a15202,0x628449e1,0x7b6872e9,0x49e249e0,0x39804161,0x73ad5265,0xffff9495,0xef5ef79f,0xcc92df1d,0x00243188,0x94f99d7a,0x9d19ad59,0x94f99519,0xa57ba55a,0xa57ba57b,0xa57ba59b,0xa55ba57c,0xa57ba57b,0xa55aa55b,0xa55ba57a,0xa55aa55b,0xa57a9d5a,0xa55ba55b,0x9d3ba55b,0x9d5b9d5b,0x9d5b9d5b,0x9d5b9d5b,0x9d3a9d5b,0x953a953a,0x951a951a,
-0x9d1a9d1a,0x953a953a,0x953a953a,0x953a953a,0x951a951a,0x953a951a,0x953a951a,0x951a951a,0x94f99519,0x74168cd9,0x7c578498,0x74367437,0x52f07456,0x6bb45af0,0x7c577c57,0x73f763b5,0x8cd98478,0x6bb48cd9,0x9c971867,0xad37a4b7,0xa4f5ad77,0x420ba4d5,0x9cd59474,0xeefdad17,0xc5f8ce39,0xbd76b576,0xbd56c5b7,0xce18de7b,0xde79c5b7,0xff3bb4b2,0xffffff9c,0xf719ffff,
-0xff7bf6f8,0xff1aff3b,0xf6f9ff3a,0xf6f9f6fa,0xff1af6fa,0xff7bff3b,0xff7bff7b,0xff7bff7b,0xffbdff9c,0xfffefffe,0xfffefffe,0xffddff9c,0xfffde698,0x92e6ee55,0xe52f6140,0xfe93ff36,0xfeb7ddd4,0xfffc8a65,0xfffbff1a,0xff5b30a1,0x180020a0,0x9c0ef73b,0xb53283ac,0x28a08b6b,0xd6353101,0x72e7f7bf,0x5a03d613,0xff7851c0,0x496628a1,0x39404962,0x7ae76263,0x83487b47,
-0x9c6f5225,0x72c7acd0,0x290028a0,0x52235a65,0x28e03961,0x31203961,0x310049c3,0x396228e0,0x28c03120,0x4203a48f,0x290028e0,0x30e02900,0xffb91020,0x41604140,0x4962fffe,0x39014162,0x41434163,0x49a34143,0x41836247,0x39224163,0x418251c4,0x5a2549e4,0x732949c3,0x51e259e4,0x5a0551e4,0x6a456266,0x51e372e8,0x5a246245,0x41215a04,0x51e34160,0x49a14981,0x414249a1,
-0x418049a1,0x396049c1,0x5a643940,0x52214a01,0x51e28389,0x4a024160,0x52a67328,0x94d54a88,0x84559d17,0xc63bbe1b,0xbcb5be3a,0x9d187c33,0xa59c0003,0x94d87416,0x9d199d39,0xa57aa55a,0xa57aa57a,0xa57aa57a,0x9d1aa55b,0x9d1a9d1a,0x9d19a55b,0x9d3ba55a,0x9d5a94fa,0xa55aa55a,0x9d3b9d3b,0xa55b9d3b,0x9d3a9d3a,0x9d3a9d3a,0x953a9d3a,0x953a953a,0x951a951a,0x951a951a,
-0x9d1a9d1a,0x951a953a,0x9d3a951a,0x951a8cf9,0x951a951a,0x951a951a,0x951a94f9,0x951a951a,0x94f994f9,0x84b98cd9,0x74167437,0x84d863d5,0x426e42b0,0x74367c15,0x84797c77,0x8cb87417,0x8cd884b8,0x6bb48cd9,0x524e0804,0xb57883b4,0xd6399433,0x9474ff7e,0x9495a517,0xeedbce19,0xef1ceefb,0xc5b6bd96,0xc5b8eefc,0xb537ce19,0xc557c5b9,0xe636d595,0xff9aff7b,0xffddfffe,
-0xff5bff9b,0xf6faff9c,0xf6d9ff1a,0xf6d9f6d9,0xff1af6fa,0xff5bff3a,0xff5bff5b,0xff7bff5b,0xffbcff9c,0xffdeffdd,0xfffeffde,0xfffefffe,0xffddfffe,0x8b47cd2f,0x38409348,0x8a676102,0xe5b2ffdb,0xf6d7b40c,0xffdcffdd,0xff18ac6e,0x206120a0,0x7226b511,0xac90f6f9,0x1820fffd,0xff992060,0xff58ffdb,0x8bcbaccd,0x51806a42,0x1840b4f1,0x31201000,0xde135a02,0x62a78c4e,
-0xbd53c595,0xc531a48f,0x28a04160,0x7b0649e3,0x3100de34,0x31205a65,0x31004181,0x39832900,0x418141a3,0x49c3cdf2,0x29003120,0x730828e0,0x62033120,0x414051a1,0x49824982,0x206051e2,0x51c449a3,0x414328c0,0x30c03921,0x204030e0,0x41442060,0x49c46267,0x836b5a26,0x5a045a04,0x5a0351e3,0x6ac86265,0x416259e4,0x624530e0,0x49826aa7,0x30e06a85,0x5a024140,0x8b6b4981,
-0x520349c2,0xbd735a86,0x3980bd51,0x52215a64,0x6ac67b68,0x49e149e2,0x52855264,0x84944249,0xbe1db61b,0xb5fbbe1b,0x41cab5db,0xb5dc2a4f,0x00029475,0x9d39959c,0xa55a9d3a,0xa55b9d5a,0xa55b9d3b,0xa55aa57b,0x94f99d1a,0x8cb99d1a,0x8cb89d3b,0x951a9d1a,0x9d1a8cfa,0x9d3a9d3a,0x9d3a9d3b,0x9d5a9d3a,0x953a953a,0x953a953a,0x953a9d3a,0x951a953a,0x953a951a,0x953a953a,
-0x953a951a,0x951a951a,0x951a951a,0x951a951a,0x94f99519,0x94f994f9,0x951a94f9,0x95198cf9,0x94f994f9,0x84b88cf9,0x5bb584d8,0x74367c99,0x4acf5b34,0x8cd873d3,0x53147c37,0x7c5784b8,0x847784b8,0x5b736bd5,0x9c9729ec,0x94557c15,0xee7cacd6,0x9475522b,0xad77ad37,0xff1ba494,0xcd34ee99,0xee9bc554,0xe6fae6da,0x8415bd9a,0x8c349497,0xedd7728d,0xdcf4e6b9,0xffffff7b,
-0xffddf77b,0xff3cff9e,0xe678f6d9,0xf6d9f6da,0xf6faf6f9,0xff3aff3a,0xff3aff3a,0xff5aff3a,0xff9cff7c,0xffbdffbd,0xfffeffbd,0xfffdffde,0xff7bfffd,0xddf3eed8,0xa40abcb0,0x28c03900,0xddb4b44c,0xedf282a4,0xccf0dcf2,0xff5a930a,0x202030e1,0x9369d616,0x4921ac8e,0x20406a24,0x1000632c,0x30a0e5af,0xddf2f73a,0x49a059e1,0x204193ca,0x9c4d940b,0x18004160,0xe678a40e,
-0x82e79bce,0xacb18b8d,0x49814160,0x83463940,0x49a08b87,0x5a4472c5,0x31003960,0x398228c0,0x290041c3,0x312041c1,0x210028c0,0x20805aa6,0x8b6582e7,0x39804142,0x49a14160,0x5a0349a2,0x49c2b4ce,0x39414182,0x28c04162,0x18603100,0x28c03942,0x41a34183,0x730a28c1,0x62654161,0x51e36266,0x62665203,0xacaf5a24,0x310028c0,0x62666266,0x59c36224,0x59e159c2,0x5a236245,
-0x52453961,0x83aa3962,0x4a0083a9,0x62a45a63,0x52035222,0x83ca62a6,0x63296308,0x84767c10,0xb5db8cd7,0xb5dbb5db,0x0003ad59,0x94f9b5bc,0xa4f79d7a,0xb63f0066,0x9d3aa59b,0x9d3b9d3a,0x9d3a94f9,0xa55a9d5a,0x8cb89d1a,0x94f994f9,0x94d994d9,0x8cd98cb8,0x9d1a7c77,0x9d3a9d3a,0x9d3a9d3b,0x953a953a,0x951a953a,0x953a951a,0x951a951a,0x953a951a,0x951a951a,0x953a953a,
-0x94f99519,0x951a951a,0x951a94f9,0x951a951a,0x951a94f9,0x94f994f9,0x94f994f9,0x94f994f9,0x8cf9951a,0x7c578cf9,0x74367c76,0x7c567437,0x29ab5b52,0xadbc52cf,0x84776394,0x6bf67c78,0x7c777c77,0x849863b4,0x39ed7456,0x5b114a90,0x3129420b,0x7372628f,0xad57a517,0xbd3793f3,0x6aad72ce,0xb4d3724c,0xdeb9d5d7,0xad59b599,0x74359cd7,0xac756332,0x8b51bd38,0xfffdfe57,
-0xfffefffe,0xf73bffff,0xee99f6b9,0xf6d9f6b9,0xf6faf6f9,0xff1aff1a,0xff1aff1a,0xff3aff1a,0xff9cff7c,0xffbdffbd,0xffddffbd,0xffddffde,0xff59ffdd,0xff1bff9c,0xd54eee75,0x8b685181,0xac2b4100,0xffbb834b,0xee5659a6,0xddf46201,0x30a12040,0x9369e678,0x9b89e615,0x08002860,0x2060ef7d,0xeef8ffdc,0xb4edffdc,0xacaee613,0x208059e4,0x288028c0,0x414093ea,0x0000d617,
-0x938ccd75,0xeeb9acb1,0x51c04180,0x5a206283,0x52005a20,0x49c06261,0x418149e2,0x28e03141,0x290028e0,0x28e03120,0x4a0420c0,0x394120c0,0xf67428a0,0x31402880,0x41604160,0x49814161,0x51e349a1,0x41a13961,0x41a36286,0x418349c3,0x41833921,0x28c041a3,0x730a4164,0x520449a2,0x39203100,0x62457b2a,0x62654181,0x51e3836a,0x626630e0,0x62445a24,0x7b086265,0x5a026265,
-0xe6f87b8b,0x62653942,0x4a035223,0x9c4fad52,0x5a646286,0x736a6ae9,0x8c968c90,0x8c969cf7,0xadbbad9a,0xad9aadba,0x0088b557,0xa55a8497,0x9d39ad5b,0x00048c97,0x8d399d3c,0x94f9a539,0x94f994f9,0x94fa9d1a,0x8cb894f9,0x84988cd9,0x8cd97c77,0x74168cfa,0x953a953a,0x953a953a,0x953a953a,0x951a951a,0x951a951a,0x951a951a,0x951a951a,0x951a951a,0x951a951a,0x951a951a,
-0x94f9951a,0x951a94f9,0x951a94f9,0x8cf9951a,0x94f994f9,0x94f994f9,0x8cf98cf9,0x8cf98cf9,0x8cf98cf9,0x7c578cf9,0x7c7784d8,0x95197c96,0x428fb5fd,0x7c16424e,0x849773b6,0x74177c77,0x74168cd9,0x7c5773f6,0x08c88498,0x5b726b72,0x29cd5311,0x6bb44290,0x5b3294d9,0xa539b59a,0x73b36311,0xb4b57372,0xf75cc573,0xb559bdf9,0x639494d7,0x7c776bd5,0x6bd58498,0xfefab495,
-0xfffefffe,0xff7dffff,0xeedaeeb9,0xf6faf6fa,0xf6d9eeda,0xff1af6f9,0xff1aff1a,0xff1aff1a,0xff5bff5b,0xff9dff7c,0xff9cff9d,0xffbdffbd,0xffbdffbd,0xff7cff7b,0xd635d593,0xccf0f696,0x59617286,0xdd32a40c,0xfffeff19,0xe5f4d655,0x08009bcc,0xe6f883ac,0xf614f6f8,0x7b4c1000,0xff7dac4e,0xfffd30a0,0xddf5ff19,0xfffaff18,0xff7b9386,0x7b2a3960,0x8b277aa7,0xfffc9bac,
-0x9c500800,0x38c1a4b2,0x5a024981,0x5a218389,0x5a636a83,0x49c05a63,0x49c249c2,0x28e02900,0x29202920,0x314020e0,0x49e239a1,0x28e03160,0x7b692900,0x396028e0,0x398049c2,0x310049a1,0x41a13920,0x39414182,0x41a24182,0x62674181,0x52055a26,0x20404983,0x5a664184,0x416230c0,0x5a2451e3,0x49c44162,0x41827b4a,0x52048389,0x5a2772c8,0x6ac65203,0x836b6ae7,0x51e262a6,
-0x4a055aa7,0x6ac69c4e,0x528549e1,0x734a948d,0x5aa45a85,0x6bac6328,0xad9a8453,0xa559ad9a,0xad9aadbb,0x9d18a559,0x21eec598,0xa57aa5bb,0x94d89d19,0x8c74a55a,0x63940066,0x94d994f9,0x8c989d1a,0x94d98cb8,0x847794f9,0x7c778cf9,0x6bf67416,0x951a7436,0x953a951a,0x953a953a,0x953a953a,0x951a951a,0x951a951a,0x951a951a,0x951a951a,0x951a951a,0x951a951a,0x8cf98cf9,
-0x94f994f9,0x8cf994f9,0x94f994f9,0x8cf994f9,0x94f994f9,0x94f994f9,0x8cf98cf9,0x8cf98cf9,0x8cf98cf9,0x84778cb8,0x953b84d6,0x74363a72,0x29cc7415,0x845729ab,0x8cd87c17,0x637584b8,0x63748478,0x74166bf6,0x00678cd9,0x84978c96,0x5b534ad1,0x7c366bd5,0x7c168cb8,0x424e3a0d,0x52d05b11,0x94976bb5,0xd5989b71,0x31a8e679,0x7c378456,0x74166bd5,0x84777416,0xc5389c97,
-0xff9bdd95,0xff9dffde,0xeedaee79,0xf6faf6fa,0xeeb9eeda,0xf6faf6d9,0xf6faf6fa,0xff1aff1a,0xff3bff3a,0xff7cff5c,0xff9cff7c,0xff9cffbd,0xffbdff9c,0xff1bff7b,0xcdd4d572,0x9347ddf4,0xc4cfa40c,0xab8b8266,0xff9bb4d0,0x82e8d5f5,0x1800f6b8,0xeeb8eeb8,0xffbbff1a,0xe67830c1,0xd5f68329,0x62053000,0xfdd3fffb,0x72228247,0xb4ede653,0x204061e2,0x834ade56,0xbcf193cd,
-0x4963e636,0xb53230a0,0x52033940,0x62656ac7,0x6aa56285,0x5a236aa5,0x41a25224,0x31203140,0x31612920,0x316020e0,0x52432100,0x39603140,0x28c041a2,0x39403100,0x31203120,0x39204181,0x41803940,0x28e04161,0x41814181,0x49c43100,0x49c362a7,0x28804182,0x4a045206,0x288028a0,0x208049c2,0x942d49a3,0x62861860,0x498251c3,0x62665a45,0x5a4449c2,0x49e45a65,0x62658bcb,
-0x6b298c2d,0x49c25205,0x6b2849e0,0x8411632c,0x7b8ca512,0x849683f0,0xa5389518,0xa559a559,0xa559a559,0xa559a559,0x4313bd36,0x8c978cf8,0x84578436,0x8c5794b9,0x0003d6be,0x8cb85395,0x8c9894d9,0x8cb894d9,0x6bb58c98,0x6bd56bf5,0x7c987c77,0x8cd97c78,0x951a951a,0x951a951a,0x951a951a,0x951a951a,0x951a951a,0x951a951a,0x951a951a,0x94f9951a,0x8cd98cf9,0x94f994f9,
-0x94f994f9,0x94f9951a,0x94f98cf9,0x8cf994f9,0x8cf98cf9,0x8cf98cf9,0x8cf98cf9,0x8cf98cf9,0x8cd98cf9,0x84988cd8,0x63d57438,0x53126c16,0x3a4f5b31,0x7c550025,0x84977c16,0x6bd663b4,0x7c376394,0x7c777c58,0x63528498,0x3a2ea55a,0x743652f3,0x7c377c56,0x5b336bb4,0x42704270,0x52f25b33,0x84575b13,0x84784ab0,0x18ec6333,0x74167415,0x84777c57,0x84988cd9,0x95197cf7,
-0xfebbb4f7,0xee38ddd5,0xeeb9e618,0xf71af6fa,0xeeb9eeda,0xf6d9eeb8,0xf6d9f6d9,0xf6faf71a,0xff3aff1a,0xff5cff3b,0xff9cff7c,0xff9cff9c,0xff7cff9c,0xee77ff7b,0xacaecd10,0xabec93a8,0x41009bed,0x9b29bd71,0x40204880,0x934afefa,0x28807ae9,0x6a0640e1,0x9baeff9c,0xf77c2820,0xfef7ef9e,0x2000ff3a,0x7b8739c2,0xff39a3e8,0xfffe9b66,0x190038a0,0xdd739389,0x7288d637,
-0x6b0ac618,0x7bb141a3,0x49e43922,0x940f944f,0x6ac693ed,0x5a448389,0x52046266,0x41a24182,0x29202920,0x20c020e0,0x524320e0,0x39a041c1,0x310039a1,0x39603100,0x39404180,0x31004160,0x310049a0,0x39413941,0x39403941,0x39613940,0x418241a2,0x394051e3,0x39626ac9,0x28a03922,0x28a049c2,0x28c049c4,0x6265b531,0x20805a45,0x416051e2,0x626549c2,0x39403960,0x62865a66,
-0x5246acd1,0x49c11860,0x5ae749e2,0xa5179494,0x9cf4a554,0xa55994d6,0x9d189d18,0x9cf89cf8,0xa5599d18,0xb599a559,0xaddc3989,0xa55a94d8,0x8cb89519,0x8cb88cb8,0x83f294f8,0x74370045,0x94da8cd9,0x9d1994d8,0x8c987c36,0x84986394,0x8cb984b8,0x951a94fa,0x951a951a,0x951a951a,0x9519951a,0x951a9519,0x94fa951a,0x94fa94fa,0x94fa8cfa,0x94fa8cfa,0x94fa8cfa,0x8cfa8cfa,
-0x94fa8cfa,0x8cfa8cfa,0x8cfa8cfa,0x8cf98cfa,0x8cf98cf9,0x8cf98cf9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x63958499,0x6bd65b74,0x63937c79,0x3a2d5331,0x63930045,0x73f57c15,0x84378477,0x7c577416,0x7c577c58,0x6bb57415,0x31ed08a5,0x4ad284b8,0x74157c16,0x192b7c57,0x84975b33,0x4af14af2,0x7c777c77,0x73f57416,0x94fa6bb4,0x7c776bd4,0x84778cb9,0x8cb88497,0x94f88cd8,
-0xacf794d8,0xd5f7b4f7,0xeebad5f9,0xf6daf6da,0xee99eeb9,0xeeb8ee99,0xf6d9f6d9,0xf6f9f6f9,0xff1af6f9,0xff3aff1a,0xff9cff5b,0xff9cff9c,0xff7bff9c,0xf6d8ff3a,0xc4f0e635,0xd5f5c4f0,0xddb48b2a,0xa38bacaf,0x41214920,0x49626203,0x28600800,0x40402000,0xbcb049a4,0xe6982840,0xeed7ffdd,0x1000b46e,0x6a62ff17,0xd5b4ff7a,0x48e26248,0xfffe59a1,0x936b3080,0x93ed8bac,
-0x8b8cac70,0xb596836b,0x51e43921,0x840e732b,0x6225730a,0x838b7b8c,0x522551e4,0x312141a3,0x31402920,0x21003140,0x18a018c0,0x41c15282,0x41c23960,0x28e03140,0x49e13940,0x418141a0,0x39403140,0x31003920,0x396051e4,0x39603960,0x39403120,0x394149a3,0x49a3838c,0x28c04183,0x18404182,0x28e030e1,0x49a330e2,0x41811820,0x49e24181,0x6ac749e3,0x31205a65,0x310149a1,
-0x732a5a87,0x5202944d,0x4a455202,0x5b1052eb,0xa57894f7,0xad7aa59a,0x94b794d7,0x9d399d18,0xa559a559,0xb5daa539,0x955929aa,0x95198cb8,0x8cd894d8,0x7c168477,0xa51894d8,0x196b3126,0x84577416,0xa57b8cb8,0x8c984ab1,0x6bf56bf5,0x84b98cd9,0x951a951a,0x951a951a,0x94f9951a,0x951a951a,0x951a94f9,0x94fa94fa,0x94fa94fa,0x8cfa94fa,0x94fa94fa,0x8cfa8cfa,0x8cfa8cfa,
-0x8cf98cfa,0x8cfa8cfa,0x8cfa8cfa,0x8cf98cfa,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x6bf67436,0x84987c77,0x5b747457,0x52f05312,0x426f0025,0x73d4426f,0x73d66b94,0x5b535b73,0x6bf55b54,0x74376bd3,0x84980066,0x74577c77,0x84978457,0x7c3721ad,0x5b548498,0x6bf74ad2,0x7c5884b7,0x74576bf6,0x84986bf6,0x84986bb4,0x8cb87c57,0x8cf98cd9,0x94f894d8,
-0x94d894f9,0xce189cf8,0xee99e679,0xeeb9eeb9,0xee99eeb9,0xee98ee99,0xeed9ee98,0xf6d9eeb9,0xf6f9f6d9,0xff1af6f9,0xff7cff3a,0xffddffbc,0xff7cffbd,0xf6b8ff1a,0xde78de36,0xcd51cdb4,0x7266ac0d,0x30c0bc6f,0x62254944,0x2020bd53,0x286149a5,0x938a1820,0x38604941,0x934a2880,0xffddff9b,0x6b4bffbb,0xff5d0000,0x7328fffd,0xd5948bcc,0xf6f882e9,0x39226204,0xacf2940e,
-0x51e69bcd,0x39033165,0x39424141,0x7b8da490,0x6a66de9a,0x7329732a,0x5a675a26,0x49e43982,0x29402920,0x318239a2,0x290018a0,0x41c120c0,0x5a835243,0x28e039a1,0x41a028c0,0x5a653100,0x4a026aa5,0x31203180,0x310041a2,0x39613100,0x39603961,0x41a19c0e,0x624572c8,0x49e53900,0x49c56aa9,0x310020a0,0x30e020a0,0x30e03100,0x31003941,0x49c33961,0x49c351e4,0x52034a02,
-0xa4b0ff9e,0x5a445a25,0x41c349c2,0xa57962ca,0xad9a94d7,0xa55aad9a,0xa5399d19,0x9d399d19,0xa579a559,0xb559ad9a,0x8cb76bb3,0x8c979d19,0x94f99d19,0x7c1794d8,0x845673f6,0xa55a3169,0x00050005,0xbe3f0047,0x7c576bd5,0x63955b74,0x84987437,0x94fa951a,0x951a951a,0x8cfa951a,0x8cfa951a,0x94fa94fa,0x8cfa94fa,0x8cfa8cfa,0x8cfa8cfa,0x8cfa8cfa,0x8cfa8cfa,0x8cfa8cfa,
-0x8cfa8cfa,0x8cfa8cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cb98cd9,0x84b98478,0x84778cd9,0x84988478,0x5b948478,0x426f6bf5,0x31ef6b93,0x7bd429cd,0x63956352,0x73d58477,0x4b12322f,0x6c166394,0x8cb8116c,0x53337416,0x08a95b94,0x3a4e7416,0x63956395,0x6bd56bb5,0x6bf68498,0x7c575312,0x84997416,0x84986bf6,0x84988498,0x8cd984b8,0x94d994d9,
-0x9cf89cf9,0xd659a4f8,0xe69ae67a,0xe679e679,0xee99eeb9,0xee99e699,0xee99ee99,0xeeb9ee99,0xf6d9f6d9,0xfefaf6d9,0xff7bff1a,0xffdeff9c,0xff9cffde,0xf678ff7b,0xf6d9d5b2,0xac2df6b8,0x8b083880,0xff7b7ac8,0xac4d832b,0x18005a05,0x28800800,0x10200000,0x186049e5,0xe6991861,0xac0bf6f8,0xfffeff39,0xd5f3ffbb,0xffddffbb,0x3040fffe,0xb533bd75,0x4163eed8,0xbd748bac,
-0x8c105183,0x7bcf9cf5,0x30e14142,0x522751e6,0x72668bcd,0x6268cdd5,0x3923a490,0x20e03941,0x290020e0,0x31613163,0x20e020e0,0x20c041e1,0x20c020e0,0x28e03160,0x396049c2,0x28c04180,0x39607307,0x41a13960,0x49c33960,0x41813961,0x41813961,0x6aa741a2,0x73275a44,0x49a57306,0x20c03122,0x392149e4,0x39414162,0x28e03941,0x206049c4,0x18404182,0x28e03982,0x62865a46,
-0x41625a48,0x5a453942,0x5a8649c2,0x74334204,0xa5598cb7,0x9d19ad9a,0x9d19a55a,0xa5599d19,0xad9aad9a,0x522ca57a,0x8cd89519,0x84568c97,0x94d88456,0x8c9794f9,0x8c978c98,0x84560825,0x94d87c15,0x6bf66394,0x74377416,0x7c785b74,0x94fa8cd9,0x8cfa951a,0x94fa8cd9,0x94fa94fa,0x8cfa94fa,0x94fa8cfa,0x8cfa94fa,0x8cfa8cfa,0x8cfa94fa,0x8cfa8cfa,0x8cd98cd9,0x8cd98cd9,
-0x8cd98cfa,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cb9,0x8cd98cd9,0x8cd98cd9,0x84b98cd9,0x8cb97c77,0x84778cb8,0x7c578478,0x7c576bb5,0x9d5a63b5,0x6bd4214a,0x192b7c57,0x94b852f1,0x42b121ad,0x5b5463d4,0x6c1763b4,0x5b5253b6,0x4af28437,0x5b746bf6,0x84776bb5,0x7c985b53,0x6bf57416,0x5b747c57,0x73f66bd5,0x7c787416,0x7c376c16,0x8cb88cb9,0x8cd98cb8,0x94d994d9,
-0x9d189cf9,0xce18ad39,0xe679de3a,0xde38de59,0xeebaeeb9,0xee99ee99,0xee99eeb9,0xee99ee99,0xeeb9eed9,0xf6d9f6b9,0xff5bff1a,0xffddff9c,0xffddffde,0xfeb6ff9c,0xbc4dfed9,0xddd4abaa,0x51622820,0x6205ac8f,0x4962a42d,0x28a11000,0x28a06288,0xffff1000,0x10001020,0xf75a1860,0xff1ade36,0x2800d4cc,0x38a07284,0xffffff19,0xff78ffbc,0xd5708263,0x8babff59,0xd6172020,
-0xbcf2acb1,0x7390c63a,0x28e128c2,0x41a43923,0x51845206,0x41615226,0x51e56267,0x7b6b4182,0x39822901,0xa4f04a24,0x29203140,0x20e03180,0x39603181,0x39a03980,0x28e05203,0x62a541a0,0x41a03100,0x49c14180,0x49e249e1,0x49c23960,0x41813960,0x522549c2,0x62425a03,0x498030c0,0xc58f30e1,0x208030e0,0x31004162,0x41a33941,0x5a4630e0,0x418228c0,0x10001840,0x418251e3,
-0xc5f7b555,0x62c7acf4,0x39a441c3,0x10a52965,0xadbbb5fc,0xa5399cf8,0xa55aa55a,0xa57aad7a,0xa57aa57a,0x0026a538,0x7c359d59,0x7c158476,0x73f57415,0x84787c57,0x9d188cb8,0x7c7928e8,0x8c778497,0x5b535b33,0x7c577c57,0x8cb98499,0x951a94f8,0x84988cf9,0x94fa8cfa,0x94fa94fa,0x8cfa94fa,0x8cfa94fa,0x8cfa94fa,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,
-0x8cf98cf9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cb9,0x8cd98cd9,0x84b98cb9,0x7c777c78,0x7c578478,0x84987c57,0x7c577c77,0x63947416,0x7c153a4f,0x84978c96,0x6c167c56,0x7c9521ce,0x5b535b33,0x74364af2,0x84987416,0x00067c77,0x4ad26393,0x322f84b7,0x63946bd5,0x63957437,0x743763b4,0x63d57c57,0x74176bf6,0x6bd563d5,0x84987416,0x8cb88498,0x8cb994d9,0x94d894b8,
-0x94f894f8,0xc5f9a518,0xde59ce18,0xde39de58,0xeebaee99,0xeeb9eeda,0xeeb9eeb9,0xee99ee99,0xee99eeb9,0xf6f9eeb9,0xff5bff3a,0xffbdff9c,0xffdeffbd,0xdd0fff5a,0x9b4a8266,0x6a666a24,0xf73aa44e,0xb4d3938c,0x30e03940,0x28c249e5,0x49c57b6c,0x62891840,0xf73bffdd,0xcdd51820,0xfffdff9d,0xffbda40d,0xefbfe7df,0xfffd5080,0xfffffffd,0xff9948c0,0xffbdffdd,0xeeb94143,
-0x59c4ff7a,0x9431acb3,0x20c11000,0x208118a1,0x39453103,0x62a928a2,0x41a44a05,0x41c428c0,0x83cc39c3,0x9c904a06,0x39c15241,0x31603180,0x29002920,0x21003161,0x49e24a02,0x49e141c0,0x9c6d30e0,0x31003960,0x5a436265,0x39404180,0x28e03961,0x49c33961,0x520249a1,0xac6b3100,0xf61140a0,0x4160cdb0,0x41623920,0x41623921,0x30c049a4,0x39624162,0x41623100,0x30e12080,
-0x7baf62ec,0x5a67a4d4,0x3a0a734b,0x52eead57,0xa57a9d18,0x9cf894f8,0xa5399d19,0x9d399d19,0xa539a55a,0x4270bdb9,0x7c368c97,0x7c368456,0x74167415,0x84577c57,0x9cf88c98,0x8cfb20c7,0x84368cb7,0x7c376394,0x74166bb5,0x953b84d8,0x7c386bb7,0x8cd98479,0x8cfa8cfa,0x8cfa8cfa,0x8cfa94fa,0x94fa94fa,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cb9,0x84b98cd9,
-0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cf98cd9,0x74377436,0x84786374,0x7c5763b4,0x63957417,0x63945313,0x00056bd5,0x194b73f4,0x6bf67c57,0x4af242b3,0x74376394,0x6bf66bf6,0x7c987c77,0x4ad28498,0x8cd81929,0x63b45b73,0x74365332,0x4ad27416,0x5b765314,0x74375334,0x74377c57,0x74366c16,0x7c377c37,0x94d98498,0x94f994d9,0x9d1994f8,
-0x9d399d18,0xbd98a518,0xcdd8d639,0xd618d618,0xe699e658,0xeedaeeba,0xeedaf6fa,0xee99eeb9,0xeeb9ee99,0xf6f9eeb9,0xff3bff1a,0xff9cff7b,0xff7cffbd,0xcd53ff39,0x5a467b0a,0xacb0c593,0xffbca46e,0x7aa7d676,0x6a457268,0x62a9acf1,0x834c49c5,0x49a51820,0xffff30a0,0xff7b1840,0xf6d9ff9c,0xffdc48a0,0xfffef676,0xffbb2860,0xffffff9c,0xff39ff7b,0xfffeffff,0x4121de36,
-0x8bcec511,0x49c6b4f3,0x20c12000,0x31442902,0x31032903,0xacf149c5,0x49c441a4,0x20c03120,0x41c320e1,0xde9a5aa5,0x526449e2,0x39c04a42,0x31a039c1,0x18a039a0,0x39a03140,0x310028a0,0x39403940,0x41605243,0xb4adcdb1,0x49c230a0,0x39615a65,0x520341a1,0x49c15a03,0xd5b05202,0x93248ba8,0x82a35140,0x49835a45,0x41624161,0x49a34162,0x31213962,0x20804182,0x30e11000,
-0x83f19c93,0x9c505229,0x8d195249,0x73b29475,0x9cf99d38,0xa57aa55a,0xa5399d19,0x9d399d19,0x9d19a55a,0x743741ca,0x8c9873d5,0x84767415,0x74157c35,0x7c367416,0x8c968c98,0x7c583149,0x7bf58476,0x7c575b53,0x8cb97437,0x7c7963b7,0x94f984f9,0x94fa8cf9,0x8cfa8cfa,0x8cfa8cfa,0x8cfa94fa,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cb9,0x8cd98cfa,
-0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x7c988cb9,0x63b47c98,0x74166394,0x849873f6,0x4ad36375,0x6bb573f7,0x6c160047,0x6bb6426f,0x84d68479,0x4ad15b74,0x63945312,0x74385312,0x7c576bf5,0x63d57c77,0x5b720003,0x4af16bf5,0x63d55b94,0x639542b1,0x6bf67c77,0x7c776bb7,0x7c577c58,0x84786bf6,0x84787437,0x8c988478,0x9d1a94f9,0x9d189d18,
-0xa538a518,0xb577ad59,0xcdd9bd97,0xde18d5f8,0xe679de37,0xeedaeeba,0xf6faf6fa,0xf6baf6da,0xee79ee99,0xf6f9ee98,0xff3bff1a,0xff9cff7b,0xffbeff9c,0xac2ffef7,0xacade635,0xbc8dc531,0xe6b8c552,0xb3ecc552,0x72e81020,0xacf25140,0x184020a1,0x28a12060,0xdd938b8c,0xbd320800,0xf698ee97,0xef1afe75,0xf7ffde76,0xb451ffda,0xffbcf7dd,0xbdb5fffe,0xfffff7ff,0xddd3fffe,
-0xc5f6ac2d,0x9bee6288,0x20e23080,0x316420e2,0x4184630b,0x520562a8,0x4183734a,0x18a020a0,0x31606b2a,0x8c0e39c0,0x83ce4a01,0x39c0ad32,0x316039e0,0x31803160,0x31403140,0x39613940,0x41803960,0x41a03980,0x836449e1,0x394059c1,0x41a29c4c,0x522349e2,0x51e249a1,0x83474180,0x59c04980,0x3960d670,0x836b49e0,0x41834161,0x41624183,0x418349c4,0x49a52080,0x100028a0,
-0x62abbdfa,0x398aacf3,0x84548455,0x84139cd6,0xa53a9d18,0xa57aad9b,0xa539ad7a,0x9d399d39,0x9cf88cb7,0x743639cc,0x7c568cb8,0x73d57c37,0x84b88477,0x8cb88cd8,0x94d88cb8,0x8cd92929,0x6bd57436,0x84988497,0x74377c57,0x8cf97c57,0x94fa94fa,0x8cfa8cf9,0x8cfa8cfa,0x8cfa8cfa,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cb9,
-0x8cd98cd9,0x8cb98cd9,0x8cd98cb9,0x8cd98cd9,0x8cb98cd9,0x84b98cd9,0x741784d9,0x74378498,0x6bf563b5,0x637584b9,0x6bd77c59,0x5b53194d,0x7c788498,0x84970087,0x7c778477,0x533263b4,0x53543230,0x6c167457,0x7c787417,0x74377c78,0x7c15114a,0x6bf64270,0x42b13a50,0x74376bd6,0x74576c16,0x7c577c37,0x74378499,0x84997c57,0x7c588499,0x8c9884b8,0x94f894d8,0x9d189cf8,
-0xad58a518,0xb578ad79,0xc5b8b578,0xd618c5f8,0xe658d618,0xeeb9e679,0xf6faf6fa,0xf6faf71a,0xee79eeb9,0xf6d9e678,0xfefaf6f9,0xff7bff3b,0xff9bff7b,0xe676e634,0xfef9e677,0xc592c50f,0xee9730c0,0x72868b29,0xa42da42d,0xcd316204,0xdeb94162,0x08002040,0xffdd51e4,0xf7391000,0xff7cff7d,0xab67ff99,0xff5bff59,0x5a65ffbc,0xff9dffda,0xfffeee14,0xfffdc48f,0xff16ffba,
-0xee992800,0x72a96a27,0x20c22880,0x31450820,0x39a55a8a,0x52662902,0x41a23961,0x20c03941,0x42043162,0x522341e3,0x522441c0,0x20c0c530,0x318062a5,0x29403160,0x31203981,0x31403120,0x31203981,0x31403140,0x49c149e2,0x49813940,0x41609c0a,0x6265acae,0x628451c2,0xfffb59e2,0x51e13920,0x39003920,0x49a051c0,0x49a251c1,0x416349a3,0x414249a3,0x28c04183,0x28e03100,
-0x51c9ad38,0x8475528d,0x94d694d7,0x8454630e,0x9d199d17,0xa55aa57a,0x9d19a55a,0x8cb78c76,0x632f9496,0x84776b52,0x84567c15,0x7c368457,0x8cd98477,0x94d98cf9,0x94d88cb8,0x73f59497,0x8cb87416,0x9d3a94d8,0x63953a51,0x8cd98cb9,0x8cfa8cd9,0x8cfa8cfa,0x8cd98cd9,0x8cfa8cfa,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cb98cb9,0x8cd98cd9,0x84b98cb9,0x8cd98cb9,0x8cd98cd9,
-0x8cd98cd9,0x8cb98cd9,0x8cb984b9,0x8cd98cb9,0x8cb98cb9,0x84b98cb9,0x74167c78,0x5b946c16,0x53356bf6,0x533421cf,0x74376395,0x6bd67c78,0x74367c58,0x5b720025,0x6c166bd4,0x6bf67457,0x5b545b74,0x7c777436,0x7c587437,0x84986bf6,0x9d1963b5,0x5b744ab1,0x6bd684b9,0x84996bf6,0x74376bd6,0x84987c57,0x7c587417,0x84998478,0x74178478,0x8c988498,0x94f894f8,0x9d189cf8,
-0xa538a518,0xb578a558,0xbdb8bd78,0xcdd8c5f8,0xde38d618,0xe678e658,0xf6daeeb9,0xf6faff1b,0xe638eeb9,0xe677e678,0xff1af6d9,0xff5bff1a,0xff5cff7b,0xee98f6b8,0xbcefd511,0xde98ac0b,0xa40d938a,0xd5724941,0x5a266a87,0xa3cbd593,0xde36ffbb,0x08002860,0xabcc6a46,0xff9b2020,0xf6f8fed8,0xfe96f79c,0xfed6ffdb,0xffdee56f,0xfeb66227,0xffffcccf,0xfe76ff15,0xe613ffbb,
-0xeeba38a0,0xac4ebcef,0x18811880,0x7bd0f79e,0x942f5acc,0x31421040,0x41a45a87,0x31223120,0x29006b29,0x28e03161,0x4a0141c1,0xa48f3940,0x4a223961,0x314041e1,0x5a857327,0x28e02900,0x28e05a85,0x31203140,0x418041a0,0xa42e3940,0xcdd072c6,0x41404140,0x6aa43920,0x49e14980,0x6a8349a0,0x5a2372c4,0x49c04980,0x6aa58b88,0x39015204,0x49834142,0x39423942,0x41834183,
-0x6b4fbd99,0xa53894d6,0x8c348414,0x9cd649ca,0xa53994d6,0xa57aa57a,0x8c979d18,0x8c967bf4,0x10448c75,0x53118497,0x7c166bb5,0x7c576393,0x8cd87c77,0x8c9894f9,0x9cf98457,0x3a4f9496,0x94b8951a,0x84779d1a,0x84786bf6,0x7c9863b5,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cb98cb9,0x8cb98cd9,0x8cb98cb9,0x8cb98cb9,
-0x8cb98cb9,0x8cb98cb9,0x8cb98cd9,0x84b98cb9,0x84b98498,0x84b984b9,0x7c7884b8,0x84b98499,0x74175b74,0x74167c98,0x7c9863b4,0x6bf67457,0x53127c57,0x8cb829cc,0x73f77417,0x73f77417,0x74376395,0x63b55b74,0x7c577c78,0x74377437,0x212a6bd6,0x4ad26b95,0x63957c38,0x63d57437,0x7c788478,0x5b747c37,0x7c787c78,0x84788478,0x7c378498,0x8c988498,0x8cb88cb8,0xa51994d8,
-0xa537a538,0xb558b558,0xbdb8b558,0xcdd8c5b8,0xde38d5f8,0xe637de59,0xeeb9e658,0xff1bf6da,0xde37e678,0xe657ee78,0xf6d9ee98,0xff5aff1a,0xff5bff7c,0xe6faff9c,0xeed8f73a,0xe677bd11,0xc530c511,0xb4d0d5f5,0x93ab6a88,0x40c0bcae,0x6204b44e,0x182030e2,0x41231800,0xde154123,0xee97ee98,0xffbaff79,0xff9affba,0xffddff59,0xffd9bd10,0xfffeef1b,0xd531ff9b,0xc551e633,
-0xa46fc4f0,0xddb44962,0x18811840,0x00005acb,0x49e78433,0x732b0800,0x28e03963,0x29423121,0x312318a0,0x5aea4a06,0x18a02942,0x41c141c1,0x41c15a45,0x212039a1,0x318041e1,0x31405a85,0x39813140,0x28e03140,0x310041a2,0x30e03941,0xa42a7b07,0x62a54942,0x9c0a6a84,0x41613900,0x4980d5d0,0x28a07b09,0x39824121,0x5a836b25,0x524262c1,0x39413961,0x41623941,0x39624162,
-0x8c9539cb,0x8c959d17,0x7bb18c54,0x83f38412,0x94d89cb6,0x94f89d19,0x737294b7,0x9cb67bd3,0x52af4a4c,0x74155332,0x7c168457,0x84987c36,0x8cb87c57,0x9d1a951a,0x94b88457,0x214a8c34,0x112a10c9,0x8c978c98,0x6bb55312,0x7c787c78,0x8cb98cda,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cd98cb9,0x8cd98cd9,0x8cb98cd9,0x8cb98cb9,0x8cd98cb9,0x84b984b8,0x8cb984b8,0x8cb98cb9,
-0x8cb98cb9,0x8cb984b9,0x8cb98cb9,0x84b98cb9,0x84b984b9,0x84b98498,0x7c7884b9,0x63957c57,0x74566bd6,0x7c577c57,0x7c987416,0x7c787416,0x00256bf6,0x9d195352,0x6bd64ad2,0x63756375,0x63b55334,0x743763d5,0x7c786bf6,0x74577437,0x00255333,0x6bb58456,0x7c376374,0x74166395,0x84787c58,0x84786bd6,0x84988498,0x7c788478,0x7c778478,0x8c988498,0x8c988478,0x9cf88cb7,
-0xad58ad59,0xad38b558,0xbd98b558,0xcdd8c597,0xd5f7cdd7,0xde38de58,0xe679de38,0xee79e679,0xd5f6e658,0xee98d5d5,0xf6d9e657,0xff3aff19,0xff9cff7c,0xff9cff3a,0xee97ff9c,0xe698d593,0xddd3bcf1,0xb4f1acd0,0x93edbd11,0x4942936a,0xb4af834a,0x182030c1,0xc5742903,0xf6772000,0xff39ff3a,0xff79ff18,0xee75ffbc,0xdd2afeb7,0x2800ff9f,0xff9cfffe,0x6162ff39,0xfed75940,
-0x1840a490,0x4080938a,0x10203123,0x841020e3,0xc5d8ffdf,0x10600800,0x314228e2,0x18803102,0x314362e9,0xce797b8c,0x8c114206,0x41a15a88,0x62a741c1,0x21204a03,0x41e139c1,0x41a13960,0x62c63120,0x31403961,0x312028e0,0x28e049c2,0x62443920,0x62857308,0x202051c1,0xee966a86,0xa46aac6b,0xcdedde53,0x7ae76245,0x8beb6200,0xfffbd5ad,0x626549c0,0x39414182,0x41834183,
-0x9cd69cf6,0x8c7594b6,0x7bb283d3,0x7c137c13,0x7bf49d17,0x7bd38c76,0x62cf5af0,0x5aae39ca,0x52f11086,0x74157c35,0x6bb46393,0x74167416,0x8cd98498,0x8cb98498,0x6b7194d9,0x94d841cb,0x0006a55b,0x6bd57c37,0x6bd56bd5,0x74177438,0x8cd98498,0x8cd98cd9,0x8cd98cd9,0x8cd98cd9,0x8cb98cb9,0x8cb98cd9,0x8cb98cb9,0x8cb98cb9,0x84d984b9,0x84b984b9,0x8cb98498,0x8cb98cb9,
-0x8cb98cb9,0x84b98cb9,0x8cb984b9,0x84b98cb9,0x84b984b9,0x84b88cb9,0x74577c98,0x74377437,0x7c7784b8,0x7c797c77,0x7c787436,0x7c367c78,0x6bd484b7,0x7c157417,0x52f26394,0x74167416,0x6bd65333,0x63954af3,0x7c787c57,0x6c167c58,0x00a77437,0x63556332,0x32507c56,0x74175b54,0x5b757436,0x6bd58499,0x84996bd6,0x84787c78,0x84787c58,0x84988478,0x84988498,0x94d88cb8,
-0xb579ad59,0xb558b558,0xbd98b558,0xc5b7bdb7,0xd618c5d8,0xd638de59,0xd618d638,0xd5f7d5f7,0xcdd6cdb6,0xe657cd94,0xee36de36,0xff3af71a,0xff5bff5a,0xff9cff5b,0xf6d9ff9c,0xeed9f71a,0xb42bde36,0x9c0ea3ec,0xff5ccd10,0xff7be637,0xa3ccc552,0x18002881,0x1820c575,0xfe97c513,0xf71af635,0xb449f73c,0xf7bcfffe,0xff5bf6b8,0xffffffdf,0xee5761a1,0xe5d3e5b5,0xfefac553,
-0x9c50bcb0,0x3040ff9b,0x10205a8a,0xacf30800,0xa4922904,0x39a71020,0x31023164,0x184028e2,0x314241a4,0x52251880,0x9c909c0c,0x3140b534,0x52443980,0x29205aa6,0x39a13160,0x39a03980,0x31403120,0x28e03961,0x31003140,0x310128e0,0x30e13940,0x30e05a43,0x72a46a85,0xa42b9386,0x83466a43,0xff7c9c48,0x6a01d5d0,0x934561e0,0x4960a3e6,0x5a4193ea,0x524362a2,0x49e451e3,
-0x94b4ad78,0x841294b4,0x84356310,0x8c969496,0x949594d7,0x735173b2,0x5aae83f3,0x947541eb,0x63732128,0x7c1573f5,0x741663b4,0x84988cb9,0x8cb87c57,0x8c98951a,0x739273f5,0x635220c8,0x5af25af1,0x5b734af1,0x5b535353,0x7c586395,0x8cd98cf9,0x8cb98cb9,0x8cd98cd9,0x8cb98cd9,0x8cb98cb9,0x84b98cb9,0x84b984b9,0x8cd98cd9,0x84b98cb9,0x84b884b9,0x84b98cb9,0x84b984b9,
-0x8cb98cb9,0x84b984b9,0x84988cb9,0x84b98498,0x84b984b9,0x84b88498,0x7c7884b9,0x74377417,0x7c587c57,0x741784b8,0x84986c16,0x63947c77,0x426f0046,0x212a7416,0x63746b94,0x63946394,0x74577417,0x74165b54,0x7c577437,0x74377c58,0x3a707416,0x6b9252d0,0x6bd752f3,0x84776bd5,0x3a516bf6,0x73f67416,0x84786bd6,0x7c787c78,0x84988478,0x84988498,0x84988498,0x94d88cb8,
-0xb558a518,0xb578bd98,0xbdb8b578,0xc5b7c5b8,0xd5f8c5d8,0xd618d638,0xd618d618,0xd5f7d5d7,0xde38de58,0xde37e677,0xddb4ee98,0xff3afefa,0xff5bff3a,0xff1aff5b,0xeeb8ff5a,0xf6d8fef9,0xc4eee615,0xe65759a3,0xac6dee14,0xb4909bec,0x938b6226,0x18204186,0x7b2c1000,0x200028a2,0xf676ddb3,0xfe32fef6,0xfffefef7,0xfffdff3a,0xe5b1ffdf,0xee5261c7,0xb3adff1a,0xffffacb2,
-0xff3ad552,0x20201000,0x20c239c6,0x10201000,0x49c6734d,0x734d0000,0x418449e7,0x18603964,0x7b8c5247,0x7b6b5aa9,0x41a33922,0x5244940e,0x39c13980,0x39c139a1,0x29203160,0x314041a1,0x39813981,0x312028e0,0x314128e0,0x20803100,0x4a0441a3,0x49c149c1,0x5a213960,0xb4ea30a0,0x9c6de6f6,0x08209c0d,0x51e0e613,0x93848b26,0x39206a61,0x59e08303,0x938cfffc,0x8ba78304,
-0x8c739cf5,0x7bd38435,0x9cf88456,0xa5199cf8,0x7bb19497,0x6aef7390,0x73515a8d,0x5a8d6b51,0x5b524a4d,0x845673f4,0x73f563b4,0x84988478,0x8cd994fa,0x7c378497,0xadbb6bb4,0x7c354a4f,0x5af26353,0x5b335b53,0x53343a50,0x84997438,0x8cb984b8,0x8cb98cb9,0x8cd98cd9,0x8cb98cd9,0x8cb98cb9,0x84b98498,0x84b984b9,0x84b884b8,0x84b98cb9,0x84b884b9,0x84b98498,0x84b984b9,
-0x84988cb9,0x84b984b9,0x84988cb9,0x84b98498,0x849884b9,0x84b88498,0x84b97c98,0x6c167c58,0x6bf77438,0x7c787457,0x6bf57436,0x5b327c77,0x427029cc,0x0048428f,0x63b57c37,0x63946bd5,0x5b747417,0x6bf55b74,0x7c577437,0x74177c58,0x3a507417,0x5b322969,0x7cb673f7,0x6bb46bb4,0x42b263b5,0x5b527c56,0x7c3773f6,0x7c787c78,0x84988478,0x84988498,0x84988498,0x8cb78cd8,
-0xad179cd7,0xbd97bdb8,0xbdb8bd97,0xc5b7c5b8,0xd5f8c5d8,0xd618d618,0xcdf7d618,0xd618de18,0xe679de58,0xe678e657,0xee56d5d5,0xff3afe99,0xff5bff3a,0xff1af6d9,0xff59ff3a,0xee56f656,0x1800bc8e,0xe6779b8a,0xd572c4ef,0xe613d5d5,0x832ac4f3,0x1860d659,0xee99730b,0xff181840,0x48a0ffdf,0xfed8c4ab,0xf79dff59,0xfffdff59,0xff7dffff,0x3881e695,0x9b8dfffe,0xf6fbbd15,
-0x48808309,0x21473861,0x100062ee,0xcdf70800,0x08000800,0x4a081020,0x310262ca,0x20a13102,0x734c3123,0x7b8d5a68,0x49c26289,0x39604182,0x29203140,0x29203160,0x39813181,0x290028e0,0x39613120,0x39413140,0x28e03120,0x106028c0,0x39c1bd94,0x39204180,0x41603120,0x18205a61,0x79608200,0xfe7db2c0,0xeedadef2,0x62209384,0x52014140,0x6a825220,0x7ae04a20,0x30a09362,
-0 };
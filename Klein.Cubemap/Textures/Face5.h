@@ -1,1052 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT const unsigned int
-#endif
-
-A32BIT Face5[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x00000100,		/* dwHeight */
-0x00000100,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00010013,		/* dwpfFlags */
-0x00020000,		/* dwDataSize */
-0x00000010,		/* dwBitCount */
-0x0000f800,		/* dwRBitMask */
-0x000007e0,		/* dwGBitMask */
-0x0000001f,		/* dwBBitMask */
-0x00000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x31421020,0x31223922,0x20e04184,0x10401020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20e218a1,0x292418e2,0x29242104,0x31872925,0x31652945,0x29453186,0x31662945,0x39a739a7,0x31663166,0x31663165,0x21052104,0x29463186,0x29662946,0x31872966,0x31872966,0x29672946,0x31672926,0x21462146,0x214618e5,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31a82146,0x29a729a7,0x31c829a7,0x39a839e9,0x7b8d39c8,0x00004a28,0x31882966,0x31872987,0x39e831a8,0x31a839c9,0x31c931c9,0x31a839c9,
-0x31a831a8,0x296639e9,0x31a839c8,0x31c92988,0x39e93187,0x3a0931c8,0x318731c8,0x31a731a8,0x318631a7,0x39654a28,0x310328e1,0x39a53985,0x31242902,0x28e54188,0x528b3987,0x630d736e,0x31464a29,0x29243967,0x20c120c3,0x20612082,0x41c73965,0x62cc630c,0x29254a49,0x39c739a7,0x39e739e8,0x312439a6,0x396430e3,0x28e23943,0x41a63965,0x29033144,0x31442924,0x39652903,
-0x29033144,0x28e43124,0x29043145,0x398620e4,0x7bb0734e,0x8c1183f1,0x7baf7b8f,0x83d0734e,0x7b8f8c11,0x7b8f83d0,0x7bb07bb0,0x732e7baf,0x6aec732e,0x396662ab,0x31453145,0x31853165,0x314539a6,0x62cb5269,0x734e6b0c,0x39a86b2e,0x732d734e,0x736e7b8f,0x734e83d0,0x738e7b8f,0x83f08c11,0x31444a08,0x20e328e3,0x29663166,0x39e731a7,0x31864228,0x20e341e7,0x41c60800,
-0x104049e6,0x5a4738e2,0x10a03943,0x00003923,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10601060,0x21042103,0x21042104,0x29452945,0x31863166,0x31663165,0x31663166,0x39a73166,0x31663186,0x29243145,0x29453166,0x29253166,0x21462946,0x29462966,0x31872966,0x29462987,0x29262946,0x21262987,0x29662146,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10a30000,0x29a72967,0x39e929a7,0x39c839e9,0x41e631a7,0x00004a08,0x39a831a7,0x31873187,0x31a831a7,0x298831a8,0x31a839e9,0x39e9420a,
-0x31a831c8,0x39c82987,0x318731c8,0x29882988,0x31c82967,0x318731c8,0x31c831a7,0x31a73a09,0x31873187,0x62aa5249,0x394428e1,0x31232903,0x31443143,0x31263146,0x62ec4a09,0x6b2e736f,0x316762cc,0x29043987,0x188120c3,0x28a22081,0x29242903,0x10622925,0x4a2941e8,0x39c739c7,0x29652945,0x39652924,0x39643944,0x312328e2,0x39653965,0x31443985,0x31243124,0x31443965,
-0x31242903,0x39663124,0x28e420e4,0x29043165,0x7bb0736f,0x83d09452,0x7b6f6b0d,0x8c117b6f,0x83d08c11,0x83d08bf1,0x738f736e,0x7b6f7b8f,0x83d0730e,0x314562ab,0x314441a7,0x39a63986,0x39863145,0x5a6a41e7,0x62cc5a8a,0x732e736f,0x83f07b8f,0x6b0d736e,0x83af83d0,0x83d083af,0x4a49736e,0x39a641c8,0x31652904,0x42082125,0x318639a7,0x318631a6,0x08201082,0x39861882,
-0x20601860,0x418428e1,0x31024a05,0x08205a88,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x18e320e3,0x212418e3,0x31652945,0x29253186,0x31663166,0x31663166,0x31873186,0x31863186,0x31663987,0x31462945,0x31663166,0x29862946,0x29662966,0x29662146,0x29462146,0x29662967,0x29662967,0x29862966,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10c40001,0x39c831c8,0x39a839a8,0x39c739c8,0x1882734d,0x41e839a6,0x41a849e9,0x31a941c9,0x31a83187,0x3a0931a8,0x39c83a09,
-0x31a839e9,0x318839c8,0x296731a8,0x31882967,0x31a72987,0x31a831c8,0x39c931a8,0x39c831a7,0x39c72966,0x52693986,0x31233103,0x39653123,0x39863124,0x29053946,0x6b2e62ab,0x736e6b4e,0x5acc5acc,0x29263146,0x20811040,0x20611800,0x29042903,0x31663145,0x6b2d4a29,0x39a7524a,0x29042905,0x31452904,0x31033943,0x20a13123,0x31443144,0x29023985,0x20c22902,0x29032923,
-0x31643965,0x31253144,0x20e428e4,0x31253104,0x734e736f,0x734e8c32,0x734e734e,0x83f1734e,0x8c118c32,0x6b0d736f,0x83f16b4e,0x7b6f734e,0x83d07b8f,0x41a751e7,0x41c739a7,0x314539a6,0x4a083966,0x418741a7,0x630d3947,0x7b8f7baf,0x736f7bb0,0x7baf732e,0x8c518c31,0x5a8a8c31,0x522941a7,0x314541e7,0x31653986,0x21043165,0x210418c3,0x39a62945,0x18810800,0x4a0741e7,
-0x31430000,0x312220a0,0x5a671840,0x316449e6,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08610000,0x31862124,0x31662965,0x316639a6,0x31862945,0x318639a7,0x41c83186,0x31863987,0x31663186,0x31663166,0x31673166,0x29662966,0x21462986,0x29462967,0x31a72967,0x21462967,0x29672966,0x21252967,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010841,0x294520e4,0x29462945,0x31863187,0x39449450,0x49c61000,0x52285228,0x41e85226,0x39e831a8,0x31a731a7,0x39e93a09,
-0x39a831a8,0x39c939c8,0x31a83187,0x29682947,0x318731a8,0x31a831a8,0x39e939c8,0x420839e8,0x424939e8,0x5a895269,0x31033124,0x31452923,0x398641a6,0x418728e4,0x630d730d,0x6b0d736f,0x62ed5aac,0x39c85a8b,0x28c22923,0x20412061,0x312420a2,0x31663125,0x6b4d39a7,0x628b62ec,0x30e33105,0x39042882,0x396428c1,0x310220a1,0x29033143,0x20c041a5,0x29032922,0x29032903,
-0x29033965,0x312528e3,0x392528c3,0x7b6f5a4a,0x738f7baf,0x734e7baf,0x7b8f7b8f,0x83f17bd0,0x83f09cb3,0x3146734e,0x736f736f,0x732e736e,0x734d83d0,0x416649a6,0x5aaa5269,0x5a8a5249,0x49e85229,0x39664a08,0x738f3967,0x7b8f736f,0x7b8f736f,0x7baf7b6f,0x83b08c10,0x52493105,0x39463986,0x4a283145,0x292441e7,0x29250841,0x292439a7,0x08003166,0x39a60800,0x18a12944,
-0x00000000,0x10600000,0x080018a1,0x20e241c6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x210418c3,0x20e32124,0x29452925,0x31662925,0x31663966,0x39a73186,0x31462904,0x39a73166,0x31663166,0x31873166,0x31672946,0x29462946,0x29672946,0x29872946,0x31872967,0x29872966,0x21052987,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10811082,0x38e35a89,0x51e52040,0x62886288,0x5a896267,0x41e85228,0x318739c8,0x39c839c8,
-0x420939c8,0x39c839c8,0x39c831a7,0x31883188,0x31c831a8,0x29662987,0x39a831a8,0x420839e8,0x4a294208,0x528a4a49,0x39433985,0x398628c2,0x31453145,0x62ed3167,0x6b4e6b4e,0x630d62ed,0x6b2d62ec,0x62ec5aab,0x20a24a49,0x396528e3,0x28c33103,0x290528a3,0x39a741a7,0x630c62ec,0x312562ab,0x208141a7,0x310228c1,0x29013102,0x18401880,0x20e13944,0x28c12901,0x20c128e1,
-0x186020a1,0x310528c3,0x6aab4166,0x7bb07bd0,0x738f7bd0,0x7baf7baf,0x736e7bd0,0x8c327baf,0x7b8f83f1,0x524a39a7,0x6b4e7b8f,0x83d0734e,0x7b2d838f,0x734d51e8,0x6b2d7b8e,0x7bae7bae,0x734d7bae,0x39455229,0x734e732d,0x734e734e,0x7bd07b6e,0x83af738f,0x41a77baf,0x39a628c4,0x41e73165,0x39a64a07,0x10404a07,0x314520c3,0x39853145,0x10400800,0x310341a5,0x10001840,
-0x00000800,0x00000000,0x00000000,0x00000000,0x00000800,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x10820020,0x292518e3,0x20e42104,0x20e42945,0x31662905,0x31863186,0x31663125,0x31663186,0x31663166,0x296639a7,0x29662946,0x29463166,0x29872987,0x31872946,0x29872967,0x29672946,0x10a32946,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08202124,0x72e93985,0x51c36246,0x72e962a8,0x5a486288,0x5a895a68,0x39c85289,0x318739c8,
-0x4a2939a8,0x420939e8,0x31a741e8,0x39a839a8,0x31c839e8,0x318731a8,0x29672126,0x39c74208,0x4a294229,0x4a49526a,0x28e25227,0x20e328e3,0x41c73965,0x6b2e4a09,0x630d738f,0x62ec62cc,0x62ec6b4e,0x528a5aab,0x52495aab,0x398539a6,0x29053966,0x39873967,0x4a093987,0x630d62cc,0x62ab62cc,0x316462aa,0x28c13102,0x20a03102,0x28e13101,0x290141a5,0x18602901,0x20c128e1,
-0x20e22902,0x6aec39a6,0x7b8f734e,0x7bb0736f,0x7baf736f,0x736f7b8f,0x7baf7baf,0x84117bd0,0x736f8411,0x736f39c8,0x6b4e734e,0x7baf734e,0x83af83af,0x7bae734d,0x630c6b2c,0x7baf630c,0x734d7b8e,0x41c75a49,0x6b0d6b0d,0x6b2d6b2d,0x6b0d6b0d,0x736e738f,0x49e8526a,0x4a283966,0x41c762cb,0x42063144,0x10601880,0x31652904,0x10003144,0x18811000,0x310320a1,0x49c63103,
-0x102028c0,0x00001000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21041082,0x21042124,0x20e42945,0x21053987,0x20e42925,0x31463125,0x31663166,0x31663146,0x31663166,0x31662966,0x29463187,0x31872967,0x29672967,0x31872967,0x29872987,0x00002967,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10201000,0x28a11800,0x18001000,0x206028a1,0x206028a0,0x20802080,0x18201800,0x10001820,0x00000820,0x10001000,0x08001000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x8bad1861,0x41616267,0x6a886ac7,0x5a486ac9,0x52285207,0x39a85269,0x39c841c9,
-0x41e941e9,0x42084209,0x39c831a7,0x31c831c8,0x31a839c8,0x39c839a8,0x31873167,0x39e831a7,0x42284229,0x52685289,0x31445248,0x396530e3,0x42083145,0x632d5aab,0x632d632d,0x630d630d,0x39885acc,0x31463167,0x5acc528b,0x62cc62eb,0x5acc5acc,0x5aab4a09,0x62ec5aec,0x630d62cc,0x62ec630d,0x5aaa62ec,0x310228e2,0x18603102,0x20a03102,0x31432901,0x20c020c0,0x28e23102,
-0x20801840,0x6b0d4a09,0x83d083d0,0x736f7baf,0x7baf736f,0x6b4e738f,0x7baf734e,0x7baf738f,0x5acb7baf,0x738e630c,0x7baf7baf,0x83f0734e,0x736e736e,0x5aaa6b4d,0x314441c7,0x7b8e5aaa,0x7b8e83cf,0x6b2d6b0d,0x6b2d734e,0x630c62ec,0x630c62ec,0x6b2d734e,0x62ec6b2d,0x7baf734d,0x20c2736d,0x28e220a1,0x31441080,0x29233124,0x10202903,0x08200800,0x49c74a07,0x49e7732c,
-0x312241a4,0x102028e1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10a20000,0x210418e3,0x39a72925,0x31462925,0x39a73166,0x29053145,0x39873166,0x31663145,0x31a73166,0x31873187,0x31873187,0x31873167,0x31873167,0x29672946,0x29672946,0x00002146,
-0x00000000,0x00000000,0x00000000,0x10000800,0x10001800,0x10000800,0x08000000,0x10000800,0x20601800,0x20601800,0x28e020a0,0x30e02880,0x184028e0,0x28a02860,0x28c03921,0x30a12880,0x28403080,0x10202860,0x00200800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x00000000,0x8bee0000,0x51a25a46,0x5a056246,0x6ac851e4,0x5a695a48,0x42094a08,0x41e941e9,
-0x420941e9,0x39a64209,0x18832945,0x318631a7,0x318731a8,0x318739e9,0x39c82946,0x4a494209,0x3a084a49,0x39a539c6,0x41a53164,0x29043124,0x39c739c7,0x630d5aac,0x630d630d,0x5acd5acc,0x18c5422a,0x21051884,0x62ab4a08,0x62cc5acb,0x62ec5acc,0x5acb62cc,0x524a5aec,0x62ec6b4e,0x6aed630d,0x4a0762ec,0x28e228c2,0x31223102,0x10003102,0x39833943,0x31022921,0x20a128e1,
-0x20803102,0x6b2e4a09,0x83b0736e,0x7bd0738f,0x7bb083f0,0x734e738f,0x738f6b4e,0x738e7bd0,0x62ec6b2d,0x39c7528a,0x7b8f6b2d,0x736e6b4d,0x4a284a28,0x39a53165,0x39643144,0x5a8a39c7,0x736d7b6e,0x6b2d6b2d,0x62ec6b2d,0x62ec630c,0x630c6b2d,0x6aec6b2d,0x7b8e6b0d,0x630c62ec,0x312439a6,0x20e23964,0x39850820,0x316439a6,0x10000800,0x62cb0800,0x83cf7b8e,0x41c77bce,
-0x20801840,0x100028e0,0x08200800,0x10402902,0x28e11840,0x38e22860,0x082020a1,0x08000800,0x28c11041,0x20a22881,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29242124,0x39a72104,0x398739a7,0x39a72925,0x29253987,0x31253166,0x29463146,0x31873186,0x318739a7,0x29263187,0x31873187,0x31672946,0x318731a7,0x29462946,0x00000863,
-0x00000000,0x00000000,0x20011000,0x412230c0,0x30612020,0x18002041,0x30802860,0x28a13060,0x20401821,0x20602061,0x20601820,0x20601820,0x10001800,0x18402060,0x30a030c0,0x28c038e1,0x41403100,0x41023960,0x00210800,0x00000000,0x21040000,0x00000000,0x00000000,0x00000000,0x00000000,0x10000021,0x5a0372c8,0x5a455206,0x62676286,0x49e75a48,0x39a818a2,0x420941e9,
-0x41e939a8,0x20e341e8,0x39663145,0x31860000,0x29673187,0x296739a8,0x41e941e9,0x420839a7,0x420839e8,0x41a639c6,0x314449e6,0x42283144,0x292441e7,0x31872966,0x5acc2946,0x62ed5aab,0x524c5aac,0x20c42906,0x312428e3,0x62ed39c6,0x5aac6b2e,0x6b6e630d,0x18c439a7,0x62ec41e8,0x734e6b4e,0x41c762ec,0x28c228e2,0x28e128e1,0x28c128c1,0x20c03943,0x184020e0,0x31023102,
-0x28c128c2,0x736f3146,0x7b8f7b6f,0x7bd083f1,0x7baf736f,0x62ec7bb0,0x738f736f,0x7b8f6b4e,0x31875acb,0x42083186,0x62ec6b4d,0x39a74a29,0x396541c6,0x39843964,0x396439a5,0x734d4a49,0x7bae736e,0x7b6e6b2d,0x62ec736e,0x5aab6b2d,0x62ec6b2d,0x7b6e6b2d,0x39867b8f,0x736e5269,0x31442924,0x00003964,0x290318a1,0x20c23144,0x10000800,0x83cf5228,0x7bef7b8e,0x83ef7bce,
-0x08001840,0x102020a1,0x18401860,0x20801840,0x28c03101,0x28a11800,0x208028c0,0x28c028c0,0x30e028c0,0x30c12041,0x10202060,0x08000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20e40000,0x18c33165,0x39a62924,0x29252945,0x29453166,0x29252946,0x31872945,0x31873187,0x318831a7,0x31a83187,0x31a72987,0x29672967,0x29873187,0x29862987,0x00000000,
-0x00000000,0x18401820,0x30c03921,0x39003900,0x49426225,0x41014961,0x202030a0,0x202030a0,0x20402860,0x28a01820,0x20402020,0x20202020,0x20601800,0x18001800,0x20201800,0x30a02880,0x41223900,0x30c03901,0x39214161,0x08001000,0x00000000,0x00000020,0x00000000,0x00200000,0x10000000,0x30c028c1,0x2020d616,0x62872060,0x628772e9,0x524749c5,0x42080800,0x420941c8,
-0x39a74229,0x100039c7,0x28e03962,0x31253963,0x39873987,0x210439e8,0x39e831a7,0x39c839e8,0x39a739c7,0x39c54207,0x41c63144,0x62cb3144,0x39a72104,0x316639c8,0x29464209,0x4a6a4a6a,0x5acb5acc,0x18a15a8c,0x28e328e3,0x4a4b28e4,0x5aec630d,0x528b632d,0x20c42125,0x6b4e39a8,0x62cc62ec,0x5a8a62cc,0x29023123,0x28c228e2,0x310228e1,0x31022080,0x28c128c1,0x28c13102,
-0x30e31860,0x7baf3966,0x738f738f,0x738f736e,0x736e7bd0,0x736e736f,0x6b2d630d,0x39a64a4a,0x31663165,0x39a63986,0x316539a6,0x41a53985,0x6b0b41a5,0x39853985,0x41a639a5,0x4a2920c3,0x738f738e,0x7b6e6b2d,0x736e7b8e,0x39a75aab,0x6b4d526a,0x6b4d736e,0x528939a6,0x736d7bae,0x41e73165,0x08001061,0x292318a1,0x10203964,0x5aa90800,0x738e6b4d,0x738d7bcf,0x29246b0c,
-0x10001880,0x18601840,0x28e03100,0x208028c0,0x18001820,0x28a028a0,0x20a03100,0x28a02060,0x20401860,0x392251e4,0x5a473942,0x286030c1,0x20801860,0x18201000,0x08001000,0x00000000,0x00000000,0x00000000,0x18a23166,0x316618c3,0x29053187,0x29452946,0x31663166,0x31873166,0x31a73187,0x31a83187,0x31a83167,0x298731a8,0x29673187,0x31872987,0x298731a8,0x00000000,
-0x18200000,0x51834142,0x390038e0,0x38e04100,0x6a467ac8,0x62466a67,0x59e45a05,0x410038e0,0x49414942,0x39005183,0x30a04101,0x412138c0,0x38c12020,0x38c22820,0x28a02040,0x30c02860,0x390230c0,0x30c028a0,0x41212880,0x28c038e0,0x08002080,0x00000000,0x00000000,0x00200000,0x28000000,0x40c03080,0x3100838c,0x62862040,0x6aa86aa8,0x20c049e5,0x20e40000,0x41e839a8,
-0x100041e9,0x28801041,0x39214182,0x41c63962,0x31873146,0x4a694a48,0x39c74228,0x31873166,0x31864208,0x318541e7,0x41c63965,0x52492903,0x318641e7,0x18c32924,0x18c418c3,0x528b528b,0x528a528b,0x31645a8c,0x316428e3,0x318728e4,0x5aec5aec,0x20e4630d,0x20c418a3,0x630d62cc,0x6b0d62ed,0x62eb62ec,0x20e25a8a,0x39433102,0x31023944,0x31223944,0x20a02901,0x20a020a0,
-0x312428a1,0x7b8f7b6e,0x736e7b8f,0x736f7b8f,0x7b8f736e,0x6b4e738f,0x29244229,0x630c5289,0x39a63186,0x4a0839a6,0x314441a6,0x41e641a5,0x39855aa9,0x39643985,0x290341a5,0x630c5229,0x734e738e,0x7b8f7b6e,0x5aab7bae,0x41c84a09,0x7bcf6b2d,0x41e76b2d,0x62eb2945,0x39855269,0x39853985,0x10601040,0x39642903,0x100028c1,0x41c61020,0x738e4a49,0x31246b4d,0x00000800,
-0x18202040,0x10001840,0x10001000,0x18401000,0x288028a0,0x10002060,0x28a02080,0x206028c1,0x418330e1,0x5a05a48f,0x49a44162,0x51e551e5,0x5a2551e4,0x6aa76266,0x7b096a67,0x28a051c5,0x20a21840,0x00000000,0x21241061,0x31862965,0x29253186,0x31863166,0x31462946,0x29463187,0x31c831a7,0x31873187,0x31873187,0x31873188,0x318731c8,0x298731a8,0x29872967,0x00000000,
-0x30e11000,0x51a251c4,0x414030c0,0x624559e3,0x62256a87,0x622559e4,0x516259e5,0x494159a2,0x41015182,0x49624101,0x49415182,0x41404961,0x51824961,0x51614921,0x38c038c0,0x40e038c0,0x49425161,0x39204141,0x30e03920,0x41424162,0x41845225,0x00000800,0x00000000,0x00010000,0x38601800,0x10007246,0x62a830c2,0x52043941,0x416141a1,0x000028e1,0x29250000,0x31461862,
-0x00002945,0x69e40800,0x30c07ae8,0x28c02060,0x4a4841e7,0x52694a49,0x39e839a6,0x31463186,0x5acc3166,0x29045a8b,0x39a63185,0x31452944,0x186241e7,0x20c320a3,0x31661021,0x4a4b526b,0x424a4a4a,0x528a4a6a,0x28e349e7,0x41e93125,0x62ed4a6b,0x2924528b,0x210418a1,0x62cc630c,0x6b0d630d,0x630d62ec,0x28c24a69,0x28e23144,0x31233123,0x20a03943,0x208028e1,0x28e120a0,
-0x7b4e3103,0x7bb07bb0,0x7bd07bb0,0x7b8f734e,0x6b2d7bb0,0x39c76b2e,0x39c62925,0x31657bae,0x5a8a3165,0x6b2c736d,0x316441c6,0x39a541c6,0x31443964,0x39a53985,0x6b2d5a89,0x6b4e630c,0x738f5aec,0x6b2d7bd0,0x62ec5aab,0x7bae5a8a,0x4a297bae,0x31442904,0x106128e3,0x31443965,0x08002923,0x41a60800,0x49e63144,0x20812080,0x20822061,0x4a085249,0x39041001,0x10001000,
-0x5a256266,0x62645a25,0x30e16264,0x20801800,0x49a33902,0x39213941,0x5a2451c3,0x59e45a04,0x51e459e4,0x6ac86225,0x5a255a25,0x62866266,0x62666aa7,0x836a836a,0x6a8772c8,0x72e86204,0x49a48bac,0x00001820,0x10a218c3,0x29450861,0x39a739a7,0x316639a7,0x31872945,0x318741e8,0x31c731a7,0x39a831a7,0x21262946,0x31672947,0x296731a8,0x31a831a8,0x29663188,0x10000000,
-0x49622020,0x412049a2,0x498238e0,0x72c86a87,0x6a6672a7,0x51a36a66,0x62056225,0x620559a2,0x62256225,0x518251a3,0x61e36a24,0x388038a0,0x51205181,0x69c361c2,0x6a0459a2,0x69e459a2,0x51417225,0x38e04941,0x498238e0,0x41424162,0x520541a3,0x00004143,0x00000000,0x00000800,0x7a242881,0x62467a64,0x8c0e2060,0x41621860,0x49a33940,0x08001000,0x39850820,0x00002903,
-0x10000840,0x6a241820,0x6a229bec,0x38e059a2,0x39a420c0,0x41e74a49,0x29663165,0x31464a29,0x5acc4a49,0x290462cc,0x20e33165,0x20e33145,0x41a71821,0x4a2839c7,0x4a294a28,0x4a2a20e5,0x3a094a4a,0x528a39e8,0x4a494a29,0x39c841c8,0x42082104,0x29242104,0x29242964,0x5aac5acb,0x736e62cc,0x6b2d6b2d,0x39852924,0x20c23144,0x394328c2,0x28e13123,0x20a028c1,0x20e228c0,
-0x8390734e,0x83d083f0,0x7baf83d0,0x6b2d7bb0,0x738e736d,0x21032945,0x5aca2103,0x294441e7,0x62eb3986,0x734d734d,0x316441c5,0x4a0741c6,0x39643985,0x840f4a06,0x736d83ef,0x39864a49,0x20e328e4,0x186220a3,0x4a292904,0x7bae7bae,0x08204208,0x20a22902,0x08002923,0x20c228e3,0x39650800,0x39853965,0x08202903,0x18402080,0x10001000,0x20831842,0x49a52883,0x28a12060,
-0x62456246,0x62656266,0x6a876a86,0x62666266,0x62676aa8,0x62876287,0x62455a25,0x6aa66a86,0x51a36245,0x51e459c3,0x72e872e8,0x6aa76286,0x838b7b6b,0x7b297ae8,0x7ae872a7,0x51a259c2,0x72c851e4,0x18206ac8,0x10820000,0x18e318c3,0x31862965,0x29452924,0x316541a7,0x29662945,0x31a739a8,0x29463166,0x39c83187,0x29262946,0x31873187,0x318731c8,0x29863188,0x18400000,
-0x51c35182,0x41403900,0x622551a3,0x6aa76267,0x72a772c8,0x6a666a45,0x5a046225,0x6a876225,0x62046a46,0x620459e3,0x622459c3,0x7ac77286,0x62237ac6,0x7aa67ac7,0x7a877ac7,0x9bab82c8,0x83297ae8,0x7aa6938b,0x40e05181,0x30e030a0,0x39413921,0x41434983,0x00001000,0x00000000,0x72441020,0x62646a43,0x734c1000,0x28a03942,0x28c03961,0x314218a0,0x5a694a05,0x084028c2,
-0x20a30820,0x93ec28c1,0x93ca9bec,0x5a027ae4,0x29003940,0x31641881,0x20c32943,0x5acc4229,0x5a8b62ec,0x5a8b5a8b,0x294441e7,0x18a320e4,0x524a4a29,0x4a085249,0x41e84a08,0x31872986,0x422939c8,0x4a494229,0x4a494a49,0x4a294a29,0x10810800,0x29242903,0x314420e2,0x5acc5aec,0x632d62ec,0x39a662ec,0x31653165,0x292328e2,0x28c23123,0x31433102,0x10403123,0x526920c1,
-0x6b0d7bd0,0x73af7bf0,0x7b8f7bb0,0x630c4a4a,0x39a66b0c,0x31642923,0x41c72923,0x398439c5,0x49e741c6,0x6b2c734d,0x31224185,0x28e13102,0x41c51840,0x8c308c31,0x29247bcf,0x31652924,0x086118c2,0x29240000,0x4a499cd3,0x738e6b6d,0x31446b4d,0x28e220c2,0x39243123,0x396528c2,0x31852924,0x31433185,0x10201840,0x10001020,0x18211000,0x49a741a7,0x10003925,0x396430e2,
-0x5a045a25,0x62455a24,0x62465a24,0x62866aa7,0x62866aa7,0x6ae86ac8,0x6ac772e7,0x72e872e8,0x7b087ae8,0x51e36aa6,0x5a2562a6,0x62666ac7,0x62656266,0x7b0a7b09,0x83698349,0x6a677266,0x624672e9,0x49a54183,0x00000000,0x10a20000,0x29452104,0x210320e3,0x18a228e4,0x31662104,0x21252966,0x31a731a7,0x318739a7,0x31a72105,0x31a73187,0x31c831a8,0x316631c8,0x30e11041,
-0x41615183,0x412038e0,0x62054142,0x62666a87,0x5a256a67,0x6a666225,0x62256245,0x72876a86,0x82e87287,0x72867ac8,0x72877266,0x72877aa7,0x72a682e8,0x82c77ac7,0x7ac78308,0x83097ac7,0x8b2a8308,0x82e88309,0x59a37ac7,0x30e038e0,0x416230c0,0x41813100,0x28e14162,0x00001020,0x61c10000,0x62246a42,0x10002840,0x20607b2c,0x41633101,0x5a675247,0x08005247,0x00001041,
-0x10401061,0x7b0a49c4,0x9c0c93aa,0x7ac57ac5,0x31004160,0x18403101,0x292418a1,0x52ab0841,0x62cc6b4e,0x630d62cc,0x62eb62ec,0x4a292925,0x4a095a6a,0x62cb5a8a,0x102141c7,0x20e44a28,0x29451082,0x420839c7,0x39c74208,0x528a4a49,0x20e31040,0x20c220c2,0x29031060,0x62cc3187,0x632d6b2e,0x29245acc,0x29033965,0x28c23924,0x312328e2,0x29023123,0x20a128e2,0x420820e3,
-0x83d07bcf,0x738f73af,0x31865aab,0x41a62905,0x31653165,0x20e32102,0x39a620c2,0x106020e2,0x28e320c1,0x62cb7bae,0x10203944,0x41844185,0x41a51860,0x734d736e,0x29446b2d,0x29442103,0x318518c3,0x6b2c2925,0x4a6918e3,0x738e630c,0x20e2630c,0x41853164,0x20413965,0x29033944,0x42073985,0x29034207,0x08001840,0x18201000,0x39863945,0x732d7b6e,0x5a696b0c,0x734c5269,
-0x62456aa7,0x62666245,0x62666245,0x62466a66,0x51c45a25,0x62a65224,0x72c76aa6,0x6ac76ac7,0x7b4972e8,0x72e97308,0x62866285,0x5a246286,0x5a245a04,0x72a75a65,0x836972c6,0x72c68369,0x51c34160,0x398430a0,0x00201041,0x18820000,0x20e418c3,0x00201082,0x21242124,0x296631a6,0x294639e8,0x31a73187,0x39c739c7,0x29452945,0x39a73187,0x31873187,0x318631a7,0x41213080,
-0x38c049a1,0x49414961,0x6a8751a3,0x62666a66,0x5a0472a6,0x62456224,0x62666a87,0x7ae972a7,0x72a76a66,0x7ae86a66,0x72a77ae8,0x7ac87266,0x7ae87b08,0x83298309,0x7ae8936a,0x7ae87ae8,0x82e88308,0x7ae88329,0x7ac78308,0x38e05a05,0x31003921,0x414130e0,0x30e030c0,0x206030c0,0x72650800,0x61e46202,0x08001800,0x18218bcd,0x30e02080,0x41633922,0x00004142,0x00000000,
-0x10000000,0x5a416aa9,0xa44d7b26,0x93caac4c,0x39206201,0x20c128c0,0x080010a0,0x424a3166,0x62cd52ac,0x6b2e5acd,0x42086b0d,0x29452945,0x4a084a49,0x52495aac,0x39453123,0x41c71021,0x18a23185,0x29a62925,0x39a618c3,0x4a4939e7,0x21030040,0x290320e2,0x39651040,0x62ec39c7,0x732d62ec,0x312528e4,0x734d5a6a,0x39245209,0x310228e2,0x28c128c1,0x290228e1,0x29262904,
-0x7bb06b2e,0x39e7526a,0x31655249,0x20a241c6,0x31443985,0x29022924,0x39c639a5,0x20c11881,0x734d18c2,0x5aaa7b8e,0x20601840,0x104041a5,0x29233144,0x18a22924,0x41c73165,0x6b6d5a8a,0x73ae7c0f,0x4a077bae,0x734e630c,0x5269736d,0x29042925,0x31033145,0x394520a2,0x292428c3,0x41c61881,0x28e33164,0x20c23165,0x39a720c3,0x7bcf5acb,0x8c308410,0x7bef8c50,0x738e7bef,
-0x72c76286,0x72e76a86,0x62457ae8,0x62455a04,0x62456a66,0x626551e3,0x6aa76aa7,0x73087308,0x7b2872e7,0x520272e7,0x62657b29,0x51e35a45,0x626651e4,0x7b0862a6,0x72e77b28,0x7b087b28,0x49826a68,0x30e13901,0x00001040,0x00000000,0x000018a3,0x00000020,0x00200000,0x31862124,0x31a731a7,0x296639a8,0x39c831a7,0x318739a7,0x39c83187,0x31a739a7,0x4a2831a7,0x59e45183,
-0x49614160,0x51614120,0x5a256245,0x62255a05,0x6a865a25,0x7b097b08,0x6aa77b29,0x72a77ae8,0x8b4a8309,0x832972c8,0x832972a7,0x72a77287,0x8b8a8329,0x83298309,0x8b6a8b29,0x83087ac7,0x82e87ae8,0x7ac78308,0x83087ae8,0x496182e9,0x208038e2,0x30a030c0,0x30e16a67,0x20602880,0x62020800,0x6a636a63,0x182051c2,0x20a051c7,0x10005225,0x104028e2,0x00000800,0x08000000,
-0x28e11000,0x62431000,0x93ca6a83,0x93aa9beb,0x62228306,0x18203901,0x10401020,0x31a839c8,0x630d52cc,0x5aed5aed,0x18c42946,0x4a490841,0x41e741e7,0x20c25249,0x08003963,0x18602060,0x18a241a6,0x31e70000,0x39c72945,0x21044208,0x18c20000,0x20a12902,0x31243123,0x62ec3166,0x6b0d6b2d,0x7b8f28c4,0x734d734d,0x732c7b4e,0x31023123,0x28c128c1,0x20a23102,0x28e52082,
-0x62ac5a8b,0x41e73986,0x18613144,0x28e31861,0x29033985,0x290320e2,0x31653985,0x4a063164,0x6b0c39a6,0x398562cc,0x31233964,0x41a528e2,0x31653165,0x29043144,0x29032924,0x52893986,0x6b4c62eb,0x41c65249,0x41e839a7,0x39c739a6,0x29043165,0x52283144,0x20c33985,0x31453104,0x31653145,0x20a228e3,0x29242904,0x7b8e20a3,0x84108410,0x6b2d738e,0x62eb7bce,0x736d6b0b,
-0x6a866266,0x72a772e8,0x72e772a7,0x62656a85,0x49a251c2,0x51a151c2,0x51e251e2,0x6aa66286,0x7b286ac7,0x834a838a,0x7b286ac6,0x62655a45,0x62666265,0x83496ae7,0x8bab7b29,0x5a248b6b,0x49824140,0x30e14122,0x310428c2,0x00000800,0x00000000,0x00000000,0x00000000,0x29661082,0x39a83186,0x39c739a7,0x39a73186,0x31463166,0x39c839c8,0x39a731a7,0x39a739c8,0x498251a4,
-0x39004160,0x49404961,0x62666a66,0x5a0559e4,0x6a886aa8,0x7b097b09,0x834a72e8,0x7b097b29,0x7ac88329,0x83097ac8,0x7ae88329,0x72877ac7,0x7ae872a7,0x82e88b29,0x83088309,0x7aa77ae8,0x7ac77ae8,0x83297ae8,0x830972a7,0x82c77a87,0x28805160,0x20402880,0x30a02040,0x20002860,0x28805a26,0x392151c4,0x288038e0,0x736c59e5,0x52051840,0x00000000,0x00000000,0x28601060,
-0x49c44122,0x834a3100,0x832672c5,0x9bea8b89,0x6a2293aa,0x40e16201,0x28c130c0,0x422929a7,0x52ec422a,0x4aab52ed,0x29862987,0x39a74a29,0x528a4208,0x20c04a07,0x30c03961,0x28a03921,0x39441000,0x000028e2,0x29250000,0x00000000,0x18810000,0x28e22081,0x28e320c2,0x62cc3186,0x6aec6b2e,0x6aec2905,0x732d83af,0x736d83f0,0x28e23123,0x20a03123,0x28a220a0,0x290430c3,
-0x188220c3,0x31233123,0x394428c2,0x28e33124,0x31443144,0x31653144,0x41c63145,0x29242903,0x6b0d4a09,0x39866b2d,0x39a641e7,0x31433164,0x31652944,0x314539a5,0x29043145,0x31453165,0x31653144,0x20e33185,0x318518c2,0x31663166,0x290418c3,0x41c741c7,0x42094208,0x29253166,0x20c40821,0x29052905,0x41e839a7,0x7baf6b0c,0x6b4d7bcf,0x528a734d,0x104020e2,0x39851040,
-0x6aa66286,0x72e772e7,0x7b097308,0x7b0772e7,0x6a856a85,0x62666a87,0x51e149a0,0x41604180,0x72e64180,0x6ac76ac8,0x836a7308,0x6ac76aa7,0x628672c7,0x7b287308,0x8349834a,0x416072c5,0x59e249a0,0x30c04983,0x080051e5,0x100028e3,0x000020e3,0x00000000,0x00000000,0x18e30000,0x294639c7,0x39a63187,0x39a739c7,0x39a72105,0x39a739a8,0x39a839e8,0x39a739a8,0x518251a3,
-0x41204160,0x49a33900,0x5a0459e4,0x7b085a04,0x7ae972c8,0x7b087b08,0x72a872c8,0x72a77b09,0x8b4a7ac8,0x83298309,0x7ac77b08,0x7ae88329,0x7ae87ae8,0x7ae88329,0x7ae87b08,0x7b088329,0x7ae87ac7,0x7ae87ae8,0x83297ae8,0x72667aa7,0x7ac77286,0x412230e0,0x5a062020,0x28602040,0x412251a4,0x18004121,0x5a051800,0x28a04163,0x100049a4,0x18203923,0x00001020,0x18400000,
-0x30e03943,0x836a4183,0x8b888baa,0x8baa9beb,0x8b478369,0x59e27263,0x41c44140,0x29873186,0x31c8424a,0x52cc52cc,0x5aeb630d,0x39a639c7,0x39863145,0x31221840,0x49a33120,0x522528c0,0x18802080,0x41a51021,0x20c35269,0x00000000,0x10400000,0x29031861,0x29031881,0x6aec39a6,0x630c6b2d,0x736e30e4,0x7b8f7b8e,0x62aa736e,0x30e228a1,0x30e21840,0x628a49a7,0x41665209,
-0x30e34165,0x28a13103,0x30c330e2,0x394430e3,0x39853985,0x39c73165,0x398539a6,0x39a62944,0x734d3166,0x39a64a28,0x41e73165,0x39853985,0x292339a5,0x39a53185,0x10603985,0x186020a1,0x20c23123,0x31443144,0x31453164,0x31863165,0x41e739c7,0x41e84a49,0x4a294a29,0x318639c7,0x41c839a7,0x41e739a7,0x41e841c8,0x738e73ae,0x29453186,0x29241082,0x18404a06,0x41a441a4,
-0x6ac76aa6,0x6aa76aa7,0x83297308,0x6a8572c7,0x6aa66a86,0x62656265,0x72c772e7,0x51e26a85,0x51c151c0,0x8bab5a02,0x7b497b49,0x836a7b29,0x73086aa6,0x83496265,0x72e77b09,0x6ae65223,0x7b4a7b49,0x7ae9836a,0x18005a26,0x418228a1,0x08004184,0x00000000,0x00000000,0x00000000,0x31a62104,0x31862985,0x292539a6,0x39c73187,0x39c839e8,0x39c839a7,0x39a641a8,0x51a34982,
-0x41404140,0x51a33900,0x7b0859e4,0x72a872c8,0x72c86a87,0x6a8772a7,0x72a872c8,0x728772a8,0x7b098309,0x8329938b,0x72c77b08,0x7b087b08,0x7b088308,0x7ae88329,0x72a772a7,0x7b088349,0x7b097b08,0x7ae97ac8,0x8b6a834a,0x72878308,0x72667266,0x40e07267,0x288038e0,0x30c072a9,0x28a02860,0x18004121,0x204038e2,0x28a03902,0x20a01840,0x28c04141,0x080041a4,0x10001820,
-0x314328c0,0x312241a5,0x83897309,0x836993ca,0x8b487b27,0x6a6482c5,0x41e451c2,0x3a290000,0x3a093a29,0x000010a4,0x00200000,0x00000000,0x10001840,0x498428a0,0x418230e1,0x5a253921,0x39204981,0x00000800,0x4a2820c2,0x00002945,0x31450000,0x20a22903,0x31443144,0x6b0d39c7,0x5aab6b2d,0x738e4146,0x734e7baf,0x62ab7baf,0x30e330e3,0x730c3945,0x7baf7b6e,0x732d7baf,
-0x3144732c,0x30e230e2,0x28a228c1,0x630c3145,0x39865269,0x20e43165,0x39a73186,0x4a0841a7,0x526a6b0c,0x29653186,0x316541e7,0x290320c2,0x290339c6,0x20e33144,0x39852923,0x31233985,0x31443985,0x41a53985,0x10412103,0x42083986,0x526b39c7,0x526a41e9,0x41e84a29,0x41e83186,0x41c841e8,0x42084208,0x5a8a41e8,0x102162ab,0x528a3986,0x7bae736d,0x3122732b,0x312249c5,
-0x5a445204,0x62446264,0x72c66264,0x7b286a86,0x72e772c7,0x72c78b8b,0x8b696aa6,0x7b08832a,0x5a225a42,0x62214180,0x496059e1,0x7b496264,0x838b8bcc,0x62235a03,0x41205161,0x6ac641a0,0x7b6a7b4a,0x93ed8bec,0x082172a8,0x00000000,0x28e22902,0x49e60800,0x00000000,0x00000000,0x10620000,0x210439c7,0x31852924,0x318741e7,0x41e841c8,0x39c84209,0x39e741a8,0x41414162,
-0x41204961,0x62664982,0x7b0972a8,0x6ac86267,0x6aa772c8,0x624672c7,0x72c76aa7,0x72a772a7,0x6a866246,0x93cc8b49,0x7ac87ae8,0x7ac77ae8,0x8b4a7ae8,0x7ac77286,0x7ac77ac7,0x72a77266,0x7ac872c8,0x834a8309,0x72a772a7,0x82c87aa7,0x72a78308,0x72a66a65,0x30a06204,0x39012020,0x41443922,0x39023900,0x30404164,0x10004122,0x9c4b30c1,0x38e10800,0x28a01000,0x00001840,
-0x28e22880,0x000020c1,0x83890000,0x83498baa,0x8b698b68,0x6a848327,0x20c06223,0x00000000,0x21040000,0x00000000,0x00000000,0x10000000,0x49a330c1,0x41623920,0x412130c2,0x51c35a04,0x5a255a04,0x180051e2,0x00000800,0x398641c7,0x52693165,0x31652904,0x290320e3,0x6aec3145,0x730d6b2d,0x7b6e5209,0x734e736f,0x6b2d7b8f,0x72eb49e7,0x7baf7b2c,0x7b6e7b8f,0x7b8d736e,
-0x4a075aaa,0x51e75a69,0x41863145,0x630c738e,0x29456b4d,0x39c73165,0x39a63165,0x398641a7,0x39a73125,0x31442923,0x080020c2,0x29042924,0x31442903,0x29033144,0x10602924,0x398520c2,0x316439a5,0x31643143,0x39a73945,0x316639c7,0x39c739a7,0x41e841e8,0x39a741e8,0x39a641e8,0x39863166,0x62eb4208,0x734d7bcf,0x736d62cb,0x52685aaa,0x418541e6,0x28a03143,0x28e02080,
-0x62456286,0x5a245a45,0x6a856265,0x6a866a86,0x6a856264,0x6aa76aa5,0x6aa672c6,0x83697b08,0x7b288369,0x59e26ac5,0x59e251c2,0x73075a03,0x72e76ac6,0x5a037ae7,0x5a455a04,0x520449a3,0x7b296ac7,0x6ae793ec,0x0000830a,0x00000000,0x41431020,0x18403901,0x00000000,0x00000000,0x00000000,0x29240820,0x21032924,0x41c82965,0x39c739c7,0x41e84209,0x318741a7,0x51a349a6,
-0x49604980,0x72a872c8,0x6a876a67,0x6a876266,0x6aa772c8,0x72a76246,0x6aa76a66,0x7b0972a7,0x62456aa7,0x834a7ae8,0x834a8b4a,0x72c77ae8,0x7ae87ae8,0x72a76a86,0x7b0972e9,0x6a4672c8,0x72a772a7,0x834a72c8,0x72a772a7,0x7a877a87,0x7ac78329,0x82e97287,0x5a047ae8,0x518238c0,0x49624102,0x30c04120,0x6a233942,0x18406223,0xa48c6265,0x30a020a0,0x28a10800,0x08001000,
-0x39441840,0x08213142,0x20402061,0x83488348,0x83487ae7,0x83488348,0x00006244,0x00000000,0x00000000,0x00000000,0x00000000,0x18401021,0x5a042020,0x498351c4,0x51c24183,0x51a26a65,0x392051a2,0x51c26225,0x18204141,0x29241041,0x5a8939a6,0x398520c3,0x28e23144,0x736e3125,0x732d7b8e,0x7b6e7b4e,0x734e734e,0x83cf7b8f,0x736e732d,0x7baf7b8f,0x6b2d7b6e,0x7b6e736e,
-0x83d0732d,0x732d736e,0x7bae5aaa,0x6b2c6b4d,0x292441c7,0x29453166,0x31652924,0x734d6aec,0x18a25249,0x28c21020,0x18202081,0x29243144,0x31443144,0x31241861,0x39843124,0x39643985,0x31233964,0x31233123,0x31463945,0x4a4a4a09,0x6b4e526a,0x3987736e,0x39c73186,0x41c739a6,0x5a8a41c7,0x7baf6b4d,0x62a97bae,0x396320c1,0x290249c5,0x208020a0,0x28c028c0,0x20803100,
-0x7b6a6245,0x62656ae8,0x62656285,0x72c76a86,0x6aa66a86,0x6a8672c6,0x7ae672a5,0x7aa58328,0x8b8a8b47,0x72e572e7,0x59e35a04,0x51e151c1,0x7b287b29,0x62447b49,0x6aa759e3,0x5a6662c7,0x6ac75a66,0x7ae77308,0x000020a1,0x00000000,0x08001062,0x18601840,0x00002060,0x00000000,0x00000000,0x00000000,0x29042103,0x41c73986,0x4a0939a7,0x42084208,0x41c839c7,0x498341e8,
-0x51a23900,0x72a87267,0x6aa76aa7,0x62466a87,0x51e46a67,0x62466246,0x7ae96a87,0x72c86a67,0x6a667b08,0x72c77ae8,0x83298329,0x7b097ae8,0x72a772c8,0x72a76aa7,0x7b0972a7,0x72a77ae8,0x72c872a7,0x7ac87ae8,0x728672a7,0x7ac772a6,0x82e872a7,0x72a77ae8,0x7ae882e8,0x38a06246,0x51846a46,0x498228c0,0xa44d59e4,0x204030e1,0x834949e3,0x518159c3,0x51e52000,0x5a471800,
-0x10001000,0x10202080,0x30a02880,0x836849a4,0x8b898348,0x83288b48,0x08206224,0x18a10000,0x00000000,0x00200000,0x08000000,0x496328a1,0x5a0530c0,0x418059e5,0x5a0451c5,0x624559c3,0x624551a2,0x6a866266,0x30e05a03,0x08001020,0x29043125,0x39653945,0x28c31000,0x7b8f524a,0x7b8f736e,0x734e736f,0x734e7b8f,0x7b6f7b8f,0x7b6f7b6f,0x7b8f736f,0x7b90736d,0x4a09630c,
-0x6b2d738e,0x83ef62cb,0x5acb736e,0x3186528a,0x29243165,0x294518e3,0x6b2d2124,0x83d083f0,0x21046b0d,0x31653165,0x39863986,0x29043145,0x29043124,0x29232904,0x39853164,0x29233123,0x39643964,0x31243144,0x420920c3,0x6b4d736e,0x736e6b4d,0x39875a8b,0x316539a7,0x39a73144,0x6b4d6b4d,0x73ae6b6d,0x20a15aaa,0x20802080,0x18201820,0x30c02881,0x30e230e0,0x6b2b62c9,
-0x5a454961,0x6aa772c7,0x72a76a87,0x72e86a86,0x72e76245,0x6a867b08,0x73077b07,0x7b076aa6,0x7b076aa5,0x8baa7b27,0x62246aa5,0x5a015a02,0x7b275a02,0x59e38baa,0x49a24960,0x41616265,0x49a349a2,0x08206aa8,0x20c328e2,0x00000000,0x00000000,0x20810000,0x08200000,0x00000000,0x4a272921,0x00002902,0x39860000,0x41c72924,0x314541e7,0x420841e8,0x39c839c7,0x418339c8,
-0x7ac74920,0x62047267,0x6a866224,0x62456a87,0x62666a67,0x51c449a3,0x6aa872c8,0x72c86267,0x728772c8,0x7ae872a7,0x72c77ae8,0x72a772c8,0x7ae87b09,0x6aa772e8,0x62466a66,0x72a76a67,0x7ac86a46,0x72a772a7,0x72a77ac7,0x7ac77aa7,0x7ae87ac8,0x6a667ac8,0x72a76a46,0x62256a87,0x62057266,0x49612860,0x6a854120,0x18202060,0x30c041a3,0x51a14941,0x51a251a2,0x624530c0,
-0x28c02040,0x29041000,0xa48f6285,0x62656264,0x83697328,0x8b898b89,0x08208348,0x08000000,0x08000800,0x30c01820,0x420639a4,0x41605203,0x5a2351e2,0x496251e3,0x72a64161,0x62246a86,0x626551c2,0x5a246a86,0x51e36aa6,0x184030e0,0x28e32903,0x28e318a1,0x31041841,0x736e6aec,0x83b0732e,0x7b6f83d0,0x6b2e736f,0x734e7b6f,0x732e736f,0x734e7b6f,0x41a662cb,0x6b4d4a49,
-0x41e8736e,0x83ef738e,0x31444a28,0x29033144,0x31453125,0x31253125,0x6b0d20e3,0x7b2e83d0,0x396641a7,0x52694a28,0x524962eb,0x312528c3,0x29043145,0x28e33145,0x290328e3,0x31442903,0x31441881,0x31453123,0x18e42924,0x39c73166,0x29452946,0x4a2941e8,0x39844a07,0x20a22902,0x31443144,0x7bad736c,0x30e062c8,0x20a020a0,0x310028a0,0x31203900,0x52485a27,0x5aeb738d,
-0x62244102,0x5a235a03,0x6aa66285,0x7ae88349,0x7b2872e7,0x7b2872c7,0x7b287328,0x8369836a,0x72e67b48,0x7b2672e6,0x83288349,0x72c45a02,0x622451a0,0x72a67b08,0x41605a02,0x39005a03,0x30e04161,0x18001000,0x08000800,0x00000800,0x00000000,0x00000000,0x08000000,0x10403123,0x41e43984,0x42283983,0x29250000,0x41c728e4,0x4a283985,0x39a73166,0x39c839a7,0x49a439c8,
-0x7ac76180,0x72457267,0x72a67286,0x622572c7,0x6a676246,0x51c36246,0x624659e5,0x62256a67,0x72c872c7,0x72c77287,0x7ac772a7,0x72a76a66,0x72876a66,0x6a876a87,0x6a466a66,0x7ae86a67,0x72876a46,0x6a4672c8,0x72667ac7,0x7ac77ae7,0x7ae88308,0x6a457ac7,0x6a6682e8,0x6a6672a7,0x59806a46,0x412040e0,0x6a644140,0x28a049c3,0x41225206,0x49604100,0x7aa859e1,0x59c26203,
-0x51e438e0,0x18c06b0b,0x62878beb,0x49a14160,0x7b495a45,0x838a836a,0x08209c2d,0x28600000,0x408030e0,0x206051a5,0x5a8a6aca,0x62653942,0x62466246,0x41224160,0x62245a03,0x7ae77ac7,0x51e26244,0x62646264,0x51c36244,0x28a051a2,0x20c13984,0x29031880,0x730c3103,0x734e62cc,0x734e732e,0x7bb083d0,0x734e7b8f,0x7b8f83d0,0x732e7b6f,0x6b2d7b6f,0x6b0b5a8a,0x630d6b4d,
-0x736e1082,0x4a496b4d,0x49e728e3,0x31243124,0x31253105,0x39663946,0x62ab28e4,0x41477b4e,0x41863905,0x6b0c3185,0x5a8a7baf,0x62ab5a8a,0x31456b0c,0x28c320a2,0x31443945,0x39643964,0x31443964,0x31453985,0x292528e4,0x39c739a7,0x318639c7,0x41e741e8,0x20a11060,0x41a64184,0x49c65228,0x41a51020,0x41613942,0x28e028e0,0x184041a3,0x52476aa8,0x62ca6ae8,0x4249630c,
-0x49404100,0x62444100,0x6a862860,0x7b0772c7,0x6a856aa6,0x7ae87b07,0x72e772e7,0x83288369,0x7b287b28,0x72e67b06,0x7b097b27,0x7b2972e8,0x62636a65,0x6a446202,0x62247aa7,0x51e34120,0x498349c2,0x41443120,0x20001820,0x08001800,0x00000000,0x20a01860,0x39614181,0x51e55a66,0x39421820,0x29223963,0x10403123,0x41c520e1,0x49c65228,0x49a54164,0x41c749c7,0x41c541c7,
-0x82e76a45,0x82c87ac7,0x8b6a72a7,0x6aa76aa7,0x6a876246,0x622559e4,0x624559e4,0x62466245,0x6a4672a8,0x72a772a7,0x72a67b08,0x6a666a66,0x72a76a46,0x72a87287,0x6a6772a8,0x72877287,0x6a667ae9,0x82e8834a,0x728772a7,0x8b6a7ae8,0x7ae87ac7,0x7ae86a45,0x6a877aa8,0x6a6672a7,0x726672a7,0x72a76a25,0x51a151c3,0x18005a03,0x49621001,0x6a044960,0x59c161a3,0x62245180,
-0x39006245,0x080051e5,0x39006245,0x3121838b,0x41632081,0x73485a64,0x41e5836b,0x51c30800,0x62446a86,0x39006a85,0x10201861,0x62064160,0x72c87b08,0x498151a1,0x6aa66243,0x6a657ae8,0x62437ae6,0x5a035a02,0x390049a1,0x39833100,0x28e320a1,0x314530e4,0x6aec62cc,0x738f6b0c,0x736e6b4e,0x736f734e,0x736e83d0,0x6b2e7b8f,0x736f738f,0x736e6b2d,0x398583ef,0x4a086b2c,
-0x49e839a6,0x39853144,0x292420e3,0x312420c2,0x4a085a69,0x31453986,0x734e28e5,0x62cd734e,0x314562ab,0x31253146,0x4a2862cb,0x84108c30,0x5a8a7bae,0x31243124,0x31443103,0x312420e3,0x39653124,0x312420c3,0x29453165,0x526a3147,0x316441e8,0x20a01040,0x41c53122,0x41c549e6,0x39433963,0x394230e1,0x28e028c0,0x29013941,0xb554944e,0x5aca83ce,0x52696b6c,0x52694a28,
-0x41205140,0x51604940,0x416059a1,0x72e65203,0x6a866aa7,0x7ae86aa5,0x72c77b28,0x7b288349,0x7b077b28,0x72c56ac5,0x6aa56aa5,0x72a87ae8,0x72a67ac8,0x7ae76a64,0x7aa782c7,0x38e040e0,0x51e43921,0x39235a46,0x00000800,0x08000800,0x00000000,0x49e30800,0x62876aa7,0x49c36ac9,0x20204982,0x316230e1,0x00003983,0x41e53163,0x6a8720a1,0x620461e4,0x59e659e6,0x40e151c5,
-0x8b287244,0x7ac782e8,0x7b087ac7,0x6a8672c8,0x622672c8,0x6a666a46,0x51c45a05,0x5a0559e4,0x7ac86a67,0x7ae86225,0x72a87ae9,0x7ae87ae8,0x7ac87287,0x6a677287,0x7ac86a67,0x72a872c8,0x6a666a46,0x72666a46,0x7aa76225,0x83497ac7,0x72a78308,0x82e87286,0x72a772a8,0x728772c8,0x7ae97287,0x7ac972a7,0x51a24981,0x28c06225,0x30601800,0x49206224,0x51826a03,0x72886203,
-0x6a865a24,0x08001820,0x08000800,0x18000800,0x10001840,0x20601000,0x08002060,0x622428c1,0x72c66a86,0x59e36a85,0x00001021,0x41215201,0x72a76a86,0x6a8638e0,0x62657ae8,0x6a6472e7,0x5a025a23,0x62436244,0x6a856243,0x39427b28,0x28e330e2,0x732d4166,0x6aec732e,0x7bb06b0d,0x738f7bb0,0x7b8f736f,0x736e7b8f,0x6b2d732e,0x6b2d6b2e,0x736d738f,0x6b0c5aab,0x31444207,
-0x31443124,0x39a539a5,0x314441a6,0x6b0b3965,0x5228732c,0x62eb732c,0x7bf0734e,0x7bb07bd0,0x52696b4e,0x31252905,0x6acc28e4,0x4a295acb,0x39a65aca,0x39656aeb,0x29033923,0x28e33124,0x31652903,0x31243124,0x29243145,0x20a041c7,0x184018a0,0x520741a3,0x41c641a5,0x39423984,0x208028a0,0x28c03900,0x28c028e0,0x8c2f5a47,0x83ef83ef,0x4a484a28,0x318639e6,0x31863186,
-0x40a061a0,0x59a15141,0x6a855181,0x5a667b0a,0x6a666265,0x72e872c7,0x6aa57b28,0x414051a2,0x51c259e2,0x5a014980,0x62034980,0x59a25181,0x6a646a44,0x7a847243,0x6a0282c6,0x40c061c2,0x38e14941,0x28e01840,0x10000800,0x00001000,0x18801020,0x520572e9,0x5a465225,0x62676287,0x49c349c4,0x20801860,0x4a054184,0x31003962,0x28402040,0x82c782c6,0x61c361e3,0x7a255962,
-0x7ac77203,0x8b498b49,0x6a457ae7,0x6a6772a7,0x6aa76aa7,0x6a467ac8,0x6a667ac8,0x62256a25,0x6a666267,0x72c85a04,0x6a876aa7,0x72c872c8,0x6a876a67,0x72a872c9,0x6a676a46,0x72886a87,0x6a6672a8,0x6a666225,0x6a6682e8,0x72a77266,0x6a457286,0x728672a7,0x6a667266,0x6a467287,0x6a667287,0x72876a66,0x836a834a,0x28a05a44,0x308030a0,0x728638c0,0x51618307,0x83495181,
-0x39406a86,0x20203921,0x18201840,0x28602020,0x394230c0,0x416149a3,0x41a53940,0x62241000,0x62657ae7,0x6aa672e7,0x000028c1,0x496251c4,0x72c76aa5,0x6a6451e2,0x62456a66,0x6a657286,0x72a56244,0x6a646a64,0x7b296a85,0x31415225,0x31243102,0x734d6aec,0x736e6b2d,0x736e7b8f,0x6b4e736e,0x738f736f,0x736f736e,0x734e5a8b,0x736e7b6f,0x41e86b0c,0x6b2d734d,0x39652924,
-0x31653124,0x4a283164,0x39647b8e,0x49a53944,0x39654166,0x630c41c7,0x84118c31,0x736e83d0,0x4a087b8e,0x49e83125,0x28c33105,0x31053944,0x7bae3166,0x52295249,0x392449a6,0x39452081,0x31243965,0x20a230e4,0x18600800,0x28e128c0,0x52263122,0x104041a4,0x208028e1,0x28a128c0,0x31002040,0x30c03900,0x6aeb5a67,0x4a486b4c,0x42085269,0x39a64a28,0x31653165,0x292439a6,
-0x51007222,0x48e03040,0x51a24980,0x9c4e7b0a,0x49816aa6,0x626649c2,0x6aa67308,0x390051a3,0x51c359e2,0x51a14120,0x51804100,0x492061e2,0x59813040,0x61a182a6,0x61817222,0x59825121,0x6aa64960,0x39621820,0x08000800,0x08000800,0x31004164,0x39623121,0x30c03900,0x51e328a0,0x39415a04,0x39235225,0x5a8828c2,0x61e35205,0x83288b09,0x8ae87265,0x7a6461a0,0x51205961,
-0x8b087223,0x7ac782e8,0x83088328,0x6a6772a7,0x6a676a67,0x6a876246,0x83296204,0x6a457286,0x6a886a87,0x626672a7,0x6a666a86,0x6a676aa7,0x6aa76aa8,0x72a86a67,0x6a676a47,0x7ae97288,0x6a457287,0x8b296a66,0x72667aa7,0x6a666204,0x82c77266,0x82e87ae8,0x6a466a45,0x6a4672a7,0x72a76a67,0x832a72c8,0x6ac8834b,0x30c05a24,0x28202040,0x830951a4,0x51611800,0x38e04100,
-0x41407287,0x38e049a2,0x39004162,0x49624141,0x41624162,0x62455a23,0x10004982,0x6a655183,0x72e76a85,0x626572e7,0x182049c3,0x62454181,0x6a8772e7,0x6a646a64,0x72c772c7,0x72866a65,0x6a656a64,0x72a68348,0x72e87ae8,0x314241c3,0x524a28e2,0x6b2d62ed,0x8c10734e,0x7baf736e,0x6b2e738e,0x7bb06b4e,0x7bb07bb0,0x734e736f,0x736e734e,0x4a085aaa,0x52487bae,0x31443985,
-0x62aa3965,0x52897bad,0x39a53145,0x49a549a5,0x83ef6aeb,0x738e7bef,0x62ec5269,0x62cb5acc,0x4a2918a3,0x312441a6,0x5a473124,0x28c35a69,0x29252925,0x8c317b8e,0x3924734c,0x392430e3,0x30e33124,0x394428e2,0x396349c6,0x41833983,0x31014183,0x41a44183,0x39625a46,0x626728a0,0x49c3834a,0xa4f230e2,0x5aaa6b2c,0x52aa4a28,0x4a284207,0x296441e7,0x31852964,0x31653165,
-0x7a648284,0x40c07223,0x59634140,0x30a051a0,0x522451c3,0x7b8b734a,0x73299c70,0x6a877b0a,0x51e35a45,0x624459e2,0x49404940,0x59c36a24,0x59805160,0x72227243,0x61a07222,0x30a038a0,0x5a043060,0x10009c0e,0x28a11820,0x30a11800,0x394128c0,0x39204183,0x392030e0,0x30c030e0,0x31012040,0x41623921,0x41411000,0x6a236204,0xa3cb61e3,0x72443920,0x8ae78ae7,0x82637a45,
-0x9b698243,0x8b498b29,0x83088328,0x6a867ac7,0x62666a66,0x72a76246,0x624672c8,0x6a878b4a,0x6aa75a25,0x6aa87b09,0x7b0972a8,0x6a876a87,0x520559e4,0x51e65a06,0x5a265a06,0x72a872c9,0x72a772a7,0x83097266,0x830982e9,0x83297aa7,0x82e882e8,0x6a458b09,0x72876a86,0x62466a66,0x6a476246,0x62ea72c9,0x52685268,0x41605246,0x62272060,0x49228b49,0x72a67267,0x20004941,
-0x28602020,0x20012020,0x41212020,0x49a34983,0x51c44164,0x62864161,0x1000838b,0x6a6559e3,0x62656a65,0x59e36265,0x20404981,0x72c83900,0x72a672a7,0x7b074140,0x6a867ae8,0x6a8572a7,0x8b8a6a64,0x83298baa,0x732a72c7,0x39633942,0x6b0c2903,0x62ec630c,0x7baf6b2d,0x62ec6b2d,0x7b6f736e,0x734e6b0d,0x7b8e734e,0x7b8f6b2d,0x7b6e7bae,0x734d3945,0x41a6734d,0x29443965,
-0x94507bae,0x29243144,0x39433124,0x498551c6,0x6b0c3125,0x31655229,0x73cf3165,0x8c0f8430,0x41866b0b,0x49c541a5,0x310349c5,0x398649e6,0x4a293986,0x83f06b0c,0x416541c6,0x416541c6,0x39443965,0x41a53944,0x396349e5,0x28e03101,0x30e03942,0x6aa84163,0x39213941,0x18405225,0xacf31840,0x62aa7b6d,0x52694a48,0x4a485269,0x316541e7,0x39c72924,0x41e739c6,0x29243165,
-0x72247223,0x61e17223,0x41004960,0x10004121,0x72a71000,0x5a255a46,0x734a6ac8,0x942e838d,0x62865a66,0x83676224,0x59c272a4,0x61e36203,0x6a0361c2,0x59607222,0x40a07244,0x41012820,0x18403060,0x41631000,0x30e03922,0x28a03100,0x39212040,0x39403922,0x49a33920,0x394049a4,0x28803940,0x31001820,0x20203901,0x61a25982,0x282061e3,0x4100936b,0x82e761c2,0x8b078b28,
-0x8ae67a43,0x83288b49,0x7ae78b49,0x7ae87ae8,0x6a876aa7,0x72a77287,0x834a7ae8,0x72c87b09,0x62666267,0x72c86266,0x72a8834a,0x51c35a25,0x5a0659e4,0x62475a26,0x59e55a06,0x72885a26,0x7aa772a7,0x72877ae8,0x728782e9,0x82e882e8,0x7a877a87,0x72a782c8,0x72a77b08,0x6a876a66,0x7b0a72c8,0x422a62aa,0x4a6b4209,0x49835248,0x6a863100,0x284059e3,0x492261e5,0x40e061e5,
-0x30407285,0x28405182,0x622559c4,0x5a456a66,0x51e430e0,0x838a6a86,0x2080838a,0x624459e4,0x6a855a03,0x416151c3,0x51c251e3,0x72e75a04,0x6a866245,0x72c76223,0x72c772c8,0x72a672a7,0x72e76244,0x62667b29,0x62a85a24,0x31023942,0x526928e3,0x6b0c62ec,0x62cb5aaa,0x528a2924,0x3967528a,0x736f732e,0x7b8f7b6e,0x7baf736e,0x3986632c,0x736d4187,0x3965734d,0x41c641a6,
-0x39854a28,0x31652944,0x39443103,0x49a64185,0x398641c7,0x29453145,0x7b8e39a6,0x39a57baf,0x520749c6,0x41a44184,0x49c649c5,0x41c75248,0x39a63986,0x83af62ab,0x49653965,0x49a649a6,0x41a649a6,0x39434185,0x49c51860,0x31013121,0x49c449a3,0x41a33962,0x416220a0,0x49c63941,0xa4d2a4f2,0x524862eb,0x52685a89,0x42284207,0x31654228,0x41e739a5,0x31853185,0x31652924,
-0x7a864920,0x61e26a25,0x38603860,0xeefbb4d1,0x8b4930c0,0x41612860,0x62885225,0x6ae97b6a,0x8bac7b4b,0x6a676aa8,0x51a16a86,0x51c04980,0x514059c1,0x72635181,0x28207a84,0x200038a0,0x10000800,0x41831820,0x416349a3,0x39203942,0x394028a0,0x38e14982,0x28a02040,0x418249a2,0x416149e5,0x51c44142,0x62055a06,0x30604960,0x59a05980,0xcd507263,0x72867ac8,0x6a448b66,
-0x6a007264,0x8b698327,0x7b088328,0x72c68369,0x83097ae9,0x72a772c8,0x83297ac8,0x72a76a66,0x62665a45,0x72e86266,0x8b8a72c7,0x5a255a04,0x49a36226,0x51e651e6,0x51e549a4,0x59c451e5,0x7ac87ac8,0x7ac872c8,0x83297ae8,0x83297ae8,0x83288308,0x7ae88308,0x7ac97b49,0x7ae97aea,0x630b6aa9,0x4a8b4a4a,0x4a4a4a8b,0x5aab526a,0x5a475a67,0x5a256a87,0x49413941,0x9bab82e7,
-0x61c19389,0x7a867224,0x6a867286,0x6a866a86,0x72a94142,0x6ac75a66,0x5a238bcb,0x62866265,0x5a257b09,0x51e43920,0x5a254161,0x626451e2,0x6a8672a6,0x7ae88349,0x83486a86,0x83496a87,0x83497b09,0x7b087b08,0x62676aa7,0x28c13962,0x49e63123,0x49c6734c,0x28e22080,0x628a3925,0x41e83145,0x738e738f,0x7b8f736e,0x41e76b6e,0x39a63145,0x7b8e7b8d,0x4a076b2d,0x312341c6,
-0x4a073985,0x39853123,0x41853944,0x8bef7b8e,0x522883ae,0x31653124,0x5a8b41c7,0x49e73104,0x524841c7,0x41855207,0x49e74164,0x31456b0b,0x6b4d41e7,0x8bd07bcf,0x416540c2,0x18405a48,0x310428e3,0x08003124,0x49e449a4,0x39423921,0x28a04183,0x206028a0,0x49c64163,0x949149e7,0x5aca8c50,0x528962eb,0x39c639a6,0x31654a27,0x39863165,0x31653165,0x31453985,0x4a083145,
-0x49205981,0x51406a03,0x49205142,0x39204960,0xd5d38369,0x418172a6,0x5a264182,0x5a665225,0x730a732a,0x838c7b6b,0x6a886aa7,0x6a868b6a,0x93a493a7,0x8327a408,0x72447a65,0x6a664120,0x30c120a0,0x41623901,0x49a149a3,0x28a14162,0x30e03941,0x72c74140,0x390059e5,0x49a330e0,0x5a265a66,0x51e43100,0x72876267,0x41003060,0x59a059a1,0x49405980,0x51638b69,0x40e03080,
-0x6a032820,0x7ac77286,0x83287b08,0x72c672e7,0x6a8672a7,0x72a772a7,0x72a772c8,0x6a6672a7,0x51c46266,0x59e46246,0x62666a87,0x72c86a87,0x6a8772c8,0x498449a4,0x5a064984,0x51a451e5,0x83297ae9,0x72c88309,0x834a8329,0x83097ae8,0x82c882e8,0x83298b09,0x72e872a7,0x5a8a732a,0x528b4a4a,0x4a6b422a,0x52cc4a6b,0x526b528b,0x62a8524a,0xb5109c0c,0x38c05a25,0x72867aa6,
-0x61e26a23,0x72658b27,0x6a666a66,0x6aa66a86,0x39005a23,0x6ae85a66,0x6ac67308,0x72c76286,0x72e87308,0x62666aa5,0x62253900,0x5a035a23,0x72a672a6,0x72a77b08,0x7b297ac7,0x6265c552,0x832893eb,0x6a658328,0x49c47b28,0x310349a4,0x39643123,0x31033123,0x28e230e2,0x30e428c3,0x630d3965,0x83f0738e,0x736e7baf,0x2924526a,0x8c103165,0x83af83ce,0x62a96b2d,0x41c53144,
-0x41e641a5,0x39853144,0x7b8d20c2,0x7b8e7b8e,0x39865228,0x62cb41c7,0x3145736d,0x312349c6,0x49c65227,0x6aaa732b,0x39653943,0x398662cb,0x49c84187,0x59e73966,0x8b8d7b6c,0x10008bee,0x7b6d1000,0x30e17b8d,0x28a02080,0x49c420a0,0x28a062c8,0x49e530e1,0x5a494a07,0x39a65269,0x52aa4a49,0x4a284a48,0x4a2841e7,0x31653165,0x31453165,0x20e33165,0x31653165,0x314539a6,
-0x516059e3,0x51606a03,0x620340e0,0x61e159c0,0x6a857284,0x5a4451c3,0x41424982,0x418249a2,0x946f4142,0x6acaa4d0,0x6aa8732a,0x5a6549c3,0x9c4a59e2,0x7b03b4a9,0x59a05980,0x41237ae6,0x49c31840,0x39205204,0x206030e0,0x30e028c0,0x41811820,0x834872e5,0x5161938a,0x39204960,0x5a255204,0x6aa75a25,0x72666aa9,0x41202000,0x51604900,0x38e059a0,0x10001800,0x20003941,
-0x28002000,0x7ae74100,0x83287b08,0x7b077b07,0x5a047ae7,0x6a467ae8,0x7ac86a87,0x72c87ac8,0x62465a45,0x62665a26,0x72c76aa7,0x6a8672a7,0x72a872a8,0x6a676a67,0x518459c5,0x59e559c5,0x72a772a8,0x72c872a7,0x83097b09,0x7b098329,0x83ab7308,0x736a838b,0x4a076b09,0x39a818a2,0x4a2c528c,0x4a6b4a2b,0x4a6a4a6b,0x52ac4a8c,0x4a4a52ac,0x41826266,0x30a06ac7,0x6a447265,
-0x59e16a63,0x72a6a40b,0x72a76a66,0x72a772e7,0x9bed6aa6,0x6aa76ac7,0x62667329,0x6ac76ac8,0x49c44182,0x626751e3,0x51e34160,0x51e251e2,0x72c772c7,0x7ae872a7,0x51e17ae8,0x6a856243,0x7b087b07,0x6a6572a6,0x51c472c7,0x72cb730a,0x522741c6,0x41a549e6,0x49c628c1,0x41866acb,0x62ec7b8e,0x7baf6b4d,0x526a7bcf,0x28c22904,0x6b0c7b8d,0x52495a89,0x41c662eb,0x41c541c6,
-0x31233984,0x31443144,0x8c109451,0x522883ae,0x4a0849e7,0x292441c7,0x52695269,0x418441a4,0x41443943,0x416549a6,0x5a6849a5,0x312372ec,0x414330e1,0x93cd9bee,0xac919c0f,0x10000800,0x62695a48,0x30e1734c,0x28e028a0,0x8c2e3143,0x312241e5,0x5a895a88,0x6aec8430,0x526939c7,0x5269630b,0x39a64a49,0x39c62944,0x292439a5,0x31452944,0x31453144,0x39863165,0x316541c6,
-0x59816225,0x61e361c2,0x62024920,0x51606203,0x72a56a23,0x206038e0,0x310030e0,0x30c04181,0x28c04163,0x62873942,0x5a065a45,0x72c97b0a,0x518330e1,0x412051a2,0x6a644960,0x20404180,0x62458b8b,0x30e030e0,0x5a0438e0,0x498130c0,0x7b474181,0x8b688326,0x7ae693ca,0x62446a64,0x41805202,0x62676265,0x7aa76246,0x51a051a2,0x49005160,0x412038a0,0x18002840,0x49a21840,
-0x28202000,0x20402020,0x72e81000,0x834872e7,0x6a867b08,0x6a6672a7,0x728672a7,0x72c872a7,0x62467309,0x72a772a8,0x6a666a66,0x72c872c7,0x832972c7,0x7b2972e8,0x72e86a87,0x72a872c8,0x72a87ae9,0x72e86aa8,0x73097b4a,0x6b097329,0x1081634c,0x00002104,0x00000000,0x4a2a0000,0x4a6c4a4b,0x4a4b422a,0x4a6b4a6b,0x4a8c4a6b,0x52ac4a6b,0x52254a4b,0x520351e3,0x72a65a04,
-0x6a866a84,0x5a246aa6,0x72a772c7,0x62656265,0x7b4a7b69,0x7b4a6287,0x49a35205,0x49c35204,0x38e028c0,0x62654982,0x51e5836a,0x62445a03,0x7b0872e8,0x830872a6,0x5a226a45,0x6a856265,0x7b07836a,0x72c68328,0x62a87b6a,0x5226838c,0x49c53122,0x31234184,0x7b4e49e6,0x7b4d83af,0x41863924,0x632c62cb,0x398562cb,0x41c62922,0x4a075248,0x41e75228,0x4a074a27,0x4a073964,
-0x29013984,0x83ae732b,0x1820732c,0x51e74165,0x41c549c6,0x41c53984,0x41a541a4,0x312249e6,0x39223942,0x41623921,0x626930c1,0x51a451c6,0x93cc6a67,0x8bcd9c4f,0x93ac7b0a,0x7287938a,0x28814143,0x39626248,0x20c028c0,0x62ca20a0,0x41e77b4d,0x83f039a6,0x7bcf8410,0x42074a48,0x39a539a5,0x39a518a2,0x31653165,0x28e33124,0x39653965,0x31453124,0x41a641c7,0x31443124,
-0x6a656224,0x72447285,0x494061e1,0xa40d6203,0x49806a85,0x30e03920,0x5a056245,0x204049a3,0x30a02880,0x204030c0,0x41634122,0x51e46267,0x494151e5,0x622551e2,0x30a05181,0x72e76aa4,0x62647b29,0x51e34160,0x62666266,0x49a172c6,0x7b276224,0x9beb8347,0x9bea9c0b,0x51e28327,0x5a455a45,0x6ac76ac7,0x620372a7,0x7ae66a44,0x620261e2,0x6a456a02,0x498440e2,0x72c70800,
-0x7a651800,0x394161e4,0x10001820,0x7b098329,0x72866a46,0x7b0972a7,0x72a772c7,0x8b4a7ae8,0x62255a45,0x72a77b08,0x7b097287,0x72c86a87,0x72c86aa7,0x7ae97ae9,0x7b297ae9,0x6aa872c8,0x5a886287,0x41e662a8,0x7bad5268,0x002062ea,0x00000000,0x00000000,0x00000000,0x420a18c3,0x4a4b4a2b,0x424b4a6b,0x528c4a6b,0x4a8c4a4b,0x4a8c4a6b,0x526a426a,0x49e35a67,0x72e851e4,
-0x7b0872c7,0x626572a6,0x7ae872c7,0x6aa55a22,0x6aa85a45,0x39616ae7,0x418141a2,0x49c34181,0x624551e3,0x6a866245,0x834b6286,0x5a235a24,0x72c772a8,0x83287ae7,0x62646a65,0x5a2449c1,0x5a4572c7,0x7b287308,0x5a8862e8,0x522541a4,0x208028c0,0x5a4849c5,0x7b6e838d,0x5a297b8e,0x310341a6,0x39844184,0x31213143,0x4a073964,0x4a284a07,0x4a075228,0x39a541c6,0x49c45a68,
-0x28c020a0,0x39246aca,0x41243945,0x59c759e7,0x39444164,0x41a541a5,0x396339a4,0x41834183,0x5a465a46,0x51c45a25,0x6aa94142,0x8ba95204,0x6a658328,0x7b09940c,0x41017285,0x494040e0,0x18004101,0x31002080,0x94703943,0x41e7732c,0x41c75a69,0x528a4a28,0x4228528a,0x318539c7,0x31643185,0x39c63185,0x52493165,0x41a64a08,0x49e741c7,0x31453145,0x39853145,0x31243985,
-0x5a036a86,0x62246a65,0x59826a22,0x8b2a5180,0x6a04ddf7,0x59e45a03,0x41813100,0x31204181,0x28c03921,0x286030e0,0x28817286,0x28801800,0x18002040,0x30e030c0,0x18002820,0x836a7b29,0x6a867b29,0x622459e2,0x8baa6a88,0x5a255a25,0x622451a2,0x93ea7306,0x8baa8b88,0x7b298bac,0x62867b29,0x62046aa7,0x93aa6a65,0x6a2382e7,0x492040e0,0x30c05180,0x41411800,0x51c42020,
-0x62026265,0x49406a02,0x49218b66,0x82e730a0,0x8b298309,0x7b0872a7,0x7ac88b4a,0x938a7ac7,0x622472a7,0x7ac86a46,0x7ae872a8,0x6a8772c8,0x6a666a86,0x72e872c7,0x834a6a87,0x6aa86a67,0x312449c6,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4a4b39c7,0x528c422a,0x4a8c4a6b,0x4a6b52ac,0x422b4a8c,0x4a6c424b,0x4a6b4a6c,0x41c84a8c,0x5a8a526b,
-0x72e87308,0x72e76aa6,0x62446aa6,0x72e86a65,0x31007308,0x520449e3,0x416149e3,0x51a349a2,0x51c349a2,0x5a045a04,0x8bac51c1,0x51c151c2,0x62666245,0x7ae772c7,0x51a17286,0x51a14960,0x6ac75a03,0x73299c6e,0x5a873983,0x49e449c4,0x39025a26,0x62685a06,0x83af5207,0x736c7baf,0x732b736c,0x31224184,0x31013100,0x41a55a48,0x49e541a6,0x4a063963,0x4a0662c9,0x49c44163,
-0x390128c0,0x52276289,0x830c5207,0x61e8cd76,0x416459e6,0x49e649c5,0x49e549c5,0x420541a4,0x7b2a6ae9,0x62477309,0x7b4b4142,0x93ea940b,0x9c0c6265,0x200059a4,0x51604120,0x40e040e0,0x180040e1,0x83ae7b6c,0x4a287bae,0x41e74a28,0x318539c6,0x41e73185,0x6b0b3165,0x314441e7,0x41c62924,0x736e39c6,0x52498bf0,0x5a4a3945,0x31255a6a,0x528a49e8,0x6b2d5aaa,0x5aab5acb,
-0x7b4a59c3,0xac4ec5b4,0x6a447265,0x51805181,0x518251a4,0x38e02860,0x410138e0,0x414130a0,0x28602880,0x5a0438e1,0x520259c3,0x20204142,0x72e64122,0x82e87ac6,0x20203060,0x72e893cc,0x6aa77b09,0x51a16a44,0x62456aa7,0x6aa66245,0x6aa66265,0x8baa8349,0x7b288ba9,0x62866aa6,0x628672c8,0x728672c8,0x72866a65,0x93479389,0x51605140,0x49636a44,0x18004122,0x6a664141,
-0x51c21800,0x7aa59bc9,0x622182e6,0x61c13060,0x8b086a23,0x7ac88308,0x6a667aa7,0x7ae87ac7,0x62247ae8,0x6a667287,0x830972a8,0x7ae96a87,0x72e96287,0x6aa86ac8,0x62876267,0x394249c4,0x28e02080,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x39c70000,0x4a4b4a6b,0x4a4b4a4b,0x422b4a6b,0x4a6b422b,0x422b424b,0x4a8c4a8c,0x4a6c528c,0x4a4a528c,0x528c528b,
-0x5a885a8b,0x5a6662a8,0x72e76286,0x72e86ac7,0x31215a46,0x41a24183,0x49a241a1,0x51e33920,0x49a151e2,0x51c24160,0x73095a02,0x51e251e2,0x62656aa7,0x72867b08,0x6a656a65,0x40e07285,0x73085181,0x41826266,0x396141a2,0x520551e4,0x8bad732b,0x30c27b4c,0x20a251c7,0x6aea4186,0x312249c5,0x39423942,0x49a54163,0x49e649e6,0x52265207,0x526749e5,0x30c04184,0x30e028c0,
-0x31012880,0x39243924,0xbd3551c7,0xde39de5a,0x41847b2b,0x396441a5,0x41a449c6,0x524741a4,0x72c96aa8,0x62476247,0x8bce30c1,0x5206940d,0x5a068bad,0x49204942,0x490038a0,0x38604900,0x38c061c4,0x83ce2903,0x4a285a8a,0x316541e7,0x39e73165,0x31653186,0x39a641c7,0x29443185,0x29233985,0x6b0c4a07,0x41c74a29,0x6b2c4a08,0x734d6aec,0x840f83cf,0x7b8d840f,0x20a25248,
-0x51e34141,0x49601820,0x6a655a02,0x51c372c7,0x5a036223,0x494159e2,0x38c030a0,0x49617ae8,0x284138c0,0x41602880,0x62242860,0x5a442880,0xa46e9c4f,0x93caa44f,0x832972a5,0x28c120c1,0x6ac7834b,0x62656284,0x6a8672e7,0x62456a66,0x72c87308,0x62666a87,0x62656aa7,0x62866a86,0x73296aa7,0x7b0872c7,0x8b278328,0x9ba982e6,0x82e67ae4,0x51c282e7,0x30c03920,0x5a0472e6,
-0x628730c0,0x282051a1,0x51403880,0x8ac361c0,0x69c17221,0x93486a23,0x8b497286,0x8b8a8308,0x7ac68349,0x72a872c7,0x7b097b09,0x5a876ae9,0x41a35a66,0x41e541c4,0x31634a26,0x39623983,0x206028c0,0x28c21840,0x000020c2,0x00000000,0x08000000,0x00000000,0x42080000,0x4a6c4a8c,0x4a4b528c,0x528c4a6b,0x52ac4a8c,0x4a6c4a4b,0x52ad52ac,0x52ad4a6c,0x4a6b422b,0x4a8b4a8c,
-0x39c8426a,0x526a39c8,0x5aa95289,0x5ac9736c,0x52274a48,0x49c24180,0x312049a3,0x5a0451e3,0x72a56225,0x5a036223,0x8b8b5180,0x5a246245,0x72c85a25,0x7ac772c7,0x7aa772a7,0x72658b49,0x7b297ae7,0x39206286,0x416251e5,0x49a34983,0x94106a68,0x100051a5,0x9cb26b0c,0x31016289,0x62a85a46,0x52055a46,0x392251e5,0x52065a47,0x498341e3,0x40c23881,0x6a2861c7,0x52066248,
-0x51c74185,0x94105209,0xcdf9c597,0xcdf9d65a,0x4185938e,0x39643984,0x39223964,0x41643923,0x412359e6,0x626849a5,0x5a897b6d,0x9c51b556,0x288051e5,0x49014920,0x61e340a0,0x494040a0,0x5a0459c1,0x316583ad,0x4a074a07,0x41c63185,0x41c639a5,0x31853985,0x31653185,0x31853165,0x39c639c6,0x41e83186,0x5aaa4a29,0x94927c10,0x8c308430,0x49e76b0b,0x31445248,0x316418a2,
-0x5a2472e7,0x496051c2,0x59e36a85,0x6a862880,0x72a65182,0x622359c3,0x51a14961,0x49604980,0x38c0a3ed,0x20002000,0x62224120,0xb513a44e,0xb4f0acd0,0xcd92bd32,0x8b8b9bec,0x5a651020,0x7b4a2080,0x72c77b29,0x6a8672c7,0x6a866a66,0x72e86aa7,0x6aa77ae8,0x62866ac7,0x62866aa7,0x7b4a6ac7,0x72e68349,0x6a6372c5,0x93679388,0x51a07264,0x414151a0,0x628772e6,0x30a028c0,
-0x30c14161,0x49004142,0x69c07222,0xa3a67a60,0x40609306,0x6a037a64,0x7a866a04,0x7ae782c7,0x83097ae7,0x8b8b8b8c,0x72e972e9,0x398349c4,0x39633963,0x398341c4,0x41c441c4,0x49e539a4,0x39433963,0x28812060,0x10201020,0x102020c2,0x10000000,0x10201020,0x106128e3,0x39e94a6b,0x422a3188,0x4a6b424b,0x4a6b52ac,0x528c528c,0x4a4b52ac,0x424b4a6c,0x426b422a,0x424a4a8c,
-0x4a6a422a,0x4a4a526b,0x4a4a4a4a,0x4a4a4a2a,0x49e74a49,0x6ac841a3,0x628762a7,0x51c151e1,0x62234180,0x72a572c6,0x8bab51e1,0x62256a86,0x59e45a04,0x72a77b08,0x82e772c7,0x82e78328,0x834a8328,0x41816266,0x416249a4,0x39005a04,0x83ae5a06,0x5a084163,0x83ae9471,0x5a2672eb,0x520551e5,0x416349a4,0x49a45a26,0x28e13943,0x5a073122,0xa3ef9c0f,0x8b8ea410,0x41645a28,
-0x7b0c49a6,0xcdb8bd56,0xbd97bd77,0x8bf1acf5,0x49a67b0d,0x396449e6,0x30e23943,0x39444986,0x7b4c5a48,0x8bcf7b2c,0x8c0fad14,0x28e3738f,0x4142836c,0x59815141,0x598059a0,0x59c14900,0x498261e3,0x39a649e6,0x41e739a5,0x316539a6,0x52894207,0x316441e7,0x52483165,0x4a285289,0x7bae5269,0x738e8410,0x7b8e6b0c,0x29454a49,0x29042924,0x188120e3,0x29243144,0x29032923,
-0x62446a86,0x51a35a03,0x51c33900,0x62246245,0x62256a66,0x49806a25,0x41204980,0x496051a2,0x72644960,0x41215162,0x836b49a1,0x944ea48f,0xacd0b4f1,0xbd32b531,0x49a3de37,0x102020a0,0x41803941,0x6a866265,0x72e772e7,0x7b086aa7,0x62866266,0x72e86a66,0x6aa66286,0x7b097b08,0x730972c8,0x7ae9836a,0x620072a7,0x726259c0,0x72a572a3,0x41406222,0x184049c2,0x30e04181,
-0x39404162,0x72225183,0x82448284,0xa3a492c1,0x69e06a00,0x69c27202,0x7a447a65,0x7ac68ac6,0x6a445981,0x73096aa6,0x39623962,0x31413921,0x39833963,0x39843122,0x31633163,0x394439a4,0x51e541a5,0x414349c5,0x10002040,0x10001000,0x10000800,0x10001820,0x10401860,0x3a0a0821,0x424b420a,0x528c4a6c,0x528c52ad,0x4a6b424b,0x4a8c4a6c,0x422a4a6b,0x424b424b,0x3a2a424b,
-0x29462987,0x18c41083,0x42694249,0x42284a8a,0x41e839c8,0x5a8a524a,0x49e24a06,0x72c76aa6,0x72a56266,0x5a2351c2,0x7b286a82,0x5a046a86,0x5a2451e3,0x6a666245,0x6a8472a7,0x7ac672c5,0x5a468328,0x52035a25,0x5a245a45,0x51e36aa6,0x8c0e7b09,0x7b4972e8,0x49c7734d,0x620651e7,0x51a46247,0x41224984,0x49a44184,0x31023101,0x9c713124,0xeebad659,0xde19e6bb,0x7b0cacf4,
-0x834e7b0d,0xb4f6bd16,0x9432a4d4,0x8bd19411,0x7b2d8c11,0x41443082,0x5a074985,0x8bd08baf,0x9411838f,0x732e9c73,0x31a620e4,0x7bcf6b6e,0x51c49c4f,0x6a0561e3,0x724661c3,0x62036a25,0x518438c0,0x39a53964,0x41c641c6,0x41c63985,0x5a8941c6,0x39a63144,0x31653985,0x4a482924,0x8c306b2c,0x18a24a28,0x39463145,0x29043145,0x31653986,0x28e33145,0x39853165,0x39853144,
-0x41415a03,0x28a06a86,0x59e35a04,0x5a0451c2,0x626572c7,0x6a4472e7,0x622351a1,0x38c072a4,0x59e14960,0x59a07284,0x30c06203,0xc5b4c616,0xcdf5c5d4,0x5286ce34,0x8bcc5a05,0x08005a69,0x5a042900,0x62863941,0x72e872e7,0x62446244,0x5a245a03,0x72e76267,0x62656aa6,0x72e96265,0x6ae87b09,0x7b297b4a,0x7aa58b8a,0x6a037a85,0x20004100,0x62846a44,0x396249e1,0x202030e1,
-0x202051e4,0x51624983,0x7aa382c5,0x92e39b05,0x6a018ac3,0x61c25960,0x49205141,0x7aa78b07,0x62025140,0x30a08349,0x30e01800,0x51e45a05,0x41843943,0x398439a4,0x31633163,0x31222922,0x41c43963,0x41844184,0x418449a5,0x20803102,0x20812080,0x10001840,0x10001000,0x528b0800,0x4a4b52ac,0x528c52ac,0x4a8c52ad,0x52ad4a6b,0x528b528b,0x422b4a6b,0x422a422b,0x00000063,
-0x00000000,0x00000000,0x526b41e8,0x4209528b,0x528b39a7,0x4a4a4a49,0x5a674a49,0x52036ac7,0x72a56aa5,0x72a472a4,0x83688b69,0x5a056aa7,0x72c66225,0x728459e2,0x83087ac7,0xac4e7ae7,0x52258bab,0x49c349c3,0x5a045a04,0x6ae86a86,0x838b6287,0x626683c9,0x836e5208,0xc596acb3,0xacd2bd35,0x49e59c50,0x39433964,0x31443163,0x630c3144,0xdedcbdd7,0xde7ade9b,0x6a8c8bd0,
-0xb535a473,0xb536b536,0xa4b4a494,0x9452a494,0x838e8bf0,0x836e9410,0x8c318baf,0x9472ad14,0x736e9472,0x7baf6b4d,0x41c86b4e,0x39c618c2,0x49c64986,0x59e35a06,0x62246a24,0x62056a87,0x49c54963,0x398549e6,0x31452923,0x5aca528a,0x31445289,0x31443985,0x39843165,0x4a2820c2,0x31664a29,0x31453125,0x31653165,0x31653165,0x20c23144,0x39643985,0x31243144,0x39653124,
-0x5a037b6b,0x41615a24,0x8bcb59e3,0x39626266,0x5a6628c0,0x62046266,0x59c26a63,0x72838308,0x6a457286,0x59c27ac7,0x61e37ac7,0x39007b4a,0x20601000,0x392228a0,0x31206265,0x6ac80000,0x30e07328,0x59c22880,0x49a16224,0x72c86265,0x51c26225,0x6aa75a24,0x7b2972e8,0x6ac872e8,0x62876aa7,0x6ae96aa7,0x62446a87,0x41616aa5,0x51c393c9,0x20804922,0x100028e0,0x18601000,
-0x18001000,0x38e02860,0x59c26224,0x93267222,0x7a8482a4,0x6a447ac5,0x410051c2,0x20002000,0x6a6538c2,0x5a438b89,0x49a238e1,0x51c44162,0x520649a5,0x398439a4,0x316339a4,0x31023163,0x41843963,0x41844183,0x49a549c5,0x41844184,0x41634163,0x182030c1,0x10002040,0x4a0a1820,0x5acd528c,0x528c4a6c,0x4a8c4a4b,0x528c528c,0x4a8b52ac,0x422b528c,0x000139ea,0x00000000,
-0x00000000,0x08610000,0x420a39e8,0x42094229,0x528a4a29,0x4a295a8b,0x52894a49,0x62a95a69,0x7b0862a6,0xbd2e6a85,0x8389938a,0x49836a66,0x93ec4183,0x5a2493ec,0x72e77b28,0x93ab7b28,0x6ae88369,0x628649c3,0xac905a05,0x6aa693cc,0x49e35a46,0x49e65206,0x94127b8d,0xb516c5b8,0xa4b4bd57,0x83aea4d4,0x31235207,0x398539a4,0x39a63165,0x6b6f73af,0x9432bdd8,0x8bd17b4f,
-0xbd98c5b8,0xb536bd57,0xacf6acf6,0x8c119c73,0x93f18bb1,0x94329412,0xacf5a494,0x8c109453,0x734d7baf,0x6b0d736e,0x39a62944,0x39843164,0x398462a9,0x51e5732a,0x5a0559e5,0x41c55a46,0x39a54a27,0x31643144,0x41e73143,0x5aca4a28,0x31643186,0x31643144,0x292320e3,0x292539a5,0x29253145,0x738e39c7,0x314583ef,0x31433164,0x39643164,0x290228e1,0x39653964,0x31443144,
-0x418249e3,0x5a0451e3,0x62254980,0x51e351e3,0x52036aa6,0x51e330e0,0x59e15a43,0x414072a6,0x51814960,0x626593ed,0x18204962,0x8bcd49a4,0x10005a06,0x10001000,0x28a03100,0x184049c2,0x41605a44,0x8b8a6245,0x72a62860,0x41204100,0x62876a86,0x62866286,0x6aa672e9,0x7b09836b,0x5a057b09,0x5a665a05,0x49a35a46,0x8bab4162,0x6a624120,0x8b4930a0,0x39825a45,0x08001040,
-0x28800800,0x20404162,0x204059e3,0x8ae57263,0x6a028ae6,0x83263080,0x8b489baa,0x41007aa7,0x20406205,0x62463900,0x49a33900,0x5a2549a3,0x49c44183,0x49a451e5,0x41a43983,0x396441a3,0x39433943,0x39643944,0x49a54184,0x41a449c5,0x39224163,0x418449c5,0x31024184,0x42091860,0x4a6b4a4b,0x52ac52ad,0x4a8c4a6b,0x52cd52cd,0x424a528b,0x5aec422a,0x00000000,0x00000000,
-0x00000000,0x00000000,0x422a3186,0x4a2a526b,0x4a4a4a4a,0x528b4a29,0x526a4a49,0x41e84a49,0x6ae74a06,0x940b6ac7,0x7b6a7328,0x5a255226,0x73075a46,0x6a444981,0x7ac66a85,0x9c0c7b07,0x41827329,0x52066287,0x8bed8bcd,0x628693cc,0x39625a66,0x41a63942,0xa4d56b0c,0xad15ad16,0xa4d4a4f5,0x7b8e9c93,0x39a53144,0x31653965,0x39c63986,0x39c85b0b,0xa494ad77,0xbd779c52,
-0xb536bdb8,0xc5d9bd77,0xad15b577,0x8c118c31,0xacd58bb0,0xad15acf5,0x83d0ad15,0x94519493,0x8c318c31,0x39862925,0x28e241c7,0x41a539a5,0x49e67b8d,0x5a475248,0x5a4849c5,0x4a0749e6,0x31643164,0x39853123,0x39853965,0x39a641c7,0x31454a28,0x4a083145,0x41c73165,0x314562cb,0x94513166,0x31455a8a,0x39653965,0x31233944,0x39643944,0x31433102,0x41a53964,0x41a53123,
-0x41614181,0x208030c0,0x62874182,0x396249c4,0x62865a25,0x62445a24,0x59e24180,0x72a66a64,0x410038e0,0x7b6872c7,0x83885a44,0x49e23120,0x7b2b6aa8,0x7b2abd33,0x73096aa9,0x7b8b49e5,0x28a07309,0x28604141,0x622351c2,0x7b0659e2,0x180030a0,0x72e8836a,0x51e36287,0x51c46267,0x18002880,0x30c01820,0x51c451e3,0x834a6225,0x59e259e3,0x51c35a23,0x51e451c1,0x49c12080,
-0x20603120,0x30a23922,0x30a01800,0x30a093ca,0x41208b68,0xc5517b07,0x416151c2,0x30e06245,0x41216a85,0x49834963,0x6a6649a1,0x51e46225,0x51e551e5,0x522649c5,0x5a466267,0x41844183,0x39643964,0x396441a5,0x418441a5,0x49e641a5,0x41a55206,0x418449a4,0x41843102,0x4a493924,0x528c5acd,0x4a8c52ac,0x4a6c52ac,0x528c4a6b,0x4a6b4a6b,0x000041e8,0x00000000,0x00000000,
-0x10400000,0x31231020,0x42490000,0x528b4209,0x39e85aab,0x4a494a49,0x4a494a49,0x41e74a29,0x62894a08,0x49e741c6,0x41c84a07,0x39864a08,0x62a55205,0x72e86ac7,0x7b29838a,0x93cb838a,0x5a8762a7,0x520749c5,0xb55583cf,0x9470b555,0x3985732b,0x5a6a41c6,0xad167bb0,0xb556c5b8,0xa4f5ad15,0x41e7a4d4,0x398441c6,0x39653965,0x39653124,0x39865249,0xbdb7c5b9,0xbd97b576,
-0xb557b536,0xc5b8b536,0x9473ad15,0x83f19473,0xa4f59cd4,0x94b3ad15,0x8c528431,0x8c11a4f5,0x41c883af,0x39c539a6,0x398541c7,0x736c3985,0x39a541a5,0x418541a5,0x418549e7,0x312349c6,0x396428e2,0x31443984,0x314441c6,0x62ca3986,0x41c75249,0x31456b0c,0x080039a6,0x39a73165,0x31663145,0x8c2f39a5,0x31633143,0x31033943,0x39233123,0x41c54184,0x41853984,0x41a54185,
-0x49c43940,0x41823942,0x41603120,0x5a2349c2,0x51e35a24,0x49c13900,0x41606243,0x62024940,0x20407284,0x62464162,0x208049c3,0x49a34162,0x6a676206,0x390159e5,0x41434123,0x30c24987,0xa4911000,0x7aebe6d9,0x6aa693cc,0x390140a0,0x28a04900,0x49a42860,0x5a4572c9,0x59e45a23,0x51e36a66,0x41623920,0x39204961,0x5a233920,0x104038c0,0x52047286,0x62434981,0x49a151e2,
-0x30e038e0,0x49a42880,0x62665a25,0x62467ae8,0x08008bec,0x208049c4,0x20201000,0x41414985,0x39a3838a,0x41638c0e,0x59c251c3,0x62455a24,0x62466a87,0x5a265205,0x5a055a46,0x41a451e5,0x39843984,0x41a541a5,0x39854a27,0x41c63985,0x41e64a07,0x49e549c4,0x394349c5,0x5acc3103,0x5acc52ac,0x4a8b5acc,0x4a8b4a6b,0x528b52ac,0x4a2a526b,0x002052ab,0x20402020,0x308038e0,
-0x49004120,0x516140c0,0x4a4a0000,0x52ab4a6a,0x4a4a52ab,0x4a2952ab,0x526a4a49,0x39a74a49,0x4a285269,0x41c74a28,0x4a084a28,0x49e74208,0x62a75a68,0x838b6265,0x6ac6834b,0x93ec7b49,0x49c56287,0x41865207,0x945162ec,0x52075aab,0x49e641a5,0x62cb5207,0xad168c11,0xa4d4b597,0x9452b577,0x41848bf0,0x314441c6,0x39243945,0x4a073165,0x49e839a6,0xad15732e,0xa4b4b556,
-0xb557ad16,0xacf5ad15,0x9cb4ad15,0xa4d583f1,0x94b4a515,0x84119473,0x7bb08c52,0x8c519473,0x20e34a08,0x31652924,0x41a63965,0x39644a07,0x398541c6,0x520749e6,0x41e649c6,0x39655248,0x31243144,0x39855aa9,0x39653144,0x632c4a48,0x39865289,0x20e320e3,0x736e41c6,0x524a8c51,0x49e77b8e,0x31233964,0x39633102,0x31234185,0x41844164,0x41a54185,0x41c641a5,0x4a2741a5,
-0x41a36288,0x49c341a3,0x49a23941,0x6ac64161,0x41403920,0x51e272c6,0x7b075a24,0x5a235a03,0x834872a5,0x18203900,0x6aeb20c0,0x940f83ae,0x9cb183ee,0x8bad8bed,0x51c56aa9,0x10004124,0x49e22882,0x20804162,0xacf23963,0x200051e3,0x202038c0,0x41415181,0xb5118ba9,0x5a465a06,0x83ac734a,0x6ac862c9,0x7b0a6aa7,0x30a0cd95,0x726551c3,0x6ac672a7,0x39204980,0x49a151e2,
-0x39206265,0x30a03900,0x202038c1,0x39433102,0x20401000,0x20004103,0x20202060,0x30e32880,0x52473144,0x6aea39a5,0x49a25a25,0x72c86aa7,0x62665a25,0x5a056267,0x62475205,0x5a466246,0x41c549e5,0x316441e6,0x398541a5,0x41a53964,0x41c541c6,0x4a273984,0x39855268,0x528b41e7,0x632e5acd,0x528b52ac,0x528b5b0d,0x52ab52ac,0x528b528b,0x20004a08,0x51607225,0x82c57ac5,
-0x7ac58ae6,0x72848b68,0x10823102,0x42094229,0x42094229,0x4a6a4229,0x526a4a49,0x4a284a29,0x52695acb,0x4a074a07,0x41c741e7,0x522841e7,0x6ac95a47,0x62856265,0x6ac76ae6,0x8bcc8bab,0x49c541a4,0x520841a5,0x31659451,0x418541a7,0x49c749c6,0x83d05a29,0x9cb49432,0xb556a4d5,0xa4d4acf5,0x4185734d,0x31233164,0x39453944,0x41a53944,0x522949c6,0xa4d49453,0xb557b556,
-0xacf5b536,0x9cb49c93,0x8c1183f1,0x9c949493,0x7bd19473,0x738f7bf1,0x7bd07bd0,0x4a4a2105,0x39866b2c,0x62ca41e7,0x5a69734c,0x39646b0b,0x39853985,0x392441a5,0x29033944,0x29232903,0x4a075248,0x29243165,0x41c63144,0x41c741c7,0x29043145,0x31653986,0x41c64a08,0x730b2903,0x31423943,0x41a43142,0x41a43963,0x39643964,0x41a54184,0x41a549c6,0x41c649c5,0x39a549e6,
-0x398241a2,0x51e441c3,0x51e428e0,0x51e36245,0x49a251e2,0x39204140,0x6a8651c3,0x6a856aa5,0x6a8572c6,0x520651e3,0x5aa81880,0x736b6b0a,0x7b2c7b0c,0x8bee83ce,0x93ee940f,0x20606ac7,0x08001800,0x49c351c4,0x18615a66,0xfe77e6f7,0x51827aa8,0x59c34900,0x5a451800,0x414028c0,0x51a34120,0x08006245,0x8b6b5205,0x30e01800,0x934a38c0,0x6ac6ff9c,0x49a149a1,0x49814140,
-0x41423920,0x38a02880,0x38a03080,0x38a04920,0x30a038e0,0x49812000,0x49623900,0x49e551e4,0x4a085aa8,0x52283123,0x520449c4,0x7b0a7ae9,0x7b288369,0x62466267,0x72c86267,0x5a676246,0x52475a88,0x49e641e6,0x41a53985,0x41a541c6,0x39a541c6,0x4a2739c6,0x20c23185,0x52ab630c,0x528b526b,0x4a6b528b,0x4a6b5acc,0x4a6a4a6b,0x4a4a4a4a,0x49424228,0x8b285a02,0x8b698b08,
-0x834a938b,0x83298309,0x082061e5,0x4a6a4229,0x420939e8,0x52ab4a6a,0x41e84a49,0x4a284209,0x41e74a28,0x4a285a89,0x4a285269,0x41c64208,0x5a276288,0x5a465a06,0x52046286,0x5a2572c8,0x41a549c4,0x7b6d5227,0x398639a7,0x4185526a,0x93f05228,0x7baf9411,0x9cb49c73,0xad36a4f5,0x8c11a4d4,0x394349e7,0x31643143,0x39653924,0x5a065206,0x52085a27,0xad159453,0x9c949cb4,
-0xa4d5b536,0x9432a4b4,0x94739432,0x83d183f1,0x4a4a2947,0x5acd31a8,0x18e43167,0x632d4a69,0x7b8d62eb,0x4a285269,0x41c649e7,0x4a073984,0x41a539a5,0x51e73964,0x41a53965,0x522841c6,0x39853144,0x39653124,0x39653965,0x31042904,0x31443945,0x39863986,0x31432903,0x416341a4,0x41823901,0x39623142,0x31223943,0x49c63964,0x520649e6,0x49c549e6,0x734c62a9,0x41c54a07,
-0x29003961,0x49c54183,0x41623941,0x49a23900,0x5a225202,0x62435201,0x49815a02,0x39005a20,0x5a0249a3,0x41644120,0x41643922,0x83ef732b,0x734c7b8d,0x83ad7b8d,0x730b8bae,0x5a47940e,0x392130c0,0x49821800,0x51c36245,0x31406286,0x62436285,0x624238e0,0x38a04100,0x41416a64,0x30e02880,0x284028a0,0x38e04161,0x30a02020,0xfed930c2,0x8bcad5b3,0x49802060,0x49804981,
-0x7ae75a03,0x728582e7,0x7ac78308,0x72c7bd10,0x83298349,0x51c26a65,0x62667b08,0x10006ae8,0x39641000,0x49a53123,0x41a55a68,0x6a666a66,0x72c772a7,0x72e86a66,0x83297ae8,0x6a876aa7,0x52066aa7,0x5a486288,0x41a55227,0x41c541a5,0x41e741e7,0x41c639a6,0x316539a6,0x4a4a4a29,0x5aec5acc,0x5acc52cc,0x528b528b,0x526b52ac,0x4a4a4229,0x6a874208,0x8b698b28,0x8b6a8b8a,
-0x938a8b8a,0x83498349,0x08007b08,0x4a4a4228,0x524a4209,0x4a49526a,0x4a494209,0x5a8a39a6,0x4a075249,0x4a285269,0x52285228,0x4a284a28,0x5a885269,0x49c55a26,0x5a475a26,0x6aa86267,0x49a649c5,0x940f730b,0x49e749c6,0x5a285a69,0x5a8a1041,0x8bf18c10,0x94529432,0x9c93a515,0x83cf8c31,0x52084a08,0x41853944,0x41853944,0x51e651c6,0xa4525a27,0x9cb4a4d4,0x62cc9c73,
-0x83d08c11,0x9c9383d0,0x7b8f8410,0x2925736e,0x4a4a20e4,0x18a38410,0x31862945,0x7bcf4208,0x31866b2c,0x39865249,0x39a641e7,0x52483985,0x18a13164,0x4a273985,0x310230e1,0x28e33123,0x52484a07,0x52485228,0x52282924,0x396541a5,0x52676289,0x39633163,0x396241a3,0x41a441a3,0x39623963,0x31223942,0x4a054184,0x520641a5,0x522749c5,0x734c732b,0x6b0bad13,0x41c53985,
-0x29003941,0x41843983,0x39213121,0x626551e3,0x49613920,0x624451c2,0x62446244,0x72a66a64,0x52046ae6,0x10002040,0x39231800,0x52481861,0x734c7b8d,0x7b8d7b8e,0x838d83ad,0x72ea7b6a,0x30e04981,0x41413901,0x28802880,0x080028c1,0x62657308,0x6a624940,0x9bca51a0,0x59e46a83,0x39004160,0x40e149a2,0x30c08b28,0x30803080,0xf6b7c593,0x8b67d5f3,0x41604980,0x72e672c7,
-0x7b2872e7,0x7b077b07,0x8b698b69,0x8b698b8a,0x8bab8baa,0x7b698baa,0x838b8bcb,0x41a56b09,0x4a264185,0x5a6741e5,0x628a41a5,0x6aa57309,0x7b0872c7,0x7b087b08,0x72c87b09,0x6aa6836a,0x6ac96aa6,0x52266288,0x522649c5,0x41a54a07,0x41c641c6,0x39a539c6,0x52493165,0x4a4a4a49,0x52ac526b,0x630d5aed,0x528b5aac,0x4a4a526b,0x4a2a4a4a,0x62a839e8,0x8b697b08,0x8b498b8a,
-0x8b498349,0x83298329,0x51e4834a,0x42090000,0x5a8b4a2a,0x526a41e8,0x39c74a4a,0x4a085269,0x52495249,0x52694a28,0x4a085a8a,0x4a285248,0x52685248,0x51e649a5,0x5a4851e6,0x51e64164,0x6aca6268,0x41855207,0x520649e6,0x838e6289,0x83ae83ae,0x838e5228,0x83f05208,0x7bd083f1,0x7baf7bd0,0x392428e3,0x39443944,0x62a94185,0x9c514186,0x7b6fb514,0xacf5ad15,0xa4f49c93,
-0x83d083d0,0x94529cb4,0x18a38410,0x41c71862,0x6b4d8c51,0x29453165,0x316639a6,0x39c7736d,0x39c739a6,0x31653145,0x398541e7,0x39243124,0x41c641c6,0x39436b0b,0x41a42880,0x39653963,0x000041a6,0x314428e3,0x20a241c6,0x49e63943,0x31013102,0x31413140,0x39423942,0x39423942,0x41833963,0x41c441c4,0x41a441a4,0x49c641a5,0x6b2c732b,0x83ef6b0b,0x41c639a6,0x41a541a5,
-0x31213963,0x522641c4,0x49c41820,0x51c359e4,0x20204100,0x51e35a04,0x414028a0,0x72e76286,0x7b286224,0x49a35a25,0x49a44162,0x000049e5,0x39440800,0x5a69732c,0x5a476289,0x72e92040,0x286149c4,0x30c11000,0x52041800,0xb5301000,0x28a028a0,0x7b090000,0x83486285,0x51a259e3,0x622459e3,0x6a436223,0x838b4120,0x20403880,0xf6b6de97,0xa42ad5b2,0x59e28bab,0x7b098bcb,
-0x72a672e7,0x93aa9c0c,0x9bcb93aa,0x8b8a8baa,0x93cb8b8a,0x834993cb,0x7b497b28,0x20a041c4,0x396241a4,0x49e43141,0x626851e6,0x72e86ac9,0x83497ae8,0x72e67b28,0x832972c7,0x72867b08,0x6ac872a7,0x73095a87,0x6aca5a47,0x49c549c5,0x41a549e6,0x316441c6,0x4a493144,0x528b4a29,0x62ed528b,0x5acc528c,0x528b5acc,0x4a4a4a6a,0x41e84a29,0x41c73186,0x8b8972e8,0x8b6a8b49,
-0x836993ab,0x83498349,0x6a667b08,0x426a0820,0x41c8526a,0x52694a08,0x524941e8,0x5a8a5aab,0x4a2862cb,0x52695268,0x62aa5a69,0x49e741c7,0x49e749e7,0x394449e7,0x49c65207,0x49a449c5,0x8c105a88,0x5aa98c0f,0x5a4749c5,0x6aea7b4d,0x51e66289,0x5a4951e5,0x8bf19411,0x738e8411,0x8c307baf,0x41a56b0b,0x520649c5,0x41c741e6,0xacf5ad14,0xb557b557,0x8c32ad15,0x8c3283f1,
-0x94738c32,0x4a2a9c93,0x28e33965,0x49e73986,0x20c32904,0x41e73986,0x41e741c7,0x29445a8a,0x31852103,0x31242924,0x39669430,0x29033985,0x28c13944,0x31011020,0x626728a0,0x184028a1,0x310220a0,0x31643964,0x41a649e7,0x396241a4,0x39623100,0x41844183,0x39633963,0x418341a5,0x39833943,0x49e65206,0x49e649c5,0x4a064a06,0x41c541c5,0x39843984,0x31433964,0x31643964,
-0x18403943,0x396328e0,0x310028a0,0x83096245,0x62254100,0x62255a05,0x30c02040,0x28c04141,0x28c120c0,0x41425205,0x41215a06,0x31224142,0x39423942,0x2902cdf6,0x52055206,0x6a8830c1,0x7b6951c4,0x10005a64,0x100038a1,0x38e030c0,0x31027b6a,0x100041a5,0x20405a25,0x41012840,0x6a4451a1,0x59c37ac5,0x9c2d6203,0x10003080,0xd5b29c6f,0xc52ff695,0x494093ec,0x7b098bcb,
-0x72e772c6,0x93aa8369,0x8b698b69,0x93ca8baa,0x83698baa,0x8b8a838a,0x83aa8369,0x49a449e4,0x416351e5,0x41a249c4,0x52065205,0x730a6267,0x73096ac8,0x62847ae7,0x72e87b08,0x8b6a8349,0x83298349,0x62c87308,0x62896ac9,0x5a686288,0x41e65a89,0x398541e6,0x524a5289,0x52ac526b,0x528c528b,0x528b5aac,0x528b4a6a,0x4a4a4a6a,0x524a4a4a,0x4a294a28,0x834a5ac9,0x8b6a8b6b,
-0x83498b6a,0x83498349,0x72e87ae8,0x39a73123,0x39c64207,0x524941e8,0x526a5249,0x4a085249,0x52695a6a,0x5aa95269,0x5a695a69,0x52285249,0x4a275a69,0x52275a68,0x5a475a28,0x52065206,0x7b8e5a68,0x62c9734c,0x8bcd5206,0x49c57b0b,0x5a4851c5,0x8bcf940f,0x8c319c52,0x5aab8c52,0x736d5acb,0x49a541c6,0x41a541a5,0x41a641c5,0x83d18c31,0x9cb4a4b5,0x94739432,0x94529452,
-0x94739c93,0x20c29452,0x39a53164,0x83ad20e2,0x31443985,0x4a073985,0x29244a07,0x39844a08,0x31233164,0x31232081,0x29035227,0x31643985,0x31034184,0x39212081,0x310120a0,0x31434163,0x398520c2,0x52475a89,0x39644165,0x39423963,0x39833942,0x41843963,0x522749e6,0x52275207,0x49e65206,0x49e65227,0x49c549a5,0x398441e5,0x41c53964,0x41c541c5,0x398449e6,0x316441a5,
-0x18202060,0x10001000,0x496238e0,0x496259e4,0x39023900,0x72c74140,0x416230c0,0x28c03924,0x31231840,0x39411860,0x10002080,0x310030e0,0x41624162,0x5a0528a0,0x28e10800,0x00001040,0x72e730c0,0x49625a05,0x51826204,0x30c059c3,0x18a01000,0x6aa751e5,0x38e12860,0x49824162,0x28601800,0x59c16221,0x83276a44,0x41007285,0xbd7228a0,0xcd70d5b1,0x51a0940b,0x7b287b27,
-0x7b288bab,0x9c0c8348,0x8b898baa,0x83488369,0x93ca8baa,0x72c68369,0x626672c8,0x520451c4,0x62866266,0x5a055a04,0x5a055205,0x5a665a46,0x734c41a4,0x7b297b2a,0x836a93ab,0x8b497b29,0x8baa9bec,0x6ae97309,0x62686ac9,0x6ac95a67,0x41e65a68,0x526941e6,0x5aab5aaa,0x5aab526b,0x5aab5acc,0x528b528b,0x52ab4a6a,0x4a6a526a,0x4a49524a,0x42084208,0x7b0939e8,0x93cb9c2c,
-0x834a8349,0x7b097b09,0x72c88329,0x000049c3,0x39c739c7,0x52494a29,0x524941e8,0x52695249,0x5a695aaa,0x52485a69,0x6aeb62aa,0x4a075268,0x5a4841a6,0x628941a5,0x51e65207,0x49e772ea,0x5a8941c6,0x41845228,0x51c54984,0x730a5a26,0x7b6d49c5,0x9c928bf1,0x7baf9c51,0x4a2841e8,0x49c63965,0x41a549c6,0x416441a4,0x394541a5,0x9c933967,0xa4d5a4f5,0x9cb49cb4,0xad15a4d4,
-0x9472a4f5,0x4164738e,0x6b2a41c5,0x6b0b734c,0x41856288,0x41c63123,0x4a075aa9,0x30e12922,0x30e128c1,0x49c549c5,0x52272922,0x396441a5,0x394351e7,0x20c030e0,0x39843942,0x31443984,0x41c63164,0x39a53123,0x524841e6,0x41c53984,0x398441c5,0x49e65247,0x41a541e6,0x418441a5,0x49e64184,0x41e641c5,0x41a441a4,0x41a441a4,0x39845206,0x39643984,0x418441c5,0x41854184,
-0x18202860,0x730928a0,0x28604962,0x5a044962,0x5a2551c3,0x39201820,0x10004120,0x10000800,0x10001020,0x28a01821,0x838c28c2,0x18404184,0x30e12060,0x28a028c0,0x41a430e1,0x08001000,0x28800800,0x390130c0,0x6a456a86,0x41427ac7,0x20402860,0x51e449a4,0x288038e0,0x28a02880,0x180038e3,0x41213922,0xa46d38e0,0x390072a6,0x204038c0,0xc5f23964,0x6a24acd0,0x72c793ec,
-0x83697b08,0x83488348,0x8b8a8369,0x7b288369,0x83288baa,0x7b288349,0x41627b29,0x51e451e4,0x62665204,0x52055a45,0x51c46287,0x41a35a46,0x418349e5,0x49c449c3,0x418349c4,0x8b8b838b,0x83288bab,0x73297b29,0x51e67329,0x5a675206,0x41a55248,0x528a41e7,0x4a2a62cc,0x526a526a,0x528b4a6a,0x52ab4a6a,0x5acc528b,0x526a52ab,0x42084a4a,0x42084208,0x62aa52ab,0x7ae87b29,
-0x834a8349,0x8349834a,0x7b097b09,0x186172c8,0x4a4941e7,0x52494a08,0x524939a7,0x4a284a28,0x5a694a28,0x52285248,0x5a895a69,0x49c649e7,0x49c641a5,0x62a949a6,0x5a495a68,0x52485228,0x52695228,0x41443124,0x52074184,0x59e672c9,0x7b8e732c,0x94718c31,0x398583f0,0x398539a6,0x49a54186,0x4164836c,0x49c53963,0x30e44185,0xacf5b557,0xa4d4ad16,0x9c939473,0xa4f59cb4,
-0x7bd09472,0x20c020c2,0x41e520e1,0x62a94a06,0x41a45206,0x39633943,0x41823963,0x28c02900,0x41a33962,0x28e028c1,0x39433101,0x28a128c1,0x30e12080,0x394328c1,0x39644184,0x31443985,0x31642903,0x314439a5,0x41c639a5,0x4a0641e6,0x41e641e6,0x39a449e6,0x49e63143,0x49c641a5,0x41a549c5,0x4a0649e6,0x396341a4,0x49e54184,0x39a449c5,0x39643164,0x418449e6,0x39644185,
-0x59e349c3,0x496238e0,0x49614942,0x51a42861,0x390059e3,0x414151c2,0x416149a4,0x28a04160,0x30c12880,0x39632020,0x41226ae9,0x31223101,0x10002880,0x28a13901,0x20a01000,0x49824962,0x18004100,0x41224983,0x626828c1,0x28a028a0,0x51c23900,0x498249a2,0x414151e4,0x51c31000,0x49a24940,0x20a07309,0x39204120,0x390049a2,0x62444962,0x30a030a0,0x6a44ac6b,0x7b087ac6,
-0x72e78349,0x7b288369,0x72c68369,0x83688348,0x5a4372c6,0x8baa7308,0x5a048b6a,0x51c351e4,0x520449a1,0x52045a05,0x51c45204,0x52045a25,0x52045204,0x6ae949e4,0x5a055205,0x51e551e5,0x73095a26,0x6ac8836b,0x6ae96ae9,0x62885a47,0x5a696aea,0x528b5aab,0x528b526a,0x4a294a29,0x4a6a526a,0x526a4a6a,0x52ab528b,0x4a4a4a4a,0x528b4208,0x42294a49,0x52aa39e8,0x832b732b,
-0x834a834a,0x832a832a,0x83297b09,0x28a26ac8,0x522941e7,0x52295a6a,0x52285228,0x41e74a07,0x39654a08,0x62aa4a07,0x8bef62aa,0x2060732b,0x31240800,0x6b2c83ce,0x5a697b8e,0x5acb1061,0x7bcf7bae,0x84107bcf,0x8c317bd0,0x841183f0,0x8c528c31,0x0821736e,0x41a53985,0x41853963,0x520651e6,0x49845a27,0x41445206,0xbd764185,0x9432a4d4,0x94328c32,0x9c539452,0x1862a4b3,
-0x20e21861,0x39443964,0x52065a47,0x310249c5,0x28c03963,0x29003920,0x28c028e0,0x41623100,0x30e03100,0x28a05a25,0x28c12060,0x29232903,0x31033964,0x31443923,0x318541a6,0x31652923,0x31443144,0x39a53984,0x398439a5,0x41a541a5,0x49e639a5,0x41c541a5,0x49e65247,0x4a2741c6,0x41a53964,0x41e63984,0x41844164,0x396449c5,0x41833964,0x49a549e5,0x41a530e2,0x49e63985,
-0x51c34982,0x49623900,0x39003900,0x38e04121,0x51a359e3,0x62465a04,0x5a459c0d,0x51a51000,0x28a06a86,0x28a04981,0x28a13942,0xffff41a5,0x72c762e9,0x39422880,0x39404181,0x72866a66,0x30a04982,0x28603901,0x20601000,0x49831000,0x62472020,0x28604141,0x30a02001,0x28a02880,0x41213080,0x08005205,0x41414121,0x498249a2,0x834a5a03,0x41406204,0x83076222,0x832882e7,
-0x83488328,0x7b087b08,0x72e78b89,0x72e77b28,0x72e78b89,0x7b288baa,0x498272c7,0x5a266a87,0x7b09a42e,0x51e45204,0x51e46286,0x49a35a25,0x5a453941,0x31015a25,0x418351e4,0x520549a4,0x49e449a3,0x52275205,0x6aea62a9,0x5a6862ca,0x52495a89,0x528a5aab,0x524a5acc,0x528a526a,0x4a6a526a,0x526a526b,0x528b528b,0x4a6a528b,0x4a294a29,0x4a6a4229,0x4a284208,0x836a41c6,
-0x836983aa,0x7b497b49,0x73297b49,0x4a067309,0x526a5249,0x52284a08,0x52284a27,0x41e741e6,0x5a695249,0x52695a69,0x39455a49,0x6aca5248,0x94508c0f,0x94518c30,0x080083ce,0x29454a28,0x8c512924,0x7bcf7baf,0x7bcf7baf,0x7bd07bd0,0x736f7b8f,0x7b8e8c11,0x4a064185,0x41644184,0x8bcd5a06,0x62066227,0x628a51c6,0xa4b39c30,0x94528c11,0x9c739c93,0xa4b49c73,0x3145a4b3,
-0x39844a07,0x20a141a5,0x41a441a4,0x49c55226,0x5a255206,0x39204120,0x5a2528e0,0x51e549a4,0x28a03901,0x28a028a0,0x5a4841a4,0x396449e7,0x39853985,0x39853144,0x31653124,0x31653164,0x41e73144,0x420739a5,0x7bad62ea,0x5a896b0b,0x62a962ea,0x398449e6,0x4a0741a5,0x4a073144,0x41e64a07,0x41c539a5,0x41855207,0x41a54185,0x418441a5,0x5a883964,0x734c732b,0x83ce732b,
-0x49634961,0x41415183,0x38e251a2,0x728a59c4,0x38e051a3,0x62263901,0xacb06246,0x6a858347,0x5a0630c0,0x41213902,0x59834121,0x39004962,0x28a02880,0x41613901,0x41202000,0x59e44982,0x30c04121,0x390030a0,0x20403121,0x10001800,0x39206245,0x6aa84122,0x39006a85,0x9c2c49c0,0x51c561e5,0x182030e2,0x41422860,0x49622880,0x51c251a4,0x49a051c2,0x620359e1,0x8b698b49,
-0x7b288b69,0x83487b07,0x72e78349,0x83488348,0x93ac7b28,0x72e88369,0x72c84983,0x49818349,0x72e83921,0x310072c8,0x51e45a05,0x52045a45,0x6ac75a25,0x624559e3,0x7b296267,0x49c25205,0x41e551e3,0x5aaa4a06,0x6b0c7b8e,0x41c862ec,0x4a4a5aeb,0x5acb528a,0x5aab6b2d,0x524a4209,0x4a6a526a,0x4a6a52ab,0x526a4a6a,0x528b528b,0x526a4a49,0x4a494a49,0x4a29528a,0x52494a4a,
-0x62ca6b0b,0x4a075a89,0x4a29524a,0x524941a8,0x52695249,0x4a065248,0x52285247,0x8c105a69,0x8c0f9450,0x5a89732c,0x5a69626a,0x7bef83ae,0x08417baf,0x20e30000,0x20a241e7,0x00000000,0x00000000,0x08200821,0x62ec1062,0x7baf7b8f,0x736e736e,0x83ef8411,0x732b9450,0x49836288,0x51c56226,0x51646a48,0x9c929baf,0x9412a492,0x9cb483f1,0x9cb4acf5,0xa4d39c93,0x41a73124,
-0x4a0641c6,0x416449c5,0x49c541c4,0x39833963,0x39423963,0x59e44981,0x5a044141,0x520572ca,0x5a063902,0x49834142,0x41a749e7,0x398649e7,0x3986734d,0x39653986,0x31653965,0x39a539a5,0x316439a6,0x52694a28,0x41c741e7,0x312341a5,0x41a520e2,0x4a063985,0x41a549e6,0x41c54a07,0x39854a27,0x41a539a5,0x41a541a5,0x6aea49c6,0x62895a68,0x7bae730b,0x8bcf736d,0x734d83cf,
-0x5a255204,0x18203921,0x414130c0,0x182030a0,0x59e359c3,0x41214961,0x49a128a0,0x62264142,0x49616225,0x41205182,0x39024121,0x49e57309,0x414230e0,0x49a23920,0x20401800,0x18001000,0x51c438e1,0x20402060,0x39211000,0x288030c1,0x62245a04,0x51a25982,0x51c44982,0xa4af6aa8,0x49614161,0x30c151e4,0x62253901,0x30c04982,0x6a666266,0x5a026267,0x7b077284,0x93aa8b49,
-0x8328938a,0x83498328,0x7b078328,0x6a858348,0x838a8369,0x49c38b8b,0x7ae851a3,0x622551c5,0x51c36225,0x51c26285,0x5a256245,0x5a0551e4,0x6a666245,0x6aa75a25,0x59e44983,0x414251c4,0x20404141,0x524828c0,0x6b6e62ca,0x738e5a8b,0x5acb630c,0x62ec528a,0x62cc5aab,0x526a5aab,0x526a526a,0x4a49526a,0x528a4a6a,0x524a526a,0x526a526a,0x4a6a4208,0x4a6a4a6a,0x4a294a6a,
-0x4a494a49,0x528a528a,0x6b2c526a,0x52495aeb,0x4a085269,0x4a075207,0x4a085207,0x52295228,0x62eb5a6a,0x62eb734c,0x736d9450,0x08410000,0x6b0b0000,0x394328c1,0x390241a4,0x28c24164,0x62eb4a29,0x83ef7b8e,0x736d7b6d,0x526a5aab,0x316539c7,0x522820c3,0x7b8c4a07,0x83498bee,0x72478349,0xb4b2b490,0xacf59c31,0x9411a4d4,0x8c1183d0,0x7bb07b8f,0x9c93b556,0x41858bef,
-0x41853964,0x41854185,0x41855207,0x41845206,0x49c449c5,0x49a23940,0x416351c4,0x5207cd95,0x5a4749c5,0x41c65206,0x7b8e62ec,0x94719472,0x52282904,0x31653986,0x41e639a6,0x41c63985,0x41c639c6,0x39a65248,0x41e63144,0x398539a5,0x41a53985,0x41c541c6,0x49e64a27,0x41a541c6,0x41a53985,0x49c63964,0x8bef5248,0x52273984,0xc5d65268,0x62aa5269,0x732c732c,0x62aa5a69,
-0x52044161,0x59e54182,0x41424141,0x5a2430e0,0x41214962,0x51a359c4,0x41404160,0x49a249e2,0x5a0461e4,0x51a251a2,0x38c059c4,0x18606246,0x41412880,0x30e03900,0x30c04162,0x28602040,0x59e438e0,0x51624983,0x20602880,0x62473100,0x6a466225,0x38e040a0,0x28601820,0x390051c2,0x288059c3,0x730930e0,0x41a43942,0x52055a67,0x522649e5,0x7b295225,0x8baa7307,0x7b698b8a,
-0x83cc7328,0x7b8a7329,0x734983cb,0x49c36ac7,0x51e42060,0x62656aa6,0x8b8a93eb,0x6a6651a4,0x938b6a86,0x5a0349c4,0x5a256225,0x5a0559e4,0x51e45a05,0x5a255a45,0x5a055a04,0x5a035a25,0x49a26a85,0x20602080,0x18a21000,0x526a62ec,0x5acc5a8b,0x5aab5aab,0x526a5aab,0x526a5acb,0x528a524a,0x528a528a,0x526a4a6a,0x528b5aab,0x526a5aab,0x528a52ab,0x4a6a52ab,0x4a084a6a,
-0x528a528a,0x5acb5269,0x52694a28,0x4a284a49,0x62cb5249,0x7bae62eb,0x5a8a83cf,0x4a295228,0x736d5aaa,0x4a2883cf,0x10415a89,0x000062ca,0x00000000,0x394128a0,0x51c449c3,0x20804983,0x20a01860,0x31423122,0x394341a4,0x20803902,0x28c01840,0x316328c0,0x41c53964,0x8b8d4a26,0x72a99c2f,0x9430a471,0x9c73a492,0x8bd0a4b3,0x8c10732d,0xa4d46b0c,0xb535a4d4,0x41a44186,
-0x39633983,0x52065206,0x41855227,0x7b6c83ad,0x31013942,0x736c5206,0x83eea4b3,0x94307baf,0x83ae7b6d,0x5269732c,0x4a084a29,0x41c75249,0x312441c7,0x4a0741a6,0x29233165,0x398520e3,0x41e63985,0x39c641e6,0x41e741e6,0x4a274a07,0x41c65248,0x41a54a07,0x41a541a5,0x49e65227,0x39853985,0x41853123,0x41c65a89,0x9c929451,0x5a69ad14,0x4a285a89,0x736d6b2b,0x6b4da4f3,
-0x28a051e4,0x416151c3,0x5a0551a3,0x204030c0,0x498230a0,0x49424141,0x28802860,0x51a259c3,0x626559e3,0x30a051c2,0x30c051c3,0x51a34142,0x41834142,0x6a8472c7,0x412159e2,0x38e14983,0x286059e4,0x390049a3,0x498338c0,0x41424122,0x51e44983,0x51c36a87,0x49826246,0x41427b28,0x28c01000,0x5a2641a2,0x52275205,0x52066289,0x52675227,0x52275a88,0x734a736c,0x6b09734a,
-0x4a275227,0x41e641e6,0x39c53144,0x41843984,0x72e751c3,0x9c2f3100,0x62036a65,0x7b296a44,0x5a235a03,0x62446225,0x5a245a24,0x59e459e4,0x62665a46,0x624559e4,0x5a055a25,0x51c26aa7,0x30e03920,0x208020a0,0x100028a0,0x5a891020,0x5acc5a49,0x62cb526a,0x526a5a8a,0x526a5a8a,0x526a41e7,0x62ec5aab,0x5aab5aab,0x528a5acb,0x528b5aab,0x4a495aab,0x62cc524a,0x526a5aab,
-0x41c839a6,0x41e839a7,0x526a5249,0x41e75269,0x52294a08,0x39666acc,0x5a6a9431,0x94727b6e,0x7baf8c31,0x52485a89,0x39a64207,0x08003162,0x41840000,0x6aa76246,0x30e049a2,0x520451c3,0x418251c4,0x41623941,0x416151c4,0x49a251e3,0x414249a3,0x180028a0,0x49e628c1,0x7b6d3985,0x9c2f5208,0x93ef7b2c,0xce187b2c,0xb535cdf9,0x7b6e5a6a,0xbdd8bd55,0x41868430,0x49c541a6,
-0x418441a4,0x522749e6,0x39845247,0x39a53164,0x4a2841e7,0x5aaa41c6,0xad355269,0x732c734d,0x18206aca,0x420749e8,0x39863165,0x52494a08,0x6b0c4a08,0x41e75228,0x39853986,0x314441a6,0x398539a6,0x4a0749e7,0x62eb5aea,0x522862aa,0x49e641e7,0x39a549c5,0x732c5228,0x49a65228,0x524849c6,0x6b0b41a5,0x7b4e3104,0xb5759471,0x5a8962cb,0x41c65269,0x734c62eb,0x31443164,
-0x41414983,0x49813921,0x20403901,0x39012880,0x49a24983,0x51a34141,0x5a044960,0x49414141,0x51c34120,0x62245a03,0x39006224,0x51c430e0,0x49c349c3,0x93cb5a24,0x38e07ae7,0x30803080,0x20602840,0x200030c0,0x416251a3,0x49a451e4,0x288028a0,0x180028a0,0x30e11820,0x49a249c4,0x49a37b08,0x4a0649e5,0x522749e6,0x49e649c6,0x4a274a06,0x4a275227,0x52274a07,0x4a264a06,
-0x41e649e7,0x41c641c6,0x41e639c5,0x396341a5,0x626572c8,0x5a0293ca,0x622572e7,0x6a866225,0x62646265,0x72c76266,0x5a045a24,0x5a256245,0x5a445a24,0x59e459e4,0x5a455a05,0x59e472e8,0x51c14161,0x20804142,0x208128a0,0x18401820,0x528a5a89,0x524962cb,0x5aab5a8a,0x4a495269,0x524a5aaa,0x528b528b,0x5a8b528a,0x5acb4a6a,0x5aab5aab,0x41e8528a,0x528a4a09,0x528a4a49,
-0x4a084208,0x52494a28,0x52695aa9,0x52495a8a,0x4a085249,0x4a085a8a,0x8c107b8e,0x39853966,0x6acb5228,0x49e683ad,0x29223164,0x524628c1,0x5a652060,0x51e451e4,0x626651e3,0x62656225,0x51e46287,0x5a256266,0x6a856225,0x6a866a86,0x51e46246,0x520551e4,0x41c641c5,0x526941c6,0x8bf05aa9,0x94318bf0,0xbdf8b557,0x5a8a83b0,0x9cd39492,0x49e86b4d,0x41a53124,0x39623942,
-0x418341a3,0x39643964,0x41c63164,0x41a66aeb,0x41e739a6,0x528a39a6,0x4a085269,0x62ab5a8a,0x7b6e9451,0x528983ef,0x316641c7,0x4a2841c7,0x39653986,0x39c641a6,0x31654a28,0x31443965,0x6aeb41a6,0x41a67b6d,0x52489430,0x8bee28c2,0x30e13923,0x62a930e1,0x100083cf,0x00000800,0x200041c6,0x52495a69,0x8c316b4c,0x83cfa4d3,0x62ca8c10,0x5a694a07,0x41c65228,0x526841e7,
-0x28a051e4,0x51c572e9,0x51e63942,0x41424143,0x49814162,0x5a0551c3,0x51c36a67,0x51a14960,0x51a14961,0x5a2459e3,0x41606225,0x288049a2,0x62863961,0x52056ac8,0x20600800,0x38e02060,0x38e030e0,0x416238c0,0x312251e5,0x18401020,0x39021000,0x392130c0,0x394230c0,0x39201880,0x52275a05,0x52275a27,0x524841e6,0x49e641e6,0x4a275248,0x4a0749e6,0x52274a07,0x4a0749e6,
-0x4a274206,0x41c541c6,0x31a639c6,0x522741c5,0x9c0b4140,0x62047ac6,0x8b6b6a68,0x83696aa6,0x5a446ac8,0x73296285,0x51a15a44,0x392051a2,0x28a03901,0x49c16265,0x622451c3,0x62046264,0x5a236a84,0x30e13920,0x18002060,0x18201820,0x52691860,0x5aaa5aaa,0x4a485249,0x524862cb,0x5a8a5249,0x5acb5a8a,0x528a528a,0x528a4209,0x5a6a5a8a,0x526a5acb,0x5a8a5aab,0x49e85249,
-0x528a49e8,0x52695269,0x62aa4a28,0x5a8a62aa,0x8bf062ab,0x49c78bcf,0x8c1049c7,0x49c7734d,0x6aa75a47,0x7b8b7b6a,0x31014183,0x41812080,0x59e451a3,0x62465a25,0x6aa76a88,0x5a246a87,0x5a246266,0x51e36245,0x62256245,0x5a246aa6,0x49836204,0x418449c4,0x29034185,0x39653164,0x290549e8,0x6aed5229,0x4188626b,0xad34732d,0x39a69cb2,0x49e639c6,0x41233943,0x41824142,
-0x49c44183,0x39854a06,0x39855a69,0x39a641c6,0x5a8a5249,0x41e85aaa,0x4a0839a6,0x7bcf6b0b,0xa514ad34,0x39a68c10,0x39863165,0x41c74a08,0x41a641c7,0x5aaa49e7,0x41c741e7,0x49e75248,0x39445207,0x5a4928e3,0x39424144,0x62684163,0x520649e6,0x208128a0,0x5a6928c2,0x83cf8bef,0x62aa6aeb,0x83cf736d,0x738e840f,0x734d18e3,0x52485208,0x522862ca,0x524841a6,0x314441a6,
-0x392030c0,0x208051e4,0x10002881,0x28401000,0x41204162,0x5a2530e0,0x8b6a51a2,0x83486a86,0x6a868328,0x5a254141,0x5a456245,0x62476266,0x10005206,0x5a266287,0x59c349a2,0x49834162,0x39004983,0x496230a0,0x182030c1,0x31012060,0x39214142,0x39212080,0x39623901,0x838b9c8f,0x5a4762a7,0x49e65a47,0x41e64a07,0x41e65248,0x52484a27,0x4a274a07,0x39a541e6,0x4a064a27,
-0x316441e6,0x39a541c6,0x5a2641a4,0x39003921,0x8b276a02,0x6a638b46,0x498249a2,0x72e94962,0x520372e7,0x49c349a2,0x6a8551e3,0x62455a24,0x49a393ec,0x5a246aa7,0x49823921,0x5a0251c2,0x390059e2,0x49c46224,0x18002060,0x39021800,0x18402040,0x62ea6b0b,0x62eb62ea,0x52696b0c,0x52695aaa,0x4a285aaa,0x5a895248,0x4a2862cb,0x4a285a89,0x4a0862ca,0x94517b8d,0x39854a28,
-0x39854a07,0x5a485227,0x52284a07,0x62aa62cb,0x9c72732d,0x8bef93ef,0x8c108bce,0x416583cf,0x83696287,0x52276ac8,0x31011000,0x30e04161,0x416149a1,0x62855a24,0x5a245222,0x62445a04,0x39001820,0x5a043900,0x6a865a04,0x6a855a04,0x49c45a24,0x31223962,0x29233944,0x39653144,0x41a76aab,0x62ab5a8b,0xb536acd4,0x39869c51,0x39c639a7,0x398439c5,0x396230e1,0x49e53942,
-0x5a896aea,0x5a695a69,0x398541a6,0x39c63985,0x4a285269,0x62cb41e7,0x5a8a5aab,0x7bce736d,0x20e3a513,0x31653165,0x52693986,0x522862aa,0x52495a8a,0x734d5249,0x31445a89,0x39234a06,0x080072ea,0x392128c0,0x20603101,0x8c0f7b2b,0x9431a4d2,0x5a8a8c10,0x8c10a492,0x8bef8c30,0x83ae9c92,0x31655aaa,0x39c63165,0x62aa39e7,0x4a074a08,0x4a0741c6,0x314449e7,0x39852903,
-0x30e049a2,0x41802080,0x10002020,0x28601800,0x392051c3,0x18004981,0x626651c2,0x620459c4,0x6a8738e0,0x6a8659e4,0x51e24961,0x62655a24,0x5a6549e3,0x30c01840,0x72e95a87,0x62456246,0x51c459e4,0x49604120,0x41214980,0x49624962,0x20405a24,0x28a049a3,0x418330c0,0x28c23962,0x52063142,0x4a075206,0x4a074a07,0x52484a07,0x4a0741c6,0x49e65227,0x41c649e6,0x5ac949e6,
-0x39a53985,0x31a541c6,0x72a63942,0x6a258b49,0x7b078baa,0x7ac78b28,0x49815a43,0x39417ae8,0x83694985,0x52045a44,0x72e64181,0x6aa76265,0x41624142,0x62654183,0x41416a86,0x498049a1,0x6a865a03,0x41615a04,0x30c03101,0x18202060,0x18401800,0x29231040,0x41e70820,0x52495aaa,0x52485aaa,0x6aeb5a89,0x5a8962aa,0x5a89734c,0x5aa962ea,0x5a895a69,0x52495207,0x49e64a08,
-0x41a541e6,0x52074185,0x5a895a69,0x6b0c62aa,0x5a8a9c72,0xa4b19c70,0x8c10940f,0x6a6883ae,0x93ea4983,0x28e36287,0x49e449c5,0x28a03940,0x62655201,0x2060a450,0x5a0349c2,0x30c04140,0x62445a05,0x5a245a03,0x6a666245,0x6aa66244,0x39826265,0x28e128e0,0x524841a5,0x730b4a07,0xb535b514,0x0801acd4,0xad368c31,0x3166acd4,0x31653186,0x41852944,0x4a0649a4,0x840f730b,
-0x39c78c10,0x49e741a7,0x39853965,0x41c641c6,0x4a283986,0x734d5269,0x94516b2d,0x31855aca,0x9491a513,0x41c74a48,0x39a639a6,0x52285249,0x39864a08,0x29243986,0x310341e7,0x41433943,0x416338e1,0x51e64143,0x08001840,0x8c0f732b,0xa4f28c31,0x3166ad13,0x8c509cd3,0x41c78c50,0x6aeb3145,0x39c641c7,0x4a4939a6,0x7bae6b4d,0x524841c7,0x49e78c0f,0x39853965,0x39653144,
-0x49e47328,0x41835224,0x39425205,0x30e12061,0x49e449c4,0x30e04161,0x6ac73922,0x6a865a04,0x59e36245,0x41404960,0x418249a2,0x49a249a2,0x51c351c3,0x28806267,0x392130e0,0x5a2551e4,0x39213921,0x51e45a05,0x41216266,0x5a047b29,0x41634182,0x31015a05,0x31021000,0x08001000,0x10002080,0x522749c5,0x52066288,0x5a685a48,0x51e75207,0x52484a07,0x4a074a07,0x49c55227,
-0x414349e6,0x498451c4,0x93ac93ac,0x8baa93ab,0x93ca9bcb,0x9c0c9bcb,0x9c2e93ed,0x62668bab,0x836b51c3,0x51e35a26,0x6a854981,0x51e372a6,0x628651e3,0x28a049a2,0x49c351e3,0x418272e9,0x498151e4,0x41421820,0x28a049c4,0x414330c0,0x39213102,0x08000800,0x10200000,0x52481000,0x4a0762ea,0x52484a07,0x62aa5248,0x6b0b5aaa,0x62aa62ca,0x51e78bef,0x9cb272eb,0x8c308c50,
-0x62475a68,0x6a897b2a,0x62ca62a9,0x62c95a69,0x5a475a69,0x62675a47,0x7b2c730a,0x62aa9cb2,0x49c55a47,0x52064184,0x626749e5,0x5a243900,0x6aa76a65,0x41618bab,0x100072e7,0x624551a3,0x5a046245,0x6a656a65,0x7b086aa6,0x5a256aa7,0x520549e5,0x41843942,0x52275207,0x9c325a4a,0xbd77c598,0xacf59c73,0x83d0a4f5,0x396562ec,0x39c641c6,0x52473185,0xb53383ce,0x41a62903,
-0x41a641e7,0x39854a07,0x4a073965,0x42074a07,0x41e841e8,0x5249734d,0x41e639c6,0x29655a89,0x20a120e3,0x31443985,0x9cb239a6,0x732c8bf0,0x28c23964,0x41853964,0x31443943,0x943041c6,0xa4d29c71,0xad337b8d,0x94719471,0x9c919471,0x20c28c0f,0x41c75227,0x39a66b2c,0x734c5249,0x41c63985,0x29033144,0x5aaa62cb,0x6b2d5aab,0x39a63986,0x41c641c6,0x398541c6,0x41a549e6,
-0x49e33962,0x41a35a47,0x30c06ac8,0x10401000,0x31413142,0x39214182,0x18401860,0x626649a3,0x41405a45,0x49626a45,0x52044182,0x51c35204,0x5a256246,0x49c36266,0x418230e0,0x41823100,0x30c04983,0x412249a3,0x49a34162,0x51c47b29,0x41623920,0x10005a46,0x30e12080,0x49a251e5,0x41432060,0x28c13901,0x62895a47,0x6ac96aa9,0x52275a47,0x52485227,0x49e64a27,0x520749e6,
-0x622649c5,0x62654100,0xa44d6a86,0xd5d34161,0x8bab0800,0x93ecbd11,0x1000a44e,0x72c76266,0x6ac7a42d,0x62456aa6,0x20605a24,0xb4d04142,0x41614182,0x204030e0,0x18402080,0x49a430e2,0x51c43921,0x49a441c4,0x28802060,0x49a42060,0x62673121,0x00000820,0x10200820,0x18401820,0x49e628e2,0x52685a89,0x5a895248,0x62ca62aa,0x6b0b5a69,0x62aa6289,0x83ef9c51,0x52685248,
-0x8b6a6aca,0xb4cdc56c,0x62ca8bee,0x4a276aeb,0x5a875a47,0x62675206,0x62486288,0x8bf08bae,0x52685a89,0x31444a27,0x51e55226,0x51e34161,0x6a865a03,0x5a255204,0x30c03100,0x72a66a86,0x6a656a65,0x62456a65,0x6a8672c7,0x49a36ac7,0x62676aa9,0x628830e1,0x520849a6,0xb53683d0,0xad35a4f5,0xad569cd4,0x39a720e4,0x41842924,0x526839a6,0x41e64a28,0x39a45a89,0x41a649e6,
-0x41c64a07,0x41a63985,0x41a63985,0x39a641e6,0x39a72924,0x41e86b2c,0x316439c6,0x7b8d2944,0x28c13123,0x31643985,0x41e741c6,0x310351e8,0x31023923,0x49c54185,0xad341860,0x94518c30,0x83ef8c30,0x738d8c50,0x6b2ca4d3,0x080028e2,0x20a020a1,0x83ef2080,0x5a687bae,0x52693144,0x52483185,0x734d5249,0x4a0839a6,0x62ec4a28,0x41e77baf,0x7b6d7b8d,0x398539a5,0x49e63964,
-0x392228a0,0x5a463942,0x28c07b6a,0x080020c0,0x31000860,0x416130e0,0x41623900,0x20801020,0x41613120,0x626749a2,0x49a04182,0x31204180,0x390049a2,0x20406aa7,0x39221800,0x49c34162,0x62c84983,0x49833901,0x10004162,0x5a2530c0,0x30a02860,0x72e83921,0x416249a2,0x39423921,0x49c33100,0x30c038e0,0x6ac86204,0x6ac8836a,0x626772e9,0x52265a67,0x520651e7,0x41645205,
-0x30805206,0x7ae84982,0x72c751a3,0x93ca2880,0x5a234140,0x5a442880,0x5a453962,0x622549c3,0x5a256a85,0x62675a25,0x628772e9,0x6ac762a7,0x51e251e2,0x62c72900,0x49c428c0,0x182049c1,0x49e41000,0x184041a3,0x28c028a0,0x182028e1,0x31221840,0x41e71020,0x08000800,0x08000800,0x10201020,0x41e61820,0x5aa95a89,0x62896aa9,0x628862c9,0xb535a492,0x4a28a4f5,0x4a064a07,
-0x62674a06,0xbd2e8387,0x8c4f9c72,0x49e76aeb,0x520641a5,0x5a6849c5,0x5a686ac9,0x730a6288,0x28e15248,0x314562a9,0x5a683143,0x5a033940,0x62034960,0x51a24141,0x5a045182,0x6a857b29,0x72e75a24,0x5a246aa6,0x5a055a45,0x6aa86287,0x49a451e6,0x624751e6,0x9c105207,0x9c939c73,0x7bd09cb4,0x18c4738f,0x39c639c6,0x396441a5,0x52485a69,0x39647b8d,0x28e23122,0x41845a48,
-0x4a2841c6,0x39853144,0x396441a5,0x41a63985,0x31655248,0x4a283165,0x39a53185,0x31443964,0x49e64a07,0x9c92736c,0x31655248,0x392449e6,0x7b8c7b8c,0xa4f220c1,0x7bae734c,0xb55583ef,0x10406b0b,0x49e65a89,0x186049e7,0x10003102,0x52471840,0x738d49e7,0x72ec7b4d,0x31444166,0x41c641a5,0x524941a7,0x41a74a08,0x52283124,0x732c62aa,0x41c65a8a,0x41a641a5,0x39443964,
-0x31223121,0x186020a0,0x416249e5,0x188118a0,0x104020a0,0x49e528c1,0x49e55a67,0x20805a67,0x31023100,0x39411020,0x5a053100,0x41615204,0x41826ae8,0x30c07b49,0x39413922,0x28a030c0,0x31011840,0x6ae88bed,0xbd1083ab,0x30e130c0,0x5a045a04,0x39205a24,0x51e451e3,0x20804183,0x5a2451e3,0x6a4559e4,0x390059e4,0x496230c0,0x51c36225,0x59e438e0,0x62054982,0x62056226,
-0x498138e0,0x624459e4,0x6a858b89,0x7b288baa,0x62667ae8,0x52054963,0x49e45a45,0x30e05225,0x51e349c2,0x49c35a03,0x5a245a24,0x20403921,0x39a40000,0x39423963,0x186018a0,0x292128e1,0x08201880,0x20c20800,0x28e01880,0x00001020,0x316441e6,0x41c63965,0x000028e3,0x20a11040,0x08001020,0x10200800,0x6b0b41a5,0x7b4c7b0b,0x5a266aa8,0x49e65a06,0x52475228,0x5a676288,
-0x49c551e5,0x62a85207,0x52685a89,0x5a895a69,0x62895a89,0x62a962a9,0x7b6c8bce,0x41a55227,0x29031040,0x312320c1,0x6aea4a06,0x7b29730a,0x62666aa7,0x51a26a65,0x5a024120,0x72c75a04,0x72c872e7,0x7b0972a7,0x41434162,0x49c55a27,0x41a55207,0x6aca6289,0x83cf9c92,0xc5f9b556,0x398583ef,0x398539a5,0x41c749e7,0x4a275a68,0x39855a69,0x41853165,0x520628c1,0x392349e6,
-0x420741a5,0x4a484a48,0x39a541e6,0x41e52902,0x41843943,0x398441a5,0x310241a5,0x310228a1,0x49a53943,0x52495a89,0x31044165,0x20813964,0x08200820,0x83ef83ef,0x20a10800,0x49c43123,0x20606287,0x208028c0,0x18402060,0x28c12080,0x734c8bcd,0x28e33145,0x52499c92,0x49e849e7,0x49e849e8,0x39863966,0x6aec41a7,0x522862cb,0x418549e7,0xa4d25a28,0x39234165,0x39433943,
-0x10200800,0x29001860,0x39620800,0x080020a0,0x10201840,0x184049c4,0x4a051000,0x52675a86,0x31010820,0x28c03122,0x522528e0,0x28e049c3,0x62875a65,0x41826266,0x39012080,0x49624142,0x49634161,0x104049c5,0x20601040,0x5a453101,0x72c851c3,0x51c26245,0x51a25a05,0x6ac73900,0x6a8628a0,0x51a372a7,0x49804981,0x51a35a03,0x59e338c0,0x49812880,0x59c45181,0x39005181,
-0x59a338e1,0x72c56226,0x62646225,0x498030e0,0x59c351a3,0x5a0551c2,0x520572e9,0x414128e0,0x51e15a03,0x41615a03,0x28a049c2,0x39203941,0x00201040,0x18810000,0x00000000,0x00000000,0x00000000,0x18610800,0x080020a2,0x314330c2,0x20a128e2,0x29433163,0x08002924,0x00000000,0x08000800,0x08000800,0x6b0b5268,0x6ac9730b,0x6aa86a87,0x9c506ae9,0x51e66289,0x5a465205,
-0x418349c4,0x520751e5,0x49e65a48,0x52695248,0x5aaa5248,0x5a895268,0x520762c9,0x41a55a48,0x08000000,0x000020c2,0x31831060,0x39835226,0x7b091040,0x8b4959c3,0x626559a2,0x49a16225,0x624451e2,0x51c45a24,0x41844963,0x5a284985,0x734d6b0c,0xb555b534,0x5acbc5d7,0x524862cc,0x310341a5,0x49e63944,0x49a549c6,0x49c549e6,0x39433943,0x31233122,0x4a0749c5,0x39c649e7,
-0x39c6ad34,0x41653944,0x41854185,0x41a541c5,0x392149a4,0x39224161,0x49c54142,0x41a37b4b,0x41833942,0x28813923,0x94923103,0x49e7732c,0x7b8d83ef,0x31443144,0x31223984,0x31003921,0x28c03100,0x51e52080,0x20a049c4,0x30c02880,0x51c630c0,0x62aa30c3,0x736e3165,0x734d8c10,0x5249b535,0x6b0c0800,0x9c5183d0,0x38c2836d,0x390338c1,0x39034144,0x5a496268,0x628a49c7,
-0x00000000,0x20e02901,0x10002900,0x10001860,0x41a33102,0x00000000,0x00200000,0x10400000,0x31425266,0x31020000,0x08001860,0x18601840,0x5a661040,0x62876288,0x30c03942,0x49832880,0x30c04141,0x49613101,0x41804141,0xb4d28bcb,0x39009c0e,0x62664141,0x28a03901,0x51a34161,0x59e359e3,0x6a8651a2,0x6a464961,0x39206225,0x40e04100,0x4140ee56,0x62465a24,0x59e251c2,
-0x49804140,0x72e75203,0x2040836a,0x38c02820,0x49416224,0x414238e2,0x51e430e1,0x49a149a2,0x51c151c0,0x416151c2,0x30e03920,0x394130e0,0x00003101,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x30e20800,0x39643123,0x39852922,0x20e23144,0x00000820,0x00000000,0x08000000,0x6aea3123,0x730a5a07,0x6aa872e9,0x72ea6ac8,0x5a274185,0x62875a67,
-0x52055205,0x51c65a27,0x52273944,0x5aaa62ca,0x62ca5248,0x4a075227,0x5a475a89,0x9c915a47,0x28a00000,0x00001000,0x28c01860,0x18204183,0x8bed20a1,0x944fbd95,0x5a05730a,0x6a865a44,0x5a045a24,0x59e549a3,0x49e649a4,0x6aeb9c71,0x7b6d5249,0x52287b8e,0x41c65227,0x398541a6,0x41a54a07,0x39449c71,0x49a54185,0x41845a47,0x49c53943,0x49e649c5,0x732c4184,0x6b0b5a69,
-0x41c53985,0x41a549e6,0x41643943,0x39203941,0x51c449a4,0x41834982,0x41624983,0x39434183,0x39435226,0x49c63943,0x8c108c2f,0x28e3732c,0x39a63144,0x31442924,0x730b734c,0x30c051c4,0x498328a0,0x41634143,0x51834963,0x39433902,0x5a076268,0x41a64986,0x52284165,0x49a7acd3,0x20833946,0x9c92b535,0x39231041,0x49844985,0x51c54963,0x5a064984,0x5a0651e5,0x51e551c5,
-0x00000800,0x08000801,0x28a42921,0x20811020,0x20c03122,0x18414162,0x20a02080,0x18601860,0x08201841,0x39640800,0x18604185,0x39623122,0x20c03964,0x396049c3,0x6aa82080,0x51c47ae9,0x41614982,0x51e44182,0x51c449a3,0x30e03921,0x51c472c7,0x30e130c0,0x390030c0,0x38c030e0,0x51c24981,0x59e46244,0x49606244,0x620638e0,0x6a456204,0x62264980,0x51e55a04,0x72a85204,
-0x28c06245,0x390028e0,0x62454984,0x59a17284,0x412059c3,0x39214161,0x72e730a0,0x30c028a0,0x62435a03,0x30e04981,0x30e03920,0x41613941,0x312330c0,0x29020000,0x20a11860,0x18401840,0x10201860,0x20e13943,0x20c12902,0x000128e3,0x41842081,0x5aa920e1,0x08003165,0x28e31060,0x00000000,0x10600000,0x49e620a1,0x6ac96a89,0x6aa872c9,0x6aa87b09,0x62685a27,0x49e47309,
-0x52256287,0x5a275206,0x5a285a68,0x4a274a28,0x522862aa,0x49e65248,0x628862ca,0x734c41a5,0x3921ac90,0x31003921,0x51e52040,0x288149a4,0x4a060800,0x7bcfa536,0x6a8839a6,0x62458347,0x5a256245,0x622751c4,0xce178bee,0x52281020,0x41a67b6d,0x49e641a6,0x41a45a48,0x524749e5,0x62895268,0x52075207,0x51e6834d,0x394449c6,0x4a0562a8,0x41a541a4,0x62ca3944,0x41847b8d,
-0x5a274184,0x49c449c5,0x51e549a4,0x62464984,0x52055a26,0x51c43941,0x41a230e1,0x5a263942,0xacd14184,0xb5131840,0xad1418c2,0x20c22923,0x29440000,0x39643144,0x7b4c5aa9,0x49a44143,0x51e54984,0x41436246,0xcdd6838d,0x4165cdb5,0x49a55a48,0x41654965,0x49c649a6,0x49874165,0x9c1172ec,0x5249bd96,0x49846289,0x72885206,0x51e46a66,0x51e551c4,0x39005a26,0x51c34983,
-0x082020e1,0x00000000,0x39651080,0x31423984,0x18601840,0x31012080,0x10002080,0x28c11020,0x00000800,0x00000000,0x00000000,0x00000000,0x62881860,0x41414142,0x418030e0,0x38e130c0,0x51c33921,0x49814141,0x416151e4,0x5a0451e3,0x414138e0,0x39215a24,0x624530e0,0x62456225,0x51e351c2,0x51c351e3,0x49e26a86,0x62255204,0x5a26a46f,0x286059c2,0x49428329,0x41624962,
-0x5a238369,0x51c251e2,0x41608b6a,0x6a456203,0x62036a24,0x38a082e9,0x6aa76ac8,0x38e051c3,0x496051c1,0x41a34161,0x39615204,0x41624142,0x100028a1,0x18201860,0x10003943,0x08601020,0x18400820,0x20401820,0x28801800,0x20802060,0x20a020a1,0x4a070800,0x00000000,0x00000000,0x00001082,0x4a270000,0x30e120a1,0x6aea20a1,0x730a6aea,0x6ac8732a,0x62675a46,0x52066267,
-0x5a265206,0x51e551e5,0x62a95a88,0x20c35a6a,0x00000000,0x41841060,0x30e228c1,0x392230e2,0x62456aa7,0x6a447ac7,0x6a236a44,0x51817223,0x6aca30e2,0x398541c6,0x52063124,0x5a2662a9,0x5a0651c4,0x9c91836c,0x39653985,0x734c9430,0x526883ef,0x524839c5,0x52275aa9,0x49e55207,0x72ea4a06,0x5a075207,0x5a673964,0x418451e5,0x52064184,0x39433964,0x39443964,0x41644165,
-0x62676288,0x520549c4,0x51e551c4,0x52055a05,0x28c05204,0x8bcd4180,0xc5b58c0f,0x39433122,0x94508bce,0x080028e3,0x08001020,0x41c52080,0x0000734c,0x4a073164,0x7bad5a69,0x6aebb574,0xa4b28bee,0x5a88a490,0x736d630b,0x9cd1a4f2,0xa4b28c4f,0x72cabd95,0x93699bee,0x52066a46,0x5a275a68,0x52067b2a,0x5a2651e5,0xb5108bcc,0x28a049c2,0x49a34181,0x5a255204,0x5a0459e4,
-0x20801000,0x00200840,0x5a680000,0x18a03984,0x20c020a0,0x18402080,0x28e028c0,0x186020a0,0x080020a0,0x00000000,0x00000000,0x08200000,0x52053963,0x498249c3,0x49426226,0x51a36245,0x5a043900,0x51c251e4,0x8b8959e4,0x5a044161,0x41205183,0x626651c3,0x51e349a3,0x496151c3,0x49814160,0x5a0351c3,0x9c0d51e3,0x59c24982,0x51824941,0x6ac751a2,0x51c259e3,0x30a06204,
-0x624451c4,0x5a235a03,0x49816225,0x6a254120,0x72666a66,0x49613080,0x8b4a4983,0x412038a0,0x49616224,0x41a36246,0x186041c4,0x10004984,0x20802060,0x30e02880,0x5a664181,0x206028c2,0x20a02880,0x28c028a0,0x310149a4,0x522628c0,0x310141a3,0x08001000,0x00000000,0x00000000,0x00000800,0x7bad4208,0x49a40800,0x730b0000,0x7b4c730b,0x5a676ac8,0x5a055a67,0x940f51c4,
-0x836c940f,0x51e549a4,0x49c551e5,0x20800000,0x62a849a4,0x08000000,0x7b0928c1,0x39001000,0x7b096aa8,0x82e7938a,0x938a9369,0x6a658b69,0x49e65a47,0x49e641c6,0x51e73985,0x59e75a48,0x6aca5a07,0x9c72838e,0x41a641c6,0x632c4207,0x41c639a6,0x49e64206,0x41a449e6,0x49c45a47,0x49a45226,0x7b4b28e1,0x39222080,0x39223942,0x52065206,0x49e649c6,0x5a4972eb,0x520751e8,
-0x5a264184,0x5a4672e9,0x51e44983,0x5a255a05,0x49c349c4,0x10206285,0x6b0c2945,0x206162aa,0x20a31861,0x39241000,0x5a463963,0x394349a4,0x310328a2,0xb53441a6,0xcdd6b554,0x206049a6,0x62474164,0x49e56267,0x29035227,0x414330e2,0x414272ca,0x20606aa7,0x8b66cd8d,0x49836aa6,0x416228a0,0x28a03121,0x5a4728e0,0xb5115a47,0x20603121,0x41614142,0x498349c3,0x72c85a25,
-0x00001860,0x08000820,0x00000841,0x00000000,0x08403985,0x39423120,0x30e03121,0x28c04141,0x20602880,0x00001020,0x00001041,0x39840840,0x20a06ae9,0x62456265,0x41405182,0x416130e0,0x39004161,0x390049a1,0x5a0530c0,0x30e08bab,0x5a0430e0,0x5a035a04,0x49a35a24,0x51c43920,0x41416286,0x49824161,0x49804161,0x51a249c2,0x496138e0,0x180030c0,0x59e46a85,0x5a056226,
-0x30e030a0,0x6a875a04,0x30c072c7,0x49614941,0x622438c0,0x620530a0,0x6a8741c4,0x62032820,0x49604961,0x41824982,0x18203102,0x20601820,0x30c02060,0x59c36204,0x7ac76205,0x72a67287,0x59e46a65,0x5a0459e4,0x5a464180,0x310172e9,0x30e03921,0x39843121,0x184018a2,0x29013121,0x00000800,0x08000000,0x39832902,0x732b5267,0x5a475246,0x5a265a06,0x5a255a25,0x62885a46,
-0x6aa849a5,0x5a676ae9,0x83cc730a,0x51c36ac8,0x72e872c8,0x59e46246,0x20204962,0x59e430a0,0x8b486a66,0x8b488b69,0x93ab8b8a,0x6a8693ca,0x396449c5,0x39445a48,0x49e65207,0x6aeb5a47,0xbd95b554,0x41e7d658,0x5a8983ae,0x49e641c6,0x4a074a07,0x39a541e6,0x522741e6,0x390141a4,0x5a273901,0x49a4acd1,0x41c549e6,0x41e641c6,0x41a53164,0x62ca4a27,0x526941a6,0x942f49e7,
-0x39443944,0x49c549a4,0x5a473923,0x52265267,0x396249a3,0x39653183,0x08000800,0x10200800,0x41640800,0x5a065a06,0x41a449a4,0xa4b049a4,0x39648bcc,0x9430c5b5,0x49625a06,0x41222000,0x18001800,0x39a63961,0x20c11081,0x38e14963,0x49836a88,0x41824182,0x20803941,0x28c03100,0x28c028c0,0x28a028c0,0x28a020a0,0x28a030e1,0x28a01860,0x49e530e0,0x6aa96ae9,0x7b4a7309,
-0x18401860,0x18a11040,0x00000000,0x00000000,0x00000000,0x39622942,0x49c249e4,0x49a251e3,0x416251c4,0x08001000,0x08000000,0x294320e2,0x184028e1,0x49c33982,0x412059e4,0x416151e3,0x51e351c3,0x51e351e3,0x39414961,0x49c45a45,0x390049a2,0x28604121,0x73085204,0x394151e4,0x5a044182,0x39205a03,0x51e33920,0x49a34141,0x51c259c4,0x51a34141,0x51a351c2,0x498259c4,
-0x6a864981,0x49814141,0x30a06266,0x5a2449a3,0x5a066267,0x6a6759e4,0x414151c3,0x30805a04,0x59c230a0,0x100030a0,0x20601000,0x49813901,0x59c24940,0x9bca6a64,0x93aa9bca,0x93ca9bcb,0x9bcb9beb,0x8b4a8329,0x59c36243,0x51a23920,0x30c030e0,0x20a030e1,0x20a018a0,0x18602901,0x000018a0,0x00000000,0x4a270800,0x5a683963,0x39433102,0x39833141,0x52065a47,0x41c55226,
-0x62876aea,0x732a5205,0x28c06ae8,0x7b0830e0,0x5a036aa6,0x72c68b8a,0x72c86a86,0x7ae86224,0x59e36a45,0xac4c9beb,0x72c6a42c,0x62057b08,0x49a541a4,0x49c65a48,0x5a28a491,0xd638de58,0x41c75228,0x52485249,0x52484a07,0x41e65a68,0x29023143,0x41c63964,0x49e741a5,0x51e65207,0x52075a47,0x41656268,0x290341c6,0x39853964,0x5a693985,0x41c63964,0x41e649e7,0x49c65aaa,
-0x39445a48,0x5a4830e2,0x5206730b,0x00001000,0x29021000,0x080018c2,0x20601020,0x6aea5a28,0x414251e5,0x41834142,0x39423942,0x62881060,0x49a41840,0x392251c6,0x59e551a3,0x62056a46,0x72676205,0x18204120,0x41221000,0x59c340e0,0x30e04120,0x28e028e0,0x310028a0,0x28c028c0,0x28a028c0,0x20a01860,0x184020a0,0x396330e1,0x29013963,0x49e549c5,0x5a684184,0x83cc62a9,
-0x28a03940,0x28e049a1,0x00003121,0x00000000,0x00000000,0x31430820,0x5205732a,0x6a6551e3,0x49a151e3,0x286051e2,0x08001020,0x10400000,0x31211860,0x51e43942,0x49a251e4,0x41425202,0x41615203,0x49a251e2,0x414049c2,0x51e34161,0x51a351a2,0x418130a0,0x416051c2,0x39014160,0x51c47ac9,0x6a875a23,0x38e05a25,0x8b6b51a3,0x51a34941,0x38c059e4,0x416151c3,0x30e038e0,
-0x5a464961,0x52045a05,0x8bcb5a25,0x6a866266,0x6245834a,0x180049a2,0x414272c8,0x72e859c4,0x8b494961,0x49a24963,0x498230c0,0x6a024100,0xa3eb9ba9,0x9beb93ca,0x93aa9beb,0x93aa8b89,0x8baa8b89,0x83297b08,0x8b6a8329,0x7b0893aa,0x180038e0,0x410059e4,0x10004941,0x28802040,0x41222880,0x10004143,0x39232880,0x186030e1,0x208028a1,0x10001860,0x18201840,0x208028c1,
-0x49c63963,0x41a45a47,0x4a053101,0x832a5205,0x83497b28,0x7b2a8b8b,0x51e693cd,0x51e55a26,0x5a045a26,0x9bcb9bec,0x7b078348,0x5a475a26,0x626849c5,0x5a695a68,0x4145cdf7,0x41c65a28,0x41c65248,0x52285248,0x39a549e6,0x4a065a89,0x31422901,0x83ae5a88,0x6aea7b8d,0x49a63964,0x732c6aeb,0x31243965,0x41c641a6,0x39853985,0x41c641c6,0x52285248,0x41865248,0x6acb3944,
-0x6249b4d3,0xd6785a69,0x5a89c638,0x10002040,0x00001060,0x6aea3985,0x41425a47,0x72ea4163,0x38c04121,0x38c12020,0x10004123,0x08001000,0x392249a3,0x62475a07,0x6a666a87,0x6a457266,0x72667286,0x6a6772c7,0x59e34942,0x6a236a23,0x30e04920,0x28a028e0,0x28c020a0,0x208030e0,0x18202080,0x30e028a1,0x314239a4,0x7b8c3143,0x31023964,0x522749c5,0x290341c5,0x186062ea,
-0x39414163,0x49a151c3,0x41203100,0x000020a0,0x00000000,0x00000000,0x49e341c4,0x5a0449a2,0x62666245,0x5a446a66,0x08001800,0x10200000,0x39623943,0x312028e0,0x39003920,0x51e35204,0x49c349a3,0x418249a1,0x41424161,0x414138e0,0x624651c3,0x5a046ac8,0x7b285a04,0x51c349a2,0x390030a0,0x6a865a05,0x390051c3,0x496251c3,0x51c359c3,0x414138e0,0x41214162,0x39014982,
-0x838b7ae8,0x49c351c4,0x51e41840,0x62867308,0x62658b8a,0x5a2551c3,0x59e451c4,0x51e451a3,0x6a65bd31,0x28803080,0x49203900,0x93896a44,0x9bea9389,0x93ca9beb,0x8b8993ca,0x93ca9c0b,0x8baa8328,0x8b8a9c2c,0x8b6a93ab,0x83498349,0x9beb93cb,0x8b688348,0x93488b48,0x72667aa6,0x62246a25,0x626772e8,0x20805a06,0x18002040,0x10202080,0x18611860,0x10003122,0x18201000,
-0x18001820,0x30c01840,0x39833942,0x7b293982,0x72e87b29,0x52066287,0x52065227,0x5a276268,0x5a0551e6,0x62028348,0x83495a01,0x834c6aa8,0x52075a26,0x9c51a491,0xcdf9d619,0x41a6730c,0x41c641a6,0x41c641c6,0x41c64a27,0x4a2741c6,0x7b8c41c4,0x83ce3123,0x8bef9450,0x62aa3144,0x39a6732d,0x396541a6,0x39655228,0x39a53164,0x4a075228,0x4a0762aa,0x39853144,0xb5347b6d,
-0x7b6d6aeb,0x4a0783ce,0x310320c3,0x6aca3102,0x49e66aea,0x41c449c5,0x416351e4,0x30a06246,0x41423901,0x49844965,0x30c25a27,0x418330e0,0x62695a07,0x6aa75a07,0x72866aa6,0x72867ac6,0x7ae772a6,0x728872c7,0x59c36a65,0x722461c0,0x30e05983,0x28c028c0,0x20a02080,0x28a020a0,0x28c04163,0x41a33962,0x734b6b0a,0x39843164,0x312239a5,0x41c52080,0x20803143,0x28e03121,
-0x49a149c1,0x51e13920,0x49a049a0,0x41603940,0x00010800,0x00000000,0x39830000,0x41c14a21,0x51e249a3,0x49804980,0x308051c2,0x00400001,0x20811820,0x39640000,0x39425a25,0x30e23924,0x7b0a4163,0x52235a26,0x624551a2,0x39004120,0x496330a0,0x39207b08,0x62254980,0x5a036a84,0x49a259e3,0x49836245,0x62243900,0x59c251c2,0x518359c3,0x390051e3,0x62254963,0x72e74962,
-0x6ac872c7,0x30e03920,0x6a664983,0x6a8751c4,0x41a15a45,0x62445161,0xddf56245,0x41227aec,0x28603901,0x38c030c0,0x93884920,0x9beb9beb,0x9beaa42c,0x9c0b93ea,0x72c693ca,0x93ca8baa,0x834993ca,0x83288b8a,0x8b697ae7,0x8b698b88,0x8b699bca,0x8b6a9c2d,0x8b8993cb,0xa3ec8b89,0xa3eb93ab,0x7aaa9bec,0x18215a04,0x30c22001,0x49a66268,0x10000800,0x416128a0,0x39414161,
-0x51a249a3,0x51a25182,0x184051a5,0x20211800,0x49a41800,0x51e641a5,0x41a55206,0x418549e7,0x52055227,0x732549c1,0x49a26aa4,0xa4716288,0x49e75207,0x72cb30a3,0xbd77c577,0x5247b555,0x49c641e6,0x52286289,0x4a0741c6,0x62eb5aa9,0x6b0b5228,0x734d8bef,0x6aeb8c10,0x39866aeb,0x52095269,0x49e741a7,0x41a54184,0x41c641c5,0x524841c6,0x41a541a6,0x83cf3964,0x7b8e9431,
-0x41c683cf,0x4a078bf0,0x51e5834b,0x49c44983,0x49c55207,0x52474183,0x62a91081,0x5a065a68,0x49a48b8c,0x6aaa5a28,0x51c66a68,0x51a34121,0x62255a25,0x7ae86a87,0x7b077b09,0x72e68328,0x83297b07,0x624672c8,0x72a751c4,0x41835a46,0x8c0f2060,0x208062cb,0x31023102,0x39854184,0x94715268,0x18604a27,0x39643985,0x316341a5,0x39a43163,0x398520e1,0x396320a1,0x20c020a0,
-0x51e249a2,0x39206264,0x30e03900,0x414130a0,0x000049a3,0x00000000,0x00000000,0x49c33142,0x49a149c1,0x51c151c2,0x59e551c3,0x00000820,0x00200000,0x49c40800,0x30c030c0,0x20402060,0x31002040,0x5a443940,0x59e34981,0x83286224,0x49813900,0x41403920,0x59c35a03,0x49613900,0x62444120,0x5a246225,0x6aa66265,0x5a0472c7,0x49426245,0x30e04141,0x41422860,0x18003901,
-0x41427b0a,0x39006246,0x30e051e4,0x6a874162,0x49a24182,0x6a6651e4,0x51c45a04,0x49834985,0x6aa81820,0x62244141,0xac8d93eb,0x93aa9beb,0x9beba42c,0x838993eb,0x73089c2c,0x7b2872e7,0x9c4d7308,0x6224838a,0x72e77b28,0x8b8a93aa,0x93ca8b89,0x93cb9c0c,0x8b89acae,0xb48e9bea,0x9bca8b69,0x7ae77ae7,0x6aa73900,0x416172e8,0x20606267,0x51e351e4,0x5a0449c3,0x520451c3,
-0x5a0449c3,0xbcef72a6,0x18202880,0x5a231000,0x51e36224,0x5a264163,0x49c52080,0x520749e7,0x49c65206,0x93ed6ac9,0xc57451e5,0xb555b553,0x628983ae,0xd5f89c30,0xbd77ce19,0x3964838e,0x49e649c6,0x41844185,0x4a063143,0x41a63985,0x41c662aa,0x6aeb5228,0x62aa7b8e,0x62eb5a8a,0x5a6a5249,0x49e63985,0x52075227,0x4a075248,0x39655248,0x5a2849e7,0x62aaa4b1,0x52275a89,
-0x6b0b8c2f,0x49e41040,0x41614182,0x18004983,0x31025a46,0x83ad3944,0xacf39c91,0x51c5acb1,0x72c96268,0x62886288,0x6a866aa7,0x6a666225,0x6aa76246,0x6aa66225,0x72a76aa6,0x6aa66a86,0x6aa86ac7,0x51e55226,0x51e52080,0x38e22000,0x28c13081,0x4a063902,0x394441a5,0x20e33964,0x398539a6,0x29032903,0x41a53164,0x31643964,0x6b2b3164,0x39856aea,0x28e241c6,0x418428e2,
-0x51c25201,0x51e15a03,0x416049a0,0x51c14980,0x30e03920,0x00002080,0x00000000,0x5a461020,0x51e35a25,0x41204141,0x20602020,0x08002080,0x00000000,0x208020a0,0x30e11000,0x49832060,0x5a2630c0,0x6aa75a26,0x622451c2,0x51c359c3,0x59e451e4,0x72c64121,0x62436a46,0x496159e5,0x5a0351c2,0x51c26266,0x28a049a1,0x28a02080,0x184049a3,0x5a044962,0x59e46225,0x39006a46,
-0x08001800,0x30c02881,0x41624121,0x6a8730a0,0x6aa830e0,0x5a0418a0,0x59e451c4,0x392130c0,0x310130c0,0x83ab5a26,0x7b8aa4af,0x8bca8beb,0x940c7b49,0x73086286,0x7b6a7309,0x73086ae8,0x5a855a66,0x838b7328,0xb511a46e,0x6ac6bd31,0x838a49a3,0x72e672c6,0x83287b07,0x7b068b89,0x7ae68327,0x41629bea,0x48e061e6,0x49a25202,0x59e151c3,0x622251e0,0x51e359e2,0x5a455a24,
-0x52056265,0x39217b4a,0x49402040,0x83086a42,0x62436a43,0x62444982,0x29014961,0x52274184,0x522649c5,0x520749c5,0x62a841a3,0x9c929cb2,0x52076aeb,0xcdf8628a,0xbcf5d69b,0x4144836e,0x41a44165,0x394349c5,0x39024183,0xb5345228,0x62aa9c91,0x7b8e5a69,0x49e76aeb,0x5a8a62aa,0x398541e7,0x4a0641a5,0x5a475206,0x83cd5a89,0x7b8d6b0b,0x49e7bd95,0xa4d1bd34,0x4a066aea,
-0xb5734a26,0x7b2b51e6,0x28805a06,0x62671840,0x31223961,0x83ae6249,0x41870801,0x72c95a49,0x62476267,0x6a876a66,0x7ae9832a,0x72a77ae8,0x6aa76aa7,0x59e66245,0x39024964,0x39634184,0x5a4951e6,0x39633963,0x626972eb,0x942f6b0b,0x62cb8bee,0x39a63165,0x31653185,0x31653165,0x316539c6,0x31443123,0x29033144,0x398649e7,0x31453965,0x4a073986,0x49c63985,0x51e74185,
-0x49c14160,0x5a0351e1,0x41404140,0x41404160,0x30e03920,0x28c05a44,0x08002080,0x4a0128e0,0x52045202,0x394030e0,0x30c030e0,0x5a254163,0x08000000,0x4a041000,0x31014184,0x206049a3,0x20401800,0x5a254122,0x390051a2,0x392049a2,0x498249a3,0x8baa5a03,0x62448b8a,0x41405a02,0x72e93900,0x51a26266,0x7aea3900,0x4141834a,0x39212060,0x18207b2a,0x28a02040,0x28a049a2,
-0x49a33922,0x28a02040,0x39203921,0x206028a0,0x39623100,0x5a463920,0x49e52081,0x28c030e0,0x31013100,0x08002080,0x18a020a0,0x310128c0,0x208028c0,0x208028e0,0x20801000,0x10001000,0x18201820,0x18001801,0x08001000,0x20a01000,0x10401020,0x41603100,0x6a834140,0x7ae572a3,0xcd6d8b67,0xb4cf6a43,0x30405180,0x61e359c2,0x518159e1,0x83277b08,0x72a65a02,0x41416246,
-0x41416a86,0x202030c0,0x59a02860,0x83486a63,0x6a857ae6,0x7ae77b27,0x51a46245,0x62685226,0x52276289,0x628783ac,0x5a265a26,0x41a55227,0x83ad9cb1,0x6acbb534,0xde7af71d,0xacd2b556,0x418449c5,0x41844163,0x49c65a27,0x524841a6,0x8bcf49e7,0x6aeb7b8d,0x49e75a8a,0x4a0741c6,0x52073985,0x49e549c5,0x522749e6,0xa4f23964,0x39434184,0x49a55a67,0x9c7151e5,0x0800ad33,
-0x186028c0,0x418230c0,0x18203921,0x30e130e0,0x9c913123,0x39656b4d,0x6aec6b0c,0x62485a69,0x6aca6aa9,0x72c872c8,0x626672e9,0x522649c5,0x7b4c5a27,0x5a476268,0x520651e6,0x41855206,0x628849e6,0x314439a5,0x20a241e6,0x49e65227,0x39854164,0x31452904,0x39863986,0x31653986,0x314541c6,0x316539a6,0x41a63985,0x41e73985,0x5a695aaa,0x398541c6,0x418449e6,0x39434184,
-0x41a05201,0x5a024180,0x416051e2,0x5a024140,0x392049a1,0x39004962,0x522451c2,0x182028c0,0x49c130e0,0x51e45a05,0x414249c2,0x49833922,0x20606b2b,0x18401020,0x310128a0,0x10003923,0x20401000,0x414149a3,0x18002021,0x38e04142,0x28a04982,0x49814141,0x51a25a04,0x49816a84,0x49c35182,0x41423921,0x38e13901,0x49a27ae8,0x30a030a0,0x49424943,0x28a072a8,0x39616245,
-0x414328c1,0x41832880,0x41643902,0x49832060,0x188028e1,0x39440800,0x39421020,0x20a02880,0x28a020a0,0x100028a0,0x28c028a0,0x20c020a0,0x310030c0,0x39003920,0x28803900,0x30c04141,0x59e34122,0x41234962,0x31423101,0x39423943,0x39410000,0x518038e0,0x6a636a21,0x6a237285,0xa3e782e3,0x9ba89b85,0x6a869bc8,0x59e351a2,0x59e151a1,0x62246223,0xbcd09bed,0x51e46a66,
-0x41211800,0x41605a23,0x51204120,0x8347a40b,0x7ae772c6,0x7b087ae7,0x7aa772a8,0x622572a8,0x52044982,0x62475205,0x732a51e5,0x62675a26,0x394349a3,0x5a8abd95,0xbd76ad15,0x3944b556,0x392351e6,0x49a44163,0x416451e6,0x41653924,0x5a0851c7,0x9c7151e7,0x4a0741c7,0x39859430,0x522841e7,0x41a441a5,0x5a685227,0x94705206,0x3164bd94,0x7b6c5a89,0x49c4acd2,0x310030e0,
-0x28a030e0,0x28c028c0,0xacb12880,0xd658730b,0x186149a5,0x736d1881,0x5a695aaa,0x6aa962a9,0x5a485207,0x498451e6,0x522849c6,0x52285248,0xacf37b6d,0x49e749e7,0x49e541a5,0x418449c5,0x41a55206,0x314441a5,0x49c541a4,0x41843963,0x39a53963,0x41c741a6,0x31453145,0x39863165,0xb5754a08,0x4a0762eb,0x41a63965,0x6b0b734d,0x41a64a28,0x6aea6aeb,0x9c7083ad,0x49c64185,
-0x52035222,0x5a035a23,0x51e35a03,0x51c049a0,0x624451e1,0x5a045a03,0x49a24981,0x49c35204,0x28c03920,0x49a249a2,0x31003920,0x28e03941,0x312120c0,0x28a03922,0x18403102,0x28a01820,0x28a051e4,0x288028a0,0x496251c4,0x62066a46,0x5a044163,0x30c030e0,0x51c12040,0x62456265,0x5a254122,0x51a33901,0x39023900,0x49a451a4,0x41414120,0x59e430a0,0x41632880,0x20601800,
-0x08001000,0x10400800,0x10403984,0x00000800,0x10401020,0x10002081,0x30e12080,0x20804163,0x20a028c0,0x30e03121,0x39403100,0x51c230c0,0x72e772c7,0x62457ae7,0x5a2472e7,0x7b486265,0x62656265,0x5a265a24,0x5a685226,0x000039a5,0x41604143,0x49804140,0x6a4251e0,0x6a437ae5,0x7260c48a,0xa386b407,0x41409386,0x62223120,0x7ae872a7,0x624472c7,0x49419c0b,0x498259c2,
-0x394251c3,0x51a22040,0x6a6459e0,0x834793a9,0x83288349,0x83078b69,0x7ae77aa6,0x728372a5,0x72a782e6,0x5a256266,0x94705a27,0x51c5bd54,0x5a467b29,0x83af72ec,0xdebba4d5,0xc595e6db,0x9c30b533,0x8befacb2,0xffbe9430,0x31244a08,0x734dacf3,0x62ca5a69,0x8c105a69,0x5a486aeb,0x41634185,0x49a430e1,0x49834162,0x41a63143,0x8c307bce,0x49e6a4f3,0x39205206,0x392030e0,
-0x28c03940,0x390028c0,0xcdd641a3,0x52475227,0x83ad49a4,0x4a075269,0x49c64a07,0x418549a5,0x396441a5,0x49c56288,0x4a0749e6,0x52485228,0x8c2f736d,0x41647b8d,0x49a441a4,0x28c13963,0x39233102,0x41634164,0x30e13923,0x41843943,0x39653963,0x62cb5207,0x5a8a4a28,0x41e762eb,0x4a4862eb,0x49e74a07,0x526941e7,0x316541c6,0x6b2c41c7,0xad3462cb,0xa4908c0f,0x944fd616,
-0x520349c2,0x51e35a24,0x5a035a03,0x5a2572c7,0x49a249a0,0x414151c2,0x41605a02,0x49a149c2,0x52045203,0x390028a0,0x41824181,0x416251e4,0x312228c0,0x62a98c0e,0x28a01000,0x10001800,0x418330e0,0x4161b4f0,0x390051a4,0x49434962,0x392059e5,0x41224963,0x5a234984,0x5a035a04,0x49622880,0x416151a3,0x41232860,0x18001800,0x622538c1,0x38c04962,0x00002080,0x102030e1,
-0x83ad0800,0x28e37b8c,0x18610800,0x10200800,0x208028c0,0x28c02080,0x28c04160,0x30a03920,0x30c049a2,0x41604140,0x5a034140,0x7b287b07,0x72e76265,0x6aa67b28,0x72c772e7,0x6ac66a85,0x5a866285,0x20a05a87,0x08200800,0x28c10800,0x30e030c0,0x51a138e0,0x62655a02,0x7ac52880,0xbc6ba3a6,0xac09bc69,0xa3a8ac07,0x41404940,0x6a665a04,0x6a877ae8,0x8b8a9bec,0x59e58b6b,
-0x49a151e3,0x51807b06,0x8b4993aa,0x7ae78328,0x832872c7,0x832859e3,0x72857ae7,0x7b278327,0x7ae88348,0x838b8b8b,0x62257b09,0x51c430e2,0x51e43920,0xad14bd75,0xbd979cd3,0xa4d3a4d3,0xacf3bd96,0x522849c7,0x18603944,0x7b6d83cf,0x83ae5249,0x5a89734d,0x6aca8bef,0x41436268,0x39624983,0x52045225,0x5a6841a4,0x8bef4a27,0x5a8a62eb,0x6aeb6b0c,0x49a46289,0x30c03922,
-0x940c28a0,0x3122de56,0x28a028a0,0x5a885246,0x7b4c5228,0x49e64164,0x41645a48,0x39643943,0x5a47942f,0x39645207,0x41c641c6,0x4a0749e7,0x83ce5248,0x49c641c6,0x41834184,0x41844183,0x49a449a5,0x392249a4,0x6a8a4164,0x9c3051c6,0x30e25a07,0x394430c2,0x418541a5,0x39a55a69,0x41c65aa9,0x62ca41a6,0x52484a07,0x8c306b2c,0x8c3062eb,0x83ef8c10,0x7befb575,0x7bef83ef,
-0x416049a0,0x5a035a03,0x624451c2,0x5a246244,0x51c349a1,0x51e251a2,0x49c14160,0x49a13920,0x49a13100,0x28c049c2,0x39611860,0x20603962,0x18204183,0x08010000,0x204028c0,0x628749a6,0x51a249e2,0x51e459e3,0x39006265,0x59e62880,0x10002040,0x5a452080,0x41a149c2,0x5a246264,0x498338e0,0x498251c3,0x30c02860,0x39014162,0x30e049a3,0x310030e0,0xa4b220c0,0xacb00800,
-0x18400000,0x00001040,0x00200000,0x310028c0,0x30e01860,0x39604181,0x418149a3,0x498149a0,0x41404960,0x8b6b6a64,0x6aa67b08,0x72e76265,0x72e76ac6,0x6a646a85,0x52047b28,0x6b076287,0x28e041a3,0x418228c0,0x30e03941,0x6a243060,0x38c03081,0x5a423900,0x30e06265,0x410030c1,0x9322a365,0xac29abe8,0xaba6b429,0x6a42c4eb,0x4983c552,0x6ac76aa6,0x51e472e9,0x41e372e9,
-0x51a13101,0x6a8272a4,0x8baa8349,0x7ae87ae8,0x72c66244,0x7b087b28,0x7ae78349,0x8b4a72a6,0x73087308,0x6ae77308,0x41013900,0xbd33bd32,0x93adc554,0x72c79c0d,0x51c64962,0x832b49a6,0x18206a48,0x416349c6,0x184151e6,0x312549a5,0x7b4c62a9,0x49e6730b,0x49c55227,0x834a49e6,0x52055a05,0x52066ae9,0x52274a27,0x6b0b6aeb,0x62ca5269,0x628a5269,0xbd33d617,0x6249732a,
-0x18603942,0x39213920,0x41623921,0x41a56288,0x5a473142,0x31022901,0x39433101,0x31233102,0x5a475227,0x41a44184,0x39434183,0x524841a6,0x5a48b514,0x49c56288,0x49c549c5,0x39425a47,0x5a265a47,0x62684164,0x9c70acd2,0x72cba451,0x7b2c834d,0x738d72eb,0x52285aca,0x39643965,0x396420c1,0x7bae4a48,0x41a68bef,0x52883164,0x31235267,0x29643985,0x39c63185,0x738d738d,
-0x51e249c1,0x41604180,0x414049c1,0x5a234180,0x49a149a1,0x51e251e2,0x49c24181,0x49a149c2,0x49c24181,0x31204160,0x28a041a3,0x20a03922,0x39423101,0x204030a0,0x10201000,0x524628e0,0x28c01000,0x5a2449e3,0x49814142,0x5a055a04,0x100030a0,0x20803102,0x49a328e1,0x49a24121,0x204051c2,0x41404161,0x390149a1,0x496251e4,0x41424141,0x18204161,0x08001000,0x20a020a0,
-0x00001881,0x00000000,0x00000000,0x20e020a0,0x20a028c0,0x51e330e0,0x39404181,0x51e24161,0x7b077b48,0x83697ae6,0x7b2772c6,0x62456265,0x72e75a44,0x62655a64,0x28c25227,0x08001000,0x41a33141,0x39423941,0x310141a3,0x830540e0,0x82e582e5,0x73068b08,0x290241a4,0x524749e5,0x9c0c3983,0x9b8793c9,0xb408b409,0xcceec4ab,0x392093cb,0x7b2a4162,0x30c172e9,0x18001820,
-0x49402020,0x93c951a1,0x62458b69,0x730772e7,0x6ac87308,0x83697ae8,0x7b078349,0x83274981,0x10000000,0xa4705207,0x5a256aca,0x834a8b6a,0x51e39c2c,0x5a0549a3,0x5a255a05,0x7b2a6286,0x834a6226,0x51a351c1,0x206049a2,0x9c713923,0x732b7b4c,0x62886aca,0x62886288,0x730a6288,0x8bcd730a,0x5a685227,0x41a54a07,0x522862ca,0x39656b0b,0x6aeb6b0b,0x8bce30e3,0x18603963,
-0x39603940,0x41a23940,0x49e549a4,0x49e641a5,0x6ac95226,0x41846ae9,0x41a43942,0x41854184,0x31233943,0x4a0528e1,0x520749c5,0x62ea6b0b,0x41a58bef,0x41c449c5,0x396241a3,0x72ea49c4,0x93ee7b0b,0xb5139c50,0x838dbd75,0x8bce8bce,0x83ce940f,0x5247730b,0x5a6849e6,0x41c53123,0x41a541c5,0x39643123,0x5a8841e6,0x52485208,0x39a53965,0x31443964,0x31643143,0x31643164,
-0x51e45203,0x41606243,0x51c151c1,0x41604980,0x51c15a24,0x6b073140,0x51e33941,0x41815203,0x394041a1,0x39604160,0x10005225,0x20a028c1,0x28c020a0,0x186028a0,0x20c10000,0x00000800,0x310041c3,0x5a063100,0x39204163,0x49624140,0x10004162,0x49a34183,0x20403123,0x28804122,0x5a034160,0x59e44981,0x392130c0,0x498230c0,0x51c430c0,0x41604161,0x182030e0,0x080030c0,
-0x18810800,0x00000000,0x00000000,0x00000000,0x28a01840,0x28c03101,0x7b4949a1,0x73086aa8,0x83088389,0x834972a6,0x83676aa5,0x39005a24,0x49a251c3,0x28c03140,0x292039a1,0x31202921,0x49a34182,0x62675204,0x41636ac8,0x8b498b09,0x82a68b05,0xacae9b49,0x10610000,0x31212922,0x31213984,0x41825a46,0xd591ee96,0x7b47ac8b,0x4143834c,0x30e25205,0x1000834c,0x8baa834c,
-0x62022840,0x9bcca40b,0x28808308,0x10201820,0x31010800,0x49826245,0x49617b08,0xb48f7b07,0x49c4a48d,0x39426ac8,0x61c459c4,0x832a6a45,0x6a666a87,0x62667ae8,0x7b0a836a,0x6a877b2a,0x6a496246,0x728a8347,0x498559c4,0xacd3ffde,0x6aea838d,0x83ad9c30,0x83ad7b6c,0x8beec5b5,0x6aca6b0b,0x49e75a48,0x39855268,0x41c641a6,0x52486b0b,0x626962aa,0x52075a28,0x416249e5,
-0x626751e5,0x49c649c6,0x49c549e5,0x49c54184,0x28e128e1,0x30e15206,0x39636266,0x39644184,0x312341a5,0x396349e5,0x836d6289,0x83ae5248,0x62899c71,0x838e6ac9,0x72ebd638,0x8bae6269,0xa471730b,0x9c91b554,0x5a4862a9,0x734c6aeb,0x8c2fa4d2,0x41a45268,0x41844163,0x29233122,0x39843164,0x31023102,0x29023984,0x20a028e0,0x104020a0,0x18801860,0x28e21880,0x41c53984,
-0x49a049a0,0x49c051e1,0x5a025a03,0x49a04980,0x41815a23,0x394028c0,0x49c249c2,0x418149a2,0x520349c2,0x49c249c2,0x418051e3,0x520241a1,0x41615203,0x28803941,0x18610800,0x28e13100,0x10600000,0x08000000,0x18011020,0x31003101,0x106020a1,0x10201040,0x28c01040,0x39002860,0x62243900,0x5a453920,0x30c03900,0x39013920,0x39204161,0x28c03920,0x39214161,0x310130e1,
-0x28a01800,0x00001880,0x00000000,0x00000000,0x10200000,0x52243981,0x49e35224,0x49e23941,0x52235a43,0x49c25202,0x20c03980,0x000020c1,0x00000020,0x18600800,0x20e22922,0x00000000,0x00000000,0x00000000,0x00000020,0x8baa0000,0x8bec93eb,0x10200800,0x00000840,0x08000800,0x49831840,0x41826266,0x5a4551e3,0x392051c3,0x100049c2,0x41216204,0xa42d3900,0x938a72a8,
-0xa40b9368,0x49409368,0x62036a43,0x72446203,0x6a245961,0x38c230a0,0x6a451800,0x18006223,0x5a032040,0x7ae66a84,0x8b2882e7,0x9bcb7aa6,0x6a658b48,0x62666a66,0x6aa872a7,0x6a666aa8,0x6ac86205,0x62875a46,0xc596bd74,0x8befacf3,0x5a685207,0x3923942f,0x732d3924,0x62897b8e,0xbd348bce,0x51e76aca,0x49c65a48,0x945083ae,0x732c5269,0x9430c5d6,0x4a075a89,0x41c54a07,
-0x524741e5,0x41e64a07,0x52487b6c,0x52065227,0x49e65227,0x39444184,0x31234164,0x39643122,0x41a53963,0x52275227,0x83ae5227,0x7b6d9430,0x5a894a07,0x83ce6b0b,0xacf3b554,0x5a07c5b6,0x9bcf6208,0xbd337b4c,0x6b0bb512,0x83ef5269,0x6aeb736d,0x5a8862aa,0x52475a88,0x396341c5,0x20c13163,0x312320a0,0x31214182,0x180020c0,0x6aea61c6,0x31433964,0x31233984,0x41c641a5,
-0x5a035201,0x51c249a1,0x49c03900,0x51c14140,0x41815a23,0x51e349a1,0x30e04161,0x30e04161,0x49c24982,0x28a049c2,0x49c241a1,0x520349c2,0x49c25203,0x30e11820,0x180028c0,0x20a120a0,0x00000800,0x00000000,0x00010000,0x106118c0,0x00000840,0x08000000,0x186041a3,0x49814983,0x39003920,0x940c4161,0x30e03120,0x392028a1,0x312028c0,0x39423962,0x6aa73940,0x39202040,
-0x6aa63900,0x39214961,0x20403921,0x28a13102,0x08000000,0x20c01040,0x31603140,0x39403160,0x29203940,0x108020c0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31240000,0x292220a1,0x39414143,0x49e33120,0x392041a2,0x28c23100,0x18600800,0x31003101,0x5a256246,0x62666266,0x39606246,0x38e02860,0x51a351a3,0x6a466a45,0x62022840,
-0x6a038b28,0x9b8961e2,0x7aa58307,0x830772a5,0x9ba982c5,0x28008b27,0x38e05180,0x41207ae6,0x82e59389,0x83087ac6,0x9b8a8308,0x938a9368,0x83088b69,0x6a866246,0x62676246,0x62666aa7,0x942f6aa8,0x8bad942f,0xad3483f0,0xad15b555,0x49e67b6d,0x52075207,0x94305a28,0x6b2c3965,0x9c50ad33,0x62aa5207,0x51e75a68,0x52285a89,0x7b8d6aeb,0xa4d28bef,0x398541a6,0x732b5248,
-0x41e641c6,0x39856b0b,0x31233985,0x49c63103,0x49c641a5,0x49e65227,0x49c641a5,0x49c649e6,0x9c717b4c,0x52073943,0x6b0c4a27,0x83cf7b6d,0x62ca7b6d,0x62ca39a6,0x62895228,0x9c507b4d,0x93efa4b1,0xa491b4f3,0xbdd683ee,0x6b2c41e7,0x8c0f83ef,0x398583ae,0x41c62903,0x8c2f732b,0x9cb19cb1,0x5aa983ce,0x7b4b4163,0xbd539c50,0x9c91acd1,0x52487bad,0x398541a5,0x49e63984,
-0x51e149c0,0x5a035a03,0x394051e2,0x49a04160,0x30e051c2,0x41412040,0x49a13920,0x49c33920,0x626630c0,0x28a03140,0x51c23101,0x51e149a0,0x51c251c2,0x30e04140,0x208030c0,0x20a02080,0x082018a0,0x00000000,0x08000840,0x31821060,0x41c339a3,0x290041a2,0x31401860,0x52042900,0x39214160,0x39206287,0x39014140,0x39813940,0x41a24a04,0x20a02921,0x18000800,0x5a232000,
-0x412051e3,0x51c138e0,0x38e06a86,0x59e251c2,0x080049a2,0x00000000,0x00000000,0x08200820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000800,0x290228e1,0x51c24981,0x412038e0,0x5a046245,0x00000800,0x18601881,0x41412080,0x49c249a0,0x10002062,0x10001000,0x41803901,0x52054180,0x51e351e5,0x628651e4,0x62256225,0x6a853900,0x51a26a87,0x49604940,0x30a08369,
-0x83064980,0x8b279ba9,0xac0b82c5,0xac6c9389,0x8b689bca,0x8b4ca42c,0x2000e636,0x8b487aa4,0x83078b27,0x93687ac6,0x8b688307,0x832793a9,0x72c77b27,0x5a467b29,0x6a885a26,0x5a487b0a,0x49c7836d,0x838eb4f3,0x83cf39a7,0x8c317b8e,0x41835a4a,0x416351a5,0x28e45228,0x734d9c71,0x3944732c,0x730c6acb,0x41c683ad,0x5aaa5228,0x7bae6b0b,0x39a541e7,0x736c62aa,0x6aea630b,
-0x41a55268,0x41a539a5,0x41844185,0x5a684184,0x41a549c5,0x41645227,0x51e749c5,0x41c66269,0x6aea49e6,0x83ae62ca,0x8c107bae,0x8c309471,0x5a499c50,0x5a6949e7,0x8bcf7b6d,0x94309c71,0x9c717b6d,0xbd759c91,0x08009c91,0x4a0749e6,0x49c541e6,0x49e649c5,0x49e641c5,0x51e749c5,0x5a274185,0x6aeb5228,0x7b8d734b,0xacf3d658,0xa4b17b4c,0x41c65207,0x41c65248,0x4a2739a5,
-0x62645a03,0x51e15a44,0x41604181,0x51c24981,0x5a245a24,0x51c349a3,0x414151c3,0x208049a2,0x28803942,0x18201840,0x5a0351e3,0x52015a22,0x5a0251e2,0x51e251e2,0x39604180,0x396051c1,0x62853120,0x08005a66,0x31434a04,0x39a22942,0x41a02900,0x31403140,0x39812900,0x41803963,0x7b293900,0x416172c8,0x392049a1,0x20c03100,0x398141c2,0x08000000,0x10001060,0x51c23941,
-0x62236aa6,0x7ae66a85,0x62438308,0x624359e2,0x51a26243,0x08003921,0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x20402080,0x51a15161,0x180051e2,0x496059e2,0x624472a5,0x51c26223,0x100051e4,0x00001881,0x49a241a3,0x41613940,0x6ae728c0,0x8bcb83a8,0x6a8a8baa,0x51a37b0a,0x5a046245,0x51a36204,0x5a044161,0x416151e3,0x38c04182,0x6a446a25,0x20606244,
-0x49204140,0x8b272820,0x6a236a42,0x51a059c1,0x726259c0,0xb48c72a1,0x6a036221,0x93898b07,0x93aa82e7,0x93aa8b89,0x93ca93aa,0x7b297b2a,0x000049c5,0x49e649e6,0x6aeb5207,0x8bce49c6,0x9c7149e7,0x732c9c71,0x8c10736e,0x6b0c734d,0x5205730d,0x28a051c5,0x28a228c2,0x39453924,0x62aa7b6d,0x39659430,0x736c6b0b,0x41c662ca,0x28c23124,0x52285a48,0x39c65268,0x49e64a28,
-0x49e649e6,0x41e539a4,0x49c549e6,0x49c649c5,0x49e649c6,0x49a55207,0x5a486aa9,0x5a893924,0x6b0a5a68,0x52289430,0x734d4a28,0x734c8c0f,0x6b0b4a07,0x732c62ca,0x6aeb6aeb,0xe6dabdb6,0x8c2fa4d2,0x83ae9450,0x41c64a07,0x29023964,0x41843164,0x418341a5,0x396441a4,0x52273964,0x730b3944,0x94716b2c,0x8bee9470,0x30e2b553,0x39029bee,0x5aa93923,0x49e649e6,0x20a15a89,
-0x39403940,0x41813940,0x6266acb0,0x52024160,0x51e25a23,0x5a2451c3,0x416149a2,0x180030e0,0x204030a0,0x20402040,0x52034161,0x5a235203,0x39005a04,0x62444981,0x5a024180,0x62655204,0x41c05222,0x20a04a22,0x5ac628e0,0x31605244,0x39203980,0x52025224,0x49e35203,0x184049e3,0x73086aa6,0x59c23100,0x394059c2,0x18204181,0x522249e3,0x29213160,0x184018a0,0x41204161,
-0x7b077b28,0x62845a23,0x7b276a84,0x62436263,0x8ba96aa4,0x31217ae6,0x00000000,0x00000000,0x00000000,0x41202080,0x83076a44,0x72a55a03,0x832793a9,0x62447b08,0x62444160,0x62247286,0x6a656265,0x62446223,0x39616264,0x4a033983,0x52044983,0x5a0451c2,0x51e372e7,0x5a045204,0x62676225,0x72876a87,0x6a6672a7,0x5a046245,0x62666225,0x416151c3,0x62654161,0x18601820,
-0x20200000,0x82c6b46f,0x6aa693a9,0x62657286,0x9ba88307,0x93a9ac6b,0x6a64cd93,0x6a2338c0,0x5a46a42c,0x39635205,0x396428c1,0x314441a6,0x28a128c1,0x418449c5,0x5a8a732b,0xb55462cb,0x5228734c,0x4a08acf3,0x4a287b8e,0x9c913144,0x49c58410,0x52064983,0x5a6983ee,0x31045207,0x2081c595,0x8bce5207,0x5a8941c6,0x49e65227,0x41c64a07,0x41e639a5,0x398541a5,0x41855227,
-0x31423943,0x41833122,0x41a541a4,0x41e53163,0x5a884a26,0x5a695267,0xc5d6730b,0x52479c71,0x4a0641a5,0x5a8a6b0c,0x52289450,0x41c641a6,0x9491630c,0x840f83ee,0x8c104a28,0x83ce83cf,0x28e23985,0x00004185,0x52078bee,0x28a03102,0x49e651e5,0x49c53984,0x31233943,0x9c715a88,0x6aeb28e3,0xc5b69450,0x62a95a89,0x49e73924,0x6269e69a,0x7b2c93ae,0x524841a6,0x630b6b2b,
-0x5a4449e2,0x62665203,0x49a14180,0x394041a0,0x49a128e0,0x49814140,0x41414981,0x30c04141,0x39202880,0x28c030e0,0x418149a2,0x39203940,0x49a259e4,0x288030e1,0x51c15a23,0x41604160,0x49e149a1,0x312028e0,0x62e63120,0x08405244,0x41602920,0x5a633940,0x31003120,0x31001860,0x30e13941,0x5a234162,0x39804981,0x31403980,0x39613940,0x08003140,0x18400800,0x39205203,
-0x62656244,0x6a856a84,0x72c55a23,0x626472c6,0x6a436a43,0x83277286,0x518248e0,0x00001040,0x496120e1,0x72865981,0x72a68328,0x7ac67285,0x7ae77ae6,0x72857b07,0x51c272c5,0x6aa66a66,0x6a656a85,0x5a235a03,0x41826265,0x316220e1,0x28c03120,0x30e02080,0x28a02060,0x520430e0,0x6aa76aa7,0x6a8772e8,0x8b4a8b6b,0x6226834a,0x41613920,0x49813920,0x41a149a2,0x394049a1,
-0x6a443100,0xa44a9be9,0x72a6a40b,0x410159a2,0xa42b3920,0xc550bccd,0x51a2bd11,0x6a448329,0x520551c3,0x49a449c4,0x41654184,0x49e74186,0x730a30e2,0x39645a48,0x4a075206,0xa4f362a9,0x5a694a07,0xc5b6b534,0x41a549c7,0x62aa41c6,0x72eaa4d2,0x5a686268,0x6aca5206,0x7b6c838d,0x39443964,0x62896aea,0x522762c9,0x5a685248,0x52273985,0x39845227,0x39a541c6,0x39443985,
-0x5a4649e5,0x396349e5,0x52273963,0x5a893964,0x4a076b0b,0xb533734c,0x41c649c6,0x4a07734c,0xbd757b8d,0x5a8a62eb,0x4a0749e7,0x5a6962ca,0x524862ea,0x314341e5,0x7b6c83ae,0x208120c2,0x20a13103,0x41a528e3,0x31233123,0x522749c5,0x52685247,0x62ea41e6,0xad137b8c,0xff7da4d2,0x398541a6,0x52484a07,0x39855268,0xa492732c,0x6aeaacf3,0x7b6d940f,0x62ca83ef,0x5a8941e6,
-0x31214181,0x49e241a2,0x39604180,0x20803941,0x39224181,0x49c341a2,0x18204982,0x28c03100,0x418128a0,0x49a23900,0x39201820,0x416049a4,0x390149a2,0x30a030c0,0x49c15a22,0x41804980,0x312020a0,0x41c12100,0x31403960,0x20c03981,0x4a0249e1,0x20801020,0x418128c0,0x414028e0,0x30c030e0,0x31204160,0x31203941,0x39817329,0x31002080,0x28e020a0,0x6a861800,0x49a13100,
-0x416238e0,0x6a655a03,0x6aa56264,0x62446a85,0x93ea72e6,0x72a38328,0x83268325,0x7ae68307,0x6a844940,0x8b487ac5,0x72a68307,0x938a7285,0x8b499389,0x8b4872a5,0x72a693cb,0x6a8572a6,0x72a57ae6,0x6aa672a6,0x49a272c7,0x00000021,0x102041c5,0x62442880,0x498130a0,0x30802040,0x49822880,0x7ac74961,0x7aa78329,0x83496aa7,0x5a465a45,0x396149a2,0x39204182,0x18203900,
-0x49831800,0x836aee97,0x72654100,0xac2b9b88,0x20002820,0x6a6559c1,0x72e87b09,0x62a77308,0x51e55205,0x6aa86267,0x52265a47,0x5a275207,0x51e76a89,0x520651e6,0x49c55227,0x51e73943,0x9c915208,0x49e7732c,0x51e662a9,0x41845a68,0x520649c5,0xd6373943,0x49c6940e,0x49c66aca,0x39645a69,0x5a475206,0x39643985,0x41a47b4c,0x49e649e6,0x4a0749e6,0x314439a5,0x39a349e6,
-0x398341e4,0x41a53102,0x6b0b41c6,0x52285a89,0x3944942f,0x5a8951e7,0x5a892903,0x8c103985,0x4a087b8e,0x39855a89,0x520749e7,0x49e76269,0x394328e2,0x394228c1,0x28e23942,0x51e63964,0x41844184,0x310341a5,0x5a894a07,0x62ca5269,0x8c106b0b,0x730c6b0c,0x28e3732c,0x28e35a69,0x49e85228,0x522849e7,0x7b8d6b2c,0xad34a4d3,0x9cd3a4f3,0x4a487bcf,0x396539a5,0x7b6d5248,
-0x392128a0,0x310028e0,0x52034181,0x49e349e3,0x31003961,0x416130c0,0x39413941,0x31004182,0x62665a26,0x20405a25,0x28c03922,0x49c249a3,0x392128a0,0x62444982,0x52026285,0x392059e2,0x18402900,0x31401060,0x39803140,0x62a649e2,0x49e428c0,0x184028c0,0x20a03120,0x18404181,0x20803940,0x18202081,0x6ae63962,0x20a02900,0x290028e0,0x41a341a1,0x41413922,0x5a445203,
-0x39214162,0x624549c2,0x62645a24,0x5a446285,0x6aa65a03,0x6a836a64,0x7ae57284,0x8b488327,0x82e89389,0x938a8b49,0x728693aa,0x8b488b49,0x83087ae6,0x8b697ae7,0x83498b69,0x832893cb,0x498072c6,0x6aa66a85,0x5a246265,0x00000000,0x51c31020,0x51a26a86,0x59e36223,0x72c76a85,0x6a444981,0x6a4459e3,0x82e772a6,0x6a866265,0x6aa75a04,0x5a055a05,0x62255a05,0x62656265,
-0x83077aa7,0x59c36204,0xac4d7265,0xa3c9a3a8,0xa3ea9b67,0x6a85a42c,0x49a3940d,0x49c46266,0x5a4641a3,0x49c451e5,0x62885226,0x39436ac9,0x5a066268,0x41841000,0x49e64a06,0x838d3964,0xdeb9838d,0x732cbd75,0x6aea41a5,0x394362aa,0x49c54163,0x394349a5,0x7b4c6289,0x49c63944,0x39646289,0x39433103,0x41c65a89,0x39435a48,0x41a53943,0x41a55206,0x41c539a5,0x39843123,
-0x5aa83163,0x6aea5a68,0x41c64a07,0x83ae18a2,0x41a541a6,0x49e749e7,0x62aa6aeb,0x39856b2c,0x41e74a27,0x41a63124,0x28c149e6,0x41853944,0x62883943,0x39434184,0x51e75206,0x522751e7,0x5a885a68,0x945062aa,0x20a23965,0x41a662ca,0x31453124,0x49e75248,0x41a641c7,0x6b2c3986,0x734d5a8a,0xa4d2b575,0x7baece38,0x52485248,0x5a694a07,0x312441a6,0x39a63124,0x28e33124,
-0x28c03100,0x28c03960,0x31013100,0x418128e0,0x28c21001,0x00000820,0x20804142,0x28c028a0,0x10002060,0x100028c0,0x28835a26,0x30c03940,0x498130e0,0x41614140,0x41601800,0x41604120,0x838a41a1,0x396020a0,0x39803140,0x10403120,0x31001000,0x49c21820,0x5a454182,0x10005224,0x31211840,0x310020a0,0x18602060,0x186128e0,0x21000820,0x49e228e0,0x39406264,0x28e028a0,
-0x31603122,0x20a03121,0x41a14182,0x52234a03,0x51e25a24,0x7ae56222,0x7ae67ae7,0x83068b87,0x7ac58307,0x83288306,0x9bcaac4d,0x7b06938a,0x8b498b48,0x936a8308,0x8b8993aa,0x83488b69,0x83477ae7,0x72e77b07,0x6a856a85,0x6a856a67,0x6a666aa6,0x6aa572c7,0x72a672e6,0x72c672a6,0x6a236223,0x8b487264,0x830672c5,0x7aa66a44,0x6a457ac7,0x72856244,0x6a864960,0x62455a24,
-0x836b9bab,0x62666ac8,0x51a36266,0x7b493962,0xacedb4ce,0x5a256267,0x28a05245,0x10001820,0x51e528c0,0x62873963,0x5a476268,0x7b4a5205,0x6ac88bac,0x6aa96a68,0x62a96289,0x730c62a9,0x62aa8bef,0x8bef41a6,0x5a895289,0x41853965,0x730a4184,0x416449a4,0x5a68834c,0x30c1bd74,0x5a6849a4,0x520751e6,0x41c641c6,0x49c549e6,0x49e641a5,0x316449a5,0x29013985,0x524841e5,
-0x39853985,0x52085208,0x31233144,0x732c5a89,0x62695a28,0x734c6aea,0x41c64a28,0x5a683965,0x398520c1,0x396541a6,0x28e15247,0x20a03142,0x51e63964,0x520749c5,0x6aca51e7,0x840f730b,0x9491a513,0x62ebad55,0x49e762aa,0x41a641c6,0x5a893985,0x5aeb5269,0x8c5183ef,0x6b4c7bae,0x422839a6,0x630b73ad,0x18c220e3,0x18a118a1,0x310320e2,0x206120a1,0x31243924,0x4a0728e3,
-0x082018a0,0x20c16b0a,0x00000800,0x00000000,0x18811040,0x49e530e1,0x28c04164,0x28c028c2,0x49c53922,0x416130e0,0x41421820,0x39204141,0x49c23920,0x30e03921,0x20601840,0x18403100,0x31414982,0x20c041c3,0x186020c0,0x39423924,0x31005a64,0x396028c0,0x5a445a44,0x18804181,0x20a03121,0x28c10800,0x10202080,0x31221020,0x20e21060,0x08001060,0x31201840,0x39402080,
-0x000018a0,0x00000000,0x18a10000,0x30e01020,0x62256245,0x83077ae6,0x8b477aa5,0x83288baa,0x51c16a63,0x7ac572a4,0x8baa93a9,0x7ae69c0b,0x7ac77ac6,0x7b07fef8,0x7ae78348,0x83487ae6,0x8b8993ca,0x7b288b49,0x83488b89,0x41406244,0x62246245,0x72a672a6,0x6a657b08,0x72866a85,0x51a17ae7,0x72c68327,0x7ac67285,0x728572a6,0x7ae76a85,0x59c272a6,0x83086a44,0x62246a45,
-0x62248b69,0x72c66244,0x62456a66,0x8b696224,0x51e44161,0x10006245,0x20210800,0x28a02000,0x10002902,0x5a684185,0x5a485227,0x5a0549c5,0x9c3149a6,0x39234984,0x62ca49c6,0xb554732c,0x62896aeb,0x6aca5a28,0x49e75227,0x5a4851e7,0x5a485a48,0x52078bee,0xcdf75a48,0x49e69c50,0x49c53103,0x418549e6,0x49c541a5,0x418549e6,0x28e23164,0x398439a5,0x39633164,0x7bae6b0b,
-0x6b0c736d,0x41e74a27,0x41c65248,0x41e749e7,0x41c64a28,0x8bef5248,0x398549e7,0x94503985,0x41c662aa,0x396441e6,0x41643102,0x41843944,0x49e63103,0x52065a68,0x39643964,0x52696b0a,0xa4f362eb,0x39c583ef,0x5aaa8c0f,0x4a0841c7,0x39a641c7,0x29456b0c,0x4a283165,0x29233144,0x188120e3,0x31232081,0x41a52902,0x18a13123,0x314428e2,0x52285a88,0x0000b554,0x10610000,
-0x00000000,0x00000000,0x00000000,0x08610020,0x08200000,0x31023942,0x100020a0,0x31202060,0x312141a3,0x49a15224,0x5a435a25,0x30e04161,0x28a030e0,0x5a0630e1,0x49a31800,0x18203941,0x28a03101,0x28e01860,0x20c020a0,0x41a120c0,0x49e22080,0x418028e0,0x100062a5,0x31215a43,0x28c01040,0x310228e2,0x290149e6,0x10000800,0x000018c0,0x00001060,0x08000800,0x10001860,
-0x08001000,0x20a00800,0x5a253922,0x39225205,0x41403121,0x82e772a6,0x9bca8b26,0x6a858baa,0x72a57ae5,0x8b698327,0x82e89baa,0x7ae693ca,0x93aa9bca,0x7ac69beb,0x72c56a64,0x30a05a02,0x938b6a65,0x72c68b6a,0x7ae77285,0x6a846a84,0x72a66204,0x7b086a86,0x5a037b07,0x72a57ae7,0x6a847285,0x7ae672a5,0x728593a9,0x830772a6,0x82e66a44,0x7ae78328,0x62247286,0x72c77ae7,
-0x7ae772a6,0x51c28348,0x6a8672a7,0x62665a25,0x52064183,0x62665225,0x6a637a86,0x39205a00,0x18403961,0x5a485206,0x5a4849c6,0x836a5a26,0x498151e2,0x20816a68,0x41c6732c,0x52064a28,0x28a028a1,0x628828c0,0x62886288,0x49c65206,0x62893944,0x6aeb6aea,0x6b2c6aca,0x6b2b4a07,0x730b62ea,0x49e649e6,0x49c549e6,0x5a2749e6,0x396541a6,0x5aa941c6,0x7b8d62ea,0x316541a6,
-0x524841e7,0x4a0720c2,0x396541c6,0x41c641e7,0x41c65a69,0x4a074a07,0x5a6941c6,0x734c5a89,0x39655248,0x398441a5,0xbd7441a5,0x39641000,0x730b5207,0x9c915207,0xc5b67bad,0x6b0b9450,0x736d62eb,0x41e639a6,0x4a284a28,0x736d4a08,0x6b0b62cb,0x3964ad34,0x39a53164,0x4a0739c6,0x39c63144,0x41c65248,0x49e65248,0x31443144,0x41c55228,0x20a23964,0x41c61881,0x7b8d41e6,
-0x080028e2,0x00002923,0x00000000,0x00000000,0x00000000,0x18c20820,0x20a10800,0x000020c1,0x20e20800,0x39603941,0x394049c1,0x31004161,0x41821000,0x6aa65204,0x30e04161,0x18003942,0x28e030e0,0x41832080,0x28c14183,0x31004183,0x49e33120,0x28e02080,0x08003140,0x290262a4,0x31204181,0x41a33101,0x104020c0,0x08000800,0x20c01040,0x00000000,0x28a028a1,0x10001000,
-0x624551c3,0x62446244,0x5a046265,0x62465204,0x39201840,0x83077285,0x8b8993aa,0x7b068b69,0x8b697ae5,0x8b8993a9,0x9beb8b89,0x9c0b72a5,0x72a46223,0xac4c72a5,0x830793aa,0x83498308,0x6a847ae6,0x83486243,0x8b698348,0x8b698b89,0x72a66243,0x834972e7,0x6a656aa6,0x7ac67b07,0x8b289bea,0x83078307,0x830782e6,0x8b2782e6,0x82e77a85,0x72449368,0x82e69368,0x6a647ac5,
-0x5a039389,0x5a055a22,0x62866265,0x00005a45,0x39e60000,0x728618a1,0x6a446a85,0x49806242,0x310149c3,0x522849e6,0x49c649e6,0x52275a47,0x836c72ea,0xc574836c,0x29016289,0x51e56ac9,0x51e528a1,0x72c97b4a,0x62886ac8,0x628949e6,0x62896269,0x6aca6289,0x4a074165,0x49e73985,0x49e641a6,0x49e65207,0x49c55a47,0x52275268,0x41a641c6,0x52699cb2,0x39853965,0x41c649e6,
-0x39a65aaa,0x4a2739a5,0x83ce734c,0x3985734c,0x39a53985,0x41c64a07,0x4a2749e7,0x49e75249,0x41c649e7,0x62eb5aa9,0x6b2cad13,0x5aa96b2b,0x94707b8d,0xa4f25248,0x6b0c7b8d,0x524983ae,0x4a0883ae,0x31235a8b,0x20e13163,0x314420c2,0x20c22903,0x39843964,0x39a53964,0x18813164,0x41c62923,0x18800840,0x18801060,0x52470000,0x6b0b83ee,0x5a6962ea,0x18a11040,0x10615aaa,
-0x62cb0000,0x08405268,0x00000000,0x00000000,0x00000000,0x00002923,0x00000000,0x00001021,0x00001020,0x31401040,0x49e220c0,0x39424182,0x28a049c4,0x39003940,0x206030c0,0x18003922,0x206030e0,0xc5941820,0x28e13922,0x312028c0,0x52033961,0x39403941,0x52242920,0x39a13140,0x104041e2,0x18600820,0x20c10000,0x41c32922,0x4a0441c3,0x00000840,0x20a030e1,0x5a252060,
-0x59e44981,0x5a044160,0x5a246245,0x414149c2,0x28a05225,0x7ae66a84,0x832793c9,0x72c58327,0x72c551a1,0x41608b67,0x8b8a6222,0x5a038347,0x93aa6a63,0xa42b9c0a,0x5181ac4c,0xac6c51a2,0x8b697ae5,0x83288328,0x8b898348,0x7b088368,0x832972c5,0x72c68328,0x728572a6,0x83077284,0x7aa55981,0x72657284,0x7285ac4c,0x7ae67ac6,0x8b477a85,0x93689348,0x7ac5ac2b,0x83079ba9,
-0x7ae76a45,0x10005a03,0x31012060,0x08200000,0x00000000,0x20200002,0x49806264,0x6a635a00,0x49c44982,0x51e75206,0x5a285207,0x62a95206,0x72ca6248,0x6aa96289,0x20a07b0b,0x5a4749e5,0x5a475206,0x5a475206,0x732c5a67,0x5a6862a9,0x732b7b4c,0x62696289,0x41c65a28,0x41e74a07,0x41655248,0x5a6949e6,0x396449e6,0x41a541a5,0x41c64a07,0x7b8d5228,0x4a0762aa,0x41c64a07,
-0x6b0b4a07,0x5a895aa9,0x29035248,0x52683143,0x49e641a5,0x522749e6,0x7bcd62a9,0xbd95bd96,0x732c41e7,0x3164734c,0x41c65248,0x62ca3985,0x20814185,0x182028c2,0x208030e1,0x10004163,0x20a10800,0x52063943,0x5a68732c,0x5a8941c6,0x52684a07,0x49e662a9,0x31843964,0x4a272943,0x18a139a5,0x31445269,0x08402103,0x20e218a2,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x210320e0,0x00002904,0x10400000,0x00000820,0x5aaa0000,0x08002902,0x28e11000,0x18803121,0x08201020,0x20c120e0,0x31001020,0x28a020c0,0x41403981,0x41624140,0x28e03121,0x28a028e0,0x080020a2,0x28c01020,0x20602040,0x416149a3,0x208030e0,0x83aa6ac6,0x290041e2,0x398220e0,0x49c45226,0x10004183,0x102120c0,0x18402060,0x102028e1,0x52441020,0x28a07b68,
-0x5a0349c2,0x5a2351c2,0x5a235a44,0x5a0549a2,0x28e062a7,0x626349e2,0x7ac48b87,0x6aa46a63,0x9c0b30a0,0x83488b6a,0x51e26244,0x624459e3,0x59e27b27,0xac4a7ac4,0x9bcbac4d,0x93a8a3eb,0x72e59388,0x62036243,0x83267284,0x7b068b49,0x72a55a01,0x6a457284,0x7aa69b8b,0x6a227ac5,0x6a224960,0xa40c7284,0xa3ec7ac7,0x93898b28,0x7ac49348,0x93478306,0x9bc89ba8,0x7aa49beb,
-0x51804100,0x51a059c1,0x20006203,0x208030e0,0x08200000,0x10200800,0x52032880,0x730772c6,0x30c349c3,0x39643103,0x52275a67,0x52275a68,0x7b4b6ae9,0x51e6730b,0x51c472ea,0x49e649a4,0x5207730b,0x5a685228,0x628a5228,0x6aaa5a69,0x4a2841a6,0x732c4a07,0x6b0b734c,0x5a285248,0x6aaa5207,0x520741a6,0x312351e7,0x5a4949e7,0x528839a5,0x52284a27,0x41c620c2,0x738c5a89,
-0x6b2b9cb1,0x4a275227,0x52285a89,0x83ef6b6d,0xad348c51,0xc595a4b1,0x2040b513,0x20613902,0x31643964,0x31633143,0x398541c6,0x39853164,0x4a2739a5,0x20c27bad,0x6b2b3964,0x5206a4b1,0x62886ac9,0x39c45a87,0x39422901,0x414372e8,0x31021820,0x39233121,0x104030e2,0x00001061,0x00001081,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x18a00820,0x39c51040,0x00001040,0x08001040,0x00000800,0x00000000,0x00000820,0x39631860,0x31423962,0x00000800,0x00000800,0x080018a1,0x18600800,0x41c43982,0x310128c0,0x28e13122,0x62a71860,0x10001880,0x39201860,0x28a02880,0x392049a2,0x28c049a2,0x39613100,0x39803140,0x20a03140,0x184028e0,0x18611840,0x188020c0,0x186041c1,0x08000000,0x18201000,0x390028a1,
-0x51e349a1,0x41603920,0x51e35a24,0x51e46285,0x10005a66,0x72e65203,0x6a436a84,0x838893c9,0x31005a43,0x41405204,0x62655a03,0x62445a03,0x7ae64981,0x8b687284,0x83277ae5,0x9bc99be9,0x83278b68,0x6a827b07,0x93ab72c5,0x38e08328,0x62049bcb,0x6a44936a,0x6a447ac4,0x82e7936a,0x936a9369,0x82e58b47,0x7aa47ac4,0x82e56a22,0x93879ba9,0x93679368,0x51609ba8,0x7aa472a6,
-0x7ac67aa5,0x8b488b88,0x8b698b48,0x83688bca,0x6a8772c7,0x6aa63123,0x390030e1,0x8b678b49,0x62436223,0x49c26285,0x52055a47,0x72ea5206,0x940e5a06,0x9c505a27,0x51e54164,0x5a485206,0x49c65a68,0x49e6730b,0x520851e7,0x52285a69,0x6aeb4a07,0x62ca83ce,0x49e741a6,0x52085228,0x39655a27,0x49e66289,0x52275207,0x732b5207,0x41a58c0f,0x7b6d5268,0x7b8d20a2,0x83ee5227,
-0x31846b2b,0x83ce41a5,0x5268a4b2,0x41a449e6,0x100028c1,0x414351a3,0x8bad7b0a,0x834cb4f2,0x52484185,0x398449e6,0x526839a5,0x52695a89,0x7b8d62ea,0x39a59470,0xad5441e6,0x7b2a6ac9,0x6a886267,0x41a462c8,0x18402901,0x49a33900,0x416249a4,0x28c06ac9,0x08203963,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x08000000,0x18c12902,0x00201881,0x00000800,0x08000000,0x08200800,0x08001040,0x18401840,0x20e01860,0x18c00800,0x006018a1,0x00000000,0x31440840,0x00001080,0x00000000,0x08200000,0x08001882,0x20802060,0x28c02080,0x39403100,0x392028a0,0x28c03921,0x20a030c0,0x41c13141,0x186041c2,0x52223980,0x28e049e1,0x08003120,0x10600000,0x38e12020,0x414172c8,0x6a655a24,
-0x6ac66202,0x628551c2,0x5a445a44,0x414251e3,0x41a349c3,0x622428c0,0x8b8a72c7,0x73077b28,0x522249e0,0x49825223,0x59e44982,0x412030c0,0x624451e2,0x62656225,0x62246a65,0x9bea938a,0x93cb93a8,0x93899beb,0x7ae56a84,0x62048347,0x59c04960,0x6a437282,0x7ac68b28,0x51607aa4,0x8b279388,0x83069baa,0x93a959c1,0x8b48ac2c,0xa3e99ba9,0x72848306,0x8b487aa4,0x61e26a64,
-0x93899369,0x93aa93aa,0x938a938a,0x8b8b8bcc,0x838b940c,0x5a026ac8,0x59e04100,0x726159c0,0x72207aa2,0x6a247264,0x416251e4,0x5a055a26,0x49647aea,0x52066aa9,0x52274185,0x49c6940f,0x5a685228,0x7b6c6aeb,0xc575730c,0x6b4c6b2b,0x31445228,0x4a283965,0x41a641a6,0x5a495248,0x5a685227,0x6aeb5a68,0x49e6bd75,0x41a549e6,0x51e749a6,0x5a8951e7,0x41a51040,0x4a273164,
-0x840e39c5,0x5a892923,0x7b8d41c6,0x62eb5aaa,0x83efbdd6,0xb5b5942f,0xbd749cf2,0x7b2ca491,0x8c2f7b4c,0x312349e6,0x39a59450,0x20e220e3,0x62eb0000,0x00001061,0x10610000,0x41225183,0x414251a4,0x28a04162,0x20401040,0x51a25183,0x49834140,0x20406285,0x00000000,0x00000000,0x08400000,0x080020a1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000800,0x00000000,0x00001040,0x08000000,0x00000000,0x18201000,0x08001880,0x290020e0,0x18801041,0x08400820,0x4a460840,0x41e50000,0x00000820,0x00000000,0x00000000,0x08000000,0x20a01020,0x100028a0,0x30c02080,0x28a030e0,0x30c028c0,0x28c12080,0x10401840,0x20c11020,0x41c24202,0x10604a04,0x39820000,0x63085267,0x51e51862,0x51a27b49,0x72a66a85,
-0x6a6572c6,0x72e672c6,0x39205a24,0x39205203,0x310041a1,0x520428c0,0x41815224,0x39823100,0x310041a3,0x290018a0,0x41210800,0x6a875a03,0x6a875a24,0x49a26aa7,0x6a666a66,0x6a447b08,0x72c6ac6e,0x72a66a64,0x59e272c6,0x6a656a64,0x5a036aa5,0x39005a23,0x72a56222,0x9c0a7264,0x6203cd70,0x834859e1,0x6a858369,0x6a648328,0x30c04140,0x200030c0,0x62244944,0x412059e3,
-0x6a4259a0,0x7ac56a63,0x6aa638e0,0x5a255a25,0x5a056aa7,0x5a046a67,0x726249a0,0x82e58ac4,0x7ae482c4,0x61e37ac5,0x49c55a06,0x5a2672e9,0x5a27accf,0x49c55a48,0x730b942f,0x4a074185,0x5a896b0b,0x4a075248,0x41a64185,0x41e64a07,0x5a486269,0x5a685228,0x41a44165,0x39643102,0x41e66289,0xcdf662ea,0xe6b9de78,0x836bb532,0x942d62a8,0x730be6b8,0x6aeb5228,0x6aea62ca,
-0x62ca5a48,0x5a491020,0x5a895228,0xb534838d,0x94505207,0x9470ad33,0x7b8d28e2,0xad133164,0x94501040,0x18803124,0x00003144,0x00000800,0x00000820,0x00000800,0x00000000,0x49a251e4,0x31003961,0x28a03101,0x30a02060,0x49625a04,0x18404141,0x41831000,0x41603941,0x49834980,0x49814161,0x10404982,0x41813120,0x49e628c3,0x52265206,0x00006b0a,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20810000,0x20a11000,0x08000800,0x00000820,0x08001020,0x00000800,0x18e10000,0x00000000,0x08201062,0x10600840,0x08200800,0x10210820,0x18201020,0x28a01820,0x28a030c1,0x204028a0,0x204030c1,0x18001000,0x00001000,0x00000840,0x08202920,0x106041e1,0x00000000,0x00000000,0x49a20800,0x30e03941,0x6a656a85,
-0x6a857b07,0x728559e3,0x6a656a85,0x52045a44,0x5a244181,0x310049c3,0x31002080,0x28e05201,0x31223120,0x4a060820,0x39600800,0x6a866a86,0x72c85a03,0x5a2472c8,0x62046225,0x626559c3,0x41416265,0x41405a04,0x5a0372a5,0x10400800,0x00000020,0x00000000,0x39631880,0x51c23940,0xa46d59e3,0x39205a23,0x49a24161,0x59e27b08,0x496038e0,0x30a03920,0x72a759e3,0x8b8b7287,
-0x7aa69bea,0x72837aa4,0x5a236223,0x62246a44,0x62456265,0x51e36244,0x9bea93eb,0xa3cbac0b,0x93cba3eb,0x414193cb,0x62484122,0x5a2849a6,0x52256289,0x6b0b5a89,0x7b4c6b0b,0x6b0b9c70,0x5a697b6d,0x39859c71,0x62895207,0x5a684a06,0x52285a68,0x628941a6,0x838d8bce,0xacf2bd54,0x730b8c0e,0x62895a68,0x738c41e6,0xb5349450,0xb533a4d2,0x39649cb1,0x83ee5a69,0x72e941e5,
-0x28a05205,0x20a04184,0x41843943,0x49a55a27,0xcdf62081,0x10402103,0x6aea4a06,0x292320c2,0x20a118a1,0x00001020,0x00200000,0x00000000,0x10610000,0x00000000,0x00000000,0x18a20000,0x08400800,0x10405207,0x51a33100,0x38c14102,0x49646a67,0x38e038e0,0x49814140,0x392051c2,0x39213900,0x49833920,0x5a064182,0x51c36247,0x73094982,0x08003984,0x28e03121,0x6a226a64,
-0x00000800,0x00000000,0x00000000,0x08000800,0x20c24a07,0x00000800,0x10201840,0x18801861,0x08001020,0x00000000,0x08402103,0x08000000,0x08000821,0x00000000,0x08200000,0x10601020,0x08002923,0x08000800,0x28a01000,0x18403121,0x28e22060,0x08001000,0x08000800,0x10210800,0x00000000,0x00200841,0x00000820,0x00001080,0x00000000,0x31201000,0x59e33920,0x7b076265,
-0x72e66ac5,0x72e75a23,0x72c67b07,0x626572e7,0x5a6449c2,0x41813100,0x398041a1,0x52433960,0x106028c0,0x00201060,0x30e10800,0x6a876ac7,0x72e87b49,0x62655a45,0x5a0451e3,0x5a035a05,0x620459e3,0x498159a2,0x31213940,0x00000820,0x00000000,0x00001881,0x18410000,0x51e34100,0x5a035a03,0x51a451c3,0x416151a3,0x72a77ae8,0x93a97ae8,0x51e26a84,0x28603900,0x28a07ac7,
-0x30c01820,0x83688348,0x41205a03,0x5a024160,0x6aa66a86,0x59c46a66,0x41217ac8,0x62257287,0x30c03920,0x7b0851c3,0x5a0772eb,0x524862aa,0x5a895a69,0x52483144,0x6b0b8bef,0x5aa98bee,0x62eb734c,0x83ae62aa,0xa4b2838d,0x7b8e4a06,0x9cb262cb,0xa4d29c91,0x8c0f7b6c,0xc5f7b554,0xa4b2734d,0x5a694a07,0x83ce6b2c,0x52686b4c,0x5aca5aa9,0xb5534a07,0x7b6b5226,0x41414162,
-0x6a664123,0xa44f730a,0x5a2741a4,0x3102d617,0x28c149c5,0x28c10800,0x4a491040,0x4a275aaa,0x104028e2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08001040,0x30c020a0,0x518330c0,0x20402000,0x49603900,0x28a051c2,0x5a444161,0x49a26265,0x39213900,0x100028a0,0x10001000,0x00001820,0x7b6a5a25,0x73067328,0x6ae66ac5,
-0x00000000,0x20c20800,0x10001860,0x39641840,0x08001020,0x080018a2,0x10200000,0x31421881,0x08000800,0x08200800,0x18a21060,0x00000000,0x104010a1,0x00000000,0x00000000,0x00000000,0x10400000,0x10000000,0x18401860,0x20802080,0x00001861,0x00000800,0x00000000,0x00000000,0x00000000,0x10610820,0x10400000,0x08203143,0x10000000,0x51c249a1,0x38e03921,0x7b087b09,
-0x51e36a85,0x72c67b28,0x7b077b07,0x72c76a85,0x6ae672e7,0x41813961,0x52423960,0x41a149e1,0x28e03100,0x51e349a3,0x5a454182,0x49a251e3,0x28805a25,0x41824162,0x5a0451e3,0x51a35a05,0x59c359e4,0x39006a45,0x39426264,0x00000800,0x080020a0,0x10600840,0x10002080,0x49a13921,0x6aa651e3,0x72a76266,0x6aa55a04,0x59e36a65,0x620459e3,0x5a047b09,0x7ae830c0,0x4161ac6e,
-0x30c051c3,0x5a046266,0x41206244,0x5a034140,0x8b6a72e7,0x59c34982,0x5a464141,0x414349a4,0x836c5a47,0x6aa95206,0xf75c5a89,0x4a079c71,0x4a0749e7,0x5a694a07,0x52274a07,0x52484a07,0x52489450,0x62eb5a89,0x732c7b6d,0x524939a5,0x4a285aaa,0x5aa9a4d2,0x8c0fa4f2,0xa4f38bef,0x39a67bae,0x6b0b1061,0x210320c2,0x08001881,0x29241061,0x20c11040,0x624618a0,0x20007ac7,
-0x62224921,0x626838c0,0x08003922,0x00003144,0x102018a1,0x00007bae,0x00000000,0x00000000,0x00000000,0x08000000,0x00000000,0x00001000,0x4a070000,0x39431881,0x100028e2,0x00000000,0x00000000,0x00000000,0x20a00000,0x41404120,0x18004120,0x624630c2,0x414072c8,0x41414141,0x310028c0,0x41a228e0,0x08002060,0x5a424980,0x08016aa3,0x31011020,0x312349c4,0x18601040,
-0x08400000,0x20c00000,0x08201060,0x18610800,0x08000820,0x18601840,0x00000000,0x312320a1,0x00001020,0x08000000,0x08200820,0x000020e3,0x00000000,0x00000000,0x08410000,0x00000000,0x00000000,0x10001800,0x18201840,0x00001840,0x00000841,0x00000000,0x00000000,0x08000000,0x00000800,0x00200000,0x00000000,0x00000000,0x51c21061,0x51c259e1,0x5a024141,0x39212020,
-0x51e15a22,0x7b068368,0x6a446244,0x73076ac6,0x62866285,0x730730e0,0x20a05a23,0x39203140,0x51c33120,0x51e451e3,0x18406266,0x5a036224,0x00005a24,0x18400000,0x392128a0,0x286030c0,0x5a032000,0x5a2751c3,0x080130e0,0x18003923,0x39404183,0x28a04182,0x51e43941,0x414051e3,0x51814140,0x62226203,0x620459e2,0x5a046245,0x5a246265,0x5a066a65,0xa44d5a66,0x41206a86,
-0x41416224,0x51a351a3,0x59e59bed,0x6a4551a2,0x5a256266,0xac8f6a85,0x6aaa8b8d,0x4a077b0b,0x62ca5248,0x734c83ad,0x41e66aea,0x52285a69,0x52695aaa,0x62aa83ce,0x6aeb734c,0x83cebdb5,0x39654a07,0x522862aa,0x4a07a4b2,0x41a62903,0x39651820,0x39a53144,0x947020e2,0x7bf05aaa,0x100118c2,0x28c20000,0x10001840,0x182130e2,0x00000000,0x00000040,0x93cc0000,0xb46d8b07,
-0x40e07243,0x51c26a24,0x080059e5,0x18414987,0x00000021,0x00000000,0x10410821,0x28a11000,0x310230e2,0x4a061020,0x41c35245,0x08002081,0x20c20000,0x20400001,0x08001840,0x00000000,0x00000000,0x00000000,0x30c00000,0x412038c0,0x30414160,0x28402801,0x31204120,0x208028a0,0x18812080,0x082049c3,0x59c04982,0x62016221,0x308051a0,0x10202860,0x00200001,0x00000820,
-0x08200840,0x08000000,0x08001860,0x08000800,0x08000800,0x18401000,0x08001881,0x00001061,0x08200840,0x00000000,0x10611060,0x08200000,0x00000840,0x00000000,0x00000000,0x00000000,0x08000000,0x18201820,0x08001840,0x00000800,0x00000000,0x08410000,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x08000000,0x49a149a4,0x624451c1,0x51e34980,0x6ac672c6,
-0x49a05202,0x51e351e2,0x30e06aa6,0x62656285,0x41835a45,0x30c049a4,0x5a663100,0x184041c1,0x5a443961,0x310051e2,0x5a446aa6,0x5a246244,0x49c25a45,0x52036264,0x62645a23,0x6a846264,0x414051a1,0x49a14982,0x31223921,0x5a041820,0x31005a24,0x41a32080,0x49a349e4,0x62454961,0x6a446245,0x62225a03,0x59e251a0,0x51c251c1,0x5a046245,0x6a8951a3,0x5a476267,0x6aa749e5,
-0x7b4b6ac8,0x31026268,0x310049a2,0x51a46246,0x49c57b2b,0x6ac95226,0x732bde78,0x3144734c,0x49e65227,0x41a562ca,0x5aa962ca,0x4a077bad,0x730b5207,0x41c541c5,0x52472902,0x39643984,0x4a073144,0x49e74a07,0x20a2732c,0x28e320a2,0x18c228e3,0x000031a5,0x18a20820,0x00000800,0x08000000,0x31022081,0x39234185,0x00002081,0x08003965,0x00000000,0x10a00800,0x08201040,
-0x08200000,0x08204a26,0x000028e2,0x08000000,0x51c628a1,0x394230c1,0x392141a3,0x18811060,0x10600000,0x41831000,0x20402040,0x28800000,0x93699c0c,0x10609c4e,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x18001000,0x10015a27,0x49a33943,0x20422860,0x18402081,0x00000000,0x08000000,0x49802060,0xac8c7ae6,0x18006264,0x00004161,0x08010000,0x10200000,
-0x39850820,0x10600800,0x29203161,0x20a01060,0x39831020,0x28e028e0,0x08001040,0x00200000,0x31850000,0x00003165,0x08200000,0x10600000,0x10200800,0x00000000,0x00000000,0x08000800,0x10000800,0x10001020,0x08001820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18010000,0x49c14141,0x62246222,0x72c751e0,0x418151e1,
-0x39403940,0x62866244,0x5a4549c3,0x5a2451e3,0x6aa85a46,0x30e130c1,0x08004160,0x41a041c1,0x52224a01,0x51e251e2,0x52235223,0x51e351e3,0x59c149c2,0x5a236a23,0x6a876266,0x72a76a87,0x72c67ac7,0x30e05a03,0x20a12882,0x51c26248,0x30c04160,0x31003962,0x49c31860,0x51a14981,0x72854980,0x6a446203,0x6a266a45,0x6a466a47,0x5a0472e7,0x6a898329,0x52285206,0x5a475207,
-0x72ea6aea,0x416593ef,0x51e641a5,0x9c2facb1,0x10000000,0x41855207,0x524841c5,0x4a074a27,0x524862ca,0x52683985,0x39853985,0x4a0641a5,0x41643943,0x4a262901,0x20e04a26,0x7b6c2922,0x7b6d49e6,0x10402903,0x08005228,0x00001061,0x00201060,0x00200000,0x00000020,0x00000800,0x00000000,0x41832080,0x30e13943,0x00201820,0x00000000,0x7b6d0020,0x20c141c6,0x00000000,
-0x00000000,0x41443982,0x10003942,0x00000000,0x10000000,0x49631841,0x080030a1,0x08201800,0x00000000,0x39840000,0x39851881,0x93ca30e0,0x8305aca9,0x00000821,0x00000000,0x416328e3,0x6a876267,0x72c849a4,0x726382c4,0x82e26a20,0x49a26a00,0x28c028a0,0x10204182,0x08001000,0x00010000,0x00210000,0x72e81860,0x30c06244,0x10004140,0x63075a4a,0x4a244a44,0xbd527349,
-0x08200000,0x08201060,0x29220800,0x20e04a05,0x28e028e0,0x184028e1,0x10600800,0x00002924,0x00000000,0x08200000,0x10201040,0x00000820,0x08000000,0x08200800,0x00000000,0x00000000,0x08000800,0x10200000,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x49a23983,0x5a2349a1,0x62646265,0x49804160,0x51e26265,
-0x49c251e2,0x5a446265,0x30e051e3,0x51e33101,0x208041a2,0x522530e0,0x41c40800,0x62c520a0,0x41c04a02,0x62655a23,0x5a245a24,0x39205a24,0x5a035a03,0x6a8449a1,0x6a646244,0x6aa56aa5,0x624472c5,0x49a05a01,0x62643900,0x72c56222,0x51c26242,0x41a24980,0x41823961,0x59e551c4,0x51e46225,0x62466246,0x51c46225,0x51c35204,0x49c451e4,0x62675a47,0x838d7b2a,0x6ac9942f,
-0x6aaa49c6,0x8bae93ef,0x736c83ce,0x41c66b0b,0x41a66b0b,0x49e65a89,0x4a075aa9,0x398439a5,0x41a45246,0x39633942,0x41c45226,0x31423142,0x28e220a1,0x52273143,0x10603143,0x49a51840,0x1081a4d2,0x00000840,0x00000000,0x00001882,0x39a518a1,0x00000820,0x20c20821,0x08000000,0x00000000,0x00000000,0x00000000,0x18202081,0x08002080,0x28e11020,0x29020800,0x08003122,
-0x00010840,0x000039a5,0x30c030a0,0x49e451e5,0x08202901,0x18200800,0x10400800,0x7b485225,0x93ca9c2c,0x49805a24,0x416049a0,0x51e53920,0x5a036ae8,0x30e05245,0x10201000,0x39841000,0x08000000,0x93a98bab,0x8b479ba8,0x9bc99bc7,0x000030a0,0x00000000,0x00000000,0x31230000,0x62c93964,0x7b497ba9,0x5a637348,0x73076aa7,0x62a76264,0x39435286,0x288128e2,0x00000800,
-0x08010000,0x08200820,0x00000800,0x18601040,0x20800800,0x080028e0,0x20a11880,0x00000800,0x00000000,0x08000000,0x08210000,0x00000000,0x08000000,0x00000800,0x00000000,0x00000000,0x08000000,0x08201020,0x08410000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29200000,0x41a03140,0x5a2349a1,0x41806a85,0x51c24180,0x520351e3,
-0x49a25203,0x20805a44,0x5a064162,0x52036265,0x29001860,0x31021840,0x20a020a0,0x39613141,0x28e01020,0x5a244980,0x5a455a24,0x416172e7,0x41601820,0x5a025202,0x5a024140,0x51e14960,0x6a846263,0x28a04981,0x7b2872e7,0x62226a64,0x62246222,0x418059e1,0x39413960,0x62056246,0x51e251a3,0x5a055a04,0x6a876266,0x834a4983,0x51e649c4,0x41845a26,0x6aca93ee,0x62886aa9,
-0x52075227,0x730b28c2,0x4a0641c5,0x316449e6,0x4a075268,0x4a0749e6,0x524841e6,0x626741a5,0x49834183,0x39214162,0x29012080,0x62aa5a69,0x20c20800,0x4a070000,0x00000000,0x18a11040,0x00000000,0x00000000,0x00000000,0x00001040,0x08000000,0x208028a0,0x49c41800,0x498328a0,0x000041e6,0x00000000,0x10000000,0x10000800,0x39013101,0x10001000,0x08000800,0x18413965,
-0x30a05a23,0x49a40000,0x51e449a3,0x10002041,0x10000000,0x8b6861c1,0x18404142,0x08001800,0x10001020,0x5a240800,0x39234183,0x730a2060,0x49a17bab,0x104051e3,0x08000800,0x08002040,0x41401800,0x5a0230e0,0x83256a62,0x51a37ae3,0x00001000,0x00000000,0x00000000,0x520420e2,0x30c13900,0x41631020,0x41833943,0x102030e0,0x30c00000,0x10202040,0x10001000,0x08001000,
-0x00002903,0x00001060,0x29420800,0x18a00000,0x188120e0,0x20c11040,0x00000800,0x18601880,0x08000820,0x000020e2,0x00000800,0x00000000,0x10610000,0x00001881,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28e00000,0x31211020,0x394028e0,0x394049c2,0x396049e2,0x39403940,0x49a15a23,
-0x51e35a24,0x51e34161,0x5a2449a2,0x41a149a2,0x31212920,0x10205a66,0x29012080,0x396128c0,0x39403962,0x31004182,0x31214182,0x41a40820,0x62843100,0x51e23100,0x39203920,0x41603940,0x51e05a02,0x59e24140,0x5a014980,0x5a0251c1,0x49a030e0,0x6aa549c0,0x416051e3,0x5a255a05,0x6a876266,0x5a456a86,0x628751e4,0x72ea72e9,0x6aca7b6c,0x6aa962a9,0x5a48730b,0xacf27b6c,
-0x94705a68,0xf75cb554,0x3984bdd5,0x18803143,0x31233102,0x52263143,0x39854184,0x9bcc5a45,0x41005162,0x100038e0,0x00000000,0x00000800,0x00000000,0x00000000,0x622459e4,0x498272c7,0x08000800,0x08001020,0x49c01880,0x51c23900,0x5a274143,0x51a35a07,0x51e42880,0x20803921,0x5a4741e3,0x5a0493ed,0x5a043901,0x7b297b4a,0x5a248bea,0x6aa751e3,0x00003920,0x00000000,
-0x1800bd71,0x30e01800,0x30c01820,0x93cb72c6,0x61e57288,0x20206206,0x10001820,0x49c25a04,0x52015202,0x10200800,0x10001000,0x08000000,0x08010800,0x51c50800,0xacaf6a89,0x9c2ea48f,0x28a07b29,0x20201820,0x20012020,0x10002040,0x288051e3,0x10006225,0x08000800,0x10001000,0x18402880,0x08000800,0x10005a66,0x10000800,0x7b0730e4,0x496172c6,0x59e25a03,0x414051c1,
-0x08000000,0x084018a0,0x10602102,0x18c01060,0x080020c0,0x4a061861,0x08000000,0x08001860,0x080020a0,0x00001860,0x29230820,0x00000000,0x08400020,0x00000840,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x184020a1,0x28e03120,0x31203961,0x49a15a45,0x39403960,0x418130e0,0x5a446285,
-0x39203940,0x51e330e0,0x51e34181,0x39605a24,0x18603141,0x18403101,0x10201000,0x49e34a05,0x28c04182,0x20a030e0,0x28c020a0,0x7b6b20a0,0x49c17308,0x41814181,0x20402880,0x28a04160,0x51a051a2,0xd5b0b4ad,0xddf3d5b1,0xf6d7ddf3,0x7b06d5d2,0x62644160,0x39205a03,0x51e55a25,0x49e551a4,0x6287732a,0x49e66ae9,0x62a95226,0x5227732b,0x52065206,0x394349c5,0x522741c5,
-0x18a14185,0x62ea4a27,0x4206736c,0x18a11040,0x08003944,0x00000820,0x00000000,0x7a6651e4,0x82a57246,0x518240e0,0x00210000,0x206020a1,0x102041c5,0x49831840,0x30a07ae8,0x41215a24,0x49a128a0,0x20404982,0x30e22041,0x51e338e0,0x51e21000,0x20603120,0x28a06267,0x49641020,0x18602061,0x10001000,0x28e01860,0x18203961,0x39041800,0x18011000,0x9c2f2060,0x49c29c2e,
-0x00001800,0x30602000,0x8b486a64,0x9bea4120,0x72a38325,0x832559e0,0x72e88367,0x622693cb,0x200038e0,0x30e01800,0x41611000,0x41841020,0x7b456a43,0x83a562a4,0x39006261,0x49624161,0x93ca51c3,0x10004941,0x18001820,0x28a06aa4,0x6a653901,0x8b498327,0x20207ac7,0x5a682021,0x732962a8,0x6aa66285,0x51a06a64,0x59e059c0,0x518072a3,0x49806222,0x5a0151c1,0x5a0351e1,
-0x08201040,0x080018a0,0x00000000,0x00000020,0x29020800,0x08000800,0x00000000,0x10601880,0x39c51880,0x18200800,0x08000820,0x082041e6,0x00000000,0x00000000,0x00000000,0x00000000,0x084110a2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10400000,0x28e03141,0x394041a2,0x31004181,0x41813961,0x31003940,0x418230e0,0x51e349c3,
-0x49a24161,0x49a24161,0x52034181,0x102041a0,0x41831860,0x18614a04,0x184028e1,0x39603140,0x204020c0,0x72e93940,0x310041a3,0x39403120,0x30e02080,0x28a030e0,0x416128a0,0x312030e0,0x59c14140,0x518030a0,0x82c882e6,0x7b088329,0x83656244,0xb50f8369,0x51a26ac6,0x6ae84161,0x5a476267,0x4a075a68,0x5a686b0b,0x396441e6,0x31023102,0x10204163,0x186041e3,0x31646aeb,
-0x18a02060,0x08000800,0x10600820,0x08000800,0x41a33101,0x00003144,0x29021880,0x5a24940c,0x82e94960,0x59e15181,0x00204162,0x30c10800,0x28804162,0x30e11840,0x10001800,0x8b2a1840,0x18803900,0x28200800,0x100083aa,0x49816223,0x30c072a6,0x39604163,0x414483c8,0x28801000,0x39021800,0x100030e1,0x39204161,0x41605a24,0x622251a0,0x62226a83,0x5a435a02,0xbd117b0a,
-0xc5517b27,0x7285a42a,0x8b6851a1,0x8349ac8d,0x6a253060,0x28603880,0x93ca1000,0x39203080,0x72a559e2,0x51c16223,0x51c05a02,0x6aa44180,0x72856223,0xa42c8b89,0x830682e6,0x10006a84,0x18001800,0x1800a3ca,0x51a02860,0xbc4d7a62,0x72639364,0x7b088b48,0x51c24941,0x100051e6,0x08001000,0x5a460800,0x61e040e0,0x518151a0,0x20802000,0x28801840,0x39202000,0x30a02880,
-0x28e220c2,0x18401860,0x08201880,0x00001040,0x08001021,0x08401080,0x20c218c0,0x00001841,0x10401040,0x08200000,0x00000000,0x00000000,0x08200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000020,0x08200000,0x00002902,0x28c120a0,0x28c02900,0x41813120,0x39613100,0x31203940,0x41813920,0x30e05a25,
-0x39205a04,0x394051e3,0x5a2428a0,0x524551e4,0x184020a0,0x102018a0,0x10201860,0x396141e1,0x28c03141,0x418141a1,0x20a041a2,0x102041a2,0x20601840,0x41624983,0x310030e0,0x080030e0,0x59e30800,0x6a448348,0x7ac782e7,0x6a448b29,0x6a816222,0x6a2261c1,0x51a29bc9,0x49e441a2,0x5a476268,0x39645206,0x39a53144,0x314341c5,0x28e13122,0x082041a4,0x00000800,0x08000000,
-0x29002040,0x20a03102,0x208049c4,0x49615204,0x208049a3,0x10000800,0x626630a0,0x28a00800,0x7a85a44c,0x7a848b06,0x18607ac6,0x41a30800,0x30e06265,0x7b4a7b4a,0x100093ab,0x392072a6,0x00001000,0xac8b6245,0x18007b08,0xa44c6225,0x7b088bca,0x39021820,0x8b8b59e4,0x8b6a6245,0x288072c7,0x20203901,0x30a030c0,0x5a0128c0,0x62214980,0x8b474980,0x492251a2,0x624351e0,
-0x72c34120,0x51e251e0,0x6a234940,0x72c26a81,0x38e059e0,0x41407ac8,0x5a016a64,0x10007ae7,0x62036225,0x5a034961,0x30c038e1,0x49414960,0x39003920,0x20201800,0x51606203,0x61e059a0,0x6a2161e0,0xb48a7283,0xa3a88ae5,0x934782e1,0x6a40d52f,0x7a854100,0x41415182,0x6ac67b09,0x93887b06,0xb48ed5b1,0x8ae5cd31,0x6a217aa4,0x61a07282,0x6a017262,0x51a069e1,0x72a559c1,
-0x18400822,0x18401040,0x290020a0,0x186020c0,0x10200800,0x08001000,0x20a01000,0x394320a1,0x08201860,0x20e01060,0x00000000,0x00000020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x18800000,0x8bce28e1,0x20406b08,0x18c02080,0x41e239c1,0x39a04a02,0x396041a0,0x39423961,0x28e03941,0x49c24160,0x49a24160,
-0x5a043100,0x624528c0,0x51c351e3,0x28e049e4,0x41e520c0,0x20801000,0x20c02080,0x28a03142,0x41603140,0x49a051e2,0x30e13920,0x31003100,0x41831820,0x39202000,0x52023960,0x7b47a46d,0x7ae58327,0x726472a4,0x8ae661c1,0x72457a86,0x726382e7,0x72a572a4,0x93cc6222,0x62463960,0x39455267,0x20a24185,0x10201860,0x28c13984,0x20801000,0x000020a0,0x31215207,0x28a03100,
-0x496272c7,0x38c03900,0x412051a1,0x6a6638e0,0x180059c3,0x51a34160,0x41201820,0x49621840,0x93674100,0x82e72820,0x9bc96a62,0x5a025a02,0x59e07245,0x284072a6,0x08004980,0x41405184,0x62241800,0x18001000,0x20402060,0x7b054942,0x9b875140,0x51807aa3,0x49804120,0x5a4251a1,0x6a855a02,0x72c76247,0x62234981,0x20207ae7,0x38a03080,0x61e03080,0x72817ae3,0x100172a5,
-0x20631020,0x51c05a44,0x6a836222,0x59e06a64,0x72a57263,0x7b098329,0x62216243,0x7ae86a45,0x93c88327,0x8b267ac5,0x59c17a83,0x6a416a23,0x180059c4,0x18404140,0x496030a0,0x7a817a82,0x20007aa3,0xa408fef8,0x8ae48ae4,0x69e09345,0x72417241,0x18007242,0x08201000,0x30a00801,0x72806242,0x6a207a61,0x72415960,0x7a8269e0,0x72637a82,0x49006223,0x598061a0,0x59a05160,
-0x10001020,0x28c11880,0x31400800,0x102020c0,0x18401880,0x18603123,0x28e01020,0x20a03141,0x20e020a1,0x39a31041,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00200861,0x00000000,0x00000000,0x00000000,0x41e50000,0x100028e1,0x18601860,0x39a03140,0x39a03180,0x31404a42,0x41c141c1,0x394141a2,0x39403120,0x52234181,0x392049a1,
-0x41613940,0x52245203,0x52246286,0x28e01880,0x080020c0,0x28e01000,0x4a0449c4,0x52043120,0x49a141a0,0x41a04181,0x30e04160,0x312028a0,0x39211820,0x5a244140,0x41805a23,0x7ae55200,0x7aa572a5,0x7a856a23,0x72649389,0x6a236202,0x61e359e1,0x72a46a64,0x49815a02,0x7b083921,0x10000800,0x18401840,0x100028e0,0x62661000,0x52051000,0x49c23120,0x31015a44,0x6a8751c5,
-0x08000800,0x100030e0,0x7b4949c3,0x49602820,0x51a16202,0x62234960,0x6a8551a0,0x5a0272c6,0x620159c0,0x7a855180,0x49606200,0x72836a63,0x61e06a21,0x38e04960,0x28804140,0x59e26222,0x72a37284,0x30c05180,0x62431800,0x59e18308,0x5a246245,0xa4086a85,0x7ac42020,0x51817ac4,0x38c04100,0x62214101,0x59c051a0,0x59e06a41,0x7aa37281,0xd56fa3e6,0x7261a3e9,0x59c06a84,
-0x83254140,0x6a655a05,0x49416a64,0x6a644100,0x30806202,0x59e14140,0x59e051a2,0x62246a63,0x410251a4,0x72217a83,0x82e47a82,0x62015160,0x7ae47284,0x83057ac3,0x830582c5,0x8b0482c4,0x59c15160,0x93a8ac4d,0x93668b25,0x9326a3a8,0x8ae69b88,0x308059c2,0x100030e2,0x51c12080,0x83076241,0x72225160,0x69e07241,0x72427242,0x490061e0,0x61a082e6,0x51605120,0x7aa35180,
-0x10201000,0x41a21840,0x20a13961,0x398128e0,0x10202080,0x290128c0,0x31201040,0x31011840,0x104020a0,0x20a01040,0x086131a4,0x00000000,0x00200000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18e00000,0x08403981,0x20a01840,0x18c00800,0x18802100,0x18802901,0x312020e0,0x39803980,0x31003940,0x39403941,0x49a14161,0x51e349c2,
-0x51e35a44,0x52656285,0x28e028e0,0x39623141,0x00001880,0x396028c0,0x28c128e0,0x396041a0,0x39203120,0x416149a1,0x310049c2,0x28e028c0,0x49c3834a,0x49806244,0x72e351e0,0x72848326,0x82e77a85,0x830882e7,0x83087b07,0x7ac88309,0x6a836a85,0x83066202,0x62026202,0x498338e0,0x49c03900,0x51c56ac5,0x62832040,0x72c63941,0x390051a2,0x28602880,0x286049a2,0x492038a1,
-0x59806a41,0x49206a41,0x72829348,0x7a828b24,0x62007aa1,0x59a04920,0x62655140,0x834859e2,0x72827aa4,0x492061c1,0x51a159e0,0x7a837262,0x6a008283,0x7ac56201,0x49407285,0x7aa46220,0x6a208b26,0x412059a0,0x51a04940,0x6a426a43,0x49004920,0x49807243,0x72821000,0x6a416a00,0x6a416a41,0x6a435181,0x7aa461e1,0x7aa382e5,0x7a6182c0,0x93859322,0x72628b44,0x49a05a00,
-0x49c038e0,0x498049c1,0x49804940,0x59c059e2,0x6a425140,0x6a224980,0x49606a61,0x72466a64,0x72845982,0xa38682a3,0x6a007a60,0x518159e0,0x6a027a84,0x59e061e0,0x62217242,0x7a6382c5,0x622161c0,0xb4ef4920,0x728351a0,0x8b037240,0x51a08b02,0x306030a0,0x416038e0,0x49814960,0x518051a0,0x5960d5f1,0x6a016a00,0x8ae57a84,0x28008284,0x7a634100,0x51405980,0x72827263,
-0x080049e6,0x28c11821,0x18211820,0x20a21020,0x28e120a0,0x31422080,0x08003100,0x18a03983,0x28e01021,0x31231020,0x00000800,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x62a60861,0x5a864182,0x62c79c4f,0x29202080,0x29402920,0x20e020e0,0x31603181,0x4a2239a0,0x4a0339c2,0x39204161,0x520451e4,0x5a245203,
-0x5a655a04,0x41e35245,0x20c01860,0x08201880,0x10403142,0x31423140,0x312020a0,0x41813120,0x62434180,0x5a4351c1,0x390051c2,0x41a13120,0x39403140,0x6a833940,0x83466a83,0x8b4872c4,0x82e88b28,0x82e682e7,0x72c57ae6,0x418051c1,0x41205a23,0x49406201,0x49406a42,0x49406200,0x72a630a0,0x414072c6,0x28a072e6,0x418051e2,0x5a225a03,0x62237285,0x38e05180,0x41405a02,
-0x72618b45,0x598082c3,0x8ae56a00,0x82a17a81,0x72409b85,0x8b0482e2,0x51a15960,0x6a444960,0x6a0082c4,0x61a082a3,0x598038c0,0x61c07a62,0x9b4682a3,0x30604920,0x72834980,0x6a425160,0x51404940,0x6a233040,0x51602000,0x494061c0,0x49407285,0x59a16a05,0x38c06a23,0x7aa361e1,0x59a07283,0x62017283,0x61e259a0,0x61a082c3,0x59807a83,0x82e37240,0x8b057aa1,0x5a017282,
-0x49406202,0x51c051a1,0x59c16222,0x59c14100,0x620251a0,0x496051a0,0x49204120,0x6a227ac5,0x49207aa6,0x92e48b04,0x8ac39325,0x516061c0,0x72a451a0,0x72a34120,0x72416a40,0x7aa382c4,0x59807a83,0x518151a0,0x41003860,0x72a16a22,0x49206a42,0x51a16a62,0x62224980,0x49406a83,0x51804980,0x6a227ae5,0x7aa369e1,0x61a07261,0x6a427262,0x72419368,0x72417222,0x72427242,
-0x18201800,0x28a11020,0x102028c2,0x08001841,0x31221840,0x208041c4,0x08003100,0x39c20000,0x00003142,0x00000820,0x10000820,0x08001020,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000,0x52463142,0x00000800,0x00003962,0x49c45a87,0x7b885225,0x20e03141,0x10402920,0x000020e0,0x316018c0,0x31803160,0x41823140,0x49c151e3,0x72c76aa7,0x4a045203,
-0x28c05205,0x18803140,0x292020c0,0x29210800,0x104020c1,0x28e041a2,0x396041e0,0x49e23980,0x6a856244,0x6a8472a6,0x414049c1,0x31205223,0x39403960,0x7b055a82,0x7ae77ac6,0x7b077ae7,0x5a416a84,0x72e46242,0x41c051e0,0x5a2230e0,0x62414180,0x518061e1,0x8b0572a4,0x6a446a01,0x93e94120,0x62025a00,0x38e06202,0x41806264,0x7aa36a04,0x5a0038e0,0x5a215a20,0x30e03920,
-0x82e27ac2,0x6a007aa2,0x828282a1,0x9b049303,0x8b03ac07,0x8b039344,0x516082c1,0x59c261a2,0x82e46a01,0x61e07261,0x6a2261e0,0x72616a00,0x72207a61,0x72427a41,0x72826202,0x6a014900,0x72625980,0x6a2159a0,0x61e051a0,0x40e05180,0x59c25180,0x40e059e0,0x51805160,0x61e161e1,0x6a217242,0x61c06a00,0x59c06201,0x61c07a83,0x51407aa3,0x7a8161e0,0x82e461c0,0x7aa26200,
-0x61e07261,0x51805160,0x5a024120,0x62006a22,0x72627a83,0x724261c0,0x49207242,0x62207aa5,0x51a07284,0x598082e5,0x728182e4,0x72627aa3,0x49406201,0x6a415180,0x59e06a40,0x59e07aa3,0x51a072a3,0x6a6282e6,0x59c06201,0x514159a0,0x8b4759c0,0x59c051a0,0x61e159c1,0x72a559c1,0x59e072c5,0x726372a4,0x7a835960,0x82a37a44,0x61e07a84,0x61c061e0,0x8ae661c0,0x82c59347,
-0x18601000,0x29001840,0x08002080,0x102020c0,0x08001040,0x6b090800,0x28e03123,0x28c02900,0x00001000,0x10000800,0x08001860,0x00000820,0x00000000,0x00000000,0x00000000,0x00000000,0x08200000,0x62a649e3,0x08003101,0x62a94a26,0x28e020a0,0x5a651840,0x418149c2,0x83a89c4b,0x52233140,0x29203140,0x31603140,0x41c12920,0x61e44981,0x7ae76224,0x6ae86aa7,0x41a349e4,
-0x312020a0,0x18803121,0x188020c0,0x28e00800,0x206028c0,0x5a634a01,0x5a8349e0,0x6aa56ac5,0x6a645204,0x5a236223,0x62836263,0x62624160,0x396041c1,0x62a46ac5,0x62226a84,0x41606a83,0x49c03940,0x83665a21,0x5a0072e4,0x51e049e0,0x72c36a83,0x59a07ae3,0x6a0169e2,0x518182c3,0xb4894100,0x7aa472a1,0x6a614940,0x5a0138e0,0x51604920,0x6a618304,0x73036a61,0x6aa14180,
-0x728072e2,0x7aa36a20,0x7aa27240,0x82a182c2,0x82c19ba4,0x8ae37220,0x6a2182a2,0x38a06a23,0x7a634940,0x72416a21,0x61c082c4,0x8ae47221,0x8ae469e0,0x82a371e0,0x72215180,0x724161c0,0x61c05980,0x8ac48ac4,0x59c061c0,0x51206a00,0x7a637a62,0x82a44900,0x598069e1,0x82c359c0,0x8b047a62,0x61807a82,0x82827200,0x6a217221,0x7a4269e0,0x82a39b46,0x7aa27a62,0x726182c2,
-0x59607a82,0x41205180,0x59c06a42,0x598061a0,0x82c361e0,0x6a427aa3,0x620059a0,0x6a2261c1,0x51a05180,0x49407262,0x72626a41,0x82e46a20,0x51a07243,0x59c05a01,0x6a826201,0x51c051c0,0x59e16a83,0x624159e0,0x7ae38b44,0x61c17240,0x8b446a20,0x59c07aa3,0x51606242,0x51a059e0,0x49405180,0x72645160,0x82c38b05,0x51807263,0x934861e1,0x8b0482a5,0x93067221,0x8ae461a0,
-0x08001020,0x20801840,0x49e220a0,0x312020a0,0x184030e2,0x10403142,0x18401880,0x20801840,0x49e549c5,0x20a02901,0x10401000,0x10000800,0x00200000,0x00000000,0x00000000,0x49e43962,0x4a045a87,0x39615203,0x20c02900,0x31411040,0x28e049e3,0x49e341c3,0x6ac53120,0x52425a62,0x52233960,0x294041a1,0x39802100,0x51e149e0,0x6aa651a1,0x7b288369,0x41e35a44,0x18600000,
-0x398241a2,0x080041c3,0x00001880,0x312220c0,0x520330e1,0x4a005241,0x52215220,0x5a436ae5,0x62856a86,0x624462a5,0x6aa472e5,0x51e16283,0x41806242,0x6ac341a0,0x49c04160,0x41a05221,0x52006ac2,0x51e149a0,0x72c25a01,0x6ac249e0,0x7ae37ae4,0x726259e1,0x61c07221,0x6a417220,0x38e061e0,0x6a61d5ad,0x8343b4a9,0x6a8351a0,0x59e06201,0x8b447a81,0x6220a3e7,0x62606240,
-0x7aa27b24,0x61e07282,0x6a008b03,0x6a208b43,0x7ae17ae2,0x72808303,0x620072a1,0x38c059a0,0x59606a43,0x722059a0,0x8ae482e3,0x72407a61,0x7a4161a0,0x7a617241,0x61c07281,0x7a8282c3,0x69c07aa2,0x69e08ac4,0x51606a20,0x7a817a64,0x51206a00,0x82a35160,0x620161c0,0x6a206a21,0x82c37a82,0x7a6269c0,0x594082c3,0x61e07242,0x61a05980,0x82c282a2,0x93459324,0x7aa17261,
-0x7aa27a81,0x7aa27261,0x726161a0,0x82a38263,0x61808282,0x8b0482a2,0x82a38ae4,0x6a018b04,0x7aa382a3,0x49407ac4,0x59c082e4,0x6a4261e0,0x59c061e1,0x38c059e0,0x6a826202,0x7b0451c0,0x7b0472c3,0x72c16a42,0x59e06221,0x93647a83,0x934682c4,0x598061e1,0x6a445181,0x7aa57285,0x72827aa4,0x514069e1,0x72207a63,0x6a007a62,0x59a04080,0x6a009326,0x93277221,0x51208283,
-0x184028c0,0x41a11880,0x28e028c0,0x20801820,0x31011840,0x10001840,0x18201000,0x28e03141,0x28c020c0,0x394028a0,0x31003100,0x18202080,0x00001820,0x00000001,0x39413100,0x5a055205,0x52045a26,0x210141c1,0x30e10000,0x31012080,0x28e03942,0x10002080,0x41a03140,0x31402920,0x31404a01,0x312041c1,0x41e039a0,0x5a225a62,0x7ae76243,0x6ae66284,0x28e049c6,0x208028e0,
-0x4a053981,0x20613141,0x08001000,0x080028c0,0x41a02880,0x52226283,0x52225a62,0x6ac66ae6,0x49a13920,0x41803940,0x49c06aa4,0x6a824160,0x51c16a62,0x62a349e0,0x418049e0,0x5a205a63,0x62a26ac3,0x6a6149e0,0x72828304,0x7ac26240,0x72a472a3,0x728261c1,0x72408303,0x7ac27a61,0x8ae372a1,0x72406a00,0x7aa07240,0x51a07aa2,0x6a2259c0,0x6a007241,0x83228b24,0x5a008b84,
-0x61e06200,0x9bc69385,0x7aa27aa1,0x83029385,0x62208323,0x72a172a1,0x83035a00,0x6a416220,0x518082e4,0x82c27261,0x93448b23,0x72408ae3,0x61a05980,0x82c27a61,0x6a407ae2,0x61e06a20,0x82a27aa2,0x828369e0,0x51807260,0x72415980,0x82a29b45,0x72008ae2,0x59805940,0x61c061e0,0x6a0082c3,0x8ae38ae3,0x93257261,0x7a817aa1,0x6a007240,0x6a2082e3,0x724061e0,0x72608b23,
-0xa3c661e0,0x8b029345,0x72009326,0x93247a61,0x82828aa3,0x7240a365,0x82a17240,0x82c38ac3,0x8ac38282,0x69c061c0,0x72217241,0x59a161e0,0x5a004960,0x622159c0,0x49807ae4,0x72e46a61,0x5a0151e0,0x72a25a40,0x6a4151a0,0x72a28303,0x61c07282,0x59805120,0x41004901,0x624351c0,0x83478346,0x72826202,0x51208283,0x7a418282,0x72a27220,0x8b0459c0,0x8ae57a82,0x8b059327,
-0x18601840,0x208020c0,0x18404181,0x20a01000,0x41a23941,0x28e049a3,0x310020a0,0x100020a0,0x20801841,0x18403941,0x20a028e0,0x20802080,0x00002080,0x08005225,0x49e43962,0x49a351c3,0x49c249c3,0x49e36285,0x28e041c2,0x28a03100,0x312049e3,0x28c020a0,0x29003980,0x31403980,0x316041a2,0x39a03140,0x41e041c0,0x6a8441a0,0x73076284,0x18403941,0x39423140,0x08001840,
-0x20c041a2,0x31203962,0x41803940,0x20a01820,0x39204180,0x418041a0,0x31004160,0x394030e0,0x5a424160,0x52006282,0x6ac351e0,0x51e07b25,0x414072c3,0x5a623100,0x73025200,0x6ac262a0,0x73035200,0x51a051e0,0x62009386,0x8b667282,0x83266a82,0x59e06201,0x7ac430a0,0x8b458b46,0x726159a0,0xb465a406,0x7aa0a3e4,0x6a628b04,0x82c36a61,0x6a207240,0x9bc682c3,0x6a608343,
-0x6a2159e0,0x7aa359c0,0x61e06a20,0x936359c0,0x832293a4,0x83438343,0x6a4072c1,0x83028323,0xa3e772a1,0x7a408ac2,0x8ac269e0,0x9b859b65,0x8ae29b84,0x82c28ae3,0x8b448b43,0x9ba57ac2,0x8b228303,0x72617a81,0x83017ac2,0x8b2382c2,0xa3859b45,0xa3a69b43,0x82a1a385,0x8b049325,0x82a282c3,0x6a207a61,0x8b048b03,0x8b048b24,0x82e28b43,0x9b848b22,0x934382e2,0x7ac09364,
-0x82e361e0,0x72608b23,0x82829323,0x82a282c2,0x8ae38b04,0x932482e3,0x8ac38ae3,0x9b459325,0x82a28282,0x7a829325,0x7aa361c0,0x7ac47aa2,0x61e082e2,0x83037281,0x62207ae3,0x626172c2,0x5a007b24,0x9bc86aa1,0x83447ae3,0x59c07282,0x51407ac3,0x72439327,0x496182c6,0x38e038e0,0x7ae55182,0x82e651a0,0x8b259366,0x82c47aa3,0x51808ae4,0x6a206a21,0x72209b87,0x7a808ae3,
-0x18401860,0x28c041c1,0x186028c0,0x18011000,0x28c02080,0x28c11820,0x206030e2,0x28e020c0,0x18401000,0x31013120,0x28811840,0x10001800,0x08001000,0x52055245,0x51e449c3,0x51e349c3,0x41a14182,0x49e25203,0x20a03960,0x41a26ae7,0x49e241a2,0x396049c1,0x39a141e0,0x39a12900,0x41a03160,0x4a203980,0x4a2041e0,0x62635a62,0x20a05222,0x28c02080,0x18803121,0x28e02920,
-0x208041a3,0x208020a0,0x31003100,0x312041a3,0x49c04160,0x6aa45a22,0x51c049c0,0x41805a01,0x5a625a21,0x62815240,0x628151e0,0x72e449a0,0x6a826240,0x49c05a60,0x83654140,0x8be67b01,0x8b855a60,0x8b6572e2,0x8b668b66,0x8b2693a7,0x41406221,0x30c051c0,0x620238c0,0x59c02000,0x82c37aa2,0xf68f6a00,0x72217240,0x7ac38b03,0x82e38324,0x82a27a81,0x726182a2,0x62216200,
-0x72836a22,0x7aa47262,0x9b877aa2,0x6a408303,0x72a06a80,0x6a807b01,0x72a06a60,0x59c08322,0x6a009bc7,0x92c392e3,0x92e392e3,0x9b656a00,0x93639b84,0x82e29324,0x72816220,0x8b226a40,0x83428322,0x8b648322,0x8b648322,0x82e28b22,0x7a6071e0,0x9b648ae2,0xa3a49322,0x7a8292e3,0x93248b03,0x72408b24,0x82e37aa1,0x69e082e4,0x8b228b02,0x934382e1,0x8b029b84,0x82e182e1,
-0x69e09b85,0x82e382e1,0x932482c1,0x93449323,0x6a207ac2,0x8b047aa2,0x82a37a82,0x8ae38ac4,0x7a417220,0x93259345,0x82c39b86,0x61e06a40,0x8b027a80,0x72a17aa0,0x6a617ae2,0x7b2359e0,0x51c07b03,0x59e051e0,0x6a616a41,0x82e559c0,0x59809367,0x59805140,0x410061c1,0x5a014940,0x49806226,0x726159a0,0x7ae46a41,0x83058305,0x8b268305,0x596082e5,0x61c082c2,0x72206a01,
-0x394030e2,0x28c03140,0x20801820,0x396120a0,0x18403120,0x31212080,0x20801820,0x10201020,0x10001000,0x20801040,0x28c228e2,0x08001020,0x18801000,0x5a466287,0x52055a25,0x498351c4,0x49c34182,0x49c241a2,0x522349e3,0x08003961,0x310028a0,0x41813960,0x4a023980,0x31803120,0x52633180,0x52204a00,0x49e149e0,0x41815241,0x28c02900,0x31001860,0x290020a0,0x20803120,
-0x30e128c0,0x28c020a0,0x49e13100,0x398041a1,0x52023920,0x730549a0,0x49a06283,0x51c05201,0x72e451c0,0x6a826262,0x6a826aa2,0x83655a00,0x51e16241,0x51e15a21,0x5a0059e1,0x6a806a80,0x83648342,0x6a618364,0x72a38b45,0x6a6359e1,0x832693a8,0x62427ae5,0x6a627ac4,0x7aa43900,0x59a051a0,0xcd2cb429,0x8b036a00,0x6a416200,0x83047261,0x7aa27261,0x61a06a20,0x72407242,
-0x7a627242,0x82838262,0x7a828ac3,0x93647aa2,0xa363a3c4,0xab84aba4,0x8b43a343,0x6a609be6,0x93029364,0xa36592e2,0xa3458a61,0x8260a365,0xa3a5a3a5,0xac268ae1,0x8b027a80,0x59c082c2,0x72817ae2,0x8b638323,0x7b008302,0x8b037260,0x61c07261,0x8ae29b85,0x9b849342,0x7a80a3c5,0x83239343,0x83047281,0x72826200,0x59a07281,0x82e26a40,0xa4068b42,0x9be56a60,0x7ae172a0,
-0x72a08b63,0x9ba68ae3,0x6a209364,0x8b2382c2,0x82e282e1,0x8b2382a2,0x6a207a81,0x726182e3,0x61c07240,0x72207220,0x93239b85,0x9b669b85,0x93658b24,0x83437240,0x72c259c0,0x5a0072a2,0x624051c0,0x62206200,0x6a606240,0x6a218b23,0x82a361e0,0x69e17a82,0x62005980,0x49403080,0x40e04920,0x7ae76203,0x6a432000,0x6a839389,0x622072a3,0x82e37a82,0x7ac282e3,0x72838305,
-0x28e028c0,0x30e02080,0x20802080,0x100028a0,0x39632900,0x20c00800,0x31203100,0x31403981,0x28c03120,0x20c020a0,0x39611860,0x18803141,0x312030e2,0x41a23120,0x49c45225,0x41614181,0x39614161,0x49e43961,0x416149e3,0x39605a43,0x39804180,0x396041a0,0x31603140,0x52833960,0x316041e0,0x524262e4,0x6ac662a3,0x31204a01,0x31413140,0x41c328c0,0x28c020a0,0x310028e1,
-0x39613962,0x49c028c0,0x6ac228a0,0x5a833980,0x41404160,0x49a06264,0x83478ba8,0x498049a0,0x5a215a23,0x72e56262,0x7b264140,0x39005a01,0x51a17b26,0x62635a21,0x496038e0,0x7b219c05,0x62616260,0x7ae34160,0x59e08304,0x72837ac4,0x72638326,0x62214100,0x59e16222,0x59c059e1,0x59a04940,0xa3a7b44b,0x82c3c4ab,0x6a4161e0,0x6a216a20,0x7a837a83,0x7a8361e0,0x7a617242,
-0x8aa37201,0x82837a62,0x82829324,0x93247aa3,0xa3a49b83,0xabc5abc5,0x8ae2b406,0x7a807ac2,0xa3428ae2,0x92a1a323,0x92e3a345,0xa3849303,0x61c09323,0xa3c58b02,0x9b648ae1,0x69e082e3,0x8b246a00,0x8b427260,0x83027ac0,0x6a206a40,0x72417a82,0x7aa07221,0x8b438300,0x936482e1,0x8b2382c1,0x82e48303,0x7ac359a0,0x6a408b24,0x72a07281,0x8b439383,0x7aa18341,0x7ac18322,
-0x72a08b43,0x72409364,0x9bc59ba5,0x934382e2,0x8b237a80,0x9344a3e7,0x93449344,0x936382c2,0x9b849ba5,0xac068b03,0x93439344,0x93437260,0x82e08b03,0x7ae28b24,0x62207ae1,0x7b038323,0x8b645a00,0x8b667ae3,0x9be88326,0x93677280,0x6a006a60,0x7a8261e0,0x830561c0,0x410059e1,0x6a4538c0,0x49804960,0x39013900,0x20208328,0x41205a42,0x59c059e0,0x72616a41,0x93667ac4,
-0x31213960,0x28c028a0,0x28c02060,0x184030e0,0x28c020a0,0x30e041a3,0x28c04181,0x30e03940,0x28e01000,0x290028e0,0x312028e0,0x39613141,0x51e420a0,0x394149e4,0x41a24181,0x49c349a2,0x41624141,0x41824162,0x39605202,0x49c05202,0x49e041c0,0x49c049c0,0x41c03980,0x49a041c0,0x52006ac4,0x5a8241a0,0x41c16ae4,0x41a149e2,0x30e04182,0x51e428a0,0x28a02060,0x39205204,
-0x83893920,0x49c049c1,0x5a6249c0,0x49c049e0,0x62424160,0x51a051e0,0x39203920,0x49a04160,0x620251a0,0x6a8159e1,0x49408b46,0x6a826a63,0x51a05a00,0x49606222,0x83457ae4,0x59e07ae3,0x83237ae3,0x62216a62,0x59c259c0,0x59e159a0,0x516059a0,0x49406a22,0x518038e0,0x82e56a20,0x61e04960,0x83047a61,0x61e0ac08,0x6a22a3e8,0x59c06a01,0x7aa47243,0x6a027262,0x72417221,
-0x82a47221,0x828382c3,0x8ae59324,0xa3647a41,0x9aa1b381,0xabe4bbe6,0x8ae2ab63,0xa3859302,0x92e19b43,0xbc489300,0x72409302,0x8b028261,0x72608b22,0x82a07a80,0x7aa07a60,0x93646a20,0x7aa17260,0x7a806a00,0x7aa08b42,0x62006200,0x598069e0,0x8b238b03,0x8b239ba5,0x82e282e1,0x82a28b03,0x82a27a61,0x82e382c2,0x832459e0,0x72a16a60,0x82e172a1,0x7a808b42,0x8b4261c0,
-0x6a4082e1,0x8b039b85,0x6a2072a0,0x9b847ac0,0xac079325,0xa3c682a0,0x82e26a00,0x8b018b23,0x8ae182c1,0xb4089343,0x93439363,0x93449b85,0x93649343,0x830293c6,0x83638302,0x8b2382e2,0x8b4661e0,0x7ac482e3,0x518059a0,0x59a06a41,0x93247a62,0x82a27a82,0x82828ac3,0x7a839325,0x722282c4,0x59c161e0,0x38c038e0,0x49604140,0x6aa54100,0x830572a3,0x83047282,0x83058b46,
-0x31023122,0x28a03101,0x31002080,0x31003100,0x28a03121,0x62a63121,0x41623960,0x41832080,0x20a028c0,0x312028c0,0x28c041a2,0x28e05a65,0x5a6628e0,0x418241a3,0x41a249c2,0x49a24161,0x41624161,0x49c24182,0x49c15203,0x522149a0,0x524162a3,0x52415241,0x49e05240,0x6ac46ae2,0x5a426283,0x39805202,0x314041a1,0x208041a1,0x28e04181,0x28a03100,0x28e03962,0x39405223,
-0x41803920,0x49c049e0,0x6ac35a41,0x51e141a0,0x412051c0,0x7b266221,0x49a05a42,0x49805a21,0x62224940,0x51c06a63,0x59e04980,0x72c56242,0x38c06a62,0x49606a63,0x620059a0,0x936659c0,0x830459c0,0x51806a42,0x728559a0,0x516051a0,0x61c05140,0x59a15140,0x40c01000,0x7aa461e0,0x6a414140,0x8b047a82,0x59606180,0x59c05180,0x62015160,0x61e16a02,0x61a17262,0x8ac37a83,
-0x61c07a82,0x6a0069c1,0x8b047a41,0xa36482c3,0xffff9b64,0xb3c3ff97,0x93029b42,0xa3659b64,0xbc488280,0xa345c487,0x72616a00,0x82c22800,0x72606a20,0x93439ba4,0x8b429343,0x6a207aa0,0x6a007aa1,0x8ae28ae2,0x932282c1,0x93658b43,0x7260ac28,0x62009343,0x93457261,0x59c07260,0x7a416a00,0x93047a61,0x9ba57240,0x8b4472c1,0x6a406a20,0x93638b44,0xdd6c7a80,0x62009323,
-0x8b437ac2,0x8b2382c1,0x72a193a5,0x82c19365,0xa3a67a62,0xac079b64,0x83029ba6,0x93449ba5,0x93449323,0x93458b22,0x83037260,0x8b238b23,0x9ba69b64,0x726059c0,0x83028b23,0x82a48ae3,0x7a817241,0x59c06a20,0x498051c0,0x61c06201,0x8ae47a83,0x72009325,0x82828aa2,0x7a627240,0x69e069c0,0x38e07282,0x39002860,0x59e34961,0x624451a2,0x72836a62,0x72c28304,0x7ae38b65,
-0x20801020,0x20601840,0x206028e0,0x20a01840,0x41a23120,0x28e12080,0x31203100,0x41844182,0x28c041a0,0x20a028a0,0x39603120,0x104062a6,0x51e54163,0x312141a2,0x51e35203,0x52035a23,0x51e349c3,0x51e46265,0x49c351e2,0x39805a84,0x49e04a00,0x49e041a0,0x520062a2,0x5a615221,0x52213120,0x498249a0,0x30e06285,0x100049e2,0x51e53920,0x28a04164,0x41613900,0x31005a23,
-0x626451e3,0x52203100,0x62a23940,0x41406a82,0x72a56aa5,0x6a8359e0,0x51c05a21,0x518051c0,0x62006a42,0x93a86221,0x518051c1,0x62226201,0x620159a0,0x59c04940,0x6a4259e0,0x6a416221,0x6a417aa3,0x51606201,0x7aa56a62,0x59807242,0x7a617242,0x6a227a62,0x6a2351a0,0x6a014900,0x69c08242,0x61807200,0x8ac48283,0x722361a0,0x69e06a01,0x82c559c0,0x7aa47aa5,0x8ae48b25,
-0x7a838283,0x72426a01,0x61c07221,0x9b446a00,0xffdfabc5,0xb3e5fff9,0x8ae39ba3,0xac08a3a6,0xb4077220,0xe54e8280,0xaba69366,0x728461a2,0xa3e59342,0x9b848b02,0x8b218b01,0x93a48b21,0x8b227280,0x7a8082c0,0x9b84a3a5,0x72a07ac1,0x72807a80,0x82e29363,0x6a007a80,0x8b229365,0x82a16a20,0x9b648ae2,0x82c19323,0x72819384,0x82e272a1,0x9b859383,0x82e3a3a7,0x8b649ba6,
-0x8b23a407,0x93868302,0x8ae37a81,0x93458ae3,0x932269e0,0xabe9bc49,0x72207260,0x93228b02,0x93229343,0x82e38b03,0x61c08b02,0x61e06a60,0x62207281,0x59a06200,0x8ac36220,0x72217a82,0x51407a62,0x7a6282e3,0x62408b27,0x6a226aa3,0x7a417281,0x72009b66,0x93258ac2,0x82827a41,0x8ac58aa3,0x494061a1,0x49a13080,0x59c36224,0x49604961,0x7ac359e0,0x62008324,0x7ac16200,
-0x18201840,0x18200800,0x20a01820,0x39411000,0x28e028c0,0x49a43923,0x100028a0,0x28e02080,0x41823120,0x28e03101,0x396128e0,0x18603121,0x39222080,0x28e120a2,0x62655203,0x5a255a25,0x5a666286,0x52040000,0x418041a1,0x39403960,0x73063120,0x5a615202,0x49a14180,0x5a4349c1,0x418049c1,0x49a15a45,0x5a2449a2,0x392120a0,0x28a04182,0x392030e0,0x49c23941,0x392049c2,
-0x6aa53920,0x49c14180,0x72e63901,0x62417b04,0x6a836263,0x6a825a00,0x62416240,0x6aa26aa2,0x59c051e0,0x62216221,0x622259e0,0x6a4259c0,0x518059e1,0x62006a42,0x59e07282,0x728251a0,0x59e08b25,0x494059c0,0x8b2751a0,0x6a0161c0,0x82a17200,0x82838261,0x51807a83,0x59c13080,0x72217a62,0x82a382a3,0x598061a0,0x61a06a00,0x61a06a00,0x72627261,0x6a426202,0x7a427283,
-0x82a382c4,0x7a6382c4,0x82838ae5,0x8ae44900,0xa3868280,0xb42869e0,0x8ae49b23,0x932561c0,0x384082c3,0x93456a00,0x9b2540c0,0x6a019b45,0xa3c740a0,0x93439b84,0x82e17aa0,0x7ac09bc4,0x83226a40,0x7ac08b62,0x8b236a40,0x8b439bc5,0x82e17ac0,0x82c27260,0x93639363,0x93439342,0x93037aa1,0xabc59302,0x9b439302,0x6a407ae1,0x7ac17ae1,0x7a807261,0x7240a3c4,0x6a20ac06,
-0x72817281,0x8302a3e6,0x728172a1,0x8b026a00,0xb4686a40,0x82e17260,0x8b44a408,0xa3e69386,0x83027260,0x6a206a20,0x72426a00,0x82e482e2,0x62007ae3,0x59e07261,0x8ae382e4,0x82c282c2,0x72408b03,0x93256a00,0x51804920,0x72836a61,0x69e08b23,0x7a219326,0x92e592e4,0x72008ac3,0x7a417a40,0x6a4161c0,0x308059a0,0x496051a1,0x30804940,0x72a359e2,0x82e48305,0x72a16a20,
-0x208020a0,0x28811820,0x394228a1,0x28e028e0,0x20802080,0x30e11000,0x30e028e0,0x41a12060,0x30e01860,0x28e030e1,0x290020a0,0x28c020c0,0x18401860,0x52253981,0x52035a24,0x28c04160,0x18801000,0x20c03121,0x394120a0,0x524128e0,0x41805202,0x39604181,0x28a03100,0x416128c0,0x414128c0,0x28a13921,0x18602880,0x39602080,0x28a028a0,0x49a13920,0x5a443921,0x390049e2,
-0x49c15a24,0x310049a1,0x49c07b48,0x7b2551c0,0x6aa372c4,0x6a6272a3,0x6a816261,0x62a16260,0x6a625a40,0x5a006a62,0x7ae46a82,0x622259e1,0x6a4151a0,0x62208324,0x59e06a42,0x59a059c0,0x72a459c0,0x6a444940,0x93685180,0x72215960,0x8ac28a82,0x59408240,0x82e66180,0x30803920,0x7a627241,0x72016a00,0x720161a0,0x61c05980,0x6a007242,0x59c06a20,0x59c15160,0x72016a21,
-0x512069c0,0x61c05960,0x61a069e1,0x69c06a01,0x61608242,0x49405100,0x8ae46940,0x82c39305,0x93487202,0x726161e0,0x69a05983,0x72208260,0x72407a80,0x8b228ae2,0x93648b00,0x8b419ba4,0x7b218323,0x93c472c0,0x83438ba4,0x72a07ac0,0x8b2282c1,0x8b237240,0xa3e782e1,0x72606a00,0x72009344,0x8ac1bc68,0x9b439b43,0x8b438b62,0x61e08320,0xc4cb6200,0x82e18b03,0x7ae27a80,
-0x9bc68303,0x8b427261,0x72a18ba5,0x93459365,0x7ae38341,0x72c18342,0x6a817b01,0x7ac2b4ab,0x83238b64,0x82e282e3,0x9b857aa1,0x9ba76a20,0x7ae27261,0xa4088324,0x8b027263,0x6a0061c0,0x8b039b85,0x8b049344,0x6a626200,0x728272e2,0x93057260,0x82837a64,0xaba88283,0x8ac19304,0x9b2469c0,0x93279304,0x492161a0,0x622251c1,0x728359e2,0x7aa44980,0x8b057263,0x59a07aa3,
-0x180020c0,0x41631000,0x28e01860,0x28a03120,0x20601860,0x31211840,0x31203100,0x41a33941,0x41813120,0x184020a0,0x29003102,0x186028e1,0x18201840,0x49c35a45,0x39622080,0x39413921,0x310241a3,0x20802080,0x52235a85,0x41814a02,0x39613980,0x41a13961,0x392049c2,0x52033100,0x392028a0,0x390128a0,0x30e03921,0x310030e0,0x41604160,0x49a13920,0x416049a0,0x396051c1,
-0x49c04180,0x51e25a41,0x49c04160,0x624151c0,0x622251e0,0x6a836262,0x5a0049a0,0x626172e3,0x62206a81,0x620072a2,0x6a226a62,0x59a06a42,0x7aa46222,0x6a426a62,0x6a628325,0x59e06221,0x6a627282,0x59c05180,0x8b469364,0x7a4161c0,0x82828282,0x828392e3,0x72205980,0x2880ac0a,0x932530a0,0x82a39b64,0x61805960,0x618061c0,0x514061c0,0x61c25980,0x6a4259a2,0x7a625980,
-0x7a6182a2,0x69e16a01,0x51807242,0x61c161a0,0x724161a0,0x61a069e1,0x7a825140,0x618061c0,0x59609304,0x8ae45960,0xc427a386,0xbc488220,0x93237a40,0x93428b01,0x6a607ae0,0x72c08b83,0x7a8072c0,0x83017260,0x72a07ac1,0x8b219364,0x8ba293c3,0x8b628341,0x7ac17ae1,0x7ae272a0,0x728072c1,0x72607ac0,0x7a80a3e5,0x726061e0,0x93659364,0x8b239345,0x8b039b84,0x83037aa1,
-0x6a409385,0x7ac182e2,0x7ac26a60,0x6a607ae1,0x7b027ac2,0x72c17b02,0x83246220,0x8b437ac2,0x9bc582e2,0xa3a661c0,0x82c27260,0x72619344,0x6a418303,0x83239366,0x59c09385,0x8b456200,0x62006a40,0xa3c79346,0x61e0a3a7,0x59e059c0,0x72416a81,0x82a37261,0x9b258262,0xa386a365,0x9b47a387,0x72017a40,0x59809326,0x40e06a21,0x72634902,0x7a8382e5,0x61e17262,0x59c06a41,
-0x31011000,0x31001860,0x41633941,0x28c04183,0x310128c0,0x20603941,0x28a028a1,0x28e01880,0x20a01860,0x310030e1,0x290028e0,0x184028c0,0x28e028c1,0x30e13941,0x28c020a0,0x080020a1,0x20801000,0x20c028e2,0x39802080,0x30e05a43,0x418028e0,0x5a433120,0x5a635201,0x28a05201,0x28a02060,0x10003922,0x28c03921,0x20603100,0x498051a0,0x6a854160,0x30c051c0,0x39403920,
-0x72e63960,0x30e06ac6,0x6aa449e1,0x62615a01,0x6aa36242,0x62426a62,0x626251e0,0x626151c0,0x6a6272c3,0x6a816241,0x72826a41,0x6a216200,0x6a426a63,0x620351a0,0x72a27281,0x6a6272a2,0x62206a62,0x61e16a41,0x8b2638a0,0x72205960,0x71e08a83,0x69e08aa3,0x82616180,0x730569c1,0x490028e0,0x7a627221,0x7a625940,0xa3a57a40,0x7a618b02,0x61e161e0,0x59a061c1,0x69e05160,
-0x69a06a00,0x61606180,0x59a061c0,0x51205140,0x7a415120,0x72627243,0x72207240,0x71e07200,0x720092c3,0x82808281,0x9b027a60,0xaba59ae1,0xb40682c0,0x8b427260,0x8b8372c0,0x6a6072e0,0x7a817b21,0x8b428b02,0x7a808b22,0x93219344,0x9be48b63,0x93a39c05,0x8b218b83,0x83419383,0x83218361,0x6a608b42,0x83018b42,0x8b2182e0,0x93228b00,0x82817240,0x7a817a60,0x72817aa1,
-0x62008303,0x8ae38b03,0x8b45a3e6,0x72606a40,0x6a808323,0x62408343,0x51c072a0,0x62007ac2,0x7ae39ba6,0x7a42bc69,0xc4cbac07,0x72417a81,0x51a08322,0x83036200,0x6a4082e3,0x7aa359a0,0x72826a40,0x8ae37260,0x83049b86,0x72a27ac1,0x69e08325,0x8ae482c3,0x7a408262,0x82819b44,0x69c08ac2,0x82638aa3,0x59a07a43,0x7a836a00,0x6a225120,0x82e559a0,0x51805140,0x59e06200,
-0x18201000,0x418428c0,0x18000800,0x00001041,0x28a02060,0x31212900,0x20a00800,0x28c028e1,0x39421860,0x28823962,0x10001820,0x20802080,0x30e12060,0x20603102,0x28c120c0,0x28c12060,0x20601000,0x51e441a2,0x28c049e4,0x396030e0,0x39203100,0x39603120,0x51e23100,0x390072e6,0x41813901,0x51e42880,0x416028a0,0x41603920,0x624272a3,0x624272e5,0x49a05202,0x5a423920,
-0x41803960,0x208049a0,0x39203940,0x41804980,0x72a451a0,0x5a004980,0x622159e0,0x51a059e0,0x6a6251a0,0x6a215a00,0x7ac37282,0x7a836a01,0x59a061c0,0x6a4259c0,0x72817ae3,0x72817282,0x59e051a0,0x6a0159c0,0x69e17a83,0x720061a0,0x8a837a21,0x7a417a41,0x8ae37200,0x72618aa3,0x28a04120,0x598030e0,0x8b026a00,0x930192e2,0x8ae27240,0x59a061c0,0x59c06a00,0x6a006a41,
-0x82c282a2,0x722269e0,0x61c061a0,0x492059c0,0x72217221,0x61a061c1,0x71c07a62,0x8a8269a0,0x8280a365,0x69c08240,0x9b239b01,0x93029b02,0xac2682c0,0x72809b82,0x73008b82,0x6aa07b41,0x82c06aa0,0x82c08b01,0x8b428b62,0x726082e1,0xff539382,0xa3e56200,0x9b829b83,0x83038b62,0x72607ac0,0x8b428b01,0x83018b42,0xa44772c0,0x8b228b43,0x8b039363,0x932482a1,0x8b038b03,
-0x8b037a61,0x932382a1,0x82c382e1,0x8b028b23,0x9ba56a40,0xb44782e2,0x7ae27ac0,0x6a206a60,0x72a17ac2,0x8b259345,0x82e17a80,0x62006a40,0x62007ae3,0x6a616220,0x72a26200,0xb4497ae3,0x7221b429,0x8ac27241,0x6a417a81,0x72a16a60,0x72616a40,0x93049304,0xaba769e0,0x8ae48ac2,0x8ac27a41,0x82a37a81,0x82a459a0,0x7a827a62,0x72227a82,0x72425120,0x83066a21,0x7ac37ac4,
-0x206130e1,0x5a672060,0x08001040,0x00001021,0x10400800,0x28e03100,0x20c03121,0x186020a0,0x18402080,0x31003940,0x28c128c0,0x20802060,0x28c01000,0x100028c1,0x102049e6,0x182028c1,0x41630800,0x20a02080,0x390028e0,0x39603940,0x39203940,0x39203940,0x49c13940,0x41613920,0x5a252060,0x31003901,0x414030e0,0x498049c1,0x51c049a0,0x5a216242,0x51e15a22,0x41604140,
-0x41805a42,0x30e041a0,0x49a149c1,0x49a03900,0x624259e0,0x51e04980,0x51c06a62,0x49606a62,0x6a6259e0,0x6a216a81,0x6a417242,0x72427241,0x6a4261e1,0x6a0161c0,0x62017ac3,0x72817283,0x622159a0,0x722151a0,0x722282c4,0x7a4161a0,0x7a417a21,0x61807a41,0x8aa37a42,0x6a2069c0,0x28a07a83,0x6a0028c0,0x93439b85,0x9b428aa1,0x7a40b464,0x72407261,0x61e07aa1,0x61a061c0,
-0x59607a62,0x6a0061c0,0x61c07241,0x6a2161e0,0x59a059a0,0x596061c0,0x61c05980,0x8aa37242,0x72408282,0x618169c0,0x8aa19b42,0x932292e1,0xac059ba5,0x9b859321,0x83017ac0,0x72a08300,0x82e08b62,0x830082e0,0x72c08b61,0x8b4272a0,0x7aa082c1,0x6a008302,0x92e18b02,0x69e08b02,0x82c07aa1,0x93228b01,0x93a459c0,0x72c172c0,0x7ac07ac0,0x8b438322,0x72816a20,0x93238b44,
-0x8ae29b65,0x9b6482a1,0x72619364,0x8b028b03,0x7a808b23,0x8b028b02,0x7ae27240,0x83237ae2,0x83236aa1,0x93457280,0x9b648b02,0x93869364,0x7aa27aa2,0x62006a40,0x83247ae3,0x6a4159c0,0x598040e0,0x9324b449,0x59809304,0x72827283,0x6a007ac1,0x7a4182a2,0xa38692e3,0x93059303,0x69c09324,0x72427241,0x59608b05,0x726161a0,0x932582e3,0x49409325,0x59c061e0,0x72818304,
-0x52051000,0x31201000,0x18810800,0x08003163,0x20a01840,0x28a03940,0x208028c0,0x20c01000,0x30e020a1,0x206049c2,0x20602080,0x18402060,0x28c13101,0x080028e0,0x20801000,0x31004163,0x28c03940,0x20c028a1,0x39405244,0x51e451c2,0x39003920,0x30e03900,0x498059e2,0x38e051e1,0x38e051e3,0x39203921,0x5a034140,0x52014160,0x51e03900,0x832672e5,0x6aa36a64,0x6a832860,
-0x59e151c1,0x59e149a0,0x51c049a0,0x49605a02,0x5a214160,0x41605201,0x51e13980,0x59c16223,0x59e16222,0x726159c0,0x726359c0,0x72827ac3,0x93687222,0x51607242,0x59a07243,0x59a07243,0x82e66201,0x59806201,0x69e061a0,0x8a8269e1,0x7a216980,0x82625960,0x61c071e0,0x72205940,0x59e07a82,0x82c238a0,0xa3639303,0x8ac09321,0x7a408ac0,0x726082a0,0x49407242,0x51605180,
-0x59a05180,0x62007281,0x49207262,0x726259a0,0x7a836a41,0x72426a22,0x69c061e1,0x69e069e0,0x7a607a20,0x30205940,0xa343a364,0x826192e2,0xaba592a3,0x93238b02,0x6a009343,0x93638b02,0x8b02a3c5,0x936282c0,0x6a808321,0x7b0072c0,0x82c19b63,0x82c18ae1,0x9b858ae1,0x93028ae2,0x93238b02,0x7a61a385,0x726182c2,0x72816200,0x83029364,0x7ac06a60,0x7ac08301,0x7aa08322,
-0x8b2482e2,0x82e29364,0x8b0282c1,0x61c08b03,0x82e17280,0x7aa182c2,0x7ae35960,0x62406200,0x62608343,0x6a40a3e7,0x8b237ae1,0x6a407ae1,0x62208323,0x7b0259e0,0x62006a60,0x726072a1,0xac298b24,0x7a6069e0,0x8ae48ac3,0x82c35100,0x82e26a40,0x724082c2,0x82a382e2,0x82a28282,0x61c09324,0x49006a41,0x8ae46a42,0x7a6169e0,0x72207240,0x7a819345,0x82e38b03,0x61e07a82,
-0x100028c0,0x41a320c0,0x18a128e1,0x104020e0,0x39631020,0x31002080,0x18401000,0x28e02080,0x31201840,0x100028e0,0x28a128c0,0x20604182,0x28e01000,0x18401020,0x310120a0,0x6a884123,0x30e028a0,0x62854161,0x28a04160,0x39006a85,0x62445a03,0x51e14160,0x62435a02,0x41414140,0x38e03900,0x288030a0,0x39205203,0x416049c1,0x416030c0,0x5a2051c0,0x51a049a0,0x5a014980,
-0x626259e1,0x51c05a01,0x6aa45a22,0x51c06a63,0x5a215a01,0x62826aa2,0x49605200,0x6a4351a0,0x62225a01,0x726259c0,0x6a417ac3,0x6a416200,0x61e16a22,0x518061e1,0x61c16201,0x59a06a22,0x72426a42,0x726359c0,0x59a061e1,0x69e06a01,0x82628282,0x7a4161c0,0x82827a20,0x7a628262,0x59a07222,0x8b036a22,0x82607240,0xbc47b3e5,0xa3828280,0x8b228ae0,0x61c07260,0x59a059a0,
-0x59c059a0,0x82e36200,0x51405980,0x59c07263,0x59c059c0,0x59c06a41,0x61a06a20,0x69c07a43,0x72227200,0x61a048e0,0x822092e1,0x8aa27200,0x92c18aa1,0x69c07a21,0x828071e0,0x93439322,0x7a408ae1,0x93229302,0x72a082e1,0x7ac072a0,0x932382a0,0x82c18b02,0x7aa19343,0x932382a1,0x82807a40,0x8282a385,0x722069e0,0x726061c0,0x93657a62,0x93449343,0x7ae17260,0x83027ac1,
-0x72807280,0x83228302,0x83027280,0x82c17260,0x8b237a80,0x82e27a61,0x6a206a00,0x72a17aa2,0x832359e0,0x8b4272a0,0xac687ae1,0x8b639ba6,0x7ae26240,0x72c172c1,0x72817b02,0x82c38b65,0x8ae37241,0x7a409324,0x8ae282a1,0x82e29303,0x61c06a60,0x930582c3,0x8ae47221,0x6a017240,0x726059a0,0x514061e0,0x7a817282,0x930482a3,0x93247a61,0x82819345,0x93058ae3,0x8ae169e0,
-0x102028a0,0x31411020,0x18403120,0x20a22900,0x18401880,0x418328e0,0x10001000,0x28e020a0,0x20c020a0,0x28c03141,0x28e128a1,0x18203941,0x180028c0,0x30e10800,0x5a6530e0,0x30e03921,0x41613100,0x5a225a24,0x394059e4,0x30e04160,0x51e31820,0x30e03940,0x41606243,0x30a051c0,0x59e45a02,0x41402020,0x51a15a03,0x624259e1,0x49804160,0x62424980,0x49606a63,0x59e159c0,
-0x72c37ac5,0x49a07b04,0x6a826241,0x7b054980,0x51e06aa3,0x520049e0,0x62206240,0x61c25a01,0x51404920,0x6a2169e0,0x72617261,0x724361c0,0x59606a21,0x6a4361e1,0x59c061e1,0x61e159a0,0x59a17283,0x620259a0,0x59805160,0x61c04920,0x720269a1,0x7a625960,0x82617200,0x61c07200,0x61c14900,0x93247242,0x7a8161a0,0xdd6e9ba5,0xbc235960,0x7240a3a0,0x9b437ac0,0x8ae182a0,
-0x49407264,0x6a415180,0x934561c0,0x59c059c0,0x6a615160,0x6a0061e0,0x6a006a21,0x7a4261c0,0x7a828283,0x8b4361e0,0x82a0a3a4,0x61809b45,0x69e07240,0x8a40a303,0x8b028ac2,0x8a8071e0,0x7a008260,0x82406980,0x8281a385,0x93629b63,0x82c17aa1,0x7aa09364,0x72207240,0x7a407a60,0x72209322,0x69e08ac2,0x7a4082a3,0x930382a1,0x61a08ac3,0x7a608282,0x82c069e0,0x72807aa1,
-0x8b037240,0x72808b41,0x7ac17280,0x72c18322,0x8b438321,0x8ae38303,0x8ae37aa3,0x61e07a81,0x8b6559e0,0x624093a4,0x8b846a60,0x83027ac1,0x82e18b23,0x7ac27ae0,0x51e08303,0x6a405a21,0x7ac16200,0x93039b65,0x72205100,0xa3657200,0x7aa28ac3,0x6a6061c0,0x7ac26240,0x61e07281,0x93667ac3,0x61c09b67,0x82a27240,0x7a608284,0x59607a83,0x59206162,0x82808ac2,0xfeb4bc2a,
-0x28c01860,0x4a043101,0x28e049c3,0x10001040,0x28c03942,0x392128a0,0x28a01840,0x20a01860,0x5a463941,0x310141a3,0x28a02060,0x39423940,0x30e11000,0x100028c0,0x28e12060,0x51e228a0,0x392049c2,0x62443900,0x51e35a23,0x62646285,0x184028a0,0x51c251e2,0x5a226243,0x51a16a62,0x51c26a64,0x28a06a65,0x51c13920,0x5a216a84,0x410059e1,0x5a007ae5,0x496072a3,0x51c06221,
-0x6aa35180,0x7b047b04,0x62626a82,0x51e04980,0x5a2051e0,0x7ae272e2,0x728259a0,0x61e07283,0x59a09346,0x82e48ae4,0x82c29345,0x72606a20,0x72217241,0x72635180,0x59c05980,0x598059c0,0x620261c1,0x59a05160,0x61e15180,0x61a04940,0x61a069e1,0x69e061e2,0x59607200,0x6a008261,0x490069c1,0x7a625940,0x82a269c0,0x82e46a00,0x9b608b03,0xa3c4abe3,0x7a807a60,0x69a15120,
-0x726059a0,0x6a0082e2,0x82c27220,0x61c061e0,0x72607261,0x8b0361c0,0x6a0069e0,0x720082c2,0x7a4382a2,0x512069e0,0x72009304,0x7a406180,0x8ac27240,0x92e279c0,0x93436180,0x92e39b23,0x92e2b3a6,0x92c2ab85,0x72008280,0x932340a0,0x61e06a20,0x7a8082c1,0x7a609343,0x82a182a1,0x72209323,0xa3869303,0x82a29324,0x8ac1a384,0x93029323,0x72007a40,0x82a08282,0x9326ac07,
-0x7a807260,0x8b438b43,0x72808b23,0x8b436200,0x6a606a40,0x82c17280,0x7a609345,0x8ae37240,0x62006a20,0x93a66a60,0x7ae16a40,0x7ac16a60,0x8b637280,0x72818b24,0x6a417281,0x61e059c0,0x72a06200,0x72208ae3,0x69e08ac3,0x9b458ac3,0x82a269e0,0x6a417241,0x830359a0,0x7ac27261,0x6a406200,0x8b237a80,0x82c36a40,0x69e07221,0x69c09325,0x8ac47220,0x82a27a62,0x9325b3e9,
-0x29013161,0x41a320a0,0x31405245,0x28e01000,0x10002080,0x28e01840,0x30e028a1,0x39414161,0x184028c0,0x100041a3,0x31213940,0x41823140,0x31004181,0x28e028a0,0x39403100,0x41805201,0x39406263,0x202072e5,0x49c24160,0x39403100,0x418051e2,0x30e030e0,0x49a06a84,0x49a051c0,0x6a844140,0x51c26244,0x49a03900,0x5a214980,0x72627aa3,0x72c38327,0x62417b24,0x62416a81,
-0x624172a3,0x49a05a21,0x49a049a0,0x51e04980,0x5a006a81,0x7ac16a60,0x61c06a00,0xa3c582a4,0x61e0a3a4,0x72426a00,0x82e369e0,0x72609324,0x8b037240,0x6a2159c0,0x59c061c0,0x6a226a22,0x6a026201,0x6a026a43,0x59a06a22,0x49005180,0x620161e1,0x40e06a44,0x7a207262,0x82618282,0x9ba58281,0x7a636a00,0x59607201,0x6a0061a1,0x82c37264,0xb42461c0,0x490092e0,0xa3e461a2,
-0x93419300,0x8ae082a0,0x82c17220,0x82816180,0x7a808ac2,0xa3a482a0,0x72409b63,0x8ae382a0,0x92e27200,0xa3a47a60,0x72207a40,0x72207a41,0x9b249324,0x7a608281,0x72406a20,0x71e08ac2,0x9b0492e1,0x82617a00,0x9b647a60,0x82a07220,0x82c16a20,0x82c18b02,0x8ac182c1,0x8ae38ae2,0x7a608ac3,0x9b457a40,0x69a09303,0x8ac29302,0xaba792e4,0x82a17a61,0x8b039b24,0x59806a00,
-0x6a015980,0xac499365,0x72a09ba5,0x7ae16a60,0x82e28b44,0x8b027ac0,0x6a009364,0x8aa161e0,0x724082a1,0x72c06a80,0x6a806220,0x7ac18b43,0x8b438b24,0x8b647ae0,0xa3c78323,0x7ac29364,0x7aa07ae2,0x61a08261,0x8283a384,0x930492e4,0x7a827200,0x82e17a82,0x82e37240,0x72817aa2,0x83236a40,0x82e482e2,0x72419385,0x7a636a00,0x7a6182a1,0x72207a41,0x7a418ac4,0x7a409b26,
-0x208041a2,0x39411840,0x41834182,0x18203941,0x20801820,0x394130e0,0x41814162,0x28c028c0,0x184028c1,0x41613961,0x51e349a2,0x28c028c0,0x28803920,0x49a228a0,0x624351e1,0x5a2151e1,0x6a856263,0x83496aa5,0x51e272e6,0x5a233920,0x59e26284,0x412051a1,0x5a016a85,0x6a858b86,0x626272a4,0x41402880,0x620351a1,0x6a826a63,0x6a616a81,0x62417b05,0x6ac36a83,0x72a35a20,
-0x5a2059c0,0x39406a82,0x5a203920,0x49a072c4,0x72e251e0,0x72826260,0x724082e1,0x6a205980,0x61a07241,0x82c482c3,0x7a8161a0,0x8ae37220,0x61a07240,0x7a839b46,0x7a8461c1,0x7a837a84,0x61e061a0,0x72426201,0x726459a0,0x62014940,0x62026a01,0x61c15180,0x61a061a0,0x82819b64,0x6a008aa2,0x6a017240,0x722069c0,0x7a6261a0,0x7aa361c0,0x51406180,0x93443880,0x7aa08b41,
-0x9301a382,0x8b007a80,0x722082a2,0x82a07a60,0x7a607220,0x9b627a40,0x7a809342,0x722069e0,0x7a407220,0xab259b22,0x92e29302,0x61808ac2,0x8ac18aa2,0x72008aa2,0x61a08b03,0x7a4069e0,0x82608282,0x92c28a81,0x82618aa1,0x7a409b45,0x7a4069e0,0x7a407220,0x7a617a40,0x82c27a81,0x93239344,0x9b647a81,0x7a8182a1,0x82a282a2,0xa3858281,0x9b23a3c5,0x6a008aa0,0x728069e0,
-0x7a817240,0x59c059c0,0x69e07aa2,0x82e27260,0x8b437280,0x72807280,0x8ae18b23,0x9b439322,0x72826a20,0x8b0382a2,0x7aa27ac2,0x7aa08b22,0x83018b02,0x93437aa0,0x7aa18301,0x82c28b44,0x7a607a60,0x71e09324,0x8240feb4,0x8ac39b24,0x934692e3,0x59e08ae4,0x83038323,0x7aa282e3,0x82e361e0,0x82e382e4,0x6a6082e3,0x932669c0,0x7a21a386,0x9b25a367,0x82a29b25,0x8b0469e0,
-0x20802080,0x31203121,0x28e03100,0x28a149c2,0x30e130e0,0x30e03100,0x52043100,0x418049c4,0x41813960,0x49a24180,0x28a030e0,0x522249c2,0x10004160,0x310030c0,0x49a05a22,0x5a425a42,0x6aa66263,0x418072c6,0x49c03900,0x8b876aa4,0x5a015201,0x83275a01,0x49809c09,0x72c58b87,0x5a218366,0x6aa46aa3,0x72a36aa4,0x72a46a62,0x72c36a82,0x51a059e1,0x6a8372c3,0x5a426a63,
-0x6a824160,0x62616261,0x49a04160,0x624172c3,0x6a816260,0x59c06220,0x93227a60,0x82c1c487,0x69e06a20,0x72827261,0x40e07263,0x728082a3,0x69e082c1,0x82a28b04,0x7a627a62,0x6a017a62,0x59c06a01,0x72625160,0x7aa55180,0x724259a1,0x59a27222,0x6a234960,0x61807a83,0x7a827221,0x48e07a62,0x6a007201,0x7a808ae2,0x598082c2,0x61c16a01,0x598040e0,0xa3a39b64,0x9ba3a3a2,
-0x82c08ae0,0x8ae19b42,0x7a807220,0x930182c0,0x7a609b61,0x93228282,0x9b43abc6,0x8b018aa1,0xcceea386,0x9b227220,0xb4099345,0x8ae28262,0x720082a3,0x61807a20,0x82a27a81,0x93265980,0x92e27241,0x8a817a20,0xa3659b43,0x92a1a363,0x61808ac2,0x82617a20,0x828182a2,0x7a608281,0x82c17220,0x72209323,0x72209323,0x8ac28281,0x69e08280,0x9b237a61,0xa3a58aa0,0xa3e482c1,
-0x6a0061c0,0x518059c0,0x724169e0,0x82a1a384,0x61c09345,0x934361c0,0x9b849b64,0x7a6082a0,0x7ac261e0,0x82e07aa0,0x932482a2,0x7aa082c1,0x82e182c1,0x83018b22,0x8ae182c1,0x72017a81,0x8ae4abe8,0x7a2169e0,0xbc6a8b04,0x8ac36a00,0x69e061c0,0x7aa27241,0x51805180,0x7aa27aa2,0x7ac25180,0x72637260,0x59a059a0,0x7a6282c2,0x7a607220,0x93049b24,0x9304cccc,0x93039324,
-0x08001000,0x396128e0,0x186041a2,0x41812080,0x30e02880,0x49a230e0,0x41614181,0x416149a2,0x498230e0,0x39404160,0x39403100,0x204049a3,0x28c03940,0x51c238e0,0x5a434180,0x626349c0,0x51c26263,0x49c049a0,0x62835201,0x39606283,0x6ac45a41,0x5a226a85,0x62224160,0x62416242,0x5a0051e0,0x62605a01,0x51e24160,0x41804160,0x59e07ae3,0x59e14980,0x49804960,0x49a04960,
-0x5a006283,0x5a2072c4,0x51e151e1,0x6aa272e3,0x5a216261,0x62406220,0x93247a81,0x9366a3c6,0x82a35160,0x6a417261,0x59a059a0,0x7a8259a0,0x7a607221,0x7a417220,0x7a637242,0x7a6369e1,0x72217242,0x6a016a00,0x72646201,0x72235980,0x51606a43,0x516059a2,0x59a05180,0x6a216a01,0x69e06a00,0x69e261c0,0x72208283,0x6a01b406,0x514059a1,0x72205960,0x8b018ac2,0x93209321,
-0xa3429341,0x9b64a3c2,0x93439b65,0x930092c1,0x8280a341,0x7a607220,0x93227a60,0x92e19320,0x8aa27a40,0x9b24a344,0xa3ca7a42,0x82a14900,0xbcce8b25,0x7aa148c0,0x8ac25980,0x7a807220,0x510082a1,0x69e06a00,0xa3447200,0xb3e68ac1,0x92c38aa2,0x72008261,0x7a609322,0x9b6669e0,0x932469e0,0xa3c67aa0,0x8ae36a00,0x9b6582a2,0x7a608261,0x7a406a00,0x82c07a60,0xabc58280,
-0x726061c0,0x7aa17a80,0x69e0a3a6,0x93447a61,0x7a417a81,0x9b859b67,0xa384a3c5,0x93429323,0x9b4269c0,0x9b6382c0,0x8b02b447,0x7a6082c2,0x8b02a3c5,0x6a007a40,0xabe89323,0x724061c0,0x82a15140,0x8b04b3c8,0x82c27a40,0x72406a20,0x61c16a00,0x62006a61,0x7a816a40,0x62207240,0x7ac36200,0x82c382c1,0x6a007aa2,0x93047262,0x72209b25,0x72017a61,0x72227a62,0x7a635960,
-0x208149c4,0x28e01000,0x416241a2,0x310028e0,0x288028a0,0x30e04161,0x30c049a3,0x392049c2,0x310049c2,0x39404181,0x5a453940,0x28c01840,0x5a444181,0x39206265,0x49a07b27,0x6ac54160,0x41406aa4,0x6ac35a21,0x52014180,0x52013940,0x6a835a21,0x72c472e4,0x7b0472c3,0x62623900,0x6ac38346,0x5a0251e0,0x6a843100,0x52005a02,0x59e06a82,0x6aa37b03,0x7b2551a0,0x62826240,
-0x41a049c0,0x5a413940,0x6ac449c0,0x6a817b24,0x6a218344,0x6a4251a0,0x6a637ae5,0x72426a63,0x6a007242,0x72817a82,0x72837262,0x722059a0,0x82c27a82,0x720182c3,0x6a0182a4,0x6a017a63,0x6a225980,0x59a07a84,0x72436a42,0x51a14940,0x51805180,0x59c161e3,0x61c159a0,0x61a061c1,0x7a626a00,0x6a216a00,0x72017221,0x496061a0,0x7a835160,0x5160cd4f,0x7aa17220,0xac0482e0,
-0x8b0082a0,0xaba28aa0,0x826092e1,0x9b409300,0xa3c28a80,0xabc59b62,0x598069c0,0x93039304,0x71e08ac2,0xa343ab84,0x938882a2,0x82a14900,0xbc8aa387,0x6a203860,0x6a0069e1,0xa3a78b05,0x82a38282,0x59409303,0x9b038aa2,0xab857a00,0x7a209b23,0x93028281,0x72209b84,0x82a169e0,0x7a607a82,0x7a8069c0,0x61c06a00,0x82819303,0x69e092e4,0x82a37220,0x932382a2,0x8ac182a1,
-0x93849343,0x59a082c2,0x7a417220,0x72025120,0x61a07202,0x724161c0,0xabe69b44,0x8b017a40,0x93017200,0xa3a49b22,0xa3c69342,0xcd0ca385,0x9b655980,0xa3a59b66,0x7a807a60,0x93438ae2,0x6a008b03,0x7a218ac3,0x7a819303,0x93438b23,0x7ac37aa1,0x62007aa1,0x93648301,0x7aa182e2,0x83037260,0x722182c3,0x8ae38b03,0x82a27ac2,0x82a37a41,0x61a09b88,0xe5cf61a0,0x82a38ac3,
-0x10002040,0x20602882,0x3940b4f0,0x5a633120,0x51e24161,0x49a149e1,0x416049c1,0x39213922,0x39204160,0x28a028c0,0x41404181,0x41403900,0x51a25a04,0x59e23900,0x62434160,0x7b267b05,0x6ac46aa4,0x5a414980,0x41805a22,0x394049c1,0x51e07306,0x51e06a82,0x6aa26aa3,0x62406261,0x51c06a81,0x39003900,0x38e04161,0x414051c2,0x72e26241,0x7b468346,0x51e05201,0x52226281,
-0x5a426ac3,0x49c049c0,0x5a216262,0x62226a63,0x6a216a42,0x72635180,0x6a636201,0x51806a42,0x62206a43,0x59a16a62,0x59c07aa4,0x59a07263,0x72434920,0x7a4282a3,0x82c582c4,0x51807283,0x51a06a22,0x62015180,0x59c259c1,0x59c24961,0x59c24940,0x622251a0,0x61e15180,0x69c059a0,0x7a616a01,0x6a0161a0,0x72027a63,0x62014920,0x7a8248c0,0x40c048e0,0x6a4069e0,0x9b637280,
-0x8b238ae0,0xbbc1a341,0x9b01bbe6,0x8ac0ac02,0x8ac182a0,0x8ae19322,0x724071e0,0x49005940,0x82406a01,0x92c28260,0xabc39b22,0x82c07220,0xabe79366,0x8b239b46,0x8ae58b25,0x82c3abe8,0x8ae37221,0x7a808b03,0x82828281,0x7a208ac3,0x7a209302,0x7a618260,0x8ac27a40,0x7aa29b44,0x7a817220,0x8b2382e2,0x82826180,0x8ac27a20,0x61a09b65,0x61c07220,0x71e07a82,0x7a2071e0,
-0x72418ae3,0x7a6169c0,0x69e06a00,0x59805980,0x61a061c0,0x69e07241,0x9b657a83,0xa3839302,0x82609301,0x7a81a3a5,0x72408ae2,0x7a6282c3,0x69e061c0,0x72606a21,0x93238b42,0x9b659b85,0x62215980,0xb366ffb2,0x72009303,0x6a008b22,0x93667a81,0x93438304,0x726082e2,0x7aa07aa1,0x93447a60,0x7a8182c1,0x8ae282e1,0xac2a7aa0,0x82619325,0x8ac392e3,0x69c07200,0x72217201,
-0x28e03921,0x08005a64,0x49e3940c,0x396049e2,0x39403960,0x51e249c0,0x39415a44,0x41414182,0x20803941,0x392130c0,0x626428c0,0x72c672c6,0x6a635a02,0x49806223,0x6ac451c1,0x49a04180,0x52005a21,0x5a406aa3,0x6aa44980,0x49a049a0,0x6a813940,0x6aa26aa2,0x62617b24,0x5a206280,0x62407b03,0x30e051c0,0x49824160,0x624159e2,0x52006262,0x416059c0,0x62a24180,0x83855a20,
-0x5a4249a1,0x730449e0,0x6aa37304,0x498059c0,0x6a6272a3,0x6a425180,0x59c059e1,0x6a426a42,0x59c059c0,0x6a024920,0x62016a22,0x59a06a01,0x7aa47243,0x6a017242,0x59c07ac4,0x72436a22,0x41207263,0x49406222,0x518159c1,0x51a24120,0x51a24940,0x6a434920,0x51a059c1,0x516059a0,0x59c06a22,0x61e26a43,0x6a228b47,0x59c082e6,0x7a836a02,0x69e061c0,0x728282a2,0x72414900,
-0x7a8061c0,0x7a607220,0xb406b3e6,0xb423d547,0x934282a0,0x6a207260,0x69e082a2,0x59807221,0x72206a00,0x93247a40,0x9b837240,0x82c07aa0,0x9b858b43,0x5980ccae,0x82a382c5,0x72629b88,0x722140a0,0x7a607221,0x7a405100,0x9b238aa2,0x720092e3,0x69e0a365,0x7a61b407,0x82a269e0,0x61e06a00,0x726182c3,0x82c461c0,0x6a007a83,0x9b45abe7,0x7a6169c0,0xa3847240,0x8a818a81,
-0x61c08b03,0x8ae361a0,0x61c069e0,0x72427242,0x69c05960,0x61a07201,0x6a007a62,0x7a4092e2,0x9b239b44,0x61e0a385,0x48c08264,0x82a248c0,0x82e36a00,0x72617aa1,0x9323a3c5,0x82a09323,0x38e07260,0x62209323,0x6a006200,0x83027221,0x8b2382e0,0x82e39b65,0x9b657aa2,0x82827a80,0x8b018b03,0x7a807240,0x7a8182c1,0x724061e0,0x82c25120,0x722082c3,0xbc696a20,0x9b859344,
-0x312051e4,0x31203961,0x41812080,0x49e13100,0x51e15201,0x6ac549c0,0x30c03100,0x39003100,0x394028a0,0x520530e0,0x49813940,0x51e24140,0x41207ae7,0x51c038e0,0x6aa36263,0x52005a41,0x5a206ac3,0x6aa17304,0x5a425a21,0x6aa45a42,0x72a241a0,0x7b246a82,0x5a006aa2,0x72c27b42,0x62616261,0x5a025a22,0x62245a02,0x5a006244,0x6aa15a00,0x5a234980,0x62616aa3,0x49c05200,
-0x49a05220,0x72e36ac3,0x51e05200,0x8b876a83,0xa4099387,0x7ac451a0,0x728351a0,0x6a4159e0,0x6a636200,0x61c16a23,0x726261c1,0x61c06a22,0x620159c0,0x6a426a22,0x61c16a22,0x59c06a22,0x6a226a01,0x59c06202,0x49404960,0x51816203,0x59e24100,0x728459c1,0x59e16202,0x51807263,0x59c24940,0x51a151a1,0x51a14100,0x496061e2,0x6a0159a0,0x7aa29346,0x620061e0,0x59c07281,
-0x7a806a40,0x6a208b42,0x9303a384,0xaba3a383,0x7aa07280,0x61c07280,0x8b04a3c7,0x7aa27a61,0x6a0061c0,0x934561c0,0x726061a0,0x9b639361,0x93257aa1,0x7a809325,0x6a208b25,0x30005120,0x61a06a20,0x59809305,0x72007a61,0x72009303,0x82628262,0x7a618a82,0x82a269c0,0x82e3a3a6,0x6a007a81,0x61c06a21,0x59e05180,0x7a827244,0x6a0082a2,0x7aa18ac3,0x7a407240,0x7a409b23,
-0x598082c2,0x69e07a41,0x61a08ae4,0x6a0161a0,0x7a427242,0x69e07a62,0x7a8161c0,0x92e37a20,0x8aa19b24,0x722169e0,0x8b047221,0x722171e2,0x51405140,0x61c09b68,0x69e082e2,0x7a406a00,0x8b467220,0x51407aa2,0x7ac28b64,0x72608301,0x932182c2,0x6a209324,0x8b248ae4,0x93057a80,0x8ae09344,0xa3a58b02,0x8ae27220,0x6a006a02,0x82c28b04,0x59a082e3,0x72207240,0x7a818ac2,
-0x28a05203,0x39205201,0x49e16284,0x52005220,0x5a4341a0,0x49a15201,0x392172e7,0x28c030c0,0x41614162,0x62643920,0x52014180,0x390030e0,0x49a03920,0x51a151c1,0x49606a64,0x62636aa4,0x7b066241,0x6ac37306,0x72c46282,0x5a006241,0x6aa272e4,0x73036241,0x6aa251e0,0x83465a40,0x6a647ae5,0x416072c5,0x59e35a02,0x62215a02,0x6a846aa2,0x5a6349c0,0x520149e0,0x52006ae4,
-0x52215a42,0x59e03920,0x7b048b66,0x51607ae3,0x72845160,0x62226a62,0x6a226a63,0x8ae46a00,0x728182c3,0x59a06a21,0x6a426201,0x72437263,0x62017283,0x6a425160,0x59a16a02,0x6a4361e1,0x59e16202,0x62025160,0x59a161e2,0x51404140,0x59c151a2,0x6a0261c1,0x59a06a21,0x51a05980,0x51a059a0,0x59a259c1,0x61e17284,0x6a215980,0x72427263,0x61e07241,0x59c059c0,0x59c06a42,
-0x726061e0,0x7a808b02,0x6a206a00,0x82e282c2,0x82c182c1,0x59806a00,0x61a05960,0x8b0361a0,0x72616a20,0x9b867240,0x59a06200,0x6a608b21,0x6a2082e3,0x8b247281,0x8b047ac2,0x69e18b04,0x720061a0,0x6a225980,0x514059a0,0x82827221,0x93048263,0x69e07a20,0x82827a40,0xb4299304,0x82817a40,0x6a406a00,0x8b638b24,0x728282e4,0x62006a21,0x8b047aa3,0x61c07261,0x8ae369e0,
-0x71e1a386,0x82828282,0x69e07a62,0x6a018283,0x7a415100,0x8ac38282,0x7a6182a2,0x9302a385,0x72009b23,0x720082a2,0x69e05980,0x93257a63,0x7a617220,0x7a4169c0,0x82c27a41,0x8ae261a0,0x82c16a00,0x6a2182e2,0x83032880,0x49409bc7,0x8b23ac48,0x59c15960,0x82e47a42,0x724082c3,0x59607a82,0x69c061a0,0x9b458280,0x8b049304,0x934469c0,0x82c29345,0x8b028b24,0x82a182a1,
-0x28c06284,0x6ac55221,0x49a049e0,0x520062a3,0x51a06241,0x5a235a22,0x5a457307,0x392051e3,0x5a0449a1,0x62455203,0x49a06264,0x5a0249a0,0x51e15a22,0x6a844980,0x7ae54981,0x6aa359e1,0x730472e3,0x62a251e0,0x93c86261,0x6aa26241,0x51c072c1,0x62818365,0x6a836a62,0x72836242,0x62017ae6,0x49806242,0x49404960,0x72a359e2,0x72c47b06,0x41a03140,0x418049e0,0x49c049c0,
-0x41c049c0,0x6a4049a0,0x51808303,0x59e059e0,0x494059e0,0x51806a41,0x8b256242,0x82a47241,0x59a082c4,0x59c07263,0x59c06a42,0x59c06a02,0x61e061e0,0x62016a22,0x59c161e1,0x59c161e2,0x61e16222,0x59c159c1,0x59c159e2,0x59c259e3,0x59c14120,0x6a4261c1,0x59a07262,0x51805160,0x51a151a0,0x59c02840,0x51a051a0,0x59c06a22,0x61c059a0,0x6a0269c0,0x6a434960,0x728259c1,
-0x61e06220,0x93637260,0x6a2082e1,0x72407241,0x82a282c2,0x82e27aa0,0x8b028b22,0x518061c0,0x516072a2,0x82c15980,0x6a2072a1,0x7ae27ae1,0x51e05a21,0x834359e0,0x82a27281,0x82a27a40,0x7a2282c3,0x49007222,0x59e04940,0x69e069c0,0x82826180,0x8ac369c0,0x69e08ac3,0x7a607a40,0x69a08aa4,0x72608ac2,0x59c07ac3,0x59a06a42,0x51805180,0x61e059c0,0x936761e0,0x618061a0,
-0x720169a1,0x8aa361a0,0x61a08ae4,0x82836a01,0x71e092e5,0x7a417220,0x72209b25,0x82819303,0x82809301,0x9b457a60,0x82a29345,0x72209323,0x72207220,0x826161c0,0x51008a83,0x300040a0,0xa3a561a0,0xac087a61,0xe5d061c0,0x7240c4cc,0x6a206a20,0x6a427241,0x69e06201,0x492082a4,0xc50b61e0,0x9322ac26,0x61a0a384,0x93058b05,0x82c28ae4,0x6a026a01,0x8b239b88,0x93648303,
-0x418041a0,0x41605a42,0x5a6049a0,0x49c05200,0x83466aa2,0x8bc97b26,0x28c0b50f,0x41813920,0x39203100,0x6aa44980,0x6a654140,0x62246a85,0x62426a83,0x41406242,0x394049a0,0x62625a22,0x940962a2,0x49a07b46,0x62606aa2,0x7b0372c4,0x6aa26ac2,0x83667304,0x6a638b87,0x59e16261,0x62416a82,0x624349a0,0x41404980,0x51e21000,0x49c05a42,0x49e049e0,0x49e05200,0x41e05221,
-0x4a004a00,0x62404180,0x6a8172c3,0x59c072c3,0x72c459c1,0x59e138e0,0x51806a22,0x62217263,0x7aa461e0,0x51a061e1,0x59c051a0,0x6a2261e1,0x72427283,0x6a2261e1,0x620261e2,0x496059a1,0x6a436202,0x61e261e2,0x6a236a23,0x41205181,0x59c261c3,0x7aa45980,0x72627283,0x7aa382e4,0x51a251a1,0x61e159c3,0x59c159c1,0x62016a42,0x61c161e0,0x59a059e1,0x59a059c1,0x48e04920,
-0x7a6069e0,0xbc8a7ac0,0x6a408324,0x59c05160,0x6a605180,0x59c072a1,0x72208ae3,0x6200a3a6,0x7a6061e0,0x72a261e0,0x51c059e0,0x93a59385,0x7b027b01,0x72818303,0x7a8272a2,0x7a819304,0x61a06180,0x61c06a01,0x594182c4,0x61e16a01,0x200059a0,0x7a624920,0x8aa171c0,0x7a4169e0,0xaba67a41,0xa362cca7,0x61c06a20,0x59a07aa3,0x518059c0,0x51a14940,0x59c04100,0x93448b04,
-0x7a218ac3,0x51007a62,0x93248ac3,0xa3667201,0x7a007200,0x69e08aa2,0xab8669c0,0x9b228260,0x8aa0a363,0x8aa37200,0x82828282,0x7a414900,0x82618ac3,0x8ac3b406,0x72209b25,0x9b678aa2,0x82a17a60,0x69a069c0,0x38603880,0x6a005120,0x49609b84,0xcd694980,0x59a0ddea,0xa44b6200,0x624093c8,0x9b6361e0,0x69c0b406,0x59607a40,0x41203020,0x20204963,0x59e12840,0x72a059c0,
-0x5a4349c0,0x5a216261,0x62616281,0x626449a0,0xbd2f6aa3,0x51c48ba9,0x288030e0,0x392049a2,0x30c028c0,0x626351e0,0x62635a02,0x5a026263,0x624251c0,0x6a844980,0x626249a0,0x520049e0,0x8be77b25,0x51e06ac3,0x7b455a41,0x41a028e0,0x6ac46ae3,0x39008348,0x5a0138e0,0x6a6372e5,0x72c351c0,0x49806222,0x5a032880,0x30e051c2,0x49e049a0,0x39805242,0x5a615a61,0x62c36ae3,
-0x41a05a61,0x6a816281,0x62207ae3,0x51c06221,0x518059e1,0x51806222,0x41006243,0x6a4351a0,0x6a434960,0x62016a23,0x62016201,0x61e161e1,0x62016a42,0x6a0261c0,0x6a2359e2,0x518061e2,0x49204960,0x61e24940,0x726461e2,0x494059c2,0x620259a2,0x72635160,0x59a07262,0x514059c0,0x38c05180,0x59e15a01,0x59e161e1,0x51a059c0,0x598159a0,0x518061e1,0x514059c1,0x6a217242,
-0x7a617240,0x93257aa1,0x72616a40,0x59e07aa3,0x61e06a01,0x6a4059e0,0x7a817241,0x7a807a60,0x82c07a80,0x93839362,0x83438b82,0x6a607281,0x51e06a81,0x72a15a00,0x59e059c0,0x72407240,0x724182c2,0x6a217241,0x51209346,0x51807283,0x280040c0,0x49202000,0x7aa38ae5,0x8ac38280,0x828169c0,0x82c07200,0x82c0a3a3,0x7ac47ac1,0x51a15160,0x38e04940,0x39004940,0x59a159c2,
-0x82815980,0x8ac38aa2,0x9b457a61,0x8ae49b25,0x72007a40,0xabc77a20,0x9b047220,0xa3848ac2,0xc4889b63,0x92e39b43,0x82a28aa2,0xa3a761c0,0xa3a76180,0x8ae37a40,0x828269c0,0x7a857a41,0x6a0059a0,0x592071e1,0x61a07a62,0x8ac39b47,0x82c49b84,0x9b859bc6,0x49209363,0x20007281,0x5a204120,0xe5ecac66,0x51005940,0x72219304,0x728582c4,0x20004121,0x30c05184,0xc54e2860,
-0x31005a21,0x62836262,0x72e662a4,0x62635220,0x5a222880,0x28804101,0x392030e0,0x30a05183,0x624351e1,0x5a0251e0,0x49a06202,0x624472c5,0x51c06242,0x5a006262,0x626151e0,0x7b446282,0x524062a1,0x73044a00,0x7b846ac3,0x41a03100,0x4a023940,0x418028c0,0x390030c0,0x30e072e5,0x6ac349e0,0x49c06261,0x39406aa6,0x522141a0,0x52006281,0x73055a80,0x49c049e0,0x49c049e0,
-0x5a835a41,0x6a815a20,0x6a6172c2,0x51c06220,0x498051c0,0x62225a21,0x41406a84,0x6a235a02,0x51604960,0x6a2259e1,0x620261e1,0x59c06a23,0x6a426a42,0x62226a43,0x59e259c1,0x62435180,0x51a16a63,0x59e251a1,0x62026a43,0x518159c2,0x51a151a1,0x6a6359a0,0x59e14920,0x620240e0,0x59e259c2,0x51806223,0x59e159e1,0x41005a01,0x59e259a2,0x61e159a0,0x61e159a0,0x6a015180,
-0x72606a00,0x61a082c2,0x6a417ae4,0x61e07261,0x7ae46a41,0x62006220,0x8b0269e0,0xb4448ae1,0x82a0a3a3,0x72807260,0x6a608321,0x622072a2,0x83036a40,0x832359e0,0x6a206a42,0x7ac27262,0x6a206a20,0x61c08b24,0x72229326,0x598069e0,0x6a0161a0,0x6a415980,0x93047a82,0x72219304,0x722061a0,0x48e0a3c3,0x7a817240,0x51608b03,0x41206a63,0x41606a63,0x41203920,0x51a051a0,
-0x724161e0,0x7a8069e0,0x72207a61,0x596069c0,0x618069a0,0x69a069c0,0x930361a0,0x7a6192e2,0x9303b3e7,0x7a409323,0x69c07200,0x61a07200,0x69c06a00,0x69c082a1,0x9b8569e0,0xdd4a9323,0xabc5e5ac,0x9b258282,0x61a05940,0x71e07a60,0x7a818281,0x59809324,0x93246a00,0x7ac18ae3,0xbc877ac0,0x30407260,0xabe7f673,0x93056a00,0x61c048e0,0x7203ac08,0xc4ac69c1,0x48e030a0,
-0x6aa45201,0x5a414180,0x41605a42,0x628549e0,0x62643900,0x5a0538e0,0x41605a23,0x6a8430c0,0x5a226a64,0x62426aa3,0x62626a83,0x72c451e0,0x51c06242,0x6aa149a0,0x73046aa2,0x73047b25,0x6b035220,0x6b227323,0x73447364,0x394028e0,0x30e02080,0x392049c2,0x49805a23,0x5a425a01,0x52014180,0x51e06ae4,0x394049c1,0x72e528e0,0x628341a0,0x520062a2,0x49e07b66,0x49e05200,
-0x5a425a41,0x624051e0,0x624172c2,0x6a626a61,0x6a635a01,0x6a855a03,0x41204961,0x518151a2,0x6a4359a0,0x620259e1,0x620259c1,0x59e151a0,0x61e26a23,0x59e16202,0x51804980,0x59e251a0,0x498051a0,0x59a159e1,0x518059c1,0x59c259c2,0x62034940,0x518159a1,0x38c059a1,0x496059c2,0x49604100,0x59c159e2,0x51a061e1,0x51814960,0x59a14940,0x61e14940,0x6a215160,0x6a016a21,
-0x6a0061e0,0x6a00a3a6,0x622072a2,0x62206200,0x72826a41,0x6a618303,0x7a8069e0,0x9b817260,0x93208b20,0x72808b20,0x9bc482c0,0x83028b22,0x622072a1,0x830372a1,0x8b4472a1,0x93647ac2,0x8ae37260,0x61e069e0,0x82a37a62,0x61c061c0,0x9b867a62,0x72006a00,0x7a617a20,0x93659324,0x8ac482c3,0x720082a2,0x61a05960,0x620069e0,0x516059a0,0x59c17aa4,0x49404920,0x59c14940,
-0x69e07242,0x61a06a00,0x69e08ac3,0x720182c4,0x828269c0,0x7a208281,0x82617a21,0x8ac27a40,0x61809303,0x720069c0,0x72209304,0x72008282,0x69e06a00,0x82818b03,0x934461a0,0xa3859b64,0x9b2569e0,0x82617200,0x7a2069e0,0x72209b45,0x69e07a41,0x9b657a60,0x61c09b86,0x9be59344,0xa3a3a405,0x51207aa0,0x61c082c1,0x72208284,0x72207a80,0x69e07241,0x61808284,0xd5517a64,
-0x62646284,0x83682880,0x30e03940,0x49e14180,0x93aa51e2,0x62236a64,0x62235a02,0x5a2251a1,0x6a826a81,0x622251c0,0x6a826a82,0x7b046aa3,0x62606261,0x72c451a0,0x52027ae3,0x73435aa1,0x7ba362c0,0x29006301,0x28e018a0,0x290020c0,0x39202080,0x41604161,0x49a051c0,0x49a06261,0x39403960,0x62833940,0x28e05a43,0x41803100,0x41c05202,0x41c05242,0x49e14161,0x4a003980,
-0x51e041a0,0x620059e0,0x620051a0,0x72a36221,0x62215a00,0x51c04980,0x30c06225,0x62024961,0x59c159c1,0x6a2259a0,0x61e16a22,0x59c159c1,0x6a0261c1,0x59e259e1,0x496059e2,0x620359e2,0x61e36203,0x61e25160,0x59e361c2,0x51a24961,0x62445a03,0x41004921,0x49604100,0x410059e1,0x59c259e3,0x620259c1,0x494059c1,0x59e238c0,0x51a14120,0x59a14900,0x61e14920,0x59a07242,
-0x7a208ae3,0x6a609345,0x626061e0,0x62207b02,0x6a625a00,0x6a407ae4,0x724059e0,0x72807240,0x93607aa1,0x7a608b21,0x8b428300,0x8b01a384,0x728072a0,0x6a017aa3,0x62004940,0x9b847ae1,0x69e08ae3,0x7a417221,0x8ae38aa2,0x722061c0,0x82c282c1,0x82a282a1,0x71e09364,0x514071e0,0x930559a0,0x69c07240,0x724182e3,0x49206a00,0x61e061c0,0x620259c0,0x41204940,0x6a444120,
-0x286059c3,0x61e061a0,0x72009304,0x61a07222,0x722169e0,0x69e07a64,0x82a27a41,0x7a418262,0x9324a3c6,0x82828282,0x8ac37200,0xbc6961a0,0x93228261,0x92e292e6,0x82816160,0x7a218ac3,0x93259b45,0x9bc3ac26,0x7a83c42c,0x93248b02,0x72007221,0x69e05940,0x82c292e3,0x8ae28ae2,0x9b85bc87,0x7a40a3a5,0x9b6569e0,0x8ae38ae2,0x61c048e0,0x8ac482a1,0x72017240,0x7aa461a2,
-0x836872e6,0x5a443921,0x39405a44,0x39603940,0x72c66a64,0x5a016aa5,0x83466a63,0x626272a4,0x51e06aa2,0x5a2172c3,0x72e372e3,0x62406281,0x7b227b03,0x6a8272e3,0x5a616a80,0x732462a2,0x4a207364,0x18c03960,0x39813181,0x39613120,0x49a13140,0x41604180,0x52213940,0x6ae541a0,0x39403960,0x49e04180,0x41803960,0x39603960,0x4a003140,0x62a241c0,0x5a605221,0x5a415a40,
-0x626249c0,0x72a36a62,0x6a626a41,0x62217262,0x62016a62,0x59e251a0,0x414051a1,0x62024981,0x518059e2,0x622261e1,0x59e14940,0x59a16202,0x598159c2,0x59c25181,0x59c251a2,0x620251a2,0x6a6359e1,0x59e46202,0x6a2459c3,0x620459e3,0x6a455182,0x59e45a03,0x5a0459e4,0x30806265,0x83294120,0x51a24120,0x62039389,0x59e351a2,0x59c26a44,0x51606a02,0x6a0259c0,0x62015980,
-0x82a27201,0x724069c0,0x6a809ba4,0x6a806260,0x59e072a2,0x622059e0,0x82c16a60,0x8b438b42,0x72a06a20,0x7aa09ba4,0x72407ac0,0x8b028b03,0x6a408321,0x59a061e0,0x6a206201,0x7a817280,0x8b0361c0,0x82c27a81,0x82a29303,0x8ae269e0,0x7a4069e0,0x82819323,0x82a36a00,0x6a427221,0x932659a0,0x51209b65,0x61e048e0,0x7aa361e0,0x61e07282,0x51806200,0x51814940,0x41204100,
-0x40e04940,0x72433880,0x6a217a62,0x59a07222,0x69e069e0,0x7a4169e1,0x8ae1bc29,0xac088281,0x6a0069e0,0x7a4169e0,0x7a417a41,0x722071e0,0x8aa371c1,0x7a408281,0x69e092c4,0xa3a77220,0xa38669c0,0x930750e0,0x7a60ab86,0x9323a3a5,0x7a607240,0x82c19b45,0x69e0a387,0x93245980,0x69e082c0,0x82a28ae2,0x72207220,0x69e06a00,0x72249345,0x7a822800,0x7a6361c0,0x38e040e0,
-0x49c16a66,0x39205a42,0x30e030e0,0x628372e5,0x51c06222,0x626151a0,0x72c36a83,0x51e05a20,0x5a2149a0,0x6a816aa3,0x62c16aa1,0x7b637343,0x7b4272e2,0x5a205a40,0x72e37b04,0x62c441a0,0x396062a4,0x29203140,0x31202900,0x28e028e0,0x41804a02,0x6ae55200,0x41c13100,0x5a4249e0,0x31204180,0x39605222,0x49c14160,0x41a13940,0x39605223,0x5a6149e1,0x62a35200,0x62615221,
-0x5a416a61,0x83046a62,0x7ac37ac3,0x72627aa3,0x59e27283,0x59e359e2,0x49a151a1,0x61e23920,0x59c07264,0x6a436a22,0x61e16222,0x6a237264,0x6a657286,0x7ac74961,0x7ac75182,0x7b0a7ac7,0xee9872c9,0xb5538b8c,0x59816a87,0x6a4559e4,0x59c47b08,0x39016264,0x49c4a450,0x72864182,0x8b8c4921,0x93ac49a3,0x51c14141,0x72667286,0x620472a7,0x832972a9,0x7a8572a7,0x9ba982c6,
-0x7ac25120,0x9b2369c0,0x8301a3a4,0x62606260,0x62406260,0x728159c0,0x82c16220,0x62009343,0x62217ae2,0x62408b64,0x7aa08b21,0x6a407282,0x7ac16a60,0x6a216a21,0x728361c0,0x82c37aa2,0x7a8082c2,0x8b217a80,0x8ae38ac2,0x8ae17220,0xa3639b22,0x72209b42,0x6a216a00,0x62006a00,0x82a47262,0x59609324,0x6a0061c0,0x7a8361c0,0x59c059a0,0x6a2259c0,0x49604940,0x414059e1,
-0x59a34120,0x49604920,0x59a16202,0x598061c0,0x7a4261a1,0x7a627200,0x69a08ac3,0x69c08284,0x82a49b46,0x82836180,0x8ac38262,0x7a417a41,0x71c18280,0x7a2171e0,0x8ac28281,0x59407200,0x69e06180,0x61406961,0x72209b22,0x72608ae1,0x8ac07aa0,0x72019304,0x61807a61,0x720069e0,0xa3867220,0x8ac282a1,0x8ac28ac3,0x8ae37a81,0x28408ae4,0x51806221,0xcd0e7ac5,0x51c29bcb,
-0x414051a0,0x416028a0,0x6a845a63,0x83656262,0x7b056a82,0x7b0451e0,0x7ae46241,0x49a06ac3,0x5a2151c1,0x7b247b25,0x5a807b24,0x73205a80,0x5a607322,0xa4677b42,0x62826ae2,0x398049e2,0x39818c0c,0x29402900,0x29002920,0x398128c0,0x62a33140,0x49c172c5,0x41c03940,0x49e17b65,0x394049e1,0x312051e2,0x39812900,0x39813140,0x39403960,0x6ac541a0,0x62826a83,0x6a627324,
-0x49606a61,0x83056a42,0x7a637a83,0x7ae67a83,0x59a27285,0x49406a23,0x62246203,0x49404100,0x61e17265,0x59e16a23,0x61a06244,0x832a69e2,0x93cc8b8b,0x59c361e4,0x7ae96a46,0x834a4922,0x6288836b,0xc639f698,0x61c65a47,0x622751a3,0x940fff3b,0xa490b4f1,0x41637b4c,0x518251e4,0xb4b2836a,0x93cd6225,0x5a0551c5,0x72c772a7,0x59e54963,0x39019c2e,0x5a468b6b,0x8b6a7aa6,
-0x82a682a4,0x8a808263,0x7ac08b22,0x7ae17280,0x62407ac0,0x622049c0,0x93436a60,0x72c282e2,0x51a06a40,0x6a6072c2,0x6a607ac1,0x72c26a61,0x6a208b24,0x59a06220,0x7a818b04,0x622082c2,0x82a059e0,0x9b837a80,0x61c09324,0x93037220,0x72409b64,0x7a637260,0x69e15180,0x59807a63,0x93255980,0x8b027a61,0x61a07240,0x61c05980,0x8b2461c0,0x61c07220,0x518059c0,0x41205180,
-0x59e16a22,0x514061c1,0x59a05160,0x61c14920,0x61c07222,0x722159a0,0x7a8269e0,0x82c28ae3,0x8ae47221,0x7a6259a0,0xa3876a00,0x7a6169a0,0x93049b06,0x69c07a41,0x92e38282,0x72006160,0xedd18263,0x82825940,0x93237a81,0x9321b445,0x7a2069e0,0x92e392e2,0x720069a0,0xa38769a0,0x828182a1,0x72007a41,0x93027200,0x7aa09b45,0x40a06a20,0x61c05120,0x516061c0,0x6a2340c0,
-0x49805a02,0x5a636ae5,0x62824180,0x72e56283,0x72e26240,0x72e48326,0x7b047b04,0x6a828303,0x6aa172a3,0x5a407b03,0x49e062a1,0x73237303,0x62608383,0x6aa28b84,0x520149c0,0x310049c1,0x290039a0,0x39a12920,0x290041c2,0x310041e1,0x394041a0,0x52233120,0x39403960,0x5a433940,0x49a149c1,0x41a128c0,0x31202900,0x314041a2,0x39415244,0xcd9472e8,0x6a84bd93,0x7ae58b25,
-0x62435a01,0x7ac56a02,0x82846a02,0x7b088308,0x59e44983,0x624659e5,0x72e8a44f,0xb4af3100,0xffffac6f,0xde186289,0x59c449c6,0xad147a86,0x5a28cdd6,0xa492732c,0xc5b7a493,0x734dce18,0xd617b575,0xacf4cd96,0xbcd05a47,0x41444183,0x72eab4f2,0x7b2bbd14,0x39424164,0x51a351a5,0x7b0a8b8b,0x836e51a7,0x28c2b4f3,0x208141a6,0x94303985,0x9471bd75,0x3987f75d,0x20002882,
-0x50c061a1,0x6b09ff3b,0x92e482e2,0xa3a7d54d,0x59c082e2,0x7ac27ac3,0x7a829343,0x72818b04,0x72a27281,0x72a16200,0x624051c0,0x620059c0,0x72a17280,0x62206a60,0x82e38ae2,0x6a6061a0,0x83028322,0x82e27280,0x8ae29324,0x93029b64,0x82c27221,0x72427a60,0x61a061c1,0x6a0082c4,0x72415140,0x6a007220,0x48e06180,0x61e07240,0x61a07240,0x69e09322,0xa3c861c0,0x622161a0,
-0x51605180,0x51406a22,0x59a05980,0x59806a22,0x49405161,0x51804940,0x61c05160,0x61c06a21,0x7a437201,0x40a05140,0x7a8269c0,0x930469a0,0x82827220,0x7a2169e0,0x9b446160,0x38407a41,0x79a07a20,0xbc088a60,0x93028241,0xbc08bc46,0xa3647a40,0xa3648aa1,0x7a40a345,0x69c09b65,0x61807a80,0x9b628ae3,0x9bc49bc4,0x934369c0,0x8b247242,0x82c39b86,0x6a0061e0,0x6a015100,
-0x62635a43,0x52017304,0x6aa36aa3,0x7b255a21,0x6ae28ba8,0x72c293c9,0x83258325,0x83257b04,0x72c172a3,0x7b258345,0x62c17304,0x6b047b85,0x41a041c0,0x49e149e2,0x49c05201,0x310049c2,0x29003120,0x29202900,0x20c02920,0x41c23961,0x39612900,0x41813100,0x394049c2,0x39204160,0x522262a4,0x39404180,0x29605a85,0x31202920,0x8bcc5a26,0x00007b2b,0x49a14a24,0x7ae57284,
-0x6a6472a4,0x83286a64,0x622472a6,0xacb08b8b,0x8bac3922,0x6aea6a47,0x520662c9,0x51e42880,0x5248bcf2,0x8bce5249,0x20204985,0x8beff679,0xad36ef1d,0x4a29734f,0xc61b8411,0xdedc2105,0x6b2dd67b,0x39ea3167,0x8bee49a6,0x416551a4,0x3102838d,0x4165ff1c,0x30e09c2f,0x30c04984,0x51c572c8,0x31446aa8,0x9c72c5b6,0xc5d6bd75,0x6aa9acf3,0x6aab9c0f,0x9cb449e8,0xd5d749a6,
-0x61607263,0xf6f94100,0xc52e92e4,0xd58dabe8,0x7ac472a2,0xffba9bcb,0x936aee55,0x72805180,0x7ac27261,0x51e072a2,0x59e051a0,0x51e072c1,0x62406a80,0x6a408343,0x7ae17281,0x62208301,0x8b438322,0x6a206220,0x82e27aa1,0x8ac18ac1,0x932369e0,0x69e082a2,0x7a427a61,0x69e06a01,0x7a606a00,0x7a607a61,0x61c0abe5,0x61a07240,0x82a09322,0xa3a59b61,0x61e082a1,0x61e07221,
-0x59815140,0x620159c0,0x69e169e1,0x51604920,0x49404941,0x492051c0,0x59807aa5,0x72427242,0x72224900,0x69e05120,0x7a827a82,0x8ae46a00,0x61c07240,0xabc761c0,0x8aa38ac4,0x8a818ac2,0xe56d92e3,0x9b02b3a6,0x8ac1a366,0x7a407200,0x8a83aba5,0x9ae192e2,0x71e069c0,0x69e0aba6,0x69a082a2,0x59805140,0x9b848ae3,0x82c09345,0x8b2469e3,0x61a08303,0x6a009b45,0x510069e0,
-0x73046aa3,0x72e48367,0x6a826aa3,0x83668345,0x6ac272e4,0x72e37b04,0x6a816a81,0x7b047b04,0x72e38325,0x5a415220,0x52216aa3,0x31201860,0x396041c0,0x39603140,0x49a172e6,0x31203100,0x39613100,0x10403121,0x31402920,0x29003140,0x29003100,0x20809c4c,0x6ac64160,0x39403940,0x51e15a63,0x49e249e1,0x49e34181,0x206041a1,0xd63759e5,0x20a2c5b6,0x940cde78,0x6aa48389,
-0x5a0272e5,0x7b086244,0x62456245,0x62676a67,0x49646a68,0x5228c533,0x6ac98bee,0x6a8828a0,0x5a285a07,0x5a893904,0xc5553104,0x5a694145,0xef3e83d0,0xa4f6630e,0x528de71d,0xa4d56b4e,0x949283d1,0xad37c5f9,0x732d72cb,0x5a283902,0xcdb64166,0x30e24185,0x39416288,0x51a349a5,0x49a4a44e,0x942f6aa9,0x522849c6,0x4a28bdb6,0x8bcfb555,0x838e9410,0x520849a6,0x82e93081,
-0x71c48ae9,0xffff4944,0xd6187222,0x7308cdd4,0xc50e7262,0xffdde634,0xf656cd92,0x62405180,0x7ac48b46,0x30e06221,0x622072a3,0x626072c0,0x72c16220,0x6a606aa1,0x6a607260,0x93838301,0x61e08b42,0x7ac17280,0x61c082a2,0x7a817220,0x8b038ae3,0x7a828ae3,0x82828ac3,0x7a8269c0,0x82c36a20,0x61a08ae3,0xb447c4aa,0x934582c1,0x9ba37220,0x61c082e0,0x7a617240,0x59a069e0,
-0x62015180,0x6a226a22,0x72225960,0x49406a43,0x59c24120,0x51604960,0x61c161c1,0x61e17ac5,0x61e06a24,0x59a15161,0x59805980,0x69e061e0,0x69e08ae3,0x50e069e0,0x82628262,0x8aa369a0,0x92c37200,0x9b437200,0x69a092c5,0x82617a20,0x7a20a385,0x9b228280,0x93048aa2,0x93029304,0x61807a40,0x61806180,0x6a014900,0x7a606180,0x6a208ae1,0x82c38b02,0x8ac57a82,0x8ac69307,
-0x6ae45a40,0x6aa26262,0x6ac251e0,0x5a207b47,0x49a07324,0x62416261,0x6aa351e0,0x6ae28bc6,0x7b247b23,0x62816261,0x62846ac3,0x080028a1,0x08003120,0xcdf5ad13,0x28e041c1,0x28e03942,0x28c03980,0x312028e0,0x39603120,0x31403981,0x20a12901,0x20601880,0x394049c2,0x31213100,0x51c06284,0x5a465a42,0x39411000,0x83293940,0xe6bac551,0x9411a471,0x9471bd97,0x6ac7ce38,
-0x62646264,0x622451e2,0x59c46a66,0x8b4d59c4,0x72ea4164,0xa490838d,0x28c2ffbe,0xb4b10800,0xad76b514,0xa557b598,0xa537d619,0x6aab5a4a,0xf79f732e,0xa516528c,0x39ca94d5,0x5b0ea537,0x6b2d9473,0x6aaabd96,0x498549c6,0x834c30c1,0x5a898c0f,0x52064185,0x414259e5,0x416449a3,0x39213924,0x28c26206,0x6acb838d,0xad572946,0x8432b5b9,0x4185b576,0x8bcd5a68,0x6a2530e1,
-0x69e6f77e,0x59c60002,0xdebb30c2,0xffffef9e,0xef3c2000,0xeefae69a,0x8ae6ac0a,0x72a23060,0x40e09389,0x72826200,0x72c27ae2,0x73009c45,0x626072e2,0x61e06a40,0x72406240,0x72a082c2,0x6a606a60,0x7aa28301,0x49406a40,0x51806a41,0x93247240,0x61c092e3,0x7aa261c0,0x72217221,0x6a215980,0x5960a3a7,0x726261e0,0x62216200,0x59c06200,0x9b856201,0x82c26a20,0x59a069e0,
-0x59c06a41,0x6a235160,0x59806a41,0x518061e0,0x49406221,0x59c04920,0x40e06202,0x518051a0,0x494082e7,0x41206202,0x49404940,0x61a05960,0x596048e0,0x61a05120,0x61807aa1,0x71e292e3,0x722150c0,0x7a207200,0x82427200,0xa345a365,0x8ac1c46a,0x8aa2b3e7,0x82618240,0x8aa39302,0x69c07a41,0x69a161a0,0x82c35960,0x7a617241,0x8b227a81,0x61a06a20,0x69c17a81,0x69c06a00,
-0x62c26ac1,0x72e383a8,0x418072c3,0x6ac27304,0x73047303,0x5a207b04,0x624151e0,0x6aa26ac3,0x49a07b43,0x6ac37b45,0x5a625a42,0x39613100,0x5a463100,0x520562c9,0x18604182,0x7b2a0800,0x49a34162,0x28c020c0,0x20c01000,0x398128e0,0x28e03120,0x416141c3,0x416149a1,0x31013900,0x52236285,0x31206264,0x41813100,0xac6d30e0,0x4182b4d1,0x8b8e6a88,0x62a9ad14,0x7b293964,
-0x62446285,0x72c75a24,0x62277b09,0x6aa9940e,0x93ce7b0a,0x5a276ac9,0x62898bef,0x62273923,0x9c936acb,0xa5169cf5,0x630ecdd8,0x08018bf1,0x632e8c32,0xffff9cf5,0x7390defe,0xbdd94a6c,0x62ec1883,0x30e28bef,0x31025a27,0x30e351e6,0x28e362cb,0x31025207,0x31013922,0x51e65a25,0xa4f5730c,0x418549e7,0x9c722081,0x8412b597,0x9cd49cd5,0xb575a516,0x39011020,0x38a03900,
-0x2020acf3,0x82ea0800,0xb5b8eedb,0xff7bffbf,0xef7efffd,0xef5cf77d,0xbcacbcae,0x72a52000,0x72a451c0,0x7ac36200,0x59e06a81,0x8ba551e0,0x7ae58367,0x51a072a3,0x6a2072e0,0x83237ac1,0x622072a0,0x8b248b63,0x6a416a40,0x51606200,0x82617240,0x7a619b24,0x7aa27262,0x82a46a01,0x6a217a62,0x7a8382e4,0x59a059c0,0x61c05180,0x61e061c0,0x6a206a01,0x93438302,0x61e07240,
-0x6a4161e0,0x72645180,0x724359c0,0x82e459a0,0x59c06200,0x51804940,0x51806222,0x496059c1,0x51807aa6,0x59c159c1,0x49214921,0x51406a23,0x514059a0,0x7a637263,0x6a027241,0x82828aa2,0x61808284,0x82426180,0x826069c0,0x8aa39b25,0xabc5e54d,0x9b8761a0,0xb3e79345,0x71e09303,0x92c3b3e8,0x9b44b409,0x722069a0,0x7a619304,0xabc59324,0x9b468ae2,0x596061a0,0x61a07220,
-0x5a604a00,0x51c093eb,0x72e36aa2,0x6aa36ae1,0x72e38386,0x5a2072e3,0x6a8372e4,0x6ac47b46,0x7b2572e3,0x62624160,0x49a34980,0x184128e0,0x31203101,0x10003120,0x49c5de38,0x41814181,0x418249c3,0x52043983,0x5a8628e0,0x20c02900,0x62a928e0,0x51a149a3,0x5a243100,0x28a03100,0x28e030e1,0x28e041a3,0x20803100,0x4100b4d1,0x9c0e5181,0x61e6cd93,0x93ac6a68,0x6aa85a05,
-0x6a8772e7,0x7b2a6a86,0x836c836b,0x49c58bad,0x62486247,0x30e3de3a,0x100049e7,0x5a0530c1,0xbcf55a89,0x8433e71e,0x9cf69c72,0x83b19cb4,0xad577bb0,0x31cbcebd,0x9cd6b5b9,0x9cb38412,0x52085a49,0x20a05227,0x18403121,0x93ae30e2,0xc5d89c93,0x51e65a48,0x41424163,0x62884983,0x944fb4f3,0x62a96aca,0x94313944,0x29256b0c,0x524918a4,0x39232062,0x39004963,0xac6e4940,
-0xfffe4984,0xcd1040c0,0x626793cd,0x82e8ffff,0xf71bff58,0xbd51c590,0x4120ed90,0x51a06223,0x72845a00,0x728259c0,0x5a0059e0,0x7b06bd0e,0x5a01e652,0x62805a40,0x8b47b4af,0x62206200,0x62006200,0x83046a40,0x7ae26a42,0x6a617aa2,0x8ac26a00,0x722092c3,0x72616a21,0x61a161c0,0x82c46a20,0x6a017aa3,0x61e059a0,0x82607281,0x82a08b00,0x59606a00,0x82c17aa2,0x6a217a80,
-0x72626200,0x6a4259a0,0x62005140,0x7aa36a01,0x72416a00,0x7aa46a01,0x59c14960,0x59c05180,0x41007265,0x51a04120,0x59c34920,0x41204940,0x41204100,0x596038c0,0x59a061c1,0x7a419345,0x8ac692e7,0x7a408b04,0x9b2550a0,0x51008282,0x59808261,0x8a826180,0x9b4492c2,0xaba67a00,0x82629304,0xa3469b23,0x8aa271c0,0x7a0071e0,0x9b238a82,0x82807200,0xa38769a0,0x50e082a3,
-0x5a614a00,0x73236b03,0x62c27323,0x6ae262a1,0x62c15220,0x6ac26ac1,0x49c08366,0x49c228c0,0x41616285,0x396041a1,0x6aa65203,0x28c04164,0x310228e0,0x184028e1,0x10001840,0x41832080,0x208041a3,0x08002901,0x28c01860,0x314228c0,0x5a6720c0,0x51e33921,0x28c028c0,0x31205203,0x30e030e0,0x414141a2,0x61e33100,0xff39b470,0xbd526a67,0x7b0a8b6b,0x498451e6,0x62277b2a,
-0xff7b59e6,0x51e6942f,0x51e551c5,0xbd7583ad,0x49a55207,0x28c24185,0xe6997b4c,0x7b0b49a6,0x6a8a51c7,0xad16a4f5,0x7b918c33,0xa4f6ce5b,0x8412526c,0x8454c63c,0x5aee8cd6,0x6b0e7bd1,0x4a299c93,0x28e262aa,0x38e23943,0x9c503103,0x49c73987,0x5a0551e6,0x392151e4,0x39213922,0x8bed3902,0x6a8a6aa9,0x9c92bd55,0x41a85229,0x628aad56,0x18205a4a,0x496330e1,0x62862040,
-0xeefb7246,0x936a1800,0xffdbbd0e,0xfed6c572,0xfffbff59,0x3000bc08,0x724338a0,0x51a05180,0x6a416a22,0x72a34940,0x6a618324,0x62407b01,0xbceda407,0x5a014980,0x498093c9,0x62255a02,0x41409c0b,0x72436a41,0x6a616200,0x51a082c3,0x82a361c0,0x72218aa3,0x72227aa3,0x8ae461c0,0x82a47a61,0x82c26a01,0x59a07a82,0x93227a40,0x8ae18ae0,0x82a27a40,0x724069e0,0x7a807240,
-0x7a8082a1,0x726261e0,0x51805180,0x51806a21,0x6a217a62,0x6a215980,0x59c16a42,0x51805180,0x49406202,0x412059e2,0x28604940,0x28404100,0x38e03080,0x49404120,0x598051a0,0x59605960,0x7a846a00,0x69e07201,0x61a05960,0xabe782a1,0x8ac37a42,0x7a407a21,0x92e26160,0x69c08282,0x8ac35920,0x7a409b25,0x82428240,0x930369c1,0xb3c87221,0x71e08241,0x69e08aa3,0x7a6461a0,
-0x41e05a60,0x6b037364,0x52204a20,0x73237303,0x73435a60,0x62637304,0x414049a1,0x18203900,0x30e03100,0x28e028a0,0x49824162,0x9cb341c3,0x000062c8,0xc5952080,0x20803101,0x39843984,0x28e083cd,0x28c02900,0x28c120c0,0x9c4f2080,0x184049c4,0x51e31800,0x49c23100,0x310049a2,0x394130e0,0xc5735224,0xc572cd93,0xa3ad4160,0xb5118b8c,0x838b6287,0x626772c9,0x62275a27,
-0x51c530c2,0x93b0c575,0x498351c6,0x7b6ca491,0x51c65a69,0x6aaa6a89,0x838c49a4,0x9c2f28c1,0x62ecc5f9,0xd6de6aec,0xb5b9b5b9,0xa5586350,0x9cb68c34,0x7bf3a538,0x94b6b5db,0x7bb03168,0x20e4526b,0x62a95228,0x39035207,0x30e349a6,0x62c9b575,0x416351e6,0x30c049a3,0x31004142,0x41844183,0x49854164,0x5a88940f,0x4a0949c7,0x10419473,0x7b2b5a6a,0x5a4730e1,0x94106b0b,
-0x832d4102,0xffff49e6,0x1000ffdd,0x28a0a46e,0xf610de53,0xd551b46b,0x598040c0,0x49604920,0x59c06201,0x62214940,0x59e06a61,0x82e46a02,0x4120e5f4,0x9c0859e0,0x51a038e0,0xc54f51a0,0x30a07ac5,0x61c151a0,0x51607242,0x41007242,0x82c361e0,0x6a008242,0x496059a0,0x6a206a62,0x61e07262,0x6a006a20,0x9b6482c1,0x722069e0,0x82808280,0x82a09341,0x93628aa1,0x8b2182c0,
-0x93216a00,0x6a009343,0x59a05180,0x62007262,0x72426a01,0x6a217a62,0x7ae56a21,0x6a436a63,0x51607aa5,0x412051a1,0x49816a44,0x41005a02,0x49404960,0x59c25180,0x494059c0,0x51415160,0x72834900,0x72415980,0x82837220,0x7a615920,0x72007a60,0x9b247200,0x69a092c3,0x72018241,0x72207a41,0x72009305,0x92e48a83,0x69e0a366,0x9b046160,0x8aa38263,0x92e4bc09,0x61808261,
-0x52605aa1,0x6b235aa1,0x6b036b01,0x522062c2,0x28e03980,0x41803920,0x30e030e0,0x51e34182,0x20a02080,0x20803963,0x416128c0,0xc5b649e5,0x83ee20c0,0x188039a3,0x1860838c,0x5a26a48f,0x28c0e678,0x31013942,0x52463921,0x08003122,0x28e12900,0x30e049a4,0x41a24182,0x28c07328,0x83ab28e0,0x9bca41a2,0x51c3a40d,0xb4cfee78,0x6a88ac8f,0x7b2a7b2a,0x5a276267,0x72cb93ce,
-0x830a834b,0x94306ac9,0xa491acd2,0x734e9c92,0x6aaa6aeb,0x5a486aca,0x314362ea,0x41244984,0x73b0c61a,0x9474b516,0xc63cce9d,0xb5fbc65d,0xa5588c75,0xb5fba579,0x94f7ad9a,0x94b594d7,0xacf3a4f5,0x39243124,0x62682081,0x39235227,0x62a993ce,0x49c46287,0x41633922,0x392249a4,0x41623921,0xb4f35a26,0x730a6269,0x49a55a49,0xa4b55a49,0x20a1de7a,0x41647b2a,0x732c30e2,
-0x180030a1,0xd6152040,0xb44eb511,0x6a22fffc,0xf671ffba,0x5980ff97,0x6a437264,0x6a42a3e9,0x6a626a41,0x72836221,0x62216221,0x6a415160,0x8b6682e5,0x5a006ac1,0x9bc7d590,0xb4cd8304,0x59c06222,0x51604940,0x51a03900,0x7aa47201,0x82c369e0,0x62007240,0x6a6359e0,0x59e072a3,0x6a006a00,0x61c08b03,0x6a007240,0x72209321,0x6a0069e0,0xa3a382c0,0x9b839321,0x93228b00,
-0x8ae19b42,0x69e082c1,0x61c06a20,0x59c059a0,0x59c07ae3,0x620159a0,0x51805980,0x72835160,0x61e17243,0x59c159a0,0x49605180,0x51814940,0x518159a2,0x41004960,0x51804920,0x41205160,0x496038e0,0x514048e0,0x598061e1,0x72215940,0x93247200,0x72207a20,0x722092c3,0x7a417a40,0x92e371e0,0x61808282,0x72007200,0x8ac292c4,0x82607a40,0x8aa469a0,0x92e39304,0x9b059b04,
-0x7ba56302,0x5a8083c6,0x41c07323,0x29004a01,0x31003100,0x51e33100,0x30c04181,0x5a2549a2,0x184028a0,0x30e11840,0x28c030e0,0x41e42900,0x10802900,0x31621880,0x732a0800,0x9c2efffe,0x10200000,0x310218a1,0x20a11000,0x20a05247,0x396220a0,0x29002080,0x31005224,0x28c030e0,0x6b094182,0x51630800,0xc5729bab,0x41623903,0x6a88acb0,0x8b8c5a06,0x28a03903,0x38c16a88,
-0x9b6bd572,0xbd76d617,0xbd9783af,0xa4d5a4d4,0xa4b3a4f4,0x732c8bcf,0x31445227,0x72ec526b,0x62ceacd4,0x9cd5a4d6,0x9d38b599,0xb61bc69e,0xa538a538,0xd6bebe3c,0xa559ce9e,0xbdd9d6ff,0x62cb62ee,0x5a286269,0x7b4c6269,0x49854165,0x28c17ac9,0x49e56ae9,0x49a43963,0x394230e1,0x5a264162,0x836b51c5,0xa4729c50,0x394430e4,0x72ec49a5,0x31245229,0x418549c5,0x28a0730b,
-0xe658ff5a,0x93494902,0x3060ee55,0xff3938a0,0xe613fffd,0xfed58305,0x7ac54920,0x6221cd2e,0x6a626a42,0x620159c0,0x620159e0,0x59c06a61,0x6a819bc6,0x5a005a01,0x49206220,0x93a76203,0x59c051a0,0x40e06a43,0x7a83b46d,0xffbb7283,0x8ae48ae6,0x61c07241,0x51806200,0x59c04100,0x72607261,0x7a609343,0x8b017240,0x8b008ac0,0x69c08ae0,0x8aa248a0,0x93039302,0x72409303,
-0x722082c2,0x724082c1,0x51807282,0x82e459a0,0x7ac35180,0x6a406a41,0x6a006a42,0x6a015980,0x6a4159c0,0x724361e1,0x40e06a23,0x516059a0,0x61e151a0,0x59a05160,0x51804960,0x49405160,0x41004120,0x622438c0,0x49404940,0x51605981,0x512040c0,0x7a817261,0x8aa49304,0x930469a0,0x69c07a21,0x61a07a41,0x72209324,0x48a07201,0x720061a0,0x8ae492e3,0x9b057220,0x92e39b45,
-0x6b036b40,0x52405260,0x312041e2,0x4a002081,0x28e03120,0x5a443100,0x30e128a0,0x416149a2,0x310149a3,0x20411820,0x28e01840,0x314020c0,0x39433101,0x6b090000,0x5a674163,0x72896269,0x836c2060,0x0000940f,0x28c0a4b1,0x20803101,0x20801000,0x28a01000,0x41613960,0x41824120,0x4a663120,0x72c78bcc,0x7a67a46d,0xacf2de38,0x72cb6b2b,0xbd949c70,0xa4b172e9,0x7ae882e7,
-0xd574c4ad,0xb576de18,0xce39bdb7,0xc5d89c93,0xacd38c31,0x83af9cd3,0x312562ac,0xff9f8496,0xc5fa7c11,0x7b927bd1,0x9cf89496,0xc67dbe3d,0xce7c9495,0xd6dece9d,0xa57abe3c,0x7c11be1c,0x28e44a49,0xb5547b6d,0x6a89a4b1,0x6205a491,0x72aa5a27,0x30e1730a,0x41845a26,0x39013942,0x51e54143,0x7b2b30c1,0x4986832c,0x832c6289,0x6aca7b2b,0x184030e5,0x62685266,0x20601840,
-0x834d59c3,0x5a084145,0xbc6dbd11,0xcd2fe612,0xfffb51c1,0x8b48bc8a,0xf61340a0,0x51217aa6,0xb4cb61e0,0x72636201,0x8b6651a0,0xfff88305,0x40e082a1,0x93c772a2,0x72a36241,0x8b876a43,0x61c34140,0x59c26202,0x6a4172a4,0xfef72820,0x6a2069e1,0x82e06220,0x6a206a20,0x6a2059a0,0x8ac07261,0x82809321,0x72207220,0x9b6382a0,0x69e082a0,0x69e04900,0x82a27aa2,0x61a082a2,
-0x59a07a82,0x6a4069e0,0x61c15180,0x59a061e0,0x61a06a01,0x7a606a00,0x724169e0,0x72207a62,0x51a06a00,0x82a55940,0x598059a0,0x82c56a21,0x596069e3,0x59a07a82,0x516059a1,0x49604960,0x412059e2,0x49204100,0x41003080,0x49404960,0x512051a1,0x6a2059c0,0x7a4261a0,0x9b478ac4,0x61408aa2,0x61805920,0x69a09b45,0xfeb39b46,0x406059a0,0x40a050e0,0x61808241,0x8ae37a21,
-0x5a8341c0,0x28e13120,0x28e03981,0x310020a0,0x49c25224,0x49a24161,0x39203940,0x418149a1,0x28c12080,0x184049a4,0x49c43101,0x28e03100,0x49e43120,0x08201040,0x31033102,0xbd13f75c,0x4123732b,0x62a93943,0x28c11820,0x418220a0,0x416228e0,0x28c028e0,0x41623100,0x30c04142,0x310251a2,0xfef9734a,0xc572feb7,0xe617732c,0x938ccdb4,0xac6e93ed,0xcd72c4ad,0x69e38b28,
-0xa3ecc552,0xde79d5f6,0xb555bd55,0x9451ce18,0x9431bd55,0x526aa4b3,0xbd56734e,0x41ea9d58,0x94b662ce,0x739173d2,0x7c358c96,0xbe3bc65c,0xb599c61b,0xcebecebe,0xbe3dcebe,0x9d17b5fc,0x7bd08433,0x93ef4a29,0x7aca6aaa,0x6ac97b0b,0x62487b0b,0x5a2751e6,0x5a27730b,0x414328c0,0xa44f30e1,0x836b4984,0x834d72ea,0x620672e9,0x41448b8c,0x5a4a6aa8,0x62896aee,0x1000836b,
-0x49851000,0xff9c0000,0x4123cd95,0xc511d593,0x40a0ff16,0xff788ae4,0x9367d54f,0xbccd7a84,0x51c27ac5,0x6a225160,0xa3e559a1,0xe611e5d2,0x2000ff32,0xcd2dbcab,0x93a659a0,0x72e47ae4,0x59e24160,0x514261e1,0x598138a0,0x38e093a9,0x726271e2,0x59c0a3ea,0x6a207ac1,0x83036a20,0x82c259e0,0x7a608b23,0x7aa082e1,0x8ae29342,0x72207a20,0x82c46a21,0x7a617a82,0x72417241,
-0x598061e0,0x8ae57aa2,0x61c161e0,0x61e05160,0x6a007221,0x934461a0,0x72618ac2,0x72007261,0x620061c0,0x7aa16a00,0x59607243,0x72219327,0x6a007220,0x59c05140,0x6a426a22,0x51805180,0x49405160,0x410059a1,0x30603900,0x59e32860,0x51814940,0x59a06221,0x69e07243,0x82a17242,0x59207a42,0x594069a2,0x82617201,0x40808aa2,0x69e0c4cd,0x7a2269e0,0x61808ac4,0x93048262,
-0x41a062c2,0x290049a2,0x29002900,0x20a03120,0x31004181,0x49a228c0,0x39203100,0x39203920,0x10003941,0x418328a0,0x20c028a0,0x31403120,0x39623140,0x41c52921,0x49e630e2,0x6aaa0000,0x59e51040,0x39431820,0x20603922,0x31201840,0x310049a2,0x100028c0,0xff7a5225,0x28602880,0xa44d8b89,0x7a85a3ab,0xa3aca3ea,0xd616eeba,0xc5318b09,0xa3aa834a,0xde56ce38,0xd5b3aba9,
-0xe5f4ccef,0xe699cdd5,0xd5f7cdd6,0x736d9cd2,0x734e732c,0x5269838f,0x8bd03146,0x420a8c96,0xa53883b2,0xce7d94d7,0xc67ebe5d,0xce5bc61b,0xdefee71e,0xce9dcebe,0xc65dc67d,0x8476a57a,0xdefdad7a,0x1800d65a,0x8b2c72aa,0xcdf6bcf2,0x6268c554,0x8b8e9c30,0x28c14185,0x72e92080,0x41433922,0x836a93ee,0x7aea72e9,0x6a26a42e,0x3903a40e,0x52265205,0x31032102,0x626830e1,
-0x18206245,0xbd3230e1,0x51406267,0xa40f4964,0x6a455182,0x49807a62,0xf694f631,0x8305dd8f,0x18009b89,0x9bc88b27,0xd54d9b68,0xf6b1a3e1,0x8b25a3a5,0x6a019346,0x5a4069e0,0x51e051e0,0x412059e0,0x40e15180,0x72638b28,0xee3572c5,0x72407200,0xddd37ac5,0x62007283,0x82e359c0,0x7aa259c0,0x72619365,0x6a0069c0,0x72207220,0x69e08ae3,0x69e15140,0x72417a61,0x61c061a0,
-0x7a827241,0x7aa27221,0x728361e0,0x61e159a0,0x72418ae5,0x82a261c0,0x8b027a81,0x8ac259a0,0x59a061e0,0x6a207aa2,0x61a06a00,0x72426a21,0x72215980,0x6a407a80,0x59c061e0,0x72638b47,0x59a05980,0x59c059a0,0x412051c1,0x49204102,0x41205180,0x72c55a21,0x59805160,0x69a061c0,0x7a406981,0x7a407a80,0x72007a23,0x59808261,0x92e47a64,0x7a005960,0xabc97223,0x72018aa4,
-0x39613940,0x182030e0,0x39603961,0x31203140,0x49e24182,0x31003121,0x310030e0,0x28a030e0,0x18403920,0x186030e1,0x28a03941,0x20a028e0,0x72e949a3,0x39823142,0x730a28c0,0x8baf732a,0x6a67ffdd,0x28a0d616,0x28c030c0,0x186028c0,0x5a256aa6,0x30803901,0x72a73901,0x18403900,0x20207284,0x6aa7d591,0x72648b69,0xd5d3ff9a,0xac70cdf6,0xd5f5c511,0xac2ceeb7,0xf675dd0e,
-0xeedae6b9,0xddf4f77c,0xb4f3b4d1,0xb556bd76,0x6371c5fa,0xb5d98475,0x73b3ad59,0x84135311,0xad9a18a5,0xc67ebe1c,0xd6dec67d,0xd6bce71e,0xd6bcdefd,0xcebed6bd,0xbe5dc67e,0xaddcb61c,0xf75ead58,0x9bae4a4a,0xc532eed9,0xf71b7a89,0x8b6cffff,0xa4708bcd,0x30e16288,0x93ad30e1,0x93ad59e5,0x59c672c9,0xffbde678,0x08003102,0x7ae95a06,0x100051e5,0x1820730a,0x41836268,
-0x20002020,0x93cf30e2,0x49842880,0x61e76207,0xd5b5f6da,0x3080ff18,0x69e1ff79,0x28408326,0x61e26a63,0x40801000,0xabe6c4ec,0xff548b04,0xdd8e8b04,0x82c28283,0x62416200,0x51e05a21,0x62036263,0x62224960,0x61e17284,0x9bca1000,0x62027a42,0xbd104940,0x49207ac6,0x72624920,0x620259a0,0x59a09367,0x59a06a01,0x6a205960,0x61c07261,0x7a6261e0,0x72217241,0x7aa361c0,
-0x7a817241,0x6a4161e0,0x722161c0,0x59807242,0x7a605960,0x7a607a82,0x7a8061e0,0x82c27a80,0x6a006a00,0x82a182c2,0x82c16a00,0x72427aa2,0x6a016a00,0x61e07242,0x728361c1,0x518159a0,0x41008307,0x518051a0,0x49607284,0x38e038e0,0x496059e2,0x72434940,0x82e661e1,0x722359c0,0x6a215980,0x7a837a42,0x61808ae5,0x69c07202,0x61a07a40,0x71e05940,0x72208283,0x82847a22,
-0x39403940,0x31403960,0x49c13940,0x41c13980,0x31202060,0x20a03100,0x39203100,0x30e049a2,0x41813100,0x20802080,0x31213100,0x396128e0,0x51e42080,0x39825226,0x08003100,0x730c4184,0x41426289,0x30c13921,0x28a030e0,0xcdd35a26,0x93ee3880,0x5121ff9c,0x30e030e0,0x940a4162,0x61e25180,0xcd0de655,0xfffef674,0xe697f77d,0xf75deef9,0xff7beeb8,0xd591f77b,0xe677ff5a,
-0xffbeffbd,0xf6d9eef9,0xbe1ace18,0x29eba558,0xc63eb5bb,0x212894f7,0xa57a73b4,0x18c7a5ba,0xe75f2107,0xb5dbbe1c,0xcebdb5fb,0xc63ad6bd,0xd6bcdedd,0xce9ddedd,0xcebece9e,0xbe7dc67d,0xbd97ce9c,0xa3ef628b,0xcd32de16,0xff3cc554,0xb44ef71c,0x9bedd5b4,0x4142cd93,0x49844963,0xde5738e2,0x938d59c5,0x5a074103,0x30e12060,0x6aa88b8c,0x08006288,0x30c34184,0x414272ea,
-0x93aa5182,0xc5544123,0x5209c596,0xc575de7a,0x9baa6288,0x8b2859c2,0x93079baa,0xbcaf5a04,0x514138c0,0x82a3b42a,0xff36fff9,0xff369ba6,0xddd0e653,0x72a182e5,0x6a805a21,0x51c06a82,0x59c24120,0x59e15180,0x51a059c1,0xbc8d6203,0x72437220,0xff18ac4c,0x51609367,0x59e159c0,0x61e15180,0x72429367,0x51804100,0x61c14920,0xa3e859c0,0x512059a0,0x72426a01,0x61c06a00,
-0x82e27a81,0x62007261,0x7aa29344,0x69e061c0,0x82a15960,0x720082a2,0x72406a20,0x82a16a00,0x61a069e0,0x7a807220,0x7aa09343,0x40a082e1,0x8b047221,0x72617a83,0x61e182c5,0x59e059c0,0x62016221,0x51804100,0x518051a0,0x41204960,0x41004940,0x51a04960,0x41204120,0x38804120,0x51804920,0x40a061c2,0x30604920,0x61c05980,0x7a625980,0x7a219305,0x61605100,0x82835920,
-0x49c23120,0x418149c2,0x418149c1,0x49e33960,0x49a22880,0x28a03940,0x51c44182,0x30e05204,0x312130e0,0x20803940,0x28e15a89,0x39211840,0x18604183,0x184028c0,0x394328e0,0x31028bce,0x390249c4,0x5a262860,0x28a04140,0x41434183,0x51e549a3,0x51836a47,0x41624121,0x8b689c2e,0xcd3071e4,0xab89e613,0xee4fed6e,0xf738d5d0,0xffffffdf,0xffdeffff,0xff7aff9e,0xff7cff7e,
-0xffbeff9d,0xef5dffbe,0xbe1bdedd,0xbe3dad9a,0x94d70887,0xdf3fb5fb,0xce9ec65d,0x7390be1b,0x6b919cd7,0xa57bcebf,0xc63e8477,0xad9894d6,0xe71dd67c,0xdefddefd,0xd6bdd6bd,0xe6ddd6bd,0xd638ef1d,0xe6159c0f,0xcd52cdd5,0xd5d6bcd0,0xa42d7aea,0xe676e676,0x72a8a46e,0x93cc6a46,0x30a130c1,0x7ae97ac9,0xa44fbcf1,0x20a1ff19,0x18200800,0x5a062020,0x29027b4a,0x418272ea,
-0x62476a66,0x938d51a5,0xb535a4d3,0xd617d638,0x832c28a2,0x6ac94922,0x936bac4c,0x38c07266,0xa44d2860,0xdd0d8b48,0xfeb582e5,0xff77ff36,0x7263c4cc,0xf671c4aa,0x62006200,0x412049a0,0x414051c1,0x8b284120,0x5a024980,0xb4ab6a42,0x38c07a63,0x59c16a44,0x6a639bc9,0x51e0c52e,0x59e05a20,0x6a6182e5,0x51807aa4,0x492061e1,0x6a425980,0x7a846a21,0x6a006a01,0x72406a00,
-0x7aa17a81,0x7a817240,0x6a007ac1,0x72416a00,0x724169e0,0x7a817220,0x72407240,0x61e07240,0x6a206a00,0x934482a2,0x7a808ac2,0x6a216a20,0x7a628b06,0x6a217261,0x6a205160,0x59c169e1,0x49405140,0x51815181,0x49404960,0x51a138c0,0x6a636202,0x726359c1,0x51a17285,0x620251a1,0x516059e1,0x490038a0,0x6a016a22,0x61e08ac3,0x7a4169e0,0x82836a01,0xc4ab6180,0x61a07a61,
-0x41a16ae6,0x39403120,0x314049c1,0x41c15a65,0x31003920,0x206041a1,0x28a04160,0x49e33940,0x20a04181,0x41635a66,0x41c441a4,0x414141a3,0x39622080,0x416228e0,0x41a43963,0x7b4b1840,0x39226288,0x8349ff7b,0x3900cd94,0x18204142,0x49c528a0,0x30c04964,0x394230e0,0x7a87734b,0xfed62000,0x69c08aa4,0xffbeccec,0xff7dff7d,0xffffffdf,0xffffffff,0xff9dffde,0xff7cff7d,
-0xffbeffbd,0xef5effbe,0xb5fbd6fe,0x5b516bb3,0xbe1c7bf4,0xce5cdeff,0xd67cb599,0x4a2ace3a,0x8435be3b,0xcebfc67e,0x84986bd5,0x94958c76,0xef1de6dd,0xef1def1d,0xe71de6fd,0xf75de71d,0xf71ceefb,0xc552ff5c,0xd5b4f73b,0xc534938b,0xcd737288,0xe657eed9,0x9c0fe678,0xc595c554,0xacd351e7,0xcd52a42f,0xde78ff9b,0xff191000,0x51e65a05,0x1020a490,0x10002924,0x30c028a1,
-0x4164bcf1,0x5a094145,0x8c1083cf,0x7b4ca492,0x9cb251e8,0xd6371000,0x38e0b4cf,0x8b2a6a67,0xa42e3902,0x9349e698,0x61a1bd11,0xfffbffdb,0x38c0b4cd,0x6a007221,0x72828b45,0x49605a03,0x41605a22,0x7ac6b4ad,0x496051a1,0xcd0d6244,0x49207222,0x59c06203,0x496061e1,0xcd6fa429,0x59e051c0,0x59e06202,0x51609367,0x59a061e1,0x51805180,0x6a0261e2,0x6a007aa3,0x82c082a3,
-0x93637a80,0x82c08ae1,0x82e27240,0x6a007220,0x82a27a61,0x6a007220,0x69e07a81,0x6a007a60,0x61e059a0,0x69e07a81,0x61a08ae3,0x82c38b23,0x51205980,0x72827261,0x7aa37262,0x61e069e0,0x72647262,0x49204940,0x59e34120,0x59c19369,0x6a226201,0x59e059e1,0x410061e1,0x412038c0,0x38e04120,0x51a038c0,0x69e05180,0x61e19323,0x6a006180,0x82627221,0x5921bc4a,0x30004080,
-0x41a141c2,0x520328c0,0x392028c0,0x418149c2,0x394049c2,0x41814161,0x39204160,0x6ae94a03,0x628749e2,0x1840a4f1,0x396130e1,0x7b4a3941,0x41623121,0x20603942,0x28e05205,0x28e04184,0x18402080,0xac8f4983,0x288051c4,0x392130c0,0x31011840,0x41633901,0x28e22040,0x6a2638e2,0x9b8749c3,0xff9bbccd,0xff7be613,0xffdfffff,0xffffffff,0xffffffff,0xffdfffdf,0xffbeffbe,
-0xff9effbe,0xdf1cf77f,0xaddbc69c,0x94b6428e,0x39caa538,0xb598c5f9,0xdedda536,0x6b51422c,0x94d8be1b,0x95199d19,0xcebe6b92,0x8c54ad59,0xe69ac5b9,0xeefcf71d,0xf73cef1c,0xf75ceefb,0xe657ef1b,0xf73aeeb7,0xde77d616,0xa42ede37,0xf6f9cd94,0xff3affdb,0xe698ce56,0xa492f71b,0x5a2a8c11,0x20006249,0xff9d4922,0xf79cffde,0x10219c50,0x18840801,0x0822734f,0x28c2730d,
-0xa4b39c50,0x62cf9453,0x9c9349c9,0x72eba492,0x4144bd75,0x934cc637,0xb4f2de95,0xde1572eb,0x938b3901,0xff9ee678,0xff5bbcd0,0xff7bee97,0xfffce675,0xddb1f718,0xe5afc4cd,0x41407ae7,0x622251c2,0xc50fc50e,0x59c2ddf2,0xac0b3900,0x51606180,0x7b0659c2,0x622159c2,0xb46b2020,0x59a0ff79,0x51806201,0x59e159e1,0x59c24940,0x494059c1,0x518059c1,0x61e04940,0x59a059c0,
-0x8b2382e2,0x9b838b01,0x72207a80,0x72207a81,0x72407221,0x82c27a80,0x8b029323,0x7a807220,0x722082c2,0x6a206a20,0x7aa17240,0x932382c1,0x6a0069c2,0x61a07a63,0x72015980,0x93477a62,0x61c07222,0x61e06a42,0x49206202,0x49205181,0x62225180,0x41006a22,0x59a14100,0x30c04980,0x41414120,0x51614960,0x6a205980,0x9b8582a2,0x82c0ac27,0x72208aa1,0x72208ae3,0x61406180,
-0x49c241c2,0x39406286,0x520328e0,0x49c23100,0x51c34161,0x49a33921,0x49c449a3,0xd637cdd4,0xd63741a3,0x41a3dedb,0x31004162,0x41635a25,0x39623941,0x30e149c5,0x31013942,0x49c52081,0x41622080,0x418228c0,0x39214162,0x41824142,0x41a34183,0x3101de15,0x5a8928a0,0x59c52040,0xee7582e8,0xf75aeed9,0xffdcde15,0xffffffdf,0xffffffff,0xffffffff,0xffdeffdf,0xff9effbe,
-0xd6dbff7e,0xd69ddedd,0x9d17ad99,0xce5c8434,0xa4b4a516,0xc61abdb8,0xb5dbce7c,0x420d8c96,0xbe1c7c13,0x84776352,0xa5399cf9,0xad57b599,0xe69ad65b,0xef3cef1c,0xef1cf73c,0xff7dff7d,0xff7ce6da,0xe6b9ff39,0xeefaeefb,0x72eaf73b,0xde78bd54,0xc532938b,0x5249b4d1,0x6350730f,0x62ce8c96,0xc574acf6,0xffbea491,0x6b4d2903,0x6b4f20e6,0xa4f6528c,0xa4f683f2,0x188341c9,
-0x29255208,0x73b17bd1,0x62ee6330,0x9cb4acf6,0xacb3de9c,0xac91f77c,0x49a6d616,0x2060cdb6,0x832a5a07,0x9c937b4c,0xffffc595,0xfeb7e5f3,0xffb9f672,0xbbe761c0,0x516061a2,0x72e593aa,0x41203920,0x6a434940,0x30802020,0x7a854980,0x51807242,0x49604120,0xc4ef4120,0xcd717ac3,0xff97f6d4,0x7aa238e0,0x7ac36a62,0x59c161e2,0x62225180,0x6a234100,0x62014940,0x69e16201,
-0x6a006a00,0x9b627aa1,0x7a808b21,0x72207a60,0x7a818ae1,0x82c27240,0x8b0282a2,0x7a8082c1,0x8b047240,0x6a2161c0,0x72826a42,0x726261c1,0x596061c0,0x72407a81,0x7a8082a2,0x6a207a60,0x61c061c0,0x61e06201,0x494059c0,0x61e16202,0x622259c1,0x51a159e1,0x61e259a1,0x49805180,0x38e04981,0x51803900,0x59c04900,0x93657240,0x8ae082c3,0x8ae292e2,0x72008281,0x61a07a61,
-0x31202900,0x28e03140,0x41823961,0x49e141a1,0x52234182,0x49c33962,0x08003100,0x41a6ce37,0x4164834c,0x8bae4183,0x310028a0,0x41825204,0x31213962,0x41625205,0x39433101,0x10003121,0x49c41820,0x6a863101,0x41824182,0x312128c0,0x20a03982,0x49a54123,0x7b6e2081,0xeeb8ce18,0xa4d1c574,0xd679ef1b,0x9c30f79e,0xf75fffbf,0xff9def5d,0xffffffdf,0xf7beffdf,0xef5ef79e,
-0xc63ae71c,0xc5f8d6bc,0x7bd0d69b,0xce3a9c93,0xb557a4d5,0xb5da8454,0xbe5eadfd,0x6b93e75f,0x6bd49d19,0x9cb88456,0xd6bcce5b,0xd69bbe19,0xf73deedc,0xf75def3c,0xe6ddef1e,0xe67ae6fd,0xc555eeda,0xffbeff1a,0xe6daeefb,0xbdb5e67a,0xbd97cdd8,0x9453d699,0x9cf6a4d6,0xa5398414,0x9c53ad38,0xef1cce19,0xf79e0000,0x84965aef,0x29ab7436,0x424c0003,0x4a4dbe1b,0x1045ad17,
-0x524a5a8a,0xacf72927,0xef9f8414,0x9d188c96,0x4164c61a,0x838ecdb7,0x9c7341e7,0x732c5247,0x3984522b,0xad15736d,0xbd76d67c,0xffbae678,0xb42addf0,0xfff992e3,0x49406200,0x72e52860,0x72c851e2,0x5a236263,0x936959c2,0x624340e0,0x498061c1,0x38e051e3,0x6a434980,0xb4299bc7,0x59837240,0x6a402800,0x62215180,0x7ac46aa3,0x49005980,0x51605140,0x6a2240e0,0x6a214920,
-0x61e05980,0x72406a20,0x7a809304,0x7a607220,0x7a607a60,0x72409322,0x69c082c1,0x82e26a00,0x724361a0,0x59c07ac4,0x49204960,0x72616200,0x51406a00,0x726182e0,0x72006a00,0x72607240,0x69e07a81,0x59605980,0x72227222,0x61e07262,0x518059c0,0x61e26202,0x41205160,0x49815181,0x414038e0,0x38e04120,0x83045160,0x8b268b46,0x82c26a60,0x72407260,0x93077240,0x7a645100,
-0x39613980,0x49a21820,0x394028e0,0x31203100,0x18203961,0x392128a0,0xe6d949c5,0x730a9cb1,0x20601000,0x49a33102,0x39413960,0x394149a3,0x39413120,0x39423901,0x49c45205,0x20601840,0x31213922,0x498349c4,0x28e05a05,0x31013921,0xa4b22081,0x188128c1,0x5a896b0a,0xff9f7bae,0xad15f75e,0xef3ebdb9,0xd6bdef3e,0xe75fce7c,0xff9eef5e,0xffdfffbf,0xef5ef79f,0xe71def3d,
-0xce7bd6bc,0xdedcd69c,0xc5f89cb3,0xdefcbdd6,0x18c65ace,0xa55ab5da,0xb63e5b94,0x3a2e7c15,0x218badbc,0x5ad06bb3,0xbdfba538,0xd67cce7c,0xf73de6fd,0xef1cef1c,0xde9ce6dd,0xf71ddedc,0xde38c5d7,0xeefceeb9,0xe6dbcdf8,0xd65acdf8,0x8413c5da,0x5aefbdd9,0x6b737372,0x52ae6310,0xffdf7350,0x94b70002,0x8435ce7e,0x5331c67e,0x29cc84b8,0x3a0d7c15,0x21496351,0x5a8e5aae,
-0x4a2ba4f5,0xc5fa7bb1,0x5b110865,0xd6df5b10,0x30e3ce3b,0x628b1001,0x3125b596,0x83cf2905,0x7b5083d1,0x94b239a7,0xe6fdb578,0xcdd5d619,0xccecff39,0x8b27a387,0x9bc8abc9,0x40c030a0,0x93abac0b,0x41206243,0x51609389,0x7ae55181,0x51a16222,0x41404980,0x000051e1,0x72824940,0xffd5bcab,0x8b22bd6c,0x5a2461e1,0x8b257201,0x6a216a41,0x622259a0,0x62015181,0x59a07263,
-0x72625160,0x59a05980,0x722082a2,0x8ae17a60,0x7a608b22,0x72208b22,0x82c17220,0x82a28ac3,0x61a07262,0x62014920,0x51805160,0x62006a41,0x61e07a82,0x7a816a40,0x8b037a81,0x7aa09343,0x6a007a80,0x69e07a82,0x7a836a01,0x6a0159c0,0x6a636a42,0x41205180,0x51a26202,0x49604960,0x49814120,0x49604940,0x72826a22,0x51607aa3,0x51405160,0x72208ae3,0x59607220,0x82829b86,
-0x28e03140,0x31203960,0x41804182,0x28e03100,0x182030e0,0x39414183,0x3141836d,0x29010820,0x49a56aa8,0x31211840,0x310049c5,0x49c349e4,0x39213100,0x39223942,0x30e128c0,0x310049c5,0x52053942,0x39013101,0x41813941,0x39423941,0x41a43141,0x39861840,0x7bd28bf2,0xb5d9a517,0xa4f594d5,0xd69d9433,0xd6bdd6bd,0xe6dcce5b,0xff7eef5e,0xf77ef77e,0xe71de73e,0xd6fde71d,
-0xd6bcd6bd,0xbdd8ce7b,0xe6fcdebb,0x6b93b597,0x9d1994f9,0x8cd88cba,0x84785b95,0x112b5b32,0x8c974b12,0xcebf6b93,0x52d19d1a,0xc5db9497,0xe6dcce7c,0xe6dce6dd,0xdedcd65b,0xbdb8e6dc,0xef1cd659,0xbd77f75c,0xbd97acf5,0x7392d67b,0x73d494b8,0x08688c99,0x00440006,0xc63c0046,0xce3bf77f,0xceff8414,0x4ad13a2e,0x21cd73f4,0x4aaf4b11,0x9d5b4270,0x73d46b94,0x73923a0d,
-0x94b7528e,0xad986b70,0x52ce31aa,0x8c768c76,0x416683b1,0x72edc578,0x8bf2ad15,0x9cb483cf,0x5acdb599,0xad5a5acf,0xd69ca538,0xf77ba4f4,0xc4cdfffc,0xef587b87,0x20004100,0x182030a0,0xfe97ff16,0x5140ddb1,0x4940ac4c,0x59a02060,0xb48e5200,0x5a007260,0x61e14960,0xeed39bc8,0x8a88ffd9,0x82a283cd,0x39a84141,0x9bc9f79f,0x7a859347,0x59c061e2,0x6a226a22,0x59c059a0,
-0x6a2159c0,0x7aa06a20,0x7a6082a2,0x72008ae2,0x7a8082c1,0x724082c1,0x722182a1,0x7a627a60,0x724061c0,0x59a05180,0x494059a0,0x72614940,0x6a007a82,0x7a8161a0,0x82e16a00,0x82e05980,0x82c19342,0x8b047a60,0x6a007aa2,0x6a226a42,0x62026201,0x49405181,0x59c26202,0x49604120,0x41404140,0x59c15180,0x51606a22,0x7aa459c0,0x61a16200,0x61a05980,0x9b467a60,0x9b665960,
-0x39413140,0x184028a0,0x39604182,0x39603960,0x18602080,0x31004182,0x418328c0,0x41432040,0x28a028a0,0x49c41820,0x28c028e0,0x39423940,0x28c028e0,0x20a04162,0x39424183,0x39624183,0x28c03921,0x41823921,0x41a23962,0x28a04163,0x41a63122,0x7bf120c4,0x8cb631cc,0xad58a579,0x62acad58,0xc5fa51e8,0xd69cd69c,0xef7edefd,0xf73df77e,0xef5def5d,0xe6fdef3e,0xdeddd6bc,
-0xe73ee6fe,0xdebbdedc,0xd69bd69a,0x7c35b598,0x9d3b7415,0x84b99519,0x8cda63d4,0x63b4adbb,0x847742b1,0x5b747436,0x94d85312,0xbdb8b5da,0xe6fdce5b,0xd65be6dd,0xd67bdedd,0xd65cb577,0x6b509cb6,0xce5ce6fe,0xb5b9bdfa,0x7bf4bdba,0xa5dda57a,0x10ea7416,0xb61e9539,0x4acf8499,0xb5dbef9f,0x9d3b0048,0x9d598477,0x53338d19,0x3a6f0005,0x29ad0003,0x84358c97,0x632f0865,
-0x9d1873b3,0x7c358cb7,0x94957391,0xdebd630e,0xa4b4bd78,0xb5379c94,0x1021732f,0x39687b8f,0x316883f3,0xc63c6311,0xd63bad38,0xff9e41c8,0xffdec5d4,0xde35ffdc,0xc550fffa,0x204038c0,0xf676ff57,0xe616a369,0xbced9346,0x59c038a0,0xc50e4140,0x202038c0,0x7ae64120,0x39006222,0xe6768b48,0x5182a4b3,0x845230e0,0x522bd69c,0x8befdebb,0x518493cd,0x6a226a02,0x49805180,
-0x7a826a41,0x72617240,0x6a007a82,0x724082a1,0x7a407a60,0x93237a80,0x82a19b63,0x8ae382a1,0x6a617a81,0x51605160,0x62024960,0x8b247282,0x7aa18b03,0x518061c2,0x6a006a20,0x61c06a20,0x7a817240,0x61a07260,0x82c25160,0x6a016a01,0x6a217221,0x61e159a0,0x51805180,0x59e140e0,0x41205180,0x59c14920,0x59a05180,0x61e06200,0x59a07ac4,0x514059c0,0x7a6061c0,0x61e07240,
-0x312028e0,0x520328e0,0x39413960,0x20a03120,0x41812080,0x28e03941,0x30e04983,0x28c03921,0x28a028a0,0x30e03942,0x396049c4,0x394051e5,0x39623941,0x39213121,0x41824182,0x28e03961,0x31213120,0x310128c0,0x5a273922,0x72e93100,0x29462902,0x29876b4d,0x5b314a8f,0x8c748455,0xc5359473,0xcdd89c30,0xf73edebc,0xf75de6bb,0xef1cf77e,0xf77eef5d,0xef5def5d,0xe71eef5d,
-0xd67bdefd,0xd67bd67b,0xc61ad65b,0x84b89cf7,0x84979d59,0x8cf98d19,0xb5fe957a,0x9d3a8475,0x94b76bd4,0x8cfa951a,0x6bb49d5b,0xce5ad6dd,0xa536bdfa,0xb5bab5ba,0x8414bddb,0xc65dc63c,0xa57cadbb,0xb5fca57c,0xaddba59a,0x7437adbc,0x5374a59c,0x7c79b65e,0xcedf63b6,0xa57b3a70,0x84576bb4,0x8d19953a,0x29cf7c98,0xb65f84bb,0x63b47c57,0x84787c34,0x84356352,0x7bd21085,
-0x8c968cb7,0xd6df9d18,0x6b70a517,0x49ca8bf1,0x7391528c,0x4a0a7310,0x39269c93,0x4a4c28a4,0x1063ad59,0xc65c52af,0x6b2f4a4c,0xb5576b50,0xeebbc5b9,0x7b2bfe33,0xfffc72a6,0x83094101,0xfffd940e,0x93ac3880,0x61e4ff99,0x59c2f676,0xac4c4122,0x51804100,0x72a451a1,0xffff6204,0x4a489c0d,0x4941ad35,0xa5992040,0x94b6ad78,0x4a4ce6fe,0xf75fffff,0x59a0736e,0x622359c0,
-0x8ae46a22,0x61c06a00,0x514059a0,0x622151a0,0x7a825980,0x8ae27a81,0x69e08b02,0x8ac29323,0x72a26200,0x59c16a23,0x61e16202,0x6a2159c0,0x7aa18b24,0x62005100,0x6a006a20,0x6a206a00,0x59c059e0,0x72207241,0x59a05160,0x7aa27aa2,0x62207a61,0x518061e0,0x59c05180,0x61e051a0,0x6a236a01,0x62016202,0x494051a0,0x38c05160,0x61e05180,0x59c15180,0x39012000,0xa3659366,
-0x31003100,0x49e24182,0x41824181,0x10003120,0x49e449e4,0x520428a0,0x498372c9,0x41424162,0x394130c0,0x39214143,0x392028a0,0x39003100,0x39213941,0x312028e0,0x20803100,0x39413921,0x29003921,0x31213142,0x52253121,0x20813981,0xd67a1860,0x08626b90,0x7b4eadb8,0x6b2d39ca,0xa4b33985,0xbd36e6bb,0xf77de6dc,0xffbeff9d,0xff7df75c,0xf75df77d,0xef3df75d,0xd69cdf1d,
-0xc61ace9c,0xc5fbce3b,0xad9ab5ba,0x4b32953a,0x6bf79d5b,0x84fa84b9,0x94d673d6,0x94759cf7,0xd6ff8454,0x84d98478,0x9d5a955a,0xc65c9496,0xb5bac65c,0xb5dbbddb,0xbdfcb59b,0x94f9be1b,0x955ba59b,0xb5dc4a91,0x8cd9a59b,0x955c9d7b,0x9d9d8cfb,0x6c168d39,0x194d322f,0x63d563b4,0x6c163230,0x8d1b8d1b,0x53549d7d,0x7c178479,0x320c192a,0x7c76218b,0x6bb2218b,0x6bb394d5,
-0x73b44aaf,0xb5dc31cc,0x00449cf7,0x4a6e18e8,0x8c95ad9a,0x732fad7a,0x4a0b732f,0x29483125,0x4a6d94d6,0x4a2c18c7,0x4a4dbdfa,0x29259474,0x28a36aad,0x720682c8,0x61a4fffd,0x9baba44f,0x4962ffdc,0x20003080,0x38e01800,0x49804981,0xc4ad1000,0x28607243,0xffda59c2,0xbd75ff5b,0xce5ba4b3,0x28e0ce9b,0x8c543942,0xffffad58,0x2968c63b,0x18c55aef,0x6203ffff,0x30c030a0,
-0x6a455a28,0x61a07aa4,0x7aa382a3,0x61e06200,0x59c05180,0x61e06a20,0x6a216a41,0x8b256a00,0x7a818b04,0x51815980,0x49604960,0x7ac33900,0x59c07262,0x82c35160,0x82c25120,0x7ac26a00,0x62008b24,0x82e361a0,0x6a016a20,0x8b0461c0,0x72616a00,0x59a082c2,0x61c06a20,0x6a017262,0x59a06a01,0x59a06a22,0x51604940,0x620161e1,0x59806a22,0x6a414940,0x83076200,0x100038e0,
-0x396049c2,0x39413940,0x418228e0,0x39603121,0x62264982,0x28a04182,0x62674162,0x41624982,0x39414962,0x30c051e5,0x418228a0,0x39414162,0x28a03121,0x39413120,0x31213100,0x28a020a0,0x20a03921,0x28e04183,0x39643141,0x5a6928e0,0x634e4a69,0x4a4db5b9,0x83ce6b72,0xde78d699,0xdedcd659,0xf77dce7b,0xf73be6da,0xde78ef1b,0xff7df77c,0xf77df77d,0xe71df77d,0xce9cdedc,
-0xaddcbe3d,0x8cb8a59b,0x74788d1a,0x6bf794fa,0x7437a59c,0x9d7b8cf9,0xb597a537,0xb5986b0f,0x4ab0ad7a,0x8cfb9d5a,0x951a8498,0xad9b8c98,0xadbcb5dc,0xa57bb5fc,0xbe3db61b,0x9d9ba55a,0x953ab65f,0x9d5b7c79,0x957c8d1a,0x63f78499,0x8cfbb63f,0x74378d1b,0x7c794b12,0x7c587457,0x745784b9,0x63f563b5,0x6c367477,0x42d25333,0x53114291,0x6bd56bb5,0xc65c6bd5,0x52d02129,
-0x4a8f4aaf,0x3a0d39ec,0x3a0e52f1,0x951a8497,0x7bf329ab,0x730e7371,0x6b0e7bf3,0x945520a3,0x39ca62cf,0x7bd339cb,0x6b5152ad,0x7baf7bd1,0xe6dddedc,0xd6163881,0x20407ac9,0x8264fe96,0x82c682c6,0x38a061c3,0x4141f635,0x49815a04,0x40c03901,0x61a130a0,0xfed90800,0x4146e6dc,0xad39a4f6,0x31037c14,0xd6bd3142,0xd69dbdf9,0xc61b94b5,0xd6beb5ba,0x51a2ce18,0x51814941,
-0xef7f62ef,0x5205a4d2,0x69e06a23,0x59a06200,0x59a15160,0x6a025180,0x6a0059c0,0x72407a83,0x61a07a82,0x51a07261,0x49405180,0x49204961,0x61e07aa4,0x7aa24900,0x82c161e0,0x59c08b04,0x620059c0,0x61e07221,0x72415140,0x72606a20,0x932282e1,0x72607a60,0x6a0082e1,0x59a06a00,0x61e059a0,0x620061e0,0x59a07242,0x59a05160,0x51806a22,0x59a06a42,0x51603060,0x83256a25,
-0x31004160,0x30e03920,0x30c03940,0x51c41840,0x51e33920,0x51a33942,0x28204142,0x51c46226,0x28a030c0,0x20604982,0x31004182,0x28a04162,0x39614182,0x30e04182,0x39403120,0x31213142,0x20a02901,0x7b0b8bed,0x18402900,0x20823123,0xb5570842,0x3a2d73f4,0x8c11c63b,0xc5d7d639,0xd69cce79,0xef1bdebc,0xff7def1b,0xffbeff7d,0xf77cffbd,0xf75cf73c,0xe71eef3c,0xb63cdedd,
-0xa59b9d7b,0x84b9953b,0x8cd9955b,0x951a8479,0x8498953c,0x9d178d1b,0xad55b597,0xa4d7b578,0x4b1294d7,0x9d5c9d5a,0x8d1a9d7c,0x9d7b7c79,0xa5bc8d1a,0x84989d9c,0xb5dcbdfb,0x953b94f9,0x8d1a6c38,0x84f963b6,0x84b9953b,0x851c7437,0x84da8d1b,0x42d2955d,0x29ed63d7,0x6bf6a59b,0x53547c99,0x53742a31,0x7c9963d6,0x955b8499,0x7c578cd9,0x6bd74af1,0x00469d7b,0x6bb54a8f,
-0x18e873f5,0x7c148456,0x94d98477,0x9519b63c,0x84565af2,0x18c54a8c,0x20c6526d,0x8c5430c5,0x18856b51,0x9d1839ea,0xbe3d52cf,0x8c539cd6,0xa4d62926,0xff9dd5f8,0xb46e2840,0x8329b490,0x82c64921,0x7287936a,0x5982ee54,0x41614161,0xcd4fcd33,0x308040c0,0xb5565162,0xbe1bb61b,0x9d38b5fa,0x1820d6ff,0x94f730e1,0xa599defe,0xb5b9a537,0xd6bdc65b,0x59e4acb2,0xeeb93080,
-0x9cd383ae,0x5a8cf75f,0x82e5acb2,0x724382a5,0x6a426a01,0x516059a0,0x59a06a22,0x62006a21,0x62215160,0x59e16a61,0x40e05160,0x51805160,0x6a016a21,0x720159c1,0x830361c0,0x8b246a40,0x62007280,0x7a8082c2,0x72607240,0x8ae27240,0x8ae09323,0x8ac09321,0x93207a40,0x69e09302,0x61e061c0,0x61c069e1,0x7a6261c0,0x61a069e1,0x7a6382a4,0x51605100,0x6a626a41,0x41006a21,
-0x28c049c2,0x52034161,0x418230e0,0x51e33920,0x49824161,0x30c051c3,0x51a349a5,0x93ab832a,0x41613900,0x31004141,0x41623100,0x39413941,0x49c33962,0x39623941,0x28c030e0,0x41a449e4,0x49e528e1,0xe73c3144,0x83ad30e2,0x186249e7,0x5a8dbdb8,0x41c9526b,0xa4d58456,0xd6799431,0xc5b8b554,0xeefc9452,0xffbef73c,0xff9dff7d,0xf75df77d,0xf75df75d,0xd69de71e,0xadbcc63d,
-0xa5bba5dc,0x953b9d7c,0x8cfa9d7b,0x9d7c8cda,0x9d5a8cd9,0xbdfaa559,0xb596de9b,0x9cd783d2,0x6bd6b5fc,0x8cd99d9b,0x953b9d5c,0x8d3a84ba,0x955a84b9,0xadbc9d9c,0xaddcb5dc,0x9d7c955b,0x8d3a957c,0x84da6bf7,0x74588d1b,0x5bd78d1b,0x8d1b955c,0x32308cfb,0x42924b13,0x84b96bd7,0x64177458,0x5bb584da,0x4b332a2f,0xb63f7c78,0x3a4f112b,0x000473d3,0x4ad1426e,0x8cb8adfd,
-0x52d173f5,0x7c364ab0,0x8cb952f1,0x63747c37,0xef7f426e,0x21070002,0x394620e5,0xad387b90,0x8c334a4d,0x52ce422b,0xa57a8476,0xad9aa539,0xa517e6ff,0x08000801,0xd5b3cd94,0xb46eff3a,0xff7ab4af,0x6a05f697,0x51632840,0x416130e0,0xe615e5f4,0x59c4e615,0xbd97bd12,0xb5dcb5db,0x9495b5dc,0x4a08df1f,0x000230e2,0x5b3183f4,0xbdfc94b7,0xc65aa539,0xc57351c7,0x31063902,
-0x93d051c9,0x18a4a515,0xf6fa0801,0x61e08306,0x62016a42,0x61e161e1,0x620161e1,0x61e159a0,0x59a05160,0x59e15180,0x49404120,0x62227aa5,0x6a0261c1,0x61e24900,0x59c06a22,0x62016a21,0x8b646a60,0x724069e0,0x6a206a00,0x7a807a60,0x7a607a80,0x82c18280,0x932182a0,0x6a007240,0x61e07220,0x72417241,0x69e082a3,0x72217a62,0x61c07262,0x724182c3,0x61c07a83,0x7a6261c0,
-0x31004160,0x41613100,0x39204161,0x5a234181,0x49624162,0x52054961,0x834a7b4b,0x494272a8,0x41214141,0x418230e0,0x39213921,0x5a254182,0x30e15225,0x28c028c0,0x31213101,0x31013942,0x18a162a7,0x5b6e18e2,0x6b2bb4d3,0x5a8a5269,0x314741c8,0x39ca6b50,0x6b0e7394,0xc617940f,0x9c72bd55,0xe6bccdf9,0xf75ceefc,0xff7dff7d,0xef1cf75d,0xe6fce71d,0xbe1cce7c,0xadbdadbc,
-0xa5bca5bb,0xa59c955b,0x8d1a951a,0x9d9c7438,0x9d19a55b,0xd67bc61b,0x528ae6dc,0x5b1183f2,0x9d7c8477,0x8cfa84b7,0x9d7c955b,0x957b8cfb,0x955a9d5b,0xa59c8d1a,0x9d7ba59b,0x8cfa8d5b,0x8d1a8d5c,0x74597438,0x84ba63d7,0x7cdb8d1b,0x8cfa9d7c,0x533484da,0x84b95355,0x8cfa6c17,0x7c9a9d7c,0x74787477,0x63d63ab1,0x74375313,0x8cd99d7c,0x088731ae,0x7c789cfb,0x84779d9c,
-0x8cfab5dd,0x7c576bf5,0x9d1a6374,0x63b27415,0x63505b2f,0x7bd2a518,0x418662cb,0x73522106,0x4a0b8c34,0x9cf73189,0x0866298a,0xb5fdb5dc,0x31aab59c,0x100083d0,0x2040acb1,0xff39ffdc,0xde987b2a,0x61a493ed,0xff3830c0,0x41402880,0xcd549c0a,0x6a67fffe,0x39a7ff7d,0xbe1bbe3c,0xd63bef9f,0xe6fda558,0xe6bb3902,0x7c120001,0xd6bd18e6,0xbe38d6bd,0x7b2a1821,0xbe3b5206,
-0x0000bdd9,0xffffbdd8,0x734e732f,0x62217b0e,0x494061e1,0x6a026a22,0x59806201,0x6a4359a0,0x494059c1,0x726359a1,0x30605182,0x59c17264,0x6a0359a1,0x830740c0,0x61c159e2,0x38c04920,0x8b426a60,0x7a807240,0x72407260,0x934282e1,0x7a607a80,0x72609323,0x8aa07240,0x82c27a80,0x72406a20,0x6a007a82,0x6a0069e0,0x6a2061e0,0x6a2082c3,0x7a6261c0,0x8ae48281,0x82827221,
-0x39204981,0x41414161,0x414151e3,0x38e049a3,0x6a873920,0x20605a05,0x940e1000,0x5a2530c0,0x41614982,0x28a051c4,0x208051e4,0x49e430e0,0x18403942,0x208030c0,0x398218a0,0x84113145,0x20c48bd0,0xbdda9cb5,0x5a6a628b,0x83af62ec,0x524c630d,0x528b4209,0x52cfa538,0x41a9422d,0xad577c11,0xad17ad58,0xef3ddebc,0xef1def3d,0xd6bcdedd,0xb5fcd69d,0xadbcaddc,0xa59ca59c,
-0x953ba5bc,0x957c9d7c,0x953b953b,0x9d3a8cd9,0xa57a9d5b,0xce5bbdba,0xce7ace5b,0x94d88c97,0x953a6bd4,0x9d7c8cda,0x953b955b,0x957c955c,0xa5dca5bc,0x9d9b84b9,0x7459957b,0x953b957b,0x953b8d3b,0x8d1c6bf7,0x953b9d7d,0x953c955c,0x84da8d3b,0x6c177458,0x4af47cda,0x8d1b7c98,0x84fa8d3b,0x741684fa,0x84789d5b,0x21ce955c,0x21ac7417,0x951b7c58,0x53339d5c,0x7417953b,
-0x6bf5194a,0x84b9adfd,0x3a305b34,0x21694ad0,0x73d34a4d,0xc63d31ab,0x31274209,0x9d177bd2,0x94545a8d,0x52ae0844,0x6b925b10,0xad7b7bf5,0xbdfa31aa,0x63301043,0x5a2a7b8f,0x940e836d,0xa40b4944,0x30c0ff9a,0x6a8772a8,0x18403900,0x49a393ad,0x9c506227,0x312728c3,0xb5dcd6dd,0xdf1fbdfc,0xef7e63d3,0x084130c2,0x08452905,0x9cf6be1b,0x8c318c95,0xb4d23945,0x00004962,
-0x9c52d69c,0x83f27bb3,0x8c13b516,0x61e2bdb7,0x6a227204,0x6a626202,0x72637243,0x72626201,0x62006200,0x59c05180,0x494061e1,0x62225182,0x6a436a22,0x6a225180,0x38c059e1,0x59a15160,0x7aa15980,0x6a206a00,0x82a08b22,0x7a408280,0x72208ac1,0x7aa17a40,0x7aa07220,0x82a17a60,0x82a17220,0x8b248b23,0x6a2069e0,0x6a0069e0,0x6a0061c0,0x6a0061c0,0x61c06a00,0x934761a0,
-0x390130e0,0x498249c4,0x49a251e3,0x51c351c3,0x51c44962,0x49824962,0x41424140,0x49a34161,0x41414963,0x412249a3,0x20801840,0x30e03101,0x31013942,0x20a03100,0xbdb62101,0xb5d92987,0x3967730c,0xad360823,0x29055a49,0x6b2d18a3,0x6b2e5acc,0x7bd041e8,0x10e908e4,0x7b934aaf,0x8cb594f7,0x73928455,0xce7cb599,0xce7cdedd,0xb5fcce9c,0xa5bdadbc,0x9d9ca5bc,0x9d9c9d7d,
-0x9d7c9d7c,0x9d7c9d9c,0x9d9c955b,0x9d5b8498,0xa55aa59b,0xb599a519,0xa577b598,0x8cd88477,0x74367c98,0x8d3b7437,0x955b955b,0x955c955c,0x9d5b9d7c,0x955c7c99,0x7c7a955c,0x9d5b955b,0x955c8d3b,0x8d1b7439,0x955b953b,0x955d955b,0x955c953b,0x7458955c,0x63d77458,0x8d1c953b,0x7c997458,0x953c7478,0x9d9d7479,0x7c9921ad,0x53543a71,0x84d96c16,0x74376c16,0x4ab16394,
-0x53537c77,0x7c785b74,0x7c57a5bc,0x424d8498,0x4a6d4a6e,0xa519422d,0x41eb20e5,0x7bd29497,0x20a562ed,0x4a6d420b,0xadbb5b10,0x422d6b72,0x0000ad78,0x6bd41084,0x62ef528f,0x83f17bb2,0xa3edacf4,0x28806206,0x30e0c574,0x30c230a0,0x18806aeb,0x39443966,0xffff5209,0x4a6c9c95,0xff7ff79f,0x7b4cffdf,0xffff2881,0x9d176b2d,0xce5b8c33,0x31459454,0x7b0aad15,0x730c51c4,
-0x8410b5d8,0x0000ffbf,0x730ea472,0x59a118c3,0x69e17263,0x51e5ff7f,0x72636a21,0x51804920,0x59807263,0x518051a0,0x59a14960,0x59a05160,0x6a227263,0x492059a1,0x51a061e2,0x51a16222,0x8b026a01,0x82e26a20,0x7aa09342,0x7a809b43,0x9b439300,0x69e07a60,0x82a17a60,0x72408b22,0x7a6069e0,0x82c18b23,0x8b237a81,0x61a061c0,0x6a006a01,0x8b0461a0,0x61a07242,0x72427240,
-0x39202080,0x51c251c3,0x49a349a2,0x51a35a04,0x59e451c4,0x30e06246,0x49833901,0x49a34182,0x310051c4,0x31005205,0x49c33921,0x39613941,0x312028c0,0x41834162,0x10823985,0x94d4defd,0x39c9ce18,0x10448c13,0x31679474,0x41c8ad15,0x39872906,0x39c81883,0x00244a8c,0xb5fcbe7e,0x8cb78456,0xad9bbe3e,0x9d39ad7b,0xbe1cb5db,0xa57caddb,0xa59ca59c,0x9d7c9d9c,0x9d9c9d7c,
-0x9d7c9d9c,0x9d7c9d9c,0x955b953b,0x953b953b,0x951a9d7b,0x94d78cb8,0xb5b9b57a,0x8cfa8477,0x84db6c38,0x8d3b84da,0x953b953b,0x8d1b953c,0x955c955c,0x955b84ba,0x84da955c,0x955c955c,0x953c8d1b,0x951c7c99,0x955b953c,0x955c953b,0x953c955c,0x74796c39,0x6c5884fa,0x953b84fb,0x74798d1b,0x8d3c63d6,0x74788d3c,0x5b7542d2,0x21ce6c37,0x84ba7c98,0x32307477,0x74587c78,
-0x84b784f9,0x951a849a,0x5b548cfa,0x9d185352,0x5ace7bd3,0x41ea62ef,0x8c5420e7,0x2926ad78,0x6b305acd,0x84333189,0x18e76351,0xb599526d,0x8c540004,0xb5ba10c6,0x526d8c76,0x8c7441eb,0x5a8a9495,0x41c76227,0x2881628b,0x39852080,0x49c63945,0x31443944,0x31462904,0x83f30000,0x73914a2c,0x20613969,0x6b2e28c2,0x6b4f0842,0xdf1e8413,0x94318432,0x834d7b6f,0x49638bae,
-0x6b0dffdf,0xcdf99410,0xb598b578,0x6a24bd96,0x492072a6,0xffff0000,0x7a858b6a,0x516059a0,0x62226a43,0x51a04940,0x61e159c1,0x62014960,0x41206222,0x61e24100,0x6a426a42,0x61e18305,0x7ae18b47,0x61e08b03,0x72207220,0x72607260,0x82a19b62,0x82807a60,0x7a817240,0x82c169e0,0x61a061c0,0x722082c1,0x61c08ae3,0x61e07aa1,0x6a2059c0,0x724161e0,0x6a0069e0,0x8ae28ae2,
-0x49a23940,0x496149a2,0x51c34141,0x49a249a3,0x412151a3,0x41636266,0x496230c0,0x41634142,0x49834983,0x49c33941,0x418249a3,0x41a249c3,0x39414182,0xce361880,0x62ed39a7,0x9d176b30,0xad16526c,0x736f5209,0x6b0d526b,0x29266b0d,0x186362cd,0x088439c8,0x6b92ad37,0x63726bb3,0x74168476,0x63939d5b,0xa59c84b8,0xa59ca59c,0x9d7c9d5b,0x9d9c9d9c,0x9d9c9d7c,0x9d7c9d9c,
-0x957c9d7b,0x955b957c,0x955b9d7c,0x953b951b,0x8d1a9d7c,0xa57b8cda,0xb61b9d19,0x7457953a,0x7c797cba,0x84ba8cfa,0x8d3b8d3b,0x8d1b8d3b,0x953b8d3b,0x953b8cfb,0x84b98d3b,0x8d3b953c,0x7c998d3b,0x953c8d1b,0x953b8d1c,0x953b8d3b,0x953b953b,0x8d3c8d3b,0x7c9984db,0x953b8d1b,0x7c997c99,0x955b851b,0x4b3463d6,0x5b9584da,0x84b97c99,0x21ae955b,0x8d1a7c98,0x9d9d114c,
-0x216e6c16,0x5b749d9b,0x9d7c8cfa,0x426e7c98,0x18c74a4d,0x83f339aa,0x5ace4a2c,0x5aac2968,0x732f5aac,0x0022632e,0x5aee0002,0x0843ffdf,0x20e50002,0x94741063,0xad587391,0xce3da4f6,0x39876352,0x9c935a08,0x28c25a6b,0x94102061,0x9c9262ec,0x5a6a5269,0x39464a08,0x1886a4d5,0x422a20e7,0x1820524b,0x5aac28a1,0xbdf96b0e,0xb599ad5a,0xd69b5aee,0x8bcfe6fe,0x49841000,
-0x18c551a8,0x8c3383af,0xa4f7dede,0x7284ad13,0x51817286,0xef3d2947,0x6a876a69,0x61e161e2,0x6a635160,0x6a226a42,0x59a06222,0x59c04120,0x496051c0,0x412038c0,0x516051a0,0x7ae472a4,0x6a6359e3,0x7ac26201,0xa3c49342,0x8b2282c0,0x82807260,0x93218b00,0x7a807a60,0x6a006a00,0x6a006a00,0x722082a1,0x72407220,0x722082c2,0x6a008b03,0x6a008b03,0x6a0059a0,0x72408b03,
-0x5a046245,0x51e34982,0x49c24141,0x6ac749a2,0x51a351c4,0x522549a3,0x31004141,0x49a472ea,0x49833100,0x39216246,0x20a05a24,0x62c73982,0x20c141a3,0x41c7bdb5,0x62d0c65c,0x62ad7b6f,0x6aabef1e,0x94727b0d,0x28e5bd97,0x18221002,0x214741c8,0x320f62ee,0x4a6c73b2,0x31ed52d0,0xadfc73d6,0x951a84b8,0x84b9a57a,0x9d5c9d7c,0x9d9c9d7b,0x9d7c9d9c,0x9d7c9d7c,0x9d7c9d7c,
-0x957c957c,0x957b955c,0x9d7b9d7b,0x953b955c,0x7c99955c,0x951a84b9,0xb5db73b4,0x7c9994fa,0x74587458,0x84da6c38,0x953b8cfa,0x8d3b8d3b,0x8d3b8d3b,0x8d1c84da,0x84ba8d1b,0x8d3b8d3b,0x74598d3b,0x8d5d8d1b,0x953b84fb,0x8d3b8d3b,0x8d3b8d3b,0x8d1b8d3b,0x8d1b84da,0x8d3b8d3b,0x7cba8d1b,0xa5ff6c17,0x8d5a7459,0x955c84da,0x9dbe84db,0x5b753250,0x63d55355,0x5b555355,
-0x64166c16,0x5bd663f6,0x7c7884b9,0x52d17c78,0x7c356332,0x73b2318b,0x4a4c7c13,0x7c1452ad,0x5ace62ef,0xa4f8526e,0x424d6331,0xdf1f422b,0x1044194a,0x4a4ba517,0x8c950826,0x00238c96,0x41a8c63b,0x62ac49c9,0x28c249c8,0x18622081,0xcdf80801,0x104139a6,0x080141a6,0x630f7baf,0x1862a4d5,0x30e10801,0x94b628e1,0x9cb58c33,0x84137391,0x7bb19cf6,0x7b4d8432,0x28a42841,
-0xb599bd78,0x2906ad37,0x20a53167,0x59c26aa7,0x59c35a21,0x836e3948,0xc5740000,0x59c15a03,0x6a666a45,0x6a2259e0,0x59c159c1,0x51a138c0,0x38c04940,0x61e24100,0x59c16a43,0x59e24940,0x49404120,0x51a059c2,0x7ac161e0,0x61e07a81,0x724061e0,0x8ae282c1,0x82a07aa0,0x72207240,0x69e07220,0x82817a40,0x82a07a40,0x8ac19302,0x72007200,0x82a38ae4,0x6a007240,0x82e06a00,
-0x41404981,0x51e34161,0x392049a2,0x51e33940,0x41414982,0x418351c3,0x39214983,0x41623901,0x62463941,0x4183836a,0x6b093921,0x312120a0,0x5aa962c9,0x83cf6b0a,0x8c7518e8,0x7b8fa4d4,0x20a49452,0x5a8b72ed,0x41c93987,0x08024a2a,0xad78736f,0x9d188452,0x19080023,0x7c1631cb,0xadfe52d2,0xb61e9d7b,0x951b9d7d,0x9d7c953b,0x9d7c9d7c,0x9d7c955b,0x955b955b,0x955b955b,
-0x955b955b,0x955b955b,0x953b955b,0x953b8d1b,0x8cfa953b,0x9d5b953b,0xb61d94f9,0x7c7984ba,0x6c3884da,0x84b97cb9,0x8cfa84da,0x8d1b8d1b,0x8d1b8d1b,0x8d1b84da,0x8d3b8d3b,0x8d1b8d1b,0x7c9a8d1b,0x95be8d1b,0x8d1b7cba,0x8d1b8d1b,0x8d1b8d1b,0x8d3b8d3b,0x8d3b8d1b,0x8d3b8d1b,0x84fb8d1b,0x6c377458,0x74585b96,0x53358d1a,0x8d1a84d9,0x53547438,0x8d1aa5be,0x84ba8cfc,
-0x6bd6090b,0x84da84ba,0x196d3a92,0xa5bc84b8,0x5b53322c,0x3a0d424f,0x29692169,0xd69f6351,0x41ea4a4d,0x41ec6b51,0x6b927bf3,0xb5dc0884,0x0003ad7a,0x84338456,0x7c140866,0x843594f8,0x39662107,0x41a74187,0x31021841,0xd67c0800,0x3168ad38,0x10420863,0x18623965,0x18411021,0x10632904,0x1840d65b,0x18e528e2,0xb5998412,0x84137bf3,0x292839ca,0x94519494,0x62ab4985,
-0x5b0ee73e,0xdeffa559,0x734f7391,0x59c372c8,0x38c04980,0x39457b8f,0x836d9c51,0x61e24961,0xe6fa2060,0x6a837b07,0x59e35180,0x30a030a0,0x62034960,0x59c15181,0x59a059a1,0x51806203,0x38e04940,0x62224120,0x93856200,0x8b047a81,0x69e06a01,0x7a806a20,0x8b2182c0,0x7a607aa0,0x7a6082a1,0x8ae17a60,0x82807a60,0x7a408ae2,0x72207220,0x72205980,0x598061c0,0x82e26a01,
-0x41404980,0x418151e2,0x416149a2,0x28c049a2,0x49815a04,0x310151e4,0x51e44142,0x39204160,0x41833941,0x51c530c0,0x39604983,0x626a5227,0x000041c7,0x08003144,0x206318a2,0x734d5249,0x2905526a,0x39878bd1,0x18c518a4,0x31681044,0x5aef4a2b,0x6b322108,0x318c2127,0xa55ac65d,0x8cdb8c98,0x955c9d5c,0x8d1a6c19,0x8cfa951b,0x951b84ba,0x955b957c,0x955b955b,0x955b955b,
-0x953b955b,0x953c953b,0x8d1b953c,0x8d1b8d1b,0x8d3b953b,0x8cfa951b,0x8cf87c57,0x74788d1c,0x6c387c78,0x84b984fb,0x8cfa84da,0x8d1b8d1b,0x8d1b8d1b,0x8d1b8cfb,0x8d1b8d1b,0x8d1b8d1b,0x8cfc8d1b,0x84fb8d1b,0x8d1b957d,0x8d1b8d1b,0x8d1b8d1b,0x8d3b8d3b,0x8d1b8d1b,0x8d3b8d1b,0x84da8d1b,0x84f86c38,0x5b956c39,0x747784bb,0x00cc5356,0x29ef196d,0x84b942d3,0x955c63d7,
-0x4ab27c79,0x6bd64291,0x7c987c98,0x6bf75b97,0x7c7784b9,0x9d1a8478,0xadbc4ad0,0x5b10a55a,0x31890003,0x83f47392,0x73d32128,0x6b916b50,0x08240004,0x00656354,0xa59b6b92,0x7415216a,0x6b0c41eb,0x6aec9431,0x30e11881,0xdeff0800,0x7c3452af,0x20c43a0b,0x3945a4b2,0x20213104,0x630e1843,0x49e69c74,0x000028e3,0x8c549494,0x5aef2127,0x10665aee,0x94529475,0x9c743923,
-0x29abce5d,0xc5d9e71f,0xb537ad59,0x6a2549a5,0x59a37ae7,0x49c641c7,0xacb251e9,0x59e2938b,0x61c25161,0x6a662880,0x30c193ae,0x518138e0,0x59c159e1,0x494059e1,0x59c16202,0x51c05160,0x40e14961,0x51c05181,0x620059c0,0x61c07240,0x61c05980,0x82c059a0,0x7a809341,0x7a8082c0,0x724082a0,0x72407a80,0x82a08ac2,0x82807a40,0x7a608ae2,0x82a27240,0x6a0261c0,0x6a0069e2,
-0x39405202,0x49c24160,0x49a249c2,0x3963942d,0x8b8c51e4,0x5a6951c5,0x31005a26,0x39213941,0x51e44182,0x30e14161,0x4a0749a4,0x31236aca,0x94503965,0x3965734d,0x31658bef,0x4a2941e8,0x31464a08,0x6b2f4a2a,0x2968420a,0x39ca3189,0x52ad1926,0x8c77214b,0x8c985b12,0x84b98cb8,0xa55e4ab2,0x84f9a5bf,0x955c42b2,0x84da953b,0x955b955b,0x955c955c,0x953b955c,0x953b953b,
-0x953b8d3b,0x8d3b953b,0x8d3b8d3b,0x8d1c8d1b,0x8d1b8d3b,0x7c998d1b,0x8d1b8d1b,0x84b98cfb,0x6c1884da,0x84da8cfa,0x8cfb8cfb,0x8d1b8d1b,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8d1c8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8d1b8d1b,0x8d1b8d1b,0x8d1b8d1b,0x8d1c8d1b,0x7c9984da,0x851b84da,0x5b9684db,0x7cb963d7,0xae1f7499,0x3a70955c,0x84b98d1b,
-0x6c172a0f,0x214b426f,0x325029cd,0x8d1aa5dd,0x7c987c77,0x63b58499,0x42906393,0x8c975b11,0x63516331,0x21298c76,0x10e873b3,0x52cf4aae,0xffff190a,0xdeffd6be,0x9d397391,0x9d197c36,0x39ca7bd3,0x00022948,0x28e341e9,0x9d1a83f1,0xb5dd9518,0x7bd394b6,0x49c6ad35,0x30e31820,0x524b0801,0x10006b0d,0x184120a2,0x21097b91,0x7bf38413,0x39a94aae,0xa4f6c61b,0x5ace1021,
-0x73b27391,0xc63d7bf3,0x6aedbe1c,0x5a0338c0,0x49a649c2,0x2041e6bb,0xff9ebd35,0x6203e6b9,0x49a24140,0x30e13920,0xb4f36aaa,0x412049a2,0x72a54941,0x51a151a1,0x59e15180,0x51a159c2,0x49604940,0x59c059a1,0x61e06a21,0x72826a20,0x51806a20,0x82e259a0,0x722082e2,0x82c09342,0x72407a60,0x6a207a61,0x8ae19302,0x82a182a1,0x72408ac1,0x72408b02,0x82827220,0x6a009364,
-0x41614a02,0x418149c2,0x41643100,0xbd940800,0x942e4184,0xbd753102,0x39016247,0x39408b8c,0x49c430c1,0xf73b4182,0x51e75a27,0x5a083921,0x312462ca,0x5a695228,0x39844a07,0x29250000,0x08011062,0x52ad0000,0x73b16330,0x847431ea,0x73d57c35,0x73d594f9,0x73f59d1b,0x8cdaa57a,0xadde951a,0x9d7c8d1b,0x6bf684da,0x955c7458,0x955b953b,0x953b955c,0x953b953b,0x8d1b953b,
-0x8d3b8d3b,0x8d1b8d3b,0x8d1b8d1b,0x8d1b8d1b,0x8cfa8d1b,0x6c388d1b,0x84fa8d1b,0x8cfa84b9,0x7c9a84da,0x8cfb84da,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x84db8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8d1b8cfb,0x8cfb8d1b,0x8d1b8cfb,0x8d1b8d1a,0x747984da,0x84fb7479,0x7c793ad2,0x63f76417,0x63d63250,0x6bf65354,
-0x74373a70,0x7c364290,0x743873f7,0x7c797c98,0x218c8cfa,0x42705b74,0xbe7f29cc,0x5b118458,0x52d0a59b,0x10e94aaf,0x63b58457,0x29697437,0x3a2e8496,0x31686b4f,0x73d33169,0x6b715b11,0x73b431ab,0x8c9731ab,0x10215aab,0x5b130802,0x52b06372,0x2969ce7c,0x20822124,0x08002061,0x4a485a8a,0x51e81862,0x1820bd96,0x420b1883,0x41ea524b,0xdf3ead99,0xad37a538,0x8c542083,
-0x84349cd7,0x84145aef,0x838ea518,0x51c35182,0x836e51e5,0xcd97ff7d,0x28a393f0,0x59e21860,0x5a046224,0x49a4f6db,0x52074184,0x4144ff5d,0x62043080,0x59c26223,0x518061e2,0x62036a23,0x59c259c2,0x516059c1,0x62006a21,0x61e06220,0x7ac36200,0x6a206200,0x82c16a20,0x8b007a60,0x7a607a80,0x7aa07260,0x726082e1,0x82807a60,0x7a808ae1,0x6a007240,0x8ae37a61,0x72607240,
-0x396051c2,0x52033980,0x41a55225,0xb4f2c5b5,0x52467b49,0x18607b4b,0x41826aa7,0x414130e0,0x39433902,0x30e2e637,0x31024163,0x10004144,0x30e24164,0x28e26b0a,0x28e230e1,0x7b8f1863,0x4a2b1863,0x63300003,0x6bb373b2,0x94f86392,0x4ab07415,0x7c165b54,0x4af17435,0x7c5710ea,0x955b6395,0x6bf784b9,0x955b84da,0x84ba8d1b,0x953b953c,0x8d3b8d3b,0x8d3b8d3b,0x8d3b8d3b,
-0x8d1b8d1b,0x8d1b8d1b,0x8d1b8d1b,0x8cfb8cfb,0x8cfb8cfb,0x7c9a84fb,0x84fb7cba,0x84fb7cba,0x84ba8d1b,0x84db84da,0x8cfb8cfb,0x8cfb8cfb,0x84db8cfb,0x84fb84fb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x84fb84fb,0x8d1b8d1b,0x8cfb8d1b,0x8cfb8cfb,0x84fb8cfb,0x84fb8d1b,0x7c9984fb,0x84da7c99,0x84db7479,0x5b755b96,0x63b55355,0x74386bf6,
-0x8cdb5b75,0x4a8f08a9,0x74588cfa,0x6bf78cfa,0x42904291,0x428fbe5e,0x9d7c4ab1,0x84997c98,0x6bb47c57,0x63734a90,0x8498951a,0x296794da,0x9d3a216b,0x00238436,0x4a8d5aef,0x4a2a0864,0xa5593189,0x29086330,0x20a16b2d,0x4a4c28c2,0x7bd38434,0xad3752cf,0x20831863,0x18e539a9,0x20c30821,0x94311041,0x10001061,0x41c71001,0x00003145,0x5aaeef7f,0xad7b39ec,0x4a6f20c2,
-0xc69f7c13,0xbdda9cd6,0xbd14318a,0x5a246a24,0x947149e6,0x3125b576,0x838fb597,0x41213924,0x38e151a1,0x49e86aaa,0x08004185,0x94363103,0x7b29cdb6,0x59c261e6,0x6a655180,0x412051c1,0x518151a2,0x62236a23,0x72a37ae5,0x6a426a42,0x72407282,0x72616a20,0x72206a00,0x7a606a20,0x7a808b00,0x72407a80,0x7aa07a80,0x7a607aa0,0x7a8169e0,0x720082c2,0x72408261,0x6a0082a1,
-0x39404181,0x41625223,0x5a475a46,0x20a1d636,0x734a6286,0xfffe730a,0x28a07b49,0xeeb85204,0x5a693922,0x732c5a48,0x286030c2,0x49a438e2,0x49a5b512,0x208049c5,0x20a128c1,0x6b4f528b,0x31cb18a6,0x73f49497,0x320d6392,0x7c76b63d,0x84b85b73,0x847773f7,0xd71f5b53,0x63548cf8,0x7c788cb9,0x6c187c98,0x745984d9,0x953b955c,0x953b84ba,0x8d3b8d3b,0x8d1b8d1b,0x8d1b8d1b,
-0x8d1b8d1b,0x8cfb8cfb,0x8d1b8d1b,0x8cfb8cfb,0x8cfb8cfb,0x84ba84db,0x84fb84da,0x84fb84da,0x84ba84fb,0x84db84db,0x84da8cfb,0x8cfb84db,0x84db84db,0x84da84fb,0x84db84db,0x84db84db,0x8cfb8cfb,0x84db84db,0x84db84db,0x8cfb8cfb,0x84fb84fb,0x84fb84fb,0x84db84fb,0x8cfb8cfb,0x84fb8cfb,0x84fb84fb,0x84fb84fb,0x747984da,0x84ba6c18,0x53755b96,0x74585375,0x63b67c78,
-0x8cda84da,0x5b106393,0x8cfb29ce,0x6c377c99,0x5b747c78,0x63b56bd5,0x63958cba,0x84995b94,0x845763b4,0x4ab173f6,0x194b6394,0x004273f4,0x3a2e94f9,0x00028435,0x296a4a6d,0x62ef4a8f,0x5b107c13,0x41cb4a4d,0x18404a08,0x20e41840,0x6b4e39c8,0x4a094209,0x21060000,0x739139ca,0x188262cd,0x104128e4,0x31043124,0x08001820,0x41e91861,0x63307bd1,0x528f9496,0x630f2103,
-0x8c94c61c,0xbddbc63c,0x39238433,0x31006203,0x41e841a6,0xa4f5bdb8,0x49c94189,0x8b4b9431,0x51a551a2,0x7b4d6a8a,0x942fff5c,0xad176269,0xbd33de1a,0x834c93cf,0x59e44143,0x59c24120,0x51a159e2,0x59e251a1,0x62226203,0x72627aa4,0x7a827aa2,0x724061e0,0x93667240,0x82c161e0,0x82a082e0,0x72407220,0x82a07a60,0x8b027240,0x8ae38b02,0x7a617a60,0x59605940,0x7a6369e1,
-0x52045203,0x49a441a3,0x8c507b6c,0x4141cdd5,0x52065225,0x38c14963,0x41623960,0x28a05a47,0xb5553943,0xad34cdf7,0x8bee4a07,0x30e03922,0xacd128a1,0x28a128c2,0x10403123,0xb5ba0844,0x31ab6311,0x000594b7,0x955a42b0,0x5313a5ba,0x6bb58cda,0x8c98953b,0x29cd73d5,0x6bf67c78,0x6bf684d8,0x8d1b953b,0x6bf67cb9,0x8d3b953b,0x8cfa8d1b,0x8d1b8d1b,0x8cfb8d1b,0x8cfb8cfb,
-0x8cfb8d1b,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x84db8cfb,0x84fb84fb,0x84fb84fb,0x84fb84fb,0x84da84fb,0x84fb84fb,0x84da84da,0x84fb84da,0x84fb84da,0x84fb84fb,0x84fb84fb,0x84da84fb,0x84fb84fb,0x84fb84fb,0x84fb84fb,0x84fb84fb,0x84fb84fb,0x84fb84fb,0x84fb84fb,0x84fb84fb,0x84fb84fb,0x84fb84fb,0x84fb84fb,0x745a84fb,0x63f76c39,0x7cba63f7,0x63d77459,0x7c9a6c18,
-0x3ad27c99,0x19086394,0x7c7a6394,0x7c797c78,0x29ee7c9a,0x7c989d7b,0x7c787438,0x6bf6112c,0x6b74426f,0x0046296b,0xb61d94d8,0x63108c75,0x6b93a55a,0x10844a29,0x00046370,0x426d7c15,0x29ab5aef,0x31698415,0x20802904,0x10001840,0x20c4c5f9,0x10220000,0x18c48c11,0x528b20e5,0x1863528b,0x28e30800,0x290420a2,0x18411020,0x000041c6,0x7bb2bdd7,0x4a6d7bb3,0x28e45aab,
-0x31a93149,0x6aeede9c,0x4181ad15,0x39435181,0x7b708c12,0x7b6f626c,0x5a6df75f,0x6aca4167,0x41c54142,0x836c1820,0x9c4f72ea,0x39468baf,0xef1dbd76,0x8bd4d655,0x8c106b4e,0x41414941,0x498051a1,0x59a151a3,0x728459c0,0x622061c0,0x6a216a22,0x72417ac3,0x9b6661c0,0x72209b65,0x72607240,0x82c161c0,0x59c06a60,0x8b0269e0,0x69e07240,0x7a8269c0,0x59a069c1,0x728261e0,
-0x41a341a2,0x5207730b,0x83ad28e3,0x6aa841c4,0x310241a4,0x7b4c4163,0x39452060,0x412330a1,0xa4922860,0x2081f6fb,0x18820800,0x30e2bd74,0x184049a5,0x3104bd75,0xad583966,0x6311a539,0x4a8f4a2e,0x8cd64a4e,0x84d70087,0x9d9c5353,0xa59c951a,0x422e8478,0x84b96332,0x42b16bd6,0x7cb94af3,0x84fa743a,0x8d3b8d1b,0x8d3b8d3b,0x8d1b8d1b,0x8d1b8d1b,0x8cfb8d1b,0x8cfb8cfb,
-0x8cfb8cfb,0x8d1b8cfb,0x84db84db,0x84da8cfb,0x84ba84db,0x84fb84fb,0x84da84da,0x84da84fb,0x84da84fb,0x84da84da,0x84da84da,0x84da84da,0x84da84da,0x84fb84da,0x84fb84da,0x84da84da,0x84da84da,0x84da84da,0x84da84fb,0x84da84da,0x84da84da,0x84da84fb,0x84da84da,0x84da84fb,0x84da84fb,0x84da84da,0x84fb84da,0x747a84da,0x74797c9a,0x84fb7459,0x743884db,0x8cfb84db,
-0x7cba8cfb,0x7c577478,0x7c995b74,0x74588d1a,0x63d68cfb,0x7c987437,0x7c787c98,0x7c5784b9,0x31cd73f6,0x73b36332,0x10858c55,0x4a2c83f3,0x21270003,0x08430000,0x73b10064,0x39a9a559,0x41eb39ca,0x39886b30,0x20812061,0x10201000,0x18a30821,0x3167e6fc,0x10429cb4,0x21052105,0x524a41e8,0x6b2d20e4,0x20a262cb,0x18402081,0x31445a27,0x10610800,0xe71f62cc,0x5a693947,
-0x6b2e3128,0x1042d67b,0x49a34185,0x5a693901,0x737018e5,0x2926de5c,0xad585a8d,0x5a48f75e,0x83cf51a5,0x4985cdd6,0x6aaa4185,0x41a6628a,0xacd641a7,0x72ef9431,0x18632924,0x834c28c3,0x834a2880,0x59c349c1,0x7aa459c1,0x728359a0,0x728259c0,0x61a07aa3,0x93455960,0x6a207a81,0x7a827240,0x59606a00,0x59e05140,0x8ae37a82,0x7a418b02,0x82c382a2,0x516069c0,0x38604920,
-0x41623143,0x83ad3100,0xacf35a47,0x8bad6ac7,0xf75c6aaa,0x62895a48,0x28e24165,0x51c63903,0x62474185,0x30602000,0x62ec734d,0x30e23103,0x18c25269,0x312520e3,0x52a91823,0x6b90ad7a,0xb5ba8c55,0x6b945af0,0x6bf494dc,0x8cf96bf6,0x73d7951a,0x5b524230,0x63b3196d,0x7c764af4,0x953b94fa,0x953b8d3b,0x8d1b8d1b,0x8d1b8d1b,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,
-0x84fb84db,0x84fb84fb,0x84da84da,0x84da84da,0x84da84da,0x84da84fb,0x84da84da,0x84da84fb,0x84da84da,0x84da84da,0x84da84da,0x84da84da,0x84da84da,0x84db84db,0x84db84db,0x84ba84db,0x84db84db,0x7cba84db,0x84db84db,0x84da84da,0x84db84db,0x84db84db,0x84db84db,0x84db84db,0x84db84db,0x84db84db,0x84db84db,0x84db84db,0x84db84db,0x84fb84ba,0x7cba84db,0x84fb84fb,
-0x84da8d1b,0x745884fb,0x84da7458,0x8cfb8cfb,0x5b9584fb,0x6c365b76,0x7c788cdc,0x63957c59,0x8497322f,0x19093a4e,0x31474a6c,0x08421042,0x29487391,0x6b507391,0x526e39ca,0x21893a0d,0x00010043,0x18a30844,0x10201881,0x28c31000,0x5acc2906,0x10862146,0x31688c52,0xad360002,0x000018c4,0x10210000,0x000020a2,0x49a61820,0x20c428c1,0x526a1864,0xd5f89410,0x30e42041,
-0xcdd83105,0x08006b0e,0x59e438e1,0x4a8a4183,0xd67d9cd8,0x7b70420a,0x8c50acb7,0x9c934167,0x83706227,0x732c5a6c,0xbd956b0c,0x10204a08,0x080038e5,0x93f03986,0xeedc3965,0x635020c3,0xb5bbf7bf,0x59c30002,0x59a061c3,0x934761c0,0x7283a3c9,0x49209ba9,0x82c561e1,0x61e09324,0x93267241,0x6a426a61,0x516061e1,0x8b255140,0x6a006200,0x69e07261,0x5980a3a8,0x61c05960,
-0x28c372e9,0xbd356aea,0xcdf75a6a,0x6aa96267,0x8c2f5a47,0x41434964,0x6249732c,0x940fcdb5,0x94515a49,0x30c1730c,0x20822081,0x18202082,0x31662904,0x2926526a,0x29290823,0x73d3b59c,0x9496420e,0x4a6f8c76,0x5351cebf,0xaddd320f,0x53138478,0xa59d8cb7,0x74376bd6,0x4af37437,0x8cfa7418,0x84da84fa,0x8d1b7c99,0x8d1b8d1b,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,0x8cfb8cfb,
-0x84da84db,0x84fb84fb,0x84da84da,0x84da84da,0x84da84da,0x84da84da,0x84da84da,0x84da84da,0x84da84da,0x7cba84da,0x84da84da,0x84da7cba,0x84da84da,0x7cba84db,0x84db84db,0x84ba7cba,0x84db84db,0x84db84db,0x84db7cba,0x84da7cba,0x7cba84db,0x84db84db,0x84db84db,0x84db84db,0x84db84db,0x84db84db,0x84db84db,0x84db84db,0x84db84db,0x84fb84fb,0x84da84db,0x84fb84da,
-0x7c9984fb,0x7cba84fb,0x8cfb8cfb,0x8d1b84ba,0x7cba7c99,0x74375374,0x6bd66c17,0x8cda84ba,0x63537457,0x5af26bb5,0x08025aed,0x31aa2106,0x00030845,0x9cd60844,0x212831a9,0x63946b93,0x84565b11,0x5aad0004,0x10600801,0x6b0c0800,0x39ca2906,0x8c7739ca,0x7bb10003,0x39c85acd,0x734e3187,0x62ec62cc,0x29045a69,0x52081841,0x31054185,0x314683f0,0x18425208,0x206128c2,
-0x31463145,0x28a128e4,0x51c53922,0xad7830e0,0x8cd67c14,0x8bf1be1b,0xa4b3bd57,0x2905628c,0x628b72a8,0x83d062cd,0x522849c8,0x5a8a4a08,0xcdd83966,0x941228e4,0x28e56b10,0xef9fa4f5,0x52aece5d,0xffbfbe5b,0x59a01880,0x6a426a43,0x6a228325,0xf6532820,0x7a635160,0x61e0b448,0x61c06a00,0x59a059a0,0x722261c0,0x59a05980,0x516061e1,0x6a016a21,0x72225980,0x6a0161a0,
-0x18a22880,0x0800fffe,0x943249c6,0x622849c5,0x94115229,0x000018a3,0x30c39471,0x416630a2,0x72c95a4a,0x41a638c2,0x28a149c6,0x41c762aa,0x39680821,0x9cd65acd,0x84552169,0x00238435,0x000352af,0xb5fab5dc,0xb65d4a92,0xadfd3250,0x63b47c58,0x322f424f,0x63967c97,0x7cb884b7,0x8d1b953a,0x8d1b8d1b,0x8d1b8d1b,0x8cfa8d1b,0x8cfb8cfb,0x8cfb8cfb,0x84db84da,0x84db84db,
-0x84da84da,0x84da84da,0x84da84da,0x84da84da,0x84da7cba,0x84da84da,0x84da84da,0x84da84da,0x84da7cba,0x7cba84da,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x84db84db,0x7cba84db,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x84da84da,0x84db84db,0x7cba84db,0x84db7cba,0x84db84db,0x84db7cba,0x84db84db,0x84db84db,0x84db84db,0x84db84db,0x84db84db,0x84da84db,0x84fb84da,
-0x84fb84fb,0x7c997cba,0x84ba84ba,0x745984ba,0x7cba7458,0x42d37c77,0x84b984d8,0x84ba6396,0x9d5a4b12,0x00464a8f,0x0802630e,0x635318c6,0x084518c8,0x6b70420b,0x4a4d0003,0x52f210e9,0x00055af1,0x19038cb7,0xad370001,0x94936b2d,0x18c62905,0x73b383f5,0x31686bb1,0x630d39c9,0x5aab3187,0x00007b8f,0x08001861,0x20a20800,0x29043926,0x41c82944,0x00005229,0x18610800,
-0x29669492,0x41436ac9,0x3963732a,0x52893942,0x18a23985,0x520ae6bc,0x7b0e732c,0x8bf1c5d9,0x394359e4,0x3168b536,0x6b0ceefd,0x31456aeb,0xa4f531a8,0x49ea522a,0x5aadd6db,0x9d147392,0xef7fd6bf,0xdf1e8436,0x51e86269,0x8b6a2000,0x6a216223,0xcd2f82e6,0xbc6b5160,0x59808ae2,0x7aa169e0,0x722082a1,0x72217a42,0x518059c0,0x51a05160,0x72226a43,0x59807221,0x69e15980,
-0x3923a4f2,0x41232881,0xffff3943,0x41246287,0x62ac28c3,0x8bef83f1,0x836e41a7,0x314562ab,0x49861862,0x52277b4d,0x18623945,0x29234a08,0x526d41e9,0x39cb7392,0x10c731eb,0x9cd70003,0x84346310,0x4ad12149,0x639331ee,0x6bb55311,0x296c4251,0x5b9629ab,0x84fa84fa,0x53b67478,0x8d1b951a,0x8cfb8d1b,0x8d1b8cfb,0x8cfb8cfb,0x8cfb8cfb,0x84db84db,0x84da84fb,0x84da84da,
-0x84da84da,0x84db84da,0x84db84db,0x84db84db,0x84db7cba,0x84db7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x84da7cba,0x84db7cba,0x7cba84db,0x84db84db,0x84db7cba,0x84db84db,0x84da84db,0x84da84da,
-0x7cba8cfb,0x74797459,0x84da63f8,0x84fb7c99,0x8cfa7458,0x3a713a71,0x6394a5be,0x3a4f6bf7,0x63926bd7,0x21287bf3,0x21480885,0x5af018e7,0x4a6e2128,0x84355af0,0x31ec5b11,0x94b631ea,0x39a99496,0x29031042,0x10640823,0x106283f1,0x73913166,0x10e71108,0x29880065,0x8c1273b0,0x39c7528b,0x100062cb,0x08003145,0xbdb75a89,0x39a7736e,0x5aab41c7,0x6b0d20e4,0x10601861,
-0x5aa97b8f,0x10002061,0x30e2a4b4,0x4a073965,0x3166944f,0x8c33ce5b,0x1862acd3,0x310620c4,0x49854183,0x520a522a,0x5209d65b,0x9431c598,0xa4d520a4,0xa4d57bd1,0x18439c92,0x8414420c,0xefdf3a0b,0xffdfc69d,0xefdf2080,0x4a4cd69a,0x7ae76ac9,0x59a07a64,0xac2a59a0,0x61e059c0,0xa3867241,0x82a282a2,0x72207220,0x61a05980,0x59a061c1,0x61c161c1,0x61e07243,0x516059c0,
-0x94501060,0x38e1c5d6,0x41425a46,0x08003121,0x526a41e7,0x18c50800,0x732ef77f,0xacf51002,0x0000732e,0x4a083104,0x6b2c3145,0x41e90001,0x00041084,0x52ae73d2,0x29acd6df,0x424e31ed,0x7c56216b,0x73f86bb5,0x6bd74ad2,0x74155b74,0x94f88c98,0x326f73d4,0x8d1c6c18,0x749a7c79,0x8cfb7499,0x8cfb8cfa,0x8cfb8cfb,0x84db8cfb,0x8cfb84db,0x84db84da,0x84da84da,0x84da84da,
-0x84da84da,0x7cba84da,0x84db7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7c9a7cba,0x7c9a7cba,0x7cba7cba,0x7c9a7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7c9a7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x84da7cba,0x7cba7cba,0x7cba7cba,0x84db7cba,0x7cba7cba,0x84db84db,0x84da84db,0x84da84da,
-0x84da84da,0x84fa7498,0x32726c17,0x21af21d0,0x00c908cc,0x6bf508ea,0x9d398d18,0x8c9710e6,0x00048cb6,0x63315af0,0x18c7420c,0x29885b0f,0x18e82969,0x31ab214a,0x0886424e,0x21ab73f3,0x18e563b3,0x28e50001,0x00009473,0x082183f1,0x7bf31882,0x52d05b11,0x94969d1a,0x00002927,0x10a22925,0x186241e7,0x41a60000,0x8c311020,0x5a8bef1d,0x8c5318a3,0x734e1063,0x28e020a2,
-0x31221840,0x94302082,0x3143acf2,0x6b517bf3,0x29277bb3,0x188341e7,0x39a88c12,0xd61a83d1,0x49645a46,0x41a8acf4,0x49ea6acc,0x5a8a4a0a,0x7b6d3945,0xb577c5b7,0xbd999c94,0xa51894f6,0xce9e9cf7,0x4989f77f,0xb5b96c37,0xf7ffe77f,0xf79fe73f,0x51831020,0x6a0251a0,0x51c082e5,0x8b046200,0x82a27a61,0x8ac28ac2,0x82c369e0,0x6a427221,0x72627262,0x620159a0,0x59805180,
-0xdefb3964,0x31018c10,0x940e3922,0x1881ad11,0x31850800,0xad3562eb,0x5a6d62ad,0x208293d0,0x41650000,0x7b4c3943,0x00640000,0x6baf9d18,0x5aef4a6c,0x52cf2949,0x8cd8214a,0x8cd98cd7,0x52f26bd8,0x94fa7416,0x951aaddd,0x74353a31,0x21098cd9,0x84ba21ac,0x84da8d1b,0x7cba84da,0x8cfa6c38,0x8cfb8cfa,0x84db8cfb,0x84db84db,0x84da84ba,0x7cba84da,0x84da84da,0x84da84da,
-0x7cba84da,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7c9a,0x7c9a7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x74797c9a,
-0x53977c79,0x84dc4b35,0x7cb97459,0x7c997c99,0x74787459,0x090a7cb9,0x7c583a8f,0x9d7c84b9,0x216ebe7e,0x000152d0,0x5ace6330,0x52cd39ea,0x10a794b6,0x8c76d69e,0x63303a0c,0x63b38476,0xc61b8478,0x18a218e5,0x08031884,0x00218cb5,0x6bb152ab,0xce7d8c99,0x62f04a8d,0x49e83188,0x20c32904,0x00001862,0x08001041,0x83cf20c3,0x20e40000,0x10844a4a,0x84109d38,0x30a01840,
-0x39443943,0x100062ca,0x20c23123,0x635252ce,0xe6ddad59,0x4a2c20a4,0x39eb8435,0x528c8c73,0x51e6a4b2,0x5aec39e9,0xbd986aed,0x31467bd0,0x9c716aec,0x7b8f2907,0xbdf90823,0xd67b734f,0xdebebdba,0x20e6e75f,0xadb9efbf,0xcefd5332,0xdf3fdeff,0xd65cc67b,0x7ac672a8,0x6a017aa4,0x934882a4,0x82828283,0x69e07a81,0x7a837201,0x61e051a0,0x82c37a83,0x69e082a4,0x598061e0,
-0x945149c6,0x5a475a29,0x28c0acf0,0x6b0941c5,0x20e36aeb,0x949339c7,0x62ccffdf,0x28c4b557,0x41a67b4c,0xd67928e2,0xd69d2146,0x2949b5b9,0x0864a538,0x218b31cc,0x953a84b8,0x951badbe,0x84789d5b,0x7c578cfa,0x63958498,0x42925332,0x4b1221ab,0x8d1c5353,0x84da84b9,0x84da8d1b,0x64187479,0x84da84fb,0x84db8cfb,0x84ba84db,0x84da84da,0x84da84da,0x7cba84da,0x7cba7cba,
-0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7c9a7cba,0x7cba7c9a,0x7cba7cba,0x7cba7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7cba7cba,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7cba7c9a,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x6c187479,
-0x7cb97c9a,0x53957cda,0x74987c9a,0x84da7cba,0x53957c9a,0x6bf75b96,0x74586c17,0x9d5c6bd6,0x6b947416,0x292873b3,0x00255ad0,0x212873b3,0x8413a518,0x4a8d632f,0x9cb752ce,0x004731cc,0x00238477,0x00004a6b,0x082339c8,0x000131ab,0x108362ed,0x424bad59,0x94d652ae,0x5aae6351,0x522b6b2f,0x188120a3,0x31650800,0x00004a28,0x83cf6aeb,0x5aaba4b3,0x28c31000,0x28813964,
-0x7b4d3103,0x206162ab,0x62ec2061,0xbddb7bf2,0x10854a0c,0x7bb2ad99,0x10a68c75,0xb59bad59,0x28e2a4f5,0x9475526c,0x7bb16b51,0x4a4b41e9,0x52ab8414,0x9cd6ad56,0xa558528e,0x84148c34,0xbdd983f5,0x28e5a4f5,0x6b707bd4,0xc67c3a4e,0xcebece9e,0xbddadf1f,0x3944ff1d,0x6a232060,0x59a07284,0x61e07283,0x69e07a62,0x61e08283,0x6a0159a0,0x72417262,0x82a382c4,0x59a061c0,
-0x18a041c5,0x1000cd96,0x316449c3,0x30e11020,0xa5145268,0xa51252a9,0x28a36aca,0x730c8cb3,0x51e72942,0x31863123,0x41ed5b2d,0x9494632e,0x52cf5aee,0x7435a57a,0x9d7d4af3,0x8cfa953a,0x8cda7c78,0x953b84b9,0x7c5594f9,0x8cda9d3a,0x6bf65b95,0x7c998d1b,0x7c798cfb,0x84da8cfb,0x74798cfb,0x6c596c38,0x6c187cbb,0x84fb84da,0x84db7cba,0x7cba7cba,0x7cba84da,0x7cba7cba,
-0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7c9a7cba,0x7cba7cba,0x7c9a7c9a,0x7c9a7c9a,0x7cba7c9a,0x7c9a7c9a,0x7c9a7cba,0x7c9a7479,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7cba,0x7c9a7c9a,0x7c9a7c9a,0x7cba7c9a,0x7c9a7cba,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7cba7c9a,0x7c9a7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,
-0x74597cba,0x6c387cba,0x84db6c38,0x7c597c7a,0x747963f7,0x5b9663d7,0x53544b34,0x7c166375,0x00043a4d,0xad9c0005,0x42b029cc,0x426f4a8f,0x00650066,0x528d6b32,0x10a60000,0x00010023,0x39c90002,0x1002b596,0x4a2a0822,0x29477bf4,0x18a20000,0x7bf439a8,0x3a2c7413,0x8c548433,0x318b1065,0x4a27ad16,0x18611861,0x104120a2,0x20821000,0x39451000,0x28e33145,0x18811840,
-0x00004a2a,0x286028a2,0x20c43964,0x298aa536,0xb5bc6bb4,0x62ce4a2d,0x949694b6,0xd63db5ba,0x51c6ce19,0x73b18c53,0x7bd27392,0x08438412,0x736d8c52,0x4a4cad36,0x8c767c14,0xdedf4a4d,0x630cb59a,0x2927a42e,0xa5587393,0xc63d73d3,0xcebec67e,0xeedec65d,0x1944deba,0x6247a3ef,0x69e16a66,0x8b077ac4,0x6a006a01,0x69e07240,0x6a006a01,0x82a47222,0x7a617a63,0x51807a83,
-0x838c30c1,0x83ce4165,0x08009c30,0x28c09c70,0x62ca41c5,0xb53441a7,0x080049a5,0x394359e7,0x396330e1,0x08210821,0x5ace9cf6,0x84130862,0xa59b6b91,0x8cf7a579,0x74386c36,0x8cd984d9,0x7c989d7c,0x953b7c98,0x8cdb955c,0x849a7c5a,0x8d3b7c99,0x8cfb7c9a,0x84db8cfb,0x84da84db,0x743884da,0x84ba84fb,0x5bb684ba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,
-0x7cba7cba,0x7c9a7cba,0x7cba7cba,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7cba,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x74797c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7479,0x7c9a7c9a,0x74797c9a,0x7c9a7c9a,0x7c9a7479,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7cba7c9a,0x7c9a7c9a,0x7cba7c9a,0x7cba7cba,0x7c9a7cba,
-0x7c9a7c9a,0x74597cba,0x74387cba,0x6c587458,0x7c997cba,0x63f75b96,0x53336c18,0x08867c56,0x84774a90,0x5b3373f6,0x951c3210,0x4acf298c,0x298c5b31,0x53125b32,0x528e08ca,0x19050001,0xa51a0003,0x18c32125,0x3147b577,0x39897c33,0x1062526c,0x08454a2b,0x52ae31ca,0x526d7391,0x4a2c7371,0x18611884,0x94720801,0x312483ae,0x104020a2,0x08000000,0x082141e8,0x20801861,
-0x41c69431,0x310230e2,0x00000800,0x39ebdefe,0xa5786351,0x41eb7bd1,0x526c3168,0x31892948,0x5a472108,0xc61b31a8,0x9cd77391,0x422a630f,0x4207bdb8,0xb5b96b2e,0xbdba8476,0x4a4d83f3,0x31267350,0x41ea838d,0x9d175aef,0x94f87c14,0xc65d94d7,0xbd9cd6ff,0x18a3dedd,0x08e672a8,0xffdf10e6,0x6a0159e6,0x72226a02,0x59807a83,0x7a417262,0x8ac482a1,0x61a07a63,0x51606a01,
-0x49635a67,0xbdb6838d,0x5229cdf9,0x39416ae9,0x5a685206,0x49c4c5f5,0xe73d1820,0x7bef2882,0x4a075249,0x738e9cf1,0x39c87c13,0x526da514,0x6bf56bd3,0x951a31cd,0x74386c36,0x8cd94b12,0x84d9951a,0x84b9953b,0x74592a30,0x8d198d1b,0x8d1b8cfb,0x8cfb8cfb,0x84db8cfb,0x84da84db,0x7c9a84da,0x84ba84db,0x84ba84da,0x7cba7c9a,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,
-0x7cba7cba,0x7c9a7cba,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x74797c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x74797c9a,0x7c9a7479,0x74797479,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7479,0x7c9a7c9a,0x74797c9a,0x7c9a7c9a,0x7c9a7479,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7479,0x7c9a7479,0x7c9a7c9a,0x7cba7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7cba7cba,
-0x6c387cba,0x74596c38,0x7c9a63d7,0x747b6419,0x7c996c38,0x7c9a7459,0x84d97cba,0x73f763b1,0xb63e6352,0x53134290,0x5b748478,0x19080006,0x9cf81947,0x29286b31,0x00240021,0x5b2e0023,0x73d26393,0xa4f710c4,0x83f19cd4,0xa4f73a0a,0x18a39454,0x4a8e4a0b,0x63714a8d,0x5aae4a6d,0x39a94a2c,0x1862526b,0x20e40001,0x104141a6,0x7b8d0000,0x0820630b,0x94920000,0x41435aaa,
-0x31232062,0x29024143,0x00003965,0xc65c4a8e,0x6b72b5dc,0x9cf76311,0x00028bf1,0x6b907350,0x3142c61e,0xf79f7bf1,0xef3f630f,0x6b2f9cd6,0x41e762ed,0x10a6734f,0xacf77c35,0x6b2f49eb,0x416883b1,0x00246289,0xce7cb5b9,0xbe1c73d3,0xb5db7c14,0xbddbce9e,0x3943ce7a,0xa5ba4963,0xce3dc67d,0xf6d9e73e,0x72225120,0x6a016181,0x7a6161e0,0x82839b46,0x82a38283,0x72a37242,
-0x72ca51a7,0x49a528a1,0x838d3944,0x5a688bce,0x396341a5,0x39633943,0x41a520c1,0xce394a29,0x62ecad35,0x2125734e,0x424a1083,0x84578455,0x4a908457,0x84986352,0x8d198cda,0x953b63d6,0x6bf67437,0x84ba216e,0x951b8cfb,0x84fb8cda,0x8cfa8d1b,0x84db84db,0x84db84db,0x84da84ba,0x7c9a84da,0x7cba84db,0x7cba84da,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7c797cba,
-0x7cba7cba,0x74797c9a,0x7cba7c9a,0x74797c9a,0x74797c9a,0x7c9a7479,0x74797c9a,0x7c9a7c9a,0x7c9a7479,0x7c9a7c9a,0x74797479,0x74797c9a,0x74797479,0x74797479,0x7c9a7c9a,0x747a7c9a,0x747a747a,0x7479747a,0x74797479,0x74597459,0x747a7c7a,0x747a747a,0x7c9a747a,0x7c9a7479,0x747a747a,0x7c7a7c9a,0x7c7a7c7a,0x7c9a7479,0x7c9a747a,0x7c9a7479,0x7c9a7c9a,0x7c9a7c9a,
-0x7cba7cba,0x84db7cba,0x74597c9a,0x7c9a7c9a,0x116e84fb,0x849984da,0x8cb96bb5,0x63727417,0x8cb894f9,0x84576bb4,0x29a94aaf,0x5aed632f,0x084339ca,0x39ca2107,0x422b0002,0x000139c9,0x00055b10,0x6bb37bf4,0x41ea0002,0x7bf52948,0x31670002,0x086520c4,0x4aafa55a,0x526c4a8e,0x3987a517,0x082220a4,0x318820e6,0x52296b4e,0x08003145,0x39862904,0x312428e3,0x28a320a2,
-0x29202082,0x28e228c1,0x7bd07bd0,0x528c0000,0x841594b7,0x6b5294d7,0x29067b90,0xa4f42906,0x28c128e5,0x84114188,0x3189630e,0xc5fa4a4c,0x5aaa62cc,0x5acf7b72,0x8c32736e,0x7b2f83b1,0x4a0e3969,0x6b6f93ef,0xad798455,0xad9acebe,0x94958454,0x94958413,0x5a05f6fc,0xd6fe2924,0xc61ba557,0x62acb558,0x6266b556,0x69e17aa6,0x59805960,0x7a417242,0x7a827a82,0x59807242,
-0xbd75e6dd,0x28c038e1,0x28e14163,0x49c6a491,0x5206730b,0x31023122,0x5a8a3985,0x31a8528c,0x39a62966,0x0822738f,0x31444208,0x4a6d10a4,0x7c345b51,0x63b34acf,0x953a63f7,0x84b9955c,0x7c78953b,0x84ba951a,0x8cfa8d1a,0x6c3a84ba,0x8cfa8cfb,0x84db84db,0x84da84db,0x84da84da,0x84db84da,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7c9a,0x7cba7cba,0x7cba7c9a,0x7c9a7cba,
-0x7c9a7c9a,0x7c9a7c9a,0x74797c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7479,0x74797479,0x74797c9a,0x7c9a7479,0x74797479,0x74797c9a,0x74797479,0x74797479,0x74797479,0x74797479,0x74597479,0x747a7459,0x7479747a,0x7c9a7479,0x74597459,0x747a747a,0x747a747a,0x7479747a,0x7c7a7c9a,0x747a747a,0x745a747a,0x747a7c7a,0x74797c9a,0x7c7a7c7a,0x74797c9a,0x7c9a7479,0x7c9a7c9a,
-0x74797cba,0x74597459,0x7cba7cba,0x7cba7c99,0x849a7c99,0x74187438,0x8cda8cb9,0x7c360027,0x94d86372,0x5af1298b,0x39eb528f,0x0002420b,0x18a51085,0x630f0023,0x7bd14a6c,0x528d2127,0x18e82968,0x5b3152f0,0x18a50823,0x31cd6b8f,0x31670003,0x29491061,0x6bb36351,0x20e673b3,0x28e618a5,0x5a6c49ea,0x5ace5b0e,0x18c4528c,0x5a8b3987,0x39861062,0x20c3630b,0x28800800,
-0x21250805,0x72ebbd55,0x94526b0d,0x18a41041,0x4a8b7bd2,0xb57b39cc,0x5aac2907,0x39c89473,0x39435209,0xad5641a8,0x08435aab,0xad378413,0xa4f43149,0x7bd1ad35,0xb5b6526b,0x83f45ace,0xad988c75,0x52af41a6,0x6b93a57a,0x94d7be3b,0xdf1fc67e,0xa4d583d3,0x51c52860,0xa55728e4,0x41c9ffbf,0x6aee7bd2,0x8390ad15,0x8b6bde59,0x72236a04,0x7a8169e0,0x6a207a62,0x72417241,
-0x310341a8,0x416328a0,0x39654163,0x4185d69a,0x28e120a1,0x39623121,0x29033124,0x00033189,0x29249cd3,0x08005269,0x420620c1,0x004320e4,0x29878c71,0x3a6e1127,0x74576c16,0x6bf68cfa,0x6c165333,0x7cd97c98,0x74587c99,0x74797458,0x84db84db,0x84da84da,0x84da84da,0x84da84da,0x7cba84ba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,
-0x7c9a7479,0x7c9a7c9a,0x7c9a7c9a,0x74797c9a,0x7c9a7479,0x7c9a7479,0x74797479,0x74797479,0x74797479,0x747a7479,0x74597459,0x74597459,0x74597459,0x74597479,0x747a7459,0x74597459,0x74597459,0x74797459,0x74797479,0x747a747a,0x74797479,0x74597459,0x747a7459,0x747a747a,0x7479747a,0x747a7479,0x747a747a,0x74797c79,0x747a747a,0x7c7a7c7a,0x7c7a7c7a,0x7c9a7c7a,
-0x74597cba,0x7c997479,0x84db63f8,0x7cdb8d3d,0x00696c18,0x4af221cd,0x320f9d5d,0x08664af3,0x52d13a0d,0x192810c8,0x3a2c422e,0x4a4b2106,0x08234a2b,0x39a941c9,0x084318a5,0x20e55acd,0x52f00002,0x635252f0,0x002218a4,0x39ca3189,0x31460023,0x8c1320c3,0x08650003,0xad5739ec,0x2106420a,0x424c0843,0x4a4c6b30,0x41e94a6d,0x31663166,0x29041041,0x20811860,0x20e220c3,
-0x734f1041,0x31450800,0x7bb1d69d,0xc5d862ec,0x4a0a9473,0x62ee1885,0x31485aae,0x18852928,0x18403966,0x31874a07,0x8c3283f1,0x41ea3167,0x62ee8412,0x73b29c71,0x526fbdda,0x9454528e,0xd65c5aad,0xadfc4145,0xbe3c8475,0x8c769d18,0xd6bea538,0x9c75b57a,0x4123f6db,0xde9d10c6,0x9cd862ef,0x73907391,0xbdd93988,0xce1b73b0,0x832ace19,0x722251a1,0x72428282,0x69e07a83,
-0x83adbd16,0x39424984,0x31463963,0x188173b0,0x49a5730c,0x41c53984,0x290228e2,0x62ad3146,0x41a68c2f,0x738d28e3,0x41e64a47,0x8cb820e4,0x4a8a0882,0x6bf59517,0x63d563d5,0x63d642d2,0x63d62a0f,0x84fb7438,0x84da6c38,0x84da7cba,0x84da84da,0x84ba84ba,0x84ba84ba,0x84ba84ba,0x7cba7c9a,0x7cba7cba,0x7cba7cba,0x7c9a7cba,0x7c9a7c9a,0x7c9a7479,0x74797c9a,0x7c9a7c9a,
-0x7c797c9a,0x7c9a7c99,0x7c9a7c9a,0x74797479,0x74797479,0x74797479,0x74797479,0x74797479,0x74797479,0x74597479,0x7c7a7459,0x74597439,0x7459747a,0x74597479,0x74597459,0x74597459,0x74597459,0x74797459,0x74797479,0x7479747a,0x7479747a,0x7459747a,0x7459747a,0x74597c7a,0x74797459,0x747a7c9a,0x747a747a,0x74797479,0x747a747a,0x747a747a,0x747a747a,0x7c797c7a,
-0x74797479,0x5b965b96,0x6c396c39,0x749a63f7,0x6bf77479,0x3a507c78,0x6bf6951c,0x19093230,0x298a298b,0x8c980867,0x29ab31ce,0x3168420a,0x18a541ca,0x20c51043,0x31670823,0x00004a4b,0x6b7373b1,0x426c52f0,0x10640862,0x000273d0,0x10620002,0x08002924,0x5aef3168,0x8c557bd2,0x39a9528d,0x10c71085,0x18e67391,0x8c3352cd,0x000020a4,0x1882734f,0x10200800,0xa4d320a2,
-0x39860821,0x94724a48,0x739018c5,0x7baf8c31,0x10634a29,0x94527390,0x9cf67350,0x94952948,0x312539a8,0x8c322905,0x630d4a2a,0x4a2b3188,0x6b2e4a2d,0x4a6c4a09,0x83f694b6,0xc5b88434,0x7bf341ea,0xadfd2063,0xa55abe5d,0x9cf79cd7,0xad591908,0x6b317bd5,0x39246aed,0x41eb5acf,0x73b38c75,0xd69ebdfc,0x5a6d9454,0x9c9628e5,0xc5dac61b,0x51a39c52,0x7aa37263,0x82c37a62,
-0x31035a28,0x30c14163,0x314228e1,0xbe175ace,0x83ef49c6,0xd6b9528a,0x292228e2,0x20c220c2,0x39a44a07,0x20c25aa8,0x212020e2,0x298918e3,0x6baf3a2a,0x4af231ec,0x94fa7c58,0x52f284b8,0x84ba73f7,0x2a104ad4,0x85198d1e,0x74597cb9,0x84bb747a,0x84da84da,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7c9a7cba,0x7c9a7c9a,0x74797c9a,0x7c9a7479,0x74797c9a,
-0x74797c9a,0x74797479,0x74797c79,0x74597479,0x74797479,0x74597459,0x74597459,0x745a747a,0x74597459,0x74597459,0x74597459,0x74597459,0x74597459,0x74597459,0x6c596c59,0x74797459,0x74796c59,0x74796c59,0x6c597479,0x6c596c59,0x74796c59,0x749a6c59,0x74796c59,0x74796c59,0x7479747a,0x74797479,0x74797479,0x747a747a,0x747a7479,0x74797459,0x749a7479,0x7cbb747a,
-0x63b85377,0x74787458,0x7c797438,0x7c5863b6,0x0008198d,0x29ad0047,0x6bf76bd5,0x424f6bf5,0x424e31ed,0x192c0068,0x29ac4270,0x10a531cb,0x31895aad,0x3168526c,0x62cc2947,0x29261863,0x4a6e2127,0x000173b2,0x29470821,0x000331a8,0x39e96332,0x10214207,0x420a20e5,0x000310a6,0x21287c13,0x212952ae,0x31a873f3,0x6b2f2948,0x39880024,0x20a341e8,0x18811881,0x0020acf4,
-0x10001041,0x28a49431,0x7bf23168,0x18c4ef5f,0x00010001,0x83d118a5,0x83f3b579,0x9c76528c,0x526a18a4,0x5aad2063,0x2989ad37,0x0824a4b5,0x7392420d,0x31880823,0x83d28c54,0xb5371044,0x7b8f9433,0x7c7620a4,0xa55ac67f,0x94d9ad9a,0x632f6b95,0xc67c73b1,0x20c37b70,0xd6bc426e,0x631252ce,0xad9ae77f,0x84149d38,0x31287b6e,0x8435a4b7,0x9c73a538,0x4140eebb,0x72217263,
-0x9c2fee99,0x30e13962,0x62876aea,0x630a18a2,0x08201861,0x18810000,0x20e241a5,0x4a0620c1,0x18a02902,0x316220c0,0x10802100,0x52cc39c7,0x000231c9,0x6bd6194a,0x9d3b951b,0x84998498,0x29ee3a30,0x6bd684b8,0x63d79d3c,0x7c996c38,0x747984ba,0x84ba84ba,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x74797479,0x74797479,
-0x74797479,0x74797459,0x74797479,0x74797479,0x74797479,0x74597459,0x74597459,0x7459747a,0x7459747a,0x6c397459,0x74397439,0x74597459,0x74397459,0x74597459,0x6c596c59,0x6c596c59,0x74796c59,0x6c597479,0x6c596c59,0x6c596c59,0x74596c59,0x74796c59,0x74797479,0x747a7479,0x6c596c59,0x747a6c59,0x7479747a,0x74796c59,0x74797479,0x74797479,0x747a7479,0x6c597459,
-0x7c99749a,0x84bb7c9a,0x116d7479,0x4b554b97,0x6bf763d6,0x6bd76bf7,0x7c7963b6,0x4270322f,0x52f34a91,0x52f25b54,0x29cc8478,0x7c139496,0x10647370,0x4a4b7bd1,0x10220002,0x528b3166,0x31aa0864,0x10834a8c,0x4a4a0821,0x4a6c420a,0x318939cd,0x1021738f,0x62ee4a29,0x63525acf,0x29695af0,0x5af039eb,0x39c973d3,0x29481085,0x1883630f,0x20826b0c,0x20c21040,0x52690000,
-0x5a6a28e4,0x41660000,0xffdf83d1,0x39ab0002,0x73926312,0x18a43147,0x5aad4a2a,0x21095ace,0x7372d67e,0x29282083,0x9d197392,0x63304a8e,0x6b5062ef,0x294883f2,0x4a0b18c6,0x6aee7350,0x62ac28e6,0x4af0528d,0xad9cc67e,0xd6df94b9,0xb5db5b0f,0x9d1839ec,0x2104eeba,0x216a9d5a,0x8cb78c96,0xaddb94fa,0xb5ba9d59,0x7bb19cd4,0x7bb37370,0xbdd8bdfa,0xd63c83d2,0x61e4e6dc,
-0x28c03982,0x28e228c0,0x20427bae,0x41a79411,0x41a61861,0x20c21882,0x316339a5,0x39851042,0x28c220e0,0x294120c0,0x20e320e1,0x316741e8,0x52f10865,0x95397c76,0x21ac0088,0x6bb43a2e,0x53533a4f,0x84da196e,0x53555b76,0x7cba747a,0x7cda7c99,0x7cba7cba,0x7cba7cba,0x7cba7cba,0x7cba7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7c9a,0x7c7a7c7a,0x74797479,0x74797479,0x74597c9a,
-0x747a7479,0x747a747a,0x74597459,0x74597459,0x74597459,0x6c397459,0x7459747a,0x74397439,0x74797459,0x74396c59,0x74597459,0x74597459,0x74397459,0x6c596c59,0x74397439,0x74597439,0x74397459,0x6c397439,0x6c396c39,0x6c596c59,0x6c596c59,0x74596c39,0x6c397459,0x74597439,0x74597459,0x6c597459,0x74796c59,0x74596c59,0x74596c39,0x747a7459,0x747a747a,0x6c59747a,
-0x74997499,0x6c3a7cbb,0x6c1742f4,0x6c1763f7,0x198e6c38,0x74382a0f,0x112c63d6,0x4ad2a5be,0x63d44ad2,0x63957c98,0x08a808a9,0x526d2128,0x31676b2f,0x290618a4,0x188339a8,0x73b018c3,0x002829aa,0x10412127,0x41ea1041,0x10a50001,0x39a82107,0x18c441e9,0x29673166,0x5aaf6b70,0x4a6e7bf4,0x8c7739ed,0x31eb4a6e,0x4a6d0003,0x31470823,0x396641a8,0x31240000,0x080028e3,
-0x8bef5a8a,0x20c218a2,0x31461001,0x29279cb5,0x526c18c6,0x00027bb0,0x39a962ed,0xbdda4a4c,0x9cd673d4,0x186141e7,0x6b520004,0x7c156bb5,0x5ace1083,0x7bd152ab,0x18c6422b,0x29264a6d,0x18634a0a,0x73b15a8d,0xad9badbc,0x8c757c34,0xad985aef,0x7b6f5b0f,0x21057aab,0xb5f95b74,0x7c767c16,0xa559cedf,0xb5dbbe3d,0xbe1eb5da,0xdf3f318d,0xb5bd5b10,0x422ab579,0xb4f2b659,
-0x7b4b3963,0xc5b728e1,0x6392736f,0x6aeba4f4,0x312420a2,0x00003145,0x000052c9,0x2925a4d5,0x29053986,0x294320c2,0x3a0918a2,0x10849cd5,0x95582169,0x4ad05b31,0x4a6e5af0,0x5b747437,0x322f7437,0x42d37438,0x84bc7c9a,0x743a743a,0x745a5335,0x7cba7c9a,0x7cba7cba,0x7c9a7cba,0x7c9a7c9a,0x7c9a7c9a,0x74797c9a,0x74797479,0x7c7a7459,0x74797479,0x74797479,0x74597c9a,
-0x747a7479,0x74597459,0x74397439,0x74597459,0x74397459,0x6c397439,0x6c397459,0x7439747a,0x6c597459,0x747a6c59,0x74597459,0x6c396c39,0x74396c39,0x6c386c39,0x74397439,0x6c397439,0x74396c39,0x6c397439,0x6c396c39,0x6c596c59,0x6c596c59,0x74596c39,0x6c397459,0x74597439,0x6c397439,0x6c597459,0x74796c59,0x74596c59,0x7439747a,0x74597439,0x747a7459,0x749a6c39,
-0x749a7479,0x745a5bd7,0x5bb66c39,0x74386c18,0x5b96114d,0x6c177458,0x743821ae,0x3a707c79,0x4290194c,0x29ef5313,0x19293a4f,0x630f2128,0x4a2c3168,0x6b0e2906,0x31673147,0x00057bd2,0x73b54a90,0x10410000,0x420b0820,0x422c0002,0x18c518c6,0x18a4528b,0x39c918a4,0xad582127,0x39ee31ab,0x73d45af1,0x31eb426e,0x18e6422b,0x396718c5,0x10412905,0x10204a08,0xad146b0c,
-0x00000800,0x31440800,0x9c931000,0x084318a4,0x73705a8e,0x5ace422a,0x841239a8,0x7bb30002,0xdebfb5de,0x418641c7,0x73910041,0x7bd4ad9a,0x9c964a6b,0x31885acc,0x7bd2526d,0x18a62107,0x28e441c9,0x73b1526c,0x8c76426d,0x94d794f7,0xad58adba,0xef1e83f2,0x294520a0,0xd6be29ed,0x953b7c15,0xbe3d8d19,0xc65dbdfc,0xc65ec65c,0x9cf8ad7b,0xf7dfdf3f,0x41cadebf,0x4944ef1e,
-0x18a141a6,0x398441c5,0x10002945,0x41c620a2,0x31455a8a,0x20c418a3,0x424b0002,0x630f5aad,0xce7cbddb,0x422928c4,0x1927630e,0x00035aef,0x7c58218f,0x31cb8cb6,0x198c52af,0x42b242d2,0x7c7a63b6,0x743a8d1c,0x7cd984ba,0x84da7cd9,0x7c997c99,0x7cba7cba,0x7cba7cba,0x7c9a7cba,0x7c9a7c9a,0x7c9a7c9a,0x74797479,0x74797479,0x74597459,0x74797479,0x74797479,0x74797479,
-0x74597479,0x74597459,0x74597459,0x74397459,0x74397439,0x74596c39,0x74597459,0x74597439,0x6c597439,0x74596c59,0x6c396c39,0x74396c39,0x6c396c39,0x6c396c39,0x6c396c39,0x74397439,0x6c396c18,0x6c396c39,0x6c596c39,0x6c596c39,0x6c396c39,0x6c396c39,0x6c396c39,0x74397439,0x74397439,0x6c397459,0x6c596c39,0x6c596c59,0x74597459,0x74397459,0x74397439,0x64197459,
-0x63d96c39,0x6c786c59,0x53b86418,0x42d3747a,0x63f70028,0x6bf763b6,0x6bf729ef,0x5b547c79,0x4af36395,0x74194af4,0x426d5b52,0x62ef2108,0x49ee2907,0x29068c12,0x3188526b,0xa59c73d5,0xb5fb63d4,0x28e4a515,0x00230000,0x52f02989,0x18c518a5,0x29462125,0x526c526a,0x21256350,0x6b7518e7,0x4a8d5b12,0x3a0c0025,0x422c6b50,0x3167630e,0x188228e5,0x20a220c3,0x10200800,
-0x104120c3,0x732c62aa,0x10211020,0x31871883,0x528d6b30,0x29286b4f,0x41ea6b2f,0x00008413,0xc5dcadbb,0x41875aac,0x0863d6be,0x18a6c619,0x000339a9,0x8c549cb5,0x528d2949,0x398a6b50,0x18606b0f,0x4a4d4209,0x94f894d5,0xa579a579,0xc5f99cf7,0x6a486b2e,0x29444944,0xa53acedf,0x218fcedf,0xd6dfc6bf,0xc65dbe3d,0xc67dce9e,0xb5bbc67d,0x9495ce9d,0x420cbdda,0x3124cdfb,
-0x1860bd74,0x10619472,0x83ef3145,0x31456b0c,0x3966732d,0x422bce39,0x5acd6332,0x7bd149eb,0x84536373,0x94b53187,0x8c558c95,0x8cd86352,0x10eb6bf5,0x5b5294fa,0x29ce6bd6,0x7438196d,0x8cda7c5a,0x7c798cdb,0x747984b9,0x7cba7cba,0x74797cba,0x7c9a7459,0x7c9a7c9a,0x7c9a7c9a,0x7c9a7479,0x74797479,0x7c9a7479,0x74797479,0x7459747a,0x74597459,0x74597459,0x74597459,
-0x74597459,0x74597439,0x74597459,0x74397439,0x6c596c59,0x6c397439,0x74597459,0x6c397459,0x6c396c59,0x6c396c39,0x6c396c39,0x6c396c39,0x6c396c39,0x6c396c39,0x6c396c39,0x6c396c39,0x6c397439,0x6c396c39,0x6c396c39,0x6c396c39,0x6c396c39,0x6c186c39,0x6c396c18,0x6c396c39,0x6c396c39,0x6c597459,0x6c396c59,0x6c596c59,0x6c396c59,0x74597439,0x6c597459,0x6c596c59,
-0x745963f8,0x63d76c39,0x749a6c39,0x7cba5375,0x5355094d,0x5b965b97,0x7c993291,0x63957438,0x84777c78,0x63b45312,0x3a2d10c7,0x5ad018e8,0x526d52ce,0x31260001,0x4a2b41a8,0x63526bb2,0x20e5422e,0x082141e9,0x29052945,0x20c739ed,0x20c5526c,0x5a8c0823,0x420a39a8,0x635173d2,0x9d3a6b73,0x1909422e,0x2169426d,0x214873b1,0x4a2c398a,0x39873188,0x314620c3,0x4a089472,
-0x00000000,0x29043965,0x4a493124,0x4a090000,0x10640802,0x0005632f,0x73700001,0x41eaa517,0xb5790823,0x08024a0a,0x94756b92,0x08455ace,0x3189ad37,0xc61ba4f6,0x4a8d73d3,0x84337c13,0x52086b10,0x52af526a,0x10a78455,0x8476320c,0x73b16bd3,0x30c16b2c,0x41e749a5,0x6bd3adbc,0x4ab09517,0x95386bb4,0xa59aa57a,0x10e8be1d,0xb5dc8cb7,0xa558be3d,0x9d5973b3,0x51a6f6fd,
-0x738d3965,0x398628e3,0xce1839a6,0xbd963986,0x29051063,0x18c53146,0x108310c7,0x73ae2105,0x4a4b8c96,0x52ad10e6,0x7c355b32,0x74360047,0x6bd56394,0x53340068,0x4ad15b94,0x42b35375,0x63f863d8,0x535542d2,0x63d77479,0x74596bf8,0x7c9a6c18,0x74597479,0x7c9a7c9a,0x7c9a7479,0x74797479,0x74797479,0x74797459,0x74597479,0x74597459,0x74597459,0x74597459,0x74397459,
-0x74597439,0x74397439,0x74397439,0x74397439,0x6c596c59,0x74597439,0x74397439,0x6c396c39,0x6c396c39,0x6c396c39,0x6c186c18,0x6c186c39,0x6c396c19,0x6c186c18,0x6c396c18,0x6c186c19,0x6c186c39,0x6c186c39,0x6c186c18,0x6c386c38,0x6c396c18,0x6c396c39,0x6c397439,0x6c396c39,0x6c396c39,0x6c397439,0x6c396c39,0x6c396c39,0x6c396c39,0x74397439,0x6c397439,0x6c396418,
-0x74597479,0x7459747a,0x63f86418,0x6c384b14,0x6bf70049,0x63d75bb5,0x6bf75bb7,0x84b963d6,0x639342b1,0x637321ab,0x4aae530e,0x422d39ec,0x08242107,0x28e55a8c,0x39ea62ac,0x212739eb,0x8c124a4c,0x736e2926,0x39a741e8,0x00033a2a,0x29062106,0x4a2a4a0a,0x947420c5,0x6b93318a,0x6352296a,0x9d3a4a8f,0x39ed10c8,0x298a422d,0x73d339ed,0x0844424c,0x9cb341ea,0x41e7ce39,
-0x18827b8e,0x080028e3,0x42085228,0x000020c3,0x20c53145,0x39cc6311,0x39aa4a4d,0x524d7371,0x00006b2f,0x3105c5b8,0x7bd23127,0xb5ba6311,0xbdd90002,0xc5fb2106,0x73b3b5bb,0xa537422d,0x39456b30,0x31ca7b90,0xe75fc63d,0x741552f1,0xbe1bc65e,0x1821bdb7,0x528a41c7,0x631173f5,0x7bf2420e,0x73f59d5b,0xb61d9d59,0xa59abe7e,0xadfd42af,0xb5fbce9e,0xad798cb6,0x3945936d,
-0x9cb24185,0x39c62081,0x20c441e8,0x18a31883,0x83f05acd,0x526d9493,0x0842c5bb,0x636f39e9,0xa5572167,0x42ae31ca,0x42707c35,0x00457c35,0x84998cb9,0x4ab242b1,0x2a52953c,0x42d242b1,0x2a524af3,0x53755396,0x5bb66c38,0x6c3863f7,0x7c9a7c9a,0x7c797479,0x74797c9a,0x74597479,0x74797459,0x74797479,0x747a7479,0x74597459,0x74597439,0x74597459,0x74597439,0x74397459,
-0x74397439,0x6c397439,0x74397439,0x74396c39,0x74396c39,0x6c596c59,0x6c396c39,0x6c396c39,0x6c186c39,0x6c396c39,0x6c386c38,0x6c396c18,0x6c186c18,0x6c186c18,0x6c396418,0x6c396c38,0x6c396c39,0x6c386c39,0x6c396c38,0x6c186c38,0x6c386c38,0x6c396c38,0x6c396c39,0x6c396c39,0x6c396c38,0x6c396c39,0x6c396c39,0x6c396c39,0x6c396c39,0x6c396c39,0x64186c39,0x6c396c39,
-0x74596c59,0x747a6418,0x6c3963d7,0x4b3563f8,0x63d75bb6,0x4b3463d7,0x4b1463d7,0x63965333,0x31ef5332,0x6b5373f4,0x4ad0426e,0x29ab4a8f,0x7b70526d,0x39892927,0x39ca39a9,0x316a420b,0x5aab3189,0x20c43986,0x08015229,0x4a4d0803,0x39c920e6,0x316839c9,0x39cc3189,0x298a52af,0x4aaf5b10,0x52af73d4,0x94d85b12,0x18e96331,0x4ad06bb4,0x39ea428f,0x31472947,0x31461863,
-0x1061524a,0x0820734d,0x4a080800,0xad3583f0,0x20c51021,0x298b8476,0x4a8ead39,0x39a918a5,0x6b2f8c33,0x39851883,0x5aad20c3,0xa53839ec,0x8c137bb1,0x8c541063,0x8c768c96,0x73d26b73,0x52298c35,0x7370c5b7,0xa53a8c95,0x63926bd2,0x83f4ad9e,0x18628390,0x0823c5b8,0x530f6bb3,0x7c36a59a,0x94d89d7a,0x9d7aaddc,0xbe7e9519,0x9d9badfc,0xb5dcb61b,0xd67cd6be,0x08a45105,
-0x41432903,0x20e34185,0x08422906,0xbddc18e7,0x39cace1c,0x528dc5fa,0x00023147,0x5b0f5b0f,0x00652968,0x4ad2112a,0x4a8f8cb7,0x6374b5de,0x5312320f,0x5b523a6e,0x5bb85313,0x7c997cb9,0x7c797439,0x7c996bd7,0x74797c99,0x63f763f7,0x7c9a7459,0x74797479,0x74797479,0x747a7479,0x74797459,0x74797459,0x74597479,0x74597459,0x74596c39,0x74397439,0x74597439,0x74396c39,
-0x74397439,0x6c396c39,0x6c396c39,0x6c396c39,0x6c396c39,0x6c386c39,0x6c386c38,0x6c396c38,0x6c186c39,0x6c386c39,0x64186418,0x6c186c39,0x6c186c39,0x6c186c18,0x64186418,0x6c386c38,0x64186c38,0x6c386c38,0x64186c59,0x6c386c39,0x64186418,0x6c386c38,0x6c396c38,0x6c396c38,0x6c186c38,0x6c386c38,0x6c386c38,0x6c596c39,0x6c396c39,0x6c396c39,0x6c596c39,0x6c596c39,
-0x74796c39,0x6c385bd7,0x63d76c39,0x5b966c18,0x6c385bb6,0x74596c38,0x63b74b14,0x3a4f4b13,0x5b555b34,0x63535b11,0x192a6373,0x6b9373f5,0x20e662ef,0x41ca3168,0x18e72106,0x94962969,0x7b8f1085,0x31660000,0x08001001,0x62ef1064,0x4a4c39aa,0x39a94a4c,0x4a4e1084,0x29685ad0,0x4a8f4a6d,0x633131ec,0x7c15df1f,0x216b52af,0x73f47c15,0x420c6352,0x082339a9,0x29270844,
-0x21257bd0,0x41c89452,0x00001883,0x39a739a7,0x0801bd76,0x631062ad,0x4a6f4aaf,0x08437391,0x5a8c5a8c,0x3105c5d9,0x4a6c3986,0x5ad07373,0x420ba4f7,0x8c35b5b9,0x9cd70003,0xa4f883f4,0x30c58bf2,0x18e63166,0x6311bdfb,0x94d57bf4,0x9cb6a558,0x18849411,0x39ec5acd,0xefff4ad0,0x74379d7b,0xb5fbaddd,0xb61da59b,0xadbcb63e,0xc69eaddc,0xc65eaddc,0xfffff7df,0x2af04943,
-0x39233903,0x9cf63104,0x3a0cc61a,0x214ace7e,0x39c97370,0x5accad36,0x422b39c8,0x3a0c8434,0x53326392,0x8cd98cd9,0x18eb5b52,0x63376374,0x6bb38cd8,0x00c83a4f,0x6c182a0f,0x847984b9,0x741973f8,0x6c386bf8,0x74797c99,0x74797459,0x74797c9a,0x74797479,0x74797459,0x74597479,0x74797459,0x74597479,0x74597459,0x74397459,0x6c596c59,0x6c596c59,0x6c396c59,0x6c596c39,
-0x6c396c39,0x74396c39,0x6c396c39,0x6c386c39,0x6c396c18,0x6c396c38,0x6c186c18,0x6c186c18,0x6c186c18,0x64186c18,0x64186c38,0x6c186c18,0x64186418,0x64186418,0x64186418,0x6c386c38,0x64186418,0x6c386418,0x64186c38,0x6c386c38,0x6c386418,0x6c386418,0x64186c38,0x6c396c38,0x6c386c38,0x6c386c39,0x6c186c38,0x6c386c39,0x6c396c38,0x6c396c39,0x6c396c39,0x6c396c39,
-0x6c396418,0x747a6c39,0x6c597479,0x6c185bb6,0x63d76c38,0x6c3863d7,0x5bb75b96,0x3a6e6bd7,0x6bf642b1,0x3a0c31cc,0x5b135b12,0x7bd56bb5,0x5a8d2928,0x41ea41ea,0x18c62947,0x6bb320e8,0x41c84a8d,0x29250821,0x31663986,0x31a95a8c,0x2968632f,0x41ea8413,0x5aaf2967,0x292739ed,0x52af4a6c,0x5acf296a,0x52d04aaf,0x5b107bf5,0x52d09d18,0x635273d5,0x10640865,0x31aa8c74,
-0x5aef5aae,0x086439ea,0x41c920c6,0xce380001,0x526a62ec,0x08020800,0x296be6ff,0x947473b2,0x21056b0e,0x3146acf5,0x00014185,0x52b16311,0x6b726b92,0x524b398a,0xad7894d6,0x5a4b3128,0x2906732e,0x6b2e9d16,0x6b73528e,0x5aef9d16,0x84548c36,0x2967c5f9,0x29ad8c73,0x9d9b4af1,0xd73f6393,0x9d7aadfd,0xaddbadfc,0xa59bbe5e,0xce9fbe5e,0xc67dc67e,0xffbece9e,0x855c3904,
-0x41a62881,0x5ace41c7,0x18e5632f,0x00012967,0x7bd03168,0x31875aac,0x4a8f0044,0x3a0b31ca,0x84b863b3,0x53123a6f,0x192d8478,0x218b6373,0x214a4ab0,0x5373a59c,0x6c185354,0x7c594292,0x74386c18,0x6c387479,0x7c9a6c38,0x74797479,0x74797c9a,0x74797479,0x74797479,0x74597479,0x74797459,0x74597459,0x74397439,0x74397439,0x6c596c59,0x6c596c59,0x6c396c38,0x6c596c39,
-0x6c396c39,0x6c186c39,0x6c396c39,0x6c386c39,0x6c396c18,0x64186c38,0x6c186c18,0x6c186c18,0x6c186c18,0x64186c18,0x64186c38,0x6bf86bf8,0x64186418,0x64186418,0x64186418,0x6c386418,0x64186418,0x64186418,0x64186418,0x6c386418,0x6c386418,0x6c386418,0x64186c38,0x6c396c38,0x6c386c38,0x6c386418,0x6c186c38,0x6c386c38,0x6c396c38,0x6c396418,0x6c396c39,0x6c396c39,
-0x7459747a,0x74597459,0x53966c59,0x74796c18,0x53766c39,0x6c387479,0x63f85b96,0x29ed5b75,0x4af36395,0x422d31ed,0x6bb5426f,0x18e952d1,0x20e739cb,0x420b630f,0x420b4a4c,0x3a0d7392,0x20c46b51,0x188320e4,0x28e43987,0x420b3147,0x210739ea,0x739039ea,0x4a4c420a,0x9cb54a6e,0x631131aa,0x8c766331,0x426e6352,0x9d1852b0,0x7c146b92,0x7bd373b4,0x00044a2c,0x5acf7393,
-0x8c5539cb,0x39ea0002,0x08447bd1,0x000031a9,0x5aabffff,0x20c50000,0x422c0844,0x6b304a4c,0xbdb86b2e,0xc5d70001,0x29260000,0x9cb98435,0x94b752d0,0x8c12420b,0x841283d2,0x49e9a4d6,0x394720c5,0x39cac61b,0x214973b2,0x39ec5b10,0x84138435,0x4a8e7b90,0x00677bf2,0xa59c8d18,0xbe7eadfd,0xc6bf7c56,0xbe5eadbc,0x9d7ab63d,0xce9fb63d,0xcebfc69f,0x72cbc63c,0x7cf82882,
-0x080030c2,0x31a91062,0x735110a5,0x4a0c6b30,0x83f118a5,0x20e552ac,0x6bf20062,0x21ca6391,0x84982a0c,0x5b546bb4,0x84748cda,0x7c36214c,0x5b336374,0x21ad29ae,0x112c116c,0x747a3a94,0x53787cba,0x63d85bb8,0x74796c39,0x74797479,0x74797479,0x74797479,0x74797479,0x74597479,0x74597459,0x74597479,0x74397459,0x74397439,0x6c396c39,0x6c396c59,0x6c396c39,0x6c397459,
-0x6c186c39,0x74396c39,0x6c396c39,0x6c186c38,0x6c386c39,0x64186c38,0x6c186c18,0x6c186c39,0x6c186c18,0x64186c18,0x64186418,0x63f86c18,0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x6c186418,0x64186418,0x64186418,0x64186418,0x64186418,0x6c386418,0x6c386c38,0x6c386c38,0x6c386c18,0x6c386c38,0x6c186c38,0x64186c18,0x6c396c39,
-0x74396c59,0x6c187459,0x64186c39,0x5bb67459,0x63f85bb7,0x6c387459,0x74796bf7,0x6bd77437,0x4ad25b54,0x4a8e424e,0x63544ab0,0x94b84a90,0x4a8e5af1,0x52ae424d,0x39aa2148,0x424f4a4d,0x29056b52,0x20c42925,0x20c35a8b,0x39ca2927,0x526d4a6d,0x39a939eb,0x841218c5,0x73900023,0x10c739eb,0x296a296a,0x84353a2d,0x7bf3422e,0xbddb7371,0x73928c35,0x002249cb,0x9476422c,
-0x7bd4296a,0x84345acf,0x19075aed,0x630d5af1,0x08000000,0x20830800,0x00001882,0x3148cdfa,0x39a85aac,0x6b0d522a,0x08210000,0x9cd94a6e,0x633173d4,0x7bd1bdba,0x6aed2062,0x00005a4b,0x31273126,0x63314a4d,0x7c140002,0x849773f6,0xb599a59a,0x8cba7b90,0x08c86b52,0x8499b65c,0xaddd8d1a,0xaddbb61d,0x951a9d3a,0xb61da59b,0xbe5dbe5e,0xbe3ec67e,0x5965ce9d,0x21a83965,
-0x5aa920c2,0xef3e41e7,0x5aed0002,0xad771023,0x39c918c5,0x000218e5,0x004473f2,0x7c744aad,0x4b3242cf,0x9d7a7c99,0x84778498,0x42b15331,0x320e951b,0x6c175b74,0x84da7438,0x63d85377,0x747963f9,0x6c395377,0x74596c39,0x74797479,0x74797479,0x74797459,0x74797479,0x74597479,0x74597459,0x74597459,0x74397439,0x74397439,0x6c396c39,0x6c396c39,0x6c596c59,0x6c396c59,
-0x6c386c39,0x6c386c38,0x6c186c18,0x6c186c18,0x64186418,0x6c396c18,0x64186418,0x64186418,0x641863f8,0x64186418,0x641863f8,0x64186418,0x64186418,0x64186419,0x64196419,0x64186418,0x64186418,0x64186418,0x64196418,0x64186418,0x64186418,0x64186418,0x64186418,0x64186c38,0x64186418,0x6c386418,0x6c386c38,0x6c386418,0x6c386c38,0x6c186c18,0x64186c18,0x6c396c38,
-0x6c396c59,0x6c596c59,0x6c186c39,0x53756418,0x5bd76c39,0x6c596c39,0x63d76c39,0x53345354,0x5b963251,0x42d363d6,0x84575b34,0x39ab52d2,0x4a6f296a,0x4a4d5acf,0x422c2948,0x39eb39aa,0x39871085,0x18835a8b,0x398762cc,0x4a4c6b2e,0x31aa422c,0x4a4c2108,0x1083526b,0x4a6c1884,0x52af0865,0x73d352f0,0x31ec52f1,0x6352424f,0x31aa39eb,0x73927371,0x29498c54,0x422c52d0,
-0x5b5152d1,0x002394b7,0x0003630f,0x5ace5b30,0x5aac3167,0x41e80822,0x41880801,0x7bb11062,0x8c337bb0,0x0000a4d4,0x00001883,0x6b518412,0x83f352af,0x8c736b0f,0x28c420c3,0x3948734e,0x41a728a4,0x6b72522b,0x6b928c53,0x73d47c34,0xa519bdfd,0xae3e1043,0x0065c65c,0x8499a55b,0xaddc9d7c,0xadfdaddd,0x9d5b9d7c,0x951b9d5c,0xb63db61e,0x9d3aadfc,0x2021ef1f,0x108449e7,
-0x20c218a2,0x52691882,0x18e30861,0x29851041,0x10840823,0x00043189,0x7c138cb5,0x4acf8475,0x114b21cb,0x7c574af3,0x31f15b54,0x194c8cd9,0x74179d9c,0x42d263d6,0x6bf78cfb,0x63d77c7a,0x7c797419,0x6c187c5a,0x74797459,0x74797479,0x74797479,0x74597459,0x74597459,0x74597459,0x74597459,0x74397459,0x74397439,0x6c397439,0x6c386c39,0x6c396c39,0x6c396c38,0x6c386c39,
-0x6c386c39,0x6c386c38,0x6c386c38,0x64186418,0x64186c38,0x6c186c18,0x64186418,0x64186418,0x64186418,0x641863f8,0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x63f86418,0x63f863f8,0x63f863f8,0x641863f8,0x64186418,0x64186418,0x64186418,0x641863f8,0x64186418,0x64186418,0x64186418,0x64186418,0x6c186c38,0x64186418,0x64186c38,0x64186418,0x6c386418,
-0x6c596c59,0x6c596c59,0x63f87439,0x64185396,0x64186c39,0x6c597459,0x53766c39,0x5b753ab1,0x6c1763b6,0x6bf77438,0x4af26c17,0x18e77c15,0x5ad06331,0x4a6d7393,0x31aa3189,0x4aad41eb,0x49e918e5,0x31462926,0x524a4a09,0x00021084,0x420c0865,0x20e62969,0x18847390,0x000120e5,0x52ce6b70,0x7bd77bf5,0x298b0046,0x84776353,0x4a8f6bb3,0x7bd431cb,0x316a5aef,0x31abad9a,
-0x74168c79,0x2108424e,0x739020e7,0x5aef526d,0x9c94526c,0x20e45a8c,0x08000801,0x08016b2c,0x41a8b515,0x2905b556,0x732f1023,0x526c1883,0x84138454,0x21063167,0x6b2e3127,0x39694a2b,0x41c962ad,0x8c953947,0x52afce39,0xa53a5b10,0x84168c98,0x9d3b20c6,0x08a4c61b,0x6bf6a57b,0xadfdadfd,0xb5fda59c,0x9d7bb61e,0xadfd951a,0xb63da57b,0xc63cb63d,0x0866fefd,0x4a2c8d18,
-0x20c241c6,0x188220c2,0x41e741e7,0x736e0821,0x4a6a630d,0x19062988,0x9518424c,0x5b105bb3,0x84995353,0x84588cfa,0x52f47437,0x5bb26bd5,0x5b7542b3,0x3a905354,0x6bd73a93,0x745963d7,0x74797459,0x74597479,0x74796c18,0x74797479,0x74597459,0x74597459,0x74597439,0x74397459,0x74397459,0x6c397439,0x6c386c39,0x6c396c59,0x6c396c39,0x6c386c38,0x6c396c38,0x6c386c39,
-0x6c186c38,0x6c186418,0x64186418,0x64186418,0x6c186c18,0x64186418,0x64186418,0x63f86418,0x64186418,0x64186418,0x64186418,0x641863f8,0x64186418,0x63f86418,0x63f863f8,0x5bd86418,0x63f863f8,0x641863f8,0x64186418,0x63f86418,0x63f863f8,0x63f863f8,0x63f863f8,0x64186418,0x64186418,0x641863f8,0x64186418,0x64196418,0x6c196418,0x64196419,0x6c196419,0x6c386418,
-0x6c396c39,0x6c596c38,0x6c396c39,0x6c395bd7,0x6c396c39,0x6c596c39,0x5bb763f8,0x6bf85375,0x4b1463d8,0x74587459,0x52f37438,0x528e214a,0x6bb352d0,0x31c939ec,0x630f39aa,0x526c5acf,0x20a439ca,0x39a720c5,0x29891883,0x190731aa,0x4a2c7bd2,0x5aef2108,0x632e2968,0x00023167,0x296a7370,0x52f35af1,0x19095af1,0x52d10067,0x216b9d3a,0x7bf531ed,0x422c6b70,0x4ad08cb8,
-0x6375192b,0x08876373,0x39ca0845,0x00032108,0x31487371,0x526d9cb4,0x00012967,0xad140800,0x5a091841,0x10425aac,0x08221884,0x62ac28c4,0x8c5318e5,0x316762ee,0x292839aa,0x6b4f3189,0x7b501044,0x18c53948,0x39caad57,0x94d7ad59,0x9cd739ec,0xad9b0004,0x2968d67c,0xaddda5bc,0xb5fe84b9,0xadfdadfd,0xb63eadfd,0xadbcb5fe,0xb5fcb61c,0xbe5cc65e,0x00045106,0xcedbb63e,
-0x20a220c2,0x18811040,0x08201882,0x08201061,0x31672946,0x10c50002,0x29ec29cb,0x220f63b4,0x8cda7c78,0x84587c58,0x63b52a2f,0x6bd75b55,0x4af27436,0x5b957c98,0x749b196d,0x74797479,0x74797c9a,0x747a7479,0x6c387439,0x74797459,0x74597459,0x74597459,0x74597439,0x74396c39,0x6c396c39,0x6c386c39,0x6c386c39,0x6c396c38,0x6c396c38,0x6c396c38,0x6c396c38,0x6c386c39,
-0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x63f863f8,0x63f863f8,0x63f86418,0x641863f8,0x63f863f8,0x63f863d8,0x63d863f8,0x63f863d8,0x63f863d8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x641863f8,0x64186418,0x64186418,0x64186418,0x64186419,0x64186418,0x6c386419,
-0x6c386c38,0x6c386c38,0x6c186c39,0x6c596418,0x6c3963f7,0x6c596c59,0x6c396418,0x74186c38,0x6c185bb7,0x74586c38,0x743763d6,0x422d31ed,0x5af15af1,0x31884a6e,0x5acf528d,0x39aa39ca,0x28e639c9,0x39863987,0x424c20c4,0x002452b0,0x6b302107,0x31aa10a6,0x21072988,0x18a52106,0x39a91064,0x84351085,0x3a0c08a7,0x006852d0,0x533263b4,0x8cba218c,0x63726b93,0x3a300068,
-0x6bd54af2,0x73d34ad1,0x9cf67bd3,0x3a2c5b2e,0x63108c35,0x31899495,0x7bf24a8e,0x00019493,0x10220001,0x7b8f20c4,0x31056aec,0x20c55a6a,0x18c58c33,0x6b0e5aad,0x83f239a9,0x5b117371,0x84128c34,0x5acc62cc,0x18c62906,0x94b65ad1,0x83919cf7,0xad9b2129,0x1907debd,0xadbdbe7f,0xaddd9d3b,0xb5fdb5fd,0xadfdb5fd,0x9d7bb61d,0xbe3d953b,0xcebec65e,0x09075967,0xc5faadfd,
-0x20a22063,0x000028e3,0x08413145,0x294541e7,0x39c91063,0x19282988,0x4af129ed,0x74588cfa,0x8cfb743a,0x9d1a7c58,0x5b543a72,0x63956395,0x5b7463f4,0x5b955355,0x63d78499,0x747a5b97,0x63d87459,0x74797c79,0x74397459,0x6c397459,0x74597459,0x74397459,0x74597439,0x6c397459,0x6c396c39,0x6c396c39,0x6c386c39,0x6c386c38,0x6c386c38,0x6c396c39,0x64186c38,0x64186418,
-0x64186c38,0x64186418,0x64186418,0x641863f8,0x64186418,0x64186418,0x64186418,0x64186418,0x63f86418,0x63f863f8,0x6c3963f8,0x63f863f8,0x63f863d7,0x63f863f8,0x63f85bd8,0x63f863f8,0x63f863f8,0x641863f8,0x63f86418,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x641863f8,0x641863f8,0x63f86418,0x64186418,0x64196418,0x64186419,
-0x6c386c18,0x6c386c38,0x6c186c18,0x6c397439,0x6c186c18,0x6c396c39,0x5bd76c39,0x6c3963f8,0x63d86c18,0x6c386c38,0x639463d6,0x322f4b12,0x53535313,0x39eb52cf,0x39ec422c,0x422b4a2c,0x31465a8c,0x524a20c4,0x39ec20c4,0x39ec4a8e,0x08653a0c,0x31892928,0x420a39a9,0x3189630f,0x108518c5,0x18a70803,0x10a64a6d,0x3a0c0045,0x63956b93,0x4af342d3,0x52f06393,0x63d45b75,
-0xa5de3a90,0x52f06bf5,0x635031ca,0x73d5420b,0x5aef52b0,0x3a0a31c9,0x4a6e424e,0x39ea298a,0x10a3528b,0x08000821,0x520828e4,0x62ec9c92,0xacf53987,0x83f11042,0x6b303147,0x314b632f,0x526c9cb7,0xa4b5626a,0x4a0aad55,0xb57b4251,0x5a6ba4f7,0x8c963a4d,0x6b3083d0,0x94d8a5bc,0x7c35ad9b,0xa59ba5bd,0xae1e955a,0xa57bb61e,0x9d399d5b,0x39cdad79,0x2127eebd,0xbe5d9d5b,
-0x28e320c2,0x18821040,0x526a1062,0x29251042,0x422b3188,0x42af0025,0x9d7c7436,0x535442d2,0x5b557457,0x4b136bd6,0x6bf65b56,0x08ea7417,0x3a935334,0x6c175355,0x74597458,0x6c3963d8,0x6c196c18,0x74797459,0x6c397479,0x7459747a,0x74597459,0x74397459,0x6c397439,0x6c396c39,0x6c396c59,0x6c386c39,0x64186c39,0x6c396418,0x6c386c38,0x64186c39,0x64186c38,0x64186418,
-0x64186c38,0x63f86418,0x6c186c18,0x64186418,0x64186418,0x64186418,0x63f86418,0x63f863f8,0x63d863f8,0x63f863f8,0x63f85bd8,0x63f763f7,0x63f863f7,0x63f863f8,0x63f86419,0x63f863f8,0x63f863f8,0x641863d8,0x63f863f8,0x63f85bd7,0x63f863f8,0x63f85bd8,0x63f863f8,0x63f863f8,0x63f85bd8,0x641963f8,0x63f863d8,0x641863f8,0x63f86418,0x63f86418,0x63f863f8,0x64186419,
-0x6c386c38,0x6c396c39,0x6c186c18,0x6c186c18,0x6c396c18,0x6c186c18,0x6c387439,0x743963f8,0x6c187459,0x63d67c79,0x6bf65355,0x53344ad2,0x5b755b75,0x52f16bb5,0x6bd4426e,0x29693a0c,0x4a0939a9,0x39a83146,0x7bf43166,0x4a8f31cd,0x19076372,0x7bd20003,0x739018e6,0x41ea6b2f,0x420a18e6,0x6b0f4a2b,0x18e72108,0x004531cb,0x424f52af,0x849a8479,0x5b52428f,0x5b947417,
-0x3a5129ce,0x216b8499,0x21484a4e,0x8cb773b2,0x52f16bb4,0x63934ab0,0x5b11320d,0x5af16b93,0x52af6352,0x29264a2b,0x00000801,0x6b0d3126,0x18639453,0x1001526b,0x62cccdf9,0x73912907,0xad58a4f6,0x6aed5a4a,0x3966b556,0xb59818a4,0x7b6f20e6,0xad590865,0xdedb62ed,0x7c377455,0x8cb96b94,0x953a9d7c,0xaddda59c,0xaddcadfd,0xbdfcadfd,0x7c5673f4,0x18e65aad,0x9d59a5bd,
-0x29035a8c,0x20c341c6,0x000020c3,0x10630001,0x5b0f2147,0x00261109,0x6bf6322e,0x4b123250,0x53345bb3,0x6c3863b5,0x743752d3,0x63955b95,0x53557437,0x74796c39,0x6c387c79,0x7439745a,0x63d87459,0x74797459,0x747a7479,0x74596c39,0x74396c39,0x74396c39,0x6c397439,0x6c396c39,0x64186c39,0x6c386c39,0x64186c39,0x64186418,0x64186c38,0x64186c39,0x64186418,0x64186418,
-0x64186c38,0x6c186418,0x6c186c18,0x64186418,0x641863f7,0x64186418,0x63f86418,0x63f86418,0x63d863f8,0x63f863d8,0x5bd863f8,0x63f763f7,0x63f863f7,0x63f85bd8,0x63f85bb7,0x5bd85bd8,0x63f863d8,0x641863d8,0x63f863f8,0x63f863d8,0x5bd863d8,0x5bd863f8,0x63f85bd8,0x63f85bb7,0x63f863f8,0x641963f8,0x63f863d8,0x641863f8,0x63f863f8,0x63f863d8,0x6c1963f8,0x641863f8,
-0x6c386c39,0x64186418,0x6c186c59,0x6c186c18,0x6c186c18,0x74397439,0x6c396bf8,0x74396c18,0x74397459,0x74587459,0x42b263d7,0x4ad35334,0x63963211,0x5b535b54,0x531163b4,0x52ae73d4,0x5a8b39aa,0x41c841c8,0x52af5aac,0x6b74422f,0x39eb52cf,0x08442948,0x00025aee,0x39a92948,0x632d4a4c,0x4a4c4a4b,0x424d52cf,0x31cb0865,0x73b4318a,0x74188458,0x53117415,0x4ad26395,
-0x52f46bf7,0x31ee8499,0x3a0c5af1,0x000139ec,0x63955332,0x84986375,0x52f142b0,0x4a8f73b4,0x7c348455,0x5aad6b91,0x292620e5,0x08001883,0xb55720a4,0x3105b536,0x31041842,0x39c8524b,0x945518c5,0x292562ac,0x49c62084,0x41ca28e4,0x732f9cb8,0x94950002,0x4a2918a5,0x6b956394,0xbe3fa57c,0xaddc8478,0xaddd9d5b,0xb5fdaddd,0x6b92b61e,0x95197c77,0x212762ed,0xadbab61e,
-0x316541e8,0x73af4207,0x528b18a5,0x632f39ea,0x3a0a10c5,0x53337c96,0x955c5b95,0x741663d4,0x21ce84d8,0x7c796bf8,0x6bf86bf6,0x6bf66bf7,0x5b767458,0x6c3963d7,0x74597459,0x74797459,0x74397479,0x74597439,0x74597459,0x6c397459,0x6c596c59,0x6c396c39,0x74596c39,0x6c386c18,0x6c386c38,0x6c386c38,0x64186c18,0x6c386418,0x64186418,0x64186418,0x64186418,0x64186418,
-0x64186418,0x63f86418,0x63f763f7,0x641863f8,0x63f763f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x5bd763f8,0x63f863f8,0x63d863f8,0x5bd75bd8,0x63d863d8,0x5bd863f8,0x63f85bd8,0x63f85bd8,0x63d85bd8,0x63f863f8,0x63d85bd8,0x63f863d8,0x63f85bd8,0x63d863f8,0x63f863f8,0x5bb763f8,0x63f86419,0x63f86419,0x63f863f8,0x5bb763f8,0x63f85bb7,0x641863f8,
-0x64186c39,0x64186418,0x6c186c18,0x6c186c18,0x6c396c39,0x6c396c39,0x6c396c39,0x6c396c39,0x6c386c39,0x4b5563f7,0x63f742f4,0x53555355,0x6c166bf6,0x53535334,0x4ab073f5,0x63316352,0x4a2a41eb,0x29243166,0x298b3166,0x52d04a90,0x422b52cf,0x31a94a4c,0x39a95acd,0x4a2b1064,0x41c941ea,0x31680002,0x21086b71,0x52af0886,0x6b720886,0x8c990004,0x218b9519,0x5b963a30,
-0x84db7438,0x73f68cfb,0x194b320e,0x52f152d1,0x63946394,0x63b65354,0x6bb55333,0x42706b94,0x53117c16,0x5b106372,0x31a8526c,0x18a47bf1,0x08011063,0x7bafa4f4,0x10015229,0x9cb44a2a,0x62ed7bd1,0x94313988,0x28c41001,0x2947626b,0x94757bf5,0x94930801,0xc67e1086,0x4a8faddc,0x84789d1a,0x84778477,0x84b9a59b,0x7c9984b9,0xa53c7437,0xa59b9d3b,0x3146836f,0xdedd6b71,
-0x10002903,0x082120e3,0x62ed420c,0x5b0f10a5,0x0064632f,0x3ab10045,0x5b546394,0xa57c6bd6,0x63d74270,0x84996418,0x6bf86bf7,0x63d67c79,0x743a7437,0x74595b96,0x74796c18,0x74797479,0x747a7479,0x6c39747a,0x74397459,0x74597439,0x6c396c59,0x6c396c39,0x74396c39,0x6c396c18,0x6c386c38,0x6c186c39,0x64186c39,0x64186c38,0x64186c18,0x63f86418,0x64186418,0x64186418,
-0x63f86418,0x641863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863d8,0x63f863d8,0x63d863f8,0x5bd85bd8,0x5bd863f8,0x5bd85bd8,0x5bd85bd8,0x5bd85bd8,0x5bd75bd7,0x63f85bd8,0x5bd85bd7,0x63d85bd8,0x5bd85bd8,0x63f863d8,0x63d863d8,0x63f863d8,0x5bd863d8,0x63f863f8,0x5bd863f8,0x63f863f8,0x63d863f8,0x63f863f8,0x63f863d8,0x63f863f8,0x641863f8,
-0x64186418,0x64186418,0x6c186c18,0x6c186c19,0x6c186418,0x64186418,0x6c186c38,0x6c396c19,0x6c396c38,0x5bb66c39,0x6c385bd7,0x5bd75bb7,0x53764b14,0x5b955bb6,0x29cd4ad1,0x4a6e52d0,0x41a839ca,0x39863126,0x4a6f49e9,0x3a2e4a90,0x422c5b10,0x52ae41ea,0x10853188,0x41ea7bd2,0x18a53189,0x18a55a8c,0x294818e6,0x631131aa,0x63306b52,0x4a8e4a8c,0x7c368475,0x5b7563b5,
-0x4af363d6,0x639563d7,0x5b75320f,0x52f25b55,0x6bf76394,0x84b96c38,0x5b336c17,0x73d67c36,0x52d06373,0x84355b11,0x21482129,0x5aad424b,0x0000398a,0x00000800,0xa4f45aab,0x83d13125,0xa4f34a09,0x38e65a4a,0x526b20e5,0x29241882,0x6b319cb5,0x49e928e4,0x94d910c7,0x42306bd5,0xad9a6b94,0xd6ff9d39,0x9d7c8498,0xb5fda57b,0xbe1da57b,0xa5599d3a,0x3965834e,0x38e2736d,
-0x188028e2,0x18632903,0x39ea6b51,0x212739ea,0x00639cd5,0x006631ea,0x42d1326f,0x74386bb7,0x63f67c78,0x5b977479,0x63f74b34,0x63f76c18,0x74597459,0x74597459,0x74797459,0x74797479,0x74597459,0x74397459,0x74397439,0x6c397439,0x6c386c39,0x6c396c39,0x6c396c39,0x6c386c39,0x64186c38,0x6c196418,0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x63f863f8,
-0x63f86418,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863d8,0x63d863f8,0x63f863f8,0x63f863d8,0x5bd763d8,0x5bd85bd8,0x5bd85bd8,0x5bd85bd8,0x5bb75bd8,0x5bd75bd8,0x5bd85bd8,0x5bd75bd8,0x5bd863f8,0x5bd75bd8,0x5bd75bb7,0x5bd75bd8,0x5bd863f8,0x5bd85bd8,0x63d85bd8,0x5bd863d8,0x63d85bd8,0x63f863f8,0x63d863f8,0x63f863f8,0x63f863f8,0x641863f8,0x63f863f8,0x63f863f8,
-0x64186418,0x64186418,0x64186418,0x6c186c39,0x6c386418,0x6c386c38,0x6c386c38,0x6c386c38,0x6c596c38,0x53966c59,0x6c386418,0x6c187439,0x5bb75bb7,0x74596c38,0x53135355,0x320d5332,0x41e84a4c,0x41e8524a,0x5af2528b,0x426f6bb5,0x31aa4a4d,0x4a6c52ce,0x6b302107,0x20c50823,0x082262ed,0x00022906,0x18e8526c,0x528f6311,0x73d47bf5,0x84130045,0xa57b2127,0x7c5800a9,
-0x6bf67c58,0x5b953230,0x7c787438,0x4ab1110b,0x63b531ee,0x63b66c17,0x5b7563d6,0x7bf66395,0x63515af1,0x52f252f1,0x63516bb3,0x18c66350,0x5ace18c7,0x000039ea,0x20c40821,0x18625a8a,0x4a0a41c8,0x4a091042,0x6b4e4a2a,0x5a6a2904,0x7b6f1041,0x20c541a8,0x9d3a18c7,0xce9f216b,0x8478298c,0x847894f9,0x9d3b7436,0xa59ca59c,0xb5bb8cd9,0x526ededf,0x30e21000,0x18401840,
-0x20a128e2,0x290620e3,0x422a73b1,0x422a2968,0x08a518c5,0x322c6370,0x5b7484d8,0x7437951a,0x5b963231,0x6c395336,0x74596c18,0x63f77459,0x6c387459,0x74596c38,0x74597479,0x74597459,0x74597459,0x74397439,0x6c396c39,0x6c396c39,0x6c396c39,0x6c396c39,0x6c186c18,0x6c386c18,0x6c396c38,0x64186418,0x64186419,0x64186418,0x64186418,0x64186418,0x641863f8,0x63f86418,
-0x63f863f8,0x63f863f8,0x63f863f8,0x63f763f7,0x63f85bd7,0x63d863d8,0x5bd85bd8,0x5bd85bd8,0x5bd85bd8,0x5bd85bd8,0x5bd75bd7,0x5bd75bb7,0x5bd75bb7,0x5bd75bd7,0x63f863f8,0x5bd763d8,0x5bd763d8,0x5bd85bd8,0x5bd85bd8,0x5bd863d8,0x5bd863f8,0x5bd85bd7,0x5bd85bd8,0x5bd863d8,0x63f863f8,0x63f85bd8,0x63f863f8,0x63f863f8,0x5bd85bd8,0x63f863f8,0x63f863f8,0x63f85bd8,
-0x64186418,0x64186418,0x64186418,0x6c186c18,0x64186418,0x6c186c18,0x6c186418,0x6c386c39,0x6c396c38,0x63f86418,0x6c596c39,0x6c186c39,0x64186c38,0x63f75355,0x4b145bb6,0x6bf63ab1,0x49e8426e,0x31663146,0x5b1039a8,0x5b1173d5,0x2148296a,0x294852ad,0x1064420b,0x31676b2f,0x398720c4,0x5acc3187,0x31aa8c52,0x73b373d3,0x6bb33a2e,0x39eb4a6e,0x63312969,0x000752d1,
-0x7c587438,0x42914ad2,0x6bd62a0f,0x5b74951b,0x4291192c,0x6c175355,0x74386c17,0x63535313,0x5af052d0,0x741652d1,0x52f17415,0x424e5311,0x5aae2108,0x9453526c,0x104218c4,0x31850800,0x4a293165,0x08014a09,0x526a3167,0x39a76b0d,0x29227b8f,0x83f21884,0x7c157350,0xc67ec67e,0x5b1394f9,0x8c998476,0x9d5bbe3e,0x9d5aa59b,0x7372addc,0xef1f4a2d,0x28806a8a,0x290128e1,
-0x208020a0,0x00211081,0x316639c8,0x00010000,0x4a8d0002,0x53545351,0x3a917c99,0x3a9284fa,0x6c194b14,0x7cba7c78,0x74596c18,0x63d67459,0x5bb7747a,0x74596c38,0x74597459,0x74397439,0x74596c39,0x6c397439,0x6c396c39,0x6c186c39,0x6c396c39,0x6c186c18,0x6c186c39,0x64186c39,0x64186418,0x64186418,0x641863f8,0x64186418,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,
-0x63f863f8,0x63f863f8,0x63f863f8,0x63f863d8,0x63d863d8,0x63d863d8,0x5bd85bd8,0x63d85bd7,0x5bd85bd8,0x5bd75bd7,0x5bd85bd8,0x5bd85bd8,0x63d85bb7,0x5bd75bd8,0x5bd75bd7,0x5bb75bd7,0x5bd85bd7,0x5bb75bd7,0x5bd75bd8,0x63d863d8,0x5bd863d8,0x5bd85bd7,0x5bd85bd8,0x5bd85bd8,0x63d863d8,0x5bd75bd8,0x63d863d8,0x5bd85bd8,0x63f85bd8,0x5bd85bd8,0x63f85bd8,0x63d85bd8,
-0x641863f8,0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x6c186418,0x6c386bf8,0x6c386418,0x6c386c38,0x6c396c39,0x6c396c18,0x6c1863f8,0x5bb66c38,0x537563d7,0x53135b75,0x39a85b31,0x31663987,0x422e2947,0x6b72426e,0x422c4aae,0x4a2b420b,0x29482948,0x29464a4b,0x0821526b,0x29260801,0x31a90001,0x4a6d10a7,0x6b92420f,0x6b92320e,0x2128420c,0x6bf46bb4,
-0x7c578cdb,0x3a4f6bd5,0x74380088,0x7c587c58,0x531363b5,0x6bf73271,0x6c177cb9,0x6b9463d6,0x6bb34aaf,0x6c1642b0,0x6bd65b54,0x74166bb5,0x292931aa,0x62cd7bd3,0x41e91884,0x08000800,0x528a1862,0x528b9495,0x9cf520c5,0x28e53187,0x39643105,0xacf61821,0x7bd47391,0x19098c54,0x7c158c77,0x8c778436,0x320fbe5f,0x9d399d5a,0x18c8ce7e,0x4186de7d,0x28c12841,0x310228e1,
-0x104041e6,0x5acc0000,0x082239c8,0x104239c8,0x424b4a2a,0x745729ec,0x2a0e6bd5,0x5355092b,0x6c595356,0x74597c79,0x74586c38,0x5b967c79,0x63f86c18,0x74597459,0x74597479,0x74397439,0x74597459,0x6c397439,0x6c186c18,0x6c186c18,0x6c186c39,0x6c186c18,0x6c186c18,0x64186c18,0x64186c39,0x63f86418,0x63f863f8,0x641863f8,0x63f863d8,0x63f86418,0x63f863f8,0x63f863f7,
-0x63f863f7,0x5bd863f8,0x5bd85bd8,0x63d863d8,0x63d863d8,0x63f85bd8,0x5bd85bd8,0x5bd75bd7,0x5bd75bd7,0x5bb75bd8,0x5bd75bd7,0x5bd75bb7,0x5bb75bd8,0x5bb75bd7,0x5bb763d8,0x5bd75bd7,0x5bb75bb7,0x5bd75bd7,0x5bd75bd7,0x5bd85bd7,0x5bb763d8,0x5bd85bd7,0x5bd75bd8,0x5bd75bd7,0x5bd763d8,0x5bd85bd8,0x5bd85bd8,0x63f85bd8,0x5bd85bd8,0x5bd85bd8,0x5bd85bd8,0x5bd863f8,
-0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x6c186418,0x64186c18,0x64186418,0x6c386c38,0x6c596c39,0x6c396c39,0x6c386c39,0x5bb75b96,0x63d663d8,0x53745355,0x29683a4e,0x41e95acd,0x08864a2b,0x08860045,0x52ce8cb6,0x318931a9,0x29483168,0x39883188,0x41c82906,0x18a30801,0x6b900802,0x29695b10,0x63943a0d,0x00045312,0x424e318a,0x09061929,
-0x7c760047,0x00683a2f,0x7438216c,0x21ad7c58,0x4b137437,0x6bf66c17,0x7458849a,0x73f66bf7,0x4ad031ed,0x535463d5,0x7c786bd7,0x7c5873f7,0x63307bf3,0x41ca5acf,0x524b2927,0x39a60801,0x08000000,0x947218a4,0x000149e8,0xce19ad78,0x5a6a5a6d,0x290628e4,0x39ca8c33,0x5b104a6d,0xb5fb0886,0x73d49d19,0xce9f94d8,0x9456a59a,0x628e0004,0x18204165,0x28e12881,0x31223122,
-0x29851881,0x7bb00002,0x10831082,0x18a30000,0x00432125,0x2a0e216a,0x8d395332,0x63f75b96,0x74597459,0x7c7a7c79,0x74797459,0x6c187459,0x6c386c38,0x74397459,0x74397439,0x6c397459,0x74396c39,0x6c396c39,0x6c186c18,0x6c396c18,0x6c186c18,0x6bf86c18,0x6bf86c19,0x64186bf8,0x64186418,0x64186418,0x63f86418,0x63f863f8,0x63f863f7,0x63f863f8,0x63d863f8,0x64186418,
-0x63f863f7,0x63d863f7,0x5bd85bd8,0x63d85bd8,0x5bd85bd8,0x5bb75bd7,0x5b9763f8,0x5bd75bd7,0x5bd75bd7,0x5bd85bd8,0x5bb75bd8,0x5bd75bd8,0x5bb75bb7,0x5bd75bd8,0x5bd85bb7,0x5bd85bd8,0x63d85bd8,0x5bd863d8,0x5bd85bd8,0x5bb75bd7,0x5bd75bb7,0x5bb75bd7,0x5bd75bb7,0x63d85bb7,0x5bd75bd7,0x63f85bd7,0x63d85bd7,0x5bd85bd8,0x5bd85bd8,0x5bd85bd8,0x5bd85bd8,0x63f75bd8,
-0x641863f8,0x63f863f8,0x64186418,0x64186418,0x64186418,0x64186418,0x64186c38,0x641863f8,0x6c386418,0x6c386c38,0x6c386c39,0x64186c38,0x6c396bf8,0x6c186c18,0x4af44b14,0x64166bf8,0x6b9242d1,0x31cb2169,0x4a6e18e8,0x3a3029cb,0x08c74293,0x10a408c4,0x292762cd,0x290618a5,0x39873988,0x10232905,0x20e539a8,0x00245ace,0x3a5018e8,0x426d6bb7,0x29ab8c76,0x84ba6354,
-0x00064292,0x196c6373,0x4ad17c57,0x63957c36,0x090b7416,0x6c173ad2,0x7c9a63f7,0x63966c38,0x53334b13,0x5b5363b5,0x74386bf7,0x5b126396,0x318a6b52,0x52ae7bf3,0xa4f5524c,0x31672946,0x29246b2d,0x08001001,0x31661883,0x9cb3736e,0x49e9c5d7,0x39a70821,0x8c337bb0,0x422c5ace,0x6b73b59d,0x7c14424e,0x8c766b73,0xcdfa3a0e,0x3082ee5a,0x18201800,0x392330e2,0x29203121,
-0x528c1882,0x084362ef,0x10622925,0x08410841,0x3a0a18e4,0x3a8f216a,0x53736c16,0x63f77cba,0x84ba6c18,0x7c597c99,0x74797459,0x6c187459,0x6c387459,0x74397459,0x74397439,0x6c397459,0x74396c39,0x6c396c39,0x6c186c18,0x6c186c18,0x6c186c18,0x6bf86bf8,0x6bf86c19,0x64186bf8,0x64186418,0x641863f7,0x63f86418,0x63f863f8,0x63f863f7,0x63f863f8,0x641863f8,0x63f763d8,
-0x63f863f7,0x5bd863f7,0x5bd85bd8,0x63d85bd8,0x5bb75bd8,0x5bb75bd7,0x5bd85bb7,0x5bd75bd7,0x5bb75bd7,0x5bb75bd8,0x5bb75bd8,0x5bd75bd8,0x5bb75bb7,0x5bd75bd8,0x5b9763f8,0x5bd85bd8,0x5bb75bb7,0x5bd85bb7,0x5bb75bd8,0x5bb75bd7,0x5bd75bb7,0x5bb75bd7,0x5bd85bb7,0x63d85bd8,0x5bd75bd7,0x63f85bd7,0x5bb75bd7,0x5bd85bd8,0x5bd85bd8,0x5bd85bd8,0x5bd85bd8,0x63f75bd8,
-0x641863f8,0x63f863f8,0x64186418,0x64186418,0x64186418,0x63f863f8,0x64186418,0x641863f8,0x64186418,0x6c386c38,0x64186418,0x64186c38,0x6c186c18,0x63d76c39,0x53765376,0x4b545b96,0x426e196c,0x424e428f,0x29cc52d0,0x320f424e,0x73f67437,0x2148adbc,0x00021064,0x29472107,0x29462106,0xad173188,0x39c91083,0x000252ac,0xad9c6330,0x5b107c38,0x1929ad7a,0x5b754ab1,
-0x7c796bd7,0xadbb08a8,0x3a2e3a0d,0x6bd65b53,0x29ce63b5,0x4b1342d3,0x6c386c38,0x74186c38,0x6bf67417,0x7c376395,0x84ba6bd6,0x6353849a,0xad5a6b72,0x63306b71,0x20e64a0b,0x39892906,0x5aab39c8,0x20a328e4,0x20c31883,0x29050000,0xb5560800,0x6b2c0000,0x5acd0001,0x63503189,0x94b85290,0x94d8422d,0x7bd38c76,0xe6bd528e,0x08001000,0x20810800,0x28c128c2,0x314228e1,
-0x18e418a3,0x18a431a6,0x10823146,0x31469492,0x637010a3,0x3ab04acf,0x4b543ad2,0x6c185b96,0x7c997c9a,0x74597c79,0x74797c59,0x6c387479,0x6c387459,0x74397459,0x74396c39,0x6c396c39,0x6c397439,0x6c396c39,0x6c186c18,0x6c186c18,0x6bf86c18,0x6c186c18,0x6bf86bf8,0x64186bf8,0x63f86418,0x641863f8,0x63f86418,0x63f863f8,0x63f763f8,0x63f863f8,0x63f863d8,0x63f75bd8,
-0x5bd75bd7,0x5bd85bd7,0x5bd85bd8,0x5bb763f8,0x5bd75bd8,0x5bd75bd8,0x5bd75bd7,0x5bb75bb7,0x5bd75bd7,0x5bb75bb7,0x5bb75bd8,0x5bb75bb7,0x5bb75bd7,0x5bd75bb7,0x5bb75bd7,0x5bb75bb7,0x5bd85bb7,0x5bb75bd7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bd75bb7,0x5bb75b97,0x5bb75bb7,0x5bb75bd7,0x5bb75bd7,0x5bd75bb7,0x63d85bb7,0x5bb75bd7,0x5bd85bd8,0x5bb75bd8,0x63f863f8,
-0x63f763f8,0x63f863f8,0x63f863f8,0x64186418,0x64186418,0x64186418,0x63f86418,0x64186418,0x64186418,0x64186418,0x6c386c38,0x64186418,0x6c396c18,0x6c186c39,0x63f85bb7,0x53555b96,0x322f5b75,0x6bf65333,0x3a6f322f,0x4ad14a90,0x110b196e,0x4a8f8c98,0x31686370,0x18e63168,0x10a40864,0x108531a9,0x08430842,0x10a50001,0x420c528c,0x8c969cfa,0x422e0004,0x322f7417,
-0x84b96bd5,0x08846bf6,0x4a6ea539,0x4b123a2e,0x42b34ab2,0x6c37745a,0x53755b96,0x74186c18,0x74377c58,0x6bd65b54,0x74176395,0x7c377c38,0x8c55526e,0x5acf4a4c,0x29289c95,0x5a6d4a2b,0x4209526c,0x18c320e4,0x3146a4b3,0x10620821,0x08001042,0x00000800,0x94b32925,0x9d167390,0x9cf794b7,0x39cc39ac,0xce1b7b92,0x30e4b516,0x202028a2,0x20601800,0x30e130e2,0x20e328e3,
-0x29461063,0x6b905aee,0x000139c9,0x2926630d,0x320b0864,0x7456320c,0x6c3821ef,0x7c797c9a,0x7c7a7c7a,0x7c797c79,0x74797459,0x6c187459,0x74597459,0x74397439,0x74597459,0x6c386c38,0x6c396c38,0x6c186c19,0x6c186c18,0x6c186c18,0x64186418,0x64196418,0x64186418,0x64186418,0x641863f8,0x63f863f8,0x63f763f8,0x63f763f7,0x63f763f7,0x63f863f7,0x5bd863f8,0x63d85bd8,
-0x5bd85bd8,0x5bb75bd8,0x5bd85bd8,0x5bd85bb7,0x5bb75bb7,0x5bd75bd8,0x5bb75bd7,0x5bd75bb7,0x5bb75bd7,0x5bd85bb7,0x5bb75bb7,0x5bb75bd8,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5b975bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bd75bb7,0x5bd75bb7,0x5bd75bb7,0x5bd85bd7,0x5bd75bb7,0x5bd75bb7,0x5bd75bd7,0x5bd75bb7,0x5bb75bb7,
-0x63f863f8,0x64186418,0x63f863d7,0x63f863f8,0x63f863f8,0x63f863f8,0x641863f8,0x64186418,0x64186418,0x64186418,0x64186418,0x6c186c18,0x6c186c18,0x6c1863f8,0x63f763d7,0x3ad34314,0x535463b6,0x63736bf6,0x3a704b12,0x3a90320e,0x849863d5,0x5311320f,0x31a952ce,0x52ad1085,0x318a4a6c,0x52d0298a,0x39ea52cf,0x10c652ad,0x18c60024,0x6b502107,0x5b0f3188,0x741652b0,
-0x3a5063b5,0x73f542b1,0x4a6d0003,0x4ad152f0,0x8cfb5b54,0x6bf72a30,0x7c794b35,0x74597c9a,0x7c9a7459,0x6bd56375,0x5b745312,0x843673f5,0x63104a8e,0x524d6311,0x39ca39a9,0x7bd241eb,0x29272948,0x210539a9,0x83f018a3,0x528c6aed,0x00024a2d,0x08221043,0x20e40821,0x08010000,0x20a40801,0x734e522a,0x28825229,0x30e22060,0x30e128c1,0x208028e1,0x290128c0,0x6bd020a1,
-0x21282927,0x4a6d424d,0x0801b579,0x10631083,0x19480884,0x4b356416,0x74397458,0x7c797c9a,0x7c797c79,0x7c797c79,0x74597459,0x6c387459,0x74597459,0x6c197459,0x6c387459,0x6c386c38,0x6c186c38,0x6c186c39,0x6c186bf8,0x6bf86bf8,0x64186c18,0x64186418,0x64186418,0x63f86418,0x63f863f8,0x63f863f8,0x63f763f8,0x63f763f7,0x63f763d7,0x5bd763f8,0x5bd863d8,0x5bd85bd8,
-0x5bd85bd7,0x5bd75bd8,0x5bb75bd8,0x5bb75bb7,0x5bb75bb7,0x5bd85bd7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75b97,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bd75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5b975bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bd75bb7,0x5bb75bd7,0x5bd75bd7,0x5bb75bb7,0x5bd85bd7,0x5bd75bb7,0x5bb75bb7,0x5bd75bb7,0x5bd75bb7,
-0x63f763f8,0x63f763f7,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x64186418,0x641863f8,0x64186418,0x64186418,0x6bf86bf8,0x6c186bf8,0x6c186c18,0x4b5663f8,0x43143273,0x32b25b96,0x4af242f3,0x29ee5b53,0x5313196c,0x3a9042b2,0x3a4e5332,0x424d31eb,0x298a424d,0x41ec6330,0x4a8f298a,0x422c31ab,0x10a75b10,0x73d35b30,0x00242149,0x18c52106,0x218a10a5,
-0x425152d1,0x53125353,0x000373b4,0x6352420c,0x5b755333,0x743884fb,0x7c9a5bd7,0x74797c9a,0x74597479,0x6bf67c9a,0x53126374,0x52d04ab0,0x31ab6311,0x31ab3a0c,0x4a2c4a6d,0x62ee526d,0x630f6b50,0x4a4b39ca,0x080239a8,0x10a520e6,0x52cd6b94,0x422b0003,0x20e53a0a,0x08430822,0x00220001,0x10001822,0x18211000,0x41633101,0x31014163,0x28c028a0,0x312328e1,0x29a95a89,
-0x52ae420c,0x422d2128,0x39a752ae,0x00004a4a,0x092739e9,0x64584b75,0x7c997c99,0x74797479,0x74797459,0x74797479,0x74597479,0x74597459,0x74597459,0x74597459,0x6c396c39,0x6c396c39,0x6c186c18,0x6c186c18,0x64186c18,0x64186418,0x64186418,0x641863f8,0x63f863f8,0x63f763f8,0x63f763f8,0x63f863f8,0x63f85bd8,0x5bd863f8,0x63d863d8,0x5bd85bd8,0x5bd75bd8,0x5bd85bd7,
-0x5bd75bd7,0x5bb75bb7,0x5bd75bd8,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bd7,0x5bb75bb7,0x53b75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75b97,0x5bb75bb7,0x5bd75bb7,0x5bb75bb7,0x53975bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bd75b97,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bd85bb7,
-0x63f863f8,0x63d863f8,0x63d863f8,0x63f863f8,0x63f763f8,0x63f863f8,0x63f863f8,0x63f863f8,0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x64186418,0x6bf86c18,0x53556bf8,0x5b7563d7,0x3a925b96,0x5b7542b2,0x42d15b54,0x324f3230,0x42b05b94,0x426f29ac,0x5b1029ac,0x214a6331,0x52d04a8d,0x52cf426e,0x424e6352,0x6b920066,0x00440024,0x00234a6d,0x29880022,
-0x3a2e94f7,0x4ad15b54,0x6bb10046,0x73920003,0x320f52d0,0x4b1442f5,0x4b157478,0x7c997459,0x7c7a7c9a,0x74387c79,0x73d66bf7,0x4aaf6374,0x8cb73a0d,0x7c1452d0,0x52ef6310,0x3189526c,0x4a4c528d,0x633052ae,0x6b4f4a4c,0xad571085,0x7bd13167,0x73b320e6,0x7c136bb2,0x6b917bf3,0xa5564a4d,0x20c4bdb8,0x49c63165,0x28e14164,0x28c028c0,0x29013101,0x310228c1,0x7bf33143,
-0x0045420e,0x18c852cf,0x739141ec,0x18c60003,0x5bb62149,0x63f863d7,0x7c9a7c79,0x74597459,0x74797459,0x74597479,0x74597459,0x74597459,0x6c387458,0x6c386c38,0x6c396c39,0x6c186c39,0x6c396c18,0x6c186c18,0x64186c18,0x64186418,0x64186418,0x63f863f8,0x63f863f8,0x63f863f8,0x63f763f7,0x63f863f7,0x63f863f8,0x63f85bd7,0x5bd75bd8,0x5bd85bd8,0x5bd75bd8,0x5bd75bd7,
-0x5bb75bd7,0x5bb75bb7,0x5bd75bd7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bd75bb7,0x5bb75bb7,0x5bb75bd7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75b97,0x5bb75b97,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75b97,0x5bb75bb7,0x5bd75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,
-0x5bd863d8,0x5bd85bd8,0x63f863f8,0x63f863d8,0x63f763f7,0x63f85bd7,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f86418,0x64186418,0x63f86418,0x5bb76418,0x63f86418,0x6c1863d7,0x63d65b96,0x63b65b95,0x4af342d2,0x63b55b74,0x84983a50,0x31ed42b0,0x5311194a,0x63313a4e,0x7c1518e8,0x5b3118e9,0x39ed5b11,0x29cc52f1,0x424d08a7,0x0003298a,0x420c0004,0x84134a4c,
-0x00020044,0x639231ca,0x847552ef,0x0002424c,0x73f531ab,0x7c7842b3,0x5bb74af3,0x42b563d7,0x74797c9a,0x7c797c99,0x6b957c58,0x6b934a90,0x52f0214a,0x6b926b93,0x422c422c,0x316a528d,0x528e5acf,0x73714a6d,0x7bd26b51,0x000139a9,0x42294a6a,0x5b101887,0x5b1073b3,0x4a4e2109,0x21481088,0x526d0003,0x5aaa39c9,0x10006aa9,0x28c02080,0x28e330e0,0x31442946,0x110a0841,
-0x526d7392,0x41eb41eb,0x08263169,0x428e0066,0x4b770088,0x7c797459,0x6c5a63d9,0x74597459,0x74797479,0x74397459,0x74597439,0x74597459,0x74597459,0x6c186c39,0x6c186c19,0x6c186c18,0x6c186c18,0x6c186c18,0x64186c18,0x64186418,0x64186418,0x6bf86bf8,0x641863f8,0x63f75bd7,0x63f863f7,0x63f863d8,0x63f85bd7,0x63d85bb7,0x5bd85bd8,0x5bd85bd8,0x5bb75bd8,0x5bb75bb7,
-0x5bd85bd8,0x5bb75bb7,0x5bd75bb7,0x5bb75bb7,0x5bb75b97,0x5b975bb7,0x53975bb7,0x5bb75bb7,0x53b75397,0x53965bb7,0x5bb75bb7,0x5b975397,0x5bb75bb7,0x53975bb7,0x53975397,0x5b975397,0x53975b97,0x5bb75376,0x53975bb7,0x53b75397,0x53765bb7,0x5bb75b97,0x5bb75bb7,0x53965bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x53975bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,
-0x5bd85bd8,0x5bd763f8,0x63f763f7,0x63f863f8,0x63f863f8,0x63d863d8,0x63f863f8,0x63d863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863f8,0x64186418,0x64195bb7,0x5bb75bd7,0x5bd76c38,0x53345b96,0x21b063f6,0x42f32a50,0x320e21ae,0x74353a6f,0x424e42af,0x298b10c8,0x3a2d7c15,0x5b12216b,0x088894d9,0x5b7221ac,0x84567c54,0x08664a2e,0x424d318b,0x73b118c7,
-0x3a4e1908,0x112d63b5,0x00240025,0x00030004,0x00240023,0x84b9528f,0x53153a92,0x6c5863f7,0x7c993253,0x7c987c79,0x635473f7,0x6b7352d1,0x84354a8f,0x39cb5af1,0x52ae424d,0x0825422d,0x6b3041ec,0x424d6310,0x422c6330,0x29275aaf,0x4a295acd,0x6b7231ca,0x7c144a6f,0x5b344a8e,0x7c3752f3,0x10a831ac,0x62c9bddc,0x208020a1,0x290128c0,0x08453102,0x28e684da,0xe7df1086,
-0xa5384a4c,0x7371528e,0x00247bd2,0x4aae4a8d,0x4b36114c,0x7c797459,0x64184b15,0x74797459,0x74797479,0x747a7479,0x74597459,0x74597459,0x74596c38,0x6c396c39,0x6c396c39,0x6c186c18,0x6c186c18,0x6c186c39,0x64186c18,0x64186418,0x63f863f8,0x63d763f8,0x63f763f8,0x63f863f7,0x63f863f8,0x5bd763f8,0x5bd85bd7,0x5bd85bd8,0x5bd85bd8,0x5bd75bd8,0x5bb75bd7,0x5bb75bd7,
-0x5bb75bd8,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75b97,0x5bb75bd7,0x5bb75397,0x5bb75bb7,0x53975397,0x53975397,0x5bb75bb7,0x5bb75b97,0x53975b97,0x53975bb7,0x53975397,0x53975397,0x53975397,0x53975bb7,0x53975397,0x539653b7,0x5bb75397,0x5bb75397,0x53975396,0x5bb75397,0x53975397,0x53975bb7,0x5bb75397,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5b975bb7,0x5bb75bb7,
-0x5bd85bd8,0x5bd85bd8,0x5bd75bd7,0x63f863d8,0x63f863f8,0x63d863d8,0x63f863f8,0x63f863d8,0x63f863f8,0x63f86418,0x64186418,0x63f863f8,0x64186418,0x63f863f8,0x5b9763f8,0x63f86418,0x3ad35355,0x533442f4,0x4b342a10,0x5b537416,0x42b14af3,0x63b40067,0x00467415,0x6352426e,0x29cb52af,0x6bb54a8f,0x3a2f29ad,0x5311216c,0x000429ac,0x00251085,0x212918e8,0x00010866,
-0x428f0065,0x53555b75,0x5b757439,0x426e426f,0x000408a6,0x00030024,0x7c38be1f,0x63b75355,0x6c18849a,0x7c787c79,0x73f77c58,0x6b736353,0x6bb352af,0x9cd7426e,0x6b51422d,0x00046b92,0x52d06b92,0x5ad05af0,0x31ab62f0,0x6310528e,0x00010025,0x5b1031a9,0x52d15b11,0x0025ad7b,0xa53a94d8,0x318a7bd3,0x51e6524c,0x20801840,0x310128e1,0x08c83102,0xb5588d1b,0xae1f20e5,
-0x00044a4c,0x4a4c2128,0x086539ca,0x006431ea,0x42b34b12,0x6bf77438,0x6c596c3a,0x74596c38,0x74597479,0x74397459,0x74596c39,0x74597459,0x6c186c38,0x6c396c39,0x6c186c39,0x6c186c18,0x6c186c18,0x63f86bf8,0x64186c18,0x64186418,0x63f863f8,0x6bf863d7,0x63f763f8,0x5bd763f7,0x63f85bd7,0x63f863f8,0x5bd863f8,0x5bd85bd8,0x5bd85bd8,0x5bd75bb7,0x63f85bd7,0x5bb75b97,
-0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5b975bb7,0x5bb75b97,0x5bd85bb7,0x5bb75397,0x5bb75bb7,0x53975397,0x53975397,0x5bb75bb7,0x5bb75b97,0x53975b97,0x53975397,0x53975397,0x53975397,0x53975397,0x53975bb7,0x53975397,0x5bb75396,0x5bb75397,0x5bb75397,0x53975396,0x5bb75397,0x53975397,0x53975bb7,0x5bb75397,0x5bb75b97,0x5bb75bb7,0x5bb75bb7,0x5b975bb7,0x5bb75bb7,
-0x5bd85bd8,0x5bd85bd8,0x63f75bd7,0x5bd863d8,0x63f863f8,0x63d863d8,0x63f863f8,0x63f863d8,0x63f863f8,0x63f86418,0x63f763f7,0x63f863f8,0x64186418,0x63f863f8,0x539663f8,0x53765bd6,0x43145bb7,0x42b24b35,0x3ab03a93,0x118d3271,0x63b54291,0x63944af1,0x6bb408c9,0x3a0d298b,0x19080887,0x52d16352,0x5333196c,0x42906395,0x4aae31ee,0x420d4a8c,0x7bf5528f,0xa557212a,
-0x424e10c7,0x4af44af3,0x63d56c58,0x198b29ad,0x29ad4272,0x42adc65e,0x214b0843,0x63977418,0xa57e7436,0x63b59d7d,0x7c1773f7,0x63325af2,0x52f06331,0x422d31ec,0x4a6d73b3,0x00057bf3,0x6b735b31,0x7bf46b72,0x5ad073b3,0x63516bb1,0x20e473b4,0x4a8e0003,0x4a906b93,0x8c757bf6,0x528e1086,0xa5177391,0x30e25a8c,0x28e11860,0x28c01880,0x533328e1,0xbd9a5b96,0x196e2105,
-0x31cb6bb0,0x4a2b7391,0x19261064,0x741529aa,0x4b344ad2,0x6c185b76,0x74596c18,0x74596c38,0x74597459,0x74596c38,0x6c396c38,0x6c197439,0x74396c39,0x6c186c18,0x6c186bf8,0x6c396c18,0x6c186bf8,0x6bf86bf8,0x63f86bf8,0x63f863f8,0x63f863f8,0x63f863f8,0x63f863d8,0x63f863f8,0x5bd85bd8,0x5bd85bd7,0x5bd863d8,0x63f85bd8,0x5bb75bb7,0x5bb75bd7,0x5bb75b97,0x5b975bd7,
-0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75b97,0x5bb75bb7,0x53975397,0x53975397,0x53765bb7,0x539753b7,0x53b753b7,0x53b75397,0x53965396,0x53965376,0x53975397,0x53975397,0x53975397,0x53775397,0x53975397,0x5bb75397,0x53975bb7,0x53965397,0x5b975397,0x53975bb7,0x5bb75397,0x5bb75bb7,0x5bb75bb7,0x5bb75397,0x5bb75bb7,0x5bb75b97,
-0x5bd75bd8,0x5bd75bd7,0x5bb75bd8,0x5bd75bd7,0x63f763f7,0x63f863f8,0x63f85bd8,0x63f863f8,0x63f863f8,0x63f85bd7,0x63f763f8,0x63f86418,0x63f863f8,0x64186418,0x63f863d7,0x53564b55,0x63f763f8,0x3ab263d7,0x5b954af4,0x4b133252,0x5b542a0f,0x4af24af2,0x6bd55b53,0x218b08c9,0x42af7436,0x84970004,0x6395320e,0x53325312,0x18e76332,0x29473168,0x39ed5aef,0x3a0c424e,
-0x422d2129,0x63d75b74,0x6bf75355,0x52f10048,0x5b534b11,0x5b535313,0x00240044,0x73f30843,0x74386bb5,0x53356bb7,0x42b24af3,0x52f04ad1,0x6b726352,0x420d52d0,0x422d5b10,0x3a0e3a0c,0x63526b94,0x63526332,0x6b9373d4,0x31ac294c,0x10830867,0x39ea18c5,0x52b052f0,0x73d43a0d,0xc5fa6b51,0x520b0805,0x28c128a3,0x20a02080,0x31002901,0x7c981085,0x9c94a57b,0x002228e4,
-0x08656b70,0x41c939ca,0x29881064,0x2a6f196a,0x32725334,0x63d75b97,0x6c3863f7,0x74597459,0x74597459,0x74597459,0x6c396c38,0x6c396c39,0x6c186c39,0x6c186c39,0x6bf86c18,0x6c186c18,0x6bf86c18,0x6c186bf8,0x6bf86bf8,0x63d76bf8,0x63d863d8,0x63f863f8,0x63f85bd8,0x63f85bd8,0x63d85bd8,0x5bd85bd8,0x5bd85bd8,0x5bb75bd8,0x5bb75bb7,0x5bb75bd7,0x5bd85bb7,0x5bb75bb7,
-0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75b97,0x5bb75bb7,0x53975b97,0x53975bb7,0x5b975397,0x53765397,0x53965396,0x53975397,0x53b75396,0x53975397,0x5b975396,0x53975396,0x53975396,0x53975377,0x53775397,0x53975397,0x5bb75397,0x53975396,0x5b975397,0x53975396,0x53965b97,0x5b975396,0x53975397,0x53975397,0x53975397,0x53975397,0x5bb75397,
-0x5bb75bd8,0x5bd75bd7,0x5bd763d8,0x5bd75bd7,0x5bd75bd7,0x5bd85bd8,0x63f863d8,0x63f85bd8,0x5bd863f8,0x5bd85bd8,0x63f763f7,0x63f763f8,0x63f863f8,0x63f863f8,0x5bd763f8,0x53b763f8,0x63d75397,0x3a925bb6,0x53943272,0x3a914b14,0x5b543230,0x5b5342b2,0x4af25b94,0x6bd542d1,0x31ee29cd,0x19494ad3,0x216c7c57,0x424e52d1,0x3a0c426e,0x08442968,0x4a8e3a0c,0x4a9073b3,
-0x19087c35,0x3ab373f6,0x4b147458,0x42910069,0x5b742a0e,0x6bd64af3,0x6c1663b6,0x000231cc,0x63500003,0x8cd85b73,0x7417320e,0x422d6bb5,0x5b113a0d,0x528f7c15,0x9d18422d,0x000673d4,0x63746374,0x84567c36,0x5b3429ce,0x637273f5,0x318894d7,0x000218c5,0x7bf56b91,0x422f73b4,0x6b0e8436,0x7b4d28e5,0x20602061,0x310120a0,0x28e128c0,0x7c9a08c7,0x8c138cb8,0x190620a6,
-0x29494a6e,0x420b4a4c,0x00021064,0x5374218c,0x5b765334,0x74586c17,0x74596c18,0x74597479,0x6c387459,0x74597459,0x6c396c38,0x6c396c39,0x6c186c39,0x6c186c18,0x6bf86c18,0x6c186c18,0x6bf86bf8,0x63f86bf8,0x63f863f8,0x63f863f8,0x5bd85bd7,0x5bd863f8,0x63f863d8,0x63f763f8,0x5bd863f7,0x5bd75bd8,0x5bd85bd7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x53975bb7,0x5bb75bb7,
-0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75bb7,0x5bb75396,0x5b975397,0x5bb75bb7,0x53975396,0x53975397,0x53975b97,0x53975376,0x53975397,0x53975396,0x53965397,0x53975376,0x53975396,0x53965397,0x53965397,0x53965396,0x53965396,0x53965397,0x53975396,0x5b975397,0x53975397,0x53975397,0x53975397,0x5b975397,0x53975397,0x53975397,0x5bb75397,0x53965bb7,0x5b975397,
-0x5bd85bb7,0x5bd85bd8,0x5bd85bd7,0x5bd85bd7,0x5bd85bd8,0x5bd85bd8,0x63f75bd8,0x5bd85bd7,0x5bd863d8,0x5bb75396,0x63f75bd7,0x63f863f8,0x63f863f8,0x63f863f8,0x5bb863f8,0x53975377,0x433563f8,0x43355396,0x21d05396,0x5bb65bb6,0x53334af2,0x5b544af2,0x4ad24ad2,0x5b735313,0x42704ad0,0x63746374,0x6bb35b32,0x73d331cd,0x4a6f4a6e,0x4a6d18c8,0x7bf20003,0x31ed31cc,
-0x19495b32,0x63957c36,0x7c99090b,0x7438218d,0x4af36395,0x6c186bf6,0x5b767c79,0x53955b74,0x00277c78,0x00020024,0x00020865,0x6330b5bb,0x94b6634f,0x31690005,0x6352528e,0x5b325312,0x73f5216b,0x321052d2,0x6bd673f6,0x63326394,0x084439ec,0x4a4b2927,0x526d0003,0x8c963a2c,0x62ed6311,0x182041a7,0x30e11800,0x20802080,0x20c120a0,0x7c5731cb,0x73109cf9,0x2106520b,
-0x20e86351,0x3989420b,0x42b10845,0x3a524b32,0x5b765354,0x63f85376,0x74596c38,0x74596c38,0x74597459,0x6c387459,0x6c396c38,0x74396c18,0x6c186c39,0x6bf86c18,0x6c186bf8,0x6c186c18,0x6bf86bf8,0x63f86c18,0x63f863d7,0x63f863f8,0x5bd863d8,0x63d863f8,0x5bd85bd8,0x5bd75bd8,0x63d85bd7,0x5bd75bd8,0x5bb75bd8,0x5bb75bb7,0x5bb75bd8,0x5bb75bb7,0x5bb75bb7,0x53975397,
-0x5bb75bb7,0x5bb75bb7,0x53975397,0x5bb75bb7,0x5bb75397,0x53975397,0x53975397,0x5b975397,0x53965397,0x53765397,0x53965396,0x53975397,0x53965396,0x53965397,0x53965396,0x53965396,0x53965b97,0x53765396,0x53965376,0x53975b97,0x53965396,0x53975397,0x53965397,0x53975396,0x53965397,0x53965397,0x53965396,0x53975397,0x5b975b97,0x5b975397,0x53975397,0x5bb75397,
-0x5bd75bd7,0x5bd75bd7,0x5bd75bd7,0x5bd75bd7,0x63d85bd7,0x5bd85bd8,0x5bd763d8,0x5bd85bd7,0x5bd85bd8,0x63f85bb7,0x63f75bd7,0x63f85bd8,0x63f863f8,0x63d763f8,0x63f863f8,0x63f863f8,0x63f85bb7,0x43144b76,0x5bd75bd7,0x4b343a73,0x198e4b14,0x42914b14,0x3ab16bf6,0x320e21ef,0x216c0066,0x52f231ee,0x9d3a29ad,0x8c960006,0x31ab2129,0x52ae6351,0x00021086,0x3a2d73f4,
-0x637410c8,0x5b320044,0x94f973f6,0x5313196c,0x4ad23a70,0x63b67417,0x2a105354,0x7c786c17,0x53b66417,0x19cc7458,0x00650046,0x00020044,0x39c91084,0x7bf2a4f6,0x422f39eb,0x84368cb7,0x10c6c65e,0x53346374,0x4ad26374,0x7bf573d5,0x73b1528f,0x73b00823,0x104341ea,0x7bb1422b,0x52496b10,0x20603144,0x30e21000,0x186028e1,0x20801860,0x7bf43a2b,0x63507394,0x39ea3948,
-0x422c422d,0x20e52927,0x42b00043,0x53743231,0x43155355,0x63f76c39,0x74186c18,0x74597459,0x74597459,0x6c387459,0x6c396c38,0x6c186c18,0x6c186c18,0x6bf86c18,0x63f86c18,0x64186418,0x63f863f8,0x63f863f8,0x63f863f7,0x63f763f8,0x5bd863d8,0x5bd863d8,0x5bd85bd8,0x5bd85bd8,0x5bd85bd8,0x5bd75bb7,0x5bb75bd8,0x5bd75bd7,0x5bb75bb7,0x5bb75bb7,0x5b975bb7,0x5bb75b97,
-0x5b975bb7,0x53975b97,0x53975397,0x5bb75b97,0x53975397,0x53975397,0x53975397,0x53965396,0x53775376,0x53975397,0x53975397,0x53965396,0x53965396,0x53965396,0x53965396,0x539753b7,0x53765396,0x53965397,0x4b765396,0x53975397,0x53975396,0x53975397,0x53965397,0x53975396,0x53975b97,0x5bb75397,0x53975396,0x53975397,0x53975396,0x53975bb7,0x5b975bb7,0x53975bb7,
-0x5bb75bd7,0x5bd75bd7,0x5bd75bd7,0x5bd75bb7,0x5bd85bd7,0x5bd85bd8,0x5bd85bd8,0x5bd863d8,0x5bd85bb7,0x5bb75bb7,0x5bd75bd7,0x63d763d7,0x63f863f8,0x63f763f7,0x5bd863f7,0x63f763f8,0x63f863f7,0x63f85376,0x5bd73ad3,0x4b146c38,0x21ce4b13,0x3a7142b2,0x42d23230,0x42b15b54,0x320e7416,0x639421ac,0x63538c98,0x10a7422e,0x4a8d0023,0x39eb2969,0x4a4d3a0b,0x2969422d,
-0x9cf97393,0x000452d0,0x29cdad7a,0x08884ab1,0x7c5800a9,0x5b956bb7,0x7c7a63b6,0x74377c9a,0x63f86c18,0x53555b96,0x4b357c79,0x114a851b,0x00030003,0x08230042,0x39ca1885,0x10853189,0xb5994a4c,0x8c9818c6,0x6bb54291,0x73f56b94,0x6b307c16,0x524b3948,0x62ec0002,0x632e0821,0x30c483d0,0x18601860,0x30e12061,0x18601880,0x20601840,0x639218c6,0x8435296c,0x20c51085,
-0x6b713a0c,0x08643127,0x5332428f,0x42f242b3,0x4b356bf7,0x6c1863f8,0x74597459,0x74597459,0x74597459,0x6c387459,0x6c186c38,0x6c186c18,0x6c186c18,0x6c1863f8,0x6bf86c18,0x63f863f8,0x63f86418,0x63f76418,0x63f763f7,0x63f763f7,0x5bd863f8,0x5bb75bd8,0x5bd85bd8,0x5bd85bd8,0x5bb75bb7,0x5bd85b97,0x5b975bb7,0x5bd75bb7,0x5bb75b97,0x5bb75bb7,0x5b975b97,0x53975b97,
-0x53975396,0x53975b97,0x53975397,0x53975396,0x53975397,0x53975396,0x53975397,0x53765396,0x53775396,0x53775377,0x53975377,0x53965396,0x53765396,0x4b765397,0x53975bb7,0x53965376,0x53965376,0x53765396,0x539753b7,0x53965376,0x53975396,0x53975377,0x53965397,0x53965396,0x53965396,0x5bb75397,0x53975396,0x53765397,0x5b975376,0x53975397,0x5b975397,0x53975397,
-0x5bd75bb7,0x5bb75bb7,0x5bd75bd7,0x5bd75bd7,0x5bb75bd7,0x5bd85bb7,0x5bd75bb7,0x5bd863d8,0x5bb75bd7,0x53965bd7,0x63f75bd7,0x63d763d7,0x63f85bb7,0x63f763f7,0x5bd863d7,0x63f75bd7,0x63f863f8,0x5b975397,0x3ab25bb7,0x114d5b76,0x63b66c17,0x3a714af3,0x5b5400aa,0x3a714291,0x320d4b12,0x42b073f5,0x63740005,0x192994b8,0x00036b72,0x318a634f,0x08664a6d,0x4a6d298a,
-0x73b30865,0x424e214a,0x7c140001,0x63530888,0x63954ad1,0x5b757c59,0x63d76bf7,0x7c5829cf,0x63f763d6,0x5b7663f8,0x53755b96,0x63b763d8,0xa57d53d6,0x00020001,0x21250000,0x84536b2d,0x00023a0a,0x29681905,0x6332420c,0x18e96b53,0x83d28436,0x734f4a0a,0x29055aac,0x1062debb,0x18401041,0x10001841,0x20801000,0x10002080,0x18611000,0x5b5310c6,0x6b9273d4,0x18e752cf,
-0 };
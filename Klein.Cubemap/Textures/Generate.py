@@ -8,7 +8,6 @@ from platform import uname
 from PIL import Image
 from PIL import ImageFilter
 from PIL import ImageEnhance
-import fileinput
 
 def ShowImage(image):
     if uname()[0] == 'Linux': system('gnome-open ' + image)
@@ -45,20 +44,17 @@ for face in xrange(len(faces)):
 	faces[face].save(name)
 	ShowImage(name)
 	
-path = '/Users/prideout/Documents/PowerVR-ES2/Utilities/'
-textool = 'PVRTexTool/PVRTexToolCL/MacOS/PVRTexTool -h -yflip1 -fOGL565 -i'
+# Build with: g++ -O2 -o TextureCooker TextureCooker.cpp -lpng -lpthread
+#             g++ -O2 -o AssetPacker AssetPacker.cpp
+tools = '../../Common/Tools/'
+cooker = tools + 'TextureCooker -f 565 -m none '
 
-system(path + textool + "Metal.jpg")
+Image.open("Metal.jpg").save("Metal.png")
+system(cooker + "Metal.png Metal.pvr")
 
 for face in xrange(len(faces)):
-	system(path + textool + "Face%d.png" % face)
-	
-images = ["Face%d.h" % face for face in xrange(len(faces))]
-images.append('Metal.h')
-
-fromStr = "static const unsigned long" 
-toStr = "const unsigned int" 
+	system(cooker + "Face%d.png Face%d.pvr" % (face, face))
 
-for filename in images:
-	for line in fileinput.FileInput(filename, inplace=1):
-		print line.replace(fromStr, toStr),
+images = ["Face%d.pvr" % face for face in xrange(len(faces))]
+images.append('Metal.pvr')
+system(tools + 'AssetPacker Textures.pack ' + ' '.join(images))
@@ -1,2428 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT const unsigned int
-#endif
-
-A32BIT Metal[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x000001e0,		/* dwHeight */
-0x00000140,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00010013,		/* dwpfFlags */
-0x0004b000,		/* dwDataSize */
-0x00000010,		/* dwBitCount */
-0x0000f800,		/* dwRBitMask */
-0x000007e0,		/* dwGBitMask */
-0x0000001f,		/* dwBBitMask */
-0x00000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x6b0b6b2c,0x736c734c,0x62eb6b2b,0x7b6d62eb,0x734c734c,0x736d7b6d,0x734d6b2c,0x6aeb736d,0x6b2c6b2c,0x7bae736d,0x83ce8c0f,0x734c7b8d,0x6b0b734c,0x6b0b6b0b,0x6b2b6b0b,0x6b2c734c,0x6b4c6b2c,0x6b2c734c,0x62eb6b2c,0x6b2c6b2c,0x732c6b2c,0x6b0b6b0c,0x6aeb62cb,0x734c7b6d,0x62eb6b0c,0x6b2c630b,0x6b2c6b0b,0x62ca6b2c,0x630b62eb,0x6b2c6b2c,0x736d6b2c,0x6b4c736d,
-0x630b62eb,0x6b4c6b6c,0x630b630b,0x6b2c62eb,0x738d6b4c,0x62ca6b4c,0x62eb62ca,0x6b4c6b0b,0x6b6c6b2c,0x738d6b2c,0x6b4c7bae,0x6b4c736d,0x736d6b4c,0x6b2c6b4c,0x630b630b,0x5aaa630b,0x62ea630b,0x5aaa5aca,0x5aca5aaa,0x630b630b,0x840f738d,0x6b2c7bae,0x738d6b2c,0x7bae736d,0x6b2c736d,0x6b4c6b4c,0x62eb6b2c,0x5aea630b,0x5aaa5aea,0x62eb5aca,0x5aca5aea,0x5aaa5289,
-0x5aca630b,0x52aa52aa,0x52aa5aaa,0x5aaa52aa,0x52aa5289,0x52aa5289,0x630c630c,0x5aaa5aca,0x528952aa,0x528a5269,0x528952aa,0x52aa5289,0x5289528a,0x5acb62eb,0x5aaa5aaa,0x52895289,0x5aca5aaa,0x52695aaa,0x5aaa5269,0x52895aaa,0x5aaa5aaa,0x5aca5aaa,0x5aaa5acb,0x5aca5aaa,0x528a5acb,0x5acb5acb,0x5aaa528a,0x5aca62eb,0x5aaa5aca,0x52895289,0x52aa5289,0x6b4c630b,
-0x5aca6b2c,0x5aaa5a89,0x5aaa5aaa,0x5aaa5aca,0x5aa95289,0x52a95aaa,0x5aaa5289,0x5aca5aca,0x5a8a5aaa,0x62cb5aaa,0x62eb62eb,0x62eb62eb,0x5aaa62ca,0x62cb5a8a,0x5aca6b2c,0x62eb5aca,0x52495aaa,0x5aca5aca,0x5aca5aaa,0x630b630b,0x630b5aaa,0x630b6b2c,0x62cb62cb,0x62eb62eb,0x62ca5aaa,0x52895aaa,0x62cb5aaa,0x5aaa5aca,0x62eb630b,0x5aaa62ca,0x5aca5aaa,0x5aca62ca,
-0x62cb5aaa,0x5aaa62eb,0x5aaa5aaa,0x5aaa5aca,0x5aaa5aca,0x5aaa5aaa,0x52895269,0x5aaa62eb,0x5aca5aca,0x62eb5aaa,0x5aca630b,0x5aaa5289,0x5aca5aca,0x5aca5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5289,0x5aaa62eb,0x62eb5aaa,0x5aca5aca,0x52aa52aa,0x52aa52aa,0x52895289,0x52895289,0x526952aa,0x52694a68,0x4a485289,0x5aaa528a,0x5aaa528a,0x5aaa5aaa,0x5aca5aca,0x5aca5aca,
-0x7b8d7bae,0x6b2c736d,0x734c734c,0x6b0b734c,0x734c6b2c,0x6b2c734c,0x734d734c,0x7b8e736d,0x6b2c6b2c,0x7b8d736d,0x83ee83ee,0x736c83ae,0x6b0b6b2b,0x6b0b6b0b,0x6b0b62eb,0x6b0b6b0c,0x6b2c6b2c,0x62eb6b0b,0x62eb62eb,0x734d6b2c,0x732c6b0c,0x6b0c6b2c,0x62eb6b0b,0x736d6aeb,0x62eb62eb,0x6b0b630b,0x6b2c630b,0x62eb6b2c,0x62eb62eb,0x6b0b62eb,0x734c6b4c,0x734c734c,
-0x630b630b,0x6b4c6b4c,0x6b2c6b2c,0x630b630b,0x736d6b2c,0x630b6b4c,0x6b0b62eb,0x738d6b2c,0x630b6b4c,0x6b4c6b2c,0x7bae73ad,0x6b4c6b4c,0x6b2c736d,0x6b0b6b4c,0x6b2c6b2c,0x62eb5aaa,0x62eb5aaa,0x5aaa630b,0x62ca5289,0x630b630b,0x738d6b2c,0x7bce83ef,0x736c736d,0x738d738d,0x734c734c,0x630b6b4c,0x630b62eb,0x630b6b2c,0x5aca5aea,0x5aca5aea,0x5aaa5aaa,0x5aaa5289,
-0x5aea5aca,0x52895aca,0x5aca5289,0x5aaa5aca,0x5aca5aca,0x52aa52aa,0x5aeb5aeb,0x5aaa5aaa,0x52895289,0x52895289,0x52aa5289,0x52aa52aa,0x52895aaa,0x5aca5acb,0x5aaa5aaa,0x5aaa5289,0x5aaa5289,0x52695aaa,0x52894a49,0x5289528a,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x528a5aaa,0x528a5acb,0x5aaa528a,0x5acb5aaa,0x5aaa5aca,0x52a95aaa,0x52a94a89,0x52895289,0x5aea5aaa,
-0x5aaa62eb,0x5aca5a89,0x630b62eb,0x5aaa62eb,0x5aa95aca,0x5aca5aaa,0x528952aa,0x630b5aaa,0x62cb5aca,0x5aca5aca,0x62eb62ca,0x5aca62eb,0x62ca5aca,0x5aca62eb,0x6b2c5aca,0x5acb5aca,0x528962eb,0x5aca5aaa,0x5aca62eb,0x62eb5aca,0x62cb62cb,0x5aca62cb,0x5aca5aaa,0x5aaa62cb,0x5aca5aaa,0x52895aaa,0x5aca5aaa,0x5aca5aca,0x5aca62cb,0x5aca5aaa,0x5aaa5aaa,0x5aaa5aca,
-0x5aca5aca,0x5aca5aca,0x5aca5aca,0x528a5aaa,0x5aaa5aaa,0x5aaa5aaa,0x5acb5aaa,0x62eb6b2c,0x630b62eb,0x62eb630b,0x5aaa5aca,0x5aaa5289,0x52a95aaa,0x5aca5aaa,0x5acb5acb,0x528a5aca,0x5aaa5289,0x5aaa5aaa,0x52895aaa,0x5aaa52a9,0x52895289,0x52895289,0x52aa5289,0x528952aa,0x5aaa5289,0x4a6952aa,0x4a485269,0x52895aaa,0x5aca5acb,0x5aaa5aaa,0x5aca5aca,0x5aaa5aca,
-0x8c0f7b8d,0x736d83ce,0x734c62eb,0x734c7b8d,0x7b8d6b0b,0x6b0b736c,0x734c6b2c,0x83ce7b6d,0x6b2b736c,0x738d6b2c,0x7bad83ce,0x736c7b8d,0x6b0b6b2b,0x6b0b6b0b,0x630b6b0b,0x6b0c6b0b,0x6b2c736d,0x6b0c62eb,0x62eb6b0b,0x6b0b62eb,0x6b0b6b2c,0x6b2c6b0c,0x6b0c732c,0x6b2c62ca,0x62eb6b2c,0x736d6b2c,0x6b0b6b0b,0x6b2c6b4c,0x62eb630b,0x630b62eb,0x6b2c6b2c,0x736d6b4c,
-0x6b2c6b2c,0x6b2c6b2c,0x6b4c6b2c,0x630b630b,0x6b4c632b,0x6b4c6b6c,0x630b630b,0x736d6b2c,0x6b4c7bae,0x736d6b4c,0x6b2c630b,0x734c7bae,0x736d6b2c,0x6b2c6b2c,0x62ca630b,0x5aca630b,0x5aca5aaa,0x62eb62eb,0x5aca5aca,0x62eb62eb,0x630b5aca,0x7bae738d,0x736c7bad,0x734c736d,0x6b0b6b2c,0x6b2c6b0b,0x630b630b,0x6b2c630b,0x62eb62eb,0x5aca62eb,0x5aaa5aaa,0x5aaa5aaa,
-0x5aeb5aca,0x52895aeb,0x52aa5269,0x52aa5aaa,0x5aca52aa,0x52aa52aa,0x5aaa5aaa,0x5acb52aa,0x52aa5acb,0x52aa52aa,0x52aa528a,0x52aa52aa,0x52895289,0x5aaa5aca,0x5aaa5aaa,0x52895269,0x5aaa528a,0x52695289,0x528a5269,0x528a5aaa,0x5aaa528a,0x528a5aaa,0x5aaa528a,0x528a5aaa,0x5aaa528a,0x5aaa5aaa,0x5aaa5aaa,0x5aca5aaa,0x52895aaa,0x52aa5289,0x4a6952aa,0x5aaa5289,
-0x5aaa62eb,0x5aca5aaa,0x6b0b62eb,0x5aca630b,0x5aaa5289,0x5aaa5aca,0x52aa5289,0x632c5aeb,0x62eb5aca,0x62cb62eb,0x6b2c62eb,0x62ca630b,0x630b5aca,0x630b5aca,0x62eb62eb,0x5aaa630c,0x62eb62cb,0x630b62cb,0x62eb734d,0x5aaa5aaa,0x5aca5aca,0x5aca5aca,0x62eb5aca,0x528a5acb,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5a8a,0x5aca62cb,0x5aaa5aaa,0x5aca5a8a,0x5aaa5aca,0x5aaa5aca,
-0x5aca62eb,0x5aca5aaa,0x5aca5aca,0x5aca5aca,0x5aca5aaa,0x5aca5aca,0x5aca5aca,0x6b2c630c,0x6b4c6b2c,0x62eb6b2c,0x5aca62eb,0x630b62ca,0x5aca5aea,0x62eb5aea,0x5aca5aca,0x528a5aaa,0x5aca52a9,0x5aaa5289,0x52695289,0x52a95aaa,0x528a528a,0x52895289,0x62eb5aaa,0x62eb62eb,0x5aea5aaa,0x4a695aca,0x52694a49,0x52695aaa,0x5aca62eb,0x528a5289,0x5aaa5aca,0x5aea5aca,
-0x83ce734c,0x734c83ef,0x6b0b6b2c,0x7b8d7b8d,0x6b2c6b0b,0x6b2b734c,0x6b0b62eb,0x734c734c,0x6b2b736d,0x738d6b2c,0x7b8d83ce,0x734c736c,0x6b0b6b2b,0x6b2b6b0b,0x6b0b6b2b,0x734c6b0b,0x734c736d,0x734c6b0b,0x734c734c,0x6b0b6b0c,0x62eb6b0b,0x734d732c,0x734c732c,0x62eb6b0c,0x6b2c62eb,0x6b2c6b2c,0x630b6b2c,0x6b0b62eb,0x630b6b0b,0x62eb62eb,0x630b630b,0x6b2c6b2c,
-0x6b4c6b4c,0x630b6b2c,0x632c630b,0x632c6b2c,0x632c630b,0x736d6b4c,0x6b2c6b4c,0x630b632b,0x7bae632b,0x736d736d,0x630b734c,0x738d6b4c,0x6b0b6b2c,0x630b6b4c,0x5aca5a89,0x62ca62eb,0x5aaa62eb,0x630b5aaa,0x5aea630b,0x5aca5aca,0x630b62eb,0x6b2c630b,0x6b4c738d,0x630b630b,0x62eb6b0b,0x6b2c630b,0x62eb62eb,0x62eb5aca,0x62eb62eb,0x5aca62eb,0x5aca5aca,0x5aaa5aca,
-0x5aca5aeb,0x52aa5aca,0x52895289,0x52895289,0x52aa5289,0x52aa52aa,0x52aa52aa,0x62eb5aca,0x5aeb6b4d,0x62eb5acb,0x528a5aca,0x528a52aa,0x5aaa5289,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5289,0x528a5aaa,0x52695269,0x5aaa5289,0x52895aaa,0x5aaa528a,0x528a528a,0x528a528a,0x5aaa5aaa,0x5acb5acb,0x5aaa5aaa,0x62eb62eb,0x5aaa5aca,0x52a95aca,0x52ca5289,0x52895aaa,0x5aaa5289,
-0x5aaa5aaa,0x5aaa5aaa,0x62eb5aaa,0x630b630b,0x5aca52a9,0x5aaa5aea,0x52895289,0x5aca52aa,0x5aca5aaa,0x62eb62cb,0x6b2c6b2c,0x630b6b2c,0x5aaa630b,0x62eb62eb,0x62eb630b,0x5aca62eb,0x630b5289,0x6b2c630b,0x62eb6b4c,0x5aca5aca,0x5aaa5a8a,0x630b630b,0x5aca5acb,0x52895aca,0x5aaa5aaa,0x5aca5aca,0x5aca5aaa,0x5aaa5aca,0x5aaa5aaa,0x62eb5289,0x52895aca,0x5aaa5aca,
-0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x5acb5aaa,0x5aaa5aca,0x5aaa5aaa,0x630c62eb,0x62eb630b,0x5aca62cb,0x62eb62eb,0x62eb62eb,0x630b630b,0x5aea630b,0x5aaa5aaa,0x5acb5aca,0x5aca5aaa,0x52895aaa,0x5aaa5289,0x5aaa5aca,0x5289528a,0x52695269,0x5aca5289,0x5acb62eb,0x52aa5aca,0x4a485289,0x52895269,0x5289528a,0x52695269,0x528a5269,0x5aaa5aca,0x52a95aaa,
-0x736c736c,0x83ce7b8d,0x734c734c,0x7b8d6b0b,0x62eb734c,0x734c6b0b,0x6b0b734c,0x6b2b6b0b,0x6b2c6b2b,0x736c736c,0x7bae7bae,0x6b2c7b8d,0x6b0b6b0b,0x6b0b6b0b,0x6b0c6b2c,0x6b2c6b0c,0x7b8d7bae,0x6b4c6b4c,0x6b0b6b0b,0x62eb62eb,0x6b0b62cb,0x734d734c,0x6b2c6b2c,0x6b0b734c,0x6b0b62eb,0x6b2c6b4c,0x62eb62eb,0x5aca630b,0x6b2c630b,0x62ca6b0b,0x62eb5aca,0x62eb630b,
-0x6b4c6b2c,0x630b6b2c,0x630b630b,0x6b4c6b4c,0x632b632c,0x738d6b4c,0x6b6c738d,0x630b632c,0x736d6b2c,0x736d7bae,0x736d736d,0x6b4c62eb,0x630b6b2c,0x630b6b0b,0x5aaa5aca,0x62eb5aca,0x62eb630b,0x5aca5aca,0x630b62eb,0x5aca630b,0x630b62eb,0x62eb5aca,0x6b2c630b,0x6b2c6b0b,0x6b0c6b0b,0x62eb630b,0x62ca5aaa,0x52a952a9,0x5aea5aca,0x62eb5acb,0x5aca62eb,0x5aaa5aca,
-0x5aaa5acb,0x5aaa528a,0x5aaa5aca,0x5aaa528a,0x5aaa5289,0x5acb5acb,0x5aaa5aaa,0x62eb5aaa,0x5aeb6b4d,0x62eb5acb,0x52aa5acb,0x52aa52aa,0x5aca5aaa,0x528a5aca,0x5aca5aaa,0x5acb5aaa,0x5aaa5aaa,0x52695289,0x52895269,0x528a528a,0x5aaa528a,0x528a528a,0x528a528a,0x5aaa5aaa,0x5aca5aca,0x5aaa5aaa,0x62eb62eb,0x5aca5aca,0x52aa5aca,0x52aa5289,0x52895aaa,0x5aca5aaa,
-0x5aca5289,0x5a8a5aca,0x5a895289,0x5aca5aca,0x5aaa5aaa,0x5aaa5aaa,0x52695aaa,0x52894a69,0x5aca5aaa,0x62eb62cb,0x6b2c630b,0x62eb6b0b,0x5aca630b,0x5aaa62eb,0x62eb5aaa,0x528a62eb,0x5aca5289,0x62eb5aca,0x5aca5acb,0x62eb62eb,0x5aca5289,0x630b630b,0x5aaa5aaa,0x5aaa5aaa,0x52a95aaa,0x5aca5aaa,0x5aca5aaa,0x52895aca,0x5aca5aaa,0x62eb5289,0x52a95aca,0x5aaa5aca,
-0x62cb5a8a,0x62eb630b,0x5aaa5aca,0x52895aaa,0x5aca5aaa,0x5aaa5aaa,0x5acb5aca,0x5acb5aaa,0x5aaa62eb,0x5aca5aaa,0x62eb62eb,0x5aaa5aca,0x5aca5aaa,0x5aca5aca,0x5aaa5aaa,0x62eb62eb,0x5aaa5aaa,0x5aaa5aca,0x5aea5aaa,0x5aaa5aca,0x5aaa5aaa,0x52695289,0x52895269,0x528a5aaa,0x4a695289,0x4a694a48,0x52895269,0x528a5289,0x5acb5aaa,0x5aaa5aaa,0x5aca5aca,0x5aaa5aca,
-0x734c83ce,0x7bad7b8d,0x736d83ee,0x6b0b6b0b,0x6b0b734c,0x6b2c6aeb,0x734c736d,0x6b0b6b0b,0x6b0b630b,0x734c734c,0x738d7b8d,0x6b2b736c,0x6b0b62eb,0x6b0b6b2b,0x6b2c6b0c,0x62eb6b2c,0x6b2c630b,0x6b0b6b0b,0x62eb62eb,0x6b0c6b0b,0x6b2c62eb,0x6b0b62eb,0x6aeb6b2c,0x6b2c6b0c,0x62ca6b0b,0x6b4c6b0b,0x630b630b,0x62eb6b0b,0x6b2c62eb,0x62eb6b2c,0x62eb5aca,0x62eb62eb,
-0x632b5aea,0x6b4c6b2c,0x632b6b2c,0x6b4c6b4c,0x6b4c6b4c,0x6b6d6b4c,0x6b6d738d,0x632c6b2c,0x6b4c738d,0x7bce7bae,0x736d736d,0x62ca6b4c,0x736d630b,0x62eb62eb,0x62ca6b2c,0x62ca5aca,0x630b630b,0x5aca62eb,0x630b5aca,0x630b6b2c,0x5aca5aea,0x62eb5aca,0x6b4c5aca,0x734c736c,0x6b0b6b2c,0x62ca62eb,0x62eb62ca,0x5aca5aaa,0x5aca5aea,0x630b5aca,0x62eb630b,0x5aca5acb,
-0x5aaa5aca,0x5aaa5289,0x5aca5aaa,0x5aaa5aaa,0x528a528a,0x5aca5aaa,0x5aaa5aaa,0x5aca5aaa,0x5aca5aeb,0x5aaa5aaa,0x5aaa52aa,0x52895aaa,0x5aaa5aaa,0x5aaa5aca,0x5aca5aca,0x5aaa5aaa,0x52895aaa,0x52895289,0x528a5289,0x5aaa5aaa,0x5aca5aaa,0x528a5aca,0x5aaa528a,0x5aaa5aaa,0x5aca528a,0x5aaa5aca,0x62ca62ca,0x62eb5aca,0x52aa5aaa,0x52aa5289,0x528952aa,0x528a5289,
-0x5aca5289,0x5aaa62cb,0x52895a89,0x52695289,0x52895289,0x528a5289,0x52895aaa,0x52895289,0x62cb5aaa,0x5aca62eb,0x6b0b62eb,0x630b6b2c,0x630b630b,0x5aaa5289,0x5aaa5269,0x528962eb,0x5aaa5aca,0x62eb5aaa,0x5aca5aca,0x5acb62eb,0x62eb5aca,0x5aca62eb,0x5aaa5aaa,0x630b62eb,0x5aaa5aaa,0x5aaa5aaa,0x5aca5aca,0x5aaa5aca,0x5aca5aca,0x630b5aaa,0x5aca5aea,0x5aaa5aaa,
-0x62eb5aaa,0x62eb6b0c,0x5aca5aca,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aca62eb,0x5aaa528a,0x5aaa62eb,0x62eb5aca,0x62eb62eb,0x5aaa5aca,0x52895289,0x5aea5aca,0x5aca5aca,0x5aaa5aca,0x52895aaa,0x5aca5aca,0x5aea5aea,0x5aaa52a9,0x5aaa5aaa,0x5aaa5aaa,0x5289528a,0x52895289,0x52894a69,0x52aa52aa,0x52895269,0x52695269,0x5acb5aaa,0x52695aaa,0x52895269,0x5aaa5aaa,
-0x7b8d83ce,0x736c6b4c,0x8c0f83ce,0x62eb738d,0x6b2c6b2b,0x6b2c6b4c,0x6b2b6b2b,0x62eb6b0b,0x62eb6b0b,0x6b4c6b0b,0x6b2b736c,0x6b2c6b2b,0x6b0b6b2b,0x6b2c6b2c,0x6b2c6b2c,0x630b6b2c,0x6b2c630b,0x6b2c6b2c,0x630b6b2c,0x6b0b6b0b,0x6b0b6b0b,0x62ca62ca,0x6b0b6b0c,0x6b0c62eb,0x630b62eb,0x62eb5aca,0x630b736d,0x6b2c5aaa,0x630b6b0b,0x630b630b,0x62eb630b,0x62ca62eb,
-0x630b5aca,0x6b4c6b0b,0x6b2c6b4c,0x632c6b2c,0x6b6c6b4c,0x6b4c6b4c,0x6b2c6b4c,0x6b4c632c,0x736d632b,0x7bce736d,0x7bae83ef,0x6b2c736d,0x6b2c6b2c,0x62eb6b4c,0x6b2c630b,0x62ca5aaa,0x62eb62eb,0x62eb630b,0x5aca5aca,0x6b4c630b,0x5acb6b2c,0x630b62eb,0x6b2c62eb,0x6b2b734c,0x62ca6b2c,0x62eb62eb,0x630b6b2c,0x62eb5aaa,0x5acb5acb,0x62eb5aca,0x62eb630b,0x62eb62eb,
-0x5aca62eb,0x52895aaa,0x5aaa5aaa,0x5aaa5aaa,0x528a5aaa,0x5aaa528a,0x5aaa5aaa,0x5aaa5aaa,0x5aaa52aa,0x52aa5aaa,0x52aa528a,0x526952aa,0x52895269,0x5aca5aaa,0x5aca5aaa,0x52895aaa,0x52895aaa,0x52895269,0x5aaa5aaa,0x5aaa5aaa,0x5aca5aaa,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aca,0x5aaa5a89,0x62eb62ca,0x62ca62ca,0x5aaa5aca,0x52aa5289,0x528952aa,0x5289528a,
-0x5aaa5269,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5289,0x52695aaa,0x528a5269,0x5289528a,0x5aca5aaa,0x5aca62eb,0x630b62cb,0x6b2c6b2c,0x5aaa6b2c,0x5aaa5aaa,0x5aaa5269,0x5acb528a,0x5acb62eb,0x630b5acb,0x62eb5acb,0x5aca5acb,0x62eb62eb,0x5aaa5acb,0x5acb5aca,0x632c5aeb,0x5aca5aca,0x5aaa5aaa,0x5acb5acb,0x5aaa5aca,0x5aca5acb,0x62eb5aaa,0x5aca5aaa,0x5aaa5aaa,
-0x5aca5aaa,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aaa528a,0x5aca5acb,0x5aca5aca,0x5aca5aaa,0x5aaa5aca,0x62cb5aca,0x62eb5aca,0x5aca62eb,0x5aaa5aca,0x5aea5aca,0x5aaa5aca,0x5269528a,0x5aaa5aaa,0x5aca5aaa,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x52895aaa,0x52895289,0x52aa5289,0x52aa5aca,0x52895269,0x52694a49,0x5aaa5269,0x5aaa5aaa,0x528a5aaa,0x528a5aaa,
-0x7bad6b2b,0x6b2b7bad,0x83ee736c,0x7b8d8c2f,0x6b2b6b2c,0x7bae7bad,0x62eb62eb,0x6b4c736c,0x630b6b0b,0x6b2b6b2b,0x6b2b6b4c,0x6b4c6b4c,0x630b6b4c,0x6b4c630b,0x630b6b2c,0x6b2c6b2c,0x62eb630b,0x6b2c62eb,0x6b0b734c,0x6b0b6b0c,0x62ca6b0c,0x62eb62eb,0x6b0b62eb,0x6b0b6b0b,0x62eb630b,0x62eb62eb,0x6b2c62eb,0x5aca6b0b,0x62eb6b2c,0x6b2c5aca,0x62eb6b2c,0x5aca5aca,
-0x62eb62eb,0x6b2c62eb,0x632b6b4c,0x630b6b2c,0x6b6d632b,0x6b4c736d,0x630b6b2c,0x736d632b,0x6b2c734c,0x734c734c,0x7bce7b8d,0x736d6b4c,0x630b6b4c,0x736d6b2c,0x5aca630b,0x62eb6b0b,0x5aca5aca,0x630b630b,0x5aca5acb,0x6b2c62eb,0x630c6b2c,0x62eb630b,0x6b0b6b2c,0x734c6b4c,0x62eb6b2c,0x5aaa62eb,0x6b2c630b,0x5aca5aca,0x5aca5aca,0x5aca5aaa,0x5aca5aca,0x62eb62eb,
-0x62eb630b,0x5aaa5aaa,0x5aaa5aaa,0x62eb5acb,0x5aca62eb,0x5aaa5aaa,0x5aaa5aaa,0x5acb5aab,0x5aaa52aa,0x5aaa5aaa,0x528a52aa,0x52aa528a,0x5aaa5aaa,0x5aaa5aaa,0x5aaa528a,0x5aaa5aca,0x528a5289,0x5aaa5aaa,0x52695289,0x5acb528a,0x528a5aaa,0x5aaa528a,0x528a5aaa,0x5aaa528a,0x62cb62cb,0x5aca62ca,0x5aaa5aaa,0x630b62eb,0x5aca5aea,0x52aa52aa,0x52aa52aa,0x528a5aaa,
-0x62cb5289,0x5aaa62eb,0x5aaa5aaa,0x5aca5aaa,0x52895289,0x52895269,0x52895289,0x62eb5aaa,0x5aaa5aaa,0x62eb5aca,0x62eb62eb,0x6b4c630b,0x5aaa62eb,0x5aaa5aaa,0x52895aca,0x5aca5acb,0x5acb5aaa,0x5acb5acb,0x630c5aca,0x62eb5acb,0x62eb5acb,0x5aaa5aca,0x5aaa5aca,0x52aa5269,0x5aca5aaa,0x5aca5aca,0x5acb62eb,0x5aaa5aaa,0x5aaa62eb,0x5aaa5289,0x5aca5289,0x5aaa52a9,
-0x5aaa5aca,0x5aca5aaa,0x5aca5aca,0x5aaa5aaa,0x5aaa5aca,0x5aca5aca,0x62eb5acb,0x62eb5acb,0x5aca62cb,0x5aca5aca,0x630b5aca,0x62eb6b2c,0x5aca5aca,0x5aca5aca,0x52895289,0x528a528a,0x5aca5aaa,0x5aaa5aaa,0x5289528a,0x5aaa5aca,0x5aca62eb,0x5aaa5aaa,0x52895aaa,0x528a5289,0x4a695269,0x52694a69,0x52694a49,0x52694a48,0x528a5269,0x52695269,0x52895289,0x5acb5aaa,
-0x6b0b734c,0x7bad736d,0x734c7b8d,0x8c0f734c,0x6b2b7bae,0x7b8d6b2c,0x6b0b83ce,0x736d6b2c,0x6b4c6b2c,0x6b4c734c,0x738d734c,0x630b6b4c,0x6b0b6b4c,0x6b2c6b0b,0x6b0b6b2c,0x630b630b,0x630b630b,0x62eb62eb,0x6b4c630b,0x630b6b2c,0x62ca5aaa,0x5aca62eb,0x5aca5aca,0x630b62ca,0x62eb62eb,0x62eb62eb,0x6b2c6b2c,0x62eb6b4c,0x630b62eb,0x62eb62eb,0x630b630b,0x5aca62eb,
-0x62eb5aaa,0x62eb6b0b,0x630b62cb,0x630b6b0c,0x6b2c630b,0x6b4c6b2c,0x62eb6b4c,0x736d630b,0x736d736d,0x6b4c6b2c,0x6b2c6b2c,0x738d7bce,0x6b2c6b2c,0x6b4c630b,0x62eb734c,0x5aaa62ca,0x5aca5aca,0x630b5aca,0x5aaa630b,0x5acb5aaa,0x6b2c630c,0x6b2c6b2c,0x6b0b6b2c,0x6b0b62eb,0x734c6b4c,0x62eb62ca,0x5aaa5aaa,0x630b62eb,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x630c5acb,
-0x62eb630b,0x52695289,0x5aaa5289,0x62eb62eb,0x5aaa6b2c,0x5aca5aaa,0x528a5269,0x5aaa5acb,0x5aaa5acb,0x52aa52aa,0x52aa528a,0x4a6952aa,0x52895289,0x52895269,0x62eb5aaa,0x5aaa5acb,0x5aaa5aaa,0x52895aaa,0x5aaa5289,0x5aaa5aaa,0x528a62eb,0x5aaa5269,0x528a5aaa,0x528a5289,0x62ca5aca,0x5aaa5aaa,0x62eb5aaa,0x630b62eb,0x630b62eb,0x52aa5aeb,0x5aaa5aaa,0x528a5289,
-0x5aaa5aaa,0x52895289,0x52895289,0x5aaa5aaa,0x5aaa5289,0x5289528a,0x528a528a,0x630b5aaa,0x5aaa5aca,0x5aca5aca,0x5aaa5aca,0x5aca5aca,0x5269630b,0x5aca5289,0x528a5aaa,0x5aaa5aaa,0x5aaa5aaa,0x5acb5acb,0x6b2c6b2c,0x5acb5aca,0x62eb5aca,0x5aca5aeb,0x5acb5acb,0x528952aa,0x52a95289,0x5aca5aaa,0x5aca5aca,0x62eb5aaa,0x5aaa5aca,0x5acb5aaa,0x5aaa5aca,0x528a5aaa,
-0x62eb5aaa,0x52895aaa,0x62eb5acb,0x5aaa5aaa,0x5aaa5289,0x5aaa5aaa,0x62eb5aaa,0x5aca630c,0x5aaa62eb,0x5aaa5aaa,0x630b630b,0x6b4c6b2c,0x62eb630b,0x5aaa5aca,0x528a5aaa,0x528a528a,0x62eb528a,0x528a62eb,0x5aaa5289,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aca,0x5aca5aaa,0x5aaa62cb,0x52695269,0x52895289,0x52695269,0x5aaa5289,0x528a5269,0x52695269,0x5aaa5269,0x62eb62eb,
-0x734c7b8d,0x736d62eb,0x734c83ee,0x7b8d6b2c,0x7bad9471,0x738d736c,0x83ef736d,0x630b62eb,0x736d7bce,0x736d736d,0x738d738d,0x6b4c7bad,0x6b4c6b4c,0x734c6b4c,0x6b2c6b4c,0x6b2c6b2c,0x6b2c62eb,0x6b2c6b4c,0x6b2c630b,0x6b2c6b2c,0x62eb62ca,0x62eb62eb,0x5aca62eb,0x62eb5aca,0x5aca62eb,0x736d630b,0x630b736d,0x6b2c6b0b,0x62eb62eb,0x62eb630b,0x62eb5aca,0x62ca6b0b,
-0x62ca62cb,0x62eb62cb,0x62ca62ca,0x6b2c62eb,0x62eb62eb,0x734c62eb,0x630b736d,0x630b630b,0x736d7bce,0x6b2c736d,0x738d6b2c,0x7bce6b2c,0x736d736d,0x62eb6b4c,0x738d6b4c,0x62ca62eb,0x5aaa62eb,0x62eb62eb,0x630b62eb,0x630b5aca,0x630b62eb,0x6b2c6b2c,0x6b0b6b2c,0x6b0b62eb,0x6b2c6b2b,0x630b6b2c,0x5aca5aca,0x62eb5acb,0x62eb5aca,0x5aaa62eb,0x52895269,0x62eb5aaa,
-0x5aca5aca,0x5aaa5aaa,0x528a5aaa,0x630b5acb,0x62eb6b4c,0x5aaa5aaa,0x528a5aaa,0x5aaa528a,0x5aca5aeb,0x52aa5aca,0x52aa528a,0x528952aa,0x52895289,0x5aaa5289,0x5acb5aca,0x5aca5aca,0x5acb5aaa,0x5aca62eb,0x52895aaa,0x52895289,0x5aaa5aaa,0x5aaa5aaa,0x5acb5aca,0x52895aaa,0x5aca5aaa,0x62ca62ca,0x62ca5a8a,0x5aca62ca,0x5aca5aaa,0x52695289,0x5aaa528a,0x528a528a,
-0x5aaa5aaa,0x5aca528a,0x5aaa5aca,0x5acb5aca,0x5aaa5aca,0x5aca5aca,0x5aaa5aaa,0x5acb5acb,0x62cb5aca,0x5aaa5aca,0x5aca5aaa,0x5aca62eb,0x5aaa5aca,0x62eb5aca,0x5aaa5aca,0x5aaa5aca,0x5aaa5acb,0x5acb5aca,0x630c62eb,0x5aaa5acb,0x5acb5aaa,0x52aa5aca,0x5aca5aca,0x52aa52aa,0x5aaa5aaa,0x5aaa5aaa,0x62eb5aca,0x630b62eb,0x5aca630b,0x5aaa5aaa,0x5aca5aca,0x528a5aaa,
-0x62eb5aca,0x5aaa5aca,0x5aaa5aaa,0x5acb528a,0x5aaa5aaa,0x5aaa5aaa,0x5acb5aaa,0x5aaa5acb,0x5aaa5aaa,0x52895aaa,0x5aca5aca,0x5aca5aca,0x62eb630b,0x5aaa5aca,0x5aca5aca,0x5aaa5aaa,0x5aca528a,0x5aaa5aca,0x5289528a,0x5aaa5289,0x5aca5aaa,0x5aaa5aca,0x6b2c5aca,0x5aca6b2c,0x5289528a,0x52895289,0x528a528a,0x5aaa528a,0x528a528a,0x528a5269,0x52895289,0x62eb5aca,
-0x6b2c736c,0x6b0b6b4c,0x7bce736d,0x6b2c6b2c,0x9450738d,0x630b7bae,0x6b4c6b4c,0x630b736d,0x83ef6b2c,0x7bae7b8d,0x7b8d738d,0x738d736d,0x736d736c,0x736d736d,0x6b4c734c,0x630b6b2c,0x6b4c630b,0x6b4c736d,0x62eb630b,0x6b4c630b,0x62eb630b,0x5aca5aca,0x5aca62eb,0x5aca5aaa,0x630b630b,0x6b2c6b0b,0x5aca6b2c,0x62eb62eb,0x6b0b630b,0x62eb630b,0x62eb62ca,0x736d6b2c,
-0x5aaa62cb,0x62eb5aaa,0x5aaa62cb,0x62eb62aa,0x62ca62eb,0x6b2c62ca,0x6b0b6b2c,0x62eb630b,0x7bce6b4c,0x736d734c,0x736d630b,0x736d6b2c,0x734c7bae,0x6b2c6b4c,0x6b4c630b,0x5aca734c,0x62eb5aaa,0x5acb5aca,0x62eb5aca,0x62eb6b4d,0x62eb5acb,0x6b2c6b0c,0x62eb6b0c,0x6b0c62eb,0x630b630b,0x630b6b2c,0x5aca62eb,0x5aaa5aaa,0x630c62ec,0x5acb62eb,0x5acb5aaa,0x5acb62eb,
-0x5acb5acb,0x5aca5aca,0x5aca5aca,0x5aca5acb,0x62eb5aca,0x528a5aca,0x5aca5aaa,0x5aaa5aaa,0x52aa5aca,0x52aa52aa,0x52895289,0x52aa528a,0x52895289,0x5aca5289,0x62eb62eb,0x62eb62eb,0x5aea5aaa,0x630c630b,0x5aaa62eb,0x5aaa5aaa,0x5aaa5269,0x5aaa5aca,0x62eb5aca,0x5aca62eb,0x5aaa5aca,0x62eb62cb,0x6b0b62aa,0x5aaa6b0b,0x5aaa5aca,0x52695289,0x5aaa5289,0x5acb5acb,
-0x5289528a,0x5aaa5289,0x52895aca,0x5aca5aaa,0x5aaa5aca,0x5aca5aca,0x5aaa5aaa,0x528a5acb,0x62cb5aca,0x52895aca,0x5aaa5289,0x5aca5aca,0x5aaa528a,0x5acb5acb,0x5acb5acb,0x528a5acb,0x5aaa62eb,0x5aca5aaa,0x5aca5aca,0x5aaa5aca,0x5acb5acb,0x5aca5aca,0x62eb62eb,0x5aeb5aca,0x5aaa5aca,0x52a95aaa,0x62eb5aca,0x62eb62eb,0x5acb62eb,0x5aaa5aaa,0x5aca5aaa,0x5aca5acb,
-0x5aca5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aca528a,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x5aca5aaa,0x5aca5aaa,0x5aaa5aca,0x62ca5aca,0x5aca62eb,0x5aca5aca,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aaa52aa,0x528a5aaa,0x5289528a,0x5aaa5289,0x5aaa5aaa,0x52895289,0x62eb5aaa,0x5aaa62eb,0x5289528a,0x52895289,0x52695289,0x528a5269,0x5acb5acb,0x5aaa5aaa,0x52895aaa,0x5aaa5aaa,
-0x6b2b6b2b,0x6b4c6b4c,0x736c630b,0x6b2b7bad,0x734c6b4c,0x734c840f,0x6b2c5aaa,0x6b2c6b2c,0x736d6b4c,0x83ef9471,0x7bae7bae,0x7b8d7bae,0x736d738d,0x6b4c6b4c,0x6b2c6b4c,0x62cb630b,0x630b6b0b,0x6b4c6b2c,0x630b6b2c,0x6b4c630b,0x630b6b4c,0x5aaa5aca,0x62eb62eb,0x62eb62ca,0x62eb62eb,0x5aca62eb,0x62eb5aca,0x62eb630b,0x6b0b62eb,0x5aca62eb,0x62eb62eb,0x736d630b,
-0x5aaa62eb,0x62ca5aaa,0x62cb62cb,0x5a8a62aa,0x5aaa62ca,0x62ca5aaa,0x62eb62ca,0x6b2c6b2c,0x6b4c630b,0x736d7bce,0x6b2c736d,0x630b736d,0x7b8d736d,0x736d736d,0x62ca6b2c,0x62eb62eb,0x5aca5aaa,0x5aca62eb,0x62eb5aaa,0x6b2c630b,0x62eb6b2c,0x6b2c62eb,0x6b0b6b2c,0x6b0b62eb,0x62eb630b,0x6b0b62eb,0x5aaa6b2c,0x52895aaa,0x52aa52aa,0x528a528a,0x5acb5aaa,0x528a5aaa,
-0x630b62eb,0x5aaa62eb,0x62eb5aca,0x5aca630b,0x5aaa5289,0x5aaa62eb,0x5aaa528a,0x528a5aaa,0x528a52aa,0x52aa528a,0x4a695289,0x52aa5289,0x52895aaa,0x5aaa5289,0x630b62eb,0x630b630b,0x5aca62eb,0x6b2c62eb,0x5aca6b2c,0x5acb5aaa,0x5aaa528a,0x5aaa5aaa,0x5acb5aca,0x62eb62eb,0x5aaa62ca,0x62eb62ca,0x6b2c62eb,0x5aaa6b2c,0x5aca62eb,0x5aca5aca,0x5aaa5aaa,0x62eb62cb,
-0x5aaa5289,0x528a5289,0x5289528a,0x528a5aaa,0x5aca5289,0x52895aaa,0x5aca5aaa,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5a8a,0x5aaa5aaa,0x5aaa5289,0x52895aaa,0x5acb5aaa,0x52695aaa,0x52895aaa,0x5aca5aaa,0x5aaa5aca,0x5acb5aaa,0x5aca5aca,0x5aca5aca,0x5aca5aca,0x62eb5aca,0x52895aca,0x52a95aca,0x5aca5aaa,0x5aaa5acb,0x5aca5acb,0x5aaa5acb,0x5aaa5aaa,0x5acb5acb,
-0x5aaa5aca,0x5aca5aca,0x5aca5aca,0x5aaa5aca,0x5aaa5aaa,0x528a528a,0x52895aaa,0x5acb528a,0x5aca5aaa,0x5aaa62cb,0x62eb62eb,0x62eb62eb,0x5aca5aca,0x5aca5aca,0x5aaa5aaa,0x5aca5aaa,0x52aa5aca,0x52895289,0x5289528a,0x5aaa528a,0x5aaa5aca,0x5aaa5a8a,0x5aca5aaa,0x528a5aaa,0x5aaa5aaa,0x5aaa5aca,0x52695289,0x5aaa528a,0x62eb62eb,0x5aaa5aaa,0x5aaa5aaa,0x52895aaa,
-0x6b0b7bce,0x736d630b,0x62eb6b2c,0x6b4c734c,0x62eb6b4c,0x7bce736d,0x62eb734c,0x6b2c6b0b,0x7bae738d,0x8c307bae,0x83ce83ef,0x738d7bae,0x736d7bae,0x734c6b4c,0x6b4c736d,0x630b6b2c,0x630b630b,0x6b4c6b2c,0x6b2c6b4c,0x6b4c6b2c,0x736d736d,0x630b6b4c,0x6b2c632b,0x632b632b,0x62eb630b,0x630b5aca,0x62eb62eb,0x630b630b,0x62eb5aca,0x62eb630b,0x6b0b5aca,0x62eb6b2c,
-0x62eb630b,0x5aca62eb,0x5aca5aaa,0x62ca62cb,0x5a8a5aaa,0x62ca5aaa,0x62eb5aca,0x6b2c6b2c,0x6b4c6b2c,0x7bce736d,0x736d736d,0x734c736d,0x736d6b4c,0x736d7bce,0x6b0b6b2c,0x5aaa5aaa,0x5aaa5aca,0x5aca5aaa,0x5aaa5aca,0x630b5aaa,0x62eb734d,0x62eb5aca,0x734c6b2c,0x6b0b6b0c,0x62eb630b,0x62eb62ca,0x630b6b4c,0x5aaa630b,0x52aa528a,0x5acb5aab,0x5acb62eb,0x5aaa5aaa,
-0x62eb5aaa,0x5aca62eb,0x5aca5aaa,0x62eb630b,0x5289528a,0x62eb5aaa,0x5aaa5acb,0x5aaa5aaa,0x528a52aa,0x528a528a,0x5269528a,0x528a5269,0x5aaa5aaa,0x5aaa5aaa,0x630b62eb,0x62eb630b,0x62eb6b2c,0x630b62eb,0x62ca630b,0x5aaa5aaa,0x5aaa5aca,0x5aaa5a89,0x5aaa5aaa,0x62cb5aaa,0x5aca62cb,0x5aaa5aaa,0x62eb62eb,0x5aaa62ca,0x5aca62ca,0x5aeb5aea,0x5aaa5aca,0x5aca5aca,
-0x5aca5aaa,0x5aca5aca,0x5aaa5aca,0x5aaa5aca,0x5aca5289,0x52895aaa,0x5aca5aaa,0x5acb5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x5289528a,0x5aaa5289,0x52695289,0x5aaa528a,0x528a5aaa,0x5aaa5289,0x5aaa528a,0x5aaa62eb,0x62eb5aaa,0x5aca5aca,0x62eb5acb,0x5aaa5aaa,0x62eb5aca,0x52895aca,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aca,0x5acb5acb,0x5aca5acb,0x5acb5aca,0x5aaa5aca,
-0x5aaa5a8a,0x62cb62eb,0x5aaa5aaa,0x5aaa5aca,0x5acb5aca,0x5aaa5aca,0x52895aaa,0x5aca5289,0x5aca5aca,0x5aca62eb,0x62eb630b,0x5aca62eb,0x5aca62eb,0x5aca5aca,0x62eb62eb,0x5aaa5aca,0x52aa5aaa,0x52aa52aa,0x52aa52aa,0x528a5aaa,0x5aca528a,0x5aaa5aca,0x5aca5a8a,0x5aaa62ca,0x5aca5aaa,0x5aca5aca,0x528a5aaa,0x5aca5aaa,0x5aaa5aaa,0x52895289,0x5aca5aaa,0x5aca5aea,
-0x738d9470,0x6b0b6b2c,0x6b2c6b2c,0x630b62eb,0x6b0b62eb,0x736d6b4c,0x6b2c7bce,0x6b2c62eb,0x83ef736d,0x736d736d,0x7bce9471,0x736d738d,0x736d738d,0x738d736d,0x736d738d,0x736d734d,0x736d734c,0x6b2c736d,0x6b2c630b,0x6b4c6b2c,0x7bae734c,0x73ad7bce,0x6b4c736d,0x6b2c6b2c,0x630b630b,0x6b2c62eb,0x62eb62eb,0x6b2c630b,0x62eb630b,0x62eb62eb,0x630b630b,0x630b630b,
-0x62eb62eb,0x62eb630b,0x5a8a5aaa,0x6b0b62cb,0x5aaa62eb,0x62cb5a8a,0x5aca62eb,0x6b2c630b,0x736d6b4c,0x736d6b2c,0x7b8d7bae,0x736d736d,0x6b0b736d,0x738d734c,0x734c734c,0x5a896b0b,0x5aaa5a8a,0x528a5269,0x5aaa5aca,0x5aca62eb,0x630b630b,0x62eb62eb,0x6b2c6b0b,0x734c734d,0x62eb6b2c,0x5aca630b,0x738d630c,0x62eb6b2c,0x528a5aaa,0x5acb528a,0x5aab5acb,0x5aaa5aaa,
-0x5aca5aaa,0x5aaa5aaa,0x5aaa5aaa,0x5aca5aca,0x5aaa528a,0x5aaa5289,0x62eb630c,0x5aca5aaa,0x52aa5aca,0x52895289,0x5289528a,0x528a5269,0x5aca5aaa,0x5acb62eb,0x62eb5acb,0x5acb62eb,0x6b2c6b0b,0x62eb630b,0x62ca62eb,0x5aaa5aca,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aca5aaa,0x62eb5aca,0x62ca62eb,0x5aaa62cb,0x5aca5aaa,0x5aca62eb,0x5aca52aa,0x5aca5aca,0x5aaa5aaa,
-0x5aca5aca,0x62eb5aca,0x5aaa62eb,0x5aca5aca,0x5aaa5aca,0x5aaa5aaa,0x5aaa5289,0x5aaa5acb,0x5aaa5289,0x5aaa5aaa,0x5aca5aaa,0x5aaa5aca,0x5aaa5289,0x528a5aaa,0x528a528a,0x5acb5aaa,0x5aca5aaa,0x528a5289,0x5acb62eb,0x62eb5aca,0x5aca5aca,0x630b62eb,0x5aca5acb,0x630b62eb,0x5aaa62eb,0x5aaa5aca,0x5aaa5aaa,0x5aca5aaa,0x5aca5aca,0x5acb5acb,0x5acb5acb,0x5acb5acb,
-0x5aca5aca,0x5aca62cb,0x5aaa5aaa,0x5aaa5aca,0x5aca5aaa,0x5aca5aca,0x5aaa5aaa,0x5aaa5aaa,0x62cb62cb,0x62eb62eb,0x62eb6b0b,0x5aaa5aca,0x5aca5aca,0x5aca5aca,0x5aca5aca,0x5aaa5aca,0x528a52aa,0x52aa52aa,0x5aaa52aa,0x52695aaa,0x528a5269,0x5aaa5aca,0x5aaa5aaa,0x5aca5aca,0x52a95aaa,0x5aaa52aa,0x5aaa5aca,0x5aaa5aaa,0x528a5aca,0x528a5269,0x528a5aaa,0x5aca5aaa,
-0x8c307bce,0x6b2c736d,0x6b2c6b0b,0x5aca736d,0x6b2c6b2c,0x736d6b4c,0x7bce630b,0x6b2c736d,0x736d738d,0x7b8d83ef,0x8c50738d,0x738d7bae,0x6b4c6b4c,0x736d734c,0x736d738d,0x736d736d,0x7bae738d,0x6b4c7b8d,0x630b630b,0x6b2c6b2c,0x736d6b2c,0x7bae7bae,0x736d7bae,0x632b6b2c,0x6b2c630b,0x630b62eb,0x6b2c62eb,0x6b4c736d,0x62eb6b2c,0x5aca5aaa,0x62eb630b,0x6b2c5aca,
-0x5aeb62eb,0x6b2c630c,0x5aaa62eb,0x62eb5aca,0x630b630b,0x62eb62ca,0x62eb62eb,0x6b4c630b,0x736d734c,0x6b4c6b4c,0x840f6b4c,0x7bae734c,0x6b4c734c,0x6b2c62ca,0x6b2c7bae,0x62ca62eb,0x4a495a8a,0x52695aaa,0x62eb5269,0x5aca62eb,0x62eb5aca,0x6b2c6b2c,0x62eb62eb,0x7b8d734c,0x6b2c736d,0x62eb6b2c,0x738d630b,0x6b2c6b2c,0x5acb62ec,0x5acb52ab,0x5acb62eb,0x528a5aaa,
-0x5aaa5aaa,0x5aaa5289,0x5aaa5aca,0x52a95aaa,0x5acb5aca,0x52895289,0x62eb5acb,0x52895aaa,0x5aca5aca,0x5289528a,0x5289528a,0x528a5269,0x5aca5aaa,0x62eb5acb,0x62eb62eb,0x62eb62eb,0x6b0b630b,0x630b6b2c,0x5aca62eb,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x5aca5aaa,0x62eb5aca,0x62eb6b2c,0x5aaa62ca,0x62eb62cb,0x5aca62eb,0x52895289,0x5aca5aca,0x5aca5aaa,
-0x5aca5aca,0x5aeb5aaa,0x52aa5aca,0x5aca5aaa,0x52a95aaa,0x5aaa5aaa,0x52895289,0x52895aaa,0x5aaa5aaa,0x5aca5aaa,0x62eb5aca,0x5acb62eb,0x5aaa5aaa,0x5aaa5aaa,0x528a5aaa,0x5acb5aaa,0x62eb5aca,0x5aaa5aaa,0x5aca62cb,0x5aca5aca,0x5aaa5aaa,0x630b62eb,0x630b630b,0x630c6b2c,0x5aca62eb,0x5aaa5aaa,0x5aca5aaa,0x5aaa5aaa,0x5aaa528a,0x62eb5acb,0x5aca5acb,0x62eb62eb,
-0x62eb630b,0x5aca5aca,0x62eb62eb,0x5aca62eb,0x5aaa5aaa,0x5aca5aaa,0x5acb5acb,0x5aaa5aca,0x5aca5aca,0x5aaa5aca,0x62ca62eb,0x5aaa5aca,0x5aca5aaa,0x62eb62eb,0x5aaa5aca,0x5aca5aaa,0x528a5aaa,0x52aa52aa,0x5aca52aa,0x52895aaa,0x52895aaa,0x62eb5aaa,0x5aca5aea,0x5aca5aaa,0x52aa5aca,0x5aca52aa,0x62eb62eb,0x5aca5acb,0x5aaa5aca,0x5aaa5289,0x52895aaa,0x52a95289,
-0x738d6b2c,0x738d7bce,0x6b0b62eb,0x6b2c736d,0x6b0b62eb,0x6b2c7b8d,0x7b8d6b2c,0x8c0f8c30,0x738d736d,0x7bae7bae,0x7bae736d,0x83ee9450,0x734c734c,0x738d736d,0x7bae7bae,0x734c7b8d,0x734c6b4c,0x7bae738d,0x630b736d,0x630b62eb,0x632b630b,0x736d6b4c,0x738d7bae,0x630b6b2c,0x736d738d,0x6b2c6b2c,0x6b4c630b,0x630b6b4c,0x630b630b,0x62eb630b,0x6b0b62eb,0x62eb6b2c,
-0x630b6b2c,0x632c630c,0x5aca62eb,0x5aca5aca,0x6b2c5aca,0x630b6b2c,0x630b630b,0x6b2c6b2c,0x736d736d,0x6b4c6b2c,0x736d736d,0x83ce8c0f,0x6b4c738d,0x6b0b6b2c,0x6b4c6b0c,0x5aca62eb,0x4a485aca,0x5aca5269,0x52695269,0x5aca62eb,0x62cb62eb,0x6b4c6b0c,0x62cb6b0b,0x7b8d6b2c,0x738d7bce,0x6b2c6b0b,0x6b2c630c,0x6b2c6b2c,0x632c632c,0x62ec630c,0x5acb62eb,0x5aaa5aaa,
-0x5aca528a,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aca,0x52895acb,0x528a5269,0x5aaa528a,0x5aaa5acb,0x5aaa5aaa,0x5289528a,0x528a52aa,0x528a5289,0x5aaa5aca,0x5aca528a,0x630b62eb,0x630b630b,0x62eb630b,0x6b2c630b,0x5aca6b0b,0x5aaa5aaa,0x5aaa5aca,0x5aaa5aaa,0x52895aaa,0x5aca5a89,0x62cb5aca,0x62eb6b2c,0x5a8a5aaa,0x5aaa62eb,0x5aca5aca,0x5aaa52a9,0x5aaa62eb,0x528a5269,
-0x5aca5aaa,0x52aa5aaa,0x52a952aa,0x5aaa5aaa,0x5aaa5289,0x5aaa5aaa,0x5aaa5aca,0x52895269,0x5a8a5aaa,0x62eb5aaa,0x62eb630b,0x62eb5acb,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x62eb5aca,0x62eb62cb,0x5aaa5aca,0x5aaa5aca,0x5aca5aca,0x6b2c62eb,0x736d6b2c,0x6b2c736d,0x62eb62eb,0x5aaa5aaa,0x630c5aca,0x5aca5aca,0x528a5aaa,0x5acb528a,0x5acb62eb,0x5aca5acb,
-0x5aca62cb,0x5aca5aaa,0x5aaa5acb,0x5acb5aaa,0x5aaa62eb,0x62eb5aaa,0x62eb62eb,0x5aca62eb,0x62eb62cb,0x5aaa62eb,0x62eb5aca,0x5aaa62eb,0x5aca5aaa,0x5aca5aea,0x5aaa5aca,0x5aaa5aaa,0x52aa5aeb,0x5aca52aa,0x5acb5aaa,0x5aca5aeb,0x5aaa5aaa,0x5aca5aaa,0x62eb5aea,0x5aaa62eb,0x5aca5aca,0x5aeb5aca,0x5aca62eb,0x62eb5aca,0x5aaa5aaa,0x5aaa5aaa,0x52895aaa,0x5aaa5aaa,
-0x6b0b736d,0x7bae734d,0x6b2c7b6d,0x734d6b0c,0x62cb6b0c,0x7b8e736d,0x734c734c,0xa4f3736c,0x736c9c91,0x7bad736d,0x736c83ef,0x947083ef,0x6b2b83ee,0x8c0f7b8d,0x7b8d8bef,0x734c7b6d,0x734c734d,0x6b4c6b2c,0x736d736d,0x630b632b,0x62eb6b2c,0x6b2c630b,0x6b4c6b2c,0x630b736d,0x734d736d,0x6b2c6b4c,0x6b4c630b,0x630b6b4c,0x630b62eb,0x632b6b4c,0x62eb630b,0x6b2c6b0b,
-0x6b2c62eb,0x62eb630b,0x6b2c6b4c,0x5aaa5aca,0x6b0b5a8a,0x736d734c,0x734c734c,0x6b2c630b,0x734c7bad,0x6b2c6b4c,0x6b2c6b2c,0x8c50734c,0x7bce8c30,0x6b4c738d,0x630b6b0c,0x736d736d,0x528a5acb,0x4a484a48,0x4a495aaa,0x62eb5aca,0x62eb62eb,0x6b2c62ca,0x6b4c630b,0x734c6b4c,0x6b2c736d,0x62eb630b,0x6b2c630b,0x5acb630c,0x6b4c736d,0x630c6b2c,0x62eb62eb,0x5aaa62cb,
-0x5aaa5aaa,0x5aca5aca,0x52aa52aa,0x5aaa5aca,0x528a52aa,0x5acb52aa,0x52895aaa,0x62eb5aaa,0x52aa62eb,0x5aca52aa,0x52895aaa,0x5aaa528a,0x5aaa528a,0x630b5aca,0x630b630b,0x630b62eb,0x62eb62eb,0x6b0c62eb,0x62ca6b2c,0x62eb5aaa,0x5aaa5aca,0x5aaa5aca,0x5aaa5289,0x5aaa528a,0x62eb62ca,0x62cb62eb,0x62ca62cb,0x62ca5aaa,0x5aca62cb,0x5aca5aca,0x5aaa5aaa,0x52895aaa,
-0x5aaa528a,0x52895aaa,0x5aaa5aca,0x5aaa5aaa,0x528a5289,0x5aaa52aa,0x5aca5aca,0x52aa52aa,0x5aaa5aaa,0x5aca528a,0x62eb62eb,0x5aca630b,0x5aaa5aca,0x52895aaa,0x5aaa5aaa,0x5aaa5aca,0x62cb62ca,0x62cb62eb,0x62eb62cb,0x5aaa5aca,0x5aca5aca,0x62eb62eb,0x738d6b2c,0x630b6b4c,0x5aca528a,0x5aaa5aca,0x62eb5acb,0x5aaa5aca,0x5aca5aaa,0x5aaa5aaa,0x62eb5acb,0x5aca5acb,
-0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aca5aaa,0x5aca630b,0x62eb62eb,0x5aca5aaa,0x62eb62eb,0x5aca5aaa,0x62eb630b,0x62ca62ca,0x62cb5aca,0x62eb5aca,0x5acb62eb,0x5aaa5aca,0x52aa5aaa,0x5aaa5aab,0x52aa5aaa,0x52aa5acb,0x5aca5aeb,0x5aeb5aeb,0x5aca5aca,0x62eb5aca,0x5aaa5aca,0x5aea5aca,0x5aca5aea,0x630b62eb,0x5aca62eb,0x5aca5aca,0x528a5aaa,0x5aaa5aaa,0x52895289,
-0x736d734c,0x734d6b0b,0x736d83ef,0x6b0c62cb,0x6b0c6b2c,0x7b6d6aeb,0x7b8d7b8d,0x83ef83ce,0x840f9cd2,0x7b8d7bad,0x7bce83ce,0x83ee738d,0x7bad9470,0x7bad6b0b,0x83ae8c0f,0x7bad732c,0x736d734d,0x6b0b6b2c,0x736d6b4c,0x6b2c6b4c,0x736d6b4c,0x62eb630b,0x6b2c62eb,0x736d6b2c,0x630c6b0c,0x630b62eb,0x6b6d632c,0x5aca632b,0x630b630b,0x6b4c6b2c,0x62eb6b2c,0x6b2c630b,
-0x630b6b2c,0x630b630b,0x630b630b,0x62eb630b,0x5aaa5aaa,0x6b0b630b,0x734c736c,0x6b4c6b2c,0x736c6b2b,0x6b4c6b2b,0x62eb6b2c,0x83ef738d,0x94719cd2,0x7bae840f,0x630b6b4d,0x6b2c6b2c,0x528a6b2c,0x528962eb,0x5aaa5289,0x5aaa5aaa,0x5aca62eb,0x62eb5aca,0x738d630b,0x736d736d,0x5aeb62eb,0x5acb62eb,0x5aaa5aaa,0x62eb5aca,0x6b4c630b,0x630b6b2c,0x62eb630b,0x62cb5aaa,
-0x52895aaa,0x5aaa528a,0x5aaa52aa,0x5aca5aca,0x5aca52aa,0x5acb5acb,0x5acb5acb,0x5aaa5acb,0x528a5aeb,0x5aca528a,0x528a5aaa,0x5acb528a,0x62eb5aaa,0x630b6b0c,0x630b630b,0x62ca62eb,0x62eb62cb,0x62cb62eb,0x62ca62cb,0x62cb5aaa,0x5aaa62eb,0x52695a8a,0x528a5269,0x5aaa5aaa,0x62cb5aaa,0x62eb62eb,0x5aaa62ca,0x62ca5aaa,0x62eb62eb,0x5aca62eb,0x5a8a5aaa,0x5aaa528a,
-0x528a5aaa,0x52895289,0x5aaa5289,0x52895269,0x5aaa5aaa,0x52aa5289,0x5aca5aca,0x52aa5aca,0x5aaa5aca,0x5aaa5269,0x5aca5aca,0x5aca62eb,0x5289528a,0x52695289,0x5aaa5aaa,0x5aca5aca,0x62eb62eb,0x62cb62cb,0x62cb62cb,0x5aca5aca,0x62eb62eb,0x62eb5aca,0x6b2c62eb,0x5aca630b,0x5aaa630b,0x5aca5aaa,0x5aaa5aaa,0x5aca5acb,0x5aca5aca,0x52895aaa,0x62eb5aaa,0x62eb62eb,
-0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x62ca5aca,0x62ca62eb,0x5aca62eb,0x62eb5aaa,0x62eb62eb,0x5aaa5aca,0x62eb62ca,0x5aca62eb,0x62eb5aca,0x62eb62eb,0x5aaa62eb,0x52aa52aa,0x52aa52aa,0x5acb5aab,0x5aeb5acb,0x5acb62ec,0x5aca5aeb,0x5aca5aca,0x5aaa5aca,0x5aca5aaa,0x62eb62eb,0x5aca5aca,0x5aaa5aca,0x62eb5aca,0x5acb62eb,0x5aca5aca,0x528a5aaa,0x5aaa5aaa,0x5289528a,
-0x62eb736d,0x6b2c7b8d,0x8c307b8d,0x6b0b6b2c,0x734c62eb,0x6b0c6aeb,0x8c0f7bae,0x8bef83ee,0x94908c0f,0x736c8c50,0x7b8d83ee,0x83ee83ee,0x945083ee,0x732c7bae,0x8bef7b8d,0x734c7b8d,0x6b2c7b8d,0x6b4c630b,0x6b2c734c,0x738d6b2c,0x6b2c6b2c,0x62eb6b4c,0x62cb62eb,0x736d6b4c,0x6b0c736d,0x630b5aca,0x6b2c6b2c,0x632c630b,0x5aeb630b,0x632b630b,0x62eb6b2c,0x630b62eb,
-0x6b2c6b2c,0x62eb630b,0x62eb630b,0x630b62ca,0x5aaa62eb,0x62ca62ca,0x736d734c,0x6b2c736d,0x6b4c736c,0x6b2b6b4c,0x6b4c6b2c,0x7bce736d,0xa513840f,0x8c509491,0x736d736d,0x6b2c62eb,0x5aca6b2c,0x52696b2c,0x5aaa5269,0x5aaa528a,0x6b2c5aaa,0x62eb62eb,0x736d62eb,0x736d7bce,0x62eb6b2c,0x5aaa5acb,0x5aca5aaa,0x5aaa5aaa,0x5aea5aca,0x630b630b,0x62eb62eb,0x528a5acb,
-0x5aaa5aaa,0x5aaa5aaa,0x52aa52aa,0x52aa52aa,0x5acb5aeb,0x5aeb5aeb,0x5acb62eb,0x5acb5acb,0x52aa52aa,0x528a52aa,0x5aaa528a,0x5acb5acb,0x62eb630b,0x6b2c630b,0x5aca630b,0x630b5aca,0x62eb6b0b,0x62ca62cb,0x62ca62cb,0x5aaa5aaa,0x5a895a8a,0x5aaa5289,0x5aaa5aaa,0x5aca5aca,0x62cb5a8a,0x6b2c6b2c,0x62ca62eb,0x5aaa62ca,0x62eb62eb,0x62cb62eb,0x5aca62eb,0x5aca5aaa,
-0x52695aaa,0x5aaa5aaa,0x5aca528a,0x528a5269,0x528a5289,0x5aaa5aaa,0x5aca5aaa,0x5acb5acb,0x5aaa5aaa,0x5aaa5289,0x5aaa5aaa,0x5aca5aca,0x5289528a,0x5aaa5aaa,0x5aaa5aca,0x52895a8a,0x62cb62cb,0x62eb5aaa,0x62eb630b,0x5aca62eb,0x62eb5aca,0x62eb5aca,0x630b62eb,0x62cb630b,0x62eb62eb,0x5aaa5acb,0x5acb5aca,0x5aaa5aca,0x5aca528a,0x5aaa5aca,0x62eb5aca,0x5aca62eb,
-0x62eb62eb,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x630b62eb,0x5aca630b,0x6b0c62eb,0x62eb62eb,0x5aca62eb,0x5aca5aca,0x62eb5aca,0x62cb5aca,0x5acb5acb,0x5aaa5aca,0x52aa52aa,0x5aca5aca,0x5acb5acb,0x62eb5acb,0x5acb5aeb,0x5acb5acb,0x5aca5aca,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x5aca5aea,0x5aaa5aaa,0x62eb5aca,0x62eb62eb,0x5aca5aca,0x5aaa5aaa,0x5aca5aca,0x528a5aaa,
-0x734c736d,0x7b8e62eb,0x734c7b8d,0x62eb7bae,0x6aeb62aa,0x6b2c736d,0x83ce6b0b,0x8c308c30,0x840e840f,0x8c509cb1,0x7bad736c,0x83ee83ee,0x83ef7bad,0x7b8d8c0f,0x736d736c,0x734c7b8d,0x6b0c6b2c,0x6b2c6b2c,0x630b6b2c,0x6b4c630b,0x630b630b,0x6b4c630b,0x62eb62cb,0x6b4c630b,0x6b2c736d,0x630b62eb,0x632b6b2c,0x630b5aeb,0x630b630b,0x62eb630b,0x6b0b630b,0x630b6b2c,
-0x6b4c62eb,0x5aca630b,0x62eb62eb,0x62eb5aca,0x6b0b6b0b,0x62eb62ea,0x7b8d630b,0x6b4c7b8d,0x7bad738d,0x6b4c6b2c,0x6b4c6b2c,0x7bae83ce,0x83ef7bae,0x9cb29cd2,0x630b630b,0x6b2c7bce,0x6b4d62eb,0x5aaa6b2c,0x52895aca,0x52895269,0x62eb5aaa,0x62eb6b4c,0x6b2c5aca,0x7bae736d,0x630c6b4d,0x5aca62eb,0x5aaa5aaa,0x5aca5aaa,0x5aaa5aca,0x62eb5aca,0x62eb62eb,0x52695acb,
-0x5aaa5289,0x5aaa5aca,0x52895289,0x5289528a,0x5aeb5acb,0x5aeb5aeb,0x5aab5acb,0x630c5acb,0x52aa52aa,0x4a69528a,0x5acb5269,0x5acb62eb,0x6b2c62eb,0x630b6b4c,0x62eb62eb,0x62eb62eb,0x62ca6b0b,0x62eb5aaa,0x62ca6b0b,0x5aaa5aaa,0x5a8a5269,0x630b5aaa,0x5aaa62eb,0x5aca5aca,0x62ca5aaa,0x734c6b2c,0x62eb6b0b,0x5aaa62cb,0x630b62eb,0x62eb62eb,0x630b6b2c,0x630b62eb,
-0x52695aaa,0x52895aaa,0x52695289,0x5aaa528a,0x5aaa5289,0x5aca5aca,0x5aca5aca,0x5aca5aca,0x5acb5aca,0x5aaa5aca,0x5aaa5aaa,0x52895289,0x52895289,0x5aaa5aaa,0x5aca5aca,0x5a8a5aaa,0x5aca5aaa,0x62eb5aaa,0x62eb6b2c,0x5aaa62eb,0x5aca5a8a,0x62eb5aaa,0x6b2c62eb,0x5aca630b,0x630b5aaa,0x5aaa630b,0x62eb5aca,0x52895aaa,0x5acb5aca,0x52895aca,0x62eb5aaa,0x62eb62eb,
-0x62eb62eb,0x5acb5aca,0x630b62eb,0x62eb62eb,0x62eb62eb,0x5aca62eb,0x6b0b62cb,0x62ca62eb,0x62eb62eb,0x5aaa62eb,0x62eb5aaa,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x5aca5aaa,0x5acb5acb,0x5aeb52aa,0x5aca5aca,0x5acb5aca,0x5aca5aca,0x630b62eb,0x630b630b,0x5aca62eb,0x5aca5aea,0x62eb5aca,0x62eb62eb,0x5acb5acb,0x62eb5acb,0x5aaa5aca,0x5aca5aca,0x5aaa5aaa,
-0x6b4c6b2c,0x630b62eb,0x6b2c736d,0x734c62eb,0x6b0b734c,0x7b8d6b0b,0x734c7b8d,0x945083ce,0x8c308c50,0x9c918c2f,0x7b8d8c50,0x83ce7bce,0x738d8c0f,0x83ef7bae,0x6b0b7bad,0x736d734c,0x6b0b6b2c,0x6b2c6b0b,0x6b2c6b2c,0x6b0b6b0b,0x6b2c6b0c,0x5aca6b2c,0x62eb6b4c,0x630b62eb,0x736d6b4c,0x6b2c6b4c,0x6b6c6b4c,0x62eb630b,0x6b2c630b,0x62eb6b2c,0x6b4c6b2c,0x630b6b4c,
-0x62eb62eb,0x62eb630b,0x630b62eb,0x62eb6b2c,0x6b0b62eb,0x6b0b6b0b,0x736d630b,0x738d7bad,0x7bae6b4c,0x6b4c736d,0x6b4c6b2c,0x7bce83ef,0x840f7bce,0x9471840f,0x6b4d738d,0x6b4c6b2c,0x736d62eb,0x630b6b2c,0x528a630b,0x62eb5aca,0x5aaa5aaa,0x6b0b5aaa,0x5aca630b,0x736d6b2c,0x6b0c734d,0x62eb630c,0x5acb5acb,0x5aca5acb,0x5aea5aaa,0x5aca5aca,0x5aeb5aeb,0x5aca5aaa,
-0x5aaa5289,0x5aaa5aaa,0x528952aa,0x528a528a,0x5aeb52aa,0x5acb62eb,0x5acb5aca,0x62eb62eb,0x528a62eb,0x528a5269,0x5aaa528a,0x62eb62eb,0x6b2c62eb,0x736d736d,0x630b6b2c,0x5aca62eb,0x5aaa62eb,0x62ca5aaa,0x5aaa62ca,0x62ca5aaa,0x62ca62cb,0x62eb5aaa,0x52895aca,0x5aca5aaa,0x5aaa5aaa,0x62cb62ca,0x62cb62ca,0x62eb62eb,0x62eb62eb,0x5aca62cb,0x62eb62eb,0x630b5acb,
-0x5aaa630b,0x52695289,0x4a485269,0x5aca5aca,0x5aca5aca,0x5aaa5aaa,0x5aca5aca,0x52895aaa,0x5aca5aca,0x52895aaa,0x5aca5aaa,0x52695289,0x5aaa5aaa,0x52695289,0x5aca5289,0x5aaa5aca,0x62cb5aca,0x5aaa5289,0x5aca62cb,0x5aaa62eb,0x5aca5aaa,0x62eb62eb,0x6b4c62eb,0x5aaa5acb,0x5aca62eb,0x62eb62eb,0x528a5aaa,0x5aca5aca,0x5acb5aca,0x5aca5aca,0x5acb5aca,0x630b62eb,
-0x5acb5aca,0x5aca5aca,0x630b62eb,0x6b2c630b,0x5aca630b,0x62eb62eb,0x62eb62ca,0x62cb62eb,0x62eb62ca,0x5aca630b,0x62ca5aaa,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x528952aa,0x52aa5289,0x5aab52aa,0x62eb52aa,0x5aca5acb,0x5acb5aca,0x5aca5aca,0x62eb5acb,0x62eb62eb,0x62ca62eb,0x5aea62eb,0x630b62eb,0x5aca62eb,0x5aca5aaa,0x62eb5acb,0x5aca62eb,0x5aaa5aaa,0x5aaa528a,
-0x6b0b62eb,0x5aca6b0b,0x734c630b,0x734c6b2c,0x736d7bae,0x734c62eb,0x840f9450,0x83ce736c,0x8c308c30,0x8c0f8c50,0x840f9cb1,0x7bce736d,0x83ce83ee,0x83ce7b8d,0x7b6d7b8d,0x6b2c6b2c,0x6b0b734d,0x6b2c62eb,0x6b4c736d,0x6b2c6b2c,0x6b4c630b,0x630b630b,0x6b4c630b,0x62eb630b,0x736d6b2c,0x738d738d,0x630b6b4c,0x630b62eb,0x632b630b,0x6b2c6b2c,0x6b2c6b4c,0x6b2c6b4c,
-0x62eb630b,0x630b62eb,0x6b2c630b,0x630b6b2c,0x62eb62eb,0x6b2c6b2b,0x6b2c734c,0x7b8d7b8d,0x738d7bae,0x6b2c736d,0x734c6b2c,0x8c0f7bae,0x83ce840f,0x83ef83cf,0x736d8410,0x6b2c6b2c,0x630b6b2c,0x630b630b,0x5aaa5acb,0x6b2c630b,0x5aaa62eb,0x630b630b,0x630b630b,0x6b2c630b,0x6b2c6b2c,0x6b2c6b4d,0x630c6b2c,0x5aaa62eb,0x5aca5aca,0x5aaa5aaa,0x5aca5aca,0x5aeb5acb,
-0x528a5aca,0x5aaa5289,0x52aa5aca,0x52aa5289,0x5acb52aa,0x62eb5aeb,0x62eb630c,0x62eb5acb,0x5aaa62eb,0x528a5289,0x5aca5aaa,0x62eb62eb,0x5acb630b,0x736d630b,0x62ca734c,0x630b5aaa,0x5aca5aca,0x5aaa62ca,0x5a895269,0x62eb62ca,0x62ca6b0b,0x5aaa5a8a,0x5aaa5aaa,0x5aaa5aaa,0x62aa62ca,0x5aaa5aaa,0x62ca5aaa,0x62eb62eb,0x62eb5aca,0x62eb62eb,0x5aaa62cb,0x5aca5289,
-0x62eb630c,0x5aaa5269,0x5aaa5289,0x5aaa5aca,0x5aca5aca,0x5aaa5aaa,0x5aaa5aaa,0x52aa5aaa,0x5aaa5289,0x52895aca,0x5aaa528a,0x5aaa5289,0x5aca62cb,0x52895a8a,0x5aaa5289,0x52895aaa,0x5aca5aca,0x5aaa5289,0x5aaa5aaa,0x5aca62eb,0x5aaa5aca,0x62eb630b,0x6b4d62eb,0x5aaa5aca,0x5aaa62eb,0x5acb5aaa,0x52695aaa,0x62eb528a,0x5aca5aaa,0x630b62eb,0x62eb630b,0x62eb5acb,
-0x62eb5aaa,0x62eb62eb,0x62eb62eb,0x6b4c630b,0x5aca6b2c,0x630b62eb,0x62eb62cb,0x62cb62eb,0x62eb62ca,0x62eb630b,0x5aca5aca,0x5aca5aaa,0x5aaa5aca,0x5aca5aaa,0x52aa5aaa,0x5aaa52aa,0x5acb5aaa,0x5acb5aab,0x5aca5acb,0x5acb5acb,0x5aca5aaa,0x62eb5aca,0x5aca62ca,0x62eb62eb,0x62eb62eb,0x630b62eb,0x5aca62eb,0x5aca5aaa,0x5acb5aca,0x5aca5acb,0x5aaa5aaa,0x5aaa5aaa,
-0x6b2c7bad,0x6b4c6b2c,0x630b62eb,0x738d738d,0x736d736d,0x6b2c7bae,0x94717b8d,0x6b4c8c30,0x8c5083ef,0x94918c50,0x83ef83ce,0x736d8c0f,0x83ef7bae,0x7b8e83ce,0x7b8d736d,0x6b0c6b2c,0x6b0c6b0c,0x62eb6b0b,0x736d630b,0x62eb736d,0x62eb62eb,0x6b2c6b2c,0x6b2c630b,0x630b736d,0x736d6b2c,0x8c507bce,0x6b4c7bce,0x6b4c632b,0x630b630b,0x6b2c6b2c,0x6b0c6b4c,0x6b2c6b2c,
-0x6b2c6b2c,0x62eb630b,0x6b2c6b2c,0x6b0c6b0b,0x62eb6b0c,0x734c6b0b,0x6b2b7b8d,0x734c734c,0x7bae7bce,0x6b4c630b,0x6b2c736d,0x83ce7b8d,0x7b8d83ce,0x7bae736d,0x738d6b4c,0x736d7bae,0x630b6b4c,0x6b4c6b2c,0x5aca62eb,0x5aca5acb,0x6b0c5aca,0x630b6b2c,0x62eb630b,0x630b6b4c,0x734d630c,0x7b8e7bae,0x62ec6b2c,0x5aaa5acb,0x52895acb,0x5aca52aa,0x5aca5aaa,0x5acb5aeb,
-0x5acb62eb,0x5aaa5aaa,0x5aaa5aaa,0x52aa528a,0x5aca5acb,0x630b5aaa,0x62eb6b2c,0x630c5aca,0x5aca62eb,0x52895aaa,0x62eb528a,0x62eb630c,0x62eb62eb,0x62eb62eb,0x62cb62eb,0x5aca5aca,0x5aca5aca,0x5aca62ca,0x5aaa5a8a,0x62eb62eb,0x5aaa62eb,0x5aaa5aaa,0x5aca5aca,0x5aaa5aaa,0x62cb5aaa,0x62ca62cb,0x62ca62ca,0x62ca62ca,0x62eb5aca,0x630b630b,0x5aaa62eb,0x5aaa528a,
-0x62eb5aca,0x5aaa5289,0x5aaa5aaa,0x52a95aaa,0x5aaa52a9,0x528a5aaa,0x528a5289,0x5aaa5aaa,0x5aca5289,0x5aca62eb,0x52895aaa,0x5aca5269,0x62cb62eb,0x62eb5aca,0x5aca5aca,0x5aaa5aaa,0x5aca5aca,0x62cb5aca,0x5aca5aca,0x5aca5aca,0x5aaa5aca,0x5aca62eb,0x62eb5aca,0x5acb5aaa,0x5aca528a,0x5aaa5aaa,0x52895aaa,0x5aca5289,0x630b630b,0x62eb62eb,0x630b630b,0x630b630b,
-0x630b62eb,0x5aca62eb,0x5aca62eb,0x630b5aca,0x5aca630b,0x630b62eb,0x62eb62eb,0x62ca62ca,0x62ca62eb,0x62eb62eb,0x5aca62eb,0x62eb5aaa,0x5aaa5aca,0x5aca5aaa,0x5aca5aca,0x5aca5aca,0x5aeb5acb,0x5aca5aeb,0x5aaa5aca,0x5aca5acb,0x5aca5aaa,0x630b5acb,0x630b630b,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x5aea62eb,0x62eb62eb,0x5aca5aca,0x5aca5aca,0x62eb5acb,0x5aca5aca,
-0x7bce738d,0x62eb6b2c,0x6b2c6b2c,0x83ef7b8d,0x7b8d6b4c,0x83ef7bce,0x7bad7b8d,0x8c2f9cb2,0x8c2f738d,0x8c2f9470,0x83ee840f,0x83ef83ef,0x83ef7bae,0x736d83ef,0x736d734c,0x6b2c7b8d,0x6b2c6b2c,0x6b0c6b2c,0x6b2c630b,0x630b6b4c,0x62eb62eb,0x6b0c62eb,0x62eb62eb,0x736d6b0c,0x6b2c630b,0x7bae736d,0x7bae738d,0x632b736d,0x630b630b,0x6b2c6b2c,0x6b2c6b2c,0x6b4c6b2c,
-0x6b2c6b4c,0x6b0b6b2c,0x6b2c62eb,0x62eb6b2c,0x6b0b6b0b,0x734c62ca,0x736c738d,0x6b0b6b0b,0x734c6b2c,0x6b2c736d,0x7b8d736d,0x736d734c,0x6b4c6b4c,0x734c6b2c,0x6b4c6b4c,0x7bae736d,0x6b4c736d,0x6b4c630b,0x630b6b4c,0x630b630b,0x5aca62cb,0x630b630b,0x62eb630b,0x6b2c6b2c,0x736d6b4d,0x7bae7bcf,0x734d736e,0x5aaa62eb,0x5aca5aaa,0x630b5aeb,0x52aa5aeb,0x62eb52aa,
-0x630c62eb,0x528962eb,0x5aaa528a,0x5aca5aca,0x5acb5aca,0x5aca5aaa,0x5acb62eb,0x630c5acb,0x62eb630c,0x5aaa5aaa,0x62eb5aaa,0x6b4d6b2c,0x6b2c6b2c,0x62eb630b,0x5aca62cb,0x5a895aaa,0x52695aaa,0x62eb5a89,0x62eb62eb,0x62cb62eb,0x5a8a5aaa,0x5aaa62ca,0x5aaa5aaa,0x5aaa5aaa,0x62cb5a8a,0x5aaa62cb,0x5aaa5aaa,0x62eb5aaa,0x5aaa62eb,0x5aca5aaa,0x5aaa5aaa,0x5aca5aaa,
-0x62eb5acb,0x52895acb,0x52895aaa,0x5aca5aaa,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x528a5aaa,0x5aaa5aaa,0x62eb5aca,0x62eb6b0c,0x62eb5aaa,0x630b6b2c,0x6b4c630b,0x62eb630b,0x62eb5aca,0x62eb6b0c,0x630b630b,0x5aaa62eb,0x5acb5aaa,0x630b630c,0x62eb630b,0x5aaa5aaa,0x630b5aaa,0x62eb630b,0x630b630b,0x5acb5aca,0x630b630b,0x6b2c6b2c,0x630b630b,0x6b4c6b2c,0x630c6b2c,
-0x630c6b2c,0x5aca5aca,0x62eb630b,0x62eb5aca,0x5aca62eb,0x62eb62ca,0x6b2c6b2c,0x62eb62eb,0x62eb62eb,0x62eb630b,0x62eb62eb,0x62eb62cb,0x5aaa62cb,0x5aca5aaa,0x5acb62eb,0x5aca5aca,0x630b5aeb,0x5aeb630c,0x5aaa5aeb,0x528a5aca,0x5aca5aeb,0x630b5aca,0x6b2c6b2c,0x5aca630b,0x5aea5aea,0x62eb5aea,0x630b62eb,0x630b630b,0x62eb62eb,0x5aca5aca,0x630b62eb,0x5aca62eb,
-0x7bad6b6c,0x6b2c738d,0x738d6b4c,0x736d738d,0x736d83ef,0x8c30736c,0x7b8d8c2f,0x94717bae,0x7bae83ef,0x8c508c0f,0x83ce83ef,0x83ef83ce,0x736d9450,0x7bae736d,0x736d736d,0x7bae734d,0x6b0c6b2c,0x6b2c6b4c,0x6b2c6b4c,0x632b6b2c,0x62eb630b,0x62eb5acb,0x6b2c630b,0x6b4c6b0c,0x6b2c7bce,0x630b6b0b,0x7b8d738d,0x630b736d,0x6b0b62ca,0x630b6b0c,0x6b2c5aca,0x736d6b0c,
-0x7bae734c,0x6b0c736d,0x734c6b0b,0x6b0c7b8d,0x62eb5aaa,0x6b2c6b0b,0x7bae734d,0x62eb6b0b,0x6b4c6b2c,0x738d736d,0x7bce734c,0x62eb7bae,0x62eb6b2c,0x6b4c6b2c,0x736d6b2c,0x6b6c738d,0x6b4c736d,0x6b2c6b2c,0x6b4c62eb,0x736d736d,0x62eb5aea,0x630c62eb,0x62eb6b2c,0x736d62eb,0x736d7bae,0x7bae736e,0x6b2c7bae,0x5acb62eb,0x5aaa5289,0x5aeb5aca,0x52aa5aca,0x52aa52aa,
-0x5aaa5aca,0x5aaa5acb,0x5aaa5aaa,0x62eb630c,0x5aaa5aaa,0x5aca62eb,0x5acb5aaa,0x5aaa5acb,0x62eb5aca,0x5aaa528a,0x5aaa5aca,0x736d62eb,0x62eb6b4d,0x6b2c630b,0x5aca5aca,0x5aca62eb,0x528a5aaa,0x630b5aaa,0x62eb630b,0x62ca5aaa,0x5aaa62eb,0x62ca5aaa,0x5aaa62ca,0x5aaa5a89,0x62aa5aaa,0x5aaa62ca,0x5aaa5aaa,0x5aaa5aaa,0x62cb62eb,0x5aaa62cb,0x5aaa5aca,0x5aaa5aca,
-0x5aca62eb,0x5aaa5aca,0x5aea5aaa,0x52895aea,0x5aaa5289,0x52a95aca,0x5aaa5289,0x5aaa5aaa,0x5aaa62cb,0x5aca5289,0x5aca62eb,0x62eb5aca,0x6b2c6b4c,0x6b2c6b2c,0x630b6b2c,0x62eb62eb,0x5aca5aca,0x5aca5aca,0x5aaa5aca,0x62eb5aaa,0x5acb62eb,0x62eb5aaa,0x62eb630b,0x62eb62eb,0x630b62eb,0x630b630b,0x630b62eb,0x62eb6b2c,0x6b4c62eb,0x630b630b,0x734c736d,0x62eb6b2c,
-0x630b630b,0x5aca62eb,0x62eb5acb,0x5aaa5aca,0x62eb62eb,0x630b5aaa,0x6b4c734c,0x630b6b4c,0x6b2c630b,0x62ca6b2c,0x62eb5aaa,0x6b0c62ca,0x5aaa5aaa,0x62eb5aca,0x62eb630b,0x5aeb5aea,0x62eb62eb,0x5acb62eb,0x5aca5aaa,0x5aaa5aca,0x5aca5aca,0x5aca5aca,0x62eb62eb,0x630b630b,0x62eb62eb,0x62eb6b2c,0x734d5aaa,0x736d6b4c,0x6b2c6b2c,0x5aca5aca,0x630b630b,0x5aca5aea,
-0x6b4c6b6c,0x7bae738d,0x738d736d,0x7bae7bae,0x840f736d,0x738d736c,0x94709470,0x7b8d840f,0x7bce8c30,0x83ef6b4c,0x8c0f9450,0x7b8d83ef,0x8c308c0f,0x7bae734c,0x734d734d,0x7b8d7b8d,0x734c7bae,0x734c6b2c,0x6b4c736d,0x6b4c6b4c,0x6b2c6b2c,0x5aaa630b,0x6b2c62eb,0x6b2c6b2c,0x736d736d,0x6b2c630b,0x736d734c,0x630b736d,0x6b4c5aca,0x62eb62eb,0x630b6b2c,0x736d6b2c,
-0x734c7b8d,0x734c7b8d,0x734c734c,0x7b8e7b8d,0x5aaa6b2c,0x6b2c62cb,0x734c734d,0x6b2c734c,0x6b2c6b2c,0x734c630b,0x630b736d,0x6b4c736d,0x6b2c630b,0x736d630b,0x6b4c6b6c,0x738d7bce,0x736d738d,0x630b6b2c,0x736d62eb,0x6b4c738d,0x630b6b2c,0x62eb5acb,0x630b6b2c,0x6b4c62eb,0x83cf83ef,0x6b2c7b8e,0x6b4d6b2d,0x52896b2c,0x5289528a,0x52aa5289,0x5aaa5aca,0x52aa52aa,
-0x5acb62eb,0x62eb5acb,0x528a62eb,0x5acb528a,0x528a62eb,0x62eb62eb,0x5aca528a,0x5aaa62cb,0x62eb5aca,0x5aca5aaa,0x62eb630b,0x630c630b,0x62eb630c,0x5acb5acb,0x5aaa5aca,0x62eb5aaa,0x62eb62eb,0x5aca62eb,0x62eb62cb,0x6b0b62eb,0x62ca62ca,0x5aaa62ca,0x5aaa5a8a,0x5aaa5aaa,0x62ca62aa,0x62cb62cb,0x62ca62ca,0x62eb62ca,0x5aca5aca,0x62cb62eb,0x5aaa5aca,0x5aaa5aaa,
-0x5aaa5aaa,0x5aaa5aaa,0x5aaa5289,0x52a95aca,0x5aaa52a9,0x5aaa5aaa,0x52895289,0x5aca5aaa,0x5aaa5aca,0x5aca5aaa,0x62eb62eb,0x630b62eb,0x6b2c630b,0x6b2c736d,0x6b2c630b,0x62eb630b,0x62eb62eb,0x5aca62eb,0x5aca5aca,0x5aaa5aaa,0x62eb5aaa,0x62eb62eb,0x6b2c630b,0x630b6b2c,0x62eb62ca,0x6b4c630b,0x6b2c6b2c,0x62eb6b2c,0x6b2c62eb,0x62eb630b,0x6b2c6b4c,0x630b62eb,
-0x630b62eb,0x5aca62eb,0x5aaa528a,0x630b5aca,0x62eb6b0c,0x6b2c5aca,0x62eb6b4c,0x62eb62eb,0x630b62eb,0x62cb6b0c,0x6b0b62ca,0x6b2c62eb,0x5aaa5aaa,0x5aca5aca,0x630b62eb,0x5aca5aeb,0x5aca5aeb,0x5acb5aca,0x5aaa5aca,0x5aeb5aca,0x5aeb5aeb,0x62eb62eb,0x62eb62ca,0x736d6b2c,0x62eb6b4c,0x5aca5aca,0x738d630b,0x6b4c736d,0x62eb632b,0x62eb5aca,0x630b62eb,0x5aea632b,
-0x6b4c736c,0x738d6b4c,0x7bae7bae,0x7b8d7b8d,0x736d6b2c,0x738d8c30,0x947183ce,0x83ee9491,0x8c2f7bad,0x736d7bce,0x9471840f,0x840f8c0f,0x83ef7bae,0x6b4c83ef,0x738d738d,0x734c6b4c,0x7bce7bae,0x6b4c736d,0x7bae738d,0x6b4c736d,0x630b6b4c,0x5aca62eb,0x62eb62eb,0x630b62eb,0x6b4c6b6c,0x62eb738d,0x736d736d,0x7bae734d,0x62eb734d,0x6b0b6b0b,0x6b2c6b2c,0x736d62eb,
-0x736d6b2c,0x83ce734d,0x736d736d,0x734c736d,0x6b2c6b2c,0x734c62ca,0x734c6b2c,0x734c6b0c,0x630b734c,0x6b2c6b2c,0x6b2c736d,0x83ef6b4c,0x6b4c7bae,0x738d6b4c,0x73ad738d,0x73ad736d,0x738d738d,0x6b4c736d,0x6b2c62eb,0x736d734c,0x6b6c736d,0x62eb630b,0x630b630c,0x630b62eb,0x7bae736d,0x62eb7b8e,0x62eb5aaa,0x5aca6b2c,0x5aca5289,0x5aaa5aca,0x5aeb5aca,0x52aa5aca,
-0x62eb62eb,0x6b0c62eb,0x6b2c6b4d,0x5aaa5aaa,0x5acb5acb,0x5aaa5acb,0x5aaa5aaa,0x5aaa5a8a,0x62eb5aaa,0x5aca5aca,0x630b630b,0x630b630c,0x630c62eb,0x5aaa62eb,0x5aca5aaa,0x5aca5aca,0x5aca5aaa,0x5aca62eb,0x62eb5aca,0x6b0b6b0b,0x62eb62eb,0x5aaa62cb,0x5aaa5a8a,0x62ca62ca,0x62cb62aa,0x62eb62ca,0x5aaa62ca,0x62ca62ca,0x5aca5aaa,0x62eb62cb,0x5aaa5aca,0x5aaa528a,
-0x5aaa5aaa,0x5acb5aaa,0x5aaa5aca,0x5aaa5aaa,0x5aca5aca,0x5aca5aca,0x52695aaa,0x5aaa5289,0x5aaa5aaa,0x62eb5aca,0x630b630b,0x6b2c6b0c,0x630b6b2c,0x6b2c6b2c,0x6b2c734c,0x6b0b6b0b,0x6b0c630b,0x62eb630b,0x62eb62eb,0x5aaa5aca,0x6b2c5acb,0x630b6b2c,0x630b630b,0x5acb630c,0x62ca62eb,0x6b2c62eb,0x62eb6b2c,0x62eb630b,0x630b62eb,0x630b630b,0x6b2c6b4c,0x62eb5aaa,
-0x630b5aea,0x5aca62eb,0x5aaa5aaa,0x6b2c5aca,0x630b6b2c,0x738d62eb,0x630b7bae,0x62eb62ea,0x62eb62eb,0x6b0c6b2c,0x62eb62eb,0x6b0b62eb,0x62eb5aca,0x5aca62eb,0x6b2c62eb,0x62eb632b,0x5aca5aeb,0x5aeb5aca,0x5aaa5aeb,0x5aeb5aca,0x5aca52aa,0x62eb5aca,0x6b2c62eb,0x83ef738d,0x6b2c7bae,0x62cb630b,0x6b2c62eb,0x62ca62eb,0x62eb630b,0x630b62eb,0x5aea5aca,0x5aea630b,
-0x7bad736c,0x6b4c736c,0x83ef7bae,0x738d7bae,0x6b4c738d,0x8c30736d,0x8c507bce,0x94709470,0x7bce8c0f,0x7bce8c0f,0x83ef6b4c,0x8c308c50,0x736d7bce,0x840f840f,0x7bae734c,0x6b2c736d,0x7bae6b4c,0x7bae7bce,0x83ef73ad,0x6b6c7bae,0x630b6b4d,0x630b62eb,0x62eb630c,0x630b5aca,0x6b2c6b2c,0x83ef736d,0x736d738d,0x734c736d,0x7b8d7bae,0x6b2c6b0c,0x6b2c630b,0x738d736d,
-0x83ce83ef,0x736d7b8d,0x7b8d83cf,0x6b2c736d,0x6b0c5aaa,0x62eb62eb,0x6b0b6b0c,0x6b2c6b2c,0x7bae736d,0x734c6b4c,0x734c6b4c,0x738d738d,0x738d7bce,0x736d6b2c,0x736d736d,0x6b6c6b6c,0x736d7bae,0x736d6b4c,0x6b2c6b2c,0x6b2c6b2c,0x738d6b4c,0x62eb6b4c,0x6b2c62eb,0x6b2c6b2c,0x630c6b2c,0x62eb6b0c,0x62eb62eb,0x630c630c,0x5aca5aaa,0x5aaa5aca,0x5aaa5aca,0x5aaa528a,
-0x630c62eb,0x6b2c62eb,0x736d736d,0x5aaa62eb,0x62eb5aaa,0x528a5acb,0x5aaa5aaa,0x5aaa5269,0x62eb5aaa,0x62eb62eb,0x630b62eb,0x630b630b,0x62eb5acb,0x5aaa5acb,0x62eb5aaa,0x5acb6b2c,0x62eb5aca,0x6b2c630c,0x62eb630b,0x5aaa62ca,0x62eb62eb,0x62cb62cb,0x62cb62cb,0x6b0b62eb,0x6b0c62eb,0x62eb62eb,0x62ca62eb,0x62eb6b0b,0x62eb62eb,0x62eb5aca,0x5aaa5aaa,0x5aca528a,
-0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aca,0x52895289,0x5aca5aca,0x62eb62eb,0x52895aca,0x52695269,0x5aaa5a8a,0x630b62eb,0x630b630b,0x630b630b,0x62eb6b4c,0x6b2c62eb,0x6b2c734c,0x6b0b62eb,0x630b630b,0x630b62eb,0x62eb630b,0x630b62eb,0x630c62eb,0x6b2c6b2c,0x630b630c,0x630b630b,0x630b6b2c,0x630b62eb,0x62eb630b,0x630b630b,0x62eb630b,0x734c6b0b,0x6b0b736d,0x5aca5aca,
-0x5aca5aca,0x5aca5aca,0x5aca62eb,0x62eb5aca,0x62eb62eb,0x736d630b,0x6b4c7bae,0x62ea630b,0x6b0b6b0b,0x734c736d,0x62eb62eb,0x62eb62eb,0x62eb62ca,0x5aca62eb,0x630b5aca,0x62eb630b,0x5aeb5aeb,0x5aeb5aeb,0x5aca5aca,0x5aca52aa,0x5aca5aca,0x62eb5aca,0x6b0c630b,0x738d6b4c,0x630b6b2c,0x62eb6b2c,0x62eb62eb,0x62eb630b,0x632b630b,0x5aca62eb,0x5aca62eb,0x5aca5aca,
-0x7bad736d,0x738d7bae,0x7bae736d,0x7bae83ef,0x736d7bae,0x7bae6b4c,0x8c2f9cb1,0x8c2f7bad,0x83ce9491,0x7bce736c,0x6b4c7bad,0x83ef7bce,0x7bae83ef,0x83ef6b2c,0x6b2c7bce,0x6b2c736d,0x6b4c734c,0x8c307bae,0x7bce7bce,0x738d7bce,0x738d738d,0x6b4c738d,0x6b4c6b4c,0x630b630c,0x736d736d,0x738d738d,0x6b2c7bae,0x734c6b2c,0x83ef734d,0x62eb736d,0x6b4c62eb,0x83ef7bae,
-0x8c308c30,0x7b8d83ef,0xad139450,0x62ca732c,0x6aeb62eb,0x6b0c6b0b,0x62eb62eb,0x6b0c734c,0x736d630b,0x6b4c6b2c,0x736d6b2c,0x738d7bce,0x738d734c,0x734c7b8d,0x738d6b2b,0x736c736c,0x6b4c738d,0x736d6b4c,0x6b4c6b4c,0x6b2c6b2c,0x738d736d,0x630b736d,0x630b62eb,0x6b4c6b2c,0x62eb6b2c,0x6b2c630c,0x630c6b4d,0x630c6b2c,0x5acb6b2c,0x52a95289,0x52895aca,0x5acb5269,
-0x62eb62eb,0x6b2c62eb,0x62eb62eb,0x62eb62eb,0x5aaa5aca,0x5acb5aaa,0x5acb5acb,0x5aaa5aaa,0x5aca5a8a,0x630b62eb,0x630b630b,0x62eb62eb,0x5acb630c,0x62eb5aaa,0x62eb62eb,0x62eb630b,0x62eb62eb,0x630b630b,0x62eb62eb,0x5aaa62ca,0x62cb62aa,0x6aeb62ca,0x6b0b6b0b,0x6b0c6b2c,0x732c62eb,0x6b0b6b0b,0x62eb62eb,0x6b0c734c,0x630b62eb,0x62eb62eb,0x5aaa5aaa,0x5aca5aaa,
-0x5aca5aca,0x52895aaa,0x5aaa52a9,0x5aaa5aaa,0x5aaa5289,0x62eb5aea,0x5aca5acb,0x52895aaa,0x5aca5a8a,0x630b630b,0x62eb630b,0x62eb62eb,0x62eb62eb,0x6b2c6b2c,0x6b2c6b2c,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x630b6b0b,0x6b2c630b,0x630b6b0b,0x6b0b630b,0x630b6b0b,0x6b2c6b0b,0x6b2c6b2c,0x6b2c630b,0x630b6b2c,0x630b630b,0x62ca630b,0x738d6b0b,0x62eb6b4c,0x62eb630b,
-0x5aaa62eb,0x5aca5aca,0x630b6b4c,0x5aca62eb,0x62eb62cb,0x62eb5aca,0x62eb630b,0x62ea62ea,0x62eb6b0c,0x6b2c734c,0x62eb62eb,0x62cb6b0b,0x62eb62eb,0x5aca62eb,0x5aca5aca,0x630b62eb,0x5aeb5aeb,0x5aca5aca,0x5aca5aca,0x5aeb5aca,0x5aeb630b,0x62eb62eb,0x62eb630b,0x630b62eb,0x6b2c6b2c,0x6b2c736d,0x62eb630b,0x5aca62eb,0x630b62eb,0x5aca5aca,0x5aca630b,0x5aca5aca,
-0x7bce7bad,0x7bae7bce,0x7bae7bae,0x83ce7bae,0x736d738d,0x736d736c,0x94708c0f,0x83ce7bad,0xa4f383ee,0x738d9471,0x738d7bce,0x7bce6b4c,0x7bce840f,0x6b2c83ef,0x83ce83ef,0x736d6b2c,0x736d734c,0x7bee736d,0x7bce840f,0x7bce738d,0x7bef7bce,0x6b6d7bce,0x736d6b4d,0x630c6b4c,0x736d6b2c,0x7b8e738d,0x7bae738d,0x6b2c62eb,0x734c6b0b,0x6b2c83ce,0x6b2c6b2c,0x83ef734c,
-0x8c2f8c0f,0x734d8bef,0xb555ad34,0x62eb7bae,0x62eb6b0b,0x736d62ca,0x6b0b6b0c,0x6b0b62cb,0x6b2c6b4c,0x6b4c738d,0x6b2c6b2c,0x736d6b4c,0x6b2c736d,0x736d7bae,0x7bad736c,0x736c6b2c,0x6b4c6b4c,0x736d736d,0x734c6b2c,0x6b4c736d,0x6b4c6b6c,0x6b2c6b2c,0x62eb630c,0x630b62eb,0x630b630b,0x630c6b2c,0x6b2c6b2c,0x62eb6b2c,0x630b6b2c,0x5aaa5aca,0x5aaa5aaa,0x5acb5aaa,
-0x5acb5acb,0x62eb62eb,0x5aca5aaa,0x5aaa5acb,0x5269528a,0x5acb528a,0x5acb62eb,0x5aca5a8a,0x5aca62eb,0x62eb62eb,0x630b62eb,0x5acb62eb,0x630c630c,0x62eb5aaa,0x630b6b2c,0x62eb62eb,0x62eb5aca,0x5aaa5acb,0x62eb5aca,0x62ca62eb,0x6aeb62aa,0x6b0c6aeb,0x6b0c6b2c,0x6aeb732c,0x6b2c62eb,0x62eb6b0b,0x62cb62ca,0x6b0b6b2c,0x630b62eb,0x62eb630b,0x5aaa5aaa,0x5aca5aaa,
-0x62eb5aca,0x5aca62eb,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5289,0x5aca5aaa,0x5aca5aca,0x5aaa5aaa,0x62eb5aca,0x630b630b,0x630b630b,0x6b0b6b0b,0x6b0b62cb,0x6b2c734c,0x734c6b2c,0x62ca6b0b,0x630b62eb,0x62eb62eb,0x6b2c6b0b,0x630b6b0b,0x6b2c6b2c,0x62eb6b2c,0x6b0b62eb,0x630b630b,0x6b2c6b0b,0x630b62eb,0x62eb6b0b,0x630b62eb,0x5aca62eb,0x736d630b,0x62eb630b,0x736d736d,
-0x5aca630b,0x62eb62eb,0x630c6b4d,0x5acb630b,0x5aca5aca,0x5aca5aca,0x5aaa5aca,0x630b5aca,0x62ca6b0c,0x62ca62eb,0x62eb62eb,0x62eb6b2c,0x62eb62eb,0x62eb62eb,0x5aca5aea,0x632b62eb,0x5aca5aca,0x5aca5aaa,0x5aeb62eb,0x6b2c5aeb,0x630b630b,0x630b630b,0x62eb630b,0x6b0c630b,0x630b630b,0x6b4c6b2c,0x62eb6b2c,0x62eb62eb,0x62eb630b,0x630b5aea,0x62eb62eb,0x5aca62eb,
-0x8c307bae,0x7bad840f,0x7bae83ce,0x83ce7b8d,0x7b8d83ce,0x736d736c,0x83ee7bce,0x7b8d9470,0xad33738d,0x9491c617,0x7bad736d,0x736d738d,0x7bce7bae,0x7bae7bce,0x7bae6b4c,0x6b2c83ef,0x73ad6b4c,0x6b4c6b6c,0x7bef7bce,0x7bce73ae,0x7bae7bef,0x6b6d738d,0x6b6d736d,0x6b4c632c,0x630c6b4d,0x738d6b4c,0x6b2c6b0b,0x6b0b83cf,0x6b0b62eb,0x7b8d734c,0x62eb7b8d,0x6b2c6b4c,
-0x83ae7b8d,0x8c0f736d,0x9471b554,0x6b0b6b2c,0x5aaa62aa,0x6b0b62ca,0x6b0b736d,0x6b0b62ca,0x734c6b4c,0x736d6b2c,0x6b2c7bae,0x736d738d,0x6b2c736d,0x738d6b2b,0x6b4c7bce,0x6b2b738d,0x6b4c736c,0x734c6b2c,0x7bae736d,0x6b2c738d,0x62eb630b,0x6b2c630b,0x6b2c6b4c,0x630b630b,0x630b630c,0x5aaa62eb,0x6b4d62eb,0x5acb6b4d,0x62eb5acb,0x5aca62eb,0x5aca5aaa,0x5aaa5aaa,
-0x5aaa5a8a,0x5aaa62cb,0x5acb5aaa,0x5aaa62eb,0x5aaa528a,0x5aaa528a,0x62eb62eb,0x62cb5289,0x62eb630b,0x5aaa62eb,0x62eb5aaa,0x62eb62eb,0x630c5acb,0x630c62eb,0x6b4c6b2c,0x6b2c736d,0x6b2c6b2c,0x5aca62eb,0x62eb5aca,0x62ca62eb,0x6b2c62eb,0x6b2c6b0c,0x6aeb6b2c,0x62eb6b0c,0x6b2c6b0c,0x6b0b6b2c,0x62ca62cb,0x6b0b62eb,0x62eb62eb,0x5aaa62eb,0x5a8a5aaa,0x5aaa5aaa,
-0x5aca5aaa,0x62cb62eb,0x5aaa5aaa,0x52a95aca,0x5aaa5aca,0x5aaa5aaa,0x528a5aaa,0x5aca5aaa,0x62eb62eb,0x630b62eb,0x630b630b,0x6b0c6b0b,0x62eb62eb,0x734c6b2c,0x6b4c736c,0x62ea62eb,0x6b0b62eb,0x62eb62eb,0x6b4c6b2c,0x62eb6b0b,0x630b630b,0x62eb630b,0x6b0b62eb,0x630b630b,0x6b2c6b4c,0x630b62eb,0x62eb6b0b,0x6b2c62eb,0x5aaa5aca,0x6b2c62eb,0x630b630b,0x6b4c6b4c,
-0x5aea62eb,0x62eb5aca,0x630b630b,0x5aca5acb,0x5aca5aaa,0x62eb62ca,0x62ea630b,0x630b62ea,0x5aaa62eb,0x5a8a62ca,0x62eb62cb,0x62eb734c,0x62ca62eb,0x62ca5aca,0x5aea62eb,0x62eb62ea,0x5aeb5aca,0x5aeb5aca,0x630b630b,0x6b2c62eb,0x630b630b,0x630c6b2c,0x62eb630b,0x630b62eb,0x62eb62eb,0x6b2c62eb,0x630b630b,0x62eb630b,0x62eb630b,0x632b62eb,0x62eb630b,0x5aca62eb,
-0x94507bad,0x7bce9471,0x83ce7b8d,0x83ce83ee,0x8c2f8c0f,0x7bce7bae,0x7bae7bad,0x8c5083ce,0x8c30736c,0xbd95b574,0x736c8c30,0x7bae7bce,0x7b8d736d,0x738d83ef,0x6b4c738d,0x83ef7bae,0x6b4c738d,0x6b4c736d,0x7bce6b6d,0x7bce8430,0x738d7bce,0x6b6d736d,0x738d738d,0x6b4c6b4c,0x736d736d,0x7b8e736d,0x7b8d734d,0x734d734c,0x6b0b6b2c,0x6b0b62eb,0x736d736d,0x62eb62eb,
-0x7b8d6b2b,0x6b2c7b8d,0x6b2c8bef,0x62ca5a8a,0x6b0b6b0b,0x734c6b2c,0x734c6b0b,0x630b6b0b,0x736d6b4c,0x736d6b2c,0x7bae7bae,0x6b4c6b2c,0x6b2c6b4c,0x736d734c,0x7bad7bce,0x738d840f,0x6b2c6b4c,0x738d6b2c,0x738d736d,0x6b2c736d,0x6b2c6b4c,0x630c6b2c,0x6b2c630b,0x62eb6b2c,0x630b62eb,0x5acb6b2c,0x62eb5acb,0x6b4d6b4d,0x5aaa6b2c,0x5aca5289,0x5acb62eb,0x62cb5aaa,
-0x5aaa5aaa,0x52695aaa,0x528a5aaa,0x630c5aaa,0x5acb62eb,0x528a5acb,0x62eb528a,0x5aaa62eb,0x62eb5aca,0x5aaa630b,0x62eb528a,0x62eb62eb,0x630b6b2c,0x736d630c,0x630c6b2c,0x6b2c738d,0x6b2c738d,0x5aca62eb,0x5aaa5aaa,0x6b0b62cb,0x6b0c6b0b,0x732c6aeb,0x62ca6b0c,0x6b0b6b0b,0x6b0b6b0c,0x6b0b6b0b,0x5aaa62cb,0x6b0b62ca,0x5aaa630b,0x52895289,0x528a5aaa,0x528a5aaa,
-0x5aaa5aca,0x5aca5aaa,0x5aca5aaa,0x62eb630b,0x5aca62eb,0x5aca5aca,0x52895aaa,0x62eb5aaa,0x62eb630b,0x630b62eb,0x6b2c6b2c,0x6b0b6b0b,0x62cb62ca,0x6b2c6b2c,0x62eb6b2b,0x6b0b62ea,0x62eb6b0b,0x62eb62ca,0x6b2c6b2c,0x630b630b,0x62eb630b,0x62ca630b,0x62eb62ca,0x62eb62eb,0x630b6b2c,0x630b5aca,0x5aca6b0b,0x62eb5aca,0x5aaa62ca,0x62eb5aca,0x6b2c6b0b,0x5aca5aca,
-0x62eb62eb,0x630b5aaa,0x6b2c62eb,0x5aca5aca,0x5aaa5aaa,0x5aca5aca,0x6b0b630b,0x5aca62ea,0x62ca5aca,0x5aaa62eb,0x62cb62cb,0x62eb6b2c,0x630b6b2c,0x62eb62eb,0x630b630b,0x5aca5aca,0x630b5aca,0x62eb630b,0x630b630b,0x5aeb5aeb,0x630b5aeb,0x630b630b,0x630b630b,0x62eb630b,0x6b0c6b2c,0x62eb62cb,0x6b4c62eb,0x5aca6b2c,0x630b62eb,0x630b5aea,0x62eb6b2c,0x5aea5aca,
-0x7bae7b8d,0x94709450,0x83ce7b8d,0x9c919cb1,0x83ee8c0f,0x83ce83ee,0x7b8d83ae,0x7bae736d,0x7b8d8c30,0x840f738d,0x738d840f,0x738d6b4c,0x6b4c738d,0x7bce736d,0x7b8d83ef,0x7bce6b4c,0x736d8c30,0x73ad736d,0x736d736d,0x8c507bce,0x7bae738d,0x738d7bae,0x738d7bae,0x6b2c6b2c,0x738d738d,0x738d6b4d,0x736d83ce,0x7bae6b2c,0x6b2c7bce,0x62eb6b0b,0x83ee734c,0x62ea736d,
-0x6b0b6b0b,0x630b734c,0x62eb62eb,0x5aca5a89,0x6b2c62ca,0x6b2c734c,0x6b2c6b2c,0x62eb6b4c,0x6b4c630b,0x6b2c6b4c,0x7bce6b4c,0x6b4c73ad,0x630b6b2c,0x738d736d,0x7bce6b4c,0x736c840f,0x734d6b4c,0x7bae7bae,0x738d736d,0x736d6b2c,0x736d736d,0x6b2c630b,0x6b2c736d,0x630b6b4c,0x62eb5acb,0x6b4c6b2c,0x630c6b2c,0x62eb630c,0x5aaa6b4c,0x5aaa528a,0x6b2c630c,0x5aaa5acb,
-0x630c62eb,0x5acb62cb,0x528a5aaa,0x5acb5aab,0x5aab528a,0x5aaa5aab,0x5aaa5aaa,0x62eb5aca,0x62eb5aaa,0x62eb6b2c,0x5aca5aaa,0x62eb62eb,0x736d62eb,0x736d7b8e,0x734c734c,0x630b6b2c,0x6b2c734c,0x62ca62eb,0x6b0b62ca,0x62cb6b0c,0x62eb62ca,0x62ca62eb,0x6b0b62cb,0x62eb630b,0x6b0b62ca,0x62eb62ca,0x5aaa62eb,0x6b0b62eb,0x62ca6b2c,0x52695a8a,0x5aaa5269,0x5aca5aaa,
-0x5aca62eb,0x5aca5289,0x5aaa5aaa,0x630b62eb,0x5aaa630b,0x62ca5aaa,0x52a95aaa,0x62eb5aca,0x6b0b62ca,0x6b0b6b2c,0x6b0b62eb,0x62eb6b0b,0x62eb630b,0x630b62eb,0x630b630b,0x5aca62ca,0x6b0c62eb,0x6b0c6b0c,0x5aca62eb,0x6b2c62eb,0x6b2c630b,0x5aea630b,0x62eb5acb,0x6b2c62eb,0x62eb6b2c,0x630b62eb,0x5aaa62eb,0x5aca5a89,0x5aca5aca,0x62eb5aca,0x630b630b,0x5aaa62eb,
-0x5aca5aaa,0x5acb5aaa,0x5aca62eb,0x5aaa5aca,0x62eb5aaa,0x5aca5aca,0x5aaa5aca,0x5aaa5aca,0x62eb5aaa,0x5aca5aca,0x62eb5aca,0x6b0b6b2c,0x630b62eb,0x62eb630b,0x630b5aea,0x52aa630b,0x5aeb5aeb,0x5aeb5aeb,0x62eb630b,0x5aaa5aca,0x6b2c5aca,0x62eb6b0b,0x630b62eb,0x5aca62cb,0x5aca5aca,0x62eb62eb,0x6b4c62eb,0x62eb736d,0x62eb62eb,0x62eb62eb,0x62eb630b,0x5aca62eb,
-0x83ce7b8d,0x8c0f8c0f,0x83ee83ee,0xad339450,0x7b8d9450,0x83ee83ce,0x83ce7bae,0x734c83ae,0x83ef7bae,0x736d7bae,0x7bae7bae,0x6b4c736d,0x7bce738d,0x738d734c,0x7b8d83ef,0x6b4c736d,0x840f842f,0x738d7bae,0x736d736d,0x7bae6b4c,0x7bcf8c50,0x7bce83ef,0x736d7bae,0x736d738d,0x7bae736d,0x6b4c738d,0x7bce738d,0x738d7bce,0x9cb28c30,0x6b2c736d,0x734c734c,0x6b4c7bae,
-0x6b0b5aaa,0x5aca5aaa,0x62eb62eb,0x5aaa630b,0x5aca5aca,0x6b2c6b4c,0x6b2c6b2c,0x630b62eb,0x630b6b6c,0x6b4c6b4c,0x738d6b4c,0x83ef83ef,0x6b2c736d,0x736c6b4c,0x738d736d,0x7bae7bce,0x736d6b2c,0x736d736d,0x6b0c6b4c,0x736d736d,0x6b2c6b4c,0x6b4c6b2c,0x62eb736d,0x6b2c630b,0x5acb630c,0x6b4c62eb,0x630c736d,0x62eb5acb,0x6b2c736d,0x5aaa62eb,0x630c5acb,0x5acb62eb,
-0x6b0c62eb,0x6b0c6b2c,0x5aaa5aaa,0x5acb62ec,0x62eb62eb,0x5acb62eb,0x52aa5acb,0x5aaa528a,0x526962eb,0x62eb5aaa,0x5289528a,0x62eb62eb,0x6b2c62eb,0x736d736d,0x734c736d,0x6b0b6b0b,0x736d736d,0x62cb6b2c,0x62eb62ca,0x62eb6b0b,0x62eb62eb,0x62eb62eb,0x62ca62eb,0x62eb62eb,0x630b62ea,0x6b0c62eb,0x62eb6b0b,0x734c6b2c,0x6b0b734c,0x5aaa62eb,0x52695289,0x52895289,
-0x62eb62eb,0x62eb5aca,0x5aaa62eb,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5289,0x630b5aea,0x62eb630b,0x62eb62eb,0x6b0b62eb,0x62eb62eb,0x630b630b,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x6b0c630c,0x6b2c630b,0x62eb6b2c,0x5aca62eb,0x630b62eb,0x62eb630b,0x630b62eb,0x630b5aeb,0x62eb630b,0x5aca62eb,0x5aca5aca,0x5aaa5aaa,0x5aca5aca,0x62eb5aca,0x5aca5aca,0x62eb5aca,
-0x62eb5acb,0x5aca5aca,0x5aaa5aca,0x5aca5aca,0x5aca5aaa,0x62ca5aca,0x5aca62eb,0x5aaa62eb,0x62eb5aca,0x5aca62eb,0x630b62cb,0x6b0b6b0c,0x62eb62eb,0x5aea62eb,0x5aea5aca,0x5aaa5aea,0x5acb52aa,0x62eb62eb,0x5aca5aeb,0x62eb5acb,0x630b62eb,0x62eb630b,0x62eb62eb,0x5aca62ca,0x62eb5aaa,0x6b2c6b2c,0x630b62eb,0x6b2c6b2c,0x5aca5acb,0x62eb5aca,0x630b630b,0x5acb62eb,
-0x7b8d7b8d,0x8bef8c0f,0x83ee83ee,0x942f83ce,0x83ee9470,0x7bad7bad,0x7bad83ae,0x7b8d7b6d,0x7bae736d,0x734c7bae,0x7bae6b4c,0x736d7bce,0x7bae6b4c,0x736d7bae,0x7bce738d,0x734c7bae,0x9cb2738d,0x736d8c30,0x738d6b2c,0x6b2c6b2c,0x9471842f,0x83ef738d,0x736d7bae,0x736d7bae,0x738d736d,0x738d73ad,0x7bae6b4c,0x7bae83ef,0x94717bce,0x736d9470,0x738d83ef,0x734c734c,
-0x62eb6b2c,0x5aca62eb,0x62eb5aaa,0x6b2c630b,0x630b62eb,0x738d62eb,0x734c7bae,0x630b6b4c,0x6b4c6b4c,0x6b2c632b,0x6b2c736d,0x8c507bce,0x7bae83ce,0x736c6b2c,0x736d736c,0x7bce736c,0x734d738d,0x6b0c736d,0x6b4c734d,0x7bce734d,0x736d7b8e,0x6b0c6b4c,0x62eb6b0c,0x62eb630b,0x6b2c62eb,0x62eb62eb,0x6b2c736d,0x630c62eb,0x6b4d630c,0x62eb6b4d,0x62eb5aaa,0x736d6b2c,
-0x738d6b4c,0x5aaa6b0c,0x5aca5aca,0x7bae6b2c,0x630c738e,0x5aaa5aaa,0x5aca62eb,0x5aca5aaa,0x62eb62eb,0x62eb62eb,0x5acb62eb,0x62eb5aca,0x62eb62cb,0x6b2c630b,0x734c734c,0x734c6b2c,0x736d6b4c,0x630b736d,0x6b0b62ca,0x6b2c734c,0x6b0b62eb,0x62eb6b0b,0x5aca5aca,0x5aea5aca,0x6b0b62eb,0x6b0b6b0b,0x6b0b62eb,0x7bae7b8d,0x6b2c734c,0x62eb630b,0x5aca5aca,0x62eb5aeb,
-0x62eb5aca,0x5aca62ca,0x5aaa630b,0x5aaa5aaa,0x5aca5aaa,0x52895289,0x6b2c62eb,0x630b630b,0x62eb6b0b,0x734c6b0b,0x6b0b6b4c,0x62eb630b,0x62eb62eb,0x62ca62eb,0x62eb5aca,0x630b62eb,0x62eb62eb,0x62cb5aca,0x62eb62eb,0x5aaa62eb,0x630b62ca,0x630b6b2c,0x62eb62eb,0x5aca5aca,0x62eb62eb,0x5aaa62ca,0x62eb5aaa,0x5aaa5aca,0x5aaa5aca,0x62eb5aca,0x5aaa5acb,0x62eb5aaa,
-0x630b5acb,0x5acb62eb,0x5aca5acb,0x5aca5aca,0x5aca5aaa,0x5acb5aca,0x5aca62ca,0x5aca62ca,0x5aca5aca,0x5aca62eb,0x6b0c62eb,0x62eb6b0b,0x62eb62ca,0x5aea62eb,0x5aca5aca,0x5aca5aea,0x5acb5aca,0x5aeb5aeb,0x630b62eb,0x630b630b,0x62eb5aca,0x630b630b,0x5aaa62eb,0x6b0c62cb,0x62eb630b,0x630b62eb,0x630b630b,0x630b630b,0x62eb630b,0x62eb5acb,0x62eb62eb,0x62eb62eb,
-0x734c7b8d,0x83ce83ce,0x83ce7b8d,0x7bad83ee,0x94508c2f,0x83ce83ee,0x8bef8c2f,0x7bae7b6d,0x6b2c736d,0x7bae736d,0x738d736d,0x7bae7bce,0x6b4c736d,0x738d7bae,0x7bae6b4c,0x840f83ef,0x7bee736d,0x7bce840f,0x6b4c6b2c,0x6b4c738d,0x7bce738d,0x7bae8c30,0x738d7bce,0x736d736d,0x6b4c73ad,0x73ad736d,0x734c736d,0x7bce7bae,0x6b4c736d,0xa4d2a4f3,0x8c0f83ee,0x6b2b736d,
-0x6b4c7b8d,0x5aaa5aaa,0x5aca5aca,0x62eb62eb,0x62eb630b,0x7b8d6b0b,0x7bae7bce,0x630b6b2c,0x6b2c630b,0x630b6b2c,0x736d630b,0x83ef6b2c,0x83ef840f,0x6b2c7bad,0x736c738d,0x736c736d,0x738d7bae,0x736d734d,0x736d6b4c,0x840f8c30,0x738d840f,0x630b734d,0x630b630b,0x630b6b2c,0x630c62eb,0x62eb6b2c,0x6b2c62eb,0x6b4d6b4d,0x6b4d6b2c,0x6b2c736d,0x5aaa5acb,0x6b4d62eb,
-0x6b0c738d,0x5aaa5aca,0x5aaa5aaa,0x6b2c62eb,0x5acb6b2c,0x5aca528a,0x62eb630b,0x5aaa5aaa,0x6b2c5aaa,0x5acb630c,0x62eb62eb,0x5aca5aaa,0x62eb62cb,0x62eb62ca,0x6b2c6b0b,0x734d734c,0x6b2c6b4c,0x6b2c6b2c,0x734c62eb,0x734c7b8e,0x62eb62cb,0x62cb62eb,0x5aaa5aca,0x5aca5aca,0x62eb62ca,0x6b0b62eb,0x6b0b62eb,0x7bae7b8d,0x736d7b8d,0x630b630b,0x62eb630b,0x630b632c,
-0x62eb62eb,0x5aaa62eb,0x5aaa630b,0x5aaa5aaa,0x5aca5aca,0x5aaa5aaa,0x630b62ca,0x6b0b630b,0x62eb6b0b,0x736d6b2c,0x6b4c736d,0x62eb6b0b,0x62eb62eb,0x62eb62eb,0x62eb5aca,0x630b62eb,0x62eb62eb,0x5aca5aca,0x62eb62cb,0x62eb630b,0x5aca5aaa,0x630b630b,0x5acb62eb,0x62eb5aca,0x5aaa62eb,0x5aaa5aaa,0x62eb5aaa,0x62cb5aca,0x5aaa62eb,0x5aca5aaa,0x5aca62eb,0x5aca5aaa,
-0x62eb5aca,0x5aca5acb,0x5aca5acb,0x5aca5aca,0x62eb5acb,0x5aca5acb,0x5aca5aca,0x62ca5aca,0x5aaa5aca,0x5aca5aca,0x6b2c62eb,0x6b0b6b0b,0x62eb5aca,0x62eb630b,0x62eb5aca,0x5aca62eb,0x5aca5aca,0x5aeb5aca,0x630b5aeb,0x5aca62eb,0x5aaa5aca,0x62eb5aaa,0x62eb62eb,0x630b62eb,0x630b630c,0x62eb62eb,0x62eb62eb,0x630b62eb,0x630b630b,0x62eb630b,0x62eb62eb,0x5aca5acb,
-0x7b6d7b8d,0x7b8d734c,0x83ee83ce,0x8bee83ee,0x83ee7b8d,0x83ce8c0f,0x7bad7b8d,0x7bae83ce,0x6b2c734d,0x738d6b2c,0x736d7bae,0x7bae736d,0x738d7bce,0x738d6b4c,0x736d738d,0x8c5083ef,0x6b4c83ee,0x7bad6b2c,0x734c83ef,0x7bae6b4c,0x736d6b4c,0x8c5083ef,0x738d7b8d,0x736d6b4c,0x734c7bae,0x738d6b4c,0x7bae7b8d,0x738d7b8d,0x7bce83ef,0x8c2f7b8d,0x83ceb574,0x736c6b2b,
-0x7bce736c,0x5aca736d,0x62eb62eb,0x5aca5aaa,0x6b0b62eb,0x7b8d734c,0x7bae7b8d,0x6b2b6b2c,0x6b2c62eb,0x738d630b,0x736d736d,0x736d738d,0x83ce7b8d,0x7bae7bae,0x7bad6b4c,0x736c738d,0x7bce630b,0x6b2c736d,0x6b4c6b2c,0x840f7bce,0x736d8410,0x6b2c6b4d,0x62eb6b2c,0x736d6b2c,0x630c736d,0x7bae736d,0x6b2c630c,0x7bce7bcf,0x6b4d738e,0x630c6b2c,0x5acb630b,0x5acb5acb,
-0x5aaa6b2c,0x5aca5aaa,0x5aaa5aca,0x528a528a,0x52895289,0x5aaa5aaa,0x5aca5aca,0x5aaa5aaa,0x5acb62eb,0x5acb5acb,0x5acb5acb,0x5aca5aca,0x5aca62eb,0x62cb5aca,0x630b62eb,0x62eb6b0b,0x62eb630b,0x6b2c630b,0x736d734c,0x6b0b734c,0x62ca62eb,0x62cb62ca,0x5aaa62ca,0x5aca5aaa,0x5aaa62ca,0x6b0b62ca,0x62eb6b0b,0x736d6b2c,0x734d736d,0x62cb62eb,0x5aca5acb,0x5aca5aeb,
-0x62eb5aca,0x62cb6b0c,0x5aca6b2c,0x5aaa5aaa,0x5aaa62ca,0x62eb5aaa,0x62eb62eb,0x6b2c6b2c,0x6b0b6b0b,0x736d6b2c,0x6b4c734c,0x6b2c6b4c,0x630b62eb,0x62eb630b,0x62eb62eb,0x62eb62eb,0x630b62eb,0x62eb62eb,0x62eb62eb,0x5aca62eb,0x5aca5aca,0x62eb62eb,0x62eb5acb,0x5aeb5aeb,0x5aaa5aca,0x528a5aaa,0x62eb5aaa,0x62eb62eb,0x62eb6b2c,0x52895aaa,0x5acb5aaa,0x5aaa5acb,
-0x5aca5aca,0x5aaa5aaa,0x5aca5aca,0x5aca5aaa,0x62eb62eb,0x5aca62eb,0x5aca5aaa,0x630b62eb,0x5aca62eb,0x5aca5aca,0x6b4c62eb,0x6b0b6b0b,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x62eb630b,0x62eb5aca,0x62eb630b,0x62eb62eb,0x5aca5aea,0x5aca5aca,0x5aca5aaa,0x62eb5aca,0x5aca62eb,0x6b2c6b2c,0x62eb630b,0x630c630b,0x6b2c630c,0x630b5acb,0x630c6b2c,0x62eb62eb,0x5acb62eb,
-0x7b8d736c,0x736c734c,0x8bef83ce,0x8bee83ee,0x7bad83ee,0x8bef83ce,0x736d7b8d,0x83ef83cf,0x734c736d,0x6b4c6b4c,0x7bae738d,0x6b2c736d,0x7bce738d,0x6b6c738d,0x738d738d,0x7bce738d,0x840f8c0f,0x734c7bae,0x7bae8c30,0x7b8d6b4c,0x6b4c738d,0x8c0f734c,0x6b4c8c30,0x736d7bae,0x7bae738d,0x7bae7bae,0x7bce7bce,0x736d7bae,0x8c0f736d,0x7b8d8c0f,0x94708c0f,0x7b8d736d,
-0x7b8d6b4c,0x7bce9471,0x62eb630b,0x630b5aaa,0x738d62eb,0x7bce7bae,0x6b4c738d,0x736c738d,0x630b630b,0x73ad62eb,0x6b6c83ef,0x738d7bae,0x734c6b2c,0x738d7bce,0x736c736d,0x736d7b8d,0x734d736d,0x7bae7bae,0x736d6b2c,0x7b8e736d,0x6b2c7b8e,0x6b2c6b2c,0x6b0c734d,0x6b2c6b2c,0x630b6b2c,0x6b4d630c,0x630b6b2c,0x736d6b2c,0x6b2c6b4d,0x62eb630b,0x630c630c,0x62eb630c,
-0x5aca5aca,0x5aaa5aaa,0x62cb62cb,0x5aca5aaa,0x5aaa5289,0x5aaa5aaa,0x5aca5aca,0x5aca5aca,0x5acb62eb,0x5acb5aaa,0x630b630c,0x62eb62eb,0x5aaa62eb,0x62eb5aaa,0x62eb62eb,0x62cb62cb,0x6b0b62eb,0x630b62eb,0x736d7b8e,0x62ca62ca,0x6b0b62eb,0x62ca6b0b,0x630b5aca,0x5aca62eb,0x62ca62eb,0x62ca62ca,0x62eb62cb,0x62eb6b0b,0x62eb62eb,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aca,
-0x62eb5aca,0x630b630b,0x630b630b,0x5aaa5aca,0x52895aca,0x6b0b5aaa,0x630b6b0b,0x6b2c6b2c,0x6b0c6b0b,0x734c6b4c,0x6b4c6b4c,0x630b6b4c,0x630b630b,0x630b630b,0x62eb630b,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x630b630b,0x62eb630b,0x62ca6b2c,0x5aca5aca,0x62eb5aca,0x5aaa5aca,0x5aaa5aaa,0x528a5aca,0x630b5aaa,0x62eb630b,0x62eb630c,0x528a5aca,0x5aaa528a,0x5aca5aaa,
-0x5aaa5aaa,0x5aca5aca,0x5aca62eb,0x5aaa528a,0x5aca5acb,0x5aaa5aca,0x5aca5aaa,0x6b2c62eb,0x5aca62eb,0x5aca5aca,0x6b2c630b,0x630b630b,0x62ca630b,0x630b62ca,0x62eb630b,0x630b630b,0x630b62eb,0x62eb630b,0x62eb62eb,0x5aaa5aea,0x5aca52a9,0x5aca62eb,0x5aaa5aaa,0x62eb5aca,0x630b630b,0x630b630b,0x6b4d6b2c,0x6b2c6b4d,0x6b2c62eb,0x630b6b2c,0x62eb62eb,0x62eb62eb,
-0x734c734c,0x6b2c734c,0x83ce734c,0x8c0f8c0f,0x83ae8c0f,0x83ae734c,0x83ce8c2f,0x736d7b8d,0x736d7b8d,0x6b4c734c,0x7b8d6b4c,0x6b2c7bae,0x7bae6b2c,0x736d840f,0x738d6b4c,0x73ad736d,0x8c3083ef,0x7bad9cb1,0x7bce6b4c,0x734c83ee,0x6b4c7b8d,0x7b8d734c,0x840f7bce,0x738d736d,0x7bae7bae,0x7bce7bce,0x7bae7bae,0x7bae7bae,0x7bae736d,0x840f840f,0x7bce7bae,0x7bce9c91,
-0x736c736c,0x8c0f7bad,0x6b0b7b8d,0x5aca6b2c,0x6b4c630b,0x7bae83ef,0x6b4c6b4c,0x736d6b2b,0x62eb6b4c,0x6b2c6b4c,0x73ad7bae,0x73ad6b4c,0x6b4c6b2c,0x7bae736d,0x738d736d,0x736d736d,0x736d6b4d,0x736d6b4c,0x630b736d,0x630b62eb,0x6b4d6b2c,0x630c6b2c,0x6b2d6b4d,0x5acb6b2c,0x6b2c5acb,0x62eb630b,0x630c6b2c,0x630c5acb,0x6b4d630c,0x6b2c6b2c,0x62eb630b,0x630b630c,
-0x528962eb,0x630b62eb,0x5aaa5289,0x52695aca,0x5aaa5a8a,0x62eb5aca,0x6b0b630b,0x5aca62eb,0x62eb5aaa,0x5aaa5aaa,0x630c630c,0x62cb5aca,0x5aaa62eb,0x5aca5aaa,0x62eb5aca,0x630b630b,0x6b2c630b,0x630b630b,0x6b4c736d,0x62eb62ca,0x6b0b5aaa,0x5aaa6b0b,0x630b5aaa,0x5aca630b,0x62eb62eb,0x5aaa62eb,0x6b2c62cb,0x62ca6b0b,0x62ca62ca,0x5aaa62cb,0x5aaa5289,0x52aa52aa,
-0x62eb630b,0x6b2c630b,0x6b2c5aca,0x528962ca,0x5aca5aaa,0x6b2c62eb,0x6b2c6b2c,0x630b6b0b,0x6b0b630b,0x6b4c6b4c,0x6b4c6b4c,0x62eb6b2c,0x630b6b2c,0x630b630b,0x62eb630b,0x62eb62cb,0x630b630b,0x62eb62eb,0x630b630b,0x6b2c6b2c,0x5aaa62eb,0x5aca5aca,0x62eb5aca,0x5aca5aeb,0x5aca5aaa,0x5aaa5aca,0x62eb5aaa,0x62eb62eb,0x62eb62eb,0x5acb62eb,0x5aaa5aaa,0x5aaa5aaa,
-0x5aaa5aaa,0x62eb5acb,0x5aca62eb,0x62eb5aaa,0x5aaa62eb,0x5aaa5aaa,0x5aca5aaa,0x62eb5aca,0x5aca5aaa,0x62eb5aca,0x62eb630b,0x62eb630b,0x62eb630b,0x630b62eb,0x6b2c630b,0x630b6b0b,0x62eb62eb,0x5aca62ca,0x62ea5aca,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x630b62eb,0x630b630b,0x62eb5aca,0x6b4c6b2c,0x6b4c6b2c,0x736d738d,0x6b2c6b4c,0x62eb630b,0x62eb62eb,0x5acb62eb,
-0x6b2b736d,0x7b8d7b6d,0x7b8d736c,0x83ee7b8d,0x945083ce,0x7b8d83ce,0x8c2f83ef,0x736d83cf,0x738d736d,0x6b2c6b4c,0x6b4c736d,0x7bce734c,0x736d738d,0x83ef7bce,0x6b2c6b4c,0x7bce7bee,0x840f736d,0x7bae9491,0x738d6b2c,0x83ce738d,0x736c6b4c,0x736d83ef,0x83ef6b2c,0x734c83ef,0x7bae83ce,0x7bae7bae,0x736d736d,0x7b8d7bae,0x6b2c7b8d,0x94707bae,0x6b2c7bae,0xa4d283ce,
-0x736c6b2b,0x738d6b4c,0x7bae83ef,0x6b2c6b2c,0x6b4c630b,0x7bae7bae,0x62eb738d,0x6b4c6b2b,0x7bce738d,0x738d6b4c,0x738d6b4c,0x736d840f,0x736d736d,0x736d734c,0x7bae7bce,0x734c736d,0x738d736d,0x736d83ef,0x738d736d,0x6b2c6b4d,0x6b4d630c,0x6b2c6b2c,0x630c6b4d,0x630c6b2c,0x62eb5aca,0x630c630c,0x6b2c630c,0x630b630c,0x6b4d630c,0x6b4d6b4c,0x62eb6b2c,0x630c6b2c,
-0x5aca630b,0x62eb62eb,0x5aaa5aaa,0x5aca5aca,0x5aaa5aaa,0x5aca5aaa,0x630b62eb,0x6b2c632b,0x5acb5acb,0x62cb62cb,0x5acb5aaa,0x62eb62eb,0x62cb62eb,0x5aca62cb,0x630b5aca,0x630b6b2c,0x6b4c738d,0x630b6b2c,0x630b62ca,0x630b6b4c,0x5aaa5a8a,0x5a8a5aaa,0x52895289,0x62eb5aca,0x5aca62ca,0x6b0b62ca,0x6b2c734c,0x62ca62ca,0x5aaa62ca,0x52895aca,0x5aaa5289,0x52aa52aa,
-0x5aaa5acb,0x6b2c62cb,0x736d5aca,0x5a89630b,0x630b5289,0x6b2c6b2c,0x6b0b6b2c,0x6b2c630b,0x62eb630b,0x6b2c630b,0x6b2c6b2c,0x6b2c6b2c,0x6b0b6b4c,0x630b62eb,0x5aca62eb,0x62eb5aca,0x630b630b,0x630b62eb,0x5aca62eb,0x62eb62ca,0x5aca62eb,0x62eb62eb,0x5aaa5aaa,0x5aca5aaa,0x5aaa5acb,0x5aca5aca,0x5aaa5aaa,0x5aca5aaa,0x5acb5acb,0x62eb5acb,0x5aaa5acb,0x62cb5aaa,
-0x5aaa5aaa,0x5aca5aca,0x528a5aaa,0x736d5aca,0x5aca630b,0x5aaa5aca,0x5aca5aaa,0x5aaa528a,0x5aaa5289,0x630b5aca,0x62eb630b,0x62eb62eb,0x630b62eb,0x62eb630b,0x734c630b,0x5aca6b2c,0x6b0b630b,0x62ca630b,0x5aca5aca,0x62eb62eb,0x5aaa5289,0x5aca5aaa,0x632c632c,0x6b2c630c,0x5acb62eb,0x6b2c630b,0x738d6b4c,0x738d7bae,0x62eb6b2c,0x630b62eb,0x62eb630c,0x5aaa5aaa,
-0x7b8d736c,0x7b8d7b8d,0x7bad7bad,0x83ce7bad,0x7bad83ce,0x8c0f8c2f,0x83ef83ce,0x7bae9c92,0x7bae6b2c,0x6b4c736d,0x6b4c6b2c,0x738d6b4c,0x7bae7bae,0x840f7bce,0x7bce83ef,0x840f8c30,0x83ee7bad,0x8c509491,0x738d7b8d,0x7bce7b8d,0x7bce83ef,0x7bad738d,0x6b2c6b2c,0x83ef7bce,0x738d7bad,0x7bad83ee,0x7bad738d,0x7bad7bae,0x7b8d736d,0x6b2c738d,0x83ef7bce,0x7bae734c,
-0x83cead34,0x736c6b0b,0x8c0f736d,0x6b2c738d,0x6b4c630b,0x7bce6b2c,0x6b4c7bad,0x736c630b,0x7bce6b0b,0x6b2c6b4c,0x736d738d,0x738d736d,0x736d6b4c,0x6b6c73ad,0x7bae736d,0x736d738d,0x736d736d,0x738d7bae,0x738e736d,0x630b6b4d,0x6b4d6b4d,0x6b2c6b2c,0x6b4d6b4d,0x6b2d6b4d,0x630c6b2c,0x736d6b4d,0x6b2c6b2c,0x6b4d6b4d,0x6b2c62eb,0x736d738d,0x630c630c,0x5acb62eb,
-0x62eb5aaa,0x5aaa5acb,0x5aaa5aaa,0x6b0c5aaa,0x5acb630c,0x62cb5acb,0x62eb5aca,0x6b0c6b2c,0x62eb62eb,0x62eb5aaa,0x5aca62eb,0x62cb5aaa,0x5aca62eb,0x62eb630b,0x62cb5aca,0x62eb6b2c,0x62eb62eb,0x5aca5aca,0x62eb62eb,0x5aca630b,0x5aaa5289,0x5aaa5aaa,0x62ca5aaa,0x62eb62eb,0x62eb5aca,0x6b0c62eb,0x62eb62eb,0x5aaa62ca,0x5aaa62cb,0x5aaa5aaa,0x5aca5aaa,0x5aeb5aca,
-0x5aca62eb,0x62eb62eb,0x6b2c5aca,0x5aaa736d,0x6b2c5aaa,0x6b4c6b4c,0x6b2c6b2c,0x62ea6b2c,0x6b0b62eb,0x6b4c62eb,0x6b2c62eb,0x630b630b,0x630b630b,0x62ca62eb,0x62eb6b2c,0x62cb5aca,0x630b62eb,0x62eb630b,0x62eb630b,0x5aca5aaa,0x5aca5aca,0x62eb5aca,0x52895aca,0x5aaa528a,0x52895aaa,0x5aaa5aaa,0x5aaa5aaa,0x5acb528a,0x62eb5acb,0x62eb62eb,0x5aaa62cb,0x52895aaa,
-0x5aca5aaa,0x5aca62eb,0x528a5aaa,0x62eb5aca,0x528a62eb,0x528a5aaa,0x5aaa5289,0x5aca5aaa,0x630b5aaa,0x62eb62eb,0x5aca630b,0x62eb630b,0x5acb5acb,0x62eb62cb,0x62eb62eb,0x6b2c62eb,0x62eb5aca,0x5aca630b,0x5aaa5aca,0x8c306b2c,0x62eb736d,0x5aeb5aeb,0x630b5aeb,0x6b4c6b4d,0x62eb62eb,0x6b2c630b,0x738d6b4c,0x738d7bae,0x6b4c736d,0x62eb630b,0x630b62eb,0x5aaa62eb,
-0x736d7b6d,0x7bad7b8d,0x7b6d7b8d,0x7b8d7b8d,0x7bad7b8d,0x94508c0f,0x83ce9450,0x8c0f8bef,0x6b4c7b8d,0x7bce736d,0x6b2c6b4c,0x6b4c736d,0x738d6b4c,0x7bae7bae,0x7bae7bce,0x7bae7bae,0x83ef7bce,0x7bce736d,0x7bad840f,0x7b8d736d,0x840f83ee,0x7bce736c,0x6b2c7bad,0x83ef7b8d,0x7bce840f,0x83ee7bae,0x83ce7bae,0x7bad840f,0x6b4c738d,0x738d736d,0x7b8d736d,0x630b7bae,
-0xc5d67b8d,0x6b2b7bce,0x736d734c,0x7bae840f,0x6b4c630b,0x6b4c6b4c,0x6b4c738d,0x6b2b6b4c,0x6b4c630b,0x736d736d,0x734c6b4c,0x6b2c738d,0x736d7bce,0x7bce6b6c,0x7bae7bce,0x736d840f,0x6b4c6b4d,0x6b4d6b4d,0x738e7bae,0x736d6b4d,0x736d6b2c,0x6b4d630c,0x630c6b4d,0x6b2c6b4d,0x6b4d6b2c,0x6b4c6b4d,0x6b4c6b4c,0x6b4d6b4c,0x6b2c6b4d,0x6b4d6b4d,0x6b2c6b4d,0x5acb630b,
-0x6b0c5acb,0x5acb62eb,0x6b2c5acb,0x6b2c6b2c,0x62eb6b4d,0x6b0c62eb,0x62eb630b,0x5aca62eb,0x62eb62eb,0x62eb5aca,0x62eb62cb,0x5aca5aca,0x62eb630b,0x5aca62eb,0x5aaa62eb,0x62eb5aaa,0x62cb5aca,0x5aca5aca,0x5aaa5aca,0x5aaa5aca,0x62cb5aca,0x62cb5aca,0x62eb62eb,0x62cb62eb,0x6b4c630b,0x62ca6b2c,0x62eb5aaa,0x5aaa62eb,0x5aaa5aaa,0x5aca62eb,0x630b5aca,0x5aca5aeb,
-0x62eb62eb,0x62eb62eb,0x62eb5aaa,0x5aca734c,0x6b4c62eb,0x736d734c,0x630b6b4c,0x6b0b6b2b,0x6b2c6b2c,0x6b2c6b0b,0x6b2c6b2c,0x62eb6b2c,0x62eb6b0b,0x630b6b0b,0x630b630b,0x62eb6b2c,0x630b62eb,0x62eb62eb,0x62eb630b,0x5aca5aca,0x5aca5aca,0x5aca5aca,0x5aca5aca,0x5acb5acb,0x5aaa5aaa,0x528a5acb,0x5aca528a,0x5aaa5aaa,0x5aca5aca,0x5aca5aaa,0x630b62eb,0x62cb630b,
-0x62eb5aaa,0x5aca62eb,0x5aaa5aaa,0x62eb5aca,0x5aaa5aca,0x5289528a,0x5aaa5289,0x52aa52aa,0x5aca5aaa,0x5aaa5a89,0x5aaa5aca,0x62eb5aca,0x5aca5aaa,0x62eb62cb,0x62eb62eb,0x630b62eb,0x62eb62cb,0x5aca62ca,0x6b2c62eb,0x7bce6b4c,0x5aea6b2c,0x5aeb5aeb,0x62eb5aeb,0x630b632c,0x5aca5aca,0x6b2c630b,0x6b2c630c,0x736d736d,0x6b2c6b4d,0x62eb630b,0x630b62eb,0x5aca62eb,
-0x736d7b8d,0x7bae7bad,0x736c736c,0x734c7b6c,0x7b8d736c,0x83ce7bad,0x83ce9450,0x7b6d7b6d,0x736d83ef,0x736d734c,0x736d7bae,0x734c734c,0x736d6b4c,0x738d7bae,0x7bae736d,0x7bae7bce,0x738d6b4c,0x7bae7bad,0x7bad738d,0x736c736d,0x736c734c,0x736d738d,0x736d6b4c,0x738d6b2c,0x83ee83ee,0x7bae734c,0x7bce83ee,0x738d7b8d,0x6b2c7bad,0x738d6b2c,0x6b4c6b4c,0x736d738d,
-0x736c6b0b,0x8c30de99,0x6b2c736d,0x7b8d736d,0x62eb7b8d,0x6b2c6b4c,0x738d630b,0x6b2c6b2b,0x62eb630b,0x738d734c,0x736d6b4c,0x6b2c738d,0x738d6b2c,0x6b4c736d,0x8c3083ef,0x7bae7bae,0x6b4c6b6d,0x6b2c6b4c,0x6b4d738d,0x6b4d632c,0x6b2c6b4d,0x6b4d6b6d,0x6b4c6b4d,0x6b4c630b,0x736d6b2c,0x630c6b2c,0x6b4c6b2c,0x6b2c6b2c,0x6b2c736d,0x6b2c6b2c,0x736d6b4c,0x630c6b2c,
-0x6b2c62eb,0x736e734d,0x736d734d,0x736d734d,0x62cb6b2c,0x6b0c62cb,0x6b0c6b2c,0x5aaa62eb,0x62cb5aca,0x5a8a5aaa,0x630b5aca,0x5aaa62eb,0x62eb5aca,0x5aca62eb,0x5aca5aca,0x5aca5aaa,0x5aca5aaa,0x5aca5aaa,0x5aaa5aca,0x5aaa5aca,0x5aca5aca,0x5aaa5a8a,0x62ca5aaa,0x6b0b62eb,0x62eb630b,0x6b0c6b0c,0x62ca6b2c,0x62cb62ca,0x62cb62cb,0x5aaa62eb,0x5acb5aaa,0x5aca5aca,
-0x62eb5acb,0x62eb62eb,0x5aaa62eb,0x736d736d,0x6b4c6b4c,0x736d6b4c,0x630b6b4c,0x6b2c630b,0x6b2c6b2c,0x6b0b6b2c,0x6b2c6b2c,0x630b6b2c,0x6b2c6b2c,0x6b0b6b2c,0x6b4c734d,0x630c6b2c,0x62eb62eb,0x5aca5aca,0x62eb62eb,0x62ca5aca,0x5aca5aca,0x5aaa5aaa,0x5aeb5acb,0x5acb5aeb,0x5aca528a,0x5aaa5aeb,0x62eb5aaa,0x52895aca,0x5aaa5aca,0x5aca528a,0x62eb630b,0x5aca62eb,
-0x62eb5aca,0x5aca62eb,0x5aaa5aaa,0x5aca5aca,0x5aca5aaa,0x528a52aa,0x52aa52aa,0x528952aa,0x5aca5aaa,0x5aaa5289,0x5aca5acb,0x630b5aca,0x5acb5aca,0x5acb5aca,0x62eb62eb,0x62eb62cb,0x630b62eb,0x62cb6b0c,0x630b5aea,0x6b2c632b,0x5aea62eb,0x62eb5aca,0x630b5aeb,0x5aeb5aeb,0x62eb5aca,0x630b630b,0x630b62eb,0x6b4c6b2c,0x630b6b2c,0x62eb62eb,0x5aca62eb,0x5aca5aca,
-0x7b8d7b8d,0x83ae7bae,0x7b8d7bad,0x736c7b8c,0x7b8d736c,0x7b8d7bad,0x7b8d7b8d,0x7b8d7bae,0x83ef83ce,0x6b0b7b8d,0x7bae7bae,0x736d736d,0x734c736d,0x738d7bae,0x7bce736d,0x83ef83ef,0x630b734c,0x83ef7bad,0x7bae736c,0x736d7bae,0x6b4c6b4c,0x7bae738d,0x736d734c,0x7b8d738d,0x7bae7b8d,0x738d7bad,0x83ee7bce,0x736d734c,0x734c736c,0x738d738d,0x6b4c738d,0x7bae630b,
-0x6b2c736d,0xd67883ef,0x6b2b734c,0x6b2c734c,0x738d7bce,0x6b4c62eb,0x6b2b630b,0x6b2c6b4c,0x62eb630b,0x6b2c6b0b,0x734c6b4c,0x6b2c6b4c,0x6b4c630b,0x738d7bce,0x842f738d,0x7bae840f,0x6b4d6b2c,0x5aeb62eb,0x6b2c630b,0x6b4d6b6d,0x632c632c,0x6b2c630b,0x6b6d736d,0x6b4d6b6d,0x736d6b4d,0x630c6b4d,0x6b4d6b2c,0x6b4c6b4d,0x6b2c6b2c,0x62eb6b2c,0x736d630c,0x6b4d736d,
-0x6b4d6b4d,0x736e736d,0x6b4d6b4d,0x738e736d,0x6b0c736d,0x6b2c630c,0x630b6b2c,0x62ca62eb,0x62eb5aaa,0x5aaa5aca,0x62eb5aaa,0x62cb62eb,0x62cb5aaa,0x630b630b,0x62eb5aaa,0x62eb630b,0x5aaa62eb,0x5aca5aaa,0x5acb62eb,0x5aaa5aaa,0x5aaa5a8a,0x5aca5aaa,0x5a895aaa,0x62cb5aaa,0x5aca62ca,0x6b0b62eb,0x62eb6b2c,0x5aaa62ca,0x62ca62eb,0x5aaa5aaa,0x5aaa528a,0x5aeb5aca,
-0x5aaa5aca,0x5acb5aaa,0x5aaa62eb,0x83ef736d,0x6b4c736d,0x6b2c6b2c,0x630b6b2b,0x630b630b,0x6b2c6b0c,0x6b2c736d,0x630b62eb,0x6b4c6b2c,0x6b2c6b2c,0x630b62eb,0x738d738d,0x62eb6b2c,0x62eb62eb,0x5aca5aca,0x5aca62ca,0x62eb5aca,0x5aca5aca,0x5aaa5aaa,0x5acb5aca,0x5aaa5acb,0x52aa52aa,0x5aca5aaa,0x5aca5aca,0x5aaa5aaa,0x528a5aaa,0x5acb528a,0x5aca62eb,0x5aca5aca,
-0x62eb62eb,0x5aaa5aca,0x5aca5aaa,0x5aaa5aca,0x62eb5aca,0x52aa52aa,0x52aa5aca,0x52aa5aaa,0x52895289,0x52895289,0x5aca5aca,0x5aca52aa,0x62eb62eb,0x5aca5aca,0x630c62eb,0x62cb62eb,0x62eb630b,0x5aca62eb,0x6b4c62eb,0x5aca6b2c,0x62eb5aca,0x5aca5aaa,0x630b5aca,0x5aeb5acb,0x62eb62eb,0x62eb62eb,0x630b62eb,0x630b630b,0x62eb62eb,0x62eb62eb,0x5aaa5aca,0x5aca5aaa,
-0x7bae7b8d,0x7bae7b8d,0x83ce83ee,0x7b8d7b8d,0x734c83ce,0x734c732c,0x83ee7b8d,0x8c309430,0x83ce7b8d,0x7b8d8c10,0x7b8e736d,0x7b8d83ce,0x734d734c,0x736d736d,0x83cf7bae,0x83ce7bae,0x6b4c7bae,0x8c2f6b0b,0x736c840f,0x7bce7bae,0x6b2c738d,0x7bae6b4c,0x736d736d,0x7bae736d,0x7b8d7bad,0x7bce840f,0x7bce7bad,0x6b4c7bae,0x738d736d,0x738d7bce,0x736d736d,0x736d6b2c,
-0x7b8d83ef,0x8c0f6b0b,0x62eb9c91,0x738d6b2c,0x83ee736c,0x6b2c7bae,0x630b6b4c,0x6b2b6b4b,0x734c6b2b,0x630b6b4c,0x6b4c6b2b,0x6b2c6b2c,0x6b6c6b4c,0x840f7bce,0x736d736d,0x7bae840f,0x8c517bef,0x630b6b4c,0x632c630c,0x6b4c6b4c,0x6b4c6b4c,0x632c632c,0x6b6d6b6d,0x632c6b4c,0x6b4c6b2c,0x6b4c736d,0x6b4c6b2c,0x6b2c736d,0x62eb62eb,0x5aca630b,0x6b2c5aca,0x6b4c6b4d,
-0x736d736d,0x6b4d736d,0x736d734d,0x6b4d738e,0x6b4c738e,0x6b2c6b2c,0x62eb6b0b,0x62eb62cb,0x6b0b62ca,0x62eb6b0c,0x5aca5aca,0x630b62eb,0x5aca62eb,0x6b2c62eb,0x62ca5aca,0x62eb62eb,0x5aaa62eb,0x5aaa5289,0x5aca5aca,0x528a5aaa,0x5aaa5aaa,0x62eb5aaa,0x5aaa62cb,0x6b0b62cb,0x62eb630b,0x62ca5aaa,0x62eb62ca,0x62cb62cb,0x5aaa5aaa,0x5aaa5aaa,0x5aaa5aaa,0x5aca5aaa,
-0x5aaa5acb,0x5aaa5aaa,0x62eb62eb,0x8c30736d,0x736d736d,0x6b0b6b4c,0x6b0b6b0b,0x630b6b0b,0x6b2c630b,0x6b4c736d,0x6b0b62eb,0x6b4c6b2c,0x630b734c,0x736d630b,0x7bce7bae,0x5aca736d,0x62eb630b,0x5aea62eb,0x5aca62ca,0x62eb5aca,0x5aca5aca,0x5aca5aca,0x5aca5acb,0x5aca5aaa,0x5aca5aeb,0x52aa5289,0x5aca5aca,0x62eb5aca,0x5aaa5aaa,0x62ca5a89,0x5aaa62eb,0x5aca5aca,
-0x62ca62eb,0x5aaa5aaa,0x5aca5aaa,0x5aaa5aca,0x5aca5aca,0x528a5289,0x52aa5aca,0x52aa52aa,0x5aca5aaa,0x5aaa5aeb,0x5aeb5aeb,0x5aca5aaa,0x62eb5aeb,0x5aca5aeb,0x62eb5acb,0x62eb62eb,0x62eb630c,0x5acb62eb,0x6b2c62eb,0x5aaa630c,0x62eb5aca,0x5aaa5aaa,0x5acb5aca,0x5aca5aaa,0x5aca5acb,0x5aca5aaa,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x5aaa5acb,0x5aca5aaa,
-0x7b8d734c,0x7b6d736c,0x83ce83ee,0x7b8d736c,0x7b6d7b8d,0x734c7b6d,0x7b8d734c,0x9c918bef,0x734c83ef,0x8c0f83ce,0x734c7bae,0x7bae736d,0x734c736d,0x736d734c,0x83ce7bae,0x7b8d7b8d,0x7b8d7bad,0x83ef736d,0x738d840f,0x738d738d,0x734c7bae,0x6b4c736d,0x7bae736d,0x7bae6b2c,0x7b8d83ce,0x7bce7bad,0x738d83ee,0x736c7bae,0x7b8d7bad,0x736d736d,0x734c736d,0x736c736d,
-0x7b8d736c,0x7b8d7bad,0x83ee8c30,0x736d6b4c,0x734c6b4c,0x7b8d9450,0x6b4c6b2b,0x6b2b630b,0x736d6b0b,0x6b2b738d,0x6b2c62eb,0x6b2c6b4c,0x73ad6b4c,0x738d738d,0x6b6c7bae,0x7bce6b4c,0x9cb373ae,0x6b6d73ae,0x630c736d,0x6b6d5aeb,0x6b6d738d,0x632c738d,0x6b6d632c,0x630b62eb,0x630b630c,0x6b4c6b4c,0x6b2c6b2c,0x630b6b4c,0x630b6b2c,0x6b2c6b2c,0x6b4d6b2c,0x738e736d,
-0x736d736d,0x738e738e,0x7bae7bae,0x736d7b8e,0x6b2c734d,0x6b0b6b0c,0x62ca62eb,0x6b0b62cb,0x62eb62eb,0x62eb6b0b,0x5aca630b,0x62eb5aca,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x5aaa5aaa,0x5a8a5aaa,0x5289528a,0x5aaa5aaa,0x5acb5aaa,0x5aaa5aca,0x5aaa5289,0x62cb62cb,0x6b2c6b0c,0x62eb62eb,0x62ca5aaa,0x6b0b62ca,0x62ca62cb,0x62cb5aaa,0x5aaa5aca,0x5aaa5aaa,0x52895aca,
-0x5aca5acb,0x5aca5aca,0x6b4c62eb,0x8c30738d,0x736d736d,0x6b2c736d,0x6b0b630b,0x6b0b6b0b,0x630b630b,0x6b4c6b4c,0x6b4c6b2c,0x6b0b630b,0x734c734c,0x7bae736d,0x7bae7bce,0x630b6b4c,0x5aea5aea,0x630b62eb,0x5aaa62eb,0x5aca5aaa,0x5aca5aca,0x5aca5aca,0x5aaa5aca,0x5aca5aaa,0x5aeb5aeb,0x5aaa5aca,0x5aeb5aca,0x62eb62eb,0x5aca62eb,0x5aca5a89,0x5aca62eb,0x62eb62eb,
-0x62eb62eb,0x5aaa5aca,0x5acb5aca,0x5aca62eb,0x5aaa5aca,0x52aa5289,0x52aa5aca,0x5aaa52aa,0x5aca528a,0x52aa5aca,0x5aca5aca,0x52aa5aca,0x5aeb5aca,0x5aeb630b,0x5aca5acb,0x630c62cb,0x5acb62eb,0x62eb62eb,0x62eb5aca,0x5aca5acb,0x62eb5aca,0x5aca5aca,0x5aca5aca,0x5aaa5aaa,0x5aca5aca,0x5aca5aca,0x5aca5aca,0x62eb5aca,0x5aca62eb,0x5acb5aca,0x5aaa5aca,0x5aaa5aaa,
-0x734c732c,0x734c732c,0x7b8d7b8d,0x736c734c,0x7b8d7b8d,0x732c7b8d,0x7b6d734c,0x7bae736d,0x736d83ef,0x7bae734d,0x7b6d83cf,0x7b8d6aeb,0x736d7b8d,0x736d736d,0x736d736d,0x7b8d7b8d,0x736d738d,0x7bae7bce,0x83ce83ef,0x6b2c7b8d,0x7bce736d,0x6b4c6b4c,0x736d6b4c,0x736d736d,0x83ce83ce,0x7b8d734c,0x7bad83ef,0x7bad738d,0x734c736d,0x736d6b2c,0x734c7b8d,0x6b4c6b4c,
-0x6b2b6b4c,0x7b8d7bae,0x83ce9450,0x6b0b9450,0x6b2c6b4c,0x83ef7bae,0x6b4c734c,0x630b6b2b,0x6b4c630b,0x6b2c6b2c,0x630b630b,0x630b6b4c,0x736d738d,0x736d738d,0x73ad736d,0x738d6b6c,0x9cb37bce,0x7bef8c71,0x632c7bcf,0x6b4c5aeb,0x738d6b4c,0x6b4c6b4c,0x632c6b4c,0x6b4c6b4c,0x6b2c6b4c,0x6b4c6b2c,0x6b4c6b4c,0x6b4c6b4c,0x630b6b4c,0x6b2c6b2c,0x6b4c6b2c,0x736d6b4c,
-0x738d738d,0x736d738d,0x736d7bae,0x83cf738d,0x736d7b8d,0x6b2c734c,0x62ea6b0b,0x630b62ea,0x5aaa62cb,0x62eb62ca,0x62eb6b2c,0x5aca5aca,0x630b5aca,0x5aca630b,0x62ca62ca,0x5aaa5aca,0x5aaa5aaa,0x52895aaa,0x5aaa5289,0x630b5aca,0x5aca5acb,0x62cb5aca,0x62ca62cb,0x62ca62cb,0x62eb5a89,0x62ca62eb,0x6b2c62cb,0x5aaa6b0b,0x62eb62cb,0x5aaa5aca,0x5aaa528a,0x52aa5aca,
-0x5aaa528a,0x62eb5aaa,0x6b4c62eb,0x83ef736d,0x6b4c736d,0x6b2c736c,0x6b2b6b2b,0x6b0b630b,0x5aaa62eb,0x6b2c6b0c,0x6b4c6b4c,0x62eb630b,0x736d6b0b,0x7bae736d,0x6b4c7bae,0x630b5aca,0x5aca5aca,0x630b62eb,0x5aca62eb,0x5aaa5aaa,0x5aca5aea,0x5aaa5aaa,0x5aca5aaa,0x5aaa5aca,0x630b5aca,0x5aeb630b,0x5aeb5aca,0x5aca62eb,0x5aaa5aca,0x5aaa5289,0x62eb62ca,0x6b2c6b0b,
-0x62eb630b,0x62eb62ca,0x62eb62eb,0x62eb62eb,0x5aca5acb,0x5acb5acb,0x5aaa5aaa,0x5aaa52aa,0x52aa52aa,0x5aaa52aa,0x5aca5aca,0x52aa5aeb,0x5aeb52aa,0x5aeb5aeb,0x5acb5acb,0x630c62cb,0x5aaa5acb,0x5acb5acb,0x6b2c630b,0x5aca62eb,0x62eb5aca,0x62eb62eb,0x5aaa62eb,0x5aca5aaa,0x62eb5aca,0x5acb5acb,0x5aca62eb,0x62eb5aaa,0x5acb62eb,0x5aaa5aaa,0x5aaa5aaa,0x528a5aaa,
-0x734c734c,0x734c732c,0x734c734c,0x734c734c,0x7b8d7bad,0x7b8d7bae,0x736c734c,0x6b2c6b2c,0x83ef734d,0x6b0c7b8d,0x8c0f7b8e,0x62eb6b0c,0x83ce734c,0x736d7b8d,0x6b2b734c,0x7b8e734c,0x736d736d,0x83ef736d,0x734c8c30,0x7bae7bae,0x7bae7bae,0x7b8d7bce,0x6b4c6b2c,0x738d736d,0x7bae736d,0x6b2b7b8d,0x840f734c,0x736c7bae,0x6b2b7b8d,0x6b2c6b4c,0x734c6b2c,0x6b2c6b2c,
-0x734c734c,0x6b4c732c,0x9cd28c30,0x8c0f6b2b,0x6b4c736d,0x6b2c734c,0x736d83ee,0x6b4c630b,0x6b4c736c,0x6b4c62eb,0x630b736d,0x6b2c630b,0x6b4c738d,0x738d6b4c,0x6b6c6b6c,0x6b4c73ad,0x7bcf738e,0x736e8410,0x6b6d738e,0x630c6b4c,0x6b4c6b6d,0x6b4c6b6d,0x6b6c6b4c,0x6b4c632c,0x6b2c6b4d,0x630b62eb,0x6b4c6b4d,0x736d6b2c,0x736d738d,0x736d736d,0x6b4d6b4c,0x6b4c6b4c,
-0x7bae738d,0x736d7bae,0x7b8e7bae,0x7bae7b8e,0x7b8d7b8d,0x6b2c734c,0x62eb6b0b,0x62eb62ea,0x62cb62ca,0x6b2c6b0c,0x62eb734c,0x62eb62ca,0x5aca62eb,0x630b6b0b,0x5a895aca,0x5aca62eb,0x5aca62cb,0x52895aca,0x5aaa5269,0x62eb5aaa,0x630b630b,0x5aca62cb,0x5aaa5aaa,0x62eb62cb,0x5aca62eb,0x5aaa5aaa,0x62ca62eb,0x6b0b62eb,0x62cb62cb,0x5aca5aaa,0x5aaa5aca,0x5aca5aca,
-0x5aca5aaa,0x6b2c5aaa,0x630b630b,0x7bce6b2c,0x6b0b736d,0x6b2c6b0b,0x6b2c734c,0x6b0b62eb,0x52895aca,0x62eb630b,0x6b2c6b4c,0x630b630b,0x6b4c6b2c,0x7bce736d,0x630c736d,0x62eb62eb,0x5aca62eb,0x630b5aea,0x5aca62eb,0x5aca5aca,0x62eb630b,0x528a5aaa,0x5aeb5aaa,0x5aaa62eb,0x630b5aaa,0x5aeb62eb,0x52aa5aaa,0x5aaa5aca,0x5aca5aaa,0x5aca5aaa,0x5aaa5aaa,0x6b2c62eb,
-0x62eb630b,0x630b62eb,0x62eb630b,0x62eb62eb,0x5aeb62eb,0x5aeb632c,0x5aca52aa,0x52aa52aa,0x5aca5aca,0x5aeb5289,0x5aca5aca,0x528a630b,0x5aca5aca,0x5acb5aca,0x5acb62eb,0x62eb5acb,0x630c62ec,0x6b2c6b2c,0x6b2c6b2c,0x5acb62eb,0x5aca5acb,0x62eb62eb,0x5aaa62eb,0x5acb5aca,0x5aca5aaa,0x5aca5aca,0x5aca62eb,0x62eb5aaa,0x630b6b2c,0x5aaa5aca,0x5aaa5aaa,0x52895aaa,
-0x732c6b0b,0x6b2b6b2c,0x736c734c,0x6b2b6b2c,0x7bad7bad,0x738d7bae,0x736d736d,0x736d734d,0x738d734d,0x7bae83ce,0x7bae734c,0x734c8c0f,0x736d62eb,0x7b8d7bce,0x6b4c734c,0x6b4c6b4c,0x736c736c,0x736d736c,0x7bae8c30,0x7bce6b4c,0x736d840f,0x7bae7bce,0x736d6b4c,0x736d738d,0x734c7b8e,0x736d738d,0x7bad734c,0x7bad83ce,0x734c6b0b,0x630b6b0b,0x630b630b,0x6b0b632b,
-0x6b2c6b2c,0x738d6b0b,0xc61783ef,0x6b2b738d,0x736d8c30,0x6b4c738d,0x8c30736d,0x6b2c6b4c,0x736d736d,0x62eb630b,0x6b2c6b4c,0x630b630b,0x6b2c6b2c,0x6b0b6b0b,0x6b4c6b4c,0x6b4c6b2c,0x6b4d630c,0x6b2c6b4d,0x7bae736d,0x6b2c736d,0x6b4d6b4c,0x6b4d6b4d,0x6b4c6b4d,0x736d630c,0x6b4c6b4c,0x5acb630b,0x736d6b2c,0x738d734c,0x738d736d,0x736d736d,0x7bae738d,0x736d736d,
-0x7bae6b6c,0x6b6c738d,0x7bae738d,0x738d738d,0x736d734c,0x736d6b4c,0x5aca6b4c,0x6b2c62eb,0x62ca630b,0x62eb62eb,0x5aca6b2c,0x5aca62eb,0x62eb62eb,0x5aca5aaa,0x5aaa5aaa,0x62eb5aaa,0x5aaa5aca,0x62eb5aaa,0x5aaa5aca,0x5aca5aaa,0x62ca62eb,0x5aaa62cb,0x5aaa62ca,0x62eb62eb,0x5aaa62eb,0x5aaa62ca,0x62eb62ca,0x62eb62eb,0x62eb5aca,0x5aaa5aaa,0x630b5aca,0x5aca630b,
-0x5aca5aeb,0x6b2c52a9,0x6b2c6b4c,0x736d736d,0x630b6b4c,0x630b62eb,0x630b6b2c,0x6b2c630b,0x630b630b,0x5aca62eb,0x62eb62ca,0x6b2c6b0b,0x6b2c6b0c,0x6b2c734c,0x62ca62ca,0x5aaa62eb,0x5aca5aca,0x62eb62ca,0x62eb5aea,0x5aca62eb,0x62eb5aaa,0x5acb62eb,0x5acb5acb,0x5aca5acb,0x5acb62eb,0x62eb62eb,0x5acb62eb,0x5aaa5aaa,0x5aca5acb,0x5aaa5acb,0x5aca62eb,0x630b62eb,
-0x6b4c6b2c,0x62eb62eb,0x630b6b2c,0x62eb62eb,0x5aca5aaa,0x5acb630b,0x52895289,0x5aca5aca,0x5aaa62eb,0x5acb5a8a,0x5acb62eb,0x5aca5aca,0x62eb5aca,0x62eb62eb,0x630b630b,0x5aca62cb,0x6b4c62eb,0x6b2c736d,0x62eb62eb,0x630b630b,0x5aca5aea,0x630b630b,0x5aaa5aca,0x5aca5acb,0x5aaa5aca,0x5aca62eb,0x62eb5aca,0x630b5aca,0x6b2c734c,0x5aaa5aca,0x52aa52a9,0x52a95aca,
-0x6b2b736c,0x734c734c,0x732c6b2b,0x6b0c734c,0x7b8d734c,0x738d7bae,0x736d736d,0x6b4c736d,0x736d736d,0x83ef738d,0x734d83ce,0x7bae736d,0x630b7b8d,0x7bad7b8d,0x738c736c,0x6b2b6b4b,0x738d736c,0x734c736c,0x736d738d,0x736d6b4c,0x7b8d7bae,0x73ad738d,0x738d73ad,0x6b4c736d,0x734c734c,0x7bae734c,0x6b2c736c,0x83ce83ae,0x6b2b7bad,0x62ea736c,0x6b4c62eb,0x6b2c5aaa,
-0x6b4c6b4c,0x6b4c6b4c,0x9cd27b8d,0x6b4c736c,0x8c307b8d,0x6b2c736d,0x738d6b2c,0x6b2c7bce,0x6b4c6b2c,0x62eb632b,0x630b630b,0x6b2c6b4c,0x6b4c6b2c,0x6b2c6b4c,0x6b4c6b2c,0x6b4c6b2c,0x6b4d6b2c,0x736d6b4c,0x6b4d6b4d,0x6b2c7bae,0x736d62eb,0x6b2c630c,0x630c6b4d,0x83ef6b4d,0x6b6d736d,0x736d738d,0x736d6b2c,0x738d738d,0x736d7b8d,0x7b8d7b8d,0x7bae83ef,0x7bae7bae,
-0x6b4c738d,0x736d6b6c,0x736d734c,0x738d738d,0x6b2c736d,0x6b2c6b0b,0x62eb62eb,0x62eb6b0b,0x630b630b,0x5aca62eb,0x5aaa5aca,0x5a8a5aca,0x52895269,0x5aaa5aaa,0x5aaa62cb,0x5a8a5acb,0x5aca5aca,0x5aaa5aca,0x5aca5aaa,0x5aca62eb,0x62ca5aaa,0x62ca62eb,0x5aaa62ca,0x62eb62ca,0x5aaa62eb,0x5aaa62ca,0x62eb62ca,0x62ca62eb,0x62eb62ca,0x5aaa5aea,0x62eb5aca,0x62eb630b,
-0x630b5aca,0x62eb5aca,0x6b4c6b4c,0x6b2c6b4c,0x6b4c736d,0x6b0b6b2c,0x6b0b630b,0x630b630b,0x62eb62eb,0x630b62ca,0x6b0b6b0c,0x6b0b62eb,0x62eb6b0b,0x6b0b62eb,0x5aca62eb,0x5aca5aca,0x5aca5aca,0x62eb62eb,0x5aca5aca,0x5acb5acb,0x62eb5acb,0x62eb62eb,0x5aaa62cb,0x5aaa5aaa,0x62cb62eb,0x5aca5aca,0x5aaa5acb,0x5aca5aaa,0x5acb5aca,0x5acb5acb,0x5aca62eb,0x5aaa5aaa,
-0x6b4c62eb,0x630b6b0b,0x630b6b2c,0x5aca62eb,0x5aaa5acb,0x5aca5aaa,0x528a5aaa,0x5aca5aaa,0x62eb5aaa,0x528a5acb,0x5acb528a,0x5aaa62cb,0x62eb62eb,0x62eb5aca,0x6b0b6b2c,0x5aca62eb,0x630c5aca,0x62eb6b2c,0x630b5aca,0x630b6b2c,0x62eb630b,0x5aca62eb,0x5aaa5aaa,0x5aca5aca,0x5aca5aeb,0x5aca630b,0x62eb5aca,0x6b2b5aca,0x6b4c6b2c,0x5aca62eb,0x52aa5aca,0x52aa52aa,
-0x736c7bad,0x734c6b2c,0x6b0b734c,0x734d6b0b,0x734d734c,0x7bae738d,0x736d7bae,0x734c734c,0x738d6b4d,0x736d736d,0x7bce7bce,0x734c736d,0x83ce840f,0x7b8d736c,0x736c7bce,0x6b4c6b4c,0x7bae738d,0x738d738d,0x7b8d6b4c,0x6b2c736d,0x7bae6b0b,0x736d736d,0x738d73ad,0x6b6c738d,0x62eb6b2c,0x734c734c,0x7b8d734c,0x7bad736c,0x7bad8c0f,0x6b4c6b2b,0x62ca6b0b,0x6b2c6b2c,
-0x736d6b4c,0x6b0b6b4c,0x7b8d6b2c,0x734c6b2b,0x738d6b2b,0x6b2c738d,0x736d630b,0x7b8d738d,0x630b738d,0x630b6b4c,0x6b4c630b,0x736d630b,0x736d6b4c,0x736d738d,0x6b2c6b2c,0x6b2c6b2c,0x7bae6b4d,0x738e6b4d,0x6b4c738e,0x6b4d738e,0x6b2c6b4c,0x6b2c6b4c,0x734d736d,0x83ef6b2c,0x736d6b6d,0x6b4c6b4c,0x738d738d,0x736d736d,0x7bae7b8d,0x7b8e7b8d,0x7bce738d,0x7b8e738d,
-0x6b4c736d,0x736d6b2c,0x738d7bae,0x738d736d,0x734c7bae,0x6b2c6b2c,0x62eb62eb,0x6b2c6b2c,0x6b2c630b,0x62eb630b,0x5aaa62eb,0x5aaa5aca,0x5aaa5289,0x5aaa5a8a,0x62cb5acb,0x5a8a62cb,0x5aaa5289,0x5aca62cb,0x5aca5aaa,0x5aaa62eb,0x6b0b5aaa,0x6b0b6b0b,0x6b0b6b0b,0x62eb62ca,0x62eb62eb,0x62ca62eb,0x62ca62ca,0x5aca5aca,0x62eb5aaa,0x5aaa5aca,0x528a5289,0x5aca5aca,
-0x5aaa5289,0x5aea5aaa,0x6b4c6b6c,0x6b4c6b2c,0x6b4c6b4c,0x6b2c6b4c,0x6b2c6b2c,0x630b6b0b,0x62eb62eb,0x630b62eb,0x62eb6b0b,0x6b0b62eb,0x62eb6b0b,0x62eb62ca,0x62eb62eb,0x5aca5aca,0x5aca5aca,0x62eb62eb,0x5aca5aea,0x5aca5aca,0x5aca5aca,0x5acb5aaa,0x5aca5acb,0x5acb5aaa,0x62cb62eb,0x5aaa5aca,0x5aaa5aaa,0x5aeb5aca,0x5aca52aa,0x5aeb5acb,0x62eb62eb,0x5aaa5aaa,
-0x6b0b5aaa,0x6b0b6b2c,0x630b6b2c,0x62ca62eb,0x5aca5aaa,0x5acb62eb,0x5aaa5aca,0x5acb5aaa,0x5aca5aaa,0x5aca62cb,0x5aca5aca,0x5aca62cb,0x62cb62eb,0x62cb5aca,0x5aca62eb,0x62cb5aca,0x5aca5aaa,0x5aaa5aca,0x62eb5aca,0x62eb630b,0x630b62eb,0x5aca62eb,0x5aaa5aca,0x52aa52aa,0x5aca5aca,0x5aaa5acb,0x62ca5aaa,0x6b4c62eb,0x736d6b4c,0x5aca62eb,0x5aeb62eb,0x5aca5aaa,
-0x7bad83ae,0x734c736c,0x6b2c736d,0x734c6b0b,0x736d7b8d,0x7bae736d,0x7b8d7bce,0x736d736d,0x736d736d,0x738d736d,0x7bae738d,0x7b8d7bae,0x9cb27bae,0x6b2b83ce,0x738d7b8d,0x734c736c,0x6b2c6b4c,0x738d6b2b,0x83ef736d,0x736d7bae,0x630b6b4c,0x7bae736d,0x738d6b4c,0x6b4c83ef,0x6b2c6b0b,0x734c6b2c,0x736c734c,0x83ae7bad,0x83ee7bad,0x734c7b8d,0x6b0b734c,0x6b6c630b,
-0x736d6b4c,0x6b2c6b2c,0x738d6b0b,0x736d6b4c,0x6b2c6b4c,0x7bae6b2c,0x630b736d,0x734c6b4c,0x6b4c7bae,0x738d630b,0x6b2c6b6c,0x6b2c738d,0x736d736d,0x736d738d,0x6b2c6b2c,0x6b0c6b2c,0x738e6b4d,0x738d736d,0x736d7bae,0x738e736d,0x6b2c738e,0x6b2c6b2c,0x734d6b4c,0x83ef83ef,0x73ae6b4c,0x736d736d,0x738d7bae,0x7bce7b8e,0x83ef7bae,0x7bae7b8e,0x7bce736d,0x7bae7bae,
-0x738d738d,0x738d736d,0x736d7bce,0x6b4c6b2c,0x736d736d,0x630b6b4c,0x62eb62eb,0x6b2c630b,0x62eb62eb,0x62ca5aca,0x52895aaa,0x5a8a5289,0x630b62eb,0x62cb528a,0x62eb5a8a,0x62eb5acb,0x5aaa528a,0x5aca5aca,0x5aaa5aaa,0x5aca5aca,0x6b0b62ca,0x6b0b62ca,0x736d734d,0x62eb6b0b,0x6b0b62eb,0x62eb6b0b,0x62eb62eb,0x5aca62ca,0x62eb5aca,0x5aca62eb,0x528a5aaa,0x5aaa5aaa,
-0x52895aca,0x62eb5aaa,0x6b2c6b4c,0x6b4c630b,0x6b0b6b2c,0x6b2c630b,0x6b0b6b2c,0x6b0b630b,0x62eb62eb,0x62eb62eb,0x6b0b6b0b,0x62cb62eb,0x6b0b62eb,0x62ca62eb,0x62eb62eb,0x5aca5aca,0x5a895aaa,0x5aea5aaa,0x62eb62eb,0x5aaa5aca,0x5aca5aaa,0x5aaa5aca,0x5acb5aca,0x62cb5acb,0x62eb630b,0x5aaa5aca,0x5aaa5aaa,0x630b5aeb,0x5aca5aca,0x5aeb5aaa,0x62eb62eb,0x5aca5acb,
-0x62eb5aaa,0x6b2c630b,0x630b6b2c,0x62eb62eb,0x630b5aaa,0x62eb630b,0x62eb62eb,0x5aca5aca,0x5aaa5aca,0x62eb5aaa,0x5aca630b,0x62eb5aca,0x5aca5aca,0x5aca5aca,0x5aaa5aaa,0x5aca5aaa,0x5aaa5aaa,0x5aca5aaa,0x5aca5aca,0x5aca5aca,0x62eb5aca,0x5aca62eb,0x5aca62eb,0x52aa52aa,0x52aa5aaa,0x5aaa5aaa,0x62ca5aaa,0x6b4c62eb,0x6b4c738d,0x5aaa5aaa,0x630c630c,0x5aeb62eb,
-0x7bad7b8d,0x7bad83ee,0x734c732c,0x6b2c736d,0x7b8d736d,0x736d738d,0x7bae738d,0x734c7bae,0x736d738d,0x738d738d,0x7bae7bae,0x83ef83ce,0x94717bad,0x7b8d9470,0x83ce734c,0x736c7bad,0x6b2c736c,0x738d6b2c,0x8c507b8d,0x7b8d7bae,0x6b2c7bae,0x736d6b2c,0x738d738d,0x6b4c736d,0x6b2c734c,0x736c6b0b,0x7b8d7b8d,0x83ce7bad,0x7b8d734c,0x7bad8c0f,0x738d736c,0x6b2c6b2c,
-0x6b4c6b0b,0x6b2c6b0b,0x7bae6b0b,0x6b4c6b4c,0x738d7b8d,0x7bae630b,0x6b2c83ce,0x630b6b4c,0x7bce630c,0x6b4c6b4c,0x6b4d7bae,0x6b2c6b2c,0x6b4c736d,0x6b2c6b4c,0x6b0c630b,0x6b0c6b2c,0x6b2c6b4c,0x738d6b4c,0x738d736d,0x736d7bae,0x734d736d,0x736d738d,0x6b2c6b2c,0x83ef83ef,0x73ad73ad,0x7bae738d,0x736d738d,0x7b8e7bae,0x738d7bae,0x736d736d,0x736d736d,0x7bae7b8e,
-0x7bce7bae,0x7bae7bce,0x6b2c6b4c,0x6b4c736d,0x6b4c6b2c,0x5aca6b2c,0x630b62eb,0x5aca62eb,0x62eb62eb,0x5aca5aaa,0x52895aaa,0x5aaa5aaa,0x6b2c62eb,0x62eb5aaa,0x62eb5acb,0x630c5a8a,0x5aca62eb,0x5aaa5aaa,0x5aaa5aaa,0x62eb5aca,0x62eb62ca,0x62ca5aaa,0x734d6b2c,0x5aaa62cb,0x62ea62ea,0x5aca5aca,0x6b0b62eb,0x5aca62eb,0x630b62ca,0x62eb62eb,0x5aaa5aca,0x5aca5aca,
-0x52aa5aca,0x5aaa5aca,0x632b5aca,0x6b4c734c,0x6b2c6b4c,0x630b630b,0x6b2c6b0b,0x630b6b0b,0x62eb6b2b,0x630b62ea,0x6b0c6b2c,0x5aaa62ca,0x6b0b62cb,0x5aaa62cb,0x62eb62eb,0x62eb5aca,0x52895aaa,0x62eb5aaa,0x630b630b,0x5aca630b,0x5aeb5aca,0x5aaa5aca,0x5aca5aaa,0x5acb5acb,0x62eb630b,0x5aca5acb,0x5acb5aca,0x62ec5acb,0x5acb5acb,0x5aeb5aab,0x62eb5acb,0x62eb5aeb,
-0x62eb62cb,0x630b62eb,0x630b6b2c,0x62eb62eb,0x62eb630b,0x630b62eb,0x62eb6b2c,0x62eb5aca,0x62eb630b,0x5aaa5aaa,0x62cb5aca,0x5aaa5aca,0x62cb62eb,0x5aca5aca,0x62eb5aca,0x5aaa5aca,0x5aaa5aaa,0x5acb5aca,0x5aaa5aca,0x5aca5aaa,0x62eb5aca,0x5aaa5aca,0x5aca5aca,0x5aca5aaa,0x5aeb62eb,0x5aca5aca,0x5aea5aea,0x630b62ca,0x6b0b736d,0x62eb5aca,0x630b62eb,0x630b6b2c,
-0x7bad734c,0x83ce83ef,0x6b2c736d,0x734c6b2c,0x736d734c,0x736d738d,0x738d736d,0x738d7b8d,0x7bae736d,0x6b4c738d,0x7bce7bae,0x83ce7b8d,0x83ef8c0f,0x94508c0f,0x7bad8bef,0x7bad7bad,0x734c736c,0x6b2b6b2c,0x83ef6b4c,0x6b4c738d,0x738d738d,0x630b6b4c,0x738d738d,0x6b4c630b,0x6b0c736d,0x6b2c6b2c,0x83ae7b8d,0x736c734c,0x736c736c,0x8c0f7b8d,0x6b2c7bae,0x6b4c738d,
-0x6b2c6b0b,0x630b6b4c,0x734c6b2c,0x630b6b0b,0x83ce7bae,0x630b7b8d,0x83ce7bae,0x6b0b6b4c,0x62eb630b,0x7bae7bce,0x736d6b2c,0x6b4c6b2c,0x734d738d,0x630b6b2c,0x630b62eb,0x6b2c6b2c,0x734d6b4c,0x736d6b2c,0x738d7b8e,0x736d7bae,0x738d6b4c,0x738d83ef,0x6b4c736d,0x738d6b2c,0x73ae7bae,0x738d738d,0x7b8d7bae,0x734d738d,0x7b8e7b8e,0x7b8e7bae,0x7bae7b8e,0x7bae7bcf,
-0x8c30738d,0x7bce8c30,0x6b2c736d,0x736d738d,0x62eb6b2c,0x6b2c6b0b,0x62eb62eb,0x5aca62eb,0x62eb5aca,0x5aca5aca,0x62cb62eb,0x5aca62eb,0x62eb5aca,0x62eb5aca,0x5aaa630c,0x630c5aaa,0x62eb6b2c,0x5aaa5aca,0x5aca5aaa,0x5aaa62ca,0x62ca62ca,0x62ca5aaa,0x6b0b6b0b,0x5aaa5aaa,0x62ea62ca,0x5aca5aca,0x62ca62ca,0x62ca5aca,0x62eb62eb,0x5aca5aca,0x5aca5aca,0x5aca5acb,
-0x52aa5aca,0x52895aca,0x62eb52a9,0x736d738d,0x6b4c6b4c,0x62eb6b0b,0x6b2c62eb,0x6b0b6b4c,0x734c6b2b,0x62eb6b4c,0x62eb62eb,0x5aaa62eb,0x62cb62ca,0x62ca62ca,0x62cb630b,0x630b5aca,0x5aea62eb,0x630b62eb,0x62eb62eb,0x630b630b,0x5aca5aeb,0x5aca5aaa,0x5aaa5acb,0x62eb5aaa,0x62eb630b,0x5acb5acb,0x5acb5acb,0x5acb5acb,0x5acb5aeb,0x5aeb5acb,0x5aeb5acb,0x5aeb5aeb,
-0x5aca5aca,0x62eb62eb,0x6b2c630b,0x630b6b2c,0x5aca62eb,0x62eb5aca,0x630b630b,0x6b2c630b,0x630b6b2c,0x5aca62eb,0x630b62eb,0x62cb62eb,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x5aaa62eb,0x5aca5aaa,0x5aaa62eb,0x5aaa5aaa,0x5aaa5aca,0x5aca5aaa,0x5aaa5aca,0x5aaa5aaa,0x52aa5aaa,0x5aeb5aeb,0x5aca5aca,0x5aca5aca,0x5aca5aaa,0x5aaa62cb,0x6b2c62eb,0x5aca5aca,0x6b2c6b2c,
-0x7b8d734c,0x7bae7bad,0x732c7bad,0x734d6b0b,0x734d734c,0x738d738d,0x734c736d,0x7bae738d,0x738d736d,0x738d738d,0x734c738d,0x83ce6b2c,0x83ce8c30,0x8c0f736c,0x7b8d9450,0x738d734c,0x736d734c,0x6b2c6b4c,0x7bae6b4c,0x738d83ef,0x736d738d,0x6b4c738d,0x736d630b,0x6b4c738d,0x738d6b2c,0x734c736c,0x6b4c6b4c,0x734c7b8d,0x7bad7b8d,0x7b8d734c,0x734c83ef,0x7bce632b,
-0x734c734c,0x736d738d,0x6b4c738d,0x6b2c6b2c,0x8c2f7bae,0x6b4c83ef,0x7bae736d,0x6b2c7bae,0x630b630b,0x7bce736d,0x6b2c736d,0x736d6b4c,0x738d738d,0x6b2c734d,0x6b0c6b0c,0x6b2c6b0c,0x736d736d,0x736d6b4c,0x738d7bae,0x7b8d736d,0x7bae736d,0x7b8d734c,0x6b2c7b8d,0x7b8d734d,0x7bce738d,0x7bae7bce,0x738d7bce,0x7b8e6b4c,0x7b8e734d,0x83cf7bcf,0x83f07bcf,0x736d7bcf,
-0x8c30736d,0x7bae840f,0x6b4c738d,0x736d6b4c,0x5aca630b,0x6b4c6b0c,0x5aca62eb,0x62eb5aca,0x52a95289,0x52a95aaa,0x5aaa5aca,0x5aaa62cb,0x62eb5aca,0x62eb62eb,0x5aaa630b,0x62eb62cb,0x6b0c6b2c,0x62eb630b,0x62cb62ca,0x5a8962ca,0x5aaa5a89,0x62ca5aaa,0x62cb62eb,0x6b0b62eb,0x6b2c6b0b,0x62ca62eb,0x5a8962ca,0x5aca5aaa,0x62eb62eb,0x5aaa5aaa,0x5acb5acb,0x5aca5acb,
-0x5aca5aeb,0x5aaa5aca,0x528a5aca,0x6b2c6b2c,0x6b2c6b0b,0x62eb6b2c,0x6b2c62eb,0x6b2c6b4c,0x736d6b0b,0x5aca6b4c,0x62ca5a89,0x62cb62eb,0x62cb62eb,0x62eb62ca,0x62eb6b2c,0x630b62cb,0x62eb630b,0x62eb62eb,0x5aca5aeb,0x5aeb5aeb,0x5aca5aca,0x5aca52aa,0x5aaa5acb,0x62eb5aaa,0x62eb62eb,0x5acb5acb,0x5aca5acb,0x5acb5acb,0x5acb5aeb,0x62eb5aeb,0x5acb5aeb,0x5aeb5aeb,
-0x5aca5aca,0x62eb62eb,0x6b4c630b,0x630b6b2c,0x5aca5aaa,0x62eb62eb,0x630b62eb,0x6b2c6b2c,0x630b6b2c,0x6b2c630b,0x6b2c6b2c,0x736d6b2c,0x630b6b2c,0x630b6b0c,0x62cb62eb,0x5aaa62cb,0x5acb5aaa,0x5aaa5acb,0x5aaa528a,0x5aaa5aca,0x5aaa5aaa,0x5aca5aca,0x5aaa5aaa,0x52aa5aca,0x5aaa5aaa,0x5aca52aa,0x5aaa5aca,0x5aaa5a8a,0x5a895aaa,0x734c62eb,0x62eb62eb,0x6b2c6b4c,
-0x734c732c,0x736d7b6d,0x7b6d734c,0x62eb734d,0x736d734c,0x738d738d,0x736d736d,0x73ad738d,0x6b6d7bae,0x73ad738d,0x738d736d,0x7bae7b8d,0x83ee8c0f,0x732c7b8d,0x945083ee,0x734c7b6d,0x7b8d736c,0x736c736d,0x6b2c6b2c,0x7b8d8c30,0x7bae7bae,0x6b4c6b4c,0x6b6c736d,0x7bae738d,0x734c736d,0x736c738d,0x736d734c,0x7bad7b8d,0x7b6d736c,0x738d738d,0x738d736c,0x6b4c7bae,
-0x736d734c,0x83ef736d,0x736d7bce,0x738d736c,0x7bae7bad,0x83ef83ef,0x734c736d,0x7bce8c30,0x736d630c,0x6b4d6b2c,0x738d7bce,0x736d6b2c,0x738d734d,0x6b4d736d,0x6b2c6b4d,0x6b4c6b2c,0x62eb736d,0x736d736d,0x738d736d,0x7bae734c,0x734c7b8d,0x7bae736d,0x736d736d,0x7b8e734c,0x738d7bae,0x7bce7bce,0x7bae7bae,0x736d736d,0x736d736d,0x84108410,0x84109471,0x736d83f0,
-0x736d6b4d,0x736d6b4c,0x736d736d,0x736d7b8e,0x630b62cb,0x62eb6b2c,0x6b2c62eb,0x62eb62eb,0x5aca62eb,0x5aaa5aca,0x5aaa62cb,0x62eb62eb,0x62eb62cb,0x6b4c630b,0x62cb62eb,0x5aaa62eb,0x6b4c6b4c,0x630b6b4c,0x5aaa62ca,0x62ca62ca,0x5aaa5aaa,0x62eb62eb,0x5aaa62eb,0x62eb62ca,0x736d7b8d,0x62ea62ea,0x62ca6b0b,0x5aaa5aaa,0x5aca62cb,0x528a5289,0x5aaa5aaa,0x528a5aaa,
-0x52aa52aa,0x5aca5aaa,0x5289630b,0x62eb62eb,0x630b62ca,0x6b0b6b2c,0x630b630b,0x6b0b630b,0x62ea630b,0x5aca5aaa,0x62ca62ea,0x62eb62ca,0x62eb6b0b,0x62eb62eb,0x6b2c6b2c,0x5aca62eb,0x62eb6b2c,0x62eb5aca,0x630b630b,0x5aeb62eb,0x5aeb5aeb,0x5aca5aca,0x62eb62eb,0x62eb5acb,0x5acb62eb,0x5aeb5aeb,0x5acb5acb,0x62eb5acb,0x5acb5aeb,0x5aeb62eb,0x52aa5acb,0x5aca5acb,
-0x5aca62eb,0x630b62eb,0x630b630b,0x62eb62eb,0x5aaa630b,0x630c5aca,0x630b630c,0x632b630b,0x6b2c6b2c,0x6b2c6b2c,0x6b2c630b,0x7bce736d,0x6b4c7bae,0x630b630b,0x62eb62eb,0x5aaa62eb,0x5aca5aca,0x5aaa5aaa,0x5aca5aaa,0x5aca5aca,0x5aca5aca,0x5aaa5aca,0x5aaa528a,0x5aca5aeb,0x5aaa52aa,0x5aca5aaa,0x5aaa5acb,0x5aca5aaa,0x5a8a62eb,0x6b2c62ca,0x6b0b6b0c,0x630b6b2c,
-0x6b2b6b2b,0x734c734c,0x734c736d,0x6b0b6b0b,0x7b8d6b0b,0x736d83ef,0x738d6b4c,0x738d738d,0x738d7bae,0x738d738d,0x736d738d,0x83ef736d,0x7bad7bae,0x83ce83ce,0x83ce7b6d,0x736c8c0f,0x736c6b4c,0x6b4c734c,0x6b2c738d,0x7bae7bae,0x738d738d,0x738d738d,0x736d6b6c,0x738d736d,0x6b4c736d,0x736c7b8d,0x6b2c6b0b,0x7bad736c,0x7b6d7bad,0x734c734c,0x6b2b6b4c,0x736d738d,
-0x736d6b2c,0x6b4c630b,0x7bce738d,0x736c738d,0x6b2b736c,0x8c30736d,0x736d840f,0x83ef738d,0x736d738d,0x6b4c62eb,0x7bcf738e,0x6b2c738d,0x6b2c736d,0x738d736d,0x7bae6b2c,0x736d6b4c,0x6b2c6b4c,0x7bae738d,0x738d738d,0x736d7b8d,0x7b8d736d,0x734d736d,0x7b8d7b6d,0x83ce7b8d,0x736c7b8d,0x7b8d6b4c,0x736d738d,0x6b4c6b4c,0x7bae7bcf,0x7bae7bcf,0x83f083cf,0x6b4d7b8e,
-0x6b2c630c,0x736d6b4c,0x738d736d,0x6b4c7bae,0x6b4c62eb,0x6b2c6b2c,0x6b2c6b2c,0x62eb630b,0x62eb630b,0x5a8a62eb,0x5aaa5aaa,0x5aaa62cb,0x62cb630b,0x6b4c6b4c,0x62eb6b0c,0x6b2c5aaa,0x734c734c,0x62eb6b2c,0x5aaa6b0b,0x62cb62ca,0x62eb6b0b,0x62ca62ca,0x6b0b62eb,0x62ca62ca,0x6b2b6b0b,0x62eb6b0b,0x6b0b6b2b,0x5aca5aca,0x5aca62eb,0x52695269,0x5aaa5aca,0x5aaa5289,
-0x52aa5289,0x528a5aca,0x5aaa5289,0x630b5aca,0x62eb630b,0x6b2c6b2c,0x6b4c6b4c,0x62eb6b2c,0x5aa962ca,0x630b62eb,0x6b0b62ca,0x6b0b6b0c,0x62eb6b0b,0x62eb62eb,0x630b630b,0x62eb630b,0x6b4c632b,0x62eb62eb,0x5aca62eb,0x630b630b,0x62eb5aeb,0x630b630b,0x630b630b,0x62eb62eb,0x5aaa5aca,0x5acb5aca,0x52aa5aaa,0x528a52aa,0x5aeb52aa,0x5acb62eb,0x5aeb630b,0x5acb5aca,
-0x62eb5acb,0x5acb62eb,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x6b2c62eb,0x5aca630b,0x630b62eb,0x6b4c6b4c,0x5aca62eb,0x6b4c630b,0x83ce738d,0x7bae7bce,0x630b6b4c,0x62cb630b,0x62eb62eb,0x5aca62eb,0x5aaa5aca,0x5aca5aaa,0x52895aca,0x5aaa5aaa,0x5aaa5aca,0x5aaa5289,0x5aca5aca,0x5aaa5aaa,0x52895289,0x528a5aca,0x5aca5aaa,0x5aaa5aca,0x62eb5aaa,0x6b2c6b2c,0x62cb6b0b,
-0x734c732c,0x7bae6b2c,0x736d83ce,0x7bae7b8d,0x734c734c,0x7bce7bce,0x738d736d,0x738d7bae,0x7bce7bae,0x738d738d,0x738d7bce,0x83ef736d,0x7bae8c0f,0x83ee7bad,0x736c7bad,0x83ee83ce,0x738d7bce,0x736c736d,0x630b6b4c,0x83ef7bce,0x736d6b2c,0x738d738d,0x6b6c6b6c,0x6b2c6b2c,0x738d6b2c,0x6b2c736d,0x6b2c6b4c,0x736c734c,0x83ce736c,0x734c7b8d,0x630b6b4c,0x83ef6b0b,
-0x6b2c736d,0x6b2c7bae,0x738d736d,0x738d83ce,0x734c6b4c,0x7bae736d,0x736d83ce,0x738d734c,0x6b4d736d,0x736d736d,0x736d6b2c,0x738d7bae,0x6b2c6b2c,0x630b736d,0x7b8e738d,0x736d736d,0x734c736d,0x7bae738d,0x738d736d,0x7b8d7b8e,0x734c7b8d,0x736d734c,0x7b8e7b8d,0x7bad7b8d,0x736d736d,0x7b8d738d,0x734c736d,0x7b8e736d,0x83ef7bcf,0x7b8e7b8e,0x6b0c734d,0x734d736d,
-0x6b4c6b4c,0x736d6b4c,0x736d6b4c,0x6b4c738d,0x62eb62eb,0x6b2c630b,0x62eb630b,0x630b6b0b,0x632b630b,0x62cb630b,0x5aaa5aaa,0x62eb5aca,0x5a8a5aca,0x630b62eb,0x5aca5aca,0x736d630b,0x734c736d,0x62cb62cb,0x734c62eb,0x5aaa62eb,0x62eb62cb,0x6b0b6b2c,0x62ca62eb,0x5a895aaa,0x62eb62ca,0x62ca62eb,0x630b62eb,0x62eb62ca,0x630b62eb,0x528a5aca,0x5aca5aaa,0x630c5acb,
-0x52895aca,0x5aaa5aaa,0x52895289,0x62eb5aaa,0x630b630b,0x630b630b,0x6b0b6b2c,0x630b6b0b,0x62ea62eb,0x62eb62ea,0x6b2c62eb,0x62eb6b2c,0x6b0c62eb,0x62eb6b0c,0x6b2c630b,0x62eb6b2c,0x6b4c6b4c,0x5aca6b2c,0x62eb630b,0x630b52aa,0x5aeb630b,0x5aca5aca,0x5aca5aaa,0x630c62eb,0x5aca5aaa,0x5aca5aeb,0x5aca528a,0x5aab5acb,0x52aa5acb,0x5acb5aab,0x62eb5aeb,0x52aa5aeb,
-0x5aca5aaa,0x5acb5acb,0x5acb5acb,0x630c62eb,0x6b0b62eb,0x62ca62eb,0x62eb5aca,0x5aca630b,0x6b4c62eb,0x62eb6b2c,0x7b8d6b2c,0x738d7bae,0x7bae7bae,0x734d738d,0x6b2c734d,0x630b6b4c,0x62eb630b,0x5aaa5aaa,0x62eb5aca,0x52695aaa,0x5aaa5269,0x5aaa5aaa,0x5aaa5aca,0x52895289,0x630b5aeb,0x52895aaa,0x5aca5aaa,0x5aaa5aca,0x5aaa5aaa,0x5aaa5aaa,0x62ca5aaa,0x62cb62cb,
-0x734c8bef,0x6b2c732c,0x736d734c,0x83ef734d,0x734c7bae,0x7bae738d,0x736d736d,0x7bae7b8d,0x7bce7bae,0x736d738d,0x7bae736d,0x736d83ce,0x83ef83ef,0x7b8d7bad,0x7b8d7b8d,0x83ce7bad,0x7bce8c30,0x6b2c736d,0x630b630b,0x83ef738d,0x736d62eb,0x736d736d,0x738d736d,0x6b6c6b4c,0x736d6b2c,0x736d736c,0x6b2c734c,0x6b2b736c,0x83ce734c,0x736c83ce,0x736d6b2c,0x738d6b2c,
-0x7bae7bce,0x6b4c6b6c,0x738d6b4c,0x73ad73ad,0x6b4c6b4c,0x7b8d734c,0x736d738d,0x6b0b736d,0x630b632b,0x6b6c7bce,0x630b6b4c,0x7bae738d,0x734c738d,0x6b2c6b4c,0x736d734d,0x6b4c738d,0x736d736d,0x738d738d,0x736d736d,0x736d7b8d,0x6b2c734c,0x7b8d734d,0x734c734c,0x7b8d7b8d,0x736c734c,0x738d738d,0x738d7b8d,0x738d738e,0x7bae7bcf,0x62eb7b8e,0x6b2c5acb,0x6b4d6b2c,
-0x736d736d,0x736d736d,0x736d6b4d,0x736d7b8e,0x5aca62eb,0x6b2c62eb,0x62eb62eb,0x6b4c6b2c,0x6b4c6b4c,0x6b2c6b4c,0x5aca62eb,0x630b5aca,0x5aaa62eb,0x62cb62cb,0x6b0b62ca,0x734d6b2c,0x62eb6b2c,0x5aaa62cb,0x734d62ca,0x6b2c6b2c,0x6b2c6b0b,0x5aaa6b2c,0x62eb5a89,0x5a8a6b0b,0x62eb62ea,0x62eb6b0b,0x6b0b62eb,0x630b630b,0x5aca5aaa,0x5aca62eb,0x5aca5aaa,0x62eb5acb,
-0x5aca630b,0x5aaa5aca,0x528a5289,0x5aaa5aaa,0x6b0c5aca,0x6b4c630b,0x6b2c736d,0x6b2c630b,0x6b4c630b,0x6b2c6b2c,0x6b0b6b0b,0x6b2c734c,0x6b0b6b0b,0x736d6b2c,0x6b2c736d,0x62eb62eb,0x7bae62eb,0x62eb6b2c,0x62eb62eb,0x62eb630c,0x630b6b2c,0x62eb62eb,0x5acb5acb,0x6b4c6b0c,0x5aca62eb,0x5aca5aca,0x5aeb5acb,0x5aeb62eb,0x5acb62eb,0x5acb5acb,0x5acb5aaa,0x5aca5aeb,
-0x62eb5acb,0x630b62eb,0x62eb630b,0x630b62eb,0x630b5aaa,0x630b630b,0x62eb62eb,0x62eb630b,0x5aaa62eb,0x7bae62eb,0x7bae83ef,0x7bae736d,0x738d736d,0x7bae7bce,0x6b4c738d,0x630b6b4c,0x630b6b2c,0x5aaa62eb,0x5aca5aaa,0x5acb62cb,0x630c5acb,0x5aaa62eb,0x5aca5aca,0x5aca52aa,0x630b62eb,0x52a95aaa,0x5aaa5289,0x5289528a,0x5aca5aaa,0x5aca5aca,0x5aca5aca,0x62eb62eb,
-0x83ce83ee,0x734c736d,0x6b0b6b2c,0x734c6b2c,0x734c6b2c,0x738d738d,0x738d7bae,0x7bce738d,0x738e83ef,0x7bae738d,0x738d738d,0x7b8d7bae,0x8c3083ce,0x736c83ee,0x7b8d736c,0x736c7bad,0x7bae7bad,0x630b6b4c,0x6b4c6b2c,0x8c0f6b4c,0x734c6b0b,0x738d738d,0x738d738d,0x632b6b6c,0x6b2c6b4c,0x7bad6b4c,0x734c738d,0x734c736c,0x736c734c,0x83ce7bce,0x734c738d,0x736d6b2c,
-0x738d738d,0x738d738d,0x6b2c6b4c,0x7bce736c,0x736c738d,0x736d736d,0x736d734c,0x6b4c738d,0x6b4c630b,0x736d6b4c,0x736d6b4c,0x7bce6b4c,0x7bae8c30,0x736d6b4c,0x736d6b4c,0x7b8e7bae,0x6b4c6b4c,0x738d736d,0x736d736d,0x734c736d,0x6b2c734c,0x734d6b2c,0x734c734c,0x736c736c,0x7bad7bad,0x738d7bad,0x7b8d7bae,0x6b4c738d,0x738e738e,0x62cb6b2c,0x6b2c62eb,0x6b2d736d,
-0x6b4c6b4d,0x6b4d6b2c,0x734d6b4d,0x738d738d,0x736d6b4c,0x630b6b2c,0x5aca630b,0x62eb5aca,0x6b2c6b0c,0x6b2c630b,0x62eb62eb,0x62cb5aca,0x62eb62eb,0x62eb62eb,0x6b0c6b0b,0x62eb62eb,0x5aaa62eb,0x62ca6b0c,0x62cb5aaa,0x734c6b0b,0x62cb734c,0x62ca62ca,0x6b0b62cb,0x62ca6b0b,0x62ca5aca,0x6b0b6b0b,0x6b0b62eb,0x62eb630b,0x5aca62eb,0x5acb5aca,0x5aca5aca,0x6b2c62eb,
-0x5aeb632c,0x5aaa5aca,0x5aaa5289,0x52895aca,0x630b5a8a,0x7bae630b,0x736d7bae,0x736d6b4c,0x736d630b,0x6b2c734c,0x62eb6b0b,0x736d6b2c,0x734c734c,0x6b2c734c,0x6b2c6b2c,0x62eb6b0b,0x62eb6b0c,0x6b2c630c,0x630b630c,0x6b2c630b,0x630b630c,0x630c630c,0x62eb630b,0x6b0c6b2c,0x5aca630b,0x62eb5aca,0x5aeb5aeb,0x62eb5aeb,0x632c632c,0x5aca62eb,0x5aaa5aca,0x5aeb5aaa,
-0x5acb62eb,0x630c62eb,0x6b2c6b2c,0x5acb630b,0x62eb5aca,0x6b0b630b,0x630b6b0b,0x630b630b,0x62ca630b,0x6b4c62eb,0x738d7b8d,0x83ef7bae,0x736d736d,0x840f83ef,0x6b4c7bae,0x6b2c6b4c,0x6b2c6b2c,0x6b2c6b2c,0x62eb630b,0x62eb62eb,0x6b2c630c,0x5aca630b,0x5aaa5aca,0x5aca52aa,0x62eb62eb,0x62eb5aca,0x5aaa5aca,0x5aaa528a,0x5aaa5aaa,0x5aca5aaa,0x62ca5aca,0x62ca62eb,
-0x8c0f83ae,0x7bae83ef,0x732c736c,0x734c734d,0x7b8d734c,0x7b8d7bae,0x736d7bce,0x7bae736d,0x7bae7bae,0x7bae7bce,0x7bae7bae,0x83ce7b8d,0x8c2f83ce,0x83ce8c2f,0x736c736c,0x7b8d7b8d,0x736d6b0b,0x6b4c736c,0x6b2c6b2c,0x8c506b2c,0x6b2c7b8d,0x73ad736d,0x73ad736d,0x738d7bee,0x6b4c736d,0x736d6b2c,0x7bad83ce,0x7b8d734c,0x736c734c,0x7b8d736c,0x7b8d83ee,0x736d738d,
-0x6b2c738d,0x7bee7bce,0x736d6b6c,0x6b4c6b4c,0x840f7bad,0x6b4c738d,0x6b4c736d,0x7bae6b4c,0x738d738d,0x630b6b2b,0x736d73ad,0x7bce7bad,0x8c308c30,0x736d7bad,0x734c7bae,0x83ef738d,0x6b4c736d,0x736d6b4c,0x738d738d,0x736d736d,0x734d734c,0x6b2c734c,0x734c732c,0x736d734c,0x7bad7b8d,0x736c7bae,0x734c736d,0x738d738d,0x6b4d738d,0x6b2c6b2c,0x6b0c6b2c,0x736d734d,
-0x6b4d6b4d,0x6b2c6b2c,0x6b4d6b2c,0x738e738e,0x7bae738d,0x6b2c736d,0x62eb6b0c,0x5aaa5aca,0x62eb5aca,0x630b62eb,0x6b0c62eb,0x62eb62eb,0x6b2c62ca,0x6b0b732c,0x6b0c732c,0x62ca5aaa,0x5aaa62cb,0x6aeb6b0c,0x6b0b6aeb,0x6aeb6aeb,0x62ca6b0c,0x62eb62eb,0x6b2c62eb,0x62ca6b0b,0x5aaa5aaa,0x62eb62eb,0x6b0c62eb,0x630b6b0b,0x5aca630b,0x5aea5aca,0x5aca5aca,0x6b2c630b,
-0x528a630b,0x5acb528a,0x5aaa5aaa,0x5aaa5aca,0x630b5aca,0x7bae630b,0x736d738d,0x7b8d7bae,0x6b2c6b2c,0x62eb6b0c,0x6b2c6b0c,0x734d6b0b,0x6b2c6b2c,0x6b2b6b2b,0x6b2c6b2c,0x62eb6b0b,0x62eb62eb,0x6b4c734d,0x6b4c6b2c,0x630b6b2c,0x6b2c6b4c,0x630b6b2c,0x630b630b,0x62eb6b4c,0x62eb5aca,0x62eb630b,0x5aca5acb,0x5aeb5aeb,0x630c630c,0x5aca5aeb,0x5aca5aca,0x5aca5aaa,
-0x5acb62eb,0x62eb62eb,0x6b2c62eb,0x5acb630c,0x630b62eb,0x62eb5aca,0x7b8d734c,0x6b4c738d,0x6b0b6b2c,0x62eb630b,0x6b4c630b,0x738d738d,0x6b4c736d,0x7bce7bae,0x6b2c736d,0x6b4c6b4c,0x6b4c6b4d,0x6b4c6b4c,0x6b2c6b2c,0x62eb6b0c,0x630c630c,0x62eb630c,0x5aaa5aaa,0x5aca5aca,0x62eb630b,0x630b630b,0x5aaa62eb,0x5aca5aaa,0x5aaa5aaa,0x528a528a,0x5aca5aaa,0x5aca5aca,
-0x83ee8c0f,0x7b8d83ef,0x7bae7b8d,0x7b8d736d,0x7bae83ce,0x7bce83ce,0x6b2c7b8d,0x738d738d,0x738e736d,0x736d7bae,0x840f7bae,0x736d7bae,0x7bce83ce,0x8c2f83ee,0x736c83ce,0x736c736c,0x6b4c736c,0x7b8d736d,0x6b2c6b4c,0x83ce6b0b,0x736d7bce,0x6b2c6b2c,0x7bce738d,0x8c708c30,0x738d83ce,0x736c736d,0x83ef7bae,0x7b6d7b8d,0x736c7b6d,0x6b2b734c,0x83ce7b8d,0x6b2c840f,
-0x736d7bce,0x840f6b4c,0x738d83ef,0x6b4c738d,0x83ee736d,0x7bae7bce,0x736d7b8d,0x738d734c,0x7bad7bce,0x6b2b6b2c,0x738d6b4c,0x738d7bce,0x840f7bad,0x7bce7bce,0x734c7bae,0x736d6b4c,0x738d7bce,0x736d6b4c,0x738d738d,0x736d736d,0x736d6b0c,0x6b2c736d,0x6b0c6b2c,0x736d6b2c,0x736c6b4c,0x736c738d,0x6b4c6b4c,0x738d736d,0x6b2c736d,0x6b2c736d,0x6b2c6b0c,0x734d630c,
-0x736d736d,0x6b2c6b2c,0x6b2c6b0c,0x736d736d,0x6b4c736d,0x736d6b4c,0x6b2c6b4c,0x6b0b6b4c,0x62eb62cb,0x630b62eb,0x630b62eb,0x6b0b6b0b,0x736d6b0c,0x6b0b732c,0x6b2c734c,0x6aeb62cb,0x62eb62eb,0x62eb6aeb,0x736d6aeb,0x62eb6b0c,0x6b0b62eb,0x5a8a6b0b,0x736d5aaa,0x5aaa734c,0x62ca62cb,0x62ca62cb,0x6b0b62cb,0x6b4c6b2c,0x62ca62eb,0x5aea62eb,0x5aaa5aaa,0x5aca5aca,
-0x52aa5acb,0x5aaa528a,0x5aaa5aaa,0x5aca5aca,0x62eb62eb,0x738d630b,0x6b4c736d,0x736d738d,0x630b734d,0x62eb630b,0x6b2c6b0c,0x734c6b0b,0x6b0b6b2c,0x7b8d6b2c,0x738d7bce,0x6b4c6b4c,0x6b2c630b,0x7bae6b2c,0x736d83cf,0x6b4c6b2c,0x6b4c6b4c,0x6b2c6b4c,0x734c6b4c,0x6b0b7bae,0x630b62eb,0x630c630b,0x62eb630b,0x5aeb5aeb,0x52aa5aeb,0x630b5aeb,0x5aca5aaa,0x5aca62eb,
-0x62eb62eb,0x62eb630b,0x6b4c62eb,0x736d738d,0x62eb630b,0x62eb5aaa,0x738d736d,0x738d738d,0x62eb6b2c,0x6b2c62eb,0x630b6b2c,0x6b2c6b0b,0x630b6b2c,0x630b6b2c,0x630b62eb,0x630b6b2c,0x6b2c6b4d,0x6b2c6b2c,0x6b2c630c,0x6b2c6b2c,0x6b2c6b4c,0x630b630c,0x5aca5aca,0x5aeb5aeb,0x62eb62eb,0x5aca6b2c,0x5aaa5aca,0x5aaa5aca,0x5aaa5aaa,0x5aca5aca,0x5aca5aca,0x5aea5aca,
-0x8bef83ee,0x7bae7b8d,0x7b8d83ce,0x6b0b736d,0x736d734d,0x83ef7bce,0x736d83ef,0x736d738d,0x736d7bae,0x7bae736d,0x8c0f83cf,0x7bae83ef,0x7b8d7b8d,0x83ce7b8d,0x7bad83ee,0x6b2b736c,0x6b4c736d,0x736d6b2c,0x736d736d,0x738d6b4c,0x736d7bae,0x6b2c6b2c,0x73ad73ad,0x842f7bce,0x83ef8c30,0x738d7bce,0x83ce736c,0x7b8d83ee,0x736c7bad,0x734c736d,0x734c6b2b,0x7bae7bce,
-0x738d736d,0x73ae6b6c,0x6b4c8c30,0x7bce7bce,0x734c6b4c,0x8c307bce,0x736d7bce,0x6b4c736d,0x738d736d,0x6b4c73ad,0x6b4b6b4c,0x7bad7bad,0x7bad738d,0x83ef7bad,0x7b8d7bad,0x6b2b6b4c,0x7bae7bce,0x736d738d,0x736d736d,0x736d736d,0x734c734c,0x6b2c734c,0x732c732c,0x6b0c6b2c,0x6b4c6b4c,0x736d6b4c,0x6b2c736d,0x630b630b,0x736d6b2c,0x6b2c6b2c,0x630b6b0c,0x630c6b4c,
-0x736d6b4d,0x630c6b2c,0x6b2c6b0c,0x6b2c6b4d,0x734d738d,0x7bae736d,0x6b4c738d,0x6b4c736d,0x630b630b,0x6b0b6b0b,0x62eb6b0c,0x62eb62eb,0x734d734d,0x62eb6b0b,0x734c6b2c,0x732c732c,0x6b0c6b0b,0x62aa62cb,0x6b0c62ca,0x5aaa62cb,0x62ca62cb,0x6b0b62eb,0x6b2c6b2c,0x5aaa62eb,0x62ca62ca,0x5aaa62ca,0x62ca62ca,0x6b0b5aca,0x6b0b6b2c,0x5aca630b,0x5aaa5aaa,0x5aaa5aca,
-0x5aca5aaa,0x5aaa5aaa,0x5aca5aaa,0x62eb62eb,0x630b6b0c,0x734c6b2c,0x6b4c736d,0x6b2c6b4c,0x6b2c6b4c,0x630b6b0c,0x6b0b6b0b,0x6b2c6b0b,0x6b0b62eb,0x6b2b6b0b,0x736c6b4c,0x6b2b736c,0x62eb734c,0x6b2c6b2c,0x8c307bce,0x630b6b4c,0x6b2c6b4c,0x6b2c6b2c,0x734c734c,0x6b0b7bae,0x62eb6b2c,0x630b5aea,0x630c6b4c,0x62eb5acb,0x52aa5aeb,0x630c62eb,0x5aaa5aaa,0x5aca62eb,
-0x5acb62eb,0x630c630b,0x738d6b2c,0x7bce7bcf,0x630b630b,0x630b5aca,0x62eb6b2c,0x6b0b62ca,0x630b6b2c,0x62eb630b,0x630b62eb,0x630b6b2c,0x630b6b0b,0x5aca6b2b,0x62eb62ca,0x630b630b,0x630b630b,0x6b2c630c,0x6b2c6b2c,0x6b0c6b2c,0x6b2c630c,0x6b2c6b2c,0x62eb6b2c,0x5aaa5aca,0x630b630b,0x6b2c6b4c,0x62eb630b,0x5aaa5aca,0x52aa5289,0x5aca5aca,0x5aaa5aca,0x5aca5aca,
-0x83ce83ae,0x7bad83ce,0x7b8d7b8d,0x6b0b6b2c,0x736d6b0b,0x738d738d,0x7bae840f,0x736d738d,0x7bae736d,0x736d736d,0x83ce83ef,0x83ef83cf,0x7b8d7b8d,0x736c734c,0x7bad7bcd,0x736c738d,0x736d6b2c,0x6b2c6b4c,0x738d738d,0x734c6b4c,0x6b2c7bce,0x736d6b4c,0x738d6b4c,0x83ef840f,0x94718c30,0x736d840f,0x738d734c,0x83ce83ce,0x7bad736c,0x6b0b736d,0x736d6b0b,0x83ef736d,
-0x738d738d,0x73ad83ef,0x840f6b4c,0x6b6c736d,0x6b2c736d,0x8c30736d,0x6b4c83ef,0x736d6b4c,0x73ad6b2c,0x7bad738d,0x6b4c6b4c,0x8c506b2b,0x840f9470,0x736d7bae,0x7b8d840f,0x736d6b4c,0x738d6b4c,0x736d73ad,0x738d736d,0x736d738d,0x6b2c734c,0x736d736d,0x6b2c734c,0x6b0b6b2c,0x630b6b2b,0x736d630b,0x6b2c734c,0x6b2c630b,0x6b2c6b2c,0x6b2c6b4c,0x6b2c6b2c,0x6b4c6b2c,
-0x736d6b4c,0x6b4c736d,0x736d734d,0x6b4c736d,0x7b8e736d,0x738d736d,0x6b4c738d,0x6b4c6b2c,0x6b0c6b4c,0x734c6b2c,0x6b2c736d,0x6b0c6b2c,0x734c736d,0x6b0c6b2c,0x734d6b0c,0x7b8e7b8e,0x6b0b6aeb,0x62ca62eb,0x6aeb6b2c,0x62aa62eb,0x62ca62aa,0x734c6b0c,0x62ca6b2c,0x62cb5a89,0x62ca5aaa,0x62eb62eb,0x62ca62eb,0x62eb5a8a,0x62eb6b2c,0x630b62eb,0x5aea630b,0x5aaa5aaa,
-0x5aaa5aaa,0x5acb528a,0x5aaa5acb,0x6b4c630b,0x6b2c6b4c,0x6b2c6b4c,0x734c738d,0x6b4c6b2c,0x6b4c6b2c,0x630b630b,0x62eb62eb,0x62eb6b0b,0x6b0b6b2c,0x734c6b0b,0x6b4c736c,0x6b2c6b2c,0x62eb6b0b,0x736d6b2c,0x736d6b4c,0x6b2c736d,0x6b4c7b8d,0x6b2c6b2c,0x6b2c6b4c,0x6b0b7b8e,0x630b630b,0x62eb62eb,0x6b2c6b2c,0x62eb62eb,0x630b632c,0x62eb62eb,0x5aca5acb,0x5aaa5aaa,
-0x5aca62eb,0x6b2c62eb,0x6b4d6b2c,0x6b4c736d,0x6b4c6b2c,0x62ca62eb,0x62eb630b,0x6b2c630b,0x62eb6b2c,0x630b62eb,0x630b62eb,0x62eb6b0b,0x6b2c6b2c,0x630b6b4c,0x62ea630b,0x6b2b62ea,0x62eb6b2c,0x62eb5acb,0x6b2c6b2c,0x62eb6b2c,0x6b4d6b2c,0x6b2c6b2c,0x6b2c736d,0x630b62eb,0x630b630b,0x7bae736d,0x6b2c6b4c,0x5aaa5aca,0x52aa52aa,0x52a952a9,0x5aca5aaa,0x62ea5aea,
-0x7b8d736d,0x8c0f83ce,0x83ae6b2b,0x6b2b7bad,0x734c734c,0x736d736d,0x7bae738d,0x736d738d,0x73ad7bae,0x738d738d,0x738d738d,0x738d738d,0x7bae7bae,0x738d738d,0x7bce7bae,0x7bce7bae,0x738d736c,0x6b4c6b4c,0x7bad736d,0x736d7b8d,0x738d83ef,0x736d6b4c,0x6b2c738d,0x7bae6b4c,0x840f7bce,0x7bae83ef,0x736c738d,0x736d738d,0x7bad738d,0x6b2b734c,0x6b6c6b2c,0x6b4c736d,
-0x736d738d,0x8c308c10,0x6b2c7bae,0x738d7bae,0x736d736d,0x7bae6b2c,0x7bae738d,0x6b2b736d,0x6b2b6b2b,0x7bae7bad,0x738d736c,0x7bad7bce,0x7bce9491,0x7bae7bae,0x83ef7bae,0x738d7bae,0x738d6b6c,0x736d736d,0x7b8d7b8d,0x7b8e7b8d,0x734c734c,0x734c736c,0x6b2c6b4c,0x6b2c6b2b,0x6b2b630b,0x6b4c6b4c,0x6b4c6b2c,0x630b6b4c,0x630c630c,0x736d6b4d,0x6b2c736d,0x6b4d6b2c,
-0x6b6c736d,0x738d6b6c,0x736d736d,0x6b2c736d,0x736d6b4c,0x736d738d,0x738d6b4c,0x6b0b6b4c,0x6b0b6b2c,0x732c6aeb,0x7b8d732c,0x732c7b6d,0x6b0c6b0b,0x6b0b6b0b,0x83ae732c,0x7bae7bae,0x6b2b7b8d,0x6b0b6b2c,0x62eb6b0b,0x62eb62eb,0x6b2c6b0b,0x7b8d736d,0x62ca62eb,0x5aaa5aaa,0x62aa62cb,0x62cb5a8a,0x6b0c62ca,0x62cb6b0c,0x62cb62ca,0x630b62eb,0x5aca62eb,0x52895aca,
-0x5aaa528a,0x62eb5acb,0x630b630b,0x6b2c630b,0x630b630b,0x6b2c630b,0x6b2c6b4c,0x6b4c736d,0x6b2c6b2c,0x6b2c6b0c,0x62cb6b0c,0x62eb62eb,0x6b2b630b,0x736c736c,0x6b0b6b4c,0x630b6b2b,0x6b2c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x6b4c6b2c,0x6b2c736d,0x6b0b734c,0x7b8d6b0b,0x734c732c,0x632b6b4c,0x5aca62eb,0x632c5aca,0x5aeb632c,0x5aca5aeb,0x5aca630b,0x5aca5aca,0x62eb62eb,
-0x62eb62eb,0x630b630b,0x632b632b,0x6b4c6b2c,0x6b4c6b6c,0x6b2c6b6c,0x630b62eb,0x630b5aea,0x5aea630b,0x62eb5aea,0x630b630b,0x630b6b2c,0x630b630b,0x630b630b,0x632b630b,0x630b6b2c,0x632b6b4c,0x630b630b,0x6b2c630b,0x6b2c6b2c,0x738d6b4c,0x6b4c736d,0x6b4c6b4c,0x6b4c6b2c,0x736d6b4c,0x6b4d738d,0x630b6b2c,0x62eb5acb,0x5aca5aca,0x5aaa5aaa,0x62cb5aaa,0x5aaa62eb,
-0x83ce83ce,0x734c8c0f,0x734c7bad,0x7bad734c,0x734d734c,0x738d6b2c,0x736d7b8d,0x7bae7bae,0x73ad7bad,0x738d738d,0x738d738d,0x736d738d,0x736d6b4c,0x7bad738d,0x7b8d7bad,0x83ef7bad,0x738d7bae,0x6b4c6b4c,0x6b4c6b4c,0x738d734c,0x734c83ee,0x736d6b4c,0x6b4c736d,0x736d736d,0x736d738d,0x738d736d,0x736d7bae,0x736c736d,0x7b8d736c,0x734c734c,0x6b2b738d,0x738d630b,
-0x7bae6b2c,0x840f9451,0x7bae7bae,0x8c50736d,0x736d8c0f,0x6b4c6b4c,0x83ce736d,0x630b7b8d,0x6b4c6b0b,0x94707bae,0x83ef9491,0x736d736d,0x7bce734c,0x7bae7bce,0x7bce7bce,0x7bae83ef,0x738d738d,0x7bae7bae,0x7b8d83ce,0x7bae7b8d,0x734d7b8d,0x734c734c,0x736d736c,0x6b4c6b4c,0x6b4c6b4c,0x736d6b6c,0x6b4c736d,0x630c6b2c,0x6b2c630c,0x738d6b4d,0x7bae7bae,0x6b2c736d,
-0x6b4c6b4c,0x6b4c6b4c,0x738d734c,0x6b2c7b8d,0x736d6b2c,0x736d6b4c,0x6b2c736d,0x6b4c736d,0x734c630b,0x734d734c,0x6b0c734c,0x83ae6b0c,0x6aeb734d,0x83ae734d,0x736d736d,0x734c7b6d,0x7b8d736c,0x6b0b6b2c,0x6b2c7b8d,0x6b2c62eb,0x62eb6b0b,0x6b0b62eb,0x62eb6b2c,0x5a895aaa,0x62cb5a8a,0x526962aa,0x62aa62aa,0x62eb62cb,0x5aaa62eb,0x62eb5aca,0x5aaa5aaa,0x5a8a5aca,
-0x62eb5aca,0x630c630c,0x630b630c,0x630c630b,0x62eb6b2c,0x6b2c630b,0x6b2c630b,0x630b6b4c,0x6b2c6b0c,0x734c734c,0x62eb630c,0x62eb62eb,0x6b2c734c,0x736c734c,0x630b6b4c,0x62eb630b,0x6b2c6b2c,0x6b4c6b2c,0x6b2c6b4c,0x6b2c6b2c,0x6b2c734c,0x736d6b0c,0x83ce6b2c,0x6b2c6b0c,0x630b6b2c,0x62eb630b,0x632c5aeb,0x632c6b4c,0x5aca5aca,0x5aeb5aeb,0x62eb62eb,0x6b2c6b4c,
-0x632b630b,0x6b2c6b2c,0x630b630b,0x6b2c630b,0x6b2c630b,0x6b2c736d,0x6b2c630b,0x630b62eb,0x62eb630b,0x630b630b,0x62eb62eb,0x632b630b,0x630b630b,0x632b632b,0x632b630b,0x630b632b,0x630b630b,0x630b630b,0x6b4c630b,0x6b4c736d,0x6b4c6b4c,0x736d736d,0x6b2c6b4c,0x6b4c6b4c,0x7bae6b4d,0x736d7bce,0x630c6b2c,0x5aaa5aca,0x630b630b,0x5aaa5aca,0x5aca62eb,0x62eb5aaa,
-0xb55483ce,0x6b2b8bef,0x736d7b8d,0x734c6b0b,0x6b0b738d,0x736d6b4c,0x7bce7bae,0x7bae736d,0x738d73ad,0x736c736d,0x736c736c,0x736d736d,0x6b4c736d,0x738d736c,0x7b8d7b8d,0x7bad7b8d,0x73ad7bce,0x6b6c736c,0x6b4c6b6c,0x736c6b2c,0x738d840f,0x736d6b4c,0x736d738d,0x6b6c6b4c,0x736d630b,0x736d736d,0x736d7bae,0x734c6b4c,0x736d6b4c,0x736d736d,0x6b4c6b6c,0x6b4c6b6c,
-0x736d6b0b,0x840f8c30,0x83ef7b8d,0x736d7bce,0x738d83ef,0x6b4c734c,0x7b8d6b4c,0x630b6b4c,0x6b4c5aa9,0x7bad736c,0x7bad83ce,0x6b2b734c,0x736d736d,0x7bce9471,0x738d7bce,0x83ef7bce,0x7bae7bae,0x7bae736d,0x7bce7b8d,0x734d7b8d,0x736d7b8d,0x6b4c736d,0x736d6b4c,0x6b4c6b6c,0x736c736c,0x6b6c6b4c,0x6b4c736d,0x6b2c6b2c,0x6b2c6b2c,0x6b4d6b2c,0x738d738d,0x6b4c736d,
-0x6b4c6b4c,0x6b4c6b2c,0x736d6b4c,0x6b2c736d,0x6b2c6b2c,0x6b4c6b4c,0x6b4c736d,0x736d6b4c,0x6b2c6b2c,0x6b0c6b0b,0x6b0c732c,0x734d6b0b,0x7b6d83cf,0x736d7b8d,0x62eb6b2b,0x734c6b0b,0x7b8d6b2b,0x6b0b6b2b,0x6b0b6b2c,0x5aaa62cb,0x5aaa62ca,0x5aaa5aaa,0x62cb6b0c,0x5aaa5aaa,0x62cb5a8a,0x5a6962ca,0x62aa62cb,0x5aaa5aaa,0x62ca62cb,0x5aaa5289,0x5aaa5aca,0x5aaa5289,
-0x630b62eb,0x6b2c6b2c,0x6b4c6b2c,0x630b6b2c,0x6b0b62eb,0x62ea5aca,0x7bce734c,0x630b62ea,0x6b0b6b0b,0x6b2c6b2c,0x62eb6aec,0x62cb62eb,0x62eb5aca,0x6b0b6b0b,0x734c734c,0x6b0c6b4c,0x6b0b630b,0x6b2c6b2c,0x630b6b2c,0x630b630b,0x6b2c6b4c,0x736d6b0c,0x83ce6b2c,0x734c6b2c,0x630b630b,0x62eb630b,0x62eb5aeb,0x630b630b,0x630b630b,0x630b5aeb,0x62eb6b2c,0x6b2c6b4c,
-0x632b632b,0x632b632b,0x630b630b,0x6b2c632b,0x62eb632b,0x6b2c6b2c,0x62eb6b2c,0x630b62ca,0x630b630b,0x6b2c6b2c,0x62eb630b,0x630b630b,0x630b630b,0x630b630b,0x630b630b,0x62eb630b,0x6b2c630b,0x6b2c6b2c,0x6b2c630c,0x6b2c6b4c,0x6b2c6b4c,0x736d6b4c,0x6b2c6b4c,0x6b4c6b4c,0x736d6b4c,0x738d738d,0x630b6b4c,0x630b5aca,0x62eb62eb,0x5aca5aca,0x5aca62eb,0x62eb5aaa,
-0xad1383ee,0x734c83ee,0x7b6d734c,0x62eb736d,0x6b2c6b4c,0x736d6b0b,0x7bce7bce,0x736d7bae,0x738d738d,0x6b4c6b6c,0x736c6b4c,0x738d736d,0x736d7bae,0x6b4c736c,0x7b8d734c,0x6b4c7b8d,0x7bce7bad,0x738d7bad,0x738d738d,0x6b2c6b4c,0x8c50840f,0x738d6b6c,0x73ad7bae,0x736d6b2c,0x736d6b2c,0x736d736d,0x738d738d,0x734c736d,0x6b4c7b8d,0x738d734c,0x6b4c736c,0x6b4c736d,
-0x8c0f6b2c,0x7bae9cb2,0x7bae83ce,0x6b2c7bae,0x7bae7bae,0x6b2c6b0b,0x734ca4f3,0x6b2b6b0b,0x7b8d736d,0x62eb6b0b,0x83ef736c,0x738d8c30,0x6b2c6b2c,0x8c30736d,0x7bae7bae,0x840f7bae,0x7bce8c30,0x6b4c7bae,0x7bae7bae,0x734d83ce,0x736d734c,0x6b2c738d,0x6b4c630b,0x6b4c6b4c,0x736c738d,0x630b6b2c,0x6b2c6b2c,0x6b2c6b2c,0x630c6b4d,0x630c630b,0x6b2c6b2c,0x6b4c6b2c,
-0x6b4c736d,0x6b4c6b2c,0x6b2c6b4c,0x6b2c6b2c,0x6b2c6b4c,0x630b6b4c,0x738d736d,0x6b4c6b4c,0x734c736d,0x6b0c6b2c,0x732c6b0c,0x734d734c,0x7bae734d,0x6b0c83ae,0x6b0b6b0b,0x734c6b2b,0x7b8d6b2b,0x6b4c6b4c,0x62eb6b0b,0x62cb6b0c,0x62ca5aaa,0x62ca62cb,0x5aaa62eb,0x62eb5aca,0x62eb62aa,0x6aeb6aeb,0x62aa5aaa,0x5aaa5aaa,0x62ca5aaa,0x5aca5289,0x5aca630b,0x62eb5aaa,
-0x630b62eb,0x6b2c6b2c,0x736d6b4c,0x6b2c6b4c,0x62eb62eb,0x734c6b0b,0x7bae734c,0x6b2b734c,0x62ca6b2c,0x6b0c6b0b,0x6b0c6b0c,0x62cb62eb,0x62eb5aca,0x630b630b,0x738d736d,0x6b4c736d,0x6b2c630b,0x6b2c6b2c,0x62eb630b,0x6b2c630b,0x6b2c6b2c,0x6b0b6b2c,0x7bae6b2c,0x6b2c734d,0x630b6b0b,0x630b630b,0x5aeb630b,0x5aeb5aeb,0x630b6b4c,0x632c5aeb,0x5aca630c,0x630b630b,
-0x630b6b2c,0x630b630b,0x632b630b,0x632b632b,0x5aca6b4c,0x62eb62eb,0x630b6b2c,0x62eb62eb,0x630b62eb,0x6b4c6b4c,0x630b6b2c,0x62eb630b,0x6b2c630b,0x630b630b,0x632b632b,0x632b630b,0x630b6b2c,0x6b2c630c,0x6b2c6b2c,0x6b4c6b4c,0x630b6b2c,0x6b4c6b2c,0x6b2c6b2c,0x6b2c6b4c,0x6b2c6b2c,0x6b4c6b4c,0x630b6b2c,0x6b2c62eb,0x5aca630b,0x62eb62eb,0x6b4c62eb,0x62eb736d,
-0x7bada4d2,0x8bef83ae,0x734c62ea,0x734c736c,0x6b2b6b0b,0x738d6b2c,0x738d7bae,0x736d7b8d,0x738d738d,0x6b4c736c,0x738d736d,0x738d738d,0x736d738d,0x6b4c736d,0x736c6b2c,0x736d7b8d,0x7bee7bae,0x738d83ef,0x738d736d,0x6b4c6b4c,0x9c917bae,0x73ad736d,0x7bae7bae,0x736d6b6c,0x6b4c7bce,0x738d6b4c,0x7bae738d,0x736d7bae,0x736d6b4c,0x6b4c6b2c,0x738d73ad,0x738d736d,
-0x840f6b4c,0x6b4c9cb2,0x736d7bae,0x738d736c,0x7bce738d,0x73ad9491,0x8c709cf2,0x7bad7bad,0x7bae7b8d,0x736d736c,0x7bad738d,0x840f8c2f,0x738d736d,0x7bae7bae,0x83ef8c50,0x7bae7bce,0x83ef8410,0x7bee7bae,0x736d736d,0x7bce738d,0x6b4c6b4c,0x734c736d,0x6b4c6b4c,0x6b4c6b4c,0x736c736c,0x62eb6b2c,0x6b2c630b,0x6b0c6b0c,0x6b0c736d,0x630b62eb,0x6b2c6b2c,0x6b0c6b2c,
-0x6b4c6b4c,0x6b4c6b2c,0x630b6b4c,0x6b2c6b0b,0x734c6b2c,0x6b2c62eb,0x6b4c6b4c,0x6b2c6b4c,0x736d736d,0x6b0b6b2c,0x6b2c6b2c,0x7b6d732c,0x7b8d6b0c,0x734c83cf,0x734c734c,0x6b0b6b4c,0x7b8d734c,0x6b4c6b2b,0x62cb6b0b,0x62eb62eb,0x62cb62cb,0x62eb62cb,0x62eb5aca,0x5aaa62cb,0x6aeb6aeb,0x62eb6b0b,0x62eb5a8a,0x5aaa62ca,0x5a8a62ca,0x6b4c62eb,0x5aaa62cb,0x6b0c6b0c,
-0x62eb62ca,0x736c6b2c,0x6b2c734c,0x734c6b2c,0x6b0b6b2b,0x736c6b2c,0x7b8d734c,0x6b0b7bad,0x6b0c732c,0x6b2c732c,0x6b2c6b0c,0x62eb6b0b,0x62eb6b2c,0x630b62ea,0x6b4c736d,0x6b4d6b2c,0x6b2c6b2c,0x6b4c6b4c,0x6b2c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x62eb6b0b,0x83ce7b8d,0x62eb736d,0x630b630b,0x630b630b,0x62eb630b,0x5aeb5aeb,0x630b632c,0x630b62eb,0x5aca62eb,0x62eb5aca,
-0x6b2c6b2c,0x630b630b,0x62eb630b,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x6b4c6b2c,0x5aca6b2c,0x5aea5aca,0x6b4c630b,0x630b6b2c,0x62eb630b,0x630b630b,0x62eb62eb,0x630b630b,0x632b630b,0x630b6b2c,0x6b2c630b,0x6b2c6b2c,0x6b2c6b2c,0x6b2c630b,0x630b632b,0x6b4c6b2c,0x6b4c6b2c,0x6b4c632c,0x630b6b4c,0x632b630b,0x630b630b,0x62eb6b4c,0x5aca5acb,0x738d62eb,0x6b2c7bae,
-0x736ca4d2,0x83ee83ee,0x6b0b736c,0x738d736c,0x6b0b6b4c,0x736c734c,0x738d738d,0x738d6b4c,0x738d738d,0x736c736d,0x73ad738d,0x738d73ad,0x736d738d,0x736d736d,0x6b2c6b4c,0x736d734c,0x73ad738d,0x73ad7bce,0x736d736d,0x736d6b2c,0x8c0f736d,0x7bce6b4c,0x736d738d,0x736d736d,0x73ad7bae,0x734c736d,0x7bae738d,0x7bae736d,0x738d736d,0x6b2c6b2c,0x7bae736d,0x6b2c738d,
-0x62eb630b,0x736c736c,0x6b4c6b4c,0x6b2b738d,0x738d738d,0x840f73ad,0x7bce7bee,0x738d7bce,0x8c0f7bad,0x7bae83ee,0x7bce7bce,0x7bad7bae,0x738d83ef,0x7b8d7bae,0x94918c30,0x83ce83ef,0x7bae738e,0x7bee840f,0x6b2c7bae,0x7bae736d,0x734c7bce,0x738d6b4c,0x73ad7bce,0x6b4c6b4c,0x736c6b4c,0x6b2c6b4c,0x6b2c6b2c,0x62eb6b0c,0x736d734d,0x630b6b4c,0x6b2c630b,0x630b6b2c,
-0x6b6c630b,0x6b4c6b4c,0x6b0b6b2c,0x630b6b2c,0x6b2c6b2c,0x6b2c62eb,0x6b2c630b,0x6b4c630c,0x6b2c736d,0x6b0c6b2c,0x6b2c6b2c,0x734c734c,0x7b8d734c,0x734d7b8d,0x6b4c738d,0x62eb62ca,0x6b2c734c,0x62eb62eb,0x62eb62ca,0x62cb6b2c,0x5aaa5aaa,0x62eb5aaa,0x62eb5aaa,0x5aaa62eb,0x6b0c62cb,0x62aa734c,0x6aeb62cb,0x5aaa62cb,0x5aaa62ca,0x6b2c62eb,0x5aca62cb,0x6b0c6b2c,
-0x62cb62eb,0x736c6b0b,0x734c738d,0x734c6b2c,0x734c736d,0x6b0b6b0b,0x736c7b6d,0x6b2c7b8d,0x7b8e732c,0x734d83ae,0x6b2c6b0c,0x62eb6b0b,0x62eb62eb,0x6b2b630b,0x6b2c736d,0x6b2c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x6b4c6b4c,0x62eb6b2c,0x630b6b2c,0x6b2c62ca,0x7bae83ce,0x62eb732c,0x62eb630b,0x5aca5aca,0x62eb62eb,0x5aca5aca,0x630b5aeb,0x630b6b2c,0x630b5acb,0x5aca62eb,
-0x6b2c630b,0x630b6b2c,0x5aaa5aea,0x62eb5aca,0x630b62eb,0x630b6b0b,0x6b2c6b2c,0x630b6b2c,0x5aca62eb,0x630b62eb,0x6b2c632b,0x630b632b,0x62eb62eb,0x630b62eb,0x630b630b,0x630b630b,0x632b630b,0x630c6b2c,0x6b2c630c,0x62eb6b2c,0x6b2c62eb,0x630b632b,0x6b2c6b2c,0x6b4c6b2c,0x6b4c6b2c,0x630b6b4c,0x6b2c630b,0x630b630b,0x6b2c630b,0x5aca630b,0x62eb5acb,0x6b2c62eb,
-0x8c0f83ee,0x83ad7b8d,0x83ce7b8d,0x7bad738d,0x736d736d,0x736d6b2c,0x736c738d,0x736c738d,0x738d738d,0x736c736c,0x738d736d,0x736d738d,0x736d73ad,0x736d6b4c,0x6b4c736c,0x6b4c6b2c,0x6b4c736d,0x73ad738d,0x738d7bae,0x738d6b4c,0x83ef736d,0x738d738d,0x736d73ad,0x736c736c,0x7bce6b6c,0x6b6c7bae,0x738d738d,0x7bae6b2c,0x7bae8c30,0x6b4c6b4c,0x6b2c6b4c,0x73ae738d,
-0x7bad738d,0x736c5aea,0x630b6b4c,0x6b4c6b6c,0x840f73ad,0x6b6c73ad,0x6b2b738d,0x7bae6b4c,0x8c307b8d,0x840f9470,0x7b8d7bae,0x738d738d,0x83ce8c2f,0x736d7bae,0x7bae83ef,0x738d840f,0x7bce736d,0x8c3083ef,0x7bae83ef,0x738d736d,0x738d83ce,0x738d736d,0x7bce7bce,0x6b4c736d,0x6b4c6b4c,0x6b4c6b4c,0x6b2c6b2c,0x630b6b2c,0x736d6b4c,0x6b2c736d,0x62eb62eb,0x6b2c6b0c,
-0x736d632b,0x6b2c6b6c,0x6b0b6b2c,0x630b6b2c,0x630b6b2c,0x6b2c6b2c,0x6b2c630b,0x6b2c630b,0x6b4c6b4c,0x736d738d,0x6b0c6b2c,0x734c736d,0x734c6b2c,0x6b4c6b2c,0x736d7bae,0x630b62eb,0x62eb6b2b,0x6b0c6b0c,0x7b8d6b2c,0x7bae83ef,0x5aca62eb,0x62cb5aca,0x5aca5aca,0x62eb62eb,0x6aeb5aaa,0x6b0c7b8d,0x62ca62cb,0x62cb62ca,0x62eb62cb,0x5aca5aca,0x6b0c630b,0x630b630b,
-0x62eb6b2c,0x6b4c62eb,0x734c736d,0x734c6b4c,0x6b2b736d,0x734c736d,0x732c6b2c,0x7b8d83ce,0x83cf734c,0x736d83cf,0x6aec6b2c,0x62eb62eb,0x6b2c62eb,0x6b4c736d,0x6b4c6b4c,0x630b6b4c,0x6b0b6b2c,0x6b2c6b0b,0x6b4c6b4c,0x5aca630b,0x62eb630b,0x6b2c62eb,0x736d83cf,0x62eb6b2c,0x630b6b2c,0x5aca5aca,0x62eb62eb,0x5aca5aca,0x630b5acb,0x6b2c630b,0x632b630b,0x5aca630b,
-0x630b5aea,0x630b630b,0x5aca62eb,0x630b62eb,0x6b2c6b0b,0x6b0b6b0b,0x62eb62eb,0x6b2c630b,0x62eb630b,0x630b62eb,0x630b630b,0x632b6b2c,0x630b632b,0x6b2c630b,0x6b2c6b2c,0x630b632b,0x62eb5aea,0x630b630b,0x6b2c630b,0x6b2c6b4c,0x6b2c630b,0x632b6b2c,0x632b632b,0x6b4c6b2b,0x630b6b2c,0x632c630b,0x632b6b4c,0x6b2c630b,0x6b2c62eb,0x6b2c6b4c,0x5aaa630b,0x62ec5aaa,
-0x83ee8c0f,0x736c7bad,0x8c0f83ce,0x7bad736c,0x7bad7b8d,0x736c7bae,0x7b8d736c,0x738d738d,0x738d738d,0x6b4c736c,0x738d6b6c,0x736d738d,0x738d738d,0x6b4c6b4c,0x736c736c,0x736d734c,0x6b4c73ad,0x738d736d,0x7bce7bce,0x7b8d738d,0x94507b8d,0x630b840f,0x7bce7bae,0x736c738d,0x6b4c738d,0x7bce73ad,0x736d736d,0x736d736d,0x83ef7bae,0x6b2c738d,0x6b4c6b2c,0xa533840f,
-0xad33ad54,0x630b6b4c,0x6b4c6b4c,0x7bce6b2b,0x7bce9491,0x736c6b4c,0x736c6b2b,0x6b4c6b2c,0x738d83ce,0x94918c0f,0x7bad8c0f,0x7bae7b8d,0x8c2f83ce,0x7bae840f,0x947183ef,0x8c508c30,0x7bae738d,0x8c5083ef,0x7bae8c50,0x738d734c,0x7b8d736d,0x736d7bae,0x7bce738d,0x736d7bae,0x6b2c736d,0x6b2c6b2c,0x6b0b6b0b,0x6b2c6b2c,0x6b2c6b2c,0x6b4c6b2c,0x6b0c6b2c,0x6b2c630b,
-0x736d6b2c,0x6b2c6b4c,0x6b0b6b2c,0x6b2c6b2c,0x6b2c6b0c,0x6b2c6b2c,0x6b2c6b2c,0x5aca6b4c,0x738d62eb,0x6b2c7bae,0x734c736d,0x6b2c6b0c,0x6b0c736d,0x6b4c6b2c,0x7b8d6b2c,0x62eb736d,0x6b0b6b2c,0x734c6b2c,0x736d7bae,0x8c507bae,0x6b2c736d,0x5aca62eb,0x5aca630b,0x6b2c62eb,0x5aaa732c,0x732c6aeb,0x6aeb62ca,0x5aaa62cb,0x6b0b62eb,0x62eb62eb,0x6b4c6b0c,0x630b6b4c,
-0x734c734d,0x6b4c6b4c,0x630b6b2b,0x736c6b2b,0x736c734c,0x6b2c7b6d,0x736d736c,0x8bef7b8d,0x83cf7b6d,0x734d7b8e,0x62cb6b2c,0x6b0c62eb,0x630b630b,0x6b2c6b4c,0x630b632b,0x6b2c6b2c,0x6b2c6b0c,0x6b2c6b2c,0x6b2c6b4c,0x62eb630b,0x62ca62eb,0x62eb6b0b,0x736d8c30,0x5aaa734d,0x630b6b0b,0x5aca5aea,0x630b630b,0x5aaa5aca,0x630b62eb,0x6b2c5aca,0x630b630b,0x62eb630b,
-0x5aca5aca,0x62eb62eb,0x630b630b,0x630b630b,0x6b2c62ca,0x6b0b6b0b,0x630b62eb,0x62eb630b,0x630b6b2c,0x630b630b,0x630b62eb,0x630b630b,0x62eb6b2c,0x630b630b,0x630b630b,0x630b632b,0x630b630b,0x6b2c632b,0x630b630b,0x6b4c6b2c,0x630b6b2c,0x6b4c6b2c,0x630b630b,0x6b4c6b4c,0x632c6b4c,0x630b632c,0x630b632b,0x630b5aeb,0x62eb630b,0x6b2c630b,0x6b2c6b2c,0x62eb630c,
-0x83cd83ee,0x7b6c7bad,0x7b8d736c,0x7bce7bad,0x736c736c,0x6b4c736c,0x736d734c,0x7b8d738d,0x738d738d,0x738d738d,0x6b6c6b6c,0x6b6c736d,0x738d73ad,0x736d738d,0x6b4c6b2c,0x736d738d,0x736d73ad,0x6b4c6b4c,0x7bce6b6c,0x738d840f,0x83ef738d,0x738d9cf2,0x738d6b2b,0x6b4c73ad,0x736c736c,0x7bce738d,0x7b8d83ef,0x736d734c,0x736d83ce,0x840f738d,0xad749cd2,0x94b1b5b5,
-0x8c4f842f,0x6b2c738d,0x736d6b4c,0x8c509cd2,0x6b4c736d,0x6b4c736c,0x736d83ee,0x736d7bce,0x83ee736d,0x94507bce,0x83ef8c50,0x7b8d7bce,0x7bae736d,0x83ce83ce,0x7bce736d,0x8c508c30,0x8c509491,0x7bae83ce,0x7bce8c0f,0x7bae73ad,0x7bae738d,0x736d736d,0x736d738d,0x7b8d738d,0x6b4c734c,0x6b2c6b4c,0x6b2c6b2c,0x6b2c6b4c,0x6b4c6b2c,0x6b4c6b4c,0x6b2c6b4c,0x6b2c630b,
-0x632b6b4c,0x6b2c5aca,0x62eb6b2c,0x6b2c6b2c,0x6b4c6b4c,0x630b6b2c,0x6b2c630b,0x6b2c6b2c,0x6b2c6b4c,0x6b0b6b4c,0x945183ce,0x734c7b8d,0x734c736d,0x6b2c734c,0x6b2c62eb,0x736d738d,0x630b62eb,0x630b630b,0x6b4c6b4c,0x736d734d,0x736d7b8e,0x6b2c6b4c,0x6b2c736d,0x6b2c6b2c,0x6b0b62ca,0x6b2c6aeb,0x6b0b6b0b,0x5aaa62eb,0x6b2c6b0b,0x734c6b2c,0x630b6b4c,0x6b2c6b0b,
-0x736d734c,0x630b6b2c,0x6b2c6b4c,0x6b4c6b0b,0x630b6b2c,0x7b8d734c,0x7b8d734d,0x8bef7b6d,0x732c83ae,0x6b2c6b0c,0x6b0c6b2c,0x6b0c6b0c,0x62eb6b2c,0x62eb630b,0x630b62eb,0x6b2c630c,0x734c734d,0x6b2c6b4c,0x6b4c6b4c,0x736d6b4c,0x630b6b0b,0x734c6b2c,0x62eb83ce,0x62ca6aeb,0x6b2b62ca,0x62eb6b2c,0x630b5aea,0x62eb630c,0x6b2c62eb,0x630b62eb,0x62eb62eb,0x5aaa5aca,
-0x5aaa5aca,0x5acb62eb,0x62eb5aca,0x630b630b,0x630b6b2c,0x630b62eb,0x6b4c6b2c,0x62eb6b0c,0x6b2c6b2c,0x62eb630b,0x6b2c630b,0x630b6b0b,0x62eb630b,0x630b630b,0x62eb630b,0x6b0b630b,0x6b2c630b,0x62eb630b,0x630b630b,0x6b2c630c,0x630b6b4c,0x6b4c630b,0x630b6b2c,0x6b4c6b2b,0x632b6b4c,0x6b2c630b,0x630b632b,0x630b630b,0x632c630b,0x632c632c,0x6b4c6b4d,0x6b6d6b4c,
-0x83ee83ee,0x7b8d8bee,0x7b6d6b2b,0x83ce736c,0x7b8d7bad,0x6b4c6b4c,0x738d736d,0x738d738d,0x738d7bce,0x7bae738d,0x738d73ad,0x6b4c736d,0x7bce738d,0x736d7bae,0x630b6b4c,0x738d6b2b,0x6b6d736d,0x6b6c6b4c,0x736d6b4c,0x738d7bce,0x6b4c6b4c,0x7bae7bee,0x632b6b2b,0x738d6b6c,0x738d6b2b,0x736d7bad,0x7bae7bae,0x736d6b2c,0x94918c30,0xad34a4f3,0x7bce9cd2,0x6b4c736d,
-0x8c4f7bce,0x738d738d,0x7bad738d,0x6b6c73ad,0x6b4c6b6c,0x6b6c6b6c,0x7bad83ee,0x7bad6b4c,0x840f734c,0x7bad83ce,0x8c30840f,0x7bad7b8d,0x6b4c738d,0x83ef736d,0x7bae83ef,0x736d736d,0x8c50840f,0x83ef840f,0x840f736d,0x738d7bce,0x7bae738d,0x738d736d,0x738d7bce,0x736d736d,0x734c738d,0x6b4c6b4c,0x6b2c6b2c,0x6b4c734c,0x736d6b4c,0x6b4c734c,0x738d736d,0x6b2c736d,
-0x6b4c6b4c,0x630b630b,0x734c6b4c,0x6b2c6b4c,0x6b2c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x6b4c6b2c,0x6b0b6b4c,0x6b2c6b2c,0x83ef7b8e,0x6b2c7bae,0x734c6b2c,0x736d736d,0x6b2c6b4c,0x736d6b4c,0x6b2c6b2c,0x6b2c6b2c,0x630b6b2c,0x734d630b,0x7bae6b4c,0x738d7bae,0x6b2c736d,0x630b6b2c,0x6b2c62eb,0x6b2c6b0b,0x62eb6aeb,0x62ca62eb,0x6b0b5aaa,0x6b2c630b,0x6b0b6b4c,0x6b2c62eb,
-0x734c6b4c,0x6b4c6b4c,0x736d736d,0x6b2c6b4c,0x738d6b4c,0x7b8d7bae,0x7bae7bae,0x7bae732c,0x732c83ae,0x6b0c6b0c,0x732d732d,0x6b0c62eb,0x630b6b2c,0x6b2c6b2c,0x6b2c6b2c,0x6b4c6b2c,0x6b4c6b4c,0x734c6b4c,0x736d738d,0x734c736d,0x62eb6b0b,0x736d62eb,0x62eb83ce,0x62eb62eb,0x630b62ea,0x630b630b,0x5aea62eb,0x630b62eb,0x6b2c62eb,0x630b630b,0x62eb62eb,0x5aca5aaa,
-0x5aca62eb,0x5acb5aca,0x62eb5acb,0x630b630b,0x630b630b,0x6b0c630b,0x736d6b4c,0x630b6b4c,0x6b2c630b,0x62eb630b,0x630b62eb,0x630b630b,0x6b2c630b,0x630b6b2c,0x630b62eb,0x630b6b2c,0x6b0b62eb,0x630b6b2c,0x62eb62eb,0x630b62eb,0x630b62eb,0x6b2c6b2c,0x6b4c6b4c,0x6b2b6b6c,0x6b2c6b2c,0x630b6b2c,0x632b630b,0x630b630b,0x630b630b,0x632c630b,0x738d6b4d,0x73ae738e,
-0x83ce8c2f,0x83cd83ce,0x7b8d736c,0x7bad6b2b,0x7bce83ee,0x734c738d,0x736d736c,0x738d736d,0x738d73ad,0x736d738d,0x738d736d,0x6b2c738d,0x6b6d632c,0x738d738d,0x6b4c738d,0x736d6b2c,0x738d73ae,0x6b4c736d,0x6b4c6b4c,0x6b4c736d,0x6b4c6b4c,0x736d736d,0x6b2b6b2c,0x738d738d,0x736d738d,0x6b4c630b,0x7bae738d,0xbdd69cd2,0xa513ce38,0x6b4c7bce,0x736d736d,0x630b6b4c,
-0x738d6b4c,0x7bce7bce,0x6b4c738d,0x738d6b6c,0x6b4c7bad,0x6b4c736c,0x840f840f,0x736d6b4c,0x7b8d7bad,0x8c2f83ce,0x83ee8c2f,0x83ef7bad,0x736d7bce,0x7bae738d,0x83ef8c30,0x6b2c7bae,0x736d734c,0x736d83ef,0x738d738d,0x83ef8c30,0x73ad738d,0x736d736d,0x738d738d,0x734c738d,0x736d738d,0x6b4c736d,0x6b4c6b2c,0x736d736d,0x6b2c6b2c,0x6b4c6b4c,0x734c6b4c,0x7bae738d,
-0x6b2c734c,0x6b4c734c,0x736d6b0b,0x6b2c7b8d,0x6b2c734c,0x734c6b2c,0x734c736d,0x734c6b4c,0x6b0b62eb,0x734c6b0c,0x734d9450,0x7bae736d,0x7b8d736d,0x7b8d738d,0x6b2c738d,0x6b2c62eb,0x6b4c736d,0x6b2c6b2c,0x630b6b0c,0x6b4c630b,0x736d6b2c,0x7bce736d,0x6b2c736d,0x62eb630b,0x732c6b0b,0x6b2c732c,0x6b0b6aeb,0x6b2c6b0c,0x6b0b6b0b,0x736d6b2c,0x6b2c6b4c,0x630b6b2c,
-0x6b2c6b2c,0x738d734c,0x736d736d,0x736d736d,0x7bae7b8d,0x736d83ce,0x734c734c,0x7b6d734c,0x734c7b8d,0x6b0c734d,0x7b8e736d,0x6b2c62eb,0x6b0b6b0b,0x6b2c6b2c,0x6b2c6b0b,0x6b4c6b2c,0x6b2c6b0c,0x6b4c6b2c,0x736d736d,0x6b4c6b4c,0x6b4c6b2c,0x7bae62eb,0x6b2c7b8d,0x6b0b6aeb,0x62eb6b0b,0x6b4c630b,0x6b2c6b4c,0x632b630b,0x630b630b,0x5aca62eb,0x62eb630b,0x52895aaa,
-0x5aaa5aca,0x62eb5aaa,0x62eb630b,0x62eb630b,0x6b2c630b,0x6b4c6b2c,0x7bae736d,0x6b4c738d,0x6b0b6b0b,0x630b630b,0x62eb630b,0x6b2c62eb,0x6b0b630b,0x6b0b6b2c,0x630b62eb,0x6b0b6b2c,0x6b2c6b0b,0x630b6b0b,0x62eb630b,0x630b62eb,0x632b630b,0x736d6b6c,0x736d7bae,0x6b4c6b4c,0x630b630b,0x630b630b,0x6b2c630b,0x630b632b,0x630b632b,0x630b630b,0x738d6b4c,0x73ae7bae,
-0x8bee9c70,0x83ce83ce,0x7b8d83ae,0x6b2b630b,0x7bae7b8d,0x736d7bae,0x6b2b6b2c,0x7bae736c,0x738d736d,0x6b4c738d,0x736d6b2c,0x6b6d738d,0x632c6b4c,0x738d6b6c,0x736d738d,0x736d738d,0x7bce7bce,0x736d738d,0x6b6c736d,0x6b2c6b4c,0x7bae6b4c,0x6b2c7bce,0x6b2b6b4c,0x6b4c6b4c,0x6b2b6b4c,0x8c50630b,0xce78bdd6,0x9491c5f7,0x6b4c736d,0x6b4c6b4c,0x6b2c630b,0x632c6b6d,
-0x7bad9491,0x738d6b4c,0x738d738d,0x7bae736c,0x6b2c7bae,0x6b2c6b6c,0x8c309471,0x736c6b4c,0x8c0f734c,0x83ee83ee,0x8c2f8c30,0x83ce840f,0x7bae83ee,0x736d738d,0x840f7bce,0x736d83ef,0x7b8d6b2c,0x7bae736d,0x738d734c,0x7bee738d,0x736d738d,0x736d736d,0x738d6b4c,0x736c7bae,0x736d736d,0x6b4c738d,0x736d6b2c,0x6b4c736d,0x630b6b2c,0x734c6b2c,0x6b2c6b2c,0x8c107bae,
-0x6b4c738d,0x7b8d7bce,0x6b2c6b0b,0x734d734c,0x6b2c734c,0x6b2c6b0b,0x6b4c6b2c,0x6b0b6b2c,0x6b2c6b0b,0x83ce6b2c,0x736d7b8d,0x7b8d736d,0x736d7bae,0x736d734c,0x736d7bae,0x6b2c6b2c,0x6b4c6b4c,0x62eb6b2c,0x630b62eb,0x630b630b,0x6b0c6b2c,0x738d6b2c,0x6b4c736d,0x62eb6b2c,0x6b0b62cb,0x6aeb6b0b,0x6aeb62eb,0x6b0b6b0b,0x62eb6b2c,0x736d630b,0x6b2c6b4c,0x6b2c736d,
-0x6b2c630b,0x738d736d,0x738d738d,0x7bae7bae,0x7bae7bce,0x7b8e83cf,0x6b2c736d,0x7b6d736d,0x7b8d83ce,0x736d7b8d,0x736d7b8e,0x6b0c62eb,0x6b0c6b2c,0x6b2b6b2c,0x6b2c630b,0x6b4c6b4c,0x6b4c6b0b,0x736d734c,0x736d736d,0x736d736d,0x6b4c6b2c,0x83ef62eb,0x6b2c6b0c,0x62cb6aeb,0x630b630b,0x6b2c6b0b,0x6b4c6b4c,0x62eb630b,0x630b6b4c,0x5aca5aea,0x62eb62ca,0x5aca6b2c,
-0x5aca5aaa,0x630b5aaa,0x6b2c6b2c,0x62eb6b4c,0x630c62eb,0x6b2c6b2c,0x7bce736d,0x736d7bae,0x630b6b2c,0x6b2c62eb,0x62eb6b4c,0x62eb5aca,0x6b2c6b4c,0x6b4c6b4c,0x630b6b0b,0x6b2c630b,0x6b2c6b2c,0x6b2c630b,0x630b6b2c,0x62eb62eb,0x630b6b2c,0x738d736d,0x632b7bce,0x6b2c630b,0x62eb630b,0x630b630b,0x630b630b,0x630b630b,0x630b6b2c,0x630b630b,0x6b6d630b,0x6b6d738d,
-0x8c2f8c0f,0x83ce8bef,0x7bad83ce,0x6b2b736c,0x736c6b2b,0x734c736d,0x630b6b2c,0x7bce734c,0x6b4c738d,0x736d6b6c,0x6b2c6b4c,0x73ae6b6d,0x6b6d73ae,0x738d6b6d,0x738d736d,0x7bee7bce,0x73ae738d,0x738d738e,0x6b4c738d,0x738d6b4c,0x738d738d,0x738d83ee,0x6b2b736c,0x6b6c632b,0x94b1840f,0xad54b574,0x9cb1ad33,0x738d7b8d,0x632b738d,0x6b4d6b2c,0x6b6d6b4c,0x73ae738d,
-0x6b2c736d,0x6b4c6b4c,0x6b6c840f,0x738d6b4c,0x736d738d,0x738d738d,0x840f9cb1,0x840f736c,0x83ce7b8d,0x83ce7bad,0x840f8c30,0x840f83ef,0x83ee840f,0x7bae7bad,0x83ef7bce,0x83ef83ce,0x7bae7b8d,0x736d7bae,0x738d7bad,0x6b4c736d,0x736d736d,0x738d7b8d,0x736d736c,0x738d738d,0x736d736d,0x738d7b8e,0x736d736d,0x6b4c6b4c,0x6b4c736d,0x6b2c6b4c,0x6b4c6b2c,0x738d738d,
-0x83ee736d,0x738d8c0f,0x6b0b6b2c,0x734c62ea,0x734c734d,0x6b0b6b0c,0x6b2c6b0b,0x6b0c6b2c,0x62cb732c,0x734d734c,0x6b2c6b2c,0x7bae7bae,0x7b8d83cf,0x734c734c,0x7bae738d,0x6b4c736d,0x6b0c630b,0x630b6b0c,0x62eb62eb,0x5aca62eb,0x6b2c6b0c,0x630c6b2c,0x736d6b2c,0x734c7bae,0x62eb62eb,0x62ca62eb,0x62eb62cb,0x62cb62eb,0x6b2c6b2c,0x6b2c630b,0x6b2c6b4c,0x6b4c6b4c,
-0x738d6b2c,0x734c736d,0x83ef7bae,0x7b8d83ce,0x840f83ce,0x736d83ce,0x734c7b8d,0x83ae736d,0x6b2b7b8d,0x83ae6b2c,0x734c7bae,0x7bae734c,0x734c736d,0x6b0b6b2b,0x6b2c6b0b,0x6b2c6b4c,0x734c6b2c,0x734c734c,0x736d736d,0x736d736d,0x630b6b4c,0x8c306b0b,0x6b0b6b0b,0x62eb6b0b,0x6b2b62eb,0x6b0b6b2c,0x630b630b,0x630b630b,0x630b630b,0x62ca62ca,0x630b5aca,0x7bae840f,
-0x630b62eb,0x62eb5aca,0x6b2c630c,0x630b736d,0x6b2c62eb,0x6b2c6b2c,0x7bae736d,0x738d7bae,0x6b2c734c,0x6b4c630b,0x6b2c736d,0x62eb62eb,0x6b2c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x6b4c6b4c,0x630b630b,0x6b2c6b2c,0x62eb630b,0x62eb62eb,0x6b4c630b,0x738d73ad,0x6b2b7bad,0x630b630b,0x630b630b,0x630b630b,0x630b630b,0x630b630b,0x630b630b,0x630b630b,0x6b2c62eb,0x630c6b4c,
-0x8bef83ce,0x7bad83ce,0x7bad83ee,0x738d83ce,0x6b2c6b4c,0x6b2b6b2b,0x6b4c6b2c,0x738d734c,0x6b6c738d,0x736d6b6c,0x6b4c6b4c,0x736d6b6d,0x73ae7bae,0x6b6d6b6d,0x7bae738d,0x840f7bce,0x6b4c738d,0x736d6b4c,0x6b4d738d,0x7bae6b4c,0x736d7bae,0x840f83ef,0x738d6b4c,0xa513842f,0x9cd2a513,0x7bad9470,0x7bce738d,0x6b4c736d,0x736d738d,0x6b4d6b2c,0x738d738d,0x7bae6b6d,
-0x738d736d,0x738d6b2c,0x7bae736d,0x736d736d,0x6b4c738d,0x7bad736c,0x840f83ee,0x8c50840f,0x734c7bad,0x83ce83ee,0x83ee7bae,0x83ee83ef,0x7bce7bce,0x7bad738d,0x7bae738d,0x83ce7b8d,0x7b8d83ce,0x736d7b8d,0x7bad736d,0x6b4c7bae,0x7bce6b2b,0x7b8d83ef,0x7bad7bad,0x734c734c,0x6b4c736d,0x7b8e738d,0x736d7b8d,0x7b8d6b4c,0x7bae8c30,0x6b2c6b4c,0x6b2c6b2c,0x6b4c6b4c,
-0x83ee734c,0x734c8c0f,0x734c6b0b,0x6b2b6b0b,0x736d734c,0x6b2c734d,0x6b2c6b0c,0x736d734c,0x6b0c6b2c,0x736d7b8d,0x732c6b2c,0x8c0f7b8d,0x83ae8bef,0x736d7b8d,0x736d6b4c,0x6b0c734d,0x6b0c6b0c,0x736d6b4c,0x630b6b4c,0x6b2c630b,0x6b2c6b0c,0x630b6b4c,0x6b4c6b2c,0x83ce7bee,0x6b0b6b2c,0x62ca6b0b,0x6aeb62eb,0x62eb62eb,0x734c6b2c,0x6b2c6b2c,0x6b4c6b2c,0x6b2c736d,
-0x7b8d734c,0x736d736d,0x83ee83ee,0x7bae7bad,0x83ef7bce,0x734c7bae,0x734c734c,0x83ce83ae,0x7b8d83ce,0x7bae736d,0x734c7b8d,0x7b8d736d,0x734c738d,0x6b2b6b0b,0x736d6b4c,0x6b2c736d,0x6b4c6b4c,0x6b2c6b2c,0x738d736d,0x6b4c736d,0x630b734c,0x8c0f736d,0x6b0b6b0b,0x62eb6b0c,0x62eb62ea,0x630b630b,0x630b630b,0x630b630b,0x5aca5aca,0x62eb5aca,0x6b4c630b,0x738d840f,
-0x630b630b,0x62eb5aeb,0x630b62eb,0x62eb6b2c,0x6b2c62eb,0x6b4c6b4d,0x736d6b4c,0x738d738d,0x736d736d,0x6b4c6b4c,0x736d736d,0x6b0b6b4c,0x630b62eb,0x630b630b,0x6b2c630b,0x6b4c6b4c,0x630b6b0b,0x630b630b,0x62eb62eb,0x62eb62eb,0x6b4c62eb,0x738d7bae,0x6b4c7bad,0x630b6b2c,0x630b630b,0x62eb630b,0x62eb62eb,0x5aea62eb,0x62eb62eb,0x62eb62eb,0x630b62eb,0x630b630c,
-0x83ee8bef,0x7bad83ce,0x7bad83ee,0x7bad7bad,0x736c7b8d,0x6b2b6b2b,0x734c6b4c,0x736d734c,0x736d736d,0x6b4c736d,0x736d6b4c,0x6b4c736d,0x7bce7bce,0x738d738d,0x73ae73ae,0x7bae738d,0x632c738d,0x6b4c630b,0x736d736d,0x738d6b4c,0x6b6c736d,0x94b17bce,0x94b194b1,0x842f8c50,0x6b4c736d,0x83ee736c,0x7bae7bee,0x736d7bee,0x738d630b,0x7bae7bce,0x6b6d736d,0x738d632c,
-0x6b2c736d,0x6b4c6b4c,0x7bae6b4c,0x738d83ef,0x630b736d,0x738d6b2b,0x840f7bad,0x7bce840f,0x736c736c,0x736c83ce,0x7bce7b8d,0x83ce7bad,0x83ef7bae,0x7bad83ce,0x7bae7bad,0x7bce7bae,0x7bad83ce,0x7b8d738d,0x738d736c,0x736c738d,0x7bad630b,0x7bad83ef,0x7bae7b8d,0x6b0b734c,0x734d738d,0x736d736d,0x736d736d,0x7bce736c,0x83ef9491,0x734c736d,0x6b2c734c,0x736d6b0c,
-0x734c6b2c,0x734c7bad,0x732c62eb,0x6b0b734c,0x734c6b0b,0x734c734c,0x6b2c6b2c,0x734c6b2c,0x734d6b2c,0x736d8c30,0x732c6b0c,0x7b6d83ae,0x83ae7b8e,0x736d7b8e,0x734d734d,0x6b4d6b4d,0x6b2c736d,0x7b8e736d,0x6b2c736d,0x736d6b4c,0x6b2c6b4c,0x6b2c630c,0x6b4c6b6c,0x7bae738d,0x732c734c,0x6aeb734d,0x62eb6aeb,0x62eb62eb,0x62eb62eb,0x6b2c630b,0x6b4c6b2c,0x734d738d,
-0x7b8d7b8d,0x7bad7b8d,0x7b8d83ae,0x83ce7b8d,0x83ce83ce,0x83ad7b8d,0x838d7b6d,0x83ce8bef,0x7bad7b8d,0x736d7b8d,0x736d736d,0x736d7b8d,0x736c736d,0x734c6b2c,0x736d734d,0x6b2c7b8d,0x6b4c6b4c,0x6b2c6b2c,0x736d6b4c,0x6b4c6b4c,0x6b0b6b2c,0x7bae83ce,0x6b0b6b2c,0x62ca6b0b,0x62ca62ea,0x630b62ea,0x630b630b,0x62eb630b,0x630b630b,0x62eb5aca,0x736d6b4c,0x5aca6b0b,
-0x5aeb62eb,0x630b630b,0x5aeb630b,0x5aca5aeb,0x630b5aeb,0x6b2c6b2c,0x6b2c630c,0x6b4c6b4c,0x6b4c6b4c,0x6b0b6b2c,0x6b2c6b2c,0x6b4c6b4c,0x6b2c630b,0x630b6b2c,0x630b62eb,0x62eb630b,0x62eb6b2c,0x62eb62eb,0x630b62eb,0x630b6b0b,0x630b62eb,0x736d6b4c,0x6b4c736c,0x632b6b2c,0x630b630b,0x62eb630b,0x5aca62eb,0x62ca5aca,0x630b630b,0x62eb62eb,0x630b630b,0x630b630b,
-0x83ee83ae,0x7bad83ee,0x83ee83ce,0x83ce7bce,0x738d7bae,0x6b2c6b4c,0x6b4c6b4c,0x738d736d,0x736d738d,0x736d736d,0x736d736d,0x738d738d,0x738d738d,0x73ae7bce,0x738d736d,0x7bce7bce,0x6b4c736d,0x632c6b4c,0x736d6b2c,0x738d736d,0x9471840f,0x8c508c50,0x6b6c9470,0x62ea62ea,0x738d6b4c,0x6b4c736d,0x8c507bad,0x738d842f,0x6b4c6b4c,0x736d6b4d,0x738d6b4c,0x738d738d,
-0x6b2c736d,0x62eb630c,0x83ef736d,0x8c2f840f,0x630b6b4c,0x73ad6b2b,0x840f9cb1,0x7bce6b4c,0x6b4c83ee,0x6b4c6b4c,0x738d6b4c,0x738d83ef,0x83ee7b8d,0x7bce840f,0x738d7bce,0x7bae738d,0x83ee736d,0x738d83ce,0x7b8d7bad,0x736d736c,0x62eb6b2c,0x83ee7b8d,0x736d738d,0x6b2c736d,0x738d7bae,0x630b738d,0x736d6b2c,0x7bae736d,0x7bae840f,0x6b2c6b4c,0x6b4c734c,0x6b0b630b,
-0x6b0b6b4c,0x736c734c,0x6b0b6b2c,0x736c6b2c,0x6b2c6b2b,0x736d734c,0x734c736d,0x6b2c6b2c,0x736d6b0b,0x6b0c734d,0x7b6d732c,0x7b6d734c,0x7bae734d,0x734d7b8d,0x734d7b6d,0x736d6b2c,0x6b4c738d,0x6b4c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x6b4c736d,0x6b4c62eb,0x738d738d,0x6b2c6b4c,0x7b8d736d,0x734d83ce,0x6aeb6b2c,0x62eb62eb,0x6b2c62eb,0x6b2c62eb,0x6b4c736d,0x7bae734c,
-0x83ee83ce,0x7b8d83ce,0x7bad736d,0x736c7bad,0x8c0f8c0f,0x7b6d734c,0x7b8d7b8d,0x8bef83ae,0x7b8d7b8d,0x736c736d,0x6b2c736d,0x734c62eb,0x736d734c,0x734c734c,0x6b0b6b0b,0x630b6b2c,0x6b2c630b,0x62eb6b2c,0x630b62eb,0x6b2c6b2c,0x6b0b6b2c,0x7b8d83ef,0x6b0c7b8d,0x6b2c6b0b,0x6b2c6b2b,0x630b6b2b,0x630b62eb,0x630b630b,0x6b2c6b4c,0x62eb5aea,0x738d736d,0x6b2c62eb,
-0x5aca630b,0x630b630b,0x5aeb62eb,0x630b5aeb,0x6b2c632c,0x6b2c630c,0x6b4c6b4c,0x6b2c6b4c,0x630b630b,0x6b2c630b,0x62eb6b2c,0x738d6b2c,0x6b0b6b0b,0x6b4c6b2c,0x630b6b0b,0x6b2c630b,0x62eb62ca,0x6b2c6b0c,0x62eb62eb,0x62eb630b,0x630b630b,0x6b4c6b2c,0x6b4c6b2b,0x632b6b4c,0x62eb6b2c,0x6b0c62eb,0x5aca630b,0x630b5aca,0x630b630b,0x62eb62eb,0x630b630b,0x6b2c630b,
-0x7bae8bef,0x7bae7b8d,0x83ce7b8d,0x83ce83ee,0x7bad7b8d,0x6b0b7b8d,0x6b2c734c,0x6b4c6b2c,0x738d6b4c,0x7bae736d,0x738d7bae,0x738e736d,0x738d736d,0x7bce7bce,0x7bae7bae,0x7bae738d,0x6b2c736d,0x6b4c736d,0x736d6b2c,0xa4d38c10,0x8c0f9cb2,0x7bce7bae,0x738d6b4c,0x630b736d,0x736c7bad,0x738d7bad,0x83ee6b4c,0x738d8c50,0x6b6c630b,0x736d6b4c,0x6b2c736d,0x7bae738d,
-0x6b6d736d,0x738d736d,0x736d6b6c,0x738d73ad,0x736d7bee,0x6b6c632b,0x6b6c6b6d,0x6b4c738d,0x7bce73ae,0x738d7bae,0x738d738d,0x7bce738d,0x7bae736d,0x83ef8c30,0x7bae8c0f,0x734c7bad,0x83ef7bae,0x840f840f,0x6b2b7b8d,0x736d736d,0x7b8e734c,0x736d7b8e,0x734c7bae,0x7bae7b8d,0x7b8d736d,0x738d738d,0x736d6b2c,0x736d738d,0x6b2c6b2c,0x6b0c6b2c,0x734c6b2c,0x6b0b6b2c,
-0x732c6b0b,0x6b0b6b0b,0x6aeb732c,0x734c62eb,0x734c734d,0x734c734d,0x732c734d,0x6b0c62eb,0x83ce7b8d,0x736d630b,0x734c736c,0x7b8d7bad,0x7b6d7b6d,0x736d7b8d,0x7b8d7b6d,0x6b2c732c,0x736d83ce,0x62eb6b0c,0x736d630b,0x6b4d738e,0x738e7bcf,0x6b4c6b4c,0x6b4d736d,0x6b2c738d,0x7bad6b2c,0x734c736d,0x6b2c734c,0x6aeb6b2c,0x732c6b2c,0x6b2c732c,0x7b8d7b6d,0x736d7b6d,
-0x9c928c0f,0x83cf7bae,0x7b8d83ce,0x83ce7b8d,0x8c0f9450,0x732c7b8d,0x8bee7b6c,0x83ce942f,0x6b2c7b8d,0x736d6b2c,0x6b4c738d,0x6b4c630b,0x6b4c736d,0x6b2c630b,0x6b2c6b2c,0x734d6b0c,0x6b2c630b,0x6b4c6b4c,0x6b2c62eb,0x62eb6b2c,0x630b630b,0x7b8d8c50,0x736d736d,0x6b0b630b,0x62eb630b,0x630b630b,0x630b630b,0x6b4c630b,0x630b632c,0x62eb5aeb,0x6b2c6b2c,0x5acb5acb,
-0x5aca5aca,0x5aeb5aca,0x5aca5aca,0x62eb5aca,0x5aca630b,0x6b2c62eb,0x6b2b6b2c,0x62eb6b2c,0x6b2c62eb,0x6b2c736d,0x6b2c630b,0x6b4c6b2c,0x6b4c6b4c,0x6b2c6b4c,0x6b4c6b4c,0x6b4c6b2c,0x6b2c6b2c,0x630b6b0b,0x630b630b,0x5aea630b,0x630b62eb,0x630b630b,0x630b630b,0x630b6b2c,0x630b6b4c,0x630b62eb,0x62eb630b,0x630b62eb,0x62eb6b2c,0x62eb62eb,0x630b62eb,0x630b632b,
-0x83ce83ce,0x736d7b8d,0x83ce7bae,0x8c0f83ee,0x7b6d83ee,0x734c7b8d,0x6b0b734c,0x738d734c,0x738d736c,0x73ad7bce,0x736d7bce,0x736d736d,0x738d738d,0x7bae7bae,0x7bce7bce,0x6b4d736d,0x6b4d738e,0x7bae738e,0x738e7bce,0x83ef7bae,0x736d7bae,0x738d736d,0x6b0b736d,0x7bae736d,0x736d6b4c,0x736d738d,0x7bad738d,0x736d738d,0x73ad736d,0x6b2c6b4c,0x6b4d736d,0x7bae6b4d,
-0x6b4c6b6d,0x73ae738d,0x6b4c736d,0x738d736c,0x736c6b6c,0x6b4c738d,0x632b630b,0x73ae6b6c,0x7bce6b6d,0x7bae83ef,0x6b4c736d,0x7bae6b4c,0x7bae738d,0x8c0f8c0f,0x83ce83ce,0x83ce83ce,0x73ad840f,0x8c2f738d,0x734c8c0f,0x7bad734c,0x7b8d6b2c,0x7b8d8c10,0x7b6d6b0c,0x7bae7b8d,0x7b8d7b8d,0x738d736d,0x736d738d,0x736d6b2c,0x6b2c6b4d,0x6b4c6b4c,0x6b0c6b0b,0x734c734c,
-0x6b0b732c,0x732c6b0b,0x6b0b6b2c,0x6b0c732c,0x7b6d734c,0x732c7b6d,0x736d732c,0x6b2c734c,0x7bad7b8d,0x6b4c6b2b,0x736c734c,0x7b8d7b6d,0x732c734c,0x732c732c,0x7b8e7b6d,0x736d7b4d,0x736d734d,0x6b0c6b2c,0x6b2c6b2c,0x8c30738d,0x6b4d7bae,0x630c736d,0x736d6b2c,0x736c6b4c,0x632b738d,0x6b2b7bcd,0x738d734c,0x734c6b2c,0x734d732c,0x736d734d,0x83ae7b8d,0x83cf83ce,
-0x7bae7b8e,0x83ef7bae,0x734d83ef,0x734c6b4c,0x7bae83ce,0x7b8d83ae,0x8c0f7bad,0x83ae83ee,0x738d83ce,0x6b4c736d,0x7b8d738d,0x630b6b2c,0x6b2c6b0b,0x6b2c6b0c,0x6b2c6b4c,0x6b2c6b0c,0x630b630b,0x6b4c6b2c,0x630b630b,0x62eb62eb,0x6b2c630b,0x736d83ef,0x738d736d,0x6b2b6b2b,0x630b630b,0x630b630b,0x630b630b,0x630b630b,0x630b5aca,0x62eb630b,0x62eb62eb,0x62eb5aca,
-0x630b630b,0x62eb5aeb,0x5aca5acb,0x5aca5aca,0x62eb5aca,0x6b2c6b2c,0x6b2c6b0b,0x630b6b4c,0x630b6b0b,0x6b0b6b2c,0x6b2c6b2c,0x6b2c632b,0x736d6b4c,0x736d736d,0x630b6b2c,0x6b2c734c,0x6b2c736d,0x6b2c6b2c,0x62eb630b,0x5aea5aca,0x630b630b,0x6b2c630b,0x632b6b2c,0x6b2c6b2c,0x630b6b2c,0x62eb62eb,0x630c630b,0x630c630c,0x630b62eb,0x630b632b,0x5aca5aca,0x6b2c630b,
-0x7bae83ce,0x83ae83ae,0x83ae7b8d,0x8c0f8bef,0x83ce9450,0x7bad83ce,0x6b2b736c,0x7bad734c,0x7bce738d,0x7bae7bce,0x738d738d,0x6b4d736d,0x736d6b4c,0x736d736d,0x83ef7bae,0x736d7bae,0x738e7bae,0x7bae7bce,0x6b2c738d,0x6b2c630b,0x738d7bae,0x7b8d738d,0x6b0b7bae,0x7bae6b4c,0x738d7bad,0x734c736c,0x738d738d,0x6b6c736d,0x738d738d,0x736d73ad,0x736d6b4c,0x7bae738d,
-0x6b4c73ae,0x6b6c6b2c,0x738d738d,0x738d738d,0x736c6b4c,0x6b6d73ae,0x630b6b2c,0x7bce632c,0x6b4c7bce,0x7bce738d,0x738d738d,0x6b4c738d,0x83ef83ef,0x7bae83ef,0x83ef7bae,0x83ef83cf,0x736d8c0f,0x83ee6b4c,0x83ce9450,0x734c734c,0x734d7b8d,0x7b8e7bae,0x6aeb7b8d,0x736d734c,0x7b8d736c,0x6b4c736c,0x734c736d,0x6b2c6b2c,0x736d736d,0x630b6b2c,0x6b2c6b2c,0x734c6b0b,
-0x6b0b732c,0x734c732c,0x6b0b6b0b,0x732c734c,0x734c6aeb,0x734d736d,0x7b8d734d,0x736d7bae,0x6b2b6b2c,0x736c734c,0x736d738d,0x6b2c6b2b,0x734c732c,0x732c734d,0x7b6d734c,0x83cf7b8e,0x6b4c7b8d,0x734c6b2c,0x6b2c6b4c,0x83cf736d,0x736d738d,0x6b2c6b4c,0x6b2c6b2c,0x736c736d,0x630b6b4c,0x8c2f7b8d,0x7b8d736c,0x732c734c,0x734c6aeb,0x736d734c,0x7b8d734d,0x7bae7b8d,
-0x6b2c7b8d,0x734d736d,0x736d734c,0x6b2b734c,0x734c734c,0x7bad7bad,0x83ce7bad,0x7b8d7b8d,0x7bae7b8d,0x6b4c738d,0x736d734c,0x6b2c6b4c,0x6b2c6b2c,0x630b6b2c,0x630b630b,0x6b2c630b,0x62eb62eb,0x6b2c630b,0x630b630b,0x630b62eb,0x6b4d62eb,0x736d7bce,0x7b8d7b8e,0x6b0b6b2c,0x6b0b6b0b,0x62eb630b,0x630b62eb,0x5aeb630b,0x630b630b,0x630b632c,0x62eb630b,0x62eb62eb,
-0x62eb630b,0x630b630b,0x5aca5acb,0x5acb62eb,0x630b62eb,0x6b2c6b2c,0x630b630b,0x6b4c6b4c,0x62eb630b,0x630b630b,0x630b630b,0x6b4c630b,0x738d736d,0x630b736d,0x738d6b4c,0x6b4c6b2c,0x6b4c738d,0x6b6c6b4c,0x630b6b2c,0x630b62eb,0x6b2c62eb,0x6b2c6b2c,0x6b2c632b,0x632b6b4c,0x630b630b,0x62eb62eb,0x6b2c62eb,0x6b2c6b2c,0x6b2c630b,0x630b6b2c,0x62eb630b,0x630b62eb,
-0x7b6d83ce,0x8bef83ce,0x7b8d7bad,0x83ee83ce,0x8c0f8c0f,0x7b8d83ce,0x736d7b8d,0x7bae734c,0x83ee7bce,0x7bae7bae,0x738d6b4d,0x736d736d,0x736d736d,0x736d738d,0x7b8e736d,0x7bae7b8e,0x736d736d,0x736d736d,0x6b4d736d,0x6b2c6b2c,0x7bae7b8d,0x738d738d,0x736d7bae,0x736d6b4c,0x738d7bad,0x736d736d,0x738d736d,0x6b4c736d,0x736d738d,0x7bce7bce,0x6b4c6b4c,0x738e7bae,
-0x6b4c6b4c,0x6b4c6b4c,0x738d736d,0x736d738d,0x736c736c,0x6b6d73ad,0x6b6d7bce,0x738d6b4c,0x7bce73ae,0x736d736d,0x83ef83ef,0x7bce7bae,0x83ef7bae,0x7bae8c50,0x7bae7b8d,0x840f8c10,0x7bee7bee,0x738d7bae,0x8c2f83ee,0x734c83ae,0x7bae734c,0x7b8e734c,0x6b2c736d,0x7b8d6b2c,0x7bad7b8d,0x736c7bce,0x736d6b4c,0x6b4c738e,0x7bae736d,0x6b2c736d,0x734c734c,0x734c6b2b,
-0x732c734c,0x6b0b6b0b,0x732c6b2c,0x734c732c,0x732c6b0c,0x736d734c,0x734c734d,0x732c736d,0x62ea734c,0x734c6b2b,0x6b4c736c,0x734c6b0b,0x732c736d,0x62eb6aeb,0x7b6d732c,0x7bae7b8d,0x6b2b83ae,0x734c6b0b,0x6b2c734d,0x6b0c6b2c,0x736d6b4c,0x6b4d6b4c,0x6b2c6b6c,0x6b4c738d,0x736c736d,0x840f734c,0x6b2b7bae,0x734d736d,0x7b6d734c,0x736d736d,0x734d734d,0x736d734c,
-0x6b2c736d,0x734d734d,0x7bae6b2c,0x6b2b736c,0x734c6b2b,0x7bad734c,0x736c7b8d,0x734c7b8d,0x736d734c,0x734c738d,0x6b2c6b2c,0x6b4c6b2c,0x630b62eb,0x630b6b0c,0x6b0c6b2c,0x630b6b0c,0x736d6b4c,0x6b2c6b4c,0x62eb62eb,0x5acb62eb,0x7bae630b,0x6b4c7bae,0x6b2c734c,0x734c6b2c,0x6b2c6b2c,0x630b6b2c,0x630b630b,0x630b630b,0x630b630b,0x630b630b,0x5acb62eb,0x5aca5aca,
-0x630b630b,0x632c6b4c,0x62eb62eb,0x630b6b2c,0x62eb632b,0x6b2c630b,0x630b6b2c,0x734c6b2c,0x630b6b2c,0x6b2c6b2c,0x630b630b,0x738d6b2c,0x62eb736d,0x6b4c738d,0x738d630b,0x6b4c736d,0x736d6b6c,0x6b6c736d,0x630b6b2c,0x62eb630b,0x6b4c630b,0x6b2c6b4c,0x630b630b,0x630b6b2c,0x630b630b,0x62eb630b,0x630c62eb,0x630b6b2c,0x630b62eb,0x630b630b,0x6b4c6b4c,0x6b2c6b2c,
-0x7bad83ce,0x83ae7bad,0x83ce83ee,0x83ee7b8d,0x83ce7b8d,0x7b8d7bad,0x7bad7bad,0x7b8d736c,0x738d7bae,0x738d7bae,0x6b4d738d,0x736d736d,0x738d738d,0x738d7bae,0x736d738d,0x738d736d,0x6b4d6b4d,0x738e736d,0x7bae83ef,0x736d738d,0x738d736d,0x738d738d,0x6b6c736d,0x6b4c736d,0x738d6b2c,0x734c738d,0x736d736c,0x738d738d,0x7bae7bae,0x7bae738d,0x6b4c738d,0x6b4c6b6c,
-0x738d6b4c,0x736d73ae,0x736d736d,0x738d738d,0x736c6b4c,0x6b6d738d,0x73ae8c30,0x6b4d738e,0x7bef6b4d,0x6b6d7bce,0x7bcf73ae,0x8c307bcf,0x7bae7bae,0x83ef9471,0x7bae738e,0x7bce8c30,0x840f7bce,0x736c83ef,0x7bad734c,0x83ce83ae,0x7b8e83ae,0x6b0b7b8e,0x736d7b6d,0x734c6b2c,0x7b8d7bae,0x7bae7bae,0x734c738d,0x7b8e7b8e,0x6b4c736d,0x7bae7b8e,0x6b2b6b2c,0x6b2c734c,
-0x734c732c,0x6b0c732c,0x6b2c6b2c,0x734c732c,0x6b0c6b2c,0x734c6b0c,0x6b0b6b2c,0x6b0c732c,0x6b2b734c,0x6b0b6b0b,0x6b2b6b2b,0x734c732c,0x6b2b734c,0x62cb62cb,0x732c6b0c,0x736d734d,0x734c734c,0x6b2c6b2c,0x734c736d,0x6b2c6b0c,0x6b2c6b4c,0x6b4c738d,0x736d736d,0x6b4c734c,0x738d738d,0x6b4c6b2c,0x7b8d7bae,0x7b8d6b2c,0x7b6d7b8d,0x6b2c736d,0x6b2c734c,0x734c734c,
-0x734c734c,0x7b8d734d,0x736d736d,0x736d736c,0x736d734c,0x7bad734c,0x734c7b8d,0x734c7b8d,0x736d6b4c,0x6b4c6b4c,0x6b0b6b2c,0x6b2c630b,0x630b6b2c,0x630b6b0b,0x6b0c6b4c,0x62eb630b,0x6b4c6b2c,0x6b2c6b2c,0x6b2c630c,0x6b4d6b2c,0x840f630b,0x6b0c736d,0x62cb6b0b,0x734c6b0c,0x6b4c6b2c,0x630b6b4c,0x6b2c630b,0x6b2c6b2c,0x632c632c,0x630c6b2c,0x62eb62eb,0x62eb62eb,
-0x5aeb62eb,0x6b2c6b2c,0x630b630b,0x62eb6b2c,0x62eb630b,0x6b4c630b,0x734c736d,0x6b2c6b4c,0x630b6b2c,0x630b6b0b,0x630b630b,0x6b2c630b,0x6b2c6b4c,0x736d6b2c,0x736d736d,0x736d7b8d,0x738d738d,0x736d738d,0x630b6b2c,0x5aea62eb,0x632b6b2c,0x6b4c630b,0x630b6b4c,0x6b4c630b,0x6b2c6b2c,0x630b630c,0x630b630b,0x630b630b,0x630b62eb,0x630b630b,0x632b6b2b,0x630b630b,
-0x8c0f9470,0x7b8d83ce,0x8c0f83ae,0x7b8d83ae,0x7b6d7b8d,0x7bad7bad,0x7bae7bae,0x7b8d7bad,0x6b4c736c,0x7bae738d,0x736d7bae,0x736d736d,0x736d736d,0x738d738d,0x738d738d,0x736d6b4c,0x736d738e,0x738e6b4d,0x738d83ef,0x738e736d,0x73ad7bae,0x738d7bae,0x6b4c738d,0x6b4c736d,0x736c6b2c,0x738d7b8d,0x7bad738d,0x7bae7bce,0x738d7bae,0x738d6b4c,0x6b6c738d,0x6b4c73ad,
-0x73ae738d,0x736d73ae,0x6b4c6b6c,0x7bad736c,0x6b4c738d,0x736d632c,0x738d8c50,0x6b6d6b6d,0x6b4c6b6d,0x7bce73ae,0x736d6b6d,0x841083ef,0x83ef83ef,0x7bae83cf,0x83cf7bcf,0x83ef7bae,0x83ee8c50,0x7bad7bad,0x6b0b736d,0x83ce732c,0x7bae9450,0x736d6b2c,0x7b8e734c,0x6b2c734c,0x736c738d,0x736d734c,0x6b4c7bae,0x736d6b2c,0x6b2c6b4c,0x7b8e736d,0x6b0b734c,0x6b2c6b2c,
-0x6b2c6b0b,0x7b8d7b8d,0x6aeb6b0b,0x734d732c,0x6b0c6b0b,0x734c6b2c,0x6b2c732c,0x6b0b6b2c,0x734c6b2c,0x6b4c6b2c,0x6b2c6b2b,0x6b0b734c,0x6b2c6b0b,0x6b2c6b2c,0x6aeb6b0b,0x734c6b0c,0x7b6d734c,0x734c736d,0x734d734c,0x736d736d,0x6b2c6b2c,0x6b4c736d,0x738d736d,0x6b4c738d,0x6b6c6b4c,0x736d734c,0x83ef734d,0x734d7b6d,0x736d736d,0x734c736d,0x736d7b8d,0x734c736d,
-0x734c6b2c,0x734c736d,0x6b2c736d,0x7bad738d,0x734c736c,0x738d736d,0x738d738d,0x734c736d,0x736d6b2c,0x6b2c6b4c,0x6b2c6b2c,0x62eb6b0b,0x6b2c734c,0x62eb630b,0x630b6b0c,0x630b630b,0x6b4c6b4c,0x6b4c6b2c,0x630c6b2c,0x6b2c62eb,0x8c306b2c,0x6b0c734d,0x62eb6b0b,0x6b2c6b2c,0x6b2c6b2c,0x630b6b2c,0x632b630b,0x6b2c6b2c,0x632c6b2c,0x62eb630b,0x62eb62eb,0x5acb62eb,
-0x5aca62eb,0x62eb5acb,0x630b62eb,0x5aca630b,0x62eb5aca,0x6b0b62eb,0x738d734c,0x6b2c736d,0x734c6b4c,0x6b4c736d,0x6b2c6b2c,0x6b2c632b,0x736d6b2c,0x6b0b62eb,0x7bae83ce,0x738d6b2c,0x738d7bae,0x736d738d,0x630b6b4c,0x630b630b,0x630b630b,0x6b2c62eb,0x630b6b2c,0x6b2c632b,0x630b630b,0x630c630b,0x6b2c6b2c,0x6b4c6b4c,0x6b2c6b2c,0x62eb630b,0x5aca5aea,0x5aea5aca,
-0x8c2f9c91,0x83ce8c2f,0x8c0f7b8d,0x736c83ee,0x734c736c,0x7bad7bad,0x83ce83ce,0x83ef840f,0x736d736c,0x83ef738d,0x738e7b8e,0x6b4d6b4d,0x738d738d,0x736d738d,0x738d738d,0x6b4c6b4c,0x736d7bae,0x6b4c630c,0x738d7bae,0x7bae738d,0x738d7bae,0x736d736d,0x6b4d738d,0x6b4c736d,0x6b2c6b4c,0x840f7b8d,0x83ef83ef,0x736d7bce,0x6b6c738d,0x738d736d,0x738d736d,0x738d83ef,
-0x738d630c,0x738d7bae,0x6b2c6b4c,0x738d6b4c,0x6b4c7bae,0x738d632c,0x738d83ef,0x73ae6b4d,0x736d738d,0x73ae738d,0x6b6d73ae,0x8c51738e,0x83ef7bae,0x736d7bae,0x7bae7bae,0x9cb27bae,0x842f94b1,0x83ce7bad,0x6b4c7bae,0x7b6d734c,0x83cf83cf,0x734d7b6d,0x734d734c,0x734d7bae,0x736d734c,0x734c734c,0x734d736d,0x6b0c6b0b,0x734c6b2c,0x6b2c6b2c,0x734c736c,0x6b4c6b2b,
-0x6b0c6b2c,0x7b8d734c,0x734c736d,0x6b2c734c,0x734c6b2c,0x734c734d,0x732c732c,0x6b0b6b0b,0x734c732c,0x6b2c6b2c,0x6b2b62ea,0x6b0b732c,0x6b0c6b0b,0x6b0c6aeb,0x6aeb6b2c,0x6aeb6aeb,0x736c7b8d,0x734c736d,0x732c6b0c,0x734c736d,0x734c6b2c,0x734c6b2c,0x736d738d,0x6b4c7bce,0x6b4c6b6c,0x738d738d,0x736d736d,0x7bae8c30,0x732c6b0c,0x734c734c,0x734d734d,0x6b2c6b2c,
-0x6b0b6b0b,0x734c7b6d,0x736d7b8d,0x734c7b8d,0x734c6b2c,0x734c734c,0x736d734c,0x6b4c738d,0x736d6b0c,0x6b0c6b2c,0x6b0b6b0b,0x62eb6b0b,0x6b0b62cb,0x6b0c6b0c,0x6b2c6b0c,0x6b0c6b0b,0x630b630b,0x6b4c630b,0x6b2c6b4d,0x630c62eb,0x8c50736d,0x62eb6b2c,0x630b62eb,0x6b2c6b2c,0x6b2c6b0b,0x630b6b0b,0x630b62eb,0x630b630b,0x6b4c6b4c,0x62eb630b,0x6b4c6b2c,0x6b2c6b2c,
-0x62eb630c,0x62eb5aca,0x630b62eb,0x62eb630b,0x62eb5aca,0x630b630b,0x6b6c6b2c,0x6b2c6b4c,0x6b2c6b2c,0x6b2c736d,0x630b630b,0x630b630b,0x62eb62eb,0x734c6b2c,0x736d6b4c,0x736d734d,0x632b6b4c,0x6b4c6b2c,0x630b6b2c,0x6b2c630b,0x630b5aca,0x5aca62eb,0x630b62eb,0x62eb6b2c,0x62eb62eb,0x630b630b,0x6b2c632b,0x6b4c6b4c,0x62eb630b,0x5aca5aca,0x62ea5aca,0x62eb630b,
-0x8c0f83ee,0x83ce9430,0x8c0f83ce,0x83ce83ce,0x7b8d736c,0x734c7bad,0x7bae7bae,0x83ef7bce,0x7bae83ce,0x83ef83ef,0x738e83cf,0x736d738e,0x738d6b4d,0x738d73ad,0x7bce73ae,0x6b6d738d,0x7bcf736d,0x738e7bae,0x736d7bae,0x7bae738d,0x7bce738e,0x738d736d,0x736d736d,0x6b4c6b2c,0x736c734c,0x7bce736d,0x7bce842f,0x738d6b6c,0x73ad738d,0x736d73ad,0x7bce738d,0x736d7bae,
-0x7bae736d,0x6b4c738d,0x738d6b6c,0x6b4c736d,0x738d736d,0x73ae738d,0x7bce736d,0x7bef6b6d,0x73ae7bce,0x6b4c6b4d,0x73ae738e,0x738e738e,0x738d7bcf,0x736d7bce,0x738d738d,0x9471840f,0x94719470,0x7b8d83ee,0x7b8d736c,0x736d83ce,0x8c1083ef,0x736d83ce,0x7bae736d,0x734c6b2c,0x734c736c,0x736d734c,0x6b2c6b0c,0x62eb6b0c,0x734c6b0b,0x62eb6b2c,0x6b2c62eb,0x6b2c734c,
-0x734c6b2c,0x734d6b2c,0x736d7bae,0x734c6b0c,0x732c732c,0x6b0b732c,0x6b0c6b0b,0x736d6b0b,0x6b2b734c,0x6b2c6b0b,0x6b0b62ca,0x6b0b6aeb,0x6b2c6b0b,0x6b0c6b0b,0x6aeb6b2c,0x6b2c6b0c,0x734c736d,0x6b0b6b2b,0x6b0c6b2c,0x736d6b2c,0x6b2c734c,0x6b2c734d,0x7bae736d,0x734c738d,0x738d738d,0x738d734c,0x7b8d7bae,0x8c0f83cf,0x7b6d734d,0x734c734c,0x6b4c6b2c,0x6b4c6b2c,
-0x62ea734c,0x7b8d6b2c,0x7bce7bae,0x734c736d,0x736d6b2c,0x734c6b2c,0x6b4c6b4c,0x736d7bce,0x736d734c,0x6b0c6b2c,0x62eb6b0c,0x62eb62eb,0x734c62eb,0x6b0b734c,0x62eb62ca,0x6b0b62eb,0x630b62eb,0x6b2c62eb,0x6b4d6b4d,0x62eb630b,0x8c306b2c,0x630b6b2c,0x630b62eb,0x62eb6b0b,0x6b2c6b2c,0x630b6b0b,0x630b630b,0x630b630b,0x630b62eb,0x5aea630b,0x6b2c630b,0x738d6b4c,
-0x630b6b2c,0x62eb5aca,0x62eb5aca,0x630b5acb,0x630b5acb,0x6b2c6b2c,0x6b2c6b2c,0x6b0b6b0b,0x6b0b6b2c,0x630b6b0b,0x6b2c6b0b,0x6b2c6b0b,0x6b2c62eb,0x738d630b,0x736d738d,0x736d83ef,0x630b62eb,0x6b2c6b2c,0x632b632b,0x632b6b2c,0x630b62eb,0x5aea5aea,0x630b62eb,0x62eb630b,0x630b62eb,0x62eb630b,0x630b62eb,0x630b630b,0x62eb630b,0x62ea62ea,0x5aea5aca,0x62ea630b,
-0x83ae7bad,0x83ce83ce,0x83ee8c0f,0x83ee7bad,0x7bad9470,0x83ee83ce,0x736d736c,0x83ee840f,0x7bce83ee,0x738db575,0x7b8e7bae,0x7bae7bae,0x6b6c7bae,0x7bae7bae,0x840f7bce,0x738d73ae,0x736d736d,0x7bcf738e,0x6b4d738e,0x7bae7bae,0x738d7bae,0x736d738e,0x736d6b4c,0x7bce736d,0x736d738d,0x6b2c736d,0x83ef736d,0x6b4c7bce,0x736d736d,0x840f73ad,0x738d7bce,0x6b2c736d,
-0x7bae738d,0x6b4c6b4d,0x7bae736d,0x738d738d,0x73ad738d,0x6b2c8c50,0x736d6b4c,0x736d7bae,0x7bef73ae,0x6b2c738d,0x7bce738d,0x738d83ef,0x738d7bae,0x738d738d,0x7bce738d,0x9471840f,0x7bae8c30,0x840f840f,0x83ef736d,0x7bad8c50,0x94518c10,0x83ae8c30,0x6b0b734c,0x6b0c6b0b,0x6b4c736c,0x6b0b6b2c,0x6b0c6b0b,0x62eb6b0b,0x6b0c62eb,0x6b0b6b2c,0x6b0b630b,0x6b2b6b2c,
-0x6b4c6b2c,0x736d736d,0x734c734c,0x6b0b734c,0x734c6b0c,0x6b0b736d,0x6b2c6b0b,0x6b0b62eb,0x6b0b6b2c,0x62ca62eb,0x736d6b2c,0x6b2c6b0b,0x6b0b6b0c,0x734d6b2c,0x6b0b6b0b,0x6b2c6b2c,0x62eb6b0b,0x736d732c,0x6b2b6b2c,0x734d734d,0x732c732c,0x6b2c736d,0x738d6b2c,0x6b4c738d,0x6b2c6b4c,0x734c6b4c,0x736d7b8d,0x7bae7b8d,0x7bad8c0f,0x734c6b0b,0x6b4c736d,0x6b2c6b2c,
-0x734c736d,0x734c734c,0x738d738d,0x7bae734c,0x6b2c738d,0x734c736d,0x736d6b2c,0x6b4c6b4c,0x6b2c734c,0x6b0b6b0b,0x6b0b62eb,0x62eb6b0b,0x6b0b6b0b,0x6b2c62eb,0x62eb6b2c,0x62cb5aaa,0x5aca62eb,0x6b2c5aca,0x6b4c736d,0x630c6b2c,0x736d738d,0x6b2c6b4c,0x630b62eb,0x630b6b2c,0x62eb62eb,0x6b2c6b0b,0x6b2c6b4c,0x6b2c630b,0x62ca62ca,0x630b62eb,0x62eb630b,0x632b630b,
-0x6b2c736d,0x5aca62eb,0x630b62eb,0x630b630c,0x62eb62eb,0x6b2c6b2c,0x630c62eb,0x6b2c6b2c,0x6b4c6b2c,0x6b2c6b4c,0x6b4c6b4c,0x632b6b2c,0x632b6b2c,0x6b0b6b2c,0x738d6b4c,0x6b4c62eb,0x630b6b2c,0x630b630b,0x62eb630b,0x62eb62eb,0x630b630b,0x62eb62eb,0x62eb62eb,0x630b62eb,0x5aca5aca,0x62eb5aea,0x62eb62eb,0x630b630b,0x6b4c62eb,0x5aca62ea,0x62ea630b,0x62ea62ea,
-0x7bad83ce,0x83ae7bad,0x7b8d83ce,0x94307b8d,0x94309450,0x83ee8c2f,0x7bad7bce,0x8c3083ce,0x840f7bce,0x7bae9451,0x734d736d,0x738d7bcf,0x7bae7bce,0x7bce7bae,0x73ad7bae,0x736d73ae,0x7b8e7b8e,0x7bcf736d,0x7bae83ef,0x7bae7bae,0x7bae738d,0x83ef83ef,0x7bce7bce,0x7bae738e,0x736d7bae,0x6b4c736d,0x7bae736d,0x736d738d,0x738d6b2c,0x7bae738d,0x736d738d,0x738d6b4c,
-0x738d736d,0x736d738d,0x6b6c6b2c,0x7bae738d,0x83ef7bce,0x736d738d,0x6b2c6b4c,0x83ef736d,0x7bef73ae,0x6b6d736d,0x738d6b4c,0x7bae8c50,0x7bae736d,0x738d73ad,0x83ef7bce,0x8c509491,0x83ef8c30,0x7bce7bee,0x83ee7bce,0x83ef83ce,0x8c309430,0x83ae83ef,0x6b0c736d,0x6b2c6b0b,0x6b4c6b0b,0x6b0b6b4c,0x6b0b62eb,0x6b0b6b0c,0x62eb6b0b,0x6b2c6b0b,0x62eb6b0b,0x6b2c6b0b,
-0x6b2c736d,0x736d734c,0x734c734d,0x734c734c,0x6b0b6b0b,0x6b2c6b2c,0x6b2c6b2c,0x6b0b62eb,0x6b2b6b0b,0x6aeb6b2c,0x7b8d734c,0x6b2c732c,0x6aeb6b0b,0x734c6b0c,0x6b2c6b0b,0x6b2c6b2c,0x6b0b6b2c,0x734d6b2c,0x734c734c,0x7b6d7b6d,0x83ae7b6d,0x736d6b2c,0x6b2c736d,0x738d6b4c,0x736d6b4c,0x6b0b6b2c,0x83ce736d,0x6b2b7b8d,0x83ce83ee,0x6b0c734d,0x734c738d,0x6b2c62eb,
-0x734c736d,0x736d734c,0x736c7b8d,0x7bae734c,0x630b6b2c,0x6b4c6b4c,0x6b4c6b2c,0x62eb630c,0x734d6b0b,0x62eb6b2c,0x62eb62eb,0x6b2c62eb,0x6b0b62eb,0x6b0b62eb,0x62eb6b0b,0x62ca5aaa,0x62eb6b0c,0x630b62eb,0x6b4c6b2c,0x736d736d,0x738e7bae,0x62eb6b2c,0x6b2c6b2c,0x62eb62eb,0x62eb62eb,0x630b62eb,0x62eb62eb,0x62eb6b2c,0x630b62eb,0x6b2c632b,0x630b6b2c,0x62eb62eb,
-0x62eb630c,0x5acb5acb,0x62eb62eb,0x6b2c630b,0x6b2c6b2c,0x6b4c6b4d,0x6b2c630c,0x6b4d6b2c,0x6b4c6b4c,0x630b6b2c,0x6b4c6b2c,0x6b2c6b2c,0x630b6b2c,0x6b0b6b2c,0x6b4c630b,0x6b4c6b2c,0x630b6b2c,0x632b630b,0x630b630b,0x630b630b,0x630b62eb,0x62eb630b,0x630b62eb,0x62eb630b,0x5aca5aca,0x62eb5aea,0x630b62eb,0x630b630b,0x62eb62eb,0x73ad6b2b,0x6b4c73ad,0x630b6b2b,
-0x736d7b8d,0x83ae7b8d,0x7bad83ce,0x8c0f7b8d,0x83ce83ee,0x7bad7bce,0x738d7bad,0x83ef7bae,0x7bce83ef,0x7bce83ef,0x738e736d,0x7bae736d,0x83ef7bce,0x7bae7bce,0x738d7bae,0x738d738d,0x7bae7bae,0x734d6b2c,0x738e7bae,0x736d738d,0x7bae7bae,0x8c308c30,0x7bae840f,0x7bae736d,0x736d7bae,0x734c736d,0x736d6b6c,0x736d736d,0x6b6c6b4c,0x7bce736d,0x738d738d,0x6b4c736d,
-0x738d738d,0x738d7bce,0x6b4c6b4c,0x7bce7bae,0x94717bce,0x738e6b4c,0x6b4c738d,0x7bce6b4c,0x7bae7bee,0x738d7bce,0x738d6b6c,0x83ee7bce,0x736c7bad,0x7bce738d,0x8c7083ee,0x738d7bce,0x840f7bce,0x7bce83ee,0x83ee83ee,0x8c0f83ce,0x83ce8bef,0x736d736d,0x6b2c736d,0x6b4c6b2c,0x6b2c630b,0x630b6b2c,0x6b2c630b,0x6b0b6b0c,0x62eb6b2c,0x6b0b62ca,0x630b6b2c,0x630b630b,
-0x6b2c734d,0x738d6b4c,0x6b4c736d,0x6b4c6b4c,0x62eb6b0c,0x6b2c6b0c,0x6b2c6b2c,0x6b0b6b0b,0x734c6b0b,0x6b0c734d,0x7b8e734d,0x6b0c732c,0x6b2c6b2c,0x734d6b2c,0x734d734c,0x734c734c,0x736d734d,0x734d734c,0x734d6b2c,0x734c734c,0x734d7b6d,0x7b8d7bae,0x736d736d,0x6b4c6b2c,0x6b2c6b2c,0x736d6b2c,0x734c734c,0x736c6b2c,0x7b6d7b8d,0x734c7bce,0x734c736d,0x6b2c6b2c,
-0x734c6b2c,0x734c734c,0x734c734c,0x734c736d,0x6b2c6b4c,0x6b2c6b4c,0x6b4c630b,0x6b4c6b4c,0x734c6b0c,0x62eb6b0b,0x6b2c6b0c,0x6b2c6b0c,0x6b0b62eb,0x62eb6b0b,0x630b6b0b,0x62eb62eb,0x6b2c6b2c,0x630b630b,0x6b2c630b,0x6b2c6b2c,0x736d7bae,0x62eb630b,0x6b2c630b,0x62ca630b,0x630b630b,0x6b2b630b,0x630b62ea,0x6b0b7b8d,0x62eb62eb,0x6b2c630b,0x630b6b2c,0x62eb630b,
-0x5acb62eb,0x5acb5acb,0x630b62eb,0x6b2c630c,0x630b630b,0x6b2c6b2c,0x630b630c,0x6b4c630b,0x6b2c6b2c,0x630b630b,0x6b2c632b,0x6b2c632b,0x6b2c632b,0x630b6b2c,0x630b6b0b,0x736d6b2c,0x632b6b4c,0x630b630b,0x630b630b,0x632b630b,0x630b62eb,0x62eb630b,0x630b62eb,0x5aca630b,0x62eb5acb,0x62eb62eb,0x630b62eb,0x6b2c630b,0x630b6b4c,0x840f738d,0x7bad7bee,0x738d73ad,
-0x7bad83ae,0x7b8d7b8d,0x7bad7bad,0x7bad7b8d,0x736c7b8d,0x736d736d,0x7bad738d,0x738d7bae,0x840f840f,0x7bce83cf,0x738e83ef,0x7bae736d,0x7bce83ef,0x83ee840f,0x7bce7bae,0x83ef7bae,0x7b8e738d,0x736d6b4c,0x7bce7bae,0x738d7bce,0x7bce7bae,0x84108410,0x7bce7bef,0x738e738d,0x736d736d,0x736d738d,0x6b4c6b4c,0x736d736d,0x6b4c738d,0x7bee6b6c,0x736d73ad,0x6b4c736d,
-0x7b8d736d,0x736d7b8d,0x738d7bce,0x738d6b6c,0x94917bce,0x6b4c6b4c,0x6b4d738e,0x6b4c6b4c,0x840f7bce,0x7bce7bce,0x6b4c7bce,0x738d736c,0x736c7bae,0x7bce738d,0x7bce8c50,0x630b73ad,0x738d6b4c,0x7bce7bee,0x736d738d,0x7b8d736d,0x8bef83ef,0x734c7bae,0x734c6b2c,0x6b4c734c,0x6b2c736d,0x6b2c630b,0x6b0b6b2c,0x6b0b62eb,0x6b0c734c,0x62eb62eb,0x6b2c6b2c,0x62eb6b0b,
-0x6b2c6b0c,0x736d6b4c,0x6b4c736d,0x630b6b2c,0x6b0b6b2c,0x6b0b6b0b,0x6b2c62eb,0x6b0b6b4c,0x732c6b0c,0x6b2c734c,0x734d732c,0x6b0b6b0c,0x6b2c734c,0x734c6b2c,0x736d7b8d,0x736d734c,0x734c734d,0x6b2c6b0b,0x7b8e734d,0x732c734c,0x736d736d,0x736d7b8e,0x6b4c736d,0x6b2c738d,0x7b8d734d,0x736d736d,0x7b8d736d,0x734c734c,0x734c736c,0x7bae83ce,0x736d738d,0x738d6b6c,
-0x736d6b2c,0x6b0b6b2c,0x734c6b2c,0x6b2c736d,0x6b2c6b2c,0x6b4c734c,0x6b2c630c,0x6b4c6b4c,0x62eb6b0b,0x6b2c6b0c,0x62eb62eb,0x6b2c6b2c,0x6b0b6b0b,0x62eb62eb,0x6b0b630b,0x6b2b6b2b,0x630b62eb,0x62eb630b,0x630b62eb,0x62eb630c,0x630b736d,0x630b630b,0x630b5aca,0x62eb6b4c,0x630b630b,0x6b2b630b,0x6b2b62eb,0x6b0c7b8d,0x62eb62ca,0x6b0b62eb,0x6b2c6b2c,0x630b632b,
-0x62eb5acb,0x5acb5acb,0x6b2c630b,0x62eb6b2c,0x62eb5aca,0x6b2c630b,0x630b6b2c,0x6b2c62eb,0x630b62eb,0x630b630b,0x630b630b,0x6b2c630b,0x6b4c630b,0x630b630b,0x62eb6b2c,0x736d6b0b,0x6b2c6b4c,0x62eb630b,0x630b630b,0x6b2c630b,0x632b6b4c,0x630b630b,0x630b632b,0x62eb62eb,0x62eb5aca,0x630b630c,0x62eb62eb,0x6b4c630b,0x630b6b4c,0x738d736d,0x738d736c,0x738d73ad,
-0x7b8d7b8d,0x7b8d7b8d,0x7bad7bae,0x7b8d7b8d,0x7b8d736c,0x738d7b8d,0x7bae7bae,0x7bae738d,0x840f7bce,0x7bae738e,0x7bcf83ef,0x738d738e,0x738d7bce,0x840f840f,0x7bae738d,0x7bae83ef,0x7b8e7bae,0x736d736d,0x7bce736d,0x8c509471,0x738e736d,0x73ae7bce,0x7bce73ae,0x6b6d738e,0x736d6b4c,0x7b8d7bae,0x6b2c6b6c,0x6b2c6b4c,0x6b4c6b4c,0x738d6b4c,0x6b4c738d,0x7bad6b4c,
-0x736c6b4c,0x736d736d,0x7bce840f,0x632b6b4c,0x8c507bce,0x6b4c736d,0x6b4c738d,0x736d736d,0x8c30738d,0x7bae83ef,0x7bae7bce,0x6b2c738d,0x83ef738d,0x840f83ef,0x738d736d,0x736c738d,0x630b632b,0x7bad736d,0x6b4c734c,0x7bad736d,0x7bae734d,0x6b2c7b8d,0x734c6b0c,0x7b8d738d,0x6b4d738d,0x6b4c6b2c,0x630b6b4c,0x6b2c630b,0x734d6b2c,0x6b2c734c,0x6b2c630b,0x630b6b2c,
-0x630b62eb,0x6b4c6b2c,0x6b2c6b4c,0x630b6b0b,0x630b6b0b,0x6b0b62eb,0x6b2b630b,0x6b2b6b4c,0x6b0b6b0c,0x6b2c6b0c,0x6b0c6b2c,0x6b0c6aeb,0x734c734c,0x6b2c6b2c,0x736d736d,0x738d734c,0x736d734c,0x6b2c6b2c,0x736d734c,0x734c732c,0x7b6d736d,0x734d734c,0x738d7bae,0x736d736d,0x734d734d,0x7b8d736d,0x7bad83ce,0x7bad7b8d,0x734c734c,0x734c6b2b,0x6b2b736c,0x736d630b,
-0x736d736d,0x6b2c6b0b,0x736d6b4c,0x6b4c738d,0x6b4c6b4c,0x6b4c736d,0x6b0b6b2c,0x6b4c6b2c,0x62eb6b0b,0x6b2c6b0b,0x62cb62cb,0x6b0b6b0b,0x62eb6b0b,0x630b62ea,0x6b2b6b0b,0x6b0b6b2b,0x6b2b6b2b,0x5aca62eb,0x630b5aca,0x630b632b,0x630b6b4c,0x630b632b,0x62eb5aaa,0x630b6b4c,0x62eb62eb,0x62eb630b,0x6b0b62eb,0x6b0b6b2b,0x62eb62ca,0x6b4c6b2c,0x6b4c6b6c,0x630b6b2c,
-0x62eb630b,0x62eb5acb,0x6b2c630b,0x5aca630b,0x62eb5aca,0x630b62eb,0x630b6b4c,0x630b5aeb,0x630b62eb,0x632b630b,0x630b6b2c,0x6b2c630b,0x630b632b,0x630b630b,0x5aca62eb,0x62eb6b2c,0x6b2c632b,0x630b630b,0x632b632b,0x6b2c630b,0x630b6b2c,0x630b62eb,0x62eb630b,0x62eb62eb,0x62eb5acb,0x630b630b,0x62eb62eb,0x630c62eb,0x62eb630b,0x6b2c6b2c,0x6b4c632b,0x738d736d,
-0x736d7b6d,0x7bad736c,0x83ce83ce,0x7b8d83ae,0x736c736d,0x7bad738d,0x7bce7bae,0x738d7bce,0x6b6c738d,0x7bce7bce,0x7bcfa4f3,0x7bae83ef,0x83ef7bae,0x7bae7bad,0x738d7bce,0x738d7bae,0x736d738d,0x840f7bae,0x7bae7bae,0x840f8c30,0x738d7bae,0x6b6d6b6d,0x738d736d,0x738e738e,0x734c6b4c,0x7bae736d,0x632b736d,0x6b2c632b,0x6b4c630b,0x738d6b4c,0x736d736d,0x738d738d,
-0x6b4c736d,0x736d6b4c,0x7bce7bae,0x6b4c73ad,0x83ef738d,0x7bae7bce,0x6b4c736d,0x7bae736d,0x738d736d,0x7bae7bce,0x83ef7bae,0x6b6c738d,0x7bae6b6c,0x7bce9470,0x6b4c734c,0x738d734c,0x632b6b2c,0x6b4c6b4c,0x7bad736d,0x8c0f83ce,0x83ef7bae,0x7b8d83ce,0x6b2c734c,0x738d736d,0x6b2c6b4c,0x6b2c6b2c,0x6b4c6b4c,0x6b0b6b2c,0x6b2c6b0b,0x6b2c6b2c,0x6b0c630b,0x630c6b2c,
-0x630b630b,0x6b2c630b,0x6b2c6b4c,0x6b4c6b0b,0x62eb62eb,0x734c62eb,0x6b2b734c,0x6b2c6b2c,0x6b0c732c,0x732c6b0c,0x6b0b732c,0x6aeb6aeb,0x736d734c,0x6b0b736d,0x734c6b4c,0x736d736d,0x7b8d736d,0x734c736d,0x6b2c732c,0x7b6d732c,0x736d7b6d,0x736d734d,0x83ef736d,0x736d736d,0x736d7bae,0x7bae7b6d,0x9c919471,0x83ee9450,0x6b2b734c,0x83ee6b2b,0x7bad840f,0x632b6b2c,
-0x736d736d,0x6b2c6b2c,0x736d6b2c,0x6b2c736d,0x6b4c734c,0x6b4c6b4c,0x6b0b6b2c,0x736d6b2c,0x6b2c6b2c,0x62eb6b0c,0x6b2c6b0b,0x62eb6b2c,0x62eb6b0b,0x6b2c630b,0x736d736c,0x6b2c736c,0x6b2c734c,0x5aca630b,0x62eb5aca,0x630b630b,0x6b2c6b2c,0x62eb630b,0x62eb62eb,0x630b630b,0x62eb630b,0x62ea62eb,0x6b0b630b,0x6b2b62ea,0x6b0b62ea,0x6b4c6b2c,0x6b4c6b4c,0x630b6b2c,
-0x62eb630c,0x630b62eb,0x5aca630b,0x5aca5aaa,0x630b5acb,0x630b62eb,0x630b6b4c,0x62eb5aeb,0x630b630b,0x632b630b,0x6b4c6b4c,0x632b6b2c,0x6b2c630b,0x62eb632b,0x62eb5aca,0x5aca6b2c,0x630b5aea,0x632b630b,0x6b2c6b4c,0x632b630b,0x630b62eb,0x62eb62eb,0x630b62eb,0x62eb630b,0x630b630c,0x630b62eb,0x630b630c,0x62eb62eb,0x62eb62eb,0x6b2c630b,0x6b4c6b4c,0x7bae6b4c,
-0x83ae83ef,0x736d734d,0x83ce7b8d,0x736d83ce,0x6b4c7b8d,0x7bae736d,0x7bce7bae,0x73ad83ef,0x7bae738d,0xad546b6d,0x84109cb2,0x7bcf8c30,0x8c7083ef,0x738d7bad,0x83ce8c0f,0x83ce7bae,0x7bce83ef,0x8c107bce,0x7bae83ef,0x7bcf83ef,0x7bce8410,0x73ae73ae,0x736e738e,0x7bce738e,0x734c736d,0x738d6b4c,0x6b4c738d,0x6b2c6b4c,0x6b4c6b4c,0x7bae6b6c,0x73ad736c,0x6b4c7bae,
-0x736c736d,0x6b4c6b4c,0x738d6b4c,0x736d738d,0x7bae6b4c,0x7bce7bce,0x738d7bae,0x6b4c6b4c,0x736d736d,0x7bae6b4c,0x7bae83ce,0x7b8d7bce,0x738d6b2c,0x83ef738d,0x6b2c738d,0x6b4c734c,0x738d6b4c,0x6b4c738d,0x7bce736d,0x7bad7bad,0x7bae7bae,0x7b8d7b8d,0x6b2c736d,0x736d6b4c,0x630b630c,0x630b62eb,0x736d6b4c,0x62eb6b4c,0x630b630b,0x630b630b,0x630c630c,0x630b630b,
-0x630b630b,0x630b630b,0x6b2c6b2c,0x6b2c6b0c,0x6b2c630b,0x736d6b2c,0x6b2b736d,0x6b4c6b2b,0x734c732c,0x732c732c,0x734c6b2c,0x6aeb732c,0x736d6b2c,0x6b2c736d,0x6b4c6b4c,0x7b8d738d,0x6b2c736d,0x6b0c6b2c,0x7b6d7b8d,0x7b6d7b8d,0x7b8d7b6d,0x734d6b2c,0x736d6b0c,0x7b8e83ef,0x734d83cf,0x8c0f736d,0x8bee9450,0x8c2f83ce,0x6b0b7bad,0x7bad6b2b,0x7bad7bad,0x6b4c738d,
-0x734d734d,0x6b2c736d,0x6b4c6b0c,0x6b0c6b4c,0x6b2c630b,0x6b4c6b2c,0x6b2c6b4c,0x630b630b,0x734c6b0b,0x62eb6b2c,0x6b2c62eb,0x734c734d,0x6b0b6b0b,0x736c6b2c,0x7bae7b8d,0x736d7bae,0x6b0b6b2c,0x62eb62eb,0x630b62eb,0x6b4c632b,0x632b6b2c,0x5aca62eb,0x630b630b,0x630b62eb,0x62ea62ca,0x62ca5aca,0x62eb630b,0x6b2b630b,0x6b0b630b,0x6b2c6b0b,0x6b4c6b2c,0x6b2c6b4c,
-0x62eb630b,0x630b62eb,0x5aca62eb,0x5aca5aca,0x6b2c62eb,0x632c630b,0x632c6b4c,0x630b632c,0x630b630b,0x630b630b,0x6b4c6b2c,0x632c632c,0x6b6c630b,0x630b6b2c,0x630b62eb,0x630b630b,0x6b2c630b,0x630b632b,0x630b632b,0x6b4c630b,0x632b630b,0x630b630b,0x630b630b,0x6b2c6b2c,0x630b6b2c,0x630b62eb,0x630c6b2c,0x62eb630b,0x5aca62eb,0x6b4c62eb,0x6b4c736d,0x738d6b6c,
-0x83cf7bae,0x7b6d7bae,0x83ae7b8d,0x734c83ce,0x738d734c,0x736d736d,0x73ad7bae,0x7bee738d,0x7bce83ef,0xb5758c50,0x8c308410,0x83ef83ef,0x83ef8c30,0x7bae7bae,0x8c3083ef,0x83ef8c0f,0x83ef8c10,0x83ef7bae,0x7bce83ef,0x83ef83ef,0x840f83ef,0x7bce840f,0x73ae73ae,0x736d73ae,0x738d738d,0x736d736d,0x738d738d,0x6b2c738d,0x738d738d,0x738d736d,0x738d738d,0x7bad738d,
-0x7bae736c,0x736c736d,0x738d736d,0x736d6b4c,0x738d7bae,0x7bce7bae,0x83ee9471,0x6b2c736d,0x7b8d738d,0x738d738d,0x83ce83ef,0x7bce736d,0x736d7bae,0x7bce7bae,0x736d7bae,0x632b6b2c,0x6b6c6b4c,0x7bee7bce,0x7bae7bce,0x736d7b8d,0x7bae7bae,0x736d736d,0x736d7b8d,0x6b2c6b2c,0x630b632b,0x6b4c6b2c,0x6b2c734d,0x62eb630b,0x6b2c630b,0x630b6b2c,0x630b630b,0x62eb630b,
-0x630b5acb,0x62eb630b,0x6b4c6b2c,0x5aca630b,0x736d6b4c,0x6b4c6b4c,0x6b2b734c,0x6b2c6b2b,0x734c6b2c,0x6b0b732c,0x7b8d6b2c,0x6b2c7b8d,0x6b0b62eb,0x734c734c,0x6b2c736d,0x83ee738d,0x6b2c6b2c,0x734d736d,0x734c7b8d,0x83ae7b8e,0x6b2c734c,0x6b4c736d,0x736d7b8e,0x83ef738e,0x7b6d7bae,0x8bef736d,0x94509450,0x8c0f8c0f,0x6b2b734c,0x736c7b6d,0x7bad7bce,0x6b2c6b4c,
-0x6b2c734c,0x738d738d,0x6b4c6b4c,0x736d6b4c,0x734c6b4c,0x630b6b2c,0x6b2c6b0b,0x630b6b0b,0x62ca6b2c,0x62eb62cb,0x6b2c62ca,0x734c7b8e,0x6b2b6b0b,0x734c6b4c,0x7bae736c,0x736d83ce,0x6b0b734c,0x630b62eb,0x62eb62eb,0x6b4c630b,0x630b6b4c,0x630b62eb,0x630b62eb,0x62eb630b,0x630b62ca,0x630b5aca,0x62eb6b0b,0x6b0b6b2c,0x630b630b,0x6b2c6b2c,0x734c6b4c,0x630b6b2c,
-0x630b62eb,0x62eb630b,0x630b62eb,0x5aca62eb,0x630b5aca,0x630b62eb,0x630b632c,0x62eb630b,0x6b2c62eb,0x630b632b,0x630b630b,0x6b2c632c,0x630b632c,0x6b4c632c,0x62eb5aea,0x630b630b,0x736d736d,0x62eb6b2c,0x62eb62eb,0x736d630b,0x630b6b2c,0x630b62eb,0x5aca62eb,0x6b2c62eb,0x62eb630b,0x62eb62eb,0x62eb630b,0x630b62eb,0x5aca5aca,0x736d62eb,0x6b6c738d,0x6b2c736d,
-0x7b8d7bad,0x7b8d83ce,0x736d736d,0x734c734d,0x6b4c734c,0x6b2c736d,0x738d83ef,0x738d736d,0x7bae83ef,0x83ef9471,0x8c107bce,0x734d83cf,0x8c509491,0x6b4c738d,0x7b8e6b4c,0x7bae7bae,0x736d736d,0x840f738d,0x83ef840f,0x736d736d,0x736d738d,0x738d7bae,0x736d6b4c,0x738d738e,0x7bad7bae,0x736c738d,0x6b4c6b4c,0x738d736c,0x734c6b4c,0x736d6b4c,0x73ad736d,0x7bce738d,
-0x7b8d7bad,0x83ee7bce,0x7bad7bad,0x6b2c7bae,0x7bae7bae,0x83ee7bce,0x949183ef,0x736c83ee,0x7bae7bce,0x7b8d7b8d,0x738d738d,0x6b6c736c,0x738d83ef,0x630b736d,0x738d6b4c,0x632b6b2c,0x738d6b4c,0x83ef738e,0x7bce8c30,0x7bae738d,0x738d83ef,0x7b8d7bae,0x6b2c734c,0x734c6b2c,0x632b630b,0x6b2c630b,0x6b4c736d,0x6b0c6b0b,0x6b2c6b0b,0x6b0c6b2c,0x6b0b6b0b,0x6b0b6b0b,
-0x630b62eb,0x630b630b,0x6b2c630b,0x738d736d,0x7bae738d,0x6b4c736d,0x6b2c6b2c,0x738d738d,0x6b2b6b0b,0x736c734c,0x6b4c6b2c,0x738d7b8e,0x630b630b,0x6b4c6b2c,0x736d734c,0x7bad738d,0x7b8d734c,0x6b2c734c,0x7b8d6b2c,0x734c7b8d,0x738d736d,0x734c7b8d,0x738d738d,0x7b8d7bae,0x734c7bae,0x7bae6b2c,0x9c919430,0x83ae9c71,0x7b6c734c,0x83ee7bae,0x734c83ce,0x736d732c,
-0x736d7bae,0x7bad6b4c,0x736d738d,0x6b4c6b2c,0x738d738d,0x6b4c6b4c,0x736d6b4c,0x736d734c,0x5aaa734c,0x62ca5aca,0x6b2b630b,0x6b4c6b4c,0x630b630b,0x736c6b2c,0x738d736c,0x738d7bad,0x632b6b2c,0x6b2c630b,0x5aca630b,0x62eb5aaa,0x6b4c630b,0x5aca62eb,0x630b5aca,0x630b62eb,0x62ca62ea,0x6b0b62eb,0x62ea5aaa,0x6b4c736d,0x630b6b2c,0x6b4c6b2c,0x6b4c6b6c,0x630b6b2c,
-0x62eb5aca,0x62eb62eb,0x630b630b,0x5aeb5aeb,0x5aca5aeb,0x5acb62eb,0x62eb62eb,0x6b2c6b2c,0x630b632b,0x5aea62eb,0x5aca5aea,0x736d630b,0x62eb62eb,0x632c630b,0x630b632c,0x630b630b,0x62eb6b2c,0x630c630b,0x630b62eb,0x630c6b2c,0x630b630b,0x630b630b,0x5aeb62eb,0x632c630b,0x632b6b2c,0x62eb630c,0x630b62eb,0x62eb62eb,0x5aca62eb,0x736d630b,0x736d7bce,0x738d738e,
-0x734c83ce,0x7b8d736d,0x6b2c736d,0x7bae734c,0x736d734c,0x738d738d,0x738d6b6c,0x7bae738d,0x7bae7bae,0x7bae736d,0x83ef7bae,0x83ef7bce,0x83ef9471,0x7bce83ef,0x738e7bae,0x7bae7b8e,0x736d738e,0x736d6b4c,0x738d736d,0x736d736d,0x736d738d,0x7bce738d,0x7bae7bcf,0x6b4c736d,0x73ad73ae,0x7bad7bad,0x6b2c736d,0x6b4c6b2b,0x6b2c736d,0x738d6b4c,0x738d6b4c,0x738d7bad,
-0x7b8d738d,0x7bce7bad,0x7bad7bce,0x736d736d,0x7bce6b0b,0x7bae7bce,0x8c2f7bae,0x83ee8c0f,0x736d736d,0x738d738d,0x738d73ad,0x6b4c736d,0x738d736d,0x6b6c6b4c,0x630b6b4c,0x630b6b4c,0x736d630b,0x738d736d,0x738d7bce,0x738d736d,0x7bae7bae,0x7bad7bad,0x734c7b8d,0x736c6b0b,0x630b6b2c,0x734c6b0b,0x6b2c6b4c,0x736d734d,0x734c734c,0x6b0b6b2c,0x6b2c6b0b,0x734c732c,
-0x62eb6b0b,0x6b4c630b,0x6b2c6b4c,0x7bee738d,0x7bae7bce,0x6b2c6b4c,0x6b2c6b2c,0x738d736d,0x734c6b2c,0x6b2b6b2c,0x738d6b4c,0x736d7b8e,0x736d6b2c,0x630b6b2c,0x736d736c,0x736c6b4c,0x7b8d734c,0x7b8d736d,0x738d736d,0x734c736d,0x6b4c6b2c,0x6b2c6b4c,0x738d736d,0x736d738d,0x7b6d736c,0x736c734c,0x83ce83ce,0x6b2b7b8d,0x736c734c,0x734c734c,0x734c734c,0x7b8d734d,
-0x736c736d,0x6b4c6b4c,0x734c6b4c,0x6b2c6b4c,0x736d6b4c,0x6b4c736c,0x6b2c6b4c,0x6b4c6b4c,0x5aa96b2b,0x62eb5aa9,0x6b2c6b2c,0x6b2c6b4c,0x6b2c6b4c,0x7bcd736c,0x738c7bad,0x738d736c,0x6b4c6b6c,0x630b630b,0x62eb630b,0x630b62eb,0x6b2c6b2c,0x62eb62eb,0x630b5aea,0x62eb62eb,0x62ca6b2b,0x6b2b62ca,0x62ea62eb,0x7bae736d,0x632b6b2c,0x6b2c6b2c,0x630b630b,0x632b630b,
-0x62eb62eb,0x630b630b,0x630b62eb,0x5aeb62eb,0x5aeb5aca,0x630c62eb,0x630c62eb,0x630b630b,0x62eb6b2c,0x5aea5aca,0x630b630b,0x630b62eb,0x630b6b6c,0x632c62eb,0x630b6b2c,0x632c630b,0x630b630b,0x630c630b,0x630b6b2c,0x736d630b,0x62eb62eb,0x630b630b,0x5aeb630b,0x5aeb5aeb,0x630b630b,0x630b630b,0x62eb62eb,0x62eb5acb,0x62eb5acb,0x6b2c630b,0x73ae736d,0x736d7bce,
-0x7b8d8c0f,0x7b8d7b6d,0x7bad7bce,0x7b8d7b8e,0x736d734c,0x7bae738d,0x83ef83ef,0x7bae738d,0x7bce736d,0x6b4c7bae,0x7bce83ef,0x9cd28c10,0x8c30b555,0x83cf7bce,0x736d738d,0x7bae6b4c,0x738e738d,0x7bae738e,0x738d738d,0x736d736d,0x736d736d,0x7bce736d,0x7bae83ef,0x736d6b4d,0x738d6b6d,0x7bce7bce,0x736d7bae,0x6b4c6b4c,0x736d7bae,0x7bad738d,0x6b4c738d,0x738d6b4c,
-0x738d736d,0x83ce7bae,0x83ef83ef,0x7bae7bce,0x6b4c736d,0x83ef7bae,0x7bce7bae,0x840f83ce,0x734c7bad,0x738d6b4c,0x736d7bad,0x736c6b4c,0x6b6c738d,0x736d736d,0x6b6c6b4c,0x738d736d,0x738d6b2c,0x6b4c736d,0x736d736d,0x738d736d,0x7bae736d,0x7b8d83ce,0x738d7b8d,0x6b2b6b2b,0x6b0b6b2b,0x6b2c630b,0x736d738d,0x736d734d,0x7b8d7b8e,0x6aeb732c,0x6b0c6aeb,0x6b0b6b0c,
-0x630b6b2c,0x6b2c6b2c,0x6b2c6b2c,0x7bce738d,0x7bae8c30,0x6b4c6b4c,0x630b6b4c,0x736d6b2c,0x736d6b2b,0x6b2b6b4c,0x6b2c6b4c,0x6b2c6b2c,0x738d6b4c,0x630b6b4c,0x736c6b4c,0x6b4c6b2c,0x736d736d,0x736d734c,0x734c734d,0x6b4c6b4c,0x734c6b4c,0x6b4c734c,0x6b4c736d,0x6b4c6b4c,0x6b2c734c,0x736d734c,0x6b2b6b2c,0x6b0b734c,0x736c734c,0x6b0b732c,0x736d732c,0x734c736d,
-0x736c734c,0x6b2c734c,0x736d6b4c,0x6b4c736d,0x6b4c6b6c,0x6b2c6b2c,0x630b734c,0x5aaa6b0b,0x5aca62ea,0x630b5aa9,0x736c6b4c,0x6b4c734c,0x6b2b6b2b,0x736d6b4c,0x6b4c736c,0x630b6b2b,0x6b2c630b,0x5aea630b,0x5aca5aca,0x62eb5aca,0x632b6b4c,0x630b62eb,0x5aca5aea,0x5aaa5aaa,0x62ea62eb,0x630b62ea,0x630b630b,0x6b4c6b4c,0x630b632b,0x6b2c630b,0x632b6b2c,0x632b630b,
-0x630b630c,0x630b630b,0x5aeb5aeb,0x630b630b,0x5aeb5aca,0x6b2c62eb,0x6b2c630b,0x6b2c630b,0x630b6b2c,0x62eb62eb,0x630b630b,0x630b62eb,0x6b4c632b,0x630b6b2c,0x632b630b,0x5aeb630b,0x630b630b,0x630b630b,0x630b6b2c,0x6b4c630c,0x630c6b2c,0x630b630b,0x62eb62eb,0x62eb62eb,0x62eb630b,0x630b630b,0x62eb630b,0x630b62eb,0x630b630b,0x6b2c62eb,0x6b6d6b2c,0x738e738e,
-0x7b8d83ce,0x736d7b8d,0x7bae7bad,0x736d7bae,0x738d6b4c,0x738d7bae,0x7bee83ef,0x840f7bce,0x83ef83ef,0x7bae736d,0x7bae7bae,0xbdd683cf,0x7bceb575,0x83ef83ef,0x6b2c7bce,0x7b8e738d,0x738d7bcf,0x738d736d,0x7bae7bae,0x736d738d,0x738e736d,0x738d736d,0x738e7bce,0x736d738d,0x6b4c632c,0x7bae738d,0x73ad7bae,0x6b6c738d,0x7b8d736d,0x7bce7bce,0x6b4c7bae,0x738d6b4c,
-0x7b8d7bce,0x8c307bce,0x7bae83ef,0x7bce7bae,0x83ef7bae,0x738d738d,0x736d7bce,0x7b8d6b4c,0x7bce8c30,0x7bad738d,0x738d7bad,0x738d736d,0x738d73ad,0x7bae736d,0x6b4c6b6d,0x83ef7bef,0x738d736d,0x6b2c6b2c,0x736d736d,0x738d738d,0x738d736d,0x7bad7bce,0x738d736d,0x62ea736c,0x6b2c62eb,0x630b630b,0x7b8d736d,0x6b2c734c,0x7b8d7bae,0x734d736d,0x7bae7b6d,0x734d7b8d,
-0x6b4c734c,0x6b0b6b4c,0x6b2c62eb,0x736d736d,0x7bee7bee,0x6b2c738d,0x6b4c632b,0x630b6b4c,0x6b2c630b,0x736c6b4c,0x6b2c736d,0x6b2c630b,0x734d6b4c,0x6b4c736d,0x6b2b6b0b,0x6b2b6b4c,0x736d7b8d,0x736d6b2c,0x736d736d,0x6b4c734c,0x736d736d,0x7b8d738d,0x6b2c736d,0x738d6b4c,0x6b2b738d,0x7b8d734c,0x6b0b6b2c,0x736c736c,0x732c6b2b,0x6aeb6b0b,0x736d6b2c,0x6b0c734c,
-0x736c736c,0x736c738d,0x736d738d,0x738d738d,0x6b4c6b4c,0x736d734c,0x62ca6b2c,0x5aca630b,0x6b0b62ca,0x62eb62ea,0x738d6b0b,0x736d738d,0x6b2b6b2b,0x6b2c6b2c,0x6b4b6b2b,0x62ea6b2b,0x6b4c630b,0x630b6b4c,0x5aea62eb,0x6b2c62eb,0x5aca62eb,0x632b630b,0x5aaa5aca,0x62eb5aca,0x62eb5aca,0x62ca62eb,0x62eb62eb,0x5aca62eb,0x5aea62eb,0x62eb5aca,0x62eb630b,0x62eb62eb,
-0x62eb630c,0x62eb630b,0x5aeb5aca,0x630b630b,0x5aeb5aca,0x62eb630b,0x630b6b2c,0x6b2c6b2c,0x6b2c736d,0x62eb62eb,0x630b630b,0x6b2c630b,0x6b2c630b,0x6b4c6b2c,0x630b6b2c,0x630b62eb,0x5aca630b,0x630b62eb,0x736d630b,0x6b4c738e,0x6b2c6b2c,0x62eb630b,0x62eb62eb,0x630c630b,0x5aea630b,0x62eb62eb,0x62eb62eb,0x630b62eb,0x630b62eb,0x6b4c630b,0x632c630c,0x7bce736d,
-0x7b8d7bae,0x7bce83ce,0x734d7b8e,0x7bce7bae,0x738d736d,0x7bae7bae,0x840f738d,0x7bee840f,0x83ef8c30,0x7bce7bce,0x7bce83ef,0xad548c30,0x8c507bae,0x83ef840f,0x94918c50,0x6b4c7bce,0x7b8e7bae,0x736d738d,0x738d738d,0x738d7b8e,0x7bae7bae,0x738d736d,0x7bae7bae,0x736d7bae,0x6b4c6b4c,0x6b4c6b2c,0x738d736d,0x736d738d,0x6b4c6b2c,0x7bce7bce,0x738d738d,0x738d7bce,
-0x83ce738d,0x7bae7bce,0x7bae7bce,0x738e736d,0x8410736d,0x736d9471,0x8c30738d,0x734c7bae,0x83ee7bae,0x738d7bce,0x736d6b4c,0x6b4c736d,0x738d83ef,0x7bae738d,0x6b6c736d,0x6b4c736d,0x73ad738d,0x6b0b6b4c,0x7b8d6b4c,0x7bae7bae,0x6b4c736d,0x7b8d736c,0x736c738d,0x6b0b734c,0x6b2b6b0b,0x630b6b2c,0x6b4c630b,0x6b2c736d,0x6b0b6b0c,0x732c6b0b,0x83ae7b8d,0x734d7b8e,
-0x6b4c736d,0x736d6b4c,0x6b0b6b4c,0x736d6b2c,0x736d736d,0x6b2b736c,0x736c6b2b,0x6b4c736c,0x630b6b0b,0x7bae6b2c,0x7bae7bce,0x736d7bae,0x6b4c734c,0x738d738d,0x6b0b6b2c,0x6b0b6b2c,0x736d736d,0x7b8d734c,0x736d7b8d,0x6b2c734c,0x7bae7b8d,0x7b8d7bae,0x6b2c736d,0x736d6b2c,0x6b2c736c,0x6b0b6b0b,0x630b6b0b,0x6b2b62eb,0x6b0b6b0b,0x62ca62ea,0x734c6b0b,0x6b4c734c,
-0x736d736d,0x6b4c738d,0x6b2c734c,0x736d736d,0x6b2c6b2c,0x6b2c6b2c,0x5aaa62ca,0x5aca5aca,0x6b2c5aca,0x62eb630b,0x734c62eb,0x738d736d,0x62eb6b2c,0x6b2b62eb,0x6b2b6b2c,0x630b6b0b,0x6b2c6b2c,0x630b630b,0x630b630b,0x630b630b,0x5aca5aca,0x630b630b,0x5aca5aca,0x630b62eb,0x630b6b2b,0x630b630b,0x62eb630b,0x630b62ca,0x630b630b,0x62eb630b,0x5aca5aea,0x6b2c62eb,
-0x62ca630b,0x62eb62eb,0x5aea5aca,0x62eb630b,0x62eb62eb,0x5aca62eb,0x62eb630b,0x630b62eb,0x6b2c6b0b,0x630b6b2c,0x62eb62eb,0x734c630b,0x630b630b,0x632b632b,0x630b630b,0x6b2c630b,0x62ca630b,0x630b62eb,0x736d630b,0x6b4c738d,0x630b62eb,0x630b630b,0x62eb630b,0x630b630b,0x62eb630b,0x5aea62eb,0x630b62eb,0x62eb62eb,0x630c5acb,0x6b4c6b2c,0x632c630b,0x73ae738d,
-0x83ce83ee,0x83ef840f,0x736d7bae,0x7bce7bae,0x7b8d7bce,0x73ad73ad,0x840f7bce,0x7bce840f,0x83ce9491,0x8c507bae,0x738d8c30,0xa5139471,0x840f7b8e,0x8c309cb2,0x9491840f,0x736da4f3,0x83cf736d,0x7bae8c10,0x6b4c736d,0x738d736d,0x738d7bae,0x7b8e736d,0x738d738d,0x7bce7bae,0x6b4c738e,0x6b4c6b2c,0x738d736d,0x738d738d,0x6b4c6b4c,0x7bae738d,0x7bae7bae,0x738d7bae,
-0x7b8d6b4c,0x738d7bae,0x7bae738d,0x736d738e,0x736d6b4d,0x7bae8410,0x8c306b2c,0x6b4c8c50,0x7bad6b4c,0x7bce83ee,0x738d738d,0x6b4c736c,0x6b4c83ef,0x736d738d,0x736d6b4c,0x6b4c630b,0x83ef7bae,0x6b2c738d,0x7b8d6b4c,0x7bae83ce,0x736d736d,0x734c6b4c,0x734c738d,0x6b2b6b2b,0x6b4c734c,0x6b2c6b2c,0x6b4c6b4c,0x6b2c6b2c,0x62eb62eb,0x734c6b0b,0x7b8d7b6d,0x734d736d,
-0x6b2c736d,0x738d6b4c,0x6b4c736d,0x736d6b4c,0x630b734c,0x6b4c630b,0x6b2c736c,0x73ad6b4c,0x6b4c6b2c,0x7bae738d,0x83ef7bae,0x738d83ef,0x736d736d,0x736d736d,0x734c738d,0x6b4c6b2c,0x736d6b2c,0x7b8d736d,0x734c734d,0x734c734c,0x7bae738d,0x736d738d,0x6b4c6b4c,0x6b2c6b2c,0x734c736c,0x6b2c734c,0x734c6b2c,0x6b0b6b2c,0x6b2b6b2b,0x6b0b6b0b,0x6b2c6b0c,0x736d6b4c,
-0x738d738d,0x6b2c738d,0x6b0b630b,0x6b2c6b4c,0x6b2c6b6c,0x6b2c62eb,0x630b62eb,0x62eb62ca,0x62eb5aca,0x630b6b2c,0x630b62eb,0x6b4c6b0b,0x6b0b6b4c,0x6b2b630b,0x6b4c6b2c,0x6b2c6b4c,0x6b2c6b4c,0x630b632b,0x632b6b2c,0x6b2c630b,0x62eb630b,0x5aca630b,0x5aca5aca,0x5aca62eb,0x62ca62eb,0x630b62eb,0x5aca630b,0x62eb5aaa,0x630b62eb,0x5aca62eb,0x62eb62eb,0x630b62eb,
-0x62eb630b,0x630b62eb,0x5aea5aea,0x5aca62eb,0x6b2c630b,0x62eb5acb,0x630b62eb,0x630b62eb,0x630b62eb,0x630b6b2c,0x62eb62eb,0x6b2c630b,0x6b2c6b2c,0x62eb630b,0x630b62eb,0x5aca630b,0x630b630b,0x630b630b,0x630b6b2c,0x6b2c62eb,0x630b630b,0x6b2c632b,0x630b630b,0x630b630b,0x630b630b,0x630b6b2c,0x630c630b,0x5acb62eb,0x62eb62eb,0x6b2c62eb,0x630b630c,0x6b6d6b2c,
-0x7bce7bce,0x738d7bad,0x736d7b8d,0x6b2c738d,0x83ce83ef,0x736d7bce,0x83ef7bce,0x94918c30,0x83eea4f2,0x738d83ef,0x736d83ce,0x9491a513,0x8c0f840f,0x9c929471,0x840f83cf,0x94718c50,0x7bce7bae,0x738d7bce,0x736d738d,0x734d736d,0x7bae736d,0x736d7bae,0x6b4c736d,0x83ef738d,0x738d7bcf,0x736d6b4d,0x736d736d,0x738d736d,0x738d738d,0x738e736d,0x7bae7bce,0x738d736d,
-0x6b4c83ce,0x83ef736d,0x736d7bae,0x738e738e,0x83ef7bae,0x736d630c,0x738d738d,0x7bce8c0f,0x6b6c6b6c,0x7bce738d,0x6b6c7bae,0x6b4c6b2c,0x6b4c630b,0x736d6b4c,0x630b6b2c,0x8c307bce,0x7bce7bce,0x6b4c738d,0x736d6b4c,0x7b8d7bae,0x7b8d736d,0x6b2c734c,0x736c736c,0x6b2b734c,0x736d734c,0x734c6b2c,0x7b8d7bae,0x6b0b6b0c,0x6b0b6b0c,0x736d6b2c,0x734c736d,0x7b6d734c,
-0x734d736d,0x734d734d,0x736d6b4c,0x6b4c736d,0x6b2c6b2c,0x6b2b6b2b,0x736c6b2c,0x736c734c,0x7b8d734c,0x7bae7bae,0x7bae7bae,0x736d7bae,0x736d736d,0x734d736d,0x736d736d,0x734d736d,0x736d734d,0x736d736d,0x734c734c,0x7b8d736d,0x734c734c,0x6b4c6b2c,0x736d6b4c,0x6b4c6b4c,0x6b2c6b2c,0x736c736c,0x736c6b4c,0x6b2b6b4c,0x6b4c6b2c,0x6b4c6b4c,0x6b4c734c,0x738d6b4c,
-0x7b8d7bae,0x6b4c736d,0x6b2c630b,0x6b4c6b2c,0x62eb630b,0x6b4c6b2c,0x6b4c736d,0x630b62eb,0x630b6b4c,0x6b2c736d,0x62eb62eb,0x6b2c62eb,0x6b2c6b2c,0x62eb6b2c,0x6b2c62eb,0x630b6b2c,0x630b630b,0x5aca62eb,0x62eb62eb,0x62eb62eb,0x62eb5aca,0x5aca630b,0x5aea62eb,0x5aca5aea,0x630b62eb,0x6b0b6b4c,0x6b2c630b,0x5aea62eb,0x630b5aea,0x62eb62eb,0x6b6c6b4c,0x62eb630b,
-0x630b6b0b,0x630b630b,0x5aea62eb,0x5aca5aca,0x6b2c630b,0x62eb5aea,0x6b2c630b,0x6b2c62eb,0x630b6b2c,0x62eb62ca,0x6b4c6b2c,0x62eb6b0b,0x62eb734c,0x6b4c630b,0x62eb6b2c,0x62eb630b,0x62eb62ea,0x6b0b62eb,0x62eb6b2c,0x6b2c62eb,0x6b2c6b4c,0x630b6b0b,0x630b630b,0x630b630b,0x6b2c6b2c,0x6b2c6b4c,0x630b630b,0x62eb62eb,0x5aca630b,0x630b5aca,0x5aeb630b,0x632c630c,
-0x7bad7bce,0x734c736c,0x736d736d,0x736d7bae,0x83ef7bae,0x738d7bae,0x9cb26b4c,0x8c509cb2,0x7bad9cd2,0x7bad734c,0x83ef6b4c,0x83ef9491,0x840f7bae,0x8c308c50,0x9cb29471,0x83cf840f,0x738d83cf,0x7bae738d,0x738d83ef,0x738d738d,0x7bce6b4c,0x736d83cf,0x736d736d,0x7bae6b2c,0x7bce7bcf,0x736d738d,0x6b4d6b4c,0x6b4c6b4d,0x7bae738d,0x738d7bae,0x83ef736d,0x6b4c7bce,
-0x738d7bad,0x7bae738d,0x7bae7bae,0x7bae7bae,0x6b4d6b4d,0x6b4c736d,0x8c30736d,0x8c307b8d,0x738d840f,0x738d736c,0x738d7bae,0x6b2b6b4c,0x6b4c6b4c,0x6b2c6b2c,0x6b6c6b4c,0x8c307bce,0x6b4c7b8d,0x6b2c630b,0x6b2c6b4c,0x736d6b4c,0x6b4c736d,0x736c6b2c,0x734c734c,0x734c7b8d,0x6b2c6b2b,0x736d736c,0x7bae7b8d,0x6b0b736d,0x734d736d,0x7b8e7b6d,0x6b0b736d,0x736d6b0c,
-0x7b8d7b8e,0x6b2c736d,0x6b4c6b2c,0x6b2c734c,0x6b0b6b2c,0x630b6b2b,0x736d6b2c,0x6b4c6b4c,0x7b8e736d,0x7b8e736d,0x83ce83cf,0x736d7b8d,0x736d7b8e,0x734d736d,0x734c6b0c,0x6b2c7b8d,0x734d734d,0x734d6b2c,0x6b2c6b2c,0x736d734c,0x6b2c6b2c,0x734c630b,0x6b2c6b4c,0x6b4c630b,0x6b2c630b,0x6b4c6b4c,0x6b4c738d,0x736c62eb,0x6b2c6b0b,0x734c6b4c,0x6b4c734c,0x738d6b4c,
-0x736d7bce,0x736d6b2c,0x6b2c6b4c,0x736d6b2c,0x62eb6b2c,0x7bce736d,0x94719471,0x738d7bae,0x736d83ce,0x6b4c7bce,0x6b2c630b,0x6b2c630b,0x736d738d,0x6b2c6b4c,0x630b630b,0x6b4c6b2c,0x630b630b,0x5aca62eb,0x6b2c630b,0x5aca630b,0x630b5aca,0x630b6b2c,0x5aca6b2c,0x5aaa5aaa,0x630b62eb,0x62eb6b4c,0x630b5aca,0x5aca62eb,0x630b5aca,0x62eb630b,0x6b2c6b2c,0x62eb630b,
-0x6b0b630b,0x630b6b0b,0x5aca630b,0x5aca5aca,0x630b62eb,0x5aca62eb,0x630b6b2c,0x630b62eb,0x6b0b630b,0x62eb630b,0x630b62eb,0x6b2c6b0b,0x5aaa62eb,0x6b2c62eb,0x6b0b62eb,0x6b2c734c,0x630b6b2c,0x6b2c6b2c,0x630b630b,0x62eb6b2c,0x630b6b2c,0x62eb62eb,0x6b0b630b,0x630b630b,0x632b6b2c,0x632b6b2c,0x62eb630b,0x630b5acb,0x62eb62eb,0x5acb62eb,0x630b630b,0x6b4c6b6d,
-0x7bad7bae,0x734c7bae,0x736d6b2c,0x7bae734c,0x738d83ce,0x73ad83ef,0xbdd68c30,0x840f8c50,0x83ee8c50,0x6b6c738d,0x9cd27bae,0x738dad13,0x83ef7b8d,0x840f8c50,0xa5138c50,0x734d9491,0x840f7bae,0x7bae738d,0x83ce7bae,0x7b8e7bce,0x736d6b4c,0x736d7b8e,0x736d6b4c,0x736d738d,0x73ae736d,0x83ef83ef,0x6b2c736d,0x7bae738d,0x83ef736d,0x83ef8c30,0x738d736d,0x7bae83ef,
-0x738c738d,0x738d7bcd,0x83ce7bce,0x738d738d,0x738e738d,0x7bce7bae,0x736d6b2c,0x738d736d,0x94918c2f,0x738d73ad,0x7bce6b6c,0x736d738d,0x7bae6b6c,0x738d83ef,0x736d6b4c,0x7bce738d,0x736d7bce,0x6b0c6b2c,0x6b2c6b0b,0x6b2c734c,0x734c6b2c,0x736d6b2c,0x6b4c734c,0x734c736d,0x6b4c6b2c,0x736c734c,0x6b0c6b2c,0x6b2c734c,0x6b2c6b0c,0x7b8e7b6d,0x734d734d,0x6b2c736d,
-0x6b2c736d,0x6b0c6b0c,0x62eb62eb,0x6b2c6b2c,0x62eb734c,0x736c734c,0x6b2b630b,0x6b2c6b4c,0x734c736d,0x7b8e7b8d,0x736d734d,0x83ce83cf,0x7b8d7bae,0x6b2c736d,0x736d734c,0x736d736d,0x732c732c,0x732c6b2c,0x7b6d736d,0x6b0b734c,0x734c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x6b2c6b0b,0x734c7b8d,0x6b4c6b4c,0x6b4c6b2b,0x6b2b6b2b,0x6b4c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x738d6b4c,
-0x734c7bae,0x736d738d,0x6b4c6b2c,0x630b6b4c,0x6b2c5acb,0x83ef630b,0x8c30a4f3,0x630b6b2c,0x6b2c736d,0x6b2c630b,0x62eb6b2c,0x6b4c630b,0x6b2b6b4c,0x6b2c6b2c,0x6b4c6b2c,0x734d6b2c,0x6b2c632b,0x5aca630b,0x6b2c62eb,0x62eb632b,0x630b62eb,0x5aca62eb,0x62eb630b,0x5aca5aaa,0x738d6b4c,0x6b2c6b4c,0x5aca630b,0x5aca62eb,0x630b62eb,0x62eb630b,0x62eb62eb,0x630b62eb,
-0x6b2c630b,0x5aca630b,0x62eb630b,0x5aca62eb,0x62eb5aca,0x5aca5aca,0x630b62eb,0x630b630b,0x6b0c736d,0x5aca62eb,0x5aca62cb,0x7b8d6b2c,0x62ca62eb,0x6b2c62eb,0x62eb62eb,0x6b2c62eb,0x62eb6b2b,0x6b2c6b2b,0x6b2c6b2b,0x630b6b2c,0x630b630b,0x6b0b630b,0x630b6b2c,0x630b62eb,0x632b6b2c,0x630b630b,0x62eb630b,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x630b5aeb,0x6b6d6b4c,
-0x83ef7bce,0x734c7bce,0x736d734c,0x7bae6b2c,0x7bce8c50,0x83ef7bae,0x8c30bdd6,0x83ee6b4c,0x7bce840f,0x736c83ee,0xb5757bae,0x840f8c0f,0x8c3083ef,0x8c509471,0x9cb29451,0x7bce8c50,0x83ef83ef,0x7bae83ef,0x83ef736d,0x7bae738d,0x736d736d,0x736d736d,0x736d734d,0x738d738d,0x738d738d,0x841083ef,0x7bae83ef,0x738e7bae,0x840f7bae,0x7bae840f,0x6b4d7bae,0x83ef736d,
-0x738c736d,0x7bad738d,0x736d736c,0x736d7bee,0x738d6b4d,0x7bae7bae,0x6b4c7bce,0x7bce6b2c,0x7bce6b4c,0x736c840f,0x738d6b4c,0x842f8c70,0x6b6c738d,0x6b6c736d,0x738d6b4c,0x8c307bce,0x83ef8c30,0x6b0c736d,0x7b8d734d,0x6b0c734d,0x736d734c,0x6b4c6b4c,0x736d738d,0x6b2c6b2c,0x7b8d736c,0x736c736c,0x6b0b734c,0x736d6b0c,0x736d6aeb,0x734d736d,0x7b8d7b8d,0x7b8e734d,
-0x7b8d6b2c,0x62eb734c,0x6b2c6b0b,0x734c6b2c,0x62eb734c,0x736c6b2b,0x6b4c736c,0x736d6b4c,0x736d6b2c,0x7b8d736d,0x7b8d7bae,0x7bae736d,0x736d7b8d,0x736d734c,0x6b0c736d,0x7b8d6b0c,0x6b0c736d,0x732c6b2c,0x736d6b0c,0x6b2c7b8d,0x6b2c6b0b,0x6b2c6b2c,0x6b2c6b0b,0x6b0b6b0b,0x738d6b2c,0x6b2c630b,0x6b2b6b4c,0x6b4c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x630b632b,0x7bae6b4c,
-0x630b6b4c,0x734c6b4c,0x6b4c6b2c,0x630b6b2c,0x630b5aca,0x6b2c62eb,0x736d7b8d,0x5aca630b,0x62eb630b,0x62eb5aca,0x62eb62eb,0x6b4c630b,0x630b6b2b,0x6b2c6b2c,0x734c6b2c,0x736d734d,0x6b4c6b4c,0x632b6b4c,0x5aca62eb,0x630b5aca,0x62eb6b2c,0x62eb5aca,0x5aca5aca,0x5acb5acb,0x6b4c6b4c,0x630b630b,0x630b632b,0x630b630b,0x630b630b,0x630b62eb,0x630b630b,0x630b62eb,
-0x6b4c734c,0x630b62eb,0x6b2c6b0b,0x5aea62eb,0x630b62eb,0x62eb62eb,0x630b630b,0x630b62eb,0x62eb62eb,0x62eb62eb,0x5aaa62eb,0x630b62eb,0x62eb630b,0x6b2c62eb,0x6b2c6b2c,0x6b2c630b,0x62ea62ea,0x6b4c6b2c,0x6b2b6b2b,0x630b630b,0x630b630b,0x630b630b,0x630b6b0b,0x630b62eb,0x6b2c6b4c,0x630b630b,0x5aea62eb,0x630b62eb,0x62eb62eb,0x62eb62eb,0x62eb5aeb,0x632c632c,
-0x7bae7bad,0x6b2c734c,0x736d6b0b,0x8c0f7bae,0x8c30840f,0x94716b6c,0x83ef9cb2,0x7bce736c,0x83ef842f,0x83ee7bce,0x8c5083ef,0x83ef8c30,0x840f83ef,0x840f8c30,0x84108c10,0x83ef7bae,0x7bee7bce,0x7bae83ef,0x83ef738d,0x7bce83ef,0x736d7bae,0x736d736d,0x736d736d,0x6b4d736d,0x6b4c632c,0x83ef738d,0x83ef840f,0x73ad7bce,0x7bce840f,0x840f842f,0x738d7bce,0x7bad7bae,
-0x7b8d7bce,0x7bce7bcd,0x736c738d,0x7bae736c,0x738d736d,0x7bae83ce,0x7b8d83ee,0x7b8d736c,0x73ad7bce,0x8c50840f,0x7bae842f,0x738d7bce,0x630b734c,0x6b4c6b2c,0x83ef738d,0x94918c50,0x94309c91,0x734c7b8d,0x736d7b8d,0x734c6b2c,0x6b2c6b2c,0x7b8d738d,0x736d736d,0x6b4c736d,0x7b8d6b4c,0x734c736d,0x6b2c734c,0x7b6d734c,0x736d736d,0x734d736d,0x736d734c,0x83ae7b8e,
-0x734c734c,0x732c732c,0x6b2c6b2c,0x6b2c734c,0x7b8e736d,0x734d736d,0x736d736d,0x6b2c734c,0x736d6b2c,0x734d734c,0x83ef8bef,0x7b8d736d,0x7b8d7b8d,0x734d736d,0x734d7b6d,0x734d6b2c,0x7b6d7b6d,0x6b2c734c,0x732c6b0c,0x732c734c,0x6b2c6b2c,0x6b0b6b0b,0x6b0b62eb,0x6b0b6b0b,0x6b2c6b2c,0x6b2c736d,0x734c6b0b,0x736c6b0b,0x6b2c736c,0x630b630b,0x630b6b2c,0x6b4c630b,
-0x6b2c6b2c,0x6b4c6b4c,0x5aca630b,0x62eb5aaa,0x5aca62eb,0x62cb5aaa,0x6b2c62eb,0x630b6b4c,0x6b2c630b,0x630b630b,0x6b0b62eb,0x738d6b2b,0x736c738d,0x62eb630b,0x6b0c62eb,0x734d734d,0x736d6b6c,0x6b2c6b6c,0x5aea62eb,0x62eb62eb,0x6b2c630b,0x630b6b2c,0x62eb630b,0x6b4c630b,0x62eb6b2c,0x630b62eb,0x6b2c6b2c,0x6b2c630b,0x5aca5aea,0x62eb5aca,0x630b630b,0x630b62eb,
-0x630b6b2c,0x62eb5aaa,0x632b62eb,0x5aca630b,0x630b630b,0x630b630b,0x62eb630b,0x630b62eb,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x630b630b,0x5a895aca,0x6b4c5aca,0x6b2c6b4c,0x630b62eb,0x62ea62ea,0x630b630b,0x62eb62eb,0x6b0b62eb,0x6b0b630b,0x630b630b,0x6b0b630b,0x6b2c6b0b,0x630b632b,0x6b2c6b2c,0x630b6b2c,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x630b62eb,0x630b630b,
-0x7b8d7bce,0x736d6b2c,0x8c30738d,0x840f8c50,0x7bce7bce,0xa513ad34,0xbdb6736d,0x7bce9471,0x83ee7bce,0x73ad738d,0x7bce8c30,0x840f7bce,0x83ef83ef,0x83ef840f,0x83ef83cf,0x83cf7bcf,0x7bce8c30,0x840f7bce,0x7bce840f,0x83ef83ef,0x738d7bae,0x736d736d,0x736d6b4d,0x6b4c736d,0x6b4c632c,0x738e6b4d,0x7bce7bae,0x73ad7bae,0x7bce7bce,0x7bee840f,0x7bee840f,0x7b8d7bae,
-0x83ce83ce,0x83ce8c2f,0x9450840f,0x7bae83ee,0x83ef736d,0x736d7bce,0x8c2f83ce,0x738d7bae,0x840f83ef,0x83ee7bce,0x7bce7bce,0x630b6b4c,0x6b4c736d,0x6b4c6b4c,0x7bce736d,0x8c0f8c30,0x8c0f9471,0x6b2c736d,0x6b2c734c,0x734c6b0c,0x734c734d,0x7bce7bce,0x6b4c6b2c,0x6b2c734c,0x732c6b2b,0x736d736c,0x736d734c,0x736d7b8e,0x7b6d736d,0x6b0b732c,0x6b0c6b0c,0x736d6b0c,
-0x732c7b6d,0x736d732c,0x6b2c734d,0x6b0b734c,0x83ce734d,0x736d7b8d,0x736d736d,0x6b2c736d,0x736d6b2c,0x83ae7bae,0x83ef83ae,0x83ef83ef,0x7bae7b8d,0x736d7b8e,0x7b8e7b8d,0x6b2c736d,0x734d6b0c,0x732c734d,0x6b2c734c,0x734c6b0c,0x6b2c736d,0x6b2c6b2c,0x6b0b6b0c,0x6b0c6b0c,0x6b4c6b2c,0x736d6b4c,0x6b2c6b0c,0x734c734c,0x6b2c734c,0x6b0b630b,0x632b6b4c,0x630b62eb,
-0x6b0b6b2c,0x630b630b,0x5aaa62eb,0x6b4c5aca,0x528962eb,0x62eb5aaa,0x5aaa5aaa,0x6b2c630b,0x6b4c6b2c,0x6b0b630b,0x630b62ea,0x736d630b,0x734c736d,0x630b630b,0x6b2c630b,0x6b4c736d,0x6b2c6b2c,0x62eb632b,0x630b62eb,0x62eb630b,0x6b4c6b2c,0x5aaa62eb,0x6b4d630b,0x6b2c6b4c,0x62eb62eb,0x62eb5aea,0x632b6b2c,0x62eb62eb,0x62eb5aca,0x5aca5aea,0x630b62eb,0x5aca5acb,
-0x5aca62ca,0x5aca62eb,0x62eb62eb,0x630b6b4c,0x630b630b,0x630b630b,0x62eb62eb,0x630b62eb,0x62eb5aca,0x62eb62eb,0x630b630b,0x630b630b,0x5aaa62eb,0x736d62eb,0x630b6b4c,0x6b2c62eb,0x6b2c6b4c,0x630b6b2c,0x6b2c630b,0x736d6b2c,0x6b2c630b,0x62eb630b,0x6b2c630b,0x6b2c6b2c,0x6b2c632b,0x736d6b4c,0x6b4c736d,0x630b632b,0x62eb62eb,0x630c630b,0x632c630b,0x630b632c,
-0x8c5083ce,0x7bce83ef,0x7bae7bae,0x840f7bce,0x840f8c0f,0xc617d6b9,0x7bee8c50,0x840f842f,0x73ad7bad,0x738d738d,0x840f83ef,0x7bce738d,0x7bce83ef,0x83ef83ef,0x83cf7bae,0x83cf83ef,0x738d83ef,0x83ef842f,0x84307bef,0x73ae7bce,0x738d738d,0x6b4c738d,0x6b4c632c,0x6b6d738d,0x738d6b6d,0x736d736d,0x83ef738d,0x83ef83ef,0x736d736d,0x7bce7bce,0x83ee7bce,0x7bce840f,
-0x7bad734c,0x9cb19470,0x9c919cb2,0x83ef9cb2,0x734c736d,0x7b8d7b8d,0x9471736d,0x83cea4b2,0x738d6b4c,0x6b6c7bad,0x7bce7bad,0x6b2c7bad,0x736d736d,0x6b0b6b4c,0x736d630b,0x83ce83ce,0x83ce8bef,0x6b0c734d,0x7b8d6b2c,0x6b2c736d,0x734d734c,0x736d7b8d,0x6b2c6b4c,0x6b2c630b,0x6b0b734c,0x7b8d6b2c,0x736d7b8d,0x7b8d7b8e,0x734c734c,0x732c734c,0x6b0b6b0c,0x6b2c6b0c,
-0x7b8d734c,0x734c736c,0x736c736d,0x6b2c734c,0x7b6d736d,0x7bae736d,0x6b2c7b8e,0x6b2c6b2c,0x6b2c6b2c,0x83ae7b8e,0x83ae7b8d,0x8c0f83ef,0x7b8d83ce,0x7bae7b8d,0x734c7b6d,0x6b2c732c,0x6b0c6b0c,0x7b8e736d,0x6b0b734c,0x6b0b6b0c,0x6b2c6b2c,0x736d736d,0x6b0b6b2c,0x62eb6b0c,0x734c6b0c,0x6b2c6b0b,0x6b2c734c,0x736d6b2c,0x734c6b2c,0x6b2c6b4c,0x6b2c6b2c,0x6b2c6b2c,
-0x62eb6b2c,0x5aca5aaa,0x62eb630b,0x6b4c630b,0x5aca630b,0x630b62ca,0x62eb62eb,0x734c6b2c,0x736d83ce,0x6b4c6b0b,0x738d6b4c,0x736c6b2b,0x7bad7bad,0x6b4c736c,0x6b0c630b,0x630b6b4c,0x630b6b2c,0x630b630b,0x630b632b,0x6b4c630b,0x62eb630b,0x5acb62eb,0x6b4c62eb,0x5aaa6b4c,0x630b5aca,0x62eb5aea,0x62eb630b,0x5aca630b,0x5aea5aca,0x5aea5aea,0x630b630b,0x62eb62eb,
-0x5aca62eb,0x6b0b630b,0x62eb630b,0x630b6b2c,0x630b5aeb,0x630b630b,0x630b5aeb,0x5aeb630b,0x630b5aeb,0x62eb62eb,0x62eb5acb,0x630b630b,0x630b6b2c,0x632b630b,0x630b62eb,0x630b62ea,0x6b2c6b2c,0x62eb6b0b,0x6b2c630b,0x6b2c630b,0x6b2c6b0b,0x62eb630b,0x6b2c630b,0x630c630c,0x6b2c6b4c,0x6b2c6b2c,0x630b6b2c,0x630b630b,0x630b62eb,0x6b2c6b2c,0x6b2c632c,0x630b6b2c,
-0x8c508c30,0x7bae83ef,0x7b8d7bae,0x7b8d7bce,0x9cd2736d,0x83efa513,0x83ee9470,0x949183ef,0x738d83ee,0x7bee7bae,0x7bae7bce,0x83ef83ef,0x7bae83ef,0x7bcf7bae,0x736d736d,0x7bae7bae,0x738d6b4d,0x7bee83ef,0x84307bce,0x738d7bef,0x738d6b4c,0x6b6d738d,0x6b6d6b4c,0x6b6d738d,0x7bce738d,0x738d738d,0x840f738d,0x840f840f,0x736d7bae,0x840f7bae,0x7bee73ad,0x8c2f9471,
-0x83ce738d,0xad139cb1,0x9450a4f3,0x7bae83cf,0x6b2c736d,0x6b0c6b2c,0x736d734c,0x7b8d83ef,0x736d7bce,0x738d7bce,0x6b2b6b6c,0x7bce73ad,0x6b2c6b0b,0x6b2c630b,0x736d6b4c,0x840f7bce,0x7b8d7bad,0x734d7b6d,0x7b8e736d,0x736d7bae,0x734c736d,0x738d738d,0x6b2c6b4c,0x734c6b2c,0x734c736c,0x732c6b0b,0x734d7b6d,0x736d734c,0x6b0c7b6d,0x7b8d736d,0x732c6b2c,0x736d7b8d,
-0x7b8d734c,0x736d7b8d,0x734c734c,0x7b8d736d,0x732c7b6d,0x83ef7b8d,0x734c7bae,0x6b2c734c,0x6b0c734d,0x7b6d732c,0x7bae7bae,0x83ce7b8d,0x7b8d83ef,0x7b8d736d,0x732c736d,0x6b0c6b2c,0x7b6d734d,0x7bae7b8e,0x6b0c7b6d,0x6b0c6aeb,0x7b8e734c,0x7b8d83ef,0x734c734c,0x736d736d,0x6b0b6b2c,0x6b0b6b0b,0x734d6b2c,0x734c62eb,0x736d734c,0x6b2c734c,0x6b4c6b2c,0x6b4c6b4c,
-0x62eb62eb,0x5aca5aaa,0x62eb630b,0x62eb62eb,0x6b2c62eb,0x62eb6b2c,0x6b4c62eb,0x7bae738d,0x6b4c83ef,0x6b2c62eb,0x734c6b4c,0x6b4c630b,0x738c738d,0x734c736c,0x736d6b2c,0x6b4c7bae,0x6b4c6b6c,0x6b2c6b2c,0x6b4c6b4c,0x6b2c6b4c,0x5aaa5aca,0x630b62eb,0x630b630b,0x630b630b,0x632b5aca,0x62eb5aea,0x5aca62eb,0x5aca630b,0x62eb630b,0x62eb5aea,0x5aaa62eb,0x5aaa528a,
-0x5aca62eb,0x734c5aca,0x62eb630b,0x62eb62eb,0x630b5aeb,0x630b632c,0x630b630b,0x5aca630b,0x630b630b,0x5aca62eb,0x62eb5aaa,0x630b62eb,0x630b630b,0x62eb62eb,0x6b4c62ea,0x62eb6b2b,0x6b2c6b4c,0x630b6b0b,0x6b4c630b,0x6b0b6b2c,0x6b2c6b0b,0x630b630b,0x632b630b,0x630b630b,0x630b630b,0x62eb630b,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x6b2c630c,0x632c630b,0x630b632c,
-0x7bce83ce,0x83ef83ef,0x83ef83ef,0x7bae8c30,0x94717bae,0x7bae738d,0x840f736d,0x8c509cb1,0x83ee7bee,0x738d7bce,0x7bee840f,0x9cb27bcf,0x83ef8410,0x7bcf83cf,0x738e7b8e,0x7bae7bae,0x73ad7bce,0x8c5073ad,0x7bce8430,0x73ae7bce,0x738d6b6d,0x738d73ae,0x738d6b6d,0x738d738d,0x7bee73ad,0x7bad7bad,0x7bce738d,0x7bce7bad,0x8c30840f,0x7bce738d,0x840f7bce,0x9cb18c70,
-0x9c919450,0x9c719cb1,0x9cb19cb2,0x6b2c734c,0x736d7b8e,0x734c6b0b,0x734c736d,0x83ce8bef,0x7bee7b8d,0x83ee8c2f,0x6b4c6b4c,0x6b4c6b2c,0x6b2c6b2c,0x736d6b0b,0x736d7bae,0x7bce738d,0x7b8d7bad,0x7b8d7b8d,0x736d7b6d,0x7b8e736d,0x736d7bae,0x7bce7b8d,0x630b734c,0x6b2c6b4c,0x736d6b2c,0x6aeb6b2b,0x734d6b2c,0x734c734d,0x7b6d734d,0x734d736d,0x734c736d,0x7b8e732c,
-0x7b8d7b8d,0x83ae7bad,0x6b2b734c,0x7b8d7b6d,0x6b2c734c,0x7b8e736d,0x7bae7b8e,0x734d7b8e,0x732c732c,0x7b6d7b6d,0x7bad7bae,0x83ee736d,0x83ce83ee,0x734c736d,0x7b8e736d,0x6b0c734d,0x7b8e734d,0x734d7b6d,0x734d7b8d,0x734d6b2c,0x736d6b0c,0x734c7b8e,0x6b0c6b2c,0x734d734c,0x732c6b0c,0x6b2c62eb,0x6b0c6b0b,0x62eb734c,0x736d734c,0x6b2c734c,0x6b4c6b4c,0x62eb630c,
-0x62ca5aaa,0x5aca5aaa,0x62eb62eb,0x630b630b,0x73ad630b,0x6b4c83ef,0x630b62eb,0x840f736d,0x630b7bae,0x6b2c630b,0x6b2b6b0b,0x6b4b630a,0x6b4c736c,0x738d738d,0x7b8e736d,0x62eb736d,0x6b4c6b4c,0x630b6b4c,0x6b4c6b2c,0x62eb6b2c,0x5aca630b,0x5aca528a,0x630c6b2c,0x6b4c630c,0x630b630b,0x5aea62eb,0x5aca62eb,0x5aca5aea,0x528952a9,0x5aaa5289,0x5acb62eb,0x62eb5acb,
-0x5aca62ca,0x6b4c5aca,0x62eb630b,0x630b62eb,0x5aeb5aeb,0x630b630b,0x62eb5aeb,0x5aeb630b,0x5aca5aca,0x5aeb5aca,0x630b5aeb,0x5aca5aca,0x62eb62eb,0x6b2c630b,0x736c6b2b,0x6b4c6b6c,0x630b6b4c,0x62eb630b,0x6b2c62ca,0x6b2c6b2c,0x6b2c632b,0x6b2c6b2c,0x6b2c6b2c,0x6b2c630b,0x630b630b,0x630b632b,0x630b630b,0x630b630b,0x62eb62eb,0x630b630b,0x632c630b,0x62eb632c,
-0x738d7b8d,0x736d738d,0x8c50840f,0x840f9450,0x734c7bae,0x7bae7bce,0x840f9470,0x7bce7bce,0x8c7083ee,0x7bae738d,0x8c5073ad,0x8410840f,0x8c308c30,0x7bcf83ef,0x83ef83ef,0x83ef8410,0x73ad7bee,0x840f73ad,0x840f840f,0x738d738d,0x738d738d,0x738d738d,0x738d6b6d,0x7bce7bce,0x7bce736d,0x7bee7bce,0x7b8d738d,0x7bce736d,0x94719491,0x736c6b4c,0x840f738d,0xa4d29cb1,
-0xa4f29cb1,0x9cb19470,0x9c919470,0x7bae83ef,0x947183ef,0x6b2c6b0c,0x736d7b6d,0x7bce7b8d,0x7bee7bad,0x6b6c738d,0x8c507bce,0x6b4c738d,0x734c6b4c,0x734c6b0b,0x736d7bae,0x736d6b4c,0x83ce83ce,0x734c7b8d,0x734d736d,0x734d6b2c,0x736d736d,0x736d6b2c,0x6b2c7b8d,0x6b2c630b,0x6b2c6b2c,0x6b2c6b2c,0x734d6b0c,0x7b6d7bae,0x7b8d736d,0x83ae7bae,0x734c7b8d,0x734c6b2c,
-0x8bef7bae,0x7bae83ee,0x734c7b8d,0x734c734c,0x732c734d,0x6b0c732c,0x7bae734d,0x6b2c736d,0x6b2c6b2c,0x734c736d,0x83ce7b8d,0x7b8d7b8d,0x8bef83ce,0x6b2c7b8d,0x7bae7b8d,0x736d736d,0x7b6d736d,0x6b2c734c,0x734c6b2c,0x6b0c732c,0x732c6b2c,0x736d734d,0x6b4c7b8d,0x734c6b2c,0x734c6b0b,0x6aeb732c,0x736d6b0c,0x6b2c6b0c,0x734c6b0b,0x736d736d,0x6b2c736d,0x62eb62eb,
-0x62eb62eb,0x5aaa5aaa,0x630b62ca,0x62eb6b2c,0x630b5aea,0x6b2c6b4c,0x62eb62eb,0x7b8d6b0b,0x5aca738d,0x6b2b62eb,0x6b2b6b2b,0x6b4c6b2b,0x630b6b4b,0x734c734c,0x7bae734c,0x630b736d,0x6b4c6b2c,0x6b4c736d,0x632b6b2c,0x632b632b,0x5acb6b2c,0x736d630b,0x6b4c6b4d,0x630b6b4c,0x630b6b2c,0x62eb630b,0x62eb630b,0x5aca5aca,0x62eb5aea,0x5aca5aca,0x62eb5acb,0x5acb62eb,
-0x5aca5aaa,0x62ca62eb,0x5aca5aea,0x630b630b,0x5aeb630b,0x5aeb5aeb,0x5aeb5aca,0x630b630b,0x5aeb630b,0x5aeb5aaa,0x630b5aeb,0x630b630b,0x62eb6b2c,0x6b4c630b,0x630b630b,0x7bad6b2c,0x630b6b4c,0x630b6b2c,0x6b2c62eb,0x6b4c736d,0x6b2c630b,0x6b4c6b4c,0x6b2c6b4c,0x6b4c6b2c,0x6b2c632b,0x630b632b,0x62eb630b,0x630b630b,0x630b630b,0x630b630b,0x6b2c630b,0x630b6b2c,
-0x736d738d,0x6b4c6b2c,0x94918c70,0x94919cb2,0x736c83ce,0x840f734c,0x7bada4f2,0x736d7b8d,0x7bae7bae,0x840f83ef,0x7bae7bae,0x8c3083ef,0x94517bae,0x83ce8c30,0x7bae7bae,0x7bce7bae,0x840f840f,0x840f8c50,0x94717bce,0x738d840f,0x8c517bae,0x73ae736d,0x6b4c738d,0x73ae7bce,0x83ee736d,0x840f9471,0x83ce83ee,0x7b8d7bad,0x83ee83ee,0x7bad734c,0x949183ee,0x9cb1a4f2,
-0xa4d2a4f2,0x9cd2a4f2,0x8c308c30,0x83ef8c0f,0x7b8d736d,0x7bce7b8e,0x736c7b8d,0x94307b8d,0x7bae83ce,0x736d734d,0x7bce734c,0x734c7bae,0x734c6b2c,0x6b0c6b2c,0x7b8d734c,0x7bae7bae,0x7bae736d,0x734c7bae,0x734c734c,0x6b2c7b8d,0x736d6b2c,0x6b2c734c,0x6b4c736d,0x6b2c630b,0x6b2c6b2c,0x6b0b6b2c,0x734c6b2b,0x7bae7b8d,0x7b8d7b6d,0x7b8d7b6d,0x7b6c7b8d,0x7b8d7b8d,
-0x7b8d7b8d,0x736d7bae,0x7b6d7b8d,0x732c732c,0x734c734c,0x734d734d,0x736d734d,0x734d736d,0x736d734d,0x736d736d,0x736d736c,0x7b8d7bad,0x736d734d,0x736d734c,0x7bce738d,0x736c83ee,0x734c7b8d,0x6b2b734c,0x6b0b6b0b,0x734c6b0c,0x7b6d6b2c,0x6b0b732c,0x7bad7bae,0x734c734c,0x736c734c,0x6b2b6b4c,0x734c732c,0x6b2c6b2c,0x6b2b6b0b,0x7bae734d,0x5aaa734c,0x5aca5aca,
-0x62eb6b4c,0x5aaa5aaa,0x5aca5aca,0x5aca5aca,0x5aca5aca,0x5aca62eb,0x6b0b62eb,0x62eb62eb,0x6b2c6b2c,0x630b62eb,0x6b4c6b4c,0x7b8d62ea,0x736c6b4c,0x736c6b2b,0x840f6b4c,0x6b2c6b2c,0x6b2c6b4c,0x736c6b4c,0x6b0b6b4c,0x6b2c6b0c,0x630b6b4c,0x6b2c734d,0x630b630b,0x62eb6b0c,0x62eb5aea,0x630b630b,0x62eb62eb,0x5aca630b,0x62eb62eb,0x62eb62eb,0x5aca62eb,0x62eb5aca,
-0x5aca5aea,0x62eb5aea,0x62eb630b,0x6b4c630b,0x630b630b,0x630b62eb,0x62eb62eb,0x6b2c6b4c,0x5aeb630b,0x632c5aeb,0x5aeb632c,0x630b5aca,0x630b6b4c,0x630b62eb,0x6b4c6b2c,0x6b2c6b2c,0x6b2c62eb,0x630b630b,0x6b4c6b4c,0x6b6c6b4c,0x6b4c6b4c,0x6b2c6b4c,0x6b2c630b,0x630b6b2c,0x6b0b6b0b,0x630b630b,0x630b630b,0x62eb630b,0x62eb630b,0x632c630b,0x6b4c6b4c,0x630b632c,
-0x7bae7bef,0x7bae7bae,0x94717bce,0xa513bd95,0x7bce83ee,0x7bad738d,0x738d7bae,0x7bae83ee,0x7bce7bce,0xa4f37bae,0x7bae8c10,0x83ef7bae,0x7bae7b8e,0x8c309450,0x736d736d,0x738d7bae,0x83ef736d,0x7bcf8410,0x8c507bce,0x8c518410,0x840f83ef,0x738d840f,0x73ae6b6d,0x738d7bae,0x7bae7bce,0x8c508c50,0x83ee840f,0x7bad8bef,0x83ce736c,0x736c7bad,0x9cd28c4f,0x9491842f,
-0x94b19491,0x9cd29cd2,0x83ef8c30,0x94918c30,0x7b8d9cb2,0x83ce83ee,0x6b2b734c,0x94708bef,0x6b2c736d,0x736d736d,0x6b2c734c,0x736d734d,0x6b2c736d,0x62eb6b2c,0x736d7b8d,0x7bce83ce,0x738d734c,0x7bae7b8d,0x736d7bae,0x736d734d,0x734c732c,0x734c736d,0x6b2c6b0b,0x630b6b2c,0x62eb62ca,0x6b2c6b0c,0x7b8d736c,0x7b6d7b8d,0x83ee7bad,0x736c7b6d,0x7bad83ae,0x7bad7b8d,
-0x7b8d736d,0x83ce7b6d,0x7b8e8c10,0x6b2c736d,0x734d6b2c,0x6b2c6b2c,0x736d736d,0x83ce736d,0x736d7b8e,0x734c732c,0x6b0b732c,0x736d734c,0x7b8d736d,0x738d7b8d,0x736d738d,0x7bad6b6c,0x7b6c7bad,0x6b2b732c,0x6b0b732c,0x734d6b0c,0x732c7b6d,0x736d736c,0x734c734c,0x732b7b8d,0x736c734c,0x6b2b734c,0x734c6b2c,0x734c732c,0x6b2c6b0b,0x62eb6b2c,0x62ca5aaa,0x630b630b,
-0x632c5aaa,0x630b632c,0x62eb52a9,0x5aaa5aea,0x5aca5aaa,0x62eb630b,0x6b0b630b,0x62ca62ca,0x630b62ea,0x62ea6b2b,0x62ea62ea,0x62ea6b2b,0x6b4c62eb,0x734c6b2c,0x9450736d,0x6b2c736d,0x6b2c6b4c,0x736d6b4c,0x630b6b4c,0x734d6b2c,0x6b2c62eb,0x5aca6b2c,0x62cb62eb,0x630b5aaa,0x5aca630b,0x5aea5aca,0x630b62eb,0x5aca62eb,0x630b630c,0x5aca62eb,0x62eb5aea,0x630b62eb,
-0x5aea5aca,0x630b62eb,0x62eb630b,0x632b62eb,0x62eb630b,0x6b2c630b,0x630b630b,0x630b6b4c,0x5aca630b,0x630b5aca,0x632c632c,0x632c632c,0x632c6b6d,0x62eb62eb,0x630b630b,0x6b2c6b0b,0x630b6b0b,0x6b2c6b2c,0x6b2c6b2c,0x630b6b4c,0x632b630b,0x6b2c6b2c,0x6b4c6b2c,0x630b6b2c,0x630b62ea,0x630b6b2b,0x6b4c630b,0x630b6b2c,0x5aeb632c,0x632c5aeb,0x632c6b4c,0x630b630b,
-0x7bce7bcf,0x83ef83ef,0x8c0f7bce,0xad34ad13,0x83ce83ee,0x83ee7bad,0x7bce7b8d,0x83ef736d,0x8c308c10,0x7bae7bce,0x94719450,0x7bae7b8d,0x840f840f,0xad548c50,0x83ef83ef,0x7b8d7b8d,0x73ae738d,0x7bef7bce,0x7bce83ef,0x8410738e,0x73ae840f,0x7bef7bce,0x7bce7bce,0x840f840f,0x73ad83ef,0x840f7bce,0x83ee8c0f,0x83ae83ce,0x6b2b7b8d,0x7bad7bad,0x94707bce,0x8c508c30,
-0x8c508c50,0x94709470,0x7bce8c0f,0x94918c0f,0x9471ad54,0x83ee83ef,0x83ce7b8d,0x83ee8c2f,0x6b0b734c,0x734d6b2c,0x62eb734d,0x6b2c6b0b,0x6b0c734c,0x734c736d,0x6b0b7bae,0x7bce736d,0x6b2c6b4c,0x83ef736d,0x6b2c736d,0x736d736d,0x6b2c736d,0x736d734c,0x6b0b6b2c,0x630b6b0b,0x62eb62eb,0x6b0b6b0b,0x734c6b2c,0x734c734c,0x83ce7b8d,0x734c7b6d,0x83ae83ae,0x7b8d7b8d,
-0x736d7b6d,0x83ef7b6d,0x83ae9430,0x7bae83ae,0x734d7b8e,0x7b8d734d,0x7b6d7b8d,0x7b8e7b8d,0x7b8e7bae,0x734c734d,0x734c734c,0x6b0b734c,0x736d736d,0x7b8e7b8d,0x7bae7bce,0x7bad736c,0x7bad7bad,0x734c734c,0x6b2b736c,0x734c732c,0x736d7b6d,0x736c736c,0x6b2b734c,0x736c7b6c,0x7b8d734c,0x6b4c736c,0x734c6b4c,0x736c734c,0x6b2b736d,0x62eb62eb,0x630b62eb,0x5aca62eb,
-0x5aca5aaa,0x62eb5aca,0x62eb5aca,0x5aca5aca,0x5aca5aaa,0x62eb62eb,0x6b4c630b,0x630b630b,0x6b0b62eb,0x6b2c6b2b,0x734c6b4c,0x736c7bae,0x734c6b2b,0x734c734c,0x9450738d,0x6b2c736d,0x6b2b6b2c,0x6b4c6b2c,0x630b6b2c,0x6b4c6b2c,0x734d6b2c,0x62eb630b,0x5aca5aca,0x630b62eb,0x62eb630b,0x6b4c630b,0x630b6b2c,0x630b630b,0x630b630c,0x5aca5aea,0x630b5aea,0x630b630b,
-0x62eb630b,0x5aaa5aca,0x5aca5aca,0x630b62eb,0x630b62eb,0x6b4c6b2c,0x630b630c,0x5aaa630b,0x630c6b2c,0x62eb62eb,0x630b630b,0x630b630b,0x630b630b,0x736d6b2c,0x6b4c736d,0x62eb630b,0x6b2c630b,0x738d736d,0x736d736d,0x630b6b4c,0x630b630b,0x632b630b,0x6b2c632b,0x6b2c6b4c,0x630b62ea,0x630b6b2c,0x6b2c630b,0x630b632c,0x62eb632c,0x630b5aeb,0x632c632c,0x632b632b,
-0x7bae7bae,0x842f842f,0x8c0f840f,0x9cb183ef,0x736d9470,0x94919cb1,0x9cb29471,0x7b8d7bce,0x8c50840f,0x83ef83ef,0x8c308c30,0x83ce8c30,0x8c30840f,0x9cb29471,0x83ce7bce,0x7bce83ef,0x7bae83ef,0x8c71840f,0x840f8c50,0x7bcf7bce,0x73ae7bcf,0x7bef738d,0x73ae73ae,0x8c71840f,0x8c2f840f,0x83ce8c2f,0x94508c0f,0x7bad8c0f,0x736c736c,0x734c734c,0x840f7bad,0x8c508c50,
-0x83ee83ef,0x8c2f840f,0x840f8c50,0xa4f39450,0x9491a4d2,0x7bae8c2f,0x8c0f7b8d,0x6b0b732c,0x6b0b6b2c,0x6b2c62eb,0x734c6b2c,0x62eb6b0b,0x6b2c6b2c,0x6b2c6b2c,0x734c734d,0x6b2c6b2c,0x6b2c6b2c,0x738d734c,0x6b0b6b0b,0x6b2c734c,0x732c736d,0x734c6b2c,0x6b2c734d,0x6b2c630b,0x62eb6b0b,0x62ca62cb,0x734c630b,0x7b8d736d,0x7b6d7b6d,0x7b8d7b6d,0x83ad7b8d,0x7b6d83ad,
-0x734c736d,0x7b8d7b8e,0x7b8e83ae,0x8bef7b8e,0x736d83cf,0x7bae7b6d,0x83ce83ae,0x734c83ae,0x83ce7b6d,0x7b8d83ae,0x7b8d7b8d,0x6b2c7b6d,0x6b2c734d,0x736d736d,0x7bce738d,0x738d7bce,0x7b8d736c,0x7b6d736c,0x7b8d736d,0x83ae83ae,0x83ae736d,0x734c734c,0x6b0b736c,0x736c6b2b,0x7bad734c,0x736c7b8d,0x736c736c,0x736c734c,0x62ea6b2b,0x62eb62eb,0x5aaa62ca,0x630b5aaa,
-0x52a95aca,0x630b62eb,0x5aaa6b4c,0x630b5aca,0x5aaa5aaa,0x5aca5aca,0x6b4c630b,0x62eb630b,0x6b0b62ca,0x6b0b62ea,0x6b2b6b0b,0x734c6b2b,0x738d7bad,0x6b2b736c,0x83ef738d,0x6b2c6b2c,0x6b2b6b2c,0x630b6b2b,0x6b0b62eb,0x630b6b2c,0x6b2c6b2c,0x6b4c62eb,0x6b0b6b0b,0x62eb6b0b,0x5aca5289,0x6b4c6b2c,0x62eb6b2c,0x62eb62eb,0x62eb62eb,0x5aca5aca,0x630b630b,0x630b630b,
-0x62eb62eb,0x5aca5aca,0x62eb5aea,0x5aca5aca,0x62eb5aea,0x630c630b,0x630b630b,0x62eb630b,0x6b2c630b,0x62eb630c,0x630b5aeb,0x630b630b,0x62eb62eb,0x6b2c630b,0x6b2c6b4c,0x62eb630b,0x734c630b,0x734c736d,0x736d738d,0x6b4c6b2c,0x632b6b2c,0x630b632b,0x6b2c630b,0x6b2c6b2c,0x630b630b,0x62eb630b,0x62eb62eb,0x630b630b,0x632c630b,0x5aeb630b,0x632c5aeb,0x630b632c,
-0x738d7bce,0x840f840f,0x840f83ce,0x7bae7bad,0x8c508c2f,0x94919491,0x8c0fce58,0x83cf7bae,0x8c3083ef,0x8c508c50,0x7bae83ef,0x8c508c30,0x7bce83ef,0x94719c91,0x9450840f,0x7bae83ef,0x7bef7bae,0x84308c50,0x840f840f,0x7bae83ef,0x83ef7bcf,0x7bae83ef,0x7bce7bae,0x7bce7bae,0x7bce83ef,0x83ee83ef,0x83ee7bad,0x736c83ce,0x8bef736c,0x736c7bad,0x8c50840e,0x8c709470,
-0x8c50840f,0x8c509471,0x840f8c50,0xad139471,0x9cb1ad13,0x8c0f9470,0x736c83ce,0x6b0b7b8d,0x6b0b6b0b,0x6b2c62eb,0x6b4c6b2c,0x630b6b2c,0x6b2c62ca,0x62eb6b0b,0x6b4c62eb,0x630b6b2c,0x7bae6b2c,0x6b2c6b4c,0x6b2c6b2c,0x6b2c6aeb,0x734c6b2c,0x6b2c734c,0x736d6b2c,0x6b4c736d,0x6b0c6b2c,0x62eb6b0b,0x734c6b0b,0x7bad7b8d,0x734c7b8d,0x7bad736c,0x83ae7bae,0x7b6d83ae,
-0x7b8d736d,0x736d83ae,0x7b6d7b6d,0x83ae7b8d,0x83cf83ce,0x7b6d7bae,0x83ae7b8e,0x734c7b8d,0x83ce7b6d,0x83ce83cf,0x736c7bae,0x83ae7b8d,0x7b8e7b6d,0x736d7b8d,0x7b8d734c,0x7bad83ee,0x6b2b6b2b,0x7b8d736c,0x7b8d732c,0x83ef83ce,0x7bae7b8d,0x7b8d736d,0x6b2b6b2b,0x6b0b6b2b,0x736c6b2b,0x736c736c,0x738d7b8d,0x736d736c,0x6b0b6b0b,0x6b0b734c,0x5aca62eb,0x5aca5a89,
-0x5a895aaa,0x62eb5aca,0x6b4c738d,0x5aaa630b,0x5aaa5aca,0x5a895aca,0x6b4c62ca,0x736d6b4c,0x62eb5aaa,0x630b62eb,0x736d6b2b,0x83ce736d,0x7b8d83ce,0x6b4c7b8d,0x7bae7bae,0x734c6b2c,0x6b2b6b2c,0x630b6b0b,0x630b630b,0x6b2c6b2c,0x630b6b2c,0x6b0b5aaa,0x630b6b0b,0x630b630b,0x62eb5aca,0x6b2c630b,0x630b6b2c,0x62eb62eb,0x62eb62eb,0x62eb5aca,0x62eb630b,0x630b62eb,
-0x630b630b,0x5aca62eb,0x62eb62eb,0x5aca5aea,0x62eb630b,0x62eb630b,0x62eb5acb,0x6b2c630c,0x6b2c62eb,0x630b6b2c,0x630b62eb,0x630c630c,0x630b6b2c,0x62eb62eb,0x6b0b630b,0x630b630b,0x6b4c630b,0x62eb6b2c,0x6b2c6b2c,0x6b2c630b,0x6b2c6b4c,0x6b2c6b2c,0x632b630b,0x630b632b,0x630b630b,0x62eb62eb,0x62eb62eb,0x632c630b,0x6b4c630b,0x630b6b4c,0x630b5aeb,0x630b630b,
-0x7bee8c70,0x83ef7bce,0x7bad7bae,0x736d7bae,0x840f736d,0x9cb2ad34,0x83efad34,0x7bce83ef,0x8c3083ef,0x8c309491,0x7bce83ef,0x840f7bce,0xa5138c50,0x94509c91,0x8c508c30,0x73ad8c30,0x840f7bce,0x83ef8430,0x83ef7bef,0x8410840f,0x7bce83ef,0x94717bcf,0x8c50ad54,0x738d83ef,0x7bad7bee,0x7bce7bae,0x7b8d7b8d,0x736c736c,0x736c7b8d,0x7b8d7bad,0x83ee7bad,0x83ef842f,
-0x840f7bce,0x840f8c2f,0x840f840f,0xad349491,0x9450ad13,0x840f9470,0x736c736c,0x736c734c,0x6b2c6b2c,0x630b6b0b,0x6b2c6b4c,0x6b2c6b2c,0x630b5aca,0x6b2c6b2c,0x630b6b0b,0x736d6b0b,0x73ad6b4c,0x6b4c734c,0x6b2c736d,0x6b0c6aeb,0x6b2c6b0c,0x7b8d7b8d,0x734c6b2c,0x6b2c736d,0x734c734c,0x6b0c6b2c,0x734c6b2b,0x738d736d,0x7b6d7b8d,0x736c734c,0x83ce83ae,0x7b8d7b6d,
-0x83ce7b6d,0x736d7b8e,0x736d7b6d,0x7b8d7bae,0x8bef83ae,0x83ce8c10,0x736d736d,0x736d7b8d,0x83ce7b8d,0x7bad83ae,0x7bad7bad,0x7b8d7bad,0x83ef7b8d,0x7bae7bae,0x83ce83ee,0x840f83ee,0x83ee83ee,0x94709470,0x7b8d7bad,0x7b8d736c,0x7b8d7b8d,0x7b8d7b8d,0x736c6b2b,0x62ea732b,0x6b2b6b0b,0x734c6b2b,0x7b8d7b8d,0x738d736d,0x736d7b8d,0x6b2c734c,0x630b6b2c,0x52895aaa,
-0x6b2c5aca,0x5aca630b,0x6b2c62ca,0x5aaa62eb,0x5aca5aca,0x5a895aca,0x6b0b5aaa,0x7b8d6b4c,0x62eb736d,0x62eb630b,0x736c6b2c,0x7bce7bad,0x738d7b8d,0x736c7b8d,0x7bad8c0f,0x734c734c,0x62eb6b2b,0x6b2c630b,0x62eb630b,0x734c630b,0x630b736d,0x6b2c62eb,0x62eb62eb,0x6b2c6b2c,0x6b2b630b,0x6b2c6b2c,0x6b4c6b4c,0x630b6b2c,0x62eb630b,0x62eb5aca,0x5aca62eb,0x6b0b62ca,
-0x6b2c6b4c,0x5aca62eb,0x5aea5aca,0x630b62eb,0x62eb62eb,0x62eb630b,0x62eb62eb,0x630b62eb,0x6b2c6b2c,0x6b2c6b2c,0x630c6b2c,0x62eb630b,0x6b2c6b4c,0x630b630b,0x6b2c6b2c,0x630b6b2c,0x630b6b0b,0x6b0b6b2c,0x6b2c630b,0x6b2c6b4c,0x6b2c6b4c,0x630b630b,0x630b62eb,0x630b630b,0x632b630b,0x630b630b,0x632b630b,0x632c632c,0x632c630b,0x6b4c6b4c,0x5aeb630b,0x630b62eb,
-0x94919cb1,0x7bce840f,0x738d83ef,0x7bad7b8d,0x736d738d,0xad349cb2,0x7bce9451,0x840f8c30,0x8c2f83ef,0xa5338c50,0x83ef8c50,0x7bce840f,0xad54842f,0x840fbdd6,0x9cb29471,0x83ef83ef,0x7bef840f,0x84307bce,0x7bef83ef,0x8c51840f,0x7bae83ef,0xb5757bae,0x9451c5f7,0x840f8c30,0x83ee738d,0x738d7bce,0x83ce736c,0x732c7b6d,0x734c7b8d,0x738d7b8d,0x7bad7bad,0x7bee73ad,
-0x7bce83ef,0x7bad7b8d,0x83ce7bce,0x8c50840f,0x94719470,0x83ce83ee,0x7bad738d,0x736c736c,0x6b4c736d,0x630b6b2c,0x6b2c6b4c,0x630b630b,0x62eb630b,0x6b4c630b,0x6b2c738d,0x6b2c630b,0x6b2c6b4c,0x738d6b4c,0x6b2c736d,0x6b2c732c,0x6b2c732c,0x736d734d,0x6b0c734c,0x6b0b6b0b,0x6b2c6b2c,0x6b0b6b0b,0x734c6b0b,0x736d736d,0x736d738d,0x736c736d,0x83ce7bad,0x7bae7b8d,
-0x7b8e7b8d,0x734d736d,0x736d7b6d,0x7b8e7bae,0x7b8e7b8e,0x8c308c10,0x736d7b8d,0x7b8d7bae,0x83ee7b8d,0x736c7bad,0x83ee83ae,0x734c83ae,0x7b8d734c,0x83ae7b8e,0x83ef8c0f,0x83ce83ce,0xad139c91,0xacf3ad33,0x83ce8c2f,0x7b6d736d,0x7bae734c,0x734c83ce,0x7b8d736c,0x6b2b732c,0x630b6b0b,0x736c630b,0x7b8d7bad,0x736c734c,0x6b2c736c,0x62eb62eb,0x5aaa62eb,0x6b2c5aea,
-0x7b8d7bae,0x5aaa62cb,0x6b0c62ca,0x5aaa5aca,0x5aaa5289,0x5aca62eb,0x5aca5aaa,0x5aaa5289,0x630b736d,0x62eb62eb,0x736d6b2c,0x7bae7bae,0x6b4c734c,0x736d734c,0x736d9450,0x6b2c732c,0x62eb6b2b,0x6b4c630b,0x630b6b2c,0x736d6b2c,0x630b736d,0x736d736d,0x630b630b,0x62eb6b2c,0x630b62eb,0x6b0b630b,0x6b0b6b2c,0x62eb62eb,0x62eb630b,0x62eb62ca,0x5aca62ea,0x630b62ca,
-0x630b630b,0x62eb630b,0x5aea62eb,0x5aca5aca,0x5aaa5aaa,0x630b62eb,0x6b2c632b,0x6b4c630b,0x6b2c6b4c,0x6b2c6b0b,0x6b2c6b2c,0x630b630c,0x630b6b2c,0x62eb62eb,0x6b2c630b,0x6b2c6b2c,0x6b2c6b2c,0x6b4c6b4c,0x6b4c6b2c,0x6b2c6b4c,0x630b6b4c,0x62eb630b,0x630b62eb,0x6b2c632b,0x6b2c6b2c,0x630b6b2c,0x632b630b,0x630b630b,0x62eb5aeb,0x6b2c630b,0x630b6b2c,0x630b630b,
-0x94918c50,0x7bae9491,0x7bad7bce,0x736d736d,0x7bad7bad,0x8c30738d,0x840f9cd2,0x8c30840f,0x83ee83ef,0x8c2f8c2f,0x8c709cd2,0x840f8c2f,0x8c507bce,0x7bad83ef,0x8c30840f,0x83ef7bce,0x7bef8c30,0x94b2840f,0x7bcf7bef,0x83ef840f,0x83ef7bcf,0xb5559451,0x83ef9471,0x8c507bae,0x7bad840f,0x83ee7bae,0x83ce7bad,0x736c7bad,0x7b8d734c,0x736c83ce,0x7bad738d,0x738d7bce,
-0x738d83ee,0x738d6b4c,0x7bce7bad,0x83ef7bce,0x83ef7bce,0x7b8d840f,0x7bae7bae,0x736d736c,0x736d6b2c,0x6b0b6b2c,0x6b2c630b,0x630b62eb,0x6b0b62eb,0x630b630b,0x734c6b2c,0x630b6b2c,0x630b6b2c,0x6b4c6b0b,0x6b2c7b8d,0x734d732c,0x734d734c,0x62ca6b0b,0x6b2c6b0c,0x6b4c630b,0x6b2c6b2c,0x6b0b6b2c,0x6b2c6b2b,0x6b4c734c,0x734c734c,0x7bad7bae,0x83ae736d,0x83ce83ee,
-0x7b8d83ae,0x7b8e83ae,0x7b8d7bae,0x83ef7b8d,0x7bae83ce,0x8bef83ce,0x736d83ce,0x734c734c,0x83ce7b8d,0x7b6d7b8d,0x7bad7bad,0x7bad7bad,0x734c7b6d,0x7bae7bae,0x83ce7b8d,0x738d7bad,0x9cb17b8d,0x8c0f9c71,0x7b8d7b8d,0x7b8d7b6d,0x83ae734c,0x734c8c2f,0x7b8d7b8d,0x6b2b734c,0x6b2b6b2b,0x738c6b2b,0x736d7bce,0x6b2b6b0b,0x6b0b6b2c,0x5aca5aaa,0x5aca630b,0x6b2c62eb,
-0x62eb6b0b,0x5aaa5aaa,0x734c6b2c,0x6b0b6b2c,0x5aaa5aaa,0x52895aca,0x5aca5aaa,0x52895289,0x7bae5aca,0x6b2c736d,0x736d6b2c,0x6b4c6b4c,0x734c7b8d,0x7bae734c,0x736da4d2,0x7b8d736c,0x6b2b6b4c,0x6b2c6b2c,0x734c6b4c,0x6b4c736d,0x6b4c734c,0x62eb734c,0x6b2c6b2c,0x6b4c6b2c,0x6b2b6b4c,0x6b2b630b,0x6b2c6b4c,0x6b0b630b,0x62eb62eb,0x62eb62eb,0x62eb630b,0x630b62ea,
-0x630b630b,0x62eb630b,0x5aca62eb,0x5aea5aca,0x5aea62eb,0x630b62eb,0x6b2c630b,0x738d6b2c,0x6b2c736d,0x6b2c6b0b,0x630b630c,0x6b2c630b,0x630b6b2c,0x62eb62eb,0x6b4c6b2c,0x6b2c6b4c,0x736d6b4c,0x630b6b2c,0x6b2c6b2c,0x6b2c630b,0x630b6b2c,0x632b630b,0x6b2c630b,0x6b2c6b2c,0x6b2c6b4c,0x630b630b,0x62eb630b,0x62eb5aeb,0x62eb630b,0x62eb62eb,0x6b2c630b,0x62eb630b,
-0x840f8c30,0x94709471,0x738d738d,0x7b8d7bad,0x7b8d7bad,0x7bae7bae,0xa4f38c50,0x840f840f,0x83ef9471,0x94917bce,0x94918c50,0x94918c50,0x7bce83ef,0x840f840f,0x83ef8c30,0x83ef840f,0x8c507bce,0x840f7bef,0x7bcf7bef,0x7bcf7bae,0x8c507bce,0x7bae8c30,0x83ef7b8e,0x7b8d83ef,0x840f840f,0x83ee73ad,0x83ce8c0f,0x736c736c,0x7b8d736c,0x7bad83ee,0x7bad736c,0x6b4c7b8d,
-0x840e738d,0x7bce840f,0x94507bad,0x7bae9450,0x7bce83ef,0x7b8d83ce,0x736d7b8d,0x7b8d7b8d,0x630b6b4c,0x6b4c6b2c,0x630b630b,0x62eb62eb,0x62eb630b,0x630b62eb,0x6b4c630b,0x6b2c734c,0x632b632b,0x62eb6b2c,0x6b2c6b0b,0x734c736d,0x6b0c734c,0x62eb62eb,0x62eb6b2c,0x736d630b,0x736d6b4c,0x6b2c736d,0x6b4c6b2c,0x6b2c6b2c,0x7b8d734c,0x7bad7b8d,0x7bae7bae,0x8c1083ef,
-0x83ce83cf,0x83ce7b8e,0x83ae83ae,0x8c0f7bae,0x734c7bae,0x736d7b6d,0x7b8d83ae,0x7b6d732c,0x7b8d7bae,0x7b8d7b6d,0x7bad7bad,0x7b8d7b8d,0x736d7b8d,0x7b8d7b8d,0x7b8d7b8d,0x7b8d736c,0x7b6d7b8d,0x83ae83ae,0x7bad7b8d,0x7b8d7bad,0x734c736c,0x736c83ce,0x6b0b7bad,0x736c734c,0x6b2b6b4c,0x6b4c6b4c,0x736d736c,0x6b2c6b2b,0x62ca6b0b,0x5aaa5aca,0x62ca62eb,0x5aca62eb,
-0x62eb62eb,0x62ca62cb,0x6b0c6b2c,0x6b2c6b2c,0x62eb62eb,0x5a8a5aaa,0x5acb5aca,0x5aca62eb,0x6b4c5aca,0x630b736d,0x6b2c5aea,0x630b736d,0x6b4c6b2c,0x83ef6b2c,0x62ea736d,0x62ca62eb,0x630b6b4c,0x6b4c630b,0x738d734c,0x630b736d,0x630b630b,0x630b630b,0x62eb5aca,0x630b6b2c,0x6b2c6b2b,0x6b4c6b4c,0x630b6b2b,0x630b6b0b,0x6b2c6b2c,0x6b2c6b2c,0x6b2b6b2b,0x6b0b6b2b,
-0x630b630b,0x62eb62eb,0x630b62eb,0x62eb630b,0x62ca62eb,0x630b630b,0x6b0b630b,0x736d6b2c,0x7bae7bae,0x6b2c6b2c,0x630b6b2c,0x630b6b2c,0x62eb630c,0x630b62eb,0x6b2c630b,0x6b0b6b2c,0x6b4c6b6c,0x6b4c6b4c,0x630b6b2c,0x6b2c630b,0x62eb62eb,0x6b4c6b2c,0x62eb6b2c,0x6b2c6b2c,0x6b2c630b,0x62eb630b,0x5acb62eb,0x5acb5aca,0x62eb62eb,0x630b630b,0x630b630b,0x630b630b,
-0x83ef840f,0x94507bae,0x738d83ef,0x7bae7bad,0x7bad736c,0x7bce83ce,0x94917bce,0x840f9cd2,0x8c50840f,0x9cd283ee,0x83ef8c50,0x8c508c50,0x83ee8c50,0x8c5083ee,0x8c30842f,0x7bce840f,0x840f83ef,0x7bef8430,0x7bce7bef,0x738e7bcf,0x8c308410,0x8c309cd2,0x7bae738d,0x840f7bce,0x8c50840f,0x83ee83ef,0x8c0f83ee,0x83ce8c0f,0x7b8d83ce,0x83ce7bce,0x6b4c7b8d,0x7bad734c,
-0x83ee7bad,0x83ef83ef,0x83ce83ee,0x7bae7bae,0x7bce83ef,0x83ce83ee,0x7bad83ce,0x736c7b8d,0x6b2c7b8d,0x6b2c6b2c,0x6b2c6b2c,0x62eb62eb,0x6b2c62eb,0x6b2c6b2c,0x738d736d,0x736d736d,0x6b4c6b2c,0x6b2c736d,0x6b0c6b0b,0x736d736d,0x6b2c6b0c,0x62eb6b0c,0x62eb6b0b,0x6b2c630b,0x6b4c6b4c,0x6b0b6b2c,0x736d6b4c,0x734c734c,0x738d736d,0x7b8d736d,0x7b8d7b8d,0x83ce83ce,
-0x7b6d83ae,0x7b8e83ae,0x83ae8c0f,0x7b8d83ce,0x7b8d7b8d,0x83ef734d,0x7b8d83ae,0x6b2c7b8e,0x7b8d7b8d,0x7bad7b8d,0x83ee83ce,0x7bad83ce,0x7b8d7b8d,0x736d7bae,0x734c734c,0x7b8d736c,0x7b8d7b8d,0x83ce83ce,0x734c7b8d,0x7b8d734c,0x6b0b734c,0x83ce83ee,0x732c736c,0x736c7b6d,0x736c736c,0x6b2b6b2b,0x738d6b2b,0x62ea6b0b,0x62eb630b,0x62ca5aaa,0x5aca5289,0x62ca5aca,
-0x62ca5aaa,0x5aaa5aaa,0x62ca62ca,0x630b62eb,0x6b2c630b,0x5aca62cb,0x5acb5acb,0x5aca62eb,0x5acb62eb,0x736d62eb,0x5aca630b,0x734c630b,0x6b2b6b4c,0x734c736c,0x5a8962ca,0x62ca62ca,0x630b62eb,0x630b6b2c,0x6b0b630b,0x62eb62cb,0x5aaa5aca,0x630b5aaa,0x6b0b630b,0x5aca630b,0x630b630b,0x62eb6b2b,0x6b2c62ea,0x7b8d736d,0x6b2c736d,0x6b4c6b2b,0x736c734c,0x630b6b4c,
-0x62eb630b,0x62eb62eb,0x630b62eb,0x630b630b,0x62eb630b,0x6b2c6b0b,0x6b2c6b2c,0x6b4c6b2c,0x736d6b2c,0x62eb6b0b,0x62eb62eb,0x62eb630c,0x62eb6b2c,0x630b62eb,0x6b2c6b2c,0x632b6b2c,0x6b2c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x630b6b2c,0x630b632b,0x630b630b,0x6b2c632b,0x6b2c736d,0x6b2c6b2c,0x630b632b,0x630b6b2c,0x5aca62eb,0x62eb5acb,0x632b630b,0x6b2c6b2c,0x6b2c6b2c,
-0x7bae8c2f,0x83ee83ef,0x8c309491,0x7bae7bad,0x83ef8c2f,0x83ef83ee,0x7b8d7bce,0x9cb28c50,0x840f9471,0x8c309491,0x840f8c2f,0x8c50840f,0x8c708c50,0x83ef7bce,0x840f8c71,0x949173ae,0x7bce9cd2,0x9cd29471,0x7bce7bae,0x7bae83ef,0x94718c50,0x94718c50,0x7bae8c30,0x7bad7b8d,0x73ad738d,0x8c707bce,0x94709470,0x8c2f9470,0x7b8d83ee,0x83ce7b8d,0x7bad83ce,0x738d736d,
-0x7bad7bad,0x83ee7bcd,0x7bae8c2f,0x7b8d736d,0x7bae7bce,0x7bce7bce,0x7bae83ce,0x738d7bae,0x6b2c7b8d,0x6b2c6b2c,0x6b4c6b4c,0x630b6b2c,0x630b62eb,0x6b2c6b0b,0x6b4c6b4c,0x6b4c734c,0x6b4c6b4c,0x6b2c6b4c,0x6b0b6b2c,0x736d732c,0x6aeb732c,0x62eb62eb,0x62eb6b0c,0x630b630b,0x6b2c630b,0x6b2c6b2c,0x6b4c6b4c,0x738d736c,0x738d738d,0x736d734c,0x7b8d7b8d,0x7b8d7bae,
-0x83ef7bae,0x8c0f83ce,0x8c307b8d,0x7b8d83ce,0x83ef7b8e,0x94507b8d,0x7bae9450,0x7b8d83ce,0x7bad736d,0x83ce83ce,0x83ee83ce,0x7b8d83ce,0x7bae83ce,0x734c7b6d,0x734c734c,0x734c736c,0x7bad7bad,0x7b8d7bad,0x7b8d7b8d,0x736c734c,0x734c734c,0x94508c0f,0x734c734c,0x736c734c,0x738d736c,0x6b2b734c,0x734c630b,0x62ea630b,0x62ea62ca,0x62eb6b0b,0x5aaa5aca,0x5aca5aca,
-0x62ca5aca,0x5aaa5aaa,0x62eb5aca,0x630b62eb,0x630b62eb,0x5aca5aca,0x5aca5aca,0x62cb5aca,0x62eb5aaa,0x7bae630b,0x734c736d,0x6b2c6b2c,0x5aaa630b,0x734c6b2c,0x5aaa62cb,0x6b0b62cb,0x62eb5a8a,0x62cb630b,0x5aaa5aca,0x5aca5aaa,0x5aaa5aaa,0x6b2c5aaa,0x6b2c6b2c,0x62eb630b,0x630b62ca,0x6b2b6b2b,0x734c6b2c,0x7bce7bae,0x736d738d,0x736d736d,0x6b2b6b4c,0x62eb630b,
-0x630b6b0b,0x62eb62eb,0x630b630b,0x6b2c6b0b,0x62eb630b,0x6b2c630b,0x6b2b6b2b,0x630b630b,0x6b2c6b2b,0x6b2c6b2c,0x62eb630b,0x630b630b,0x6b2c630b,0x62eb630c,0x6b2c630b,0x630b6b2c,0x632c6b2c,0x632c632c,0x6b4c6b4c,0x630b6b2c,0x632b5aca,0x6b2c6b2c,0x6b4c630b,0x62eb6b4c,0x6b2c6b2c,0x632b6b2c,0x6b2c6b2c,0x630b630b,0x62eb5acb,0x630b630b,0x6b2c6b2c,0x6b2c6b2c,
-0x8c5083ef,0x83ce83ee,0x94718c30,0x83ce8c2f,0x8c30ad33,0x83ce83ef,0x7bae840f,0x9491738d,0x9471ad13,0x9cd29450,0x8c0f8c30,0x83ee840f,0x8c508c2f,0x840f8c70,0x840f840f,0x7bee842f,0x9cd29471,0x9cd38410,0x8c519cd2,0x83ef8c30,0x83ef83ef,0x8c30840f,0x840f8c50,0x7bce736d,0x738d7bce,0x8c30738d,0x8c2f9470,0x8c0f83ee,0x83ce83ee,0x7bad7bad,0x8c2f8c0f,0x736c7bce,
-0x738d738d,0x83ee7bcd,0x840f8c30,0x7bce83ee,0x7b8d7bae,0x7bce7bce,0x7bce83ee,0x7b8d7bce,0x738d7bae,0x734c738d,0x734c6b4c,0x630b6b2c,0x62eb630b,0x630b630b,0x630b62eb,0x6b2c6b4c,0x6b2c6b4c,0x62eb630b,0x6b2c6b0c,0x732c6b2c,0x6aeb734d,0x6b0b62eb,0x6b0b6b2c,0x6b2c6b2c,0x6b0b62eb,0x6b2c6b2c,0x6b2c6b2c,0x738d734c,0x736d738d,0x736d734c,0x7b8e7b8d,0x7b8d7b8d,
-0x7bae7bae,0x83cf8c30,0x7bae83cf,0x7bae8c0f,0x7bae7b8e,0x83ef7bae,0x736d8c30,0x83cf7b8d,0x7bce7b8d,0x83ce83cf,0x7bad7bae,0x736c7b8d,0x7b8d7b8d,0x736d734c,0x6b0b734c,0x7b6c734c,0x7b8d736c,0x7b8d7b8d,0x83ee83ce,0x734c7b6d,0x83ce7bad,0x945083ee,0x734c6b2b,0x83ce732c,0x738c736c,0x736c736c,0x734c734c,0x6b2b6b0b,0x62ea62ca,0x6b0b6b2c,0x5aaa630b,0x5aaa5aca,
-0x62eb62eb,0x62eb5aca,0x630b62eb,0x6b2c62eb,0x630b62eb,0x62eb62eb,0x5aca62eb,0x6b0c62eb,0x7bce6b4c,0x6b4c736d,0x738d6b0b,0x5aca734c,0x5aca62eb,0x7bae62eb,0x62eb6b0c,0x5aca62eb,0x5aca5aaa,0x62eb5aca,0x5a8a5aaa,0x5aaa630b,0x5aaa5289,0x6b2c62cb,0x6b0b6b2c,0x62eb630b,0x630b62ea,0x630b5aca,0x6b4c6b2c,0x83ce7bce,0x7bae7bae,0x7bae7bae,0x630b6b4c,0x6b2b6b0b,
-0x630b630b,0x62ca62eb,0x62eb62ca,0x62eb62eb,0x62eb62eb,0x630b630b,0x630b630b,0x6b0b62eb,0x630b6b2c,0x6b2c6b2c,0x62eb630b,0x630c62eb,0x6b4c62eb,0x5acb6b2c,0x630b5aca,0x6b2c630b,0x630b630b,0x630b630b,0x62eb630b,0x6b2c630b,0x6b2c62eb,0x630b632b,0x630b5aea,0x6b2c6b2c,0x6b4c6b2c,0x6b2c6b4c,0x630c6b2c,0x6b2c630b,0x6b2c6b2c,0x630b630b,0x6b2c6b0b,0x630b6b0b,
-0x8c3083ef,0x7b8d8c0f,0x83ee83ef,0x94509470,0x7bae9c91,0x7bce8c2f,0x840f7bad,0x840f83ef,0xb5549491,0x94509cb2,0x8c508c30,0x8c508c30,0x83ef7bee,0x94719cb2,0x7bce7bce,0x83ef8c71,0xb5957bce,0x9cb2b575,0x9491ad54,0x83ef738d,0x83ce8c30,0x8c0f8c0f,0x83ef83ef,0x738d7bae,0x7bce83ee,0x7bce738d,0x83ee8c0f,0x7bad7b8d,0x8bef8c0f,0x83ee83ce,0x8c0f8c0f,0x840f840f,
-0x736c6b4c,0x7bcd7bce,0x840f83ee,0x83ee8c2f,0x7bae7bae,0x840f83ef,0x83ee840f,0x7bae83ee,0x7b8d7bae,0x736d7b8d,0x734d736d,0x6b2c6b2c,0x6b2c6b0b,0x62cb62eb,0x6b0b6b0b,0x6b4c6b0b,0x6b2c630b,0x5aca630b,0x736d6b0b,0x734d734d,0x736d736d,0x6b2c7b8d,0x62eb6b0b,0x6b2c6b2c,0x630b630b,0x6b0b6b0b,0x6b4c6b2c,0x734c736d,0x736d738d,0x736d736d,0x7bae738d,0x7bae7bae,
-0x734d7b6e,0x8c107b8e,0x7bae83ce,0x83cf7bae,0x736d7bae,0x7bae7bae,0x734d736d,0x7b8e7b8e,0x7bae83cf,0x738d738d,0x83ce7bae,0x736d7bad,0x7b6d7b6d,0x7b6d734c,0x6b2b736c,0x7b8d736c,0x7b8d7b8d,0x7bce7bad,0x7bad83ce,0x7bad736c,0x7bad7b8d,0x9450736c,0x734c738d,0x7bad734c,0x734c736c,0x7b8d736c,0x736d83ce,0x6b4c734c,0x6b0b62eb,0x6b0c62eb,0x62eb5aca,0x62eb62ca,
-0x630b62eb,0x6b2c630b,0x5aca5aea,0x6b2c5acb,0x630b630b,0x62eb630b,0x62cb62eb,0x630b62cb,0x7bae7b8e,0x5aca6b4c,0x6b2c5aca,0x6b0b734c,0x62ca62ca,0x736d630b,0x6b2c62eb,0x5aca630b,0x5aca62eb,0x62eb5acb,0x5aca5aaa,0x528a62eb,0x630c5aaa,0x6b4c6b2c,0x630c6b2c,0x630b630b,0x630b62eb,0x630b62ea,0x736d6b4c,0x840f7bce,0x7bae83ef,0x738d7bae,0x6b2c734c,0x630b6b2b,
-0x62eb62eb,0x5aca62eb,0x62eb5aca,0x62eb62eb,0x630b630b,0x630b6b2b,0x630b62eb,0x734c6b0b,0x630b6b2c,0x630b6b0b,0x62eb5aca,0x632c630b,0x630b630b,0x62eb630b,0x5acb62eb,0x6b4c62eb,0x630b630b,0x630b630b,0x5aeb62eb,0x6b4c630b,0x6b4c6b2c,0x6b4c632b,0x632b6b2c,0x6b2c632b,0x6b4c632b,0x6b4c736d,0x630b6b2c,0x630b62eb,0x630b6b2c,0x62eb62eb,0x6b2c6b2c,0x6b2b6b2c,
-0x83ef8c50,0x83ef83ce,0x83ef83ce,0x9c9183ce,0x7bad9470,0x840f83ee,0x7bce7bce,0x840f840f,0x94917b8d,0x9450c5f6,0x94708c30,0x8c508c30,0x840f7bce,0x9471842f,0x7bce8c30,0x9cb27bef,0x83ef8c30,0xad349450,0x9450a4f3,0x83ef8c30,0x8c30840f,0x8c308c30,0x840f8c0f,0x7bce8c4f,0x7bce73ad,0x83ee7bce,0x83ee840f,0x7b8d7b6d,0x8c0f83ee,0x8c2f8c0f,0x8c2f8c2f,0x94708c50,
-0x736c736c,0x7bad7bad,0x83ef7bae,0x83ce8c2f,0x7bce7bce,0x83ef83ef,0x83ef840f,0x8c0f8c2f,0x736d83ce,0x734c734c,0x736d736d,0x736d734c,0x6b2c734c,0x6b0b6b0b,0x6b2c6b0c,0x6b2c6b0c,0x630b62eb,0x6b2c6b2c,0x7b8d6b2c,0x83ef7b6d,0x7b8e7bae,0x736d7b8e,0x6b0b736d,0x630b630b,0x630b630b,0x6b0b6b0b,0x734c6b2c,0x736d738d,0x736d736d,0x738d738d,0x7bae738d,0x7bae7bae,
-0x734d7b8e,0x7bae736d,0x83ce83ce,0x7b8d7bae,0x7bae7bae,0x7bae7b8d,0x7bae7b8e,0x7bce7bae,0x7bae7bce,0x736d738d,0x7bae7b8d,0x7b8d7bae,0x7b8d7b8d,0x736d734c,0x7b8c7b8d,0x736c7b8c,0x7bad7bad,0x7b8d7bce,0x734c736c,0x7b8d734c,0x6b4c736c,0x840f6b0b,0x734c7bad,0x6b2b738d,0x734c6b4c,0x7b8d738d,0x736c83ce,0x6b4c734c,0x630b6b0b,0x6b0b62eb,0x630b62eb,0x62eb630b,
-0x5aca5aca,0x630b62eb,0x5aca5aca,0x630b5acb,0x62eb62cb,0x630b630b,0x62eb62eb,0x630b62eb,0x6b2c6b2c,0x62eb630b,0x630b630b,0x7bae736d,0x6b4c7bae,0x6b2c7bae,0x62eb62eb,0x5aaa5aca,0x5aaa5aaa,0x5acb630b,0x62eb5acb,0x5acb5289,0x736d6b4d,0x6b2c6b2c,0x6b2c630c,0x630b632b,0x6b0b6b0b,0x6b2c736d,0x736d6b4c,0x83ce6b4c,0x7bae83ef,0x6b4c736d,0x62eb6b0b,0x5aaa62ea,
-0x62eb62eb,0x62eb62eb,0x630b62eb,0x6b0b6b2c,0x6b2c6b0b,0x630b6b2c,0x630b62eb,0x736d6b2c,0x6b4c6b4c,0x62eb6b2c,0x630b62eb,0x632c6b4c,0x630b630b,0x62eb5aeb,0x630b630b,0x630b630b,0x632b632b,0x62eb630b,0x632b630b,0x6b4c6b4c,0x6b4c630b,0x738d6b4c,0x632b736d,0x6b2c630b,0x6b4c632b,0x6b2c6b2c,0x6b2c6b2c,0x630b630b,0x630b630c,0x6b0b62eb,0x736d6b4c,0x734c736c,
-0x8c309451,0x83ef7bae,0x7bce8c50,0x840f83ee,0x9cd2ad33,0x840f83ee,0x83ce8c50,0x7bce7bce,0x83ef8c0f,0xad33a4f3,0x83ef83ee,0x83ef8c30,0x842f842f,0x8c3083ef,0x8c308c30,0x7bcf83ef,0x83ce840f,0x8c307bae,0x9cd29471,0x9cb28c30,0x94708c30,0x8c509cf2,0x840e83ee,0x840f7bce,0x7bee840f,0x840f83ee,0x83ce840f,0x7bad736c,0x8bef7bad,0x94508c2f,0x94509450,0x8c0f9470,
-0x738d7bad,0x83ee738d,0x8c30840f,0x840f8c2f,0x83ef840f,0x7bce83ef,0x83ee7bce,0x8c508c30,0x83ce8c0f,0x734c736d,0x734c736d,0x734c6b2c,0x6b2c7b8d,0x6b2c6b2c,0x6b2c6b2c,0x630b6b2c,0x630b630b,0x6b2c630b,0x83ce736d,0x8bef7b8d,0x7b8d8bef,0x7b8d734d,0x734c83ce,0x630b62eb,0x630b6b0b,0x6b2c6b0b,0x736d6b2c,0x7bce7bae,0x738d738d,0x7b8d7bae,0x738d738d,0x7bae738d,
-0x7baf83cf,0x736d7bae,0x7bce7bae,0x7bae83ef,0x7bce7bae,0x7bce738d,0x7bce83ef,0x83ef738d,0x7bce738e,0x738d7bce,0x738d736d,0x7bae7bae,0x7b8d736d,0x7bad7bae,0x736c7b8d,0x734c734b,0x736c736c,0x7b8d7bad,0x736c736c,0x6b0a6b2b,0x734c738c,0x736c6b0b,0x734c83ce,0x736c7b8d,0x736c734c,0x7b8d7b8d,0x6b0b7b8d,0x6b2c6b2c,0x6aeb6b0b,0x6b2c734c,0x6b0b734c,0x62eb6b2c,
-0x52aa5aca,0x5aca5aca,0x62eb5aca,0x5aca630b,0x62eb5aca,0x630b6b0c,0x6b2c6b0c,0x6b0c630c,0x734c6b2c,0x6b2c6b2c,0x6b0b6b0b,0x738d6b4c,0x6b4c7bae,0x630b7bce,0x630b630b,0x630c62eb,0x5aaa5aaa,0x62eb630b,0x62eb62eb,0x6b2c5aaa,0x736d736d,0x630b630b,0x6b2c6b2c,0x630b630b,0x736c6b2c,0x6b0b738d,0x6b2c630b,0x738d6b2c,0x7b8d7bae,0x6b2c736d,0x62eb62eb,0x5aca62ea,
-0x62eb62eb,0x62eb62ca,0x630b62eb,0x6b2c630b,0x630b6b2c,0x62eb630b,0x630b62eb,0x6b2c6b0b,0x734c6b2c,0x6b4c6b2c,0x6b2c6b4c,0x632c6b4c,0x630b62eb,0x5aeb62eb,0x6b2c62eb,0x630b6b4c,0x630b630b,0x630b630b,0x630b630b,0x6b2c6b2c,0x6b4c630b,0x6b2c6b4c,0x630b6b2c,0x6b2c632b,0x6b2c630b,0x630b630b,0x6b2c630b,0x6b4c6b2c,0x736d736d,0x6b2c6b4c,0x6b2c6b2c,0x6b2c6b2c,
-0x94718c30,0x7bad8c0f,0x8c0f7bce,0x83ee7bae,0xb5959470,0x7bad9491,0x8c507bce,0x738d83ef,0x94917bce,0x8c5083ce,0x8c50a4d2,0x7bae83ef,0x840f840f,0x7bcf840f,0x83ef83ef,0x8c308c30,0x8c3083ef,0x83ce9450,0xbdd67bae,0x9471e6da,0x8c2f9471,0x842f8c50,0x7bce7bad,0x7bce842f,0x840f8c50,0x8c2f842f,0x83ce83ee,0x736c736c,0x83ce7b8d,0x94708c2f,0x8c0f8c50,0x7bce8c2f,
-0x738d738c,0x83ee738d,0x8c2f8c2f,0x8c50840f,0x83ef8c30,0x7bae83ef,0x7bce7bce,0x8c0f8c0f,0x8c0f8c0f,0x736d83ce,0x736d734d,0x6b2c6b2c,0x6b2c734c,0x62eb62eb,0x6b2c6b2c,0x630b6b0b,0x6b2c630b,0x62eb630b,0x9450736d,0x736d7bae,0x7bae83ef,0x736d736d,0x736d83ce,0x630b6b0b,0x630b734c,0x6b2c62eb,0x7bae736d,0x840f83ef,0x7bae7bae,0x7bae7bce,0x738d738d,0x7b8e736d,
-0x7bcf7bcf,0x7bae7bae,0x7bae7b8e,0x840f7bce,0x7bae7bae,0x7bce8c0f,0x7bae7bae,0x7bae7bae,0x83ef7b8e,0x7bae840f,0x7bad738d,0x7b8d7bae,0x7b8d83ce,0x8bef83ce,0x83cd8c0e,0x734c734b,0x6b0b736c,0x734c6b2b,0x6b4c6b4c,0x6b4b6b2b,0x7b8c6b2b,0x736c7b8d,0x738d9470,0x7b8d738d,0x7b8d7bad,0x738d736c,0x6b0b736d,0x6b0b6b0b,0x6b2c6b0b,0x736d734c,0x6b2c6b2c,0x62eb630b,
-0x5aeb5aea,0x62eb632b,0x6b2c630b,0x62eb6b4c,0x630b62eb,0x62eb6b0c,0x630b62eb,0x5aca62cb,0x736d62eb,0x6b4c6b2c,0x6b2c6b0b,0x630b630b,0x734c6b2c,0x5aca736d,0x6b2c5aca,0x630b6b2c,0x62eb630b,0x6b4c62eb,0x5aca630c,0x6b4c6b4d,0x630c630c,0x736d62eb,0x738d7bae,0x630b6b2c,0x7bae630b,0x736d738d,0x736d738d,0x6b4c738d,0x6b2c6b2c,0x630b6b2c,0x6b0b62eb,0x6b2b6b2c,
-0x62eb6b2c,0x630b62eb,0x62eb630b,0x6b4c630b,0x62eb6b0b,0x62ca62ea,0x6b0b62eb,0x62ea62eb,0x62eb5aca,0x736d62eb,0x632b738d,0x630b630b,0x5aeb630b,0x62eb62eb,0x630b5aeb,0x6b4c6b4c,0x630b630b,0x6b4c6b4c,0x630b6b2c,0x6b6c6b2c,0x6b4c630b,0x630b6b2c,0x6b4c6b4c,0x62eb6b4c,0x6b2c62eb,0x630b6b2c,0x630b630b,0x6b4c630c,0x630c6b2c,0x5aca62eb,0x62ea5aca,0x6b0b630b,
-0x8c5083ef,0x8c2f8c30,0x83ee83ee,0x840e8c2f,0x9cd29470,0x9470a4f2,0x8c0f7bad,0x840f8c50,0x9cd27bae,0x840f9470,0xa5139471,0x7bce8c0f,0x840f840f,0x83ef840f,0x83ef7bae,0x94508c50,0x8c3083ef,0x7bae9471,0xa513840f,0xa533d699,0x7bee83ef,0x83ef8c30,0x73ad7bce,0x7bce7bce,0x840f7bce,0x83ce840f,0x8c2f83ee,0x6b4b7bad,0x7bad7b8d,0x83ee83ee,0x8c0f8c0f,0x83ee8c2f,
-0x734c736c,0x8c0f83ee,0x83ef83ce,0x94509450,0x94718c50,0x8c0f8c2f,0x83ee8c2f,0x840f83ee,0x8c2f83ce,0x83ef8c2f,0x736d7bae,0x738d736d,0x6b2c630b,0x6b2c6b4c,0x6b4c736d,0x630b6b0b,0x632b6b2b,0x630b630b,0x7bce734c,0x6b4c736d,0x7bce736d,0x7bae738d,0x7bce83cf,0x630b6b4c,0x630b6b0c,0x6b4c6b0c,0x7b8d6b4c,0x738d736d,0x83ef840f,0x736d7b8d,0x738d736c,0x7b8d738d,
-0x7bce83ef,0x83ef840f,0x738d7bce,0x8c3083ef,0x83ef83ef,0x83ce83ce,0x7b8e83cf,0x7bae736d,0x7bae736d,0x738d7bae,0x738d736d,0x83ef7bae,0x83ee7bad,0x945083ee,0x734b8c0e,0x734c734c,0x734c736d,0x734c734c,0x734c736c,0x7b8d736c,0x736c734c,0x736c83ce,0x8c0f8c0f,0x736c736c,0x7bad83cd,0x7b6d6b0b,0x6aeb736d,0x6b0b736c,0x736d6b2c,0x6b2c734c,0x62eb6b0b,0x62eb62ca,
-0x5aca630b,0x62eb630b,0x62eb630b,0x5aca5aca,0x6b2c630b,0x62eb5aca,0x62eb630b,0x62eb62eb,0x6b2c630b,0x6b2c630b,0x6b2c630b,0x630b630b,0x736d6b2c,0x62eb83ef,0x630b5aca,0x5aca6b0b,0x630b5acb,0x6b2c6b2c,0x734c62eb,0x6b2c630b,0x6b0b6b0c,0x736d6b4c,0x734c736d,0x736d6b6c,0x83ef738d,0x7bae8c2f,0x83ef83ef,0x6b0b7b8d,0x6b4c6b4c,0x62ca630b,0x6b2c62eb,0x736d734c,
-0x630b6b2c,0x630b630b,0x62eb62eb,0x6b0b62eb,0x62eb630b,0x62eb62eb,0x630b630b,0x6b2c6b2c,0x630b630b,0x6b2c6b2c,0x6b2c6b2c,0x62eb630b,0x62eb5aea,0x5aca62eb,0x62eb630b,0x630b630b,0x632c630b,0x6b4c6b4c,0x6b4c6b2c,0x6b6d6b4c,0x630b6b4c,0x632c630b,0x632c630b,0x632b6b4c,0x6b4c630b,0x632c6b4c,0x630b62eb,0x62eb630b,0x6b2c6b2c,0x62eb6b2c,0x62eb6b2c,0x6b2c630b,
-0x8c2f840e,0x8c509470,0x9cb19470,0x8c2f8c2f,0xb5749491,0xa4f2a512,0x83ee9450,0xa4f283ee,0x83ee9470,0x8c508c70,0x9cd2840f,0x7bce9cd2,0x840f83ef,0x7bce83ef,0x7bae840f,0x8c3083ce,0x83ef8c50,0x8c0f83ef,0x94b18c50,0xbdb69471,0x842fa513,0x7bee7bce,0x83ef7bae,0x7bce738d,0x83ef7bae,0x83ee9450,0x83cd83ee,0x7bcd7bad,0x83ee7b8c,0x840e9470,0x8c2f83ee,0x83ce8c2f,
-0x7bad7bad,0x8c5083ef,0x8c308c30,0x9c918c50,0x94509c91,0x94309c71,0x8bef8c2f,0x8c0f8c0f,0x8c2f8c30,0x8c509450,0x7bae7bce,0x7bae7bce,0x6b0b736d,0x6b4c6b4c,0x630b6b4c,0x62eb6b2c,0x6b2b630b,0x6b2b6b2c,0x736d6b2c,0x6b4c6b4c,0x7b8d736d,0x7bce7bae,0x736d7bae,0x736d6b4c,0x6b2c6b0c,0x736d6b2c,0x7bae736d,0x6b4c734c,0x840f7bce,0x736d83ce,0x736d736d,0x7bae738d,
-0x8c0f83ef,0x8c0f8c30,0x7bae7bae,0x7bce7bae,0x83ef8c0f,0x83ce7bae,0x7b8e83cf,0x8c107bae,0x734d6b2c,0x736d736d,0x738d738d,0x736d736d,0x8c0f7bad,0x7b8d8c0f,0x7b6c732c,0x734c736c,0x6b2c6b2c,0x6b2c734c,0x734c734c,0x736c736c,0x734c736c,0x83ce7b8d,0xa4d29450,0x83ce83ae,0x7bad7b8d,0x732c734c,0x6b0b6b0b,0x6b2b734c,0x7b8d6b0c,0x62cb734c,0x62cb5aaa,0x6b2c62eb,
-0x5aca5aca,0x5aca62eb,0x5aca5aaa,0x62ca62eb,0x62eb5aca,0x62eb5aca,0x630b62eb,0x62eb62eb,0x630b62eb,0x630b630b,0x6b6c6b4c,0x6b0b6b2c,0x630b62ca,0x6b2c6b4c,0x630b630b,0x6b2c630b,0x62eb630b,0x62eb62eb,0x6b2c630b,0x6b2c6b2c,0x736d738d,0x6b2c6b4c,0x736d6b4c,0x736d736d,0x945083ef,0x8c509471,0x94509470,0x736c7bae,0x736d736d,0x62eb6b4c,0x62eb5aca,0x630b630b,
-0x630b62eb,0x630b630b,0x6b4c6b2c,0x6b0b6b2c,0x6b0b630b,0x6b2c6b2c,0x62eb630b,0x632b630b,0x630b630b,0x6b2c6b2c,0x62eb630b,0x5aca5aca,0x62eb5aca,0x5aca5aca,0x630b5aeb,0x632c630b,0x630b630b,0x630b632c,0x6b4c630b,0x632c6b4c,0x6b2c630b,0x630b632c,0x630b632c,0x630b62eb,0x632c6b4c,0x630b630b,0x630b630b,0x630b630b,0x6b2c630b,0x630b6b2c,0x630b630b,0x632b62eb,
-0x83ce8c2f,0x8c507bce,0x8c0f9491,0x83ce7bce,0x8c508c30,0x94918c30,0x8c2fa4f2,0x8c2f8c0f,0x840f9cb2,0x8c308c50,0x83ee840f,0x9cd28c50,0x83ef8c50,0x840f840f,0x8c3083ce,0x8c107bae,0x94918c50,0x84108c30,0x83ef83ef,0x8c508c30,0xad54b575,0x83ef7bae,0x7bce7bce,0x736d7bae,0x840f738d,0x9cb183ef,0x840e9450,0x7bad8c0e,0x944f7bad,0x8c2fa4d2,0x94508c2f,0x8c0f8c2f,
-0x7bae7bae,0x947183ef,0x94509470,0x8c2f840f,0x8c2f8c2f,0x9c919471,0x94509c91,0x8c2f8c2f,0x8c508c30,0x8c508c50,0x840f8c2f,0x7bce83ce,0x7bae7bae,0x6b2c736d,0x6b2c736d,0x6b0b62eb,0x6b4c6b2b,0x632b6b2b,0x736d6b2c,0x736d734c,0x734c738d,0x736d6b4c,0x6b2c6b2c,0x736d6b4c,0x6b4c736d,0x6b4c6b2c,0x736d734c,0x6b4c6b2c,0x7bce736c,0x7b8d83ee,0x736c7bad,0x7b8d736d,
-0x7bce7bae,0x8c3083ef,0x7bae7bce,0x7b8d7b8d,0x8c1083ce,0x7b8e83ef,0x83cf7bae,0x83cf83cf,0x734d734d,0x734d734d,0x734d734d,0x736d734d,0x83ee736d,0x83ce7b8d,0x6b0b7bad,0x736c736c,0x734c734c,0x734c736c,0x6b2c734c,0x736c734c,0x736c7b6d,0x83ce7b8d,0xad138c0f,0x8bef83ee,0x734c83ae,0x7b6d734c,0x6b0b736c,0x62eb62eb,0x6b0c734c,0x62cb62ca,0x5aaa62eb,0x6b0b5a89,
-0x630b5aca,0x62eb62eb,0x5aca5aaa,0x62ca62eb,0x5aaa5aca,0x630b5aca,0x736d6b2c,0x5aaa62eb,0x5aaa5acb,0x6b2c630b,0x6b4d6b2c,0x62eb736d,0x736d62eb,0x6b2c6b0c,0x6b4c6b2c,0x5aca62eb,0x6b2c6b2c,0x6b0b6b2c,0x630b6b4c,0x6b2c6b4c,0x738d736d,0x738d7bae,0x736d736d,0x6b2c736d,0x8c3083ce,0x8c309450,0x8c108c30,0x738d7bae,0x6b4c734c,0x6b4c6b4c,0x630b630b,0x6b0b6b2c,
-0x62eb630b,0x6b2c62eb,0x6b4c6b4c,0x6b2c6b2c,0x630b630b,0x630b630b,0x62eb62eb,0x62eb630b,0x62eb62eb,0x62eb62eb,0x62eb5aea,0x630b62eb,0x62eb62eb,0x5aca5aca,0x62eb52aa,0x630b630b,0x630b5aeb,0x630b630b,0x6b4c630b,0x6b2c6b6d,0x632c632b,0x632c630b,0x6b4c6b6d,0x630b630b,0x630b632b,0x630b630b,0x630b630b,0x62eb62eb,0x6b2c630b,0x6b2c6b2c,0x62eb630b,0x630b62eb,
-0x9cb18c0f,0x83ef8c0f,0x8c309450,0x7bce83ef,0x9491840f,0x840f83ef,0x9cd29470,0x83ee8c2f,0x949183ee,0x83ee8c70,0x840f840f,0x8c5083ee,0x83ef9cb1,0x840f8c30,0x840f8c0f,0x8c30840f,0x8410840f,0x7bce9cb2,0x83ef83ef,0x7bcf7bae,0xc5f783ef,0x7baead55,0x7bce83ef,0x738d7bce,0x83ce7bce,0x94508c50,0xad13b554,0x7bad8c0f,0x947083ee,0x8c2f9cb1,0x94709450,0x94708c2f,
-0x83ef8c50,0x94508c0f,0x94508c0f,0x840f8c2f,0x8c0f83ee,0x945083ee,0xad13a4d2,0x9450a4d2,0x8c508c0f,0x8c508c50,0x8c0f9450,0x7bae7bce,0x738d7bce,0x6b4c736d,0x6b4c6b2c,0x62eb6b2c,0x6b4c632b,0x6b2b6b2b,0x738d6b4c,0x7bae738d,0x736d83ce,0x630b630b,0x6b4d6b2c,0x630b6b2c,0x6b4c6b4c,0x736d734c,0x6b4c734c,0x6b0b6b0b,0x6b4c6b2c,0x7bad736d,0x736d7bae,0x738d736d,
-0x736d7b8d,0x83ce7bae,0x7bce840f,0x7bae83ce,0x83ef83ce,0x83cf83ef,0x83ce83ef,0x7b8e7b8e,0x7bae7b8e,0x734d736d,0x734d734d,0x736d734d,0x7b8d736c,0x7bad7b8d,0x736c7bad,0x7bae736c,0x734c736d,0x736c736c,0x6b0b736c,0x736c6b2b,0x7b8d7b8d,0x7bad83ce,0x9cb17bad,0x83ce83ee,0x736c7b8d,0x734c7b6d,0x6b2c6b2c,0x62cb62eb,0x6b2c6b2c,0x62ca62cb,0x5aaa5aaa,0x6b0c5aaa,
-0x62eb62eb,0x62eb5aca,0x62eb5aca,0x62eb62eb,0x5aaa62eb,0x62eb62ca,0x62eb5aaa,0x62eb5aca,0x528a5acb,0x6b2c630b,0x6b2c630b,0x62eb734d,0x83ef62eb,0x736d738d,0x6b4c6b4c,0x5aaa62eb,0x6b2c630b,0x6b2c6b2c,0x630b6b2c,0x6b4c6b4c,0x736d6b4c,0x734c738d,0x6b4c6b4c,0x6b4c6b6c,0x8c2f7b8d,0x8c309451,0x83ef83cf,0x736d738d,0x6b0b736d,0x736d6b2c,0x6b2c734c,0x630b6b2c,
-0x62eb6b2c,0x630b62eb,0x6b2c6b2c,0x6b2c6b2c,0x630b6b2c,0x630b630b,0x630b630b,0x630b630b,0x630c630b,0x62eb6b2c,0x6b2c62eb,0x630b632b,0x630b632b,0x5aea62eb,0x5aca52aa,0x5aeb62eb,0x632c5aeb,0x630b630b,0x632c630b,0x6b6d736d,0x630b632c,0x632c630b,0x6b4c632c,0x630b6b4c,0x632b630b,0x630b632c,0x630b630b,0x630b630b,0x630b6b2c,0x632b6b4c,0x630b6b2c,0x630b6b2c,
-0x8c308c50,0x83ee9450,0x8c507bce,0x83ef8c2f,0x8c3083ee,0x7bce9491,0x9470840f,0x83ef9471,0x8c307bae,0x94708c70,0x8c2f8c30,0x7bce8c50,0x9cd2840f,0x83ef8c30,0x840f7bae,0x83ef8c30,0x83ef7bae,0x9471840f,0x7bae840f,0x83ef7bce,0x83ef7bce,0x840fc5f7,0x94517bae,0x738d83ef,0x83ee83ef,0x94508c0f,0xb5749cb1,0x83cd9470,0x94508c0f,0x8c0e8c2f,0x8c2f8c2f,0x94918c2f,
-0x8c509491,0x94708c2f,0x94918c30,0x8c509471,0x7bce9491,0x8c0f7bae,0xa4f39c91,0x9470a4d2,0x8c0f8c2f,0x94708c50,0x8c0f8c2f,0x7b8d83ee,0x736c7bad,0x6b4c6b4c,0x736c6b2b,0x6b2b736c,0x6b2c62eb,0x6b4c6b4c,0x738d6b4c,0x7bce7bae,0x7bae83ef,0x6b4c6b2c,0x7bce7bae,0x630b6b2c,0x736d736d,0x6b0b738d,0x6b2c630b,0x6b2c6b4c,0x62ea6b4c,0x7b8d6b0b,0x7bae7b8d,0x736c7b8d,
-0x7bad7b8d,0x7bae83ce,0x83ce83ce,0x83cf83ef,0x83ce7bae,0x83ef83cf,0x83cf8c0f,0x7b8d7b8e,0x7b8e7b6d,0x7b6d7b6d,0x7bae7bae,0x6b2c7b8d,0x736d734c,0x736c7b8d,0x7b8d736d,0x7bae7b8d,0x6b2c736d,0x734c734c,0x6b0b734c,0x736c6b2b,0x7bad83ce,0x7bad83ce,0x7bad7bad,0x6b0b7b8d,0x734c732c,0x734c7b6d,0x62eb6b0b,0x6b0b6b0b,0x62eb6b0b,0x62cb62ca,0x736d6b4c,0x5aaa62ea,
-0x5aaa62eb,0x62ca5aca,0x6b2c5aca,0x6b2c630b,0x5aca630b,0x6b2c62eb,0x62eb62eb,0x5aca5aaa,0x62eb5aca,0x5acb62eb,0x62eb6b0c,0x6b2c62eb,0x83ef6b4d,0x6b2c736d,0x630c6b2c,0x6b2c6b0c,0x736d6b6c,0x6b2c6b2c,0x6b4c6b2c,0x6b4c738d,0x738d7bae,0x6b4c736d,0x738d6b6c,0x738d73ad,0x840f7bae,0x8c308c50,0x7bce83ce,0x6b4c736d,0x630b736d,0x6b4c630b,0x6b6c6b4c,0x630b6b4c,
-0x630b630b,0x630b630b,0x6b4c6b2c,0x6b2c6b4c,0x630b6b0b,0x630b632b,0x62eb62eb,0x62eb62eb,0x62eb62eb,0x630b632b,0x6b2c630b,0x62eb630b,0x630b630b,0x62eb630b,0x5aca5aca,0x630b630b,0x632c630b,0x630b630b,0x630b630b,0x6b6d6b6c,0x6b4c6b4c,0x6b2c6b4c,0x630b62eb,0x632c6b4c,0x6b2c6b4c,0x630b630b,0x6b2c630b,0x6b2c6b2c,0x6b2c6b4c,0x6b2c6b4c,0x630b6b4c,0x630b6b2c,
-0x83efa4f2,0x9470840f,0x83ee8c0f,0x94718c30,0x83ee9491,0x94919450,0x83ef7b8d,0x9cb19450,0x7bce8c50,0x9cb283ef,0x840fa4f2,0x8c50840f,0x949183ef,0x83ef9cd2,0x840f7bce,0x83ef8c30,0x738e840f,0x9471736d,0x7bae8c50,0x7bcf7bae,0x7bcf8c50,0x9cb2840f,0x8c107bce,0x738d7bae,0x8c307bad,0x8c509450,0x94709450,0x83eea4f2,0x8c2f83ce,0x8c0f8c0e,0x83ee8c2f,0x840f83ce,
-0x840f840f,0x8c5083ef,0x94709470,0x94718c0f,0x7baec5f7,0x8c5083ce,0x94509c91,0x8c508c30,0x83ef83ef,0x8c0f840f,0x840f8c0f,0x83ce83ee,0x736d738d,0x6b2c6b2b,0x736c6b4c,0x738d736c,0x6b4c6b2c,0x6b2c632b,0x738d6b4c,0x7bce7bae,0x738d7bce,0x736d734c,0x7bae7bce,0x6b6c6b2c,0x734c6b4c,0x738d7bae,0x6b4c736d,0x6b2b6b2c,0x62ea734c,0x736c62ea,0x83ce734c,0x734c83ae,
-0x83ee7b8d,0x8c2f8c0f,0x83ce83ce,0x83ce7bae,0x83ce7bae,0x7bae83ce,0x7bae7bae,0x736d7bae,0x83ae7b6d,0x7b8e7b8e,0x83ce7bae,0x736d83ce,0x736d734c,0x7bad734c,0x736c7bad,0x736c7b8d,0x734c734c,0x6b0b6b4c,0x6b2b6b2b,0x736c734c,0x7bad7b8d,0x7b6d83ce,0x6b0b736c,0x6b2b83ce,0x734c734c,0x7b6d734c,0x62eb732c,0x6b0c6b0b,0x6b0b62eb,0x62ca62eb,0x6b2b62eb,0x6b0b62ea,
-0x5aaa5aca,0x5aca62eb,0x6b4c5aca,0x6b4c6b2c,0x630b736d,0x62eb5aca,0x6b0b630b,0x5aca5aca,0x62eb5aca,0x5acb5acb,0x62cb62eb,0x6b2c62eb,0x7b8e734d,0x6b0c6b4d,0x6b0c734d,0x62eb6b0c,0x6b4c6b4c,0x62eb6b4c,0x6b0b6b0b,0x6b0b6b4c,0x6b4c734c,0x734c6b4c,0x6b4c6b4c,0x6b6c6b4c,0x738d7bae,0x7bae7bae,0x738d7b8d,0x736d734c,0x6b2c6b2c,0x630b6b2c,0x6b6c630b,0x6b2c736d,
-0x630b630b,0x6b2c630b,0x6b2c6b2c,0x6b0b6b0b,0x62eb62eb,0x630b630b,0x62eb630b,0x5aca62eb,0x5aaa5acb,0x630b5aea,0x630b630b,0x632b62eb,0x62eb630b,0x62eb632b,0x5aca5aeb,0x630b630b,0x632c6b4c,0x630b630b,0x632c632c,0x6b2c6b2c,0x738d6b6d,0x632b6b6c,0x630b630b,0x6b4c630b,0x6b4c6b6d,0x6b4c6b2c,0x62eb6b2c,0x6b2c630b,0x6b4c6b4c,0x6b2c6b2c,0x6b2c6b2c,0x62eb630b,
-0x9cd29491,0x8c308c30,0x83ef9471,0x947183ef,0x8c309470,0x94919470,0x7bad8c50,0x94717b8d,0x83ef8c50,0x8c5083ce,0x9cd2a513,0x840f840f,0x83ef9470,0x9cd29471,0x842f8c50,0x8c5083ef,0x7bef7bce,0x6b4c7bae,0x8c508c50,0x7bae7bce,0x8c308c50,0xa4f383ce,0x8c1083ce,0x83ce7b8d,0x9cd27bce,0x8c309cb1,0x9cb19470,0x94708c2f,0x8c2f8c0f,0x8c2f8c0f,0x83ee8c2f,0x7b8d738d,
-0x7bce7bce,0x83ef83ee,0x83ef840f,0x8c507bce,0x9471d699,0x94717bae,0x94719cd2,0x7bce83ef,0x83ee83ce,0x83ce83ce,0x83ef8c0f,0x83ef83ce,0x734c83ce,0x736d6b4c,0x6b4c630b,0x6b4c736d,0x738d738d,0x630b630b,0x736d6b2c,0x7b8d738d,0x736d738d,0x6b4c6b4c,0x736d736d,0x738d6b2c,0x6b4c738d,0x738d738d,0x736d7bad,0x736c734c,0x6b2b6b2b,0x734c6b2b,0x7b8d734c,0x736c7b8d,
-0x83ce7b8d,0x94508c0f,0x7bad83ce,0x7bae7b8d,0x7b8e83cf,0x7bae7b8e,0x734d7b8d,0x7b8d736d,0x8bef7b8e,0x7b8e83ce,0x734d736d,0x7b8e7bae,0x6b2c736d,0x736d738d,0x7bae734c,0x734c736d,0x734c734c,0x630b6b2c,0x6b2c6b2b,0x734c736c,0x7b8d734c,0x736c7bad,0x734c6b2b,0x83ee9c91,0x83ae83ae,0x732c7b8d,0x6b2c6b0b,0x62eb734c,0x6b0b62ca,0x62ca6b0b,0x734c62eb,0x6b2b6b0b,
-0x62eb736d,0x5aaa62ca,0x630b62ca,0x62eb62eb,0x630b62eb,0x6b2c630b,0x62eb630b,0x5aaa5aaa,0x5aaa5aca,0x62eb62cb,0x630b5aca,0x6b0c6b4c,0x7bae7b8e,0x62cb6b4c,0x62eb5aca,0x7bce7b8e,0x6b4c6b4c,0x6b4c736d,0x6b4c6b4c,0x736d736d,0x736d6b4c,0x734c736d,0x6b4c6b4c,0x738d736d,0x6b2c738d,0x6b4c6b2c,0x6b6c6b6c,0x738d736d,0x736d6b4d,0x630b6b4d,0x630c62eb,0x6b2c6b2c,
-0x630b6b2c,0x6b4c630b,0x62eb6b2c,0x6b2c62eb,0x630b630b,0x6b2c630b,0x632b6b2c,0x5aea630b,0x62eb630b,0x630b630b,0x630b630b,0x6b2b630b,0x630b62eb,0x62eb630b,0x5aca5aca,0x630b5aca,0x632b6b4c,0x630b630b,0x6b4c6b2c,0x632b6b2c,0x6b6c6b2c,0x630b6b2c,0x6b2b6b2b,0x6b2b630b,0x6b2c6b4c,0x6b4c6b4c,0x5aca6b2c,0x62eb5aca,0x6b4c6b2c,0x6b4c6b4c,0x6b2c6b4c,0x62eb62eb,
-0x9cd29471,0x9491ad13,0x8c508c30,0x83ee8c0f,0x9cb19471,0x8c308c30,0x94918c2f,0x8c2f8c30,0x8c509470,0x8c309471,0xb5748c30,0x8c309cf2,0x8c30840f,0x94917bce,0x840f9cf2,0x842f8c30,0x7bef8c50,0x7bce840f,0x8c308c30,0x83ef8c30,0x8c30840f,0xad347bce,0x83cebd95,0x8c2f8c30,0x94709471,0x8c309471,0x94708c2f,0x83ce9470,0x8c2f9cb1,0x83ee83ee,0x83ee83ee,0x7bad736c,
-0x83ce7bae,0x8c508c50,0x7bce83ef,0x83ef7bce,0xb575b595,0x8c307bce,0x94718c30,0x7b8d840f,0x83ce8c0f,0x83ee83ee,0x83ee83ee,0x7bce83ee,0x83ce83ee,0x736d7b8d,0x6b4c6b2b,0x6b2b6b4c,0x738d736d,0x6b2c6b2c,0x6b2c6b2c,0x736d6b4c,0x736d738d,0x736d736d,0x7bae6b4c,0x6b6c736d,0x734c6b4c,0x736d738d,0x7bce7bad,0x6b2b7b8d,0x734c6b2b,0x734c736c,0x732c7b6d,0x7b6d734c,
-0x83ce83ae,0x83ce8bef,0x7bae83ae,0x7b8d83ce,0x7bae7bae,0x7b8e83ce,0x736d736d,0x7b8d738d,0x7b8d6b0c,0x7bae7b8d,0x736d7b8e,0x7b8d7b8e,0x6b2c736d,0x738d6b4c,0x736d736d,0x6b2c736d,0x6b0c6b2c,0x6b0b6b0b,0x6b2c6b2c,0x736c736c,0x7b6d7b6d,0x7b8d734c,0x734c6b2b,0x83ce9450,0x7b8d7bae,0x7b6d7b8d,0x6b0b6b2c,0x62eb62eb,0x62eb6b0b,0x6b2c6b2b,0x6b0b6b2b,0x8c2f6b2b,
-0x7bae9c91,0x5aca62eb,0x62eb62eb,0x5aca62eb,0x6b4c62eb,0x6b0b630b,0x6b0b6b2c,0x5aaa62eb,0x62eb5aca,0x62eb62eb,0x734d62eb,0x630b6b4c,0x7bae83ef,0x6b4c736d,0x6b2c630b,0x83ef7b8e,0x7bce83ef,0x736d736d,0x738d6b2c,0x6b4c6b2c,0x734c6b4c,0x734c734c,0x736d736d,0x736d738d,0x6b4c6b6c,0x6b2c736d,0x6b2c6b4c,0x6b4c6b4c,0x6b2c6b2c,0x630b630c,0x62eb630b,0x6b2c630b,
-0x632b6b2c,0x630b630b,0x630b630b,0x6b2c6b2c,0x630b630b,0x6b4c6b4c,0x62eb630b,0x62eb62eb,0x630b5aca,0x630b6b2c,0x632b630b,0x5aca630b,0x632b62eb,0x62eb630b,0x5aca5aca,0x630b5aca,0x62eb630b,0x630b630b,0x6b4c630b,0x630b630b,0x6b4c6b2c,0x736d736d,0x6b2c6b2b,0x6b4c6b6c,0x6b2c6b2c,0x632b632b,0x630b630b,0x62eb62eb,0x6b4c6b0b,0x6b4c738d,0x6b2c738d,0x630b630b,
-0xa4d29471,0xad34ad34,0x8c309471,0x83ee8c30,0x9c9183ef,0x94709470,0x94509450,0x9c919470,0x94919470,0xad13a4d2,0x94709cd2,0xa513ad33,0x8c2f8c30,0x840f840f,0x9cd29491,0x840f8c30,0x8c2f8c30,0x840f840f,0x7bee7bce,0x8c508c50,0x83ee83ee,0x945083ef,0x83cedeba,0x9c91738d,0x8c2f9491,0x947083ee,0x8c2f83ee,0x83ee83ce,0x94508c0f,0x83ee840f,0x7bad7bce,0x7b8d7bae,
-0x83ef738d,0x8c508c0f,0x7bce8c30,0x83ef83ce,0x9cb2840f,0x7bae8c50,0x83ef7bae,0x738d840f,0x83ce83ce,0x8c2f840f,0x7bae83ee,0x8c2f83ce,0x83ce83ee,0x736d7bad,0x6b2c736c,0x6b0b630b,0x6b2c6b2c,0x736d6b4c,0x6b2c6b4c,0x736d734c,0x7b8d736d,0x6b4c734c,0x6b4c738d,0x6b4c630b,0x738d6b4c,0x736d7bae,0x738d6b4c,0x736c7bad,0x7b8d734c,0x7b8d7b8d,0x734c734c,0x734c7b6d,
-0x83ce83ad,0x7b8d7bad,0x8c0f83ce,0x7b6d83ae,0x83ae7bae,0x7b8d83ce,0x736d736d,0x7b8d736d,0x7b6d734d,0x7b8d7bae,0x83ce7b8d,0x7b8d7bae,0x736d736d,0x738d7bae,0x6b4c6b4c,0x734d6b4c,0x734c6b2c,0x6b2c734c,0x734c6b0b,0x734c734c,0x736c734c,0x734c6b4c,0x734c736c,0x7b8d7b8d,0x7b8d7b6d,0x83ce83ae,0x6b0b732c,0x6b0b5aaa,0x6b0c6b2c,0x6b4c6b2c,0x6b2c6b0b,0x7bad6b0b,
-0x7bae8c30,0x62cb736d,0x62eb62eb,0x62ca62ca,0x5aaa62cb,0x62eb6b2c,0x6b2c6b0c,0x5aaa6b0c,0x5aca5aaa,0x5aca62eb,0x7bae6b2c,0x734c736d,0x736d9450,0x736d6b4c,0x736d738d,0x738d736d,0x840f840f,0x736d7bae,0x630b630b,0x6b4c630b,0x738d736d,0x734c734c,0x7bae7bae,0x7bce738d,0x736d7bae,0x6b4c736d,0x6b4c6b4c,0x6b4c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x630b630b,0x630c630b,
-0x6b2c6b2c,0x6b0b630b,0x62eb630b,0x630b630b,0x6b2c62eb,0x6b2c6b4c,0x5aca62eb,0x5aca5aca,0x5aca5aca,0x5aea5aca,0x630b630b,0x62eb5aca,0x62eb62eb,0x630b630b,0x5aeb5aea,0x5aeb630b,0x6b2c5aea,0x6b4c738d,0x630b630b,0x6b6c6b2c,0x738d6b4c,0x6b2c6b6c,0x6b4c6b4c,0x6b4c6b2c,0x6b4c6b2c,0x632b6b4c,0x6b2c630b,0x632b6b2c,0x6b2c630b,0x736d6b2c,0x6b0b736d,0x630b630b,
-0xa4f3a4f3,0x8c509cb2,0x8c309cb2,0x83ee8c50,0x7bce840f,0x9c919470,0x94919470,0x9cb19470,0x8c308c30,0xa4f39cb1,0xa4f2ad33,0xb5749491,0x8c30b574,0x9cb28c30,0x94718c30,0x8c50a513,0x94718c50,0x840f8c2f,0x83ee842f,0x8c2f83ee,0x840f8c30,0x8c2f83ce,0x8c30deb9,0x94507b8d,0x8c50a4f2,0x8c0f8c0f,0x8c0f9450,0x8c0f8c0f,0x83ee8c0f,0x8c0f9470,0x7bad7bad,0x7bad7bae,
-0x7bce738d,0x840f7bce,0x840f8c30,0x840f840f,0x840f7bce,0x840f8c30,0x83ef83ef,0x83ef7bce,0x83ee7bad,0x840f83ee,0x83ce83ef,0x8c0f83ee,0x83ce83ce,0x7bae7bce,0x6b4c738d,0x6b2c6b2b,0x6b0b734c,0x736d6b2c,0x6b4c738d,0x7b8d6b2c,0x7b8e7b8d,0x736d736d,0x734c738d,0x736d6b2c,0x738d736d,0x7b8e7b8e,0x736d736d,0x83ee7bad,0x7b8d7b8d,0x736c7b8d,0x734c734c,0x732c732c,
-0x83ae734c,0x83ae83ce,0x83ee83ce,0x7bae83ce,0x7b6d736d,0x7b8e7b8e,0x736d7b8d,0x7b8d7b8d,0x7bae7b8e,0x7b6d83ae,0x83ce7b8d,0x736d7b8e,0x736d736d,0x736d738d,0x736d736d,0x6b0b630b,0x736d7b8e,0x734c736d,0x6b0b734c,0x736c6b2b,0x736c734c,0x6b2b736c,0x734c6b0b,0x736c736c,0x732c734c,0x7bae732c,0x6aeb734c,0x6b2c62ca,0x6b2c736d,0x62ea6b0b,0x6b4c62eb,0x5aaa62ca,
-0x734c62eb,0x62eb736d,0x6b0b62eb,0x62eb6b0c,0x62eb62ca,0x6b2c62eb,0x736d736d,0x5a8a62eb,0x5aca5289,0x630b62eb,0x7bae736d,0x736d7b8d,0x734c83ef,0x736d736d,0x738d738d,0x738d738d,0x7bae738d,0x6b4c736d,0x6b2c630b,0x6b2c6b2c,0x6b4c6b2c,0x7b8d7b8d,0x7bce736d,0x73ad83ef,0x6b4c6b6c,0x6b4c6b6c,0x6b4c6b4c,0x6b2c632b,0x630b6b2c,0x6b2c62eb,0x6b2c6b2c,0x6b4c6b2c,
-0x736d736d,0x630b6b2c,0x632b630b,0x632b6b4c,0x630b5aea,0x6b2c6b2c,0x62eb630b,0x5aca5aea,0x5aca5aca,0x5aaa5aca,0x62eb5aca,0x632b5aea,0x62eb630b,0x62eb630b,0x5aca5aca,0x630b630b,0x6b4c6b2c,0x632b6b6c,0x630b62eb,0x6b4c632b,0x6b4c6b6c,0x6b2c630b,0x6b2c6b6c,0x630b630b,0x6b2c6b2c,0x6b4c6b2c,0x630b6b2c,0x6b4c630b,0x6b2c6b2c,0x734c630b,0x6b0b736d,0x6b0b6b0b,
-0xad349cd2,0x94719471,0xa4f39471,0x8c2f9470,0x83ef840f,0x9470840f,0x94709cb1,0x8c2f9450,0x8c0f9c91,0xa4f28c50,0xad13ad33,0x9cb19491,0xad33b594,0x8c509470,0x94719491,0xad349cb2,0x8c4f9cb1,0x8c2f840f,0x8c2f8c2f,0x7bce83ee,0x8c2f840f,0x8c0f8c50,0x9450bd95,0x83ee83ce,0x9cb19470,0x83ee9450,0x8c2f8c0f,0x8c0f8c2f,0x8c0f83ce,0x94508c0f,0x83ce83ee,0x8c2f83ce,
-0x83ee83ce,0x8c2f83ef,0x840f8c2f,0x83ef83ef,0x736d7bae,0x7bae7bae,0x94918c30,0x7bae83ef,0x83ef8c0f,0x83ef83ee,0x83ee8c0f,0x83ee7bce,0x7bae7bae,0x7bce7bce,0x736c7b8d,0x6b4c6b4c,0x736d6b4c,0x736d736d,0x736d7b8d,0x7b8d736d,0x7b8e7bae,0x736d7b8d,0x734c738d,0x736d6b4c,0x7b8d736d,0x736d7b8d,0x736c736c,0x7bad738d,0x7b8d7b8d,0x734c7b8d,0x7b8d736d,0x736c732c,
-0x7b8d736c,0x7bae7bad,0x83ae7bad,0x83cf83cf,0x7b8e7b8e,0x83ae7bae,0x83ae83ce,0x7b8d7bad,0x83cf7b8e,0x7b6d83cf,0x83ee7b6d,0x7b8d83ce,0x736d6b4c,0x7b8d7b8d,0x6b4c738d,0x83ee734c,0x8c108c0f,0x8c0f8c0f,0x734c7b8d,0x6b2b6b0b,0x6b0b6b2b,0x734c734c,0x734c734c,0x6b2b6b0b,0x7b6c6b0b,0x732c732c,0x62eb62ea,0x5aaa62cb,0x6b2c6b0b,0x62ca6b2c,0x6b0b5aaa,0x5aa95aca,
-0x6b2c62cb,0x62eb732c,0x62aa6b0b,0x6aeb62cb,0x6b0c62ca,0x732c62ca,0x734d7b6d,0x62cb6aeb,0x62ea62ea,0x736d630b,0x736c7bad,0x736c6b4c,0x736c7bae,0x6b4c736c,0x6b2b6b4c,0x630b632b,0x736d736d,0x6b4c6b6c,0x6b4c6b2c,0x734c6b4c,0x6b2c736d,0x7bae7b8d,0x736d6b4c,0x6b4c73ad,0x6b6c736d,0x736d736d,0x736d736d,0x6b4c6b4c,0x630b6b4c,0x6b0b630b,0x6b4c6b4c,0x736d736d,
-0x736d738d,0x6b2c6b2c,0x630b632b,0x6b4c6b2c,0x62eb62eb,0x630b630b,0x62eb630b,0x5aca5aca,0x5acb5aca,0x5aca62eb,0x62eb5aca,0x62eb5aca,0x630b630b,0x630b630b,0x5aeb5aca,0x62eb630b,0x6b2c6b2c,0x630b6b2c,0x6b2c630b,0x62eb630b,0x736d734c,0x734c736d,0x736d6b4c,0x7bae7b8d,0x6b6c738d,0x632b6b2c,0x6b4c6b4c,0x630b6b4c,0x630b6b2c,0x6b2c630b,0x6b2c6b4c,0x6b2c6b4c,
-0x94919471,0x8c509cb2,0x9cb29cb2,0x8c509cd2,0x8c3083ef,0x83ee840f,0x94709450,0x840f9c91,0x9cb19470,0x94709450,0xb554ad13,0x8c2fa4d2,0xb5958c2f,0x7beead34,0x9cb18c2f,0xa5139471,0x840f9491,0x840f840f,0x8c2f840f,0x7bad83ee,0x8c2f7bce,0x94509cd2,0x8c2f9470,0x8c0f9450,0x94918c50,0x8c2f9470,0x840f83ee,0x945083ee,0x8c0f83ce,0x8c0f8c0f,0x83ee9450,0x8c2f8c50,
-0x840f83ee,0x8c308c0f,0x94509470,0x8c108c30,0x83ef8c0f,0x7bae8c0f,0x947183ef,0x7bae83ef,0x8c0f8c30,0x83ef83ef,0x83ce83ef,0x83ce83ce,0x7b8d7bae,0x7bae7bad,0x738d7b8d,0x6b4c736d,0x7bae6b0b,0x736d7bce,0x7bae7b8d,0x736d7b8d,0x7b8d7bae,0x736d7b8d,0x736d736d,0x734c736d,0x7bae7b8d,0x734d7b8e,0x736d736d,0x6b2c734c,0x736c734c,0x734c7b8d,0x7b8d734c,0x736d736d,
-0x734c7b8d,0x7b8d736d,0x7b8d7b8d,0x83ef83ce,0x83ae83ce,0x83ce7bae,0x8c0f8bef,0x7bae83ef,0x7b8e736d,0x734d7bae,0x7b6d734c,0x7bae7bad,0x734c7b8d,0x738d6b4c,0x7b8d7bae,0x8c5083ce,0x83ef83ef,0x8c0f9450,0x7b6d8c0f,0x6b0b734c,0x630b736c,0x734c6b0b,0x734c736c,0x734c6b2b,0x7b6d734c,0x732c734c,0x5aaa62ca,0x62aa5aaa,0x6b2c62eb,0x62eb734c,0x62ca62ca,0x62eb5aca,
-0x62eb62cb,0x62eb62cb,0x6aeb7b8d,0x6aeb6aeb,0x736d6b0c,0x6b2c732c,0x62cb732c,0x62eb62eb,0x5aca62ea,0x736c62ea,0x6b4c7b8d,0x738d6b4c,0x6b2b736d,0x62eb630b,0x630b630b,0x6b2b6b2b,0x6b2c6b4c,0x736d6b4c,0x6b2c6b4c,0x6b4c6b2c,0x6b2c6b4c,0x736d6b4c,0x736d738d,0x6b4c6b4c,0x6b2c6b4c,0x6b2c6b4c,0x6b4c6b2c,0x6b4c6b4c,0x6b4c6b4c,0x630b6b2c,0x734c6b0b,0x736d736d,
-0x6b2c734c,0x6b4c6b2c,0x62eb6b2c,0x6b4c630b,0x62eb630b,0x62eb62eb,0x62eb630b,0x5aea5aea,0x5aaa5aaa,0x5aca5aca,0x630b5aea,0x62eb62eb,0x62eb62eb,0x630b630b,0x5aeb5aeb,0x630b630b,0x6b2c630b,0x6b0b6b2c,0x6b4c6b2c,0x630b6b2c,0x6b2c62eb,0x738d738d,0x736d6b4c,0x738d7bae,0x738d738d,0x630b6b4c,0x632b62eb,0x630b6b2c,0x630b630b,0x6b2c6b2c,0x736d6b2c,0x6b4c736d,
-0x94719cb2,0x94918c50,0x94919471,0x9cb29471,0x83ee9470,0x83ee8c2f,0x945083ee,0x9cb19cb1,0x9c918c2f,0x9450a4d2,0xad339cb1,0x9cb1ad33,0x8c4f8c2f,0xad53b574,0x8c50840f,0x8c509cd2,0x8c508c30,0x840f8c50,0x840f840f,0x840f7bce,0x7bce83ee,0x94719470,0x840f8c30,0x94919450,0x94709490,0x94709cb1,0x840e8c2f,0x94918c0f,0x8c0f8c0f,0x8c0f8c2f,0x94707bad,0x83ee8c2f,
-0x7bad83ae,0x8bef7bad,0x9c919471,0x83ef8c30,0x94509450,0x8c0f9450,0x83ef83ce,0x8c3083ef,0x83ee83ee,0x8c2f8c30,0x7bae7bae,0x83ee83ef,0x7b8d7bce,0x7b8d7b8d,0x736d736d,0x734c736d,0x738d6b2c,0x7bae7bae,0x7b8d7bae,0x7b8d736d,0x7b8d7b8d,0x7b8d7b8d,0x7b8d736d,0x6b4c738d,0x7b8e7b8e,0x736d7b6d,0x736d736d,0x6b2c6b2c,0x734c6b2c,0x7b8d736d,0x734c736c,0x734c738d,
-0x734c736d,0x7bae7b8d,0x7b8d7b8d,0x83ce7bae,0x83ee83ef,0x7bae83ae,0x8c0f83ce,0x7b8d83ee,0x7b8d7bae,0x83ce7bae,0x734c7b8d,0x7bce736c,0x738d83ef,0x7bad736c,0x83ce7bad,0x8c0f8c0f,0x83ce83ef,0x945083ce,0x7bae8c0f,0x732c6b2b,0x734c736c,0x6b2b6b2b,0x734c734c,0x734c736c,0x732c732c,0x6b0b732c,0x62ca62ca,0x62cb62aa,0x62eb6b0b,0x62eb62eb,0x6b0b6b0b,0x62eb62eb,
-0x732c62eb,0x62eb6b0c,0x6b2c734d,0x6aeb6b2c,0x7b6d734d,0x732c7b8d,0x62cb6b0b,0x6b2c6aeb,0x5aca5aaa,0x630b630b,0x736d6b2c,0x736d734c,0x6b4c736d,0x6b2c6b2c,0x630b6b2c,0x6b4c6b2c,0x632b6b2c,0x738d6b4c,0x738d738d,0x6b4c736c,0x738d6b4c,0x6b4c736c,0x73ad738d,0x6b6c736c,0x6b4c6b4c,0x6b4c736d,0x736d6b4c,0x738d736d,0x6b4c6b4c,0x630b6b2c,0x734c6b2c,0x6b4c736d,
-0x734c6b2c,0x6b4c736d,0x630b6b2c,0x6b2c632b,0x62eb630b,0x62eb5aeb,0x630b630b,0x630b630b,0x5aaa5aca,0x5289528a,0x630c5aca,0x630b630c,0x5acb62eb,0x630b62eb,0x5aeb5aeb,0x6b2c632c,0x6b2c6b0c,0x62eb630b,0x6b0c62eb,0x6b0c6b2c,0x630b6b2c,0x7b8d6b4c,0x7bae738d,0x7bce7bce,0x6b6d7bae,0x630b632c,0x630b630b,0x6b2c630b,0x6b2c630b,0x6b4c6b4c,0x6b4c6b4c,0x736d736d,
-0x9cb2a4f3,0x94719471,0x8c509471,0x9cb18c2f,0x8c2fa512,0x840f83ee,0x840e8c0f,0xa4d19450,0x8c2f9c91,0xa4d19c70,0x94509c91,0xa4d2a4f2,0x8c2fa4f2,0xbdd69470,0x9470b595,0x8c508c2f,0x94719450,0x8c2f9471,0x8c0f840f,0x840f840f,0x7bae83ee,0x8c2f7bce,0x83ce8c2f,0x949183ee,0x94708c2f,0xa4d2a4d2,0x8c4f9470,0x94508c0f,0x8c0f9450,0x7bad8c0f,0x83ee7bce,0x94509450,
-0x83ae83ce,0x8bef83ce,0x9c719450,0x8bef8c30,0x8bef8c10,0x83ef83ef,0x8c0f83ef,0x94519450,0x83ce840f,0x94508c2f,0x7b8d83ee,0x83ce7bae,0x7bae7bae,0x738d7bae,0x6b4c734c,0x736d736d,0x736d6b4c,0x738d736d,0x7b8e7bae,0x7b8d736d,0x7b8d736d,0x736d7b8d,0x7bce738d,0x736d7bae,0x7b8e734d,0x734d7b8d,0x734c734c,0x6b4c734c,0x736c734c,0x83ce736d,0x734c7bae,0x736d736d,
-0x7b8d7b8d,0x736d7b8d,0x7bad7b6d,0x7b8d7bae,0x8c0f83ce,0x83ae8bef,0x83ae7b8d,0x7b8d83ad,0x7b8d7b8d,0x7bad7bae,0x736c7b8d,0x736c6b4c,0x7b8d7bad,0x7bad7bad,0x7bad736c,0x8c2f8c50,0x83ae8bef,0x8c0f8bef,0x7b8d8c30,0x6b0b732c,0x734c630b,0x6b2b6b4c,0x6b2b6b2b,0x6b2b736c,0x732b6b0b,0x6aea732c,0x6b0b62ca,0x62cb62eb,0x62cb62ca,0x62cb62eb,0x6b2c6b0c,0x62cb6b0b,
-0x7b8d6b0b,0x6aeb7b6d,0x62ca62eb,0x6aeb62eb,0x734d734d,0x6b0b732c,0x6b0b6aeb,0x734c6b0c,0x62eb62cb,0x62eb6b2c,0x736d6b0b,0x6b4c6b2c,0x62eb62eb,0x6b4c630b,0x632b736d,0x738d6b4c,0x736d738d,0x738d6b6c,0x83ee738d,0x738d83ce,0x7b8d7b8d,0x738d73ad,0x736c736c,0x736c736c,0x6b4c6b2b,0x736d738d,0x6b4c6b4c,0x738d6b4c,0x6b2c736d,0x6b4c6b2c,0x736d738d,0x6b4c734c,
-0x736d736d,0x736d736d,0x6b2c6b4c,0x632c630b,0x630b630b,0x630b630b,0x630b630b,0x630b630b,0x5aca630b,0x5aaa5aaa,0x62eb5aaa,0x5acb62eb,0x5aca62eb,0x630b62eb,0x630b62eb,0x6b4c6b2c,0x736d6b4c,0x6b4c736d,0x6b2c6b2c,0x6b2c6b4c,0x62eb6b2c,0x6b2c630b,0x738d6b2c,0x7bce7bce,0x6b6c738d,0x630b632c,0x6b4c632c,0x630b6b2c,0x6b4c6b4c,0x6b4c6b4c,0x630b6b4c,0x736d630b,
-0x9cb29cb2,0x8c509cb1,0x8c2f8c50,0x8c2f840f,0x9cd19cd2,0x8c2f840e,0x83ee8c4f,0x8c4f83ee,0x9c919c91,0x9c908c0f,0x9470a4f2,0x9c919470,0xa4d29cb1,0x9470840e,0xad33bdd6,0x8c508c2f,0x94509491,0x94508c30,0x94508c30,0x83ef9450,0x840f83ce,0x83ef7bae,0x83ce840f,0x8c307bae,0x8c2f840e,0xad128c2f,0x8c2fa4f2,0x8c2f83ce,0x8c2f8c2f,0x83ce7bad,0x83ce83ce,0x9cb18c2f,
-0x83ce83ee,0x8c0f8bef,0x9c719450,0x9c919471,0x83cf8bef,0x8bef83ef,0x8c108c0f,0x8c108c30,0x840f9470,0x8c3083ef,0x7bae8c30,0x7bae736d,0x7bae7b8d,0x738d7bae,0x6b4c736d,0x736d6b4c,0x736d6b4c,0x736d736d,0x7bae736d,0x7b8d7bae,0x736d736d,0x734d736d,0x7bad738d,0x7bad7bae,0x7b8e736d,0x7b8e83ae,0x7b6d736d,0x736d7b8d,0x7bae7b8d,0x7bae7b8d,0x7bae83ef,0x7bae738d,
-0x7b8d7bae,0x6b2c734c,0x7b8d734d,0x736d7b8d,0x7bae7b6d,0x83ce83ce,0x83ad83ae,0x83ae83ad,0x7b8d7b8d,0x7b8d7bae,0x7b8d736d,0x736c736d,0x734c738d,0x736c734c,0x736c734c,0x83ee83ce,0x83ce7bae,0x8c0f83ce,0x83ae83ef,0x6b0b732c,0x6b0b6b0b,0x6b0b6b0b,0x6b0b6b0b,0x736c734c,0x734c7b8d,0x736c734c,0x6b0b734c,0x6b2c6aeb,0x6b0b62eb,0x62eb6b0c,0x62eb6b0b,0x62cb62eb,
-0x62eb62aa,0x6b0c6b0b,0x6b0b6b0b,0x734c6b0b,0x7b6d7b8d,0x6aeb6b0c,0x6aeb734c,0x6aeb6aeb,0x62eb62eb,0x6b2c6b2c,0x6b2c6b2c,0x6b4c630b,0x62eb62eb,0x630b62eb,0x62eb6b4c,0x6b2c630b,0x736d738d,0x6b4c6b4c,0x7bce6b4c,0x7bad83ee,0x736c7b8d,0x7bad738d,0x6b4c6b6c,0x738d738d,0x6b4c6b4c,0x736c736d,0x6b4c6b4c,0x734c6b2c,0x6b4c736d,0x736d6b4c,0x7b8d7b8d,0x736d736d,
-0x6b4c736d,0x734c6b4c,0x6b4c6b6c,0x632b630b,0x630b632b,0x62eb630b,0x630b630b,0x630b630b,0x5acb630b,0x62eb62eb,0x62eb5aca,0x5aca5aca,0x5aca5acb,0x6b2c630b,0x630b630b,0x6b2c632c,0x736d6b2c,0x6b4c6b4c,0x6b2c6b2c,0x6b2c6b4c,0x736d734d,0x6b4c736d,0x6b4c6b2c,0x6b2c736d,0x6b6c6b2c,0x632c6b6d,0x630b630b,0x630b632b,0x6b4c6b4c,0x630b6b2c,0x630b6b2c,0x6b4c62eb,
-0x8c509cb2,0x94919471,0x8c508c30,0x83ce8c2f,0x949183ee,0x8c509cd2,0x8c2f83ce,0x83ee8c0f,0x9c919450,0x942f9c91,0xbd959c91,0x944fa4f2,0x9c919470,0x840e9c91,0xbdb59470,0x8c0fb574,0x94508c30,0x8c308c0f,0x94509471,0x8c309450,0x8c30840f,0x8c3083ce,0x840f8c30,0x8c2f83ef,0x840e840f,0x947083ee,0x944fb574,0x83ee8c2f,0x83ce8c0f,0x83ee8c2f,0x8c0f83ce,0x8c0f8c2f,
-0x83ce8bee,0x83ad83ae,0x94508bef,0x94719450,0x83ef9471,0x943083ef,0x94719471,0x83ef8c10,0x8c50840f,0x7bae83ef,0x83ef83ef,0x738d738d,0x83ce7bae,0x7bae7bce,0x738d7bae,0x736d6b6c,0x738d736d,0x736d738d,0x7b8e734c,0x7bae83ce,0x736d736d,0x734c734c,0x738d736d,0x7bae7b8d,0x736d7b8e,0x83ef7bae,0x7bae83ce,0x7bae7bae,0x8c0f83ce,0x736c7bce,0x840f83ee,0x7bae738d,
-0x7b8d7bae,0x734d734d,0x734c736d,0x7b8d734c,0x736d734c,0x83ce7b8d,0x83ad83ce,0x7b8d7b8d,0x734c7b6d,0x736d736d,0x6b2b734c,0x7bad6b2c,0x736c83ce,0x83ce734c,0x6b2b7bad,0x7b6d732c,0x83cf8bef,0x8c2f8bef,0x7b8d8c0f,0x6b2b6b2c,0x630b6b0b,0x6b4c6b2c,0x736c734c,0x734c6b4c,0x7b6c734c,0x7b6c7b6c,0x62ea732c,0x6b2b6b0b,0x6b0b6b0c,0x62cb62eb,0x6b0b6b2c,0x6b0b6b2c,
-0x62aa6aeb,0x62cb5a8a,0x7b6d6b0b,0x734d732c,0x7b8d736d,0x6b0c6b2c,0x6b0b8c0f,0x62ca6b0b,0x6b2c62eb,0x6b2c6b2c,0x62eb6b0c,0x630b630b,0x62eb630b,0x5aca5aaa,0x630b6b2c,0x6b2c6b2c,0x6b2b6b2c,0x6b4c6b2c,0x736c630b,0x7bae7bad,0x738d738d,0x738d738d,0x738d736c,0x738d738d,0x6b4c736d,0x6b4c6b4c,0x6b4c6b4c,0x6b2c6b2c,0x6b4c6b4c,0x734c734c,0x736d734c,0x738d736d,
-0x6b4c736d,0x6b2c6b4c,0x7bae736d,0x630b6b4c,0x630b630b,0x5aca5aeb,0x630b62eb,0x632b6b2c,0x5aaa5aca,0x62eb62eb,0x62eb62eb,0x6b2c630b,0x5aca62eb,0x62eb62eb,0x5aca5aca,0x6b2c632c,0x736d6b4c,0x6b4c734d,0x736d734d,0x7bae7bae,0x738d7bce,0x6b4c736d,0x632b6b2c,0x6b2c6b2c,0x6b6d736d,0x6b4c6b6c,0x632c6b4c,0x632b630b,0x6b4c6b2c,0x5aea632b,0x6b4c6b2c,0x6b2c62eb,
-0x94719cb2,0x9cd29cb2,0x8c3094b1,0x7bee83ef,0x840f7bae,0xa4f28c30,0x83ee8c30,0x83ee9450,0x94508c0f,0x8c2f9450,0xad13a4b2,0xa4f2bdb5,0x9c918c0f,0x9491a4b2,0x94508c0f,0xad54c5d6,0x83ef83ee,0x8c0f9c91,0x94718c50,0x83ef8c2f,0x83ef8c30,0x8c50840f,0x7bce7bce,0x8c3083ee,0x8c2f840e,0x83ee8c2f,0xd6589450,0x840ea512,0x8c0e8c2f,0x8c0e83ee,0x8c0e8c0f,0x8c0f840e,
-0x83ce83ee,0x7b8d7bad,0x8c0f8bef,0x83ce8bef,0x83ee8c2f,0x8c2f83ee,0x8c3083ef,0x7bce8c2f,0x83ee7bce,0x7bce840f,0x7bce738d,0x7bae83ef,0x738d738d,0x7bae73ad,0x736d7bae,0x736d738d,0x7bce73ad,0x738d738d,0x738d736c,0x7bce7bad,0x738d736d,0x6b2b736c,0x736d734c,0x736d734c,0x7bae7bae,0x7bce7bae,0x7bce83ce,0x7bae7bae,0x7bae7bae,0x736d7bad,0x83ef7bad,0x7bad83ce,
-0x738d738d,0x7bae7b8d,0x734c7bad,0x734c734c,0x7b8d736d,0x83ce7bae,0x83ce83ee,0x7b8d7bad,0x7bad7b8d,0x738d7b8d,0x6b4c738d,0x7b8d732c,0x83ae736c,0x8c0f83ee,0x736c8bef,0x736c7b6d,0x83cf734d,0x83ce8c10,0x6b0c736d,0x6b2c6b0b,0x6b2c6b0b,0x6b4c734c,0x6b0b6b2c,0x6b0b6b0b,0x83ad7b6d,0x736c8bee,0x732c734c,0x734c6b0b,0x62ca736d,0x62eb630b,0x6b4c6b2c,0x6b0b736d,
-0x5aaa62eb,0x7b8d62cb,0x736d6b0b,0x736d83cf,0x734d7b8d,0x736d62ca,0x734c736d,0x6b4c6b2c,0x62eb630b,0x6b0c6b0c,0x62eb62eb,0x62eb6b4c,0x62eb630b,0x62ca5aaa,0x734c734c,0x6b4c6b2c,0x630b6b2c,0x6b4c6b4c,0x7bae738d,0x73ad7bae,0x736d7bce,0x736d736d,0x7bad736d,0x7b8d7bad,0x736d736d,0x736d738d,0x6b2c736d,0x630b6b2c,0x6b2c630c,0x738d738d,0x7bae738d,0x7b8d738d,
-0x6b4c6b4c,0x632b6b2b,0x6b4c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x5aca5aaa,0x630b630b,0x630b630b,0x6b4c6b4c,0x6b4c6b4c,0x62eb6b4c,0x630b5aca,0x62eb630c,0x62eb5aca,0x5aea62eb,0x738d6b4c,0x83ce7bce,0x738d7bae,0x738d738d,0x7bae738d,0x738d738d,0x6b4c736d,0x630b6b2c,0x6b6d6b2c,0x6b6d6b6d,0x736d6b4c,0x630b632c,0x6b4c6b6c,0x630b632b,0x630b630b,0x6b6c630b,0x630b736d,
-0xa4f383ef,0x9491a4f3,0x94b194b1,0x840f83ef,0x7bae8c2f,0x947083ce,0x9cb1ad34,0x947083ee,0x83ee9430,0x9cb18c0f,0xa4b29cb1,0xa4d2a4d2,0x94709c91,0x9c919cb1,0x94309c91,0xbdb68c30,0x83cea513,0x94508c0f,0x8c508c30,0x8c2f9cb2,0x840f83ef,0x840f83ee,0x83ee83ef,0x8c2f7bee,0x94709450,0x83ee9470,0xad338c0e,0x840ece37,0x8c4f840e,0x8c2f9470,0x83cd83ee,0x83ee83ce,
-0x7bad8c0e,0x8bee83ce,0x83ee83ee,0x8c2f8c2f,0x83ee83ee,0x8c2f8c0f,0x94509470,0x7bce8c30,0x738d7bae,0x83ee7bce,0x8c307bee,0x9cd29491,0x6b4c738d,0x7bae6b4c,0x736d7bce,0x736c736d,0x7bee7bad,0x738d7bad,0x7b8d7b8d,0x736c734c,0x7bae83ce,0x6b2c736c,0x7b8e734c,0x7b8d7bae,0x7bce83ef,0x7bae7bae,0x7bae7bae,0x7bae7bae,0x7bae7bce,0x7bae7bae,0x8c5083ef,0x840f8c50,
-0x736d7bad,0x7b8d734c,0x736d7bad,0x734c734c,0x7b8d736d,0x7b8d7b8d,0x7bae7bae,0x7bae7bae,0x83ee8c2f,0x7b8d7b8d,0x738d7bae,0x736c734c,0x8c2f7b6d,0x7b8d8bef,0x7bae83ef,0x7b8d83ce,0x8c0f83cf,0x7b6d7bae,0x732c736d,0x732c734c,0x6b0b734d,0x6b2c62eb,0x6b2c6b2c,0x6b2c6b0c,0x734c734c,0x7b6c83ad,0x7b6c7b6c,0x734c734c,0x62eb6b2c,0x62eb6b2c,0x6b2c62eb,0x5aca6b2c,
-0x62eb630c,0x62eb62eb,0x83cf6b2c,0x736d7bae,0x6b4c736d,0x630b5aaa,0x6b4c734c,0x6b2c62eb,0x630c62eb,0x6b2c6b2c,0x62cb630b,0x62eb62eb,0x62eb630b,0x630b5aca,0x736c736c,0x6b4c6b4c,0x6b4c6b2c,0x738d6b2c,0x7bce738d,0x736d73ad,0x8c0f7bce,0x738d7bad,0x6b2c736c,0x738d736d,0x738d736d,0x736d736d,0x734d6b4c,0x6b2c6b4c,0x6b2c736d,0x736d6b4c,0x738d738d,0x7bce738d,
-0x6b4c7bad,0x6b4c6b2b,0x632b6b4c,0x6b2c630c,0x6b2c736d,0x6b4c630b,0x632b6b2c,0x62eb6b4c,0x736c6b2c,0x6b4c6b6c,0x630c6b2c,0x630b630b,0x62eb62eb,0x630b5acb,0x6b2c632b,0x738d738d,0x7bae7b8d,0x734c736d,0x6b4c736d,0x738d6b4c,0x738d738d,0x6b4d736d,0x632c6b4c,0x6b6d632c,0x6b4c632c,0x6b4c6b4c,0x632b630b,0x6b4c738d,0x632b632b,0x630b632b,0x6b4c630b,0x6b4c736d,
-0x840f8c30,0x94719cd2,0x9cb29470,0x8c2f9cb1,0x8c3083ee,0x83ee83ce,0xb5749470,0x8c0fa4d2,0x9c919cb1,0x9cb19450,0xa4f29cb1,0xad12ad12,0x9c91a4d2,0x94709c91,0xa4d29c91,0x94509450,0xad13ad33,0x840f83ce,0x94509cb1,0x9cb2ad34,0x83ee840f,0x8c2f840f,0x83ee7bce,0x840f840f,0x94708c2f,0x9cb1a4f2,0x8c0f8c2f,0xa513b574,0x83ee7bad,0x9cb19470,0x94509c91,0x840f8c0f,
-0x83ce83ee,0x8c0f83ce,0x8c2f9430,0x8c2f8c0f,0x8c2f83ce,0x840f8c50,0x840f8c30,0x8c308c2f,0x7bce8c50,0x738d738d,0x949183ef,0x842f9491,0x6b4c7bce,0x738d6b2c,0x736d7bae,0x736d736d,0x738d738d,0x738d7bad,0x7bad83ee,0x6b4c6b2b,0x738d7bae,0x736d734c,0x734d6b2c,0x7b8d83ce,0x83ef7bce,0x738d7bce,0x7bce738d,0x83ef83ef,0x8c0f83ce,0x738d7bce,0x840f840f,0x840f7bae,
-0x7b8e83ce,0x736d736d,0x7bad7bad,0x734c7b8d,0x736d732c,0x7b8d7b6d,0x7b8d7b8d,0x7bad7b8d,0x8c0f83ee,0x7bce83ef,0x7bce83ce,0x734c736c,0x8c0f7b8d,0x83ce83ce,0x8c0f8c0f,0x83ce83ce,0x83ce83cf,0x7bae7bae,0x736d7bae,0x6b0c6b0c,0x734c6b0b,0x6b0b6b2c,0x734c6b0b,0x734c736d,0x732b7b6c,0x736c7b8d,0x736c734c,0x734c736d,0x6b0b62eb,0x6b0b6b2c,0x734c6b0b,0x62eb734c,
-0x6b0b6b2c,0x5aaa5aaa,0x83cf736d,0x736d7bce,0x5aca6b2c,0x7b8d6b2c,0x630b6b4c,0x528962eb,0x62eb62eb,0x630b5aca,0x6b2c6b4c,0x62eb62eb,0x5aaa630b,0x6b0b5aaa,0x6b4c6b6c,0x738d6b4c,0x6b4c6b4c,0x6b4c6b2c,0x738d738d,0x736d7bae,0x7bae6b4c,0x736c83ef,0x736d6b4c,0x6b4c6b2b,0x6b4c6b4c,0x736d6b2c,0x736d734c,0x6b2c6b4c,0x6b4c736d,0x736d6b2c,0x738d738d,0x7bad738d,
-0x736c6b2b,0x7bae7bae,0x6b4c6b6c,0x632b6b4c,0x6b2c736d,0x6b4c6b2c,0x632b6b2c,0x6b2c6b4c,0x6b2c630b,0x6b2c6b4c,0x630c6b2c,0x5aca62eb,0x6b2c630c,0x6b4c6b2c,0x6b2c6b2c,0x738d736d,0x736d736d,0x734c736d,0x736d736d,0x738d736d,0x738d738d,0x6b4c736d,0x632c6b4c,0x6b4c632c,0x632c630b,0x632c632c,0x632c630b,0x6b2c738d,0x6b2c632b,0x630b6b2c,0x630b62eb,0x6b2c6b2c,
-0x840f8c0f,0x9cb183ee,0x8c2f8c50,0x9cb19471,0x8c2f8c50,0x83ce83ee,0xa4f283ee,0x9430bd95,0xa4d28c0f,0x8c0f9c91,0xad33a4b1,0xa4f2a4f2,0xad339cb1,0x9470a4d2,0xa4d29c91,0x83ce9cb1,0xb5548c0f,0x83eead33,0x9c9183ef,0x9cd2a513,0x7bce83ef,0x8c2f840f,0x7bce7bad,0x83ef840f,0x8c0f7bce,0x94919470,0x83ce8c0f,0x9cb183ee,0x7bad83ee,0x945083ee,0x840f9470,0x8c0f83ce,
-0x83ce736c,0x8bef83ee,0x83ee83ee,0x8c2f83ce,0x94709491,0x83ee83ef,0x840f83ce,0x83ef83ee,0x83ef8c2f,0x736d7bad,0x8c307bae,0x7bae8c30,0x738d7bae,0x738d738d,0x738d736d,0x736d738d,0x736c6b4c,0x738d7bce,0x7bce83ee,0x738d734c,0x736d736d,0x7bae738d,0x736d736d,0x7bae7b8e,0x83ef7bce,0x7bae83ce,0x7bae738d,0x8c3083ef,0x83ce8c30,0x7bce83ee,0x7bae7bad,0x736d7bad,
-0x83ef83ce,0x7b8d83ce,0x7bad7b8d,0x736d7bae,0x732c6b2c,0x736c734c,0x736d7b6d,0x736d734c,0x7bad7b8d,0x83ef7bce,0x7b8d83ef,0x7b8d734c,0x7b8d7bad,0x7bad7bad,0x83ae8bef,0x83ef8c2f,0x7b8d8c0f,0x7b8d7b8e,0x736d7b6d,0x732c6aeb,0x6b2c6b0b,0x736d736d,0x734c734c,0x7bae736d,0x7b4c7b8d,0x734c7b6d,0x732c732c,0x734c732c,0x6b2c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x6b0b6b0c,
-0x62cb62ca,0x734c62cb,0x7b8d7bae,0x736d7bae,0x62eb6b2c,0x7bae7b8d,0x6b2c736d,0x6b0c630b,0x630b630b,0x630b5aaa,0x6b0c6b2c,0x5aca62cb,0x62eb6b0b,0x734c630b,0x738d738d,0x7bad7bad,0x738d736d,0x6b4c736d,0x6b2c736d,0x6b4c736d,0x6b4c630b,0x7bae7b8d,0x736d738d,0x6b2c738d,0x6b2c736d,0x736d6b2c,0x736d7bce,0x736d736d,0x736d6b4c,0x6b6c6b4c,0x736d736d,0x736d738d,
-0x6b2b736c,0x736d734c,0x6b2c6b4c,0x630b6b2c,0x630b62eb,0x630b62eb,0x630b630b,0x6b6c6b2c,0x6b4c6b4c,0x6b4c6b4c,0x6b2c6b4c,0x62eb630b,0x6b2c6b2c,0x6b2c6b2c,0x62eb62eb,0x6b4c6b2c,0x738d738d,0x736d736d,0x738d738d,0x6b4c736d,0x73ad73ad,0x6b4d736d,0x6b2c6b4c,0x6b4c6b2c,0x630b630b,0x632c630b,0x630b630b,0x630b6b4c,0x6b2c6b2c,0x630b632b,0x62eb630b,0x62eb5aca,
-0x83ef9471,0x83ce840f,0x8c309450,0x94708c2f,0x8c2fa4d2,0x8c2f7bce,0x9cb183ee,0xacf3ad33,0x94509c90,0x9c70a4d2,0xad13944f,0xb554b554,0xad33ad13,0x9cb1b554,0x94709470,0x94919c91,0x8c0f7bad,0xad33b554,0x7b8d7bad,0x8c509470,0x7bce7bce,0x7bee83ee,0x7bce7bee,0x840f7bee,0x83ee840e,0x83ee83ce,0x7bad83ee,0x83ce83ce,0x83ce8c0f,0x7bad7bad,0x736c7bad,0x8c0f7bad,
-0x83ce83ce,0x83ee83ce,0x83ee7bad,0x8c0f8c0f,0x83ee8c50,0x83ef7bae,0x83ef83ee,0x83ce83ce,0x736d738d,0x736d736c,0x6b4c6b6c,0x7bae738d,0x738d6b4c,0x738d7bae,0x734d6b2c,0x736d736d,0x738d736d,0x738d83ef,0x7bae736d,0x736d738d,0x736d736d,0x738d736d,0x83ce7bae,0x7b8e7b8d,0x7bce83ef,0x83ee7bce,0x7b8d7bce,0x8c0f7bae,0x7bce8c2f,0x83ee83ce,0x840f83ee,0x7bce840f,
-0x8c0f83cf,0x7bae83ef,0x736d7b6d,0x7b6d7b8d,0x732c734d,0x732c6b0c,0x732c734d,0x736d732c,0x736d7b8d,0x7bad736d,0x736d7bae,0x734c734c,0x7b8d734c,0x83ce7bad,0x8c0f83ce,0x8bef8c30,0x83ce8c30,0x734c7b6d,0x734d734c,0x732c734c,0x734c6b2c,0x736d734d,0x736d7b8d,0x7b8d7b8d,0x7b6d7b6c,0x736c7b6d,0x734c736d,0x6b2b6b0b,0x6b2c6b4c,0x736d6b2c,0x6b0b736c,0x736d6b0b,
-0x732c7b8d,0x6b2b6b2c,0x83ce7b8d,0x7bae734c,0x630b6b4c,0x736d738d,0x630c6b2c,0x6b2c630b,0x62eb62eb,0x630b5aca,0x5aca62cb,0x630b62eb,0x6b2c62eb,0x736d736d,0x7bce738d,0x630b7bad,0x736d6b4c,0x736d736d,0x736d6b4c,0x6b6c6b2c,0x6b2c736d,0x7bae6b4c,0x6b4c7b8d,0x736c736c,0x6b4c738d,0x738d6b4c,0x736d7bce,0x738d736d,0x738d6b4c,0x6b4c736d,0x6b4c6b2c,0x736d738d,
-0x6b4c6b2c,0x6b2c738d,0x6b4c630b,0x5aca6b2c,0x62eb5aca,0x630b630b,0x630b630b,0x6b2c630b,0x6b2b6b4c,0x632b630b,0x6b2c6b2c,0x630b6b2c,0x5acb630c,0x62eb5aca,0x630b62eb,0x6b4c6b2c,0x736c736c,0x738d736d,0x7bae738d,0x738d73ad,0x738d736d,0x6b4c736d,0x6b2c6b4c,0x6b4c6b2c,0x630b632c,0x630b630b,0x630b630b,0x630b630b,0x630b632b,0x62eb62eb,0x62eb630b,0x5aca5aca,
-0x9450a4d2,0x7bae8c30,0x9cd27bad,0x840e9470,0x94709450,0x83ce9470,0x94508c2f,0xad13c5b5,0xa4f2bd95,0x9cb19470,0x9cb1942f,0xbd95bd95,0xad13b574,0xad13b574,0x9450a4d2,0x9cb19470,0x8bef9c71,0xb5748c0f,0x7badb574,0x840f738d,0x83ee83ef,0x83ee83ee,0x840f840f,0x840f840f,0x83ee9450,0x8c0f83ce,0x83ce8c0f,0x83ee8c0f,0x83ee83ce,0x7bad83ce,0x83ce7b8d,0x8c0f83ee,
-0x83ee9450,0x83ce7bad,0x8c2f83ee,0x83ee8c0f,0x7b8d7bad,0x83ef83ee,0x7bce83ef,0x83ef83ee,0x7bad83ee,0x7bae7b8d,0x6b4c738d,0x738d6b4c,0x738d736d,0x738d7bae,0x6b2c6b0c,0x7bae734d,0x736d73ad,0x738d7bae,0x6b4c6b2c,0x736d734c,0x736d736d,0x6b2c736d,0x83cf7b8d,0x7bae7b8e,0x7bae7bce,0x7bae7bad,0x83ee7bce,0x83ce83ee,0x840f7bad,0x7bae83ee,0x83ef840f,0x8c2f7bad,
-0x83ce83ef,0x7bae7bae,0x734d7b8d,0x7b6d736d,0x732c734d,0x734c6b2c,0x6b2c734d,0x734d6b0c,0x7bae736d,0x736c7bad,0x736d736c,0x6aeb734c,0x734c62ea,0x7b8d7bad,0x83ef8c0f,0x83ce8bef,0x8c1083ef,0x736d7b8e,0x732c734c,0x6b0c7b8e,0x734c6b2c,0x734c734c,0x7b8d736d,0x734c7b8d,0x7b6d736d,0x736c734c,0x7bad7b8d,0x6b4c734c,0x6b2b6b2c,0x7bad734c,0x6b0b7b8d,0x8c0f736c,
-0x9c919471,0x62ea7bad,0x83ee7b8d,0x7b8d6b2c,0x6b2b736d,0x7bce83ef,0x630b6b2c,0x62eb630b,0x5acb62eb,0x630b5aca,0x62eb62eb,0x6b2c6b2c,0x6b4c6b2c,0x7b8d738d,0x7bce7bad,0x6b2b7bad,0x632b6b2c,0x632b6b2c,0x736d6b4c,0x736d6b2c,0x736d7bae,0x6b2c6b4c,0x7bce7bad,0x6b4c6b4c,0x738d7b8d,0x738d6b4c,0x734c736d,0x736d6b4c,0x736d6b6c,0x736d736d,0x6b2c6b4c,0x6b4c6b4c,
-0x6b0b6b2c,0x7bad738d,0x630b6b4c,0x6b4c630b,0x630b6b2c,0x6b2c6b2c,0x630b62eb,0x6b2c6b4c,0x6b2c6b4c,0x6b2c6b2c,0x6b4c6b2c,0x62eb6b2c,0x5acb62eb,0x630b62eb,0x632b630b,0x6b4c6b2c,0x6b4c6b4c,0x736d6b4c,0x7bce738d,0x73ad7bce,0x6b6c6b4c,0x6b4c6b4c,0x6b4c6b4c,0x6b2c6b2c,0x632c632c,0x5aca630b,0x62eb5aca,0x62eb630b,0x5aca62eb,0x5aca5aaa,0x62eb5aca,0x5aca62eb,
-0xa4f39470,0x83ee9470,0x83ee83ee,0x94509cb1,0x9470840f,0x8c2f944f,0x8c0f83ce,0xad13bd74,0xbd94a4f2,0x942f9470,0x9c90a4d1,0xa4f29490,0xad53ad12,0xad33ad33,0x9c91b574,0xa4d28c2f,0x9c91a4d2,0x8c2f8c0f,0xb574bd95,0x8c0f83ce,0x83ef840f,0x840f840f,0x842f840f,0x8c308c50,0x83ef8c50,0x8c0f83ef,0x8c3083ee,0x83ef83ef,0x83ef83ef,0x7bad83ce,0x83ee7bae,0x83ee83ef,
-0x8c2f8c2f,0x7bad83ee,0x83ee83ee,0x83ee83ee,0x83ee840f,0x7bae7bce,0x83ee840f,0x7bad7bce,0x7bce7bad,0x7bce7bee,0x6b4c738d,0x738d6b4c,0x7bae7bce,0x7bae7bcf,0x736d6b4d,0x7bce738d,0x736d7bae,0x738d736d,0x736d738d,0x738d736d,0x7bae7bae,0x734c738d,0x7bae736d,0x840f83ce,0x7bcd7bad,0x736d7b8d,0x8c2f7bae,0x7bce8c2f,0x7bce7bae,0x83ce840f,0x7b8d7bad,0x7bae7b8d,
-0x7b8e7bae,0x7b8d7b6d,0x736d7b8d,0x734c736d,0x732c6b0b,0x734d734d,0x6b2c734c,0x736d6b2c,0x736d736d,0x7bad7b8d,0x6b2c736c,0x734c6b2b,0x6b2b6b0b,0x734c6b2b,0x7bad7b8d,0x83ce7b8d,0x7bae83ce,0x734c734d,0x6b0b6b0b,0x6b2c734d,0x6b0c734c,0x736d6b2c,0x6b2c736d,0x7b8d734c,0x7b8d7b8d,0x7b8d736c,0x83ce7bad,0x734c7b8d,0x6b2c736c,0x736c734c,0x6b2b7b6d,0x947083ce,
-0xa4d28c0f,0x736c8c30,0x736c7bce,0x6b0b62eb,0x6b4c62eb,0x6b4c738d,0x62eb6b2c,0x632c5aca,0x630b630b,0x62eb62eb,0x630b6b2c,0x6b2c6b2c,0x6b4c734c,0x736d6b6c,0x73ad738d,0x6b6c738d,0x6b4c738d,0x630b6b2c,0x632b736d,0x736d6b2c,0x7bce736d,0x6b4c736d,0x83ef7bae,0x736c83ef,0x7bad738d,0x7bad738c,0x6b4c736c,0x738d734c,0x736d738d,0x738d736d,0x6b2c736d,0x6b2c630b,
-0x630b6b4c,0x630b6b2b,0x6b4c630b,0x736d6b2c,0x6b2c738d,0x6b4c6b4c,0x632b630b,0x6b4c6b4c,0x6b2b6b4c,0x6b2c6b2c,0x6b2c6b0c,0x5aca630b,0x62eb62cb,0x6b2c6b2c,0x62eb62eb,0x6b2c630b,0x6b4c6b4c,0x6b4c6b4c,0x738d6b4c,0x736c738d,0x738d738d,0x6b6c6b6c,0x738d738d,0x6b2c6b4c,0x632c632c,0x5aca630b,0x5aeb5aca,0x5aeb5aca,0x5aaa5aca,0x5aca5aca,0x5aca5aaa,0x5aca62eb,
-0x8c509450,0x94919cb1,0x83ce8c2f,0x9c917bad,0x8c2f9491,0x944f8c0f,0x83cd83ee,0xb5539450,0x9cb19cb1,0xa4d1bdb5,0xa4d19cb1,0x94709470,0xad12a512,0xa4f2b553,0xb595ad33,0x8c509cb1,0x94709cb1,0x83ee9c91,0xbd958c0f,0x8c0fb554,0x8c0f7bad,0x7bad840f,0x842f840f,0x9cb28c70,0x83ce8c0f,0x8c308c0f,0x7bae7bae,0x83ef840f,0x7bad83ef,0x83ee7bad,0x7bad83ee,0x83ce7bad,
-0x8c2f9450,0x7bad8c0f,0x83ee7bad,0x7bce8c2f,0x8c2f83ef,0x7bae7bce,0x840f83ee,0x840f7bce,0x7bad738d,0x7bce7bce,0x738d7bce,0x736d736d,0x738d738d,0x7bae7bae,0x7bae738e,0x738d738d,0x7bee7bae,0x7bae738d,0x8c307bee,0x7bce840f,0x7bae83ce,0x7bae738d,0x736d736d,0x8c2f83ef,0x7bce83ee,0x738d7bad,0x83ee7bae,0x83ef83ef,0x83ee83ef,0x7bce83ee,0x83ef83ce,0x7bae7bce,
-0x7b6d734c,0x734d734d,0x7b8d736d,0x732c7b6d,0x732c62cb,0x732c734d,0x6b0c6b0c,0x7b8d732c,0x736d736d,0x736d738d,0x734c734c,0x7b8d736c,0x6b0b734c,0x7b6d734c,0x83ce7bad,0x7bae83ef,0x62eb7bae,0x62eb62eb,0x6b0b62eb,0x62eb5aaa,0x6b2c6b2c,0x736d734c,0x736d736d,0x7b8d736d,0x7bad7b8d,0x83ce7bae,0x83ce7bae,0x6b2c7bad,0x6b4c7b8d,0x734c6b2b,0x7bad7b8d,0xa4f29c91,
-0x83ce83ce,0x734c8bef,0x736c7bce,0x62ca5aa9,0x6b2b62eb,0x6b4c6b4c,0x62eb630c,0x5aca5aca,0x630c5aca,0x62eb630b,0x630c6b4c,0x6b4c6b2c,0x738d6b4c,0x736d73ad,0x7bce736d,0x6b2c7bad,0x738d738d,0x738d6b4c,0x6b4c738d,0x7bce736d,0x736d6b4c,0x7b8d7bce,0x7b8d6b4c,0x83ce7bce,0x6b4c6b4c,0x738d736c,0x6b2b738d,0x7b8d736d,0x738d7bce,0x736d738d,0x6b4d736d,0x6b2c630b,
-0x630b6b4c,0x62eb6b0b,0x6b4c630b,0x738d6b4c,0x6b4c738d,0x6b4c6b4c,0x6b2c6b6c,0x736d630b,0x736c7bce,0x6b4c6b4c,0x630b6b2c,0x630b630b,0x62eb62eb,0x6b2c6b4c,0x6b2c630b,0x6b2c6b2c,0x6b4c736c,0x6b6c6b4c,0x7bae736c,0x7bce7bee,0x738d7bad,0x6b4c6b4c,0x738d738d,0x6b2b6b6c,0x630b6b4c,0x630b630b,0x5aca62eb,0x5aca5289,0x5aea5aca,0x62eb630b,0x5aca5aaa,0x5aca62eb,
-0x94709cd2,0x94509470,0x7bad83ee,0x945083ae,0x9450a4d2,0x944f83ee,0x83ce9470,0xad1383ce,0x9cb19470,0xbdb5ad12,0x94909cb1,0x83ee944f,0xad339490,0xa512ad33,0xad13a513,0x9450b574,0x944f944f,0x942f9450,0x8c0f83ee,0xad54a4d2,0x8c2f7bae,0x7bad8c2f,0x8c507bce,0x9491840f,0x8c0f8c50,0x947083ef,0x7bae83ef,0x83ef83ce,0x83ef8c2f,0x7bad83ce,0x83ce83ef,0xc5d69470,
-0x7bad9cd1,0x83ee7bce,0x738d738d,0x7bad7bce,0x7bce738d,0x7bee83ee,0x83ee7bce,0x7bce83ef,0x7bad7bce,0x7bae7bce,0x7bae7bae,0x736d7bce,0x738d738e,0x736d736d,0x738e738e,0x83ef7bae,0x7bae83ef,0x6b4d738d,0x83ef736d,0x7bae83ef,0x7b8e83cf,0x7bce6b4c,0x7bad7bad,0x8c507bce,0x738d7bce,0x7bce7bce,0x7bce7bae,0x83ef840f,0x7bce8c0f,0x83ce7b8d,0x8c2f9470,0x7bce83ce,
-0x7b8d7b8d,0x734d7b8d,0x734c734c,0x6b2c7b6d,0x732c6aeb,0x734c732c,0x6aeb6b2c,0x6b2c6b2c,0x738d6b2c,0x7bce840f,0x6b4c734c,0x83ce7b8d,0x734c7b8d,0x734c736c,0x734c7b6d,0x736c7b8d,0x6b2b6b0b,0x62ea6b2b,0x6b2b62eb,0x6b2b6b0b,0x6b2b6b4c,0x7bae736d,0x83ce738d,0x736d7bad,0x734c7b8d,0x62eb6b0b,0x7bad62eb,0x6b0b7b8d,0x736d62ca,0x7bad734c,0x62ca6b2b,0x9cb18c0f,
-0x6b2b8c0f,0x6aeb6aeb,0x6b0b8c0f,0x62ca5aa9,0x736c6b2c,0x6b4c6b6c,0x630b630b,0x5aeb5aeb,0x630b630b,0x5aca630b,0x5aca5aca,0x6b4c5aaa,0x7b8d734c,0x736d7bae,0x7bae736d,0x7bae7bce,0x7bae7bae,0x6b2c6b4c,0x736d738d,0x7bae6b4c,0x736d736d,0x738d7bce,0x738d7bce,0x7bce7bee,0x6b4c736d,0x6b2b6b4c,0x738d738d,0x6b4c7bae,0x6b4c6b4c,0x6b4c736d,0x6b4c6b0c,0x630b630b,
-0x6b0b6b2c,0x62eb62ca,0x6b4c6b2c,0x734c734c,0x6b2b6b2b,0x6b6c736d,0x738d736c,0x7bae83ee,0x6b4c7bae,0x738d632b,0x6b4d7bae,0x630b6b2c,0x62eb630b,0x6b2c62eb,0x630b630b,0x736d630b,0x632b6b6c,0x6b4c738d,0x7bad6b2c,0x7bae738d,0x6b2c738d,0x7bce738d,0x6b4c738d,0x6b2c6b4c,0x632c632c,0x630b5aca,0x6b4c6b4c,0x6b6d6b6d,0x736d6b2c,0x630b738d,0x5aaa5aaa,0x5289630b,
-0x9cd2ad33,0x83ee8c50,0x83ee83ce,0x83ee8c0f,0x9c917bad,0x7bad9450,0xa4d28c2f,0xa4f28c0f,0xa4d18c0e,0xad339cb1,0x9470c5f6,0x94909490,0x8c4f840e,0xad53a4d2,0xa4d2a4d2,0xad339cb1,0x8c0f9c70,0x942f9450,0x8bef8c0f,0xad338c0f,0x840fa4f2,0x94919471,0x840f8c70,0x840f83ef,0x83ef9450,0x8c307bce,0x7bae8c2f,0x840f83ce,0x94718c30,0x83ce8c30,0xb5549cb2,0x8c0f9cd2,
-0x7bad738d,0x7bad83ee,0x7bad736c,0x840f83ee,0x7bae7b8d,0x7bce7bce,0x738d7bce,0x7bae738d,0x7bce7bae,0x73ad840f,0x7bae736d,0x738d7bef,0x738d6b4d,0x736d736d,0x736d738d,0x83ef738d,0x736d7bce,0x736d736d,0x736d6b4c,0x7b8e736d,0x6b2c738d,0x8c0f6b4c,0x7bce7bce,0x7bce7bce,0x7bad840f,0x7bae738d,0x7bce840f,0x7bce7bad,0x840f8c50,0x7b8d7bad,0x840f83ef,0x7bae7bce,
-0x7b8e83cf,0x7b6d736d,0x6b2c734d,0x734d736d,0x6aeb732c,0x6b2c62eb,0x6b0c734c,0x6b0b6aeb,0x738d6b2c,0x7bae83ef,0x6b2b6b4c,0x7b8d734c,0x7b8d7b6d,0x734c7b8d,0x6b0b6b2b,0x6b0b6b2b,0x6b0b6b2b,0x6b2b6b2c,0x62ea6b0b,0x6b0b62ca,0x736c734c,0x8c0f83ee,0x736d7b8d,0x736d734c,0x7b8d736d,0x6b2c7b8d,0x6b2c6b2c,0x6b0b6b4c,0x734c736d,0x736c734c,0x736c6b2b,0x7bad83ce,
-0x734c7bad,0x7b8d6b2b,0x6b2b8c2f,0x734c630b,0x738d738d,0x6b2c6b4c,0x630b630b,0x52aa5acb,0x5aaa5aca,0x630c62eb,0x630b630b,0x736d6b2c,0x736d7bae,0x7bae736d,0x73ad7bce,0x7bae738d,0x6b2c738d,0x736d6b2c,0x7bce7bae,0x736d7bae,0x736d6b4c,0x7bae738d,0x738d73ad,0x736d738d,0x73ad7bce,0x736c738d,0x736c738d,0x6b4c738d,0x736d6b2c,0x6b2c6b4c,0x6b2c6b4c,0x630b5aca,
-0x62eb5aaa,0x6b2c62eb,0x734c6b4c,0x6b2c734c,0x6b4c6b4c,0x738d738d,0x736d738d,0x738d738d,0x6b2c736c,0x738d6b4c,0x6b2c736d,0x6b2c6b2c,0x630c6b4c,0x630b62eb,0x6b2c630b,0x6b4c632b,0x6b4c6b4c,0x736d736c,0x6b4c6b4c,0x736c736d,0x6b2b6b4c,0x7bad738d,0x6b2b736c,0x6b4c6b2b,0x6b4c6b6d,0x632c632c,0x6b6d6b4c,0x73ae738d,0x630b6b4c,0x630b6b4c,0x6b4c630b,0x6b4c738d,
-0xa4f29471,0x8c2f9cb1,0x83ee83ee,0x83ce8c2f,0x8bef736c,0x8c0e9cb1,0x8c0f83ce,0x94709c91,0x8c4f9cb1,0xad129cb1,0xbdb5ad12,0x83cd9470,0x7bad83ee,0xa4d283ee,0xa4d29cb1,0xa4d29cb1,0x9cb1bd95,0x9450944f,0x8c2f8c50,0x7bad840f,0x9cb19cb2,0x8c0f6b2c,0x8c309c91,0x8c3083ee,0x840f83ef,0x94719cb1,0x8c0f9471,0x83ef83ef,0x947083ef,0x94509c91,0x83ef8c0f,0x83ef7bae,
-0x83ee7bcd,0x840f8c50,0x738d738d,0x840f83ee,0x840f8c2f,0x7bae7bce,0x7bae7bce,0x7bce7bae,0x7bae7bce,0x738d7bae,0x738d736d,0x738d73ae,0x7bce736d,0x738e73ae,0x738e7bce,0x840f738d,0x6b4d7bae,0x6b4d6b2c,0x6b2c6b2c,0x6b2c630c,0x736d7bae,0x83ef736d,0x7bce7bad,0x7bad83ee,0x83ee738d,0x7bad8c0f,0x7bae736d,0x7bce840f,0x83ee7bce,0x738d7bae,0x7bae7bad,0x83ce7bae,
-0x83ce83ef,0x7b8d7bad,0x732c734c,0x6b0c732c,0x62eb6b2c,0x62ca62eb,0x734d6b0b,0x6b0c6b2c,0x6b4c6b2c,0x6b4c734c,0x734c6b4c,0x7b8d736c,0x83ce7bad,0x7bad83ae,0x736c6b2b,0x7b8d736c,0x736c83ce,0x734c734c,0x62eb6b2c,0x6b0b62ca,0x738d6b4c,0x83ef83ee,0x7b8d7b8d,0x6b2b734c,0x7bae732c,0x734c738d,0x6b2b736d,0x734c6b0c,0x6b2c6b2c,0x6b2b6b2c,0x6aeb6b0b,0x6b0b62ea,
-0x6b2c734c,0x736c62ca,0x6b0b7b8d,0x736c6b2b,0x738d736d,0x6b4c736d,0x6b2c6b2c,0x62eb630c,0x62eb630c,0x6b0c62eb,0x630b62eb,0x734c736d,0x736d736d,0x736d738d,0x6b4c6b4c,0x6b2c6b4c,0x736c734c,0x738d736c,0x7bae7bae,0x736d738d,0x738d73ad,0x7bce738d,0x7bae73ad,0x736d736d,0x8c506b4c,0x83ee83ef,0x6b4c736d,0x6b4c6b4c,0x736d6b4c,0x6b4c736d,0x62cb6b2c,0x5aca5aca,
-0x5aca630b,0x630b5289,0x736c736c,0x6b4c736c,0x7bad7bce,0x736d736d,0x736d738d,0x6b4c6b4c,0x6b6c736c,0x6b6c6b4c,0x630b6b2c,0x6b2c6b2c,0x630b630b,0x6b2c62eb,0x6b4c6b2c,0x6b4c6b2c,0x736d6b6c,0x738d6b4c,0x6b4c738d,0x736c738d,0x6b2c736c,0x738d6b4c,0x738d73ad,0x6b6c6b6c,0x6b4c6b6d,0x6b4c6b6d,0x6b4c6b2c,0x6b4c6b4c,0x630b6b4c,0x62eb6b4c,0x6b4c62eb,0x736d6b6c,
-0x9cb18c30,0x8c509491,0x8c0f8c0f,0x94509450,0x8c0f83ce,0x9470942f,0x734c83ce,0x94507bad,0x9470a512,0x9cd18c2f,0x9c909cb1,0x83cd9470,0x8c2f83ce,0x7bcd7bad,0xa4f29c91,0x9cb19cd2,0xb5749cb1,0x83eea4d1,0x83ee83ee,0x7b8d83ce,0xa4d27bad,0x736c840f,0x840f7bae,0x83ee83ce,0x8c3083ce,0xa4f28c50,0x8c0f9450,0x83ce83ef,0x83ef83ef,0x9c918c30,0x83ce8c50,0x7bce736d,
-0x94918c2f,0x840f9cd2,0x738d6b6c,0x840f842f,0x8c508c30,0x738d7bee,0x83ef7bce,0x83ef83ef,0x738e7bce,0x738e738e,0x738d738d,0x738d738e,0x738e6b6d,0x6b6d736d,0x738d738d,0x7bae736d,0x738d738d,0x6b4d736d,0x6b4d6b2c,0x6b2c6b4d,0x83ef736d,0x83ef83ef,0x83ef7bce,0x738c7bce,0x736c6b2c,0x83ee83ee,0x83ee83ce,0x736c83ee,0x7bce738d,0x83ee83ce,0x7b8d7bce,0x83ef7b8d,
-0x83ef83ef,0x7b8d7bae,0x732c734c,0x62eb6b0c,0x6b2c6aeb,0x62aa6b2c,0x736d62ca,0x7b8d7b8e,0x6b4c6b0b,0x6b2c736d,0x6b2b6b2b,0x83ee736c,0x83ee83ce,0x7bad83ae,0x734c6b2b,0x734c734c,0x6b0b7b8d,0x6b0b62eb,0x630b6b2b,0x630b62ea,0x7bce734c,0x83ef8c0f,0x736c7b8d,0x6b0b6b2c,0x83ce83ce,0x736c6b0b,0x734c736d,0x6b2c6b0b,0x734c630b,0x6b2b6b0b,0x6b0b736c,0x6b2b62ea,
-0x6b0b6b0b,0x734c62eb,0x6b2b734c,0x6b2c6b2c,0x738d6b4c,0x6b4c738d,0x630b630b,0x62eb62eb,0x630b62eb,0x630b630b,0x6b2c62eb,0x6b2c7b8d,0x6b4c736d,0x736d736d,0x6b2c6b2c,0x6b6c736d,0x6b4c6b2c,0x734c6b4c,0x7bce7bae,0x7bae7bae,0x738d7bae,0x7bae736d,0x738d736d,0x738d736d,0x8c3083ee,0x7bcea4f2,0x6b4c73ad,0x738d738d,0x6b4c734d,0x738d736d,0x62eb736d,0x5aca630b,
-0x62ca5aca,0x738d6b0b,0x738d7bad,0x8c2f83ce,0x83ee83ef,0x6b4c736c,0x738d6b6c,0x6b4c6b4c,0x736d6b4c,0x6b2c6b6c,0x630b630b,0x630b6b2c,0x630b62eb,0x6b2c630c,0x6b4c6b2c,0x6b2c6b2c,0x6b4c6b4c,0x6b4c6b2c,0x6b4c6b4c,0x6b4c6b4c,0x6b4c6b2c,0x6b4c6b6c,0x738d738d,0x738d736c,0x6b6d738d,0x736d738d,0x6b4c6b4c,0x632c632c,0x630b630b,0x630b6b4c,0x6b2c62eb,0x6b2c6b4c,
-0x840f8c50,0x83ee83ef,0x7bce83ce,0x945083ce,0x8c0f9450,0x83ae9450,0x7b8d9450,0x8c0f734b,0x9c90b574,0x840e9470,0x9cb19cb1,0xa5129cd1,0x8c4f8c2f,0x7bad8c2f,0x94707bce,0xa4f29cb1,0xad339491,0x8c2fad33,0x9cb18c2f,0x8c0f8c50,0x94508c0f,0x94708c2f,0x83ee7bad,0x83ef9cb1,0xa4d28c2f,0xef5c9450,0x9c91b574,0xa4d29470,0x83ce83ee,0x945083ee,0x8c509470,0x734c7b8d,
-0x83ee7bce,0x738d7bad,0x7bce7bad,0x9491840f,0x8c50840f,0x7bce8c30,0x83ef7bce,0x83ef83ef,0x738e736d,0x738e7bae,0x6b6d6b6d,0x6b6d736d,0x738d738e,0x738d738d,0x738d738d,0x738d738d,0x738d6b4d,0x736d738d,0x6b2c630c,0x736e6b4d,0x83ef736d,0x7bce83ef,0x83ce7bae,0x83ee83ee,0x7bae7bce,0x83ef7bae,0x8c309471,0x83ef83ef,0x7bce7bce,0x83ee83ce,0x738d83ee,0x738d736c,
-0x8c2f9450,0x83ce83ae,0x7b8d7bae,0x7b8d736d,0x7b8d734c,0x734c736d,0x6b0b6b0b,0x7bae736d,0x6b4c6b2c,0x6b2c6b4c,0x736c734c,0x83ef7b8d,0x83ce83ce,0x8bef8bef,0x736c7bad,0x6b0b732c,0x62ea62eb,0x6b4c6b2c,0x6b2b6b2c,0x62ea62eb,0x736d6b4c,0x7bae7bad,0x6b0b736d,0x734c6b0b,0x9471a4f3,0x7b8d734c,0x736d7b8d,0x6b2c734c,0x7b8d734d,0x734c736d,0x734c734c,0x734c736c,
-0x734c734c,0x7b8e736d,0x738d7bad,0x7bae738d,0x738d738d,0x6b4c736d,0x630b630b,0x62eb62eb,0x6b0b62eb,0x62eb62eb,0x630b62eb,0x736d736d,0x6b0b734d,0x6b2c6b2c,0x6b4c6b2c,0x6b4c736d,0x630b6b0b,0x738d734c,0x738d6b4c,0x7bae83ef,0x6b4c736d,0x738d6b4c,0x6b6c736d,0x738d736d,0x9471840f,0x9cd29cf2,0x6b4c7bae,0x7bae7bae,0x6b4c734d,0x5aca62eb,0x62cb6b2c,0x62eb62eb,
-0x6b2c5aaa,0x840f7bae,0x83ef840f,0x7bad83ef,0x7bad738c,0x736c736d,0x736d6b6c,0x7bad6b6c,0x738d6b4c,0x736d738d,0x630b6b2c,0x630b6b2c,0x62eb630b,0x630b62eb,0x6b4c6b4c,0x6b2c6b4c,0x738d6b6c,0x6b6d736d,0x630b6b4c,0x6b4c6b2c,0x6b6c6b2c,0x6b4c6b6c,0x7bad736d,0x6b6c736c,0x736d738d,0x6b6d6b6d,0x6b2c6b4c,0x632c6b6d,0x630c630b,0x630c6b2c,0x6b2c630b,0x630b6b2c,
-0x8c309cd2,0x840f83ef,0x8c2f9450,0x8c2f83ce,0x94509450,0x83ee8c0f,0x8c0f83ee,0x7bad7bad,0xad33ce37,0x9cb19cd1,0x9c909490,0xa4d19470,0x9cb1ad53,0x8c4f8c2f,0x840e83ee,0x9cb28c50,0x9cb1a4d2,0xad33b554,0x8c2f9450,0x8c0f8c50,0x94708c2f,0xad337b8d,0x83cea4f2,0x94508c0f,0x94509450,0xbdb583ce,0xad33a513,0x8c0f9cb1,0x94509470,0x8c2f8c2f,0x94708c50,0x7bcd840f,
-0x8c3083ee,0x83ee840f,0x83ef7bce,0x738d7bee,0x8c508c50,0x840f8c50,0x7bce7bce,0x7bae7bce,0x736d736d,0x736d736d,0x6b6d6b6d,0x6b6d6b4d,0x6b4d6b6d,0x738d736d,0x6b4c6b4c,0x736d738d,0x736d738e,0x7bae6b4d,0x630c6b4d,0x738e6b2c,0x7b8e734d,0x8c3083ef,0x7bce83ef,0x7bce83ee,0x7bae738d,0x83ef83ef,0x8c308c30,0x738d83ce,0x83ce7bce,0x7bae7bce,0x7bad83ee,0x738d738d,
-0x83ee83ce,0x7b8d7b8d,0x7b8d7b8d,0x734c736c,0x7b8e736d,0x7b8e7b8d,0x6b0b736d,0x6b4c6b4c,0x6b2c738d,0x630b62eb,0x7bad736c,0x83ce7bae,0x7bad7bad,0x83ee83ee,0x7b8d83ce,0x736c7b8d,0x6b2b6b2b,0x738d738d,0x734c736c,0x62ea6b2b,0x6b2c62eb,0x6b4c6b4c,0x6b4c736c,0x7b8d736c,0x9c91ad33,0x7b8d83ef,0x6b2c7b8d,0x736d7b8d,0x734d734c,0x6b0c736d,0x6b2c6b0b,0x7b8d6b2b,
-0x6b2c736d,0x734d734c,0x7b8d7bad,0x83ef7bae,0x7b8d7bae,0x736d736d,0x630b630b,0x6b2c62eb,0x630b6b2c,0x5aca5aca,0x62eb62eb,0x7b8d734c,0x736d736d,0x736d736d,0x736d6b4c,0x6b4c738d,0x6b2c630b,0x7b8d738d,0x6b2c6b2c,0x7b8d736d,0x6b4c6b4c,0x738d736d,0x736d73ad,0x736d736d,0x8c50736d,0x94719471,0x736d8c30,0x6b4d738d,0x62eb62eb,0x5aaa5aca,0x5aaa62cb,0x62eb5aca,
-0x7b8e6b4c,0x83ef83ef,0x734c738d,0x6b4c736d,0x736c736c,0x734c6b4c,0x736c736d,0x7bee736c,0x7bce840f,0x738d738d,0x630b6b4d,0x630b630b,0x62eb62eb,0x6b2c630b,0x6b4c6b4c,0x6b4c6b4c,0x7bce738d,0x738d6b6d,0x6b2c738d,0x6b2c736d,0x736d6b6c,0x6b4c6b4c,0x7bce7b8d,0x6b4c736d,0x6b6d736d,0x6b6d6b4c,0x6b4c6b6d,0x632c6b4c,0x6b2c6b2c,0x6b4c6b2c,0x630b6b2c,0x6b4c6b2c,
-0x9cd2ad54,0x83ce840f,0x94709450,0x83ef8c0f,0x9c718c2f,0x83ee8c0f,0x83ce8c2f,0x83cd83ee,0xb553ad12,0x9c90ad12,0x94709490,0x94509470,0xad53a513,0x840f9470,0x7bce8c50,0x83ef738d,0xa4d29c91,0xad139cb1,0x8c2fa4f2,0x8c2f83ee,0x83ee8c0f,0x83ce7bad,0xa4f2b554,0x83ee83ce,0x8c2f9cb1,0x9cb19470,0xa4f2a4f2,0x94709cb1,0x945083ee,0x83ee9470,0x8c2f83ee,0x840f8c2f,
-0x842f840f,0xa4f29471,0x7bae8c2f,0x83ef7bee,0x83ef8c50,0x7bce7bee,0x73ad7bae,0x6b4d738d,0x736d7bae,0x738e6b4d,0x6b6d738e,0x736d6b4d,0x6b4d6b6d,0x6b6d6b6d,0x736d6b4c,0x736d738d,0x736d7bcf,0x7baf6b4d,0x6b2d738e,0x736d6b2d,0x7bcf7bae,0x83ef83ef,0x83ef83ef,0x7bce840f,0x7bae83ef,0x7bae7bae,0x8c30840f,0x83ce8c30,0x7bce83ce,0x83ee83ee,0x840f9470,0x7bce83ee,
-0x83ce738d,0x738d7bad,0x7bad7bad,0x6b2c7b8d,0x734c6b0b,0x736d736d,0x7bae7b8d,0x6b4c738d,0x6b2c736d,0x6b2c6b2c,0x6b2c6b0b,0x7bae736c,0x83ae83ce,0x83ae83ce,0x83ae83ae,0x83ce83ee,0x6b2b6b4c,0x736c734c,0x6b4c6b4c,0x6b0b6b2c,0x83ce6b2c,0x734c83ce,0x734c734c,0x83ae7bae,0x94309450,0x734c8c0f,0x6b0b6b2c,0x734d736d,0x6b2c6b4c,0x62eb62eb,0x6b2c734c,0x7b8d6b0b,
-0x6b2c6b4c,0x630b630b,0x736d736d,0x734c736d,0x738d7bae,0x734d6b4c,0x5aca630b,0x62eb5aaa,0x5aaa62eb,0x62eb5aca,0x734c6b2c,0x736d734c,0x6b2c734c,0x734d734c,0x6b4c734c,0x738d734c,0x6b4c6b0b,0x6b4c6b4c,0x736d736d,0x7bae736d,0x6b4c736d,0x738d736d,0x736d738d,0x6b2c6b4c,0x7bae736d,0x6b4c7bae,0x8c307bae,0x6b4c6b2c,0x62eb630b,0x62cb62eb,0x6b2c5aaa,0x83ce738d,
-0x736d83ef,0x734c6b2c,0x736c736c,0x738d7bad,0x736c7bad,0x6b4c6b4c,0x6b4c738d,0x738d6b4c,0x7bce8c70,0x6b6d6b4c,0x6b2c6b6d,0x630b632c,0x632c630b,0x6b6d6b6d,0x6b2c6b6d,0x6b4c6b4c,0x736d6b6d,0x6b2c630b,0x632b736d,0x62eb6b2c,0x6b2c6b2c,0x6b4c6b4c,0x6b4c6b4c,0x738d6b4c,0x736d736d,0x73ae736d,0x6b6d73ae,0x6b4c6b4c,0x6b4c6b4d,0x736d6b4c,0x6b4c6b4c,0x7bce6b4c,
-0xad54a513,0x840f9cb1,0x8c0f83ef,0x83ef8c0f,0x8c509430,0x8c2f8c0f,0x840f83ee,0x8c0f7bae,0x9cb1a512,0x9cd1a4f2,0x94909cb1,0x8c2f9470,0xa5139490,0x9470c5f6,0x83ef7bce,0x7bce840f,0x94709470,0x9c919491,0xa4f2ad33,0x8c508c0f,0x8c50bdb5,0x8c0f9470,0xa4f283ee,0x83ee9c71,0xad539c91,0x83ee9cb1,0x94708c0f,0x9cb1ad13,0x8c0f8c2f,0x7bce83ee,0x8c0f8c2f,0x83ce83ee,
-0x83ee8c2f,0x8c507bce,0x738d83ef,0x7bee738d,0x738d7bae,0x7bee7bae,0x7bae7bae,0x736d7bae,0x738e738e,0x736d736d,0x6b4d6b4d,0x6b4d6b2c,0x6b6d6b6d,0x6b4c6b4c,0x73ad738d,0x738d738d,0x6b4d6b4c,0x738e6b2d,0x6b4d736d,0x6b4c6b4d,0x840f738e,0x83ce83ef,0x8c508c50,0x736d83ee,0x83ef738d,0x738d7bce,0x94718c30,0x8c309450,0x736d83ef,0x840f7bae,0x8c50a4f2,0x738d83ce,
-0x7bad7b8d,0x7b8d7b8d,0x83ce83ee,0x7bad83ce,0x734c734c,0x736d736d,0x83ce7bae,0x6b4c736d,0x62eb630b,0x734c6b4c,0x6b0b6b0b,0x738d6b2c,0x7b8d7bad,0x736c736c,0x8c0f7bad,0x83ef8c2f,0x736c7b8d,0x7bae7bae,0x6b2b734c,0x736c6b4c,0x8c2f83ce,0x734c83ae,0x7b8d7b8d,0x7b6d7b8d,0x94718c0f,0x736c9450,0x734c6b2c,0x6b0b734c,0x736d738d,0x6b2c630b,0x62eb6b2c,0x62eb6b2c,
-0x83ce7b8d,0x62eb6b2c,0x6b2c62eb,0x734c738d,0x6b2c738d,0x6b4c62eb,0x6b2c6b4c,0x5aca5acb,0x5aca630b,0x5aca5aca,0x7b8d6b0b,0x734c736d,0x7bae7b8d,0x6b0c736d,0x736d6b2c,0x6b2c736d,0x6b2b6b4c,0x736c6b4c,0x736c6b4c,0x83ce7bae,0x738d7bae,0x738d736d,0x736d738d,0x6b2c6b4c,0x6b4d6b4c,0x6b4d736d,0x6b4c736d,0x6b2c83ef,0x630b62cb,0x736d6b2c,0x83ef7bae,0x736d734c,
-0x62eb630b,0x736d6b2c,0x736c6b4c,0x7bad7bcd,0x738d738d,0x736d7bad,0x6b2c738d,0x6b2b6b2b,0x6b6c73ad,0x6b4c6b2c,0x6b6c736d,0x630b6b4c,0x630b630b,0x6b4c632c,0x6b6d738d,0x73ad738d,0x6b4c738d,0x632c632c,0x6b4c6b4c,0x6b2c630b,0x630b6b4c,0x6b2b630b,0x6b4c6b4c,0x7bce736c,0x6b6d738d,0x738d738d,0x738d73ae,0x738d6b4c,0x6b4c738d,0x6b2c6b2c,0x736d6b2c,0x736d632b,
-0x9c91a513,0x9c919cb2,0x840f83ef,0x840f8c2f,0x945083ce,0x840f9470,0x7bce8c2f,0x840f8c30,0xbd74bd95,0x9cb183ee,0x9470ad12,0x8c2f9490,0x9470840f,0xb554a4d2,0x8c309471,0x83ee8c0f,0x8c5083ee,0x94709470,0xde99a4f2,0xc5d6e71b,0x9c91ce17,0x8c0f9470,0x8c2f840e,0xef1bc5f6,0x944fa4d1,0x944f9c91,0x83ee8c2f,0x8c0f8c0e,0x8c0f8c50,0x83ee83ee,0x8c0f83ee,0x7bad8c2f,
-0x840f8c30,0x9c917bce,0xd678deb9,0x83ce9471,0x7b8d7bce,0x7bce738d,0x83ee7bce,0x7bae7bae,0x6b6d738d,0x6b4c6b4c,0x6b6d6b4d,0x6b2c6b4d,0x736d6b4d,0x6b4c6b4c,0x736d6b2c,0x738d7bae,0x630c630c,0x6b4c736d,0x736d736d,0x736d6b4d,0x8c0f738d,0x840f83ef,0x842f8c2f,0x7bce8c30,0x8c307bae,0x7bce83ef,0x840f840f,0x8c508c0f,0x7bae8c30,0x8c2f83ee,0x83ce8c2f,0x83ef83ef,
-0x7bad7b6d,0x736c736c,0x83ce7bad,0x7bce7bad,0x734c7bad,0x736d736d,0x7bae738d,0x6b4c738d,0x630b6b4c,0x7bae6b6c,0x6b0b736d,0x630b62eb,0x6b4c736c,0x734c6b2b,0x7bae7b8d,0x8c2f83ee,0x7bae83ce,0x736d7b8d,0x6b0b7b6d,0x734d6b2c,0x83ce6b0b,0x734c7b8d,0x732c734c,0x734c736d,0x732b7b8d,0x7b8d83ad,0x6b0b6b0b,0x6b0b62eb,0x630c6b4c,0x6b2c630b,0x6b4c6b2c,0x736d7b8e,
-0x736d6b4c,0x630b738d,0x6b4c62eb,0x6b2c6b2c,0x736d736d,0x6b2c630b,0x6b2c6b4c,0x6b0c736d,0x62ea62ca,0x62eb62ca,0x83ce734c,0x734c736d,0x734c6b4c,0x736c736c,0x734c734c,0x630b734c,0x736d6b2c,0x736d6b2c,0x7bae7b8d,0x7bae736d,0x736d736d,0x73ad7bae,0x6b4c6b4c,0x738d738d,0x6b0c6b2c,0x734d6b4c,0x6b4c6b2c,0x7bce6b4c,0x840f738d,0x738d840f,0x62eb738d,0x6b2c5aaa,
-0x6b6d6b4c,0x738d736d,0x738d738d,0x83ee7bce,0x736c738d,0x738d738d,0x6b2c6b4c,0x6b4c6b4c,0x6b4c736c,0x736d736c,0x736d6b4c,0x6b4c73ad,0x6b2c6b4c,0x6b4c632b,0x738d6b4c,0x6b6d6b6c,0x6b4c738d,0x6b6d6b6d,0x632c6b6d,0x6b4c6b6d,0x6b4c6b2c,0x6b2c6b2c,0x6b6c736d,0x738d6b4c,0x6b8d738d,0x738d73ad,0x736d73ae,0x73ae738d,0x6b4c73ae,0x6b4c632c,0x738d6b4c,0x738d7bae,
-0xa4f2bdd6,0xa5139c91,0x83eea4f3,0x840f7bce,0x840f8c50,0x83ee83ee,0x8c5083ef,0x840f83ef,0xc5d6a4d2,0x94709c91,0x9cd19cb1,0x9c91b554,0x83ef8c50,0x947183ef,0x83ee9cb2,0x83ce83ce,0x8c0f736c,0xde99ad13,0xef3cf77d,0xad13ce17,0x83ee9cb1,0x83cd9490,0xad139450,0xb574a4f2,0x8c0ea4b1,0xad337bad,0x8c0e944f,0x8c2f9450,0x840f8c0f,0x8c2f8c0f,0x83ce83ee,0x7bae83ce,
-0x8c3083ef,0x7bad9470,0xbdb583ef,0xb595b595,0x9cd2ad54,0x6b6c8c2f,0x840f7bae,0x7bce738d,0x738d6b6d,0x6b6d736d,0x6b6d738e,0x736d6b4d,0x6b4c736d,0x6b4c6b4c,0x738d738d,0x738e7bce,0x738d736d,0x736d7bae,0x734d736d,0x738d736d,0x7bce7bae,0x7b8d738d,0x738d7bad,0x83ee7bee,0x8c307bce,0x840f840f,0x842f8c50,0x83ef83ef,0x7b8d83cf,0x83ce7b8d,0x7b8d83ce,0x83ef83ce,
-0x83ce83ee,0x7bad7bad,0x7b8d7bad,0x7bad7b8d,0x7b8d7bce,0x736d738d,0x7bae736d,0x6b2c736d,0x736d632b,0x736d7bae,0x6b4c83ef,0x6b4c736d,0x736c736c,0x736d734c,0x7b8d738d,0x8c0f7bce,0x83ef8c30,0x734d7b6d,0x734d6b0b,0x734c7b8d,0x6b0b6b2c,0x734c7bae,0x734c734c,0x7b6d734c,0x734c734c,0x7b8d7b8d,0x732c7b6d,0x734c62eb,0x6b4c630b,0x6b4c6b2c,0x630b62eb,0x6b4c6b2c,
-0x6b2c6b2c,0x6b2c6b2c,0x6b2c6b2c,0x6b0c630b,0x6b4c736d,0x6b4c630b,0x630b6b4c,0x6b2c6b2c,0x62eb62eb,0x736c6b2b,0x7bae7b8d,0x738d738d,0x734c7b8d,0x734c736d,0x6b2c6b2c,0x6b2c6b0b,0x6b6c6b2c,0x736d736d,0x736d736d,0x736d736d,0x736d736d,0x738d738d,0x738d736d,0x738d73ad,0x736d6b2c,0x6b2c6b2c,0x7bae738d,0x8c507bae,0x7bae94b1,0x6b2c6b4c,0x62eb6b0c,0x630b630b,
-0x6b4c6b4c,0x73ae738d,0x73ad6b6c,0x738d83ee,0x6b4c6b4c,0x738d738d,0x6b4c6b4c,0x6b6c6b6c,0x6b0b6b2c,0x736d6b4c,0x6b2c736d,0x736d6b4c,0x6b4c6b4c,0x6b4c632b,0x6b6c6b4c,0x6b6c6b6c,0x738d736d,0x738d7bce,0x6b4c6b4c,0x736d6b4c,0x6b2c738d,0x6b4c6b2c,0x736d6b4c,0x736d738d,0x738d6b6d,0x6b4c738d,0x7bae736d,0x738d7bce,0x6b4c632c,0x6b6c6b6d,0x736d6b2c,0x7bce7bae,
-0xce17a4d2,0x9471a4f3,0x94719cd2,0x83ce83ef,0x8c308c50,0x83ee736d,0x8c50840f,0x8c508c30,0xa4d29450,0x9c91a4d2,0x9c909470,0xa4f2ad33,0x94719470,0x840f8c30,0x8c0f840f,0x8c507bce,0xbd95ad33,0xad13bd95,0x8c0f9471,0xa4d28c30,0x83cea4f2,0x9c919c90,0x83ee8c0e,0x83cd83ee,0x9450a4d2,0x9c90736c,0x8c0fad13,0x8c0f9c70,0x8c0f8c0f,0x94509470,0x7bce83ee,0x7bad7bad,
-0x840f738d,0x6b4c840f,0x7b8d738d,0x8c5083ee,0xce37ad33,0x9470d678,0x7bce738d,0x736d73ad,0x738d6b6d,0x6b4c6b6d,0x6b4d6b4d,0x736d6b4d,0x736d6b4d,0x738d738d,0x738d738d,0x7bae7bce,0x73ae738e,0x738d7bae,0x6b4c736d,0x7b8e738d,0x7bce7bce,0x736d7b8d,0x738d738d,0x840f7bae,0x83ef840f,0x840f83ef,0x8c508c50,0x7bae83ce,0x8c308c0f,0x83ce8c0f,0x7b8d7b8d,0x7b8d7bad,
-0x83ce83ee,0x7bad7bce,0x7b8d736c,0x7bad7bae,0x7bad7bae,0x736d7b8d,0x738d734c,0x6b4c736d,0x630b6b4c,0x62eb738d,0x734c736d,0x736c738d,0x734c6b0b,0x738d736c,0x736c734c,0x8c0f7b8d,0x9c719cb2,0x6aeb7b8d,0x7b6d6aeb,0x734c7b8d,0x6b0b6b2c,0x7b6d732c,0x734c7b8d,0x734c736c,0x8bce83ad,0x83ce83ce,0x7b6d83ef,0x6b2c6b0b,0x6b4c6b2c,0x6b2c6b2c,0x6b0c6b0c,0x6b2c6b0c,
-0x736d7bae,0x736d6b4c,0x6b2c736d,0x6b2c6b2c,0x6b2c6b4c,0x630b62eb,0x630b6b2c,0x62eb5aca,0x6b2b6b2c,0x7b8d736d,0x736d7b8d,0x736c734c,0x734c7b8d,0x6b2c736d,0x6b2c6b0b,0x734c6b0b,0x6b4c6b4c,0x736d738d,0x6b2b736c,0x6b4c6b4c,0x738d736d,0x7bae7bae,0x6b6d738d,0x6b6d6b6d,0x7bae738d,0x83ef83cf,0x83ef83ef,0x736d83ef,0x5aca62eb,0x630b6b0b,0x62eb62eb,0x5aca62eb,
-0x6b4c6b4c,0x73ad738d,0x7bae738d,0x6b6c7bce,0x6b4c6b6c,0x6b6c6b4c,0x6b4c6b6c,0x6b4c6b4c,0x6b2c6b2b,0x738d6b4c,0x6b2b7bce,0x6b4c630b,0x6b4c6b2c,0x6b4c6b2b,0x6b4c6b4c,0x6b6c736d,0x738d6b6d,0x6b6d73ae,0x738d6b4c,0x736d6b4c,0x6b6c738d,0x6b4c6b4c,0x6b4c6b4c,0x738d736c,0x73ae738d,0x738d7bae,0x73ad738d,0x738d73ad,0x6b6c6b4c,0x6b6c736d,0x738d736d,0x7bae7bae,
-0xa5139471,0x9cd2bdd6,0x94708c30,0x8c0f9cb1,0x83ef7bce,0x83ef8c0f,0x94919491,0x9cb28c30,0xbd959471,0x949083ee,0x8c4fad13,0x9cb19490,0x840f8c2f,0x736d7bae,0xbdb58c2f,0xde99f77c,0x9470b554,0x7b8d7bad,0x8c3083ce,0x9cb19470,0xa4f29cb1,0x83ee8c0f,0x8c0f9450,0x8c508c0f,0x9cb17bad,0xbdb59470,0x942fa4b1,0x8c2f9450,0x840f8c2f,0x8c0f8c0f,0x83ee83ee,0x8c50840f,
-0x7bce7bae,0x83ce7bad,0x7b8d7b8d,0x7bce736c,0x83ee6b4c,0x7bce8c30,0x6b4c736d,0x738d736d,0x632c738d,0x632c630c,0x6b4d630c,0x6b2c736d,0x736d6b4c,0x738d738d,0x7bae738d,0x736d738d,0x7bce7bce,0x736d738d,0x736d736d,0x840f83ef,0x83ce83ce,0x738d7bce,0x7bce738d,0x83ee7bce,0x840f8c30,0x840f842f,0x8c30842f,0x83ef83ef,0x945083ee,0x8c309450,0x8bef83ce,0x8bef83ef,
-0x83ce83ee,0x7bad83ce,0x7b8d7b8d,0x83ef7bce,0x738d738d,0x7b8d7bae,0x6b4c734c,0x736d6b4c,0x6b2c736d,0x734c6b0b,0x736d736d,0x736c83ce,0x734c630b,0x7bad738d,0x736c736c,0x83ee738d,0x8c309450,0x6b0c7bae,0x6b0c732c,0x83ae7b6d,0x6b0b6b0b,0x83ce7b6d,0x7bad7b8d,0x83ce736c,0x83ad83ce,0x83ee7b8d,0x83ee8c0f,0x630b7bae,0x6b2c736d,0x630b630b,0x6b4c7b8e,0x6b2c6b2c,
-0x738d738d,0x6b4c6b2c,0x6b4c736d,0x6b4c736d,0x630c630c,0x630b630b,0x6b4c6b4c,0x630b62eb,0x6b2c734c,0x734c736d,0x734c734c,0x6b2c734c,0x6b2c734c,0x6b2c734c,0x734c6b0c,0x736d6b2c,0x738d6b4c,0x6b2c736c,0x6b4c736c,0x6b2c6b2c,0x734c6b2c,0x738d738d,0x736d738d,0x7bae738d,0x94718c30,0x7b8e8c30,0x62eb6b4c,0x6b6c6b4c,0x736d632b,0x6b2c736d,0x630b630b,0x6b0c6b2c,
-0x738d738d,0x738d736d,0x7bae7bce,0x73ad7bad,0x738d738d,0x736d736d,0x736d736d,0x6b4c6b4c,0x6b6c6b4c,0x736c738d,0x6b4c7bce,0x6b2b630b,0x6b4c6b2b,0x6b2c6b2b,0x6b4c6b6c,0x6b4c738d,0x6b4c6b4c,0x6b4c6b6c,0x73ae6b6d,0x738d6b4c,0x738d738d,0x6b6c736d,0x6b4c6b6c,0x73ad736c,0x738d738d,0x7bce73ae,0x738d7bae,0x73ad738d,0x738d73ad,0x6b6c6b4c,0x73ad738d,0x6b4d736d,
-0x94719471,0xbdb6ad34,0x8c509471,0x8c309491,0x840f840f,0x94719491,0x94719cd2,0x8c3083ef,0xce589450,0x8c2fbdb5,0xa4f29c91,0x8c2f8c2f,0x840f840f,0xbdd69cb2,0xc5d6d678,0x9c91b574,0x7bad840f,0x83ef7bce,0x83ce83ce,0xb5759471,0x8c509470,0x840e8c2f,0x9470840f,0x9c919491,0x83ee8c2f,0xce178c2f,0x83cdbdb5,0x8c2f8c0f,0x8c0f9cb1,0x8c2f840f,0x840f8c30,0x840f83ef,
-0x83ee7bce,0x7bce738d,0x7bce8c30,0x736c8c2f,0x8c50738d,0x7bad83ee,0x7bce7bce,0x83ef7bce,0x6b4c7bae,0x632c632c,0x6b4d630c,0x62eb6b4d,0x736d6b2c,0x7bce73ad,0x7bae7bae,0x6b4d736d,0x736d738d,0x630b6b2c,0x6b4c62eb,0x8c3083ef,0x8c508c30,0x8c0f8c50,0x94718c30,0x840f8c2f,0x840f83ef,0x8c2f9470,0x83ef83ce,0x8c0f840f,0x8c2f8c0f,0x9cb19450,0x8bef9470,0x7bad7b8d,
-0x7bce7bae,0x840f83ee,0x736d83ef,0x7bad6b4c,0x7b8d7bad,0x7b8d7bad,0x6b2b734c,0x6b4c6b2c,0x6b2c6b4c,0x6b4c6b4c,0x7b8d6b4c,0x83ee736c,0x7bae7b8d,0x7bce7bad,0x7bad7bad,0x7b8d7b8d,0x736d83ce,0x7b8d736d,0x6b0b736d,0x736d7b6d,0x83ae7b6d,0x83ce7b8d,0x83ae7bad,0x83ce736c,0x7b8c83ad,0x83ce734c,0x8c0f8c30,0x734c83ee,0x6b2c736d,0x630b6b2c,0x6b4c738d,0x6b4c6b2c,
-0x6b4c6b2c,0x6b2c630b,0x6b4c6b4c,0x6b2c6b4c,0x632b630b,0x6b2c6b4c,0x736d6b6c,0x736d6b2c,0x6b2c736d,0x630b6b2c,0x734c6b2c,0x6b2c736d,0x6b0b6b4c,0x6b4c6b0b,0x6b4c6b4c,0x736d736d,0x7bae6b4c,0x630b736c,0x7bce6b4c,0x6b2c7bad,0x734c6b4c,0x738d736d,0x7bce7bae,0x7bef7bce,0x7bce7bce,0x630b736d,0x62ca630b,0x630b630b,0x6b2c6b2c,0x7bae6b2c,0x630b736d,0x6b4c6b4c,
-0x7bae738d,0x6b4c6b4c,0x738d738d,0x7bce7bad,0x7bce7bae,0x7bae7bce,0x6b6c738d,0x6b4c6b4c,0x6b4c6b2c,0x736c738d,0x6b2c738d,0x632b6b4c,0x6b2b632b,0x6b2b6b2b,0x6b4c6b6c,0x6b4c738d,0x6b6c6b2c,0x736d6b4c,0x738d738d,0x7bae736d,0x738d83ef,0x7bad738d,0x7bad738d,0x7bae83ce,0x7bef7bce,0x7bce7bce,0x7bee7bce,0x6b6c7bad,0x738d738d,0x736d738d,0x736d736d,0x736d736d,
-0x9cd2a4f3,0xad349471,0xa4f3ce58,0x94918c30,0x8c509cb1,0x9cb28c30,0x8c309491,0x83ef8c50,0xc5f68c2f,0xb595c617,0xad339cb1,0xa4f2a513,0xd658ad34,0x9cb2ad54,0x7b8d83ef,0x8c2f8c0f,0x8c2f9470,0x736d7bce,0x840f83ef,0x9470840f,0x7bad738d,0x8c4f8c50,0x8c4f83ee,0x9cb19c91,0x8bee9cb1,0xbd9483ad,0x8c0fb574,0x94709cb1,0x840f8c2f,0x94508c0f,0x94709450,0x83ef9470,
-0x7bce840f,0x7bce7bce,0x94b17bce,0x8c709470,0x83ee83ee,0x83ef83ee,0x83ef83ef,0x738d736d,0x7bce83ef,0x6b4c736d,0x6b4d6b4d,0x6b4c6b2c,0x6b2c6b4c,0x736d736d,0x736d7bae,0x736d6b4d,0x6b4d6b4d,0x6b4d6b4c,0x736d6b0c,0x8c5083ef,0x8c308c30,0x94919471,0x94919cb1,0x83ee840f,0x840f7bce,0x8c308c50,0x8c0f840f,0x840f840f,0x8c0f840f,0x9cb18c2f,0x94709cb1,0x7bad83ee,
-0x7bce736c,0x7bce83ce,0x738d7bce,0x6b4c6b2c,0x738d738d,0x6b4c736c,0x6b4c6b4c,0x630b6b4c,0x6b2c6b4c,0x6b2c630b,0x734c734c,0x6b0b736c,0x7b8d7bae,0x7b8d738d,0x83ce83ce,0x7b6d7bad,0x736c7b8d,0x7b8d6b2c,0x7b6d7b6d,0x732c734c,0x8c0f7b8d,0x83ae83ad,0x7b8d8bef,0x83ce83ee,0x83ce8bee,0x83ee7b8d,0x7bae8c30,0x6b4c734c,0x734c6b2c,0x630b6b2c,0x736d6b2c,0x6b0c6b2c,
-0x6b2c6b2c,0x6b2c630b,0x6b4c6b4c,0x6b4c6b4c,0x6b4c6b4c,0x736d738d,0x6b2c6b4c,0x736d630b,0x6b0b738d,0x630b630b,0x736d6b4c,0x6b4c6b4c,0x6b2c736d,0x736d630b,0x736d738d,0x736d736d,0x736d736c,0x734c734c,0x8c30736c,0x7b8d8c50,0x7bae7bad,0x83ef7bce,0x7bce7bee,0x73ad7bae,0x6b2c6b2c,0x6b2c6b4c,0x5aaa5aaa,0x6b2c6b2c,0x630b630b,0x736d62ca,0x5aaa734c,0x6b0c5aca,
-0x7bce7bae,0x738d7bae,0x7bae738d,0x83ee840f,0x7bce83ee,0x738d7bae,0x6b4c736d,0x6b6c6b4c,0x6b4c6b2c,0x736c738d,0x630b6b4c,0x6b2b6b2c,0x6b2c6b2b,0x6b4c6b4c,0x738d736c,0x6b6c736d,0x736d736d,0x738d6b6c,0x736d738d,0x738d738d,0x738d7bae,0x7bee7bad,0x83ee83ee,0x7bce83ee,0x840f840f,0x7bce7bef,0x7bee7bce,0x7bad7bce,0x738d736c,0x736d7bae,0x6b2c6b2c,0x6b4c6b4c,
-0xa4d39cd3,0x8c509cb2,0xce38ad54,0x8c50a4d2,0x94919cd2,0x8c309471,0x94918c30,0x8c508c50,0xad338c0f,0x9cb1b554,0xc5f6bdb5,0xd699ef3b,0x9450a4f2,0x6b2c83ef,0x83ef6b2c,0x83ce9c91,0x8c5083ee,0x8c509cb2,0x83ce8c0f,0x8c507bce,0x7bce8c2f,0x94917bcd,0x840f9cb1,0x94918c2f,0x8c2f9470,0xa4d28c0f,0xbd95a4f2,0x8c2fc5d6,0x8c2f8c0f,0x94708c4f,0x8c308c0f,0x840f9cb1,
-0x7bce840f,0x840f8c50,0x842f73ad,0x8c509cd2,0x736c7bae,0x840f7bce,0x7bce7bce,0x7bae7bce,0x7bef7bce,0x6b6d73ae,0x6b6d736d,0x736d6b4d,0x632b736d,0x5aca62eb,0x738d736d,0x6b4c736d,0x6b4c6b4c,0x7bae738d,0x7bce738d,0x8c3083ef,0x8c508c30,0x9cb19491,0x94719cb1,0x840f8c0f,0x8c0f83ef,0x8c2f840f,0x8c508c50,0x8c0f9450,0x94508c0f,0x94509c71,0x9c919450,0x7bad9470,
-0x7bce7b8d,0x736d7bae,0x7bad736d,0x7bad7bae,0x6b4c734c,0x6b4c6b2c,0x736d736c,0x6b2b736d,0x6b2b6b0b,0x83ce83ef,0x6b0b6b2c,0x6b4c734c,0x734c734c,0x734c736c,0x7b8d7b8d,0x7bad83ae,0x7b8d732c,0x736d734c,0x7b6c7b6c,0x7bad736c,0x942f83ee,0x8c0f9cb1,0x7b8d83ce,0x83ee7b8d,0x83ee83ee,0x83ee83ce,0x736c83ee,0x6b0b6b0b,0x736d6b2c,0x62eb6b2c,0x736d6b0b,0x62cb6b0b,
-0x62eb62eb,0x630b62eb,0x6b4c6b2c,0x738d6b4c,0x736d734c,0x736d738d,0x6b2c6b4c,0x734c6b2c,0x6b4c736d,0x6b2c6b4c,0x734c6b4c,0x6b4c6b2c,0x6b4c736d,0x736d6b4c,0x7bce7bae,0x736d7bae,0x6b2b736d,0x738d6b4c,0x840f7bad,0x83ce8c30,0x7bae7bad,0x840f83ef,0x7bad7bce,0x738d7bae,0x736d736d,0x6b2c6b4c,0x6b2c6b2c,0x630b62ea,0x6b2c6b2b,0x736d630b,0x738d7bae,0x6b2c630b,
-0x8c1083ef,0x8c0f8c0f,0x840f83ef,0x840f8c30,0x73ad83ef,0x6b4c6b6c,0x6b4c6b4c,0x6b4c6b6d,0x6b4c6b4c,0x6b6c738d,0x630b632b,0x6b2c6b2b,0x6b4c6b4c,0x736d738d,0x7bad736d,0x736c736c,0x738d738d,0x738d7bae,0x736d738d,0x738d738d,0x7b8d734c,0x7bae7b8d,0x7bce840f,0x7bce738d,0x7bae7bae,0x7bce7bad,0x7bce73ad,0x8c5083ee,0x738d7bce,0x738d738d,0x62eb6b2c,0x630b62eb,
-0xad34a4f3,0x9cb2a513,0xb5959491,0xa513d699,0xb5959c91,0x8c30a4f3,0x83ef8c30,0x840f840f,0xa4d28c30,0xef3cc5f7,0xce58deb9,0x8c50a4f2,0x83ee83ef,0x7bce7bae,0x83ce738d,0x8c2f83ce,0x83ee736c,0x8c2f9cb1,0x7bce7bce,0x736d7bae,0x8c2f840f,0x83ee7bad,0x94919cd2,0x94709450,0x8c2f9450,0x944f8c0f,0xbdb5ad33,0x8c2fa4d2,0x83ce7bad,0xa5138c50,0x83ee9471,0x8c309471,
-0x83ef8c50,0x83ee7bad,0x8c308c2f,0x94918c50,0x7bad7bce,0x738d736d,0x7bae7bce,0x738d7bee,0x738d6b6d,0x73ae73ae,0x738d738e,0x6b4c736d,0x7bae6b4c,0x6b4c738d,0x7bae6b2c,0x7bae73ad,0x6b2c736d,0x7bae736d,0x840f7bae,0x8c0f840f,0x94718c30,0x8c509470,0x840f8c2f,0x8c508c2f,0x8c2f8c0f,0x840e83ee,0x840e840f,0x8c2f8c2f,0x94708c0f,0x83ce9c91,0x8c2f7bad,0x83ee9470,
-0x6b4c736d,0x7bce736d,0x7bad7bce,0x736c738d,0x6b4c6b4c,0x7bad6b4c,0x738d7bae,0x736d7b8d,0x736c6b2c,0x736d736d,0x6b0b6b0b,0x7bce736d,0x736c732c,0x734c83ae,0x734c7b6d,0x8c0f83ce,0x7b6d7bad,0x7b8d7b6d,0x7b6d7b8d,0x732b7b8d,0x7b8d734c,0x8bef83ee,0x83ee83ce,0x83ce83ee,0x83ce8c0f,0x8c0f8c0f,0x7bad83ce,0x630b738d,0x6b4c6b2c,0x62eb6b4c,0x6b2c62eb,0x5aaa62cb,
-0x62eb62eb,0x630b6b0b,0x6b4c6b2c,0x6b2c6b0b,0x630b62eb,0x6b2c6b0b,0x734c6b2c,0x6b4c736d,0x7bae734c,0x736d7b8d,0x736d6b2c,0x736d6b4c,0x6b4c6b4c,0x736d7bae,0x8c507bae,0x736d83cf,0x6b4c6b4c,0x736c734c,0x7bae7bae,0x7bad7bae,0x738d7bce,0x7b8d738d,0x738d736d,0x738d7bae,0x6b2c736d,0x6b4c6b2c,0x7bce6b4c,0x736c7bad,0x630b6b4c,0x736d734c,0x7bae6b4c,0x736d734c,
-0x8c3083ce,0x8c0f8c0f,0x83ef8c30,0x83ee7bae,0x736d7bae,0x736d736d,0x6b4c6b4c,0x632c6b6d,0x6b6c6b2c,0x6b4c6b6c,0x6b6c6b4c,0x6b4c6b4c,0x6b4c6b4c,0x738d7bad,0x7bae736d,0x736c6b4c,0x738d738d,0x7bae840f,0x6b6c6b6c,0x7bad738d,0x736d7bad,0x738d736c,0x7bce7bae,0x7bad7bae,0x7bce7bce,0x7bae738d,0x7bce738d,0x8c2f83ee,0x738d8c2f,0x7bce736c,0x5aca6b6c,0x62eb5aca,
-0x9cd29cb2,0x9491a513,0x9cd29451,0xd699b554,0xad54a513,0x9450ad13,0x840f840f,0xad549cb2,0xce17c5f7,0xbd95bd95,0x9cb1ad33,0x94509cd2,0x9cb29471,0x83ef8c0f,0x7bad8c2f,0x840f7bad,0x7bcd7bce,0x8c508c2f,0x738d7bce,0x83ef8c30,0x8c5083ee,0x7bce7bce,0x9491840f,0x83ee9cb2,0x9c9183ee,0xb5959c91,0x8c2f9cb1,0x94709cb1,0x7bce8c0f,0x94708c30,0x83ee8c50,0x94707bad,
-0x7bce9cb1,0x94917bce,0x83ef840f,0x7bee83ee,0x8c50738d,0x7bce8c30,0x83ef83ef,0x736d738d,0x632c738d,0x7bce6b6d,0x73ae73ae,0x736d7bae,0x7bae6b6c,0x7bce7bee,0x738d738d,0x7bce7bae,0x6b0b736d,0x736d736d,0x9cd283ef,0x8c309491,0x94509471,0x94509470,0x7bce840f,0x9471840f,0x840f8c2f,0x8c50840f,0x8c0f83ce,0x8c0f9c91,0x94918c0f,0x7bad9450,0x7b8d7b8d,0x8c508c0f,
-0x736d7bae,0x840f7bae,0x7bae83ef,0x7b8d7bce,0x734c734c,0x738d736c,0x6b4c736d,0x7bad734c,0x736c7bce,0x6b0b6b2c,0x736c6b2b,0x7bae7bad,0x732c83ce,0x83ee7bad,0x736c734c,0x7b8d83ce,0x7b8d7bad,0x7bad7b8d,0x7bad7b6d,0x83ce7b8d,0x7bad7b6c,0x83ee83ce,0x7bad8c0f,0x83ce83ce,0x7bad83cd,0x7b8d7b8d,0x734c736c,0x736d738d,0x734c736d,0x734c734d,0x6b0b6b0c,0x6b0c6b0c,
-0x6b2c6b2c,0x7b8d732c,0x6b2c734d,0x6b2c6b2c,0x62eb62eb,0x734d6b2c,0x6b2c62eb,0x6b0c732c,0x7bae6b2c,0x7b8d840f,0x736d6b2c,0x6b4c738d,0x6b2c6b2c,0x738d6b4c,0x7bce7bae,0x7bce83ef,0x6b4c736d,0x7bce6b4c,0x83ef8c2f,0x738d7bae,0x736d736d,0x736d736d,0x738d736d,0x736d736d,0x630b630b,0x630b6b2b,0x734c630b,0x7b8d7bad,0x7bad7bad,0x6b0b6b4c,0x630b630b,0x8c0f83ef,
-0x94718c30,0x8c0f8c30,0x7bae7bce,0x738d738d,0x7bce7bce,0x738d738d,0x736d736d,0x736d6b4c,0x6b6c6b6d,0x6b6c738d,0x6b6c6b4c,0x736c6b4c,0x738d738d,0x736c738d,0x7bad736d,0x738d7bae,0x6b4c738d,0x736d736d,0x736d736d,0x7bae736d,0x6b4c7bae,0x6b4c632b,0x738d738d,0x7bae7bae,0x736d738d,0x7bae7bae,0x7bae83ef,0x840f73ad,0x738d840f,0x736d738d,0x5269630b,0x6b4c630b,
-0xad34c617,0xa5139c92,0x8c50ad54,0xa5139471,0x840fc617,0x9cd28c30,0xce17ad54,0xb595ce58,0x9471a4f3,0x9c91ad13,0xad54a4f2,0x94709cb1,0x83ef8c30,0x8c308c30,0x840f7bce,0x8c4f83ee,0x7bce8c2f,0x949183ee,0x8c509cd2,0x840f8c2f,0x94708c2f,0x83ee7bad,0x8c0f8c2f,0x9cb29491,0x8c2f9470,0x9cb1a4f2,0x7bad9470,0x9cd18c2f,0x8c509cd2,0x840f83ee,0x8c0f9470,0x8c307bae,
-0x8c2f9491,0x9cd28c50,0x840f8c50,0x7bee7bce,0x8c307bce,0x83ef8c50,0x840f7bce,0x7bce8c30,0x73ad8430,0x7bce738d,0x73ae7bae,0x736d7bae,0x7bae736d,0x7bce7bee,0x738d738d,0x8c5083ef,0x7b8d7b8d,0x7bae7bae,0x9471840f,0x8c309450,0x8c308c30,0x8c2f8c50,0x840f840f,0x840f840f,0x8c2f9470,0x840e840f,0x83ee83ee,0x94508c0f,0x9c919cb1,0x83ee8c0f,0x7b6d8c0f,0x7bce7b8d,
-0x7bae83ef,0x7b8d7bce,0x7bce7b8d,0x7b8d83ef,0x738d734c,0x736c7b8d,0x6b4c6b4c,0x736c736c,0x734c7bae,0x7b8d6b2c,0x6b2c738d,0x7b8d736d,0x83ce736c,0x7b8d7b6d,0x736c7bad,0x7b8d7b8d,0x7bad7b6d,0x83ee8bef,0x83ce7b8d,0x945083ce,0x8c2f9430,0x83ce83ce,0x83ee83ce,0x7bad7bad,0x7b8d7bad,0x7b8d7b8d,0x6b2b734c,0x6b4c6b4c,0x736d7b8d,0x83ce7bae,0x736d7b8e,0x734d732c,
-0x6b0b734c,0x6b0c6b0c,0x736d6b2c,0x736d736d,0x6b0b732c,0x6b2c6b2c,0x732c6b0c,0x736d736d,0x83ef83ef,0x738d7bce,0x7bce736d,0x736d7bce,0x6b2c6b0b,0x734c6b2c,0x7b8e736d,0x738d7bae,0x7bce7bad,0x83ef83ee,0x736c7bad,0x7bad738d,0x7bae736d,0x738d7bae,0x7bae738d,0x6b2c7b8d,0x6b2c6b2c,0x6b2b6b4c,0x7b8d6b2c,0x8c3083ce,0x734c8c0f,0x7b8d736c,0x7bce7bce,0x949183ef,
-0x8c309c91,0x83ef7bae,0x738d736d,0x736d736d,0x7bee7bae,0x7bce7bce,0x6b4d736d,0x736d6b4c,0x738d6b4c,0x6b4c73ad,0x6b6c6b4c,0x736d738d,0x738d7bae,0x736c6b4c,0x738d736d,0x7bce7bad,0x7bad738d,0x6b4c7bae,0x736d6b2c,0x736d738d,0x6b4c6b4c,0x736d6b4c,0x738d736d,0x738d738d,0x73ad7bae,0x7bae73ad,0x73ad7bce,0x7bee738d,0x7bce7bce,0x7bee7bce,0x6b4c83ef,0x7bee738d,
-0xb575ad14,0xa4f3a513,0xad34a4f3,0x8c309491,0xd6999491,0xdedadeda,0xbd96d679,0x7b8e9cb2,0x94718c30,0x94719471,0xa4f29470,0x8c509cb2,0x83ef8c50,0x94919471,0x83ee8c30,0x94719471,0x840f8c2f,0x8c2f83ef,0x9cb29cb2,0x738d8c30,0x7bce8c30,0x840e7bce,0x94508c30,0x9cd2840f,0x9450a4f3,0xa4f39491,0x83ef9491,0x83ef83ce,0x94719c91,0x83ce83ef,0x94919491,0x842f842f,
-0x8c507bce,0x8c508c70,0x94718c30,0x8c709471,0x840f842f,0x8c708c50,0x83ef840f,0x94718c30,0x840f840f,0x738d7bce,0x73ae736d,0x736d7bae,0x7bae73ad,0x7bce7bae,0x7bce7bae,0x842f83ef,0x840f83ef,0x840f83ef,0x83ef8c50,0x840f83ee,0x94709470,0x8c509450,0x8c2f8c30,0x94708c50,0x94509491,0x8c0f8c2f,0x83ee8c0f,0x83ee7bce,0x83ee8bef,0x945083ee,0x83ce9c71,0x83ee83ce,
-0x83ef8c30,0x7bce8c30,0x6b4c736d,0x736d736d,0x7bad7bae,0x736c738d,0x738d734c,0x6b2c738d,0x6b2c6b0c,0x7bad6b2c,0x734c7b8d,0x83ae7bad,0x736d734c,0x7b6d7bad,0x8c0f83ce,0x8bee83ae,0x83ce7b6d,0x8bef7bad,0x8bef8bef,0x83ce8c0f,0x94708c0f,0x7bad83ae,0x738d738d,0x7bce83ce,0x7b8d736c,0x7b8d7b8d,0x734c734c,0x736d736d,0x738d7bae,0x738d7bae,0x6b2c734d,0x6aeb62aa,
-0x62cb6b0c,0x6aeb6b0b,0x7b8e732c,0x734c736d,0x732c7b8d,0x6b0c732c,0x7b6d736d,0x83cf83ae,0x8c3083ce,0x738d840f,0x738d736d,0x62eb738d,0x630b6b2c,0x630b62eb,0x7bae734c,0x7bae83ef,0x840f8c50,0x736d7bae,0x6b4c6b2c,0x7bae7bae,0x7bae7bae,0x7bae738d,0x738d7b8d,0x6b4c738d,0x62eb630b,0x6b4c6b2c,0x7b8d738d,0x8c2f7b6d,0x7b8d8c2f,0x83ef736d,0x83ee840f,0x738d7bad,
-0x7bae840f,0x738d734c,0x83ef738d,0x83ef840f,0x7bae738d,0x7bae7bae,0x736d738d,0x736d6b4d,0x840f73ad,0x83ee8c30,0x6b4c738d,0x6b4c6b4c,0x736c738d,0x736d6b6c,0x738d738d,0x738d738d,0x736d7bce,0x7bae734c,0x736d73ad,0x736d736d,0x6b6c6b6c,0x6b4c6b6c,0x6b4c6b2c,0x738d738d,0x83ef7bae,0x842f83ef,0x73ad7bce,0x73ad738d,0x738d7bae,0x840f7bce,0x738d7bef,0x7bce7bae,
-0x9cb29491,0xa513c5f7,0x9cb28c50,0xb595ce17,0xef3cc5f7,0x9cb2ffff,0x949183ef,0x8c309471,0x8c3083ce,0x9470a4f3,0x8c2f8c50,0x94919470,0x8c708c50,0x9cb28c30,0x8c309451,0x94918c50,0x8c508c2f,0x7bce840f,0x947183ef,0x8c0f9cb2,0x7bad83ee,0x8c2f7bad,0x94708c30,0x8c309471,0x9470a4f2,0x9cd29cd2,0x8c2f9cb1,0x83ef8c0f,0x9470840f,0x840f8c2f,0x94919471,0x8c508c50,
-0x8c2f8c2f,0x8c50840f,0x8c2f8c30,0x94718c50,0x842f8c50,0x94718c30,0x840f9471,0x8c3083ef,0x840f8c50,0x7bce7bce,0x736d73ae,0x83ef738e,0x7bce7bce,0x738d738d,0x840f7bce,0x7bae83ef,0x840f7bce,0x94718c0f,0x8c309471,0x8c708c2f,0x94719470,0x9c919491,0x94509491,0x94709450,0x8c2f8c2f,0x9c918c2f,0x8c0f9c91,0x8c0f9450,0x83ee8c2f,0x8c0f83ee,0x8c0f8c2f,0x83ee8c0f,
-0x840f9470,0x8c309471,0x736d7bce,0x6b4c6b2c,0x736c7b8d,0x738d736d,0x6b2c6b4c,0x6b4c6b4c,0x6b2c6b0b,0x734c6b2b,0x6b2c6b4c,0x7b8d736d,0x7b6d7b8d,0x83ce7b8d,0x8c0f83ae,0x83ee9450,0x736c7b8d,0x8c0f83ce,0x8bef83ce,0x83ce8c0f,0x8c2f8c2f,0x83ce9c91,0x736c736c,0x7bad734c,0x7b8d736c,0x7b8d7bad,0x736c736c,0x7bae738d,0x736d7bae,0x630b736d,0x6b0b6b0b,0x62aa5a89,
-0x6aeb732c,0x62ca6aeb,0x734d6aeb,0x6b0c732c,0x62eb6aeb,0x62cb62cb,0x7b6d734c,0x83ef83ae,0x7bae7b8d,0x738d736d,0x6b4c738d,0x6b0b6b4c,0x6b0b62eb,0x83ce736d,0x8c308c0f,0x7bce8c30,0x7b8d7bae,0x738d7b8d,0x6b6c6b4c,0x736d738d,0x738d7bae,0x7bce736d,0x6b2c738d,0x736d736d,0x62eb5aca,0x6b4c736d,0x736c734c,0x7bad6b2b,0x83ce83ce,0x8c3083ee,0x83ee83ef,0x736d7bae,
-0x7bae7bae,0x734c738d,0x83ef83ef,0x840f8c30,0x738d736d,0x736d736d,0x738e738d,0x738d738d,0x8c50840f,0x94919470,0x736c840f,0x736c736c,0x6b4c6b4c,0x738d736d,0x738d7bad,0x6b4c736c,0x7bce7b8d,0x8c30840f,0x736d7bce,0x736d738d,0x736d7bae,0x6b4c6b4c,0x6b4c6b4c,0x738d736d,0x83ef73ad,0x8c50840f,0x7bae840f,0x736c738d,0x736d7bae,0x7bce73ae,0x6b6d73ae,0x6b6d738d,
-0x9471a4f3,0xce379cb1,0xffdeffbd,0xdeb9ffde,0x83ce9cb2,0xb5959cd2,0x8c308c50,0x8c509451,0x8c50840f,0xa4d29cd2,0x94708c50,0x94b1840f,0x8c519491,0x84109491,0x8c509471,0x840f83ef,0x94919491,0x840f840f,0x83ef7bce,0x9cd29cb2,0x840f8c2f,0x840f7bae,0x8c3083ef,0x94719cb2,0x9cb17bce,0xbdb69471,0x9491a4f3,0x94709491,0x8c509470,0x94708c50,0x840f8c50,0x842f840f,
-0x840f8c2f,0x94918c2f,0x840f8c70,0x8c308c30,0x8c508c50,0x840f8c30,0x94918c50,0x7bae8c30,0x7bee8430,0x738d738d,0x6b6d738d,0x83ef736d,0x7bce7bce,0x738d73ad,0x842f7bce,0x8c308c50,0x840f7bce,0x94919471,0x9c919491,0x94709491,0x94718c50,0x94709491,0x94719470,0x8c0f9470,0x8c0f8c2f,0x9cb18c2f,0x8c2fa4d2,0x94509470,0x8c0f9470,0x94509470,0x8c2f8c0f,0x94309450,
-0x94709430,0x94509cd2,0x83ee83ef,0x7b8e83ce,0x734c7bce,0x7bae736d,0x6b4c738d,0x736d6b4c,0x734c7bae,0x734c734c,0x7b8d7b8d,0x7b8d736d,0x7b8d7b8d,0x83ce7bae,0x83ae7bae,0x8c0f8c0f,0x7bad83ce,0x8bef7b8d,0x7b8d7b8d,0x942f9c70,0x83ce8c0f,0x7b8d8c2f,0x734c736c,0x630b62ea,0x736c7b6d,0x7bad7b8d,0x6b2c736d,0x7bce6b4c,0x736d7bce,0x630b736d,0x6b2c6b0b,0x62ca5aaa,
-0x6b0b6b0c,0x62ca62cb,0x62cb62ca,0x62cb62cb,0x62eb5aaa,0x62ca62ca,0x732c6aeb,0x734c6b2c,0x6b2c6b0b,0x736c6b0b,0x6b2c736d,0x736c736c,0x83ef7b8e,0x83ef8c10,0x734d7b8d,0x7b8d7b8d,0x6b2c6b4c,0x738d736d,0x6b4c6b4c,0x6b4c6b6c,0x738d6b6c,0x7bae7bae,0x6b4c736d,0x630b736d,0x630b5aca,0x734c7b8d,0x8c0f736c,0x7b8d83ce,0x736c7b8d,0x8c0f840f,0x734c736d,0x7bae630b,
-0x7bae7bce,0x738d7bae,0x73ad840f,0x7bae7bae,0x738d6b4c,0x6b4c738d,0x738d6b4d,0x738d738d,0x8c708c70,0x9cb19470,0x738d8c70,0x6b4c6b4c,0x6b4c736d,0x7bad736c,0x736c7bad,0x736c6b4c,0x7bce6b4c,0x842f842f,0x736d7bce,0x6b2c738d,0x736d738d,0x738d738d,0x738d738d,0x6b6d736d,0x7bae738d,0x7bce7bce,0x738d7bce,0x6b6c73ad,0x6b6d6b6d,0x738d738d,0x738d7bce,0x6b4c6b4c,
-0xb575ad13,0xbdd6b574,0xbd95ffde,0xad349471,0x94919cd2,0xa4d38c30,0x8c30a4d3,0x8c3083ef,0x94719471,0x94708c30,0x83ee9cb1,0x7bce8c2f,0x9cb29471,0x8c519492,0x8c3083ef,0x7bae83ef,0x9cd18c50,0x8c2f8c50,0x7bce83ef,0x840f83ef,0x8c709cd2,0x7bee83ee,0x840f83ef,0x9cd28c30,0x8c2f9491,0xdeb99c91,0xa4f3ad33,0xad349cb2,0x9491a4f2,0x94709470,0x83ef8c2f,0x7bad7bce,
-0x8c508c2f,0x9cb19491,0x840f8c30,0x83ee8c50,0x8c308c0f,0x8c308c50,0x9491840f,0x840f9cb2,0x840f83ef,0x73ad7bef,0x7bce73ae,0x7bae7bce,0x73ad7bce,0x83ee7bad,0x8c508c2f,0x9cd29491,0x8c2f8c50,0x9cd29491,0x94709491,0x8c2f8c50,0x94919491,0x94719491,0x94719470,0x94709471,0x94508c2f,0x94509470,0x9c919cb1,0x94509430,0x83ce8c2f,0x9c919470,0x83ae8c0f,0x945083ee,
-0xa4d29471,0x8c0fa4d2,0x83ce7bad,0x83cf8c0f,0x6b4c7bce,0x736d6b2c,0x736d738d,0x632b6b4c,0x6b0b6b2c,0x6b0b6b0c,0x8c0f7b8d,0x734c7b8d,0x736d734c,0x83ce83ee,0x7bae7bae,0x94307bad,0x7b6d8c2f,0x7b8d7b8d,0x7bad736c,0x8c0f8c0f,0x83ce7bad,0x7b8d732c,0x7b8d7b8d,0x6b2b7bad,0x7b6d736c,0x7b8d7bae,0x736d738d,0x7bae736d,0x736d83ef,0x630b6b2c,0x6b0b6b0c,0x62eb62ca,
-0x62cb62aa,0x62ca62aa,0x5a8a62ca,0x62cb62aa,0x732c6aeb,0x6b0b6b0c,0x6b0c62eb,0x62eb62eb,0x7b8d6b2b,0x734c736d,0x7b8d734c,0x83ee83ef,0x7b8d8c0f,0x62ca62eb,0x7b8d6b0b,0x736d7bae,0x6b2c6b4c,0x738d736d,0x738d738d,0x630b6b4c,0x736d6b2c,0x738d7bae,0x6b4c6b4c,0x62eb6b2c,0x630b630b,0x83ef7bae,0x94708c0f,0x736c83ee,0x734c734c,0x83ee7b8d,0x738d7bce,0x7bae734c,
-0x736d738d,0x7bce738d,0x7bae7bae,0x6b6c7bae,0x736d6b4c,0x6b2c736d,0x736d6b4d,0x6b6c738d,0x7bce73ad,0x94918c30,0x7bad8c50,0x738d738d,0x6b6c736d,0x73ad736c,0x736c738d,0x6b4c6b4c,0x736d6b6c,0x73ad736d,0x736d7bae,0x6b2c6b4c,0x736d736d,0x738d738d,0x738d738d,0x738d73ae,0x738d736d,0x738d7bae,0x6b4c738d,0x738d736d,0x6b6c738d,0x738d736d,0x73ae7bae,0x6b4c6b6d,
-0xb595c5f6,0x8c2fa4f2,0xbdb5ad33,0xa4f3a513,0xa513a4f3,0x947183ef,0xad14a4f3,0x83ef8c30,0x9cd29cb2,0x94909450,0x94919491,0x842f9470,0x8c507bce,0x8c519471,0x83ef8c30,0x83ef8c50,0x947083ee,0x8c509471,0x83ef840f,0x83ef7bae,0x94719cb1,0x840f7bae,0x7bee8c30,0x9cb2840f,0x9cb2a4f3,0xf77c9cd2,0xa4f2ad54,0xa5139cb2,0x9cb19cf2,0x8c309491,0x94918c50,0x83ee8c50,
-0x840f8c30,0x94708c50,0x840f8c2f,0x9cd29cb2,0x840f8c30,0x9c919471,0x8c308c30,0x9cb29492,0x7bee840f,0x7bee7bce,0x73ae7bce,0x7bce738e,0x73ad7bce,0x8c2f7bce,0x8c709470,0x94919470,0x8c509471,0x9cb28c50,0x8c309cb1,0x8c508c2f,0x94919491,0xa4d29cd2,0x94719cb2,0x9c919470,0x94919450,0x8c2f9450,0xa4b29450,0x94509c71,0x83ee8c0f,0x8c2f83ce,0x8c0f9470,0xa4f29470,
-0x9cb2a4d2,0x7bae8c30,0x83ae7bae,0x7bad840f,0x738d738d,0x738d738d,0x6b6c736d,0x6b4c6b4c,0x6b2c6b0b,0x6b2c734c,0x8c0f7b8d,0x734d7bae,0x83ae7b8d,0x83ef7bae,0x736c83ae,0x83ce83ce,0x83ae83ee,0x7b8d7bad,0x734c7b6d,0x83ee83ce,0x7b8d7b8d,0x736c736c,0x7bce734c,0x736d7bae,0x7b8d736c,0x7b8d7bae,0x7bae7b8e,0x738d736d,0x6b2c7bae,0x630b630b,0x6b0b6b0b,0x6b0b62eb,
-0x62cb62cb,0x5aaa62ca,0x5aaa5aaa,0x6b2c62ca,0x6b0c6b0b,0x62eb6b0b,0x6b2c6b0b,0x734c734c,0x738d7bad,0x8c0f7bae,0x8c0f8c2f,0x7b8d83ce,0x6b4c6b2c,0x734c6b2c,0x7bae736d,0x736d7bae,0x738d7b8d,0x736d738d,0x738d6b6c,0x736d736d,0x6b4c6b4c,0x6b4d736d,0x6b2c6b2c,0x6b4c630b,0x738d736d,0x8c2f83ef,0x736c83ee,0x6b2b6b0b,0x7bad736c,0x83ce736c,0x738d840f,0x6b0b736d,
-0x736d6b4c,0x7bce738d,0x7bce73ad,0x736d7bce,0x736d736d,0x6b4c736d,0x738d738d,0x6b6c736d,0x7bae736d,0x8c508c2f,0x736c83ee,0x738d6b4c,0x736c6b6c,0x738d738d,0x738d738d,0x6b4c6b6c,0x73ad736d,0x6b4c738d,0x738d736d,0x6b4c6b4c,0x6b6d736d,0x6b6d736d,0x6b6d6b4c,0x7bae73ae,0x736d6b4d,0x6b4d738d,0x6b4c6b4c,0x73ad6b4c,0x6b6d840f,0x7bce738d,0x73ce73ae,0x6b6d73ae,
-0x9cb1ad33,0x9cb2a4f2,0xad549471,0xa513c617,0x94719cd2,0x9cb29cb2,0x8c509451,0x9471a4f3,0x9cb283ee,0x8c50a4d2,0x8c508c4f,0x8c509471,0x83ef83ef,0x94718c30,0x94719471,0x8c50840f,0x7bce9470,0x94918c50,0x7bae7bee,0x9cb27bae,0x7bee8c50,0x842f840f,0x8c50840f,0x9cd28410,0xb554a513,0xbdb5ad13,0x9cb1b575,0x9cb2a4d2,0x94919cd2,0x840f9470,0xa5139491,0x9cd29cd2,
-0x94919491,0x840f8c50,0x840f83ee,0xa4f2a4f2,0x8c509450,0x9cd29471,0x8c109cb2,0x9cb28c10,0x842f9491,0x7bce7bce,0x7bce7bce,0x7bce7bce,0x7bee7bce,0x8c50840f,0x840f8c50,0x840f840f,0x9cb29471,0x94919450,0x94709cb1,0x8c709471,0x94919471,0x94709471,0x94709470,0x94509470,0x94509cb1,0x8c0f7bce,0x8c0f83ee,0x8c2f9470,0x94708bef,0x83ee83ce,0x7bae8c2f,0x94708c0f,
-0x94719470,0x83ae8c0f,0x83ce83ce,0x7bce8c30,0x738d736d,0x736d738d,0x6b4c736d,0x6b4c6b2c,0x736d6b2c,0x734c734d,0x7b8d7b6d,0x83ae7b8e,0x7bae83ae,0x7b8d7bad,0x83ae83ce,0x7bad7b6d,0x83ce83ce,0x734c83ce,0x7b8d7b8d,0x8bef7b8d,0x83ee83ce,0x7b8d83ee,0x7bad7b8d,0x738d83ef,0x734c7b8d,0x7b8d736d,0x736d7bae,0x738d6b2c,0x6b2c734c,0x6b2c6b0c,0x62eb6b0b,0x5a8962ca,
-0x6b0b62eb,0x62eb6b2c,0x62eb62eb,0x6b0c62ca,0x6b0b6b2c,0x62cb62eb,0x734d6b2c,0x7bae7bae,0x8c0f9491,0x7bae83ef,0x734c734c,0x6b2b734c,0x736c6b2c,0x7b8d736d,0x7bae7b8d,0x7b8d83ce,0x738d736d,0x736d738d,0x7bce738d,0x6b6d738d,0x6b2c6b4d,0x6b4d736d,0x736d734d,0x738d6b2c,0x7bce83ee,0x6b2c736c,0x6b4c734c,0x734c6b2b,0x7b8d734c,0x7bad7bad,0x738d83ee,0x736d734c,
-0x738d6b4c,0x7bce7bce,0x73ae840f,0x7bce7bae,0x73ad738d,0x738d7bae,0x736d738e,0x73ad736d,0x738d7bce,0x7bae7bae,0x736c7b8d,0x7bad6b4c,0x736c738d,0x738d6b4c,0x738d738d,0x736d736d,0x738d6b4c,0x6b2c736d,0x7bce736d,0x736d736d,0x6b4c6b6d,0x73ae6b6d,0x6b6d73ae,0x736d6b6d,0x6b2c6b4d,0x62eb62eb,0x738d632c,0x73ae6b4c,0x738d7bce,0x738d6b6d,0x7bce7bce,0x738e738d,
-0x9cb29cd2,0xa4f39c91,0x9471a4d2,0xbdb5a513,0x9cd2b574,0xa4d29cb2,0x8c0f9450,0x9cd29450,0x94709470,0x9cb19c91,0x8c2f9cb1,0x8c50840f,0x83ef83ef,0x94718c30,0xa4f3b575,0x8c309cb2,0x94918c70,0x83ef842f,0x736d83ef,0x83ef7bae,0x8c30ad34,0xa4f3840f,0x7b8d840f,0xa4f38c30,0xb595c5f7,0x9491ad34,0xa5139491,0xad749491,0x94b29cf3,0x8c708c70,0x8c508c50,0x8c509470,
-0x840f8430,0x8c508c71,0xa4f39491,0x94709491,0x94919cb2,0x8c2f8c50,0x94719491,0x8c5083ef,0x947094b1,0x738d83ce,0x840f7bae,0x738d738d,0x840f738d,0x8c50840f,0x8c309491,0x840f83ef,0x9c9183ee,0x9cd2a513,0x9c919cb1,0x94719450,0x9c919491,0x8c2fa4d2,0x94509450,0x9c919450,0x945083ee,0x8c2f8c0f,0x8c0f8c2f,0x94708c0f,0x8c4f9450,0x83ee83ee,0x83ef83ee,0x94719450,
-0x8c309491,0x94507bae,0x83ce8c30,0x83ef83ee,0x736d83ce,0x734c6b4c,0x6b2c6b4c,0x6b0c6b2c,0x734d6b2c,0x7b8d83ae,0x736d83ae,0x83ad83ae,0x8bee83ee,0x83ce83ce,0x8bee8c0f,0x7b6c7b6d,0x734c7bad,0x83ce7bad,0x7b8d7bad,0x83ee7b8d,0x83ee736c,0x734b83ee,0x83ee7bad,0x8c0e8c0f,0x7bad83ce,0x736c7b8d,0x7b6d7b8d,0x738d7b6d,0x6b2c736d,0x6b2c736d,0x62ea6b2c,0x6aeb6b0b,
-0x734d6b2c,0x6b2c736d,0x736d62eb,0x6b2c6b4c,0x7bae6b4c,0x736d6b4c,0x83ef7bae,0x8c309450,0x736d8c50,0x6b4c736c,0x6b4c6b4c,0x6b2c630b,0x738d6b2c,0x7bad7bad,0x7bae736c,0x736c7bce,0x6b4c736d,0x7bae7bae,0x738d736d,0x73ad7b8d,0x6b4c6b4c,0x6b2c6b4c,0x7bae736d,0x6b0b734c,0x73ad736c,0x738d736c,0x630b6b4c,0x83ce6b4c,0x7bad738d,0x736d7bce,0x7bee7bad,0x738d83ee,
-0x738d6b4c,0x7bce7bce,0x840f83ef,0x7bce83ef,0x73ad7bce,0x7bae738d,0x6b6c73ad,0x738d6b4d,0x734c738d,0x6b4c6b4c,0x738d736c,0x73ad738d,0x738d738d,0x738d738d,0x738d6b2c,0x840f8c30,0x738d738d,0x6b4d736d,0x6b4d6b4d,0x738d736d,0x6b4d6b6d,0x738e738d,0x738d738d,0x6b4d736d,0x6b2c6b2c,0x6b2c6b2c,0x738d6b4c,0x7bee7bee,0x73ae7bee,0x73ad738d,0x840f73ae,0x6b4c7bce,
-0x9cb2a513,0xa4f39cb2,0xad34ad33,0x94919cb1,0xad54bdd6,0xad13b554,0x83ee9450,0x94709c91,0x9450a4d2,0x94508c0f,0x94919491,0x8c509491,0x840f9cb2,0x8c508c30,0xa5139cb2,0x94919cb2,0x8c508c50,0x840f9491,0x94717bae,0x94719491,0x738d9471,0x94917bae,0x7bce83ef,0x9cd28c30,0xc5f6bd95,0x94b19471,0x94919cd2,0x9cd29cf3,0x8c71a513,0x8c508c70,0x840f8c50,0x842f842f,
-0x840f7bee,0x842f7bef,0xad549cd2,0x8c2fa4f2,0x8c50842f,0x8c2f842f,0x949194b1,0x8c309491,0x83ef840f,0x83ce9450,0x7bae6b4c,0x6b4c840f,0x7bce73ad,0x840f7bcf,0x8c3083ef,0x83ef8c50,0x94708c50,0xad34ad33,0x9c919cb1,0x9cb1a4d2,0x8c2f9450,0x94709470,0x8c0f9450,0x8c509491,0x8c0e8c2f,0x83ee8c2f,0x8c0f83ee,0x8c2f83ee,0x8c2f8c50,0x7bad7bad,0x83ef7bce,0x8c508c30,
-0x8c50840f,0x7bae8c30,0x8c3083ef,0x8c0f7bad,0x738d7bce,0x736c736d,0x736d734d,0x6b0c734d,0x732c6b0b,0x7b8d7b6d,0x7b8d7bae,0x83ae83ae,0x8c0f83ce,0x83ce8c0f,0x83ce83ae,0x736c7b8d,0x736c734c,0x83ce736c,0x83ce83cd,0x94509470,0x83ee7bce,0x6b2b83ee,0x7bad736c,0x9c909450,0x83cd83ee,0x736c7b8d,0x7b6d7bad,0x734c736c,0x734c6b2c,0x732c736c,0x734c736c,0x734c6b2b,
-0x6b0c6b2c,0x62eb6b4c,0x6b2c630b,0x6b4c6b4c,0x7bae736d,0x7bae7bce,0x7bce7bae,0x9c9183cf,0x738d9471,0x7bad7b8d,0x736d736d,0x736d736d,0x734c736d,0x7bae83ce,0x7bad7bad,0x736d738d,0x736d7b8d,0x7b8d736d,0x736d736d,0x738d738d,0x736d738d,0x738d738d,0x734c738d,0x6b2c6b0b,0x7bad6b4c,0x7bad7bcd,0x6b4c6b2c,0x840f7bce,0x840f7bee,0x73ad7bee,0x7bce738d,0x7bce7bee,
-0x738d7bad,0x7bce738d,0x83ef83ef,0x7bce83ef,0x840f8c30,0x738d7bce,0x6b4c6b6c,0x630b630c,0x6b4c736d,0x6b4c6b4c,0x738d736c,0x73ad738d,0x738d738d,0x7bce7bae,0x7bae738d,0x94718c50,0x736d736d,0x6b4d738e,0x73ae6b4d,0x73ae738e,0x6b6d738e,0x6b6d6b6d,0x73ae736d,0x6b4c738e,0x630c6b4d,0x62eb62eb,0x6b4c630b,0x7bce738d,0x840f842f,0x73ae7bce,0x7bef738d,0x7bce83ef,
-0x9cb2a513,0x9cb29cb2,0xad33a4f3,0x9cb2a4d2,0xce37ad33,0xb574c5d6,0x94709cb1,0xa4d29c91,0xa4d29cb1,0x94508c0f,0x9cd29c91,0x8c508c50,0x94719471,0x8c3083ef,0x9cb29cb2,0x9cb2a4f3,0x7bce8c50,0x83ef8c30,0x840f6b4c,0x8c509cd2,0x6b2c6b4c,0x7bce736d,0x945083ef,0x8c508c50,0xa4f3ad54,0x94919491,0x9cd29491,0x94b29cd2,0x9cd29cd2,0x8c509471,0x94918c50,0x947083ef,
-0x840f9471,0x7bce7bee,0xbdd6a4f2,0x8c309cb2,0x738d83ee,0x945083ce,0x840f9491,0x94919491,0x9c918c50,0x8c509cb2,0x736d83ef,0x6b4c736d,0x7bae736d,0x84107bcf,0x8c5183ef,0x840f9471,0x8c309471,0xad349cb1,0x9cb2a4f3,0x94919cd2,0x94509450,0x94709470,0x8c509470,0x94508c0f,0x8c2f8c2f,0x840f83ee,0x83ee83ef,0x83ce8c2f,0x83ee7bce,0x7bce8c30,0x8c307bae,0x8c308410,
-0x840f9cb2,0x7bce7bce,0x83ce83ce,0x83ce7bad,0x83ef83ef,0x7bce83ef,0x734c736d,0x734d734d,0x7b8d736d,0x7bae7b8d,0x7b8d7b8d,0x83ee83ae,0x83ee83ce,0x8c0f8c2f,0x83ce83ce,0x83ce83ce,0x7bad736c,0x7b8d7b8d,0x9c918c0f,0xb554a4d2,0x7bad9450,0x734c7b8d,0x6b2b734c,0x9c918c0f,0x8c2f8c2f,0x7b8d83ee,0x736d7bad,0x7bad736d,0x734c7bae,0x83ee738d,0x6b2b734c,0x734c6b4c,
-0x6b0b734c,0x6b0b6b2c,0x736d734c,0x83ce7bae,0x736d7bae,0x736c736d,0x736d736c,0x9c91736c,0x840f9470,0x7bce83ef,0x6b4c736d,0x7bce736d,0x738d840f,0x7bce840f,0x83ef7bce,0x7bce7bae,0x83ef83ef,0x7bae738d,0x736d738d,0x7bae7bae,0x734c7bae,0x6b4c6b2c,0x6b4c736d,0x6b4c6b2c,0x736c6b4c,0x736d738d,0x6b2c62ea,0x738d7bce,0x7bce738d,0x738d738d,0x73ad736c,0x738d738d,
-0x7bee842f,0x83ee7bce,0x8c30842f,0x83ef840f,0x7bae7bce,0x6b4c738d,0x738d6b4d,0x736d738d,0x6b4c736d,0x734c734c,0x738d736d,0x738d738d,0x738d738d,0x7bce738d,0x738d7bae,0x83ef83ce,0x6b2c7bae,0x738d6b6d,0x73ae73ae,0x738d6b4c,0x6b6d738d,0x6b6d6b4c,0x738d6b6d,0x6b2c738d,0x6b0c6b2c,0x6b2c630b,0x632c6b4c,0x7bef6b6d,0x7c0f840f,0x73ad7bae,0x7bae738d,0x7bce7bae,
-0x9cd2a4f3,0x9cb29cd2,0x9c91a4d2,0xb554ad33,0xb574ad54,0xd658d678,0x9450a513,0x9450a513,0xa4d29450,0x94509cb1,0x8c2fa4d2,0x8c0f8c30,0x83ef83ef,0x7bce840f,0x8c509450,0xa4f39491,0x840f9471,0x734c83ef,0x736d738d,0x83ef83ef,0x630b738d,0x738d734c,0xa4f3840f,0x8c309cd2,0x9cb2ce38,0x94719491,0x9cf28c30,0x8c71a513,0x8c5094b2,0x947194b1,0x8c508c50,0x947094b1,
-0x8c509491,0x8c50840f,0xa513a4f2,0x840f9471,0x736c83ee,0x8c0f83ee,0x83ef8c30,0x9471842f,0x9c929cb2,0x94918c50,0x7bae8c50,0x736d6b4c,0x83ef6b4d,0x8c508410,0x8c518c51,0x94918c30,0x8c2f9450,0x9cd28c30,0x9471a4d2,0x9c919c91,0x94509c91,0xa4f29cd2,0x94919470,0x8c0f8c2f,0x83ee8c2f,0x83ee8c2f,0x840f840f,0x7bce83ef,0x7bce7bad,0x7b8d83ef,0x83ef7b8d,0x83ef83ef,
-0x8c308c50,0x736d738d,0x7bae7b8e,0x7bad7bae,0x7bce7bae,0x7bce83ee,0x734c736d,0x83cf7b8d,0x83ae83ae,0x83ef83ce,0x83ee83ee,0x8c2f8bef,0x8c0f8c0f,0x83ce8c0f,0x7bad7b8d,0x8c2f83ce,0x734c83ce,0x8c0f83ce,0x9c9183ee,0xa4d2a4f2,0x736d9450,0x7bad734c,0x6b4c7b8d,0x83ee7b8d,0x8c2f8c0f,0x738d83ee,0x734c7b8d,0x7b8d734c,0x734d736d,0x83ef734c,0x6b2c7b8d,0x738d6b0b,
-0x736d738d,0x83cf7b8d,0x7bae83cf,0x6b0b6b2c,0x6b2c6b4c,0x738d6b2b,0x7bad7bae,0x9c917b8d,0x7bae7bad,0x7bae7bce,0x6b4c736d,0x840f736d,0x7bce9cb2,0x7bae7bae,0xa4d28c30,0x734c83ef,0x7bce7bae,0x7bae736d,0x8c3083ef,0x736d83ce,0x734c734c,0x630b6b4c,0x6b2c630b,0x738d6b4c,0x736c736c,0x736c6b4c,0x6b6c630b,0x736c7bce,0x738d6b4c,0x736c736c,0x7bce73ad,0x73ad738d,
-0x8c508c50,0x83ef840f,0x840f83ef,0x738d7bce,0x6b4c736d,0x6b4c6b4c,0x738d736d,0x7bce7bae,0x6b4c736d,0x6b4c6b4c,0x6b6c6b6c,0x6b6c6b4c,0x7bae73ad,0x7bae7bae,0x7bae7bce,0x736d738d,0x736d736d,0x73ae73ae,0x7bcf7bae,0x6b4c738d,0x6b4c6b6d,0x6b6d6b4c,0x6b4c6b4c,0x6b2c6b4c,0x6b4c6b2c,0x6b4c6b4c,0x6b4c6b4c,0x73ce6b4c,0x7bee7bee,0x73ad738d,0x73ae73ae,0x736d736d,
-0xa4f3a513,0x9cd29cd2,0xa4d2a4f2,0xbdb6ad54,0xa513b574,0xce37b575,0x9cb2b554,0x8c2f8c30,0x94509470,0xa4d29470,0x8c0f9450,0x8c308c30,0x83ef8c30,0x8c0f8c50,0x8c308c0f,0xad139cd2,0x8c50ad13,0x7bae9cb1,0x83ce7bae,0x83ee83ee,0x736d8c50,0x83ee83ce,0x8c507bad,0xad33a513,0x9470ce17,0x94718c0f,0x9cd28c50,0xa4f3ad54,0x8c509cb2,0x9cd28c30,0x8c508c70,0x94919471,
-0x8c508c30,0x9cb29491,0x840f9470,0x8c508c2f,0x7bce8c50,0x83ee7bce,0x8c308c30,0x840f83ce,0x9c928c30,0x83ef83ef,0x84108c30,0x7bcf7bae,0x8410738e,0x8c518c30,0x8c319471,0x9cb28c10,0x9cb2ad13,0x94719450,0x9cb19470,0x9cb2a513,0x94919470,0xad339c91,0x94709cb1,0x83ee9450,0x8c0f8c0f,0x83ef8c2f,0x83ef83ef,0x83ee7bce,0x840f83ef,0x9470840f,0x83ef8c50,0x8c308c10,
-0x7bcf7bae,0x7bae8c30,0x83ce736d,0x8c0f8c0f,0x7bae7bae,0x7bad7bae,0x7bae7b8e,0x83ce83ae,0x7bad7b8d,0x8bef83ce,0x83ce8c0f,0x83ae83ce,0x83ef7bad,0x7b8d83ce,0x83ce7bae,0x83ce83ae,0x8bce9450,0x8bef83ae,0x8c1083ae,0x9451a4d2,0x734c736d,0x736d6b2c,0x7bae734c,0x734c7bad,0x8c0f83ee,0x7bae83ee,0x7b8d83ee,0x734c734c,0x736d6b2c,0x83cf734d,0x83ce7bae,0x8c2f83ee,
-0x8c0f8c30,0x736d7b8d,0x734c736c,0x630b6b0b,0x6b2c6b0b,0x83ee736d,0x83ce8bef,0x9cd283ee,0x738d7bad,0x840f83ce,0x736c7bae,0x736d738d,0x6b4c736d,0x736d6b2c,0x94507bae,0x83ef8c30,0x8c3083ef,0x840f8c50,0x7bce7bae,0x738d738d,0x738d7bae,0x62eb6b2c,0x738d6b2c,0x6b2c734c,0x736c6b2c,0x6b4c6b4c,0x6b2c6b2c,0x738d738d,0x738d6b4c,0x6b4c736d,0x7bae7b8d,0x7bce7bce,
-0x8c2f840f,0x840f8c2f,0x7bae7bce,0x738d73ad,0x6b6c738d,0x736d6b4c,0x736d736d,0x7bae736d,0x6b4c736d,0x736d736d,0x736d736d,0x736d6b4c,0x738d738d,0x738d738d,0x7bae7bae,0x6b4c736d,0x6b6d736d,0x7bce6b6d,0x6b6d7bce,0x738d736d,0x6b4c6b4c,0x6b4c6b4c,0x6b2c6b2c,0x6b2c6b6c,0x7bae736d,0x6b2c738d,0x632c6b2c,0x6b4c632c,0x83ef840f,0x73ae73ae,0x7bae7bae,0x738d736d,
-0x9cb2a4d2,0x9cd29cb2,0xb5759cd2,0xb574ad13,0xa4f3bdb5,0x9cd29cd2,0xad33b554,0x94709cb2,0x8befa4b2,0x9470840f,0x94509cb1,0x8c508c50,0x8c508c30,0x9471840f,0x840f8c30,0x94719471,0x94919cb2,0x8c309491,0x8c508c0f,0x8c0f8c2f,0x7bce8c2f,0x7b8d7bce,0x7bae736c,0xb5549470,0x9cb1ce38,0x8c508c50,0x94718c70,0x9cb28c50,0x94719491,0x8c508c30,0x9470a4f2,0x94919470,
-0x8c508c50,0x9cb29cf2,0x8c2f8c2f,0x94718c0f,0x94509471,0x83ef7bce,0x840f8c30,0x8c30840f,0x9c928c10,0x7bae9451,0x841083ef,0x84108c30,0x84107bcf,0x94718c51,0x94718c51,0x9c929471,0xb595b575,0x9470a4f3,0x9cb29470,0xa4d2a4f2,0x9c919c91,0x9cb18c50,0x8c2f9c91,0x8c2f83ee,0x94508c2f,0x840f83ee,0x83ce83ef,0x8c2f840f,0x83ee7bce,0x94919470,0x840f9451,0x8c307bcf,
-0x7bce8c30,0x8c0f840f,0x7b8d7b8d,0x83ce8c30,0x83ee7bad,0x736c7bce,0x7bae736d,0x732c7b8d,0x7bae736d,0x83ef83ef,0x7b8d83ce,0x7bad7b8d,0x83ae7b6d,0x7bad83ae,0x83ef83cf,0x7b6d7b6d,0x83ae7b4d,0x7b8d7b8d,0x8c0f83ef,0x7b8d83ce,0x7bae7b8d,0x734c736d,0x83cf6b2c,0x83ce840f,0x7b8d736c,0x83ce83ce,0x736c83ee,0x736d734c,0x736d734c,0x947183ce,0x83ee8c30,0x736c7bce,
-0x7b6d7b8d,0x62eb732c,0x6b0b6b2c,0x62eb6b0b,0x734c6b2c,0x7bad7bae,0x83ce83ae,0x9c9183ee,0x738d736c,0x83ee7b8d,0x738d83ce,0x736d738d,0x736d736d,0x7bce7bae,0x83ef83ef,0x94719471,0x7b8d7bce,0x736d7bae,0x738d736d,0x736d736d,0x736d7b8d,0x62eb6b2c,0x6b4c630b,0x6b4c6b2c,0x83ef6b4c,0x738d7bce,0x6b2c6b2c,0x7bae738d,0x7bce738d,0x738d83ef,0x7bae7bce,0x83ce83ee,
-0x7bce7bce,0x840f83ee,0x7bad7bee,0x83ef7bce,0x6b6c738d,0x736d6b4c,0x7bae738e,0x7bae7bae,0x6b6c736d,0x738d736d,0x738d738d,0x7bae738d,0x73ad7bae,0x7bae7bae,0x73ad7bce,0x7bae738d,0x738d6b4c,0x6b6d6b4c,0x738d738d,0x6b6d7bae,0x6b6d6b6d,0x630b632b,0x6b4c630b,0x6b4c73ad,0x83ef736d,0x7bae840f,0x6b2c6b4c,0x6b6d6b4c,0x7bef7bef,0x7bae7bae,0x7bae738e,0x7bae738d,
-0x9c919491,0xa4f3a4f3,0xad54a4d2,0x9c919cb1,0xad54ad54,0x94719cd2,0xad549491,0x9cb1ad34,0x94509cb1,0x8c5083ee,0xa4f29cb1,0x8c308c0f,0x94718c50,0x94719491,0x94919450,0x8c30840f,0x8c2f8c30,0x9c918c30,0x840f8c0f,0x840f9471,0x7bae83ef,0x6b2c6b0b,0x83ef7b8d,0x947183ef,0xa513c5f6,0x7bce8c30,0x8c508c30,0x8c508c50,0x8c308c50,0x8c70840f,0x9cb18c70,0x8c309491,
-0x9cb28c50,0x9cd29491,0x94709cb2,0x8c0f9470,0x9c918c2f,0x840f9470,0x83ef83ef,0x8c508c30,0x83cf8c10,0x8c309471,0x84107bcf,0x94519c92,0x84108410,0x9cb29492,0x94918c51,0x94919c92,0xad549cb2,0x9cd2b574,0x8c309471,0x9cd28c30,0x9450ad33,0x94508c2f,0x8c0f8c0f,0x8c2f8c2f,0x840f8c50,0x840f840f,0x8c307bce,0x8c5083ef,0x83ce8c2f,0x7bce8c0f,0x8c5083ef,0x8c308410,
-0x8c509471,0x7bae7bae,0x7bae8c0f,0x734c7bae,0x8c507bae,0x7b8d8c30,0x7bae736d,0x7b8d83ae,0x83ce7b8d,0x83ce83ee,0x83ce7bae,0x8c0f83ef,0x83ce83ef,0x7bae83ae,0x7bae83ae,0x7b6d736d,0x7b6d7b6d,0x83ce83ef,0x8c3083ce,0x736d83ce,0x7bae83ce,0x6b2c734c,0x736d6b2c,0x8c307bce,0x7bad738d,0x8c0f83ee,0x7bae8c0f,0x7bce738d,0x83ef83ce,0x7bae736d,0x6b2c840f,0x6b0b62eb,
-0x7b6d6b2c,0x734c736c,0x734c7b6d,0x734c736c,0x736c736c,0x7b8d7b8d,0x7bad7bad,0x8c2f8c0f,0x7bad736c,0x736c6b4c,0x738d7bae,0x7bae7b8d,0x8c30840f,0x8c509451,0x734d83ef,0x7bae7bae,0x738d7b8d,0x7b8d7bce,0x6b4c738d,0x6b2c736d,0x630b736d,0x5aaa5aca,0x734c630b,0x6b4c6b4c,0x840f736d,0x738d7bce,0x6b4c6b4c,0x738d736d,0x7bae738d,0x7bae7bae,0x7b8d7bae,0x738d7b8d,
-0x738d7bad,0x7bce7bad,0x738d7bce,0x7bae738d,0x6b6c6b6c,0x736d736d,0x7bae738d,0x73ae73ae,0x6b4c736d,0x736d736d,0x738d736d,0x7bce73ad,0x738d73ae,0x73ae73ae,0x738d738d,0x738d736d,0x738d73ae,0x73ad6b6d,0x73ad7bce,0x6b6d738d,0x6b4c6b6d,0x6b2c630b,0x734c6b2c,0x734c7bae,0x83ef736d,0x83ef8c30,0x6b4c738d,0x73ae6b6d,0x73ae738d,0x7bce7bae,0x7bce7bae,0x7bae7bae,
-0x9cb29cb2,0x9cb2a4f3,0x9cb2a4d2,0x94919cd2,0xa4f2840f,0x9471a4f3,0x94508c2f,0x9491a4f2,0x94709c91,0x83ee9470,0x9cd29471,0x840f9471,0x94919491,0x94719c91,0x94718c50,0x8c509cd2,0x8c0f83ee,0x8c509471,0x8c308c30,0x8c2f8c30,0x6b4c83ef,0x83ef6b4c,0x7bce7b8d,0x8c508c30,0x9cb29470,0x8c2fa4f2,0x9471840f,0x94919491,0x840f8c30,0x8c508c50,0x94919470,0x94709471,
-0x94919471,0x94719471,0x9cb19cb2,0x8c508c50,0x8c0f8c0f,0x94509c91,0x7bce8c50,0x8c3083ce,0x7b8e7b8e,0x8c518410,0x8c308410,0x94918c30,0x94719471,0x9cd29cd3,0x8c508c30,0x9cb29471,0x94919491,0xad33a513,0x9471a4d2,0x9cb19450,0xa4d2a4f2,0x8c0f8c0f,0x8c2f8c50,0x8c509450,0x840f8c50,0x8c507bce,0x83ef7bae,0x7bae7bce,0x8c3083ef,0x83ef7bae,0x83ef83ef,0x94719492,
-0x83ef8c51,0x840f8c30,0x94519471,0x7bae83ce,0x8c307bae,0x738d842f,0x736d6b4c,0x7b8e7b8e,0x83ce83ce,0x7bad7b6d,0x8c0f7b8d,0x83ce83ce,0x7b8d7b6d,0x83ce83cf,0x83cf83ae,0x734d7bae,0x8bce83ae,0x8c308bef,0x83ef8c10,0x7b8d83cf,0x7b8e83ce,0x736d738d,0x7b8d83ce,0x947183ef,0x7bae83ef,0x8c5083ef,0x83ef9471,0x736d738d,0x6b4c736d,0x6b4c6b2c,0x6b4c83ce,0x62eb6b4c,
-0x7b8d6b0b,0x734c734c,0x732c6b2b,0x7bad736c,0x7bad736c,0x732c6b2b,0x736c7b6d,0x94509c91,0x736c736c,0x738d630b,0x8c3083ef,0x94509491,0x7bce8c50,0x736d6b4c,0x7b8e734d,0x736d7b8e,0x7bce7bae,0x734c7bce,0x6b2c6b2c,0x736d7bce,0x6b0b6b0b,0x630b6b0b,0x738d6b4c,0x6b4c734c,0x738d734c,0x6b4c6b4c,0x736d6b4c,0x6b4c738d,0x738d7bae,0x7bae736d,0x7bce7bae,0x738d7b8d,
-0x736c736c,0x738d738d,0x7bad7bad,0x6b4c738d,0x6b4c6b4c,0x738d736d,0x6b4c736d,0x738d6b6d,0x736d736d,0x736d736d,0x738d6b6d,0x7bef73ae,0x7bae7bae,0x7bae7bee,0x7bce7bae,0x6b6d7bae,0x73ae6b4c,0x7bce7bee,0x73ad73ae,0x6b6d738d,0x632c6b6d,0x738d630b,0x6b4c736d,0x736d736d,0x738d738d,0x7b8d7bae,0x6b2c6b4c,0x738d6b4c,0x738d736d,0x7bef73ae,0x840f83ef,0x7bce83ef,
-0x9cb2a513,0xa4f39cd2,0x9cd2a4d2,0x94719cd2,0x9c919471,0xa4f39491,0x94709471,0xad339470,0x9c91ad13,0x8c308c2f,0x94918c50,0xa4d28c30,0x8c309491,0x94509471,0xa4d29471,0x94509cb1,0x83ee83ee,0x83ee8c0f,0x8c508c2f,0x83ce8c2f,0x7bad736c,0x7bce83ee,0x83ee840e,0x9cb1840f,0x8c2f8c30,0xa4f3a4f3,0x8c308c50,0x94918c30,0x8c709491,0x94719491,0x94919491,0xa4d29cb1,
-0x8c509cb2,0x94919470,0x9cb29471,0x94709450,0x8c0f8c2f,0x94718c30,0x8c0f9471,0x7bce83ef,0x94509450,0x83ce7b8d,0x9cb29451,0x9c919471,0xa4f3ad34,0x94719471,0x94719cb2,0x9cb18c30,0x9cb19cd2,0xad339cb2,0x9cb1b575,0x9cd29470,0xad13a4f2,0x9c919cb1,0x8c509450,0x9cb19cb1,0x83ef83ef,0x7bae8c30,0x83ef840f,0x8c5083ef,0x8c309450,0x840f8c0f,0x94719471,0x94928c31,
-0x7bcf8410,0x83ef9471,0x945183ce,0x94919471,0x8c309471,0x73ad7bee,0x738d7bae,0x7bae7b8d,0x8c0f8c30,0x7bce8c0f,0x83ee736d,0x738d8c0f,0x6b2c734c,0x7b8d6b0c,0x83ce83ef,0x736d7b8d,0x8bef83ae,0x83ce8c30,0x8c0f83ef,0x7b8d7bae,0x7bae7bae,0x736d7bce,0x7bce83ee,0x94718c50,0x94719491,0x7bce8c30,0x7bce83ce,0x734c6b4c,0x8c506b4c,0x736d7bae,0x7bae8c50,0x630b6b4c,
-0x83ae7b8d,0x8c0f83ee,0x6b0b83ae,0x7bad6b4c,0x83ce83ee,0x732c734c,0x736c736c,0x8c2fb534,0x83ee7bad,0x8c508c2f,0x8c0f8c2f,0x7bae840f,0x7b8e7bae,0x7bae736d,0x736d738d,0x6b4c7bae,0x7bce736d,0x738d738d,0x6b4c6b4c,0x7b8d736d,0x630b6b2c,0x736d6b4c,0x6b2c6b4c,0x736d6b4c,0x6b2c736d,0x7bae738d,0x738d738d,0x736d6b4d,0x7bae738e,0x738d7bce,0x7bae738d,0x73ad7bce,
-0x736d736c,0x736d738d,0x83ee7bad,0x6b4c7bce,0x6b4c6b2c,0x736d736d,0x6b6d736d,0x738d7bae,0x6b4c7bae,0x738d736d,0x6b4c7bce,0x73ae736d,0x7bce7bce,0x8c508430,0x7bae83ef,0x6b4c738d,0x7bce736d,0x738d738d,0x634c73ae,0x5aeb62eb,0x632c5aca,0x7bae6b4c,0x738d7b8d,0x83ef83ef,0x738d7bae,0x738d738d,0x73ad7bce,0x6b6d738d,0x7bce6b6d,0x7bae840f,0x8c3083ef,0x83ef840f,
-0x9491a4f3,0x9cb29491,0x9cb19cb1,0x94919cb1,0x9cb19470,0x8c2f9cb2,0x94709471,0x9c919cb1,0x9cb1ad33,0x9c919cb2,0x9cd2a4d2,0xad349cb2,0x8c309450,0x94717bce,0xa4f29cb2,0x8c509cb2,0x840f9450,0x8c0f8c2f,0x8c2f7bad,0x734c8c0f,0x736c6b2b,0x840f8c2f,0x7bce7bce,0x8c508c2f,0x94719471,0xa4d29491,0x840f9c91,0x8c508c30,0x8c508c30,0x8c30842f,0x94919471,0x9cd2a4f3,
-0x94b19cd2,0x9cb29450,0x94719491,0x9cb29cb1,0x8c2f8c50,0x83ce8c30,0x8c5083ef,0x8c0f840f,0x9c928c30,0x7bae83ef,0x9c928c50,0x9cd29491,0x9cd2b595,0x94918c50,0x9cd2a513,0x9cb19491,0xa5139491,0xa4f29cd2,0xad13a4f3,0x9450a4d2,0x9c919470,0x8c2fa4f2,0x8c0f8c2f,0x8c2f8c2f,0x83ee8c2f,0x947183ef,0x83cf9471,0x83ef8c30,0x94919470,0x94719471,0x8c309471,0x8c518410,
-0x840f8430,0x83ef7bae,0x736d840f,0x840f840f,0x840f842f,0x73ad7bce,0x7bae83ef,0x8c0f83ce,0x8c0f83ef,0x83ce83ef,0x8c3083ef,0x734c83ef,0x62eb83ce,0x83ce734c,0x7bae83cf,0x7bae6b2c,0x7b8d8c2f,0x94508bef,0x94508c0f,0x94509471,0x7bae8c50,0x83ce83ce,0x7bce840f,0x8c309470,0x83ef7bae,0x7bce840f,0x7bae6b2c,0x8c0f9491,0x8c508c30,0x734c7bae,0x7bce7bae,0x6b2c6b4c,
-0x7bad736c,0xa4b28c0f,0x83ce9470,0x7bad738d,0x7b8d83ee,0x734c83ce,0x8c2f7b8d,0x9450ce37,0x8c4f8c2f,0x738c83ee,0x7bad738d,0x83ef7bae,0x7bae83ef,0x8c307bae,0x7bae840f,0x7bae7bce,0x7bae6b2c,0x736d738d,0x6b4c6b2c,0x6b4c6b4c,0x736d736d,0x736d734c,0x6b4c7bae,0x7bae6b2c,0x6b4c736d,0x736d738d,0x6b4c6b2c,0x736d736d,0x738d736d,0x738d738d,0x7bce738d,0x8c2f840f,
-0x7bad840f,0x738d736d,0x7bce7bae,0x738d7bae,0x6b4c6b4d,0x736d6b4c,0x7bcf7bae,0x73ae840f,0x83ef738d,0x736d7bae,0x7bce73ae,0x73ae738d,0x7bae7bce,0x738d73ae,0x736d736d,0x738d738d,0x630b6b2c,0x630b6b4c,0x5b0b5aeb,0x630b5aca,0x6b4c6b4c,0x738d73ad,0x7bce738d,0x83ef7bce,0x8c307bce,0x7bae83ef,0x7bce738d,0x632c736d,0x738d6b4c,0x7bef7bce,0x83ef7bce,0x7bae840f,
-0x9c91a4d2,0x9c919c91,0x8c2f8c30,0x9cd29470,0x94919cb1,0x8c509491,0x9491840f,0x8c2f9cb2,0x9cb19470,0xa4f2a513,0x9cb29491,0x94508c50,0x94719cb2,0x9cb29470,0x94719470,0x94709cd2,0x8c2f9c91,0x9c718c0f,0x83ce8c0f,0x7b8d8c0f,0x736c6b4c,0x840e7bce,0x83ee8c2f,0x9491840f,0x9cb19470,0x9cb29cb1,0x9cb2a4f3,0x94718c50,0x7bee8c70,0x840f83ef,0x8c508c30,0x94718c0f,
-0x94709cd2,0x94709450,0x94919450,0x9cb19471,0x83ee9471,0x83cf8c0f,0x8c307bce,0x8c308c30,0x8c308c10,0x8c308c30,0x8c308c30,0xad349cb2,0x9cd2a513,0xad54a4f3,0x9cd2ad53,0x9cb19491,0xa4f39c91,0x9cd29c91,0xa4f2a4d2,0x9491a513,0x94709c91,0x94919cb1,0x94709450,0x83ee83ee,0x83ef8c0f,0x840f840f,0x7bae83ef,0x8c307bae,0x8c3083ce,0x94508c30,0x83cf8c50,0x841083ef,
-0x8c508c51,0x7bcf7bae,0x840f83ef,0x8c3083ce,0x840f840f,0x7bce7bce,0x7bce83ef,0x8c3083ef,0x7bce7bae,0x840f83ef,0x7bce840f,0x738d738d,0x630b6b4c,0x7bce6b2c,0x6b2c736d,0x8c0f7bae,0x8c2f8c0f,0x94719c71,0xad349c71,0xad54bd95,0x8c509cb2,0x736d83ef,0x7bae83ef,0x83ef8c0f,0x7b8d7bae,0x7b8d7bae,0x8c2f7bad,0x83ef8c50,0x7bae83ee,0x736d736d,0x8c30736d,0x734c6b2c,
-0x734c6b0b,0x7b8d7b8d,0x94508c0f,0x9c919cd2,0x9470ad33,0x8c0f9c91,0x8c2f8c0f,0x7badad13,0x738d7bad,0x736c736c,0x7bce738d,0x83ef83ef,0x7bce83ef,0x83ef7bce,0x7bae83ce,0x7bae7bae,0x7bae734d,0x736d7bae,0x736d736d,0x736d738d,0x7bae736d,0x736d738d,0x736d738d,0x6b2c630b,0x6b2c6b2c,0x6b4d6b4c,0x736d6b4c,0x6b4c736d,0x6b4c6b4c,0x7bae738d,0x7bae7bae,0x83ee7bce,
-0x738d7bad,0x7bce7b8d,0x736d7bce,0x6b6c6b6c,0x6b4c736d,0x738d6b4c,0x840f73ae,0x73ae8410,0x7bae7bae,0x7bae738e,0x7bae73ae,0x73ae73ae,0x7bce7bef,0x5aeb6b4c,0x62eb630c,0x630b62eb,0x630b630b,0x62eb5aeb,0x630b630b,0x632c632c,0x738d6b4c,0x738d738d,0x738d738d,0x736d7bae,0x83ef7bae,0x7bce83ef,0x632c6b4c,0x738d632c,0x73ae6b4c,0x73ae7bef,0x738d7bce,0x83ef83ef,
-0x9cb1ad13,0x94709470,0x8c508c50,0x94709470,0x8c2fa4f2,0x94918c50,0x8c508c50,0x94919cb2,0x94708c0f,0x9cd2a4f3,0x9cb29cd2,0x83ce840f,0x9cd29471,0x8c50a4f3,0x94919c91,0xbdb6a4d2,0xad13cdf7,0x8c2f9470,0x7bce8c2f,0x83ee7b8d,0x7bad8c2f,0x7bad7bad,0x947083ee,0x9cd2a4f2,0x9c919470,0x9cb29cd2,0x9c919cb2,0x8c508c50,0x840f8c30,0x8c307bce,0x8c508c30,0x8c0f8c30,
-0x94919cb1,0x94919cd2,0x94719470,0x8c0f8c2f,0x8c309cb1,0x94718c30,0x8c308c50,0x8c509471,0x8c109450,0x9c918c30,0x8c309471,0xb5549cb2,0xad33ad34,0xb574ad53,0x9491a513,0x94919470,0x9cb2a4d2,0x9cd29491,0x9450a4f2,0xa5139cb1,0x8c2f9c91,0x94508c0f,0x94709c91,0x94709450,0x840f83ef,0x83ef8c0f,0x840f83ef,0x7bce738d,0x8c2f83ee,0x8c0f8c2f,0x7bce83ef,0x841083ef,
-0x84108430,0x7bcf8c51,0x94918c30,0x8c50840f,0x94719471,0x840f8c50,0x738d83ef,0x83ef83ce,0x7bae7bce,0x83ef83ce,0x83ef7bce,0x736d83ef,0x630b736d,0x738d6b4c,0x945183ef,0x94719471,0x94718c0f,0x9cb1a4d2,0x94508c50,0xb575a4d2,0x840f9491,0x738d7bce,0x7bce7bce,0x83ef9cb2,0x7bae736d,0x83ef83ef,0x83ef840f,0x83ef738d,0x840f8c2f,0x734c83ef,0x8c50734c,0x738d6b2c,
-0x7b8d736d,0x83ee7b6d,0x9c91840f,0x9cb19cb1,0xce58c5f6,0x9470a4d2,0x83ee83ce,0x738d9cb1,0x738d7bcd,0x738d738d,0x7bad738d,0x736d7bae,0x7bce7bce,0x7b8d7bce,0x7bae7bae,0x7bae7bae,0x738d738d,0x7b8e7b8e,0x7bce83ef,0x736d7bae,0x6b4c6b4c,0x736d736d,0x738d736d,0x6b2c736d,0x630b62eb,0x736d6b2c,0x736d736d,0x6b4c738d,0x736d736d,0x7bee73ad,0x7bae7bce,0x6b6c738d,
-0x738d736d,0x7bad7bad,0x736c736d,0x738d738d,0x7bae738e,0x7bce7bae,0x73ae736d,0x73ae7bce,0x738d738e,0x738d7bce,0x6b6d738d,0x6b2c738d,0x632c630b,0x6b4d632c,0x736d7bae,0x62eb630c,0x6b2c5acb,0x630b5aca,0x6b4c738d,0x632c632c,0x7bef738d,0x7bce73ae,0x7bce83ef,0x736d7bce,0x7bce736d,0x6b4c7bce,0x6b4c6b4c,0x6b4c6b6d,0x736d630b,0x736d73ae,0x7bee7bce,0x83ef83ef,
-0x9cb19cb1,0x9cb19cb1,0x94509c91,0x94709470,0x94709cb1,0x94708c50,0x8c509471,0xa5139491,0x9cb1a4f2,0xad139470,0xb574ad54,0x8c708c2f,0x94508c2f,0x9cb1a513,0x9470a4d2,0x9470840f,0xef3bef1b,0x9471c5b6,0x94508c30,0x83ce83ef,0x7bce9c91,0x7b8d736d,0x8c3083ee,0xa4f29cd2,0xa4d2b595,0x94708c2f,0x83ef8c50,0x83ef8c50,0x83ef83ef,0x840f7bae,0x840f840f,0x7bce83ef,
-0x94717bce,0x9cd29cb2,0x840f9c91,0x7bce840f,0x9cb28c50,0x9cb29471,0x9471a4d3,0x94718c50,0x9cb28c30,0x83ef8c10,0x8c30840f,0x9471840f,0xb574c5d6,0xad33a513,0xa4f2ad53,0x94909470,0xa513a4d2,0x9cd2a513,0x8c309cb2,0xad139470,0xa513b595,0x94508c50,0xb5749cb1,0x9450a4f2,0x8c308c30,0x9cb28c30,0x8c108c50,0x7b8d840f,0x8c30840f,0x83ef8c50,0x7bcf7bce,0x8c3083ef,
-0x8c308410,0x84107bcf,0x8c307bce,0x840f83ef,0x842f8c30,0x840f8c30,0x736d7bae,0x7bae83ce,0x7bae7bae,0x83cf83cf,0x7bce7bae,0x736d7bce,0x734c736d,0x8c0f7bae,0xa4f39cd2,0x8c509451,0x83ef9471,0x83ef83ce,0x7b8e83ce,0x945183ef,0x83ef9491,0x7b8e7b8d,0x83ce83ce,0x8c0fa4f3,0x738d736d,0x7bad736c,0x83ee7bce,0x738d840f,0x8c0f840f,0x738d8c50,0x9491736d,0x840f840f,
-0x83ef8c2f,0x8c0f8c2f,0x8c0f8c30,0x840f8c30,0x83ce7bad,0xad348c30,0xc5f7a4f2,0x736cad13,0x7bad736c,0x736c738d,0x7bad738d,0x7bce7bad,0x738d7bae,0x7bce7bae,0x83ce8c0f,0x7bae7b8d,0x738d83ef,0x630b6b2c,0x738e736d,0x738e7bae,0x6b2c738d,0x736d6b2c,0x7bae738d,0x738e7bae,0x630b5aca,0x6b4c632c,0x6b2c6b4c,0x738d6b6d,0x6b6d738d,0x738d738d,0x73ad73ad,0x738d73ad,
-0x7b8d7b8d,0x738d7b8d,0x736c736c,0x738d738d,0x7bce7bae,0x73ae7bcf,0x6b2c632c,0x6b4c6b4d,0x736d6b4c,0x6b2c736d,0x630b6b4c,0x5aeb5aeb,0x630c632c,0x630c62ec,0x6b4d6b4d,0x62ec6b2d,0x630c5acb,0x62eb632c,0x6b4d6b4c,0x6b4d5aeb,0x6b6d6b6d,0x6b6d736d,0x7bce738e,0x7bae738e,0x7bae736d,0x6b2c7bae,0x738e6b6d,0x630c738d,0x6b4d632c,0x7bce73ae,0x7bee6b6d,0x83ee7bce,
-0x9cd2a4f2,0x9cb19cb1,0x9cb19cd2,0x8c4f9470,0x9cd29470,0x94909cd2,0x94508c50,0x94708c50,0x9cb1ad33,0x9cb19cb2,0xad33b574,0x8c509471,0x840f9cb2,0xb574a4f2,0x94919c91,0x8c0f9470,0xa4d29430,0xbd95ad33,0xad34b575,0x6b2c7bae,0x83ce734c,0x7b8d83ce,0x8c5083ef,0x94719491,0xbd95b554,0x94509cb1,0x8c309cb2,0x9cb283ef,0x83ef8c50,0x8c0f840f,0x83ef840f,0x83ef7bae,
-0x8c2f7bae,0xa4f39491,0x9450a4f3,0x840f8c2f,0x8c50840f,0xa4f39491,0x9c92ad14,0x9451840f,0xad149451,0x83ef9c72,0x945183cf,0x8c508c30,0xad13a4d2,0xa4f2a513,0xa4f2a513,0x94709cb1,0xa5139471,0x9cb1ad13,0x94508c30,0x9cb28c30,0xb554ad33,0x8c509c91,0xce379450,0x9c91b554,0x8c509491,0x9cd28c50,0x83ef9451,0x840f83ef,0x840f83ce,0x83ee8c50,0x7bce7bae,0x8c307bcf,
-0x7bef8410,0x7bae7bcf,0x7bae7bae,0x83ef8c10,0x7bce83ef,0x8c308c30,0x83ef83ef,0x8c108c30,0x7bae7bae,0x840f7bce,0x736d83ef,0x736d6b2c,0x840f6b2c,0xa4f39491,0x8c50a4f3,0x83cf83ef,0x83ef83ef,0x736d7b8e,0x736d736d,0x8c5083cf,0x8c308c30,0x736d7bae,0x83ce83ce,0x7baea4d3,0x736d736d,0x738d738d,0x840f738d,0x8c2f9470,0x840f83ce,0x8c2f9cb1,0x9c9183ce,0x8c30a513,
-0x83ce83ce,0x7bad7bae,0x83ee736c,0x840f840f,0x736d7bae,0x7b8d6b4c,0xce3883ee,0x7badb575,0x7bcd7bad,0x738d7bce,0x736c736c,0x7bce738d,0x83ef7bce,0x83ee840f,0x8c0f8c50,0x7bad83ee,0x6b4d736d,0x6b4d736d,0x736d6b4c,0x7bae738e,0x7bce7bce,0x6b4c736d,0x736d738d,0x6b4c6b2c,0x632c630b,0x6b4c6b4c,0x6b2c6b4c,0x6b6d6b4c,0x736d6b6d,0x6b6d736d,0x73ad6b6c,0x840f7bee,
-0x738d738d,0x7bce7bce,0x6b4c738d,0x6b4c6b4c,0x738d738d,0x6b4d738d,0x6b4c632c,0x630b630c,0x6b4c6b2c,0x6b4d6b2c,0x6b4c6b2c,0x6b4c632c,0x630c6b2c,0x6b4d6b2c,0x736e6b4d,0x6b0c736e,0x62eb62ec,0x632c632c,0x632c630b,0x630b632c,0x6b4d6b4c,0x6b4c6b4c,0x738d6b6d,0x7bae738e,0x736d736d,0x736d6b4d,0x6b4c6b6d,0x632c630b,0x6b4c6b4c,0x7bef7bce,0x73ad7bef,0x7bae73ad,
-0xa4f2a4f2,0xa4d2a4f2,0x94709cb1,0x94708c50,0x9cb19490,0x9cb1a513,0x8c509491,0x7bce9450,0x8c508c2f,0x94919cb1,0xa5139491,0x8c2f9491,0x842f8c50,0xbdd6b575,0x9cb19cb1,0x94509450,0x94308c0f,0xbdb6bdb6,0xd678cdf7,0x7b8d9450,0x734c6b0b,0x8c3083ee,0x8c2f8c30,0x94719491,0x9450a4f2,0x94509470,0x9cb29471,0x7bae840f,0x8c508c0f,0x83ef83ef,0x83ef83ef,0x83ef8c30,
-0x840f8c2f,0x94918c50,0x94719cd2,0x840f83ef,0x840f8c50,0xa4f39450,0x9491a513,0x94718c50,0x9c929431,0x94519c92,0x840f83ef,0x94719451,0xa4f38c50,0xad33ad54,0xad33a4f2,0xad33ad53,0x94919470,0x94719c91,0x8c2f8c0f,0x8c508c2f,0x9cd28c2f,0x8c2fa513,0x947083ee,0x94919c91,0x8c2f9c91,0x8c508c30,0x8c509451,0x83ce7bae,0x840f83ef,0x840f8c30,0x7bce7bce,0x83ef7bcf,
-0x7bcf7baf,0x84108410,0x8c5183ef,0x83ef840f,0x7bce83ef,0x7bce840f,0x7bce7bce,0x83ce83ce,0x841083cf,0x83ef83ef,0x840f8c30,0x738d7bae,0x8c307bce,0x9cb2a4f3,0x94719491,0x83ef7bce,0x83ef840f,0x736d736d,0x738e7bae,0x83ef7b8e,0x83ef736e,0x8c108c30,0x8c1083ae,0x7baebd96,0x738d7bae,0x7bae7bce,0x8c307bce,0x94918c4f,0x8c2f840f,0x83ee8c2f,0x7bae736d,0x7b8d9cd2,
-0x6b2c7b8d,0x83ce7bae,0x7bce83ef,0x83ef83ce,0x7bae83ef,0x738d7bce,0xb5957bce,0x8c0f8c0f,0x7bad840f,0x7bce7bae,0x736d738d,0x83ce7bae,0x8c5083ef,0x83ee8c30,0x8c508c50,0x7bce9470,0x6b2c6b2c,0x738d738d,0x6b4d6b4c,0x7bce738d,0x7bcf738d,0x6b2c738e,0x736d6b4d,0x630b6b2c,0x6b4c6b6d,0x6b4c6b6d,0x6b6d6b4c,0x6b4c6b4c,0x738d738d,0x738d73ae,0x73ad738d,0x840e7bee,
-0x7bad7bad,0x7bce7bce,0x6b4c736d,0x738d736d,0x736d736d,0x6b2c6b6d,0x738d6b6d,0x632c6b2d,0x736d736d,0x736d736d,0x7bae630b,0x6b4d7bce,0x6b4d736d,0x6b2d6b4d,0x6b2d6b2d,0x630c6b2d,0x630c630c,0x6b2c62eb,0x630c630c,0x62eb6b6d,0x6b6d632c,0x736d6b4c,0x6b6d736d,0x6b6d7bce,0x738e738e,0x6b4d6b2d,0x6b4d6b2d,0x630c630c,0x630b6b4c,0x84306b6c,0x7beea533,0x738d73ad,
-0xa4d29cd2,0xa513a4f2,0x9450a4d2,0x94708c2f,0x94919470,0xa4f29470,0x9c919c91,0x94508c2f,0x8c2f83ee,0x94919cb2,0x9cf28c0f,0x8c2f9cb1,0x7bce7bce,0xc5f7ce58,0x9cb29471,0x94919471,0xad139cb2,0xad34ad33,0x8c2fb554,0x83ce8c2f,0x7bad734c,0x83ce7bae,0x83ef8c30,0x94718c30,0xa4f2ad34,0x8c509470,0x8c508c50,0x94919450,0x8c509491,0x840f8c50,0x840f8c0f,0x8c308c0f,
-0x8c508c2f,0x8c50840f,0x94509cb1,0x8c509491,0x94709471,0x9450840f,0x94719c92,0x94919492,0x94318c51,0x94719451,0x83ef9451,0x94718c30,0x94719491,0xad339cd2,0xad54ad33,0xa513ad54,0x9470a4f2,0x9c919491,0x8c309470,0x8c309491,0x9c918c2f,0xad139cb1,0x83ce9470,0xad139450,0x94719491,0x8c308c50,0x840f83cf,0x7bae8c50,0x840f840f,0x8c50840f,0x83ef8c30,0x7bcf83ef,
-0x83ef840f,0x840f8c30,0x8c509451,0x8c308c30,0x83ef8c30,0x73ad840f,0x83ef83ce,0x7bce7b8d,0x83cf83ef,0x840f83ef,0x8c30840f,0x8c308c50,0x83ef840f,0x83ce83ce,0x83ef83ef,0x83ef840f,0x7bae83ef,0x7bae736d,0x738e738e,0x736d7bae,0x94517b8e,0x8c309c72,0x943183ef,0xa4f3ce38,0x83ef83ef,0x7bad7bae,0x738d738d,0x6b4c738d,0x8c30840f,0x7bce7bae,0x736d7bae,0x7bcea4f3,
-0x7bae7bce,0x8c0f840f,0x840f83ef,0x83ce83ef,0x840f7bae,0x738d7bce,0xb57483ee,0x840f83ce,0x7bce8c2f,0x840f7bae,0x7bce8c30,0x7b8d736d,0x840f7bce,0x7bce83ef,0x840f8c2f,0x7bce8c50,0x630b6b6c,0x738d6b2c,0x736d736d,0x6b4d6b2c,0x7bae738e,0x736d7bae,0x736d6b4c,0x736d738d,0x6b6d6b6d,0x6b2c738d,0x736d6b2c,0x738d6b4c,0x738d738d,0x738d738d,0x738d738d,0x738d738d,
-0x7b8d7bad,0x738d7b8d,0x736c736c,0x738d738d,0x736d736d,0x632c738d,0x6b6d6b6d,0x632c630c,0x736d7b8e,0x6b2c6b2c,0x6b2c6b2c,0x62eb630c,0x738e736d,0x736e738e,0x6b4d736e,0x62ec6b0d,0x6b4d6b4d,0x6b2c736d,0x6b6d630c,0x73ae736e,0x6b6d6b4d,0x738d73ae,0x7bef738d,0x7bae7bef,0x7bcf738e,0x6b4d7bcf,0x6b2c6b2c,0x738e6b6d,0x632c73ae,0x9cd25b0b,0x738d94b2,0x83ef7bae,
-0x9cb19cb1,0x9cd19491,0x9cb19cb1,0x94709470,0x8c2f8c30,0x94708c0f,0x9c719c91,0x83ee9c71,0x8c0f83ce,0x94719450,0x94918c0f,0x840f8c50,0x7bce7bad,0x9cb19c91,0xad139450,0x9c92a4d2,0xa4d29c91,0x8c50a4f3,0x9cb29cb2,0x8c0f83ef,0x7b8e734c,0x738d738d,0x9cd28c30,0x9cb29471,0x9491a4f2,0x8c508c50,0x840f8c30,0x94919491,0x94919cd2,0x94709491,0x83ef83ee,0x8c50840f,
-0x8c309491,0x8c0f83ee,0x94719470,0x8c2f9471,0x9cb18c30,0x8c309471,0x9cb29471,0x94719cb2,0x94719492,0x8c108c10,0x8c508c51,0x8c308c30,0x9cb29cb2,0x9c919cd2,0xa513bdb5,0xa5139cd2,0xa4f2ad13,0x9cb1a4d2,0x8c0f8c2f,0x945083ee,0x94919491,0x94709470,0x94919cd2,0x8c0f83ee,0x9c918c30,0x9491a4d2,0x83ce7bae,0x94918c30,0x7bce83ce,0x840f83ef,0x840f8c50,0x8c308c0f,
-0x8c30840f,0x8c508c30,0x8c708c50,0x8c308c30,0x840f8c2f,0x840f840f,0x7bce7bce,0x83ef83ef,0x7bcf83cf,0x83ef83ef,0x840f8c30,0x8c30840f,0x7bce842f,0x7bce83ef,0x83ef83ce,0x8c1083ef,0x83ef8410,0x7bce7bae,0x6b4c7b8e,0x83ef7bce,0x9c9183ef,0x83ef9451,0xad149c91,0x83cfad34,0x7bae7bae,0x7bae83ef,0x736d734d,0x83ee7b8d,0x8c0f83ef,0x736c8c0f,0x738d7bae,0xa513ad54,
-0x840f7bae,0x8c2f840f,0x7bee840f,0x7bae7bae,0x840f736d,0x738d840f,0xa5138c30,0x7bad738d,0x8c2f83ee,0x840f840f,0x840f7bee,0x83ee83ef,0x738d7bce,0x840f7bce,0x8c308c0f,0x83ef8c0f,0x7b8d738d,0x7bae6b4c,0x7bce8c30,0x736d7bce,0x83ef736d,0x7bce840f,0x6b4c6b6d,0x738d736d,0x6b6d73ae,0x6b6d73ae,0x6b6c6b4c,0x6b6c736d,0x738d7bce,0x6b6d6b6c,0x6b4c6b6d,0x6b6d6b4c,
-0x736d738d,0x738d7b8d,0x736d73ad,0x6b2c736d,0x632b632b,0x630b632c,0x6b6d6b4c,0x6b4d6b4d,0x6b4c6b2c,0x736d6b4c,0x6b2c6b4c,0x6b2c6b2c,0x736d736d,0x7bcf736e,0x6b4d736d,0x6b0c62ec,0x6b2d736d,0x7bae6b2c,0x630c736d,0x736d738e,0x6b2c6b2c,0x83ef736d,0x7bcf840f,0x7bae83ef,0x73ae736d,0x6b6d6b6d,0x630c632c,0x736d6b2c,0x632c6b6d,0x7bef5aeb,0x7bee7bce,0x7bce840f,
-0x9cd2a4f2,0x9cb19cd2,0xa4f2a4f2,0x9cb2a4f2,0x94719450,0xb5549471,0x9471acf3,0x8c0f9430,0x94718c0f,0x8c0f9450,0x94708c2f,0x83ee9491,0x8c2f83ee,0x83ef840f,0x8c308c30,0xad149471,0xa5139cb2,0x840f8c70,0x94918c30,0x738d83ef,0x734d83ce,0x6b2c736d,0xa513840f,0x9c919cb2,0x9cb29cb2,0x8c2f8c50,0x842f9491,0x842f840f,0x842f8c70,0x8c2f8c2f,0x840f840f,0x840f7bce,
-0x94709491,0x8c5083ee,0x8c2f9470,0x8c509450,0x8c509450,0x8c308c30,0xa4f38c30,0xad14b595,0x9c929cd3,0x8c309471,0x9cd29491,0x9c929c92,0x9cd29491,0x94719471,0xb5759491,0xad34b575,0xb574a4f2,0xacf2b574,0x7bad8c0f,0x94508c2f,0x9cb19491,0x8c509470,0xad339470,0x83ee9cb1,0x9cd2840f,0x94509cb2,0x83ef9471,0x8c50840f,0x83ef9cb2,0x94718c30,0x8c508c30,0x7bce7bce,
-0x8c0f83ef,0x8c307bce,0x840f840f,0x842f8c50,0x840f8c30,0x83ef840f,0x840f83ef,0x7bce83ef,0x7bae840f,0x83ef7bae,0x738d7bae,0x83ef7bce,0x7bce7bce,0x840f7bae,0x83ef83ef,0x7bce840f,0x7bae83ef,0x738d7bae,0x94717bae,0xa513b554,0x83ef9c91,0x945083ef,0x94718c50,0x83ef9cb2,0x83ef8c0f,0x8c309471,0x7bae8c30,0x7bae83ce,0x7bae8c0f,0x736d83ee,0x7bad738d,0xbdd69491,
-0x94709491,0x7bce8c2f,0x7bce7bce,0x7bce7bad,0x736c738d,0x7bae738d,0xa4d2a4f3,0x7bae738d,0x840e7bce,0x7bee8c2f,0x7bce83ee,0x7bce7bee,0x738d7bae,0x840f7bae,0x83ef840f,0x83ce7bae,0x7bce7bae,0x736d734c,0x7bae7bae,0x736d7bce,0x7bae6b4c,0x73ae7bce,0x7bcf7bce,0x6b4d738e,0x6b4c738d,0x73ad6b4c,0x7bee8c70,0x738d6b4c,0x73ad73ad,0x738d73ad,0x736d6b6d,0x6b6d738d,
-0x736d736d,0x7b8d738d,0x738d73ad,0x630b736d,0x630b632b,0x5aeb630b,0x62eb5aeb,0x738d632c,0x6b4c630c,0x736d6b2c,0x6b2c736d,0x734d734d,0x736d630c,0x7b8e7b8e,0x6b2d6b2d,0x62ec630c,0x6b2d736d,0x630b6b2c,0x6b2c62eb,0x736d6b4c,0x6b4c736d,0x738d6b2c,0x7bae7bae,0x736d7bae,0x6b6d632c,0x632c6b4c,0x632c630c,0x632c632c,0x5acb632c,0x5aeb5aca,0x7bef7bae,0x7bee842f,
-0x9cd29cd1,0x94919cd2,0x9cd29cb1,0x9cb1a4d2,0xb595c5f6,0x94509c91,0x83ef7b8d,0xa4f39c91,0x83ce9450,0x83ee9430,0x94717bae,0x7bad9471,0x94718c2f,0x840f8c0f,0x83ef83ce,0xad349450,0xa4f3c5f7,0x83ef9cb2,0x83ef7bae,0x94509c91,0x83ef7bae,0x7bae7b8e,0x9cb283ef,0x9cd2a513,0xb5548c50,0x840fa4d2,0x94919cd2,0x840f9471,0x8c308c30,0x840f8c30,0x842f8c50,0x840f7bee,
-0x9471840f,0x94509cb1,0x840f840f,0x8c5083ef,0x94719471,0x8c309450,0x83ef83cf,0xb595a4d3,0x9cb2a4f3,0x9c929471,0x9cb29cb2,0x9cb2a4f3,0x94509491,0x8c509470,0x9cd28c50,0xb574b574,0xbd95b554,0xad13cdf7,0x8c0f8c2f,0x94918c50,0x94719c91,0x8c2f840f,0x9cb28c30,0x94509c91,0x8c509450,0x94509cd2,0x9cd29cd2,0x8c3083ef,0x94918c50,0x840f8c0f,0x83ef83ce,0x8c308c0f,
-0x83ef8c2f,0x8c2f83ef,0x83ef7bce,0x8c508c50,0x8c308c50,0x83ef840f,0x83ef83ef,0x83cf83ef,0x83ef840f,0x7bce7bce,0x738d7bae,0x8c2f7bae,0x83ef8c50,0x83ee9450,0x83cf83ef,0x7bae7b8d,0x94727bae,0x9cb28c30,0xbdb6b595,0x9c91c5f7,0x840f8c2f,0x8c1083ef,0x8c508c30,0x7bae840f,0x83ef7bce,0x83ce9471,0x840f840f,0x840f9471,0x8c0f83ce,0x94518c0f,0x736d83ce,0xbdd6840f,
-0x842f9470,0x840f840f,0x7bce8c50,0x7b8d7bad,0x738d7b8d,0x840f7bad,0x9cb2ce38,0x83ee736c,0x840f83ee,0x840f8c50,0x7bad83ee,0x7bae7bce,0x7bae7bae,0x7bce7bae,0x738d83cf,0x7bae6b4c,0x7bad7bce,0x7bae6b4c,0x738d738d,0x840f73ad,0x6b4d738d,0x7bce738e,0x84108410,0x6b6d738d,0x6b6d6b6d,0x73ae6b4c,0x8c309491,0x6b6c6b6c,0x6b6d738d,0x73ae738d,0x6b4c736d,0x738d6b6d,
-0x736d7bce,0x738d736d,0x630b6b2c,0x6b4c6b2c,0x6b4c6b4d,0x632c6b4c,0x630b630b,0x7bcf6b4c,0x630b736d,0x630b6b4c,0x738e6b2c,0x736d6b2c,0x7bae736d,0x6b4d7bae,0x6b2c630c,0x62ec630c,0x6b4d630c,0x62eb6b2c,0x630c5aaa,0x738d6b2c,0x736d7bae,0x6b2c6b2c,0x738e6b4c,0x738d7bce,0x6b4c632c,0x632c632c,0x6b2c632c,0x630b632c,0x6b4d630b,0x5aca73ae,0x840f73ae,0x7bce840f,
-0x94919cb1,0x94908c50,0xad549cd2,0x9c91a4f3,0x9491a4f2,0x8c309c71,0x8c0f83ee,0xa4d29450,0x9c719471,0x947183ce,0x83ee83ce,0x8c2fa513,0x8c308c50,0x8c309491,0x8c309450,0x9c918c30,0xad54bdb6,0x8c509cb2,0x94509471,0x947183ce,0x83ef9c92,0x7bae7bae,0x94509491,0x94719491,0xad33a513,0x8c309471,0x840f7bee,0x83ef840f,0x842f840f,0x8c308c50,0x8c509471,0x840f840f,
-0x8c508c0f,0x94719cb1,0x7bce8c50,0x8c2f738d,0x83ef840f,0x83ef7bae,0x83cf8c30,0x947183ef,0x9cb2a4f3,0x94919cb2,0x94719471,0x9c918c50,0x8c509cb2,0x8c508c0f,0x840f9470,0xa4f38c50,0xb574b595,0xa4d2bdb5,0xa5139cb1,0x94919cb1,0x9cd29c91,0x8c309471,0x8c509471,0x9cd29491,0xad13a4f3,0x94718c0f,0x8c309471,0x7bae8c50,0x8c0f7bae,0x7bae8c50,0x8c30840f,0x8c30840f,
-0x840f8c50,0x83ef840f,0x7bce738d,0x840f7bce,0x8c509470,0x842f840f,0x83ef8c30,0x83ef7bce,0x840f7bce,0x83ef83ef,0x7bce7bce,0x8c2f7bae,0x8c2f9450,0x83ef83ef,0x83cf7b8d,0xad349c91,0xbdd7c618,0x9492a4f3,0x7bae9471,0x83ce7b8e,0x8c0f734c,0x7bae8c30,0x9cb28c30,0x7bae840f,0x7bce7bce,0x8c308c30,0x7bce83ef,0x7bce83ef,0x8c0f83ef,0x9c918c30,0x94718c30,0xbdb58c30,
-0x9491ad34,0x8c508c50,0x842f9470,0x94509491,0x83ef8c0f,0x7bce7bce,0x9470d658,0x947083ce,0x8c2f8c2f,0x842f842f,0x7bce7bce,0x7bee7bce,0x83ef7bce,0x7bce83ef,0x7bce7bae,0x83ce7bae,0x83ee7bce,0x83ce83ef,0x736d738d,0x7bae736d,0x738d7bce,0x7bce738e,0x7bcf7bef,0x73ae738d,0x6b4c6b4c,0x6b6d6b6d,0x7bae73ae,0x6b4c738d,0x6b4c736d,0x73ad6b6c,0x6b4c6b6d,0x73ad6b6d,
-0x736d738d,0x6b4c736d,0x62eb5aca,0x62eb630b,0x630c6b2c,0x5aeb630b,0x630b5aeb,0x6b6d632c,0x6b4c6b4c,0x6b2c6b2c,0x7bae736d,0x6b4c738d,0x7bae736d,0x738e7bcf,0x630c6b4d,0x6b2d6b0c,0x83ef7bcf,0x6b4d6b2c,0x630c630c,0x6b2c6b2c,0x6b2c6b4c,0x630b630c,0x6b4d6b2c,0x7bae738e,0x6b6d6b6d,0x632c630b,0x632c632c,0x630b630b,0x840f632c,0x6b4c9471,0x840f736d,0x73ae7bef,
-0x9cd29cb1,0x9cb19cb1,0x9cd29491,0x9c919c92,0x94719cb2,0x9c919c91,0x83ef8c30,0x8bef8bef,0x8c0f9450,0x8c0f8c0f,0x8c0f83ef,0x8c3083ef,0x83ef83ef,0x8c307bce,0xa4d28c50,0xa5139450,0xad34a4d2,0xce37ce38,0x8c509cb2,0x83ef9450,0xa4d2a4f3,0x8c508c30,0x94719470,0x94508c50,0xde99c5f6,0x94508c30,0x7baead34,0x840f83ef,0x738e7bce,0x841083ef,0x8c308c50,0x83ce840f,
-0x94709471,0x9491840f,0x8c2fad13,0x736d83ef,0x7bce736d,0x840f83ef,0x83ef83ef,0x8c308c10,0xad3494b1,0x94919cd2,0x840f9491,0x9471840f,0x94719cb2,0x7bce8c0f,0x8c309471,0x94508c30,0xa4f29c91,0x94709cb1,0xb574ad34,0x8c50a513,0x9cb28c50,0x8c509c91,0x8c0f9471,0x94719450,0x94519491,0x8c3083ef,0x94518c50,0x8c0f8c30,0x83ce8c30,0x8c308c30,0x83ef8c2f,0x8c2f83ef,
-0x94919450,0x8c508c2f,0x7bae83ef,0x83ee83ee,0x8c508c50,0x8c708c30,0x8c509cb2,0x7bce7bce,0x7bae7bae,0x8c0f83ef,0x7bad7b8d,0x7bae7bae,0x83ef7bad,0x9c919450,0xbd95d658,0xbd95b554,0x84108c51,0x7bae83ef,0x83ce7bae,0x7bae83ce,0x7bad7b8d,0x7bce8c0f,0x9471840f,0x8c0f9491,0x7bae7bae,0x8c5083ce,0x8c30840f,0x8c0f8c30,0x8c0f83cf,0x94508c10,0x94718c0f,0x9cb19430,
-0x9491b575,0x94919cb1,0x8c2f8c30,0x8c0f9491,0x7bce8c30,0x8c50840f,0x9471ce37,0x94709491,0x840f8c2f,0x83ef7bce,0x7bee7bae,0x840f83ef,0x7bce738d,0x7bae83ef,0x7bae736d,0x83ef83ef,0x738d738d,0x7bae7bee,0x738d738d,0x736d736d,0x83ef7bce,0x738d7bce,0x738d736d,0x73ae73ae,0x6b4c736d,0x6b6d6b6d,0x6b6d6b4c,0x73ae7bce,0x6b6d6b6d,0x736d736d,0x738d6b6d,0x738d738d,
-0x734c738d,0x736d6b4c,0x6b6c6b4c,0x630b6b2c,0x6b4c630c,0x632c6b6d,0x738d6b2c,0x6b6d6b6d,0x7bae738d,0x738d738d,0x738d736d,0x8c508410,0x8c508430,0x7bef8c51,0x5aeb6b4d,0x6b2d62ec,0x7bef73ae,0x738e738d,0x632c630c,0x738d738d,0x6b4c6b4c,0x6b6d6b6d,0x6b6d6b6d,0x7bce738d,0x73ae73ae,0x6b4c6b4c,0x632c632c,0x630c630b,0x738d5acb,0x6b4d7bcf,0x83ef6b4c,0x840f8c30,
-0x8c509470,0x8c2f8c50,0x94709470,0x9c919c91,0xad14ad34,0x9cb19470,0x8c309430,0x8bef9450,0x8c0f8c0f,0x8c0f8c2f,0x7bce8c2f,0x7bae7bce,0x83ef7bae,0x8c508c30,0x9c919471,0xa4f2a4f3,0x9cb2ad33,0xbdb5d699,0x9c919471,0x83ee8c0f,0xa4d28c2f,0x94919cb2,0x8c0f9cb1,0x94509491,0xce37c5d6,0x9491ad34,0x9cd2b554,0x8c308c30,0x738d840f,0x83ef7bae,0x840f840f,0x83ef840f,
-0x8c508c30,0x840f83ef,0x7bae8c50,0x736d7bce,0x8c0f738d,0x8c308c30,0x94508c50,0x94719471,0x9cd29491,0x9cd2ad34,0x94919471,0x94919471,0x9cb29cb2,0x840f9cb2,0x94508c50,0x840f9491,0xb5549471,0x9cb1ad33,0xa513a4f2,0x94709cb2,0x94919471,0x9cd29c91,0x8c309491,0x94718c30,0x8c10b555,0x83cf83ef,0x8c308c10,0x94718c30,0x8c308c50,0x8c5083ee,0x83ee8c2f,0x8c50840f,
-0x8c50840f,0x8c308c2f,0x83ef8c0f,0x83ee7bee,0x8c30840f,0x8c308c30,0x8c309451,0x7bae7bce,0x83ce7bae,0x8c0f83ef,0x83ce83cf,0x83ee7bce,0x7bae83ce,0xbd95ad13,0xa4d2b575,0x7b8d83ef,0x7b8e734c,0x947183ef,0x83ce9c91,0x8c0f83cf,0x7b8d8c2f,0x83ee83ef,0x8c0f83ef,0x8c509471,0x840f840f,0x7bce7bce,0x8c50840f,0x8c309471,0x945083cf,0x94718c10,0x94709470,0x9cd2a4d2,
-0x7bcebdb5,0x8c308c30,0x7bce7bce,0x840f83ee,0x7bad83ee,0x947183ee,0x83eeb574,0x840f8c30,0x7bce840f,0x73ad7bce,0x7bae7bae,0x7bee83ef,0x7bce7bae,0x83ef8c30,0x7b8e738d,0x83ef83cf,0x73ad83ef,0x7bae7bce,0x738d7bce,0x738d738d,0x83ef7bae,0x736d73ae,0x6b4d6b6d,0x73ae73ae,0x6b6d738d,0x6b6d6b6d,0x738e738e,0x7bef7bcf,0x7bae7bae,0x738d73ae,0x736d738d,0x6b6c6b6c,
-0x736d736d,0x736d736d,0x73ad738d,0x630b736d,0x736d62eb,0x738d73ae,0x7bce738d,0x6b6d738e,0x6b4c6b6d,0x6b6d6b6d,0x6b4c6b4c,0x94917bae,0x94929471,0x84108c71,0x738e73ae,0x7bcf7baf,0x738e7bae,0x632c6b4d,0x6b4c5aeb,0x632c632c,0x6b6d6b6d,0x6b6d738d,0x6b4c6b6d,0x6b6d632c,0x7bcf7bce,0x6b4c6b6d,0x6b2c632c,0x632c632c,0x6b4d6b2c,0x6b6d736d,0x6b6d6b4c,0x7bce7bef,
-0x94719470,0x8c509491,0x8c0f8c30,0x94919471,0xa4f3b554,0xad139c91,0x94509cb1,0x8c0f8c0f,0x8c2f83ee,0x8c0f8c2f,0x6b0c7bae,0x83ef840f,0x83ef7bae,0x83ef83ef,0x9cb2840f,0xb574bd95,0xad34a4d2,0xad13ad13,0x94709cb1,0x8bef83ee,0x83ce8c30,0xa5138c2f,0xb554b554,0x9cb19c91,0xad139c91,0x94718c30,0xa4f39491,0x8c508c30,0x8c509471,0x83cf840f,0x8c3083ef,0x840f8c30,
-0x738d83ee,0x83ce738d,0x7bae83ef,0x630b630b,0x7bae6b4c,0x947183ef,0x94719cd2,0x94718c50,0x94919471,0xa5139cd2,0x9cb29cb2,0x9491a513,0xa5139cd2,0xa4f3a513,0x94718c50,0x840f8c50,0x9cb28c2f,0x9491a4f2,0x94919450,0x9cd29491,0x94919471,0x9c929491,0x94919cd2,0x94518c30,0x83efad34,0x8c308c10,0x94719471,0x8c308c30,0x840f8c30,0x83ce83ef,0xa4d28c50,0x8c0f8c2f,
-0x8c0f8c0f,0x8c308c50,0x8c508c0f,0x8c2f840f,0x8c30840f,0x83ef8c30,0x83cf83ef,0x7bce7bae,0x83cf7bae,0x83ef83ef,0x8c108c30,0x8c308c0f,0x7bae8c0f,0x8bef83cf,0x7b8d83cf,0x83ae8bef,0x736d736d,0x736d7bae,0x8c3083ef,0x94718c0f,0x83ee8c0f,0x83ee83ef,0x8c0f8c30,0x840f840f,0x83ef8c30,0x7bce7bae,0x83ef8410,0x8c10840f,0x8c0f9c91,0x8c308c30,0x94719470,0x9c919471,
-0x840fce58,0x945083ef,0x840f8c2f,0x9471840f,0x840f83ee,0xad338c2f,0x7baead34,0x83ef7bae,0x7bce840f,0x7bce83ef,0x7bae7bae,0x7bae83ef,0x7bae7bae,0x83cf83ef,0x738d7bae,0x7bae738d,0x840f840f,0x7bae83ef,0x840f7bae,0x7bce8c30,0x73ae738d,0x738d738d,0x6b6d738d,0x73ae736d,0x738d738d,0x6b4d6b6d,0x738e738e,0x738e73ae,0x83ef7bf0,0x73ae7bce,0x6b6d738d,0x73ad6b6c,
-0x840f736d,0x7b8e8c30,0x84107bae,0x6b2c83ef,0x6b4c630c,0x738d738d,0x73ae73ae,0x6b4c6b4c,0x6b6d6b4c,0x7bef6b4d,0x6b6d7bef,0x73ae73ae,0x94b28c71,0x949294b2,0x84308430,0x73af7bef,0x6b6d736d,0x630c6b4c,0x632c630b,0x738d6b4c,0x7bce7bce,0x6b6d73ae,0x6b6d6b6d,0x6b6d6b4c,0x738e6b6d,0x6b2c6b4c,0x6b2c630c,0x632c6b2c,0x632c6b2c,0x6b6d6b4d,0x6b4c6b6d,0x7bef7bce,
-0x9cb29cb1,0x9c919c91,0x94919470,0x94719471,0x9cb29c91,0xad34bd95,0x9c919cd2,0x94508c30,0x83ce8bee,0x8c2f9430,0x83ef8c0f,0x840f7bae,0x7bae7bce,0x738d7bce,0x9cb19cb1,0x9c919cb1,0x9471a4f3,0x8c2f9450,0xa513a513,0x7b8d83ce,0x7bad7bae,0xad138c0f,0xb575b574,0x9cb2ad34,0xa4f29470,0xad339cb1,0xad54b595,0x8c50b575,0xa4f38c50,0x840f9cb2,0x949183ef,0x8c0f8c50,
-0x8c508c2f,0x7bce83ee,0x738d6b4c,0x7bce7bae,0x6b2c7b8d,0x9c917bae,0x94719491,0x94919cb2,0x94919491,0x9cb19491,0x9cf2a533,0x9cb29471,0x94719471,0xa4f3a4d3,0x9471a4d3,0x94919471,0x9cb19491,0x9cb28c30,0x8c309491,0x949194b1,0x94509491,0x94718c30,0xa513bd96,0x8c108c0f,0x83ef83ef,0x8c518c10,0x94919471,0x8c3083ef,0x8c2f8c30,0x83ce8c2f,0x9c91840f,0x83eea4d2,
-0x94508c50,0x8c308c0f,0x840f83ee,0x83ee8c50,0x8c508c50,0x840f8410,0x83ef840f,0x83cf83cf,0x7bae7bae,0x83ef83cf,0x8c308c0f,0x8c0f9450,0x83ef83ef,0x83ef83cf,0x8c308bef,0x7bae7b8e,0x94518c10,0x8c108c30,0x83ef83ef,0x83ee9451,0x840f7bae,0x83ee83ee,0x8c508c50,0x83ef83ef,0x8c70840f,0x7bce83ef,0x83ef7bce,0x83ef840f,0x83cf83ef,0x947183ef,0x9430a4b2,0x94709430,
-0xa4d2deb9,0x8c0f7bce,0x83ee840f,0x8c2f8c2f,0x840f9470,0xa5137bce,0x738d9470,0x840f83ce,0x83ef83ef,0x840f840f,0x7bee7bae,0x7bae7bce,0x7bce7bce,0x7bae7bae,0x7bce7bce,0x738d736d,0x8c30842f,0x7bce7bee,0x738d736d,0x738d7bae,0x738d6b6d,0x738d73ae,0x73ae738d,0x738d6b6d,0x7bce840f,0x73ae73ae,0x6b4d738e,0x73ae738e,0x84107baf,0x6b6d7bcf,0x73ae738d,0x840f7bce,
-0x83ef8c0f,0x736d7bae,0x7bae7bce,0x7bae7bae,0x6b2c736d,0x6b2c632c,0x6b4c6b6d,0x6b4c632c,0x6b4c6b6d,0x738e738d,0x73ae73ae,0x632c632c,0x8c717bef,0x94b294b2,0x7bef8410,0x7bef7bcf,0x84108430,0x632c6b4c,0x632c6b6d,0x840f738d,0x7bce7bce,0x6b2c73ae,0x6b6d632c,0x738e6b6d,0x6b4d6b4c,0x6b4d632c,0x6b4d6b4d,0x6b4d6b4d,0x6b6d736d,0x6b4c6b4d,0x6b4c632c,0x73ae6b6d,
-0x94709470,0x94509491,0x8c308c0f,0x9c919491,0x8c508c50,0xb575a4d2,0x9cb2a4d2,0x94509cb1,0x83ee8c0f,0x94708c0f,0x8c109451,0x7bae83ef,0x8c3083ef,0x8c30840f,0xb5549cd2,0x9470a4f2,0x9cb19491,0x7bce8c50,0x9cb27bae,0x8c0fa4f3,0x83ee83ce,0x8c307b8d,0xb595bdb5,0xdedaad54,0x8c0eb574,0x9cb18c50,0xad33ad54,0x9471ad54,0x94719471,0x94719471,0x94709471,0x9cb19cd2,
-0x840f8c2f,0x736d83ef,0x736d62eb,0x8c307bae,0x7bae840f,0x945083ef,0x9cb28c30,0x94919cd2,0x8c509491,0x9cb29cb2,0xb5759cd2,0x94b19cf2,0x9cd29491,0xa513a4f3,0xa513ad54,0x8c309cb2,0x94718c30,0x83ef9471,0x94918c50,0x8c518c50,0x8c509492,0x9cb28c30,0xb575bd96,0x94718c10,0x8c309471,0x94518c51,0x94919471,0x83ce840f,0x840f8c2f,0x8c0f9470,0x8c0f8c0f,0x8c2f9450,
-0x83ce7bad,0x83ce83ee,0x83ee83ee,0x8c30840f,0x9cb2a513,0x947183ef,0x84108c30,0x83ef8410,0x7bae7bae,0x83ef7bae,0x840f7bcf,0x8c30840f,0x7bae7bce,0x7bce7bce,0x8c5083ef,0x83cf8c10,0x8c1083ef,0x83cf83ef,0x83ce7bae,0x83ef83ce,0x8c2f8c0f,0x83ee840f,0x83ef7bee,0x7bce83ef,0x840f6b4c,0x840f8c70,0x7bae7bce,0x7bce7bae,0x7bae83ef,0x8c0f7bae,0x8c0f9450,0x8c3083ef,
-0xc5f7b574,0x947083ee,0xa4f39cb1,0x840f9470,0x83ef8c0f,0xb5957bae,0x736c8c50,0x7bce840f,0x7bce83ef,0x83ef840f,0x7bae7bce,0x7b8d7bae,0x83ef7bce,0x738d7bae,0x7bae7bae,0x7bae7bae,0x7bce7bae,0x7bae7bee,0x736d738d,0x738d6b6d,0x73ae6b6d,0x73ae73ae,0x738d7bcf,0x6b6d738e,0x7bce738d,0x7bae83ef,0x738e738e,0x8c728410,0x7bcf736e,0x73ae7bcf,0x73ad73ae,0x7bce73ad,
-0x7b8e83ce,0x736d736d,0x738d7bae,0x7bae736d,0x736d840f,0x6b4d6b4d,0x6b6d6b4c,0x736d736d,0x7bef73ae,0x632c738e,0x632c6b4c,0x7bcf632c,0x94b27bef,0x841094b2,0x73ae7bf0,0x7bcf7bcf,0x8c309cd3,0x5aeb73ae,0x6b4d5aeb,0x840f738d,0x73ae83ef,0x630c6b4d,0x6b6d632c,0x738d736d,0x632c736d,0x6b2c630c,0x6b2c632c,0x6b4d6b4d,0x736d6b4d,0x6b4d632c,0x6b4d6b4c,0x73ae632c,
-0x94718c50,0x8c309491,0x8c3083ef,0x94719471,0x94719cb2,0x9cb29451,0xa4d2ad34,0x94709c91,0x94709470,0x83ee8c0f,0x94509450,0x94918c50,0x840f8c30,0x94708c30,0xa4f29470,0x8c2fa4d2,0x8c2f8c2f,0x83ef8c0f,0x7bce83ce,0xa4d29c91,0x8c2f8c50,0x8c0f8c0f,0xbdb69cb2,0xffbdbdd6,0x944fb595,0x840f83ce,0x94708c50,0x8c30b575,0x9cb29471,0x8c309471,0x83ce8c50,0x8c0f736d,
-0x8c507bce,0x7bae840f,0x6b4c7bce,0x736d738d,0x7b8e7b8e,0x94507bce,0x94718c50,0xa513a4d2,0x9cd2a4f2,0x8c709491,0x9cd28c50,0x94919cd2,0xa5139491,0x9cb2a4f3,0x9cb29cb2,0x8c309cd3,0x840f8c10,0x83ef8c0f,0x8c50840f,0xa4f39471,0x9cb29cd2,0x94718c30,0x8c309c92,0x841083ef,0x84108410,0x8c109492,0xad349471,0x7bce9450,0x8c2f840f,0x8c2f8c2f,0x83ee8c2f,0x83ee7b8d,
-0x736d7bce,0x83ee7bce,0x7bce7bad,0x8c0f83ef,0x842f9471,0x84108c51,0x8c518c30,0x7bcf83ef,0x7bae83f0,0x7bce7bae,0x7bae83ef,0x840f83cf,0x736d840f,0x8c3083ef,0x8c518410,0x83ef83ef,0x83ef83cf,0x736d7bae,0x7bae736d,0x7bae83ce,0x83ee8c30,0x8c308c2f,0x840f840f,0x73ad7bce,0x736d6b6c,0x8c50840f,0x7bce83ef,0x7bae7bce,0x83ce8c30,0x8c0f83ef,0x8c308bef,0x94509471,
-0xb5959491,0x94919c91,0x9c918c2f,0x94709471,0x840f8c50,0xc5d68c2f,0x7bce8c0f,0x7bce83ef,0x7bce738d,0x840f83ef,0x7bce7bae,0x7bce83ef,0x83ef8c30,0x83ef7bcf,0x7bae83ef,0x84107bae,0x7bce73ad,0x7bee7bce,0x7bae7bce,0x73ae738d,0x73ae7bce,0x8c50738d,0x7bef8c51,0x736d6b6d,0x7bae738d,0x7bcf7bef,0x7bcf7bcf,0x8c518431,0x738e738e,0x7bef6b6d,0x630b738d,0x738d73ad,
-0x7bae83cf,0x738d738d,0x738e7bae,0x736d736d,0x736d6b4d,0x6b4d738d,0x73ae6b6d,0x83ef7bce,0x84108410,0x6b4d73ae,0x738e6b6d,0x7bef6b6d,0x84107bef,0x8c718c71,0x73ae8431,0x8410738e,0x8c318c51,0x5aeb7baf,0x738e62eb,0x73ae73ae,0x7bce840f,0x62eb6b6d,0x736d62eb,0x738d73ae,0x6b4d6b4d,0x6b2d6b4d,0x6b4d6b4d,0x6b4d6b4d,0x6b4d6b4d,0x630c630c,0x6b4d630c,0x738d6b4d,
-0x840f840f,0x94718c30,0x94719491,0x94719450,0x9cd29cb2,0x94919c91,0xad549cb2,0x94719471,0x8c0f9c71,0x94308c0f,0x83ee8c0f,0x840f840f,0x7bce83ef,0x94918c30,0x94708c2f,0x94709cb1,0x94508c30,0x945083ee,0x7bad83ef,0xa4f39450,0x9471b554,0x8c0f840f,0xb5749cd2,0xffffdeb9,0xad13ce17,0x8c0f9c91,0x9cb28c30,0xa4f3c5f7,0x947183ef,0x83ef8c50,0x736c738d,0x736c62ea,
-0x8c507bae,0x8c509c91,0x7bce7bae,0x7bae7bce,0x7bae736d,0x9cd29451,0x8c308c30,0x94919cd2,0x94b29471,0x8c719491,0x9cb29471,0x9cb2a513,0x94719cb2,0x9471a4d3,0x9cd38c51,0x94919471,0x8c508c30,0x94919c91,0x9cb29491,0xa5149cd2,0x9cb2ad54,0x8c518c51,0x84108c30,0x8c307bce,0x841083ef,0x8c308c30,0x94719451,0x83ef8c30,0x840f7bae,0x94708c2f,0x840f8c2f,0x736c736c,
-0x83ce7b8d,0x7b8d8c0f,0x83ce736d,0x83ce7bce,0x840f7bce,0x8c30840f,0x8c3083ef,0x7bcf8c10,0x83f07baf,0x7bcf7bef,0x840f7bae,0x83ef83ef,0x8c518410,0x8c3083ef,0x84108410,0x7bcf8410,0x7b8e734d,0x7bae7bcf,0x83ef7bce,0x83ef8c0f,0x83ef7bce,0x947183ef,0x840f8c50,0x83ef9cb2,0x7bce7bae,0x8c3083ef,0x84109471,0x7bae7b8e,0x840f83ef,0x83ce83cf,0x8c2f840f,0x8c308c2f,
-0xbd9583ce,0x840f9471,0x7bce83ef,0x8c509450,0x8c509450,0xc6179c91,0x7bce7bad,0x738d7bce,0x83ef7b8d,0x840f83ef,0x83ef83ef,0x83ef8c30,0x7bae83ef,0x7bee7bae,0x7bae83ef,0x8c307bce,0x73ae738d,0x7bce7bae,0x73ae7bee,0x6b6d736d,0x738d6b6d,0x84307bae,0x73ae7bef,0x738e738e,0x7bce7bae,0x7bef7bce,0x7bae7bef,0x73ae7bcf,0x738e736d,0x6b6d738d,0x632c6b4c,0x6b6d6b2c,
-0x7bae7bce,0x7bae7b8e,0x7bce7bae,0x6b4d7bae,0x6b2c630c,0x73ae6b6d,0x840f840f,0x73ae73ae,0x7bef73ae,0x7bef8410,0x6b6d73ae,0x738e6b4d,0x738e73ae,0x7bef7bef,0x6b4d73ae,0x7bcf6b4d,0x7bcf7bcf,0x5acb6b4d,0x6b6d630c,0x6b6d6b6d,0x73ae840f,0x632c736d,0x736d630c,0x6b4d738e,0x6b2d6b2c,0x62ec62ec,0x736e6b4d,0x6b4d6b4d,0x6b4d6b6e,0x6b4d6b4d,0x6b4d6b4d,0x6b4c6b4d,
-0x94719491,0x9c919470,0x9cb29cd2,0x94719471,0xa4f39471,0x9cb29cd2,0x9cb29491,0x9471a4f3,0x94509c91,0x8c0f8c0f,0x83ef8c0f,0x94918c0f,0x840f8c50,0x9471840f,0x9cb19cb1,0x94709470,0x8c0f9491,0x83ef83ce,0x7bad9450,0x8c50840f,0xb574b554,0x94919c91,0x94709471,0xffded699,0xa4d2c5f6,0x83ef9cb1,0xc617b575,0x8c309cb2,0x7bce7bce,0x7b8d7bce,0x7bce736c,0x7bad7bce,
-0x8c50840f,0x8c508c30,0x83cf7bce,0x736d83ef,0x7bae7bce,0x94919cb2,0x947183ef,0x94919470,0x8c508c30,0x8c509491,0x94718c51,0x9cb29492,0x94919cb2,0x9cb29471,0x94929471,0x8c109451,0x9c919471,0x94719cb2,0x8c708c70,0x94718c50,0xa4f3a514,0x94918410,0x7bcf9492,0x83ef7bae,0x841083ef,0x8c5083ef,0x7bce8c50,0x8c30840f,0x8c2f83ee,0x8c509470,0x83ee8c0f,0x7b8d7bad,
-0x83ce7b8d,0x7bad8c0f,0x7b8d7b8d,0x83ef734c,0x7bce8c10,0x83ef8c50,0x7bcf8c10,0x841083f0,0x7bcf7bcf,0x7baf8410,0x7bcf83ef,0x8c518c50,0x9cb28c30,0x84108c51,0x841083f0,0x83ef83ef,0x7bcf8410,0x7bcf7bae,0x8c508c30,0x83ef8c30,0x8c307bae,0x9cd29c91,0xa5339cd2,0x8c30a513,0x7bae7bce,0x83ef7bae,0x94918c50,0x7bce8c50,0x7bae7bae,0x8c1083ef,0x8c0f83ef,0x83ce8c2f,
-0xa5137bce,0x7bce9cd2,0x94719491,0x8c2f8c50,0x8c509491,0xce179cb2,0x6b4c7bad,0x738d738d,0x7bce7bce,0x7bce7bce,0x840f840f,0x7bce840f,0x7bae7bae,0x7bae73ad,0x7bce7bce,0x73ad7bae,0x7bce7bae,0x7bce7bee,0x7bae7bce,0x6b6d738d,0x738d6b4c,0x6b6d7bae,0x73ae6b6d,0x7bae7bef,0x7bce7bef,0x7bce7bae,0x7bef840f,0x738e7bce,0x738e6b4d,0x632c73ae,0x736d632c,0x738d6b6d,
-0x736d738d,0x738d736d,0x7bce738e,0x736d7bae,0x6b4d6b4d,0x73ae6b6d,0x840f83ef,0x840f7bef,0x7bef8430,0x738e73ae,0x6b4d6b6d,0x73ae6b6d,0x738e73ae,0x6b6d73ae,0x632c632c,0x738e6b6d,0x736e73ae,0x630c630c,0x6b4d6b6d,0x6b6d6b4c,0x6b6d7bef,0x6b4d6b4c,0x6b6d6b4d,0x6b2c6b4d,0x738e736d,0x6b4d6b6d,0x6b6d6b4d,0x738e6b6e,0x630c6b4d,0x736e632c,0x73ae7bae,0x7bce73ae,
-0xa4f29c91,0x840f9cb2,0x8c50840f,0x94719471,0x8c309cb2,0x94919471,0x94919471,0xa5139cd2,0x94709450,0x8c0f9450,0x9c919450,0x8c509471,0x8c2f9470,0x8c2f7bcd,0x94719c91,0x8c2f83ef,0xa4d29cd2,0x8c0f9450,0x8c308c0f,0x83ef83ef,0xbdb69471,0xa4f3ce58,0x9470a533,0xd678deb9,0xa4d3bdb6,0xb5959491,0x9471c5f7,0x738e7bae,0x840f8c30,0x738d7bae,0x738d7bad,0x7bce7bce,
-0x83ee83ce,0x83ef83ef,0x738d8c30,0x738e736d,0x9491840f,0x94718c30,0x83ef9491,0x8c30840f,0x8c308c50,0x8c518c71,0x8c308c71,0x8c518c30,0x94929471,0x9c929471,0x94929471,0x83cf9471,0x9cd28c50,0x9471a4f3,0x840f8c50,0x9471840f,0x94b29491,0x9cf38c50,0x7bef9cd2,0x7bef7bce,0x8c308c30,0x84108c51,0x8c30840f,0x8c0f840f,0x94719450,0x7bce8c2f,0x7b8d83ce,0x8c0f736c,
-0x7b8d7b8d,0x7b8d8c0f,0x7bae734d,0x7bae7b8d,0x840f8c50,0x94518410,0x7bcf8410,0x84107baf,0x83ef7baf,0x84108410,0x841083ef,0x8c508c30,0x94718c51,0x94929471,0x83ef8c10,0x83ef83f0,0x7bcf8410,0x840f83ef,0x8c509471,0x7bae840f,0x947183ef,0x9cb29cd2,0xb575a4f3,0x8c30a4f3,0x7bae83ce,0x7bae738d,0x8c3083ef,0x83ef8c30,0x738d7bae,0x8c307bce,0x840f8c2f,0x7bce840f,
-0x8c507bce,0x7baea513,0x94718c50,0x7bae8c50,0x840f83ef,0xb595ad34,0x73ad738d,0x7bae83ef,0x7bce7bce,0x7bce7bce,0x945083ef,0x7bce83ef,0x738d738d,0x7bae7bae,0x8c50840f,0x7bce8c30,0x84307bef,0x840f8c30,0x83ef840f,0x7bae7bce,0x73ae7bcf,0x73ae7bcf,0x73ae73ae,0x841083f0,0x7bce7bef,0x73ae738d,0x7bef7bce,0x738e7bce,0x736d6b6d,0x6b6d6b6d,0x6b6d6b4c,0x83ef83f0,
-0x738d7bae,0x7bae7b8e,0x83ef7bcf,0x7bcf83f0,0x6b2d736d,0x6b6d6b4d,0x840f73ae,0x84308c30,0x73af7bcf,0x6b6d738e,0x6b6d6b4d,0x738e738e,0x7bae7bcf,0x73ae738e,0x6b4d6b4d,0x7bcf7baf,0x7baf7bcf,0x630c6b4d,0x738d6b6d,0x738e738e,0x632c7bcf,0x6b2c62ec,0x736d6b6d,0x736d6b6d,0x630c6b4d,0x6b2d632c,0x6b6d6b4d,0x7baf738e,0x738e7bcf,0x6b4d6b4d,0x632c6b6d,0x6b4d630c,
-0xa5138c2f,0x9c91ad54,0x94718c30,0x94719c92,0x94719471,0x9cb283ef,0x94919491,0xa4f39cb2,0x9c91a4d2,0x8c309470,0xa4d29450,0x9470a4f3,0x94709cb1,0x94708c2f,0x94509471,0x94508c2f,0x94719450,0x83cea4d2,0x83ee83ee,0x94918c50,0xbd959cb1,0xc617d678,0xbdb6b595,0x94b1ef3b,0xb5759cb2,0xad34c5f7,0x7b8e7bcf,0x83ef83ef,0x7bae7bcf,0x7bae738e,0x83ef83ef,0x8c509471,
-0x8c2f9cb1,0x7bce8c0f,0x8c30840f,0x7b8e7b8e,0x8c50840f,0x8c509451,0x94919cd2,0x8c508c0f,0x8c719471,0x94718c50,0x8c5194b2,0x8c308c51,0x8c508c30,0x94519471,0x9cb29451,0x94519c92,0x9cd28c30,0x8c509cb2,0x94b19471,0x83ef8c50,0x94919491,0x9cf394b2,0x8c309491,0x840f83ef,0x8410840f,0x84108c30,0x83ef83ef,0x840f840f,0x94509450,0x7bae83ef,0x736c734c,0x83ce734c,
-0x736d83ce,0x83ae7b8d,0x7b8d83ce,0x83ef734c,0x8c308c30,0x94718c10,0x7bae9472,0x7bcf8c10,0x841083ef,0x7bef8c51,0x8c308c30,0x7bcf8c30,0x94918c50,0x94928c50,0x7bae9451,0x83ef8c10,0x7bcf7bae,0x7bae7bcf,0x83ef7bae,0x840f840f,0x9cb2840f,0x94919c91,0x9cb29491,0x8c509cb2,0x7bae7bae,0x7bae736d,0x83ef840f,0x9491840f,0x83ef83ef,0x7bce7bae,0x8c308c50,0x840f83ee,
-0x949183ef,0x83efb595,0x83ef83ef,0x83ef9471,0x8c3083ef,0x94b1bdf6,0x7bae736d,0x6b4c738d,0x840f7bae,0x840f8c0f,0x9cb27bce,0x83ef83ef,0x83ef83ef,0x83ef83ef,0x842f83ef,0x7bce840f,0x840f7bae,0x840f8430,0x840f840f,0x7bce7bef,0x73ae7bcf,0x84307bcf,0x7bae7bcf,0x840f73ae,0x7bce7bcf,0x738d738d,0x73ae738d,0x6b6d738d,0x6b4d6b6d,0x6b6d6b6d,0x6b6d6b4d,0x83f07bae,
-0x7bae83cf,0x7bae7bae,0x7bcf7baf,0x7bcf7bcf,0x738e7bae,0x8c307bef,0x8c718c50,0x73ae840f,0x7baf73ae,0x6b4d738e,0x6b6d630c,0x7bcf7bcf,0x73ae7bae,0x736d6b4d,0x6b4d6b4d,0x738e73ae,0x6b4d6b6d,0x632c6b2d,0x738d6b6d,0x6b4d736d,0x6b6d7bce,0x630c630c,0x736e6b4d,0x736d6b6d,0x6b4d7bcf,0x6b4d632c,0x6b6e6b6d,0x632c6b6d,0x7baf73af,0x736e738e,0x62ec632c,0x6b2c630c,
-0x9cd28c50,0xad34ad34,0x94719cb2,0x8c308c50,0x94718c30,0x9491a4f3,0x9cb29cd2,0x94918c50,0xa4b29c92,0x8c0f9450,0x9cb19470,0x9cb19cb1,0x94709cd2,0x94708c2f,0x94509450,0x83ee840f,0x7bae8c0f,0x945083ef,0x83ce8c50,0xad348c30,0xa513b574,0xc5d6b595,0xc5f6bdb5,0x8c50deda,0xbdd79491,0x9471ad14,0x9cb38c31,0x8c519451,0x7bae8c10,0x94928c30,0xa4f39491,0x8c50ad34,
-0xad54a513,0x94719c91,0x83ef83cf,0x8c308c30,0x8c519471,0x94719471,0x9cb29cb2,0x8c509471,0x94919cb2,0x8c518c30,0x94b29492,0x8c519471,0x8c518c30,0x94718c30,0x8c309492,0x9c919c92,0xa4f39471,0x9cb2ad34,0x8c308c30,0x94719471,0x9cf39cf3,0x94918c50,0x7bef8c50,0x7bef8430,0x738d7bae,0x8c507bae,0x7bce8c0f,0x94508c30,0x8c0f8c2f,0x8c2f8c30,0x7b8d7bad,0x734c736c,
-0x83ef7b8d,0x7b8d83ce,0x83ce83cf,0x7bce736d,0x83ef840f,0x8c518c30,0x8c518410,0x83cf83cf,0x8c309471,0x84107bcf,0x8c508410,0x8c508c30,0x8c508c50,0x8c309491,0x8c108c30,0x8c108410,0x7bcf7bcf,0x7baf7bcf,0x83ef7bce,0x7bae83ef,0x8c508c30,0x9cb29cd2,0x8c509471,0x840f8410,0x7bce8c30,0x840f83cf,0x7bae7bce,0x8c10840f,0x8c109451,0x83ef83ef,0x8c30840f,0x8c0f8c50,
-0x840f7bce,0x8c50bdb6,0x8c30840f,0x8c3083ef,0x7bae83ef,0x842fb595,0x7bae83ef,0x7bae736d,0x83ef7b8d,0x840f840f,0x94507bce,0x83ce7bce,0x7bce840f,0x7bce7bae,0x83ee7bce,0x83ef840f,0x7bce73ae,0x7bce7bce,0x73ae7bce,0x738d738d,0x738d738e,0x73ae738d,0x7bcf73ae,0x736d736d,0x7bce738e,0x738d738d,0x73ae6b6d,0x738d73ae,0x6b6d6b6d,0x6b4c73ae,0x738e6b4d,0x73ae6b2d,
-0x83cf83cf,0x7bae7bae,0x7bcf7bcf,0x7bcf7baf,0x7bae7bae,0x8c50840f,0x7bef8c50,0x738d738d,0x73af7bae,0x6b6e736e,0x7bcf738e,0x73ae83f0,0x738e738e,0x632c6b4d,0x6b6d630c,0x632c6b6d,0x5acb62eb,0x736d6b2c,0x738d738e,0x630c6b2c,0x7bce7bef,0x630c6b6d,0x6b6d6b4d,0x6b2d6b2d,0x6b2d6b4d,0x6b2d6b2d,0x632c6b2d,0x632d632d,0x73ae6b6e,0x8c318410,0x6b2c6b6d,0x6b6d6b4d,
-0x9cb2a4f3,0x9cd29cb2,0x94919cb2,0x94719471,0x9cb28c30,0x9cd2ad34,0xa4f39491,0x8c30840f,0x9cb29451,0x9471a4d2,0x9c918c50,0x8c509cb1,0x94708c4f,0x94708c50,0x8c309450,0x83ef83ee,0x83ee9470,0x8c5083ef,0x83ee9c91,0x94508c2f,0x9491a4f3,0xad549cb2,0xdeb9bdd6,0xb574b595,0xb575c617,0xa4f38c51,0xa514ad34,0x8c308c51,0x7bcf8c51,0xbdd6a514,0xad34a4f3,0x9cd2ad54,
-0xa5139cb1,0x94719cd2,0x83cf9471,0x9cd28c30,0x8c308410,0x9cb28c50,0x9cb1ad34,0x94919471,0x8c509471,0x94929471,0xad549cf3,0x8c509471,0x7bcf8c30,0x94518c30,0x94719c92,0x9cb28c51,0x9471a4d2,0xa4f39cb2,0x840f8c70,0x9cd29491,0x94b29cd2,0x7bce83ef,0x84108410,0x94b283ef,0x736d7bce,0x9471840f,0x94919471,0x8c509471,0x83ce8c0f,0x8c308c30,0x736c9450,0x6b2b6b0b,
-0x83ef736d,0x83ee8c0f,0x83ae83ae,0x7bae7bae,0x8c0f8c30,0x83ef83ef,0x83f083cf,0x7baf83cf,0x84108410,0x841083ef,0x94918c50,0x94519471,0x8c108c30,0x8c308c50,0x84108c30,0x84109492,0x83ef83ef,0x840f7bef,0x83ef83ef,0x841083ef,0x840f8c0f,0x949183ef,0x83ef8c50,0x7bae8c10,0x840f83ef,0x7bae83ef,0x83ef7bce,0x83ef83ef,0x9471840f,0x7bce8c30,0x8c0f840f,0x840f83ef,
-0x83ce8c50,0x9cb2a4f3,0x83ef83ce,0x83ce840f,0x8c308c30,0x7bceb5b5,0x7bce840f,0x7bae7bce,0x7bae7bae,0x7bce7bce,0x83ef83ef,0x83ef7bce,0x7bce8c30,0x7bce73ad,0x7bce7bce,0x7bee83ee,0x7bef83ef,0x7bce7bce,0x738d7bce,0x6b6d6b6d,0x738e6b6d,0x632c73ae,0x6b6d6b4d,0x736d736d,0x7bce736d,0x738d738e,0x73ad6b6c,0x738d73ad,0x738d736d,0x7bce7bae,0x6b6d738e,0x736d736d,
-0x7bce7bae,0x7bae7bae,0x7bae7baf,0x738e738e,0x738e738e,0x736d6b6d,0x84107bef,0x73ae7bce,0x6b4d6b4d,0x7baf6b6d,0x738e7bae,0x73ae7baf,0x738e73ae,0x736d738e,0x7bcf6b6d,0x6b2c6b6e,0x6b2c73ae,0x6b4d6b4d,0x738e6b4c,0x73ae738e,0x84108410,0x630c738e,0x6b4d6b2c,0x6b2d630c,0x6b6e6b4d,0x632d6b4d,0x6b4d6b4d,0x6b4d6b2d,0x6b4d632d,0x94b38430,0x630c6b4d,0x738e6b4d,
-0x94519c91,0x83ef9450,0x9cb19c91,0x9c919cb1,0x8c308c50,0x8c519492,0x8c309471,0x8c508c50,0x94718c30,0x9cd2a513,0x94919450,0x94509cb1,0x9450840f,0x94708c70,0x94709471,0x83ce9450,0x8c30840f,0x8c0f7bae,0x94718c30,0x7bad83ef,0xa4d28c2f,0x9cb19450,0xff7ca4d2,0xc5d6d678,0xbdd6b575,0xa4d2a4d2,0x9cd2a4f3,0x9cb29c91,0x94918c0f,0x9cb29471,0x9cd2ad13,0xa4f39cb2,
-0x94709491,0x9cd2a4f2,0x83ef83ef,0x7bee73ad,0x9cb2b575,0x94919491,0x9c92a4f3,0x9cb29450,0x8c309cb2,0x9471840f,0xa5139492,0x94919cd2,0x840f8c30,0x7bce83ef,0x8c307bce,0x9cb28c51,0x9cd2b575,0x8c509cb2,0x94918c30,0x9cf39cd2,0x94b2a513,0x8430840f,0x84308c30,0x94718c50,0x83ef9471,0x9471842f,0x9cd28c50,0x842f9cb2,0x7bce840f,0x94708c30,0x8c2f9470,0x734c738d,
-0x7b6d7b6d,0x94509430,0x734c7b6d,0x83ae8c0f,0x943083cf,0x7bae8c0f,0x7bae83cf,0x83f0738e,0x7bcf7bcf,0x83ef83cf,0x7bcf83cf,0x8c1083ef,0x94718c10,0x8c308c10,0x84108c30,0x84108c10,0x84108430,0x73ae840f,0x840f7bcf,0x8c30840f,0x7bce83ef,0x83ef8c0f,0x7bce736d,0x83ef7bae,0x7bce7bae,0x83ef83ef,0x7bce83ef,0x83cf83ef,0x83ef7bce,0x8c308c50,0x840f83ef,0x8c3083ef,
-0x8c308c10,0xa5138c30,0x840f8c30,0x83cf83ef,0x949183ef,0x7b8dc5f7,0x7bae7b8d,0x738d7bae,0x738d73ad,0x738d736d,0x7bae7bae,0x7bae7bae,0x7bce7bcf,0x73ae73ae,0x7bef7bce,0x73ae7bce,0x7bcf8430,0x7bce73ae,0x6b4c6b6d,0x738d736d,0x7bef73ae,0x6b4c7bce,0x6b4d6b4d,0x6b4d6b4d,0x840f738d,0x7bae9451,0x736d736d,0x736d7bae,0x6b6c736d,0x738e736d,0x6b4d7b8e,0x6b2c6b2c,
-0x7bce6b4c,0x7bcf7bcf,0x7bce7bef,0x630c6b4d,0x738e6b4d,0x738e736e,0x7bcf7bcf,0x6b4d7baf,0x6b6d73ae,0x6b6d6b4d,0x7bcf73ae,0x73ae7bae,0x7bce7bcf,0x83ef7bef,0x7bce8430,0x736d738e,0x632c7bcf,0x6b6d632c,0x6b4d632c,0x73ae6b6d,0x6b6d73ae,0x6b2c6b4d,0x6b4d6b4d,0x83ef6b6d,0x73ae7bef,0x6b4d6b4d,0x630c6b2d,0x6b2d632d,0x6b4e6b4d,0x6b2d6b4d,0x736e6b4d,0x7bce7bae,
-0x9c928c10,0x8c0f9cb2,0x94708c0f,0x94919c91,0x94519471,0x840f8c51,0x9cd2840f,0x94919491,0x8c308c50,0xa4d29cb2,0x94509491,0x94508c2f,0x840f8c30,0x8c508c50,0x94508c2f,0x8c0f8c2f,0x83ef83ce,0x7bce842f,0x8c5083ef,0x8c2f9cd2,0x94708c0f,0x9cb1ad13,0xf73b9c70,0x8c2fc5f6,0x94509cb1,0x94718c2f,0x840f9450,0x8c308c50,0x83ee840f,0x8c308c30,0x94508c30,0x8c2f8c2f,
-0x8c508c2f,0x94719470,0x8c309470,0x7bce8c50,0xb5b59491,0x9cd2a4f3,0xa4f3a4d2,0x94719cb2,0x94719cb2,0x8c508c51,0x9cb28c50,0x94719491,0x8c509cb2,0x8c508c30,0x8c30840f,0x94718c50,0x9cf29471,0x8c5094b2,0x840f8c50,0x8c508c50,0x8c719cd2,0x7bef7bef,0x94928c50,0x8c308c71,0x94b18c30,0x94718c50,0x840f8c50,0x83ef840f,0x8c717bce,0x8c50840f,0x8c509c91,0x7bad8c2f,
-0x83ae7b6d,0x940f83ae,0x8bef9430,0x8c0f83ae,0x8c0f83ef,0x738d7bae,0x736d736d,0x7bef736e,0x83ef8c30,0x8c518c10,0x7bae7bcf,0x8c308c51,0x8c3083ef,0x83ef8c10,0x94929492,0x841083ef,0x840f94b2,0x7bce7bef,0x8c50840f,0x840f9471,0x83ef8c0f,0x8c5083ef,0x83ef83ef,0x7bce840f,0x8c3083ef,0x8c508c50,0x8c308c30,0x7bce840f,0x7bce7bae,0x8c307bce,0x83ef8c50,0x83ef83ef,
-0x83ef8c30,0xad5483ef,0x83ef83ef,0x7bae7bce,0xa4f37bce,0x7bcebdd6,0x7bae738d,0x83ce7bae,0x738d7bce,0x7bae738d,0x736d738e,0x7bce738d,0x7bae7bce,0x7bae73ae,0x7bce7bce,0x7bce7bce,0x83ef7bce,0x738d73ae,0x738d738d,0x7bae73ae,0x73ae73ae,0x738e73ae,0x6b4d738e,0x6b4d632d,0x7bae7bae,0x7bae840f,0x6b2c6b4c,0x736d738d,0x7b8d7b8d,0x738d738d,0x7bce7bae,0x736d7bae,
-0x7bce73ae,0x7bcf7bef,0x83ef83ef,0x738e7bcf,0x738e632c,0x738e6b6e,0x738e7bcf,0x738e6b6d,0x73ae738e,0x738e73ae,0x7bcf738e,0x7bae7bcf,0x73ae73ae,0x738e73ae,0x738e7bae,0x6b6d738e,0x630c6b4d,0x6b4d632c,0x632c6b4d,0x738e632c,0x632c736e,0x630c62eb,0x6b6d6b4d,0x632c632c,0x6b4d736e,0x736e6b4d,0x6b4d6b4e,0x6b2d6b4e,0x738e6b4d,0x738e73af,0x83ef7bae,0x7bae83ef,
-0x94718c30,0x9cb29cd2,0x94908c2f,0x94709491,0x8c308c30,0x94927bcf,0x94929cb2,0x840f8c71,0x83ee8c2f,0xa4f3840f,0xa4d2ad13,0x94719cb2,0x83ef83ef,0x9cb2842f,0x738d8c0f,0x83ce8bef,0x840f83ef,0x83ef7bae,0x83ce7bae,0xb5549470,0x94719c91,0xb534a4f2,0xef1bde79,0xad339cb1,0x83ee8c30,0x7bce7bae,0x7bce840f,0x83ef7bae,0x7bad8c30,0x8c5083ef,0x7bae840f,0x83ee7bad,
-0x9c918c0f,0x83ee9470,0x94919450,0x9cb29450,0xa5139470,0xb575bdb6,0x9cb2ad13,0x9cb29c91,0x8c509451,0x8c508c50,0x8c308c50,0x8c30840f,0x8c508c70,0x94718c50,0x840f7bef,0x8c518c71,0x94919492,0x9cb2ad34,0x84309471,0x94918c30,0x7bcf8c30,0x7bae7bae,0x8c717bef,0x7bef8410,0x94918410,0x842f9cb2,0x947183ef,0x7bce83ef,0x840f7bef,0x8c308c50,0x94718c0f,0x7bce9471,
-0x83ce6b0b,0x83ae83ce,0x94508c0f,0x7b8d83ce,0x945083cf,0x7bae83ef,0x7bcf7bcf,0x8430738e,0x83ef83ef,0x8c1083ef,0x7bae83ef,0x841083cf,0x8c308c10,0x7bcf8c30,0x9c9283ef,0x83f09451,0x84308c30,0x7bae840f,0x9471840f,0x8c308c50,0x83ef7bae,0x840f83ce,0x9cd2a4f3,0x7bae7bce,0x8c308c50,0x8c5083ef,0x8c508c50,0x83ef840f,0x7bae7b8e,0x840f83ce,0x840f840f,0x840f83ef,
-0x83cf840f,0xa51383ef,0x8c309471,0x83ef7bce,0xad1483cf,0x7bcea4f3,0x7bae7bce,0x736d736d,0x73ad7bee,0x7bae738d,0x736d7bae,0x7bae736d,0x7bce7bcf,0x7bae7bae,0x7bae7bae,0x7bce7bce,0x7bae738d,0x7bae7bce,0x7bae738d,0x7bce83ef,0x738d7bae,0x7bce738e,0x6b6d738e,0x6b4d6b4d,0x738e738e,0x738e7bcf,0x6b4c6b2c,0x736d7bae,0x738d738d,0x7bae7bae,0x7bae7bae,0x7bcf7bae,
-0x7bae7bae,0x7bce7bce,0x73ae7bae,0x6b4d738e,0x738e6b6e,0x738e736e,0x738e7bcf,0x738e6b6e,0x73ae6b6d,0x738e738e,0x7bcf73ae,0x7bcf83ef,0x6b4d6b4d,0x6b4d6b6d,0x73ae736d,0x738e7bcf,0x630c630c,0x6b6d632c,0x6b4d73ae,0x632c5aeb,0x630c6b4d,0x62ec630c,0x632c630c,0x632c632c,0x6b4d738e,0x6b2d6b4d,0x630c62ec,0x6b2d6b4d,0x7bcf738e,0x73ae7bcf,0x73ae738e,0x6b4d738e,
-0x94719492,0x9cb29471,0xa4f29471,0x9c919cb1,0x83cf9451,0x947183ef,0x8c509cd2,0x840f840f,0x9491840f,0x94509450,0xa4d29491,0x94719471,0x842f8c50,0x8c50840f,0x8c0f8c50,0x83ce7bae,0x83ef7b8d,0x7bce7bce,0x7bce83ef,0xa4f28c0f,0x9c91ad34,0x94509c71,0xb554ef1b,0xb5748c2f,0x9450a4d2,0x9cb28c50,0x94919471,0x7bce83ef,0x8c3083ee,0x8c508c30,0x94508c50,0x94509c91,
-0x94709470,0x8c509470,0x9cb283ee,0x9cb29c91,0x9cb19cb2,0xce58a513,0x8c30bd95,0x9cb18c50,0x9491a513,0x8c508c30,0x94919491,0x83ef840f,0x94919471,0x8c509471,0x840f7bcf,0x8c508c71,0x9cb294b2,0x94b28c71,0x94b28c71,0x84309492,0x7bef8c51,0x84107bcf,0x841083ef,0x840f7bef,0x9471840f,0x94919471,0x7bce840f,0x840f83ef,0x8c507bce,0x840f840f,0x8c308c30,0x94509c91,
-0x83ce83ee,0x7b8d8bef,0x8bef7b8d,0x83ce8c0f,0x8bef734d,0x7bae83ef,0x7bcf8410,0x7bcf7bae,0x7b8e83ef,0x8c1083ef,0x83cf7bcf,0x83cf8410,0x8c3083ef,0x83ef83ef,0x8c308c51,0x841083f0,0x84308c50,0x7bce840f,0x94919471,0x840f8c30,0x840f8c30,0x7bce840f,0x9cd29471,0x7bce8c30,0x8c108c50,0x83ef7bce,0x8c308c10,0x840f8c30,0x7bae7bce,0x7bae7bce,0x8c0f7bae,0x94718c30,
-0x8c309451,0x94918c30,0x840f9cb2,0x83ef83ef,0xa5137bae,0x840f8c30,0x7bae83ef,0x7bce738d,0x7bae7bce,0x738d738d,0x738d738d,0x738d738d,0x7bce7bcf,0x738d73ae,0x7bce7bae,0x7bae7bce,0x736d738e,0x7bef73ae,0x7bce7bce,0x7bae840f,0x73ae73ae,0x73ae73ae,0x738e6b4d,0x6b4d738e,0x738e736d,0x7bae7bce,0x7bae736d,0x73ad7bee,0x738d738d,0x7bae736d,0x7bae7bce,0x738e7bae,
-0x6b6d6b6d,0x7bef73ae,0x73ae7bce,0x6b4d738e,0x736e6b4d,0x7baf7bcf,0x6b4d6b4d,0x738e73ae,0x738e6b6d,0x738e6b4d,0x738e73ae,0x7bef7bcf,0x6b4d738e,0x6b2d6b4d,0x738e6b4d,0x738e7bcf,0x632c632c,0x6b6d6b4d,0x6b6d73ae,0x6b4d630c,0x632c738e,0x630c630c,0x6b2d630c,0x632c6b2c,0x6b6d6b4d,0x6b4d6b4d,0x632d6b2d,0x632d6b2d,0x6b4d632d,0x738e736e,0x736d736e,0x73ae738e,
-0x8c5083ef,0x8c508c30,0xad339491,0x94709491,0x94719471,0x84108c51,0x9cb29491,0x94709cd2,0x94709cb2,0x8c0f9491,0xa4f283ce,0x8c509471,0x8c309471,0x8c708c30,0x94918c30,0x7b8d8c2f,0x7bce83ce,0x736d7bae,0x83ef738d,0x94508c30,0xc5d69cd2,0x9cb2ad13,0xad33c5f6,0x9470a513,0x9491a4f2,0x9cd29491,0x9cb29cb2,0x7bce83ef,0x9cd28c50,0x94509c91,0x9cb19450,0x8c509cd2,
-0xa4d29450,0x9cb19cb1,0x8c2f83ee,0xad33a512,0x9491a4f2,0xb5749cb1,0x9471c5f6,0x8c0f9450,0x9cf29cd2,0x8c509cb2,0xa4f39491,0xa4f39cd2,0x9cf39cd2,0x8c508c71,0x8c518430,0x8c718c71,0x94929492,0x94928c51,0x9492a514,0x8c518c71,0x8c319cd3,0x84307bcf,0x84108410,0x84308410,0x8c30840f,0x9cd28c50,0x7bce9471,0x8c307bae,0x8c50840f,0x8c508c50,0x94718c50,0xa4f3a4d2,
-0x94309cb1,0x7bad8c0f,0x7bae7bae,0x945083ef,0x7b8e7bae,0x8c0f8c0f,0x7bce7bcf,0x7bae83ef,0x7bcf8410,0x84108c30,0x8c307bcf,0x84108c30,0x83ef83cf,0x8c1083ef,0x83ef8c30,0x840f83cf,0x84309491,0x8c508c50,0x840f8c30,0x83ef840f,0x8c1083ef,0x7bce83ef,0x7bce83cf,0x83ef8c50,0x83ef738e,0x7bcf83ef,0x83ef83cf,0x8c508c50,0x7bce8c30,0x738d6b4c,0x83ef7bce,0x94919471,
-0x7bae8c30,0x8410840f,0x7bae8c51,0x736d7bce,0x9cd3738e,0x7bce738e,0x7bae7bce,0x7bce738d,0x73ad7bce,0x736d738d,0x738d738d,0x73ae738d,0x738e738e,0x736d738d,0x83ef7bae,0x7bae83ef,0x738e7bae,0x7bae736d,0x840f840f,0x7bae7bce,0x738d73ad,0x738e738e,0x738d6b2c,0x736d738e,0x738e738d,0x7bce7bae,0x83ef83ef,0x7bce7bce,0x7bae7bae,0x738d7bae,0x840f7bce,0x7bce840f,
-0x73ae83ef,0x83ef7bce,0x73ae7bcf,0x6b2c738e,0x6b4d6b6d,0x736e738e,0x73ae6b4d,0x738e7bcf,0x738e6b6d,0x73af6b6e,0x632d738e,0x7baf738e,0x6b4d73af,0x632c630c,0x736e632c,0x738e7baf,0x632d6b4d,0x6b6d6b4d,0x632d6b4d,0x7bcf6b6d,0x630c73ae,0x5aeb5acb,0x62ec62eb,0x62eb62eb,0x6b6d632c,0x736e6b4d,0x6b2d738e,0x630c630c,0x6b4d6b4d,0x738e736e,0x6b2c6b6d,0x6b4c632c,
-0x8c1083ef,0x94918c50,0xb5549cb2,0x9471a513,0x9cd2840f,0x8c509491,0xb5959cd2,0x9cd1bdd6,0x9491a513,0xad139cb2,0x8c309450,0x9cb29c91,0x94919491,0xa4f38c50,0x8c309471,0x7b8d8c30,0x7bae7bae,0x7bce7bae,0x83ef83ef,0x945083ef,0xa4f3a513,0xbdb6ad13,0x9450a4f3,0x9cb1d658,0x9cb19470,0x8c0f9491,0x94919471,0x840f840f,0x83ef8c50,0x9cb19471,0x8c508c50,0x9cd29491,
-0xad139cb1,0x8c509cb1,0xa4d2a4d2,0xbdb5ad33,0xa513ad33,0xa4f29cb1,0xbd95a4f3,0x9471a4f2,0xa5139491,0xa4f3ad54,0x94719cb2,0x9cd29471,0x94919491,0x8c718c71,0x8c7194b2,0x8c518c51,0x8c518431,0x8c729492,0x84109492,0x8c5183f0,0x84108c71,0x7bcf736e,0x7bce7bcf,0x840f840f,0x83ef8c50,0xad749cb2,0x9491a513,0x840f7bef,0x840f8430,0x94919cb2,0x9cd29471,0x9c929c91,
-0xa4d29c91,0x8c0f9c91,0x7b8d7b8d,0x83ce7b6d,0x83ae8c10,0x8c0f83cf,0x7b8e736d,0x83ef83cf,0x841083ef,0x7bcf8c51,0x8c5183ef,0x8c308410,0x83cf7bcf,0x94719cb2,0x8c1083cf,0x83ef8c10,0x8c508410,0x8c309492,0x7bce7bce,0x83cf83ef,0x8c308c30,0x7bce83ef,0x7bae7bce,0x9471840f,0x7bcf7bcf,0x7bcf83ef,0x7bae83ef,0x8c508c10,0x840f8c50,0x7bae7bae,0x840f7bce,0x8c708c50,
-0x7bae8410,0x840f7bcf,0x83ef9471,0x7bae7bce,0x9cd3840f,0x7bae7bae,0x7bce7bae,0x7bce7bee,0x738d738d,0x7bce738d,0x736d73ae,0x7bce738d,0x738d736d,0x738d738d,0x7bce738d,0x7bae7bce,0x738e738e,0x738d736d,0x7bce7bae,0x7bce83ef,0x738d7bae,0x7bce738d,0x6b4d738d,0x736d6b4d,0x7bae738e,0x738d738e,0x7bcf7bcf,0x7bce7bae,0x7bce7bae,0x7bae7bce,0x83ef7bae,0x8c518c30,
-0x7bce8c50,0x738e738d,0x73ae738e,0x6b4d73ae,0x738e6b6d,0x736e73ae,0x6b6d736e,0x7bcf6b6e,0x7bf07baf,0x7bef7bcf,0x738e7bcf,0x7baf7baf,0x6b4d738e,0x6b4d632c,0x6b6e6b4d,0x6b6e736e,0x632c6b4d,0x6b4d632d,0x6b4d6b4d,0x73ae738e,0x5aeb6b4d,0x630c5aeb,0x630c632c,0x62eb5aeb,0x6b6d6b4d,0x6b4d6b2d,0x632d6b4d,0x6b4d632d,0x6b6d6b4d,0x6b6d6b6e,0x6b4d6b6d,0x630c632c,
-0x7bae8c30,0x8c30840f,0x9cd29471,0x94b1a4f3,0x8c508c30,0x8c7094b1,0xb57594b1,0x9cf2a513,0x9cb19cb1,0xa4d28c0f,0x9cd2b575,0x9cd29471,0xa4f3ad54,0x94718c50,0x94719cb2,0x8c0f736d,0x83ee7bce,0x7bad9450,0x7bae8c0f,0x94918c30,0x94509cd2,0xce389471,0x83cead54,0xad34ad34,0x94719cb1,0x9cd29cd2,0x9cb294b1,0x8c509cb2,0x840f8c50,0x9cf29cb2,0x8c2f9470,0x9cb18c50,
-0x94709470,0x9490a4f2,0xa4d29cb1,0xb553b553,0xad54b554,0xa513a4f2,0xad34a4f3,0xad13bd95,0x94919491,0xa513a4f3,0x9491a513,0x8c718c30,0x8c308c30,0x94919491,0x8c7194b2,0x94928c71,0xa5148c72,0x8c728410,0x8c517bcf,0x7bef8c51,0x7bef840f,0x7bcf7bae,0x7bae7bce,0x8c307bce,0x8c309450,0xbdd69cb2,0x840fa514,0x840f840f,0x9cd28c50,0x94718c51,0x9491a4f3,0x8c308c50,
-0x9cd29cb2,0x94919c91,0x736d83ce,0x83ee7b8d,0x8c0f8c30,0x83ef83ef,0x7bae7bae,0x83ef7bcf,0x83ef7bcf,0x84108410,0x8c3083ef,0x83ef8c51,0x841083ef,0xa514a514,0x94719cb2,0x841083ef,0x8c5083ef,0x84109491,0x83ef83ef,0x83cf83ef,0x7bae8c30,0x8c5083ef,0x83ef83ef,0x7bae7bae,0x8c309492,0x83ef7bcf,0x738e83ef,0x83ef7bce,0x8c308c30,0x7bce8c50,0x8c307bae,0x840f840f,
-0x8c508c51,0x73ae7bcf,0x840f8430,0x83ef73ae,0x84307bce,0x7bae7bce,0x738d736d,0x7bef7bce,0x738d738d,0x7bef73ae,0x73ae7bef,0x7bae738d,0x738d738d,0x738e738e,0x7bae738d,0x7bce7bae,0x7bae7bce,0x7b8e7bae,0x7bae736d,0x7bce840f,0x7bae83ce,0x7bae7bae,0x6b4c7bae,0x7b8e6b4d,0x7bae738e,0x6b4c7bae,0x7bce738e,0x7bae83ef,0x83ef83ef,0x7bae7bce,0x83ef7bae,0x8c308410,
-0x84309491,0x73ae7bcf,0x738e738e,0x6b2c6b6d,0x7bae7bcf,0x6b4d736e,0x6b4d738e,0x738e630c,0x7baf73ae,0x738e73ae,0x7baf738e,0x6b6e738e,0x738e73ae,0x738e6b6e,0x6b6d736e,0x6b2d6b2d,0x6b4d6b6d,0x6b6d632c,0x6b4d6b6d,0x6b6d738e,0x630c6b4d,0x6b6d630c,0x7bcf7bcf,0x630c6b4d,0x6b4d6b4d,0x6b4d6b2d,0x736e6b6d,0x738e73af,0x738e738e,0x736e736e,0x6b6d736d,0x6b4c6b4d,
-0x83ef7bae,0x8c308c50,0x94719cd2,0x9cd28c50,0x94919cb2,0x9cd294b1,0x94919cd2,0x94919470,0x94919cd2,0x94709cb2,0xb575a4f2,0x840f9cb2,0x9cd2a513,0x94918c30,0x83ef8c30,0x7b8d7bae,0x83ef840f,0x94709450,0x8c0f8c0f,0x8c508c0f,0x9c919471,0xb5759cd2,0x840fb575,0xa4d29cd2,0x9491ad34,0xad139450,0x94919cd2,0x9cb29471,0x94b18c50,0xa5139cb1,0x9cb1a513,0x9cb19cb1,
-0x9c919491,0x94709470,0x9cb19490,0xa4f2b554,0xa4d2a513,0xa4f2a4f2,0xa4d2ad33,0xa4f39c91,0x94719491,0x94b194b1,0x94919cd2,0x8c718c50,0x83ef8c50,0x8c508c71,0x9cf39cd3,0xa555a555,0x9cf4ad55,0x84108c31,0x84109472,0x8c718410,0x84308c50,0x8c508c30,0x840f8c30,0x8c307bae,0x8c0f840f,0x94918c50,0x84108c51,0x8c507bef,0xa4f3a534,0x94718c51,0x9cb29cd2,0x94719471,
-0x94508c30,0x94709450,0x83ce9470,0x83ce83ce,0x83ce83ee,0x83ef8c30,0x83ce7bae,0x7b8e83ef,0x8410738e,0x7bae738e,0x84108410,0x83f08c51,0x8c309471,0xad349cd3,0xa4f39cd3,0x83ef9cd2,0x7bce7bef,0x94719471,0x7bae7bcf,0x84108410,0x83ef7bae,0x8c307b8e,0x83ef8c50,0x7bae7bae,0x83f083ef,0x7bae7bae,0x7bae738d,0x7bce7bcf,0x8c30840f,0x83ef83ef,0x83ef83ef,0x83ef840f,
-0x8430840f,0x7bce83ef,0x8c308430,0x73ae7bef,0x73ae840f,0x7bce73ae,0x73ae7bae,0x6b6d738d,0x73ae7bce,0x73ae738d,0x7bce7bce,0x73ae7bce,0x736d738d,0x7bae738d,0x7bae7bae,0x83ef7bce,0x83ef840f,0x738d7b8e,0x83ef7bae,0x83ee83ef,0x8c0f840f,0x736d83ce,0x736d738d,0x7bae736d,0x738e7bae,0x736d7bae,0x7bae738e,0x83ef83ef,0x8c307bce,0x7bcf8c50,0x7bae738d,0x841083ef,
-0x840f8430,0x840f8410,0x738e7bcf,0x6b4d736d,0x7bcf8410,0x738e7bcf,0x6b4d6b6d,0x738e6b2d,0x738e738e,0x736e73ae,0x738e736e,0x738e738e,0x738e738e,0x736e6b6d,0x738e6b6e,0x73ae736e,0x6b6d6b6d,0x6b4d632d,0x6b4d6b6d,0x738e6b6d,0x6b2d6b6d,0x630c630c,0x736d6b4d,0x7bcf736e,0x6b4d73ae,0x6b4d6b4d,0x6b6e630c,0x738e7bcf,0x6b4d6b4d,0x738e6b6d,0x6b4c738e,0x6b6d632c,
-0x840f8c30,0x8c10840f,0xad549cb2,0x8c309cd2,0x9cb29cb2,0x9cf29cb1,0x9491a4f2,0x94709470,0xad539470,0x9470a4f2,0x9c919491,0x9cb2b575,0x9cb2840f,0x94719cb2,0x83ce840f,0x83ce83ce,0x8c2f7bad,0x94508c50,0x8c309cd2,0x83ef840f,0x8c5083ef,0xc5f7ad13,0x8c509491,0xad349cd2,0xa4f2a4f3,0x94708c2f,0xa513ad54,0x9cd294b1,0x840f9cd2,0xb5959cf2,0xa4f2ad54,0x9cd2a513,
-0x9cb19cb1,0x94909450,0x9c918c2f,0xad33a4f2,0xa4f29cb1,0xa4f2b595,0xa4d29cb1,0x9cb19470,0x9cb2ad54,0x8c508c50,0x94719cb2,0x8c508c50,0x8c719491,0x8c508c71,0xa5349492,0x94b3a514,0x9cf3a4f3,0x949183f0,0x8c7194b2,0x94918c71,0x8c51a513,0x9cd29491,0x8c2f8c70,0x840f7bce,0x83ef8c50,0x840f8c0f,0x83ef8c30,0xb5958c71,0x8c30a534,0x8c508c30,0x94519471,0x8c50a4f3,
-0x94709470,0x9c919491,0x8c308c50,0x83ee7bad,0x7b8e7bae,0x83ef7bae,0x83ef7bae,0x7bae7b8e,0x73ae7bce,0x6b4d738e,0x7bcf738e,0x8c517bcf,0x8c518c30,0xb5969cb3,0xad55a514,0x738d9491,0x94718410,0x94728c51,0x84108c51,0x83ef83ef,0x7bae7bcf,0x734d83cf,0x8c107bae,0x7bae736d,0x738e7baf,0x736e738e,0x7bae6b4d,0x7bae83ef,0x7bce7bef,0x7bef7bef,0x7bce7bce,0x840f7bce,
-0x7bcf8410,0x83ef7bef,0x7bef7bef,0x7bef7bcf,0x84308430,0x7bce7bcf,0x7bae7bce,0x736d6b6d,0x73ae736d,0x73ae738d,0x73ae73ae,0x7bce7bef,0x738d736d,0x738d736d,0x7bae738e,0x738e7bae,0x83ef7bae,0x7bce840f,0x83ef840f,0x840f83ee,0x83ee83ef,0x7bae7bce,0x736d7bae,0x7b8e736d,0x7bcf7bae,0x7bce7bef,0x73ae73ae,0x7bef7bce,0x7bef7bce,0x738d73ae,0x7bce738e,0x84108410,
-0x84307bce,0x7bae8410,0x738e738e,0x6b4d738e,0x947273ae,0x6b4d7bcf,0x6b2c73ae,0x6b4d73ae,0x7bae736e,0x7baf73ae,0x738e738e,0x6b6e6b4d,0x6b6e738e,0x738e6b4d,0x738e73ae,0x6b4d6b6e,0x6b6d6b4d,0x6b6d6b6e,0x6b4d6b4d,0x738e6b6d,0x738e736e,0x6b4d632c,0x738e6b4d,0x7bef738e,0x7bcf8430,0x6b4d736d,0x6b4d6b4d,0x630c6b2c,0x736e6b4d,0x7bae736e,0x6b6d73ae,0x738e738d,
-0x83cf7bce,0x94717bce,0x9cd39cd3,0x9491a4f3,0xa5139471,0x9cd2a513,0x94919cb1,0x9cb19cd2,0x9470840f,0x9c91ad33,0x94709c91,0xb5749470,0x94919cd2,0xb575a513,0x840fa4f3,0x8c2f8c0f,0x738d7bad,0x8c2f83ef,0x8c0f8c2f,0x83ef7bae,0x83ef7bce,0x9cb29491,0x8c309491,0xa4f39cf2,0x9cb1ad34,0x8c309491,0xb5959cb2,0x8c70a4f3,0xad338c50,0xc5f6bdb5,0xad54a513,0xa4f2a513,
-0x9cb19cb1,0x9c91b553,0x94908c2f,0xb574bdd5,0x9cb1ad33,0xa513a513,0x9c91ad13,0xa513ad13,0x9cd2a4f3,0x8c508c50,0x9cb29471,0x8430a534,0x94718c71,0x84309491,0x94b28c51,0x8c7194b2,0xad5494b2,0x8c719491,0x7bef8c51,0x94718430,0x9cb29471,0x94918c30,0x840f9491,0x7bce7bce,0x8c0f840f,0x94718c30,0x9cb29491,0x94919cd2,0x8c509491,0x8c308c50,0x9cb29451,0x9cb29471,
-0x94918c30,0x94918c2f,0x94709450,0x83ee8c0f,0x734d83ce,0x7bae7b8d,0x83ce83cf,0x7b8e7b8e,0x83ef83ef,0x73ae7baf,0x84107bcf,0x8c3183ef,0x9cd38c51,0xad34a4f3,0xa514ad55,0x840f9471,0x840f840f,0x8c318c51,0x8c318c51,0x83f07bcf,0x83ef8c10,0x7bcf7bae,0x841083ef,0x8c518c10,0x83f09471,0x7bcf7bcf,0x738e7bae,0x7bae7bae,0x738d7bce,0x738d738d,0x7bce73ae,0x738d73ae,
-0x7bcf7bcf,0x73ae73ae,0x7bcf840f,0x8430738e,0x7bce8410,0x7bcf7bae,0x73ae73ae,0x738d7bae,0x73ae738d,0x7bae738d,0x736d73ae,0x73ae73ae,0x7bcf7bae,0x736d736d,0x83ef7bcf,0x7bce7bae,0x83ef736d,0x83cf8c30,0x7bae7bce,0x7bce7bae,0x7bae7bce,0x83ef7bce,0x736d7bce,0x7bae734d,0x73ae73ae,0x7bef7bce,0x73ae7bce,0x73ae738d,0x83ef738d,0x7bae7bef,0x840f7bce,0x7bcf8410,
-0x84308430,0x7bce840f,0x7bcf73ae,0x6b2d73ae,0x83ef6b4d,0x83f073ae,0x6b4d7bcf,0x6b4d6b6d,0x736e6b2c,0x738e738e,0x738e736e,0x736e736e,0x738e738e,0x6b4d6b6e,0x6b6d6b4d,0x6b4d6b6e,0x6b6e6b4d,0x6b4d6b6d,0x6b6e6b6e,0x6b6d6b6d,0x7bae736e,0x6b4d6b6d,0x7baf6b4d,0x7bef7bae,0x84107bef,0x7bcf83ef,0x6b4d7baf,0x736e630c,0x738e73ae,0x736d6b4d,0x6b6d6b6d,0x7bcf73ae,
-0x7bae83cf,0x83ef83ef,0x94928410,0xad54a514,0x949194b1,0xa512b574,0x9cd29cb1,0xa4d29cb1,0x9cd29cb1,0xa5139491,0x94709450,0x94919471,0x9491ad74,0xad749cd2,0x9471a4d2,0x8c509471,0x738d7bad,0x94917bce,0x7bce8c30,0x840f8c0f,0x7bce8c30,0x94717bae,0x8c309471,0xa5138c70,0x9cb2a4f3,0x9cd29471,0x94509491,0x9471a513,0xa4f27bae,0xa4f2ad54,0xa4f2a513,0xb574b574,
-0xa4f2ad33,0xad539cb1,0xad33a4f2,0xb594ad33,0xa4d29cb1,0xad13a4f2,0x9cb2a513,0xad139491,0x8c509c91,0x94919cb2,0x8c50842f,0xad549cd2,0x949194b2,0x8c518c71,0x8c718c71,0x94928c71,0x94919cb2,0x8c309491,0x840f840f,0x840f840f,0xa4f3b575,0xad339cd2,0x94709cd2,0x8c2f9470,0x83ee8c0f,0x94918c30,0xa5339cb2,0x9cd2e73c,0x9491840f,0x8c308c50,0x9cb29491,0x94719471,
-0x83ef9491,0x94719491,0x9cb19470,0x8c509c91,0x738d7bce,0x738d7bae,0x83ef83cf,0x7b8e83cf,0x83ef7bae,0x7bef7bce,0x841083f0,0x7bcf7bcf,0x94728410,0xad34a4f3,0xa513ad34,0x8c309492,0x84108430,0x7bcf83ef,0x83ef8410,0x8c308c30,0x7bcf7baf,0x8c308c30,0x83ef83ef,0x94718c10,0x83ef8c51,0x7bae7bae,0x7bae7bce,0x840f7bcf,0x738e8410,0x738d6b6d,0x7bef73ae,0x7bcf7bef,
-0x7bcf7bcf,0x7bcf7bae,0x7bef8410,0x840f73ae,0x73ae7bef,0x7bce73ae,0x738e738e,0x73ae73ae,0x73ae738d,0x7bae73ae,0x736d73ae,0x73ae738d,0x7bae83ef,0x7bce738d,0x83ef7bae,0x7bae83ef,0x738d736d,0x7bce7bce,0x738d7bae,0x7bae738d,0x7bce83ee,0x7b8d7bae,0x7bce7bae,0x738d7bce,0x73ae7bce,0x73ae73ae,0x73ae73ae,0x7bce73ae,0x7bce7bce,0x84307bcf,0x8c518c51,0x84308c51,
-0x8c509cd2,0x8410840f,0x7baf7bef,0x738e73ae,0x738e6b6d,0x84106b4d,0x7bcf8c31,0x6b4d6b6d,0x6b6d6b4d,0x738e736d,0x738e6b6d,0x73ae738e,0x738e738e,0x6b6e6b6e,0x6b4d6b6d,0x6b6d6b6d,0x6b6d6b4d,0x6b4d6b6d,0x738e738e,0x6b6d6b6d,0x6b6d6b4d,0x6b4d6b2c,0x738e6b4d,0x8c317bae,0x7bcf8410,0x7bcf7bcf,0x632c736e,0x738e6b4d,0x6b6d6b4d,0x6b4c6b6d,0x6b4c630c,0x73ae73ae,
-0x8c0f8c2f,0x840f9471,0x84107bae,0xad349492,0x9cd2ad54,0xa5139cb2,0xa4f2a513,0x9cb19cb2,0x9cd2ad53,0x9cb19470,0x9cb1a513,0x94708c50,0xa5138c50,0xa4f29cd2,0x9c91a4d2,0x8c509471,0x7bce83ce,0x738d7bae,0x94509470,0x9450840f,0x8c308c30,0x9471840f,0x8c509471,0x94919471,0x9471a4f3,0x8c509491,0x9cd28c30,0xb575a513,0x8c509cf2,0x94919491,0xa4f29490,0xad33a4f2,
-0xb574b574,0xa4f2a4d2,0xb574ad33,0xad33a4f2,0x9c91a4f2,0xad33a4f2,0x9cd2ad33,0x94719491,0x94b19471,0x8c509491,0x7bce840f,0xa5139471,0x94919cf3,0x8c308c30,0x8c518c71,0x8c718c51,0x8c71840f,0xa4f3b5b6,0x8c719491,0xbdd68c50,0x9491deda,0xad749cd2,0x9cf294b1,0x8c50a513,0xa4d29450,0x9c91b554,0x9471a4f3,0x94b2bdf7,0x8c718430,0x8c508c51,0x94719491,0x8c309491,
-0x9cb28c50,0x8c509450,0x94919471,0x9cb29471,0x83ef83ef,0x7b8e7bce,0x83ef7b8e,0x7bcf83ef,0x7bce7bae,0x7bcf73ae,0x7bef8410,0x738e7bcf,0x7bcf83f0,0x94928410,0xa5149471,0x7bae9cb2,0x84308410,0x7bef7bcf,0x83ef8410,0x7bcf8410,0x7bae738e,0x83f08410,0x83ef83cf,0x7bae7bae,0x84108c30,0x7bae7bce,0x840f7bef,0x840f840f,0x7bef8430,0x7bae7bcf,0x7bef73ae,0x8410840f,
-0x7bcf8410,0x84108410,0x84107bef,0x7bae83ef,0x840f7bef,0x840f840f,0x840f8430,0x7bef7bcf,0x73ae738d,0x73ae73ae,0x73ae73ae,0x73ae7bae,0x7bce7bae,0x7bce738d,0x83ef83ef,0x7bcf7bcf,0x7bce7bce,0x7bce83cf,0x7bce7bce,0x83ee83ee,0x7bad7bce,0x7bce7bae,0x7bae7bae,0x7bcf83cf,0x7bce73ae,0x7bce7bee,0x73ce7bce,0x738d73ae,0x73ae73ae,0x84307bce,0x8c518c71,0x7bef8430,
-0x8c518430,0x7bef8c30,0x7bcf7bcf,0x6b6d73ae,0x73ae736e,0x73ae738e,0x6b6d83ef,0x73ae6b4d,0x738e7bce,0x83ef7baf,0x738e7bcf,0x73ae738e,0x6b4d6b6d,0x6b4d632d,0x6b4d6b6d,0x6b4d6b4d,0x6b6d6b4d,0x6b6d6b6d,0x738e738e,0x738e738e,0x6b4d6b4d,0x6b4d630c,0x736d736d,0x7bcf6b6d,0x6b6d7bcf,0x73ae6b6d,0x6b6d736e,0x6b4d736d,0x6b4c6b6d,0x632c6b4c,0x738d630c,0x7bef83ef,
-0x8c509470,0x94918c30,0x7bcf8c30,0xa5149491,0xb595bdb6,0xa4f29cb2,0xb574ad54,0x9c91a4d2,0x94909cd2,0x94908c50,0xa5129cb1,0x8c2f8c2f,0x8c2f8c30,0x9cb1a513,0xa4f2a4f3,0x8c2f9471,0x83ce83ce,0x7bad8c2f,0x94718c0f,0x94709471,0x8c508c2f,0x94709470,0x9cb28c50,0xa4f2ad34,0x94519471,0x840f840f,0x94718c30,0xad34a513,0xc617ce58,0x9470a4f2,0x9cb19cd2,0xa4f29cd1,
-0xbdb5a513,0x9cd2b595,0xb5749490,0x9cb1ad33,0xa4f2ad13,0xc5f6a4d2,0x9c91b595,0x9cb29c91,0x94719492,0x7bce83ef,0x94718c50,0x8c308c50,0x9cd29cb2,0x8c509491,0x8c718c50,0x84308c71,0x840f8c50,0xad75b5b6,0x94919491,0xb5b59cb2,0x949194b1,0x9cb18c50,0x94919cd2,0x8c509c91,0xbdd6a4d2,0x8c309cd2,0x83ef9cd2,0x8c708c50,0x84308c71,0x94919cb2,0x84108c50,0x94918c30,
-0x9c918c50,0x840f9cb2,0x8c309471,0x94719450,0x840f8c50,0x7b8e7bce,0x7bae736d,0x83ef83ef,0x7bce840f,0x7bae73ae,0x7bef8430,0x7bcf8410,0x7bcf73ae,0x7bcf7bcf,0x841073ae,0x84108410,0x7bcf7bef,0x7bcf7bcf,0x84317bcf,0x6b6e73ae,0x7bef7bcf,0x7bcf738e,0x738e83ef,0x736d7bae,0x841083ef,0x7bcf83ef,0x7bef7bef,0x7bcf7bcf,0x7bcf73ae,0x7bef8410,0x7bcf73ae,0x84108410,
-0x7baf8c30,0x83f083ef,0x83f073ae,0x7bef8c30,0x7bcf738e,0x7bcf7bcf,0x84308430,0x73ae7bef,0x7bae7bae,0x7bae7bae,0x7bce7bae,0x7bce7bce,0x7bef7bce,0x840f7bce,0x7bef840f,0x7bae7bae,0x83ef7bce,0x7bae83ef,0x7bce738d,0x7bce7bee,0x736d736c,0x83ee7bce,0x7bce7bce,0x7bce7bee,0x7bcf73ae,0x7bef7bef,0x7bee7bce,0x7bef7bef,0x7bef840f,0x94b28430,0x8c5194b2,0x7bcf8410,
-0x7bae738d,0x840f7bce,0x7bcf8430,0x6b6d6b4d,0x6b4d6b6d,0x6b4d6b4d,0x630c6b6d,0x7bce6b6d,0x736d738d,0x83ef7bae,0x736d7bef,0x632c6b4c,0x6b6d6b2d,0x6b4d6b6d,0x6b6d6b4d,0x630c6b6d,0x6b6d6b4d,0x738e738e,0x6b6d6b6d,0x738e73ae,0x6b6d6b4d,0x738d6b4c,0x7bcf7bcf,0x6b4c6b6d,0x6b6d6b4d,0x6b6d6b6d,0x6b6d738d,0x738e6b6d,0x632c73ae,0x6b6d632c,0x8c507bcf,0x8c508c71,
-0x8c2f9cb1,0x945083cf,0x9c929c92,0xad349cd3,0xad54a514,0x9470ad34,0xad338c0f,0x8c50a4f3,0x9cd19470,0x94709cd1,0x94709c90,0x8c2fa513,0x8c2f8c2f,0xbdd68c50,0x9491a4d2,0xad33ad13,0x83ce8c50,0x9470840f,0x83ef83ee,0x9c919cb1,0x8c309c91,0x94718c30,0x94708c30,0xa4d2a4f3,0x7bae8c0f,0x9cb2840f,0x840f9471,0xa4f39491,0xf75cbdd6,0xa512c617,0x9cb19cb1,0xad339cd1,
-0xa513a513,0xb595c5f6,0x9cb1b574,0xbdb5ad33,0xa512c5f6,0xa4d29cb1,0x9cb2c5f6,0x9cb29cb2,0x83ef9492,0x840f840f,0x94918c30,0x8c308c30,0x9cb28c50,0x9cb2a4f3,0x8c518c51,0x8c719491,0x8c509491,0x94b29491,0x8c508c50,0x8c50842f,0x8c509471,0x9cd29cd2,0x9cb19cb2,0xce58a513,0x8c309c91,0x8c308c50,0xa513a4f3,0x8c50842f,0x8c719491,0x9cb28c51,0x840f8c50,0x9cd2840f,
-0x8c0f9cb2,0x9cb29c91,0x8c508c30,0x94508c30,0x840f8c50,0x736d7bae,0x7bae738e,0x840f8c10,0x83ef8c30,0x7bef83ef,0x84108c50,0x83f08430,0x7bcf7bef,0x738e738e,0x7bcf7bf0,0x7baf73ae,0x7bcf7bcf,0x84307bcf,0x94b38c51,0x73af8431,0x84107bcf,0x7bae7bcf,0x7bae7bcf,0x738e7bae,0x738e736d,0x73ae73ae,0x73ae7bae,0x83ef7bce,0x7bcf7bef,0x84308410,0x7bcf7bef,0x8c517bef,
-0x7baf8410,0x7bcf7baf,0x83ef7bef,0x8c518410,0x7bcf840f,0x73ae7bce,0x8c507bef,0x7bcf8c51,0x738e7bcf,0x7bae738d,0x7bce7bce,0x840f7bce,0x7bef8430,0x8c507bef,0x7bef840f,0x6b6d7bcf,0x7bcf7bcf,0x7bce7bce,0x7bae7bce,0x7bce7bad,0x7bae73ad,0x73ad7bae,0x83ef7bae,0x7bce840f,0x7bef840f,0x7bef7bef,0x73ce7bce,0x84307bef,0x7bef840f,0x94b28430,0x7bef8c71,0x7bef7bef,
-0x7bce736d,0x7bae73ae,0x83f08410,0x6b2d736e,0x6b6d7bcf,0x7bcf736d,0x630c6b6d,0x738d6b6d,0x736d736d,0x7bcf7bae,0x7bcf840f,0x736d73ae,0x738e736d,0x630c6b4d,0x632c630c,0x738e6b6d,0x6b6d6b4d,0x73ae73ae,0x6b6d6b6d,0x6b6d738e,0x6b6d6b6d,0x738e6b4d,0x73ae7bce,0x738d6b6d,0x6b4d6b4d,0x6b6d736e,0x6b4d6b4c,0x73ae738e,0x6b4c6b4d,0x738d6b6d,0x94717bef,0x84108c71,
-0x8c2f9470,0x83ef8c0f,0xad149c92,0x94929cb2,0xa4f2a4f3,0x9cd1a513,0x9470840f,0xa4f2ad34,0xad339490,0x9cd1ad33,0x94909c91,0xad339491,0x8c4f8c70,0xa4f28c50,0xad54c617,0xbdb6b554,0x840fa4f3,0x7bee83ee,0x8c30842f,0x9cd27bee,0x9491a513,0x8c509cd2,0x83ee8c50,0x7bae9470,0x6b0b7bae,0x8c307b8d,0x8c308c0f,0x9cd29491,0xbdd6ad33,0xbdd6e71a,0x8c509cb1,0xa4d29cb1,
-0xa533ad33,0xce58b574,0x9cb1c5f6,0xe6fa9470,0xad13d678,0x94709cb1,0x94919471,0x9cb294b1,0x94718c30,0x8c308c50,0x7bee7bce,0x8c508c30,0x8c50840f,0x9cd29cb2,0x8c509471,0x9cb29cb2,0x94b28c71,0xa5349cd2,0x83ef7bef,0x9cb29491,0x94919cb2,0xad349cb2,0xad34a4f3,0xa513d658,0x8c0f8c30,0x8c508c50,0xb5749cd2,0x8430840f,0x9cb28c71,0x94718430,0x9cb29491,0x9cd29cd2,
-0x94719491,0x94919471,0x840f9cb2,0x94718c50,0x840f8410,0x738e7bce,0x7bcf7bae,0x83ef8c10,0x840f83ef,0x8c508c50,0x84308430,0x7bcf8410,0x7baf7bd0,0x7baf7bcf,0x7baf7bf0,0x738e7baf,0x7bcf738e,0x9cd38410,0x9cd3a514,0x841094b3,0x7baf7bef,0x7baf83f0,0x84107bae,0x738e7bae,0x738d738d,0x7bae738d,0x7bcf7bcf,0x840f7bcf,0x84108c51,0x8c518430,0x73af8410,0x841073af,
-0x83ef8410,0x7baf7baf,0x7bcf83f0,0x8c307bae,0x84108c31,0x7bae7bef,0x840f73ae,0x7bef8c30,0x738e83ef,0x7bae7bae,0x7bae7bae,0x840f7bce,0x83ef7bef,0x840f7bce,0x7bef8430,0x738e738e,0x738e738e,0x7bcf738d,0x73ad7bce,0x7bad736c,0x7bce83ee,0x7bae7bad,0x7bae7bae,0x8c5083ef,0x84308430,0x84308430,0x73ae7c0f,0x738d738d,0x841073ae,0x84308c51,0x84107bef,0x7bcf8431,
-0x73ae7bcf,0x7bae73ae,0x738e7bae,0x6b2c6b6d,0x7bef83f0,0x8c518410,0x632c83ef,0x6b4d6b4d,0x6b4c6b4c,0x736d6b4d,0x7bce7bce,0x73ae7bce,0x7bce73ae,0x7bce73ae,0x738e73ae,0x738e738e,0x6b6d6b6d,0x738d6b6d,0x6b6d738e,0x738d6b6d,0x738e7bce,0x738d736d,0x632c738d,0x73ae632c,0x6b4d738e,0x7baf738e,0x6b6d6b6d,0x6b4d738e,0x6b6d6b4c,0x632c738d,0x7bef6b4d,0x840f8410,
-0x947083ce,0x83ef8c30,0x94928c31,0x8c519492,0x83ef9cb2,0xa5139cb2,0x9c91b554,0xad548c30,0x9cd1a4f2,0x9cb1ad33,0x9c919470,0x8c508c50,0x840f9491,0x94719470,0xd658ad34,0xbdb5b595,0x94b1a513,0x94919cd2,0x94709491,0x94719491,0xad34b575,0x9cb1a4f2,0x94708c2f,0x8c2f9491,0x734c7bae,0x94507b8d,0x94509471,0xa4f29cb2,0xb574ad34,0xce17b595,0x83eea4f2,0xa4d29491,
-0xad549491,0xb574ad34,0xb574c5f6,0xb5749450,0xb574ce37,0x94709470,0x94719491,0x8c508c50,0x8c308c30,0x7bce840f,0x840f7bce,0x9cb27bee,0x8c308c30,0x94919471,0x94918c50,0x9cd2a513,0x94b2a513,0x9cf38c50,0x94b28c50,0x94719491,0x8c519471,0x9cb28c51,0xc5f7ce38,0x8c308c50,0x8c4f9470,0x94708c30,0xce789471,0x8c508c30,0x94718c50,0x840f9471,0xb5b59491,0xa4f3b575,
-0x94919471,0x8c509c92,0x8c308c30,0x8c30840f,0x8c30842f,0x8c3083ef,0x7bcf7bcf,0x7bae7bae,0x842f7bce,0x8c508c70,0x8c5083ef,0x7bcf83ef,0x83f083f0,0x6b6e738f,0x7bef736e,0x73ae7bcf,0x6b4d736d,0x8c518410,0x8c519492,0x84108430,0x738e73af,0x841083f0,0x736d738e,0x7bcf7bce,0x73ae7bae,0x7bef7bae,0x84308c30,0x73ae83ef,0x7bef7baf,0x7bef8430,0x7bcf7bcf,0x738e73af,
-0x8c318c71,0x738e7bcf,0x73ae7baf,0x83ef738e,0x84307bcf,0x7bef8430,0x7bae7bce,0x7bef7bae,0x7bcf83ef,0x738e7bce,0x7bae738d,0x7bcf7bae,0x840f8c30,0x84307bef,0x6b6d7bae,0x630c6b4d,0x83ef6b4d,0x83ef83ef,0x7bae7bae,0x7bce738d,0x7bad738d,0x7bae73ad,0x840f83ef,0x840f840f,0x840f83ef,0x840f840f,0x7bce83ef,0x6b6d73ae,0x84107bcf,0x84308c51,0x7bef7bef,0x738e8410,
-0x7bef738e,0x7bcf8c30,0x736d6b4d,0x630c738e,0x7bef738e,0x84108410,0x73ae9cd3,0x738e738e,0x6b2c6b4c,0x6b4c6b2c,0x73ae7bce,0x6b6d6b6d,0x83ef83ef,0x6b4d73ae,0x6b6d6b4d,0x6b6d738e,0x738e6b6d,0x6b4c6b4c,0x738e73ae,0x73ae6b6d,0x73ae7bcf,0x6b4d6b6d,0x6b4c736d,0x736d6b4c,0x738e7bef,0x6b6d6b4d,0x6b4c6b4d,0x6b4c6b4d,0x6b4c6b6d,0x6b6d6b6d,0x73ae736d,0x84107bae,
-0x7bae738d,0x83ef8c30,0x94928410,0x94b3a4f4,0x9cd39492,0xa4f39cd3,0xb554b575,0xa4f2a4f2,0x9cd1a4f2,0x840e9490,0x94909470,0x8c2f83ee,0xa4f29491,0x94709471,0xa5139cb1,0xb595c5f7,0xa51394b1,0x9cf29cd2,0x8c509491,0x94919cb1,0xa5139cb1,0xa5129cd1,0x9450a4d2,0x94709c91,0x9c928bef,0x83ef9430,0x840f83ee,0x8c508c70,0xa5139491,0xad34b595,0x9cd3b595,0xad149cd2,
-0x9491a513,0xad349cb2,0x9cb2ad34,0x94709cd2,0xd6789491,0x9470b574,0x94518c30,0x94719471,0x83ef8c30,0x840f83ef,0x7bce83ee,0x83ef7bae,0x94718c30,0x840f9451,0x947183cf,0xb575b575,0xad75a514,0x9cf38c71,0x94919491,0x94719cb2,0x94918430,0xc618b596,0x8c50a534,0x8c50840f,0x94b194b1,0x8c509491,0xb5b69491,0x8c30b595,0x94918410,0xa4d29cf2,0xbdd69cd2,0xb574ce17,
-0x9c91ad14,0x7bce9471,0x8c507bae,0x8c2f9cb2,0x8c30840f,0x8c508c30,0x7bce8c30,0x7bae7bae,0x842f83ef,0x9cd2840f,0x83ef8c30,0x84107bcf,0x738e9451,0x738e734d,0x6b4d738e,0x7bcf7baf,0x736e83f0,0x7bcf6b6e,0x73af7bd0,0x738e738e,0x738e7bcf,0x7bcf83ef,0x7bae83f0,0x83ef738d,0x7bae7bce,0x738d7bce,0x8c30840f,0x736d7bce,0x73ae738e,0x7bef7bcf,0x73ae738e,0x73af6b6e,
-0x7bcf8410,0x84108430,0x738e7bcf,0x73ae7bcf,0x736e73ae,0x8c718410,0x738d738e,0x843083ef,0x7bce7bef,0x7bce73ae,0x736d7bcf,0x7bef7bcf,0x7bef7bce,0x6b4d736d,0x736d6b4d,0x630c630c,0x734d6b2c,0x736d6b4d,0x83ef83ef,0x736d7bae,0x738d736d,0x7bae7b8e,0x7bce7bae,0x7bce83ef,0x83ee7bee,0x7bce83ee,0x7bee7bae,0x73ae7bce,0x7bae7bce,0x7bae738e,0x7bce840f,0x738d73ae,
-0x738e736d,0x83ef83ef,0x6b2d7b8e,0x6b4d6b2d,0x6b2d6b2d,0x6b6d6b2d,0x736d8430,0x738e738e,0x630c6b4d,0x6b6d6b6d,0x7bef73ae,0x6b2c738e,0x84308410,0x6b4d738d,0x6b6d6b4d,0x73ae6b6d,0x738e738e,0x6b2c6b4d,0x6b6d6b6d,0x73ae6b6d,0x6b6d6b6d,0x6b4d6b2d,0x6b6d6b6d,0x630c6b6d,0x73ae632c,0x6b4d632c,0x632c73ae,0x6b4d6b4d,0x6b6d6b4d,0x6b4d6b6d,0x736d6b2c,0x7bae7bae,
-0x738d738d,0x8c71840f,0x94728430,0x94b29cf3,0x9cd3a4f4,0x9cb29471,0xa513ad13,0xad33ad33,0xb594ad53,0x8c4f9cd1,0x94709490,0x840f8c50,0x94919490,0x9471ad54,0xad34a4f2,0xbdd6ad34,0xa513ad54,0x9cd2ad74,0x94919471,0x8c509471,0x8c2f9491,0x94709cd2,0x9cb1a513,0x9cb19cb1,0x94308c30,0xbd95a4d2,0x9470b574,0x94919470,0x9cd29491,0xa534a534,0xce38a534,0x9492ad55,
-0xa4f3a4f3,0x9cb29471,0x94719471,0xa4f3a513,0xbdd69491,0x9491ce58,0x94719471,0x94719c92,0x840f9450,0x7bce840f,0x83ef83ef,0x840f840f,0x949183ef,0x7bce9451,0x949183ef,0xad34a4f3,0x94929491,0x94b28c71,0x94719491,0x94b28c71,0xad758c51,0x9492c639,0x8c508c51,0x843094b2,0x8c709491,0x8c718c71,0x8c309491,0x9cd29cd3,0x94719cd2,0x9cd29c91,0xa513a4f2,0xc5f6bdb5,
-0x94509c91,0x94708c50,0x8c0f8c0f,0x9cf2a4f2,0x840f8c2f,0x94718c30,0x8c309471,0x840f8c30,0x94708c50,0x9cd29470,0x8c108c50,0x8c1083ef,0x7bae8c10,0x7bae736d,0x738e83cf,0x947183ef,0x738f83f0,0x738e7bcf,0x7bd0738e,0x73af73af,0x6b4d736e,0x736d6b4d,0x840f738d,0x738e7bae,0x738d840f,0x738d736d,0x83ef7bae,0x7bae83ef,0x7bcf83ef,0x7baf7bcf,0x7bcf738e,0x7bcf73ae,
-0x7bef7bef,0x7bef7bcf,0x7bcf738e,0x84107bef,0x8c307bef,0x7bce7bef,0x7bef7bef,0x843073ae,0x7bef8430,0x7bce73ae,0x7bef8410,0x83ef840f,0x738d738d,0x736d6b6d,0x6b4d738e,0x738e6b2d,0x630c6b4d,0x6b4d62eb,0x738e738e,0x7bae7b8e,0x7bce7bce,0x7bae7bce,0x736d738d,0x7b8d7bae,0x83ee7bae,0x840f840f,0x7bce7bce,0x7bce7bce,0x7bce83ef,0x7bae738e,0x6b6d7bcf,0x736d6b6d,
-0x738e7bae,0x83ef7baf,0x7baf8410,0x6b4d736e,0x6b2d6b4d,0x6b6d6b4d,0x6b4d7bcf,0x6b2c6b4c,0x6b2c6b6d,0x738d6b6d,0x840f736d,0x6b6d7bcf,0x7bae83ef,0x7bcf7bae,0x6b4d738e,0x7bae73ae,0x738e73ae,0x738e736e,0x6b4d736e,0x7bce738d,0x7bce6b6d,0x738e7baf,0x6b4d6b6d,0x630c6b4d,0x73ae632c,0x738e6b6d,0x6b6e73ae,0x73af738e,0x738e736e,0x6b2c6b6d,0x7bae736d,0x83ef7bcf,
-0x7bce840f,0x84308430,0x94929cd3,0xa5149492,0x9cf3a514,0x94929492,0xad54b575,0xad339cd1,0xad53ad53,0xad53bdb5,0x9cb19491,0x94709cb1,0x94919470,0xb554a4d2,0x94719cd2,0x9cf2a4f3,0xb595ce58,0xad549cf2,0x9491a4f2,0x9cd2a4f3,0x8c2fa4f2,0xad3383ee,0xb574ad13,0x9c91a4d2,0x7b8d9430,0xad348c0f,0x9c91c5f7,0x9cd2842f,0x94918c50,0xb5b69cd2,0xa4f3ad55,0xb575bdd7,
-0x9cd29cd2,0x8c109cd2,0x8c508c30,0x9cd29491,0x8c509cb1,0xa513b595,0x8c309471,0x94719451,0x840f8c30,0x83ce8c2f,0x83ce83ef,0x94718c30,0x8c307bce,0x94719cb2,0x94718c30,0x9cb29492,0x8c518c30,0x9cd294b2,0x9cf3a534,0x94919cd2,0xad55c5f7,0x8c518c72,0x94918c51,0x94b18c50,0x8c508430,0x9cd28c50,0x8c509cd2,0x9cd38c50,0x9471a4f3,0x94918c50,0x9cd2a4d2,0x9cb1a4d2,
-0x94509471,0x9cd29c91,0x9cb2a4f3,0xa5338c50,0x83ef9cb2,0x840f738d,0x94508c50,0x9cb29491,0x8c308c2f,0x94918c70,0x8c518c50,0x94728c51,0x7bcf8c30,0x738e6b4d,0x83ef8c30,0x84107bcf,0x7bcf7bcf,0x7baf83f0,0x83f073ae,0x7baf7bcf,0x736e738e,0x6b4d6b4d,0x83ef736d,0x630c7bae,0x83ef736d,0x736d736d,0x83ef83ef,0x83ef83cf,0x7bcf7bcf,0x7bcf7bcf,0x7bf07bcf,0x7bcf73ae,
-0x84108c71,0x7bcf7bcf,0x841083f0,0xa5148c71,0x6b4d8410,0x7bcf6b4d,0x84108c30,0x738d7bcf,0x8430840f,0x7bce8410,0x6b6d6b6d,0x6b4c6b6d,0x73ae6b4c,0x738e7bcf,0x6b4d736e,0x7baf736e,0x736d7b8e,0x62cb630c,0x736d630c,0x7bae83cf,0x7bae7bcf,0x7b8e7b8e,0x6b2c736d,0x7bae738d,0x83ce83ce,0x83ef7bce,0x7bcf7bcf,0x738d7bae,0x7bae7bae,0x736d738e,0x738e73ae,0x7bce7bae,
-0x7bae7bae,0x7bcf7bae,0x7bae8410,0x6b2d734d,0x736e6b4d,0x73ae738e,0x632c73ae,0x630c6b2c,0x73ae73ae,0x73ae73ae,0x83ef6b4d,0x6b6d73ae,0x6b6d6b4d,0x6b6d738d,0x736d738e,0x7bcf7bcf,0x738e7bcf,0x736d738e,0x738e6b4d,0x7baf7bcf,0x7bcf73ae,0x73ae7baf,0x738e738e,0x6b4d738e,0x6b6d632c,0x73ae6b4d,0x6b6d738e,0x73ae6b6d,0x7baf7bcf,0x632c6b4d,0x840f7bce,0x7bae7bcf,
-0x7bef9491,0x9492840f,0x9cd39492,0x9cf394b2,0xa5149492,0xa4f39cb2,0x8c309cd2,0x9cd19cb1,0xb594ad33,0xa4f2ad33,0x9cb19cd1,0xa5139cd2,0x94719cb1,0xbdd6a4f3,0x9450bdb6,0x9cb29471,0xce58ad54,0xad34a513,0x94b1ad54,0xa533a513,0x9450b575,0x8c2f9cd1,0xa4d2b554,0xad33a4f2,0x7b8d9471,0x83ef736c,0xad13ad34,0x8c509471,0x9471a513,0xa5349cd2,0x8c309491,0xd6799cb2,
-0x9cb2b595,0x8c509cb2,0x8c308c50,0x94918c30,0x9cb1bd95,0xb5749cb2,0xa4f3a4f3,0x8c0f9c72,0x83ce83ef,0x83ce7bce,0x8c5083ef,0x8c308c30,0x8c308c30,0x94919491,0x94519471,0x8c308c30,0x843094b2,0x9cd37bef,0xa534bdf7,0xad55b596,0x8c519cf4,0x8c518c31,0x8c508410,0x8c718c71,0x8c508c50,0x8c508c50,0xad5494b2,0x94929492,0x9cb29471,0x94519491,0xa4d28c50,0x9c91a4d2,
-0x94709cb1,0xa5139470,0x9491a4f2,0x8c708c50,0x8c309cd2,0x840f7bae,0x94918c30,0x94719491,0x9cb29cd2,0x94719cd2,0x8c518c30,0x8c518c31,0x84108c51,0x7bcf7bcf,0x83f08c30,0x7bce7bae,0x7bcf738e,0x7bef7bcf,0x7bcf7bcf,0x7bcf83f0,0x7bcf7bcf,0x7bcf7bcf,0x7bcf83ef,0x736d7bce,0x83ef736d,0x7bae7bce,0x7b8e736d,0x7bae7bae,0x7bce7bce,0x7bcf7bcf,0x73af7bcf,0x738e6b4d,
-0x7bef73ae,0x7bef8430,0x8c518c31,0x8c518c71,0x6b6d8410,0x736d630c,0x84308430,0x83ef8430,0x8410840f,0x736d7bef,0x6b4d632c,0x632c632c,0x738e632c,0x6b4d7bcf,0x632c632c,0x632c6b4d,0x6b2c62ec,0x630c630c,0x6b4d6b0c,0x734d736d,0x734d6b4d,0x7bae736d,0x736d7bae,0x7bce7bae,0x840f83ef,0x83ef83ef,0x7bae7bae,0x7bae7bae,0x7bce7bcf,0x6b6d73ae,0x7bae73ae,0x73ae7bce,
-0x83ef7bce,0x7bae83ef,0x7bae7bcf,0x6b4d736e,0x738e6b4d,0x73ae6b6d,0x5aeb6b4d,0x6b4d6b6d,0x738e6b6d,0x73ae738e,0x83ef738e,0x738e73ae,0x73ae632c,0x6b6d7bae,0x736e6b6d,0x73ae7bae,0x73ae738e,0x736d73ae,0x7bcf6b6d,0x736e7bef,0x738e7bcf,0x6b4d6b4d,0x6b6d736d,0x736e736d,0x6b4d6b6d,0x738e6b4d,0x73ae73ae,0x73ae738e,0x7bcf73ae,0x73ae73ae,0x7bcf7bef,0x7bcf73ae,
-0x83ef8430,0x8c718c50,0x9cd39cb2,0x9472ad55,0xad5494b2,0x9cd29cd3,0x9450a4d2,0xb5959cb1,0xb574ad53,0xa512b574,0x9cb19cd2,0xa5139cb1,0xa4d2a4f3,0xb595a513,0xce58b595,0x9cd2ad34,0x9cd2a513,0xa4f3c617,0xad33a533,0xbdd69491,0x9cb1a513,0xa4f38c50,0xbdb59c91,0xbd95b575,0x9450a4d2,0x8c0f9450,0xa4f38c30,0x8c309cd2,0x94928c71,0x9cd39492,0x94919cd2,0xad149471,
-0xa513d699,0x9c929471,0x83ef8c50,0x9cd2a4f3,0xa4d29491,0x94709491,0xa5139cb2,0x7bce9cb2,0x7bae7b8d,0x83ce7bce,0x8c5083ef,0x84108c30,0x94719492,0x8c518c30,0x9cb29cd3,0x84108c30,0x94928410,0x8c518c31,0xa534ad34,0xa514c5f8,0x7bf08c31,0x8c518c51,0x9cb29492,0x94719cf3,0x8c709471,0x7bce9491,0xa5348c71,0x94719cf3,0x94928410,0x8c519491,0x8c50840f,0xa4f39c91,
-0x9cb19cb2,0x94918c50,0x94709491,0x94b18c50,0x9cf29491,0x8c509cb2,0x9471840f,0x94719cb2,0x9cb29cb2,0x8c509cb2,0x94718c50,0x8c519471,0x84108c51,0x83ef83ef,0x841083ef,0x7bae83ef,0x7bcf73af,0x7bcf738e,0x7bcf7bef,0x7bcf7bef,0x7bcf7bcf,0x7bce73ae,0x738d8410,0x738d738d,0x7bae7bae,0x83cf7bce,0x83ef7bae,0x83ef7bce,0x738e7bae,0x738e738e,0x738e73af,0x738e6b4d,
-0x73ae738e,0x73ae73ae,0x7bcf6b4d,0x84108410,0x841083ef,0x6b4d7bae,0x84307bef,0x83ef8c51,0x6b4d7bae,0x632c630c,0x630b5aeb,0x6b6d630b,0x6b6d738d,0x6b2c6b4d,0x6b2c6b6d,0x630c632c,0x6b2c5aaa,0x6b2d6b2d,0x630c6b2d,0x6b2c630c,0x6b0c62eb,0x734d6b2c,0x734d734d,0x7b8e7b8e,0x840f7bce,0x7bce7bce,0x7bcf7bae,0x7bce7bcf,0x738e7bae,0x7bce73ae,0x7bef840f,0x83ef7bef,
-0x8c0f840f,0x7bce83ef,0x7bae83ef,0x7bae738e,0x6b4d734d,0x738e6b4d,0x630c6b2d,0x73ae736d,0x6b6d632c,0x6b6d6b6d,0x7bcf83ef,0x7bce738e,0x738e6b4d,0x840f7bef,0x6b6d6b6d,0x6b4d738e,0x73ae736d,0x736d73ae,0x738e6b6d,0x7bae7bae,0x738e7bae,0x6b4d6b6d,0x632c632c,0x73ae6b4d,0x738d73ae,0x6b4d738e,0x7bcf738e,0x738e7bcf,0x6b6e7bcf,0x73ae6b4d,0x7bcf7bef,0x738e73ae,
-0x8c50840f,0x8c719cf3,0xbdf79492,0xa534b596,0x8c5194b2,0x9cf2a4f3,0xa513a4d2,0xa5139491,0xad53b595,0xb574c617,0xa4f29491,0xad34a513,0xa4f2a4f2,0x9471a4f3,0xdebaa4f3,0xa4f3d679,0xa513a4f3,0xb5b5a533,0xb574a4f3,0xbdd6b595,0x94719cd2,0x9cb2a4d2,0x9c91a513,0xd658d658,0xa512bdb5,0x8c309c91,0x8c307bce,0x9cb29471,0x84309491,0x94928c51,0xa4f3a4f3,0xa4f39cb2,
-0xbdd6ad54,0x9cb29cd2,0x94718c30,0xa5139471,0x94919470,0x8c509491,0x8c30840f,0x84108c10,0x7bae83ef,0x83ce83ef,0x7bce83ef,0x9cb28c30,0x8c519471,0x8c518c30,0xa4f39cb2,0x8c309cb2,0x8c518c71,0x94b28c31,0x9cf3ad55,0x84109cb2,0x84107bf0,0x8c318410,0x94928c30,0x94b28c71,0x94b19491,0x94919491,0x94b29491,0x94719cd2,0x8c519471,0x94919491,0x8c309491,0xa4d29471,
-0x9c91ad34,0x9cb29cd2,0x9cb29470,0xa4f29cd2,0xa5139cb1,0x9471a513,0x8c308c50,0xa4d39cd2,0x94919471,0x840f9471,0x8c308410,0x83ef8410,0x84108c51,0x8c308c30,0x8c3083ef,0x83ef8c30,0x738e7bae,0x7bcf73af,0x8c318410,0x7bcf7bef,0x8c318410,0x7bce73ae,0x7bef840f,0x7bae738e,0x7bce7bce,0x7bae7bae,0x9c928c30,0x94718c50,0x738e83ef,0x738e738e,0x7bcf7bcf,0x7bcf738e,
-0x6b6e7bcf,0x7bcf738e,0x738e736e,0x83ef7bcf,0x7bcf83ef,0x8c5183f0,0x7bcf8410,0x630c7bcf,0x6b4c736d,0x6b4d632c,0x6b4c6b4c,0x738e6b4d,0x6b6d73ae,0x6b6d6b4d,0x6b4d738e,0x6b4d6b4d,0x6b4d630c,0x62ec6b0c,0x6b2d6b2c,0x6b2c6b2d,0x6b2c6b0c,0x630c6b0c,0x630c62eb,0x6b4d6b4d,0x7bce7bae,0x736d6b4d,0x7bae738e,0x736d738e,0x7bae7bae,0x7bcf7bcf,0x7bce840f,0x7bce7bae,
-0x83ce83ef,0x7bce83cf,0x736d7bcf,0x738e736d,0x6b2d738e,0x738e738e,0x738e738e,0x6b6d632c,0x6b6d6b6d,0x6b4d6b6d,0x73ae8c30,0x73ae736d,0x73ae6b6d,0x7bce73ae,0x738e736e,0x632c736d,0x73ae6b6d,0x6b4d738e,0x7baf6b6d,0x73ae7bcf,0x738e738e,0x6b4d738e,0x6b2d632c,0x738e6b6d,0x6b6d73ae,0x6b6d738e,0x7bef7bcf,0x8c718c51,0x738e7bef,0x7bcf738e,0x73ae7bcf,0x73ae73ae,
-0x94918c30,0x9cd29cf3,0xb5b69cf3,0xa534ce79,0xa4f38c51,0xad34a514,0xa4d2ad34,0x94919cb1,0xad54a4f2,0xb595b574,0xb574bd95,0xa4d2ad34,0x9cf29cd2,0x94919491,0xad549cb2,0xc5f7ad55,0xa513ad54,0xad549cd2,0xad33ce37,0xbdd6b574,0xa4f3a4f3,0xa4d29491,0xad13ad13,0xbd959cb1,0xb574c617,0x83ef9470,0x84108c30,0x94928410,0x9492ad55,0x9cb28c30,0x9cb29cb2,0xad349450,
-0x94719491,0x9cb2b595,0x8c108c10,0x94509c91,0x8c50a4f3,0x949183ee,0x94719471,0x94718c10,0x7bcf9491,0x7bae7bae,0x83ef83ef,0x94928c30,0x84109492,0x84108c51,0x94717bcf,0x94929cd3,0x8c518c51,0xa5349492,0x84109cd3,0x8c5173af,0x7bcf8410,0x84307bcf,0x8c508c51,0x8c50840f,0x9cd29cb2,0x9cf39471,0x94919cb2,0x94b29491,0x8c509492,0x8c508c30,0x8c309471,0x9cb29471,
-0xad33a4f2,0x9cb29cd2,0x9cb19cd2,0x94919cd2,0x9cb19491,0x9cb29cb2,0x8c709cd2,0x9cb29471,0x94928c51,0x84108c51,0x84108410,0x7bcf83f0,0x94718410,0xa4f4a514,0x84108410,0x94718c30,0x7bcf83f0,0x84107bae,0x94929492,0x7bcf8410,0x84107bef,0x73ae7bae,0x840f7bce,0x7bce7bce,0x7bce840f,0x7bce83ef,0x8c307b8e,0x8c509cb2,0x7bcf8c30,0x7bae7bef,0x7bcf7bef,0x73ae73ae,
-0x73ae73af,0x6b6e7bcf,0x7bcf73af,0x7bcf8410,0x84108c51,0x8c517bcf,0x736e8c51,0x6b2d6b2c,0x6b6d6b4d,0x6b4d6b2c,0x7baf738e,0x6b6d7bcf,0x6b4d6b4d,0x6b2c6b2c,0x6b4d632c,0x630c6b4d,0x5acb630c,0x62ec5aaa,0x6b4d6b2c,0x630c6b4d,0x6b4d630c,0x6b4d6b4d,0x6b2c6b2c,0x6b4d6b4d,0x7bae738e,0x736d6b4d,0x6b2c736d,0x6b4d6b2c,0x6b4d736d,0x6b2c6b4d,0x7bce738d,0x7bef7bce,
-0x7bae7bce,0x7bce7bce,0x738e7bce,0x738e738e,0x6b4d738e,0x73af73af,0x738e73ae,0x632c632c,0x6b4c736d,0x736d6b4d,0x7bae8c50,0x738e738e,0x7bcf7bae,0x6b4d736d,0x7bae738e,0x736d736e,0x736d632c,0x736e73ae,0x8410738e,0x738e8410,0x6b4d6b4d,0x630c6b4d,0x6b4d630c,0x6b6d6b4d,0x73ae7bef,0x738e6b6d,0x6b4d738e,0x7bef738e,0x6b6d73af,0x6b4d632c,0x736e738e,0x632c6b2d,
-0x8c508c30,0x949194b2,0xb5b6a514,0xa513ad55,0xad759cb2,0xa513ad54,0xad34a4f3,0xa512b595,0xa4f29cb1,0xb574ad33,0xbdb5bdb6,0xad33ad54,0x9cd2ad34,0xad349491,0x8c30a514,0xad54a4f3,0x9cd2d699,0x9cd2a513,0xd698b574,0xb574a512,0xa4f2b554,0x9cb29cd2,0xa4f2a513,0x9cb2ad33,0xb595a4f2,0x9471b595,0x83ef8c30,0x84308430,0xa5149cd3,0x8c51a4f3,0x8c309cb2,0x9cd29c91,
-0x8c309cd2,0xad148c50,0x8c30840f,0x94718c0f,0xa5139cb1,0x8c0f8c30,0x9cd2a4f3,0x83cf8410,0x8c308c50,0x7bce83ef,0x8c307bce,0x8c308c30,0x94719cd3,0x83f09492,0x8c517baf,0x94b38c71,0x9cb38c52,0x9cb39492,0x84308431,0x73af73ae,0x7bcf7bef,0x7bef7bf0,0x8c717bcf,0x842f9471,0x94918c71,0x9cd29cd2,0x9492a513,0x94718c71,0x8c719cd2,0x8c51840f,0x9cd29491,0x94719491,
-0xa4f29491,0x9491ad13,0x9cd29491,0x8c309491,0x9cd28c50,0x9cb29471,0x9cb29cb2,0x8c308c30,0xa4f39cb2,0x8c309471,0x83f083f0,0x7bae83ef,0x94927bcf,0xb576b576,0x84109471,0x94718410,0x84109471,0x8430738e,0x94719cd3,0x7bcf8c30,0x7bef73ae,0x7bcf8430,0x7bce7bef,0x7bce7bee,0x83ef7bae,0x840f8c30,0x7b8e7bce,0x94718c50,0x7bce83ef,0x738e7bef,0x7bcf73ae,0x7bcf7bcf,
-0x7bcf7bcf,0x738e738e,0x84107baf,0x83ef83f0,0x9cb28c51,0x7bcf8410,0x6b2d738e,0x738e6b4d,0x73ae736d,0x6b4d736e,0x6b6d736d,0x7baf7bcf,0x6b4d736d,0x632c630c,0x7bae6b4d,0x630c736d,0x6b4d6b4d,0x630c6b4d,0x736d5acb,0x62eb7bae,0x6b2d630c,0x6b2d6b4d,0x6b2c630c,0x7bcf738e,0x7bcf83ef,0x738e6b2c,0x736d7bae,0x736d6b4d,0x6b4d83ef,0x630c630c,0x73ae738d,0x8c307bce,
-0x83ef83ef,0x83ce83ef,0x94718c30,0x7bae8c30,0x7bcf7bae,0x73af73ae,0x6b4d738e,0x738e7baf,0x6b2c738e,0x738e6b4d,0x7bae8c30,0x6b4d738e,0x6b4d738d,0x736d6b4d,0x6b4d738e,0x84107baf,0x6b4d6b6d,0x736d738e,0x7bef6b4d,0x8c318c72,0x6b4d738e,0x632c6b4d,0x6b4d632c,0x738e6b4d,0x7bcf73ae,0x6b6d738d,0x6b6d6b4d,0x6b6d6b6d,0x738e6b6d,0x6b6e6b6e,0x736e73ae,0x6b2d632d,
-0x94919491,0x9491ad54,0x9cf38430,0x94b294b2,0xad54a514,0xb575bdd6,0xa5139cb1,0xad54ad54,0xbdb5a4f2,0xb554b595,0xbdb5b554,0xad54ad34,0x9cb2a513,0x9cd2a513,0xa4f39cb2,0xa4f39471,0xbdb5ad34,0xa513b595,0xad54a513,0xad33f77c,0xbdb5bdb6,0x94719c91,0xb554a4f2,0xb574a4d2,0xa5139490,0xa533a513,0x8c509471,0x84309472,0x9cd38410,0x9471a514,0x94718c10,0xa4f39450,
-0x9c91ad14,0x8c0f8c30,0x9cb2a4d3,0x94919471,0x840f9491,0x8c309471,0xa4f38c30,0x8c5183ef,0x94519471,0x8c508c30,0x8c508410,0x9cb29491,0x9cd39471,0x8c719cb3,0x94929492,0x94728c51,0xad35ad55,0x9cf38c72,0x7bf09492,0x738e7bcf,0x8c3183f0,0x83ef8410,0x840f83f0,0x94719491,0x8c509491,0xad34a4f3,0x94929491,0x94919cf3,0x94b294b2,0x8c509cb2,0x94919471,0x9cb29cb2,
-0x9cb29471,0xa533a513,0x9491a4f2,0x94918c70,0x8c509491,0xa4f39471,0xad34ad74,0x8c309cb2,0xad558c71,0x7bef9492,0x84108c51,0x84107bcf,0x8c718410,0xad559cf3,0x84309cd3,0x7bcf83ef,0x94728c51,0x7baf8410,0x8c308410,0x8c518410,0x73ae83ef,0x7bef840f,0x7bef73ae,0x7bce7bce,0x83ef83ce,0x840f8c0f,0x7bce840f,0x8c30840f,0x7bcf9471,0x7bce7bef,0x7bef73ae,0x7bef7bf0,
-0x6b6d7bf0,0x7bcf738e,0x8c5173ae,0x84108c51,0x9cb283f0,0x6b4d83ef,0x6b4d630c,0x630c6b2c,0x738e738e,0x736e6b4d,0x73ae73ae,0x738e736d,0x632c6b4d,0x6b4d736e,0x738e632c,0x6b4d738e,0x6b4d6b2c,0x62eb6b2c,0x6b4d5acb,0x6b2d6b2c,0x5acb62eb,0x630c62eb,0x62ec630c,0x738e6b2d,0x6b4d738e,0x738e6b4d,0x6b2c7bae,0x736e6b2d,0x736e7bcf,0x7bcf738e,0x738e7bae,0x840f7bcf,
-0x947183ef,0x947183ef,0x9cd29cd3,0x83ef9491,0x83f08410,0x738e83ef,0x73ae6b4d,0x6b6d738e,0x6b4d6b4d,0x8410630c,0x738ea514,0x736d7bae,0x6b4d6b4d,0x738d736d,0x736d736e,0x736d6b4d,0x632c632c,0x6b2c6b2c,0x6b6e6b4d,0x7bcf738e,0x6b6d7bcf,0x84307bcf,0x6b4d73ae,0x6b4d6b4d,0x73ae73ae,0x6b4c738d,0x6b4d632c,0x6b6d6b6e,0x73ae6b4d,0x7bef7bcf,0x632d738e,0x73af632d,
-0x9cd28c50,0x9491ad54,0x8c718430,0x9cf39cd2,0xad75b595,0xad54a513,0xa513b595,0xc5f6a4f2,0xa513b574,0x9cb1a4d2,0xad54bdb5,0xad54bdd6,0xad34ad54,0x9cd3a514,0xad34a513,0x94719cd3,0xa513ad54,0xad53c5f6,0x9cd29cd2,0xc5f6d699,0xad34a513,0xad54ad33,0xa4d2a4f2,0xa4f3ad13,0x94b1b574,0xb5759491,0x9491ad34,0x8c3183f0,0x73ae83f0,0x9cd29471,0x8c509491,0x94709471,
-0xa4d283ef,0x83ef9c91,0xb5759471,0x9c91ad54,0x8c509491,0x9c918c2f,0x94919491,0x94719cd3,0x8c508c30,0x9cd29cd2,0x8c518c30,0x94719492,0x94718c51,0x84309492,0x9cb38410,0xa4f49cf4,0x94b39472,0x94729cd3,0x8c518410,0x8c518c71,0x94928c51,0x94719472,0x8c308c51,0x8c518c51,0x94919cd2,0xad549cb2,0x9491a534,0xa5139491,0x8c5194b2,0x9cd29cb2,0x94719491,0x9cd29cb2,
-0x9cb19cb2,0xa5139cb2,0xa513ad34,0x8c7094b1,0x8c708c70,0x9cd28c70,0xa4f3a513,0x94929cd3,0x8c719471,0x94929472,0x7bef8c30,0x7baf7bcf,0x8c518410,0x8c718c51,0x8c319492,0x7bef7bef,0x84307bef,0x83ef8430,0x7bef7bcf,0x83ef83ef,0x7bcf7bef,0x7bce7bce,0x83ef840f,0x7bee7bce,0x83ce83ef,0x83ef83ef,0x840f8c10,0x7bce83ef,0x8c308c30,0x7bcf83ef,0x7bef7bcf,0x7bcf8410,
-0x73ae8430,0x8c518410,0x9cd37bef,0x8c309471,0x8c518c51,0x738e7bcf,0x6b4d6b4d,0x7bae738e,0x6b2d738e,0x73ae6b6d,0x6b4d6b4d,0x738e736e,0x6b4d6b4d,0x738e738e,0x736d6b4d,0x6b4d738e,0x738e6b2c,0x630c736d,0x630c630c,0x630c62eb,0x630c630c,0x630c630c,0x62ec62eb,0x738e6b2d,0x6b2c632c,0x6b6d6b6d,0x6b2c736d,0x630c630c,0x736d6b4d,0x7bae738e,0x736d7bce,0x7bce736d,
-0x8c307bce,0x840f8c50,0x94919491,0x7bce9471,0x7baf83ef,0x738e6b4d,0x6b4d738e,0x6b4d738e,0x736d6b4d,0x9471738e,0x736d9492,0x7bae7bae,0x736d7bae,0x738e6b4d,0x83ef7bcf,0x7bcf7baf,0x6b4d7bcf,0x6b2d6b2d,0x6b4d632d,0x6b6d736e,0x84107baf,0x84107bcf,0x6b4d8410,0x736d6b4d,0x632c6b4d,0x738e6b6d,0x632c632c,0x73ae738e,0x632c632d,0x7bcf738e,0x6b6d73ae,0x6b4d6b6e,
-0x94918c50,0x8c71b575,0x9491840f,0xad759cf3,0xa4f3b575,0xad34a4f3,0xb595b595,0xbdb5a4f2,0xa513ad34,0x9cd29cd2,0xbdb69491,0xbd95b595,0x9cd2a514,0xa4f3a4f3,0xad75ad34,0xa513b596,0xad339c91,0xde99a513,0xbdd6ad13,0xa513ad33,0x9450c5f7,0xc5d6ad34,0x9cb1b574,0xad13a4f2,0x9cd2a4f2,0xa4f39491,0x9cf3a513,0x8c519cb2,0x83f07bcf,0x8c307bcf,0xa4f3ad34,0x83ce8c50,
-0xad139451,0x83cfb575,0xad348c0f,0xb575c617,0x8c2f9cd2,0x8c308c30,0x9491ad34,0xa4d38c10,0x9471a4d3,0x94719471,0x94929492,0x83ef9471,0x8c5183f0,0x94928c51,0x94729492,0x9492a514,0x84108c31,0x94729cd3,0x949283f0,0xa4f4a514,0x84108c51,0x9cd38c31,0x8c308c51,0x840f9471,0x9cd3a4f3,0xa4f39cb2,0xa4f3ad34,0xa4f39cb2,0x8c309491,0x9cd29491,0x9cb29cd2,0x9cb29cb2,
-0x9cb2a4f3,0x9cb29491,0xad34a513,0x8c509cd2,0x94918c71,0x94918c50,0x94719491,0x9cd39cd3,0x84309cf3,0x8c518410,0x8c518c51,0x84108410,0x8c718c51,0x8c519492,0x84308430,0x8c518430,0x84108410,0x84108410,0x7bcf7bcf,0x841083f0,0x7bcf8410,0x83ef7bce,0x7bef83ef,0x7bce840f,0x83ef83ef,0x83ef83ef,0x8c50840f,0x7bce8c10,0x8c3083ef,0x840f840f,0x7bcf8410,0x84107bf0,
-0x73ae7bcf,0x73ae73ae,0xad3583ef,0x94718c30,0x9c929471,0x6b2d83f0,0x736d736d,0x6b2d734d,0x736e630c,0x632c738e,0x6b2c632c,0x738e6b4d,0x6b2c6b4d,0x6b6d632c,0x73ae738e,0x7baf7bcf,0x736e6b4d,0x6b4d738e,0x630c630c,0x6b4d6b4d,0x6b4d6b4d,0x630c632d,0x630c62ec,0x6b4d6b2d,0x6b4d630c,0x736d736e,0x6b4d6b6d,0x6b2c62ec,0x738e7bcf,0x736d6b4d,0x736d738e,0x83ef736d,
-0x83ef83ef,0x738d9491,0x83ef7bcf,0x84108c30,0x7bcf8410,0x7bae73ae,0x7baf7baf,0x738e738e,0x738e6b6d,0x8c71736d,0x73ae7bef,0x73ae7bae,0x6b6d738d,0x73ae6b6d,0x84108410,0x738e73ae,0x738e7bce,0x7bcf7bcf,0x738e73af,0x738e738e,0x8410738e,0x7bcf8c51,0x7bcf7bcf,0x7bcf738d,0x6b6d738e,0x738e6b6d,0x841073ae,0x738e8410,0x738e73ae,0x738e73ae,0x738e73ae,0x73ae73ae,
-0xa4f39491,0x8c50a534,0x8c50840f,0x9cd29cd2,0xa51394b2,0xa5139cd2,0xb574a513,0x9cd2bdb5,0xa4d2ad13,0x9cd29cd2,0x9cd29cd2,0xb575b554,0xad54b595,0x9cd39cb2,0xad759cf3,0xad55ad54,0x8c2fa513,0xb575ad34,0xdeb9d678,0x9cb2b554,0xbd95ad54,0xc5f69470,0xad33d658,0x9c919c91,0x94919cb1,0x83ef94b1,0xa5138c71,0x8c719cb2,0x8c508c30,0x7bce7bcf,0x9cb2840f,0x8c0f9491,
-0xad34ad34,0x83efa4d2,0xa4d38c10,0xc5f7c5d6,0x9cb1a4f3,0x8c0f8c50,0xa4f3840f,0x8c309471,0x8c50bdb6,0x8c508c30,0x9cd29491,0x83ef9491,0x947183f0,0xad55a4f3,0xa514ad75,0x84319492,0x8c519492,0x8c518410,0x9cf39492,0x8c71a4f4,0x83f083f0,0x8c517bcf,0x94719cb2,0x8c30840f,0x9cb29471,0x8c519cb2,0xa4f39471,0x9491a513,0x8c509491,0x8c508c50,0x9cd29cd2,0x94919491,
-0x9cd29cf2,0x947194b1,0xa4f394b1,0x94b19cf3,0x94b294b1,0x8c508c71,0x8c508c50,0xa4f39cd2,0x8c719cb3,0x7bef8410,0x9cd38c71,0x8c518c71,0x84318c71,0x84318c72,0x84107bef,0x7bef83f0,0x84108430,0x8c5183f0,0x8c3194b2,0x84307bcf,0x7bef8410,0x84108410,0x7bef7bcf,0x83ef8430,0x840f83ef,0x83ef83ef,0x8c3083ef,0x8c308c30,0x7bce7bce,0x840f8410,0x7bef7bef,0x84107bcf,
-0x738e7bcf,0x84107bcf,0xbdd78c30,0x8c519cb2,0x947183cf,0x736d8c51,0x7bae7bae,0x8c3083ef,0x73ae83f0,0x73ae7bcf,0x6b2d6b4d,0x736e738e,0x738e7bae,0x6b6d6b4d,0x736d738e,0x736d738e,0x738e6b4d,0x62ec6b4d,0x5aeb630c,0x738e6b4d,0x6b6d738e,0x630c632c,0x6b4d632d,0x6b2d6b4d,0x6b2d6b6d,0x736d6b4d,0x6b2d6b6d,0x736d62eb,0x736d7bcf,0x6b4d6b2c,0x8410738e,0x8c108c51,
-0x7bae8410,0x9471a514,0x736d6b4c,0x8c5183ef,0x7bae8c30,0x738e7bae,0x7bef7baf,0x6b4d738e,0x738e6b6d,0xa5137bef,0x7bae738e,0x840f8430,0x73ae7bce,0x738e738e,0x84107bef,0x738e7bae,0x83ef738e,0x84108430,0x738e83f0,0x7bcf6b4d,0x7bcf8410,0x7bcf738e,0x83f08430,0x7bcf7bcf,0x7bcf738e,0x630c6b6d,0x7bcf738e,0x632d738e,0x7bcf73af,0x632d6b6e,0x6b6e632c,0x7bcf6b6d,
-0x9491842f,0x843094b1,0x9491840f,0x9cb29cf3,0x94919cb2,0xa5138c50,0xa4f2b554,0xb594a4f2,0xa4f2ad33,0x9cd29cb1,0x94709cd2,0xad549cd2,0xc5f7ad54,0x94b2a513,0x9cd2a514,0xce38b575,0xc5d7ce38,0xad34a4f3,0xff9da4f3,0x9cb2ad34,0xbdb5a4f2,0xa4d2b575,0xbdd6bd95,0x9cd2ad13,0xa5139cd2,0x94b19491,0x9cb29471,0x9cf39cd2,0x840f9492,0x7bce7bef,0x842f6b6c,0x94719cb1,
-0x9c918c30,0x8c108c30,0xa4f3ad13,0xad54b575,0x9491bdd6,0x8c309491,0x8c508c30,0x94719471,0xad349471,0x8c509491,0x94719471,0x9471ad55,0x8c518c51,0x8c519492,0x9cd38c72,0x8c729492,0xa5149cd3,0x84308410,0xad75a4f3,0x83f09cb3,0x8c318410,0x8c518c31,0x94719cb2,0x8c308c50,0x8c5083ef,0x94719cb2,0x94928c30,0x9cd2a4f3,0x94919491,0x840f9471,0x94718c50,0x9cb29471,
-0xa4f39cb2,0x9cb2a4f3,0x94b19491,0x9cf39cd2,0x94b19cb2,0x8c509491,0x8c718430,0x9cb29471,0x8c719492,0x84309492,0x94b28410,0x94929cd3,0x8c718c51,0x8c518c72,0x8c528c72,0x84318410,0x8c319492,0x84317bf0,0x8c319472,0x8c518410,0x8c518c31,0x83ef8c51,0x840f7bef,0x7bef7bce,0x7bce83ce,0x8c3083ef,0x83ce83ef,0x9471840f,0x840f8c30,0x840f8c50,0x84307bef,0x84108430,
-0x73ae7bef,0x7bcf7bcf,0xa5347bef,0x83ef9cb2,0x9471738e,0x7baea4f3,0x738e6b2c,0x94719451,0x6b6e83f0,0x736e736e,0x6b4d6b6d,0x736d73ae,0x73ae6b6d,0x738e738e,0x6b6d738e,0x73ae738e,0x736d73ae,0x6b4d6b6d,0x5aeb62ec,0x6b4d736d,0x6b4d738e,0x6b2d632c,0x6b6e6b4d,0x6b4d6b6d,0x632c6b6d,0x6b4d630c,0x630c6b2c,0x6b4d62eb,0x738e736d,0x6b4d736e,0x9471738e,0x84109cb2,
-0x83ef83ef,0xad14a4f4,0x83ef7bcf,0x8c51738e,0x8c319cb2,0x7bef7bae,0x7bef8410,0x6b6d7bcf,0x6b6d6b6d,0xad75840f,0x7bef73ae,0x7bef9491,0x7bcf7bcf,0x73ae7bce,0x8c5183f0,0x7bcf8410,0x83ef83ef,0x738e7baf,0x73af73af,0x8c517baf,0x83f07bf0,0x73ae738e,0x7bef83f0,0x7bef7bcf,0x73ae738e,0x632c6b4d,0x6b4d6b4d,0x73ae6b4d,0x6b6d6b6e,0x6b6e6b6d,0x6b6d632c,0x6b6d738e,
-0x94918c70,0x94b1a513,0xa4f38c50,0x9cf39cf3,0x94919491,0x9cb2a4f3,0xb595a513,0xb595a4f2,0xad33bdb5,0x9cb1a4f2,0x9c919cb2,0xa5339471,0xad54ad54,0xa513b5b6,0xa514a534,0xdedbb596,0xe6fbd699,0x9cb2ce18,0xef3cce38,0xbd96ce38,0x9470a4d2,0xc617ad33,0xad54b554,0xad13b575,0x9470a4f2,0x9cb2a4f3,0x8c30a4f3,0x9cf39491,0x8c309cd2,0x73ae7bef,0x7bce7bce,0x9470840f,
-0x736d8c30,0x8c10a4d2,0xb575ad14,0xa513a513,0xb575b574,0x94919cb1,0x8c509cb2,0x94918c30,0x9cb29471,0x8c509cd2,0x9cb29471,0x9cd39cb2,0x8c519492,0x8c518c31,0x94928c31,0x94929cf4,0x94928c51,0x8c308c51,0x9cf38c50,0x84109471,0x8c518c31,0x9492a4d3,0x8c518410,0x8c509cd3,0x8c508c10,0x9cb29491,0x94719491,0xa5149cb2,0x94b1a4f3,0x94719cb2,0x94518c50,0xa5139cd2,
-0x9cd29cd2,0xa513a4f3,0x94919cd2,0x9cd294b1,0x94b29cd2,0x8c509cd2,0x8c718430,0x8c518c30,0x9cd394b2,0x84309cd3,0x8c517bcf,0x9cf39cf3,0x8c718c51,0x8c518c72,0x8c728c52,0x8c518c51,0x84108410,0x8c728c51,0x8c318c51,0x8c318c51,0x84108c51,0x83f08c51,0x8c3183f0,0x7bcf7bef,0x83ef7bae,0x8c0f840f,0x7bce83ef,0x8c3083ef,0x8c309471,0x8430840f,0x8c518430,0x84109492,
-0x7bcf73ae,0x73ae7bcf,0x9cf39cd3,0x736d840f,0x83cf7bcf,0x8c108c30,0x7b8e83cf,0x8c5083ef,0x738e738e,0x6b2d6b4d,0x83f073af,0x83ef8410,0x84107bef,0x73ae7bef,0x738e738e,0x7bae73ae,0x7bcf73ae,0x736d738e,0x6b4d738e,0x6b6d6b4d,0x6b4d6b4d,0x6b4d6b4d,0x6b4d6b6d,0x6b4d6b4d,0x6b4d6b4d,0x6b4d6b4d,0x6b4d6b2c,0x6b4d736d,0x738e62ec,0x7bae7baf,0x8c3083cf,0x8c308c30,
-0x8c318410,0x9cb28c51,0x94718410,0x9cd383f0,0x9cb2a4f3,0x84108c51,0x7baf7bcf,0x736d73ae,0x6b6d738e,0x8c51738e,0x84107bce,0x6b6d840f,0x738e6b6d,0x7bce7bcf,0x84107bcf,0x7bcf8410,0x738d73ae,0x84107bcf,0x84108410,0x841083f0,0x7bcf7baf,0x6b4d7bcf,0x8c51738e,0x73ae8430,0x6b6d7bcf,0x6b6d6b4d,0x6b4d6b6d,0x7bf073ae,0x6b4d6b4d,0x6b6d6b6e,0x6b6d6b6d,0x73ae73ae,
-0x8c708c50,0x9cd29cd2,0x8c708c71,0x94919cd2,0x9cd28c50,0xa5139cd2,0xad34a4f3,0xad34b574,0xbd95c5f6,0x9cd29cb1,0x94919cd2,0x9cb29491,0xc617bdf6,0xbdd69cd2,0xa534b596,0xbdb6ad75,0xd679d699,0xb575ce17,0xc5f7deba,0xc5f7a4f3,0x8c30b554,0xc5d68c2f,0xa4d2ce38,0xb554a4f3,0xa4f3b575,0xb5759471,0x9491a513,0x94918c70,0x94919cd2,0x73ae842f,0x736d7bae,0x8c507bce,
-0x9450ad34,0x8c3083ef,0xad13a4d2,0xad34b575,0x9cb2a4f2,0x9cb2ad54,0x9cb29cd2,0x8c518410,0x9471ad54,0x9cb29451,0x94519c92,0xa4d38c51,0x9472ad55,0x94719492,0x94928c51,0x94929492,0x84108c31,0x94719472,0x8c5183ef,0x8c718c51,0x94928c31,0x94929cb3,0x94519451,0x9cb29471,0x9c919471,0x94719471,0x94719491,0x9c919471,0x9cb2a4f3,0x9cb29cd2,0x94919cb2,0xad54a4f3,
-0x9cd2a513,0x9cd29cb2,0x94b29cd2,0x94919491,0x9cf39cd2,0x94b2a513,0x8c718c51,0x8c508c30,0x9cd38c71,0x8c7194b2,0x8c719492,0x94928c71,0x94929cf3,0x8c318c51,0x94728431,0x84109493,0x84108410,0x8c318c51,0x8c518410,0x94729492,0x7baf8431,0x84107bf0,0x8c518410,0x840f8c51,0x83ef738d,0x83ef8c30,0x83ce7bce,0x83ef83ef,0x840f8c30,0x840f7bce,0x84108410,0x84108431,
-0x7bce8410,0x7bef7bcf,0xa4f3bdd6,0x6b4d83ef,0x83ef8c30,0x94718c10,0x94719492,0x7bae7bcf,0x738e83f0,0x7baf738e,0x7bcf738e,0x84108410,0x83f08410,0x738e7bcf,0x7bcf738e,0x7bcf7bcf,0x738d7bce,0x738d738e,0x736d6b4d,0x6b2d736d,0x6b6d6b4d,0x6b6d6b6d,0x6b6d6b6e,0x630c6b4d,0x6b6d6b4d,0x6b6d736d,0x736d6b4d,0x7bcf83f0,0x736e630c,0x8c5183ef,0x8c309471,0x94518410,
-0x83f08c30,0x94728c10,0x8c518410,0xad55a514,0xa4f3a514,0x8c30a4f4,0x73ae738e,0x738e736e,0x73ae738e,0x73ae8430,0x7bcf7bae,0x73ae738e,0x736d6b6d,0x738e7bae,0x73ae6b4d,0x84308410,0x738e83ef,0x7bef7bcf,0x7baf7baf,0x7bcf7bcf,0x738f738e,0x73af738e,0x738e736e,0x7bef8410,0x6b6e73ae,0x6b4d6b6d,0x630c630c,0x6b6d6b4d,0x6b6e6b6e,0x632c6b4d,0x6b4d6b6d,0x840f738e,
-0x842f94b1,0xa513ad54,0x949194b2,0x94b294b1,0x94b29471,0xad3494b1,0x9cb2a4f2,0xad54ad33,0xbd95a513,0x9491b595,0x94918c30,0x94719cb2,0xc617ad54,0xa513a513,0xad54ce38,0xbdb6ad34,0xce38d699,0xd679ce38,0x9471d679,0x9cb28c30,0xad34c5f7,0xa4d28c30,0xce17bdb6,0xad349cd2,0xad54b575,0xa4f3ad34,0x9491a4f3,0x8c509cd2,0x9cf39491,0x840f840f,0x83ef8c30,0x8c307bce,
-0x9471a4d2,0x83ef8c10,0x9cb2ad34,0xb554a4f3,0x8c2f9471,0xa5139c91,0x9cd29cb2,0x8c50840f,0xde9a9c92,0x8c0fad13,0x9cb29cd2,0xa4d38c51,0xb575b575,0x94729cd2,0x8c518c71,0x8c518c71,0x8c719472,0x84308c51,0x8c318c51,0x841083ef,0x9492a4d3,0xa4f49492,0x94929cd3,0x9cd39451,0xa4f3a4f3,0x94719cb2,0x94718c50,0x8c509491,0x9cd29491,0x9c91a4f3,0x94919cd2,0xad149491,
-0xa4f3ad55,0x8c519491,0x9cd29491,0x8c5094b2,0x9cd28c71,0x94b29cf3,0x8c308c51,0x8c508c50,0x94927bef,0x8c718c71,0x8c519cd3,0x84307bf0,0xa5149cd3,0x84109472,0x84318410,0x84318c52,0x8c518410,0x84318c31,0x94728c72,0x8c528c72,0x8c319472,0x83f07bf0,0x7bef8410,0x7bcf7bcf,0x7bce7bce,0x83ef840f,0x7bae83ce,0x8c3083ef,0x8430840f,0x7bef8c50,0x84107bef,0x84307bf0,
-0x8c50840f,0x84108430,0xa514e6fb,0x738e6b2c,0x7bae8410,0xa4d38c30,0x8c519451,0x738e83cf,0x83f0738e,0x736e7bcf,0x7baf6b6d,0x84107bcf,0x736d738e,0x73ae7bae,0x7bcf73ae,0x7bcf7bcf,0x73ae7bef,0x6b2c6b6d,0x6b6d630c,0x6b2d6b2d,0x6b6d6b4d,0x6b6d6b6d,0x73ae738e,0x630c736e,0x632c6b6d,0x6b6d6b2c,0x632c6b4d,0x8c718430,0x84108c30,0x94518c31,0x8c518c51,0x8c519451,
-0x8c3183f0,0x8c5183f0,0x9cd3b575,0xad55a514,0xa4f3a514,0x8c519492,0x736d7bcf,0x73ae73ae,0x73ae7bcf,0x8410a534,0x7bae738d,0x7bcf7bcf,0x738d7bce,0x7bae7bae,0x7bcf738e,0x8c518c30,0x7bae83ef,0x7bae73ae,0x7baf7bcf,0x73af738e,0x73af7bcf,0x736e738e,0x736e738e,0x7bcf6b4d,0x7bcf7bef,0x6b4d6b6d,0x6b6d6b6e,0x6b4d632d,0x738e8410,0x738e6b4d,0x73ae6b6d,0x7bef7bce,
-0x9cd29cd2,0x8c718430,0xa5139491,0x83ef9cd2,0x9cb29471,0x94919cb2,0x9cd29cd2,0x9cb19470,0xa4f3b575,0xa4f2a4f3,0x8c308c2f,0x94709cb1,0xa4d2a4d2,0xa4f3a513,0xbdd6ad34,0xad13a513,0xc5d6c5f7,0xd658ce17,0x9491ef5c,0x8c508c30,0xc5f78c30,0x9491ad13,0xc5f7ad33,0xa4f2c5f6,0xce37b575,0xa513c5f6,0x94709cd2,0xb5759471,0x840f8c30,0x8c518c51,0x8c1083ef,0x8c108410,
-0x94718c50,0x8c509491,0x9cb29c91,0xad549c91,0x9c91ad34,0x94719450,0x8c509c91,0x840f9c91,0xbdb6ad54,0x9450ce38,0xad348c50,0xa4f3ad34,0xb575b575,0x9cb2b575,0x9cd28c71,0x8c5194b2,0x94b29471,0x84308c31,0x8c318c51,0x7bcf8430,0xad359cd3,0x9cd39cf4,0xa4f49492,0x94729cb3,0xa514a514,0x9471a4f4,0x9471840f,0x9cd2a4f3,0x94919c91,0xad33ad13,0x9cd29cb2,0x9cd2a4d2,
-0x9cd2a4f3,0x94919471,0x8c509492,0x8c719471,0x8c518c30,0x94929cd3,0x8c518c71,0x8c508c51,0x7bf07bef,0x94728410,0x94929cd3,0x84309472,0x94938431,0x8c319492,0x8c518c31,0x8c729472,0x84318c72,0x84318c51,0x8c729cd3,0x8c528c72,0x94929472,0x84108411,0x83ef8410,0x7bce8410,0x840f83ef,0x8410840f,0x83ef840f,0x840f83ef,0x7bef7bef,0x84308c51,0x84307bef,0x84107bef,
-0x84108c71,0x94b37bef,0xad55ffff,0x7baf6b4d,0x7bcf7baf,0x9cd37bcf,0x736e7bcf,0x73af738e,0x738e6b6e,0x73ae7bae,0x738e6b4d,0x73ae7bcf,0x7bcf6b6d,0x73af738e,0x8410738e,0x7bcf8410,0x738e73af,0x738e6b6d,0x6b6e73ae,0x6b4d6b6e,0x6b6e630c,0x6b2c738e,0x736d630c,0x6b4d73ae,0x736d632c,0x6b6d738e,0x6b4c736d,0x8c517bae,0x94718c30,0x9cb29cb2,0x8c509471,0x8410840f,
-0x94928c51,0x840f9471,0xbdd6c617,0xad759cd3,0xa534ad55,0x8c309cd3,0x7bcf83ef,0x7bcf738e,0x738e7bcf,0x7baf9cb2,0x6b4d7bef,0x73ae6b6d,0x73ae8410,0x84318410,0x738e738e,0x73ae6b4d,0x738e840f,0x738e7bcf,0x7bef83f0,0x7bf07bcf,0x7baf8410,0x6b4d6b6e,0x738e6b4d,0x736e738e,0x7bcf6b6e,0x73af7bf0,0x73af7bd0,0x73af7bd0,0x84108431,0x7bcf7bcf,0x738e73ae,0x7bcf73ae,
-0x9491a533,0x94918c50,0xa53494b2,0x84109cb2,0x9cb29491,0x94719cb2,0xa4d29cb1,0x9cb19cb1,0xbdd69cd2,0x9491a4f2,0x9491a513,0x94718c50,0xa4f39cb2,0x9c919471,0xad349cb2,0xad34bdd6,0x9cb19cb1,0xd6799491,0x9cb1c5f6,0x8c309cd2,0x94919cb2,0xc617c5d6,0xb5549cd2,0xc5f6d658,0xef1bbdb5,0xb575ce38,0x83ee8c50,0x8c509491,0x8c309492,0x94928c30,0x8c309471,0x8c108c10,
-0x94718c50,0x9cb29491,0x9cd2a513,0xa4f3b595,0x9cb29451,0x8c309471,0x9c919450,0x94718c30,0x8c308c50,0xa4f39471,0x8c309471,0x9cb29c91,0x94919471,0xa5139cd2,0x9cf39cd2,0x94b29cf3,0x84308c51,0x8c318c71,0x8c517bcf,0x8c518c31,0xa5149492,0xa514a535,0x94929472,0x8c729cd3,0xa4f49472,0xa4f3ad34,0x8c109471,0x9cb28c50,0x94919470,0xa5139cd2,0xa4f2a4f2,0x9cd2a4f2,
-0xa4f39491,0x8c509491,0x94919492,0x94929492,0x8c519492,0x94b29492,0x94929492,0x840f8c71,0x7bf083f0,0x8c3183f0,0x94929492,0x8c519492,0x83f08410,0x8c519492,0x8c5183f0,0x84318c31,0x84318431,0x8c518410,0x94b38c51,0x94b39472,0x8c528411,0x84318c51,0x83f083f0,0x83ef8410,0x83ef8410,0x840f83ef,0x840f8c30,0x840f7bef,0x84107bef,0x8c727bf0,0x84108410,0x84308410,
-0x8c71840f,0xa5358410,0x7bcfffff,0x738e734e,0x841083f0,0x9cb3738e,0x736e7bcf,0x7bf0736e,0x736d7bef,0x738e6b6d,0x6b4d736e,0x736e6b6d,0x738e738e,0x7bf073af,0x7bcf738e,0x7bcf8410,0x738e7bcf,0x73ae738e,0x6b4d738e,0x6b6e6b4d,0x632d736e,0x736d6b6d,0x632c630c,0x738e73ae,0x630c736e,0x6b4c632c,0x6b6d6b4c,0x84107bcf,0x7bce83ef,0x94718c30,0x8c308c30,0x8c308c30,
-0x94718c30,0x8c308c50,0xbdf7ad75,0xa5149cd3,0xad55ad75,0x94719cd3,0x7bce8410,0x7bcf738e,0x7bcf7bcf,0x738e9472,0x738e7bae,0x738e738e,0x7bcf73ae,0x73af7bcf,0x630c632c,0x73af632c,0x632c6b6d,0x736d736d,0x84107bef,0x84108410,0x7bcf83f0,0x6b4e73af,0x6b4e6b2d,0x6b4d736e,0x6b6e6b6e,0x7bf07bd0,0x8c518c51,0x8c518c72,0x738e73af,0x738e6b4d,0x7bef7bef,0x738e7bcf,
-0x842f9491,0x94719cd2,0x9471840f,0x94718c51,0x94918c50,0x94919cb2,0x94508c50,0x9cb19cb1,0xad339c91,0xad54bdb5,0xad33ad33,0x8c509cb2,0xbdb69cb2,0x83ef9cb2,0xa4f39cb2,0xb5759cb2,0x8c0fa4f2,0xad54840f,0x9cd29cd1,0xa4f2a513,0x8c509491,0xc6179491,0xc5f6d658,0xc5d6bd95,0xd679ef1b,0xbdb5c5f7,0x9471a4f3,0x94918c50,0x9cb283ef,0x83ef9471,0x9c929492,0x8c109451,
-0xa4f39471,0x8c309cb2,0xb595b575,0x9cd2c5f7,0xa4d28c30,0x9491a513,0x840f9450,0x9c919471,0x94718c50,0x9cb28c30,0x9471a513,0xa5138c50,0x8c309491,0x94918c30,0xad55ad75,0xa4f3ad54,0x8c318c31,0x94718430,0x843083ef,0x94b29472,0x94929492,0xad55ad35,0x8c519cb3,0x9cd39492,0x9c928c51,0xa4f39cd3,0x8c509cd2,0x94508c0f,0x9c919cb2,0xa4f38c50,0xa4f3ad34,0x9cb29cb2,
-0x9cb29cb2,0x94719471,0xa4f39492,0x8c519cd3,0x94b29cb2,0x84308c31,0x94b29471,0x8c519471,0x84108410,0x8c318410,0x8c728c71,0x9cd39cb3,0x8c518c72,0x94728410,0x8c319492,0x8c518c72,0x8c518411,0x8c318431,0x8c518c51,0x9493a514,0x84118c52,0x8c318411,0x8c308c31,0x8c30840f,0x8c30840f,0x7bae840f,0x8c307bce,0x840f8c30,0x7bef7bef,0x8c317bef,0x94928410,0x7bef8410,
-0x8c718c71,0xdeba9472,0x6b4de71c,0x7b8e6b2d,0x83f083f0,0x949283f0,0x632d8c31,0x7bd0738e,0x7bef8411,0x7bcf738e,0x738e8410,0x738e6b4d,0x738e6b6d,0x7bf07bcf,0x73af738e,0x7bcf83f0,0x738e7bef,0x738e73ae,0x6b6e738e,0x738e6b4d,0x6b4d6b6d,0x6b4d6b4d,0x62ec632c,0x738e632c,0x6b4d6b4d,0x6b4d6b4d,0x6b4c632c,0x94b273ae,0x94718c51,0x8c308c51,0x83ef8c51,0x84107bae,
-0x8c508410,0x8c3083ef,0xad548c71,0xad55a514,0xad35a514,0x8c509cd3,0x7bce840f,0x736d7bcf,0x8c316b4d,0x7baf8c51,0x736e73ae,0x7bcf738e,0x84308c51,0x6b4d6b6d,0x7bef73ae,0x6b4d738e,0x6b2d6b2d,0x736e736e,0x8c517bcf,0x84308c31,0x7bef7bef,0x738e7bcf,0x6b4d6b4d,0x6b6e6b6e,0x632c6b6e,0x7bcf738e,0x94928c51,0x8c729493,0x738f7bd0,0x6b6d6b4d,0x7bef7bcf,0x6b4d73ae,
-0x840fb595,0x949194b2,0x8c508c30,0x947183ef,0x9cb29491,0x9cb29491,0x94719cb2,0x9cd29c91,0x9491a4f2,0xad54a513,0x94919cb1,0x9471a513,0x9cb29471,0x8c309491,0x8c50840f,0xa4d29cb2,0x9470bdb5,0xad339490,0xa4f283ee,0x9cf29cf2,0xa4f29c91,0x94919450,0xde99e6fa,0xc5f6ad13,0xffbeffde,0xef1be6fb,0xce38f75c,0x9491bdd6,0x8c308c50,0x7bce9cb2,0x9cd38c30,0x9cb29c72,
-0x8c309451,0x7bce9cd2,0xc6179471,0x9cb2ef3c,0x94719cb2,0xa4f3a4f3,0x8c508c30,0x9cb2840f,0xa4f3a4f3,0x9cd29471,0xa5139471,0x8c509491,0x94919cd2,0x8c50840f,0xdedaad75,0x9cd3a534,0x84108c30,0x8c308410,0x84308410,0x9cd38430,0x9cd39cb3,0xa51494b2,0x8c72a535,0x9cb29492,0x9471a4d3,0x9cb29471,0xa4f3a4d3,0x9471a4d2,0xa4d29450,0xa5139cd2,0xa513a513,0x9cd29cd2,
-0x9471a4f3,0x94718c51,0xa4f39471,0x8c309cd3,0x94928c30,0x84108430,0x8c718c30,0x8c718c71,0x8c518410,0x8c518c51,0x8c318c31,0xa5149cb3,0x94929cb3,0x7bcf8431,0x9cb38411,0x8c319492,0x84318431,0x84318c72,0x8c518411,0x8c728c72,0x84319cd4,0x841183f0,0x84108c31,0x841083ef,0x94719471,0x7bce8410,0x7bee7bae,0x94718c30,0x83ef8c30,0x7bef7bef,0x9cd28410,0x83ef8c50,
-0x840f840f,0xf77e7bef,0x630cbdb7,0x7bcf734d,0x738e7baf,0x8c518410,0x6b4d9cd4,0x736e7bb0,0x7baf736e,0x7bcf7bcf,0x7bcf8410,0x736d738e,0x73ae6b4d,0x738e73ae,0x73ae738e,0x73af73af,0x738e7bcf,0x632d6b6e,0x6b6e6b4d,0x6b4d6b6d,0x738e630c,0x6b4d736e,0x736d736d,0x7bce736d,0x738e738e,0x6b4d6b6d,0x738e6b6d,0x9cd27bae,0x8c508c51,0x94719471,0x8c308c51,0x94918c50,
-0x8c509471,0x8c507bcf,0x8c508430,0xa4f49cd3,0x949294b2,0x8c718430,0x84308430,0x7bcf7bef,0x9cf36b6d,0x7baf7bef,0x738e7bcf,0x7bcf73ae,0x84307bef,0x6b6d73ae,0x84107bcf,0x6b6e7bcf,0x736e6b4d,0x7bae7bae,0x84307bcf,0x7bef8410,0x83f08430,0x7bef83f0,0x6b6e73af,0x738e736e,0x6b4d73ae,0x738e738e,0x94b38431,0x8c729492,0x84318c51,0x6b6e7baf,0x7bcf6b6e,0x73ae7bef,
-0x8c50d6b9,0x8c308430,0x9cf39491,0x8c308c30,0xad349cd3,0xad14a513,0xa4f2ad34,0xad33a4f2,0xa4d2a4f3,0x9cb29491,0x9cd2ad54,0x9cd29491,0x8c308c50,0x94719491,0x94718c50,0xa5139cb2,0xad53ad53,0xa4d2a4f2,0x840e8c4f,0x9cd29cd2,0xa4f2a512,0x9cb19470,0xb574ad13,0xc5d6ad33,0xde99c5d6,0xd679e71b,0xef5cdeda,0xbdd6e71b,0xa4f38c30,0xb5959471,0xd679ce58,0x9471b555,
-0x83ef8410,0x83ef83ef,0xa4f39cb2,0xbdd6ce38,0x8c509491,0xa4f38c50,0x8c309cb2,0x8c5083ef,0xa4f3ad34,0x94719cb2,0x94918c50,0x8c0fa4f3,0xb5959491,0x94719491,0xa5138c50,0x94919cf3,0x83ef8410,0x840f7bef,0x84108430,0x9cd39492,0xa4f49cf3,0x94b39cd3,0xad55a4f4,0x9cb39cd3,0x9492a4f4,0x9c929471,0xa4d39cb2,0xa4d2ad13,0x947183ef,0xa4f3a4d3,0xa4f3a4f3,0x9c929cb2,
-0x9cb29cb2,0x8c509471,0x94918c30,0x94918c71,0x8c308430,0x8c718c50,0x843083ef,0x8c309491,0x8c5183f0,0x8c718c71,0x84108410,0x9cd39492,0x8c51a514,0x7bcf8410,0x8c317baf,0x94729492,0x8c7283f0,0x84318c31,0x84108c51,0x841183f0,0x949394b3,0x84318c51,0x8c308410,0x8c508c51,0x94719471,0x840f8c50,0x7bce7bee,0x8c50840f,0x8c509471,0x841083ef,0x84308410,0x949194b2,
-0x7bef840f,0xef5d83ef,0x6b2da514,0x83f0738e,0x7bae7bcf,0x73ae73ae,0x6b4d9cb3,0x73af6b6e,0x7bd07bcf,0x84318431,0x83f08431,0x6b6d7bef,0x7bcf73ae,0x738e7bcf,0x7bcf73ae,0x738e73ae,0x738e738e,0x632d6b4d,0x6b4d632d,0x632d6b6d,0x736e6b4d,0x738e73ae,0x738e736d,0x7bae7baf,0x6b4d7bae,0x736e6b4d,0x7bae6b6d,0x8c517bef,0x8c718c51,0x94929492,0x8c519471,0x94719471,
-0x83ef8c51,0x8c517bcf,0x7bcf8410,0xb5969492,0x84108c51,0x7bef8c51,0x94928c71,0x7bce9471,0xb5b673ae,0x738e7bae,0x738e73ae,0x7bcf7bcf,0x7bcf73ae,0x6b4d73ae,0x8410738e,0x6b6d7bef,0x738e6b4d,0x7bef7bcf,0x84107bef,0x73ae7bcf,0x73ae7bcf,0x7bef7bcf,0x73af7bcf,0x73ae73ae,0x6b6d6b6e,0x6b4d6b6e,0x8c517bd0,0x94938c51,0x9cb39cd3,0x7bf08c51,0x7bcf73af,0x84108410,
-0x8c70bdf6,0x840f8c50,0x9cd28c30,0x94919cd2,0xa4f38c51,0xa4d3a4f3,0x9cb29cd2,0xa4d29cb1,0x9c919cb2,0x840f9c91,0xad349cb2,0x9cd29cd2,0x94719c92,0x94719c92,0x94719c92,0x94918c30,0x9cb1a4f2,0xb574d678,0x94908c4f,0x8c508c50,0x9cd29491,0x94709cb1,0x9cb19c91,0xc5d6ce16,0xad34ad13,0xb595bdb6,0x94919491,0x8c509cb2,0x840f840f,0x9cd28c30,0xce38e6db,0xad349cb2,
-0x840f8c30,0x8c508410,0x94919cd2,0xbdb69cd2,0x9491b595,0x94919cb2,0x94919491,0x8c509470,0xad349491,0x9cd29cd2,0xa4f3a4d2,0x9cd29471,0x8c309c91,0x84109471,0x8c508c30,0x8c518c71,0x841083ef,0x840f7bef,0x84108410,0xa4f3ad75,0xad559cf4,0x9cf4a514,0x9cd394b2,0xa4f3ad55,0x9cd3a4f3,0x9c929c92,0x94719c92,0xa4d29471,0x94509cb2,0xa4f39c92,0xa4f3ad34,0x9c929471,
-0x9cd29492,0x94929cb2,0x8c508c30,0x8c518c50,0x84308c51,0x94918c51,0x84108430,0x84308c50,0x8c718430,0x94718c71,0x84308430,0x94728c51,0x9cf394b2,0x84108c72,0x83f07bd0,0x94929492,0x7bf08c52,0x94729492,0x8c528c31,0x84318411,0x94728c72,0x8c718c72,0x8c518c51,0x94919491,0x8c508410,0x8c509471,0x8c508c50,0x83ef840f,0x8c508c50,0x8c308c51,0x84108430,0x9cb29491,
-0x8c3094b2,0xffbe9cd2,0x83efa514,0x7baf83f0,0x7bcf83ef,0x6b4d736e,0x83f0ad76,0x8c31738f,0x84108431,0x7bf07bf0,0x7bcf8c51,0x738e736e,0x7bcf8410,0x7bcf7bcf,0x7bcf73ae,0x738e7bcf,0x738e738e,0x738e6b6e,0x6b4d738e,0x6b4d6b6e,0x6b4d6b6e,0x6b6d6b4d,0x6b6d736d,0x7bae6b6d,0x6b4d6b4d,0x738e6b4d,0x73ae738e,0x8c517bef,0x94928c51,0x94929492,0x94729cb3,0x94718c51,
-0x7bcf8c51,0x83ef7bce,0x738e73ae,0xad347bcf,0x8430ad35,0x7bcf8c30,0x8c508c50,0x947194b2,0xb5b67bef,0x7baf7baf,0x738e73af,0x7bcf7bcf,0x7bcf7bcf,0x738e7bef,0x7bcf738e,0x7bef8410,0x73ae738e,0x84107bef,0x7bef8410,0x7bcf7bef,0x73ae73ae,0x7bef7bcf,0x84107bf0,0x738e7bcf,0x6b6e6b4d,0x6b6d738e,0x7bf073af,0x9cd38411,0x8c528c72,0x8c518c31,0x73af8410,0x7bef7bcf,
-0x8c30a513,0x8c718c50,0x8c518c50,0x9cd39cd2,0x9cb29471,0x9cd2a4f3,0x9cd29cb2,0x9cb29cd2,0x8c509471,0x94919cb2,0xa4f39491,0x9471b575,0xa5139491,0x94719471,0x8c30a4d3,0x8c0f8c30,0xb554a4d2,0xa4f2e6da,0x94509cb1,0x94509c91,0x94708c2f,0x8c508c2f,0x9cd2a4f2,0xde99a4f2,0xa513bd95,0xb5959cd2,0x94919cd2,0xa4f3a513,0x94919cb2,0x94718c50,0x8c508c10,0x947183ef,
-0x83ef8c51,0x8c718c31,0x9cb29cd3,0xad348c50,0xb575ce38,0x94719491,0x9cd2842f,0x8c50a513,0x947183ef,0xad34a513,0xa513b575,0x94718c50,0x8c509cd2,0x8c508c30,0x8c30840f,0x9491840f,0x7bcf8c30,0x7bcf8410,0x8c517bce,0xa4f4a514,0x94729492,0x9cd39cd3,0x9cb39cb3,0xbdd7ad55,0xad14b575,0x9cb29cd3,0x94719cb2,0x9c929471,0x9cb2a4d2,0x9cb29cb2,0xa4d3ad34,0x94929492,
-0x9cf3a4f3,0xa5349cd2,0x8c7194b2,0x84308c50,0x84308410,0x8c718c71,0x8c519492,0x7bef840f,0x94b28c71,0x94919491,0x84308c30,0x8c308430,0x94928c71,0x8c729cb3,0x8c319472,0x94927bcf,0x84318c72,0x9cf48431,0x8c5283f0,0x8c519472,0x84108431,0x8c728431,0x94719492,0x8c508c30,0x840f8c10,0x94718c30,0x8c309491,0x8c30840f,0x8c308c30,0x8c519471,0x94718c50,0x8c508c50,
-0x94919471,0xffffb555,0x83efa4f3,0x7bae9471,0x7bcf83ef,0x7baf738e,0xb596ce7a,0x8c528431,0x83f08411,0x738f73af,0x7bcf8c51,0x7bf0738e,0x7bcf8410,0x738e73ae,0x73ae6b4d,0x6b4d6b6d,0x6b6d6b4d,0x738e6b6e,0x6b6d738e,0x6b4e6b4e,0x6b4d6b4d,0x6b4d632d,0x738e73af,0x7bcf736e,0x738e736e,0x738e6b4d,0x7bcf8410,0x8c307bef,0x8c319472,0xa51494b2,0x947194b2,0x84109492,
-0x7bae83ef,0x7bcf738e,0x84307bcf,0x841073ae,0x94929492,0x94b28c51,0x94b28430,0x84108c51,0xa5149492,0x84107baf,0x7bcf7bf0,0x73ae7bcf,0x7bcf7bcf,0x7bcf7bef,0x7bcf7bcf,0x7bef8410,0x7bef7bcf,0x7bf08410,0x7bef8410,0x7bef8410,0x84107bef,0x84308430,0x84108410,0x738e7bef,0x738e6b6d,0x738e738e,0x736e6b4e,0x84107bcf,0x738f738f,0x841073af,0x7bcf8410,0x73af73af,
-0x840f8c30,0x94918430,0x8c518c50,0x9cb29cd3,0x9cb29cd2,0xad34ad34,0x9cd29cb2,0xa513a513,0x9491ad34,0x8c509471,0x9cd2a4f3,0xad549cd2,0x9cb29491,0x8c309cb2,0x94719471,0x8c509451,0xad13840f,0x9cd2ce37,0xad549470,0x9cd29cb1,0xbdb59450,0x8c50ad33,0xa4f2a4f3,0xad33a4d2,0xbdb6d679,0xa5149cd2,0xad34ad54,0x9cf3ad54,0x8c30ad54,0x7bce7bee,0x840f840f,0x9cd39cb2,
-0x8c718410,0x84308c30,0x9cb29492,0x94719cb2,0xad349492,0x9491ad54,0x94919491,0x8c509cb2,0x94718c30,0xb5759471,0xa513b554,0x94719cb2,0x9cd283ef,0x8c509cb2,0x8c308c50,0x8c30840f,0x8c509492,0x83ef83ef,0x8c3083ef,0x9cd39cd3,0x9472a4f3,0x94718c31,0x9471a514,0xb5969cd3,0xad34c5f7,0x9cd3a4d3,0x9cb29cb2,0x94719cb2,0xa4f3ad34,0xa4f39c92,0xb555c618,0xa4f3a4f4,
-0xa513a514,0xa5349492,0x9471a513,0x94918430,0x8c518c51,0x8c5194b2,0x9cb29491,0x84309491,0x9cb29491,0x94919492,0x84108410,0x84108410,0x94728410,0x9cb39492,0x8c529cb3,0x7bcf8410,0x8c728c52,0x84318c31,0x84108431,0x8c518431,0x7bf08410,0x8c728c72,0x94919492,0x8c308410,0x94518c30,0x8c308c50,0x8c308c2f,0x8c508c50,0x8c508c50,0x9cb28c30,0x8c309471,0x8c308c30,
-0x9cd29450,0xffdfdeba,0x7bcf9cb2,0x94718c30,0x8c308430,0x7bef738e,0xb597ad55,0x94938c51,0x7bcf8c31,0x7bcf7bf0,0x73ae7bcf,0x736e7bcf,0x84308410,0x6b4d73ae,0x738e632c,0x632c632c,0x6b4d6b4d,0x6b6d6b6e,0x73ae6b6e,0x6b6e6b6e,0x6b4e6b6e,0x738e736e,0x7baf738e,0x6b6d73ae,0x738e7bef,0x7bef6b6d,0x7bae8430,0x7bef83f0,0x84107bf0,0xa5149472,0x94929cf3,0x94719492,
-0x9cb38c30,0x8c308c71,0x8c318410,0x7bef8c51,0x7bcf7bcf,0x94928410,0x7bef8430,0x83ef8430,0xa4f49cd3,0x8c518c31,0x83f07baf,0x738e7bd0,0x73ae736e,0x7bf073af,0x7bcf8431,0x7bcf7bf0,0x7bcf73af,0x7bef8410,0x7bcf8410,0x73ae7bef,0x7bce73ae,0x84107bef,0x7bef8410,0x7bef7bef,0x7bcf7bcf,0x73af7bcf,0x738e6b6e,0x6b4e7bcf,0x7bcf73af,0x7bf07bcf,0x84108410,0x7bcf8410,
-0x8430840f,0x8430840f,0x8c509492,0xa4f38c51,0x9cb2ad55,0x9cb29c92,0xa513a513,0x94719c91,0x94518c30,0x9cb29cb2,0xad149c92,0xad34a513,0x9c92a513,0xad14a4f3,0x94719c92,0x840f9451,0xa4d283ee,0xb554b554,0xa4f2a4d2,0xad13bd95,0xce378c50,0x9471c5f7,0x8c2f9cb2,0x94719c92,0xce389cd2,0x9491ad34,0xad54b575,0x9cf2b595,0x8c309491,0x83ef842f,0x94919491,0xef1c9451,
-0x7befa4f3,0x84108430,0x9cd29cd3,0x8c509492,0x94918c51,0xad54ad55,0x9cd29471,0x94719491,0x8c30a4d3,0x9491840f,0xad13c617,0x9450ad54,0x8c508c30,0xa4d2b554,0x8c308c30,0x840f8c30,0xa5139cd3,0x8c309471,0x94718c30,0xa4f49cb2,0xa5149492,0x94929cd3,0xa4f39cb3,0x9cd3ad34,0xc5f7ad55,0x9cd2ad34,0xa4f39cb2,0x9cb29c91,0xb555a4f3,0xb555de99,0x9cb2b575,0xbdb6ad14,
-0xad34a4f3,0x9cb2a514,0x8c719cd3,0x8c308430,0x7bef8c51,0x94718410,0x8c508c30,0x94b29492,0x8c71840f,0x949194b2,0x840f9471,0x84107bcf,0x8c318430,0x9cb394b2,0x94b2ad76,0x7bf09472,0x84117baf,0x84318411,0x84118411,0x8c318c52,0x8c319492,0x8c728c31,0x9cd29492,0x840f8c51,0x94918c50,0x8c0f9471,0x8c308c2f,0x83ef840f,0x8c308c30,0x8c508c30,0x8c509471,0x8c308c0f,
-0x8c2f9470,0xffffef3c,0x83ef8410,0x9cb27bcf,0x8410ad34,0x84107bcf,0xbdf89cd4,0x94929492,0x84108410,0x7bcf8431,0x73af7bf0,0x84307bf0,0x84308410,0x83f07bcf,0x738d7bcf,0x6b4d736d,0x6b4d6b4d,0x736e6b4d,0x73af738e,0x738e736e,0x6b6d632d,0x738e6b6e,0x7bcf7bcf,0x738e738e,0x7bce7bef,0x7bae7bef,0x84307bcf,0x84107bf0,0x7bcf7bcf,0x94b28c72,0xad55a4f4,0x94b2ad55,
-0x84108c51,0x8c718c51,0x84318431,0x7bf08410,0x7bcf8410,0x84308410,0x94928c30,0x83f08c51,0x8c529cf4,0x84119492,0x7bd07bd0,0x73af73af,0x7bcf73af,0x7bf073af,0x84318431,0x8c528c52,0x7bcf7bef,0x7bf07bcf,0x7bcf7bcf,0x73ae73ae,0x6b6d738d,0x8c51840f,0x84308410,0x84308c51,0x84108410,0x7bef7bcf,0x7bf083f0,0x738f7bcf,0x7bf06b4d,0x8c319472,0x7bf08411,0x7bf07bf0,
-0x8c508c50,0x8c30840f,0x94719cb2,0xa4f39492,0xa4f3c5f8,0xa514ad55,0xad139491,0x8c0f9cd2,0x94917bae,0x94719451,0xad149cb2,0x9cb2ad34,0x9cd2a4d3,0xa4d3a4d3,0x9492a4f3,0x94718410,0xa5139471,0x9cb28c10,0x9c919cb1,0xb575ad13,0xbdb69471,0x9cb2c5f7,0xa4d2a4f3,0x9c929450,0x9cd39491,0xa4f3ad34,0x9cd2ad54,0xbdd6b575,0x9cd29cd2,0x9471ad34,0x94719cd2,0xef5d9471,
-0x8c51b596,0xa5348c71,0x9cd39cd3,0x8c509cf3,0x94919491,0xad559cb2,0x9491ad54,0x840fa4f3,0xa5139491,0x94719471,0xd699b575,0xbdb6b595,0x8c308c30,0x94719471,0x94919471,0x8c519471,0x9cb29471,0x94718c51,0xa4f38c51,0xa4f3ad34,0xa514ad34,0xa4f3ad55,0x9cd39492,0xad34a514,0xb575ad55,0xad54b595,0xa4f3a4f3,0x9cb2a4f3,0xbdb6ad13,0xce18c5d6,0x9c92b596,0xc5f7ad55,
-0x9492bdf7,0x9cb28c71,0x94929cd2,0x84309492,0x8c508410,0x8c308c51,0x8c508c71,0x9cb28410,0x84308c50,0x8c718c50,0x84308c71,0x84108430,0x83f08c51,0x9cd38c31,0x9cd3ad55,0x84108c51,0x7bf07bf0,0x84318431,0x84118431,0x94728c52,0x94728431,0x8c728431,0x94718c30,0x94719492,0x8c508c30,0x94919491,0x83ef8c2f,0x94918c50,0x840f8c30,0x8c1083ef,0x94719471,0x94919471,
-0x83ef9cb1,0xe71bef3c,0x84108c30,0x83f083ef,0x94b28c71,0x7bef8410,0x9cd38c51,0x94928c31,0x83f08c72,0x7bcf8431,0x8c518431,0x8c518410,0x6b6d83f0,0x84106b4d,0x73ae83ef,0x73ae73ae,0x738e738e,0x6b4d6b6e,0x738e6b4d,0x738e738e,0x6b4d738e,0x7bcf6b6d,0x7bcf8410,0x7bcf7bcf,0x84308c50,0x84108c71,0x84107bcf,0x83f08410,0x8c5183f0,0x94b39492,0xb5969471,0xa4f3c5f8,
-0x8c518410,0x8c519471,0x84308c31,0x84108410,0x7bef8410,0x8c518430,0x8c518430,0x84108410,0x7bd09cd3,0x8c529493,0x7bcf73af,0x738f7bcf,0x73af8410,0x738f6b4e,0x738f7bd0,0x73af738e,0x7bef8431,0x738e73ae,0x73ae738e,0x6b6d73ae,0x73ae73ae,0x7bce73ae,0x84308410,0x84107bef,0x84108430,0x7bf07bef,0x84318431,0x7bd08410,0x83f0738f,0x84118410,0x83f07bf0,0x84107bf0,
-0x8c50a4f3,0x7bef7bce,0x84308c51,0x9cb28c51,0xa514a514,0xa4f39cd3,0x94919c92,0x9c91a4f3,0x8c509cb2,0x9cb29450,0x9c919491,0x9cb29491,0x9cb29471,0xa4f3a513,0x9c929cd2,0x8c308c30,0xa513b575,0x83ef83ef,0xa4f39450,0xa4d29c91,0xbd95bd95,0xa4f3ce38,0xa4d2b555,0xad14ad14,0xad34ad13,0xc5f7bdb6,0xad13ad34,0xb5b5ad33,0xb595bdb5,0xb575ad34,0x9cb2a4f3,0xef5dbd96,
-0x94929472,0xa4f48c51,0xad55ad55,0x9cb29cf3,0x8c519cd3,0x8c508c71,0xb595b575,0xad34b596,0xc5d7a4d3,0xa4f3b595,0xb595ad13,0xad13bdb6,0x8c30ad34,0x840f83ef,0x9492a513,0x9cd38c30,0x7bce8c30,0x9cd28c30,0xa4f3b575,0xad14ad14,0xad35ad14,0xb555a514,0x9cb3b555,0xad14a514,0xa4f3a4d3,0xbdb6ad54,0x9cd2b595,0x9cd29c91,0x9cd2a4f3,0xbd96ad54,0xbd96bdb6,0xb575ad35,
-0x9492b596,0x94928c51,0x8c7194b2,0x8c719471,0x8c517bef,0x840f9cb2,0x8c518410,0x8c718c51,0x8c719cf3,0x8430840f,0x94919491,0x843094b2,0x8c7183ef,0x8c5183ef,0x9cd3a535,0x94929492,0x7bf08c52,0x84318c31,0x8c518c52,0x94728c72,0x8c318c72,0x84108c72,0x94718410,0x94719471,0x83ef840f,0x9cb29450,0x83ee8c30,0x94918c2f,0x8c309491,0x8c10840f,0x94508c50,0x94509471,
-0x8c309491,0xbdd6ffbe,0x83ef7bae,0x83f08410,0x84108410,0x8c319492,0xa5148c31,0x84119472,0x84318c51,0x7bf07baf,0x8c728c71,0x84108c72,0x736d8410,0x73ae6b4d,0x7bcf73ae,0x738e7bcf,0x736d736d,0x6b2c6b6d,0x736e6b4d,0x738e73ae,0x6b4d7bcf,0x7bcf6b6e,0x7bcf7bcf,0x7bef7bef,0x8c508c50,0x8c718c71,0x738e7bcf,0x8c7183f0,0x84108410,0x84308410,0xa5348c71,0x94b2b5b6,
-0x8c318410,0x7bf08410,0x84318431,0x94928410,0x84109492,0x7bcf8410,0x84107bef,0x94927bef,0x8c51b596,0x8c729cb3,0x7bf07bf0,0x7bcf7bcf,0x736e7bd0,0x7bd0736e,0x7bd08431,0x738e6b6e,0x73af738f,0x738e7bcf,0x738e6b6d,0x7bcf7bcf,0x738e738e,0x7bcf73ae,0x84107bef,0x7bcf7bef,0x84107bef,0x8c518430,0x84318c51,0x84108411,0x7bf07bd0,0x7bf07bcf,0x7bd07bcf,0x84107bcf,
-0x840f8430,0x8c50840f,0x84109471,0x8c518c30,0xa4f38c51,0x94719cb2,0x94719cb2,0xa5138c50,0x9cb2a4f3,0xad349c91,0x8c509cb2,0x94719cb2,0x8c509471,0x9cb29cb2,0x8c508c30,0x8c309491,0xb595c5f7,0x8c50a4d3,0x9c919450,0x9450a4d3,0xce18a4d2,0xa4f3c5d6,0xb575a4d3,0xad34a4d3,0xa4d2b554,0xbdb6b554,0xa513ce38,0xdefaad54,0xad33c5f6,0xa4f39491,0x94719cd3,0xdebbc5f8,
-0x7bcf83cf,0x8c518c30,0xb5b6a4f4,0xa534ad55,0x8c519492,0xad549cd3,0xdeba9cd3,0x9cd2b575,0x9491a4f3,0xad14ad14,0x9cb29cb2,0xb575ad54,0xa4d2ad34,0x947183ef,0x8c519cb2,0x83ef83ef,0x94719491,0x9cd28c50,0xad34b555,0xb596ad14,0xad34b555,0xa4f4ad14,0xad35b576,0xa4f3a4f4,0x9cb2a4d3,0xbdd6a4f3,0xa513b595,0x9cd29cd2,0xad54ad34,0xb575a4f3,0xce38b575,0x8c51ad35,
-0x94b29471,0x8c519492,0x94719471,0x94918c71,0x840f9491,0x840f8c51,0x840f7bef,0x94929491,0x9cd29471,0x8c309cd2,0x94b28c30,0x8c50ad54,0x84108430,0x8c308c71,0x9cb38c51,0x9cd3a4f4,0x84319492,0x84108431,0x8c728c31,0x8c529492,0x94928c52,0x94728c51,0x841083f0,0x94718c30,0x8c308c30,0x94718c30,0x8c509491,0x8c30840f,0x8c309471,0x8c308c30,0x8c508c30,0x94719471,
-0x9c929c91,0xa4f3ffbe,0x8410738e,0x84108410,0x84107bcf,0xa5149cf3,0x9cd38c71,0x738fa515,0x7bd07bd0,0x7bcf7bcf,0x94928410,0x7bcf8430,0x7baf7bcf,0x630c6b4d,0x7bcf6b4d,0x6b4d736e,0x632c630c,0x6b6d6b6d,0x738e738e,0x6b4d738e,0x73af73ae,0x7bcf7bcf,0x7bcf73af,0x7bce7bef,0x840f7bcf,0x7bce73ae,0x7bef8410,0x9cd38410,0x84108c51,0x84107bf0,0xa5149cf3,0x9cd3ad55,
-0x8c319492,0x83f07bef,0x84308c71,0x84107bcf,0x7bef8c71,0x84108430,0x8c518c51,0x9cd38410,0x8c72ad75,0x84308c51,0x7bcf7bcf,0x7bf073af,0x84118c31,0x84108431,0x84108411,0x73af73af,0x738e738f,0x738e73ae,0x73ae73ae,0x6b6d73ae,0x6b6d6b4d,0x7bef7bcf,0x7bef7bcf,0x73ae7bcf,0x840f73ae,0x8c718c71,0x84108431,0x84318410,0x83f08c52,0x73af7baf,0x84108410,0x84108410,
-0x8c308c71,0x7bef840f,0x8c518430,0x94729492,0xad359492,0x9cb2a4d3,0xa4f3a4f3,0x94919471,0xad549cd2,0x9cd2a4f3,0x94919cb1,0x9cb2a4f3,0x94719c91,0x8c508c0f,0x94509491,0x94919471,0x9cb2bdd6,0x8c509491,0x8c308c50,0xa4f3a4f3,0xad139471,0x9471de9a,0x9471ad54,0xad149cb2,0xbd75b555,0xa4d2a4d3,0xe6dab554,0xbdb5deda,0x9cd2ad33,0x8c5094b1,0x8c518c51,0xe6dbb596,
-0x84109471,0x8c7173ae,0x9cd39cd3,0xa534bdd7,0x949294b2,0x9cd39472,0xa5149cb2,0xb596bdd7,0xad54a513,0x94719cb2,0x9cd2a513,0xad138c30,0xa4f3bdb6,0x8c30a4f3,0x840f83ef,0x840f8c30,0xad148c30,0x9491ad34,0xb5559cb2,0xad35b576,0xb596c5d7,0x9c92b555,0xad359c92,0xa4f3b576,0xa514a4f3,0x9cb29cb2,0xbdb6ad54,0x9cd2ad34,0xad349491,0xa5139cd2,0xb595a513,0x9cb3b596,
-0x8c718c30,0x8c719492,0x8c718c51,0x94929492,0x8c719cd2,0x7bce83ef,0x83f08430,0x94b29471,0x94718c50,0xa5139cd2,0x8c509491,0x8c509cd2,0x84309491,0x84107bcf,0x8c318c31,0x9cb39cf4,0x94939cd3,0x84118431,0x84317bf0,0x8c728c72,0x8c728c52,0x94729472,0x84108c51,0x8c508c51,0x94718c51,0x94719471,0x9cb19cb1,0x8c2f8c50,0x8c0f8c30,0x8c508c30,0x8c508c30,0x9cb29491,
-0xad349491,0x9471ffde,0x83f08410,0x84307bcf,0x84107bcf,0x94928c71,0x8c718c51,0x738f9cb3,0x73af738e,0x7bf07bcf,0x84107bcf,0x73ae73ae,0x738e73ae,0x6b4d6b4d,0x73ae738e,0x73ae736d,0x6b6d6b4c,0x73ae738d,0x73ae7bcf,0x738e7baf,0x7bf0738e,0x7bef8410,0x7bcf7bcf,0x7bcf73ae,0x7bef7bef,0x8410840f,0x84107bcf,0x949294b3,0x8c518c51,0x8c518430,0xad5594b2,0xa514a514,
-0x9492a514,0x8c318431,0x83f08c51,0x7bcf73af,0x7bcf7bcf,0x8c718c72,0x8c519492,0x9cd3840f,0x84309492,0x84307bef,0x7bcf7bf0,0x8c728431,0x9cd39cd4,0x843194b3,0x7bf07bf0,0x73af73af,0x7bef738f,0x84308c51,0x6b6d7bcf,0x73ae738e,0x7bef738e,0x7bef8410,0x7bf08410,0x7bcf73ae,0x7bef73ae,0x84308c51,0x84108410,0x84318410,0x84108431,0x738f7bf0,0x738f73af,0x84317bf0,
-0x8c719cf3,0x7bcf7bef,0x8c718c31,0x94719492,0xad559cd3,0xad149cb2,0x9cd2ad14,0x8c309491,0xa5139cb2,0xb554bdb5,0x94919cd2,0x9c919471,0x94719491,0x840f83ef,0x9cb29cb2,0x94919491,0x840fb595,0x8c308c30,0x94719471,0xb5759c91,0x9471a4f3,0xc5f7b555,0xb575ad54,0xbdb6a4f3,0xbd75ad34,0xa4b2b555,0xffffde99,0x9cb1deb9,0xa5139491,0xad34ad34,0x84109451,0xb576a4f4,
-0x84309cd3,0x843083ef,0x9cd394b2,0xad359cf3,0x8c319cb3,0x9cb29492,0x9cb3b596,0xce389cd3,0xad34b596,0xa4d3b595,0xb554a4d2,0x9c91b554,0xbd95ad13,0xa4f3ad34,0x8c308c50,0x8c50840f,0x947183ef,0x9cd2ad34,0xad14a4d3,0xb576bd96,0xbdb7b555,0xa4f4b555,0xa4f49cb3,0xb555b576,0xa4f3ad34,0x9cb2a4f3,0xb5759cd2,0xa4d2c5f7,0x9cb29cb2,0xad13b575,0x9cd2a513,0xb596a4f3,
-0x8c71a4f4,0x94928c51,0x84308c51,0x94b28c71,0x9cd29471,0x84108c30,0x8c719492,0x84308c51,0x9cb2a4f3,0xad548c50,0x8c50a513,0x8c507bce,0x8c718410,0x84108430,0x84108410,0xa5148410,0xa535ad55,0x8c728c72,0x84318410,0x8c528c51,0x8c528c52,0x94929472,0x9cd38c51,0x8c308c50,0x8c518c30,0x94919491,0x94918c70,0x94709c91,0x8c508c30,0x8c509451,0x840f840f,0x94918c50,
-0xc5f79471,0x9451ffff,0x7bcf8410,0x8c3183ef,0x83f08c30,0x84107bcf,0x94928c71,0x7bf09452,0x84107baf,0x8c7283f0,0x7bcf8431,0x7bef8410,0x73ae8410,0x7bef738e,0x738e7baf,0x84107baf,0x84108430,0x73ae73ae,0x7bae7baf,0x84308410,0x7bf07bcf,0x8c518410,0x7bcf8c51,0x841073ae,0x94917bce,0x8c7194b2,0x7bcf8410,0x94b28430,0x7bf08c51,0x94b28c71,0xa53494b2,0x9cd3a514,
-0x94929cf3,0x84308c72,0x738e7bcf,0x73af736e,0x84108410,0x8c719492,0x84308c51,0x9cd2840f,0x8c718430,0x84107bcf,0x84108c51,0x94b28c51,0x94b394b3,0x84108c72,0x7bf07bf0,0x7bf07bf0,0x84108410,0x84308431,0x7bcf8410,0x7bcf7bcf,0x84107bef,0x84108431,0x7bcf7bcf,0x7bef73af,0x7bcf7bef,0x84108410,0x8c718c51,0x83f08411,0x8c528410,0x8c528c52,0x73af7bd0,0x8c527bd0,
-0x8c509491,0x84108410,0x8c518c51,0x9cd39cb3,0xa4f3a4f3,0xad34a4f3,0x9cd2a4f3,0x8c508c0f,0xad139cd2,0xb575b574,0x8c2f9cd2,0x8c509471,0x8c0f8c50,0x738d7bce,0x949183ef,0x9cb29cb2,0x94719cb2,0x8c508c70,0x94718c30,0x9cb29491,0x9cb19cb2,0xb575deba,0xa4f3ce38,0xad34a513,0x9c71b555,0xff9eacf3,0xad33ffff,0xb574b595,0xa513ad33,0xad54a513,0x9471a4f3,0xb555ce39,
-0x84109492,0x8c718c51,0x9cb38c71,0x9cd39cd3,0x9cd3a4f3,0xb596a4f3,0x8c30c618,0x94929471,0xb595b575,0xb595b575,0xa4f3a4f3,0xa4f3c5f7,0xad349c91,0x9491b575,0x94919491,0x8c3083ef,0x840f9471,0xa5138c30,0xad34a4f3,0xc618ad55,0xb555b576,0xad35b576,0xb555ad35,0xbd96a4f4,0xa514b575,0xa4f3a514,0xa4f3a533,0xb575b575,0x9cb29cd2,0xad54ad34,0x94b1a533,0xa5138c51,
-0x9cb3ad76,0x84317bf0,0x8c719492,0x8c508410,0x8c518c51,0x9cb28c51,0x8c719cf3,0x8c308c30,0xad549cd2,0x94b29cd2,0x94919491,0x8c30840f,0x8c518c50,0x8c518410,0x8c518c31,0x8c319492,0xa535a535,0x949294b3,0x8c518c51,0x84318411,0x94938411,0x94b39493,0x8c519472,0x8c509492,0x840f8c30,0x94718c30,0x8c708c70,0x94709471,0x94718c30,0x8c509471,0x8c308c30,0x94718c50,
-0xd6799471,0x9471ff9e,0x84108410,0x84108c31,0x94728c51,0x94b283f0,0x8c519cd3,0x8c519492,0x73af7bcf,0x84318410,0x84108410,0x84107bef,0x84108c51,0x7bcf73ae,0x736e738e,0x7baf73ae,0x94718c71,0x73ae7bce,0x7bcf7bce,0x8c518410,0x7bef8430,0x8c518410,0x7bef8c51,0x84107bcf,0x8c707bef,0x8c518c71,0x83f08c51,0x94928410,0x84108c72,0x9cf394b2,0xa514a534,0x9cd3a534,
-0x9cd39cd3,0x9cd3a4f4,0x7bd08c51,0x73af738e,0x8c518c51,0x94928c72,0x84108c51,0x94b27bef,0x9d138c91,0x842f840f,0x8c7194b2,0x94b28c51,0xb5b6bdd7,0x8c72a514,0x7bd08410,0x84107bf0,0x84318c71,0x84108410,0x7bf07bef,0x73ae7bef,0x738e7bef,0x7bef7bef,0x738e6b6e,0x73af73af,0x7bce7bef,0x84107bef,0x94928c51,0x8c528c51,0x8c318c72,0x8c728411,0x84118c52,0x73af73af,
-0x84307bef,0x7bcf840f,0x9cd38c71,0x8c319cb3,0x9cd39cb2,0xb555a4f3,0x9cd29cd2,0x94719cb2,0x94709cb2,0xad339cd2,0x9491ad54,0x8c5083ef,0x83ce840f,0x7bae840f,0x94717bce,0xad349c91,0x8c508c50,0x840f9cd2,0xb5548c30,0x9471a4f3,0x8c509471,0xad34d658,0xbdb6bd96,0xa4d39cb2,0xa4f3a4b2,0xffffde99,0xacf3c5b6,0xbd95ad54,0xa4f2b595,0xad549491,0xa514ad54,0xa4f3c5f7,
-0x84309492,0x94929492,0x94929492,0x9cd3a4f3,0xb5759cb2,0x9cd39cb2,0x9cb29471,0xa4f39471,0xce38a4d3,0xa4f3c617,0xa4d3ad34,0x94719471,0xa4d29cb2,0xad54ad54,0xa4d39cd2,0x8c308c30,0x94719cb2,0x8c308c10,0xad55a4f3,0xad35a4f4,0xbdd7d659,0xad35ad35,0xad55a4f4,0xa514ad35,0xad34bdb6,0xa5139cd2,0x9cb2a513,0xb575a4d2,0xad33bd95,0xa513b595,0xa4f3b595,0x8c308c50,
-0x9cf49cf3,0x84108c51,0x8c718430,0x84308410,0x84308410,0x94928c51,0x8c519492,0x94928c30,0x949194b2,0x8c509cd2,0x9cd28c30,0x84309cf3,0x8c718430,0x94929cd3,0x83f08c31,0x8c518c51,0x94b38c51,0x8c529cd3,0x8c518c51,0x84107bf0,0x8c528c52,0x94939472,0x94929452,0x94719471,0x840f8c51,0x8c707bcf,0x94919cd2,0x8c708c30,0x94718c50,0x94719471,0x94719491,0x94719471,
-0xd6799471,0xa4f3e6fb,0x8c308c30,0x84108430,0x84107bcf,0x94b28410,0x9472a4f4,0x94928c10,0x7bf07bd0,0x7bf07bcf,0x84107bf0,0x73ae8430,0x8c718430,0x7bae7baf,0x738e7bcf,0x6b6d6b4d,0x8c517bcf,0x7bef7bcf,0x84108410,0x7bcf7bcf,0x73ae8410,0x7bef73ae,0x7bef7bef,0x738e7bcf,0x8c50840f,0x840f8c50,0x7bcf7bef,0x84307bef,0x84107bef,0x94928c51,0x9cd29492,0xa4f39cd3,
-0x94b29cb3,0x9cf49cd3,0x8c519cd3,0x84107bcf,0x84107bf0,0x8c718c51,0x73ae7bef,0x9cd37bef,0x8c707c0f,0x840f7c0f,0x8c708c50,0x94918c51,0xad55a514,0x94b2a514,0x84318c51,0x94928c72,0x8c718c51,0x84318c51,0x84107bef,0x84308430,0x738e8410,0x6b6e6b6d,0x7bcf73ae,0x7bcf7bcf,0x7bce7bcf,0x7bef7bef,0x8c717bf0,0xa5149493,0x8c3194b3,0x8c518431,0x7bf09492,0x738f738f,
-0x8c518410,0x94728c71,0x8c518c51,0x8c729492,0x94719471,0xa514a4d3,0x9cd2a4f3,0x9cb2a4d3,0x94919491,0x9c919471,0x94719cb2,0x7bce83ef,0x8c308c0f,0x736d7bae,0x9cb28c30,0xa4f39471,0x84108c10,0x8c109492,0xad349451,0x9471a4f3,0x9c919c91,0xad14bdd6,0xa4f39cb2,0x9cd3b575,0xbdb6a4d2,0xb554deb9,0xa4f2b574,0xbdb5de99,0xbd75bd74,0x9491a4f2,0xbdb59cd2,0x8c50b595,
-0x8c309491,0x94918c30,0x94919cd3,0x9cf38c71,0x9cf394b2,0x9cd29cd3,0xb595a534,0xa514ad34,0xa4f3ad55,0xc5d7c618,0xad14a4f3,0x9cb2a4d3,0x9cb29cd3,0xa5139cb2,0xa4d3ad34,0x9492a4f3,0x9c929451,0x84108c31,0xad149472,0xa514b576,0xce39b576,0xad55ce39,0x9cf49cb3,0xa514a514,0xad55a514,0xa4f3b575,0xa513a4f3,0xad34a4f3,0xbdb6bd95,0xad34b575,0x9cd2a513,0x94929cb2,
-0x9cd39492,0x9492a514,0x84107bf0,0x84308430,0x84107bcf,0x8c727bf0,0x8c518c72,0x843094b2,0x84308c50,0x9471840f,0x8c718c71,0x9cf3a513,0x8c518c31,0x94729472,0x8c318c51,0x8c728411,0x8c528c72,0x94939492,0x84118431,0x84118411,0x94727bd0,0x94728c72,0x8c718c51,0x8c519492,0x8c309471,0x94718c50,0x94718c30,0x8c509470,0x94709470,0x8c509471,0x94918c30,0x840f9491,
-0xe6da9450,0x9c92ce38,0x83ef840f,0x8c718410,0x7bcf7bef,0x8c717bef,0x8c318c51,0x949283ef,0x8c308c31,0x7bef7bcf,0x84108410,0x738e7bae,0x8c5183ef,0x738e8430,0x73af6b6d,0x7bcf7bef,0x84107bae,0x7bcf8c30,0x83f08410,0x738e7bcf,0x73af738f,0x738e73ae,0x7bce738d,0x7bce7bef,0x8c307bce,0x83ef9471,0x7bae7bcf,0x7bce7bce,0x83ef736e,0x84308c30,0x94918c71,0x9cf39cb2,
-0x9cd3a514,0x8c518430,0x94729cb3,0x84107bf0,0x84108410,0x841083f0,0x738e7bef,0x8c518410,0x840f7bef,0x7bef7bef,0x84308410,0x7bef7bef,0x84108430,0x84308410,0x8c518410,0x9cf39492,0x8c509492,0x94929492,0x843094b2,0x8c518410,0x84109492,0x738e7bcf,0x7bef73ae,0x7bef7bef,0x7bcf7bcf,0x8c717bef,0x84108c51,0x8c718c51,0x8c729492,0x8c528c72,0x7bf08410,0x7bd07bf0,
-0x84108c71,0x8c519492,0x8c728410,0x94928c72,0x94929cd3,0x9cb29471,0xa5139c92,0x9cb2a4d2,0x94919cd2,0x8c308c30,0x94509471,0x83ef8c30,0x83ef7bae,0x738d83cf,0x94508c0f,0x94519471,0x94518c10,0x83cf8c10,0x94518c30,0x9cb28c30,0x9c919c91,0xb554b574,0x9cd2a4f3,0xb575b575,0xbd959cb2,0xa513b554,0xad13a4f2,0xad12d637,0xbd95a4d1,0xad33bd95,0xb5749cb1,0xa4f2c616,
-0x8c509cb1,0x9cd28c50,0xa513a4f3,0x9cf39cf3,0xa513a534,0xad54a534,0xb595ad55,0xad54b596,0xa514bdd7,0xc618b575,0xce18ffff,0x9471ad55,0x8c519471,0x94928c10,0xa4d39492,0xa4f3a4f3,0x83f09472,0x94518410,0x94519492,0xad35a4f4,0xad55a4f4,0xc639ce39,0xbdb7bdf8,0xa4f4ad35,0xad55a514,0xa513a513,0xa4f3ad34,0xad34ad13,0xbd95bd95,0xad54b575,0x94719cd2,0x94b29491,
-0x949294b2,0x8c719cd3,0x84108430,0x7bf073af,0x73af7bef,0x843173af,0x84108410,0x949294b2,0x8c508c50,0x84308c50,0x94918c71,0x9cf39491,0x84109cf3,0x94728c51,0x83f08c31,0x84118431,0x8c519492,0x8c528431,0x94728c52,0x8c529472,0x7bd08411,0x8c7294b3,0x8c728c51,0x8c519472,0xa4f39492,0x94719491,0x94718c30,0x9cb29cd2,0x8c508c50,0x8c308c30,0x94919cb2,0x83efa4f3,
-0xe6fba4f3,0x8c30bdd6,0x840f83ef,0x84108410,0x7bef8410,0x8c717bcf,0x84108c51,0x8c517bcf,0x7bcf8c31,0x7bcf83f0,0x94727bef,0x7bcf8410,0x7bcf7bef,0x84108430,0x73af6b6e,0x7bef8410,0x7bef8430,0x84107bcf,0x73af8431,0x73af736e,0x7baf738f,0x7baf7bcf,0x7bce738e,0x8430840f,0x7bae83ef,0x8c509471,0x7bcf83ef,0x84307bce,0x7bef8430,0x8c519491,0x94718c50,0x8c508c30,
-0x94b28c71,0x84108c30,0x8c318431,0x73ae7bcf,0x73af7baf,0x84107bcf,0x7bcf8410,0x94928c71,0x840f8410,0x84308c50,0x7bef7bef,0x7bef8410,0x7bcf8410,0x84107bcf,0x84308410,0x8c518430,0x94b29cd2,0x949294b2,0x8c719492,0x7bef7bef,0x8c5194b2,0x738e738e,0x7bcf73ae,0x7bef8430,0x7bcf73ae,0x84307bef,0x84108430,0x8c518430,0x9cd394b2,0x949294b3,0x84318c72,0x843183f0,
-0x94718c51,0x8c318c71,0x94728c71,0x8c518c51,0x9cd3a514,0x8c509451,0xa513a4f3,0xa4d2b554,0x94719cb2,0x94718c50,0x94719c91,0x8c508c50,0x83ef83ef,0x738d83cf,0x7bae7b8e,0x8c109451,0x9c9283f0,0x7baf9451,0x945183af,0x9c719c91,0x9cb29450,0xb574e6da,0xa513ad34,0xc5d79cb3,0x9491e6fb,0xbd959450,0xb554bd75,0xbd95d658,0xbd95ad33,0xbdb5c5f6,0xc5f6a4f2,0xb595bdb5,
-0x8c50ad34,0x94919471,0xa513a4f3,0x9cf3ad34,0xad759491,0xc638ad54,0xbdf7d679,0xc638ce59,0xad55ad55,0x9cb2a513,0xffdedeba,0x9cb2a513,0x8c309471,0x94719471,0x94929cd3,0xa4f39cb3,0x8c51a4d3,0x94718c10,0x8c51a4d3,0xa5149472,0xa514ad34,0xbdf8bdb7,0xc618ce59,0xa535b576,0xad55b575,0xad349cd3,0xa513ad34,0xad34a4f3,0xbd95ad13,0xad54b595,0x8c309cd2,0x9cd38c30,
-0x94b294b2,0x94918c71,0x8c5194b2,0x7bef7bef,0x73ae8410,0x843073ae,0x84308410,0x94928c71,0x84308c51,0x8c508c50,0x94918c71,0x94718c50,0xa51494b2,0x8c519492,0x8c518c51,0x94b38410,0x84318c72,0x84318410,0x9cd49493,0x8c5294b3,0x84318411,0x94928431,0x8c718c52,0x8c518c51,0x9cb29471,0x94919cd2,0x94919471,0x9cb18c30,0x8c0f8c50,0x8c309471,0x94918c30,0xa4f39cd3,
-0xd679a4d2,0x83efa4f3,0x84308410,0x7bcf8410,0x84108410,0x8c517bef,0x8c518c51,0x8c518c30,0x7baf8c31,0x84107bcf,0x84308c30,0x84308430,0x7bae8c30,0x841073ae,0x7bcf7bcf,0x7bcf7bef,0x7bcf738e,0x84307bcf,0x7bf08c31,0x738f7baf,0x7bcf7baf,0x7bae7bcf,0x7bef73ae,0x84308430,0x9471840f,0x94918430,0x84309491,0x8c718c51,0x7bef8430,0x8c718430,0x949294b2,0x840f9471,
-0x94928c51,0x94929492,0x8c308c71,0x73ae7baf,0x7bcf7baf,0x7bcf7bcf,0x84107bcf,0x84108c71,0x84308410,0x840f8430,0x7bef8410,0x7bcf7bef,0x84108410,0x84308430,0x84107bef,0x84308410,0x9cf39492,0x8c519cd3,0x8c517bef,0x8c518c51,0x843094b2,0x6b6d73ae,0x7bef73ae,0x7bce7bef,0x7bcf73ae,0x84107bcf,0x8c518c51,0x84318430,0x9cf49cd3,0x8c729cd3,0x8c518c72,0x84318431,
-0x8c718410,0x94929492,0x8c728c71,0x7bef9472,0x94719492,0x8c308c51,0xa4f39471,0xa4d29cb2,0x94719cd2,0x94508c30,0x8c309471,0x8c30840f,0x8c309471,0x7bce840f,0x83cf83ce,0x8c309451,0x83cf83ef,0x7baf83cf,0x8c107b8e,0x94719c92,0x9c919450,0xad34b595,0xb595ad14,0xbdb6ad14,0xad13bdd6,0x9cd283ef,0x9c91a4d2,0xd658c5b5,0xa4f2c5b5,0xc5f6b554,0xf75bad33,0xb595bdd5,
-0x9491b575,0x94918c30,0xa5139491,0xa534a513,0x9cd29cf3,0xce38bdd6,0xce59ce58,0xb5b6bdd7,0xad35b575,0xa4f3ad34,0xad349492,0xa513bdd6,0x94929cd3,0x9cb29492,0x9cd39cb3,0xa5149492,0xa4f3a4f3,0x8c108c51,0x94929472,0x94718c51,0xb596bdb6,0xad55a514,0xbdd7ce59,0xbdb7b596,0xad34b576,0xa4f3a4f3,0xb595ad54,0xb575b554,0xad54a513,0xad54b575,0x8c509cb2,0x94719471,
-0x94b19cf3,0x8c5194b2,0x94b29491,0x7bef8410,0x84307bef,0x84107bef,0x84307bef,0x8c508430,0x84309471,0x8c718430,0x8c719491,0x8c508c50,0x9cd38430,0x9492ad34,0x8c519492,0x94929472,0x8c529492,0x84108410,0x94938c52,0x94b39493,0x84318c72,0x84318431,0x8c519472,0x8c718410,0x9c928c51,0x94919471,0x94719cb2,0x8c508c30,0x94919cb2,0x8c508c0f,0x94919471,0x94719cb2,
-0xce38ad34,0x83ef9471,0x840f8410,0x84108410,0x8c518430,0x84308410,0x8c318410,0x8c519471,0x8c518410,0x94728c71,0x84109492,0x83ef83f0,0x84107bcf,0x7bcf8430,0x7bcf73af,0x7bcf7bef,0x8c31738e,0x7bcf83f0,0x84117bf0,0x738e8410,0x7bcf7baf,0x7bae7bef,0x83ef73ae,0x840f8430,0x9471840f,0x8c718c71,0x8c508c50,0x84108410,0x7bcf73ae,0x7bef738e,0x94b29491,0x8c309491,
-0x84108410,0x94928c51,0x84108c71,0x73af738e,0x83f083f0,0x738e7bcf,0x843073ae,0x7bcf9492,0x94917bef,0x8c509492,0x7bef8410,0x84307bef,0x84107bef,0x84308430,0x7bef7bcf,0x8c517bef,0x9cf394b2,0x8c7194b3,0x8c728431,0x8c518c71,0x84108c71,0x73ae8410,0x7bcf73ae,0x738e738e,0x73ae7bcf,0x6b6d738e,0x7bef73ae,0x8c518430,0x94928c72,0x9cf39cd3,0x949294b3,0x84319472,
-0x94728410,0x94929cd3,0x94929492,0x8c518410,0x94928c51,0x94919451,0x94919471,0x9cb19cb2,0x9471a4d2,0x8c30840f,0x8c509471,0x840f840f,0x83ef840f,0x7bce83ef,0x7bae7bae,0x7b8e7b8e,0x83cf8c51,0x7baf7bae,0x94518c10,0xa4f39471,0x83ef9cb2,0xbd96a4f3,0xc5f79471,0xa4f3ef1c,0xa4f39cb2,0x94509cb2,0xad139cb2,0xacf3cdf7,0xb534bd95,0xb554a4f2,0xf79db554,0x9cd2b574,
-0x9c92ad54,0x8c509471,0x9cd29cd2,0xad55a534,0x9cd29cf3,0xad7594b2,0xc617bdf7,0xad54c618,0xbdf7b575,0x9cd2a514,0x94b29cd2,0xad759cf3,0x9cf3a514,0x94b29cd2,0x9cd39cb3,0x9cd39492,0xb555b555,0x9451a4f3,0x9c928c51,0x94919cb2,0xbdd7ad34,0xad55b575,0xc618c618,0xbdd7bdf7,0xb576b596,0xad34b595,0xc5d7b575,0xbdd6bdd6,0xb575b575,0x9cd2a513,0x9cb2a4f3,0x94719471,
-0x9cd29cd2,0x94719491,0x8c718c71,0x8c309492,0x84307bce,0x94719491,0x84307bcf,0x840f840f,0x94b29491,0x8c308c50,0x8c509471,0x8c50840f,0x94718c50,0xa5349cd3,0x8c728c71,0x94929492,0x8c729492,0x84318c31,0x84318431,0x94b38c72,0x8c529cf4,0x94728c51,0x94729492,0x94929492,0x94918c30,0x9cb29c92,0x9cb29cd2,0x94509cb2,0x9c919491,0x94519c92,0x8c309471,0x94719c92,
-0xc618bdb6,0x84109451,0x83ef8c30,0x841083ef,0x949294b2,0x84308430,0x7baf7bef,0x8c308410,0x841083ef,0x947194b2,0x8c519492,0x8c317bef,0x7bcf7baf,0x84108c51,0x73ae83ef,0x7bf07bf0,0x8c5173af,0x7bf083f0,0x84107bf0,0x7baf8410,0x73af736e,0x7bcf7bcf,0x73ae73ae,0x7bef7bce,0x84308c30,0x9cf394b2,0x7bae83ef,0x73af7bef,0x7bcf7bf0,0x7bcf7bcf,0x9cd28c50,0x9cf394b2,
-0x8c518c51,0x8c518c71,0x84108410,0x73ae73ae,0x73ae7bcf,0x73ae738e,0x7bef73ae,0x7bcf8430,0x8c518430,0x8c519492,0x7bef7bef,0x7bef8410,0x73af73af,0x7bcf7bcf,0x84107bcf,0x8c518430,0x8c519492,0x8c518431,0x8c519492,0x84308431,0x8c518410,0x7bf08410,0x6b6d73ae,0x738d73ae,0x738e738e,0x73ae73ae,0x73ae738e,0x7bef7bef,0x84308410,0x9cf494b3,0x8c5194b2,0x8c528c51,
-0x8c318c51,0x9cd394b2,0x94729492,0x8c308c51,0x8c308c31,0x8c309492,0x94719471,0x9c919471,0x8c509471,0x840f840f,0x8c308c30,0x840f840f,0x8c30840f,0x7b8e840f,0x7bae7b8d,0x734d732d,0x8c108c10,0x7baf83ef,0x9c728c31,0x9c919451,0x9450a4f3,0xdebabdb6,0xc6189471,0xbdb6ce18,0x9cb2a4f3,0xb5549c92,0xbd95ad34,0xb554ad13,0xad13ad33,0x9cb1acf3,0xd678ad33,0xa4f2a4f2,
-0x9cd29cd2,0x9cb29471,0xa5139cd2,0xa5349cd2,0x9cd29cf3,0x94918c71,0xbdf7ad75,0xbdd7bdf7,0xa534b596,0xad75ad75,0x94b2a534,0xa4f394b2,0xa4f3a513,0x8c719cf3,0x94b294b2,0x8c5194b2,0xad14a514,0x9471ad34,0x84108c51,0x9cb29471,0xb5769492,0xad75bdd7,0xbdf7ad75,0xbdd7bdf8,0xbdd7b596,0xb595bdd7,0xb595b595,0xbdb6c5f7,0xad54c5d6,0x9cb29cd2,0x94719491,0x9cd29cb2,
-0x947194b2,0x94919cd2,0x94918c50,0x9cf394b2,0x73ae8c30,0x94b28430,0x7bce7bef,0x840f840f,0x9cd294b2,0x9491a4f3,0x8c308c50,0x84307bef,0x94919491,0x9cd39cd2,0x8c519cf3,0x94928c72,0x8c518c72,0x8c728c52,0x84318c52,0x8c728c51,0x9cd39cd4,0x9cd38411,0x8c7194b3,0x94929492,0x94519471,0x9cb2a4d3,0x9cd29cb2,0x9cb29cb2,0x94719cb2,0x8c309491,0x94918c50,0xa5149cb2,
-0xbdd7c5f7,0x8c519472,0x8c309492,0x7bcf8410,0x8c718c51,0x8c518c51,0x7baf7bef,0x83ef83ef,0x7bcf8410,0x9cb38c71,0x84109492,0x7bef7bcf,0x7bcf8c31,0x7bcf73ae,0x84108c71,0x84107bef,0x8430738e,0x8c518c31,0x7bf08431,0x841183f0,0x736e738e,0x7bef73ae,0x73ae7bcf,0x7bce7bae,0x84108410,0x94918410,0x738e7bef,0x73ae7bf0,0x73af7bcf,0x84107bcf,0x8c508410,0x9cf394b2,
-0x949294b2,0x8c719492,0x84108430,0x7baf7bae,0x73ae738e,0x83ef7bcf,0x7bef7bcf,0x7bcf7bef,0x84308430,0x7bef8410,0x84308410,0x73ae7bf0,0x7bcf73af,0x7bef7bcf,0x84307bcf,0x8c518430,0x7baf83f0,0x738f738e,0x84318431,0x84318c51,0x84108431,0x73ae7bcf,0x73ae73ae,0x6b6d738e,0x738e7bcf,0x73ae73ae,0x7bef73ae,0x7bcf7bef,0x8c517bef,0x8c518c71,0x8c518c51,0x8c528c51,
-0x94928c71,0x9cd39492,0x94b29cd3,0x8c309492,0x94718c31,0x94518c30,0x94918c30,0x9c919cb2,0x94919cb2,0x8c309450,0x83ef840f,0x94508c0f,0x94719471,0x736d840f,0x7bae7bae,0x736d736d,0x8c308410,0x94518c51,0x94519451,0x9c929471,0x9cb29cb2,0x94919491,0xb596b575,0xa4f39cb2,0xa4f3ad34,0xa4f38c10,0xb575bdb6,0xcdf7ad34,0xa4d2c5d6,0xb554b554,0xa4d29cb2,0x9cb29491,
-0x9cb29cb2,0x9cd29cb2,0x9cd2ad34,0x94919491,0x9cd3ad34,0x9471a4f3,0xa5348c71,0xad75ad55,0xad75ad75,0xad54b575,0xad55b575,0x8c509492,0xa5149cb2,0x94929cd2,0x94928430,0x94b29cb2,0x9cd39cb2,0x9cd3a4f3,0x9cb2a4f3,0x94728c31,0xa5349cd3,0xb5b6ad75,0xad35ad55,0xc618ad55,0xbdb6bdb7,0xb596b596,0xb575b596,0xbdb6bdd6,0xad55b596,0x94919cd2,0x8c519492,0xa5139492,
-0x94b294b2,0x94919491,0x84308c50,0x8c718c71,0x8430ad34,0x8c517bef,0x840f8410,0x94b29491,0x94929492,0xa534a534,0x8c309492,0x840f8410,0x8c718430,0x9cf39492,0x94b39cd3,0x84318c72,0x8c519492,0x84318431,0x84318431,0x8c528c52,0x9cd394b3,0x94b3a514,0x9cf3a514,0x9cd39492,0x9cb29cd3,0x94919471,0x8c509491,0x9cd29cd2,0x9cd29cb2,0x9cb28c50,0x94719492,0xa4f4a4d3,
-0xb575ce38,0x94519451,0x8c519cb3,0x84308c51,0x8c3083f0,0x8c319492,0x840f83ef,0x7bce83ef,0x841083ef,0x84308410,0x8c3083f0,0x9cd39cb3,0x84108410,0x738e73ae,0x8c518410,0x84108410,0x8c517bef,0x8c519492,0x7bcf8410,0x8c317bf0,0x7bcf8410,0x7bcf7bae,0x7bef7bef,0x8410840f,0x84108c51,0x7bef8430,0x94928c51,0x7bf07bf0,0x7bef7bcf,0x8c517bcf,0x8c318c30,0x9cf39cf3,
-0x84309492,0x841083f0,0x84108410,0x7bcf738e,0x7bcf738d,0x84308410,0x84307bef,0x84308430,0x8c507bef,0x7bef8430,0x84308430,0x7bf07bf0,0x7bf073af,0x84108431,0x7bcf73af,0x84107bef,0x7bcf7bf0,0x736e6b4e,0x8c728411,0x7bf08c52,0x7bcf8c51,0x6b6d73ae,0x7bcf738e,0x6b6d738e,0x738d738e,0x7bcf73ae,0x84308410,0x73ae7bcf,0x84307bef,0x84108410,0x9cd39492,0x8c5194b2,
-0x94929492,0x9cd3a514,0x9cf39492,0x94929cd3,0x94719471,0x8c109471,0x94918c10,0x9471a4d2,0x8c308c50,0x94718c30,0x840f9471,0x9471840f,0x8c308c50,0x7bae7bce,0x7bae8c10,0x734d7b8e,0x947183cf,0x9c929c92,0x8c519451,0xa4f49cd3,0x8c509492,0xad14ad54,0x8c30b575,0xb555a514,0xad549471,0x9c91a4f3,0xce18bd96,0xb554a4d2,0xbd75c5d6,0xc5d6ad13,0x8c50b575,0x9cd29471,
-0x94919cd2,0xa5139cb2,0x9cd2ad34,0x8c508c50,0xa5138c71,0x8c508c71,0x94918c71,0xb596ad55,0xb575ad75,0xa534a534,0xa5139cd3,0x9cb2b5b6,0xa5139492,0xa4f3ad54,0x84108c71,0x94929492,0x94929492,0xb5759cb2,0xc5f7ad55,0x84109cd3,0xb5769492,0xbdd7ad55,0xad35b596,0xb5b7ad35,0xbdd7d69a,0xc5f7bdb6,0xbdd7bdd7,0xc5f7bdb6,0xad34b575,0x94929cd2,0x94719491,0x94719471,
-0x94b194b2,0x8c508c71,0x8c509471,0x84108410,0x9cd29cd2,0x7bae8430,0x8c51840f,0x8c319491,0x94928c51,0xad5594b2,0x8c50a514,0x94718c71,0x8c718c51,0x8c718430,0x9cf39cf3,0x94729cd3,0x84108c71,0x84118410,0x8c518411,0x84318c52,0x94937bf0,0x9cb39cf4,0xa4f49492,0x8c519cb3,0x9c929cb2,0x94719cb2,0x9cb29cb2,0x9cb29cb2,0x94919cd2,0x9cb29cb2,0x94719cd3,0xad359cd3,
-0x8c51b555,0x8c517bcf,0x94729cf3,0x94729492,0x94929492,0x8c719cb3,0x84308430,0x83ef8410,0x84107bef,0x8c518c51,0x8c518c30,0x9cd38410,0x7bae8430,0x8410738e,0x84107bef,0x8c518430,0x8c318410,0x8c519472,0x83f08c51,0x7bcf7baf,0x84108430,0x738e7bcf,0x7bcf738e,0x84308430,0x84108c31,0x83f083f0,0x94929492,0x73ae8410,0x84108410,0x7bcf73af,0x94928410,0x9cf394b2,
-0x9492ad55,0x83ef83f0,0x8c518430,0x84107bcf,0x7bcf7bce,0x84307bef,0x84107bef,0x84307bef,0x8410840f,0x84108430,0x84307bef,0x7bcf8430,0x84107bcf,0x84318c51,0x73af73ae,0x7bef73af,0x7baf7bcf,0x7bd06b6e,0x84118410,0x8c728431,0x84108410,0x7bcf7bcf,0x738e73ae,0x73ae73ae,0x7bcf73ae,0x7bef7bef,0x84308430,0x84307bef,0x7bef8c71,0x84107bcf,0x94928c51,0x8c719492,
-0x94928c71,0xa514a4f3,0x949294b2,0x94929cd3,0x94719cb2,0x8c308c30,0x94718c30,0x94719c92,0x83ef83ef,0x83ef8c0f,0x94718c30,0x7bce840f,0x8c3083ef,0x738d7bce,0x94718c30,0x83cf83cf,0x83cf7bcf,0x94929471,0xa4d39472,0xad149cb3,0x9471ad35,0xbdb69cb2,0x8c309c92,0xa4f39c92,0xa4f3ad55,0x9cb2ad34,0xe6baad14,0xad13bd95,0xb554ad34,0xad13b534,0xb575c5d6,0x9cb19cb1,
-0x9cd29cd2,0xb5559471,0xc617ce58,0x9cf3b5b6,0x9cd29cb2,0x8c509cf3,0xa51494b2,0xb595a514,0xc618ce79,0xa534a534,0xad54a513,0xa513a534,0xa4f39cf3,0xa4f39cf3,0x9cb394b2,0x8c519472,0x9cb29cb2,0xad559cb3,0xbdb7bdd7,0x8c72a4f4,0xa4f49492,0xad76b596,0xb596ad55,0xad55ad55,0xe6fbc5f7,0xbdb6c618,0xbdb6c618,0xbdb6ce38,0xa4f3ad34,0xa4f39cd3,0x94719cd3,0x94928c51,
-0xa4f39492,0x8c519491,0x94719471,0x84108c30,0x947183ef,0x83f09cd3,0x947283ef,0x94719cb3,0x94728430,0x9cd38c51,0xa4f3b576,0x8c5194b2,0x8c719492,0x8c728c72,0x9cf49cb3,0x9cf49cd4,0x8c719492,0x84108431,0x84318431,0x8c3183f0,0x7bd08411,0x9cb38411,0x9cd3a514,0x9cf3a4f4,0x94929cb3,0xa4f3a4f3,0x9cb29cd2,0xa513a513,0xa4f39cb2,0x94719cb2,0xad349cb2,0xad55c5f8,
-0x8c318c51,0xad359cb3,0x9cd3a514,0x8c319492,0x94929492,0x947194b2,0x8c518430,0x84307bef,0x8c518410,0x83f08c71,0x7bcf83f0,0x7bae7bcf,0x84308430,0x73ae7bcf,0x84307baf,0x8c318430,0x84318c51,0x843194b2,0x84107bef,0x73af738e,0x84107bef,0x7bef83f0,0x7bef7bae,0x8c719492,0x84108431,0x73af8c51,0x7bd07bcf,0x84108411,0x7bcf73af,0x7bcf7bef,0x7bef7bcf,0x94928c51,
-0xa4f49cd3,0x8c719492,0x8c30840f,0x84108430,0x73ae7bef,0x840f73ae,0x84108c51,0x738e73ae,0x84307bef,0x84308c51,0x84318410,0x7bf08410,0x84107bef,0x94929492,0x84318c72,0x73af7bef,0x73af73af,0x7bd073af,0x8c318410,0x8c728c52,0x7bf07bf0,0x73af7bef,0x73ae738e,0x7bcf73ae,0x7bcf7bce,0x7bef7bef,0x8c71840f,0x9cb38c31,0x7bef9cf3,0x83ef8410,0x84108c31,0x8c518431,
-0x94b29492,0x94929492,0x9cb29cb2,0x9cf39cd3,0x8c309cb2,0x8c508c50,0x94719c92,0x9c919cb2,0x8c0f8c30,0x840f83ef,0x94718c30,0x9cd29cb2,0x8c0f8c30,0x7bae7bae,0xa4d283ce,0xa4d3bd96,0x8c518c30,0x9cd39c92,0x94729492,0x9c929451,0xa4f4ad14,0xa4f3ad34,0x9451ad35,0x94518c51,0xa4d39492,0xb554ad13,0xc5d6a4d3,0xb554bdb6,0xa4d2a4d2,0xad13ad13,0xa513ad13,0x9491a513,
-0x9cd29cd2,0xad54ad34,0xce38b595,0xb575c638,0xa5139cf3,0x9cd39cf3,0xad75a513,0xad54b595,0xb5b6ce58,0x9cd2ad75,0x9cf39492,0x9cf3a4f3,0x94b2ad54,0x94719492,0x9cb394b2,0x8c519cd3,0x94929492,0xa4f39492,0xb555a514,0x9cf4a514,0x8c729492,0xa5149cd3,0xa5149492,0xb576ad35,0xc618ad14,0xce39e6fb,0xc5f7bdb6,0xbdb6bdb6,0x9cd39cd3,0xa4f39cd3,0xa4f3a514,0x94719cb2,
-0x94719491,0x9cb29cb2,0x8c309492,0x8c519471,0x94929471,0x94929cd3,0x84108410,0x94728410,0x8c319492,0xad559cf4,0xc618ad55,0x8c30ad55,0x8c518c51,0x94b294b3,0x8c728c51,0x949294b3,0x8c5194b3,0x8c518c51,0x8c528431,0x84318c72,0x84118c52,0x94b38c51,0x9cf4a514,0x9cb39cd3,0x9cb29cb3,0x9cb28c51,0x94919cb2,0xa4f39cd2,0xa4f39c92,0xb575ad34,0xa4d3a4f3,0x94729cb3,
-0x9cb3a514,0xad35a4f4,0x9cd3a514,0x8c519492,0x8c7194b2,0x8c519491,0x8c508430,0x8c508430,0x8c518c30,0x84107bcf,0x84109472,0x7bcf7bae,0x73ae7bcf,0x84307bef,0x84107bcf,0x8c318c51,0x8c318431,0x84108c51,0x841083f0,0x73af7bef,0x7bcf7bcf,0x7bcf8410,0x7bef7bcf,0x8c5183ef,0x73af8431,0x7bef73af,0x7bd07bf0,0x7bf07bcf,0x7bd08431,0x73ae7bcf,0x8c517bef,0x83ef83ef,
-0xa5348c51,0xa534ad35,0x8c308c71,0x9cd38c71,0x7bcf8c71,0x7bcf73ae,0x7bcf7bcf,0x7bef8410,0x84308410,0x84108c51,0x7bcf7bcf,0x738e73ae,0x7bcf7bcf,0x8c728431,0x8c519492,0x73af8410,0x73af7baf,0x738f738f,0x7baf73af,0x7bd07bcf,0x841083f0,0x7bcf7bf0,0x7bef7bcf,0x738e7bcf,0x7bef7bce,0x7bcf7bcf,0x8c71840f,0x8c518c30,0x7bcf8c51,0x83f08430,0x7bef83f0,0x73af7bcf,
-0x9cb39cd3,0x94929492,0xa5139cd3,0x8c719cf3,0x9492a4f3,0x94719491,0x8c508c30,0xa4d29450,0x94719491,0x8c30840f,0x8c508c50,0x9cd29cb2,0x8c3083ce,0x7bce8c30,0xa4f383ef,0xb555b575,0xa4f3a4d3,0x94719cb3,0x8c3183f0,0x9cb39493,0xb5759472,0xbdb7ffff,0xa4f39cb2,0x8c319472,0xa4d39471,0xa4f3ad14,0xad14c5b6,0xbd95bdb6,0xad13bd95,0xb575ad13,0xa513bdb5,0xb554ad54,
-0x9cb29cb2,0xb555ad54,0xad55ad54,0xad54a534,0x9cd2a513,0x9cd39cf3,0x9cd39cf3,0xad55b575,0xa5349cf3,0x9cf3a534,0x840f9471,0x9cb29cb2,0xa534a534,0x94718c51,0x94929471,0x9cd394b3,0x94929cb3,0x949294b3,0x9cd39cd3,0xa4f49cd3,0x94b39cd3,0x8c7294b3,0x9cb394b3,0xad769cd4,0xb576ad35,0xdedbbdd7,0xb575c618,0xad75b5b6,0xa514a514,0x94929cb2,0xad34a4f3,0x8c519cd3,
-0x9cb29492,0x9cb29492,0x94929471,0x9cd39472,0xa514ad14,0x9492bdb7,0x83f08c31,0x94728c10,0x9cb38c72,0xb5b79cd3,0xb596ad56,0xad76ce59,0x94928c51,0x8c518c72,0x84318c51,0x9cd38c52,0x9cf494b3,0x8c518c51,0x84118c51,0x94929492,0x84118411,0x94729472,0x9cb394b3,0x9cd39cb3,0xa514a4f4,0x94719cb2,0xa4d39471,0xa4f39cd2,0xa4f3ad54,0x9cb2a4d3,0x83f08c30,0x94727bcf,
-0x84319c92,0x8c718c51,0x84108410,0x840f8410,0x84309492,0x84108410,0x8c718c30,0x94919492,0x8c517bae,0x7bef7bcf,0x7bcf8410,0x7bcf73ae,0x84108c51,0x94928c51,0x7bef8430,0x84308c51,0x7bf07baf,0x94b38c31,0x83f09472,0x84108410,0x8c5183f0,0x73af7baf,0x738e7bcf,0x83f07bcf,0x83f083f0,0x8c518410,0x7bcf7bcf,0x8c517bcf,0x949394b3,0x73ae73ae,0x736e7bcf,0x7bcf7bcf,
-0x9cb28430,0x8c519491,0x84308410,0x94718430,0x83ef94b2,0x83ef7bce,0x7bef7bef,0x84108410,0x84308430,0x84308c71,0x7bcf7bcf,0x738e73ae,0x73af6b6d,0x7bef7bf0,0x7bcf7bcf,0x7bef8410,0x73af73af,0x738f73af,0x6b4e738e,0x6b4d6b4d,0x7bcf73af,0x738e73af,0x841073ae,0x738e7bef,0x840f7bcf,0x840f7bef,0x84308430,0x840f8410,0x7bef8410,0x7bcf8410,0x73ae738e,0x7bcf7baf,
-0x9cf3a514,0x94929cb3,0xa51394b2,0x8c71a514,0xad349cb2,0x94919471,0x8c50840f,0x8c309471,0x9cb2ad13,0x83ef8c30,0x7bce83ef,0x840f83ef,0x8c0f9471,0x8c30840f,0xad13a4d3,0x9cb29c92,0x9cb2b575,0x94728c51,0x94729472,0xa5149cd3,0xd6599452,0xc618ef1c,0x94929472,0x9c929cd3,0x9cd29cb2,0xad139c91,0xc5b6a4f3,0xad13bdb6,0xb534b554,0xad139450,0xc5d6bd95,0xa4f2ad13,
-0x9cd2ad34,0xbdb6ad34,0x9cd3ad55,0xa5139cf3,0x94b2a534,0xa5139cb2,0xa5139cb2,0xa5149cf3,0x9cd29cd3,0xad34a513,0x94719cd2,0x947194b2,0x9cf39cf3,0x841094b2,0x94728c31,0x9cb38430,0x9cb294b2,0x9cd39492,0xa53494b2,0xa5149cd3,0x9cd39cf4,0x94929492,0x9cd38c31,0x94929492,0xb596b576,0xc618b575,0xc618e71c,0xa4f4ad75,0xad35ad55,0x94929cd3,0xad35a4f3,0x9cb2a4f4,
-0x94719471,0x94719cb2,0x94928c51,0x94929cb3,0xa514bdb7,0x94729cb3,0xa4f49c92,0x8c319492,0x8c529493,0xad56ad35,0xad56ad55,0xbdf7b596,0x8c729cd3,0x94928c51,0x8c519492,0x84318c52,0x9492a514,0x94b39cd3,0x8c528c52,0x8c518c72,0x84318c52,0x84318c52,0x94b39492,0x94b39472,0xb596a4f4,0x9cd3ad34,0x9c929cb2,0xa4f3ad34,0x8c50a513,0x83cf8c30,0x83cf83ef,0x9cb383f0,
-0x8c71a514,0x8c308c51,0x84108410,0x7bcf8410,0x94928430,0x8c5194b2,0x738d7bef,0x83ef7bcf,0x8c5183ef,0x83ef8430,0x84107bcf,0x83ef8410,0x84308c31,0x8c3083f0,0x8c308c71,0x8c519471,0x84107baf,0x94728c31,0x94729492,0x84109492,0x84318410,0x6b6e7bcf,0x7bcf73ae,0x7bcf7baf,0x7bcf73af,0x83f07bcf,0x7bf073af,0x8c518410,0x8c729472,0x6b6e7bef,0x7bef7baf,0x84107bef,
-0x8c517bef,0x7bce840f,0x840f7bce,0x840f83ef,0x840f83ef,0x7bce7bef,0x8c508430,0x7bef8410,0x84308430,0x84308c71,0x84107bef,0x7bcf8410,0x7bef738e,0x7bf08410,0x7bf07bf0,0x84108c51,0x7bd07bcf,0x73af7bcf,0x6b6e738e,0x6b4d6b6e,0x73af6b6e,0x7bcf7bcf,0x84107bcf,0x7bcf8410,0x7bef7bce,0x84307bef,0x8c518c51,0x8c308c30,0x84108410,0x8c718c51,0x84108410,0x8c518410,
-0x9cf39471,0x94b29cd3,0x9cf39cd3,0x9cf39cf3,0xa5139471,0x9471ad54,0x83ef83ef,0x94518c30,0x8c509471,0x83ef8c30,0x840f83ef,0x83ef83ef,0x9471840f,0x7bce7bce,0xad34a4d2,0xa4b3ad14,0x9c92a4d3,0xad14a4f4,0x94729cd3,0x94b38c52,0xef5dad76,0xa4f48c10,0x9451a4f4,0xad149492,0x8c3083cf,0x9c919cb2,0xce38a4f3,0xb534e6ba,0xb554ad34,0xa4f3b575,0xc5f6b554,0x9470b595,
-0xa4f39491,0xad34ad13,0xad74b575,0x9cd2a513,0x9cb29cd2,0x94919cf3,0x9cd29cd2,0x9cd29cf3,0x9491a513,0x9cd38c50,0x9cb29cb2,0x9471ad34,0xad349cd3,0xad55a4f3,0x9cb39492,0x9cb39472,0x9cf3a4f3,0x9492a4f4,0x9cd39cb3,0x9cb39cb3,0x9cd39cf4,0x94729cd3,0x94929472,0x84109472,0xad559492,0xbdb7ad35,0xe71cc5f8,0xa514c638,0xad55a534,0x9cf4a535,0xa4f49cf3,0x9cb29cd3,
-0x84309cd3,0x8c509491,0x8c507bce,0x9cb2a4f3,0x9cd38c71,0x8c519472,0x9cf39472,0x9492ad55,0x84318c51,0xb596a4f4,0xa514ad55,0x9cd3ad75,0x94b2a514,0x8c518c51,0x8c518c51,0x94929492,0x94b39492,0xa535a535,0x7bd08c72,0x94728c52,0x8c529493,0x8c319472,0x94929472,0x9cf49492,0xa514a514,0xb575b575,0x9cd2a4f3,0xad54a4f3,0x84108c30,0x84108c30,0x94929472,0x9cb39472,
-0x8c7194b2,0x8c719492,0x84308410,0x7bcf8430,0x9cb29cd2,0x73ae8410,0x84308430,0x84108c31,0x8c518c30,0x84109471,0x83ef8410,0x843083ef,0x84108410,0x843083ef,0x94719492,0x7bcf8c71,0x843083f0,0x8c518c51,0x8c318c31,0x84108c51,0x7bcf7bcf,0x73ae7bcf,0x7bcf73ae,0x7bcf7bef,0x7baf7bf0,0x7bcf738f,0x738e73af,0x73af738e,0x7bcf73af,0x8c518430,0x84108c71,0x83ef73ae,
-0x84307bcf,0x7bcf840f,0x840f7bef,0x9491842f,0x84309471,0x8c71840f,0x73ae8c71,0x8410738e,0x8c508410,0x84308c51,0x84308410,0x7bef8431,0x73af7bcf,0x84107bcf,0x73af8410,0x84107bf0,0x7bf08410,0x6b6e73af,0x7bef738e,0x73ae7bef,0x738e6b6e,0x84307bef,0x7bef8430,0x7bef7bef,0x7bce8410,0x7bef7bef,0x94918c50,0x84308430,0x8410840f,0x94928c51,0x84308c51,0x8c518410,
-0x9cb39492,0x9cf39cd2,0x9cd3a513,0x94b294b2,0x9491a4f3,0x9cd29cb2,0x94719cb2,0x945183ef,0x83ef7bce,0x8c509471,0x8c508c30,0x8c308c30,0x8c507bae,0x8c309491,0xad348c0f,0xad14c5d7,0x9c929cb2,0x9cb3a4d3,0x9cd39cd4,0x7bd08c31,0xce7adedb,0xad5583f0,0x8c51ad35,0x9cb39472,0x9cd2ad34,0xad139cb2,0xb555b575,0xde79de79,0xa4d2ad34,0xb574b554,0xb554ad33,0xad54b574,
-0xa5139471,0xad13b575,0xc5f7b575,0x9cd2ad54,0xa5139491,0x9cd29491,0x94b29491,0xa5139cd2,0x8c50a4f3,0x840f9471,0xad549cb2,0xad54a514,0x9cd2a4f3,0xbdd7ad35,0x8c51bdd7,0x94929472,0xa5348c51,0x9492a4f4,0xa5348c51,0x9cd3a514,0xad559cf4,0x9cf39cf4,0x9cd39cb3,0x94728c51,0xa4f49c92,0xa4f494b3,0xb5b7a535,0xbdf7defb,0xad559cd3,0xa535b576,0x94929cd3,0x94929492,
-0x8c509cb2,0x9cd29491,0x8430840f,0x9cd39492,0x7bf08c51,0x8c518c51,0x94b29cb3,0xad75a514,0x8c3194b3,0xa5149472,0xad559cf4,0x9492a534,0x9cf38c72,0x94929cd3,0x8c729492,0x9cf49492,0x94b29cd3,0x94b3a514,0x94729cd3,0x8c728411,0x8c528c52,0x947294b3,0x8c528c72,0xad3594b3,0xb575b576,0xbdb7ad34,0x8c309cd2,0x8c508c30,0x8c518410,0x8c308c50,0x9cd38c51,0x9cf49cd3,
-0x8c519492,0x84108c51,0x84107bcf,0x94919471,0x8c718430,0x7bce7bef,0x84308430,0x7bef8410,0x8c518410,0x83ef9492,0x7bcf8410,0x8410738e,0x84308430,0x8c718c31,0x8c518c71,0x738e8c51,0x7bef73ae,0xa5149492,0x8c319cd3,0x843183f0,0x7bcf7baf,0x7bcf738e,0x736e73ae,0x7bf08410,0x6b6d6b4d,0x7bd073af,0x738f7bd0,0x7bd07bcf,0x738e73af,0x8431738e,0x94719cd3,0x6b6d7bce,
-0x7baf738e,0x7bcf7bcf,0x7bce7bce,0x94b2840f,0x94919491,0x94719491,0x73ae840f,0x7bcf73ae,0x8c507bef,0x84308c51,0x84108410,0x7bef8410,0x73ae7bcf,0x7bcf73af,0x73ae7bcf,0x7bef7bcf,0x7bcf7bef,0x6b4d6b6e,0x841073ae,0x73ae8410,0x738e738e,0x841073af,0x7bcf8410,0x7bef7bcf,0x840f8c50,0x7bce8430,0x84307bef,0x7bcf7bef,0x8410840f,0x84108410,0x7bcf7bcf,0x7bcf7baf,
-0x9cb39cf3,0x94b29492,0x94b294b2,0x94919cd2,0x94719471,0xb555840f,0x9451b575,0x94719450,0x8c508c30,0x94719471,0x83ef8c30,0x8c0f83ef,0x736d9471,0x9c928c30,0x9c928c10,0x9471a4d3,0x94519471,0x94518c51,0x94729cb3,0x8c528c52,0x9cd3ce39,0xc5f89492,0x83f0ad55,0x8c319cd3,0x94919cb2,0xa4d29471,0xacf39cb2,0xbd95ce38,0xacf3c5d6,0xb554a4f3,0xa4d2bd95,0xa4f29cb1,
-0x9cd2ad34,0xad54ad34,0xad54a513,0x9cf3ad75,0x9cd29cb2,0x9cd29491,0x94719cd2,0x94919491,0x94719cb2,0x94518c30,0xa4d39cd2,0xb595ad34,0x9cb2bdb6,0xb575ad55,0xb576bdb7,0x94929492,0xad34a514,0xa513a513,0x94919cd3,0x9cd39cd2,0xa4f39cf3,0xad34a534,0x9cd3a4f4,0x8c5194b2,0xa514ad35,0x94928c51,0x9cd3a534,0xce7ab596,0xa514a535,0xa534ad35,0x94929cb3,0x9cb29cb2,
-0x9cd29491,0x8c509cb2,0x7bef8c71,0x9cd38c51,0x8c309492,0x8c718c71,0xa5148c71,0xb576a4f4,0x9cd4b597,0x8c518c51,0xa5359cd3,0x94929492,0x949294b2,0x9cf39cf3,0x8c518c71,0x94929492,0x8c529492,0x9cf49cd3,0x94939cf4,0x8c319cb3,0x8c528c72,0x94938c72,0x94929493,0x94b394b3,0xb576b555,0xad55ad35,0x9cd39cb2,0x8c519471,0x8c30840f,0x8c308c31,0x9cb38c31,0xa5149cd3,
-0x84309492,0x94918c51,0x94919471,0x83ef8c50,0x840f7bef,0x84108410,0x83f083ef,0x8c518430,0x9cd38c51,0x8c309cb2,0x8c308c51,0x7bcf73ae,0x7bef7bcf,0x8c308410,0x8c308430,0x84108c30,0x841073ae,0xa5349cb3,0x9cf4a535,0x7bf09472,0x6b6e7baf,0x73ae73af,0x73ae736e,0x7bd07baf,0x736e6b2d,0x73af738f,0x7baf7baf,0x6b6e7bcf,0x738e6b4d,0x6b6d7bcf,0x94927bcf,0x7bef8430,
-0x7bcf738e,0x7bef8410,0x73ae7bce,0x842f73ae,0x840f840f,0x84308430,0x7bcf840f,0x7bef7bcf,0x8c517bef,0x84308c50,0x7bef8430,0x7bcf7bcf,0x6b6d738e,0x738e738e,0x7bcf7bcf,0x6b6d73ae,0x6b6d738e,0x6b6d6b6d,0x7bcf73ae,0x6b6e73af,0x738e73af,0x7bcf73ae,0x7bef7bef,0x840f7bef,0x7bef83ef,0x840f8430,0x7bef840f,0x7bef7bef,0x84107bcf,0x84108410,0x7bcf7bcf,0x7baf7baf,
-0x9cd28c51,0x8c719492,0x9cb294b2,0x94b294b2,0x9491a4f3,0x94719cb2,0x9c919cd2,0x9c919450,0x94719450,0x94918c50,0x7bce8c50,0x83ce7bce,0x8c508c30,0x840f736d,0x9cd2b575,0x9cd383ef,0x94929451,0x94729472,0x94729cd4,0x84118c32,0x8c518410,0x94729cd3,0x8c31a514,0xa4d3ad14,0xa4f39cd2,0x8c308c30,0xad149471,0xcdf7cdf7,0xbdb6b534,0xbdb5b534,0xc5d6b574,0x9491ad33,
-0xad34a513,0xa5139491,0xa513bdd6,0xad759cd2,0x9cd29cd2,0x949194b2,0x8c308430,0x8c518430,0x8c519471,0xbdd79cd3,0x94719492,0xd699c5f7,0xbdd7c5f7,0x9cd3b575,0xbdd7a4f3,0x9cd3d659,0xc618b596,0x9cf3ad55,0x94b29492,0x94729cd3,0xa4f49472,0xad55a514,0xa534ad55,0x8c319472,0x94929472,0x9cb39492,0xa534a514,0xad55ad55,0xa514bdd7,0xa5149cd3,0x8c519cb3,0x94719471,
-0xad348c50,0x9491a4f3,0x8c718c71,0x8c718c51,0x94b29cb3,0x94718c51,0x94b29cd3,0xa514ad55,0xad55ad75,0x8c71a4f4,0x949294b3,0x8c718c51,0x84308c51,0x9cd38c72,0x8c729cf3,0x84107bcf,0x8c518411,0x8c518c52,0x9cd49cf4,0x94b39cf4,0x84318431,0x94b38c52,0x9cb39cd4,0x94939cd3,0xad35a4d3,0x94929cd3,0x94719471,0x84109471,0x8c308c30,0x8c319492,0x8c518c51,0x94928c51,
-0x84309472,0x94b28c71,0x8c308c71,0x840f8430,0x7bce83ef,0x8c5183ef,0x841083f0,0x84108430,0x9cd38c51,0x94929cd3,0x83ef8410,0x7bcf7baf,0x84307bef,0x84108410,0x7bef8410,0x8430738e,0x8c318431,0x8c518c31,0x8c718c72,0x84308c72,0x7bcf7bcf,0x738e738e,0x6b4d736e,0x5acb6b4d,0x738e6b4d,0x736e738e,0x738e736e,0x632d738f,0x73af6b4d,0x6b4d6b6e,0x73ae6b4d,0x8c518c51,
-0x8c519491,0x7bae8430,0x7bce7bae,0x738d7bae,0x8430840f,0x7bce7bef,0x84108430,0x7bcf7bce,0x8c71840f,0x84308430,0x738e8410,0x738e6b6d,0x6b6e73af,0x6b6d73ae,0x738e6b6d,0x7bef73ae,0x6b6d6b4d,0x738e738e,0x6b6d738e,0x738e6b6d,0x73ae738e,0x73ae73ae,0x7bcf7bcf,0x7bcf7bcf,0x7bce7bef,0x8c71840f,0x7bcf8c71,0x7bef7bcf,0x84107bcf,0x84108410,0x83f08410,0x84108410,
-0x9cd2840f,0x9cd29cd2,0x94919491,0x94b29cd2,0x9cd29492,0x94509471,0x9cb29c91,0x94509c92,0x83cf9451,0xad349471,0x840f9471,0x8c108c10,0x8c308c30,0x8c3083ef,0xa5139491,0x94719cb2,0x94929492,0x8c529452,0x94729cb3,0x7baf8c11,0x945283f0,0xad358c31,0x7bafd659,0xa4d39472,0x9471a513,0x94519451,0x9c919451,0xd679ad34,0xad14cdf7,0xc5f7bdb6,0xad34c5d6,0xa4f3c5f7,
-0xa5149cb2,0x9cb2ad34,0xb575a4f3,0x94b2a513,0xa514ad35,0x8c518c51,0x9cd394b2,0x9cd39cb2,0xad75ad55,0xad55b575,0xad75b596,0xb596ad34,0xce39bdd7,0xa4f4bdb7,0xa534ad35,0xce39bdb6,0xa535b5b6,0xb5b6ad55,0x9cf3ad55,0x9cd3a4f4,0x84109492,0x9cd3a514,0xad55a535,0x9492ad35,0x94b38c72,0x9cd3a4f4,0x9cd39493,0x9cb3a4f4,0xad759cd3,0x9cb2a514,0xa4f3a4f4,0x8c519cf3,
-0x8c719491,0x94928430,0x8c519492,0x94929492,0x94928c31,0x94929492,0xad759cf3,0xad55a534,0xad34ad34,0x9cd3b555,0x8c729451,0x84318c71,0x8c728c31,0x9cd39cd3,0x9492a535,0x73af738e,0x84118410,0x84318c52,0x94728c52,0xa5149cd4,0x843194b3,0x94b38431,0xa51494b3,0xa515a515,0x84108c51,0x7bef8410,0x73ae8410,0xa4f39472,0x84108c71,0x8c718c71,0x7bcf9472,0x8c307bcf,
-0x9cb39492,0x84109471,0x84308410,0x84108410,0x7bef8410,0x8c518c30,0x7bef8410,0x84107bcf,0x8c718410,0x94b29cd2,0x84108430,0x840f8430,0x8c71840f,0x8c7194b2,0x738e8410,0x7bcf8410,0x94728c30,0x8c308410,0x83ef8410,0x84108430,0x83f07baf,0x73ae7bae,0x738e6b6e,0x630c6b6e,0x738e632d,0x7bcf8410,0x6b6d6b4d,0x7bf0738e,0x7bcf7bcf,0x7bcf7bcf,0x6b4d738e,0x843073ae,
-0x8c5094b2,0x840f7bce,0x8c50840f,0x7bce83ef,0x840f7bce,0x840f8c30,0x73ae7bce,0x843073ae,0x84108430,0x73ae7bcf,0x7bf07bcf,0x6b6d738e,0x73ae738e,0x7bce73ae,0x738e738d,0x7bcf73ae,0x73ae7bcf,0x6b4d738e,0x738e7bcf,0x73ae738e,0x84317bf0,0x8c517bf0,0x6b6d7bcf,0x73ae738e,0x84308410,0x8c517bef,0x7bef8c51,0x73ae73ae,0x84107bef,0x94b28c51,0x84309492,0x73ae7bef,
-0x8c718c71,0x9d1394b2,0x94918c91,0x94919cb2,0x94929491,0x9c929c92,0x9cb29471,0x9471a4d3,0x83cf8c10,0x9cb28c10,0x84109451,0x8c308c30,0x8c108410,0x94928c30,0x9cb28c30,0x9471a4f3,0xad559cf4,0xa4f49cd4,0x94729493,0x94729cd3,0x8c318c51,0x945183cf,0x83cfc5f8,0x9cb28c30,0x8c50ad55,0x947183ce,0xa4b2a4d3,0xad14a4d3,0xc5f7c5f7,0xbdb6b595,0xbd95d679,0xb555ad34,
-0xa4f39c72,0xa4f3a4b3,0x9cd29471,0x9cb2b596,0x9cf49492,0x94b29cd3,0x9471ad55,0x9cd38c30,0x9cf49492,0xb596ad55,0xb5b7ad75,0xad55b596,0xdefcce59,0xb596d69a,0xad558c71,0xbdd79cd2,0xb576ce39,0xb596a514,0x9cb3a4f4,0xa5149cd3,0x9cd39492,0xa53594b2,0xad35a514,0x9cd3ad75,0x94729472,0xa5359492,0x9493a4f4,0x9cd3a4f4,0x94929cb3,0x9cf3bdb6,0xad55a4f4,0x94929cd3,
-0x94b28c71,0x8c518c51,0x8c518c51,0x8c728c72,0x8c519cb3,0xc618a534,0xad75ad75,0xa534b5b6,0xb576b596,0xad34a514,0x94729472,0x94b39cd3,0x949394b3,0x9cd394b3,0x94928c51,0x736e8431,0x84317bcf,0x8c518c52,0x84318431,0xa4f49cb3,0x94b3ad55,0x8c518c51,0xa51594b3,0x8c319cf4,0x83f07bf0,0x94728c31,0x7bcf8431,0x94927bef,0x8c309cf3,0x8c518430,0x84108c51,0x9cb29471,
-0x84308410,0x84108410,0x84107bef,0x7bcf8430,0x8c5183ef,0x738e7bcf,0x83f07bcf,0x84107bcf,0x7bef7bcf,0x8c518430,0x8c507bef,0x7bae8c51,0x8c718430,0x8c308c51,0x7bcf7bcf,0x7bef7bef,0x84108c30,0x83f08410,0x84107bae,0x7baf8410,0x7bef83f0,0x7bcf73ae,0x7bcf7bcf,0x736e73ae,0x6b4d6b2d,0x73af7bcf,0x7bef73af,0x7bf07bef,0x84108c71,0x841073af,0x7bcf8430,0x73ae73ae,
-0x840f9471,0x83ef7bae,0x842f8c50,0x7bce7bae,0x7bce7bce,0x8c30840f,0x7bce840f,0x8c717bce,0x84108410,0x738e7bcf,0x84317bf0,0x6b6e7bcf,0x738e632c,0x73ae7bef,0x738d6b6d,0x7bef738e,0x7bcf7bef,0x6b6d738e,0x738e738e,0x738e6b6d,0x7bcf7bcf,0x84318410,0x6b6e7bcf,0x7bef6b6d,0x7bcf7bcf,0x7bef73ae,0x7bef8410,0x73ae7bcf,0x738e73ae,0x9cd38410,0x841094b2,0x7bcf73ae,
-0x9cd29cf3,0x9cd294b2,0x9cd39cf3,0x9cb28c71,0x9cb29cb2,0x9c929cb2,0x9c719450,0x9451a4b2,0x83ef8c30,0x8c5183cf,0x8c109471,0x94518c31,0x8c518c51,0x94928410,0x8c518c51,0x9cd39cb2,0x947294b3,0x9cb39cb3,0x94729472,0xa5149cd3,0x8c119cd3,0x8c3183f0,0x8c31bdd7,0x94929cb2,0x94919cb2,0x94718c0f,0xad34b534,0x9cb2a4d2,0xc5d6bdb6,0xbdd6bdd6,0xb575c5d7,0xb554bd75,
-0x9c92ad14,0xad349c92,0x9cd2ad54,0xbdb6b575,0xa534a4f4,0xa535b596,0xa4f49492,0xa513ad35,0x9cf39cf3,0xad55ad75,0xb5b6b596,0xc638c618,0xb5b7b5b7,0xad75bdd7,0x94b2b596,0xad349cd3,0xc618ce59,0x9cd3a4f4,0xa514a4f4,0x9cb2a534,0x9cd3ad55,0xad559cf3,0xb596ad55,0xad35bdb7,0xa5359cd4,0x9cd39cd4,0xa535ad55,0xa5149cd3,0x94b2a535,0xbdf79cf3,0x9492a514,0x94728c51,
-0x94b29cf3,0x94929492,0x94928411,0x843194b3,0x9cb39cd3,0xbdd79cd3,0xc5f8ce39,0xc5f8bdf7,0xb575bdb6,0x9492a514,0x9cb3a514,0x94b39472,0x94b39cd3,0x8c5194b3,0x8c518c72,0x73af8c52,0x84318410,0x84118c52,0x94728c51,0x9cf49493,0xa535ad35,0x94929cd3,0x94729cd4,0x84118c52,0x84107bf0,0x8c318410,0x84109492,0x84108c51,0x94728410,0x8c718c51,0x94b29cd3,0x83ef8410,
-0x7bcf8410,0x84108410,0x83ef7bcf,0x7bef7bcf,0x9cb38c51,0x6b4d7baf,0x7bef738e,0x94928410,0x94928c51,0x94918c51,0x7bef8c71,0x84107bae,0x8c718410,0x94929472,0x84308410,0x8c317bef,0x738e7bcf,0x7bef7bcf,0x84107bef,0x7bcf8410,0x83ef7bef,0x83ef7bcf,0x841083f0,0x7bef8410,0x6b4d6b6d,0x7bef7bcf,0x73af7bcf,0x73af738e,0x94928431,0x7bcf73af,0x84108431,0x73ae8410,
-0x840f8410,0x7bef73ae,0x83ef8c30,0x8c507bce,0x73ae8430,0x94917bef,0x843094b2,0x84307bef,0x84108430,0x84107bf0,0x84318c51,0x6b6e73af,0x738e73ae,0x7bef7bef,0x84108c51,0x841073ae,0x7bef8410,0x6b6e738e,0x73af738e,0x7bcf7bcf,0x73af7bcf,0x73ae73ae,0x7bcf738f,0x73ae738f,0x7bcf7bcf,0x7bef7bef,0x84108410,0x7bef8410,0x738e73ae,0x843173af,0x7bef8c51,0x7bf07bcf,
-0x94929cf3,0x9cf394b2,0xa534a514,0x94919cf3,0x9cd29cb2,0x94519c92,0x9c919451,0x9c919c91,0x8c309451,0x84108c30,0x8c108c30,0x94718c30,0x94719471,0x94928c30,0x8c519492,0x94928c31,0x8c319cf4,0x94729c93,0x94729cb3,0x8c518c31,0x8c519cb3,0x94518c10,0x9451c5d7,0x9c92a4f4,0x9cb29492,0x9c92a4f3,0xa4d29c71,0x94719c91,0xb575ad34,0xbdd6c5f7,0xa4d3ad34,0xad14b555,
-0xa4f3a4d3,0x8c309c92,0xce38a4f3,0xa513ad34,0xad75c638,0xce59b5b6,0x9cd3a534,0xa534a514,0xad55a514,0xad55a534,0xad75a534,0xce79b596,0xad76bdf7,0xbdd7ad35,0xa534b596,0x9cb294b2,0xb596a534,0x9cd3bdd7,0xa53494b2,0x9cf3a534,0x9cd39cf3,0x8c719cd3,0xbdd79cd3,0xad55ad76,0xa515ad76,0x94939cd4,0x9cf49cd3,0xa4f49cd3,0x94729cd3,0xa5148c51,0x9cd3ad75,0xa5148c51,
-0x9cd2ad55,0x94b394b3,0x94b38c31,0x8c729cd3,0xc6189cd3,0xbdd7c618,0xbdf7c618,0x9cf3a534,0xad35b596,0x9cf3a514,0xa5149cd3,0x94929cb3,0x9cb39492,0x8c728c72,0x94729492,0x7bd08410,0x8c5173af,0x94b38c72,0x94939cd4,0x9cd39cb3,0xad76ad35,0xa514a535,0x7baf9492,0x84107bd0,0x8c7294b3,0x84108410,0x8c3183f0,0x8c517bf0,0x94b28c31,0x8c5194b2,0x83ef8410,0x83ef8410,
-0x8c518410,0x841083f0,0x7bef8410,0x83ef83f0,0x8c518c30,0x738e7baf,0x83f0738e,0x94b28c51,0x84308c71,0x840f7bef,0x840f8c71,0x7bae7bef,0x94928c71,0x8c318430,0x843083f0,0x7bef7bcf,0x7bcf7bae,0x7bcf7bae,0x738e8410,0x7bcf73ae,0x7bcf7bae,0x7bae7baf,0x738e73ae,0x6b4d736e,0x630c630c,0x7bcf738e,0x7bcf7bcf,0x73af73ae,0x8410738e,0x84108c51,0x7bf07bcf,0x7bcf7bef,
-0x7bcf7bcf,0x73ae73ae,0x840f840f,0x840f7bef,0x7bef840f,0x8c918430,0x842f8c50,0x8410840f,0x84108c51,0x7bf07bf0,0x84108411,0x7bf07bd0,0x6b6e73af,0x7bef73ae,0x84108c51,0x7bcf73ae,0x73af7bef,0x6b4d6b6d,0x6b6e632c,0x738e738e,0x7bcf7bcf,0x632d6b4d,0x7bd0736e,0x738e7bf0,0x73ae73af,0x84108410,0x7bef8410,0x73ae7bcf,0x738e738e,0x73ae738e,0x7bcf7bcf,0x7bcf7bcf,
-0x9cb39492,0x9cb294b2,0xa5139cd2,0x9471ad34,0x94919451,0x94509471,0x9c719451,0x9c919c91,0x94719451,0x8c109cb2,0x8c308410,0x94728c31,0x94729472,0x8c319472,0x84108410,0x84318410,0x94929472,0x94729492,0x9493a4f4,0x8c319c93,0x94728c31,0x83f08c31,0x8c30bd96,0x9cb29472,0x9cf29cd2,0x94509cb2,0x9c919c71,0x9c928c30,0xbd96a4d3,0xbdb6bdb6,0xad34c5d7,0xbdb6acf4,
-0xa4f3a4d3,0x9471ad14,0xbd95a4d2,0x9cd2ad54,0xb5b6bdf7,0xce58ad55,0xb595e71c,0x9cd29cd2,0x9cf39cd2,0x9cf3a534,0x9cd3a514,0xad559cf4,0xad55d69a,0xad769cd3,0xad55ad55,0xa4f4ad55,0xad759cd3,0xce38bdb7,0x94b2a534,0xa5349cd3,0x9491a514,0x8c719cf3,0x94b29cb3,0xa514ad76,0xad35ad35,0x9cb39cd4,0x8c529472,0x9cb39cd4,0x9cd39492,0x94729492,0xb5759471,0x94b29cf3,
-0xb595b596,0x9cd3a535,0x9cf49493,0xad55a514,0xa514ad55,0xb575ad75,0xb596a514,0xa4f4b596,0xad35ad35,0x9cf39cf4,0x9cf49492,0xad35b576,0x949394b3,0x94929cb3,0x94b38c72,0x7bd08c51,0x7bd07bcf,0x94938c51,0xa535a514,0x94b39493,0xad359cf4,0x9cd4a515,0x738f7bcf,0x7bd08411,0x94928410,0x84318430,0x7bef7bcf,0x8c718c31,0x8c719cf3,0x8c518410,0x84109492,0x841083ef,
-0x84307bcf,0x83ef8c51,0x94718430,0x7bef8410,0x7bef8410,0x840f7bef,0x8c3083ef,0x84108410,0x840f8c71,0x7bef7bce,0x8c519cf3,0x7bce840f,0x94728c51,0x84308410,0x8c308430,0x7bef8410,0x7bae7bae,0x7bae738e,0x738e8410,0x84107bcf,0x738e7bef,0x7baf738e,0x738e7bcf,0x630c6b2d,0x73ae6b6d,0x84108430,0x7bcf7bcf,0x738e738e,0x7bcf7bcf,0x8c728410,0x738e7bf0,0x738e7bf0,
-0x8410738e,0x84308c71,0x7bcf83ef,0x8430840f,0x84107bef,0x84308c51,0x84307bef,0x8c518c51,0x8c728c51,0x8c529492,0x8c518431,0x7bf08410,0x73af7bcf,0x7bef73ae,0x84107bcf,0x7bcf8431,0x738e73af,0x736e6b6e,0x738e6b4d,0x6b6e738e,0x7bf07bcf,0x738e73af,0x738f738e,0x7bef7bf0,0x6b6d738e,0x7bef7bef,0x73ae7bef,0x73ae73af,0x738e7bcf,0x73af736e,0x738f7bcf,0x841073af,
-0xa5148c31,0x94929cd3,0x9cf39cb3,0xa4f3ad34,0x94719491,0x9c919cb2,0x94719430,0x94509c71,0x8c308c30,0x8c309471,0x8c518c51,0x94728c31,0x94729cb3,0x83f08c51,0x84107bf0,0x8c7283f0,0x9c938c51,0x94729492,0x8c519472,0x94528c31,0x8c518c31,0x738e9451,0x83f0a4f3,0x947183cf,0x9471a4f3,0x9c929450,0x9c719c92,0x83ef9451,0xa4d39c91,0xb595a4f3,0xbdb6b575,0xb535b534,
-0xa514a4d3,0xb575b554,0xa4f39cb2,0xad75a4f3,0x9cd29cd3,0xad54b596,0xf79dc638,0xa534ce58,0x94929cd2,0x9cf394b2,0x94b28c71,0x9cf394b3,0xbdf7a514,0x94b3a535,0xb5b6a535,0xad55b576,0xad34a513,0xce38a513,0x9cd2ce58,0xad549471,0x9491a514,0xad558c71,0x9492ad35,0xb5969cd3,0xad569cf4,0xa514ad56,0x94929cd3,0x9cb39493,0x94929cd3,0x8c518c71,0x94b294b2,0xa514bdd7,
-0xa51494b2,0xa514a535,0xa514a514,0x94729cd4,0x94b2a514,0xa4f49cb3,0xad35a514,0xb596ad35,0x94b39492,0x9cf39cf4,0xa514a535,0xa535ad55,0x9472a4f4,0x94729cd4,0x94939472,0x84319472,0x84117bcf,0x94928411,0x8c729493,0x9cf49493,0xad569cf4,0x94729cd4,0x8c318431,0x84318c31,0x7bcf7bd0,0x7baf8410,0x84317bcf,0x9cf39492,0x84308c51,0x94b28430,0x8410ad34,0x8c307bcf,
-0x7bef7bcf,0x84307bef,0x84308430,0x7bef8c51,0x8430840f,0x840f8c30,0x8c518c30,0x84107bef,0x8c508c50,0x94918c51,0x94b2b5b6,0x94b28410,0x8c317bef,0x84308410,0x84108c30,0x83f08c31,0x738e83f0,0x7bcf7bcf,0x7bef7bcf,0x7bae7bae,0x7bcf8410,0x7bae7bcf,0x7bcf7bcf,0x7baf7baf,0x7bcf7bcf,0x8c518430,0x84108430,0x7bef7bef,0x7bef8430,0x84106b6d,0x8c5194b2,0x738e8430,
-0x7baf7bcf,0x7bcf7bcf,0x7bef7bcf,0x738e7bce,0x7bcf7bef,0x8430840f,0x84308430,0x8c718c51,0x94929492,0x84108c72,0x7baf7baf,0x7baf7baf,0x7bcf7bcf,0x8410738e,0x7bcf73ae,0x7bcf8430,0x738e738e,0x736e736e,0x6b6e6b4d,0x6b6e738e,0x7bcf738e,0x7bcf8c51,0x73af738e,0x7bf073af,0x6b6d73ae,0x73ae738e,0x7bcf7bef,0x7bef7bef,0x7bcf7bef,0x73af73af,0x738f7bcf,0x83f0738f,
-0x8c728410,0xa4f3a4f4,0xa4f49cd3,0xa514b575,0x9cd2a513,0x9c92a4d2,0x94719450,0x8c309471,0x94919471,0x8c518c30,0x9cb39cd3,0x9cb38c52,0x8c5194b3,0x8c318431,0x8c729472,0x8c528411,0x8c518c52,0x8c519452,0x8c318c11,0x94928c31,0x83f08c51,0x7baf8c51,0x8c519cd3,0x8c308410,0x840f8410,0x947183ef,0x9cb2a4d2,0x83ce9451,0x94719c91,0xb5559cb2,0xbd769c92,0x9c92b555,
-0x9471a4f3,0xad349cb2,0x9cb2ad34,0xa4f38c30,0xa534bdb6,0xbdf79cf3,0xa534ad75,0xb595bdd6,0x94b1a534,0x94b29cd2,0x94929492,0x9cf39cd3,0x9cf39492,0xb596c618,0x94928c72,0x9cd39cd3,0x9cd2ad54,0x94918c71,0xce79ce58,0x9cf39cf3,0x9cd2ad55,0xad75ad55,0x94929cd3,0x94729492,0x9cb3a515,0xb576ad35,0x94b3a4f4,0x94939492,0x9cb39cf4,0x94728c31,0x9492a514,0xb5b69cb2,
-0x9cd3a534,0x9cf49cf4,0x9cd49cd3,0x8c72a535,0xb5969cf4,0x8c729cd3,0xb5b7ad55,0xad35a514,0x9cd3b596,0x9cf49cd3,0xad5594b2,0xad55ad55,0x9cf4a514,0x94939492,0x94b39492,0x8c528c31,0x7bf08411,0x94928411,0x94939493,0x9cd38c72,0xa515b576,0x8c528c52,0xa4f49cf4,0x8c529493,0x7baf8410,0x94b2738e,0x8c519492,0x8c518c51,0x84309cb2,0x84107bef,0x84108430,0x8c319472,
-0x7bcf8c51,0x83f07bcf,0x841083ef,0x8c30840f,0x83ef7bae,0x7bae83ef,0x84108410,0x8c518410,0x8c308c50,0x94929491,0x94b2a514,0x7bcf83ef,0x94929471,0x84308c51,0x8c518410,0x84108c51,0x736e7baf,0x7bcf7bcf,0x84107bcf,0x7baf7bae,0x83f08410,0x736d83ef,0x738e736e,0x73af73ae,0x6b6d8410,0x7bcf738d,0x8c518430,0x7bef8410,0x73ae8410,0x738e7bcf,0xb5969492,0x84108c51,
-0x7bef7bef,0x7bcf7bcf,0x7bcf7bcf,0x73ae73ae,0x738e73ae,0x84307bef,0x84108c51,0x8c718410,0x84108c71,0x84108410,0x73af7bd0,0x7baf738f,0x73af7bcf,0x8c517bef,0x738e7bef,0x84317bf0,0x84118c31,0x7bf08411,0x6b6e73af,0x6b4e6b6e,0x738e6b4d,0x73af8431,0x7baf738f,0x73ae738e,0x73ae73ae,0x73ae6b6d,0x7bef7bef,0x7bcf7bf0,0x7bcf736e,0x7bcf7bd0,0x738f7bcf,0x6b4e6b4e,
-0x94729472,0x947294b2,0x94b29492,0xa514a4f3,0x9cd2a514,0x8c0f9471,0x94718c30,0x8c309430,0xad559471,0x94719492,0x9cd3a4f4,0xa4f49cb3,0x83f09492,0x94728411,0x94728c52,0x8c319cb3,0x94529472,0x8c1183f0,0x8c318c31,0x8c319cb3,0x8c318c31,0x8c318c31,0xad34bdb6,0x94929cb2,0x83ef9471,0x9c918c50,0x9c919c71,0x83ae8c10,0x9cb283ef,0x9c929c92,0xad14a4d3,0xb535a4b2,
-0x9cd3a4f3,0xb5759c92,0xa4f3b575,0x8c708c50,0xc617a513,0xa513a513,0x9cd2bdd6,0xb5759cf2,0xa5349cf3,0xa514ad75,0x9cf39cf3,0x949294b2,0xa5149cd3,0xc618ad55,0x8c729cf3,0xa534ad55,0xc6179cd2,0x9cf2ad75,0xbdb69cd2,0xa534bdf7,0xad55a534,0xad55bdd7,0x9cd394b2,0x94929cf3,0xa4f49cd3,0xa4f49cb3,0xa4f4ad35,0x94929cd3,0x9cd39cb3,0x9cd39cb3,0x9cd3a4f4,0xa4f49492,
-0xa514b596,0xa5149cf4,0x94b3a514,0x94b3a535,0xa5149493,0xa514a535,0xad559cd3,0xa514b5b7,0xb596bdd7,0x94b39cf3,0xa514a514,0xa535a535,0xa535a515,0x94929cd4,0x94939cb3,0x83f08c52,0x84118c51,0x94938410,0x94929493,0xa51594b3,0x83f0a515,0x841183f0,0x9cd38c52,0x94b3a515,0x84318c72,0x8c318c31,0x8c318430,0x84309472,0x94929492,0x83ef8410,0x84108410,0x83ef8c31,
-0x94718c51,0x7bcf8410,0x8c30840f,0x8c308c30,0x83ef83ef,0x738e7bae,0x83ef8c30,0x84108410,0x840f7bef,0x94718430,0x9cf3ad54,0x8c307bcf,0x8c518430,0x8c519472,0x84307bef,0x84108c31,0x84318410,0x7bef7bcf,0x7bcf83f0,0x83f0738e,0x7bcf8410,0x73ae7bef,0x7baf7bcf,0x738e738e,0x73ae738e,0x73ae7bef,0x843073ae,0x84308430,0x7bef8410,0x738e7bcf,0x9cf47bcf,0x9492ad76,
-0x8c517bf0,0x7bef8410,0x7bef7bef,0x73ae738e,0x7bcf73ae,0x73ae7bcf,0x94928430,0x84308c71,0x84109492,0x7bcf7bf0,0x73af73af,0x7baf73af,0x738e7bd0,0x7bef73ae,0x84108430,0x84318430,0x94929492,0x947294b3,0x73af8c31,0x6b4d6b6e,0x6b4d6b4d,0x738e738e,0x738e7baf,0x738e738e,0x841073ae,0x7bef73ae,0x7bcf7bef,0x73ae7bcf,0x83f07baf,0x7baf7bf0,0x738e73af,0x6b6e6b4e,
-0x8c728c51,0x8c318c31,0x9cb39492,0x9cd29cd3,0xa513a4f3,0x840f9cb2,0x94719450,0x94719cb2,0x8c518c51,0x94929471,0x94728c51,0x9cd39cd3,0x7bf08c52,0x9cb38c31,0x8c319472,0x84118c72,0x8c3183f0,0x83cf8c10,0x8c318c51,0x9c928c51,0x8c519cb3,0x94519492,0xbdb7c5f8,0xa4f38c30,0x83ef9cb2,0x9c919471,0x8c108c10,0x94718c0f,0x8c308c30,0x9cd39cd3,0xbd96bdb6,0xa4b39c92,
-0x9c92a4f4,0x9c919cb2,0xad149cd2,0x8c50a4f3,0xad558c71,0x9cf3bdf7,0xad54a513,0x9cf2a4f3,0xa534a534,0xa513ad54,0x9cd29cf3,0x84308c71,0xad55a514,0x9cd394b2,0xa534c638,0xa53494b2,0xad34b5b6,0xce58bdd6,0xa4f39cd2,0xd6b9ce78,0xad759491,0xa534a534,0xa514bdb7,0x9cd39cb3,0x94b38c51,0xad76ad55,0xad55a535,0xa515ad35,0x9cf49cb3,0x9cd39cf4,0xa4f49cd3,0x8c319492,
-0x9cf394b2,0x9cb39cf4,0x9cd4ad56,0xa53594b3,0x94b3ad35,0xb5b6a535,0x9492a514,0xbdd7a535,0xad55ad76,0x9cf4ad75,0xc618ad76,0xa514ad76,0xad76ad76,0x9cd3ad35,0x94929cd3,0x94b39492,0x9cd38431,0x8c729472,0x94b394b3,0xb597a514,0x83f08c31,0x84108411,0x94728411,0xa5149cb3,0xa514ad56,0x7bf08430,0x94928410,0x7bf08410,0x94b28c51,0x7bef8c71,0x94728410,0x84108c31,
-0x947183f0,0x7bcf7bcf,0x83ef8c30,0x840f83ef,0x8c5083ef,0x7bce8c30,0x7bae7bae,0x83f08c31,0x8c50840f,0x84307bcf,0x94927baf,0x84108c51,0x8c318c51,0x8c319492,0x84318430,0x84308c31,0x84108c51,0x7bcf7bef,0x73ae73ae,0x7bef7bcf,0x84108410,0x843073af,0x7bcf8c51,0x7bcf7bcf,0x7bcf73ae,0x84108430,0x7bcf738e,0x7bcf8c51,0x94928410,0x8c5194b2,0x8c718c51,0xa5149cd3,
-0x7bcf7bcf,0x84107bcf,0x6b6d738e,0x6b6d73ae,0x84106b6d,0x84108430,0x7bcf7bef,0x84318410,0x8c728c51,0x8c728c72,0x83f08410,0x7bf07bf0,0x738e7bcf,0x7bcf6b6d,0x7bef7bef,0x94928c51,0x8c728c72,0x9cf49493,0x8c519cd4,0x6b4e6b6e,0x630c6b4e,0x7bf06b6e,0x84107bcf,0x7bcf8431,0x843073ae,0x7bcf8410,0x6b6d738e,0x738e6b4d,0x73af73af,0x73af73af,0x736e738f,0x7bd0738f,
-0x8c518410,0x94929472,0xa5149492,0x9cd3ad55,0xa5149cd3,0x8c509471,0x8c308c30,0x9cd2a4d3,0x8c519491,0x94929cb3,0x94728c31,0xa4f49cf4,0x8c318c51,0x94728c31,0x8c318c52,0x84108c31,0x7b8f7bcf,0x83f09451,0x8c317b8e,0x9cb39472,0x8c318c51,0x94518c51,0xb555ad35,0x84109451,0x94718c30,0x8c3083ef,0x83ae9451,0x8bef7bae,0x83cf8c30,0xa4f38c10,0xb535ad14,0x8c31ad14,
-0xad149c92,0x9c729c72,0x9cb29cb2,0x94b2a513,0x94b29cb2,0xc638bdd6,0xa513ad54,0x9cd2b575,0xa534a4f3,0x9cf39cd2,0x9cd2a513,0x94b29492,0xa5359492,0x8c518c72,0xad759cd3,0x9cf3a535,0x9cd2a513,0xbdf69cb2,0xa4f3c617,0xc5f7a513,0xa534bdf7,0xad54ad34,0xbdd7ad55,0x949294b3,0x94b39cb3,0xbdb79cd3,0xad56b576,0xa535bdb7,0x9492a514,0xad359cd3,0x9cd3a535,0x8c519cd3,
-0xad768c51,0x94b3a514,0xa5159493,0x94b394b3,0xbdd8bdb7,0x9cf49cf4,0x9cf3ad55,0xa4f49cf4,0xad75ad76,0xbdf8bdf8,0xad76b596,0xad75c618,0xa535a535,0xad35ad76,0x9cd39cf4,0x94b39cd3,0x94929492,0xb576a535,0x94b38c51,0xad35ad56,0x84107bd0,0x8c528c51,0x94729472,0x9cb38c52,0x94b3a515,0x8c517bcf,0x8c319472,0x94728c51,0x8c518c31,0x8c308410,0x94928410,0x94928c51,
-0x8c519492,0x7bae738e,0x8c508c30,0x83ef7bae,0x8c517bae,0x94919492,0x738e83ef,0x7bcf8c30,0x7bcf8410,0x84308c31,0xbdd77bef,0x84109cd3,0x8c518c51,0x841083f0,0x8c318c31,0x7bcf83f0,0x8c518430,0x84308c51,0x84308410,0x84108430,0x7bef8430,0x84108410,0x84318c51,0x8c517bcf,0x73ae7bef,0x73ae6b6d,0x738e7bcf,0x7bef7bcf,0x84307bcf,0x94928c51,0xa514a534,0x9cf39cf3,
-0x7bcf8431,0x73af8431,0x738e73ae,0x7bef738e,0x738e7bcf,0x7bcf738e,0x7bf07bcf,0x8c518431,0x84308410,0x8c518c51,0x8c518c72,0x73af8410,0x843073af,0x738e7bcf,0x7bef7bcf,0x84308410,0x7baf632d,0x9cf48411,0x84319cd4,0x8c518431,0x738e73af,0x6b4e6b6e,0x73af736e,0x7bcf7bcf,0x73ae7bcf,0x7bcf73ae,0x738e73ae,0x73af73ae,0x738e7bcf,0x6b6e6b4e,0x738f738f,0x7bd073af,
-0x94928c51,0x9cb39cd3,0x94928c51,0xa4f3a514,0x8c518c51,0x94719471,0x94918c50,0x8c509471,0x9cb29471,0xad359451,0x8c319cb3,0x94928c51,0x94928c72,0x84118410,0x94928c51,0x7bf08431,0x7baf738e,0x83f083cf,0x83f07baf,0x9c928c51,0x8c318c10,0x8c309451,0xad35a4d3,0x94728c10,0x94928c30,0x8c109451,0x83cf8c10,0x83cf83cf,0x94718c10,0x8c108c30,0x9cd39cb2,0xa4f3ad34,
-0x9cd39cd3,0x94719471,0x94918c50,0x9cd3a4f3,0x9cd39cd3,0xa5349cf3,0x9cf3ce39,0xbdd6a514,0xb595b595,0x9cf3ad75,0x94918c50,0xa51494b2,0x94929472,0x8c519cb3,0xa5149471,0xad75c618,0xa5139cd2,0xad759cd2,0xc617d679,0xad75a513,0xdedad679,0x9cd3b596,0xa534ad35,0x9cd3b596,0x9cd3a535,0x9cb39472,0xad76b597,0xb576a514,0xad35ad55,0xa53494b2,0xad75b5b7,0xa4f49492,
-0xa51494b3,0xa514a514,0x9cf49cd4,0xa4f49cf4,0xce59ad35,0x9cb3bdb7,0xb5b7ad35,0x9cd3ad35,0xb5b6a514,0xb5b7a534,0xad75bdd7,0xb596b596,0x9cf4a534,0xad76ad55,0x9cd3a535,0x9cd39cf3,0xa5159cf4,0x9cf48c72,0x9cd4ad76,0x9492a515,0x83f07bd0,0x9cd49492,0x94729cb3,0x8c518c51,0x8c318c52,0x94928c51,0x7bef8c51,0x9cd38431,0x8c519492,0x83ef7baf,0x83f08c51,0x84108c51,
-0xa5149471,0x738d7bae,0x7bce83ef,0x73ad738d,0x842f738d,0xad349491,0x94928c51,0x8c318c30,0x84108c31,0x83ef8410,0xad757bae,0x9492ad35,0x8c718c51,0x84317bef,0x8c519472,0x84108410,0x84317bef,0x8c718c72,0x94928c51,0x8c7194b2,0x7bef8430,0x7bef8410,0x7bf073af,0x7bef8410,0x73af7bcf,0x7bcf738e,0x7bcf7bef,0x7bcf73ae,0x7bcf73ae,0x94b28c71,0x94929cd3,0xad559cf3,
-0x8c7294b2,0x7bcf7bcf,0x73ae73ae,0x73ae6b6d,0x73ae8410,0x738e73ae,0x84307baf,0x84318c31,0x8c518c71,0x84318c51,0x8c318c52,0x7bcf8411,0x8c517bef,0x738e8410,0x8410738e,0x8c518c72,0x6b4d6b4e,0xa5357bcf,0x632d9cf4,0x736e630d,0x84317bf0,0x7bef8430,0x7bcf7bef,0x73ae73af,0x738e7bef,0x7bcf738e,0x7bcf7bef,0x73af7bcf,0x738e73af,0x73af738f,0x6b6e738f,0x6b4e6b4e,
-0x94929492,0x84318c31,0x94928c71,0x9cd39cd3,0x94928c51,0x9cd39491,0x9cd29cb2,0x8c519cd2,0x94928c31,0xad149472,0x8c51bdd7,0x8c318410,0x94928c51,0x7bcf7bd0,0x94928410,0x7baf8411,0x83f0738e,0x7bcf736e,0x83f08c31,0x8c3083cf,0x7bcf8c31,0x94719451,0x94729472,0x8c317baf,0x8c519471,0x84109471,0x7bae7b8e,0x83cf8bef,0x9c929451,0x94719451,0xa5148c51,0xb555ad14,
-0x94519cd3,0x9cb29c72,0x9cb29c92,0x94929471,0xa5349cd3,0x94928c72,0xce39ad35,0xad34a514,0x9cd2ad54,0x9cf3a513,0x8c718c51,0x9cd39cd3,0x9cb29492,0x9cd394b2,0x94929cd3,0xbdb6a4f4,0xad54ad75,0xb595ad54,0xdefbb595,0xad75e73c,0xd679b596,0xa514dedb,0xb5759cb2,0xc5f89cf4,0xad35ad55,0x9cd3a514,0xb5b78c51,0xc618ad76,0xa514d69a,0x9492a535,0xbdd7a514,0x9cb3ad35,
-0x8c719cd3,0xa51494b3,0x9cb3b576,0xad569cd4,0xa4f49cd4,0xbdd7c618,0xad359cd3,0x9cd4b5b7,0xa5149cd3,0x9cd3ad76,0xbdd7b5b6,0xa535ad55,0xa534a514,0xad55a535,0x9cf4ad76,0x94b394b2,0xad56a4f4,0x9cd38c52,0xb5b7bdd7,0x738f8410,0x9cd37bd0,0x8c319cd4,0x83f083f0,0x8c3183f0,0x843183f0,0x8c519492,0x94928c31,0xad55a514,0xa514bdb7,0x84308c51,0x94b28c51,0x83f08c51,
-0x9cd38410,0x7bce8c51,0x7bee7bae,0x840f7bae,0x7bce738d,0x9cb2840f,0x9471a513,0x8c319471,0x83ef8410,0x8c308c51,0x94928410,0x94729492,0x8c728c51,0x84108410,0x84108430,0x841083f0,0x7bf07bf0,0x84318410,0x94928c51,0x8c7194b2,0x84108c71,0x8c718430,0x6b4d73af,0x84117bd0,0x7bef7bcf,0x84307bf0,0x84108410,0x73ae7bef,0x7bcf73ae,0x7bef7bcf,0x8c719492,0x94b28c51,
-0x84108c71,0x7bcf8c51,0x7bcf73ae,0x7bcf7bcf,0x7bcf738e,0x73ae7bcf,0x8c317bef,0x8c518c31,0x8c728c51,0x8c529492,0x84318c52,0x8c518c31,0x8c518c51,0x84308c51,0x7bef7bef,0x84108410,0x7bcf83f0,0x7bf07bd0,0x6b6e7bd0,0x7baf73af,0x632d630d,0x73ae6b6d,0x84107bef,0x73ae7bef,0x738e73ae,0x738e738e,0x7bcf8410,0x73af73af,0x738f738e,0x73af73af,0x6b4d6b6e,0x6b6e6b4e,
-0x94929472,0x84108c51,0x94b28c71,0x8c5194b2,0x94928c51,0x9cd29492,0x9cb29492,0x94719cb2,0x94719471,0x9cb39cd3,0xa4f4b596,0x8c318c11,0x8c7283f0,0x84108431,0x8c5183f0,0x7baf8410,0x7baf7bcf,0x83cf7bcf,0x8c518410,0x7bcf7bcf,0x8c308c51,0x8c518c30,0x8c319492,0x8c518c31,0x8c309492,0x7baf7baf,0x736d83cf,0x8bf083cf,0x84109c92,0x94519471,0x94518c51,0xa4d39c92,
-0x9cb29cb3,0x94729472,0x94719cd3,0x8c518c51,0x9cd39472,0x9cf49cd3,0xad769cb3,0xa4f3d69a,0x9cb29cb2,0xa513a513,0x9cb2a4f3,0x9471a4f3,0x94719492,0xa5349cd2,0x8c519cd3,0xa53494b2,0x9cf3bdb6,0xbdf79cf3,0xc617ce79,0xc638e71c,0xa513ad75,0xe6fbd6ba,0x94729cf4,0x9cd39cd3,0xa514b5b7,0xa5149cd3,0xa514a4f4,0xc618bdf8,0xad55b576,0xad559cf4,0xad35a514,0x94b2a534,
-0x9cd38c72,0x94b39492,0xad36ad35,0x9cf49cd4,0xa4f4ad35,0xc618ad35,0x9cd3b5b7,0xad55a515,0x94b294b2,0xbdd7b596,0xb596a514,0xa514b5b6,0xad55ad34,0x9cf3a535,0xa4f4a514,0x9cd39cd3,0xa4f49cd4,0xad35bdd7,0x94b39492,0x8c319cd4,0x8c519493,0x94928c52,0x8c318c72,0x84318c31,0x94928410,0x94729492,0x94b39492,0xa514ad76,0xb596b5b6,0x8c319cd3,0x94928410,0x8c309cb2,
-0x8c108c51,0x84108c10,0x7bce83ef,0x83ee7bae,0x738d7bce,0x8c509471,0x8c309471,0x8c318c30,0x84107bef,0x841083f0,0x8c518c51,0xb5b6bdd7,0x9cd3a535,0x7bcf8c72,0x7bcf7baf,0x7bcf7bcf,0x7bef8410,0x7bef7bcf,0x94928430,0x84108c71,0x84308430,0x7bcf8410,0x84107bf0,0x7bcf7baf,0x7bf08411,0x84317bf0,0x84108410,0x73ae7bcf,0x7bcf73ae,0x84308430,0x84308410,0x8c719491,
-0x84108c51,0x7bef8430,0x7bef7bef,0x73ae7bef,0x7bef73ae,0x8c51840f,0x84308c71,0x9cd38c51,0x8c518430,0x94938c51,0x8c729493,0x7bf07bf0,0x84318c51,0x94918430,0x8c519cd3,0x94b28430,0x7bcf8431,0x73af73af,0x630c736e,0x7bcf6b6e,0x6b6e6b6e,0x6b6d6b6d,0x738e6b6d,0x7bef73ae,0x7bcf7bef,0x73ae7bcf,0x738e7bcf,0x7bcf73ae,0x738e73af,0x736e738e,0x736e738e,0x6b6e6b6e,
-0x84107bcf,0x94929472,0x8c518c31,0x9cd39cd3,0x94929cf3,0x94b294b2,0x9cb29492,0x94929471,0x94719492,0x9c929472,0x9cd39c92,0x8c118c51,0x8c317bf0,0x8c518c31,0x8c518430,0x7baf8410,0x83cf7bcf,0x8c318410,0x841083f0,0x83ef8410,0x94728410,0x84108c51,0x9cd39492,0xa4d39cd3,0x84108410,0x8c518c30,0x8bf09c92,0x83cf83cf,0x9c928c30,0x94518c30,0x8c308c30,0x94718c0f,
-0x9cb39492,0xacf4ad14,0xad14b555,0x7bef9471,0x8c728c31,0xad769cf4,0x9cd49cd4,0xd69ab576,0x9cd2ad34,0x9cd2ad34,0x9cd29cb2,0xa4f3a4f3,0x9cd28c71,0xa4f39492,0x9cd39cd2,0x9cf39491,0xbdd7a514,0xb5b6b595,0xc638bdd6,0xc618bdd6,0xad34b596,0xce59a4f4,0x94b3d67a,0x94729cd3,0xb5969472,0xa514ad35,0x9472a514,0xad559cd3,0x9492a4f4,0xad76ad76,0x9492a514,0xad559cd3,
-0x94b38c72,0x94939492,0xb5779cd4,0x9cf4ad56,0xad569493,0x9cd39cd3,0xb576bdd7,0xa5149cd3,0xa5349cd3,0xad75a534,0xb596bdf7,0xad75bdd7,0xa4f4ad55,0xa4f4a4f4,0x9cd39cd3,0xa535a514,0xa5359cf4,0xb576ad76,0x94938c52,0x94939cd4,0x8c527baf,0x8c529472,0x8c528c52,0x8c318c51,0x841083f0,0x8c518431,0x94729492,0x9cf39cd3,0xa5349cf3,0x8430b596,0x94718410,0x9cd39cb3,
-0x9cb2a4f4,0x8c5083ef,0x83ef9cb2,0x7bae7bae,0x7bce7b8d,0x9450840f,0x8c107bae,0x8c309451,0x94928410,0x84308c30,0x84108430,0xad75d69a,0xa4f4b596,0x7bcf94b2,0x7bcf73ae,0x7bef7bf0,0x84107bef,0x84108410,0x8c518410,0x7bef8c51,0x8c518410,0x8c518c51,0x7bf08c51,0x843183f0,0x84318410,0x8c518410,0x7bf08431,0x7bcf6b6e,0x84107bcf,0x738e7bef,0x84107bcf,0x8c718c51,
-0x84308410,0x7bef6b4d,0x84308c50,0x73ae83ef,0x7bef7bef,0x8c7183ef,0x7bcf8410,0x8c518c30,0x8c718410,0x9cb39492,0x84108c72,0x84107bcf,0x8c518410,0x84108c50,0x8c718c51,0x84108430,0x738f73af,0x6b6e6b4e,0x630c6b4d,0x632d6b4d,0x7bcf6b6d,0x738e73ae,0x73ae7bcf,0x843073ae,0x7bcf8410,0x8c518430,0x73af8410,0x73ae7bcf,0x73af7bcf,0x738e738e,0x73af738f,0x738e73af,
-0x8c519472,0x9cb28c71,0x8c518c71,0x94b29492,0x9cf3a534,0x94718c71,0x8c719492,0x94929cb2,0x84108c51,0x94728c31,0x94729cb3,0x83cf9cd3,0x7bcf7bcf,0x84107bcf,0x84108410,0x7baf7bef,0x8c317baf,0x8c318410,0x7bae8c30,0x8410840f,0x8c308c51,0xa5149cd3,0xad359cd3,0xa4f4ad35,0x8c519492,0x8c309492,0x94518c10,0x8c309c92,0x94518c30,0x94719471,0x94719cb2,0x83af9471,
-0xa4f49c92,0xb555b576,0xb575ad55,0x8c51a4f4,0x8c728431,0xad559492,0x9cf4a515,0xbdb79472,0xbdb6ef3c,0xa4f3a513,0x9cd2a4f3,0xad349492,0x9cd3a514,0x9cb2a4f3,0x94b29cf3,0x94b29cb2,0xad349cd2,0xbdf7d699,0xc5f7c617,0xa534bdf7,0xad75ce58,0xa4f3ad55,0xd67ab5b7,0x9cd39492,0x9cf49492,0xad55ad76,0x9472ad35,0x94b38c51,0x94b3a514,0xb576a4f4,0xa4f4ad35,0x94929492,
-0x8c529cb3,0x94928c72,0xa51594b4,0xad76b577,0x9cf494b3,0x9cf4ad35,0xc5f8a535,0x9cf4bdb7,0xb5969cd3,0x9472ad35,0xce59b596,0xbdd7ad75,0x9cd3ad55,0xa534a4f4,0x9cf3a534,0xa4f4a4f4,0xad76b576,0x8c52ad35,0x84118c31,0xa4f47bf0,0x947294b3,0x8c518c52,0x841183f0,0x8c319472,0x8c319cd3,0x83f08410,0x94928c51,0x94728c71,0x9cd38430,0x94929cd3,0x8c518c31,0x9cf39492,
-0x9c929cd3,0x8c509471,0x8c509471,0x840f738d,0x7bce83ee,0x8c309450,0x9cd39451,0x9cb29cb2,0x8c308c51,0x83ef9492,0x8c517bcf,0xa514bdd7,0x94929cb3,0x83f08c51,0x7bcf7bcf,0x7bcf7bcf,0x84307bef,0x84308c51,0x84307bef,0x8c518c51,0x8c518410,0x84308431,0x7bf07bf0,0x7bf08c51,0x8c3183f0,0x94928c52,0x83f08c51,0x7bcf738e,0x7bcf7bcf,0x7bef8410,0x840f7bcf,0x8c518c71,
-0x840f8c51,0x73ae8410,0x84308c30,0x7bce73ae,0x840f8430,0x84308410,0x8c308410,0x8c508c51,0x8c718c71,0x8c518c51,0x94929472,0x84118431,0x84307bf0,0x84308c71,0x8c718430,0x738e8430,0x73af7bcf,0x736e6b4e,0x738f73af,0x630c6b4d,0x7bcf738e,0x7bce73ae,0x84308c51,0x7bce7bce,0x738e7bef,0x7bef73ae,0x7bef73af,0x7bef8410,0x7bcf7bcf,0x6b6e738e,0x73af6b6e,0x843183f0,
-0x9cb39cd3,0x94928c51,0x9cd39cf3,0x8c7194b2,0x94b294b2,0x94929cd3,0x9cb39cd3,0x9cb29492,0x94729492,0x94729492,0xa4f39cd3,0x7baf9cb3,0x7bcf7baf,0x7bcf7baf,0x7bcf8410,0x841083ef,0x84107baf,0x83f08c51,0x83ef8410,0x83ef83ef,0x83ef8c51,0xad558410,0xa4f4ad14,0x9cd3a4f4,0x9cb39cb3,0x8c318c51,0x8c518c51,0x8c10ad14,0x7bcf8410,0x94718c10,0x83ef8c50,0x8bf08c30,
-0xad1483cf,0xad14a4d4,0x9cb3a4f4,0x9492a4d3,0x84108431,0x9cd494b3,0x9493a4f4,0x94729493,0xdebace38,0xa4f39cd2,0x9cd2ad54,0x9cd39cb2,0xb596ad54,0x9cd3a4f3,0xa513a4f3,0xa5139491,0xa513a534,0xbdf7a513,0xbdf7bdf7,0xc618d6ba,0xbdd7ad55,0xad55b5b6,0xbdf8a4f4,0x9472d6bb,0x9cb39492,0xbdb7a514,0xad35a514,0xa4f49cd3,0xa5149cd3,0x9cb394b2,0xa534ad55,0x843194b3,
-0x9cf49cd3,0x8c318c72,0x9cf49cd4,0xbdd8a515,0x9cb3b576,0xb5b79cf4,0xa4f4a535,0xad55b597,0x9cf39cb3,0xa514a535,0x9cf39cd3,0xb596bdd7,0xb575b596,0x94b2a514,0xa534a514,0xa4f4a514,0xad56b596,0x84118c72,0x83f07baf,0x84318c51,0x8c729cb3,0x84118411,0x83f083f0,0x84318c51,0x94928c51,0x8c518c51,0x9cd394b2,0x8c319cd3,0x8c518c31,0x94929471,0x9472a514,0x94b29492,
-0x94719492,0x9cd39492,0x7bce83cf,0x8c308c0f,0x83ef7bae,0x83ef83ef,0x9cd39cb2,0x94728c10,0x9471a514,0x8c519492,0x8c518c51,0x9cd3a4f4,0x8c728430,0x94728431,0x8c519492,0x7bcf7bef,0x84308c51,0x84108430,0x84107bef,0x8c718c51,0x84308c71,0x7bf08c51,0x84107bef,0x8c517bf0,0x7bf08431,0x9cd38c31,0x84108c31,0x7bcf73af,0x7bcf6b6e,0x7bef8410,0x73ae7bcf,0x94928430,
-0x84308c51,0x840f8410,0x8c718410,0x7bef8430,0x8c508c50,0x840f8c30,0x94718c30,0x8c518c30,0x8c718410,0x84309492,0x84108c31,0x7bf083f0,0x84108431,0x84108410,0x84308c71,0x84107bcf,0x738f8410,0x6b4d6b6e,0x7bf0738e,0x6b6d6b4d,0x7bcf738e,0x7bcf7bef,0x7bcf7bcf,0x7bef7bef,0x738e738e,0x73af738e,0x84317bef,0x6b6d7bcf,0x7bcf7bcf,0x738e7baf,0x73af6b6e,0x83f07bd0,
-0x94928c51,0x94b29cf3,0x9cd38c71,0x94929cd3,0x8c728c51,0x8c719cd3,0x94928c51,0xa4f39cd3,0x9471a514,0x9cd39c92,0xa4f3a4f3,0x94929492,0x84108c30,0x8c318410,0x7bcf7bcf,0x7bcf83cf,0x84107bcf,0x8c519471,0x83f08c51,0x83ef83ef,0x949283f0,0x8c518c51,0x8c319472,0x94929472,0x94929492,0x8c519492,0x8c318c31,0x9cb38c10,0x8c309cd3,0x94718c51,0x8c109471,0x947183ef,
-0x8c308c30,0x9cd39cb3,0xa5149cb3,0x94939472,0x94728c52,0x8c729cd4,0x9cf49472,0x84309493,0xad558c51,0xa514d69a,0x9cd39cd3,0x9cb2a4d3,0xb575b575,0xb595bdb6,0x9cb2ad54,0x9cb29c92,0xa5139cd3,0xa5349cd2,0xce38d6ba,0xc617ce58,0xa513ad54,0xb595ce79,0xb5969cd3,0xd6bbdedb,0x94719471,0x9cd39492,0x9cd3bdd7,0xa5149cd3,0x94b29cf4,0x94b294b3,0xb596a514,0x94939cf3,
-0x9cf48c72,0x9493a535,0x94b39493,0xb596a514,0xb596c639,0xa4f49cf4,0x9cd3ad55,0xdedba515,0x9cb3bdd7,0xa5149cf4,0xa4f49cd3,0xce59ad75,0xce59ad75,0x9cb3bdf7,0xad35a514,0xad55a514,0x94729cf4,0x84108c51,0x84118410,0x8c318c72,0x84308411,0x7baf8c51,0x7bcf8431,0x84108431,0x94b383f0,0x8c518c52,0x949294b3,0x94b394b3,0x94b29492,0x94929492,0xa5149cd3,0x94b29cf4,
-0x8c518c51,0x8c518c51,0x83ef8c30,0x8c50840f,0x7bce7bcf,0x840f83ef,0x8c308c30,0x8c308c30,0x94928c51,0x84318c72,0x7bcf8430,0x9cb29cd3,0x84107bef,0x8c718410,0x8c718c71,0x84108c71,0x7bef7bcf,0x84308431,0x84318410,0x84108431,0x8c719492,0x84308c51,0x84318431,0x84108430,0x8c518c51,0x8c518431,0x84108c71,0x8c517bef,0x7bf07bef,0x73af7bcf,0x83ef7bcf,0x94b27bcf,
-0x8c7194b2,0x7bef7bef,0x7bef8450,0x84107bef,0x8c518430,0x83f08c30,0x83ef7bce,0x8c508c50,0x84318c51,0x84308c51,0x8c518410,0x84108c51,0x8c518410,0x84308410,0x94928c72,0x8c518c51,0x8c927bf0,0x84108c52,0x6b6e73af,0x736e7baf,0x6b6e7bd0,0x841073af,0x7bef73af,0x7bef7bef,0x7bcf73ae,0x6b6e738e,0x7bef738e,0x73ae8431,0x84318410,0x73af738f,0x73af73af,0x7bd07baf,
-0x9cf38c51,0x8c51a4f4,0x94928410,0x94b39cd3,0x8c729cd3,0x949294b2,0x8c318430,0x9cb29471,0x9c929cb2,0x9cb38c30,0x9cb2a4f3,0x9cd39cb2,0x8c309cd3,0x8c3183ef,0x7baf83cf,0x7b8e738e,0x83ef7bae,0x8c308c31,0x84108c31,0x7bcf83ef,0x7bcf83ef,0x94718c51,0x8c518410,0x9cb39cb3,0x94719471,0x94728c71,0x84308410,0x94728410,0x9cd3a514,0x9cb28c51,0x94518c51,0x8c309450,
-0x9cb29cd3,0xa4f38c10,0x9472a4d3,0x8410a514,0x9cd48c52,0x8c52a4f4,0x8c528431,0x94b29492,0x8c308410,0xce18ad34,0xa4d3ad14,0xad34ad34,0x9cb29cb2,0xa513ad34,0xa4f3a4f3,0xa4f39cb2,0x9cd3a4f3,0x94b29cf3,0xc617ad75,0xb5b6b5b6,0xa534bdb6,0x9cf39cf3,0xad75ad55,0xce59b596,0xa4f3d69a,0x94929492,0xbdb69cd3,0xa514a534,0x9cb39cd3,0x9cf394b2,0x9cd39cd3,0x9cf4a534,
-0x8c5294b3,0xad569cd4,0x8c7294b3,0xad55ad55,0xbdb7ad56,0xb596bdb7,0xb596b576,0xad56b597,0xbdf8ce59,0xb596a514,0x9cd3a514,0xa5149cf3,0xad35c5f8,0xb576bdb7,0xa514a4f4,0x9cd3b5b7,0x83f08c31,0x8c529472,0x7bd08410,0x8c518410,0x8c518c51,0x84308c31,0x841083f0,0x94728430,0x84119cb3,0x94b38c72,0x8c728c72,0x9cf494b3,0x9cd3a514,0x94b29cd3,0x9cd38c72,0x8c729cf4,
-0x94928c51,0x84308c71,0x7bcf8410,0x7bcf73ae,0x8c309471,0x840f840f,0x94718c50,0x94719471,0x94b28410,0x84109cf3,0x8c718c71,0x8c3173ae,0x7bae73ae,0x84107bef,0x94928c51,0x738e9492,0x7bef8410,0x84318410,0x8c518c71,0x84318430,0x8c518431,0x8c519492,0x84107bf0,0x84108430,0x84307bef,0x84308410,0x7bcf8410,0x9cd37bef,0x841094b3,0x84107bcf,0x7bcf8410,0x84107bcf,
-0x8c718410,0x7bef8c71,0x7bef840f,0x8c718430,0x8c719472,0x8c518c71,0x8c518430,0x8c508c71,0x84108c51,0x7bcf8410,0x84107bcf,0x7bf08410,0x84318410,0x8c718c51,0x8c518c51,0x7bcf8410,0x7c107bcf,0x94b38c51,0x73af8411,0x736e73af,0x632d630d,0x7bd0738e,0x73af738f,0x738e738e,0x7bcf73ae,0x6b4d738e,0x738e6b6d,0x73ae73ae,0x7bf08410,0x738e738e,0x738f73af,0x7bf07bd0,
-0x9cd39472,0x94b29492,0x8c5194b2,0x94b39492,0x94b29492,0x8c718c71,0x8c518c71,0x9cd38c30,0x94929c92,0x94729c92,0xad34ad14,0x9cb29cd3,0x94729cb2,0x83cf8410,0x83f083cf,0x7baf7baf,0x84107bcf,0x736e7bcf,0x7bcf83ef,0x840f7bce,0x7bcf83ef,0x947283ef,0x8c319472,0x9cb39472,0x8c518c51,0x949294b2,0x8c519492,0x8c729492,0xb5969492,0x9492a4f3,0x94719492,0x9c928c30,
-0x94929cb2,0x8c10a4f3,0x9c92a4f4,0xad55a514,0x9cd49472,0x8c529cb3,0x84318c72,0x9cd39472,0x94929471,0xa5149491,0x9cb2bdb6,0xb575a514,0xa4f39cd3,0xad55ad34,0xb595b575,0x94929cd2,0xa5139cd3,0x9cf3a513,0xa5139cf3,0xb595b5b6,0x9471ad75,0xad34a534,0xad55ad55,0xa514a534,0xce79bdf7,0x94929cd3,0xa5349cd3,0xa534d679,0x9cd39cb3,0x94b2a514,0x94929cf4,0xa5149cd3,
-0x9493a514,0x9cd38c72,0xa535b576,0xa5359cd3,0xc618ad55,0xc639ce59,0xb597b5b7,0xad35bdd8,0xce39ad55,0xad55c638,0xa514a4f4,0x9492a514,0xbdd7ad34,0xb576ad75,0xb576b5b7,0x9cb3a4f4,0x843194b3,0x94728c72,0x8c519472,0x8c518c51,0x83f08c51,0x84318410,0x84108c31,0x94728c31,0x94938c72,0x8c728431,0x94b39cd4,0x9cd39492,0x94b3a514,0x9cf394b3,0x947294b3,0x9cd39492,
-0x9cd39cf3,0x94b29cf3,0x73ae7bef,0x7bae7bce,0x94718410,0x8c519492,0x94718c51,0x8c309471,0x94928c51,0x94b29492,0x84108c71,0x84108c31,0x7bae8410,0x84308410,0x94b28c51,0x73ae94b2,0x84107bef,0x8c518431,0x8c728c72,0x84318c51,0x8c518410,0x8c518c72,0x7bcf8410,0x84107bcf,0x84107bef,0x84307bef,0x73ae7bcf,0x843073ae,0x8c519cf3,0x7bef7bf0,0x73af7bef,0x73ae83f0,
-0x949273ae,0x8c7194b2,0x8c718c51,0x84308c71,0x8c519492,0x94929492,0x94919492,0x8c508c30,0x8c518430,0x84108c51,0x84308410,0x7bcf7bf0,0x7bef8410,0x8c518410,0x8c518410,0x84108c71,0x73af7bf0,0x8c727bf0,0x738f7baf,0x73af73af,0x6b4e6b6e,0x7baf736e,0x738e73af,0x8410738e,0x73ae7bcf,0x73af7bcf,0x738e738e,0x7bcf73af,0x84308c51,0x841083f0,0x7bcf8411,0x738f7bf0,
-0x8c718430,0x94928c71,0x94b294b3,0x8c519492,0x94929cd3,0x94b29471,0x9cd394b2,0x8c309492,0x9cb39cb2,0xa4d3a4f4,0xb5559cb2,0x840f9cb2,0x94929471,0x83cf8c51,0x84107baf,0x7baf8c10,0x7bae83cf,0x83ef7bcf,0x841083f0,0x8c308c51,0x84108c10,0x83cf736e,0x8c109472,0x94518c10,0x8c318410,0x9cf38c51,0x94729cd4,0x84318c31,0x94728c31,0x9471ad34,0x9cb29471,0x9cb28c10,
-0x9471a4f3,0x8c31a4f4,0x9cd38c31,0xad559cb3,0x8c519493,0x8c3183f0,0x8c7294b3,0x8c728c52,0xa514a514,0x94719471,0xbdd79cb2,0x9cb2a514,0xb575b596,0xad34a513,0xb575ad54,0x9cb2ad54,0xa534ad54,0xa534a513,0xad5494b2,0xbdb6ad54,0xbdb6a534,0xb595b596,0xad55a514,0xad35ad76,0xb5b69471,0x9492d69a,0x94929492,0xc638a4f3,0x9cd3ad55,0xa51494b3,0x9cd38c51,0x9cd39cf3,
-0xa53594b3,0x8c519cf4,0xb5b7a535,0xb596ad35,0xc618b5b7,0xce59c618,0xad76c639,0xbdd7ad76,0xad75b596,0xc638d67a,0x9492a534,0xa514a514,0xad759cd3,0xb596c5f7,0xb596bdf8,0x949294b3,0x84109472,0x8c318410,0x8c518c51,0x7bcf8c51,0x7bcf7bcf,0x8c517bcf,0x8c518431,0x84318431,0x8c728c31,0x8c729493,0xa53594b3,0x94b39cd3,0xb596a514,0x9cf3ad75,0x94929cd3,0x8c728c51,
-0xa514ad55,0x94929cd3,0x8c518c31,0x7bef8c51,0x947183ef,0x94719cd3,0x8c308c51,0x94929491,0x84308c51,0x8c718c71,0x94719cf3,0x8c518c51,0x83ef9492,0x8c308410,0x9cf38410,0x84309cd3,0x8c518431,0x8c518c71,0x84318430,0x7bf08430,0x8c518410,0x84108430,0x7bf08431,0x7bf073af,0x7bef8410,0x84307bef,0x84108410,0x7bef8410,0x8c517bf0,0x7bf08c51,0x7bcf7bcf,0x7bcf8410,
-0x84107bcf,0x94b27bef,0xa5349cd3,0xa5149cf3,0x94b394b3,0x8c529cb3,0x9cf39492,0x83f08c71,0x8c518430,0x7bf08431,0x73af7bcf,0x84107bcf,0x7bf08c51,0x84107bf0,0x8c718410,0x8c5194b2,0x73af7bf0,0x84117bcf,0x841173af,0x8c518431,0x6b6e73af,0x7bcf736e,0x73af7bcf,0x7bf073af,0x84108410,0x738e7bcf,0x738e7bcf,0x73ae6b4d,0x7bf08431,0x7bf07bd0,0x7bcf7bf0,0x73af83f0,
-0x8c518c51,0x8c518c71,0x9cf38c71,0x94929cf4,0x94929492,0xa514a4f4,0x94b29cb2,0x8c509cd3,0xa4d39cb2,0x9cb2a4f4,0x9cb29cb2,0x9471a4f3,0x83ef9451,0x8c108410,0x83cf7baf,0x83f08c10,0x7bcf83cf,0x841083cf,0x84108c51,0x8c108410,0x83ef8c30,0x7baf83ef,0x94928410,0x7baf8c10,0x8c729492,0x9cd49492,0x94b3b597,0x84108c52,0x94728c51,0x94929492,0x94919cb2,0xa4d39cd2,
-0x94718c30,0x9c9283cf,0x84109492,0x9c939cb3,0x8c319492,0x8c318c31,0x94939492,0x8c519472,0xad349cb3,0x94719cf3,0x9cf39492,0xa514bdf7,0xa5349492,0x9cf3ad55,0xa51494b2,0xbdf7c617,0xa514a4f3,0xa513ad55,0xad54ad34,0xa513a534,0xa534b5b6,0xad55bdf7,0xa5149cf3,0xad35bdb7,0x9cb394b3,0xb596ce59,0x94728c31,0xa5149472,0xad34bdf7,0x9cb29492,0x94929cd3,0x9cf4ad34,
-0x9cf49492,0x9cd4a535,0xa5358c31,0xb597ce59,0xb5b7b596,0xc618b5b7,0xbdd8d69b,0xad76a515,0xc638ce59,0xd6bace39,0xa514c618,0xad559cd3,0xa514a514,0xce59b576,0x9cf4ad35,0x8c51a4f4,0x7bcf8411,0x8c718431,0x8c718c72,0x7bcf8431,0x83f07bcf,0x8c518c51,0x8c518431,0x8c318c52,0x8c529492,0x9cd49cd3,0x9cf49472,0xa535a514,0xb5b6a514,0x9cd3ad75,0x8c7294b3,0x84308411,
-0xb596a514,0x8c51a514,0x9cd39472,0x84109472,0x84108410,0xa4f39492,0x9471a513,0x94928c51,0x84308430,0x8c319492,0xa534ad35,0x84108410,0x7bef9492,0x73ae7bcf,0x9492738e,0x843094b2,0x84109492,0x84108410,0x7bef7bcf,0x84108410,0x84308410,0x73ae7bef,0x84107bcf,0x7bcf8410,0x7bcf7bcf,0x73ae7bcf,0x7bef7bcf,0x7bcf8410,0x8c517bf0,0x8c7194b2,0x7bcf7bcf,0x84317bef,
-0x84108c51,0x94927bcf,0x94b29cd3,0xa51494b2,0x8c72ad55,0x8c518c31,0x9cb39493,0x8c518c51,0x84308c51,0x8c718430,0x7bcf8430,0x94927bef,0x84108c51,0x84308410,0x8c718c51,0x8c729492,0x84108431,0x7bcf7bf0,0x7bf06b6e,0x84117bf0,0x738e738f,0x73af73af,0x73af738e,0x738e7bcf,0x73af7bcf,0x73ae6b6e,0x73ae73ae,0x7bcf7bef,0x73ae73af,0x73af738e,0x7bcf738e,0x738e7bf0,
-0x8c71ad55,0x94928c51,0x9cf394b2,0xa5149cf4,0x94929492,0x9cd39492,0x9cf3a514,0x8c519cd2,0x9cd38c51,0x9cb39cb3,0xa4f49cb3,0x94719492,0x83ef8c30,0x83ef7bcf,0x7baf8c10,0x8bf07baf,0x7b8e8c10,0x83f083cf,0x7bae7bcf,0x7bae83ef,0x83f08410,0x83f08c31,0x8c5183ef,0x7baf8c31,0x9cf48c52,0x9cb39cd3,0x94729472,0x94939472,0x84108411,0x94719471,0xa4f39cb2,0x94718c30,
-0x945183cf,0x9cb39cb3,0x8c10a514,0x94728c31,0x94b38431,0x9493a515,0x8c318431,0x84318c51,0x94718410,0x9492a534,0x8c308c71,0xc5f89cd3,0x9cd39cb2,0xad54ad54,0xa513ad54,0xc638b575,0xad55b575,0xa534ad55,0xb595a514,0xb5b6a534,0xa534a513,0xc617ad54,0xad55bdb7,0x9cf4b576,0x9cb3a514,0xd69a9cb3,0x9492c618,0x94929cb3,0xb596a534,0x8c719cd3,0x94929492,0x9cf49472,
-0x9cd4a535,0xa5159cf4,0x9cd394b3,0xb597ad56,0xad76b576,0xb597ad76,0xbdd8c5f8,0xb596ad76,0xc638bdd8,0xbdd7c5f8,0xbdd7ce59,0x9cf39cd3,0xb596ad75,0xad35a535,0x9472ad55,0x94b39cd3,0x84109492,0x94b294b2,0x8c729492,0x94b38c71,0x84118c72,0x8c518c72,0x841194b3,0x94b39492,0x94b39493,0x9cd38c52,0x949294b3,0xad559cd3,0x94b39cf3,0x94b29492,0x949294b3,0x8c518c52,
-0xa5349492,0x8c719cf3,0x94928c71,0x84108c51,0x83ef8c30,0x94928c30,0x94719cd3,0x8c308c30,0x84108410,0x8c517bef,0x8c318c31,0x7bef8430,0x7bcf94b2,0x6b6d73ae,0x83ef738e,0x73ae8410,0x7bcf8430,0x84108410,0x7bef7bcf,0x7bef8410,0x7bef8c51,0x73ae7bcf,0x7bcf6b6d,0x7bef8430,0x84307bef,0x738e7bef,0x84108410,0x84108410,0x84308c51,0x8c518c72,0x841073af,0x8c718431,
-0x84108410,0x84108430,0x94928c71,0x94929cd3,0x8c7294b3,0x84318c52,0x9cb38c31,0x8c5194b3,0x84108410,0x8c718410,0x8c519492,0x7bcf7bef,0x84107bef,0x8c718430,0x8c7194b2,0x8c518c51,0x84108431,0x7bcf7bf0,0x7bd0738e,0x8c527bf0,0x7bd083f0,0x73af7bcf,0x738e6b6e,0x73af7bef,0x7bcf6b6e,0x738e6b6e,0x738e73af,0x73af73ae,0x738e738e,0x7bd073af,0x7bcf738f,0x6b6e73af,
-0x9cd3ad35,0x9cb39492,0x9cf49cd3,0x9cb29cd3,0x94b29cf3,0xa5149cb3,0x9cb39cf3,0x8c519cd3,0x8c319c92,0x83ef9451,0x9c929471,0x8bf08c10,0x945183ef,0x736e83f0,0x83cf83cf,0x7baf7b8e,0x7bae738e,0x83cf7bcf,0x83ef8c30,0x7bcf7bae,0x8c1083ef,0x83f083f0,0x7bae83cf,0x94728c10,0x84319452,0x7baf8411,0x8c317bd0,0x8c519472,0x94729cd3,0x84108c51,0xa5138c51,0x9491a4f3,
-0x9cb2ad35,0xa514b596,0xa4f49472,0x8c318c31,0xa5148c51,0xad55b596,0x8c519cd3,0x8c728c72,0x7bef8431,0x9cd39492,0x8c5194b2,0x9cf38c71,0xb596c638,0xa5349cd3,0xad75c618,0xad5594b2,0xad75b575,0xa5149cd3,0xa534b575,0xa514b575,0xa51394b2,0xb5b6ad55,0xad55bdf7,0x9cd3a535,0xa514ad55,0x9cf49cd3,0xdefcdefb,0x9cd39cd3,0x9cd39cb3,0xa4f3b596,0x9cd39cd3,0x9cd39cd3,
-0xa535a514,0x9cf4a514,0xad35ad56,0xb59794b3,0xb5b7b5b7,0xad56b576,0xad56a535,0xc639bdd8,0xbdf8b596,0xb597d69b,0xce59ad56,0x9cf4c639,0xb5b6b596,0x8c72ad55,0xa4f49cd3,0x9cf48c72,0x8c7194b2,0x94929492,0x84108c51,0xa53494b2,0x94929cd4,0x9cb38c72,0x8c5294b3,0x9cd48c52,0x8c5294b3,0x94928c51,0x94928c51,0x9cf39492,0x94b29cd3,0x8c518c71,0x9cd38c72,0x8c7294b3,
-0x84108c51,0x8c718430,0x8c519471,0x84108c51,0x83f07bcf,0x8c518c31,0x94929492,0x83f08c51,0x8c518c71,0x84308410,0x841083ef,0x9cd38c51,0x83ef9cb3,0x7bcf7baf,0x738e7bef,0x738e6b6d,0x84107bcf,0x84108c51,0x7bef7bef,0x73ae7bcf,0x7bcf8430,0x7bcf7bcf,0x6b6d738e,0x84307bcf,0x7bef7bcf,0x738e7bcf,0x84308410,0x8c518c51,0x7bef8410,0x84318430,0x8c518410,0x8c519492,
-0x8c718430,0x7bef8c71,0x8c718430,0x94929cd3,0x8c729472,0x94729492,0x94938c51,0x94729cd3,0x8c518c51,0x84308410,0x8c718c51,0x7bcf8c51,0x84107bef,0x8c518c51,0x8c719492,0x84308c71,0x7bcf7bcf,0x8c728431,0x738f7bf0,0x7bd073af,0x7bf083f0,0x7bd07bcf,0x738e7bef,0x7bcf7bcf,0x632d6b4d,0x738e6b4d,0x6b6e6b6e,0x738e73af,0x738e73ae,0x7bcf73af,0x7bcf7baf,0x73af7bcf,
-0xa5149cd3,0xa514a4f4,0x9cf4a514,0x9cb29cd3,0xad349cd3,0xa4f39cd3,0x9cf3a514,0x94929492,0x738e8410,0x94927baf,0x94519cb3,0x7bae83ef,0x83ef7bae,0x736d8c10,0x83cf734d,0x7b8e8c31,0x7bcf736d,0x83cf83cf,0x84108c51,0x7bae7bae,0x7bcf7b8e,0x94519471,0x8bf08c10,0x9cb38c10,0x83f09cb3,0x94938431,0x8c318411,0x9cd49472,0xad158c31,0x84109cd3,0x9cb29492,0x9cd3ad34,
-0x94929492,0x8c318410,0x94729451,0xa4f4ad35,0x94b38c52,0xa5359cb3,0x8431a535,0x94b38c31,0x84319472,0x8c718c51,0x94929492,0x8c519cd3,0xdedba514,0x8c71b596,0xce79b576,0xa4f4bdb7,0xad75ad55,0xad55ad55,0xb575a534,0x9cd3a534,0xb5b6a534,0xbdd7ad75,0xad55ad55,0xa514b596,0xbdd7ad55,0x9492a514,0xc6189cf3,0x9cd3d69a,0x84308c31,0xad559492,0xad34a514,0x9cb3a4f3,
-0xa5159492,0xa514a514,0xce39ad35,0xa514c639,0xc639b5b7,0xad56bdd8,0x9cf4a515,0xc619b597,0xbdd8bdf8,0xc618b597,0xad76ad55,0xce5ac639,0xb596ad56,0x94729cf4,0x94729493,0x8c72a535,0x9cd39cd4,0x94b38431,0x94929cd3,0x9cf3ad75,0xa51494b3,0x94b3a535,0x8c5294b3,0x8c318c52,0x949394b3,0x94928411,0x8c518c31,0x9cf39cd3,0x9cd3a534,0x7bef8430,0x8c728c31,0x94b28c72,
-0x84308c71,0x94b28c51,0x8c5194b2,0x8c518c30,0x84308410,0x84108c31,0x9cb38c51,0xa4f3a4f4,0x8c318430,0x8c308c51,0x8c518c31,0x94729cb2,0x84108c51,0x84107bcf,0x7bae83f0,0x7bae6b6d,0x7bef7bcf,0x7bef7bef,0x84108430,0x84107bcf,0x84107bcf,0x7bcf7bef,0x6b6d7bcf,0x8c7173ae,0x6b6d7bcf,0x73ae738e,0x7bcf6b6d,0x8c718c72,0x8c718c71,0x84108430,0x84108431,0x8c518c51,
-0x84307bef,0x94b28c51,0x840f8c50,0x94928430,0x94729cd3,0x8c518c72,0x94728431,0x8c319cd3,0x8c719492,0x84308430,0x84308410,0x94929492,0x84108430,0x7bef8410,0x94b28c51,0x8c519cd3,0x7bf07bcf,0xa51594b3,0x7bcf8c72,0x7bf07bf0,0x84107bf0,0x7bcf7bcf,0x7bef8430,0x73af7bcf,0x6b6e7bcf,0x6b6e6b6e,0x6b6e6b6e,0x73af738e,0x738e73af,0x84107bef,0x7bd08431,0x738e73af,
-0x9cd394b3,0xa4f4a4f4,0x9cb39cb3,0x9cd39cd3,0xad559cf3,0xa514ad55,0x9cf394b2,0x84109492,0x8c518c31,0x7bcf8410,0x8bf083cf,0x83cf7b8e,0x83ef9430,0x8c109451,0x7b8e736e,0x83af7baf,0x7baf7b8e,0x83f083cf,0x83ef83ef,0x738e8c30,0x736d736d,0x8c107bae,0x94719472,0x83f08c31,0x94738411,0x841183d0,0xa4f49cb3,0x9cd38c51,0x94729493,0x8c519cb3,0xad349492,0xa5149cd3,
-0x9cb39492,0x84109472,0x9cb38c10,0x94929492,0x84319472,0x9cf49492,0xa4f4ad56,0x84318c72,0x9cf39cf4,0x84308430,0xad769492,0x8c71ad55,0xb5968c72,0x9cf3e71c,0xbdd79472,0xad55ad75,0xad55a514,0xad75bdd7,0xa534a514,0xa534b595,0xa513ad55,0xb596a534,0xad75c5f8,0xad76b596,0xad76a535,0x9cf4ad55,0xa5149492,0xd69ace39,0x8c5194b3,0xa5148c51,0x9492ad34,0x8c51a4f3,
-0xa5359cd3,0x9cf4ad55,0xb597ad56,0xc5f8ce39,0xb5b7a515,0xb597bdd8,0xa515ad76,0xb597a515,0xbdd8ce39,0xbdd7ad76,0xb597ce39,0xd69ab576,0xb596c639,0x9cf48c72,0x8c729cd4,0xb5969493,0x9cd3a535,0x94938c72,0x9cf3a514,0x9cb39492,0x8c729492,0x84319493,0x8c528c52,0x84118c52,0x94937bf0,0x8c5194b3,0x8c318c72,0x9cd39cd3,0x9cf49cd3,0x8c7294b3,0x94728c72,0x94b394b3,
-0x94b29cd3,0x8c729cd3,0x94b39492,0x8c718c72,0x947294b3,0x84318c72,0x84108410,0xa5149492,0x8c318430,0x84107bef,0x7bef8430,0x83ef83ef,0x83ef7baf,0x7bcf8410,0x7bcf7bae,0x8410738e,0x7bef8410,0x84108410,0x8c518410,0x7bcf8430,0x738e7bcf,0x73ae6b6d,0x6b4d73ae,0x841073ae,0x73ae7bcf,0x73ae7bae,0x7bcf736d,0x8c518c51,0x843194b3,0x84308410,0x8c518430,0x7bf08c51,
-0x7bcf7bcf,0x84508430,0x842f8c71,0x8c518c50,0xa5149cd3,0x8c519472,0x8c5194b3,0x84318c71,0x8c718c71,0x84308430,0x8c518430,0x8c718c51,0x84308c51,0x7bcf8430,0x8c517bef,0x8c7194b2,0x84107bcf,0x9cd47bf0,0x8431a514,0x84107bd0,0x8c517bf0,0x84107bef,0x84107bf0,0x7bcf7bcf,0x7bf07baf,0x6b6e73af,0x7bcf738e,0x73ae73af,0x7bcf7bcf,0x7bcf738e,0x84308410,0x738e7bf0,
-0x949294b2,0x94929492,0x94728c71,0x9cd39cb2,0x9cb29cb3,0x9cf39cb3,0x8c719492,0x94928c51,0x94719492,0x736e83f0,0x736e6b2c,0x7b8e736d,0x8bef83cf,0x8c3083cf,0x7baf9451,0x83cf736e,0x84108410,0x94519472,0x83ef8c51,0x7bae8410,0x83cf7b8e,0x94518c10,0x94729c92,0x83cf8c31,0x8c3183f0,0x7bb09493,0x94727b8f,0x8c319493,0x94528c31,0xa4d38410,0xb576a4f4,0x8c51a514,
-0xa4f49cd3,0x8c319cd3,0x9cb38410,0x949294b2,0x94b3ad55,0x94938c72,0xa5359cf4,0x8c52a515,0x94928c51,0x8c729cf3,0x94928c51,0xa5149cf3,0xa51494b3,0xb5b69492,0x8c718c71,0xb596bdb7,0x9cf3a4f4,0xbdd7b596,0x9cf3b596,0xad55a4f3,0x9cd2a514,0xb5769cd3,0xb596b596,0xbdd7b576,0xa535a535,0xad76a514,0x94b3a514,0xc638a535,0x94b2c5f8,0x8c519471,0xa4f3a514,0xa514a514,
-0x94b39cf4,0xa5359cd3,0xb5b7ad35,0xc639c639,0x9cf4c619,0xb5b7ad56,0xad76b597,0xa515a515,0xdebbce59,0xb576c639,0xbdf8ad76,0xad55b5b7,0xbdd8d6bb,0x84319472,0x94939cf4,0x94938c51,0x9472ad55,0x9cd394b3,0x94929492,0x8c5194b3,0x7bf08410,0x94b38c51,0x8c529493,0x94b38c52,0x8c528c52,0x94b39cd4,0x8c519492,0x9cd39492,0x8c719cd3,0x94b38c72,0x8c728c72,0x94929cd3,
-0x94b294b2,0x9cd39cd3,0x84308c51,0x84319492,0x94928c51,0x94729492,0x7bf08431,0x8c518c51,0x84109492,0x83f08430,0x7bcf7bae,0x7bcf7baf,0x94717bae,0x84109cb2,0x841073ae,0x83f083ef,0x84108c51,0x73ae7bcf,0x8c717bef,0x7bef8c51,0x6b6d7bcf,0x632c632c,0x6b6d6b6d,0x84107bcf,0x736e7bef,0x84107bcf,0x73ae738e,0x7bcf8410,0x94b38430,0x738e7bcf,0x8c518430,0x84108c51,
-0x73ae7bef,0x7c0f7bcf,0x8c718c71,0x94919492,0xa5349492,0x94929492,0x94b38c51,0x83f08c51,0x8c518c51,0x8c519492,0x94b28c51,0x84308410,0x84308c51,0x84308430,0x84308410,0x8c518c51,0x7bcf7bef,0x84317bf0,0x9cf49cd3,0x7bf09492,0x7bd083f0,0x84108c51,0x7bcf7bef,0x84108c51,0x738e738e,0x7bcf7bcf,0x738e73ae,0x73ae7bcf,0x84107bcf,0x73ae73af,0x7bcf7bf0,0x73ae738e,
-0x94b294b2,0x9cd39cd3,0x94b294b2,0xad55a4f3,0x9cd3ad55,0xa4f39cb2,0x84309492,0x94928410,0x9cb3a4f3,0x8c519472,0x7b8e7bcf,0x7bae736d,0x7b6d7bae,0x83cf7b8e,0x8c108c10,0x83f083cf,0x8c518c30,0x9471a514,0x8c309471,0x7bcf83ef,0x7bae7b8e,0x9c928c10,0x94319c92,0x83f083f0,0x83f083d0,0xb576a515,0x83f09472,0x94529cd3,0x8c318c31,0x94729472,0x9492ad35,0x94929cd3,
-0xa4f49472,0x9472a514,0x9cb38c31,0x8c319492,0x9cd394b3,0x8c518c72,0x94b38c52,0x9cb3a514,0x94b39492,0x94b29cd3,0x84318431,0xa5348c51,0x9cd3a535,0x94928c51,0x9cb2ad55,0x94719492,0x9cb39cf4,0xad75a4f4,0xbdd7ce59,0xad54ad54,0x9cf3ad54,0xad559492,0xa5349cf4,0xa534ad76,0xa535bdf8,0xb5769cf3,0x9492b576,0xa5148c72,0xb596ce59,0x8c518c51,0xc6189492,0xc618e73d,
-0x9cd3a535,0x9cd49cd3,0xb597ad56,0xbdf8bdd8,0xbdd8c5f8,0xa535a535,0xb596b5b7,0xad56ad76,0xbdd7a514,0xbdf8d69b,0xc619ad76,0xce5adedc,0xa515ad76,0x9cd49cf4,0xa53594b3,0x8c529cd3,0xa5359492,0xb596a514,0x9cd3c619,0x8c728c72,0x7bf08410,0x8c727bf0,0x94928c52,0x9cd48c72,0x84319cf4,0x9cf48431,0x8c519492,0x84309cd3,0x94b39cf3,0x94928c71,0x8c519492,0x9cd38c72,
-0x9cf39cd3,0x9cd39cf3,0x84109492,0x94928c71,0x8c518c72,0x84319493,0x843183f0,0x84317bf0,0x94b38c51,0x84108c51,0x7baf7bcf,0x7bcf8410,0x94927baf,0x84309cf3,0x73ae736d,0x7bcf73ae,0x7bcf8430,0x7bcf738e,0x84318430,0x8c518430,0x738e73ae,0x7bcf738e,0x738e738e,0x73ae73ae,0x738e7bef,0x7bef73ae,0x7baf7bcf,0x738e73ae,0x8c727bef,0x7bef8c51,0x84107bf0,0x84108410,
-0x7bef7bef,0x840f7bef,0x84508430,0x8c718c70,0x9cd38c30,0x94929cd3,0x94b38c51,0x8c519472,0x8c517bf0,0x8c728431,0x8c518c72,0x7bf08431,0x94b28c71,0x949294b3,0x8c718c51,0x84318c71,0x73af8410,0x84108410,0xb5978c72,0x8c519cf4,0x7bcf7bf0,0x84308410,0x84108430,0x83ef83f0,0x738e7bcf,0x7bef6b6e,0x738e738e,0x8c517bcf,0x7bcf7bcf,0x73ae73ae,0x8c518c51,0x7bef7bef,
-0x94b294b3,0x9cd39cb3,0x9cd39cd3,0xa4f4a4f3,0xad34ad55,0x9492a4f3,0x84108c30,0x84108410,0xa514a4f3,0x9cb29cb3,0x83cf9471,0x8c10736d,0x7bae8c30,0x83cf8c10,0x83ef736d,0x83f08c10,0x84107bae,0x83ef9c92,0x8c308410,0x7bae83cf,0x7bcf83cf,0x945183f0,0x8c109451,0x8c3183f0,0x83f083f0,0x94938c31,0x8c31a4f4,0xad1583d0,0x8c319452,0x94728c51,0xa4d383f0,0xad35b576,
-0x9c93a4f4,0xa5149cb3,0x9492a4f4,0x8c518c51,0x83f08c51,0x949283f0,0x8c728c52,0x949394b3,0x9492a514,0x9cf48c51,0x94b29492,0x8c7194b3,0xad75ad55,0x9492ad55,0xb5b694b2,0x9cd39cf3,0xb596ad55,0x9cf4ad75,0xc5f7ad75,0xad54b595,0xa534ad34,0xa514ad75,0x9cd39492,0xb596ad55,0xbdd7a514,0x94b3ad75,0x9cf3a4f4,0x94929492,0xbdb7a514,0x8c31ad76,0xc6389cd3,0xdedbd6ba,
-0xa5149cd3,0x94939cd3,0xb5769cd3,0xad56ad55,0xb5b7ad76,0x94b3ad76,0xad769cf4,0xad56ad35,0xad55a514,0xd69bbdf8,0xb597bdd8,0xce5abdb7,0x84319493,0xbdd8a515,0x84118c52,0xb5b7a515,0xbdd79cd4,0xa535bdd8,0xad55bdd7,0x9cb38c51,0x84108410,0x84108410,0x94728c51,0x84318c52,0x94938c72,0x8c518431,0x94b39cd3,0x8c728410,0x9cd394b2,0x94b29cf3,0x94928c51,0x9cd3a514,
-0x9cd39cd3,0xa534a514,0x8c729cd3,0x9cd38431,0x9cd4a514,0x84319492,0x843183f0,0x84318410,0x9cd38c51,0x8c519cd3,0x7bcf8410,0x73ae73ae,0x7bef736e,0x7bcf8c51,0x738e6b4d,0x7bef73ae,0x73ae8c51,0x73af6b6e,0x73af7bf0,0x843073ae,0x7bcf8c72,0x73ae6b6d,0x738e6b6e,0x73af73ae,0x83f073ae,0x7baf8410,0x7bef73af,0x738e7bcf,0x7bcf738e,0x94b29492,0x84108431,0x843183f0,
-0x84108410,0x840f8410,0x7bce7bcf,0x8c51840f,0x7bef8c71,0x94928431,0x84319492,0x94928410,0x7bcf8410,0x8c518410,0x94929492,0x8c518c51,0xad559cf4,0xa514ad55,0x94b39492,0x8c519492,0x8c728c72,0x94928c51,0xa514a514,0x94b3b596,0x8c7173af,0x8c729492,0x8c518430,0x7baf8410,0x6b6d73ae,0x6b6e6b6e,0x7bcf7bef,0x84307bef,0x7bef7bef,0x8c518430,0x84308430,0x8c518430,
-0x94b394b2,0x94b294b3,0x9cd39cb2,0xa4f3a4f3,0xad349cd2,0x8c51ad34,0x8c307bcf,0x8c319472,0x94b38430,0x94719492,0x83f08c51,0x7bae7b8e,0x83ae7bae,0x83ef83ae,0x83cf83cf,0x8c308c10,0x83cf7baf,0x7b8e7bcf,0x8c107bcf,0x83cf83cf,0x84108c30,0x738e83cf,0x7baf738e,0x841083f0,0x94528410,0x7baf83f0,0xad159cb3,0x8c118c11,0x94529cb3,0x94529452,0x9cb39472,0xb597bdd7,
-0xa4f4bdb7,0x94938c31,0x9472a4d3,0x84108c51,0x73ae7bf0,0x8c51736e,0xa514a514,0xa5359493,0x9cf4a535,0x84318c71,0x9cd39492,0x9492a514,0xc5f89cd3,0x9cd3d679,0xad559492,0x9cd3bdd7,0xa5148c51,0xb576bdb7,0xad359492,0xc638bdd7,0xad75a534,0x9cd3a514,0xa534ad35,0xc5f8bdd7,0xad75a514,0xa514b596,0xa514a514,0x94b2a514,0xa51494b2,0xad76ce7a,0xc5f89cf3,0xbdd7c618,
-0x94929cd3,0x9cb3a535,0x9cf4a4f4,0xa515ad35,0x9cd4b576,0xbdd7bdb7,0x9cb394b3,0xad35ad55,0x9cd4ad55,0xad359cd3,0xb5b7c639,0xb597ad56,0x8c529cf4,0xc6188c72,0xef7eef7e,0xce7af79f,0x94b3a514,0x8c529cf4,0x94727bd0,0x9cd39cd3,0x8c518c51,0x84118c31,0x84318431,0x8c518431,0x84118431,0x94b38c72,0x9cd49472,0x8c7194b3,0x84308c72,0x9cf38c72,0x83f08c72,0x8c728c51,
-0x8c518c71,0xad7694b3,0x94929cd3,0x94b38c51,0xa514a515,0x841194b3,0x843183f0,0x84118411,0x84318c51,0x9cb39472,0x83f08c71,0x73af7bcf,0x73af6b6d,0x738e7bcf,0x8410738e,0x7bcf8410,0x7baf8410,0x73af738e,0x7bf083f0,0x7bcf73af,0x738e8431,0x738e6b4d,0x73af736e,0x73af73af,0x7bcf738e,0x84108c30,0x736e736e,0x738e7bcf,0x7bf073ae,0x94928410,0x8c5194b3,0x8c728c51,
-0x7bef8431,0x7bcf73ae,0x7bcf7bcf,0x94918410,0x84308c51,0x84318c31,0x94728c31,0x7bcf8410,0x7bcf8c51,0x84107bf0,0x8c728c51,0x84108411,0x8c728c72,0x94928c51,0x9cd49492,0x9cd39cf4,0x9cd39cd3,0xa5349492,0xa514a514,0xa5149cf4,0x84318c51,0x94928c51,0x84108c30,0x7bae8c51,0x7bcf6b6e,0x738e738e,0x841073ae,0x7bef7bef,0x84308c50,0x84108c51,0x6b6d738d,0x738e6b4d,
-0x9cf49cf4,0x94b29cd3,0x9cb29cb2,0x94929492,0x9cd29cd3,0x8c519cb2,0x84108410,0x94928c71,0x8c318410,0x9cd39472,0x8c309472,0x734d83cf,0x736d734d,0x83cf7b8e,0x83cf8bf0,0x83ef7bae,0x8c109471,0x83cf7b8e,0x83ef83ef,0x8c3083ef,0x83ef8c10,0x736d7bae,0x7bae736e,0x83f083cf,0x8c118410,0x9cb39cb3,0x9cd39472,0x9c93bd76,0x8c3183f0,0x8c318c31,0x9cd39cb3,0xbdd7a4f4,
-0xb596bdd7,0x84109472,0x9cd39492,0x7baf9cb3,0x738e73ae,0x84317bcf,0xad569cb3,0xa514a535,0xa5149492,0x8c71a514,0x9cd38c72,0x8c518c51,0xb596a514,0xbdd7ad35,0x9492b596,0xad559cb2,0x83f09472,0xbdf89cd3,0xa534a4f3,0xc638bdf7,0xad55bdd6,0xa534ad35,0xb5b6ad55,0xb5b7bdd7,0xb576ad55,0xc639bdd7,0xad76a535,0x9cd3a514,0x94b39cb3,0xc639a4f4,0xad55c5f8,0xa514a514,
-0x9cf4ad35,0xb596ad35,0x9cd4b576,0xad359cb3,0xa515ad56,0xbdb7a514,0x9cd3b596,0xad559cd3,0xad55ad35,0x94b39cd3,0xce59a515,0xad56c639,0xb5b7bdd8,0xd67ad6bb,0xdedbdefc,0x8c72a514,0xa514a514,0x9cd39492,0x8c529493,0x94b39cd3,0x8c728c72,0x7bf08411,0x84107bcf,0x84317bf0,0x8c528c31,0x9cb38c52,0x94b39492,0x94929cf3,0x94929492,0x9cd39492,0x84319492,0x83f08410,
-0x84318c31,0xa5148410,0x9cd39cd3,0x94729472,0x8c728c72,0x7bd094b3,0x8c727bf0,0x8c728431,0x8c728c72,0x94928411,0x7bcf9472,0x6b4d7baf,0x7bef738e,0x73af83f0,0x84107bcf,0x73af8410,0x738e73af,0x84107bcf,0x84108431,0x7bd07bcf,0x738e7bcf,0x6b4e736e,0x738f6b4d,0x84317bf0,0x738e7bcf,0x84107bae,0x7bcf7bef,0x6b6e73af,0x73ae6b4d,0x84307bef,0x94b39492,0x8c728c72,
-0x7bf08c52,0x7bef7bcf,0x840f8430,0x94b28c50,0x9cb29492,0x84319cd3,0x94928c51,0x84109492,0x8c518431,0x84318c51,0x84318c31,0x8c519472,0x83f08431,0x7bf07bcf,0x9cd48c51,0x94939cf4,0x8c728c72,0x94928431,0x8c519cf3,0x8c518c71,0x8c519cd3,0x841073ae,0x84108410,0x7bcf8410,0x7bef8410,0x7bae8410,0x73ae738e,0x84108430,0x8c508430,0x7bef8430,0x738d7bce,0x738e6b4d,
-0x9cd39cf4,0x9cd39492,0xb575ad55,0xa4f3a514,0x9cb2ad34,0x94929492,0x8c519492,0x9cd39492,0x8c5194b2,0x9cb38c31,0x94719492,0x83af8c30,0x6b0c732d,0x7bae7b8e,0x943183cf,0x84108410,0x8c309471,0x83ef83cf,0x84108410,0x841083ef,0x7bcf8410,0x83ef7bcf,0x83f08410,0x8c1083f0,0x7baf8c31,0x94729472,0x8c318bf0,0xd639ad14,0x8c319451,0x8c319452,0x9c938c11,0x94528c51,
-0xa514a4f4,0x8c119492,0x94729472,0x84108c51,0x8c318410,0x84108c31,0xa5159493,0x84319cd3,0x94929493,0xa5149cf3,0x84318410,0x94b28c31,0xad55ad55,0xce59a514,0x9492bdd7,0x8c518c51,0x9cb3b5b7,0xa5148c51,0xad34ad55,0x94b2a514,0xb5b6bdf7,0xb5b6ad55,0xc5f8bdb7,0x9cf3bdd7,0xa514b596,0xad35ad35,0xb576d67a,0xad55a514,0xa514a534,0xa535a514,0xad55c5f8,0xa535ad35,
-0xad55b576,0xad76ad55,0x9cb3bdb7,0xa4f49493,0xad55b576,0x9cf49cd4,0xc618c639,0xb5759cd3,0xb576ad55,0xa514bdb7,0xb5b79cd3,0xc618d67a,0xdefce71c,0xa4f4bdd8,0xbdb7a4f4,0x9492b596,0xa5159492,0x8c729cd4,0xa535a535,0x9cd494b3,0x94b39472,0x84318c52,0x94938c52,0x7bd08411,0x94938c72,0x94939cd4,0x94b39493,0x9cd38431,0x84109cd3,0x9cd38c51,0x84318c72,0x84108c72,
-0x94928c52,0x94928431,0x9cf39cd3,0x949294b3,0x94928431,0x83f08c52,0x84118c52,0x8c729493,0x84318431,0x7bd08431,0x84318410,0x7baf7baf,0x7bf0738e,0x73af7bf0,0x7bf07bf0,0x7bef8410,0x7bcf7bcf,0x83f083f0,0x73af7bcf,0x7baf738f,0x736e7baf,0x6b4e736e,0x7baf736e,0x8c5183f0,0x7bcf7bf0,0x738e738e,0x9cb38410,0x73ae8c72,0x630c738e,0x73ae738e,0x94927bcf,0xad769cf4,
-0x84319492,0x84318c31,0x7bef8c51,0x8c718410,0x9cd38c72,0x8c72ad35,0x94729472,0x94929cd3,0x84107bf0,0x843194b3,0x8c5183f0,0x94b38c72,0x8c518c51,0x84108431,0xa4f48c72,0x94b3a514,0x84318431,0x8c518c51,0x8c718431,0x7bf07bf0,0x94b38c51,0x7bef8c71,0x8c517bcf,0x7bef83ef,0x84108c30,0x841083ef,0x73ae73ae,0x7bcf73ae,0x840f73ae,0x7bef840f,0x73ae7bcf,0x7bef7bae,
-0x94b29492,0x9cd394b3,0x9cb29cd3,0xa4f39cb2,0x94929cb2,0x8c519492,0x94928c71,0x9cb39cd3,0x8c7194b2,0x84307bef,0x94718c51,0x7bae8c30,0x734d734d,0x7bae734d,0x83ef83cf,0x83ef8c10,0x84107baf,0x83ef8c51,0x94518410,0x83ef8c51,0x83ef8410,0x8c3083ef,0x8c308c31,0x83f08410,0x8c518c51,0xa4d48c31,0x9c729cb3,0xa4f49451,0xa4b3ad35,0xad159c93,0x8c319cd3,0x8c318c11,
-0x94928c11,0x94529cd4,0x8c119472,0x8c7283f0,0x8c519cd3,0x9cd38c72,0x8c7294b3,0x843194b3,0x8c718431,0x9cd38c71,0x7bcf9cd3,0xbdb78431,0x9cd3b575,0x9492a514,0xbdb6ad14,0x9cb3a514,0xad559492,0x8c319492,0xad75ad75,0x84309cd3,0xbdb69492,0xb596bdf7,0xc5f8bdf8,0xad55b596,0xa514b576,0xad55a4f3,0xc5f7b575,0xb576b596,0xb576bdf8,0x9492a535,0xc618a4f4,0xad76c639,
-0xad55ad35,0xad55a514,0xad35ad35,0x9cf4a515,0x9cd39cd4,0xad55a535,0xb5b6ad35,0xa514bdd7,0xa534ad34,0xad55a534,0xa514ad35,0xdebbb5b7,0xad55b5b7,0xa535b576,0x9cd3a535,0xb596a534,0x8c729cd4,0x84318c72,0x9cb39472,0x8c729cf4,0x8c729492,0x7bf08c52,0x94929493,0x7bcf8431,0x94b39492,0x9cb394b3,0x9cd3a4f4,0x84318c51,0x8c5194b3,0x94938c51,0x8c519492,0x8c518c72,
-0x94928c52,0x9cd3a514,0x9cd39492,0x94729cd3,0x84318c72,0x7bf08c31,0x7bf08c72,0x8c518410,0x8c728c52,0x84318431,0x7bf07bf0,0x84118c51,0x83f07baf,0x738e7bcf,0x84307bf0,0x7bcf8410,0x84107bd0,0x84108c51,0x84107bd0,0x738e7bd0,0x6b4e6b4d,0x73af7baf,0x738e738f,0x8c517bcf,0x736e8410,0x7baf738e,0x8c517baf,0x8c719cd3,0x6b6d7bf0,0x8c5173ae,0x94928c72,0xc618ad76,
-0x8c5294b3,0x84108c51,0x7bcf8431,0x84107bf0,0x8c319472,0xa5148c51,0x84109cd4,0x94927bef,0x94928c72,0x8c7294b3,0x83f08411,0x8c528c52,0x94b39cd3,0x947294b3,0x94929492,0x8c7294b3,0x9cd39492,0x94b29cd3,0x8c718c72,0x8c519492,0x84308410,0x8c309cf3,0x8c518c31,0x7bcf840f,0x8c518c51,0x7bcf8410,0x7bef840f,0x738d73ae,0x7bef8430,0x7bcf7bae,0x7bcf7bce,0x736d7bef,
-0x94928c51,0x94929cd3,0x8c719472,0x94929492,0x8c5194b2,0x8c518c71,0x94b28c51,0x8c5194b2,0x8c508410,0x84308c71,0x9471840f,0x8c109471,0x7bae7bae,0x83cf736d,0x83ef83cf,0x7bae7b8e,0x83cf738e,0x83af7b8e,0x94718c10,0x8c0f9451,0x8c0f83ce,0x83cf9451,0x94517baf,0x7b8e8c31,0x8c1183d0,0xacf48c11,0x9c72acf4,0x9c929c72,0xb535a4d4,0x94729472,0x84109472,0x8c5183cf,
-0x84318410,0x9492ad55,0x8c728431,0x8c728c51,0x9cd39cd3,0x94938c72,0x8c529492,0x94b38431,0x8c518c51,0x94b28c51,0xb5b6b596,0x84309cf3,0x94929cb3,0x84318430,0xad3594b3,0x9492a535,0xa51494b2,0xa514ce59,0x9d1494b2,0xad76ad76,0x8c728c51,0xbdd7bdd7,0xb5b7ad76,0x9492a514,0xa534a534,0x9cd3a514,0xb575b575,0xad55bdd7,0xad55ad35,0xa514a514,0xad559cd3,0xb5b7ce5a,
-0xad569cd3,0xa4f49cd4,0xb5b7ad76,0xad75bdd7,0x9cd39cf4,0xb576ad35,0xad55a535,0xbdb7bdb7,0xa4f39cd3,0xad55a514,0xa4f3b575,0xad35ad55,0xb596ce59,0xb596ad75,0x9cd3a535,0xb5b7ad55,0x8c51b5b7,0xa5149492,0x8c528c72,0xa5149cd4,0x843194b3,0x84108c52,0x84318411,0x83f083f0,0x8c518411,0xa4f48c72,0x9cf49cf4,0x8c519cd3,0xa5148c72,0x843094b3,0x84108c51,0x94728431,
-0x84117bf0,0x9cf49cf4,0x84318c72,0x7bf09492,0x84118410,0x8c3194b3,0x84317bcf,0x83f08410,0x94b38c72,0x8c3194b3,0x7bf07bd0,0x94928c31,0x73af73af,0x7baf7bef,0x841073ae,0x7baf8410,0x8c717bcf,0x7bcf7baf,0x738e738e,0x73af73af,0x6b4d6b6e,0x6b6e5aec,0x8c51738f,0x7bf08410,0x738f7bf0,0x73af738e,0x738f6b4e,0xa5158c72,0x7bcf7bd0,0x949394b3,0x94d38c72,0xb5b7ad55,
-0x94b3bdd7,0x841094b3,0x7bf08431,0x84118410,0x8c729492,0x94928c31,0x8c319472,0x84108410,0xa5149472,0x84318431,0x9cd3a4f4,0x84319492,0xa53594b3,0x8c728c71,0x8c719492,0x94b29492,0x94b2ad75,0xa53494b2,0x94b29cf3,0xa53494b2,0x7bef8c31,0x94928410,0x8c309471,0x949283ef,0x842f8c51,0x8c718430,0x8430840f,0x7bce840f,0x7bcf7bef,0x7bae7bcf,0x7bae7bae,0x736d736d,
-0x9cb394b2,0x9cd39492,0x9cb39cd3,0x94928c71,0x9cd38c71,0x8c309492,0x94929492,0x8c518c31,0x8c519491,0x84308430,0x8c308430,0x84108c50,0x8c308c30,0x7bcf736d,0x7b6e83af,0x8c107b8e,0x83cf7b8e,0x83cf83cf,0x94519451,0x9c927bae,0x83efa4b2,0x94718c30,0x7b8e83cf,0x83f083af,0x83f07b8f,0x94518c11,0x8c318c10,0x8c119452,0x9c729451,0x9451ad14,0x9c928c10,0x7bcf83f0,
-0x94728410,0x94929492,0x94929472,0x94929cb3,0xa53594b3,0x8c529cd3,0x84318431,0x94928c52,0x9cd39cd3,0x9cf39cd3,0xa534ad75,0x94729cb3,0x9cd38410,0x8c729cb3,0x8c729472,0x9cd39cd3,0x94b3a534,0xa5359cf4,0x949294b3,0x9d149492,0x94939cd3,0xb5979cf4,0xad55b596,0xad75ad76,0xa534a514,0x9cd3ad34,0xa5349cd3,0xbdd6ad75,0xad75ad75,0xb596b596,0x9cd3a535,0xbdd79cd3,
-0x9cd4ad35,0xa4f4a4f4,0xc618a535,0xad55b596,0x9cf4ad55,0xa4f4a4f4,0xa514ad55,0xbdb7b576,0xa514bdb7,0xa4f3ad55,0xbdd7b575,0xa534ad55,0xce59b596,0xad55c5f7,0xb5b6ad55,0xa535b596,0xad76ad55,0x84118431,0x94929cf4,0x94b28c72,0x94b38431,0x8c729cd3,0x8c318c52,0x94729472,0x949394b3,0x94928c51,0x94b394b3,0x8c7194b3,0x8c519492,0x84319cd3,0x8410738e,0x8c517baf,
-0x8c519cd3,0x9cd48431,0x841094b3,0x7bf094b3,0x84107bf0,0x94729492,0x8c107bcf,0x84109492,0x9cb38431,0x8c319cd3,0x7bd07bf0,0x84107bf0,0x7bf08431,0x736e7bcf,0x738e738e,0x7bcf738e,0x84308410,0x73ae8410,0x73af73ae,0x7bcf738e,0x73ae7bcf,0x73ae6b6d,0xa5348430,0x8411ad55,0x8c527bd0,0x738f83f0,0x7baf73af,0x9cd47bf0,0x73af94b3,0x94b38451,0x94b39492,0xa5159cf4,
-0xa535b596,0x9493a535,0x84118c51,0x84318431,0x84117bf0,0x83f08c31,0x9cf49cd4,0x84309472,0x9cd38c51,0x7befa534,0xa4f49472,0x84318c72,0x94b394b3,0x94b39cd3,0x94b2ad55,0x94b28c51,0x94b29cd3,0x8c719492,0x8c718c71,0x8c718430,0x8c71ad55,0x7bef8410,0x9cb29471,0x94918c30,0x840f9491,0x8430840f,0x7bef8c71,0x840f7bef,0x73ae73ae,0x738e7bae,0x738e738d,0x736d736d,
-0x94729471,0x9cf38c71,0x9cf3a534,0x8c518c51,0x9cd39492,0x8c5194b2,0x8c308430,0x94928c31,0x7bef8430,0xad759491,0x9cf3b595,0x94718c51,0x94929cb2,0x83ef7bae,0x7bae83ef,0x736d734d,0x738e738e,0x84108c30,0x9c9183cf,0x83cf8c30,0x8c109c91,0x94719450,0x83af8c10,0x945183cf,0x94529c92,0x8c109431,0x8c1183af,0x8c119452,0x8c1183af,0xbd769452,0x8c119cb3,0x94728c31,
-0x8c519492,0x8c318c31,0x8c519492,0x8c529492,0x9cf49472,0x9cd3a515,0x8c318c51,0x84319472,0x94928c51,0x8c519492,0x9cd39492,0x9cf49cf3,0x7bcf7bcf,0x8c5194b3,0x9cb394b3,0x9cf49472,0x9cd3b596,0x94b394b3,0x8c7294b3,0x9cf494b3,0xa514ad55,0x9cf494b3,0xc618b576,0xad75bdd7,0xa534b596,0xa513a514,0xad759cf3,0xad55ad75,0xad34c5f8,0xbdb6b596,0x9cf4ad75,0x94b3a4f4,
-0xb576bdd8,0xad56ad55,0xbdd7ad35,0xad55bdf7,0xa535ad75,0x9cb3a4f4,0x9cf4a514,0xad55ad14,0xb575b596,0xb575a4f3,0xb575ad34,0xad55b5b7,0xbdd7a4f4,0xbdd7ce7a,0xa535a515,0xad55bdd7,0xa5159472,0x8c31a514,0xa4f48c51,0x8c51a4f4,0x8c3173af,0x94929493,0x84318c72,0x8c528c52,0x8c728c72,0x8c318410,0x94b394b3,0x8c7294b2,0x8c519cd3,0x9cd38431,0x8c518411,0x84109492,
-0x8c728c72,0x84318c52,0x94939cd3,0x84318c51,0x7bcf8410,0x94b38c31,0x8c318c31,0x94929cb3,0x84318411,0x94929492,0x7bcf7bf0,0x83f07bf0,0x84108411,0x7baf8411,0x83f08410,0x738e738e,0x8c718c51,0x738e7bcf,0x73af73af,0x738e7bcf,0x7bcf738e,0x7bcf8410,0x9cd38c51,0x8c729cf3,0x8c318411,0x73af7bf0,0x7bf07bcf,0x83f07bd0,0x94b3a4f4,0x94929472,0x8c7294b3,0x8c729492,
-0xa5359cf4,0xa535a514,0x8c319492,0x8c728431,0x84318c51,0xa5149cd3,0xa4f49472,0x9492a4f4,0x8c519cb3,0xa535ad55,0x8c518431,0x8c519cf4,0x8c518431,0xad76a514,0xa514a514,0x94929cd3,0x9cd394b2,0x94b29cd3,0x8c718c71,0x94928c51,0xa5349cb2,0x8c718c51,0x9cb28c51,0x8c719cd3,0x8c7194b2,0x8430840f,0x8c508c50,0x8c718c50,0x73ae8430,0x7bae738e,0x738d7bae,0x738d736d,
-0x94929cd3,0x8c308c51,0x8c518c71,0x8c518c51,0x8c518410,0x94719cd3,0x8c517bef,0x8c719cb2,0xa5139cd3,0xa4f3b575,0x9cd394b2,0x8c719471,0x9cd3b596,0x8c309471,0x9cd39492,0x6b0c736d,0x630c6b2d,0x8c3083cf,0x83ef7b6e,0x7b8d8c30,0x8c107bae,0x83ef9450,0x83f083cf,0x8c1083cf,0x8c109472,0x8c108c11,0x8c318bf0,0x8c118c11,0x83cf83cf,0x9c938c11,0x9452a4f4,0xa5149c93,
-0x84107bf0,0x8c518430,0x94728410,0x84319472,0x83f08431,0xa4f49493,0x8c729cd4,0x8c518c72,0x94929492,0x8c719492,0x84318c51,0x9cf49472,0x8c729cf4,0x9cd38c72,0x9472ad55,0x8c5183f0,0x9cd3a514,0x84108c72,0xa5148c72,0x9cf4a515,0x9cf49493,0x9cd3a4f4,0xb5b69cd3,0xad55ad55,0xad75bdd6,0x9cd29cd3,0xad75a534,0xad55b5b6,0xc5f7a514,0xb596bdd7,0xad35ad35,0x9cf4a4f4,
-0xce59a4f4,0xad55bdb7,0xb576ad56,0xad55b596,0xa534ad55,0xa4f4a4f4,0x9cf49cb3,0xa514a514,0xad55ad34,0xad55b596,0xa4f3b575,0xc618ad75,0xa535b596,0xdedbbdd8,0x9cd3ad55,0xad76a535,0xad359cf4,0xad76b5b7,0x84118431,0x8c519cd4,0x8c318c72,0x947294b3,0x8c528c51,0x84318431,0x8c318411,0x84318431,0x8c519492,0x84108431,0x9cf39cd3,0x8c728c72,0x94939493,0x84318c31,
-0x7bcf8411,0x8c518c72,0x8c729493,0x9cb37bf0,0x8c518c51,0x8c729492,0x8c718c51,0x84308c30,0x83f08c51,0x8c528431,0x84118411,0x8c318c51,0x84117bf0,0x8c319cb3,0x84108410,0x7baf7bef,0x8c7173ae,0x84108410,0x738e738e,0x8c518410,0x7bcf7bcf,0x73ae7bef,0x84317bcf,0x8c518410,0x7bd08c51,0x84107bd0,0x738f738f,0x7bf07bcf,0xbdd78410,0x8410ad55,0x949294b3,0x843173af,
-0x9cd38c72,0xad769cd3,0x9cf4a4f4,0x8c528c52,0x8c728c31,0x8c528411,0x84108c72,0x8c519492,0x7bcf8c31,0xad558c31,0x9cd3ad75,0x9cd38c72,0x8c728c51,0xad559cf4,0x94b2a514,0x9cd39cd3,0x8c719cd3,0x9cf39cd3,0x94929492,0x94b294b2,0x94b29471,0x8c519cd3,0x84308410,0x8c719472,0x949194b2,0x94b18c71,0x9cb28c50,0x94b29cd2,0x73ae8c71,0x7bae738d,0x736d7bae,0x738e738d,
-0x94719cb2,0x8c519471,0x83ef8c30,0x84108410,0x8c518c30,0x9cd39492,0x8c309cb2,0x83f083ef,0xad559cb3,0x9471ad75,0x8c718410,0x94729492,0x94929cd3,0x94717bef,0x94719471,0x8c519cd3,0x6b2d6b2d,0x736d6b2d,0x83cf7bae,0x7bae7bae,0x736d736d,0x7b8e7bae,0x736e734d,0x83f07b8f,0x7bcf7baf,0x7baf83f0,0x7baf7b8f,0x83d07b8f,0x7baf7baf,0x6b4d736e,0xa4f48411,0x84118c31,
-0x94b39492,0x84108c51,0x83f08c31,0x94929492,0x7bcf73af,0x94929492,0xa5159cd4,0x8c5194b3,0x94b28c71,0x8c729cd3,0x8c518c51,0x8c719472,0xa4f49cd3,0x8c518c52,0x9cb39cf4,0x73af8410,0x8c727bcf,0x94929472,0x9cd49cb3,0xa515ad35,0x94b38411,0x9cd39cb3,0xa53494b2,0xad55ad55,0xb595ad54,0x9492a513,0xa514a4f3,0xbdd7b595,0xa534b576,0xb576bdb7,0xb576ad56,0xa4f4b596,
-0xb5969472,0xb596ce59,0xad559cf4,0xa514a514,0x9cf4a534,0xa5149cd3,0x9cd39cd3,0xad55a4f4,0xad14ad55,0xbdb6bdd7,0xad35a514,0xc5f8ad15,0xc619e6fc,0xc619bdd8,0xa515bdd8,0xa535a515,0xa515b576,0x9cd49493,0x9493ad55,0x94b38411,0x949394b3,0x8c7294b3,0x84318431,0x7bd07baf,0x8c518411,0x84318c51,0x84318c51,0x94928c71,0x84108c71,0x738e7bf0,0x9cf48410,0x738e8410,
-0x7bd07bcf,0x83f07bcf,0x7bf08431,0x843183f0,0x84108c51,0x8c728c51,0x83f08c31,0x8c5183f0,0x84318410,0x738e7bcf,0x843183f0,0x841083f0,0x7bcf8411,0x7bf08411,0x7bcf7bcf,0x84107bcf,0x84107bef,0x8c518c51,0x84108410,0x8c517bef,0x7bef8410,0x83f08410,0x84317bf0,0x7bcf8411,0x84108c52,0x7bf07bf0,0x738e73af,0x843173af,0x8c518c51,0xad55b5b7,0x9cb38431,0x7bcf94b3,
-0x94928410,0xa5159493,0xbdb7a535,0x84319cd4,0x94728c72,0x8c519cd3,0x9cb394b3,0x84117bf0,0x84108c31,0x94927bcf,0x94b39cd3,0x8c518c52,0x8c729cd3,0x94728c51,0xad768c72,0x94b29cf4,0x8c5194b3,0x8c718c51,0x94b28c71,0x8c5194b2,0x8c518c71,0x9cd39471,0x84308c31,0x9cb27bef,0x8c9194b2,0xa5339cf2,0x9cd2a534,0x94919cb2,0x7bef8c50,0x73ae7bce,0x7bce738e,0x83ef8410,
-0x9cb2a4f3,0x94719471,0x83ef83ef,0x8c308410,0x94928410,0x83ef8c31,0x94928c51,0x8c309472,0x94929492,0x9cb39471,0x7bef9472,0x9cd38c51,0x9492a4f4,0x94729cb3,0x8c5183f0,0x94729471,0x7bcf8c31,0x6b2c736e,0x8c10736d,0x6b2c7b8e,0x734c83ce,0x736d734c,0x734d736d,0x94527b8e,0x83f07baf,0x736e83cf,0x734e736e,0x7b8e732d,0x7baf736e,0x736e7baf,0x7b8f7baf,0x83d08c31,
-0x9cb38411,0x8c518c72,0x8c518410,0xd67a9cf4,0x8c729472,0x94929cf4,0xa5358c72,0x8c72a535,0x8c729cf4,0x9cd39492,0x9cd39cd3,0x94929cd3,0x94929492,0x8c729cd3,0xa4f48c51,0x8c319cd3,0x94b373af,0xad769cd3,0x94b3ad76,0x9cf4ad55,0x9cd38c72,0xa514a514,0xad349cf3,0xce38b575,0xad75bdd7,0x94b2a514,0xa5349471,0xbdf7b596,0xad34b5b6,0xbdd7ad55,0xb596ad56,0xad76b597,
-0xad559cf4,0xc619ad76,0x9472a535,0x9cd3a535,0xa5149cf4,0xa514a514,0x9cd3a514,0xad349cd3,0xad35b575,0xb555bdd7,0x9cd3ad35,0xa4d4b556,0xe6fcce5a,0xb597ce59,0xad359cd4,0x9cd49cf4,0xa535b5b7,0x8c529cf4,0xc5f8ad35,0x84319cd3,0x9cb39472,0x8c728c52,0x8c5294b3,0x94938431,0x94939492,0x8c519492,0x7bf083f0,0x8c728c51,0x94929492,0x94928c52,0x8c5183f0,0x736e8431,
-0x7bd08410,0x7bf0632d,0x7bf08c72,0x73af7bd0,0x8c518431,0x84108c51,0x73ae736e,0x8c719492,0x94928c51,0x84108c51,0x83f08410,0x8c3183f0,0x7bf08411,0x8c5183f0,0x7bcf8c51,0x841073ae,0x84108c71,0x8c718430,0x7bcf8c72,0x84307bcf,0x841073af,0x84108410,0x83f08c72,0x7bf08c51,0x94938431,0x7baf8c51,0x7bef738e,0x7bcf7bef,0x7bcf8c71,0xbdd794b2,0x9cf4a515,0x7bf09cf4,
-0x84318410,0x94928431,0xbdd8a515,0x9cd3ad76,0x9cf49cd4,0xa5159cf4,0x8c728c51,0x8c5194b3,0xa51494b3,0x7bf08c51,0x9cf49493,0x9492a4f4,0x94938c31,0x84108c72,0x94b38c51,0x94b3bdd7,0x8c719492,0x7bef8430,0x8c718c51,0x84308430,0x841083f0,0x947183f0,0x84109cd3,0x84107bcf,0x9cf39cd2,0xad75a513,0x9d13b5b5,0x8c718c50,0x8c508c51,0x7bef8410,0x7bcf7bae,0x8c508c30,
-0xa4f39cd3,0x8c519492,0x7bcf83ef,0x8c3183ef,0x94929492,0x83ef8c30,0x94718410,0x94719cb2,0x84308c51,0x7bef7bcf,0x7bef7bf0,0xad359492,0x8c319cd3,0x84108c51,0x8c718410,0x7bcf8430,0x94729cd3,0x84108c51,0x83cf7b8e,0x736d83ce,0x7bae83ce,0x736d7bae,0x83af7bae,0x945183af,0x8c318c31,0x94729451,0x8c319c92,0x8c1183f0,0x9cb39472,0x9cb39cd4,0x841183d0,0xad359493,
-0x83f07bcf,0x7bf08410,0xa5149472,0x9cd39cb3,0xa514b576,0x94b39cd3,0x9cd38c52,0xad55ad55,0x84319cb3,0x8c728c51,0xa5149492,0x9cd3ad76,0x94729cd3,0xa5149cd3,0x7baf8c51,0x94928c51,0x9cf48c72,0xad359472,0xad35ad56,0x8c72a535,0x9cd3a514,0xa5149cd3,0xb596b596,0xc5f7ad34,0xb575ce79,0x9492a514,0xa4f48c51,0xb596b596,0xad75b576,0xb576ad75,0xad35b576,0xb5b7b5b7,
-0x9cf4ad35,0xad55a4f4,0xa535b596,0xad559492,0xa534a534,0xa514a514,0xa514a534,0x9cb39cd3,0xbd96a4d3,0xa4f3bd96,0xb575ad34,0xa4f4a4f4,0xce59ad35,0xc639dedb,0x9cf4a515,0xa515ad35,0xad569cf4,0x9cd4b597,0xad358c52,0x8411b597,0x94938c52,0x8c528c52,0x9cb48c72,0xad56a4f5,0x84318c52,0x8c528c52,0x83f07bf0,0x84318431,0x8c728410,0x8c518431,0x8c729472,0x7bd07baf,
-0x7bcf8c51,0x8c728411,0x8c728411,0x738e94b3,0x84318411,0x84108411,0x7bcf738e,0xa4f49cf3,0x8c519492,0x94928c72,0x7bcf8410,0x8c528410,0x8c528411,0xa53594b3,0x7bf09493,0x84107bcf,0x7bef9492,0x843073ae,0x84109492,0x7bef8430,0x83f083f0,0x738e738e,0x7bf08431,0x8c528431,0x94b27bf0,0x8c729cf4,0x7bf073af,0x73af8410,0x8c518410,0x9cf473af,0xa514bdf7,0x7bf08c51,
-0x7bf07bf0,0x8c518410,0xad559cf4,0xad55b597,0x94b3a514,0x8c319492,0x84118c31,0xa5149cd3,0x9cf494b2,0x94b3ad76,0x8c518c51,0x94938410,0x8c7283f0,0x8c72a4f4,0x84318c51,0xb5968430,0x94b394b2,0x84108c72,0x84108c51,0x8c728410,0x949294b3,0x8c518c51,0x9cd38c71,0x7bcf8410,0xad5594b2,0xb596ad75,0xa534ad75,0x8c718c71,0x8c518c71,0x7bef840f,0x7bae7bce,0x840f83ef,
-0x94927bcf,0x84109492,0x83ef8410,0x8c518410,0x94718c51,0x94929471,0x94719472,0x8c519471,0x83f07bcf,0x7bef8c51,0x8c517bf0,0x8c718410,0x7bcf8c51,0x84107bcf,0x84308431,0x94928c51,0xad358c51,0x8c519492,0x8c309471,0x8c0f83ef,0x7bae736d,0x83ce8c10,0x94517baf,0x83f09451,0x8c308410,0x9cb39492,0x8c519cb3,0x8c518c51,0x94729472,0xa4d49472,0x94729472,0x94938c31,
-0x9cb3ad35,0xad768c72,0x9cf4ad55,0x7bcf9492,0xbdb78c51,0x84319cd3,0xad569cd4,0xad55ad55,0x94b3ad56,0x9cd39cf3,0x94928c72,0x9cb3a514,0x8c719492,0x9472a4f4,0x94729cb3,0x9cd38410,0x94929cb3,0x94729cb3,0xa515ad35,0x8c51a515,0xad768c51,0x9cd3a514,0xad75b576,0xa514ad54,0xb596ad35,0x9cd3ad75,0x8c519cf3,0xad559cd3,0xad55ad35,0xad75bdf8,0xad359cd4,0xc618ad76,
-0xa514b576,0xa514a535,0xbdf8ad56,0x9cd3a535,0x9cf4b5b6,0xad359cb3,0xa5349cf3,0x9cb2a4f3,0xa4d39c92,0xa4f3b575,0xb5769cd3,0xa4f4b596,0xa514a4f4,0xce7ab597,0x9cd4ad76,0xbdd8a515,0xad76b597,0xa535ad76,0x94939cf4,0x9cf49493,0x94938411,0x94b3ad56,0xa5368411,0x94b4ad56,0x8c519493,0x94b39472,0x8c518431,0x7bcf8431,0x7bcf738f,0x7bcf8c31,0x84117bd0,0x7bcf8431,
-0x7bf08431,0x9cf49492,0x84118411,0x8c519493,0x94928431,0x84119492,0x8c5183f0,0x94929492,0x8c7194b2,0x84318431,0x84108431,0x84118410,0x7bcf8c51,0x9cf47bf0,0x84108c52,0x84108431,0x7bef7bef,0x8c518c51,0x84108430,0x84107bef,0x7bcf8411,0x7bcf7bf0,0x84317bcf,0x8c527bf0,0x8c718411,0xad759cf4,0x84319cd3,0x84107bf0,0x84308430,0x94928431,0xb596ad75,0x73af8c51,
-0x7bcf736e,0x8c518c51,0x949294b3,0x9cb3ad35,0x94b38c72,0x94729493,0x8c729472,0x9cf48c51,0x8c71a534,0xa5358c51,0x8c518c72,0x83f08c31,0x84319492,0x94928410,0x8c729cd4,0x94b38410,0x9cf4a514,0x8c719cf3,0x8c518c51,0x94928c71,0xa5149cd3,0x9cf39cf3,0x8c718c30,0x8430a514,0xa5349492,0xb5b6bdd6,0x9cf3ad75,0x8c719cd2,0x8c718c51,0x7bce840f,0x83ef7bcf,0x7bce840f,
-0x83ef7bef,0x8c518c51,0x83f08430,0x84108410,0x84307bef,0x8c518c31,0x8c518c51,0x84108c71,0x7bcf8410,0x7bcf8410,0x83f08410,0x84108c51,0x8c727baf,0x8c7294b2,0x8c718410,0x84108c72,0x949283f0,0x8c30a4f4,0x840f7bcf,0x83ef8c30,0x8c309471,0x9cb28c0f,0x8c309451,0x94519451,0x8c519cb3,0x8c318c31,0x94728410,0xad55a514,0x949294b3,0x9cd49493,0x9cb3ad35,0x843183f1,
-0xa5159cf4,0xa4f4ad55,0x8c71a4f4,0x8c318c51,0x8c718c51,0x84109492,0xa5358c52,0xad569cd3,0xad56b576,0xad55ad35,0x8c319492,0x94928c52,0xad769cd3,0x8c51a535,0x9cf49472,0x8c519492,0xa4f4a4f4,0x83f09cb3,0xa5148411,0xa535b596,0xbdb78c72,0xad55c618,0xa4f4ad35,0x9cf39492,0xa4f3ad55,0xb596b596,0x8c51a4f3,0xa5149492,0xad55ad75,0xc619b596,0x9cd3ad56,0xb5769cd4,
-0xc5f8c5f8,0xa514bdb7,0xbdb7a514,0xad35c639,0xb5b79cf4,0x9cf3a514,0x9cd3a514,0x94919cd3,0x94719cb2,0xa513a4f3,0xad14a513,0xb596ad55,0xa514ad34,0xad559cb3,0x9cf4b596,0xa5148c52,0xa515c5f8,0xa535a514,0x94b3a515,0xa5159493,0x94b3b597,0x94938411,0x94739cf4,0x9cd49cd4,0x94729cf4,0x94939493,0x84317bcf,0x738f8410,0x84107bf0,0x94938431,0x8c528411,0x738f8c52,
-0x84318431,0x94938c72,0x84118c52,0x9cd48c51,0x84109492,0x8c527bf0,0x8c728c51,0x8c718c72,0x9cd3a514,0x84318c71,0x84318c72,0x83f08410,0x94938c31,0x8c5283f0,0x84109493,0x8c728c51,0x8c518c71,0x84318c71,0x84318410,0x7bf08410,0x7baf73af,0x8c517bd0,0x8c528c72,0x84107bf0,0x8c718431,0x94b38430,0x9492b5b6,0x84108410,0x8c518431,0x7bf07bef,0x9cd38410,0x843094b3,
-0x73af7bef,0x841083f0,0x94928410,0x94729492,0x8c528c52,0x94b39493,0x8c528c52,0x94b394b3,0x94b394b3,0x84317bd0,0x8c519cb3,0x84108410,0x94728c51,0x84318c51,0xa514a4f4,0x8c717bf0,0xad559492,0x8c519cd3,0x84108410,0x94928431,0x94928410,0x94b29cf4,0x8c718c71,0x9cf38c71,0x8c718c51,0xb5b6ad55,0x9cd3a534,0x94b29cf3,0x84309491,0x7bef83ef,0x9491738d,0x738d8c71,
-0x83f08410,0x841073ae,0x84108c51,0x7bae83f0,0x7bef738e,0x94929492,0x8c518c71,0x84108410,0x84107bcf,0x7bcf7bf0,0x7bf07baf,0x8c317bf0,0x8c518410,0xa5349cd3,0x84318c72,0x94928c71,0x8c519492,0x947183f0,0x83ef83ef,0x83ef8c30,0x9471734c,0x7bae8c10,0x83efa4f3,0xad148c31,0x9cb39cd3,0x94929cd3,0x841083cf,0xa5149cf4,0x9492b596,0x9cd49472,0x94939cd3,0x94939493,
-0x8c529cb3,0x84109472,0x94928410,0x9cd394b2,0x8c319492,0x94928431,0x949394b3,0x949394b3,0xb5b79cd3,0x94b3ad76,0x94929cf4,0x94928411,0x9cd38c31,0x94929cf3,0x8430a514,0xa51494b2,0x8c319cb3,0x9cd39cd3,0x8c318431,0xb596c5f8,0xa535ad76,0xb596a515,0x9471a514,0x94928c71,0x9cb29cd3,0xb596a514,0x94b29cd3,0xa5148c51,0xad75ad55,0xb576a514,0xa514c5f8,0x9cd494b3,
-0xce7aad76,0xb597ce39,0xb596ad35,0xe71cce7a,0xad55c618,0xad35ad76,0xa4f3a514,0x9cb28c31,0x9cb29491,0xa5139cb2,0x9cb2a4f3,0xad34a514,0xad34ad34,0x9cd3a534,0xb597a515,0x84319492,0xbdd89cd4,0x9492ad76,0x9cd49cb3,0x94939493,0xa5359493,0x94b39493,0x9cd4b5b7,0xad779473,0x9493ad56,0x7bd08c72,0x843173af,0x8c518410,0x94938410,0x8c529cf4,0xad569cd4,0x9cb3b597,
-0x8c518431,0x94939493,0x94939493,0x94929492,0x9cb3ad56,0x841073af,0x8c719492,0x8c518c72,0x9cf38c51,0x84109492,0x8c317bcf,0x7bf08410,0x7bd08411,0x7bf07bf0,0x73af736e,0x8c517bcf,0x9cd39cd3,0x8c718c71,0x84109492,0x8c518c31,0x73af7bcf,0x94938410,0x84318c52,0x7bf07bf0,0x94928c31,0x8c519492,0xb596a534,0x94b294b2,0x84108c51,0x84308410,0x8c729492,0x94b29cd3,
-0x84109cd3,0x7bf07bcf,0x94b38c51,0x8c519493,0x8c518431,0xa535a515,0x94b394b3,0x94b38411,0x8c729cd3,0x84108c72,0xad568c52,0x8431a514,0x8c728431,0x84118c72,0x8c517bcf,0x84108c72,0xa4f48c52,0x84319cf4,0x84317bf0,0x8c518410,0x8c519492,0x8c518c71,0x8c728c51,0x8c518c51,0x94929cf3,0x9cf38c91,0xa534a514,0xb5b6ad75,0x8c519cf3,0x7bef7bef,0x84307bef,0x7bef9cd2,
-0x7baf8410,0x84108c51,0x8c71736d,0x84108c71,0x7bcf7bcf,0x94b28c51,0x8c5194b2,0x841083ef,0x7bf083f0,0x83f08410,0x7bcf7bf0,0x83f08410,0x83f08c31,0xa5148410,0x8c72ad55,0x94b38430,0x94929cd3,0x843083ef,0x8c51a4f3,0x83ef8c30,0x83ce840f,0x8c30840f,0x9cb29451,0x8c519cb3,0x94729472,0x8c108c31,0x7bd07bf0,0xad7694b3,0xbdb7ad55,0x8c729cd4,0x94939493,0x8c729cd3,
-0x84108c32,0x9cd38431,0x94b27bf0,0x8410a514,0x84108410,0x843173af,0x94929cd3,0x8c729493,0x94b38c31,0xad55a515,0x8c72a535,0x8c518c72,0x8c728430,0xa534b576,0x83f0a514,0xb5769492,0x8c31a4f4,0xb57694b3,0x9cd38c52,0xbdd8ad56,0xad55bdd8,0xa5149cd4,0xa514c638,0xa5149cd3,0x8c719492,0x9cd39472,0x94929cf3,0x94928c51,0xa514ad55,0xa514a535,0xc619a535,0xa515a515,
-0xb5b7b596,0xbdf8ce59,0x9cd4a535,0xd6bbc619,0xbdd7e71c,0xb596a535,0x8c51ad55,0x94719471,0x94919451,0xa4f3a4f3,0x9cb2a4f3,0x9cd39cb2,0xa4f39cd3,0x9cd3a4f3,0xa5359cd3,0x8c519cf4,0xb5969492,0xa4f4ad76,0x8c529cb3,0x8c328c32,0x94728c52,0xa515b5b7,0x8c529472,0x8c72a515,0xa4f49493,0x9cd4a4f4,0x7bd07bd0,0x94729472,0x84318c31,0x8c519492,0xa5159493,0xad56b597,
-0x7bf08c51,0x8c517bf0,0x8c728c72,0x8c728c51,0x94939cf4,0x84108c31,0x94928c71,0x8c718c51,0x8c718c51,0x7bcf8c31,0x84318410,0x84118411,0x7bf08411,0x84118431,0x84107bd0,0x841073af,0x8c728431,0x84318c72,0x8c519493,0x84318410,0x7bf08c31,0x8c528410,0x84108431,0x7bcf7bf0,0x84308410,0x8c728430,0xad7694b3,0x8c51a514,0x7bd083f0,0x83f08c31,0x9cb3a4f4,0xad559cb3,
-0x8c519cd3,0x8c517bef,0x8c517bf0,0x94928c52,0x94928c72,0x9cd4a515,0x8c51a4f4,0xa5149493,0x8c72ad55,0xa5149492,0xa5358c52,0xad56d6bb,0x7bcf8c51,0x94b38431,0x84108410,0x8c518c71,0x9cb38c51,0x84109493,0x94b38431,0x84108c51,0x8c728c51,0x949294b3,0x94928c51,0x8c519492,0xa51494b3,0x8c718c72,0xbdf78c72,0xa514b5b6,0x9cd3ad55,0x7bcf9471,0x8c507bcf,0x9cd28c71,
-0x8c517bcf,0x84108c51,0x94927bcf,0x8c319492,0x8c308410,0x8c308410,0x7bcf8410,0x8c518410,0x7bf08410,0x8c518430,0x7bf083f0,0x83f08410,0x841073ae,0x8c518430,0x949294b2,0x8c718c71,0x9492a534,0x7bce8c51,0x9cb283ef,0x83ce83ef,0x7bce8c0f,0x94919471,0xa4f49c92,0x94519cb3,0x8c319492,0x83f07b8e,0x84108c72,0xa5158c52,0xa515ad56,0x94729cd3,0x94729472,0xa4f49492,
-0x83f09493,0x8c518c31,0x8c319492,0x94728c51,0x7baf94b2,0x8430738e,0x8c528c51,0x94939492,0x84318c51,0xa5149472,0x9cb3ad56,0x8c518c31,0x8c518c51,0x94b29cb3,0x9492a514,0x9cd38410,0x9cf4ad56,0xad768c51,0xad76ce5a,0x9cd49493,0xc618a535,0xa514ce7a,0xa5349cf4,0xa51494b2,0x9cd39cd3,0x8c518c31,0x9cd394b2,0x8c519cb3,0xb5b69cb3,0xa514a515,0xb597b576,0xad56bdd8,
-0xbdb7ad35,0xc5f8a515,0xad55bdf8,0xbdd7bdb7,0xc639ce59,0xa535ad55,0x9cd3b596,0x94718c31,0x94719451,0x9cb2a513,0x9cb2a4f3,0xad349cd3,0x9cd39491,0xa5149cd3,0x9cd39cd3,0x9cf3a514,0x94929492,0xa5359cd3,0x94939cd3,0x8c529493,0xa4f59472,0xa535a4f4,0x7bd08c72,0x94938c72,0x9cd48c31,0xa515b597,0x7bf094b3,0x84118410,0x8c518c72,0x84119492,0x94937bf0,0xa515a515,
-0x94729cd4,0x84118c31,0x8c518431,0x8c518c31,0x738e7bcf,0x8c728c51,0x94928410,0x8c718c72,0x9cb29492,0x84107bcf,0x8c728410,0x7bf07bf0,0x84318411,0x8c7294b3,0x84108411,0x84107bcf,0x84307bd0,0x7bef8c71,0x8c318c51,0x843183f0,0x94b394b3,0x7bd08411,0x84318410,0x84108410,0x8c727bf0,0x94928410,0x9cf48c52,0x7bf0ad55,0x84107bcf,0x8c728410,0x8410ad55,0xad558410,
-0x8c519cf3,0x8c518c71,0x84318431,0x94b38c72,0x8c72a514,0x8c528c52,0xa5359cd3,0xa5149cd4,0x9cd3b596,0x8c318c31,0x9cf49cd3,0xef7ead76,0x8411a515,0x8c528c31,0x841094b3,0x94928c71,0x9cd38c72,0x8c729493,0x8c728c52,0x8c729492,0x8c728431,0x9cf39cd3,0x9cf39cf3,0x84319492,0x94928431,0x841094d3,0xb5968c51,0x9cf3c618,0x949294b2,0x840f8c51,0x7bef73ae,0x84108430,
-0x8c718410,0x94928410,0x8c719492,0x84108430,0x8c717bef,0x84108430,0x7bef7bef,0x84308430,0x84318410,0x83f09472,0x7bcf8c51,0x8c518431,0x83f07bef,0x84318c31,0x84317bef,0x8c5194b3,0x9cd39492,0x840f8c51,0x84307bef,0x840f8c70,0x8c0f7bce,0x8c3083ef,0xa4d3ad35,0x9c9283f0,0x8c529472,0x8c318410,0x8c729472,0x8c318c72,0x9cb39472,0x949294b3,0x94939472,0x8c529cb3,
-0x94939472,0xa4f49493,0xa4f49cd4,0x9cf39cb2,0x8430a4f4,0x7bef8c51,0x84317bf0,0x94939492,0x84318c51,0x8c728c51,0xc619ad56,0x9492a4f4,0x8c719cd3,0x9cb38410,0x8c519492,0x84108410,0xc5f8ad35,0xb596bdb7,0xbdd8d67a,0xa535ad56,0xce59c619,0xc618c639,0x9cf49cd3,0x94b2bdb7,0x9cd39492,0x8c3194b2,0x8c7283f0,0x94729cb3,0x94b39472,0xa5359cf4,0xad35b576,0xb597ad56,
-0xb5b7ad76,0xb576ad56,0xc5f8ce7a,0xbdd8c619,0xbdd8a535,0xbdb7bdd7,0xb576ad75,0x94719492,0xa4f39cb2,0x9cd29cd3,0x9cb2a4f3,0xad34a514,0x8c30a4f3,0xa5149471,0x9cd3ad55,0xa5149471,0x9c92a4f4,0x94929472,0xa5149cd3,0x8c319472,0x9cb39493,0x94929cb3,0x9492a515,0xa4f48c52,0x9cb3a515,0xa5159cb3,0x94939cd3,0x7bd08431,0x84317bf0,0x73af8c52,0x8c317bd0,0x94939493,
-0x8c729472,0x8c518c72,0x84318431,0x84318411,0x738e8410,0x9cd37bf0,0x8c718c51,0x84319492,0x9cb29492,0x841083f0,0x8c729492,0x8c729492,0x84118431,0x9cb39493,0x84317bf0,0x8c518431,0x8c728431,0x8c318c72,0x7bf08c52,0x84118c31,0x94938c72,0x7bd08431,0x83f08410,0x84118410,0x8c518c52,0x84318410,0x8c728c52,0x9cf49492,0x84318c51,0x7bf08431,0x949294b3,0x9cd38c51,
-0x9492a4f4,0x94b294b2,0x94728410,0x94728431,0x8c72a4f4,0x841183f0,0x9cf48431,0x9cd39cf4,0x8c7194b3,0x8c519cd3,0xb5979cf4,0xad769cd3,0xad56d69b,0x84118431,0x94929492,0x94b28c51,0x94b39cd4,0x94929472,0x84318c52,0x8c528c72,0x8c728c51,0x9cf49492,0x9cf3a535,0x84108c51,0x7bf08c51,0x94b38410,0xa5148c51,0xce59bdd7,0xad55ad75,0x73ae94b2,0x7bcf8410,0x7bef7bcf,
-0x8c518c71,0x94b28c51,0x8c519492,0x84108430,0x7bef7bcf,0x8c518c51,0x8c518c71,0x7bef7bef,0x8c317bf0,0x8c318430,0x8c5183f0,0x8c518c51,0x7bcf9472,0x8c727bf0,0x84308c71,0x94b29492,0x949294b2,0x7bef94b2,0x84308430,0xa5138c30,0x840f8c30,0x9471738d,0x9471a4f4,0x8c519451,0x9cb3a514,0x8c518c51,0x84108c52,0x94b38411,0x9cf4a535,0x94b3a535,0x9cd49472,0x9cf49cb3,
-0x9cb38c32,0xa515a514,0x8c718c72,0x9471a514,0x8c517bcf,0x73af9cd3,0x7bd07bf0,0x8c529472,0x9cd39492,0x94939492,0xce399cd4,0xa514d67a,0x94929492,0x9cd39492,0x94b29492,0xa5349492,0xce39b596,0xbdf8ce5a,0xd69bad56,0xc619ce7a,0xc639d6bb,0xce59ce7a,0xa535bdf8,0xb576a535,0x9cb3ad55,0x94b29cd3,0x94728c71,0x9cd38c72,0x8c51ad55,0x9cf48c72,0xad359cd4,0xbdd8ad56,
-0xc5f8c619,0xb597bdf8,0xbdf8a535,0xb5b7ce5a,0xa5359cf4,0xc618b596,0x9cf4b5b7,0x9cd3ad35,0x9cd29491,0xa5139cd2,0xad34a4f3,0xad55ad34,0x9cb2a4f3,0x94929472,0xad34ad34,0x9cb2a4f3,0xa4f39cd3,0x94729cd3,0xad359472,0x8c529cd4,0x94729472,0x94929493,0xad769472,0x84319cb3,0x9cd49493,0x9cd48c52,0x9cd49cd3,0x8c319472,0x84108431,0x8c318411,0x8c318410,0x8c318431,
-0x84118410,0x94b39472,0x8c529492,0x94b38c52,0x84118c52,0x94b38431,0x94929492,0x8c718c72,0xa4f39492,0x841083f0,0x8c318410,0x84318411,0x9cd48c72,0x9cd48c31,0x7baf7bf0,0x84108411,0x84318411,0x84318c72,0x83f08411,0x7bf08431,0x7bd08410,0x8c527bf0,0x7bd08c72,0x7bcf7bd0,0x84107baf,0x73af8431,0x84317bf0,0x9cf48c52,0x7bcf9472,0x8c5273af,0x94929cb3,0x94729cf4,
-0x94929cb3,0x8c51a4f4,0x84108410,0x8c528c51,0xa5159cd4,0x94929cd3,0x7c107c10,0x9cf4a515,0x8c718c51,0x94b39472,0xb5b79cf4,0x8431b597,0xd6bb9cd4,0x7bd0a514,0x94b38c51,0x94929492,0x94929cd4,0x84119492,0x8c728410,0x7bf08c52,0x94928c31,0x8c719492,0x94929492,0x84308c51,0x8c729493,0x94b38c72,0x94929492,0xb5969cf4,0xb5b6ce59,0x7befa534,0x7bef73ae,0x8c517bcf,
-0x9cf38c51,0x84108410,0x94b29492,0x841094b2,0x7bcf73ae,0x84308430,0x84108c51,0x94928410,0x84108c51,0x8c518c51,0x8c718c31,0x84109492,0x94518410,0x8c519472,0x94729472,0x9cb39cb3,0x94929cd3,0x94b294b2,0x8c508410,0x94718c70,0x8c509cb2,0x8c30840f,0x9492a514,0x8c31a4d3,0x9c938c31,0x83f09472,0xa4f49472,0xa5359cd4,0x9cd39cd4,0x9cf49cf4,0x94728c72,0x94b39cf4,
-0x9cd4a515,0x8c519493,0x7bcf738f,0xa5148430,0x73ae83f0,0x8c518c51,0x7bcf8410,0x94939492,0xb5979cb3,0x94b39cd4,0x9cb39472,0xb5b7bdf8,0x9cf3a514,0xad55b576,0xa5148c71,0xa5149cf3,0xb5b7ad55,0xc619b5b7,0xb597bdd8,0xc639c639,0xc619ad76,0xbdd7c619,0xad76b5b7,0xad559cd4,0xa534bdd7,0x9cd38c51,0x9cf494b3,0x94b38c51,0xad55bdb7,0x8c519cd3,0x9cf4a515,0xb5b7ad35,
-0xc5f8ad56,0xad55b576,0xb5b7b597,0xce7ae6fd,0x9cd4ad35,0xa5149cd4,0xa514bdd7,0xbdb6a4d3,0xa514ad34,0xad54ad55,0xad34a514,0xa514a4f3,0xad34a514,0xa4d39cd3,0xa4d3a514,0xa4f4ad35,0xad55a4d3,0xad34bd96,0x9c928410,0x8c519cd3,0x94729cb3,0x9cd38c52,0x8c729472,0x7bd0a514,0x8c7273af,0x7bf0a4f4,0x9472a4f4,0x9cd383f0,0x8c729472,0x94728c31,0x83f0738e,0x738f83f0,
-0x8c517bcf,0x8c5294b3,0x8c728431,0x8c728c72,0x84118410,0x8c318c72,0x94928c72,0x94928c72,0x9cd38c51,0x7bef9492,0x8c728c51,0x8c318c52,0xb5b79cd4,0x9cd4ad56,0x73af7bf0,0x843183f0,0x7bd083f0,0x7bcf8411,0x84117baf,0x84108410,0x73af8410,0x94b37bd0,0x7bd09cf4,0x73af738f,0x73af738f,0x7bf07bd0,0x84118431,0x94b38431,0x7bd09493,0x9cf48410,0x84118411,0x9cb394b3,
-0x94929472,0x8c519492,0x8c518410,0x949294b3,0x9cd39492,0x94b3a4f4,0x8c527c10,0x8c728431,0x7bf08c72,0x94b38410,0x9cf49cd4,0xa4f4a515,0x8c317bf0,0x9cd3c639,0x84107bf0,0x94b38431,0x8c728c72,0x84319cd4,0x8c527bf0,0x84319493,0x94928c51,0x84318c52,0x94b38c71,0x8c519cd3,0x84117bcf,0x8c728410,0x9cf48c51,0x94b39cd3,0xbdf7ad75,0x8c71a514,0x843083f0,0x9cb28430,
-0x94b28c71,0x7bef9492,0xa5148410,0x8430a514,0x8430738e,0x84308430,0x8c718c71,0x94b29492,0xa4f4ad55,0x94b29cd3,0x94729cd3,0x94729472,0x9cb38410,0x8c319cd3,0x94928c31,0x9472a4f4,0xad55a514,0x8c7194b2,0x94b29491,0x9492ad34,0xad5483cf,0x8c30ad14,0x8c108410,0x9cb383cf,0x83f08c31,0xa4f49472,0xa515ad56,0x84118431,0xad359493,0x8c5294b3,0x94b39cd3,0x94938c52,
-0x94939472,0x8c519493,0x83f08c31,0x84109492,0x7bcf9cb2,0x843073ae,0x9cf49492,0xad769cd3,0x9cb38431,0x9cf4a535,0x7baf8c52,0xad568c72,0xb5b6ad56,0xc5f8bdd7,0x9cd39492,0x9cd394b3,0xad76ad35,0xa535a535,0xb597ce5a,0xbdd8a515,0xb5b7bdd8,0xc619ce7a,0x9cd4a515,0x8410ad56,0xc618ad55,0x9cb3ad75,0x949294b3,0xa514a534,0xa5149cd3,0x9cd39cf4,0x9cb3a4f4,0x9cb49cb3,
-0xc619b597,0xad56c5f8,0xbdd8b5b7,0xce5abdd8,0xad35ce5a,0xa4f49cd3,0xbdd7ad35,0xbdb7ad35,0xad55bdb6,0xa513ad55,0x9cd3a514,0xb575b575,0xad34a514,0xa514b575,0x94929cb2,0xa4f49cd3,0x9cd3ad14,0xc618ad55,0x7bcf9cb3,0x9cd38c51,0x8c529472,0x8c318c52,0x8c319493,0xa5157bf0,0x84118c51,0x8c728c52,0x84318c52,0x94b38c51,0x94929472,0x84318c72,0x7bcf7baf,0x7bd08431,
-0x84317bd0,0x84318c72,0x8c518410,0x8c518c51,0x94929493,0x84318c51,0x8c519cd3,0x84309492,0x8c518410,0x84318c51,0x84108c51,0x8c5273af,0x94938c31,0x9493c619,0x94b38410,0x84108411,0x7bf08411,0x8c517bd0,0x84108c51,0x84108410,0x7bf08410,0x94b37bf0,0x738f9cf4,0x7bcf6b2d,0x83f07bf0,0x738f7bcf,0x94728c51,0x947283f0,0x7bf08c52,0xd67a83f0,0x8c31a535,0x94928410,
-0x8c518411,0x84318c71,0x84318431,0x9cf4a535,0x9cd38c72,0x9493a514,0x8c5294b3,0x84108451,0x94b38c51,0x8c519cd3,0x8c728c72,0x9cb38411,0x83f094b3,0xb5b78c72,0x84109492,0x84318431,0x8c519492,0x9cb39472,0x8c519472,0x94b39cd4,0x94928c52,0xad359cd3,0xa514a535,0x9cd3a514,0x73af9492,0x84317bd0,0x8c928c72,0x94b39cf4,0xa5359cd3,0x8c51ad55,0x8c518410,0x94718430,
-0x8c718430,0x84109492,0x7bf06b6e,0x7bef8431,0x6b6d73ae,0x8c517bcf,0x9cf38c51,0xa514ad34,0xb576a514,0x8c719492,0x8c3194b2,0x84108c51,0x8c318c51,0x8c718c51,0x8c318c51,0xa4f48c51,0xc5f89cd3,0x9cd3bdb7,0x9cd3a514,0x94919cd3,0x94718410,0xa514bdd7,0x7baf8c31,0x9c9283f0,0x8c31a4d3,0xad358411,0x9472b576,0xa5148c51,0x94727bf0,0x94929492,0xad569cd4,0x9cd49472,
-0x8c528c52,0x8c519cb3,0x84108410,0x7bef8410,0x9cf38430,0x738e73af,0x94929492,0xad357bd0,0x8c528c31,0xad76ad76,0x8c319492,0xa5148c31,0xc618ad76,0x9cd3bdb7,0xa4f494b3,0x9cd39cd4,0xce7ab596,0xa515b576,0xdebbbdd7,0x9cf4bdd7,0xce5abdf8,0xa514a535,0xa514a535,0xc618b596,0xad55ad35,0xad34ad35,0xad559472,0xad55ce79,0x9cb39cd3,0xad35a514,0xa4f4a514,0xa5149cd4,
-0xbdb7a514,0xad35a514,0xbdd8b576,0xa515ad56,0xbdd7ce5a,0xa514ad55,0xb5969cd3,0xad76c5f8,0xbdd7a514,0xa514b575,0xa514a4f3,0xa514ad55,0xad75a534,0xa514ad35,0x9cb39cb3,0xa5149cb3,0x9cd3a513,0xa5149cb2,0x8c51a4f4,0x8c318410,0x8c728c51,0x94938431,0x8c319472,0x8c528c52,0x8c529cd4,0x84117bd0,0x8c729493,0x8c319472,0x8c318410,0x8c518c52,0x7bd07bf0,0x84118411,
-0x949283f0,0x94939cd3,0x947294b3,0x94929493,0x94938c51,0x94939cd4,0x94b38c51,0x7bf08c51,0x84318c51,0x8c518c51,0x8c528c72,0x73af8c51,0xa5158c52,0x8c72ce5a,0x94938411,0x7bd0738f,0x7bd083f1,0x84117bd0,0x73af8411,0x8410738f,0x73af7bd0,0x84318410,0x73af8c72,0x73af6b4d,0x841073af,0x73af73af,0x83f07bf0,0x841083f0,0x84108410,0xbdd88c31,0x8c728c72,0x7bf08411,
-0x94928c51,0x94928431,0x94729472,0x9cd48c52,0x9cd49493,0x94929cd4,0x8c528c72,0x84107bf0,0x94928411,0x84318431,0x94b38c31,0x9492ad55,0xb5b79cb3,0xb5769cb3,0x8c72ce5a,0x83f07bf0,0x84318c51,0x94938431,0x94929492,0x9cf49492,0x94b394b3,0xb5b7a515,0xa535b596,0x9cd394b3,0x8c529cd4,0x84118c31,0x94938c72,0x9cf49cb3,0x94929492,0x94b39cd3,0x7bf07baf,0x8c528431,
-0x84108431,0x8c517bf0,0x84109492,0x84108c51,0x7bcf7bf0,0x843073af,0xa5349492,0x84108c51,0x84108c51,0x7baf8c51,0x8410738e,0x94929cb3,0x8c718c51,0x94729492,0x84108c31,0x94b28c31,0x9cd3b576,0xce59bdf7,0x9472b596,0x8c319cd3,0x83ef8410,0x9cb383f0,0x736e8c31,0x945183f0,0x94b29c92,0xad558c31,0x9492b5b7,0x8c728430,0x84318c52,0x8c528c52,0x8c528431,0x8c5294b4,
-0x84119cb4,0x8c318411,0x83f08411,0x73ae7bcf,0x94727bcf,0x84319492,0x7bcf83f0,0xa4f48c52,0x6b6e9492,0x9cb38411,0xad35bdf8,0x9cd39cb3,0xc6399cb3,0xb596defc,0xa5359cf4,0xad55b596,0xad769cf4,0xce39defc,0xa5149cd3,0xbdd7b5b7,0xc618ad76,0xa4f4bdb7,0xad359cd4,0xb5b7ad76,0x9cb3ce59,0xbdb78c71,0xce59ad55,0xa514bdf7,0xb5b6ad55,0xbdd7ad55,0x9cf4b596,0x9492a515,
-0x949294b3,0x9cb38c51,0xb597b576,0xad55bdb7,0xce59ad76,0xb596ce39,0xa514a4f4,0xc618b596,0xad34b576,0xb596b596,0xa4f4ad34,0xad75a514,0xa514ad75,0xa5149cd3,0xa514ad55,0x9cf3a514,0xad34a4f4,0x9cd3a4f4,0x94729492,0x8c519493,0x9cd38c72,0x9cd39493,0x94729cb3,0x8c528c52,0x94b38c52,0x83f08411,0x9cb39472,0x94928c31,0x8c3183f0,0x84319cb3,0x83f073af,0x7baf73af,
-0x8c727bf0,0x94b38c72,0x94b39cd4,0x8c528c51,0x8c3183f0,0x94928c51,0x8c519472,0x7bf08c72,0x84108431,0x8c529492,0x94b38c52,0x8c52a514,0xb5b78c72,0x8c52bdd8,0x7bf08431,0x84118410,0x83f18411,0x84118411,0x7bd07bf0,0x84318410,0x841094b3,0x84317bcf,0x738e8c51,0x7bcf6b4d,0x7bf07bcf,0x73af7bf0,0x84117bd0,0x8c317bcf,0x7bf07bf0,0xad558c72,0x8c518431,0x84118c52,
-0x94b38410,0x94928c51,0x94938411,0x94b394b3,0xa515ad35,0x94b3ad55,0x94728c52,0x843194b3,0x841183f0,0x94b394b3,0x9cd49493,0x94939cf4,0xb5769cb3,0x9cd3c619,0xb5979cd4,0x84318c72,0x84317bf0,0x7bd08c51,0x8c728431,0x84118c72,0x94938c72,0x9cd49cd4,0x9cf4a535,0x94939493,0xa5149cd3,0x84109492,0x8c318c52,0x94928431,0x94929cd3,0x8c729492,0x73af9492,0x94b38c52,
-0x84109492,0x8c517bcf,0xa5149492,0x94929cf4,0x738e7bcf,0x84107bcf,0x94929492,0x94b29492,0x8c728c51,0x84107bcf,0x8c3183f0,0x83f08c51,0x8c319472,0x84309cb3,0x8c519492,0x84108430,0xad559cd3,0xc618a514,0xa514d67a,0x9cd39472,0x8c518c31,0x8c108c51,0x8c5183f0,0x83f083d0,0x8c518c31,0xa5148410,0x94729cb3,0x8c51a514,0x94b39cd3,0x8c528c72,0x8c529493,0x94739493,
-0x8c329493,0x84318431,0x94b28c31,0x7bef8c71,0x7bef83ef,0xad55a535,0x7bf08411,0x9cb39492,0x6b4e8431,0xa5148411,0xad35b597,0x8c5294b3,0x9cf494b3,0xdedcd69a,0xad76ce59,0xa535a514,0x9cd39cd3,0xd67aad76,0xa4f4ad76,0xad76bdd8,0xa535ad56,0xa515ad76,0x94728c72,0xad55a515,0xdedbbdd7,0xb596ad75,0xc638e71c,0xad55b576,0xad55ad55,0xad35ad55,0x9cf4a514,0x84109492,
-0x8c519cd4,0x8c728c72,0xbdd8bdb7,0xce5ac639,0xbdd7b596,0xc639c5f8,0x9cf3b5b6,0xad359492,0xa4f3bdb6,0xad559cd3,0x9492a514,0xad559cf3,0xa514a514,0x9cd39cb3,0xa4f4ad76,0x9cf49cb3,0xa514a4f3,0xa514a514,0x84108c31,0x94b39cf4,0x8c728431,0x8c729493,0x841183f0,0x83f08411,0x84118c31,0x9cb38410,0x8c318c51,0x9492a4f4,0xad55a514,0x9cd4a535,0x8c728c72,0x7bf08410,
-0x8c528c51,0x9cf49493,0x8c528c72,0x84118c52,0x8c528431,0x8c529492,0x94b394b3,0x84118c72,0x84318431,0x8c728c72,0x843183f0,0x9cf49493,0x8c728c31,0x8431c639,0x84317bd0,0x84118c52,0x7bd083f1,0x8c527bf1,0x84318c52,0x83f08410,0x8c729cd3,0x8c5183f0,0x84107bcf,0x738e6b6e,0x7bef8c72,0x841073af,0x7baf73af,0x7bf07bf0,0x83f083f0,0x949294b3,0x8c527bf0,0x8c519492,
-0x7bcf8c31,0x949394b3,0xad768410,0xad35b576,0xa515a4f4,0x9cb3a535,0x94727bf0,0x8c7294b3,0x84118c31,0xa5158c72,0x8c52a515,0x8c518c72,0xa4f49cf4,0xbdb7b576,0x94b39493,0x8c72a515,0x84317bd0,0x7bf08431,0x8c728c51,0x84118c72,0x843173af,0x94b39493,0xa5159cf4,0x8c529493,0xa5359492,0x9cd4a535,0x8c5294b3,0x8c527bf0,0x94b39492,0x84119cd3,0x84118410,0x8c728431,
-0x84318410,0x84308431,0xbdf7a534,0x9cd3ad76,0x9492738e,0x8c518431,0x9cb39471,0xa5349cd3,0x9cb39cb3,0x8c519492,0x8c519cb3,0x8c517bf0,0x94929472,0x84108410,0x84108410,0x8c518c51,0xa51494b3,0xb5b7b5b6,0xbdd7d6bb,0x94929492,0x9cd39cb2,0x94518c51,0x9cb39cb3,0x9cb3a4d4,0xa4f483d0,0x9cd39472,0x7baf8c51,0x9cd39cf4,0x94b38c72,0x84118c72,0x9cf49493,0x94939cd4,
-0x8c529493,0x94728c31,0x9cd39472,0x8c519cb3,0x84308c71,0x84109cb3,0x84109cd3,0x8c51738f,0x8c528c31,0xa4f49493,0x94728c31,0xad559cb3,0x9493ad35,0xdebba4f4,0xbdb7e6fc,0xa535a535,0x9472a514,0x9cf494b3,0xad76b596,0xb597b597,0x94b3ad55,0xa5149492,0x9cb3b5b7,0x94728410,0xdedba514,0xd69ae73c,0xbdf7ffdf,0xb576bdd7,0xb596a534,0xad55bdd7,0x949394b3,0xa5149cd4,
-0x84319cd4,0x84108431,0xce39ad56,0xbdf8bdf8,0xb576ce39,0xc5f8ad55,0xad55c618,0x9cb39492,0xad55ad34,0x9cb29cb3,0x9cb29cd3,0x9cd39cf3,0xa5149cf4,0x94729cb3,0xa4f4a514,0x9cf494b2,0x9cd39cd3,0xa534a4f4,0x7bf09472,0x9cd49472,0x84318c31,0x94b39493,0x8c528c31,0x84108431,0x9cd38431,0x8c318c51,0x8c519cd3,0x9cd39cb3,0x9cd4a514,0x94b38c72,0x84108c72,0x94728410,
-0x94938c52,0xa5149cd4,0x8c72a535,0x8c528431,0x8c7294b3,0x9cf4a535,0x8c728c51,0x8c519493,0x8c318411,0x9cf48c52,0x7bf07bcf,0x94728c52,0x8c528411,0x8c31b576,0x8c727bf0,0x8c528c51,0x84118411,0x8c3183f1,0x8c5294b3,0x84117bd0,0x9cf49492,0x7bf08411,0x7bf07bcf,0x630c7bcf,0x8c517bf0,0x83f07bd0,0x84108431,0x8c518410,0x84119493,0x8c729cf4,0x94728431,0x94b38c72,
-0x7bf08c51,0x94728410,0xb576bdb7,0xce39b576,0x9cd4ad56,0x9cb3a514,0x84119472,0x8c528c52,0x8c7294b3,0x84108410,0xad35ad55,0x84318c72,0x9cf48c31,0xb5b78c72,0x73afad76,0x9cf48c52,0x7bcf8410,0x8411738e,0x94b39492,0x94b38c72,0x84118c72,0x94b38c72,0x9493a535,0x8c728c72,0x94929472,0xad76a535,0x9cd3a4f4,0x84318411,0x9cb39472,0x7bd0a535,0x84106b6e,0x8c728c52,
-0x7bef8410,0x8c717bcf,0x9cf49cd3,0x8c72a535,0x73ae7bef,0x8c518430,0x8c319492,0xa5149cb2,0x94928c72,0x9cd38c51,0x8c518c51,0x94928410,0x94b2a4f4,0x8c719cd3,0x9cb39cb3,0xa5349cd3,0x9cf3a535,0xc618b5b6,0xb596ad55,0x8430ad35,0xb5b68c71,0x8c51a4f4,0x94938c31,0xa514b576,0x83f08c11,0x8c519cd3,0x8c519492,0xb5768410,0x8410a4f4,0x84318411,0x94938431,0x8c52a4f5,
-0x94939493,0x94939472,0x94b28c72,0x8c319492,0x94928c31,0x84108c31,0x9cd49cb3,0x8c528410,0xa5149cd4,0x94939cd4,0x94b39cd3,0xd6bbad55,0xbdd7c618,0xa514a535,0xdedcc619,0xa514bdd8,0xa514a514,0xa514a515,0xc619ad76,0x9cd49cf4,0x9cd4ad76,0x8c528c72,0xa4f4ad55,0xa5358c72,0xad55ad75,0xef5dce79,0xad35ce59,0xc618c618,0xa514a4f3,0x9cf4a535,0x8c528c72,0xb5979cf4,
-0x9cd4ad56,0x949394b3,0xc6189492,0xc619c619,0xc5f8c618,0xad76b576,0xc618bdd7,0xa4f4ad76,0xad559cb2,0x9472ad55,0x9cf38c71,0x9cd39cf4,0x94b39cd3,0x9cb39cd3,0x9cd39492,0xa4f49cd3,0xa514a4d3,0x9cd39cf4,0x9cf4a535,0x8c728c52,0x8c529492,0x8c728431,0xa4f49cf4,0x94728c52,0x94729472,0x94729cb3,0xad55ad55,0xbdd7ad35,0x8c72ad55,0x8c518431,0x94729492,0x94938410,
-0x8c729492,0x94b38431,0x9493ad56,0x94938431,0x94b394b3,0x94938c31,0x94929cd3,0x94928c72,0x84318c72,0xb5b78411,0x8410ad55,0x8c528411,0x83f08c52,0x8c528c72,0x7bf09493,0x8c519492,0x8c728411,0x7bf08431,0x84318431,0x8c528410,0xce5994b3,0x8c7294b3,0x6b6e8410,0x632d6b6e,0x8410632d,0x84108c72,0x84317bf0,0x84117bd0,0x84318c52,0x8410b596,0x94928431,0x8c528c52,
-0x94929472,0x94928c51,0xb596c639,0xbdd8ad56,0xad56bdd8,0xad569cd4,0x9472a4f4,0x94938431,0x8c729cd4,0x84108431,0x94b38431,0x8c729cf4,0x8c728431,0x7bd08c52,0xa5149cf4,0x84117bd0,0x84309492,0x841073af,0x8c728c51,0x8c728c51,0x8c529cf4,0x94938411,0x94b38c52,0x94928c72,0x94929cf4,0xa51594b3,0xa4f49cf4,0x8c729cd3,0x9cb38c72,0x8c728c72,0x7bf06b6e,0x9cf48c51,
-0x73af73af,0xa5147bcf,0xa534ad75,0x9cd394b2,0x84108c72,0x8c518c51,0x9cb39492,0x8c7183f0,0x8c729cf3,0x9cf48431,0x8410a514,0x8c518c51,0x8c518c72,0x9cf39492,0xad75a4f4,0xa5149cd3,0xad55bdf8,0xbdd79cf3,0xa534c618,0xbdd7bdf7,0xa5149cf4,0x8431a514,0x9cd383f0,0x94928c51,0x7baf9472,0xa4d39cd3,0x94b39cd3,0x8c518c51,0x9472ad55,0x8c318411,0x84319493,0x8c729cb4,
-0x94938c32,0x9cf4a4f4,0x84108c51,0x7bcf8410,0x8c518c51,0x8c518c72,0x94728431,0xa515bdb7,0x94928c72,0x9cd39cf4,0x9493a4f4,0xdebbad35,0xb5b7c639,0x9492bdf8,0xc6398c72,0xa535d6bb,0xad7694b3,0xa515a535,0xa514ad76,0xa515a535,0xa5359493,0x94929493,0x8c318c51,0xc639bdd7,0xad55ad75,0xd69ace79,0xa514ce79,0xad35ad75,0x8c51a4f4,0x94928c71,0x8c528c72,0xa5159472,
-0xad35c619,0x9cf48431,0xad569472,0xc618b5b7,0xd69abdf8,0xb596ce39,0xc618ad75,0xa4f4c5f8,0x9cb39cb2,0xa514a4f4,0x9cb29cd3,0x9cf39cf3,0x94b394b2,0x9cd39cf4,0x9cb39492,0xa5149492,0x9c929cb3,0x94b29cb3,0xad55a4f4,0x7bd09492,0x94729472,0x84318c52,0xa5159493,0x94939cb4,0x84109472,0xa5159492,0xad56ad76,0xb576a535,0xb596ce5a,0x8c319cb3,0x94928c52,0x94928c72,
-0x94b39cd3,0x8c318411,0x8c728c72,0x8c728431,0x9cf49493,0x9cd49cb3,0x8c7294b3,0x9cb38c51,0x8c518c51,0xbdd79492,0x9cf4d69b,0xa515ad76,0x9472ad76,0x7bd073af,0x7bf0738f,0x9cd394b3,0x8c528431,0x8c528c52,0x8c528431,0x94929492,0xbdf88431,0x94b3bdd7,0x8410a515,0x6b4d6b4d,0x7bcf73af,0x94928c72,0x83f07bf0,0x7bf08411,0x94b38431,0x8411c619,0x94938c72,0x8c7294b3,
-0x7bcf8c51,0xad76a4f4,0xbdf8ad56,0xb597d69b,0xbdf8ad35,0x9cb3ad76,0x94b3ad56,0x94938431,0x9cf49cd3,0x7bf083f0,0x7bf08411,0x94938c72,0x7bf08c72,0x7bf09472,0x8c72738f,0x84109cd4,0x94928c31,0x841094b3,0x84117bf0,0x84118c51,0x84318431,0x94938c72,0x94938c72,0x949294b3,0xa535a515,0x94b39492,0x9cd394b3,0xa514ad55,0x94b39492,0x8c729492,0x8c319472,0xa4f49492,
-0x7bcf9492,0x94b38c71,0x94929cd3,0x84308c71,0x73ae8c72,0x94928410,0x9cd3a534,0x8c518c51,0x8c719cd3,0x94b28c72,0x8c7194b2,0x94927bf0,0x8c728410,0x9cd38c72,0x9472a4f4,0xa514a534,0xb5b7ad75,0xa535ad55,0xc639b596,0xbdd7bdf7,0x94b39cd3,0x94929cb3,0x94929492,0x94728431,0x9cd39cd4,0x8c529cd3,0x9cd38c31,0xa4f49cd3,0x9cd49472,0x83f09493,0x8c729472,0x94729493,
-0x94939493,0xa535a4f4,0x73af9472,0x7baf73af,0xa5148c31,0x9cf4a4f4,0x9cb39cb3,0xbdd8b597,0x8c519493,0xa514a4f4,0x8c729493,0xce5aa515,0xce5abdd7,0x94b3b5b7,0x8c318c31,0xce5abdd8,0xa514a515,0x94b39492,0x9cf49cf4,0xad56a514,0x9cd48c52,0xad55ad55,0xb596b596,0xbdf8ad55,0xc618bdd7,0xc638ce7a,0xc618bdb7,0x9492a514,0x9cf49cf3,0x9cf394b3,0x84109492,0x8c528c52,
-0x9493a514,0xa5148c72,0x8c529492,0xa5359492,0xce7ac5f8,0xce59d67a,0xad55ad76,0xb596bdd7,0x9cf3ad35,0xb5759cb3,0x9cd3ad76,0x94929cf3,0xa5149cd3,0x949294b2,0xa514a4f4,0xa5149cd4,0x9cb3a514,0xa535a4f4,0xad55a514,0x9472ad35,0x94728c52,0x9cf49cd4,0x9cd49472,0x9493a4f4,0x8c528411,0xad559cb3,0xb596b596,0xb576bdd7,0xbdd7bdb7,0xa535b5b7,0x94939cf4,0x8c729cd3,
-0xad769cb3,0x8c529cd4,0x8c518c52,0x94728410,0xad76a535,0x9cf4ad76,0x9cb39cf4,0x94928411,0x8c529cd3,0xad559cd4,0x8c52ce5a,0x9cd4ad56,0xb597ad76,0x6b6e8c52,0x7bd07bf0,0x94b39472,0x84118c51,0x84318411,0x84318411,0x8c518c52,0x8c527bd0,0x8c72a535,0xb5b7a535,0x6b4e8411,0x7bcf738f,0x8c5173af,0x84108c52,0x84318411,0x9cb38c52,0x8c52ad76,0x84109492,0x94b38c52,
-0x7bcf83f0,0xbdf89cb3,0xb596bdd7,0xd69be6fc,0xc5f8a4f4,0x9493ad56,0x94b39493,0x94938c72,0x9cd49cd3,0x8c5194b3,0x8c317bf0,0x94938410,0x83f09492,0x8c31738f,0x73af7bd0,0x8c519cd4,0x8430738f,0x8c5194b3,0x7bf07bf0,0x8c518c51,0x8c728c52,0xa53594b3,0x8c729cd4,0x9cb38431,0xad559cf4,0x94b39cd4,0x8c729493,0xa4f49cd4,0x94b39cd3,0x8c518c51,0x94b38c51,0x8c728c72,
-0x84318c51,0x8c517bef,0x8c718c51,0x7bcf8c71,0x94928410,0x94b29492,0x94719cd3,0xa4f39cb2,0x94928c51,0x8c719cd3,0x9cf39cd3,0x8c5194b3,0x949294b2,0x94b3a514,0xa4f49cf3,0xa5349cd3,0xad75ad55,0xad55bdd7,0xbdf8ad55,0xa514b5b7,0x9cf4ad76,0x9cd394b3,0x9492ad55,0x8c319472,0xad159cb3,0x84119452,0xad149472,0x9cd39cf3,0x8c518c52,0x94729cd4,0x8c317bd0,0x8c528c32,
-0x9cd49cf4,0x9cd39cd4,0x8c7294b3,0x84109492,0xad558c51,0x9cb3ad76,0xad35ad56,0xce39b576,0x8c72b5b7,0x94929492,0x8c5194b3,0xa5158c31,0xd6bbef5d,0xb596ce7a,0x8c729492,0xce59a4f4,0xad76d6bb,0x9492a535,0x94b39493,0x94939cf4,0xb5b7c639,0xb5979cf4,0xc619c639,0xbdf7c618,0xb596bdd8,0xbdd7b596,0xa5149cf4,0xa514c5f8,0x9cd39492,0x9cf4b596,0x94928c72,0x8c518431,
-0x7bd08410,0x9cb39cf4,0x8c728c31,0x84318c72,0xb597ad55,0xd69bb5b7,0xa515ce59,0xbdd7a535,0xbdd7c639,0x9492a514,0xa5359cd3,0x94729cd3,0xa5349cb3,0x8c5194b3,0xa4f49cd3,0xad35ad76,0xad75ad55,0xa535ad35,0xad55ad55,0xa535ad55,0x83f08c52,0xa5158c72,0x7bd08c52,0x94b38c31,0x94928c52,0x9cd39cd3,0xad55b597,0xc618b596,0xad55b596,0xad76bdd7,0xad55ad76,0x9cf4a535,
-0xa535a514,0x94b3a515,0x7bf08c51,0x9cf48c72,0x9cf4a535,0xad76a535,0x9cb3ad35,0x94b39cf4,0xad559472,0x84119cd4,0x9493d69b,0x9cd49cb3,0xa53594b3,0x7bf09cd4,0x83f07bf0,0x94928c31,0x9cd49cd3,0x7bf08c72,0x84117bd0,0x8c728c52,0x7bd09493,0x84119493,0xb5979472,0x7bafad76,0x6b6e6b6e,0x84317bcf,0x94728c52,0x8c518431,0xa5158c52,0x84319cb3,0x83f08410,0x94928c52,
-0x94939493,0xb596ad76,0xa535bdf8,0xd67abdd8,0x9cd4b5b7,0x9cd49cd4,0x94b38c52,0xad56b5b7,0x9cd3b596,0x94938c51,0x8c728c72,0x7baf7bcf,0x7bcf8431,0x73af73af,0x8c518410,0x84317bd0,0x7bef8c51,0x94b38411,0x73cf8431,0x8c927bf0,0x9cd494b3,0x843194b3,0x84518c72,0x94b38c51,0xa515ad55,0x9cd4a535,0x8c7294b3,0x94938c52,0xa4f4bdd7,0x94928410,0x94728c72,0x9492a514,
-0x84309492,0x8c518c51,0x94928c72,0x84308c51,0x84307bcf,0x94b29cf4,0x8c517bcf,0xad35ad34,0x8c729cf3,0xa5149cd3,0x9cd39cf3,0xa5359cf4,0xa5149cf3,0x9cd394b3,0x9cd39cd3,0xb596ad55,0x9cf4b596,0xad75a514,0xbdd7b5b6,0xb596c618,0xad76a534,0x9cd3a535,0xa5149cd4,0x8c728c72,0x94b39cb3,0x9cd3a4f4,0x94b39492,0xa4f4ad35,0xa514ad55,0x9cf4a514,0x94b39472,0x8c72a515,
-0x94938c52,0x8c319493,0x9cd48c72,0x9cf4a535,0x8c729492,0x94929492,0xb597a514,0xbdd8ad76,0x9492a514,0x8c728c72,0xa514a515,0xa5359493,0xffffdedb,0xbdd7bdd8,0xa514ad56,0xa5359cd3,0xc639c639,0x9cf4ad56,0x8c318c72,0x8c518c72,0xef5d9cd3,0xa535c639,0xc618ad56,0xad76ce59,0xa4f4a4f4,0xdedbb596,0xad358c72,0xbdd7b576,0x8c71a514,0x9cd39472,0x94929cd3,0x94929cb3,
-0x8c528c52,0xa5159493,0x8c319493,0x94938c72,0xad5594b3,0xbdb7b596,0xc639ce5a,0xad75b576,0xce59c618,0xa4f4ad76,0xad35a4f4,0x94b2a514,0xa5149493,0x9cb39cf4,0x947294b3,0xad559cd3,0x9cd39cb3,0x9cf4a535,0xa515a515,0xa5149493,0x8c319cd4,0x9cb38411,0x9493a514,0xa5148c72,0x9cf4a535,0xa5359cd3,0xad56c5f8,0xb597a515,0xad76ce7a,0xbdf8a514,0x9472ad76,0xad76ad76,
-0xa535a515,0x9cf4a515,0x7bd08c31,0x94938c52,0xad56ad56,0xbdd8a515,0x8c72a515,0xa5158c52,0x94b38c52,0x9cf4a535,0xa515ce7a,0x9cf473af,0xb597ad56,0x94939493,0x7bf08c52,0x8c528411,0x84118c72,0x84107bf0,0x8c729cf4,0x84318c72,0x8c728431,0x9cd48431,0xbdd88431,0x8c52ad35,0x73af8c51,0x8c527bcf,0x8c728c72,0x8c72ad76,0xad768411,0x84118c52,0x94b38c31,0x84118c31,
-0xad559cf4,0xa534a534,0xad55ad76,0xa535a535,0xb5b7d69b,0x9cd49cd4,0x94728c72,0xad769cf4,0x8c729cb3,0x8c528431,0xad3594b3,0x6b4d7bf0,0x7bf07bcf,0x84317bf0,0x8c527bd0,0x73af8410,0x84317bef,0x7bcf738e,0x84519cd3,0x84117bf0,0x949294b3,0x84318c72,0x94928c72,0x9cb37bd0,0xb5b7ad35,0xa535a514,0x9cb3ad76,0x94939492,0xb5b7a515,0x8c72a515,0xad559493,0x9cf49cd3,
-0x8c718430,0x94b29cd3,0x8c518430,0x94928c51,0x7bcf8c51,0x94928430,0x9cb38c30,0x9cd38c71,0x94b2a534,0xa5358c51,0x8c51a535,0xad76ad55,0x9cf4ad55,0xa514a535,0x9cb3a4f4,0xad55a4f4,0x9cd394b2,0xb59694b3,0xad75bdd7,0xad55ad76,0xad75ad75,0xad76b5b7,0xad569cd4,0xa4f4b596,0xad55a535,0xb5769472,0x94b2a514,0x9cd39cf4,0x9cd39cf4,0x9493ad55,0xa4f49cd3,0xa5359cf4,
-0x73af9cf4,0x8c728c52,0xa5159cd3,0x94b3ad55,0x8c518c51,0x94928411,0x94b39cd4,0xa515b596,0x9cf49cd3,0xa514ad56,0xa5159cd4,0xa5359cf4,0xd6bbbdd8,0x9cf4d6bb,0xa535bdf8,0x8c729472,0xb5978c72,0xa5359cd3,0xa514ad76,0x9493a4f4,0xc6189cd3,0xb596e73d,0xbdf8a514,0xad76c619,0xa515ad35,0xce399cd3,0x94729cf4,0xbdd79cd3,0xa534c638,0x94929492,0x8c72b576,0x94b38c72,
-0x843194b3,0x94928c51,0x8c319cd3,0x8c728c52,0xad559492,0xce59d67a,0xc618ad56,0xb596ce7a,0xbdd7bdd7,0xb596bdd7,0xa514a4f4,0xad35a534,0x949294b3,0x9cf49cb3,0x949294b3,0x9cd39cf4,0x8c519cf4,0xa5149492,0x9cd39cd3,0x9492a4f4,0x9cf4a515,0x7baf738e,0x7bf08431,0x94b39493,0xad76a4f4,0xad35b597,0xb597ad76,0xbdd7b597,0xbdd8c639,0xb597ad56,0xbdd7c618,0xad76bdb7,
-0xa53594b3,0x9493a535,0x84119472,0xa4f48c72,0xb5b7ad56,0xa535a515,0x8c7294b3,0x8c529493,0x8431a4f4,0xa5358431,0xdebbd6bb,0x9cd48c52,0xbdd8bdd8,0x8c729cf4,0x84108411,0x84108c31,0x8c528431,0x84107bf0,0x94939cd4,0x9cb38c52,0x94728c52,0x8c728431,0x949383f0,0x9cf49cf4,0x841094b3,0x949273af,0x84119cd3,0xa515a4f4,0xb5978431,0x83f08c31,0x94938431,0x8c728c31,
-0x9cd3a4f4,0xad75a514,0xb576b596,0xbdd7b596,0xdedcbdb7,0x94b3bdd8,0x8c5294b3,0x8c729493,0x8c5194b3,0x84108c31,0x94b38c51,0x84108c72,0x83f0738e,0x8c729472,0x84118431,0x84108c51,0x8c517bcf,0x7bf094b3,0x9cf47bcf,0x84318c52,0x94927c10,0x7c107bf0,0x84108c52,0x9cd39cd3,0xbdf89cd4,0x9472a515,0x9cd4ad55,0x94728c52,0xa5159cd4,0xb5b7b576,0x94929493,0x94729cf4,
-0x84107bef,0x94929cd3,0x84318c71,0x8c718c51,0x73af9cd3,0x94b2738e,0x9cb2ad75,0x8c308430,0xa51494b2,0x94929cf4,0xb5969cf4,0x94b394b3,0xa5149cd3,0x9cd394b2,0x94b39cd3,0x9cb38c71,0x8c52b597,0xb597a514,0xbdd7bdd7,0xa534b596,0xad55a514,0xbdd7bdd7,0xad35a535,0xbdf8bdd7,0xb597ad55,0xa535a514,0xbdf7bdf7,0x9cd3ad55,0x94b39492,0xa535ad76,0xad358c52,0x8c72a4f4,
-0x94b39cf4,0xad569cd4,0x9cd3bdf8,0xa5149cd3,0x94729cd3,0x7bd08c72,0xa5149493,0xbdb7a535,0x9cf49cd3,0x9cf4a515,0x84319cb3,0xbdd7a535,0x9cf4a514,0x949294b3,0xad769cb3,0x8c51a515,0x9cb38410,0xbdb7b597,0xc618b576,0x8c52b5b7,0x9cf49cd4,0xdebbb596,0x9cf4b5b7,0xa514b5b7,0x9cd4ad56,0xb5969cd3,0x94b39cf4,0xbdd794b3,0xc618b596,0x94b3ad76,0xad55ad76,0x9cd38c72,
-0x949394b3,0x8c528c52,0x9cd49493,0x8c729492,0x94b39472,0xdebbb596,0xad76bdd7,0xce59ce59,0xbdd7bdf7,0xbdd7b596,0xa4f4ad75,0xad55a514,0x8c519cd4,0xa4f49472,0x9cd39cd3,0x8c729cd4,0x9cb39cd3,0x9cd39cd4,0x9cf4a4f4,0x94b39472,0x94939493,0x7bcf8411,0x84107bd0,0x94b38c72,0xa4f483f0,0x9cb3ad56,0xb5b79cb3,0xce39c619,0xad76c639,0xbdb7b5b7,0xbdf8b596,0xa515c618,
-0xa535a515,0x9cf4ad76,0x94938c72,0xa535a4f4,0xad56ad56,0x9cd4a535,0x94b39493,0x9cd494b3,0xb576a515,0x94938431,0xffffbdf8,0xad56b5b7,0xbdd8b597,0x8411a535,0x8c51738e,0x9cf4ad55,0x8c728c52,0x84318431,0x94b38c72,0x9cf49473,0x84319473,0xad3694b4,0x7bd09472,0x94b38c52,0x84319cf4,0x8c318c51,0x84107bf0,0x9cf48c52,0xad769472,0x84317bf0,0x8c518431,0x9cf49493,
-0xa514b597,0xb596ad55,0xbdd7bdb7,0xc639bdd7,0xbdd8bdd8,0xbdf8bdd8,0xad56ad56,0x949394b3,0x94938c72,0x84317baf,0x8c528c51,0xa514a514,0x8c318c51,0x8c528c72,0x843183f0,0x73af7bcf,0x7bef8410,0x94928c51,0x7bf07bcf,0x9cf4a535,0x8c518c52,0x8c518c72,0x8c728c51,0x9cd39cf4,0xb5978c72,0x8c72ad56,0x9cf49cb3,0x94b39cd4,0x9cf494b3,0xce5aad35,0xa535ce59,0x94b39472,
-0x84108431,0x94b28410,0x9cf394b3,0x8c518c72,0x8c729492,0x94b38c72,0x94b2ad55,0x94719cd3,0xa51494b3,0x9cf3ad55,0xad758c71,0x94b2a514,0x94728c51,0xa5149cb3,0x9cb3b576,0x94b28c51,0xa535a535,0xc639a535,0xc619bdf8,0xa534c618,0x9cf49492,0xb5b7a535,0xad55b5b7,0xa4f4a514,0xad56ad56,0xad35a535,0xc618bdb7,0xa4f4b576,0xa51494b3,0x94939493,0x84319493,0xa4f4a515,
-0xad35ad56,0x9cd3a514,0x94b39cf4,0x94938431,0x949294b3,0x94929492,0xa51494b3,0x9cd49cf4,0xad35b596,0xa4f49cd3,0x94b394b3,0xbdd79492,0x9492ad76,0x94b39cd3,0x94939472,0x9cf4a535,0x8c518411,0xb5b7ad35,0xce39c639,0x9cd4bdd8,0xad559493,0xc6189cd3,0xad55e71c,0xbdb7a514,0xb576ad76,0xa4f4a515,0xad76ad55,0x9cf39cf3,0xb596a534,0xb576c639,0xa5359cf4,0x9cd3b596,
-0xa5359493,0xa5159cd4,0x9cf49cd4,0x94b3a515,0x8c529492,0xad559493,0xb596b596,0xc639ad35,0xad76c618,0xb596ad75,0xc639ce39,0xad35a514,0x9cb3a535,0x94928c72,0x9cd49cd4,0x94939cb3,0x9cd49cb3,0x8c51a514,0xad558c72,0x9492a514,0x9cd39493,0x94b3ad55,0x8c728c72,0x8c727bd0,0x94b39493,0x9cf49493,0xb597ad76,0xa515ad56,0x9cd4a515,0xad56ad76,0xa535a515,0xbdd8b597,
-0x9cf4ad56,0xa515a515,0x9cf48431,0xa515ad56,0x9cd49cd4,0xad569cd4,0x8c72a515,0xad359cb3,0xb5b7a535,0x8c72ad76,0xf79f8c31,0xad56c619,0xb5b7ad76,0x7bf0a515,0x9cb38410,0xad76b596,0x94b3a514,0x83f08c52,0x94938c52,0x94b49493,0x8c328c73,0x94938c52,0x84119472,0x8c52738f,0x9cd394b3,0x84318c72,0x7bd073af,0x8c528c52,0xad56a515,0x73af73af,0x8c728c31,0xa5148c51,
-0xad55b596,0xa514a514,0xbdb7b596,0xc618bdb7,0xb576c618,0xbdf8ad56,0x9cb3ad76,0x9cd49cf4,0x8c729472,0x841094b3,0x8c518411,0x9cf494b3,0x8c319cf4,0x73af7bf0,0x84318411,0x84108c51,0x7bcf8430,0x84307bcf,0x73af8c72,0xad768c51,0x84319cf4,0x94928411,0x8c728c72,0x84319492,0x9cf49493,0x9493a515,0xa4f48c52,0xb576ad76,0x9cf49cb3,0xad559cd3,0xc5f8c639,0x9cf49cd3,
-0x84109492,0x84308410,0x9cd39cd3,0x8c7294b3,0x84317bf0,0x9cf39cd3,0x9cd394b2,0x9cd39cb3,0x9472a535,0x9cd39472,0x94929cf4,0xbdb7ad75,0x8c519492,0xb596a535,0xad359cd3,0xa4f49492,0x9cb39cd4,0xbdd8c618,0xc619bdb7,0xad35c5f8,0x9cd39cb3,0xb596a534,0xb596ad76,0xa535bdb7,0xc63994b3,0xb5b7b576,0xb597bdf8,0xb596c5f8,0xa5149cf4,0x9cd3b576,0x94b39cd4,0xce5aa535,
-0x8c52ad76,0x94b38c72,0x94b38410,0x9cf4a535,0x94928c72,0x8c728431,0x8c728c72,0x94b39cd3,0x9cd39492,0x8c728c51,0x9cd38c72,0x8c728c72,0xa535ad55,0x8c518c72,0x94939cb3,0x9cd38c52,0x9cf39cd3,0x9cd39cd3,0xbdd7b596,0xb596b596,0x9cf4c619,0x84319cd4,0xef5da514,0xa514ad76,0xa515b576,0xad56ce39,0xa535ad56,0x8c519cd3,0xad76a535,0xce39b576,0x8c52a4f4,0xad76a514,
-0x8c319472,0x9cf494b3,0xa4f4a515,0xa535ad35,0x841194b3,0xa51494b3,0xbdf89cd3,0xa514bdf8,0xc638ce79,0xad35ad76,0xbdf8bdd8,0xa535b596,0xad55b576,0x94939cd4,0x9cd39cb3,0xad359cd4,0x9cd4a514,0xa535a4f4,0xa4f49cd3,0x9cd3b555,0xad359cd3,0xad55b576,0x9cb3a535,0x7bcf7bf0,0x94939cf4,0xa4f48c51,0xa515bdb7,0x94739cd4,0x8c727bd0,0x949394b3,0xa4f49cf4,0xce39b576,
-0xb597bdb7,0x9cd4a515,0xb57694b3,0xad76ad76,0xa4f4ad35,0xad5694b3,0x9493a515,0x9cf49493,0xad56b597,0xa515b5b7,0xc6398c72,0xb5b7ce7a,0xbdd8bdb7,0x738f94b3,0x84318431,0xad5594b3,0x9cd4ad56,0x6b4e8411,0x8411738f,0x94938431,0x8c73a4f5,0x8c528431,0xb597a515,0x7bcf9492,0x9cf48c72,0x94938c92,0x949394b3,0x8c528c52,0x94b3ad56,0x84319492,0x94937bf0,0xa5358c51,
-0xb596b5b6,0xa514a514,0xad35ad55,0xb576ad76,0xbdb794b3,0x9cf4ad76,0xa515a535,0x8c7294b3,0x8c529cf4,0x8c528431,0x94937bf0,0x9cd38c72,0xa535a515,0x84317bf0,0x841073af,0x8c729492,0x8c718430,0x7bf08c71,0x94b38431,0x8c517bf0,0x9492a535,0x8c728451,0x8c729cf4,0x84118431,0x8c728c52,0x94938c72,0xa5159493,0xb596a535,0x9492ad76,0x94939472,0xb5b79cb3,0x8c71ad76,
-0x8c518c51,0x8c518430,0x94928431,0x8c719492,0x7bef8410,0x9cf49492,0x8c5194b2,0xa5349492,0x8c51ad55,0x9cf38c51,0x9cd3b5b7,0xb5968c71,0x8c519cd3,0x9cb39cf3,0x94728c51,0x94b39472,0x94939cf4,0xc618ad35,0xb596b576,0xad35bdf8,0x8c3194b2,0xb5769cb3,0xc638bdd7,0xa535c639,0xc6399cd3,0xad55d67a,0xbdf8ad76,0xce59c618,0xad75ad55,0xc5f8bdb7,0xb597b597,0x9472ad56,
-0xa515ad76,0xa535a515,0x8c519cd4,0xad359cf4,0x949294b3,0x8c5294b3,0x8c7294b3,0xa5358c72,0xa4f4a535,0x9cd3b5b7,0xa5149cd3,0xa514a515,0xad7694b3,0x9493a514,0x8c7294b3,0x9cf494b3,0xa535b5b6,0x94b294b3,0xce59a514,0xb5b7ce39,0xad35c618,0x8c319cd4,0xad558c72,0xa514ce7a,0xa4f49473,0xd67ab576,0x8c52a535,0x9cf49493,0xad5594b3,0xad76b597,0xa515d67a,0xb5979492,
-0x8c72b5b7,0x8c528431,0x9cd49493,0x949294b3,0x9493ad55,0x9cf48c51,0xa5159472,0xb596ce39,0xb5b7b596,0xb5b7c639,0xbdb7ad56,0xad55b5b7,0xad55ad76,0xa515ad56,0x9cb39cb3,0xa5359cd4,0x9cb3a514,0xad559cd3,0x9472ad35,0xad359472,0x9cf49cf3,0xb596ad35,0xad55ad56,0x8431a514,0xa5149493,0x9cb3a514,0x94b39cd4,0x9493a4f5,0x8c738411,0x94b49cb4,0xad569cf4,0xad35bdb7,
-0xbdd8c5f8,0x9493a535,0xbdb7a535,0xb576b5b7,0xb597b5b7,0xa515ad56,0xa5359cb3,0x9cd49cd4,0xad56a535,0xa515a535,0x9cd49cb3,0xa4f4dedc,0xb5b7ad56,0x84119cf4,0x8c728c52,0x9cb39cd3,0xa515a515,0x94729cd4,0x84117bd0,0x9cb48c52,0x9cb49cd4,0x843294b3,0xb5b78c52,0x9472ce7a,0x94b38431,0x9cd49cf4,0xad76a515,0x843194b3,0x9cf4dedc,0x8c528c72,0x8c728431,0x9cf48c92,
-0xad75b596,0xbdd7ad55,0xad55b596,0xbdd8c5f8,0xb576ad56,0xa4f4ad76,0xad769493,0x84119cd4,0x94b39cb3,0x8c528411,0x841094b3,0x7bf08410,0x94928411,0x8c319492,0x83f07bd0,0x8c728c51,0x84109492,0x8c728431,0x8c728431,0x73af8c72,0xa5557bf0,0x94b38451,0x8c728c72,0x84318431,0x9cb38411,0x947294b3,0xad559493,0xa535a535,0xad55bdd7,0x8c729492,0x9cf49492,0x8c51a514,
-0x8c718431,0x8c519492,0x8c718c51,0x8c729492,0x94928c72,0x9cd39cf3,0x8c519492,0xad75a514,0xb576a514,0xa4f4ad55,0xad559492,0x8c51a535,0x9cd394b2,0x9cf38c31,0x8c519492,0x8c518c31,0xa5358c31,0xbdd7b597,0xad76ce39,0xbdb7c5f8,0xa514ad35,0xb596b576,0xbdd7bdb7,0xbdf8c618,0xb597a535,0xce7abdf8,0xa535ad56,0xa514b5b6,0xbdf7c638,0x9cd4ad55,0x8c529cd3,0x94738c52,
-0x9cd49493,0x9493a535,0x84319492,0x94937baf,0x8c5194b3,0x84318c72,0x7baf8410,0x8c318431,0x9cd39493,0x9cf4a4f4,0x8c728c52,0xb597ad35,0x9cd49cf4,0xad55b596,0x8c728c72,0x94728c51,0xa5349cf4,0xad75a534,0xce59bdb7,0xc619d69a,0xad55c5f8,0x9cb394b3,0x8c528c52,0xd6bbb5b7,0x9cd4a4f4,0xbdf8a535,0xad76d69a,0xbdb7a535,0x9cf494b3,0xa535ad55,0xd6bbd67a,0xa514ad76,
-0xb597b5b7,0x94938c52,0x94b39492,0x8c52a514,0xad559cf4,0x8c5194b3,0xa535a4f4,0xbdd79cf4,0xbdd7b596,0xc639c639,0xad55b5b7,0xb596bdd7,0xa535ad76,0xad56ad76,0x9cb39cf4,0x9cb394b3,0x9cd3ad35,0x9cd39cf4,0xad35a4f4,0xa514a514,0x9cb3ad14,0xad55a534,0xbdd7ad56,0x9cf4b5b7,0x8c727bf0,0x8c529cf4,0x9cd48432,0x84119cf5,0x94b38c72,0x9cf59cd4,0xad76ad35,0xa515b597,
-0xa515ad76,0x94b39cd4,0xb5b7ad56,0xb576bdd8,0xb5b7ad56,0xa515ad56,0x9cf49cf4,0xa515a535,0x9cd49cd4,0xa4f4ad56,0xa4f49493,0xad35ffdf,0xad56a4f4,0x7bd09493,0xa4f48c31,0x9493b596,0xa4f4a515,0x9cd4a515,0x84117bb0,0xa5159cd4,0x94939cd4,0x8c328c72,0x83f08411,0xe71cc619,0x94d38c51,0x94d39cd4,0xa5159493,0x8c52a515,0x9493bdd8,0x8c727bf0,0x9493a555,0xad768c92,
-0xb5b6b596,0xc618bdd7,0xad35b596,0xb5b7b5b7,0x9cf4b597,0xb576a535,0x94939cd4,0x9493a535,0x9cb48c52,0x7bd09472,0x7bd0738f,0x94728411,0x94728c72,0x9cd494b3,0x94b39492,0x94928c31,0x84319cf4,0x94929492,0x8c7294d3,0x9cf49492,0x8c728431,0x94b3ad55,0x94b394b3,0x94b39cf4,0x9cf49493,0x8c729cd4,0xa5359472,0xad76b597,0xc5f8ad56,0x8431a515,0x94938c72,0x9cf49cd3,
-0x8c518410,0x8c518c71,0x84318410,0x94b29492,0x94929492,0x9cd394b3,0xad759cd3,0x9cd39cd3,0xa534b5b6,0x84308c72,0x9cf38431,0xb5b6bdd7,0xad358c72,0x9cd3a4f4,0x9cf49492,0x8431a4f4,0xbdb89492,0xbdd8e71d,0xdedcc619,0xc5f8ce39,0xbdd7bdb7,0xb5b7c639,0xbdd7b596,0xc5f8c619,0xbdf8d67a,0xc639c618,0x9cd3c639,0xb596ad55,0xc618b576,0x8c529472,0x94929472,0x94727bd0,
-0x8c52a515,0xc618a515,0x843194b3,0x94729493,0x94728c51,0x8c318c52,0x8c318c51,0x83f08410,0x9cf48c51,0x9cb3a4f4,0x94b39cb3,0xa515a515,0x9493a514,0x9cf48c51,0x7bd094b3,0x8c517bf0,0xb5968c72,0xc618ffff,0x8c728c72,0xc619a514,0x9492ad35,0x843194b3,0x94b38c52,0xad568411,0x9473b597,0xbdf89472,0xce59bdd7,0x9cf4bdd8,0x9cd39cd4,0x9cd49493,0xb5b7b596,0xad55c5f8,
-0xb5769cd3,0xa535c619,0x94b394b3,0x9cf49cb3,0xa51494b3,0x94b3a515,0xb5769cd4,0xad35b597,0xad56bdd7,0xce59b5b7,0xb596ce7a,0xbdd7b596,0xb576c5f8,0xad76ad76,0xa514ad35,0x9cd49cb3,0xa5359cd4,0xa514a4f4,0xad35ad35,0x9492ad14,0x9c929451,0xa5149492,0xbdd7bdf8,0x94b3a4f4,0x83f08c52,0x94939cb3,0x94938411,0x84119493,0x738f7bd0,0xa4f58c52,0x9cf4a4f4,0xbdd8b577,
-0xa515b597,0xb5b79cf4,0xc619c5f8,0xbdf8c639,0x9cf4b5b7,0x94939cd4,0x8c529493,0xad7694b3,0xb5b7bdd8,0xa515ad56,0x94b39cd4,0xce5affff,0xbdd8a515,0x84119cd4,0xad559cd4,0xa515b5b7,0x94939493,0x9cd49cb4,0x949394b4,0x94b3a4f5,0x84118c52,0xa5159493,0x84119cf4,0xad5594b3,0x94939d14,0x8c929cf4,0x8c528431,0xad568c72,0x7bf0bdd8,0x84318451,0xa5359cf4,0xad969cf4,
-0xb596ad55,0xb5b7b5b7,0xa514ad76,0xad55a535,0xb596b596,0x94939cb3,0x94b3a4f4,0xb5b78431,0x84319cd4,0x94939493,0x6b6e7bd0,0x8c5294b3,0x9493a514,0x94b37bf0,0x8c52a514,0x8c519492,0x9cf39492,0x8c71a514,0x94928410,0x9cf49493,0x8c72bdd8,0xb5b7a514,0x94b394b3,0x9cd4ad56,0x84319493,0x8c728c31,0x9cd49cf4,0xb576ad55,0x9cf4b576,0xa4f4a535,0xa5149493,0x9cf3ad55,
-0x9492b596,0x8c318431,0x7bcf8c51,0x84318431,0x9cd39492,0x94b28c71,0xb595a514,0x9471a514,0x94728c31,0x94928c51,0x8c718c51,0xbdf794b2,0x9493c618,0x9cb39cd3,0x9cf49492,0x94939cb3,0xbdf89493,0xc639defc,0xc619ad76,0xc618ce7a,0xbdf8c618,0xbdf8ce59,0xb576ad76,0xce5abdd7,0xbdb7c619,0xad55ce7a,0xd69aa514,0xb575b5b6,0x8c51b575,0x94929cf4,0x7bd083f0,0x8c528c31,
-0xa4f494b3,0xa5159492,0x8410a515,0x9cb3a514,0x94728c51,0x94938c31,0x9cd48c72,0xbdf8a514,0x9cf4ce59,0xa535ad35,0xad769cd4,0x9cf4a535,0xa5149492,0x9cf49492,0x9cb3b5b7,0xa5358411,0xad35a514,0x8c52ad55,0x8c528c51,0x94b38411,0xb5b7a535,0xa4f4ad56,0x9cd39cd3,0x7bd08411,0xce5a9cb3,0xad76ad56,0xa515b5b7,0xa535c619,0x94929493,0xad5694b3,0xad359cd4,0xbdd7bdb7,
-0xa535b576,0xce7ab597,0x9493ad35,0x9cd48c51,0x8c7294b3,0xad559cf4,0x94b39472,0x9cd4a515,0xad769cf4,0xad56ad35,0xce39ce7a,0xad76a535,0xb576bdd8,0xad55b576,0xbd97b576,0xa4f4ad35,0x9cd48c52,0xa514a4f4,0xa4f4ad35,0xad35a514,0x947294b3,0x94939cb3,0xbdf8ad56,0x8c529cd4,0x94b3a515,0x8c728431,0x841194b3,0x7bf07bd0,0x7bf07bd0,0x7bd08411,0xbdd8a515,0xa535ad56,
-0xa515a535,0xb5b794b3,0xbdf8c619,0xb597bdb8,0x9cf5b577,0x9cd49cd4,0x94b39cb3,0xa5359cd4,0xd69bce7a,0xad76c618,0x9cd4a515,0xd6bbbdd8,0x9cd38431,0x94b394b3,0xb5b79cd4,0xa514a515,0x9cd494b3,0xad769cd4,0x9cf4a535,0x9cd4a535,0x94938c52,0xa535a515,0x9cd4a4f4,0x94b394b3,0xa5149493,0x84119cf4,0x8c528c52,0xad768c52,0x8c52b597,0x8c518431,0xad768431,0xad35c639,
-0xb596ad76,0xb597b596,0xb576bdd7,0xa515ad76,0xa535a535,0x94939cd4,0x8c528431,0x84319493,0x94929cf4,0xa51594b3,0x84119cd4,0x9cd48411,0x8c518c72,0x8431738e,0x9cd39493,0x8c318c51,0x94b38410,0x8c519cd3,0x9cf48431,0x8c72ad35,0xb596a514,0xa5358c51,0xa515bdd8,0x94b39cf4,0x84118c92,0x84318411,0xa51594b3,0xa535a515,0xa535ad56,0x9cd49cd4,0x8c519492,0xa5149cd3,
-0x9cf3b575,0x843183f0,0x8c518c72,0x7bcf73af,0x9cf48431,0x9cf39cf3,0xad75ad75,0x84309cb2,0x94728c31,0x94729492,0x949294b2,0xa514a514,0xad76ad55,0x94b38c72,0x94929cb3,0xa5159493,0x9cd49cf4,0xbdd8b5b7,0xad76ad76,0xef3dce5a,0xc619d6bb,0xbdf8b5b7,0xad56b597,0xb597b5b7,0xb597bdb7,0xbdd7c618,0xad55bdb7,0xbdb7c5f7,0x9471ad35,0xa5149cf3,0x7bf08c51,0x94939cd3,
-0x8c528411,0x9492ad76,0xad55a4f4,0x8c319cb3,0x8c318410,0x83f08411,0xad56ad56,0xce7aa535,0x9cf4d6bb,0x9cd38431,0xa4f4ad55,0xa514b596,0x9cf48431,0x8c729cd4,0xd69aa514,0x9cf4c618,0x84118431,0x9cd39cd4,0x9cb3a514,0x84318c31,0xad76a535,0xad76b596,0x94929cf4,0x94b39472,0xc6189cb3,0xad35e6fc,0xad76a515,0xb5b794b3,0x94b3ad56,0x9cd49cd4,0xa5159cd4,0xad56ad35,
-0xad35bdd8,0xbdd8ad56,0xb596ce59,0xa5149493,0x8c7294b3,0x9cd39472,0x8c729492,0xa51494b3,0x9cf4a4f4,0xb597b576,0xbdd8ad55,0xa535c619,0xad56ad35,0xad35b597,0xad56a515,0xad56ad35,0x94b394b3,0xad359cd4,0xa515a514,0xa4f4a514,0x9cb3a535,0x8c529493,0xbdb8a515,0x9cd4a515,0xa5159cd4,0x843194b3,0x8c5294b3,0x84118c52,0x8c529493,0x84118411,0xad5694b3,0x9493ad76,
-0x9cd49cf4,0xad359cf4,0xc619bdf9,0xad36b5b8,0xad36a536,0x9cb4a4f5,0xad76ad56,0xbdd8b597,0xce5ab5b7,0xa535bdf8,0xad55ad56,0xef7ebdf8,0x94b3a514,0x94928c31,0x8c728431,0xad35ad55,0xad769493,0xa4f4ad56,0xad76a535,0x9472ad56,0x9cd49493,0xad56ad56,0x9cf49cf4,0x843194b3,0xa51494b3,0x9cd4ad35,0x9cd49cd4,0xa53594b3,0xa51594b3,0x84318c51,0x9cb383f0,0xc618ce7a,
-0xad76a515,0xb596ad76,0xad76b597,0xa535a515,0xa535b576,0x9cd4a515,0x94928c52,0x94b39cf4,0x84318c31,0x9cd38c72,0x9cb39cf4,0x84118431,0x8c529cd4,0x84118c51,0x9cd48411,0x8431a515,0x8c518430,0x94929cf3,0x9cd39492,0x9cd49cd3,0x94928c72,0x94b3a535,0xbdd89cf4,0x949394b3,0x94939493,0x94939cd4,0xa5359493,0x9cf4ad35,0xad56ad56,0x84319493,0x9cd39492,0x9cf49cd3,
-0x73ae7bcf,0x83ef8c51,0x8c518c51,0x841073af,0x84308c51,0x8c7194b2,0x9cf3ad55,0x8410840f,0x94728c31,0x84318c71,0x8c519cd3,0x8c519492,0x94b38410,0x8c72a514,0xad3594b3,0x84318c52,0x9cb39cb3,0xad769cb3,0xb576b597,0xd69bc619,0xbdf8dedc,0xbdf8bdf8,0xc618bdf8,0xb597b597,0xbdb7bdf8,0xce59c618,0x9cd3b576,0xbdb7ad55,0x8c519471,0x8c519492,0x83f08c31,0x8c528411,
-0x9cf48c51,0xad76a514,0x9cb39493,0x9cf4ad55,0xa4f49cb3,0x94728c72,0xb576b5b7,0xb5769cd4,0x9cb3ad56,0x9cd38c72,0xb597a514,0xa535a535,0x7bf09472,0xa5149cf4,0xb5979cf4,0x9cd3ad76,0x84109492,0x8c518431,0x9cd39472,0x94b39cf4,0x8c529493,0xa51594b3,0xb596ad56,0xa535b597,0x9472a4f4,0xdebbbdd7,0x9cf4ad76,0xa535ad56,0x9cf4bdf8,0x9cd4a515,0xad56a4f4,0xa514ad76,
-0xb5b7b597,0x9cf4b597,0xd69abdd7,0x94d3a514,0x8c7294b3,0x94928c51,0x9cf49cf4,0x949294b3,0x9cd39493,0xb5769cd4,0xad56ad55,0xbdd8ce5a,0xad55ad76,0xb5b7b597,0xad56b576,0xb597ad35,0xad35a4f4,0x9cf49cd4,0xa4f4b576,0x9cf3a514,0x9cd39cb3,0x9cf4ad35,0xa5359cf4,0xad36a4f5,0x9cd49cd4,0x94b3a515,0x83f08c52,0xa51594b3,0x94b38c52,0x8c528431,0xa5359cb3,0xa515ad56,
-0x9cd49493,0xb59794b3,0xc5f9c619,0xb597c619,0xad569cd4,0xa515ad76,0xa5159cf4,0xb597ad76,0xad35b597,0x9cf4ad35,0xa51594b3,0xffffc618,0x9cf4bdf8,0xa4f49cf4,0xad56ad56,0xb576a515,0xa515a515,0x9cd49cf5,0x9cb49cb4,0x8c729cd4,0x94729cd4,0xbdd8a515,0xa515b597,0x94b39cd4,0xa5159492,0xad56ad55,0xa515ad56,0xce5aa535,0xb5978431,0x8c52ad55,0xad769493,0xce59b596,
-0x9cf4b5b7,0xb597b597,0xad76b597,0xad56ad35,0xa5159cd4,0x9cd49cf4,0x94b39d14,0x8c528431,0x7bcf7bd0,0x84318c51,0xa5158c72,0x7bf09493,0xb5978c52,0x84319cf4,0x8c727bf0,0xa535a514,0x8c728c72,0xad558c51,0xa535ad56,0x9cd4a4f4,0x9492b5d7,0xad7694b3,0x9cd49493,0x8431ad76,0x94928c72,0x9cd39cf4,0xa51594b3,0x94b3ad56,0xa5359cf4,0x841194b3,0x9cb38c51,0x9cf49cf4,
-0x7bae9492,0x9cd37bcf,0x73ae8410,0x84307bf0,0x84107bef,0xa5348410,0x9492ad55,0x84107bce,0x843083f0,0x94728410,0x84309cd3,0x8c518410,0x94728431,0xa5359cd4,0xa4f49472,0x94b39493,0x9cd49cf4,0xad568c72,0xb597bdd8,0xbdb7ad35,0xce5ac639,0xa515b597,0xce7ab597,0xbdd8ce7a,0xb597c5f8,0xd69ab597,0xc5f8b5b7,0x94719cb3,0x94719492,0x94729cb3,0x9cb38c31,0x8c529cd4,
-0xad559cd4,0xa5359cd4,0xad55d67a,0xad75c618,0x94729492,0x8c318431,0x9cd3b596,0xad55a514,0xbdb7b5b7,0x8c519cd4,0xa5359492,0xa514defc,0x9cd394b3,0x9cd39cb3,0x8c51ad35,0xa4f48c52,0x8c729492,0x8c528431,0x94928411,0x94b39cd4,0x8c728431,0xad55a4f4,0xbdd8ad76,0xc639ce59,0xa4f49cf4,0xc6199cd3,0x94b3dedb,0x9cd49cd4,0xad769cf4,0xa4f49cf4,0xa535ad56,0xa515ad76,
-0xb596ad56,0x9cd4b597,0xb597a515,0x9cf4c619,0x8c9294b3,0x9cf49cd4,0x94b39cd3,0x8c729cd4,0x94938431,0x9cd48431,0xa535b5b7,0xc5f8ad35,0xad56b597,0xad55ad35,0xb597b576,0xa4f4ad35,0xad55ad56,0xad35a514,0xad55a4f4,0xa514a4f4,0x9cd39cd3,0xa515ad35,0x9cd49cd4,0xa5159cd4,0x9493ad35,0xa5359493,0x84119493,0x9cd48c52,0x7bf07bd0,0x9cd49cd4,0x94b38c52,0x94938c52,
-0x94729493,0xb5979493,0xce5ac619,0xc5f9bdd8,0xad56a515,0xad56a536,0xa4f4a515,0xad56a515,0x9cf4b597,0x9cd494b3,0x9cb394b3,0xffdfb576,0x8c31defc,0x9cf4a4f4,0xbdb7ad35,0xad35a535,0xa515b597,0xa515a515,0x94939cd4,0xa4f49cb3,0x9cd4a4f4,0xad569cf4,0xa515ad56,0x9cd4a515,0xa5359493,0xad76a535,0xad56ad76,0xf79fc619,0xa535ad56,0x9cf4a4f4,0xad359472,0xbdd7bdd7,
-0xb576ad76,0xad769cd3,0xb576b597,0xad56a535,0x94939cf4,0x8c729493,0x8c728c72,0x84318431,0x8c529472,0x8c517bf0,0x8c729493,0x8c529493,0x84117bf0,0x8c31a4f4,0x7bcf83f0,0x9cb37bf0,0x8c519cf4,0x9cf49492,0xad76b576,0x94b3a535,0xbdf89cf4,0x9cd38c92,0x9493ad76,0xad569cd4,0x8c528c72,0x9cf49492,0x9cf49cf4,0x94b39cf4,0x9cf494b3,0x8c729cd4,0x843183f0,0x9cf49cf4,
-0xa514a514,0x94928c71,0x8c519492,0x8c517bf0,0x7bef8430,0x9cf38c71,0x9cf3b596,0x7bcf8430,0x8c318410,0xad359cd3,0x8c5194b2,0x94928c51,0x94728431,0x9cd49cb3,0x8c3194b3,0xad56a515,0xad769cf4,0xa535b597,0xbdd8ad56,0xa4f4a535,0xce5aad56,0xc619ce7a,0xd6bbc619,0xbdb7d6bb,0xad35ad55,0xd69aad55,0xb596bdf7,0x8c319cd3,0x94728c51,0x94928c51,0xad358c52,0x9cd4bdd8,
-0x94939cf4,0x94b2a4f4,0xef3cbdd7,0x9472a4f3,0x7bf09cf4,0x94728431,0x94b3a4f4,0xb5b7ad76,0xa535bdd7,0x8c519493,0xa5159493,0xbdd8d69a,0xad359cd4,0x84109cd4,0x9cd39492,0x8c729492,0x9cd39cf4,0x8c718c51,0x94928c52,0x9cf4a4f4,0x94938c72,0xad569cd3,0xce5ab5b7,0xd69ace7a,0xb576c618,0x9cd4b576,0xc639bdb7,0x8c528c52,0x9cb39493,0x94b3a535,0x9cd48c72,0xb597a515,
-0x9cd4bdf8,0xb5b7a535,0xad569cd4,0xc639b5b7,0x9493a535,0x9cd49cd4,0x8c528c72,0x94b39cd4,0x949294b3,0x949394b3,0xbdd7ad55,0xad55a535,0xad56b597,0xa4f4a514,0xb576a535,0xa4f4ad35,0xb576a514,0xad55a535,0xa514a514,0xa514ad55,0xa4d3a514,0xad55a514,0xa514a535,0xad56a535,0xa515ad56,0x9cd49493,0x94b3a4f4,0x94938431,0xa535ad35,0x94b39493,0x9cd49493,0x9cd4a515,
-0x94b39cd4,0xad569493,0xce5abdf8,0xb5b7bdd8,0xc5f9bdd8,0x94b3ad36,0x9cb49cd4,0xa5159493,0xad76b5b7,0xad76ad56,0xa4f4a515,0xce5aad56,0x9cd4ffdf,0x9cf49493,0xad35a4f4,0xb597bdb7,0xad569cd4,0x9493ad36,0x9cf49493,0x9cb49cd4,0xa515a515,0x94939cb3,0x9cd49493,0x9cf4a4f4,0xad56a515,0xad56a535,0xad56a515,0xce7ace5a,0xbdd8d67a,0xad7694b3,0xad35bdb7,0xc5f8ad55,
-0xa535a535,0xa535ad35,0xad56ad56,0xad35ad56,0xa535bdb7,0x8c729cf4,0x94938431,0x9cf49cd3,0x9cd394b3,0x94b394b3,0x9cf4a515,0x94b38c72,0x736e8c52,0x8c7283f0,0x83f07bf0,0x84316b6e,0x9cf49cb3,0x94b39cd3,0xa5359492,0x9cd4a514,0xa5358c72,0x8c72bdd7,0xb59794b3,0x94b39493,0x8c9294d3,0x9cf48c72,0x9cf4a515,0x9cd49cd4,0x9cd49cd4,0x8c729cd3,0x8c528410,0x9cf49cd3,
-0xbdd794b2,0x7befbdb6,0x9cf38c71,0x84108430,0x9cd38430,0x9cd394b2,0x9cd39cd3,0x7bcf9cd2,0x8c7283f0,0x9cd3a514,0x8c318430,0x84108c31,0x73af94b3,0x8c7273af,0x9cf494b3,0xb5b79cf4,0xb597b5b7,0xbdd8b5b7,0xa515b5b7,0xad56b597,0xb597ad35,0xdefcdebb,0xc618c639,0xbdf8bdf8,0xa514ad76,0xc6189cd3,0xa4f4bdd7,0xa5149cd3,0x94928c51,0x9cd38c72,0xbdd89cd4,0xc619c639,
-0xa514a535,0xa534a514,0xb596a534,0x8c72ad75,0xad558c51,0x8c727bcf,0x8c72ad35,0x9cf49492,0x9cd3a535,0xa5149cf4,0x94b39cf4,0xb597b5b7,0x9492a4f4,0x94b39cf4,0xa5148410,0xa514b576,0xb596a514,0x94b3ad76,0x84108c51,0xad359cf4,0x94b39cf4,0x8c728411,0xce7aa535,0xe71cdedb,0xc618dedb,0xad76b576,0xa53594b3,0x8c72b597,0x94b39493,0xad359cf4,0xa515ad76,0xbdd8b5b7,
-0xb5b7c619,0xad35ad55,0xad56b597,0xc639a535,0xa535bdf8,0x84318c72,0x9cd38c72,0x94929cd4,0x8c5294b3,0x8c729472,0xbdd79493,0xa515c619,0xad76ad76,0xad76b576,0xa515ad35,0xb596ad35,0xad55a514,0xa514bdd7,0xad34bdb6,0xad34ad34,0xad35a514,0xb5b6ad76,0xa514ad76,0xa535ad35,0xa535a515,0x9493a515,0x9cf494b3,0x94939cb3,0x94938c72,0x84319493,0xa51594b3,0x94728c52,
-0xa5159cd4,0xb577a535,0xb5b8c5f9,0xad56bdd8,0xb597a4f5,0x8c73b5b8,0xad369cb4,0x94b3ad56,0xb597ad76,0xa515b597,0xad7694b3,0xb597c5f8,0xc639e71d,0x8c528c72,0x9cb3a4f4,0x94b394b3,0x9cf49cb4,0x8c5294b4,0x94938c52,0x8c529473,0xad569493,0x84319cf4,0xa5158c72,0xad56b597,0xad76ad35,0xad56a535,0xad56ad56,0xb597ce5a,0xa535a515,0xb596ad55,0xd69bc619,0xa514b5b7,
-0x9cf4a535,0xce39b5b7,0xad56ad35,0xad76b576,0xad35a535,0x94b3a515,0x8c528c72,0x8c728431,0x84107bf0,0x9cd49cb3,0x9cd49cd4,0x84318c72,0x83f08c52,0x738e738f,0x83f07bf0,0x84108c51,0xad558431,0x9492ad35,0x949294b3,0xa4f4a4f4,0x841194b3,0xad5594b3,0x94b38c52,0x94b3c639,0x949294b3,0x94b38c92,0xa5359cf4,0xad76ad56,0xa4f4a515,0x8c72a4f4,0xa4f49492,0xa5149cd3,
-0xad359cd3,0x94b2a514,0x8c727bcf,0x8c51a514,0x9cf38430,0x9cd3b5b6,0x94719492,0x94929492,0x94728c31,0xa5149cd3,0x94b394b3,0x84319492,0x738e8410,0x841073af,0x9cd48c72,0x9cd4a535,0xb5b7bdf8,0xb5b7a535,0xa515b5b7,0xbdf8c5f8,0xb597b597,0xd69bb5b7,0xbdd7ce7a,0xb5b7bdf8,0xad56b597,0xc618ad76,0x9cd3b5b7,0xad559cf3,0x8c519cd3,0xa51494b3,0xc6189cb3,0xce7ac619,
-0x9cf4ad55,0xad55a514,0x9cd3b596,0xa535a4f4,0x9cb39492,0x9cb39cb3,0x9cf4a4f4,0x94928c51,0x841194b3,0xce7a9cf4,0x94b39cf4,0xa5149cf4,0xb5b7a535,0x94b3a515,0x84118c51,0xa514a4f4,0xa5149cf3,0x9cf3a514,0x84108c72,0x94728c51,0x8c728c31,0x8c518c51,0xad569493,0xe73dce5a,0xce5adefc,0x9492ad35,0x8c72b576,0xa51494b3,0x9cf494b3,0xb5979cf4,0xd67ae71d,0xbdf8b577,
-0xc619bdd7,0xa515b5b7,0xc639ad76,0xb5979cf4,0xb5b7bdf8,0x8c529cf4,0x9cd48c52,0x8c729cb3,0x94929472,0x94928c52,0xad769cd4,0xb597bdf8,0xb596a515,0xb596bdb7,0xad35ad35,0xb576ad56,0xad55a535,0xbdb7ad55,0xad55b575,0xa4f3ad55,0xb575ad55,0xa535ad34,0x9cf4a514,0x9cd4a535,0xa4f4a515,0x94b3a515,0x9cd48c72,0x8c529cd4,0x8c528411,0xa535ad56,0x94b39493,0x9cf49cd4,
-0x9cd49cd4,0xb597b5b8,0xad56bdd8,0xa4f59cf5,0x9cf59cf5,0xb597bdf9,0xd6bcb597,0xc619e71d,0xbdd8ad56,0x8c32ad36,0xa5159493,0xa515a535,0xffffffdf,0x8431a4f4,0x9cd48c52,0xa514a515,0x94b3ad56,0x9cd48c73,0x94939cd4,0x94939493,0x9cf494b3,0xa5159cf4,0x9cd4a515,0xb5b7ad56,0xad76a515,0xad76ad56,0xad76b597,0xb5b7d69b,0x9cf4bdd8,0xa5359cf4,0xb597a514,0xad76bdf8,
-0xad55a514,0xc619ad55,0xa515ce5a,0xad56ad76,0x9cf4a515,0x9cf4a515,0x7bf08c72,0x7bf08411,0x8c528c52,0xa5358c52,0x84119cd4,0x841194b3,0x9cb37bd0,0x6b4d7bf0,0xa5149cb3,0x9cd48410,0x9cd39492,0xa535ad55,0x9cd49cf4,0x9cd48c72,0x94939cd4,0x94937bf0,0x8431a515,0xbdf89cf4,0x8c929cf4,0x94b39492,0xad76a4f4,0xb5b7b597,0xad35a535,0x94b3a515,0x9cd39493,0xad35a514,
-0xa51494b2,0x94b2a514,0x73af8431,0x94929492,0x9cf39492,0xa514a514,0x8c719491,0xa5148c50,0x84319cb3,0xbdf89472,0xa4f4ad55,0x84109cd3,0x94928c51,0x94929493,0x7bd0738f,0xbdd89cd4,0xc5f8ad56,0xad56b5b7,0xbdf8ad76,0xb597b576,0xc5f8b597,0xad76b597,0xce7ac619,0xb597bdf8,0xbdd8bdd8,0xb597b5b7,0xad55c618,0x9cd3b576,0x9cb394b3,0x94928431,0xad569492,0xb5b7a535,
-0x94b3a535,0xa535a535,0xb5b6a535,0x94929492,0x9cd3c618,0xc5f8a4f4,0x94928431,0x8c519cd4,0xb5969493,0xb596dedb,0xa5149cf4,0x9cd49cf4,0xbdd8a535,0x8431bdd8,0xa535a535,0xa5349493,0xa514b5b7,0xb59694b2,0x94b294b3,0xef7ebdb7,0xc618f79f,0x8c5194b3,0x9cd49493,0xc619b576,0xbdd7debb,0xa4f4ad55,0x8c528c51,0x9cd49492,0x94b3b597,0xb5979cd4,0xdedcce39,0xbdd8b597,
-0xa535b597,0xbdd8b597,0xbdd8ad76,0xad76c619,0xbdd8bdd8,0x9cd4ad56,0x8c528431,0x8c728c72,0x8c728c52,0x94b394b3,0x9cf4a515,0xad558431,0xa535ad56,0xb576ad35,0xad56b576,0xad56ad55,0xa535a514,0xb576a514,0xb575b596,0xa514a4f3,0xad349cd3,0x9cd39cf3,0xa5359cf4,0xad55b5b7,0xa535ad56,0x9cd4a4f4,0xa5158c52,0xa515a515,0x8c528c72,0x8c728c52,0x84118c52,0xa5359cd4,
-0x9cb48c72,0xad76ad36,0x9cd4b577,0x84118c53,0x94939cd4,0xef5ec63a,0xbdd8c619,0xad77ad77,0xa515a535,0x94939cd4,0x9cb49cf4,0x9cf494b3,0xef7ec619,0x94729493,0x9cb39472,0x9cd4a515,0x94b49493,0x94938c72,0x94b49cf4,0x8c738c73,0x94b49493,0xad77a515,0x9493a515,0xad77a515,0xb576ad56,0xad76b576,0xa4f4a515,0x9cd4ce7a,0x9cf4b596,0xa535a515,0xa5159cd4,0xc619bdf8,
-0x9cd4a535,0xad76a535,0xc639ce5a,0x9cf49cf4,0xad56a535,0x949394b3,0x843194b3,0x94938411,0x9cd394b3,0x8c319493,0x9cd494b3,0x8c528c72,0x8c728411,0x84318c52,0x9492ad55,0xb5b78c52,0x94b3ad76,0xc618a535,0x9cd3b597,0x94929cd3,0x8c519cd4,0x84319493,0x9cf49493,0x9cd49493,0x94b3b5b7,0xa5159cd3,0xb576a535,0xb576ad76,0xad55a535,0x9cb39cd3,0x83f08411,0xad56ad55,
-0xa4f4a4f4,0x8c7194b3,0x94929492,0xa5148410,0x9cd3c638,0x94928c51,0x94929cf3,0x7bcf9492,0xa4f494b3,0xb597ad35,0x9492a514,0x84108c51,0x94928c51,0x9cf4a4f4,0x84318411,0xce7ba515,0xb576ce5a,0xb5b7b597,0xb576b597,0xad56b597,0xd69bc5f8,0xa515b597,0xc619bdd7,0xce59c639,0xad55b597,0xad76bdd8,0xbdd7d69b,0x9cb3ad35,0xa4f49492,0x8410a4f4,0xad559493,0x9493ad76,
-0xce5a9cb3,0xad76c619,0xb576ad75,0x8c72ad76,0xd69bad35,0xb5979472,0x8c519492,0xa51494b3,0xce5abdf8,0x9cf4b576,0x9472a4f4,0xad76b597,0xa4f49492,0xb5b7a535,0x9cb39cb3,0xa5149cf4,0xa514a535,0xc638a534,0x9cf4b5b6,0xb596a515,0xffffef7e,0xffffffdf,0xa515ce7a,0xad769493,0xc618c5f8,0xad35ad55,0x9493ad55,0x9cf4a514,0xbdf8ad55,0x94b39cf4,0xc5f8ad56,0x9cf4b5b8,
-0xbdb7ad35,0xad76a535,0xa535a515,0xbdf8b597,0x9cf4ad56,0xa5159cd4,0x8c729493,0x8c5294b3,0x94938c52,0xa5359cd4,0x8c729cb3,0x94728c52,0xa5359cd4,0xb597a535,0xad56b5b7,0xb596b597,0xa4f4ad55,0xa5149cf3,0xad55ad55,0xa514ad34,0xa4f3a513,0xa4f3ad34,0xa4f49492,0xad76a514,0xa515b597,0xa4f4ad56,0xa5358c52,0xa4f4b576,0x94729cf4,0x84318c52,0x8c529cd4,0xbdd894b3,
-0x94b39cd4,0xa515ad36,0x9473a535,0x8c5283f1,0x9cd48c52,0xc619ad56,0xa515ce3a,0xa5159cd4,0xa4f5a536,0x9cb49cb4,0x94939cf5,0x94939493,0xf77ead35,0x8c318c52,0x84119473,0x94937bd0,0x84329cb4,0x84318c52,0xa53694b4,0x94939cf5,0xa5369cf4,0xb597a536,0x94b4a536,0xa515a515,0x9cf49cd4,0xad56a535,0xad56ad56,0x9493debb,0xa5158c52,0xa535b597,0xad769cf4,0xce39ad76,
-0xa535c639,0xa515a515,0xbdf8ad76,0x94b3ad56,0xa535a515,0x94939cd4,0x94b39cd4,0x8c528c52,0x94928c52,0x8c729cd4,0xa4f48c72,0x8c52a535,0x8c72a515,0x9cf48431,0xa5149cd4,0xa5159cf4,0xa535a555,0xad558c72,0xad76c639,0xa5149cf4,0x9cd39493,0x949394b3,0x8c728c52,0x94729472,0xa535a555,0x9cd39493,0xa5359cf4,0xb576b596,0xad55bdd7,0x9cd4a515,0x84319492,0x9cd37bcf,
-0x9492a514,0x8c518430,0x9cd39492,0xad55a514,0xad75a535,0x8c518430,0xad559cd3,0x7bcf8c51,0xbdd78c51,0x9492bdf8,0x94b39492,0x9cd38c51,0x94928c51,0xa515ad35,0x9cf49493,0xa4f59cd4,0xce5abdd8,0xb597bdd8,0xa5159cf4,0xc639bdd8,0xc619b5b7,0xb597ce5a,0xbdd8ad56,0xc639ce5a,0xb596b5b7,0xce5ac619,0xad76bdb7,0x9cb3a535,0x949294b2,0x9cd4a514,0xa5359493,0x9cb3ad76,
-0xe73da4f4,0xce59e71c,0xa514ad76,0x9cf4b576,0xb57694b3,0xa515c619,0xc619ad55,0xad56a535,0x9cf4b597,0x9cd4ad35,0x9cd49472,0xb5b7bdd8,0xad55ad56,0x8c729cf4,0xb5769cd4,0x9cf4a4f4,0xc618ad55,0xb5b6c618,0xb596b5b7,0x94b39cd3,0x94928c72,0xd67ab5b7,0xffdfef5e,0x9cd4b5b7,0xb5b7ad35,0xbdb7bdb7,0xad35ad56,0xad55a514,0xc639ad55,0xa535c618,0xbdf8a4f4,0xa4f4ad36,
-0xce5abdd8,0xad76ad76,0xa515ad56,0x9cf59cd4,0x8c739cf5,0x9cf48c72,0xa535a535,0x8c729cd4,0x8c318431,0x8c5294b3,0x84118431,0x8c728c52,0x94b38431,0xa5159cf4,0xb597ad35,0xa535b5b7,0xad76ad35,0xa514ad76,0xad34a4f4,0xad55ad55,0xad54b575,0xa514a534,0xa5149cf3,0xad56a535,0xa535ad56,0xad56ad56,0x94b38c72,0x9cf4a535,0x949394b3,0x84118c52,0xa5158c72,0xa515ad76,
-0x94b39493,0xb577ad36,0x9473a515,0x7bf09493,0x9cd48c32,0xad56a515,0xb597debc,0x94939cd4,0x94739cf5,0x8c738c52,0x94939493,0x94939cd4,0xf79f9cf4,0x8c52ad76,0x94939cd4,0xad359493,0x84329cb4,0x84118c52,0x8c728c52,0xa515ad77,0xad569493,0x94b39cf5,0x9cf59cd4,0x9cf5a535,0x9cf49cd4,0xa515a515,0xad76a515,0xa515b5b7,0xad56b597,0x9cf4ad76,0xad769cf4,0x9cf4ad76,
-0xc619bdd8,0x9cf49cf4,0xa515a4f4,0xad76bdd8,0xa535a515,0x9cf49cf4,0x9cd4a515,0x7bf08411,0x7bf07bf0,0x8c527bd0,0x8c729493,0x94b39cf4,0x949383f0,0x8c528c52,0x9cd3ad56,0x94b38c72,0xad55ad96,0xb596a535,0xb5b7b5b7,0x9cf4a535,0x8c529493,0x94b39cf4,0x84318431,0x9cd48c72,0xa5149cf4,0x94b3a514,0x9cf49493,0xad559cd4,0xbdb7ad35,0xa514ad55,0x94729492,0x8c518c51,
-0x94928c51,0x9cb39492,0x94b39492,0xb596ad76,0x94b38c51,0x8c71a535,0xa4f38c71,0x8c51ad35,0xa5159cf3,0xa535a514,0x841094b3,0x9cd38c72,0x8c3194b3,0x9cf49493,0xb597ad56,0xad77b597,0xce5aad56,0xad56ce39,0xbdd8ad56,0xc619c619,0xbdd8c619,0xce39c619,0xbdd7bdd7,0xce59b576,0xc619d67a,0xb596ad76,0xbdd7d69b,0x94929cf4,0x9cb39cb3,0x8c519cf4,0x8c728c52,0x9cf49cd4,
-0xf79fce5a,0xd69aef5e,0xad35ad55,0x9cd394b3,0x8c31ad35,0xd69ba515,0xad35a515,0x8c52a515,0xad56a535,0x949394b3,0x84319492,0xc619ad76,0xa4f49cd3,0x94939492,0xb5b7ad76,0x94b3a514,0xa514a535,0xce59ad55,0xad76b596,0x9493b596,0x84319472,0x94b38c72,0xa5358c72,0x8c72bdd8,0xb576a4f4,0xb597b576,0xad55a535,0xb596a535,0xad56a535,0xce59bdd8,0x9cd49cd4,0x8c72a515,
-0xce59b576,0xc5f8bdd8,0xad76ad76,0x9cf4a535,0x9cf49cf4,0xa5159cf4,0xb5b7ad76,0x8c72a515,0x8c529472,0x84318c52,0x94938c52,0x94728c52,0x9cd49cf4,0xa5159cd4,0xb597ad76,0xb597b597,0xb576b5b7,0xa534ad55,0x9cd39cf4,0xb596a514,0xad55ad55,0xa534a534,0xa514a535,0xa4f4a515,0xad56a4f4,0xb597ad76,0x84318c72,0xa4f49cf4,0x8c5294b3,0x9cf49cf4,0xa4f49cd4,0xad56ad76,
-0x9cd48c72,0xa4f4ad56,0x94939cf4,0x8c528c52,0x9cd483f1,0x8c739493,0xc619e71d,0xad56a535,0xa4f59cb4,0x84119493,0x9cf49493,0x8c728c52,0xc6199493,0xa515ce39,0xa4f5a515,0xbdb7b597,0x949394b3,0x8c528c73,0x94938c52,0xb597a515,0x9cb4a515,0xa535a4f4,0x9cb394b3,0xa515ad35,0xa535ad56,0xad56a515,0xad769cd4,0xad55b596,0x9cd3b5b7,0xad569492,0x9cf4b596,0x9cf4ad35,
-0xb5979cb3,0x9cf4bdf8,0xa515a535,0xad76ad55,0xad76b5d7,0xa5159cf4,0x9cf4a535,0x94938c52,0x7bf08c31,0x841183f0,0x94938c72,0x8c728c72,0x83f073af,0x83f09493,0x843173af,0x94938c72,0xc639ad55,0xc618b5b7,0xad76ad76,0xa535ad56,0x8c529cf4,0x9cf49493,0x8c318c52,0x9cb38c31,0x9cd3a535,0xad769d14,0x9cf49cf4,0x94b3a514,0x9cf494b3,0xad56bdd7,0x94929cd3,0x94939472,
-0x8c518c31,0x94b3a514,0x94728c52,0x94929493,0x84108c51,0x9cf394b3,0x949294b2,0xb596a514,0x94b3a514,0xa5148410,0x8c31ad55,0x9cf48411,0x94939493,0x9cf49cd4,0xb597ad76,0xa515b597,0xad35ad56,0xd69bc5f8,0xc619c619,0xb597bdd8,0xce5abdf8,0xbdf8bdf8,0xbdf8c618,0xb597bdd8,0xce7ac639,0xa515ad76,0xd67ae6fc,0x9cb3a514,0xa5149cd3,0x9cf494b3,0x9cf49cf4,0xb5979cb3,
-0xd69ad69b,0xbdd7c619,0xb597ce59,0x9492a535,0xa51494b3,0xad769cd4,0xa514c619,0xa5159cb3,0xb5978c72,0x84319cd4,0x94728c31,0xc639b5b7,0x9cb3c618,0xbdb78c52,0xce7ac5f8,0xad76ce7a,0xad75a514,0xad769cd3,0x9cf4ce5a,0x9493a514,0x949394b3,0xa5159cd4,0x9cf49cf4,0xa535b597,0x9cd4a4f4,0xad56ad56,0xb5b7ad76,0x9cd49cd3,0xa535a515,0xad769cf4,0x8c72bdb7,0xa51594b3,
-0xce5aa514,0xc619bdf8,0xad76b597,0xad569cf4,0xad569cf4,0xad56b5b7,0xad56a535,0x9cd3a515,0x94b39cd4,0x94b394b3,0x94b38c52,0x84318c52,0x9cd49493,0x94939cd4,0xad569cf4,0xb597ad56,0xbdb7bdd8,0xa514b576,0xa4f49cd3,0xa514a514,0xad55a534,0xa4f4ad35,0x9cf4a514,0xad55a535,0xad76ad35,0xa535a535,0x94939cd4,0x9cf4a515,0x9cb39cd4,0xb5979cf4,0xad56a4f4,0x9cd49472,
-0xbdd8b5b7,0xad56c619,0x9cd49cd4,0xa5159cd4,0x94939493,0x84329493,0xb597a4f4,0xd67ad69b,0x9cf4a535,0xad36b577,0xbdf9b577,0x84118c52,0xb5979493,0xce5affff,0xbdd8b597,0xc619d67a,0x8c739473,0x84319473,0x949394b3,0x94938c72,0x9cd4ad36,0x9cf494b3,0x9cf4a535,0x9cd494b3,0x949394b3,0x9cf4a515,0xc5f8a535,0xa5359cf4,0x8c5194b3,0x9cf48c72,0xbdf8b597,0xad35a535,
-0xa515a515,0xdebbbdd8,0xad76bdd8,0xa514a535,0xb596b597,0xad56a535,0xa535ad76,0xad56a515,0x9493a515,0x8c5294b3,0xad359cd4,0x84119493,0x94b3ad35,0xa5159cd4,0x84319cd3,0xb5b7bdd7,0xbdd7ad55,0xb596c639,0x94d3ad76,0xad569cf4,0x8c52ad35,0x94b38c52,0x8c72a515,0x8c7294b3,0xa5359cd3,0xbdd7a535,0xa535b5b7,0x94b39cf4,0x9cd394b3,0xad769cb3,0x9493a514,0x94b39493,
-0x9cb39cd3,0xa5149492,0x84319493,0x8c51a535,0xa514a514,0x8c728c51,0x9cf3a514,0xa5358410,0x8c72bdd7,0x94929492,0x9cd4a515,0x8c528c72,0x9cd49cd3,0xad35b597,0xa515ad56,0x9cd49493,0xa5159cf4,0xc639b597,0xbdd8d69b,0xbdf8c619,0xc619b5b7,0xbdd8d69b,0xc639b5b7,0xb596d69b,0xce7ab5b7,0xad76d6bb,0xc619b5b7,0xad55bdf8,0xb5769cf4,0xce5ac618,0xad56c619,0xa535ad76,
-0xa515a535,0xc618a514,0xd67ace7a,0xa4f4bdd7,0x94b39cf4,0x9cb3ad35,0xf77ebdd7,0x9492a4f4,0xa4f4ad56,0x94b38c52,0xa5158c72,0xbdf8d69a,0xad768c52,0x9492a535,0xa5149492,0xf79eb596,0xb596ad76,0x94b3a535,0xbdf8b596,0xa5358431,0x9cd49cb3,0x9cd49cf4,0x9cd49cd4,0xa5149cd4,0x9cd4a4f4,0x9cb38c52,0xbdd7ad55,0xa534b5b7,0x9cf4ad75,0xa5359cd3,0xb596a514,0x9cd49472,
-0xc618b576,0xd69abdf8,0xad76b5b7,0xad56a515,0xa535ad56,0xb597b5b7,0x9cf4ad55,0xad76a514,0x94729cb3,0x94939cd4,0x8c728c52,0x841194b3,0x94b38c72,0x9cd4a515,0x94b394b3,0xa5359cb3,0xbdd8b597,0xa535bdb7,0xa514a4f4,0x9cb3a514,0xa534a4f4,0x9cd3ad35,0x9cf49cd4,0xad76a535,0xa535a535,0xa535ad56,0x9493a535,0x9cd49cd4,0x94b39cf4,0xa5159cb3,0xa535b576,0x8c528c72,
-0xc619ad56,0xa515bdb7,0x94939cd4,0x94b39cd4,0x94939cf4,0x8c729cd4,0xb5b78c52,0xce5ae71d,0xa4f5a515,0xa5158c72,0x9cd4ad35,0x94b394b3,0x9cf48c52,0xc619f7bf,0xbdd7bdd8,0x9cd4ad35,0xb597bdd8,0x9cb49cf5,0xa4f5a4f5,0xa4f4ad76,0xad569493,0x9493a515,0xad56a535,0x947294b3,0x94b49493,0x94939cd4,0xb5b79cd4,0x8c7294b3,0x94b39492,0xa5358c72,0xb5b7bdd8,0xad56ad35,
-0xad56b5b7,0xce39a535,0xbdd8c639,0x9cd4a555,0xb5b7a514,0xa535ad56,0x94b39cd4,0xa5159cf5,0x9cd4a535,0x9cd49cd4,0xad56a515,0x8431a535,0x9cf48c52,0xa51594b3,0x8c51b576,0xb5769cd3,0xad76ad76,0xb597ad76,0x9cf4a515,0x9cf494b3,0xa515ad35,0x9cd49493,0x94b39cd4,0x8c528c72,0xad559492,0xad76ad55,0xad76b597,0x94929cd4,0xa535a4f4,0x94939cd4,0x9493a515,0x8c529493,
-0x94929cf4,0x94b38c52,0x94729cf4,0xa4f49492,0x9cf494b3,0x8c52a4f4,0xa53594b3,0x9cb3ad55,0xbdd8ad55,0x94b38431,0xa5149492,0x9cf4b596,0xbdd8ad56,0xa515ad56,0x8c329cd4,0x9cb494b4,0xb5b7a536,0xc619bdb7,0xce5adebb,0xc619c619,0xb597c5f8,0xd67ac619,0xb597bdb7,0xce5abdf8,0xbdb7c639,0xd67ace5a,0xb596ce39,0xd67ab5b6,0xd69adedb,0xc619bdd8,0xa515a535,0x94b3a515,
-0xa5159492,0xce59c5f8,0xce59ce59,0xb576bdf7,0x8c51b596,0xb5979cb3,0xad769472,0xad55dedc,0xb597ad55,0x84318c72,0x9cd38c51,0x9cd3b597,0xb576bdf8,0x94729cd4,0xa535a4f4,0xd6bbbdb7,0xb597e71c,0x9472a514,0xc6199492,0x9493b5b7,0xbdd8ad76,0x8c729cf4,0x8c728411,0x94b39cf4,0x94939cb3,0x8c728c52,0xbdf89cb3,0xad76bdd7,0xad55a514,0x8c519492,0xa5359cd3,0xa4f4bdd8,
-0xbdf8ad76,0xad76ad56,0xad76a515,0xbdf8ad56,0xad56bdf8,0xb576ad76,0x9cd4b596,0xa5159cb3,0x949394b3,0x8c528c31,0x94939493,0xa4f49cd4,0x94939493,0xa515a535,0xad359cf4,0xa535ad56,0xb597ad76,0xbdd7b5b7,0xad35b597,0x9cf3a4f4,0x9cf49cd3,0x9cf4a514,0xa5159cf4,0xa535a515,0xa5159cf4,0xb5b7b5b7,0x8c72ad76,0xa5159493,0x94b3a515,0xad568c72,0x9cf4ad76,0x94939cd4,
-0xbdd894b3,0xa535b597,0xa4f4ad76,0x8c528c72,0x9cd49493,0x8c529493,0xa515a535,0x949394b3,0x9cd49cd4,0x9cd494b3,0x94b3a515,0x9cf48431,0x8c729cb3,0xef7ef7bf,0xb576b597,0xa4f4b596,0xb5b7b5b7,0x9493a515,0x94938432,0x9cd494b3,0x8c728c52,0x9cd49cf4,0x94b39493,0x94939cd4,0x9cf49cb4,0x94939473,0xad358c72,0x9cd3ad56,0x9cf49472,0xad55b576,0xad56ad56,0xa4f4ad56,
-0xad56ad56,0xa535bdb7,0xce5ac639,0x9cf4ad55,0xa555a514,0x94939cd4,0x84118c72,0x94b38c73,0x9cd494b3,0xa515a535,0x9cf49cf4,0x9493a4f4,0x94938c72,0x9cf49cd4,0xb596a515,0x94b39cd3,0xb597ad76,0xb5b7ad56,0xad56b5b7,0x9cd4a535,0xad56a515,0x9493ad76,0x8c319493,0x8c528c31,0xa5149492,0xa5359cf4,0xad55ad56,0x9cd4ad55,0xa535a514,0x9cd4ad56,0xad3594b3,0x841194b3,
-0x8c52bdd7,0xad359472,0x94b39cd3,0x94929cd4,0x949294b3,0xad76ad55,0x9cd39472,0xa4f4b596,0xad559492,0x94b3ad55,0xad5594b3,0xd69ac639,0x9cd4bdd8,0xa5359cf4,0x9cd4a4f5,0xbdb89cd4,0xbdd8c63a,0xb597ad76,0xef7eb597,0xce5ae71d,0xce5abdf8,0xce7ab597,0xad56c618,0xce39b5b7,0xc5f8ce7a,0xce39a515,0xffffe73d,0xdefbdedb,0xad35d69b,0x9cd48c52,0xb5b7bdd8,0xa535a536,
-0xce39bdf8,0xf79edebb,0xd69ac639,0xad75e71c,0xa5149cd3,0xbdb79492,0xa514a535,0xdefcce59,0xa5359cf4,0x94729cb3,0xad359cd3,0xbdd8bdd7,0x8c52bdd8,0xad558c52,0x94b3a4f4,0xce5ac5f8,0xffdfb576,0x8c52a535,0xad569cd4,0xad76b5b7,0xbdd8a535,0x9cd4bdb7,0x9cd49493,0x9cd48c72,0xa515a4f4,0x947294b3,0x9cf48c51,0xa535ad55,0xad75a535,0x9cd3ad55,0xa5149cf4,0x9cf4a515,
-0xb597a4f4,0xbdb7b597,0xb5b7ad56,0xb597b5b7,0xb597b5b7,0x9cf4a515,0x9cd4ad76,0x94939472,0xa5359cd4,0x9cd49cd4,0x94b39cf4,0xb5768c72,0x94b3a535,0x9cd49493,0xa515a535,0x9cd49cd4,0x9cf49cb4,0xb576ad35,0xad55b596,0x94b39cf4,0x9cf4a514,0xa5149cd4,0xa515a515,0xa515a535,0xa4f4a535,0xb597ad35,0x9cf4b597,0xa5159cb3,0x9cf4ad56,0x9cd49cd4,0x9cf4a515,0x94729cf4,
-0xa535a535,0xbdf8bdb7,0xa515b597,0x8c529472,0x8c318431,0x94b39493,0x9492a514,0x9cb39472,0x9cd4a535,0x9cf4a4f4,0x9cd49cd4,0x84319472,0x94938c51,0xdefcce7a,0xb576ad55,0xa4f4ad56,0xa5159cf4,0x9493b597,0x94939493,0x94728431,0x9493a4f4,0x94b38c52,0x94939cd4,0xa5359cb3,0x9cd49493,0x8c739493,0xad76a535,0xa5359cf4,0xa5159cf4,0xad55ad76,0xad56a535,0x9cd4b597,
-0x9cb49cf4,0xbdd8ad56,0xb5b7b597,0xa535ad96,0x9cf4a535,0x9cd49cd4,0x94b4a515,0x94b49493,0x9cf494b3,0xad56b576,0xa515ad56,0x9cd494b3,0x8c3194b3,0x9cf494b3,0x94b39cb3,0x94b3a535,0xad56a535,0xbdd8b597,0xc619ad76,0xad56ad76,0xa5159cf4,0x9cf4a515,0x8c728c72,0x94728c31,0xa5358c51,0xad559cf4,0xad55b597,0xb5b7ad55,0xa515ad55,0x9cf4a535,0x9cf4a515,0x8411a515,
-0xa514bdf8,0xb5979cd4,0x9cf4a535,0x9cd3a514,0xa5149cb3,0xa5359cd3,0xa4f4b576,0xad559cd3,0x9cd3a535,0xd69ab5b7,0xb5b7b576,0xbdd8ad56,0xa535c5f8,0xb5b79cf4,0xad77b597,0xb577b597,0xce5ac619,0xc5f8d69b,0xad76bdb7,0xdebbd69b,0xdedcc639,0xb597dedc,0xce7ac639,0xc618bdd8,0xef5ece7a,0xfffff79e,0xffffffff,0xad55d69a,0x9cd4ad55,0x94939492,0xc5f8b597,0xa535a535,
-0xd69ace39,0xc618c639,0xd6bad6ba,0x9cb3bdf7,0xa535ad55,0xbdf89492,0xbdd7a535,0xa535a535,0xb597e71d,0xa5159493,0xbdd89493,0xb596ffff,0xad359cd3,0x94929cf4,0xb5b79cf4,0xc618b5b7,0xd6bbb597,0xa514e71d,0xad559cb3,0xad76a515,0xad35bdd8,0xb597c5f8,0xad56ad35,0x94b39493,0x9cf4a515,0x9473a515,0x8c728c31,0xad759cf4,0xad559cf3,0xad55ad75,0x9cd3a514,0xad569cf4,
-0xb576a515,0xbdd8b576,0xb5b7b597,0xb597b597,0xad569cf4,0x94b39cf4,0xa4f4b596,0xa4f49cb3,0xa515a4f4,0xad56b5b7,0xa515a535,0x9cb39cd4,0xad56a515,0x949394b3,0xa535ad56,0x94939472,0x9cf49493,0xad76ad56,0xb576b576,0x9cf4ad35,0x9cb39cd3,0xad569493,0x9cf4a535,0x94b39cf4,0x94b39cf5,0x9cf48c72,0xa4f4a515,0x9cd49cd4,0x94b39cd4,0x947294b3,0x9cf48c52,0x9cb38c52,
-0x9cd49cd4,0xb5979cd4,0x8c72ad76,0x94938c72,0x84319493,0xa4f49cb3,0x9cb39472,0x9cd4a535,0xad56ad35,0x94b3a535,0x8c529493,0x94b39493,0x949294b3,0xdedcad55,0xa5159cf4,0x9cd4ad35,0x8c7294b3,0x84318c72,0x94938411,0x84318c52,0xa51594b3,0x9cd49cd4,0xa515a535,0x9cd49cd4,0x8c528c52,0x94938c52,0xad56bdf8,0xad76b596,0x9cf4b597,0xa535ad35,0xb5769cf4,0xa535a535,
-0xa515a535,0xa5359cf4,0xa515a535,0xb5d7ad56,0xa535ad55,0xa515b597,0xa535ad56,0x94b39cd4,0xa4f49cd4,0xb5769cd4,0xad56c619,0x94b39cd4,0x9cf494b3,0x9cd49cb3,0xa4f4ad55,0xb5769cd3,0xa535ad56,0xbdf8bdd8,0xbdd8ad76,0xad56ce5a,0x9cf4b597,0xa5158c72,0x9472a515,0x84318c52,0x94939492,0xad76a555,0xc5f8b596,0xb596b596,0xb576b596,0x94b3ad56,0x94939cd4,0x9cd48411,
-0xce599cd4,0xad76bdf8,0xad55bdd7,0x9cf49472,0x9cb3a515,0x9cd4a515,0xc618bdd7,0x8c519492,0xb597bdb7,0xc619ad76,0xb597ce5a,0x9cf5ad56,0xc619c5f9,0xbdd8bdb7,0xbdd8bdf8,0xbdd8b576,0xce5aad76,0xe71de73d,0xbdd7ce5a,0xd67abdb7,0xb5b7d6bb,0xdedce71d,0xbdd8a515,0xce7ac639,0xffffffdf,0xef5effdf,0xef7ec618,0xce59ef5d,0x9cd494b3,0x8c319cb3,0xa5158c52,0xb597bdb7,
-0xce39ce39,0xc618d679,0xce59d69a,0xad55ad75,0xad35b5b7,0xa5359cd3,0xa515ad56,0xad35c619,0xe73dbdf8,0x94b3a535,0xbdd8a4f4,0xad55b5b7,0x9cf4ad76,0xa51494b3,0x949294b3,0xbdb7b576,0xbdd8d69b,0xc618bdf8,0xb576a4f4,0xbdb7ad56,0xa515ad76,0xb5b7ad76,0xad56ad35,0x94939cd4,0xa515a515,0x9cd49cd4,0x9cd394b3,0x9cf49cd3,0xad769cf4,0x9cf4c618,0xa5149cd3,0xa535ad55,
-0xad56a515,0xa535b576,0xc619bdb7,0xb576a515,0x9cb39cf4,0xad569cf4,0xad35ad56,0xa5159cb3,0xa5159cd4,0x9cd4a515,0x9cd4a515,0x9cb49493,0xad779cd4,0xad56b597,0xa4f4ad55,0x9493a515,0x94938432,0xa5159493,0xad76ad56,0xa535b5b7,0x94b39cd4,0xa5369cd4,0x94b3a536,0x94b494b4,0x949394b4,0x94b49cd4,0x94939cd4,0x94b49493,0x94b394b4,0x8c739493,0x949394b4,0x94938c73,
-0x9cd4a515,0x94b39cf4,0xa515a515,0x9cd48c73,0x94939cb3,0x9cf48c72,0x9cd49cd4,0x9cf49cd4,0x9cf59cf4,0xc63ab5b8,0x9cf4b597,0xa515a515,0x8c729cd4,0xd6bb9493,0x8c72a515,0xad76a515,0x9cd49cf4,0x8c528431,0x8c328c32,0x94938c72,0x94739473,0xa535ad36,0xbdd8a535,0x8c72a4f4,0xa5159cf4,0xad569cd4,0xa515c619,0xad35a515,0xbdf8ad56,0xa5359cf4,0xa515b576,0xad35a535,
-0xa514ad56,0xa535ad55,0xa535a535,0xb597a4f4,0xad55a535,0x9cd3b597,0x8c928c92,0x94b394b3,0x9cf4a4f4,0x94938c72,0x9cb4a515,0x9cd48c72,0x9cd39cf4,0xa515ad35,0xb597a515,0xad56ad76,0xa535c619,0xad77a536,0xad77b597,0xce5abdd8,0xbdb7bdd7,0xad55ad56,0xa514a514,0x8c519493,0xa5148c72,0xbdf8b5b7,0xb596ad56,0xad76bdd8,0xbdf8bdb7,0x9cd3ad56,0x94928c52,0x84319472,
-0x9cd48c72,0xbdf8c639,0xa535b5b7,0x9cf49cf4,0xad56a535,0xa5159cf4,0xa535a515,0x94929cb3,0xce5aa535,0xa515bdd8,0xd69bc5f9,0xa515a515,0xc6399cf5,0xbdd8dedc,0xbdd8b597,0xbdd7c618,0xbdd8bdf9,0xd69bdebb,0xce5ad69a,0xad56b5b7,0xdefcd69a,0xbdd8bdd8,0xef5ee73d,0xffffffff,0xc639defc,0xd69ace7a,0xbdf8bdd7,0xd6bbef5d,0xa4f4c639,0x9cf494b3,0x94939cd3,0xd69bb596,
-0xce79e6fb,0xce59c618,0xc639c638,0xa514bdf8,0xbdf8c5f8,0xad35a515,0xa5159cf4,0xbdf9b577,0xb5b7b597,0xa515defc,0xbdf89cd4,0xad76a535,0x9cb3b5b7,0x9cd49492,0x9cf49cf4,0xc619ce7a,0xc639b5b7,0xd67abdb7,0xa4f4ef3d,0xbdd7b596,0xad76b5b7,0x9cd3ad76,0xad35ad56,0x9cd49cd4,0xa4f59493,0x94b39cf4,0xad769cf4,0xa4f4b5b7,0xb5b794b3,0xa515bdd7,0x9cd39cd3,0xa4f4a535,
-0xad779cf4,0x94b3b5b7,0xa5359493,0xa4f4a4f4,0xa5159493,0xad569cd4,0x94b39cf4,0xa5159cd3,0x94939cd4,0x94939493,0x949394b4,0x94b49cb4,0x8c73a4f5,0xa535a515,0x94b39cd3,0xad559cd3,0x8c729cd4,0x94938c73,0xbdd8a535,0xad56b597,0xa515ad56,0x94b39cd4,0x9cd49cf4,0xa5369cf5,0xad569cf4,0xa515ad56,0x9cf49cd4,0x9cd49cd4,0x94939cd4,0x94b49493,0x9cd49cd4,0xa53694b4,
-0xa515a515,0x8c729cd4,0x9cf58c52,0x8c529493,0x94939cf4,0x8c729cd4,0x94938c52,0xa51594b3,0x9cd49cd4,0xb5b894b3,0xb577bdd8,0x9cd4ad76,0x9cd4ad56,0xb5b79472,0x8c32ad36,0x94b48c52,0xa4f49cf4,0x84318c52,0x8c528411,0x94939473,0x9cb48c72,0xa5359493,0x9cf49cf4,0xb576ad76,0xbdb7bdd8,0xa515ad35,0xad76bdf8,0xa5159cd4,0xad56ad56,0x9cd4a515,0xb576bdd8,0x94b39cd4,
-0xa5149cf4,0xad55a535,0xad76ad76,0x9492b576,0xad9694d3,0x94d3ad56,0x8c9394b3,0x9cf49cf4,0x94b3a514,0x9cd49472,0x94938c52,0x9cb39cd4,0x9cd394b3,0xad55a4f4,0x9cf4a515,0xa535a536,0xad77a536,0xa535a536,0xb597b597,0xbdd8b597,0xc618ce5a,0x9cd4a515,0xb596b5b7,0x94b3a534,0x94b38c72,0xbdd7b596,0xa535b597,0xad56b597,0xb5b7bdd7,0x8c51a514,0x83f07baf,0x949394b3,
-0x9492b5b7,0xd69aa4f4,0xa535c5f8,0x9cd494b3,0xad359cf4,0xa515b597,0x9cf49cf4,0xa515ad56,0xbdd88c72,0xad76c619,0xbdb8ad56,0xad56c5f9,0xb597b577,0xc639d69b,0xbdd8b5b7,0xbdf8c618,0xc5f9bdf9,0xce5abdf8,0xce5ac639,0xbdb7c639,0xffffbdd7,0xf79ef7bf,0xffdfffff,0xc619bdd8,0xad76b5b7,0xbdf8b597,0xc659d6bb,0xe6fcc639,0xb596defc,0xb5979cb3,0xa535b576,0xd67aad56,
-0xd6bae73c,0xc638ce59,0xbdd7c638,0xad76bdf8,0xbdd7b5b7,0xbdb7b596,0xa515b597,0x9cf49cd4,0xad76c639,0xdedba514,0xb596ad76,0xa5159cd3,0xad55a535,0x94b39cf4,0xa5358c72,0xb5b7b5b7,0xb597bdb7,0xc618d69a,0xdefcce5a,0xbdd8b596,0xad56b576,0xa515ad56,0xbdd8ad56,0x94b3a4f4,0x94b3ad56,0xa535a515,0xa5159cf4,0xa514b576,0x94b38c72,0xa514ad55,0x9cd3ad76,0xad569cd4,
-0xbdd8ad76,0xad76ad56,0x8c529493,0x9cf49493,0xa5359cf4,0xad56a535,0xb597ad76,0xa535a515,0xa515ad76,0x949394b4,0x9cd49cf4,0xa4f59cd4,0xa515a535,0xad358c72,0x8c72ad56,0xa51594b3,0x94b494b3,0x9cd494b3,0xa535ad56,0xad56a535,0xb597b597,0x94b4ad77,0x9cf49493,0x8c5294b4,0xa51594b4,0xad76bdd8,0x8c7394b4,0x9cd49cd4,0x8c739493,0x949394b4,0x949394b4,0x9cd494b4,
-0x9cf594b4,0x94b4a515,0x94939493,0x94939cd4,0xad568c52,0x94b3a515,0x94b39cd4,0x9cf494b3,0x94939cd4,0xa4f5a4f5,0x9cd4a515,0xa4f49cd4,0xb5b7ad56,0xb5769cd4,0x9493bdf9,0x84329473,0x9cd48c52,0x8c528c72,0x8c328431,0x94938c52,0x94738c52,0x8c738c32,0xb576a535,0xc639bdf8,0xb597a535,0xa515a515,0xb576b5b7,0xa4f4ad56,0x9cf49cf4,0xa515a515,0xb576ad35,0xa515a535,
-0xa5159cd3,0xa514a514,0x9cd4ad76,0x9cd48c72,0xbe18a555,0xa535ad76,0xa5359cf4,0xa51594b3,0xa514ad56,0x94b39493,0x94938c72,0x9cf49cb4,0x9cb39cd4,0xa5159cf4,0x9cd4a535,0xa5159493,0xa535a535,0xb597b597,0xad76ad36,0xad56ad56,0xbdf8bdd8,0xa535ad76,0xa514ad55,0x9cf494b3,0x949294b3,0xa535a514,0xb576b596,0xbdf8a535,0xb596ad35,0x9cb3a515,0x7bf09492,0x8c528c52,
-0xb5b7ad55,0xa535a515,0xad76c619,0x94b39493,0x9cd49cd4,0xb5b7ad76,0x94b39cd4,0xad76a514,0x94b3a515,0xc619ad76,0x9cd4b597,0xce5abdb8,0xb577ad77,0xbdf8b576,0xce5ac639,0xb5b7bdf8,0xb597bdf8,0xbdf8bdf8,0xbdd7c619,0xf79fce5a,0xef5ef79f,0xef5dffbf,0xb597ce5a,0x9cf4c619,0xb597b5b7,0xce5aa515,0xdefcc639,0xad76d69a,0xc639dedb,0x9cd4ad35,0xc5f8b597,0xb596bdd8,
-0xdedbc618,0xbdd7c638,0xc638b5b7,0x9cd3ad76,0xb5b7bdb7,0xbdf8bdf8,0x9cf4b5b7,0xa535ad76,0xc619ad76,0x8c728431,0xc619f7bf,0xad56b596,0xad559cf4,0x9492ad56,0x94b37bf0,0xb597bdf8,0xb597a4f4,0xad76a535,0xe71cbdd7,0xc618f79f,0xa515ad35,0xad56a515,0xad56b5b7,0xc619ce7a,0x9cf4c639,0xa5159cd4,0xa535a4f4,0x9cd39cd3,0x9cd39cd4,0x9cd49cd4,0xbdb7ad55,0x9cf4a515,
-0x94b3ad56,0x9cf49cd4,0x9493ad35,0x8c728c72,0xa51594b3,0xc619a535,0xad56ce5a,0x9cd494b3,0xad76ad56,0x94739cd4,0xad369cf5,0xa4f5a515,0x9473a4f5,0x94b39493,0x9cf49cd4,0x8c528c72,0xa5359493,0xa5159cf5,0xad76b5b7,0xa5159cf4,0xbdd8ad76,0xad76c63a,0x94939493,0x7bf18c73,0x94b38c72,0xad76a515,0x9cd49493,0x94b39493,0xa515a535,0x9cd48c52,0xad569cd4,0x94b4a515,
-0xa536a515,0xa5159cf5,0xa535a515,0xa5359cd4,0x9cd4b597,0xad568c72,0xb576ad76,0x947294b3,0x9cf59493,0xad56a515,0xb577a4f5,0xa515ad76,0xa535ad56,0xa515bdd8,0xad56debc,0x8c529493,0x94938431,0x94939472,0x84118c52,0x9cf48c52,0x9493a4f5,0x8c328c52,0xce39ad35,0xb5b7bdf8,0xbdd8bdd8,0xad769cd4,0xad76bdf8,0xa515ad35,0xa5359cd4,0x9cd4a535,0xad35a535,0x9cf4a515,
-0x94939cb3,0xa53594b3,0x9cd49cd4,0xa5159cd3,0x94939d14,0x9cf49cf4,0x94938c72,0x8c5294b3,0xad559cf4,0x94b38431,0x9cb49cf4,0x9cf47bf1,0x9cf4b5b7,0xa535a515,0xa515a515,0x949394b3,0xad56a535,0xad77a536,0x94b39cd4,0xa515ad56,0xad55a514,0xbdd8ce59,0x94b3b596,0x9cd38c72,0x8c9294b3,0x94b394b3,0xad55b596,0xad76b5b7,0xa535ad55,0x9cd4b596,0x947294b3,0x84117bd0,
-0xb5d7ad76,0x94b3b5b7,0xb5b7a515,0x9493a515,0x9cf49cd4,0xad76a535,0x9cf49cd4,0xa515ad56,0xad76bdd8,0xa5359493,0xad77b5b7,0xc619ad56,0xad76d6bb,0xad56ad76,0xef7ec619,0xbdd8d67a,0xb5b7b5b7,0xbdf8b5b7,0xbdd8bdb7,0xef7ec639,0xb596dedc,0xe73dc639,0xdefce73d,0xc619bdd8,0xce7aad56,0xad76c639,0xce7ace39,0xd69adefc,0xce39bdd7,0xad56bdf8,0xce3aad35,0xc619d67a,
-0xc618b596,0xc618c618,0xbdd7c618,0xc618ce59,0xbdf8b5b7,0xd6bbce39,0xce7ac639,0xce59debb,0xa535ce7a,0xad76c639,0xef7ead76,0xb597e73d,0x94929cf4,0x9492ad55,0xad768c51,0xbdf8bdd7,0x94b38c51,0xb597a535,0xc619c619,0xffdfe6fc,0xad56b5b7,0xc5f9a515,0xad76ce7a,0xc639b597,0xad56bdf8,0x9cd4ad56,0xad769492,0x9cd4b5b7,0xb597ad76,0x9cd3b596,0xad56a514,0x9cd3b5b7,
-0x9cf49492,0xa515ad55,0x94b39cf4,0x84119cf4,0x9cf49cb3,0xbdf8a515,0xc619ce5a,0x94939cb4,0x9cf49cf4,0x94b39cd4,0xad569cd4,0x9cf4ad76,0xa51594b4,0x8c5294b3,0x9cf48c52,0x84319cf4,0x9cd48c32,0xad56ad76,0xce5ac619,0xa515ad56,0xad76b576,0xad36ad56,0x9cb4a535,0x84329493,0x9cf48432,0x9493a515,0x9cd49cd4,0x94939493,0x9cf494b3,0x9cd49cd4,0x8c739cd4,0xb5b7ad77,
-0xa536a536,0xa515ad77,0xa536ad77,0x9cd49cf4,0xa515bdb8,0xa5369493,0xa4f5a515,0x9cd494b3,0xce7b94b4,0x9cd4a515,0xad56c619,0xbdb7bdd8,0xb5979cd4,0xb597a515,0xa515d69b,0x8c7394b3,0x94b38c72,0x9cf49cd4,0x8c5294b4,0x94b48c32,0x8c529473,0x8c737bb0,0xb5b79493,0xbdb7c5f8,0xc619b5b7,0xbdf8bdf8,0xb576bdd8,0xad56a515,0xa515ad76,0x9cb39cd4,0xad768c72,0x8c729cf4,
-0x9cb3a514,0xa5158c52,0xad559cd3,0x9cf4b5b7,0xa5159cd4,0xa53594d3,0x9cd49cd4,0x8c729cd4,0x94938c52,0xa5359cf4,0x8411b597,0x9cb37bf0,0xb596b597,0x9d149cf4,0xa535ad56,0x9493a515,0xb5979cd4,0x94b3a515,0xa5159cd4,0xad56a515,0xb596ad76,0xce5abdd8,0xad56bdd8,0x8c528c52,0xad569cf4,0x9cd39cf4,0xc618ad76,0xbdd7b596,0xad76b597,0xa515ad76,0x94728c51,0x7bf09493,
-0x94d39cf4,0xbdf8b5b7,0xad569493,0xad76bdf8,0x94939cf4,0xa5159cd4,0xb5b7b597,0xbdd8bdf8,0xbdf8bdf8,0x9cd4ad56,0xb5b89cf4,0xa515bdf9,0xbdb8bdd8,0xbdd8bdf8,0xce5abdd8,0xc639e71c,0xbdd8bdf8,0xbdb7b5b7,0xb596bdd7,0xbdd7c618,0xce5ace59,0xc5f8ce59,0xf7bfce5a,0xc639defc,0xb5b7d6bb,0xd6bbc639,0xdedcb5b7,0xf79effdf,0xad56c619,0xbdf8bdd8,0xb597c5f8,0xc5f8c619,
-0x9cd3ad76,0xd67abdb7,0xbdd8bdf8,0xf7bfbdf8,0xd6bbe71d,0xffffdedc,0xe71cef7e,0xd69bce5a,0xce9ab597,0xce59bdd8,0xb5b79cf4,0xc639ffff,0x94b3a514,0x94728c72,0xbdf89cd4,0x94b3a535,0x8c72b5b7,0xb5b7a535,0xc619ad56,0xef5ece7a,0xd69bffdf,0xad56ad77,0xa515a535,0xb597ad55,0xad76bdd8,0xad35b597,0xad55a515,0xad56c639,0xb5b7b596,0xad76bdb7,0x9cd49493,0xa514a514,
-0x9cd39cd3,0xb5b7ad76,0xa5159493,0x9cd49cd4,0x9cd494b3,0xb5769cf4,0xce5ab597,0x9cd49cb4,0x9cd4a515,0xad369cd4,0xa515a536,0xa535a4f5,0xb597bdb8,0x9cd49cd4,0x8c529cf4,0x94b38431,0xa5159cb4,0xbdb8b597,0xb597bdb7,0x94b3a515,0xb597a535,0xb597b577,0xa515bdd8,0x94b494b4,0xa5158431,0x9cf5a515,0xa5159cd4,0xa51594b3,0x9cf494b3,0x94939493,0x94b49cd4,0xa535ad56,
-0xa5159cf5,0xad56ad56,0xa5159cd4,0x94739493,0xb5979cb4,0x94b49cf5,0x9cd4ad56,0x94739cd4,0xc6199494,0x9cf4bdb8,0xbdf8b577,0xb576a515,0x9cf4a515,0xa4f4ad76,0xd6bbce5a,0x9cb48c52,0x9cf49cb3,0xa515a4f4,0x94b3a4f5,0x83f18c32,0x9cd48c52,0x94b494b3,0xa5159cd4,0xc619bdb7,0xbdf8b597,0xd6bbce5a,0xbdd8c619,0xa535bdd8,0xa515a535,0x8c72a515,0x9cf49cb3,0xa535ad56,
-0xad569cd4,0x9493a514,0xa5159cf4,0x9cf4a535,0x9cf48c92,0x94b39cf4,0xad56b597,0x9cf4ad56,0x94929493,0xce7aad56,0x84119cd4,0x94938432,0xad769cd4,0xa535ad55,0xa535ad56,0xa535a515,0x94b3a515,0xa515b597,0xb5b79cd4,0x9cd4a535,0xbdf8bdd8,0xb576ad76,0xad35bdd8,0x94939cb3,0xad769d14,0xa535a555,0xb596ad56,0xb5b7c639,0xad76b5b7,0xad76b576,0x8c729493,0x83f08c51,
-0x94b3ad76,0xc619a515,0x94b3bdf8,0xa5159cd4,0x94b394b4,0x94b39493,0xce7aa535,0xce7ac639,0xa535c639,0xb5b7c639,0xad369cd4,0xb597bdf8,0xc619ad56,0xbdf8ce5a,0xc639bdd8,0xdedcdedc,0xb5b7d67a,0xbdd7b597,0xbdd7b5b7,0xb596ad76,0xbdf8bdf8,0xbdf8c639,0xd6bbb5b7,0xdedcf79f,0xbdd8ce5a,0xc619ad56,0xbdd8c619,0xe71dce5a,0xbdf8f79f,0xc639ad56,0xce5ad67b,0xad76bdd8,
-0xb597ad56,0xce59b5b7,0xce59defc,0xd6bbce7a,0xdedcef5e,0xd69bce59,0xe73de71c,0xc619d6bb,0xc639c639,0xad96be18,0xad55d67a,0xdedbbdf8,0x8411ad76,0x84108431,0xc6399cd3,0x9cf4bdd7,0xbdd7ad76,0x94b39492,0xb597a515,0xce3ad67b,0xffffdedc,0xbdd8ce3a,0xb576ad35,0xbdd7ad76,0xbdd8bdf8,0xad56b576,0xb5b7ce5a,0xb596ad56,0xad56bdd7,0xa515b5b7,0xa5149cf4,0x94939cb3,
-0xa4f4a4f4,0xb596a535,0x841094b3,0x9cf48431,0x8c729cd4,0xad567bf0,0xb5b7b597,0x8c529473,0xa515a535,0xad76a4f4,0x9cb4ad36,0xad369493,0x94939cd4,0x94739493,0x9cb49493,0x94939cb4,0xa4f59cf5,0xad369cb4,0xad56b597,0xa535ad56,0xa535a4f4,0xad76ad56,0xad56bdd8,0x94739cd4,0x94939493,0xad56a515,0xa535ad77,0xad76a536,0xad56b597,0x8c739cd4,0xa536a536,0x8c73a536,
-0x94b4a536,0x94b494b4,0x9cd49cb4,0x9cb4a4f5,0x94b39cd4,0xad36a536,0xa515b597,0x8c739cd4,0xef7f8c52,0x9493defc,0x9cd49493,0x9cf4a515,0xad56ad56,0x9cf49cf4,0xffffbdd8,0x9cd4ad76,0xa4f4a535,0x94b39cd4,0x9cd49cb4,0x84319493,0x9cf58c32,0x9cf4b577,0xa535a535,0xbdd8ad56,0xa515a515,0xd6bbb597,0xad56c619,0xce7ace5a,0xad56ad35,0xad76ad76,0x9cd49cd4,0xad56ad76,
-0x9cd49472,0x9cb3b596,0x9cf494b3,0x94939cd3,0x94929493,0x94d39cd3,0x9cf48c72,0x9cd4a535,0x94b39cd4,0xb5b7a535,0x949394b3,0x94939cd4,0xa514a535,0xc639be18,0x9cf4a535,0x9cf5a515,0xa5359cf4,0xad55a535,0xad56b597,0x94b3a4f4,0xb596a514,0xad35ad55,0xad56ad56,0xa535a4f4,0xa5149cd3,0xb5b7ad96,0xb5b7b596,0xbdf8bdb7,0xb5b7b596,0xa535a514,0x7bd09cd4,0x7bf07bf0,
-0xb596bdf8,0xad56ad76,0xad56ad56,0x8c529493,0xa535a535,0x8c739493,0xb597a535,0xd69bc619,0xb5b7bdf8,0xbdd8a535,0x9cd4b577,0xc619ad56,0xa535c619,0xdefcd6bb,0xce5abdd8,0xce39c639,0xce59ce5a,0xad56b5b7,0xc5f8bdd7,0xbdb7c618,0xbdf8b5b7,0xd6bbe6fc,0xc619ce5a,0xe71ddefc,0xbdd8d6bb,0xad56c619,0xbdb7ce7a,0xd69bc639,0xce7ad69b,0xad76b5b7,0xdefcce5a,0xad56c619,
-0xce39bdd8,0xc619ce59,0xef5edefc,0xce5adebb,0xdedcc619,0xffffe73d,0xd67ae73d,0xdedbdedb,0xc639ce5a,0xbdf8b5b7,0xe73dc5f8,0xad56bdb7,0xbdb7dedb,0x94b39cb3,0xb5b79cf4,0xad55b596,0x9cf39cf3,0x8c7294b3,0xbdd88c31,0xb598bdd8,0xe71dd67b,0xc639ffff,0xbdb7ad56,0xbdd8bdd7,0xb5b7b596,0xbdd8d67a,0xc639bdf8,0xad56ad76,0xb596b5b7,0xa535a535,0xa535a535,0xa514a515,
-0xb5b7a535,0x9cf4a514,0x9cf49cf4,0x94938431,0x94939cf4,0xa5159493,0xbdb8b577,0xa535a535,0xa5159cb3,0xa535ad56,0xa51594b4,0xa515ad36,0xa515a4f5,0x9cb49cd4,0x9493a515,0x8c528c52,0xa5159473,0x9cf59cd4,0xbdd8bdd8,0xad56ad56,0x9cd4ad76,0xa535a515,0xb597ad36,0xb577b5b8,0x9cf4a515,0xad56a535,0x94b4ad56,0xad5694b3,0xad56b597,0x8c739493,0x9cf58c73,0x8c738c73,
-0x9cf594b4,0x94939493,0x9cf59cb4,0xad56ad56,0x9cf5a536,0xb5779cd4,0xa4f5b597,0x9cd4a515,0xf7bf9493,0x9cb4d6bc,0xa4f59cd4,0x9cf4a515,0xa5359cf4,0x9cd4a535,0xef5ea515,0xb577ce5a,0x9cd4a535,0x94b39cd4,0xa4f59cb4,0x9493a4f5,0x94b39473,0xbdb8ad56,0xad76a4f4,0xa535ad56,0xb5b7ad56,0xc639bdd8,0xb597c639,0xd69bbdb7,0xad76ce39,0xad35ad56,0xad35a515,0xa5159cf4,
-0x8c72ad76,0xa5148c52,0x9cb3a4f4,0x949394b3,0xa5159492,0x9cd4a514,0x8c528c72,0xb597ad76,0x9cd39493,0x84319493,0xb597b577,0xa515ad77,0xad55a515,0xc619ad76,0x9cf4bdf8,0x94b39cd4,0xa555a515,0xad56a535,0xa535b576,0xa514ad56,0x94b38c72,0xad35b5b7,0xb597ad76,0x8c729cd3,0x8c729cf4,0xb597a555,0xa514ad76,0xbdd8b5b7,0xb596b5b7,0x9cd3ad35,0x84119493,0x7bf07bf0,
-0xbdd8bdd8,0x9cf4ad56,0xad779cd4,0x94b3ad77,0xad569493,0x94b4a515,0xa5369cd4,0xc63aad77,0xbdd8bdd8,0xa515b5b7,0xad76ad76,0xa5159cf4,0xc639c639,0xce5aad76,0xbdd8dedc,0xb5b7c619,0xc5f8ce5a,0xb5b7b5b7,0xc639bdd8,0xdefcc619,0xad56ce7a,0xd69bbdb7,0xbdd8ce7a,0xdedcb5b7,0xd69bef5e,0xbdd8c5f8,0xce5ab597,0xbdd8d69b,0xb597bdd8,0xce7ad67a,0xdefcce5a,0xce5ad69b,
-0xd67ac619,0xdebbce5a,0xe71dc5f8,0xdedcffff,0xce5adefc,0xef3de71c,0xdebbd69b,0xdedcd6bb,0xbdf8c659,0xb5d7b5b7,0xad35ef3d,0xb5b7ce7a,0xdefcad56,0xa515b5b7,0x9cd3a515,0x9cd3ad35,0x8c518c72,0x94b373af,0xa5359493,0xce5ac5f9,0xe71dd6bc,0xf79ff79f,0xbdf8d67a,0xc639bdd8,0xbdb7b597,0xd69bc5f8,0xb5b7b5b7,0xa4f4b5b7,0xbdd8b576,0x9cf4b597,0xa535a515,0xa5159cf4,
-0xa515a515,0xad55b597,0xa53594b3,0x84119cb3,0xad76a535,0x94b49cd4,0xc61994b4,0xbdd8b577,0x94b3b597,0xb597ad56,0xad36a515,0xbdb8b597,0xad779cb4,0x949394b4,0x8c7394b4,0x94938c52,0x9cb48c52,0x9cd4a515,0xb5b7b597,0xb5b7ad76,0xa535b597,0xa4f59cd4,0xb577a536,0xbdf9b5b8,0x9cd4a515,0xa5159cd4,0xa5359cf4,0xa515a535,0xad77ad77,0x9493a536,0x7bf19cd4,0x8c528c52,
-0x8c738c52,0x94b494b4,0xa4f594b4,0xa515a536,0xa4f5a515,0x947394b3,0x9cd49cf4,0xa5369cb4,0xffff94b4,0x9493ce5a,0x9cf49cf4,0xb5979cf4,0xa515b597,0xa515ad76,0xdebca515,0xb597ce5a,0x9cd4a535,0xa5159cb4,0xad56ad56,0xad769cf4,0xad359cd4,0xad76a515,0xad36bdb8,0xbdd8b597,0xad56b597,0xce5ac619,0xc639bdd8,0xa515c619,0xce5abdd8,0x94b3ad35,0x9cf4a535,0x9cb39cb3,
-0xad769cf4,0x8c528c72,0x9cd39cd3,0x9cb394b3,0x9cd49cf4,0x94939cd3,0x94729472,0x9cf49472,0x9cf49cd4,0x8c728c52,0xad769cf5,0x9cf4b577,0xa514a515,0xb596ad56,0xb597bdf8,0x9cf49cf5,0xa535ad76,0x9cf49d14,0xad55a4f4,0xad55ad76,0x94b3ad55,0xb5979cd4,0xa535ad76,0x9cd4ad56,0xa515a515,0xad569cd4,0xad76bdf8,0xb576b576,0xc639b597,0xad55bdd7,0x84318431,0x73af7bcf,
-0xb5b7a515,0xad76b597,0xa5159cf5,0xbdd8bdd8,0x949394b3,0x9cf5a515,0xa515a515,0xbdd8ad56,0xbdd8c619,0xad56b597,0xbdd8a515,0xa4f4ad76,0xbdf8ad56,0xbdd8bdf8,0xd6bbce39,0xbdf8bdf8,0xdefcc5f8,0xdefcf79e,0xd6bbf79f,0xc619defc,0xc619ce5a,0xce5ac639,0xd69bce5a,0xc619d69b,0xef7ef77e,0xb597d69b,0xad76b597,0xdefcd69b,0xbdd8a515,0xffffef5e,0xd67adefc,0xe71df79f,
-0xce39e6fc,0xce59dedb,0xce7ad67a,0xffffe71d,0xe71df77e,0xdedcce59,0xd6bbe71c,0xdedbdedc,0xbe18dedb,0xe71dc639,0xa535bdd8,0xe6fcb596,0xa515b596,0xbdd8ce59,0x9cf4a535,0xbdf89492,0x8c519cd4,0x84317bf0,0xad569cb3,0xc61abdb8,0xdefdffdf,0xffffe71d,0xce5affff,0xce7abdf8,0xc618c639,0xbdf8c619,0xb5b7d69b,0xb5b7b597,0xc619a535,0xad56bdd8,0xa515a515,0x9cd4a515,
-0xa515ad56,0xb5b7ad55,0x8c5194b3,0x9cf49cd4,0xc5f8b576,0x9cd49493,0x9cd49cb4,0x9cd4a515,0xa5359cd4,0xa535a515,0xa4f59cf5,0xbdb8b5b8,0x9cd4a536,0x94949473,0x9cf59cb4,0x94739494,0xa4f58411,0xad56ad56,0xad76b5b7,0xc619bdd8,0xb597b597,0xa515a515,0xb577ad76,0xad36a536,0xa535ad76,0xa536a515,0xa5359cf5,0xa515bdd8,0xb5b89493,0x9493a536,0x8c739cf5,0x8c738411,
-0x9cd49493,0xad56a515,0xa4f5a515,0xa536a515,0xad36ad36,0x94b39cd4,0x9cb48c73,0xa4f59493,0xdedca515,0x8c73bdd8,0xa5159cf4,0xb5979cd4,0xa515ad76,0xbdf8a535,0xb5b7ad36,0x9493d67b,0xa515ad36,0x9cd4a515,0xa535a515,0x9cf494b3,0xad56b597,0x9cf4b597,0xb597ad36,0xad56ad56,0xa515a535,0xc619b5b7,0xbdb7b576,0xb597b5b7,0xb5b7ad76,0xa515b597,0xad76ad76,0x94b39cd4,
-0x9cf48c52,0xa514ad76,0x9cd49493,0x94b39492,0x94b39cd4,0xa5149cd4,0x9493a535,0x94938411,0xad569cf4,0x9493a4f4,0x9cb49cd4,0x9cd4a515,0xad559cf4,0xad76a535,0xbdf8ad76,0xa535bdd8,0xa535ad56,0xa514a514,0xa515a4f4,0xa515a535,0xc619ad55,0x94b3a535,0xad76b596,0xa5359cf4,0xb5b7b5b7,0xa515ad56,0xc639ad76,0xb596b597,0xb5b7b597,0xb596bdf8,0x8c51a535,0x7bf07bf0,
-0xa535ad76,0xad77b597,0x9cf5a515,0xb5b89cd4,0x8c52a515,0xa5159cd4,0xad76ad76,0xb5b7ad56,0xbdd8bdd8,0xa535b597,0x9cf4a515,0xad76b597,0xad569cf4,0xce7ace5a,0xbdf8bdd8,0xce5ace7a,0xc5f8c639,0xf7bfd6bb,0xd69bf77e,0xce5ace5a,0xce7aad35,0xce7ad69b,0xd69bce7a,0xc619d6bb,0xf7bfce39,0xdedcf7bf,0xad35b5b7,0xdebbad76,0xc639bdd8,0xef5ed6bb,0xe71dffff,0xf7bfdedc,
-0xef5eef5e,0xd69bce39,0xd69bce5a,0xef5dd69b,0xdefcffff,0xd69adedb,0xef5ddefc,0xd6bbdedb,0xdedcce7a,0xffffbdf8,0xbdf8ce7a,0xb596c618,0xb5b7ef5d,0xf79eb597,0x9cd4c639,0xa535ad55,0xa535bdd8,0x8c319cf4,0xd67a9cf4,0xbdb8a536,0xbdd8d69b,0xf79fe73d,0xf79fffff,0xce5ace5a,0xc639ce39,0xbdd8c619,0xb597bdb8,0xbdd8b5b8,0xad76bdd8,0xbdb8bdd8,0xb597c619,0xc5f8a535,
-0xb5b7bdd7,0xad56ad35,0x9cf4ad56,0x9cd49493,0xa515ad56,0xad359cf4,0x94b39cd4,0x94738c32,0xad769cf4,0x94b3ad76,0xad5694b3,0xb577b597,0xb5b8bdb8,0xad56a515,0x9cf5ad56,0x94739cf5,0xa51594b3,0xb5b8b597,0xbdd8ce7a,0xbdf8ad56,0xb5b7bdf8,0xbdd8bdb8,0xad56ad56,0x9cd4a536,0xa535a515,0x94b4a515,0xa5159cd4,0x9cf4ad77,0x9cf594b4,0xad56ad56,0xa515a536,0x94939cf5,
-0xa5159493,0x94b39cd4,0xad77b5b7,0x9cf4a515,0xa515a515,0x9473a515,0x9cb49493,0xa515a535,0xe73e9cf5,0x8c72b5b8,0x8c529cd4,0xb5b7a515,0x8c72a515,0xa5359cf4,0xbdb8c619,0x8431c5f9,0xad369493,0x9cd4a515,0x9cf4a515,0x9493a515,0xc639b576,0xad56b576,0xa5359cb4,0xb577b5b7,0xad56b577,0xad36ad36,0xa515b5b7,0xbdb7a515,0xa515ad56,0xad35ad56,0xb596a535,0x9493a514,
-0x94939cd3,0xb597a535,0x9cf4a515,0x94939cb3,0x9cf4a515,0x9cb39cd4,0x94b39cf4,0x8c728c72,0xa5148c51,0xad56a4f4,0x8c729cd4,0x94b38c72,0x9d1494b3,0xad56a535,0xa535b597,0xce7abdf8,0xad55b597,0xad76a555,0xa535ad56,0xa514a514,0xbdd8b5b7,0x9cd4c5f8,0xb5969cf4,0x9cf4ad35,0xad56a535,0xa515ad76,0xad569cd4,0xb576bdd8,0xad76b576,0xce59bdf8,0xbdd8b5b7,0x94939493,
-0xb597b597,0xb5b7ad77,0xa515ad76,0x949394b4,0xad56a515,0xad5694b4,0xbdf8bdd8,0xb5b8c619,0xa535ad56,0xad56ad76,0xa515a4f4,0xc639a515,0xad56bdf8,0xce39bdd8,0xbdd8ce7a,0xce5abdf8,0xb597bdd8,0xce7ab5b7,0xd69af7bf,0xc619c639,0xc619bdd8,0xce7ace39,0xbdd8c619,0xd69bce7a,0xe71cd69a,0xffbfef5d,0xc618ef5e,0xc639bdd8,0xd67abdf8,0xd69bd69b,0xf79fdefc,0xdefce73d,
-0xdefcef5e,0xd69bdedc,0xf79fd67a,0xe6fcd6bb,0xe73de71c,0xd69bef7e,0xef5dd69b,0xd69aef5d,0xce5ad69b,0xf7bfd69b,0xb5b7d69a,0xbdf8b597,0xe71cb5b7,0xc639b5b7,0xc639ef3d,0xbdf8bdd8,0xc619b596,0xbdd8b5b7,0xbdf8bdf8,0xb597dedc,0xa5369cd4,0xdefcd6bc,0xf7bff77e,0xdefcef5e,0xdedcd69b,0xb5b7bdf8,0xb5b8b597,0xb5b7c63a,0xbdf8bdd8,0xbdb8a515,0xbdd8debc,0xdedca515,
-0xb596ce5a,0xb596ad55,0xb5b7bdd8,0x94b3a515,0xbdd8b5b7,0xa4f4a4f4,0x9cb4a4f5,0x94b38432,0xa5359cd4,0x9cf4a515,0xa5159493,0x9cf5b577,0xbdd8a536,0xbdd8c63a,0xbdf9b597,0xc63ace5a,0xb597bdf8,0xce5ace3a,0xd69bce7a,0xa535c619,0xbdf8bdd8,0xb597bdb8,0xb577b577,0x9cd4a536,0x94939493,0x949394b4,0xa536a515,0x94939cd4,0xa536b597,0xad569cf5,0xbdd8a515,0x9493a536,
-0x9cf59493,0x9cf59cd4,0xa5359cd4,0xa515ad36,0xa5359cd4,0xad36b577,0x94b49cb4,0xad569cf5,0xc6198c73,0x9493ce5a,0x9cd49493,0x94b39493,0xad76ad76,0xa4f4a535,0x9cb49cf5,0x9cd4bdd8,0xbdd89cd4,0xad56c619,0xa4f4a515,0x8c729cd4,0xb597a515,0xad76c5f8,0xa536a535,0xc63ab5b7,0xad56ce7a,0xbdd8bdb8,0xbdf8ad35,0xad56bdf8,0x94b3ad56,0xa5158c52,0x9cd4a515,0x94928c72,
-0x94b394b3,0x9cf48c52,0x9cd3b596,0x9cf48c51,0x947294b3,0x8c519472,0x94b38c52,0x84119493,0x94729492,0xa5159493,0x9cd4b597,0x8c729cd4,0x9d149493,0xb5b7ad55,0xad76ad76,0xbdf8a535,0xad55b597,0xad96a535,0xa535b596,0xa4f4a4f4,0xad76a535,0xc5f8c618,0x8c529cf4,0xa535b576,0xb5b7a535,0xad76b5b7,0xa535b5b7,0xb5b7ad56,0xc618bdd7,0xb5b7bdf8,0xbdf8d69a,0x9cd3ad76,
-0xb597a4f5,0xad77ad36,0xbdb8b5b7,0x8412ad36,0x9cf58c73,0xad36ad56,0xc619b577,0xbdb8b5b7,0xad56b5b7,0xb597ad77,0xad76ad76,0xad56a515,0xbdb7ce7a,0xb5b7a515,0xc639c619,0xad76b5b8,0xbdf8b597,0xb5b7b5b7,0xe73dce59,0xb5b7c639,0xd6bbe71d,0xc639c619,0xbdd8ce5a,0xc639b5b7,0xce59c619,0xffffef7e,0xf7bfffff,0xe71cdedc,0xce7aa515,0xbdd7ef5d,0xef5dd6bb,0xef5ef7bf,
-0xdebbe71c,0xdefcd6bb,0xdedbd69b,0xe71ddedc,0xe73ddefc,0xef5ee73d,0xd69bef3d,0xef5ee6fc,0xd6bbce5a,0xf79fdefc,0xce5ace39,0xbdd8bdf8,0xb576dedc,0xce5ae71d,0xffffbdf8,0xc619ce7a,0xad56c619,0xb597c618,0xd6bbc639,0xdedcc618,0xbdd8b597,0xc639ce7a,0xef5eef5e,0xf79fef7e,0xce5adedc,0xb597c619,0xc639ad36,0xc619bdd8,0xad56ad77,0xa536a515,0xc619d69b,0xbdb7b597,
-0xb597bdb7,0xa5359cf4,0xb5b7b597,0xa515bdd8,0xb597ad56,0x9cd4ad56,0x84118431,0x8c729cd4,0x84108c52,0xa4f49493,0x94b394b3,0x9cf5a515,0xb597a515,0xb5b8ce3a,0xb5979cf5,0xbdd8ce3a,0xc639ce3a,0xce5ace5a,0xc639c619,0xad76ce5a,0xbdf8ad56,0xad76c619,0xa4f59cf4,0xa515a536,0x8c7294b4,0xad76a515,0xad77ad56,0x9cd4a515,0xa536b597,0x84329cf5,0xbdd89cb4,0x94b4bdb8,
-0x94939cd4,0x8c528c52,0x9cf5a4f5,0xad56ad56,0x9cd4ad56,0xa4f59cd4,0x9cd4b597,0x94939473,0xce7b9cf5,0x9493ce5a,0x9cd49493,0x9cf49cd4,0xad56a515,0x94939cf4,0x9cd49cf5,0xe71de73e,0xad77a515,0xad56bdd8,0x9cd49cd4,0x9cb394b3,0xb5979cd4,0xc5f8ad35,0xb577bdd8,0xb577ad56,0xbdf8dedc,0xbdd8c619,0xb597ad76,0xad76d6bb,0xa515a535,0x9cf49493,0xa515b596,0x94b38c72,
-0x8c529492,0x8c728431,0xa514a535,0xa5149493,0x9cb39cd3,0x9cd394b3,0x94b394b3,0x84318c72,0x9cd39492,0xa53594b3,0xa536a515,0x9493a515,0xa5149cf4,0xad76b5b7,0xad56b597,0x94b3a515,0xa535a535,0xa515a535,0xa535a535,0xa4f4a515,0xad769cf4,0xbdf8b596,0x8431bdd8,0xb5b79492,0xad76b5b7,0xb597ad76,0xce5ac619,0xad76ad56,0xce39d67a,0xbdb7c5f8,0xc618bdf8,0x9cf4b576,
-0xa5159cf4,0xa536a4f5,0xbdd8b577,0x9cb4ad77,0x94949493,0xb5779cd4,0xad76bdb8,0xbdd8bdf8,0xb5b7bdd8,0xad56a515,0xbdb7c639,0xa535bdd8,0xce39b576,0xad56bdb7,0xb5b7b597,0xbdf8bdd8,0xc639c639,0xc5f8bdf8,0xc639b5b7,0xdedce73d,0xbdd8c5f8,0xc619c5f8,0xc619bdf8,0xbdd7c619,0xce7abdb7,0xdefcdefc,0xffffffdf,0xce7aef7e,0xb597bdf8,0xdedcdedc,0xdefce71c,0xffdfef7e,
-0xef5ef79f,0xdefce71d,0xd69adedb,0xdedcd6bb,0xd6bbef7e,0xdedcdebb,0xdebbe71d,0xdefcce5a,0xc639defc,0xffffce7a,0xce5ae73d,0xce5ac5f8,0xd6bbc639,0xd6bbbdb7,0xbdd8bdd8,0xce5affff,0xc5f8c618,0xce59b596,0xbdb7c639,0xc639bdf8,0xce7aef5e,0xc619ce5a,0xdebbbdd8,0xe73de6fc,0xdefce6fc,0xc5f9c63a,0xbdf9ad56,0xc5f9c619,0xa515bdb8,0xd67bb597,0xd67bdefd,0xb577b597,
-0xbdf8b597,0xa515b597,0xb597ad76,0xbdd8bdd8,0x9cd4a535,0xa515bdb7,0x8c319493,0x94729493,0x84119493,0x94939493,0xa4f59493,0xa5369cd4,0xb597ad77,0xc619b5b8,0xb5b8c619,0xb577bdd8,0xce5ac63a,0xce3ace5a,0xbdd8c619,0xc639bdd8,0xb576bdb7,0xb597b597,0xa535ad36,0xa515ad56,0x9cf4ad76,0xa53594b3,0xa535a535,0x94b4a515,0x94939493,0x94b49cf5,0xad778411,0xad56c5f9,
-0x9cf48c73,0x84328c52,0x9cf59cd4,0xbdb89cb4,0xad36b597,0x9cf48c73,0xad56a4f5,0x8c528c73,0xd6bc94b4,0x9493d69b,0x94b39cd4,0xa5159493,0xa515a4f4,0xa5159cf4,0xb597a4f5,0xffdfd67b,0xa536bdd8,0xa5159cb4,0x9cd49cd4,0x9cd49cf4,0xa515a515,0xb597ad35,0xbdf9ce5a,0xa515ad56,0xdebcb597,0xad56b5b8,0xad56b597,0xbdd8b576,0x94b39cd4,0x94939cf4,0x9cf4a515,0x8c729493,
-0x94939cd3,0x94b39472,0x9cf49cf4,0xad56ad56,0x9cf49cd3,0x9cd494b3,0x94729cf4,0x94b38c52,0x9cb394b3,0x9cd49cd4,0xa536a535,0xa515b597,0xad569cf4,0xb5b7ad55,0xad56b597,0x9cf4a515,0xad76a515,0xa514ad76,0xad56a514,0xad56ad76,0xa535b576,0xb597ad76,0xa515bdf8,0x9cf48c51,0xa515a535,0xb597ad76,0xce5ab597,0xb576ce39,0xd69ace7a,0xbdf8c619,0xad56b597,0x8c51b596,
-0xa5159cf5,0xb5779cd4,0xa516ad57,0xad77b577,0x8c73a536,0xa5158c53,0xb5b8bdd8,0xbdd8b5b7,0xbdd8bdd8,0xad56a536,0xbdf8b597,0xbdd8b596,0xb5b7b5b7,0xbdf8d67a,0xb597b576,0xd69bc5f9,0xce39ce7a,0xc618ce7a,0xbdf8c5f8,0xf79fd6bb,0xce3ace3a,0xbdd8ce39,0xbdf8bdd8,0xbe18bdf8,0xd6bace59,0xdefcd69a,0xffffef3d,0xffdfffdf,0xbdf8defc,0xffffbdd8,0xdedcef5d,0xe73ddefc,
-0xf79ef79f,0xdedbdedc,0xe71dc639,0xce59ce59,0xce7adefc,0xd69bc639,0xce7adedc,0xc5f9bdd8,0xdedcdedc,0xdedcbdd8,0xe71dc619,0xce5ace5a,0xce5abdd8,0xa515b5b7,0xce5ae71d,0xffdfbdf8,0xce5ae71d,0xad76bdd8,0xce59c639,0xbdb7bdd7,0xdefcc639,0xce7ace59,0xd6bbd67a,0xd67bce3a,0xef5edefc,0xad76ce7b,0xc5f9bdd8,0xad77b5b8,0xd69bc63a,0xe71ece5b,0xbdb8ffdf,0xc619ad56,
-0xb577bdd8,0xb597bdd8,0x9cd4ad56,0xbdd89cf4,0x8c72b597,0xad769cf4,0xad35b597,0xa535bdb7,0xa515a514,0x8c729493,0xa5159493,0xa536ad77,0xad36ad56,0xce5abdb8,0xd69ce73e,0xbdf9b598,0xbdd8bdf9,0xc619ce7b,0xbdb7ad76,0xb597b5b7,0xb597b597,0xbdd8b5b7,0xad56c619,0xb577a515,0xa535a515,0x94939cf4,0x8c528432,0x94b49493,0x94938c52,0x9cd49cf5,0x94b49494,0xb597a536,
-0xad56ad56,0x94b3ad56,0x94939493,0xad569cb3,0xbdb8c619,0x9493a535,0xb5b7a4f5,0x8c72ad36,0xce7b9493,0xa535ce9b,0xad56ad56,0xa515a515,0x94939cd4,0xbdd8ad56,0xa515ad56,0xf77fbdd8,0x8c73b597,0x94b48c52,0x9cf494b3,0x9cf4a515,0x9cd49cf4,0xb576a535,0xce5abdd8,0xb597bdd8,0xb5979473,0xad56ce5a,0xc619bdb8,0xad35a515,0x94b3ad56,0x9cd39cd4,0x8c519493,0x9cf49493,
-0xa5149492,0x94939493,0x9492a514,0xbdb7a4f4,0x9cb3a4f4,0x9cb394b3,0x9493a515,0x9cd494b3,0xa53594b3,0x9cf49cd4,0xa5159cd4,0xb5b7b597,0xb596ad56,0xad55ad55,0xb597bdd8,0xa515ad76,0xad76ad56,0xad56ad76,0xb596ad76,0xb5b7b597,0xad55b597,0xbdd7b596,0x9493a535,0x9cb39cf4,0xb5b89cf4,0xb5b8bdf9,0xb597bdb7,0xc639ce5a,0xce59bdd8,0xc5f8ce5a,0xc639ce7a,0xb596bdd8,
-0x8c729cd4,0xad569cb4,0xb597ad56,0xad36ad56,0xa4f5ad77,0x94949494,0xd69cbdb8,0xb597b597,0xad77ad76,0xa535b597,0xb597a515,0xc639c639,0xbdf8bdf8,0xc639b597,0xad56bdf8,0xce7ab597,0xce7ae73d,0xd67ad69a,0xce5ace5a,0xd6bbc5f8,0xd67bf79f,0xbdd8bdd8,0xbdd8bdd8,0xb5b7bdf8,0xd69abdd8,0xe73ddefc,0xe71ce73d,0xffffffff,0xbdf8ffff,0xce7ac639,0xdedcffdf,0xdefcdefc,
-0xe71df7bf,0xd67ae71d,0xd69ace7a,0xc639d69b,0xe6fcb5b7,0xce7adedc,0xd6bbdedc,0xc5f8bdd8,0xce7ab5b7,0xc619dedc,0xdedcd6bb,0xbdd8c639,0xb5b7c619,0xbdd8ad56,0xef3dc619,0xc619ce5a,0xdedcf7bf,0xbdf8bdf8,0xd69bbdf8,0xb596d67a,0xce59ad56,0xc639ef5d,0xef7ed69b,0xdebbef7e,0xdedcd69b,0xc619d69b,0xd69bbdb8,0xbdf9c61a,0xd69cc61a,0xc63ace5a,0xbdd8debc,0xad56ad56,
-0xc619c639,0xb576b597,0xad56c619,0xb5b79cf4,0x9493a535,0x9cf48411,0xa515ad56,0x9cd3a514,0x9cf49cf4,0x94939cb3,0xa5159493,0xb577b597,0xb5989cd5,0xce5bc61a,0xd69bdefd,0xb577bdf9,0xbdd8bdf9,0xc639c619,0xb597b5b7,0xad35b597,0xad76a515,0xc639bdf9,0xb5b7c639,0xad56ad77,0x9cd4ad76,0x9493a515,0xa5158c72,0x8c52a515,0x9cf5a536,0x9cf59493,0x9cd5a4f5,0xb5979cd4,
-0xb597bdf8,0xa515b597,0x8c529493,0xa5358c52,0xb597ad56,0xa515bdd8,0xa5359cd4,0x9cf5b577,0xe73e94b3,0xb5b8ce7b,0xb597ce5a,0xad56ad56,0xa535ad56,0xc5f99cf5,0xb597d67b,0xbdd88c72,0x94b39cf4,0xa5159cb4,0x94939cb3,0xa515b597,0x9cf49cd4,0xad56a515,0xb597ad76,0xad56c619,0xa515a4f5,0xce3abdb8,0xbdf8c5f9,0x9cd4ad56,0xc619b597,0x9cf4a535,0x8c729492,0xad769cd4,
-0x8c529cd3,0x94929493,0x9cf49cd4,0xa5159cd4,0x9cf4ce7a,0x949394b3,0x84319cd4,0x94729cd4,0xad569493,0x94b39cf4,0xa515a515,0x9cd4a515,0xbdf8d6bb,0xa535ad56,0xad56a535,0xb597ad56,0x9cf4a535,0xad769cf4,0xad76b5b7,0xbdb7ad56,0xb597b5b7,0xad76ad55,0x8410a4f4,0xb5b78c72,0xad56a535,0xbdf9b5b7,0xb597b5b7,0xce5abdb7,0xbdd7ce5a,0xd69ac618,0xc5f8c639,0xb5b7c618,
-0xa5159cb3,0xb576b5b7,0xb576a515,0xa535b5b7,0xb597b5b8,0x9cf59cd4,0xc639ad56,0xb5b7dedc,0xb5b7ad76,0xad56ad76,0xad96b597,0xc619b597,0xb5b7bdf8,0xb5b7b597,0xbdf8c5f8,0xbdd8b5b7,0xdebbd69b,0xce5ad69b,0xb5b7c619,0xbdf9ad77,0xffffce7a,0xc619d6bb,0xb597bdd8,0xbdf8b5b7,0xd69bd67a,0xdedcd6bb,0xe73def5e,0xffffe71c,0xef7effff,0xad35bdf8,0xef7ece59,0xd69bdedc,
-0xef7ee71d,0xe6fcef3d,0xe71dd6bb,0xce5ad69b,0xd69abdd8,0xc618c639,0xef5dce39,0xc619f79e,0xb5b7c619,0xdebbce7a,0xd69ace59,0xce7adedb,0xbdf8b596,0xc618bdf8,0xbdf8ce5a,0xce7aef5e,0xef3dc619,0xce5ad6bb,0xc618b596,0xce5ac619,0xbdb7b576,0xe73dd69b,0xffffef5d,0xffffffdf,0xce5ae73d,0xdedcdebb,0xc619d69b,0xc63ace5a,0xb5b8ad56,0xdedcc63a,0xad97c63a,0x94b4bdf9,
-0xce5abdd8,0xb597ad56,0xad76c619,0x94b3a514,0x84319472,0x8c728c31,0xad5594b3,0x8c319cd4,0xa4f59493,0x8c739cd4,0xa5369cd4,0xce7b9cf5,0xa515bdd8,0xad36a536,0xd69bce5a,0xc639debc,0xc619b577,0xad76ce7a,0xbdd8ad56,0xad56ad76,0xad569cd4,0xc639bdf8,0xad56ad56,0x9cd4a515,0xa4f59cb4,0xa5159cf5,0x94739cd4,0x9cd49cd4,0xa5159493,0xa5159cf5,0xa5158c73,0x94b4a515,
-0xc619b577,0xa4f5c619,0x94938411,0x9cf5a535,0xad569cd4,0xad36c619,0xa5159cf5,0xa5369cd4,0xef7ea535,0xad56ce5a,0xce5bce5a,0xad56bdb8,0xce3ab597,0xe71dc619,0xa515ce7b,0x94938c52,0x843194b3,0x94b49493,0xa5358c72,0xad76b597,0x9cd49cf4,0x9cf49cd4,0xa535a4f5,0xad57b597,0x9cd4a536,0xad369cd4,0xad76ad76,0x9cf4b597,0x9cd49493,0x9cd4a535,0x8c529492,0x9cf494b3,
-0x8c929cf4,0x9cd394b3,0xa5159cd4,0x9cb39cf4,0xbdd8b576,0x9cd4ad76,0x94b39cf4,0x8c528431,0x8c729493,0x9cf49cd3,0x94b394b3,0x9cf48c52,0xd6dca556,0x9cf4bdd8,0xa535a515,0xad56b596,0xa515a535,0xa535a515,0xad76ad76,0xb597ad76,0xb5b7b5b8,0xb597bdb8,0x84109cf4,0xbdd79492,0x9cd4b597,0xad769cd4,0xbdf8b597,0xb5b7bdf8,0xc619ce7a,0xd69bbdf8,0xbdf8ce7a,0xb5b7bdf8,
-0xbdf8a535,0xa515a535,0xad56ad56,0xb597ad56,0xce5ab576,0xad36ad56,0x9cf4a515,0xce3ac5f9,0xbe189cd4,0xad56bdf8,0xad96ad96,0xbdd7bdf8,0xb5b7bdf8,0xad76b597,0xbdd7ad56,0xb5b7c5f8,0xce7aa535,0xbdf8d69b,0xe73dbdf8,0xb5b8dedc,0xd6bcbdd8,0xd6bbffdf,0xbdf8c639,0xce7abdf8,0xe6fce6fc,0xce7ad69a,0xe71cce5a,0xef5de6fc,0xffffffff,0xb597dedb,0xc639bdf8,0xdedbdedb,
-0xe71dce5a,0xe71df79f,0xf79fc639,0xce5aef7e,0xb5b7c618,0xc618b5b7,0xce7ace5a,0xf79ee71d,0xce5ace5a,0xd69bc639,0xce7aef3d,0xef7edefc,0xad55c639,0xb5b7ce59,0xe6fcc5f8,0xe71dc639,0xb596ce5a,0xce59ce5a,0xbdf8bdf8,0xd6bbbdd8,0xbdd8b597,0xe6fcbdd8,0xffffffff,0xf79fffdf,0xf79fffff,0xb597ce7a,0xd67bd69b,0xce3ab597,0xbdd8b597,0xdefdc63a,0xa556bdd8,0xb5b8ad77,
-0xb5b7bdf8,0xbdd8c619,0xad76ad56,0x8431a535,0x8c318410,0x9cd48c31,0x9493a4f4,0x94939493,0x9cd49493,0x9cd49cd4,0x9cd4a4f5,0xa515ad56,0xad56a515,0x9cd49cd5,0xc619a4f5,0xce5ad69b,0xbdf8ce5a,0xb576bdd8,0xb5b7b597,0xad56ad56,0xa5159cf4,0xd67abdd8,0x9cd4c5f8,0x9cf49cd4,0xa5369cd4,0xa4f5ad36,0xa536ad36,0x9cb49493,0x94b4a515,0xa5369493,0x9cd49cf5,0xad77a515,
-0xb5b894b3,0x9cf5bdf9,0x9cb49cd4,0x9cf58c52,0x9cf49473,0xad36ad56,0xa535b5b8,0xb5979493,0xffffce5a,0xa535b5b7,0xce7bb5b8,0xd67bd67b,0xc5f9defd,0xa516b598,0x8c529473,0x8c728c52,0x94b3b5b7,0x9d158452,0xa515a535,0xce5ab597,0xb597b5b7,0xa5159cd4,0xa535ad36,0xb597b597,0xad77d67b,0xa515a515,0xb597b597,0xad76ad56,0x9493a515,0xad569cf4,0x8c5294b3,0x94928c51,
-0xad568c72,0x94929cd3,0x9cd4a515,0xa51494b3,0xa535ad35,0xbdd8bdf8,0x9cd494b3,0x8c528c72,0x9cd39493,0xa5159cd3,0x94b39cf4,0x94b494b3,0xb597a556,0xad56c639,0xa5149cd4,0xb5b7ad76,0xbdd8bdd8,0xad76b596,0xb5b7ad76,0xbdb7b5b7,0xbdd8ad77,0xbdb8c619,0x84119cf4,0xa5358c51,0xad76ad77,0x9cd49cd4,0xc619b597,0xbdf8bdd8,0xd69bbdb7,0xc639defc,0xbdf8c619,0xa515b597,
-0xad76b576,0xa515a515,0xa5159cd4,0xa515a515,0xad56b597,0xc619bdd8,0x9493a515,0xad569cd4,0xb5b7ad76,0xbdd7b5b7,0xb5b7ad56,0xad55b596,0xb576ad55,0xad76ad76,0xb5b7b597,0xce5ac619,0xad55bdd7,0xd69bc619,0xc639bdf8,0xce7ad69b,0xc639ce5a,0xffffd6bb,0xce5aef5e,0xce59bdd7,0xe71dd6bb,0xce39dedc,0xd69bce39,0xe6fcdebb,0xffffd69b,0xd6bbf79e,0xce7aa515,0xce7ace5a,
-0xce39d69b,0xffffffdf,0xdedcf7bf,0xef5ee71d,0xce59dedb,0xce59bdf8,0xce5adedb,0xd69bc618,0xe71dffff,0xbdd8c619,0xf79ee71c,0xce39debb,0xbdb7ce7a,0xc639b5b7,0xbdd8c639,0xce7ae71d,0xd67aef3d,0xef5dbdb7,0xc619debb,0xb597bdb7,0xce5abdd8,0xc639debb,0xffdfd6bb,0xf77eef5d,0xffffe71d,0xad56ef5e,0xe71db597,0xa515bdd8,0xbdd8d69b,0xc63ab5b8,0xbdd8bdd8,0xad76ad77,
-0xb5b7ce5a,0xbdf8c639,0xa515a535,0x9493b5b7,0x843173af,0x94b39493,0x94939cf4,0x9cd48c52,0x9cd4a515,0x9cd49cb4,0xa5159cd4,0xa535ad36,0xad369493,0x9cd4ad76,0xad56a515,0xce7abdf8,0xce7ad69b,0xad76b597,0xbdf8c619,0xbdd8b5b7,0xad76ad56,0xb597bdd8,0xb597c619,0x9cb39493,0x9cf59cf4,0xad76ad56,0xb597a515,0x9cf4bdf9,0xa51594b4,0xa5159cf5,0x9cf59493,0xa536a536,
-0x9cd4a535,0xc5f9b577,0x8c729cd4,0x94b3a4f5,0x9cf5ad36,0x9cd494b4,0xc619bdd8,0xad76b5b8,0xffffb597,0xad76d69b,0x9cf5ad56,0xbdf9b577,0x9cf5a515,0x9cd4ad36,0x9cf49cd4,0x8c728c72,0x8c73ad56,0xa51594b3,0xb597b597,0xb5b7a515,0xbdd8ad56,0xb597b576,0xa536b597,0xb597b597,0xc619c619,0xad76a515,0xb5b7ad56,0xad56b5b7,0x94b3ad56,0x94939493,0x94b39cd4,0x9cd494b3,
-0x94728c72,0x9cd3a514,0x9cb38c72,0xad359cf4,0x9cd4a515,0xa5159cd4,0x94b38c72,0x94b39cd4,0x949394b3,0x94b39cd3,0x9cf49cd4,0xa5359cf5,0xa5359d15,0xbdf9ad56,0x9cf4ad76,0xad569cf4,0xbdb7c5f8,0xb596bdb7,0xad76b597,0xbdb7b597,0xb5b8ad56,0xb597b598,0x8c72a535,0xad558c72,0xb5b8ad56,0xad56b5b8,0xbdf8ad56,0xbdd8bdf8,0xc618bdd7,0xce5ae6fc,0xb5b7b5b7,0xa535bdf8,
-0x9cf4b5b7,0x94939493,0x9cd49492,0x9cd49cb3,0xb597a535,0xbdd8b597,0x9473b577,0x94938c52,0xce5aad76,0xb5b7b5d7,0xad55bdf8,0xad55ad76,0xad559cf4,0xbdd7ad56,0xb5b7c5f8,0xce5abdf8,0xad35bdf8,0xce7ab597,0xbdd8d69b,0xdefcc619,0xc639d6bb,0xd69bc619,0xd69bf79f,0xc618d69b,0xce59bdf8,0xd69bdedb,0xc618ce5a,0xce59c639,0xef3dffff,0xe71dffff,0xb596d69b,0xc618bdf8,
-0xce5adedc,0xffdfce5a,0xffffffdf,0xd69bef5e,0xc639e71c,0xb597c619,0xce7abdb7,0xc618ce59,0xe73dce7a,0xce7adedc,0xce59bdf8,0xce59d6bb,0xd6bbc619,0xb597bdf8,0xb597bdd8,0xd69bc639,0xdedbbdf8,0xce5ace5a,0xc639f7bf,0xb576bdd8,0xce39b597,0xd6bbd69b,0xdefcce39,0xe73df7bf,0xce39e71c,0xbdb7e73d,0xbdd8a515,0xad56c5f9,0xce5aad77,0xc619bdd8,0xb597bdf9,0xb597b5b8,
-0xce5abdf8,0xad76ad56,0xad56a535,0xb5b7ad35,0x8c727bf0,0x94939cd4,0x9cf49cf4,0x84318c52,0x9cf4bdf8,0x9cf58c52,0x9cd494b4,0xad36b597,0x9cf59cf5,0xb597b577,0x9cf4a515,0xc619ad76,0xd69bce5a,0xa535c619,0xc5f8b597,0xbdd8b597,0xa535bdd8,0xad56b597,0xad56a535,0x94939cd4,0xa535a515,0xa515a4f5,0xb597a535,0x9cb4bdd8,0x94938432,0x9cf5a536,0x9cf5a515,0xa515ad56,
-0xad56a535,0xad369cd4,0x9cf4b597,0xa5359cd4,0xad36ad56,0xa5159cf5,0xd69bb5b7,0x9cd4d6bb,0xffdfa515,0xbdf8ef7e,0x9cd59cd5,0xad77b577,0xad57b597,0xb577ad57,0x94b49cf4,0x94939cb3,0xad77ad56,0x9cd49cf4,0xb597a515,0x9cd4ad56,0xb5b7ad76,0xad35bdf8,0xb577ad56,0xa536ad56,0xb577b598,0xb597bdd8,0x9cf4a535,0xa515a535,0x9cd4a515,0x8c528411,0xa5159492,0x9cd394b3,
-0x8c529cd3,0xad559cd3,0x94929493,0x9cf4ad35,0x94b39cf4,0x94938411,0x9cf4a515,0x94729cf4,0x8c729493,0x94b39cd3,0xa5159cf4,0xa5359cf5,0x9cf4a515,0xa536a515,0xad56bdf8,0xad559cf4,0xbdd8b5b7,0xbdf8bdb7,0xad76b576,0xbdd8ad76,0xb597c619,0xad77ad56,0xa515a515,0x9cf4a4f4,0xa53694b4,0xc619c619,0xad56a535,0xb5b7b5b7,0xbdd8b5b7,0xbdd8ad76,0xa515bdf8,0xb597ad76,
-0xa4f4bdf8,0x94938c52,0x94b39cd4,0x94729cd4,0xb5769493,0x9cd4a535,0xa515a515,0x843194b3,0xc63994b3,0xb5b7c639,0xbdd8ad56,0xad56ad56,0xad56ad56,0xbdd7ad76,0xbdb7bdd8,0xad35bdb7,0xce39bdf8,0xb597bdd7,0xd6bbbdd8,0xbdf8c639,0xe71ddefc,0xc639c639,0xffffef7e,0xce5af7bf,0xce39bdf8,0xc639c618,0xc639ce39,0xbdf8bdd7,0xce7ace5a,0xffffdefc,0xbdd7d6bb,0xbdf8c619,
-0xdefcc619,0xc619bdf8,0xef5ed6bb,0xe73dffdf,0xe71ce73d,0xbdb7c5f8,0xc5f8bdb7,0xc639d6bb,0xc639bdf8,0xdefcd67a,0xb5b7d6bb,0xf7bfd69a,0xd69bd6bb,0xbdf8e71d,0xb597ad56,0xbdd8ad56,0xb597ce5a,0xd6bbffff,0xdefcc639,0xbdd8c5f8,0xc619b597,0xdedce71c,0xd69ae71d,0xe71cd69b,0xd69bd69b,0xce7adedc,0xce7ad67a,0xbdd8ad56,0xad56ad77,0xc619ce5a,0xc619bdd8,0xbdd8bdd8,
-0xbdd8c619,0xb576bdd8,0xa515a4f4,0xa515a535,0xa515a4f4,0x8c319493,0xa5159cd4,0x9493ad35,0xb5b7bdd8,0x9cf4ad76,0x94939cf5,0xad36ad36,0xad36a515,0xa5369cd4,0x9493a515,0xbdd8a535,0xd69bc639,0xb597c639,0xa515a4f4,0xad56b597,0xbdd8bdf8,0xbdd8b597,0xa535b597,0x9cd4ad56,0xa51594b3,0xa4f5a535,0xbdd8b577,0xb597b597,0x8c529cf5,0xbdd88c73,0xad77bdf9,0xb5b8a536,
-0xad76ad76,0xa515a515,0xdedcc619,0xa515c619,0xbdd8b577,0xa535ad56,0xad76a515,0xbdf8d69b,0xffffbdf8,0xc639ad56,0x9cd5b5b8,0xa4f59cd4,0xb598bdd8,0xa515a515,0x947394b3,0xad56a515,0xc639b5b7,0x94b39cf4,0xa5159493,0xad76ad76,0xbdf8b597,0xb5b7a515,0xa536ad36,0xad36b5b8,0xa536a515,0xbdb8b597,0x94b3a515,0x94939493,0x8c73a515,0x8c728c52,0x9cb39493,0x9cd39cd3,
-0x9cb394b3,0x94b38c51,0x9cd3a515,0x9cf494b3,0x9493ad56,0x8c528c52,0x9cb39472,0x9cb394b3,0x94b394b3,0x9cf49493,0xa515a535,0xad56ad56,0xa515a536,0xa535a515,0xb5b7a515,0xad56ad76,0xb597ad35,0xad76bdf8,0xad56ad76,0xbdb7b5b7,0xce3ace3a,0xad56b5b8,0xb597ad56,0x9cf4a535,0xa5159cf4,0xce7abdd8,0xbdd8c639,0xc619b5b7,0xb597bdf8,0xa535ad35,0xb5b7bdd8,0xad569cf4,
-0xad76ad76,0x94b3a515,0xa4f4ad35,0x94729493,0x8c729493,0x8c5294b3,0xb5978c72,0x8c52ad76,0xa5159472,0xbdf8bdd7,0xa514ad76,0xad56b5b7,0xb597b597,0xb596ad76,0xb5b7b597,0xad76b5b7,0xb5b7b5b7,0xad55c639,0xce5ab5b7,0xce7ae73d,0xce7ac639,0xdedcdedc,0xe73de73d,0xe71def7e,0xce59ce7a,0xbdf8bdf8,0xd69bce7a,0xbdd8ce5a,0xce5ae73d,0xe71cc618,0xffffffdf,0xb596f7bf,
-0xb597ce5a,0xbdf8ce7a,0xd6bbc619,0xf79fe6fc,0xe71cffdf,0xc639ef7e,0xbdd7ce59,0xce7ac5f8,0xbdf8ce5a,0xdebbce39,0xc619debb,0xdefcbdd7,0xdedbffdf,0xb5b7d6bb,0xad56ad35,0xad77a515,0xce5aad76,0xd69bce5a,0xb597ce7a,0xd6bbe73d,0xce5ac619,0xf7bfe71c,0xd6bbd6bb,0xdebbd69a,0xce5adedb,0xdefcdebb,0xce5ad69b,0xa536bdd8,0xbdf9d6bc,0xd6bcbdd8,0xbdf9bdf9,0xb597bdd8,
-0xad35ce3a,0xce7abdf8,0xad569cf4,0xa4f4bdd8,0x9cd49493,0x8c729cd4,0x9cf49493,0x94b3a535,0xa5358c52,0xad76ce5a,0xad56ad36,0x9cd49cf5,0xa4f59cf4,0x9cb4ad56,0xad36a515,0xad769cd4,0xce39c619,0xbdd8bdd8,0xa4f4ad76,0xbdb7b597,0xc619b597,0xb5b7bdf8,0xb576c619,0xa515a535,0xad56ad56,0xad56ad56,0xa515a536,0xa536a515,0x9493a515,0xa5159cd4,0xb5b8bdd8,0xb597b5b8,
-0xa535bdd8,0xb597b597,0xdedca536,0xbdb8f79f,0xb5b8bdf9,0xad36a515,0x9cf5a535,0xc63abdf9,0xffdfd69b,0xad36a515,0xad57c619,0xa515a536,0xbdd89cf5,0xad77c5f9,0xad56ad56,0xad76ad56,0xbdf8ad56,0x9cd4a535,0x9cd49cd4,0xbdd89cd4,0xa535bdf8,0xb5b7ad76,0xa536bdf8,0xbdd8bdb8,0xad77ad56,0xb597ad77,0xa535c619,0x94b3a535,0x94939cd4,0x94b49473,0x94b38c72,0xa51494b3,
-0x8c729cb3,0x84318c31,0x9cf49472,0x9cf4a4f4,0x9cb39cf4,0x94b39493,0x94b38c52,0xad559cf4,0x9cb39cd4,0x9cf494b3,0xa535ad56,0xb5b7b597,0xa515ad77,0x9cf4a535,0xad76a515,0xad76bdd8,0xad56a515,0xbdb7ad76,0xbdf8b5b7,0xc639c619,0xd69bce3a,0xb597c63a,0xb597b597,0xb596ad56,0x9cf49cf5,0xbdd8a515,0xce7ace7a,0xb597bdb7,0xad56b596,0xa515a4f4,0xad76a515,0x9cd4bdd8,
-0xa515a515,0xa514b5b7,0xad359cf4,0x94b3a514,0x94b39493,0x8c518411,0x94b38c72,0xad76b597,0x9cb3a4f4,0xb596a514,0xa4f4ad76,0xbdd79cd3,0xb597b576,0xad56b596,0xad76ad76,0xc619b576,0xbdd7ad55,0xc639c618,0xc619bdf8,0xe73dce5a,0xb597ce5a,0xd69bce5a,0xdedcdefc,0xef7ededc,0xbdf8defc,0xce5ace39,0xd69bce7a,0xbdd7e71c,0xdedbe6fc,0xce7ace39,0xffffdefc,0xb596ffdf,
-0xc619b597,0xd6bbbdd8,0xdebbce5a,0xd69bce5a,0xd69ace59,0xfffff7bf,0xce5ace5a,0xc619c618,0xc639ce39,0xef3dce39,0xce39dedc,0xbdf8b597,0xef3ddedc,0xbdf8b5b7,0xbdd8b5b7,0xb577b577,0xad76ad56,0xbdb8d67b,0xd69bce3a,0xffdfbdd8,0xce5adefc,0xdebbd69b,0xdedcef7e,0xd6bbe6fc,0xd6bbe71d,0xdedcce7a,0xad76a535,0xbdd8ce5a,0xce7bce7a,0xce7be71d,0xad56ce7b,0xce5ab597,
-0xbdd8d67b,0xb5b7bdd8,0xad56ad76,0xa515a515,0x94b49493,0x9493a4f5,0x8c528431,0x94938c31,0x8c728c52,0xa5359cf4,0xad569cf4,0xa4f5bdd8,0xa535a515,0xb597a515,0xa5359cf4,0xad76bdd8,0xb597bdd8,0xb5b7bdf8,0xbdd8bdf8,0xc619a535,0xb597bdb7,0xc619ce39,0xad76b5b7,0xad76ad35,0xbdd8c5f9,0xa5159cf4,0xa515ad76,0xa536a536,0xad779cf5,0xa515ad77,0xc63aa536,0xb5b8c619,
-0xc6199d15,0xbdf9c619,0xc619c63a,0xdedcce3a,0xa515ce5a,0x9cf59cd4,0xa535a515,0xad76ad77,0xffffdebc,0xad36f7bf,0xd67bb577,0x9cd4ce5a,0xad77a515,0xbdd8c619,0xad36a515,0xa515ad76,0xc6199cd4,0x9cd4ad56,0x9cf4a514,0xad569cf4,0xbdb7c619,0xb5b7a535,0xbdb7b597,0xc5f9b5b8,0xa516bdb8,0xad369cd4,0xad76b597,0xa5159cd4,0x94739493,0x94939cb4,0x94b39cf4,0x9cb39493,
-0x9cf4a515,0x94b394b3,0x94928410,0x94b3b5b7,0x94b38c72,0x8c728c52,0x94938431,0xa5359cd4,0x9cf4a515,0xa555a514,0xad56ad56,0xa536a515,0x9cf5ad77,0x94b39cf5,0xad5694b3,0xc639ad56,0xa535b597,0xb596a535,0xc639c639,0xc619c639,0xc619ce7b,0xc619ce3a,0xad56ad76,0xb576b5b7,0x9cf5a515,0xa5359cf4,0xce7ab5b7,0xad35bdf8,0xa515a535,0x9cf4a535,0xad769cf4,0xad56b5b7,
-0x9cd39492,0xb596a535,0xad76b597,0x9cd3a515,0x9cd39493,0x84318c31,0x84318c72,0xb5b794b3,0x9cd3b5b7,0x84108c51,0xad76a4f4,0xa4f4ad55,0xb596bdb7,0xad56b5b7,0x9cf49cf4,0xb597a535,0xad76bdf8,0xc639bdd7,0xb597ce5a,0xc639bdd8,0xc639dedc,0xdedcb597,0xce7aef5e,0xdedcdedb,0xe71cffbf,0xbdd7bdf8,0xce7ace39,0xdefcd69b,0xdedcdedb,0xc618bdf8,0xdedbd69a,0xad76f7bf,
-0xbdb7bdd8,0xbdf8ce39,0xce5ad69b,0xdefcd67a,0xef5dc639,0xef7effdf,0xd69bf7bf,0xc5f8d69a,0xce59b5b7,0xbdd8d69a,0xef7ece7a,0xa535ce5a,0xf7bfbdd7,0xc619dedc,0xdedcbdf8,0xbdd8bdf8,0xb5b7bdd8,0xce7ab577,0xc5f9bdd8,0xc5f9c639,0xef5effff,0xbdf8ce59,0xe73ddedb,0xd69ad6bb,0xc639c618,0xef7ed69a,0x8c72c639,0xc5f9b597,0xb5b8b597,0xdefdd69b,0xdefdc63a,0xc619bdf9,
-0xad76bdd8,0x9472a515,0xbdd89cd4,0xad568c52,0xa4f5ad36,0xad5694b4,0x8431a515,0x94b38411,0x94929cd3,0x9cf49cb3,0xad56bdd8,0xc619ad56,0xa515bdb8,0x94b3a535,0x9cf4a535,0xdedcbdd8,0xc619b597,0xbdd8bdd8,0xb5b7c5f8,0xa535ad56,0xb576b597,0xbdf8b597,0xb597ad76,0x9cf4a535,0xa515b597,0xa4f59cd4,0xa535a536,0xbdd8ad56,0xad56b597,0xad77ad77,0xad77ad77,0xb5b8ad56,
-0xa556bdf9,0xbdf9b597,0xc619c63a,0xce5ab5b8,0x9cd4c639,0xa515a515,0xa536a515,0xa5159cf5,0xffffce3a,0xa515ad56,0xa4f59cf5,0xbdd8bdf9,0xa4f5ad36,0xc63aad36,0xa515b577,0x9cf494b3,0xad769472,0x8c52b597,0xb5b79cd4,0xa535ad76,0xc618ad55,0xad35b5b7,0xb597ad76,0xc5f9ce3a,0xa515a515,0xa5159cd4,0xad56ad35,0x9cd4ad56,0x84119493,0xa4f59473,0xa515a515,0x9cf4a535,
-0xb5979cb3,0x94b3ad76,0x94939492,0x9cd49cd3,0x8c729493,0x8c729cd4,0x94b38c72,0x94b38c72,0xad76ad56,0xad559cf4,0x9cf4a535,0x9cf59cf5,0xad779d15,0x9cd4a515,0x8c739493,0xad76a535,0xbdd8d6bb,0xb597ad56,0xd69ace39,0xbdf8c639,0xbdd8bdd8,0xb597bdd8,0xb5b7bdd8,0xad76b597,0xa536a535,0x9cf4a515,0xbdd89cf4,0xbdd8c5f8,0x94b3a4f4,0x9cd4ad56,0xa5159cf4,0xad569cf4,
-0x9cf4a515,0xa535a4f4,0xb597b597,0x9cd3a4f4,0x8c7294b3,0x8c729cf4,0x8c729493,0xad768c52,0xbdd8d67a,0x8c519492,0xbdd89452,0xad35bdd7,0xbdb7ad55,0xb576b576,0x9cb3b576,0xa5359cb3,0xbdf8bdd8,0xc639ad56,0xc619d69b,0xc639b5b7,0xd6bbd69b,0xd69bdedc,0xef5ef79f,0xffdfffff,0xffffd69b,0xbdf8e73d,0xbdd8bdf8,0xce59bdd8,0xef7ee71d,0xc639ad76,0xc639ce7a,0xce59d69b,
-0xc619ad76,0xc619c619,0xce7ac619,0xdebbce7a,0xd69ace59,0xdedce73d,0xef5de73d,0xc639d69a,0xbdf8c619,0xbdf8d67a,0xd6bbbdd7,0xad76dedc,0xc619a515,0xe71dd69b,0xbdd8ad56,0xad56bdb8,0xbdd8b597,0xbdf9c639,0xc63adefd,0xd67bce7a,0xffffc5f8,0xc619e71c,0xc618c619,0xb596dedb,0xce7ac5f8,0xffdfe73d,0xb597d6bb,0xad769cd4,0xc63ace5a,0xdebcbdb8,0xc5f9dedc,0xbdb8bdf9,
-0xa514ce5a,0xa4f49cf4,0xb5b794b3,0xa536a536,0xbdf89cd4,0x9cb49493,0x9493bdf8,0x8c527bf0,0x9cd494b3,0x9492ad35,0xbdf89cf4,0xad56b5b7,0xc5f8bdb7,0xad76a4f4,0xc619b597,0xce5ac619,0xc639d69b,0xbdb7c639,0xb5b7c619,0xb597bdb7,0xa5359cf4,0xb597b597,0xb597b5b7,0x8c729cb3,0xa5159493,0xa4f5a4f5,0xad369cf4,0xb597b597,0xa536bdd8,0xb5979cd4,0xa536ad77,0xce5aa536,
-0xa556bdf9,0xbdd894d4,0xd69bbdd8,0xa515bdd8,0xffffce7a,0xad56ef5e,0x9cd49cf5,0xa51594b4,0xc619b597,0xbdb8c619,0xad369cd4,0xd69bc619,0xa515c619,0xa515a535,0xb597c619,0x9cf5a515,0x9cd4a515,0x9cd4b576,0xa5159cf4,0xad56c618,0xa535a535,0xb597c619,0xbdf8ad76,0xdefcbdf9,0xad77bdf9,0x9cf5ad56,0x8c729cf4,0xa5359472,0x83f18c32,0x94937bf1,0x9493ad56,0xa5149cd3,
-0x9cb39cf4,0xa515ad35,0x8c5194b3,0x94b39492,0x9cf4a535,0x94b394b3,0x9cd49cf4,0x9cd48c72,0xad35a4f4,0xa535a535,0x94b4a515,0x9cd494b4,0x9cf594d4,0x9cd49cf5,0x8c528c52,0xa53594b3,0xdebbbdd8,0xb597b5b7,0xbdb7bdd7,0xbdf8ce59,0xbdf8bdd8,0xad36b5b8,0xb5b7b577,0xb597bdb7,0xad56ad77,0xa5159cd4,0xa515a535,0xc619ad76,0x9cd3ce7a,0xad569cd4,0x9cf49cd4,0x9cd49cf4,
-0xa535a515,0x94b3a4f4,0xad55ad56,0xa535b5b7,0x9cf494b3,0x94b394b3,0x84319492,0x9cd494b3,0xc6199cd4,0x9472b576,0xad359cb3,0xb597c5f8,0xad55ad55,0xad35ad15,0xbdb7c5f8,0x9cd49cd4,0xbdd7ad76,0xc5f8c619,0xce5abdf8,0xc639ce7a,0xce7ac639,0xffdfffff,0xffdfffff,0xe6fcffbf,0xd6bbc619,0xe71cffff,0xbdd7b576,0xb597b596,0xffdfd6bb,0xbdf8bdf8,0xc619b5b7,0xc639ce59,
-0xbdb7ce5a,0xbdf8bdd8,0xbdf8ce7a,0xd6bbdedc,0xef7ee71d,0xd69adedb,0xdefcdedb,0xdebbef5e,0xbdd8c619,0xce5ab5b7,0xc618defc,0xc639d69a,0xbdd8ad76,0xc639bdb7,0xb5b7bdd8,0xce39bdd8,0xc619ce7b,0xb5b7c63a,0xdedcbdf9,0xdebbbdf8,0xbdf8ce5a,0xc639e73d,0xce59d67a,0xd6bbbdd7,0xe71dce7a,0xef7eef5d,0xd69bd69b,0xbdd8c5f9,0xbdb8c63a,0xb597a515,0xad36bdb8,0xdedcb577,
-0xa515ce5a,0x9cf49cd3,0xad56a515,0xbdd8ad56,0xce3a9493,0x94939cd4,0xa5159cf4,0x843183f0,0xad568c51,0x94b3bdd8,0x9cd49cf4,0xad56ad56,0xb5b79cf4,0xa515b5b7,0xb5b79cd4,0xad56ce7a,0xd69bb597,0xbdd8bdd8,0xbdf8c619,0xa535ad56,0x9472ad56,0xad569cd4,0xad56b597,0x94729cd4,0x94b49cb4,0x9cf5a515,0xad56a515,0xa536a515,0xa515a536,0xad56a536,0xb5b8ad56,0xad56ad77,
-0xad77ce5a,0x9d15b5b8,0xd69be73e,0xf7bfd6bc,0xffffe71d,0xb5b7ffdf,0x94b39493,0xad769cf5,0xc5f9c619,0xc619a515,0xad56c5f9,0xbdb8ad77,0xe6fdc5f9,0xad56bdf8,0xd67bc619,0x9cd4b577,0xa5159cf4,0xa515bdf8,0x9cd4a535,0xbdf8b5b7,0xa514b596,0xc619ad76,0xad76b597,0xc619bdf8,0xb598d6bc,0xa515bdd8,0x9cd48c52,0x8c529cf4,0x84118c52,0x84118411,0xa5158431,0xa4f4a514,
-0x94b3ad55,0xad769cf4,0x94729cf4,0x94938c72,0xbdd89cd4,0x9cf4ad76,0x9cf49cf4,0x9cd49cf4,0xad55a515,0xb5b7bdd7,0x9cf5a535,0x9cd49cd4,0x94b494d4,0x94b49493,0x94939493,0x9cd494b3,0xad77a515,0xce5ae71d,0xb5b7bdd8,0xce59a535,0xb597d69b,0xad56ad56,0xbdb8ad36,0xc619ce5a,0xa515ad56,0x9cd49cf4,0xa5159cf4,0xad359cd4,0xc639dedb,0x9cd39472,0xa51594b3,0x9493a515,
-0xad56a4f4,0xa535ad76,0xad559cf4,0xad56ad76,0x94b39cf4,0x9cd39492,0x8c518c72,0x94928c52,0x9cb394b3,0xbdb7c619,0x9cd39472,0xbd97a514,0xb556bdd7,0xad35ad15,0xad35a4f4,0xad55bd97,0xb5b79cd4,0xbdd8bdb7,0xd69bbdf8,0xdedcce7a,0xdedce73d,0xffffe71d,0xce5ae71d,0xef5ece5a,0xdedcef7e,0xffdfdefc,0xbdd8e71d,0xc5f8bdf8,0xffffc639,0xb5b7debb,0xb5b7b576,0xd69bad76,
-0xc619dedc,0xbdd8b5b7,0xbdd8c639,0xf77ece5a,0xe71df79e,0xd69bef5d,0xd69bce5a,0xf77ededc,0xc619ce7a,0xbdd8b597,0xce7affff,0xb5b7c639,0xd67abdd7,0xc618ce39,0xe73dce7a,0xc619c639,0xad56c639,0xa535a4f4,0xbdb7bdf8,0xbdd8d67b,0xe6fcc639,0xdedbc618,0xef7eef7e,0xd6bbad76,0xdefcf79e,0xe73de71d,0xb5b7ce5a,0xbdd8c619,0xc5f99cd4,0xad56ce7b,0xbdd8a515,0xdedcbdd8,
-0xad55e71d,0xa514b597,0x9cb3a515,0xce5ab577,0xb577a515,0x9493a515,0x9cd48c52,0x94938410,0xa514a535,0xc619ad56,0x94b3c619,0xad76ad36,0xb597b597,0xa4f4b597,0xad569cd4,0xb597ad56,0xc619ad35,0xce7aef5e,0xa515ad56,0x9cb394b3,0x9cd49cf4,0xa5159493,0x9cd4ad56,0x9cd4a4f4,0x9cf59493,0x9cb494b3,0xad56ad76,0xa515ad77,0xad56ad56,0xa515ad77,0x9cd49493,0xa51594b4,
-0xd6dca556,0xffffffff,0xd6bcffff,0xc619bdf9,0x9cf5ad56,0xce7bce5a,0x9cf5b597,0x9cf4a535,0xb597b597,0xb597bdd8,0xc639ce5a,0x9cf4ad35,0xbdf8a515,0xad56bdf9,0xa5159cf5,0xb597bdf9,0xb597ad56,0xb5b7bdf8,0x9cf4b5b7,0xc5f8a535,0xb597bdd8,0xb597ad56,0xb597b5b8,0xc619a536,0xbdb8ce3a,0xa515a515,0x9cd494b3,0x9cf49cd4,0x8c528c52,0x83f18411,0x8c317bd0,0x9cb39cf4,
-0x9cd49cd4,0xa535a535,0x9493ad76,0x84318431,0x94b38411,0x94b39cf4,0x8c528c52,0x8c529493,0xbdd7a514,0xb597ad76,0xa536b597,0x9cf5ad77,0x8c739493,0x94938c52,0x9cd494b3,0x9cf49cd4,0xbdd8a4f5,0xf79fb5b7,0xa4f4ce5a,0xb5b7ad55,0xb5b7c639,0xa515ad36,0xad569cd4,0xce7abdf8,0x9cf4b597,0x9cd49cd4,0x9cd4a515,0xa51594b3,0xce7abdf8,0xb576d6bb,0x94b39d14,0x94939cd4,
-0xad569cd4,0xb5b7b5b7,0x94938c52,0xa4f48c72,0x8c52a514,0x8c728c72,0x8c728c51,0x94b38431,0x9cd39cb3,0xc639ad76,0x8c31a4f4,0x9cb39472,0xce19b576,0xb576c5d8,0xad35ad35,0x9cb3b556,0xad56ad35,0xbdf8a535,0xce5ad69b,0xce5adedc,0xdedcd69b,0xd69bc639,0xd6bbef5e,0xd6bbd67a,0xf7bfffdf,0xd6bbdedc,0xe73dffff,0xb5b7bdd8,0xd6bbb597,0xf7bfce5a,0xad35c619,0xbdb7b597,
-0xd69be71d,0xce5ac5f8,0xd6bbbdf8,0xd6bbffff,0xce7abdf8,0xe73def5d,0xbdf8ce5a,0xd6bbc619,0xce39d69b,0xdefcad56,0xb597e73d,0xdefcce5a,0xce5abdd8,0xbdd8ce5a,0xbdb7b597,0xc5f9c619,0xc619ce5a,0xb597b5b7,0xb576ad56,0xd69bb577,0xd69bd69b,0xbdf8d67a,0xdedce71c,0xb5b7b596,0xffdfe71c,0xd6bbef5d,0xb576b597,0xb5b7b5b7,0x9cd49cf5,0xb577b597,0xbdd8b597,0xe71db5b7,
-0xb596dedb,0xbdb7ad76,0x94b3a535,0xbdd8b577,0xbdb8ad56,0xa4f59cd4,0x94939cb3,0xdedc9cb3,0x8431c639,0xce7a9cd4,0x94b3a535,0xad56a515,0xb597ce5a,0xce39a535,0xad35bdd8,0xad56ad76,0xbdf8c5f8,0xef5effbf,0x9cd4a535,0x94b39493,0xad56a515,0x9cd4ad56,0xad569cd4,0x9cd49cf4,0x9cb4a515,0x9cb49cd4,0xad76a4f5,0xad36b597,0xb5b8bdd8,0xa515ad56,0x9cf5a515,0xef9fad56,
-0xd6bce71e,0xd6bcffff,0x9d15b5d8,0xad77ad56,0xa515a536,0xb5979cd4,0xbdd8defd,0xa5369cf5,0xa535a4f5,0xad56a536,0xce5aad56,0x9493ce39,0x9cf49cd4,0xa536b597,0x9cd494b4,0xdedcb577,0xa4f4b5b7,0xc5f8c5f8,0xad769cd4,0xb597bdb7,0xbdf8bdb7,0xbdf8b5b7,0xb5b7ad56,0xb597c619,0xb577bdb8,0x9cd4b597,0x9cb3ad56,0x94b38c52,0x8c528411,0x84319493,0x8c528431,0xa5148c72,
-0x9cf49cf4,0xb5b7ad56,0xa4f49cf4,0x7c1094b3,0x8c728431,0xa5358c72,0x8c529cf4,0x94939cd4,0xa5359493,0xa535a535,0xb5b8b597,0x9cf5ad56,0x949394b4,0x8c728c73,0x94938c72,0x9cf49cd4,0xa515b597,0xc619bdd8,0xb5b7f79e,0xa5359cf4,0xbdf8b597,0x9cd4ad56,0xad369cf5,0xc619ad76,0xb597ce5a,0xa5159cf4,0x9cd4ad56,0xad359cf4,0xc6199cf4,0xdedbe71c,0x9cf4b5b7,0x94939493,
-0xa5359cb4,0xad56ad56,0x84119493,0x94939472,0x94939472,0x8c519472,0x94728c72,0x9cb39cb3,0x9cb39472,0x8c72a515,0x9c93bdb7,0x947283f0,0xb576a4d3,0xb576c5f8,0xbd76b535,0xb556b535,0xad76bdd8,0xbdd8b597,0xdefdc63a,0xb5b8c619,0xd69bb597,0xce5ace5a,0xf79fdedc,0xd69bdedc,0xf7bfd6bb,0xe71def5e,0xf79fd69b,0xb597ef5e,0xb5b7bdd8,0xe71dbdd8,0xbdf8ef5e,0xad35b5b7,
-0xd6bbb5b7,0xd6bbce7a,0xdedcbdf8,0xd67ae73d,0xce59c639,0xe73dce5a,0xc639defc,0xd69ad67a,0xdedcce7a,0xd69bb597,0xb597d67a,0xef5dc619,0xb576c639,0xc5f8bdd8,0xa4f4a514,0xdebbad76,0xce5ac639,0xad76ce5a,0xa514ad55,0xad55a515,0xd69be71d,0xd6bbdedb,0xef7ea4f4,0xce7affbf,0xef7ebdf8,0xc639f79f,0xb5b7b5b7,0xbdf8ce5a,0x9cb4b5b7,0xb597a4f5,0xbdd8c619,0xe73dbdb8,
-0xad55d6bb,0xa515b596,0xa515b596,0xb5b7ad56,0xb597b577,0x9cd4a515,0x9cb3ad56,0xbdd89cf4,0x9cd4bdf8,0xad767bd0,0x9493a515,0xad56a536,0xc639ad56,0xbdd8bdb8,0xbdb7ce7a,0xa515a535,0xce5ab597,0xbdd8ad76,0x9cf4c619,0x94b38c72,0xb576a535,0xa535b5b7,0xa5359493,0x94939cd4,0x94939cf5,0x9cd49493,0xb577ad56,0xc619b577,0xa536bdd8,0x9cf59cf5,0xe73eb597,0xdefdef7f,
-0x8c93b5b8,0xb5b88c93,0xb5d89d15,0xb5979cf5,0xa515ad77,0x9493a515,0xe71dc63a,0xb597bdd8,0xa4f5a536,0xad769cf4,0xb576bdd8,0xc639d69b,0x94b394b3,0xbdd894b4,0x9493bdd8,0xb5989cb4,0xb577ce3a,0xbdf8ad76,0xad76a535,0xbdd8c639,0xc619ad56,0xbdf8c619,0xbdd8b597,0xc619bdf8,0xbdf8a515,0x84319cf4,0x9cf49cd4,0x84318c72,0x83f09493,0xad3594b3,0x94928c52,0x9cf49493,
-0x9cd3a535,0xad55ad56,0x94b39cf4,0x8c729cd3,0x94b39493,0x94b39cd4,0xa535a535,0x9cd49493,0xa515a4f4,0xa536ad77,0xad77a515,0x9cd5a516,0x94d49cf5,0x8c528c72,0x9cf48c72,0xa515a515,0xad36a515,0xbdf8ad56,0xffbfbdf8,0x9cd3bdd7,0xb597a515,0xad56b597,0x9cd49cd4,0xad35a4f4,0xbdd8c639,0x9cf4a535,0x9cf4a515,0xa4f4a515,0xad76a4f4,0xc639bdd7,0xb5b7c619,0x94b39cf4,
-0xa4f5a4f5,0xa515ad35,0x9cb3ad56,0x7bcf8c72,0x949383f0,0x9cb39cd4,0x9492a4f4,0x94939cf4,0x94938c52,0x8c518c51,0xc5f8a4f4,0x9c93ad35,0xb555bd96,0xad35b555,0xbd97b556,0xad15b576,0xb597b576,0xb597bdd8,0xc619b5b7,0xbdd8d69b,0xce5ace5a,0xce7bd69b,0xd6bbd69b,0xdefcef7e,0xd69bce5a,0xef5ef77e,0xdedce73d,0xef5eef7e,0xc619bdd8,0xa535ad76,0xffdfe73d,0xad76ad76,
-0xb5b7bdd8,0xce5ad6bb,0xce7adedc,0xc639bdf8,0xc618ce5a,0xd6bbc639,0xdedbdebb,0xd6bbd69a,0xdedcc619,0xbdd8debb,0xb5b7c5f8,0xc619ad55,0xad76e6fc,0xd69ab596,0xb576debb,0xbdd8bdb7,0xb596ce7a,0xc639b596,0x9cd4ad56,0xad56a515,0xd69bb597,0xc639d67a,0xad76defc,0xd67aef5d,0xc639c618,0xdedcd69a,0xb597bdd7,0xc619c619,0xbdd8d69b,0xad36a515,0xd6bcd69b,0xce5ac639,
-0xc638ce7a,0xc618c639,0xad55b5b7,0x9cf4ad76,0xb5b8b597,0xad56a515,0x9cd48c72,0x9cf4a515,0xbdb7b597,0xce5a8c72,0x9cd49cd4,0xbdd8ad77,0xbdb8a535,0xc619ce5a,0xc619c619,0xad76a535,0xb5b7b576,0xad35b5b7,0xb5b7ad76,0xa535ad56,0xbdd8ad56,0xbdd8ad76,0x9cd4ad56,0x9cb39cf4,0xa4f594b4,0xa5159493,0xa515ad56,0xb577a515,0xa536b5b8,0xad56a536,0xb597ad56,0xa556b5b8,
-0x94d494b4,0x9cf594d4,0xc63ab5b8,0xad77bdf9,0xa536ad77,0xa515b597,0xd69ba536,0xbdf8defc,0x9cf4ad56,0xb5b7ad56,0xb596b597,0xdefcb5b7,0x8c72c619,0xad569cb4,0xa536b577,0xa5169cf5,0xd67bad56,0x9cf4b597,0xa535ad76,0xad56ad76,0xb597ad76,0xbdf8c619,0xbdd8b597,0xce7ab597,0xad56b5b8,0xbdf8c639,0x8c729cd4,0x84119493,0x84318c72,0xa5158411,0x9472a515,0x94928c51,
-0xa51494b3,0xa515a514,0x949394b3,0x9cf48c51,0xa5159493,0x94939cd4,0xa5359cf4,0x94d3a515,0xad76ad56,0xa536ad77,0xa536a515,0xa536ad56,0x9cf59cf5,0x8c528c73,0xa5358c72,0xa515a555,0xa5159cd4,0xa535ad56,0xbdf8b597,0xbdd7f79f,0x9cf49cd4,0xad56ad56,0x94939cb4,0x9cf49cd4,0xad56b597,0x9cf4a535,0xa5359cf4,0x94b39cd4,0xa51494b3,0xb5b7a535,0xce5aad76,0x94b3b597,
-0xad36ad56,0xad35ad76,0xad35ad35,0x8c319472,0x8c529472,0xa5149cd4,0x9493ad35,0x949394b3,0x94939493,0x8c729cb3,0xce39a4d4,0xad35e6fc,0xb5569c92,0xad15b555,0xc5b7bd96,0x9c72b535,0xb5979493,0xb577b577,0xbdd8ad76,0xd6bcc619,0xce5ac619,0xef5ee71d,0xdedcd69b,0xe71df77e,0xce5adefc,0xf79fd6bb,0xe71def3d,0xe73dce5a,0xb5b7defc,0xad56b597,0xdedca535,0xc619ffdf,
-0xbdf8bdd8,0xc639c619,0xce7ace7a,0xb5b7c619,0xd69bce7a,0xbdd7c618,0xe71dc639,0xce7ae71d,0xbdd8ce7a,0xd6bbd6bb,0xad56b5b7,0xad76a535,0xef3dffdf,0xbdd7a514,0xef5effbf,0xc619ad35,0xbdd7c5f8,0xbdd7ad55,0xc618c618,0xa515b576,0xbdb7a535,0xce59e71c,0xdedbc618,0xf77ece59,0xce7adedb,0xc618c618,0xb597c639,0xb5b7ad76,0xbdd8ad56,0xad36b577,0xce7bc63a,0xad56c619,
-0xb5b6c618,0xc639d6bb,0x94b3a535,0x9cd49cd4,0xce5ace7a,0xc619a535,0xb596c639,0x9cd3ad55,0x94b394b3,0x94b3ad56,0xad36a4f5,0xbdb8ad56,0xa4f5a4f5,0xd69bb597,0xb5b8c619,0xb597b597,0xc619ad76,0xc619c619,0xad76a515,0xb5b7c619,0xbdb7bdf8,0xbdd8b597,0xb597c619,0xad56a535,0xa515b597,0xbdd8b5b7,0xbdb8b577,0xad77b597,0xb597b5b8,0xb597b597,0x9cf5a515,0xb5b8b597,
-0x9cf5ad97,0x94d49cf5,0xad5794d4,0xd69bb597,0xce5aa536,0xbdd8a515,0xad56c63a,0xc639c619,0x9493b5b7,0xa514a535,0xa5159493,0xa535bdd7,0xad56bdb7,0x9cf4a4f5,0xbdd89cd5,0xad57bdb8,0xad369cf5,0xb597bdf9,0xad56a535,0xb597a515,0xb597ad56,0xbdf8b597,0xb597b5d8,0xb597b5b8,0xad56c5f9,0xc639ad56,0x94b3ad76,0x8c728c72,0x7bd08411,0x84318c52,0x9cd39cd3,0x8c729492,
-0x9cb394b3,0xa535ad35,0x94b394b3,0x9cd39cd4,0x9cd49cd4,0x94b39cf4,0x9d148c93,0x9d15a556,0x94b49cd4,0xa536a536,0xad57a536,0xad369cf5,0x9d159d15,0x8c5294b3,0x94b38c52,0x949294b3,0x9cb49cd4,0xad56a515,0xa535a535,0xef3dad76,0x9cf4b5b7,0x9cd49493,0xa536a535,0xa515a535,0xad56ad76,0xa535ad56,0xa535a535,0x94929cb3,0x9cd39492,0xa515a4f4,0xb596a535,0x9cd4c639,
-0xbdb8ad56,0xa515b576,0x9cd49cb4,0xd69bbdd7,0x9492ad56,0x9cf49492,0x9492a514,0x94b39cd4,0x9cf49472,0x94939493,0xbdb7ad56,0xd69bc5f8,0x9452a4f4,0x94729452,0xad149c93,0x9492a4d3,0x9cd49493,0xbdd8ad76,0xbdd8b597,0xce5abdd8,0xbdd8defc,0xd69bce7b,0xd69bdedc,0xdedcc639,0xe71def7e,0xce7ad69b,0xe73de73d,0xc639debb,0xe71ddefc,0xb597bdd8,0xad76ad56,0xef7ed6bb,
-0xbdf8b5b7,0xc639bdf8,0xd6bbbdf8,0xbdd8ce5a,0xdedbc5f8,0xce7ad6bb,0xce59c619,0xdefcd6bb,0xb597bdd8,0xdefcffff,0xbdf8c639,0xad56a535,0xffbfce39,0xad56bdd7,0xce59ad55,0xffffce39,0xb5b7bdf8,0xad76b5b7,0xb5b7bdd8,0xad56b576,0xb597b596,0xc618bdf8,0xc618ad76,0xbdf8d6bb,0xe6fce73d,0xad55bdf8,0xc639b597,0x9cf4b597,0xa536ad56,0xad76a515,0xb576b5b8,0xbdf8bdf8,
-0xb5b7b597,0xef5dd67a,0xad55bdf8,0xc639a515,0x9cf5debc,0xc639ad56,0xdefcdebb,0xb5b79cf4,0xad359cd4,0xa515c639,0xa515ad36,0xad56a515,0xad56ad76,0xc5f9b597,0xc639dedc,0xbdf8bdb8,0xbdf8bdf8,0xbdb7bdf8,0xad76c639,0xc619b5b7,0xb597bdb7,0xbdb7bdb8,0xb597bdd8,0xad56b5b7,0xce3ac63a,0xbdf8bdf9,0xb5b8ce3a,0xb597b577,0xbdd8a536,0xad77bdd8,0xa515a536,0x9cf5a536,
-0xb5b8b5b8,0x9cf59d15,0xad778c73,0xbdd8b597,0xbdd8d6bc,0xc63abdd8,0xad76bdf8,0xce5aa515,0xb5b7d69b,0xa514a535,0xa5359492,0xad35bdf8,0xad569cd3,0xa515bdd8,0x8c739473,0xc5f9c5f9,0x9473a536,0xce5a9cb4,0xad76ad76,0xa535b597,0xbdd8ad76,0xa535b5b7,0xbdf8ad77,0xa515ad97,0xb576a536,0x9cf4ad56,0xa514b5b7,0x94728c72,0x8c528c52,0x8c528411,0x8c728c72,0x9cf49cf4,
-0x9cb3a515,0xa5149cd3,0xa5359cd4,0x94d39cf4,0x9cf494b3,0x9cd494b3,0x8c9394b3,0xa535a535,0x9cd49cf5,0xad77a515,0x94b49cf5,0x94939cd4,0xa515a536,0x8c7294b4,0x94928c51,0x8c518c72,0x9cd49472,0xad569493,0x9cf4b597,0x9cf4a4f4,0xbdb7e73d,0x94939cb4,0xad36a515,0x9cf4ad35,0xa535a535,0xa5359cf4,0xa535a515,0x9493a4f4,0x94729cf4,0x94b394b3,0x9d149492,0xb5b7a535,
-0xb576ad76,0xad56bdb7,0x9cf49493,0xc639b597,0x9cb3c619,0x94938c52,0xad56a515,0x94b39cd3,0x9cf49cf4,0x9cf4a4f4,0xad359493,0xb597b597,0xad56d67a,0x94528c11,0x9cb39cb3,0xbdd79c93,0xb5b7c5f8,0xb597b597,0xb5b7ad76,0xc63abdf9,0xe71dd69b,0xc619c619,0xef7ece5a,0xc639ce5a,0xe71ddedc,0xb5b7ce5a,0xf77fce5a,0xdefcef3d,0xef5ece5a,0xad55d69b,0xad35bdd7,0xd6bbbdd7,
-0xbdb8ffbf,0xc639c619,0xbdd8ad76,0xc639d69b,0xc619c619,0xd69bce7a,0xbdf8c619,0xce59ce39,0xb597c619,0xd69affff,0xce59c619,0xbdd7b5b7,0xffffb596,0xbdb7ef3d,0xb5769cd3,0xc639ad76,0xce59d69a,0xce39debb,0xb596bdd8,0xa515ad56,0xbdb7b597,0xb576c619,0xad56dedc,0xef5dd67a,0xef5ece7a,0xd69be71d,0xbdd8ad76,0x9cd4ce5a,0x8c72ad35,0xa5359cf4,0xad76bdd8,0xd69bad55,
-0xb596ce59,0xd69bbdd8,0xbdf8dedc,0xdefcc5f8,0xc639d69b,0xd67abdf8,0xd6bbdefc,0xc5f8ad76,0xa535ad76,0xbdb7c619,0xa535bdd8,0x9cf4ad56,0xbdd8c639,0xb597bdb7,0xdefdce7a,0xc5f9c619,0xc639dedc,0xb5b7ad56,0xc619ad77,0xb597b597,0xb5b7d67b,0x9cd4a4f5,0xad76a4f5,0xad77b5b8,0xb5b8ad56,0xa515b577,0xc619b598,0xb577b598,0xad57ad77,0x9cd4b598,0x9cd48452,0x9cf59d15,
-0xc6199d15,0x9cd4ad77,0xa5159cd4,0xd6bcad77,0xbdd8c63a,0xce5aad77,0xb597b5b7,0xad56b5b8,0xd6bbce5a,0xa515a535,0x94b39cf4,0xa51594b3,0xa515ad56,0xdefdc639,0x84118c32,0xc619a516,0x94b3ce5a,0xa51594b3,0xad76d69b,0xa515a535,0xad56ad56,0xb5b7b577,0xb597ad76,0xa515ad77,0xa515a4f5,0x9cf4ad56,0x9cd49493,0x8c5294b3,0x8c729493,0x94938c72,0x9493a535,0xb5b794b3,
-0x9493a535,0xa5149492,0xa535ad55,0x94b3ad55,0x94b3a535,0x9cf494d4,0x8c7294d4,0x94d494d4,0xad76ad77,0xad76a556,0x94b49cf5,0x949394b4,0xad569cd4,0x8c529cb3,0x94939493,0x94b39492,0x8c519cd3,0xb5979492,0xa4f4ad76,0x9cd494b3,0xc5f8a515,0x94b3ad56,0xa5159cf4,0xad77ad56,0xad56ad56,0xa5159cd4,0xa515a535,0xa535a535,0x9cf49cd3,0x949394b3,0x9cd39493,0x9cd494b3,
-0xad569cf4,0xad56ad76,0x9cd4ad56,0xad56ad35,0xad55ad55,0x9cd38c72,0xad55a4f4,0xa535ad55,0x9cd3a514,0x8c5294b3,0x8c5294b3,0xc5f9ad56,0xd67bbdb8,0x9cb4a4f5,0x9472a4f4,0xd67ab576,0xbdd8ce5a,0xbdf8ad76,0xad76bdf8,0xbdd8b597,0xdefdce7b,0xce3adedc,0xdefdce7b,0xd6bcef5e,0xd67bce3a,0xc63adedc,0xce5ab597,0xffbfffff,0xc619defc,0xdedbe73d,0xbdf8b5b7,0xb596b5b7,
-0xffdfef5e,0xce7aad56,0xa535dedc,0xe6fcc619,0xc639d69b,0xce5ac619,0xd69bce7a,0xc618ce39,0xe6fcce59,0xce7affdf,0xd67abdd8,0xb597ce7a,0xffffef5e,0xbdb7ef3d,0xad55b596,0xb596b576,0xbdd8bdb7,0xf77ece7a,0xbdd7e6fc,0xb596ce5a,0xb597ad35,0xb576b576,0xffff9cd4,0xd6bbffff,0xd69be71d,0xbdd8d6bc,0xad56bdd8,0xe71db577,0xad56a535,0xa53594b3,0xce39bdd7,0xc5f8ad76,
-0xce7adedc,0xb576bdd8,0xdefcc619,0xc639d6bb,0xf7bfce7a,0xce5adedc,0xc639ce5a,0xc619c5f8,0xb597ad76,0xa515ad56,0xb597ad56,0xad76ad76,0xb5b7a515,0xbdd8bdd8,0xce5ac5f9,0xc619d69b,0xad97b5b7,0xad76b597,0xb597ad77,0xbdd8ce7b,0xad56bdb8,0x9494a536,0x9cf58c52,0xad77ad56,0x9cd4ad57,0xad57a515,0xa536ad56,0xb597c5f9,0xad56b597,0x9cf59cd4,0x94d49cf5,0x9cf59d15,
-0xa5369493,0x9cf5a515,0xad56ad56,0xbdf9ad56,0xb597b5b8,0xbdd8d69b,0xb5b7b597,0xad76a536,0xce7aa535,0xb597c619,0xa535ad76,0x9cf59cf5,0xbdf9ad77,0xbdf9a536,0x9d15c63a,0x94939494,0xbdd8c63a,0xa5359493,0xb5b7ad56,0x9cf494b3,0xad76ad77,0xad77ad77,0xb597bdd8,0xb597b597,0xa5159cd4,0xa535a536,0x8c5294b3,0xa5159cd4,0x8c528c72,0x8c7294b3,0x94b39493,0x9cd48c72,
-0xa515ad56,0x9cf4a514,0xad559d14,0xa535a514,0xa53594d3,0x9cf494b3,0x9cd49493,0x9cd49cf4,0xad569cf4,0x9d15a535,0x9cf49cf5,0x9cf49cd4,0x94b39cd4,0x8c529472,0x8c728c52,0x8c728c72,0x8c519cd4,0xa4f48431,0xa4f4a4f4,0x9cd49cd3,0xad3594b3,0xa535c639,0xa5159cd4,0xbdb8a515,0xb597ce3a,0x9cd4a515,0xa53594b3,0xad56ad76,0x9cd4a535,0x949394b3,0x94939472,0x94b394b3,
-0xa515c5f8,0x94b3a4f4,0x9cd4a4f4,0xa51594b3,0xad76a515,0xa514a515,0xbdd7ad55,0xbdb7b576,0x94929cf4,0xa515ad56,0x9cd49cf4,0xb5978c52,0xbdd8bdb8,0xbdb8f75e,0xb576ad56,0xc5f8b596,0xdedcc5f8,0xa515c619,0xd69bbdd8,0xad56bdf9,0xd69cc61a,0xef3ee6fd,0xd6bbc63a,0xdedcc619,0xd67bdedc,0xdedcdefc,0xbdf8c619,0xf7bfce5a,0xdedcef3d,0xf7bfc639,0xb597dedc,0xc5f8ce7a,
-0xe71db5b7,0xb5b7f77e,0xc639c639,0xd6bbad35,0xe73de6fc,0xdedcef3d,0xdedcd6bb,0xce7ad69b,0xef7ec639,0xbdd7ffdf,0xc618ce39,0xef7ebdd8,0xef5effff,0xc619ad76,0xbdb7b5b7,0xad55b596,0xc618bdb7,0xce59ce39,0xe71ddebb,0xce39ef5e,0xb576b596,0xb576a4f4,0xef5ebdd7,0xc639f7bf,0xd69bbdd8,0xa536ad36,0xc639ce3a,0xd69bce3a,0x8c52ad76,0x9cf49cf4,0xa535ad56,0xad55b596,
-0xc639bdf8,0xb576bdd8,0xd67ab5b7,0xbdd8ce39,0xef5ece5a,0xce7aef5e,0xce7abdb7,0xc619ce5a,0x9cf4b597,0xad76ad76,0xa535a515,0xad76b5b7,0xb5b7a4f4,0xc619c619,0xce5ace5a,0xb597bdd8,0xad56b597,0xbdd8bdf9,0xbdd8bdf9,0xd69bc619,0xad77b597,0xa515ad77,0x9cd49493,0xb577b577,0xc619bdb8,0xad36ad36,0xa515bdd8,0xbdd8b597,0x9cd494b4,0x9cd49cd4,0x9cf59494,0x94b4ad36,
-0xa53594b4,0xbdd8a536,0xb597b5b8,0xa5369cf5,0xb5b8ad56,0xce7bc619,0xad56a515,0xb597b597,0xad76ad76,0xce5ad69b,0xbdd8bdd8,0xad76ad56,0xb597a536,0x94b4a515,0xc65ab597,0x84118c93,0xbdd88c72,0x94b3bdf8,0xbdd8b576,0x94b3b5b7,0xad76a535,0xad36b577,0xad77ad76,0xad77b597,0x9473a4f5,0xad569cd4,0x9cf4ad56,0xa51594b3,0x8c5294b3,0x9cd38c31,0x94939cf4,0x9cd494b3,
-0xb597a515,0x94d39cf4,0x9cd394b3,0xa535a535,0x94939d14,0x94b3a535,0xa555a515,0x94d4a536,0x9cf48c52,0xa535a535,0x9cd49cd4,0x94b39cd4,0x9cd4a4f4,0x947294b3,0x94939493,0x8c728431,0x94b394b3,0x94938c72,0xad3594b3,0x9cb3a515,0x94b394b3,0xbdd89cd4,0x8c72a515,0xad369cd4,0xc63ac63a,0x94b3c619,0xa5359cf4,0xad55ad76,0x9cf4a515,0x94b39cf4,0x94938c72,0x843194b3,
-0xbdf8ce7a,0x94b39cd4,0xa4f4a4f4,0x9cd49cd4,0x94b394b3,0xad559cd4,0xa535ad76,0xa514ad56,0xad35a535,0xad769493,0x9cf4a4f4,0x8c529cb4,0xbdd8ad56,0xffbfce5a,0xb577ce5a,0xad56ce39,0xc619b597,0xce5adedc,0xc639b597,0xbdd8d69b,0xc61aad77,0xdedcce5b,0xb597ffff,0xd69bd6bb,0xef7eef5e,0xdedcd6bb,0xce7be73e,0xc639ad76,0xef7ef77e,0xd69bce7a,0xe6fcef7e,0xce5abdf8,
-0xad76ad76,0xfffff79f,0xd67ace5a,0xb597b5b7,0xf79fdebb,0xd6bbf7bf,0xdefcdedc,0xd69bdefc,0xffdfbdd7,0xc618f7bf,0xad55c5f8,0xffffe71c,0xb596e71d,0xad76ad55,0xbdd7b596,0xbdf8ce7a,0xbdf8b597,0xb5b7bdd8,0xdebbc639,0xbdd8dedb,0xbdb7c5f8,0xad35b576,0xc5f8ef3d,0xd69bbdd8,0xad56bdb8,0xad77d67b,0xd67ba4f5,0xc5f9d6bb,0xbdd8b5b7,0xa535b596,0x9cf49cf4,0xc618b596,
-0xc639b5b7,0xb597c639,0xb597a535,0xc639bdf8,0xdedcd69b,0xd69bd6bb,0xd6bbce5a,0xbdd8c639,0xb597c619,0xb597b5b7,0xbdd8c5f8,0xbdd8bdd8,0xb576ad56,0xce5ab597,0xce5adefd,0xad56b597,0xc619bdf9,0xbdf8bdd8,0xc619c619,0xb5b7bdd8,0xad56bdb8,0xad56bdd8,0x9cd494b4,0xa5159cd4,0xdeddb5b8,0x9cd4ad56,0xa536ad77,0xad56a516,0x9cd4a515,0x94b49cf5,0xa4f59473,0xa515a536,
-0x9cf49cf5,0xa515a515,0xa536ad77,0xad569cf5,0x9cf5a536,0xad77b597,0xad76bdd8,0xbdd8bdd8,0xa515ad56,0xc6399cf4,0xbdd8dedc,0x94b3a515,0x8c529cd4,0x94b48c73,0xb5b89cd4,0x8c93a516,0x94b38c52,0xbdf8b597,0xb5b7a535,0xa535b576,0xa5159cd4,0xb577ad76,0xad76a535,0x9cd4ad56,0x9cd4ad36,0x94739cf4,0xad569cb3,0x8c729cd4,0x94b3a4f4,0x94939493,0x9cf4a515,0x9cf494b3,
-0xa515a515,0x9cd39cf4,0x94b38c72,0x9d149cf4,0x9cd49cf4,0x9cf494b3,0xad7694b3,0xa535ad76,0x9cf49cf4,0xa535a515,0x9cf49cf4,0x8c729cd4,0x94b39493,0x8c7294b3,0x94939493,0x8c728c52,0x9cd39492,0x94929cb3,0xa5149492,0x9493a514,0x8c529cd4,0x94938411,0x9493ad76,0x94938c32,0xb5b79cd4,0xa515ce5a,0xa514ad76,0xad76ad35,0xa515ad76,0x9492a4f4,0x94728c52,0x8c519cb3,
-0xdebbb576,0x9493b5b7,0xa5359cf4,0x9cf49cf4,0x9cd49492,0xa5149cd3,0xad55c618,0x9cf49492,0xa535b597,0x9cd49cf4,0xa51594b3,0x94939cf5,0xb5979cd4,0xce5ac5f9,0xd67ae6fc,0xbdb8b576,0xce5ad67b,0xf79fd6bb,0xbdb7ce7a,0xce3ace5a,0xb5b8b597,0xd69bbdd8,0xf79fffdf,0xc639d69b,0xffdfce7a,0xc5f9e73e,0xef3eef3e,0xbdf8c639,0xf79fc5f8,0xce7ae71c,0xf79fd69b,0xbdd8debb,
-0xb596ce39,0xffdfbdd8,0xdefcffff,0xc5f8dedc,0xef5ec618,0xe73dffbf,0xc619ce7a,0xe6fcd69b,0xffffce59,0xd6bbce59,0xf79fce7a,0xc618ffff,0xdebbbdd8,0xad55c639,0xad35a535,0xce5abdd7,0xad76b597,0xd6bbce5a,0xc5f8ce5a,0xc5f8bdf8,0xb5b7bdd8,0xe71dce5a,0xad56c619,0xbdf8b597,0xad56bdd8,0xdedcbdf9,0xa535ad36,0xdedcc5f9,0xc619bdd8,0xad56d67a,0xa535b5b7,0xce7aad55,
-0xce39ce5a,0xbdb7c639,0xad56b597,0xad56ad56,0xd69be71d,0xdebbe6fc,0xdefce73d,0xb597defc,0xd67ad69b,0xad56b597,0xce7abdd8,0xb5b7bdd8,0xb597c619,0xce5ac619,0xbdd8c639,0xa4f5a515,0xbdd8a515,0xa515ad56,0xb597bdd8,0xad56a535,0xb577ad76,0xb577b5b8,0x8c529493,0x94b394b3,0xce5aa515,0x9494a515,0xa536a516,0xa5159cf5,0xb597a515,0x9cf5a536,0x9cf5a515,0xad77a515,
-0x9cf59cf5,0x94938c73,0xa5369cd4,0xad569cd4,0x9cf5ad56,0xa515a515,0xbdf9ad77,0xad76b597,0x9cd4ad76,0xad76a515,0xd69bc619,0x9cf5b597,0x84119493,0x94938c52,0x8c739cd4,0xad569cf5,0x94b39cd4,0xc6199493,0xa515bdf8,0xad76ad35,0xad36b597,0xad36a515,0xad77a535,0xa536ad77,0xa5359cd4,0x8c729cf4,0x94938c52,0x9cf49cf4,0xa5358c72,0x94929cd3,0xad569492,0x9cd39cf4,
-0x94b3a515,0xa5159cf4,0x9cd4a535,0x9cd39cd3,0xad559cd3,0x9cf4ad76,0x9d149d14,0x9d159d15,0xa535a515,0xa5159cf4,0xa535a535,0x94b39cd4,0x949394b3,0x9cd494b3,0x8c528c72,0x949394b3,0x94729492,0x94939492,0x8c728c52,0x94b39493,0x8c729492,0x83f08c51,0xad768c52,0x8c729cd4,0x94938431,0xb5b7ad56,0x9cf4ad56,0xa5149cd3,0xa515b576,0x94b39cf4,0x8c5294b3,0x8c728c52,
-0xdedcb5b7,0x94b3d67a,0x9cb39493,0xb597a515,0x9cf4ad55,0xad35a515,0xbdf8bdb7,0x9cf49cf4,0xa4f49cf4,0xa4f4ad76,0x9cf49cd4,0xa5159cd4,0xa5159cd4,0xce3ace3a,0xf79fce3a,0xad76ce5a,0xce5adebc,0xc639c639,0xd69bef7e,0xc619ad36,0xbdd8ce7b,0xce5ab5b8,0xffffef5e,0xb597ffdf,0xce5ac5f8,0xdebcf77f,0xdedcc619,0xd6bbdedc,0xd69bc619,0xdedbffff,0xbdf8bdf8,0xce7ae71d,
-0xd6bbc618,0xd69abdd8,0xffffffff,0xc618ef5d,0xce7abdd7,0xffffe71d,0xd6bbf79f,0xc619bdf8,0xffffef3d,0xce7ab596,0xf7bfffff,0xce39bdf8,0xc618bdd8,0xad76bdf8,0xc5f8ad35,0xbdd7b596,0xb5b7ce39,0xc619bdf8,0xb5b7c5f8,0xc639ad76,0xc619ce7a,0xd69bce7a,0xb597ad56,0xbdf8bdd8,0xbdd88c72,0xad779cf4,0xad36d69b,0xbdb8bdd8,0xc5f8ce7a,0xce7ace7a,0xad56c618,0xc639a535,
-0xd6bbdedb,0xbdd8ce7a,0xb576b5b7,0xb597b576,0xe73dc639,0xe71de71d,0xf77ee73d,0xc619debb,0xbdf8c619,0xce39ce5a,0xc619b597,0xbdb7ce5a,0xc619b597,0xbdf8bdf8,0xa535b577,0xa515ad76,0xa5158c73,0x8c73a515,0xb5b7a515,0x9cd4a515,0xad56a535,0xb597bdf8,0xa515a515,0xa515a515,0xc619a536,0xad56ad57,0xad77c619,0xb597a516,0xad779cd4,0xa515b597,0xa515a515,0xa5159cd4,
-0xb597ad56,0x9cf5ad77,0xa536a536,0xa536a515,0xa536ad56,0xad56a515,0xad77a536,0xbdd8c639,0xa515ad76,0xad76ad56,0xdefcb5b7,0xad76defc,0x8c529493,0x7bf19493,0x8c528c73,0xa5358432,0x94b3b5b7,0x9cd49cf4,0xce39d67a,0xad76ad76,0xa4f5a515,0x9cf4a4f5,0xad56ad56,0xa515ad56,0x9cd4a515,0x9cf494b3,0x94939cd4,0xad569cd3,0x8c929492,0x94d394b3,0x9492a555,0xa514a555,
-0x9cd49cd4,0xa5359493,0x9d14b5b7,0x94b39cf4,0x9cf494b3,0xad76b597,0xa535a556,0x9cf494d4,0x9cf494b3,0x9cf49cf4,0xad76a515,0x9cf4a535,0x9cd49cd4,0x9cb394b3,0x84118c52,0x94938c72,0x94729493,0x9cd394b3,0x8c729472,0x94b394b3,0x8c518c72,0x8c729472,0x94b38c52,0x9cd4b576,0x8c728c72,0xad5694b3,0xad35b597,0x949294b3,0xa514a514,0x9cd39cf4,0x8c729cd4,0x84118410,
-0xc619b5b7,0xa535b5b7,0x94729cf4,0xad76ad76,0xb5b7ad56,0x9cf4a515,0xad35a535,0x9cf4ad35,0x9cb49cd4,0xad35a515,0x9cd4a4f5,0x9cd49cd4,0xad569cb4,0xd69bbdb8,0xd6bbdedc,0xce39f7bf,0xf7bfce7a,0xce39ce5a,0xe71dce5a,0xad36ce3a,0xd69bbdd8,0xc619e71d,0xe73dc63a,0xffffdefc,0xc619ce5a,0xef5ed69b,0xce3ad69b,0xdefcce7a,0xb597c639,0xf79fe71d,0xce5adedb,0xdebbc639,
-0xbdf8ce7a,0xce59d6bb,0xffdfe73d,0xef5dffff,0xbdf8ce39,0xe73dce5a,0xef5eef5e,0xc618ce5a,0xffdfffff,0xfffff79e,0xfffff79f,0xc639c639,0xbdf8bdd8,0xc619bdd8,0xb597b5b7,0xb597ad76,0xdedcd69b,0xad56b5b7,0xad76bdb7,0xad56ad56,0xbdd8bdf8,0x9cf4ad56,0xad35ad56,0x9cb3bdf8,0x9cd494b3,0xa515ad76,0xce7abdd8,0xad56a535,0xe71dce39,0xef5ed69b,0xd69bf7bf,0xad76ad76,
-0xdedbbdf8,0xc639e71d,0xc5f8bdd8,0xbdd8c619,0xd69bc5f8,0xef5edefc,0xce5ae73d,0xce39e71d,0xc619ce5a,0xef3de73d,0xb576ce5a,0xbdd8bdd8,0xbdf8bdf8,0xa535b5b7,0xad36a536,0xa515a515,0x94b49cf5,0xb5b8a515,0x8c739493,0xa515ad36,0xad56a4f5,0xad76ad36,0xad76ad76,0xad56b5b7,0xb5b8b577,0xbdf8ad77,0xbdb8c63a,0xb577b5b8,0xad56bdd8,0xa536b597,0x9cf59cd4,0x9cf59cd4,
-0xad77a515,0xa515ad77,0x9cf58c73,0xa5159cd4,0xa5159cf5,0xa515ad56,0xad56ad56,0xce7abdd8,0xb5b7ad56,0xa515a535,0xa535a535,0xce5ac619,0x8c73ad56,0x84318431,0x94739493,0x94738c52,0xb597b597,0x9cd49cd4,0xef5e9cd4,0x9cd4ce5a,0xa536a4f5,0xa4f5ad36,0xa536a535,0xad77ad76,0xa535b597,0x949394b3,0x9cd494b3,0x9cf494b3,0x8c52a514,0xa5558c51,0x9cf4ad55,0xad769492,
-0x94b39cf4,0x9cd494b3,0xad76a535,0x94d39cf4,0x94928c92,0xad569493,0x9cf4a535,0xad56ad76,0x9cf4ad56,0x9cd39cd3,0xad569cd3,0xa515ad56,0xa5159cd4,0x9cd49cf4,0x8c739cb4,0x9cd48c73,0x94b394b3,0xa514a515,0x94b39492,0x94929cf4,0x8c528c72,0x94b38431,0x94939cd4,0xad568c72,0x94b39cd4,0x9cb39cd4,0xbdd7b5b7,0x9cd3ad55,0xa5349cf3,0x9cb39cf4,0x949294b3,0x84118431,
-0xad56b5b7,0xbdb7a535,0xc619c619,0xbdd8bdf8,0xce59b597,0xa4f4c639,0x9cd49cd4,0xb597ad56,0x94b3ad36,0xad56a515,0x9cb4a4f5,0x9493a4f5,0xad569cb4,0xb577bdd8,0xce5ac619,0xffffc639,0xd69be71d,0xbdd8e71d,0xd67ac5f8,0xdebcffbf,0xce7bbdf9,0xce5ae73e,0xce7ac619,0xe73ddf1c,0xce5ae71d,0xd69bce7b,0xef3eef7f,0xce7ace5a,0xd69bd6bb,0xce7abdd8,0xc639f79f,0xce39d67a,
-0xce59ce5a,0xd69abdf8,0xef5dce59,0xffffffff,0xbdf8ce59,0xc618d69b,0xef5ed69b,0xc618dedc,0xffffffdf,0xffffffff,0xb5b7ffff,0xe73dffdf,0xc639ce5a,0xce39d67a,0xb597c639,0xb5b7bdd8,0xdedcad56,0xad76defc,0xc619a535,0x94b3b597,0xb597ad56,0x9cb3ad56,0x9cb3a515,0x9cd48c72,0xbdd89cd4,0xc5f8bdd8,0xb5b7ad56,0xb597dedc,0xce39c619,0xbdd8ce39,0xffffffdf,0xbdb7b576,
-0xd6bbc5f8,0xef5eef3d,0xd6bbdedc,0xc639c639,0xb5b7d69b,0xffdfce7a,0xd69bdedc,0xef7edefc,0xb5b7ce7a,0xd69bbdf8,0xb597ce5a,0xb597ad56,0xad76dedc,0x9cf4a515,0xa515a4f5,0xa5369cd4,0x9493a536,0xa53694b4,0xa536ad56,0xb577a536,0xa536a536,0x9cb49cb4,0x9cd49cd4,0xad35ad35,0xad569cf5,0xb5779cd4,0xbdf9bdb8,0xa4f5bdb8,0xbdb8bdd8,0xad77ad56,0x94939cf5,0xa536a515,
-0xa536a515,0xa536b597,0xa53694b4,0xa515a536,0x94b49cf5,0xa535a536,0xa5159cd4,0xad76a515,0xb597d6bb,0xa515a535,0xa515bdd8,0xbdd894b3,0x94b3c619,0x8c529cb4,0x8c528c72,0x9cd4ad36,0xad768c72,0x9cd4ad76,0xa515a4f4,0xb5b7bdf8,0xa4f5a536,0xad56a515,0xa5159cf5,0xad76ad56,0xad56a515,0x8c528c72,0x84118c52,0x94b394b3,0x9cd394b3,0x8c518c52,0xa535ad96,0x9cf4a515,
-0xa535ad76,0x9cd494b3,0xad5694b3,0x94d3b596,0x9cd494b3,0x9cd49cd4,0xa515a515,0xad76a535,0xa535a535,0x9cf4a535,0x94929493,0xa5159493,0x9cf49cf4,0x9cf4a536,0x94939493,0x8c728c72,0x94b39cb3,0xa4f4a535,0x8c728c52,0x8c729cb3,0x8c318431,0x94928c72,0x94b394b3,0x94b394b3,0x9cd4a535,0x9cd4a514,0xbdf8a514,0xa535b596,0xa5149cf3,0xa535a514,0x94b39cf4,0x8c318c51,
-0xad35b576,0xad36a4f4,0xc619bdd8,0xb597c5f8,0xbdd8a515,0xa4f4bdb7,0xa4f49493,0xc619ad56,0xa515c619,0xa5159cd4,0x9cd4a515,0xad779cd4,0x94739493,0xb5b8b597,0xbdd8ad77,0xe71dce5a,0xd67bffff,0xdefcc5f8,0xbdf8ce39,0xffffdefd,0xbdd8d6bc,0xd69bbdd8,0xad76b597,0xdedbce7a,0xef7fce7a,0xc5f9d67b,0xe6fdce7b,0xd69bffbf,0xe73dce5a,0xc5f8dedc,0xe73dd69b,0xce7ace7a,
-0xd6bbc619,0xce7adebb,0xd69bdefc,0xffdfce59,0xc619ffff,0xd6bbbdb7,0xdefcce5a,0xe73de73d,0xf7bfffff,0xe73ddefc,0xb5b7d69a,0xf77ece5a,0xd69bd6bb,0xbdd8ce5a,0xce39c639,0xb597c619,0xc619b5b7,0xdefcd69b,0xb576ce5a,0xa535a515,0xad35ad56,0xbdb7ad35,0xad56ad76,0x9cf4ad76,0xa53594b3,0xc5f8ad76,0xb597b5b7,0xe73dd6bb,0xb5b7ad35,0xc619b5b7,0xffffef5e,0xbdf8f79f,
-0xd6bbc619,0xe71dd69b,0xce5aef7e,0xffffe71d,0xce5ad67a,0xe71dc639,0xe73def3d,0xd69be6fc,0xbdd8bdf8,0xc639bdd8,0xad76c639,0xa515b5b7,0xb597a535,0x9cf49cf4,0x9cf49cd4,0x9cd4a515,0x9cd4a515,0x9cf59493,0xa536a515,0xad56a536,0xa4f5b577,0xa515a4f4,0xad569cb3,0xa515ad76,0x94b494b4,0x9cd49cd4,0xa5369cd4,0xad56ad56,0xad36ad56,0xa4f5a535,0x9cf5a515,0xa4f594b4,
-0xad569cf5,0xad77ad77,0xa536a515,0x94b49cf5,0x9cf594b3,0x8c529cb4,0xbdd8ad56,0xad56bdf8,0xb5b7b5b8,0xa5359cf5,0x9cf4a515,0x8c529cd4,0xc619a536,0x9cd4ad56,0x8c529493,0x94b39473,0x94b39cd4,0xa51594b3,0x9472a4f4,0xbdb78c72,0x9cd4c5f9,0xa4f594b3,0xa515ad56,0x94b4a536,0x8c7294b4,0x94939493,0x94939493,0x8c7294d3,0x8c728c72,0x84319493,0xa5359492,0xa535ad55,
-0xb5b7a515,0x9493a535,0x949394b3,0xa535a535,0x94929492,0x9cd39cf4,0xad769cd4,0xb597a535,0xad76b5b7,0xad55ad76,0x9cf4a515,0x8c529472,0x94b394b3,0x9cd494b4,0x94939493,0x94939cb4,0x9cd48c52,0x9cd3a535,0x8c318c72,0x84319472,0x84108431,0x9cf48c72,0xa515a515,0xa4f4a515,0xad769cd4,0x94939cf4,0xa5149cd3,0xad56b596,0x9cf49cd3,0x9cf49cd4,0x8c529cd3,0x8c728c52,
-0xa515b576,0x9cd49cd4,0x9cf4a515,0xa5159cd4,0x9cb3a4f4,0x9cd39cb3,0x9cd48c52,0xa4f4a515,0xb597ce5a,0x9473a535,0xb5b794b3,0x9cd4a535,0x9cb4bdb8,0xbdd8ad56,0xb597b5b7,0xdedcb5b8,0xffffef5e,0xbdd8d69b,0xad76c619,0xce5ac619,0xce7bffff,0xd6bcbdd8,0xc619c619,0xc619bdf8,0xef3ee71d,0xb597d6bb,0xce5ac63a,0xdebbef3d,0xd67adedc,0xce7af79f,0xc619c619,0xd69bf7bf,
-0xc639bdf8,0xd67ae71c,0xdedcce59,0xc5f8c5f8,0xffdfe71c,0xce39bdd7,0xc619d6bb,0xffffc619,0xbdd7ffdf,0xdefcffdf,0xdebbdebb,0xce5abdf8,0xe71df7bf,0xc619bdd8,0xbdf8bdf8,0xb597c619,0xce5abdb7,0xdedcd69b,0xa4f4ce7a,0xb5b7a515,0xad76bdd8,0xad769cf4,0xbdd8bdf8,0xce5aad56,0xa4f4b597,0xbdd8ce5a,0xe6fcbdd8,0xe71dce7a,0xb597ffdf,0xef5ece7a,0xe73dffdf,0xef5ef79f,
-0xce5abdd8,0xd6bbd6bb,0xf79eef5e,0xffdfffff,0xce39c619,0xce5adefc,0xf7bfdefc,0xce5adefc,0xbdf8c619,0xb5b7bdd8,0xb597c619,0xad56bdb7,0xa535a535,0x9cd4b597,0xbdb89cb4,0xa4f5a515,0xa4f594b4,0x94b4a536,0x94739cd4,0x8c73a515,0xb5979cf4,0x8c72a535,0x9cf48c72,0x9cb39cd4,0xb577ad56,0x94b39cd4,0x9cf59cb4,0xb5b8b5b8,0x9cf4bdb8,0xbdd8b597,0x9cf5a516,0xa5159cd5,
-0x94b4ad56,0xad77ad56,0xad56bdd8,0x9cd4a515,0x9cd4ad56,0x9cf49cd4,0xb5769cf4,0xad76ad76,0xa536a515,0x9cd4bdf8,0x94b39cd4,0x94b394b4,0xb5978c52,0x9cd4dedc,0x94b39473,0x9cb49473,0x94b39cd4,0xb5b79cd4,0x9493a535,0x94b39cd4,0xad56bdd8,0x9cf494b3,0xbdd8a515,0x9493a515,0x8c5294b4,0xa5358c72,0xb597b597,0x94b3a555,0x8c728c92,0x94d38431,0x84318c92,0xa555a535,
-0x9cf4a535,0x94b3a535,0x94b38c72,0x9d148c51,0x9492a514,0x9cf4a514,0xa5359cf4,0xad76ad76,0xad56a535,0xa535a515,0xa515a535,0x8c72a515,0x9cf48c52,0x7bf08c72,0x9cd49473,0x9cf49cd4,0x8c729cd4,0xa5359cf4,0x94b39cf4,0x94928c72,0x8c319493,0xa51594b3,0xa5159cf4,0xa515ad56,0x9cd4a4f4,0xad56b5b7,0x9cd39cf4,0xbdf8a515,0x9cf4ad76,0x9cd39cf4,0x9cf49cd3,0x8c528c72,
-0xa515ce5a,0x9cf4a4f4,0x9cd49cd4,0xad56a515,0x9cf4ad35,0xad359cd4,0xb597ad35,0xa535ad55,0xce3a9cd4,0xad56c619,0xb5769cb4,0xa515a515,0xb597ad36,0xad36a515,0xc619bdf8,0xc63ace5a,0xf77fe71d,0xbdb7debb,0xce39ad35,0xd69bbdd8,0xffdfe71d,0xbdf9dedc,0xdefcc639,0xc618ce7a,0xd67bbdd8,0xef5eef3e,0xc63ace5a,0xffffce5a,0xd69bef5e,0xf79fdebb,0xc619d6bb,0xef5ec619,
-0xc619dedc,0xf7bfdedc,0xd6bbdedc,0xce7aef3d,0xef5dbdf8,0xbdd7d69b,0xf79ed69b,0xffffc618,0xd69bffdf,0xc639d69a,0xef3dd6bb,0xce7aef7e,0xffdfe6fd,0xbdf9dedc,0xb597b597,0xb597a515,0xa515a535,0xc619ad56,0xce7abdd8,0xb597a535,0xb576b5b7,0xa535a515,0xb597b576,0xc619c5f8,0xad35ad56,0xce5abdd8,0xc639b597,0xce5adefc,0xffffef3d,0xffffce5a,0xdedce71c,0xef7ee73d,
-0xd6bbe73d,0xdedbc639,0xffdfef3d,0xce5affff,0xd69bc619,0xd6bbce5a,0xdedce71d,0xce39d6bb,0xb5b7ce7a,0xbdd8b5b7,0xc639bdb7,0xbdd8d67a,0x9cf4a515,0xad56a4f4,0x9cb49cb4,0xa515ad36,0xa515a535,0xa4f5a4f5,0x8c728c73,0x94939493,0x94b39cf4,0x7bb09493,0xa5159cf4,0xa5159493,0xb597ad56,0x9cd4ad56,0x9cd49493,0xc619ad77,0xbdf8b597,0xc63aad77,0xa515ce3a,0xad36a515,
-0xa536a536,0xad77ad77,0xb597a515,0xb5b89cd4,0x9493ad56,0x9cd48c72,0xad769cf4,0xa515ad56,0x9cf49cf4,0xb597a515,0x9cf49cd4,0x8c739cd4,0x8c729cd4,0xffdfc639,0x9493ad76,0x9cd49cf4,0x9cf494b3,0x94b39cf4,0xa535a4f4,0x94b39493,0xbdd89cd4,0xa515ad76,0xa5369cf5,0x94b4b5b7,0x9cd49cf4,0x94b394b4,0xa535b597,0x94939cd4,0x8c518c92,0x94928411,0x84118c52,0x9cf48c72,
-0xad77b5b8,0xa5358c52,0x9493a535,0x9d149cd4,0xa5359d14,0xa514ad76,0xa515a515,0xad56b597,0xa515ad35,0xad35ad56,0xa535a535,0x949394b3,0xa4f48c72,0x94939cf4,0x73af8411,0x83f073af,0x949394b3,0x9cf48431,0xa4f4ad76,0x8c319493,0x9cd394b3,0x9cd49cb3,0xa4f4a515,0xa5359cd4,0x9cd49cd4,0xce5aa515,0x9cf4b5b7,0xb576ad55,0xb5b7bdd7,0x94939cf4,0x94929492,0x8c3194b3,
-0xce5abdb7,0xb597bdb7,0xb597b597,0xad56b597,0xbdd8bdd8,0x9cd3a4f4,0xc5f8ad35,0xad35ad76,0xb597bdb8,0xe71de71d,0xbdb8c619,0xbdf8ce5a,0xbdd8ad56,0xbdb8c619,0xc63aad77,0xbdf8d69b,0xce5ace7b,0xd67ace5a,0xb597b5b7,0xbdf9ce3a,0xce7bce5a,0xce5adefd,0xbdf98c73,0xc619defc,0xc5f9bdf8,0xd69bc619,0xce7aef3e,0xce5ad69b,0xef7ef7bf,0xce5ad6bb,0xd6bbffff,0xce5abdf8,
-0xdefcffdf,0xdedcce7a,0xd69bef7e,0xe71dce7a,0xd69ad6bb,0xd69ae71d,0xffffb5b7,0xffffce59,0xf79ef79e,0xc619ce5a,0xe6fcce39,0xe73df79f,0xdebcc619,0xc619f79f,0xad76bdd8,0xa515b597,0xa4f4a515,0xa5159cd4,0xc619c639,0xbdb7d69b,0xa515ad35,0xa535a535,0xb5b7b597,0xad35ce39,0xa5159472,0xbdd8a515,0xbdd8bdf8,0xdedcce7a,0xd6bbc639,0xce7affff,0xe73de73d,0xef5df79e,
-0xe71cffdf,0xd6bbc619,0xdefcd6bb,0xd6bbe71c,0xd6bbe71d,0xce7ad69b,0xce7adedc,0xce5ad69b,0xbdf8ce39,0xc619b597,0xb597b597,0xc619bdf8,0xb597bdf8,0xad7694b3,0x9cb4b597,0xad76a4f5,0xad36a536,0x94b39473,0x7bd08411,0x9cd49493,0x94b494b4,0x9cf49473,0xa5159cd4,0x9cd4ad56,0xa5369cf4,0x9cf4ad56,0x9cd49cd4,0xad769cf5,0xb597bdb8,0xbdd8c619,0xc5f9bdd8,0xad56a535,
-0xa536ad56,0xad77ad56,0x9cd4b597,0xa536a536,0x9493ad76,0x8c529472,0xbdd8a515,0x9cd3a535,0x94b49cf4,0xad568c73,0xa515bdf8,0x9cd49493,0xad569cd4,0xd69b94b3,0xb597ffff,0xa515ad56,0x9cd494b3,0x94b39cd4,0x9cd48c72,0x9cd4ad35,0xad569493,0xa4f5ad36,0x9cf49cf5,0xb5979cd4,0x94b49cd4,0x9cf49493,0xa5159cf4,0x94b39cd4,0x8c728c72,0x8c528c92,0x9cd48c72,0x94b38c52,
-0xad76ad77,0x9cf4a515,0x9cf4b597,0xad76a514,0xb596ad76,0xa535bdd7,0xa5159cd4,0xad76a535,0xad76ad56,0xbdd8b597,0xa4f4b576,0x8c5294b3,0x94b394b3,0xad35a515,0x94939cd4,0x7bd08c72,0x8c51736e,0x94939492,0xad569cf4,0x8c529cb3,0x94b39492,0x9cf49cd4,0x94b39cd4,0x9cf59cd4,0xad56a515,0xad569cf4,0xbdf8ce39,0xad55b596,0xc619ad76,0x94b3bdd7,0x94929492,0x94728431,
-0xbdd8ad56,0xc5f9c5f9,0xb576b597,0xa515a4f5,0xbdd8ad56,0xad35bdd8,0xad5694b3,0xb597b596,0xb577b5b7,0xd67bad56,0xce3ae6fd,0xad76b5b7,0xb5b7c639,0xb597bdb7,0xad56a535,0xc5f9bdd8,0xc619b597,0xc619ce5a,0xce7aef3d,0xdebcbdb8,0xbdf9bdd8,0xffffdefd,0x9cf5c63a,0xd6bbdefc,0xbdf8b5b7,0xdedcc619,0xdedcdefd,0xd6bcd69b,0xffdfd6bb,0xe71dffff,0xdefcc619,0xd69bce5a,
-0xffffe71d,0xce5adefd,0xef7ededc,0xc619ce7a,0xbdf8d6bb,0xdefcce9a,0xbdf8ce9a,0xffffdefc,0xdedcce5a,0xd6bbd69b,0xc619c619,0xe71de73d,0xa536ce5a,0xe71dad56,0xad76ce5a,0xa535a535,0xad56ad35,0xad35b597,0xad56ad76,0xf7bfc619,0xc619b5b7,0xa4f4b5b7,0xc619bdd8,0xc639bdf8,0xbdd7b597,0xbdd7bdd7,0xce7ace39,0xd69bbdf8,0xd67aef7e,0xffffdefc,0xe73dd69b,0xdedbdefc,
-0xf79fef7e,0xbdd8defc,0xce7ace59,0xef5dbdd8,0xd69bef5e,0xce39c639,0xd69bbdf8,0xce7ac639,0xc5f8d69b,0xbdf8ad76,0xad56b597,0xb597b5b7,0xad35c619,0x94b3ad35,0xce7bad76,0x9cd4ad56,0x9cd4a535,0x9cb38c72,0x8c7294b3,0x9cb48c32,0xa4f59cd4,0x94b39493,0x9cd4a536,0xad77ad36,0xad569cf4,0xa535a515,0x9493a515,0x94b39493,0xb597a515,0xb597c5f9,0xad56a515,0xad56b5b7,
-0xad77ad56,0xa536a536,0xad77a536,0xa515a515,0xb577b577,0x9cd49cf4,0xa535a4f4,0x9cd4ad56,0x94b39493,0x8c7394b3,0xce3aa4f5,0xad36a4f5,0xad76ad76,0x8c729cd4,0xef7ece5a,0x9cf4ad56,0xa535a515,0x8c5294b3,0x8c318c72,0xad7694b3,0x94b39493,0xa5159cf4,0x9cf4a515,0x94939493,0x94939cf5,0x8c528c73,0x8c5294b4,0x8c528c52,0x8c728431,0x94938c52,0x94938c52,0x8c7294b3,
-0xa5369493,0x9cf49493,0xad569cd4,0x9cf49cf4,0xa535ad55,0xbdb7ad56,0xa4f4a535,0xa515ad56,0xad56a4f4,0xb597b576,0xa515ad76,0x84319cd4,0x94b39472,0xad56a4f4,0x9cd4ad35,0x9cf49cd4,0x84318c52,0x84318c52,0xa5148411,0x94b3ad35,0x9cd49472,0x9cf49cd4,0x9cb49cd4,0x9cf49cd4,0xad56a515,0xa515ad35,0xce59ad35,0xa535b596,0xad56a514,0xb597c619,0x94b39cb3,0x8c319472,
-0x9cd4d67a,0xbdf8a4f5,0xb597b597,0xad56ad56,0xad56a515,0xc619c5f8,0xad35ad76,0xc5f8b576,0xbdd8bdb8,0xbdd8bdf8,0xef5ee71d,0xad56c639,0xb597ad76,0xb597ad56,0xad77bdb8,0xbdb8b577,0xc5f9d67b,0xd69bbdf8,0xce5ac619,0xbdd8bdd8,0xad57d6bc,0xdeddce5a,0xe73ef7bf,0xdedcc63a,0xc639dedc,0xc63aad77,0xe71de73e,0xc63ad6bc,0xce5aef5e,0xffffffff,0xce7ae73d,0xc639e71d,
-0xd69bd69b,0xe73effff,0xdedcce7a,0xd69bf79f,0xc659c659,0xdedbd69a,0xbdf8defc,0xffffffff,0xbdd8ad76,0xbdf8ce7a,0xbdb8a535,0xce7abdf9,0xc619d69b,0xc619bdb8,0xce5ad6bb,0x9cf4ad76,0xad56a535,0x94b3b597,0xb5b79cf4,0xc639b597,0xdefcdefc,0xad76bdf8,0xbdd8ad56,0xce7ac619,0xd69bffff,0xbdd8bdf8,0xc619c619,0xe73dce5a,0xce7ae71d,0xce5ace7a,0xc5f8ffff,0xef5de71c,
-0xffdfe73d,0xc618f77e,0xe73de73d,0xce5ac639,0xdedcd69b,0xce5adebb,0xdebbc619,0xce5aef5e,0xce7ae73d,0xb597bdd8,0xbdf8bdb7,0xa4f4d69b,0xb5b7b5b7,0xad76b597,0xbdd8b5b8,0x9473b597,0xad569cb3,0x947294b3,0xa51594b3,0x8c529cf4,0x94b38c32,0xa4f5a515,0x9cd48c52,0x9cb48c52,0xad76a515,0xad76ad76,0x9cb3a535,0x9cb494b3,0xbdf89cd4,0xc619c619,0xa515b5b8,0xc63ab577,
-0xbdf9b597,0x9cf5ad56,0xbdd8a515,0xbdd8ce5a,0xad56a515,0xad56b597,0xa53594b3,0x9cd4a535,0x9cb49493,0x8c528c73,0xb5779493,0xb5b7d67b,0xad56b5b7,0xa515ad56,0xad768c72,0x9cf4ce5a,0x94b39cd4,0x94939cd4,0x8c529493,0xa5158c52,0x9cb4bdf8,0x9cf59493,0x9cf5a535,0x8c729cd4,0x9cd48c52,0x84328c72,0x94939493,0x8c728411,0x84118431,0x8c527bd0,0x7bf08c52,0x84318411,
-0x94b38432,0x9cf49cd4,0x843194b3,0x9cf49cf4,0x94b38c92,0xbdd7a515,0xad76bdd7,0xb576bdf8,0xad76b5b7,0xad76b597,0xb597ad76,0xa4f4a535,0x9cd49cd4,0xa5159cb3,0x94b3ad35,0x8c728c52,0x8c529472,0x94938431,0x84108431,0x94929492,0xad569cd4,0x9cd4a4f4,0x9cd4a4f5,0xa5159cd4,0xa515a4f5,0xad76ad56,0xa4f4a515,0xa514b5b7,0x9cd38c72,0xad35a514,0x94b3a535,0x84318c51,
-0xc5f9ce5a,0xad569cf4,0xce3ace39,0xb597ce5a,0xad35a514,0xc618bdd8,0xa515bdb7,0xce39ad56,0xce5abdd8,0xb576b5b7,0xdedcbdb7,0xbdf8ef3e,0xa4f5a535,0xb577bdd8,0xad56a4f5,0xb597b597,0xb5b7b5b7,0xb597ad35,0xad76ad76,0x9cd5a515,0xd6bca515,0xb5b8bdf9,0xffffdedc,0xb5b7ef5e,0xd69bd69b,0xb597ce7a,0xd69bc619,0xe71de71d,0xe71dd69b,0xffdfce7a,0xc639f7bf,0xbdd8ad76,
-0xa536a515,0xffffb597,0xbdd8e71d,0xe71dd69b,0xc639ce7a,0xbdd7defc,0xd69ab5d7,0xe71cffff,0xc619c5f8,0xad36b577,0xce3ab577,0xad76ad56,0xdebcd69b,0xb577ce7a,0xdebbbdd8,0xa515bdd8,0xad35a515,0xb5b7ad56,0xc619bdf8,0xd67ac639,0xdedcc5f8,0xb597b597,0xc639c639,0xd69bbdf8,0xffffdedc,0xbdd7d69b,0xb5b7bdf8,0xce5ad6bb,0xe73ddedc,0xc639e73d,0xffffe71d,0xffffc5f8,
-0xffffffff,0xef5effff,0xc618dedc,0xdedbd69b,0xce7ac619,0xdedcdedc,0xd69bce5a,0xdedcdedc,0xdebbd6bb,0xa4f4bdf8,0xb597ad56,0xa4f4bdf8,0xc639a535,0xdedcc619,0x94b4d69b,0xb5b7a4f5,0x9cd4a535,0x8431a515,0x8c728c52,0x94b39cb3,0x8c739473,0x9cd48c72,0x9473a4f5,0xa4f59cb4,0xa515a515,0xad56ad56,0xb5b7b597,0xa515ad56,0xbdd8ad76,0xd69bc63a,0xbdb8ce7b,0xc619bdb8,
-0xb597ce5a,0xbdf9b597,0xc619bdd8,0xc63adedc,0xa515a4f5,0xad76ad56,0xad35a535,0x9472a4f4,0x8c729cb4,0x9cd49cb4,0x94939cf5,0xce5aad56,0xc639ad76,0xad56ad76,0x8c51a535,0xb5d7a555,0x94b39cd4,0x8c728c72,0x8c728c52,0xa515a535,0xbdf9ad56,0x9cd49493,0xad76ad76,0x9493a536,0x8c528432,0x9cd49cf5,0x84329493,0x84118c72,0x84118c52,0x7bf07bd0,0x84118c72,0x7bf073af,
-0x94b38c73,0x94b48c52,0x8431a515,0x9cf494b3,0x94b394b3,0xb576b596,0xce59b597,0xc639bdf8,0xbdb8c619,0xad56ad36,0xad36ad76,0xad35ad76,0x9cd49cb3,0xad35a514,0xad35ad35,0x8c72a514,0x84119493,0x84118411,0x8c528c52,0x94938411,0xb597ad76,0xad36ad77,0x9cb49cb4,0xa515a536,0xa5159cd4,0xad56a515,0x9cf4ad55,0xb5969cf4,0x8c319cd3,0x94929493,0x9cb39493,0x8c528431,
-0xce5ab597,0x9cd4ce5a,0xc619ad56,0xbdb8c619,0xad35a4f4,0xb597bdb7,0xc639c5f8,0xc619ce39,0xd67ace39,0xad56b597,0xbdb8b597,0xe71df79f,0xa515b597,0xce39b576,0xad36bdb8,0xa515ad76,0xa5159cf4,0xad56ad76,0xbdf8ad56,0xb5b8ce5a,0xb5989cd5,0xbdd9debc,0xdebcd69b,0xe71dffff,0xce5aa536,0xbdd8ce7a,0xc63abdf9,0xdefcdefd,0xd6bcef7f,0xbdd8e71d,0xce5adedc,0x9cd4ad77,
-0xc619c639,0xa53694b4,0xb597d6bc,0xa51594b3,0x9cd4ad76,0xce59ad76,0xffdfb5b7,0xce59ffff,0xb5b79cd4,0xad56a515,0xad36b597,0xc619b577,0xd69bc619,0xb5b7d67b,0xbdd8b576,0xd67bce3a,0xce7abdd8,0xb5b7b597,0xbdd8bdd8,0xd69bc639,0xf7bfce39,0xc619f7bf,0xc5f8bdf8,0xb5b7bdd8,0xce7ab5b7,0xb597ef7e,0xc639ad76,0xdedcc619,0xc619ce39,0xe71dd67a,0xe71ddedc,0xdefcffff,
-0xbdf8ffff,0xffffc619,0xdebbffdf,0xce5ace5a,0xce5abdf8,0xd69bdefc,0xbdd8c619,0xdefcce5a,0xce7adefc,0xbdd8c5f8,0xb597ad76,0xbdf8bdf8,0xbdd8ad56,0xd69bffff,0x94b39cd4,0x949383f1,0xa4f4bdd8,0xa5359cf4,0x9cf49cf4,0x84119472,0x8c528c72,0x8c528c32,0x84118c52,0x94938c52,0xa4f49493,0xad56a515,0xb5b7b597,0xb597c5f8,0xbdb8ad76,0xbdd8bdb8,0xce5ace5a,0xa4f5bdb8,
-0xce5abdd8,0xbdf9a515,0xb597ce7b,0xbdf9bdd8,0xa515bdf8,0xad35a535,0xad35bdd8,0x94938c72,0x9cd49472,0xa5159cf4,0x9cd49cd4,0xa535a515,0xbdd8defc,0xad56b597,0x9d14a535,0xad558c72,0xa515bdf8,0x8c729cd4,0x94b38c72,0x9cd4a4f4,0xa5159473,0x9cd4c619,0x9cf49cd4,0xad76ad76,0x7bf19493,0xa53694b4,0x7bf08c52,0x8c528c72,0x84318431,0x84118431,0x8c528c72,0x73b08431,
-0x94b37bf0,0x84318411,0x94b3a535,0x9cd48c72,0xa555a535,0xce59ad76,0xc619bdd7,0xad56bdf8,0xb597bdd8,0xad56b597,0xad56ad36,0xa515ad35,0x9cd4a515,0xa5359cf4,0x9cf4a515,0x94939cd4,0x94938c52,0x84118c72,0x8c528411,0x8c5294b3,0xc619ad76,0xad56bdd8,0x94b49cd4,0xb577a536,0x94938c52,0xa515a515,0xa535ad56,0x9cf4a535,0x94b3ad56,0x949294b3,0x94728c51,0x8c729493,
-0xbdd8c639,0xdedcc619,0xb597bdb7,0xb5b7c639,0xad76b596,0xce39bdb7,0xd69bd69b,0xb5b7ce7a,0xce5ab597,0xc619bdd8,0xce5ac639,0xf7bfce3a,0xad77dedc,0xb597a515,0xa4f5b597,0xbdb7b576,0xa515a515,0xbdd8ad56,0xa515ad56,0xc5f9ad36,0x94739cf5,0xad77a536,0xd67cb578,0xffffe73e,0xc619defd,0xd6bcd69b,0xc619bdf9,0xce5abdd8,0xef3dce5a,0xbdf8ce5a,0xc639ad35,0xc5f8c639,
-0xd6bba515,0xad56b597,0xffbfbdd8,0xad56b577,0xad56ad36,0x9cd394b3,0xffffad76,0xe71dffff,0xa535e71c,0xbdf8b597,0xb597bdd8,0xce7ac5f8,0xce7abdd8,0xce7ae6fc,0xd69bffdf,0xf79fbdf8,0xc5f8d6bb,0xad76ad56,0xd69bbdf8,0xd69bdedc,0xd67bd69b,0xce7aef5e,0xb597bdf8,0xb5b8b5b8,0xc639b597,0xef7ee71d,0xce5ac639,0xce5ad69b,0xc639ce7a,0xdebbd69b,0xd69bef3d,0xffffd69b,
-0xbdd8e71c,0xce7aad76,0xef5effff,0xad56ce3a,0xce3ac5f9,0xc619c619,0xbdd8ce5a,0xd69aad35,0xef5ededc,0xc639d67a,0xb597ce7a,0xe73dbdd8,0xb597c619,0xbdf8bdf8,0x8c72b597,0x73af83f0,0xce3994b3,0x9cd4ad56,0x94729cd4,0x83f094b3,0x8c728c52,0x8c518c72,0x9cb38c52,0x84119472,0x8c729cd4,0xa53594b3,0xad56a535,0xc5f9bdf8,0xb577b5b7,0xad56ad56,0xc63abdd8,0xc619c5f9,
-0xce5aa515,0xa515ce3a,0xc619c619,0xad76b5b7,0xb577c619,0x94b39cd4,0xad569cd4,0xa535ad76,0xa51594b3,0x94939cf4,0xa5149cf4,0xa514a515,0xd69ab5b7,0xad76ad56,0xa514b596,0x94929cf4,0xb597ad76,0x94939cd4,0x94729493,0x8c528c52,0x8c529cf4,0xd6bbb597,0x9493a536,0xbdf99493,0x9cd4b5b7,0x8c739cd4,0x84329cf4,0x7bf18411,0x84118432,0x8c728431,0xa4f49cd3,0x84119492,
-0x84117bd0,0x8c529cd4,0xbdd89472,0x9492a514,0xad769492,0xc639ad56,0xad35ce5a,0xd69bbdf8,0xb597b5b7,0xb597bdd8,0xad35a535,0x94b3a535,0xa535ad56,0x9cd4a515,0x94b3a515,0xa4f49492,0x8c529cf4,0x84318431,0x8c528411,0xa5359cb3,0xbdd89cf4,0xa515bdd8,0x94938c73,0x9cd48c52,0x9cb49493,0xbdb8ad36,0xad56ad56,0x9cf4ad76,0xad569cd4,0x8c5294b3,0x8c318c52,0x9cf494b3,
-0xce5abdd8,0xef3dce5a,0xc639e71d,0xb5b7ce59,0xdedcce7a,0xbdf8ce7a,0xbdd8ad76,0xce5ac619,0xbdd9bdf9,0xd67bbdd8,0xbdf8d67b,0xb597ad56,0xd6bbef3e,0x9473a4f5,0xc5f9bdd8,0xad56b576,0x9cf4ad76,0xad359cd4,0xa515ad35,0x94939493,0xb577ad56,0x9cf59493,0x8c539cf5,0xd69cb598,0xd6bcffff,0xc619b597,0xbdf9c63a,0xb597b597,0xb597b5b7,0xad56c639,0xb597bdf8,0xce7ace5a,
-0x9cf4c639,0xbdb7ce7a,0xd69bbdd8,0xc5f9c619,0xad56a535,0xa515ad76,0xffff9cd4,0xad76dedb,0xd6bbef5d,0xc619b596,0xce7ad69b,0xbdf8c619,0xd6bbce5a,0xef5ed6bb,0xef5effff,0xd6bcce5a,0xd69bef5e,0xad56b597,0xce5ab5b7,0xd6bbdefc,0xc619bdf9,0xbdd8d6bb,0xb5b7ce7b,0xb597a515,0xe6fdd69b,0xe71dce5a,0xd6bbdefc,0xc639d69b,0xdedcc619,0xc619e73d,0xce7ace7a,0xd6bbce5a,
-0xce59ffdf,0xc639debb,0xe73ebdd8,0xc619e71d,0xd69ce73e,0xe73eb597,0xe71de71d,0xb597debb,0xef5ee71d,0xbdd8ffff,0xb5b7bdb7,0xe71dc619,0xffffdebb,0xad76bdf8,0xad76ad56,0x8c729cf4,0xad569493,0x9cd4ad56,0x94938c31,0x9cb39493,0x84319493,0x84118c52,0x84318410,0xa535a535,0x8c528c72,0x9cd49493,0xbdb8ad56,0xc619bdb8,0xb5b8c619,0xa515a515,0xc5f9b597,0xb5b7bdd8,
-0xa535c5f8,0xce7ac619,0xc619c5f9,0xb597c619,0xb597bdf8,0x94b4a515,0xb597a515,0x94b3ad56,0x9cd48c72,0xa514a515,0xa5149cd4,0xb596bdf8,0xbdf8b596,0xad76bdd8,0xad55b596,0x9cd39cf4,0x9cd48c31,0x9cd4a515,0x8c529493,0x8c318431,0x9cf494b3,0xbdf98c72,0xa536ce5a,0xa5159cf5,0xa515bdf9,0x94b39493,0x8c738c52,0x73b08431,0x94b48411,0x94938411,0x8c319cf4,0x8c518411,
-0x83f08431,0xa5158c72,0x949394b3,0xad56b596,0x8c528c72,0xa535a535,0xbdb79cf4,0xb5b7ad76,0xbdb7c639,0xbdf8bdf8,0xb576a535,0x9cf49cf4,0xad769cd4,0x9cf4a515,0x9cf49cd4,0x94b3a514,0x8c729cd4,0x84118411,0x8c528c52,0x9cf48c52,0xa515ad76,0x9cb4a535,0x8c528432,0x9cf48c52,0xa515b597,0xad56ad56,0xad56ad56,0xad35ad56,0x843194b3,0x94b3a4f4,0x9cb38c72,0x9cf48431,
-0xbdf8ce5a,0xdedcf77e,0xffbfdefc,0xad76ad76,0xd69ace59,0xad55ce39,0xb597ad55,0xbdd7b576,0x9cf5c619,0xbdd8a4f5,0xbdb8ce5a,0xb597b597,0xe71dbdd8,0xbdf9dedc,0xad77a535,0x9cd4ad36,0xad76ad56,0xa535a4f4,0xb596b5b7,0xa535a4f4,0xc5f9c619,0xad77c5f9,0xa5159473,0xa5169493,0xffdfdedc,0x9cf5ce5a,0xad76b597,0xa535b597,0xb576a535,0xd67aa535,0xc618ad55,0xbdb7c618,
-0xc619bdd8,0xbdf8a515,0xc5f8ce5a,0xd67bc619,0xad76bdd8,0xb5b7b5b7,0xdebbad35,0xc5f8d6bb,0xd69aad56,0xc619e71c,0xdedcce7a,0xc619ce7a,0xce7ad67a,0xc639c639,0xdedcffbf,0xb5b8dedc,0xd69bb597,0xad36ce5a,0xad36b577,0xc5f9c639,0xbdd8defd,0xbdb8bdb8,0xd6bcb5b7,0xad56ce5a,0xbdf8bdf9,0xce5ac619,0xf7bff77e,0xd69bd69b,0xd67ac639,0xc639ce5a,0xad77ad77,0xad56dedc,
-0xffffdedb,0xef5ece7a,0xe6fdc639,0xf79fef7f,0xd69be6fd,0xffffffff,0xd6bbc619,0xc618ef5e,0xe71dce7a,0xffbff77e,0xf77ed6bb,0xc639ce5a,0xffdfbdd8,0x8c72b597,0xb5b79cd4,0xad56b597,0xa535a535,0xa5159cd4,0x8c319cd4,0x9472a515,0x94728c52,0x8c528c72,0x9cd48431,0xad76a4f4,0x84319cf4,0x9cf494b3,0xb597ad56,0xc619ad76,0xc619c639,0x9cd4a515,0xb597b577,0xad76b576,
-0xb597bdf8,0xad5694b3,0xad36b597,0xce3ab597,0xb577b577,0xad56a515,0xad76a515,0xb5b7ad76,0xa515a535,0xa515a515,0xa5359cd4,0xa535bdd8,0xa514ad56,0xc618b596,0xad35ad76,0x9cd4a535,0x94729472,0xa535a535,0x94b3a535,0x8c728c52,0x9cd49cd4,0x9cd49cf4,0xad77ad56,0x94b494b4,0xad7694b3,0x8c729cf4,0x7bf18c72,0x7bf18431,0x8c528411,0x84118c72,0x8c5294b3,0x94728c72,
-0x949394b3,0x94938411,0x8c52a535,0x9cf48c72,0x94929cd3,0xb5979cd4,0xb597a535,0xad56bdd8,0xbdf8b597,0xb597b5b7,0xa515ad56,0xa515a536,0xa515a515,0xa515b5b7,0x94b39472,0x94939cd4,0x8c729492,0x84318431,0x8c728c72,0x9cd48c52,0xa535a515,0x8c318c52,0x7bd08c32,0x9cb49493,0xad56c619,0x8c529cb4,0x94938c52,0xad769cd4,0x9493a514,0x9cd49492,0x94729cb3,0x94b39492,
-0xc619c619,0xef7ece5a,0xd69bdefc,0xad55ce7a,0xdebbbdd8,0xc618c619,0xad55ad56,0xad56a515,0xb597bdd8,0xad56b597,0xc639bdd8,0xb5b8ce5a,0xad76b5b7,0xdedcce5a,0x9cd4ad36,0xad56ad56,0x94b39cf4,0xa5359cf4,0xad56a535,0xa515ad76,0xa5159cd4,0xb597b597,0x9cd4a4f5,0x8411a516,0xc6199cd4,0xce5af79f,0xb5b7a515,0xad35b597,0xad76b597,0xbdd7c619,0xbdf8d69a,0xb5b7c5f8,
-0xbdd8b5b7,0x9cb3b5b7,0xb5b7ef5e,0xad56ad36,0xc619c639,0xad569cb3,0xffbfd67a,0xdedcbdf8,0xbdf8bdf8,0xe6fcef5e,0xc639b5b7,0xbdd8d69b,0xb5b7b5b7,0xb597bdb7,0xe71ddedc,0xd69bd69b,0xad76b597,0xbdd8bdd8,0xc5f9ad56,0xc5f9c5f9,0xce7ad69b,0xffbfc5f9,0xbdd8ce5a,0xce7bffff,0xc639c5f9,0xce7ac619,0xce5ae71d,0xce39ce7a,0xc619c639,0xc639c619,0xad36b577,0xb5b7bdf8,
-0xffdfc619,0xbdf8f7bf,0xe71dbdf8,0xe6fddedc,0xe73ef77f,0xbdd8ef5e,0xad56a4f4,0xce7adebb,0xe73dd6bb,0xffffe73d,0xc639ffff,0xce5ab597,0xad76bdb7,0xb576bdd8,0xa535a515,0xbdf8bdd8,0xa535a535,0x94b394b3,0x8c72ad56,0x8c728c31,0xa4f48411,0x947294b3,0x8c728c72,0x94b39492,0x9493ad35,0xa5157bf0,0x9473a515,0xc619ad56,0xc5f9c619,0xad56b577,0xb597b577,0xbdf8bdd8,
-0xad56bdb7,0x9cd4a4f4,0xa4f5a515,0xb597ad36,0x94b4a515,0x9cb49473,0x9cf4a515,0xbdd8a535,0xbdd8d69b,0x94b3ad76,0xad769cd4,0x9cf49cf4,0xa535ad56,0xb5b7b576,0xb576ce59,0xa535ad55,0x9cb3a4f4,0xad569cf4,0xa535b5b7,0x9cf49cd4,0x9cd494b3,0x9cd49cd4,0xa5159493,0x94b4ad56,0x94b49cd4,0x94b39cf5,0x84118411,0x84318431,0x84328411,0x84318c52,0xa4f48c72,0x8c518c72,
-0x8c728c72,0x949394b3,0xa4f49cd4,0x8c319472,0xb5b7ad55,0xad55a535,0xa535b5b7,0xc619a535,0xb597b5b7,0xbdd8b5b7,0xb597bdd8,0x9cd4ad56,0xa535a515,0xb5b7a515,0x94939cf4,0x9cd39472,0x8c529492,0x9cd39493,0x8c319493,0x94938431,0xa5359cf4,0x7bf094b3,0x84328411,0x9cd49493,0xb5979473,0x9cd4ad56,0x8c528c72,0x84318c52,0xa515b576,0x8c518c52,0x8c529472,0x8c728c72,
-0xbdd8d69b,0xce7ab5b7,0xbdf8ef5e,0xce5ab5b7,0xb5b7ad56,0xce5ace7a,0xbdd8c619,0xc5f8b5b7,0xd6bbce7a,0xc5f8d69b,0xbdf8b5b7,0xb5b7c639,0xa535a515,0xb597a515,0xbdd8debc,0xad769cd4,0xad35ad56,0xad76b596,0x9cb39cd3,0xb596ad55,0xa515ad56,0xc619a515,0x9cf5b597,0xad36a535,0xa5158c73,0xf79fbdd8,0x9cd4d69b,0xbdd8c639,0xad76a535,0xbdd7ad56,0xce39b5b7,0xc639bdd8,
-0xb5b7c619,0xbdd8ad56,0xc5f89cd4,0xbdd8ad76,0xdefcb597,0xad56c619,0xffdfffdf,0xbdf8c639,0xbdf8d6bb,0xce39bdb7,0xb597ce7a,0xb5b7ce7a,0xbdd8b5b7,0xbdd8bdf8,0xc619dedc,0xd69bc619,0x9cd4d69b,0xb5979493,0xce5ad67b,0xce5ace7a,0xf79fbdd8,0xe73ededc,0xb577ce5a,0xffffb5b8,0xb597b5b7,0xce5ac63a,0xc5f8ce7a,0xd67ac619,0xc639c619,0xbdf8bdf8,0xc619c619,0xbdb7a515,
-0xdedbc619,0xd69bffff,0xf79fb597,0xad56e71d,0xe71dbdf8,0xad56b597,0xbdf8c619,0xd67ab597,0xffdfbdf8,0xffffffff,0xc639ce39,0xce39ad76,0xa515ce39,0xce5ac619,0xb576bdd8,0xbdd8ad56,0x9cd4ad56,0x94729472,0x9cd49493,0x84317bf0,0x9cd49cd4,0x843194b3,0x8c528c31,0x94938c31,0xa515ad56,0x9cf49493,0x9cb49cd4,0xce3aa515,0xb5b7bdf8,0xc5f9c619,0xad56ad56,0xb5b7b597,
-0x94b3ad76,0xbdf8b597,0xb597ad56,0x9cf5c5f9,0x9cf59cb4,0xa5159493,0x9cf494b3,0xad569cd4,0xce5ac639,0x9cd4a515,0x94939cf4,0xa5159cf4,0xb5b7b597,0x9cf4ad56,0xbdd8ad56,0x9cd4a515,0xa5159cd4,0x9cb39493,0xad56ad35,0x94b39cf4,0x9cd494b3,0xa515a515,0x94b49493,0xad77a515,0x8c52a515,0xa5158c72,0x84119493,0x84318c52,0x7bf08c52,0x843173af,0x8c318c52,0x9cd3b597,
-0x94b38411,0xad76ad76,0x9cf494b3,0x9cb3a535,0xb5b79493,0x9cd3bdf8,0xa53594b3,0xbdd8a535,0xa535bdf8,0xbdd8a515,0xad56ad56,0x9cf4a535,0xa5159cf5,0xad76a515,0xa515c5f8,0x94b39493,0x9492a4f4,0xa5359cd4,0x83f09cb3,0x8c727bd0,0x9cd4a515,0x8c529cd4,0x8c318411,0x9cd494b3,0xb5b79493,0x94b3b597,0x94b39493,0x843194b3,0x8c528411,0x8c7294b3,0x8c528c52,0x8c518410,
-0xc619ce7a,0xc5f8b5b7,0xce5ac619,0xc639b597,0xa535c639,0xb5b7a515,0xce7abdd8,0xce39bdd8,0xc639ce5a,0xb5b7c619,0xad76a515,0xc5f8bdf8,0xc619d6bb,0xb597ad36,0xd69bce7a,0x9cb4ad56,0xad76ad56,0x9cd3a515,0xa4f4a535,0xad569cf4,0x94929cd3,0xa51594b3,0xa535bdd8,0x9cd4ad56,0x94b3ad76,0xbdd8ad76,0xd69bdefc,0xc6399cf4,0xa4f4bdf8,0xbdd7ad55,0xb596bdf8,0xc639ce7a,
-0xbdf8ce7a,0xd67ab597,0x94b3ce7a,0xad56b5b7,0x9cf4ad56,0xad56defc,0xffdfffff,0xbdf8ce7a,0xbdf8c5f8,0xbdf8b596,0xdefcdebb,0xce5abdb7,0xad56b597,0xad56a535,0xbdf8bdd8,0xce5abdd8,0xc619c63a,0xbdd8ad56,0xdedcdebc,0xc619ce7a,0xc619c63a,0xffbfffff,0xb577d69b,0xb5b8ad77,0xad36ce5a,0xce5aa515,0xdefce71d,0xbdf8c619,0xce5ad6bb,0xc5f8c639,0xe71dce5a,0xbdb7b577,
-0xd67ac619,0xef7ededb,0xdedcd69b,0xb597ffdf,0xd69bbdb8,0xc619d6bc,0xad76ad76,0xad35a535,0xffdfef7e,0xe6fce73d,0xa515ce7a,0xbdd8ce5a,0xad76c639,0xad76a4f4,0xa515b5b7,0x9cd4a4f4,0xa535b597,0x949394b3,0x9cf48c52,0x8c72a515,0x94728c52,0x94b38c52,0x9cd4a515,0x8c3194b3,0x9cb49473,0x9cd4a535,0xad5694b3,0xad76a515,0xa5369cd4,0xce5ac619,0xbdf8c619,0xc619bdd8,
-0xbdd8c619,0xc5f8b576,0xb5b8c619,0xa515ad56,0xa515a515,0xa4f5a515,0xa535a535,0xa515a515,0xa515a515,0xa515a535,0x94b39cd4,0xa5159472,0xb597bdd8,0x94b3ad76,0xb5979cf4,0xa515c619,0xa5159493,0x94729493,0x9cd49493,0x9cf49cf4,0x94b3a515,0x94b39493,0x94b48c73,0x9cd48c73,0x8c528c73,0x8c739493,0x94939cf4,0x8c5273b0,0x84117bf1,0x8c728c72,0x94728c31,0x9cf48c31,
-0xa5159cd4,0xb597ad56,0x94b3a514,0x9cf49493,0x9cd494b3,0xbdf8b597,0xa53594b3,0xbdd8c619,0xad76ad76,0xbdd8a535,0xa535b5b7,0x9cf5a515,0x9cf59cf4,0xb597a535,0xbdd8b576,0x9cd4a4f4,0x9cd4a4f4,0x94939cb3,0x94729493,0xa5159493,0x94939cf4,0x94b38c52,0x84319493,0x94b38c52,0x9cb38c72,0xa515b597,0x9cd4ad56,0x9cd49cd4,0x8c319492,0x84108411,0x84107bd0,0x94728c52,
-0xce7aa515,0xb597c619,0xb597c5f8,0xc619debb,0xb597c619,0xbdf8a535,0xc619ce7b,0xc639ce3a,0x9cf4bdf8,0xad769cb3,0xa535b597,0xc619ad76,0xc619c5f8,0xc5f9c63a,0xd69bb597,0xb597d67b,0x9cb39473,0xad56a535,0xa4f4a535,0x9cd4a4f4,0xb597ad35,0x94b3a515,0xb5979cd4,0xa515c5f8,0xc5f8ad56,0xb5b7a515,0xef5ed69b,0x9cd4c619,0xad56ce7a,0xc6199cf4,0xbdd8bdd8,0xdedcad56,
-0xc619bdd8,0xbdf8ffbf,0xbdd8c619,0xad768c72,0xc619b597,0xef5dbdb7,0xce7affff,0xce59c619,0xce59b597,0xbdd8ce5a,0xd6bbbdd8,0xad56defc,0xad76ad56,0x9cd494b4,0xbdb8ad56,0xc5f9ce3a,0xce5ac619,0xbdd8dedc,0xd6bcbdd8,0xad76ce3a,0xb598bdb8,0xdedcdebc,0xb597defd,0xad57ad56,0xbdd8ad56,0xb597bdd8,0xdefcbdd8,0xbdd8dedc,0xdedcce5a,0xce39c639,0xc639ce3a,0xbdd8bdf9,
-0xd6bbbdf8,0xe71ddedc,0xdefcdedc,0xc5f8f7bf,0xc619b597,0xef5ec5f9,0xa4f5bdd8,0xef3eb5b7,0xd67aef5e,0xc619d69b,0xbdd8defc,0xce5ab5b7,0xb576f7bf,0xb576b576,0xad76a535,0x9cf49cd4,0xad769cf4,0x9472ad76,0x9cf49cd4,0xb5769cd4,0x84119472,0x8c729493,0x9cf4a515,0x9cf4a515,0x94938411,0xad369cb4,0xad56a536,0xa515bdd8,0xa51594b3,0xc5f8b5b7,0xbdf8bdf8,0xbdb7bdd7,
-0xad56bdd8,0x9cd4a515,0xad77b577,0xa5358c73,0xa515a515,0x9cf59cd4,0x9cf494b3,0xad56a515,0x94b394b3,0xad56a515,0xa4f5a515,0x9cb39493,0xbdb7ad56,0xa535a515,0xad76a535,0xc619bdf8,0x9cf49cf4,0x9cf4a515,0x8c529472,0xb5b7a4f4,0x94b39cf4,0x94b39cd4,0x94938c73,0x84328c73,0x9cd48c52,0x84328c52,0x94938c52,0x84118432,0x94938411,0x8c729493,0x8c528c51,0x9cd49cd3,
-0x9cb3ad76,0xa5359cf4,0xa514ad35,0x94b39472,0x9cf4bdd7,0xc6189cf4,0xad76bdf8,0xce5aad76,0xa556b5b8,0xa515ad56,0xb597ad77,0xa5159cf5,0x9cd49cf4,0xad56a515,0xad56ad56,0xa515bdf8,0x9cd49cd3,0x84319493,0x9cd48c31,0xad56ad35,0x8c529cd3,0x94939473,0x9cb39cd4,0x94b38431,0x84119472,0xb597a515,0xad35c618,0x8c529cd3,0x94939cf4,0x8c5194b3,0x738e73af,0x8c7173af,
-0xad56c619,0xad56c619,0xd67ab597,0xef3dc5f8,0xce5abdf8,0xce7ae6fc,0xce5ac619,0xdebcc639,0xad55bdb7,0xad769cf4,0xc639d69b,0xbdd8b5b7,0xb597b5b7,0xbdb8ce3a,0x9cf4ad56,0xb597ad56,0xad56a515,0xbdd8bdd8,0xad56b597,0xa515ad56,0xc619a535,0xad56bdd8,0xa4f49cd4,0xce39ce39,0xb5b7bdd8,0xbdb7d69b,0xce7abdf8,0xbdb7e71d,0x94b39cd4,0x8c528c52,0x9cb38c73,0xbdd8a535,
-0xd69bef5e,0xc619ef5e,0xad56b597,0x94b3b576,0xc619c639,0xffffd6bb,0xbdd7ffff,0xc619b576,0xad76dedb,0xce5abdd8,0xb5b7b5b7,0xef5ee71d,0xb5b7ad56,0xa536bdd8,0xb597bdd8,0xbdb8bdf9,0xdefcce7b,0xd67bc5f9,0xbdb8bdd8,0xb577c5f9,0xb597ad36,0xad56b598,0xdedcffdf,0xa4f5ad56,0xad7694b4,0xbdd8d69b,0xdedcb597,0xe73dffdf,0xdefcd69b,0xdedcdefc,0xbdd8c619,0xbdb8c639,
-0xbdd7bdf8,0xe6fcbdd8,0xce5ace7a,0xbdf8ffff,0xb597b597,0xce5abdd8,0xce3ae6fd,0xd67bf7bf,0xa515a515,0xce5ae73d,0xdefcdefc,0xb576c639,0xe73dffff,0xbdd8b5b7,0xa535a515,0x9cd4ad56,0x9cd49493,0x9cd4a535,0x949394b3,0x9cd48431,0x8431ad76,0xa5358411,0xa4f49493,0xad56ad76,0x8c529cd4,0x9cd48c73,0xa535ad76,0xad76ad56,0xa515ad77,0xbdd8b597,0xad76a515,0xad76c639,
-0xa515b597,0x9493a515,0xad36a536,0xad36ad36,0xad77bdd8,0x9cb4a515,0xad569cf4,0xad56b597,0x9cf4a515,0xa5359cd4,0xad36ad56,0x94b39cb3,0xb597b597,0xb5b7bdf8,0xa4f4a515,0xb5b7a515,0xa515ce5a,0xad35a515,0x9cb3a515,0xa5159cf4,0xad56bdd8,0x949394b3,0x94b49cf5,0x8c5294b4,0x94b38431,0x8c529cf4,0x8c739493,0x8c739cf4,0x9cf594b3,0x94939493,0x9cd48c72,0x9cd39cd3,
-0x9cf49cf4,0x9cf4a4f4,0xad76b576,0x9cf4a514,0xc618ad96,0x9cf49cf4,0xbdd8c619,0x94b3a515,0x9cd4b5b7,0xad769cf4,0xad77a515,0xad56b5b7,0xa515ad56,0xa535a515,0xad56ad76,0xad76ad56,0x94929cd4,0x8c529493,0x947283f0,0x9cb39cf4,0x94939493,0x8c528c52,0x94b38c31,0x8c729cf4,0x9cd494b3,0xad35ad35,0x84318c52,0x94b39cd3,0x94728c52,0x8c728c51,0x7bf09492,0x738e6b6d,
-0xce39ce5a,0xbdb79cf4,0xb597ce5a,0xdedcdedc,0xce7bf77f,0xc619d69b,0xbdd8ad57,0xce5ace5a,0xc618defc,0x9cd4b596,0xe71cbdd7,0xad56c5f8,0xb5b7ad76,0xce5ac619,0xa515ad77,0xbdd8ad36,0xad77bdd8,0xb597c619,0xad76bdd8,0xad56ad36,0xad76ad56,0xad76a4f5,0xa515a4f5,0xce3aa536,0xa515ce5a,0xc619ad56,0xbdb8ad56,0xbdd8bdd8,0x8c72bdf8,0x8c529493,0x94937bd0,0xbdd8ad56,
-0xdedcbdf8,0xb597bdf8,0x94b3a4f4,0xce5aa535,0xce59b576,0xffffce59,0xbdf8e73d,0xbdf8ad76,0xbdf8c619,0xbdb7ad76,0xbdd8d6bb,0xf7bfbdf8,0xad76e6fc,0xce5ace7a,0xb5b8c619,0xad7694b3,0xdebcdefc,0xbdb8d69b,0xb577ce3a,0xbdd8b597,0xad56ad36,0xad77b597,0xffbfce5a,0xad77a516,0xc5f9b5b8,0xc639ad56,0xd6bbb5b7,0xf79fdefc,0xef3dd69b,0xe73de73d,0xc619d67b,0xb577bdd8,
-0xc5f8bdb7,0xc619bdf8,0xbdf8d6bb,0xe71de6fc,0xc639bdf8,0xad56c619,0xffdfffff,0xa515b5b8,0xc639b5b8,0xdefcc5f9,0xf79fce5a,0xa536d69b,0xef7ebdd8,0xad56c5f9,0x9cd4a515,0xad36a536,0xa515a515,0xb597a515,0x9493ad56,0x94939cd4,0xa5359cd4,0x94b38431,0x8c52a535,0x9cd49cd4,0x8c52a515,0x8c528c32,0x9cd49493,0xa515ad56,0xb5b7b5b8,0xbdf8bdd8,0xb5b7b576,0xad76c5f8,
-0xa515a515,0xb576a535,0xb5b7b597,0xb577b5b8,0xad56ad56,0xb597b597,0xa515ad56,0xad769cb3,0xa536a535,0xb5b8a515,0xb577ad56,0x9cd4a515,0xbdd8ad76,0xb5b7c619,0xad56ad56,0x9cb39cf4,0xce7aad56,0xa515a535,0xa535ad76,0x9cd4ad76,0xc639ad76,0xa515b597,0x9cd49cf5,0x94b49cd4,0x84328c52,0x9cf594b3,0x8c7294b3,0xa5158432,0x9cd49cf5,0x94b39cd4,0x9cd39cf4,0x8c7294b3,
-0x9cb394b3,0xb5b7c619,0x94b3a515,0xa5159cd4,0xb597a515,0xad76d69a,0xad76a515,0x94939cd4,0x9d159cf5,0xa51594b4,0x9493b5b7,0xbdf8b597,0xa536a515,0xa5159cf5,0xb5b7ad56,0x9cd49cf4,0x9cd4a515,0x9cb38c72,0x8c519cb3,0xad359cd4,0xa535a514,0x84319cd4,0x7bd07bd0,0x9cd48c31,0xad768c31,0x9cb3ad35,0x8c728c52,0x94b38c72,0x8c319492,0x84108410,0x9cf394b2,0x84108c51,
-0xce7ab597,0xb5b7c639,0xd69bce7a,0xce7abdb8,0xf79fdebc,0xce5ac619,0xb597ce7b,0xbdf9bdb8,0xdedbdedc,0xad55ad76,0xce59b5b7,0xb597e6fc,0xb5769cf4,0xad36ad36,0xad76bdb8,0xa515ad77,0xbdb8b5b8,0xbdd9bdd8,0xbdf9bdd8,0xb597bdb8,0xa535ad76,0xa5359cd4,0xb5b7bdf8,0xb597ad56,0xc619c619,0xad77bdd8,0xb597c619,0xc5f9b597,0xbdd8d67b,0x94939493,0x9cd48c52,0xb598a536,
-0xad56bdd8,0xad76c619,0xa535b576,0xdedbc5f8,0x9cd3ef7e,0xffdfb5b7,0xce7ac639,0xbdf8c618,0xc639bdd8,0xb5b7c639,0xe71dc639,0xc639c619,0xdedce73d,0xce3aad56,0xa4f5ad77,0xad56bdb8,0xbdb8c63a,0xc619bdf9,0xbdf9bdd8,0xa4f5ad76,0xb598bdb8,0xad57ad56,0xdeddad56,0xa515d69c,0xce3aad76,0xa536b597,0xc5f8d6bb,0xe73dbdf8,0xc619ef5e,0xe73dd69b,0xd69bef3e,0xbdd8c619,
-0xc639ad76,0xbdf8b597,0xb576c619,0xef7ec639,0xc619dedc,0xffffd67a,0xc619f7bf,0xa535bdf9,0xe71dad36,0xad77c639,0xd69bd69b,0xc619d69b,0xb577b597,0xa515e6fd,0x9cd48c32,0x9cd4a535,0x94b394b3,0xad56a535,0x94b3ad56,0x94b39493,0x94b39493,0x8c72ad76,0x9cd48431,0x9cd49472,0x9cb39cd4,0x9cf49493,0x9cb49493,0xad36ad56,0xb577b577,0xc639bdf8,0xbdd8bdd8,0xad76c619,
-0xad56b597,0xad76a4f4,0xc5f9c619,0xb5b8b597,0xa515bdb8,0xb5b8ad56,0xad76b597,0xa535a535,0xb5b7ad77,0xc619ad56,0xad56a515,0xad56bdb8,0xc639bdd8,0xbdd8bdd8,0xb5b7c619,0x9cd4a515,0xad569cf4,0xad76defc,0xb5b7ad56,0x9cf4ad56,0xad5694b3,0xb597d69b,0x94939cd4,0x9cd494b4,0x84318c73,0x8c738411,0x9cd49cd4,0x8c528c72,0x9cf494b4,0x8c729cd4,0x94939472,0x8c7294b3,
-0xa5358c72,0xb5979cf4,0x9492a535,0x9cf49cf4,0xad55a514,0xbdf8ad55,0xa515a535,0x9493a515,0x94d48c93,0x9cd4a535,0xad7694b4,0xb5b8ad56,0x9cf4b5b8,0xa536a515,0x9cd49cd4,0x94b3a535,0xa5159cb3,0x83f09493,0x94727bf0,0x9cd494b3,0x9cd49cd4,0x8c329493,0x84118411,0x8c318411,0x9493a515,0xa535a515,0x9cb39cf4,0x94928c52,0x8c729492,0x7bcf8410,0x9cd38410,0xa514ad76,
-0xbdd8defc,0xdefcdefc,0xc639ad35,0xbdd8dedc,0xd69bdedc,0xc619ef3e,0xc61ace5a,0xbdd8ad77,0xc639c5f9,0xbdd8ce39,0xbdd8ad76,0xce7ace7a,0xa535b597,0xbdd8b597,0xce3ac619,0xc5f9c619,0xdedcce3a,0xce5adefd,0xb5b7bdb8,0x9cf4ad36,0xb5b7a515,0xa515a515,0xbdf9bdb8,0xbdd8ad57,0xdebbb577,0xa515d69b,0xbdb8b597,0xad369cd4,0xbdf9ad36,0xad56c619,0x9cd5a515,0xa536b598,
-0xbdf8ad76,0xd6bbb597,0xbdd8b597,0xd67abdb7,0xbdb7c639,0xffffce7a,0xce5ab5b7,0xe71dbdf8,0xce5ad67a,0xce7ad69b,0xbdf8bdf8,0xc5f8dedc,0xce5abdf9,0xad36bdb8,0xa535ad77,0xa536bdd8,0xa5359473,0xad56ad36,0xb5b7b577,0xa515ad77,0xad7794b3,0xce5ab5b7,0xc5f9bdd8,0xad57e71d,0x9cd4a515,0xb597b577,0xc639bdb7,0xe71def5e,0xd67adedc,0xdefcd69b,0xf77ff79f,0xc63aef5e,
-0xd6bba535,0xd69bd6bb,0xc618c618,0xffffbdf8,0xffffc619,0xffdfffdf,0xbdf8b577,0xd67bbdb8,0xbdb8b5b8,0xb597c619,0xdebcbdf9,0xc63ad69b,0xad56c63a,0xbdf9bdb8,0xa536ad36,0x9493a536,0x9cf58c52,0xad569cf4,0xad76ad35,0xa4f4b597,0x94b39493,0x9cb3a535,0x83f08411,0x8c528c52,0x9cd39cf4,0x94939493,0xa53594b3,0xb597a536,0x9cd4ad36,0xbdd8b597,0xc619bdd8,0xbdf8bdd8,
-0xb597bdf8,0xb576ad56,0xb5b8bdf8,0xad76ad56,0xb597bdb8,0xad36ad56,0xad56ad35,0xa4f4a515,0xb5979cf5,0xb5b8b597,0xa4f59cd4,0xc619a535,0xc619ad76,0xbdd8bdd8,0xc5f8ad76,0x94b3a535,0x9cd4a535,0xd69bbdd8,0xbdb7b5b7,0xa535ad56,0x9cd49cd4,0xc619b597,0x9cf5a536,0x8c7394b4,0x8c739cd4,0x94b38c52,0x94b39cf4,0x8c739493,0x9cd48c73,0x8c7294b3,0x94938c52,0x8c7294b3,
-0x8c728411,0xa5359cf4,0xbdf8c639,0xa555ad55,0xa535b5b7,0x9cd4a535,0xad76ad76,0xad76a535,0x94b38c72,0xb5b89cd4,0xad76ad56,0xa515ad76,0xad56ad77,0xa5359cf4,0x8c72a515,0xa5159cd4,0x9cb39472,0x8c31ad35,0x8c317bd0,0x8c729493,0x94939493,0x7bf08c52,0x8c528411,0x8c528c52,0x9cf4a515,0xb5978c72,0xa535b596,0x9493a514,0x8c7294b3,0x84108410,0x84317bf0,0xbdf8ad55,
-0xdefcdebb,0xe73dbdb7,0xa515defc,0xce7bce3a,0xe6fdbdd8,0xe6fdce5b,0xce3ac619,0xb577ce5a,0xb597ad56,0xbdf8c619,0xa535b597,0xb576a4f4,0xad76b5b7,0xb597b577,0xc5f9ad56,0xb597d69b,0xdebcdebc,0xc619d69b,0x8c52ad56,0xa5159cb4,0x9cf49cf4,0xa515a515,0xad56a515,0xad56ad77,0xad56ad56,0xc619d69b,0xad76ad56,0x8c72a515,0xb59794b4,0xbdf9c61a,0xb598a4f5,0xa515bdb8,
-0xbdb8b5b8,0xb5b7c5f8,0xc618dedb,0xc639ce59,0xad76bdd7,0xdedcffbf,0xe6fcce59,0xce59e73d,0xd69bd67a,0xce5ac639,0xb5b7c639,0xce5ab5b7,0xbdd8c5f9,0xb597b597,0xc63aa4f5,0xb597c619,0x9cd4ad36,0xa4f5a515,0xbdd8a515,0xdedcce5a,0xb597b577,0xbdb8ad56,0xa535bdd8,0xdebcce5b,0x9cf4b597,0xad56a515,0xb5b7b597,0xef3dd6bb,0xc639d6bb,0xd69bd69b,0xef3ededc,0xce3adedc,
-0xa535ad36,0xbdf89cf4,0xb596c639,0xe71cad56,0xffffe71c,0xc5f8debb,0xc5f9ce5a,0xbdd9c619,0xc5f9d6bc,0xbdd8ad36,0xbdd8b5b8,0xd6bcdedc,0xc63ad6bc,0xb577ad36,0xad36ce5a,0x9cd59cf5,0x9cd48c72,0xad35bdf8,0xad76a515,0xa535bdd8,0xad35a535,0xad569cd4,0x8c72b597,0x9cd48c52,0xa4f49cd4,0x9cf49cd4,0x9cf4a515,0xa535ad36,0xb577ad56,0xbdb8a536,0xbdd8c639,0xb597bdd8,
-0xad76b597,0xad56ad76,0xa4f5a515,0xad56a515,0xc619ad76,0xa535b5b7,0xb597a515,0xb5b7bdb7,0x9cf4b597,0xb597ad56,0x9cf49cd4,0xad5694b3,0xce5ac639,0xbdb7c639,0xb5b7b597,0x9cd4b597,0xb5b7b576,0xad569493,0x9493ce5a,0xad56a535,0x9cd494b3,0xa5159493,0xad56bdd8,0x949394b4,0x94939493,0x84329493,0x8c728c52,0x84329493,0x94938c72,0x94b39493,0x9cd494b3,0x947294b3,
-0x8c529472,0xad769cd4,0xbdd8b596,0x9cf4b596,0xb5d7be18,0x9cd4ad56,0xa5359493,0x9cd4a535,0xad97c619,0xad569cf4,0xbdd8bdd8,0xb597bdf9,0xb5b8a515,0x9cd4b5b7,0x9cf49cd4,0xa515a535,0x94b39cf4,0xa4f4a4f4,0x8c518431,0x9cb38c51,0x8c528431,0x8c528c72,0x84318c52,0x84118411,0x8c529493,0x9cb39cb3,0xb597ad76,0xa4f4a514,0x8c5294b3,0x84308c51,0x8c518410,0xad769cd3,
-0xdedcce5a,0xc5f8d69b,0xbdd8ef5e,0xd69b9cd4,0xce3adefd,0xdebcef5e,0xce5bef5e,0xce7bc61a,0xb597b577,0xb5b7b577,0xad36b5b7,0xa4f5a4f5,0xad76a515,0x9cd4ad56,0xad36a535,0xbdd8c5f9,0xce39b597,0xd69bb577,0xad76c619,0xa515b597,0xa5359cd4,0xb576a515,0xb577a515,0xbdd8a536,0xa535b597,0xdedca515,0xb577c5f9,0xa515a515,0xa4f58c72,0xb597c619,0xa515bdd8,0xad57ad56,
-0xbdd8b597,0xce5aad56,0xd6bbbdf8,0xbdb7c619,0xbdd7bdd7,0xdedcffff,0xd6bbc619,0xd69ae71d,0xdefcbdd8,0xc639d69b,0xc619ce7a,0xad35ad76,0xad56ad77,0xbdd8a515,0xbdd8c5f9,0xce3ad69b,0xad36a515,0xb5b7ad36,0xc619ad76,0xce5ad67b,0xa515b577,0xb5b7ad36,0xbdd8ce7a,0xc619bdb8,0xb597b597,0xb577a4f5,0xc5f8bdf8,0xdefcbdd8,0xb5b7ef7e,0xd6bbbdf8,0xd69bd69b,0xce3ace7b,
-0xb5b8c619,0xbdd8c619,0xbdb7c5f8,0xffdfc639,0xbdd7ffff,0xce5ace7a,0xd69bc619,0xbdf9c619,0xd6bcce3a,0xa515a515,0xc5f9b5b8,0xef7fb577,0xd69bd69b,0x9473c61a,0xbdf9a515,0xad369cb4,0xad56a515,0xad56b597,0x9cd494b3,0xad569cd4,0xa515ad35,0x94b3b5b7,0xb5b79cf4,0x8c7294b3,0x8c729cf4,0xa4f4a514,0xa515a515,0x94b39cf4,0xad369cb4,0xbdb8a536,0xc619c619,0xc5f9ce5a,
-0xad76b5b7,0xad56ad76,0xad56a515,0xc619b597,0xce5ac639,0xbdf9c619,0xb5b7b576,0xce5ace5a,0x9cf4bdf8,0xad7694b3,0xa515ad56,0x9cb39cf4,0xd6bbb597,0xc619ce5a,0xb5b7b5b7,0xad56b597,0xad569cf4,0x9cf4ad56,0xc619b597,0x94729493,0xa5359cf4,0x9cf49cf5,0xbdd8ad56,0x9cf5ad56,0x8c7294b4,0x8c729493,0x8c528c52,0x94938c72,0x94b394b4,0x9cd48c72,0xa535a514,0x94b39cf4,
-0x9cd494b3,0xa535a535,0xad76b5b7,0xbdd7bdd8,0xb5b7a555,0xad76b597,0xa535a515,0xa515ad76,0xc6199cf4,0x9cd4ad56,0xa5359cd4,0xad56a536,0xa515b5b7,0xad56b5b7,0xa5158c72,0x9cd4a515,0x94939cd4,0x8c529472,0x8c529cd4,0x8c528411,0x84318431,0x8c528c52,0x84118411,0x94938c52,0x94938c31,0xa4f49493,0xad559cd4,0xad55ad55,0x8431a535,0x83f083f0,0x9cd38430,0x9cf3a514,
-0xce5ac639,0xdedcd69b,0xce3ab577,0xad36c619,0xef3ece5a,0xe71dbdd9,0xd67bdebc,0xd69cc61a,0xad36bdd9,0xb5b7ad77,0xad36b577,0x94939cb4,0xb5979cd4,0x9cd4b5b8,0xb597a515,0xce5abdb8,0xb5b7ce7a,0xce39bdd8,0xd69bdefc,0x9cd4ad76,0x9cf4ad56,0xad56ad56,0xc619bdf8,0xb5b7c619,0xc618bdd8,0xad35a515,0xc5f8ce39,0xad56ad76,0x9cd4ad56,0xad56b577,0xce5ac619,0xb5979cd4,
-0xad56ad56,0xc5f8bdb7,0xc618ce59,0xb5b7ce59,0xbdd7ad76,0xce5ad69b,0xbdf8ce5a,0xe71cbdf8,0xd6bbdefc,0xce5aef3d,0xbdd8b597,0xad35c619,0xb597b597,0xbdb8b5b7,0xbdf8c639,0xd67bb597,0x9cd4a515,0xad36a535,0xd69bb5b7,0xc63ace7a,0xc639ce5a,0x9cd4b597,0xad56a535,0xbdf9b597,0xb5b7bdb8,0xb597a535,0xd69bb597,0xe71dd69b,0xce7affdf,0xc619bdf8,0xc619ce5a,0xc619d6bb,
-0xe6fddefd,0xbdd8b5b7,0xdedca515,0xffffffdf,0xce39bdb7,0xbdf8c639,0xce3ace5a,0xad77c63a,0xad369cf5,0xce5bb597,0xc5f9a515,0xbdd8bdd9,0xc5f9ce7b,0xad56ce5b,0xad579493,0xad56c61a,0xad56ad56,0x9cb4a4f5,0x9493a535,0xb5979cf4,0xb597ce39,0xad56b5b7,0xad56a4f4,0xa514ad76,0x9cd39cd3,0x9cd49492,0xad56ad56,0x9cf4a515,0x9cd49cd4,0xd69bc619,0xbdd8c619,0xc639b597,
-0xad56bdb7,0xad56a535,0xb5b8bdb8,0xbdf9b577,0xc619ce5a,0xc619bdd8,0xb5b7bdd8,0xe73dce5a,0xad56c619,0xa5159cd4,0xad76ad76,0xa515a515,0xce5ab576,0xc5f8e71d,0xad35ad76,0xad35a535,0x9cd4a515,0xa5159cf4,0xa5158c72,0x8c52ad76,0xb597a515,0x9cf5a515,0xad568c73,0xa515ad77,0x94939cd4,0x8c739cd4,0x94b38c52,0x94939493,0x9cd49cf4,0x94b39493,0xa5359cf4,0x9cf4a535,
-0xbdd8a535,0xad56bdd8,0xc659ad56,0xc639ad76,0xb5d7c618,0xad76bdf8,0xad56b5b7,0xb5b79cf4,0xad76a535,0xad76ce5a,0xad56b597,0xad76a535,0xbdf8ad76,0xad56a535,0x9cd4a535,0x9493a4f4,0x9cd38c72,0x84318431,0x94b38c52,0x84118c52,0x94b38c52,0x94939cd4,0x94738c52,0x8c329473,0x9cd48c52,0x94939cf4,0x94b394b3,0xad359cf4,0x94b3ad76,0x7bf07bf0,0x9cd38c71,0x9cd3a534,
-0xdefcdedc,0xbdf8b5b7,0xb597ce3a,0xc63ad69b,0xd67bb597,0xc619e71d,0xdebce6fd,0xd67bd69c,0xad36bdd8,0xbdf8a536,0xbdb8c619,0x9cb4ad56,0xad56ad56,0xad5694b4,0xa515ad36,0xb597ad56,0xd6bbce7a,0xd6bbce39,0xe71dd69a,0xa4f4bdf8,0xa4f4a514,0xad76ad56,0xbdf8bdb7,0xad56b597,0xce39c618,0xa535bdd7,0xd69bad56,0x8c72bdb7,0xb5769cf4,0xbdf89cb3,0xd69bce5a,0xb597c619,
-0xbdd8ce3a,0xbdd8bdb7,0xce7abdd8,0xbdf8bdd7,0xb5b7c618,0xc639bdd7,0xdedbd69a,0xce7ac639,0xd6bbdedc,0xdedcce5a,0xb5b7c619,0xb597bdd8,0x9cb4b597,0xb597bdd8,0xd67bbdd8,0xb577b597,0xad56c619,0xad56a535,0xb597bdb7,0xb576b5b7,0xce3ac619,0xad56bdd8,0xad56a515,0xbdb8b577,0xad56dedc,0xa515b577,0xa5359cd4,0xdefcd6bb,0xbdb7d69b,0xb5b7bdd8,0xbdf9bdd8,0xd6bbce5a,
-0xe71dce5a,0xb5b7ce5a,0xffffef5e,0xdedbffff,0xc619bdd8,0xb5b7ce5a,0xc63abdb8,0xbdb8c61a,0xa516a536,0xb5b8bdb8,0x9cf59494,0xc5f9c61a,0xc5f9a536,0xbdf9ad57,0x9cb4ad56,0xb5b8ad57,0xa515ad36,0x9cb49cf4,0xad56a515,0xb597a515,0xd67ac619,0xb597ad76,0xad35bdd8,0xc618bdf8,0x94b39cd4,0x949294b3,0xa515a535,0xa51594b3,0xad369cb4,0xe73dc639,0xad56d6bc,0xbdd8ad36,
-0xad35b5b7,0xb576a535,0xbdd8c5f9,0xb577ad56,0xc619c619,0xbdb8bdd8,0xb5b7b5b7,0xdebbbdf8,0xb5b7dedc,0xad76ad76,0xb597a515,0xa515ad56,0xb576b597,0xe6fcd69b,0xc639ce7a,0xa515a535,0xa535b597,0xad569cb3,0x83f09493,0xad76a535,0xb597a515,0x94b3a535,0x94b4a515,0xb597ad56,0x94b3a536,0x9cf594b4,0x9cd49cd4,0x94b39493,0xa5159cd4,0x9cf4a515,0xa5159cf4,0xad35ad56,
-0xad35ad56,0x9cf4ad56,0xc6399cf4,0xbdf8ce5a,0xbdf8d69b,0xb5b7ad56,0xa535a535,0xad56a535,0xad56b5b7,0xb5b7a515,0x94b39cd4,0xbdd8a535,0xb5b7b597,0xa515bdf8,0xad55c618,0xa5359492,0x94b39cd4,0x84118c52,0x94938431,0x94b3a515,0x9cd48c31,0x94b3a4f5,0x9cf49493,0x8c529cf4,0xa5359493,0x9cb3a515,0xa5149493,0xb5769cf4,0xad55a514,0x8c3194b3,0x9cf39492,0x9cd3a514,
-0xef7effff,0xc619ce5a,0xdebce71d,0xe71db5b8,0xb577d69b,0xffbfe71e,0xce5bc61a,0xd69cd67b,0xbdf9ce5a,0xad36ad57,0xbdd8b598,0xad76b5b8,0xa515ad56,0xa536a515,0xad56ad56,0xad76ad56,0xad55a515,0xbdf8dedc,0xe73dce5a,0xd69ad67a,0xa535ce7a,0xc619b597,0xb5b7b597,0xad76b597,0xbdf8bdd8,0xce39bdf8,0xce5ac639,0x8410ad76,0xa5148431,0x9cd49493,0xbdd8b597,0xe71ddefc,
-0xbdd8b5b7,0xb597ad56,0xc618bdf8,0xc618ce59,0xf7bfbdf8,0xb596bdf8,0xd6bbd67a,0xad56c619,0xce5abdb7,0xc639d67a,0xc639dedc,0xce5aad56,0xb5b7c619,0xad56a4f5,0xbdd8bdd8,0xb597e6fd,0xe6fdb597,0xbdd8d69b,0xad56b597,0xb5979493,0xb597d6bb,0xbdd8ad36,0xb576a536,0xb577b577,0xad76bdf8,0xa4f5b597,0x9cb394b3,0xd69bbdd8,0xb5b7c639,0xdefcbdf8,0xad56c619,0xd67bc5f9,
-0xce5adefc,0xffdfd6bc,0xc639ffff,0xce7aef5e,0xb597b5b7,0xbdd8ad76,0xbdd8b577,0xb598c63a,0xa536a516,0xa5159cf5,0xad36ad57,0xc63aa516,0x94739cb4,0xa516b5b8,0xa515ad57,0xa5169494,0xad36c61a,0x8c528c72,0xad369cd4,0xa515b597,0xa535ad35,0xa535bdd8,0xbdd8ad56,0xb597a535,0x9cd3c618,0x94939cd3,0xad35ad35,0xad56b5b7,0xad77a4f5,0xc619ad77,0xb5b8d69b,0xbdf8a536,
-0x9cd4a536,0xad76a535,0xb5b7b597,0xad77ad76,0xbdf9ad77,0xb5b7c5f9,0xce7ab597,0xc619d69b,0xd69bce7a,0xbdf8bdf8,0xa515a515,0xad76a535,0xb597ad56,0xce5aad56,0xbdf8ce7a,0xa514b596,0x94b39cf4,0x9cf494b3,0x9cd49cf4,0xb5768c72,0x9493ad76,0x94b394b4,0x9cf59cf5,0x9cd49cd4,0x9cd49cd4,0xa5369cf5,0x8c529493,0x9cf594b3,0xa51594b3,0xad56ad76,0xa514a535,0xad76ad56,
-0xa515ad56,0xa5159cf4,0xce7ab597,0xd6bbd6bb,0xc639bdf8,0xb5b7b5b7,0xad76bdd8,0xa535ad76,0xad76b597,0xa535ad76,0xb597bdd8,0xa535ad56,0xad76ad76,0xbdd8bdf8,0xb5978c72,0x9cd4ad56,0x8c529cf4,0x84317bf0,0x8c728c52,0xa51594b3,0x9cd494b3,0x94939cd4,0x94938c52,0x94b39cd4,0x949394b3,0x9cb39493,0x9cf494b3,0xb597ad76,0xa514a535,0x9cf4a535,0x9cf49cd3,0xa4f49cf4,
-0xffffdedb,0xc619defc,0xb597c639,0xce5ac619,0xdefde71d,0xdedcad57,0xbdd9ffdf,0xd69bd69b,0xb5b8e6fd,0xce7bbdb8,0xa536a536,0xb597c63a,0x9cb4b577,0xad76a515,0xbdd8b5b8,0xad35b5b8,0xa515ad56,0xdebbbdb7,0xe73dd69b,0xc639c639,0xd6bbef7e,0xc619bdf8,0xad56bdf8,0xc619bdd8,0xb5b7b5b7,0xc639ce7a,0x9cf4b576,0x94938c32,0x9cd49472,0xad56a4f4,0xe71c9cf4,0xdefcf79f,
-0xb597ce7a,0xbdd8b597,0xc619b5b7,0xbdf8bdf8,0xffbfce39,0xbdb7a535,0xc619c5f8,0xef7fe6fd,0xce3abdb8,0xd67bc619,0xe6fdc5f9,0xc619c63a,0xce5ac639,0xad36b5b7,0xb5b7b597,0xc619b597,0x9cf4b597,0xe71def5e,0xb5b7b576,0xb5979493,0xbdf8e73d,0xc6199cf4,0xad55b597,0xad56a535,0xc619ad76,0xad76ad35,0xa535b576,0xb5b7b576,0xe73ec639,0xdefcc5f9,0xc63aef5f,0xdefdc63a,
-0xef7fd67b,0xffdfffff,0xad36ce3a,0xad36b597,0xb577bdd8,0xce3aa515,0xad56b5b8,0xb5b7ad56,0xad76b577,0x94939cb4,0xb597b577,0xa536ad56,0xa515ad36,0xc619a515,0xb597b577,0x9494b577,0xbdd8ad56,0x9cd49493,0x9cf4a515,0xbdd8ad77,0x9cf59cd4,0xad77a4f5,0x9cd4a536,0x9cf5a515,0xbdd8b597,0x94b39cb3,0x9cb4a515,0xb577b577,0xa4f5ad76,0xa5369cf5,0xe71db597,0xce5adefc,
-0xad36b577,0xa536b597,0xb597ad56,0xc619b597,0xb5b7c5f9,0xc639ad36,0xd67ace5a,0xce39ce5a,0xce7abdd8,0xd69be71d,0xad76b5b8,0xd67bbdd8,0xc5f9ce7b,0xad56bdd8,0xbdd8ce39,0xbdd8bdd8,0x9cd4ad56,0xa4f59cb4,0xa535a515,0x8c529493,0xad569cf4,0x94939cd4,0xa515ad76,0x9cf59493,0x9cf4ad56,0x9cd49cf4,0x9cf59cd4,0x94b494b4,0x9cf59cf5,0xa51594b3,0xa53594b3,0x9cf49493,
-0xa535a535,0xa515ad76,0xd69ace7a,0xc639c639,0xb5b7d69a,0xbdf8bdf8,0xad76a515,0xa515ad76,0xa5559d14,0xb5b7b5d8,0xce5aa515,0xad56c639,0xad56ad76,0xbdb8ad76,0x9cb3bdf9,0xad76b577,0x949394b3,0x8c528431,0x8c5283f1,0x8c528c73,0x94939cd4,0x8c528411,0x8c738c52,0x9cf494b3,0xa4f49493,0x949394b3,0x8c728c72,0xce5aad76,0x9cd39493,0x9cf49cd4,0x9cf4a555,0x9cd394b3,
-0xe6fcce39,0xd69bffff,0xce5adebb,0xce5bbdb8,0xe71ec5f9,0xb5b8defd,0xef3ee6fd,0xf79fbdd8,0xb598ce5a,0xb598b5b8,0xbdb8bdd9,0xce3aad77,0xad77c63a,0xad3694b4,0xce7bb597,0xb577bdd8,0xad56b597,0xce5aad56,0xe71de73d,0xc639ce7a,0xf77eef7e,0xbdf8c619,0xce39c619,0xbdf8bdd8,0xa515b5b7,0xad55b5b7,0xbdb7ad35,0xad56a515,0x9cb394b3,0xb577ad56,0xc618c639,0xd69bdedb,
-0xc63adedc,0xb5b7ad36,0xc639b5b8,0xbdd8c619,0xdefce73d,0xbdd8b597,0xc619b577,0xdebcce7a,0xbdb8ef5e,0xc619bdf8,0xc63ad6bb,0xad56ce5a,0xce3aad36,0xb577c619,0xa535ad36,0xbdd8b597,0xad76bdf8,0xf7bfc619,0xd69bdedc,0x9cf4b5b7,0xce7ab576,0xa515bdd7,0xb597ad76,0xa535a535,0xbdd8a515,0xa535b597,0xad76b597,0x9cf4a515,0xdedcce3a,0xad36c619,0xce5ad67b,0xc619bdd8,
-0xffffe71d,0xb5b8ce5a,0xad57bdf9,0xbdb89cd4,0xa516ad56,0xa5369cd4,0xb597bdd8,0xad76ad56,0xad56bdf8,0x9cb4a515,0xbdb8ad56,0xa536bdf8,0xc5f9ad77,0xa4f59cd4,0xb597bdd8,0xad36ad77,0x8c738c53,0xa536ce5b,0xb5779493,0x94b49cd4,0x94b4a536,0xa5359493,0xa515bdb8,0xad56a4f5,0xad369473,0x9493b5b8,0xa5359cd4,0xb5b88c73,0x9cf5ad77,0xa515ad56,0xdefcad77,0xf79fffff,
-0xa515b597,0xad36ad76,0xa535b577,0xb597bdb8,0xc619ce3a,0xa4f5a4d4,0xce19c5f8,0xc619d69b,0xc5f9ce5a,0xd69bce3a,0xad56c5f9,0xb597ad76,0xc619b5b8,0xb597bdd8,0xc619b5b7,0xce5ad69b,0xad56bdd8,0xad56a535,0x9cd4bdd8,0x9cd49cd4,0xa5159472,0x9cd4ad76,0xad56a535,0xb5b7a515,0xa535a535,0x9cf4a515,0x9cf59cd4,0x94b39cd4,0x9cf4a515,0x9cd494b3,0xad5594b3,0x9cf4ad56,
-0xad76ad56,0xad56a535,0xc618b5b7,0xbdd7bdf8,0xdedcce59,0xc619ce7a,0xad56ad76,0xa535a515,0xa555ad96,0xb5b7ad76,0xad76b597,0xbdf8defc,0xb597a515,0xb577ad56,0xce5ac619,0x9cf4a515,0x8c72a4f4,0x8c529493,0x84317bd0,0x84118c73,0x8c528c32,0x8c728c73,0x9cd49493,0x9cf49493,0xad56ad36,0x9493a4f4,0x94b39493,0xbdf8ad56,0x94729493,0xa5159493,0xa515ad76,0x9cd49cf4,
-0xce5ace7a,0xffffdefc,0xc619d6bb,0xb5b8bdb8,0xce7be6fd,0xdedcd69b,0xdedcce5a,0xce5bffff,0xc5f9d67b,0xb577bdb8,0xbdf9ce5b,0xc61ac63a,0xb597b5b8,0x9493a536,0xb597a515,0xb597b5b7,0xb576bdb8,0xb576b597,0xd67ace5a,0xe71dd6bb,0xef7ed69b,0xc5f8ce39,0xb5b7b597,0xb597c639,0xb576ad76,0xad55ad55,0xce5ab597,0x9cb3bdd8,0x9cd48c31,0xb597bdd8,0xdefcc619,0xdefcb597,
-0xd67bf77f,0xb597bdd8,0xb597c619,0xad56ad76,0xe71def3d,0xb597b597,0xbdd8bdb7,0xc619b5b8,0xe71ddefc,0xce5ab597,0xf7bfdedc,0xc619c5f9,0xa515ad77,0xbdd8b597,0xad76a536,0xad76c5f9,0xd6bbce7a,0xc619bdf8,0xce7af79f,0xa515c619,0xbdd8a4f4,0xbdd7d6bb,0xce7ab5b7,0xa535c619,0xb597a515,0xb576bdd8,0xc619b597,0xad56ad76,0xce5ab577,0xc619d67b,0xb597ad56,0xf77fdedc,
-0xc63aef7f,0xce3ab597,0xc5f9ce5a,0xad77ad56,0x9cb4a516,0x9cb49cf5,0xad56a515,0xad56b597,0xa536b597,0xad56b577,0xa515a515,0xb597b597,0xbdf9b577,0xbdd8bdd8,0xb5779cf4,0xad56ad56,0x9493ad56,0xdebca4f5,0xa515b597,0x84329cb4,0xad779cd4,0x8c529493,0xc619a4f5,0x8c73b5b7,0x84119cb4,0xc6199cd4,0x949394b4,0xa515a515,0xad76ad56,0xa515a515,0xc619c619,0xf7bfe71d,
-0xad56d6bb,0xb597b577,0xb597bdb8,0xb597ad56,0xc5f9bdf8,0x9cb4ad56,0xc5f9b577,0xbdb8ce19,0xc619bdd8,0xce5ac619,0xb597ce5a,0x9cd4a515,0xa4f59cd4,0xc5f9bdb8,0xc639b576,0xd69bc619,0xad36bdb8,0x94b4ad56,0x94b394b3,0x94939472,0x94b39cb3,0xa535a535,0x9cd494b4,0xad76ad56,0x9cf49cf4,0x9cf4a515,0x9cf49cf4,0x949394b4,0x9cf594b3,0xa5159cd4,0xa4f4ad55,0xb5b7ad35,
-0xb5b7b5b7,0xad55ad76,0xad76ad76,0xbdd7be18,0xbdf8bdf8,0xc639ce7a,0xb597c619,0xad769cf4,0xad76ad56,0xa535a535,0xb597c619,0xdedcad56,0xa535b597,0xa535a535,0xbdd8ad76,0xa515bdd8,0x9472a535,0x84118431,0x7bf08c31,0x84118431,0x8c528431,0x9cd49493,0x94939493,0x949394b3,0x9cb49cd4,0x9cd49cb3,0x8c729493,0xad56ad56,0x7bf07bd0,0xa5358431,0xad56b597,0x94b3a535,
-0xbdd7ef7e,0xef5ebdb7,0xc619ffff,0xc5f9b577,0xdedcbdf9,0xffbfdebc,0xc619dedc,0xef7fe6fd,0xce3abdf9,0xc619ce3a,0xc61abdb8,0xb597c619,0xb597ad77,0xad77b5b8,0x9493ad36,0xa53594b3,0xb576a535,0xb597b576,0xc639bdd8,0xce5ad6bb,0xc619c639,0xd6bbe71d,0xb5b7c5f8,0xc619b5b7,0xb576b5b7,0xad76ad56,0xc5f8b576,0xbdb7b597,0x83f09cd4,0xce39c619,0xc639bdd8,0xad35bdf8,
-0xd6bbd6bc,0xb597c5f9,0xb597a515,0xa535a515,0xbdd8e71d,0xbdd8b576,0xbdd8bdd8,0xbdf8b597,0xd67bc5f9,0x9cf4ce5a,0xd69bce3a,0xbdf9d69b,0xa536c619,0xc619b5b8,0xb5b8bdf9,0xad77b577,0xef5ed69b,0xb597ce5a,0xdedcbdf8,0xbdd8defc,0xad56a515,0xc5f8bdd8,0xa4f4bdd8,0xad76bdd8,0xbdd8b597,0xbdd8ce7a,0xbdf8bdd8,0xc5f8c5f8,0xbdf9ad36,0xce5ac619,0x9cb4bdf9,0xc619b597,
-0xa515a515,0xdefdc5f9,0xbdd9dedd,0xad77b598,0xa5159cd5,0x9cf5a4f5,0xad77ad56,0xb597ad56,0xa536ad56,0xb597ad56,0x9cb4a4f5,0xc63aa515,0xad76c619,0xd69bb5b7,0xad56b597,0xa535b597,0xa535bdd8,0xbdb88c72,0xa515ffbf,0x94938c73,0xa4f59493,0x8c72a4f5,0xad5694b4,0xa515c5f9,0x949394b3,0xad568c52,0x8c52bdd8,0xa4f59cd4,0xbdb8ad36,0xb597b577,0xad76b5b7,0xbdf8bdf8,
-0xc639d6bb,0xb597bdb8,0xbdd8b577,0xb577c5f9,0xbdb8bdd8,0xad76bdb8,0xd65abd97,0xbdb7c619,0xc5f9b597,0xbdd8c5f9,0xbdd8bdd8,0xa4f5b597,0x94b394b4,0xce7aad56,0xbdb7c619,0xbdd8b597,0xc619ce5a,0x9493ad56,0x8c318431,0x94b38c72,0x9cf49cd4,0x9cf49cd4,0x94b4a515,0xa5159cd4,0x9cf4a515,0x9cf49cf4,0xa515a515,0x94b49cf4,0x94b39493,0xa5359cd4,0xad35a535,0xa535ad35,
-0xb5b7a535,0xad55a535,0xa535a535,0xb597ad76,0xbdd8b597,0xc639b5d7,0xbdd8bdf8,0x9cf4a535,0xa535a515,0xad56a535,0xbdf8ad56,0xad76ad76,0xad76d6bb,0xad56a535,0xad56a515,0xad76b597,0x94b39493,0x84118c31,0x84318411,0x84318c32,0x8c528c52,0xa4f59493,0x949394b3,0x8c729cd4,0x94738431,0x94729cd4,0x94b39cb3,0x9cd494b3,0x630d6b4e,0x8c728431,0xb597b5b7,0x8c72a535,
-0xbdd8ce7a,0xc639b597,0xf7bfef5e,0xbdf9ce5a,0xd69bbdb8,0xd69be73e,0xe6fdffdf,0xdebcad36,0xad56dedc,0xe71ebdd9,0xbdf9e73e,0xc619c619,0xbdd8b597,0xb597c619,0x94b3a515,0xa515a4f4,0xa4f494b3,0xad56bdb7,0xc619a535,0xce5ac639,0xdefcdedc,0xef5ece7a,0xbdd8defc,0xc619ad76,0xbdf8c639,0xad76b576,0xad56ad56,0xbdb8a4f5,0x8c52b5b7,0xce3a9493,0xb597d67a,0xad56ad76,
-0xbdb88c73,0xc619dedc,0xa515b576,0xc5f8b5b7,0xad55ffff,0xd69bb5b7,0xbdd8ce39,0xbdf8bdb7,0xc619bdb8,0xc619c619,0xce7ab597,0xd69bd69b,0xc63aad56,0xad76bdf8,0xd67bce7a,0xad36b597,0xdefcb5b7,0xbdd8ef5e,0xbdf89cd4,0xd6bbf79f,0xa535bdb7,0xce399cf4,0xb5b7c5f8,0xce7aad55,0xd67abdf8,0xbdd8c639,0xbdd8c619,0xb597b5b7,0xad569cf4,0xb597ad56,0xc5f9c619,0xad56b577,
-0xb597b577,0xce5aad56,0xb577d69b,0xc5f9c619,0xb577ad57,0xad77a536,0xa536ad77,0xb5979cf5,0xb577b597,0xad77ad36,0xad36ad77,0xad369cf5,0xc619bdd8,0xa4f5a536,0x9cd4a4f4,0xbdf89cb3,0xd67bb5b7,0x9473ad56,0xd6bcb577,0x9493ad36,0x8c32a536,0xad769473,0x9cd4a515,0xc6199cd4,0xa515ad77,0x94939cd4,0xc5f9a535,0x9cd4a515,0xad36ad56,0xb597b597,0xbdf8b597,0xa515ad56,
-0xdedca515,0xa4f5d6bb,0xc619b597,0xb597bdf9,0xbdb8bdd8,0xb597b597,0xbdd8b597,0xd67bce7a,0xc5f9bdd8,0xc5f9bdd8,0xad36ce5a,0xd67b9cd4,0x9cb4b597,0xce5a9cd4,0xbdf8d69b,0xbdb7ad56,0xce7ace7a,0x9cb3bdd8,0x8c528c52,0x9cd49493,0x9cd494b3,0x9cd4a515,0xa535a515,0x9cd49493,0x9cf49cf4,0x9cd49cd4,0xa5159cf4,0x9cf5a515,0x9cd4a515,0xa5359cf4,0xad76ad35,0x9cd4a515,
-0xad55a515,0xad96ad76,0xad55ad76,0xad76a555,0xbdf8b5d7,0xad76b597,0xad76c619,0xa515a535,0x9cf49cf4,0xa515a515,0xb597a515,0xad76bdf8,0xd67ab576,0xa515b5b7,0xad55ad55,0xa514a515,0x8c51a514,0x8c729492,0x8c728c52,0x8c528c52,0x94938c72,0x9cd49cd4,0xa515a535,0x8c728c72,0x8c729493,0x9cd48c72,0x9cd4ad35,0x94939cf4,0x73af632d,0x94b37bf0,0xad76a535,0x9d14ad55,
-0xbdf8c639,0xbdf8ce5a,0xef3ebdb8,0xd6bcffff,0xc5f9bdd8,0xd6bbd69b,0xf77edebc,0xbdf8dedc,0xc63abdd8,0xe6fdce3a,0xdebcffdf,0xd69bc5f9,0xbdb8ce3a,0xad56b597,0x9cd4a515,0xad56ad56,0xad56a515,0xad56b576,0xb5b7b5b7,0xb576b5b7,0xce7ad67a,0xc639c5f8,0xd6bbe71d,0xc619ce39,0xce7ace59,0xad56b597,0xa515ad36,0xad36a4f5,0xb5977bd0,0xbdb88c52,0xce7adefc,0xb576ce7a,
-0x94939cd4,0xdefcce39,0xa535bdd8,0xf79f9cf4,0xa515e6fc,0xbdf8a535,0xbdf8ce5a,0xc619bdd8,0xc639c63a,0xd67bc639,0xad56d69b,0xce5ace5a,0xbdb8c619,0xbdf9e6fd,0xc619ad56,0xad36b597,0xad769cb3,0xd69be73d,0xbdb7b576,0xdedcbdf8,0xc5f8e71d,0xbdd8b5b7,0xbdb7ce5a,0xb5b7b596,0xc619c619,0xce7ac639,0xb597ce39,0xa515bdf8,0xa535ad56,0xb597ad36,0xe73ebdb8,0xa536d69c,
-0xc639b597,0x9cd5ad36,0xbdf9bdb8,0xc61ab597,0xc619d69b,0xbdd8b5b8,0xa536b597,0xad56a536,0xbdd8ad77,0xb577c5f9,0xad56ad56,0x9493ad56,0xbdf89cd4,0xa536bdd8,0xb5b79cf4,0xb5769cd4,0xbdf9ce3a,0xa535e71d,0xb5979cd4,0xb577d6bc,0x9cd49cd4,0xb5779cd4,0x8432b577,0xb5979cd4,0xad56d6bb,0x9cf4a4f5,0xbdb89cb4,0xa4f5ce7a,0xad569cf4,0xa5159cf4,0xb5b7c619,0x9cf4ad56,
-0xb5b89cf5,0xce5ae71d,0xad77b577,0xbdb8ad56,0xad56a4f5,0xc5f9bdb8,0xb577c619,0xce39b597,0xc63ace5a,0xb597bdd8,0xbdd8c619,0xb577a515,0xad56c619,0xbdd8a4f5,0xd69bce7a,0xb5b7b597,0xb597bdb8,0xb597c619,0x9cd48c52,0x9cd49cd4,0x9cf4ad56,0xad56a535,0x9cf49cd4,0x94b49cf5,0xad56a515,0x9cf4a515,0xad569cf5,0xb597b5b7,0xad76ad76,0xa535b597,0xa515ad56,0xad359cf4,
-0x94929cf4,0xa514a535,0xa514ad56,0xa535ad56,0xad76b596,0xa535a514,0xb5b7b597,0xb5b7a515,0x9493bdd8,0x9cf49cf4,0x9cf49cd4,0xce5aad76,0xb5b7ad56,0xb576c639,0xb596a515,0xa515ad55,0xa535a535,0x94729cb3,0x84318c52,0x8c529cf4,0x94b38c52,0x949394b3,0xa535a515,0x94b39cf4,0x8c729493,0x9cd49493,0xad56b597,0xa5159cb3,0x8411738f,0x94b38411,0xa535a535,0xad96b597,
-0xb5b7ce7b,0xd69bc61a,0xbdf9c619,0xe6fdd69b,0xd6bcce5a,0xc63adebc,0xdebbce7b,0xdebbef5e,0xb5b8b577,0xc619d69b,0xe6fddedc,0xbdd8ce5a,0xce5ad69b,0xad76ad76,0xb5b7a515,0x9cd3ad56,0xa4f49cf4,0xb597b597,0xbdd8bdd8,0xbdd8bdd8,0xc639bdd8,0xce5ac5f8,0xef7ece39,0xbdf8d6bb,0xbdf8c619,0xb5b7c639,0x9cf4ad36,0x94938411,0xb5978411,0xad36a515,0xc63abdb8,0xc63ac619,
-0xad35c619,0xd6bb9cd4,0xad56ce5a,0xf79ead56,0xad35ce59,0xad76b5b7,0xce7abdf8,0xc619c619,0xc619bdf9,0xbdb8bdd8,0xd69bc619,0xdedcb597,0xad76e71d,0xd69bbdb8,0xa515bdf8,0xbdd8c5f9,0x9cf49cd4,0xdedcad56,0xc619e71d,0xbdf8bdd8,0xd69bdedc,0xa515ce5a,0xbdd8b597,0xbdd8b597,0xb5b7a535,0xdebbd69b,0xb597f79f,0xbdd8b576,0xbdd8ad76,0x9cf5b577,0xb577a515,0xbdd8ce3a,
-0xa5359cd4,0xbdd9c63a,0xad56ad77,0xdedcad36,0xd69ce6fd,0xa515b5b8,0xad57a536,0xad77a536,0xb598ad36,0xb597c5f9,0xa4f5a536,0xb597bdd9,0x9cf59493,0xbdd8bdb8,0xad76ad35,0xad56b597,0xbdd8ad56,0xffffb597,0xa515c5f9,0xdebcbdd8,0xa515b597,0x94b49cf4,0xad369cd4,0x9cf59493,0xce7bb597,0xa4f594b4,0x9cb4ad36,0xbdf9ad56,0x9cf4a515,0x9cf4bdb8,0xb5b7a515,0x9cd4b597,
-0xad56ad56,0xdefcc639,0xad56bdd8,0xb5b8a515,0xad76b597,0xb5b7b597,0xb597bdf8,0xbdd8ad56,0xd6bcc63a,0xa535bdf9,0xad76b577,0xad369cf5,0xd67bbdd8,0xb597bdd8,0xce5ac5f8,0xad56ce7a,0xad35ad76,0xce5ab597,0xa515a535,0xad76ad56,0xad76b596,0xad56a535,0x94b39cf4,0xa5159cd4,0xa536a515,0xa515a515,0xad56a515,0xbdd8b5b7,0xb5b7bdd8,0xad76bdd8,0xa514a514,0x94b3a515,
-0x94929cd3,0x9cb394b3,0xa5359cd3,0xa535ad35,0xad35a514,0x9cf4a4f4,0xad56ad56,0xad56bdd8,0xb5b7c639,0x94b39cd4,0xa535a515,0xb597a535,0xb596d6bb,0xce5aad55,0xb596ad76,0xad55b597,0x9cd4a515,0x9cd4ad55,0x8c528c72,0x9cf48c52,0x94728c52,0x94938c72,0xa51594b3,0xa535b597,0x9cb38c52,0x94b39cd4,0xa5159cd4,0xad56b576,0x7bf08c52,0x94b38451,0xbdf8a514,0xad76ad76,
-0xdefcd69b,0xc619c5f9,0xc63abdf9,0xc63ac63a,0xce5bf77f,0xc5f9ce5a,0xe73dce5a,0xe73def7e,0xbdd8d6bb,0xd6bcbdd8,0xbdf9bdb8,0xd6bbdedc,0xce5ace7a,0xb597bdf8,0xad56ad76,0xad56b576,0xa515ad36,0xc619ad56,0xbdf8c619,0xa535c619,0xce7abdf8,0xce5ac639,0xce5ace5a,0xce5af77e,0xad56b5b7,0x9493a515,0x9cf49493,0x8c729cb4,0xc5f9b577,0xa515bdd8,0xa51594b3,0xc5f9b597,
-0xce5ace5a,0xa4f4c619,0xce5ab5b7,0xffffdefc,0xc618b597,0xb576b5b7,0xce5ac639,0xc639d6bb,0xb5b7c619,0xbdd8b597,0xdefcbdd8,0xb597ffbf,0xce5ace5a,0xad56b577,0xa535ce7b,0xc6199493,0xad76bdb7,0xad76a535,0xdedce71d,0xc639bdd8,0xd6bbc619,0xad76c639,0xbdd8ad56,0xbdd8c619,0xa515ad56,0xffffbdf8,0xd69bffff,0xad56a515,0xce5ab576,0xad77bdd8,0x9cd4ad36,0xce5ab577,
-0x9cd4bdf8,0xce3ac61a,0x8c739cd4,0xdebcc619,0xdebcc61a,0xd69be73e,0xb598ad77,0x9cf5a515,0xa515a536,0xbdb8a515,0x9cf5b597,0xb5b8b577,0xa515ad36,0xad76ad56,0xb5b7a515,0xbdd8a515,0xa5159cf5,0xbdb8b597,0xbdd8d69b,0xbdd8b577,0xb5b8dedc,0x8c529493,0x9cd49493,0x9cd4a515,0xa5159473,0x94b4bdb8,0x9cb49493,0xa5159473,0x9cb4b5b7,0xad56a515,0xbdd8a515,0xa536dedc,
-0xa536ad77,0xb5b7c619,0xd69bbdf9,0xb5b7bdf8,0xbdd8bdf9,0xbdd8ad56,0xad35ad56,0xb597ad76,0xd6bcc63a,0xc619ce7b,0x9cf4b597,0xb597a4f5,0xc5f9b597,0xb597ce5a,0xb597bdd8,0xbdd8c639,0x94938c72,0xa535a515,0xb597b597,0xc618b576,0x9cf49cf4,0xad35ad76,0x94938c72,0xa5159cd4,0xa515ad56,0xad56a515,0xa535ad76,0xb597ad76,0xbdf8bdf8,0xbdf8b596,0xa4f4b596,0x9cb39493,
-0x9cd39cb3,0x8c5294b3,0xa515a514,0xa514a515,0xa514a535,0xad55ad55,0xad56a535,0xb5b7b5b7,0xc63aad76,0xa515ad56,0xb597b5b7,0xad76ad56,0xc639bdd7,0xa515ad56,0xb596c618,0xa514ad55,0x94b39cd3,0xad769cd3,0x94b39cd4,0x8c3194b3,0x94939493,0x8c729cd4,0x9cd49493,0xa535a515,0x949394b3,0x8c729493,0x9cf48c72,0xce7ab5b7,0x8c728c72,0x94b39493,0xa535a535,0xad55c618,
-0xc63ac639,0xb5b7ce5a,0xc619ce5a,0xc5f9ce5a,0xf79fdedc,0xd69bce5a,0xd69bdedc,0xf77eef7e,0xce5ae73e,0xb5b8b577,0xce5ad67b,0xdedcd6bc,0xd6bbdedc,0xb5b7ce5a,0xb5b7a535,0xad56c619,0x9cd4ad35,0xbdb7b577,0xd69bbdf8,0xce5ad67a,0xad56b597,0xd69bc619,0xce5ad69b,0xdedcbdd8,0x9cd4c619,0x94728c52,0x94b39cf5,0xa5159cb4,0xa535a515,0xbdb8ce3a,0x9cf4c63a,0xbdf8a535,
-0xc639c639,0xb597ce39,0xc6399cd3,0xffffffff,0xbdf8ce59,0xc619e71c,0xce39bdb7,0xc619c639,0xb597b597,0xbdb8b577,0xb5b7bdd8,0xe71de71d,0xc639ad56,0xbdd8c639,0xc5f9c5f9,0xad3694b3,0xc5f9dedc,0xb597b577,0xd69bb5b7,0xb5b7d69b,0xdefcdedc,0xbdd8debb,0xad56ad76,0xc639bdf8,0xad76c5f8,0xdedcad76,0xce39b5b7,0xad56b5b7,0x9cb39cd4,0xad569493,0xb5b8c619,0xad77bdb8,
-0xb597c619,0xce5abdf9,0xb597c61a,0xe71eb577,0xce3ae6fd,0xf7bfef5f,0xa536bdf9,0xad56b5b8,0xad37a536,0xa516b578,0xa4f5ad36,0xce5ab577,0xad56c619,0x9cf49cd4,0xb597a515,0xa515b597,0x9494b577,0xad77a515,0xd67bbdd8,0xa515ad56,0xe71dbdf8,0x8c72ad56,0x9cb49cf5,0xad568c32,0x94b494b4,0xad5694b3,0x947394b3,0x9cd4a515,0xd67b9cd4,0xa515ad56,0xa536ad76,0xbdf9bdd8,
-0x9cd494b4,0xb5b8ad77,0xbdf8ad56,0xad76bdf8,0xb597b5b7,0xbdd8bdf9,0xb597bdf8,0xbdb7ad56,0xc619bdf9,0xc619c63a,0xad56bdf9,0xb5b7b577,0xad56b597,0xd69bb5b8,0xb576c619,0xc619b597,0x94939cf4,0x9cd494b3,0xc619ad56,0xbdf8ce7a,0x94729cf4,0xad56a515,0xa4f494b3,0x8c72a535,0xad568c73,0xa536ad56,0xb597a535,0xad56ad56,0xad56ad55,0xad55ad56,0x9cd3a535,0x8c529492,
-0x94728c72,0x84319492,0xa4f49492,0xa5159cf4,0xa535a535,0xa535a535,0xa515a515,0xa5359cf4,0xad56c5f9,0xb597c619,0xb597a515,0xb597bdd8,0xb597b5b7,0xa514bdf8,0xbdd7a535,0x9cf4a535,0x94929cd4,0x9cb39493,0x8c72ad56,0x94b38c72,0xa5158431,0x8c729493,0x9cd49cf4,0x9d1494b3,0x9cf4b597,0x94939cd4,0x94939493,0xd69ba515,0x9cd4b597,0x8c5294b3,0xa5149cf4,0xb5b79cf4,
-0xbdf8ffdf,0xd69bc639,0xbdf9bdd8,0xce7bd69b,0xdebcbdd9,0xce5affff,0xd6bbbdf8,0xffffdefc,0xdedcef7e,0xbdd8d6bc,0xce7bc619,0xdedcc619,0xbdd8d69b,0xce5ac619,0xbdd8c5f8,0xce39ce5a,0xbdd8d67a,0xbdd8ad36,0xc619c639,0xd69bce7a,0xb576dedc,0xbdd8c5f8,0xd69bce5a,0xbdf8bdd8,0xa535c639,0x94939cf4,0xad569cf4,0xa4f59473,0xad36b577,0xc63ab5b7,0xbdf9e71d,0xb597ad56,
-0xc619c619,0xbdf8debb,0xa535c639,0xe71ddebb,0xc639debb,0xef5ddebb,0xc639c619,0xce5ac619,0xbdd8c619,0xbdd8c619,0xad36b577,0xdedcc5f9,0xa535d69b,0xd69bce5a,0x9cf5b597,0xbdb8b5b7,0xd69bad56,0xa535bdd8,0xb597ad36,0xce7ac619,0xf7bfe71d,0xc5f8b5b7,0xbdb7bdb7,0xb597ad56,0xc639bdf8,0xbdf8bdf8,0xd69bce7a,0xad76e71d,0xa515a4f4,0xad77ad56,0xd69bce5a,0xbdd8bdb8,
-0xce3ad67b,0xd69bdebc,0xd69bc63a,0xbdd9ce3a,0xe6fddebc,0xd67bce7b,0xad56ce5a,0xb598a515,0xad57a4f5,0xa536a516,0xa4f5ad36,0xad77ad56,0xb577c63a,0xad56ad36,0x9cd49cd4,0xad76a515,0xd67bb597,0xa4f5ad56,0xb5b8ad77,0xbdd8d69b,0xc619a515,0xb597e73d,0xad56a535,0x9493a4f5,0x9cd4a515,0x94939473,0xa515bdd8,0xb5779cd4,0xbdd89473,0xa515f79f,0xa535a515,0xc619a515,
-0xad76c63a,0xa5359cf5,0xbdf8bdf9,0xc63abdf8,0xb597ad56,0xbdf9b5b7,0xb597bdf8,0xa535a515,0xbdd8bdd8,0xce7bce7a,0xb5b8c619,0xb597ad76,0xbdb8b597,0xbdb8ad76,0xb5b7dedc,0x9cd4ad56,0xb5b7ad76,0x94939cd4,0xad769cf4,0xce7ad69a,0xad56a514,0xa5359cf4,0xad76ad76,0xad56b597,0xb597a515,0xad77b5b8,0xad76ad76,0xad56bdd8,0x9cf49cf4,0xa5149cf4,0x94939cb3,0x8c518411,
-0x94728c72,0x8c518c72,0xa51594b3,0xa514a515,0xa514ad55,0xa514a4f4,0x9cd4a515,0xa5359cb3,0xc63aa535,0xbdf8a535,0xa515bdd8,0xc619b597,0xb5b7bdd8,0xb5b7ad35,0xbdd7b576,0xa535bdd7,0x94b394b3,0x9cd38c72,0x9cf49cb3,0x9cd48c72,0x8c52a535,0x8c72a515,0xa5358431,0x94b39493,0xb5979cd4,0x9cf4bdb7,0x9cd49493,0xc639ad56,0xbdd8b5b7,0x9cd39cf4,0x9cd39cf4,0x9cf4ad56,
-0xffffffff,0xd6bbce7a,0xbdb8ce5a,0xd67bce5b,0xce3ab577,0xef5ed69b,0xbdd8c619,0xc63ad6bc,0xe6fdef3e,0xd67be71e,0xb597c5f9,0xbdf9c5f9,0xce5abdd8,0xbdb8d69b,0xc619bdf8,0xc5f8c619,0xef5ece7a,0xdebcf79f,0xce5ac619,0xd69bce5a,0xd6bbd6bb,0xa515b597,0xd69bbdd8,0xb597bdb7,0xa515a535,0x9cd4a515,0x9cb4a515,0xa4f5ad56,0xad56ad36,0xbdf8a536,0xbdd8ce3a,0xce3ad69b,
-0xdedcce7a,0xce7ac619,0xc639ad76,0xc619defc,0xdedbef5d,0xd67ace7a,0xd6bbef7e,0xbdf8bdd8,0xbdb8ad56,0xf79fdebc,0xdedcd69b,0xf79ff77f,0xffdff79f,0xbdb8c5f9,0xc619ce7a,0xbdd89cf4,0xad77b597,0xbdf8c619,0xa515a515,0xc619ad77,0xef3ec619,0xa4f4b597,0xc5f9bdb8,0xad56c619,0xbdf8a535,0xc619c619,0xdebbc619,0xbdf8debb,0xb597ad76,0xbdd8c619,0xbdd8b577,0xbdf9bdb8,
-0xbdf9f79f,0xe6fddedc,0xd69bce5a,0xa536c5f9,0xe6fec61a,0xbdd9ce3b,0xdefddedc,0xa536ad77,0xad57ad77,0x9cb5a4f5,0xb577a516,0xbdb8ad77,0xc619ad77,0xad36a515,0x9cd4ad36,0xb597ad57,0xad56bdf9,0x94b4bdd8,0xb5979494,0xef3ebdd8,0xa515ad77,0xe6fdbdd8,0xad56ad56,0x94b39cb4,0xa536a536,0x8c7394b4,0xce5aa515,0x94939cf5,0xa515b5b8,0xe71ebdd8,0x9cf59cd4,0x9cf5ad77,
-0xb5b7ad76,0xa5359493,0xbdd8c619,0xd69bc639,0xb5b7ce5a,0xbdf8ad56,0xb5b7b5b7,0xad76bdf8,0xc63ab597,0xd69bbdf9,0xbdd8ce7a,0xb5b7b597,0xc5f9b5b7,0xa535ad76,0xd69bbdd8,0x9493ad56,0xad769cd4,0x94b3b597,0x94938c72,0xbdd8a515,0xbdd8d69a,0x9cf4b597,0xb597ad56,0xad56ad76,0xad77a536,0xbdd8bdf9,0xbdf8b5b7,0xa535a535,0x9cd49cd4,0x9cb39cd3,0x84109cb3,0x8c728c51,
-0x94728c51,0x8c529492,0x9cd48c51,0xa514ad76,0xad55ad55,0xad35ad56,0x9cd4a515,0xa4f49cb3,0xad76a515,0xb597debb,0xc639c619,0xc619b576,0xad55c619,0xad76ad56,0xb5b7bdd7,0xad35b5b7,0x94928c52,0x94b394b3,0x94939493,0x9cb3a515,0x9cd4b597,0xa4f48c52,0x94b39cd4,0x9cf49cf4,0xa5159493,0xbdd8bdf9,0x94b39493,0xc639bdf8,0xbdd8a535,0xa535bdf8,0xa5359cd3,0xa514a514,
-0xef5ebdd8,0xce5affff,0xce3ace7a,0xa5368c52,0xbdb8b5b8,0xce5aa536,0xb597debc,0xb597bdd9,0xf7bfc619,0xdebcd69c,0xb597ce5a,0xd69bb5b8,0xc639bdd8,0xce5ae6fd,0xbdf8bdd8,0xce7ace3a,0xce5adedc,0xffdfffff,0xbdd8ad76,0xce7ace5a,0xc639b5b7,0xad76bdf8,0xb5b7ad56,0xad76c619,0xad56ad76,0x9cf4ad76,0x949394b3,0xc6199493,0xbdf8ce3a,0xad56ad56,0xce5adedc,0xef5ebdf8,
-0xce7adedc,0xad56debb,0xe73dc5f8,0xa535ce5a,0xffdfdebb,0xce59defc,0xf79fd69b,0xb597ce7a,0xb597bdb8,0xd67bd69b,0xd69bd69b,0xffdfdedc,0xfffff7bf,0xc5f9ffdf,0xe71dd69b,0xf7bff77f,0xad76ef5e,0xd6bcad76,0xb597ce5a,0xbdb8b5b8,0xce5ac619,0xbdf8b576,0xb597a535,0xb597ce39,0xad769cd4,0xe73dc5f8,0xd67adebb,0xdefce73d,0xb597b5b7,0xb597ad76,0xad56b577,0xb597a4f5,
-0xb597b5b8,0xef3ed69b,0xdefde71d,0xbdb8d69c,0xc5f9bdf9,0xce5bce5b,0xd6bcce5a,0x9cf5c63a,0xad57ad37,0xa516a516,0xad56b597,0xc619bdd9,0xbdf9c619,0xbdf9ad57,0xa515a515,0xb577ad36,0xb597ad57,0xad369cf5,0x8c529cd4,0xc61ab577,0xad36ef5e,0xb597a536,0xb597defc,0xad77a515,0xbdb8b597,0xa515bdb8,0xad5694b4,0xa536ce5a,0xb5b8a536,0xce5ab597,0x9cf5ffdf,0xbdf9ad56,
-0xa5369cf5,0xa515b597,0xad56ad56,0xbdf9bdd8,0xc639d6bc,0xb597b597,0xc619c619,0xce7ad69b,0xc619ce5a,0xdedcce5a,0xc63ac63a,0xc619c63a,0xc5f9bdd8,0x9cd4b597,0xbdd8a515,0xb576ce39,0x94b39cd4,0xbdd8c639,0x8c529493,0xad559cb3,0xce59ef7e,0xad56ce5a,0xad769cd4,0xad76bdd8,0xb5b8b5b8,0xc639bdd8,0xad56ad76,0x94939cd4,0x949394b3,0x9cd39cd3,0x8c529472,0x8c7283f0,
-0x8c519472,0x94728c72,0x94728c72,0x9cf49cd3,0xb576ad35,0xad76bdb7,0x9cf4a515,0xa4f49cd4,0xad35a515,0xd69bce39,0xce7ab597,0xb576ce5a,0xbdf8bdb7,0xad56b596,0xb597ad76,0xa514ad55,0x94939cd4,0x94b394b3,0x94938c52,0xa5159493,0x8c728c72,0x9cb39cf4,0x9cd4ad56,0xad569493,0x94938c52,0xb597a515,0xa515ad76,0xce7ab5b7,0xa5359cf4,0xc619bdd7,0xa514a555,0xa535a535,
-0xd69adebb,0xffffffff,0x9cd4ad76,0xad36bdb8,0xb577c61a,0xa516ad77,0xce5abdf9,0xbdf9b597,0xc63ac63a,0xce5ad69c,0xdebcd69b,0xc5f9c63a,0xbdd8defd,0xdebcc619,0xd67bd69b,0xc619c619,0xbdb8d69b,0xe73dd69b,0xb5b7b5b7,0xbdd8c619,0xad76bdd8,0xb5b7c639,0xa5359cf4,0xc619bdb7,0x9cf4ad76,0xa53594b3,0x94729493,0xc5f9a515,0xbdb8c619,0xb5b7bdf8,0xd69bc5f8,0xbdd8c619,
-0xd67bef7f,0xc619b576,0xffffd6bb,0xce5ae73d,0xef5db596,0xdedcf77e,0xd69bdebb,0xbdf8defc,0xbdd8c619,0xad77bdd8,0xbdf8ad56,0xce5ab5b7,0x9cd4bdf8,0xc5f9b5b8,0xbdf9b597,0xffffd69b,0xd6bcdedc,0xc63ace5a,0xce7bd6bc,0xbdd8bdf8,0xd69bb5b8,0xb597c5f9,0xad56bdd8,0xad56c5f8,0xbdb8b597,0xce5ab597,0xce5ae73d,0xd69bc619,0xad56c639,0xad56a515,0xb5b7b597,0xce5aad56,
-0xce3adebc,0xce5abdd8,0xf79fffbf,0xce3bd69b,0xc61ab5b8,0xe6fdce3a,0xa536dedd,0xc619b598,0xad36a4f5,0xb577ad56,0xa515bdd8,0xb577ad56,0xb577bdb8,0xbdd8b598,0xa536b5b8,0xa515a515,0xb577ad57,0xa515b577,0x9cd4ad56,0xa51594b4,0xe71dce3a,0x9cb49cd4,0xc619ad77,0xa4f5a515,0xad56ad57,0xbdd9ad56,0x9cd49cd5,0xdefdad77,0xad57a516,0xad77ad77,0xd69cbdd8,0xad569cd5,
-0xb5b7b577,0xc619bdd8,0xb597ad56,0xbdd8b597,0xce3ac5f9,0xbdf9d69b,0xc619bdf8,0xc619d6bb,0xce7bd69b,0xdedcd69b,0xc63ace7a,0xd6bbce7a,0xc5f9ce5a,0xa515b577,0xa515ad35,0xce7abdb7,0x94b3a535,0xd6bbad55,0x8431c618,0xb59694b3,0xffffd69a,0xc618ce7a,0xa514ad56,0xbdd8b597,0xc63abdd8,0xb597bdd8,0x9cb3b576,0x9cf494b3,0xa514a514,0x94b39492,0x8c519492,0x8c518c52,
-0x8c519472,0x84108c31,0x94928c51,0x9cd38c71,0xa4f49cd4,0xa515a515,0x94939cd4,0xa51594b3,0xb597a515,0xc619a515,0xb576ce7a,0xbdf8ce39,0xc619a535,0xb576bdf8,0xb597ad56,0xad76b5b7,0xb596ad35,0x94729cd4,0x8c528c72,0x94b48c73,0x9493bdb8,0xa535a535,0x9cf48c72,0x9cf49cf4,0x9cf49493,0xad769cf5,0xbdf8c639,0xd69bc619,0xad76a535,0xc639ad76,0xad55c618,0xa5149cf4,
-0xef5dd6bb,0xffffe6fc,0xc5f8ffff,0xc619a516,0xc63ace5a,0xb577ad57,0xb5b8ad36,0xbdb8c63a,0xbdb8ad77,0xce3abdd9,0xce5bd67b,0xb597c619,0xb577bdb8,0xbdf9ad77,0xe71dce5b,0xc5f9ce7b,0xce5ab576,0xce39ce39,0xbdf8ce5a,0xb5b7b576,0xce5abdd8,0xc639c639,0xb597bdf8,0xb5b7ad35,0xb597bdd8,0x9cf4a535,0xad76ad56,0x9cf4a536,0xb5b8a535,0xbdf8bdb8,0xa5359cf4,0xbdd8bdd8,
-0xce5abdb8,0xb597bdd8,0xffffdebb,0xd69bffff,0xb596c619,0xef5ee73d,0xce39d69b,0xef7ece7a,0xbdf9c619,0xa515ad56,0xb597bdb8,0xce5ac63a,0xb5b7c63a,0xc619ad76,0xb577b597,0xce5ad69b,0xbdd8b5b7,0xb597ce5a,0xd69bb5b7,0xc63ad69b,0xc619bdf8,0xd67bef5e,0xb577b597,0xb5769cf4,0xad36bdd8,0x9cf49cd4,0xc5f8ad76,0xad35ad76,0x9cd4bdd8,0xad569493,0xbdd8b5b7,0xad77b5b7,
-0xdedcc619,0xc619ce5a,0xdefddebc,0xe6fdf77f,0xce5bd69c,0xc61ac5f9,0xb5b8d67b,0xe73ed67b,0xb577bdd8,0xa515ad36,0xb577ad56,0xad56a515,0xbdd8a4f5,0xb577bdb8,0xad36c63a,0xad369cf5,0xa516ad57,0xad36ad57,0xc619a515,0xa5369494,0xc6199cf5,0x9cf5e6fd,0x9cf59cd4,0xa515ad77,0xb597a536,0xad579cf5,0x9cd5b577,0xad578c52,0xbdb8ef5e,0xbdf9ce3a,0xc5f9ad77,0x9cf5defd,
-0xc619ad36,0xbdb8ad36,0xbdd8d6bc,0xce5abdd8,0xad56bdf8,0xdedcce5a,0xbdf8bdf8,0xce5ace7a,0xe71dce5a,0xd69bd6bb,0xbdf8d6bb,0xdedcc619,0xc619e71d,0xbdd8ad76,0xad359cf4,0xbdd89cd4,0x9493bdf8,0x94b38c72,0xad76ad96,0xa53594b3,0xdedcbdf8,0xc619e71d,0xb5b7c618,0xbdf8b5b7,0xc619c619,0xad56bdd8,0xa535a515,0xad56a515,0xad35bdd7,0x9493a514,0x9cd39cf4,0x8c528c72,
-0x83f08c51,0x8c518c51,0x94b28c51,0x9cd394b2,0x9cd49cb3,0x9cf4a4f4,0xa515a4f4,0xad56a535,0xad35b597,0xa535b597,0xd67abdd8,0xc619b5b7,0xb597ad56,0xbdf8c619,0xad56b5b7,0xbdb7b5b7,0xad56ad35,0x9cd4b597,0x8c728c52,0x8c528c52,0xbdb89cd4,0xa5368411,0xa515ad76,0x9cf4ad56,0x9cd494b4,0xad76a535,0xb5b7ad56,0xc639dedc,0xb596a535,0xad76b5d7,0xc619bdd7,0xa535a535,
-0xce59ce59,0xce7ace39,0xffdfffdf,0xc5f9b597,0xd67bc619,0xb577b598,0xa4f6b598,0xc63ac61a,0xad77c619,0xc5f9c619,0xe71ed69c,0xd69bd69c,0xbdb8c619,0xc5f9bdb8,0xdedcc619,0xce7adefd,0xbdd8d67a,0xc619b577,0xd6bbd6bb,0xb5b7c619,0xc619ce5a,0xc619e71d,0xce5ac619,0xad76ad76,0xad96bdd7,0x9cf4ad56,0xb5b79cf4,0x9cd4b597,0xc5f9ad77,0xbdd8bdf8,0xad56a535,0xd69bb597,
-0xb597c63a,0xdedce73e,0xffdfd69b,0xf7bfef5e,0xc639d69b,0xc639b5b7,0xef5ef79f,0xbdf8bdd8,0xbdd8debc,0xad56a515,0xad36a515,0xdebcbdf8,0xc619b577,0xa515c619,0xbdf9ad56,0xef3ece5a,0xbdd8defd,0xd69bc619,0xbdd8bdd8,0xce3ad69b,0xad76b577,0xbdd8b597,0xc5f9c5f9,0xad36a515,0xc5f9bdd8,0xa515a535,0xad56ad56,0xa535b5b7,0xb597ad56,0xad56ad56,0xad56b597,0xb577b577,
-0xbdf8a535,0xce3ad69b,0xc63abdb8,0xffbff79f,0xbdd9ce5b,0xa516bdb8,0xc61ab598,0xc61ac63a,0xc61abdf9,0x9cf5ad77,0xbdd8ad56,0xad57bdb8,0xad56a515,0xc5f9b577,0xbdd8b5b8,0xdefdad57,0xa536a536,0x9cd59cd4,0xa515ad36,0xa4f5bdd8,0xad569494,0xdedcd69b,0x9494a4f5,0xb5b8a515,0xad36a536,0x9cd5ad57,0xc619ad57,0xa4f5ad57,0xef5eb598,0xc5f9bdd8,0x9cf5c63a,0xce5ab598,
-0xbdb8ad36,0xa515a535,0xce5abdf9,0xce5abdd8,0xa515c639,0xd67bad56,0xbdf8defc,0xe73dbdf8,0xce5ad69b,0xce9bdefc,0xbdf8c639,0xc63ab5b7,0xdefcce5a,0xad56b597,0xb597b5b7,0x9cd494b3,0xb597a515,0xa514b5b7,0xb5969493,0xad56ce7a,0xb597b596,0xe6fcc5f8,0xdedbc619,0xc639ef5e,0xce5ace5a,0xa535a515,0xad56a515,0xad76ad55,0xb576b596,0xad76a514,0xa514ad35,0x8c729493,
-0x83f08c72,0xad5594b3,0x9492a514,0x9cd39492,0x9cd39492,0x9cb39cd4,0xad569cf4,0xad56ad56,0xb5b7ad76,0xb5b7ad35,0xbdb7a535,0xb597e71d,0xc619bdd8,0xce5ab5b8,0xa515bdd8,0xa535a536,0xa515a535,0xb5b7a535,0x8c529cb4,0x94938c52,0xa5159cd4,0xa536c63a,0xc619ad56,0xb5b7ad76,0xa535a515,0xad56a515,0xad56a515,0xce5ae71d,0xa555a515,0xad76b5d7,0xb5d7a515,0xad56c639,
-0xbdd7a514,0xb576c639,0xd6bbad56,0xb577dedc,0xc619c619,0xbdb8bdd9,0xc5fabdb9,0xc5f9bdd9,0xad36bdf9,0xce5bb5b8,0xe71eb598,0xce5aef5e,0xc63ace5a,0xbdb8bdd9,0xa516b577,0xdedcbdb8,0xce39debc,0xd6bbce5a,0xe71dd69b,0xce7aef7e,0xce5abdb7,0xd69bd69b,0xbdf8bdf8,0xad56bdf8,0xa515a535,0xad35ad76,0xa515ad76,0xb5b8bdd8,0xbdd8ad56,0xb5b7bdb7,0xbdf8bdd8,0xb5b7bdd8,
-0xbdd8ce3a,0xe6fdc5f9,0xce7affdf,0xffdff7bf,0xf79fffbf,0xb597defc,0xffffe71d,0xbdd8b597,0xd6bba536,0xbdd8b597,0xb577c619,0xc5f9b5b7,0xad56ce3a,0xb577ad56,0xc5f9a4f5,0xbdf8d69b,0xc619c5f9,0xd6bcdefc,0xad56c619,0xc5f9a535,0x9cd4bdd8,0xa4f5ad56,0xd69bc5f9,0xad76a515,0xc619ad56,0xc619bdf8,0xad76bdf8,0xce5abdd8,0xb597ad56,0xbdd8ce39,0xb5b7b597,0xb597b5b8,
-0xb597bdf8,0xd67bc619,0xb597ce3a,0xe6fdd67b,0xc619dedd,0xce5bd67c,0xad36ad57,0xb598bdf9,0xbdd89cd4,0xb577d69c,0xce5abdb8,0xa516bdb8,0xad57ad57,0xb577a515,0xc5f9ce3a,0xce7bbdd9,0x9cb4ad57,0x9cb49494,0x9cf59cf5,0xad779cd5,0x9cb49cb4,0xc5f9b597,0x9cd5c61a,0xa5159473,0x8c73ad77,0xa5369cb4,0xc5f9ad57,0xad56ce5a,0xbdf9ad56,0xa536ce5b,0xce5ab598,0xc619b5b8,
-0xad56c5f9,0xb597bdf8,0xd67bad56,0xb597e71d,0xc619c619,0xbdd8bdf9,0xce5adedc,0xbdd8bdd8,0xc639ce7b,0xce5ace5a,0xb597bdd8,0xb597ad77,0xc639b5b7,0xad56c639,0xce39bdd8,0x8c72ad56,0xa5359493,0xad76bdd7,0x9cd394b3,0xce7ac619,0xbdd8bdb7,0xbdf8bdf8,0xe71de71c,0xce7bdefc,0xad56c619,0xad56ad56,0xad56ad56,0xad35a515,0xa535ad76,0xad35ad35,0x9cf4ad55,0xa5159cf4,
-0xad559cd3,0xa534a535,0xa4f4ad55,0x9cb39492,0xa4f4a4f4,0x9cb39cd4,0xad359cd4,0xb5b7ad56,0xb597b597,0xad76b5b7,0xb597b597,0xef5ebdf8,0xc619bdf8,0xb5b7ce3a,0xbdf8bdf8,0x9cf4a515,0xad56ad35,0x9cf4ad35,0x94b3ad77,0x9cb48c52,0x9cd49cf4,0xe73dc5f9,0xc6199cf5,0xa515defc,0xad76b597,0xad5694b4,0xad56ad56,0xc619e73d,0xad55ad55,0xad96ad76,0xa514ad76,0xc618b5b7,
-0xb576bdd7,0xb5b8b5b7,0xbdd8a515,0xe6fddedc,0xb577ad77,0xa4f5a516,0xbdd9bdb8,0xbdd9c619,0xbdd8b5b8,0xc63abdb8,0xb597ce5a,0xdebcd67b,0xbdd8b597,0xad56bdd8,0xad56ad57,0xdedcc619,0xd69bc5f9,0xce3ad67b,0xe71ddedc,0xe6fddebc,0xb597bdd8,0xd67bce5a,0xbdd8ce7a,0xbdf8b597,0x9cd4a515,0xbdb8a4f5,0xb597b597,0xce5ab597,0xb597bdb7,0xc639bdf8,0xc619c619,0xbdd8ce5a,
-0xd69bad77,0xbdb8ce7a,0xd67bf7bf,0xef7ece5a,0xffffef7e,0xc639f7bf,0xffdfce39,0x9cf4a535,0xbdd8a535,0xd69bef5e,0xe6fce71d,0xb597b5b8,0xce7bb597,0xb597b597,0xb5b7bdf8,0xad36c639,0xa5169cf4,0xb598f77f,0xa4f5a4f5,0x94b38c52,0xad35ad56,0xbdd8ad56,0xc618bdb7,0xc5f8ce39,0xa535b5b7,0xc618b576,0xb5b7ce7a,0xbdf8bdd8,0xbdf8c619,0xbdf8c619,0xbdb8bdf8,0xad77b5b7,
-0xbdb8b597,0xce5abdb8,0xb5b8ce3a,0xce7bc619,0xe71de6fd,0xce7bdefd,0xb597ce3a,0xb5b8b5b8,0xd67bbdd8,0xef5ed6bc,0xbdf9c5f9,0xa516bdd8,0xb577b577,0xb598a536,0xc5f9d6bc,0xa515ad77,0x94b4ad56,0xa5158432,0x94b4a536,0xad36a515,0x9cf5c63a,0x9493a4f5,0xce5ac619,0x94738c32,0xb5779cd4,0xa515a536,0xad56a516,0xb5b8c5f9,0xb597ad56,0xc5f9ad36,0xb597bdd8,0xbdd8b5b8,
-0xb5b7bdd8,0xc619bdd8,0xad56a515,0xd69cdebc,0xc619b5b8,0xc619c619,0xdedcce39,0xbdd8dedb,0xbdf8bdd8,0xb5b7bdf8,0xb597c619,0xbdd8ad77,0xb597b577,0xc5f9bdf9,0xad56bdd8,0x9cf4a515,0x9cf48c52,0xad769cf4,0xa4f49cd4,0xc619a535,0xa535debc,0xd67ac639,0xe71de71d,0xd6bcc619,0xad56ce7b,0xc619ad77,0xbdd8b597,0xa535b597,0xad76b5b7,0x9cd49cf4,0xb597a535,0xb597bdb8,
-0xa4f4b596,0xb596ad75,0xad75b596,0x9492a514,0x9cf4ad55,0x9cd394b3,0xa5359cf4,0xbdd8ad76,0xad76b5b7,0xc619bdb7,0xad56bdf8,0xd6bbad76,0xb5b7f79f,0xb5b7bdf8,0xb5b7b5b7,0xa535ad76,0x9cf4a4f4,0x9cd4a515,0xa53594b3,0x9cd49cd4,0xa5369cf4,0xce7bbdf8,0xb597c619,0xb5b7c639,0xb597a515,0xb5b7ad56,0xa515b576,0xdedce73d,0xb597bdf8,0xa556a515,0xa535ad76,0xbdf8ad76,
-0xb576b597,0xce3aa515,0xc619c61a,0xe6fdce3a,0xb598debc,0xc619ad56,0xb598b5b8,0xbdb8b5b8,0xb5b8bdd9,0xbdb8c619,0xbdd8bdd8,0xd69bad56,0xc619d6bc,0xad77bdd8,0xa536a515,0xce5bbdf9,0xd6bbdedc,0xce5adedc,0xce5ace3a,0xd6bcdebc,0xbdd8ce5a,0xc619b577,0xce5abdd8,0xbdd8c639,0xa4f5b597,0xb597ad36,0xc619ce5a,0xbdd8bdf9,0xbdd8d69b,0xc619ad76,0xc639bdf8,0xb5b7c619,
-0xb5b7a4f5,0xe6fdd69b,0xd6bcf77f,0xc639dedc,0xffffc639,0xd67affff,0xf7bfef3d,0xad76a535,0xe73dd6bb,0xffffdefc,0xe73de73d,0xbdd8dedc,0xbdb8c5f9,0xa515bdd8,0xc639b5b7,0xb5b7ad56,0xa4f5ad56,0xb577f79f,0x94939cb4,0x9cd49cd4,0xbdf89cb3,0xc5f8c639,0xb576bdb7,0xdefcd69b,0xc639bdf8,0xc618b576,0xc619d6bb,0xbdb7bdf8,0xb5b7bdd8,0xad76bdd8,0xd69bbdb8,0xb5b7bdd8,
-0xb5b8b577,0xbdd9bdf9,0xce5bc63a,0xd69bc63a,0xd6bcd69b,0xc63adedc,0xbdf9c63a,0xa515ad56,0xce7bc63a,0xdeddd69c,0xb598debc,0xb577b598,0xa4f5ad36,0xad57ad36,0xb577b597,0xad56b597,0xa515b5b8,0x9cd48c73,0xa5159cd4,0xad779cf5,0xd67bad77,0x9cb494b3,0xad5694b4,0x9cf5c63a,0xad56a535,0xa515b597,0xa5159cb4,0xb598a516,0xb5b8b577,0xc61ab577,0xb577ce3a,0xc63abdf9,
-0xa535b577,0xa515bdb8,0xb5b8bdd8,0xe73ebdb8,0xc619e71d,0xce5ace5a,0xb5b7b597,0xd6bbdedc,0xb597c619,0xbdd8b597,0xd69bbdd8,0xc619bdd8,0xbdd8c619,0xb577b597,0xa515ad56,0xad56a515,0xa4f49cb3,0xad569cf4,0xad77ad56,0xad56ad36,0xe71ddebc,0xbdd8b597,0xdedcce39,0xce5adedc,0xc63af77f,0xc5f9b597,0xb597ce5a,0xad76ad76,0xb597ad56,0xa515ad56,0xa4f4a4f4,0xbdb7b597,
-0x9cd3b5b7,0xb596a514,0xb5b6a514,0x9cf3b596,0xb5b7a535,0xa514b596,0xa515ad56,0xb597ad76,0xbdd8c5f8,0xbdd8ad76,0xad56bdd8,0xb597ad56,0xf79fce5a,0xb597bdd8,0xad56bdf8,0xb5b7bdf8,0x9cb3a535,0x9cf49cd3,0x94b39cd4,0xa535b597,0xb597a515,0xad77b5b7,0xc619ce5a,0xad5694b3,0xa515b597,0xb5b7bdd8,0xa535a535,0xc619e73d,0xb5b7bdd8,0xad76b5b7,0xad97ad76,0xa535a515,
-0xa4f4ce39,0xa515a535,0xbdd8c63a,0xbdf9ad77,0xe71ededd,0xc619bdf9,0xc63ace7b,0xb5b8bdf9,0xbdb8c619,0xd69bbdf9,0xbdf8d67b,0xad76bdf8,0xd67bdedc,0xbdb8b5b8,0xc619bdd8,0xad76bdb8,0xd69bc619,0xd69bd69b,0xc63ac5f9,0xd67bce5a,0xce5ad69b,0xc5f9c619,0xce5ace5a,0xc639ce5a,0xad36b5b8,0xad56a536,0xce7abdd8,0xbdb8ce5a,0xce7abdf8,0xad76c5f9,0xb5b7bdd8,0xad76bdd8,
-0xbdd8bdd8,0xffffc619,0xbdf8f79f,0xdefcdedc,0xc639bdf8,0xef7eef5e,0xffdff7bf,0xb597ad56,0xef7edefc,0xef5ef79f,0xc639ffff,0xd69bc619,0xad56b577,0xc619d6bb,0xb597a535,0xa535b5b7,0xce5bb5b8,0xa536e71e,0xa536ad56,0x9cf59cb4,0xb5769cb3,0xbdd8ce5a,0xb5b7b596,0xc619c618,0xd69adedc,0xc5f8c639,0xbdf8d6bb,0xb5b7bdd8,0xb5b7b597,0xce7abdb8,0xbdf9bdf9,0xbdd8ce7a,
-0xb598b598,0xc61ac61a,0xc619bdb8,0xc619ce7b,0xc619ce3a,0xc63ac63a,0xb597c63a,0xa516bdd8,0xbdf9a516,0xbdf9ce3a,0xdefddebc,0xc619c61a,0xbdb8c5f9,0xa4f5b597,0xc63aad57,0xbdd9c619,0x9cd4ad56,0x94b4a515,0x94b39cd4,0xa5369cb4,0xad56ad36,0x94b3c619,0x94939493,0xd67bad56,0xad36ad56,0xad77b597,0x94939cd4,0xad77a536,0xbdd8b597,0xad56b597,0xce7bbdf9,0xb597b577,
-0xb577bdd8,0xbdd8ad36,0xbdb8ad36,0xbdd8ce5b,0xd69cd69b,0xc619c619,0xc619ce5a,0xdedcb5b7,0xbdf8debb,0xc639bdd8,0xbdd8c639,0xc619c619,0xb597b5b7,0xb597ad36,0xce39b597,0xc639c639,0xc619bdf8,0xad76b5b7,0xbdd8b597,0xad56bdb8,0xdedca515,0xad56ef5e,0xd69bbdd8,0xdebcb5b7,0xdefdc5f9,0xa516ce5a,0xce7ab5b8,0xa515a515,0x9cd49cd4,0xad35ad56,0xa5359cf4,0xb5b79cf4,
-0xa514c618,0xb59694b2,0x9cf3ad55,0xa514bdd7,0xa514a515,0xb5b7ad76,0xb5b7ad56,0xbdd8b597,0xbdf8bdd8,0xb576b597,0xbdd8b5b7,0xad76bdd8,0xce5abdb7,0xbdd8e71d,0xc619a514,0xbdb7b576,0xa514ad55,0x94b39cd4,0x94b39cd4,0xa5369493,0x9cf5a515,0xad77ad77,0xad36b577,0xbdb8a515,0xb597bdf8,0xc619ad35,0xad56bdd8,0xad76ce7a,0xb597b597,0xbdd8b5d7,0xad76ad97,0xa535ad96,
-0xbdf8ffdf,0xb5769cd4,0xb597ad36,0xad36b577,0xce7ba536,0xad77e71d,0xd6bcbdf9,0xc619c63a,0xdedcc5f9,0xc619c63a,0xc619d69b,0xd69bc619,0xb5b89cd4,0xce5adebc,0xbdf8ce5a,0xbdf8bdd8,0xc619bdf9,0xce5ac639,0xc5f9ce5a,0xc63ac619,0xc619ce5a,0xce5ae6fd,0xc619b597,0xce7ace5a,0xad77c5f9,0xad76b5b7,0xc619b577,0xce5adebc,0xc619bdf8,0xce7bdedc,0xb597ad77,0xbdf9bdb8,
-0xbdf8bdf8,0xef5ead76,0xc639ffdf,0xc639bdb7,0xbdf8d69b,0xce7ac639,0xf7bfffdf,0xbdf8bdf8,0xc619c639,0xdedcbdd8,0xffdfd6bc,0xbdd8b5b8,0xbdf9ce7b,0xb5b7a515,0xad56c619,0xb597bdb7,0xdefd9493,0xa516ffbf,0xbdb8b597,0xa515ad56,0xa5159cf4,0xc619ad56,0xbdf8c618,0xad56bdb7,0xdedbd6bb,0xc619bdf8,0xb5b7c5f8,0xb597c5f8,0xad76ad56,0xdedcbdb8,0xbdd8d6bb,0xc639d69b,
-0xbdd9bdb8,0xc619bdf9,0xbdf9c5f9,0xce7bc63a,0xce3ac619,0xc63ace7b,0xc61ace5a,0xa536b598,0xb5b89cb4,0xbdf9b5b8,0xe73ece5a,0xbdd8defd,0xbdf9ce5a,0xbdd8bdd9,0xc63abdb8,0xc61ac61a,0xad77c619,0xa5159cf5,0x94b494b4,0xa5159cf5,0xc5f9a515,0xce7bbdf8,0x9cd4a4f5,0xb5979cd4,0x94b4ad77,0xad569cd4,0xad36b5b8,0x9cf5a4f5,0xa516ad36,0xb598b5b8,0xa515a516,0xb577bdd8,
-0xc619a515,0xb597a4f5,0xc619ce3a,0xbdb8ce7b,0xc5f9bdb8,0xb5b8c619,0xc639ce5a,0xad56b576,0xe73dd69b,0xc619ce7a,0xbdb8ce3a,0xb5b7b597,0xa515b597,0xad76b577,0xd69bc619,0xdedcef3d,0xce39c619,0xbdb7c619,0xb597b5b7,0xbdb8bdd8,0xb577a515,0xdedcdefd,0xbdf8bdd8,0xd69bce7a,0xce5bb5b8,0xad57ce7b,0xb597a515,0xa515b597,0xad56ad76,0x9cf4a4f4,0x9cd49cd4,0x9cd49cd4,
-0xce79f7bf,0xad559cd3,0x94b29cd3,0xb5b6a535,0xa535ad55,0xb596a4f4,0xbdd7c619,0xb597b5b7,0xb5b7ad56,0xb597bdf8,0xc619b597,0xc619c619,0xbdd8b5b7,0xe71dce5a,0xb5b7b596,0xa515b5b7,0xb576b5b7,0x94939cd4,0x9cf49493,0x949394b4,0xb597bdd8,0xad77c619,0xe6fdc63a,0xffdfffff,0xad56a535,0xb597ad76,0xce7adebb,0xb597c639,0xad76ad76,0xbdf8ad96,0xb5b7bdf8,0xb597b5d8,
-0xef3def7e,0xa535bdf8,0xad76ad56,0xa515ad56,0xbdd8a515,0xd69bce3a,0xdedcc619,0xbdd8e73d,0xce5ab5b7,0xb5b8c619,0xdedcbdb8,0xc5f8d69b,0xc619c639,0xce7adedc,0xc619bdf8,0xce7ac639,0xbdd8d6bb,0xc619b577,0xc619ce5a,0xce7ace5a,0xffbfef5e,0xef7ff79f,0xbdd8d69b,0xdedcd6bc,0xb577bdf8,0xbdf9ad56,0xb597ad56,0xc639b597,0xb597d69b,0xdebcbdb8,0xa536c61a,0xbdd8ad36,
-0xb597bdf8,0xce7abdf8,0xe71dce7a,0xa4f5d67b,0xd67bbdf9,0xc619a515,0xe73de71d,0xd6bcce7b,0xad56b597,0xce3ac619,0xdebcd6bc,0xe71ddebc,0xd67bffff,0x9cb49cb4,0xb577bdd8,0xad56a515,0xb577b5b7,0xb597c5f9,0xb577b597,0xb576ad56,0xad56ad56,0xbdb7a514,0xc618c619,0xe6fcce5a,0xd6bbbdf8,0xc619ce7a,0xc5f8ce5a,0xbdf8d69b,0xce5ab576,0xbdf8ad76,0xc639dedc,0xd6bbc63a,
-0xbdb8ce5a,0xbdd8bdd8,0xc61ac63a,0xce7bbdb8,0xce5bdefd,0xd6bcce5a,0xc5f9c619,0xa516b577,0xb597ad77,0xbdb8b5b8,0xdebcdebc,0xd6bcd69c,0xc61ab5b8,0xbdd9bdf9,0xad77b597,0xc63ab598,0xbdd8c619,0xad569cf5,0xad56ad36,0xa535ad56,0xbdf8ad76,0xce5ac63a,0x9cf5e6fd,0xad36a515,0xd67bd69b,0xa515b577,0xce5aad56,0x9cf4b597,0xb597ad56,0xbdd8a536,0xad56b597,0xbdd89cf5,
-0xa4f5bdb8,0xbdf9d6bc,0xf79fbdd9,0xc61abdd8,0xb597c619,0xce5ac61a,0xc619b577,0xad76c639,0xdedcb5b7,0xce5aef5e,0xc619bdd8,0xad56bdb8,0xad56b597,0xb5b7ad56,0xbdf9b597,0xe71dd69b,0xc619ce5a,0xbdf8bdd8,0xa515b597,0xc619ad76,0xad77ad76,0xef5ebdf9,0xbdd8e71d,0xbdf8bdf8,0xbdf9debc,0xd67bce5a,0xa535ad77,0xbdd8ad77,0xb5b7b5b7,0x94b3ad76,0x8c729493,0x9cd4a514,
-0xc618d69a,0xa5148430,0x9492a514,0xad55a535,0xad55b596,0xad76ad76,0xc639c5f8,0xad56b597,0xad55ad56,0xbdd7b5b7,0xb5b7b5b7,0xc639bdb7,0xbdd8bdd8,0xce7abdd7,0xb576e73d,0xad55b596,0xad569cf4,0x9493ad76,0x9cd494b4,0xa5359cd4,0xffdfc63a,0xbdf9d6bc,0xbdd8e71d,0xb5b8bdb8,0x94b3bdd8,0xb597ad56,0xce5ab597,0xbdf8e73d,0xad76ad76,0xad56ad76,0xc65abe18,0xad96b5b7,
-0xd6bbce5a,0xce5ad6bb,0xa515b577,0xa5369cd4,0xad57b577,0xf79fd69b,0xbdd8f77f,0xe71dc5f9,0xbdf9b5b7,0xd69bd67b,0xd69bd69b,0xce5adefc,0xdebbe71d,0xbdb7ad76,0xce5ac619,0xd69bef3d,0xce3ace7a,0xc639b597,0xd69bce5a,0xd69bce3a,0xe71dd67b,0xdedce73e,0xc619defd,0xbdf8ad76,0xbdb8bdd8,0xbdb8bdd8,0xa535bdf9,0xad569cd4,0xbdf8bdf9,0xc619bdd8,0xa516ce3a,0xad56a515,
-0xb5b7c619,0xb5b7b576,0xc619ad76,0xc63adefd,0xce5ab577,0xad76ce5a,0xffdfce7a,0xce7ad69b,0xa4f5d67b,0xdedcce5a,0xce5ae71d,0xffdfffff,0xc619ce3a,0xbdd8defc,0xad569cd4,0xa535ad36,0xdefcbdb8,0xb597a515,0xa515b597,0xbdf8bdb7,0xad56ad76,0xa515ad76,0xce39b596,0xe71dd6bb,0xc619ad56,0xd6bbd69b,0xbdf8bdf8,0xbdb7bdd8,0xdefcbdd8,0xb5b7ad77,0xdedcdedc,0xd6bbc639,
-0xce7bef5f,0xb597bdd8,0xbdd8b597,0xd69bc61a,0xdeddd69b,0xbdf9ce7b,0xbdd8bdf9,0xb577bdf9,0xce5ab5b8,0xad57b5b8,0xbdf9ce5a,0xd6bcce5b,0xbdf9d69b,0xbdd8ad77,0xb597ad77,0xb577c5f9,0xbdf9bdf9,0x9cd4ad76,0xad56ad56,0xa515a515,0xb5b7a515,0xb5b8bdd8,0xd6bcb597,0xc619b577,0xdebcbdb8,0xb597ef3e,0xc63aad56,0xbdb8e6fd,0xad76a4f5,0xb597ad56,0xad57bdd9,0xad779cf5,
-0xa4f5e6fd,0xdefdd67b,0xd69cbdf9,0xbdd9e71e,0xbdb8bdf9,0xc619c5f9,0xad56c619,0xbdd8ad36,0xbdb7b597,0xef5ee6fd,0xb597ce7b,0xb597b597,0xb597b597,0xad36ad56,0xad77b597,0xd69bbdd8,0xd69be73d,0xc619bdf8,0xa535b597,0xc63ab597,0xc619e73e,0xb5b7c63a,0xf7bfe73d,0xb597a535,0xce3ace3a,0xd67bdedc,0xbdd8b597,0xbdd8a515,0xb597bdf8,0x9cd4a515,0x94b39492,0x9cf49cb3,
-0xad75debb,0x94b28c51,0x9cd3ad34,0xa5149cf3,0xa5349cf4,0xbdd7ad55,0xbdf8b597,0xb576c619,0xad55ad56,0xb5b7ad55,0xbdd7bdd8,0xbdd7bdf8,0xb5b7c619,0xbdd7bdf8,0xd6bbc619,0xb597ad56,0x9cd4a515,0x9cd4ad76,0xa53694b4,0xffffbdd8,0xdefdffff,0xa536bdd8,0x94b49cf5,0xa5159cf5,0xb597b597,0xb597ad56,0xb5b7b597,0xce5ace5a,0xad76bdd8,0xad56ad56,0xc659b5b7,0xb5d7c659,
-0xd69bb5b7,0xdefcd6bb,0xad77c619,0xad76ad56,0xad56bdd8,0xb5b79cd4,0xffffe71d,0xb597bdd8,0xc619defc,0xce7ac619,0xbdf8debb,0xe73dce39,0xb597ad56,0xbdd8d67a,0xd6bbd67a,0xfffff79f,0xd69bd67b,0xbdd8ce3a,0xc63ac63a,0xbdf8bdd8,0xdedcce3a,0xdedcdedc,0xd69bce5a,0x9cd4b5b7,0xbdd8ad56,0xb5b7bdf9,0xa536b597,0x9cd494b4,0xbdd8bdd8,0xbdf9d67b,0xdebcb598,0xa4f5bdd8,
-0xbdf8b5b7,0xb5979cf4,0xb597ce5a,0xe71dc619,0xa536c619,0xce7bdedc,0xdedcad56,0xce5ab5b8,0xbdd8ef3e,0xc619a536,0xffdfce3a,0xe6fdffdf,0xbdb8f77f,0xce5ace3a,0x8c729cd4,0xb577ad56,0xd69b9cd4,0x94b4b597,0xb5b7b5b7,0xb597ad56,0xa515a515,0xad55a535,0xbdb7ad76,0xad76c639,0xbdb7ad56,0xdedcce5a,0xb597ce5a,0xb597bdf8,0xbdd8bdd8,0xc619bdf8,0xf7bfd69b,0xc63ad69b,
-0xe6fddebc,0xc619ce3a,0xbdf9c61a,0xce5ace3a,0xc5f9c619,0xbdf8d67b,0xc619c619,0xce3ac63a,0xb598bdb8,0xb597bdd8,0xc5f9ad56,0xce5ad67b,0xce3adefd,0xc5f9b577,0xc619ce3a,0xad56bdd9,0xbdd8b5b8,0xad76bdd8,0xb5b7ad76,0x94b3a4f4,0xad35a515,0xad35a535,0xb597b577,0xc639e71d,0xc5f9bdd8,0xef7ee73e,0xc619bdd8,0xd6bbce3a,0x9493a515,0xad76a515,0xb5b8a536,0xad36a515,
-0xad36ad77,0xbdd89473,0xb598c61a,0xce5bbdb8,0xb597b577,0xbdf9ad36,0xbdd8ce5b,0xc619ad56,0xb5b8c619,0xdefdb577,0xc5f9e6fd,0xb5b8a515,0xb5b8bdd8,0xa515a515,0xad77a515,0xc619b597,0xce7ace7a,0xce5ace7a,0xb5b7bdd8,0xbdd8bdd8,0xe73dce5a,0xb597b5b7,0xd6bbc639,0xa535bdf8,0xc619b597,0xc619dedc,0xb597bdd8,0xbdd8bdf8,0xad56bdf8,0x9cb38411,0xad359cf4,0xa515ad35,
-0xb596e71c,0x9cd38c51,0xa514a514,0xa5149cd3,0x9cd39cd3,0xad76ad35,0xbdb7bdf8,0xbdf8b5b7,0xb596b596,0xb576ad56,0xc618bdb7,0xbdd7c639,0xce59c618,0xbdf8bdd8,0xbdd7ad56,0xa535ce7a,0xa5159cf4,0xce7b9cf5,0xdefdffdf,0xa5569d15,0x94b49cf5,0x9cd494b4,0xa5159cf5,0x94b49cf5,0xb5979cf4,0xa535c619,0xb597b5b7,0xce5abdd8,0xbdd8c639,0xb597ad76,0xb5b7ad76,0xc639ce7a,
-0xad76bdd8,0xce39c619,0xb5b7c5f9,0xb597ad56,0xad56ad56,0xad56bdf8,0xce5aad56,0xbdd8e73d,0xe6fcce7a,0xce5ac5f8,0xd6bbce7a,0xad76bdd7,0xbdd8bdb7,0xd69bce5a,0xce7abdf8,0xe73ddebb,0xdebcef7e,0xbdd8c5f9,0xbdb8ad56,0xb597b577,0xce5adebc,0xc619c5f9,0xbdf8ce5a,0xad76c619,0xad769cd4,0xbdb8c619,0x9cf4a515,0xa4f5a4f5,0xb5989cf5,0xbdf9ce5a,0xbdb8ad77,0xb597ce3a,
-0xa535a515,0xb5b7b5b7,0xbdf8b576,0xc619ce3a,0xad77d69b,0xe71db5b8,0xce7bdefd,0xce5abdf9,0xdebcce7a,0xb577bdf9,0xffffe71d,0xb597d67b,0xffffb5b8,0xad36defd,0x9cf4ad56,0xa5159cd4,0xb597a536,0xad76a536,0xb5b7a535,0x9cf4bdd8,0x9cd4ad56,0xad769cf4,0xa535ad55,0xb5b7a515,0xb576ad56,0xc639bdb7,0xce5ace7a,0xc619bdb7,0xb597b597,0xbdf8c639,0xd6bcad76,0xc63ae73e,
-0xce7bd67b,0xc619ce7b,0xbdd8b598,0xbdf8c619,0xce5ac5f9,0xc619bdd8,0xce5abdf9,0xd6bcce5b,0xbdd9d6bc,0xce5bc5f9,0xbdd9c63a,0xce5abdd9,0xe71ebdf9,0xc61ae6fd,0xc619bdb8,0xb5b8ce3a,0xa515a515,0xb5b7c639,0xad35ad76,0xb597bdf8,0x9cf4a515,0xb597a535,0xb577b597,0xf79fbdd8,0xad77bdf8,0xef5eb5b8,0xbdf9ffbf,0xad56ad77,0xb5b7c619,0xa515a4f5,0xad76ad36,0xad56c619,
-0x9cf5ad56,0xa536ce5a,0xbdd9ad77,0xbdb89cf5,0xc619debc,0xbdb8b598,0xc5f9bdd8,0xb577c639,0xb5b8ce7b,0xbdb8bdf9,0xdedcce7b,0xad77c63a,0xa4f5bdd8,0xad36a515,0xa535a535,0xbdd8bdd8,0xc619ad76,0xd69bd6bb,0xb597bdf9,0xb597b5b7,0xbdf8a515,0xc619defd,0xad76ad56,0xc619bdf8,0xb577a515,0xc619ce5a,0xce7ad6bc,0xe73dc619,0xa535b597,0xa515b597,0xa515a535,0xa534a514,
-0xb596e6fc,0x94729cd3,0xad55a534,0xad559cf3,0x94b3a534,0xb5969cd3,0xbdf8bdd7,0xbdf8c618,0xb5b7c618,0xb596b5b7,0xbdd7b596,0xbdf8bdd8,0xbdf8bdb7,0xb597c639,0xb576b597,0xc619b5b7,0xad569cf5,0xad77b5b7,0xa536bdd8,0x94938c73,0x9cd494b4,0xa536b597,0xa536ad77,0xa51594b4,0xa51594b3,0xce5abdf8,0xad56bdd8,0xb5b7bdd8,0xc639ce5a,0xa515b5b7,0xad76ad56,0xbdd8ad56,
-0xa515c639,0xce7aa535,0xce3ad69b,0xb577c619,0xbdd8bdd8,0xad77bdf8,0xad76b576,0xffffd69a,0xd69bb576,0xc619f79f,0xdedbc639,0xc619f79f,0xd67abdd8,0xce5abdf8,0xc619e71d,0xef5ededc,0xf79ff79f,0xb597ce3a,0x9cd4c619,0xb5b7a4f5,0xce3abdf8,0xbdb8c5f9,0xc5f9ce3a,0xa535b5b7,0x9cf5ad77,0xc5f9b597,0xad36c5f9,0xad56a515,0x9cd59493,0xb577ad56,0xb597b5b8,0xdefdbdb8,
-0x9cf4c619,0xbdf8ad56,0xbdb8ad77,0xbdd8ce5a,0xce7bc63a,0xa536b5b8,0xef7fd69c,0xbdd8a515,0xdefdb5b7,0xc619d69b,0xc5f9ce5a,0xc63ace3a,0xdedcb5b8,0xbdd8e71d,0xbdb8bdf9,0x9cb4a515,0xd69bc619,0xad368411,0xad56b597,0xad35c639,0xad56a515,0xa535ad35,0xa515a4f4,0xad5694b3,0xbdd8ad76,0xbdd8c619,0xc619ad56,0xffffbdd8,0xa515f79f,0xce5ac639,0xbdd8b5b8,0xe71dce7b,
-0xc63ac63a,0xbdf9c619,0xbdb8bdd8,0xbdf9bdb8,0xc5f9b597,0xbdd8b597,0xb5b8bdd8,0xce7bce5a,0xce7bce3a,0xbdb8b5b8,0xbdf9c5f9,0xad77bdd8,0xd69bb597,0xe6fdef3e,0xce3ab577,0xc63ace5b,0xad76b577,0xc5f8c639,0xa535ad56,0xb5b7a515,0xad56c619,0xbdb7ad56,0xad76b577,0xb597ad36,0xb597e71d,0xc619bdd8,0xffffe73d,0xa4f5ad77,0xce3ab5b7,0xa515bdd8,0xad76bdb8,0xd69ba4f5,
-0x9cb4c5f9,0xe71da515,0xad569cd4,0xad57c63a,0xef3ec619,0xb597c5f9,0xb5b8bdd8,0xce7bc619,0xce5abdd8,0xce5ac63a,0xce7bc619,0xdedcf79f,0xb5b89cd4,0xb597b5b8,0xbdd8b597,0xbdd8bdd8,0xbdd8bdd8,0xd6bbc619,0xbdd8c639,0xb5b7c619,0xa535b5b7,0xdedcbdf8,0xad76bdd8,0xce5ab5b7,0xad36c5f9,0xbdf9b5b7,0xe71dd69b,0xce7bd6bc,0xa515c619,0xd69bbdd8,0x9cd3a515,0xad76a514,
-0xad55debb,0x9cd394b2,0x94b29492,0xa514a514,0xad55a514,0x9cf3ad55,0xce39c5f8,0xb5b7c619,0xb5b7c619,0xad76ad76,0xbdf8bdd7,0xbdf8bdf8,0xbdb7c5f8,0xc619c619,0xb576bdf8,0xb597ad76,0x9cf4bdd8,0xa535a515,0xb5b89d15,0x94d4a556,0x94949d15,0xa55694b4,0xa536ad77,0xa515a515,0xad76a535,0xbdf8b5b7,0xb5b7dedc,0xbdd8a535,0xce7ab5b7,0xb597bdf8,0xa515a515,0xad76a515,
-0xdefcad56,0xb5b7c639,0xd67bd6bc,0xc619c63a,0xbdd8b5b8,0xc639c619,0xce5ac619,0xce7ace7a,0xd6bbdedc,0xf7bfffdf,0xbdd7d69b,0xdedbce59,0xb597bdd8,0xbdd8dedb,0xd69bad76,0xce5ab5b7,0xdedce71d,0xd67be6fd,0xb597bdd8,0xbdd89cb4,0xbdd8b5b7,0xbdf8d69b,0xc5f9c639,0xbdf8b5b7,0xc5f9debc,0xbdb8a515,0xb577c5f9,0xad369cd5,0x9cf5ad36,0xb5b8ad36,0xce3ac61a,0xad77bdb8,
-0xdefcbdd8,0xbdd8c639,0xb577b597,0xbdf8b597,0xc63aad56,0xa536c63a,0xffff9cd5,0xad56f7bf,0xce3ac619,0xe6fdef5e,0xb577b5b8,0xc61ab577,0xce5bb598,0xd67bc619,0xa536ad76,0xb597bdb8,0xc619e71d,0x9cb48411,0xad56ad56,0xad359cd4,0xa535a535,0x8c72ad76,0xad76ad35,0x9cf49cb3,0xbdd8a4f4,0xad76bdf8,0xa515ad56,0xe73db5b7,0xbdf8ffff,0xc619b5b8,0xbdd8c619,0xd69bb5b8,
-0xbdd9ef5e,0xce3ab5b8,0xbdd8c619,0xbdb8bdb8,0xc619bdd8,0xb597b597,0xbdd8b597,0xc619b5b7,0xbdf9ce3a,0xb597bdd8,0xb597ad57,0xa536bdb8,0xb597bdd9,0xef3eb5b8,0xc5f9e71e,0xbdd8c5f9,0xb597c619,0xad76ad56,0xad56bdf8,0xa515ad56,0xb597b5b7,0xa5359cf4,0xb5b8a536,0xad36bdd8,0xef3ece3a,0xbdf9bdf8,0xdedcbdd8,0x9cf5dedc,0x94b49473,0xb577d69b,0xbdf8ad56,0xc619b5b7,
-0xbdd8d69b,0xb5b8ad77,0xa4f5d67b,0xce7bb598,0xc61aa515,0xad77defd,0xbdf9bdd8,0xc63ab5b8,0xb5b7defd,0xc639d6bb,0xc619bdd8,0xfffff7bf,0xb597c619,0xbdf9ce7b,0xce5abdd8,0xb5b7bdf9,0xbdd8bdf8,0xce7bbdf8,0xbdd8ce7a,0xbdd8c639,0xbdf8bdd8,0xbdd8b597,0xb5b7dedc,0xbdd8bdd8,0xbdf9bdd8,0xad56ad56,0xd6bbb5b8,0xbdd8d6bb,0xb597b5b8,0xad568c52,0xad55ad76,0xa535a514,
-0xb575c639,0xa4f49cb2,0x9471a4f3,0xa5149cb2,0xa514a534,0xa534a534,0xce59b596,0xbdf8ce7a,0xbdd8ad55,0xad56ad76,0xb596b596,0xc618b5b7,0xce39ce7a,0xc619c5f8,0xb5b7c639,0xad56b597,0xbdf9b597,0xad569cf4,0x94d4a556,0xb598ad97,0x9cf58c73,0xa536a536,0xad56ad56,0x9cf4b597,0xc619ad77,0xb597ad76,0xe71dce7a,0xb597b5b7,0xb597bdf8,0xc639c639,0xa535bdd8,0xb597a515,
-0xce7bc619,0xc619d67b,0xd69bc5f9,0xc61ac619,0xc619c63a,0xdedcd69b,0xc619bdf8,0xc618c639,0xffffe71d,0xef5ededc,0xa515d6bb,0xdebbb5b7,0xc639dedc,0xd6bbc619,0xbdf8ad76,0xc5f8d6bb,0xef5ededc,0xdefdc63a,0xad56d69b,0xad36bdb8,0xad76bdf8,0xd69bbdb8,0xad56ce3a,0xd69bc619,0xce3ad69b,0xa515b577,0xc5f9bdd8,0x9cf5ad57,0xa536ad56,0xb577ad77,0xce3abdd8,0xad56bdd9,
-0xffffad77,0xad76dedc,0xbdd8ad76,0xa536b597,0xc619bdf9,0xd6bcce7b,0xc619bdf9,0xe71ddefd,0xbdf9ce5a,0xef5ef79f,0xa516bdd9,0xad36a515,0xbdb8ad77,0xbdb8b5b8,0xa515ad36,0xb597ad77,0xad56ef7e,0xa4f59cd4,0xb59794b4,0xa515b577,0xc619ce39,0xa535a515,0xad35b597,0xad56a535,0xad56a535,0xb577bdd8,0xa515a535,0xad76a535,0xb5b7bdf8,0xd69bce5a,0xc619c63a,0xce5abdf9,
-0xc63adefd,0xc63ac619,0xce5ac619,0xbdd8c639,0xb597bdd8,0xc619b5b7,0xbdd8ad76,0xb5b7bdf8,0xbdd8d69b,0xc619bdd8,0xbdd8b597,0xb597c619,0xbdf9ad57,0xce7bc5f9,0xdefce71d,0xc63ac619,0xad56bdf8,0xa515a4f4,0xbdd8b5b7,0xb597b576,0xb576a515,0x9cf5b577,0xad56a515,0xad77ad56,0xbdd8b5b7,0xbdb7d69b,0xa515d69b,0xffdfef7e,0xa5159cd4,0xc5f9a515,0xad36bdd8,0xce3ac619,
-0xdedcad36,0xa515dedc,0xd67bbdb8,0xbdd9ad77,0xb577debc,0xe71ec61a,0xbdd8c5f9,0x9cf5ad77,0xe71dce5a,0xd69bb597,0xdefdce7b,0xc63aef5e,0xc63ad69b,0xbdd8b597,0xb597c619,0xbdd8bdf8,0xb597a515,0xce5abdd8,0xd6bbd6bb,0xdefcc639,0xc639d6bb,0xb5b7bdf8,0xdedcbdf9,0xad77bdd8,0xce7bbdd8,0xa536d69b,0xd6bcb597,0xbdf9dedc,0xb5b7bdd8,0x9cd4ad56,0xbdd7a515,0xad76a514,
-0xa4f4bdd7,0xa534a514,0x9cf3ad34,0xad559471,0x94929cd3,0xad55a514,0xbdf8ad76,0xbdd8c619,0xad76bdb7,0xc619ce59,0xb576b597,0xbdd8b5b7,0xbdd8c639,0xc639ce5a,0xb5b7b5b7,0xa515bdd8,0x94b39493,0x9cf4bdf9,0xad779cf5,0xc65aad77,0x8c93b5d8,0x9cf59cf5,0xc619b5b8,0xa535ad77,0xb5b7b597,0xa535b597,0xdefcce5a,0xbdf8e71d,0xbdd8b5b7,0xbdd8ad56,0xce5ae71d,0xb597b5b7,
-0xc5f9ef7e,0xb5b7c639,0xbdd9b597,0xc619c5f9,0xdedcf7bf,0xce3ad67b,0xc5f8bdd8,0xd6bbce7a,0xc619bdd8,0xc5f8e71d,0xce5ae6fc,0xbdf8ad56,0xe6fcd69b,0xb5b7ad56,0xb597ce5a,0xce7abdf8,0xd69bc5f9,0xc5f9bdf9,0xdebcef5e,0xb5b7ad56,0xad56a515,0xc639b597,0xb577c619,0xc63ab5b8,0xdedcbdd8,0xad36ce7a,0xbdd89cf5,0xa515bdd8,0xad77a515,0xad56b597,0xc5f9b597,0xbdf9c5f9,
-0xce5abdf8,0xc5f9d67b,0xb577c5f9,0xbdd8a515,0xc63aad77,0xb5b8ad77,0xce5abdf9,0xe71dce3a,0xce7bdedc,0xc63abdb8,0xd69bc61a,0xad77c619,0xc61ad67b,0x9cd4c5f9,0xa536a515,0xa535a4f5,0xa515f7bf,0x8c529493,0xa4f58c52,0xbdb8b577,0xc619b5b7,0xc619b597,0xad76bdf8,0xa535bdf8,0xa515b597,0xc639ad56,0xb597c619,0xad77b5b7,0xbdd8bdd8,0xdefdbdd8,0xc619bdf9,0xc63adefd,
-0xdedcd69b,0xce5ad69b,0xce5ac639,0xce7ad69b,0xa515ad76,0xbdf8c639,0xce39bdf8,0xbdf8bdd8,0xbdf9c5f9,0xce7bad56,0xc619ce3a,0xb597ce3a,0xb597ad56,0xb577b597,0xef5ece5a,0xce3ad6bb,0xb576bdd8,0xa5359cd4,0xad76ad76,0xbdb7b597,0xa515bdd8,0xbdd8bdb8,0x94b39cd4,0xad76ad77,0xad359cb4,0xe6fcd6bb,0xb597bdf8,0xf7bfad76,0x9cb4f77f,0xb577a515,0xad56c619,0xb577b5b7,
-0xbdb8ad56,0xa515defc,0xbdb8a536,0x9cf5defd,0xef5ece5a,0xce7bad77,0xc63af79f,0xb597c5f9,0xce7ba515,0xa536d6bc,0xf79fdefd,0xa536bdf9,0xdedcce7b,0xad77bdd8,0xb597b597,0xbdd8b597,0xbdf8ce5a,0xce5ace7a,0xdedcd6bb,0xce7adedc,0xb5b7c639,0xb597ad76,0xbdd8ad56,0xad56ce5a,0xbdd8a536,0xc619c619,0xb597b5b8,0xd6bcc63a,0xb5b7bdd8,0x94b3ad76,0xad568431,0xb596b596,
-0xad55b596,0xa514ad34,0x9cd39cd3,0x94b29cd3,0x9cd3a514,0x9cf39cd3,0xbdd7ad76,0xb5b7b5b7,0xbdd7bdd7,0xd6bba515,0xb596d6bb,0xbdd8b5b7,0xbdf8ad76,0xc639c5f8,0xb576c619,0xad56bdd8,0x843194b3,0xce7aa536,0x94b49cf5,0x9d15b5d8,0xb5b8c63a,0xb597a515,0xbdd9bdd8,0xb5b8ad56,0xa535b5b7,0xb597ad76,0xce7ab5b7,0xdefcd6bb,0xc619bdf8,0xad76b5b7,0xe71dc619,0xb5b7d69b,
-0xe6fdc5f9,0xc619c619,0xd67bce7b,0xef3ed67b,0xef7fd69b,0xe6fdffbf,0xbdd8ce7a,0xa514a515,0xc619ad56,0xf79ff77f,0xce7ab597,0xb5b7e73d,0xce7abdd8,0xa4f4d6bb,0xc619b597,0xb597b5b7,0xbdb7d67a,0xc639b5b7,0xe6fcc619,0xb597d69b,0xad56ad56,0xb597c619,0xad35b576,0xbdd8bdd8,0xd6bcd69b,0xc619d69b,0x9cd4bdd8,0xc639b5b7,0xb597b597,0xad56b597,0xad56ad56,0xce5abdb8,
-0xc5f9ce5a,0xbdd9ad36,0xad77c63a,0xbdf9b597,0xa536b597,0xc63abdd8,0xe73ece5a,0xa515f79f,0xffffffdf,0xa515a515,0xc619bdb8,0xbdd9dedc,0xbdd8bdd8,0xb577bdb8,0xad56a515,0xbdb8b5b8,0xa536ef5e,0xa4f59cd4,0x9cf5a536,0xad7794b4,0xad77b577,0xb597bdd8,0xbdf9ad77,0xbdb8bdf9,0xb577ad36,0xad56b597,0xb5b8bdf8,0xad77b5b7,0xc6199cf5,0xbdd8d69b,0xc63ad69b,0xdedcdefd,
-0xc65ad6bc,0xce7bbdf9,0xc65ace7b,0xef5edefc,0xb5b7b5b7,0xc619c639,0xc619c639,0xc619c619,0xad76b5b7,0xb5b7b5b7,0xce5abdb7,0xad56b597,0xc619ad76,0xb597ad56,0xc619ce7a,0xf79fe73d,0xad56bdd8,0xa515ad56,0x8c529cd4,0xb597a515,0xbdf8ad56,0xc619a515,0xa536b5b8,0xad77a536,0xb597c639,0xef3dd67a,0xce5affdf,0xc619c619,0xe73dffff,0xa536a535,0xbdb89cf4,0xa515a535,
-0xb597bdd8,0xef5eb5b7,0x9cf5ad56,0xe71db597,0xce5aad77,0xb597e71d,0xdedcce7b,0xd6bbb597,0x9cd4ad56,0xdefdc619,0xd6bca536,0xc619ce5a,0xd69bc63a,0xc619d69b,0xc63abdd8,0xc619bdf8,0xdefde71d,0xd6bbce5a,0xd6bbce5a,0xd6bbef5e,0xad76bdd8,0xb597b5b7,0xb597bdd8,0xbdf9b5b8,0xad56ad56,0xbdf9bdd8,0xb598c61a,0xd69bc5f9,0xc619c619,0xa515ad56,0x9cd3bdd8,0xc619a514,
-0xb5b6b5b7,0xa4f4ad35,0x8c7194b2,0x94729492,0xad5594b2,0xb596a535,0xc638b596,0xb597ad76,0xb5b7bdd8,0xb5b7b5b7,0xd6bbdedc,0xc619c619,0xbdd8bdd8,0xc5f9c5f9,0xad56c5f9,0xa4f59cd4,0x8c529cf5,0xb5d88452,0x9d15d6bc,0xad7794d4,0xce7b9d15,0x94d4ce7b,0xa556ad56,0xbdd8b5b8,0xad76bdd8,0xad56ad56,0xad76bdf8,0xdedcc639,0xbdf8e73d,0xad76b597,0xc639c619,0xce5ace7a,
-0xbdb8ce7b,0xce3ad69b,0xe71edebc,0xef3ed69c,0xdedcef7f,0xdedcdefd,0xa515b597,0xad56a515,0xc63aad56,0xd67bc619,0xd69bffdf,0xd6bbdefc,0xc619c619,0xce5adedc,0xad56bdd8,0xb597c619,0xce7ac619,0xb597ad56,0xc5f8b577,0xd69bef5e,0xb576a515,0xb5b7ad56,0xbdd8b597,0xce5aad76,0xb5b7ce5a,0xd67bb597,0xb5b7ce5a,0xc6199cb4,0xad77c619,0xad56ad36,0x9cb4a4f5,0xbdb8a536,
-0xad36c619,0xbdd8a516,0xce7bc63a,0xa515ad56,0xad56b597,0xce5aad56,0xbdd8c63a,0xce5ac63a,0xce7adebc,0xa535ce5a,0xbdd8b577,0xdefdce3a,0xc5f9c5f9,0xce7ac619,0xbdd8bdd8,0xad77bdd8,0xa4f5c619,0xad569cd4,0x94939cf4,0x9cd49cb4,0xad56b577,0xbdd89cd4,0xc619ce3a,0xad56bdf9,0xa515a536,0xa515ad77,0xb5b8ad56,0x9cf49cf5,0xbdd8b5b7,0xd6bcce7b,0xce7bc63a,0xdefdd69b,
-0xd6dcdedc,0xce5ac63a,0xd69bd6bb,0xd6bbd6bb,0xce7ace7a,0xbdf8ce5a,0xce5ac639,0xc639bdd8,0xad76ad76,0xb5b7b597,0xc619bdf8,0xc619d69b,0xb576bdd8,0xbdd8c5f8,0xce39bdd8,0xe71dd69b,0xa515e71d,0x9cd49cb3,0x8c529cd4,0xad568c52,0xad56b597,0x8431ad76,0xb5b89cf5,0xad569cf5,0xce5ace3a,0xd69bb597,0xe73de73d,0xce5abdb7,0xf7bfad76,0x9cd4d6bb,0x8c73ad36,0xb597a515,
-0xb597a535,0xb597a535,0xad56dedc,0xc619a515,0xb597e71d,0xf7bfd6bc,0xb597ad76,0xb5b7bdd8,0xad56c619,0xce5aa536,0xa536e73e,0xe71ddedc,0xbdf9ce5a,0xd6bcc619,0xb5b8d69b,0xce7bc619,0xef5ec619,0xbdd8d6bc,0xd69bc619,0xd69bef5e,0xad76ce7a,0xbdf8b597,0xbdd8ad76,0xad56b5b8,0xad76c619,0xc619ad77,0xd6bcc5f9,0xbdf9b5b8,0xc619e71d,0xb5b7b5b8,0xce39dedc,0xad35ad56,
-0xc5f8bdb7,0xa534bdd7,0x8c5194b2,0x9cd38c31,0x9cd39cb3,0xad35ad35,0xa535b596,0xb576ad76,0xc5f8b597,0xbdb7c639,0xd6bbad56,0xbdf8dedc,0xbdd8bdf8,0xbdb8b5b8,0xa4f5b597,0x94939cf4,0x8c5294b4,0x94b494b3,0xd6bcb5b8,0xad77a556,0xad97b5d8,0xb5d8c61a,0xa5369d15,0xad56ad56,0xad76b597,0xad56b597,0xbdf8b597,0xce5abdd8,0xef5ed6bb,0xb5b7c639,0xb5b7b5b7,0xbdf8b5b7,
-0xbdd9defd,0xf79fc61a,0xef5fef5f,0xce5af79f,0xce3aad77,0xbdd8c619,0xc619ce5a,0xad76ad35,0xad77b597,0xc63aa536,0xf7bfd69b,0xd69bce5a,0xb597dedc,0xdefdad56,0xa4f5d67b,0xc63ab5b8,0xc639b5b7,0xb597dedc,0xbdb7b576,0xdefcad35,0xb5b7d69b,0x9cf4b5b7,0xb597ad76,0xbdd8b597,0xc61ace5a,0xbdd8ce3a,0xce5ace3a,0x9493a4f5,0xad36b597,0xa515a4f5,0x9cf4a515,0xa4f59cf5,
-0xad57bdb8,0xad77a536,0xce7bb5b8,0xad77bdd8,0xc63aa536,0xad77ce5a,0xc619c63a,0xef7fd69b,0x94b3a515,0xce5abdd8,0xc619bdd8,0xdedcbdd8,0xbdd8dedc,0xad56ad77,0xbdb8bdb8,0xa535ad56,0x9cd4ad76,0xad569cd4,0x8c32a515,0xa5159493,0x9473a515,0xad56ad56,0xd69bce5a,0xa515bdd8,0xa536a515,0xb597a536,0xbdf9ad77,0xad56bdf8,0xc63ab5b8,0xdedcc63a,0xd69bce7b,0xd6bcdedc,
-0xe71dce9b,0xce7bdefd,0xdefcd6bb,0xc639ce9b,0xd69bd69b,0xce7ac639,0xbdf8c619,0xbdf8ce7a,0xbdf8c5f8,0xd67ac639,0xce59ce5a,0xc639d67a,0xc639bdd7,0xd69bc639,0xc639c639,0xbdf8c639,0xce7ad6bb,0x9cd4ad35,0x9cd49493,0xa4f4ad35,0xc5f9bdd8,0x9cf5ad56,0xbdd89493,0xa515b597,0xce5ab597,0xad76bdf8,0xce5ab597,0x9cf4d6bb,0xb597c639,0xef3effff,0x94b48c52,0xbdb89cd4,
-0xb597ad76,0x9cf4a535,0xe71dad76,0x9cd4bdf9,0xd6bcb597,0xce5aa536,0xb5b8e73d,0xce5abdd8,0xce7bce5a,0xa536b5b8,0xce7bd69b,0xef7fad56,0xbdf9dedc,0xbdd8b5b8,0xb597c619,0xbdf9ad77,0xc619bdf9,0xc63abdd8,0xce5ac639,0xd6bbd69b,0xce5ace7a,0xad76bdd8,0xbdd8b5b8,0xad77b597,0xb597ad77,0xa536ad56,0xbdf9ad57,0xa536bdf9,0xce7bce7b,0xc619ce7a,0xce7aa535,0xad55defc,
-0xdebaad55,0xad55d67a,0x8c309472,0x8c519492,0x9cf3a4f3,0xbdb69cb2,0xb596b576,0xb596b596,0xc619bdb7,0xce5ace7a,0xbdf8c5f8,0xdefcdedc,0xb5b8b597,0xa535bdb8,0xad77ad57,0xad56a4f5,0xad569cd4,0x9cd4a535,0xad5694b4,0x94b4d6bc,0xa5368c93,0xad56a556,0xad77b597,0xa515a515,0xad56a535,0xb5b7b597,0xc619ad76,0xc619ce5a,0xdefcd6bb,0xbdd8e73d,0xbdd8c619,0xa515ad56,
-0xffdfc5f9,0xe73ee73e,0xce7bef3e,0xce5bdefd,0xce3ab5b8,0xc5f9c63a,0xdebbe73e,0xbdb7bdd8,0xad76ad56,0xd69bbdd9,0xef5ed6bc,0xd67bffdf,0xce3adedc,0xbdf9a536,0xd69bce3a,0xbdd8bdd8,0xbdf8c5f8,0xef7ece5a,0xbdb7c619,0xbdd8bdb8,0xdedcef5e,0xb576ad76,0xb5b7b597,0xbdd8c5f8,0xbdf9bdb8,0xb577b577,0xbdd8b597,0xb5b7ce7a,0xb5b79cf4,0x9cb4ad76,0x9cd49cb4,0xad77a515,
-0xb577b597,0xb597a515,0xd67bd67b,0xc619ce5a,0xad77bdd8,0xad77c63a,0xbdd8b597,0xb5b8b597,0x9cb4b577,0xdedca515,0xb577c619,0xce3abdd8,0xbdb8dedc,0x9cf4a515,0x94b39cd4,0xc639a515,0x9493bdd8,0xa4f5b597,0x8c52ad36,0xa4f58c32,0x94939493,0xbdd8bdd8,0xd67bad76,0xad76bdd8,0xad56bdb8,0xb5b7b5b8,0xad56b5b7,0xce5abdd8,0xbdf9c63a,0xb5b8c619,0xdedcce5a,0xdedcbdd8,
-0xce7bd6bc,0xd6dcdedc,0xc639ce5a,0xbdf8bdd8,0xd69bbdf9,0xce7ace5a,0xbdd8d69b,0xbdf8ce7a,0xc619bdf8,0xc639c618,0xce7abdd8,0xc639c639,0xce7ace7a,0xd69bd69b,0xc619c639,0xbdf8c639,0xbdf8bdf8,0xa515b597,0xa535ad56,0xad76b576,0xb597a515,0xad76bdd8,0x94b49cf5,0xbdf9b5b8,0xad76ad35,0xbdf8dedc,0xad76ad76,0xdedcbdd8,0xbdf8a535,0xf79fad76,0xa535e6fd,0xbdd89cd4,
-0xad56d69b,0xad76a515,0xbdd8ad56,0xc619e73d,0xc63aad77,0xb597ef5e,0xd6bbbdf8,0xbdf9c63a,0xd69bc619,0xa536c63a,0xc6199cd4,0xb5b8defd,0xc63ae73e,0xa536ad77,0xb5b8ad56,0xad76ad56,0xce5ac619,0xce7abdd8,0xb5b7d69b,0xce5ac619,0xc639ce7a,0xbdd8ce5a,0xad56ad76,0xbdd8ad56,0xad56b597,0xad77b5b7,0xa516a536,0xd6bcc5f9,0xe73ec63a,0xbdf9ef7f,0xb577c639,0xef5edefc,
-0xce39ad56,0xbdd7e6fc,0x94929492,0x94929492,0xa5349cb2,0xad34ad34,0xad55ad55,0xc618c618,0xb5b7c5f8,0xd69bce7a,0xc5f8ce5a,0xdefcbdb7,0xb577c639,0xad76b597,0xa515a536,0xad56a515,0x9cd4ad56,0xa535ad76,0x94d49cf5,0xdedcb597,0x9d159cf5,0xa515b5d8,0xb597a556,0xad76a536,0xa535ad56,0xb5b7bdd8,0xbdf8bdd8,0xc619c639,0xd69bbdf8,0xdedcd69b,0xbdf8c619,0xad76b597,
-0xc619bdd8,0xce5aef3e,0xf79fdedc,0xe73ee6fd,0xc619c5f9,0xe6fdce7b,0xdedcd69b,0xbdf8ce59,0xad76bdf8,0xd6bbb5b7,0xce7be71d,0xf7bfdefd,0xbdf9d69b,0xb5b8ce7b,0xce5abdd8,0xbdd8ce7b,0xbdb7bdd8,0xd6bbad76,0xb597defc,0xc619ad76,0xef5ec619,0xad56ce39,0xb597bdd8,0x9cd4ad76,0xad36a4f5,0xa515ad76,0xa515ad56,0xb5b8ad56,0xa4f5ad56,0xa515a535,0x94b394b4,0x94b38c73,
-0x94b48c53,0xb5b8b5b8,0xbdf9bdb8,0xce7bce5b,0xb577c5f9,0xc619ad56,0xad56a515,0x9cd4b5b7,0xbdb8c5f9,0xa515b577,0xce5ac63a,0xbdd9ad36,0xc5f9b597,0xad56c63a,0x9cf5a515,0x9cf5a515,0x9cd49cf4,0xad369cd4,0xad56a515,0x83f1ad36,0xa4f5a515,0xbdd8b597,0x9cd4b597,0xc619d69b,0xad56ad56,0xc639ad56,0xb5b7c619,0xb5b7ad76,0xc639ce5a,0xa536ad76,0xe73ebdd8,0xbdf9ce5a,
-0xd6bbd69b,0xef5ece5a,0xce7bd6bc,0xce9bc619,0xc63ac63a,0xce5ad6bc,0xc619bdd8,0xc619b5b8,0xc618c618,0xad76bdd8,0xb597ad56,0xd69bc619,0xce7bd67b,0xce7bce7b,0xbdd8c639,0xc63abdf9,0xad56c619,0xb5b7b5b7,0xad76ad76,0xbdd8ad77,0xa515a536,0xb5b7ad56,0xa515ad56,0xbdd89cf5,0xad55c619,0xc639b596,0xad76bdd8,0xe71cb5b7,0xce39ffff,0xb5b7bdd8,0xef5effff,0x9cb3b597,
-0xb5979cf5,0x8c529cb4,0xad56ad56,0xe6fdbdd8,0xad76ce7a,0xbdf9b597,0xc619b597,0xc619d6bc,0xbdf9bdd8,0xd69bbdd8,0x9cf5ad77,0xce5ace7b,0xd69ba536,0xbdd8c63a,0xb597ad36,0xbdd8bdf9,0xbdf9b5b8,0xce5ace7a,0xb597ce7a,0xc619ad56,0xce5ac639,0xce5ac619,0xa515b597,0xa535ad56,0xad96ad97,0xb5d8ad97,0xa556b5d8,0xdedca536,0xce7bf7bf,0xdefde71d,0xbdd8ce5a,0xef7fc63a,
-0xbdf8f79e,0xbdd7ce39,0x84109cd3,0x9491840f,0x94b29491,0xad75a4f3,0xc638a514,0xc619ce7a,0xbdd8bdf8,0xc619c618,0xc639ce7a,0xbdd8c619,0xd69bdedc,0xb597b597,0xa515ad77,0xad77ad56,0xa535a536,0xa5369cf5,0x94949cf5,0xc5f9a516,0x9cd5d69c,0xa5369cf5,0xb597a515,0xa515b597,0xbdd8ad56,0xb5b7b5b7,0xbdd8c619,0xc619bdf8,0xb597c639,0xdefcce7a,0xc619d6bb,0xbdd8ad76,
-0xbdd8bdf9,0xef5eb577,0xce7be73e,0xc5f9ef3e,0xd69cce3a,0xce7ac619,0xbdd7d69b,0xf7bfdefc,0xb5b7bdd8,0xc619bdf8,0xce7ace5a,0xce5ad69b,0xc619e71d,0xce7bc619,0x9cf5b597,0xd69bce5a,0xd67ac619,0xb597bdd8,0xe71dc619,0xb597b5b7,0xad35c619,0xdefcdedc,0xc619ad76,0xa535ad56,0xc5f9ad77,0xa4f5b5b8,0xa4f59cd4,0xb5b7ad76,0xb577bdd8,0xbdd89cf4,0x9493ad76,0x94b494b4,
-0x94948432,0xbdf9b598,0xad57ad77,0xb577b597,0xbdf9bdd8,0xa5159cd4,0xffffbdf8,0xad76dedc,0xce7b9cd4,0xad36d69b,0xd69bb5b8,0xb5b8c63a,0xad56ad76,0xbdd8bdd8,0x9cf4a515,0x9cf4a515,0xb597a515,0xbdd8ad36,0xad56b597,0x9cd494b3,0xbdf8a536,0xb5b7d69b,0xb577b5b8,0xd6bba535,0xad76c619,0xbdf8bdd8,0xbdd8bdd8,0xad76ad56,0xce7abdf8,0xa536b5b8,0xc619b5b8,0xd69bd6bc,
-0xc619ad56,0xce7bc619,0xdefdd69b,0xd6dcce7b,0xce7bc63a,0xc63ace7b,0xbdf9c619,0xbdd8c619,0xc639bdd8,0xad56c5f8,0xbdd8b577,0xce5abdf9,0xce5adebc,0xd67bd6bc,0xbdf9c5f9,0xce3abdd8,0xb597b5b7,0xc619ad56,0xb597c619,0xad77ad76,0xa515b5b8,0xbdd8a535,0xad76b597,0xbdd8c619,0xc5f8bdf8,0xb576ad55,0xbdf8ce39,0xc639bdd8,0xffdfd69b,0xd67ac618,0xffffa515,0xa535e71d,
-0x94938c52,0x94939cb4,0xa5159473,0xb597a536,0xdefddedc,0xad56a535,0xbdf9defd,0xef5eb5b8,0xbdf9c63a,0xdedcbdf9,0xbdd8e71d,0xce7ba515,0xa515d69b,0xdedcf79f,0xad36b597,0xc63abdd8,0xce5ac619,0xc63adefd,0xbdd8a515,0xad56a535,0xbdf8c639,0xc619ce5a,0xa515c619,0xbdd8ad56,0xb5b7b5b7,0xad76b5b7,0xa536ad76,0xc63aa515,0xef9fe71d,0xd6bcd69b,0xc61ae6fd,0xd67bbdf9,
-0xffbfffff,0xad55bdf8,0x8c71a4f4,0x8c718410,0x94b28c71,0xad35ad34,0xad75a514,0xce7aef5d,0xce7ad69b,0xc618bdf8,0xc619bdd8,0xbdd7d69b,0xdefcb5b7,0xb597e6fc,0xad36ad56,0xa516ad56,0x9cd4a536,0x94b49cd4,0xa515a536,0x9cd59cb4,0xb5b8b577,0x9cf5a515,0xa536ad77,0xb5b8a515,0xad56ad76,0xb597b597,0xc619bdd8,0xbdf8c619,0xc619ce5a,0xd6bbb5b7,0xc639dedc,0xbdf8bdf8,
-0xb597c619,0xbdb8a515,0xd67bdefd,0xd69bb5b8,0xce5ad67b,0xb597b5b8,0xd69bb5b7,0xef5dd69a,0xc619dedc,0xbdf8bdf8,0xc639bdd8,0xc619c619,0xef7fd6bc,0xd6bcbdd8,0x9cf5b5b8,0xd69bbdd8,0xa535dedc,0xa535a515,0xbdb79cf4,0xa535b5b7,0xb5b7ad56,0xdefcb576,0xb5b7e73d,0x94b3ad56,0xad56a4f5,0xbdb8ad76,0x8c739cf5,0x9cd49473,0xc5f9bdb8,0xa515bdf8,0xa515a536,0x8c529cd4,
-0xc5f9a515,0xa536b597,0xbdb8ad56,0xb577b577,0xd6bcc5f9,0x9cb4ce7b,0xf79fe73e,0xb5b7defc,0xc63abdb8,0xbdb8d69b,0xb597b597,0xce5ab5b8,0xad56ad76,0xad56ad77,0xa535bdd8,0x9cf59cd4,0xad56a515,0xce5abdb8,0xad56ce7a,0xa535a515,0xbdd8ad76,0xce39d67a,0xce5aa515,0xbdf8c639,0xc639ce5a,0xc639ce5a,0xc639ad77,0xb597c619,0xbdd8b597,0xbdd8c619,0xbdd8b597,0xd6bcc63a,
-0xb5b7c63a,0xdefdce5a,0xd69cce7b,0xdefdce7b,0xc63ace7b,0xc65ac63a,0xc619d69b,0xad77b5b7,0xc619bdf8,0xc619ce7a,0xbdf8bdd8,0xce5abdf9,0xc63ac63a,0xd6bcce7b,0xbdd8c63a,0xc619ce3a,0xb5b8c619,0xb597b5b8,0xc619bdd8,0xad77ad56,0xbdd8ad77,0xad77b597,0xce5abdf8,0xb5b7b5b8,0xbdd7ad35,0xad76bdd7,0xc639ad76,0xb596b5b7,0xdedbb596,0xc5f8ffbf,0xbdb7bdd7,0xe73dffff,
-0x8c528c72,0x9cd49cd4,0x9cf49493,0xb597ad56,0xe71dc619,0xb5b8dedc,0xd6bcc63a,0xce5bb597,0xc63ae71d,0xce7bc5f9,0xce7bd69b,0xad57bdd8,0xd69cc619,0xe71ebdf9,0xad77c5f9,0xbdd8b5b8,0xe71dd69b,0xce7ac639,0xad56bdd8,0xad76bdd8,0xbdf8c619,0xce5abdd8,0xc63abdf9,0xbdf8bdd8,0xb597bdf8,0xad76b597,0xa536ad76,0xce7bad77,0xe75edf1d,0xb597dedc,0xef7fdebc,0xce5adebc,
-0xef5ece7a,0xad55ef7e,0xad3494b3,0x94929cd2,0x9cb28c71,0xa514ad55,0xbdd7b5b7,0xe71dbdf8,0xdefcce7a,0xc619c639,0xc5f8c639,0xbdf8ce5a,0xb5b7bdf8,0xc619debb,0xad56a515,0x9cd59cf5,0xad56a536,0x9cd494b4,0x9cd594b4,0xa536ad56,0xa5369cd4,0x9cd5bdd9,0x9cf5a515,0xad7794b3,0xa535ad76,0xb5b7bdd8,0xc659b5b7,0xc639c619,0xc65ac639,0xbdd8bdf8,0xce5ad6bb,0xc639c619,
-0xb5b7ad56,0x9cd4b597,0xce5aa4f5,0xce3abdf9,0xc619d69b,0xc63ad67b,0xdedcbdd8,0xb597e71d,0xce7ae71d,0xce7ab5b7,0xb5b7b5b8,0xbdd8c619,0xce5ad69b,0xbdf9e73e,0xbdf9bdf9,0xa515b597,0xb5b7ce39,0xc61994b3,0xa515c639,0xb597ad56,0xbdd8ad76,0xad76c639,0xd69bdedc,0xb597a515,0xa536a536,0xb597a536,0x9cd4ad36,0x84328431,0xad568c52,0x9cf5b597,0xc619a515,0xa536c639,
-0xad56b597,0x94948c73,0xbdb8a515,0xb598bdd8,0xbdd8c5f9,0xbdb7ce3a,0xad76ffff,0xad56bdb7,0xd69bbdf8,0xc619c619,0xbdd8bdd8,0xb597ad56,0xad56c619,0x94b4a4f5,0xce5ab5b8,0x9cd49cf4,0xa535a515,0xce5ab597,0xbdd8c619,0xa515ad77,0xbdb79cd4,0xce5abdf8,0xad76a515,0xb5b7c639,0xce7abdd8,0xbdf8d6bb,0xc619c639,0xbdd8ce5a,0xad77b5b8,0xce7bb597,0xb597c619,0xbdd9bdd8,
-0xce5ace7b,0xdedcbdd8,0xdf1de73e,0xdf1dd6bc,0xd69bd6dc,0xbdf9c63a,0xce7bc63a,0xb597bdd8,0xb5b7b597,0xb5b7bdf8,0xce5abdb8,0xc5f9ce5a,0xc619bdf9,0xdebcdebc,0xce5ace5b,0xbdb8c5f9,0xbdd8b5b8,0xb597bdf9,0xc619bdd8,0xa536c639,0xb597b597,0xb597b5b8,0xbdd8a535,0xb597bdf9,0xad56ad56,0xbdf8bdf8,0xa514ad76,0xc619b5b7,0xad56c639,0xffdfdedb,0xbdf8bdd8,0xf7bfce39,
-0x8c73b5b7,0x9cf59493,0x9cb49cd4,0xbdb894b4,0xc619ce7b,0xef5eef7f,0xbdd8bdf9,0xa516ce7b,0xffffb5b8,0xb5b8ce3a,0xd69bce7b,0xb5b8defd,0xce5bb598,0xb598ce7b,0xe6fdf77f,0xb598ad77,0xe71dce5a,0xb5b7d69b,0xce5ac619,0xb5b7b5b7,0xad76ce7a,0xb597b597,0xc619b597,0xb5b8defd,0xb5b7c639,0xb597bdd8,0xc639c619,0xb5d8b5d8,0xb5b8bdf9,0xc619c63a,0xd69bad56,0xdebcf77f,
-0xce59c619,0xce59e71d,0x9cd39492,0x9cd2ad34,0x94919491,0xbdd7a534,0xbdd7ad35,0xc639c619,0xdedce73d,0xc618d69a,0xc619bdd8,0xc619c639,0xbdd7bdd7,0xc619a515,0x9cd4bdd8,0x9cd59cf5,0xa5159493,0x94b4a515,0x9cd5ad56,0xad77a4f5,0xa515a536,0xb597ad77,0x9cd48c73,0x9cd49cf5,0xb5b7a515,0xc619b5b7,0xbdf8bdf8,0xc659c639,0xc639bdd8,0xbdf8ce5a,0xce5abdd8,0xce5abdd8,
-0xad36b597,0xc5f9c619,0xad77a4f5,0xbdb8ce5b,0xc5f9c5f9,0xce5ac63a,0xb577bdf9,0xce7bce5a,0xd67bbdd8,0xef5ededc,0xad76b577,0xb597b5b8,0xd69bbdb8,0xef5ed6bc,0xbdd8b577,0x9cf4ad35,0xb597bdd8,0xad56b5b7,0xb597bdb7,0xb597b597,0xb5b7b576,0xbdf8b597,0xef5eb5b7,0xbdd8e71d,0xad36b597,0xad36a515,0xad56b5b8,0x9cd49473,0x94738c72,0xad76ad76,0xbdf8b5b8,0xbdd8ce7b,
-0xa4f49cf4,0x94939cb3,0xa5359493,0xbdd8bdd8,0xa515ad56,0xffffb577,0x9492e73d,0xb5b79493,0xbdb7ad76,0xad56bdb8,0xbdd8ce5a,0xa536a515,0xc619b597,0xa4f59cd4,0xa536ad56,0xb597b597,0xad76ad76,0xa515a535,0xbdd8b5b7,0xb597b5b7,0xad56a4f4,0x9cf4bdd8,0xce7abdd8,0xbdf8ad76,0xb597bdf9,0xad77b5b7,0xbdd8b5b7,0xce7bce5a,0xa536bdf9,0xc619ad56,0xbdd8ce5a,0xb5b8b5b8,
-0xe71dc63a,0xbdd8ce7b,0xdefdc65a,0xd6ddd6bc,0xd6bcd6bc,0xb5b8b5d8,0xbdf9bdd8,0xb5b7bdf9,0xad56ad76,0xb597a515,0xc639c639,0xbdd8bdf9,0xbdf9bdd8,0xce5bce5a,0xce5ace7b,0xb597b5b8,0xc63abdf9,0xbdd8c5f9,0xbdd9bdd9,0xd6bcdefd,0xce3abdf9,0xbdf9ad56,0xad56bdb8,0xc619bdd8,0xb5b7bdb7,0xc639b5b7,0xad76bdb7,0xc619a515,0xad76a535,0xd69bb597,0xd67affbf,0xbdb7d69b,
-0xc639e73e,0x8c529cb3,0xa5158c52,0xa536ad36,0xe71de71d,0xf7bfd6bc,0xb5b8e6fd,0xd67bbdd9,0xd6bcbdd8,0xd69bf7bf,0xd69cbdf9,0xdefdd6bc,0xb5b8bdd9,0xc63ace5a,0xf7bfbdd8,0xad77d69c,0xc619bdf9,0xbdf9dedc,0xdefcad76,0xbdd8d69b,0xc619c619,0xa536ad76,0xb5b8a536,0xef7fd69b,0xb5b8bdf9,0xb597bdd8,0xc619c619,0xb5b8b5b7,0xa536a556,0xbdf9ad77,0xad16bdd8,0xef3ed67b,
-0xbdb7bdd8,0xc618bdb7,0x8c31c5f8,0xbdd794b2,0x94928c51,0xb57694b3,0xa5359cf4,0xbdd8c639,0xdebbce5a,0xc639bdd8,0xb576ad76,0xc639c619,0xb597b597,0xa535ad56,0xbdd8c619,0xa4f5ad36,0x9cf5b5b8,0x9cf5a535,0xbdf9a515,0xb5b8a515,0xa516bdb8,0xad56a536,0xa515a536,0x94939cd4,0xad769cf4,0xc639bdf8,0xbdd8bdf8,0xbe18b5d8,0xb5d8c619,0xc65ace5a,0xad76bdf8,0xc619bdf8,
-0xa536ffff,0xc619b597,0xa516ad56,0xd6bcb5b8,0xad36b577,0xbdf9ce5a,0xb577bdf9,0xb5b7bdb8,0xad56ce5a,0xef7ec619,0xce5ace3a,0xbdd9ce5a,0xc63ace3a,0xce3ac5f9,0xb597e73d,0xb597b5b7,0xad76ad76,0xc619ad76,0xb5b7ad56,0xad56bdb7,0xbdb7ad76,0xb5b7b597,0xbdd8bdd8,0xf79fffdf,0x9cf4b577,0xa515a515,0xb597b577,0x94b3a515,0x9cb49cb4,0xd69bad56,0xad56ce5a,0xa53594b3,
-0xa535ad76,0xa535a535,0x9cb4a515,0xbdf9ad36,0xa535ad56,0xffdfbdd8,0xad56d69b,0xb5b7ad76,0xb597d69b,0xb5979cd4,0xc619ad56,0xad76c5f9,0xc619a4f5,0xb597ce5a,0xbdf9b5b8,0xb5b7c639,0xad76ad76,0xa515a515,0xd69bce5a,0xc639ce5a,0xdefcc5f8,0xbdf8b597,0xce5ab5b7,0xad76ce5a,0xb5b8bdf9,0xc619ad56,0xb5b8ad76,0xc619bdf9,0xad77bdf9,0xad57ad56,0xd67bc61a,0xbdf9b5b8,
-0xd69bbdd9,0xc619e73e,0xbe19b598,0xdefdd6dd,0xce9bdefd,0xc61ac65a,0xb5b8c61a,0xc619bdd8,0xbdf8bdd8,0xb5b8b597,0xc639c619,0xb5b8c63a,0xbdf9bdf9,0xbdd8b597,0xbdf9c63a,0xb5b8bdd8,0xb5b8c5f9,0xbdf9c619,0xbdb8bdd9,0xe71ebdb8,0xbdb8defd,0xb597c639,0xbdf8c63a,0xb597a515,0xbdf8c5f8,0xad76bdf8,0xbdf8bdf8,0xa535a4f4,0x9cd4ad76,0xad76a515,0xffffd67a,0xb5b7dedc,
-0xe71da515,0x94b3dedc,0x9cd49493,0xbdd8ad56,0xdefcbdf8,0xce7be71d,0xe71eef7f,0xc619bdf9,0xb597debc,0xef5fd69b,0xbdf9ce7b,0xd69cd69b,0xce7bef5e,0xc63abdb8,0xad77d67b,0xdedcef5f,0xb5b8b5b8,0xd69ba515,0xbdf8d69b,0xce7ae73d,0xb5b7bdd8,0xad56b5b8,0xa535a515,0xd69bb597,0xbdb8f79f,0xbdf9bdd8,0xb5b8a556,0xad76be19,0xad56a556,0xad36ad56,0xbdb8b577,0xc5f9bd77,
-0xce7ace5a,0xad55b597,0xad75b576,0x94928430,0x9cb394b2,0xad559cf4,0xb597a535,0xce39c619,0xad56a515,0xc618bdf8,0xad56ce7a,0xb5b7a535,0xa535b576,0xad56ad56,0xbdf9ad76,0xad56c619,0xad77b5b8,0x9cf59cf5,0xa536a536,0xad36bdd9,0xb577b598,0x94b49cf5,0xb597a515,0x8c728431,0xad569cf4,0xd69bc639,0xbdd8be19,0xbe18bdd8,0xce5ac65a,0xd6dbce7a,0xad76be18,0xbdd8ad76,
-0xef5ed6bb,0xbdd89cb4,0xa515c63a,0xbdd9ad57,0xc63ace5b,0xc63abdd8,0xc63ace3a,0xad77ad56,0xce7ad69b,0xd6bbb597,0xc639ef5e,0xc619c5f9,0xc5f9c639,0xce5aad56,0xdedcce5a,0xdedcce5a,0x9cd4c639,0xce5aad76,0xb597bdb7,0xb5b7bdb7,0xb597ad56,0xbdf8c619,0xce5ac619,0xffffc619,0xad76ef7e,0x94938c52,0xa5159cd4,0xb597b597,0xbdd89cd4,0xa4f5ad56,0xad56ad56,0x9cf5b597,
-0xa4f4ad56,0xa515a535,0xa5359cf4,0x94b4ad56,0xa536b597,0xa535ad56,0xd67ace59,0xbdf8defc,0xd69b9493,0xbdf8c5f8,0xad56ad76,0xa535c619,0xb577ad56,0xf79fd67b,0xce5ad69b,0xb5b7c619,0xbdb7c639,0xad76bdd8,0xce5ace5a,0xe73de71d,0xdefcd6bb,0xc639c639,0xad76ce7a,0xc619d6bb,0xbdf9b5b7,0xb597ad77,0xbdd8c619,0xce3ace5b,0xc5f9ad77,0xb577b598,0xc63abdb8,0xbdd8c63a,
-0xce5abdd9,0xdeddce7b,0xbe19e73e,0xce7bce9c,0xc65bd6bc,0xbe19d69c,0xc63abdf9,0xc63ac619,0xc619d6bc,0xb5b8b597,0xc619bdd8,0xc619ce7b,0xbdd8c63a,0xb577bdb8,0xc61abdd8,0xbdf9bdb8,0xbdd9c619,0xc619bdd9,0xbdf9ce5a,0xd69bbdd8,0xdebcdebc,0xce5ac619,0xce5abdb8,0xad56b597,0xdedcce3a,0xc63ac5f9,0xbdf8c619,0xbdd8bdd8,0xb597ad56,0xb597a536,0xe71db577,0xb597ffdf,
-0x9cd494b3,0xc639defc,0x94939cf4,0xbdf9a535,0xbdd8b597,0xdedcce7b,0xffffdedc,0xad57f79f,0xd6bcbdb8,0xc5f9ad77,0xd69cffdf,0xce5bbdf9,0xf7bfe6fd,0xb5b8ce5a,0xce7bc61a,0xef5ead36,0xb597ce7b,0xad77b597,0xdefddefc,0xd6bbb597,0xad77c619,0xa515ad56,0xb597b597,0xad77a536,0xbdf9c63a,0xa536bdd8,0xad579cf5,0xb5b8ad97,0xb5979d15,0x9494b597,0xbd98ad36,0xad15bd77,
-0xdedbc619,0xb5b7e71c,0x9cd38c51,0x7baea514,0x9cf38410,0xa5149cd3,0xbdf8a515,0xad56bdb8,0xa515ad56,0xce5aa535,0xc5f8ce5a,0xa4f4ad56,0xad35a515,0xad779cf4,0xa515a515,0xce5abdd8,0xb597ad56,0x94b4ad56,0xad56a515,0xbdd8ad56,0xb5b8b597,0x9493ad56,0xa5159cd4,0x94939cf5,0xb5979cd4,0xd6bbbdd8,0xb5d8ce9b,0xc639ce7a,0xce9ac659,0xc65ad6dc,0xb5b7be39,0xb5b7ad76,
-0xce39b597,0xad56ef3e,0xc63abdd8,0xa515a515,0xd69cbdd8,0xad57ce5a,0xce5abdd8,0xbdb8c619,0xce3abdf9,0xd69bef5e,0xdedcdedc,0xb597ce3a,0xbdb8bdb8,0xbdb8c619,0xd6bbce7b,0xf79fffff,0xa515d69b,0xb5b7ad76,0xbdf8b5b7,0xbdd8bdf8,0xad56ad56,0xc619bdd8,0xc619bdd8,0xb597ce5a,0xce3ae71d,0xa5159cf5,0xad36ad76,0xce5abdb8,0xbdd8d69b,0x9cd4a536,0xbdb89cb4,0x9cf4b597,
-0xb596a515,0x9cf4b5b7,0x9cf49493,0x9cd49cf4,0xce3aad56,0x9cd4bdd8,0xb5b7a515,0xffffe71c,0xb597b597,0xc619ce5a,0x8c72b576,0xd6bbad76,0xb597bdf9,0xc63ab597,0xc639ce5a,0xad77bdd8,0xd67ac619,0xce7ace7a,0xb597ad76,0xdefcbdf8,0xd6bbdedc,0xbdd7e73d,0xc618c639,0xdefca535,0xa536ce7b,0xbdd8bdd8,0xc619bdd8,0xb597ce5b,0xad7794b4,0xb598ce5b,0xbdd9ad77,0xce5bdedd,
-0xbdf9bdf9,0xd6bcce7b,0xef7ff7df,0xce7bc65a,0xc61ac63a,0xd69cc65a,0xd6bcd67b,0xc63ace5a,0xce7bce7b,0xbdd8ce5a,0xbdf9b5b8,0xc63ac63a,0xb5b8bdb8,0xad77b597,0xc63ab5b8,0xbdf9ce5a,0xbdf9bdd8,0xc5f9bdd8,0xd6bcdedc,0xc63ae71e,0xce5aa4f5,0xc5f9d67b,0xb5b7bdd8,0xad76bdf8,0xce5aa515,0xce3ace5a,0xb577c5f9,0xbdd8b597,0xad36ad56,0xad56b5b7,0xb597ad56,0xfffff77f,
-0x9cd4b5b7,0xf79fa535,0xad35d69b,0xa515a535,0xb5b7bdd8,0xd6bcb5b8,0xd69bd6bc,0xe6fdf79f,0xd69bbdd8,0xb597ef5e,0xffbfce7b,0xd67bce5b,0xef5ece5a,0xb597ef7f,0xce3aad57,0xb577ce5a,0xce5ae73e,0xc619bdd8,0xe73ec619,0xad56d6bb,0xc619dedc,0xa515ad56,0x9cd49cd4,0xad569cf5,0xad36ad36,0xa536b577,0xa5369cd4,0xb5d8a556,0x9cd4b597,0x9c949cf5,0xa4b49452,0xbd97b557,
-0xdefcb597,0xce7aef5d,0x7bf0ad55,0x94b27bcf,0x8c517baf,0xa5159cf4,0xb5b7a535,0x9493ad76,0xb5b7ad56,0xad35a535,0xbdd8c619,0xad56c619,0xa5159cd4,0x9cd4a535,0xad56ad36,0xce5ab597,0x94b4b5b7,0x9cd4ad56,0xb597ad56,0xad56bdd8,0xad56b597,0xb5b8c63a,0xa536a515,0xa535ad76,0x9cf49cf4,0xc619bdd8,0xd6bbd6dc,0xce9bbe19,0xbe39c639,0xc659ce7a,0xbdf8b5b7,0xad76bdd8,
-0xa535ffff,0xdedcce5a,0xbdd8a535,0xa515debc,0xad56a4f5,0xe71de6fd,0xbdd8ad77,0xce3ace7b,0xc619c5f9,0xef3ee73d,0xe71dbdd8,0xc61affdf,0xbdd8b5b7,0xce5ab5b8,0xd6bbce5a,0xffbfe71d,0xbdd8e71d,0xbdb8b597,0xce3ac619,0xc619c5f9,0xc5f9c63a,0xb597ad56,0xc619c619,0xb597bdf9,0xdebcad56,0xbdb8ce5a,0xc619c619,0xb5b7bdd8,0xbdf9c619,0x9cf4b577,0xa515a4f5,0xbdd8ad56,
-0xbdb7bdd8,0xad76bdf8,0xa5159cf4,0x9cb49cd4,0xbdf9b5b7,0xd69bd67a,0xb596ad56,0xffdfdedc,0xb5b7c619,0xc639ad56,0xc619b597,0xad56a535,0xb5b8c639,0xbdd8b597,0xbdf9ce7a,0xb597ad56,0xce39b597,0xbdf8d6bb,0xb5b7b576,0xb597bdd8,0xe71dce5a,0xbdf8ce7a,0xad56ad56,0xa515b5b7,0xc63ace5a,0xc63abdd8,0xbdd8bdf9,0xad77c61a,0xad77bdf9,0xbdf9b577,0xa536bdd9,0xe73ead36,
-0xc63ad69c,0xbdf9bdd8,0xd69cc63a,0xc63ac65a,0xbe1ace5b,0xc65abe1a,0xd69bd6bc,0xc619c63a,0xce7bb597,0xbdf9e71d,0xb5b8bdd8,0xc61abdd8,0xbdf9c61a,0xb598b5b8,0xbdb8b598,0xbdf9c5f9,0xb577c5f9,0xc5f9bdd8,0xe6fdbdf9,0xa4f5dedc,0xb597a515,0xce5ad6bb,0xb5b8bdd8,0xc619ad35,0xa535bdd8,0xc639c5f9,0xb597bdd8,0xb5b7ad56,0xa4f5b577,0xad56a515,0xb597b597,0xd67bbdb8,
-0x9cd4ffdf,0xad569493,0xdefcffff,0xad76c619,0xbdd8b5b8,0xad56ad77,0xce5adefd,0xffffc5f9,0xbdd8dedc,0xdefddebc,0xce7bad77,0xce7bffff,0xc61abdf9,0xef7fef7f,0xc5f9bdb8,0xbdd8ce5b,0xef5ea515,0xbdd8c63a,0xce7ace5a,0xef5ee73d,0xdefdce7b,0xad77ce5a,0xad77a536,0xb597ad77,0xb577ad56,0xbdf9b598,0xa536ad57,0xad97ad77,0xbdd8bdd8,0xad16a536,0xad15a4d5,0xbd77bd77,
-0xce5ac5f8,0xdebbdedc,0x83f0c5f8,0x7bcf736e,0x736d8c71,0xad558411,0xb597bdf8,0xb597ad76,0xbdb7ad76,0xa515c618,0xad56a515,0xce5abdd8,0xa535bdb8,0xad76a4f5,0xbdb8ad36,0xc5f9d69b,0xce7ad67b,0xad77ad56,0xad36b597,0xbdd8ce5a,0xc619ad77,0xf7bfbdd8,0xa515d6bb,0x9cd4ad56,0xa536a536,0xce7ba515,0xd69bce5a,0xce9bdf1d,0xbe19ce7a,0xbdf8bdf9,0xb5b8b5b7,0xb5b7be19,
-0xffdfd69b,0xe71db577,0xad76f79f,0xc5f9ad77,0xa516ad77,0xef5ebdd8,0xad77debc,0xdeddbdb8,0xc619e71d,0xc619ce3a,0xdefddebc,0xdedce71d,0xb597bdd8,0xc5f9ad77,0xd67bce3a,0xe71dce7a,0xf79ff7bf,0xc5f9ce3a,0xdedcd6bc,0xdedcdedc,0xd67bd6bb,0xb577c5f9,0xd6bcc63a,0xbdf9c619,0xb597b597,0xef3edefc,0xbdb8c619,0xad36bdb8,0xc5f9a515,0xa515bdb8,0xa515a535,0xbdd8a515,
-0xbdd8c639,0xbdf8bdf8,0xa535ad76,0xa5159cd4,0xb5b8bdd8,0xbdd8ad56,0xc5f8ce7a,0xffffc618,0xad56bdf8,0xad569cd4,0xdedcce5a,0xad56d67a,0xdedcbdf9,0xad77c5f9,0xce5ab5b8,0xbdd8c619,0xbdf8c619,0xce39bdd8,0xad56ad56,0xa515ad56,0xffffc619,0xad76ce7a,0xbdf8ad76,0xb597c619,0xd69b94b4,0xce5adefd,0xc63ac63a,0xc5f9bdd8,0xa515ad56,0xb598a4f5,0xb598bdd9,0xb598ad57,
-0xdefdc63a,0xb577c5f9,0xbdf9b598,0xb5d9ce9c,0xbdf9b5b8,0xc65bc63a,0xce7bd69c,0xbdd8ce7b,0xb5b8ad56,0xce5ace7a,0xbdd8ad56,0xc5f9bdb8,0xce5ac619,0xc5f9c63a,0xbdb8bdd8,0xb5b8bdd8,0xbdf9c61a,0xa536ad56,0xbdd8ad77,0xad36ad56,0xad56b597,0xd6bcbdb8,0xad36d67b,0xb597b597,0xb597c5f9,0xc619b5b8,0xad56bdd8,0xa4f5ad36,0xad56b597,0xa4f59cb4,0xc5f9ad56,0x9493b597,
-0xef5ece5a,0x9cf49cf4,0xffffb597,0xb597e71d,0xbdd8b5b8,0xce5abdd8,0xe6fdb598,0xc61ad69c,0xdefdffdf,0xc61aad77,0xad57debc,0xffdfce7b,0xb598c63a,0xdefda536,0xad77e71d,0xce5ab598,0xb5b8ce7a,0xd69bef5e,0xdedcbdd8,0xf79fbdd8,0xb597e71d,0xce5adedc,0xad56b597,0xb597b597,0xa536b577,0xb577ad57,0xb5b8ad57,0xa536a556,0xad56ad56,0xad57b577,0xad16b556,0xbd97acf5,
-0xd6bbce7a,0xce59d69b,0xce79d67a,0x630c8430,0x738e736e,0x94b36b4d,0xce7ac639,0xad76b597,0xbdb7bdd7,0xbdb7ad55,0x94b3a535,0xbdd8b597,0xb5b8ce5a,0xb597b577,0xad76bdd8,0xdedcdefc,0xce5abdf8,0xb5b7c619,0xb577b597,0xad77a516,0xd69bb5b8,0xc63ae73e,0xb5b8dedc,0xa5159cb4,0xad36a4f5,0xad77a535,0xce7bd6bc,0xdf1de73d,0xce7bce7a,0xb5b8bdf8,0xb5d8b5d8,0xc65ab5b7,
-0xc639c619,0xc619ffdf,0xef5edefc,0xad56ad56,0xad56b597,0xd69bad56,0xef5effff,0xdedcc619,0xe73df7bf,0xbdb7bdd8,0xe71dc619,0xe71def5e,0xd6bcf7bf,0xc5f9b577,0xc63ac619,0xce5ace7a,0xdedcc639,0xdebcef3e,0xdedcd6bb,0xe71ddebc,0xce5ae71d,0xc639ce5a,0xbdf8b5b8,0xc63ac63a,0xbdf9c619,0xd69bbdf9,0xa515c63a,0x9cd59cf5,0xa536a536,0xad36ad77,0x9494ad77,0xc5f9ad57,
-0xb5b7b5b7,0xb597bdb8,0xad77ad77,0xa536a515,0xb577a4f5,0xad56a515,0xce5ad69b,0xffffb597,0xc619ce7a,0xad76bdb7,0xe73dc619,0xc619defc,0xc619bdb8,0xb5b8defd,0xc619bdf8,0xce5ace7a,0xce5ad69b,0xbdd8bdb8,0xb577c5f9,0xb5b8ad76,0xd69bf7bf,0xd6bce73e,0xbdf8b5b7,0xb5b7ad76,0x9cf4d69b,0xef5ee71d,0xce5ad69b,0xad56bdd8,0x9cf5ad77,0xb577ad36,0xbdf9ad77,0xad57bdd9,
-0xdedcb5b8,0xbdf9e6fd,0xc63abdd9,0xbdf9ce7b,0xb5b8ad77,0xc63aad97,0xce5ac63a,0xef5ece5a,0xc619c639,0xd6bbc639,0xb5b8c619,0xbdd8bdd8,0xbdb8b5b8,0xce3ac5f9,0xb597bdf9,0xad56ad77,0xc61ab577,0xad56ad57,0xa515ad57,0xad56a536,0xa515b5b7,0xa535a4f4,0xc619c639,0xb597ad56,0xc639ad56,0xbdd8b5b8,0xce5ace5a,0xbdb8ad36,0xb597b597,0xb5b7b597,0xc5f9ad76,0x8411ad36,
-0xbdd89cd4,0xad56e71d,0xb597ad76,0xce5affff,0xad76a536,0xc619c63a,0xa516bdd9,0xdedcd69c,0xffdfc63a,0xbdd8e71d,0xc619c619,0xd6bcb5b8,0xc619ffdf,0xbdf9b5b8,0xef5ededc,0xb598a515,0xbdf8dedc,0xffdfbdd8,0xb597dedc,0xbdf9c63a,0xce7ad6bc,0xe73ebdd8,0xad56d69b,0xad56ad77,0xa515ad77,0xad56ad56,0xb597ad56,0xa515a536,0x94939cf5,0xbdb8a515,0x9c94b556,0xb556ad15,
-0xd69bc619,0xce59d67a,0xdebbce59,0x7bcf9472,0x84107bae,0x8431ad35,0xd67ab576,0xb597d69b,0xad76c619,0xa5159cf4,0x9cf4ad76,0xa4f59cd4,0xbdf9b597,0xb5b7bdb8,0xce3ab597,0xd67bc619,0xbdf8ce7a,0xbdf8c619,0xb577ad76,0xa515ad36,0xc639ad56,0xe73ec619,0xce5abdb8,0x9473c5f9,0x9cd49cd4,0xad77ad76,0xce9bb5b7,0xdefcd6bb,0xce7adf1d,0xad76c65a,0xb5d8a576,0xb5d8b5d8,
-0xc619ce5a,0xffffd6bb,0xdefcbdd8,0xad77f77f,0xc619a515,0xa535ad76,0xf7bfd69b,0xd69bf77f,0xffffef5e,0xbdd8e71d,0xbdf9b597,0xef5ee71d,0xffdfef7f,0xad56ce5a,0xb577a535,0xc5f9c5f9,0xc619bdb8,0xffffe71d,0xce5adebc,0xce3ace3a,0xe73ed69b,0xce7ae73e,0xb5b8bdd8,0xd69bc639,0xbdd8bdd8,0x9cd4a515,0xbdd9bdb8,0xb597ad56,0xad36ad57,0xa4f59493,0xad36ad36,0xad57ad56,
-0xad76ad36,0xc5f9bdd8,0xb5b8c619,0xb577ad56,0xa536a4f5,0xa515a536,0xbdd8a515,0xf7bfbdd8,0xce7ac5f9,0xb597ce3a,0xad56a535,0xbdb8dedc,0xb5b7b597,0xce7bb597,0xce5ac619,0xb5b8bdd8,0xce3ace5a,0xbdd8ce3a,0xbdd8b597,0xce7aad77,0xb597c619,0xffffad56,0xad76defc,0xffdfffdf,0xce5ac63a,0xe73db5b8,0xe73effff,0xb5b8c619,0xc63ab5b8,0xc63ace5a,0xb598ad57,0xad57c63a,
-0xbdf9ad56,0xc63ac63a,0xbdf9c63a,0xad57b5b8,0xad77ad98,0xad77b5b8,0xce5abdf9,0xdedcc619,0xbdf9d6bc,0xbdf9bdf9,0xc63ad69b,0xa536b5b8,0xad57ad56,0xbdf9ad77,0xbdf9ce3a,0xad57b597,0xb5b8b5b8,0xb597c5f9,0xb597b577,0xb577ad57,0xbdf8bdf8,0xad56a535,0xbdf8ad76,0xb597c5f8,0xad56b597,0xa536b597,0xb597b577,0xce5ac639,0xa536b5b8,0xbdb8ad56,0xad56b577,0x9493ad36,
-0x8c738c52,0xef5eb5b7,0xb597bdf8,0xffffbdd8,0xc63adedc,0xb597b597,0xa515ad57,0xd69ba536,0xce5adedc,0xdefdffff,0xc63ab597,0xad56ce5a,0xffffce7b,0xb5b8ce7b,0xe6fdc619,0xb5b8e73e,0xd6bbbdf9,0xbdf8bdf9,0xce5af79f,0xc639b5b7,0xd69bc619,0xbdd8ce5a,0xce7bef7f,0xad56a536,0xad56ad77,0xb597ad77,0xa556ad77,0xa536a556,0x94b4a515,0xbdb89cb4,0xa515bdd8,0xbdb8b576,
-0xce7ac619,0xce59ce5a,0xa514bdd7,0x9cd38c51,0x9cb39cd3,0xb5b6bdd7,0xb5978c72,0xd67adedc,0xad76b5b7,0xa535a535,0xb597ad35,0x94938c52,0xb577ad56,0xb5b7c619,0xbdd8bdf8,0xbdd8ce5a,0xd6bcbdb8,0xce5ac619,0xa535c619,0xad36bdd8,0xbdd8a515,0xc5f9ce5a,0xbdf8dedc,0x9cf5ce5a,0xad368c52,0xbdd8ad56,0xa536ad77,0xdefcce7a,0xe75edefd,0xbe19ce7b,0xad97a576,0xb5f8bdf8,
-0xf79fc619,0xf77fffbf,0xc619ffbf,0xdedce71d,0xb597b5b7,0xce3abdd8,0xdebcce3a,0xe6fdf77f,0xdedbce5a,0xef3dffff,0xb597bdb7,0xd69bc5f9,0xdeddd69c,0xbdf9dedd,0xb577ad36,0xbdd8b597,0xc5f9bdd8,0xdefcdebc,0xce5affdf,0xbdd8b577,0xdedcbdd8,0xbdd8e71d,0xdedcc619,0xb5b7bdf9,0xad56b597,0x94b4ad56,0xbdd89493,0xbdf9ce7b,0xa515bdb8,0xa5159493,0xbdb8bdb8,0x8c52ad77,
-0xa5159cf5,0xb597b597,0xbdd9c63a,0xbdd9bdd9,0x9493b598,0xad369cf5,0xb5979cb4,0xffbfc63a,0xbdd8ce3a,0xce5adebc,0xad56ce5a,0xdebca515,0xc619defd,0xbdd8ad76,0xbdf8ce7b,0xc619b597,0xdeddc63a,0xce7bd69b,0xa536c619,0xbdf9b5b8,0xad56c63a,0xb5b8b5b8,0xffffdefd,0xffdfce5a,0xffffffff,0xb597ce7a,0xdedcd6bb,0xce5ac619,0xd69bce5a,0xce5bd6bc,0xb577bdb8,0xbdd9ad57,
-0xb597bdf9,0xdefdb597,0xb598defd,0xad779d16,0x9cf5ad77,0xad97b5b8,0xb597ad56,0xce7bbdf9,0xc639bdf8,0xbdf9bdd8,0xc63ac619,0xad77ce7b,0xbdd9b597,0xb597ad77,0xce5bce5b,0xb597bdd8,0xb597ad77,0xb577bdd8,0xa536a536,0xce7aad56,0xbdd8ce5a,0xad76b597,0xad769cf4,0xbdd8b576,0xc63abdf9,0xad56ad56,0xa4f5ad36,0xd69bbdb8,0x9cd4bdd8,0xa515a515,0xa4f59cd4,0x94b49cd4,
-0x9cd48c73,0xc63a9493,0xad56ef7e,0xc63aa535,0xce5affff,0xa536ad77,0xb5979cf5,0x9cd4a516,0xd69bce7b,0xffffbdf9,0xad77ef7f,0xd6bbc63a,0xc63aad56,0xce7bffff,0xb5b8b5b7,0xffdfffff,0xbdd8b597,0xc639ce7a,0xf79fce5a,0xad77c619,0xc619c619,0xc639defc,0xe71dc63a,0xb597c619,0xad77ad97,0xad97ad56,0xb597b5b8,0xa515ad77,0x94939cd4,0xad769cf4,0xb577ad76,0xbdf8b576,
-0xc639ce3a,0xc618bdf8,0x9cb3b5b7,0x9cd39492,0x94929cf3,0xbdd7a514,0xb596ce59,0xce5ab576,0xb597c639,0xa515ad55,0xad76ad76,0x8c32a4f5,0xbdf99494,0xd69bce3a,0xc619bdd8,0xc5f9b5b8,0xbdd8b577,0xbdf9d69b,0xc5f9b5b8,0xad77a4f5,0xa5159cf5,0xc619c619,0xf7bfce5a,0xc5f9b597,0xa4f5ad76,0xbdb8b597,0xad56b5b8,0xd6dcb5b7,0xd6bbd6bb,0xc65ad6dc,0xa576bdf8,0xb5d8b5b7,
-0xc5f9d69b,0xce5ae71d,0xf79fd67a,0xe73dce5a,0xad36e71d,0xce5aad56,0xce5ad69b,0xf77edebc,0xce59f79e,0xe71def3d,0xad76c639,0xb577bdd8,0xbdd9bdd8,0xe73ededc,0xb597ce5a,0xce5ab598,0xd69bce5a,0xd69bd67b,0xf7bfef3e,0xb597bdf8,0xa536b597,0xd69bc619,0xce7bd69b,0xa536bdf8,0xa5159cf5,0x9cf5a536,0x94b48c52,0xce5ac5f9,0x9cb4b577,0xc6199cd4,0xa515ad36,0x8c739cd4,
-0xad569473,0xb577c619,0xbdb8bdb8,0xdedcce7b,0xbdb8debc,0xb5b8b597,0xb597c5f9,0xffffbdd9,0xc5f9ef5e,0xef5edefd,0xdedcef5e,0xc639bdb8,0xef3eef7f,0xa535dedc,0xd6bbb5b7,0xad76ce7a,0xc5f9ce3a,0xce3ace7b,0xb5b8d6bc,0xb5b8ad56,0xb597bdf9,0xbdf9b5b8,0xce7bbdf8,0xd69bffdf,0xce7ace7a,0xdedcd6bb,0xd69b9cf5,0xd69bffdf,0xc619c619,0xb5b8ad57,0xa516bdf9,0xb5979cb4,
-0xc63ac63a,0xdedcc619,0xce5bd6dc,0xb5d8be19,0xad989cf5,0xce7bce5a,0xa515ad56,0xbdd8b597,0xc639b5b7,0xb5b7c619,0xb597ad56,0xc63ab5b8,0xb597bdb8,0xad77ad56,0xbdf9b5b8,0xb5b8bdf9,0xb597ad56,0xad779cb4,0xad56ad36,0xbdd8b597,0xad56bdf8,0xbdd8b597,0x9cd4a535,0xce7abdd7,0xd6bbce3a,0xbdb8c639,0xad36bdb8,0xbdf9ad77,0xc5f9debc,0x9493a515,0xb5979cb4,0x84119cd4,
-0x94b38c72,0x9cd4b597,0xffdfdedc,0xbdd8c63a,0xffdfad76,0x9cf5d6bc,0x9cf5a515,0x9cd4a536,0xce5a94b4,0xc619ce7a,0xe73effff,0xd69bbdd8,0xad56c619,0xe71dd69b,0xb597b597,0xf79fc639,0xc619f7bf,0xdedcb597,0xc619ce5a,0xc619ffdf,0xd69bb597,0xd6bbce5a,0xbdf9d69b,0xc63ace7b,0xb5d8bdf8,0xb5b7ad97,0xc619bdf8,0xa515b5b8,0x9cd4ad36,0x9cf59493,0xbdd8a515,0xad76bdf8,
-0xbdd8bdb8,0xc619bdf8,0x9cd3ad56,0x9cd39492,0xad55ad75,0x94b29cd3,0xdedbc618,0xb576b5b7,0xc5f8bdd8,0xad56b596,0xa5159cd4,0x94b49cf5,0xa5158c73,0xbdd8d67b,0xce5ae6fd,0xb597bdd8,0xbdd8ad56,0xd69bd69b,0xdedcbdd8,0x9473c5f9,0x8c739cd4,0xb5779cb4,0xb5b8ce3a,0x94b4c5f9,0xad56bdd8,0xbdb8a536,0xc619b5b8,0xbdf8b5b8,0xd6dcdefc,0xd6dcdefd,0xbe19be39,0xadb7ad97,
-0xd69bffff,0xd67a9493,0xdefcdedc,0xce5af77e,0xce5adebb,0xbdb7bdd8,0xc619c5f9,0xdedcdebc,0xef7effff,0xdebbce7a,0xc619defc,0xa515ad36,0xbdf99cf5,0xc63abdd9,0xce7bdedc,0xc5f9c61a,0xc639ce5a,0xce5abdd8,0xef5ec63a,0xce3affdf,0xad56bdd8,0xef7fbdf8,0xc619ef5e,0xce7ac619,0xa516a515,0xad57ad77,0xad57b598,0xe71dad77,0xb577ce5a,0xb597a516,0xad56b5b8,0x8c5394b4,
-0xa4f59cb4,0xb597ad57,0xc5fac5fa,0xd6bcce5b,0xdeddef5f,0xad56bdb8,0x9cf5b597,0xe71da516,0xbdd8f77f,0xce5ac5f9,0xe71de73e,0xad36ce5a,0xef5ece5a,0xdedcffff,0xc619bdf9,0xb597dedc,0xad56b597,0xbdd8ad57,0xc619c619,0xb597b577,0xc63ab5b8,0xb5b8c619,0xb597bdf9,0xf79fdefd,0xc639d69b,0xce7abdd8,0xd69bce5a,0xffdff79f,0xc619ce7b,0xb597bdd8,0xbdb8b598,0xa516a516,
-0xd6bcb597,0xad77bdd8,0xc65aad77,0xbdf9ef5f,0xad77ad97,0xc61ab5b8,0xa515c619,0xc63ab597,0xce7ace5a,0xb5b8bdf9,0xad56bdf8,0xbdd8ad77,0xa515b5b8,0xad56a515,0xb597a536,0xc63ac63a,0xb597bdd9,0xb577ad77,0xb597a515,0xa535ad77,0xbdd8a535,0xce7ace59,0xb597ce7a,0xd69abdd8,0xc63ac639,0xb5b8c619,0xb577a515,0xad76ad36,0xef7ece5a,0xad56c619,0xa5159cf5,0x8c73ad36,
-0xa51594b4,0xad779cd4,0xef5ea515,0xce5affdf,0xbdd8bdf9,0xdedcffff,0x9cd49cf5,0xa5159cf5,0xad56a515,0xb5b8c63a,0xffffc619,0xad56e73e,0xd6bbce5a,0xb5b8ad56,0xc639defd,0xc5f9c5f9,0xef5ef79f,0xb5b7bdd8,0xbdd8dedc,0xf7bfbdf8,0xb5b8ce7b,0xc619ce7a,0xd6bcc63a,0xdedcb5b8,0xd6dbdefc,0xbe19be19,0xbdf9c619,0xad76bdd8,0xb597a4f5,0x9cd4a515,0x9d159cf4,0xad97ad96,
-0xbdd8ad77,0xbdf8c619,0x8c319cf4,0xad348c31,0xc5f7b595,0xa4f4b5b6,0xd69a9cd3,0xb596ef7e,0xb596ad76,0xa535bdd8,0xad56ad35,0x94739cd4,0xa515ad36,0xce3a8c32,0xe73ed67b,0xb577c619,0xc619bdd8,0xdebcbdd8,0xbdf8d69b,0xb5b7c619,0xb597a515,0x9cd49493,0xa515b5b8,0xb5979cd4,0xbdd8ad36,0xb577b597,0xc63abdf8,0xbe19c639,0xe75ec65a,0xd6bbe73e,0xad97ce7a,0xad97ad97,
-0xffffef3e,0x9493c5f8,0xef5eb597,0xf79fef5e,0xd67ace39,0xbdb7dedc,0xb597a4f4,0xc639c639,0xffbfce7a,0xc618f79e,0xdebbdefc,0xad36c5f9,0xbdf9a536,0xbdd9ce3a,0xdeddc619,0xbdd8defd,0xd69bbdd8,0xc5f9c63a,0xc619d67b,0xffdfdefc,0xbdf9ce5a,0xd67bc5f9,0xdefce71d,0xce5ace7a,0xb5b8c619,0xb5b8b598,0x9cf5ad36,0xad77a515,0xbdf9e6fd,0xad56ad56,0xa4f5a516,0x84119473,
-0x94b48c32,0xa5159cd5,0xc63ab577,0xe73ededc,0xc61ae71d,0xb577a516,0xb5779cd5,0xd6bcc619,0xbdf9debc,0xbdd8c61a,0xef5fad77,0xc63ad69b,0xc63abdd8,0xf79fffdf,0xad76c63a,0xce7bc619,0xdebcb5b8,0xa536c619,0xc5f9c61a,0xbdd9b597,0xbdf9ce5a,0xc63abdd8,0xc619b5b8,0xdedcce5a,0xce5ae73e,0xb597c639,0xd6bbbdf9,0xe73eb5b8,0xc619ef7f,0xc619c619,0xad77a515,0xb5b8bdd8,
-0xbdf9b597,0xc619ce7b,0xad77ad77,0xf79fdefd,0xa536b5b8,0xbdf9a556,0xb597bdd8,0xb5b8ad56,0xce5ace5a,0xce5ace7a,0xbdf8c639,0xad77b597,0xbdf9c619,0xad56ad77,0xb5b8ad77,0xce7bc619,0xc619dedc,0xa536bdb8,0xb577a535,0xad36bdb8,0xad76ad76,0xc639c619,0xd69ad67a,0xb597b597,0xc5f9d69b,0xbdd8bdf9,0xa535ad56,0xb597bdb8,0xdedcad56,0xc619f79f,0xb597b5b7,0x9cf594b3,
-0x94b494b4,0x94b494b4,0x9cf5ad77,0xf79fd69b,0xb597bdf9,0xffdfa536,0xad56d69b,0xa536a515,0xa536b597,0xce5aa535,0xbdd8c619,0xe71df7bf,0xce5aad77,0x9cf4d69b,0xf77fbdf8,0xbdf8c619,0xf79fce7a,0xb5b8e73d,0xc639bdd8,0xbdf9c619,0xe71dffff,0xc63abdd8,0xd6bcbdf8,0xbe19e73e,0xf7dfffff,0xce9bc65a,0xb5b7c639,0xbdb8bdf8,0xad56ad77,0xa536b597,0x9cf5a515,0xa535a535,
-0xbdd8bdd8,0xad56b5b7,0x84109cd3,0xb5769472,0xbdf7a514,0xad55c638,0xad75ad55,0xffffdedb,0xad35b597,0xad76b5b7,0xa535a515,0x9cd4a515,0xad57a536,0x9cd59cd4,0xd6bbdebc,0xc619bdf8,0xb597c619,0xc5f9debc,0xd6bbdebc,0xd6bbb5b7,0xb597debb,0xad56ce3a,0xa5159493,0x9cf5a4f5,0xb597ce3a,0xbdb8d69b,0xd69bb597,0xc639ce7a,0xc65ac639,0xe73df7bf,0xc67ac65a,0xb5d8ad97,
-0xe73dce3a,0xd69bffdf,0xce39a4f4,0xfffff7bf,0xdedbffff,0xdedce6fc,0xb576c619,0xb597c619,0xc5f8bdf8,0xef5ef77f,0xdedcbdb8,0xb577e6fd,0xb577ad36,0xc61abdd9,0xd69cbdd9,0xdedde73e,0xc619bdf9,0xbdd9c61a,0xb5b8b597,0xef3ebdd8,0xc639f7bf,0xc5f9b597,0xc619c63a,0xce5ace5a,0xd69bb5b8,0x9cd4a536,0x94b3ad57,0xa4f5a4f5,0xbdd89cd4,0x9cf4ad56,0xb597ad36,0x8c73b5b8,
-0xad569493,0xa536ad56,0xc619a516,0xdedcdedc,0xc5f9bdb8,0xad77c619,0xbdb9b598,0xbdd8ad36,0xb598defd,0xc5f9defd,0xc61ac5f9,0xd69cdedd,0xc63ac63a,0xef7fd6bc,0xd69bdedc,0xbdd8bdf8,0xce3ace7b,0xbdd9d6bc,0xbdd8bdd8,0xad77bdd8,0xbdd8b597,0xbdf9b597,0xce7bd6bc,0xbdd8bdd9,0xe73ededc,0xc63ad6bb,0xb597ad56,0xa536bdf9,0xd69bdedc,0xa535bdd8,0xb597b597,0xa536b5b8,
-0xad77ad77,0xe71eb598,0xb5b8c63a,0xce7bb5b8,0xb5b8ef5e,0xad77ad77,0xce5abdd8,0xa536bdd8,0xad56a536,0xdedcce5a,0xce5ad67b,0xad56b597,0xbdf9a515,0xad57b597,0xa536b577,0xbdf9bdf9,0xc639ce5a,0xad77c63a,0xad56a515,0xce5ab5b7,0xb597c5f9,0xd69bbdd8,0xce7ace7a,0xb577ce5a,0xc619b597,0xad76b5b8,0xbdf9c619,0xbdf9b577,0xad36b5b7,0xf77fe6fd,0xb5b8bdf9,0x9cd49cb4,
-0xad57b577,0x94b49cb4,0xad369cd5,0xe6fdb577,0xad77ef3e,0xb5b8bdd9,0xd69bffff,0xa4f5a536,0xbdf8a515,0xad35bdd8,0xad56bdd8,0xf79fa515,0xad57ffbf,0xe6fdbdd8,0xb598b597,0xbdf8d6bc,0xc619d69b,0xdedcd69b,0xad76ad76,0xc63ac639,0xffdfce5a,0xbdd8ef5e,0xce5ace7a,0xdedcef7e,0xffffd6bb,0xb597be19,0xb5b7bdd8,0xad76b5b7,0xb597ad76,0xad56ad56,0xa515ad76,0xad76a515,
-0xd69ac619,0xb597b5b7,0x9492a514,0xa514a535,0xad35bdb7,0xce59bdd7,0xad55b576,0xce7aad56,0xad56ef5e,0xb597a535,0xa535ad76,0x9cd49cd4,0xa4f59cd4,0xa535c619,0xbdd8a515,0xdefcce5a,0xc619c639,0xd69bbdf8,0xef7ed69b,0xad36ce3a,0xc63ace5a,0xad36b5b7,0x94b4a4f5,0xa4f59cb4,0xc61aad56,0xdedcbdb8,0xbdd8c639,0xc659d69b,0xc639c659,0xe75ec67a,0xb5f8defc,0xbe19b5d8,
-0xce5adebc,0xfffff79f,0xad76ce39,0xffdfe71d,0xffffffdf,0xe71ce71d,0xe6fdf79f,0xc5f9ad56,0xbdd8c619,0xdefcc639,0xb597ce5a,0xc619bdb8,0x9cd5a515,0xb577a4f5,0xbdd9bdd9,0xd69cce5b,0xa536e6fd,0xce3aa536,0xb597bdb8,0xc619c5f9,0xe71ddebc,0xb5b8ad77,0xce5bd69b,0xd6bcc619,0x94b4ad56,0xa4f5bdd8,0xad569493,0xa4f59cb4,0xad36a515,0xa515b597,0xad36b5b7,0xad77ad36,
-0x94938c52,0xb576ad76,0xb5b8ad56,0xb597ce5a,0xb598ad57,0xbdf9b598,0xad57bdb8,0xa536a516,0xb597c619,0xce5bc61a,0xbdd9d67b,0xce3ab598,0xc61ace5b,0xbdd8a516,0xce7be71d,0xbdf9ce7a,0xce5bbdf9,0xce5bc63a,0xbdf9bdd8,0xb597ce7b,0xb597bdd8,0xbdf9b5b8,0xce7bc619,0xbdd8ce5a,0xe71dad77,0xce5affdf,0xb5b8bdf9,0xc63abdd8,0xce5aad77,0xbdd8c63a,0xce5ac619,0xbdd8ce5a,
-0xce5ace7b,0xbdd89cd4,0xce7bf79f,0xb597ad56,0xdedce71d,0xb597bdd8,0xbdf9a536,0xbdd8b5b8,0xa536ad77,0xd69bc619,0xce5ace5a,0xad56b597,0xb597b597,0xc61ac63a,0xb577b5b8,0xad77bdd9,0xc639ad56,0xc619ce7a,0xad77ad56,0xbdd8bdb8,0xb577d67b,0xce7abdb8,0xce5adefc,0xce5ad67b,0xb577ad36,0xad56bdd8,0xce5ab597,0xbdd8bdf8,0xb597ce7b,0xe71dad57,0xc61aef7f,0x94949cd5,
-0xce5aa516,0x9cb4ad36,0xad36a515,0xad36ad36,0xef3ededc,0xbdf9bdd8,0xffdfbdb8,0xad36e71e,0xa535ad56,0xbdd8bdd8,0xbdd8a515,0xb577c5f9,0xe71df7bf,0xce5ab5b8,0xa516c61a,0xc639b577,0xad77ce5a,0xd69bb597,0xa535c63a,0xce5abdd8,0xbdf8d69b,0xef7effff,0xd69bb5b7,0xe71ce73d,0xc639defc,0xd69be73d,0xbdf8b5b7,0xbdd7c618,0xb5b7ad76,0xb5b7bdd8,0xbdd8b597,0xad76b5b7,
-0xce7ab5b7,0xb576e71c,0xad35ad55,0xb596a514,0xad35b576,0xc5f8ad55,0xc618c619,0xad55ad56,0xef5ec639,0x9cd4ad76,0x9cf4ad56,0xa5159cd4,0xb5b8a515,0xce3ab577,0x9cd4b577,0xdebcc5f9,0xad56e73d,0xc639a535,0xce5ac639,0xbdf9d67b,0xbdd89cf4,0xa535c619,0xd67bb5b8,0xad77b598,0xa536ad36,0xc639debc,0xce5adefc,0xce5ab5b7,0xbdf8c639,0xce9ac639,0xc67adf1d,0xadb7add7,
-0xe71de73d,0xffbfc5f8,0xdedcffff,0xdedbad55,0xce7aef5d,0xbdd8ffdf,0xffdff79f,0xb597ce3a,0xce5ace3a,0xbdd8d69b,0xb577ce5a,0xad57a4f5,0x9cd4b577,0xad77a4f5,0xbdb9bdd9,0xc61abdd9,0xdebddefd,0xb5779cf5,0xbdf9ce7b,0xb577bdd8,0xef3ea515,0xa515d67b,0xc5f9a515,0xb597b5b8,0x9493c639,0xb5979cd4,0x9cd4a515,0x9cf59cd4,0xad56a536,0xbdd8ad77,0xad36b577,0xb597b597,
-0x9493ad56,0xa515a515,0xad36a515,0xbdf9c5f9,0xa516ad77,0xb5b8a515,0xa4f5bdd9,0x9cd59cf5,0xb5b8a536,0xc5f9c619,0xe6fdef5f,0xbdd9bdb8,0xc61ace5b,0xb577b597,0xef5ec619,0xd6bce73d,0xbdd9b598,0xc63adedd,0xc63abdd9,0xbdf9c619,0xb5b8b597,0xc63abdd8,0xce5ad69b,0xc619d69b,0xc63ac63a,0xce7ace5a,0xc619c619,0xb597bdd8,0xb5b8ce7a,0xd69bce5a,0xd69be71d,0xce5ad69b,
-0xc63ac63a,0xad779cd4,0xe71dc63a,0xad77c619,0xce7bad56,0xa515d69b,0xad77a536,0xc619bdd8,0xad56bdd8,0xad77ad56,0xdedcc639,0xa536bdf8,0xbdd8bdd8,0xd69bbdb8,0xb598c61a,0xa516b597,0xbdd8b5b8,0xc63ad6bc,0xbdd8c619,0xad76ad56,0xbdd8bdb8,0xb577b5b7,0xd6bbbdb8,0xce3ad69b,0xb597ce5a,0xbdb8ad77,0xc619bdd8,0xce5ad67b,0xce3abdd8,0xc5f9bdd8,0xce7bdebc,0xa516a515,
-0xb5b8a515,0xa4f5b597,0x9cf59cd5,0xb597a516,0xce7bb598,0xbdf9defd,0xbdb8b5b8,0xd69bffff,0xad76ad56,0xbdf8b5b7,0x94b3a536,0xbdb8b5b8,0xdefda536,0xb597ef5f,0xd69bce7b,0xc619b5b8,0xc619defd,0xad77ad76,0xc639d69b,0xb597a535,0xce7ae6fc,0xffffe71d,0xce7aef7e,0xd69ace7a,0xc63ace7a,0xd69bad76,0xa535c619,0xad76b5b7,0xb5b7ad96,0xb597b5b7,0xb5b7ad76,0xb5b7bdf8,
-0xc659b5b7,0xd6bbdebb,0x9cd3a515,0xa514a515,0xa5149cd3,0xb5969cf4,0xd6bbc619,0xb576ce7a,0xce5a9cf4,0xa515d6bb,0xb5769cd4,0x9493b576,0x9cd49cd4,0xad5694b4,0xad56ce3a,0xdedcb577,0xce5af79f,0xb597ad56,0xb5b7bdb7,0xdefdb5b8,0xbdd8bdd8,0xce5ad69b,0xffdfc63a,0xc5f9d69b,0xbdf8c5f9,0xef7fbdd8,0xdebbdedc,0xc639c639,0xce7ad6dc,0xb5d7c639,0xcebbadb7,0xb5d8be3a,
-0xffffc639,0xce39ef7e,0xffffffdf,0xc618ce7a,0xd6bbdefc,0xdedcdedc,0xe71dce3a,0xe6fdffff,0xce39bdd8,0xb597c5f8,0xb597ad36,0xad57bdb8,0xad57ad77,0xb598ad36,0xbdf9c5f9,0xad77c5f9,0xe6feb598,0xbdb8ce7b,0xce5bd6bc,0x9cd4a515,0xc63aad56,0xef7eef3e,0xad77bdb8,0xa536ad56,0xd67bc5f9,0x9cb49cb4,0x9493a515,0xa5159cd4,0xb577ad36,0xad56b577,0xbdb8b5b8,0xad56ad56,
-0x9cb4a4f5,0xad76a515,0x94b4a515,0xbdd8ad56,0xbdb8c63a,0xb597b597,0xb597bdd8,0xa4f5a515,0xad779cd4,0xb577c61a,0xe71ebdb8,0xb577debd,0xce5bc5f9,0xce7bc63a,0xd69bbdf8,0xe73dffdf,0xad57defd,0xe71ebdd9,0xbdf9ce7b,0xce7bbdd8,0xbdd8c619,0xce5ac63a,0xce7bb5b8,0xce5ad6bc,0xbdf8d69b,0xc63aad56,0xb5b8d69b,0xb597b597,0xc639bdd8,0xce5aa515,0xdedcd6bb,0xc619b5b7,
-0xb5b8bdd8,0xc63ab5b8,0xce5abdd8,0xc619ce7b,0xb597b597,0xce5ac619,0xa5369cf5,0xce5ab597,0xb5b8ce7b,0xa536ad56,0xe6fdc619,0xce3ad69b,0xbdf9c619,0xb577a515,0xad77bdf9,0xa536b577,0xa5359cf5,0xc639ad77,0xbdf8c619,0xb577b577,0xbdd8ad76,0xbdb8c619,0xce5abdd8,0xce3ace5a,0xce5ace7b,0xb577b597,0xbdf8ce3a,0xce5ac639,0xbdb8c63a,0xbdd9c63a,0xad56b5b8,0xa516dedd,
-0xad56a4f5,0xad77ad57,0xad36ad77,0xad57b5b8,0xb598a536,0xe71dd69b,0xc619d69b,0xffffbdb8,0xb5b7d69b,0xb597ad56,0xad56c5f9,0xdebcb5b7,0xb5b8b577,0xef7ff79f,0xce7bb5b8,0xb598e6fd,0xd69bb597,0x9cf4ad76,0xdedcc619,0xc5f9ce5a,0xe71dc5f8,0xd6bbce5a,0xd6bbffff,0xce7ac618,0xc639ce5a,0xad76b5b8,0xc619c619,0xb5b7a535,0xad76a535,0xa535ad56,0xad76ad76,0xc619b5b7,
-0xce7ab5b7,0xd6bbbdd7,0x9472bdd8,0xa4f4a535,0xad55a514,0xbdd7ad35,0xc618b596,0xc639defc,0x9cd4b597,0xd69bb597,0x9493a535,0xa535a515,0xa535a536,0xb5779cd4,0xce7aad36,0xb597ad77,0xef5eef5e,0xbdd8ce7a,0xa515ad56,0xbdd8c5f9,0xffdfe6fd,0xf77fe6fd,0xce7be6fd,0xb5b8c619,0xce5ac5f9,0xce5ac639,0xce7affff,0xd6bbe73d,0xdf1cc639,0xb5d8d6bb,0xadb7ad76,0xce9bc69b,
-0xdefcc619,0xffffffff,0xffffdedc,0xd69affdf,0xe71cbdd8,0xe71dc619,0xc5f9e73d,0xffbfffff,0xbdf8dedc,0xb5b7b597,0x94b3a4f5,0xb5b8b577,0xb577b577,0xad57b598,0xce5abdd9,0xb598ad57,0xbdd9bdf9,0xe6fddedc,0xb597c619,0xa535ad56,0xad56b597,0xce7bbdd8,0xbdf9ffbf,0xce5ace5a,0xce5ace3a,0x9493bdd8,0xa5358c73,0xa5159cd4,0xbdf8ad56,0xad56ad77,0xc63aa536,0xb577c5f9,
-0x9cd49cd5,0xad369cf5,0x8c529cd4,0xad369cf5,0xc63ac619,0xb597c619,0xce3aad56,0xb577bdb8,0x9cd4a515,0xc619b577,0xbdd8ce5b,0xd67bdedc,0xad36bdb8,0xce5ab597,0xbdf9c5f9,0xef7fce5a,0xd67bf79f,0xc61ab598,0xc61ad67b,0xbdf9bdf9,0xce5ad69b,0xbdd8c619,0xad56ad77,0xbdd8c63a,0xbdf9c63a,0xb597b577,0xdebcd69b,0xb577b5b8,0xce3aad56,0xa4f4dedc,0xffbfdedc,0xc5f8e71d,
-0xbdf9d6bb,0xd6bcad56,0xc619e73d,0xef5ebdd8,0xa515d69b,0xd69b9cf5,0xa536d69b,0xce5ab597,0xa535ad77,0x9cf5ad77,0xb5b89493,0xd6bcd69b,0xbdf9c639,0xb597ad56,0xbdd9ad36,0xb577b597,0xa536ad56,0xa536ad56,0xc619bdf9,0xb577c619,0xad56ad56,0xdedcb5b8,0xc619ce3a,0xc5f9ad57,0xce3ac63a,0xb577c5f9,0xbdd8b5b8,0xce5abdd8,0xd69bd69b,0xe6fdce3a,0x9cb4d67b,0xdeddc63a,
-0xa536a515,0xad36ad36,0xbdb8bdb8,0xb597bdd8,0xbdd8ad77,0xdebcad56,0xd6bbef5e,0xc619debc,0xce5affff,0xb597bdf8,0xce5abdd8,0xad76ce5a,0xdefdce5a,0xf7bfc619,0xbdd8ef5e,0xd6bcdedc,0xb597ad76,0xc619bdf9,0xb5b89cf5,0xdedcef5e,0xb597bdf8,0xdefcef5e,0xffffd69b,0xbdd8d6bb,0xdefddefc,0xc619d69b,0xce5aa535,0x9cf4bdd8,0xa555a515,0xb596bdd8,0xbdf8b5b7,0xbdf8b597,
-0xbdf8c639,0xb596ce5a,0xce59bdf8,0xb5b7a535,0xb5b7bdd7,0xd69abdb7,0xbdd8c619,0xce59d69b,0x9cf4b576,0xb5769472,0xa515d67a,0xa5159493,0xa515b577,0xa4f5b5b8,0xb577bdb8,0xa515bdd8,0xdefcb5b7,0xd6bbe73d,0xbdd8bdb7,0xc63ab5b8,0xffbfc619,0xd67bffff,0xc5f9c5f9,0xce5ab5b8,0xbdd8c619,0xce3ac619,0xffffc639,0xdf1cdedc,0xce7ace9b,0xce7adf1d,0xadb7b5d8,0xc67bb5d8,
-0xbdb8dedc,0xffdfd69b,0xe71dffdf,0xffffffdf,0xc618d69a,0xdefcd69b,0xe71def7e,0xffffd69b,0xd69bffff,0xb597a515,0x9cd4ad56,0xce7b8c53,0xbdb8ce3a,0xb598bdf9,0xc61abdb8,0xc5f9a536,0xc63ace3a,0xe73ece3a,0xb597e6fd,0xad56b577,0xbdd8a515,0xc619bdd8,0xffffef5e,0xdedcf7bf,0xb577ce7a,0xbdd8bdd8,0xad569cf5,0x9cf4b5b7,0xad76b597,0xb597b5b8,0xa535a535,0xce7bdedc,
-0xad57bdd8,0xa4f5a515,0x8c73ad36,0xb5989cf5,0xad77ad77,0xa536b597,0xc5f9ad56,0xc619ce7b,0x9cd4ad56,0xd69bad36,0xe71ededd,0xdebcce7b,0xb577c619,0xb597ad36,0xc5f9bdb8,0xce7bbdd8,0xdedde71d,0xbdf9d6bc,0xbdb8c63a,0xc63ab5b8,0xe71dd6bc,0xbdf9d69b,0xb5b8b5b8,0xad57a516,0xd69bce5a,0xad56bdd8,0xd67bb597,0xad36d67b,0xdefcb5b8,0xc639ce5a,0xef5ebdb7,0xe73dffff,
-0x9cf4c619,0xce7bbdd8,0xce5ae73e,0xdedcb5b8,0xbdd8e71d,0xb5b8ad56,0xce7bce7b,0xad56ad56,0x9cd4a515,0x9cf4a536,0xad7794b4,0xdedcce7a,0xc5f9d6bc,0xbdd8b577,0xc63ac619,0xad56bdf9,0xad77b5b8,0xa515a515,0xd69cb597,0xbdd8c63a,0x9cf5ad56,0xbdd8ad56,0xc619d69b,0xa536b597,0xc5f9c619,0xbdf9bdd8,0xbdd8b577,0xce5abdf9,0xce5ace7b,0xce7bd69b,0xb577dedd,0xce7b9cb4,
-0xad77ef3e,0x9cd4a515,0xbdd9a515,0xad77bdf9,0xb5b8ad56,0xb597c619,0xef5eef5e,0xd6bbc639,0xffffd69b,0xc639d6bb,0xbdf9bdf8,0xce5ac619,0xd6bbb5b8,0xbdd8defc,0xf79fe73e,0xdefdb5b8,0xad76e71d,0xc63ab5b7,0xad56b5b8,0xe71dce5a,0xc619dedc,0xf7bfc619,0xce7ae73d,0xf7bfffff,0xdedcc619,0xce5ac619,0xa535c639,0xc639dedc,0x9cd394b3,0xb597a4f4,0xb5b7b5b7,0xb597c618,
-0xc619ce5a,0xb597be18,0xd69bb5b7,0xbdf8defc,0xbdd8c639,0xc5f8b5b7,0xc639c619,0xd69bd67a,0xc619dedc,0x94b3a515,0xc619ad56,0x9493a515,0xbdb8ad56,0xce5aad36,0xad77a536,0xce3abdf8,0xbdd8b5b7,0xef5ededc,0xb5b7e71d,0xc5f9b597,0xef5ee71d,0xce5adebc,0xc5f9b5b8,0xbdd8ce5a,0xc639d69b,0xc619c5f9,0xd69bc619,0xdefcffff,0xd6dce73d,0xc65ac639,0xadb7b5f8,0xad97ad77,
-0xce3aad36,0xef5ec619,0xffffffdf,0xffffef5d,0xd69bffff,0xe73db597,0xf77ff77f,0xce3ad69b,0xef7ed6bb,0xb577d67b,0xb5b7bdd8,0xa515a536,0xc63ac5f9,0xbdf9bdd8,0xb598bdb8,0xbdd9c619,0xd6bcc61a,0xbdd8c61a,0xdebce73e,0xb597b577,0xa535c619,0xbdf8b576,0xffdfc619,0xc619ffff,0xa536bdd8,0xc6199cb4,0xa515ce5a,0xb597b597,0x94b4b5b7,0xb597a515,0x9cb4b577,0xe71dad56,
-0xb597b5b8,0xad56ad77,0x9cd4bdb8,0x9cd58432,0xad77ad77,0x94b4ad56,0x9cb3a515,0xad77a535,0xb5b8ce5a,0xce5a9cf5,0xce5ad67b,0xbdd8d69b,0xdedce71d,0xbdb8ce5a,0xce7bc619,0xbdf9d6bb,0xc61ab598,0xdeddd67b,0xad56ad77,0xbdf9bdd8,0xef7fd6bc,0xce7be73e,0xce5ace5a,0x9cf5c619,0xce3abdf9,0xad77e73d,0xad36a4f5,0xc619b576,0xbdf8bdf8,0xc639ce5a,0xb5b7d6bb,0xffffdefc,
-0xc639e73d,0xe73def7e,0xc639bdf8,0xb5b7b5b7,0xe73dd69b,0xb597bdf8,0xce7bad77,0xbdd8ef7f,0x9cf5bdd8,0xad569cd4,0xbdd8c5f9,0xdedcbdf9,0xdedcef5e,0xc5f9ad56,0xce3ace7a,0xa535b5b7,0xb597ad56,0xad77ad77,0xad77b597,0xb598bdd8,0xb597bdb8,0xad56a515,0xce7bce3a,0xad57bdf9,0xce5aad36,0xb597bdf9,0xce3ac5f9,0xbdd8bdd8,0xd67bbdd8,0xce5ad67b,0xce5ac63a,0xad779cf5,
-0xdedcce5b,0x9cb4b597,0xb597ad56,0xc619bdf9,0xa536b5b8,0xb5b8b597,0xef5eb577,0xce5aef5e,0xce5ace7a,0xce7affff,0xa535b5b7,0xdedca535,0xc619defc,0xe73def7f,0xef7fb5b8,0xc63aef7f,0xdefcef5e,0xa535ad56,0xc639dedc,0xce5aad76,0xe73def3d,0xc619d6bb,0xef5ef79e,0xf79fce9a,0xc63ace5a,0xd69bce5a,0xbdf8d69b,0xffbfb5b7,0x9493bdf8,0xad55a514,0xc639b5b7,0xce7abdf8,
-0xc639bdf8,0xb5b7bdd8,0xbdf8c619,0xd6dbe73d,0xb5b7c618,0xb5b7bdd7,0xce5ac618,0xc618c618,0xce7adefc,0xa535c639,0xbdd894b3,0xa515d69b,0xc6199cd4,0xb597ce3a,0x8c52b5b8,0xb5b7b5b8,0xc619dedc,0xe71dc619,0xef5ef7bf,0xbdd8ce5a,0xc5f9bdd8,0xdedcad56,0xc63adefc,0xd69bd67b,0xdefdc619,0xc63ac639,0xc63ace7a,0xffffd6dc,0xd6dcdefc,0xadb7c65a,0xad97be19,0xa5369d35,
-0xc619bdd8,0xd69be6fd,0xffdff77e,0xe71dffff,0xffdfffff,0xc619d69b,0xd6bbd69b,0xd69bd69b,0xce5ad69b,0xce5ae73d,0xb5b7ad76,0xbdd9c619,0xbdd9a515,0xad77c63a,0xce5bbdd8,0xc63ace5b,0xce5ac63a,0xb5b8c63a,0xdedcc619,0xbdb8dedc,0xb597ad76,0xa5159cd4,0xe6fdbdd8,0xffdfffff,0xa515bdd8,0xa4f5a4f5,0xce5ac619,0xa515ad56,0x9cb4b597,0xad369493,0xa515bdb8,0xc619a515,
-0xce5be73e,0xb577bdd8,0xc5f9bdb8,0x8c739cb4,0xbdb894b3,0xa515ad56,0xad76ad76,0xce7aa515,0xe71ddedc,0xc619c5f9,0xbdb8c5f9,0xd69bb597,0xc619ce5a,0xbdb8b577,0xc619b5b8,0xc619bdf9,0xc61ab598,0xd6bcc63a,0xc619ce7b,0xb5b8c619,0xdedcc63a,0xdedcdedc,0xd6bce71d,0xad56b5b8,0xb597ad36,0xce3abdb8,0xa515b597,0xad76a515,0xb5b7bdf8,0xe73dc619,0xdefcdedc,0xd69bb5b7,
-0xe75df79e,0xef5effdf,0xbdf8e73d,0xbdf8c639,0xffdfd69b,0xbdd8dedc,0xbdf9ad56,0xffdff79f,0xa515ad76,0xa5159cf5,0xb5b7b5b8,0xbdb8b597,0xf77fdefc,0xdedcef7e,0xb5b7c63a,0xad76a536,0xc63ac619,0xb5b8c619,0xb577ad57,0xc63abdd8,0xbdb8b5b8,0xa4f5a4f5,0xb597bdb8,0xb577ad56,0xbdf8ad56,0xb577d69b,0xce5abdd8,0xbdb8c619,0xc619c619,0xd69bce3a,0xc61ace7b,0xb597ad77,
-0xd69ba516,0xb577ce7a,0xad36ad36,0xbdd8b577,0xad56bdd8,0xb597ad56,0xad77ad77,0xef5ee71d,0xb5b7d69b,0xffffce7a,0xa535bdf8,0xbdf8bdf8,0xd69be73d,0xf79fc619,0xc619e73e,0xef7fffff,0xd69bb5b8,0xad56d69b,0xf7bfbdf8,0xc619dedc,0xe73dd69b,0xc619e71d,0xef7ec639,0xbdf8d6db,0xd6bbef5e,0xd6bcb5b8,0xc619d6bb,0xb597c618,0xce59ffbf,0xad35a535,0xbdb7b5b7,0xc619bdb7,
-0xce5ac659,0xce5ace7a,0xbdf8bdd7,0xe73db5b7,0xbdb7e71c,0xb597bdd8,0xce39b5b7,0xc5f8bdd8,0xce7ac639,0xb576bdb7,0xb597b597,0xc619bdf8,0x94b39cd4,0xc619c639,0xbdb8ad36,0xa5169cd4,0xf79fce7a,0xbdd8c5f9,0xffffef3e,0xad56e71d,0xbdd8ad56,0xd67bef5e,0xfffff7bf,0xd69bdedc,0xbdd8c619,0xd69bdedc,0xce9bce7b,0xd6dcce7a,0xce7affff,0xc67acebb,0xbe19adb7,0x94d4adb7,
-0xc5f9c619,0xf79fbdf9,0xdedcd69b,0xffffffff,0xffbfdefc,0xef5effff,0xbdf8b5b7,0xef3ece5a,0xc619defd,0xef7ed6bc,0x9473c63a,0xb5779cd4,0xad56bdd8,0xdedcc63a,0xbdd9ce5a,0xce3ad6bc,0xb5b8bdd9,0xbdf9bdb8,0xbdd8bdd8,0xd69be6fc,0xad76bdf8,0xad76a515,0xbdf9c619,0xf7bfd69b,0xc639ffff,0xb5b7ad56,0xbdf8c63a,0xad36bdb8,0x9cf4b597,0xa5369cd4,0xad56ad56,0xad56a536,
-0xce5ab577,0xa515b598,0xad36ad56,0x9493a515,0x9cf48c73,0xb5b7b597,0xb576b597,0xa4f4b576,0xce5aad77,0xd69bdedc,0xce5ad67b,0xbdf8c639,0xd69bd67a,0xc619ad56,0xad36b597,0xb5b8bdf9,0xd6bcce3a,0xc63ad6bc,0xf79fce5b,0xb5b8d6bc,0xce7bc63a,0xc63ad6bc,0xbdf9ce5a,0xbdf9bdd9,0xa4f5c61a,0xbdd8ad56,0xc619debc,0x9cf4b597,0xd6bbb597,0xc619c619,0xbdf8c639,0xbdd8d6bb,
-0xffffd6bb,0xef7effdf,0xef5effff,0xd6bbbdd8,0xc619ce5a,0xf79ff79f,0xa536bdd8,0xd69bad56,0xa536d6bb,0xad56a536,0xbdf9bdf8,0xbdd8ce3a,0xe71db597,0xf77fffff,0xad56ce5a,0xb5b7ad77,0xce7bc619,0xb597bdf9,0xa515a536,0xa5169cf5,0xb577bdb8,0xad56ad57,0xad56a515,0xb597a516,0xce5ab5b8,0xc619c639,0xbdb8ce5a,0xc639c639,0xce5abdd8,0xc63ad69b,0xce5ad6bc,0xb5b8a516,
-0xa535b598,0xdedcc619,0xad36ad76,0xa4f5ad56,0xbdf8bdd8,0xa515b577,0xb5b7a515,0xce7aad56,0xce5ae71d,0xb5b7c639,0xd69bffff,0xce5abdd8,0xdedcc619,0xbdf8d6bb,0xef7fffff,0xef7fbdd8,0xd69bef5e,0xdefce73d,0xc619b5b7,0xd6bbf79f,0xc639b597,0xf7bfef5e,0xc659ce7a,0xef5ef79e,0xdebcc619,0xb597d69b,0xce5ab597,0xb576bdf8,0xdedba514,0xb5b7c619,0xbdb7ad76,0xb596c618,
-0xd69bc659,0xc619bdd8,0xb597c619,0xbdf8c619,0xd6dbe73d,0xbdf8ad76,0xbdd7c619,0xc619c619,0xce59bdd7,0xbdf8c618,0xbdd7ce39,0xc639bdd8,0xad36ce7b,0xbdb89cf5,0xb577c5f9,0xbdd8ad77,0xdedcdedc,0xb597e71d,0xc619b5b8,0xe71de6fd,0xb598bdd8,0xef5fd67b,0xf79fd67b,0xdedcffff,0xc639ce5a,0xdefdc639,0xce5ad6dc,0xc65ace9b,0xffffd6bb,0xc67ace9b,0xa556b5f8,0x9d35be39,
-0xc5f9bdd9,0xce5ab5b7,0xb5b7d69b,0xffffd69b,0xd69bffff,0xffffffff,0xc639d6bb,0xdebcce7a,0xd69bef7e,0xdebcb597,0xc619ef7f,0x9cd48c73,0xb5b8a536,0xbdf99cf5,0xc61ad6bc,0xe71ec61a,0xad77bdd9,0xb577ad36,0xd6bcbdf9,0xbdf8d69b,0xad76d69b,0xad35ad35,0xad56ad56,0xdefdc619,0xef7fd6bb,0x9cd4b5b7,0xbdf9a535,0xbdd8b597,0xbdb8b5b8,0xa515a4f5,0xb577a515,0xad36b597,
-0xb5979cf5,0xb598ce7b,0xa515a4f5,0x9494a515,0x94b49493,0xb5979cd4,0xb5b7b5b7,0xad36ad56,0xad77a536,0xef3ed69b,0xce5adedc,0xad76b597,0xdefcbdd8,0xb597c5f9,0xbdd9c63a,0xc63aad77,0xdeddce5b,0xce7bd6bc,0xdeddc63a,0xce7bef5e,0xd69bd69b,0xdedcdedc,0xce7bc619,0xd6bcd69c,0xb597debc,0xbdd89cd4,0xd67bce3a,0x9cd4b5b7,0xb5979cf4,0xce5abdf8,0xce39ce5a,0xef7ece7a,
-0xf7bfd6bb,0xffdfffff,0xe73dffdf,0xbdf8d69b,0xd69bdefd,0xdedcc63a,0xb5b7dedc,0xb5b8b5b8,0xce5ac619,0xb5b8c619,0xb5b7b5b7,0xd69bc5f9,0xb5b8b5b7,0xfffff79f,0xbdf8e6fd,0xce5ac619,0xc619c63a,0xbdd8c63a,0xa515bdf9,0xa536ad56,0xc5f9ad36,0xb597c5f9,0x9cd5b577,0xa516a536,0xd69bce7a,0xbdd8c619,0xbdf9ce5a,0xd67bb5b7,0xce5ac619,0xce5ace7b,0xce7bd6bc,0xb597ad77,
-0xad56c5f9,0xce3ab577,0xc619e71d,0xb597b5b7,0xbdf8ad56,0xb597bdd8,0xa515ad56,0xad56b5b7,0xef7ee71d,0xce5ac619,0xffffce7a,0xc619e73d,0xd6bbce7a,0xc639dedc,0xf7bfb5b7,0xbdd8ef5e,0xffffffff,0xdedcd69b,0xbdd8dedc,0xf7bfce39,0xad56ce7a,0xef7ebdd8,0xce7af79e,0xe73dbdd7,0xce5aef3d,0xce5ad6bb,0xbdd8b576,0xce59c618,0xa514ad76,0xbdf8ce7a,0xb576ad55,0xb597bdf8,
-0xbdf8bdd7,0xbdd8c619,0xc639c639,0xc619b597,0xdefcc618,0xbdd7f7bf,0xb5b7ad76,0xc618ad56,0xc639c618,0xc618d6bb,0xce7ac639,0xbdd8bdd8,0xdedcbdf8,0x9cf4ad56,0xbdb8c61a,0xce5aad56,0xce7ac63a,0xdedcbdb8,0xbdb8bdd8,0xdedcbdd8,0xce5ae6fd,0xc5f9b597,0xd67bef3e,0xf79fffdf,0xd69bce7b,0xce5adedc,0xe73dd6bb,0xce7bce9b,0xce9bbe39,0xbe3affff,0xc67ad6dc,0xad979d15,
-0xd69be71d,0xce7ace7b,0xef7ee73d,0xd69bbdd8,0xffffffff,0xffffd6bb,0xdedcffdf,0xc5f9b5b7,0xef7fe73d,0xb577c63a,0xd69bce5b,0xa4f5bdd8,0xb5779cf5,0x94b4bdb8,0xce7bce5b,0xbdf9c63a,0xc619defd,0xa516bdb8,0xce5aad56,0xb597c619,0xce5ac639,0xb597b5b8,0xa515ad56,0xc619c619,0xce7bc619,0x9cd4c63a,0xad779cf4,0xad76ad56,0xbdb8ce3a,0x9cf4ad36,0xb5979cd4,0xad56bdf9,
-0xad36b597,0xdefdc619,0xb577bdd9,0x9cd4ad36,0x8c529cb4,0xbdf99cd4,0xc619c619,0xb577bdd8,0xb5b8ad77,0xbdd8bdf9,0xce5aef5e,0xbdb7c619,0xbdf8ad35,0xe71de71d,0xd69bce5a,0xc63ac61a,0xdefdc61a,0xe6fddefd,0xc61ad69c,0xf79fe73e,0xd69bce7b,0xce7bce7b,0xce5ace7b,0xd69bd6bc,0x94b4bdd9,0xa5159cd4,0xbdb8b597,0xbdb7debb,0x94b3a515,0xb5b79cd4,0xbdf8c5f8,0xce7ad67a,
-0xd69bf79f,0xffffffff,0xe73dffdf,0xe71def5e,0xe71dd69b,0xce7ace7a,0xdedce71d,0xa536bdd8,0xce5aad76,0xc619e73d,0xb5b8b5b8,0xbdf9bdd9,0xa536bdf9,0xef5ead56,0xce7be73d,0xc619c639,0xce5ace5a,0xc639d69b,0xbdd8bdd8,0xbdd8b597,0xad56ad36,0xce5ad67b,0xa536b577,0xad56ad56,0xce5aad36,0xc5f9c619,0xce7ab5b7,0xbdf8ce7a,0xce5ace5a,0xce7bc619,0xce5ad69b,0xbdf9bdd8,
-0xc5f9ad57,0xb597b5b7,0xef5ece5a,0xad76bdf8,0xb597ad56,0xbdf8c5f9,0xad56b576,0xbdd8b597,0xffdfb597,0xce5affdf,0xe73dce9a,0xe73dffdf,0xb597ce7a,0xe71dce5a,0xad77d69b,0xf7bff7bf,0xffffd69b,0xc659ef5d,0xd6bbf79e,0xd69abdd8,0xce7aef5e,0xce5ace59,0xffffffff,0xad76c618,0xe6fce71d,0xce7ace39,0xad56bdd7,0xc618a514,0xa514b596,0xce799cd3,0xb596b596,0xb597b596,
-0x9cf4b597,0xbdf8ad76,0xc639bdf8,0xb5b7c619,0xc639b597,0xf79ff7bf,0xb597bdb7,0xad56b5b7,0xbdd7bdd7,0xc618c619,0xdefcce59,0xbdd8dedc,0xd6bbad56,0xbdb8defd,0xce5ab577,0xb597ce3a,0xbdd8bdd9,0xd67bdedc,0xbdb8ef7f,0xce3aad36,0xe71def5e,0xc5f9c619,0xe71ed67b,0xffdfdedc,0xd69bf7bf,0xd69bd69b,0xdf1dce9b,0xce9bdefd,0xbe3ad6fc,0xef9fbe39,0xe75ece9b,0xa536c65a,
-0xe71db577,0xd67bdedc,0xf77ededc,0xce39ef5e,0xffffe6fc,0xe6fcffff,0xffffffff,0xc639defc,0xd67bad57,0xce5ad69c,0xc61aad56,0xc619debc,0xa5369cb4,0xd67bad77,0xbdf9a536,0xce3abdd9,0xd67bc63a,0x9cd5bdd8,0xad369cd4,0xbdd8bdd8,0xc619ad76,0xbdd8ce3a,0xad56b597,0xad77ad77,0xc63ace7a,0xce5abdd8,0x9cf5b597,0xb597a515,0xf79fce5a,0xb5b8ce5a,0x9493b577,0xc619c619,
-0xd67bd67b,0xbdf9c5f9,0xb597d69b,0xa5159cd4,0xa536a4f5,0xa515ad36,0xce5ac5f9,0xa535bdd8,0xb597b597,0xad36ad56,0xef5eb597,0xce5adebb,0xa535c619,0xe71dd67b,0xef5ece7b,0xbdd9dedc,0xbdf9ad57,0xe71ece5b,0xad57d6bc,0xef5ebdf9,0xdefde73e,0xdefddefd,0xdedcce5a,0xd69bdedc,0xa516ad56,0xad369473,0xc5f994b4,0xdedcce7a,0x9493ad76,0xb597a515,0xa515a535,0xbdf8b5b7,
-0xe71dbdf8,0xffffce7a,0xe73df7bf,0xef5edefc,0xbdf9ef7e,0xc63ae71d,0xef7ece5a,0xa535ad76,0xbe19a535,0xdefce71d,0xb5b8b5b8,0xb598bdb8,0xb577ad36,0xce5abdd8,0xef5ee73d,0xb5b7ce7a,0xbdf9bdf8,0xc619bdd8,0xbdf9ce5a,0xad56b577,0xbdd8a515,0xd67bb5b8,0xb597c619,0xb577b5b7,0xb597b597,0xc5f9bdd8,0xc5f9bdd8,0xd69be71d,0xdefdce7a,0xc63ac63a,0xd6bcdefd,0xbdf9ad57,
-0xad56ad77,0xb597c63a,0xc63ab597,0xbdf8dedc,0xbdb8b597,0xc619bdd8,0xb576b597,0xb597b597,0xb597bdf8,0xf7bff79f,0xc618c618,0xffffe71c,0xc639defc,0xce7ac639,0xce5af79f,0xe73ebdd8,0xc639e71d,0xfffff7df,0xdedcce7a,0xbdf8defc,0xe6fcc618,0xb5b7c618,0xf7bfc659,0xb597ef9e,0xe71cbdd7,0xb596ce7a,0xc639d69b,0xb596a515,0xad55bdd7,0x94b394b3,0xb596d69a,0x9cf49cf4,
-0x9cf4a4f4,0xb5b79cf4,0xb597bdf8,0xc619bdf8,0xb5b7ad76,0xe71db5b7,0xad55ef5e,0xad76ad56,0xbdf8ad76,0xbdd7b5b7,0xd69bce5a,0xd69be71d,0xa515b5b8,0xd69bd69b,0xad56a515,0xce5bc63a,0xce5ac5f9,0xf7bfdefd,0xef3ee73e,0xad56bdd9,0xef5fd69c,0xc5f9debc,0xd69cbdb8,0xce5affbf,0xffffffff,0xd6dce71d,0xc639ce9b,0xce9bdf3d,0xc65ac65a,0xb5d8ad77,0xc65ae75e,0xbe19defd,
-0xce3adebc,0xce7af7bf,0xffdfd69b,0xe71dffdf,0xf79ece5a,0xffffffff,0xffbfef7e,0xe73dffff,0xad56b577,0xd69bbdb8,0xce7bc63a,0xdefdd67b,0x9473ce7b,0xb5989cd5,0xa516ce5b,0xce5bb598,0xce3ace7b,0xbdb8d6bc,0xa515a516,0xb597b597,0xb577b5b8,0xc619bdd8,0xad77bdd8,0xb597a536,0xce5ace5a,0xbdf9ad77,0xbdf8d6bc,0xbdd89cf4,0xf7bfc619,0xc619ffdf,0x9493ad36,0xad769cf5,
-0xce7ab5b8,0xad36c619,0xd69bbdb8,0xad77b577,0xbdb8a515,0x9cf5bdf9,0xb5979cd5,0xa515bdb8,0xc619b597,0xb5b8c5f9,0xce5aa535,0xdedce73d,0xb576dedc,0xce5ab5b7,0xd67bef5e,0xce7bc5f9,0xb5b8bdd9,0xce7bb5b8,0xc61ace7b,0xce7bc63a,0xf79fef7f,0xdefdef5e,0xc63ac619,0xd6bcdebc,0xa536c61a,0xa536bdd8,0xa4f5ad56,0xce7ace5a,0xa535c639,0x9cd49cd4,0x9cf494b3,0xbdf8ad36,
-0xce5ac63a,0xce5adedc,0xd6bbb597,0xef5eef5e,0xffdff79f,0xce7abdd8,0xb5b7c63a,0xbdd8defc,0xb5d8ad56,0xe73ec63a,0xb597d69b,0xb598ad36,0xad77a515,0xc619debc,0xd69ba536,0xdefcffff,0xbdd8c619,0xb5b7c619,0xce39bdd8,0xad56b5b7,0xb576b576,0xb5b7bdf8,0xd6bbd67a,0xb597bdf8,0x9cd4ad77,0xc639a536,0xbdf9c619,0xd69bbdd8,0xd69bd69b,0xc63ace5a,0xdedcd69b,0xad56ad57,
-0xbdd8b5b8,0xbdf8b597,0xad77b5b8,0xd6bcc63a,0xa536c619,0xbdf9ad56,0xb5b7bdf9,0xad76bdf8,0xc619b5b7,0xffffad76,0xce7affff,0xef7edefc,0xe73dffff,0xd69bc619,0xc63ac619,0xc639ce7b,0xdefce71d,0xffffce9a,0xd69bffff,0xd6bbe73d,0xdebbb597,0xd69aef7e,0xce5abdd7,0xef7effdf,0xa514c639,0xbdd7c639,0xdedbad76,0xa535c618,0xbdd7c618,0x94729492,0xb5768410,0x94929cd3,
-0x9cf49cd3,0xb596a515,0xb597bdd8,0xc619b597,0xad56ce7a,0xb596b597,0xdedcdedc,0xad55ad35,0xb596b5b7,0xb5b6bdf7,0xce7abdd7,0xd69bd69a,0xb597ce3a,0xce5bad36,0xb598defd,0xdebcad57,0xd67be71d,0xdebcef7f,0xe71ef79f,0xc61af77f,0xdeddbdd8,0xe6fde6fd,0xbdd8ce3a,0xffffe6fd,0xffdfe6fd,0xe71dffff,0xc639c65a,0xdefdbe3a,0xbe19c65a,0xb5b8b5d8,0xdf1dad97,0xd6bcbe19,
-0xd69bf77f,0xffdfbdd8,0xc639c619,0xffffef5e,0xce7aef5e,0xffdfe71d,0xd6bbffff,0xfffff79e,0xbdd9e6fd,0xc619bdd9,0xdedcd6bc,0xf79fd69c,0xd69bef7f,0xad37ad57,0xc63ab598,0xbdf9ad36,0xce5bd69c,0xef5ec5f9,0x9cd4c5f9,0xa4f5ad56,0xc619ce5a,0xc5f9b597,0xb577c5f9,0xd69bb5b8,0xad77b5b7,0xad76b597,0xef7ebdf9,0xad77bdf9,0xc5f9d69b,0xc63ac639,0x9cb4ad56,0xad369cb4,
-0xad56b597,0xc619ce5a,0xc619bdd8,0xb597ce7b,0xad56ad56,0xce3ace3a,0xad369cd5,0xad56bdb8,0xc63ab597,0xce5ad69b,0xc619c619,0xffdfce59,0xd6bbf79f,0xbdd8b5b8,0xef3fc63a,0xd69ce73e,0xce5bdefd,0xc61abdd9,0xce3ac63a,0xe71dd69b,0xef7fdefd,0xd69bf79f,0xb5b8bdf9,0xd6bcc63a,0xc61ac5f9,0xce5ac5f9,0xad36ad57,0xc6199cf5,0xd67ace7a,0x8c72c639,0xbdb79cd4,0xad56c619,
-0xdefcbdf9,0xbdd8c63a,0xc619a515,0xffdfef7f,0xef5eef7e,0xb597f79f,0xbdd8ad76,0xdedcc619,0xb5b8ce9b,0xce5abdd8,0xd69be73e,0xad36ad56,0x9cf5bdd8,0xc63aa516,0xb5b8ad76,0xffdfef5e,0xd69bd6bb,0xce7ad69b,0xc619bdf8,0xb597ce5a,0xb597b597,0xbdb7a515,0xdedcc639,0xc619d69b,0xb5b8b577,0xb577bdb8,0xbdd8b597,0xbdd8bdd8,0xad77c63a,0xce7bce5a,0xce5ac63a,0xa515a536,
-0xce7bb5b8,0xa515bdd8,0xbdf9c619,0xbdf9a515,0xad77d6bc,0xad569cd4,0xad77b597,0xb5b7b597,0xbdf8ad56,0xb5b7bdd8,0xffffe73d,0xdefcdedb,0xffffef9e,0xbdf8f79f,0xbdd8bdf8,0xce7bc63a,0xef5eb5b7,0xce7aef5d,0xf7bfffff,0xdedcdedc,0xc618ce39,0xe73dd69b,0xbdf8c659,0xffdfce7a,0xad55f7bf,0xbdf7a535,0xad55bdd7,0xbdd7d69a,0xad55a535,0x83f0a4f4,0x73af7bcf,0x8c519cf3,
-0x94b394b3,0xbdf8b597,0xb596ad56,0xbdd8bdf8,0xc639bdf8,0x9cf4ad55,0xdedcb597,0xb597dedb,0xb596a535,0xb5b6a535,0xbdd7bdd7,0xce59dedb,0xce7ac639,0x9cd4a515,0xe71dd69c,0xbdf9c5f9,0xf79fe71d,0xe6fdd6bc,0xef5ece3a,0xffffe73e,0xce3ac61a,0xef3edebc,0xd67bf77f,0xe6fdc61a,0xd6bbffdf,0xffffffff,0xc639d6dc,0xadb8b5d8,0xc67bd6fc,0xad97b5b8,0xa577ad77,0xc65adf1d,
-0xef3dbdb7,0xc639f79f,0xc619ffdf,0xdedcce7a,0xdefcef5d,0xdedcc619,0xffffffff,0xffffe71c,0xdeddffff,0xc63abdd8,0xf79fdedc,0xdedde73e,0xef5fdedd,0xa516d6bc,0xb577ad57,0xbdb9c61a,0xb598b598,0xce3abdd8,0xbdd8e71d,0xbdd8bdb8,0xc5f9c619,0xb597bdd8,0xb577b597,0xbdf9a536,0xa535ad76,0xb597bdf8,0xc63aad56,0xc619ef7f,0xad56ad36,0xbdb8ad56,0xc619c619,0x9cb4a515,
-0xa4f4ad56,0xd67aad55,0xbdf8debb,0xce5ace5a,0xad57c5f9,0xc619b598,0xb5b8bdb8,0xb598ad77,0xd69bce7b,0xe73ddedc,0xbdd8dedc,0xd67abdb7,0xd69be71d,0xb598defd,0xce3ab598,0xb5b8e71e,0xdeddc61a,0xad57e71e,0xbdf99cf5,0xdefdce7b,0xce7bdefd,0xdedce71d,0xce5ab597,0xc61abdd9,0xc61ace5b,0xce5bd69c,0xad36c619,0xad56ad56,0xe71dc619,0x9cd4ffdf,0xa5368c32,0xc5f9bdf8,
-0xce5abdf8,0x9cd4dedc,0xbdd8ce5a,0xffdfd6bc,0xef7effff,0xdefcef7e,0xc639ad76,0xc63abdd8,0xd69be75e,0xbdd8bdd8,0xef5fce5a,0xb5b8ce5b,0xad36ce7b,0xb5b89cb4,0xd69bef5e,0xf7bfbdf8,0xdedbffff,0xce7ad6db,0xbdd8ce7a,0xc618c639,0xbdb7b5b7,0xb576a535,0xb596ce7a,0xdedcd6bb,0xbdb8b597,0xb597b597,0xbdd8a515,0xc619ce5a,0xbdd8bdf9,0xe73edefd,0xe73eef9f,0xbdd8ad97,
-0xbdf9c619,0xad77ce5a,0xc619ad77,0xad56ad77,0xc619b5b8,0x9cd4a515,0xad56a515,0xbdf8bdd8,0xce5ac619,0xd6bbd69b,0xffffc659,0xe71cffdf,0xe73de73d,0xdedcffff,0xb5b7b5b8,0xd6bcce7b,0xc618ce5a,0xef5de73d,0xffffce7a,0xb596ffff,0xd6bbc619,0xc619bdf8,0xd6bbdefc,0xe73de73d,0xce59e73d,0x9cd3a514,0xad75bdf7,0xd69aa514,0xad759cd3,0x84108c31,0x841083f0,0xa5147bcf,
-0xa5148c51,0xbdb7bdd8,0xa515a514,0xbdd8b5b7,0xc639ad76,0xad56b5b7,0xbdd7ad76,0xe71cf77e,0xad75a535,0xa534ad55,0xbdf8bdd7,0xdedcc618,0xc5f9ce3a,0xad77c5f9,0xdefdb597,0xd69bef3e,0xdeddce7b,0xdebcef5f,0xc61adebd,0xef5ff79f,0xd69cffdf,0xe6fdce5b,0xdedde6fd,0xce3ad67b,0xffdfdefc,0xf7bfd69b,0xe75eef9f,0xa577be19,0xd6fca576,0x9d36b5b8,0x9cf5a556,0xd6bca556,
-0xa535c619,0xe71def5e,0xffffc639,0xd6bbb597,0xdefcef7e,0xce7adefc,0xffffef7e,0xc639ffff,0xffdfffdf,0xbdf9d69b,0xdeddce3a,0xce5bffbf,0xe6fece3b,0xdebce73e,0xb598a4f5,0xef3ece5b,0xad77bdb8,0xad77bdd8,0xef5fad36,0xce5ace3a,0xce5ac619,0xce7ac639,0xb5b8bdf9,0x9cd4b597,0xad76a556,0xbdd8ad76,0x9cf5a515,0xdefcc63a,0xa4f5bdd8,0xb577b5b8,0xe71dce5a,0x9cf4a536,
-0x94b3a535,0xb5b79cb3,0xef5ef7bf,0xc619d67b,0xb597d67b,0xa4f5ad56,0xbdb8ad56,0xd67bc63a,0xbdd8c63a,0xc619bdd8,0xb5b7c5f8,0xa4f4ad35,0xffffd69b,0xbdf9ffdf,0xad36b5b8,0xc61a9cd5,0xc63ace5b,0xad77ef5f,0xc63a9cf5,0xc63abdf9,0xdefdef5e,0xdefdc619,0xd6bcd6bc,0xb5b8debc,0xdeddd67c,0xce7bd67b,0xbdb8b597,0xad76b5b7,0xce7ab5b7,0xc639ce5a,0xa515bdd8,0xbdd89cb4,
-0xd6bcdefd,0xce5ab5b8,0xc63ac639,0xffffc619,0xffffffff,0xdedcce7a,0xb597defc,0xad56ce5a,0xe75ec63a,0xb5b8ce5a,0xc63ab5b8,0xd69bef5e,0xbdf9b597,0xd67bbdd8,0xf79fdedc,0xbdf8defc,0xfffff7bf,0xdefce73d,0xce5ad6bb,0xbdd8bdf8,0xc618d69a,0xd6bbce39,0xb5b7bdd7,0xef5ec639,0xb597e71d,0xbdb8bdd8,0xad56b597,0xc5f9bdd8,0xa536ad77,0xe73ed6bc,0xfffff7bf,0xc619d6bc,
-0xc639ce7b,0xc619c619,0xa5159cd4,0xb597bdd8,0xbdf9a536,0xad77d6bc,0xad77ad77,0xbdf8b597,0xc639c619,0xd69bce5a,0xb5b7c639,0xffffffff,0xef9eef7e,0xffffd6bb,0xce7aef7e,0xb5b8bdf9,0xdefce71d,0xdefcce7a,0xbdd7ce7a,0xffffffff,0xf79ec639,0xce7ae73d,0xef5de71c,0xd69ad69a,0xc618bdd7,0x8c72bdd7,0xbdd794b2,0xb596b596,0x9471bdf7,0x8c718c51,0x94b38c71,0x949294b3,
-0xa5359cd3,0xa514b596,0xa5559cf4,0xad76a535,0xad76bdf8,0xbdf8bdd7,0xbdb7bdb7,0xdebbad55,0xad55dedb,0xad55a534,0xc639b597,0xc618c639,0xc619ef5e,0xdedcc61a,0xb5b8bdb8,0xffdff77f,0xd67bce3b,0xe71eef5f,0xe71ededd,0xe71edebc,0xf77fd67c,0xce5bce3a,0xdebcef1e,0xd67bde9c,0xd6bbc619,0xce9bf7bf,0xef7ed6dc,0xa577e73e,0x9d15a556,0xb5b8df1d,0xb5b89cf5,0xa5369cf5,
-0 };
@@ -1,56 +1,44 @@
 #include <OpenGLES/ES1/gl.h>
 #include <OpenGLES/ES1/glext.h>
-#include <mach/mach.h>
-#include <mach/mach_time.h>
+#include "../../Common/Classes/GlStateCache.hpp"
+#include "../../Common/Classes/PvrUpload.hpp"
 #include "../Textures/NumeralsTexture.h"
-
-typedef unsigned int PVRTuint32;
-
-struct PVR_Texture_Header {
-    PVRTuint32 dwHeaderSize;
-    PVRTuint32 dwHeight;
-    PVRTuint32 dwWidth;
-    PVRTuint32 dwMipMapCount;
-    PVRTuint32 dwpfFlags;
-    PVRTuint32 dwTextureDataSize;
-    PVRTuint32 dwBitCount;
-    PVRTuint32 dwRBitMask;
-    PVRTuint32 dwGBitMask;
-    PVRTuint32 dwBBitMask;
-    PVRTuint32 dwAlphaBitMask;
-    PVRTuint32 dwPVR;
-    PVRTuint32 dwNumSurfs;
-};
+#include "../../Common/Classes/FrameStats.hpp"
+#include "../../Common/Classes/MonotonicClock.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include <iostream>
 
 class FpsRenderer {
 public:
-    FpsRenderer(vec2 windowSize)
+    FpsRenderer(vec2 windowSize) : m_stats(FrameCount)
     {
-        m_filterConstant = 0.1;
-        m_fps = 0;
-        m_previousTime = mach_absolute_time();
+        m_previousTime = 0;
         
         glGenTextures(1, &m_textureHandle);
         glBindTexture(GL_TEXTURE_2D, m_textureHandle);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        PVR_Texture_Header* header = (PVR_Texture_Header*) NumeralsTexture;
-        const unsigned char* bytes = (unsigned char*) NumeralsTexture;
-        const unsigned char* imageData = bytes + header->dwHeaderSize;
-        GLenum type = GL_UNSIGNED_BYTE;
-        GLenum format = GL_ALPHA;
-        int w = header->dwWidth;
-        int h = header->dwHeight;
-        m_textureSize = vec2(w, h);
-        glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, imageData);
+        PvrTexture numerals;
+        numerals.Parse(NumeralsTexture, sizeof(NumeralsTexture));
+        if (!UploadPvrTexture(numerals))
+            std::cout << "Bad numerals texture: "
+                      << PvrTexture::GetErrorString(numerals.GetError()) << "\n";
+        m_textureSize = vec2(numerals.GetWidth(), numerals.GetHeight());
     }
     void RenderFps()
     {
-        uint64_t deltaTime = GetElapsedNanoseconds();
-        double fps = 1000000000.0 / deltaTime;
-        double alpha = m_filterConstant;
-        m_fps = fps * alpha + m_fps * (1.0 - alpha);
-        fps = round(m_fps);
+        PROFILE_ZONE("FpsRenderer::RenderFps");
+        // The first frame would include all the loading.
+        uint64_t currentTime = GetMonotonicNanoseconds();
+        if (m_previousTime)
+            m_stats.AddFrame(currentTime - m_previousTime);
+        m_previousTime = currentTime;
+        if (!m_stats.GetCount())
+            return;
+
+        FrameSummary summary;
+        m_stats.Summarize(summary);
+        int fps = std::min((int) (summary.Fps + 0.5f), 999);
         
         glBindTexture(GL_TEXTURE_2D, m_textureHandle);
         glEnable(GL_BLEND);
@@ -59,13 +47,16 @@ public:
         glEnable(GL_TEXTURE_2D);
         glColor4f(1, 1, 1, 1);
         
-        char digits[MaxNumDigits + 1] = {0};
-        sprintf(digits, "%d", (int) fps);
+        int digits[MaxNumDigits];
+        int numDigits = 0;
+        do {
+            digits[numDigits++] = fps % 10;
+            fps /= 10;
+        } while (fps > 0);
         vec2 pos(5, 10);
 
-        for (char* digit = &digits[0]; *digit; ++digit) {
-            int glyphIndex = *digit - '0';
-            const Glyph& glyph = NumeralGlyphs[glyphIndex];
+        while (numDigits--) {
+            const Glyph& glyph = NumeralGlyphs[digits[numDigits]];
             RenderGlyph(glyph, pos);
             pos.x += glyph.Metrics.XAdvance;
         }
@@ -76,20 +67,7 @@ public:
 private:
 
     static const int MaxNumDigits = 3;
-    
-    uint64_t GetElapsedNanoseconds()
-    {
-        uint64_t current = mach_absolute_time();
-        uint64_t duration = current - m_previousTime;
-        m_previousTime = current;
-        
-        mach_timebase_info_data_t info;
-        mach_timebase_info(&info);
-        duration *= info.numer;
-        duration /= info.denom;
-        
-        return duration;
-    }
+    static const int FrameCount = 64;
     
     void RenderGlyph(const Glyph& glyph, vec2 position)
     { 
@@ -105,8 +83,7 @@ private:
                       glyph.Metrics.Width + 1, glyph.Metrics.Height + 1);
     }
 
-    double m_filterConstant;
-    double m_fps;
+    FrameStats m_stats;
     uint64_t m_previousTime;
     vec2 m_textureSize;
     GLuint m_textureHandle;
@@ -1,99 +1,122 @@
 #include <OpenGLES/ES1/gl.h>
 #include <OpenGLES/ES1/glext.h>
-#include <mach/mach.h>
-#include <mach/mach_time.h>
+#include "../../Common/Classes/GlStateCache.hpp"
+#include "../../Common/Classes/PvrUpload.hpp"
 #include "../Textures/NumeralsTexture.h"
+#include "../../Common/Classes/FrameStats.hpp"
+#include "../../Common/Classes/MonotonicClock.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include <iostream>
 
-typedef unsigned int PVRTuint32;
-
-struct PVR_Texture_Header {
-    PVRTuint32 dwHeaderSize;
-    PVRTuint32 dwHeight;
-    PVRTuint32 dwWidth;
-    PVRTuint32 dwMipMapCount;
-    PVRTuint32 dwpfFlags;
-    PVRTuint32 dwTextureDataSize;
-    PVRTuint32 dwBitCount;
-    PVRTuint32 dwRBitMask;
-    PVRTuint32 dwGBitMask;
-    PVRTuint32 dwBBitMask;
-    PVRTuint32 dwAlphaBitMask;
-    PVRTuint32 dwPVR;
-    PVRTuint32 dwNumSurfs;
-};
-
+// Shows the mean frame rate in white, followed by the 99th percentile and
+// the worst frame time in milliseconds, in red and orange.  Above them is a
+// graph of the most recent frame times, with lines across it at the 50th,
+// 95th, and 99th percentiles.  Everything goes through one vertex buffer
+// that gets updated in place, so nothing is allocated after construction.
 class FpsRenderer {
 public:
-    FpsRenderer(vec2 windowSize)
+    FpsRenderer(vec2 windowSize) : m_stats(GraphFrames)
     {
-        m_filterConstant = 0.1;
-        m_fps = 0;
         m_windowSize = windowSize;
-        m_previousTime = mach_absolute_time();
+        m_previousTime = 0;
         
         glGenTextures(1, &m_textureHandle);
         glBindTexture(GL_TEXTURE_2D, m_textureHandle);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        PVR_Texture_Header* header = (PVR_Texture_Header*) NumeralsTexture;
-        const unsigned char* bytes = (unsigned char*) NumeralsTexture;
-        const unsigned char* imageData = bytes + header->dwHeaderSize;
-        GLenum type = GL_UNSIGNED_BYTE;
-        GLenum format = GL_ALPHA;
-        int w = header->dwWidth;
-        int h = header->dwHeight;
-        m_textureSize = vec2(w, h);
-        glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, imageData);
+        PvrTexture numerals;
+        numerals.Parse(NumeralsTexture, sizeof(NumeralsTexture));
+        if (!UploadPvrTexture(numerals))
+            std::cout << "Bad numerals texture: "
+                      << PvrTexture::GetErrorString(numerals.GetError()) << "\n";
+        m_textureSize = vec2(numerals.GetWidth(), numerals.GetHeight());
         
         glGenBuffers(1, &m_vbo);
         glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
-        int totalSize = BytesPerDigit * MaxNumDigits;
-        glBufferData(GL_ARRAY_BUFFER, totalSize, 0, GL_DYNAMIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(m_vertices), 0, GL_DYNAMIC_DRAW);
     }
     void RenderFps()
     {
-        uint64_t deltaTime = GetElapsedNanoseconds();
-        double fps = 1000000000.0 / deltaTime;
-        double alpha = m_filterConstant;
-        m_fps = fps * alpha + m_fps * (1.0 - alpha);
-        fps = round(m_fps);
+        PROFILE_ZONE("FpsRenderer::RenderFps");
+        // The first frame would include all the loading.
+        uint64_t currentTime = GetMonotonicNanoseconds();
+        if (m_previousTime)
+            m_stats.AddFrame(currentTime - m_previousTime);
+        m_previousTime = currentTime;
+        if (!m_stats.GetCount())
+            return;
+
+        FrameSummary summary;
+        m_stats.Summarize(summary);
         
-        char digits[MaxNumDigits + 1] = {0};
-        sprintf(digits, "%d", (int) fps);
-        int numDigits = strlen(digits);
+        // Numbers first, then the graph's bars and percentile lines.
+        const float values[NumberCount] = { summary.Fps, summary.P99, summary.Worst };
+        int digitCounts[NumberCount];
         vec2 pos(5, 10);
+        for (int i = 0; i < NumberCount; ++i) {
+            float* first = m_vertices + i * MaxNumDigits * FloatsPerDigit;
+            float* end = WriteNumber((int) (values[i] + 0.5f), pos, first);
+            digitCounts[i] = (end - first) / FloatsPerDigit;
+            pos.x += NumberSpacing;
+        }
         
-        vector<float> vbo(numDigits * FloatsPerDigit);
-        float* vertex = &vbo[0];
-        for (char* digit = &digits[0]; *digit; ++digit) {
-            int glyphIndex = *digit - '0';
-            const Glyph& glyph = NumeralGlyphs[glyphIndex];
-            vertex = WriteGlyphVertex(glyph, pos, 0, vertex);
-            vertex = WriteGlyphVertex(glyph, pos, 1, vertex);
-            vertex = WriteGlyphVertex(glyph, pos, 2, vertex);
-            vertex = WriteGlyphVertex(glyph, pos, 2, vertex);
-            vertex = WriteGlyphVertex(glyph, pos, 3, vertex);
-            vertex = WriteGlyphVertex(glyph, pos, 1, vertex);
-            pos.x += glyph.Metrics.XAdvance;
+        float* graph = m_vertices + NumberCount * MaxNumDigits * FloatsPerDigit;
+        float* vertex = graph;
+        float left = 5, bottom = 40;
+        for (int age = m_stats.GetCount() - 1; age >= 0; --age) {
+            float x = left + GraphFrames - 1 - age;
+            *vertex++ = x;
+            *vertex++ = bottom;
+            *vertex++ = x;
+            *vertex++ = bottom + GraphHeight(m_stats.GetFrame(age));
+        }
+        int barVertexCount = (vertex - graph) / 2;
+        vertex = graph + GraphFrames * 4;
+        const float percentiles[] = { summary.P50, summary.P95, summary.P99 };
+        for (int i = 0; i < 3; ++i) {
+            float y = bottom + GraphHeight(percentiles[i]);
+            *vertex++ = left;
+            *vertex++ = y;
+            *vertex++ = left + GraphFrames;
+            *vertex++ = y;
         }
         
         glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, BytesPerDigit * numDigits, &vbo[0]);
-        glBindTexture(GL_TEXTURE_2D, m_textureHandle);
-        glVertexPointer(2, GL_FLOAT, BytesPerVert, 0);
-        glTexCoordPointer(2, GL_FLOAT, BytesPerVert, (GLvoid*) TexCoordOffset);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(m_vertices), m_vertices);
         glEnable(GL_BLEND);
         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
         glDisable(GL_DEPTH_TEST);
-        glEnable(GL_TEXTURE_2D);
         glMatrixMode(GL_PROJECTION);
         glLoadIdentity();
         glOrthof(0, m_windowSize.x, 0, m_windowSize.y, 0, 1);
         glMatrixMode(GL_MODELVIEW);
         glLoadIdentity();
-        glColor4f(1, 1, 1, 1);
         glDisableClientState(GL_NORMAL_ARRAY);
-        glDrawArrays(GL_TRIANGLES, 0, numDigits * VertsPerDigit);
+        
+        // The graph is untextured lines.
+        const GLvoid* graphOffset = (const GLvoid*) ((graph - m_vertices) * sizeof(float));
+        glDisable(GL_TEXTURE_2D);
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        glVertexPointer(2, GL_FLOAT, 2 * sizeof(float), graphOffset);
+        glColor4f(1, 1, 1, 0.5f);
+        glDrawArrays(GL_LINES, 0, barVertexCount);
+        const float lineColors[][3] = { {0, 1, 0}, {1, 1, 0}, {1, 0, 0} };
+        for (int i = 0; i < 3; ++i) {
+            glColor4f(lineColors[i][0], lineColors[i][1], lineColors[i][2], 1);
+            glDrawArrays(GL_LINES, GraphFrames * 2 + i * 2, 2);
+        }
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+        
+        glEnable(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, m_textureHandle);
+        glVertexPointer(2, GL_FLOAT, BytesPerVert, 0);
+        glTexCoordPointer(2, GL_FLOAT, BytesPerVert, (GLvoid*) TexCoordOffset);
+        const float numberColors[][3] = { {1, 1, 1}, {1, 0, 0}, {1, 0.5f, 0} };
+        for (int i = 0; i < NumberCount; ++i) {
+            glColor4f(numberColors[i][0], numberColors[i][1], numberColors[i][2], 1);
+            glDrawArrays(GL_TRIANGLES, i * MaxNumDigits * VertsPerDigit,
+                         digitCounts[i] * VertsPerDigit);
+        }
         glEnableClientState(GL_NORMAL_ARRAY);
         glDisable(GL_BLEND);
     }
@@ -101,25 +124,49 @@ public:
 private:
 
     static const int MaxNumDigits = 3;
+    static const int NumberCount = 3;
+    static const int NumberSpacing = 70;
     static const int VertsPerDigit = 6;
     static const int FloatsPerVert = 4;
     static const int FloatsPerDigit = VertsPerDigit * FloatsPerVert;
     static const int TexCoordOffset = sizeof(float) * 2;
     static const int BytesPerVert = sizeof(float) * FloatsPerVert;
-    static const int BytesPerDigit = sizeof(float) * FloatsPerDigit;
+    static const int GraphFrames = 128;
+    static const int GraphPixelsPerMillisecond = 2;
+    static const int GraphMaxHeight = 100;
+    static const int FloatsPerGraph = GraphFrames * 4 + 3 * 4;
+    static const int FloatCount = NumberCount * MaxNumDigits * FloatsPerDigit + FloatsPerGraph;
     
-    uint64_t GetElapsedNanoseconds()
+    float GraphHeight(float milliseconds) const
     {
-        uint64_t current = mach_absolute_time();
-        uint64_t duration = current - m_previousTime;
-        m_previousTime = current;
-        
-        mach_timebase_info_data_t info;
-        mach_timebase_info(&info);
-        duration *= info.numer;
-        duration /= info.denom;
+        float height = milliseconds * GraphPixelsPerMillisecond;
+        return height < GraphMaxHeight ? height : GraphMaxHeight;
+    }
+
+    // Writes the digits of a non-negative number, clamped to what fits,
+    // and returns the end of the vertices.
+    float* WriteNumber(int value, vec2 pos, float* vertex)
+    {
+        int digits[MaxNumDigits];
+        int numDigits = 0;
+        if (value > 999)
+            value = 999;
+        do {
+            digits[numDigits++] = value % 10;
+            value /= 10;
+        } while (value > 0);
         
-        return duration;
+        while (numDigits--) {
+            const Glyph& glyph = NumeralGlyphs[digits[numDigits]];
+            vertex = WriteGlyphVertex(glyph, pos, 0, vertex);
+            vertex = WriteGlyphVertex(glyph, pos, 1, vertex);
+            vertex = WriteGlyphVertex(glyph, pos, 2, vertex);
+            vertex = WriteGlyphVertex(glyph, pos, 2, vertex);
+            vertex = WriteGlyphVertex(glyph, pos, 3, vertex);
+            vertex = WriteGlyphVertex(glyph, pos, 1, vertex);
+            pos.x += glyph.Metrics.XAdvance;
+        }
+        return vertex;
     }
 
     float* WriteGlyphVertex(const Glyph& glyph, vec2 position, int corner, float* vertex)
@@ -148,11 +195,11 @@ private:
         return vertex;
     }
     
-    double m_filterConstant;
-    double m_fps;
+    FrameStats m_stats;
     uint64_t m_previousTime;
     vec2 m_windowSize;
     vec2 m_textureSize;
     GLuint m_textureHandle;
     GLuint m_vbo;
+    float m_vertices[FloatCount];
 };
@@ -62,7 +62,7 @@ struct IRenderingEngine {
 
 struct IResourceManager {
     virtual TextureDescription LoadImage(const string& filename) = 0;
-    virtual TextureDescription ParsePvrHeader(const unsigned long* imageData) = 0;
+    virtual TextureDescription ParsePvrHeader(const void* imageData, size_t imageSize) = 0;
     virtual void* GetImageData() = 0;
     virtual void UnloadImage() = 0;
     virtual ~IResourceManager() {}
@@ -3,7 +3,7 @@
 #import <string>
 #import <iostream>
 #import "Interfaces.hpp"
-#import "../PowerVR/PVRTTexture.h"
+#import "../../Common/Classes/PvrTexture.hpp"
 
 using namespace std;
 
@@ -13,49 +13,10 @@ public:
     {
         m_imageData = 0;
     }
-    TextureDescription ParsePvrHeader(const unsigned long* imageData)
+    TextureDescription ParsePvrHeader(const void* imageData, size_t imageSize)
     {
-        PVR_Texture_Header* header = (PVR_Texture_Header*) imageData;
-        bool hasAlpha = header->dwAlphaBitMask ? true : false;
-        
-        TextureDescription description;
-        switch (header->dwpfFlags & PVRTEX_PIXELTYPE) {
-            case OGL_RGBA_8888:
-                description.Format = TextureFormatRgba;
-                description.BitsPerComponent = 8;
-                break;
-            case OGL_RGB_565:
-                description.Format = TextureFormat565;
-                break;
-            case OGL_RGBA_5551:
-                description.Format = TextureFormat5551;
-                break;
-            case OGL_RGBA_4444:
-                description.Format = TextureFormatRgba;
-                description.BitsPerComponent = 4;
-                break;
-            case OGL_PVRTC2:    
-                description.Format = hasAlpha ? TextureFormatPvrtcRgba2 :
-                TextureFormatPvrtcRgb2;
-                break;
-            case OGL_PVRTC4:
-                description.Format = hasAlpha ? TextureFormatPvrtcRgba4 :
-                TextureFormatPvrtcRgb4;
-                break;
-            case OGL_I_8:
-                description.Format = TextureFormatGray;
-                break;
-            default:
-                assert(!"Unsupported PVR image.");
-                break;
-        }
-        
-        description.Size.x = header->dwWidth;
-        description.Size.y = header->dwHeight;
-        description.MipCount = header->dwMipMapCount;
-        description.Offset = header->dwHeaderSize;
-        
-        return description;
+        m_pvrTexture.Parse(imageData, imageSize);
+        return DescribePvrTexture(m_pvrTexture);
     }
     TextureDescription LoadImage(const string& file)
     {
@@ -107,18 +68,14 @@ public:
         m_imageData = [NSData dataWithContentsOfFile:fullPath];
         m_hasPvrHeader = true;
         
-        const unsigned long *imageData = (unsigned long *) [m_imageData bytes];
-        return ParsePvrHeader(imageData);
+        return ParsePvrHeader([m_imageData bytes], [m_imageData length]);
     }
     void* GetImageData()
     {
         if (!m_hasPvrHeader)
             return (void*) [m_imageData bytes];
         
-        PVR_Texture_Header* header = (PVR_Texture_Header*) [m_imageData bytes];
-        char* data = (char*) [m_imageData bytes];
-        unsigned int headerSize = header->dwHeaderSize;
-        return data + headerSize;
+        return (void*) m_pvrTexture.GetData();
     }
     void UnloadImage()
     {
@@ -126,7 +83,66 @@ public:
     }
     
 private:
+    TextureDescription DescribePvrTexture(const PvrTexture& texture)
+    {
+        // A bad or unsupported image comes back with no levels, so nothing
+        // gets uploaded.
+        TextureDescription description;
+        description.Format = TextureFormatRgba;
+        description.BitsPerComponent = 8;
+        description.Size = ivec2(0, 0);
+        description.OriginalSize = description.Size;
+        description.MipCount = 0;
+        description.Offset = 0;
+        if (!texture.IsValid()) {
+            cout << "Bad PVR image: "
+                 << PvrTexture::GetErrorString(texture.GetError()) << endl;
+            return description;
+        }
+        
+        bool hasAlpha = texture.HasAlpha();
+        
+        switch (texture.GetPixelType()) {
+            case PvrPixelTypeRgba8888:
+                description.Format = TextureFormatRgba;
+                description.BitsPerComponent = 8;
+                break;
+            case PvrPixelTypeRgb565:
+                description.Format = TextureFormat565;
+                break;
+            case PvrPixelTypeRgba5551:
+                description.Format = TextureFormat5551;
+                break;
+            case PvrPixelTypeRgba4444:
+                description.Format = TextureFormatRgba;
+                description.BitsPerComponent = 4;
+                break;
+            case PvrPixelTypePvrtc2:
+                description.Format = hasAlpha ? TextureFormatPvrtcRgba2 :
+                TextureFormatPvrtcRgb2;
+                break;
+            case PvrPixelTypePvrtc4:
+                description.Format = hasAlpha ? TextureFormatPvrtcRgba4 :
+                TextureFormatPvrtcRgb4;
+                break;
+            case PvrPixelTypeI8:
+                description.Format = TextureFormatGray;
+                break;
+            default:
+                cout << "Unsupported PVR image." << endl;
+                return description;
+        }
+        
+        description.Size.x = texture.GetWidth();
+        description.Size.y = texture.GetHeight();
+        description.OriginalSize = description.Size;
+        description.MipCount = texture.GetLevelCount();
+        description.Offset = texture.GetHeader().HeaderSize;
+        
+        return description;
+    }
     NSData* m_imageData;
+    PvrTexture m_pvrTexture;
     bool m_hasPvrHeader;
     unsigned int NextPot(unsigned int n)
     {
@@ -7,6 +7,7 @@
 
 #include "Interfaces.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 namespace FacetedES1 {
 
@@ -141,6 +142,7 @@ void RenderingEngine::Initialize(const vector<ISurface*>& surfaces)
 
 void RenderingEngine::Render(const vector<Visual>& visuals) const
 {
+    PROFILE_ZONE("FacetedES1::RenderingEngine::Render");
     glClearColor(0.5f, 0.5f, 0.5f, 1);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     
@@ -1,6 +1,7 @@
 #include "Interfaces.hpp"
 #include "ObjSurface.hpp"
 #include "ParametricEquations.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 using namespace std;
 
@@ -116,6 +117,7 @@ void ApplicationEngine::PopulateVisuals(Visual* visuals) const
 
 void ApplicationEngine::Render() const
 {
+    PROFILE_ZONE("ObjViewer::ApplicationEngine::Render");
     vector<Visual> visuals(SurfaceCount);
     
     if (!m_animation.Active) {
@@ -141,6 +143,7 @@ void ApplicationEngine::Render() const
 
 void ApplicationEngine::UpdateAnimation(float dt)
 {
+    PROFILE_ZONE("ObjViewer::ApplicationEngine::UpdateAnimation");
     if (m_animation.Active) {
         m_animation.Elapsed += dt;
         if (m_animation.Elapsed > m_animation.Duration)
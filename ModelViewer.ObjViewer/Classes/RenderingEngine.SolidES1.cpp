@@ -2,13 +2,24 @@
 #include <OpenGLES/ES1/glext.h>
 #include "Interfaces.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/DrawBatcher.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 namespace SolidES1 {
 
+// Visuals that share a surface and a color are drawn together, up to this
+// many at a time, with their vertices transformed on the CPU.
+const int MaxBatchInstances = 32;
+const float SurfaceDistance = 7;
+
 struct Drawable {
     GLuint VertexBuffer;
     GLuint IndexBuffer;
     int IndexCount;
+    int VertexCount;
+    float Radius;
+    GLuint BatchIndexBuffer;    // the indices once for each copy in a batch
+    vector<float> Vertices;     // what the batches transform
 };
 
 class RenderingEngine : public IRenderingEngine {
@@ -17,11 +28,31 @@ public:
     void Initialize(const vector<ISurface*>& surfaces);
     void Render(const vector<Visual>& visuals) const;
 private:
+    void RenderVisual(const Visual& visual, const Drawable& drawable) const;
+    void RenderBatch(const DrawBatch& batch, const vector<Visual>& visuals) const;
     vector<Drawable> m_drawables;
+    vector<int> m_capacities;
     GLuint m_colorRenderbuffer;
     GLuint m_depthRenderbuffer;
     mat4 m_translation;
+    ivec2 m_screenSize;
+    mutable DrawBatcher m_batcher;
+    mutable vector<float> m_batchVertices;
 };
+
+static mat4 GetProjection(ivec2 size)
+{
+    float h = 4.0f * size.y / size.x;
+    return mat4::Frustum(-2, 2, -h / 2, h / 2, 5, 10);
+}
+
+static int GetColorKey(vec3 color)
+{
+    int r = (int) (color.x * 255 + 0.5f);
+    int g = (int) (color.y * 255 + 0.5f);
+    int b = (int) (color.z * 255 + 0.5f);
+    return (r << 16) | (g << 8) | b;
+}
     
 IRenderingEngine* CreateRenderingEngine()
 {
@@ -66,7 +97,37 @@ void RenderingEngine::Initialize(const vector<ISurface*>& surfaces)
                          GL_STATIC_DRAW);
         }
         
-        Drawable drawable = { vertexBuffer, indexBuffer, indexCount};
+        Drawable drawable;
+        drawable.VertexBuffer = vertexBuffer;
+        drawable.IndexBuffer = indexBuffer;
+        drawable.IndexCount = indexCount;
+        drawable.VertexCount = vertices.size() / 6;
+        drawable.BatchIndexBuffer = 0;
+
+        // Batches skip the viewport clip, so they need the surface's extent.
+        drawable.Radius = 0;
+        for (size_t i = 0; i < vertices.size(); i += 6) {
+            vec3 p(vertices[i], vertices[i + 1], vertices[i + 2]);
+            drawable.Radius = std::max(drawable.Radius, std::sqrt(p.Dot(p)));
+        }
+
+        // Create a VBO with the indices repeated for each copy in a batch.
+        int capacity = GetBatchCapacity(drawable.VertexCount, MaxBatchInstances);
+        if (capacity > 1) {
+            vector<GLushort> indices(indexCount);
+            (*surface)->GenerateTriangleIndices(indices);
+            vector<GLushort> batchIndices;
+            BuildBatchIndices(&indices[0], indexCount, drawable.VertexCount,
+                              capacity, batchIndices);
+            glGenBuffers(1, &drawable.BatchIndexBuffer);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, drawable.BatchIndexBuffer);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                         batchIndices.size() * sizeof(GLushort),
+                         &batchIndices[0],
+                         GL_STATIC_DRAW);
+            drawable.Vertices.swap(vertices);
+        }
+        m_capacities.push_back(capacity);
         m_drawables.push_back(drawable);
     }
 
@@ -82,6 +143,7 @@ void RenderingEngine::Initialize(const vector<ISurface*>& surfaces)
     glBindRenderbufferOES(GL_RENDERBUFFER_OES, m_depthRenderbuffer);
     glRenderbufferStorageOES(GL_RENDERBUFFER_OES, GL_DEPTH_COMPONENT16_OES,
                              width, height);
+    m_screenSize = ivec2(width, height);
 
     // Create the framebuffer object.
     GLuint framebuffer;
@@ -105,54 +167,119 @@ void RenderingEngine::Initialize(const vector<ISurface*>& surfaces)
     glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, specular.Pointer());
     glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 50.0f);
 
-    m_translation = mat4::Translate(0, 0, -7);
+    m_translation = mat4::Translate(0, 0, -SurfaceDistance);
 }
 
 void RenderingEngine::Render(const vector<Visual>& visuals) const
 {
+    PROFILE_ZONE("SolidES1::RenderingEngine::Render");
     glClearColor(0.5f, 0.5f, 0.5f, 1);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     
-    vector<Visual>::const_iterator visual = visuals.begin();
-    for (int visualIndex = 0; visual != visuals.end(); ++visual, ++visualIndex) {
-        
-        // Set the viewport transform.
-        ivec2 size = visual->ViewportSize;
-        ivec2 lowerLeft = visual->LowerLeft;
-        glViewport(lowerLeft.x, lowerLeft.y, size.x, size.y);
-        
-        // Set the light position.
-        glMatrixMode(GL_MODELVIEW);
-        glLoadIdentity();
-        vec4 lightPosition(0.25, 0.25, 1, 0);
-        glLightfv(GL_LIGHT0, GL_POSITION, lightPosition.Pointer());
-        
-        // Set the model-view transform.
-        mat4 rotation = visual->Orientation.ToMatrix();
+    // Visuals cycle through the surfaces, and those whose surface stays
+    // inside their viewport can share a draw with others like them.
+    m_batcher.Clear();
+    for (size_t i = 0; i < visuals.size(); ++i) {
+        int surface = i % m_drawables.size();
+        mat4 projection = GetProjection(visuals[i].ViewportSize);
+        bool shareable = IsInsideViewport(projection.Pointer(), SurfaceDistance,
+                                          m_drawables[surface].Radius);
+        m_batcher.Add(surface, GetColorKey(visuals[i].Color), shareable);
+    }
+    m_batcher.Build(m_capacities);
+
+    for (int i = 0; i < m_batcher.GetBatchCount(); ++i) {
+        const DrawBatch& batch = m_batcher.GetBatch(i);
+        if (batch.Count == 1) {
+            const Visual& visual = visuals[m_batcher.GetDraw(batch.First)];
+            RenderVisual(visual, m_drawables[batch.Mesh]);
+        } else {
+            RenderBatch(batch, visuals);
+        }
+    }
+}
+
+void RenderingEngine::RenderVisual(const Visual& visual, const Drawable& drawable) const
+{
+    // Set the viewport transform.
+    ivec2 size = visual.ViewportSize;
+    ivec2 lowerLeft = visual.LowerLeft;
+    glViewport(lowerLeft.x, lowerLeft.y, size.x, size.y);
+    
+    // Set the light position.
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+    vec4 lightPosition(0.25, 0.25, 1, 0);
+    glLightfv(GL_LIGHT0, GL_POSITION, lightPosition.Pointer());
+    
+    // Set the model-view transform.
+    mat4 rotation = visual.Orientation.ToMatrix();
+    mat4 modelview = rotation * m_translation;
+    glLoadMatrixf(modelview.Pointer());
+    
+    // Set the projection transform.
+    mat4 projection = GetProjection(size);
+    glMatrixMode(GL_PROJECTION);
+    glLoadMatrixf(projection.Pointer());
+    
+    // Set the diffuse color.
+    vec3 color = visual.Color * 0.75f;
+    vec4 diffuse(color.x, color.y, color.z, 1);
+    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, diffuse.Pointer());
+
+    // Draw the surface.
+    int stride = 2 * sizeof(vec3);
+    const GLvoid* normalOffset = (const GLvoid*) sizeof(vec3);
+    glBindBuffer(GL_ARRAY_BUFFER, drawable.VertexBuffer);
+    glVertexPointer(3, GL_FLOAT, stride, 0);
+    glNormalPointer(GL_FLOAT, stride, normalOffset);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, drawable.IndexBuffer);
+    glDrawElements(GL_TRIANGLES, drawable.IndexCount, GL_UNSIGNED_SHORT, 0);
+}
+
+// Each copy goes into clip space for the whole screen, with its normals in
+// eye space, so one draw with identity matrices covers them all.  The light
+// is directional and the viewer is at infinity, so eye space positions
+// aren't needed for lighting.
+void RenderingEngine::RenderBatch(const DrawBatch& batch, const vector<Visual>& visuals) const
+{
+    const int floatsPerVertex = 7;
+    const Drawable& drawable = m_drawables[batch.Mesh];
+    m_batchVertices.resize(drawable.VertexCount * floatsPerVertex * batch.Count);
+    float* destination = &m_batchVertices[0];
+    for (int i = 0; i < batch.Count; ++i) {
+        const Visual& visual = visuals[m_batcher.GetDraw(batch.First + i)];
+        ivec2 size = visual.ViewportSize;
+        int viewport[] = { visual.LowerLeft.x, visual.LowerLeft.y, size.x, size.y };
+        float screen[16], transform[16];
+        GetViewportTransform(viewport, m_screenSize.x, m_screenSize.y, screen);
+        mat4 rotation = visual.Orientation.ToMatrix();
         mat4 modelview = rotation * m_translation;
-        glLoadMatrixf(modelview.Pointer());
-        
-        // Set the projection transform.
-        float h = 4.0f * size.y / size.x;
-        mat4 projection = mat4::Frustum(-2, 2, -h / 2, h / 2, 5, 10);
-        glMatrixMode(GL_PROJECTION);
-        glLoadMatrixf(projection.Pointer());
-        
-        // Set the diffuse color.
-        vec3 color = visual->Color * 0.75f;
-        vec4 diffuse(color.x, color.y, color.z, 1);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, diffuse.Pointer());
-
-        // Draw the surface.
-        int stride = 2 * sizeof(vec3);
-        const GLvoid* normalOffset = (const GLvoid*) sizeof(vec3);
-        const Drawable& drawable = m_drawables[visualIndex];
-        glBindBuffer(GL_ARRAY_BUFFER, drawable.VertexBuffer);
-        glVertexPointer(3, GL_FLOAT, stride, 0);
-        glNormalPointer(GL_FLOAT, stride, normalOffset);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, drawable.IndexBuffer);
-        glDrawElements(GL_TRIANGLES, drawable.IndexCount, GL_UNSIGNED_SHORT, 0);
+        mat4 clip = modelview * GetProjection(size);
+        MultiplyBatchMatrices(clip.Pointer(), screen, transform);
+        destination = TransformBatchVertices(&drawable.Vertices[0], drawable.VertexCount, 6,
+                                             transform, modelview.Pointer(), destination);
     }
+
+    glViewport(0, 0, m_screenSize.x, m_screenSize.y);
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+    vec4 lightPosition(0.25, 0.25, 1, 0);
+    glLightfv(GL_LIGHT0, GL_POSITION, lightPosition.Pointer());
+
+    // The copies share a color, so take the first's.
+    vec3 color = visuals[m_batcher.GetDraw(batch.First)].Color * 0.75f;
+    vec4 diffuse(color.x, color.y, color.z, 1);
+    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, diffuse.Pointer());
+
+    int stride = floatsPerVertex * sizeof(float);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glVertexPointer(4, GL_FLOAT, stride, &m_batchVertices[0]);
+    glNormalPointer(GL_FLOAT, stride, &m_batchVertices[4]);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, drawable.BatchIndexBuffer);
+    glDrawElements(GL_TRIANGLES, drawable.IndexCount * batch.Count, GL_UNSIGNED_SHORT, 0);
 }
     
 }
\ No newline at end of file
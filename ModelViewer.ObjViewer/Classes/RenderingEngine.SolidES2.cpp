@@ -2,6 +2,8 @@
 #include <OpenGLES/ES2/glext.h>
 #include "Interfaces.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/DrawBatcher.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <iostream>
 
 namespace SolidES2 {
@@ -9,6 +11,12 @@ namespace SolidES2 {
 #define STRINGIFY(A)  #A
 #include "../Shaders/SimpleLighting.es2.vert"
 #include "../Shaders/SimpleLighting.es2.frag"
+#include "../Shaders/SimpleLightingBatched.es2.vert"
+
+// Visuals that share a surface are drawn together, each indexing the
+// batched shader's uniform arrays, so this must match their size.
+const int MaxBatchInstances = 12;
+const float SurfaceDistance = 7;
 
 struct UniformHandles {
     GLuint Modelview;
@@ -25,11 +33,30 @@ struct AttributeHandles {
     GLint Normal;
     GLint DiffuseMaterial;
 };
+
+struct BatchUniformHandles {
+    GLint Transforms;
+    GLint NormalMatrices;
+    GLint DiffuseMaterials;
+    GLint LightPosition;
+    GLint AmbientMaterial;
+    GLint SpecularMaterial;
+    GLint Shininess;
+};
+
+struct BatchAttributeHandles {
+    GLint Position;
+    GLint Normal;
+    GLint Instance;
+};
     
 struct Drawable {
     GLuint VertexBuffer;
     GLuint IndexBuffer;
     int IndexCount;
+    float Radius;
+    GLuint BatchVertexBuffer;   // a copy of the vertices for each instance
+    GLuint BatchIndexBuffer;
 };
 
 class RenderingEngine : public IRenderingEngine {
@@ -40,14 +67,34 @@ public:
 private:
     GLuint BuildShader(const char* source, GLenum shaderType) const;
     GLuint BuildProgram(const char* vShader, const char* fShader) const;
+    void RenderVisual(const Visual& visual, const Drawable& drawable) const;
+    void RenderBatch(const DrawBatch& batch, const vector<Visual>& visuals) const;
+    void SelectProgram(bool batched) const;
     vector<Drawable> m_drawables;
+    vector<int> m_capacities;
     GLuint m_colorRenderbuffer;
     GLuint m_depthRenderbuffer;
     mat4 m_translation;
+    ivec2 m_screenSize;
+    GLuint m_program;
+    GLuint m_batchProgram;
     UniformHandles m_uniforms;
     AttributeHandles m_attributes;
+    BatchUniformHandles m_batchUniforms;
+    BatchAttributeHandles m_batchAttributes;
+    mutable bool m_batching;
+    mutable DrawBatcher m_batcher;
+    mutable vector<float> m_batchTransforms;
+    mutable vector<float> m_batchNormalMatrices;
+    mutable vector<float> m_batchColors;
 };
 
+static mat4 GetProjection(ivec2 size)
+{
+    float h = 4.0f * size.y / size.x;
+    return mat4::Frustum(-2, 2, -h / 2, h / 2, 5, 10);
+}
+
 IRenderingEngine* CreateRenderingEngine()
 {
     return new RenderingEngine();
@@ -91,7 +138,47 @@ void RenderingEngine::Initialize(const vector<ISurface*>& surfaces)
                          GL_STATIC_DRAW);
         }
         
-        Drawable drawable = { vertexBuffer, indexBuffer, indexCount};
+        Drawable drawable = { vertexBuffer, indexBuffer, indexCount, 0, 0, 0 };
+
+        // Batches skip the viewport clip, so they need the surface's extent.
+        int vertexCount = vertices.size() / 6;
+        for (int i = 0; i < vertexCount; ++i) {
+            vec3 p(vertices[i * 6], vertices[i * 6 + 1], vertices[i * 6 + 2]);
+            drawable.Radius = std::max(drawable.Radius, std::sqrt(p.Dot(p)));
+        }
+
+        // Create VBOs with a copy of the surface for each instance in a
+        // batch, each vertex tagged with its instance's number.
+        int capacity = GetBatchCapacity(vertexCount, MaxBatchInstances);
+        if (capacity > 1) {
+            vector<float> batchVertices;
+            batchVertices.reserve(vertexCount * 7 * capacity);
+            for (int instance = 0; instance < capacity; ++instance) {
+                for (int i = 0; i < vertexCount; ++i) {
+                    const float* vertex = &vertices[i * 6];
+                    batchVertices.insert(batchVertices.end(), vertex, vertex + 6);
+                    batchVertices.push_back(instance);
+                }
+            }
+            glGenBuffers(1, &drawable.BatchVertexBuffer);
+            glBindBuffer(GL_ARRAY_BUFFER, drawable.BatchVertexBuffer);
+            glBufferData(GL_ARRAY_BUFFER,
+                         batchVertices.size() * sizeof(batchVertices[0]),
+                         &batchVertices[0],
+                         GL_STATIC_DRAW);
+
+            vector<GLushort> indices(indexCount);
+            (*surface)->GenerateTriangleIndices(indices);
+            vector<GLushort> batchIndices;
+            BuildBatchIndices(&indices[0], indexCount, vertexCount, capacity, batchIndices);
+            glGenBuffers(1, &drawable.BatchIndexBuffer);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, drawable.BatchIndexBuffer);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                         batchIndices.size() * sizeof(GLushort),
+                         &batchIndices[0],
+                         GL_STATIC_DRAW);
+        }
+        m_capacities.push_back(capacity);
         m_drawables.push_back(drawable);
     }
     
@@ -106,6 +193,7 @@ void RenderingEngine::Initialize(const vector<ISurface*>& surfaces)
     glGenRenderbuffers(1, &m_depthRenderbuffer);
     glBindRenderbuffer(GL_RENDERBUFFER, m_depthRenderbuffer);
     glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, width, height);
+    m_screenSize = ivec2(width, height);
     
     // Create the framebuffer object.
     GLuint framebuffer;
@@ -117,9 +205,30 @@ void RenderingEngine::Initialize(const vector<ISurface*>& surfaces)
                               GL_RENDERBUFFER, m_depthRenderbuffer);
     glBindRenderbuffer(GL_RENDERBUFFER, m_colorRenderbuffer);
     
+    // Create the GLSL program for batches, and set its constant uniforms.
+    GLuint program = BuildProgram(BatchedVertexShader, SimpleFragmentShader);
+    glUseProgram(program);
+    m_batchProgram = program;
+    m_batchAttributes.Position = glGetAttribLocation(program, "Position");
+    m_batchAttributes.Normal = glGetAttribLocation(program, "Normal");
+    m_batchAttributes.Instance = glGetAttribLocation(program, "Instance");
+    m_batchUniforms.Transforms = glGetUniformLocation(program, "Transforms");
+    m_batchUniforms.NormalMatrices = glGetUniformLocation(program, "NormalMatrices");
+    m_batchUniforms.DiffuseMaterials = glGetUniformLocation(program, "DiffuseMaterials");
+    m_batchUniforms.LightPosition = glGetUniformLocation(program, "LightPosition");
+    m_batchUniforms.AmbientMaterial = glGetUniformLocation(program, "AmbientMaterial");
+    m_batchUniforms.SpecularMaterial = glGetUniformLocation(program, "SpecularMaterial");
+    m_batchUniforms.Shininess = glGetUniformLocation(program, "Shininess");
+    glUniform3f(m_batchUniforms.LightPosition, 0.25, 0.25, 1);
+    glUniform3f(m_batchUniforms.AmbientMaterial, 0.04f, 0.04f, 0.04f);
+    glUniform3f(m_batchUniforms.SpecularMaterial, 0.5, 0.5, 0.5);
+    glUniform1f(m_batchUniforms.Shininess, 50);
+
     // Create the GLSL program.
-    GLuint program = BuildProgram(SimpleVertexShader, SimpleFragmentShader);
+    program = BuildProgram(SimpleVertexShader, SimpleFragmentShader);
     glUseProgram(program);
+    m_program = program;
+    m_batching = false;
 
     // Extract the handles to attributes and uniforms.
     m_attributes.Position = glGetAttribLocation(program, "Position");
@@ -144,56 +253,147 @@ void RenderingEngine::Initialize(const vector<ISurface*>& surfaces)
     glEnable(GL_DEPTH_TEST);
 
     // Set up transforms.
-    m_translation = mat4::Translate(0, 0, -7);
+    m_translation = mat4::Translate(0, 0, -SurfaceDistance);
 }
 
 void RenderingEngine::Render(const vector<Visual>& visuals) const
 {
+    PROFILE_ZONE("SolidES2::RenderingEngine::Render");
     glClearColor(0.5f, 0.5f, 0.5f, 1);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    vector<Visual>::const_iterator visual = visuals.begin();
-    for (int visualIndex = 0; visual != visuals.end(); ++visual, ++visualIndex) {
+    // Visuals cycle through the surfaces, and those whose surface stays
+    // inside their viewport can share a draw with others on that surface.
+    m_batcher.Clear();
+    for (size_t i = 0; i < visuals.size(); ++i) {
+        int surface = i % m_drawables.size();
+        mat4 projection = GetProjection(visuals[i].ViewportSize);
+        bool shareable = IsInsideViewport(projection.Pointer(), SurfaceDistance,
+                                          m_drawables[surface].Radius);
+        m_batcher.Add(surface, 0, shareable);
+    }
+    m_batcher.Build(m_capacities);
 
-        // Set the viewport transform.
-        ivec2 size = visual->ViewportSize;
-        ivec2 lowerLeft = visual->LowerLeft;
-        glViewport(lowerLeft.x, lowerLeft.y, size.x, size.y);
-        
-        // Set the light position.
-        vec4 lightPosition(0.25, 0.25, 1, 0);
-        glUniform3fv(m_uniforms.LightPosition, 1, lightPosition.Pointer());
+    for (int i = 0; i < m_batcher.GetBatchCount(); ++i) {
+        const DrawBatch& batch = m_batcher.GetBatch(i);
+        if (batch.Count == 1) {
+            const Visual& visual = visuals[m_batcher.GetDraw(batch.First)];
+            RenderVisual(visual, m_drawables[batch.Mesh]);
+        } else {
+            RenderBatch(batch, visuals);
+        }
+    }
+}
+
+void RenderingEngine::RenderVisual(const Visual& visual, const Drawable& drawable) const
+{
+    SelectProgram(false);
 
-        // Set the model-view transform.
-        mat4 rotation = visual->Orientation.ToMatrix();
+    // Set the viewport transform.
+    ivec2 size = visual.ViewportSize;
+    ivec2 lowerLeft = visual.LowerLeft;
+    glViewport(lowerLeft.x, lowerLeft.y, size.x, size.y);
+    
+    // Set the light position.
+    vec4 lightPosition(0.25, 0.25, 1, 0);
+    glUniform3fv(m_uniforms.LightPosition, 1, lightPosition.Pointer());
+
+    // Set the model-view transform.
+    mat4 rotation = visual.Orientation.ToMatrix();
+    mat4 modelview = rotation * m_translation;
+    glUniformMatrix4fv(m_uniforms.Modelview, 1, 0, modelview.Pointer());
+    
+    // Set the normal matrix.
+    // It's orthogonal, so its Inverse-Transpose is itself!
+    mat3 normalMatrix = modelview.ToMat3();
+    glUniformMatrix3fv(m_uniforms.NormalMatrix, 1, 0, normalMatrix.Pointer());
+
+    // Set the projection transform.
+    mat4 projectionMatrix = GetProjection(size);
+    glUniformMatrix4fv(m_uniforms.Projection, 1, 0, projectionMatrix.Pointer());
+    
+    // Set the diffuse color.
+    vec3 color = visual.Color * 0.75f;
+    glVertexAttrib4f(m_attributes.DiffuseMaterial, color.x, color.y, color.z, 1);
+    
+    // Draw the surface.
+    int stride = 2 * sizeof(vec3);
+    const GLvoid* offset = (const GLvoid*) sizeof(vec3);
+    GLint position = m_attributes.Position;
+    GLint normal = m_attributes.Normal;
+    glBindBuffer(GL_ARRAY_BUFFER, drawable.VertexBuffer);
+    glVertexAttribPointer(position, 3, GL_FLOAT, GL_FALSE, stride, 0);
+    glVertexAttribPointer(normal, 3, GL_FLOAT, GL_FALSE, stride, offset);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, drawable.IndexBuffer);
+    glDrawElements(GL_TRIANGLES, drawable.IndexCount, GL_UNSIGNED_SHORT, 0);
+}
+
+// Each instance's transform takes it to clip space for the whole screen,
+// so the batch can draw with one viewport.
+void RenderingEngine::RenderBatch(const DrawBatch& batch, const vector<Visual>& visuals) const
+{
+    m_batchTransforms.resize(16 * batch.Count);
+    m_batchNormalMatrices.resize(9 * batch.Count);
+    m_batchColors.resize(3 * batch.Count);
+    for (int i = 0; i < batch.Count; ++i) {
+        const Visual& visual = visuals[m_batcher.GetDraw(batch.First + i)];
+        ivec2 size = visual.ViewportSize;
+        int viewport[] = { visual.LowerLeft.x, visual.LowerLeft.y, size.x, size.y };
+        float screen[16];
+        GetViewportTransform(viewport, m_screenSize.x, m_screenSize.y, screen);
+        mat4 rotation = visual.Orientation.ToMatrix();
         mat4 modelview = rotation * m_translation;
-        glUniformMatrix4fv(m_uniforms.Modelview, 1, 0, modelview.Pointer());
-        
-        // Set the normal matrix.
-        // It's orthogonal, so its Inverse-Transpose is itself!
+        mat4 clip = modelview * GetProjection(size);
+        MultiplyBatchMatrices(clip.Pointer(), screen, &m_batchTransforms[16 * i]);
         mat3 normalMatrix = modelview.ToMat3();
-        glUniformMatrix3fv(m_uniforms.NormalMatrix, 1, 0, normalMatrix.Pointer());
+        std::copy(normalMatrix.Pointer(), normalMatrix.Pointer() + 9,
+                  &m_batchNormalMatrices[9 * i]);
+        vec3 color = visual.Color * 0.75f;
+        m_batchColors[3 * i] = color.x;
+        m_batchColors[3 * i + 1] = color.y;
+        m_batchColors[3 * i + 2] = color.z;
+    }
 
-        // Set the projection transform.
-        float h = 4.0f * size.y / size.x;
-        mat4 projectionMatrix = mat4::Frustum(-2, 2, -h / 2, h / 2, 5, 10);
-        glUniformMatrix4fv(m_uniforms.Projection, 1, 0, projectionMatrix.Pointer());
-        
-        // Set the diffuse color.
-        vec3 color = visual->Color * 0.75f;
-        glVertexAttrib4f(m_attributes.DiffuseMaterial, color.x, color.y, color.z, 1);
-        
-        // Draw the surface.
-        int stride = 2 * sizeof(vec3);
-        const GLvoid* offset = (const GLvoid*) sizeof(vec3);
-        GLint position = m_attributes.Position;
-        GLint normal = m_attributes.Normal;
-        const Drawable& drawable = m_drawables[visualIndex];
-        glBindBuffer(GL_ARRAY_BUFFER, drawable.VertexBuffer);
-        glVertexAttribPointer(position, 3, GL_FLOAT, GL_FALSE, stride, 0);
-        glVertexAttribPointer(normal, 3, GL_FLOAT, GL_FALSE, stride, offset);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, drawable.IndexBuffer);
-        glDrawElements(GL_TRIANGLES, drawable.IndexCount, GL_UNSIGNED_SHORT, 0);
+    SelectProgram(true);
+    glViewport(0, 0, m_screenSize.x, m_screenSize.y);
+    glUniformMatrix4fv(m_batchUniforms.Transforms, batch.Count, 0, &m_batchTransforms[0]);
+    glUniformMatrix3fv(m_batchUniforms.NormalMatrices, batch.Count, 0, &m_batchNormalMatrices[0]);
+    glUniform3fv(m_batchUniforms.DiffuseMaterials, batch.Count, &m_batchColors[0]);
+
+    int stride = 7 * sizeof(float);
+    const GLvoid* normalOffset = (const GLvoid*) sizeof(vec3);
+    const GLvoid* instanceOffset = (const GLvoid*) (2 * sizeof(vec3));
+    const Drawable& drawable = m_drawables[batch.Mesh];
+    glBindBuffer(GL_ARRAY_BUFFER, drawable.BatchVertexBuffer);
+    glVertexAttribPointer(m_batchAttributes.Position, 3, GL_FLOAT, GL_FALSE, stride, 0);
+    glVertexAttribPointer(m_batchAttributes.Normal, 3, GL_FLOAT, GL_FALSE, stride, normalOffset);
+    glVertexAttribPointer(m_batchAttributes.Instance, 1, GL_FLOAT, GL_FALSE, stride, instanceOffset);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, drawable.BatchIndexBuffer);
+    glDrawElements(GL_TRIANGLES, drawable.IndexCount * batch.Count, GL_UNSIGNED_SHORT, 0);
+}
+
+// The two programs' attributes needn't share locations, so switching
+// swaps which arrays are enabled.
+void RenderingEngine::SelectProgram(bool batched) const
+{
+    if (batched == m_batching)
+        return;
+
+    m_batching = batched;
+    if (batched) {
+        glDisableVertexAttribArray(m_attributes.Position);
+        glDisableVertexAttribArray(m_attributes.Normal);
+        glUseProgram(m_batchProgram);
+        glEnableVertexAttribArray(m_batchAttributes.Position);
+        glEnableVertexAttribArray(m_batchAttributes.Normal);
+        glEnableVertexAttribArray(m_batchAttributes.Instance);
+    } else {
+        glDisableVertexAttribArray(m_batchAttributes.Position);
+        glDisableVertexAttribArray(m_batchAttributes.Normal);
+        glDisableVertexAttribArray(m_batchAttributes.Instance);
+        glUseProgram(m_program);
+        glEnableVertexAttribArray(m_attributes.Position);
+        glEnableVertexAttribArray(m_attributes.Normal);
     }
 }
 
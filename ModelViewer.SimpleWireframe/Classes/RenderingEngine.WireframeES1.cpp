@@ -2,6 +2,7 @@
 #include <OpenGLES/ES1/glext.h>
 #include "Interfaces.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 namespace WireframeES1 {
 
@@ -83,6 +84,7 @@ void RenderingEngine::Initialize(const vector<ISurface*>& surfaces)
 
 void RenderingEngine::Render(const vector<Visual>& visuals) const
 {
+    PROFILE_ZONE("WireframeES1::RenderingEngine::Render");
     glClearColor(0.5f, 0.5f, 0.5f, 1);
     glClear(GL_COLOR_BUFFER_BIT);
     
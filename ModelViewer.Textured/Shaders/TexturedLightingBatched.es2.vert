@@ -0,0 +1,37 @@
+static const char* BatchedVertexShader = STRINGIFY(
+
+attribute vec4 Position;
+attribute vec3 Normal;
+attribute vec2 TextureCoord;
+attribute float Instance;
+
+uniform mat4 Transforms[12];
+uniform mat3 NormalMatrices[12];
+uniform vec3 DiffuseMaterials[12];
+uniform vec3 LightPosition;
+uniform vec3 AmbientMaterial;
+uniform vec3 SpecularMaterial;
+uniform float Shininess;
+
+varying vec4 DestinationColor;
+varying vec2 TextureCoordOut;
+
+void main(void)
+{
+    int instance = int(Instance);
+    vec3 N = NormalMatrices[instance] * Normal;
+    vec3 L = normalize(LightPosition);
+    vec3 E = vec3(0, 0, 1);
+    vec3 H = normalize(L + E);
+
+    float df = max(0.0, dot(N, L));
+    float sf = max(0.0, dot(N, H));
+    sf = pow(sf, Shininess);
+
+    vec3 color = AmbientMaterial + df * DiffuseMaterials[instance] + sf * SpecularMaterial;
+    
+    DestinationColor = vec4(color, 1);
+    gl_Position = Transforms[instance] * Position;
+    TextureCoordOut = TextureCoord;
+}
+);
@@ -1,5 +1,6 @@
 #include "Interfaces.hpp"
 #include "ParametricEquations.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 using namespace std;
 
@@ -112,6 +113,7 @@ void ApplicationEngine::PopulateVisuals(Visual* visuals) const
 
 void ApplicationEngine::Render() const
 {
+    PROFILE_ZONE("ParametricViewer::ApplicationEngine::Render");
     vector<Visual> visuals(SurfaceCount);
     
     if (!m_animation.Active) {
@@ -137,6 +139,7 @@ void ApplicationEngine::Render() const
 
 void ApplicationEngine::UpdateAnimation(float dt)
 {
+    PROFILE_ZONE("ParametricViewer::ApplicationEngine::UpdateAnimation");
     if (m_animation.Active) {
         m_animation.Elapsed += dt;
         if (m_animation.Elapsed > m_animation.Duration)
@@ -7,6 +7,8 @@
 using std::vector;
 using std::string;
 
+class SoftwareRasterizer;
+
 enum VertexFlags {
     VertexFlagsNormals = 1 << 0,
     VertexFlagsTexCoords = 1 << 1,
@@ -69,3 +71,4 @@ namespace DepthViewer  { IRenderingEngine* CreateRenderingEngine(); }
 namespace TexturedES1  { IRenderingEngine* CreateRenderingEngine(IResourceManager*); }
 namespace TexturedES2  { IRenderingEngine* CreateRenderingEngine(IResourceManager*); }
 namespace TexturedGL2  { IRenderingEngine* CreateRenderingEngine(IResourceManager*); }
+namespace Software     { IRenderingEngine* CreateRenderingEngine(SoftwareRasterizer*, bool batched = true); }
@@ -0,0 +1,211 @@
+#include "Interfaces.hpp"
+#include "Matrix.hpp"
+#include "../../Common/Classes/DrawBatcher.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include "../../Common/Classes/SoftwareRasterizer.hpp"
+
+// Draws the same thing as SolidES1, but with SoftwareRasterizer rather
+// than OpenGL, so that it can run headless.  The lighting follows the ES1
+// fixed-function equations with the same light and material settings.
+// Like SolidES1, it draws visuals that share a surface together, except
+// that colors are lit into the vertices, so they needn't match.
+
+namespace Software {
+
+const int MaxBatchInstances = 32;
+const float SurfaceDistance = 7;
+
+struct Drawable {
+    vector<float> Vertices;
+    vector<unsigned short> Indices;
+    vector<unsigned short> BatchIndices;    // the indices once for each copy in a batch
+    float Radius;
+};
+
+class RenderingEngine : public IRenderingEngine {
+public:
+    RenderingEngine(SoftwareRasterizer* rasterizer, bool batched);
+    void Initialize(const vector<ISurface*>& surfaces);
+    void Render(const vector<Visual>& visuals) const;
+private:
+    SoftwareVertex* LightVertices(const Drawable& drawable, const Visual& visual,
+                                  const float* viewportTransform,
+                                  SoftwareVertex* destination) const;
+    vector<Drawable> m_drawables;
+    vector<int> m_capacities;
+    SoftwareRasterizer* m_rasterizer;
+    bool m_batched;
+    mutable DrawBatcher m_batcher;
+    mutable vector<SoftwareVertex> m_vertices;
+    mat4 m_translation;
+};
+
+IRenderingEngine* CreateRenderingEngine(SoftwareRasterizer* rasterizer, bool batched)
+{
+    return new RenderingEngine(rasterizer, batched);
+}
+
+RenderingEngine::RenderingEngine(SoftwareRasterizer* rasterizer, bool batched) :
+    m_rasterizer(rasterizer), m_batched(batched)
+{
+}
+
+static mat4 GetProjection(ivec2 size)
+{
+    float h = 4.0f * size.y / size.x;
+    return mat4::Frustum(-2, 2, -h / 2, h / 2, 5, 10);
+}
+
+void RenderingEngine::Initialize(const vector<ISurface*>& surfaces)
+{
+    vector<ISurface*>::const_iterator surface;
+    for (surface = surfaces.begin(); surface != surfaces.end(); ++surface) {
+        Drawable drawable;
+        (*surface)->GenerateVertices(drawable.Vertices, VertexFlagsNormals);
+        drawable.Indices.resize((*surface)->GetTriangleIndexCount());
+        (*surface)->GenerateTriangleIndices(drawable.Indices);
+
+        // Batches skip the viewport clip, so they need the surface's extent.
+        int vertexCount = (int) drawable.Vertices.size() / 6;
+        drawable.Radius = 0;
+        for (int i = 0; i < vertexCount; ++i) {
+            const float* p = &drawable.Vertices[i * 6];
+            drawable.Radius = std::max(drawable.Radius,
+                                       std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]));
+        }
+
+        int capacity = GetBatchCapacity(vertexCount, MaxBatchInstances);
+        BuildBatchIndices(&drawable.Indices[0], (int) drawable.Indices.size(), vertexCount,
+                          capacity, drawable.BatchIndices);
+        m_capacities.push_back(capacity);
+        m_drawables.push_back(drawable);
+    }
+
+    m_translation = mat4::Translate(0, 0, -SurfaceDistance);
+}
+
+void RenderingEngine::Render(const vector<Visual>& visuals) const
+{
+    PROFILE_ZONE("Software::RenderingEngine::Render");
+    const float clearColor[] = { 0.5f, 0.5f, 0.5f, 1 };
+    m_rasterizer->Clear(clearColor);
+
+    // Visuals cycle through the surfaces, and those whose surface stays
+    // inside their viewport can share a draw with others on that surface.
+    m_batcher.Clear();
+    for (size_t i = 0; i < visuals.size(); ++i) {
+        int surface = i % m_drawables.size();
+        mat4 projection = GetProjection(visuals[i].ViewportSize);
+        bool shareable = m_batched && IsInsideViewport(projection.Pointer(), SurfaceDistance,
+                                                       m_drawables[surface].Radius);
+        m_batcher.Add(surface, 0, shareable);
+    }
+    m_batcher.Build(m_capacities);
+
+    SoftwareState state;
+    state.DepthTest = true;
+    state.VaryingCount = 4;
+
+    for (int i = 0; i < m_batcher.GetBatchCount(); ++i) {
+        const DrawBatch& batch = m_batcher.GetBatch(i);
+        const Drawable& drawable = m_drawables[batch.Mesh];
+        int vertexCount = (int) drawable.Vertices.size() / 6;
+        m_vertices.resize(vertexCount * batch.Count);
+
+        if (batch.Count == 1) {
+
+            // Set the viewport transform.
+            const Visual& visual = visuals[m_batcher.GetDraw(batch.First)];
+            ivec2 size = visual.ViewportSize;
+            ivec2 lowerLeft = visual.LowerLeft;
+            state.Viewport[0] = lowerLeft.x;
+            state.Viewport[1] = lowerLeft.y;
+            state.Viewport[2] = size.x;
+            state.Viewport[3] = size.y;
+
+            LightVertices(drawable, visual, 0, &m_vertices[0]);
+            m_rasterizer->Draw(state, &m_vertices[0], vertexCount, &drawable.Indices[0],
+                               (int) drawable.Indices.size(), SoftwarePrimitiveTriangles);
+            continue;
+        }
+
+        // Take each copy to clip space for the whole screen.
+        int screenWidth = m_rasterizer->GetSurface().Color.Width;
+        int screenHeight = m_rasterizer->GetSurface().Color.Height;
+        state.Viewport[0] = 0;
+        state.Viewport[1] = 0;
+        state.Viewport[2] = screenWidth;
+        state.Viewport[3] = screenHeight;
+
+        SoftwareVertex* destination = &m_vertices[0];
+        for (int j = 0; j < batch.Count; ++j) {
+            const Visual& visual = visuals[m_batcher.GetDraw(batch.First + j)];
+            ivec2 size = visual.ViewportSize;
+            int viewport[] = { visual.LowerLeft.x, visual.LowerLeft.y, size.x, size.y };
+            float screen[16];
+            GetViewportTransform(viewport, screenWidth, screenHeight, screen);
+            destination = LightVertices(drawable, visual, screen, destination);
+        }
+        m_rasterizer->Draw(state, &m_vertices[0], vertexCount * batch.Count,
+                           &drawable.BatchIndices[0], (int) drawable.Indices.size() * batch.Count,
+                           SoftwarePrimitiveTriangles);
+    }
+    m_rasterizer->Flush();
+}
+
+// Lights each vertex, like glDrawElements with GL_LIGHTING would, and
+// returns the end of the ones it wrote.  The viewport transform, if any,
+// goes after the projection.
+SoftwareVertex* RenderingEngine::LightVertices(const Drawable& drawable, const Visual& visual,
+                                               const float* viewportTransform,
+                                               SoftwareVertex* destination) const
+{
+    // GL's defaults for the scene's ambient light and the material's
+    // ambient color, plus the light and specular color that SolidES1 sets.
+    const vec3 ambient = vec3(0.2f, 0.2f, 0.2f) * 0.2f;
+    const vec3 specular(0.5f, 0.5f, 0.5f);
+    const float shininess = 50;
+    const vec3 light = vec3(0.25f, 0.25f, 1).Normalized();
+    const vec3 halfVector = (light + vec3(0, 0, 1)).Normalized();
+
+    // Set the model-view and projection transforms.
+    mat4 rotation = visual.Orientation.ToMatrix();
+    mat4 modelview = rotation * m_translation;
+    mat4 transform = modelview * GetProjection(visual.ViewportSize);
+    float batchTransform[16];
+    const float* t = transform.Pointer();
+    if (viewportTransform) {
+        MultiplyBatchMatrices(transform.Pointer(), viewportTransform, batchTransform);
+        t = batchTransform;
+    }
+    vec3 diffuse = visual.Color * 0.75f;
+
+    int vertexCount = (int) drawable.Vertices.size() / 6;
+    for (int i = 0; i < vertexCount; ++i) {
+        const float* source = &drawable.Vertices[i * 6];
+        const float* n = source + 3;
+
+        // Vectors go on the left, as with the matrices.  The
+        // model-view is a rotation, so normals can use it as is.
+        SoftwareVertex& vertex = *destination++;
+        const float* m = t;
+        for (int c = 0; c < 4; ++c)
+            vertex.Position[c] = source[0] * m[c] + source[1] * m[4 + c] +
+                                 source[2] * m[8 + c] + m[12 + c];
+        m = modelview.Pointer();
+        vec3 normal(n[0] * m[0] + n[1] * m[4] + n[2] * m[8],
+                    n[0] * m[1] + n[1] * m[5] + n[2] * m[9],
+                    n[0] * m[2] + n[1] * m[6] + n[2] * m[10]);
+
+        float df = std::max(0.0f, normal.Dot(light));
+        float sf = df > 0 ? std::pow(std::max(0.0f, normal.Dot(halfVector)), shininess) : 0;
+        vec3 color = ambient + diffuse * df + specular * sf;
+        vertex.Varyings[0] = std::min(color.x, 1.0f);
+        vertex.Varyings[1] = std::min(color.y, 1.0f);
+        vertex.Varyings[2] = std::min(color.z, 1.0f);
+        vertex.Varyings[3] = 1;
+    }
+    return destination;
+}
+
+}
@@ -1,5 +1,6 @@
 #include "Interfaces.hpp"
 #include "SpringNode.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 using namespace std;
 
@@ -40,6 +41,7 @@ void ApplicationEngine::SetGravityDirection(vec2 direction)
 
 void ApplicationEngine::Render() const
 {
+    PROFILE_ZONE("ApplicationEngine::Render");
     m_renderingEngine->Render(m_positions);
 }
 
@@ -84,6 +86,7 @@ ApplicationEngine::ApplicationEngine(IRenderingEngine* renderingEngine) :
 
 void ApplicationEngine::UpdateAnimation(float dt)
 {
+    PROFILE_ZONE("ApplicationEngine::UpdateAnimation");
     const float GravityStrength = 0.01f;
     const int SimulationIterations = 10;
     
@@ -1,33 +1,3 @@
-struct PVRTextureHeader {
-    unsigned int HeaderSize;
-    unsigned int Height;
-    unsigned int Width;
-    unsigned int MipMapCount;
-    unsigned int Flags;
-    unsigned int TextureDataSize;
-    unsigned int BitCount;
-    unsigned int RBitMask;
-    unsigned int GBitMask;
-    unsigned int BBitMask;
-    unsigned int AlphaBitMask;
-    unsigned int PVR;
-    unsigned int NumSurfs;
-};
-
-enum PVRPixelType {
-    OGL_RGBA_4444 = 0x10,
-    OGL_RGBA_5551,
-    OGL_RGBA_8888,
-    OGL_RGB_565,
-    OGL_RGB_555,
-    OGL_RGB_888,
-    OGL_I_8,
-    OGL_AI_88,
-    OGL_PVRTC2,
-    OGL_PVRTC4,
-    PVRTEX_PIXELTYPE = 0xff,
-};
-
 struct Framebuffers {
     GLuint Screen;
 };
@@ -41,52 +11,49 @@ struct Textures {
     GLuint Star;
 };
 
-GLuint CreateTexture(const unsigned long* data)
+GLuint CreateTexture(const PvrTexture& texture)
 {
-    PVRTextureHeader* header = (PVRTextureHeader*) data;
-    GLsizei w = header->Width;
-    GLsizei h = header->Height;
-    const unsigned long* texels = data + header->HeaderSize / 4;
-    
     GLuint name;
     glGenTextures(1, &name);
     glBindTexture(GL_TEXTURE_2D, name);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    bool mipmapped = texture.GetLevelCount() > 1;
+    GLenum minFilter = mipmapped ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    
-    switch (header->Flags & PVRTEX_PIXELTYPE) {
-        case OGL_I_8: {
-            GLenum format = GL_ALPHA;
-            GLenum type = GL_UNSIGNED_BYTE;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_AI_88: {
-            GLenum format = GL_LUMINANCE_ALPHA;
-            GLenum type = GL_UNSIGNED_BYTE;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_RGB_565: {
-            GLenum format = GL_RGB;
-            GLenum type = GL_UNSIGNED_SHORT_5_6_5;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_RGBA_8888: {
-            GLenum format = GL_RGBA;
-            GLenum type = GL_UNSIGNED_BYTE;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        default: {
-            w = h = 512;
-            GLsizei size = max(32, w * h / 2);
-            GLenum format = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG;
-            glCompressedTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, size, data);
-            break;
-        }
-    }
-    
+    UploadPvrTexture(texture);
     return name;
-}
\ No newline at end of file
+}
+
+GLuint CreateTexture(const void* data, size_t size)
+{
+    PvrTexture texture;
+    ParseTextureAsset(data, size, texture);
+    assert(texture.IsValid() && "Bad PVR texture.");
+    return CreateTexture(texture);
+}
+
+// The background is raw PVRTC with no header.
+GLuint CreateRawPvrtcTexture(const void* data, size_t size, int width, int height)
+{
+    PvrTexture texture;
+    texture.ParseHeaderless(data, size, PvrPixelTypePvrtc4, width, height);
+    assert(texture.IsValid() && "Bad PVRTC texture.");
+    return CreateTexture(texture);
+}
+
+// The pack stays mapped, but once GL has a copy of each texture its pages
+// can go.
+void LoadTextures(AssetPack& assets, Textures& textures)
+{
+    string packPath = GetResourcePath("Textures.pack");
+    if (assets.Open(packPath.c_str()) != AssetPackErrorNone)
+        cout << packPath << ": " << AssetPack::GetErrorString(assets.GetError()) << ".\n";
+
+    AssetEntry star = assets.Find("Star");
+    textures.Star = CreateTexture(star.Data, star.Size);
+    assets.Release(star);
+
+    AssetEntry background = assets.Find("Background");
+    textures.Background = CreateRawPvrtcTexture(background.Data, background.Size, 512, 512);
+    assets.Release(background);
+}
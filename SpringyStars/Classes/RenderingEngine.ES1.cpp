@@ -2,8 +2,12 @@
 #include <OpenGLES/ES1/glext.h>
 #include "Interfaces.hpp"
 #include "Matrix.hpp"
-#include "../Textures/Star.h"
-#include "../Textures/Background.h"
+#include "../../Common/Classes/AssetPack.hpp"
+#include "../../Common/Classes/PvrUpload.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include <iostream>
+
+std::string GetResourcePath(const std::string& file);
 
 using namespace std;
 
@@ -20,6 +24,7 @@ private:
     Textures m_textures;
     Renderbuffers m_renderbuffers;
     Framebuffers m_framebuffers;
+    AssetPack m_assets;
 };
 
 IRenderingEngine* CreateRenderingEngine()
@@ -36,8 +41,7 @@ RenderingEngine::RenderingEngine()
 void RenderingEngine::Initialize()
 {
     // Load up some textures:
-    m_textures.Star = CreateTexture(Star);
-    m_textures.Background = CreateTexture(_Background_pvrtc);
+    LoadTextures(m_assets, m_textures);
     
     // Extract width and height from the color buffer:
     ivec2 screenSize;
@@ -79,6 +83,7 @@ void RenderingEngine::Initialize()
 
 void RenderingEngine::Render(const PositionList& positions) const
 {
+    PROFILE_ZONE("ES1::RenderingEngine::Render");
     int backgroundRectangle[] = { 0, 0, 480, 320 };
     glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_CROP_RECT_OES, backgroundRectangle);
     glBindTexture(GL_TEXTURE_2D, m_textures.Background);
@@ -2,14 +2,17 @@
 #include <OpenGLES/ES2/glext.h>
 #include "Interfaces.hpp"
 #include "Matrix.hpp"
-#include "../Textures/Star.h"
-#include "../Textures/Background.h"
+#include "../../Common/Classes/AssetPack.hpp"
+#include "../../Common/Classes/PvrUpload.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <iostream>
 
 #define STRINGIFY(A)  #A
 #include "../Shaders/SimpleTexturing.es2.vert"
 #include "../Shaders/SimpleTexturing.es2.frag"
 
+std::string GetResourcePath(const std::string& file);
+
 using namespace std;
 
 namespace ES2 {
@@ -43,6 +46,7 @@ private:
     AttributeHandles m_attributes;
     UniformHandles m_uniforms;
     ivec2 m_screenSize;
+    AssetPack m_assets;
 };
 
 IRenderingEngine* CreateRenderingEngine()
@@ -70,8 +74,7 @@ void PrettyPrintExtensions()
 void RenderingEngine::Initialize()
 {
     // Load up some textures:
-    m_textures.Star = CreateTexture(Star);
-    m_textures.Background = CreateTexture(_Background_pvrtc);
+    LoadTextures(m_assets, m_textures);
     
     // Extract width and height from the color buffer.
     glGetRenderbufferParameteriv(GL_RENDERBUFFER,
@@ -120,6 +123,7 @@ void RenderingEngine::Initialize()
 
 void RenderingEngine::Render(const PositionList& positions) const
 {
+    PROFILE_ZONE("ES2::RenderingEngine::Render");
     RenderBackground();
     
     glBindTexture(GL_TEXTURE_2D, m_textures.Star);
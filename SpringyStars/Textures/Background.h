@@ -1,532 +0,0 @@
-// This file was created by Filewrap 1.1
-// Little endian mode
-// DO NOT EDIT
-
-// using 32 bit to guarantee alignment.
-#ifndef A32BIT
- #define A32BIT static const unsigned int
-#endif
-
-// ******** Start: Background.pvrtc ********
-
-// File data
-A32BIT _Background_pvrtc[] = {
-0xbdb8e580,0x8047848a,0x2e7d7cbd,0x848890ca,0xea909696,0x80688cca,0xf9feffff,0x888a8cac,0xb8a92d2e,0x806894ec,0xf469a9f8,0x846a88ac,0x156ae9e9,0x8cad9d2e,0xfffe6f0a,0x806890ec,0xffffab0a,0x8468848a,0x9bebffff,0x8068888a,0x56ebea40,0x806990ec,0x4f9fab16,0x80458488,0x50be6f5f,0x88aa990c,0x7f565050,0x8889a570,0xae8f8e4f,0x80468066,0xf4f9f9ea,0x80468488,0xf9f8f8f8,0x846984b0,0x1b82e0f8,0x804890ea,0x4f13ffff,0x848a8468,0xf9ffafbf,0x84888ccc,0x96e5f47d,0x8067952c,0xf8aa6955,0x80488cec,0x2f1b91f4,0x8489950c,0x6a65f9bd,0x84898ccc,0x6a96faff,0x80478488,0x5f06eaff,0x848a848a,0x94eacbea,0x80678888,0xa9bebfff,0x80698888,0x90f9bf6f,0x80688ccc,0xf92d0600,0x848a950e,0xbf46a5a5,0x8069848a,0x1165e9fe,0x848a992e,
-0xf9fa5b1a,0x88ab8cee,0xfeae1aa9,0x806988a8,0x6baba550,0x8069950e,0xfffef9fe,0x848988aa,0xaaaae5e5,0x804684aa,0xf53dfbb,0x84888066,0x6a6affab,0x80678888,0xa495a9aa,0x80678468,0x95eaaa95,0x80698ccc,0xfeff6f56,0x84898caa,0x7fbfbaaa,0x84698cec,0xaf6f6e2e,0x806890cc,0xe6e6e6e5,0x804784a8,0x96d6d6d6,0x80468488,0x8b8bafaf,0x806784aa,0x9f97878b,0x808988ca,0xaaaabfcf,0x84678488,0xfaaaaaff,0x84688488,0xe5e6e6ab,0x80678888,0xffaafaff,0x84688488,0x41e091fe,0x848a88ca,0xe96faf5b,0x806888ac,0x55bfffff,0x84898ccc,0xab5a5640,0x848a8cec,0xffffffea,0x848888aa,0xfaeaffff,0x84688488,0x4f4f4f8f,0x80488ccc,0x7f3f2f9f,0x806790ca,0xf9bfbfff,0x8489848a,0x9afea9e9,0x808a88ca,0xdad5f5bf,0x80478488,0xbafffaea,0x84aa84ca,
-0xb91a81d0,0x8069992e,0x51f95594,0x848a910e,0x557dafaf,0x848a88cc,0xffffa506,0x8489950c,0xf4eafa7d,0x84688caa,0xfff9fea4,0x848890ec,0xeabf0b90,0x806894ec,0xfaaa4695,0x80468066,0x55a145f9,0x8ced992e,0xbf5b5555,0x808a88aa,0xe9ba1f5b,0x806990ec,0x2a418155,0x88aa8ccc,0x1b41f9ff,0x88689d2e,0xaf5eeaba,0x80468488,0xe0bf6f1b,0x8068990c,0xfebe1b41,0x8467992e,0xfabe00e4,0x8068a14e,0xf915a9aa,0x804784aa,0x2f41a9ef,0x8488992c,0x9af4faff,0x848988a8,0xa4a5a4e4,0x8487a192,0xaaa5a4a4,0x88a9be78,0xd5eabfaf,0x806888a8,0xe5faea8a,0x8cca90ec,0xf07ebfff,0x8488992c,0xff7f1f42,0x84898cca,0x5710febf,0x806788aa,0xaab46e5f,0x848990ea,0xb5a9aaa,0x848888aa,0xdbdaaf6f,0x80688488,0xfdfefeea,0x88a98cca,0xaffffaf9,0x8cca950c,
-0x7a1a495,0x848994ec,0x69e4bf2f,0x80468cca,0x5ae5feff,0x808988aa,0x7d0a81a4,0x806888ca,0x6f011555,0x808a88cc,0x42d0f8be,0x8046952c,0x54080f9,0x80678cca,0x7f4f7a56,0x88cb88aa,0xf9ab5b06,0x806880aa,0xe4a9aae5,0x80888d0c,0xafbee9b9,0x88cb910e,0x42eafebf,0x808984ca,0xffaa0f82,0x80678cca,0x6450f4f9,0x88aa90ec,0x4f919466,0x8488952c,0x5090ffbf,0x80478ccc,0xe4be790b,0x80678cca,0xeafa5590,0x80678cca,0x82d1f4f8,0x8067950c,0xf0f0a46,0x84898cca,0xefff8742,0x88a98cca,0x5a5befff,0x84aa8cca,0xc3835f5f,0x84a98cca,0x65657f7f,0x88aa8cca,0x7fbb1616,0x90ec992e,0x9bbf7f7f,0x84898ccc,0xf8a40040,0x88cb990e,0xf2fc7dbc,0x84898cca,0xd2c2c697,0x888a8cca,0xe9e9e9d5,0x8489952c,0x9383a2b2,0x88a9950c,0xa3636363,0x84a990ea,
-0xf4e5e191,0x8069990c,0xe5e0e0f4,0x80688cca,0xab6b1606,0x8069910e,0x6ffbfaab,0x88ab88cc,0xe6a6e6e5,0x806884ca,0x5691d1e6,0x84aa8cec,0x6f6f2f2f,0x806888aa,0xb9ffbfbf,0x8068888a,0xfaa55000,0x848a9530,0xe4faffff,0x84ab88cc,0xbffea900,0x88cc8d54,0xffffab6b,0x84ab90c8,0xe5e5f4f4,0x80698ccc,0xe5dffef9,0x84898488,0x17bbffff,0x808a84ca,0x4e895e6f,0x808984aa,0xbbdf8f6b,0x88cc84aa,0xf4f8f8d6,0x84aa950c,0xe0e0e0e4,0x80688cca,0x2f6fafeb,0x808a88ec,0x5b979290,0x88cb952e,0xb96f6f6f,0x80688d0c,0xffffaa16,0x84ab952e,0x91e0b8fe,0x88cb952e,0x706ffbf,0x80458cca,0xa4b8aaab,0x806788aa,0xf859afee,0x80678488,0x1d6cfdba,0x84ab8ccc,0x87d6e5e4,0x80688caa,0xfae61f4b,0x808988aa,0x1f6faa6a,0x806888aa,0xeae86d6f,0x806884aa,
-0x66baaa4,0x84cb9530,0xffff5a51,0x84ab88aa,0xb9be6b46,0x84ab9950,0x86d0e5f9,0x808a84ac,0x5029ffff,0x80898caa,0xdbeaeae5,0x84468cec,0xf4bcff4b,0x848a88ca,0xf9bd7e2,0x84a990ec,0xf9f9aa96,0x84aa9132,0x6f1f5a96,0x84ab952e,0xffffaaa5,0x84aa80ee,0x40faffff,0x88ec9550,0x5679ffff,0x80ab80cc,0x7f5f5b57,0x808a88ec,0xfe6f1b00,0x80aa914e,0x4550d6e9,0x80ab8cec,0xfffe4502,0x804694c8,0xe4fefffe,0x8087954c,0xefbf2e1f,0x80458cca,0xbfffeaff,0x80448086,0xf4fa6b40,0x80698ccc,0x17a6bae5,0x8cee910c,0xffff8046,0x808a90ec,0x54fefefe,0x8ced952e,0x82d0f47c,0x8089952e,0xfa2f1f07,0x804598ea,0xbf8b4746,0x808b88ac,0x80e0f8fd,0x8489910e,0xebc2d1ff,0x80a888ea,0xb9bfbeaa,0x8ced912e,0xbf7f1f07,0x84a9952c,0x4646eefb,0x84ab88cc,
-0x16faeffa,0x8ced952e,0xfe6f1b50,0x84aa912e,0xf97f1f4b,0x88cb952e,0x165590e0,0x84cb910c,0xa5bfaaf9,0x84ab910c,0xfe6f0740,0x8468992e,0xaa96febf,0x848b88cc,0xb50686a,0x88c99d4e,0x16a5e9f9,0x8d0d9d70,0xf9be2f0b,0x84aa910c,0xb9bfefeb,0x84aa88ca,0x5ba95050,0x910ea5b2,0xfe7f5b91,0x808884aa,0xf9fe0090,0x90cc950c,0xe748fa7f,0x806784aa,0xada6e4ff,0x84aa8ccc,0x16aaf9fe,0x84a9910e,0xffff5001,0x80688cec,0x90eaff7f,0x802588ec,0x66a59540,0x8cec950c,0xefef96e0,0x80678ca8,0xf9ae2e1e,0x806688ca,0xbf6f6a55,0x804588ca,0xbf6a54a8,0x8067910c,0xff7f0790,0x84aa990e,0x41894296,0x88ca88ca,0x794feff,0x88aa950c,0xaaefe6f,0x8046950c,0xb9b45040,0x8cca94ea,0xb5a5a56a,0x8cca8cea,0x9565a555,0x8487950c,0x551aa6f5,0x80679d2e,
-0xf96f6f1b,0x80698cec,0x155f9f9,0x912ea9b2,0xafa95440,0x8089910e,0xd0eaffaf,0x8089910e,0xffbf0200,0x84aa952e,0x450abfaf,0x80688088,0x6f550040,0x88eca9d2,0x590095ff,0x804784aa,0xbafeb9a9,0x910e952e,0xff5b565a,0x808a88ca,0xffbf5a45,0x910e994e,0xaae9fffe,0x88cb88cc,0x90f9,0x88cb9d70,0xa5f4fe6f,0x84aa910c,0xe9ffff,0x8089952e,0xa5faff00,0x84aa910e,0xf9ffbf5a,0x8489950c,0xee7f0b80,0x848890ec,0xffab41e9,0x808a84aa,0xb90e4ea,0x8489952e,0x600f9aa,0x806688a8,0x54a0feff,0x80468cea,0x90a4eaff,0x80888cea,0xe9f90681,0x84888cca,0x656fe6b,0x808988cc,0xb8ffbfaf,0x88cb952e,0xf9ff6aaa,0x84a9912e,0xfffeaa00,0x88ca910c,0xaaf92f41,0x8089910c,0x1f41f4bf,0x8467950c,0xbf0b90fe,0x8489912c,0xe0bfaaaa,0x808784ea,
-0xbebebeab,0x8ccba9d2,0xbebebcbd,0x84aaa16e,0xc18181c1,0x8ccb990c,0xe1e08181,0x992da170,0x6abdbebf,0x8ccaa5b0,0xa4a56a6a,0x90ebb1f4,0xf5e0e0e1,0x90eb990c,0x5aaffefa,0x8cca950c,0x4b8b86c7,0x806888aa,0xef9f8647,0x80678cca,0x6fafafaf,0x88a9910c,0xf0bafaf,0x84888cca,0xd7969bdf,0x80678cca,0xfafafae7,0x8cca950c,0x1b1f1f1f,0x90eb992c,0xb6fbab6b,0x992d9d4e,0xb9f9e4a4,0x90ca9d70,0x90555569,0x8088a14e,0xd59a5a0a,0x8cca992c,0x6f6ef9e0,0x88888cca,0xa9f9f4e4,0x8888994e,0xf9a45555,0x8466950c,0xaaaaef5f,0x90eb94ea,0xaffae96a,0x848890ca,0x6f6faeb9,0x8cca992c,0xf9f9f9af,0x90eb950c,0xf9f4f091,0x992d9d2e,0x6aaabfbe,0x90eb950c,0x55a9fffe,0x90eb990c,0x2ffff55,0x8888950c,0x95ffeaea,0x90eb950c,0xffffe9,0x88a99d4e,
-0xeaaa5a5a,0x8ccb910c,0xf4f0fffe,0x950c992c,0xbfbea97a,0x8ceb950c,0xabffafaf,0x950c992c,0x7ef5f4f4,0x992d9d4e,0x7f4f7e7e,0x9d4e9d4e,0xd0414646,0x90eb9d4e,0xe5e9e9e5,0x8488992e,0xb5e1e1e9,0x84898cea,0x6f7fbeb9,0x8cca992c,0x79b97aa3,0x8ceb9d4e,0xb9b92828,0x90ea994e,0x5b1f1f1f,0x8cca990c,0x834397af,0x88a990ea,0x6d95a4a4,0x8ceb992c,0xbebefefe,0x88a9950c,0xbf7f3f3f,0x992d992e,0xaebf7fbf,0x950c9d4e,0xbaf9f5e5,0x8cca992c,0x7e7e7aba,0x8cca950c,0xb9bebfff,0x90eb94ec,0xbf7f7a,0x8cca950c,0xbebe7f7f,0x88a9950c,0xc0d0d0e4,0x8488950c,0xa0a191d2,0x9d4da590,0xe4e4e8b0,0x992da16e,0x5d1e2b3f,0x992d9d4e,0xda8acaae,0x848890ec,0x50480d4,0x992ea16e,0x17671302,0x994da990,0xabb7e9da,0x84888cca,0x981c5d6e,0x804688c8,
-0xf4a46aff,0x8ccba16e,0xa4f8f8f8,0x90ca9d72,0xfffa4546,0x90ca950c,0xfefaab6b,0x88a994ea,0xb9b4e0e4,0x8066950a,0xa4a4a5a5,0x8887994e,0x90f4ffbf,0x802588a8,0xfafe5555,0x90eb9d2c,0xe6be6a40,0x8cca990c,0x96fffff9,0x8044910a,0xbfed505,0x8cc9950c,0x3a2f0f06,0x8045950a,0xfafaaa06,0x90caa14c,0x565af9f9,0x90eb950c,0x4f7f0a19,0x90eb90ea,0xfef91a1b,0x8cc9950c,0xa4f8f9f9,0x88a9910c,0xa4a9a9a5,0x8865a616,0x5aef4656,0x8cca90ea,0xfafaea6a,0x90ca952c,0xa4f8a4a4,0x88a89d6e,0xe5f4b855,0x8487910a,0xffaf7aba,0x8cc9910a,0xff0740f9,0x8487950a,0xbaeb9141,0x90eb992c,0xe1920b1f,0x8087950c,0xb4db3fbf,0x8cea9d4c,0xff160a5e,0x80668cca,0xfb6e64e0,0x8cc990ea,0xff5005fe,0x8487992c,0x56e4f9ff,0x8045994c,0xafba9001,0x8066992c,
-0x6091bfbd,0x952ba16e,0x75b4e0e0,0x9d4da16e,0xeafb45d5,0x8cc990ea,0xbeffafbf,0x90ea950a,0x6e7f7979,0x992ca16e,0x7bffebe,0x88c8950a,0x90e0e4bd,0x950b952c,0x55ffea,0x88a8a16e,0xbe2f1f0b,0x80449d6e,0x46eae9aa,0x84888cc8,0xb4b86d59,0x88a9950a,0x590f0b11,0x80658cc8,0x6fafaa5a,0x88a890ea,0x1abff,0x8487992c,0xf0ffff89,0x84878cea,0x55ffff,0x8cc9992c,0xaafff940,0x84879d6e,0xfaa01505,0x88a890ea,0xabbffffe,0x806690ea,0xfffea959,0x8487950a,0x801bbfff,0x84a8add0,0xfa4afef8,0x846684a8,0xfff94107,0x84879d4e,0x6ffebaab,0x8487910a,0xa5d0febf,0x8487992c,0x1afeaaa,0x8487952c,0xe6fb6b01,0x8066992c,0xa5af05,0x8487994c,0x5546fee0,0x88a8950a,0xa5bfaa06,0x8cc9994c,0x1595eabf,0x84a89d4c,0xbe0a1955,0x8086910a,
-0xc58685fa,0x84a98cca,0x8b8fd9d9,0x84a98cea,0x707077e,0x848888ca,0x5b5b070b,0x84a98cea,0xe0c7c7cb,0x8cca952c,0xf9f9fae6,0x8488952c,0xb0b0b4b,0x80878cca,0xbba6574b,0x8cca910c,0xa46050b4,0x88ca90ea,0xbeb9e5e5,0x808890ea,0xfed55551,0x80678cca,0xe4e4a7ff,0x88a9952c,0x6e6e6e6e,0x88a9952c,0xeaf9f9b9,0x88ca9d4e,0x65f9f8f8,0x9d6fba14,0xaff1d040,0x88ca9d6e,0xbffef8f8,0x88a9990c,0x71b5f6f,0x848890ea,0xfaeaa696,0x90eb950c,0xa0a4a5f9,0x90eb950c,0xe5e54206,0x90ea950c,0xfab4f4f4,0x848890ca,0xfffa65a5,0x8cca950c,0xf0f0f6ff,0x88a88cca,0xfffffffe,0x90eb910c,0x96ffffff,0x950c990c,0x36afbab,0x90ea8cca,0xf9ff93cf,0x950c992c,0xfffaeaaa,0x88a890ea,0x2f6f7fbf,0x8488950a,0xf5f2fffe,0x88a9950c,0xf4f8f8f8,0x8067a590,
-0xbfffa95,0x84888cca,0xbfff7f5a,0x90eb950c,0x14fffffe,0x88a9a14e,0xf5e64655,0x88ca952c,0xf9864b1f,0x84a98cea,0xa1b6faf,0x80678cea,0x6fff6ff9,0x88a988ca,0xf0f4f9bf,0x88ca90ea,0xf4feeffb,0x8488950c,0x962faff9,0x80678cca,0xffff7f42,0x8488a56e,0xaadafafe,0x88a984a8,0xafaf1a41,0x84a988ca,0xeb86465a,0x806788a8,0xfaaaaaaa,0x88a988ca,0x1f7ffefa,0x84a99d4e,0xfffd5b06,0x8cc990ea,0x6abffeff,0x90eb950a,0xfafaf090,0x90ea950c,0x414196fa,0x84888cca,0xbeffffbf,0x90ea950c,0x5bbfaeaa,0x8cca90ea,0xba6a5641,0x8cca950a,0xbebfbfbe,0x90ea950c,0x6fafeae5,0x8487992c,0xe5f5f2f,0x8488a58e,0xf4f5651b,0xa16eadd0,0xf0f4f4f4,0x9d4ea9b0,0x6e1e4f4f,0x8487950c,0x4686d5e9,0x84888cca,0x2929e0e0,0xa58fb1f2,0x3f1b2b29,0x8ceaa16e,
-0xf9f9f9f9,0x88a8950c,0xf9f9a9a5,0x88a8994c,0xe0e0e0f0,0x8067992c,0xe2e1e1e0,0x84a89d4c,0xd1d2d2eb,0x8cc9950a,0x40f9ffe6,0x84a8992c,0x9b9b87d3,0x88a88cea,0xfe1b075b,0x804588a8,0x7f7f7f2f,0x8488952c,0xcbdbebeb,0x804588c8,0x5490e0f4,0x8cea9d4e,0x53a2b4b4,0x910ba16e,0x96afafcb,0x88a890ea,0x1b105455,0x84878cca,0x7a2f0f17,0x8087994c,0x40c9f5,0x80668cc8,0x7f1b0000,0x8cc9a58e,0xa99beafe,0x80668cca,0x15590e4,0x994dadd0,0xf97f0f06,0x8487992c,0x1e8bd2f0,0x88c8994c,0xfaf8b839,0x88a8952c,0x4e47ebff,0x806684a8,0xb5b9795c,0x84a88cc8,0xd0f9ffbf,0x88a8994c,0x66b46840,0xa5afb5f2,0x6f070201,0x80668cca,0x80eafdff,0x88a8950a,0x7f2f1f17,0x84a8994c,0xd6e5f9b9,0x806688ca,0x64b46040,0xa18fa9d0,0x3031210,0x8cea9d6e,
-0x5f0f0f0b,0x804688a8,0xead5f9fe,0x84a88cea,0x3e7db9b9,0x8cca950c,0x9f87ab39,0x80668ce8,0xa4f8a054,0x9d4da9d0,0x2a064391,0x88a8992c,0x696e5bd,0x8cc9952c,0xb8f9a956,0x952ca16e,0xf8781906,0x88a9950c,0x1b82d0f4,0x84a79d6e,0xaec2e1b9,0x8cc9950a,0xbe6f5b9b,0x848790ea,0xfe6fab79,0x8087910a,0x2e2aa5e4,0x90ea952c,0xaafefaa4,0x950b9d2c,0xf9bf6f6b,0x84a8992c,0x55e9f4b8,0x88a8950c,0x6f5b4702,0x80668cc8,0x1e0fd2e0,0x90ea992c,0x95d5b538,0x84878cea,0x80c0e9fe,0x808690ea,0x79650045,0x952c994c,0x1f1f5b95,0x84a88cc8,0xe4a96f1f,0x806688c8,0xb4bfffbf,0x950b9d4c,0x1f5791b4,0x8ceaa98e,0x290682d1,0x88a8952c,0x91bdfaeb,0x950b9d6c,0x5540feff,0x806588ca,0xa6b9b9a4,0x8cea994c,0x3e5f4390,0x8ceaa990,0xfe9596be,0x802588c8,
-0xffffaa56,0x808988ee,0xba6fafff,0x84aa88ec,0xafab5600,0x80678cec,0xfe9aafaf,0x80688088,0x16601064,0x9570a5b2,0xfae9bf1f,0x8068912e,0x90e4e9f9,0x808a9950,0xbf0b4180,0x848a992e,0xfefea914,0x88888cec,0xeba5beba,0x808888aa,0xbffff990,0x808984ee,0x3f3f3fbf,0x8468950e,0xca4befff,0x848a88ac,0xb9efcfcf,0x84898caa,0x3f3f3f3f,0x84aa9930,0xf8ac7c7e,0x806888ea,0xfebf2faa,0x88cb9d4e,0xff5f5baa,0x808a80aa,0xea9690fe,0x804584a8,0x96e5aaea,0x8087992c,0x41a8f0f9,0x84cb8d2e,0xfabe1f07,0x808a8d0e,0xf9bf6f0b,0x806a8cee,0x25090d0,0x88cb952e,0xbfbf5656,0x80668cc8,0xefbfffff,0x80248cca,0xeadaeaf9,0x80888cca,0xf5bafae6,0x84aa84ca,0x9b9195d0,0x80678caa,0x40d0bfef,0x80888cec,0x7f6f5be1,0x84c9a170,0xff9bdab9,0x806880a8,
-0xbabf6a15,0x88cd9572,0xf9e5a5a9,0x88cd88ec,0xeafae4a0,0x80898d0e,0x87d7eaea,0x84a988cc,0x9095e9e9,0x84cd8d2c,0x50f8f894,0x912f9970,0x7f2f9f47,0x84ca910c,0x2e2f1b6f,0x88ed9970,0xabab5a05,0x806688ea,0xafafab9b,0x806680ca,0xaaaa5501,0x8088892e,0x5aaebefe,0x84a98886,0xededafaf,0x806784a8,0xa8a8adae,0x806784a8,0xaba20e0a,0x84a984a8,0x3e2f2f2f,0x84a9950c,0x2f1f0702,0x84cc912e,0x86c0f9bf,0x808884aa,0x1474b479,0x9d72a1b4,0x2f1b1624,0x88eda9f2,0xe4beafab,0x80898d0c,0xfe6f42d0,0x84aa952e,0x9beafa7e,0x8089890c,0x5afdafaf,0x84cb8cec,0xe4f5f9f9,0x808890ec,0xe0e0f0f4,0x8088912e,0xfaba7e3e,0x80888cea,0x8b9bebfa,0x808888ca,0xef9be2d0,0x84cb9d70,0xeea6faff,0x80aa88ca,0xf1f4f8b,0x84aa84ca,0xe2aaaf4b,0x80aa88ec,
-0xfe6a55a9,0x910e952e,0xfeffffff,0x88cb8cec,0xfff96a0f,0x808a8cec,0xaaff0b9b,0x84aa88cc,0x50ffab56,0x808a910c,0x5aabff40,0x84aa910e,0xa9af9590,0x808988cc,0x196e7ffe,0x88cc910c,0x2b556009,0x84aa9d70,0x56ebf97f,0x808a88ca,0x1ae5f9,0x84cb952e,0xfe6f0640,0x84aa952e,0xfaeaaf87,0x84ab8cec,0x94f4f9ff,0x8cec952e,0x5746e5fa,0x84ab8cec,0xfeffafa6,0x8cec910e,0xaf56555a,0x80878cec,0x6f0685f9,0x84a98cec,0xfefea9a9,0x8cec952e,0x1f9ffbf,0x8088910c,0x1f9ffff,0x8ceb994e,0xff95ff3f,0x808788ca,0xa5ffab5b,0x88ca910c,0xffff0600,0x84a9912c,0xffff9695,0x8ceb9950,0xfd5b1a6a,0x8088910c,0xb9ffafa,0x88cb88ca,0x5640d0d5,0x84a9910c,0xeaab6ad5,0x88ca910c,0x7f02e4f9,0x88c9910c,0x6a06beff,0x88ca910c,0xf9bfab,0x88a99d4e,
-0xd0f9afff,0x808988ca,0x82f56445,0x910d9d70,0xff565556,0x808988ca,0xaaabe9fe,0x84aa910c,0x95eabf2f,0x80888d0c,0xbf1fa95a,0x84cb88ca,0xff1b90a4,0x84aa996e,0x554040fa,0x806684ca,0x46b9bafe,0x84aa88ec,0xf1babf4f,0x808980aa,0xbebe2f9b,0x84cb914e,0xbf060095,0x808988cc,0x51adf6fa,0x910c9d70,0xe9fabf0b,0x8089912c,0x50aaffff,0x84cb952e,0x7f060000,0x84cb994e,0xf97fbbff,0x88ca8cea,0x568ab7d6,0x88ca8cec,0xc2b9aa56,0x808888ea,0x90fb781f,0x88ca910c,0x41e5ffaa,0x8089910c,0xe5ff6a05,0x8ceb950c,0xfdaa0641,0x808888ca,0x6fff5590,0x90eb992c,0xfb4e9aaa,0x808988ca,0x2f47f0fe,0x84aa952e,0x2059afe,0x808884aa,0xf4fe6f06,0x8088910c,0xafcab4fe,0x84a88cea,0x6106f5ff,0x88aa910c,0xaaff2f81,0x84a99d6e,0x95bfab,0x84898cca,
-0xaaa95440,0x80898930,0x8081daeb,0x80678488,0xbfbea940,0x80898d0e,0x2f2f2f6f,0x84aa910c,0xabeb8080,0x80888886,0xac5e5e9e,0x806780a8,0x2f2e1f2f,0x8067910c,0xe5fbfb6f,0x80888cea,0xe4954206,0x84cb9d70,0xe0e0e0e0,0x80aa910e,0xafafaaa4,0x80a99172,0x5f4b9b9f,0x808980ca,0x40e0e0,0x84eb912c,0x13b42414,0x954e9d92,0x6e0f0f1f,0x806880aa,0xc0e0f4fd,0x80cb8d0c,0xf4f4f8b8,0x80a8910c,0x1b47d7e5,0x8488952c,0x87c2d1d1,0x808684a8,0x6e5f5f9f,0x808988ca,0xf9f97e2f,0x84cb910c,0x170645a5,0x84cb912e,0xd1e0b47d,0x80a9912e,0xbd690f46,0x84cb912e,0x2f1b0303,0x84ac912e,0xe1f6ff6f,0x80a88d0c,0xf4b45080,0x912f9550,0x1b261115,0x8d2e9570,0xaf5a9040,0x80ac8d0c,0xe4fcbfff,0x8089910c,0xea6e2f0f,0x806888ea,0x969196d6,0x806784aa,
-0xfefeaa56,0x88ed8974,0xa50ebaff,0x890e890e,0xfeffaa01,0x84ed8594,0xfe6065aa,0x890e912e,0x15a8f4f0,0x80cc88ec,0xb9b2a3e,0x80aa890c,0x1555afff,0x80ab9d92,0xfe161014,0x80cb9970,0xaaffaa00,0x890d89b4,0xff9455aa,0x84ac910c,0xffffaa00,0x80cb8176,0xdaaafefe,0x84cc88ec,0x95aaf9ff,0x80899150,0xffe4e490,0x80aa8d2c,0x6fafebea,0x80aa88ec,0xffff0b7f,0x84cb88ec,0xfa9a4f0f,0x808980aa,0xe4e4e4e5,0x84cc8d2e,0x8291aafe,0x84ca84ea,0xffeb9b5b,0x80688c88,0x16b9f4f4,0x954e9d90,0xfe6f1f1b,0x80aa910c,0xa41a6fff,0x80cb892e,0x1b974f4,0x95719db2,0xfeffffff,0x84aa910c,0xabfefef9,0x84a984ca,0xffafbfff,0x808988ca,0xfaffffaf,0x84a988ca,0x94052f5f,0x80468088,0xf9bf5f5a,0x80ab8d0e,0x6f69a4fe,0x808988ca,0x86d0ae6f,0x806780a8,
-0x82e0bd6f,0x80aa910e,0x1a0695a,0x88ec912e,0xaf47d5f9,0x80aa88ec,0x5496f9fe,0x84cb912e,0xe9aabf1f,0x808988ca,0x10a4e5f9,0x952ea190,0xff5a0140,0x8089910c,0x50aaffff,0x8ceb9d70,0xbf1f57d2,0x84ca952c,0x9587eafe,0x80ab88ec,0xf4beaf5b,0x8089890c,0x555f8bd1,0x84aa8d0c,0x5b555495,0x84ab88ec,0x5996ffbf,0x80898d0c,0x1afeeaaa,0x808984aa,0xf9beff2f,0x808888ca,0x95f97f0b,0x848a910c,0xaf064155,0x84aa88ca,0xff5b0000,0x88cba170,0x41145afa,0x88cb952e,0x1f82f4ff,0x84a9912c,0xfd6a4195,0x84a990ec,0xf8bf6fbf,0x88ca952c,0xbfa96941,0x8067994e,0x667a4090,0xa191a5b0,0xf990ad6f,0x8068912c,0xa5febf,0x912da192,0xff6f0600,0x8489996e,0xa65901e9,0x88c9950c,0x6e0294bf,0x80888cea,0x11569bf,0x806790ea,0x90f92f15,0x84a98cea,
-0xa586eaf5,0x808984aa,0x7e1f4bd7,0x84a9952c,0xfaaf1f17,0x8089912c,0xb4bdffef,0x8087950c,0xfefffffa,0x8489952e,0xbf0b41e4,0x8066910c,0xffbf0bc1,0x88a9950c,0x91f9bf7f,0x8488a16e,0x166554e0,0x912ca192,0xeafa6f1b,0x80668ce8,0x94f9beaf,0x88eb954e,0x1f560050,0x8d0ea170,0xaaa46fab,0x84aa950c,0xffea9596,0x84a98cee,0x5541f9bf,0x806788ea,0x4f8faa5a,0x84aa84aa,0xe8ffebff,0x88cb8d0c,0x1b650040,0x912da9d2,0xffeabf2f,0x808988ca,0x55a4f9,0x8ceca9d2,0x4000e5bf,0x802588aa,0x7fff9440,0x88ca88ea,0xf5f96f01,0x8488952c,0xe5feaa5a,0x84a988ca,0xffbf9645,0x806880a6,0x40faffbf,0x84a9994e,0xffa59afa,0x808884a8,0xba1b46fe,0x84a9910c,0xff5a0000,0x8088a190,0x1a07e8ff,0x84888cea,0x65440e4,0x910ca190,0x90eeffbf,0x8067910c,
-0xbf06d0fe,0x8488994e,0xaaabffff,0x848984c8,0x80feffff,0x88a9a14e,0xfffeff1b,0x8488952c,0xfbaaeaea,0x88a988ca,0xe0e0e5fb,0x84a99d6e,0xdf00bfbf,0x88c988a8,0x506bfff,0x8cca950c,0xafab6bff,0x80688cea,0xff7f41e4,0x84a8a170,0xaa95f91b,0x80888cea,0x790feaf,0x8488952c,0xbf80aebf,0x84a988ca,0x7d90aabf,0x8cca952c,0xaa95eabf,0x8488910c,0xfe9aaaaa,0x88c988ca,0xdbebf9e4,0x88a9950c,0x478787db,0x848890ea,0x70b4b0b,0x8cc990ea,0x6b6f1b0b,0x88a990ea,0xd4ed9b8b,0x8cca992c,0xe0e0d0d0,0x8cc9a16e,0x1f1f0b0b,0x88a7950c,0xb0b0b0b,0x84888cc8,0x94fd7e7a,0x90ea950c,0x95407494,0x8cc990ea,0xea8ffef9,0x90ea90ea,0x7ef9ebea,0x88a8992c,0x90909094,0x8487992c,0xb9f9f9e4,0x88a89d4c,0x964b1f2f,0x8ce9a9b0,0xb8f4e0d1,0x88a8992c,
-0xa6ff1b40,0x84a8992c,0xf8fffbaa,0x84a9910c,0xff0700a9,0x88ca952c,0xbf1b9bd6,0x88a988ca,0xfafe2f41,0x88a990ea,0xd72a9bea,0x8cca88ca,0xff0694fa,0x84898cea,0x66beffff,0x8ceb90ea,0xa90a9a6,0x950ca190,0x100eaff,0x80888cca,0x40fefa55,0x952d9d70,0xa5e4ff06,0x84a9950c,0xfff9ff9f,0x88c98cea,0x4e55d6fb,0x8ceb8cca,0xfbffbf6a,0x90eb910a,0xaabffffa,0x88ca950c,0xff9646e7,0x88a890ea,0x565fff,0x8cc9a16e,0xbffff956,0x848790ea,0x9005055a,0x88ea9d4c,0xbfb9e450,0x8487a58e,0xfeefafbf,0x90ea8cea,0x40a5fffe,0x80248cea,0x7fffabaa,0x88a8a16e,0x55abfffe,0x8086910c,0xff500000,0x8466a58e,0x555affff,0x8087952c,0xff550000,0x88a7a58e,0xa5819aff,0x8cc890ea,0x905fffa6,0x88a890ea,0x1a6aafff,0x88a89d6e,0xfffa6b56,0x8cea910a,
-0x6a9be6e0,0x88a8992c,0xe9d5e6ab,0x88c990ea,0x65ba6f1f,0x950b992c,0xffffbf66,0x992c9d4c,0xfafffffe,0x950b992c,0x56a9b9f9,0x90ea952c,0x6f6b6fff,0x950b992c,0xbefbb9bf,0x910b952c,0xe5b93e79,0x90ea950a,0xefefdb9a,0x950b994c,0xfdacbcbc,0x8cc98cea,0xf0aa3fbf,0x8cea950a,0x95a925ff,0x910b950a,0xf96f1601,0x90ea992c,0xbfbf7e60,0x950b950c,0xab1e002d,0x90ea950a,0xf46d1f4b,0x808790ea,0x6a1f4bd6,0x88c9952c,0xa65f4b9,0x8cea950c,0xf8581a07,0x806688c8,0x54fdfafa,0x992ca18e,0xbf1a0640,0x88a89d4e,0x2e0b42e1,0x8cc9992c,0x51bcb9ba,0x9d6ea58e,0xa4a91bc1,0x88a8994c,0x1b605095,0x8cea950a,0xb91f9ff,0x88a8add0,0xe6f9be2f,0x88a8992c,0xf86e5f6b,0x80668cea,0x514ad5e0,0x910b9d6e,0x6156aaa,0x8ce9994c,0xbe5f1f07,0x84a8910a,
-0x472fbffe,0x84a8a16e,0xab7ef8e0,0x8cc9952c,0xfff49147,0x88a8992c,0x46e5aaef,0x88a890ea,0xbebf64a4,0x8cc9950a,0x950059f4,0x8cc9952c,0x405ae5e5,0x8466910a,0xf9fdbf0b,0x8066992c,0xff1f5ff6,0x90ea910a,0xfebf01ff,0x8cc9a58e,0xff5450ab,0x8087910a,0xbf05056f,0x9d4da9b0,0x950e5fab,0x808790ea,0xbf0f80d4,0x8045952c,0x6a0054fa,0x88a8952c,0xe0fdbfbf,0x88c9a16e,0xf9efabaa,0x88a8992a,0x1f565090,0x90e9a9b0,0xff0641e5,0x8cc99d4e,0xc0a4aeaf,0x848790ea,0xe0e0652f,0x88c9950a,0x456551c0,0x910a952c,0x6bb9a490,0x950ba18e,0x741a0f4b,0x808690ea,0x46adbfff,0x88a88cc8,0x7f5a9647,0x88a890ea,0xf9be1f06,0x88a89d4c,0x68befffa,0x90ea910a,0xe5f9febf,0x84a8950a,0x68bcaa96,0x950b9d6e,0x6f0b0695,0x84a890ea,0x80e5febe,0x88a8910a,
-0x55fffffe,0x950d994c,0xfaff0600,0x88caa170,0x9556aaff,0x8ccb950c,0xbf015094,0x8cca994e,0x7f03e9a4,0x88ca8cea,0x5a469aeb,0x84888cea,0x40febffa,0x88ca950c,0x95a5fa2f,0x88a9910c,0x1655feff,0x84a8910c,0x640a55a,0x8ceb992c,0x40faff1b,0x80888cea,0x40feff95,0x992d9d6e,0xf9bffeff,0x84a8952c,0xaafa2f40,0x88a9994e,0xffaaff06,0x8088950c,0xfe6f90fe,0x8cca9d6e,0xa955ffff,0x88c9952c,0xff550000,0x88a8a9b0,0x5655ffff,0x8088952c,0x1a554054,0x952ba56e,0x4090faff,0x8024910a,0xbf6f0141,0x952c992c,0x146ffff,0x8024910a,0xa6fe0001,0x952b994c,0x69feffab,0x88c9950c,0x959555,0x912ca16e,0x1ffffaa,0x84a88cea,0x94fffe01,0x950ca170,0x55aaff6b,0x8066912c,0x97f59041,0x950b992c,0xfafe6f00,0x88c9994c,0xaa46aaaa,0x910b952c,
-0xfe6b1b69,0x80a88cca,0x55bfaaea,0x910ca9b0,0xaf019001,0x808788ca,0x505a5ff,0x88cb9d6e,0xabff1600,0x88a9952c,0xbd0ffab,0x8488910c,0xff5a0040,0x84a8a190,0xf42fabfa,0x88a98cea,0xaa0141ea,0x808988a8,0x90ffff,0x88a99d4e,0xaafafe07,0x84a9950c,0xe4ffaf6a,0x88a990ea,0x6f400000,0x8ccaa16e,0x60046ff,0x806688a8,0x555400,0x992da9b0,0x9094febf,0x848790ea,0xe4ffbbff,0x84a8950c,0xaaffab00,0x90eb9d6e,0xff5baa1b,0x808790ea,0x5a6a05f8,0x8cea992c,0xff6f0054,0x84a89d6e,0x6a1555aa,0x8cea952c,0xaf005055,0x8cca994c,0x56fe,0x84a7910a,0xaaa55505,0x88c98cea,0x100e5bf,0x8067910c,0x1365550,0x88c988c8,0x40f4ff06,0x84a888ca,0xe5aa55,0x910b9d4c,0x5000fabf,0x84a7910a,0xa9fffe69,0x910b9d6e,0x55f9bf01,0x88c9992c,
-0xaffeea5a,0x84878cea,0x5014055,0x90eaa58e,0x551affaa,0x80878cc8,0x54f9fe,0x992ca58e,0x5564feff,0x90ea992c,0xabc74606,0x90eb992c,0xe554ffab,0x8cc9992c,0xffff7ef9,0x910b992c,0x5500fffe,0x80878cea,0xa9ffff,0x950b9d4e,0x5500ffff,0x8487910a,0x90015baa,0x8cea994c,0x7ee5fffa,0x88c9952a,0xaaabe802,0x88c8952c,0x1bffff,0x88a8994c,0xae6abff9,0x910b952c,0xd1e0f8bf,0x8cc99d4c,0xbe2e1f47,0x88a8a16e,0x7f1f56a5,0x90ea994c,0xb4f4feaf,0x8cea9d4e,0x8099f9fa,0x8cea992c,0xafaf5a90,0x8cc9952c,0x97d3d2e1,0x8487994c,0xffaf1f0b,0x8ce9952c,0x1bf8eaaa,0x950b952c,0x2f7ea565,0x992c9d6e,0xfddfffbf,0x910b910a,0xe4d0d0e5,0x88c9952c,0xaba65a2f,0x8cea950a,0x9f9feeab,0x88c990ea,0x3f7fbefd,0x88c99d6e,0x2e2e2f3f,0x88a8992c,
-0x5569ffff,0x8487952c,0xff54010a,0x88c9994c,0x195ffeb,0x88c9910a,0x6fbef800,0x88c9910a,0xfd9006ff,0x88c8994c,0xaa3e166b,0x952c994c,0x816bbdaa,0x950b952a,0xffe44005,0x88c9950a,0x9006ffaf,0x88c9992c,0xa5aaaffe,0x8cc9994c,0x6fbd6faa,0x8cea952c,0x6afefa6f,0x910b952c,0xa5465595,0x88c9910a,0x65bffff,0x88c8a16e,0xfff995aa,0x84a890ea,0x800116af,0x8cc9994c,0xbffefae5,0x88c99d6e,0x464b1f7f,0x88c9992c,0x50060b6f,0x88c99d6e,0xaf6ff9e0,0x8487952c,0xf8f4e0d1,0x8487992c,0xa0d6eb8,0x84a888c8,0x797aab9b,0x8cc9910a,0xf8a495aa,0x8cc9910a,0xbffd9401,0x88a89d6e,0xa595aaaf,0x88c9910a,0x95061ffd,0x88c8950a,0xbf7afaea,0x8cc9950c,0x6fbffaf9,0x910b952c,0x561a6eba,0x8cea910a,0x78e9ffaf,0x8d0b910a,0xfee9d0a9,0x88c98d0a,
-0xa9f4f9f8,0x8cc9912c,0x7ea9aaba,0x8488912c,0x6aafafab,0x8cc988c8,0xbb3ebf9a,0x88a88cc8,0x3d3c7879,0x88c99d4e,0x6d2c3c3c,0x8ceb994c,0x6e1f1f6b,0x848788a8,0x8f9e9e9e,0x84a888c8,0x6f1faefe,0x80879d4c,0xd58596aa,0x806688a8,0xe9c0f9ff,0x80458cca,0x1b6f3f7e,0x88a89d6e,0x7ab9f9f9,0x8487950c,0x8b1f2f3e,0x8cc9994c,0xf4d0c146,0x84889d2c,0xab6fbdfc,0x88c89d4c,0x979aad6e,0x88ca9d6c,0xe0d1d2d2,0x84879d6e,0xafdbc78f,0x84a78cea,0x5b0b2f2f,0x808788c8,0xfcf4f4f0,0x8087954e,0xbdfcbcbd,0x8cea9d70,0x966aaaaa,0x84a88cc8,0xff6f0641,0x88c9994c,0xf9f6e1d7,0x8ce9952c,0x6aa9fdb9,0x88c9950a,0xaafbb623,0x8cea952c,0xd5a56656,0x90ea912c,0x96697e7e,0x90ea910a,0xffa5e4e5,0x84a890ea,0x9fb9a9e4,0x84a890ea,0xe5baab9b,0x8cc98cea,
-0x1077fff,0x88c9a16e,0xfef4e040,0x8487a16e,0xf8900001,0x8486a56e,0xfa6aeffe,0x80458486,0x56161f6f,0x84878cea,0x41e5febf,0x8465992a,0x51f4fdff,0x8ca8adae,0xd6ef5615,0x80448cc8,0x7f5a1000,0x88a7adb0,0xdfc0ebff,0x80028044,0x1011d4f4,0x8ceba9ae,0x3f4f1711,0x8ce9add0,0xd0ffffff,0x88a790a8,0x1f0b91e0,0x848690e8,0xe6d27b3f,0x80668cc8,0x90e0efef,0x8024992c,0x5a5641aa,0x952c9d4c,0x6fbff9f9,0x8cc9992c,0xbe950042,0x8487992c,0x900147bf,0x910b992c,0xe55a5a1b,0x8cc9992c,0x6fdffef5,0x88a88cca,0xafbefdf4,0x88a8950a,0x10bebfbf,0x9d6ea58e,0x7efe950b,0x8cea994c,0xefe99015,0x8466994e,0xa4aa5651,0x8487994c,0x9b979190,0x84a9a58e,0x4afdea9f,0x950b992c,0xe9e9e59a,0x950ba58e,0xcb8b8b8b,0x8ce99d4c,0xe7d7c7c7,0x8cc9a18e,
-0xf9f5a5be,0x8cea954c,0xa4a8b9fd,0x84878d2c,0xe6d191aa,0x84a8992c,0x7f3e7eae,0x84a88cc8,0xe8e4a4a4,0x8487954c,0xa1a4e4e8,0x8087952c,0x87c70f1f,0x8cea952c,0xf5e29247,0x90eb994c,0x260b4fcf,0x88a88cea,0xbd641035,0x88c98cea,0xd8a461e2,0x84a890ea,0xead4c0cc,0x80878cea,0x75bafefd,0x8cea950a,0xffbab560,0x8ce9910c,0x3e3fbffa,0x88c8910a,0x5b5e2e6e,0x88c9992c,0xb4b4a0a0,0x88a8954c,0xbcb8b8b8,0x88c99d8e,0xb4b4b4f5,0x910b9d4c,0xf4f5b575,0x994da16e,0x7478b9bc,0x88a8954c,0xd1946060,0x80879d4c,0x80e0f0f0,0xa18fa9b0,0x17664501,0xa58fa9d0,0x8a4aefff,0x84a888c8,0x8b8b4a49,0x88c98cea,0xef1f2f5f,0x88a88cea,0xb9fdb9a,0x8cc9952a,0x5f4b838b,0x88a8910a,0x50fefefe,0x994da9d0,0xaf6f6a0a,0x8086992c,0x955a6bff,0x84a8992c,
-0x1f1f2e1f,0x8ce99d4c,0x77c34b0b,0xa18e9d6c,0xf9500000,0x8045a16e,0x50195e5,0x90eaa16c,0xfe954196,0x8488950a,0xbf4a4046,0x950b992c,0xafff5606,0x8486994c,0xaa05166e,0x88a8992a,0x6f15a4a5,0x84a7992c,0x50946a9f,0x90e9a16e,0x994c99f6,0x88a88cc8,0x90914592,0x8cea994c,0xaafe0000,0x84869d4c,0xea410000,0x8086994a,0xc2c2a090,0x8ce9994c,0xbf9590c0,0x88a8a16c,0x56a4f5ba,0x8cc990ea,0x94fafffe,0x8065950a,0x5e6fbff,0x84879d6c,0xa1f6f5b,0x848790ea,0xfea50100,0x8486950a,0x9ae141bf,0x90ea8cc8,0x71af999,0x848788c8,0x6afffe91,0x8cc99d4c,0x95efefef,0x804488a8,0x69b8e4c0,0x8ce9992a,0x60b6fbf,0x8cea992a,0xf9e44103,0x950ba16e,0xf990965b,0x88a890ea,0x1bbffe,0x8cc8992c,0xbbbefffb,0x8cc9910a,0xf9f04196,0x88a8950a,
-0xe46d9faf,0x806584a8,0x4091d0e0,0x910aa5b0,0xabf97eba,0x88c990ea,0x6e5f5f5f,0x80668cea,0x34341000,0xa16ea9d0,0x8babb7b2,0x952ca16e,0xe9fef8bd,0x88c990ea,0xf6e6d5c1,0x90ea950a,0xa5aaaada,0x84a8910a,0xf4f09090,0x910b950a,0xe0e1b07,0x8087994c,0x7f2f2e1e,0x88a8952a,0x5b5b5641,0x88c8950c,0x6f6f6b5b,0x88a8992c,0xf6fab97d,0x84a8910c,0xf4f4f4f8,0x88c9992c,0xf0b0a8b,0x88a8950a,0x1e1e0f0f,0x808690ea,0xf4f9faf7,0x950b952c,0xf9f5b9f8,0x8ce9952c,0x2f1f1f1e,0x8066910a,0x2e2f2f2f,0x80879d4c,0xb4f9f9fa,0x8cc9952c,0xf4e0e4b4,0x910a952c,0x6f6f6f2f,0x8086950c,0xfabf7f6f,0x88a88cca,0xe0e0e0f4,0x88c9994c,0x81d0e0e0,0x88a8910a,0xfafafae6,0x84a8910a,0xebe6fafa,0x88a88cea,0xd2864682,0x88a8910a,0x97979bd6,0x8087910a,
-0xf9f5b979,0x994ca5b0,0xf4f8f8f9,0xa58fba34,0x82c1e0e4,0x84a890ea,0xb474786,0x8cea9d4c,0x91e0f4f4,0x9d6fa58e,0x96929191,0x950b9d6e,0x2f2f1f0b,0x950a994e,0xbfbf7f7f,0x952ca16e,0xb071a66,0x8cc9952c,0x1e1f6f5f,0x8487910a,0x4054d1ea,0x84a7a16e,0xe5d50500,0x992b952c,0xfcbc6d2e,0x88c9950a,0xf0f4b878,0x84a8910a,0xbafdf8f4,0x8cea952c,0xaafb41eb,0x950b952c,0x53535356,0x8cc9994c,0xb0b1313,0x8cea9d6e,0xbd7e7ebf,0x910a952c,0x65a9b9b9,0x910b994c,0x1f1f1b0b,0x88c9994c,0x2f1f6f5f,0x8cc9952c,0xbd5d5554,0x910b90ea,0xe4e4f9f9,0x88a8952c,0xd0d0d0f0,0x84a8950a,0xd0d1d0d0,0x8086952c,0x6a2a6abb,0x8cea910a,0x572b6a6a,0x8cc98cea,0xd1d0d0d0,0x8087952c,0xc7c2c2d1,0x848788c8,0x4b575757,0x88a9910a,0xc3c38747,0x84a88cea,
-0x2f6f6f6f,0x88c8994c,0x1f1f1f2f,0x88c8992c,0x60f9f9f4,0x994ca58e,0xf4f4f4a0,0x8ce9954c,0x171b1f1f,0x8cc9994c,0xd0515256,0x994c992c,0xbd78a4a4,0x88c990ea,0x6fafafbe,0x8cc8952c,0xd0e5e6e6,0x8ce9994c,0xd1d6d780,0x84a78cea,0x8b878382,0x84a8950a,0x83838746,0x80878cca,0xe0e0e0d0,0x848788c8,0x1e3490f5,0x88a78486,0xb9398383,0x8cc990ea,0x5484ece9,0x8086994c,0xfcf4f4f1,0x950a994c,0x1b7fbfbe,0x950b992c,0x91c1425b,0x950b992c,0x69a5e5e1,0x88c8950a,0xf9954606,0x88a8950a,0xab6f7fbe,0x8ce9950a,0x969b5f6d,0x90ea992c,0xaaa555a5,0x950a994c,0x61b1f2f,0x8ce9a16e,0x5501e6e6,0x8487992c,0x41e490,0x8045952a,0x40a8bf6f,0x88c89d4c,0xe6ba6915,0x994ca9ae,0xaa0569e5,0x88a8992c,0xff550040,0x80448cea,0x500e8bf,0x8066950a,
-0x2f6f6f2f,0x90eaa9d0,0x2e1e2e2f,0x88a89d4c,0xe0e0e0e0,0x950ba16e,0xe0f0e0e0,0x9d6ea9d0,0x2e7e2e2e,0x88a7952c,0xa9fbbb6b,0x88a8950a,0xe4e0e0e0,0x992ca58e,0xf5f4f4f4,0x9d4ca16e,0xd7c7c787,0x80878cc8,0x87d7c2d7,0x90ea9d6e,0xd7e7e7e7,0x84a78cea,0xffffafd7,0x88c9950a,0xdb9bdfdb,0x88a890ea,0x95c6d7db,0x84878cc8,0x97d7c3d7,0x88c8952c,0x1b1f5f9b,0x88c9950a,0x54feffd6,0x8486952a,0xbe654100,0x88a8a16e,0x3d3a76b6,0x9d4da16e,0xb97e2e1e,0x910a992c,0x2f0190fe,0x808690ea,0x5a9ffbf,0x84a7950a,0xd0e0f5f5,0x88a8994c,0xa4f9b5d0,0x950a992c,0xe4e4e495,0x8cc9992c,0x65a0e0d0,0x992ca5ae,0xb1b1b1b,0x8086950c,0xea9f5f1b,0x84a788c8,0x5f6b2a65,0x9d4ca9d0,0xeaea2f6f,0x84a7992c,0xd0e5f9fa,0x8ce99d6c,0x16504080,0x994ca18e,
-0x5590a8d0,0x88878d0c,0xf9f9baaa,0x84a88d2c,0xa9aa2f0b,0x8087950a,0xba6a5695,0x88c98cea,0xf0f4b8bc,0x8487910a,0xa4e0e0f0,0x8487992c,0x2e6f7fbe,0x88a89d4c,0x7f2f1f1e,0x8087950a,0xfe560000,0x8ccaa5b0,0x50056fa,0x808688c8,0xff550000,0x912ba9d0,0x95ff,0x80458cc8,0xbebe6e6d,0x88a88cea,0xf8b8bcbe,0x88a890ea,0xbeff6944,0x90e9910a,0xdbcbcbea,0x88a890ea,0xa4a4a4a5,0x88869d90,0xa4a4a4a4,0x8c84ae58,0xbe1f6f6f,0x84878cc8,0xeaeafafe,0x88a890ea,0x6a6964a4,0x950cba54,0xfdbc7f6f,0x88a9a14e,0x8080c0c1,0x88c9950a,0x66f9a490,0xa14da9b0,0xb5a0faf9,0x88c990ea,0x47abbbbb,0x8cc990ea,0x8fcfd7db,0x8888950c,0x3e1f0f4f,0x8487950a,0x1f0b0b4b,0x806688c8,0xd5efefaf,0x888890ea,0xe4f4f97e,0x8cc9992c,0xb0b2a39,0x990b9d2c,
-0xff550000,0x88a8a9b0,0xbaff,0x90ea950a,0xbffa9000,0x8ce99d4c,0x5500161a,0x8065994c,0xbf6ff5e1,0x8cc890e8,0x9babafbf,0x8cc990ea,0x95d0ffff,0x8085950a,0xfefeea01,0x90ea950a,0x16ffee0,0x8cc9994c,0x55000000,0x91099d4c,0x5099abff,0x8ce9992c,0x65f595a5,0x8cc9992c,0xaaafbfaf,0x8044954c,0xaaffff00,0x8ceaa58e,0xaae5fe3f,0x8486950a,0xaaff1a00,0x90c9a16e,0xf0f5f5b,0x8cc994ea,0xbd6e1e0f,0x888890ea,0x64befebe,0x9d4da16e,0xe5f5e490,0x94ea9d2c,0x87d1f0f4,0x88a8990a,0xb87d1a0b,0x90c99d4c,0x4b87d1a5,0x8ca990ea,0xe0f8bd6f,0x8cc9992c,0x51566abe,0xa170a98e,0xff0a5a55,0x8cc9950a,0xfa5a4566,0xa14da58e,0xaaf4fafe,0x992b9d4c,0x1f87d2fa,0x90caa56e,0xfabe2929,0x8cc99d2c,0xfcaba7a6,0x8ca89d4c,0x92d5e4f8,0x88a8990c,
-0x18a9f9f9,0x88889d4e,0xb8b86514,0x90caa16e,0x3e1f6b57,0x8cc99d4e,0x868190b8,0x8cc9950a,0xf9a4a4a4,0x88879d4e,0xbefa5055,0x88a8a56e,0xaf969596,0x88a890ca,0x1f0b80f4,0x8ca99d4c,0xe0d0d0d0,0x8cc9990c,0x5be351d0,0x950aa56e,0x2f6fdf4b,0x8887950a,0xfcbc6e1b,0x8ca8950a,0x3a2e2e1f,0x8466a16e,0xedfebe7a,0x848790ca,0xf4f0f4f8,0x84879d2c,0xf0f0f4f4,0x88a89d4c,0xa4a4a9a9,0x90c89d70,0xa4f8b464,0x8ca99d4c,0xe9fabebf,0x8cc9990c,0xfeefd595,0x88a88cca,0xa0b4bd64,0x88a8992e,0xbdfafaa5,0x8488910c,0xd1e1e0f4,0x806790ea,0xe1e6d1d1,0x848890ea,0xf1f1f4f4,0x848790ea,0xf0f0f0f0,0x88a994ea,0x9aaab9b8,0x90c9910a,0x2737136a,0x990c9d4c,0x60a0b5b1,0x88a990ea,0x60707575,0x88a88cca,0xd1d25262,0x8cca950c,0x7eb5f5e1,0x8488990c,
-0x7df5d1e0,0x90ea94ea,0xfafafe7d,0x90ea94ea,0xbe4f8bc3,0x8ca890ca,0x57dbeb6d,0x90ca90ea,0x2f4b5beb,0x90ca90ea,0x82d6fbbf,0x90ea950a,0xf8faea9b,0x90c990ea,0xd6dbefee,0x8ca88cca,0xab5bafe6,0x8cc9990c,0x6f0b7f5a,0x90ea94ea,0xf0a96a3,0x88a8990c,0xe9e97d6e,0x8467992c,0xaba5566f,0x8cc994ea,0xbfbfbfbf,0x90ea990c,0xaaa690e0,0x88a89d2c,0x655595aa,0x8467950a,0xe0e09146,0x8cca9d2c,0xa9b8f8f4,0x88a994ea,0x86478786,0x888994ea,0x8181d581,0x88888cca,0x4606af6f,0x88a98cca,0xa0e0a192,0x90eb9d4e,0xead58681,0x84888cca,0x86859aee,0x848888aa,0x5f1f5faf,0x8cc9950c,0x1baf6f6f,0x88a99d2c,0x60a0d5d6,0x90eb9d2c,0xa0beb921,0x950ba16e,0x2f2f1f1b,0x8cca992c,0x1f2f2f2f,0x8cca992c,0x7474a450,0xa14ea590,0x78343434,0x9d4ea170,
-0xa5fefaaa,0x950b994c,0xfe6f0a05,0x806590ea,0xfa2f1bff,0x8ce9992a,0xfe904095,0x88a8952a,0xe6d3e1e0,0x88a890ea,0xfe6b0054,0x8cc8a14c,0xab1742f5,0x848690ea,0xbf419495,0x88879d4c,0x1610a4ff,0x90e8a9b0,0x46f56e1f,0x8cc99d4c,0xf0a8aabf,0x90ea992c,0x2f6a50e1,0x9d4da58e,0xfeb9bf5b,0x806590ea,0x81fefaea,0x90ea9d4c,0xf990a0fc,0x8cc99d4c,0xeb0b5bff,0x84878cc8,0xfffea9a5,0xa58fadd0,0xfffbffff,0x992b9d4c,0x5baa95ea,0x9d4ca58e,0xffffbfab,0x992c9d4c,0x5bbffefe,0x950b992a,0xaf6f0b0b,0x8887950a,0xa4baffff,0x950a9d2c,0xe5f9f4e0,0x950ba16e,0x15aff6f,0x94ea9d4c,0xbfea9656,0x950a9d2c,0x4f46f94,0x950ba14c,0xfe6fa201,0x950a992c,0x5aaaeaab,0x94ea992a,0x9bbfffaa,0x8cc9950a,0x58f2ffaf,0x90ea990a,0x1b020100,0x8467950a,
-0x5b85ea0a,0x84a78cc8,0x95eafeff,0x8cc9950a,0x6ebf6b54,0x8cc9952a,0xea82dbaf,0x806588a8,0xbebf1a02,0x88a89d2c,0xaf00956a,0x84878cc8,0x6a90fa,0x90eaa58e,0x6aa9fe00,0x90c9950a,0x65a5e9,0x950b9d4c,0xaf1a1b16,0x8cc8992c,0xf4bc7f2f,0x8ce8994c,0xf6b969e4,0x910a994a,0x5a5bfbf,0x90c9a16e,0xa5fe5600,0x90eaa16e,0xd04115ba,0x950c9d2c,0xfe1b0090,0x8cc8992c,0x6906e4ff,0x88a7950a,0xafbe4194,0x992ca14c,0x40e9ffbf,0x8487950a,0x55eafa5a,0x950b9d4c,0x6a06e5bf,0x8ca8992c,0xb4b4a4e4,0x90ea950a,0xe4febfa9,0x8cc9a14c,0xf9ef7f07,0x8ca9992c,0xbfffbf56,0x90e9950a,0xe5bf06e5,0x90e9a14e,0x6fe45955,0x94eb990a,0xb90f9ff,0x90c99d2c,0xaf464545,0x8ca9950a,0x2f42f4fe,0x8cc9a56e,0x55a9eabe,0x94eba54c,0xfaffaf6a,0x8cc9992c,
-0x95e5fafe,0x84878cc8,0xa4f8b4a5,0x90ca990c,0xb4796d1,0x88a894ea,0xd5fbaa4b,0x84668cc8,0x8bf3f3a1,0x90c9992c,0x1f0f0f4b,0x888794ea,0x965ad6d1,0x8ca994ea,0xf4be3f6b,0x992c9d4e,0x2e1e1f9b,0x88a8a98e,0xfaba7d7d,0x94eaa16e,0xa8a5bf6f,0x80458cea,0xe6a8a8e8,0x84879d2c,0xfeafbfff,0x84878ca8,0xd1d0e0f4,0x848794ea,0xfbaabbbb,0x90ca950a,0x1b1b6bab,0x88888cc8,0xb67e3d3d,0x88a9950c,0xf5feb9f2,0x8cc990ea,0xf8f8b4b4,0x950b9d2c,0xe0a0f0f8,0x90ca950c,0xd1d1d0d0,0x88a9992c,0x918485c1,0x8ccb992c,0x97f7fbe1,0x950c992c,0x4b5b5b47,0x88c9950c,0xb4b8685,0x90ca950c,0xbf7f7f0b,0x8cca990c,0x6e5f1f1b,0x80678cca,0xf8b8fc6d,0x848788a8,0xbf7fbfbf,0x8cca90ea,0xbe6abefe,0x88a990ca,0xf1f4f9fc,0x88a98cca,0xd1e0e1f2,0x84888cca,
-0x411151b4,0x8cca94ea,0xbf1b7e2f,0x846690ea,0xfe8d959f,0x90ea90ea,0xe534f4fc,0x90ea94ea,0xafbfb9f4,0x8cc9990c,0x808095aa,0x88a88cca,0x7ebaaae6,0x88a8992c,0x5f1f2f7f,0x8ca9a14e,0xbffffeff,0x90caa56e,0xbf15ffbf,0x950b90ea,0x2f0782e4,0x8466992c,0x6ba4fbbd,0x950b9d2c,0xf4e5fabf,0x8cc99d4c,0xd1d0e0e0,0x84879d4c,0x7f060656,0x88a8950a,0xabaf1a1a,0x80458cca,0x909090d0,0x806790ca,0xa5909094,0x848890ea,0x47575b5b,0x8cca992c,0x1f0b0b47,0x8888992c,0x12014195,0x8ca9950c,0x6bbb6656,0x90eb950c,0x797d7f6f,0x8cca9d4e,0xd0e5f9f8,0x88a990ea,0xad98d4d4,0x90ea94ec,0xf5f9f9fc,0x94eb992c,0xafff9b06,0x80468cca,0xd7aba91e,0x848790ca,0xa0b4f4f4,0x90ea9d4e,0x5791e1e0,0x992da16e,0xafafc3c3,0x88a990ea,0xfe7e7fbf,0x8cc9950a,
-0xb965a7ff,0x992c9d6e,0x5fbfb9b9,0x8cea9d4c,0xe5aa1f43,0x8066a18e,0x55419af9,0x8487910a,0xba75756b,0x8ce9910c,0xe6e6d5fa,0x84a8952c,0xe0e4f8a9,0x88c9a5ae,0x11014190,0x952ba58e,0x36792850,0xa5b0b612,0xd59a6f5b,0x8065952c,0x90d5f4fd,0x8ceaa18e,0x1b655091,0x9d6db612,0x2bbbaaa5,0x910b994c,0x7e2f1f5b,0x8cc99d6e,0xd5a47f2f,0x84a79d6e,0x51a599d5,0x994ea58e,0xf9e9e9e6,0x88a88cea,0x3d3dbebe,0x84a890ea,0xb9b6a261,0x952c9d6e,0xbcb8bcbd,0x88c9910a,0x6f1e1e2d,0x88c9952c,0x57575b5f,0x90ea952c,0x7f0e3e7d,0x90ea90ea,0x3e7f7f2a,0x910b992c,0xf5f5f97a,0x84a890ea,0xc6c695a5,0x80878cc8,0xf5b9aa55,0x8cc99d6e,0xe6fbf5d6,0x8cea910a,0xc0c4c4c5,0x80878cea,0xd0d5d5c0,0x8487994c,0x661bfbe7,0x84a8950a,0xa6fbaaab,0x88c98cea,
-0x1f0b0b06,0x88a8910a,0xe4f9be6f,0x8cea994c,0x95d0c0e0,0x8cc9910a,0x56b96545,0x910a992c,0x8791e0e4,0x8ceaa9d0,0xba2f1f1b,0x8086952c,0x5f0f0b0b,0x88a8910a,0x95595e9e,0x8cea994c,0x5f5b5355,0x84a8a58e,0x653a2e1f,0x84a8910a,0xf9fa9540,0x952b9d4e,0xb4b4b8b9,0x910b9d4c,0xd5d5d0a0,0x8ce9952c,0xb8b8b8b1,0x950b952c,0x1f97d3e1,0x90ea9d6e,0xbe6f2f2f,0x88c9992c,0xe6f9a96a,0x90eaa5b0,0xbf7f2f9b,0x88c9a16e,0x6fabe5a9,0x910b994c,0xf4b8be6f,0x88a89d6e,0x50a9ffef,0x804588ea,0xbaff9585,0x8cea950a,0x7d1e07d2,0x88c9a16e,0x6f1edbfb,0x8cea950a,0xadaeaf68,0x910b952c,0x5b8a3e6d,0x910b952c,0x96e6f9fd,0x8cc9910a,0xaaafa899,0x910b954c,0xb0b9aeaf,0x84a8994c,0xb52d4b82,0x88c99d6e,0x7efaba66,0x994d9d6c,0xd178ae8b,0x8cea912c,
-0x4243e7e7,0x952c9d4c,0xa3a26252,0x910ba18e,0xbfffaf5f,0x90ea952c,0xbf7e7ebf,0x910aa16e,0xb0b1363,0x952c9d6e,0xb46e6e5b,0x8cc9910a,0xa4a0787e,0x952c9d6e,0x19b9baba,0x992ca190,0xf0e1a0d0,0x8087910a,0xf0e0b4f0,0x84878cea,0x9bea91e1,0x88c9950a,0x2d1e9b9b,0x84a8994c,0xe5f9b4f0,0x84878cea,0x99e5e5e5,0x84a7952c,0xa6b96a2d,0x84a8992c,0xffad642,0x84a88cea,0xa450e0e4,0x90ea994c,0xaafab0a0,0x994c9d6e,0xaa0e1b56,0x88c9950a,0x6a4181e5,0x8cea992c,0xf0b5b96,0x84a8952c,0xe5e5af5f,0x8086950a,0xe4f4f9be,0x992d9d6e,0xbf7f06a5,0x910b952c,0x1159a4a0,0x992ba9d0,0x85fe3f0b,0x8cca992c,0xe4feff5f,0x84a8994c,0x2f414080,0x88c9a58e,0xffaf5f95,0x910b992c,0xffb940ee,0x952c9d6e,0x5b4195fa,0x90e9952c,0xfffefabf,0x994d9d4c,
-0xafafa5aa,0x8cca8d0a,0xbdfeffaf,0x88c9992c,0xfeffbeaa,0x952b992c,0x6a46e6fe,0x8cea994c,0xe5f0b8fc,0x910b9d6e,0xfe660782,0x8cea952c,0x5b96d090,0x8ce99d6e,0x4695bebf,0x88a8910a,0xafa696aa,0x910b952c,0x40faffaf,0x88c9a18e,0x5a8fbebe,0x952c952c,0xfeaf9656,0x88c8994c,0xfeff6f06,0x8087a1b0,0x7f1f85f9,0x80868cea,0x2f420094,0x912ca5ae,0xe4e6ff,0x8066910a,0x1b1f1ffa,0x90ea952c,0xe4f9be6f,0x88c9a18e,0xa5fdf956,0x952c9d4c,0xaf065569,0x88c9952c,0x59febf42,0x910aa16e,0xffda9aaa,0x910a952c,0xae1be0ff,0x8cea952c,0x76fff96,0x8cea9d6e,0xaa4f7f35,0x950b992c,0xfaf1bdbc,0x910b952c,0xfafe9000,0x84879d2c,0xffea9191,0x910b8d0a,0xfefef7ff,0x910b952c,0xad91ffff,0x88c8952c,0x6affffff,0x8d0a952c,0x16be7f6b,0x952c994c,
-0xfaafbfaf,0x84a890ea,0x69feaf9,0x8cea910a,0xabfafafa,0x8cea992c,0xfeaf9f5b,0x84a78cea,0xbe2a2a1a,0x8cea910a,0xf0f5bd7d,0x952c994c,0x95d4e4f9,0x84a8910a,0x6f1f0b4b,0x88c8910a,0xffffd9de,0x8cea910a,0xfedfffff,0x910b910a,0x9f9f1f1e,0x88c98cea,0xab9f9f9f,0x88c9910a,0xabababfb,0x88a88cea,0xfc7c7fbf,0x808788c8,0x9a9aeaea,0x90ea8cea,0xbaf8b410,0x88c9910a,0xf5ba5e0,0x8cea994c,0xbe2e2f1f,0x84a8994c,0x956abfbf,0x90ea994c,0xf578b8f8,0x994c9d6e,0x5596e5f9,0x912ca18e,0xbabdbaaa,0x910b954c,0x2f0f9be7,0x910a996c,0xefe5b97f,0x84a8910a,0x97e1e0f5,0x84c9992c,0x6e190f5f,0x8cea994c,0x1f1b5b97,0x84a8910a,0x74381e2f,0x88c9910a,0x58f6fbbf,0x912b9d6e,0xf535054,0x8d09a5b0,0x8682d2e4,0x84c9912a,0xa9b9be6a,0x954da18e,
-0xbfaf5b0a,0x88c9910a,0xc2d3cfbf,0x910b8cea,0xbabeb9f9,0x910b992c,0xa6aaaaaa,0x8cea954c,0x7fbfffcf,0x910b952a,0xb541797d,0x8ceb8cea,0xe4e5a5a6,0x8cc9952c,0xd0d0e4e5,0x84a8910a,0xe5d28186,0x84a88d0a,0x2f7ebeb9,0x88c9912c,0x96471f6f,0x88c9910c,0xf8f8f4e1,0x910b952c,0x70b1b1f,0x88caa18e,0x17571717,0x88c8a9d2,0xe0f4f8f8,0x910b994c,0xf4f4a0f4,0x910b952c,0xb4b4f1b5,0x88ca910c,0xe0e0b0b4,0x8d0b994c,0xa0e0f0d0,0x8088910a,0xe0f0a4a0,0x88c9a18e,0xaf9febe2,0x84a888ea,0xd2d1e9ae,0x80868cea,0xdbd7d2e1,0x88eaa5ae,0xbf3f2f5f,0x8087952c,0x1f1f5b5b,0x8ceba190,0xffbf7e2e,0x88c99d6e,0xf4f9f9f8,0x910ca5b0,0x52f5b4a4,0xa18fa9d2,0x5f0feffb,0x808784a8,0xf8f9be6f,0x80a8912c,0x7e1f0b07,0x88ca9d6e,0x4606eafe,0x80878cea,
-0x46eafdf9,0x910b994c,0xaf410145,0x84a8912c,0xfafaaaeb,0x952b994c,0xaa15e5fe,0x8cea952a,0x50f9ff,0x952badf2,0xf4bf1b01,0x8487996c,0x50e9bfaf,0x84c89dae,0x1b550000,0x8d0badd0,0xcb97bf1f,0x80888cea,0x6eac9f9a,0x8cea88ea,0x1f565050,0x8ceaa9f2,0x95eaff7f,0x84a88cea,0xfe6b5a5a,0x8087910a,0xa55494,0xa5aeb212,0x6f010040,0x804488c8,0x50aae9ff,0x914ea9ae,0x1b8356a4,0x848790ca,0xffebbe1a,0x88c9996c,0xf896f9fe,0x80248086,0xffff4190,0x910aa1ae,0x55ffffff,0x910b952c,0xf4d05501,0x88e9910a,0xfeffffff,0x8cea994c,0x5b1bbffe,0x84c8954c,0xfdfe2f01,0x8066952a,0x6f2f6fbe,0x8d0b910a,0xbf561000,0x910aa9f2,0xa5fa,0x80a9910c,0xe7ff6f1b,0x8cea954e,0xf5f0e0d2,0x88e9994c,0xefaf5100,0x8d0b954c,0xebc387db,0x88c98cea,
-0x5079a9da,0x9d6ea9d0,0xbf5b0200,0x88eaa5b0,0xe0f8bfff,0x808788ea,0x14a550d0,0xa18fba54,0x5940a5fe,0x804688ea,0x5556ffff,0x88ea9d6e,0xe5e92f02,0x8067912c,0x1babfaa,0x84a98cea,0xaf564647,0x808788ea,0x90f9ffbf,0x84a89d8e,0x7ebf6a06,0x912c954c,0xaf0b475a,0x80a888ca,0x7f150000,0x912cadf2,0xfa5aeafe,0x806780c8,0x54e4fe,0x84a8a9f2,0xffa56f06,0x8087952c,0x15554094,0x994dadf2,0x4040fe6f,0x80878d0a,0xe5f96a,0xa190adf4,0xa9fe1b00,0x84ca996c,0x9fef9a40,0x8ce98d0c,0x5152474f,0x8d0b9d6e,0x5f5b96aa,0x84ca912a,0x6e6e2f2f,0x84a9910c,0x50ffaf55,0x9d6fadf0,0xff5a0000,0x84a9a5d2,0x556b55fe,0x912ba190,0xbf550000,0x954eae12,0x152ca9fa,0x910b8cec,0xa465b585,0x8ceb8d0a,0x56ff,0x80668d0a,0xbef95501,0x84c9910c,
-0x424090d4,0x8ce9994c,0x96fe3f0b,0x88c8994a,0xf9bebfaf,0x88a8952c,0xb06d0e4,0x8ce99d6e,0xff5b0141,0x804490ca,0x1600e5ff,0x8487990a,0x1f41f4ba,0x8ca8950a,0xa97f2f,0x84868cc8,0x2e0fabf,0x910b952c,0xe8beaf5b,0x88c99d4c,0xe0fbffba,0x994ca16e,0xab5a7fba,0x952c994c,0xa47e0780,0x88a89d4c,0xf9ef5980,0x806688c8,0x6d0f9ff,0x8487a16e,0xe150e02e,0x8cc9950a,0xa50680f9,0x94ea992c,0xb9ffffbf,0x90ea9d2c,0x46e4ff06,0x8cc9992c,0xbecfaff9,0x90ea90ea,0xe9fe1f90,0x90eaa14e,0x56966aaa,0x94eb950a,0x781d5ff,0x8cc99d4c,0xa982f9bf,0x8ca9950a,0xbe7f11a0,0x88c8992c,0xa6ea1586,0x90ea910a,0x1b05a4e0,0x80879d4c,0x6a01a9bf,0x8cc8950c,0xa46f6fba,0x8ceaa14e,0xeabf1b40,0x88a8a16e,0xfa69c9ff,0x992c950a,0x1fd1f8fe,0x910ba16e,
-0xff3f2fff,0x910b952c,0xfffebde9,0x952ca16e,0x6fa8bee0,0x88c9994c,0x1fbfbfbf,0x952c994c,0xae9bfeaf,0x8cc9952c,0xaf050290,0x8045950a,0xb55e3b2a,0x9d4d9d4c,0x56a0b965,0x950b9d4c,0x65a9596f,0x950c994c,0xd5da9695,0x90eb994c,0xfeaae551,0x88c9950a,0x1b1f6fbe,0x88c8952c,0xd5d0d0d0,0x8487950a,0xd0e6eac5,0x8cc9992c,0x57121617,0x910b994c,0x1f2f1b16,0x9d4da5b0,0x40a4feff,0x806590ea,0x91fdae15,0x88a8950a,0x55aabf6f,0x88c8992c,0xff070500,0x84878cc8,0xfafcbf1a,0x992c9d4e,0xf8ffffbf,0x992ca16e,0xaa1b40f4,0x8cc9992c,0xffff6afe,0x9d4d9d4c,0xa5a5cac0,0x88c8950a,0xaa4054a5,0x88c990ea,0x6f2f1f1f,0x88c9a58e,0x55eafebe,0x88c9910a,0x1a0febf,0x84a8950a,0x5fff6a66,0x994c9d4e,0xfe6f1b46,0x84a88cea,0x656a40d0,0x910b994c,
-0xf8bdafab,0x88a890ea,0x869ae1e0,0x8cc9950a,0xfb5501aa,0x950b9d2c,0xab6b9796,0x990c9d4c,0xa4a4a999,0x94ea992c,0x91e1f4f4,0x950ba14c,0xffbfbfbf,0x950b992c,0xffbfaabe,0x990b952c,0xef8641aa,0x90ea992c,0x6aef865b,0x992c9d4c,0x5b45d5be,0x8cc9952c,0xe0e67fbe,0x90ea992c,0x7fb9f9fa,0x950b9d2c,0xdada5556,0x990c992c,0x7fbf4781,0x950b990c,0xaa7f1e6f,0x990c992c,0xbf7f1640,0x8487950c,0xff5a16a8,0x804690ea,0x4179b86a,0x950b990c,0xf6d0d0c0,0x848790ca,0xaf6f0297,0x806690ea,0xe0f8f9ae,0x84878cca,0x7a7dbeff,0x848890ea,0x7f7f7e3a,0x8488950c,0x7ef9e9a5,0x88a99d2c,0x756b5f6f,0x90caa14e,0xe0e5ffbf,0x88a9992c,0xe5f4f4f4,0x8888950c,0xa4a8a5b5,0x950c9d4e,0xa8e4e494,0x950c9d4e,0x81d5eae9,0x84888cca,0x5b968281,0x88a9950c,
-0xf9fe0b40,0x90ea9d4c,0x46e2fdfd,0x90ea9d4e,0x1f91a9fe,0x950aa590,0x9fefe5bf,0x84678cc8,0xfe7a2f0a,0x88a9a14c,0x1140e5f9,0x90ca990c,0xe1f4781d,0x8ca9a590,0x1e4ad7d2,0x88a9992c,0x94faffbf,0x992ca9b0,0xff7f0b00,0x80669d6c,0xfeff6a66,0x994ca16e,0x60050a5,0x88e9a58e,0x7f5f9da9,0x806690ea,0xaf9f4b7a,0x90ca992c,0xe0f9ffbf,0x8024992c,0xa5ffbe90,0x952c9d4e,0x7b7f1b0a,0x9d2d9d4e,0x2aba2666,0x992da14e,0xf4fd7d2e,0x9d2da570,0xb8fdf4e0,0x992d9d4e,0x5b0beb6b,0x88a990ea,0xaeaf6f5b,0x88a9950c,0x55e9fef8,0x88a9992e,0xbefe5500,0x90eb992c,0xe2f1b42c,0x8cca9d4c,0xfaffef8b,0x950c9d4e,0xaf6b6524,0x9d4ea16e,0xafbfbfaf,0x950c9d4c,0xf57faaaa,0x90eb950c,0xbf2f8ed9,0x8cca950c,0xfae45aaa,0x88a9950c,0xa52e4bd7,0x88a9992c,
-0xd14baffe,0x84a888ea,0xe5e4e0d1,0x88e9910a,0x2fbebaaa,0x88e9912c,0x97ab6b6f,0x88e9954c,0xbd2e1dbd,0x8cea910a,0xe0e494a8,0x88c9992c,0xbef8e491,0x88c9950a,0x47475b6f,0x848790ea,0xb0e0e5fa,0x84a8910a,0xcbc6e9f8,0x808688ea,0x2f6b7fbf,0x88e9910c,0xf3f76b1f,0x952ca18e,0x7c7abbfb,0x88ca8d0a,0x3e3e3e7d,0x88c9996e,0xf4e4f5fa,0x8ceb992e,0xe0e4e4f9,0x910ba18e,0xf8f8f4e0,0x88c8994c,0xfaebfaf9,0x8cea950a,0xaaffe787,0x90ea910a,0xffbfaa96,0x8cea950a,0x96808095,0x84a88cea,0x155fdff,0x84a8910a,0x75babff,0x88c8994e,0xfdbf1f0b,0x8087910a,0x3e3f3e3e,0x88c9954c,0xfae5fd7e,0x84a98d0a,0xf0f0d0d0,0x994da190,0x1b5d58a4,0xa18ea9d2,0x479bebeb,0x84a88cea,0x57061d0e,0x88a98cea,0x6e6f1f1b,0x8cea9d6e,0x41d0f8be,0x88a8910a,
-0xb5645450,0x952d994e,0x6fbfbab9,0x910c994e,0x2f0f1f1e,0x84a988ca,0xbebe7e7f,0x84a9912c,0xbfbf6f6f,0x910b912c,0xefafafbf,0x8cea952c,0x2f7f7e7e,0x88c9910c,0x1f6f6f2f,0x80888d0a,0xe090d0e0,0x84c9910c,0x554591e1,0x8ceb910c,0xd24b1b2f,0x88ca952c,0x5ab9f5e2,0x88ea910c,0xf9fea556,0x912c954e,0x7975b440,0x8d0c952c,0x9b4b065a,0x88eb912c,0x7eaad5d5,0x84a98d0a,0xaf5f469b,0x88c9910c,0xe4a9aaaf,0x84a9994c,0xf0f1f1f,0x808788ca,0x1b4f4f0f,0x80a88cea,0x519090e0,0x994ea9d0,0xbf1f1615,0x8ceaa590,0x6f1f1f1f,0x80678cea,0xd0f8f87d,0x84a9952c,0xa8b87879,0x88ca8d0a,0x518195e4,0x8088910c,0x1f1f2f2f,0x84a9994e,0x4b5b0b0f,0x8ceb952c,0x51505050,0x84a9910c,0x57424251,0x808788ca,0xb07070b,0x8088952c,0xbd7e2e1e,0x88c99d4c,
-0xaa415565,0x8cea910a,0x54f9feff,0x992ba9d0,0xffbf6fd1,0x8ce990ea,0xeabfafff,0x90e9950a,0xffbf1b01,0x8cc9a16c,0xaaab65af,0x950c9d4e,0x6f010090,0x90eaa58e,0x6a01a5fe,0x88a9992c,0x645f8bf,0x808790ea,0xff51a65a,0x88c9910a,0xf97e0705,0x84a88cea,0xffaa0680,0x88c98cea,0x95f9ff,0x992da18e,0x95f97f07,0x8cc9952c,0x40aaffff,0x88c99d6c,0xff5b4000,0x90eaa590,0xe1f9a5a9,0x910ba590,0x50545e0,0x950c9d4c,0x5792e5ff,0x90eba16e,0x6d1f1f0b,0x90eaa16e,0x6b661515,0x90eb9d4e,0x91f8febf,0x88a9a16e,0x90e0f4b8,0x90eb9d4e,0x6a468180,0x84899d2e,0x4180ffab,0x88c890ea,0x90f8be0a,0x950c994e,0x6f5a46e5,0x808788c8,0x6e47c1fd,0x88a98cea,0x1b171500,0x8488a58e,0xe1fa7f2f,0x80659d6c,0x90f0f9f9,0x950c9d4e,0xf6f5e0d0,0x88a99d4c,
-0x1b0095f9,0x88c990ea,0x641f8ff,0x84888cea,0xe4fe2f82,0x8cca910c,0xe4bfab96,0x84a8910c,0xfabfff7f,0x8cea992c,0x11150090,0x994da5b0,0xab5a0600,0x84a9992c,0x94f9ff,0x8ceaa58e,0xbfbf7eab,0x8cea910a,0x2f4a9aaa,0x8cea910c,0xd5d0e5b8,0x80878cea,0x506e5b96,0x8d0b952c,0x5a40e4be,0x80888cea,0xe4ffffff,0x8cea9d6e,0xe9af0600,0x84a88cea,0xff9a5b46,0x84a98cea,0x90e0ff6f,0x8086910a,0x6e6f5f1b,0x84a98cea,0xfeab0600,0x8065954c,0x65a5a9e0,0x84a9a16e,0x6faf7fbf,0x848894ec,0x8a465b5f,0x84888cca,0xf9fab969,0x8ccb9d4e,0xefaaf9f9,0x88aa90ea,0x6f550000,0x88e7a590,0xa9abfeff,0x80448d0a,0x15440e4,0x994ea9b0,0x41aaff1a,0x8045952c,0xffffa9a4,0x8ceba590,0x46a5feff,0x88ca8d0a,0xbf6f0101,0x8ceb910c,0x59feffff,0x88ca910c,
-0xbfbf6a00,0x84cc8172,0xffffaabf,0x84ec910c,0x9a964140,0x846884ec,0x3f6faaea,0x808a84ec,0xe9feffff,0x84cb8d0c,0xefffe5e4,0x84aa88ca,0x7f7f3f3f,0x84aa9150,0x7f3f3f3f,0x8088952e,0xebefaa69,0x84a9910e,0xf9f4f4f5,0x84cb8cec,0xffff5610,0x84ca850c,0x8686ebff,0x806684a8,0xf9f9aeb9,0x84cc890e,0xe0f4f4f5,0x8d0d912e,0xebd6c686,0x808988ca,0x1a0f9beb,0x84ec8d0e,0x6b5a9aaa,0x848884aa,0xbabfbfba,0x84aa84ca,0xd5d5aa7e,0x804688a8,0xa696d6d5,0x846684ca,0xeafafaa5,0x84a984aa,0xbfebaaaa,0x808788ca,0x7fbfffaa,0x84a988ca,0xe9bfeaea,0x84aa88ca,0x56a1e0e0,0x8d0e954e,0x7f2f1f4b,0x84a9910c,0xf94a7f3f,0x80ee80ee,0xf4f8b9ff,0x850f8d72,0xdbd6fa7e,0x806880aa,0x6a016aef,0x84cb8d0c,0x1b5655a4,0x84ca9970,0xd0e5bd2f,0x808988ec,
-0xffffa940,0x80888d0e,0xafafafff,0x84cb8d0e,0xbfafafaa,0x88aa810c,0x41a6baaa,0x88ec9130,0x5b5babaf,0x80a988ec,0xac4f4f4b,0x806884a8,0xfaf1fa81,0x808a80ca,0x1b5e5faf,0x88ca890e,0xaafe6a6a,0x80a9912e,0x6fffeaaa,0x80aa84cc,0xfaaa9040,0x80898d2e,0xd5ffbfff,0x84cb88ec,0xe1e1070b,0x84ee8d2e,0xa0e0e0e1,0x80cc890e,0x6bebfee4,0x80cc890e,0xe6d747ab,0x80ab84ec,0xc1d0e8e8,0x808888ca,0xbfab8683,0x80aa88ec,0x7070317,0x84449150,0xbe7f1f0f,0x8068910c,0x90e5fabe,0x84cc890c,0xb656490,0x8d0d9970,0x4a82d3fe,0x808888ca,0xa1b9be6e,0x88ec9970,0x80408090,0x88cb84ec,0x91f8f4e1,0x84cb952e,0x1f0b6fbe,0x808888ca,0x6f1f1f1b,0x84cc912e,0xbe2f0b41,0x8068952e,0xffe5fafd,0x808880aa,0xf4f4bd7f,0x84cb8cec,0xaf07bfff,0x84a98cca,
-0x6f87f9fe,0x808984ca,0x90e4fd,0x8d0d9d92,0xb96b6b95,0x806884ca,0xf85f9fea,0x80aa8d0c,0xfe6a0600,0x80a99d4e,0x5655aafa,0x806680a8,0x17550d0,0x9d6fa9b2,0xaae97f0b,0x806784e8,0xa5b4f4ba,0x88cc912e,0xeafe7f6f,0x808a88ec,0xfbf8b9d5,0x88ec8d0c,0xff6f4054,0x80aa84ca,0x40e4febf,0x910d9d6e,0x7f560000,0x88caa5b2,0x6a0796fe,0x80898d0c,0x105594f5,0x9d70a9d2,0xaa55aa9a,0x808888cc,0x6e0ffff,0x84a98cea,0x164efaea,0x88cb88ca,0xf9bf5b06,0x808888ca,0x55e9febf,0x910ca190,0xffff6f15,0x84a9a590,0x95efbf45,0x8cec994e,0xff1b4500,0x88a99d6e,0x4040e6fe,0x80898cea,0xaf060554,0x80888cea,0xa5f96f07,0x84a9952e,0x45545000,0x8ceb910c,0xaa5a41fe,0x84a9910c,0x64040e5,0x912da16e,0x690feaf,0x80888cea,0x50fafaab,0x9d6ea9b2,
-0xe6ef7e2f,0x8089912e,0xa479aa95,0x84cb8d0e,0x9f660840,0x8d0e956e,0x85d0fe3f,0x84a88cea,0xf5a96f96,0x806884ca,0x40ba6f96,0x912d9d70,0xeb404041,0x806788ca,0x1a41f4ff,0x84a99d4e,0x41e4f9fe,0x890c994e,0x2f975614,0x88eb9990,0xe5aaafaf,0x802580ec,0x196ae5e4,0x892f9d70,0x4281f9fe,0x80468488,0xf4ae5f96,0x806788ca,0xfa7f0611,0x84a99d4c,0xaf9a99fa,0x806784a8,0xbf064000,0x8ceba5b2,0x6aae5fd,0x84aa952c,0x51a99554,0x994eadf2,0x64eabf1f,0x84a9994e,0xf8feaa06,0x84a98cec,0x41ffff95,0x910c994e,0x6f064150,0x88ca952c,0xaa1a96ff,0x88c9910c,0x55fa5a45,0x952da590,0xfe1b0050,0x80889d6e,0x141f9ff,0x84a9910c,0x6a45410,0x952d9d6e,0x5595f9,0x8d0b9d6e,0x5690ff6b,0x8088910c,0x40e5ffbf,0x8088994e,0xd0bf0600,0x84a98cea,
-0xffea5a06,0x8089914e,0xffeb456b,0x84cb88ec,0xabff9500,0x80aa8574,0x17ffaa55,0x88ee9130,0xe5461bbf,0x84cb8d0c,0x6aabfffe,0x80aa912e,0xabbd9001,0x80698cec,0xe8eafeaa,0x804388a8,0xaaffaa00,0x80cb91b6,0x406b6aaa,0x9150a192,0xaaffaa00,0x80aa8952,0xa9550015,0x910e9d70,0x101bff9,0x804784ca,0xbfffab46,0x808688c8,0x6500aaff,0x806784aa,0x17ffee5,0x84aa9d4e,0xfde9a569,0x84cc912e,0xf4f4f8f9,0x80cd890e,0xafaf4180,0x80aa8cea,0x57e2faae,0x8489910c,0xffff95f4,0x84ab88cc,0xfa94d5ff,0x80ab88ca,0xfeff7f0f,0x80a8910c,0x5f9f6fef,0x84a984aa,0x2f6f1f6f,0x80ca914e,0xaa6a7f6f,0x808988cc,0x60649050,0x956e9db2,0x91f4b460,0x8d0e914e,0x7d6f4ee,0x8088952c,0xfeff7e1f,0x8089952c,0xfe1f0b42,0x80688cec,0x751e4f8,0x8489994e,
-0xfeff5600,0x80aa8d2e,0xbf550094,0x88cb9d70,0xffaa5500,0x80898d30,0x590e4ff,0x84aa994e,0xe590d0ff,0x846890ec,0xf840ffab,0x888a90cc,0xfafaffbf,0x84aa8d2c,0xab0aaaea,0x80888488,0xaaaa5500,0x84888910,0xf4ffbfef,0x84aa910c,0xaaaa5500,0x84898d30,0xa6aabaff,0x80ab84a8,0xffffff46,0x80a984ca,0xfeb9bfbf,0x84a984aa,0xdadae5a6,0x808984cc,0xa5dadada,0x806884ca,0x9099bfbf,0x804784ca,0xffbf0601,0x850d892e,0x41e4f9ff,0x804594ea,0xfff8a9ab,0x80aa84ea,0x42e0f9aa,0x88cc952e,0xe5feff1b,0x80678cec,0x197ebeeb,0x8d0f9972,0xff6f0100,0x8087954e,0xffbffffa,0x84888cca,0xaffb11aa,0x84ab8d0c,0xa6a5a6a5,0x806680aa,0x56ab54ea,0x84cb950e,0xe0f8febf,0x808b912c,0xbf650040,0x8ceba16e,0xab5b566a,0x84aa8cec,0x4194bdbe,0x806688c8,
-0x4b9696ea,0x80aa8cca,0xe4aaaf5f,0x804688ca,0xb7e2520b,0x8cec910e,0xbbfafdfa,0x808988aa,0x2a545e0,0x88caa16e,0xe6ea7f0b,0x806888e8,0xe8fdffff,0x848890ea,0x7f170090,0x84a89d4e,0xdabffef9,0x808984aa,0xefefffeb,0x84aa84a8,0xfffa7e1f,0x808884ca,0x16fffbef,0x84a9910a,0xaf4746bf,0x806884aa,0x90f8febf,0x84a8994c,0x5afaa515,0x84ab8cec,0xffafaf55,0x808888ca,0xf47e5fbf,0x808784a8,0xa4ffaae4,0x952da5b0,0x5b4046fa,0x80468088,0x1982fdff,0x84ca910c,0xbebf1f40,0x8087912c,0xff555490,0x8088952c,0xbe565451,0x84a9a190,0x415095e9,0x88ca952c,0xfafabf07,0x8088910c,0xe4bfafaa,0x808884a8,0x9f5b80e8,0x80888cea,0xaf454196,0x806784aa,0x41a95541,0x8cec9d6e,0x4095ff2f,0x8066910c,0x555ae5fe,0x84a9a590,0xe5fe1b00,0x84a9912c,
-0x1fd264a4,0x84c9994c,0xe4d5ff2f,0x806788ea,0xc1f9ffff,0x808888ca,0x1f570014,0x84a9992e,0xe56b5a90,0x84ab88ec,0xfff9eaf9,0x80aa84ca,0x9b82aabf,0x80888cea,0xcf7fbffd,0x84a984aa,0xaf16abff,0x804684a8,0x4a1f8fe,0x84aa950c,0x81e4feff,0x8067952c,0xfdbfafab,0x806788aa,0xbf5f0601,0x84a9952c,0x564056fa,0x806784a8,0xa1e4f4,0x952da190,0xfebe2e07,0x8089952c,0xbefeffff,0x84a9910c,0x7ef9fabf,0x8ceb910c,0xfaaeeedf,0x8ceb88ea,0x159595aa,0x8ced910c,0x50f9bfab,0x84a9910c,0xff1b4000,0x84a9a18e,0xaf560101,0x806888ec,0x1aa5a5f9,0x8ceaa190,0x6aaaab5a,0x8ceb912e,0xf91efffe,0x8d0d8d0c,0x2a9ae,0x8ceb910c,0x91e4febf,0x8d0c910e,0xaaa5f4f4,0x88cb8cec,0x40aafeff,0x8087994e,0x5aa9a964,0x8ced88ca,0xf9ff6f6f,0x8488910c,
-0xfa2f41f8,0x84a9992c,0xff0601aa,0x80678cca,0x690feff,0x80879d4e,0x9b40a9ba,0x84a98cea,0x5595f9,0x992cb1f2,0x81eaff06,0x8067992c,0x55eaff,0x88a9a9b0,0xffff1a00,0x88a8a9d0,0xa4aafbbf,0x80468d0c,0xaafe6f01,0x84a9a16e,0xfffebf01,0x84a9994c,0xff1f40f9,0x88a9994e,0x40faffab,0x88a9994e,0xff6b0000,0x8489a9b0,0xf96f6baa,0x84a890ea,0xbf050040,0x8cca9d6e,0xa8a9a9,0x88c98cea,0xfeaf0700,0x80878cca,0x1401aaaa,0x84a988c8,0xaf956414,0x84a88cea,0xaaff07e5,0x8cea910a,0xaabf0154,0x8cc9994c,0x5506e9ff,0x8087910a,0xff015495,0x84a8992c,0x5410aaff,0x88c88cca,0xfffefef9,0x8cea910a,0x55406aff,0x84a88cea,0x5efff6f,0x8cca8cea,0x40e56fbf,0x848884a8,0x290a906,0x88c9952c,0xff5a0001,0x80878cca,0xba55e0,0x90ea994c,
-0xff6f0100,0x88ca9d6e,0x190feff,0x84a8992c,0x6f000050,0x8ceb9d6e,0xf9ffffff,0x88a9a5b0,0xbf5595bf,0x80888cea,0x10055fe,0x84889d4e,0xaae5bf01,0x84888cca,0x50feff,0x8488952c,0xa5a5aa,0x952ba5b2,0xffabff5b,0x808890ea,0x55feea41,0x910c994e,0xffff1b00,0x84a99d6e,0xfebf41f9,0x88a9952c,0x90feffff,0x8488910c,0x7f41febf,0x88a9910c,0xfebfabff,0x808890ea,0x515aaff,0x84a8952c,0xf9ffbf69,0x8cea90ec,0xa8aefe1a,0x84a89d4e,0xffbb6a55,0x88c9910a,0x5a000090,0x88a988c8,0x55f9ff,0x84a8952c,0x95a0d5da,0x84a88cea,0x50faffaa,0x84a8910a,0x95faaa00,0x84879d6e,0x5690e4e5,0x90eb952c,0x9aaf0194,0x84889d6e,0xe45f1f56,0x8cea950c,0xaa6a6f6f,0x88ca8d0a,0xfeab1b6a,0x84a88cea,0x95e5baa4,0x84a8952c,0xff6e5040,0x84a8910c,
-0xf9f965aa,0x910b952c,0x95abab56,0x8cea910a,0x1bbf95e9,0x910b992c,0xfe6a5a00,0x8cc9910a,0x56afffa5,0x808790ea,0xbf900005,0x88c9952c,0x1555bfff,0x8087952c,0xd5ff9400,0x88a8910a,0x509591ff,0x90ea994c,0xff4155a4,0x80878cea,0x9a9aff5b,0x84a8952c,0xff555595,0x80668cea,0x40559aff,0x88a8994c,0xfffffa40,0x84a890ea,0x69a9aaff,0x910aa9b0,0xffffffa9,0x8087a9d2,0x2fe5956a,0x8cc9952c,0x65e48203,0x84a8910a,0xe007aad4,0x84a8992c,0x691b1f6a,0x88a8910a,0xe9d14242,0x84a8910a,0xd5daebbf,0x88c98cea,0x1b6fbffe,0x88e9952c,0x6f2f2b39,0x8cea952a,0xfff9016f,0x88a9994e,0xfea4a4a9,0x88c9950c,0xaaffe900,0x84a890ea,0xbfcfea4a,0x84a884a8,0xa5faaa2f,0x952da1d0,0xfee55569,0x84a78cea,0x965b0500,0x8d0b9d6e,0x5b0ffffa,0x80448066,
-0xaafeff01,0x88c9992c,0xfffea555,0x84a78cea,0xfaffbf10,0x88c99d6c,0xffffaaaa,0x84a88cea,0x5aa5a06,0x950b9d6e,0xffffff05,0x8087910a,0x54aaa500,0x8d0ba590,0xabaaff00,0x806688ea,0xafff5640,0x88c9994e,0xffaf5a6a,0x808788ea,0x46ffa5aa,0x8cea910a,0xffaa5505,0x8066910c,0x55fa5595,0x952ca5b0,0xfafebf00,0x84a88cea,0x69bfaafa,0x952ca590,0xebff1600,0x8088954c,0xbaffff00,0x84a8910c,0x6affffaa,0x84878cca,0x5affaf00,0x84a990ea,0x5afffea,0x8087912c,0xfa550000,0x88ca9d6e,0xa5f9ebbf,0x80668486,0xff550000,0x80449d4c,0xa06a2fa,0x88879d2a,0xfeffbaa4,0x88c98cea,0xeaffff,0x84a8996e,0x8f74d6eb,0x88c984a8,0x50ffffff,0x84a8912c,0xff550000,0x8044992c,0x90a9feff,0x806488a8,0xff550000,0x88a8a18e,0xaa50aaff,0x88a88cc8,
-0xaa6f46f5,0x8ceb952c,0xff1b5055,0x88a99d6e,0x196dff6b,0x88ca952c,0x754e5ae,0x8cea994e,0x80affffe,0x88a98cca,0xffa9aa0b,0x808888ca,0x5aaaffff,0x80888cea,0xffcebeac,0x88ca88ca,0x50f5bf00,0x84a988ca,0x50faff6a,0x8ceba9d2,0xfe175165,0x808888ca,0x6aff6a95,0x8ceb9d6e,0xfeeaff1b,0x8088910a,0xe6fafafe,0x8cea910c,0xffff1b00,0x84a9952c,0xff6fafff,0x84a988ca,0xff1690fe,0x84a8994c,0xafbf69a9,0x88ca910a,0x5590ffff,0x84a9994e,0xabffe9a9,0x84a9912c,0x6fab0101,0x910ba5b0,0x5a45f97e,0x84a9910a,0xa6f9f0a4,0x9d6fa5b0,0xa9fffa00,0x88ca910c,0x40ffafab,0x8cea952c,0xfe6fea5a,0x808888ca,0xfefae6ff,0x88ca910c,0xfffeff91,0x88c98cea,0x61bd6d5,0x8ceb994e,0xaaffff00,0x88ca994c,0xac6e6f6f,0x88c9910c,0xe59ffff8,0x88ca8cea,
-0x6b0055d0,0x806788ca,0x5516f9ff,0x84c9952c,0xb964e6bf,0x84a98cea,0x94ffff,0x80878cea,0xff6b0055,0x84a8994e,0xffb1eaff,0x84a984a8,0x6f505506,0x84a89d6e,0xb9a4aaff,0x84a98cea,0xaaf9bf01,0x8088952c,0xe4afaf5b,0x808888c8,0xf9bf0590,0x88c99d6e,0xff55aa6a,0x806784ca,0x50ba5500,0x910ba190,0x9646fe6f,0x806788ca,0x556a95f9,0x88eaa9b0,0x56f9bf05,0x84a9910c,0xafbfffaf,0x84a9910c,0xffff7f6a,0x910c952c,0xaaffbfff,0x84c988ea,0x6e7e5440,0x8d0c952c,0xfafef9fa,0x910b952c,0xfbbfaaa6,0x88ca994e,0xeaeabfbf,0x8d0b910c,0xffff65e5,0x84c9952c,0xeaeb96aa,0x88ca88ea,0x90a5e4a9,0x88ea952c,0xffbf6a56,0x84c98d0a,0xafefffff,0x88ca88ea,0xffaffaa5,0x8ceb8d0a,0xff6b01ff,0x84a8994e,0xffaaabab,0x84c9910c,0x70000ff,0x8cea9d8e,
-0xaabfeeaa,0x88c98cea,0xaf165550,0x84a8952c,0xfd8caaaa,0x88ca88ca,0x564041ae,0x84a8910a,0x555a5aff,0x88c99d6e,0xff6f4055,0x8ceaa5b0,0x5501a5ff,0x88c9994e,0x2f005555,0x8ceba18e,0xffaaaaaa,0x84a98cea,0x5550157f,0x8d0b994e,0x9b4baafa,0x88ca8cea,0x1aaaf4e0,0x8cea952c,0x40ffff,0x80668d0a,0xa55555,0x912ba5b0,0x94f9bf1f,0x80a888c8,0x54fefa55,0x994da5b0,0xbfa8ffff,0x88c98cea,0xfebfbfaf,0x80888d2c,0x5606aaff,0x808788ea,0xaf1a0605,0x80668cea,0x6f400090,0x912ca190,0x195ffff,0x8044954e,0x55a4fe,0x88a9add2,0x6dffff0b,0x8088954c,0x55a5ff1f,0x80878cea,0xaa40f4a4,0x84a9910c,0xa5ff1b00,0x88caa18e,0x1e9ffaa,0x84a89d6e,0x40e9ffff,0x8487994c,0xfebf0600,0x88eaa5b0,0xfe8bea7f,0x806784a8,0xb4140e4,0x8d0ba5d0,
-0xbffe6a06,0x88ea994c,0xe8feffab,0x84a888ca,0xeaff00e0,0x84a98d0c,0x46ffffe9,0x88a89d4e,0xff5b5594,0x806784c8,0xa9ffafe9,0x910b994c,0xeae56907,0x80468cea,0x6a01eaff,0x84a8950a,0xaf1bf9af,0x88ca88ea,0x55ffffff,0x84a8a1b0,0x4154e6bf,0x84a8910c,0xa5ff5b06,0x84c98d0a,0xbf6b5000,0x8d0ca9d0,0x9095ffff,0x804588e8,0xa5faa450,0x996ea9d2,0xff6e0755,0x8066952a,0xbf064094,0x8ceaa5b0,0xe5ffaafe,0x84a9994e,0x50f9aaf9,0x996dadf2,0xafeabe0b,0x80a98d2c,0xffff1b00,0x84a8adb0,0x50e5ffff,0x8087a5d0,0x2f46e0fe,0x88c9a1b0,0xff8fefff,0x808884a8,0x6affaf06,0x952c9d4e,0xbe1b4094,0x8d0ba1b0,0x691a81fd,0x88c9992c,0x40f9f9ea,0x994e9d6e,0xf4beffff,0x8087994c,0xfa7f1f80,0x84a8952c,0xd6aa6f0b,0x8066996e,0xf24beea,0x88c98cea,
-0xbffed580,0x80ab890e,0x1f1f6f7f,0x80688d2c,0xaaab5a16,0x88eeaa18,0xf0e0e0e5,0x8d109550,0x5f1f1f1f,0x84cb9970,0xf0b0b1b,0x890d9970,0xf8f4f0f0,0x84ed8d4e,0xf4f8b4b4,0x890d9570,0xfffa9540,0x80aa8d32,0xfbcfffff,0x80aa80aa,0xffff9a46,0x80a8850a,0xfbfbfffb,0x808680ca,0xd5e6ebfb,0x80aa8d2e,0x9bea9191,0x80aa8d0c,0xdbfffbfb,0x84ca88ec,0x4b8b4b8b,0x808988ca,0x1f1f1f0f,0x84a9952e,0xaa7e3e3f,0x848a8cec,0xe0e0f4f4,0x88ec8d0e,0x60e0a0e0,0x8d0e9550,0xaae5e0e5,0x80678cec,0xefefbeaf,0x84a88486,0x5f5ba6b5,0x84a8910c,0xfeebb9af,0x806784c8,0x9797db9b,0x808a88ca,0xf4ffff9b,0x84cb88ec,0x8fdfdf4b,0x8088848a,0x6fafafaf,0x846788a6,0x9691f5f4,0x84cb88ec,0x5bab7965,0x88ca9d4e,0xeaeeff6f,0x806780a8,0xf99aeaea,0x808788aa,
-0x9b5f1f1e,0x84cda590,0xf1e1d297,0x8089992e,0xafafaea9,0x806784ee,0x3f7fbfff,0x84aa9950,0xe2f2e2f1,0x8089952e,0xa6bbb6b2,0x84a98d0c,0x474b1b2f,0x84a9910c,0xf1d1d182,0x8068952c,0xd1960606,0x84aa994e,0xbdb8f4e1,0x848a910c,0xaf9f5954,0x808984ca,0x1f6fffeb,0x80898d0e,0x2f6ffefd,0x806890ec,0xe1d3871b,0x8489950c,0xf8f08107,0x8489910c,0xfa8b9fbd,0x80478488,0xabbfbfaa,0x808980ca,0xf9a9eaee,0x846a8c86,0x7cbcb5b1,0x808890ec,0xa6bebfff,0x808880a6,0x6baabbf9,0x84a68868,0xdbe6ff1b,0x84aa84ca,0x9596aad6,0x808688a8,0xe1e28180,0x808988ca,0xece4e4f0,0x806784aa,0xbffeead6,0x808688c8,0x6f7fbfff,0x8489a12c,0xe0fb6b1b,0x99719db2,0x6f6f6f6f,0x8089912c,0x1f2f2f2f,0x88caa5b0,0xd0e0e0e0,0x890fa5b2,0xf4e0e0e0,0x80668cea,
-0x9b6fffff,0x80888cca,0xafaaa696,0x806888ca,0xaaaa96fa,0x808788a8,0xba1efaaa,0x84a984a8,0x4095ffff,0x84888cea,0x1b654480,0x952da5b2,0xfe6f5ffa,0x806788aa,0x6469f9f9,0x88ec994e,0xeabe2f1f,0x80678cea,0x4ad4ffaa,0x84a98488,0x79190e4,0x84889d6e,0xafe77e2f,0x80678cca,0x5b55a983,0x806788ca,0x40a4be6f,0x808888ca,0xa5d9baaa,0x88a984a8,0xbf1b9155,0x806888ea,0x8094fe2f,0x8046912e,0xbbbf1605,0x8d0d912c,0x7e1f4190,0x84ca996e,0x5556dafe,0x8cec9550,0x59ae6f7f,0x8cec890c,0xef460145,0x80898cca,0x50febe6a,0x8d0c8d2c,0xff5519fe,0x8ceb88ca,0xf0fdba1a,0x912d954e,0xe9be0b47,0x84ab9550,0x565f95f9,0x80cb88ec,0x7d0a5ae,0x8cee9950,0xfe9a9595,0x8cea950c,0xfffdffff,0x88ca8cea,0xfffffa1f,0x8045a14c,0xbf0155ff,0x84ca910c,
-0xbeffafef,0x80888cec,0xeae6f0f8,0x8067910a,0xe0e0e0e0,0x8088910c,0xe1e1e1e0,0x84889d4e,0x75a6eaea,0x808884a8,0xa5b9f675,0x84aa88ca,0xdbe7e2f2,0x80a9996e,0x55a6a6df,0x84aa8d0e,0x2f1f1f1f,0x80889d70,0x7f2f2f2f,0x80888cec,0xad69b9b9,0x80688cea,0xd9889dad,0x80aa88ec,0x5fafafaf,0x84ca88ec,0xaa6f7f0f,0x84cc84ca,0x1f2faffa,0x80cb912e,0xeafe7e1f,0x84cc9150,0xd6faafa7,0x808984cc,0x949bbe5f,0x88cc910c,0xbf06aaa6,0x808984ca,0x565bf4fd,0x84a98cec,0x7f0b4140,0x84889d4e,0xc1a5eeff,0x80648088,0x50f9beaa,0x952e9d92,0xfbfe1f02,0x8065994a,0xaaf49aba,0x84aa88cc,0xf0bfaf9b,0x808988ca,0xaaafbfaa,0x84cc910c,0x5f0155aa,0x84aa88ca,0xf9fe5a96,0x8cec910c,0x5b91e4e0,0x8ceca190,0x795febf,0x80898cec,0xa9fffbba,0x912f9952,
-0xbbefa540,0x808a8d32,0xf4e0421f,0x848a9d2e,0xe05b3a41,0x84aa912c,0x9187bff8,0x808784a8,0x5a0b5fbe,0x80678488,0x172ebffa,0x84aa912c,0x2ea9d6a5,0x808888ca,0xf4f4d146,0x88cb912e,0xffffa851,0x8087890c,0xe546a9ab,0x806680a8,0xbfbf5a05,0x848884aa,0x1bfefafe,0x80898d0c,0xa441076f,0x80aa88ec,0x1a6faffa,0x80aa88ca,0xbffea440,0x84ed954e,0xe000066b,0x80aa88ec,0xf8f4a002,0x8d4f9992,0xef4f99f4,0x84ca890c,0x861b2fa9,0x88ec8d2e,0x5f4fdae0,0x80458488,0x9b9afefb,0x802280a8,0xaf1b4397,0x80898d0c,0xaa46fffb,0x80438464,0xa5a0fafa,0x84ca952e,0xbff98001,0x80898cec,0xaabaffff,0x88888ca8,0x6f466ffe,0x806784a8,0x41aafbea,0x848a84ac,0x6f5a6b6a,0x802380a8,0x65e1b6f,0x806784aa,0xe5f9f500,0x80a988ca,0xa4f9a451,0x808984ea,
-0xea5a0000,0x804684ca,0x90552fff,0x848a910c,0xfffa5400,0x8068890e,0xfff9d0af,0x84cb952c,0x6bfeae5,0x80ee8d50,0xbfbff440,0x84a88cea,0xf8551b6f,0x84cb9550,0x4101afff,0x806884aa,0xfaffe540,0x808984cc,0x1bffbfea,0x88ed9550,0x6a6bff55,0x84ab912e,0x40161aab,0x850e9550,0xfffe9000,0x8066910c,0xf9be0606,0x80ab8cec,0xf0b6af9,0x802588a8,0xeb0a192e,0x80ab84ca,0xaae57ebf,0x80a980aa,0xaaabffff,0x808888ca,0xfefeaa55,0x84aa84ca,0xaa7ebfff,0x808884aa,0x2e7f6955,0x84cb8cec,0xeac78600,0x806880aa,0xb8e9dad5,0x806884ca,0x161b1f6e,0x84cc9550,0x864696a9,0x808984aa,0x7ffdf9d2,0x808888ca,0xbffefebe,0x8089912c,0x50151b1f,0x8cea9d70,0xe0a71b2f,0x890d954e,0xbdb8b4e0,0x84cb910c,0xc7d6f4a4,0x808884cc,0xb9a0f5d6,0x80678088,
-0xa80a96fa,0x808984aa,0x1bfdf4d0,0x84aa8cec,0xbffdfeab,0x88cb88ec,0xbdafebeb,0x808984aa,0xe0f4f566,0x8d2d914e,0x2f1b14a1,0x8d2ea1b0,0x4bafebd0,0x808880aa,0xfee94145,0x808888ca,0x6affaa06,0x84cb8cec,0x69afbf7f,0x808988ec,0x808baaa5,0x808984aa,0xd5d59581,0x804780aa,0x7f7f6f6b,0x848988a8,0x666b5b6e,0x848888aa,0xd5d5d5d5,0x80468ca8,0xd5d5e9e5,0x802584a8,0x1a19adbf,0x88eb912c,0xd1570f2b,0x8d0c88ec,0xa0e0efff,0x88ec8d0c,0x2b271060,0x890e8d2e,0xbe6b5745,0x808888ec,0xbf1b03e0,0x84cb8d0c,0x1556969,0x88ec8d2e,0xd6b97e5b,0x808988ca,0xe78bb7b6,0x80aa80aa,0xe1e4f5e6,0x80aa88ec,0xe0e0d1d5,0x80258cca,0xe0e0e0e0,0x8046910a,0x94e5e5e5,0x80aa8d2e,0x9b4694e1,0x808988ca,0xc7c7d6e1,0x8487952c,0xbf7f6f6b,0x84aa950e,
-0x2f6fbefe,0x80888d0c,0x71b1f2f,0x890ba190,0xf4f4a451,0x9150a1b4,0xf9f9f4f4,0x8d0e9972,0x1a060707,0x89319572,0x6a6a5a1a,0x85109d8e,0x6d79f9f9,0x88cc910e,0xaa7e7e2d,0x88eb8d0c,0x4b0f6fbe,0x84aa8cec,0xd1d29647,0x808988ec,0x5f9eaebe,0x804584a8,0xab6b5f5f,0x806584aa,0xf4e0e5e6,0x848988ca,0xfefdfcf9,0x808788aa,0xba6b6b5b,0x84898cc8,0xe596aafa,0x806588a8,0x6b7b2a6a,0x916fa5b4,0x1b17576b,0x84c6a192,0xf8b8f8f9,0x84aa890e,0x90e0f4f8,0x8ceea170,0xbf7f6f5f,0x8487950e,0xe8edfffb,0x806788ea,0x10505090,0x954fa592,0x1f071611,0x88ca9d6e,0x6f6fbfbf,0x806688a6,0x5f5f5f6f,0x806484a8,0xeeeef5e5,0x888788a8,0xfefefefe,0x88aa8cca,0x7e6f6f5f,0x806680a8,0xf8f9fdfd,0x80888cea,0xf8d0f9fd,0x84a984aa,0xfefffafa,0x84aa84ca,
-0x7f06e4ff,0x8488994e,0xbe01eaf9,0x808884a8,0x1f9ffff,0x80888d0a,0xbe50ffaf,0x848884a8,0x195feff,0x84a99d6e,0xfeff0540,0x84a9994e,0x50feffab,0x8088992c,0xff1b0000,0x88caa16e,0xfdfffe9a,0x84a988ca,0x96fa92d1,0x808888ca,0xfbe6aeff,0x808884a8,0xbebfe5e6,0x80a884ca,0xfeafaaaa,0x806784ea,0x1b000090,0x84a99d6e,0x5b015afe,0x80a98cea,0xa5f9ff,0x88eaa5d0,0x96d665a9,0x808888ca,0x81cf46d6,0x88ea88ea,0x1f81e9ff,0x8067910a,0x55fffefa,0x88ca8d0c,0xff010101,0x80878cea,0x5094ff,0x954dadf2,0x5a000000,0x80a8910c,0x50a5eaff,0x8cea9d90,0xf8ffffff,0x8488994e,0xfebf1f81,0x88ca994e,0xefc6ff1f,0x84878488,0xb80e4be,0x8088952c,0x80e0a0e9,0x88eb912c,0x690aff5b,0x88c98cea,0x46effebf,0x88ca910c,0x45ffaf86,0x84a988ea,
-0x1f1f5691,0x88ca994e,0xf686fbbf,0x808884a8,0x5040eaea,0x80678cea,0xffb6bebe,0x84888cca,0x5102afb,0x84ca88ec,0x54faff6a,0x84c9996e,0x4fdff,0x84cb8d0c,0xfebf5655,0x84c9912e,0xeaeaff3f,0x804584a8,0x1a0f4b9,0x84a894ea,0xbf2f0250,0x84879d2a,0x404bebfe,0x80238066,0x40a9ffab,0x80aa8d2e,0xffaa0106,0x84c98d0c,0xa5ffafaa,0x84ec8d2e,0x96c5f9b9,0x80a880a8,0xffffaf00,0x84a99d4e,0xfcafabea,0x84a988ec,0xffbf0150,0x80a99d6e,0x6bfafaff,0x8ceb912c,0xa6f68ae0,0x84ca912c,0x6e02015a,0x80a88cec,0x6aabbf6f,0x80a9912c,0xe09455,0x88eb88ea,0xff0190fe,0x8089954e,0x55aaaaff,0x88ca954e,0x6d0fefa,0x84a9910c,0x55aafaff,0x88ca994e,0xfafe5500,0x8d0c910c,0x2e6faaf9,0x84ca88ea,0xafea5500,0x84ca8d0c,0xf4e5aa06,0x84ca88ea,
-0x9af91f01,0x84a9996e,0xff2a5595,0x84a98d0a,0x7f160000,0x8ceba5d0,0x5640fafa,0x88c9912c,0xaabf1ae5,0x912c996e,0x1b405495,0x8cc8a5b0,0x81d0f9bf,0x88ca996e,0x50f96a5a,0x994ea5b0,0x5090e0f8,0x952d996e,0x41e5ff0b,0x84c9912c,0x55ff6f07,0x88ea952c,0xfebf0150,0x84c9954e,0x6f0b0755,0x84c9910c,0x9aebf9fe,0x8ceb996e,0x50f0f4f9,0x952d954c,0x6f5f0601,0x88ea994e,0xc1e4ffff,0x8067910c,0x9afe1b06,0x8ceb950c,0xbfffff06,0x8088992c,0x2f41e4fd,0x88a9950c,0x1f56d068,0x8d0ba18e,0x4080e57f,0x80878cea,0xa4bebfbe,0x910c954e,0x7e2f0780,0x84ca9d6e,0xfebf0640,0x84a9952e,0xf8feffea,0x84a88cea,0xffa0a4bf,0x84ca8d0a,0xafffffff,0x88ea8d0c,0xba2a06d1,0x88c9912c,0x90b8feeb,0x952d996e,0xe0b87e5f,0x80a8910c,0xba7f1f87,0x910c996e,
-0x7e0680f4,0x80a988ea,0x1f40a97a,0x84a9952c,0xe0a92f0b,0x808884ca,0xd0fee5e0,0x84c9910c,0x5556aaff,0x88ca912c,0xe9da4040,0x954d994e,0x95f9bf06,0x84c9952c,0xffbf0159,0x952d9d8e,0x9ba5682d,0x84ca88ea,0xffbabf7f,0x808784ca,0xbefffef9,0x88ea910c,0x2e29696d,0x80a8910c,0xbe9b80f9,0x88ca952c,0x6a5ac5fe,0x954d994e,0xfabbbf2f,0x84a9954c,0x80d0e3fb,0x912c952c,0xe661aaf9,0x88c98d0c,0x6abffffb,0x84ca912c,0xc380eaff,0x84c98cea,0xf0f4bc7,0x84a8954c,0x2f559081,0x80888cea,0xe1f4bd7f,0x84c9994c,0xf9be3e3e,0x84c99d6e,0x8f86e5ea,0x806684a8,0xaf47efff,0x88ca8cea,0xfebebf7f,0x80a8910c,0x6f565642,0x8cea912c,0xe6f9fdbe,0x88ea912c,0xe1f0f8fc,0x84a8954c,0x2f1f47c2,0x84a89d6e,0xba2e0f87,0x8088952c,0xb85dfeeb,0x808788ca,
-0x91f4a9a6,0x88eb9970,0xfafa2f17,0x8065890c,0xaadb7f5b,0x84cb88ec,0x1f429069,0x8488992c,0x6e0392fa,0x88c9994c,0x2fe3fbfe,0x80a9890a,0xb899ff7f,0x806788a8,0xf8bf6a6f,0x84889d4e,0xafabf8fe,0x84aa8cec,0xa4fafabe,0x910da170,0xfe6febfa,0x806888ca,0xa51f5be5,0x80cb890e,0xfe6f0600,0x8068912c,0xaa4095f9,0x802488ca,0x6a4a4a4,0x914ea9f2,0xeaeaff1f,0x8087912c,0x90fffaff,0x8088912c,0x1feff1b,0x890c914e,0xffff1f41,0x80a9912c,0x416f1bd0,0x84cb8d0c,0xfeab5500,0x8089912e,0xaffb1a40,0x84a9994e,0xffaa5555,0x84aa890c,0xbf0600a9,0x80a9954e,0x1f91f8ae,0x84c9a190,0x2ea5f97f,0x84cb8d2c,0xf8bfefee,0x80a9910a,0xbd2f02d0,0x84cb996e,0xff164665,0x80ca88ec,0x150a5fe,0x88ec996e,0x5a4082e5,0x80ab80ea,0x555ffff,0x84ca996e,
-0xfafeffe2,0x84ca8cea,0xe5a4bfbf,0x808880c8,0xffffbf3f,0x84a9952c,0x5f4696ea,0x806888aa,0x55febfeb,0x952da5b0,0x6f5b0500,0x8ceba590,0x6d5faff,0x84a9910c,0x10feb910,0x9990a1d2,0x92e1f0f8,0x80888cec,0x6ab92f5b,0x84aa88ca,0xebfbf7be,0x84a98cca,0x81d5b9aa,0x80a980ca,0xbfaf6f5a,0x808884ca,0x5587e5fc,0x84ca912c,0x2ffe9140,0x84ca88ca,0xbe4f0f0b,0x804784aa,0x5a81eaff,0x808880ca,0xd0f8bf6f,0x84ca952c,0xfa6f1b01,0x80a9954c,0x579aa9fa,0x80a9912c,0xffff2d83,0x84cb912c,0x40febfbf,0x80aa8d0c,0xfbfa2d02,0x88eb8d0c,0xff0640fa,0x808888ca,0x16545000,0x954d9d90,0xe5fa7f1b,0x80a9954e,0x40a9f9e4,0x84ea912c,0x6ff21400,0x954d996e,0xffff5004,0x8d0d912c,0xaa40aeff,0x80a984ca,0x16d6f47f,0x80898d0c,0xd63ebe2a,0x84ca8cec,
-0x4196abab,0x84c98d0a,0xadaffff7,0x84a984ca,0x2fbfeaff,0x84a8912c,0xeafabe7e,0x84a98d0a,0xe0f4f8fc,0x80a8910c,0x4b8bd3d2,0x84a9996e,0x2f1f1e9b,0x84a98d0a,0xbf7f7f3f,0x80a9912c,0xe9ffff1b,0x8066950c,0xbfbbe590,0x80a988ea,0xff2f0100,0x88a99d4e,0x101aafe,0x8045910c,0xfdbeafaf,0x80a888c8,0xf4f8f8fc,0x80a9954c,0xfafaaa16,0x84a984ea,0x6a3e57e6,0x84a988ea,0x762e1e4a,0x84a99d6e,0xdbeebd7a,0x88ca910c,0xf8fdfdfe,0x80a9954c,0xe2e1e0f4,0x8088912c,0xf4fcfffb,0x84c9994e,0x2f1f92e0,0x84a99d8e,0x1b4b87c7,0x84a988ca,0xf85e5f5b,0x84a888ea,0xc3d2e1f0,0x88ca954c,0xb4b47c3,0x80a9952c,0x3bafaba6,0x88ea9d6e,0x9e6f7f3f,0x84a9912c,0xb96e2f1f,0x80a8910c,0x96a1a5b4,0x88ca88ea,0x78bdaeae,0x80a8952c,0xefeae574,0x88ca912c,
-0x1906500,0x8d0b9d8e,0x5a4bf2f,0x80668cea,0x69be10e4,0x954d996e,0x2f065054,0x84a8a1b0,0xfbfb9180,0x80ca8cec,0xe594a9ff,0x80a988ca,0xe740e1ff,0x806788ea,0xff162fbf,0x8d0c8cea,0x540f8ff,0x84a8954c,0xf4f9a455,0x954ea1b2,0xf9beafba,0x8087890a,0xaa3a01c0,0x8d0c9970,0xfe2e0b42,0x8487954c,0x5aa9d0f0,0x8088910c,0xd1f8b9be,0x952ca5b0,0xfe7e1f92,0x84a8994e,0xc86aaaa5,0x8cea952e,0x6165fec4,0x84ca910c,0xe255aaff,0x84898d0c,0x4b8bdbe7,0x88ca996e,0x5291faf5,0x8cea912c,0x7e7f7e53,0x954d9d6e,0x7d6e2f1f,0x88ca9d8e,0xe5f9b97d,0x88ea954e,0xa6bdbe6a,0x88eb8d0c,0x6e5f4b47,0x80a98cec,0x1041c1e9,0x804688ea,0xf9feea55,0x910c954e,0xe0e0e4fc,0x80a8952c,0x26261094,0x912c9d6e,0x5f9796ae,0x84ca8cea,0xed5e5e0f,0x806684ca,
-0xfafed0d1,0x8cea910a,0xe787d7ea,0x84a88cea,0x7fbfefef,0x88c990ea,0x479b9b6f,0x8ceb994c,0x96e6e2e6,0x84a88cea,0xfaeaeaea,0x84a888ea,0xb6bb7f6b,0x8cea994e,0xb6faf6e5,0x910b952c,0x2a55ab6f,0x88c89d4c,0x69bab529,0x994da16e,0xf4fd6ffe,0x806690ea,0xfaf95500,0x910b9d8e,0xfefeaa69,0x952d916e,0xfeafffff,0x8cea8d0c,0x7fbffefa,0x88eba18e,0xbf7f7f7f,0x88c9a9b0,0x8bd6d6fa,0x84a98cea,0xbe6f1f4b,0x88ea952c,0x5f5b5766,0x84a8910c,0xe9f8beaf,0x80878d0a,0xe0f4f8,0x9d6ea5d0,0xfe2e0b01,0x88ea9d6e,0xee2f6fdb,0x8d0b994c,0x106494e5,0xa5b0ae12,0xbaf9f9fe,0x8cea910a,0x97565aaa,0x84a888ea,0xdafbffbf,0x84a88cea,0x97beb5da,0x88c98cea,0xd1f9bfbf,0x808788ea,0x50f9be5f,0x996ea5b0,0xaf065545,0x808784c8,0x1a42e5fe,0x84a9954c,
-0xffffb9aa,0x80658466,0xb1f6ef4,0x8cea994c,0xafefae6f,0x8087910a,0xf4440006,0x88ea9d6e,0xe0e59102,0x8d0ba1b2,0xd0d0d0e0,0x8086996e,0xaf8b9ffe,0x808784ca,0x2f2f2f2f,0x84a8996e,0x55fffea5,0x84a8994e,0xffa90055,0x80879d6e,0x55ffffea,0x84ca994c,0xff6a0055,0x84a8a190,0x516bffff,0x8cea9d6e,0x54e4e0d0,0x996da9d2,0x5655afff,0x88ca994e,0xee5faf5b,0x80878d0a,0xb92d1d0,0x88caa18e,0xfafe3e1f,0x80a8954e,0xeeffbf2f,0x808788ca,0x4fe2f4fc,0x88ca9d8e,0x66e0a9aa,0x88c988ea,0xe0be6faa,0x80878d0c,0x50ebfe7f,0x88ea952c,0x9b014541,0x808788ea,0x2f020000,0x88eaa1b0,0xfeafffff,0x80a88cea,0xe0f9b8f9,0x84a8912c,0x9aeafae6,0x84a98d0a,0xf96f02e0,0x84a9996e,0x2e9aaaa,0x80a8952c,0x1be0feaf,0x84c9952c,0xf9ffbeff,0x88ca9d8e,
-0x59fdfd,0x88c9912c,0xfef95650,0x88ea910a,0xf4fa2f0b,0x80a8994c,0x1f6fa9f5,0x84c988ca,0xe9bebfff,0x8087912c,0xff6a0190,0x8087a190,0xfffaaa8a,0x84c984c8,0x2f80f4ff,0x84a8a1b0,0x2f510000,0x8d0ca9f2,0x5595fabf,0x806684ea,0x10fab9a5,0xa5b1adf2,0xf9fe6f41,0x84a9996e,0xffe690aa,0x84ca8cea,0x40feffff,0x84c9954e,0x9b576aaa,0x84a888ea,0x56ab6e6f,0x8ceb8d0a,0x1500f9ff,0x890a9d6e,0x5a550054,0x956fadf2,0x94ffff,0x84a8954c,0x1014055,0x9d6fa5b0,0x55ff,0x8045910c,0xd1fb5500,0x88ea8d0c,0x50faff,0x88ca912c,0x9bf56914,0x910c954c,0xa4bebf5b,0x84a98cea,0x5555,0x954da5b0,0xff560100,0x8087910c,0xa9a5,0x994ea1b0,0x4055ff5a,0x80a8952c,0xf9e6a955,0x8d0b952c,0x55a5ff55,0x84a9996e,0xff7f1a15,0x88ea910c,
-0x54bf0601,0x954d9d6e,0xbf060001,0x88caa5b0,0x5905a0fe,0x84ca994c,0x1a595a5,0x994da9f2,0x550595ff,0x80a98cea,0x15feaa56,0x8d0b912c,0xa9a5febf,0x84ca954c,0x64cfff6a,0x912c912c,0x4595ff6f,0x80878d0c,0xa5fefeaa,0x9d6fadf2,0xfaffaf00,0x84a89d6e,0x56ffffaa,0x954da590,0xfffebf01,0x88ea9d8e,0x55ff1b40,0x88ea912c,0xffff0100,0x80a9a1b0,0xaaab00fe,0x88ea996e,0xff550000,0x84c9994e,0x5afe,0x952da5b0,0xff551000,0x8d0b954e,0x1ff,0x84c99d8e,0x555affa9,0x8088912c,0xbf540040,0x88ca912c,0xb531fffe,0x8d0b8d0c,0xbee9a555,0x84a9996e,0xff554040,0x88ea912c,0x950000bf,0x88eaa1b0,0xff555555,0x84ca954c,0xff9400aa,0x84c99d8e,0x1500aaff,0x80a888ea,0x40afae55,0x84c9912c,0xaaff,0x84ca88ea,0xa99a5600,0x88ea8d0c,
-0x95ff6f07,0x80a98cea,0x6f000000,0x80889d6e,0xfe170295,0x808788ea,0x54a991e8,0x8d0b9d6e,0x101eaff,0x84a8994c,0xff650101,0x8d0aa5b0,0xe8f97f07,0x8087912c,0x82d4d1d4,0x88eaa190,0x1b00a5fa,0x80a98d0a,0x46a5febf,0x8cea912c,0x4094fabf,0x84c9910a,0xf55f0201,0x84a8910a,0xbf068004,0x88ea954c,0x4b0b9bfb,0x84c9912c,0x15bd6aa5,0x996ea5b0,0xf4fd6f5b,0x8d0b996e,0x9b0656eb,0x808788ea,0xbfabd2e7,0x88ea994e,0xa2e0fa9b,0x8d0c952c,0x55a76bbb,0x8d0b8d2c,0x90af5a6a,0x88ea912c,0xff5baa16,0x8cea952c,0xaafba954,0x88ea8d0c,0xff69aaf8,0x80ca8d0a,0xfaffab07,0x910c996e,0x99afd0e5,0x88ea910c,0x6b6b5ae4,0x88eb954c,0xfebeaf6b,0x88ea910c,0xea8a9645,0x80a984c8,0xbfe9aaaf,0x80a888ea,0x6ffffefe,0x80879d6e,0xfaffa606,0x84a88d0a,
-0xfe6f0600,0x8087a1b0,0x5b4140e5,0x80678d0a,0x694e4f9,0x88c9a5b0,0xa9e6aa1b,0x8088956e,0x1050f9bf,0x890b996c,0x5b561500,0x9d6eb234,0xf99b479a,0x808788ca,0x95d1d0e0,0x952da5d0,0xbe2fafff,0x88ea8cea,0x2f5690f4,0x84a9a5d2,0x41f8ffff,0x8d0b912c,0xfc7ebf47,0x88ea912c,0x95d6e0be,0x84c9952c,0xaf5f4b07,0x808788ca,0x2f0b82e0,0x84a9996e,0x86e5f57e,0x80888d0c,0xe5eabe6f,0x8087954e,0x9b8086d1,0x80a888c8,0xabf92955,0xa1b0b214,0x3f2f1f5b,0x8488996e,0xd0c18257,0x8065952a,0xebeaafe4,0x806588ea,0x6f3f3f3f,0x84a99d6c,0x55015f5f,0x8ceb996e,0x91e5e8f5,0x8d0ca18e,0xb5b5a555,0x996ea190,0xbe1f0f87,0x808784a8,0x8adeeafe,0x84a98cea,0xf4b9a5a1,0x994d9d90,0x7f7e7db5,0x912c996e,0xd1868686,0x80a8952c,0xf4e4e5d1,0x80888d0a,
-0xffff01a5,0x80a89d8e,0x41afbfaa,0x994e954c,0xffff405a,0x8088994e,0xa5ea576a,0x994d9db0,0xffaa0040,0x8088a1b0,0xff0194ff,0x88ea954c,0xffaa0055,0x80a9a18e,0xe600aaff,0x84c9912c,0x6fffe940,0x80a8910c,0x5affa901,0x954da5b0,0x52ffeea,0x84a9952c,0x15fffaa5,0x9d6fb234,0xfffe0005,0x84c99d8e,0x7fb46aaa,0x8d0b8d0c,0xabffe400,0x80a8994c,0x44aca9aa,0x88eb88ea,0xffa54005,0x84c9912c,0xafff901a,0x80a9954e,0x5b6fbde8,0x84c98d0a,0x6a6fbf68,0x8ceb8d0c,0xa4e4aaaa,0x88e98d0c,0xd6560154,0x84ca8d0a,0xafffa6fb,0x8d0c952c,0xfff99056,0x84c98d0c,0x500051ff,0x88eb954c,0x156efae5,0x88ca912c,0x95e9faeb,0x88ea8d0c,0xa4b9bfbf,0x8ceb910c,0x90660101,0x912c994e,0x566ffff5,0x84c9910c,0xffd04044,0x84c98cea,0xa595abbf,0x84a9912c,
-0xf9e09baf,0x8ceb954e,0x1a1bfa,0x996ea5b0,0x6ffff9ff,0x8d0b994e,0xfee4411a,0x80a89d8e,0x161bbff9,0x8088912c,0x5a5baa55,0x88ea8d0a,0xf955aaaf,0x88ca910c,0xbef9066f,0x8ceb912c,0xf99b0b1b,0x88ea952c,0x5b5b7fb9,0x808884c8,0x4a4faebc,0x808784ca,0xf9954554,0x88ca8cea,0x2ffee9aa,0x84ca954e,0xbafffd00,0x88eb952c,0xd0422ffe,0x84c9954e,0x95c66ffe,0x88cb8cea,0xffffffaf,0x88ea8d0c,0x5b5a69a5,0x8ceb88ea,0x6affffff,0x88eb8d0c,0xeb800006,0x808988ea,0x5baffe5a,0x80a88cea,0x55aaaa56,0x84c9952c,0xa9101bbf,0x88c9952c,0xbff896a5,0x84a88d0a,0x5040aaaa,0x84a988ca,0x1fbff9a4,0x84a7952c,0xbea99695,0x808988ea,0xe0d1472f,0x84a8994e,0xfae54000,0x88a7950a,0x1eaffff,0x8065912c,0x475bbff9,0x848788a8,0x156f7f9f,0x806684c8,
-0x572f7df4,0x84c9910c,0xf5c1454a,0x84a98d0c,0xf9849456,0x84a88d0c,0x20b1f7e,0x88eaa190,0x1b2f7eb9,0x84c9994e,0xf0a09243,0x952d954c,0xe5a45010,0x8d0d9d8e,0xc6d6f9e5,0x88c9954c,0xf0fafafa,0x88ea952c,0xbd7dbcf8,0x80a8912c,0xebffffaf,0x8ceb8d0c,0xfeede9ea,0x88ea912c,0xf1f1f6e,0x84a8910c,0x1f1f1f0f,0x88ea952c,0xf9f87479,0x996e9d8e,0xd5808065,0x88ea952c,0xb5b9f8f4,0x912c994e,0xb9fab9b5,0x910c994c,0xc5d6c7c7,0x84a9994e,0xc1c6c5c5,0x88ea910c,0xf4f4f9f9,0x910b994e,0x50e0e0e0,0x9d6ea1b0,0x8786c6c6,0x88eb952c,0x1a1f4b07,0x952d9d6e,0x5bab5f5f,0x88eb952c,0x9786474b,0x8067912c,0x6eaefafa,0x88c9912c,0x1f6f2f2e,0x8d0ba5b0,0x9b479797,0x804584ca,0xf4f9fef,0x84ca8d0c,0x6f6f1f1f,0x914dadf2,0xe9eaab5b,0x8d0b994e,
-0x961f7ffe,0x84c9994e,0xefffffeb,0x8d0b952c,0xbff8900a,0x84c9994e,0xfb8796bb,0x80a888ea,0xaad6d100,0x84c9912c,0x1b1f2f7e,0x8ceb9d6e,0x1071fbe,0x84c9994e,0xbdf4a004,0x8d0b954e,0x419bbff8,0x88ea912c,0x61fbff9,0x84c9912c,0x7ffababb,0x84ca912c,0xfef8561b,0x88ea912c,0xa4f9e490,0x88ea952c,0xfa865640,0x88ca910c,0x851bbeff,0x88ca88ea,0xab6fbeaa,0x88ea994e,0xe0e0e156,0x996ea5b0,0xe0e4e0e0,0x8ceba1b0,0xab878fae,0x84a988ea,0x870f0f6b,0x84c98cea,0x6ea9e4e0,0x84ca994c,0xdb9f5f6e,0x88ca8d0c,0x6d6ab6a7,0x88c9954e,0x1b1f1e1e,0x84c99d90,0xd1976ffe,0x88ea952c,0xb2ebdf4,0x88ea912c,0xbffee591,0x88ea912c,0xa9b4e59b,0x8cea910c,0xf4f09002,0x954d9d6e,0xf4f4f4f4,0x8ceb9d6e,0x7edbcbee,0x88ca8d0a,0xb0f1f2f,0x80a888ea,
-0xf5b2240,0x996ea9d0,0xe5e93e2f,0x84a8952c,0xb0b46c2a,0xa18fadf2,0x4b754450,0xa5b0ae12,0x2f515494,0x88c9952c,0xbf06e5fe,0x88c9910a,0x90a57e1f,0x8067952c,0xfafe2f02,0x910b952c,0xf999590f,0x80a98cea,0x40d0e0f4,0x952da5b0,0x56b9bc99,0x910c954e,0x6f0b0b07,0x80878cea,0x3f650000,0x994dadf2,0xff07e4fe,0x80888cea,0x90e5f9fd,0x8ceba5b0,0xa6fd1b01,0x88ca952c,0xa5feff,0x950da9d0,0x95ff1b00,0x8cea9d4e,0xa5ffffbf,0x952dadf2,0xff5b0000,0x90eca18e,0xfe954054,0x84a990ec,0x46ffab1b,0x8cea952c,0x6beae5aa,0x88a9952c,0x9aabfe00,0x88ca9d6e,0xa6bf42e5,0x910c9d6e,0xaf010050,0x8ceaa5b0,0x5a01feaf,0x80888cea,0x15090a9,0x952ca190,0x1ffffff,0x88ca994e,0x5556ff54,0x88ca994e,0xaaffff,0x8088994e,0xbe4e7fea,0x910c8cea,
-0x95c7c7db,0x84a98d0a,0x55689090,0x88c9910c,0x1f1f1b1b,0x88ea994c,0x7e2e1f1f,0x8088996e,0xbf0f4b56,0x84a9910c,0xbf96e0fd,0x8ceb9d6e,0x95d0e5ba,0x84c9952c,0xa19e9f96,0x88ea952c,0xf4f8f8f4,0x88eaa5d2,0x90d4e0f4,0x88eaa18e,0xf4f4b4b,0x88ca910c,0xdb87824b,0x806688ea,0x2f165591,0x88c9a9f2,0x95e6fa7e,0x84c9952c,0xd4f8beaf,0x80a9910a,0x7e1b4180,0x88c9a1b0,0xe5fd5baa,0x84a988ca,0xfefeaa,0x8ceb9d6e,0xff015505,0x84a98d0c,0x59ffbfff,0x8ceb912c,0xaaff06,0x84a88cec,0xff293c5f,0x88ca84a8,0x54eaff00,0x8ceb992c,0x926f1509,0x88c9910c,0xaf505555,0x88eb952c,0x555695ff,0x8087996e,0x950595fa,0x88eb8d0a,0x5555feff,0x88c9996e,0x9aef9a00,0x84a888ea,0x96f4a454,0x84a890ea,0xfaffaa00,0x84a8910c,0x16bf9ae5,0x8087994c,
-0x4007bffe,0x80a88d0c,0xbfbfa940,0x84c98d0a,0xa9f990ab,0x8ceb910a,0xe5410169,0x80a8910c,0x6efdfaaf,0x88ca952c,0x95555506,0x8ceb954e,0xa6ffff,0x8d0b954c,0xfe550000,0x80a9954c,0x6fbfbf65,0x8d0b952c,0x6fbee490,0x84c9912c,0xf4410115,0x84c9910c,0xa5556fbf,0x88ca912c,0x90fefbab,0x910c952c,0xfff94000,0x80a988ea,0xa6ffaf5a,0x8cea912c,0xabfffe94,0x808884ca,0x4146affe,0x80a98cea,0xfbab1f0a,0x88ea8d0c,0x6afdfeff,0x88eb996e,0xabfea400,0x88ca9d6e,0x64071fbf,0x8cea994c,0xf9a45050,0x88c9910c,0xa9a554a9,0x910c8d0c,0x6bfef9e5,0x84c9952a,0x6bffff,0x88ca954e,0xaaffff40,0x84c9952c,0xaaffff,0x84c9952c,0xaaffff41,0x84c98d0c,0xab03015a,0x88ea8cea,0x401bffff,0x84c9a1b0,0xaa5555a9,0x84a98d0a,0xfe4006ff,0x84a8954c,
-0x5b2fe4e0,0x808888ea,0xd1be5956,0x88c988ea,0xf8c4ff6f,0x84c984a8,0x6efffaff,0x80a8994c,0x5aaaaa95,0x84a988ea,0x55affaa,0x808784ca,0x559bfabf,0x80878d0c,0xfff941,0x84c98cea,0xffbf6a05,0x84a88d0a,0x56ffff,0x80879d8e,0xff010100,0x806684a8,0x54155aff,0x88eba18e,0xeafe5b01,0x84a9994e,0x94af5b5a,0x80a98cea,0x6f160150,0x8d0ba1b0,0xff1baaf9,0x808780a8,0x55ffffff,0x8d0b996e,0xaaabff55,0x8088912c,0xaaffffaf,0x910ca5d2,0xebfebf00,0x848794ea,0xfea9f5aa,0x88ea84a8,0xfffe00fe,0x8488a190,0xd3e9c0e7,0x84cb80aa,0x5f46949a,0x804488ea,0x56ffff55,0x996faa14,0xfeff0600,0x8486910a,0x55ffab90,0x914ea1d2,0xff5a0000,0x8064a5b0,0x5140e6ff,0x8067910a,0xfefebf2f,0x88eaa1b0,0xfaaaffff,0x806584c8,0xffffaa90,0x88ea9972,
-0x1f6fbffe,0x88c9994e,0x1f2f6b5b,0x8d2ca18e,0xf4e04007,0x84c9a1b0,0x91e1f4f9,0x8088954e,0x9be57e2f,0x806788ea,0x80f8feaf,0x84c99d6e,0x7f535014,0x8d0ba5b0,0xaf5baafe,0x808888ea,0x9baffee4,0x84a9912c,0xff075656,0x806788ea,0xfaffbbbf,0x8d0b912c,0x6a0144e9,0x84c98cea,0x546aa5f9,0x8d0ba9d2,0xaaf92f02,0x84a98d0a,0x145ffff,0x84a9954c,0xfe6b0000,0x80a8a190,0x9af96f07,0x84c9996e,0x95ffaa,0x84c9954e,0xbe6b40fc,0x88ea994e,0xfeffaa,0x88ca9d6e,0xefffaa00,0x88a9954c,0xb4aa7ebf,0x8087992c,0xbfaffe00,0x84a9912c,0xf56e58bd,0x806788ea,0x6a40ffaf,0x84c9910c,0xffffea,0x88ca9d90,0x10aafaa,0x88ca88ca,0x40ffffff,0x88ea994c,0x55aaff94,0x88ea952c,0xfe904555,0x808788ca,0xfefa6baa,0x952c994e,0x1bfef9fe,0x84a8994e,
-0x570191fe,0x84a8954c,0x95909656,0x88ca8d0a,0x566f6f6f,0x84c98cea,0x59f5d181,0x8cea910c,0xfaffaa,0x84a8952c,0xff010000,0x8cea9d8e,0xffff55,0x84a98d0a,0xaa000000,0x84c9a190,0x65b9fefe,0x8ceb952c,0x695a6766,0x8cea8d0c,0x41aaffff,0x84ca890c,0xe5400000,0x80878cea,0x56fffa,0x80a8910c,0xea000000,0x8d0b9d8e,0x54405bff,0x88eb952c,0xff940004,0x84a8996e,0x50aaff,0x84c98cea,0x55f5b46,0x910c912c,0x5510aaff,0x88ca8d0a,0xfdf98769,0x912c994e,0xffbfb96a,0x952d9d8e,0x401affff,0x8087994c,0xfe9646be,0x84c98d0c,0xffe046af,0x84a9910c,0x41006aff,0x84a98d0c,0xfaff9f41,0x88ea912c,0xeae45a5f,0x88ea910a,0x6a6f2f9a,0x8ceb912c,0x966f7aa6,0x88ca910c,0x9bfffefe,0x84c988ea,0x6f69546a,0x84c988ea,0xe6ebd69b,0x84a988ca,
-0xefefbf86,0x8cea8d0a,0x5af4e9ee,0x88ca910a,0x9a96d7fe,0x808784ca,0xfabfafab,0x84c988ea,0xbd5f5b72,0x80a8910c,0x5fc6f0f0,0x84ca996e,0xaafafafe,0x88ea912c,0xaaffffa,0x8ceb912c,0xbf2f0b42,0x84a8a190,0xbfc1daff,0x80a884a8,0xa0b4f9e9,0x994e9d8e,0x7e2f0743,0x84a99d6e,0x7f7fffff,0x88ea8d0c,0xfefebf7f,0x8d0b952c,0x95c1ebbf,0x806684c8,0xbfab9580,0x84c9912c,0xe434383a,0x84c9912c,0x5b470756,0x80a88cea,0x7f19190a,0x88ea910c,0x94e0a5aa,0x84a98d0a,0xb0b1b2b,0x808788ea,0x763b5b4b,0x84c988ea,0xf9e05415,0x84c9910c,0xa1e0f9fa,0x912c994e,0x90a4b9ff,0x8ceb954c,0x160b4155,0x88ea910c,0xa966aabf,0x8ceb88ea,0xf9fdf9f9,0x8d0b912c,0x57bfbe69,0x88ca8d0c,0xafaf5f5f,0x8ceb8d0a,0xfeeaaaa5,0x88ca8d0a,0x7f7f7fbe,0x80a8910c,
-0xb9294b46,0x88ea994e,0x14b4f6f6,0x994ea1b0,0xe5f8feaf,0x80a888ea,0x90f8bc3,0x84c98cea,0x5f6f1711,0x890ba5b0,0xe6aabf7f,0x8067890a,0xe1f0f0a8,0x994e9d8e,0x1b666060,0x996ea5b0,0x5bbffebe,0x84a888ea,0xbe2e1b07,0x80888cea,0xf9a5d2f0,0x84c98cea,0xf5f4f8f8,0x88ca954c,0x82d1d1aa,0x80a88cea,0xf4f99501,0x910c996e,0xab0747e5,0x84a888ea,0xbf6f2f1f,0x80a88cea,0x969596d6,0x80878d0c,0xeadfbfaa,0x88ea8d0a,0x6f2f2f1b,0x84ca994c,0xe6e6bebe,0x808788ea,0xffbfbfaa,0x80a888ea,0x80e0f0f9,0x84c9954c,0xc2e5e5e6,0x80a888ca,0x4b4b4b87,0x804580a8,0x90f0f0f4,0x996e9d90,0x16261511,0x996ea5b0,0xefeffffe,0x84a988ca,0xe4e89eee,0x84ca8d0a,0x1f1b1b1b,0x84a9a18e,0x6e7e7f2f,0x84c98d0a,0xe0f0e0e0,0x8d0c9d6c,0xe2e1d0e0,0x954da18e,
-0xaf9fdaea,0x84ca8cea,0x875f2fbf,0x80a8954c,0xb9f9f0f0,0x952c996e,0xbfbe7db9,0x84c9910a,0xefaef0d1,0x84a98d0c,0xffffbeaf,0x8d0b8d0a,0xff5607af,0x84c98d0c,0x56ebe5fe,0x912d994c,0xe59a9baf,0x80a98cea,0xfaf9f5e5,0x84a98d0c,0x575b6f6f,0x84a8912c,0xf5f5a587,0x910c954c,0x2f2ebebe,0x84c98d2c,0x1e2f1f2f,0x80a8952c,0xf4f4f4f5,0x8d0b994c,0xe0a0e0e0,0x8d0b996e,0xf5fa9fef,0x88eb910c,0xababaebd,0x80aa88ea,0xfaff6a06,0x8067954c,0xaabe0140,0x84a9994e,0xb81ba5b,0x80a984ca,0xa0f0e4fa,0x84a888ca,0x5f0baffa,0x8087912c,0x7f2fffeb,0x84c988ca,0xff6f1919,0x84a98cea,0x6a8685ea,0x88ca910c,0x1160a0e0,0x994da590,0x3d2f0b15,0x910da5b2,0x69bdbf6f,0x8088954c,0xd0ffbf,0x80a88cea,0xe0faf9b9,0x80878cea,0x696a1690,0x84a9912c,
-0x72b1a0a4,0x88ea910a,0x2f3e3e33,0x8cea910c,0xfebf6f1f,0x808788c8,0x7dbcfcfd,0x80a888c8,0x5b6b5f5f,0x88eb912c,0xdbcbcb8b,0x88c9910c,0xbf6e2f2e,0x84a8910c,0x707afbf,0x80a988ea,0xeafaf9f9,0x808784a8,0xd0d5d6e6,0x806784c8,0x2a69b9b4,0x952ea18e,0x1b1b1716,0x8d0ba5b0,0xd5d0e0d0,0x808788ea,0x808095d5,0x808784ca,0x1b1b1b1b,0x84c99d6e,0x2f1f1f1f,0x80889d6e,0xbdaeffeb,0x808884ca,0xf4f8f5f9,0x8088912c,0xd1e6e697,0x84a98d0a,0xffab9696,0x80a888ca,0xa6a5aaf0,0x80a9910c,0x9d00a4a1,0x8d0b8cea,0xeedeeeff,0x88ca84c8,0xefa5a4aa,0x8ceb88ea,0xaaab4641,0x84ca8d0a,0xaf4f0f4f,0x84a988ea,0x2f2f2e2e,0x8087996e,0x7e7e3e3e,0x84c9954c,0xbfaf0baf,0x88ea910c,0xbfabaeaf,0x88ea8d0a,0xbbbbba7a,0x88ca8d0c,0xbabeffff,0x84a9954c,
-0xdfeafb7a,0x808888ea,0xaef2e69b,0x84c988ca,0x1b57d1f0,0x84c9a5b0,0xfafe7f2f,0x80a89d6e,0xa4a8b9be,0x88ea910c,0xa4e4a464,0x88ea910c,0x5656aaea,0x88ca8d0c,0x2b7f6b55,0x910c954e,0xf8be6faf,0x80a88d0a,0x479190e0,0x8ceaa1b0,0x6b4aaae,0x88ea8cea,0xbdafef4b,0x80a88d0a,0x3d2e1f1b,0x88ca912c,0xd0e0f4b9,0x88ea912c,0x80d0e4b8,0x84a8994e,0x1b2f6550,0x952d9d8e,0xabfee154,0x84c98d0c,0x1b5b1b17,0x80878cea,0xba6b1615,0x910c954c,0xf9a964b8,0x84c98cea,0x6f1e1e0b,0x806784c8,0xaf6f5faf,0x808788ea,0x1f4f4f9,0x88ea8d0a,0xe0e0e0e5,0x84c98cea,0x9a958480,0x8066912c,0xeaea5555,0x84c9910c,0x5f5f0b1b,0x8d0ca1b0,0x3e3e1f1f,0x84a88d0a,0x6ed7e7eb,0x88c988ea,0xbf570206,0x84a888ca,0x7f3e3e3e,0x808888ea,0xf9fdfdbe,0x80a88cea,
-0xbfbfbfbe,0x8d0b996e,0xaab9bebf,0x8d0b952c,0xd5d6e5e5,0x80a8910c,0x46818595,0x808888ea,0xb5b5a5a,0x84ca8d0a,0xe4a86f6f,0x80a78cea,0xf9f9a956,0x88ea910c,0x562e7ef9,0x88ea910a,0x9b576716,0x910c996e,0xf0f0f5f,0x84c9994e,0x61e0d4d8,0x84ca9d6e,0x29be5511,0x994d9d8e,0x793e2f1f,0x8088910c,0xfafeaa96,0x80a88d0a,0x8c5cfcb8,0x8d0b996e,0xf2f1f0e0,0x8d0b9d6e,0xd0d0e0e0,0x84c9994c,0x5595d0d0,0x88c9994e,0xb0b0b82,0x80a788ca,0x2f0f0f0f,0x808784a8,0x7da55656,0x8ceb910a,0x1464b8b8,0x88c9952c,0xfefefefe,0x808788ca,0xfdfeffff,0x808784a8,0xc0c0d5e6,0x808784c8,0xe0e08080,0x808784a8,0x4b4b4ba3,0x84c9952c,0x3f3f1b1b,0x8088994c,0xbf6fbff9,0x8cea910a,0xba7fbfff,0x84a8910a,0xffa97f3f,0x8087910c,0x80e0f9ff,0x8066996e,
-0xaebfbfff,0x848788ca,0xe4d4d495,0x806788a8,0xf5e0e0e5,0x80a888ea,0x7bfbbffa,0x84c988ea,0xe4e4e4e4,0x8087910c,0xf0e4e4e4,0x80878d0c,0xffffffbb,0x84a984c8,0x8febfbff,0x80a884a8,0xbfffbfbf,0x84c984ca,0xbdaebebf,0x84c884ca,0xeaeaeafa,0x80668cea,0xd5d5d5e5,0x804688c8,0x6f5ab5b9,0x80a884ca,0x6f7a7f7f,0x84a988ea,0xd5e9e5d5,0x806788ea,0xd4d0d0d5,0x8087910c,0xf4f4f4f4,0x80a8952c,0xf8f8f8f4,0x8087994c,0x8aaafeff,0x88ca8d0a,0xb6a69656,0x88ea890a,0xfcfcfcfc,0x88c9a58e,0xfcf8e8fc,0x84a8910c,0xaf5b9bb6,0x84e98d2c,0x56aaeaff,0x84ca8d0a,0x567f2f1b,0x88ea952c,0xfda59555,0x80c984ea,0xe5e5e4e4,0x80678d2c,0xebeaeaea,0x80248d2c,0xbebefafe,0x84ea8d0a,0xe4f9ffff,0x80a88cec,0xfefeffef,0x84a890ea,0x3f3fafff,0x8087950a,
-0x78746450,0x8d0c954e,0xf2f1f1b9,0x912c996e,0xc0c0e4f9,0x84a98cea,0xa9a595d5,0x84ea992c,0xe2a292a2,0x912d9d8e,0x55e2e1e1,0x994ea190,0x7e656aa9,0x8cea952c,0x11397d7e,0x912c994e,0x6bababeb,0x806588ca,0x1f1f1f5b,0x806684a8,0x80f5faef,0x80659d4c,0xa999a945,0x80458ce8,0x9f8f1f1f,0x808788a8,0x6eaeaeae,0x80458cea,0xf2c35a19,0x88a888a8,0xd1a1f1f2,0x806688a8,0x50505051,0x998fa9d2,0xa0a0a060,0x9db1a9d2,0x25251515,0x954ea18e,0x7f2f2f2e,0x952d996e,0xe0e0e0a0,0x996fa1d2,0xe0e0e0e0,0x994ea1d2,0xbfbfbfbf,0x912d996e,0xb1b5faf,0x84ca8d0c,0xadaeae6e,0x804588ea,0x6e6eadad,0x806684a8,0x92d2e2d1,0x88a88486,0xa9d5853a,0x808784a8,0x1f1e6f6f,0x808788ca,0xeeeebe1f,0x808788ca,0xe4f4a979,0x84a88cea,0xbb3b3a50,0x84a98cea,
-0x6a655550,0x808784ca,0x1580e5ff,0x84a8912c,0x96fafaf9,0x84a884ca,0xf9eaaf5b,0x808884a8,0xa50069,0x88eb9d6e,0xbf006abf,0x802484a8,0x4096e5e5,0x84a7994c,0x5640aa9b,0x806584a8,0xeebf6f5a,0x84a988ea,0xff57cefe,0x84c984a8,0x47e0febe,0x84a8994e,0xff7e2e5b,0x80a88d0c,0x6e6f6fbf,0x80878d0a,0xbebf2f6f,0x84c98d0a,0x4080d0e1,0x80a88d0c,0xb9f9a450,0x84c98d0c,0xb93f96ff,0x8d2d954e,0x7554040,0x994cadf0,0x590ffff,0x84a8994c,0x55faf97e,0xa1b0b634,0x9baaff7f,0x804488ea,0xcfaf86ab,0x890d88ea,0x7f1f1650,0x84eba9d0,0xe0d0ffff,0x8066910c,0xfdefffbf,0x808784ca,0xaabf46c0,0x8d0b9d8e,0x5b7f3a79,0x80a984ca,0xc1aa2f2f,0x80878d0c,0xb0f4a5e5,0xa5b1a9f2,0xb6a1a1f0,0x9d6fa1b0,0x1b0b0782,0x8ceb9d6e,0x7f7f2f2f,0x954da5d2,
-0xfbff5f05,0x80a88cea,0x51706c9e,0x8ceb912c,0x6faaa5a4,0x84a98d0a,0x4595feff,0x80a88d0c,0x7e1f0f43,0x84caa1b0,0xfaffbe7a,0x80a9914c,0xf4f4a455,0x954e996e,0x9be6e5f4,0x914da5b2,0xa9fafabe,0x88ca8d0c,0xfeaf5b56,0x80a888ca,0xbfbbaa65,0x84c9910c,0xbfbebebe,0x88ea910c,0x4681d5f8,0x84ca912c,0xff0f3f3f,0x954e912c,0xbf5f6faf,0x80a988ea,0xe0f8f8fd,0x88ea912e,0xe090d0d5,0x80a9952c,0xab6a64a4,0x84c9910c,0x1f1f0b5b,0x84a9996e,0xdbbd6e1f,0x80a98cea,0x783d3e6f,0x808888ea,0xf0f0f4f8,0x80878d0a,0xc5c0d0d5,0x808784ca,0x46464686,0x808884a8,0xe4a4f8fe,0x912ca190,0x62bee5e0,0x9d90a5d0,0xd7d2d1d1,0x84a98d0a,0xa9e6d7db,0x84a88d0c,0xb070251,0x88cba1b0,0xaa6e1f0f,0x84a988ea,0x2e2e6eae,0x84c9910c,0xaadbdfdf,0x80ca8d0c,
-0x955a2b2f,0x80a8890c,0x1bbee9e9,0x80a88d0c,0x2f7efde4,0x84a9994e,0xa5e1871f,0x8d0c954c,0x15be9507,0x912c9d6e,0xafaa8000,0x8087954e,0x401a5565,0x8d0c9d8e,0x9696fee4,0x80a88cea,0xf4f4a1e2,0x9d6fa1b0,0x2a7fbff9,0x912c9d6e,0x1b2f3f7f,0x954da190,0xf8e4d196,0x84a9952c,0x7fe4d105,0x80878d0c,0x8146071f,0x84a9994e,0xf4820bbe,0x80a88d0c,0x3fbffef9,0x80a8910c,0xabaf6f6f,0x8d0b9d8e,0xe5f49045,0x8d0b912c,0x3e7ebaeb,0x88ca9d6e,0x474b1a1e,0x80a89d6e,0xbef9f9e5,0x84a9910c,0xdb1b3f3f,0x84a9952c,0xf4e0d283,0x84a89d8e,0x8f5fbdf9,0x80a884ca,0xf8f4e0e0,0x80a8954e,0xb1f9ebd,0x910c912c,0xe6c75b1f,0x88ca912c,0xe0f9fffd,0x912c954c,0xea864647,0x80a88cea,0x2f6fbefa,0x84a9912a,0x1b1fbffe,0x84c9994e,0x94905106,0x88e9a1b0,
-0x9e5c98f0,0x806780a8,0x6afefaf,0x80888d0a,0xfec5aa46,0x84a884a8,0xe401ffff,0x84a88cea,0xfefff9a0,0x84c9994e,0xf091476f,0x84a9996e,0x1bff5aaa,0x84a8912c,0xfabffe90,0x84a9912c,0xefabeee6,0x80a984c8,0xff90ffef,0x80a988ea,0xbf4eff29,0x84ca84ca,0xffbfbfbf,0x84ca84ea,0x50fe55aa,0x88c9910c,0xffaaffff,0x808888e8,0x25f6fefe,0x8d0b8d0a,0xbfaa6f1b,0x84c988c8,0x5b5bbefc,0x88ea912c,0x47efefff,0x8d0b912c,0xfef9016f,0x88ea910c,0xaaf9fea,0x8d0b952c,0xbdfdf5fb,0x84ca912c,0x5b0f5e6e,0x806784ca,0xf5faa6aa,0x910c912c,0xf9a4b5b5,0x88eb910c,0x6f2f0050,0x8087a190,0x64fefebf,0x952da1b0,0xb9a87dfe,0x808888ea,0xd0e6eaea,0x88ea910c,0xffbfb965,0x8d0c912c,0xd7808195,0x88ca910c,0x6fbffef9,0x84a9952c,0x1f1f1f6f,0x8088996e,
-0x91a4f8f8,0x80a884ea,0xfae5e4e5,0x84ea910c,0xff65bafa,0x84c9912c,0x746ffff,0x80a988ea,0xfafaa656,0x88eb912c,0x42466efe,0x88ea8d0c,0xbfbfaa66,0x88eb890c,0xbebebebf,0x88eb914e,0xaad4d0d0,0x848884c8,0x80819aaf,0x80888cea,0x2f3f3f3f,0x80889d6e,0x1f2f2f2f,0x84a8a16e,0x85818494,0x806684ca,0xd6c6c686,0x808888ea,0xb1f1f1f,0x84eba1b0,0x47474707,0x8d0b9d90,0x1bafe7d3,0x84ca912c,0xaab4e657,0x84ca8d0c,0x400bbfbf,0x8d0c912c,0x6ff92a00,0x88ea8d0c,0xb5b5f5fa,0x912d996e,0xbbbebdb8,0x910d996e,0xc0415b6f,0x84ca8d0c,0xe9e5d5c6,0x84a9952c,0xf9f9e5e5,0x84ca8d0c,0x1d7eb8b8,0x88eb912c,0xd1414247,0x88eb954e,0x70e0e0e5,0x912da1b0,0x1b6b1f1e,0x88eb996e,0xa1a71b1b,0x952da190,0xed9da4b0,0x912c9d90,0x7f2f29fd,0x910c994e,
-0xe0e0e0e0,0x956ea1d2,0xf0f0f0e0,0x954e9990,0x460b0b0b,0x84ca910c,0x47070606,0x88ca912c,0xf4f4f4a4,0x912c996c,0xbafaf9f4,0x914da1b0,0xd6868645,0x84ca912c,0xd1d1d1e5,0x88ca912c,0x9a9f9fae,0x806784c8,0x8f9f5f5f,0x808784ca,0x2d36baf7,0x808788ca,0x1f2e3d3d,0x84a8a5b0,0x8f8b9bab,0x806684a8,0x96979b8f,0x808788ca,0xd38b0e0e,0x84a9994e,0xb9f5a0e3,0x84a990ea,0x7f7fbbba,0x88eb912c,0x9a2f7f7f,0x84ca912c,0xf4e0f0e0,0x80a988ea,0xaa3dbefd,0x80a884ca,0xeaa69641,0x80ca996e,0xf4e0d1d1,0x84a88cea,0x6f6f1f6f,0x84a9890c,0xfae6d7d7,0x84a988ea,0xf9fa5a9b,0x84ca88ca,0x7ffdfdf9,0x88eb88ec,0xebebff6a,0x84a880ca,0xb9eaeaea,0x84ca912c,0xf9a9152a,0x84ca88ea,0xe1d1e6ef,0x84a884ca,0xbef9e4b8,0x84ca88ea,0xbae6ab2f,0x808888c8,
-0xa26277bb,0x88ca88ea,0x87c58292,0x84a98cea,0x7f7c7cb9,0x84ca8cec,0xb0b6f6f,0x84ca954e,0xf0f7f9e6,0x80a8910a,0x2e7ebdb4,0x80a8912c,0xa0eb9707,0x952d9d6e,0xbc6490a0,0x912d994e,0xf9944090,0x910c9d6e,0xa0e0f9fe,0x910c954c,0x6b6f6f7f,0x910c994e,0xc1d1575b,0x88ca952c,0x2f7fbeb9,0x8d0b994e,0x82965a6b,0x8ceb954c,0xbcf0f4d0,0x80a884ca,0x9f4f6ebd,0x80a888ca,0x1b1b1e1f,0x80a9952e,0x62636307,0x912d994e,0xe9f9b9b8,0x8d0c952c,0x2a79b9a5,0x8ceb912c,0xf4f8a9a5,0x952da190,0xf0e0f0f4,0x8ceb952e,0xcbdb1f1f,0x84a98cea,0xa58182c6,0x80678088,0xeae6d6c1,0x88ca910c,0xdde4a0fe,0x84a984aa,0x96ebefef,0x84ca994e,0x6b2a1a95,0x88ca912c,0x4b0b4e8e,0x806784a8,0x796fab9b,0x84c990ec,0x81c08196,0x84a988ca,0xe0818142,0x80888cea,
-0xafbefcf8,0x80a888ea,0x9f9f5f5f,0x80a988ca,0x3e7eaafa,0x84a9912c,0x4b0f1f2f,0x88ca952c,0xb6e2e7db,0x84a988ea,0x4f1e2e7a,0x84a9954e,0xf4e0d197,0x84caa190,0x5faffdf8,0x88ca912c,0xa8b4b0e2,0x8088910c,0x6f6e99a8,0x80888d0c,0x5f2f3e7b,0x84a8a190,0xbeeafaef,0x84ca952c,0xbbef9f5f,0x910c912c,0xb86e0656,0x912d952e,0xd04b1f3f,0x80a9954e,0x1b2afef9,0x8088910c,0x64f9d7c3,0x88ea912c,0x9bbfbe69,0x88ea952c,0x90a65b5f,0x88ca996e,0x7fa9e5d0,0x8088912c,0xbde5ebeb,0x808888ea,0x1a5b2f3e,0x88eaa190,0x50a71f6f,0x912d9d8e,0xb9f5b4a0,0x912c9d6e,0x6fbef9f5,0x88ea952c,0xe051031f,0x8d0b996e,0xe4e50607,0x8d0b954e,0x561555a4,0x84a8996e,0x8a2ff9f4,0x88ea910c,0xbfe5e5c1,0x808784ca,0x7fbefaea,0x80a888ea,0x9062ab6f,0x88ea910c,
-0xadfdfcfd,0x8cca910c,0xa4f9b9f9,0x8cea9d70,0xf3e3d3e2,0x8cc990ea,0xba9fbeff,0x8ceb8cea,0xf8f8f4a4,0x952da1b2,0xa4a4f8f8,0x910bb214,0xcfcf1f8e,0x952c910c,0xeaeabfbf,0x950c9d6e,0x54405060,0x88a98cca,0xe5e5d686,0x8088950c,0x1f1f2e2e,0x84879d4e,0x6b6f2f1f,0x950c9d6e,0xbff9f4e4,0x88a9950c,0x2f2f7f7f,0x88ca992c,0xa0e1e166,0x952d9d6e,0xf4f4e4e0,0x8cea994e,0xa4a8a8a4,0x950bb678,0xa4a4f8e4,0x88caa5b2,0xfefae5e9,0x88ca992c,0xff450b1f,0x8ceb992c,0xa4a4a4a4,0x8ca5bede,0xa4a4a9a4,0x90e9ae16,0x1a7a1a6a,0xa190a590,0xff969506,0x88ca994c,0x1061b1f,0x8cea994e,0x6bfff4d0,0x90eba170,0xb9d5e9b8,0x84a990ea,0x45560b6f,0x8cca952c,0xe4904015,0x950c9d6e,0xaaaafef8,0x88ca90ea,0x2f2fbaf8,0x88c990ec,0xbe060b9b,0x88a988ca,
-0xf4f4f4e0,0x8cca992c,0x6ebef9f9,0x84a98cea,0x85868686,0x84888cca,0xe4e18282,0x88a988ca,0x4b4f5f2f,0x848888ca,0xabd78b8b,0x88aa8cea,0x1b1a1ab4,0x84a98cea,0x51a75b5b,0x910c9d4e,0xffbf1f1f,0x90eb992e,0xe5a6aa6a,0x8cca910c,0xffb65010,0x950c992c,0x606aafa,0x90eb992c,0xe0e0a0f1,0x952c992e,0xa55580e0,0x950c952c,0x3b322152,0x950c992c,0x6a6e3f3f,0x910b992e,0x415b1f2f,0x88c9950c,0x6ef9e080,0x84a98cea,0xbee99450,0x88a9994e,0xa9961b2f,0x8cca9d4e,0xa5f8aa5b,0x8ceb910a,0xe1805055,0x848990ea,0xbafafafa,0x88ca910c,0xd782066e,0x8cc98cea,0xe087dbea,0x88a990ea,0x7ebef8f0,0x88ca952c,0xa6676b6b,0x88ca992c,0xe4d0c196,0x88a9910c,0xd0815b1f,0x8cea950c,0xffbffdf4,0x910c9d4e,0xb1f7eb9,0x8ccaa16e,0x5ffff586,0x950c9d6e,
-0xb4e4e4e4,0x8ceb9d90,0xa596a9b8,0x8ceba9f2,0x9a972f7f,0x910c952c,0x4afafebd,0x910c952c,0xa5a4a4a4,0x888799b2,0xe4e4e4a4,0x8088954e,0xef4a6aaa,0x84ca8cea,0x7fbfffff,0x910c994c,0x6fe5f9a5,0x8ceb952c,0xe642462f,0x88ca910c,0xd54706bf,0x84a98cea,0x6f7fbdf4,0x8ceb952c,0x75abef9,0x88ca910c,0xf9fa9a45,0x952d994e,0xf9f4e5ab,0x952d994e,0xebebfefd,0x910c994c,0xf968b8e4,0x84a89d70,0x5455fafe,0x88caa9d2,0xf600557b,0x9d6f9d6e,0xa5f9faab,0x9d6ea5b2,0xf9a46450,0x88ebb214,0x5054aa,0x80229550,0xbffa9505,0x88cb994c,0x55a9aa,0x80239570,0xafebfff9,0x952c952e,0xaabfabab,0x952da58e,0xeb6fefeb,0x910c952c,0x864aaa2a,0x8ceb910c,0xaafffa94,0x84a988ea,0x55aaaa,0x8001a1d4,0x5a06bfee,0x808788ca,0x15156a,0x80229d90,
-0x56a5befe,0x88c9910c,0xfefa9606,0x952c994e,0xf1c6f9ff,0x910c910c,0xbf6b5640,0x910c994e,0xffffffff,0x952d9d6e,0xcf034f7f,0x954d952c,0x96ffffff,0x952d994e,0x5ffbe545,0x8ceb910c,0xff061bfe,0x90eb952c,0xe5e5f9e9,0x88ea994e,0xbfb55006,0x910c9d6e,0x6f42efff,0x910c952c,0x9a6f5aaa,0x994e9d6e,0x95017ffe,0x84a9910c,0xfffa9066,0x8cea994e,0xfff9001f,0x84c9954c,0x6ffeffaf,0x88c9910c,0xfa40aa40,0x88ca8cea,0xafffaf,0x84a9952c,0xff5556a5,0x8087910c,0x5555aaff,0x80a9994e,0x400005,0x8021912c,0x5a555ff,0x8d0c992c,0x559400,0x80228d4e,0xb901ffea,0x88ca910c,0xff550016,0x8087910c,0x11b9ffff,0x8ceb910c,0xff650000,0x84a8912c,0xe48205bf,0x956f954c,0x55aaf9,0x80229170,0xafe50056,0x88eb9d8e,0x55556a,0x8022914e,
-0xea918080,0x8cca950c,0xd49091e6,0x8cca950c,0x4f4b4b4b,0x88a990ea,0x7070b0b,0x848890ec,0xc5c1c5d4,0x88a990ec,0xe4e0d4d4,0x84888cea,0x17574307,0x90eb992c,0x2021317,0x992d9d4e,0xf9f9febe,0x88a98cca,0xb8b4f9f9,0x8cca90ea,0xd3d3d2d1,0x848888aa,0xe2e2e6e7,0x80678cca,0x78b9b5f9,0x950c9d4e,0xfeae5e6d,0x8cca950c,0xfcf8f4e2,0x848890ec,0x5b1b6dac,0x806890ea,0x7fbebea9,0x88a99d4e,0x421b1f6f,0x8ceba16e,0xa0d1d181,0x950c994e,0xf9d5d0e0,0x8488910c,0xbdf4d090,0x950ca170,0x9556aa7f,0x952c994e,0x10b1faf,0x90eb992c,0xfe05aa50,0x8ceb994e,0xbeabffff,0x84a98cca,0x56abafbf,0x910c9d4e,0xa0a5565b,0x950c9d6e,0xa4f7b6b4,0x9d6fa190,0xe9a44041,0x950ca16e,0x6f501afa,0x8088952c,0xffeaa995,0x88c99d4e,0x5fee42f,0x88a8992c,
-0x571b576b,0x8cca90ec,0xe6663a3a,0x8ccb90ea,0xc1c1c1d0,0x84888cca,0xbf8ec5c5,0x8cca8cca,0xfaf6f5e7,0x8cca90ea,0xb9b4a5fa,0x90eb910c,0xebfbffbb,0x8cca94ec,0x5540e6e6,0x88a98cea,0x1f1f1b07,0x8cca9d4e,0x3d2e2e2f,0x8067950a,0xf4f4f4f9,0x992c9d4c,0xa5f5f5f0,0x992da590,0x7e7e7e3d,0x84888cca,0x552f3f3f,0x84a990ea,0x90905051,0x950ba9b0,0x6ba9f4e0,0x806790ea,0x1be7979,0x952d9d4e,0xaafae141,0x950c994e,0xe4aa6965,0x910c9d4e,0x5a1b5bfa,0x88ca910c,0x6bffffa,0x88ca9d4e,0x69bfbf90,0x8067952c,0x9401afab,0x8487952c,0x5440a5ff,0x8067910a,0xff5a5540,0x84a8910c,0xa5f9005b,0x84a890ea,0xfe96e5fe,0x88a8950a,0xe7ff0095,0x8488992c,0xfa00fffe,0x88ca952c,0x95a5566b,0x84a8950c,0x7f055b55,0x84888cea,0xa915007e,0x8487910c,
-0x66e5a9e4,0x8d0b952c,0x95020706,0x910c910c,0x54fabeaf,0x8ceb910c,0xe9555450,0x8088910c,0x66fffea,0x84a99d6e,0xaaffe900,0x88ca954e,0x16fff,0x88ca9d6e,0xaa6bffe9,0x88ea954c,0xa5af5555,0x8ceb8cea,0xbffaf9a5,0x84a88cea,0x56195a19,0x88ca8cea,0x56affffe,0x8088952c,0xe540015b,0x8ceba190,0x155abff,0x84c9994e,0xffa90000,0x8ceba5b0,0xf8fafeff,0x912c996e,0x50aa6f6b,0x8d0b994e,0xbf950140,0x84a9912c,0x95f9f9b4,0x8d0b952c,0xfffaa495,0x8d0b952c,0x56fff895,0x8cea996e,0x555555,0x84219170,0x95eafaff,0x910c8d0a,0x555555,0x8442890e,0xffbf1b01,0x952d996c,0x8b97cafe,0x912c910c,0xfffa1054,0x954ea18e,0x5654ffff,0x88ea952c,0xaaffffff,0x8d0b914e,0x10155,0x802184ca,0x56ffffab,0x910c996e,0x1,0x800088ca,
-0xea000015,0x806688ca,0x1a56bff,0x910ca5b0,0xbfc08040,0x84a884a8,0xaaf956,0x952da5b0,0xfffe0000,0x88ca994e,0xef03ffbf,0x912c8d0a,0xabbfe900,0x8088954c,0x6bffaaaa,0x8ceb910c,0x4107ffa5,0x808888ca,0x66ffa,0x952d9d6e,0x96805bff,0x84a9910c,0xe5400056,0x84a99d6e,0x565afff9,0x8067910c,0xaaaa5a,0x80a8912c,0x4040eaff,0x84a888ca,0xaafeea,0x84a9952c,0xffaa5055,0x910c996e,0x55aa5aff,0x88ca954c,0xbf6595fe,0x8d0b9d6e,0xaafe05bf,0x88ea954e,0x557fff59,0x912c952c,0x55000000,0x802188ea,0x40a9af6e,0x912d910a,0xaa550000,0x80429570,0x41d0ffff,0x806688ea,0xfe06005a,0x8066952c,0x142ebfa,0x84a9952c,0x5a00a555,0x8046956e,0x55aaaaf9,0x8d2ea9ae,0x56550000,0x8021914e,0x55fafe,0x8d0ba14c,0x55550000,0x8022914e,
-0xffffffff,0x800094a4,0xffff,0x80008000,0xffffffff,0x8000a0a2,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80009020,0xffff,0x80008000,0xffffffff,0x80008022,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x80008004,0xffff,0x80008000,0xffffffff,0x80008400,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008800,0xffff,0x80008000,0xf0fffff,0x80008000,0xf0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffff,0x80008000,0x0,0x80008000,0xc0c0ffff,0x80008000,0xc0c0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008024,0xffff,0x80008000,0xffffffff,0x80008004,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x800080d2,0xffff,0x80008000,0xffffffff,0x800080fa,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008008,0xffff,0x80008000,0xffffffff,0x8000806c,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xe6e6d1e0,0x806790ea,0xffefabd6,0x88a984a8,0x7f7f7f7f,0x848890ea,0xbf69697e,0x80668cea,0xbaffffe,0x80878cca,0x40e5ff6f,0x8046952c,0xa8fe6f7e,0x80678cca,0x2f7f6b55,0x8487950c,0xa8945454,0x8cca992c,0x54a8a894,0x992da16e,0x707576b,0x88a9950c,0x9faf5f0b,0x84a88cca,0x82511000,0x9d4ea16e,0xd0508181,0x88ca9d4c,0x8a4f4f4e,0x808888ca,0x2f1ed195,0x806788aa,0xbffa9796,0x950b9d4e,0x57e7f5ff,0x88a8950c,0xbe860b1f,0x88a990ea,0x292f0b6f,0x848890ea,0xfefdaa00,0x8cea952c,0xfff4e0f8,0x84a990ea,0xafbf6a00,0x910c952c,0x950bfe55,0x808888ca,0x555fbde4,0x806690ea,0x28654e9a,0x90ea8cca,0x59a9454b,0x88a988ca,0x5468a96a,0x8cca8cea,0xea010000,0x84a8910c,0xbf80067f,0x88ca910c,0x7fde490,0x84a98cea,0x6afea541,0x8ceb994e,
-0x5d6dae6e,0x8488950c,0x6f2f6f6e,0x84a98cea,0x95f1e101,0x90eb90ec,0xf5905555,0x8ceb992c,0x5b1f1f1f,0x88a990ea,0xa8d8b3e7,0x88ca88a8,0xa56465b4,0x950b994e,0xfffdff6f,0x88c98cea,0x3f0f86e0,0x8488950c,0xfffeb97f,0x8067950c,0xf8beaf9b,0x8488992e,0x792d0e0,0x8ccaa16e,0x8ae595e1,0x8067952c,0xea9be680,0x88a98cca,0x5f1f0f07,0x88a99d4e,0x1b6f6f5f,0x88a8add2,0x91fede65,0x88ca8cca,0xd5400000,0x808888aa,0x5b6bbbbe,0x8cca8cea,0x1ba9f9f9,0x80678cca,0xa4016fff,0x84a9910c,0x5bffffe,0x910c9d6e,0xfecd5546,0x8cea88ea,0xf9e5066b,0x8ceb994e,0x6e76bafa,0x806788ca,0x94f1e25b,0x8cc990ea,0xf4b4561b,0x8cea992c,0xabbffff9,0x8cca950a,0xe66f6e6e,0x88ca950c,0x5faffee0,0x84a8910c,0xafe9e4d0,0x84888cca,0x9546061f,0x84c988ea,
-0x1aafe9af,0x88c9910c,0xfff94001,0x8ceb9d6e,0x6afffe,0x88aa994c,0xaffff940,0x8ceb9d6e,0xfafa5a9b,0x8ceb910c,0xaaffff,0x84a99d6e,0xabe2faab,0x8ceb8cea,0x55ffaf,0x80879d6e,0x50012baf,0x88ca952c,0x506bffe,0x88ca952c,0xfea40005,0x80889d6e,0x90e0febf,0x8ceb952c,0x6a1f0706,0x8cea910c,0x95ffbf,0x80889d90,0xe5d0d080,0x8ceb910c,0x40aaffea,0x80a9a18e,0x40d6ffff,0x88c9950c,0x41f95605,0x88ca912e,0x51bff6a,0x84a9910c,0xfe6f0540,0x912e994e,0xf9f99a0b,0x8488950a,0x55150095,0x80439570,0xffaf0600,0x80668cca,0x4094ea,0x802388ec,0xa9b9ff15,0x84a9952c,0x4279a4a9,0x994e9970,0xfafebf00,0x84c9996e,0x69feff16,0x952d994e,0x4b410000,0x952e9d4c,0x555a5b,0x80229570,0x55fdf964,0x994e9d90,0x555555,0x842299b2,
-0xabbff980,0x84a8910c,0xfebea5a,0x88ca8cea,0xea015bbf,0x808888ca,0xa8416ffe,0x8cea952c,0x6bbfbfbf,0x994d9d6e,0x55aaffaf,0x84c9a190,0xf9faa5a6,0x952da5b0,0x1aaffea,0x84a9912c,0xbff9a595,0x84c98d0a,0x5abff14a,0x910ca190,0x9002ffea,0x88ca8d0c,0xe5560bfe,0x8d0b994e,0xabaf5655,0x910d994c,0xfaffaf,0x84c9910c,0x55fe15f9,0x910c994e,0x54ffff6a,0x84a9910a,0xffff6a00,0x84c99d8e,0x1ff0690,0x910c994e,0xffff0000,0x88ca9d6e,0xa9ff90fe,0x88ea952c,0xe5ff6f01,0x8d0c912c,0x555555,0x8422a1d4,0xffff9550,0x8cec952c,0x55a955,0x80239db2,0xffaa0000,0x84c8a1b0,0x5b1a6aab,0x8cec912c,0xff560000,0x88caa1b0,0x4040aafe,0x8cea910c,0xffffaa5a,0x88eb9d2c,0x550500,0x80228d2e,0xffffaa41,0x88eb952c,0x50550050,0x80029570,
-0x1695fe5b,0x8cca992c,0xbe5f0f07,0x88a990ea,0xf8bfe6b9,0x90eb950c,0xbaf9f4f4,0x90eb992c,0xe0e0e0b8,0x8067950c,0xe4d4e0e0,0x88a990ea,0x5b5bab6a,0x88a990ea,0x97af1b1b,0x80458cea,0xa2050b96,0x88a890ea,0x91aa56fa,0x8cca950c,0xfed0557a,0x88a8910a,0x4bd6400b,0x88a98cca,0xf8f9e251,0x8cca992c,0xbbf6a8e4,0x8cca950c,0x2fbaa685,0x848888a8,0xfee6870f,0x88a990ea,0xebcfe9d4,0x848888a8,0x7f7ebeeb,0x88a88cca,0xe5ff9b42,0x8066950c,0x40f9fea6,0x8046950a,0x7e2aabff,0x88a9950c,0xf0265be,0x912c910c,0x54a4bf6f,0x8067950c,0xfe004055,0x912c912c,0x96e7a96e,0x8cca94ec,0xf1f1a55,0x88a99d4e,0x7acffffe,0x950c950c,0xe8a9a5b9,0x910ca56e,0xe4bae591,0x8ceb952c,0xff00c1f5,0x952c910c,0xff956ffe,0x88ca954c,0x4be09bff,0x952d952c,
-0x826bbef9,0x88a9990c,0x5a6afef8,0x80888cea,0xaffef8e6,0x8889910c,0xa9d0415b,0x808788ca,0xf8e0955a,0x80888cea,0x5b47a7bd,0x8ceb910c,0x11bbf3f,0x88ca910c,0xe5960541,0x84a9910c,0x79feff5b,0x8cea910c,0xa4b8faeb,0x88ca950c,0x50ffbe19,0x952d9d6e,0xbffae656,0x84a9952c,0xbeead194,0x80888cea,0x60b1f2e,0x88a9952c,0x51965b7f,0x8cea9d6e,0xfefdf4a0,0x88ca994e,0xd5475a05,0x84a98cea,0x5baffaf5,0x84a9994c,0x2f2faee4,0x84a9954c,0x50feeaab,0x952ca190,0xfffa0006,0x8ceaa190,0x506b6aaf,0x954da16e,0x6fafa950,0x84a9952c,0xfefe95aa,0x910c994e,0xf9f4e040,0x910b9d4e,0x81056afa,0x88ca952c,0x461f6fbe,0x84a9910a,0x1fa9e486,0x808788ca,0x9515affa,0x84a9910c,0x5affe56a,0x952c994e,0x6a905a0b,0x88ca8cea,0x65bf6a55,0x8ceb994e,
-0x2a6efeff,0x88eb910a,0xafa5a966,0x8d0c954c,0xa4a4aaff,0x88ea910c,0xfae6fae5,0x910b912c,0x59ab50ff,0x910c954c,0xb9ffffa5,0x80a8952c,0x41fa00ff,0x994e9d6e,0x5affff05,0x84a884ca,0xfafeaaab,0x88ca994e,0xe6af1f43,0x84a9952c,0xaf060506,0x8cea952c,0x2f0190ff,0x80a8994e,0x6aab14a6,0x994da190,0x1ffbf68,0x80a98cea,0x15c740fe,0x996f994c,0x50ff5a50,0x84a98d0c,0x5b000054,0x88ea9d6e,0x55555aff,0x84a9912c,0x1404095,0x88ea994e,0x5555aaff,0x88c9954e,0xffaf5655,0x84cb952c,0x55050055,0x8022956e,0xffaa1555,0x84cb910c,0x1000055,0x8022a190,0x4a9aa6f,0x952d9d8e,0x5400feff,0x84c9910c,0xaafea4,0x954da5b0,0x55a5ff1a,0x80678d0c,0xff554454,0x84ec88ca,0x5550a9,0x8022a1d4,0xffa99555,0x84ec88a8,0x5595fe,0x80439992,
-0xa5501050,0x910b996e,0xaafe,0x8088996e,0xaa050559,0x84c98d0a,0xaaff,0x8087a190,0x15aaff56,0x8ceb996e,0xaaab0500,0x84a884ca,0x40aaff01,0x88eb910c,0xffaa0000,0x80a88cea,0xff905055,0x8088910c,0xaaff,0x8d0da190,0x6fbfea55,0x84a9910c,0x6aaf,0x952da1b0,0x55aaff54,0x84a9a190,0xff560014,0x80a988ca,0x1556ff95,0x80a9954e,0xff550000,0x80888cea,0xaaffaa,0x954eadf2,0x95aaff00,0x80888d0c,0xaaffbe,0x952da1b0,0xfeffff00,0x88ca9d6e,0x961a9695,0x84ca88ca,0x55aaaa,0x80029170,0xaaecfefa,0x88ca84ca,0xa5aaaa,0x80238950,0x96ff55,0x910d9d6e,0xffffaa00,0x84a9a9d4,0xffffaa,0x910c9d90,0xffff0500,0x80a9994e,0xaa1effff,0x84c988ca,0x5a5a5a,0x8022852e,0x6a40ffef,0x84a888ea,0x40054055,0x802284a8,
-0xffffffff,0x8000806c,0xffff,0x80008000,0xffffffff,0x80008002,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xf0fffff,0x80008000,0xf0f,0x80008000,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xc0c0ffff,0x80008000,0xc0c0,0x80008000,0xffffffff,0x80008800,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80009084,0xffff,0x80008000,0xffffffff,0x80008004,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x800080f4,0xffff,0x80008000,0xffffffff,0x8000912c,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xf0fffff,0x80008000,0xf0f,0x80008000,0xc0c0ffff,0x80008000,0xc0c0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x80008400,0xffff,0x80008000,0xffffffff,0x8000a000,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008400,0xffff,0x80008000,0xffffffff,0x80008046,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008048,0xff000000,0x80008000,0xffffffff,0x8000806c,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008046,0xff000000,0x80008000,0xffffffff,0x80008028,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008028,0xff000000,0x80008000,0xffffffff,0x8000806a,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008090,0xff000000,0x80008000,0xffffffff,0x800080b2,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800084ac,0xff000000,0x80008000,0xffffffff,0x8000910c,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008068,0xff000000,0x80008000,0xffffffff,0x80008042,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800080b0,0xff000000,0x80008000,0xffffffff,0x800080ac,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800080ec,0xff000000,0x80008000,0xffffffff,0x8000808c,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008068,0xff000000,0x80008000,0xffffffff,0x80008444,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008464,0xff000000,0x80008000,0xffffffff,0x80008088,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x8000808c,0xff000000,0x80008000,0xffffffff,0x800088aa,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008046,0xff000000,0x80008000,0xffffffff,0x80008088,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800080aa,0xff000000,0x80008000,0xffffffff,0x80008068,0x0,0x80008000,0x0,0x80018000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800088ea,0xff000000,0x80008000,0xffffffff,0x800080ee,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800080cc,0xff000000,0x80008000,0xffffffff,0x80008044,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008024,0xff000000,0x80008000,0xffffffff,0x80008042,
-0xd59b6f90,0x88c9910c,0x5afffe,0x8ceb994c,0x7ffee96a,0x88ca9d6e,0x94949a6f,0x88c9910c,0x2ebef550,0x952c994e,0xd6864b1f,0x808788ca,0x3874b5d5,0x84a9910c,0x2f2b6f3e,0x88c9952c,0xd0426ba9,0x84a8952c,0xd79ffef8,0x80888cea,0x2fbefeff,0x84a9996e,0xe1d2470b,0x88ca994e,0xe5f5f6f7,0x88ca952c,0x54f9ebe6,0x910b994e,0xb5f4f0f0,0x8cea910c,0xe58b7b7a,0x88ca8cea,0xabbca5d2,0x808888ca,0xf9954b5f,0x88c988ca,0xaa90d66f,0x88ca910c,0x3ffffeba,0x84a9952c,0xe9fff969,0x88ca952c,0xe41190a9,0x88ca952c,0xebffff81,0x88ca910c,0x7fe4919a,0x848888ca,0xd19a9601,0x88ca910a,0x90066ffa,0x8087910c,0x1b7fbef9,0x88caa190,0xaab8d042,0x84a98cea,0xea9b6faf,0x84a98cea,0x40022ffa,0x8088910c,0x1fbff9d5,0x84a88cea,0xaae5a442,0x88eb992c,
-0xf890010f,0x8087910c,0xb0b2f2e,0x8ceb952c,0xbf1e84f4,0x806790ea,0xb4bdf8a4,0x84a88cea,0x6e7a711b,0x8ceb994e,0x82470f1f,0x84a89d6e,0x6dbc6c50,0x952d9d8e,0x5b6b6fbe,0x910ba190,0x6aa40b6b,0x8087952c,0x5a6abfbf,0x8044910c,0xe9aae480,0x80668cea,0x9aeafafa,0x806588ca,0x69be691a,0x8d0b994e,0xe0e56469,0x952d996e,0xe59a6990,0x84a9910a,0x2f7ffaf9,0x84ca994c,0xbeb8e0d1,0x88c9994c,0xfed0461f,0x84a988ca,0xe5465a1a,0x88ca912c,0x715bfffd,0x84c9910c,0x9440071f,0x84a8910c,0x66f6aaa,0x910c9d6e,0x7afead3d,0x952d994e,0xb9f04129,0x8ceb952c,0x6f6ff8f4,0x88ea954c,0x50b5aa5b,0x8d0b910c,0x7c15060b,0x910c954e,0xf9e0d6ae,0x84c98d0a,0xe4d14114,0x84a9952c,0x90ab5f7d,0x910c954e,0x666f7fbd,0x88eb910c,0xfbfef974,0x910c952c,
-0x95466ffe,0x8088912c,0x9000055a,0x88eba190,0x6ae99a0b,0x88eb9d6e,0xff940055,0x84c99d90,0x4055affe,0x88ca910c,0xffaa0000,0x80888cea,0x9595eabf,0x88cb912c,0xffba0000,0x84ca8cec,0x1abffea9,0x952da190,0xabfff440,0x84a9912c,0xe4011a6a,0x88cb9d6e,0xbe96affe,0x8089910c,0xfe957fff,0x8d0c952c,0xffab0014,0x88ca8d0c,0x6bff800b,0x88eb996e,0xffae0000,0x84ca910a,0x55ffffaa,0x8d0ca9b0,0xffff0000,0x8488954e,0x55ffffaa,0x8ceba5d2,0xffff0000,0x8488994c,0x1feffff,0x84a8992c,0x5594aaa9,0x8022890e,0x94ffffff,0x84a9a54c,0x55aaaa15,0x80018d92,0x55ffffaa,0x910cadf2,0xafff0000,0x80888d0c,0x1ffffea,0x8ceb9d70,0xaaff5000,0x84a89d6e,0xfaffbf6b,0x84aa98ea,0x55aa5a00,0x8022916e,0xffaa56a5,0x84cc90ea,0xa96a00a5,0x8043a1d2,
-0x5bbee040,0x84a98d0c,0x801bbefa,0x84ca994e,0x9eaa0b1f,0x80a88d0c,0xaff9a146,0x84a99d6e,0x55aabfe0,0x88cb996e,0xbffe0000,0x88ca910c,0x156a6eab,0x912ca190,0xaaffa500,0x84aa8d0c,0xbfb9a5a0,0x88eb952c,0x8e629fff,0x8d0c8cea,0xf4e0e6ea,0x80a988ea,0xbffb012f,0x88ca910c,0x64febd8e,0x952d954e,0xaaabfee4,0x808888ea,0xaaafbf6f,0x88eb910c,0xaa05bfff,0x808888ca,0xffffff,0x8ceb954e,0xfeffa500,0x80869d8e,0x50fffffa,0x88ca992c,0xaf5faa00,0x80448d2e,0x56e04141,0x84aa8cec,0x6a0140aa,0x8023954e,0x9aabaeaf,0x88c98d0e,0x500a99a,0x8023912e,0x1afffff,0x84a9910c,0xe5a5fea4,0x84a98cea,0x56ffff,0x84a98cea,0xffa5abfe,0x84888d0c,0xfef97afe,0x84ca8cea,0x54fefe,0x8067954e,0xffff801b,0x84ca952c,0x55ffff,0x8067912e,
-0xfb66ebbf,0x88a98cea,0xa681879b,0x88a78cc8,0xffa86bf5,0x84a8952c,0xbdfaf7aa,0x88ca8cea,0xb1f2eba,0x80a8912c,0xe4e04002,0x8cea9d90,0xeeaeae7c,0x80888cea,0xe7f79fdf,0x80888cea,0xfffe406f,0x84a8994c,0xfad1e6ae,0x84a988ca,0xfffff900,0x84a8a18e,0x21b6fbf,0x84a8994e,0x1f6f7fbe,0x84a8910c,0x91924b0f,0x8ceb952c,0xb9f49041,0x952d9d6e,0x2a157fbe,0x88ca910c,0x1fa9f9f8,0x80a98cea,0x81470f0f,0x88ea912c,0x6db9aaa7,0x84a9910a,0x1f1f2e6e,0x84a8952c,0xd0d09090,0x84a98d0c,0xbfa9e5d0,0x808888ea,0x171b1b1f,0x84cb9d6e,0xa0901217,0x954da5b2,0xf4e0e090,0x8cea994e,0xb4f4f4f4,0x910c994e,0x3f3f2f2a,0x8ceb952c,0x1060b1f,0x88ca952c,0x79b8b4b4,0x910c954e,0xe6cb6979,0x88ca912c,0xf9e09080,0x8088952e,0x166fbffe,0x84ca910c,
-0x61b7ff9,0x8087a5b0,0xe5940001,0x84a9952c,0xb9f49087,0x808888ea,0x6f5f6f6f,0x808888ca,0xd1c2d2d5,0x80678cea,0xf4f4e5e5,0x8088910c,0xfbffbfbf,0x84c984c8,0xb7bbeafa,0x84a988ea,0xd5966b6f,0x84a988ca,0xe9e5e5e5,0x84a984c8,0xffbf7eba,0x84c98cea,0x2f2f6faf,0x84c9910c,0x5b9febe9,0x84a988ea,0xc7c79b9b,0x80a88d0c,0xea46075b,0x84c988ea,0x9f0b5beb,0x84ca8cea,0xedf8f8f8,0x808884ca,0xf5f6fae,0x8087910c,0xe6b1b2b6,0x80a884ca,0xf5e49091,0x80a8952c,0x60b1f1f,0x84aa88ca,0x90954606,0x806884ca,0xbdf8f8f9,0x808888ca,0x2f6f7ebd,0x84a89d4e,0x82878787,0x84a9952c,0x928291d1,0x88c9954e,0xb5b9baf,0x88ca88ea,0x1f6f6f1f,0x80888d0a,0xe0e1e1d2,0x910ca18e,0xe0d0d090,0x84a9994e,0x2f2f2f2f,0x8067910a,0x1f2f2f2f,0x8088910a,
-0x2071f6f,0x84a9a190,0x565bfe90,0x80888d0c,0xfde09090,0x8089954c,0x69f6baff,0x84ca88ea,0xfe050555,0x84a988ea,0xe59006bf,0x80a98cea,0x6fa8e495,0x808888ec,0xbffb5016,0x84cb84ec,0x1b5bbffd,0x80a98cec,0xe5803e7e,0x88ca88ca,0xe4f4f551,0x88ca952c,0x6ff9f8e4,0x8088912c,0x1aaffe,0x80888cea,0x511b0500,0x84ca88ec,0x50b4955b,0x8ceb910c,0xfee44050,0x84a98cea,0xf9001bfa,0x84a988ca,0x6bffeff,0x80a988ea,0xffe4401b,0x80878cca,0xfce9abbf,0x84a9910c,0x5a5abf80,0x80a98cea,0x5a5a,0x800288ec,0xa86965bf,0x88ed8cca,0x54016d,0x8023890e,0x865bfee0,0x806784ca,0x5bbfbeea,0x84aa8cec,0xbaa9aa6f,0x80a988cc,0x54e6feff,0x88ec8cec,0xfefef995,0x88ec8d0c,0x5555a5,0x80228d50,0xe6e55615,0x84cc88ca,0x405555aa,0x80228d30,
-0x7fff8680,0x808888ca,0x29ba6f3f,0x8ceb952c,0xe551161b,0x88ca952c,0xd1aaf8f8,0x84a98d0c,0xe5661a6a,0x84ca952c,0x424bbef5,0x806684a8,0xaf0f59e0,0x808884ca,0x3ebdfafa,0x80a9912e,0x6baba4e0,0x80888488,0x576f2f6f,0x80a9910c,0xa9af2e1f,0x80888cea,0xf990d0e4,0x88ca912c,0x2fb9e496,0x84a9910c,0xf8e0820b,0x8089910c,0xf8c1ebff,0x80a988ea,0x1b1f6f7e,0x84aa88ec,0xaaeaaa95,0x80aa84ea,0xfeeaaaaa,0x80aa8d0e,0xfef5d15b,0x84a988ca,0xd2879bab,0x80888d0c,0x1b3f7ebe,0x84aa994e,0x4055a595,0x8023850e,0xbaf8e4d0,0x8089952e,0x55566a,0x802284ee,0x969b6ffe,0x808984ca,0xffef7f9a,0x84aa88ca,0xfa7f4546,0x88cb88ca,0x9aabfeaa,0x84aa88ca,0xaaf6929b,0x88cb88ec,0x40556aaa,0x80028930,0x56ffea96,0x808988ca,0x5555555,0x800180ee,
-0xffffffff,0x80008006,0xffff,0x80008000,0xcfcfffff,0x80008000,0xcfcf,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008060,0xffff,0x80008000,0xffffffff,0x800080aa,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x800080d6,0xffff,0x80008000,0xffffffff,0x80008068,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x800084a8,0xffff,0x80008000,0xffffffff,0x80008088,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x80008026,0xffff,0x80008000,0xcfcfffff,0x80008000,0xcfcf,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008400,0xffff,0x80008000,0xcfcfffff,0x80008000,0xcfcf,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x80008402,0xffff,0x80008000,0xffffffff,0x80008800,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008800,0xffff,0x80008000,0xcfcfffff,0x80008000,0xcfcf,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x9f7abdea,0x80a884ca,0xf4f4f8aa,0x84c98d0c,0xdac0d1db,0x806784a8,0x7fbffffe,0x84a8910c,0xdfaa64e9,0x88ca88ea,0xff7e81c6,0x88c98d0a,0x3f3f3b7f,0x88ca954c,0x2f2f2b2b,0x88c9994e,0x57571b1f,0x88ea994e,0xf0e0a5a5,0x910c952c,0x85859494,0x88ca952c,0xdbdbd6d6,0x808888ca,0xf0f0f0f4,0x910c994e,0xf4e4f0f0,0x8cec994e,0x87c7c7db,0x84a988ca,0x82868282,0x80888cea,0x9f869aff,0x808884c8,0x1485dafe,0x84c98cea,0x2f6f6f6f,0x80889d6e,0x7d7f3f3f,0x84a9952c,0xb8fcec9c,0x88ca8cea,0xa878b878,0x84a9952c,0xfeffbea9,0x80a984cc,0xf4e0e0fd,0x84a98d0c,0xe0d0f4f4,0x952d9d70,0xe69190d0,0x952da190,0x5b9f9681,0x84a9910c,0x4f4b4b4b,0x84a98cea,0xa1a0a0f1,0x954e9d6e,0xa1a5a151,0x910c994e,0x9f4b478f,0x88898cca,0x9b8f9f9b,0x806888aa,
-0x5b0b5b6b,0x8088912c,0x1fbfffaf,0x88ca954e,0x9064b9f5,0x8ceb912e,0xf4e5d1e1,0x88eb910a,0xaf5f0f0f,0x80888cea,0xafafafaf,0x808784ca,0xeae5a0b8,0x84a888ea,0xfaeafaaa,0x84a988c8,0xead0e5ea,0x80a9952c,0xebd6e7ff,0x806680a8,0xab6b1b1b,0x8d0b9d90,0x2125262a,0x952d9d6e,0x7f7f7ffa,0x80a888ea,0x1f1f3f3e,0x8087910c,0xc4c98921,0x912c994e,0xf0f0c0c0,0x88ea952c,0xafafafaf,0x806684ec,0x5f5f6faf,0x808688ca,0xeafafafa,0x84a988ca,0xf5f5e5f5,0x84a988a8,0x9f5f5f5f,0x808888aa,0xafafafaf,0x84888cea,0xfae5e5e5,0x84a988ea,0xfafafafa,0x88ca8cea,0x1f1f1f1f,0x8088952c,0x1f0f1f1f,0x80878cec,0xa0a0e0e0,0x84caa16e,0xa0a0a0a0,0x84a9994c,0x1f1f1f1f,0x8088910c,0x3f2f2f1f,0x84a8910c,0xf0f0f0f0,0x8488910c,0xe4f4f4f0,0x84a9952c,
-0x6f2f1e18,0x84a9910c,0x1b36bbaf,0x88eb8cea,0xd9d9f4f4,0x808888ea,0xd6d4d9d9,0x8088910c,0xea5f2f3a,0x88ea8d0c,0x94e4f479,0x84ab910c,0x51a5fafa,0x84a9910c,0x2e2f5b05,0x8ceb910e,0xf7b2f5ba,0x8d0c952e,0x52a7bbfb,0x910ca190,0xefdadbdb,0x808884aa,0xafafafbf,0x808888ea,0xf8e0e192,0x80a98d0c,0x50fdfefd,0x8cec8d0c,0x979b5faf,0x84aa8cea,0xfeafab9a,0x88eb8cec,0xffa99555,0x84aa910e,0xfeff1bd5,0x84aa910c,0xffaa6a7e,0x84cb910c,0x7f02a4ff,0x80a9952c,0x55fffffe,0x84aa88cc,0x555555,0x802184ee,0x55f6aff6,0x88cb88ec,0x555555,0x80218910,0x6b150040,0x8cec952e,0x55ffbf,0x8089994e,0x150e5fe,0x8cec952e,0x40fabf16,0x84cb910e,0x55ebbe07,0x84aa8d0c,0x14555555,0x84229152,0xfeaf9150,0x88ed9d4e,0x909555aa,0x80448d50,
-0xbafaabab,0x84aa88ea,0x8209a5ba,0x88ca88ca,0xfafff9fa,0x88ca90ea,0x6f90a5ea,0x84aa88ca,0xbbbbb6b1,0x88ca8cea,0xd795dbdf,0x84ab88ca,0x2f2f6f6f,0x8088994e,0x7e2e2f2f,0x8089952e,0xbfbf7f3f,0x84a9910c,0xeababebf,0x808884aa,0xe0e0e0e0,0x8088910c,0xd0d0d0e0,0x84a9952c,0xadddd9da,0x808884aa,0xf4b8f8f8,0x80898cec,0x1b0b4782,0x84a9994e,0xbe7e2e1e,0x8089994e,0x5bebfdb,0x8cec910c,0xfeaf0000,0x84698cec,0x41aafdbe,0x84aa8cec,0x5a010000,0x80658cea,0x52be5a91,0x84ec952e,0x96ba690a,0x802384ea,0x1541d5ff,0x80ab8d0c,0x1b054054,0x8023952e,0xdbd1f0f4,0x84aa88ca,0x559074f9,0x88ca8cec,0xdbfbfafb,0x84aa8cea,0xa5ffee9f,0x84ac88ee,0x40f9ff6a,0x848888a8,0x555505,0x80229152,0xbe1b5640,0x84ab90ca,0x540e4,0x802388ec,
-0x5ca8a4e0,0x88ca910a,0xda99999d,0x808888ca,0xbfbfbeba,0x808788ca,0x5f6f2f2f,0x84a98cea,0xbefae6ea,0x808888ca,0x6b6faeae,0x804684ca,0x9181414b,0x806784a8,0xf5f0f5e5,0x808884a8,0xf9febe69,0x84a98cea,0xf9e4e0d0,0x808788ca,0x6f6fbff9,0x8088910a,0x552b2f2f,0x910ca190,0x2f7f7fb9,0x88ca9d6e,0x2071b1f,0x8d0ca18e,0xe0905090,0x8089952c,0xaebde8e4,0x808884a8,0x1b4b4b5b,0x804684a8,0x4b4b1b1b,0x808788ca,0x7d7ebeb9,0x84a9952c,0x1f2f2e7e,0x88ca9d6e,0x87878b4b,0x808888ca,0x4f8b8b87,0x808888ca,0x5b5b1b1b,0x84a9994e,0x9b8bdb5b,0x84a98cea,0xe0909090,0x84a9994e,0xb4a4e4e0,0x808788ca,0x475b5f6f,0x806788ca,0x34346a5b,0x88ca8cea,0x5f7e7d7d,0x88ca8cea,0x1f1b1f9f,0x84a98cea,0x56101020,0x8ceb910c,0xb4a8f8bf,0x910b910c,
-0xf4e59196,0x952ca1b0,0xbffef9f8,0x84878cc8,0x6fd6d2d6,0x808884c8,0x60b5fbf,0x808884a8,0xb0b5f6f,0x80678488,0xa564af5f,0x84a988ca,0xf8f9f954,0x84a888c8,0x955051a4,0x84ab84a8,0x95051fbf,0x80a988ca,0xfffeb9a5,0x84ca88ea,0x95d0e0e4,0x8ceb912c,0xaad6ea6a,0x80a98cec,0x9a9bbfff,0x84a984ca,0xeae69596,0x84a988ea,0xbefafe6a,0x88cb88ea,0x2f2f7e7e,0x88eb910c,0xd5a9a9a5,0x84aa88ea,0x6565eafa,0x84a988ec,0x4beaaaaa,0x84a988ea,0xe4e4afaf,0x84a988ca,0x2d2d6da9,0x84a98cea,0x2f2e2e2d,0x8088952e,0xbc7c79ba,0x84a988ca,0xbc7d2d7c,0x84aa8cea,0x9aebeaea,0x84aa88ea,0xefaaaaaa,0x88cb84c8,0xba2f2f2f,0x88eb910c,0xfe7e3eba,0x8ceb910c,0xbfa990a9,0x88ca8cec,0xa9f9f8fa,0x8ceb910c,0xd615feea,0x88ca8cea,0x6aefefbf,0x8ceb910c,
-0x6b374f4f,0x80a988ca,0x1b4f4f5b,0x80898cec,0x1e0e9b9b,0x84898cec,0xa5b57569,0x84aa8d0c,0x6f1f1f1f,0x80a988ca,0xf8fdbebf,0x8089952e,0xf4d4f8f4,0x8ceb88ec,0x66e6e5fa,0x88cb90ec,0x6e6f1f1f,0x84aa8cec,0xf0acac6d,0x84aa88ca,0xb5b56474,0x8cec952c,0xb90679b9,0x8cec8cec,0x9f9be6f0,0x84ca8cec,0xfdeeffff,0x8cec8cea,0xebebeaba,0x88cb8d0c,0xabffffef,0x88cb912e,0x9fe7f2f4,0x84a99d70,0xbfbe3f5f,0x84aa8cec,0x8b8b6e6a,0x808988ca,0x64540d4b,0x84a988cc,0xa49095be,0x8cec90ec,0x50a86a6b,0x80448910,0x6fdbda95,0x84ab90ea,0x5550015,0x80238d0e,0xcfdbbafd,0x88cb8cec,0x7e7d1f5f,0x84aa952e,0x4b475556,0x806888cc,0xb87c2d1f,0x80898cec,0x155bebfe,0x84aa910c,0x155454,0x802288ee,0x50d6ebfa,0x8cec950c,0x14544000,0x8044912e,
-0x7e2e2f2f,0x8067994e,0xe2f9f9be,0x8088910c,0xf4f8f8bc,0x8088952c,0x3d2d1f0,0x88ca994e,0xef6f6ae6,0x8ceb910c,0xd7dbbf7f,0x88cb8cec,0xff6f1f0b,0x8067952c,0xeba7a5f9,0x8cec952e,0xafffafaa,0x88cb8cea,0xfe5f5f6f,0x808888ca,0xfabffeba,0x8ceb910c,0x91a5a5f9,0x88cb910c,0x41d0f4f8,0x88ca952c,0xff7e2f57,0x88cb910e,0x6f1f1b56,0x808888ca,0x15094f4,0x8489910c,0x3d1a87d7,0x8089910c,0x5681e1f9,0x88cb910c,0xf8fdafff,0x8088910e,0xbe2f47e1,0x88cb994e,0x6a6fbf6a,0x910e9950,0x54555555,0x80009db6,0x55fa65f9,0x910e994e,0x15559555,0x80229152,0xb6fbe5f,0x8cec952e,0x81f8bf6f,0x84aa910e,0x55e9be0f,0x88cb992e,0x6f161540,0x84ab910c,0x977e0b,0x88cc950c,0x50aa5a05,0x80459132,0x541bd0fd,0x84ab952e,0x5050040,0x80218cec,
-0xffffffff,0x80008400,0xffff,0x80008000,0xf0fffff,0x80008000,0xf0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffff,0x80008000,0x0,0x80008000,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xc0c0ffff,0x80008000,0xc0c0,0x80008000,0xffffffff,0x800088cc,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xcfcfffff,0x80008000,0xcfcf,0x80008000,0xffffffff,0x8000808a,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x80008446,0xffff,0x80008000,0xffffffff,0x80008004,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008022,0xffff,0x80008000,0xffffffff,0x80008006,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x800084a8,0xffff,0x80008000,0xffffffff,0x800090a6,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008862,0xffff,0x80008000,0xffffffff,0x80008008,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008046,0xff000000,0x80008000,0xffffffff,0x80008cec,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800080ac,0xff000000,0x80008000,0xffffffff,0x80008088,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008486,0xff000000,0x80008000,0xffffffff,0x80008090,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008930,0xff000000,0x80008000,0xffffffff,0x80008caa,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008048,0xff000000,0x80008000,0xffffffff,0x80008022,0x0,0x80008000,0x0,0x80018000,0x0,0x80008000,0x0,0x80008000,0xcf000000,0x80008000,0xffcfcfcf,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008464,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008466,0xff000000,0x80008000,0xffffffff,0x80008046,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008046,0xff000000,0x80008000,0xffffffff,0x80008468,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x8000806a,0xff000000,0x80008000,0xffffffff,0x80008d34,0x0,0x80008000,0x0,0x80018000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800088c6,0xff000000,0x80008000,0xffffffff,0x800084ca,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x8000994e,0xff000000,0x80008000,0xffffffff,0x80008d96,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800084ac,0xff000000,0x80008000,0xffffffff,0x800084ac,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008088,0xff000000,0x80008000,0xffffffff,0x80008048,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008cc8,0xff000000,0x80008000,0xffffffff,0x80008486,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800080aa,0xff000000,0x80008000,0xffffffff,0x80008ca8,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008866,0xff000000,0x80008000,0xffffffff,0x80008046,
-0xaafafffa,0x88ed9572,0xfe550016,0x80ab912e,0x56afafaa,0x84cb9d92,0xaabee040,0x808a88ca,0x6a6f,0x804684aa,0xfa800000,0x808884aa,0xf4f0a5a5,0x84aa84ca,0xe5bfbdf9,0x80aa84aa,0xa9aaaaaa,0x8ca9a658,0x56aafff9,0x808888cc,0xea5a0505,0x88aa9db2,0x5515bbff,0x808984aa,0x9bbfffaa,0x80ab88cc,0xd7909085,0x806984cc,0x7fbefaea,0x80ab8d0e,0x76f1f1f,0x88ed9d72,0xe0965f7f,0x8089954e,0xbffef4e0,0x808888a8,0x4b4f9fa9,0x808984aa,0xffbea647,0x84aa84ca,0x9b9baf9f,0x80668488,0xaaaa5b9f,0x84698486,0xfefefaff,0x84a988ca,0x9aaafffe,0x84878c88,0xa96a96d7,0x84ab8cec,0xfffba550,0x84cb890c,0xbeb5e203,0x84ab88ec,0xfafffefe,0x84aa80ca,0xffefbfff,0x84aa80aa,0xfad1eaeb,0x806684a8,0xffebfbf7,0x808788aa,0x42476fff,0x808a910c,
-0xffe90000,0x84aa9d70,0xfe50aaaf,0x808988cc,0xbfff9500,0x84aa9992,0xfff9a56a,0x84aa88ca,0xe0e05bff,0x8ced9970,0x905064a0,0x890e9d90,0xaffffe5a,0x84ab8cee,0xff950006,0x8089952e,0x5abfaa40,0x84aa9550,0x6bfffe55,0x84aa8cec,0x56aaaa69,0x84aa9170,0x5bfffa9,0x80898cec,0x95afafaa,0x84ab8cec,0xaaaffdf4,0x80898cec,0xfffee656,0x80898d0c,0xbeabbebf,0x84aa88ca,0x155fff9,0x806884ca,0xef6b4b5a,0x8488848a,0x9495aaff,0x80a988ca,0x2fbefaea,0x808988aa,0x7affeef,0x808888ca,0xfefef581,0x84aa90ec,0xfefda60b,0x84aa88ec,0x9a2fbfbf,0x808888cc,0xffaa9a5a,0x808784ca,0xf856076f,0x808a8d0c,0x6bfefee9,0x808988ca,0x16a59555,0x84cd84ec,0x576f5aa4,0x84ab84cc,0xfef8e541,0x808884a8,0xf5910006,0x808988cc,0x56526fbe,0x808980cc,
-0xa55aaaaa,0x80688488,0xfaf9f9a9,0x808780aa,0xfae5e595,0x80668888,0x2f2fbfff,0x84688cca,0xeaeadacb,0x806784a6,0xbffefeea,0x808888ec,0x171b1b1f,0x88eb9970,0x9091915a,0x8d2e9d90,0x1b2f7fbf,0x84a9952e,0xe4e09051,0x84ce952e,0xfdf8a040,0x84cb8d0e,0x8f4b7afa,0x808a84aa,0xfef9f4f4,0x84a988ca,0x9f4f8fef,0x80688088,0x79bfffe,0x846688aa,0xf7ffbba3,0x88a98ca8,0x2f3f7f7f,0x88a8992c,0x2f1f2f2f,0x8066950c,0xf4f4e0e0,0x84a99d6e,0xfefdfdf9,0x808884a8,0x6d2e2f2f,0x80a988ca,0xfffffbab,0x84cb88ec,0x9fdfdfee,0x84aa84cc,0xebfbab0a,0x84cb8d0c,0x6b9b5f9f,0x806784ca,0xbf7f6f6f,0x84aa88ca,0x95aea5f6,0x808888a8,0x95d0c0c0,0x806780aa,0xaaffffbf,0x890d912e,0xe7d695a4,0x84cb952e,0x6f7f7fba,0x80aa8d2c,0x8b4f0f0f,0x84aa952e,
-0x965b6fbe,0x84aa88ca,0xbfa9f9ea,0x80678cca,0xbffae5d5,0x806784aa,0xfef9babf,0x848888a8,0xbfbeebbf,0x84a988ca,0x8b8bbeff,0x848884a8,0xe4faffe5,0x84a984ca,0x7fbef9fb,0x8089910c,0xaaba5f6f,0x848988a8,0xff968596,0x84678888,0xaffabe6a,0x848888a8,0x2faffafe,0x80668cec,0x6bbfbfff,0x808990ea,0xe091420b,0x84cb912e,0xa9691203,0x84ed8d50,0xbfaffffc,0x806784a8,0xbffefeeb,0x808790ec,0x21b1f2f,0x84ca996e,0xe1961b2f,0x88ca9d6e,0xfef8e0e0,0x80888cec,0xf4e09040,0x80a9912e,0x6f1f7efd,0x84cb8d0c,0xd7bbffff,0x84cb84ca,0xe5f9e9ea,0x88ec912e,0xafaaf8f4,0x806780aa,0xfaf2cb9f,0x84a984a8,0xf9f8abaf,0x84aa8cc8,0xbbbdbeba,0x84aa8cec,0xbfbffffb,0x84ca88ec,0xffffefab,0x84cb88ec,0xd5959aab,0x808984ca,0x2f7ffffb,0x80a9912c,
-0x55aa5501,0x88a88d74,0xfcbeab56,0x80aa88ca,0x55aa5500,0x88878974,0xffaa5655,0x80ab90ec,0xaaaaaffe,0x808884cc,0xfaa9aaaa,0x808988ca,0xeabefeff,0x84aa88ca,0xbffffef6,0x808984aa,0xaaaa9500,0x84888156,0xbfbf6aa9,0x8ced952e,0xfffee994,0x88aa8ccc,0xa9fffaff,0x84ab88ee,0xffaaffff,0x84aa8ccc,0xaa5bffff,0x808888cc,0xffffa594,0x808884cc,0x9555066f,0x80898cea,0xd506afff,0x808884aa,0xe46b6ae5,0x84a98ccc,0xffffbebf,0x84aa8cca,0xfffefdf6,0x808984aa,0x97abfde0,0x806888a8,0x91aa7ea6,0x848888ca,0xfbfefebf,0x88a988aa,0xea465596,0x80458488,0xffebaa55,0x808988ca,0xbfffffff,0x84cc84ec,0xaf6ffef8,0x808884aa,0xafffffff,0x84cb88ca,0xffbf7bb9,0x84aa88aa,0x2ffefeff,0x808880a8,0xfa5556aa,0x846888ca,0x4081ffff,0x848888ca,
-0xffff6b05,0x808984ce,0xfa0fffff,0x84aa84aa,0xbfaf5500,0x808a84ee,0x6f55ffaf,0x84aa848a,0x17bffeea,0x808990ec,0xfffee400,0x80888cea,0xd041afff,0x846888aa,0xdbdbfffd,0x80688488,0xaaaa9500,0x80458954,0x3fc0eaaa,0x84aa84aa,0xfaeaaa94,0x84ab890e,0xa41bfffe,0x80cb84ca,0xff7fc156,0x806888a8,0xffdfbe7f,0x84888888,0xaa95affa,0x806688aa,0xff46aafe,0x806888a8,0x5fe4fabf,0x808984a8,0x6abfffff,0x84aa88ca,0x2ffeeaff,0x848890ec,0xa9a5ff96,0x848888ca,0x6baae956,0x806880a8,0x5bfff6b,0x8cec952e,0xa945fffe,0x808984aa,0xf94607aa,0x808988ec,0x9007bfff,0x8468990c,0x7eaaafbf,0x806788aa,0xfe9001ff,0x84878cca,0x4506feea,0x806684aa,0x16feaa6a,0x84ab890c,0xeffe9401,0x80888cec,0x5bfffe,0x84ef912e,0x566bffe5,0x808888ee,
-0x7febe590,0x80668cca,0x606a6f6f,0x88ec8d2e,0x592bfff,0x80a98cec,0xf9a95140,0x80a98d0c,0xfef9a969,0x808990a8,0x55a6fff,0x808984ca,0x4656fef9,0x80468488,0x57e70aa,0x890d890e,0x14bafebf,0x84cc8d0e,0xffeaaa1a,0x846684a8,0xf8970705,0x80a988ec,0xfffeaf69,0x80448486,0x69b97e3f,0x84aa910e,0xe4900005,0x80898d0c,0xe59090f8,0x84cb952e,0x8b9bfff5,0x808984aa,0xaaaa1605,0x88aa84ec,0xf986969a,0x806880aa,0xfae59000,0x808984ec,0x111a6fbf,0x84cb910c,0xb1f7fbe,0x84a9910e,0xe0d04102,0x8089952c,0xf9e4d090,0x8089910c,0xef0fbffd,0x808884aa,0x411b6ff9,0x80aa8cec,0xfef9e080,0x80a98cec,0xfaa59046,0x84aa88ca,0x70bafff,0x84ab88cc,0x60b6fff,0x808988ca,0x6f6afae6,0x84a9912c,0x9590a4bf,0x808988ec,0x90ffffaf,0x8045990e,
-0x6bbff990,0x80ac9150,0x6f1b0615,0x804690ec,0x156affe,0x84cc890e,0xe9948040,0x808988ca,0xaf9faf6f,0x806880aa,0xfffffaab,0x88ca8d0c,0x5696eafd,0x808984ca,0xffeb5a1a,0x84aa8ccc,0xe595959b,0x80a9892c,0xafbffee9,0x80a984cc,0xfffe9a05,0x808784a8,0xaafeffff,0x84aa994e,0x951b1b7a,0x88cb910c,0x5b5bfdd0,0x806884aa,0xffe44001,0x80a98cec,0x79a5d7af,0x806888ca,0xbfbffaff,0x808a88ca,0xfef8eaaf,0x88cb8cec,0xaaa95bbf,0x808988ec,0xffafafaa,0x88cb88cc,0xbffff9fa,0x84aa910c,0xab9b5f2f,0x84aa8cea,0xe9eaffff,0x808a84ca,0xabaf6fae,0x84c98cee,0xd6c55565,0x808988ca,0x3ffffeea,0x80898cec,0x82471f2e,0x84898cec,0xb8f0f0d1,0x80888cea,0x3f3f3f3f,0x80aa952e,0x3f3f2f2f,0x80aa8d0c,0x2e6ebdb9,0x806888ca,0xfefe6f1f,0x80aa84cc,
-0xe9eaeefe,0x80a9890c,0xe4e4e8e9,0x808988ea,0xe2e2f2eb,0x80a9910c,0xd1e1e1e1,0x80a99d90,0xdbcac9d8,0x80aa88ec,0xa5d0c1c1,0x84cb88ec,0x979692d1,0x80a99d90,0x7f1f0f9b,0x84cb8d0c,0xebebfbeb,0x80a988ea,0xdbfbfbeb,0x80a980a8,0xe1d1d287,0x8089912e,0xf1f1f1f1,0x84a99d90,0xbf4b8b8b,0x808980aa,0xbcbfefef,0x80aa88ec,0xf1f0f0f0,0x84a9910c,0xd8e6e3f2,0x84a98d0c,0xfe7f6f07,0x808788ea,0x9096d4e8,0x80c9910c,0x56a4b4fd,0x84ca88ea,0xaf5f4b0b,0x808884ca,0x2e0f5190,0x84c9954e,0xe6fffa7d,0x80878d0a,0x90d5f9fa,0x80888cea,0x2f0b0240,0x8488954e,0xf9f5f5f5,0x84cb88ea,0xf5f9f9f9,0x88eb8d0c,0x66a6e6e6,0x84cb8cec,0x9fabe22a,0x84ca88ec,0xbf6f57a6,0x84c988ea,0xa4f4f9bf,0x80a8912c,0xa5f5a5ab,0x88ec910c,0xce9392a5,0x84cb88ea,
-0xffdb8b6f,0x84cb88ec,0x2f7fffff,0x84aa952c,0xbfbaa5e0,0x88ec952e,0xadbe7f7f,0x84aa8d0c,0x5b6f1f1f,0x84a99950,0x87879b5b,0x8089952e,0x4feeedad,0x80aa84ca,0x9b9f5f5f,0x84aa88ec,0xf5feffff,0x84cb88ec,0x3978f0f0,0x80aa912e,0x965b1b2f,0x8088a1b0,0xe0e0d091,0x8089910c,0x3e3e3f3e,0x84cb9990,0x3e3e3e3e,0x84ec9550,0xfcfcfcf4,0x84aa8cec,0x6f6f1e69,0x84ab952e,0x9f8b8787,0x80aa8d0c,0xefefffef,0x88ec88ea,0xdb8b8f9f,0x84cb88ec,0xbebf7feb,0x8d0c952e,0xbfbf5a5a,0x88ed8d0c,0xfbffffbf,0x88eb910c,0xaafef9f9,0x8cec912e,0x97464656,0x84cb8d0c,0x393d3e3e,0x84ca912e,0xaabdbd39,0x88ec912c,0xae5f6f6f,0x84aa88ca,0xf4b8bc6e,0x88cb8cec,0x96eaffaf,0x88ec8d0e,0xfeaaaa55,0x80aa8d0c,0x6a7ffbf6,0x8cec910c,0xbe695955,0x84aa8d0a,
-0x6b1a5a46,0x80888d0c,0x81e4fdbf,0x80a8952c,0x81d0febe,0x80888d0a,0xaf4b5641,0x84a988ea,0xfaba2901,0x8d0b954e,0x51f4f9fa,0x996fa5d0,0xd2e0f4be,0x80a8910c,0xfdbe0f4b,0x8d0b912c,0x2f1b4290,0x80a8a190,0xead0a47e,0x8088912c,0xb4bd6f9f,0x84a9912c,0x4b92e1e0,0x84a9996e,0x6f5b5aa6,0x88eb994c,0xaaaa6fbf,0x80888d0a,0xba352a0f,0x808788ca,0x1210d0d5,0x910c954e,0x7d1f1b02,0x80a99d6e,0xc2c2eabe,0x88ca910c,0x60b4f4f9,0x9d6e9d90,0x6bababa5,0x8d0badd2,0xbeffffaa,0x8d0b912c,0x7fbeba79,0x88eb910c,0xbe6f6f2f,0x84a9912c,0x80d5d5fa,0x84a88d0c,0x8181c1d5,0x8088910c,0xf4d59581,0x954e954c,0x2f6f6b17,0x8d0b994e,0x6f6f1f1f,0x8088912c,0x1050a0a5,0x954da5b0,0x753a215,0x8d0ca190,0x6dbeafaf,0x808880a8,0xad6c6c6d,0x804684ea,
-0x1f1eaaea,0x84c9954e,0x7f7f2f2e,0x84aa994c,0xbdaeafff,0x84ca912c,0xf8f8f8f9,0x88ca9d70,0xb8b87c7f,0x8088994e,0xa4a4faba,0x88ca910c,0xf9f4f4f4,0x84ca954e,0xf4b4f4f9,0x84ca8d0c,0x792f1fef,0x84ca912c,0x4796e6e5,0x910d912c,0x90fdbfbf,0x84ca952c,0x6e1f0753,0x88c9912c,0xa6665647,0x910d9d6e,0xfafaa6a6,0x8d0c952c,0xf5f4ecfa,0x84c98d0c,0xebebdee9,0x84c9910c,0x64f9f4a0,0x912d994e,0xf9f9a464,0x8ceb952e,0xa9faf4f4,0x8ceb8d0c,0xeffffefd,0x88eb910c,0xe490a9fa,0x84c988ca,0x79a9e9e5,0x80888d0a,0xfba691a5,0x8ceb912c,0xf4f5ffff,0x80a88cea,0x55bffffe,0x8ceb8d0c,0xefefefaa,0x84a988ea,0x695daeaa,0x84a988ea,0xbf6b7fbe,0x88ea912c,0xabaaaaaf,0x84a988ea,0xef13cfaf,0x84c980a8,0xbe6a56aa,0x84c9912c,0x6a6faffa,0x80878cc8,
-0xafbefdf4,0x808884ca,0xab5b0b4f,0x84aa88ca,0x9aeaeaef,0x84aa80a8,0xfaaaaaaa,0x80888cec,0x91fae6ab,0x88cb8cec,0xe9e59080,0x84aa952e,0x1f7fbffe,0x88cb952e,0xb5a27a6f,0x8d0d910c,0xfaffffff,0x84a98d0a,0xe6feaaaa,0x84aa84ca,0xebdb9781,0x80ca84ec,0x5a8a949a,0x80ca88ea,0xd090d0d1,0x8089996e,0x68145090,0x84a98cec,0x6f07070a,0x84aa8cec,0x5b5f1f1f,0x808988ca,0x7f7fbebd,0x84aa952e,0x7f7e7e7e,0x84aa910c,0xe0e0f4f5,0x910d994e,0x90e0d0f0,0x994fa190,0xd4d1e4bd,0x808884ca,0x9581d0d4,0x84c98cec,0x1b3b1a15,0x9d6fa9d2,0xbe2f2f1b,0x84aa9d8e,0x1f6f6b6b,0x88cb910c,0x1b1b5b1f,0x88cb910c,0x6e6f2f2f,0x808788ca,0x2f6f7f6e,0x808784ca,0xe0a4a959,0x84ca994e,0xb4f4e4e0,0x84a9a190,0xb5b1f1f,0x808788ca,0x8a0b0a0b,0x808888ea,
-0x9febf60b,0x84cb88ec,0x2e2f0f4f,0x88cb996e,0xabd69090,0x84ab910e,0xe0f4bdff,0x8089952e,0xf9d0e4b9,0x808988ec,0x65a554a4,0x84ab910c,0x1f5b4190,0x8d0ca5b2,0x85d5bf2f,0x806888ec,0x4a7fba7e,0x84ac88ec,0x6f665a0a,0x808988cc,0x50f5fee5,0x84cb84ca,0xa9febaa5,0x88cc910c,0x90f9febf,0x88cb9d70,0xf6a4504,0x912da190,0xff0b0655,0x808988ec,0x556995fd,0x8ceb9d90,0x99a96868,0x84cb890c,0xbda8a455,0x80cb88ea,0xfa564081,0x84ca8cec,0xbebfbafa,0x84ca912c,0x29297e7d,0x80a988ea,0x2e3e2e2d,0x84a9952c,0xadfdbdbd,0x80a988ca,0x999d9d9d,0x808888ea,0xff01ea3f,0x804688ca,0x65a590ff,0x80a9990c,0xfa2e0150,0x84cc952e,0x550156e6,0x84aa88ec,0xe2f6da95,0x84a988ca,0x1f4bc7c2,0x84ca954e,0x5beafffe,0x8cec8cea,0xf9be6f6f,0x8088910c,
-0xbf1b0195,0x84a988ea,0x1a41d0fd,0x84c9910c,0x95d1e5ba,0x808988ea,0xe9af6f5a,0x808788ea,0x13675810,0x8ceb912c,0x1f0f4f07,0x84a98d0c,0x5a4580d0,0x84c98cea,0xfde4f4aa,0x88ea910c,0x74a6a6b5,0x80a88cec,0xbffaa5a5,0x84ca8cea,0x8cccedda,0x8d0c8d0c,0xf6f6f777,0x88ca8cea,0xf9feffbf,0x808784ca,0xd7d7e6e5,0x80a988ea,0x8edeeef5,0x88ca8cea,0x6f5f8f8f,0x808788ca,0x7e7e7f6f,0x80a8912c,0xd5e5f9fe,0x8088912c,0xe0f4e0e5,0x952ca190,0x6b7ba2a0,0x954e9d6e,0x959090d5,0x8088912c,0xf4fdffff,0x84a888a8,0x6f6f6faf,0x88eba1ae,0x2f2f2f6f,0x8066994c,0x161b97d6,0x88ea912c,0xbdfdfa6a,0x8d0b952c,0xbe7ebfbf,0x808784a8,0xa8bcbdbd,0x808780a8,0xa0a0b5f9,0x8d0ca18e,0xe4e0d0a0,0x84a8a16e,0x1f1f1e29,0x806784a8,0xb0b0b1f,0x804684a8,
-0x2e2f2f2f,0x84a9996e,0x1f1f1f2e,0x8088994e,0xfdfdad99,0x84a988ec,0xbdbdfdfd,0x80888cea,0x2e2f2f1f,0x84a8994e,0x7e7e3e2e,0x84a8994e,0xbd7d7dbe,0x808888ea,0xb8bcbdbd,0x8088912a,0xbe7f3f2f,0x80a99d6e,0xd1d1e6fa,0x804580aa,0x5190e0f4,0x8ceba190,0x6f6b6611,0x954eb612,0x4e9ec9d1,0x80a988a8,0xe772df4f,0x808884ca,0xeb6f2f1f,0x8067910c,0x9bd09dea,0x808884a8,0xf9e5fabe,0x80878cea,0x69a9f9f9,0x84a888c8,0xd6b0f0f4,0x8487952c,0xf96f1f5b,0x80888cea,0x5454a4a4,0x84a888ca,0xe5e4e458,0x84a98cea,0x5a72abab,0x84a984a8,0xffffffbf,0x88c988ea,0xab4f4bdb,0x808884a8,0xf0e98e8f,0x84a888c8,0xbf2f0a0b,0x88c9910c,0xffabfeff,0x84a988a8,0xeaeaaa6a,0x84a98cea,0xefcfabea,0x88ca88ca,0xafbffffe,0x8cea910c,0xcbcbcbab,0x84a9952c,
-0xfffffaaa,0x84aa8d12,0xaad0f6af,0x84aa88ca,0xffaffee5,0x88ac90ea,0xaaaffffe,0x808984aa,0xffaaaabf,0x806788a8,0xfffe01af,0x848890ca,0xbffffffe,0x8467950c,0xfffff901,0x8488950a,0xafffaf01,0x80898d2e,0xfa04fffb,0x80a98088,0xffaf0100,0x808a9950,0xbfb49bea,0x84ab80aa,0x5ffffaf,0x8067910a,0x5baffb00,0x808788ca,0xffffbf,0x84a98cea,0xa5a6ff90,0x808884ca,0x960654a6,0x80468488,0xfed05fff,0x84cb8cec,0xbfe495fa,0x84678488,0x5affaa06,0x88ed9572,0xf950066a,0x84cc9550,0x5abff,0x806684aa,0xfffe4001,0x84aa912c,0xae006aaf,0x806884aa,0x1afffaf,0x80898cec,0xfffaa4,0x8d0e9972,0x541affff,0x84cb8d2c,0x66ffe,0x8d0e9550,0x56aff900,0x808a910e,0xfaf0014a,0x808988aa,0x556afffd,0x80898cec,0x56fffda5,0x84aa88ca,
-0xbfa55440,0x8ceca5d6,0x56aabaff,0x80ac8cee,0x41aaaaa9,0x80aa912e,0xafaafa1b,0x80aa88a8,0xefff96,0x808988ca,0xba6aaf9b,0x808984ca,0x556fffff,0x808888aa,0xaa5556aa,0x806884cc,0xaaaeaa05,0x80678930,0xa9fe6f90,0x80ab910c,0xaaaaaa00,0x84458532,0xfaaf40aa,0x808a8cec,0xa5d4bbfb,0x80cc84cc,0xfe550102,0x806888aa,0xaaefaaab,0x80ac84ca,0xff550040,0x806784aa,0xa5005bff,0x80a98d0e,0xe900015b,0x890d9950,0xffa901ff,0x84cc8d0e,0xff550001,0x84cb9970,0x5505aaff,0x804784ca,0x955bffaa,0x84aa84ac,0xf94056ff,0x808684aa,0xfeff16fe,0x84ac88ca,0x56fe54ab,0x84cb8d0e,0xffa90000,0x84aa9972,0x55fffaaa,0x84cc9150,0xfffa4000,0x88cc9550,0xff81a5af,0x808984a8,0xabfffceb,0x80aa8cec,0x6fffaa6a,0x808888ca,0xfaffffaa,0x84cc90ee,
-0xbfffea80,0x808984aa,0x5bfffff,0x88cb910e,0x55066fff,0x88cd9530,0xf9550616,0x84aa910e,0x6fbffed0,0x80898cec,0xf4e5572e,0x84aa910c,0xa9aaaf6f,0x80898cec,0xe6d69695,0x806884aa,0x1afef95a,0x8cee9d52,0xfffee000,0x80a98d0c,0x5abffa,0x8ced9950,0x46afffe4,0x808888ca,0x5a065ebe,0x808a84cc,0x824b6fae,0x808a912e,0xf5f8e595,0x80ab84ec,0xf2f7da5,0x84cb8d0c,0x5b5f6eb8,0x808988ca,0xf9b9aa9b,0x808a84ca,0x7e7dfaea,0x84ab8d0c,0xfff6fabe,0x84cb88ec,0xf9f5e5f5,0x80aa88cc,0xefdbc68a,0x84aa88ca,0xaaaaaabf,0x808a80ca,0xa1b17574,0x80888cea,0xa9bdf1e1,0x84cc9d70,0xd1979a5a,0x84ab8cec,0xbef9d287,0x84aa8cec,0xb2f2f7f,0x88cba192,0xd5d1d1d1,0x808988cc,0x4746c5c5,0x806784aa,0x83834307,0x88ed954e,0x5f4b8792,0x8089952e,
-0xe90106bf,0x84aa910c,0xffaeabff,0x80aa88ca,0xffe440aa,0x80a888ec,0xabeae9af,0x84aa88ec,0x966afefa,0x84aa84ca,0xbee4d0ea,0x80898cec,0xfe955a6f,0x806888ca,0x1eafbff,0x88cb992e,0xffff9502,0x808a912e,0xd2f7fbfe,0x84ca8cca,0xeafffe00,0x84aa8d0c,0x5b475baa,0x808984aa,0xbffefcd4,0x808880aa,0xe856065b,0x88a98d0c,0x16abffff,0x80678d0c,0xfffe5001,0x80898cec,0x91561f6f,0x88ca9d70,0xfdf8e4d0,0x80aa912c,0xbffde400,0x80a988ca,0xd2864b5f,0x806784ca,0x1f1f6fbe,0x808888ca,0xbebf6f2f,0x84aa952e,0xd0d0d1d2,0x806684ca,0x81c19094,0x806888ca,0xa991fffd,0x806780ca,0x6b2f2f7e,0x84cb910c,0x4106afff,0x808788ac,0xf9a49040,0x808988cc,0x1666a767,0x912fa5b4,0x1b171312,0x84cb9d70,0xa4a9fefe,0x80a9910c,0xf4f4f4,0x952ea5b2,
-0xeafeaa00,0x8089890e,0xff0555aa,0x88a98cca,0xffff6a50,0x8089890e,0xff0055fa,0x806690ca,0xaabffefe,0x84ab84ec,0xff795455,0x806888aa,0x4180e5ff,0x8447912e,0xef101415,0x80678088,0xbfaa5500,0x84898ccc,0x1a00eaff,0x80688cec,0x6aaa1500,0x848888ee,0xe5e5ffaa,0x80aa88ca,0x51f6faf,0x80aa88ec,0xff555500,0x806688aa,0x64b415fe,0x890e912e,0xff954100,0x806784aa,0x55ffffaa,0x88ec9550,0xffff0000,0x84aa912e,0x55ffffaa,0x88cc9992,0xffff0000,0x84aa910c,0x5bffaaa,0x848984aa,0x1abfffe,0x88ee992e,0x4001ffaa,0x8069808a,0x55ffff,0x8d109d70,0x55fffffa,0x84cc9d92,0xffbf0000,0x84aa910e,0x55ffffaf,0x84cc9992,0xffaa0000,0x808a954e,0x5554fea9,0x806784aa,0x55faff,0x8d309d92,0x55ffea,0x80688cec,0x40a9ffaf,0x9571a1b2,
-0xf95a5414,0x8068890c,0x6fbfabaa,0x88ed8d0e,0x5f955540,0x84888d2e,0xfdfeaa2f,0x84ed8cec,0xa4fef9ab,0x88ed8d0e,0xff2f2a14,0x808888aa,0xf9ffffff,0x84cc84ec,0xff50a4a4,0x806888ca,0xbfbea505,0x8089890e,0xfffeaabd,0x80cb88ca,0xaaea5a00,0x80678930,0x5bbfaaa6,0x84aa84ca,0xaaefffff,0x80ab88cc,0xaf555556,0x806784ca,0x9eaf66a7,0x84ab80aa,0x5a555595,0x808888ca,0x55ffbfff,0x88ec9570,0xffaa0000,0x84ca9d70,0x95ffaaff,0x84cc9550,0xff6a0000,0x88eca1b2,0x40a9ffff,0x806888ca,0x1aaffaa,0x890ea1b2,0x85059abf,0x80688088,0xfeff5a,0x8d0e9572,0xaabfaaff,0x88cc910c,0xbf550000,0x88eda5d2,0xaa1affff,0x84ab8cec,0x56554055,0x8d0ea9d2,0xea00aaff,0x80678088,0xa4ffab55,0x88cd9130,0xaf40eaff,0x804784aa,0xbe1f41ea,0x84cc88cc,
-0x5bafff40,0x808988ec,0xfe95955a,0x806880a8,0x5556ff55,0x806888ec,0x6bfffe95,0x808984ec,0x405abfff,0x84aa910c,0x5b5bfe90,0x806784a8,0xa5000106,0x8888952c,0x59affff,0x806688ca,0x5555ff55,0x806788aa,0x55aaffaa,0x808888ca,0xaaa9ff55,0x80468cec,0x6945fffa,0x848984aa,0xff540000,0x84899950,0x55ffff,0x84889d6e,0xff550000,0x84899530,0x55ffff,0x88a8a190,0x59e00506,0x848a84aa,0x2fbeea96,0x806888ca,0xfae50400,0x848788ec,0x90d1afbf,0x80888cca,0xaf1a0a1b,0x806684a8,0x55eaffff,0x80898cea,0xfaf4f4f4,0x88ab8cca,0xffab57aa,0x804684a8,0xbefea400,0x806688ec,0x1faa5a1f,0x806688a8,0x1ffff54,0x8488992a,0x7dbfbe28,0x80668cca,0x41faff2f,0x806790ea,0xfa55a56f,0x80688488,0xbafffefd,0x84888cec,0xff55aa01,0x80668cca,
-0xaaeaaf00,0x806788a8,0x1555ffff,0x8489952e,0xeaff1600,0x8489990c,0x55ffff,0x848788ec,0xff014000,0x88ab952e,0xa5ffff,0x8047952c,0x16a49550,0x88ca9d70,0xf9eaffbf,0x804684aa,0xff060050,0x8467992e,0xe0febfff,0x808784c8,0x69094a5,0x88ab952e,0x9febfebf,0x806684a8,0xf9fffa6a,0x8cec994e,0xffbe0b81,0x806790ec,0xa63f86fe,0x848a88aa,0x56b4699a,0x90ed992e,0xfeff1b00,0x80669550,0xa4d1e0f8,0x80668cc8,0x2f160080,0x88a79d6e,0xffebfa7f,0x804684ca,0x5fffaff,0x8488990c,0xffa9fee4,0x846788ca,0xe4462fbf,0x84a99d4e,0xff5aebff,0x806688a8,0xe0e4f9ef,0x80468cca,0x91e191d0,0x88a99d2e,0xfffe2e1f,0x84678cca,0x8b8b9feb,0x80468488,0xfffee4d0,0x8067910c,0xfffdaaaf,0x808784a6,0xeadacb8f,0x84678888,0xab172ffa,0x848988ca,
-0xa5eaefff,0x808988ea,0xfa9bc695,0x88cb88cc,0xf8bd3e1,0x8488910c,0xf9bf2b1f,0x808a8cea,0xaaf979b9,0x88ec910c,0x595ffbf,0x80888d0c,0x81d59ff9,0x84cb88ca,0xf95a0601,0x806784ca,0xffbba787,0x808884aa,0xa6f1f8fd,0x84a9a190,0xfffebe3e,0x84aa8cec,0xbfbf9fff,0x808984aa,0xfebf6f0f,0x8088952c,0xbf4550e9,0x84a98cea,0xb91e0fd,0x84a9994e,0x91f9f97f,0x84a988ca,0x42f4a555,0x8cec9d70,0x95e5ff1f,0x808988ec,0x65bf0641,0x8cec952e,0xff6f0250,0x84aa994e,0xbe1f6faa,0x88ca8cec,0xfbfaa5f4,0x84ca910c,0xff54a9ea,0x80aa88ca,0x470101ff,0x84a9952e,0x551190fe,0x84aa952c,0xf505465,0x88ca9d70,0xffab,0x80888cec,0x50fef955,0x952d9d6e,0xfb50a6ff,0x806884ca,0xa16d05ff,0x88eb8cea,0xffe5ff07,0x80888cec,0x96e5f9ff,0x84a98cec,
-0x47d1b4bd,0x8089910c,0xaae5ff1f,0x84aa8cec,0xbee74b81,0x84aa88cc,0x7f4bf1bd,0x88cb8cec,0xe4ffbf6b,0x8089994e,0xeabf0740,0x84aa994e,0xbf5a55a9,0x808990ec,0x1f4190fe,0x8ced9d70,0xd1f5bf1e,0x80888cea,0xd9e3bbab,0x80a984ca,0x7f160100,0x88cb9d70,0x2f02e4ff,0x8067910c,0xaa419108,0x80a988ea,0x55feff,0x84a9a5d2,0xfae5e6fd,0x84a988ca,0xfaffff,0x84a99d6e,0x80e45aaa,0x808884a8,0xaaffff96,0x952da5b2,0xff4740ea,0x84a98cea,0x56aabffe,0x952d9d6e,0xeaff0600,0x8089952c,0x5f4f9b9a,0x84a988ca,0xff6b0050,0x84a9a190,0x65a5aaaa,0x88cb952c,0xff91be03,0x84ca8d0c,0x955a59ff,0x84ca912c,0xffff5a00,0x84a9a5b2,0xab01e9ff,0x84a9910c,0xbf004095,0x8ceb994e,0x516656fe,0x910c994e,0x6a000156,0x8ceb9d6e,0x50055ff,0x80888cea,
-0x6e0b8fdf,0x806784aa,0x55d5f4f8,0x8d0c9d6e,0xe4be6f0b,0x84ca952c,0xbf1f0b9b,0x804684a8,0x60b4a465,0xa190b214,0x7f1f0702,0x84a99d6e,0x541d0fa,0x88eb952c,0x60f4f465,0xa190adf2,0xff054041,0x88a9994e,0xaaa4adfa,0x88ea90ec,0xff000606,0x84a9952c,0xaf9aeaff,0x8ceb910c,0xfaafaf9f,0x80678d0c,0x6d1b46e1,0x8d0c9d6e,0x4b9aaaaa,0x88ca910c,0x91a46f5f,0x806788ca,0x9580e4fd,0x80678cea,0xfeffffaa,0x88c988ea,0xbf1f0701,0x84c9994e,0x964beaf9,0x84a888ca,0xfafaabff,0x8ceb910c,0xff5f5ffe,0x8ceb910c,0xe5faaf5b,0x88ca910c,0x81feaa0b,0x8ceb952c,0xa1f8f5f9,0xa5b0b634,0xeaae5f0b,0x8088952c,0xa9bf5f46,0x952da18e,0x1b555595,0x90eaa9f2,0x1b7baeea,0x910b952c,0x2f4af5ae,0x88c99d6e,0x5050febf,0x8ceb9d4e,0xd0feffa5,0x88a9a18e,
-0xfff9fd6f,0x88ca910c,0xbafeffff,0x910c952c,0xbfbf6b55,0x88ca952e,0xeaaa6b6b,0x8ceb952c,0xaafffaba,0x994e9d70,0xaf565569,0x84a9950c,0x80fffefa,0x952d952e,0x55baf090,0x994e9d6e,0xf9f9a450,0x910c952c,0xff69a9a9,0x88ca950c,0x6faf5605,0x88ca8cec,0x6eaaa96,0x88a988ca,0xa5ebffab,0x8ceb90ea,0xf4fafffa,0x910c994e,0x4696eb99,0x84a98cea,0x6faf1b07,0x8cc9910c,0x1a81f9bf,0x84a9910c,0x54a5fabe,0x9d6ea190,0xf95b1b16,0x8087910c,0xfeaa0295,0x88ca952c,0xf9a90651,0x88ca994c,0xff6f5696,0x84a88cca,0x1ba5a4aa,0x910ba5b0,0xaa41e9bf,0x808788c8,0x6baa9490,0x88a9952c,0x83e6fe1f,0x84a988a8,0x91e5fa6a,0x88ca950c,0xff561654,0x80678cea,0x94fbfebf,0x992da590,0xaefa2f41,0x84a9992c,0x956f6bf5,0x910c992e,0xff460055,0x84a99d6e,
-0xa5f090a0,0x992f994e,0x40f97f56,0x8068994e,0x16afafe6,0x88cb94ee,0xf96f0000,0x8067952e,0xfffbff5a,0x84a988aa,0x95ffffff,0x8088a5b2,0x5b075ba4,0x80688488,0xaaffafab,0x8068992c,0x559a95ff,0x886584cc,0xff000040,0x8488910c,0xeabafeff,0x848880cc,0xaa0055a9,0x8089910c,0x6940baf9,0x808888aa,0xffffffaa,0x8489992a,0x5505aaff,0x8046910c,0xffffab9a,0x84888d0c,0xffab0000,0x8089a16e,0x540ffff,0x84888cea,0xff560000,0x8489a590,0xa9ffff,0x806790ec,0x1005055,0x88ea994e,0xaaff,0x806788ca,0xa5aaa9,0x8ceb994e,0x5540ffff,0x806884a8,0xff550000,0x88a9a5b2,0x650ffeff,0x84aa8488,0xff550000,0x8ccba9b0,0xff6affff,0x80688088,0xffff1a,0x910c9d2e,0x5555fffe,0x802688aa,0xafab40,0x90ec9d4e,0x5555ffef,0x804788aa,
-0xaf061bff,0x848888a8,0xaa40a9aa,0x808a910c,0x95e400ff,0x88aa90ec,0xff0501aa,0x88aa8cec,0x5555bfff,0x804688ca,0xaaffaa56,0x8068950c,0x950066ff,0x84a98cca,0x56fffea9,0x84899d4c,0xaaffe006,0x8cec9d50,0xffa51516,0x84aa9d50,0x1afffffd,0x84aa90ec,0xabffe400,0x8489910e,0x5600155b,0x88aa8cec,0x55bffffe,0x84aaa592,0xea540019,0x88ab950c,0x156afff,0x8488a170,0xff550000,0x88caa590,0xff005aaf,0x80478488,0xff950000,0x84899d70,0xbf00016a,0x806884aa,0x16bffe,0x910c9d2e,0x5555ffff,0x804788aa,0x15ff,0x88a9992e,0xea29ffff,0x806884a8,0xfffa0000,0x8ccb994e,0x5a00005a,0x80898ccc,0xaaff9500,0x88cb9d4e,0x55505051,0x88cc992e,0x550055ff,0x8489910c,0xffe9ffff,0x84a98cca,0xa900faff,0x848990ec,0xbf7f1aff,0x8ceb910c,
-0xfeffa955,0x88ca88ea,0xffffae,0x80888cca,0xffefaa55,0x808888ca,0xffffaa,0x84888cca,0x55bfff55,0x88a9910c,0xfe551500,0x84aa90ea,0xa5aeff55,0x80888cca,0xab5590e4,0x8488910c,0xeafaa655,0x848988a8,0xffffff,0x8067950c,0xffffaaa9,0x848884aa,0xffffff,0x8488992c,0xeaeaff55,0x84888c88,0xe5a5aafa,0x88a988ca,0xffffff55,0x84888ccc,0xaf01aaff,0x84888cea,0x9ae16fd0,0x848788ca,0x56014045,0x84a98cca,0xff6b50ff,0x80889d4e,0x4198f9fe,0x8cea88ca,0x41d5fe6f,0x848790ec,0x1a955455,0x950c9d6e,0xff1b0705,0x808890ea,0x50aa69f5,0x8ceba16e,0x6f00eaff,0x8488952c,0x5055a9fe,0x88a9950c,0xa5ffff,0x80879d4e,0xa5e5ff07,0x8cca910c,0x5a000500,0x88a98cea,0x55e5ffbf,0x84a99d4e,0x65b9e5e9,0x8ceb950c,0xf9af6b16,0x848890ea,
-0xff5faa55,0x84898488,0x40ffffff,0x8067950c,0xbfe5a7aa,0x84888068,0xa9ffffaa,0x8067950c,0xffffff00,0x848890ea,0x5690feff,0x88ca8cea,0xffffbf00,0x80679d2e,0x9affffff,0x88a98cca,0x5aa9afaf,0x848984a8,0xeaffaf5a,0x80678888,0x19aafebe,0x88a984aa,0xffff6a00,0x848890ca,0xffff0640,0x8467992c,0x55bffff,0x88aa90ea,0xff5a00a5,0x8067950c,0x556effab,0x848888aa,0x50feff6b,0x84a99d6e,0xffff1b00,0x84a99d6e,0xe9bf5b41,0x8488910c,0xbf460000,0x88a99d4e,0xfd59bfbf,0x8cca8cea,0x6b5694b8,0x88ca8cea,0x6aa9fefe,0x8cca952c,0xa9e91695,0x84a990ea,0xffaa6555,0x80678cca,0x415554e9,0x8ccaa990,0xab054559,0x802588a8,0x5a9f9ff,0x8ccba16e,0xaa80ff2f,0x848790ea,0xbf0690aa,0x806690ea,0xfebf0600,0x8488950c,0x1a4ffaf,0x8066950c,
-0x6f5f1b6f,0x808784c8,0xd0f4f9be,0x84a8912c,0x95d58080,0x84a888ea,0x9f5b0505,0x80878cea,0x1f41d2d1,0x910b994c,0x7f2f2f7f,0x88c9952c,0xbeafaf9b,0x808788ea,0xf4f4f8bd,0x84a9994c,0x4e4e0b0b,0x84c9952c,0xaacd8848,0x84a98cea,0x2f2ecbde,0x80a888ca,0xe6c7c69b,0x808884c8,0xbaaaaaaa,0x84c988ca,0x96e6fa6a,0x88c98cea,0xd5d5e6e6,0x808784c8,0xbaa3a2aa,0x808884a8,0xf5f9fefe,0x8cea952c,0xd4e8d0f4,0x912c910a,0xc7c2e2e1,0x88c98cea,0x1b1b0b87,0x88ea994c,0xb8f1f0f0,0x912c9d6e,0x579796a9,0x88e9a1b0,0x7f3f2f2f,0x8d0b8d2c,0x78bdbeba,0x912c996e,0xefefbfaf,0x808788ea,0xadadbeef,0x806684a8,0x92e2f1fa,0x84a7a5b0,0x1e0e4a42,0x8067952c,0xe8f8b8ad,0x806788a8,0xf4f9fdf9,0x848888c8,0xfee1f96e,0x84a888a8,0xffea9afa,0x84878cca,
-0xf0f3939,0x84878d0a,0x8287474b,0x84c99d6e,0xbfbefcf8,0x80a8910c,0x1b6f6faf,0x88ca952c,0xc7c38383,0x88e9994c,0xab9bcfcf,0x88a8954c,0xeb9b5b1b,0x808788ea,0xbfbfefdf,0x8088912c,0xe9ea6fbf,0x84a984c8,0xbda5a9b9,0x84c98d0a,0xfefababa,0x80878cea,0xe2eefefe,0x80888cea,0xa6e51519,0x88ea910c,0xf0f0f2f3,0x88c99d6e,0xe5e6f4f4,0x808788ea,0xfffbe6d1,0x808788ca,0x8fcfef7b,0x808884a8,0xdfcfea9f,0x806688ca,0x2f7f7fbf,0x88c9a9d0,0xd2830b1f,0x84a9994c,0x6b7f7eae,0x80a888ca,0xaaffffab,0x8088954c,0xb9f8f4e0,0x84a8952c,0xbfffffbf,0x84a884c8,0x6db8b4b0,0x8087910c,0x5f0b4b5e,0x84a88cea,0xbafafaff,0x80878cea,0x3e39b8b9,0x84a8952c,0x95469baf,0x84a8910a,0xdaeaea95,0x808884c8,0x6f3e3f3f,0x84c9996e,0x1b1f1f1f,0x84a8996e,
-0xb0b0b07,0x8486994c,0x3f2f2b0b,0x84a7954c,0xf5f4b474,0x8d0c956e,0xa05596f5,0x8d2c994e,0x2f2f2929,0x8065910a,0x7e7e7e2e,0x8487994c,0x90a09060,0x914c9d6e,0xe0909090,0x88eaa5d0,0xe9e5e4e4,0x80868088,0xffaffef9,0x808680a6,0xfe9e0e6f,0x84a7992c,0x4b1f7bff,0x8486910a,0xafffaffd,0x806684a6,0xdf8f8f9f,0x804584a8,0xfffffae1,0x8086994c,0xcb1f3fbf,0x88a8994c,0x7f7f7f7f,0x84879d6e,0x2d3c3e7f,0x84c9954c,0xf4f4e0e0,0x80a79d6e,0x5f6ebdf8,0x80a888ca,0xffaae69b,0x84a888ea,0xf9f4bdbe,0x84c98cea,0x9687efaf,0x80a880a8,0xfaead5d5,0x808888ea,0x5aab9f4f,0x808788a8,0x9969baaf,0x84c984a8,0x2036f2e2,0x808688a8,0xbffcbe5a,0x84c984ea,0x3f7fffff,0x80a88cea,0xd1838b1f,0x84c9912c,0xbcbdd2bf,0x80a888ca,0x87475b6e,0x808788ea,
-0xb2ff8e0,0x84879d6e,0x7ff8e042,0x8066994c,0xbeb8a547,0x8087950a,0xe0e6db6f,0x8487952c,0xd1871b2f,0x84a8a18e,0x5b5eb8f0,0x806588ea,0x8b8fbdf8,0x808784a8,0xd5c1c5c6,0x80458088,0xe9c6c686,0x80668488,0xbfffffb9,0x848788c8,0x17171b1b,0x88eaa5b0,0x90501116,0x954da5b0,0x2f2f6f6f,0x80889d4c,0x571f1f2f,0x912ea9b0,0xe0e09090,0x912ca9d2,0xf9fdf8e4,0x994da5d2,0x5d44a6ab,0x808784a8,0x81969695,0x808884c8,0xbefefae6,0x8088952c,0x1f2f7f7f,0x88ea994e,0xfdf5d280,0x80a888ca,0x1f2f7ebe,0x84c9994e,0x5102071f,0x88ca954c,0xf4f4e490,0x8ceb9d8e,0xf0f64303,0xa190a9d2,0xf8f4f0f0,0x954da1b0,0x1a1f7ebd,0x8ceb954c,0x96460a1a,0x80a8954e,0x6fbebef8,0x84c9912c,0xe6d69faf,0x808784ca,0xbefde9e6,0x80a98d0c,0xad6a1b6f,0x808888ea,
-0xe1e0e0e0,0x8066910c,0x91d2d2e1,0x84c99d6e,0x7f2e3e3e,0x808788c8,0x1f5f5bbf,0x808788ea,0x51515191,0x910b994e,0x38241410,0x910c994c,0x9eae6f5f,0x80878cea,0xf5b9fefe,0x84a888ca,0xfdf8f8f8,0x8087992c,0xa45565fe,0x8ceb994c,0xcf5fda4b,0x88ca84a8,0x92e5faff,0x88ca910c,0x6aba65a4,0x910b952c,0x404091f9,0x80878cea,0x2fbfead7,0x84a9994e,0x1f1f0b0b,0x88caa18e,0xb9b97938,0x994d9d6e,0xe4a4b4b4,0x994d9d8e,0xe5e5e1f5,0x84a88cea,0xd6d1d6d5,0x80878cea,0x64f8f8f4,0x954da18e,0xf4b4b4b4,0x912c996e,0xc1d6d6d6,0x80878d0c,0xd6d6d1d1,0x80878d0a,0x9b5b4741,0x8ceb910a,0x26269b9b,0x8ceb910a,0xaaaa7e1e,0x88c9952c,0xb9f8aabf,0x952d996e,0xbbbb3726,0x8d0b912c,0xfb56b7fb,0x80a88cea,0xbfb91519,0x912c994e,0x1f0a6fbf,0x80888d0a,
-0x96fcebea,0x84a888ca,0xff460646,0x806784a8,0xba8fffff,0x88ca88ca,0xffa9a9ba,0x84a8910c,0xf46a2fbf,0x8ceba5b0,0x50b5e0e0,0xa5b0adf2,0xdbfaf8fe,0x84a98cea,0xa9d1c1c2,0x84a8952c,0xd6d5ebeb,0x84a98cea,0xfaeadada,0x84a8910c,0xc7c7cbcb,0x88c9952c,0xd3c7c7c7,0x88ca994c,0xdfdbfbea,0x88c98cea,0xe1e1e6db,0x84a8952c,0xd3d3d3d3,0x88c9a190,0x81819192,0x84a99d8e,0x1a6af450,0x8087994e,0xf9faaa55,0x994d9d6e,0x51b1f,0x8cea994c,0x6f1f5600,0x8ceb912c,0xbebaf8f4,0x8ceb954e,0x1e2e2e7e,0x84c99d6e,0x499bebf,0x88ea8cea,0x58989454,0x80a98cea,0xf9f9e4e5,0x88c9994c,0x79b8f9f9,0x88c9912c,0x90905081,0x88c8a5b0,0x90808080,0x910ba5b0,0x6e7a7e7e,0x88eaa18e,0x5f5f6f6f,0x88c9a9f2,0xd0d0d0d0,0x912ca9d0,0xd0d08080,0x8d2ca5b0,
-0xa9a9f8f8,0x88ca890a,0x1f1fae6d,0x84a988ea,0xe5f9a6e6,0x84a988ea,0x7db4f0f9,0x84a988ca,0x4b4b5f1f,0x8ceb910c,0xd1c2c687,0x88ea912c,0x6f6f7e7e,0x80a88d0c,0x9b0b0b5f,0x84a98cea,0xffeb4156,0x84c9910c,0xf4e0e1fb,0x88ca954c,0x974b4e4d,0x84a8954c,0xe0d1c293,0x80a8910c,0x293e7db8,0x8ceb954e,0xea809055,0x80888cea,0x6b6bf9f8,0x88c9952c,0x7f6a1015,0x84c9910c,0xb8f8e4e1,0x84a9910c,0xf4f6e7d,0x80a888ea,0x46ebeb97,0x88c98d0c,0xfae69040,0x88ea8d0a,0xe1cb5b1f,0x88ea88ea,0xfae564a4,0x84a988ea,0xefeffafd,0x84c984ea,0xabfbfeff,0x84ca8cea,0x41069bef,0x88ea912c,0xbfbf6a15,0x8d0c996e,0xf9fd747a,0x8d0b910c,0x8494a5f2,0x80a88d2c,0xaabfbfbf,0x88ea8d0c,0xd682569a,0x808888ea,0xbee6d1c5,0x84c9912c,0x1b1f2f7f,0x890c996e,
-0x4f0f1f1f,0x84a7912c,0xa7ab6b4b,0x84a98d0a,0xc5d68a85,0x808684ca,0xfee4e0c0,0x80a884a8,0x859596a6,0x84ca88ea,0xc0808080,0x806688ea,0x6f6bbfbf,0x80879d8e,0x1b1b1f1f,0x8d0ca5d0,0x1b1b1f1f,0x8d0ca9d0,0x2526171b,0x996eae12,0xd0d0d0e0,0x84a99d6e,0xe5d1d1d0,0x8067952c,0xe0e1a060,0x9d8fa9f2,0xb4b1f4e4,0x994da1b0,0xe5e5e6e6,0x808884c8,0x7f7ebee9,0x80a884a8,0xbfeae5d4,0x80888cea,0xb1f2f2e,0x84a99d8e,0xf0f14307,0xa5b1a9d2,0xb4b4f4f0,0x9d6fadf2,0xa0a2570b,0x9d8fa9f2,0x69f9f4f0,0x994ea5d2,0x7fbf79b4,0x994ea190,0x91860b5f,0x84ca910a,0xaa5b6ab9,0x8d0b9d6e,0xe0c1c6cb,0x84a9952c,0x5f6f6f6f,0x80878d0c,0xbbffbf6f,0x88ea910c,0xbf7df8f4,0x808888ea,0xb078f9f,0x804684a8,0xbe15166b,0x88ca8d0c,0xe4e0fafe,0x84c984ca,
-0xf9f4f5fa,0x80a988ea,0xbdf9f8f8,0x808888ea,0x6f7e7ebe,0x84a98d0c,0x95f6fbbf,0x88ea8cec,0x5f6f6eae,0x80aa88ea,0xdb95aaab,0x808784c8,0xf9e59647,0x80a984ea,0xb7ebefa,0x8488996e,0x6eb8f4e0,0x84ca952c,0xd6c2825a,0x808888ea,0xbdf4e5d7,0x84c9910c,0x72f3f7f,0x910ca1b0,0x72fbff9,0x84ca996e,0xfde04106,0x80879d6e,0xf4f0a191,0x88ea996e,0x1fbfeffd,0x808788ea,0x8b7fbeef,0x84a8910c,0x8b8ba996,0x806784c8,0xfffde043,0x84a99d4c,0x1b7fbeff,0x84c99d8e,0xae9aebd6,0x80a884ca,0xe0919699,0x808784ca,0xfe950207,0x84889d6e,0x1529beff,0x84c988ea,0x20b6fff,0x80a8996e,0x50f9f541,0xa190adf2,0xb9e44002,0x996ea5b0,0x91160aaa,0x88eb9d8e,0x6ffff440,0x80a8912c,0xf55c5a6b,0x88ea88ca,0x5516affa,0x80678d0a,0x7fbf9585,0x80a988ea,
-0x9092070b,0x910d9d8e,0xf4e46464,0x88ea994e,0xeacbe9b8,0x84c988ea,0x470f6ffe,0x808788ca,0x9b0fafff,0x808884c8,0x501affea,0x84c9952c,0xfea4a5ab,0x84c9912c,0x814006ff,0x80a88d0c,0xb1f6fba,0x808884c8,0xaaf4a415,0x84c988ea,0xfee5f8fc,0x84ca88ca,0xfffffcfc,0x88ca8cea,0xafeaeaea,0x88ca88ea,0x1b6ebeaf,0x84a98d0a,0xabbbbfbf,0x88eb952c,0xf4d0865a,0x84aa8d0c,0x1abbba50,0x996ea9d2,0xbff8e095,0x8088952c,0x6db4d1d1,0x80a888ea,0xfad6875f,0x808888ea,0xb8a4d5af,0x808784c8,0xe0950b1f,0x8d0c996e,0xa0561f7f,0x8ceb9d8e,0x7ffff9a4,0x912d9d90,0xf9914307,0x88ca912c,0x915b7ffe,0x8d0aa190,0x575b7ebd,0x84c9994e,0x5df9d080,0x8d0b952c,0xa6fea850,0x8d0c9d6e,0xe0ab7f6a,0x890c914e,0x856bbab6,0x910c996e,0xab5efce0,0x80888cea,
-0xbeadf4f0,0x80a9910a,0xc0421f7f,0x84a8954c,0xd0825a56,0x808788ca,0x1fbffdf4,0x8088996e,0x1f7efde0,0x8088910c,0x64b04207,0x954d996e,0xf8f49107,0x8d0b996e,0x106bffd,0x88ca954e,0x2fbefafa,0x8088914c,0xf4e0820b,0x8d0b952c,0xa4a1430f,0x8ceaa190,0x55aa9bac,0x910b994e,0x6f9babb9,0x88c98d0c,0xfee8d18b,0x80a888c8,0xeee18645,0x8088910a,0x1f2f7fff,0x8088950c,0x61bbef8,0x88ca910c,0x1f6da4d1,0x84c9910c,0x69a0e0d6,0x88eb8cea,0x80908157,0x8ceb996e,0xa5ba7a1f,0x910c994e,0x95a5f9f9,0x88ca910c,0xd5c1d080,0x80a98d0c,0xdad6dbdb,0x80a98cea,0xbefeffef,0x88ca9d6e,0x2f2f2f2e,0x8d0b9d90,0xa1a2564b,0x954da5b2,0xf4f0a0a0,0x910ba190,0x2b1b2f2f,0x910b9d90,0x171b1b2b,0x910ba1b0,0xf8f8f4f4,0x88ea9d6e,0xe8a8b8b8,0x88ca952c,
-0x56a5faf4,0x8ceb910a,0xf4d14206,0x84a8910c,0xe081162a,0x84a8994e,0x76ffff8,0x8067954c,0x71f2ffe,0x8067912c,0xf8f49041,0x88ca910c,0xf9a49001,0x88ea952c,0x5a1a6afa,0x80a888ea,0xffffbef4,0x8087992c,0xe4e0066b,0x84c9910c,0x422ffffb,0x84a9954c,0xffefad90,0x84c98cea,0x6abfaaa9,0x84ea8d0a,0xbef8e996,0x80a9890a,0xfce056af,0x84c98d0c,0xe9415b6f,0x84ca910c,0x4b9fafbe,0x80a888ca,0xdbd7c246,0x80a888ca,0x6afefeea,0x88ca954c,0xe6aa561a,0x80a8994e,0x6f6fae9b,0x808880a8,0x5f6f6f6f,0x806788ca,0xfa963efa,0x84a98cea,0xf995a5a9,0x806784ca,0x5096afaf,0x8cea952c,0xafea0100,0x84c9952c,0xeafffaf6,0x8d0b954e,0x6ebfa994,0x88ea910a,0xffbff446,0x84a88cea,0x2bffffa,0x8088910c,0xff5a1b1a,0x84a9910c,0x40056bff,0x80a8910c,
-0xbfbfffff,0x88ca88ea,0xafbfbfbf,0x88eb910c,0xaabfbf6f,0x84ca8d0c,0xbeeaeaea,0x8088954e,0xeed6d6aa,0x84a98d0c,0x21b2fbe,0x84ca994e,0x911b1f2f,0x912da5b0,0xfdf0e090,0x8ceb8cea,0x2fbefee9,0x84a9912c,0xe0960b1f,0x8d0c9d6e,0xf4b4a55b,0x912d9d90,0x2fbffef8,0x8d0c912e,0x2f7df4f0,0x952d9d70,0x96565b2f,0x84ca910c,0x90425b1f,0x88ca954c,0x5f2fbdf5,0x84c9910c,0xfef9f491,0x8ceb994e,0x46576fbf,0x88ca912c,0x461b6abe,0x88c9910c,0x6fbde5c1,0x84a98cea,0x6ffef4d1,0x84a9910c,0xffa55647,0x808788ea,0x96aa6b6f,0x84a988ea,0x1bbff5fa,0x80a888ca,0xaf7de4e5,0x808888ea,0xe9f4e7db,0x88ca910c,0xd595e687,0x84ca88ca,0xa9fffeea,0x88ca88ea,0xaaaaa9e9,0x80a888ea,0x5005bfff,0x80878d0c,0xff9a1a5b,0x808888ea,0xf9e069ff,0x88ea952c,
-0xaa1a7f2e,0x84ca8d0a,0xf4e5dbdb,0x84a988ea,0xaeb8f8e4,0x80878cea,0x96075f6f,0x808784a8,0x9f5f6fbe,0x80a888ca,0x3ef4f99b,0x8ceb954e,0x2fbef9ea,0x8088996e,0xa0d1471f,0x84c9952c,0xf9514607,0x84a888c8,0x2b2a79b9,0x84a888ca,0xfffef9f4,0x84c984ca,0xbebefeff,0x84a98d0a,0xf4e0c28b,0x8087912c,0x6afbafbd,0x84c9954e,0xebdb6f3f,0x84ca88ca,0x5fffaea,0x84a9952c,0xffffd106,0x88ca952c,0x4b86bfff,0x88ca88ca,0xabbfbf6d,0x88ea910c,0xaafeaa6a,0x84ca8cea,0xfffae400,0x80a888ca,0x5bffe946,0x88ca954c,0xaaffff95,0x80a884c8,0x11bffa9,0x910b996e,0xfaffb905,0x8ceb952c,0xd6efeaea,0x8cea8d0c,0xaffffe00,0x88ea912c,0xaa01065a,0x80a98cea,0x96bfffea,0x84a9910c,0x9400566a,0x890b9d6e,0x5aaaffff,0x84c9994c,0xfe940005,0x84a8a190,
-0xa9e0466f,0x910c994e,0x962f7fea,0x88ea912c,0xbafff950,0x912ca190,0xfff40116,0x88ca954e,0x511bbffa,0x84a98d0c,0x9faffea4,0x88eb952c,0xf990556b,0x84a9910c,0x6fbf821f,0x8ceb912c,0x16fabaa,0x912ca1b0,0x565bfee0,0x8087912c,0xf9400155,0x88ea9d6e,0x55a9bfff,0x8ceb912c,0x6fffe95,0x88ca994e,0x906abfa4,0x88ca954c,0x9055ffaa,0x84c9954c,0xea5f1fff,0x88ca88ea,0xffffebeb,0x8d0b912c,0xa5fefeff,0x8d0b996e,0x6fffe656,0x84c9910c,0xaabffffb,0x8d0b954c,0xfff95050,0x88ea954c,0xfe50011b,0x8088996e,0x6bff9555,0x84a88d0c,0xfffe4000,0x8ceba5b0,0xffffaa,0x84c9912c,0x5555ffff,0x88ca8d0c,0xffffaf,0x84a8952c,0x55a5ffbf,0x8ceb950c,0x55bfffaa,0x88ca996e,0xffff5500,0x8ceb9d6e,0x15affff,0x84a9994c,0xffff5500,0x88c9a190,
-0x6ffe9401,0x84c9994e,0xaafa556a,0x912c954e,0x56fffe4,0x84ca912c,0xfefae555,0x910c952c,0xbaa9ff55,0x88ea912c,0xfff45096,0x8d0b994e,0xa9fefffe,0x8d0b910c,0xffffa5aa,0x88ca952c,0x1501abff,0x80678cea,0xbfffaa95,0x88ea912c,0x94a4aaff,0x88c98cea,0x9506fffa,0x80a8912c,0x6a7fbfbf,0x88ea910c,0xffff9a95,0x80a988ea,0xfa8195ea,0x84c984ca,0xfffffefe,0x84a98d0c,0x90ff5b55,0x80888cea,0x556aff01,0x8cea952c,0xfaff0001,0x8088994e,0x40f9be94,0x8cea994e,0x55ffab,0x8087994e,0xffff1500,0x8ceaa190,0xa5ff56,0x84a9994e,0xff160000,0x88c9a190,0xffbf0000,0x88caa1b0,0x4a9fd5ff,0x84c98cea,0xff6a0000,0x88caa1d0,0x10a6fff,0x88e98d0a,0xe5ffbf5a,0x84a9996e,0x1b500040,0x998eadd2,0xffaf0100,0x84a88cea,0x55a5f9,0x952dadf2,
-0x5babff6f,0x8cea952c,0x9f1f5f5f,0x88c9910c,0xf9fa96a5,0x910b952e,0xf5f9f9f9,0x8cea910a,0x1f1f1f5f,0x84c9910a,0x1f0f0f0f,0x88c98cea,0xf4e0a0a4,0x8cea910c,0xe4e4e4f4,0x88c9910a,0x6f5faffa,0x84a98cea,0x87afafaf,0x88c98cea,0xeafabf07,0x84a8950c,0xffffaaaa,0x84a888ca,0xfba6f5f6,0x84a88cea,0x5affff9f,0x8cea90ea,0xfffe1a6b,0x84a9950c,0xa5bfffff,0x8cea910c,0x5f5b1f1f,0x84a9910a,0xb1b5b5f,0x84c9994e,0x55b965e4,0x952c994e,0xa4b9a595,0x8cea952c,0x1b0b0b4b,0x80668cea,0x1b1b1b1b,0x8044910c,0xd0d0d0e5,0x8087910a,0xc0c0c0d0,0x806688c8,0x95455556,0x8ceb9d6e,0xa5efffa,0x84a8910a,0x6fbef4a5,0x90eb994c,0xc4e0d15b,0x910b910c,0x2163530b,0x952c9d6e,0x15151511,0x954ca9b0,0xb4fc6ecd,0x8cea88c8,0xa494f8f8,0x8cea912c,
-0xff6f40f8,0x8488a18e,0xfffffeea,0x88a990ea,0x1b40feff,0x8488992c,0xbffffeff,0x84a89d6e,0xabff0000,0x8487952c,0xea41aaaa,0x88a98cea,0x6affa500,0x88a9950c,0xbffa555a,0x88a9910a,0x40beaeaa,0x848788ca,0xaaffff17,0x84889d4e,0x6f55aaea,0x84a88cca,0x96ffab80,0x88a98cea,0x69abff40,0x88a9994c,0xa9bfbe55,0x88c98cea,0x55556faa,0x8cea952c,0xff00fafa,0x88c990ea,0xa4551bff,0x8cea952c,0xd77f6afe,0x8cea910c,0x6afee456,0x8cea910c,0xfff45516,0x84a9950a,0x6ffffde5,0x84a8950c,0x6f6f1f5f,0x84a9952c,0xa4fa565b,0x952c9d6e,0xf5f5f0a0,0x952c994c,0x6ffffe,0x88c9950c,0x25bfd90,0x8487910c,0xe900066f,0x88c9952c,0x14156fff,0x950ca16e,0xeaffa800,0x994da16e,0xfe5a569a,0x8cca952c,0xefff6a54,0x994d9d6e,0xab05015a,0x88c9950c,
-0x87474b0b,0x8087910a,0xb478787,0x84a8994c,0x4b8bc6d1,0x84a88cea,0x6f5f9b5b,0x88c9910a,0xbf7f2f0f,0x80a8910c,0xa864f9fa,0x84a888ea,0xf4f4bdbe,0x80878cea,0x6aeefaf5,0x84c984c8,0x1f0f1b13,0x88caa18e,0xd9e6b62e,0x80878cea,0x50a4f4f0,0x9d6ea9d2,0x5b525060,0x910b9d6e,0xaefe7ee9,0x84c98cea,0x5072bb9e,0x84a888ca,0xeaaa2f6f,0x80668d0c,0x6afdaeea,0x84c98cea,0x557ebaa4,0x84c98d0a,0xfaffea41,0x84a88d0c,0x9501055a,0x806688ea,0x157ffff,0x8d2ca9d2,0x86e09565,0x80888cea,0xab6a6f5a,0x88ca88ea,0x2f160110,0x8ceaa5d0,0x5541f9fe,0x84a988ea,0xfe500055,0x80878cea,0xb9fa5bff,0x952c9d6e,0xff555001,0x8087910c,0x1aaa9ff,0x994ea18e,0x90e0b4,0x8ceaa5d0,0xeafa1b01,0x80a8994e,0xf9ff6f01,0x8087a5b2,0xbf0740e4,0x88eaa18e,
-0xe9af6f6f,0x80878cea,0x15bae5e5,0x910c952c,0x4b96e0f0,0x8cea910c,0xfdae6f0f,0x808788c8,0x7619455,0x8d0c994c,0xd1ebbf1f,0x8087910c,0x555a95e5,0x88e99d4e,0x1f525050,0x910b9d6e,0x1e1f43f3,0x88c9952c,0x4bd1f469,0x80888cea,0xa90a55ff,0x88ca952c,0x1f5b91b4,0x8d0ba18e,0xe55d6b0f,0x806784c8,0x503d18e4,0x994d9d6e,0x4781f47e,0x806688ca,0xd0e4fe6f,0x80a890ea,0xff000540,0x80878cea,0x40ffabff,0x952d9d8e,0xaf80f8be,0x80878cea,0x656faaff,0x910b9d6e,0xffbf0100,0x88caa1b0,0x194feff,0x84879d8e,0xff160000,0x88c9a5b0,0xf4bffffe,0x84a890ea,0xff6f0350,0x84a89d6e,0x5100e9ff,0x8066910a,0x1541540,0x952ca5b0,0x41e07f1f,0x80668cea,0x2949544,0x8ceba18e,0x5796ffff,0x80878cea,0x68fefe5a,0x910ba18e,0xfaff2f41,0x84a89d8e,
-0x5555faff,0x8488910a,0x6affbe6a,0x910b992c,0xa9f9ff07,0x88c9952c,0xa5ffaa65,0x950b954c,0xa5000015,0x88a9952c,0xaa9566ff,0x88c9910a,0xfe000000,0x88a890ea,0x55fe55af,0x88c9950c,0xfaff0600,0x88a89d4e,0x41e5a6aa,0x8cea950c,0xff060090,0x8488994e,0xb9cffeff,0x8cea8cea,0xff550001,0x84888cea,0x15ffaa5a,0x8cca9d4c,0xff550000,0x80878cca,0x40aafe55,0x8cea952c,0xff550000,0x88a89d4e,0xe00054ab,0x952c994e,0xffa50000,0x88a9994c,0xafe9555a,0x88a8910c,0x6aa6e5f5,0x9d4e9d6e,0xeaf9a465,0x950c994c,0x16aff5b,0x910ba16e,0xbfffae15,0x910b952c,0xbfff0000,0x88c9910c,0xfabf0555,0x88a98cea,0x9aff0000,0x84a8910c,0xff560055,0x84a890ea,0xa4bf6f41,0x8cea952c,0xd2e5f4b4,0x88a9950c,0x5586d4fe,0x848888ca,0x57a7a1a1,0x8cea952c,
-0x1740f9ff,0x8488994c,0x955babff,0x84a88cea,0xc0fdbfff,0x80878cea,0xaafeff2f,0x88a890ea,0xfffe4050,0x84a888c8,0xf9feff00,0x8cea910c,0xffbf95a5,0x80878cca,0xffffff00,0x8cea910c,0xffaffee6,0x88a988a8,0x95ebffe4,0x84888cca,0xffffff6f,0x8488a16e,0x2eafafff,0x88a990ea,0xffaa5656,0x80478cca,0xafff4640,0x8ceb910c,0xff6a05a9,0x80468cca,0x56bfa5fe,0x8ceb9d4e,0xffff00a5,0x88c9950c,0x6af9a965,0x910b952c,0xffff00aa,0x88c9952c,0xf9cfaaa9,0x950c950c,0xbe5b5b1b,0x808790ea,0x545eafe,0x84a88cea,0x5555a5f9,0x8cea994c,0x590b5f9b,0x806684a8,0xff6b006a,0x84a9992c,0x61b556a,0x88ca8cea,0xff000005,0x84a9952c,0xfd0040d5,0x84888cca,0x2fbefae6,0x88a9994e,0x96965b1f,0x84aa992c,0xe09157ff,0x90eba16e,0xf5f9a4e0,0x8ceb994e,
-0x4590fabf,0x80878cea,0x40fafebe,0x910c994e,0xfe6f5b2f,0x84a988c8,0x6e0bd5f9,0x84a88cea,0xbe6f4100,0x8ceb9d6e,0x6f024be5,0x806688ca,0x5169a5a9,0x994dae12,0xa4f97f1b,0x80a89d6e,0x86405064,0x80878cea,0xbf7f6f8a,0x84a890ea,0x2e1f4b87,0x88a8952c,0xf4f5be3d,0x88c9994c,0xf4f5bebe,0x88c9952c,0x5ae6e0e0,0x80878cea,0x181d5e5,0x80668cea,0xa9aa5e06,0x84a988c8,0x95f8be,0x88eb994c,0xff6a0500,0x88c9a190,0xf86e1b55,0x8087952c,0x56651090,0x952ca5b0,0x590f1bfa,0x8cea910c,0x2f47a4a5,0x88ea9d6e,0xbe68b92f,0x8ceb910a,0xf8fefafa,0x910b994e,0xeb804040,0x80668cea,0x1e4feff,0x84a9992c,0x42fafaf9,0x84a8952c,0xfaafbf0b,0x8066910c,0xfd0b0001,0x8487952c,0x2f1f47d7,0x88c9910c,0x16455e4,0x88c9a5b0,0xe9e9ff2f,0x806684c8,
-0xf9b96556,0x950c994c,0x2a5f0f8,0xa16ea5b0,0x4681c0d5,0x84c890ea,0xf8fa5607,0x910b994c,0x2f6f0703,0x912da5b0,0xd6e5be2e,0x806688ea,0x94b4f4f4,0x9d6ea5b0,0x1b615190,0x994ea9d0,0x1f0b4783,0x8044910a,0xfaf9b92d,0x80869d6c,0x195afaf5,0x910b952c,0x5b767054,0xa16eadd2,0x4f4b87e6,0x80878cea,0xb4fdfeaf,0x952c9d6c,0xff6f1f5f,0x8087952c,0xe5469fff,0x806784a8,0xbfafebe6,0x80a890ea,0x5b5a65b8,0x804588ca,0xeabe3f1f,0x8087910a,0x19595a5,0x806788c8,0xa5fabf,0x84a9992c,0xfeff0600,0x84c99d6e,0xf9bf6f96,0x80878cca,0x7f060040,0x84a99d6e,0x56655064,0x994db614,0x8ad07e2f,0x80668cea,0x80d5e5e5,0x8ceb9d6e,0x7f1b1000,0x910ba9b0,0xbf164590,0x806788c8,0x14094fe,0x88c99d6e,0x960095fe,0x806684a8,0xa5ffff,0x84a8a5b0,
-0xff1aafff,0x80a884a8,0x6ebefeff,0x88ca88ea,0xff005596,0x80a884ca,0xaaff6bab,0x88ea952c,0xff975568,0x88ca8d0c,0xafffff,0x80a8996e,0xbfbea955,0x8d0c952c,0x56ffff,0x8087996e,0xbf05baaa,0x808884c8,0xfaaf05fa,0x84a8994e,0xaa00a5f9,0x806684c8,0xbf01a5ff,0x84c9996e,0xfaf1faf9,0x910b912c,0x55ffff,0x8087a18e,0x5a0bafff,0x808788ca,0xa5ffab,0x84c9a18e,0x96fffb14,0x910c952c,0x6a005555,0x808888ea,0xa9ffff00,0x88eb954c,0xa9005555,0x8067910c,0x55aaffff,0x84c9a5d2,0xfffa0000,0x84a89d6c,0x1aaffff,0x88eba5b0,0xffffa500,0x84a89d6e,0xaaffaf00,0x88c9994e,0xaa005555,0x80888cea,0xaaff1600,0x84a8996e,0xfa645455,0x84a88cea,0x6affff,0x910badf2,0xaaaffe50,0x84a88cea,0x15aff,0x84c8a190,0x5a5aff95,0x80668d0a,
-0xfa95ea6f,0x80878cea,0x154aaff,0x84a8a9d0,0xaa6a1b00,0x8087912c,0x55ffff,0x912cadf2,0xa954ffbf,0x80a88cea,0xaaffff,0x88c9954c,0x9a40ab01,0x80668cea,0x955aafff,0x84ca994c,0xfe919050,0x80888cea,0x5455ffff,0x8ceaae12,0xab0156aa,0x804688ca,0x105abff,0x84c99d6e,0xfaff6a00,0x8088910a,0x56016aff,0x88c8994e,0xafff0100,0x84a8910c,0x5500faff,0x88c9952c,0xfebf0000,0x88ea994c,0xff549595,0x80868d0a,0xff560000,0x84a89d6e,0xff55aafe,0x80a78cca,0x55ff,0x88c7a1b0,0xb9a5fffa,0x8d09910c,0x55ff,0x84a7a190,0x605afff,0x808688c8,0xbf550000,0x8d0ba18e,0xab0196ff,0x804584c8,0x56000054,0x84eaa190,0x550056ff,0x804584a8,0x500001ff,0x84e99d6e,0x6aff,0x806588ca,0xa50054ff,0x84c99d6e,0x95ff,0x806688c8,
-0xe651aaff,0x88c9910a,0xff006bff,0x88ea994e,0xff5556ab,0x80878cea,0xab40016b,0x84a9a18e,0x7f7abfff,0x8cea912c,0xffffffbf,0x80a888e8,0x80e4ffff,0x8044910a,0xffff9640,0x84879d4c,0xfff5a95a,0x80888d0a,0xfe550055,0x950badf2,0xafffea55,0x84a888ca,0x5a050001,0x88c9a5b0,0x4b4f9fff,0x84c9950c,0xff561656,0x806588ea,0x51affff,0x8087910c,0xffa90000,0x8087952c,0xaf550040,0x8ceaa9d2,0x5000faff,0x84c9910c,0x15590a5,0x910ca9b0,0xd0e5ff6f,0x80258cea,0xaf550040,0x8088910a,0x5055eaff,0x84a8994e,0x6afe5540,0x910c9d4e,0xf9febf1b,0x84a884ca,0x4b56e5a,0x952d9d6e,0xffffbf01,0x8088994e,0x554600fe,0x88ca910c,0xffbf0100,0x8ceb9d6e,0x15abaebe,0x8cea952c,0x9f410100,0x80888cea,0xa45595ba,0x8cea910c,0xb646f9f8,0x8ceb910c,
-0x55fffff9,0x80878d0a,0x1000054,0x8d0ba5b0,0x55ffff5a,0x84a888ea,0x50f9,0x994ea18e,0x5464ffff,0x806688ea,0x5a550044,0x88c98cea,0x5595ffbf,0x8087910c,0x5d5a5a5,0x8ceb910a,0x19ffeb55,0x84a88cea,0x490feff,0x994da5b0,0x90feff55,0x84a88cea,0x96feff,0x994da590,0x5956ffaa,0x8046954c,0x69ff6b56,0x952c9d4e,0x4169ff16,0x84a8950c,0xe5fa4100,0x950c952c,0x550195ff,0x8088910c,0x6f004055,0x88c9994e,0x5554fe6f,0x88c9910c,0xa4f9fa,0x952d9d6e,0x405596fa,0x88ca910c,0xe0ffaf56,0x88ca9d6e,0x55a5ff6f,0x88c9994e,0xff9a5656,0x84a9952c,0xa9febfa5,0x8cea952c,0x54feff6f,0x910b9d6e,0xff1b4155,0x88c9950c,0xaa6b46e4,0x8cea952c,0xfabf0700,0x88c99d6e,0x41f7bdad,0x950c992c,0x6f415094,0x88c99d6e,0x1556aafe,0x8cea9d6e,
-0xfac1e57f,0x804584c8,0x5506bf,0x890b9d4e,0x6f87d2e0,0x88c9994c,0x95faf4aa,0x910c994c,0x55ff0000,0x8088912c,0x6900ff6f,0x8cea952c,0xaafff900,0x84a8910c,0x500ffe5,0x84a9910a,0xfafaba6b,0x8cea952c,0x7ebf7fbf,0x910b994e,0xe1e1e1e5,0x84a88cea,0xaefee590,0x84a88d0a,0xaabffff9,0x88c98cea,0x40ffff,0x8088910a,0xbff96aaf,0x88c98cca,0x40e9ffaf,0x808790ea,0x4095,0x8cec9d6e,0xa9005aff,0x8087910a,0xf4fefe,0x9d6ea18e,0x2f14beff,0x88c9910c,0xfe00eaff,0x88c9994e,0xaaff,0x84a888ca,0xea00ffff,0x88ca994c,0xb5dd156b,0x8cea88ea,0x1ffaf5a,0x952da18e,0xf9e5ff5a,0x88c9952c,0xffaaaa,0x952c9d6e,0x6a6bbf15,0x8cea952c,0xbe05bf69,0x8cea952c,0xabafab40,0x88c890ea,0xfae4e550,0x8cea912c,0xaaeafff9,0x88c98cea,
-0x156abff,0x84a9952c,0xffff5601,0x88c98cea,0x54016aff,0x84a7910c,0x6fabffa9,0x88ca8d0a,0x67fbdff,0x88c9910a,0x55ff6f06,0x88a990ea,0xf4a4001b,0x8cea9d4e,0x55bf0054,0x88a98cea,0x1500ea6f,0x84a9952c,0xa5bebf6a,0x8cea950c,0xf4fdbf00,0x8cea994c,0xfd640050,0x90eb952c,0xffe54040,0x90eb994c,0x41fae5a5,0x84a890ea,0x1bfffaff,0x8cea952c,0x55fffb5a,0x88c9994e,0xefefaa,0x88c9910c,0xa5e9fe40,0x88ca952a,0xffbf6a,0x88c9910c,0x466aff40,0x80878cea,0xffebaaa5,0x8cea8d0a,0xaeffabff,0x8cea910a,0x2f0b0a46,0x84a888c8,0x81eb55be,0x950b952c,0xbfaa01,0x88c9910a,0x105bff9,0x848788ca,0x40550100,0x88c9994c,0x9000aaff,0x808688c8,0xa9f8a555,0x88c990ea,0x95ef95fe,0x88c98cea,0xe65fbfe9,0x88c8910c,0xbf2faaaf,0x90ea910a,
-0x1abffaa,0x84a88cea,0xfebfbf,0x910c994c,0x9afffa,0x808788ea,0x40ffaaaa,0x8cea952c,0x55a9ff40,0x88a9994c,0xfabba555,0x8cea950c,0x56bfbf00,0x88c9994c,0xff460505,0x88a98cea,0xfaffaa,0x84a8910a,0xffbf5a,0x88c9910a,0xfffffe,0x88a8950c,0xafaa55,0x8cc9952c,0xbeafff00,0x88c9952c,0x7e7dbd7d,0x910b994c,0x15aaffa5,0x84a8910a,0xf9f8e954,0x910b992c,0x1b90f96e,0x90eb952c,0x1f41f9bf,0x84a8910a,0x40ff0be4,0x8cea910a,0xe46f5b05,0x84a8950c,0xf0fefefe,0x952c9d6e,0xa4e5bf0b,0x88c9994c,0xebbf6f46,0x8cea910a,0xbe1f40b8,0x8cea9d4e,0x2a01f8af,0x84a8992c,0x1a5580f4,0x8cc9910a,0xe0febfff,0x8cc99d6c,0x90fe3f06,0x8ce9952c,0x6f07e5bf,0x88c9950c,0x80aaeabf,0x8cea994c,0xf4be1f56,0x84a9950a,0xfa7f9be5,0x90ea952c,
-0x40ebffee,0x8487910a,0x569641,0x88c9992c,0x15bfbf96,0x88c99d4c,0xa4005655,0x8cc8952c,0xaaaffe,0x8487910a,0xafefff95,0x90ea910a,0x802affff,0x84a8992c,0xeabfbfbf,0x8cea910a,0x6afeea,0x8487992c,0xfea40000,0x8cc9994c,0x55ffff,0x84a8994c,0xffff9000,0x88c8950c,0xaa405bff,0x88c9994c,0xaabeaaaa,0x90ea910a,0x5afe401b,0x90ea994c,0xbf909aff,0x8cea950a,0xaf0b465b,0x88c990ea,0x1f42e0fe,0x88a89d6e,0xfaf4fabe,0x90ea910a,0xa9beafaf,0x84a8992c,0x5681a9f9,0x88c9952c,0xe6f9bf6f,0x84a8992c,0xfe3f8be0,0x8ccaa5b0,0x5f0755e9,0x84878cea,0xe6ebab6a,0x8cc9992c,0xefba0be5,0x88a8950c,0xffaffaf5,0x950b950a,0x790fdff,0x84889d4c,0xe0bd7fff,0x88c9950c,0xf9be0b42,0x88ca992c,0x95e5ba2a,0x84a8a16e,0xf5bd6a5a,0x90eb952c,
-0xfebf0100,0x84aa996e,0xa901aaea,0x806684a8,0xbfa54000,0x88eca1b2,0x1605aaff,0x804584aa,0xaa41e4fe,0x8047910e,0xf97d65aa,0x84ca8cec,0x965a6f0f,0x80aa84ec,0xaff8e9a6,0x80aa88ca,0xaaaa5554,0x94eaa65a,0x90f4bf6b,0x808984ca,0x95ea6a01,0x88cba1d6,0xfe5b0155,0x84aa954e,0x7a7a50a4,0x84cc84ec,0xbe6a6a6a,0x84cb88ec,0x95ea,0x808684cc,0x86a44001,0x84cc88ec,0x5600ffff,0x806988cc,0xa995fa,0x9570a9d4,0xa5b04faf,0x808984aa,0x55aafefb,0x9150b5f4,0x5695ff6f,0x804784ec,0xaa40ffaf,0x808888aa,0xfafeff00,0x8489912e,0xf6bf9b9a,0x808880aa,0xfe6aa5aa,0x806880ca,0x41ff6f06,0x954f9970,0xaf555655,0x804684ca,0xaaffa4f9,0x88ec9550,0xffbf0100,0x84aa9d2e,0xffaaaafe,0x84a988ea,0xbf014054,0x8088912e,0x566faaeb,0x84aa88ca,
-0xfabfe9f9,0x88ee9592,0x695a4f9,0x8d50a5d2,0xebfeffaa,0x8489952c,0x51fafebf,0x9550a1d4,0x9495fe2f,0x806784ec,0xbfbf5554,0x84cb84ec,0xfa6e0200,0x808a9550,0x58ade5ee,0x808888aa,0xffafab05,0x80688d0c,0xa5afabfa,0x88ed9570,0xabeaaa00,0x80688d30,0x6c1feaf,0x84aa88cc,0x7545090,0x910da5b2,0x9595ff7f,0x806984ca,0x50a9f96f,0x912e9d92,0xfe6f1600,0x80ab954e,0xaa8080a9,0x808984aa,0x165afeff,0x8088890e,0xfabba756,0x88aa88ea,0x90fcbf6b,0x808884aa,0x41e55559,0x88ed9950,0x5595faff,0x846584f0,0x69bfe955,0x910e9d72,0xeaea7f02,0x808a8cea,0xaaaa5555,0x84ab88ca,0xff1b5555,0x806884ca,0x5aa5a5ea,0x80aa88cc,0x5a000055,0x806784aa,0x15ba56f9,0x8cee952e,0xff6f0000,0x80899950,0x5441a9bf,0x80898cec,0x1b959554,0x88ec9d72,
-0xa9eafeff,0x84cc9150,0xffff1f40,0x8888990a,0x95bf5f9b,0x80aa8cec,0xf515495,0x88a99930,0x91a4feaf,0x80468488,0xf0fa6f6e,0x84a988cc,0x6ad1ea7f,0x804584a8,0xabb6a5fe,0x80678486,0xaf41a5ff,0x808988ca,0x1a5f9ff,0x8ced9950,0xfeffaf56,0x808984ac,0xb92f9be6,0x80a98cec,0xbe6f5700,0x848a9d2c,0x5a45eafa,0x8047848a,0x6a65a0e0,0x90ee9d70,0xf9be2f67,0x88ab90ec,0x65b0a9e0,0x910e994e,0x2a1f1b16,0x88ca9950,0x393e8f9f,0x808988ca,0xf0f5b060,0x8cec912e,0x61f2f2f,0x88cb994e,0xfaf4a041,0x848a8ccc,0xfdf8f4f0,0x84aa84cc,0x61b7fbe,0x848a8cec,0xb8bc6f6f,0x806884aa,0xd1e1d0a4,0x80898cca,0x96c6e0f4,0x806984aa,0xab57569a,0x848a88ca,0xe6e1d1d1,0x808888ca,0x7ebcfdfe,0x84ab8cec,0x1fbffbab,0x84aa90ec,0x6eb9152f,0x8cec910e,
-0x6bffaa55,0x84ab8cec,0xeafdff4b,0x808880aa,0x5553d2a9,0x84cb84aa,0xbffdffeb,0x84aa88cc,0xa97e9f8b,0x808984aa,0x5190e0a5,0x88cb910e,0xe8fcfeff,0x806884aa,0xbe0e0f96,0x80678488,0x1601bfea,0x84ab88cc,0xf5febb6a,0x88cb8cec,0x9055faff,0x806a88ca,0x1f6f5a95,0x84aa88cc,0xafffffff,0x848884aa,0xe5547e1b,0x80478488,0xfedaffbf,0x88a984aa,0xebfefdbe,0x808884a8,0x6f1f5b56,0x84aa994e,0xf9febe7f,0x8089912e,0xe0e5f9fd,0x88cb992e,0xa6a9a490,0x910c9d70,0x9095eafa,0x80478d0c,0xfeff9040,0x80898ccc,0x30357a7,0x80ab8cec,0xfa974343,0x848a8ccc,0x4b8782d6,0x806788aa,0x2f1f0f0b,0x808a88ca,0x6f6f6aab,0x80688488,0xb8edadad,0x8069848a,0xf87d2e1f,0x88ab88cc,0xbffefafd,0x848888aa,0xf4f4f8f8,0x8069888a,0xfefdf5f5,0x808884a8,
-0xaaff0500,0x80ab9970,0xfd6f5b56,0x80898cec,0xff6b0000,0x88caa1d4,0x1a0094f9,0x80cc8d0c,0xaa6a42e0,0x88ed994e,0x1b5550a4,0x8d0d9d92,0x41e4ffaf,0x80898d0c,0x95fabe06,0x8d0d954e,0x5b550095,0x88cca5f2,0x50eaff,0x80888d0e,0x145e4fe,0x8931a1b2,0x80f97f06,0x80aa8d0c,0xfeaf5a05,0x808888ec,0xff1f81e4,0x84aa910c,0x6ab97ae4,0x84aa88ca,0x81e4ffbf,0x808888ca,0xaad1ffbf,0x80ab88ec,0x95e4e4a5,0x84aa84ca,0xfe6f1540,0x80cb8d2e,0x6fbffffe,0x84cb88ec,0xf9feaf16,0x808984aa,0xa4babaf9,0x910f9d6e,0xff0b405a,0x808984aa,0x555aeaff,0x80aa910e,0x46e5f9fe,0x84ec912e,0x5595ffbf,0x88cb8d0e,0xbfbf6f1b,0x84aa88ec,0xfe7f0355,0x808a912e,0x1bb469a5,0x88ec8d0c,0x95e9ff6f,0x808a8cec,0xaaa4fa,0x8d0d912e,0xff5b0600,0x808988ec,
-0x40e9ffaf,0x84cc9d90,0xbf5a5500,0x84cca192,0xf9ffab05,0x80898910,0x41f5f5e4,0x952fa170,0x9541a9ef,0x806784a8,0xafaf5b15,0x808784ca,0xe5e42f1f,0x808884ea,0xfee5fea9,0x84a988ca,0xffaf5600,0x80898d2e,0xea475bff,0x84cb8d0c,0xabaa5500,0x88888932,0xabe9feaf,0x80aa8cca,0x2f069090,0x808a952e,0xab9beafe,0x808884aa,0xf0f9feba,0x88cc890e,0xfeff1f02,0x8489992e,0x25c6f4fd,0x808888ca,0x47f4e955,0x84cb8d0e,0xf9aa6f6f,0x806684a8,0xbe2f81f0,0x88ec8d0e,0x15eaff3f,0x80aa912e,0xef050054,0x808a8cec,0xfd2f06a4,0x80cb8d0c,0xafb9a4e5,0x8ced912e,0xffaf99a5,0x84a98ca8,0xd0fdffef,0x808984ca,0xaa0f5bfa,0x848988aa,0xbfbfafbf,0x84a988ca,0x42786992,0x88cb8cec,0x95e6be1f,0x8089952e,0x5590f9ff,0x80688cea,0xbe1f4150,0x84aa952e,
-0xfffeff1b,0x84aa9530,0xf8e095be,0x84ab84aa,0xfe1f0140,0x848a8d0c,0x6fa9aafa,0x80aa8cec,0xfa5b5bd5,0x806884a8,0x1f0742fe,0x84a9992c,0xbf6a6aaa,0x808884ca,0xe5ffff,0x84889550,0xb500055,0x88ec952e,0x405aeabf,0x806888ec,0x1554f9,0x8ced952e,0x95fe1b00,0x808a910e,0xaa655501,0x80678088,0xf9bf0b5a,0x84aa950c,0xebe9aa15,0x800480a8,0xff8095ee,0x80468888,0xe9e9fdbf,0x804788cc,0x3d4fbeea,0x88aa88aa,0xbf6f0501,0x84cb9d70,0x195ebff,0x804884aa,0xd0e0fdfe,0x848a8cac,0xfeffbf7e,0x88ab8d0c,0xaeeffef,0x88cb8ccc,0xffffaf9a,0x88ab8cac,0x15a9a4a0,0x992fa9b4,0xf9fa7f16,0x80898cca,0x40eaffff,0x88cca170,0xffff0000,0x88ab952e,0x78bb1bbf,0x90ed950e,0xff4656ea,0x806a888a,0xa4564056,0x88ab8cec,0xaaa5eaff,0x846a88aa,
-0xd4feff,0x84aa910e,0xbf074000,0x84ab994e,0xf9bf6f6b,0x808a8cec,0x41000190,0x8ced994e,0x1f4b41e0,0x88c99d4e,0x9b5a1b1f,0x8046950c,0xd0e4fe2f,0x88ab992e,0xfaf4e090,0x88aa910e,0xab014055,0x80ab8cec,0x1e4f9bf,0x84ab994e,0x569095f9,0x808a8cec,0xf9bf6f5a,0x808a88ec,0xff1f0100,0x8069950c,0xf03bfff,0x84898068,0x25450e0,0x8ccc9d4e,0x90e4fe2f,0x80688cca,0x55ffffef,0x84aa950c,0xffff9400,0x88cb9d72,0x409bffff,0x808988ca,0xabaf9a80,0x806984ac,0x1a95fee9,0x80698cca,0xbfffffff,0x848980a8,0xffffeb,0x84879d2c,0x95aaffbf,0x846584aa,0xbebfffff,0x808984ca,0xaad11fbf,0x848b848a,0xf01a5faf,0x84aa848a,0xfefa50e5,0x848b88ec,0xa5ffffff,0x8067994c,0xffff6f01,0x806994ee,0xfaffbfff,0x80678488,0xffbf0140,0x88679d2e,
-0xd0421faa,0x88ab90ec,0x6e1f2ffd,0x806988aa,0xaffef086,0x84aa90ec,0x605056,0x8cec994e,0xffa90000,0x848a950c,0x55aaff,0x8ccba190,0xabfff940,0x848a88aa,0x40051656,0x8d0da150,0x66bf6b2f,0x952e9950,0xf9956510,0x88cc910c,0xd0d5e5be,0x84ab910c,0x6f6ff9e4,0x808988cc,0x155afffe,0x808a90ec,0xfe940000,0x888a9d50,0xfafefa,0x8ccc910e,0x7ffff480,0x848a90cc,0xfabffe54,0x88cb950c,0x69faf9fa,0x950d952e,0xaf9aeffa,0x802688ec,0x54b5b6f,0x88cb950c,0x9500ffff,0x8088910c,0x55000056,0x8488950c,0xaaa5ffaf,0x88aa950c,0xfe904005,0x84898cec,0x55affff,0x80898ccc,0x65f94000,0x950e992e,0xa5febb56,0x8ccb8cec,0x79fffe50,0x950d992e,0x9aaa5b6a,0x8ccc8cec,0x46bffa90,0x848990ec,0xbe69aa79,0x8ccb90ec,0xbe414bff,0x848988ca,
-0x5b5babfe,0x808988cc,0xb9f4e697,0x88cc910c,0xfdf8f8fe,0x848a88aa,0x965eaefd,0x848a8ccc,0xf841166a,0x88aa8cec,0xe9566fff,0x80698caa,0x4b6fe8e0,0x8069888a,0x325b565b,0x88ab848a,0xdb8b4baf,0x80678488,0x6faec1d6,0x8048848a,0xff6ffffe,0x80888488,0xa5f9fffb,0x88aa8ccc,0xfa95575b,0x846a88aa,0xff45c0ff,0x88ab848a,0xbfaafeba,0x848a88aa,0x960055af,0x8048848a,0xbeafaa55,0x88ab88ea,0x50ffffba,0x8ccb950c,0xbee5e985,0x80688caa,0xfdfffa06,0x848988aa,0xfffeaa00,0x84898cec,0x96069a6f,0x808988aa,0xbbfefeb8,0x88aa8cca,0xfbaafba9,0x8cab8cca,0x6fffffe,0x8069950e,0xf9ffff54,0x806888aa,0xaaffff,0x8489950c,0xfaffffea,0x848990cc,0xaafff4a4,0x88aa8ccc,0xbf55fafa,0x84898caa,0x81c6fff9,0x88aa88aa,0x1a00ffeb,0x806888aa,
-0x956fff,0x88aa8cca,0xff6a5500,0x80678cca,0x4ef902f,0x88ca90ec,0xef555550,0x80678caa,0xbf0154ea,0x8488992c,0xfedeffff,0x88a984a8,0x15495ff,0x8888992e,0x5aafffbf,0x806790ca,0x545bbfd0,0x8ccc992e,0xab555555,0x84898cca,0xa0faf9ff,0x8cec950c,0xffbeaad1,0x90eb94ec,0x50feff,0x8067992e,0xeafabf01,0x846890ea,0xaaffff,0x8047950a,0xffbf0100,0x8067a150,0xfa9495a9,0x806788aa,0x54eaffff,0x808794ec,0xfafeaa5a,0x84898caa,0x85ffffff,0x84688888,0x6f014000,0x8487994c,0xa96a6bfe,0x806790ea,0xf9a169,0x950c9d4e,0x5ad5fe0a,0x804694ec,0xbfffaaa5,0x888988aa,0xffaf56aa,0x80478488,0x5507eafe,0x84688888,0xaa56555a,0x802688aa,0x55ffaae5,0x90ca990c,0xf95b0100,0x84689d4e,0x6956faff,0x88a894ec,0x79590a5,0x950da56e,
-0xbfffffaa,0x8ccb90ec,0xffbe1a5f,0x8cca90ea,0xadfeffff,0x88aa90ec,0xaffce491,0x888994ec,0xf9ffbfaf,0x8488950c,0x6f410040,0x88899d4e,0xff464257,0x80478888,0x5594fd,0x8caaa56e,0x56bfffff,0x8ccb950c,0xaaffaf41,0x8caa90ec,0xf91656ff,0x88ab90ec,0xffbf0bba,0x88889d2e,0x6f55a96a,0x84678caa,0x95feff,0x8468992e,0xbef995f9,0x84898caa,0xe5ffbf1b,0x848990ca,0x4140ffff,0x80478468,0xeae9a595,0x84688488,0xeae97f07,0x804688aa,0xaaebe6ea,0x84688488,0x41e9ffab,0x806788a8,0x54e6ea5a,0x90eba14e,0xfd9b5a56,0x804788a8,0xf9bf1f90,0x8ca994ec,0xff6f0100,0x8468990c,0x5161baf,0x848890cc,0x7540040,0x94cb9d4e,0x5080fd7f,0x848890ca,0xbffa0115,0x848888a8,0x4280f9ff,0x804688a8,0xffa65050,0x88888cca,0xfa6faaff,0x80678468,
-0xfad5fff9,0x8089848a,0x40ffffff,0x848a888a,0x1f6efeff,0x8048950c,0xfebf1f1f,0x8068990c,0x6affff41,0x848988aa,0xfe00fa56,0x8069888a,0x1affafea,0x8469888a,0xffa5a95a,0x84688caa,0x5095faff,0x8889a170,0xffe55000,0x8caba570,0xfdaf0f9f,0x80688468,0xafaf7d68,0x84698488,0xeaffff,0x804790ac,0xff5a9a15,0x802788aa,0xffffff,0x804890cc,0xffe9fa00,0x84688488,0x56abff,0x8489950c,0x56abffff,0x88898ccc,0x11515bf,0x88ab950e,0x56bfff,0x84898ccc,0xaf3f5bab,0x88ab8cca,0x54ffff,0x804790ec,0xaa404041,0x8047888a,0x40a9feff,0x846994ec,0xf8e4fe,0x8ccc90ec,0xa9a5ffff,0x806988ac,0x40abffea,0x848a8ccc,0x96ffff1b,0x806988aa,0xaabaa9b9,0x88aa90cc,0x55aaffff,0x8047950e,0xeaea4555,0x8068888a,0xfaaaffff,0x80488caa,
-0xfffffebf,0x848988ac,0xbfefe4fe,0x88898488,0xffaf46aa,0x806a808a,0x555b9baf,0x886a88aa,0x95ebefbf,0x8048888a,0xffffef00,0x80688caa,0x5affffaa,0x80688caa,0xffff5a00,0x804788aa,0xa1fafefa,0x888a8caa,0xfae9fe76,0x888a8cac,0xe56fffff,0x80258888,0xffbf0690,0x888a9930,0x55ffffff,0x846990cc,0xffff0000,0x84678caa,0xaaffbf,0x804890ca,0xff5a0000,0x80478cca,0x69aaffff,0x846990ec,0xfaffff00,0x806990cc,0x55ffffff,0x848890aa,0xabff0700,0x846890ec,0xffeb3efe,0x888a88aa,0xbfffffab,0x84688888,0xffcff4bf,0x8cac8cac,0xbeffbf6a,0x80668488,0x459bffff,0x80678468,0xff160000,0x804894ec,0xfa56abff,0x84688068,0x60040a5,0x846894ec,0xaf5fffea,0x8469846a,0xbf969595,0x80258488,0x6f5befff,0x846a888a,0xfafea55a,0x80678888,
-0xff4055ab,0x80688cca,0xc379aaba,0x8caa950c,0xffa5fa06,0x80488caa,0xfe1f0bea,0x88aa8ccc,0xd1fbbf2f,0x888994ec,0xff060504,0x80478488,0x2f5650e9,0x88cc9d4e,0x4240e4f9,0x8026848a,0xffff1650,0x846894ec,0x4640f9ff,0x80688888,0xbf0a50aa,0x888a94ec,0xfe4686ff,0x80468468,0xaafabf,0x94eca170,0x5afa6f01,0x804794ec,0x4096e6f9,0x88899d0c,0xfe1b0000,0x8446a14e,0x1469a5fe,0x90eda56e,0xfeaf0b40,0x8468992e,0x1f4ff5b,0x848990ec,0x1aa46500,0x952da570,0xef9aa9ea,0x80678468,0xafa5aa5b,0x806788a8,0xebeaff7f,0x80268cea,0xbaa9a5f9,0x84888888,0xfe4beb06,0x80268068,0x546a94f8,0x910ca990,0xff2fabf9,0x848898ea,0x8195ffbf,0x80258ca8,0xbf1b0140,0x8489992c,0x141eaff,0x80258068,0xf45051,0x9d4ea570,0xfdbe2f02,0x806790ea,
-0x41f9fefa,0x8889990e,0xbfa9ff2f,0x846790ca,0xaabfbf6f,0x84688caa,0xfe2f41a4,0x8468950c,0xee7f0f6a,0x80258046,0x2ae4f9c5,0x80468888,0x1faffdf9,0x84878888,0xf9ff7f1f,0x80468488,0xba2aa5fa,0x84898cca,0x81f8feff,0x8caa94ec,0x80e4feff,0x80468468,0xfeffaf1f,0x846988ac,0xf9ff7f0b,0x8468950c,0xa66aa5e4,0x848994ca,0x1f9790a9,0x90cba14e,0xd5d5ea3f,0x804788aa,0xabb4fe7f,0x804690ea,0xbf5aaaaa,0x80248488,0x5aae4b95,0x80678468,0xaaaaaaaa,0x84688488,0x54aaf5fd,0x88aa990c,0x2bb950a0,0x9d4eadb0,0xfebf5fff,0x80478888,0xa4fae9e5,0x8ccb94ec,0xe9babdaa,0x84688488,0xffaaaaea,0x84688888,0xaf396e9a,0x84698caa,0xffffffbf,0x848988aa,0xab650017,0x88aa94ec,0xe69bbfff,0x80478068,0xfef9f9fd,0x888888aa,0x6f2f7fff,0x80688888,
-0xaaffaa00,0x88cc8d94,0xfaaf0a5a,0x84aa90ea,0xfaffaa00,0x88ec8994,0xffaaa4a5,0x84cb90ea,0x432b46fa,0x80aa84ec,0x87e2f9ae,0x80cc8d0c,0x190feff,0x806788ca,0xfbfffe1a,0x84ec8d2e,0xbfaf5600,0x80aa8930,0xa56bffe,0x88ec84ca,0xaaaa5500,0x84658596,0xbf40aaaa,0x84ca84ca,0xf95b9bea,0x806788a8,0x3f0b81f0,0x84a98cca,0x6befeff,0x84aa88ec,0xf4a9bf5b,0x80468caa,0xaee97f2f,0x846590ea,0x55babaaa,0x84aa8cca,0x1f4290f8,0x8088910c,0xaaf5fabf,0x808884aa,0xfebe2b51,0x808884a8,0x4054f5fa,0x84899d70,0x5bf4f495,0x84a988ca,0xfafebf5f,0x808980a8,0xf8feffff,0x84ed8d2e,0xbe2f57e0,0x8489994e,0xbf7f0382,0x84cc88cc,0xe5fdfefb,0x88ca910c,0xd287ebff,0x808884a8,0xbfcf7ee5,0x84aa84aa,0xfe6f0f82,0x8088912c,0x9596a9fa,0x808988ca,
-0xeaea5504,0x80878d2e,0xc5c4d5e6,0x804780a8,0x1b6fbe69,0x84cc952e,0x17675717,0x914ea592,0xa8e8dada,0x80888cea,0x6f5a92a1,0x808788ea,0x6f6f6b6b,0x84aaa190,0xf9dafabe,0x808988ca,0xb9f9a500,0x88cb9174,0xb4b8b9b9,0x910e994e,0x56561500,0x8022892e,0x55505051,0x804384ec,0xe4e5f4b4,0x912fa9b2,0xfffbe2e0,0x84ab950c,0x1f1f2a1a,0x802380ca,0x1a1b1b1b,0x804484ec,0xd1e8ae6f,0x806688ca,0xbf1f5b92,0x84ca8cec,0xbf2b95f9,0x84aa8cca,0xe5f8feff,0x808888ca,0xe5f8affb,0x88cc994e,0xfaba0e57,0x80898cee,0xa64b8fc2,0x88cb8cec,0xe6f4edf9,0x84ab90ec,0x5645beff,0x84aa84aa,0x6f6f7bbf,0x80a988ca,0x55151616,0x802280ca,0x15151515,0x802184ee,0xbe6f1f1f,0x808a88ca,0xaa41afbf,0x808a84aa,0x55651414,0x84439994,0x1a1a1a15,0x802288f0,
-0xeafa6f06,0x8089952e,0x56016595,0x806888ca,0x6f5690f8,0x84a9a5b2,0x40e5f9bf,0x84aa8cec,0x40e1fa6f,0x80898cec,0xff6f0640,0x8489952e,0xfe7f0641,0x808984aa,0x790e5f9,0x88aa994e,0xe0feffff,0x80898cec,0xfe2f07c0,0x8489952e,0xafff6b56,0x84aa88ca,0xf1ad6ebf,0x80898cec,0xab80e5fa,0x80aa88cc,0xa5feffbf,0x8489992e,0xbfffaf4b,0x84aa84cc,0xff9f9b5a,0x808888aa,0x91f1fffa,0x84a988ea,0xfbff9546,0x84898ccc,0xffffffbf,0x8088992c,0x6fdfffff,0x80888488,0xff1a15ab,0x80478888,0x1f4154fa,0x888a990c,0xaa000046,0x80268468,0x50a9aaff,0x848ba56e,0xff7f0740,0x8489992c,0x9697ebff,0x80678488,0x790e4fe,0x88a9994e,0xffffff7f,0x8468992c,0xaaa4a595,0x8467888a,0x145ffff,0x806790cc,0x6f3fbfff,0x84688466,0x50f9bfbf,0x84688caa,
-0x42f2e9e9,0x848a84aa,0xfeffab55,0x84aa88cc,0xfe7e1adb,0x80898cec,0xafabfafe,0x848a80aa,0xfdfffffb,0x80aa84ca,0xfffefefd,0x84aa88ca,0xffffffff,0x80a988ea,0xffffffff,0x84898088,0x52b8a8ff,0x8cec9950,0xba7e1f07,0x808a8cca,0x691a1a1a,0x802480ce,0x5164a4a5,0x8045a9f6,0xbfbad6db,0x808984aa,0xffbfbfaf,0x848988ac,0x6a2e1b06,0x80259530,0x1606566a,0x8023848a,0xe4feffff,0x80878cea,0xfb6f0740,0x8068992e,0x5b5aebff,0x806880a8,0x2e0f8be,0x8067950c,0x6de4aeeb,0x8469888a,0xfeab566a,0x804888aa,0xa9fffe2f,0x84688caa,0xff414040,0x8048848a,0x5555ffff,0x848a88ca,0xfe6f5b6a,0x80688488,0x15156a5a,0x84238cf0,0x16151515,0x802284ac,0xbf1f81e4,0x846790ca,0xff0106aa,0x80688888,0x1a42f5b,0x80258ca8,0x6aa9a91a,0x802284f0,
-0xffffffff,0x80008004,0xffffffff,0x80008004,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0xffffffff,0x80008400,0xf0fffff,0x80008000,0xf0f0f0f,0x80008000,0xf0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff0f0f0f,0x80008000,0xffffffff,0x80008400,0xf000000,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008068,0xffffffff,0x80008066,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x8000846a,0xffffffff,0x8000846a,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008022,0xffffffff,0x800088ca,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x8000910e,0xffffffff,0x8000848c,
-0xffffffff,0x80008400,0xffffffff,0x8000808e,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0xffffffff,0x800098c6,0xffffffff,0x80008448,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xf0fffff,0x80008000,0xff0f0f0f,0x80008000,0xf0f,0x80008000,0xf000000,0x80008000,0xffffffff,0x80008046,0xffffffff,0x80008886,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008d12,0xffffffff,0x8000808a,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x8000848c,0xffffffff,0x80008ca8,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x800088cc,0xffffffff,0x8000808a,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008466,0xffffffff,0x80008cca,
-0xdb45efff,0x80008044,0xa5188db,0x80688ca8,0x5bfaff06,0x84678caa,0x5400969b,0x846988aa,0xfeff56,0x846a94ee,0xff554055,0x846894ec,0x15ffff95,0x804890cc,0x5b555500,0x84689d2e,0xffbf0100,0x846b94ee,0x5a51aaff,0x846a888a,0x2f805440,0x88aa94ee,0xa595eaff,0x8047848c,0x90ffffaa,0x80688888,0xa9a550,0x8ca99d30,0xffabaaaa,0x80468488,0x55aa9655,0x8ccd9d2e,0xbf60faff,0x80468468,0x44e5faff,0x888b94ec,0x5500abff,0x80038046,0xaaffff9b,0x84688cac,0xfefe6f05,0x804890ee,0xfb4b05a5,0x84888caa,0xbf1b5090,0x8489990e,0xff9ae4fe,0x8048888a,0xbe40fe6f,0x80258466,0xff4faafe,0x80678468,0xaafe6f00,0x844894ac,0xff7f7f6f,0x8047888a,0xa4f5ff,0x88aa94ec,0xef7f1b02,0x80488caa,0xb9bfafeb,0x84688ccc,0xb9090a4,0x8889990e,
-0x50fbbee5,0x8ccd992e,0xaaeabf07,0x84468caa,0xa5ffbfff,0x88ab90ec,0xff6f0100,0x8027992e,0xffa996aa,0x80458466,0x556e46e5,0x88aa90cc,0xff40eaea,0x80458466,0xa9a5a9ff,0x846794ee,0x5592feff,0x848890ec,0x6f515050,0x8ccd9d2e,0x556a6b6b,0x802280ac,0x10555555,0x8021a174,0xa6aaffff,0x80458466,0x56eaff6f,0x84478868,0xaaaaab06,0x802488ca,0xa91b1655,0x80038868,0xfd6a0000,0x806894ec,0x6f1868fd,0x80498caa,0x1b90a9a5,0x8cac990e,0xa594f9ff,0x804888ac,0x92e5aebf,0x80478cca,0x667ebe96,0x88aa90cc,0x6f465aaa,0x80488caa,0xd0e5febf,0x80688caa,0x4aafabf,0x88ac9d0c,0x5bba1f01,0x804890cc,0x505a1a16,0x802488ac,0x1a010000,0x800394ec,0xbe665566,0x8cac90ca,0x1f4b479a,0x806890cc,0x6a6aa9a9,0x80228cf6,0x156a5a5a,0x80239930,
-0xf5bfb9f,0x80488888,0x4b41b17d,0x8048888a,0xe0e0bfbf,0x8cab90ec,0xff5a01e0,0x80478868,0xa4fbfebf,0x90cca12e,0x6f5b1154,0x88aaadb2,0x4696e6fa,0x80278caa,0xa1f51405,0x990d9d2e,0xbf7f46c1,0x88898caa,0xfffffeab,0x84688888,0xf9e4be2f,0x80478ccc,0xffffffea,0x84678468,0x9f9babff,0x80478468,0xeedf5e9e,0x80268046,0xffffffbf,0x84678886,0xd7e7bfff,0x84678868,0x8084b9bf,0x80268468,0xf4b4681,0x8468888a,0x2f1a1651,0x8caaa570,0xf4b96f2f,0x804790aa,0xffbf6f12,0x84688888,0xfe05f0ef,0x84688468,0xfffef9f4,0x84688c8a,0xdf00ffaf,0x84688468,0xe0f4e4e9,0x84688ca8,0xd1e0e0e0,0x84689d2e,0xe64b5b8b,0x80478468,0xbfafebe6,0x844788aa,0xefd7c3c3,0x80478888,0xff80bfaf,0x84688468,0x2f6f6f6f,0x84689d2e,0x1f0f1f1f,0x80478caa,
-0x6fa79090,0x888b990e,0xe3e7ff7f,0x80468468,0xfd6581d1,0x88aa8ccc,0x1b57f5f4,0x8ca994ec,0xbbb7e3e6,0x80468888,0xbf7ffdbe,0x84688466,0xfebe7e2f,0x804694ec,0x9681ebfe,0x80468068,0xae9f6f0b,0x80488066,0xd091ebff,0x84688888,0xaaaa6a15,0x802288f0,0x60656ab,0x80238888,0x91e5f4e0,0x888998ea,0x1f1f4b87,0x84688caa,0x5f1f1b1b,0x80248468,0x5a5a9b5b,0x802388ac,0xe5fdfeff,0x80478888,0xe0e59692,0x8ccba14e,0x4bbbaaaa,0x84688888,0xef9f6f5f,0x80258488,0xe0e0e0e0,0x90cba14e,0x50a0e0e0,0x8ccaa570,0x9befefef,0x80688caa,0xeec6cb8b,0x80478488,0x41383d3e,0x84688888,0x6f5a015a,0x88898caa,0x1a191919,0x8023910e,0x15151515,0x8021950e,0xbfbfbfbf,0x84688ccc,0x7fbfbfbf,0x88aa94ec,0x15151515,0x8021950e,0x55151515,0x8422910e,
-0xff0fffff,0x80008000,0xffffffff,0x80008ccc,0xf000f0f,0x80008000,0xf0f0f0f,0x80008000,0xffffffff,0x800090ea,0xff0fffff,0x80008000,0xf0f0f0f,0x80008000,0xf000f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008028,0xffffffff,0x8000990c,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0xffffffff,0x80008446,0xf0fffff,0x80008000,0xf0f0f0f,0x80008000,0xf0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x8000806e,0xffffffff,0x80008068,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x8000804c,0xffffffff,0x800084a8,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x8000950c,0xffffffff,0x800088ec,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x800090ea,0xffffffff,0x80008068,
-0xff0f0f0f,0x80008000,0xffffffff,0x80008468,0xf000000,0x80008000,0xf0f0f0f,0x80008000,0xffffffff,0x80008026,0xffffffff,0x8000806a,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008400,0xf0fffff,0x80008000,0xf0f0f0f,0x80008000,0xf0f,0x80008000,0xf0f0f0f,0x80008000,0xff0f0f0f,0x80008000,0x0,0x80008000,0xf000000,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008cca,0xffffffff,0x80008464,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008486,0xffffffff,0x80008066,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008888,0xffffffff,0x80008866,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008464,0xffffffff,0x80008088,
-0xffbf0b80,0x84889d4e,0xa0fefaea,0x848890ec,0xf41f4aa,0x8488992c,0xaf6befbf,0x848890ec,0xfff9b901,0x8489a16e,0x106aaff,0x84a9910c,0xff6f01f8,0x8488992c,0x40faff,0x806790ea,0xf4feaaea,0x84889d2e,0xfafd2f40,0x8488950c,0x5b5af47f,0x802584aa,0x2f82e4af,0x84888cca,0x791feff,0x84888cca,0x95be7f16,0x848890ea,0xa9aafabf,0x80678cca,0xffaa5090,0x80258cea,0x6949400,0x8ceb994e,0xff55e9ff,0x808888ca,0xa4ff6a40,0x90eb992c,0xbf95bf06,0x848890ec,0xefff055a,0x8ceb950c,0xd6c25a47,0x88a98cea,0x16ba55f9,0x910ca16e,0xff5f0001,0x8488a190,0xbfffa545,0x8cca992c,0xfe1f40a4,0x8488994e,0xa51646fe,0x910c9d2c,0x82f46a96,0x90eb994e,0x55d1faaf,0x84a9950c,0x6a355050,0xa9b1adf2,0x1f47f62f,0x808888aa,0xd0e4a9bf,0x8488910c,
-0xfebe0640,0x80679d2e,0xb44b5bea,0x806788a8,0x175154a9,0x90cba14e,0x5995fabf,0x8467950c,0xfaaf0b1a,0x848888a8,0xaf06459a,0x80678488,0xbf6ba150,0x88a994ec,0x567ebefa,0x84678888,0xa4fafa6e,0x90ca990c,0xf9bf0780,0x8889992c,0xbabf5bd0,0x88a990ca,0x7e5a996,0x8ca99d2e,0xbe514656,0x88898cca,0xa5d5aaaf,0x80678488,0xeedaf42e,0x806788a8,0x7e0fd6a5,0x846790ea,0x190feff,0x806790ec,0xaf5ba456,0x88ca992c,0xfd5b4643,0x80468488,0xab5ed2a8,0x88a990ea,0xb80641f8,0x80878cea,0x5b5781f4,0x88aa952c,0xd4a8afaa,0x848890ea,0xf5be6f87,0x88a9950c,0xaff9fa6a,0x88888caa,0xd1fdaf1a,0x8488950c,0xb9afebfe,0x80678ca8,0x2f6a81a4,0x88a9950c,0xfffe2a51,0x8cca950c,0x55a5babf,0x88a9990c,0x87e1f9bf,0x846890ea,0xd5f96a0b,0x90eb992e,
-0xe5e5eaea,0x88aa952c,0x9090e0e5,0x90eb9d6e,0xa74387eb,0x88c98cea,0x5f5f4f47,0x8088910a,0xa5b46555,0x9d4eadd2,0xfa2e1f57,0x84a8952c,0xba6e5e0f,0x80878cea,0xf2f4f4f5,0x88a9a16e,0xbe7e7f2f,0x84a9a58e,0xe54055bf,0x84a8910c,0xd0d0d090,0x88a8994e,0xafafb9e5,0x88ca910c,0xf9f850a5,0x8cea950c,0xdb9ad6e6,0x8cca910a,0xbfbaa401,0x992da190,0x6b6f6fbf,0x994da16e,0xaf0f4bea,0x806688a8,0xe4e4fd,0x88a9a18e,0x95e9eea6,0x8cea952c,0xfaaf5f66,0x88c99d4e,0x55a9ff0b,0x84a8950c,0x94feafaa,0x84a9950a,0xaaaaaa90,0x84a89d6e,0xffbbaa9a,0x88c990ea,0xd1d7ebeb,0x90eb952c,0xaffaa541,0x8cea9d4e,0xffffbb6b,0x952c994c,0xaabff9be,0x950c9d6c,0xaafe5a1f,0x950c952c,0xffaaaaaa,0x84879d6e,0xaaffa555,0x9d4da190,0xffaa5a56,0x88c9992c,
-0x9b5b5b6b,0x84a9950a,0xfefebafb,0x952c994c,0x7ab59084,0x8cca910c,0x6e6d6eaa,0x88ca90ea,0xfabaaaa4,0x950c954c,0xa4f9f9f9,0x950c9d4e,0xeeeab5b9,0x88a8992e,0xe7b2aa9a,0x88ca910a,0xf9bd1f0b,0x8488910c,0xb99996ea,0x808888a8,0xe1f4b855,0x90eb994e,0x7e6f0f56,0x88a9992c,0xd3e1e0f4,0x88c9994c,0x5a4e8f87,0x88c9910c,0xc7c6ebbe,0x808788ca,0xba47478b,0x8ceb952c,0xfafa50a4,0x994d9d6e,0xa9aafaf9,0x950c9d6e,0xf4b4592,0x910b9d4e,0xe0e0f0f,0x88c9952c,0xea564195,0x910c994c,0x46bffefe,0x90ea994c,0x5b0e0e0d,0x8cca952c,0x6ea8fae7,0x8cea992c,0xf9f9fab,0x992d9d6e,0x6f6f1f1f,0x910b992c,0x51fbbbbb,0x9d6ea190,0xfebe7924,0x994da16e,0xaf6f2f5e,0x8cea952c,0x95aaafaf,0x952c994c,0xba79b9f9,0x952c994c,0x7e29bebe,0x952c992c,
-0x690f9ff,0x80468caa,0xbdffaa1a,0x8cca990c,0xfeabaaaa,0x804688aa,0xbe0641e5,0x846890ea,0xff1f8190,0x8488992c,0xe0bdefff,0x80468cca,0x64fefefa,0x992da992,0xfbbf2f07,0x8066992a,0xaaa94545,0x80678888,0xd1e4aeaf,0x80468488,0x5556a5e5,0x80468488,0xafaa6a55,0x80678caa,0x50bfbfdb,0x950c9d2c,0x57551450,0x94ebadd2,0x81e9febf,0x806794ec,0xe5f97905,0x990da14e,0xbe2f0b81,0x8067992c,0x404aebfa,0x846788aa,0x90b8eaff,0x804690ea,0xba2e0742,0x8046a16e,0xb1b0701,0x88a9950c,0xd7c2fdbe,0x806788a8,0xe5e198f9,0x8caa992c,0x9f0b5bea,0x84678888,0xefeebf1f,0x80478486,0xf0f4bdeb,0x846790ca,0x5be29064,0x94eca570,0xea967f2f,0x802688a8,0x2f0a83e1,0x846790ea,0xeffebe7f,0x88a990ca,0x185fefeb,0x84888caa,0xffaa1504,0x848890ea,
-0xe9ea3f2f,0x802584aa,0x55aaa595,0x80688ca8,0x1b655050,0x8ceba990,0xd5a96f1f,0x800584a8,0xef4b1655,0x80478488,0xc6e0f4be,0x84678caa,0xa0b5a9e9,0x84888ca8,0xbf7fabd5,0x84888caa,0x90f5aaea,0x8cca990c,0x5b655540,0x950ca570,0xeae6bfbf,0x80478488,0xb4beaeae,0x8caa90ea,0xfabe7f2f,0x846794ec,0x9591d6eb,0x888990ea,0xe5f5f4f4,0x8cca990c,0x2f1f4b8b,0x8488950c,0x19364acf,0x8ccb94ec,0x6b75f449,0x90cb990c,0xe8a9aebf,0x80468488,0x9090d5e5,0x80678caa,0xb97f6f5f,0x88a990ea,0xe6d5c0e9,0x8468950c,0x10505090,0x90cb990c,0x1f070201,0x90ca992c,0xafba7a6a,0x84888ca8,0x6f6fafaf,0x80468488,0xe7fabc3e,0x804688a8,0xe595dad6,0x80468888,0xa89f9faf,0x80468468,0xfdfee954,0x806790ca,0xa6fefae9,0x88888cca,0xffabaa41,0x88888cca,
-0xbfab556a,0x88a9910c,0xb4f4eafe,0x8ceb910c,0xf9feffaf,0x80678cca,0x968383ea,0x80678cca,0x5b9b5665,0x90eb9d6e,0x3e2f2f1b,0x88c9994c,0xa0f57e5a,0x90eb952c,0x7ea65190,0x994ea590,0xabf6fabf,0x88a98cca,0x5f5b1f1f,0x84888cca,0x51bfbebe,0x88a98cca,0xb9fdb400,0x8cca90ea,0xe6e6ae6e,0x806788ca,0x89c6d6e6,0x84888cca,0xa6fa6a55,0x8cca90ea,0xb0b0b5b,0x84a98cea,0xe0f5b97d,0x88ca994c,0xd5d0d0d0,0x8cea952c,0x78797e7e,0x950c9d4e,0x566ab9b9,0x910b9d4e,0xd0d0d0e6,0x8cea910c,0xe5e4d5d4,0x84a8952c,0x97a3f706,0x8cea952c,0xaaab4343,0x950c994e,0x95948585,0x8488910c,0xd9959595,0x88ca910a,0x6f5f1b0b,0x84a98cea,0x6f6f6f2f,0x88c9952c,0xa4f4f5e9,0x90ea952c,0xe6e6a4a4,0x88ca992c,0x6f6f1b6f,0x88c9a16e,0x5f1f6f6f,0x8cc9910c,
-0x8581d5d5,0x80468488,0x95968585,0x84678cca,0x2f2f5f5f,0x8488a56e,0x3f3f3f3f,0x88a8a590,0xebefba95,0x8cca90ea,0xf9a8a9ea,0x8cca90ea,0x2f2f3f3f,0x84679d4e,0x965f5f1f,0x88a990ea,0xe0d0d5e9,0x804590ea,0xf4f4f4e0,0x848794ea,0x70b7fff,0x88a990ca,0xf0f1a6f,0x84678ca8,0xfdb8f4f4,0x806788a8,0xbffffffe,0x88a9a16e,0x46064b0b,0x8067992c,0xf4e1d282,0x88a9a16e,0xf4f4f9f9,0x90eb952c,0xfafef9e9,0x950c994c,0xfafffad1,0x90eb94ec,0xafffffff,0x992c9d4c,0xf9e9a4a5,0x992ca5b0,0xf9f9f9fa,0x952ca16e,0xffbf4606,0x950c9d4e,0x567f6bbf,0x992d9d4e,0xd60b1f6f,0x88a9950c,0x160f7faf,0x9d4e9d4e,0xd69abdf8,0x88aa90ea,0xe4d0d1d2,0x88a8992c,0xeaaa6514,0x950ca58e,0x6ee5eaea,0x88a9910a,0x1f2f6ea4,0x88a9950c,0xf5e1470b,0x88ca950c,
-0xaaff5600,0x88a9a9d0,0xffe59495,0x88c9950a,0xffff0040,0x8ccaa18e,0xbf9a96aa,0x80868cc8,0x5af5baa,0x8cea952c,0x6affbf1f,0x84a8910c,0x64aff505,0x8cea9d6e,0x55affaa0,0x80878cea,0xffab0055,0x8cc9994c,0x6ffeaa,0x84a8992c,0xffff4015,0x8cc9a18e,0xf9006ffe,0x8cea9d6e,0xf9e5fff9,0x90ea952c,0xe95a6ffe,0x84a7950a,0xebeafaff,0x8cea950a,0xbfb9f4eb,0x90ea994c,0xfe055540,0x88a9910a,0xaff9eaff,0x84a8952c,0x5ff94595,0x88c9950a,0xf15fffaa,0x8cc9952c,0xfffed01b,0x8cc9a58e,0xe590aaaa,0x84a8992c,0x4aebfffc,0x910b950a,0x4f9eea45,0x88a8910a,0xf901beaa,0x950b952c,0xbfbefffe,0x910b950a,0xf9f8a5aa,0x994da16e,0xa5f4fbff,0x992c9d6e,0xbeffa66b,0x994da16e,0xbf3f7fb9,0x910b952a,0x57f7eaa,0x994d9d4c,0xfa900001,0x88c9950a,
-0xff6fbe80,0x90ea9d6e,0x7ffd006b,0x910b9d4c,0xfe590007,0x90ea994c,0xb47f1944,0x8ce9952c,0x1b1b6f7f,0x950b994c,0xe5aa6a1b,0x994da16e,0x39b8e8e4,0x8cea994c,0x9f9e9c35,0x910b9d4c,0xffaad090,0x952b9d6e,0xf9a4bcbe,0x88c9950a,0x3abfbf7f,0x994da16e,0x6abd7979,0x994da18e,0x6e2d3c3c,0x8cea992c,0x5a6f6fae,0x994ca5b0,0xd5904010,0x8cc9992c,0xa9e5e0d5,0x88c9994c,0x9a5afffa,0x992c994c,0x5aabab9a,0x952c994c,0xa2b2bfaf,0x994d9d6e,0x85195966,0x910b994c,0xe4904001,0x910b992c,0x72fbef9,0x88c99d4c,0xf6ef9f4,0x88c99d4c,0xe4900103,0x88c99d4c,0xd1c08181,0x8ce9992c,0xf7ebefa,0x8cea992c,0x1b6f7faf,0x8cea994c,0xe5400107,0x8cea992c,0xd0504103,0x8d0ba16e,0x1b6fbde4,0x88ca952c,0xb1ebef9,0x88a8910a,0x80905016,0x8cc9992c,
-0xd0401bfe,0x88a8910a,0x16bfafe4,0x84a8994c,0xffaef082,0x84a790ea,0xe0416fff,0x8cc9994c,0xe9aafe40,0x88c9992c,0xfe900bfe,0x88c8994c,0xef6aaafe,0x8cc9910a,0xaffff892,0x8cc9994c,0x2ffefabf,0x88c9952c,0xbffe950b,0x8ce99d4c,0x90011fbe,0x88c99d6e,0x5606fff8,0x8cea992c,0xe75555ab,0x8cea950a,0xfafbfbe6,0x8cc9910a,0x1f3dbde5,0x8cc990ea,0xf0e1c24b,0x8cc9992c,0xbfffffab,0x950b950c,0xf9afeb6f,0x88a8950a,0xeaefefea,0x910b992c,0x5a8ad3d5,0x8cc9950a,0x5f0b40f4,0x90ea9d6e,0x42e67c7e,0x88c9992c,0xe1f56f1f,0x88a8952c,0x8fb37854,0x950ca18e,0x3f3f3e7e,0x90ea950c,0xfaffbf3f,0x90ea992c,0x5e6dbdbd,0x90ea9d4c,0xbf2f6f6e,0x90ea950c,0x1f565554,0x8cc9950a,0x4290f9fe,0x8487950a,0x50fae1e1,0x992ca16e,0xbf1f1b1a,0x88a890ea,
-0xbef9d001,0x8cea9d6e,0x8a09060b,0x90ea90ea,0x1065bad,0x84a8910a,0xaf9c5501,0x910a992c,0x2fb8a99b,0x8cc9950a,0x569b5b1f,0x8cc9992c,0xb8adaeaf,0x992c9d6e,0x1d1e1a68,0x950c9d4c,0x74741506,0x950b952c,0xbab9bab9,0x8cea992c,0x8180c080,0x80878cea,0x9484c181,0x80878cc8,0xbdb6b6ba,0x8cc9992c,0xd0f5f9fd,0x950b9d4c,0xe0a4a494,0x84a8950a,0xc3d2d1e0,0x8cc99d6e,0x7d3d2929,0x88a89d4e,0xb9b9bd39,0x8cc990ea,0x96d0e4bd,0x8487992c,0xbcbdae9a,0x90ea992c,0xa4bafaf9,0x88a8950a,0xa59590e4,0x88a89d4c,0xa5f8f8bc,0x90ea952c,0x1f575793,0x88a89d4c,0x6f6f6b90,0x8cc9992c,0xeaaaae6f,0x848790ea,0xbe4b8682,0x910b992c,0x791f5fd,0x8cc9950a,0x7f1f96ea,0x8cc990ea,0xb9b9babf,0x90ea992c,0xf96e1f1f,0x84a88cc8,0x8786d1e0,0x848790ea,
-0xe4e5e5e5,0x8cc9952c,0x7e7ebdf8,0x8cea952c,0xea3ebeaa,0x88c98cea,0x8181d6ea,0x88a990ea,0x6f6f7e7d,0x8cea9d6e,0x7a3f2b5b,0x992c9d4e,0xd0908080,0x8cc9952c,0xbdf8e4e0,0x88c9910a,0xefeeeeea,0x84a888c8,0x1f5f9fef,0x80878cca,0xa6979b5f,0x8ceb992c,0xe0f5b6a6,0x994da18e,0x5b6f6f1f,0x88c9952a,0xfde6c70b,0x88c88cea,0xaa91e5e0,0x84a7950c,0x415b6f7e,0x910a9d6e,0xf4f9b475,0x952ca16e,0x9b5faef8,0x88c9910a,0xe6c76f6e,0x84a8910a,0x2f7eb9f8,0x90eaa58e,0xe9d0d1d6,0x8487910a,0x2f2f7e7d,0x8ceaa18e,0x91561b2f,0x952ca18e,0xe0d09090,0x910ba9b0,0x576b2f7e,0x910aa16e,0xb4f4e192,0x952b9d6e,0xfafde490,0x90ea952c,0xe0faffb,0x88c98cea,0xffefd994,0x88c88cea,0xb0b0b5f,0x806688c8,0x91565f6f,0x8cc9952c,0xf8f46455,0x910b992c,
-0x65afaaa9,0x950c994c,0x6aeae9a5,0x8487910c,0x6fe5e591,0x84a8952c,0x95961b2f,0x8cea992c,0xd59b6f2f,0x88c9910a,0xafbae4f0,0x8cea910a,0xffdaa5e5,0x88a888c8,0x7f6ffbff,0x88c9910a,0x90824b1f,0x90eb952c,0xfaabf9f4,0x88c990ea,0x1f6f6ef9,0x88c99d4e,0xb9e68206,0x84a9910a,0xbffffad6,0x88c98cea,0x8080972f,0x8ce9952c,0xf8e0d6db,0x84a88cea,0x1f2f7fbd,0x88c9a16e,0x6bbeebef,0x88c9952c,0xa9f45517,0x994da58e,0x257a172f,0xa16ea9b0,0xdfc97010,0x994d994c,0xb6a0f5b9,0x910b952c,0xffbf3a25,0x952c9d4e,0xeaeaeb9f,0x8cea992c,0xe6d6d5da,0x88c9910a,0xe4e4d1d0,0x8cc9994c,0x2f7ffdf4,0x8cc9992c,0x561b0b1f,0x952ca16e,0xe0e0e596,0x910b9d6e,0x1b1b1b1f,0x88c9994c,0x5b47475b,0x90ea952c,0x90e0f4f4,0x910b994c,0x7e7e79b8,0x910b996c,
-0x2f2f2f2f,0x950ba5d0,0x1f1f1f1f,0x90eaa58e,0xe0d0e0e0,0x84879d4c,0xf4f4e4e4,0x88a8a5b0,0x7e2f2f1f,0x88a89d4c,0xebfbfaba,0x8cc99d6e,0xe0d0e0f4,0x88c89d6e,0x74180d0,0x910ba16e,0xeb9b4b0b,0x88c9950a,0xfbfffbeb,0x88c990ea,0xd28285f9,0x88a88cea,0xe0e1d1d2,0x84a89d6e,0xab5757a7,0x84a88cea,0xafafafab,0x84878cea,0xb8f8f4e0,0x88a89d4c,0xb9b4f8f8,0x88c9952c,0x2f0b4b87,0x90ea9d4c,0xfaff7e,0x90ea9d6e,0x7d3e2f5b,0x950ba58e,0xecfaf7bd,0x88c9992c,0xaabd6915,0x992ca16e,0xf4b4b57,0x8cc9950a,0x56969194,0x9d4ea58e,0x74646956,0x994c9d4e,0xf4fcfdaa,0x88c9952c,0x87d2d0e0,0x88c89d6e,0x1abfafaa,0x992ca18e,0x2f1f1f0b,0x88c9992c,0x3f1f1e4b,0x8cc99d4c,0xf4f9fe7e,0x90ea9d4c,0xac5d2e2f,0x88a88cea,0xd2b1b0f4,0x8cc9950a,
-0x7f2b6fbf,0x8cc9910a,0xbf6fbb7f,0x8cea910a,0xd1d0d1e5,0x80878cca,0xd9d8d6d2,0x84878cea,0x36bfffff,0x910b950c,0xbbfbbb7b,0x952c994c,0xd4d4d4d9,0x8087910a,0x95eaeae9,0x90eaa18e,0xf1606157,0x90ea910a,0x61b1b5f1,0x910b994c,0x7f2e2e2e,0x88c9910a,0xbdbe7f7f,0x8cea910a,0x57621211,0x952ba16e,0x71b5b5b,0x910b994c,0xf4bdf8f8,0x910b952c,0xf4f4f8f4,0x952b9d4e,0xd0a9a6ea,0x910ba16e,0xe4d4e9e4,0x8cc9952c,0xf9bd5501,0x8cca952c,0xe3e3e3f9,0x84a8992c,0xf1f0a4e4,0x88a890ea,0xae8989e6,0x8cc9992c,0x838393d3,0x88a9994c,0xe29b8787,0x8cea9d4e,0x1f1f0a0a,0x88a9992c,0xbf7f2f1f,0x88a8910a,0xa0b0f0f4,0x952ca5b0,0xe5e0e0a0,0x9d6ea9b0,0xdbefafbf,0x84a890ea,0xd6dbd6d6,0x80678cea,0x55a5e5e5,0xa16ea9d0,0x2b5a0155,0x9d6ea9b0,
-0xafafaaaa,0x8046848a,0xe5f5feaf,0x80478888,0xeedaffef,0x84688068,0x5fffffff,0x84688888,0x7f6f4f9a,0x888894ec,0xa4e8feff,0x8ccb990c,0xf4f9febf,0x804790ca,0x1f5bd6d1,0x888890cc,0xffffffff,0x84688c88,0xfeffbfaf,0x84888caa,0xefab2f1f,0x806890ca,0xabaaaa55,0x84688488,0x5796a6f9,0x84698488,0xbe5f4f4b,0x80478468,0xfe8fbfbf,0x84888488,0xfafefeff,0x848988aa,0x53a250b4,0x950da990,0x1f1f0f1b,0x80679d4e,0xb92e3e2e,0x90cb90ca,0xf4f4f4f4,0x990ca14e,0xea7f7f6f,0x806794ea,0xeaeaeae5,0x80258cec,0xf0f4f0f0,0x992da590,0xa1a1a0f0,0x950da14e,0xd0e0e4fd,0x80478caa,0x9b86d1d1,0x848894ec,0x9ba6e6ea,0x84688488,0xaf6f5f5b,0x804788a8,0x2f2f1f6f,0x94ec9d4e,0xbabb7f7f,0x990ca14e,0xf9fdbd6e,0x80678ca8,0xf0f4f4f9,0x806790ca,
-0xbffff8a0,0x846890ec,0xfb660266,0x888990ca,0x5465fbf,0x8067888a,0xff454095,0x84688888,0xa699aefe,0x80478888,0xaf43ea5d,0x84688888,0x1bffffb,0x8467950c,0xaa6afff9,0x846890ca,0xbe696a6e,0x84898888,0xbfffeaef,0x80688ca8,0x1a296555,0x802384ac,0x15575b1f,0x8024992e,0xf9551b2f,0x8468a570,0x55056bbf,0x84688caa,0x6ba95000,0x8024950e,0x15001516,0x802388aa,0xe5f9fdff,0x88898caa,0xefdff5e1,0x846888aa,0x97afaf6b,0x8caa90ca,0x5f4a9797,0x84688caa,0x8681d5e9,0x80478888,0x45468686,0x80468888,0x2e2e2e6f,0x8047950c,0x2d2d2e2e,0x804794ec,0x67ff5e0,0x90ec990c,0x6f6f6b56,0x8889950c,0x5040ebaf,0x80258cca,0x15154000,0x802190ee,0x7d6e6e6f,0x806890ca,0xb878787d,0x84688cca,0x15151515,0x802290ee,0x5010505,0x84228cca,
-0xe5d0e1ea,0x8067950c,0xdad581f9,0x84678cca,0x63136362,0x950ca570,0xabab9b63,0x94eda14c,0x5b47e7eb,0x80478488,0x6f7e7f7b,0x8489990c,0xe0e0f6fb,0x990ca590,0xf4f4e0e0,0xa16fb1d2,0x7e7e7e7a,0x94ec9d4e,0xbe7e7f7a,0x90ca9d2e,0xe0e0e0e0,0x806790ca,0xf4f0f0e0,0x84888cca,0x2f2fbfbf,0x848894ea,0x4f1b2f2f,0x90cb990c,0x3c3cf9f5,0x888990ea,0x4b7d7d7c,0x848890ea,0x1f1f1e6f,0x88a9a14e,0xa65b4b0b,0x992da590,0xf8f8f4f4,0x990ca590,0x1a7fbef9,0x910b9d4c,0xf4f0f0e1,0x8cca992c,0x1f3bbbfa,0x84888cc8,0xeb4b9f5f,0x848888a8,0xbdf8e5ea,0x88a890ea,0x8b9b4b4f,0x90ca950c,0xe9d0d0d2,0x80678cca,0xebd7d78b,0x80678ca8,0x1b6f7f7f,0x8ccaa16e,0x7fbffffe,0x88a894ec,0xf9aaaf7f,0x8cc9950a,0xf4e1410b,0x950b9d4c,0xaf6ea6f4,0x88a88cc8,
-0x9753536b,0x84678488,0x81828246,0x80678caa,0x1f1f1e2e,0x8067992c,0x5f2f2f1f,0x8ca9990c,0xe0f0e1d1,0x90ca950a,0x2e6efefa,0x88a9990c,0x565b5f5f,0x8cca94ec,0xa4f4a582,0x90cb992c,0xf4f4f8f9,0x8488992c,0xb8f8f8f5,0x84888cca,0x16161615,0x8023950e,0x15161616,0x8022952e,0x5f6fb9b9,0x84688ca8,0x5f5f5f6f,0x80678caa,0x15101515,0x8443992e,0x15555515,0x80009d72,0x9051171f,0x90cb9d4e,0xf9f8f4e0,0x8cca9d4c,0xdbdae9e5,0x8ca98cca,0x7fbfffff,0x88a890ca,0x9b9feffd,0x88888cca,0x5e59a697,0x848890ea,0xbf5b0f7f,0x8ca990ea,0xb9f975b9,0x950b992c,0x246bfaf,0x88a9990c,0xb8b5a56a,0x94eb992c,0x55691515,0x84449d70,0x15151515,0x8021950e,0xb9f0b9b8,0x90ea990c,0x6e6f40b0,0x90eb90ea,0x50ffbfaa,0x804690ca,0x15151501,0x8001954e,
-0xffffffff,0x80009062,0xffffffff,0x80008caa,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0xffffffff,0x80008026,0xffffffff,0x80008024,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x8000802a,0xf0fffff,0x80008000,0xf0f0f0f,0x80008000,0xf0f,0x80008000,0xff0f0f0f,0x80008000,0xffffffff,0x80008004,0xf000000,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008046,0xffffffff,0x800080aa,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x800088a8,0xffffffff,0x800084a8,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x8000808a,0xffffffff,0x8000910c,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80009d2a,0xffffffff,0x800084a6,
-0xf0fffff,0x80008000,0xf0f0f0f,0x80008000,0xf0f,0x80008000,0x0,0x80008000,0xff0f0f0f,0x80008000,0xffffffff,0x80008422,0xf000000,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xf0fffff,0x80008000,0xff0f0f0f,0x80008000,0xf0f,0x80008000,0xf000000,0x80008000,0xffffffff,0x800084ee,0xf0fffff,0x80008000,0xf0f0f0f,0x80008000,0xf0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x8000808a,0xffffffff,0x80008044,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008044,0xffffffff,0x80008066,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x8000992a,0xffffffff,0x80008066,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008026,0xffffffff,0x800088ca,
-0xecf0904a,0x88a88cea,0x3f7bbbfe,0x88a8950c,0x431f6fbe,0x88a8992c,0xf8f45142,0x950b9d4c,0x914b4f5f,0x950ba16e,0xf4f4f0e1,0x9d2da5b0,0x6f7fbef9,0x8cca950c,0x475b5b1f,0x88c9992c,0xfe78f9f9,0x8cc990ea,0x5f9f9aaa,0x8cc990ea,0xf0c0d6ef,0x88a88cc8,0x2f2f2faa,0x90ea952c,0xe0c0c186,0x80888cca,0x7f6fb9f8,0x88a890ea,0x9b5b6f6f,0x8cc9950c,0x9080aabf,0x88a990ea,0xbf7d79f9,0x910b994c,0x4b171b7f,0x88a890ea,0xe0d09046,0x808790ea,0x6f2c69e5,0x808788a8,0xe5d6c687,0x88a8910a,0xf4f0f0d5,0x84a8950a,0xfbeb8b5f,0x88c88cea,0x4f1f2a77,0x88a9992c,0x97435f6f,0x8cc98cea,0xbdf4f9fb,0x88c98cea,0xeaeae9e5,0x84a8950a,0x9fd6eaeb,0x84a88cc8,0xe1d29baf,0x88a8910a,0xbffef8f8,0x8cca994c,0xab9babaf,0x84a8910a,0x6a6b6b6a,0x950c952c,
-0x52ffbf6f,0x8cc9992c,0xe4640010,0x950ca16e,0x95aafefe,0x90eb9d4c,0x3f6ea494,0x8cc9992c,0xf6e3e1e8,0x88a890ea,0x1f2e3eba,0x8487992c,0x652b2f2f,0x90ea952c,0xb8f8f8b4,0x992cadd0,0x7e6e6f4e,0x950b950c,0xf4b9be7f,0x8cca9d4e,0x15151515,0x8022994e,0x15151515,0x8441a192,0xd5e0f4f4,0x88c994ea,0x869b9bda,0x88ca950a,0x1b1b1616,0x8044996e,0x1b1b1b1b,0x80228cec,0xf0f0f0f,0x84879d4c,0x1f0f0f0f,0x84879d6e,0xf060e1f5,0x950b992c,0xe0f0f0f0,0x992c9d6e,0x6e6e1f1f,0x8487992c,0xf9f9f9fd,0x8cea952c,0x50a0e0e0,0xa16ea9d0,0xe7924000,0x8ccaa16e,0xc3828286,0x8ceb950c,0xd7d3c3c3,0x88ca8cc8,0x1b1b1b1b,0x80028d0c,0x171b1b1b,0x8043910c,0xbeafafdb,0x84878cca,0x61b6f6f,0x84c99d4e,0x15151616,0x8022996e,0x14000001,0x8021910c,
-0xbdfcfcb8,0x84a888a8,0x5f5e6e6e,0x80668cea,0xf9faeac7,0x8cca952c,0x7d78b9b9,0x88c9950c,0x5f5f5f5f,0x808790ea,0x9f5f0f0f,0x84a8952c,0x2c3e3e3d,0x90eb9d6e,0x2e1d1c2c,0x8cea9d4e,0x550aabab,0x88c98cea,0xfcb8f4a5,0x88a9910c,0x55649aea,0x90eb8cea,0x838bffaa,0x88c9952c,0xaafefdfd,0x84a9952c,0xbe6f1a5a,0x88c9992c,0xa5e1d1c2,0x88a9a16e,0xbebd0050,0x994d994e,0xae9eeeee,0x806684c8,0xbd2e6e7e,0x84a8910c,0x7f2f2e2d,0x84a8994c,0xf5f8b9ba,0x88c9952c,0xbcfcbefd,0x8cca992c,0x7d7cbcbc,0x84a8994e,0xbabfa541,0x910b994e,0xf4404095,0x8cea992c,0xbcbdbebe,0x8488952c,0x56b4f4bc,0x88c9994c,0x8685869a,0x808788c8,0x8081d686,0x80658cca,0x2fbe9546,0x8cea992c,0xab7e2a7f,0x910b9d4e,0xd4e9d681,0x80878cea,0x96808090,0x8488910a,
-0x52a6abab,0x910b952c,0x1f075757,0x8cea950c,0x155a6ae7,0x910ca16e,0xbe691515,0x90eb9d6e,0x55796f1f,0x952c994e,0xffeae494,0x88c9992c,0xa500a9fe,0x88c9994c,0x425bbffe,0x8ceaa18e,0xf8f48105,0x910c952c,0xbeb9b8b8,0x950b996e,0x55060615,0x8023912c,0x1051555,0x8022952c,0x2f8091bf,0x84a98cca,0xbeb9550b,0x994da5b0,0x166a15,0x8044952c,0x16561515,0x8022aa14,0x1b1f6fbf,0x88a8a9b0,0x12131717,0x994eadd0,0xf8f8e0a0,0x9d4da16e,0x6434b8b8,0x992d9d4e,0x17272713,0x994da9d0,0x1f1b1717,0x8087adf2,0xe4d0d090,0x88c99d4e,0xbdf4f4f4,0x84888cca,0x821b7f6a,0x994ea16e,0xaea9f8e4,0x80468cc8,0x6fa95015,0x8024910c,0x461a1b1f,0x8043992e,0x9b4b4b5f,0x80878cea,0xd1a1feff,0x84a984a8,0x46424646,0x8022952c,0x1b1b1746,0x8044a1b0,
-0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0xf0f0f0f,0x80008000,0xff0f0f0f,0x80008000,0x0,0x80008000,0xf000000,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008400,0xf0fffff,0x80008000,0xf0f0f0f,0x80008000,0xf0f,0x80008000,0xff0f0f0f,0x80008000,0xffffffff,0x80008486,0xf000000,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008024,0xffffffff,0x80008088,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x8000992a,0xffffffff,0x8000910a,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc000c0c0,0x80008000,0xffffffff,0x800090c6,0xffc0ffff,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x800088a8,0xffffffff,0x80008066,
-0xffffffff,0x80008486,0xffffffff,0x80008cca,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0xffffffff,0x80008024,0xff0fffff,0x80008000,0xf0f0f0f,0x80008000,0xf000f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008004,0xffffffff,0x80009108,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0xffffffff,0x80008114,0xffffffff,0x80008444,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x800084a8,0xffffffff,0x80008466,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008886,0xffffffff,0x8000912e,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008884,0xffffffff,0x80008466,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x800088a8,0xffffffff,0x8000808a,
-0xf5a6a696,0x8ceb8d0c,0x7afbbbb5,0x910c912e,0xd6c1c1d6,0x808888ca,0xd5c6c2d5,0x80888cea,0x7f7f2f2f,0x910c996e,0x6458bebf,0x8d0c910c,0xd5d5d0e4,0x8088910c,0xe9e5e5e5,0x8088910c,0x6b2b1717,0x912ca5b2,0x2b1b1b2b,0x954ea5b0,0xe4e4d4e4,0x84ca9d6e,0xe4e4e4e4,0x84879d90,0x2a2b2b2b,0x952dadf2,0x51162626,0x910ca9d2,0xe9e4f4e4,0x806788ea,0xaf9fbebd,0x808888ca,0xaa404454,0x88ca910c,0xb9faea96,0x88ca994e,0x2f7e7eba,0x84aa994e,0xe0420b1f,0x8088910c,0x6ff9911b,0x88ca952e,0xce03bf1b,0x952d910c,0x5947affd,0x8cec952c,0xbfffa5e0,0x910c994e,0xf4d0d090,0x80899d6e,0x8b0fbef8,0x88ca88ca,0x861a2faf,0x88ca8cec,0x62b0b986,0x8ceb910c,0x6afefaea,0x910c9d6e,0x4696f5bf,0x8ceb952c,0xa566127b,0x952d994e,0xa9aafb9f,0x88ca912c,
-0x9bdb8b4b,0x804680a8,0x1b2f2f2f,0x84a8950c,0x411b2fbe,0x88eaa190,0xbdf8f4d0,0x84a99d6e,0x8787870b,0x84a8992c,0x8b878282,0x84a9910c,0x5b5b6bae,0x88ca8cea,0xffebab5b,0x8ceb910c,0xbef99000,0x84a9994e,0x4556abaf,0x88ec910c,0x96affff8,0x88ca910c,0xffa99555,0x8ceb912c,0xfdfef90a,0x8d0c912e,0x2f2fffbd,0x8ceb910c,0x6fffffff,0x8d0c954e,0xf4e06b26,0x992d9d6e,0x6f0f5f9f,0x88eb910c,0xf9eaaa5a,0x88ca910c,0xfefe0baf,0x88ca8cec,0xffbf55a9,0x910c952c,0xaa9590e4,0x8ceb952c,0xceeecf8b,0x8ceb88ca,0xafaaaabf,0x88ca910c,0x5690e6ef,0x84aa8cea,0x6bbfa9bf,0x88ca910c,0xffaa5556,0x88cb910c,0x59a9fefe,0x8ceb952c,0x7fe69505,0x88c98cca,0x7f6abafe,0x88ca910e,0x41166fbf,0x88ca910c,0x90b8bdff,0x88cb910a,0xe9e0a454,0x84aa8cec,
-0xffae169a,0x84aa8cea,0x46febf0b,0x88cb8cec,0xbf06545a,0x84a98cec,0xf91a00f9,0x8088910c,0x15b95545,0x910d952e,0xe4693f1b,0x80698cca,0x4aaa9a9,0x8cec910c,0xaf010000,0x80688ccc,0x42e5f450,0x806788ca,0x650f9af,0x8088994e,0xae4b57a5,0x808788aa,0xe9ffff,0x8489994c,0xf8fafabf,0x88ca8cea,0x5500a4a9,0x88ab90ec,0xffffaf01,0x8088994e,0x60a0fafa,0x90cc8cec,0xfe064154,0x848990ec,0xfcc84f5,0x910d8cec,0x154a9fe,0x8489992e,0xf996bf1b,0x8469952e,0x55fdbf0f,0x8cec910e,0x1,0x8020910c,0x556595fe,0x88cb950c,0x555454,0x84229972,0x40e9ffaf,0x8489a170,0xffbf0100,0x88a9992e,0xf5ffaf55,0x88ab952e,0xaf550000,0x8caaa592,0xe6001bab,0x88ab90ec,0x5595e5,0x80229d50,0x5b0159fe,0x80688caa,0x469bf6f,0x80259950,
-0xba79b9ef,0x84a988c8,0x10ffffff,0x8088994c,0x5a5596aa,0x806788ca,0x94fffeff,0x80888cea,0xffbf0100,0x84a9a18e,0x505aaff,0x84ab8cca,0xaf550000,0x88c9a5b0,0xaaff,0x804888ca,0x95aafaaa,0x84a988ca,0xfeff5bab,0x808884a8,0x56aaffbf,0x848a910a,0xfffb5603,0x8488950e,0x1554090,0x8d0ba590,0x5454febf,0x8069950c,0x596d6b,0x90ed952c,0x55ff55,0x8088992e,0xff6b0500,0x8489950e,0x10100a4,0x992fa170,0xaf010000,0x806890ec,0x50a4fe,0x950da570,0xa990febf,0x80478ccc,0x555555,0x8421a192,0xbfbfbf05,0x848990ea,0xe9a90569,0x802488cc,0xaa000000,0x848a952e,0x55aaff,0x8067a592,0xaa000000,0x8088950c,0x54a5faff,0x88aaa592,0xa5fe5500,0x8489950c,0x65654a5,0x8022952e,0xffaf0000,0x8488950a,0xa4f9fe,0x8045950e,
-0xfef9aaff,0x8d0b952c,0xfffffefe,0x8d0c912e,0x55bfeaff,0x88ca8cea,0x864bbffe,0x8ceb912c,0x16bbfff,0x910c996e,0x6f6ff990,0x88ea952c,0x79f5f1d6,0x88eb952e,0x192e3f3e,0x8067950c,0xe0d1aaff,0x84c98d0c,0x5b6ebfbe,0x88cb952c,0xaa14aaaa,0x910d952c,0xe001ffff,0x88ca9d6e,0x68142407,0x8d0c994e,0xf4e49cac,0x910c9d4e,0xfaf9f9f8,0x84a88cea,0xc7c3d5ea,0x808988ea,0x15156b6f,0x94eb910c,0x2afaa57e,0x88ca9d6e,0xa97d7e2d,0x84a990ea,0xe4ffeaf9,0x804688ca,0xbfffaa2b,0x84668c88,0xff5b01a9,0x8467990a,0xdfdfc580,0x80248466,0x1bf9f9ef,0x806690a8,0x51d0e0f4,0x950c9d4e,0x17165152,0x996fa9b0,0x2f1f5f9b,0x80ca8cec,0x68bdbdbe,0x8ceb998e,0x6767272b,0x88caa190,0x90abffab,0x88aa952e,0xf9f8f464,0x8ceba14e,0xd50bbefa,0x848988ca,
-0x9590aaaa,0x910c952c,0xbfe8bfff,0x88ca8cea,0xbf3f2efe,0x910b952c,0xda6e7ffe,0x8ceb8cea,0x16e6a2ff,0x8ceb910c,0xb0b3f6b,0x88c98cea,0xe4dbbd06,0x88ca8cec,0xe9f9f806,0x8086910a,0xe9e4e4bf,0x802584ea,0x7e1540d6,0x8ceb950c,0xbfea2f06,0x8066910c,0x51a6f6f,0x84a9952c,0xff5ba950,0x88eb910a,0x7f1b42e4,0x8022952c,0x5bce4605,0x910c910c,0xd0f4feaf,0x84a9952e,0xf85e5f1f,0x808884ca,0xd0e9eaf9,0x808988ca,0xaabe0500,0x8cca950a,0xeaebffeb,0x8ccb8cec,0xfbfbf6d0,0x848888aa,0x1f5ffafa,0x84a990ec,0xbfffffea,0x910c992e,0xa0b965ba,0x9d4fa16e,0xdabffefe,0x8cea950c,0xaf2f3faf,0x90ec910c,0x7d7f1b02,0x88ca994e,0xd3d1f8bc,0x80898cea,0x466fbfbf,0x950d9d4e,0x965a5501,0x88ca952e,0xd1d1d1d6,0x8488952e,0x2f69a9d5,0x806790ea,
-0x51ff6f01,0x8cca990e,0xff6f0540,0x80678cea,0xa9ff0000,0x8489a590,0xffa95555,0x8068950c,0x55a5e9a5,0x90ec9d4e,0xfaffa9,0x8ceb952c,0x56faf5a,0x950d952c,0xffff5a,0x90eb992e,0x1aff5054,0x88aa950e,0xfffe9505,0x84a990ea,0x45067ff8,0x88a990ea,0x5ffea55,0x8088910c,0xe5bebf1a,0x8ceb952c,0x54ffbf00,0x8ceba170,0xaaeaa500,0x84a9910c,0x55bfff90,0x8ccb994e,0xaa000000,0x80a990ec,0x55aaffff,0x8468a170,0x55000000,0x80468cea,0x55aaffff,0x88aaa150,0xffaa0000,0x84a99d2c,0x55aafe,0x80239952,0xfe950000,0x80689d4c,0x5556aa,0x80219d72,0x55000000,0x8046950c,0x55aaffff,0x88ca9d30,0xf9500000,0x88aa952c,0x55aa5aff,0x88ca90ec,0xfffa0000,0x8cca994c,0x5555aa,0x80229d72,0xffff4000,0x88cc9d70,0x1556a,0x8444950e,
-0x69691a1f,0x90eb952e,0x406bffaa,0x8088950c,0xe4a49090,0x88cb952c,0x55052ffe,0x806790ec,0x9aff5640,0x88aa8cea,0x5596ff5a,0x84a9992e,0x62f5556,0x88ca90ec,0x40066ffe,0x88aa910c,0xbfffeada,0x84888cca,0xeaf4f49b,0x88aa950c,0xaa160b1f,0x88aa910c,0x1b7fbfbf,0x8ceb992e,0xfd400195,0x88aa910c,0x9554105b,0x88ca952c,0x1bbef991,0x88a9952c,0xbfe54001,0x848890ec,0xffa95400,0x808890ec,0x99aafa6b,0x88cb950c,0xbffe940,0x806884aa,0x5aa6b95,0x88cb950c,0x5aff9500,0x88cb952e,0x5,0x8000952e,0x6afe90,0x88aa952e,0x0,0x8000992e,0x94467ffe,0x80678cea,0x5aa9a,0x88ca910c,0xbebeaa2f,0x8ceb9d4e,0xf940056a,0x8088910c,0x557ffe,0x848a950c,0x40000000,0x800090ec,0x50b1faff,0x8ccb8cca,0x5504040,0x80228cec,
-0xffffffff,0x8000808a,0xffff,0x80008000,0xf0fffff,0x80008000,0xf0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffff,0x80008000,0x0,0x80008000,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xc0c0ffff,0x80008000,0xc0c0,0x80008000,0xffffffff,0x80008008,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008042,0xffff,0x80008000,0xffffffff,0x800094ea,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x80008400,0xffff,0x80008000,0xf0fffff,0x80008000,0xf0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0ffff,0x80008000,0xc0c0,0x80008000,0xffffffff,0x80008cea,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x800090ec,0xffff,0x80008000,0xffffffff,0x80008068,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x8000806c,0xffff,0x80008000,0xffffffff,0x80008026,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xbe6b5040,0x912ca9d2,0x5400d0f5,0x8cea994e,0x51a5aaba,0x952ca5b0,0xf5b91f07,0x88caa190,0xf9ffbe94,0x952d9d6e,0xaf4b9baa,0x88ca910c,0x5b5b96d6,0x910c994e,0xaafebf6f,0x994ea190,0x1106e5ff,0x84a98cea,0x1375a091,0x9d6fa5b0,0xbc7cafa7,0x84a888ca,0xf86e9be5,0x8ceb9d6e,0xf9be6f0f,0x8ceb9d6e,0x8191d5e5,0x8ceb9d6e,0x6bfaf4e0,0xa190a9d2,0x1f0b1b5b,0x8ceb9d6e,0x81d0f4fe,0x8088910c,0x7a3e1a45,0x910c994e,0x2f1f1b56,0x88ca994e,0xe4e9ae6f,0x808888ca,0x2b2b3b3a,0x8ceb950c,0xf4f46526,0x90ec952e,0x489894d4,0x84a990ec,0xc2c28649,0x88a98cca,0xf4b8a490,0x952d9d6e,0x5baae5e4,0x8ceb910c,0x7f2f2f2f,0x84a8994e,0xbdbe7e7f,0x84a9994e,0x1b0b4b0b,0x806888ca,0x8fafaf6f,0x80898cea,0x2d7dbdb9,0x84aa910c,0x6f6f7f3e,0x84a9910c,
-0xe5691a42,0x84a8994e,0x651e5fdb,0x808888ca,0x5765a4fe,0x8ceaa190,0xd0f87e1f,0x88ca952c,0x195f8be7,0x8d0b950c,0xf4f4b469,0x910c994e,0x6e6f6f91,0x8067910c,0xe6eaa569,0x80888cea,0x91adffab,0x84a9992c,0x57f36805,0x952c994e,0xbf6f6b5a,0x88a8910c,0x550195fd,0x80a98cea,0xe0f9be2e,0x84a9994e,0xa7a60990,0x910c9d6e,0x5b66e0a4,0x910c994c,0xeaea6e1f,0x84a9952c,0xe0f4f4f4,0x952d9d6e,0xd0d0e0e0,0x910c9d6e,0x878b86d6,0x84a98cea,0xb0b4b4b,0x84a88cea,0xa0e0e0e0,0x952ea190,0xfef8f9e4,0x8ceb910c,0xb5b5f0b,0x8ceb994e,0x5b0b0b0b,0x84a9910c,0x5b1b6bab,0x8088910c,0x6c1c6e6f,0x808784a8,0x104095e5,0x8ceb952c,0xfd787965,0x88c98cca,0x6d5d6d6c,0x804688ec,0x1f2e6e6d,0x808888ca,0xa5f9f9f9,0x88ca8cea,0xf8a41565,0x84aa8cea,
-0x6a79a5f9,0x8ceb950c,0xbdd08146,0x88aa910c,0x7eb8d1d2,0x84a98cec,0x80475b6f,0x848890ec,0x8041076f,0x80688cca,0xd10b6ee4,0x88a988ca,0x2fbef9e4,0x84a9950c,0xfef99041,0x8ccb910c,0xd0d1c287,0x848890ec,0x5f6fbaa0,0x848990ea,0x42475b5b,0x84aa992c,0xf9f49141,0x88a98cec,0xfda54247,0x8ccb910c,0x6abffeff,0x8ceb990e,0x5bbffefe,0x88ca90ec,0xf9e58686,0x84898cea,0x5aafef4,0x806888ca,0xbfbe9000,0x84898cca,0x90052fab,0x808890ea,0xf9eafff9,0x806884aa,0xaaffffbf,0x88aa8cec,0x555595,0x80018d0e,0x9ad3e1f0,0x84aa848a,0x555555,0x842288ee,0xffa9a441,0x8046910c,0x116aabff,0x910cb1f4,0x5a950a6f,0x80898cca,0xa4a4ffaf,0x8488910c,0xaabf1f01,0x8069910c,0x5555aa,0x802288ee,0xfefdf4f4,0x84aa950c,0x5565aa,0x802388ec,
-0x5a15b9fe,0x88aa8cea,0x6f07165a,0x84898cca,0xf9f9e596,0x84a990ec,0xaeb8fdfd,0x848884aa,0xfdfaeaab,0x808890ec,0x166f7f7f,0x8cca910c,0xe1d69b9f,0x80898cca,0xd0d0d0c0,0x80888cec,0x970b471b,0x84898cea,0x2fbefbe7,0x808890ec,0x6f6fa9f9,0x84a990ec,0xa4a0a5ab,0x84aa8cea,0x1b1b1b2f,0x88a9994e,0x176b6767,0x88a9a9d2,0xf4f4f4b4,0x88aa8cca,0xe090a4f4,0x808890ea,0xfa550005,0x88a98cca,0x4196e6ff,0x84a990ec,0x9b8180d0,0x84aa8cca,0xfeffefef,0x88a98cca,0xebff9646,0x84aa88ca,0x5555aa,0x802284cc,0x6bfffefe,0x8ccb952e,0x555556,0x84228d0e,0x9f834313,0x84a990ec,0xbfbe879f,0x88aa88ca,0x6bbffff4,0x8068910c,0xeaea7e65,0x84888cec,0x459a9baf,0x88aa8cca,0x555555,0x800184ec,0x55afafea,0x88a988ca,0x555555,0x800184cc,
-0xa5befdb4,0x952c994e,0xf0b97fab,0x80888cea,0xe6eafae5,0x80668d0a,0x1bf91581,0x8cea9d4e,0xf9be0a8b,0x8cea910c,0x1ba6f0e0,0x952c994e,0x96d0fe5f,0x80878cea,0xfdbf6f1f,0x8ceb994c,0xafaf7f07,0x8066952c,0xbabebfbf,0x992da58e,0x7faae0fd,0x910b994c,0xeafa90e5,0x80468cca,0x6f1b1565,0x90ea9d4e,0x96d0f8fe,0x8087910c,0xb9645445,0x950c992c,0xaf5b66bf,0x84a990ea,0xf4fe6f1f,0x88ca952c,0x6995d6e4,0x80888cea,0x15164b8,0x9d6ea5b2,0x7e6f4b03,0x84a9994c,0x7f7f6f5a,0x88ca8cec,0xfbaa09a5,0x84aa84a8,0x90d0d0e5,0x804788ca,0xffbf5640,0x88ca8cec,0xf4bd6b5b,0x88ca994c,0x15a5e0f0,0x996dadf2,0xe2e9fdfe,0x806684a8,0x858fcfd7,0x84a98cea,0x6f5b1514,0x88eaa590,0xf9bd3e2f,0x8488952c,0xf5d18044,0x8ceb992c,0xa494fafd,0x88a9952c,
-0x697f6faa,0x910ca16e,0xfb6f1b92,0x8487950c,0x81d4f9ff,0x84a8910c,0x56752911,0x950ca16e,0x6a954087,0x88a990ea,0xf0f4b8b9,0x88a89d4e,0xd5fe3e0f,0x8046952c,0x9a499595,0x88a990ea,0xf4b96e6,0x808788ca,0xe0d0e97e,0x808788ca,0xe9eaabea,0x88ca910a,0xb025aa9,0x84a890ea,0x79190d0,0x88ca9d6e,0x95aabd1f,0x8046954e,0xfdaeefaf,0x848884a8,0xc2d6f0f8,0x88a9910c,0x5f87c3d1,0x88a99d4e,0x3f2f1f1f,0x8045992c,0x6f5b1b57,0x84678cea,0x6cbcfdbe,0x88a8990c,0x6f6f6f6f,0x8067910c,0xfeefbf6f,0x80878488,0xa0f4f474,0x88ca952c,0xffbaaaf5,0x88a98cca,0xaa9aaaea,0x88c98cca,0x55faffff,0x88ca8cea,0xaaaf1f4b,0x84a98cca,0x6e6fabaa,0x88a988ca,0xbeead295,0x88a98cea,0xd4c5cafb,0x848888a8,0xfaffefbe,0x84a98cc8,0x74787e2,0x8488a190,
-0xe5e5e0e1,0x8088994e,0x86469aea,0x806788aa,0x6fafffff,0x84a9910c,0xaf6f6f6f,0x8489950c,0xd5e6d686,0x80888cca,0xbfaaa969,0x804684cc,0x879bafaf,0x88ca90ec,0xd6eaa964,0x848890ec,0xe8e8a491,0x8488950c,0xfff25154,0x8ceb952e,0xb074355,0x88a99d4e,0x7f2f2e1f,0x8068952c,0x95b1baff,0x8ccb8cca,0x5b6a5555,0x8cca952e,0x7f6abfbf,0x8ceb90ec,0x50657979,0x992e9d4e,0x9051026f,0x910da16e,0x1b6654a4,0x910cadd2,0xbf7ea9d1,0x8ccb950c,0xf4e559ae,0x88aa994e,0xa956febf,0x848990ec,0x555555,0x802184cc,0x95eaebe5,0x84a98ccc,0x555555,0x842284cc,0x2e1f1f5b,0x8068992c,0x1b1b1f2e,0x88ca992e,0xc0804550,0x992d994e,0x949490d0,0x88ca992e,0x55fa6a1b,0x90ec950c,0x155555,0x8022910e,0x55afaa54,0x8ccb910c,0x0,0x800088aa,
-0xb8f9f9fa,0x84888cec,0xfc6dbdb9,0x848990ec,0x65baebff,0x84a98cca,0xea455a55,0x8488910c,0xe9aaaebd,0x88ca950c,0xfef9e4d0,0x8ccb952c,0xb1f7ffe,0x848990ec,0xe5964646,0x88aa910c,0xf9e5e4e4,0x806788ca,0x470f2fbe,0x84a9950c,0xb5bb1707,0x952da16e,0x79a9b8b4,0x90eb952c,0xfdf99542,0x8cca952c,0xb0a6abe,0x88cb90ec,0x9bab6a6a,0x88c990ec,0xb8e4e5ea,0x848990ea,0x1f1f6fbe,0x88ca994e,0x5f1f0b0b,0x88aa9d4e,0xf0f0f0f5,0x808890ec,0xd0e0e0e0,0x8ceb9d6e,0xe47e7e6f,0x84a9910c,0x90,0x80218cca,0x1b5d4980,0x952ea590,0x54692a,0x8002912e,0x6f9fef0b,0x806784aa,0x2f5f2f6f,0x80678cec,0x90666f7d,0x8ceb950c,0xe0e0f4a0,0x8cca992c,0xe4be7f2f,0x848990ea,0x51a80e0,0x8066952e,0x96e1e0e0,0x88ca90ec,0x695b56,0x80449d92,
-0xffffffff,0x80008400,0xffff,0x80008000,0xcfcfffff,0x80008000,0xcfcf,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008400,0xffff,0x80008000,0xcfcfffff,0x80008000,0xcfcf,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x80008400,0xffff,0x80008000,0xcfcfffff,0x80008000,0xcfcf,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008800,0xffff,0x80008000,0xf0fffff,0x80008000,0xf0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffff,0x80008000,0x0,0x80008000,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0ffff,0x80008000,0xc0c0,0x80008000,0xffffffff,0x800084aa,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x80008068,0xffff,0x80008000,0xcfcfffff,0x80008000,0xcfcf,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008004,0xffff,0x80008000,0xcfcfffff,0x80008000,0xcfcf,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008048,0xff000000,0x80008000,0xffffffff,0x8000800e,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800080b6,0xff000000,0x80008000,0xffffffff,0x80008048,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x8000952e,0xff000000,0x80008000,0xffffffff,0x80008caa,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800084ca,0xff000000,0x80008000,0xffffffff,0x800080f2,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008044,0xff000000,0x80008000,0xffffffff,0x80008024,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008002,0xff000000,0x80008000,0xffffffff,0x80008068,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008488,0xff000000,0x80008000,0xffffffff,0x800088aa,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008444,0xff000000,0x80008000,0xffffffff,0x80008026,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800084ce,0xff000000,0x80008000,0xffffffff,0x8000802c,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x8000a56e,0xff000000,0x80008000,0xffffffff,0x8000994e,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008068,0xff000000,0x80008000,0xffffffff,0x80008112,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008002,0xcf000000,0x80008000,0xffcfcfcf,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008046,0xff000000,0x80008000,0xffffffff,0x80008488,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008466,0xff000000,0x80008000,0xffffffff,0x80008044,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008048,0xff000000,0x80008000,0xffffffff,0x80008046,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008cca,0xff000000,0x80008000,0xffffffff,0x8000a14c,
-0xeb9bdad7,0x8cca8cea,0xf4f4babf,0x910b952c,0xfbb66b0f,0x8487950c,0x1b5b95ea,0x88ca950a,0x4786e3f9,0x88a8994c,0xbf3f3f5b,0x84a9952c,0x5b570606,0x8487910c,0xe1f4bc6e,0x8088992e,0xe6b92800,0x992ca16e,0x2d1f4b83,0x88c8952c,0x4181e4f9,0x88a8950a,0xf8fdbe66,0x950b9d6e,0x81e1f4f4,0x88a990ea,0x578f6901,0x950c910c,0xb47a1a0,0x8cea952c,0xf4f63e2f,0x88a9952c,0xfeaaffff,0x88a988ca,0xd311c3de,0x88ca88a8,0x3b1f8bc2,0x8488910c,0x9bdbebbb,0x848888ca,0x8fbffffb,0x88a988aa,0xfd5e0f8f,0x808884a8,0x3f2f2f1f,0x80889d4e,0xbabeae3f,0x8488910c,0x7c3e1f0b,0x84a8950c,0xbffffbf9,0x88ca950c,0x95549994,0x8cea950c,0xf4fab7a6,0x910c952c,0xd0e5feaf,0x8088910c,0xa9a595d0,0x8cca952c,0xaaa69aaa,0x90eb952c,0xbe6f1f6f,0x848890ea,
-0xbe4b4b96,0x848788a8,0x46d6f5f8,0x88c8952c,0xf9fe7e2f,0x8cc99d6e,0x5f8bc2d0,0x80878cc8,0xbe7f0b0a,0x950c9d4e,0x4260b8f8,0x8ceb992c,0x9ad1f17d,0x88a8910a,0x55626e1f,0x90ea994e,0x62b1e0f4,0xa58fa9b0,0x7f1f0b07,0x910ba16e,0x695a9b9b,0x8cca9d4c,0x50a0a4a4,0x9d6ea9d0,0x5fc7f47c,0x84878cc8,0xd1e4a96f,0x84a8950c,0xb162114,0x9d4da5b0,0x6f7f3f1f,0x88a9992c,0xbe1e0b83,0x8488994e,0x5f9ffebe,0x8cca910c,0xf4feb959,0x910ca16e,0x1f070290,0x84a8950c,0xbabfbf96,0x910c992c,0xaaf9f864,0x8cca952c,0x40e1fabf,0x84a9952c,0xfafe6e41,0x90eb952c,0xba7e9681,0x8cca952c,0x197dbeba,0x90eb910c,0xf4bdbf6f,0x8088910a,0x1a41c0e0,0x88a9950c,0xb86f195,0x8cea992c,0xe6e57d2f,0x88ca992c,0xaaffbe7e,0x910c994e,0xb420050,0x90eaa590,
-0xf9f9f8f8,0x848888ca,0xbcfafafa,0x84a98cca,0xe6677aba,0x808888ca,0x44c1c1d2,0x84a9950c,0xbfbfbebc,0x84a88cea,0x565b1f2f,0x8ccb910c,0x45292904,0x950c952c,0x65a5f4f4,0x84a69d2e,0xf4b0b8a9,0x88a9950c,0x1af7f7f6,0x950d994e,0x4a85aaaa,0x808888aa,0xfdffaf5f,0x88ca8cec,0xf9a86d2e,0x8088a170,0xf99aefff,0x80038088,0x1a5e5f8,0x950da590,0xab6e1b07,0x8067910a,0xfee99091,0x84a98cca,0x3e3eafff,0x84898cca,0xabaf6a26,0x950d9970,0x212511a6,0x910d9d6e,0xe1b4f879,0x84aa90ea,0x4554591,0x80239970,0x75ebffb6,0x80888cec,0x464655,0x80238d0c,0x6faad0f4,0x88eca16e,0x142dfebf,0x84898cec,0x405e6d7,0x8488950c,0xfcf81a01,0x88ca90ec,0xbdfffffe,0x88cb8d0c,0x40191f4,0x8044910c,0xaac0fbff,0x910c910c,0x54595656,0x8001850e,
-0x1f0f0656,0x84898cca,0x97d1a56e,0x80888cca,0xa8f9a995,0x8cea992e,0xaf6f4250,0x84a990ea,0xf9bf6f9b,0x8ccb994e,0x6504090,0x914da190,0x9781fdfe,0x806788ca,0x50f9feaf,0x952da9b0,0x652f9baf,0x8ceb950c,0xbef9fef9,0x8cca910c,0x95d5be6f,0x80888cea,0xfa9f6b16,0x84a990ea,0x2f064296,0x806788ca,0x95eaeabe,0x84a9910c,0xe4b80fe6,0x84a98cca,0xff5b0a45,0x806788ca,0x455abf1f,0x8025950c,0xbfbf5090,0x994ea56e,0xff560000,0x80679d6e,0x1011afe,0x84a9950c,0xffffbabb,0x84ca950a,0x41690501,0x80448d0e,0x5aff5a01,0x84898cec,0x1a010000,0x8022992c,0x56b40050,0xa190a9b0,0xe4fa,0x804590ec,0x505694f9,0x88c9a590,0x59bebf06,0x88aa992c,0x69ff5500,0x84898cea,0x555554,0x80219972,0xe9ff5555,0x84a98cca,0x551501,0x8443912e,
-0x2e2e1f0f,0x84878cca,0x6e2f6f6f,0x80878cea,0x5b55f8f8,0x90ea992c,0xc2d69669,0x8cca950c,0xadbd7cbd,0x88a8910a,0xf9f8f8bd,0x84a9910c,0xd2d2d2c2,0x88a89d2c,0xd0d0e1e1,0x84889d4e,0xfefefffe,0x950b992c,0xffcffffd,0x90ea90ea,0xd3d2d2d2,0x8487992c,0xfbe2d1d2,0x8cca950c,0x6f6f2fef,0x90eb950c,0xdbeb1b2f,0x910b90ea,0xaaf9f5fa,0x90eb950a,0xd3835b9b,0x8cca910c,0xe5f4e5e6,0x8cca910c,0x3d5f8b97,0x80888cca,0xe1e0e0e0,0x88c9994c,0x92d2e1e1,0x8cca952c,0xd6d2e57c,0x88a9950c,0x55beb92a,0xa190a9d2,0x6f0b4781,0x84a890ea,0xc1d1fcbe,0x84a9950c,0x51f6f6f6,0x950c994e,0xa9fafaa5,0x8cea910c,0xd2d2d2d3,0x84a8994c,0x83c3c3d2,0x88a8992c,0x59d9a5a6,0x8ceb950c,0x5f075a15,0x88a990ea,0x7a3f1f0f,0x8cca9d6e,0x9595f1a9,0x84a9910c,
-0xfeeeeeee,0x88a890ea,0xd7db2b3f,0x90ea992c,0xe3f7a3a3,0x8ceb9d6e,0xbfffe4a0,0x8cc994ea,0xfaf9f497,0x90ea950c,0xe0e5faf,0x88c9950c,0x965b6fbf,0x88a990ea,0xfdd0e0d1,0x8ceb90ea,0xc5c1c1d5,0x806688c8,0xeaeaebd6,0x806790ea,0x3030317,0x952da5b0,0x91420257,0x90eaa16e,0x7fbeb9fe,0x8488950c,0xfae79b6f,0x8cea992c,0xfdf4e0d0,0x88a89d4e,0xd1d7effe,0x90eb910c,0xb5da4a0e,0x992d994e,0x2f1f1f5b,0x88c9952c,0xb995aabe,0x950c9d6e,0xae95d0f4,0x8cea950c,0xf4fcfeaf,0x84a9992c,0x2f4b81e0,0x8488a16e,0x1f1b1f1f,0x8ccaa190,0xf97f2f1f,0x80679d6e,0xf4961a6e,0x910c994e,0x9b8b9fbf,0x88ca90ea,0x7fbeb8e0,0x90eba590,0x470b1f2f,0x88a99d6e,0xbeaf9f8f,0x84a98cea,0x297c7dbd,0x8cca910c,0xc7c3c387,0x88ca992e,0xa4a4558b,0x88ca950c,
-0x2f571400,0x8ceba590,0x9686e9be,0x80678cca,0x60b564d1,0xa16fa9b0,0xfe7e1a05,0x84a99d6e,0xbe0beab,0x8488950c,0x5ba5a9bf,0x84a990ea,0xffbeaaea,0x8488910c,0xffbf0790,0x84889d4e,0xd0e1bebf,0x80888cca,0xb500040,0x950ca590,0x5b020191,0x80678cea,0x40e9feff,0x88c9994e,0x9ad0fe7f,0x84a98cca,0x6f41f9ef,0x8488952c,0xfeff1b00,0x88caa9b0,0xfabfff,0x88a9950c,0x95f9ffaf,0x8488954c,0xa5fa0500,0x8068992e,0xffbf0be4,0x84a9950c,0xebaf40b9,0x88a99d4e,0xffaa0055,0x84ab8cca,0x5554f9,0x80449d70,0xd7ede191,0x88cb88a8,0x80a5aa9b,0x80238d30,0x6f40f9ff,0x8488952c,0xcfcf5ea5,0x910c8cea,0x94e9ff5b,0x8088952c,0xe56e5656,0x88aa952c,0x97fafbe6,0x88aa990c,0xaa6a1a0b,0x80249d92,0x7f2f1f9b,0x84a9992e,0x90e4e8be,0x8067950c,
-0x65d9f979,0x84a990ea,0xfdbfab56,0x84888cea,0xbf6fd2f1,0x8488910c,0x1ffffafe,0x8cca910c,0xbf0600d0,0x84a89d4e,0xf9efeaff,0x88a9910c,0x650f96f,0x8088994c,0xff5aaaff,0x806688ca,0xfa7e2f2f,0x88a9950c,0x96bfff,0x8ceb950c,0xfffef4f4,0x8cca950c,0x5501a5f5,0x8ceb952c,0xfeffa9,0x8488950c,0x56016abf,0x88c9950c,0xa90b0b7f,0x84a88cca,0x551eaafa,0x88a988ca,0xfeffbf40,0x84a89d4e,0x1759fafe,0x950c910c,0xffff01f9,0x88a9992c,0x1aafffff,0x84a99d4e,0xa4b86e5f,0x8089992c,0x829291a0,0x8023a1b2,0xeaf9b92e,0x88c9950c,0x65a5696,0x80448d0e,0xff0650fb,0x84a990ea,0x40ffffbf,0x84888cec,0xbf54f9e1,0x8cca910c,0xf9ffaf6a,0x808788ca,0x35a6510,0x954e9d4c,0x556a1b,0x80229550,0x9aa5e0,0x994e9d2c,0x54a95500,0x80219db4,
-0xffffffff,0x80008022,0xffff,0x80008000,0xffffffff,0x80008002,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008cca,0xffff,0x80008000,0xffffffff,0x80008cca,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x80008002,0xffff,0x80008000,0xffffffff,0x80008932,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008400,0xffff,0x80008000,0xf0fffff,0x80008000,0xf0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xc0c0ffff,0x80008000,0xc0c0,0x80008000,0xffffffff,0x80009862,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x800080f2,0xffff,0x80008000,0xffffffff,0x80008088,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x80008066,0xffff,0x80008000,0xffffffff,0x80008002,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008c22,0xffff,0x80008000,0xffffffff,0x80008022,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x5e1e1d6d,0x8087910a,0x1b5f9f9f,0x806790ea,0xa04a4f4,0x950b952c,0xf8e4d1d6,0x90ea950c,0x2e3a2713,0x88a9950c,0xa2978b4e,0x88c99d4e,0xb878bcfc,0x8cc990ea,0xb2f6ffe,0x950c994c,0x9afeffff,0x910b994c,0xffffbf6a,0x950b9d2c,0x414b9f9b,0x8cc9910c,0xfffffa95,0x950b9d2c,0x55f8ffff,0x90eb990c,0x80a4be5b,0x8cc9950c,0x55abffff,0x90ea992c,0x1f0b0555,0x88ca992c,0xbdf5f6f2,0x88c9910a,0xefdedead,0x84a88cea,0xf8ff5606,0x950c992c,0xe1e2ffff,0x88c98cea,0x7f7fbfbf,0x88a99d2e,0xbfbebe7f,0x84889d4e,0xf8f4f4f0,0x8488a16e,0xf8f8f8f8,0x84889d4e,0xfafa5540,0x8cea952c,0x4281e9d6,0x80668cea,0x4392f9bf,0x8488992c,0x5b6f5b47,0x8ceb9d6e,0xd6864646,0x84678cca,0xfbcfc74a,0x90ec8cca,0xf0f4d4d,0x8047992c,0x2f2f1f5e,0x80679d4e,
-0x7f1f1f1f,0x88ca950c,0xffffaffe,0x90eb910c,0x9064fdfd,0x84a88cea,0xffffaaaa,0x8ceb950c,0xfde1abaf,0x90eb950c,0xa5e4f095,0x950c9d6e,0x6f5b6bea,0x8ceb992c,0xaf1f82fe,0x8cca952c,0x55647dae,0x88ca8cc8,0xbfbf7e6a,0x90eb994e,0x95692e2f,0x80449db2,0x16155555,0x8422912e,0x575bebf,0x910c950c,0x50e5ff6f,0x88caa16e,0x1555151a,0x80229970,0x695b5615,0x80238d0e,0xf91b1b55,0x808790ea,0xe4e0e0f4,0x8ceb994e,0x4240a4f9,0x8cc98cea,0xffaf6f1b,0x80878cec,0xf4f4f4f4,0x952da590,0xf4f4f4f4,0x994da16e,0x47abfffa,0x90eb952c,0x92974307,0x952da190,0xfd6f1f06,0x84a9992c,0x85e0c1fd,0x910c90ea,0x1100050,0x8422a190,0x2e2f1b16,0x8045a5d4,0x1f1f6f6f,0x80888cc8,0x1f1f1f1f,0x80678cca,0x101055aa,0x802280aa,0x101010,0x802188ca,
-0xf7ffffff,0x88a990ec,0xe9f4e6e2,0x8ccb950c,0xaba6f4f8,0x88aa950c,0x9bd7abab,0x88a98cca,0xbaa4f9f5,0x88a98cea,0x8e8daefb,0x84a988ca,0xfa7fbfeb,0x88a990ea,0xbfffffff,0x88c994ea,0x4196e6d7,0x802488ca,0x9b1a6995,0x806690ea,0x1a6f2f2f,0x88c9a16e,0xfee00006,0x88a8a18e,0x5680e5ff,0x804690ea,0xf5ff5bff,0x88a98cea,0xaa0b1bff,0x80868cc8,0xffff006f,0x8088910c,0x41e5ffef,0x84a988ca,0xbf160501,0x806788a8,0xfeffbf7f,0x88ca8cea,0xb9bcf9fd,0x84a888ca,0x90d6faff,0x80889d4c,0x55aa4540,0x80239992,0x6faffffa,0x84a988ca,0x156596e,0x80238d0c,0x2faaf9a0,0x88c9910c,0xfaffff7f,0x88a98cc8,0x64f9ebff,0x88ca952c,0xbf5a6fbe,0x80888cea,0xa9ff5ba6,0x84a98cec,0x5555a5,0x8022912e,0xea1f00fe,0x80888cca,0x555555,0x8022890c,
-0xb5f5f9f4,0x952d9d4e,0x6ffff890,0x8087950c,0xfdf4c182,0x84a9910a,0x90066fff,0x80669d4e,0x6efde802,0x84a8952c,0xaa6b6801,0x848790ec,0xd06bbff9,0x84a9952c,0xea8055fd,0x806788a8,0xbf651b1f,0x88ca8cea,0x4fbdf5be,0x88ca8cea,0x0,0x80008cca,0x15151615,0x84428d0e,0x6b05054b,0x808888a8,0x5bbfbefa,0x8487950c,0x1a155455,0x800188ec,0x151616,0x8021994c,0x545bffaf,0x8468950c,0x560151e9,0x88a9992c,0xa50006bf,0x8489992c,0x5540aaff,0x80668cca,0xff00e4ff,0x8488950a,0x555501,0x80218cec,0xff50affa,0x84a9992c,0x559500,0x80018cec,0xffa50001,0x8487a58e,0xaa552abf,0x80678cc8,0x6faa5000,0x80228cea,0x6a1528be,0x8044910c,0x6ff905ff,0x88ca990a,0x55be50,0x80448cec,0x55af5416,0x8023912e,0x15166a,0x8001954e,
-0xffffffff,0x800090c8,0xf0fffff,0x80008000,0xf0f0f0f,0x80008000,0xf0f,0x80008000,0xff0f0f0f,0x80008000,0xffffffff,0x80008046,0xf000000,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x800084a6,0xffffffff,0x80008820,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0xffffffff,0x80008002,0xffffffff,0x80008002,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008888,0xffffffff,0x800088ca,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008886,0xffffffff,0x800088a8,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008024,0xffffffff,0x80008cc8,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008440,0xffffffff,0x80008464,
-0xffffffff,0x800084a8,0xff0fffff,0x80008000,0xf0f0f0f,0x80008000,0xf000f0f,0x80008000,0xffffffff,0x80008c64,0xffffffff,0x80008444,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x800080ec,0xff0fffff,0x80008000,0xf0f0f0f,0x80008000,0xf000f0f,0x80008000,0xffffffff,0x80008068,0xffffffff,0x80008422,0xf0f0f0f,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008ca8,0xffffffff,0x800084ec,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008444,0xffffffff,0x8000992c,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x80008d0a,0xffffffff,0x800080aa,0xc0c0c0c0,0x80008000,0xc0c0c0c0,0x80008000,0xffffffff,0x800088ea,0xffffffff,0x800090e8,
-0xffffffff,0x80008026,0xffff,0x80008000,0xf0fffff,0x80008000,0xf0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffff,0x80008000,0x0,0x80008000,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffff,0x80008000,0x0,0x80008000,0xc0c0ffff,0x80008000,0xc0c0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xffffffff,0x80008422,0xffff,0x80008000,0xcfcfffff,0x80008000,0xcfcf,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0xffffffff,0x80008ca6,0xffff,0x80008000,0xf0f0f0f,0x80008000,0xf0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0c0c0c0,0x80008000,0xc0c0,0x80008000,0xffffffff,0x8000952c,0xffff,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80009952,0xff000000,0x80008000,0xffffffff,0x800080cc,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x8000808e,0xff000000,0x80008000,0xffffffff,0x80008044,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x8000806c,0xff000000,0x80008000,0xffffffff,0x800080ae,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008c88,0xff000000,0x80008000,0xffffffff,0x80009d2a,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x800080aa,0xff000000,0x80008000,0xffffffff,0x80008046,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x8000804c,0xff000000,0x80008000,0xffffffff,0x80008048,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x8000806a,0xff000000,0x80008000,0xffffffff,0x80008084,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008046,0xff000000,0x80008000,0xffffffff,0x80008026,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008004,0xff000000,0x80008000,0xffffffff,0x80008024,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008488,0xff000000,0x80008000,0xffffffff,0x80008422,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008486,0xff000000,0x80008000,0xffffffff,0x8000808e,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008002,0xff000000,0x80008000,0xffffffff,0x80008486,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008884,0xf000000,0x80008000,0xf0f0f0f,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,
-0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0x0,0x80008000,0xc0000000,0x80008000,0xc0c0c0c0,0x80008000,0xff000000,0x80008000,0xffffffff,0x80008468,
-0x0,
-};
-
-static int _Background_pvrtc_size = 131072;
-
-// ******** End: Background.pvrtc ********
-
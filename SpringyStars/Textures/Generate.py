@@ -9,11 +9,10 @@ from PIL import Image
 from PIL import ImageFilter
 from PIL import ImageEnhance
 
-path = '/Users/prideout/Documents/PowerVR-ES2/Utilities/'
-#path = '/Users/prideout/Samples/PowerVR-ES2/Utilities/'
+# Build with: g++ -O2 -o TextureCooker TextureCooker.cpp -lpng -lpthread
+#             g++ -O2 -o AssetPacker AssetPacker.cpp
+tools = '../../Common/Tools/'
 
-textool = 'PVRTexTool/PVRTexToolCL/MacOS/PVRTexTool -h -yflip1 -fOGL8888 -i'
-filewrap = 'Filewrap/MacOS/Filewrap -h -o '
-
-system(path + textool + "Star.png")
-system(path + filewrap + 'Background.h Background.pvrtc')
+# The background is raw PVRTC, so it goes into the pack as it is.
+system(tools + 'TextureCooker -f 8888 -m none Star.png Star.pvr')
+system(tools + 'AssetPacker Textures.pack Star.pvr Background=Background.pvrtc')
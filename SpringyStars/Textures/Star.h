@@ -1,36 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT static const unsigned long
-#endif
-
-A32BIT Star[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x00000010,		/* dwHeight */
-0x00000010,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00018012,		/* dwpfFlags */
-0x00000400,		/* dwDataSize */
-0x00000020,		/* dwBitCount */
-0x000000ff,		/* dwRBitMask */
-0x0000ff00,		/* dwGBitMask */
-0x00ff0000,		/* dwBBitMask */
-0xff000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x02000000,0x02000000,0x0280ffff,0x00ffffff,0x00ffffff,0x00ffffff,0x01000000,0x00ffffff,0x00ffffff,0x00ffffff,0x01ffffff,0x00ffffff,0x16000000,0x43000000,0x1e4d6666,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x01000000,0x37000000,0x3e082929,0x03000000,0x00ffffff,0x01000000,
-0x02808080,0x00ffffff,0x17859090,0x8678a0a2,0xc21d4b4e,0x9e000000,0x52030000,0x174e4e4e,0x02000000,0x2c000000,0x8a369494,0xd32d7678,0x6c000000,0x00ffffff,0x00ffffff,0x01000000,0x04bfffff,0x00ffffff,0x1e559999,0xd8cbf0f1,0xffbde6e8,0xe93c898c,0xd202000c,0x96000000,0x8a32696b,0xd276c2c4,0xff71fafd,0xed3cb9ba,0x4a000000,0x00ffffff,0x02008080,0x00ffffff,
-0x04bfbfbf,0x00ffffff,0x03000000,0xafdbeff0,0xfff5ffff,0xfba1fafd,0xf94fcdd0,0xf55ab4b6,0xffb2e5e6,0xffb1ffff,0xff78ffff,0xcb2e9092,0x2f000000,0x00ffffff,0x02008080,0x00ffffff,0x02808080,0x00ffffff,0x00ffffff,0x88c1dadb,0xffe7ffff,0xfdb7ffff,0xff66ffff,0xffa5ffff,0xfee0ffff,0xfbb1ffff,0xff6ceef1,0xba216364,0x1b000000,0x00ffffff,0x03000000,0x00ffffff,
-0x02000000,0x02ffffff,0x00ffffff,0x6574cad4,0xffc3ffff,0xffbbfeff,0xfe63f9fd,0xfeb0fdff,0xfee3fcfc,0xffacffff,0xfe5de5e7,0xc8002e2f,0x56000000,0x0280ffff,0x00ffffff,0x01000000,0x02ffffff,0x00ffffff,0x1f000000,0xbd74c6cd,0xffa0ffff,0xfd95ffff,0xff66fbfe,0xffaafdff,0xffb8fcfe,0xff76ffff,0xfe4ef0f3,0xeb308b8c,0xbf000000,0x5a000000,0x04408080,0x00ffffff,
-0x00ffffff,0x23000000,0xc29fc6ca,0xffcdffff,0xfcb6ffff,0xfe8dfbfe,0xff70fcff,0xff74fcff,0xff59fcff,0xfe46fbfe,0xfd54ffff,0xfd50eff2,0xec329596,0xc3000000,0x67000000,0x0d144e4e,0x28008086,0xd0bfdbde,0xfffbffff,0xffdbffff,0xffbbffff,0xff8afeff,0xfe81fcff,0xff8bfdff,0xff57fbfe,0xff51ffff,0xff58ffff,0xff56ffff,0xff54ffff,0xf737b0b1,0x87060000,0x15001818,
-0x4f679194,0xb6c3dcdd,0xc6cbe9ec,0xdcaff3f7,0xf28ef6f8,0xff82f8fb,0xffc3ffff,0xfeb6fdff,0xff65fdff,0xff4df5f8,0xed4ff3f6,0xcf4ce9ea,0xb94de5e8,0x9248dadc,0x2a373737,0x00ffffff,0x01000000,0x01000000,0x0d000000,0x195cccd6,0x3400848e,0xb9b2e1e3,0xffeeffff,0xfbb1ffff,0xff64fcff,0xbd39a9ab,0x34277b7b,0x0e49a4a4,0x06000000,0x00ffffff,0x00ffffff,0x00ffffff,
-0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x49b6c7c7,0xf4d3f5f6,0xffb5ffff,0xf452d1d4,0x56000000,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x01000000,0x01000000,0x0100ffff,0x02ffffff,0x02808080,0x0599cccc,0x00ffffff,0x01000000,0xa9b2edee,0xffb1ffff,0xae45a1a3,0x11000000,0x00ffffff,0x0440bfbf,0x0280ffff,0x02008080,0x00ffffff,0x00ffffff,
-0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x0599ffff,0x00ffffff,0x5279d3d3,0xc97cd1d3,0x3f497979,0x00ffffff,0x02ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x02000000,0x00ffffff,0x0f004444,0x26145151,0x00ffffff,0x00ffffff,0x02008080,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,0x00ffffff,
-0 };
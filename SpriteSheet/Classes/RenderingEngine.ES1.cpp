@@ -2,47 +2,18 @@
 #include <OpenGLES/ES1/glext.h>
 #include "Interfaces.hpp"
 #include "Box.hpp"
-#include "../Textures/Unified.h"
-#include "../Textures/BodyLayer.h"
-#include "../Textures/EyesLayer.h"
-#include "../Textures/Tile.h"
-#include "../Textures/Background.h"
+#include "../../Common/Classes/AssetPack.hpp"
+#include "../../Common/Classes/PvrUpload.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <vector>
+#include <iostream>
+
+std::string GetResourcePath(const std::string& file);
 
 using namespace std;
 
 namespace ES1 {
 
-struct PVRTextureHeader {
-    unsigned int HeaderSize;
-    unsigned int Height;
-    unsigned int Width;
-    unsigned int MipMapCount;
-    unsigned int Flags;
-    unsigned int TextureDataSize;
-    unsigned int BitCount;
-    unsigned int RBitMask;
-    unsigned int GBitMask;
-    unsigned int BBitMask;
-    unsigned int AlphaBitMask;
-    unsigned int PVR;
-    unsigned int NumSurfs;
-};
-
-enum PVRPixelType {
-    OGL_RGBA_4444 = 0x10,
-    OGL_RGBA_5551,
-    OGL_RGBA_8888,
-    OGL_RGB_565,
-    OGL_RGB_555,
-    OGL_RGB_888,
-    OGL_I_8,
-    OGL_AI_88,
-    OGL_PVRTC2,
-    OGL_PVRTC4,
-    PVRTEX_PIXELTYPE = 0xff,
-};
-    
 struct Framebuffers {
     GLuint Screen;
 };
@@ -76,7 +47,10 @@ public:
     void Render() const;
     void UpdateAnimation(float timestamp);
 private:
-    GLuint CreateTexture(const unsigned long* data);
+    GLuint LoadTexture(const char* name) const;
+    GLuint CreateTexture(const void* data, size_t size) const;
+    GLuint CreateRawPvrtcTexture(const void* data, size_t size, int width, int height) const;
+    GLuint CreateTexture(const PvrTexture& texture) const;
     Textures m_textures;
     Renderbuffers m_renderbuffers;
     Framebuffers m_framebuffers;
@@ -84,6 +58,7 @@ private:
     std::vector<NoopSprite> m_unifiedFrames;
     size_t m_frameCount;
     size_t m_frameIndex;
+    AssetPack m_assets;
 };
 
 IRenderingEngine* CreateRenderingEngine()
@@ -99,14 +74,24 @@ RenderingEngine::RenderingEngine()
 
 void RenderingEngine::Initialize()
 {
+    // Open the asset pack.  It stays mapped, but once the sprite coordinates
+    // are copied out and GL has a copy of each texture, their pages can go.
+    string packPath = GetResourcePath("Textures.pack");
+    if (m_assets.Open(packPath.c_str()) != AssetPackErrorNone)
+        cout << packPath << ": " << AssetPack::GetErrorString(m_assets.GetError()) << ".\n";
+    AssetEntry bodyBoxes = m_assets.Find("BodyLayerBoxes");
+    AssetEntry eyeBoxes = m_assets.Find("EyeLayerBoxes");
+    AssetEntry unifiedBodyBoxes = m_assets.Find("UnifiedBodyLayerBoxes");
+    AssetEntry unifiedEyeBoxes = m_assets.Find("UnifiedEyeLayerBoxes");
+
     // Load up the sprite coordinates:
-    m_frameCount = sizeof(BodyLayerBoxes) / sizeof(box2);
+    m_frameCount = bodyBoxes.Size / sizeof(box2);
     m_frameIndex = 0;
     m_noopFrames.resize(m_frameCount);
     m_unifiedFrames.resize(m_frameCount);
 
-    const float* pBody = BodyLayerBoxes;
-    const float* pEyes = EyeLayerBoxes;
+    const float* pBody = (const float*) bodyBoxes.Data;
+    const float* pEyes = (const float*) eyeBoxes.Data;
     for (size_t i = 0; i < m_frameCount; ++i) {
         float l, t, r, b;
         
@@ -125,8 +110,8 @@ void RenderingEngine::Initialize()
         m_noopFrames[i].Eyes.FlipY(512);
     }
     
-    pBody = UnifiedBodyLayerBoxes;
-    pEyes = UnifiedEyeLayerBoxes;
+    pBody = (const float*) unifiedBodyBoxes.Data;
+    pEyes = (const float*) unifiedEyeBoxes.Data;
     for (size_t i = 0; i < m_frameCount; ++i) {
         float l, t, r, b;
         
@@ -144,13 +129,19 @@ void RenderingEngine::Initialize()
         m_unifiedFrames[i].Eyes  = box2::FromLeftTopRightBottom(l, t, r, b);
         m_unifiedFrames[i].Eyes.FlipY(512);
     }
+    m_assets.Release(bodyBoxes);
+    m_assets.Release(eyeBoxes);
+    m_assets.Release(unifiedBodyBoxes);
+    m_assets.Release(unifiedEyeBoxes);
     
     // Load up some textures:
-    m_textures.Tile = CreateTexture(Tile);
-    m_textures.Eyes = CreateTexture(EyesLayer);
-    m_textures.Body = CreateTexture(BodyLayer);
-    m_textures.Unified = CreateTexture(Unified);
-    m_textures.Background = CreateTexture(_Background_pvrtc);
+    m_textures.Tile = LoadTexture("Tile");
+    m_textures.Eyes = LoadTexture("EyesLayer");
+    m_textures.Body = LoadTexture("BodyLayer");
+    m_textures.Unified = LoadTexture("Unified");
+    AssetEntry background = m_assets.Find("Background");
+    m_textures.Background = CreateRawPvrtcTexture(background.Data, background.Size, 512, 512);
+    m_assets.Release(background);
 
     // Extract width and height from the color buffer:
     ivec2 screenSize;
@@ -188,6 +179,7 @@ void RenderingEngine::Initialize()
     
 void RenderingEngine::UpdateAnimation(float timestamp)
 {
+    PROFILE_ZONE("ES1::RenderingEngine::UpdateAnimation");
     float speed = 30;
     int timeindex = ((int) (timestamp * speed)) % (m_frameCount * 2);
     if (timeindex < m_frameCount)
@@ -203,6 +195,7 @@ void RenderingEngine::UpdateAnimation(float timestamp)
 
 void RenderingEngine::Render() const
 {
+    PROFILE_ZONE("ES1::RenderingEngine::Render");
     NoopSprite sprite = m_unifiedFrames[m_frameIndex];
     //NoopSprite sprite = m_noopFrames[m_frameIndex];
 
@@ -334,46 +327,44 @@ void RenderingEngine::Render() const
     }
 }
 
-GLuint RenderingEngine::CreateTexture(const unsigned long* data)
+GLuint RenderingEngine::LoadTexture(const char* name) const
 {
-    PVRTextureHeader* header = (PVRTextureHeader*) data;
-    GLsizei w = header->Width;
-    GLsizei h = header->Height;
-    const unsigned long* texels = data + header->HeaderSize / 4;
+    AssetEntry entry = m_assets.Find(name);
+    GLuint texture = CreateTexture(entry.Data, entry.Size);
+    m_assets.Release(entry);
+    return texture;
+}
 
+GLuint RenderingEngine::CreateTexture(const void* data, size_t size) const
+{
+    PvrTexture texture;
+    ParseTextureAsset(data, size, texture);
+    assert(texture.IsValid() && "Bad PVR texture.");
+    return CreateTexture(texture);
+}
+
+// The background is raw PVRTC with no header.
+GLuint RenderingEngine::CreateRawPvrtcTexture(const void* data, size_t size,
+                                              int width, int height) const
+{
+    PvrTexture texture;
+    texture.ParseHeaderless(data, size, PvrPixelTypePvrtc4, width, height);
+    assert(texture.IsValid() && "Bad PVRTC texture.");
+    return CreateTexture(texture);
+}
+
+GLuint RenderingEngine::CreateTexture(const PvrTexture& texture) const
+{
     GLuint name;
     glGenTextures(1, &name);
     glBindTexture(GL_TEXTURE_2D, name);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    bool mipmapped = texture.GetLevelCount() > 1;
+    GLenum minFilter = mipmapped ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    
-    switch (header->Flags & PVRTEX_PIXELTYPE) {
-        case OGL_I_8: {
-            GLenum format = GL_ALPHA;
-            GLenum type = GL_UNSIGNED_BYTE;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_AI_88: {
-            GLenum format = GL_LUMINANCE_ALPHA;
-            GLenum type = GL_UNSIGNED_BYTE;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_RGB_565: {
-            GLenum format = GL_RGB;
-            GLenum type = GL_UNSIGNED_SHORT_5_6_5;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        default: {
-            w = h = 512;
-            GLsizei size = max(32, w * h / 2);
-            GLenum format = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG;
-            glCompressedTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, size, data);
-            break;
-        }
-    }
+
+    if (!UploadPvrTexture(texture))
+        std::cout << "Unknown format.\n";
 
     return name;
 }
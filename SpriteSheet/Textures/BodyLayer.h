@@ -1,2094 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT static const unsigned long
-#endif
-
-A32BIT BodyLayer[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x00000100,		/* dwHeight */
-0x00000200,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00018017,		/* dwpfFlags */
-0x00040000,		/* dwDataSize */
-0x00000010,		/* dwBitCount */
-0x000000ff,		/* dwRBitMask */
-0x000000ff,		/* dwGBitMask */
-0x000000ff,		/* dwBBitMask */
-0x0000ff00,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x0b820182,0x0f820f82,0x01820b82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x19820000,0x8a825882,0xde82b882,
-0xff82f182,0xff82ff82,0xef82fd82,0xba82d882,0x4e828482,0x00001182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0e820182,0x1e821682,0x10821882,0x00000982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30820982,0x7e825c82,0xb082a682,0xb482b082,0x9a82ac82,0x5e827e82,0x09823a82,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6c821382,0xfb82d282,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xd082fb82,0x15827a82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0x72823482,0xcc829a82,0xff82ed82,0xff82ff82,0xff82ff82,0xe682fb82,0xa082ca82,0x30827082,0x00000582,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2e820182,0xc4827682,0xff82f982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf982ff82,0x7a82c082,
-0x00002982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xaa823182,0xff82f982,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf982ff82,0x2d82a482,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0f820000,0x30822282,0x32823082,0x22822e82,0x01821282,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x50820d82,0xed82a682,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xa882ed82,0x09825282,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x62820b82,0xff82d382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xce82fd82,0x07825e82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xae821d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x2382ac82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x0d820182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0x68822e82,0xc4829c82,0xff82f082,0xff82ff82,0xff82ff82,0xff82ff82,0xeb82ff82,0x9a82c482,0x34826c82,0x00000382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x84821f82,0xff82ed82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf182ff82,0x1b828082,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6c820b82,0xff82e182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xe982ff82,0x05826c82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x74820382,0xff82f382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf382ff82,0x05826e82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0x4e822282,0xa2828082,0xda82ca82,
-0xf482e882,0xfd82f182,0xe682f482,0xbe82d082,0x8882a282,0x1f825482,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4c820582,0xef82a482,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x9e82e582,0x05824a82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x8e821382,0xff82f582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf782ff82,0x0f828682,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x43820000,0xff82d782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xdd82ff82,0x00004b82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x17820000,0xff82bd82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xb982ff82,0x00001382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x70822782,0xe582b082,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xbc82e882,0x22827282,0x00000182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x80821782,0xff82e982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xe582ff82,0x1d828682,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x62820182,0xff82e982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xeb82ff82,0x00005d82,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0d820000,0xff82a282,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0x9a82ff82,0x00000982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xdb822782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x2382dd82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08820182,0x34822282,0x50824c82,0x58826082,0x60826a82,0x46825282,0x1a823282,0x00000982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1d820000,0xd8827682,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x7e82d182,0x00001b82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x98821b82,0xff82fb82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xfd82ff82,0x1f829282,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x13820000,0xff82a782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xa682ff82,0x00001382,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xcf821982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x1d82cd82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2f820000,0xff82e982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xed82ff82,0x00002f82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x24820382,0x7e824e82,0xc682a682,0xff82eb82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xe682f982,0x9e82ca82,0x4e827a82,0x03822882,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4e820582,0xfd82b682,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xb482fb82,0x03824e82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x74820582,0xff82f982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf582ff82,0x0b827e82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xdd822d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x2782dd82,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2d820000,0xff82e782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xe382ff82,0x00002582,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xeb822982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x2d82e982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x26820382,0x6a824e82,0xc8829682,0xff82f382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf382ff82,0x9e82c682,0x46827882,0x07822a82,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x70820d82,0xff82df82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xdf82ff82,0x0d826c82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x39820000,0xff82cf82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xcf82ff82,0x00002f82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3d820000,0xff82e982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xef82ff82,0x00003582,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xeb822d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x2982e782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0f820000,0xff82dd82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff83ff83,0xff84ff83,0xff83ff84,0xff83ff83,0xff82ff82,0xff82ff82,0xd982ff82,0x00001382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2f820000,0xc8828082,0xff82f182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf782ff82,
-0x7c82ca82,0x01822282,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x74820b82,0xff82e782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xeb82ff82,0x0b827482,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xfb826782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x6782f982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xe9823182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x2f82ef82,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x19820000,0xff82dd82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,
-0xff83ff83,0xff83ff83,0xff82ff83,0xff82ff82,0xff82ff82,0xe382ff82,0x00001b82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xaf820182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff83ff83,0xff85ff84,0xff86ff86,0xff87ff87,0xff88ff88,0xff87ff88,0xff87ff87,0xff85ff86,0xff83ff84,0xff82ff82,0x0182af82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x48820382,0xff82ca82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xbf82ff82,0x01824882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x58820182,0xff82e782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xe382ff82,0x01825c82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x92820182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x03829482,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1f820000,0xff82e782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff84ff83,0xff84ff84,0xff85ff85,0xff85ff85,0xff84ff84,0xff84ff84,0xff82ff83,0xff82ff82,0xeb82ff82,0x00001b82,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc3820582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff84ff84,0xff86ff85,0xff86ff86,
-0xff87ff86,0xff87ff87,0xff85ff86,0xff84ff85,0xff82ff83,0xff82ff82,0x0582bf82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff825a82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff83ff82,0xff85ff84,0xff87ff86,0xff89ff88,0xff8bff8a,0xff8cff8b,0xff8cff8c,0xff8cff8c,0xff8cff8c,0xff8aff8b,0xff87ff89,0xff83ff85,0x5a82ff82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x25820000,0xff82c782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xbd82ff82,0x00002582,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0d820000,0xff82af82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xa782ff82,0x00000f82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,
-0xff82a582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff83ff83,0xff83ff83,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x9f82ff82,0x00000382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc7820582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff85ff84,0xff86ff86,0xff88ff87,0xff89ff89,0xff8aff89,0xff8aff8a,0xff89ff8a,0xff88ff89,0xff86ff87,0xff83ff85,0xff82ff82,0x0782c582,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff828282,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff85ff84,0xff87ff86,0xff89ff88,0xff8aff89,0xff8bff8b,
-0xff8cff8b,0xff8bff8c,0xff8aff8b,0xff89ff8a,0xff86ff88,0xff83ff84,0x7a82ff82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x15820000,0xff82e982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,
-0xff87ff85,0xff89ff88,0xff8cff8b,0xff8eff8d,0xff8fff8e,0xff90ff90,0xff91ff91,0xff91ff91,0xff90ff91,0xff8fff90,0xff8cff8e,0xff87ff8a,0xeb82ff84,0x00000d82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01820000,0xf9826082,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0x6682f982,0x00000182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc7821782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff83ff83,0xff84ff83,0xff83ff84,0xff83ff83,0xff83ff83,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x1982cf82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x9b820182,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff84ff83,0xff85ff84,0xff86ff86,0xff87ff86,0xff87ff87,0xff86ff87,0xff86ff86,0xff84ff85,0xff83ff84,0xff82ff82,0xff82ff82,0x01829d82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff828682,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff84ff83,0xff87ff86,0xff89ff88,0xff8bff8a,0xff8cff8c,0xff8eff8d,0xff8eff8e,0xff8fff8f,0xff8eff8f,0xff8dff8e,0xff8bff8c,0xff88ff8a,0xff83ff86,0x8682ff82,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x27820000,0xff82fb82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff86ff85,0xff89ff88,0xff8bff8a,0xff8dff8c,0xff8fff8e,0xff90ff8f,
-0xff90ff90,0xff90ff90,0xff8fff90,0xff8eff8f,0xff8bff8d,0xff87ff89,0xf782ff84,0x00002b82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x80820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff88ff86,
-0xff8bff89,0xff8eff8c,0xff90ff8f,0xff92ff91,0xff93ff93,0xff95ff93,0xff95ff95,0xff95ff95,0xff95ff95,0xff93ff93,0xff91ff93,0xff8dff8f,0xff86ff8a,0x00008882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x99820382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x03828d82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x13820000,0xff82d382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff83ff83,0xff84ff84,0xff85ff85,0xff87ff86,0xff88ff87,0xff88ff88,0xff88ff88,0xff88ff88,0xff87ff87,0xff85ff86,0xff84ff84,0xff82ff83,0xff82ff82,0xff82ff82,0xd782ff82,0x00001582,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827482,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff84ff83,0xff87ff86,0xff88ff88,0xff8aff89,0xff8bff8a,0xff8cff8b,0xff8cff8c,0xff8cff8c,0xff8bff8c,0xff89ff8a,0xff87ff89,0xff84ff86,0xff82ff83,0x7482ff82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2b820000,0xff82fb82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff86ff84,0xff88ff87,0xff8bff8a,0xff8dff8c,0xff8fff8e,0xff91ff90,0xff92ff92,0xff93ff93,0xff93ff93,0xff93ff93,0xff92ff93,0xff91ff92,0xff8eff8f,0xff88ff8b,0xf982ff85,
-0x00003182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb4820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff88ff86,0xff8bff89,0xff8dff8c,0xff8fff8e,0xff91ff90,0xff93ff92,0xff93ff93,
-0xff95ff93,0xff95ff95,0xff93ff95,0xff93ff93,0xff90ff92,0xff8cff8f,0xff86ff89,0x0000ac82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf1820b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff88ff87,0xff8cff8a,
-0xff8fff8d,0xff92ff90,0xff93ff93,0xff96ff95,0xff98ff97,0xff99ff98,0xff9aff99,0xff9aff9a,0xff99ff9a,0xff98ff99,0xff96ff97,0xff92ff93,0xff8bff8f,0x1182f185,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01820000,0xff829b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff83ff83,0xff83ff83,0xff83ff83,0xff83ff83,0xff83ff83,0xff83ff83,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x8b82ff82,0x00000182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc1820582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff85ff84,
-0xff87ff86,0xff89ff88,0xff8bff8a,0xff8cff8b,0xff8dff8c,0xff8dff8d,0xff8eff8e,0xff8dff8d,0xff8dff8d,0xff8bff8c,0xff89ff8a,0xff86ff88,0xff84ff85,0xff82ff83,0xff82ff82,0x0782c982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x41820000,0xff82fb82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff86ff85,0xff89ff88,0xff8bff8a,0xff8dff8c,0xff8eff8e,0xff90ff8f,0xff91ff90,0xff91ff91,0xff91ff91,0xff90ff91,0xff8fff90,0xff8dff8e,0xff8aff8c,0xff85ff87,0xfb82ff83,0x00003d82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xac820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff87ff85,0xff8aff88,0xff8dff8b,0xff8fff8e,0xff92ff91,0xff93ff93,0xff95ff95,0xff97ff96,0xff98ff97,0xff98ff98,0xff98ff98,0xff97ff98,0xff96ff97,0xff93ff95,0xff8fff91,0xff87ff8b,
-0x0000aa82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfd823382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff88ff87,0xff8cff8a,0xff8fff8d,0xff91ff90,0xff93ff93,0xff95ff95,0xff97ff96,0xff98ff98,
-0xff99ff99,0xff99ff99,0xff99ff99,0xff97ff98,0xff96ff97,0xff92ff93,0xff8bff8f,0x3782fd85,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff826a82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff88ff86,0xff8cff8a,0xff90ff8e,
-0xff93ff91,0xff96ff93,0xff98ff97,0xff9aff99,0xff9cff9b,0xff9dff9d,0xff9eff9d,0xff9eff9e,0xff9eff9e,0xff9dff9d,0xff9aff9c,0xff97ff99,0xff91ff93,0x6886ff8b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x78820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff84ff84,0xff85ff84,0xff86ff86,0xff87ff87,0xff88ff87,0xff88ff88,0xff88ff88,0xff88ff88,0xff87ff87,0xff85ff86,0xff84ff85,0xff84ff84,
-0xff85ff84,0xff85ff85,0xff84ff84,0xff82ff83,0xff82ff82,0x00007482,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff828082,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff85ff84,0xff87ff86,0xff8aff89,
-0xff8cff8b,0xff8eff8d,0xff8fff8f,0xff91ff90,0xff92ff91,0xff93ff92,0xff93ff93,0xff93ff93,0xff92ff92,0xff91ff92,0xff90ff90,0xff8dff8e,0xff8aff8b,0xff87ff89,0xff83ff85,0x7a82ff82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd9820f82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff85ff84,0xff88ff86,0xff8bff89,0xff8dff8c,0xff90ff8f,0xff91ff91,0xff93ff92,0xff93ff93,0xff95ff95,0xff96ff96,0xff96ff96,0xff96ff96,0xff93ff95,0xff93ff93,0xff90ff91,0xff8bff8e,0xff84ff88,0x0b82d782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfb822982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff87ff85,0xff8bff89,0xff8eff8c,0xff91ff8f,0xff93ff92,0xff96ff95,0xff98ff97,0xff9aff99,0xff9bff9a,0xff9cff9b,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9aff9b,0xff98ff99,0xff93ff96,0xff8dff91,
-0x2d82fb87,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82a482,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff89ff87,0xff8cff8b,0xff90ff8e,0xff93ff91,0xff95ff93,0xff98ff97,0xff9aff99,0xff9bff9b,0xff9cff9c,
-0xff9dff9d,0xff9eff9e,0xff9dff9d,0xff9cff9d,0xff9aff9b,0xff97ff99,0xff91ff93,0xa285ff8c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82c682,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff88ff86,0xff8cff8a,0xff90ff8e,0xff93ff92,
-0xff97ff95,0xff9aff98,0xff9cff9b,0xff9eff9d,0xffa0ff9f,0xffa1ffa1,0xffa2ffa2,0xffa2ffa2,0xffa2ffa2,0xffa1ffa2,0xff9fffa0,0xff9cff9d,0xff96ff99,0xbc8aff91,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfb822f82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff84ff84,0xff86ff85,0xff87ff87,0xff89ff88,0xff8aff8a,0xff8cff8b,0xff8cff8c,0xff8dff8d,0xff8eff8e,0xff8eff8e,0xff8eff8e,0xff8dff8d,0xff8cff8d,0xff8aff8b,0xff8aff8a,
-0xff8bff8b,0xff8bff8b,0xff89ff8a,0xff86ff87,0xff82ff84,0x3582f982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x27820000,0xff82fd82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff87ff85,0xff8aff88,0xff8cff8b,0xff8fff8d,
-0xff91ff90,0xff93ff92,0xff93ff93,0xff96ff95,0xff97ff96,0xff97ff97,0xff98ff98,0xff98ff98,0xff98ff98,0xff97ff97,0xff95ff96,0xff93ff93,0xff91ff92,0xff8eff90,0xff89ff8c,0xf982ff86,0x00002982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff828082,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff86ff84,0xff89ff88,0xff8cff8b,0xff8fff8e,0xff92ff90,0xff93ff93,0xff96ff95,0xff97ff97,0xff99ff98,0xff9aff99,0xff9bff9a,0xff9bff9b,0xff9aff9b,0xff9aff9a,0xff98ff99,0xff95ff97,0xff91ff93,0xff8aff8e,0x7e82ff85,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff829282,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff87ff85,0xff8bff89,0xff8fff8d,0xff92ff90,0xff95ff93,0xff98ff96,0xff9aff99,0xff9cff9b,0xff9eff9d,0xff9fff9f,0xffa0ffa0,0xffa1ffa1,0xffa1ffa1,0xffa0ffa1,0xff9fffa0,0xff9dff9e,0xff99ff9b,0xff93ff97,
-0x9686ff8d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x13820000,0xff82f582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff88ff86,0xff8cff8a,0xff90ff8e,0xff93ff92,0xff97ff95,0xff99ff98,0xff9cff9b,0xff9eff9d,0xff9fff9f,0xffa1ffa0,
-0xffa1ffa1,0xffa2ffa2,0xffa1ffa2,0xffa0ffa1,0xff9fffa0,0xff9bff9d,0xff96ff99,0xf18bff92,0x00000b86,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x13820000,0xff82f982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff87ff85,0xff8bff89,0xff90ff8e,0xff93ff92,0xff97ff96,
-0xff9aff99,0xff9dff9c,0xffa0ff9f,0xffa2ffa1,0xffa4ffa3,0xffa5ffa5,0xffa6ffa6,0xffa6ffa6,0xffa6ffa6,0xffa5ffa6,0xffa3ffa4,0xffa0ffa2,0xff9bff9e,0xfb8fff96,0x0000118a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff82cb82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff85ff85,0xff85ff85,0xff86ff85,0xff87ff87,0xff89ff88,0xff8bff8a,0xff8cff8c,0xff8eff8d,0xff90ff8f,0xff91ff90,0xff92ff91,0xff93ff92,0xff93ff93,0xff93ff93,0xff93ff93,0xff93ff93,0xff92ff92,0xff90ff91,0xff91ff90,
-0xff92ff91,0xff91ff92,0xff90ff91,0xff8dff8e,0xff87ff8a,0xc782ff84,0x00000382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb0820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff85ff84,0xff88ff87,0xff8bff8a,0xff8eff8d,0xff91ff8f,0xff93ff92,
-0xff95ff93,0xff97ff96,0xff99ff98,0xff9aff9a,0xff9bff9b,0xff9cff9c,0xff9dff9c,0xff9dff9d,0xff9dff9d,0xff9cff9c,0xff9bff9c,0xff99ff9a,0xff97ff98,0xff95ff97,0xff91ff93,0xff88ff8d,0x0000a483,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x11820000,0xff82f382,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff86ff84,0xff8aff88,0xff8dff8c,0xff90ff8f,0xff93ff92,0xff96ff95,0xff98ff97,0xff9aff99,0xff9cff9b,0xff9dff9d,0xff9eff9e,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9dff9e,0xff9bff9c,0xff97ff99,0xff91ff95,0xef85ff8c,0x00001582,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff82eb82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff84,0xff8bff89,0xff8fff8d,0xff92ff91,0xff96ff93,0xff99ff97,0xff9cff9a,0xff9eff9d,0xffa0ff9f,0xffa2ffa1,0xffa3ffa3,0xffa4ffa4,0xffa5ffa5,0xffa5ffa5,0xffa5ffa5,0xffa4ffa4,0xffa2ffa3,0xff9effa0,0xff98ff9c,
-0xe38dff93,0x00000386,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x54820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff87ff85,0xff8cff8a,0xff90ff8e,0xff93ff92,0xff97ff96,0xff9aff99,0xff9dff9c,0xffa0ff9e,0xffa2ffa1,0xffa3ffa3,0xffa5ffa4,
-0xffa5ffa5,0xffa6ffa6,0xffa6ffa6,0xffa5ffa5,0xffa3ffa4,0xffa0ffa2,0xff9bff9e,0xff91ff97,0x0000528b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x54820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff8aff88,0xff8fff8d,0xff93ff91,0xff97ff95,0xff9bff99,
-0xff9eff9d,0xffa1ffa0,0xffa4ffa2,0xffa6ffa5,0xffa8ffa7,0xffa9ffa8,0xffaaffa9,0xffaaffaa,0xffaaffaa,0xffa9ffa9,0xffa7ffa8,0xffa4ffa6,0xff9fffa2,0xff95ff9b,0x00004c8e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x58820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff8aff88,0xff8aff8b,0xff8aff8a,0xff8bff8b,0xff8dff8c,0xff8eff8d,0xff90ff8f,0xff91ff90,0xff93ff92,0xff95ff93,0xff96ff95,0xff97ff96,0xff98ff97,0xff98ff98,0xff99ff99,0xff99ff99,0xff98ff99,0xff98ff98,0xff96ff97,0xff97ff96,
-0xff98ff97,0xff98ff98,0xff96ff97,0xff93ff95,0xff8fff92,0xff85ff8b,0x00005082,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfb821b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff87ff85,0xff8aff88,0xff8dff8b,0xff90ff8e,0xff93ff91,0xff95ff93,0xff97ff96,
-0xff9aff98,0xff9cff9b,0xff9dff9c,0xff9fff9e,0xffa0ff9f,0xffa1ffa0,0xffa1ffa1,0xffa2ffa2,0xffa2ffa2,0xffa1ffa2,0xffa0ffa1,0xff9fffa0,0xff9dff9e,0xff9bff9d,0xff97ff9a,0xff90ff93,0x2183fd88,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x74820000,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff86ff84,0xff8aff88,0xff8eff8c,0xff91ff90,0xff95ff93,0xff97ff96,0xff9aff99,0xff9cff9b,0xff9eff9d,0xffa0ff9f,0xffa2ffa1,0xffa3ffa2,0xffa4ffa3,0xffa4ffa4,0xffa4ffa4,0xffa3ffa4,0xffa2ffa3,0xffa0ffa1,0xff9dff9f,0xff97ff9b,0xff8cff93,0x00007a85,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x34820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff8aff88,0xff8fff8c,0xff93ff91,0xff96ff93,0xff9aff98,0xff9dff9b,0xffa0ff9e,0xffa2ffa1,0xffa4ffa3,0xffa6ffa5,0xffa7ffa7,0xffa8ffa8,0xffa9ffa9,0xffa9ffa9,0xffa9ffa9,0xffa8ffa9,0xffa6ffa7,0xffa3ffa5,0xff9dffa1,
-0xff91ff99,0x0000348b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x98820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff84,0xff8bff89,0xff90ff8d,0xff93ff92,0xff98ff96,0xff9bff99,0xff9eff9d,0xffa1ffa0,0xffa3ffa2,0xffa6ffa5,0xffa7ffa6,0xffa9ffa8,
-0xffa9ffa9,0xffaaffaa,0xffaaffaa,0xffa9ffa9,0xffa7ffa8,0xffa4ffa6,0xff9fffa2,0xff97ff9c,0x0000908f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x80820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff89ff86,0xff8eff8b,0xff93ff90,0xff97ff95,0xff9bff99,0xff9fff9d,
-0xffa2ffa0,0xffa5ffa3,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xffadffac,0xffaeffad,0xffaeffae,0xffaeffae,0xffadffad,0xffabffac,0xffa8ffaa,0xffa3ffa6,0xff9affa0,0x00007e93,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc7820182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8aff87,0xff8fff8d,0xff8fff90,0xff8fff8f,0xff90ff90,0xff91ff91,0xff93ff92,0xff95ff93,0xff96ff95,0xff98ff97,0xff99ff99,0xff9bff9a,0xff9cff9b,0xff9dff9d,0xff9dff9d,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9dff9e,0xff9cff9d,0xff9cff9c,
-0xff9eff9d,0xff9eff9e,0xff9dff9d,0xff9aff9b,0xff95ff98,0xff8cff92,0x0000c685,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827a82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff85ff84,0xff88ff86,0xff8bff89,0xff8eff8d,0xff91ff90,0xff93ff93,0xff97ff96,0xff99ff98,0xff9cff9b,
-0xff9eff9d,0xffa0ff9f,0xffa1ffa1,0xffa3ffa2,0xffa4ffa4,0xffa5ffa5,0xffa6ffa6,0xffa7ffa6,0xffa7ffa7,0xffa6ffa7,0xffa6ffa6,0xffa5ffa5,0xffa3ffa4,0xffa1ffa2,0xff9effa0,0xff96ff9b,0x7a88ff90,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc6820000,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff84,0xff8aff88,0xff8eff8c,0xff92ff90,0xff95ff93,0xff99ff97,0xff9cff9a,0xff9eff9d,0xffa0ff9f,0xffa3ffa1,0xffa4ffa3,0xffa6ffa5,0xffa7ffa6,0xffa8ffa8,0xffa8ffa8,0xffa8ffa8,0xffa8ffa8,0xffa7ffa8,0xffa5ffa6,0xffa2ffa4,0xff9dffa0,0xff93ff99,0x0000d08b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x68820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff89ff86,0xff8eff8b,0xff92ff90,0xff96ff93,0xff9aff98,0xff9dff9c,0xffa0ff9f,0xffa3ffa2,0xffa6ffa5,0xffa8ffa7,0xffaaffa9,0xffabffab,0xffacffac,0xffadffad,0xffadffad,0xffadffad,0xffacffad,0xffaaffab,0xffa7ffa9,0xffa2ffa5,
-0xff98ff9e,0x00006c91,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xcc820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8aff87,0xff8fff8c,0xff93ff91,0xff97ff96,0xff9bff99,0xff9fff9d,0xffa2ffa0,0xffa5ffa3,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xffacffac,
-0xffadffad,0xffaeffae,0xffaeffae,0xffadffad,0xffabffac,0xffa8ffaa,0xffa4ffa6,0xff9cffa1,0x0000c293,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xa4820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff84,0xff8cff89,0xff91ff8f,0xff96ff93,0xff9aff98,0xff9eff9c,0xffa2ffa0,
-0xffa5ffa4,0xffa8ffa7,0xffabffaa,0xffadffac,0xffafffae,0xffb0ffb0,0xffb1ffb1,0xffb2ffb2,0xffb2ffb2,0xffb1ffb1,0xffafffb0,0xffacffae,0xffa7ffaa,0xff9effa4,0x0000a097,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff822c82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff88ff85,0xff8fff8c,0xff93ff92,0xff93ff95,0xff93ff93,0xff95ff93,0xff96ff96,0xff98ff97,0xff99ff99,0xff9bff9a,0xff9dff9c,0xff9eff9d,0xff9fff9f,0xffa1ffa0,0xffa2ffa1,0xffa3ffa2,0xffa3ffa3,0xffa3ffa3,0xffa3ffa3,0xffa2ffa3,0xffa1ffa2,0xffa2ffa1,
-0xffa3ffa3,0xffa3ffa4,0xffa2ffa3,0xffa0ffa1,0xff9cff9e,0xff93ff98,0x2186fd8c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82c682,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff84,0xff89ff88,0xff8cff8b,0xff8fff8e,0xff92ff91,0xff95ff93,0xff98ff97,0xff9bff9a,0xff9dff9c,0xffa0ff9f,
-0xffa2ffa1,0xffa4ffa3,0xffa6ffa5,0xffa7ffa7,0xffa9ffa8,0xffaaffa9,0xffabffaa,0xffabffab,0xffabffab,0xffabffab,0xffabffab,0xffaaffaa,0xffa9ffa9,0xffa7ffa8,0xffa3ffa5,0xff9dffa1,0xc28eff97,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfd821582,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff85ff83,0xff8aff87,0xff8eff8c,0xff92ff90,0xff96ff93,0xff99ff98,0xff9dff9b,0xff9fff9e,0xffa2ffa1,0xffa4ffa3,0xffa6ffa5,0xffa8ffa7,0xffaaffa9,0xffabffaa,0xffacffac,0xffadffac,0xffadffad,0xffacffad,0xffacffac,0xffaaffab,0xffa7ffa9,0xffa3ffa5,0xff9aff9f,0x198bfb93,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x9a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff84,0xff8dff8a,0xff91ff8f,0xff96ff93,0xff9aff98,0xff9eff9c,0xffa1ff9f,0xffa4ffa3,0xffa7ffa6,0xffa9ffa8,0xffacffab,0xffaeffad,0xffafffae,0xffb0ffb0,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffb0ffb1,0xffafffaf,0xffacffad,0xffa7ffa9,
-0xff9dffa3,0x00009496,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xeb820382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff85,0xff8dff8a,0xff92ff90,0xff97ff95,0xff9bff99,0xff9fff9d,0xffa2ffa1,0xffa5ffa4,0xffa8ffa7,0xffabffa9,0xffadffac,0xffafffae,0xffb0ffaf,
-0xffb1ffb1,0xffb1ffb1,0xffb2ffb2,0xffb1ffb1,0xffafffb0,0xffacffae,0xffa8ffab,0xffa0ffa5,0x0590f598,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb6820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8aff87,0xff8fff8d,0xff95ff92,0xff99ff97,0xff9eff9c,0xffa2ffa0,0xffa5ffa4,
-0xffa9ffa7,0xffacffaa,0xffaeffad,0xffb1ffaf,0xffb2ffb2,0xffb4ffb3,0xffb5ffb5,0xffb5ffb5,0xffb5ffb5,0xffb4ffb5,0xffb3ffb4,0xffb0ffb1,0xffabffae,0xffa2ffa7,0x0000ca9a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff826682,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8dff8a,0xff93ff91,0xff99ff97,0xff99ff9a,0xff99ff99,0xff99ff99,0xff9bff9a,0xff9cff9b,0xff9eff9d,0xffa0ff9f,0xffa1ffa0,0xffa3ffa2,0xffa4ffa3,0xffa5ffa5,0xffa7ffa6,0xffa7ffa7,0xffa8ffa8,0xffa8ffa8,0xffa8ffa8,0xffa8ffa8,0xffa7ffa7,0xffa8ffa7,
-0xffa9ffa8,0xffa9ffa9,0xffa8ffa9,0xffa6ffa7,0xffa2ffa4,0xff9aff9e,0x648cff93,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff82f382,0xff82ff82,0xff82ff82,0xff85ff82,0xff8bff89,0xff8eff8d,0xff91ff8f,0xff93ff92,0xff97ff95,0xff9aff98,0xff9cff9b,0xff9fff9d,0xffa2ffa0,0xffa4ffa3,
-0xffa6ffa5,0xffa8ffa7,0xffaaffa9,0xffacffab,0xffadffac,0xffaeffae,0xffafffaf,0xffafffaf,0xffb0ffb0,0xffb0ffb0,0xffb0ffb0,0xffafffaf,0xffaeffaf,0xffacffae,0xffa9ffab,0xffa3ffa6,0xf395ff9d,0x0000038e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff824282,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff84ff82,0xff89ff86,0xff8dff8b,0xff92ff90,0xff96ff93,0xff9aff98,0xff9dff9c,0xffa0ff9f,0xffa3ffa2,0xffa6ffa5,0xffa8ffa7,0xffaaffa9,0xffacffab,0xffaeffad,0xffafffaf,0xffb0ffb0,0xffb1ffb0,0xffb1ffb1,0xffb1ffb1,0xffb0ffb0,0xffafffaf,0xffacffad,0xffa8ffaa,0xffa0ffa5,0x4291ff99,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb2820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8aff87,0xff90ff8d,0xff95ff92,0xff99ff97,0xff9dff9b,0xffa1ff9f,0xffa5ffa3,0xffa8ffa6,0xffabffa9,0xffadffac,0xffafffae,0xffb1ffb0,0xffb3ffb2,0xffb4ffb4,0xffb5ffb5,0xffb5ffb5,0xffb5ffb5,0xffb4ffb5,0xffb2ffb3,0xffb0ffb1,0xffabffad,
-0xffa1ffa7,0x0000b29a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff820e82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8bff88,0xff90ff8e,0xff95ff93,0xff9aff98,0xff9eff9c,0xffa2ffa0,0xffa6ffa4,0xffa9ffa7,0xffacffaa,0xffaeffad,0xffb0ffb0,0xffb2ffb1,0xffb4ffb3,
-0xffb5ffb4,0xffb5ffb5,0xffb5ffb5,0xffb4ffb5,0xffb3ffb4,0xffb0ffb2,0xffacffae,0xffa4ffa9,0x0e95ff9b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc8820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff83,0xff8dff8a,0xff92ff90,0xff98ff95,0xff9dff9a,0xffa1ff9f,0xffa5ffa3,0xffa9ffa7,
-0xffacffab,0xffafffae,0xffb2ffb0,0xffb4ffb3,0xffb6ffb5,0xffb7ffb7,0xffb8ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb8,0xffb6ffb7,0xffb3ffb5,0xffaeffb1,0xffa6ffab,0x0000c89e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82a282,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff87,0xff92ff8e,0xff99ff95,0xff9eff9c,0xff9eff9f,0xff9dff9e,0xff9eff9e,0xff9fff9f,0xffa1ffa0,0xffa2ffa1,0xffa4ffa3,0xffa6ffa5,0xffa7ffa6,0xffa9ffa8,0xffaaffa9,0xffabffaa,0xffacffab,0xffadffac,0xffadffad,0xffadffad,0xffadffad,0xffacffac,0xffadffac,
-0xffaeffad,0xffaeffae,0xffadffae,0xffabffac,0xffa7ffaa,0xffa0ffa4,0x9891ff9a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x14820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff85,0xff90ff8d,0xff92ff91,0xff95ff93,0xff98ff96,0xff9bff99,0xff9dff9c,0xffa0ff9f,0xffa3ffa1,0xffa6ffa4,0xffa8ffa7,
-0xffaaffa9,0xffacffab,0xffaeffad,0xffb0ffaf,0xffb1ffb0,0xffb2ffb2,0xffb3ffb3,0xffb4ffb3,0xffb4ffb4,0xffb4ffb4,0xffb4ffb4,0xffb4ffb4,0xffb3ffb4,0xffb2ffb3,0xffaeffb0,0xffa8ffac,0xff9affa3,0x00001493,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff826c82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff87ff84,0xff8cff8a,0xff91ff8f,0xff96ff93,0xff9aff98,0xff9dff9b,0xffa1ff9f,0xffa4ffa2,0xffa7ffa6,0xffaaffa8,0xffacffab,0xffaeffad,0xffb0ffaf,0xffb2ffb1,0xffb3ffb2,0xffb4ffb4,0xffb5ffb4,0xffb5ffb5,0xffb5ffb5,0xffb4ffb4,0xffb3ffb4,0xffb1ffb2,0xffacffaf,0xffa6ffaa,0x6e97ff9f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc2820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff8eff8b,0xff93ff91,0xff98ff96,0xff9dff9a,0xffa1ff9f,0xffa5ffa3,0xffa8ffa6,0xffabffaa,0xffaeffad,0xffb1ffaf,0xffb3ffb2,0xffb5ffb4,0xffb7ffb6,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb6ffb7,0xffb3ffb5,0xffafffb1,
-0xffa5ffab,0x0000ca9d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff821682,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff85,0xff8eff8b,0xff93ff91,0xff99ff96,0xff9dff9b,0xffa2ffa0,0xffa5ffa4,0xffa9ffa7,0xffacffab,0xffafffae,0xffb2ffb1,0xffb4ffb3,0xffb6ffb5,0xffb7ffb7,
-0xffb8ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb8,0xffb6ffb7,0xffb4ffb5,0xffb0ffb2,0xffa8ffac,0x1299ff9f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd0820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff89ff86,0xff90ff8d,0xff96ff93,0xff9bff98,0xffa0ff9d,0xffa4ffa2,0xffa8ffa6,0xffacffaa,
-0xffafffae,0xffb2ffb1,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbcffbb,0xffbcffbc,0xffbcffbc,0xffbbffbc,0xffb9ffbb,0xffb7ffb8,0xffb2ffb4,0xffa8ffae,0x0000d09f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82bc82,0xff82ff82,0xff82ff82,0xff87ff83,0xff8fff8b,0xff97ff93,0xff9dff9a,0xffa3ffa0,0xffa3ffa4,0xffa2ffa2,0xffa3ffa2,0xffa4ffa3,0xffa5ffa4,0xffa7ffa6,0xffa8ffa8,0xffaaffa9,0xffabffab,0xffadffac,0xffaeffae,0xffafffaf,0xffb0ffb0,0xffb1ffb1,0xffb2ffb1,0xffb2ffb2,0xffb2ffb2,0xffb1ffb1,0xffb2ffb1,
-0xffb3ffb3,0xffb3ffb3,0xffb3ffb3,0xffb0ffb2,0xffadffaf,0xffa6ffaa,0xb897ff9f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x26820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff89,0xff93ff91,0xff96ff95,0xff99ff97,0xff9bff9a,0xff9eff9d,0xffa1ffa0,0xffa4ffa3,0xffa7ffa5,0xffa9ffa8,0xffacffab,
-0xffaeffad,0xffb0ffaf,0xffb2ffb1,0xffb4ffb3,0xffb5ffb4,0xffb6ffb6,0xffb7ffb7,0xffb8ffb8,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb7ffb8,0xffb3ffb5,0xffadffb1,0xff9fffa8,0x00002696,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827882,0xff82ff82,0xff82ff82,
-0xff84ff82,0xff8aff87,0xff90ff8d,0xff95ff92,0xff99ff97,0xff9dff9b,0xffa1ff9f,0xffa4ffa3,0xffa8ffa6,0xffabffa9,0xffadffac,0xffb0ffae,0xffb2ffb1,0xffb4ffb3,0xffb5ffb5,0xffb7ffb6,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb7ffb8,0xffb5ffb6,0xffb1ffb3,0xffaaffae,0x829bffa3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd4820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff8bff87,0xff91ff8e,0xff96ff93,0xff9bff99,0xffa0ff9e,0xffa4ffa2,0xffa8ffa6,0xffabffaa,0xffafffad,0xffb1ffb0,0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffbbffbb,0xffbcffbc,0xffbdffbc,0xffbcffbd,0xffbcffbc,0xffb9ffbb,0xffb7ffb9,0xffb2ffb5,
-0xffa7ffad,0x0000d09c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff821a82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8bff87,0xff91ff8e,0xff97ff93,0xff9cff99,0xffa1ff9e,0xffa5ffa3,0xffa9ffa7,0xffacffab,0xffb0ffae,0xffb3ffb1,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,
-0xffbcffbb,0xffbcffbc,0xffbcffbc,0xffbbffbc,0xffb9ffbb,0xffb7ffb9,0xffb3ffb5,0xffaaffaf,0x2297ffa0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xe2820000,0xff82ff82,0xff82ff82,0xff85ff82,0xff8cff89,0xff93ff90,0xff98ff96,0xff9eff9b,0xffa3ffa0,0xffa7ffa5,0xffabffa9,0xffafffad,
-0xffb3ffb1,0xffb6ffb4,0xffb8ffb7,0xffbbffb9,0xffbdffbc,0xffbeffbd,0xffbfffbf,0xffc0ffbf,0xffbfffc0,0xffbeffbf,0xffbdffbe,0xffb9ffbb,0xffb3ffb7,0xffa7ffae,0x0000e29d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82d282,0xff82ff82,0xff83ff82,0xff8bff86,0xff93ff8f,0xff9bff97,0xffa2ff9e,0xffa7ffa5,0xffa7ffa8,0xffa6ffa6,0xffa7ffa6,0xffa8ffa7,0xffa9ffa8,0xffabffaa,0xffadffac,0xffaeffad,0xffb0ffaf,0xffb1ffb0,0xffb2ffb2,0xffb4ffb3,0xffb5ffb4,0xffb5ffb5,0xffb6ffb6,0xffb6ffb6,0xffb6ffb6,0xffb6ffb6,0xffb7ffb6,
-0xffb8ffb8,0xffb8ffb8,0xffb7ffb8,0xffb5ffb7,0xffb2ffb4,0xffabffaf,0xd89bffa4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30820000,0xff82ff82,0xff82ff82,0xff88ff83,0xff91ff8d,0xff98ff95,0xff9aff99,0xff9cff9b,0xff9fff9e,0xffa2ffa1,0xffa5ffa4,0xffa8ffa6,0xffaaffa9,0xffadffac,0xffafffae,
-0xffb2ffb1,0xffb4ffb3,0xffb6ffb5,0xffb7ffb7,0xffb9ffb8,0xffb9ffb9,0xffbbffbb,0xffbcffbc,0xffbdffbc,0xffbdffbd,0xffbdffbd,0xffbdffbd,0xffbdffbd,0xffbbffbc,0xffb7ffb9,0xffafffb4,0xff9fffa9,0x00003495,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff829482,0xff82ff82,0xff82ff82,
-0xff88ff84,0xff8eff8b,0xff93ff91,0xff98ff96,0xff9cff9a,0xffa1ff9f,0xffa4ffa2,0xffa8ffa6,0xffabffaa,0xffaeffad,0xffb1ffaf,0xffb3ffb2,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbcffbb,0xffbcffbc,0xffbdffbd,0xffbdffbd,0xffbcffbd,0xffbbffbc,0xffb9ffb9,0xffb4ffb7,0xffabffb1,0x8e98ffa3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xef820582,0xff82ff82,0xff82ff82,0xff87ff83,0xff8eff8a,0xff93ff91,0xff9aff97,0xff9eff9c,0xffa3ffa1,0xffa7ffa5,0xffabffa9,0xffafffad,0xffb2ffb0,0xffb5ffb3,0xffb7ffb6,0xffb9ffb9,0xffbcffbb,0xffbdffbd,0xffbfffbe,0xffbfffbf,0xffc0ffc0,0xffc0ffc0,0xffbfffc0,0xffbdffbe,0xffb9ffbc,0xffb3ffb7,
-0xffa5ffad,0x0190f19a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff823882,0xff82ff82,0xff82ff82,0xff87ff83,0xff8eff8a,0xff93ff91,0xff9aff97,0xff9fff9c,0xffa4ffa1,0xffa8ffa6,0xffacffaa,0xffb0ffae,0xffb3ffb1,0xffb6ffb4,0xffb8ffb7,0xffbbffb9,0xffbdffbc,0xffbeffbd,
-0xffbfffbf,0xffc0ffbf,0xffc0ffc0,0xffbfffbf,0xffbdffbe,0xffb9ffbc,0xffb4ffb8,0xffa9ffaf,0x3097ffa0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xed820182,0xff82ff82,0xff82ff82,0xff87ff83,0xff8fff8b,0xff95ff92,0xff9bff98,0xffa1ff9e,0xffa6ffa3,0xffaaffa8,0xffaeffac,0xffb2ffb0,
-0xffb6ffb4,0xffb9ffb7,0xffbbffb9,0xffbeffbd,0xffc0ffbf,0xffc1ffc1,0xffc2ffc2,0xffc3ffc3,0xffc3ffc3,0xffc2ffc2,0xffc0ffc1,0xffbbffbe,0xffb3ffb7,0xffa7ffae,0x0000f29d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82d682,0xff82ff82,0xff85ff82,0xff8fff8a,0xff97ff93,0xff9fff9b,0xffa6ffa2,0xffacffa9,0xffabffac,0xffaaffaa,0xffabffaa,0xffacffab,0xffadffac,0xffafffae,0xffb1ffb0,0xffb2ffb1,0xffb4ffb3,0xffb5ffb4,0xffb7ffb6,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffbbffbb,0xffbbffbb,0xffb9ffbb,0xffbcffbb,
-0xffbdffbc,0xffbdffbd,0xffbcffbd,0xffb9ffbb,0xffb6ffb8,0xffadffb2,0xde9cffa6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x5a820000,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8f,0xff9cff99,0xff9eff9d,0xffa0ff9f,0xffa3ffa1,0xffa6ffa4,0xffa9ffa7,0xffabffaa,0xffaeffad,0xffb0ffaf,0xffb3ffb2,
-0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbeffbd,0xffbfffbf,0xffc0ffc0,0xffc1ffc0,0xffc1ffc1,0xffc1ffc1,0xffc1ffc1,0xffc1ffc2,0xffbeffc0,0xffb8ffbb,0xffadffb3,0xff9cffa6,0x00004e92,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82b682,0xff82ff82,0xff83ff82,
-0xff8bff86,0xff91ff8e,0xff96ff93,0xff9bff99,0xffa0ff9e,0xffa4ffa2,0xffa8ffa6,0xffabffaa,0xffaeffad,0xffb1ffb0,0xffb4ffb3,0xffb7ffb5,0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbeffbd,0xffbfffbf,0xffc0ffc0,0xffc0ffc0,0xffc1ffc1,0xffc0ffc0,0xffbfffbf,0xffbbffbd,0xffb4ffb8,0xffa9ffaf,0xc093ffa0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff821882,0xff82ff82,0xff82ff82,0xff88ff84,0xff90ff8c,0xff97ff93,0xff9cff9a,0xffa1ff9f,0xffa6ffa4,0xffaaffa8,0xffaeffac,0xffb2ffb0,0xffb5ffb4,0xffb8ffb7,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffc1ffc0,0xffc2ffc1,0xffc3ffc2,0xffc3ffc3,0xffc3ffc3,0xffc2ffc3,0xffc0ffc1,0xffb9ffbd,0xffb1ffb6,
-0xffa4ffac,0x0e91ff99,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff825082,0xff82ff82,0xff82ff82,0xff89ff84,0xff91ff8d,0xff97ff93,0xff9dff9a,0xffa2ff9f,0xffa7ffa4,0xffabffa9,0xffafffad,0xffb3ffb1,0xffb6ffb4,0xffb9ffb8,0xffbcffb9,0xffbeffbd,0xffc0ffbf,0xffc1ffc1,
-0xffc2ffc2,0xffc3ffc3,0xffc3ffc3,0xffc2ffc3,0xffc0ffc1,0xffbcffbe,0xffb4ffb8,0xffa9ffaf,0x5496ff9f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff820c82,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff98ff95,0xff9eff9b,0xffa3ffa1,0xffa8ffa6,0xffadffab,0xffb1ffaf,0xffb5ffb3,
-0xffb9ffb7,0xffbcffb9,0xffbfffbd,0xffc1ffc0,0xffc3ffc2,0xffc4ffc4,0xffc5ffc5,0xffc6ffc6,0xffc6ffc6,0xffc4ffc5,0xffc1ffc3,0xffb9ffbe,0xffb2ffb7,0xffa7ffad,0x0d95fd9d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82f082,0xff82ff82,0xff87ff83,0xff92ff8c,0xff9bff97,0xffa3ff9f,0xffaaffa6,0xffb0ffad,0xffafffb0,0xffaeffae,0xffafffae,0xffafffaf,0xffb1ffb0,0xffb2ffb2,0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffb9ffb8,0xffbbffb9,0xffbcffbb,0xffbdffbc,0xffbeffbd,0xffbeffbe,0xffbfffbf,0xffbfffbf,0xffbfffbf,0xffc0ffbf,
-0xffc1ffc1,0xffc1ffc1,0xffc0ffc1,0xffbcffbe,0xffb6ffb9,0xffabffb1,0xee98ffa3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x82820000,0xff82ff82,0xff82ff82,0xff88ff83,0xff93ff8e,0xff9eff9a,0xffa1ff9f,0xffa4ffa2,0xffa6ffa5,0xffa9ffa7,0xffacffaa,0xffafffad,0xffb1ffb0,0xffb4ffb3,0xffb6ffb5,
-0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffc0ffbf,0xffc2ffc1,0xffc3ffc2,0xffc4ffc3,0xffc4ffc4,0xffc5ffc5,0xffc5ffc5,0xffc4ffc5,0xffc1ffc3,0xffbcffbf,0xffb4ffb8,0xffaaffb0,0xff9affa4,0x00008290,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff82ed82,0xff82ff82,0xff83ff82,
-0xff8bff86,0xff93ff90,0xff9aff97,0xff9eff9c,0xffa3ffa1,0xffa7ffa5,0xffabffa9,0xffaeffad,0xffb2ffb0,0xffb5ffb3,0xffb7ffb6,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffc0ffbf,0xffc2ffc1,0xffc3ffc2,0xffc4ffc3,0xffc4ffc4,0xffc4ffc4,0xffc3ffc4,0xffc0ffc2,0xffb9ffbe,0xffb2ffb7,0xffa7ffad,0xed93ff9f,0x0000038a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff823882,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff99ff96,0xff9fff9c,0xffa4ffa2,0xffa9ffa7,0xffadffab,0xffb1ffaf,0xffb5ffb3,0xffb8ffb7,0xffbbffb9,0xffbeffbc,0xffc0ffbf,0xffc2ffc1,0xffc4ffc3,0xffc5ffc5,0xffc6ffc6,0xffc7ffc6,0xffc6ffc7,0xffc4ffc6,0xffc0ffc3,0xffb9ffbd,0xffb1ffb5,
-0xffa4ffab,0x4890ff9a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff826a82,0xff82ff82,0xff82ff82,0xff89ff84,0xff92ff8e,0xff9aff96,0xff9fff9c,0xffa5ffa2,0xffaaffa7,0xffaeffac,0xffb2ffb0,0xffb6ffb4,0xffb9ffb7,0xffbcffbb,0xffbfffbd,0xffc1ffc0,0xffc3ffc2,0xffc4ffc4,
-0xffc5ffc5,0xffc6ffc6,0xffc6ffc6,0xffc5ffc6,0xffc1ffc3,0xffbbffbe,0xffb3ffb8,0xffa8ffae,0x6c96ffa0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff822282,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9aff96,0xffa1ff9d,0xffa6ffa3,0xffabffa9,0xffb0ffae,0xffb4ffb2,0xffb8ffb6,
-0xffbcffb9,0xffbfffbd,0xffc2ffc0,0xffc4ffc3,0xffc6ffc5,0xffc7ffc7,0xffc8ffc8,0xffc9ffc9,0xffc8ffc9,0xffc5ffc7,0xffc0ffc3,0xffb9ffbd,0xffb2ffb7,0xffa7ffad,0x2695ff9d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x17820000,0xff82fd82,0xff82ff82,0xff85ff82,0xff91ff8b,0xff9cff97,0xffa6ffa1,0xffadffaa,0xffb4ffb1,0xffb3ffb4,0xffb2ffb2,0xffb2ffb2,0xffb3ffb3,0xffb5ffb4,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffbdffbc,0xffbeffbe,0xffc0ffbf,0xffc1ffc0,0xffc2ffc1,0xffc2ffc2,0xffc3ffc3,0xffc3ffc3,0xffc3ffc3,0xffc4ffc3,
-0xffc5ffc5,0xffc3ffc4,0xffc0ffc2,0xffb9ffbd,0xffb2ffb7,0xffa8ffae,0xff96ffa1,0x0000198c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb8820000,0xff82ff82,0xff82ff82,0xff86ff82,0xff93ff8c,0xff9dff98,0xffa2ffa0,0xffa6ffa4,0xffa9ffa8,0xffacffab,0xffafffae,0xffb2ffb0,0xffb5ffb3,0xffb7ffb6,0xffb9ffb8,
-0xffbcffbb,0xffbeffbd,0xffc0ffbf,0xffc2ffc1,0xffc4ffc3,0xffc5ffc4,0xffc6ffc6,0xffc7ffc7,0xffc8ffc8,0xffc8ffc8,0xffc7ffc7,0xffc3ffc5,0xffbeffc1,0xffb8ffbb,0xffb2ffb5,0xffa8ffad,0xff9affa2,0x0000c48f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3a820000,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff8bff86,0xff93ff90,0xff9cff98,0xffa1ff9f,0xffa6ffa4,0xffaaffa8,0xffaeffac,0xffb1ffb0,0xffb5ffb3,0xffb8ffb6,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffc2ffc1,0xffc3ffc3,0xffc5ffc4,0xffc6ffc5,0xffc7ffc7,0xffc7ffc7,0xffc7ffc7,0xffc4ffc6,0xffbfffc2,0xffb9ffbc,0xffb0ffb5,0xffa5ffab,0xff93ff9e,0x00003c8a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827482,0xff82ff82,0xff82ff82,0xff88ff84,0xff92ff8d,0xff9bff97,0xffa2ff9e,0xffa7ffa5,0xffacffaa,0xffb0ffae,0xffb4ffb2,0xffb8ffb6,0xffbbffb9,0xffbeffbd,0xffc1ffc0,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc8ffc8,0xffc9ffc9,0xffcaffc9,0xffc8ffc9,0xffc4ffc7,0xffbfffc2,0xffb8ffbc,0xffb0ffb5,
-0xffa5ffab,0x7491ff9b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff828e82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9bff97,0xffa2ff9f,0xffa7ffa5,0xffacffaa,0xffb1ffaf,0xffb5ffb3,0xffb9ffb7,0xffbcffb9,0xffbfffbd,0xffc2ffc0,0xffc4ffc3,0xffc6ffc5,0xffc7ffc7,
-0xffc8ffc8,0xffc9ffc9,0xffc8ffc9,0xffc6ffc7,0xffc1ffc3,0xffbbffbe,0xffb3ffb7,0xffa8ffae,0x8a97ffa0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff824682,0xff82ff82,0xff82ff82,0xff88ff83,0xff91ff8d,0xff9aff96,0xffa2ff9e,0xffa8ffa5,0xffaeffab,0xffb2ffb0,0xffb7ffb5,0xffbbffb9,
-0xffbeffbd,0xffc2ffc0,0xffc4ffc3,0xffc7ffc6,0xffc9ffc8,0xffcaffc9,0xffcbffcb,0xffcbffcb,0xffc9ffca,0xffc5ffc7,0xffc0ffc2,0xffb9ffbd,0xffb2ffb7,0xffa7ffae,0x4896ff9e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x48820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff89,0xff9aff95,0xffa5ffa0,0xffafffaa,0xffb6ffb3,0xffb6ffb7,0xffb5ffb6,0xffb6ffb6,0xffb7ffb6,0xffb8ffb7,0xffb9ffb9,0xffbbffbb,0xffbdffbc,0xffbfffbe,0xffc0ffc0,0xffc2ffc1,0xffc3ffc3,0xffc4ffc4,0xffc5ffc5,0xffc6ffc6,0xffc7ffc7,0xffc7ffc7,0xffc6ffc7,0xffc6ffc5,
-0xffc4ffc5,0xffc1ffc3,0xffbdffbf,0xffb7ffb9,0xffb0ffb4,0xffa6ffab,0xff96ffa0,0x0000468d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf3820d82,0xff82ff82,0xff82ff82,0xff86ff82,0xff92ff8c,0xff9cff97,0xffa1ff9f,0xffa7ffa4,0xffacffa9,0xffafffae,0xffb2ffb1,0xffb5ffb4,0xffb8ffb6,0xffb9ffb9,0xffbdffbc,
-0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc8ffc8,0xffcaffc9,0xffcbffca,0xffcbffcb,0xffc9ffca,0xffc5ffc7,0xffc0ffc3,0xffbbffbe,0xffb6ffb9,0xffb0ffb3,0xffa7ffac,0xff9bffa2,0x0f88f990,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x86820000,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff8bff86,0xff93ff90,0xff9dff98,0xffa4ffa0,0xffa9ffa6,0xffadffab,0xffb1ffaf,0xffb5ffb3,0xffb8ffb6,0xffbbffb9,0xffbeffbc,0xffc0ffbf,0xffc3ffc1,0xffc5ffc4,0xffc7ffc6,0xffc8ffc7,0xffc9ffc9,0xffcaffca,0xffcaffca,0xffc8ffc9,0xffc3ffc6,0xffbeffc1,0xffb7ffbb,0xffafffb4,0xffa5ffaa,0xff95ff9e,0x0000828b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82b482,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9bff97,0xffa3ff9f,0xffaaffa6,0xffaeffac,0xffb3ffb1,0xffb7ffb5,0xffbbffb9,0xffbeffbc,0xffc1ffc0,0xffc4ffc2,0xffc6ffc5,0xffc8ffc7,0xffcaffc9,0xffcbffcb,0xffccffcc,0xffcbffcc,0xffc8ffca,0xffc4ffc6,0xffbfffc1,0xffb8ffbc,0xffb0ffb5,
-0xffa5ffab,0xb491ff9c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82b282,0xff82ff82,0xff82ff82,0xff8aff84,0xff93ff8f,0xff9cff98,0xffa4ffa0,0xffaaffa7,0xffafffac,0xffb3ffb1,0xffb8ffb6,0xffbbffb9,0xffbfffbd,0xffc2ffc0,0xffc5ffc3,0xffc7ffc6,0xffc9ffc8,0xffcaffca,
-0xffcbffcb,0xffcbffcc,0xffc9ffcb,0xffc5ffc7,0xffc0ffc3,0xffbbffbe,0xffb3ffb7,0xffa9ffaf,0xba97ffa1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff826882,0xff82ff82,0xff82ff82,0xff88ff84,0xff92ff8d,0xff9bff97,0xffa3ff9f,0xffaaffa7,0xffb0ffad,0xffb5ffb3,0xffb9ffb7,0xffbdffbc,
-0xffc1ffbf,0xffc4ffc3,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffcdffcd,0xffcbffcc,0xffc8ffca,0xffc4ffc6,0xffc0ffc2,0xffb9ffbd,0xffb3ffb7,0xffa9ffae,0x6297ffa0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x8c820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8eff88,0xff99ff93,0xffa3ff9e,0xffadffa8,0xffb6ffb2,0xffb8ffb8,0xffb8ffb8,0xffb9ffb9,0xffb9ffb9,0xffbbffbb,0xffbdffbc,0xffbfffbe,0xffc0ffc0,0xffc2ffc1,0xffc4ffc3,0xffc5ffc5,0xffc7ffc6,0xffc8ffc7,0xffc9ffc8,0xffcaffc9,0xffcaffca,0xffc9ffca,0xffc5ffc7,0xffc3ffc4,
-0xffc1ffc2,0xffbeffbf,0xffb9ffbc,0xffb5ffb8,0xffaeffb2,0xffa5ffaa,0xff97ff9f,0x00008a8d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff825282,0xff82ff82,0xff82ff82,0xff86ff82,0xff91ff8b,0xff9cff97,0xffa1ff9f,0xffa7ffa4,0xffacffaa,0xffb1ffaf,0xffb5ffb3,0xffb8ffb6,0xffbbffb9,0xffbdffbc,0xffc0ffbf,
-0xffc2ffc1,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffcaffc9,0xffcbffcb,0xffcdffcc,0xffcdffcd,0xffcbffcc,0xffc7ffc9,0xffc3ffc5,0xffbeffc0,0xffb9ffbb,0xffb5ffb7,0xffafffb2,0xffa7ffab,0xff9cffa2,0x5089ff92,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xdf820382,0xff82ff82,0xff82ff82,0xff83ff82,
-0xff8cff87,0xff95ff90,0xff9dff99,0xffa4ffa1,0xffabffa8,0xffb0ffad,0xffb4ffb2,0xffb7ffb5,0xffbbffb9,0xffbeffbc,0xffc1ffbf,0xffc3ffc2,0xffc6ffc4,0xffc8ffc7,0xffcaffc9,0xffcbffca,0xffccffcc,0xffcdffcd,0xffcbffcc,0xffc7ffc9,0xffc2ffc5,0xffbdffc0,0xffb7ffb9,0xffafffb3,0xffa5ffaa,0xff97ff9f,0x0185d58d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0xff82eb82,0xff82ff82,0xff82ff82,0xff8aff84,0xff93ff8f,0xff9cff98,0xffa4ffa0,0xffabffa7,0xffb1ffae,0xffb6ffb3,0xffb9ffb8,0xffbdffbb,0xffc1ffbf,0xffc4ffc2,0xffc7ffc5,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffceffcd,0xffcdffce,0xffcbffcc,0xffc7ffc9,0xffc3ffc5,0xffbeffc1,0xffb8ffbb,0xffb1ffb5,
-0xffa6ffac,0xeb93ff9e,0x0000058a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82e282,0xff82ff82,0xff82ff82,0xff8bff85,0xff93ff8f,0xff9dff99,0xffa5ffa1,0xffacffa8,0xffb1ffaf,0xffb6ffb4,0xffb9ffb8,0xffbeffbc,0xffc1ffc0,0xffc5ffc3,0xffc7ffc6,0xffcaffc9,0xffccffcb,0xffcdffcc,
-0xffceffce,0xffccffcd,0xffc9ffca,0xffc5ffc7,0xffc0ffc3,0xffbbffbe,0xffb4ffb7,0xffaaffaf,0xe698ffa2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff828a82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9cff97,0xffa4ffa0,0xffabffa7,0xffb2ffae,0xffb7ffb5,0xffbcffb9,0xffc0ffbe,
-0xffc4ffc2,0xffc7ffc5,0xffcaffc8,0xffccffcb,0xffceffcd,0xffcfffcf,0xffcdffce,0xffcbffcc,0xffc8ffc9,0xffc4ffc6,0xffc0ffc2,0xffbbffbe,0xffb4ffb7,0xffa9ffaf,0x8497ffa1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xc8820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8eff88,0xff98ff93,0xffa2ff9e,0xffacffa7,0xffb4ffb0,0xffb7ffb7,0xffb9ffb8,0xffbcffbb,0xffbdffbc,0xffbfffbe,0xffc0ffbf,0xffc2ffc1,0xffc4ffc3,0xffc5ffc5,0xffc7ffc6,0xffc9ffc8,0xffcaffc9,0xffcbffcb,0xffccffcc,0xffcdffcd,0xffcbffcc,0xffc7ffc9,0xffc1ffc4,0xffbfffc0,
-0xffbeffbf,0xffbbffbd,0xffb8ffb9,0xffb3ffb6,0xffadffb0,0xffa5ffaa,0xff98ff9f,0x0000cc8d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82a482,0xff82ff82,0xff82ff82,0xff86ff83,0xff91ff8c,0xff9cff97,0xffa2ff9f,0xffa7ffa5,0xffadffaa,0xffb2ffb0,0xffb7ffb5,0xffbbffb9,0xffbdffbc,0xffc0ffbf,0xffc3ffc1,
-0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffceffce,0xffcfffcf,0xffcdffce,0xffc9ffcb,0xffc5ffc7,0xffc1ffc3,0xffbbffbe,0xffb8ffb9,0xffb4ffb6,0xffaeffb1,0xffa7ffab,0xff9dffa3,0xac8bff95,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff823882,0xff82ff82,0xff82ff82,0xff84ff82,
-0xff8dff88,0xff96ff91,0xff9eff9a,0xffa5ffa1,0xffacffa8,0xffb2ffaf,0xffb6ffb4,0xffb9ffb8,0xffbdffbc,0xffc1ffbf,0xffc3ffc2,0xffc6ffc5,0xffc8ffc7,0xffcbffca,0xffccffcc,0xffceffcd,0xffcfffce,0xffcdffce,0xffcaffcb,0xffc6ffc8,0xffc1ffc4,0xffbcffbf,0xffb6ffb9,0xffaeffb2,0xffa5ffaa,0xff99ffa0,0x3086ff8f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x42820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff85,0xff93ff90,0xff9dff99,0xffa5ffa1,0xffacffa8,0xffb2ffaf,0xffb8ffb5,0xffbcffb9,0xffc0ffbe,0xffc3ffc2,0xffc6ffc5,0xffc9ffc8,0xffccffca,0xffceffcd,0xffcfffcf,0xffcfffcf,0xffcdffce,0xffcaffcc,0xffc7ffc9,0xffc3ffc5,0xffbeffc1,0xffb9ffbc,0xffb1ffb5,
-0xffa7ffac,0xff93ff9f,0x0000428a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x17820000,0xff82fd82,0xff82ff82,0xff83ff82,0xff8bff86,0xff95ff90,0xff9eff99,0xffa5ffa1,0xffadffa9,0xffb3ffb0,0xffb8ffb6,0xffbdffb9,0xffc0ffbf,0xffc4ffc2,0xffc7ffc6,0xffcaffc9,0xffccffcb,0xffceffcd,0xffcfffcf,
-0xffceffcf,0xffcbffcd,0xffc8ffca,0xffc5ffc7,0xffc1ffc3,0xffbbffbe,0xffb4ffb8,0xffabffb0,0xff99ffa4,0x00001990,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82aa82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9dff98,0xffa4ffa1,0xffacffa8,0xffb3ffaf,0xffb9ffb6,0xffbeffbc,0xffc2ffc0,
-0xffc6ffc4,0xffc9ffc8,0xffccffcb,0xffceffcd,0xffcfffcf,0xffceffcf,0xffcdffce,0xffcbffcc,0xffc8ffc9,0xffc5ffc6,0xffc1ffc3,0xffbbffbe,0xffb4ffb8,0xffaaffb0,0xa899ffa3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xfd821782,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff88,0xff98ff93,0xffa2ff9d,0xffabffa7,0xffb3ffaf,0xffb7ffb6,0xffb9ffb8,0xffbdffbb,0xffbfffbe,0xffc1ffc1,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc8ffc8,0xffcaffc9,0xffccffcb,0xffcdffcc,0xffceffce,0xffcfffcf,0xffcdffce,0xffc9ffcb,0xffc4ffc7,0xffbeffc1,0xffbdffbd,
-0xffbbffbc,0xffb9ffbb,0xffb7ffb8,0xffb2ffb5,0xffadffb0,0xffa5ffaa,0xff99ffa0,0x1586fb8f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0d820000,0xff82ed82,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff9cff97,0xffa3ffa0,0xffa9ffa6,0xffaeffab,0xffb3ffb1,0xffb8ffb6,0xffbdffb9,0xffc0ffbe,0xffc3ffc1,0xffc5ffc4,
-0xffc8ffc7,0xffcaffc9,0xffccffcb,0xffceffcd,0xffd0ffcf,0xffd0ffd0,0xffceffd0,0xffcbffcd,0xffc8ffca,0xffc4ffc6,0xffbfffc2,0xffb9ffbd,0xffb7ffb8,0xffb3ffb5,0xffaeffb1,0xffa8ffab,0xff9effa4,0xf18dff97,0x00000785,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff828e82,0xff82ff82,0xff82ff82,0xff85ff82,
-0xff8eff89,0xff97ff93,0xff9fff9b,0xffa6ffa3,0xffadffa9,0xffb3ffb0,0xffb8ffb6,0xffbcffb9,0xffc0ffbe,0xffc3ffc2,0xffc6ffc5,0xffc9ffc7,0xffcbffca,0xffcdffcc,0xffcfffce,0xffd0ffd0,0xffcfffcf,0xffccffcd,0xffc9ffca,0xffc5ffc7,0xffc1ffc3,0xffbcffbf,0xffb6ffb9,0xffaeffb2,0xffa6ffaa,0xff9bffa1,0x8c89ff93,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x92820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff96ff91,0xff9eff9a,0xffa6ffa2,0xffadffa9,0xffb3ffb0,0xffb9ffb6,0xffbeffbc,0xffc2ffc0,0xffc6ffc4,0xffc9ffc7,0xffccffca,0xffceffcd,0xffd0ffcf,0xffd0ffd0,0xffcfffd0,0xffccffce,0xffcaffcb,0xffc7ffc8,0xffc3ffc5,0xffbfffc1,0xffb9ffbc,0xffb2ffb6,
-0xffa8ffad,0xff97ffa1,0x0000908c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x48820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff87,0xff96ff91,0xff9fff9a,0xffa6ffa3,0xffaeffaa,0xffb4ffb1,0xffb9ffb7,0xffbfffbd,0xffc3ffc1,0xffc7ffc5,0xffcaffc8,0xffcdffcb,0xffcfffce,0xffd0ffd0,0xffcfffd0,
-0xffcdffce,0xffcbffcc,0xffc8ffca,0xffc5ffc7,0xffc1ffc3,0xffbcffbe,0xffb5ffb8,0xffabffb1,0xff9bffa5,0x00004491,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82c882,0xff82ff82,0xff82ff82,0xff8bff86,0xff95ff90,0xff9eff9a,0xffa6ffa2,0xffadffa9,0xffb4ffb0,0xffb9ffb7,0xffc0ffbd,0xffc4ffc2,
-0xffc8ffc6,0xffcbffca,0xffceffcd,0xffd0ffcf,0xffcfffcf,0xffceffce,0xffccffcd,0xffcaffcb,0xffc8ffc9,0xffc5ffc7,0xffc1ffc3,0xffbcffbf,0xffb5ffb9,0xffabffb1,0xcc9affa4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xff826082,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff89,0xff99ff93,0xffa2ff9d,0xffabffa7,0xffb3ffaf,0xffb8ffb6,0xffb9ffb9,0xffbdffbc,0xffc1ffbf,0xffc4ffc2,0xffc6ffc5,0xffc8ffc7,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffceffce,0xffd0ffcf,0xffd1ffd0,0xffcfffd0,0xffcbffcd,0xffc7ffc9,0xffc1ffc4,0xffbcffbe,0xffbbffbb,
-0xffb9ffb9,0xffb8ffb9,0xffb6ffb7,0xffb2ffb4,0xffadffb0,0xffa6ffaa,0xff9bffa1,0x5e89ff92,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x50820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9dff98,0xffa5ffa1,0xffaaffa7,0xffafffad,0xffb4ffb2,0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc5ffc4,0xffc8ffc7,
-0xffcaffc9,0xffcdffcb,0xffcfffce,0xffd1ffd0,0xffd1ffd1,0xffd0ffd1,0xffcdffce,0xffcaffcc,0xffc7ffc8,0xffc3ffc5,0xffbeffc1,0xffb9ffbb,0xffb6ffb8,0xffb3ffb5,0xffafffb1,0xffa9ffac,0xffa0ffa5,0xff90ff9a,0x00005487,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0xff82e582,0xff82ff82,0xff82ff82,0xff86ff83,
-0xff90ff8b,0xff98ff93,0xffa0ff9c,0xffa7ffa4,0xffaeffab,0xffb4ffb1,0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc6ffc4,0xffc9ffc7,0xffcbffca,0xffceffcd,0xffd0ffcf,0xffd1ffd1,0xffd0ffd1,0xffceffcf,0xffcbffcc,0xffc8ffca,0xffc5ffc7,0xffc1ffc3,0xffbcffbe,0xffb5ffb9,0xffaeffb2,0xffa7ffab,0xff9dffa2,0xed8cff96,0x00000583,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xeb820782,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff88,0xff97ff92,0xffa0ff9c,0xffa7ffa3,0xffaeffab,0xffb5ffb1,0xffb9ffb8,0xffc0ffbd,0xffc4ffc2,0xffc8ffc6,0xffcbffca,0xffceffcd,0xffd0ffcf,0xffd1ffd1,0xffd0ffd0,0xffceffcf,0xffccffcd,0xffcaffcb,0xffc7ffc8,0xffc3ffc5,0xffbfffc1,0xffb9ffbc,0xffb2ffb6,
-0xffa8ffae,0xff99ffa2,0x0384e38d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x78820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff89,0xff97ff93,0xffa0ff9c,0xffa8ffa4,0xffafffab,0xffb5ffb2,0xffbbffb8,0xffc1ffbe,0xffc5ffc3,0xffc9ffc7,0xffccffca,0xffcfffcd,0xffd0ffd0,0xffd0ffd0,0xffceffcf,
-0xffcdffce,0xffcbffcc,0xffc8ffca,0xffc5ffc7,0xffc1ffc3,0xffbcffbf,0xffb6ffb9,0xffacffb2,0xff9dffa6,0x00007e93,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff82ed82,0xff82ff82,0xff83ff82,0xff8dff87,0xff96ff92,0xff9fff9b,0xffa7ffa3,0xffaeffab,0xffb5ffb1,0xffbbffb8,0xffc1ffbe,0xffc6ffc3,
-0xffcaffc8,0xffcdffcc,0xffcfffce,0xffcfffcf,0xffceffcf,0xffcdffce,0xffccffcd,0xffcbffcb,0xffc8ffca,0xffc6ffc7,0xffc2ffc4,0xffbdffbf,0xffb6ffb9,0xffacffb2,0xef9bffa5,0x00000391,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xff82ae82,0xff82ff82,0xff82ff82,0xff85ff82,0xff90ff8a,0xff99ff95,0xffa3ff9e,0xffabffa7,0xffb3ffaf,0xffb8ffb6,0xffbbffb9,0xffbfffbd,0xffc2ffc0,0xffc5ffc4,0xffc8ffc7,0xffcaffc9,0xffccffcb,0xffceffcd,0xffcfffce,0xffd1ffd0,0xffd2ffd2,0xffd0ffd1,0xffcdffcf,0xffc9ffcb,0xffc5ffc7,0xffbfffc2,0xffb9ffbc,0xffb9ffb9,
-0xffb9ffb9,0xffb8ffb8,0xffb6ffb7,0xffb2ffb4,0xffaeffb0,0xffa7ffab,0xff9dffa2,0xa88bff96,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xa6820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff95ff90,0xff9eff9a,0xffa6ffa3,0xffacffa9,0xffb1ffae,0xffb6ffb3,0xffbbffb8,0xffbfffbd,0xffc4ffc2,0xffc7ffc5,0xffcaffc9,
-0xffcdffcb,0xffcfffce,0xffd1ffd0,0xffd2ffd2,0xffd1ffd2,0xffcfffd0,0xffccffcd,0xffc9ffcb,0xffc6ffc8,0xffc2ffc4,0xffbdffbf,0xffb8ffb9,0xffb6ffb7,0xffb4ffb5,0xffb0ffb2,0xffaaffad,0xffa2ffa6,0xff93ff9c,0x0000a88a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4e820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,
-0xff92ff8d,0xff9aff96,0xffa2ff9e,0xffa9ffa5,0xffafffac,0xffb5ffb3,0xffbbffb8,0xffc0ffbe,0xffc4ffc2,0xffc8ffc6,0xffcbffc9,0xffceffcc,0xffd0ffcf,0xffd1ffd1,0xffd1ffd1,0xffcfffd0,0xffcdffce,0xffcbffcc,0xffc8ffc9,0xffc5ffc6,0xffc1ffc3,0xffbcffbe,0xffb5ffb9,0xffaeffb2,0xffa8ffab,0xff9fffa4,0xff8fff99,0x00005486,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff824e82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8fff8a,0xff99ff93,0xffa1ff9d,0xffa9ffa5,0xffb0ffac,0xffb6ffb3,0xffbcffb9,0xffc1ffbf,0xffc6ffc4,0xffcaffc8,0xffcdffcc,0xffd0ffcf,0xffd1ffd1,0xffd0ffd1,0xffcfffd0,0xffceffce,0xffccffcd,0xffcaffcb,0xffc7ffc8,0xffc4ffc5,0xffbfffc2,0xffb9ffbd,0xffb3ffb7,
-0xffa9ffae,0xff9bffa3,0x5886ff90,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb0820000,0xff82ff82,0xff82ff82,0xff85ff82,0xff90ff8a,0xff99ff93,0xffa1ff9d,0xffa9ffa5,0xffb0ffad,0xffb7ffb3,0xffbdffb9,0xffc2ffbf,0xffc7ffc4,0xffcbffc9,0xffceffcc,0xffd0ffcf,0xffd0ffd0,0xffcfffd0,0xffceffce,
-0xffcdffcd,0xffcbffcc,0xffc9ffca,0xffc6ffc7,0xffc2ffc4,0xffbdffc0,0xffb6ffb9,0xffadffb2,0xff9fffa7,0x0000b493,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x16820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff89,0xff98ff93,0xffa0ff9c,0xffa8ffa5,0xffafffac,0xffb6ffb3,0xffbcffb9,0xffc2ffbf,0xffc7ffc4,
-0xffcbffc9,0xffceffcd,0xffceffce,0xffceffce,0xffceffce,0xffcdffcd,0xffccffcd,0xffcbffcc,0xffc9ffca,0xffc6ffc8,0xffc2ffc4,0xffbeffc0,0xffb7ffbb,0xffadffb3,0xff9affa7,0x00001a92,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x09820000,0xff82f182,0xff82ff82,0xff82ff82,0xff86ff83,0xff91ff8c,0xff9bff96,0xffa3ff9f,0xffacffa8,0xffb3ffb0,0xffb9ffb7,0xffbcffbb,0xffc0ffbe,0xffc4ffc2,0xffc7ffc5,0xffcaffc8,0xffccffcb,0xffceffcd,0xffd0ffcf,0xffd1ffd0,0xffd3ffd2,0xffd2ffd2,0xffcfffd0,0xffcbffcd,0xffc7ffc9,0xffc3ffc5,0xffbdffc0,0xffb8ffb9,0xffb8ffb8,
-0xffb8ffb9,0xffb7ffb8,0xffb6ffb7,0xffb3ffb4,0xffaeffb1,0xffa8ffab,0xff9fffa4,0xef8eff98,0x00000984,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf9820b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff8cff86,0xff96ff91,0xff9fff9b,0xffa8ffa4,0xffadffab,0xffb3ffb0,0xffb8ffb5,0xffbcffb9,0xffc1ffbf,0xffc5ffc3,0xffc9ffc7,0xffccffcb,
-0xffceffcd,0xffd1ffd0,0xffd2ffd2,0xffd2ffd2,0xffd0ffd1,0xffcdffcf,0xffcbffcc,0xffc8ffca,0xffc5ffc7,0xffc1ffc3,0xffbbffbe,0xffb8ffb9,0xffb6ffb7,0xffb4ffb5,0xffb0ffb2,0xffabffae,0xffa3ffa8,0xff97ff9e,0x0b84f38d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xae820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,
-0xff93ff8f,0xff9cff98,0xffa4ffa0,0xffabffa7,0xffb1ffae,0xffb7ffb4,0xffbcffb9,0xffc1ffbf,0xffc6ffc4,0xffcaffc8,0xffcdffcb,0xffd0ffce,0xffd2ffd1,0xffd1ffd2,0xffd0ffd1,0xffceffcf,0xffccffcd,0xffcaffcb,0xffc8ffc9,0xffc4ffc6,0xffc0ffc3,0xffbbffbe,0xffb5ffb8,0xffafffb2,0xffaaffad,0xffa1ffa6,0xff93ff9c,0x0000b089,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82c282,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9aff96,0xffa3ff9f,0xffabffa7,0xffb1ffae,0xffb8ffb5,0xffbdffbb,0xffc3ffc0,0xffc7ffc5,0xffccffca,0xffcfffcd,0xffd0ffd0,0xffd0ffd0,0xffcfffd0,0xffceffcf,0xffcdffce,0xffccffcc,0xffcaffcb,0xffc7ffc9,0xffc4ffc6,0xffc0ffc2,0xffbbffbd,0xffb3ffb7,
-0xffaaffaf,0xff9cffa3,0xc68aff93,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xe9820382,0xff82ff82,0xff82ff82,0xff86ff82,0xff91ff8c,0xff9aff96,0xffa3ff9f,0xffaaffa7,0xffb2ffae,0xffb8ffb5,0xffbeffbb,0xffc3ffc1,0xffc8ffc6,0xffccffca,0xffcfffce,0xffcfffcf,0xffcfffcf,0xffceffcf,0xffceffce,
-0xffcdffcd,0xffcbffcc,0xffc9ffca,0xffc6ffc8,0xffc3ffc4,0xffbeffc0,0xffb7ffbb,0xffaeffb3,0xffa1ffa9,0x0000e896,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x40820000,0xff82ff82,0xff82ff82,0xff85ff82,0xff90ff8a,0xff99ff95,0xffa2ff9e,0xffaaffa6,0xffb1ffae,0xffb8ffb4,0xffbeffbb,0xffc3ffc1,0xffc8ffc6,
-0xffcbffca,0xffccffcb,0xffcdffcc,0xffcdffcd,0xffcdffcd,0xffcdffcd,0xffccffcd,0xffcbffcc,0xffc9ffca,0xffc7ffc8,0xffc3ffc5,0xffbeffc1,0xffb8ffbb,0xffafffb4,0xff9dffa8,0x00004093,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x50820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff9cff97,0xffa4ffa0,0xffadffa8,0xffb4ffb0,0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc5ffc3,0xffc7ffc6,0xffc9ffc8,0xffccffca,0xffceffcd,0xffcfffcf,0xffd1ffd1,0xffd0ffd1,0xffceffcf,0xffcbffcd,0xffc9ffca,0xffc6ffc7,0xffc1ffc3,0xffbbffbe,0xffb7ffb8,0xffb8ffb8,
-0xffb8ffb8,0xffb8ffb8,0xffb6ffb7,0xffb3ffb5,0xffafffb1,0xffa9ffad,0xffa1ffa6,0xff91ff9a,0x00004288,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff825682,0xff82ff82,0xff82ff82,0xff83ff82,0xff8eff88,0xff98ff93,0xffa1ff9c,0xffa9ffa5,0xffafffad,0xffb4ffb2,0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc5ffc4,0xffc9ffc7,0xffccffca,
-0xffcfffcd,0xffd1ffd0,0xffd0ffd0,0xffceffcf,0xffcdffce,0xffcbffcc,0xffcaffcb,0xffc7ffc9,0xffc4ffc6,0xffc0ffc2,0xffb9ffbd,0xffb8ffb9,0xffb7ffb8,0xffb5ffb6,0xffb1ffb3,0xffacffaf,0xffa5ffa9,0xff9affa1,0x5087ff91,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf7820f82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,
-0xff96ff92,0xff9eff9a,0xffa6ffa2,0xffadffa9,0xffb3ffb0,0xffb9ffb6,0xffbeffbb,0xffc3ffc1,0xffc8ffc5,0xffcbffca,0xffcfffcd,0xffd1ffd0,0xffd1ffd1,0xffd0ffd1,0xffcfffcf,0xffceffce,0xffccffcd,0xffcaffcb,0xffc7ffc9,0xffc4ffc6,0xffc0ffc2,0xffbbffbe,0xffb5ffb8,0xffb0ffb2,0xffabffae,0xffa4ffa8,0xff97ff9e,0x1184f38d,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x2d820000,0xff82fd82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9cff98,0xffa5ffa1,0xffacffa9,0xffb3ffb0,0xffb9ffb6,0xffbfffbc,0xffc4ffc2,0xffc9ffc6,0xffcdffcb,0xffcfffce,0xffcfffcf,0xffcfffcf,0xffceffce,0xffceffce,0xffcdffcd,0xffccffcc,0xffcaffcb,0xffc8ffc9,0xffc4ffc6,0xffc0ffc2,0xffbbffbe,0xffb3ffb7,
-0xffaaffaf,0xff9fffa4,0xfd8eff98,0x00002785,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff822c82,0xff82ff82,0xff82ff82,0xff88ff83,0xff93ff8e,0xff9cff98,0xffa5ffa1,0xffacffa8,0xffb3ffb0,0xffb9ffb6,0xffbfffbd,0xffc5ffc2,0xffc9ffc7,0xffcdffcb,0xffceffce,0xffceffce,0xffceffce,0xffceffce,0xffcdffce,
-0xffcdffcd,0xffcbffcc,0xffc9ffca,0xffc7ffc8,0xffc3ffc5,0xffbeffc1,0xffb8ffbb,0xffafffb4,0xffa2ffaa,0x2f8dff97,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x72820000,0xff82ff82,0xff82ff82,0xff86ff82,0xff91ff8c,0xff9bff96,0xffa3ff9f,0xffabffa8,0xffb3ffaf,0xffb9ffb6,0xffbfffbc,0xffc5ffc2,0xffc8ffc7,
-0xffc9ffc9,0xffcaffca,0xffccffcb,0xffcdffcc,0xffcdffcd,0xffcdffcd,0xffcdffcd,0xffccffcc,0xffcaffcb,0xffc7ffc9,0xffc4ffc6,0xffbfffc2,0xffb9ffbc,0xffb0ffb5,0xff9fffa9,0x00007296,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x9a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8f,0xff9dff98,0xffa6ffa1,0xffaeffaa,0xffb5ffb1,0xffbbffb8,0xffbfffbd,0xffc1ffc1,0xffc3ffc2,0xffc4ffc4,0xffc7ffc6,0xffc9ffc8,0xffccffcb,0xffceffcd,0xffceffcf,0xffccffcd,0xffc9ffca,0xffc7ffc8,0xffc5ffc6,0xffc2ffc4,0xffbfffc1,0xffb8ffbc,0xffb6ffb6,0xffb8ffb7,
-0xffb8ffb8,0xffb8ffb8,0xffb6ffb7,0xffb4ffb5,0xffb0ffb2,0xffabffae,0xffa3ffa7,0xff95ff9d,0x0000988b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82a682,0xff82ff82,0xff82ff82,0xff85ff82,0xff8fff8a,0xff99ff93,0xffa2ff9e,0xffabffa7,0xffb1ffae,0xffb6ffb4,0xffb9ffb9,0xffbeffbc,0xffc0ffbf,0xffc3ffc2,0xffc6ffc5,0xffcaffc8,
-0xffcdffcb,0xffcdffce,0xffcbffcc,0xffcaffcb,0xffc9ffc9,0xffc8ffc8,0xffc7ffc7,0xffc5ffc6,0xffc3ffc4,0xffbeffc1,0xffb9ffbc,0xffb8ffb8,0xffb7ffb8,0xffb5ffb7,0xffb2ffb4,0xffaeffb0,0xffa7ffab,0xff9dffa3,0xa28bff95,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827282,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff89,
-0xff98ff93,0xffa0ff9c,0xffa8ffa4,0xffafffab,0xffb5ffb2,0xffb9ffb8,0xffbfffbd,0xffc3ffc1,0xffc7ffc5,0xffcbffc9,0xffceffcd,0xffcfffcf,0xffceffce,0xffcdffce,0xffcdffcd,0xffccffcc,0xffcbffcc,0xffcaffcb,0xffc7ffc9,0xffc4ffc6,0xffc0ffc2,0xffb9ffbe,0xffb5ffb7,0xffb1ffb3,0xffadffaf,0xffa5ffa9,0xff9affa1,0x6689ff92,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x96820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff85,0xff95ff90,0xff9fff9a,0xffa7ffa3,0xffaeffab,0xffb5ffb2,0xffb9ffb8,0xffbfffbd,0xffc4ffc2,0xffc8ffc6,0xffcbffca,0xffcbffcb,0xffcbffcb,0xffccffcc,0xffccffcc,0xffccffcc,0xffccffcc,0xffcbffcc,0xffcaffcb,0xffc8ffc9,0xffc5ffc6,0xffc1ffc3,0xffbbffbe,0xffb4ffb8,
-0xffaaffaf,0xffa1ffa6,0xff93ff9b,0x00009488,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827a82,0xff82ff82,0xff82ff82,0xff8aff84,0xff93ff8f,0xff9eff99,0xffa6ffa2,0xffaeffaa,0xffb5ffb2,0xffbbffb8,0xffc1ffbe,0xffc6ffc3,0xffc9ffc8,0xffcbffca,0xffcbffcb,0xffccffcc,0xffcdffcd,0xffcdffcd,0xffcdffcd,
-0xffcdffcd,0xffccffcc,0xffcaffcb,0xffc7ffc9,0xffc4ffc6,0xffbfffc2,0xffb9ffbc,0xffb0ffb5,0xffa3ffaa,0x7c8eff99,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xa6820000,0xff82ff82,0xff82ff82,0xff87ff83,0xff93ff8d,0xff9cff98,0xffa5ffa1,0xffadffa9,0xffb4ffb1,0xffb9ffb7,0xffc0ffbd,0xffc4ffc2,0xffc5ffc5,
-0xffc6ffc6,0xffc7ffc7,0xffc9ffc8,0xffcbffca,0xffccffcb,0xffcdffcc,0xffcdffcd,0xffccffcc,0xffcaffcb,0xffc8ffc9,0xffc5ffc6,0xffc0ffc3,0xffb9ffbd,0xffb0ffb5,0xffa1ffaa,0x00009c97,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xe0820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff95ff90,0xff9eff9a,0xffa7ffa3,0xffafffab,0xffb6ffb2,0xffbcffb9,0xffbeffbe,0xffbeffbe,0xffbfffbf,0xffc1ffc0,0xffc4ffc3,0xffc7ffc5,0xffcaffc9,0xffccffcc,0xffcaffcb,0xffc7ffc8,0xffc4ffc5,0xffc2ffc3,0xffc0ffc1,0xffbdffbe,0xffbbffbc,0xffb6ffb8,0xffb6ffb5,0xffb8ffb7,
-0xffb8ffb8,0xffb8ffb8,0xffb7ffb8,0xffb5ffb6,0xffb1ffb3,0xffacffaf,0xffa5ffa9,0xff98ff9f,0x0385db8e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x07820000,0xff82f382,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9bff96,0xffa4ffa0,0xffacffa8,0xffb3ffb0,0xffb7ffb5,0xffb9ffb8,0xffbbffb9,0xffbeffbc,0xffc1ffbf,0xffc4ffc3,0xffc8ffc6,
-0xffcaffc9,0xffc9ffc9,0xffc7ffc8,0xffc6ffc6,0xffc5ffc5,0xffc4ffc4,0xffc3ffc3,0xffc2ffc2,0xffc0ffc1,0xffbdffbf,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb6ffb7,0xffb3ffb5,0xffafffb1,0xffa9ffac,0xffa0ffa5,0xef8eff99,0x00000b84,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82c682,0xff82ff82,0xff82ff82,0xff86ff82,0xff91ff8b,
-0xff9aff96,0xffa3ff9f,0xffaaffa6,0xffb0ffad,0xffb5ffb3,0xffb9ffb8,0xffbeffbc,0xffc1ffc0,0xffc5ffc3,0xffc9ffc7,0xffcbffca,0xffcaffcb,0xffcaffca,0xffc9ffca,0xffc9ffc9,0xffc9ffc9,0xffc9ffc9,0xffc8ffc8,0xffc7ffc7,0xffc4ffc5,0xffbfffc2,0xffb9ffbd,0xffb6ffb7,0xffb3ffb4,0xffaeffb0,0xffa7ffab,0xff9dffa3,0xca8bff96,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xf1820d82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff87,0xff97ff92,0xffa1ff9c,0xffa9ffa5,0xffafffac,0xffb4ffb2,0xffb9ffb7,0xffbeffbb,0xffc2ffc0,0xffc6ffc4,0xffc7ffc7,0xffc7ffc7,0xffc7ffc7,0xffc8ffc8,0xffc9ffc8,0xffc9ffc9,0xffc9ffc9,0xffc9ffc9,0xffc9ffc9,0xffc7ffc8,0xffc5ffc6,0xffc1ffc3,0xffbbffbe,0xffb3ffb7,
-0xffabffaf,0xffa3ffa8,0xff97ff9e,0x0f83f38b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82d282,0xff82ff82,0xff82ff82,0xff8bff86,0xff96ff91,0xffa0ff9b,0xffa8ffa4,0xffafffac,0xffb5ffb2,0xffbbffb8,0xffc0ffbe,0xffc5ffc3,0xffc6ffc6,0xffc7ffc6,0xffc7ffc7,0xffc9ffc8,0xffcaffc9,0xffcbffcb,0xffccffcb,
-0xffccffcc,0xffcbffcb,0xffcaffcb,0xffc8ffc9,0xffc4ffc6,0xffc0ffc2,0xffb9ffbd,0xffb1ffb6,0xffa4ffab,0xcd8eff9b,0x00000383,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xda820000,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8f,0xff9eff99,0xffa6ffa2,0xffadffaa,0xffb4ffb1,0xffb9ffb7,0xffbeffbc,0xffc0ffc0,0xffc1ffc0,
-0xffc2ffc1,0xffc3ffc3,0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffcbffcb,0xffcbffcb,0xffcaffcb,0xffc8ffc9,0xffc5ffc7,0xffc1ffc3,0xffb9ffbe,0xffb1ffb6,0xffa2ffab,0x0000d496,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xff822d82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff88,0xff97ff92,0xffa0ff9b,0xffa8ffa4,0xffb0ffac,0xffb7ffb4,0xffbbffb9,0xffbbffbb,0xffbbffb9,0xffbcffbb,0xffbfffbd,0xffc2ffc0,0xffc5ffc3,0xffc8ffc7,0xffc8ffc9,0xffc5ffc6,0xffc2ffc3,0xffbfffc1,0xffbdffbe,0xffbbffbc,0xffb8ffb9,0xffb5ffb7,0xffb2ffb3,0xffb6ffb4,0xffb8ffb7,
-0xffb9ffb8,0xffb9ffb9,0xffb8ffb8,0xffb6ffb7,0xffb3ffb4,0xffaeffb0,0xffa6ffaa,0xff9bffa2,0x2e86ff90,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x48820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9dff98,0xffa6ffa1,0xffaeffaa,0xffb3ffb1,0xffb4ffb4,0xffb6ffb5,0xffb8ffb7,0xffbbffb9,0xffbfffbd,0xffc3ffc1,0xffc6ffc4,
-0xffc6ffc6,0xffc4ffc5,0xffc3ffc3,0xffc2ffc2,0xffc1ffc1,0xffc0ffc0,0xffbfffc0,0xffbdffbe,0xffbcffbc,0xffb9ffb9,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb7ffb8,0xffb5ffb6,0xffb0ffb3,0xffabffae,0xffa2ffa7,0xff92ff9c,0x00004488,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x27820000,0xff82fd82,0xff82ff82,0xff82ff82,0xff88ff83,0xff93ff8d,
-0xff9dff98,0xffa5ffa1,0xffabffa8,0xffb0ffae,0xffb3ffb2,0xffb7ffb5,0xffbbffb9,0xffbfffbd,0xffc3ffc1,0xffc7ffc5,0xffc6ffc7,0xffc6ffc6,0xffc6ffc6,0xffc6ffc6,0xffc6ffc6,0xffc5ffc6,0xffc5ffc5,0xffc5ffc5,0xffc4ffc4,0xffc2ffc3,0xffbfffc1,0xffb9ffbc,0xffb7ffb8,0xffb4ffb5,0xffafffb2,0xffa9ffad,0xffa0ffa5,0xff8fff99,0x00002386,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xff825682,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff89,0xff99ff95,0xffa1ff9e,0xffa8ffa5,0xffadffaa,0xffb2ffaf,0xffb7ffb4,0xffbcffb9,0xffc0ffbe,0xffc3ffc2,0xffc2ffc3,0xffc3ffc2,0xffc3ffc3,0xffc4ffc4,0xffc5ffc5,0xffc6ffc6,0xffc6ffc6,0xffc6ffc6,0xffc6ffc6,0xffc5ffc5,0xffc3ffc4,0xffc0ffc2,0xffbbffbe,0xffb3ffb7,
-0xffadffb0,0xffa5ffa9,0xff9affa0,0x6686ff90,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3d820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff87,0xff98ff93,0xffa1ff9d,0xffa8ffa5,0xffafffac,0xffb4ffb1,0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc2ffc2,0xffc2ffc2,0xffc4ffc3,0xffc5ffc4,0xffc6ffc6,0xffc8ffc7,0xffc9ffc8,
-0xffc9ffc9,0xffc9ffc9,0xffc9ffc9,0xffc7ffc8,0xffc5ffc6,0xffc0ffc3,0xffb9ffbd,0xffb1ffb6,0xffa4ffab,0xff8fff9c,0x00003685,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff821982,0xff82ff82,0xff82ff82,0xff8aff84,0xff95ff90,0xff9eff99,0xffa5ffa2,0xffacffa8,0xffb2ffaf,0xffb7ffb5,0xffbbffb9,0xffbcffbb,0xffbdffbc,
-0xffbeffbe,0xffc0ffbf,0xffc2ffc1,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffc8ffc8,0xffc8ffc8,0xffc8ffc8,0xffc7ffc8,0xffc5ffc6,0xffc1ffc3,0xffb9ffbe,0xffb1ffb6,0xffa3ffab,0x158dfd97,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xff826e82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff89,0xff99ff93,0xffa1ff9d,0xffaaffa6,0xffb1ffae,0xffb7ffb5,0xffb7ffb7,0xffb7ffb7,0xffb8ffb7,0xffb9ffb8,0xffbcffbb,0xffbfffbe,0xffc3ffc1,0xffc5ffc5,0xffc3ffc4,0xffc0ffc1,0xffbeffbf,0xffbbffbc,0xffb9ffb9,0xffb7ffb8,0xffb4ffb5,0xffb0ffb2,0xffafffae,0xffb4ffb2,0xffb8ffb7,
-0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb7ffb8,0xffb4ffb5,0xffafffb2,0xffa8ffac,0xff9dffa4,0x768bff95,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x9e820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff95ff90,0xff9fff9a,0xffa7ffa3,0xffaeffab,0xffb0ffaf,0xffb1ffb0,0xffb3ffb2,0xffb6ffb4,0xffb9ffb8,0xffbdffbb,0xffc1ffbf,0xffc3ffc3,
-0xffc1ffc2,0xffc0ffc0,0xffbfffc0,0xffbeffbf,0xffbeffbe,0xffbcffbd,0xffbbffbc,0xffb9ffb9,0xffb7ffb8,0xffb4ffb5,0xffb7ffb5,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb6ffb7,0xffb2ffb4,0xffacffaf,0xffa4ffa9,0xff96ff9e,0x0000a68b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x88820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff95ff90,
-0xff9eff9a,0xffa6ffa3,0xffaaffa8,0xffadffac,0xffb1ffaf,0xffb5ffb3,0xffb9ffb7,0xffbeffbb,0xffc2ffc0,0xffc3ffc3,0xffc2ffc3,0xffc2ffc2,0xffc2ffc2,0xffc2ffc2,0xffc3ffc3,0xffc2ffc2,0xffc2ffc2,0xffc1ffc1,0xffc0ffc1,0xffbfffbf,0xffbcffbd,0xffb9ffb9,0xffb8ffb8,0xffb5ffb6,0xffb1ffb3,0xffabffae,0xffa2ffa7,0xff93ff9c,0x00007e89,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x01820000,0xff82c382,0xff82ff82,0xff82ff82,0xff86ff82,0xff91ff8c,0xff9aff96,0xffa0ff9d,0xffa5ffa3,0xffabffa8,0xffb0ffad,0xffb5ffb3,0xffb9ffb8,0xffbeffbc,0xffbfffbf,0xffbfffbf,0xffbfffbf,0xffc0ffc0,0xffc1ffc1,0xffc2ffc2,0xffc3ffc3,0xffc3ffc3,0xffc3ffc3,0xffc3ffc3,0xffc2ffc2,0xffc0ffc1,0xffbeffbf,0xffb9ffbc,0xffb3ffb6,
-0xffaeffb1,0xffa7ffab,0xff9dffa2,0xcb8aff95,0x00000182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb8820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff89,0xff98ff93,0xffa0ff9c,0xffa6ffa3,0xffacffa9,0xffb2ffaf,0xffb8ffb5,0xffbcffb9,0xffbeffbd,0xffbeffbe,0xffbfffbe,0xffc0ffbf,0xffc2ffc1,0xffc3ffc2,0xffc5ffc4,0xffc6ffc6,
-0xffc6ffc6,0xffc6ffc6,0xffc6ffc6,0xffc5ffc5,0xffc3ffc4,0xffc0ffc1,0xffb9ffbd,0xffb0ffb5,0xffa4ffab,0xff92ff9c,0x0000b088,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff826e82,0xff82ff82,0xff82ff82,0xff8aff84,0xff93ff8f,0xff9bff97,0xffa3ff9f,0xffaaffa6,0xffb0ffad,0xffb5ffb3,0xffb7ffb7,0xffb8ffb8,0xffb9ffb9,
-0xffbbffbb,0xffbdffbc,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc5ffc4,0xffc6ffc5,0xffc6ffc6,0xffc5ffc6,0xffc4ffc5,0xffc2ffc3,0xffbfffc1,0xffb9ffbd,0xffb1ffb6,0xffa3ffab,0x648cff97,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xff82ba82,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8b,0xff9aff95,0xffa3ff9f,0xffabffa7,0xffb2ffaf,0xffb4ffb3,0xffb4ffb4,0xffb4ffb4,0xffb5ffb4,0xffb7ffb6,0xffb9ffb9,0xffbeffbc,0xffc1ffbf,0xffc1ffc2,0xffbeffc0,0xffbcffbd,0xffb9ffbb,0xffb7ffb9,0xffb5ffb6,0xffb3ffb4,0xffafffb1,0xffabffae,0xffadffab,0xffb2ffaf,0xffb7ffb5,
-0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb5ffb6,0xffb0ffb3,0xffaaffad,0xffa0ffa5,0xb48dff98,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xeb820382,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff87,0xff97ff92,0xffa0ff9c,0xffa8ffa5,0xffabffaa,0xffacffac,0xffaeffad,0xffb1ffaf,0xffb4ffb2,0xffb8ffb6,0xffbcffb9,0xffbfffbd,0xffbfffc0,
-0xffbeffbe,0xffbcffbd,0xffbcffbc,0xffbbffbb,0xffb9ffbb,0xffb9ffb9,0xffb8ffb8,0xffb5ffb7,0xffb2ffb4,0xffb1ffb1,0xffb5ffb3,0xffb9ffb7,0xffb9ffb9,0xffb9ffb9,0xffb7ffb8,0xffb3ffb5,0xffaeffb1,0xffa6ffaa,0xff99ffa0,0x0785ed8e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd3820382,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff86,0xff97ff92,
-0xff9fff9b,0xffa4ffa2,0xffa7ffa6,0xffabffa9,0xffafffad,0xffb3ffb1,0xffb8ffb6,0xffbcffb9,0xffc0ffbe,0xffbfffc0,0xffbfffbf,0xffbeffbe,0xffbfffbf,0xffbfffbf,0xffbfffbf,0xffbfffbf,0xffbfffbf,0xffbeffbe,0xffbcffbd,0xffb9ffbb,0xffb7ffb8,0xffb8ffb7,0xffb8ffb9,0xffb6ffb7,0xffb2ffb4,0xffacffaf,0xffa4ffa9,0xff97ff9f,0x0000da8c,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x3a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff98ff95,0xff9eff9a,0xffa3ffa1,0xffa9ffa6,0xffaeffac,0xffb4ffb1,0xffb9ffb6,0xffbcffbb,0xffbcffbc,0xffbcffbc,0xffbcffbc,0xffbdffbd,0xffbeffbe,0xffc0ffbf,0xffc0ffc0,0xffc1ffc1,0xffc0ffc0,0xffc0ffc0,0xffbeffbf,0xffbcffbd,0xffb9ffbb,0xffb6ffb7,0xffb4ffb5,
-0xffafffb2,0xffa9ffac,0xff9fffa4,0xff8dff98,0x00004284,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfd823382,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff89,0xff96ff92,0xff9dff9a,0xffa4ffa1,0xffaaffa7,0xffb0ffad,0xffb6ffb3,0xffb9ffb8,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbdffbc,0xffbfffbe,0xffc0ffc0,0xffc2ffc1,0xffc3ffc3,
-0xffc4ffc4,0xffc3ffc4,0xffc3ffc3,0xffc2ffc2,0xffbfffc1,0xffbdffbe,0xffb8ffbb,0xffafffb4,0xffa3ffa9,0xff95ff9d,0x2f83fd8b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01820000,0xff82d382,0xff82ff82,0xff82ff82,0xff88ff83,0xff91ff8d,0xff99ff95,0xffa1ff9d,0xffa8ffa4,0xffaeffab,0xffb3ffb1,0xffb4ffb3,0xffb5ffb5,0xffb7ffb6,
-0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbeffbe,0xffc0ffbf,0xffc2ffc1,0xffc3ffc3,0xffc3ffc3,0xffc3ffc3,0xffc1ffc2,0xffbfffc0,0xffbcffbd,0xffb7ffb9,0xffafffb3,0xffa1ffa9,0xd989ff97,0x00000382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x0b820000,0xff82f982,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff9cff97,0xffa5ffa0,0xffacffa9,0xffb0ffaf,0xffb0ffb0,0xffb1ffb0,0xffb1ffb1,0xffb2ffb1,0xffb5ffb4,0xffb8ffb7,0xffbcffb9,0xffbfffbe,0xffbdffbf,0xffb9ffbc,0xffb8ffb9,0xffb6ffb7,0xffb4ffb5,0xffb2ffb3,0xffafffb0,0xffabffad,0xffa8ffa9,0xffabffa9,0xffb0ffae,0xffb5ffb3,
-0xffb9ffb8,0xffbbffbb,0xffb9ffbb,0xffb9ffb9,0xffb6ffb8,0xffb2ffb4,0xffabffaf,0xffa2ffa7,0xf990ff9b,0x00000d86,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff824282,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff89,0xff99ff93,0xffa1ff9d,0xffa6ffa5,0xffa8ffa7,0xffaaffa9,0xffacffab,0xffafffad,0xffb2ffb0,0xffb6ffb4,0xffb9ffb8,0xffbdffbc,0xffbcffbd,
-0xffb9ffbb,0xffb9ffb9,0xffb9ffb9,0xffb8ffb8,0xffb7ffb8,0xffb6ffb7,0xffb4ffb5,0xffb1ffb3,0xffaeffb0,0xffafffae,0xffb3ffb1,0xffb7ffb5,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb4ffb6,0xffafffb2,0xffa7ffab,0xff9cffa3,0x4287ff90,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff823a82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff88,0xff98ff93,
-0xff9eff9c,0xffa1ffa0,0xffa5ffa3,0xffa9ffa7,0xffadffab,0xffb2ffaf,0xffb6ffb4,0xffbbffb9,0xffbdffbd,0xffbcffbc,0xffbcffbc,0xffbbffbb,0xffbcffbc,0xffbcffbc,0xffbcffbc,0xffbcffbc,0xffbcffbc,0xffb9ffbb,0xffb9ffb9,0xffb5ffb7,0xffb4ffb4,0xffb6ffb5,0xffb8ffb8,0xffb7ffb8,0xffb3ffb5,0xffaeffb1,0xffa6ffaa,0xff9affa1,0x4586ff90,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xa2820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff85,0xff90ff8d,0xff95ff93,0xff9bff98,0xffa1ff9e,0xffa7ffa4,0xffadffaa,0xffb2ffb0,0xffb7ffb5,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbdffbc,0xffbeffbd,0xffbeffbe,0xffbdffbe,0xffbdffbd,0xffbbffbc,0xffb8ffb9,0xffb4ffb6,0xffb2ffb3,0xffb3ffb3,
-0xffb0ffb2,0xffaaffad,0xffa1ffa6,0xff92ff9b,0x0000a887,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82b482,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff93ff90,0xff9bff98,0xffa2ff9f,0xffa9ffa5,0xffafffac,0xffb4ffb2,0xffb7ffb6,0xffb7ffb7,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffbcffbc,0xffbeffbd,0xffbfffbf,0xffc1ffc0,
-0xffc1ffc1,0xffc1ffc1,0xffc0ffc0,0xffbeffbf,0xffbcffbd,0xffb8ffb9,0xffb3ffb6,0xffacffb0,0xffa4ffa8,0xff98ff9f,0xb485ff8f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x66820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8fff8a,0xff97ff93,0xff9fff9b,0xffa6ffa3,0xffadffa9,0xffb0ffaf,0xffb1ffb0,0xffb3ffb2,0xffb4ffb3,
-0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffbfffbe,0xffc0ffc0,0xffc1ffc1,0xffc0ffc0,0xffbeffbf,0xffbbffbd,0xffb8ffb9,0xffb2ffb5,0xffaaffaf,0xff9effa5,0xff89ff95,0x00006882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x42820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8f,0xff9dff99,0xffa6ffa2,0xffacffaa,0xffadffac,0xffadffad,0xffaeffae,0xffafffaf,0xffb0ffb0,0xffb3ffb2,0xffb7ffb5,0xffb9ffb9,0xffbcffbc,0xffb9ffbb,0xffb7ffb8,0xffb5ffb6,0xffb3ffb4,0xffb0ffb1,0xffaeffaf,0xffabffad,0xffa7ffa9,0xffa6ffa5,0xffabffa8,0xffafffad,0xffb4ffb2,
-0xffb8ffb6,0xffbbffb9,0xffbbffbb,0xffb9ffbb,0xffb7ffb8,0xffb3ffb5,0xffadffb0,0xffa4ffa9,0xff93ff9d,0x00004689,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff828882,0xff82ff82,0xff82ff82,0xff85ff82,0xff90ff8b,0xff9aff95,0xffa1ff9e,0xffa3ffa2,0xffa6ffa4,0xffa8ffa7,0xffaaffa9,0xffadffab,0xffb1ffaf,0xffb5ffb3,0xffb9ffb7,0xffbbffbb,0xffb9ffb9,
-0xffb7ffb8,0xffb7ffb7,0xffb6ffb6,0xffb5ffb6,0xffb4ffb5,0xffb2ffb3,0xffb0ffb2,0xffadffaf,0xffabffac,0xffaeffac,0xffb2ffb0,0xffb5ffb3,0xffb8ffb7,0xffb9ffb9,0xffb8ffb9,0xffb5ffb7,0xffb0ffb3,0xffa9ffad,0xff9effa4,0x948aff95,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82a282,0xff82ff82,0xff82ff82,0xff85ff82,0xff90ff8b,0xff98ff93,
-0xff9cff9a,0xff9fff9d,0xffa3ffa1,0xffa7ffa5,0xffabffa9,0xffb0ffae,0xffb5ffb3,0xffb9ffb7,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb7ffb8,0xffb5ffb6,0xffb1ffb3,0xffb2ffb1,0xffb4ffb3,0xffb6ffb5,0xffb7ffb7,0xffb4ffb6,0xffafffb2,0xffa7ffab,0xff9cffa2,0x9289ff93,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xfb822182,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff85,0xff8eff8c,0xff93ff91,0xff99ff96,0xff9fff9c,0xffa5ffa2,0xffabffa8,0xffb1ffae,0xffb5ffb3,0xffb6ffb6,0xffb6ffb6,0xffb7ffb6,0xffb7ffb7,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffbbffbb,0xffbbffbb,0xffb9ffbb,0xffb9ffb9,0xffb7ffb8,0xffb4ffb5,0xffb0ffb2,0xffb0ffb0,0xffb1ffb1,
-0xffb0ffb0,0xffabffae,0xffa2ffa7,0xff95ff9c,0x1b82fb8a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x47820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff85,0xff92ff8e,0xff99ff96,0xffa0ff9d,0xffa7ffa4,0xffadffaa,0xffb3ffb0,0xffb3ffb3,0xffb4ffb4,0xffb6ffb5,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffbcffbb,0xffbdffbc,0xffbeffbd,
-0xffbeffbe,0xffbeffbe,0xffbdffbe,0xffbbffbc,0xffb8ffb9,0xffb4ffb6,0xffaeffb1,0xffa9ffab,0xffa4ffa7,0xff9affa0,0xff89ff92,0x00004382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf3822982,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff88,0xff95ff91,0xff9dff99,0xffa4ffa1,0xffabffa8,0xffadffac,0xffaeffad,0xffb0ffaf,0xffb2ffb1,
-0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffbbffbb,0xffbdffbc,0xffbeffbd,0xffbeffbe,0xffbcffbd,0xffbbffbc,0xffb7ffb9,0xffb3ffb5,0xffadffb0,0xffa4ffa9,0xff98ff9e,0xff89ff92,0x2d82f782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x92820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff85,0xff95ff90,0xff9fff9a,0xffa7ffa3,0xffa9ffa8,0xffaaffa9,0xffabffab,0xffacffac,0xffaeffad,0xffafffae,0xffb1ffb0,0xffb5ffb3,0xffb9ffb7,0xffb9ffb9,0xffb6ffb8,0xffb4ffb5,0xffb2ffb3,0xffb0ffb1,0xffadffae,0xffaaffac,0xffa7ffa9,0xffa3ffa5,0xffa5ffa3,0xffaaffa8,0xffafffac,0xffb3ffb1,
-0xffb7ffb5,0xffb9ffb9,0xffbcffbc,0xffb9ffbb,0xffb8ffb9,0xffb4ffb6,0xffaeffb1,0xffa6ffaa,0xff97ff9f,0x0000848c,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0xff82df82,0xff82ff82,0xff82ff82,0xff87ff83,0xff92ff8c,0xff9bff97,0xff9eff9d,0xffa1ffa0,0xffa4ffa2,0xffa6ffa5,0xffa9ffa7,0xffabffaa,0xffafffad,0xffb3ffb1,0xffb7ffb5,0xffb8ffb8,0xffb6ffb7,
-0xffb5ffb5,0xffb4ffb5,0xffb4ffb4,0xffb3ffb3,0xffb1ffb2,0xffafffb0,0xffadffae,0xffa9ffab,0xffaaffa9,0xffadffac,0xffb1ffaf,0xffb4ffb2,0xffb7ffb5,0xffb9ffb8,0xffb9ffb9,0xffb6ffb8,0xffb1ffb4,0xffaaffae,0xffa0ffa6,0xe78dff98,0x00000384,0x00000000,0x00000000,0x00000000,0x00000000,0x15820000,0xff82f382,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff96ff93,
-0xff9aff98,0xff9dff9c,0xffa1ff9f,0xffa5ffa3,0xffaaffa7,0xffafffac,0xffb4ffb1,0xffb8ffb6,0xffb7ffb8,0xffb6ffb7,0xffb6ffb6,0xffb7ffb6,0xffb7ffb7,0xffb7ffb7,0xffb7ffb7,0xffb6ffb7,0xffb5ffb6,0xffb3ffb4,0xffb0ffb2,0xffafffaf,0xffb1ffaf,0xffb3ffb2,0xffb4ffb4,0xffb6ffb5,0xffb4ffb6,0xffb0ffb2,0xffa8ffac,0xff9effa4,0xf18bff96,0x00000d83,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xff82a082,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff84,0xff8dff8a,0xff93ff90,0xff98ff95,0xff9dff9a,0xffa4ffa1,0xffaaffa7,0xffafffac,0xffb3ffb2,0xffb3ffb3,0xffb4ffb3,0xffb4ffb4,0xffb5ffb5,0xffb6ffb6,0xffb7ffb7,0xffb8ffb8,0xffb8ffb8,0xffb8ffb8,0xffb7ffb8,0xffb5ffb6,0xffb2ffb4,0xffafffb1,0xffaeffae,0xffafffaf,0xffafffaf,
-0xffaeffae,0xffabffad,0xffa3ffa7,0xff97ff9e,0x9c84ff8d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd5820582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff84,0xff90ff8b,0xff97ff93,0xff9fff9b,0xffa6ffa2,0xffacffa9,0xffb0ffaf,0xffb1ffb0,0xffb2ffb1,0xffb3ffb3,0xffb5ffb4,0xffb6ffb6,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffbbffbb,
-0xffbcffbc,0xffbbffbb,0xffb9ffb9,0xffb7ffb8,0xffb3ffb5,0xffafffb1,0xffaaffac,0xffa7ffa8,0xffa3ffa5,0xff9bffa0,0xff8cff93,0x0782d783,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1d820000,0xff82e182,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,0xff93ff8f,0xff9bff97,0xffa3ff9f,0xffa8ffa6,0xffaaffa9,0xffacffab,0xffaeffad,0xffb0ffaf,
-0xffb2ffb1,0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb6ffb8,0xffb3ffb5,0xffaeffb0,0xffa7ffab,0xff9dffa2,0xff95ff99,0xff8aff90,0xdf82ff84,0x00001f82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xd0820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff97ff92,0xffa0ff9c,0xffa5ffa4,0xffa6ffa6,0xffa8ffa7,0xffa9ffa9,0xffabffaa,0xffacffac,0xffaeffad,0xffafffae,0xffb3ffb1,0xffb7ffb5,0xffb6ffb7,0xffb3ffb5,0xffb1ffb2,0xffafffb0,0xffadffae,0xffaaffab,0xffa6ffa8,0xffa3ffa5,0xffa1ffa1,0xffa5ffa3,0xffaaffa8,0xffaeffac,0xffb2ffb0,
-0xffb5ffb4,0xffb9ffb7,0xffbcffbb,0xffbbffbc,0xffb9ffb9,0xffb5ffb7,0xffafffb2,0xffa7ffab,0xff99ffa1,0x0000d48e,0x00000000,0x00000000,0x00000000,0x00000000,0x48820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff93ff8e,0xff99ff97,0xff9cff9b,0xff9fff9e,0xffa2ffa0,0xffa5ffa3,0xffa7ffa6,0xffaaffa9,0xffadffab,0xffb1ffaf,0xffb5ffb3,0xffb5ffb6,0xffb3ffb4,
-0xffb3ffb3,0xffb2ffb2,0xffb1ffb2,0xffb0ffb0,0xffaeffaf,0xffabffac,0xffa8ffaa,0xffa6ffa7,0xffa9ffa7,0xffadffab,0xffb0ffaf,0xffb3ffb1,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffb6ffb8,0xffb2ffb4,0xffabffae,0xffa1ffa7,0xff8fff9a,0x00004685,0x00000000,0x00000000,0x00000000,0x00000000,0x72820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff8fff8c,0xff93ff92,
-0xff98ff96,0xff9cff9a,0xffa0ff9e,0xffa3ffa2,0xffa8ffa5,0xffadffaa,0xffb2ffaf,0xffb5ffb4,0xffb4ffb5,0xffb4ffb4,0xffb4ffb4,0xffb4ffb4,0xffb5ffb5,0xffb5ffb5,0xffb4ffb4,0xffb3ffb3,0xffb1ffb2,0xffafffb0,0xffacffad,0xffadffac,0xffb0ffae,0xffb1ffb0,0xffb3ffb2,0xffb4ffb3,0xffb4ffb4,0xffb0ffb2,0xffa9ffad,0xff9fffa5,0xff8fff99,0x00006885,0x00000000,0x00000000,
-0x00000000,0x00000000,0x2d820000,0xff82fd82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8cff89,0xff92ff8f,0xff97ff93,0xff9cff99,0xffa2ff9e,0xffa8ffa5,0xffaeffab,0xffb1ffb0,0xffb1ffb0,0xffb1ffb1,0xffb2ffb2,0xffb3ffb3,0xffb4ffb4,0xffb5ffb5,0xffb5ffb5,0xffb5ffb6,0xffb5ffb5,0xffb3ffb4,0xffb1ffb2,0xffaeffaf,0xffacffad,0xffadffad,0xffadffad,0xffadffad,
-0xffacffac,0xffa9ffab,0xffa3ffa7,0xff98ff9e,0xfd86ff90,0x00003f82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff828882,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8eff8a,0xff95ff91,0xff9dff99,0xffa4ffa0,0xffaaffa7,0xffadffac,0xffaeffae,0xffafffaf,0xffb1ffb0,0xffb3ffb2,0xffb4ffb4,0xffb6ffb5,0xffb7ffb6,0xffb8ffb8,0xffb8ffb8,
-0xffb8ffb9,0xffb7ffb8,0xffb5ffb7,0xffb3ffb4,0xffaeffb1,0xffaaffac,0xffa7ffa8,0xffa5ffa6,0xffa1ffa3,0xff9aff9e,0xff8eff95,0x8c82ff86,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xe5822782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff91ff8d,0xff99ff95,0xffa0ff9d,0xffa5ffa3,0xffa7ffa6,0xffa9ffa8,0xffacffaa,0xffaeffad,
-0xffb0ffaf,0xffb2ffb1,0xffb4ffb3,0xffb5ffb5,0xffb6ffb6,0xffb7ffb7,0xffb7ffb7,0xffb6ffb7,0xffb4ffb6,0xffb2ffb3,0xffadffb0,0xffa7ffaa,0xffa0ffa3,0xff99ff9d,0xff93ff96,0xff89ff8e,0xff82ff84,0x2582db82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xfd821d82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8eff88,0xff98ff93,0xffa0ff9d,0xffa2ffa2,0xffa4ffa3,0xffa6ffa5,0xffa8ffa7,0xffaaffa9,0xffabffaa,0xffadffac,0xffaeffad,0xffb1ffaf,0xffb5ffb3,0xffb3ffb4,0xffb1ffb2,0xffafffb0,0xffadffae,0xffaaffab,0xffa6ffa8,0xffa2ffa4,0xff9effa0,0xffa0ff9f,0xffa5ffa3,0xffaaffa7,0xffadffac,0xffb1ffaf,
-0xffb4ffb3,0xffb8ffb6,0xffbbffb9,0xffbbffbc,0xffb9ffbb,0xffb5ffb8,0xffb0ffb3,0xffa8ffac,0xff9bffa2,0x1d87fd90,0x00000000,0x00000000,0x00000000,0x00000000,0xae820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff84,0xff93ff8f,0xff97ff95,0xff9aff99,0xff9dff9c,0xffa1ff9f,0xffa4ffa2,0xffa6ffa5,0xffa9ffa8,0xffabffaa,0xffafffad,0xffb3ffb1,0xffb2ffb3,0xffb1ffb1,
-0xffb0ffb0,0xffafffb0,0xffafffaf,0xffadffae,0xffaaffac,0xffa7ffa8,0xffa4ffa5,0xffa5ffa4,0xffa9ffa7,0xffacffab,0xffafffae,0xffb2ffb1,0xffb4ffb3,0xffb6ffb5,0xffb7ffb6,0xffb6ffb7,0xffb2ffb4,0xffabffaf,0xffa2ffa7,0xff93ff9b,0x0000a888,0x00000000,0x00000000,0x00000000,0x00000000,0xdf820982,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff8dff8b,0xff92ff90,
-0xff97ff93,0xff9bff99,0xff9fff9d,0xffa2ffa1,0xffa6ffa4,0xffabffa8,0xffb0ffae,0xffb3ffb2,0xffb2ffb2,0xffb2ffb2,0xffb2ffb2,0xffb2ffb2,0xffb2ffb2,0xffb2ffb2,0xffb1ffb2,0xffafffb0,0xffadffae,0xffaaffac,0xffaaffa9,0xffacffab,0xffafffae,0xffb0ffaf,0xffb1ffb1,0xffb2ffb2,0xffb2ffb2,0xffb0ffb1,0xffa9ffad,0xffa0ffa5,0xff91ff9a,0x0782e587,0x00000000,0x00000000,
-0x00000000,0x00000000,0xd1820b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff8bff88,0xff91ff8e,0xff96ff93,0xff9bff98,0xff9fff9d,0xffa6ffa2,0xffacffa9,0xffaeffad,0xffaeffae,0xffafffaf,0xffb0ffaf,0xffb1ffb1,0xffb2ffb2,0xffb3ffb2,0xffb3ffb3,0xffb2ffb3,0xffb1ffb2,0xffafffb0,0xffacffad,0xffaaffab,0xffabffaa,0xffacffac,0xffacffac,0xffabffac,
-0xffaaffaa,0xffa7ffa8,0xffa2ffa5,0xff98ff9d,0xff88ff91,0x0782cf82,0x00000000,0x00000000,0x00000000,0x00000000,0x61820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8cff89,0xff93ff90,0xff9aff97,0xffa2ff9e,0xffa8ffa5,0xffaaffaa,0xffacffab,0xffadffac,0xffafffae,0xffb1ffb0,0xffb2ffb2,0xffb4ffb3,0xffb5ffb4,0xffb5ffb5,0xffb5ffb6,
-0xffb5ffb5,0xffb3ffb4,0xffb1ffb2,0xffadffaf,0xffa9ffab,0xffa7ffa8,0xffa6ffa7,0xffa3ffa4,0xff9fffa1,0xff99ff9c,0xff8eff93,0xff82ff86,0x00006382,0x00000000,0x00000000,0x00000000,0x17820000,0xff82df82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8eff8a,0xff96ff92,0xff9eff9a,0xffa2ffa1,0xffa4ffa3,0xffa7ffa5,0xffa9ffa8,0xffacffaa,
-0xffaeffad,0xffb0ffaf,0xffb1ffb1,0xffb3ffb2,0xffb3ffb3,0xffb4ffb4,0xffb3ffb4,0xffb2ffb3,0xffafffb1,0xffabffad,0xffa6ffa9,0xffa1ffa3,0xff9cff9e,0xff97ff99,0xff91ff93,0xff8aff8d,0xff84ff87,0xdf82ff83,0x00001382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xff826e82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff89,0xff99ff93,0xff9eff9d,0xffa0ff9f,0xffa2ffa1,0xffa4ffa3,0xffa7ffa5,0xffa9ffa8,0xffaaffa9,0xffacffab,0xffadffac,0xffafffad,0xffb2ffb1,0xffb0ffb1,0xffaeffaf,0xffacffad,0xffaaffab,0xffa7ffa9,0xffa2ffa5,0xff9effa0,0xff9cff9c,0xffa1ff9e,0xffa5ffa3,0xffa9ffa7,0xffadffab,0xffb1ffaf,
-0xffb4ffb2,0xffb6ffb5,0xffb9ffb8,0xffbbffb9,0xffb9ffbb,0xffb6ffb8,0xffb0ffb3,0xffa9ffad,0xff9dffa3,0x6a88ff93,0x00000000,0x00000000,0x00000000,0x00000000,0xf3821982,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff85,0xff91ff8f,0xff95ff93,0xff99ff97,0xff9cff9a,0xff9fff9e,0xffa3ffa1,0xffa5ffa4,0xffa8ffa7,0xffaaffa9,0xffadffab,0xffb0ffaf,0xffafffb0,0xffaeffaf,
-0xffaeffae,0xffadffad,0xffacffac,0xffaaffab,0xffa6ffa8,0xffa2ffa4,0xffa1ffa1,0xffa5ffa3,0xffa9ffa7,0xffacffaa,0xffafffad,0xffb1ffb0,0xffb3ffb2,0xffb4ffb3,0xffb5ffb5,0xffb5ffb5,0xffb2ffb4,0xffabffaf,0xffa2ffa7,0xff93ff9c,0x1d82f98a,0x00000000,0x00000000,0x00000000,0x00000000,0xff826482,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff84,0xff8cff89,0xff91ff8e,
-0xff95ff93,0xff9aff98,0xff9eff9c,0xffa1ffa0,0xffa5ffa3,0xffa9ffa7,0xffaeffab,0xffb0ffb0,0xffafffaf,0xffafffaf,0xffb0ffaf,0xffb0ffb0,0xffb0ffb0,0xffafffb0,0xffaeffaf,0xffabffad,0xffa9ffaa,0xffa7ffa7,0xffa9ffa8,0xffacffab,0xffaeffad,0xffafffae,0xffb0ffb0,0xffb0ffb0,0xffb0ffb0,0xffaeffaf,0xffa9ffac,0xffa0ffa5,0xff93ff9a,0x6e82ff89,0x00000000,0x00000000,
-0x00000000,0x01820000,0xff82a182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8bff88,0xff90ff8d,0xff95ff93,0xff9aff98,0xff9eff9c,0xffa3ffa0,0xffa9ffa6,0xffabffaa,0xffabffab,0xffadffac,0xffaeffad,0xffafffae,0xffb0ffaf,0xffb0ffb0,0xffb0ffb0,0xffafffaf,0xffacffae,0xffaaffab,0xffa8ffa8,0xffa9ffa8,0xffaaffa9,0xffaaffaa,0xffaaffaa,0xffa9ffaa,
-0xffa7ffa9,0xffa4ffa6,0xffa0ffa2,0xff96ff9c,0xff88ff90,0x9c82ff83,0x00000000,0x00000000,0x00000000,0x00000000,0xff824d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff8cff89,0xff91ff8f,0xff98ff95,0xff9fff9b,0xffa5ffa2,0xffa7ffa7,0xffa9ffa8,0xffabffaa,0xffadffac,0xffaeffae,0xffb0ffaf,0xffb1ffb1,0xffb2ffb2,0xffb2ffb2,0xffb2ffb2,
-0xffb0ffb1,0xffaeffaf,0xffabffad,0xffa8ffa9,0xffa7ffa7,0xffa6ffa6,0xffa4ffa5,0xffa1ffa2,0xff9cff9f,0xff96ff99,0xff8dff91,0xff83ff88,0x4b82fb82,0x00000000,0x00000000,0x00000000,0xbb820582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8bff88,0xff93ff8f,0xff9bff97,0xff9fff9d,0xffa1ffa0,0xffa4ffa2,0xffa7ffa5,0xffa9ffa8,
-0xffabffaa,0xffadffac,0xffafffae,0xffb0ffaf,0xffb0ffb0,0xffb0ffb0,0xffafffaf,0xffacffae,0xffa8ffaa,0xffa4ffa6,0xffa0ffa2,0xff9dff9e,0xff99ff9b,0xff95ff97,0xff92ff93,0xff90ff91,0xff8bff8e,0xff85ff88,0x0582bf82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xff82c282,0xff82ff82,0xff82ff82,0xff85ff82,0xff90ff8a,0xff99ff95,0xff9cff9b,0xff9eff9d,0xffa1ff9f,0xffa3ffa2,0xffa5ffa4,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xffacffab,0xffadffac,0xffafffae,0xffadffae,0xffabffac,0xffa9ffaa,0xffa7ffa8,0xffa3ffa5,0xff9effa1,0xff99ff9b,0xff9cff9a,0xffa1ff9e,0xffa5ffa3,0xffa9ffa7,0xffadffab,0xffb0ffae,
-0xffb3ffb1,0xffb5ffb4,0xffb8ffb6,0xffb9ffb9,0xffb9ffb9,0xffb6ffb8,0xffb0ffb3,0xffa9ffad,0xff9dffa4,0xc689ff95,0x00000000,0x00000000,0x00000000,0x00000000,0xff828e82,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff8fff8d,0xff93ff91,0xff97ff95,0xff9bff99,0xff9eff9d,0xffa2ffa0,0xffa4ffa3,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xffadffac,0xffacffac,0xffabffac,
-0xffabffab,0xffaaffaa,0xffa8ffa9,0xffa6ffa7,0xffa2ffa4,0xff9eff9f,0xffa1ff9f,0xffa5ffa3,0xffa8ffa7,0xffabffaa,0xffaeffad,0xffb0ffaf,0xffb1ffb1,0xffb2ffb2,0xffb3ffb3,0xffb3ffb3,0xffb1ffb3,0xffaaffae,0xffa2ffa6,0xff95ff9c,0x9283ff8b,0x00000000,0x00000000,0x00000000,0x13820000,0xff82eb82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff8bff88,0xff90ff8d,
-0xff93ff92,0xff99ff97,0xff9dff9b,0xffa1ff9f,0xffa4ffa2,0xffa7ffa5,0xffabffa9,0xffacffac,0xffacffac,0xffadffac,0xffadffad,0xffadffad,0xffadffad,0xffacffad,0xffaaffab,0xffa7ffa9,0xffa4ffa5,0xffa6ffa4,0xffa9ffa7,0xffabffaa,0xffadffac,0xffaeffad,0xffaeffae,0xffaeffae,0xffaeffae,0xffacffad,0xffa8ffaa,0xff9fffa4,0xff93ff9a,0xed83ff8a,0x00001982,0x00000000,
-0x00000000,0x68820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8aff87,0xff8fff8c,0xff93ff92,0xff99ff97,0xff9dff9b,0xffa1ff9f,0xffa6ffa3,0xffa7ffa7,0xffa8ffa8,0xffaaffa9,0xffabffaa,0xffacffab,0xffadffac,0xffadffad,0xffacffad,0xffaaffab,0xffa7ffa9,0xffa5ffa5,0xffa6ffa5,0xffa7ffa7,0xffa8ffa8,0xffa9ffa9,0xffa8ffa9,0xffa7ffa8,
-0xffa5ffa6,0xffa1ffa3,0xff9cff9f,0xff93ff99,0xff8bff90,0xff82ff86,0x00007382,0x00000000,0x00000000,0x23820000,0xff82f182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8bff88,0xff91ff8e,0xff96ff93,0xff9cff99,0xffa2ff9f,0xffa4ffa3,0xffa6ffa5,0xffa8ffa7,0xffaaffa9,0xffacffab,0xffadffad,0xffaeffae,0xffafffaf,0xffafffaf,0xffaeffae,
-0xffabffad,0xffa8ffaa,0xffa6ffa7,0xffa5ffa5,0xffa5ffa5,0xffa3ffa4,0xffa1ffa3,0xff9effa0,0xff99ff9c,0xff93ff97,0xff8fff92,0xff89ff8d,0xf182ff85,0x00002382,0x00000000,0x00000000,0xff827082,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff89ff86,0xff90ff8c,0xff96ff93,0xff9bff99,0xff9eff9c,0xffa0ff9f,0xffa3ffa2,0xffa6ffa5,
-0xffa8ffa7,0xffaaffa9,0xffabffab,0xffacffac,0xffacffac,0xffabffac,0xffa9ffaa,0xffa5ffa7,0xffa1ffa3,0xff9effa0,0xff9cff9d,0xff9aff9b,0xff99ff9a,0xff98ff98,0xff97ff98,0xff96ff97,0xff93ff95,0xff8cff90,0x7682ff87,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x27820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff82,0xff91ff8b,0xff97ff95,0xff9aff98,0xff9cff9b,0xff9fff9e,0xffa2ffa0,0xffa4ffa3,0xffa6ffa5,0xffa8ffa7,0xffaaffa9,0xffabffab,0xffacffab,0xffabffac,0xffa9ffaa,0xffa7ffa8,0xffa5ffa6,0xffa3ffa4,0xff9fffa1,0xff9aff9d,0xff97ff97,0xff9cff99,0xffa1ff9e,0xffa5ffa3,0xffa9ffa7,0xffacffab,0xffafffae,
-0xffb2ffb1,0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffb8ffb8,0xffb5ffb7,0xffb0ffb3,0xffa8ffac,0xff9effa4,0xfd8bff96,0x00002b83,0x00000000,0x00000000,0x27820000,0xff82fd82,0xff82ff82,0xff82ff82,0xff83ff82,0xff89ff86,0xff8eff8b,0xff92ff90,0xff96ff93,0xff99ff98,0xff9dff9b,0xffa0ff9f,0xffa3ffa2,0xffa6ffa5,0xffa8ffa7,0xffaaffa9,0xffaaffaa,0xffa8ffa9,0xffa8ffa8,
-0xffa7ffa8,0xffa6ffa7,0xffa5ffa5,0xffa2ffa3,0xff9dff9f,0xff9cff9c,0xffa0ff9e,0xffa4ffa2,0xffa8ffa6,0xffaaffa9,0xffadffac,0xffafffae,0xffb0ffaf,0xffb1ffb0,0xffb1ffb1,0xffb1ffb1,0xffafffb0,0xffa9ffac,0xffa0ffa5,0xff93ff9b,0xf783ff8c,0x00002382,0x00000000,0x00000000,0xbf820582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff89ff87,0xff8eff8c,
-0xff93ff91,0xff98ff96,0xff9cff9a,0xffa0ff9e,0xffa3ffa1,0xffa6ffa4,0xffa9ffa7,0xffa9ffa9,0xffa9ffa9,0xffaaffa9,0xffaaffaa,0xffaaffaa,0xffaaffaa,0xffa8ffa9,0xffa6ffa7,0xffa2ffa4,0xffa2ffa1,0xffa5ffa3,0xffa8ffa6,0xffaaffa9,0xffabffab,0xffacffac,0xffadffad,0xffacffad,0xffabffac,0xffa9ffaa,0xffa5ffa7,0xff9dffa2,0xff91ff97,0xff85ff8b,0x0382b982,0x00000000,
-0x00000000,0xf5822582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff89ff86,0xff8eff8b,0xff93ff91,0xff98ff96,0xff9cff9a,0xffa0ff9e,0xffa3ffa2,0xffa3ffa4,0xffa5ffa4,0xffa6ffa5,0xffa7ffa7,0xffa8ffa8,0xffa9ffa9,0xffa9ffa9,0xffa8ffa8,0xffa5ffa7,0xffa2ffa4,0xffa2ffa2,0xffa4ffa3,0xffa6ffa5,0xffa7ffa6,0xffa7ffa7,0xffa6ffa6,0xffa4ffa5,
-0xffa2ffa3,0xff9effa0,0xff9bff9c,0xff97ff99,0xff92ff95,0xff89ff8e,0x2182f583,0x00000000,0x00000000,0xc7820382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff8b,0xff90ff8d,0xff95ff92,0xff9aff97,0xff9eff9c,0xffa0ff9f,0xffa3ffa1,0xffa5ffa4,0xffa7ffa6,0xffa8ffa8,0xffaaffa9,0xffabffaa,0xffabffab,0xffaaffab,0xffa9ffaa,
-0xffa5ffa7,0xffa3ffa4,0xffa3ffa2,0xffa3ffa3,0xffa2ffa3,0xff9fffa0,0xff9effa0,0xff9cff9d,0xff99ff9b,0xff97ff98,0xff96ff97,0xff91ff93,0xff88ff8d,0x0782c983,0x00000000,0x11820000,0xff82f382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff8cff87,0xff8cff8c,0xff8dff8d,0xff90ff8f,0xff91ff92,0xff93ff91,0xff96ff95,0xff99ff98,0xff9cff9b,0xff9fff9e,0xffa2ffa1,
-0xffa4ffa3,0xffa6ffa5,0xffa7ffa6,0xffa7ffa7,0xffa7ffa7,0xffa5ffa6,0xffa2ffa4,0xff9effa1,0xff9cff9d,0xff9bff9c,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9cff9a,0xff9dff9d,0xff9cff9c,0xff99ff9b,0xff93ff97,0xf787ff8f,0x00001182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x98820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff82,0xff91ff8c,0xff95ff93,0xff98ff96,0xff9bff99,0xff9dff9c,0xffa0ff9f,0xffa3ffa2,0xffa5ffa4,0xffa7ffa6,0xffa9ffa8,0xffaaffa9,0xffabffaa,0xffa9ffaa,0xffa5ffa6,0xffa3ffa4,0xffa1ffa2,0xff9fffa0,0xff9bff9d,0xff96ff98,0xff97ff95,0xff9cff99,0xffa1ff9e,0xffa5ffa3,0xffa9ffa7,0xffacffaa,0xffafffad,
-0xffb1ffb0,0xffb3ffb2,0xffb4ffb4,0xffb6ffb5,0xffb6ffb6,0xffb4ffb6,0xffafffb2,0xffa7ffab,0xff9dffa2,0xff8cff96,0x00009683,0x00000000,0x00000000,0xc5820382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff85,0xff8cff89,0xff90ff8e,0xff93ff92,0xff98ff96,0xff9cff9a,0xff9fff9d,0xffa2ffa1,0xffa5ffa3,0xffa7ffa6,0xffa9ffa8,0xffa8ffa9,0xffa5ffa6,0xffa4ffa4,
-0xffa3ffa3,0xffa2ffa2,0xffa0ffa1,0xff9dff9e,0xff9bff9b,0xff9cff9b,0xffa0ff9e,0xffa3ffa2,0xffa7ffa5,0xffa9ffa8,0xffacffab,0xffadffad,0xffaeffae,0xffafffaf,0xffafffaf,0xffaeffae,0xffacffad,0xffa6ffa9,0xff9dffa2,0xff93ff98,0xff88ff8e,0x0382c782,0x00000000,0x00000000,0xff827082,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff88ff85,0xff8dff8b,
-0xff92ff90,0xff96ff93,0xff9bff99,0xff9eff9d,0xffa2ffa0,0xffa5ffa3,0xffa7ffa6,0xffa6ffa6,0xffa5ffa5,0xffa6ffa5,0xffa6ffa6,0xffa6ffa6,0xffa5ffa6,0xffa4ffa5,0xffa1ffa2,0xff9fff9f,0xffa1ff9f,0xffa4ffa2,0xffa6ffa5,0xffa8ffa7,0xffaaffa9,0xffabffaa,0xffabffab,0xffaaffaa,0xffa8ffa9,0xffa6ffa7,0xffa1ffa4,0xff9bff9e,0xff93ff97,0xff8aff8f,0x6a82ff85,0x00000000,
-0x00000000,0xff82bc82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff82,0xff8dff8d,0xff90ff8e,0xff8dff8e,0xff92ff8f,0xff96ff93,0xff9bff99,0xff9fff9d,0xffa1ffa0,0xffa1ffa1,0xffa1ffa1,0xffa2ffa1,0xffa3ffa2,0xffa4ffa4,0xffa4ffa4,0xffa4ffa4,0xffa2ffa3,0xffa1ffa2,0xffa0ffa0,0xffa1ffa0,0xffa2ffa2,0xffa4ffa3,0xffa4ffa4,0xffa4ffa4,0xffa2ffa4,0xff9fff9f,
-0xff9dff9e,0xff9eff9e,0xff9eff9e,0xff9dff9e,0xff99ff9c,0xff91ff96,0xb084ff8b,0x00000000,0x00000000,0xff825882,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff82,0xff8dff8c,0xff8eff8d,0xff91ff93,0xff8fff8c,0xff93ff91,0xff98ff96,0xff9cff9b,0xff9dff9c,0xff9eff9d,0xffa1ff9f,0xffa3ffa2,0xffa4ffa4,0xffa6ffa5,0xffa6ffa6,0xffa6ffa6,0xffa5ffa6,0xffa3ffa4,
-0xffa0ffa2,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xff9fffa0,0xff9bff9d,0xff9cff9c,0xff9bff9b,0xff9eff9c,0xff9dff9e,0xff9cff9d,0xff99ff9b,0xff90ff95,0x5683ff89,0x00000000,0x86820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff8cff87,0xff97ff92,0xff97ff97,0xff98ff97,0xff98ff98,0xff93ff98,0xff93ff91,0xff93ff93,0xff96ff95,0xff98ff97,0xff9bff99,0xff9dff9c,
-0xff9fff9e,0xffa0ffa0,0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,0xff9fffa0,0xff9dff9e,0xff9cff9d,0xff9cff9b,0xff9aff9b,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9cff9a,0xff9fff9d,0xffa1ffa2,0xff9fffa0,0xff9aff9d,0xff8fff97,0x00007e87,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xf7822782,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8c,0xff93ff91,0xff96ff93,0xff99ff97,0xff9cff9a,0xff9fff9d,0xffa1ffa0,0xffa4ffa3,0xffa6ffa5,0xffa7ffa7,0xffa9ffa8,0xffa9ffa9,0xffa7ffa9,0xffa2ffa4,0xff9fffa0,0xff9cff9e,0xff99ff9b,0xff96ff97,0xff95ff95,0xff97ff96,0xff9bff99,0xffa0ff9e,0xffa4ffa2,0xffa8ffa6,0xffabffa9,0xffaeffac,
-0xffb0ffaf,0xffb2ffb1,0xffb3ffb2,0xffb4ffb3,0xffb4ffb4,0xffb2ffb3,0xffacffaf,0xffa5ffa9,0xff9bffa0,0xff8cff93,0x2582f584,0x00000000,0x00000000,0xff826682,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff83,0xff91ff90,0xff8eff90,0xff92ff90,0xff97ff95,0xff9aff98,0xff9dff9c,0xffa0ff9f,0xffa3ffa2,0xffa5ffa4,0xffa7ffa6,0xffa6ffa7,0xffa2ffa4,0xffa0ffa1,
-0xff9eff9f,0xff9cff9d,0xff9aff9b,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xff9fff9d,0xffa2ffa1,0xffa5ffa4,0xffa8ffa7,0xffaaffa9,0xffabffab,0xffacffac,0xffacffac,0xffa8ffac,0xffa4ffa4,0xffa7ffa6,0xffa3ffa6,0xff9dffa1,0xff97ff9a,0xff8eff93,0x5a82ff88,0x00000000,0x15820000,0xff82f382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff8dff87,0xff90ff8e,0xff8cff8d,
-0xff91ff8e,0xff95ff93,0xff99ff97,0xff9dff9b,0xffa0ff9f,0xffa3ffa2,0xffa5ffa5,0xffa3ffa5,0xffa2ffa2,0xffa1ffa1,0xffa2ffa1,0xffa1ffa2,0xffa0ffa1,0xff9fff9f,0xff9eff9e,0xff9eff9e,0xffa0ff9e,0xffa2ffa1,0xffa5ffa4,0xffa7ffa6,0xffa8ffa7,0xffa8ffa8,0xffa8ffa8,0xffa5ffa8,0xffa1ffa2,0xffa1ffa0,0xffa0ffa2,0xff9dff9f,0xff9aff9c,0xff93ff97,0xf185ff8d,0x00001582,
-0x31820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff82,0xff92ff8d,0xff98ff98,0xff98ff98,0xff8cff92,0xff91ff8f,0xff95ff92,0xff99ff97,0xff9dff9b,0xffa0ff9e,0xff9fffa0,0xff9eff9f,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9eff9f,0xff9eff9e,0xffa0ff9f,0xffa1ffa1,0xffa1ffa1,0xffa2ffa2,0xff9fffa2,0xff9bff9b,
-0xff9bff9b,0xff9eff9c,0xffa3ffa1,0xffa3ffa3,0xffa0ffa2,0xff99ff9d,0xfd8bff93,0x00002d84,0x03820000,0xff82db82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff82,0xff92ff8c,0xff98ff97,0xff98ff98,0xff92ff98,0xff8fff8d,0xff93ff91,0xff97ff95,0xff9aff99,0xff9bff9b,0xff9bff9b,0xff9dff9c,0xff9eff9d,0xff9fff9f,0xffa0ffa0,0xffa1ffa1,0xffa1ffa1,0xffa0ffa0,0xff9fffa0,
-0xff9eff9f,0xff9dff9d,0xff9eff9d,0xff9fff9e,0xff9fff9f,0xff9aff9d,0xff9bff9a,0xff9bff9b,0xff9eff9c,0xffa3ffa0,0xffa1ffa2,0xff9fffa0,0xff98ff9c,0xdf88ff91,0x00000183,0xe5820382,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff82,0xff97ff92,0xff97ff97,0xff98ff97,0xff98ff98,0xff98ff98,0xff96ff98,0xff96ff93,0xff96ff96,0xff97ff96,0xff98ff97,0xff99ff99,0xff9bff9a,
-0xff9cff9b,0xff9dff9d,0xff9eff9e,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9eff9f,0xff9eff9e,0xffa0ff9e,0xff9aff9d,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xff9dff9b,0xffa6ffa3,0xffa4ffa5,0xffa0ffa3,0xff97ff9d,0x0585e18e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff82b482,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8b,0xff90ff92,0xff93ff92,0xff97ff95,0xff9aff98,0xff9dff9c,0xffa0ff9e,0xffa2ffa1,0xffa4ffa3,0xffa6ffa5,0xffa7ffa6,0xffa7ffa7,0xffa5ffa7,0xffa0ffa2,0xff9bff9d,0xff96ff99,0xff93ff95,0xff93ff93,0xff95ff95,0xff96ff95,0xff9bff98,0xff9fff9d,0xffa3ffa1,0xffa7ffa5,0xffaaffa8,0xffacffab,
-0xffaeffad,0xffb0ffaf,0xffb1ffb0,0xffb1ffb1,0xffacffb1,0xffafffab,0xffa9ffac,0xffa2ffa6,0xff9aff9e,0xff90ff96,0xb883ff89,0x00000000,0x01820000,0xff82d982,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff82,0xff93ff8d,0xff98ff98,0xff8cff92,0xff91ff8e,0xff95ff93,0xff98ff96,0xff9cff9a,0xff9fff9d,0xffa1ffa0,0xffa3ffa2,0xffa5ffa4,0xffa4ffa5,0xffa0ffa2,0xff9dff9e,
-0xff99ff9b,0xff98ff98,0xff97ff97,0xff99ff98,0xff99ff99,0xff9aff99,0xff9dff9b,0xffa1ff9f,0xffa4ffa2,0xffa6ffa5,0xffa8ffa7,0xffa9ffa9,0xffaaffa9,0xffa9ffaa,0xffa2ffa9,0xff9cff9c,0xffa1ff9e,0xffa5ffa3,0xffa2ffa4,0xff9effa0,0xff96ff9a,0xdb86ff8f,0x00000382,0x82820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff8dff87,0xff98ff92,0xff98ff98,0xff8bff91,
-0xff8fff8d,0xff93ff91,0xff97ff95,0xff9bff99,0xff9eff9d,0xffa1ffa0,0xffa3ffa3,0xffa2ffa3,0xffa0ffa1,0xff9eff9e,0xff9cff9d,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9dff9c,0xff9cff9d,0xff9eff9d,0xffa1ff9f,0xffa3ffa2,0xffa4ffa4,0xffa5ffa5,0xffa5ffa5,0xffa5ffa5,0xffa0ffa5,0xff9bff9b,0xff9dff9b,0xffa1ff9f,0xffa4ffa4,0xffa0ffa2,0xff9aff9d,0xff8dff95,0x00008c85,
-0x96820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff82,0xff92ff8d,0xff98ff98,0xff98ff98,0xff98ff98,0xff8fff93,0xff92ff90,0xff95ff93,0xff99ff97,0xff9cff9a,0xff9eff9d,0xff9dff9e,0xff9dff9d,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9dff9c,0xff9dff9d,0xff9dff9d,0xff9cff9d,0xff9dff9c,0xff9fff9e,0xffa1ffa0,0xffa2ffa1,0xffa4ffa3,0xffa0ffa5,0xff9bff9b,
-0xff9bff9b,0xff9bff9b,0xffa1ff9e,0xffa8ffa4,0xffa6ffa7,0xff9fffa3,0xff93ff9a,0x00009889,0x46820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff92ff87,0xff98ff97,0xff98ff98,0xff98ff98,0xff93ff98,0xff91ff90,0xff93ff93,0xff97ff96,0xff9aff99,0xff9aff9a,0xff9aff9a,0xff9bff9b,0xff9bff9b,0xff9cff9c,0xff9dff9d,0xff9eff9e,0xff9eff9e,0xff9fff9f,0xff9eff9f,
-0xff9dff9e,0xff9dff9d,0xff9fff9e,0xffa2ffa0,0xffa1ffa3,0xff9bff9c,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xffa4ff9e,0xffa6ffa7,0xffa5ffa6,0xff9fffa3,0xff8fff99,0x00004287,0xff824082,0xff82ff82,0xff82ff82,0xff82ff82,0xff92ff87,0xff97ff97,0xff98ff97,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff99ff98,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xff9cff9c,0xff9dff9d,
-0xff9fff9e,0xffa0ff9f,0xffa1ffa0,0xffa2ffa1,0xffa2ffa2,0xffa3ffa2,0xffa2ffa2,0xffa2ffa2,0xffa4ffa2,0xff9aff9f,0xff9aff9a,0xff9bff9a,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xffa6ff9e,0xffa9ffaa,0xffa5ffa8,0xff9effa3,0x408cff95,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x35820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff83,0xff95ff91,0xff91ff96,0xff91ff8f,0xff95ff93,0xff98ff96,0xff9bff9a,0xff9eff9c,0xffa0ff9f,0xffa2ffa1,0xffa4ffa3,0xffa5ffa4,0xffa5ffa5,0xffa3ffa4,0xff9dffa0,0xff98ff9b,0xff95ff96,0xff93ff93,0xff93ff93,0xff95ff93,0xff95ff95,0xff9aff97,0xff9eff9c,0xffa2ffa0,0xffa5ffa4,0xffa8ffa7,0xffaaffa9,
-0xffacffab,0xffadffad,0xffaeffae,0xffaeffae,0xffa1ffa9,0xffa4ffa0,0xffa8ffa6,0xffa3ffa5,0xff9effa1,0xff97ff9b,0xff89ff91,0x00003182,0x3e820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff93ff88,0xff98ff98,0xff98ff98,0xff8cff92,0xff90ff8e,0xff93ff92,0xff96ff95,0xff99ff98,0xff9cff9b,0xff9eff9d,0xffa0ff9f,0xffa2ffa1,0xffa1ffa2,0xff9fffa0,0xff9cff9d,
-0xff9aff9b,0xff99ff99,0xff99ff98,0xff99ff99,0xff98ff99,0xff98ff97,0xff9bff99,0xff9eff9d,0xffa1ffa0,0xffa4ffa3,0xffa6ffa5,0xffa7ffa6,0xffa8ffa8,0xffa9ffa8,0xffa2ffa9,0xff9cff9c,0xff9cff9c,0xffa6ff9f,0xffa8ffaa,0xffa4ffa6,0xff9dffa1,0xff8dff97,0x00004285,0xe7820782,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff82,0xff98ff92,0xff98ff98,0xff98ff98,0xff8cff92,
-0xff8fff8e,0xff93ff91,0xff97ff95,0xff9aff98,0xff9cff9b,0xff9fff9e,0xffa1ffa0,0xff9fffa0,0xff9eff9e,0xff9cff9d,0xff9bff9c,0xff9aff9a,0xff9bff9a,0xff9bff9b,0xff9bff9b,0xff9aff9b,0xff9cff9a,0xff9eff9d,0xffa1ffa0,0xffa3ffa2,0xffa4ffa4,0xffa5ffa5,0xffa6ffa6,0xff9effa3,0xff9cff9c,0xff9cff9c,0xff9fff9c,0xffaaffa6,0xffa6ffa8,0xffa0ffa4,0xff95ff9c,0x0387e78b,
-0xeb820582,0xff82ff82,0xff82ff82,0xff82ff82,0xff92ff87,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff92ff95,0xff95ff93,0xff98ff97,0xff9bff9a,0xff9dff9c,0xff9fff9e,0xff9eff9f,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9fff9e,0xff9fff9f,0xff9fff9f,0xff9eff9f,0xff9dff9e,0xff9fff9d,0xffa2ffa0,0xffa4ffa3,0xffa7ffa5,0xffa9ffa8,0xffa3ffa9,0xff9bff9b,
-0xff9bff9b,0xff9cff9b,0xff9cff9c,0xffa8ff9f,0xffabffad,0xffa5ffa9,0xff9bffa1,0x0389e990,0x92820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff82,0xff98ff92,0xff98ff98,0xff98ff98,0xff98ff98,0xff96ff98,0xff95ff93,0xff98ff96,0xff9bff99,0xff9dff9c,0xff9dff9d,0xff9cff9c,0xff9dff9d,0xff9dff9d,0xff9eff9e,0xff9fff9f,0xffa0ffa0,0xffa0ffa0,0xffa1ffa0,0xffa0ffa0,
-0xffa0ffa0,0xffa0ff9f,0xffa3ffa2,0xffa6ffa5,0xffa1ffa7,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9fff9b,0xffabffa7,0xffaaffab,0xffa5ffa8,0xff98ffa0,0x0000988e,0xff828682,0xff82ff82,0xff82ff82,0xff82ff82,0xff97ff8c,0xff98ff97,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff9bff99,0xff9eff9e,0xff9eff9e,0xff9fff9e,0xffa0ff9f,0xffa1ffa0,
-0xffa2ffa2,0xffa3ffa3,0xffa4ffa4,0xffa5ffa5,0xffa6ffa6,0xffa6ffa6,0xffa6ffa6,0xffa6ffa6,0xffa4ffa7,0xff9aff9e,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xffa0ff9b,0xffadffa9,0xffaaffac,0xffa4ffa7,0x8292ff9c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x9a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff82,0xff93ff8e,0xff98ff98,0xff93ff98,0xff90ff8e,0xff93ff91,0xff95ff93,0xff98ff97,0xff9bff9a,0xff9dff9c,0xff9fff9e,0xffa1ffa0,0xffa2ffa1,0xffa3ffa2,0xffa1ffa2,0xff9dff9f,0xff9aff9b,0xff98ff99,0xff97ff98,0xff96ff96,0xff95ff95,0xff93ff93,0xff98ff96,0xff9cff9a,0xffa0ff9e,0xffa3ffa1,0xffa6ffa4,0xffa8ffa7,
-0xffa9ffa9,0xffaaffaa,0xffabffab,0xffabffab,0xff9cffa4,0xff9cff9c,0xffa2ff9f,0xffa9ffa6,0xffa4ffa7,0xff9effa2,0xff91ff98,0x00009687,0x9c820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff82,0xff98ff93,0xff98ff98,0xff98ff98,0xff91ff96,0xff92ff91,0xff95ff93,0xff98ff96,0xff9aff99,0xff9cff9b,0xff9fff9e,0xffa1ffa0,0xffa2ffa1,0xffa2ffa3,0xffa0ffa1,0xff9fff9f,
-0xff9eff9e,0xff9dff9d,0xff9cff9d,0xff9bff9c,0xff9aff9a,0xff99ff98,0xff9cff9a,0xff9fff9e,0xffa2ffa1,0xffa5ffa3,0xffa7ffa6,0xffa9ffa8,0xffaaffaa,0xffacffab,0xffa0ffa8,0xff9cff9c,0xff9cff9c,0xffa1ff9c,0xffaeffaa,0xffaaffac,0xffa3ffa7,0xff96ff9e,0x0000948c,0xff824282,0xff82ff82,0xff82ff82,0xff82ff82,0xff92ff87,0xff98ff98,0xff98ff98,0xff98ff98,0xff91ff95,
-0xff93ff91,0xff96ff93,0xff98ff97,0xff9bff9a,0xff9dff9c,0xff9fff9e,0xffa1ffa0,0xffa0ffa1,0xff9fff9f,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9dff9e,0xff9cff9d,0xff9bff9c,0xff9dff9b,0xff9fff9e,0xffa2ffa1,0xffa5ffa4,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xff9cffa3,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xffa9ffa0,0xffacffae,0xffa6ffaa,0xff9cffa2,0x468aff92,
-0xff823082,0xff82ff82,0xff82ff82,0xff82ff82,0xff98ff8d,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff96ff97,0xff98ff97,0xff9cff9a,0xff9eff9d,0xffa1ffa0,0xffa3ffa2,0xffa2ffa3,0xffa2ffa2,0xffa2ffa2,0xffa2ffa2,0xffa2ffa2,0xffa3ffa2,0xffa3ffa3,0xffa3ffa3,0xffa2ffa3,0xffa1ffa2,0xffa3ffa1,0xffa6ffa4,0xffa9ffa7,0xffabffaa,0xffadffac,0xffa0ffa9,0xff9cff9b,
-0xff9cff9c,0xff9cff9c,0xff9cff9c,0xffa7ff9c,0xffb1ffb1,0xffabffaf,0xffa1ffa7,0x2a8eff96,0xd0820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff92ff87,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff9bff9a,0xff9eff9d,0xffa1ffa0,0xffa0ffa1,0xffa0ffa0,0xffa1ffa0,0xffa1ffa1,0xffa2ffa2,0xffa3ffa3,0xffa4ffa3,0xffa4ffa4,0xffa4ffa4,0xffa4ffa4,
-0xffa3ffa4,0xffa5ffa4,0xffa8ffa6,0xffaaffa9,0xff9fffa7,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xffaaffa0,0xffaeffaf,0xffaaffad,0xff9fffa6,0x0000d293,0xff82a882,0xff82ff82,0xff82ff82,0xff87ff82,0xff98ff92,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff9aff98,0xff9fff9c,0xffa2ffa1,0xffa2ffa2,0xffa3ffa3,0xffa5ffa4,
-0xffa6ffa5,0xffa7ffa6,0xffa8ffa8,0xffa9ffa9,0xffaaffa9,0xffaaffaa,0xffaaffaa,0xffa1ffa5,0xff9effa2,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xffb2ffa7,0xffaeffb0,0xffa8ffac,0xa298ffa2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xe7820582,0xff82ff82,0xff82ff82,0xff82ff82,0xff92ff87,0xff98ff98,0xff98ff98,0xff93ff98,0xff91ff90,0xff93ff92,0xff96ff93,0xff98ff97,0xff9bff9a,0xff9dff9c,0xff9fff9e,0xffa1ffa0,0xffa2ffa1,0xffa3ffa3,0xffa3ffa4,0xffa0ffa2,0xff9eff9f,0xff9dff9e,0xff9cff9c,0xff9aff9b,0xff98ff99,0xff96ff96,0xff9aff98,0xff9dff9b,0xffa1ff9f,0xffa3ffa2,0xffa6ffa5,0xffa8ffa7,
-0xffaaffa9,0xffabffaa,0xffacffac,0xffaeffad,0xff9dffa5,0xff9dff9d,0xff9dff9d,0xffa9ffa1,0xffaaffad,0xffa4ffa8,0xff98ff9f,0x0586e78e,0xd0820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff93ff87,0xff98ff98,0xff98ff98,0xff99ff98,0xff96ff99,0xff95ff93,0xff98ff97,0xff9bff99,0xff9dff9c,0xffa0ff9f,0xffa2ffa1,0xffa4ffa3,0xffa6ffa5,0xffa6ffa7,0xffa4ffa5,0xffa3ffa4,
-0xffa2ffa2,0xffa1ffa2,0xffa0ffa1,0xff9fffa0,0xff9eff9f,0xff9dff9d,0xffa0ff9f,0xffa3ffa2,0xffa6ffa5,0xffa9ffa8,0xffabffaa,0xffadffac,0xffafffae,0xffb0ffb0,0xff9cffa7,0xff9cff9c,0xff9cff9c,0xff9dff9d,0xffadffa2,0xffafffb2,0xffa9ffac,0xff9dffa4,0x0000d492,0xff828282,0xff82ff82,0xff82ff82,0xff87ff82,0xff98ff92,0xff98ff98,0xff98ff98,0xff98ff98,0xff97ff98,
-0xff96ff95,0xff99ff97,0xff9cff9a,0xff9fff9d,0xffa1ffa0,0xffa3ffa2,0xffa5ffa4,0xffa4ffa5,0xffa3ffa3,0xffa2ffa3,0xffa2ffa2,0xffa2ffa2,0xffa2ffa2,0xffa1ffa2,0xffa0ffa1,0xff9fffa0,0xffa1ff9f,0xffa4ffa2,0xffa7ffa5,0xffa9ffa8,0xffacffaa,0xffaeffad,0xffaaffaf,0xff9cffa0,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xffa1ff9c,0xffb1ffac,0xffacffaf,0xffa2ffa8,0x8090ff9a,
-0xff825c82,0xff82ff82,0xff82ff82,0xff87ff82,0xff98ff92,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff99,0xff9cff99,0xff9fff9d,0xffa2ffa0,0xffa4ffa3,0xffa6ffa5,0xffa6ffa7,0xffa5ffa6,0xffa6ffa5,0xffa6ffa6,0xffa6ffa6,0xffa6ffa6,0xffa7ffa7,0xffa7ffa7,0xffa6ffa6,0xffa5ffa6,0xffa7ffa5,0xffaaffa8,0xffadffab,0xffafffae,0xffabffb0,0xff9cffa1,0xff9cff9c,
-0xff9cff9c,0xff9cff9c,0xff9cff9c,0xffa2ff9c,0xffb5ffb5,0xffb0ffb3,0xffa6ffac,0x5893ff9d,0xfd820d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff98ff8d,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff99ff98,0xff9eff9c,0xffa1ffa0,0xffa4ffa3,0xffa4ffa4,0xffa4ffa4,0xffa4ffa4,0xffa5ffa5,0xffa6ffa5,0xffa7ffa6,0xffa7ffa7,0xffa8ffa8,0xffa8ffa8,0xffa8ffa8,
-0xffa7ffa8,0xffa9ffa8,0xffacffab,0xffa9ffad,0xff9bffa0,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9cff9c,0xff9cff9c,0xffa5ff9c,0xffb2ffb3,0xffafffb1,0xffa4ffab,0x0f90fd9a,0xff82d082,0xff82ff82,0xff82ff82,0xff8dff82,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff99ff98,0xff99ff99,0xff9bff99,0xff9eff9e,0xffa6ffa2,0xffa7ffa6,0xffa8ffa7,
-0xffa9ffa9,0xffaaffaa,0xffacffab,0xffadffac,0xffadffad,0xffa8ffad,0xffa3ffa3,0xff9bff9f,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9cff9c,0xffb6ffa9,0xffb2ffb4,0xffacffb0,0xce9cffa6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff822e82,0xff82ff82,0xff82ff82,0xff82ff82,0xff98ff8d,0xff98ff98,0xff99ff98,0xff97ff99,0xff93ff93,0xff96ff95,0xff99ff98,0xff9bff9a,0xff9eff9d,0xffa0ff9f,0xffa2ffa1,0xffa4ffa3,0xffa6ffa5,0xffa7ffa7,0xffa7ffa8,0xffa5ffa6,0xffa3ffa4,0xffa1ffa2,0xffa0ffa1,0xff9eff9f,0xff9cff9d,0xff9bff9b,0xff9eff9d,0xffa2ffa0,0xffa5ffa3,0xffa7ffa6,0xffaaffa9,0xffacffab,
-0xffaeffad,0xffb0ffaf,0xffb1ffb0,0xffacffb2,0xff9dffa2,0xff9dff9d,0xff9dff9d,0xffa8ff9d,0xffb0ffb2,0xffa9ffad,0xff9fffa5,0x2c8bff93,0xfb820b82,0xff82ff82,0xff82ff82,0xff83ff82,0xff98ff8e,0xff98ff98,0xff98ff98,0xff99ff99,0xff98ff99,0xff98ff97,0xff9bff9a,0xff9eff9d,0xffa1ff9f,0xffa3ffa2,0xffa6ffa5,0xffa8ffa7,0xffa9ffa9,0xffaaffaa,0xffa8ffa9,0xffa7ffa8,
-0xffa6ffa7,0xffa5ffa6,0xffa5ffa5,0xffa3ffa4,0xffa2ffa3,0xffa1ffa1,0xffa5ffa3,0xffa8ffa6,0xffabffa9,0xffadffac,0xffb0ffae,0xffb2ffb1,0xffb3ffb3,0xffaeffb4,0xff9cffa2,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffa9ff9d,0xffb4ffb7,0xffaeffb1,0xffa3ffa9,0x0790f798,0xff82a682,0xff82ff82,0xff82ff82,0xff8dff82,0xff98ff98,0xff98ff98,0xff98ff98,0xff99ff98,0xff99ff99,
-0xff99ff98,0xff9cff9b,0xff9fff9e,0xffa2ffa1,0xffa4ffa3,0xffa7ffa6,0xffa9ffa8,0xffa8ffa9,0xffa7ffa7,0xffa6ffa6,0xffa6ffa6,0xffa6ffa6,0xffa6ffa6,0xffa5ffa5,0xffa4ffa5,0xffa3ffa3,0xffa5ffa3,0xffa8ffa6,0xffabffaa,0xffaeffac,0xffb0ffaf,0xffb2ffb1,0xffa8ffb3,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xffb6ffb1,0xffb1ffb4,0xffa8ffad,0xa696ffa0,
-0xff827082,0xff82ff82,0xff82ff82,0xff8dff82,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff99ff99,0xff99ff99,0xff9dff9a,0xffa2ffa0,0xffa5ffa3,0xffa8ffa6,0xffaaffa9,0xffaaffaa,0xffa9ffa9,0xffa9ffa9,0xffa9ffa9,0xffaaffaa,0xffaaffaa,0xffaaffaa,0xffaaffaa,0xffaaffaa,0xffa9ffa9,0xffabffaa,0xffaeffad,0xffb1ffaf,0xffb3ffb2,0xffa2ffae,0xff9cff9c,0xff9cff9c,
-0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xffb9ffb1,0xffb5ffb8,0xffabffb1,0x7498ffa3,0xff822282,0xff82ff82,0xff82ff82,0xff82ff82,0xff98ff8d,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff99ff98,0xff99ff99,0xff9cff9a,0xffa5ffa0,0xffa7ffa6,0xffa8ffa8,0xffa7ffa7,0xffa8ffa8,0xffa8ffa8,0xffa9ffa9,0xffaaffaa,0xffabffab,0xffacffab,0xffacffac,0xffacffac,
-0xffabffab,0xffadffac,0xffaaffaf,0xffa0ffa5,0xff9bff9b,0xff9bff9b,0xff9cff9b,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9eff9c,0xffb6ffb7,0xffb3ffb5,0xffa9ffaf,0x2493ff9d,0xff82d682,0xff82ff82,0xff82ff82,0xff8dff82,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff99ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xffa5ff9d,0xffaaffa9,0xffabffab,
-0xffadffac,0xffaeffad,0xffafffae,0xffb0ffaf,0xffb1ffb0,0xffa0ffab,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9cff9b,0xff9cff9c,0xff9cff9c,0xffb9ffa5,0xffb6ffb8,0xffb0ffb3,0xd0a0ffaa,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff825682,0xff82ff82,0xff82ff82,0xff88ff82,0xff98ff93,0xff99ff98,0xff99ff99,0xff99ff99,0xff97ff98,0xff9aff98,0xff9cff9b,0xff9fff9d,0xffa1ffa0,0xffa4ffa2,0xffa6ffa5,0xffa8ffa7,0xffaaffa9,0xffabffaa,0xffabffac,0xffa9ffaa,0xffa7ffa8,0xffa6ffa6,0xffa4ffa5,0xffa2ffa3,0xffa0ffa1,0xff9fff9f,0xffa3ffa1,0xffa6ffa4,0xffa9ffa8,0xffacffaa,0xffaeffad,0xffb0ffaf,
-0xffb2ffb1,0xffb4ffb3,0xffb5ffb5,0xffa3ffb4,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffa3ff9d,0xffb5ffb6,0xffafffb2,0xffa4ffaa,0x5a91ff9b,0xff821682,0xff82ff82,0xff82ff82,0xff89ff82,0xff98ff93,0xff98ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff9bff99,0xff9eff9d,0xffa1ffa0,0xffa4ffa3,0xffa7ffa5,0xffa9ffa8,0xffabffaa,0xffadffac,0xffaeffae,0xffacffad,0xffabffac,
-0xffaaffab,0xffa9ffaa,0xffa9ffa9,0xffa7ffa8,0xffa5ffa7,0xffa5ffa5,0xffa9ffa7,0xffacffab,0xffafffad,0xffb1ffb0,0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xff9effb2,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffa0ff9d,0xffb9ffbb,0xffb3ffb6,0xffa8ffae,0x2492ff9c,0xff82ca82,0xff82ff82,0xff82ff82,0xff8eff83,0xff98ff98,0xff98ff98,0xff98ff98,0xff99ff99,0xff99ff99,
-0xff9aff99,0xff9fff9c,0xffa2ffa1,0xffa5ffa4,0xffa8ffa6,0xffaaffa9,0xffacffab,0xffacffac,0xffabffab,0xffaaffaa,0xffaaffaa,0xffaaffaa,0xffa9ffaa,0xffa9ffa9,0xffa8ffa9,0xffa7ffa7,0xffa9ffa7,0xffacffab,0xffafffae,0xffb2ffb1,0xffb4ffb3,0xffb6ffb5,0xffa2ffa9,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9dff9d,0xff9dff9d,0xffbbffaa,0xffb6ffb9,0xffacffb2,0xc89affa5,
-0xff828082,0xff82ff82,0xff82ff82,0xff8dff82,0xff98ff98,0xff98ff98,0xff98ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff9bff99,0xffa2ff9d,0xffa8ffa6,0xffabffa9,0xffadffac,0xffadffae,0xffadffad,0xffadffad,0xffadffad,0xffadffad,0xffaeffae,0xffaeffae,0xffaeffae,0xffadffae,0xffadffad,0xffafffad,0xffb2ffb0,0xffb5ffb3,0xffa8ffb3,0xff9cff9d,0xff9cff9c,0xff9cff9c,
-0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9dff9d,0xffbcffb1,0xffb9ffbb,0xffafffb5,0x8a9bffa7,0xff822c82,0xff82ff82,0xff82ff82,0xff87ff82,0xff98ff92,0xff98ff98,0xff98ff98,0xff98ff98,0xff99ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xffa0ff9c,0xffa1ffa0,0xffa6ffa1,0xffabffab,0xffabffab,0xffacffac,0xffadffac,0xffaeffad,0xffaeffae,0xffafffaf,0xffafffaf,0xffaaffaf,
-0xffa4ffa4,0xffa5ffa4,0xffa1ffa6,0xff9bff9b,0xff9cff9b,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xffb9ffb9,0xffb6ffb8,0xffadffb3,0x2c98ffa2,0xff82d082,0xff82ff82,0xff82ff82,0xff8dff82,0xff98ff98,0xff98ff98,0xff98ff98,0xff98ff98,0xff99ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xffa3ff99,0xffadffad,0xffaeffae,
-0xffb0ffaf,0xffb1ffb0,0xffb2ffb2,0xffb3ffb3,0xffb4ffb4,0xff9bffac,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9cff9b,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xffbcffa8,0xffb9ffbb,0xffb3ffb6,0xd0a3ffad,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff827882,0xff82ff82,0xff82ff82,0xff8eff82,0xff98ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9cff9a,0xff9fff9e,0xffa2ffa0,0xffa4ffa3,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xffadffac,0xffafffae,0xffafffaf,0xffadffae,0xffabffac,0xffaaffaa,0xffa8ffa9,0xffa6ffa7,0xffa4ffa5,0xffa3ffa3,0xffa7ffa5,0xffaaffa9,0xffadffac,0xffb0ffaf,0xffb2ffb1,0xffb5ffb4,
-0xffb7ffb6,0xffb8ffb7,0xffb7ffb9,0xff9dffa2,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffb9ffb3,0xffb3ffb7,0xffa9ffaf,0x6e96ffa0,0xff822c82,0xff82ff82,0xff82ff82,0xff8fff83,0xff98ff98,0xff99ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff99,0xff9fff9c,0xffa4ffa3,0xffa7ffa6,0xffaaffa8,0xffacffab,0xffaeffad,0xffb0ffaf,0xffb1ffb1,0xffb0ffb1,0xffafffaf,
-0xffaeffae,0xffadffad,0xffacffad,0xffabffac,0xffa9ffaa,0xffa9ffa8,0xffadffab,0xffb0ffae,0xffb3ffb1,0xffb5ffb4,0xffb8ffb7,0xffb9ffb9,0xffafffbb,0xff9dff9e,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffbdffbe,0xffb7ffbb,0xffacffb2,0x2e96ffa0,0xff82d482,0xff82ff82,0xff83ff82,0xff8fff85,0xff98ff98,0xff98ff98,0xff99ff99,0xff99ff99,0xff99ff99,
-0xff99ff99,0xffa0ff9b,0xffa5ffa4,0xffa8ffa7,0xffabffaa,0xffadffac,0xffafffae,0xffafffb0,0xffaeffaf,0xffaeffae,0xffadffae,0xffadffad,0xffadffad,0xffadffad,0xffacffac,0xffaaffab,0xffadffab,0xffb0ffaf,0xffb3ffb2,0xffb6ffb5,0xffb8ffb7,0xffa6ffb6,0xff9cff9c,0xff9cff9c,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffbfffa8,0xffb9ffbd,0xffb1ffb6,0xd09fffa9,
-0xff827482,0xff82ff82,0xff82ff82,0xff8eff82,0xff98ff98,0xff98ff98,0xff99ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9dff99,0xffa1ffa1,0xffa8ffa2,0xffb0ffaf,0xffb1ffb1,0xffb0ffb0,0xffb0ffb0,0xffb0ffb0,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffb0ffb0,0xffb3ffb1,0xffa8ffad,0xffa5ffac,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,
-0xff9cff9c,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffbfffb5,0xffbdffbe,0xffb3ffb9,0x72a0ffaa,0xff822882,0xff82ff82,0xff82ff82,0xff88ff82,0xff98ff93,0xff98ff98,0xff98ff98,0xff99ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xffa4ff9a,0xffaeffae,0xffaeffae,0xffafffaf,0xffb0ffb0,0xffb1ffb1,0xffb2ffb1,0xffb2ffb2,0xffb3ffb3,0xffadffb3,
-0xff9bffa1,0xff9bff9b,0xff9bff9b,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9eff9c,0xffbdffbe,0xffb9ffbb,0xffb1ffb6,0x269bffa6,0xff82b482,0xff82ff82,0xff82ff82,0xff8dff82,0xff98ff98,0xff98ff98,0xff98ff98,0xff99ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff99,0xffaeff9b,0xffb0ffb0,0xffb2ffb1,
-0xffb3ffb2,0xffb4ffb4,0xffb5ffb5,0xffb6ffb6,0xffb7ffb7,0xff9affb1,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xffbfffb3,0xffbcffbe,0xffb5ffb9,0xbca5ffaf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff828282,0xff82ff82,0xff82ff82,0xff8fff84,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9eff9a,0xffa2ffa1,0xffa5ffa3,0xffa7ffa6,0xffaaffa9,0xffacffab,0xffafffad,0xffb0ffb0,0xffb2ffb1,0xffb3ffb3,0xffb1ffb2,0xffafffb0,0xffaeffae,0xffacffad,0xffaaffab,0xffa8ffa9,0xffa8ffa7,0xffabffa9,0xffaeffad,0xffb1ffb0,0xffb4ffb3,0xffb6ffb5,0xffb9ffb7,
-0xffbbffb9,0xffbcffbb,0xffa1ffb6,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9eff9e,0xff9eff9e,0xffbeffb3,0xffb8ffbb,0xffadffb3,0x789bffa5,0xff822282,0xff82ff82,0xff82ff82,0xff8eff85,0xff99ff96,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9cff99,0xffa7ffa2,0xffaaffa8,0xffadffab,0xffafffae,0xffb2ffb0,0xffb4ffb3,0xffb5ffb4,0xffb3ffb4,0xffb2ffb3,
-0xffb2ffb2,0xffb1ffb1,0xffb0ffb0,0xffafffaf,0xffadffae,0xffadffac,0xffb1ffaf,0xffb4ffb2,0xffb7ffb5,0xffb9ffb8,0xffbbffbb,0xffb7ffbd,0xff9dffa5,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9eff9e,0xffc2ffc2,0xffbbffbf,0xffafffb6,0x2299ffa4,0xff82d082,0xff82ff82,0xff84ff82,0xff90ff87,0xff98ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,
-0xff99ff99,0xff9cff99,0xffa4ff9f,0xffabffa9,0xffaeffac,0xffb0ffaf,0xffb2ffb1,0xffb3ffb3,0xffb2ffb2,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffb0ffb1,0xffafffb0,0xffaeffae,0xffb1ffaf,0xffb4ffb3,0xffb7ffb6,0xffb9ffb8,0xffaaffb7,0xff9cff9e,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffc2ffa9,0xffbeffc1,0xffb5ffb9,0xcea2ffad,
-0xff825e82,0xff82ff82,0xff82ff82,0xff89ff83,0xff98ff93,0xff99ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff99,0xff9aff9a,0xff9fff9a,0xffadffa5,0xffb4ffb4,0xffb3ffb4,0xffb3ffb3,0xffb4ffb3,0xffb4ffb4,0xffb4ffb4,0xffb5ffb5,0xffb5ffb5,0xffb4ffb4,0xffb4ffb3,0xffa8ffae,0xff9cffa2,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9dff9c,
-0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffa3ff9d,0xffc2ffbf,0xffbfffc1,0xffb6ffbc,0x66a2ffad,0xf9820f82,0xff82ff82,0xff82ff82,0xff83ff82,0xff98ff8e,0xff98ff98,0xff98ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff9a,0xffa5ff9a,0xffb1ffb1,0xffb2ffb1,0xffb2ffb2,0xffb3ffb3,0xffb4ffb4,0xffb5ffb5,0xffb6ffb5,0xffb6ffb6,0xffb6ffb6,
-0xff9bff9c,0xff9cff9b,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9dff9c,0xffa5ff9d,0xffc0ffc1,0xffbcffbe,0xffb3ffb8,0x0ca0ffa8,0xff829e82,0xff82ff82,0xff85ff83,0xff89ff86,0xff98ff92,0xff98ff98,0xff98ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff99,0xff9aff9a,0xffb8ffae,0xffb3ffb3,0xffb4ffb4,
-0xffb6ffb5,0xffb7ffb7,0xffb8ffb8,0xffb9ffb9,0xffb9ffb9,0xff93ffb9,0xff9bff9b,0xff9bff9b,0xff9cff9b,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xffa2ff9c,0xffbdffbe,0xffc1ffc2,0xffb7ffbb,0x9ea7ffb1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff827a82,0xff82ff82,0xff83ff82,0xff91ff86,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9bff99,0xffa2ff9e,0xffa8ffa6,0xffaaffa9,0xffadffac,0xffafffae,0xffb2ffb1,0xffb4ffb3,0xffb5ffb4,0xffb6ffb6,0xffb5ffb6,0xffb3ffb4,0xffb1ffb2,0xffb0ffb1,0xffaeffaf,0xffabffad,0xffabffaa,0xffafffad,0xffb2ffb1,0xffb5ffb4,0xffb8ffb7,0xffb9ffb9,0xffbcffbb,
-0xffbeffbe,0xffabffbd,0xff9dff9e,0xff9eff9d,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xffc2ffb7,0xffbcffbf,0xffb1ffb7,0x829dffa8,0xff821382,0xff82ff82,0xff83ff82,0xff8dff88,0xff99ff93,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff99,0xff9aff9a,0xffa1ff9d,0xffa8ffa2,0xffafffae,0xffb2ffb1,0xffb4ffb3,0xffb7ffb6,0xffb8ffb8,0xffb7ffb8,0xffb6ffb6,
-0xffb5ffb5,0xffb4ffb5,0xffb3ffb4,0xffb2ffb3,0xffb0ffb1,0xffb1ffb0,0xffb4ffb3,0xffb8ffb6,0xffb9ffb9,0xffbdffbc,0xffb3ffbd,0xff9dffa7,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9eff9e,0xff9eff9e,0xffa8ff9e,0xffc5ffc7,0xffbeffc2,0xffb2ffb9,0x0b9cfba7,0xff82b882,0xff82ff82,0xff85ff82,0xff91ff89,0xff99ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,
-0xff99ff99,0xff9aff99,0xff9eff9a,0xffa3ffa2,0xffa5ffa4,0xffb3ffb0,0xffb5ffb4,0xffb6ffb6,0xffb5ffb6,0xffb5ffb5,0xffb4ffb4,0xffb4ffb4,0xffb4ffb4,0xffb3ffb4,0xffb2ffb3,0xffb1ffb2,0xffb5ffb3,0xffb7ffb6,0xffb3ffb6,0xffa5ffad,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffc5ffb4,0xffc1ffc4,0xffb8ffbd,0xb6a5ffb0,
-0xff823482,0xff82ff82,0xff85ff82,0xff8aff87,0xff98ff91,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffb8ffa3,0xffb7ffb7,0xffb7ffb7,0xffb6ffb6,0xffb7ffb7,0xffb7ffb7,0xffb8ffb7,0xffb8ffb8,0xffb8ffb8,0xffb7ffb8,0xffb7ffb7,0xff99ffb3,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9dff9c,0xff9dff9d,0xff9dff9d,
-0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffadff9d,0xffc1ffc2,0xffc4ffc6,0xffb8ffbe,0x38a3ffae,0xe2820000,0xff82ff82,0xff83ff82,0xff88ff84,0xff93ff89,0xff98ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff9a,0xff9aff9a,0xffb9ff9b,0xffb4ffb4,0xffb5ffb4,0xffb6ffb5,0xffb6ffb6,0xffb7ffb7,0xffb8ffb8,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,
-0xff98ffa2,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9dff9c,0xff9dff9d,0xff9dff9d,0xffb8ff9d,0xffc0ffc2,0xffc2ffc4,0xffb5ffb9,0x019fe1ab,0xff827482,0xff82ff82,0xffafff8c,0xffb4ffb5,0xff93ff92,0xff98ff98,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff9a,0xffa7ff9a,0xffb5ffc0,0xffb6ffb5,0xffb7ffb7,
-0xffb9ffb8,0xffb9ffb9,0xffbbffbb,0xffbcffbc,0xffbdffbd,0xffa4ffbd,0xff9bff98,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9dff9c,0xffb5ffa0,0xffbfffb5,0xffc3ffc6,0xffb9ffbd,0x6ca8ffb1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff826282,0xff82ff82,0xff84ff82,0xff8dff89,0xff99ff93,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff99,0xff9aff9a,0xff9dff9a,0xffa6ffa1,0xffadffac,0xffb0ffae,0xffb2ffb1,0xffb5ffb4,0xffb7ffb6,0xffb8ffb8,0xffb9ffb9,0xffb8ffb9,0xffb7ffb7,0xffb5ffb6,0xffb3ffb4,0xffb1ffb2,0xffafffb0,0xffafffae,0xffb3ffb1,0xffb6ffb4,0xffb9ffb8,0xffbcffb9,0xffbeffbd,0xffc0ffbf,
-0xffaeffbe,0xff9dffa0,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xffa3ff9e,0xffc5ffc2,0xffbfffc3,0xffb4ffb9,0x62a0ffab,0xe6820000,0xff82ff82,0xff86ff87,0xff92ff8c,0xff93ff8c,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9fff9a,0xffa6ffa5,0xffb5ffac,0xffb7ffb6,0xffb9ffb8,0xffbbffbb,0xffb9ffbb,0xffb9ffb9,
-0xffb8ffb9,0xffb8ffb8,0xffb7ffb7,0xffb5ffb6,0xffb3ffb4,0xffb5ffb3,0xffb8ffb6,0xffbbffb9,0xffb2ffbd,0xffa6ffad,0xff9dff9f,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xffb9ff9e,0xffc5ffc7,0xffc1ffc5,0xffb4ffbc,0x0000e6a9,0xff828682,0xff82ff82,0xff89ff84,0xff8dff8c,0xff99ff93,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,
-0xff9aff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffb6ffac,0xffb8ffb7,0xffb9ffb9,0xffb8ffb9,0xffb8ffb8,0xffb8ffb8,0xffb8ffb8,0xffb7ffb7,0xffb7ffb7,0xffb6ffb6,0xffb5ffb5,0xffb8ffb6,0xffa7ffb9,0xff9cff9c,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9eff9d,0xffa2ff9e,0xffc1ffc2,0xffc4ffc5,0xffb9ffc0,0x8ea6ffb2,
-0xf5820782,0xff82ff82,0xffa6ff84,0xffb5ffb3,0xff93ff9d,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9dff9a,0xffb8ffc0,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffbbffb9,0xffbbffbb,0xffbbffbb,0xffb9ffbb,0xffb9ffb9,0xffa3ffbc,0xff9cff9c,0xff9cff9c,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,
-0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffb0ffa9,0xffc3ffb6,0xffc6ffca,0xffb9ffc0,0x07a4f3ae,0x9e820000,0xff82ff82,0xff99ff82,0xffb5ffb1,0xff8bffab,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffbcffb6,0xffb7ffb7,0xffb8ffb7,0xffb8ffb8,0xffb9ffb9,0xffb9ffb9,0xffbbffbb,0xffbcffbb,0xffbcffbc,0xffbcffbc,
-0xff96ffb4,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffadffb1,0xffc6ffc1,0xffc4ffca,0xffb5ffbb,0x0000a8ab,0xff823682,0xff82ff82,0xff96ff82,0xffb5ffb1,0xff8effa7,0xff99ff97,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff9a,0xff9aff9a,0xffd0ffae,0xffb8ffb9,0xffb9ffb8,0xffb9ffb9,
-0xffbbffbb,0xffbdffbc,0xffbeffbd,0xffbfffbf,0xffc0ffbf,0xffbeffc0,0xff9dff9e,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9dff9c,0xff9dff9d,0xffa4ff9d,0xffbbffc6,0xffc9ffbe,0xffc2ffc9,0xffb9ffbf,0x38a7ffb0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff823a82,0xff82ff82,0xff88ff82,0xff92ff8e,0xff99ff8e,0xff99ff99,0xff99ff99,0xff9aff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9fff9a,0xffa4ffa4,0xffb1ffa5,0xffb5ffb4,0xffb7ffb6,0xffb9ffb9,0xffbcffbb,0xffbdffbc,0xffbcffbd,0xffb9ffbb,0xffb8ffb9,0xffb7ffb8,0xffb5ffb6,0xffb2ffb3,0xffb3ffb1,0xffb6ffb5,0xffb9ffb8,0xffbdffbb,0xffbfffbe,0xffbdffc0,0xffa9ffb3,
-0xff9eff9f,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xffa2ff9e,0xffc3ffc7,0xffc4ffc7,0xffb7ffbd,0x36a2ffac,0xa6820000,0xff82ff82,0xff9bff87,0xffb5ffb0,0xff8affab,0xff99ff95,0xff99ff99,0xff99ff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xffb7ffb2,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffbeffbe,0xffbcffbd,
-0xffbbffbc,0xffbbffbb,0xffb9ffb9,0xffb8ffb9,0xffb6ffb7,0xffb8ffb6,0xffbbffb9,0xffbfffbd,0xffa6ffc0,0xff9dff9e,0xff9dff9d,0xff9dff9d,0xff9eff9d,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xffb7ffb2,0xffc7ffbc,0xffc3ffc9,0xffb5ffbe,0x0000a4aa,0xff825082,0xff82ff82,0xffaeff8d,0xffb4ffb5,0xff93ff90,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff99,
-0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffa8ff9a,0xffb9ffbd,0xffbbffb9,0xffbcffbc,0xffbbffbc,0xffbbffbb,0xffbbffbb,0xffbbffbb,0xffb9ffbb,0xffb9ffb9,0xffb9ffb9,0xffb8ffb8,0xffbcffb9,0xffb5ffbd,0xff9dff9a,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9eff9d,0xff9eff9e,0xff9eff9e,0xffb6ffa1,0xffc0ffb6,0xffc8ffc9,0xffbcffc2,0x50a8ffb2,
-0xaa820000,0xff82ff82,0xff8bff82,0xffb5ffad,0xff8dffb3,0xff99ff96,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffcbffa3,0xffbbffbe,0xffbdffbc,0xffbcffbd,0xffbcffbc,0xffbdffbc,0xffbdffbd,0xffbdffbd,0xffbeffbe,0xffbeffbe,0xffbdffbd,0xffbdffbc,0xffb9ffbf,0xff9fff9e,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,
-0xff9dff9d,0xff9dff9d,0xffadff9e,0xffbeffc6,0xffc9ffc2,0xffc4ffc8,0xffb9ffc0,0x0000aaaf,0x58820000,0xff82ff82,0xff83ff82,0xffb3ffa4,0xff99ffb5,0xff99ff93,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffbcff9c,0xffb9ffcb,0xffb9ffb9,0xffb9ffb9,0xffbbffbb,0xffbcffbc,0xffbdffbd,0xffbeffbe,0xffbeffbe,0xffbfffbf,0xffbfffbf,
-0xffa5ffbe,0xffa0ff9e,0xff9cff9c,0xff9cff9c,0xff9dff9c,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffbbff9e,0xffbbffc2,0xffccffc6,0xffc1ffc8,0xffb4ffbc,0x00005aab,0xe9820582,0xff82ff82,0xff83ff82,0xffb2ff9e,0xff9dffb5,0xff9eff93,0xff99ff9d,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff9a,0xff9aff9a,0xffc2ffa1,0xffc2ffd9,0xffb9ffb9,0xffbbffbb,0xffbdffbc,
-0xffbeffbd,0xffbfffbf,0xffc1ffc0,0xffc2ffc1,0xffc3ffc2,0xffc3ffc3,0xffa5ffb9,0xffa0ffaa,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xff9dff9d,0xff9dff9d,0xff9fff9d,0xffd1ffb5,0xffbeffc4,0xffcfffc9,0xffc4ffca,0xffb9ffc0,0x07a6edb0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xf3820b82,0xff82ff82,0xffa7ff85,0xffb5ffb4,0xff93ff9c,0xff99ff99,0xff99ff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xffa2ff9b,0xffb8ffb7,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffc0ffbf,0xffbfffc0,0xffbdffbe,0xffbcffbc,0xffb9ffbb,0xffb8ffb9,0xffb5ffb7,0xffb7ffb5,0xffb9ffb8,0xffbdffbb,0xffc0ffbe,0xffbcffc1,0xff9effa1,0xff9eff9e,
-0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9fff9e,0xffb1ffa8,0xffc4ffb8,0xffc7ffca,0xffb8ffbf,0x07a0f1ad,0x52820000,0xff82ff82,0xff88ff83,0xffb3ffa5,0xff98ffb5,0xff99ff8f,0xff99ff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xffbfff9c,0xffb9ffc0,0xffbdffbb,0xffbfffbe,0xffc1ffc0,0xffc0ffc1,0xffbfffc0,
-0xffbeffbf,0xffbeffbe,0xffbdffbd,0xffbbffbc,0xffb9ffb9,0xffbbffb9,0xffbfffbd,0xffc2ffc0,0xffbcffc3,0xffa2ffa4,0xff9eff9d,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xffb9ff9f,0xffbbffc0,0xffcdffc6,0xffc5ffcb,0xffb4ffbf,0x000056aa,0xf9821582,0xff82ff82,0xff98ff84,0xffb5ffaf,0xff8dffa8,0xff99ff97,0xff99ff99,0xff99ff99,0xff9aff9a,
-0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffccffae,0xffbbffb9,0xffbeffbc,0xffbfffbf,0xffbeffbf,0xffbeffbe,0xffbeffbe,0xffbeffbe,0xffbdffbd,0xffbdffbd,0xffbbffbc,0xffbbffbb,0xffbfffbd,0xffc2ffc0,0xff9effa9,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xffa5ff9e,0xffbdffc4,0xffcaffbf,0xffcaffce,0xffbdffc4,0x13a6f3b2,
-0x46820000,0xff82ff82,0xff83ff82,0xffb0ff92,0xffaaffb5,0xff9bff92,0xff99ff9c,0xff99ff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffb6ff9c,0xffc8ffd6,0xffbdffbc,0xffbfffbf,0xffbfffbf,0xffbfffbf,0xffbfffbf,0xffc0ffc0,0xffc0ffc0,0xffc0ffc0,0xffc0ffc0,0xffc0ffc0,0xffc0ffbf,0xffc3ffc2,0xffa4ffb5,0xff9effa8,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,
-0xff9eff9e,0xffa3ff9e,0xffd1ffc2,0xffc2ffc2,0xffcaffc9,0xffc5ffc8,0xffb6ffc0,0x00003eaf,0x0d820000,0xff82f982,0xff82ff82,0xffa9ff87,0xffb3ffb4,0xff99ff92,0xff99ff9b,0xff99ff99,0xff99ff99,0xff9aff99,0xff9aff9a,0xff9aff9a,0xffabff9a,0xffd3ffd0,0xffbdffbd,0xffbdffbd,0xffbdffbd,0xffbeffbd,0xffbfffbe,0xffc0ffbf,0xffc1ffc0,0xffc1ffc1,0xffc1ffc1,0xffc1ffc1,
-0xffc0ffc1,0xffa8ffa8,0xff9dffa5,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xff9dff9d,0xffadff9d,0xffcdffcc,0xffc6ffc3,0xffcaffcc,0xffc2ffc5,0xf5b3ffbc,0x000011aa,0xa2820000,0xff82ff82,0xff83ff82,0xffa3ff88,0xffb5ffb3,0xffa0ff9d,0xffa7ffa5,0xff9bffa2,0xff99ff99,0xff9aff9a,0xffa1ff9a,0xffc7ffb1,0xffdaffdb,0xffbcffc5,0xffbdffbc,0xffbeffbd,0xffbfffbe,
-0xffc0ffc0,0xffc2ffc1,0xffc3ffc3,0xffc4ffc4,0xffc5ffc5,0xffc6ffc5,0xffbbffc6,0xffb9ffae,0xffabffb5,0xff9dffa2,0xff9dff9d,0xff9dff9d,0xffacffa2,0xffd6ffbe,0xffcbffd6,0xffcaffc5,0xffcdffd1,0xffc5ffc8,0xffb9ffc0,0x0000a2af,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xa2820000,0xff82ff82,0xff8eff84,0xffb5ffad,0xff8bffb3,0xff99ff96,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xff9bff9b,0xffc3ffa2,0xffb9ffb9,0xffbdffbb,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc2ffc3,0xffc0ffc1,0xffbfffbf,0xffbdffbe,0xffbbffbc,0xffb8ffb9,0xffb9ffb8,0xffbdffbc,0xffc0ffbf,0xffc3ffc2,0xffc6ffc5,0xffa1ffac,0xff9eff9e,
-0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9fff9f,0xff9fff9f,0xffadff9f,0xffbeffc3,0xffcbffc3,0xffc6ffcb,0xffb8ffc0,0x0000b0ac,0x07820000,0xff82e582,0xff88ff83,0xffaaff91,0xffb3ffb4,0xff98ff92,0xff9eff9f,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffacff9b,0xffccffce,0xffbcffbb,0xffbfffbd,0xffc1ffc0,0xffc4ffc2,0xffc3ffc4,0xffc2ffc3,
-0xffc1ffc2,0xffc1ffc1,0xffc0ffc0,0xffbeffbf,0xffbcffbd,0xffbfffbd,0xffc2ffc0,0xffc5ffc3,0xffc8ffc6,0xffabffb6,0xff9effa6,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xffaeff9f,0xffccffcb,0xffc6ffc3,0xffcfffcd,0xffc6ffcb,0xebb4ffbf,0x000007aa,0x9e820000,0xff82ff82,0xff89ff84,0xffb1ff9f,0xff9cffb5,0xff9dff93,0xff99ff9d,0xff9aff9a,0xff9aff9a,
-0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffc1ffa0,0xffbeffd8,0xffbdffbc,0xffc0ffbf,0xffc2ffc1,0xffc1ffc2,0xffc1ffc1,0xffc0ffc1,0xffc0ffc0,0xffc0ffc0,0xffbfffc0,0xffbeffbf,0xffbfffbe,0xffc2ffc0,0xffc5ffc3,0xffaaffc4,0xffa1ffad,0xff9dff9d,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xffa1ff9e,0xffcfffb7,0xffc0ffc4,0xffd0ffca,0xffc9ffcd,0xffbdffc4,0x00009eb1,
-0x03820000,0xff82cd82,0xff83ff82,0xff97ff87,0xffb6ffb2,0xff9bffa9,0xffa8ffa2,0xff9dffa3,0xff9aff9a,0xff9aff9a,0xff9cff9a,0xffc0ffab,0xffdaffd5,0xffbdffcc,0xffbfffbe,0xffc2ffc1,0xffc2ffc2,0xffc2ffc2,0xffc2ffc2,0xffc2ffc2,0xffc3ffc2,0xffc3ffc3,0xffc3ffc3,0xffc2ffc3,0xffc3ffc2,0xffc6ffc5,0xffb6ffc8,0xffb9ffb3,0xffaaffb3,0xff9dffa0,0xff9eff9d,0xff9eff9e,
-0xffb4ffa4,0xffd9ffc6,0xffc4ffd5,0xffcbffc4,0xffcbffcd,0xffc4ffc8,0xcdb5ffbf,0x000003ad,0x00000000,0xff82a882,0xff82ff82,0xff8dff84,0xffb5ffac,0xff9bffb1,0xffa3ff9e,0xffa0ffa7,0xff9aff9b,0xff9aff9a,0xff9bff9a,0xffb6ffa4,0xffdcffce,0xffbfffd4,0xffbfffbe,0xffbfffbf,0xffc0ffbf,0xffc0ffc0,0xffc1ffc1,0xffc2ffc2,0xffc3ffc3,0xffc4ffc3,0xffc4ffc4,0xffc4ffc4,
-0xffc5ffc4,0xffaeffc2,0xffb8ffb6,0xffa5ffb0,0xff9dff9e,0xff9dff9d,0xffa0ff9d,0xffb9ffa7,0xffdaffcc,0xffc5ffcf,0xffcdffc7,0xffc9ffcc,0xffc2ffc6,0xa6b1ffbb,0x00000000,0x3e820000,0xff82ff82,0xff83ff82,0xff8cff88,0xffb5ffa2,0xffacffb7,0xffb0ffac,0xffbeffb9,0xffc0ffbf,0xffc7ffc2,0xffd6ffce,0xffdaffd9,0xffc2ffd3,0xffbfffbe,0xffbfffbf,0xffc0ffc0,0xffc2ffc1,
-0xffc3ffc2,0xffc4ffc4,0xffc6ffc5,0xffc7ffc6,0xffc7ffc7,0xffc8ffc8,0xffc8ffc8,0xffb6ffc2,0xffc5ffbc,0xffcaffcb,0xffcbffc9,0xffd4ffcd,0xffdcffdc,0xffd6ffdb,0xffc7ffc8,0xffd0ffca,0xffccffd0,0xffc5ffc9,0xffb8ffc0,0x000041ae,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x46820000,0xff82ff82,0xff8aff84,0xffb1ff99,0xffaaffb5,0xff9bff91,0xff9aff9c,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xff9bff9b,0xffb9ff9d,0xffbfffd5,0xffbcffbb,0xffbfffbe,0xffc1ffc0,0xffc4ffc3,0xffc5ffc5,0xffc5ffc6,0xffc3ffc4,0xffc2ffc2,0xffc0ffc1,0xffbeffbf,0xffbbffbc,0xffbdffbb,0xffc0ffbf,0xffc3ffc2,0xffc6ffc5,0xffc9ffc8,0xffafffc5,0xff9fffa9,
-0xff9eff9e,0xff9eff9e,0xff9fff9e,0xff9fff9f,0xff9fff9f,0xffa6ff9f,0xffd0ffc1,0xffc4ffc2,0xffceffcc,0xffc7ffcc,0xffb6ffc1,0x000044ad,0x00000000,0xff827282,0xff89ff83,0xff96ff8e,0xffb5ffac,0xff9bffb1,0xffa7ffa1,0xffa0ffa7,0xff9aff9b,0xff9aff9a,0xff9cff9a,0xffb6ffa5,0xffdcffce,0xffbbffd1,0xffbeffbd,0xffc1ffc0,0xffc4ffc2,0xffc6ffc5,0xffc6ffc6,0xffc5ffc6,
-0xffc4ffc4,0xffc3ffc4,0xffc2ffc3,0xffc1ffc1,0xffbfffbf,0xffc2ffc0,0xffc5ffc3,0xffc8ffc6,0xffcaffc9,0xffb9ffcb,0xffb9ffb8,0xffa5ffb0,0xff9eff9f,0xff9eff9e,0xffa0ff9e,0xffbcffa7,0xffd8ffd0,0xffc7ffd0,0xffcfffc8,0xffcfffd0,0xffc6ffcc,0x72b3ffbd,0x00000000,0x27820000,0xff82fd82,0xff87ff83,0xffa3ff8c,0xffb6ffb2,0xff9eff9e,0xffaaffa5,0xff9cffa2,0xff9aff9a,
-0xff9aff9a,0xffa1ff9b,0xffc5ffaf,0xffd9ffdb,0xffbdffc0,0xffbfffbe,0xffc2ffc1,0xffc4ffc4,0xffc4ffc4,0xffc3ffc3,0xffc3ffc3,0xffc3ffc3,0xffc3ffc3,0xffc2ffc2,0xffc1ffc1,0xffc2ffc0,0xffc5ffc3,0xffc8ffc6,0xffc3ffc9,0xffbbffb1,0xffadffb7,0xff9effa4,0xff9eff9e,0xff9eff9e,0xffb1ffa1,0xffd6ffc0,0xffc9ffd5,0xffcbffc4,0xffcfffd1,0xffc8ffcb,0xfbb9ffc3,0x000027af,
-0x00000000,0xff825882,0xff83ff82,0xff8bff87,0xffb2ff97,0xffb1ffb6,0xffacffa4,0xffbdffb5,0xffbeffc0,0xffc5ffc1,0xffd4ffce,0xffdaffd8,0xffc6ffd8,0xffbeffc2,0xffc1ffc0,0xffc4ffc3,0xffc4ffc5,0xffc4ffc4,0xffc4ffc4,0xffc5ffc5,0xffc5ffc5,0xffc5ffc5,0xffc5ffc5,0xffc5ffc5,0xffc6ffc5,0xffc9ffc8,0xffccffcb,0xffc0ffc8,0xffc9ffc1,0xffccffcd,0xffccffca,0xffd6ffce,
-0xffdcffdc,0xffd2ffd9,0xffc7ffc5,0xffcfffcd,0xffccffce,0xffc3ffc8,0x58b2ffbb,0x00000000,0x00000000,0xff823e82,0xff82ff82,0xff89ff85,0xffacff91,0xffb5ffb6,0xffafffa6,0xffbbffb3,0xffbfffc0,0xffc4ffc1,0xffd2ffc8,0xffdaffd8,0xffcfffdb,0xffbeffbf,0xffc1ffc0,0xffc2ffc2,0xffc2ffc2,0xffc3ffc2,0xffc4ffc3,0xffc5ffc4,0xffc5ffc5,0xffc6ffc6,0xffc6ffc6,0xffc6ffc6,
-0xffc8ffc6,0xffc8ffc9,0xffc2ffb9,0xffcaffc4,0xffcbffcd,0xffcdffcb,0xffdaffd0,0xffdcffdc,0xffcdffda,0xffcaffc9,0xffcfffd0,0xffcaffcd,0xffc1ffc6,0x3cb0ffb7,0x00000000,0x03820000,0xff82d382,0xff84ff82,0xff8dff88,0xff9fff91,0xffb8ffb3,0xffb2ffb4,0xffb9ffb4,0xffc8ffc2,0xffd0ffcc,0xffd5ffd3,0xffc5ffd0,0xffc1ffbe,0xffc1ffc0,0xffc1ffc1,0xffc2ffc2,0xffc4ffc3,
-0xffc5ffc4,0xffc6ffc6,0xffc8ffc7,0xffc9ffc8,0xffcaffc9,0xffcaffca,0xffcbffca,0xffc0ffca,0xffc2ffbd,0xffccffc6,0xffd5ffd1,0xffd9ffd6,0xffd6ffd8,0xffcaffce,0xffcfffc9,0xffd1ffd1,0xffcdffcf,0xffc5ffca,0xd0b5ffbf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03820000,0xff82d182,0xff8bff84,0xff9fff91,0xffb6ffb2,0xff9affa9,0xffa4ffa1,0xff9effa5,0xff9aff9b,0xff9aff9a,0xff9eff9b,0xffbfffab,0xffdcffd6,0xffbbffc4,0xffbeffbd,0xffc1ffc0,0xffc4ffc2,0xffc6ffc5,0xffc8ffc7,0xffc8ffc8,0xffc6ffc7,0xffc4ffc5,0xffc3ffc4,0xffc0ffc2,0xffbeffbf,0xffc0ffbe,0xffc3ffc2,0xffc6ffc5,0xffc9ffc8,0xffccffcb,0xffc4ffcd,0xffbdffb6,
-0xffaaffb6,0xff9fffa1,0xff9fff9f,0xffa0ff9f,0xffb3ffa4,0xffd9ffc9,0xffc6ffd4,0xffcdffc6,0xffd1ffd2,0xffc7ffcd,0xcfb4ffc0,0x000001ac,0x00000000,0xdb820b82,0xff88ff83,0xff90ff8d,0xffacff95,0xffb4ffb5,0xffaeffa2,0xffb9ffb2,0xffbfffbf,0xffc4ffc0,0xffd2ffca,0xffd9ffd6,0xffcbffda,0xffbdffbc,0xffc0ffbf,0xffc3ffc2,0xffc6ffc4,0xffc8ffc7,0xffc9ffc9,0xffc7ffc8,
-0xffc7ffc7,0xffc6ffc6,0xffc5ffc5,0xffc3ffc4,0xffc1ffc2,0xffc4ffc3,0xffc8ffc6,0xffcbffc9,0xffcdffcc,0xffcfffce,0xffc5ffbf,0xffccffc5,0xffccffcf,0xffceffcc,0xffd9ffd1,0xffdcffdc,0xffceffd9,0xffcbffc9,0xffd2ffd1,0xffcfffd0,0xffc4ffcb,0x07b0dfb9,0x00000000,0x00000000,0xff829282,0xff86ff83,0xff8fff8b,0xffb5ffa3,0xffa9ffb7,0xffafffab,0xffbdffb8,0xffbfffbf,
-0xffc7ffc3,0xffd6ffd0,0xffd9ffd9,0xffc2ffd2,0xffbeffbd,0xffc1ffc0,0xffc4ffc3,0xffc7ffc6,0xffc6ffc7,0xffc6ffc6,0xffc5ffc6,0xffc5ffc5,0xffc5ffc5,0xffc4ffc5,0xffc3ffc4,0xffc4ffc3,0xffc8ffc6,0xffcbffc9,0xffcdffcc,0xffbbffc9,0xffc7ffbe,0xffceffcd,0xffccffcb,0xffd4ffce,0xffdcffdc,0xffd6ffdb,0xffc7ffca,0xffd2ffcb,0xffceffd2,0xffc7ffcb,0x92b7ffc0,0x00000000,
-0x00000000,0xc7820182,0xff83ff82,0xff8bff87,0xff98ff90,0xffb7ffae,0xffb0ffb7,0xffb9ffb6,0xffc5ffbf,0xffceffca,0xffd2ffd1,0xffc8ffd3,0xffbdffbd,0xffc0ffbe,0xffc3ffc2,0xffc6ffc5,0xffc7ffc7,0xffc6ffc6,0xffc7ffc6,0xffc7ffc7,0xffc7ffc7,0xffc8ffc8,0xffc7ffc8,0xffc7ffc7,0xffc9ffc7,0xffccffca,0xffcfffcd,0xffceffd0,0xffc3ffc0,0xffcfffc8,0xffd6ffd3,0xffd8ffd8,
-0xffd3ffd9,0xffcaffce,0xffd2ffcd,0xffd1ffd2,0xffcbffce,0xffc1ffc7,0x01b0bdb8,0x00000000,0x00000000,0xbd820182,0xff82ff82,0xff89ff84,0xff93ff8e,0xffb7ffa7,0xffb5ffb8,0xffb7ffb4,0xffc3ffbc,0xffcdffc9,0xffd3ffd1,0xffcdffd4,0xffbdffc3,0xffc0ffbe,0xffc3ffc2,0xffc4ffc4,0xffc4ffc4,0xffc5ffc5,0xffc6ffc5,0xffc7ffc6,0xffc8ffc7,0xffc8ffc8,0xffc9ffc9,0xffc8ffc9,
-0xffcaffc9,0xffcdffcc,0xffc7ffcf,0xffc5ffc1,0xffd0ffcb,0xffd6ffd4,0xffd8ffd8,0xffd0ffd8,0xffc7ffc6,0xffd3ffcd,0xffd0ffd3,0xffcaffcd,0xffbfffc6,0x01abc3b5,0x00000000,0x00000000,0xff825682,0xff83ff82,0xff8dff88,0xff95ff91,0xffadff9c,0xffbbffb9,0xffb7ffb6,0xffc1ffbd,0xffc5ffc3,0xffc3ffc7,0xffc5ffbf,0xffc2ffc7,0xffc3ffc2,0xffc3ffc3,0xffc5ffc4,0xffc6ffc5,
-0xffc7ffc6,0xffc8ffc8,0xffcaffc9,0xffcbffca,0xffccffcb,0xffccffcc,0xffcdffcc,0xffc8ffcc,0xffc3ffc4,0xffc6ffc3,0xffcbffc9,0xffceffcd,0xffc9ffcd,0xffcfffca,0xffd5ffd3,0xffd2ffd3,0xffcdffd0,0xffc4ffc9,0x52b3ffbb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xfd824182,0xff8bff84,0xff97ff92,0xffb1ffa1,0xffb0ffb6,0xffa9ffa3,0xffbbffb4,0xffbfffbf,0xffc5ffc1,0xffd5ffcc,0xffdaffd8,0xffc3ffd6,0xffbdffbb,0xffc0ffbf,0xffc3ffc2,0xffc6ffc4,0xffc8ffc7,0xffcaffc9,0xffcaffcb,0xffc9ffc9,0xffc7ffc8,0xffc5ffc6,0xffc3ffc4,0xffc0ffc1,0xffc3ffc1,0xffc6ffc5,0xffc9ffc8,0xffccffcb,0xffcfffcd,0xffd1ffd0,0xffbcffc8,
-0xffcaffc3,0xffcdffcf,0xffccffcb,0xffd8ffcf,0xffdcffdc,0xffd1ffd8,0xffc8ffc9,0xffd4ffcf,0xffd1ffd4,0xffc6ffcd,0x43b3ffbc,0x00000000,0x00000000,0x43820000,0xff86ff82,0xff8fff8b,0xff97ff93,0xffb7ffa8,0xffb4ffb8,0xffb7ffb4,0xffc2ffbb,0xffccffc8,0xffd2ffd0,0xffccffd3,0xffbbffc0,0xffbfffbd,0xffc2ffc0,0xffc5ffc3,0xffc8ffc6,0xffcaffc9,0xffcbffcb,0xffcaffca,
-0xffc9ffc9,0xffc8ffc8,0xffc7ffc7,0xffc5ffc6,0xffc4ffc4,0xffc7ffc5,0xffcaffc9,0xffcdffcc,0xffd0ffce,0xffd2ffd1,0xffcfffd3,0xffccffcd,0xffd1ffcc,0xffd6ffd5,0xffd9ffd9,0xffd1ffd6,0xffc8ffc9,0xffd3ffce,0xffd2ffd4,0xffcdffd0,0xfbc0ffc8,0x00003db7,0x00000000,0x00000000,0xe1821382,0xff85ff82,0xff8eff8a,0xff9fff91,0xffb8ffb3,0xffb2ffb4,0xffb8ffb4,0xffc6ffc0,
-0xffcfffcb,0xffd1ffd2,0xffc5ffcf,0xffbdffbb,0xffc0ffbe,0xffc3ffc2,0xffc6ffc5,0xffc9ffc8,0xffc9ffc9,0xffc8ffc8,0xffc8ffc8,0xffc8ffc8,0xffc7ffc7,0xffc7ffc7,0xffc5ffc6,0xffc7ffc5,0xffcaffc9,0xffcdffcc,0xffd0ffcf,0xffd1ffd1,0xffc2ffc8,0xffceffc7,0xffd6ffd3,0xffd9ffd8,0xffd5ffd6,0xffcaffcc,0xffcfffca,0xffd2ffd2,0xffcdffd0,0xffc4ffca,0x0bb5dbbb,0x00000000,
-0x00000000,0x35820000,0xff82fb82,0xff8bff86,0xff93ff8f,0xffa6ff98,0xffb9ffb6,0xffb9ffb9,0xffbfffbb,0xffc5ffc2,0xffc6ffc6,0xffc3ffc3,0xffbeffc2,0xffc2ffc0,0xffc5ffc3,0xffc8ffc7,0xffc9ffc9,0xffc9ffc9,0xffc9ffc9,0xffc9ffc9,0xffc9ffc9,0xffcaffca,0xffcaffca,0xffc9ffc9,0xffcbffc9,0xffceffcd,0xffd1ffd0,0xffd0ffd2,0xffc2ffc9,0xffc8ffc4,0xffccffcb,0xffceffcd,
-0xffc7ffca,0xffd1ffcd,0xffd6ffd5,0xffd1ffd3,0xffcbffce,0xfbbcffc5,0x000027b5,0x00000000,0x00000000,0x37820000,0xff82fd82,0xff89ff84,0xff92ff8e,0xffa1ff96,0xffb8ffb1,0xffb9ffb9,0xffbeffb9,0xffc4ffc1,0xffc7ffc6,0xffc1ffc3,0xffbeffc1,0xffc2ffc0,0xffc5ffc4,0xffc6ffc6,0xffc6ffc6,0xffc7ffc7,0xffc8ffc8,0xffc9ffc8,0xffcaffc9,0xffcaffca,0xffcbffcb,0xffcbffcb,
-0xffcdffcb,0xffd0ffce,0xffcbffd1,0xffc3ffc4,0xffc9ffc6,0xffcdffcb,0xffcdffcd,0xffc8ffc9,0xffd2ffcd,0xffd4ffd4,0xffd0ffd2,0xffcaffce,0xfdbcffc5,0x00003bb3,0x00000000,0x00000000,0xcd820182,0xff83ff82,0xff8dff87,0xff95ff91,0xff9dff99,0xffafffa4,0xffbfffb2,0xffc0ffc0,0xffc3ffc1,0xffc4ffc7,0xffc7ffc1,0xffc2ffc6,0xffc5ffc4,0xffc5ffc5,0xffc6ffc6,0xffc8ffc7,
-0xffc9ffc8,0xffcaffca,0xffccffcb,0xffcdffcc,0xffceffcd,0xffceffce,0xffcfffce,0xffd0ffd1,0xffceffce,0xffcaffcc,0xffc9ffc9,0xffccffca,0xffd2ffcf,0xffd6ffd5,0xffd6ffd6,0xffd2ffd4,0xffcdffd0,0xffc2ffc8,0x03b0c7b9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x98820000,0xff89ff83,0xff96ff91,0xff9eff99,0xffb6ffb0,0xffb1ffb7,0xffb8ffb5,0xffc4ffbd,0xffcdffc9,0xffd2ffd1,0xffc9ffd2,0xffbbffbc,0xffbfffbd,0xffc2ffc0,0xffc5ffc3,0xffc8ffc6,0xffcaffc9,0xffccffcb,0xffcdffcd,0xffcbffcc,0xffc9ffca,0xffc7ffc8,0xffc5ffc6,0xffc3ffc3,0xffc6ffc4,0xffc9ffc7,0xffccffca,0xffcfffcd,0xffd1ffd0,0xffd3ffd2,0xffd2ffd4,
-0xffc6ffc8,0xffd0ffc9,0xffd6ffd4,0xffd9ffd9,0xffd3ffd8,0xffcaffcd,0xffd3ffcd,0xffd5ffd5,0xffd0ffd3,0xffc2ffcb,0x000088b9,0x00000000,0x00000000,0x00000000,0xff837d82,0xff8dff88,0xff95ff91,0xffa2ff98,0xffb8ffb1,0xffb8ffb9,0xffbdffb9,0xffc3ffc1,0xffc7ffc5,0xffbbffc3,0xffbcffbb,0xffc0ffbe,0xffc3ffc2,0xffc7ffc5,0xffc9ffc8,0xffccffcb,0xffcdffcd,0xffccffcd,
-0xffcbffcb,0xffcaffcb,0xffc9ffca,0xffc7ffc8,0xffc6ffc6,0xffcaffc8,0xffcdffcb,0xffcfffce,0xffd2ffd1,0xffd4ffd3,0xffd6ffd5,0xffcaffd3,0xffcaffc7,0xffcdffcc,0xffcfffce,0xffc9ffcb,0xffd3ffce,0xffd5ffd5,0xffd1ffd3,0xffcaffce,0x74bbffc2,0x00000000,0x00000000,0x00000000,0x3d820000,0xff84fd82,0xff8dff89,0xff95ff91,0xffacff9c,0xffb9ffb9,0xffb7ffb7,0xffc0ffbc,
-0xffc5ffc3,0xffc6ffc7,0xffbeffc2,0xffbeffbc,0xffc2ffc0,0xffc5ffc3,0xffc8ffc7,0xffcbffca,0xffcbffcb,0xffcaffca,0xffcaffca,0xffcaffca,0xffc9ffca,0xffc9ffc9,0xffc7ffc8,0xffc9ffc8,0xffcdffcb,0xffd0ffce,0xffd2ffd1,0xffd4ffd3,0xffc4ffd2,0xffc7ffc1,0xffccffca,0xffceffce,0xffc9ffcc,0xffd0ffcb,0xffd5ffd4,0xffd2ffd4,0xffccffcf,0xfbbfffc7,0x000037b7,0x00000000,
-0x00000000,0x00000000,0xff827e82,0xff8aff84,0xff93ff8f,0xff9bff97,0xffacff9f,0xffbeffb1,0xffc0ffc0,0xffc2ffc0,0xffc1ffc5,0xffc4ffbe,0xffbfffc3,0xffc3ffc1,0xffc7ffc5,0xffcaffc8,0xffcbffcb,0xffcaffcb,0xffcbffcb,0xffcbffcb,0xffcbffcb,0xffccffcb,0xffcbffcc,0xffcbffcb,0xffcdffcc,0xffd0ffcf,0xffd3ffd2,0xffd2ffd4,0xffcfffd0,0xffcaffcd,0xffcaffca,0xffcfffcb,
-0xffd3ffd2,0xffd8ffd6,0xffd5ffd6,0xffd1ffd3,0xffc9ffcd,0x7eb9ffc1,0x00000000,0x00000000,0x00000000,0x00000000,0xff82a082,0xff88ff84,0xff92ff8d,0xff9aff96,0xffa6ffa2,0xffb7ffb3,0xffc0ffbf,0xffc2ffc1,0xffc7ffc4,0xffc1ffc4,0xffc0ffc1,0xffc3ffc2,0xffc7ffc5,0xffc8ffc8,0xffc8ffc8,0xffc9ffc9,0xffcaffc9,0xffcbffca,0xffccffcb,0xffccffcc,0xffcdffcd,0xffcdffcd,
-0xffcfffce,0xffd2ffd1,0xffd1ffd3,0xffcdffcf,0xffc9ffca,0xffcbffc9,0xffd0ffcd,0xffd4ffd2,0xffd6ffd6,0xffd5ffd6,0xffd0ffd3,0xffc8ffcd,0xa0b8ffc1,0x00000000,0x00000000,0x00000000,0x3d820000,0xff82f982,0xff8cff86,0xff95ff91,0xff9dff99,0xffa4ffa1,0xffacffa7,0xffbbffb9,0xffc0ffbd,0xffc1ffbc,0xffbfffbd,0xffc3ffc1,0xffc6ffc5,0xffc7ffc7,0xffc8ffc8,0xffc9ffc9,
-0xffcbffca,0xffccffcb,0xffcdffcd,0xffcfffce,0xffcfffcf,0xffd0ffd0,0xffd1ffd0,0xffd4ffd3,0xffd6ffd5,0xffd4ffd6,0xffd5ffd4,0xffd6ffd5,0xffdaffd9,0xffd9ffd9,0xffd6ffd8,0xffd3ffd5,0xffccffd0,0xfdbeffc7,0x00003bb5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x09820000,0xff87c382,0xff93ff8f,0xff99ff97,0xffa7ffa1,0xffb9ffb6,0xffb9ffb9,0xffbeffb9,0xffc4ffc1,0xffc7ffc6,0xffbcffc3,0xffbdffbb,0xffc0ffbf,0xffc4ffc2,0xffc7ffc5,0xffc9ffc8,0xffccffcb,0xffceffcd,0xffcfffcf,0xffcdffce,0xffcbffcc,0xffcaffca,0xffc7ffc8,0xffc5ffc5,0xffc8ffc6,0xffcbffca,0xffceffcd,0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,
-0xffcaffd4,0xffc9ffc5,0xffcdffcc,0xffcfffcf,0xffc9ffca,0xffd2ffce,0xffd6ffd6,0xffd4ffd5,0xffceffd2,0xbfbeffc7,0x00000bb4,0x00000000,0x00000000,0x00000000,0x8a820000,0xff8aff85,0xff93ff8f,0xff9bff97,0xffa6ffa2,0xffbcffb3,0xffbfffbf,0xffc1ffc0,0xffc8ffc3,0xffbcffc6,0xffbeffbc,0xffc1ffbf,0xffc5ffc3,0xffc8ffc6,0xffcbffca,0xffceffcc,0xffcfffcf,0xffceffcf,
-0xffcdffcd,0xffccffcd,0xffcbffcb,0xffc9ffca,0xffc8ffc8,0xffccffca,0xffcfffcd,0xffd2ffd0,0xffd4ffd3,0xffd6ffd5,0xffd8ffd6,0xffd0ffd5,0xffcbffce,0xffccffcb,0xffd1ffce,0xffd5ffd3,0xffd6ffd6,0xffd5ffd6,0xffd0ffd3,0xffc4ffcb,0x01b58bbd,0x00000000,0x00000000,0x00000000,0x00000000,0xff827282,0xff8cff86,0xff95ff90,0xff9cff98,0xffafffa3,0xffbfffb1,0xffc0ffc0,
-0xffc2ffc0,0xffc5ffc7,0xffbfffbf,0xffc0ffbe,0xffc3ffc1,0xffc7ffc5,0xffcaffc8,0xffccffcb,0xffcdffcd,0xffccffcc,0xffccffcc,0xffccffcc,0xffcbffcb,0xffcbffcb,0xffc9ffca,0xffccffca,0xffcfffcd,0xffd2ffd0,0xffd4ffd3,0xffd6ffd5,0xffd0ffd4,0xffcbffce,0xffcbffca,0xffceffcc,0xffd3ffd1,0xffd6ffd5,0xffd6ffd6,0xffd1ffd4,0xffc9ffce,0x7ab9ffc1,0x00000000,0x00000000,
-0x00000000,0x00000000,0xb9820582,0xff88ff83,0xff92ff8d,0xff9bff97,0xffa2ff9e,0xffa9ffa5,0xffb9ffb1,0xffbeffbb,0xffbeffc1,0xffbcffb9,0xffc1ffbf,0xffc4ffc3,0xffc8ffc6,0xffcbffca,0xffcdffcc,0xffccffcc,0xffccffcc,0xffcdffcd,0xffcdffcd,0xffcdffcd,0xffcdffcd,0xffcdffcd,0xffcfffce,0xffd2ffd1,0xffd5ffd4,0xffd6ffd6,0xffd9ffd8,0xffd5ffd6,0xffd6ffd5,0xffd9ffd6,
-0xffdaffdb,0xffd8ffd9,0xffd5ffd6,0xffd0ffd3,0xffc5ffcb,0x07b4c9bc,0x00000000,0x00000000,0x00000000,0x00000000,0xdf821182,0xff87ff83,0xff91ff8c,0xff9aff96,0xffa1ff9e,0xffadffa4,0xffb9ffae,0xffbdffbb,0xffbcffc0,0xffbdffbb,0xffc1ffbf,0xffc5ffc3,0xffc8ffc7,0xffcaffca,0xffcaffca,0xffcbffca,0xffccffcb,0xffcdffcc,0xffcdffcd,0xffceffce,0xffceffce,0xffcfffce,
-0xffd1ffd0,0xffd4ffd3,0xffd6ffd5,0xffd6ffd6,0xffd5ffd5,0xffd6ffd5,0xffdaffd8,0xffdaffdb,0xffd8ffd9,0xffd5ffd6,0xffd0ffd3,0xffc6ffcc,0x15b3ddbd,0x00000000,0x00000000,0x00000000,0x00000000,0xff828682,0xff8bff85,0xff95ff90,0xff9dff99,0xffa4ffa1,0xffabffa8,0xffb1ffae,0xffb6ffb4,0xffbbffb9,0xffc0ffbe,0xffc4ffc2,0xffc8ffc6,0xffc9ffc8,0xffcaffc9,0xffcbffca,
-0xffccffcc,0xffceffcd,0xffcfffce,0xffd0ffd0,0xffd1ffd1,0xffd1ffd1,0xffd3ffd2,0xffd6ffd5,0xffd8ffd6,0xffdaffd9,0xffdbffda,0xffdbffdb,0xffdbffdb,0xffd9ffda,0xffd6ffd8,0xffd2ffd5,0xffcaffcf,0x92b9ffc2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xc7841182,0xff91ff8b,0xff98ff95,0xff9eff9b,0xffadffa2,0xffbcffb1,0xffc0ffbf,0xffc2ffc0,0xffc2ffc5,0xffbdffbe,0xffbeffbc,0xffc1ffc0,0xffc5ffc3,0xffc8ffc6,0xffcbffc9,0xffcdffcc,0xffd0ffcf,0xffd1ffd1,0xffcfffd0,0xffcdffce,0xffcbffcc,0xffc9ffca,0xffc7ffc7,0xffcaffc9,0xffceffcc,0xffd0ffcf,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd9ffd8,
-0xffd1ffd5,0xffccffcf,0xffcbffcb,0xffd0ffcd,0xffd4ffd3,0xffd8ffd6,0xffd6ffd6,0xffd2ffd4,0xffc9ffce,0x11b9c9c0,0x00000000,0x00000000,0x00000000,0x00000000,0x01820000,0xff869b82,0xff92ff8c,0xff9aff96,0xffa1ff9d,0xffa7ffa4,0xffb2ffad,0xffbcffb9,0xffb9ffb8,0xffb9ffb9,0xffbfffbc,0xffc2ffc0,0xffc6ffc4,0xffc9ffc8,0xffccffcb,0xffcfffce,0xffd1ffd0,0xffd0ffd0,
-0xffcfffcf,0xffceffce,0xffcdffcd,0xffcbffcc,0xffcbffca,0xffceffcc,0xffd1ffcf,0xffd4ffd2,0xffd6ffd5,0xffd8ffd6,0xffdaffd9,0xffdbffda,0xffd6ffd9,0xffd6ffd6,0xffdbffd9,0xffdaffdb,0xffd8ffd9,0xffd4ffd6,0xffcdffd1,0xa5bdffc6,0x000001b9,0x00000000,0x00000000,0x00000000,0x00000000,0xab820182,0xff89ff84,0xff93ff8f,0xff9cff98,0xffa2ff9f,0xffaaffa6,0xffb9ffb1,
-0xffbeffbb,0xffb9ffb9,0xffbcffb9,0xffc1ffbe,0xffc4ffc3,0xffc8ffc6,0xffcbffc9,0xffceffcd,0xffcfffcf,0xffceffce,0xffceffce,0xffcdffcd,0xffcdffcd,0xffccffcd,0xffcbffcc,0xffceffcc,0xffd1ffcf,0xffd4ffd2,0xffd6ffd5,0xffd8ffd6,0xffdaffd9,0xffd6ffd8,0xffd6ffd6,0xffd9ffd6,0xffdaffda,0xffd9ffda,0xffd5ffd6,0xffd0ffd3,0xffc4ffcc,0x03b3a5bc,0x00000000,0x00000000,
-0x00000000,0x00000000,0x17820000,0xff85e182,0xff91ff8b,0xff9aff96,0xffa1ff9e,0xffa8ffa5,0xffaeffab,0xffb4ffb1,0xffb9ffb6,0xffbdffbb,0xffc2ffbf,0xffc6ffc4,0xffc9ffc7,0xffcdffcb,0xffceffce,0xffceffce,0xffceffce,0xffceffce,0xffcfffce,0xffcfffcf,0xffcfffcf,0xffceffce,0xffd1ffd0,0xffd4ffd3,0xffd6ffd5,0xffd9ffd8,0xffdaffda,0xffdbffdb,0xffdcffdc,0xffdcffdc,
-0xffdaffdb,0xffd8ffda,0xffd4ffd6,0xffceffd2,0xe3bfffc8,0x00001fb7,0x00000000,0x00000000,0x00000000,0x00000000,0x43820000,0xff85fd82,0xff90ff8b,0xff99ff95,0xffa1ff9d,0xffa8ffa5,0xffaeffab,0xffb3ffb1,0xffb9ffb6,0xffbeffbb,0xffc2ffc0,0xffc6ffc4,0xffcaffc8,0xffccffcb,0xffccffcc,0xffccffcc,0xffcdffcd,0xffceffce,0xffcfffce,0xffd0ffcf,0xffd0ffd0,0xffd0ffd0,
-0xffd3ffd1,0xffd6ffd4,0xffd8ffd6,0xffdaffd9,0xffdbffda,0xffdbffdb,0xffdbffdb,0xffdaffdb,0xffd8ffd9,0xffd5ffd6,0xffceffd2,0xfdc1ffc9,0x000047b9,0x00000000,0x00000000,0x00000000,0x00000000,0xd7820782,0xff89ff84,0xff93ff8f,0xff9dff99,0xffa4ffa1,0xffabffa8,0xffb1ffae,0xffb7ffb4,0xffbcffb9,0xffc1ffbe,0xffc5ffc3,0xffc9ffc7,0xffcaffca,0xffcbffcb,0xffccffcc,
-0xffceffcd,0xffcfffce,0xffd0ffd0,0xffd1ffd1,0xffd2ffd2,0xffd3ffd3,0xffd5ffd3,0xffd6ffd6,0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffdcffdc,0xffdbffdc,0xffdaffdb,0xffd6ffd8,0xffd1ffd4,0xffc7ffcd,0x09b6c9be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x0d820000,0xff8bb985,0xff95ff91,0xff9cff99,0xffa2ff9f,0xffaaffa5,0xffb9ffaf,0xffbdffbb,0xffb8ffbb,0xffbbffb9,0xffbfffbd,0xffc2ffc1,0xffc6ffc4,0xffc9ffc8,0xffccffcb,0xffcfffce,0xffd1ffd0,0xffd3ffd2,0xffd1ffd2,0xffcfffd0,0xffcdffce,0xffcaffcc,0xffc9ffc9,0xffccffcb,0xffcfffce,0xffd2ffd1,0xffd5ffd4,0xffd6ffd6,0xffd9ffd8,0xffdaffda,
-0xffdbffdb,0xffd6ffd9,0xffd6ffd6,0xffdaffd8,0xffdaffdb,0xffd8ffd9,0xffd4ffd6,0xffceffd2,0xbfc1ffc8,0x00000fbb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x95830382,0xff8eff88,0xff98ff93,0xffa0ff9c,0xffa6ffa3,0xffacffa9,0xffb1ffaf,0xffb6ffb4,0xffbbffb9,0xffbfffbd,0xffc3ffc1,0xffc7ffc5,0xffcaffc9,0xffcdffcc,0xffd0ffcf,0xffd2ffd2,0xffd1ffd2,
-0xffd0ffd1,0xffcfffd0,0xffceffcf,0xffccffcd,0xffccffcb,0xffd0ffce,0xffd3ffd1,0xffd5ffd4,0xffd8ffd6,0xffd9ffd9,0xffdbffda,0xffdcffdc,0xffddffdc,0xffdcffdd,0xffdcffdc,0xffdaffdb,0xffd6ffd8,0xffd1ffd4,0xffc6ffcd,0x03b99bbf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0b820000,0xff86c382,0xff92ff8c,0xff9bff97,0xffa2ff9f,0xffa8ffa5,0xffaeffab,
-0xffb4ffb1,0xffb9ffb6,0xffbdffbb,0xffc1ffbf,0xffc5ffc3,0xffc9ffc7,0xffccffcb,0xffcfffce,0xffd0ffd0,0xffcfffd0,0xffcfffcf,0xffcfffcf,0xffceffcf,0xffceffce,0xffcdffcd,0xffd0ffce,0xffd3ffd1,0xffd5ffd4,0xffd8ffd6,0xffdaffd9,0xffdbffda,0xffdcffdb,0xffdcffdc,0xffdcffdc,0xffdbffdb,0xffd8ffda,0xffd4ffd6,0xffcdffd2,0xbdbfffc7,0x000005b8,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xef833582,0xff8fff88,0xff99ff93,0xffa1ff9d,0xffa8ffa4,0xffaeffab,0xffb4ffb1,0xffb9ffb6,0xffbeffbb,0xffc2ffc0,0xffc6ffc4,0xffcaffc8,0xffceffcc,0xffd0ffcf,0xffcfffcf,0xffcfffcf,0xffd0ffcf,0xffd0ffd0,0xffd0ffd0,0xffd0ffd0,0xffd0ffcf,0xffd3ffd1,0xffd6ffd4,0xffd8ffd6,0xffdaffd9,0xffdbffdb,0xffdcffdc,0xffddffdd,0xffdcffdc,
-0xffdbffdb,0xffd8ffd9,0xffd3ffd6,0xffcaffcf,0x33b9f3c2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff837682,0xff8fff89,0xff99ff93,0xffa1ff9d,0xffa8ffa4,0xffaeffab,0xffb4ffb1,0xffb9ffb7,0xffbeffbc,0xffc3ffc0,0xffc7ffc5,0xffcbffc9,0xffcdffcc,0xffcdffcd,0xffceffcd,0xffcfffce,0xffcfffcf,0xffd0ffd0,0xffd1ffd1,0xffd1ffd1,0xffd2ffd1,
-0xffd5ffd3,0xffd6ffd6,0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffdcffdc,0xffdcffdc,0xffdbffdb,0xffd8ffd9,0xffd3ffd6,0xffcbffd0,0x76bcffc4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21820000,0xff86e982,0xff93ff8d,0xff9cff97,0xffa4ffa0,0xffabffa8,0xffb1ffae,0xffb7ffb4,0xffbdffb9,0xffc1ffbf,0xffc6ffc4,0xffcaffc8,0xffcbffcb,0xffccffcc,0xffcdffcd,
-0xffcfffce,0xffd0ffd0,0xffd2ffd1,0xffd3ffd2,0xffd3ffd3,0xffd4ffd4,0xffd6ffd5,0xffd9ffd6,0xffdbffda,0xffdcffdb,0xffddffdc,0xffddffdd,0xffdcffdc,0xffdaffdb,0xffd6ffd8,0xffcfffd3,0xf3c0ffc9,0x000025b9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x95850582,0xff92ff8b,0xff9aff96,0xffa1ff9e,0xffa7ffa4,0xffadffaa,0xffb2ffaf,0xffb7ffb4,0xffbbffb9,0xffbfffbd,0xffc3ffc1,0xffc7ffc5,0xffcaffc8,0xffcdffcc,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd2ffd3,0xffd0ffd1,0xffceffcf,0xffccffcd,0xffcbffca,0xffceffcd,0xffd1ffd0,0xffd4ffd3,0xffd6ffd5,0xffd8ffd6,0xffdaffd9,0xffdcffdb,
-0xffdcffdc,0xffddffdd,0xffddffdd,0xffdcffdc,0xffdaffdb,0xffd6ffd9,0xffd2ffd5,0xffc7ffce,0x05b999c0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01820000,0xff899383,0xff95ff90,0xff9eff9a,0xffa5ffa2,0xffacffa9,0xffb1ffae,0xffb6ffb4,0xffbbffb9,0xffc0ffbd,0xffc4ffc2,0xffc8ffc6,0xffcbffc9,0xffceffcd,0xffd1ffd0,0xffd3ffd2,0xffd3ffd3,
-0xffd1ffd2,0xffd0ffd1,0xffcfffd0,0xffcdffce,0xffceffcd,0xffd1ffd0,0xffd4ffd3,0xffd6ffd5,0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffddffdc,0xffddffdd,0xffddffdd,0xffdbffdc,0xffd9ffda,0xffd5ffd6,0xffceffd2,0x91bfffc6,0x000003b8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc3831382,0xff8fff88,0xff99ff95,0xffa1ff9d,0xffa8ffa5,0xffaeffab,
-0xffb4ffb1,0xffb9ffb6,0xffbeffbb,0xffc2ffc0,0xffc6ffc4,0xffcaffc8,0xffcdffcb,0xffd0ffcf,0xffd2ffd1,0xffd1ffd1,0xffd0ffd1,0xffd0ffd0,0xffd0ffd0,0xffcfffcf,0xffceffce,0xffd1ffd0,0xffd4ffd3,0xffd6ffd5,0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffddffdc,0xffddffdd,0xffdcffdd,0xffdbffdb,0xffd6ffd9,0xffd2ffd5,0xffc8ffce,0x11b9c7c0,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x3f820000,0xff8bf384,0xff97ff92,0xffa0ff9b,0xffa7ffa4,0xffaeffab,0xffb4ffb1,0xffb9ffb6,0xffbeffbc,0xffc3ffc1,0xffc7ffc5,0xffcbffc9,0xffceffcd,0xffd1ffd0,0xffd0ffd0,0xffd0ffd0,0xffd1ffd0,0xffd1ffd1,0xffd1ffd1,0xffd1ffd1,0xffd1ffd0,0xffd4ffd3,0xffd6ffd6,0xffd9ffd8,0xffdbffda,0xffdcffdc,0xffddffdd,0xffddffdd,0xffdcffdd,
-0xffdaffdb,0xffd6ffd9,0xffd0ffd4,0xf5c3ffcb,0x000041bd,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xa1820182,0xff8cff86,0xff97ff92,0xffa0ff9c,0xffa7ffa4,0xffaeffab,0xffb4ffb1,0xffb9ffb7,0xffbfffbc,0xffc3ffc1,0xffc7ffc5,0xffcbffc9,0xffceffcd,0xffceffce,0xffcfffcf,0xffd0ffcf,0xffd1ffd0,0xffd1ffd1,0xffd2ffd2,0xffd2ffd2,0xffd3ffd2,
-0xffd6ffd5,0xffd8ffd6,0xffdaffd9,0xffdcffdb,0xffddffdc,0xffddffdd,0xffdcffdd,0xffdaffdb,0xffd6ffd9,0xffd2ffd5,0xffc6ffcd,0x01b9a5be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfb833782,0xff90ff89,0xff9bff96,0xffa3ff9f,0xffabffa7,0xffb1ffae,0xffb7ffb4,0xffbdffb9,0xffc2ffbf,0xffc6ffc4,0xffcbffc9,0xffccffcc,0xffcdffcd,0xffceffce,
-0xffd0ffcf,0xffd1ffd0,0xffd2ffd2,0xffd3ffd3,0xffd4ffd4,0xffd5ffd5,0xffd6ffd6,0xffdaffd9,0xffdbffdb,0xffddffdc,0xffddffdd,0xffddffdd,0xffdbffdc,0xffd9ffda,0xffd4ffd6,0xffcbffd0,0x3bbcf9c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x01820000,0xf78c7085,0xff97ff92,0xff9fff9c,0xffa6ffa3,0xffacffa9,0xffb2ffaf,0xffb7ffb4,0xffbbffb9,0xffc0ffbd,0xffc3ffc2,0xffc7ffc5,0xffcbffc9,0xffceffcc,0xffd1ffcf,0xffd3ffd2,0xffd5ffd4,0xffd4ffd5,0xffd2ffd3,0xffcfffd0,0xffcdffce,0xffcdffcc,0xffd0ffce,0xffd3ffd1,0xffd5ffd4,0xffd8ffd6,0xffdaffd9,0xffdbffda,0xffdcffdc,
-0xffddffdd,0xffddffdd,0xffddffdd,0xffdbffdc,0xffd9ffda,0xffd4ffd6,0xffcdffd1,0x68c0fbc6,0x000001b9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7a840182,0xff92ff8a,0xff9cff97,0xffa4ffa0,0xffabffa7,0xffb1ffae,0xffb6ffb3,0xffbbffb9,0xffc0ffbe,0xffc4ffc2,0xffc8ffc6,0xffccffca,0xffcfffcd,0xffd2ffd0,0xffd4ffd3,0xffd4ffd4,
-0xffd2ffd3,0xffd1ffd2,0xffd0ffd1,0xffceffcf,0xffcfffce,0xffd2ffd1,0xffd5ffd4,0xffd8ffd6,0xffdaffd9,0xffdbffdb,0xffddffdc,0xffddffdd,0xffddffdd,0xffdcffdd,0xffdbffdc,0xffd6ffd9,0xffd2ffd5,0xfdc7ffcd,0x01b876c0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x13820000,0xff8ac584,0xff97ff91,0xffa0ff9b,0xffa7ffa4,0xffaeffaa,
-0xffb3ffb1,0xffb9ffb6,0xffbeffbb,0xffc2ffc0,0xffc6ffc4,0xffcaffc8,0xffceffcc,0xffd1ffcf,0xffd3ffd2,0xffd2ffd2,0xffd1ffd2,0xffd1ffd1,0xffd1ffd1,0xffd0ffd0,0xffcfffcf,0xffd3ffd1,0xffd5ffd4,0xffd8ffd6,0xffdaffd9,0xffdcffdb,0xffddffdc,0xffddffdd,0xffddffdd,0xffdcffdd,0xffdaffdb,0xffd6ffd8,0xffcfffd3,0xc9c1ffc9,0x000013bb,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xf3863d82,0xff93ff8e,0xff9eff9a,0xffa6ffa2,0xffadffaa,0xffb3ffb0,0xffb9ffb6,0xffbeffbc,0xffc3ffc1,0xffc7ffc5,0xffcbffc9,0xffcfffcd,0xffd1ffd0,0xffd1ffd1,0xffd1ffd1,0xffd1ffd1,0xffd2ffd2,0xffd2ffd2,0xffd1ffd2,0xffd2ffd1,0xffd5ffd4,0xffd8ffd6,0xffdaffd9,0xffdcffdb,0xffddffdc,0xffddffdd,0xffddffdd,0xffdcffdc,
-0xffd9ffdb,0xffd4ffd6,0xffcbffd1,0x45bef7c4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0xff88b382,0xff95ff8f,0xff9fff9a,0xffa7ffa3,0xffadffaa,0xffb4ffb1,0xffb9ffb7,0xffbfffbc,0xffc3ffc1,0xffc8ffc6,0xffccffca,0xffcfffce,0xffcfffcf,0xffd0ffcf,0xffd1ffd0,0xffd1ffd1,0xffd2ffd2,0xffd3ffd2,0xffd3ffd3,0xffd4ffd3,
-0xffd6ffd6,0xffd9ffd8,0xffdbffda,0xffddffdc,0xffddffdd,0xffddffdd,0xffdcffdd,0xffdaffdb,0xffd6ffd8,0xffceffd3,0xadc0ffc7,0x000009b8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4b820000,0xff8df785,0xff99ff93,0xffa2ff9e,0xffaaffa6,0xffb1ffad,0xffb7ffb4,0xffbdffb9,0xffc2ffbf,0xffc7ffc4,0xffcbffc9,0xffcdffcd,0xffceffce,0xffcfffcf,
-0xffd0ffd0,0xffd2ffd1,0xffd3ffd2,0xffd4ffd4,0xffd5ffd5,0xffd6ffd5,0xffd8ffd6,0xffdaffd9,0xffdcffdb,0xffddffdd,0xffddffdd,0xffddffdd,0xffdbffdc,0xffd6ffd9,0xffd1ffd5,0xfbc4ffcc,0x000047be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x43860000,0xff92df8b,0xff9dff98,0xffa4ffa1,0xffabffa8,0xffb1ffae,0xffb6ffb3,0xffbbffb9,0xffc0ffbd,0xffc4ffc2,0xffc7ffc6,0xffcbffc9,0xffceffcd,0xffd1ffd0,0xffd4ffd3,0xffd6ffd5,0xffd4ffd6,0xffd2ffd3,0xffd0ffd1,0xffcdffcf,0xffceffcd,0xffd1ffcf,0xffd4ffd2,0xffd6ffd5,0xffd9ffd6,0xffdaffd9,0xffdcffdb,0xffddffdc,
-0xffddffdd,0xffddffdd,0xffdcffdd,0xffdaffdb,0xffd6ffd9,0xffd1ffd4,0xe5c5ffcb,0x00003dbf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf18b4986,0xff99ff93,0xffa2ff9e,0xffa9ffa6,0xffb0ffac,0xffb5ffb3,0xffbbffb8,0xffbfffbd,0xffc4ffc2,0xffc8ffc6,0xffccffca,0xffcfffcd,0xffd2ffd1,0xffd5ffd4,0xffd4ffd5,
-0xffd3ffd4,0xffd2ffd2,0xffd0ffd1,0xffceffcf,0xffd0ffcf,0xffd3ffd2,0xffd6ffd5,0xffd8ffd6,0xffdaffd9,0xffdcffdb,0xffddffdc,0xffddffdd,0xffddffdd,0xffdbffdc,0xffd9ffda,0xffd5ffd6,0xffccffd1,0x55bfefc6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb1850982,0xff93ff8c,0xff9eff99,0xffa6ffa2,0xffadffa9,
-0xffb3ffb0,0xffb9ffb6,0xffbeffbb,0xffc2ffc0,0xffc7ffc5,0xffcbffc9,0xffceffcc,0xffd1ffd0,0xffd4ffd3,0xffd3ffd3,0xffd2ffd2,0xffd2ffd2,0xffd1ffd1,0xffd0ffd1,0xffd0ffd0,0xffd4ffd2,0xffd6ffd5,0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffddffdd,0xffddffdd,0xffddffdd,0xffdbffdc,0xffd8ffda,0xffd3ffd6,0xffc8ffcf,0x09bba9c2,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x3d830000,0xff90e988,0xff9cff97,0xffa4ffa0,0xffacffa8,0xffb2ffaf,0xffb8ffb6,0xffbeffbb,0xffc3ffc0,0xffc7ffc5,0xffcbffc9,0xffcfffcd,0xffd2ffd1,0xffd2ffd2,0xffd2ffd2,0xffd2ffd2,0xffd2ffd2,0xffd2ffd2,0xffd2ffd2,0xffd3ffd2,0xffd6ffd5,0xffd9ffd6,0xffdbffda,0xffdcffdb,0xffddffdd,0xffddffdd,0xffdcffdd,0xffdaffdc,
-0xffd6ffd9,0xffd1ffd4,0xe7c4ffcc,0x000039be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xab830582,0xff92ff8a,0xff9dff98,0xffa5ffa1,0xffadffa9,0xffb3ffb0,0xffb9ffb6,0xffbfffbc,0xffc3ffc1,0xffc8ffc6,0xffccffca,0xffcfffce,0xffd0ffd0,0xffd0ffd0,0xffd1ffd1,0xffd2ffd2,0xffd3ffd2,0xffd3ffd3,0xffd3ffd3,0xffd5ffd4,
-0xffd8ffd6,0xffdaffd9,0xffdcffdb,0xffddffdc,0xffddffdd,0xffddffdd,0xffdbffdc,0xffd8ffda,0xffd3ffd6,0xffc8ffcf,0x07bba7c1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf1874982,0xff96ff8f,0xffa0ff9b,0xffa9ffa5,0xffb0ffac,0xffb6ffb3,0xffbcffb9,0xffc2ffbf,0xffc6ffc4,0xffcbffc9,0xffceffcd,0xffcfffce,0xffd0ffcf,
-0xffd1ffd0,0xffd2ffd2,0xffd3ffd3,0xffd4ffd4,0xffd5ffd5,0xffd6ffd5,0xffd9ffd6,0xffdbffda,0xffdcffdc,0xffddffdd,0xffddffdd,0xffdcffdc,0xffd9ffdb,0xffd5ffd6,0xffccffd1,0x4bbef3c5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xab8c1786,0xff98ff91,0xffa2ff9e,0xffa9ffa6,0xffafffac,0xffb5ffb2,0xffb9ffb8,0xffbfffbd,0xffc3ffc1,0xffc7ffc5,0xffcbffc9,0xffceffcd,0xffd1ffd0,0xffd4ffd3,0xffd6ffd5,0xffd5ffd6,0xffd3ffd4,0xffd1ffd2,0xffceffcf,0xffcfffcd,0xffd2ffd0,0xffd4ffd3,0xffd6ffd6,0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffddffdc,
-0xffddffdd,0xffdcffdd,0xffdbffdc,0xffd8ffda,0xffd3ffd6,0xffc7ffcf,0x13bfafc3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x27860000,0xff93cd8c,0xff9fff9a,0xffa7ffa3,0xffaeffab,0xffb4ffb1,0xffb9ffb7,0xffbfffbc,0xffc3ffc1,0xffc8ffc6,0xffccffca,0xffcfffcd,0xffd2ffd1,0xffd5ffd4,0xffd5ffd5,
-0xffd3ffd4,0xffd2ffd3,0xffd0ffd1,0xffcfffd0,0xffd1ffcf,0xffd4ffd2,0xffd6ffd5,0xffd9ffd8,0xffdaffda,0xffdcffdb,0xffdcffdc,0xffddffdd,0xffdcffdc,0xffdaffdb,0xffd6ffd8,0xffd0ffd4,0xc7c4ffca,0x00001fc0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff8d8287,0xff9bff95,0xffa4ff9f,0xffabffa8,
-0xffb2ffaf,0xffb8ffb5,0xffbdffb9,0xffc2ffc0,0xffc6ffc4,0xffcbffc9,0xffceffcc,0xffd1ffd0,0xffd4ffd3,0xffd3ffd4,0xffd3ffd3,0xffd2ffd2,0xffd1ffd2,0xffd0ffd1,0xffd1ffd0,0xffd4ffd3,0xffd6ffd6,0xffd9ffd8,0xffdbffda,0xffdcffdc,0xffddffdd,0xffddffdd,0xffdcffdc,0xffdaffdb,0xffd6ffd8,0xffceffd2,0x82c1fdc8,0x000003bb,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc98a2384,0xff98ff91,0xffa2ff9d,0xffaaffa6,0xffb1ffae,0xffb7ffb4,0xffbdffb9,0xffc2ffc0,0xffc7ffc5,0xffcbffc9,0xffcfffcd,0xffd2ffd1,0xffd2ffd2,0xffd2ffd2,0xffd2ffd2,0xffd2ffd2,0xffd2ffd2,0xffd2ffd2,0xffd4ffd2,0xffd6ffd5,0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffdcffdc,0xffdcffdc,0xffdbffdc,0xffd8ffda,
-0xffd4ffd6,0xffcaffd0,0x1fbecdc4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0xff8c8d85,0xff9aff93,0xffa3ff9f,0xffabffa7,0xffb2ffaf,0xffb8ffb5,0xffbeffbb,0xffc3ffc1,0xffc8ffc6,0xffccffca,0xffd0ffce,0xffd0ffd0,0xffd1ffd1,0xffd1ffd1,0xffd2ffd2,0xffd3ffd3,0xffd3ffd3,0xffd4ffd4,0xffd6ffd4,
-0xffd8ffd6,0xffdaffd9,0xffdcffdb,0xffddffdc,0xffddffdd,0xffdcffdc,0xffdaffdb,0xffd6ffd8,0xffceffd3,0x90c1ffc8,0x000005b9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31830000,0xff91e589,0xff9dff98,0xffa7ffa2,0xffaeffab,0xffb5ffb2,0xffbbffb8,0xffc1ffbe,0xffc6ffc4,0xffcbffc8,0xffceffcd,0xffcfffce,0xffd0ffcf,
-0xffd1ffd0,0xffd2ffd2,0xffd3ffd3,0xffd4ffd4,0xffd5ffd5,0xffd6ffd6,0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffdcffdc,0xffdcffdc,0xffdaffdb,0xffd6ffd9,0xffd1ffd5,0xddc5ffcc,0x00002fbf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01880000,0xe792668b,0xff9eff98,0xffa6ffa2,0xffadffaa,0xffb4ffb1,0xffb9ffb6,0xffbeffbc,0xffc3ffc0,0xffc7ffc5,0xffcbffc9,0xffceffcc,0xffd1ffd0,0xffd4ffd3,0xffd6ffd5,0xffd5ffd6,0xffd3ffd4,0xffd1ffd2,0xffceffcf,0xffcfffce,0xffd2ffd1,0xffd5ffd3,0xffd6ffd6,0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffdcffdc,
-0xffdcffdc,0xffdbffdb,0xffd8ffda,0xffd4ffd6,0xffcdffd1,0x56c2f1c6,0x000001b9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7a8d0787,0xff9af993,0xffa4ff9f,0xffacffa8,0xffb3ffaf,0xffb8ffb6,0xffbeffbb,0xffc3ffc0,0xffc7ffc5,0xffcbffc9,0xffceffcd,0xffd2ffd0,0xffd4ffd3,0xffd5ffd5,
-0xffd3ffd4,0xffd2ffd2,0xffd0ffd1,0xffcfffcf,0xffd1ffd0,0xffd4ffd3,0xffd6ffd5,0xffd8ffd8,0xffdaffd9,0xffdbffdb,0xffdcffdb,0xffdbffdb,0xffdaffdb,0xffd6ffd9,0xffd2ffd5,0xf9c8ffcd,0x05be7ec2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x51880000,0xff96e98e,0xffa1ff9c,0xffa9ffa5,
-0xffb0ffad,0xffb7ffb3,0xffbcffb9,0xffc1ffbf,0xffc6ffc4,0xffcaffc8,0xffceffcc,0xffd1ffd0,0xffd4ffd3,0xffd3ffd4,0xffd3ffd3,0xffd2ffd2,0xffd1ffd2,0xffd0ffd1,0xffd2ffd0,0xffd4ffd3,0xffd6ffd6,0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffdcffdc,0xffdcffdc,0xffdaffdb,0xffd6ffd9,0xffd1ffd5,0xebc6ffcc,0x00004fc0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x07840000,0xfd92888b,0xff9fff99,0xffa8ffa3,0xffafffac,0xffb6ffb3,0xffbcffb9,0xffc1ffbf,0xffc6ffc4,0xffcaffc8,0xffceffcc,0xffd2ffd0,0xffd2ffd2,0xffd2ffd2,0xffd2ffd2,0xffd2ffd2,0xffd2ffd2,0xffd2ffd2,0xffd4ffd2,0xffd6ffd5,0xffd9ffd8,0xffdaffd9,0xffdbffdb,0xffdbffdb,0xffdbffdb,0xffd9ffda,0xffd5ffd6,
-0xffceffd2,0x90c2fdc8,0x000007bd,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x68860182,0xff95f98d,0xffa0ff9b,0xffa9ffa5,0xffb1ffad,0xffb7ffb4,0xffbdffb9,0xffc2ffc0,0xffc7ffc5,0xffccffc9,0xffcfffce,0xffd0ffd0,0xffd1ffd1,0xffd1ffd1,0xffd2ffd2,0xffd3ffd2,0xffd3ffd3,0xffd4ffd3,0xffd6ffd4,
-0xffd8ffd6,0xffdaffd9,0xffdbffdb,0xffdcffdc,0xffdcffdc,0xffdaffdb,0xffd6ffd9,0xffd2ffd5,0xf5c7ffcd,0x000063c1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb98b1385,0xff99ff92,0xffa4ff9f,0xffacffa8,0xffb4ffb0,0xffb9ffb7,0xffc0ffbd,0xffc5ffc3,0xffcaffc8,0xffceffcc,0xffceffce,0xffcfffcf,
-0xffd1ffd0,0xffd2ffd1,0xffd3ffd2,0xffd4ffd4,0xffd5ffd4,0xffd6ffd5,0xffd9ffd6,0xffdaffd9,0xffdbffdb,0xffdbffdb,0xffdaffdb,0xffd8ffd9,0xffd3ffd6,0xffcaffd0,0x17bfb7c4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x178c0000,0xfb97a291,0xffa2ff9d,0xffabffa7,0xffb1ffae,0xffb7ffb5,0xffbdffb9,0xffc2ffbf,0xffc6ffc4,0xffcaffc8,0xffcdffcc,0xffd0ffcf,0xffd3ffd2,0xffd6ffd4,0xffd5ffd6,0xffd2ffd4,0xffd0ffd1,0xffcdffcf,0xffcfffce,0xffd2ffd1,0xffd5ffd3,0xffd6ffd6,0xffd9ffd8,0xffdaffd9,0xffdbffda,0xffdbffdb,
-0xffdaffdb,0xffd8ffd9,0xffd5ffd6,0xffceffd2,0xa2c3ffc9,0x000019bf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xbd92318c,0xff9fff98,0xffa8ffa4,0xffb0ffac,0xffb6ffb3,0xffbcffb9,0xffc1ffbf,0xffc6ffc4,0xffcaffc8,0xffcdffcc,0xffd1ffcf,0xffd4ffd2,0xffd4ffd4,
-0xffd2ffd3,0xffd1ffd2,0xffcfffd0,0xffceffce,0xffd1ffcf,0xffd4ffd2,0xffd6ffd5,0xffd8ffd6,0xffd9ffd8,0xffdaffda,0xffdaffda,0xffd9ffda,0xffd6ffd8,0xffd2ffd5,0xffc8ffcf,0x29c0bdc4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xaa8f1989,0xff9cff96,0xffa6ffa1,
-0xffaeffaa,0xffb5ffb1,0xffbbffb8,0xffc0ffbd,0xffc5ffc2,0xffc9ffc7,0xffcdffcb,0xffd0ffcf,0xffd3ffd2,0xffd3ffd4,0xffd2ffd3,0xffd1ffd2,0xffd1ffd1,0xffd0ffd0,0xffd1ffd0,0xffd4ffd3,0xffd6ffd6,0xffd9ffd8,0xffdaffd9,0xffdbffda,0xffdbffdb,0xffdaffda,0xffd6ffd9,0xffd3ffd5,0xffc9ffcf,0x19bfafc4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x458c0000,0xff98dd91,0xffa4ff9f,0xffadffa9,0xffb4ffb0,0xffb9ffb7,0xffc0ffbd,0xffc5ffc2,0xffc9ffc7,0xffcdffcb,0xffd1ffcf,0xffd1ffd2,0xffd1ffd1,0xffd1ffd1,0xffd1ffd1,0xffd1ffd1,0xffd1ffd1,0xffd3ffd2,0xffd6ffd5,0xffd8ffd6,0xffd9ffd8,0xffdaffda,0xffdaffda,0xffd8ffd9,0xffd6ffd6,0xffd0ffd3,
-0xe1c5ffcb,0x000043c0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xcf8e2d88,0xff9cff95,0xffa6ffa2,0xffafffab,0xffb5ffb2,0xffbcffb9,0xffc1ffbe,0xffc6ffc4,0xffcbffc8,0xffcfffcd,0xffd0ffd0,0xffd0ffd0,0xffd1ffd1,0xffd2ffd1,0xffd2ffd2,0xffd3ffd2,0xffd3ffd3,0xffd5ffd4,
-0xffd8ffd6,0xffd9ffd9,0xffdaffda,0xffdbffdb,0xffdaffda,0xffd8ffd9,0xffd4ffd6,0xffcbffd0,0x2bc0dbc4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05860000,0xf7926c8c,0xffa0ff9a,0xffa9ffa5,0xffb1ffae,0xffb8ffb5,0xffbeffbb,0xffc4ffc1,0xffc9ffc6,0xffcdffcb,0xffceffcd,0xffcfffce,
-0xffd0ffcf,0xffd1ffd1,0xffd2ffd2,0xffd3ffd3,0xffd4ffd4,0xffd5ffd4,0xffd8ffd6,0xffd9ffd9,0xffdaffda,0xffd9ffda,0xffd8ffd9,0xffd4ffd6,0xffcdffd1,0x6cc2f7c7,0x000003bc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29920000,0xff9cc495,0xffa6ffa1,0xffaeffaa,0xffb5ffb2,0xffbbffb8,0xffc0ffbd,0xffc4ffc2,0xffc8ffc6,0xffccffca,0xffcfffce,0xffd2ffd1,0xffd4ffd3,0xffd4ffd5,0xffd1ffd3,0xffcfffd0,0xffcdffcd,0xffcfffcd,0xffd1ffd0,0xffd4ffd3,0xffd6ffd5,0xffd6ffd6,0xffd8ffd8,0xffd9ffd9,0xffd9ffd9,
-0xffd6ffd8,0xffd4ffd6,0xffceffd2,0xbfc5ffc9,0x000037c1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x018e0000,0xd5975691,0xffa3ff9c,0xffacffa8,0xffb3ffb0,0xffb9ffb7,0xffbfffbc,0xffc4ffc1,0xffc8ffc6,0xffccffca,0xffcfffce,0xffd2ffd1,0xffd3ffd3,
-0xffd1ffd2,0xffcfffd0,0xffceffcf,0xffcdffcd,0xffd0ffce,0xffd2ffd1,0xffd5ffd4,0xffd6ffd5,0xffd6ffd6,0xffd8ffd8,0xffd6ffd8,0xffd5ffd6,0xffd2ffd4,0xffc9ffcf,0x4cc1d1c5,0x000001b9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd7934f8f,0xffa1ff9a,
-0xffabffa6,0xffb2ffae,0xffb8ffb5,0xffbeffbb,0xffc3ffc1,0xffc8ffc5,0xffccffca,0xffcfffce,0xffd2ffd1,0xffd2ffd3,0xffd1ffd2,0xffd0ffd1,0xffd0ffd0,0xffcfffcf,0xffd1ffcf,0xffd4ffd2,0xffd6ffd5,0xffd8ffd6,0xffd9ffd8,0xffd9ffd9,0xffd8ffd9,0xffd6ffd8,0xffd3ffd5,0xffcbffd0,0x52c1d7c6,0x000001be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x74920d8b,0xff9ef397,0xffa9ffa4,0xffb1ffad,0xffb7ffb4,0xffbeffbb,0xffc3ffc0,0xffc7ffc5,0xffcbffca,0xffcfffcd,0xffd0ffd0,0xffd0ffd0,0xffd0ffd0,0xffd0ffd0,0xffd0ffd0,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd6ffd5,0xffd6ffd6,0xffd8ffd8,0xffd6ffd6,0xffd5ffd6,0xffd0ffd3,0xefc7ffcc,
-0x07bf7ac2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x058a0000,0xf7957a8f,0xffa2ff9c,0xffabffa7,0xffb3ffaf,0xffb9ffb6,0xffbfffbd,0xffc5ffc2,0xffc9ffc7,0xffcdffcb,0xffcfffcf,0xffcfffcf,0xffd0ffd0,0xffd1ffd0,0xffd1ffd1,0xffd2ffd1,0xffd2ffd2,0xffd4ffd3,
-0xffd6ffd6,0xffd8ffd6,0xffd9ffd9,0xffd8ffd9,0xffd6ffd8,0xffd4ffd6,0xffcdffd1,0x72c3f5c7,0x00000bbc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x218d0000,0xff98b192,0xffa5ffa0,0xffaeffaa,0xffb5ffb2,0xffbcffb9,0xffc2ffbf,0xffc7ffc4,0xffcbffc9,0xffcdffcc,0xffcdffcd,
-0xffcfffce,0xffd0ffcf,0xffd1ffd0,0xffd2ffd1,0xffd2ffd2,0xffd4ffd3,0xffd6ffd5,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd4ffd5,0xffceffd1,0xb4c4ffc9,0x000021bf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3d950000,0xfd9fb499,0xffa9ffa4,0xffb1ffad,0xffb7ffb4,0xffbdffb9,0xffc2ffc0,0xffc6ffc4,0xffcaffc8,0xffcdffcc,0xffd0ffcf,0xffd2ffd1,0xffd2ffd3,0xffd0ffd1,0xffcdffce,0xffcbffcb,0xffcdffcc,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd5ffd5,0xffd6ffd6,0xffd6ffd6,0xffd5ffd6,
-0xffd3ffd4,0xffcdffd0,0xbac5ffc9,0x01bc42c0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01920000,0xc69b5496,0xffa6ffa1,0xffafffab,0xffb6ffb3,0xffbcffb9,0xffc1ffbe,0xffc6ffc3,0xffc9ffc7,0xffcdffcb,0xffd0ffce,0xffd1ffd1,
-0xffcfffd0,0xffcdffce,0xffcbffcc,0xffcbffcb,0xffceffcd,0xffd0ffcf,0xffd2ffd2,0xffd4ffd3,0xffd5ffd4,0xffd4ffd5,0xffd3ffd4,0xffd0ffd2,0xffc9ffcd,0x52c1c6c4,0x000003bb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x078f0000,0xeb997093,
-0xffa5ff9f,0xffaeffaa,0xffb5ffb2,0xffbcffb9,0xffc1ffbe,0xffc5ffc3,0xffcaffc8,0xffcdffcc,0xffd0ffcf,0xffd1ffd1,0xffcfffd0,0xffcfffcf,0xffceffce,0xffcdffcd,0xffcfffce,0xffd2ffd1,0xffd4ffd3,0xffd6ffd5,0xffd6ffd6,0xffd6ffd6,0xffd5ffd6,0xffd1ffd3,0xffcbffcf,0x66c3e3c6,0x000003c1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x84961590,0xffa2ef9c,0xffacffa7,0xffb4ffb0,0xffb9ffb7,0xffc0ffbd,0xffc5ffc2,0xffc9ffc7,0xffcdffcb,0xffceffce,0xffceffce,0xffceffce,0xffcdffce,0xffcdffcd,0xffceffcd,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd5ffd4,0xffd4ffd5,0xffd3ffd4,0xffcfffd1,0xedc7ffcb,0x13be86c3,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x238f0000,0xfd9b9a95,0xffa7ffa1,0xffafffab,0xffb7ffb3,0xffbdffb9,0xffc2ffc0,0xffc7ffc5,0xffcbffc9,0xffceffcd,0xffceffce,0xffceffce,0xffcfffcf,0xffcfffcf,0xffd0ffd0,0xffd0ffd0,0xffd3ffd2,
-0xffd5ffd4,0xffd6ffd5,0xffd6ffd6,0xffd5ffd6,0xffd3ffd4,0xffcdffd0,0x9ec4fbc8,0x00001fc0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4092018d,0xff9dbd98,0xffa9ffa4,0xffb2ffae,0xffb9ffb5,0xffbfffbc,0xffc4ffc2,0xffc9ffc7,0xffcbffca,0xffccffcb,
-0xffcdffcc,0xffceffcd,0xffcfffce,0xffd0ffcf,0xffd0ffd0,0xffd2ffd1,0xffd4ffd3,0xffd4ffd4,0xffd4ffd4,0xffd2ffd3,0xffcdffd0,0xc0c5ffc9,0x00003dc1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x25980000,0xe7a18a9c,0xffabffa5,0xffb3ffaf,0xffb9ffb6,0xffbeffbc,0xffc3ffc1,0xffc7ffc5,0xffcaffc9,0xffcdffcc,0xffcfffce,0xffd0ffd0,0xffcdffce,0xffcaffcb,0xffc8ffc8,0xffcbffca,0xffceffcc,0xffd0ffcf,0xffd1ffd1,0xffd2ffd2,0xffd3ffd2,0xffd1ffd2,0xffcfffd0,
-0xffc9ffcd,0x94c3e9c6,0x000029c1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x989d3199,0xffa7eba2,0xffb1ffac,0xffb7ffb4,0xffbdffb9,0xffc2ffbf,0xffc6ffc4,0xffc9ffc8,0xffccffcb,0xffcdffcd,
-0xffcbffcd,0xffc9ffca,0xffc8ffc9,0xffc8ffc7,0xffcbffca,0xffcdffcc,0xffcfffce,0xffd0ffd0,0xffd0ffd0,0xffcfffd0,0xffccffce,0xe9c6ffc9,0x2fc098c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x07930000,
-0xd19c6698,0xffa8ffa1,0xffb1ffac,0xffb7ffb4,0xffbdffb9,0xffc2ffc0,0xffc7ffc5,0xffcaffc9,0xffceffcc,0xffceffce,0xffcdffcd,0xffccffcc,0xffcbffcb,0xffcbffcb,0xffcdffcc,0xffd0ffce,0xffd1ffd1,0xffd2ffd2,0xffd3ffd3,0xffd2ffd2,0xffcfffd0,0xffc9ffcc,0x58c2c8c5,0x000007be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x709a0b95,0xffa4d49f,0xffaeffaa,0xffb6ffb2,0xffbcffb9,0xffc1ffbf,0xffc6ffc4,0xffcaffc8,0xffcbffcb,0xffcbffcb,0xffcaffcb,0xffcaffca,0xffcaffca,0xffcbffca,0xffcdffcc,0xffcfffce,0xffd0ffd0,0xffd0ffd0,0xffcfffd0,0xffcbffcd,0xd8c4ffc8,0x11bf6cc2,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29930000,0xf39e9a99,0xffa9ffa4,0xffb2ffae,0xffb9ffb6,0xffbfffbc,0xffc4ffc2,0xffc9ffc6,0xffcbffca,0xffcbffcb,0xffccffcb,0xffccffcc,0xffcdffcc,0xffcdffcd,0xffceffcd,0xffd0ffcf,
-0xffd2ffd1,0xffd3ffd2,0xffd2ffd3,0xffd0ffd1,0xffcbffce,0x94c4f3c7,0x000023c1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x34970190,0xf7a1aa9b,0xffacffa6,0xffb4ffb0,0xffbbffb7,0xffc1ffbe,0xffc5ffc3,0xffc8ffc7,0xffc9ffc8,
-0xffcaffc9,0xffcbffca,0xffccffcb,0xffccffcc,0xffcdffcc,0xffcfffce,0xffd0ffcf,0xffd0ffd0,0xffceffcf,0xffcaffcd,0xa8c3fbc6,0x000039c0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x09990000,0x9ea2489e,0xffaaeda6,0xffb3ffaf,0xffb9ffb6,0xffbeffbc,0xffc2ffc0,0xffc6ffc4,0xffc9ffc8,0xffcbffca,0xffcbffcb,0xffc8ffc9,0xffc5ffc6,0xffc4ffc4,0xffc7ffc6,0xffcaffc8,0xffccffcb,0xffcdffcc,0xffcdffcd,0xffcdffcd,0xffc9ffcb,0xe7c5ffc6,
-0x4ec09ec3,0x000007bc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3ea0079a,0xd6a794a3,0xffafffab,0xffb6ffb3,0xffbcffb9,0xffc1ffbe,0xffc4ffc2,0xffc7ffc5,0xffc8ffc8,
-0xffc6ffc7,0xffc4ffc5,0xffc2ffc3,0xffc3ffc2,0xffc6ffc5,0xffc8ffc7,0xffcaffc9,0xffcaffca,0xffc8ffc9,0xfdc6ffc7,0x88c2d4c4,0x05bc40bf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x01960000,0x8aa0349a,0xffa7e3a4,0xffb1ffad,0xffb8ffb5,0xffbeffbb,0xffc2ffc0,0xffc6ffc4,0xffc9ffc8,0xffcaffca,0xffc9ffc9,0xffc7ffc8,0xffc7ffc7,0xffc7ffc6,0xffc9ffc8,0xffccffcb,0xffcdffcd,0xffceffce,0xffcdffcd,0xffcaffcc,0xe7c4ffc6,0x2dc086c2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2d9d0000,0xd0a584a1,0xffadfbaa,0xffb6ffb2,0xffbcffb9,0xffc1ffbe,0xffc4ffc2,0xffc7ffc6,0xffc6ffc6,0xffc5ffc5,0xffc5ffc5,0xffc5ffc5,0xffc6ffc5,0xffc8ffc7,0xffcaffc9,0xffcaffca,0xffc9ffca,0xffc5ffc7,0x88c1d4c3,0x000031be,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x15980000,0xcba1709c,0xffabffa5,0xffb4ffb0,0xffb9ffb7,0xffc0ffbd,0xffc4ffc2,0xffc8ffc6,0xffc8ffc8,0xffc8ffc8,0xffc8ffc8,0xffc9ffc9,0xffc9ffc9,0xffcaffc9,0xffccffcc,
-0xffceffcd,0xffceffce,0xffcbffcd,0xffc5ffc9,0x6ec1c7c4,0x00000fbf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x139a0000,0xb6a3669f,0xffacf9a7,0xffb5ffb1,0xffbbffb8,0xffc0ffbe,0xffc3ffc2,0xffc4ffc4,
-0xffc5ffc5,0xffc6ffc5,0xffc7ffc6,0xffc7ffc7,0xffc8ffc8,0xffcaffc9,0xffcaffca,0xffc9ffca,0xf5c5ffc7,0x6ac1b8c3,0x000015bd,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x34a203a0,0xaca968a6,0xf9b0daac,0xffb6ffb2,0xffbbffb9,0xffbfffbd,0xffc1ffc0,0xffc3ffc2,0xffc2ffc3,0xffbfffc0,0xffbbffbd,0xffbdffbc,0xffc0ffbe,0xffc3ffc2,0xffc4ffc3,0xffc5ffc5,0xffc3ffc4,0xd4c2f7c3,0x70c0acc0,0x03b92cbe,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4ca615a3,0xa2ad80a9,0xeab2c8b0,0xffb6f9b5,0xffb9ffb9,0xffbcffbc,0xf7bfffbd,
-0xe4bcecbd,0xd4b9d6bb,0xf0b8dab8,0xffb9f8b8,0xffbdffbb,0xffbeffbd,0xfbbfffbe,0xcac0e8c0,0x76bfaebe,0x17bb4abd,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x2ca1039d,0xb0a878a4,0xffaeebac,0xffb6ffb3,0xffbbffb9,0xffc0ffbe,0xffc3ffc1,0xffc3ffc4,0xffc1ffc2,0xffc0ffc1,0xffc0ffc0,0xffc0ffbf,0xffc3ffc2,0xffc5ffc5,0xffc6ffc6,0xffc5ffc6,0xedc3ffc2,0x78c0bac1,0x03b930be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x58a519a2,0xb2ac8aa9,0xf7b2dab0,0xffb7ffb4,0xffbbffb9,0xffbeffbd,0xffbcffbd,0xffbbffbc,0xffbbffbb,0xffbbffbb,0xffbdffbc,0xffbfffbe,0xffbfffc0,0xe2c0fbc0,0x8cbfb4c0,0x19bb4ebe,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01980000,0x6aa3249d,0xefaaaca7,0xffb2ffad,0xffb9ffb6,0xffbdffbb,0xffc1ffc0,0xffc2ffc2,0xffc2ffc2,0xffc2ffc2,0xffc3ffc2,0xffc3ffc3,0xffc4ffc3,0xffc6ffc5,
-0xffc6ffc6,0xffc2ffc5,0xb0c2efc3,0x26bc70c0,0x000001b8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4ca40ba1,0xc0aa86a8,0xffb0e7ae,0xffb7ffb4,0xffbbffb9,0xffbbffbb,
-0xffbdffbc,0xffbeffbd,0xffbeffbe,0xffbeffbe,0xffbfffbf,0xffbfffbf,0xeac0fdc0,0x88bebcbf,0x0dbb48be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x09a70000,0x4aac2aa9,0x72b25eaf,0x8eb580b3,0x8eb790b5,0x76b98cb8,0x4eb86cb9,0x30b43ab7,0x40b130b3,0x6ab250b1,0x8ab672b5,0x90b88eb7,0x84b990b8,0x5ebb70bb,0x26b948b9,0x000007bb,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10ae07ac,0x30b01eaf,0x1cb31eb2,0x03b410b5,
-0x00000000,0x00000000,0x00000000,0x13af0000,0x2cb31eb2,0x24b424b4,0x0bb416b4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x1aa603a2,0x6eac42aa,0x9eb18eaf,0xb0b6b0b3,0xb0b9b4b7,0x98b9aeb9,0x84b88eb8,0x7ab782b7,0x90b480b6,0xacb69ab4,0xb0b9b0b8,0xb0b9b0bb,0x8abb9ebb,0x4abb6abc,0x03b81eb9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x07aa0000,0x2eae1cab,0x46b240b0,0x36b53eb4,0x20b330b4,0x22b226b2,0x22b226b2,0x30b128b1,0x44b334b2,0x36b750b4,0x22b632b6,0x000007b5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03a30000,0x50a922a6,0x92af76ac,0xc2b4b0b2,0xd0b7ccb6,0xc6b8d0b8,0xb6b8ccb7,0xbcb8c6b8,0xccb8b2b8,0xd0b8d0b8,0xc8b9cab9,0xacbbbcbb,
-0x76bc94bb,0x26b956b9,0x000005b8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0ea701a3,0x34ae22ac,0x50b14ab0,0x56b350b3,
-0x54b45ab2,0x58b450b4,0x56b558b4,0x50b552b5,0x46b550b4,0x24b636b7,0x00000db5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x32821182,
-0x54824a82,0x4c825482,0x0f822c82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2a820782,0x5a824682,0x50825282,0x0d822e82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x18820182,0x54823e82,0x50825c82,0x22824282,0x03820a82,0x00000000,0x00000000,0x10820582,0x22822482,0x34822c82,0x38823482,0x40823c82,0x32824682,0x30823682,0x1a822882,0x0c820e82,0x00000982,0x00000000,
-0x0e820982,0x48822682,0x58825482,0x38825082,0x05822682,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1a820382,0x4e823c82,0x50825882,0x2c824482,
-0x00000782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0x4a822a82,0x5a825682,0x3a825082,0x00001382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x22820782,0x54824682,0x52825882,0x16823082,0x00000182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0x36821882,0x50824c82,0x44825482,0x07822882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x46820582,0xd8829882,0xff82ff82,
-0xff82ff82,0xff82ff82,0xf982ff82,0x9882dc82,0x05823e82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x42820382,0xd8829682,0xff82f982,0xff82ff82,0xff82ff82,0xfd82ff82,0x9482d482,0x07824482,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0f820000,0xae825e82,0xff82df82,0xff82ff82,0xff82ff82,0xff82ff82,0xf582ff82,0xf082f082,0xfa82f682,0xff82f982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf082fd82,0xf082f082,
-0xff82fb82,0xff82ff82,0xff82ff82,0xff82ff82,0xe782ff82,0x6682b282,0x00000982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28821582,0x5a825082,0x4e825a82,0x0f823282,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x32820d82,0x5a824882,0x50825682,0x13823282,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0d820000,0xb8826682,0xff82e982,0xff82ff82,0xff82ff82,0xff82ff82,
-0xc882fb82,0x28828282,0x00000182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x80822b82,0xf382c082,0xff82ff82,0xff82ff82,0xff82ff82,0xe482fd82,0x5a82ac82,0x00000f82,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x27820000,0xc6827c82,0xff82f982,0xff82ff82,0xff82ff82,0xff82ff82,0xaa82e982,0x0f826082,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x66820f82,0xe982b882,0xff82ff82,0xff82ff82,0xff82ff82,0xfb82ff82,0x8282c882,0x00002782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x74820f82,0xff82d782,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xe582ff82,0x44828682,0x00000b82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0d820000,0x84823a82,0xff82e582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xe582ff82,0x0d827482,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29820000,0xf3829882,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x9882f182,0x00002782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x42820382,0xce829482,0xff82fd82,0xff82ff82,0xff82ff82,0xfd82ff82,0x9682d882,0x03823a82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x46820582,0xdc829682,0xff82fd82,0xff82ff82,0xff82ff82,0xff82ff82,0x9882d082,0x03824a82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21820000,0xf7829e82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0x5082c382,0x00000182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc2824782,0xff82fd82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x9e82f782,0x00002782,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x44820182,0xfd82c682,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf382ff82,0x2382a082,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x9a822582,0xff82f782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xca82ff82,0x01824c82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x52820182,0xff82e782,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xde82f982,0xa282b682,0x82828e82,0x6e827282,0x62826482,0x6c826c82,0x6e826882,0x72826a82,0x90828282,0xbe82aa82,0xfb82de82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xdf82ff82,0x00005982,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0d820000,0xf5828c82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x8e82f982,0x00000782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6c820782,0xff82e182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xdd82ff82,0x0b827882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x74820d82,0xff82e582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xdf82ff82,0x07827082,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0f820000,0xf9829282,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0x2982b982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc4823182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x8c82fb82,0x00000f82,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31820000,0xff82c582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xfb82ff82,0x0b828e82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x8a820982,0xff82f982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xb982ff82,0x00002982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x07820000,0xff82a582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xaa82ff82,0x00000d82,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd7822d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x2b82d982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x56820182,0xff82e182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xe382ff82,0x00005382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x5c820182,0xff82e182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xdf82ff82,0x01825882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xe1822f82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xf982ff82,0x01826482,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x70820182,0xff82f782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x2f82dd82,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf3826982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xdb82ff82,0x00003782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x35820000,0xff82d982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x6782f582,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xcd821982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x1b82cd82,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x47820000,0xff82ed82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xef82ff82,0x00003f82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x11820000,0xff82a382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xa882ff82,0x00000b82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x0b820000,0xff82ab82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x9b82ff82,0x00000d82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x47820000,0xff82f382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x9b82ff82,0x00000382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff828f82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf782ff82,0x00004982,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x92820382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x8c82f982,0x00001582,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x13820000,0xfb828c82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x05828882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1b820000,0xff82d782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff84ff84,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xd582ff82,0x00000f82,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfb824b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x4582f382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xd1821582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x1982cd82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xc7821782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x1b82d182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfb824982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff84ff83,0xff85ff84,0xff85ff85,0xff85ff85,0xff83ff84,0x0182a182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x95820182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x4782f582,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff829482,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff85ff84,0xff85ff85,0xff84ff85,0xff82ff83,0x8e82f382,0x03823682,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3c820382,
-0xf1829082,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x9c82ff82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xbd820582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff84ff83,0xff87ff85,0xff89ff88,0xff8aff8a,0xff84ff86,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff84ff84,0xff84ff84,0xff84ff84,0xff83ff84,0xff82ff82,0xff82ff82,0x0782c382,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x27820000,0xff82f382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff84ff84,0xff83ff84,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff83ff83,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff84ff84,0xff85ff84,0xff84ff84,0xff83ff84,0xff82ff82,0xf582ff82,0x00003182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x17820000,0xff82d782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff84ff84,0xff86ff85,0xff86ff86,0xff85ff86,0xcb82ff84,0x00001582,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x13820000,0xff82cd82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xd782ff82,0x00001782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2d820000,0xff82f582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff86ff84,
-0xff89ff87,0xff8bff8a,0xff8cff8c,0xff8cff8c,0xff89ff8b,0x8083ff86,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827082,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff84ff84,0xff84ff84,0xff83ff84,0xff82ff83,0xff82ff82,0xf382ff82,
-0x00002d82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6b820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff86ff85,0xff8aff88,0xff8bff8a,0xff8cff8c,0xff8bff8c,0xff83ff87,0xff82ff82,0xe982ff82,0x7a82a882,0x36825682,0x14822282,0x26821482,0x54823482,0xb0828282,0xff82e782,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff84ff84,0xff84ff84,0xff84ff84,0xff83ff83,0xff82ff82,0xff82ff82,0x00006f82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff828a82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff85ff83,0xff89ff87,0xff8dff8b,0xff90ff8e,0xff90ff91,0xff89ff8d,0xff85ff86,0xff83ff84,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff86ff85,0xff88ff87,0xff8aff89,0xff8aff8a,0xff8aff8a,0xff88ff89,0xff85ff86,0xff82ff84,0x8e82ff82,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd3820782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff88ff85,0xff8aff8a,0xff87ff89,0xff85ff86,0xff84ff84,0xff84ff84,0xff84ff84,0xff85ff85,0xff85ff85,0xff86ff86,0xff87ff86,0xff87ff87,0xff87ff87,0xff86ff87,0xff86ff86,0xff85ff85,
-0xff84ff84,0xff84ff84,0xff87ff85,0xff89ff88,0xff8aff89,0xff8bff8a,0xff8aff8b,0xff88ff89,0xff85ff86,0xff82ff83,0x0782cf82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xc3820582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff87ff86,0xff8aff89,0xff8dff8c,0xff8dff8d,0xff8cff8d,0xff87ff8a,0x0782c584,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xc1820582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff84ff83,0xff84ff84,0xff83ff83,0xff82ff83,0xff82ff82,0xff82ff82,0x0582bf82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xcd820782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff88ff85,0xff8cff8a,
-0xff8fff8e,0xff92ff90,0xff93ff93,0xff93ff93,0xff91ff92,0xfb89ff8e,0x00003585,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x37820000,0xff82f982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff84ff83,0xff86ff85,0xff88ff87,0xff89ff89,0xff89ff89,0xff88ff89,0xff86ff87,0xff83ff84,0xff82ff82,
-0x0782d782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf9823782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff88ff86,0xff8cff8a,0xff90ff8e,0xff92ff91,0xff93ff92,0xff92ff93,0xff88ff8f,0xff82ff84,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff86ff85,0xff88ff87,0xff89ff89,0xff8aff8a,0xff89ff8a,0xff87ff88,0xff84ff86,0xff82ff83,0x3182fb82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2f820000,0xff82fb82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,
-0xff8aff88,0xff8fff8d,0xff93ff91,0xff96ff93,0xff97ff97,0xff90ff93,0xff8bff8d,0xff88ff89,0xff86ff87,0xff85ff85,0xff85ff85,0xff84ff84,0xff84ff84,0xff84ff84,0xff84ff84,0xff83ff84,0xff83ff83,0xff82ff82,0xff82ff82,0xff85ff84,0xff89ff87,0xff8cff8b,0xff8eff8d,0xff90ff8f,0xff91ff90,0xff91ff91,0xff8fff90,0xff8cff8e,0xff87ff89,0xfb82ff84,0x00002f82,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827082,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff89ff87,0xff8eff8b,0xff90ff8f,0xff8dff8f,0xff8bff8c,0xff8aff8a,0xff8aff8a,0xff8aff8a,0xff8bff8a,0xff8bff8b,0xff8cff8c,0xff8dff8c,0xff8dff8d,0xff8dff8d,0xff8dff8d,0xff8cff8d,0xff8bff8c,
-0xff89ff8a,0xff8aff89,0xff8dff8b,0xff8fff8e,0xff90ff90,0xff91ff91,0xff91ff91,0xff8fff90,0xff8bff8e,0xff85ff88,0x7c82ff83,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xff828682,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff89ff87,0xff8dff8c,0xff91ff8f,0xff93ff92,0xff93ff93,0xff93ff93,0xff90ff92,0x8287ff8b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff828282,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff85ff85,0xff88ff87,0xff89ff88,0xff89ff89,0xff88ff89,0xff86ff87,0xff84ff85,0xff82ff82,0x8c82ff82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827882,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff89ff86,0xff8dff8b,0xff92ff90,
-0xff95ff93,0xff98ff97,0xff99ff99,0xff99ff9a,0xff98ff99,0xff92ff96,0x0783db8a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd9820d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff87ff85,0xff8aff88,0xff8dff8c,0xff8fff8e,0xff90ff8f,0xff90ff90,0xff8fff90,0xff8dff8e,0xff89ff8b,0xff83ff86,
-0x7482ff82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff82cb82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff89ff87,0xff8eff8c,0xff92ff90,0xff96ff93,0xff98ff97,0xff99ff98,0xff99ff99,0xff90ff96,0xff86ff8a,0xff82ff83,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff86ff84,0xff89ff88,0xff8cff8b,0xff8fff8d,0xff90ff8f,0xff90ff90,0xff90ff90,0xff8eff8f,0xff8aff8c,0xff85ff88,0xcd82ff83,0x00000382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb4820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff8bff88,
-0xff90ff8d,0xff93ff92,0xff98ff97,0xff9bff9a,0xff9dff9d,0xff97ff9a,0xff92ff93,0xff8fff91,0xff8dff8e,0xff8cff8d,0xff8bff8c,0xff8bff8b,0xff8bff8b,0xff8aff8a,0xff8aff8a,0xff89ff89,0xff87ff88,0xff85ff86,0xff86ff84,0xff8bff88,0xff8fff8d,0xff92ff90,0xff93ff93,0xff96ff95,0xff97ff97,0xff97ff97,0xff95ff96,0xff93ff93,0xff8eff90,0xff85ff8a,0x0000b282,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x11820000,0xff82ef82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff89ff86,0xff8fff8c,0xff93ff91,0xff96ff95,0xff93ff95,0xff90ff91,0xff90ff90,0xff90ff90,0xff90ff90,0xff90ff90,0xff91ff91,0xff92ff92,0xff92ff92,0xff93ff93,0xff93ff93,0xff93ff93,0xff92ff93,0xff91ff92,
-0xff8fff90,0xff90ff8f,0xff93ff91,0xff95ff93,0xff97ff96,0xff97ff97,0xff97ff97,0xff95ff96,0xff92ff93,0xff8cff90,0xed83ff88,0x00000d82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x27820000,0xff82f982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff8aff87,0xff8fff8d,0xff93ff91,0xff96ff95,0xff99ff98,0xff9aff9a,0xff9aff9a,0xff97ff99,0xfb8fff93,0x0000298b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29820000,
-0xff82f982,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff86ff84,0xff89ff88,0xff8cff8b,0xff8eff8d,0xff8fff8f,0xff90ff8f,0xff8fff8f,0xff8dff8e,0xff89ff8b,0xff84ff87,0xfd82ff82,0x00002f82,0x00000000,0x00000000,0x00000000,0x00000000,0x11820000,0xff82ef82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff88ff85,0xff8eff8b,0xff93ff91,0xff97ff95,
-0xff9bff99,0xff9eff9c,0xff9fff9f,0xffa0ffa0,0xff9fff9f,0xff9aff9d,0x8889ff93,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff829282,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff88ff86,0xff8dff8b,0xff90ff8f,0xff93ff92,0xff95ff93,0xff96ff96,0xff96ff96,0xff95ff96,0xff93ff93,0xff90ff92,0xff89ff8d,
-0xef82ff85,0x00000f82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x52820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8aff87,0xff8fff8d,0xff93ff92,0xff98ff96,0xff9bff9a,0xff9eff9d,0xff9fff9e,0xff9fff9f,0xff98ff9d,0xff8eff93,0xff87ff8a,0xff83ff85,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff87ff85,0xff8cff89,0xff90ff8e,0xff92ff91,0xff95ff93,0xff96ff95,0xff97ff96,0xff96ff96,0xff93ff95,0xff91ff93,0xff8cff8f,0xff83ff87,0x00005882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfd821b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8aff87,0xff90ff8d,
-0xff95ff93,0xff9aff98,0xff9eff9c,0xffa1ff9f,0xffa2ffa2,0xff9dffa0,0xff99ff9b,0xff96ff97,0xff93ff95,0xff93ff93,0xff93ff93,0xff92ff92,0xff92ff92,0xff91ff91,0xff91ff91,0xff8fff90,0xff8eff8f,0xff8bff8c,0xff8bff8a,0xff90ff8e,0xff93ff92,0xff98ff96,0xff9aff99,0xff9cff9b,0xff9dff9d,0xff9dff9d,0xff9bff9c,0xff99ff9a,0xff93ff97,0xff8cff91,0x1f82f985,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x74820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff88ff85,0xff8fff8b,0xff93ff91,0xff99ff96,0xff9bff9b,0xff98ff9a,0xff96ff97,0xff95ff96,0xff95ff95,0xff96ff95,0xff96ff96,0xff97ff96,0xff98ff97,0xff98ff98,0xff99ff98,0xff99ff99,0xff99ff99,0xff98ff99,0xff97ff98,
-0xff95ff96,0xff95ff93,0xff99ff97,0xff9bff9a,0xff9dff9c,0xff9dff9d,0xff9dff9d,0xff9cff9c,0xff99ff9a,0xff93ff96,0xff89ff8f,0x00007083,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xa0820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8aff87,0xff90ff8d,0xff93ff92,0xff99ff97,0xff9cff9a,0xff9fff9d,0xffa0ff9f,0xffa0ffa0,0xff9effa0,0xff98ff9c,0x0000aa92,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xaa820000,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff87ff85,0xff8cff8a,0xff90ff8e,0xff92ff91,0xff93ff93,0xff95ff95,0xff96ff96,0xff95ff95,0xff93ff93,0xff90ff92,0xff8bff8e,0xff83ff87,0x0000a682,0x00000000,0x00000000,0x00000000,0x00000000,0x74820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff84,0xff8eff8a,0xff93ff91,0xff98ff96,0xff9dff9b,
-0xffa0ff9f,0xffa3ffa2,0xffa5ffa4,0xffa6ffa6,0xffa5ffa6,0xffa1ffa3,0xff91ff9c,0x00004b87,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4b820000,0xff82fd82,0xff82ff82,0xff82ff82,0xff84ff82,0xff89ff86,0xff8eff8c,0xff92ff90,0xff96ff93,0xff99ff98,0xff9bff9a,0xff9cff9b,0xff9cff9c,0xff9bff9c,0xff99ff9b,0xff96ff98,0xff90ff93,
-0xff86ff8b,0x00006e82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc6820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff89ff86,0xff8fff8c,0xff93ff92,0xff99ff97,0xff9dff9b,0xffa1ff9f,0xffa3ffa2,0xffa5ffa4,0xffa5ffa5,0xff9fffa3,0xff97ff9b,0xff90ff93,0xff8aff8d,0xff86ff88,0xff84ff85,0xff83ff84,0xff83ff83,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff83ff82,0xff87ff85,0xff8dff8a,0xff91ff8f,0xff95ff93,0xff98ff97,0xff9bff99,0xff9cff9b,0xff9cff9c,0xff9cff9d,0xff9bff9b,0xff97ff99,0xff93ff95,0xff89ff8f,0x0000c883,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827082,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff85,0xff8fff8c,0xff95ff92,
-0xff9aff98,0xff9fff9d,0xffa3ffa1,0xffa6ffa5,0xffa8ffa7,0xffa3ffa6,0xff9fffa1,0xff9dff9e,0xff9bff9c,0xff9aff9b,0xff9aff9a,0xff99ff99,0xff99ff99,0xff98ff98,0xff97ff98,0xff96ff97,0xff93ff95,0xff91ff92,0xff91ff90,0xff96ff93,0xff9aff98,0xff9dff9c,0xffa0ff9f,0xffa1ffa1,0xffa2ffa2,0xffa3ffa3,0xffa1ffa2,0xff9fffa0,0xff9bff9d,0xff93ff97,0x7c85ff8c,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd0820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff84,0xff8eff8a,0xff93ff91,0xff99ff96,0xff9eff9c,0xffa1ffa0,0xff9effa0,0xff9cff9c,0xff9bff9b,0xff9aff9b,0xff9bff9b,0xff9cff9b,0xff9cff9c,0xff9dff9d,0xff9eff9d,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9dff9d,
-0xff9bff9c,0xff9bff9a,0xff9eff9d,0xffa1ff9f,0xffa2ffa1,0xffa3ffa2,0xffa3ffa3,0xffa2ffa2,0xff9fffa0,0xff9aff9c,0xff90ff96,0x0000d488,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xf9821f82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff89ff86,0xff8fff8c,0xff95ff92,0xff9aff97,0xff9eff9c,0xffa1ffa0,0xffa4ffa3,0xffa6ffa5,0xffa6ffa6,0xffa5ffa6,0xff9fffa3,0x1d93fd9a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff822382,
-0xff82ff82,0xff82ff82,0xff83ff82,0xff88ff85,0xff8dff8b,0xff92ff90,0xff95ff93,0xff98ff97,0xff9aff99,0xff9bff9b,0xff9cff9c,0xff9bff9b,0xff99ff9a,0xff97ff98,0xff91ff93,0xff89ff8e,0x2182fb83,0x00000000,0x00000000,0x00000000,0x00000000,0xcc820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff8cff89,0xff93ff90,0xff98ff96,0xff9dff9b,0xffa2ffa0,
-0xffa6ffa4,0xffa8ffa7,0xffaaffa9,0xffabffab,0xffabffab,0xffa7ffa9,0xff9bffa3,0x0f89e590,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xe7821382,0xff82ff82,0xff82ff82,0xff83ff82,0xff88ff85,0xff8fff8c,0xff93ff91,0xff98ff96,0xff9cff9a,0xff9eff9d,0xffa0ffa0,0xffa2ffa1,0xffa2ffa2,0xffa1ffa2,0xff9fffa1,0xff9cff9e,0xff97ff9a,
-0xff8cff92,0x0000c685,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff821f82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff84,0xff8eff8a,0xff93ff91,0xff99ff97,0xff9eff9c,0xffa2ffa0,0xffa6ffa4,0xffa8ffa7,0xffaaffa9,0xffabffab,0xffa6ffa9,0xffa0ffa3,0xff99ff9c,0xff93ff97,0xff90ff92,0xff8dff8e,0xff8bff8c,0xff89ff8a,0xff87ff88,0xff86ff87,
-0xff85ff85,0xff83ff84,0xff86ff84,0xff8dff8a,0xff93ff90,0xff97ff95,0xff9bff99,0xff9eff9c,0xffa0ff9f,0xffa2ffa1,0xffa2ffa2,0xffa2ffa2,0xffa1ffa1,0xff9eff9f,0xff99ff9c,0xff90ff95,0x2383ff88,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82bc82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8eff8a,0xff93ff91,0xff9aff97,
-0xff9fff9d,0xffa4ffa2,0xffa8ffa6,0xffabffaa,0xffadffad,0xffa9ffab,0xffa5ffa7,0xffa3ffa4,0xffa1ffa2,0xffa0ffa1,0xffa0ffa0,0xff9fffa0,0xff9fff9f,0xff9fff9f,0xff9eff9e,0xff9cff9d,0xff9aff9b,0xff96ff98,0xff96ff95,0xff9bff99,0xff9fff9d,0xffa3ffa1,0xffa5ffa4,0xffa7ffa6,0xffa8ffa7,0xffa8ffa8,0xffa7ffa8,0xffa5ffa6,0xffa1ffa3,0xff99ff9d,0xba8bff93,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfb821982,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8cff88,0xff93ff8f,0xff98ff96,0xff9eff9b,0xffa3ffa1,0xffa6ffa5,0xffa3ffa5,0xffa1ffa2,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa1ffa0,0xffa1ffa1,0xffa2ffa2,0xffa3ffa3,0xffa3ffa3,0xffa4ffa4,0xffa4ffa4,0xffa3ffa4,0xffa2ffa3,
-0xffa0ffa1,0xffa0ff9f,0xffa4ffa2,0xffa6ffa5,0xffa8ffa7,0xffa8ffa8,0xffa8ffa9,0xffa7ffa8,0xffa4ffa6,0xffa0ffa2,0xff97ff9c,0x0f88fd8e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xff827482,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff84,0xff8eff8b,0xff93ff91,0xff9aff97,0xff9fff9c,0xffa3ffa1,0xffa7ffa5,0xffa9ffa8,0xffabffab,0xffacffac,0xffaaffab,0xffa6ffa9,0x769bffa1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827482,
-0xff82ff82,0xff82ff82,0xff87ff84,0xff8dff8a,0xff93ff90,0xff97ff95,0xff9bff99,0xff9eff9c,0xffa0ff9f,0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,0xff9fffa1,0xff9dff9e,0xff98ff9a,0xff90ff93,0x7283ff89,0x00000000,0x00000000,0x00000000,0x00000000,0xfb821182,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8aff86,0xff91ff8e,0xff98ff93,0xff9dff9a,0xffa2ffa0,0xffa7ffa5,
-0xffabffa9,0xffadffac,0xffb0ffaf,0xffb1ffb0,0xffb0ffb1,0xffadffaf,0xffa5ffaa,0x9691ff9c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff829682,0xff82ff82,0xff82ff82,0xff87ff83,0xff8eff8a,0xff93ff91,0xff99ff97,0xff9dff9b,0xffa1ff9f,0xffa4ffa3,0xffa6ffa5,0xffa7ffa7,0xffa8ffa7,0xffa7ffa7,0xffa5ffa6,0xffa2ffa4,0xff9dffa0,
-0xff93ff99,0x1984ff8b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff826282,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8cff88,0xff93ff8f,0xff99ff96,0xff9eff9c,0xffa3ffa1,0xffa7ffa5,0xffabffa9,0xffadffac,0xffafffaf,0xffb0ffb0,0xffadffaf,0xffa8ffaa,0xffa2ffa5,0xff9effa0,0xff9aff9c,0xff98ff99,0xff95ff96,0xff93ff93,0xff91ff92,0xff8eff8f,
-0xff8bff8d,0xff87ff8a,0xff8cff88,0xff92ff8f,0xff98ff95,0xff9cff9a,0xffa0ff9f,0xffa3ffa2,0xffa6ffa5,0xffa7ffa6,0xffa8ffa7,0xffa7ffa8,0xffa6ffa7,0xffa3ffa5,0xff9fffa1,0xff97ff9b,0x7087ff8f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0xff82f382,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff87,0xff92ff8e,0xff99ff96,0xff9fff9c,
-0xffa4ffa2,0xffa9ffa7,0xffadffab,0xffb0ffaf,0xffb2ffb2,0xffaeffb1,0xffabffad,0xffa9ffaa,0xffa7ffa8,0xffa6ffa7,0xffa6ffa6,0xffa6ffa6,0xffa5ffa5,0xffa5ffa5,0xffa4ffa5,0xffa2ffa3,0xffa0ffa1,0xff9cff9e,0xff9bff9a,0xffa0ff9e,0xffa4ffa2,0xffa8ffa6,0xffabffa9,0xffacffac,0xffadffad,0xffadffae,0xffadffad,0xffaaffac,0xffa6ffa8,0xff9fffa3,0xef91ff9a,0x0000018a,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff824c82,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff85,0xff90ff8d,0xff97ff93,0xff9dff9a,0xffa3ffa0,0xffa8ffa5,0xffabffaa,0xffa8ffaa,0xffa6ffa7,0xffa5ffa5,0xffa5ffa5,0xffa5ffa5,0xffa6ffa5,0xffa7ffa6,0xffa7ffa7,0xffa8ffa8,0xffa9ffa8,0xffa9ffa9,0xffa9ffa9,0xffa8ffa9,0xffa8ffa8,
-0xffa5ffa7,0xffa5ffa5,0xffa9ffa7,0xffabffaa,0xffadffac,0xffaeffae,0xffaeffae,0xffacffad,0xffaaffab,0xffa5ffa8,0xff9dffa2,0x4e8dff95,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xff82b882,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8cff88,0xff93ff8f,0xff99ff96,0xff9fff9c,0xffa4ffa1,0xffa8ffa6,0xffacffaa,0xffaeffad,0xffb0ffb0,0xffb1ffb1,0xffb0ffb1,0xffacffaf,0xc6a1ffa8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82ba82,
-0xff82ff82,0xff85ff82,0xff8cff89,0xff93ff90,0xff98ff96,0xff9dff9b,0xffa0ff9f,0xffa3ffa2,0xffa5ffa4,0xffa7ffa6,0xffa7ffa7,0xffa7ffa7,0xffa5ffa6,0xffa2ffa4,0xff9effa0,0xff96ff9b,0xc287ff90,0x00000000,0x00000000,0x00000000,0x00000000,0xff824a82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff83,0xff8eff8b,0xff96ff92,0xff9cff99,0xffa2ff9f,0xffa7ffa5,0xffacffa9,
-0xffafffae,0xffb2ffb1,0xffb5ffb4,0xffb6ffb5,0xffb5ffb6,0xffb2ffb4,0xffadffb0,0xfd9dffa7,0x00002793,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2b820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff93ff8f,0xff99ff96,0xff9eff9c,0xffa3ffa1,0xffa6ffa5,0xffa9ffa8,0xffabffaa,0xffacffac,0xffadffad,0xffacffad,0xffaaffac,0xffa8ffa9,0xffa3ffa5,
-0xff99ff9e,0x4889ff92,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff829e82,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff85,0xff90ff8d,0xff97ff93,0xff9dff9a,0xffa3ffa0,0xffa8ffa6,0xffacffaa,0xffb0ffae,0xffb2ffb1,0xffb5ffb4,0xffb5ffb5,0xffb3ffb4,0xffafffb1,0xffabffad,0xffa7ffa9,0xffa4ffa5,0xffa1ffa3,0xff9fffa0,0xff9dff9e,0xff9aff9b,0xff96ff98,
-0xff93ff95,0xff8dff90,0xff91ff8d,0xff97ff93,0xff9dff9b,0xffa2ff9f,0xffa5ffa4,0xffa9ffa7,0xffabffaa,0xffacffac,0xffadffad,0xffadffad,0xffacffac,0xffa9ffaa,0xffa4ffa7,0xff9dffa1,0xa28dff96,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x10820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff83,0xff8fff8b,0xff96ff93,0xff9dff9a,0xffa3ffa0,
-0xffa9ffa6,0xffadffab,0xffb1ffb0,0xffb5ffb3,0xffb7ffb6,0xffb4ffb6,0xffb1ffb2,0xffafffaf,0xffadffae,0xffacffad,0xffacffac,0xffacffac,0xffabffab,0xffabffab,0xffaaffaa,0xffa8ffa9,0xffa6ffa7,0xffa1ffa4,0xffa1ff9f,0xffa5ffa3,0xffa9ffa7,0xffadffab,0xffb0ffae,0xffb2ffb1,0xffb2ffb2,0xffb2ffb3,0xffb2ffb2,0xffafffb1,0xffabffae,0xffa5ffa9,0xff95ffa0,0x0000168e,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827282,0xff82ff82,0xff82ff82,0xff85ff82,0xff8dff89,0xff95ff91,0xff9cff98,0xffa2ff9f,0xffa7ffa5,0xffacffaa,0xffafffae,0xffadffaf,0xffabffab,0xffaaffaa,0xffa9ffa9,0xffaaffaa,0xffabffaa,0xffabffab,0xffacffac,0xffadffad,0xffaeffad,0xffaeffae,0xffaeffae,0xffaeffae,0xffadffad,
-0xffaaffac,0xffaaffaa,0xffaeffac,0xffb0ffaf,0xffb2ffb1,0xffb3ffb3,0xffb3ffb3,0xffb2ffb2,0xffafffb1,0xffabffad,0xffa3ffa7,0x6e93ff9c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03820000,0xff82f382,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff85,0xff90ff8c,0xff98ff93,0xff9eff9b,0xffa3ffa1,0xffa8ffa6,0xffadffab,0xffb0ffaf,0xffb3ffb2,0xffb5ffb4,0xffb6ffb6,0xffb5ffb6,0xffb2ffb4,0xf9a6ffae,0x000007a0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff82ef82,
-0xff82ff82,0xff8aff85,0xff92ff8e,0xff98ff95,0xff9dff9b,0xffa2ffa0,0xffa5ffa4,0xffa8ffa7,0xffabffaa,0xffacffab,0xffacffac,0xffacffac,0xffabffac,0xffa8ffa9,0xffa3ffa6,0xff9cffa0,0xf78dff96,0x00000785,0x00000000,0x00000000,0x00000000,0xff827082,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff87,0xff93ff8f,0xff9aff96,0xffa0ff9d,0xffa6ffa3,0xffacffa9,0xffb0ffae,
-0xffb4ffb2,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb7ffb9,0xffb4ffb6,0xffaaffb1,0x000088a0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x84820000,0xff82ff82,0xff82ff82,0xff87ff83,0xff90ff8c,0xff98ff93,0xff9eff9b,0xffa4ffa1,0xffa8ffa6,0xffabffaa,0xffaeffad,0xffb0ffaf,0xffb2ffb1,0xffb2ffb2,0xffb1ffb2,0xffb0ffb1,0xffadffae,0xffa8ffab,
-0xff9fffa4,0x688fff98,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82c082,0xff82ff82,0xff82ff82,0xff85ff82,0xff8dff89,0xff95ff91,0xff9cff98,0xffa2ff9f,0xffa7ffa5,0xffadffaa,0xffb1ffaf,0xffb4ffb3,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb6ffb7,0xffb3ffb4,0xffb0ffb1,0xffadffae,0xffaaffab,0xffa8ffa9,0xffa5ffa7,0xffa2ffa4,0xff9effa0,
-0xff99ff9c,0xff92ff96,0xff96ff92,0xff9cff99,0xffa2ff9f,0xffa7ffa4,0xffabffa9,0xffaeffac,0xffb0ffaf,0xffb1ffb1,0xffb2ffb2,0xffb2ffb2,0xffb1ffb2,0xffaeffb0,0xffaaffac,0xffa2ffa6,0xcc92ff9c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x26820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,0xff93ff8f,0xff9bff97,0xffa2ff9e,0xffa8ffa5,
-0xffadffab,0xffb2ffb0,0xffb6ffb4,0xffb9ffb8,0xffbbffbb,0xffb9ffb9,0xffb6ffb7,0xffb4ffb5,0xffb3ffb3,0xffb2ffb2,0xffb2ffb2,0xffb1ffb2,0xffb1ffb1,0xffb0ffb1,0xffb0ffb0,0xffaeffaf,0xffabffad,0xffa6ffa9,0xffa5ffa4,0xffaaffa8,0xffaeffac,0xffb2ffb0,0xffb4ffb3,0xffb6ffb6,0xffb7ffb7,0xffb7ffb7,0xffb7ffb7,0xffb4ffb6,0xffb0ffb3,0xffaaffae,0xff9bffa5,0x00002493,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827882,0xff82ff82,0xff82ff82,0xff89ff84,0xff91ff8d,0xff99ff95,0xffa0ff9d,0xffa6ffa3,0xffacffa9,0xffb1ffae,0xffb4ffb3,0xffb1ffb3,0xffafffb0,0xffaeffaf,0xffaeffae,0xffafffae,0xffafffaf,0xffb0ffb0,0xffb1ffb0,0xffb2ffb1,0xffb2ffb2,0xffb3ffb2,0xffb3ffb3,0xffb3ffb3,0xffb1ffb2,
-0xffafffb1,0xffafffae,0xffb3ffb1,0xffb5ffb4,0xffb7ffb6,0xffb8ffb8,0xffb8ffb8,0xffb7ffb7,0xffb4ffb6,0xffb0ffb2,0xffa8ffac,0x7298ffa0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x16820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8dff89,0xff95ff91,0xff9cff98,0xffa2ff9f,0xffa8ffa5,0xffadffaa,0xffb1ffaf,0xffb5ffb3,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffb9ffbb,0xffb7ffb9,0xffabffb3,0x000014a6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x16820000,0xff82ff82,
-0xff85ff82,0xff8fff8a,0xff96ff93,0xff9dff9a,0xffa2ffa0,0xffa7ffa5,0xffabffa9,0xffaeffac,0xffb0ffaf,0xffb1ffb0,0xffb2ffb1,0xffb1ffb2,0xffb0ffb1,0xffadffaf,0xffa9ffab,0xffa1ffa6,0xff92ff9c,0x00001a8a,0x00000000,0x00000000,0x00000000,0xff828482,0xff82ff82,0xff82ff82,0xff86ff83,0xff8fff8b,0xff97ff93,0xff9eff9b,0xffa5ffa2,0xffabffa8,0xffb0ffad,0xffb5ffb2,
-0xffb8ffb7,0xffbcffb9,0xffbeffbd,0xffbfffbe,0xffbfffbf,0xffbcffbe,0xffb9ffbb,0xffb5ffb9,0x0000baae,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc6820000,0xff83ff82,0xff84ff84,0xff8cff87,0xff95ff91,0xff9dff99,0xffa3ffa0,0xffa8ffa5,0xffadffab,0xffb0ffaf,0xffb3ffb2,0xffb5ffb4,0xffb7ffb6,0xffb7ffb7,0xffb6ffb7,0xffb5ffb6,0xffb2ffb3,0xffadffaf,
-0xffa4ffa9,0x7c93ff9c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82d082,0xff82ff82,0xff82ff82,0xff88ff84,0xff91ff8d,0xff99ff95,0xffa0ff9d,0xffa6ffa3,0xffacffa9,0xffb1ffaf,0xffb5ffb3,0xffb9ffb7,0xffbcffbb,0xffbeffbd,0xffbeffbe,0xffbeffbe,0xffbcffbd,0xffb9ffbb,0xffb7ffb9,0xffb5ffb6,0xffb2ffb4,0xffb0ffb1,0xffadffaf,0xffaaffab,0xffa5ffa7,
-0xff9fffa2,0xff97ff9b,0xff9aff97,0xffa1ff9e,0xffa7ffa4,0xffabffa9,0xffafffae,0xffb2ffb1,0xffb5ffb4,0xffb6ffb6,0xffb7ffb7,0xffb7ffb7,0xffb6ffb7,0xffb3ffb5,0xffafffb1,0xffa7ffab,0xd098ffa1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x26820000,0xff82ff82,0xff82ff82,0xff85ff82,0xff8fff8a,0xff97ff93,0xff9fff9b,0xffa6ffa2,0xffacffa9,
-0xffb1ffaf,0xffb6ffb4,0xffb9ffb8,0xffbeffbc,0xffc0ffbf,0xffbdffbf,0xffbbffbc,0xffb9ffb9,0xffb8ffb8,0xffb7ffb8,0xffb7ffb7,0xffb7ffb7,0xffb6ffb6,0xffb6ffb6,0xffb5ffb5,0xffb3ffb4,0xffb0ffb2,0xffabffae,0xffaaffa9,0xffafffac,0xffb3ffb1,0xffb6ffb5,0xffb9ffb8,0xffbbffb9,0xffbcffbc,0xffbcffbc,0xffbbffbc,0xffb9ffb9,0xffb5ffb7,0xffaeffb2,0xff9fffa9,0x00002896,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827e82,0xff82ff82,0xff84ff82,0xff8dff88,0xff95ff91,0xff9dff99,0xffa4ffa1,0xffaaffa7,0xffb0ffad,0xffb5ffb3,0xffb8ffb7,0xffb6ffb7,0xffb4ffb5,0xffb3ffb3,0xffb3ffb3,0xffb3ffb3,0xffb4ffb3,0xffb5ffb4,0xffb5ffb5,0xffb6ffb6,0xffb7ffb7,0xffb7ffb7,0xffb7ffb7,0xffb7ffb7,0xffb6ffb7,
-0xffb4ffb5,0xffb4ffb3,0xffb7ffb6,0xffb9ffb9,0xffbcffbb,0xffbcffbc,0xffbdffbd,0xffbbffbc,0xffb9ffb9,0xffb4ffb7,0xffabffb0,0x7c9affa3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x30820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff91ff8d,0xff99ff95,0xffa0ff9d,0xffa6ffa3,0xffacffa9,0xffb1ffaf,0xffb6ffb4,0xffb9ffb8,0xffbdffbb,0xffbeffbe,0xffbfffbf,0xffbfffbf,0xffbbffbd,0xffb0ffb8,0x000028a9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30820000,0xff82ff82,
-0xff8aff84,0xff93ff8f,0xff9bff98,0xffa2ff9f,0xffa7ffa5,0xffacffaa,0xffb0ffae,0xffb2ffb1,0xffb4ffb4,0xffb6ffb5,0xffb7ffb7,0xffb6ffb7,0xffb5ffb6,0xffb2ffb4,0xffaeffb0,0xffa6ffaa,0xff98ffa1,0x0000308f,0x00000000,0x00000000,0x00000000,0xff827e82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9bff97,0xffa2ff9f,0xffa9ffa5,0xffafffac,0xffb4ffb2,0xffb9ffb6,
-0xffbdffbb,0xffc0ffbe,0xffc2ffc1,0xffc3ffc3,0xffc3ffc3,0xffc0ffc2,0xffc0ffbf,0xffbeffc0,0x0000c2b8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xbc820000,0xff88ff86,0xff88ff88,0xff90ff8b,0xff99ff95,0xffa1ff9d,0xffa7ffa4,0xffadffaa,0xffb1ffaf,0xffb5ffb3,0xffb8ffb6,0xffb9ffb9,0xffbbffbb,0xffbcffbc,0xffbbffbc,0xffb9ffbb,0xffb6ffb8,0xffb1ffb4,
-0xffa9ffae,0x7e98ffa1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82d082,0xff82ff82,0xff83ff82,0xff8cff88,0xff95ff91,0xff9dff99,0xffa4ffa1,0xffaaffa7,0xffb0ffad,0xffb5ffb3,0xffb9ffb8,0xffbdffbc,0xffc0ffbf,0xffc2ffc1,0xffc3ffc3,0xffc3ffc3,0xffc2ffc3,0xffc0ffc1,0xffbeffbf,0xffbcffbd,0xffb9ffbb,0xffb8ffb9,0xffb4ffb6,0xffb1ffb3,0xffabffae,
-0xffa5ffa8,0xff9cffa0,0xff9fff9b,0xffa6ffa2,0xffabffa9,0xffb0ffae,0xffb4ffb2,0xffb7ffb6,0xffb9ffb8,0xffbbffbb,0xffbcffbc,0xffbcffbc,0xffb9ffbb,0xffb8ffb9,0xffb3ffb6,0xffacffb0,0xd49cffa5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2a820000,0xff82ff82,0xff82ff82,0xff87ff83,0xff92ff8d,0xff9bff97,0xffa3ff9f,0xffaaffa6,0xffb0ffad,
-0xffb5ffb3,0xffb9ffb8,0xffbeffbc,0xffc2ffc0,0xffc4ffc3,0xffc2ffc3,0xffc0ffc1,0xffbeffbf,0xffbdffbd,0xffbcffbd,0xffbcffbc,0xffbcffbc,0xffbbffbc,0xffbbffbb,0xffb9ffb9,0xffb8ffb9,0xffb5ffb7,0xffafffb2,0xffaeffad,0xffb3ffb1,0xffb7ffb5,0xffbbffb9,0xffbeffbc,0xffc0ffbf,0xffc1ffc0,0xffc1ffc1,0xffc0ffc0,0xffbcffbe,0xffb7ffb9,0xffafffb3,0xff9effa8,0x00002693,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff828c82,0xff82ff82,0xff84ff82,0xff8fff8a,0xff99ff93,0xffa1ff9d,0xffa8ffa5,0xffaeffab,0xffb4ffb1,0xffb9ffb7,0xffbcffbb,0xffb9ffbc,0xffb8ffb9,0xffb7ffb7,0xffb7ffb7,0xffb7ffb7,0xffb8ffb8,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffbbffbb,0xffbcffbb,0xffbcffbc,0xffbcffbc,0xffbbffbb,
-0xffb8ffb9,0xffb8ffb7,0xffbcffb9,0xffbeffbd,0xffc0ffbf,0xffc1ffc1,0xffc1ffc1,0xffbfffc0,0xffbbffbd,0xffb5ffb8,0xffa9ffb0,0x8c96ffa1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x2c820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff8cff88,0xff95ff91,0xff9dff99,0xffa4ffa0,0xffaaffa7,0xffb0ffad,0xffb6ffb3,0xffb9ffb8,0xffbeffbc,0xffc1ffbf,0xffc3ffc2,0xffc4ffc3,0xffc3ffc4,0xffc0ffc2,0xffb5ffbc,0x00001eae,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28820000,0xff83ff82,
-0xff8eff88,0xff98ff93,0xffa0ff9c,0xffa6ffa3,0xffacffa9,0xffb0ffae,0xffb4ffb2,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbbffbb,0xffbbffbb,0xffb9ffb9,0xffb7ffb8,0xffb2ffb5,0xffabffaf,0xff9cffa5,0x00002a92,0x00000000,0x00000000,0x00000000,0xff826c82,0xff82ff82,0xff84ff82,0xff8eff88,0xff97ff92,0xff9fff9b,0xffa6ffa2,0xffadffa9,0xffb3ffb0,0xffb8ffb5,0xffbdffb9,
-0xffc1ffbf,0xffc4ffc2,0xffc6ffc5,0xffc7ffc7,0xffc7ffc7,0xffc4ffc6,0xffc5ffc3,0xffc5ffc6,0x00008ec0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x8c850000,0xff8eff8b,0xff8cff8d,0xff93ff8f,0xff9eff99,0xffa5ffa2,0xffacffa9,0xffb1ffaf,0xffb6ffb4,0xffb9ffb8,0xffbcffbb,0xffbeffbd,0xffc0ffbf,0xffc0ffc0,0xffc0ffc0,0xffbeffbf,0xffbbffbc,0xffb5ffb8,
-0xffabffb1,0x6e9bffa3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82c882,0xff82ff82,0xff85ff82,0xff90ff8b,0xff99ff95,0xffa1ff9d,0xffa8ffa4,0xffaeffab,0xffb4ffb1,0xffb9ffb7,0xffbeffbb,0xffc1ffc0,0xffc4ffc3,0xffc6ffc5,0xffc7ffc7,0xffc8ffc7,0xffc8ffc8,0xffc7ffc7,0xffc5ffc6,0xffc3ffc4,0xffc1ffc2,0xffbeffc0,0xffbbffbd,0xffb7ffb9,0xffb1ffb4,
-0xffaaffae,0xffa0ffa5,0xffa3ff9f,0xffaaffa6,0xffb0ffad,0xffb5ffb2,0xffb9ffb7,0xffbcffb9,0xffbeffbd,0xffc0ffbf,0xffc0ffc0,0xffc0ffc0,0xffbfffc0,0xffbcffbe,0xffb6ffb9,0xffadffb2,0xca9cffa6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30820000,0xff82ff82,0xff82ff82,0xff86ff82,0xff92ff8c,0xff9cff98,0xffa5ffa1,0xffadffa9,0xffb4ffb1,
-0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc6ffc4,0xffc8ffc7,0xffc6ffc7,0xffc4ffc5,0xffc3ffc3,0xffc2ffc2,0xffc1ffc1,0xffc1ffc1,0xffc1ffc1,0xffc0ffc0,0xffc0ffc0,0xffbfffbf,0xffbdffbe,0xffb9ffbb,0xffb4ffb7,0xffb2ffb1,0xffb7ffb5,0xffbcffb9,0xffbfffbd,0xffc2ffc1,0xffc4ffc3,0xffc4ffc4,0xffc3ffc3,0xffc0ffc2,0xffbcffbe,0xffb5ffb8,0xffabffb1,0xff9bffa5,0x00003291,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82a682,0xff82ff82,0xff84ff82,0xff8eff89,0xff9aff93,0xffa3ff9f,0xffabffa7,0xffb2ffaf,0xffb8ffb5,0xffbdffb9,0xffc0ffbf,0xffbeffc0,0xffbcffbd,0xffbbffbb,0xffbbffbb,0xffbbffbb,0xffbcffbc,0xffbdffbd,0xffbeffbd,0xffbfffbe,0xffbfffbf,0xffc0ffc0,0xffc0ffc0,0xffc0ffc0,0xffbfffc0,
-0xffbcffbe,0xffbcffbb,0xffc0ffbe,0xffc2ffc1,0xffc4ffc3,0xffc4ffc4,0xffc2ffc3,0xffbfffc1,0xffb9ffbc,0xffb1ffb6,0xffa6ffac,0xac93ff9e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x11820000,0xff82ff82,0xff82ff82,0xff86ff83,0xff90ff8b,0xff99ff93,0xffa0ff9d,0xffa8ffa4,0xffaeffab,0xffb4ffb1,0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc5ffc3,0xffc7ffc6,0xffc8ffc8,0xffc7ffc8,0xffc4ffc6,0xffb8ffc0,0x000012b1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1a820000,0xff85ff82,
-0xff92ff8c,0xff9cff97,0xffa4ffa0,0xffabffa7,0xffb0ffae,0xffb5ffb3,0xffb9ffb7,0xffbcffb9,0xffbeffbd,0xffbfffbf,0xffc0ffc0,0xffbfffc0,0xffbeffbf,0xffbbffbd,0xffb7ffb9,0xffafffb3,0xff9effa9,0x00001496,0x00000000,0x00000000,0x00000000,0xff826c82,0xff82ff82,0xff84ff82,0xff8eff89,0xff98ff93,0xffa1ff9c,0xffa9ffa5,0xffb0ffad,0xffb7ffb4,0xffbcffb9,0xffc1ffbe,
-0xffc5ffc3,0xffc8ffc6,0xffcaffc9,0xffcbffcb,0xffcbffcb,0xffc8ffca,0xffc9ffc7,0xfbc9ffca,0x00002dc2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x27870000,0xff93fd8f,0xff90ff92,0xff98ff92,0xffa2ff9d,0xffa9ffa6,0xffb0ffad,0xffb5ffb3,0xffb9ffb8,0xffbeffbc,0xffc1ffbf,0xffc3ffc2,0xffc4ffc4,0xffc3ffc4,0xffc2ffc3,0xffbfffc1,0xffbbffbd,0xffb4ffb8,
-0xffa9ffb0,0x6096ffa0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82ce82,0xff82ff82,0xff85ff82,0xff90ff8a,0xff9aff95,0xffa3ff9f,0xffabffa7,0xffb2ffaf,0xffb8ffb5,0xffbdffb9,0xffc1ffbf,0xffc5ffc4,0xffc8ffc7,0xffcaffc9,0xffcbffcb,0xffccffcb,0xffcdffcd,0xffccffcd,0xffcbffcc,0xffc9ffca,0xffc7ffc8,0xffc5ffc6,0xffc1ffc3,0xffbdffbf,0xffb7ffb9,
-0xffafffb3,0xffa4ffaa,0xffa7ffa3,0xffaeffab,0xffb4ffb1,0xffb9ffb6,0xffbdffbb,0xffc0ffbe,0xffc2ffc1,0xffc4ffc3,0xffc4ffc4,0xffc2ffc3,0xffc0ffc1,0xffbbffbe,0xffb4ffb8,0xffaaffb0,0xc698ffa2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x56820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff90ff8a,0xff9aff95,0xffa4ff9f,0xffadffa9,0xffb5ffb1,
-0xffbcffb8,0xffc2ffbf,0xffc6ffc4,0xffcaffc8,0xffccffcb,0xffcaffcb,0xffc8ffc9,0xffc7ffc8,0xffc6ffc6,0xffc5ffc6,0xffc5ffc5,0xffc5ffc5,0xffc5ffc5,0xffc4ffc4,0xffc3ffc4,0xffc1ffc2,0xffbeffc0,0xffb8ffbb,0xffb6ffb5,0xffbbffb9,0xffc0ffbd,0xffc2ffc1,0xffc4ffc3,0xffc4ffc4,0xffc3ffc4,0xffc0ffc2,0xffbdffbf,0xffb8ffbb,0xffb2ffb5,0xffa8ffad,0xff99ffa2,0x0000548f,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82ce82,0xff82ff82,0xff83ff82,0xff8cff86,0xff98ff92,0xffa2ff9d,0xffacffa7,0xffb4ffb0,0xffbbffb7,0xffc1ffbe,0xffc4ffc3,0xffc2ffc3,0xffc0ffc1,0xffbfffbf,0xffbfffbf,0xffbfffbf,0xffc0ffc0,0xffc1ffc0,0xffc2ffc1,0xffc3ffc2,0xffc3ffc3,0xffc4ffc4,0xffc4ffc4,0xffc4ffc4,0xffc3ffc4,
-0xffc0ffc2,0xffc0ffbf,0xffc4ffc2,0xffc4ffc4,0xffc5ffc5,0xffc3ffc4,0xffc0ffc1,0xffbcffbe,0xffb6ffb9,0xffafffb2,0xffa4ffaa,0xce92ff9d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xff82f282,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9bff96,0xffa3ff9f,0xffabffa7,0xffb2ffaf,0xffb8ffb5,0xffbdffbb,0xffc2ffc0,0xffc6ffc4,0xffc9ffc7,0xffcbffca,0xffcbffcb,0xffcbffcb,0xffc7ffc9,0xe9bcffc3,0x000001b4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff87f182,
-0xff96ff8f,0xffa0ff9b,0xffa8ffa4,0xffafffab,0xffb4ffb2,0xffb9ffb7,0xffbdffbb,0xffc0ffbf,0xffc2ffc1,0xffc3ffc3,0xffc4ffc4,0xffc3ffc3,0xffc0ffc2,0xffbdffbf,0xffb7ffb9,0xffafffb4,0xfd9effa9,0x00000993,0x00000000,0x00000000,0x00000000,0xff826082,0xff82ff82,0xff82ff82,0xff8bff86,0xff96ff91,0xffa0ff9b,0xffa9ffa4,0xffb1ffad,0xffb8ffb4,0xffbeffbb,0xffc3ffc0,
-0xffc8ffc6,0xffcbffca,0xffceffcd,0xffcfffce,0xffceffcf,0xffcbffcd,0xffccffca,0x9ec9ffcc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff95a290,0xff93ff95,0xff9bff95,0xffa5ffa0,0xffadffa9,0xffb4ffb0,0xffb9ffb7,0xffbdffbb,0xffc0ffbe,0xffc2ffc1,0xffc3ffc3,0xffc3ffc3,0xffc2ffc3,0xffc0ffc1,0xffbcffbe,0xffb7ffb9,0xffb0ffb4,
-0xffa6ffac,0x6693ff9d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82da82,0xff82ff82,0xff83ff82,0xff8dff87,0xff98ff93,0xffa2ff9d,0xffabffa6,0xffb3ffaf,0xffb9ffb6,0xffc0ffbd,0xffc5ffc2,0xffc9ffc7,0xffccffca,0xffceffcd,0xffceffce,0xffd0ffcf,0xffd1ffd1,0xffd1ffd2,0xffd0ffd1,0xffcfffcf,0xffcdffce,0xffcaffcc,0xffc7ffc9,0xffc2ffc5,0xffbcffbf,
-0xffb3ffb8,0xffa8ffae,0xffabffa7,0xffb2ffae,0xffb8ffb5,0xffbdffb9,0xffc0ffbe,0xffc2ffc1,0xffc3ffc3,0xffc4ffc4,0xffc2ffc3,0xffc0ffc1,0xffbcffbe,0xffb7ffb9,0xffb1ffb4,0xffa7ffad,0xd695ffa0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x82820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8eff88,0xff98ff93,0xffa2ff9d,0xffabffa7,0xffb3ffaf,
-0xffbbffb7,0xffc2ffbf,0xffc8ffc5,0xffccffca,0xffcfffce,0xffceffcf,0xffccffcd,0xffcbffcb,0xffcaffca,0xffc9ffca,0xffc9ffc9,0xffc9ffc9,0xffc9ffc9,0xffc8ffc9,0xffc7ffc8,0xffc5ffc6,0xffc2ffc4,0xffbbffbf,0xffb9ffb8,0xffbdffbb,0xffc0ffbe,0xffc1ffc1,0xffc1ffc1,0xffc1ffc1,0xffbfffc0,0xffbdffbe,0xffb9ffbc,0xffb5ffb8,0xffafffb3,0xffa7ffab,0xff98ffa1,0x0000828e,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0b820000,0xff82f982,0xff82ff82,0xff82ff82,0xff8bff85,0xff96ff91,0xffa0ff9b,0xffaaffa5,0xffb2ffae,0xffbbffb7,0xffc2ffbe,0xffc6ffc4,0xffc5ffc6,0xffc3ffc4,0xffc3ffc3,0xffc2ffc2,0xffc3ffc3,0xffc3ffc3,0xffc4ffc4,0xffc5ffc5,0xffc6ffc6,0xffc7ffc7,0xffc8ffc7,0xffc8ffc8,0xffc8ffc8,0xffc7ffc7,
-0xffc3ffc6,0xffc1ffc1,0xffc3ffc2,0xffc2ffc3,0xffc1ffc2,0xffbfffc0,0xffbdffbe,0xffb9ffbb,0xffb4ffb6,0xffadffb0,0xffa3ffa8,0xf991ff9c,0x00000989,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xff82f082,0xff82ff82,0xff85ff82,0xff8fff8a,0xff99ff93,0xffa2ff9e,0xffabffa7,0xffb2ffaf,0xffb9ffb6,0xffbeffbc,0xffc4ffc1,0xffc8ffc6,0xffccffca,0xffceffcd,0xffcfffcf,0xffceffcf,0xffcaffcc,0xc0bdffc5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff8ac483,
-0xff99ff92,0xffa3ff9e,0xffabffa7,0xffb2ffaf,0xffb7ffb5,0xffbbffb9,0xffbeffbd,0xffc1ffc0,0xffc3ffc2,0xffc3ffc3,0xffc3ffc3,0xffc1ffc2,0xffbeffc0,0xffb9ffbd,0xffb4ffb8,0xffabffb0,0xf09affa4,0x00000000,0x00000000,0x00000000,0x00000000,0xff827682,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9dff98,0xffa6ffa2,0xffaeffaa,0xffb6ffb2,0xffbcffb9,0xffc2ffbf,
-0xffc8ffc5,0xffccffca,0xffcfffcd,0xffd0ffd0,0xffd0ffd0,0xffcdffcf,0xffceffcd,0x0dc7e1cc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xeb93138f,0xff95ff96,0xff9dff97,0xffa6ffa2,0xffaeffaa,0xffb4ffb1,0xffb8ffb6,0xffbbffb9,0xffbeffbd,0xffbfffbe,0xffc0ffbf,0xffbfffc0,0xffbeffbf,0xffbcffbe,0xffb9ffbb,0xffb5ffb7,0xffaeffb2,
-0xffa4ffa9,0x7291ff9b,0x00000000,0x00000000,0x00000000,0x00000000,0x07820000,0xff82f982,0xff82ff82,0xff82ff82,0xff8bff86,0xff96ff91,0xff9fff9b,0xffa8ffa4,0xffb1ffad,0xffb8ffb4,0xffbfffbc,0xffc5ffc2,0xffcaffc8,0xffceffcc,0xffd0ffcf,0xffd2ffd1,0xffd4ffd2,0xffd5ffd5,0xffd5ffd6,0xffd5ffd5,0xffd3ffd4,0xffd1ffd2,0xffcfffd0,0xffcbffcd,0xffc7ffc9,0xffc0ffc4,
-0xffb7ffbc,0xffabffb1,0xffaeffaa,0xffb3ffb1,0xffb8ffb6,0xffbcffb9,0xffbfffbe,0xffc0ffbf,0xffc0ffc0,0xffc0ffc0,0xffbfffbf,0xffbdffbe,0xffb9ffbb,0xffb5ffb7,0xffaeffb2,0xffa5ffaa,0xf593ff9e,0x00000388,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb2820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff87,0xff97ff92,0xffa1ff9c,0xffaaffa5,0xffb2ffae,
-0xffb9ffb6,0xffc0ffbd,0xffc6ffc3,0xffcbffc9,0xffcfffce,0xffd0ffd0,0xffd0ffd0,0xffceffcf,0xffceffce,0xffcdffcd,0xffcdffcd,0xffcdffcd,0xffccffcd,0xffccffcc,0xffcbffcb,0xffc9ffca,0xffc4ffc7,0xffbbffc0,0xffb7ffb7,0xffb9ffb9,0xffbcffbb,0xffbdffbd,0xffbeffbe,0xffbeffbe,0xffbdffbd,0xffbbffbc,0xffb8ffb9,0xffb4ffb6,0xffaeffb1,0xffa6ffaa,0xff98ffa0,0x0000b08e,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x42820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff85,0xff95ff90,0xff9fff9a,0xffa8ffa4,0xffb1ffad,0xffb9ffb5,0xffc0ffbc,0xffc6ffc3,0xffc7ffc7,0xffc6ffc6,0xffc6ffc6,0xffc6ffc6,0xffc6ffc6,0xffc7ffc6,0xffc8ffc7,0xffc9ffc8,0xffcaffc9,0xffcaffca,0xffcbffcb,0xffcbffcb,0xffcbffcb,0xffc8ffca,
-0xffc2ffc5,0xffbeffbf,0xffbfffbf,0xffbfffbf,0xffbeffbe,0xffbdffbd,0xffb9ffbc,0xffb7ffb9,0xffb2ffb5,0xffacffaf,0xffa3ffa8,0xff92ff9c,0x0000388a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xff82f282,0xff82ff82,0xff83ff82,0xff8cff87,0xff96ff91,0xffa0ff9b,0xffa8ffa4,0xffafffac,0xffb7ffb3,0xffbdffb9,0xffc2ffc0,0xffc7ffc5,0xffcbffc9,0xffceffcd,0xffcfffcf,0xffceffcf,0xffcaffcd,0x6cbfffc5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff897282,
-0xff98ff92,0xffa3ff9e,0xffabffa7,0xffb0ffae,0xffb5ffb3,0xffb9ffb7,0xffbcffbb,0xffbeffbd,0xffbfffbf,0xffc0ffbf,0xffbfffbf,0xffbeffbf,0xffbbffbc,0xffb7ffb9,0xffb1ffb4,0xffa8ffad,0xf197ffa1,0x0000018b,0x00000000,0x00000000,0x00000000,0xff829282,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff9bff97,0xffa4ffa0,0xffacffa8,0xffb3ffb0,0xffb9ffb7,0xffc0ffbd,
-0xffc5ffc3,0xffc9ffc7,0xffcdffcb,0xffcfffce,0xffcfffcf,0xffccffce,0xffc7ffcb,0x00004ec8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x568e0000,0xff91ff8e,0xff9bff95,0xffa3ffa0,0xffaaffa7,0xffb0ffad,0xffb4ffb2,0xffb7ffb6,0xffb9ffb9,0xffbcffbb,0xffbdffbc,0xffbdffbd,0xffbcffbc,0xffb9ffbb,0xffb7ffb9,0xffb3ffb5,0xffacffb0,
-0xffa2ffa8,0x9090ff9a,0x00000000,0x00000000,0x00000000,0x00000000,0x1e820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9eff99,0xffa7ffa2,0xffafffab,0xffb6ffb3,0xffbdffb9,0xffc3ffc0,0xffc8ffc6,0xffcdffcb,0xffd0ffce,0xffd2ffd1,0xffd5ffd3,0xffd9ffd6,0xffd9ffd9,0xffd6ffd8,0xffd6ffd6,0xffd3ffd5,0xffd1ffd2,0xffceffd0,0xffcaffcc,0xffc4ffc7,
-0xffb9ffbf,0xffabffb2,0xffacffa9,0xffb1ffaf,0xffb5ffb3,0xffb8ffb7,0xffbbffb9,0xffbcffbb,0xffbdffbd,0xffbdffbd,0xffbcffbd,0xffb9ffbb,0xffb7ffb9,0xffb3ffb5,0xffadffb0,0xffa4ffa9,0xff93ff9e,0x00001e8a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xe2820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff87,0xff97ff92,0xffa0ff9c,0xffa9ffa4,0xffb1ffad,
-0xffb8ffb4,0xffbeffbb,0xffc4ffc2,0xffcaffc7,0xffceffcc,0xffd0ffcf,0xffd2ffd1,0xffd1ffd2,0xffd1ffd1,0xffd0ffd0,0xffd0ffd0,0xffd0ffd0,0xffd0ffd0,0xffcfffd0,0xffceffcf,0xffcbffcd,0xffc3ffc7,0xffb6ffbd,0xffb2ffb2,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffbbffbb,0xffbbffbb,0xffbbffbb,0xffb9ffb9,0xffb7ffb8,0xffb3ffb5,0xffadffb0,0xffa6ffaa,0xff9affa1,0x0000e48f,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7c820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff85,0xff95ff90,0xff9fff9a,0xffa8ffa3,0xffb0ffac,0xffb8ffb4,0xffbfffbb,0xffc4ffc2,0xffc6ffc6,0xffc8ffc7,0xffc8ffc8,0xffc9ffc9,0xffc9ffc9,0xffcaffca,0xffcbffca,0xffccffcb,0xffcdffcc,0xffceffcd,0xffceffce,0xffceffce,0xffcbffcd,0xffc5ffc9,
-0xffbdffc2,0xffb9ffb9,0xffbbffbb,0xffbcffbc,0xffbcffbc,0xffbbffbb,0xffb9ffb9,0xffb6ffb7,0xffb1ffb4,0xffacffaf,0xffa3ffa8,0xff95ff9d,0x0000828a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03820000,0xff82f782,0xff82ff82,0xff82ff82,0xff8bff85,0xff95ff90,0xff9eff99,0xffa6ffa2,0xffadffaa,0xffb4ffb1,0xffbbffb7,0xffc0ffbd,0xffc5ffc2,0xffc8ffc7,0xffcbffca,0xffccffcc,0xffccffcc,0xffc7ffca,0x3ab9ffbf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff853482,
-0xff93ff8d,0xff9eff99,0xffa6ffa2,0xffacffa9,0xffb1ffaf,0xffb5ffb3,0xffb8ffb7,0xffbbffb9,0xffbcffbc,0xffbdffbd,0xffbdffbd,0xffbbffbc,0xffb9ffb9,0xffb5ffb7,0xffafffb2,0xffa7ffab,0xff93ffa0,0x0000068a,0x00000000,0x00000000,0x00000000,0xff82b682,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9aff96,0xffa3ff9f,0xffabffa7,0xffb2ffae,0xffb9ffb5,0xffbeffbc,
-0xffc3ffc1,0xffc8ffc6,0xffcbffc9,0xffccffcc,0xffccffcc,0xffc7ffcb,0xf7bdffc3,0x000007b8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0xff88f583,0xff95ff8e,0xff9fff9a,0xffa6ffa3,0xffacffa9,0xffb1ffae,0xffb4ffb3,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffbbffbb,0xffb9ffbb,0xffb8ffb9,0xffb6ffb7,0xffb1ffb4,0xffabffaf,
-0xffa2ffa7,0xae90ff9a,0x00000000,0x00000000,0x00000000,0x00000000,0x4a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff84,0xff93ff8f,0xff9dff99,0xffa6ffa1,0xffaeffaa,0xffb5ffb1,0xffbbffb8,0xffc1ffbf,0xffc6ffc4,0xffcaffc8,0xffcdffcc,0xffcfffce,0xffd4ffd1,0xffd8ffd6,0xffd9ffd9,0xffd6ffd9,0xffd5ffd6,0xffd3ffd4,0xffd1ffd2,0xffceffcf,0xffcaffcc,0xffc2ffc7,
-0xffb5ffbc,0xffa5ffad,0xffa7ffa4,0xffadffaa,0xffb1ffaf,0xffb5ffb3,0xffb7ffb6,0xffb9ffb9,0xffbbffb9,0xffbbffbb,0xffb9ffbb,0xffb9ffb9,0xffb6ffb7,0xffb2ffb4,0xffacffaf,0xffa4ffa8,0xff95ff9e,0x0000508b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff822182,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff88,0xff97ff92,0xffa0ff9c,0xffa8ffa4,0xffb0ffac,
-0xffb7ffb4,0xffbdffb9,0xffc3ffc1,0xffc8ffc6,0xffccffca,0xffcfffce,0xffd2ffd1,0xffd3ffd3,0xffd2ffd2,0xffd1ffd1,0xffd1ffd1,0xffd1ffd1,0xffd1ffd1,0xffd1ffd1,0xffceffd0,0xffc8ffcc,0xffbeffc3,0xffb1ffb8,0xffafffae,0xffb3ffb1,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb6ffb7,0xffb2ffb4,0xffadffb0,0xffa6ffaa,0xff9bffa1,0x2787ff91,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc0820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff95ff91,0xff9fff9a,0xffa8ffa3,0xffb0ffac,0xffb7ffb3,0xffbeffb9,0xffc3ffc1,0xffc6ffc5,0xffc8ffc7,0xffcaffc9,0xffcbffcb,0xffccffcc,0xffcdffcc,0xffceffcd,0xffcfffce,0xffd0ffcf,0xffd0ffd0,0xffd1ffd1,0xffceffd0,0xffc9ffcc,0xffc2ffc5,
-0xffb9ffbe,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb5ffb6,0xffb1ffb3,0xffacffaf,0xffa4ffa8,0xff97ff9e,0x0000b68d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x1c820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff84,0xff93ff8e,0xff9cff98,0xffa4ffa0,0xffacffa8,0xffb3ffaf,0xffb9ffb6,0xffbeffbc,0xffc3ffc1,0xffc6ffc5,0xffc9ffc8,0xffcaffca,0xffc9ffca,0xffc2ffc7,0x1eadffb8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff831c82,
-0xff8fff88,0xff9aff95,0xffa2ff9f,0xffa9ffa6,0xffaeffac,0xffb3ffb1,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffbbffbb,0xffbbffbb,0xffb9ffb9,0xffb7ffb8,0xffb3ffb5,0xffaeffb1,0xffa5ffaa,0xff93ff9f,0x0000168b,0x00000000,0x00000000,0x00000000,0xff82d482,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9aff96,0xffa2ff9e,0xffaaffa6,0xffb1ffae,0xffb8ffb5,0xffbdffb9,
-0xffc2ffc0,0xffc6ffc4,0xffc9ffc8,0xffcaffca,0xffc9ffcb,0xffc0ffc6,0xe9b1ffb9,0x0000019f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82f082,0xff8fff87,0xff9bff96,0xffa3ff9f,0xffa9ffa6,0xffaeffac,0xffb2ffb0,0xffb5ffb4,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb7ffb8,0xffb5ffb6,0xffb1ffb3,0xffabffae,
-0xffa2ffa7,0xd890ff9b,0x00000000,0x00000000,0x00000000,0x00000000,0x80820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff84,0xff93ff8f,0xff9dff98,0xffa5ffa1,0xffadffa9,0xffb4ffb1,0xffbbffb7,0xffc0ffbd,0xffc5ffc3,0xffc9ffc7,0xffccffca,0xffcdffcc,0xffd0ffce,0xffd3ffd1,0xffd6ffd4,0xffd6ffd6,0xffd3ffd5,0xffd1ffd2,0xffcfffd0,0xffcdffce,0xffc6ffcb,0xffb9ffc0,
-0xffabffb1,0xff9fffa5,0xffa3ffa0,0xffa9ffa6,0xffaeffac,0xffb2ffb0,0xffb5ffb4,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb5ffb7,0xffb2ffb4,0xffacffaf,0xffa4ffa9,0xff96ff9f,0x00007a8c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff825882,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff88,0xff97ff93,0xffa0ff9c,0xffa8ffa4,0xffb0ffac,
-0xffb7ffb3,0xffbdffb9,0xffc3ffc0,0xffc7ffc5,0xffcbffc9,0xffceffcd,0xffd0ffcf,0xffd0ffd0,0xffd0ffd0,0xffcfffd0,0xffcfffcf,0xffcfffcf,0xffcfffcf,0xffcfffd0,0xffc9ffcc,0xffc1ffc5,0xffb8ffbd,0xffadffb3,0xffacffaa,0xffb0ffaf,0xffb4ffb2,0xffb6ffb5,0xffb8ffb7,0xffb9ffb8,0xffb8ffb9,0xffb8ffb8,0xffb6ffb7,0xffb2ffb4,0xffaeffb0,0xffa7ffab,0xff9dffa2,0x5a8aff93,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf7820982,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff96ff91,0xff9fff9b,0xffa8ffa3,0xffb0ffac,0xffb7ffb3,0xffbdffb9,0xffc3ffc0,0xffc6ffc5,0xffc9ffc7,0xffcbffca,0xffcdffcc,0xffceffcd,0xffceffce,0xffcfffcf,0xffd0ffd0,0xffd1ffd1,0xffd2ffd2,0xffd0ffd1,0xffccffce,0xffc6ffc9,0xffbfffc2,
-0xffb6ffb9,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffb8ffb9,0xffb7ffb8,0xffb5ffb6,0xffb1ffb3,0xffacffaf,0xffa5ffa9,0xff99ffa0,0x0d85f18f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x30820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9bff97,0xffa4ffa0,0xffabffa7,0xffb2ffae,0xffb8ffb5,0xffbdffbb,0xffc2ffbf,0xffc5ffc3,0xffc8ffc7,0xffc9ffc8,0xffc6ffc8,0xffbcffc3,0x2ca5ffb1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff822e82,
-0xff8aff84,0xff97ff92,0xffa0ff9c,0xffa7ffa3,0xffacffaa,0xffb1ffaf,0xffb4ffb3,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb6ffb7,0xffb3ffb5,0xffadffb0,0xffa5ffaa,0xff95ff9f,0x0000268c,0x00000000,0x00000000,0x05820000,0xff82f982,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9aff96,0xffa2ff9e,0xffaaffa6,0xffb1ffad,0xffb7ffb4,0xffbdffb9,
-0xffc1ffbf,0xffc5ffc3,0xffc8ffc7,0xffc9ffc9,0xffc4ffc8,0xffb9ffbf,0xffa6ffb2,0x0000169e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0f820000,0xff82f982,0xff89ff83,0xff98ff91,0xffa1ff9d,0xffa7ffa4,0xffacffaa,0xffb1ffaf,0xffb4ffb2,0xffb6ffb5,0xffb8ffb7,0xffb9ffb8,0xffb8ffb9,0xffb7ffb8,0xffb5ffb6,0xffb1ffb3,0xffabffae,
-0xffa2ffa7,0xfb91ff9c,0x00000b87,0x00000000,0x00000000,0x00000000,0xae820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9dff99,0xffa5ffa1,0xffadffa9,0xffb4ffb0,0xffb9ffb7,0xffc0ffbd,0xffc4ffc2,0xffc8ffc6,0xffcaffc9,0xffc9ffca,0xffc8ffc8,0xffcaffc9,0xffceffcc,0xffd2ffd1,0xffd2ffd2,0xffd0ffd1,0xffceffcf,0xffcaffcd,0xffbbffc4,0xffabffb2,
-0xffa0ffa5,0xff99ff9b,0xffa0ff9b,0xffa7ffa4,0xffacffaa,0xffb1ffae,0xffb4ffb2,0xffb6ffb5,0xffb8ffb7,0xffb9ffb8,0xffb8ffb9,0xffb7ffb8,0xffb5ffb6,0xffb2ffb4,0xffadffaf,0xffa5ffa9,0xff98ffa0,0x0000ac8e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff829c82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff89,0xff98ff93,0xffa1ff9c,0xffa9ffa5,0xffb0ffad,
-0xffb7ffb4,0xffbdffb9,0xffc2ffc0,0xffc7ffc5,0xffc9ffc8,0xffcaffca,0xffcaffca,0xffcbffca,0xffccffcb,0xffcdffcd,0xffcdffcd,0xffceffcd,0xffceffce,0xffc9ffcc,0xffc1ffc5,0xffb9ffbd,0xffb1ffb5,0xffa8ffad,0xffaaffa7,0xffafffad,0xffb2ffb1,0xffb5ffb4,0xffb7ffb6,0xffb8ffb8,0xffb8ffb8,0xffb7ffb8,0xffb6ffb7,0xffb3ffb4,0xffaeffb1,0xffa8ffab,0xff9effa4,0x948cff96,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff824e82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff88,0xff97ff92,0xffa0ff9b,0xffa8ffa4,0xffb0ffac,0xffb7ffb4,0xffbdffb9,0xffc3ffc0,0xffc7ffc5,0xffc9ffc8,0xffcbffca,0xffccffcb,0xffcdffcc,0xffceffcd,0xffcfffce,0xffd0ffcf,0xffd1ffd0,0xffd0ffd1,0xffccffce,0xffc8ffca,0xffc3ffc5,0xffbcffbf,
-0xffb3ffb7,0xffb4ffb2,0xffb6ffb5,0xffb8ffb7,0xffb8ffb8,0xffb8ffb8,0xffb7ffb8,0xffb5ffb6,0xffb2ffb3,0xffadffb0,0xffa6ffaa,0xff9bffa1,0x4c88ff92,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x54820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff92ff8e,0xff9bff97,0xffa3ff9f,0xffabffa7,0xffb1ffae,0xffb7ffb4,0xffbdffb9,0xffc1ffbf,0xffc4ffc3,0xffc7ffc6,0xffc7ffc7,0xffc3ffc6,0xffb6ffbd,0x6aa0ffac,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff826c82,
-0xff86ff82,0xff95ff8e,0xff9eff9a,0xffa5ffa2,0xffabffa8,0xffafffad,0xffb3ffb1,0xffb6ffb4,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb8ffb8,0xffb6ffb7,0xffb2ffb4,0xffadffb0,0xffa5ffaa,0xff96ff9f,0x0000488c,0x00000000,0x00000000,0x2c820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9aff96,0xffa2ff9e,0xffaaffa6,0xffb1ffae,0xffb7ffb4,0xffbcffb9,
-0xffc1ffbf,0xffc5ffc3,0xffc7ffc6,0xffc6ffc7,0xffbeffc3,0xffb4ffb9,0xffa4ffad,0x0000649a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6a820000,0xff82ff82,0xff86ff82,0xff93ff8d,0xff9fff9a,0xffa6ffa3,0xffabffa9,0xffb0ffae,0xffb3ffb2,0xffb6ffb5,0xffb7ffb7,0xffb8ffb8,0xffb8ffb8,0xffb7ffb8,0xffb5ffb6,0xffb1ffb3,0xffacffaf,
-0xffa3ffa8,0xff91ff9d,0x00002289,0x00000000,0x00000000,0x00000000,0xe6820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff95ff90,0xff9dff99,0xffa6ffa2,0xffadffaa,0xffb4ffb1,0xffb9ffb7,0xffbfffbd,0xffc4ffc2,0xffc7ffc6,0xffc8ffc8,0xffc4ffc7,0xffc0ffc1,0xffc1ffc0,0xffc5ffc3,0xffccffc8,0xffcfffce,0xffceffcf,0xffccffcd,0xffc0ffc8,0xffadffb6,0xff9fffa5,
-0xff96ff9a,0xff92ff92,0xff9cff97,0xffa5ffa1,0xffabffa8,0xffafffad,0xffb3ffb1,0xffb5ffb4,0xffb7ffb6,0xffb8ffb8,0xffb8ffb8,0xffb7ffb8,0xffb5ffb6,0xffb2ffb4,0xffadffb0,0xffa6ffaa,0xff9affa1,0x0186e18f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82d082,0xff82ff82,0xff82ff82,0xff85ff82,0xff90ff8a,0xff99ff93,0xffa1ff9d,0xffa9ffa6,0xffb1ffad,
-0xffb7ffb4,0xffbdffb9,0xffc2ffc0,0xffc6ffc4,0xffc6ffc7,0xffc4ffc5,0xffc4ffc4,0xffc5ffc5,0xffc8ffc7,0xffcaffc9,0xffccffcb,0xffccffcc,0xffc9ffcc,0xffc0ffc5,0xffb8ffbc,0xffb0ffb4,0xffa9ffad,0xffa3ffa5,0xffa8ffa4,0xffaeffab,0xffb1ffb0,0xffb4ffb3,0xffb6ffb6,0xffb8ffb7,0xffb8ffb8,0xffb8ffb8,0xffb6ffb7,0xffb3ffb5,0xffafffb1,0xffa9ffac,0xffa0ffa5,0xd08eff99,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff828682,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff89,0xff98ff93,0xffa1ff9d,0xffa9ffa5,0xffb0ffad,0xffb7ffb4,0xffbdffbb,0xffc3ffc0,0xffc6ffc5,0xffc7ffc7,0xffc7ffc7,0xffc8ffc7,0xffcaffc9,0xffcbffca,0xffcdffcc,0xffcfffce,0xffceffcf,0xffcaffcc,0xffc6ffc8,0xffc1ffc3,0xffbdffbf,0xffb7ffbb,
-0xffb1ffb4,0xffb3ffb1,0xffb5ffb4,0xffb7ffb6,0xffb8ffb8,0xffb8ffb8,0xffb7ffb8,0xffb5ffb6,0xffb2ffb4,0xffaeffb0,0xffa7ffab,0xff9dffa3,0x8c8cff95,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x72820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9bff97,0xffa3ff9f,0xffabffa7,0xffb1ffae,0xffb7ffb4,0xffbcffb9,0xffc1ffbf,0xffc4ffc2,0xffc6ffc5,0xffc6ffc7,0xffbeffc2,0xffb1ffb8,0xc29dffa9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82c682,
-0xff84ff82,0xff92ff8a,0xff9dff98,0xffa4ffa1,0xffaaffa7,0xffafffac,0xffb2ffb1,0xffb5ffb4,0xffb7ffb6,0xffb8ffb8,0xffb9ffb9,0xffb8ffb8,0xffb6ffb7,0xffb2ffb4,0xffadffb0,0xffa6ffaa,0xff97ffa0,0x0000668e,0x00000000,0x00000000,0x58820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff92ff8d,0xff9bff96,0xffa3ff9f,0xffaaffa7,0xffb1ffae,0xffb7ffb4,0xffbdffb9,
-0xffc1ffbf,0xffc5ffc3,0xffc6ffc6,0xffc1ffc4,0xffb9ffbe,0xffb0ffb5,0xffa2ffaa,0x058cd399,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd1820582,0xff82ff82,0xff84ff82,0xff91ff8a,0xff9dff97,0xffa5ffa2,0xffabffa8,0xffafffad,0xffb3ffb1,0xffb6ffb4,0xffb7ffb7,0xffb8ffb8,0xffb8ffb8,0xffb7ffb8,0xffb5ffb6,0xffb2ffb3,0xffacffaf,
-0xffa4ffa9,0xff95ff9e,0x0000528b,0x00000000,0x00000000,0x00000000,0xfd821382,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff95ff91,0xff9eff9a,0xffa6ffa2,0xffaeffaa,0xffb4ffb1,0xffb9ffb7,0xffbfffbd,0xffc4ffc2,0xffc7ffc6,0xffc4ffc6,0xffbeffc1,0xffb9ffbb,0xffb9ffb9,0xffbdffbb,0xffc3ffc0,0xffcbffc7,0xffccffcc,0xffc7ffcb,0xffb0ffbd,0xffa0ffa7,0xff95ff9a,
-0xff8fff91,0xff8dff8c,0xff99ff93,0xffa3ff9e,0xffaaffa7,0xffaeffac,0xffb2ffb0,0xffb5ffb4,0xffb7ffb6,0xffb8ffb8,0xffb8ffb8,0xffb7ffb8,0xffb6ffb7,0xffb2ffb4,0xffaeffb0,0xffa7ffab,0xff9cffa2,0x1088ff90,0x00000000,0x00000000,0x00000000,0x00000000,0x0f820000,0xff82fd82,0xff82ff82,0xff82ff82,0xff86ff83,0xff91ff8c,0xff9aff95,0xffa2ff9e,0xffaaffa6,0xffb1ffae,
-0xffb8ffb5,0xffbeffbb,0xffc3ffc0,0xffc4ffc4,0xffc1ffc3,0xffbeffbf,0xffbfffbe,0xffc0ffbf,0xffc3ffc2,0xffc7ffc5,0xffcaffc8,0xffcaffcb,0xffc1ffc6,0xffb8ffbd,0xffb1ffb4,0xffa9ffad,0xffa2ffa6,0xff9eff9f,0xffa5ffa1,0xffacffa9,0xffb1ffaf,0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffb8ffb8,0xffb8ffb8,0xffb7ffb7,0xffb4ffb5,0xffb0ffb2,0xffaaffad,0xffa1ffa6,0xfb91ff9b,
-0x00000d88,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82d282,0xff82ff82,0xff82ff82,0xff85ff82,0xff90ff8b,0xff99ff95,0xffa2ff9e,0xffaaffa6,0xffb1ffae,0xffb8ffb5,0xffbeffbb,0xffc3ffc1,0xffc4ffc4,0xffc2ffc3,0xffc3ffc2,0xffc4ffc3,0xffc6ffc5,0xffc9ffc8,0xffccffca,0xffcdffcd,0xffc9ffcb,0xffc4ffc6,0xffbfffc2,0xffbbffbd,0xffb7ffb9,0xffb2ffb4,
-0xffaeffae,0xffb2ffb0,0xffb5ffb3,0xffb7ffb6,0xffb8ffb7,0xffb8ffb8,0xffb8ffb8,0xffb6ffb7,0xffb3ffb5,0xffafffb1,0xffa9ffac,0xff9fffa5,0xd48eff98,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x8e820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff84,0xff93ff8e,0xff9cff97,0xffa4ffa0,0xffabffa7,0xffb1ffae,0xffb7ffb4,0xffbcffb9,0xffc1ffbf,0xffc4ffc2,0xffc6ffc5,0xffc2ffc5,0xffb9ffbe,0xffaeffb4,0xff9dffa7,0x00003d92,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3f820000,0xff82ff82,
-0xff83ff82,0xff8fff88,0xff9bff96,0xffa3ffa0,0xffa9ffa6,0xffaeffac,0xffb2ffb0,0xffb5ffb4,0xffb7ffb6,0xffb8ffb8,0xffb9ffb9,0xffb8ffb8,0xffb6ffb7,0xffb3ffb5,0xffaeffb1,0xffa6ffaa,0xff99ffa1,0x0000888f,0x00000000,0x00000000,0x7a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff92ff8e,0xff9bff97,0xffa4ffa0,0xffabffa7,0xffb2ffae,0xffb8ffb5,0xffbdffb9,
-0xffc1ffbf,0xffc5ffc3,0xffc3ffc5,0xffbdffc0,0xffb6ffb9,0xffaeffb2,0xffa2ffa8,0x708fff99,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff826a82,0xff82ff82,0xff84ff82,0xff8fff89,0xff9bff95,0xffa4ffa0,0xffaaffa8,0xffafffad,0xffb3ffb1,0xffb6ffb4,0xffb7ffb7,0xffb8ffb8,0xffb9ffb9,0xffb8ffb8,0xffb6ffb7,0xffb2ffb4,0xffadffb0,
-0xffa5ffaa,0xff97ffa0,0x0000788d,0x00000000,0x00000000,0x00000000,0xff824682,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff88,0xff96ff92,0xff9fff9b,0xffa7ffa3,0xffaeffab,0xffb5ffb1,0xffbbffb8,0xffc0ffbd,0xffc4ffc2,0xffc4ffc5,0xffbfffc2,0xffb9ffbc,0xffb4ffb6,0xffb4ffb4,0xffb7ffb5,0xffbbffb8,0xffc3ffbf,0xffc9ffc7,0xffb9ffc5,0xffa2ffac,0xff96ff9b,0xff8eff91,
-0xff89ff8b,0xff8bff88,0xff96ff90,0xffa0ff9b,0xffa8ffa5,0xffaeffab,0xffb2ffb0,0xffb5ffb3,0xffb7ffb6,0xffb8ffb8,0xffb8ffb8,0xffb8ffb8,0xffb6ffb7,0xffb3ffb5,0xffafffb1,0xffa8ffac,0xff9dffa4,0x3e8bff93,0x00000000,0x00000000,0x00000000,0x00000000,0x46820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff9bff97,0xffa4ff9f,0xffabffa8,0xffb2ffaf,
-0xffb9ffb6,0xffbeffbc,0xffc2ffc1,0xffc0ffc1,0xffbcffbe,0xffb9ffbb,0xffb9ffb9,0xffbcffbb,0xffc0ffbe,0xffc3ffc1,0xffc7ffc5,0xffc4ffc7,0xffb9ffbf,0xffb1ffb5,0xffaaffad,0xffa3ffa6,0xff9cffa0,0xff9aff9a,0xffa3ff9e,0xffabffa7,0xffb0ffae,0xffb4ffb2,0xffb6ffb5,0xffb8ffb7,0xffb9ffb8,0xffb8ffb9,0xffb7ffb8,0xffb5ffb6,0xffb1ffb3,0xffacffaf,0xffa3ffa8,0xff93ff9d,
-0x0000488a,0x00000000,0x00000000,0x00000000,0x00000000,0x1d820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9bff96,0xffa3ff9f,0xffabffa7,0xffb2ffaf,0xffb9ffb6,0xffbfffbc,0xffc0ffc0,0xffbfffc0,0xffbeffbe,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc7ffc5,0xffcaffc8,0xffc8ffca,0xffc3ffc6,0xffbeffc0,0xffb9ffbc,0xffb5ffb7,0xffb1ffb3,0xffacffae,
-0xffaaffa9,0xffb1ffae,0xffb4ffb3,0xffb7ffb6,0xffb8ffb8,0xffb9ffb8,0xffb8ffb8,0xffb7ffb8,0xffb4ffb6,0xffb0ffb2,0xffaaffad,0xffa1ffa6,0xfb91ff9b,0x00001588,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xb0820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9cff98,0xffa4ffa0,0xffabffa8,0xffb2ffaf,0xffb8ffb5,0xffbdffb9,0xffc1ffbf,0xffc4ffc3,0xffc4ffc5,0xffbeffc1,0xffb5ffb9,0xffacffb1,0xff9effa6,0x0788d592,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd1820582,0xff82ff82,
-0xff83ff82,0xff8eff88,0xff9aff93,0xffa3ff9f,0xffa9ffa6,0xffaeffac,0xffb2ffb0,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffb8ffb9,0xffb7ffb8,0xffb3ffb5,0xffaeffb1,0xffa7ffab,0xff9affa2,0x0000a890,0x00000000,0x00000000,0x9a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9cff98,0xffa4ffa0,0xffacffa8,0xffb2ffaf,0xffb8ffb6,0xffbeffbb,
-0xffc2ffc0,0xffc4ffc4,0xffbfffc2,0xffb9ffbc,0xffb3ffb6,0xffacffaf,0xffa2ffa7,0xf392ff9b,0x00002b88,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29820000,0xff82f582,0xff82ff82,0xff84ff82,0xff8eff89,0xff99ff93,0xffa3ff9e,0xffaaffa7,0xffafffad,0xffb3ffb1,0xffb6ffb4,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb8ffb9,0xffb6ffb8,0xffb3ffb5,0xffaeffb1,
-0xffa6ffab,0xff99ffa1,0x0000a28f,0x00000000,0x00000000,0x00000000,0xff827082,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff89,0xff97ff93,0xffa0ff9c,0xffa8ffa4,0xffafffab,0xffb6ffb2,0xffbbffb9,0xffc0ffbe,0xffc3ffc2,0xffbfffc2,0xffbbffbd,0xffb6ffb9,0xffb1ffb3,0xffb0ffb0,0xffb2ffb1,0xffb5ffb3,0xffbbffb8,0xffc1ffc0,0xffa9ffb8,0xff97ff9f,0xff8eff92,0xff89ff8b,
-0xff85ff87,0xff8aff85,0xff93ff8f,0xff9eff99,0xffa7ffa3,0xffadffab,0xffb2ffb0,0xffb5ffb3,0xffb7ffb6,0xffb8ffb8,0xffb9ffb9,0xffb8ffb9,0xffb7ffb8,0xffb4ffb6,0xffb0ffb2,0xffa9ffad,0xff9fffa5,0x728dff97,0x00000000,0x00000000,0x00000000,0x00000000,0x70820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9cff98,0xffa5ffa1,0xffacffa9,0xffb3ffb0,
-0xffb9ffb7,0xffbfffbc,0xffbfffbf,0xffbbffbd,0xffb9ffb9,0xffb6ffb7,0xffb7ffb6,0xffb9ffb8,0xffbcffb9,0xffc0ffbe,0xffc3ffc2,0xffbcffc1,0xffb2ffb7,0xffabffae,0xffa4ffa7,0xff9effa1,0xff97ff9b,0xff98ff96,0xffa1ff9d,0xffa9ffa5,0xffb0ffac,0xffb4ffb2,0xffb7ffb5,0xffb8ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb6ffb7,0xffb2ffb4,0xffadffb0,0xffa5ffa9,0xff97ff9f,
-0x00007c8d,0x00000000,0x00000000,0x00000000,0x00000000,0x4c820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff93ff8e,0xff9cff97,0xffa4ffa0,0xffacffa9,0xffb3ffb0,0xffb9ffb7,0xffbdffbc,0xffbcffbd,0xffb9ffbb,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffc1ffbf,0xffc4ffc3,0xffc7ffc6,0xffc3ffc5,0xffbdffc0,0xffb9ffbb,0xffb4ffb7,0xffb0ffb2,0xffacffae,0xffa6ffa9,
-0xffa8ffa5,0xffafffab,0xffb4ffb2,0xffb7ffb6,0xffb8ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb8,0xffb5ffb7,0xffb1ffb3,0xffacffaf,0xffa3ffa8,0xff93ff9d,0x0000548a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xcc820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff93ff90,0xff9dff99,0xffa5ffa1,0xffacffa9,0xffb2ffaf,0xffb8ffb5,0xffbdffbb,0xffc1ffbf,0xffc4ffc3,0xffc1ffc3,0xffb9ffbd,0xffb3ffb7,0xffaaffaf,0xff9fffa5,0x7e8bff95,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827882,0xff82ff82,
-0xff83ff82,0xff8eff88,0xff99ff93,0xffa3ff9e,0xffa9ffa6,0xffaeffac,0xffb2ffb0,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb7ffb8,0xffb4ffb6,0xffafffb2,0xffa8ffac,0xff9cffa3,0x0000c891,0x00000000,0x00000000,0xc6820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff93ff90,0xff9dff99,0xffa5ffa1,0xffadffa9,0xffb3ffb0,0xffb9ffb6,0xffbeffbc,
-0xffc2ffc0,0xffc0ffc2,0xffbbffbe,0xffb6ffb9,0xffb1ffb4,0xffaaffae,0xffa2ffa7,0xff95ff9c,0x0d83cb8c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xcb820b82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff89,0xff98ff93,0xffa2ff9d,0xffaaffa6,0xffafffad,0xffb3ffb1,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb7ffb8,0xffb4ffb6,0xffafffb2,
-0xffa8ffac,0xff9bffa2,0x0000be91,0x00000000,0x00000000,0x00000000,0xff829e82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8fff8a,0xff99ff93,0xffa1ff9d,0xffa9ffa5,0xffb0ffac,0xffb6ffb3,0xffbcffb9,0xffc0ffbf,0xffc0ffc1,0xffbbffbd,0xffb8ffb9,0xffb3ffb6,0xffafffb1,0xffadffad,0xffaeffad,0xffb0ffaf,0xffb5ffb2,0xffb2ffb7,0xff9cffa7,0xff8fff93,0xff89ff8c,0xff85ff87,
-0xff82ff84,0xff8aff85,0xff93ff8f,0xff9dff99,0xffa5ffa1,0xffadffa9,0xffb2ffb0,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb5ffb7,0xffb1ffb3,0xffabffae,0xffa1ffa6,0x9c8fff99,0x00000000,0x00000000,0x00000000,0x00000000,0xae820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff95ff90,0xff9eff99,0xffa6ffa2,0xffaeffaa,0xffb4ffb1,
-0xffbbffb8,0xffbdffbd,0xffbbffbc,0xffb8ffb9,0xffb6ffb7,0xffb3ffb5,0xffb4ffb3,0xffb6ffb5,0xffb9ffb7,0xffbdffbb,0xffbdffbf,0xffb5ffb9,0xffacffb0,0xffa5ffa8,0xff9fffa2,0xff99ff9c,0xff93ff96,0xff98ff93,0xffa0ff9c,0xffa7ffa3,0xffaeffab,0xffb4ffb1,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb7ffb8,0xffb3ffb5,0xffaeffb1,0xffa6ffab,0xff99ffa1,
-0x0000a88f,0x00000000,0x00000000,0x00000000,0x00000000,0x92820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9dff99,0xffa6ffa2,0xffaeffaa,0xffb5ffb1,0xffb9ffb8,0xffb9ffb9,0xffb8ffb9,0xffb7ffb7,0xffb7ffb7,0xffb9ffb8,0xffbbffb9,0xffbfffbd,0xffc2ffc0,0xffc2ffc3,0xffbdffc0,0xffb8ffbb,0xffb4ffb6,0xffb0ffb2,0xffacffae,0xffa7ffa9,0xffa2ffa4,
-0xffa6ffa3,0xffadffaa,0xffb3ffb0,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb6ffb7,0xffb3ffb5,0xffadffb0,0xffa5ffaa,0xff97ff9f,0x0000908d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xde820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff95ff91,0xff9eff9a,0xffa6ffa2,0xffadffa9,0xffb3ffb0,0xffb9ffb6,0xffbeffbc,0xffc2ffc0,0xffc3ffc3,0xffbdffc0,0xffb7ffb9,0xffb1ffb4,0xffa9ffad,0xffa0ffa5,0xfb8fff99,0x00004386,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x37820000,0xff82f782,0xff82ff82,
-0xff84ff82,0xff8eff89,0xff99ff93,0xffa2ff9d,0xffa9ffa6,0xffafffac,0xffb3ffb1,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb5ffb7,0xffb0ffb3,0xffa9ffad,0xff9dffa4,0x0000e693,0x00000000,0x00000000,0xea820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff96ff91,0xff9eff9a,0xffa6ffa2,0xffadffaa,0xffb4ffb1,0xffb9ffb7,0xffbfffbd,
-0xffc1ffc1,0xffbdffbf,0xffb8ffb9,0xffb4ffb6,0xffafffb2,0xffaaffad,0xffa2ffa6,0xff98ff9e,0xa788ff91,0x00000182,0x00000000,0x00000000,0x00000000,0x01820000,0xff82a382,0xff82ff82,0xff82ff82,0xff85ff82,0xff8fff8a,0xff98ff93,0xffa1ff9d,0xffa9ffa5,0xffafffac,0xffb4ffb2,0xffb7ffb5,0xffb9ffb8,0xffb9ffb9,0xffbbffbb,0xffb9ffb9,0xffb8ffb9,0xffb5ffb7,0xffb0ffb3,
-0xffa9ffad,0xff9dffa4,0x0000e692,0x00000000,0x00000000,0x00000000,0xff82ca82,0xff82ff82,0xff82ff82,0xff86ff83,0xff90ff8b,0xff9aff95,0xffa2ff9e,0xffaaffa6,0xffb1ffae,0xffb7ffb4,0xffbdffb9,0xffbfffbf,0xffbcffbe,0xffb8ffb9,0xffb5ffb7,0xffb1ffb3,0xffadffb0,0xffaaffab,0xffabffab,0xffadffac,0xffafffae,0xffa5ffad,0xff93ff9b,0xff8aff8d,0xff86ff88,0xff83ff84,
-0xff82ff82,0xff8bff86,0xff93ff90,0xff9cff98,0xffa4ffa0,0xffacffa8,0xffb2ffaf,0xffb5ffb4,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb6ffb8,0xffb2ffb4,0xffacffaf,0xffa3ffa8,0xc491ff9c,0x00000000,0x00000000,0x00000000,0x00000000,0xe6820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff96ff91,0xff9fff9b,0xffa7ffa3,0xffafffab,0xffb6ffb2,
-0xffbbffb9,0xffb9ffb9,0xffb7ffb8,0xffb5ffb6,0xffb4ffb5,0xffb2ffb3,0xffb1ffb1,0xffb3ffb2,0xffb7ffb5,0xffb9ffb8,0xffb7ffb9,0xffafffb3,0xffa7ffab,0xffa0ffa3,0xff9bff9d,0xff95ff98,0xff91ff92,0xff98ff93,0xff9fff9c,0xffa6ffa3,0xffadffa9,0xffb3ffb0,0xffb7ffb6,0xffb9ffb9,0xffbbffb9,0xffbbffbb,0xffb9ffb9,0xffb8ffb9,0xffb5ffb6,0xffb0ffb2,0xffa8ffac,0xff9cffa3,
-0x0000da92,0x00000000,0x00000000,0x00000000,0x00000000,0xd4820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff86,0xff96ff91,0xff9fff9b,0xffa7ffa3,0xffafffab,0xffb5ffb2,0xffb7ffb7,0xffb6ffb7,0xffb5ffb6,0xffb4ffb5,0xffb4ffb4,0xffb6ffb5,0xffb9ffb8,0xffbdffbb,0xffc0ffbe,0xffbdffbf,0xffb8ffbb,0xffb3ffb6,0xffafffb1,0xffabffad,0xffa7ffa9,0xffa2ffa5,0xff9fffa0,
-0xffa5ffa2,0xffabffa8,0xffb1ffae,0xffb7ffb4,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb7ffb8,0xffb4ffb6,0xffafffb2,0xffa7ffab,0xff9affa2,0x0000c890,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xf7820382,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff88,0xff96ff91,0xff9fff9a,0xffa6ffa3,0xffaeffaa,0xffb4ffb1,0xffb9ffb7,0xffbfffbc,0xffc2ffc1,0xffc0ffc2,0xffb9ffbd,0xffb5ffb8,0xffafffb2,0xffa9ffac,0xffa1ffa5,0xff93ff9b,0x1d83e78a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xdf822382,0xff82ff82,0xff82ff82,
-0xff85ff82,0xff8fff8a,0xff99ff93,0xffa1ff9d,0xffa9ffa5,0xffafffac,0xffb3ffb1,0xffb7ffb5,0xffb9ffb8,0xffb9ffb9,0xffbbffbb,0xffbbffbb,0xffb9ffb9,0xffb6ffb8,0xffb1ffb4,0xffaaffae,0xff9fffa5,0x058bf993,0x00000000,0x00000000,0xfb820782,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff88,0xff97ff92,0xff9fff9b,0xffa7ffa3,0xffaeffab,0xffb5ffb2,0xffbbffb8,0xffbfffbd,
-0xffbeffbf,0xffb9ffbc,0xffb6ffb8,0xffb2ffb4,0xffaeffb0,0xffa9ffac,0xffa3ffa6,0xff9aff9f,0xff8dff95,0x01828f85,0x00000000,0x00000000,0x00000000,0x8a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff83,0xff90ff8c,0xff99ff95,0xffa1ff9d,0xffa8ffa5,0xffafffac,0xffb4ffb2,0xffb7ffb6,0xffb9ffb9,0xffbbffb9,0xffbbffbb,0xffbbffbb,0xffb9ffb9,0xffb6ffb8,0xffb2ffb4,
-0xffabffae,0xff9fffa6,0x098cf995,0x00000000,0x00000000,0x03820000,0xff82f382,0xff82ff82,0xff82ff82,0xff87ff83,0xff92ff8d,0xff9bff96,0xffa3ff9f,0xffabffa7,0xffb2ffaf,0xffb8ffb5,0xffbdffbb,0xffbcffbd,0xffb9ffb9,0xffb6ffb7,0xffb3ffb4,0xffb0ffb2,0xffacffae,0xffa9ffaa,0xffa9ffa9,0xffaaffaa,0xffaaffab,0xff9cffa5,0xff8dff93,0xff86ff89,0xff83ff84,0xff82ff82,
-0xff83ff82,0xff8cff87,0xff93ff90,0xff9cff98,0xffa4ffa0,0xffabffa7,0xffb1ffae,0xffb6ffb4,0xffb9ffb7,0xffb9ffb9,0xffbbffbb,0xffbbffbb,0xffb9ffb9,0xffb7ffb9,0xffb3ffb6,0xffadffb1,0xffa4ffa9,0xf593ff9e,0x00000589,0x00000000,0x00000000,0x00000000,0xff821582,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff88,0xff97ff93,0xffa0ff9c,0xffa9ffa5,0xffb0ffac,0xffb7ffb3,
-0xffb8ffb8,0xffb6ffb7,0xffb5ffb5,0xffb3ffb4,0xffb2ffb3,0xffb0ffb1,0xffafffaf,0xffb1ffb0,0xffb4ffb3,0xffb7ffb6,0xffb1ffb5,0xffaaffae,0xffa2ffa6,0xff9cff9e,0xff96ff99,0xff91ff93,0xff91ff8f,0xff98ff95,0xff9fff9c,0xffa6ffa3,0xffacffa9,0xffb2ffaf,0xffb7ffb5,0xffb9ffb9,0xffbbffbb,0xffbcffbc,0xffbbffbb,0xffb9ffb9,0xffb6ffb8,0xffb1ffb4,0xffaaffae,0xff9effa5,
-0x158afd93,0x00000000,0x00000000,0x00000000,0x00000000,0xfd821782,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff88,0xff97ff92,0xffa0ff9c,0xffa9ffa4,0xffb0ffad,0xffb4ffb3,0xffb4ffb4,0xffb3ffb3,0xffb3ffb3,0xffb2ffb2,0xffb2ffb2,0xffb4ffb3,0xffb7ffb6,0xffbbffb9,0xffbcffbc,0xffb8ffb9,0xffb4ffb6,0xffafffb2,0xffabffad,0xffa7ffa9,0xffa3ffa5,0xff9effa1,0xff9eff9d,
-0xffa4ffa1,0xffaaffa7,0xffb0ffad,0xffb5ffb3,0xffb9ffb8,0xffbbffbb,0xffbbffbb,0xffb9ffbb,0xffb8ffb9,0xffb5ffb7,0xffb0ffb3,0xffa9ffad,0xff9dffa4,0x1588f992,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff821482,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff89,0xff97ff92,0xff9fff9b,0xffa7ffa3,0xffaeffab,0xffb5ffb2,0xffb9ffb8,0xffbfffbd,0xffc1ffc1,0xffbdffbf,0xffb8ffb9,0xffb3ffb6,0xffaeffb1,0xffa9ffac,0xffa1ffa5,0xff97ff9d,0xd587ff90,0x00001182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x13820000,0xff82d382,0xff82ff82,0xff82ff82,
-0xff87ff83,0xff90ff8c,0xff99ff95,0xffa2ff9e,0xffa9ffa5,0xffafffad,0xffb4ffb2,0xffb7ffb6,0xffb9ffb9,0xffbbffbb,0xffbcffbc,0xffbbffbc,0xffb9ffbb,0xffb7ffb9,0xffb3ffb5,0xffacffaf,0xffa0ffa7,0x168dff95,0x00000000,0x00000000,0xff822e82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff89,0xff98ff93,0xffa0ff9c,0xffa8ffa4,0xffafffac,0xffb6ffb3,0xffbcffb9,0xffbeffbe,
-0xffbbffbc,0xffb7ffb9,0xffb4ffb6,0xffb1ffb2,0xffadffaf,0xffa9ffab,0xffa4ffa6,0xff9cffa0,0xff92ff97,0x8384ff8b,0x00000182,0x00000000,0x00000000,0xff828182,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff92ff8d,0xff9aff96,0xffa1ff9d,0xffa8ffa5,0xffafffac,0xffb5ffb2,0xffb8ffb6,0xffb9ffb9,0xffbcffbb,0xffbcffbc,0xffbcffbc,0xffb9ffbb,0xffb7ffb9,0xffb3ffb5,
-0xffacffaf,0xffa1ffa7,0x308cff96,0x00000000,0x00000000,0x1e820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9cff97,0xffa4ffa0,0xffacffa8,0xffb3ffb0,0xffb9ffb6,0xffbbffbb,0xffb8ffb9,0xffb6ffb7,0xffb4ffb5,0xffb2ffb3,0xffafffb0,0xffacffae,0xffa8ffaa,0xffa7ffa7,0xffa8ffa8,0xffa5ffa8,0xff97ff9f,0xff8aff90,0xff83ff86,0xff82ff82,0xff82ff82,
-0xff84ff82,0xff8dff89,0xff95ff91,0xff9dff99,0xffa4ffa0,0xffaaffa7,0xffb1ffad,0xffb6ffb4,0xffb9ffb8,0xffbbffb9,0xffbcffbc,0xffbcffbc,0xffbbffbb,0xffb8ffb9,0xffb4ffb7,0xffafffb2,0xffa6ffab,0xff93ff9f,0x00001e8b,0x00000000,0x00000000,0x00000000,0xff824482,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff8a,0xff99ff93,0xffa2ff9d,0xffaaffa6,0xffb1ffae,0xffb6ffb4,
-0xffb5ffb6,0xffb3ffb4,0xffb2ffb3,0xffb2ffb2,0xffb1ffb1,0xffafffb0,0xffaeffae,0xffafffae,0xffb2ffb0,0xffb3ffb3,0xffadffb0,0xffa6ffa9,0xff9effa2,0xff97ff9b,0xff92ff95,0xff8eff90,0xff92ff8e,0xff99ff95,0xffa0ff9c,0xffa6ffa3,0xffacffa9,0xffb1ffae,0xffb7ffb4,0xffbbffb9,0xffbcffbb,0xffbcffbc,0xffbcffbc,0xffb9ffbb,0xffb7ffb9,0xffb2ffb5,0xffabffaf,0xffa0ffa6,
-0x468cff96,0x00000000,0x00000000,0x00000000,0x00000000,0xff824282,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff8a,0xff99ff93,0xffa2ff9d,0xffaaffa6,0xffb1ffae,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffb0ffb0,0xffb2ffb1,0xffb5ffb4,0xffb9ffb7,0xffb9ffb9,0xffb4ffb7,0xffb0ffb2,0xffacffae,0xffa7ffa9,0xffa3ffa5,0xff9fffa1,0xff9bff9c,0xff9eff9b,
-0xffa4ffa1,0xffaaffa7,0xffafffac,0xffb4ffb2,0xffb9ffb7,0xffbcffbb,0xffbcffbc,0xffbbffbc,0xffb9ffb9,0xffb6ffb8,0xffb1ffb4,0xffaaffae,0xff9fffa5,0x468bff93,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff823082,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff89,0xff98ff93,0xffa0ff9c,0xffa8ffa4,0xffafffac,0xffb6ffb3,0xffbbffb9,0xffc0ffbe,0xffbfffc0,0xffb9ffbc,0xffb6ffb8,0xffb2ffb4,0xffadffb0,0xffa8ffab,0xffa2ffa5,0xff9aff9e,0xff8cff93,0x0982c784,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc3821182,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff89ff84,0xff92ff8e,0xff9aff96,0xffa2ff9e,0xffa9ffa6,0xffb0ffad,0xffb4ffb2,0xffb8ffb6,0xffb9ffb9,0xffbcffbb,0xffbdffbc,0xffbcffbd,0xffbbffbc,0xffb8ffb9,0xffb4ffb6,0xffadffb0,0xffa2ffa8,0x308eff97,0x00000000,0x00000000,0xff824282,0xff82ff82,0xff82ff82,0xff85ff82,0xff8fff8a,0xff98ff93,0xffa1ff9d,0xffa9ffa5,0xffb0ffad,0xffb7ffb4,0xffbcffb9,0xffbbffbd,
-0xffb8ffb9,0xffb5ffb6,0xffb2ffb4,0xffb0ffb1,0xffadffae,0xffa9ffab,0xffa4ffa7,0xff9dffa1,0xff95ff99,0xff88ff90,0x15829982,0x00000000,0x94821182,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,0xff93ff8f,0xff9bff97,0xffa2ff9e,0xffa8ffa5,0xffafffac,0xffb5ffb2,0xffb9ffb7,0xffbbffb9,0xffbdffbc,0xffbdffbd,0xffbdffbd,0xffbbffbc,0xffb8ffb9,0xffb4ffb6,
-0xffadffb1,0xffa2ffa8,0x3c8fff98,0x00000000,0x00000000,0x46820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9dff99,0xffa5ffa1,0xffadffa9,0xffb4ffb1,0xffb9ffb7,0xffb8ffb9,0xffb6ffb7,0xffb4ffb5,0xffb2ffb3,0xffb0ffb1,0xffaeffaf,0xffabffad,0xffa8ffaa,0xffa6ffa6,0xffa7ffa6,0xffa1ffa5,0xff93ff9b,0xff88ff8e,0xff82ff84,0xff82ff82,0xff82ff82,
-0xff86ff82,0xff8fff8a,0xff96ff93,0xff9dff9a,0xffa4ffa1,0xffaaffa7,0xffb0ffad,0xffb6ffb3,0xffb9ffb8,0xffbcffbb,0xffbdffbc,0xffbdffbd,0xffbcffbc,0xffb9ffbb,0xffb6ffb8,0xffb0ffb3,0xffa7ffac,0xff97ffa1,0x00004a8d,0x00000000,0x00000000,0x00000000,0xff827a82,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8b,0xff9aff95,0xffa3ff9f,0xffabffa7,0xffb2ffaf,0xffb3ffb3,
-0xffb2ffb2,0xffb1ffb2,0xffb1ffb1,0xffb0ffb0,0xffafffb0,0xffaeffaf,0xffadffae,0xffadffac,0xffb0ffae,0xffafffb1,0xffa9ffac,0xffa2ffa5,0xff9bff9e,0xff93ff97,0xff8fff91,0xff8cff8c,0xff93ff8f,0xff9aff96,0xffa0ff9d,0xffa6ffa3,0xffabffa9,0xffb1ffae,0xffb6ffb3,0xffb9ffb8,0xffbdffbc,0xffbdffbd,0xffbcffbd,0xffbbffbc,0xffb8ffb9,0xffb3ffb6,0xffacffb0,0xffa2ffa8,
-0x728eff99,0x00000000,0x00000000,0x00000000,0x00000000,0xff827e82,0xff82ff82,0xff82ff82,0xff85ff82,0xff90ff8b,0xff9aff95,0xffa3ff9f,0xffabffa7,0xffafffae,0xffaeffae,0xffafffae,0xffafffaf,0xffafffaf,0xffafffaf,0xffafffaf,0xffb0ffaf,0xffb3ffb1,0xffb7ffb5,0xffb5ffb7,0xffb1ffb3,0xffadffaf,0xffa9ffab,0xffa3ffa6,0xff9fffa1,0xff9bff9d,0xff99ff99,0xff9fff9c,
-0xffa4ffa2,0xffa9ffa7,0xffaeffac,0xffb3ffb1,0xffb8ffb5,0xffbcffb9,0xffbdffbc,0xffbcffbc,0xffb9ffbb,0xffb7ffb9,0xffb2ffb5,0xffabffaf,0xffa0ffa7,0x7e8dff97,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff823e82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8fff8a,0xff99ff93,0xffa1ff9d,0xffa9ffa5,0xffb0ffad,0xffb7ffb3,0xffbcffb9,0xffc0ffbf,0xffbcffbe,0xffb8ffb9,0xffb4ffb6,0xffb1ffb2,0xffadffaf,0xffa8ffab,0xffa3ffa6,0xff9bff9f,0xff91ff97,0xc983ff89,0x00001982,0x00000000,0x00000000,0x00000000,0x13820000,0xff82c582,0xff82ff82,0xff82ff82,0xff83ff82,
-0xff8bff86,0xff93ff8f,0xff9bff98,0xffa3ff9f,0xffaaffa6,0xffb0ffad,0xffb5ffb3,0xffb9ffb7,0xffbbffb9,0xffbdffbc,0xffbeffbd,0xffbdffbe,0xffbcffbd,0xffb9ffbb,0xffb5ffb7,0xffaeffb2,0xffa3ffa9,0x468fff99,0x00000000,0x00000000,0xff826282,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8b,0xff9aff95,0xffa2ff9e,0xffaaffa6,0xffb1ffae,0xffb8ffb5,0xffbbffbb,0xffb9ffb9,
-0xffb6ffb7,0xffb3ffb4,0xffb1ffb2,0xffafffb0,0xffacffae,0xffa9ffaa,0xffa4ffa7,0xff9effa1,0xff96ff9b,0xff8cff92,0xf582ff85,0xbc82ba82,0xff82f582,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff89,0xff95ff91,0xff9cff98,0xffa2ff9f,0xffa9ffa6,0xffafffac,0xffb4ffb2,0xffb9ffb7,0xffbcffbb,0xffbdffbd,0xffbeffbe,0xffbeffbe,0xffbcffbd,0xffb9ffbb,0xffb5ffb7,
-0xffaeffb2,0xffa3ffa9,0x5a90ff9a,0x00000000,0x00000000,0x68820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff85,0xff95ff90,0xff9eff9a,0xffa7ffa3,0xffaeffab,0xffb5ffb2,0xffb8ffb8,0xffb5ffb6,0xffb4ffb4,0xffb2ffb3,0xffb1ffb1,0xffafffb0,0xffadffae,0xffabffac,0xffa8ffa9,0xffa4ffa6,0xffa5ffa4,0xff9effa3,0xff92ff98,0xff87ff8c,0xff82ff83,0xff82ff82,0xff82ff82,
-0xff88ff84,0xff90ff8c,0xff97ff93,0xff9eff9b,0xffa4ffa1,0xffaaffa7,0xffb0ffad,0xffb5ffb3,0xffb9ffb8,0xffbcffbb,0xffbdffbd,0xffbdffbe,0xffbcffbd,0xffb9ffbb,0xffb6ffb9,0xffb1ffb4,0xffa9ffad,0xff9affa3,0x0000708f,0x00000000,0x00000000,0x00000000,0xff82a482,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9bff96,0xffa4ffa0,0xffacffa8,0xffb1ffaf,0xffb0ffb1,
-0xffb0ffb0,0xffafffaf,0xffafffaf,0xffafffaf,0xffafffaf,0xffaeffae,0xffacffad,0xffabffab,0xffadffac,0xffabffad,0xffa5ffa8,0xff9fffa2,0xff98ff9b,0xff90ff93,0xff8bff8d,0xff8dff8a,0xff93ff90,0xff9aff97,0xffa0ff9d,0xffa6ffa3,0xffabffa9,0xffb0ffae,0xffb5ffb3,0xffb9ffb7,0xffbdffbc,0xffbeffbe,0xffbdffbe,0xffbcffbd,0xffb9ffb9,0xffb4ffb7,0xffadffb1,0xffa3ffa9,
-0xa290ff9b,0x00000000,0x00000000,0x00000000,0x00000000,0xff82b282,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9bff96,0xffa5ffa0,0xffabffa9,0xffacffac,0xffacffac,0xffadffac,0xffadffad,0xffaeffae,0xffaeffae,0xffaeffae,0xffaeffae,0xffb1ffaf,0xffb4ffb3,0xffb2ffb4,0xffaeffb0,0xffaaffac,0xffa5ffa8,0xffa0ffa3,0xff9bff9d,0xff97ff99,0xff99ff97,0xff9fff9c,
-0xffa4ffa2,0xffa9ffa7,0xffaeffac,0xffb2ffb0,0xffb7ffb5,0xffbbffb9,0xffbdffbc,0xffbdffbd,0xffbbffbc,0xffb8ffb9,0xffb3ffb6,0xffacffb0,0xffa2ffa8,0xc08fff9a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff825882,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8b,0xff9aff95,0xffa2ff9e,0xffaaffa6,0xffb1ffae,0xffb7ffb4,0xffbdffb9,0xffbeffbf,0xffb9ffbb,0xffb6ffb8,0xffb3ffb4,0xffafffb1,0xffacffae,0xffa8ffaa,0xffa3ffa6,0xff9dffa0,0xff93ff98,0xff87ff8e,0x2782db82,0x00000000,0x00000000,0x00000000,0xdd822d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,
-0xff8dff89,0xff95ff91,0xff9dff99,0xffa4ffa0,0xffaaffa7,0xffb0ffad,0xffb6ffb3,0xffb9ffb8,0xffbcffbb,0xffbeffbd,0xffbeffbe,0xffbeffbe,0xffbdffbe,0xffb9ffbc,0xffb6ffb8,0xffafffb3,0xffa4ffaa,0x5890ff9b,0x00000000,0x00000000,0xff828082,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9bff96,0xffa3ff9f,0xffabffa7,0xffb3ffaf,0xffb9ffb6,0xffb9ffb9,0xffb6ffb7,
-0xffb4ffb5,0xffb2ffb3,0xffb0ffb1,0xffaeffaf,0xffabffad,0xffa8ffaa,0xffa4ffa6,0xff9fffa2,0xff98ff9c,0xff8eff93,0xff82ff86,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8fff8b,0xff96ff92,0xff9dff9a,0xffa3ffa0,0xffa9ffa6,0xffafffac,0xffb4ffb2,0xffb9ffb7,0xffbcffbb,0xffbeffbd,0xffbfffbe,0xffbeffbf,0xffbdffbe,0xffb9ffbc,0xffb6ffb8,
-0xffafffb3,0xffa4ffaa,0x7c90ff9b,0x00000000,0x00000000,0x88820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff96ff91,0xff9fff9b,0xffa8ffa4,0xffafffac,0xffb5ffb3,0xffb5ffb6,0xffb3ffb4,0xffb2ffb2,0xffb1ffb1,0xffb0ffb0,0xffaeffaf,0xffadffae,0xffabffac,0xffa8ffa9,0xffa4ffa6,0xffa2ffa2,0xff9bffa0,0xff90ff96,0xff86ff8a,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff8aff86,0xff91ff8e,0xff98ff95,0xff9fff9c,0xffa5ffa2,0xffaaffa8,0xffb0ffad,0xffb5ffb2,0xffb9ffb7,0xffbdffbc,0xffbeffbe,0xffbeffbe,0xffbdffbe,0xffbbffbc,0xffb7ffb9,0xffb2ffb5,0xffaaffae,0xff9bffa4,0x00008c8f,0x00000000,0x00000000,0x00000000,0xff82ca82,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff9cff98,0xffa5ffa1,0xffadffa9,0xffafffaf,0xffaeffae,
-0xffaeffae,0xffaeffae,0xffaeffae,0xffaeffae,0xffaeffae,0xffadffad,0xffacffad,0xffaaffab,0xffaaffa9,0xffa8ffaa,0xffa2ffa5,0xff9bff9f,0xff93ff98,0xff8cff90,0xff88ff89,0xff8eff8a,0xff95ff92,0xff9bff98,0xffa1ff9e,0xffa6ffa4,0xffabffa9,0xffb0ffae,0xffb4ffb2,0xffb9ffb7,0xffbdffbb,0xffbeffbe,0xffbeffbe,0xffbcffbd,0xffb9ffbb,0xffb5ffb7,0xffaeffb2,0xffa4ffaa,
-0xd292ff9d,0x00000000,0x00000000,0x00000000,0x05820000,0xff82eb82,0xff82ff82,0xff82ff82,0xff88ff83,0xff93ff8d,0xff9dff98,0xffa6ffa1,0xffa9ffa8,0xffa9ffa9,0xffaaffa9,0xffabffaa,0xffacffab,0xffadffac,0xffadffad,0xffaeffae,0xffadffae,0xffafffae,0xffb1ffb0,0xffaeffb0,0xffabffac,0xffa7ffa9,0xffa2ffa5,0xff9dffa0,0xff97ff99,0xff93ff95,0xff9aff97,0xff9fff9d,
-0xffa5ffa2,0xffa9ffa7,0xffaeffac,0xffb2ffb0,0xffb6ffb4,0xffb9ffb8,0xffbdffbb,0xffbdffbd,0xffbbffbc,0xffb8ffb9,0xffb4ffb6,0xffadffb1,0xffa4ffa9,0xf191ff9c,0x00000787,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff826282,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9aff96,0xffa3ff9f,0xffabffa7,0xffb2ffae,0xffb8ffb5,0xffbdffbb,0xffbbffbd,0xffb7ffb9,0xffb4ffb6,0xffb1ffb3,0xffafffb0,0xffabffad,0xffa8ffaa,0xffa3ffa6,0xff9dffa0,0xff95ff99,0xff8bff91,0xf782ff84,0x05826282,0x00000000,0x62820582,0xff82f182,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff83,
-0xff8fff8b,0xff97ff93,0xff9eff9a,0xffa5ffa1,0xffabffa8,0xffb0ffae,0xffb6ffb3,0xffb9ffb8,0xffbdffbb,0xffbeffbe,0xffbfffbf,0xffbfffbf,0xffbeffbe,0xffbbffbc,0xffb6ffb9,0xffb0ffb3,0xffa5ffab,0x6691ff9c,0x00000000,0x00000000,0xff829682,0xff82ff82,0xff82ff82,0xff87ff83,0xff92ff8d,0xff9bff97,0xffa4ffa0,0xffacffa8,0xffb3ffb0,0xffb9ffb7,0xffb6ffb8,0xffb4ffb5,
-0xffb2ffb3,0xffb0ffb1,0xffafffb0,0xffadffae,0xffabffac,0xffa8ffaa,0xffa4ffa6,0xff9fffa2,0xff99ff9c,0xff8eff93,0xff82ff86,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff85,0xff90ff8d,0xff98ff93,0xff9eff9b,0xffa4ffa1,0xffaaffa7,0xffafffad,0xffb4ffb2,0xffb9ffb7,0xffbdffbb,0xffbfffbe,0xffbfffbf,0xffbfffbf,0xffbeffbe,0xffbbffbc,0xffb6ffb9,
-0xffb0ffb4,0xffa5ffab,0x8e91ff9d,0x00000000,0x00000000,0xac820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff88,0xff97ff92,0xffa0ff9c,0xffa9ffa5,0xffb0ffad,0xffb4ffb3,0xffb2ffb3,0xffb1ffb1,0xffb0ffb0,0xffafffb0,0xffafffaf,0xffaeffae,0xffacffad,0xffaaffab,0xffa7ffa9,0xffa4ffa6,0xffa0ffa1,0xff98ff9c,0xff8eff93,0xff84ff88,0xff82ff82,0xff82ff82,0xff84ff82,
-0xff8cff88,0xff93ff8f,0xff9aff96,0xffa0ff9d,0xffa6ffa3,0xffabffa8,0xffb0ffad,0xffb5ffb2,0xffb9ffb7,0xffbdffbc,0xffbfffbe,0xffbfffbf,0xffbeffbe,0xffbcffbd,0xffb8ffb9,0xffb3ffb6,0xffabffaf,0xff9dffa5,0x0000b092,0x00000000,0x00000000,0x0d820000,0xff82f782,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9dff98,0xffa6ffa2,0xffacffaa,0xffacffac,0xffacffac,
-0xffacffac,0xffacffac,0xffadffac,0xffadffad,0xffadffad,0xffacffad,0xffabffac,0xffa9ffaa,0xffa7ffa8,0xffa4ffa6,0xff9effa1,0xff98ff9b,0xff91ff95,0xff88ff8c,0xff88ff86,0xff8fff8b,0xff96ff93,0xff9cff99,0xffa2ff9f,0xffa7ffa4,0xffacffa9,0xffb0ffae,0xffb4ffb2,0xffb8ffb6,0xffbcffb9,0xffbfffbe,0xffbeffbf,0xffbdffbe,0xffb9ffbb,0xffb5ffb8,0xffafffb3,0xffa5ffab,
-0xf993ff9e,0x00000d88,0x00000000,0x00000000,0x30820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8f,0xff9eff99,0xffa5ffa2,0xffa6ffa6,0xffa7ffa6,0xffa8ffa7,0xffa9ffa9,0xffabffaa,0xffacffab,0xffacffac,0xffadffad,0xffadffad,0xffadffad,0xffaeffae,0xffabffac,0xffa7ffa9,0xffa4ffa5,0xff9fffa1,0xff99ff9c,0xff92ff95,0xff93ff92,0xff9aff97,0xffa0ff9d,
-0xffa5ffa3,0xffa9ffa7,0xffaeffac,0xffb1ffb0,0xffb5ffb3,0xffb8ffb7,0xffbcffb9,0xffbdffbd,0xffbcffbd,0xffb9ffbb,0xffb4ffb7,0xffaeffb1,0xffa4ffaa,0xff92ff9e,0x00003c88,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff827282,0xff82ff82,0xff82ff82,0xff87ff83,0xff92ff8d,0xff9bff96,0xffa4ff9f,0xffabffa8,0xffb3ffaf,0xffb9ffb6,0xffbcffbc,0xffb8ffb9,0xffb5ffb7,0xffb3ffb4,0xffb0ffb1,0xffaeffaf,0xffabffac,0xffa7ffa9,0xffa3ffa5,0xff9dffa0,0xff96ff9a,0xff8dff92,0xff82ff87,0xe982ff82,0xb282ac82,0xff82e582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,
-0xff91ff8e,0xff99ff95,0xff9fff9c,0xffa5ffa2,0xffabffa8,0xffb1ffae,0xffb6ffb3,0xffb9ffb8,0xffbdffbc,0xffbfffbe,0xffc0ffc0,0xffc0ffc0,0xffbeffbf,0xffbbffbd,0xffb7ffb9,0xffb1ffb4,0xffa6ffac,0x7292ff9d,0x00000000,0x00000000,0xff82a682,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff9cff97,0xffa5ffa1,0xffadffa9,0xffb4ffb1,0xffb7ffb7,0xffb4ffb5,0xffb2ffb3,
-0xffb0ffb1,0xffafffb0,0xffaeffae,0xffacffad,0xffaaffab,0xffa7ffa9,0xffa4ffa6,0xff9fffa2,0xff99ff9c,0xff8fff95,0xff82ff86,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff87,0xff92ff8e,0xff99ff96,0xff9fff9c,0xffa5ffa2,0xffaaffa8,0xffafffad,0xffb4ffb2,0xffb9ffb7,0xffbdffbb,0xffbfffbe,0xffc0ffc0,0xffc0ffc0,0xffbeffbf,0xffbbffbd,0xffb7ffb9,
-0xffb1ffb4,0xffa6ffac,0xa293ff9e,0x00000000,0x00000000,0xd8820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff88,0xff98ff93,0xffa1ff9d,0xffaaffa6,0xffb1ffad,0xffb1ffb2,0xffb0ffb0,0xffafffaf,0xffaeffaf,0xffaeffae,0xffadffae,0xffadffad,0xffabffac,0xffaaffab,0xffa7ffa8,0xffa3ffa5,0xff9effa1,0xff93ff99,0xff8bff90,0xff83ff86,0xff82ff82,0xff82ff82,0xff85ff82,
-0xff8dff89,0xff93ff91,0xff9bff97,0xffa1ff9e,0xffa6ffa3,0xffabffa9,0xffb0ffae,0xffb4ffb2,0xffb9ffb7,0xffbdffbb,0xffbfffbe,0xffbfffbf,0xffbeffbf,0xffbcffbd,0xffb9ffbb,0xffb3ffb6,0xffacffb0,0xff9effa6,0x0000de93,0x00000000,0x00000000,0x3a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff84,0xff93ff8f,0xff9eff99,0xffa7ffa3,0xffaaffaa,0xffa9ffaa,0xffaaffa9,
-0xffaaffaa,0xffabffab,0xffabffab,0xffacffac,0xffacffac,0xffabffac,0xffaaffab,0xffa9ffaa,0xffa6ffa8,0xffa0ffa3,0xff9aff9d,0xff93ff97,0xff8dff91,0xff85ff88,0xff89ff86,0xff90ff8d,0xff97ff93,0xff9dff9a,0xffa2ffa0,0xffa7ffa5,0xffacffa9,0xffb0ffae,0xffb4ffb2,0xffb7ffb6,0xffbbffb9,0xffbeffbd,0xffbeffbf,0xffbdffbe,0xffb9ffbc,0xffb6ffb8,0xffafffb3,0xffa6ffab,
-0xff93ff9f,0x00003c8a,0x00000000,0x00000000,0x82820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff84,0xff95ff90,0xff9fff9a,0xffa3ffa2,0xffa4ffa3,0xffa5ffa4,0xffa6ffa6,0xffa8ffa7,0xffa9ffa9,0xffabffaa,0xffacffab,0xffacffac,0xffacffac,0xffabffac,0xffaaffab,0xffa7ffa9,0xffa4ffa6,0xffa0ffa2,0xff9bff9e,0xff95ff98,0xff8fff91,0xff95ff92,0xff9bff98,0xffa0ff9e,
-0xffa5ffa3,0xffa9ffa7,0xffadffac,0xffb1ffaf,0xffb4ffb3,0xffb8ffb6,0xffb9ffb9,0xffbdffbc,0xffbcffbd,0xffb9ffbb,0xffb5ffb7,0xffaeffb2,0xffa5ffaa,0xff95ff9e,0x0000748b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff827e82,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff9cff97,0xffa4ffa0,0xffacffa8,0xffb3ffb0,0xffb9ffb7,0xffb9ffbb,0xffb6ffb8,0xffb3ffb5,0xffb1ffb2,0xffafffb0,0xffadffae,0xffaaffab,0xffa7ffa8,0xffa2ffa5,0xff9dffa0,0xff96ff9a,0xff8dff92,0xff83ff88,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8cff88,
-0xff93ff90,0xff9aff97,0xffa0ff9d,0xffa6ffa3,0xffacffa9,0xffb1ffaf,0xffb6ffb4,0xffbbffb9,0xffbeffbc,0xffc0ffbf,0xffc0ffc0,0xffc0ffc0,0xffbfffc0,0xffbcffbe,0xffb8ffb9,0xffb1ffb5,0xffa7ffad,0x8093ff9e,0x00000000,0x00000000,0xff82c282,0xff82ff82,0xff82ff82,0xff88ff84,0xff93ff8e,0xff9dff98,0xffa5ffa1,0xffadffaa,0xffb4ffb1,0xffb4ffb5,0xffb1ffb2,0xffb0ffb1,
-0xffafffaf,0xffaeffae,0xffadffad,0xffabffac,0xffa9ffaa,0xffa6ffa8,0xffa3ffa5,0xff9effa1,0xff98ff9b,0xff8eff93,0xff82ff86,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8cff89,0xff93ff90,0xff9aff97,0xffa0ff9d,0xffa6ffa3,0xffabffa8,0xffb0ffad,0xffb4ffb2,0xffb9ffb7,0xffbdffbb,0xffbfffbe,0xffc0ffc0,0xffc0ffc0,0xffbeffbf,0xffbcffbd,0xffb7ffb9,
-0xffb1ffb5,0xffa7ffac,0xc293ff9f,0x00000000,0x00000000,0xf7820782,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff89,0xff99ff93,0xffa2ff9d,0xffaaffa6,0xffb0ffae,0xffafffb0,0xffaeffae,0xffadffad,0xffadffad,0xffadffad,0xffacffac,0xffacffac,0xffabffab,0xffa9ffaa,0xffa6ffa8,0xffa3ffa4,0xff9dffa0,0xff91ff97,0xff88ff8c,0xff82ff84,0xff82ff82,0xff82ff82,0xff87ff83,
-0xff8eff8b,0xff95ff92,0xff9cff98,0xffa1ff9f,0xffa7ffa4,0xffabffa9,0xffb0ffae,0xffb4ffb2,0xffb8ffb6,0xffbcffb9,0xffbfffbe,0xffbfffbf,0xffbfffbf,0xffbdffbe,0xffb9ffbb,0xffb4ffb7,0xffacffb0,0xff9fffa7,0x0789f993,0x00000000,0x00000000,0x80820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff95ff90,0xff9fff9a,0xffa7ffa3,0xffa7ffa8,0xffa7ffa7,0xffa8ffa7,
-0xffa9ffa8,0xffa9ffa9,0xffaaffaa,0xffabffaa,0xffabffab,0xffaaffab,0xffa9ffaa,0xffa8ffa9,0xffa4ffa7,0xff9cffa0,0xff96ff99,0xff90ff93,0xff88ff8c,0xff85ff86,0xff8aff87,0xff91ff8e,0xff98ff93,0xff9dff9a,0xffa2ffa0,0xffa7ffa5,0xffacffaa,0xffb0ffae,0xffb3ffb2,0xffb7ffb5,0xffb9ffb8,0xffbdffbc,0xffbeffbe,0xffbdffbe,0xffb9ffbb,0xffb6ffb8,0xffafffb3,0xffa6ffab,
-0xff96ffa0,0x0000788b,0x00000000,0x00000000,0xc8820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff85,0xff95ff90,0xff9eff9a,0xffa1ffa0,0xffa2ffa1,0xffa3ffa2,0xffa5ffa4,0xffa7ffa6,0xffa8ffa7,0xffa9ffa9,0xffaaffaa,0xffabffab,0xffabffab,0xffaaffab,0xffa7ffaa,0xffa3ffa5,0xffa0ffa2,0xff9cff9e,0xff97ff9a,0xff90ff93,0xff8fff8f,0xff96ff92,0xff9bff98,0xffa0ff9e,
-0xffa5ffa3,0xffa9ffa7,0xffadffab,0xffb1ffaf,0xffb4ffb2,0xffb7ffb5,0xffb9ffb8,0xffbcffb9,0xffbcffbc,0xffb9ffb9,0xffb4ffb7,0xffaeffb1,0xffa5ffaa,0xff96ff9f,0x0000c68b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff829482,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff9cff97,0xffa5ffa1,0xffadffa9,0xffb4ffb0,0xffb9ffb7,0xffb7ffb9,0xffb4ffb5,0xffb2ffb3,0xffb0ffb1,0xffaeffae,0xffabffac,0xffa9ffaa,0xffa5ffa7,0xffa1ffa4,0xff9cff9f,0xff95ff99,0xff8dff91,0xff83ff88,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8eff8a,
-0xff95ff91,0xff9bff98,0xffa1ff9e,0xffa7ffa4,0xffadffaa,0xffb2ffaf,0xffb6ffb4,0xffbbffb9,0xffbeffbd,0xffc0ffbf,0xffc1ffc0,0xffc0ffc1,0xffbfffc0,0xffbcffbe,0xffb8ffb9,0xffb1ffb5,0xffa7ffad,0x9493ff9e,0x00000000,0x00000000,0xff82e282,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9dff98,0xffa6ffa2,0xffaeffaa,0xffb3ffb2,0xffb1ffb3,0xffafffb0,0xffaeffaf,
-0xffadffae,0xffacffad,0xffabffac,0xffaaffab,0xffa8ffa9,0xffa5ffa7,0xffa2ffa4,0xff9dff9f,0xff97ff9a,0xff8dff93,0xff82ff85,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8eff8a,0xff95ff91,0xff9bff98,0xffa1ff9e,0xffa6ffa4,0xffabffa9,0xffb0ffae,0xffb4ffb2,0xffb8ffb6,0xffbdffb9,0xffbfffbe,0xffc0ffc0,0xffc0ffc0,0xffbfffbf,0xffbcffbd,0xffb8ffb9,
-0xffb1ffb5,0xffa7ffad,0xe093ff9f,0x00000000,0x00000000,0xff821e82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff89,0xff99ff93,0xffa2ff9e,0xffabffa7,0xffaeffad,0xffacffad,0xffacffac,0xffabffab,0xffabffab,0xffabffab,0xffabffab,0xffaaffab,0xffa9ffaa,0xffa8ffa9,0xffa5ffa6,0xffa1ffa3,0xff9bff9f,0xff8fff96,0xff84ff89,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff85,
-0xff90ff8c,0xff96ff93,0xff9cff99,0xffa2ff9f,0xffa7ffa4,0xffacffa9,0xffb0ffae,0xffb4ffb2,0xffb8ffb6,0xffbcffb9,0xffbfffbd,0xffbfffbf,0xffbfffbf,0xffbcffbe,0xffb9ffbb,0xffb4ffb7,0xffacffb0,0xffa0ffa7,0x228cff93,0x00000000,0x00000000,0xba820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff85,0xff95ff90,0xff9fff9a,0xffa5ffa3,0xffa5ffa5,0xffa5ffa5,0xffa6ffa5,
-0xffa7ffa6,0xffa8ffa8,0xffa9ffa8,0xffa9ffa9,0xffa9ffa9,0xffa9ffa9,0xffa8ffa9,0xffa6ffa7,0xffa3ffa5,0xff9aff9f,0xff91ff95,0xff8aff8d,0xff86ff87,0xff87ff86,0xff8bff88,0xff92ff8e,0xff98ff95,0xff9eff9b,0xffa3ffa0,0xffa7ffa5,0xffabffa9,0xffafffad,0xffb3ffb1,0xffb6ffb4,0xffb9ffb7,0xffbcffb9,0xffbdffbd,0xffbcffbd,0xffb9ffbb,0xffb5ffb7,0xffafffb2,0xffa6ffab,
-0xff97ff9f,0x0000b48b,0x00000000,0x00000000,0xfd822182,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff85,0xff96ff91,0xff9dff9a,0xff9eff9d,0xffa0ff9f,0xffa1ffa0,0xffa3ffa2,0xffa5ffa4,0xffa7ffa6,0xffa8ffa8,0xffa9ffa9,0xffaaffaa,0xffaaffaa,0xffa9ffaa,0xffa5ffa8,0xff9fffa2,0xff9bff9d,0xff97ff99,0xff92ff93,0xff8fff8f,0xff90ff8f,0xff96ff93,0xff9bff99,0xffa0ff9e,
-0xffa5ffa3,0xffa9ffa7,0xffadffab,0xffb0ffae,0xffb3ffb2,0xffb5ffb4,0xffb8ffb7,0xffb9ffb9,0xffbbffbb,0xffb8ffb9,0xffb3ffb6,0xffadffb1,0xffa4ffa9,0xff97ff9e,0x2182fd8c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff829882,0xff82ff82,0xff82ff82,0xff88ff84,0xff93ff8e,0xff9cff97,0xffa5ffa1,0xffadffa9,0xffb4ffb1,0xffb8ffb7,0xffb4ffb6,0xffb2ffb3,0xffb0ffb1,0xffaeffaf,0xffacffad,0xffaaffab,0xffa7ffa9,0xffa4ffa6,0xffa0ffa2,0xff9aff9d,0xff93ff97,0xff8bff8f,0xff83ff86,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff8fff8b,
-0xff96ff93,0xff9cff99,0xffa2ff9f,0xffa8ffa5,0xffadffab,0xffb2ffb0,0xffb6ffb4,0xffbbffb9,0xffbeffbd,0xffc0ffbf,0xffc1ffc1,0xffc1ffc1,0xffbfffc0,0xffbdffbe,0xffb8ffbb,0xffb2ffb5,0xffa7ffad,0xa693ff9f,0x00000000,0x07820000,0xff82f982,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9dff99,0xffa6ffa2,0xffaeffaa,0xffb1ffb1,0xffafffb0,0xffadffae,0xffacffad,
-0xffabffac,0xffabffab,0xffaaffaa,0xffa8ffa9,0xffa6ffa7,0xffa3ffa5,0xffa0ffa2,0xff9bff9d,0xff93ff98,0xff8bff90,0xff82ff86,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff8fff8b,0xff95ff92,0xff9cff99,0xffa1ff9e,0xffa7ffa4,0xffabffa9,0xffb0ffae,0xffb4ffb2,0xffb8ffb6,0xffbcffb9,0xffbfffbe,0xffc0ffc0,0xffc0ffc0,0xffbeffbf,0xffbcffbd,0xffb7ffb9,
-0xffb1ffb4,0xffa7ffac,0xf795ffa0,0x0000038a,0x00000000,0xff825882,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff8a,0xff99ff93,0xffa3ff9e,0xffabffa7,0xffabffac,0xffaaffaa,0xffaaffaa,0xffaaffaa,0xffaaffaa,0xffaaffaa,0xffaaffaa,0xffa9ffa9,0xffa8ffa8,0xffa6ffa7,0xffa3ffa5,0xffa0ffa2,0xff99ff9d,0xff8dff93,0xff82ff87,0xff82ff82,0xff82ff82,0xff83ff82,0xff89ff86,
-0xff90ff8d,0xff97ff93,0xff9dff9a,0xffa2ffa0,0xffa7ffa5,0xffacffa9,0xffb0ffae,0xffb4ffb2,0xffb7ffb5,0xffbbffb9,0xffbeffbc,0xffbfffbf,0xffbeffbf,0xffbcffbd,0xffb9ffbb,0xffb3ffb6,0xffacffb0,0xffa0ffa7,0x588bff96,0x00000000,0x00000000,0xf9820f82,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff95ff90,0xff9fff9a,0xffa2ffa2,0xffa2ffa2,0xffa3ffa3,0xffa4ffa3,
-0xffa5ffa5,0xffa6ffa6,0xffa7ffa7,0xffa8ffa8,0xffa8ffa8,0xffa7ffa8,0xffa6ffa7,0xffa4ffa5,0xffa1ffa3,0xff98ff9d,0xff8dff93,0xff87ff8a,0xff87ff86,0xff88ff88,0xff8bff89,0xff92ff8f,0xff98ff95,0xff9dff9b,0xffa2ffa0,0xffa7ffa5,0xffabffa9,0xffafffad,0xffb2ffb0,0xffb5ffb4,0xffb8ffb6,0xffb9ffb9,0xffbcffbb,0xffbbffbc,0xffb8ffb9,0xffb4ffb6,0xffadffb1,0xffa4ffa9,
-0xff97ff9f,0x0f82f38c,0x00000000,0x00000000,0xff828c82,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff96ff91,0xff9aff99,0xff9cff9b,0xff9eff9d,0xffa0ff9f,0xffa2ffa1,0xffa4ffa3,0xffa5ffa5,0xffa7ffa6,0xffa8ffa7,0xffa8ffa8,0xffa8ffa8,0xffa8ffa8,0xffa4ffa6,0xff9cffa0,0xff96ff99,0xff91ff93,0xff8eff8f,0xff8fff8e,0xff90ff8f,0xff96ff93,0xff9bff99,0xffa0ff9e,
-0xffa5ffa2,0xffa9ffa7,0xffacffab,0xffafffae,0xffb2ffb1,0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffb9ffb8,0xffb6ffb8,0xffb2ffb4,0xffabffaf,0xffa3ffa7,0xff96ff9d,0x8284ff8d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff82b082,0xff82ff82,0xff82ff82,0xff88ff83,0xff93ff8d,0xff9cff98,0xffa5ffa1,0xffadffa9,0xffb4ffb1,0xffb5ffb6,0xffb2ffb3,0xffb0ffb1,0xffaeffaf,0xffacffad,0xffaaffab,0xffa8ffa9,0xffa6ffa7,0xffa2ffa4,0xff9effa0,0xff98ff9b,0xff91ff95,0xff8bff8e,0xff87ff88,0xff83ff85,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff89ff85,0xff90ff8d,
-0xff97ff93,0xff9dff9a,0xffa3ffa0,0xffa8ffa6,0xffadffab,0xffb2ffb0,0xffb6ffb4,0xffb9ffb8,0xffbeffbc,0xffc0ffbf,0xffc1ffc0,0xffc0ffc1,0xffbfffc0,0xffbcffbe,0xffb8ffb9,0xffb2ffb5,0xffa7ffad,0xb293ff9f,0x00000000,0x2c820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9dff98,0xffa6ffa2,0xffaeffaa,0xffaeffaf,0xffacffad,0xffabffab,0xffaaffaa,
-0xffaaffaa,0xffa9ffa9,0xffa8ffa8,0xffa6ffa7,0xffa4ffa5,0xffa1ffa3,0xff9dff9f,0xff98ff9a,0xff93ff95,0xff8dff90,0xff87ff8a,0xff83ff84,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff85,0xff8fff8c,0xff96ff92,0xff9cff99,0xffa1ff9f,0xffa7ffa4,0xffabffa9,0xffb0ffae,0xffb4ffb2,0xffb7ffb6,0xffbbffb9,0xffbeffbc,0xffbfffbf,0xffbfffbf,0xffbeffbe,0xffbbffbc,0xffb6ffb9,
-0xffb0ffb4,0xffa6ffac,0xff93ff9f,0x00003089,0x00000000,0xff829482,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff8a,0xff99ff93,0xffa3ff9e,0xffa9ffa7,0xffa8ffa9,0xffa7ffa8,0xffa8ffa7,0xffa8ffa8,0xffa8ffa8,0xffa8ffa8,0xffa8ffa8,0xffa7ffa8,0xffa6ffa7,0xffa4ffa5,0xffa1ffa3,0xff9dff9f,0xff97ff9a,0xff8cff91,0xff85ff88,0xff83ff84,0xff82ff82,0xff83ff82,0xff8aff87,
-0xff91ff8d,0xff97ff93,0xff9dff9a,0xffa2ffa0,0xffa7ffa5,0xffabffa9,0xffafffad,0xffb3ffb1,0xffb6ffb5,0xffb9ffb8,0xffbcffbb,0xffbeffbe,0xffbdffbe,0xffbbffbc,0xffb8ffb9,0xffb2ffb5,0xffabffaf,0xff9fffa6,0x948bff96,0x00000000,0x00000000,0xff826882,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff84,0xff95ff8f,0xff9eff9a,0xff9fff9f,0xffa0ff9f,0xffa1ffa0,0xffa2ffa1,
-0xffa3ffa3,0xffa4ffa4,0xffa5ffa5,0xffa6ffa6,0xffa6ffa6,0xffa5ffa6,0xffa4ffa5,0xffa2ffa3,0xff9effa0,0xff95ff9a,0xff8eff92,0xff8bff8c,0xff89ff8a,0xff88ff88,0xff8bff89,0xff92ff8f,0xff98ff95,0xff9dff9a,0xffa2ffa0,0xffa6ffa4,0xffaaffa8,0xffaeffac,0xffb1ffaf,0xffb4ffb2,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb6ffb8,0xffb2ffb4,0xffabffaf,0xffa3ffa7,
-0xff96ff9d,0x6683ff8c,0x00000000,0x11820000,0xff82ed82,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff85,0xff95ff91,0xff97ff97,0xff99ff98,0xff9bff9a,0xff9eff9c,0xffa0ff9f,0xffa2ffa1,0xffa4ffa3,0xffa5ffa4,0xffa6ffa6,0xffa6ffa6,0xffa6ffa6,0xffa5ffa6,0xffa1ffa4,0xff9aff9e,0xff93ff96,0xff8eff90,0xff8eff8e,0xff8fff8f,0xff90ff8f,0xff95ff93,0xff9bff98,0xffa0ff9d,
-0xffa4ffa2,0xffa8ffa6,0xffabffa9,0xffaeffad,0xffb0ffaf,0xffb3ffb2,0xffb4ffb3,0xffb5ffb5,0xffb6ffb5,0xffb4ffb5,0xffafffb2,0xffa9ffac,0xffa0ffa5,0xff95ff9b,0xf184ff8e,0x00001582,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff82d482,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff9cff97,0xffa5ffa1,0xffadffa9,0xffb4ffb1,0xffb2ffb4,0xffafffb1,0xffadffae,0xffacffac,0xffaaffab,0xffa8ffa9,0xffa6ffa7,0xffa3ffa5,0xffa0ffa2,0xff9bff9e,0xff95ff98,0xff91ff93,0xff8fff90,0xff8dff8e,0xff87ff8b,0xff82ff84,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff8aff87,0xff91ff8d,
-0xff97ff93,0xff9eff9a,0xffa3ffa0,0xffa8ffa6,0xffadffab,0xffb2ffb0,0xffb6ffb4,0xffb9ffb8,0xffbdffbb,0xffbfffbe,0xffc0ffc0,0xffc0ffc0,0xffbeffbf,0xffbcffbd,0xffb7ffb9,0xffb1ffb4,0xffa6ffac,0xc693ff9e,0x00000000,0x5c820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff83,0xff93ff8d,0xff9cff98,0xffa5ffa1,0xffadffaa,0xffabffad,0xffa9ffaa,0xffa8ffa9,0xffa8ffa8,
-0xffa7ffa8,0xffa6ffa7,0xffa5ffa6,0xffa4ffa5,0xffa1ffa3,0xff9effa0,0xff9aff9c,0xff97ff99,0xff95ff96,0xff93ff95,0xff8dff90,0xff87ff8a,0xff83ff85,0xff83ff82,0xff85ff84,0xff8aff87,0xff8fff8c,0xff96ff92,0xff9cff99,0xffa1ff9e,0xffa6ffa4,0xffabffa9,0xffafffad,0xffb3ffb1,0xffb6ffb5,0xffb9ffb8,0xffbdffbb,0xffbeffbe,0xffbeffbe,0xffbcffbd,0xffb9ffbb,0xffb5ffb7,
-0xffaeffb2,0xffa5ffaa,0xff93ff9e,0x00005a8a,0x00000000,0xff82dc82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff89,0xff99ff93,0xffa2ff9e,0xffa7ffa6,0xffa5ffa6,0xffa5ffa5,0xffa5ffa5,0xffa6ffa5,0xffa6ffa6,0xffa6ffa6,0xffa6ffa6,0xffa5ffa5,0xffa4ffa4,0xffa1ffa2,0xff9effa0,0xff9aff9c,0xff96ff99,0xff90ff93,0xff8bff8d,0xff87ff89,0xff84ff85,0xff84ff83,0xff8aff87,
-0xff91ff8d,0xff97ff93,0xff9dff9a,0xffa2ff9f,0xffa6ffa4,0xffabffa9,0xffafffad,0xffb2ffb0,0xffb5ffb4,0xffb8ffb7,0xffbbffb9,0xffbdffbc,0xffbcffbc,0xffb9ffbb,0xffb6ffb8,0xffb0ffb3,0xffa9ffad,0xff9effa4,0xdc8aff96,0x00000000,0x01820000,0xff82d582,0xff82ff82,0xff82ff82,0xff82ff82,0xff8cff84,0xff93ff92,0xff9cff99,0xff9cff9c,0xff9dff9c,0xff9eff9e,0xffa0ff9f,
-0xffa1ffa0,0xffa2ffa2,0xffa3ffa3,0xffa3ffa3,0xffa3ffa3,0xffa2ffa3,0xffa1ffa2,0xff9fffa0,0xff9dff9e,0xff97ff9a,0xff93ff95,0xff90ff92,0xff8dff8f,0xff8aff8b,0xff8cff8a,0xff91ff8e,0xff97ff93,0xff9cff99,0xffa1ff9e,0xffa5ffa3,0xffa9ffa7,0xffacffab,0xffafffae,0xffb2ffb1,0xffb4ffb3,0xffb6ffb5,0xffb7ffb6,0xffb6ffb7,0xffaeffb5,0xffaeffac,0xffa8ffab,0xffa0ffa4,
-0xff96ff9c,0xd186ff8f,0x00000382,0x86820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff91ff89,0xff95ff93,0xff95ff93,0xff97ff96,0xff99ff98,0xff9bff9a,0xff9eff9d,0xffa0ff9f,0xffa1ffa1,0xffa3ffa2,0xffa4ffa3,0xffa4ffa4,0xffa3ffa4,0xffa2ffa3,0xff9effa1,0xff99ff9b,0xff93ff96,0xff92ff93,0xff90ff91,0xff8fff90,0xff8fff8f,0xff95ff92,0xff9aff97,0xff9eff9c,
-0xffa3ffa1,0xffa6ffa5,0xffaaffa8,0xffacffab,0xffafffae,0xffb0ffb0,0xffb2ffb1,0xffb2ffb2,0xffb2ffb2,0xffa7ffad,0xffa8ffa6,0xffa6ffa9,0xffa0ffa4,0xff98ff9c,0xff8bff93,0x00008684,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff82e882,0xff82ff82,0xff82ff82,0xff87ff83,0xff92ff8d,0xff9bff96,0xffa4ffa0,0xffacffa8,0xffb2ffb0,0xffafffb1,0xffadffae,0xffabffac,0xffa9ffaa,0xffa8ffa9,0xffa6ffa7,0xffa3ffa5,0xffa0ffa2,0xff9cff9e,0xff99ff9a,0xff96ff97,0xff95ff96,0xff95ff95,0xff93ff93,0xff8eff91,0xff86ff89,0xff82ff83,0xff83ff82,0xff85ff84,0xff88ff87,0xff8cff8a,0xff91ff8e,
-0xff97ff93,0xff9dff9a,0xffa3ffa0,0xffa8ffa5,0xffadffab,0xffb1ffaf,0xffb5ffb3,0xffb9ffb7,0xffbcffbb,0xffbeffbd,0xffbfffbf,0xffbfffbf,0xffbdffbe,0xffbbffbc,0xffb6ffb9,0xffb0ffb3,0xffa6ffab,0xec92ff9e,0x00000000,0x94820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff83,0xff92ff8c,0xff9bff97,0xffa4ffa0,0xffaaffa9,0xffa8ffa9,0xffa7ffa7,0xffa6ffa6,0xffa5ffa6,
-0xffa5ffa5,0xffa4ffa4,0xffa3ffa3,0xffa1ffa2,0xff9eff9f,0xff9dff9e,0xff9bff9c,0xff9bff9b,0xff9bff9b,0xff99ff9a,0xff93ff96,0xff8dff90,0xff88ff8a,0xff87ff86,0xff8aff88,0xff8dff8c,0xff91ff8f,0xff96ff93,0xff9bff98,0xffa0ff9e,0xffa5ffa3,0xffaaffa8,0xffaeffac,0xffb2ffb0,0xffb5ffb3,0xffb8ffb7,0xffbbffb9,0xffbcffbc,0xffbcffbc,0xffb9ffbb,0xffb7ffb9,0xffb3ffb5,
-0xffacffb0,0xffa3ffa8,0xff93ff9c,0x00009489,0x2f820000,0xff82fd82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8eff88,0xff98ff93,0xffa1ff9d,0xffa3ffa4,0xffa2ffa3,0xffa2ffa2,0xffa3ffa3,0xffa3ffa3,0xffa3ffa3,0xffa4ffa4,0xffa3ffa3,0xffa2ffa3,0xffa0ffa1,0xff9eff9f,0xff9dff9e,0xff9bff9c,0xff9aff9b,0xff96ff98,0xff91ff93,0xff8dff8f,0xff88ff8a,0xff88ff87,0xff8cff8a,
-0xff91ff8f,0xff96ff93,0xff9cff99,0xffa1ff9e,0xffa5ffa3,0xffaaffa8,0xffadffac,0xffb1ffaf,0xffb4ffb2,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb7ffb8,0xffb3ffb5,0xffaeffb1,0xffa6ffaa,0xff9cffa1,0xff8aff95,0x00003182,0x4a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff93ff88,0xff92ff93,0xff99ff97,0xff99ff99,0xff9aff99,0xff9bff9b,0xff9dff9c,
-0xff9eff9e,0xff9fff9f,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa1ffa1,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xff9cff9e,0xff99ff9a,0xff96ff97,0xff92ff93,0xff8eff90,0xff8fff8e,0xff93ff91,0xff97ff95,0xff9cff99,0xff9fff9d,0xffa3ffa1,0xffa7ffa5,0xffaaffa9,0xffadffac,0xffb0ffaf,0xffb1ffb0,0xffb2ffb2,0xffb3ffb3,0xffb2ffb3,0xffa7ffb1,0xffa9ffa1,0xffa8ffaa,0xffa2ffa5,
-0xff9bff9f,0xff8cff95,0x00004684,0xe7820582,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff82,0xff98ff93,0xff95ff98,0xff92ff91,0xff93ff93,0xff96ff95,0xff99ff98,0xff9bff9a,0xff9dff9c,0xff9fff9e,0xffa0ff9f,0xffa1ffa0,0xffa1ffa1,0xffa2ffa2,0xffa1ffa2,0xff9fffa1,0xff9bff9d,0xff99ff9a,0xff97ff98,0xff93ff95,0xff92ff93,0xff90ff90,0xff95ff92,0xff99ff97,0xff9dff9b,
-0xffa1ff9f,0xffa4ffa3,0xffa7ffa6,0xffaaffa9,0xffacffab,0xffaeffad,0xffaeffae,0xffaeffaf,0xffaeffae,0xff9dffa6,0xffa0ff9d,0xffa9ffa6,0xffa5ffa7,0xff9fffa2,0xff93ff9a,0x0582e989,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x17820000,0xff82fd82,0xff82ff82,0xff82ff82,0xff86ff82,0xff91ff8b,0xff9aff95,0xffa3ff9f,0xffabffa7,0xffb0ffaf,0xffacffae,0xffaaffab,0xffa8ffa9,0xffa7ffa7,0xffa5ffa6,0xffa3ffa4,0xffa0ffa2,0xff9dff9e,0xff9cff9c,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9aff9a,0xff99ff99,0xff93ff97,0xff8cff90,0xff86ff88,0xff88ff86,0xff8bff89,0xff8eff8c,0xff91ff8f,0xff93ff92,
-0xff98ff96,0xff9cff9a,0xffa2ff9f,0xffa7ffa5,0xffacffaa,0xffb0ffae,0xffb4ffb2,0xffb7ffb6,0xffb9ffb9,0xffbcffbc,0xffbdffbd,0xffbdffbd,0xffbbffbc,0xffb9ffb9,0xffb4ffb7,0xffaeffb1,0xffa4ffa9,0xff92ff9d,0x00001d85,0xe7820382,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff90ff8b,0xff9aff95,0xffa3ff9e,0xffa7ffa6,0xffa5ffa6,0xffa3ffa4,0xffa3ffa3,0xffa2ffa3,
-0xffa2ffa2,0xffa1ffa1,0xffa0ffa0,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xff9eff9f,0xff99ff9c,0xff93ff96,0xff8dff90,0xff8cff8b,0xff90ff8e,0xff93ff91,0xff96ff93,0xff99ff97,0xff9cff9a,0xffa0ff9e,0xffa4ffa2,0xffa8ffa6,0xffacffaa,0xffb0ffae,0xffb3ffb1,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffb8ffb9,0xffb7ffb8,0xffb3ffb5,0xffafffb1,
-0xffa9ffac,0xffa1ffa5,0xff93ff9b,0x0582e989,0x96820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff82,0xff8cff8c,0xff96ff91,0xff9fff9b,0xffa0ffa0,0xff9fff9f,0xff9fff9f,0xffa0ffa0,0xffa0ffa0,0xffa1ffa1,0xffa0ffa1,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xff9fff9f,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xff9bff9e,0xff96ff99,0xff92ff93,0xff8dff90,0xff8dff8c,0xff91ff8f,
-0xff95ff93,0xff98ff96,0xff9cff9a,0xffa0ff9e,0xffa4ffa2,0xffa8ffa6,0xffacffaa,0xffafffad,0xffb2ffb0,0xffb4ffb3,0xffb5ffb5,0xffb7ffb6,0xffb6ffb6,0xffb3ffb4,0xffabffb1,0xffabffaa,0xffa5ffa9,0xff9dffa1,0xff8fff97,0x00009286,0x96820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff82,0xff99ff93,0xff95ff96,0xff97ff97,0xff97ff97,0xff98ff97,0xff99ff99,0xff9bff9a,
-0xff9dff9c,0xff9eff9d,0xff9fff9f,0xffa0ffa0,0xffa1ffa1,0xffa3ffa2,0xffa4ffa3,0xffa4ffa4,0xffa5ffa5,0xffa1ffa3,0xff9eff9f,0xff9bff9c,0xff97ff99,0xff93ff95,0xff93ff93,0xff98ff96,0xff9bff99,0xff9eff9c,0xffa1ffa0,0xffa4ffa2,0xffa7ffa6,0xffaaffa8,0xffacffab,0xffaeffad,0xffafffaf,0xffb0ffb0,0xffb1ffb1,0xffb1ffb1,0xffa2ffab,0xffa1ff9d,0xffadffa9,0xffa8ffab,
-0xffa1ffa5,0xff93ff9c,0x0000988a,0xff824282,0xff82ff82,0xff82ff82,0xff82ff82,0xff93ff87,0xff98ff98,0xff96ff99,0xff92ff93,0xff93ff93,0xff96ff93,0xff98ff97,0xff9aff99,0xff9cff9b,0xff9eff9d,0xff9fff9f,0xffa1ffa0,0xffa2ffa1,0xffa3ffa3,0xffa4ffa4,0xffa3ffa4,0xffa0ffa2,0xff9eff9f,0xff9bff9c,0xff99ff9a,0xff96ff98,0xff93ff95,0xff98ff96,0xff9bff99,0xff9eff9d,
-0xffa1ffa0,0xffa5ffa3,0xffa7ffa6,0xffaaffa9,0xffabffab,0xffadffac,0xffaeffad,0xffaeffae,0xffaaffaf,0xff9dffa1,0xff9dff9d,0xffa9ffa1,0xffabffad,0xffa5ffa8,0xff9affa0,0x4087ff90,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x48820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff8a,0xff99ff93,0xffa1ff9d,0xffaaffa6,0xffacffac,0xffa9ffaa,0xffa7ffa7,0xffa5ffa6,0xffa3ffa4,0xffa1ffa2,0xff9fffa0,0xff9fff9f,0xff9eff9e,0xff9fff9e,0xff9fff9f,0xffa0ff9f,0xffa0ffa0,0xff9fff9f,0xff9eff9f,0xff9aff9d,0xff92ff96,0xff8cff8e,0xff8eff8c,0xff90ff8f,0xff93ff92,0xff96ff95,0xff99ff97,
-0xff9bff9a,0xff9eff9c,0xffa2ffa0,0xffa6ffa4,0xffaaffa8,0xffafffad,0xffb2ffb1,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffb9ffbb,0xffb9ffb9,0xffb5ffb7,0xffb1ffb3,0xffabffae,0xffa1ffa6,0xff90ff9a,0x00004887,0xff824282,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff87,0xff8fff8a,0xff98ff93,0xffa0ff9c,0xffa3ffa3,0xffa1ffa1,0xffa0ffa0,0xff9fff9f,0xff9fff9f,
-0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa2ffa1,0xffa3ffa2,0xffa4ffa3,0xffa4ffa4,0xffa5ffa4,0xffa4ffa5,0xffa3ffa4,0xff9effa1,0xff98ff9c,0xff92ff95,0xff92ff91,0xff95ff93,0xff98ff96,0xff9bff9a,0xff9eff9d,0xffa0ff9f,0xffa3ffa2,0xffa5ffa4,0xffa8ffa7,0xffabffaa,0xffaeffac,0xffb0ffaf,0xffb3ffb2,0xffb4ffb4,0xffb5ffb5,0xffb5ffb5,0xffb4ffb4,0xffb2ffb3,0xffaaffac,
-0xffa9ffac,0xffa3ffa6,0xff98ff9e,0x4286ff8e,0xe5820182,0xff82ff82,0xff82ff82,0xff82ff82,0xff93ff87,0xff90ff93,0xff96ff91,0xff9dff9a,0xff9cff9d,0xff9cff9c,0xff9cff9c,0xff9dff9d,0xff9eff9d,0xff9fff9e,0xffa0ff9f,0xffa0ffa0,0xffa2ffa1,0xffa3ffa2,0xffa4ffa3,0xffa4ffa4,0xffa5ffa5,0xffa4ffa5,0xffa0ffa3,0xff9bff9e,0xff97ff99,0xff92ff95,0xff92ff91,0xff96ff93,
-0xff99ff98,0xff9dff9b,0xff9fff9e,0xffa2ffa1,0xffa5ffa3,0xffa8ffa6,0xffabffa9,0xffadffac,0xffafffae,0xffb1ffb0,0xffb2ffb1,0xffb3ffb3,0xffb3ffb3,0xffb2ffb3,0xffa2ffac,0xffa8ffa1,0xffa9ffab,0xffa2ffa6,0xff96ff9d,0x0583eb8c,0xd8820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff93ff87,0xff99ff99,0xff99ff99,0xff99ff99,0xff98ff99,0xff99ff99,0xff9aff9a,0xff9cff9b,
-0xff9eff9d,0xffa0ff9f,0xffa2ffa1,0xffa4ffa3,0xffa5ffa5,0xffa7ffa6,0xffa8ffa7,0xffa9ffa8,0xffa9ffa9,0xffa6ffa8,0xffa2ffa4,0xff9fffa1,0xff9cff9d,0xff98ff9a,0xff99ff97,0xff9cff9b,0xffa0ff9e,0xffa3ffa1,0xffa5ffa4,0xffa8ffa7,0xffaaffa9,0xffacffab,0xffaeffad,0xffb0ffaf,0xffb1ffb0,0xffb2ffb2,0xffb4ffb3,0xffb5ffb5,0xff9effa3,0xff9eff9e,0xffacffa2,0xffaeffb0,
-0xffa7ffab,0xff9affa2,0x0000dc8f,0xff827e82,0xff82ff82,0xff82ff82,0xff87ff82,0xff98ff93,0xff99ff98,0xff99ff99,0xff95ff97,0xff96ff95,0xff98ff97,0xff9aff99,0xff9cff9b,0xff9eff9d,0xffa1ff9f,0xffa2ffa2,0xffa4ffa3,0xffa6ffa5,0xffa7ffa7,0xffa8ffa8,0xffa8ffa9,0xffa5ffa6,0xffa2ffa3,0xffa0ffa1,0xff9dff9f,0xff9bff9c,0xff99ff99,0xff9cff9b,0xffa0ff9e,0xffa3ffa1,
-0xffa6ffa4,0xffa8ffa7,0xffabffa9,0xffadffac,0xffaeffae,0xffb0ffaf,0xffb1ffb1,0xffb3ffb2,0xffa2ffad,0xff9dff9d,0xff9dff9d,0xffa2ff9d,0xffb0ffac,0xffaaffad,0xffa1ffa6,0x828eff98,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x94820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff88,0xff96ff92,0xff9fff9a,0xffa7ffa3,0xffa8ffa9,0xffa5ffa6,0xffa3ffa4,0xffa1ffa2,0xffa1ffa1,0xffa0ffa0,0xffa0ffa0,0xffa1ffa0,0xffa2ffa2,0xffa3ffa3,0xffa4ffa4,0xffa4ffa4,0xffa4ffa4,0xffa4ffa4,0xffa3ffa4,0xff9fffa2,0xff97ff9b,0xff91ff93,0xff93ff92,0xff96ff93,0xff99ff97,0xff9bff9a,0xff9eff9d,
-0xffa0ff9f,0xffa3ffa1,0xffa5ffa4,0xffa7ffa6,0xffaaffa8,0xffadffab,0xffb0ffae,0xffb3ffb1,0xffb5ffb4,0xffb6ffb6,0xffb6ffb6,0xffb6ffb6,0xffb5ffb5,0xffb2ffb4,0xffafffb1,0xffa9ffac,0xffa1ffa6,0xff93ff9b,0x00009487,0xff828482,0xff82ff82,0xff82ff82,0xff87ff82,0xff95ff93,0xff91ff90,0xff99ff95,0xffa1ff9d,0xffa1ffa3,0xffa0ffa0,0xff9fff9f,0xff9fff9f,0xffa0ff9f,
-0xffa1ffa1,0xffa3ffa2,0xffa4ffa3,0xffa5ffa5,0xffa7ffa6,0xffa8ffa7,0xffa9ffa8,0xffa9ffa9,0xffa9ffa9,0xffa8ffa9,0xffa4ffa6,0xff9dffa1,0xff97ff9a,0xff97ff96,0xff9aff99,0xff9dff9c,0xffa0ff9f,0xffa3ffa1,0xffa5ffa4,0xffa8ffa7,0xffaaffa9,0xffacffab,0xffadffad,0xffafffae,0xffb1ffb0,0xffb2ffb2,0xffb4ffb3,0xffb4ffb4,0xffb5ffb5,0xffb6ffb5,0xffafffb5,0xffa3ffa3,
-0xffafffab,0xffa8ffac,0xff9effa4,0x7e8cff95,0xff822e82,0xff82ff82,0xff82ff82,0xff82ff82,0xff99ff8d,0xff96ff99,0xff98ff93,0xff9eff9c,0xff9cff9d,0xff9cff9c,0xff9cff9c,0xff9dff9d,0xff9fff9e,0xffa0ffa0,0xffa2ffa1,0xffa4ffa3,0xffa5ffa5,0xffa7ffa6,0xffa8ffa7,0xffa9ffa8,0xffa9ffa9,0xffa9ffa9,0xffa5ffa8,0xffa1ffa3,0xff9cff9e,0xff97ff99,0xff98ff96,0xff9bff99,
-0xff9eff9d,0xffa1ffa0,0xffa4ffa3,0xffa7ffa5,0xffa9ffa8,0xffabffaa,0xffadffac,0xffaeffae,0xffb0ffaf,0xffb1ffb1,0xffb3ffb2,0xffb4ffb3,0xffb5ffb5,0xffb6ffb6,0xff9effac,0xffa8ff9e,0xffaeffb0,0xffa8ffab,0xff9dffa3,0x288aff91,0xfd820d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff99ff8e,0xff99ff99,0xff99ff99,0xff9bff9a,0xff9bff9b,0xff9cff9c,0xff9eff9d,0xff9fff9e,
-0xffa1ffa0,0xffa3ffa2,0xffa5ffa4,0xffa7ffa6,0xffa9ffa8,0xffaaffaa,0xffacffab,0xffadffac,0xffadffad,0xffaaffac,0xffa7ffa9,0xffa4ffa5,0xffa0ffa2,0xff9cff9e,0xff9eff9c,0xffa1ff9f,0xffa4ffa3,0xffa7ffa6,0xffaaffa9,0xffacffab,0xffafffae,0xffb1ffb0,0xffb3ffb2,0xffb4ffb4,0xffb6ffb5,0xffb7ffb6,0xffb8ffb8,0xffa6ffb8,0xff9eff9e,0xff9eff9e,0xffa7ff9e,0xffb3ffb5,
-0xffacffb0,0xffa0ffa7,0x078dfb95,0xff82b082,0xff82ff82,0xff82ff82,0xff8dff82,0xff99ff98,0xff99ff99,0xff99ff99,0xff98ff99,0xff99ff98,0xff9bff9a,0xff9dff9c,0xff9fff9e,0xffa2ffa1,0xffa4ffa3,0xffa6ffa5,0xffa8ffa7,0xffaaffa9,0xffabffaa,0xffacffac,0xffacffad,0xffa9ffab,0xffa7ffa8,0xffa4ffa6,0xffa2ffa3,0xff9fffa1,0xff9dff9d,0xffa1ff9f,0xffa4ffa3,0xffa7ffa6,
-0xffaaffa9,0xffadffab,0xffafffae,0xffb1ffb0,0xffb3ffb2,0xffb4ffb4,0xffb6ffb5,0xffb7ffb6,0xff9dffa3,0xff9dff9d,0xff9dff9d,0xff9eff9e,0xffb5ffb0,0xffafffb2,0xffa6ffab,0xa893ff9e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xd6820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff87,0xff8eff89,0xff97ff92,0xff9fff9b,0xffa6ffa3,0xffa6ffa7,0xffa3ffa4,0xffa2ffa2,0xffa1ffa1,0xffa2ffa1,0xffa2ffa2,0xffa4ffa3,0xffa5ffa4,0xffa6ffa6,0xffa7ffa7,0xffa8ffa8,0xffa9ffa9,0xffa9ffa9,0xffa9ffa9,0xffa8ffa8,0xffa4ffa7,0xff9cffa0,0xff96ff98,0xff98ff97,0xff9bff9a,0xff9eff9c,0xffa0ff9f,0xffa3ffa2,
-0xffa5ffa4,0xffa8ffa6,0xffaaffa9,0xffacffab,0xffadffac,0xffafffae,0xffb0ffaf,0xffb2ffb1,0xffb4ffb3,0xffb4ffb4,0xffb5ffb5,0xffb6ffb6,0xffb5ffb5,0xffb4ffb5,0xffacffad,0xffacffaf,0xffa5ffa9,0xff99ffa0,0x0000d48e,0xff82ae82,0xff82ff82,0xff82ff82,0xff8dff82,0xff99ff99,0xff95ff96,0xff9dff99,0xffa5ffa1,0xffa4ffa6,0xffa2ffa3,0xffa2ffa2,0xffa2ffa2,0xffa3ffa3,
-0xffa5ffa4,0xffa6ffa5,0xffa8ffa7,0xffa9ffa9,0xffabffaa,0xffacffab,0xffadffac,0xffadffad,0xffadffad,0xffadffad,0xffa8ffab,0xffa2ffa5,0xff9cff9f,0xff9cff9a,0xff9fff9d,0xffa2ffa0,0xffa5ffa3,0xffa7ffa6,0xffaaffa9,0xffacffab,0xffaeffad,0xffb0ffaf,0xffb2ffb1,0xffb4ffb3,0xffb5ffb4,0xffb6ffb6,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffbbffbb,0xffaaffb9,0xff9fff9f,
-0xffb4ffaa,0xffadffb1,0xffa4ffa9,0xb690ff9c,0xff825e82,0xff82ff82,0xff82ff82,0xff87ff82,0xff99ff93,0xff98ff99,0xff9cff98,0xffa1ffa0,0xff9fffa0,0xff9fff9f,0xff9fff9f,0xffa1ffa0,0xffa2ffa1,0xffa4ffa3,0xffa6ffa5,0xffa7ffa7,0xffa9ffa8,0xffabffaa,0xffacffab,0xffadffac,0xffadffad,0xffadffad,0xffaaffac,0xffa5ffa8,0xffa1ffa3,0xff9bff9e,0xff9cff9b,0xffa0ff9e,
-0xffa3ffa1,0xffa6ffa4,0xffa9ffa7,0xffabffaa,0xffadffac,0xffb0ffae,0xffb1ffb1,0xffb3ffb2,0xffb5ffb4,0xffb6ffb5,0xffb7ffb7,0xffb9ffb8,0xffb9ffb9,0xffb0ffbb,0xff9eff9e,0xffa4ff9e,0xffb3ffaf,0xffadffb0,0xffa2ffa8,0x568fff99,0xff821e82,0xff82ff82,0xff82ff82,0xff84ff82,0xff99ff8f,0xff99ff99,0xff99ff99,0xff9aff99,0xff9eff9c,0xff9fff9e,0xffa0ffa0,0xffa2ffa1,
-0xffa5ffa4,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xffacffac,0xffaeffad,0xffafffaf,0xffb0ffb0,0xffb1ffb1,0xffafffb1,0xffabffad,0xffa8ffaa,0xffa4ffa6,0xffa0ffa2,0xffa2ffa0,0xffa5ffa4,0xffa8ffa7,0xffacffaa,0xffaeffad,0xffb1ffb0,0xffb3ffb2,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffbcffbb,0xffb6ffbc,0xff9effa2,0xff9eff9e,0xff9eff9e,0xffa1ff9e,0xffb8ffb9,
-0xffb1ffb5,0xffa5ffac,0x2690ff9a,0xff82ca82,0xff82ff82,0xff82ff82,0xff8eff83,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9bff99,0xff9eff9d,0xffa0ff9f,0xffa3ffa1,0xffa5ffa4,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xffadffac,0xffafffae,0xffb0ffaf,0xffb0ffb0,0xffadffaf,0xffabffac,0xffa9ffaa,0xffa6ffa7,0xffa3ffa5,0xffa2ffa1,0xffa5ffa3,0xffa9ffa7,0xffacffaa,
-0xffaeffad,0xffb1ffb0,0xffb3ffb2,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffa9ffb9,0xff9eff9d,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xffb9ffab,0xffb4ffb7,0xffabffb0,0xc698ffa3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xfb820b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff95ff8e,0xff92ff90,0xff9aff96,0xffa2ff9e,0xffa9ffa6,0xffa7ffa9,0xffa5ffa6,0xffa4ffa4,0xffa4ffa4,0xffa5ffa5,0xffa6ffa6,0xffa8ffa7,0xffa9ffa8,0xffaaffaa,0xffabffab,0xffacffac,0xffadffad,0xffadffad,0xffadffad,0xffacffad,0xffa9ffac,0xffa2ffa6,0xff9bff9d,0xff9eff9c,0xffa0ff9f,0xffa3ffa1,0xffa5ffa4,0xffa8ffa6,
-0xffaaffa9,0xffacffab,0xffaeffad,0xffb0ffaf,0xffb2ffb1,0xffb3ffb3,0xffb5ffb4,0xffb6ffb5,0xffb7ffb6,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffaaffa5,0xffb1ffb4,0xffaaffae,0xff9effa5,0x0989fb93,0xff82d082,0xff82ff82,0xff82ff82,0xff8eff82,0xff99ff99,0xff99ff98,0xffa1ff9d,0xffa8ffa5,0xffa7ffa8,0xffa5ffa5,0xffa5ffa5,0xffa5ffa5,0xffa7ffa6,
-0xffa8ffa7,0xffaaffa9,0xffabffab,0xffadffac,0xffaeffae,0xffb0ffaf,0xffb1ffb0,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffadffb0,0xffa7ffaa,0xffa0ffa3,0xffa0ff9f,0xffa3ffa2,0xffa6ffa5,0xffa9ffa8,0xffacffab,0xffaeffad,0xffb1ffb0,0xffb3ffb2,0xffb5ffb4,0xffb7ffb6,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbdffbd,0xffbfffbe,0xffbfffbf,0xff9fffb1,0xff9fff9f,
-0xffb8ffaa,0xffb2ffb6,0xffa9ffae,0xca95ffa1,0xff827682,0xff82ff82,0xff82ff82,0xff8eff82,0xff99ff99,0xff99ff99,0xff9cff9a,0xffa4ffa1,0xffa2ffa3,0xffa2ffa2,0xffa2ffa2,0xffa4ffa3,0xffa5ffa5,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xffadffac,0xffaeffad,0xffafffaf,0xffb0ffb0,0xffb1ffb1,0xffb1ffb1,0xffaeffb0,0xffaaffac,0xffa5ffa8,0xffa0ffa2,0xffa1ff9f,0xffa4ffa3,
-0xffa7ffa6,0xffaaffa9,0xffadffac,0xffb0ffae,0xffb2ffb1,0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffb9ffb8,0xffbbffb9,0xffbcffbb,0xffbeffbd,0xffbcffbe,0xff9fffae,0xff9eff9e,0xff9fff9f,0xffb8ffb3,0xffb2ffb5,0xffa7ffad,0x7293ff9e,0xff822c82,0xff82ff82,0xff82ff82,0xff86ff83,0xff99ff91,0xff99ff99,0xff99ff99,0xff99ff99,0xff9cff9b,0xffa2ff9f,0xffa3ffa2,0xffa5ffa4,
-0xffa8ffa7,0xffaaffa9,0xffacffab,0xffaeffad,0xffb0ffaf,0xffb2ffb1,0xffb3ffb2,0xffb4ffb4,0xffb5ffb4,0xffb3ffb4,0xffb0ffb1,0xffacffae,0xffa8ffaa,0xffa4ffa6,0xffa6ffa4,0xffaaffa8,0xffadffab,0xffb0ffae,0xffb2ffb1,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbeffbd,0xffbfffbf,0xff9fffae,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xffbcffbd,
-0xffb5ffb9,0xffa9ffb0,0x2c93ff9f,0xff82d082,0xff82ff82,0xff82ff82,0xff90ff85,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9bff99,0xffa1ff9e,0xffa3ffa2,0xffa6ffa4,0xffa8ffa7,0xffaaffa9,0xffadffab,0xffafffae,0xffb1ffb0,0xffb2ffb1,0xffb4ffb3,0xffb4ffb4,0xffb1ffb3,0xffafffb0,0xffacffae,0xffaaffab,0xffa7ffa9,0xffa6ffa5,0xffa9ffa8,0xffadffab,0xffb0ffae,
-0xffb3ffb1,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffb9ffbe,0xff9effa6,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xffbeffa9,0xffb8ffbc,0xffafffb4,0xd49cffa7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff822482,0xff82ff82,0xff82ff82,0xff88ff82,0xff99ff93,0xff96ff97,0xff9eff9a,0xffa6ffa2,0xffacffa9,0xffaaffac,0xffa8ffa9,0xffa7ffa7,0xffa7ffa7,0xffa8ffa8,0xffaaffa9,0xffabffaa,0xffadffac,0xffaeffad,0xffafffaf,0xffb0ffb0,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffaeffb0,0xffa6ffaa,0xffa0ffa2,0xffa2ffa1,0xffa5ffa3,0xffa7ffa6,0xffaaffa9,0xffacffab,
-0xffafffae,0xffb1ffb0,0xffb3ffb2,0xffb5ffb4,0xffb6ffb6,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffbcffbb,0xffbdffbc,0xffbeffbd,0xffbfffbf,0xffbfffbf,0xffaaffbe,0xffa5ff9f,0xffb6ffb8,0xffafffb3,0xffa3ffaa,0x228dff98,0xff82d082,0xff82ff82,0xff82ff82,0xff90ff84,0xff99ff99,0xff9aff99,0xffa2ff9c,0xffabffa8,0xffa9ffab,0xffa8ffa8,0xffa8ffa7,0xffa8ffa8,0xffaaffa9,
-0xffabffab,0xffadffac,0xffafffae,0xffb0ffaf,0xffb2ffb1,0xffb3ffb2,0xffb4ffb4,0xffb5ffb5,0xffb5ffb5,0xffb5ffb5,0xffb1ffb4,0xffabffae,0xffa4ffa8,0xffa5ffa4,0xffa8ffa7,0xffabffa9,0xffaeffac,0xffb0ffaf,0xffb3ffb2,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbcffbc,0xffbeffbd,0xffbfffbf,0xffc1ffc0,0xffc2ffc1,0xffc3ffc3,0xffacffc0,0xff9fff9f,0xff9fff9f,
-0xffbdffa9,0xffb7ffb9,0xffadffb2,0xd899ffa5,0xff828082,0xff82ff82,0xff82ff82,0xff8fff83,0xff99ff99,0xff99ff99,0xff99ff99,0xff9fff9d,0xffa4ffa2,0xffa4ffa4,0xffa5ffa5,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xffacffac,0xffaeffad,0xffb0ffaf,0xffb2ffb1,0xffb3ffb2,0xffb4ffb4,0xffb5ffb5,0xffb5ffb5,0xffb3ffb4,0xffaeffb0,0xffa9ffac,0xffa4ffa6,0xffa5ffa4,0xffa9ffa7,
-0xffacffaa,0xffafffad,0xffb1ffb0,0xffb4ffb2,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffbcffbb,0xffbdffbc,0xffbfffbe,0xffc0ffc0,0xffbfffc1,0xffa1ffad,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffbcffb3,0xffb6ffb9,0xffabffb2,0x8497ffa2,0xff821e82,0xff82ff82,0xff82ff82,0xff89ff84,0xff99ff92,0xff99ff99,0xff99ff99,0xff9aff99,0xff9aff9a,0xff9eff9c,0xffa6ffa2,0xffa8ffa7,
-0xffaaffa9,0xffadffab,0xffafffae,0xffb1ffb0,0xffb3ffb2,0xffb5ffb4,0xffb6ffb6,0xffb8ffb7,0xffb8ffb8,0xffb7ffb8,0xffb4ffb5,0xffb0ffb2,0xffacffae,0xffa8ffaa,0xffaaffa8,0xffaeffac,0xffb1ffaf,0xffb4ffb2,0xffb6ffb5,0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffc1ffc0,0xffc2ffc1,0xffa4ffb6,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9fff9f,0xffa0ff9f,0xffc0ffc2,
-0xffb9ffbd,0xffadffb4,0x3097ffa1,0xff82d082,0xff82ff82,0xff83ff82,0xff92ff88,0xff99ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff9a,0xff9eff9c,0xffa6ffa2,0xffa8ffa7,0xffabffa9,0xffadffac,0xffb0ffae,0xffb2ffb1,0xffb4ffb3,0xffb5ffb5,0xffb7ffb6,0xffb8ffb8,0xffb5ffb7,0xffb3ffb4,0xffb0ffb2,0xffaeffaf,0xffaaffac,0xffaaffa9,0xffadffac,0xffb1ffaf,0xffb4ffb2,
-0xffb6ffb5,0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffc0ffc0,0xffa0ffb2,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xffc2ffac,0xffbcffbf,0xffb3ffb8,0xd0a0ffab,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff822a82,0xff82ff82,0xff82ff82,0xff8eff82,0xff99ff99,0xff9aff99,0xffa1ff9c,0xffa9ffa5,0xffafffad,0xffadffaf,0xffabffac,0xffaaffaa,0xffabffaa,0xffacffab,0xffadffac,0xffaeffae,0xffb0ffaf,0xffb1ffb1,0xffb3ffb2,0xffb4ffb3,0xffb5ffb4,0xffb5ffb5,0xffb5ffb5,0xffb5ffb5,0xffb2ffb4,0xffaaffaf,0xffa5ffa6,0xffa7ffa6,0xffa9ffa8,0xffacffab,0xffaeffad,0xffb1ffb0,
-0xffb3ffb2,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbcffbc,0xffbeffbd,0xffbfffbe,0xffc0ffbf,0xffc1ffc1,0xffc2ffc2,0xffc3ffc3,0xffc1ffc3,0xff9fffab,0xffa0ff9f,0xffb9ffbb,0xffb3ffb7,0xffa7ffae,0x2c92ff9c,0xff82c682,0xff82ff82,0xff83ff82,0xff91ff86,0xff99ff99,0xff9aff99,0xff9dff9a,0xffa3ffa2,0xffacffa8,0xffaaffab,0xffaaffaa,0xffabffab,0xffadffac,
-0xffaeffad,0xffb0ffaf,0xffb2ffb1,0xffb4ffb3,0xffb5ffb4,0xffb6ffb6,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb6ffb8,0xffafffb3,0xffa9ffac,0xffa9ffa8,0xffacffab,0xffafffae,0xffb2ffb0,0xffb4ffb3,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffc0ffc0,0xffc2ffc1,0xffc3ffc3,0xffc5ffc4,0xffc3ffc5,0xffacffb9,0xff9fffa1,0xff9fff9f,0xff9fff9f,
-0xffc1ffab,0xffb9ffbe,0xffb1ffb6,0xc89effa9,0xff827282,0xff82ff82,0xff82ff82,0xff91ff85,0xff99ff99,0xff99ff99,0xff9aff99,0xff9aff9a,0xffa0ff9d,0xffa7ffa3,0xffa8ffa7,0xffaaffa9,0xffabffab,0xffaeffac,0xffafffaf,0xffb1ffb0,0xffb3ffb2,0xffb5ffb4,0xffb6ffb6,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb7ffb8,0xffb2ffb5,0xffadffb0,0xffa8ffaa,0xffaaffa8,0xffadffab,
-0xffb0ffae,0xffb3ffb1,0xffb5ffb4,0xffb8ffb7,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffc0ffbf,0xffc1ffc1,0xffc3ffc2,0xffc0ffc4,0xffa0ffae,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffc0ffb7,0xffb9ffbd,0xffafffb5,0x729bffa6,0xff820f82,0xff82ff82,0xff82ff82,0xff8cff86,0xff99ff93,0xff99ff99,0xff9aff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffa1ff9d,0xffabffa6,
-0xffadffac,0xffafffae,0xffb2ffb1,0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbbffbc,0xffb8ffb9,0xffb4ffb6,0xffb0ffb2,0xffacffae,0xffaeffad,0xffb2ffb0,0xffb5ffb3,0xffb8ffb6,0xffb9ffb9,0xffbdffbb,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc4ffc4,0xffa8ffbb,0xff9eff9e,0xff9fff9e,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffa9ff9f,0xffc4ffc6,
-0xffbdffc0,0xffb0ffb7,0x0b99fba5,0xff82b882,0xff82ff82,0xff85ff82,0xff93ff8b,0xff99ff99,0xff99ff99,0xff99ff99,0xff9aff99,0xff9aff9a,0xff9aff9a,0xffa1ff9d,0xffabffa6,0xffaeffac,0xffb0ffaf,0xffb3ffb1,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffbbffbb,0xffb9ffb9,0xffb6ffb8,0xffb4ffb5,0xffb1ffb3,0xffaeffb0,0xffaeffad,0xffb1ffb0,0xffb4ffb3,0xffb8ffb6,
-0xffb9ffb9,0xffbdffbb,0xffbfffbe,0xffc1ffc0,0xffc2ffc2,0xffa4ffb6,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9fff9e,0xffc6ffb5,0xffc0ffc3,0xffb6ffbb,0xb8a2ffae,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff822282,0xff82ff82,0xff82ff82,0xff8cff83,0xff9aff96,0xff9aff9a,0xff9fff9c,0xffadffa5,0xffb2ffb0,0xffafffb1,0xffadffae,0xffadffad,0xffaeffad,0xffafffae,0xffb0ffaf,0xffb2ffb1,0xffb3ffb2,0xffb5ffb4,0xffb6ffb5,0xffb7ffb7,0xffb8ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb7ffb8,0xffafffb3,0xffaaffab,0xffacffab,0xffaeffad,0xffb0ffaf,0xffb3ffb1,0xffb5ffb4,
-0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffc0ffc0,0xffc2ffc1,0xffc3ffc2,0xffc4ffc4,0xffc5ffc5,0xffc6ffc6,0xffc7ffc7,0xffa6ffbc,0xffa0ffa0,0xffa0ffa0,0xffbeffc0,0xffb7ffbb,0xffabffb2,0x1e95ff9f,0xff82be82,0xff82ff82,0xff84ff82,0xff93ff89,0xff9aff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffa3ff9f,0xffa8ffa3,0xffadffad,0xffaeffad,0xffafffaf,
-0xffb1ffb0,0xffb3ffb2,0xffb5ffb4,0xffb7ffb6,0xffb8ffb8,0xffb9ffb9,0xffbbffb9,0xffbcffbc,0xffbdffbc,0xffbdffbd,0xffb9ffbc,0xffb3ffb7,0xffadffb0,0xffaeffac,0xffb0ffaf,0xffb3ffb2,0xffb6ffb4,0xffb8ffb7,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc4ffc4,0xffc6ffc5,0xffc7ffc6,0xffb9ffc6,0xffa0ffab,0xff9fff9f,0xff9fff9f,0xffa0ff9f,0xffa0ffa0,
-0xffc4ffb4,0xffbeffc2,0xffb4ffb9,0xb0a0ffac,0xff826282,0xff82ff82,0xff83ff82,0xff8cff88,0xff99ff93,0xff9aff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffa1ff9e,0xffaaffa6,0xffacffab,0xffaeffad,0xffb0ffaf,0xffb2ffb1,0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbdffbc,0xffbbffbc,0xffb6ffb9,0xffb1ffb4,0xffacffae,0xffaeffac,0xffb1ffaf,
-0xffb4ffb2,0xffb6ffb5,0xffb9ffb8,0xffbcffbb,0xffbeffbd,0xffc0ffbf,0xffc2ffc1,0xffc4ffc3,0xffc5ffc4,0xffc0ffc6,0xffa0ffae,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffa3ff9f,0xffc4ffc0,0xffbdffc1,0xffb2ffb8,0x629dffa9,0xe2820000,0xff82ff82,0xff84ff82,0xff91ff8a,0xff93ff8e,0xff99ff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffa3ff9f,
-0xffb0ffa9,0xffb2ffb1,0xffb4ffb3,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbeffbd,0xffbfffbf,0xffbeffbf,0xffbbffbd,0xffb7ffb9,0xffb3ffb6,0xffafffb1,0xffb2ffb0,0xffb5ffb4,0xffb8ffb7,0xffbbffb9,0xffbeffbd,0xffc0ffbf,0xffc3ffc1,0xffc5ffc4,0xffc3ffc6,0xffa5ffb5,0xff9fff9e,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffbcffa0,0xffc4ffc7,
-0xffc3ffc8,0xffb2ffb9,0x0000e2a6,0xff828c82,0xff82ff82,0xff89ff84,0xff92ff90,0xff99ff93,0xff99ff99,0xff9aff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffa3ff9f,0xffabffa4,0xffb3ffb1,0xffb5ffb4,0xffb8ffb6,0xffb9ffb9,0xffbcffbb,0xffbdffbd,0xffbeffbe,0xffbcffbe,0xffb9ffbb,0xffb8ffb9,0xffb5ffb6,0xffb1ffb3,0xffb2ffb0,0xffb5ffb3,0xffb8ffb7,0xffbbffb9,
-0xffbeffbd,0xffc1ffbf,0xffc3ffc2,0xffbcffc4,0xffa2ffaf,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9fff9f,0xff9fff9f,0xffa2ff9f,0xffc2ffc4,0xffc4ffc6,0xffb8ffbe,0x8ca5ffaf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff820e82,0xff82ff82,0xff82ff82,0xff8aff85,0xff9aff93,0xff9aff9a,0xff9aff9a,0xffa4ff9f,0xffb3ffa6,0xffb2ffb3,0xffb0ffb1,0xffb0ffb0,0xffb0ffb0,0xffb1ffb1,0xffb3ffb2,0xffb5ffb4,0xffb6ffb6,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbcffbc,0xffbdffbc,0xffbcffbc,0xffb9ffbc,0xffb3ffb7,0xffaeffaf,0xffb0ffaf,0xffb2ffb1,0xffb4ffb3,0xffb7ffb5,0xffb9ffb8,
-0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc4ffc4,0xffc6ffc5,0xffc7ffc6,0xffc8ffc8,0xffc9ffc9,0xffbfffc7,0xffa7ffb4,0xffa0ffa0,0xffa0ffa0,0xffaaffa0,0xffc2ffc5,0xffbbffbf,0xffaeffb5,0x1297ffa1,0xff828c82,0xff82ff82,0xff88ff82,0xff91ff8e,0xff9aff98,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9fff9a,0xffa4ffa4,0xffb0ffaa,0xffb2ffb1,
-0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffbdffbc,0xffbeffbe,0xffbfffbf,0xffc0ffc0,0xffc0ffc0,0xffbeffbf,0xffb7ffb9,0xffb1ffb3,0xffb2ffb1,0xffb4ffb3,0xffb7ffb6,0xffb9ffb8,0xffbcffbb,0xffbfffbd,0xffc1ffc0,0xffc3ffc2,0xffc5ffc4,0xffc6ffc6,0xffc8ffc7,0xffc7ffc9,0xffaeffbd,0xff9fffa1,0xff9fff9f,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa3ffa0,
-0xffc6ffc2,0xffc3ffc6,0xffb6ffbc,0x86a2ffad,0xff823882,0xff82ff82,0xff85ff82,0xff91ff8c,0xff99ff92,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xffa3ff9f,0xffa9ffa4,0xffb1ffb0,0xffb3ffb2,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbeffbd,0xffbfffbf,0xffc0ffc0,0xffbeffc0,0xffb9ffbc,0xffb5ffb8,0xffb0ffb2,0xffb2ffb0,0xffb5ffb3,
-0xffb8ffb6,0xffb9ffb9,0xffbdffbc,0xffbfffbe,0xffc2ffc1,0xffc4ffc3,0xffc6ffc5,0xffc7ffc6,0xffb9ffc6,0xff9fffa9,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffacff9f,0xffc7ffc7,0xffc0ffc4,0xffb5ffbb,0x349fffaa,0xa8820000,0xff82ff82,0xff98ff82,0xffb6ffb1,0xff8bffac,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xff9bff9b,
-0xffa6ffa0,0xffafffa7,0xffb7ffb6,0xffb9ffb8,0xffbcffb9,0xffbeffbd,0xffbfffbf,0xffc1ffc0,0xffc2ffc2,0xffc2ffc2,0xffbfffc0,0xffbbffbd,0xffb7ffb9,0xffb3ffb4,0xffb6ffb4,0xffb9ffb7,0xffbcffb9,0xffbfffbd,0xffc1ffc0,0xffc4ffc3,0xffc5ffc5,0xffb3ffbc,0xff9fffa9,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffb7ffb2,0xffc8ffbd,
-0xffc5ffcd,0xffb3ffbc,0x0000a6a8,0xff825082,0xff82ff82,0xffaeff8c,0xffb5ffb5,0xff93ff91,0xff9aff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xffa1ff9b,0xffb0ffa7,0xffb8ffb7,0xffb9ffb9,0xffbdffbb,0xffbfffbe,0xffc0ffbf,0xffc1ffc1,0xffc0ffc1,0xffbdffbf,0xffbbffbc,0xffb8ffb9,0xffb4ffb6,0xffb5ffb4,0xffb8ffb7,0xffbcffb9,0xffbfffbd,
-0xffc1ffc0,0xffc4ffc3,0xffabffbb,0xff9effa3,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffb5ffa1,0xffc1ffb6,0xffc7ffc8,0xffb9ffc1,0x50a5ffb0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xdd820382,0xff82ff82,0xff83ff82,0xff8fff8a,0xff93ff8d,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xffa7ff9e,0xffacffa6,0xffb2ffb2,0xffb3ffb2,0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffb9ffb8,0xffbbffb9,0xffbcffbc,0xffbeffbd,0xffbfffbe,0xffc0ffbf,0xffc0ffc0,0xffc0ffc0,0xffbeffbf,0xffb7ffbb,0xffb3ffb3,0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffbbffb9,0xffbdffbc,
-0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc8ffc7,0xffc9ffc9,0xffcaffca,0xffbbffc6,0xffa5ffad,0xffa0ffa1,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffb9ffa1,0xffc4ffc0,0xffbdffc3,0xffb0ffb8,0x0396e1a5,0xff825482,0xff82ff82,0xffaeff8c,0xffb5ffb5,0xff93ff93,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xff9bff9b,0xff9bff9b,0xffa6ffa1,0xffb0ffa7,
-0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffc0ffbf,0xffc1ffc0,0xffc2ffc2,0xffc3ffc3,0xffc3ffc3,0xffc1ffc3,0xffbbffbe,0xffb4ffb7,0xffb6ffb4,0xffb8ffb7,0xffbbffb9,0xffbdffbc,0xffc0ffbe,0xffc2ffc1,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffc9ffc9,0xffbbffc5,0xffa2ffb0,0xff9fff9f,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffb5ffa2,
-0xffc6ffb6,0xffc6ffc8,0xffb8ffbf,0x4aa3ffae,0xf3820782,0xff82ff82,0xffa6ff82,0xffb6ffb3,0xff93ff9c,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xff9bff9b,0xffa0ff9b,0xffa6ffa6,0xffb5ffa7,0xffb8ffb7,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffc0ffbf,0xffc1ffc0,0xffc2ffc2,0xffc3ffc3,0xffc2ffc3,0xffbdffc0,0xffb8ffbb,0xffb3ffb5,0xffb5ffb4,0xffb8ffb7,
-0xffbbffb9,0xffbeffbd,0xffc0ffbf,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc1ffc8,0xffabffb8,0xff9fffa0,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffa0ffa0,0xffa0ffa0,0xffb2ffaa,0xffc8ffc6,0xffc3ffc7,0xffb6ffbd,0x07a1f1ab,0x56820000,0xff82ff82,0xff87ff82,0xffb3ffa5,0xff99ffb6,0xff99ff93,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9b,0xff9bff9b,
-0xff9bff9b,0xffb6ff9e,0xffb9ffb8,0xffbcffbb,0xffbeffbd,0xffc0ffbf,0xffc2ffc1,0xffc4ffc3,0xffc5ffc4,0xffc5ffc5,0xffc2ffc3,0xffbeffc0,0xffb9ffbc,0xffb6ffb7,0xffb9ffb8,0xffbcffbb,0xffbfffbe,0xffc2ffc1,0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffa3ffad,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffb8ffa1,0xffbcffbf,0xffceffc7,
-0xffc3ffca,0xffb3ffbd,0x00004ea8,0xf5820982,0xff82ff82,0xff9aff85,0xffb5ffb0,0xff8cffa8,0xff9aff97,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xff9bff9b,0xff9bff9b,0xffbcffae,0xffb9ffb9,0xffbdffbc,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc4ffc4,0xffc3ffc4,0xffc1ffc2,0xffbeffbf,0xffbbffbd,0xffb7ffb9,0xffb8ffb7,0xffbcffb9,0xffbfffbe,0xffc2ffc0,
-0xffc5ffc3,0xffc7ffc6,0xffa0ffbe,0xff9eff9e,0xff9eff9e,0xff9fff9e,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffa6ff9f,0xffbeffc4,0xffcbffc0,0xffc7ffcc,0xffbbffc2,0x0fa5f3b0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xa8820000,0xff82ff82,0xff98ff82,0xffb6ffb2,0xff8bffad,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9b,0xff9bff9b,0xffa1ff9b,0xffa7ffa7,0xffb2ffa7,0xffb7ffb6,0xffb8ffb7,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffbfffbe,0xffc1ffc0,0xffc2ffc1,0xffc3ffc2,0xffc3ffc3,0xffc3ffc3,0xffc2ffc3,0xffb9ffbf,0xffb7ffb7,0xffb8ffb7,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffc0ffbf,
-0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc8ffc8,0xffcaffc9,0xffcbffcb,0xffbdffc7,0xffa5ffb1,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffb8ffb1,0xffc9ffbe,0xffc0ffc8,0xffb1ffb9,0x0000a6a5,0xf3820f82,0xff82ff82,0xff98ff83,0xffb5ffae,0xff8cffa7,0xff9aff97,0xff9aff9a,0xff9aff9a,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9cff9b,
-0xffb9ffaf,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffc1ffc0,0xffc2ffc2,0xffc4ffc3,0xffc5ffc5,0xffc6ffc6,0xffc6ffc6,0xffc5ffc6,0xffbeffc2,0xffb7ffb9,0xffb9ffb8,0xffbcffb9,0xffbeffbd,0xffc1ffc0,0xffc3ffc2,0xffc6ffc4,0xffc8ffc7,0xffcaffc9,0xffcbffcb,0xffabffcc,0xff9fff9f,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa6ffa0,0xffbeffc1,
-0xffcbffc1,0xffc5ffcb,0xffb9ffc0,0x0fa2f3ad,0xa8820000,0xff82ff82,0xff8dff83,0xffb4ffad,0xff8cffb3,0xff9aff96,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xffb9ffa3,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffc1ffbf,0xffc2ffc1,0xffc4ffc3,0xffc5ffc5,0xffc6ffc6,0xffc5ffc6,0xffc1ffc3,0xffbbffbe,0xffb6ffb8,0xffb9ffb7,0xffbcffb9,
-0xffbfffbd,0xffc1ffc0,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffcaffc9,0xffa2ffbe,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffb0ffa0,0xffbeffc3,0xffcbffc4,0xffc4ffca,0xffb7ffbf,0x0000aeab,0x07820000,0xff82e582,0xff87ff82,0xffaaff8f,0xffb3ffb4,0xff97ff93,0xff9aff9b,0xff9aff9a,0xff9aff9a,0xff9bff9b,0xff9bff9b,0xff9bff9b,
-0xffabff9b,0xffc0ffd1,0xffbcffb9,0xffbeffbd,0xffc1ffbf,0xffc3ffc2,0xffc5ffc4,0xffc6ffc6,0xffc8ffc7,0xffc8ffc8,0xffc5ffc6,0xffc1ffc3,0xffbdffbf,0xffb9ffb9,0xffbdffbb,0xffc0ffbe,0xffc3ffc1,0xffc5ffc4,0xffc8ffc7,0xffcaffc9,0xffccffcb,0xffafffc5,0xff9fffa7,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffa0ffa0,0xffafffa0,0xffcaffcb,0xffc7ffc3,0xffceffce,
-0xffc4ffc9,0xedb1ffbd,0x000007a8,0x9a820000,0xff82ff82,0xff8cff85,0xffb2ffa2,0xff9cffb5,0xff9dff91,0xff9aff9d,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xff9bff9b,0xff9bff9b,0xffc4ffa2,0xffb9ffd0,0xffbdffbb,0xffbfffbe,0xffc1ffc0,0xffc4ffc3,0xffc6ffc5,0xffc7ffc6,0xffc6ffc7,0xffc4ffc5,0xffc1ffc2,0xffbeffc0,0xffb9ffbc,0xffbcffb9,0xffbfffbd,0xffc2ffc1,0xffc5ffc4,
-0xffc8ffc7,0xffcaffc9,0xffb6ffcb,0xffa2ffac,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xffa1ff9f,0xffd0ffb7,0xffc1ffc4,0xffd1ffcb,0xffc9ffcf,0xffb9ffc3,0x00009eaf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x52820000,0xff82ff82,0xff86ff82,0xffb3ffa3,0xff97ffb6,0xff99ff93,0xff9aff9a,0xff9bff9a,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9cff9b,0xffb9ffa1,0xffbbffb9,0xffbdffbc,0xffbeffbe,0xffc0ffbf,0xffc2ffc1,0xffc3ffc3,0xffc5ffc4,0xffc6ffc5,0xffc6ffc6,0xffc6ffc6,0xffc5ffc6,0xffbeffc2,0xffb9ffbb,0xffbcffbb,0xffbdffbc,0xffbfffbe,0xffc2ffc1,0xffc4ffc3,
-0xffc6ffc5,0xffc8ffc7,0xffcaffc9,0xffccffcb,0xffcdffcd,0xffa7ffc1,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa1ffa1,0xffb9ffa2,0xffbeffbf,0xffcdffc8,0xffc2ffc9,0xffb0ffbb,0x000056a6,0x9a820000,0xff82ff82,0xff8eff84,0xffb0ffa1,0xff9bffb5,0xff9dff91,0xff9aff9d,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xffc2ffa2,
-0xffbbffc8,0xffbdffbc,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc8ffc7,0xffc9ffc8,0xffc9ffc9,0xffc8ffc9,0xffc1ffc5,0xffbbffbd,0xffbdffbc,0xffbfffbe,0xffc2ffc0,0xffc4ffc3,0xffc6ffc5,0xffc9ffc7,0xffcbffca,0xffcdffcc,0xffcfffce,0xffc4ffcf,0xffa3ffb0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa2ffa0,0xffcfffb7,0xffc2ffc4,
-0xffd1ffcb,0xffc7ffcd,0xffb8ffc1,0x0000aaad,0x46820000,0xff82ff82,0xff88ff83,0xffb0ff96,0xffaaffb5,0xff9bff90,0xff9aff9c,0xff9aff9a,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xffb6ff9d,0xffb9ffd0,0xffbcffbb,0xffbeffbd,0xffc1ffc0,0xffc3ffc2,0xffc5ffc4,0xffc6ffc6,0xffc8ffc7,0xffc9ffc8,0xffc8ffc9,0xffc4ffc6,0xffbeffc1,0xffb9ffbb,0xffbcffbb,0xffbfffbe,
-0xffc2ffc0,0xffc4ffc3,0xffc7ffc6,0xffc9ffc8,0xffccffca,0xffcdffcd,0xffb6ffcd,0xffa1ffac,0xff9fff9f,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa0ffa0,0xffa5ffa0,0xffcfffc2,0xffc4ffc2,0xffceffcc,0xffc5ffca,0xffb5ffbf,0x000049aa,0x00000000,0xff827882,0xff87ff82,0xff98ff8e,0xffb4ffac,0xff98ffb1,0xffa2ff9c,0xffa1ffa5,0xff9bff9b,0xff9bff9b,0xff9dff9b,0xffb6ffa6,
-0xffdcffcc,0xffbbffca,0xffbeffbc,0xffc0ffbf,0xffc3ffc1,0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcaffca,0xffcbffcb,0xffc8ffc9,0xffc4ffc6,0xffbfffc2,0xffbdffbd,0xffc0ffbe,0xffc3ffc1,0xffc6ffc4,0xffc8ffc7,0xffcbffca,0xffcdffcc,0xffcfffce,0xffc2ffd0,0xffbdffbc,0xffa7ffb4,0xff9fffa1,0xffa0ffa0,0xffa1ffa0,0xffb9ffab,0xffd8ffce,0xffc6ffce,0xffd0ffc9,0xffceffd2,
-0xffc4ffca,0x74b1ffbb,0x00000000,0x29820000,0xff82fb82,0xff8cff85,0xffa7ff93,0xffb5ffb2,0xff9dff9f,0xffa9ffa4,0xff9cffa1,0xff9aff9b,0xff9bff9b,0xffa3ff9b,0xffc6ffb0,0xffd5ffdb,0xffbcffbd,0xffbfffbd,0xffc1ffc0,0xffc4ffc2,0xffc6ffc5,0xffc8ffc7,0xffcaffc9,0xffc9ffca,0xffc6ffc8,0xffc4ffc5,0xffc1ffc2,0xffbdffbf,0xffbfffbd,0xffc2ffc0,0xffc5ffc4,0xffc8ffc7,
-0xffcbffc9,0xffcdffcc,0xffcdffce,0xffbdffb9,0xffadffb9,0xff9fffa5,0xff9fff9f,0xff9fff9f,0xffb1ffa3,0xffd5ffc1,0xffc7ffd6,0xffccffc5,0xffd2ffd3,0xffc9ffce,0xf9b8ffc2,0x000025ae,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x07820000,0xff82e982,0xff85ff82,0xffaaff8e,0xffb2ffb4,0xff96ff90,0xff9eff9e,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xffacff9c,0xffbdffce,0xffbdffbc,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc4ffc3,0xffc6ffc5,0xffc7ffc7,0xffc8ffc8,0xffc9ffc9,0xffc9ffc9,0xffc8ffc8,0xffc1ffc5,0xffbeffbe,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,
-0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffcfffce,0xffd0ffcf,0xffb4ffce,0xffa0ffa8,0xffa0ffa0,0xffa0ffa0,0xffa1ffa0,0xffa1ffa1,0xffa1ffa1,0xffadffa1,0xffcaffca,0xffc8ffc4,0xffcdffce,0xffc3ffc8,0xe5afffbb,0x000007a6,0x27820000,0xff82f982,0xff8bff84,0xffa5ff96,0xffb5ffb0,0xff9cff9d,0xffa5ffa3,0xff9cffa2,0xff9bff9b,0xff9bff9b,0xffa2ff9c,0xffc8ffb0,0xffd1ffda,
-0xffbcffbb,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcaffca,0xffcbffcb,0xffccffcc,0xffcbffcc,0xffc4ffc8,0xffbeffc0,0xffc0ffbf,0xffc2ffc1,0xffc5ffc3,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffceffcd,0xffcfffcf,0xffd1ffd0,0xffd2ffd2,0xffbfffc0,0xffb1ffb9,0xffa0ffa6,0xffa0ffa0,0xffa1ffa0,0xffb1ffa5,0xffd6ffc2,0xffcaffd4,0xffccffc6,
-0xffd1ffd3,0xffc7ffcc,0xfbb6ffc0,0x000029ac,0x03820000,0xff82cd82,0xff89ff84,0xff9eff90,0xffb5ffb1,0xff98ffa9,0xffa4ffa0,0xff9dffa4,0xff9bff9b,0xff9bff9b,0xff9eff9b,0xffc0ffad,0xffdaffd6,0xffbcffc0,0xffbeffbd,0xffc1ffbf,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcaffca,0xffcbffcb,0xffcbffcc,0xffc7ffc9,0xffc1ffc4,0xffbdffbe,0xffbfffbe,0xffc2ffc1,
-0xffc5ffc4,0xffc7ffc6,0xffcaffc9,0xffccffcb,0xffceffcd,0xffd0ffcf,0xffccffd1,0xffbeffbb,0xffabffb7,0xffa0ffa4,0xffa0ffa0,0xffa1ffa0,0xffb6ffa7,0xffd8ffca,0xffc6ffd0,0xffcdffc6,0xffcfffd1,0xffc6ffcb,0xd0b2ffbe,0x00000000,0x00000000,0xe1820d82,0xff86ff82,0xff95ff8e,0xffaeffa0,0xffb4ffb5,0xffadffa3,0xffb8ffb0,0xffbeffbe,0xffc3ffc0,0xffd2ffc8,0xffd9ffd6,
-0xffc9ffda,0xffbcffbb,0xffbfffbe,0xffc2ffc1,0xffc5ffc3,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffcdffcd,0xffcaffcc,0xffc7ffc9,0xffc2ffc4,0xffbfffc0,0xffc3ffc1,0xffc6ffc4,0xffc8ffc7,0xffcbffca,0xffcdffcc,0xffd0ffcf,0xffd2ffd1,0xffd3ffd3,0xffc7ffc7,0xffcdffc7,0xffccffd0,0xffceffcd,0xffdaffd4,0xffdcffdd,0xffccffd8,0xffccffc9,0xffd5ffd3,0xffcfffd2,
-0xffc2ffca,0x07b1dfb8,0x00000000,0x00000000,0xff829282,0xff8cff85,0xff9dff93,0xffb5ffa8,0xffa9ffb6,0xffadffaa,0xffbdffb6,0xffbfffbf,0xffc6ffc0,0xffd6ffce,0xffd9ffd9,0xffbdffd1,0xffbeffbc,0xffc0ffbf,0xffc3ffc2,0xffc6ffc4,0xffc8ffc7,0xffcaffc9,0xffccffcb,0xffcbffcc,0xffc9ffca,0xffc6ffc8,0xffc3ffc5,0xffc0ffc1,0xffc2ffc0,0xffc5ffc3,0xffc8ffc6,0xffcbffc9,
-0xffcdffcc,0xffd0ffcf,0xffd2ffd1,0xffbfffd0,0xffc9ffbf,0xffceffce,0xffcbffcd,0xffd5ffcf,0xffddffdb,0xffd5ffdb,0xffc6ffc8,0xffd5ffce,0xffd2ffd6,0xffc8ffce,0x98b5ffbf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff827482,0xff86ff82,0xff97ff8d,0xffb5ffac,0xff97ffb1,0xffa5ff9f,0xffa0ffa4,0xff9bff9c,0xff9bff9b,0xff9dff9b,0xffb6ffa6,0xffdcffcf,0xffbdffc8,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc8ffc7,0xffcaffc9,0xffcbffca,0xffcbffcb,0xffcbffcb,0xffcaffcb,0xffc4ffc8,0xffc2ffc2,0xffc3ffc2,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffcaffc9,
-0xffccffcb,0xffceffcd,0xffd0ffcf,0xffd2ffd1,0xffd3ffd2,0xffcbffd4,0xffbeffbe,0xffaaffb5,0xffa1ffa2,0xffa1ffa1,0xffa2ffa1,0xffbcffaa,0xffd6ffd1,0xffc7ffce,0xffd0ffca,0xffcdffd0,0xffc2ffc8,0x78aeffb9,0x00000000,0x00000000,0xff828c82,0xff8bff84,0xff9aff92,0xffb1ffa6,0xffa9ffb6,0xffacffa9,0xffbcffb5,0xffbfffbd,0xffc6ffc1,0xffd5ffcf,0xffdaffd8,0xffbdffd0,
-0xffbeffbd,0xffc1ffbf,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffccffcc,0xffcdffcd,0xffceffce,0xffcdffce,0xffc7ffca,0xffc1ffc3,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffcaffc9,0xffccffcb,0xffceffcd,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd5ffd5,0xffc4ffd5,0xffcbffc2,0xffd0ffd0,0xffceffce,0xffd5ffd0,0xffdcffdd,0xffd3ffda,0xffc9ffcb,0xffd5ffce,
-0xffd0ffd5,0xffc6ffcc,0x9ab3ffbd,0x00000000,0x00000000,0xfd823982,0xff89ff83,0xff97ff90,0xffb0ffa2,0xffafffb6,0xffa8ffa2,0xffb9ffb3,0xffbfffbd,0xffc4ffc1,0xffd4ffcb,0xffd9ffd6,0xffc1ffd6,0xffbdffbc,0xffc0ffbf,0xffc2ffc1,0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffccffcc,0xffceffcd,0xffceffce,0xffc9ffcc,0xffc3ffc7,0xffc0ffc0,0xffc2ffc1,0xffc5ffc4,
-0xffc8ffc6,0xffcaffc9,0xffcdffcb,0xffcfffce,0xffd1ffd0,0xffd3ffd2,0xffd4ffd4,0xffbfffcf,0xffccffc5,0xffcdffd1,0xffceffcc,0xffdaffd0,0xffdcffdd,0xffd1ffd8,0xffc9ffc9,0xffd4ffd0,0xffd0ffd3,0xffc5ffcb,0x43b1ffbb,0x00000000,0x00000000,0x3f820000,0xff86ff82,0xff95ff8d,0xffa5ff9b,0xffb4ffae,0xffb4ffb8,0xffb5ffb3,0xffc2ffb9,0xffcbffc7,0xffd1ffcf,0xffcbffd3,
-0xffbbffbf,0xffbeffbc,0xffc1ffc0,0xffc4ffc2,0xffc6ffc5,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffcfffce,0xffcfffcf,0xffcdffce,0xffc9ffcb,0xffc4ffc7,0xffc2ffc2,0xffc5ffc4,0xffc8ffc7,0xffcbffca,0xffceffcc,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd6ffd5,0xffd2ffd6,0xffceffcf,0xffd2ffcd,0xffd8ffd6,0xffd9ffd9,0xffd0ffd6,0xffc9ffcb,0xffd6ffd0,0xffd5ffd8,0xffceffd2,
-0xfbbeffc7,0x000047b4,0x00000000,0x00000000,0xe1820f82,0xff8bff84,0xff9aff93,0xffa7ff9c,0xffb7ffb1,0xffb1ffb3,0xffb8ffb4,0xffc6ffc0,0xffceffca,0xffd1ffd1,0xffc4ffcf,0xffbcffc1,0xffbfffbe,0xffc2ffc1,0xffc5ffc4,0xffc8ffc6,0xffcaffc9,0xffccffcb,0xffceffcd,0xffceffce,0xffcbffcd,0xffc9ffca,0xffc5ffc7,0xffc2ffc3,0xffc5ffc3,0xffc8ffc6,0xffcbffc9,0xffcdffcc,
-0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd5ffd5,0xffd0ffca,0xffcfffcf,0xffd6ffd3,0xffdaffd8,0xffd4ffd6,0xffcbffcf,0xffd2ffcb,0xffd6ffd6,0xffd1ffd5,0xffc5ffcc,0x0db2cfbc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xdf820782,0xff85ff82,0xff93ff8d,0xffadff9c,0xffb4ffb5,0xffacffa2,0xffb7ffaf,0xffbcffbd,0xffc3ffbf,0xffd2ffc9,0xffd9ffd6,0xffc8ffd9,0xffbeffbd,0xffc0ffbf,0xffc2ffc1,0xffc5ffc4,0xffc7ffc6,0xffc8ffc8,0xffcaffc9,0xffccffcb,0xffcdffcc,0xffcdffcd,0xffceffce,0xffcdffcd,0xffc7ffcb,0xffc5ffc5,0xffc6ffc5,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffcdffcc,
-0xffcfffce,0xffd1ffd0,0xffd2ffd1,0xffd4ffd3,0xffd5ffd5,0xffd6ffd6,0xffc9ffd2,0xffcfffc9,0xffcfffd1,0xffd0ffce,0xffdaffd3,0xffdbffdd,0xffcdffd6,0xffccffca,0xffd4ffd2,0xffcdffd1,0xffc0ffc8,0x09adddb5,0x00000000,0x00000000,0xd5820d82,0xff8aff84,0xff98ff91,0xffa8ff9e,0xffb7ffb3,0xffb0ffb3,0xffb5ffb2,0xffc4ffbe,0xffceffc9,0xffd3ffd0,0xffc5ffcf,0xffbdffbc,
-0xffbfffbe,0xffc2ffc1,0xffc4ffc3,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffceffce,0xffcfffcf,0xffd0ffd0,0xffcfffd0,0xffc9ffcd,0xffc4ffc5,0xffc6ffc5,0xffc8ffc7,0xffcaffc9,0xffccffcb,0xffcfffcd,0xffd1ffd0,0xffd3ffd2,0xffd4ffd3,0xffd6ffd5,0xffd8ffd6,0xffd9ffd8,0xffc8ffce,0xffd0ffcb,0xffd6ffd4,0xffdaffd9,0xffd2ffd6,0xffccffd0,0xffd2ffcc,0xffd6ffd6,
-0xffd0ffd4,0xffc4ffcb,0x0db0dfb9,0x00000000,0x00000000,0x98820000,0xff88ff82,0xff97ff90,0xffa7ff9d,0xffb6ffb1,0xffafffb7,0xffb3ffb0,0xffc3ffbd,0xffcdffc8,0xffd1ffd0,0xffc8ffd1,0xffbcffbc,0xffbfffbd,0xffc1ffc0,0xffc4ffc3,0xffc7ffc5,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffcfffce,0xffd0ffcf,0xffd0ffd0,0xffccffce,0xffc6ffc9,0xffc3ffc3,0xffc5ffc4,0xffc8ffc6,
-0xffcaffc9,0xffcdffcb,0xffcfffce,0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd6ffd6,0xffc9ffca,0xffd1ffca,0xffd8ffd5,0xffd9ffd9,0xffd3ffd8,0xffcbffce,0xffd4ffce,0xffd6ffd6,0xffcfffd3,0xffc1ffc9,0x000090b6,0x00000000,0x00000000,0x00000000,0xff857a82,0xff93ff8c,0xffa1ff9b,0xffadffa7,0xffb6ffb1,0xffb7ffb9,0xffbdffb8,0xffc2ffc0,0xffc6ffc5,0xffbbffc2,
-0xffbcffb9,0xffbfffbe,0xffc2ffc1,0xffc5ffc4,0xffc8ffc7,0xffcbffc9,0xffcdffcc,0xffcfffce,0xffd0ffd0,0xffd2ffd1,0xffcfffd1,0xffcbffcd,0xffc6ffc9,0xffc5ffc4,0xffc8ffc6,0xffcbffc9,0xffcdffcc,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd6ffd5,0xffd8ffd6,0xffd9ffd8,0xffcbffd5,0xffcbffc8,0xffceffcd,0xffceffcf,0xffcbffcb,0xffd5ffd0,0xffdaffd8,0xffd5ffd8,0xffcbffd1,
-0x74b9ffc1,0x00000000,0x00000000,0x00000000,0x2f820000,0xff89ef82,0xff99ff92,0xffa0ff9e,0xffadffa7,0xffb9ffb4,0xffb7ffb7,0xffbfffbc,0xffc5ffc2,0xffc6ffc6,0xffb9ffbf,0xffbdffbb,0xffc0ffbf,0xffc4ffc2,0xffc7ffc5,0xffc9ffc8,0xffccffcb,0xffceffcd,0xffd0ffcf,0xffd0ffd1,0xffceffcf,0xffcbffcc,0xffc7ffc9,0xffc4ffc5,0xffc7ffc5,0xffcaffc9,0xffcdffcc,0xffd0ffce,
-0xffd2ffd1,0xffd4ffd3,0xffd6ffd5,0xffd8ffd6,0xffd5ffd8,0xffc9ffcc,0xffcdffcc,0xffcfffce,0xffc9ffcd,0xffd1ffcc,0xffd8ffd5,0xffd6ffd8,0xffcfffd4,0xf3c0ffc9,0x00002fb8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x3d820000,0xff85fb82,0xff93ff8c,0xffa3ff9a,0xffb3ffac,0xffb3ffb7,0xffb4ffb2,0xffc0ffb8,0xffcbffc6,0xffd0ffce,0xffceffd0,0xffbdffc3,0xffbfffbe,0xffc2ffc0,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffcaffc9,0xffccffcb,0xffcdffcd,0xffcfffce,0xffcfffcf,0xffd0ffd0,0xffcfffcf,0xffcaffcd,0xffc8ffc8,0xffc8ffc8,0xffcaffc9,0xffcbffca,0xffcdffcc,0xffcfffce,
-0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,0xffd6ffd5,0xffd8ffd6,0xffd9ffd8,0xffd4ffd9,0xffcfffca,0xffd3ffce,0xffd9ffd6,0xffd8ffd9,0xffd0ffd4,0xffcaffcb,0xffd6ffd0,0xffd4ffd6,0xffccffd1,0xfdbcffc6,0x000041b2,0x00000000,0x00000000,0x29820000,0xff88f182,0xff98ff90,0xffa4ff9e,0xffb3ffac,0xffb9ffb7,0xffb5ffb5,0xffbeffbb,0xffc4ffc1,0xffc2ffc6,0xffbeffbf,0xffbeffbd,
-0xffc1ffbf,0xffc3ffc2,0xffc6ffc4,0xffc8ffc7,0xffcbffc9,0xffcdffcc,0xffcfffce,0xffd0ffcf,0xffd1ffd1,0xffd2ffd2,0xffd1ffd2,0xffcbffcf,0xffc7ffc8,0xffc8ffc8,0xffcaffc9,0xffccffcb,0xffcfffcd,0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd8ffd6,0xffd9ffd9,0xffdaffda,0xffd0ffd6,0xffcaffc4,0xffceffcc,0xffd0ffcf,0xffcbffce,0xffd3ffcd,0xffd9ffd6,0xffd6ffd9,
-0xffceffd3,0xedbeffc8,0x000031b5,0x00000000,0x00000000,0x05820000,0xff86c582,0xff96ff8e,0xffa3ff9d,0xffb1ffaa,0xffb9ffb7,0xffb4ffb5,0xffbeffb9,0xffc3ffc1,0xffc6ffc6,0xffbdffc2,0xffbdffbb,0xffc0ffbe,0xffc3ffc1,0xffc5ffc4,0xffc8ffc7,0xffcbffc9,0xffcdffcc,0xffcfffce,0xffd0ffcf,0xffd2ffd1,0xffd2ffd2,0xffceffd1,0xffc8ffcb,0xffc5ffc5,0xffc8ffc6,0xffcaffc9,
-0xffcdffcb,0xffcfffce,0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd9ffd8,0xffdaffd9,0xffcdffd6,0xffcaffc5,0xffceffcd,0xffcfffcf,0xffc9ffcb,0xffd4ffcf,0xffdaffd8,0xffd5ffd8,0xffcdffd2,0xc7bbffc5,0x000007b3,0x00000000,0x00000000,0x00000000,0x87820182,0xff91ff89,0xffa0ff99,0xffa7ffa5,0xffadffa8,0xffb8ffb3,0xffbfffbe,0xffc1ffc0,0xffc7ffc3,0xffbcffc7,
-0xffbdffbb,0xffc0ffbe,0xffc3ffc2,0xffc6ffc5,0xffc9ffc8,0xffccffcb,0xffceffcd,0xffd0ffcf,0xffd2ffd1,0xffd3ffd3,0xffd1ffd3,0xffcdffcf,0xffc8ffcb,0xffc7ffc6,0xffcaffc9,0xffcdffcb,0xffcfffce,0xffd2ffd1,0xffd4ffd3,0xffd6ffd5,0xffd8ffd6,0xffdaffd9,0xffdbffda,0xffcfffd6,0xffcdffcc,0xffcdffcc,0xffd1ffce,0xffd6ffd4,0xffdaffd9,0xffd9ffda,0xffd3ffd6,0xffc5ffce,
-0x01b487bc,0x00000000,0x00000000,0x00000000,0x00000000,0xf3864582,0xff97ff8f,0xff9eff9c,0xffa2ffa0,0xffb1ffaa,0xffbdffb2,0xffc0ffc0,0xffc2ffc0,0xffc2ffc5,0xffb9ffbb,0xffbeffbc,0xffc2ffc0,0xffc5ffc3,0xffc8ffc6,0xffcbffc9,0xffcdffcc,0xffd0ffce,0xffd2ffd1,0xffd2ffd2,0xffd0ffd1,0xffcdffce,0xffc9ffcb,0xffc6ffc7,0xffc9ffc8,0xffccffcb,0xffcfffce,0xffd2ffd1,
-0xffd4ffd3,0xffd6ffd5,0xffd8ffd6,0xffdaffd9,0xffd6ffda,0xffccffd0,0xffccffcc,0xffcfffcd,0xffd4ffd2,0xffd9ffd6,0xffd8ffd9,0xffd5ffd6,0xffcbffd1,0x3dbcf3c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xff837382,0xff92ff8a,0xffa0ff99,0xffadffa5,0xffb8ffb4,0xffb7ffb9,0xffbcffb7,0xffc2ffbf,0xffc5ffc4,0xffbeffc2,0xffbeffbd,0xffc0ffbf,0xffc3ffc1,0xffc5ffc4,0xffc7ffc6,0xffcaffc9,0xffccffcb,0xffceffcd,0xffcfffce,0xffd0ffd0,0xffd1ffd1,0xffd1ffd1,0xffd0ffd1,0xffccffcf,0xffcaffcb,0xffcbffca,0xffccffcb,0xffcdffcd,0xffcfffce,0xffd1ffd0,
-0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd8ffd6,0xffd9ffd9,0xffdaffda,0xffdbffdb,0xffcdffd6,0xffccffc9,0xffcfffce,0xffcfffd0,0xffcbffcc,0xffd4ffcf,0xffd9ffd8,0xffd3ffd6,0xffc9ffcf,0x76b8ffc0,0x00000000,0x00000000,0x00000000,0x00000000,0xf3854382,0xff96ff8d,0xffa3ff9d,0xffaeffa9,0xffb9ffb5,0xffbcffb9,0xffbfffbf,0xffc2ffc0,0xffc2ffc5,0xffbfffbf,0xffbfffbd,
-0xffc1ffc0,0xffc4ffc3,0xffc7ffc5,0xffc9ffc8,0xffccffcb,0xffceffcd,0xffd0ffcf,0xffd1ffd1,0xffd3ffd2,0xffd3ffd3,0xffd3ffd4,0xffcdffd1,0xffc9ffca,0xffcbffca,0xffccffcb,0xffceffcd,0xffd0ffcf,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd8ffd6,0xffdaffd9,0xffdbffda,0xffdcffdb,0xffd4ffd8,0xffceffd1,0xffcdffcd,0xffd0ffcd,0xffd5ffd3,0xffdbffd8,0xffdaffdb,0xffd5ffd8,
-0xffcaffd0,0x41b9f3c1,0x00000000,0x00000000,0x00000000,0x00000000,0xd3830d82,0xff93ff8a,0xffa2ff9b,0xffadffa8,0xffb5ffb2,0xffb9ffb5,0xffbfffbf,0xffc2ffc0,0xffc5ffc4,0xffbdffc1,0xffbeffbc,0xffc1ffbf,0xffc4ffc2,0xffc7ffc5,0xffc9ffc8,0xffccffcb,0xffceffcd,0xffd0ffcf,0xffd2ffd1,0xffd3ffd2,0xffd4ffd4,0xffd0ffd3,0xffc9ffcd,0xffc8ffc7,0xffcaffc9,0xffccffcb,
-0xffcfffcd,0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd9ffd8,0xffdaffda,0xffdbffdb,0xffd3ffd6,0xffcdffd0,0xffcdffcc,0xffd1ffce,0xffd5ffd4,0xffdcffd9,0xffd9ffdb,0xffd3ffd6,0xffc8ffcf,0x11b8c3bf,0x00000000,0x00000000,0x00000000,0x00000000,0x01820000,0xfd8c7284,0xff9eff96,0xffa5ffa3,0xffa7ffa6,0xffb0ffa9,0xffb9ffb7,0xffbcffb9,0xffb9ffbf,0xffb9ffb8,
-0xffbdffbc,0xffc1ffbf,0xffc4ffc3,0xffc7ffc6,0xffcaffc9,0xffcdffcc,0xffcfffce,0xffd2ffd1,0xffd4ffd3,0xffd5ffd4,0xffd3ffd4,0xffceffd1,0xffc9ffcc,0xffc9ffc8,0xffccffcb,0xffcfffcd,0xffd1ffd0,0xffd4ffd2,0xffd6ffd5,0xffd8ffd6,0xffdaffd9,0xffdbffda,0xffdcffdb,0xffd9ffdc,0xffd8ffd6,0xffd8ffd8,0xffdbffd9,0xffdbffdb,0xffd9ffda,0xffd6ffd8,0xffceffd3,0x78bffbc7,
-0x000001b9,0x00000000,0x00000000,0x00000000,0x00000000,0x39830000,0xff93e78a,0xff9bff98,0xffa0ff9e,0xffa5ffa3,0xffadffa8,0xffb9ffb2,0xffbdffbb,0xffb8ffb9,0xffbbffb9,0xffbfffbd,0xffc2ffc1,0xffc6ffc4,0xffc9ffc7,0xffccffca,0xffcfffcd,0xffd1ffd0,0xffd3ffd2,0xffd4ffd4,0xffd1ffd3,0xffceffd0,0xffcbffcd,0xffc8ffc9,0xffcbffca,0xffceffcd,0xffd1ffd0,0xffd4ffd2,
-0xffd6ffd5,0xffd8ffd6,0xffdaffd9,0xffdbffda,0xffdcffdb,0xffd8ffda,0xffd8ffd6,0xffdaffd8,0xffdbffdb,0xffd9ffda,0xffd6ffd8,0xffd1ffd4,0xebc4ffcc,0x00003bbc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x8e820000,0xff90ff87,0xff9eff98,0xffaaffa5,0xffb6ffb0,0xffb7ffb9,0xffbfffb9,0xffc1ffbf,0xffc7ffc3,0xffbeffc4,0xffbfffbd,0xffc1ffc0,0xffc3ffc2,0xffc6ffc5,0xffc8ffc7,0xffcbffca,0xffcdffcc,0xffcfffce,0xffd0ffd0,0xffd2ffd1,0xffd2ffd2,0xffd3ffd3,0xffd2ffd2,0xffceffd0,0xffcdffcd,0xffcdffcd,0xffceffcd,0xffcfffcf,0xffd1ffd0,0xffd3ffd2,
-0xffd5ffd4,0xffd6ffd6,0xffd8ffd6,0xffdaffd9,0xffdbffda,0xffdcffdb,0xffdcffdc,0xffd0ffd8,0xffcdffc8,0xffceffcd,0xffd1ffcf,0xffd6ffd3,0xffdaffd9,0xffd8ffda,0xffd1ffd5,0xffc4ffcc,0x01b58ebb,0x00000000,0x00000000,0x00000000,0x00000000,0x3b820000,0xff92e788,0xffa1ff9a,0xffadffa7,0xffb5ffb2,0xffb8ffb5,0xffbcffbb,0xffbfffbd,0xffbfffc2,0xffbcffbb,0xffbfffbd,
-0xffc2ffc0,0xffc5ffc3,0xffc8ffc6,0xffcaffc9,0xffcdffcb,0xffcfffce,0xffd1ffd0,0xffd3ffd2,0xffd4ffd3,0xffd5ffd4,0xffd5ffd5,0xffceffd2,0xffcbffcc,0xffccffcc,0xffceffcd,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd6ffd5,0xffd8ffd6,0xffd9ffd9,0xffdbffda,0xffdcffdb,0xffddffdc,0xffddffdd,0xffd9ffdb,0xffd8ffd8,0xffd9ffd8,0xffdcffdb,0xffdbffdc,0xffd8ffda,0xffd1ffd5,
-0xe3c3ffcb,0x00002fbd,0x00000000,0x00000000,0x00000000,0x00000000,0x0d820000,0xff8fb186,0xff9fff98,0xffabffa6,0xffaeffae,0xffb3ffae,0xffb9ffb9,0xffbeffbc,0xffc1ffc1,0xffbbffbd,0xffbeffbc,0xffc1ffc0,0xffc4ffc3,0xffc7ffc6,0xffcaffc9,0xffcdffcc,0xffcfffce,0xffd1ffd0,0xffd3ffd2,0xffd4ffd4,0xffd5ffd5,0xffd2ffd4,0xffcbffce,0xffcaffc9,0xffccffcb,0xffceffcd,
-0xffd0ffcf,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd9ffd8,0xffdaffd9,0xffdbffdb,0xffdcffdc,0xffddffdd,0xffd8ffdb,0xffd8ffd8,0xffdbffd8,0xffdbffdc,0xffdaffdb,0xffd6ffd9,0xffcfffd4,0xb9c0ffc8,0x000015b9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x43890000,0xff99e78f,0xffa1ff9f,0xffa5ffa3,0xffa9ffa7,0xffadffab,0xffb2ffb0,0xffb6ffb4,0xffb9ffb8,
-0xffbeffbc,0xffc1ffbf,0xffc5ffc3,0xffc8ffc6,0xffcbffca,0xffceffcc,0xffd0ffcf,0xffd3ffd2,0xffd4ffd4,0xffd6ffd5,0xffd4ffd6,0xffd0ffd2,0xffcbffcd,0xffcbffca,0xffceffcc,0xffd0ffcf,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffddffdc,0xffddffdd,0xffddffdd,0xffddffdd,0xffdbffdc,0xffd9ffda,0xffd6ffd8,0xffd1ffd4,0xe1c5ffcc,0x000041c0,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb98d1987,0xff97ff91,0xff9eff9b,0xffa4ffa1,0xffa9ffa6,0xffaeffac,0xffb3ffb0,0xffb7ffb5,0xffbbffb9,0xffbfffbd,0xffc3ffc1,0xffc7ffc5,0xffcaffc8,0xffcdffcb,0xffd0ffce,0xffd2ffd1,0xffd4ffd3,0xffd5ffd5,0xffd3ffd4,0xffd0ffd1,0xffccffce,0xffcaffca,0xffcdffcc,0xffd0ffcf,0xffd3ffd1,0xffd5ffd4,
-0xffd6ffd6,0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffddffdc,0xffddffdd,0xffddffdd,0xffdcffdc,0xffdaffdb,0xffd6ffd9,0xffd3ffd5,0xffc9ffcf,0x19beb7c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x01820000,0xfd8b7683,0xff9cff93,0xffa9ffa3,0xffb3ffae,0xffb7ffb8,0xffbeffb9,0xffc0ffbf,0xffc5ffc2,0xffbcffc1,0xffbfffbd,0xffc1ffc0,0xffc4ffc3,0xffc6ffc5,0xffc9ffc8,0xffcbffca,0xffceffcd,0xffd0ffcf,0xffd1ffd0,0xffd3ffd2,0xffd3ffd3,0xffd4ffd4,0xffd3ffd3,0xffd0ffd2,0xffcfffcf,0xffcfffcf,0xffd0ffcf,0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,
-0xffd6ffd5,0xffd8ffd6,0xffd9ffd9,0xffdbffda,0xffdcffdb,0xffdcffdc,0xffddffdd,0xffddffdd,0xffd8ffdc,0xffd8ffd8,0xffdaffd9,0xffdcffdb,0xffdaffdb,0xffd6ffd8,0xffcdffd2,0x71bdffc5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb78c1585,0xff9dff93,0xffaaffa4,0xffb3ffb0,0xffb2ffb2,0xffb4ffb3,0xffb6ffb5,0xffb9ffb7,0xffbcffb9,0xffbfffbd,
-0xffc2ffc0,0xffc5ffc3,0xffc8ffc6,0xffcbffc9,0xffcdffcc,0xffd0ffce,0xffd2ffd1,0xffd3ffd2,0xffd5ffd4,0xffd5ffd5,0xffd6ffd6,0xffd0ffd4,0xffcdffcd,0xffceffcd,0xffd0ffcf,0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd9ffd8,0xffdaffda,0xffdcffdb,0xffdcffdc,0xffddffdd,0xffddffdd,0xffddffdd,0xffdcffdd,0xffdcffdc,0xffdaffdb,0xffd8ffda,0xffd4ffd6,0xffc8ffd0,
-0x19bcb9c2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7a8a0582,0xff9bfb92,0xffa8ffa3,0xffabffaa,0xffadffac,0xffb0ffaf,0xffb4ffb2,0xffb7ffb5,0xffbbffb9,0xffbeffbc,0xffc2ffc0,0xffc5ffc3,0xffc8ffc6,0xffcbffc9,0xffceffcc,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd5ffd5,0xffd6ffd6,0xffd3ffd5,0xffccffd0,0xffcbffcb,0xffcdffcc,0xffd0ffcf,
-0xffd2ffd1,0xffd4ffd3,0xffd6ffd5,0xffd8ffd6,0xffdaffd9,0xffdbffdb,0xffdcffdc,0xffddffdd,0xffddffdd,0xffddffdd,0xffddffdd,0xffdbffdc,0xffdaffdb,0xffd8ffd9,0xffd3ffd6,0xfbc7ffce,0x05bb84c1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7a930d8b,0xff9bf997,0xffa2ff9f,0xffa7ffa4,0xffacffaa,0xffb1ffae,0xffb5ffb3,0xffb9ffb7,
-0xffbeffbc,0xffc1ffbf,0xffc5ffc3,0xffc8ffc7,0xffccffca,0xffceffcd,0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd5ffd6,0xffd1ffd3,0xffccffce,0xffcdffcb,0xffcfffce,0xffd2ffd0,0xffd4ffd3,0xffd6ffd5,0xffd8ffd6,0xffdaffd9,0xffdbffdb,0xffdcffdc,0xffddffdd,0xffddffdd,0xffddffdd,0xffdcffdc,0xffdaffdb,0xffd6ffd8,0xffd2ffd5,0xf7c8ffce,0x0fbe84c4,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01880000,0xf18f628b,0xff9aff95,0xffa2ff9e,0xffa8ffa5,0xffadffaa,0xffb2ffb0,0xffb7ffb5,0xffbbffb9,0xffbfffbd,0xffc3ffc1,0xffc7ffc5,0xffcaffc9,0xffcdffcc,0xffd0ffcf,0xffd3ffd1,0xffd5ffd4,0xffd6ffd6,0xffd4ffd5,0xffd1ffd2,0xffcdffcf,0xffccffcb,0xffcfffcd,0xffd1ffd0,0xffd4ffd3,0xffd6ffd5,
-0xffd8ffd6,0xffdaffd9,0xffdcffdb,0xffddffdc,0xffddffdd,0xffddffdd,0xffddffdd,0xffdbffdc,0xffd9ffda,0xffd4ffd6,0xffcdffd1,0x64c1f5c7,0x000001bf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x45860000,0xff97e18e,0xffa6ff9f,0xffb1ffac,0xffb9ffb6,0xffb8ffb9,0xffb8ffb8,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffc1ffc0,0xffc4ffc2,0xffc7ffc5,0xffc9ffc8,0xffccffcb,0xffceffcd,0xffd0ffcf,0xffd2ffd1,0xffd3ffd3,0xffd4ffd4,0xffd4ffd4,0xffd3ffd4,0xffd2ffd2,0xffd0ffd1,0xffd0ffd0,0xffd1ffd0,0xffd2ffd2,0xffd4ffd3,0xffd6ffd5,
-0xffd6ffd6,0xffd9ffd8,0xffdaffd9,0xffdbffdb,0xffdcffdc,0xffddffdc,0xffddffdd,0xffddffdd,0xffdcffdd,0xffdcffdc,0xffdbffdb,0xffdaffda,0xffd6ffd8,0xffd1ffd5,0xe1c4ffcc,0x00004dbd,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01870000,0xe1965a8f,0xffa6ff9e,0xffafffac,0xffafffaf,0xffb1ffb0,0xffb4ffb3,0xffb7ffb6,0xffbbffb9,0xffbeffbd,
-0xffc2ffc0,0xffc5ffc3,0xffc8ffc6,0xffcbffc9,0xffcdffcc,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd5ffd4,0xffd6ffd5,0xffd6ffd6,0xffd0ffd4,0xffceffce,0xffcfffcf,0xffd1ffd0,0xffd2ffd1,0xffd4ffd3,0xffd6ffd5,0xffd8ffd6,0xffd9ffd9,0xffdbffda,0xffdcffdb,0xffdcffdc,0xffddffdd,0xffddffdd,0xffdcffdc,0xffdbffdc,0xffd9ffda,0xffd6ffd8,0xffd3ffd5,0xffcbffd0,0x52c1ddc6,
-0x000003b9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb8932f8d,0xffa2ff9d,0xffa7ffa5,0xffaaffa9,0xffaeffac,0xffb2ffb0,0xffb6ffb4,0xffb9ffb8,0xffbeffbc,0xffc1ffc0,0xffc5ffc3,0xffc8ffc7,0xffcbffca,0xffceffcd,0xffd0ffcf,0xffd3ffd2,0xffd4ffd4,0xffd6ffd5,0xffd6ffd6,0xffd4ffd6,0xffcdffd0,0xffcdffcc,0xffcfffce,0xffd1ffd0,
-0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd9ffd8,0xffdaffda,0xffdcffdb,0xffddffdc,0xffddffdd,0xffddffdd,0xffddffdd,0xffdbffdc,0xffd9ffdb,0xffd6ffd8,0xffd2ffd5,0xfdcaffcf,0x2bc0c2c4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xa2931b90,0xff9cfd97,0xffa4ffa0,0xffaaffa7,0xffafffad,0xffb4ffb2,0xffb9ffb7,
-0xffbdffbb,0xffc1ffbf,0xffc5ffc3,0xffc8ffc7,0xffccffca,0xffcfffcd,0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd6ffd6,0xffd1ffd4,0xffccffcf,0xffceffcc,0xffd0ffcf,0xffd2ffd1,0xffd5ffd4,0xffd6ffd6,0xffd9ffd8,0xffdaffda,0xffdcffdb,0xffddffdc,0xffddffdd,0xffddffdd,0xffdcffdc,0xffdaffdb,0xffd6ffd9,0xffd2ffd5,0xfdc9ffce,0x1fc0a0c4,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1f8a0000,0xff93c18e,0xff9eff99,0xffa5ffa2,0xffacffa9,0xffb1ffae,0xffb6ffb4,0xffbbffb9,0xffbfffbd,0xffc3ffc1,0xffc7ffc5,0xffcaffc9,0xffceffcc,0xffd1ffcf,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd5ffd6,0xffd1ffd3,0xffcdffd0,0xffcdffcc,0xffd0ffce,0xffd2ffd1,0xffd5ffd4,0xffd6ffd6,
-0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffddffdd,0xffddffdd,0xffddffdd,0xffdcffdc,0xffdaffdb,0xffd6ffd8,0xffcfffd3,0xc1c4ffc9,0x000021be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x90910f8a,0xffa1f799,0xffaeffa8,0xffb6ffb3,0xffb5ffb6,0xffb6ffb6,0xffb8ffb7,0xffb9ffb9,0xffbdffbc,0xffc0ffbf,0xffc3ffc2,0xffc6ffc5,0xffc9ffc8,0xffccffca,0xffceffcd,0xffd0ffcf,0xffd2ffd1,0xffd3ffd3,0xffd4ffd4,0xffd4ffd4,0xffd3ffd4,0xffd2ffd3,0xffd1ffd2,0xffd1ffd1,0xffd2ffd1,0xffd3ffd2,0xffd4ffd4,0xffd6ffd5,
-0xffd8ffd6,0xffd9ffd8,0xffdaffda,0xffdbffdb,0xffdcffdc,0xffdcffdc,0xffdcffdc,0xffdcffdc,0xffdbffdb,0xffdaffda,0xffd8ffd9,0xffd5ffd6,0xffd1ffd4,0xf9c8ffcd,0x0fbc86c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x09910000,0xb89f5698,0xffa7fba5,0xffabffa9,0xffaeffac,0xffb2ffb0,0xffb6ffb4,0xffb9ffb8,0xffbdffbb,
-0xffc1ffbf,0xffc4ffc3,0xffc7ffc6,0xffcaffc9,0xffcdffcc,0xffd0ffce,0xffd2ffd1,0xffd3ffd3,0xffd5ffd4,0xffd6ffd5,0xffd6ffd6,0xffd1ffd4,0xffcfffcf,0xffd0ffcf,0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd8ffd6,0xffd9ffd9,0xffdbffda,0xffdbffdb,0xffdcffdc,0xffdcffdc,0xffdbffdc,0xffdaffdb,0xffd8ffd9,0xffd5ffd6,0xffd0ffd3,0xfdcaffcd,0x5cc2c2c6,0x000007be,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x9e9b3196,0xffa0f59d,0xffa7ffa4,0xffacffa9,0xffb0ffae,0xffb5ffb2,0xffb9ffb7,0xffbdffbb,0xffc1ffbf,0xffc5ffc3,0xffc8ffc6,0xffcbffca,0xffceffcc,0xffd0ffcf,0xffd3ffd2,0xffd5ffd4,0xffd6ffd5,0xffd6ffd6,0xffd4ffd6,0xffceffd1,0xffceffcd,0xffcfffcf,0xffd1ffd0,
-0xffd4ffd3,0xffd6ffd5,0xffd8ffd6,0xffd9ffd8,0xffdbffda,0xffdcffdb,0xffdcffdc,0xffddffdc,0xffdcffdc,0xffdbffdc,0xffd9ffda,0xffd6ffd8,0xffd1ffd4,0xfbc8ffcd,0x33c19ac6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb5932f90,0xff9eff98,0xffa7ffa3,0xffadffaa,0xffb2ffb0,0xffb7ffb5,
-0xffbcffb9,0xffc0ffbe,0xffc4ffc2,0xffc8ffc6,0xffcbffca,0xffceffcd,0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd6ffd6,0xffd1ffd4,0xffcdffce,0xffceffcd,0xffd1ffcf,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd9ffd8,0xffdaffda,0xffdbffdb,0xffdcffdc,0xffdcffdc,0xffdbffdc,0xffdaffdb,0xffd6ffd9,0xffd3ffd5,0xffc8ffcf,0x2fbfadc5,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x668d018a,0xff98e793,0xffa2ff9e,0xffa9ffa6,0xffafffad,0xffb5ffb2,0xffb9ffb8,0xffbfffbc,0xffc3ffc1,0xffc7ffc5,0xffcaffc9,0xffceffcc,0xffd1ffcf,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd5ffd6,0xffd2ffd3,0xffceffd0,0xffceffcd,0xffd0ffcf,0xffd3ffd2,0xffd5ffd4,0xffd8ffd6,
-0xffd9ffd9,0xffdbffda,0xffdcffdb,0xffddffdc,0xffdcffdd,0xffdcffdc,0xffdaffdb,0xffd6ffd9,0xffd1ffd4,0xedc6ffcc,0x01bd5ac3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7e9a1193,0xffa6dfa0,0xffb0ffad,0xffb1ffb0,0xffb3ffb2,0xffb5ffb4,0xffb8ffb7,0xffbcffb9,0xffbfffbd,0xffc2ffc1,0xffc5ffc4,0xffc8ffc7,0xffcbffca,0xffcdffcc,0xffd0ffcf,0xffd1ffd1,0xffd3ffd2,0xffd4ffd3,0xffd4ffd4,0xffd3ffd4,0xffd3ffd3,0xffd2ffd3,0xffd1ffd1,0xffd2ffd2,0xffd3ffd3,0xffd5ffd4,0xffd6ffd5,
-0xffd8ffd6,0xffd9ffd8,0xffdaffd9,0xffdbffda,0xffdbffdb,0xffdbffdb,0xffdbffdb,0xffdaffda,0xffd8ffd9,0xffd5ffd6,0xffd2ffd4,0xffcdffd0,0xdbc7ffc8,0x1bbf7ec3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x689f1f9d,0xffa2c2a0,0xffa9ffa6,0xffaeffac,0xffb3ffb1,0xffb7ffb5,0xffbbffb9,
-0xffbfffbd,0xffc3ffc1,0xffc6ffc5,0xffc9ffc8,0xffccffcb,0xffcfffce,0xffd1ffd0,0xffd3ffd2,0xffd4ffd3,0xffd5ffd5,0xffd5ffd5,0xffd1ffd4,0xffcfffd0,0xffd0ffd0,0xffd1ffd0,0xffd3ffd2,0xffd4ffd4,0xffd6ffd5,0xffd8ffd6,0xffd9ffd8,0xffdaffd9,0xffdaffda,0xffdaffdb,0xffdaffda,0xffd9ffda,0xffd6ffd8,0xffd3ffd5,0xffcdffd1,0xbcc6fbca,0x19bf6cc3,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7a991b95,0xffa0e99c,0xffa7ffa4,0xffadffaa,0xffb3ffb0,0xffb7ffb5,0xffbcffb9,0xffc0ffbe,0xffc4ffc2,0xffc7ffc5,0xffcaffc9,0xffcdffcc,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd6ffd5,0xffd6ffd6,0xffd4ffd6,0xffceffd1,0xffceffcd,0xffd0ffcf,0xffd2ffd1,
-0xffd4ffd3,0xffd6ffd5,0xffd8ffd6,0xffd9ffd8,0xffdaffda,0xffdbffdb,0xffdbffdb,0xffdbffdb,0xffdaffdb,0xffd8ffd9,0xffd5ffd6,0xffd0ffd3,0xe5c8ffcc,0x21be76c5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x018c0000,0xbe964092,0xffa1ff9c,0xffa9ffa5,0xffb0ffad,0xffb5ffb3,
-0xffb9ffb8,0xffbfffbd,0xffc3ffc1,0xffc7ffc5,0xffcaffc9,0xffceffcc,0xffd0ffcf,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd6ffd6,0xffd1ffd3,0xffccffce,0xffceffcd,0xffd0ffcf,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd8ffd8,0xffdaffd9,0xffdaffda,0xffdbffdb,0xffdaffdb,0xffd9ffda,0xffd6ffd8,0xffd2ffd5,0xffcbffcf,0x3ac1c0c5,0x000001b9,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x9a91178d,0xff9dfd97,0xffa6ffa2,0xffadffaa,0xffb3ffb0,0xffb9ffb6,0xffbdffbb,0xffc2ffc0,0xffc6ffc4,0xffcaffc8,0xffcdffcb,0xffd0ffcf,0xffd3ffd1,0xffd5ffd4,0xffd6ffd6,0xffd5ffd6,0xffd1ffd3,0xffcdffcf,0xffceffcd,0xffd1ffcf,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,
-0xffd9ffd8,0xffdaffda,0xffdbffdb,0xffdcffdb,0xffdbffdb,0xffdaffda,0xffd6ffd8,0xffd2ffd5,0xfbc9ffce,0x13be94c4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2ca00399,0xa8a76ca6,0xffa9e0a7,0xffadffab,0xffb1ffaf,0xffb5ffb3,0xffb9ffb7,0xffbdffbb,0xffc0ffbf,0xffc4ffc2,0xffc7ffc5,0xffcaffc8,0xffccffcb,0xffcfffcd,0xffd0ffcf,0xffd2ffd1,0xffd3ffd2,0xffd3ffd3,0xffd2ffd2,0xffd3ffd2,0xffd2ffd3,0xffd1ffd1,0xffd2ffd1,0xffd3ffd2,0xffd4ffd3,0xffd5ffd5,
-0xffd6ffd6,0xffd8ffd6,0xffd9ffd8,0xffd9ffd9,0xffd9ffd9,0xffd9ffd9,0xffd8ffd8,0xffd6ffd6,0xffd2ffd4,0xffcdffd0,0xe9c7ffc9,0x74c3a8c5,0x03bb30c0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1d9a0000,0xd2a0749d,0xffa7ffa4,0xffaeffab,0xffb4ffb1,0xffb9ffb6,
-0xffbdffbb,0xffc1ffbf,0xffc5ffc3,0xffc8ffc6,0xffcbffc9,0xffcdffcc,0xffd0ffcf,0xffd1ffd1,0xffd3ffd2,0xffd3ffd3,0xffd3ffd4,0xffd0ffd2,0xffcfffcf,0xffcfffcf,0xffd0ffd0,0xffd2ffd1,0xffd3ffd3,0xffd5ffd4,0xffd6ffd6,0xffd6ffd6,0xffd8ffd8,0xffd8ffd8,0xffd8ffd8,0xffd6ffd6,0xffd5ffd6,0xffd1ffd3,0xffcaffce,0x7ac3d4c6,0x00001bc0,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x66980595,0xff9fd39b,0xffa8ffa5,0xffafffac,0xffb5ffb2,0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc6ffc4,0xffc9ffc8,0xffccffcb,0xffcfffce,0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,0xffd6ffd5,0xffd3ffd5,0xffcdffd0,0xffceffcd,0xffcfffcf,0xffd1ffd0,
-0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,0xffd8ffd8,0xffd9ffd9,0xffdaffd9,0xffdaffda,0xffd9ffd9,0xffd6ffd8,0xffd4ffd6,0xffcfffd2,0xd7c6ffc9,0x05c05ac3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb2993d95,0xffa3fd9e,0xffacffa8,0xffb2ffaf,
-0xffb8ffb5,0xffbdffb9,0xffc1ffbf,0xffc5ffc3,0xffc9ffc7,0xffccffcb,0xffcfffce,0xffd1ffd0,0xffd3ffd2,0xffd5ffd4,0xffd5ffd6,0xffd0ffd2,0xffccffcd,0xffceffcd,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd6ffd5,0xffd6ffd6,0xffd8ffd8,0xffd9ffd9,0xffd9ffd9,0xffd6ffd8,0xffd5ffd6,0xffd1ffd3,0xfdcaffce,0x41c0b4c5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb8952b90,0xffa1ff9b,0xffa9ffa5,0xffb0ffad,0xffb6ffb3,0xffbcffb9,0xffc0ffbe,0xffc5ffc3,0xffc9ffc7,0xffccffca,0xffcfffce,0xffd2ffd1,0xffd4ffd3,0xffd6ffd5,0xffd4ffd6,0xffd1ffd2,0xffcdffcf,0xffceffcc,0xffd0ffcf,0xffd3ffd2,0xffd5ffd4,0xffd6ffd6,
-0xffd8ffd8,0xffd9ffd9,0xffdaffda,0xffdaffda,0xffd9ffd9,0xffd6ffd8,0xffd2ffd4,0xfdcaffce,0x33c0b4c5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2ba00000,0xc0a474a2,0xffaafba7,0xffb0ffad,0xffb5ffb2,0xffb9ffb7,0xffbeffbc,0xffc1ffbf,0xffc5ffc3,0xffc8ffc6,0xffcaffc9,0xffcdffcc,0xffceffce,0xffd0ffcf,0xffd1ffd0,0xffd1ffd1,0xffd0ffd0,0xffd2ffd0,0xffd1ffd2,0xffd0ffd0,0xffd0ffd0,0xffd1ffd1,0xffd3ffd2,0xffd4ffd3,
-0xffd5ffd4,0xffd6ffd5,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd5ffd6,0xffd3ffd4,0xffcfffd1,0xfbc8ffcc,0x7ac2c2c6,0x05bc36bf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x82a02b9b,0xffa5d9a2,0xffaeffaa,0xffb4ffb1,
-0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc5ffc4,0xffc9ffc7,0xffcbffca,0xffcdffcc,0xffcfffce,0xffd0ffd0,0xffd1ffd1,0xffd1ffd1,0xffcfffd0,0xffcdffce,0xffceffcd,0xffcfffce,0xffd0ffcf,0xffd2ffd1,0xffd3ffd2,0xffd4ffd4,0xffd5ffd5,0xffd5ffd5,0xffd5ffd5,0xffd4ffd5,0xffd2ffd3,0xffcdffd0,0xd5c7ffc9,0x2bc186c4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x40980193,0xf7a0aa9d,0xffaaffa5,0xffb1ffad,0xffb6ffb4,0xffbbffb9,0xffc0ffbe,0xffc4ffc2,0xffc7ffc6,0xffcaffc9,0xffcdffcc,0xffd0ffce,0xffd1ffd1,0xffd3ffd2,0xffd4ffd3,0xffd2ffd4,0xffccffce,0xffcdffcc,0xffceffce,0xffd0ffcf,
-0xffd2ffd1,0xffd4ffd3,0xffd5ffd5,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd5ffd6,0xffd2ffd4,0xffccffd0,0xa0c5f7c8,0x03bb3ac1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x909b2b97,0xffa4ed9f,0xffadffa9,
-0xffb4ffb1,0xffb9ffb7,0xffbfffbc,0xffc3ffc1,0xffc7ffc5,0xffcaffc8,0xffcdffcc,0xffcfffce,0xffd1ffd0,0xffd3ffd2,0xffd3ffd3,0xffceffd0,0xffcaffcb,0xffccffcb,0xffceffcd,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd5ffd5,0xffd6ffd6,0xffd6ffd6,0xffd5ffd6,0xffd3ffd4,0xffcfffd1,0xebc8ffcb,0x25c190c4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xac993993,0xffa3fd9e,0xffacffa8,0xffb3ffb0,0xffb9ffb6,0xffbeffbc,0xffc3ffc0,0xffc7ffc5,0xffcaffc9,0xffceffcc,0xffd0ffcf,0xffd3ffd1,0xffd4ffd4,0xffd3ffd4,0xffcfffd1,0xffcbffcd,0xffcdffcb,0xffcfffce,0xffd2ffd0,0xffd4ffd3,0xffd6ffd5,
-0xffd6ffd6,0xffd8ffd6,0xffd8ffd8,0xffd6ffd6,0xffd5ffd6,0xffd1ffd3,0xfbc9ffce,0x35c0aec5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x50a2119e,0xdfa79aa5,0xffaeffa9,0xffb4ffb2,0xffb9ffb7,0xffbeffbb,0xffc1ffbf,0xffc5ffc3,0xffc7ffc6,0xffcaffc8,0xffcbffcb,0xffcdffcc,0xffceffcd,0xffceffce,0xffccffcd,0xffcfffcd,0xffcfffd0,0xffceffce,0xffceffce,0xffcfffce,0xffd0ffcf,0xffd1ffd0,
-0xffd2ffd1,0xffd2ffd2,0xffd3ffd3,0xffd2ffd2,0xffd1ffd2,0xffceffd0,0xffc9ffcb,0x9ac4dec6,0x0dbf54c1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2e9f019b,0xc6a578a3,0xffadf9a9,
-0xffb4ffb1,0xffb9ffb7,0xffbeffbb,0xffc1ffc0,0xffc5ffc3,0xffc8ffc6,0xffcaffc9,0xffccffcb,0xffcdffcc,0xffcdffcd,0xffcdffcd,0xffccffcc,0xffcbffcb,0xffcbffcb,0xffccffcb,0xffcdffcc,0xffceffce,0xffd0ffcf,0xffd0ffd0,0xffd1ffd1,0xffd1ffd1,0xffcfffd0,0xffccffce,0xfbc8ffca,0x7ac3c6c5,0x01be2cc0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x13990000,0xc4a16a9d,0xffa9fba5,0xffb1ffae,0xffb7ffb4,0xffbcffb9,0xffc1ffbe,0xffc4ffc3,0xffc8ffc6,0xffcaffc9,0xffcdffcc,0xffcfffce,0xffd0ffcf,0xffd1ffd1,0xffcfffd1,0xffcaffcc,0xffcbffca,0xffccffcc,0xffceffcd,
-0xffd0ffcf,0xffd1ffd1,0xffd3ffd2,0xffd3ffd3,0xffd4ffd4,0xffd3ffd4,0xffd2ffd3,0xffceffd0,0xfdc8ffcc,0x66c2c6c5,0x000013c0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x569d0b97,0xf5a5b0a1,
-0xffaeffaa,0xffb5ffb2,0xffb9ffb8,0xffbfffbd,0xffc3ffc1,0xffc7ffc5,0xffcaffc8,0xffccffcb,0xffceffcd,0xffcfffcf,0xffcfffd0,0xffcaffcd,0xffc8ffc8,0xffcaffc9,0xffccffcb,0xffceffcd,0xffcfffcf,0xffd1ffd0,0xffd2ffd2,0xffd2ffd2,0xffd1ffd2,0xffcfffd0,0xffcaffcd,0xb0c5f9c7,0x09be5ac2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x949b2397,0xffa4e9a0,0xffaeffaa,0xffb5ffb2,0xffbbffb8,0xffc0ffbd,0xffc4ffc2,0xffc8ffc6,0xffcbffca,0xffceffcc,0xffd0ffcf,0xffd2ffd1,0xffd1ffd2,0xffccffce,0xffc9ffca,0xffcbffca,0xffcdffcc,0xffd0ffce,0xffd2ffd1,0xffd3ffd2,
-0xffd4ffd4,0xffd4ffd4,0xffd4ffd4,0xffd2ffd3,0xffceffd0,0xefc7ffca,0x29c092c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x019e0000,0x6aa520a3,0xd8ab9ca8,0xffb1fbae,0xffb7ffb4,0xffbbffb9,0xffbfffbd,0xffc2ffc1,0xffc5ffc4,0xffc7ffc6,0xffc8ffc8,0xffc9ffc8,0xffc9ffc9,0xffc8ffc8,0xffcbffc9,0xffcbffcc,0xffcaffca,0xffcaffc9,0xffcaffca,0xffcbffcb,0xffccffcc,
-0xffcdffcd,0xffcdffcd,0xffccffcc,0xffcaffcb,0xfbc6ffc8,0xa8c2d6c5,0x21bf66c1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4aa409a1,
-0xbeaa80a8,0xffafe7ae,0xffb7ffb3,0xffbbffb9,0xffbfffbd,0xffc2ffc0,0xffc4ffc3,0xffc6ffc5,0xffc7ffc6,0xffc7ffc7,0xffc7ffc7,0xffc6ffc7,0xffc5ffc6,0xffc6ffc6,0xffc7ffc6,0xffc8ffc7,0xffc9ffc8,0xffcaffc9,0xffcaffca,0xffcaffca,0xffc7ffc9,0xefc5ffc5,0x8ac1bec3,0x11bd48c0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6ea0199d,0xf3a8b4a5,0xffb0ffac,0xffb7ffb4,0xffbcffb9,0xffc0ffbe,0xffc4ffc2,0xffc6ffc5,0xffc9ffc8,0xffcaffca,0xffccffcb,0xffccffcc,0xffcbffcc,0xffc6ffc8,0xffc7ffc7,0xffc9ffc8,0xffcbffca,
-0xffccffcb,0xffcdffcd,0xffcfffce,0xffcfffcf,0xffceffcf,0xffccffce,0xffc8ffca,0xaec4f1c6,0x1bbe64c2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0d9e0000,
-0x9aa55aa1,0xffacdba9,0xffb4ffb0,0xffb9ffb6,0xffbeffbc,0xffc2ffc0,0xffc5ffc3,0xffc7ffc6,0xffc9ffc8,0xffcaffca,0xffcaffca,0xffc5ffc8,0xffc3ffc3,0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffccffcc,0xffccffcc,0xffcbffcc,0xffc9ffca,0xdec5ffc7,0x52c19ec2,0x000011bc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x589c0799,0xf3a5b0a1,0xffaeffa9,0xffb5ffb2,0xffbbffb8,0xffc0ffbe,0xffc4ffc2,0xffc7ffc6,0xffcaffc9,0xffccffcb,0xffceffcd,0xffcdffce,0xffc8ffca,0xffc5ffc6,0xffc8ffc6,0xffcaffc9,0xffccffcb,0xffceffcd,0xffcfffcf,
-0xffd0ffd0,0xffcfffd0,0xffcdffce,0xffc8ffcc,0xa6c4f1c6,0x07bf50c1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x36a911a5,0x90ad64ac,0xccb2a6b0,0xfdb6eeb3,0xffb9ffb6,0xffbcffbb,0xffbeffbd,0xffbfffbe,0xffc0ffbf,0xffbfffc0,0xffbfffbe,0xffc3ffc1,0xffc2ffc4,0xffc1ffc2,0xffc1ffc1,0xffc1ffc1,0xffc2ffc2,0xffc3ffc3,
-0xffc2ffc3,0xe6c3fdc2,0xb0c2cec2,0x66c08ec0,0x11bc3ebe,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x1ea701a4,0x70ad4aaa,0xa6b182b0,0xd0b5c0b3,0xf0b8deb7,0xf0bbf0b9,0xf4bcf4bb,0xecbdf0bd,0xdcbde8bd,0xd4bcdabc,0xdebde2bb,0xd8bcdebc,0xe8bce8bb,0xf0bcf0bc,0xf6bef2bd,0xf1bffdbe,0xe4bff0bf,0xbcc0d6bf,0x8abeaabf,0x48bd68bf,0x03b91ebb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x039f0000,0x64a834a3,0xd6ada4ab,0xffb3f3b0,0xffb8ffb6,0xffbcffb9,0xffc0ffbe,0xffc2ffc1,0xffc3ffc3,0xffc4ffc4,0xffc5ffc5,0xffc3ffc4,0xffbfffc0,0xffc0ffc0,0xffc2ffc1,0xffc4ffc3,
-0xffc5ffc5,0xffc7ffc6,0xffc7ffc7,0xffc6ffc7,0xf9c4ffc4,0xa2c2d0c3,0x34be6cc1,0x000009bb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x22a303a0,0x80ab58a7,0xd2b0acad,0xffb3f7b2,0xffb9ffb6,0xffbdffbb,0xffbfffbe,0xffc0ffc0,0xffc0ffc0,0xf9c0ffbf,0xf0bbf0bd,0xffb9f9b9,0xffbcffb9,0xffbfffbe,0xffc1ffc0,0xffc2ffc1,0xffc2ffc2,0xf2c2ffc2,0xaec1d4c2,0x56be80c1,0x00001fbc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0d9d0000,0x90a54aa1,0xf5acc8a9,0xffb3ffb0,0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffc6ffc8,0xffc2ffc4,0xffbfffc0,0xffc2ffc1,0xffc5ffc3,0xffc7ffc6,0xffc8ffc8,0xffc9ffc9,
-0xffc8ffc9,0xffc5ffc7,0xc4c4f7c5,0x40c086c2,0x000009bd,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x09ab0000,0x2aaf16ae,0x38b330b2,0x42b442b3,0x42b646b5,0x48b53ab7,0x38b650b5,0x50b44cb5,0x68b964b7,0x50b850bb,0x3cb84ab7,0x42b638b7,0x42b846b7,0x44b84ab7,0x30b83eb9,
-0x1ab724b8,0x000009b9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01b207b1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x28aa05a9,0x5ab040ad,0x8cb37eb0,0xa2b594b4,0xa6b8acb7,0xa0b9a4b8,0x8eb994b9,0x76b976bb,0x64b86ab9,0x6cb656b7,0x86b670b7,0x9cb790b7,0xa4b99cb9,
-0xaebba6bb,0x94bc98bc,0x74bd8abc,0x42bc62bc,0x07b922bb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x12ac05a8,0x38b030ad,0x50b24ab1,0x4eb550b4,0x3cb64eb5,0x26b632b6,0x07b614b6,0x00000000,0x10b109b0,0x32b322b1,0x4cb54cb3,0x50b748b6,0x40b950b7,0x2cb83ab9,0x000011b8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x09a30000,0x5caa34a7,0x9eaf7eae,0xd0b4bab2,0xecb7e2b6,0xf0b9f0b9,0xe6bcf0bb,0xc6bdd0bd,0x9cbba6be,0x8eb88eb9,0xb6b59ab5,0xdeb8ceb6,0xf0bbe4b9,0xf0bdf0bc,0xdabef0bd,0xc0bed4be,
-0x82bea2be,0x2cbc5ebd,0x000007bc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x14820382,0x50824882,0x50825082,0x20823c82,0x00000382,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0x4a822882,0x58825082,0x3c824e82,0x01821e82,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x22820782,0x56824082,0x50825a82,0x17823482,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x34821d82,0x5a825082,0x48825682,0x07821e82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x26820982,0x50823e82,0x56825a82,0x17823e82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0x42821482,0x5a825282,0x4a825082,0x07822282,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x11820000,0x4a823082,0x58825482,0x32824a82,0x00000d82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0f820000,0x4e822c82,0x52825a82,0x30824e82,0x00000f82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x09820000,0xb0826282,0xff82e982,0xff82ff82,0xff82ff82,0xff82ff82,0xc882f582,0x27827682,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x74822782,0xf582be82,0xff82ff82,0xff82ff82,0xff82ff82,0xe582ff82,
-0x6282a682,0x00001382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2e820182,0xc4827482,0xff82f782,0xff82ff82,0xff82ff82,0xff82ff82,0xac82e482,0x0f826282,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6a820f82,0xec82b082,0xff82ff82,0xff82ff82,0xff82ff82,0xf382ff82,0x8082be82,0x00002782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21820000,0xc2828282,0xff82fb82,0xff82ff82,0xff82ff82,0xfd82ff82,0xaa82e682,0x0f826482,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x5e821382,0xe582ae82,0xff82ff82,0xff82ff82,0xff82ff82,0xf782ff82,0x7c82ca82,0x00002782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,
-0x98824c82,0xfd82d882,0xff82ff82,0xff82ff82,0xff82ff82,0xd082fd82,0x4a829082,0x00000382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0x94823e82,0xfb82dc82,0xff82ff82,0xff82ff82,0xff82ff82,0xd882fd82,0x3a829282,0x00000382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x27820000,0xf1829a82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x5082c682,
-0x00000182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01820000,0xbe825082,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0x9c82f782,0x00002782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4a820182,0xff82c582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf382ff82,0x25829482,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x9c822582,0xff82f782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xbe82ff82,0x01824482,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x44820182,0xfd82b882,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf582ff82,0x25829a82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x9e822582,0xff82f382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xc682ff82,0x00003b82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x09820000,0xdb827082,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x7482e182,0x00000782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x0b820000,0xdf827082,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x6882e382,0x00000b82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x09820000,0xfb828682,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0x2382bd82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xbd822582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0x9082f982,0x00000d82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x29820000,0xff82b982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf782ff82,0x0b828a82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x90820d82,0xff82f782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xbd82ff82,0x00002d82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x2b820000,0xff82bd82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xf982ff82,0x07828a82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x8e820982,0xff82f982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xc482ff82,0x00002d82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xe1825382,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x5e82e982,0x00000182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xdf825b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x5a82e382,0x00000182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xdb822982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xf782ff82,0x00006782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x66820182,0xff82f382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0x2d82db82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01820000,0xf3826a82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xd782ff82,0x00002b82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2f820000,0xff82d782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x5d82f782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x01820000,0xf3826482,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xdb82ff82,0x00002f82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x33820000,0xff82db82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x6882f982,0x00000182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xae821182,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x0d82a782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xae820f82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x0b82b182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x45820000,0xff82f782,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,
-0xff82ff82,0x9c82ff82,0x00000382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff829382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xf182ff82,0x00004782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x8f820182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x4782f382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf5824d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x01828a82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x93820382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff83ff83,0xff82ff83,0x4782f382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf3824b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x01828f82,0x00000000,0x00000000,0x00000000,0x00000000,0x19820000,0xff82cd82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff83ff83,0xcb82ff82,0x00001982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x1d820000,0xff82d382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xd182ff82,0x00001382,0x00000000,0x00000000,0x00000000,0x00000000,0xf9824f82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff86ff85,0xff87ff87,
-0xff86ff87,0xff84ff85,0x01829782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xa1820182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x4182f982,0x00000000,0x00000000,0x00000000,0x00000000,0x01820000,0xff829b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff84ff84,0xff86ff85,0xff87ff87,0xff86ff86,0xfb83ff85,0x00004582,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x43820000,0xff82fb82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x9282ff82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x01820000,0xff829d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff85ff84,0xff87ff86,0xff88ff88,0xff87ff88,0xf984ff86,0x00004582,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x41820000,0xff82f982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xa382ff82,0x00000182,0x00000000,0x00000000,0x00000000,0xd7821582,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff86ff85,0xff87ff87,0xff87ff88,0xff85ff86,0x1582d183,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xcf821982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x1782d582,0x00000000,0x00000000,0x00000000,0x2b820000,0xff82f382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff86ff85,0xff8aff88,0xff8dff8b,0xff8eff8e,
-0xff8eff8f,0xff8bff8d,0x7c84ff88,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827482,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff83ff83,
-0xff83ff83,0xff82ff83,0xff82ff82,0xff82ff82,0xf382ff82,0x00002b82,0x00000000,0x00000000,0x00000000,0x72820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff87ff85,0xff8aff89,0xff8dff8c,0xff8eff8d,0xff8dff8e,0xff89ff8c,0x2d83ef85,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf7822d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff83ff83,0xff83ff84,0xff83ff83,0xff82ff82,0xff82ff82,0xff82ff82,0x00007982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x74820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff87ff85,0xff8bff89,0xff8eff8c,0xff8fff8f,0xff8fff90,0xff8cff8e,0x2785f188,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf3822f82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff83ff83,0xff83ff83,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0x00007482,0x00000000,0x00000000,0x05820000,0xff82c382,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff86ff84,0xff8aff88,0xff8cff8b,0xff8eff8e,0xff8fff8f,0xff8dff8e,0xbf86ff89,0x00000983,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x07820000,0xff82c182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff83ff83,0xff83ff83,0xff83ff83,0xff82ff82,0xff82ff82,0xff82ff82,0xc582ff82,0x00000582,0x00000000,0x00000000,0xd9820b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff88ff85,0xff8cff8a,0xff90ff8e,0xff93ff92,0xff95ff93,
-0xff95ff95,0xff93ff93,0xf58cff90,0x00003588,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2f820000,0xff82fb82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff85ff84,0xff87ff85,0xff88ff87,0xff88ff88,
-0xff88ff88,0xff86ff87,0xff84ff85,0xff82ff83,0xff82ff82,0x0782d382,0x00000000,0x00000000,0x00000000,0xfb823182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff89ff86,0xff8dff8b,0xff90ff8f,0xff93ff92,0xff93ff93,0xff93ff93,0xff92ff93,0xd389ff8e,0x00000b85,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0b820000,0xff82d182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff84ff83,0xff86ff85,0xff88ff87,0xff89ff88,0xff89ff89,0xff87ff88,0xff85ff86,0xff83ff84,0xff82ff82,0x3582fd82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xf7823d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff89ff86,0xff8dff8b,0xff91ff8f,0xff93ff93,0xff96ff95,0xff96ff96,0xff93ff96,0xcb8cff91,0x0000058a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0xff82cd82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff85ff84,0xff86ff85,0xff87ff87,0xff88ff88,0xff87ff88,0xff86ff87,0xff84ff85,0xff82ff83,0xff82ff82,0x3382f982,0x00000000,0x00000000,0x7e820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff83ff82,0xff87ff85,0xff8cff8a,0xff90ff8e,0xff93ff91,0xff95ff93,0xff96ff95,0xff93ff95,0xff8eff92,0x00007c8a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x82820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff85ff84,0xff87ff86,0xff88ff87,0xff88ff88,0xff87ff88,0xff85ff86,0xff84ff84,0xff82ff82,0xff82ff82,0x00007e82,0x00000000,0x00000000,0xff827282,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff88ff86,0xff8dff8b,0xff92ff90,0xff96ff93,0xff99ff97,0xff9bff9a,
-0xff9bff9b,0xff9aff9b,0xff95ff98,0x038bcf8f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc9820182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff88ff86,0xff8bff89,0xff8dff8c,0xff8eff8e,0xff8fff8f,
-0xff8eff8f,0xff8dff8e,0xff8aff8c,0xff86ff89,0xff82ff84,0x7682ff82,0x00000000,0x00000000,0x03820000,0xff82c982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff89ff87,0xff8eff8c,0xff93ff90,0xff96ff93,0xff99ff98,0xff9aff9a,0xff9bff9b,0xff99ff9a,0xff92ff97,0x00007e8d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7e820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff87ff85,0xff8aff89,0xff8dff8b,0xff8eff8e,0xff8fff8f,0xff8fff8f,0xff8eff8f,0xff8bff8d,0xff88ff8a,0xff83ff85,0xcd82ff82,0x00000382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x05820000,0xff82c982,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff89ff86,0xff8eff8c,0xff93ff91,0xff97ff95,0xff9aff99,0xff9cff9b,0xff9dff9c,0xff9bff9c,0xff93ff99,0x00007890,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7e820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff83,0xff88ff86,0xff8aff89,0xff8dff8c,0xff8eff8d,0xff8eff8e,0xff8eff8e,0xff8cff8d,0xff89ff8b,0xff85ff87,0xff82ff84,0xc582ff82,0x00000582,0x00000000,0xf9822582,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff83ff82,0xff87ff85,0xff8dff8a,0xff91ff8f,0xff95ff93,0xff99ff97,0xff9bff9a,0xff9cff9c,0xff9bff9c,0xff97ff9a,0x298ffb92,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xfb822b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff84,0xff88ff87,0xff8bff8a,0xff8dff8c,0xff8eff8e,0xff8eff8f,0xff8eff8e,0xff8cff8d,0xff89ff8b,0xff85ff87,0xff82ff83,0x2f82fb82,0x00000000,0x0f820000,0xff82f182,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff88ff85,0xff8dff8b,0xff93ff90,0xff97ff95,0xff9bff99,0xff9eff9d,0xffa1ffa0,
-0xffa1ffa1,0xffa1ffa1,0xff9dff9f,0x5693ff97,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff825482,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff83,0xff8aff87,0xff8eff8c,0xff91ff8f,0xff93ff92,0xff95ff93,0xff95ff95,
-0xff95ff95,0xff93ff93,0xff91ff93,0xff8dff8f,0xff86ff8a,0xed82ff83,0x00000d82,0x00000000,0x54820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff89ff86,0xff8fff8c,0xff93ff91,0xff98ff96,0xff9cff9a,0xff9fff9d,0xffa0ffa0,0xffa1ffa1,0xffa0ffa1,0xff9bff9e,0x0992ed95,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xed821182,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff89ff86,0xff8dff8b,0xff90ff8f,0xff93ff91,0xff93ff93,0xff95ff95,0xff95ff95,0xff93ff95,0xff92ff93,0xff8eff90,0xff88ff8c,0xff82ff85,0x00005882,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x5a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff88ff85,0xff8eff8b,0xff93ff91,0xff98ff96,0xff9cff9a,0xffa0ff9e,0xffa2ffa1,0xffa3ffa2,0xffa2ffa2,0xff9dffa0,0x0b93ed98,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf1820f82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff84,0xff8aff88,0xff8eff8c,0xff91ff8f,0xff93ff92,0xff93ff93,0xff95ff93,0xff93ff93,0xff93ff93,0xff90ff92,0xff8cff8e,0xff86ff89,0xff82ff83,0x00005282,0x00000000,0xff82ac82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff86ff84,0xff8cff89,0xff92ff8f,0xff97ff95,0xff9bff99,0xff9eff9d,0xffa1ffa0,0xffa2ffa2,0xffa2ffa2,0xff9fffa1,0xb493ff9b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff82a882,0xff82ff82,0xff82ff82,0xff83ff82,0xff86ff84,0xff8bff89,0xff8fff8d,0xff91ff90,0xff93ff92,0xff93ff93,0xff95ff95,0xff93ff95,0xff92ff93,0xff90ff91,0xff8bff8e,0xff85ff88,0xa682ff82,0x00000000,0x74820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8dff8a,0xff93ff90,0xff98ff95,0xff9dff9b,0xffa1ff9f,0xffa4ffa2,0xffa6ffa5,
-0xffa7ffa7,0xffa7ffa7,0xffa4ffa6,0xce99ffa0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82ca82,0xff82ff82,0xff82ff82,0xff85ff83,0xff8bff88,0xff90ff8d,0xff93ff92,0xff97ff95,0xff99ff98,0xff9aff9a,0xff9bff9b,
-0xff9bff9b,0xff9aff9a,0xff97ff99,0xff93ff95,0xff8dff91,0xff84ff88,0x00006e82,0x00000000,0xc2820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff8eff8b,0xff93ff91,0xff99ff96,0xff9dff9b,0xffa1ff9f,0xffa4ffa3,0xffa6ffa5,0xffa7ffa7,0xffa6ffa6,0xffa2ffa4,0x7897ff9c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff826c82,0xff82ff82,0xff82ff82,0xff84ff82,0xff89ff86,0xff8eff8c,0xff93ff90,0xff96ff95,0xff99ff97,0xff9aff9a,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff98ff9a,0xff95ff97,0xff8fff93,0xff86ff8b,0x0182cf82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xca820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff84,0xff8dff8a,0xff93ff90,0xff99ff96,0xff9dff9b,0xffa1ff9f,0xffa5ffa3,0xffa7ffa6,0xffa8ffa8,0xffa8ffa8,0xffa4ffa7,0x749affa0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff827082,0xff82ff82,0xff82ff82,0xff86ff83,0xff8bff89,0xff90ff8e,0xff93ff92,0xff96ff95,0xff99ff98,0xff9aff99,0xff9aff9a,0xff9aff9a,0xff99ff9a,0xff96ff98,0xff92ff93,0xff8cff90,0xff84ff88,0x0182c782,0x21820000,0xff82fd82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff85ff82,0xff8bff88,0xff91ff8e,0xff97ff93,0xff9cff9a,0xffa0ff9e,0xffa4ffa2,0xffa6ffa5,0xffa8ffa7,0xffa8ffa8,0xffa5ffa7,0xfb9cffa2,0x00001f98,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1d820000,
-0xff82fd82,0xff82ff82,0xff82ff82,0xff87ff84,0xff8cff8a,0xff91ff8f,0xff95ff93,0xff97ff96,0xff99ff98,0xff9aff9a,0xff9bff9b,0xff9aff9b,0xff99ff9a,0xff96ff97,0xff92ff93,0xff8aff8e,0xfb82ff86,0x00001d82,0xc6820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8bff87,0xff92ff8e,0xff98ff95,0xff9dff9a,0xffa2ff9f,0xffa6ffa4,0xffa9ffa8,0xffabffaa,
-0xffadffac,0xffacffad,0xffaaffab,0xffa1ffa7,0x0000239b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x21820000,0xff82fd82,0xff82ff82,0xff84ff82,0xff8bff87,0xff91ff8e,0xff95ff93,0xff99ff97,0xff9cff9b,0xff9fff9d,0xffa0ff9f,0xffa1ffa1,
-0xffa1ffa1,0xff9fffa0,0xff9dff9e,0xff99ff9b,0xff93ff97,0xff89ff8f,0x0000ca83,0x00000000,0xff821b82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8cff89,0xff93ff90,0xff99ff96,0xff9eff9b,0xffa3ffa0,0xffa6ffa4,0xffa9ffa8,0xffabffaa,0xffacffac,0xffacffac,0xffa8ffaa,0xcc9dffa4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82c882,0xff82ff82,0xff83ff82,0xff89ff86,0xff8fff8c,0xff93ff92,0xff98ff96,0xff9cff9a,0xff9eff9d,0xffa0ff9f,0xffa1ffa1,0xffa1ffa1,0xffa0ffa1,0xff9eff9f,0xff9bff9d,0xff96ff99,0xff8cff92,0x2282ff85,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xfd821d82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8bff88,0xff92ff8f,0xff98ff95,0xff9eff9b,0xffa2ffa0,0xffa6ffa4,0xffaaffa8,0xffacffab,0xffaeffad,0xffaeffae,0xffabffad,0xd4a0ffa7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82ca82,0xff82ff82,0xff85ff82,0xff8bff88,0xff91ff8e,0xff96ff93,0xff9aff98,0xff9cff9b,0xff9eff9d,0xffa0ff9f,0xffa0ffa0,0xffa0ffa0,0xff9fff9f,0xff9cff9d,0xff98ff9a,0xff93ff96,0xff89ff8e,0x1e82ff84,0x72820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,
-0xff89ff86,0xff90ff8d,0xff96ff93,0xff9cff99,0xffa1ff9e,0xffa5ffa3,0xffa9ffa7,0xffabffaa,0xffadffac,0xffadffad,0xffabffad,0xffa4ffa9,0x00007e9d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x74820000,
-0xff82ff82,0xff82ff82,0xff86ff83,0xff8dff89,0xff92ff90,0xff97ff95,0xff9aff99,0xff9dff9c,0xff9fff9e,0xffa0ffa0,0xffa1ffa1,0xffa0ffa0,0xff9fffa0,0xff9cff9d,0xff98ff9a,0xff91ff95,0xff86ff8c,0x00007882,0xf9821382,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff85,0xff90ff8c,0xff96ff93,0xff9cff99,0xffa2ff9f,0xffa6ffa4,0xffaaffa9,0xffaeffac,0xffb1ffaf,
-0xffb2ffb1,0xffb2ffb2,0xffafffb1,0xffa7ffad,0x000066a1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x70820000,0xff82ff82,0xff83ff82,0xff89ff85,0xff90ff8d,0xff96ff93,0xff9bff99,0xff9fff9d,0xffa2ffa0,0xffa4ffa3,0xffa6ffa5,0xffa6ffa6,
-0xffa6ffa6,0xffa5ffa6,0xffa3ffa4,0xff9fffa1,0xff99ff9d,0xff90ff95,0x1d82ff87,0x00000000,0xff826882,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8aff86,0xff91ff8e,0xff98ff95,0xff9dff9b,0xffa3ffa0,0xffa7ffa5,0xffabffa9,0xffaeffad,0xffb0ffaf,0xffb2ffb1,0xffb1ffb1,0xffaeffb0,0xfda4ffaa,0x0000139e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x13820000,0xff82fd82,0xff82ff82,0xff87ff84,0xff8eff8b,0xff93ff92,0xff9aff97,0xff9eff9c,0xffa1ff9f,0xffa4ffa2,0xffa5ffa5,0xffa7ffa6,0xffa7ffa7,0xffa6ffa6,0xffa4ffa5,0xffa1ffa2,0xff9cff9f,0xff93ff98,0x6a84ff8b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff827082,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff85,0xff90ff8c,0xff97ff93,0xff9dff9a,0xffa2ffa0,0xffa7ffa5,0xffabffa9,0xffafffad,0xffb2ffb0,0xffb3ffb2,0xffb3ffb3,0xffb0ffb2,0xffa7ffad,0x00001da1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x15820000,0xff82ff82,0xff83ff82,0xff8aff86,0xff91ff8d,0xff97ff93,0xff9bff99,0xff9fff9d,0xffa2ffa0,0xffa4ffa3,0xffa5ffa5,0xffa6ffa6,0xffa6ffa6,0xffa4ffa5,0xffa2ffa3,0xff9effa0,0xff99ff9c,0xff8fff95,0x6682ff88,0xbc820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,
-0xff8eff8a,0xff95ff92,0xff9bff98,0xffa1ff9e,0xffa6ffa3,0xffaaffa8,0xffaeffac,0xffb0ffaf,0xffb2ffb1,0xffb3ffb3,0xffb1ffb2,0xffabffaf,0x0000baa4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb8820000,
-0xff82ff82,0xff84ff82,0xff8bff87,0xff92ff8f,0xff98ff95,0xff9cff9a,0xffa0ff9e,0xffa2ffa1,0xffa5ffa4,0xffa6ffa5,0xffa6ffa6,0xffa6ffa6,0xffa4ffa5,0xffa2ffa3,0xff9effa0,0xff97ff9b,0xff8cff92,0x0000ba84,0xff824882,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8dff89,0xff93ff90,0xff9bff98,0xffa1ff9e,0xffa6ffa4,0xffabffa9,0xffafffad,0xffb3ffb1,0xffb5ffb4,
-0xffb7ffb6,0xffb7ffb7,0xffb5ffb6,0xffaeffb2,0x000098a7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x9e820000,0xff82ff82,0xff86ff83,0xff8eff8a,0xff96ff92,0xff9bff99,0xffa0ff9e,0xffa4ffa2,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xffacffab,
-0xffacffac,0xffabffab,0xffa8ffaa,0xffa5ffa7,0xff9fffa2,0xff96ff9b,0x4686ff8d,0x00000000,0xff829c82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff83,0xff8eff8b,0xff96ff92,0xff9cff99,0xffa2ff9f,0xffa8ffa5,0xffacffaa,0xffb0ffae,0xffb3ffb2,0xffb5ffb4,0xffb6ffb6,0xffb6ffb6,0xffb3ffb5,0xffaaffb0,0x00004ea3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4e820000,0xff82ff82,0xff84ff82,0xff8cff88,0xff93ff90,0xff9aff97,0xff9fff9c,0xffa3ffa1,0xffa6ffa5,0xffa9ffa8,0xffabffaa,0xffacffab,0xffacffac,0xffabffac,0xffaaffab,0xffa6ffa8,0xffa1ffa4,0xff99ff9d,0xa489ff92,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff82a282,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8dff89,0xff93ff91,0xff9bff98,0xffa1ff9e,0xffa7ffa4,0xffacffa9,0xffb0ffae,0xffb4ffb2,0xffb6ffb5,0xffb8ffb7,0xffb8ffb8,0xffb6ffb7,0xffadffb3,0x00004ca6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4a820000,0xff82ff82,0xff86ff83,0xff8fff8b,0xff96ff93,0xff9cff99,0xffa0ff9e,0xffa4ffa2,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xffabffab,0xffabffab,0xffaaffab,0xffa7ffa9,0xffa4ffa6,0xff9effa1,0xff95ff9a,0x9e85ff8e,0xf3820382,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff87,
-0xff92ff8f,0xff99ff96,0xffa0ff9c,0xffa5ffa3,0xffaaffa8,0xffafffad,0xffb2ffb1,0xffb5ffb4,0xffb7ffb6,0xffb8ffb8,0xffb6ffb7,0xffb1ffb4,0x03a3ebaa,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xed820382,
-0xff82ff82,0xff88ff84,0xff91ff8d,0xff97ff93,0xff9dff9a,0xffa1ff9f,0xffa5ffa3,0xffa8ffa6,0xffaaffa9,0xffabffab,0xffabffab,0xffabffab,0xffaaffaa,0xffa7ffa9,0xffa3ffa5,0xff9dffa0,0xff92ff98,0x0000ee89,0xff826a82,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff85,0xff91ff8d,0xff98ff95,0xff9fff9c,0xffa5ffa2,0xffabffa8,0xffb0ffad,0xffb4ffb2,0xffb8ffb6,0xffb9ffb9,
-0xffbcffbb,0xffbcffbc,0xffb9ffbb,0xffb3ffb7,0x0000beac,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc0820000,0xff82ff82,0xff8bff86,0xff93ff8f,0xff9bff97,0xffa0ff9e,0xffa5ffa3,0xffa9ffa7,0xffacffab,0xffafffae,0xffb0ffb0,0xffb1ffb1,
-0xffb1ffb1,0xffb0ffb1,0xffaeffaf,0xffaaffac,0xffa5ffa8,0xff9bffa1,0x708bff93,0x00000000,0xff82c282,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff87,0xff93ff8f,0xff9aff97,0xffa1ff9e,0xffa7ffa4,0xffacffa9,0xffb1ffae,0xffb5ffb3,0xffb8ffb6,0xffb9ffb9,0xffbbffbb,0xffbbffbb,0xffb8ffb9,0xffb0ffb5,0x000070a9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x70820000,0xff82ff82,0xff88ff84,0xff91ff8d,0xff99ff95,0xff9fff9c,0xffa4ffa1,0xffa8ffa6,0xffabffaa,0xffaeffad,0xffb0ffaf,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffafffb0,0xffacffad,0xffa6ffa9,0xff9effa3,0xc68fff98,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff82ce82,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff85,0xff91ff8d,0xff99ff95,0xff9fff9c,0xffa5ffa2,0xffabffa8,0xffb0ffae,0xffb5ffb3,0xffb8ffb7,0xffbbffb9,0xffbcffbc,0xffbdffbd,0xffb9ffbc,0xffb3ffb8,0x00006eac,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6e820000,0xff82ff82,0xff8bff86,0xff93ff90,0xff9bff98,0xffa1ff9e,0xffa6ffa3,0xffa9ffa8,0xffacffab,0xffafffae,0xffb0ffaf,0xffb1ffb0,0xffb0ffb1,0xffafffb0,0xffadffae,0xffa9ffab,0xffa3ffa7,0xff9bffa0,0xbc8bff93,0xff821c82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff83,0xff8fff8b,
-0xff97ff93,0xff9eff9a,0xffa4ffa1,0xffaaffa7,0xffafffac,0xffb3ffb1,0xffb7ffb5,0xffb9ffb8,0xffbcffbb,0xffbcffbc,0xffbbffbc,0xffb6ffb9,0x1ca8ffae,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff821882,
-0xff84ff82,0xff8dff88,0xff96ff92,0xff9cff99,0xffa2ff9f,0xffa6ffa4,0xffaaffa8,0xffadffac,0xffafffae,0xffb0ffb0,0xffb1ffb1,0xffb0ffb1,0xffafffb0,0xffacffae,0xffa8ffaa,0xffa2ffa6,0xff98ff9e,0x1786ff8f,0xff827482,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff88,0xff95ff91,0xff9cff99,0xffa3ffa0,0xffaaffa7,0xffafffac,0xffb4ffb2,0xffb8ffb6,0xffbcffb9,0xffbeffbd,
-0xffc0ffbf,0xffc0ffc0,0xffbeffc0,0xffb8ffbc,0x0000d4b1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd8820000,0xff85ff82,0xff8fff8a,0xff98ff93,0xff9fff9c,0xffa5ffa2,0xffaaffa8,0xffaeffac,0xffb1ffb0,0xffb4ffb2,0xffb5ffb5,0xffb6ffb6,
-0xffb6ffb6,0xffb5ffb5,0xffb3ffb4,0xffafffb1,0xffa9ffac,0xffa1ffa6,0x7c90ff99,0x00000000,0xff82d082,0xff82ff82,0xff82ff82,0xff86ff83,0xff8fff8b,0xff97ff93,0xff9eff9b,0xffa5ffa2,0xffabffa8,0xffb0ffae,0xffb5ffb3,0xffb9ffb7,0xffbcffbb,0xffbfffbe,0xffc0ffbf,0xffbfffc0,0xffbdffbf,0xffb5ffb9,0x000090ac,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x7e820000,0xff83ff82,0xff8dff87,0xff96ff91,0xff9dff9a,0xffa3ffa0,0xffa9ffa6,0xffadffab,0xffb0ffaf,0xffb3ffb2,0xffb5ffb4,0xffb6ffb6,0xffb6ffb6,0xffb6ffb6,0xffb4ffb5,0xffb1ffb2,0xffabffae,0xffa3ffa8,0xd493ff9d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff82d482,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff89,0xff95ff91,0xff9dff99,0xffa3ffa0,0xffaaffa7,0xffafffad,0xffb4ffb2,0xffb9ffb7,0xffbdffbb,0xffbfffbe,0xffc1ffc0,0xffc1ffc1,0xffbfffc0,0xffb8ffbc,0x00008cb0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x78820000,0xff85ff82,0xff90ff8b,0xff99ff95,0xffa0ff9d,0xffa6ffa3,0xffabffa8,0xffaeffad,0xffb1ffb0,0xffb4ffb3,0xffb5ffb4,0xffb6ffb5,0xffb5ffb6,0xffb4ffb5,0xffb2ffb3,0xffaeffb0,0xffa9ffac,0xffa0ffa5,0xd090ff9a,0xff822882,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,0xff93ff8f,
-0xff9bff97,0xffa2ff9e,0xffa8ffa5,0xffaeffab,0xffb3ffb1,0xffb8ffb5,0xffbbffb9,0xffbeffbd,0xffc0ffbf,0xffc1ffc1,0xffbfffc0,0xffb9ffbd,0x2aadffb4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff822a82,
-0xff87ff83,0xff92ff8d,0xff9bff97,0xffa1ff9e,0xffa7ffa4,0xffabffa9,0xffafffad,0xffb2ffb1,0xffb4ffb3,0xffb5ffb5,0xffb6ffb6,0xffb5ffb6,0xffb4ffb5,0xffb1ffb3,0xffadffaf,0xffa7ffab,0xff9dffa3,0x2a8bff93,0xff828a82,0xff82ff82,0xff82ff82,0xff88ff84,0xff91ff8c,0xff99ff95,0xffa0ff9d,0xffa7ffa4,0xffaeffab,0xffb3ffb0,0xffb8ffb6,0xffbcffb9,0xffc0ffbe,0xffc3ffc1,
-0xffc4ffc4,0xffc4ffc5,0xffc3ffc4,0xffbcffc0,0x0000d0b5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd0820000,0xff88ff83,0xff93ff8e,0xff9dff99,0xffa4ffa0,0xffaaffa7,0xffafffac,0xffb3ffb1,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffbbffbb,
-0xffbbffbb,0xffb9ffb9,0xffb7ffb9,0xffb4ffb6,0xffaeffb1,0xffa5ffaa,0x7a93ff9d,0x00000000,0xff82d482,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8e,0xff9bff97,0xffa2ff9f,0xffa9ffa6,0xffafffac,0xffb4ffb2,0xffb9ffb7,0xffbdffbb,0xffc1ffbf,0xffc3ffc2,0xffc4ffc4,0xffc4ffc4,0xffc1ffc3,0xffb9ffbe,0x000078b2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x70820000,0xff85ff82,0xff91ff8b,0xff9aff96,0xffa2ff9e,0xffa8ffa5,0xffadffab,0xffb2ffb0,0xffb5ffb4,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffbbffbb,0xffb9ffbb,0xffb8ffb9,0xffb5ffb7,0xffb0ffb3,0xffa8ffad,0xd498ffa1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff82d082,0xff82ff82,0xff82ff82,0xff88ff83,0xff91ff8c,0xff99ff95,0xffa1ff9d,0xffa7ffa4,0xffaeffab,0xffb3ffb1,0xffb9ffb6,0xffbdffbb,0xffc1ffbf,0xffc3ffc2,0xffc5ffc4,0xffc5ffc5,0xffc3ffc5,0xffbcffc0,0x000078b5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x78820000,0xff88ff83,0xff93ff8f,0xff9eff99,0xffa5ffa1,0xffaaffa8,0xffafffad,0xffb3ffb1,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb6ffb8,0xffb3ffb5,0xffadffb0,0xffa4ffa9,0xd093ff9e,0xff822a82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8fff8a,0xff97ff93,
-0xff9fff9b,0xffa6ffa2,0xffacffa9,0xffb2ffaf,0xffb7ffb5,0xffbcffb9,0xffc0ffbe,0xffc3ffc1,0xffc4ffc3,0xffc5ffc5,0xffc4ffc5,0xffbeffc2,0x2cb1ffb7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff822a82,
-0xff8cff85,0xff97ff91,0xff9fff9b,0xffa6ffa3,0xffabffa9,0xffb0ffae,0xffb4ffb2,0xffb7ffb5,0xffb9ffb8,0xffb9ffb9,0xffbbffb9,0xffb9ffbb,0xffb9ffb9,0xffb6ffb8,0xffb2ffb4,0xffacffaf,0xffa1ffa7,0x268fff98,0xff826682,0xff82ff82,0xff83ff82,0xff8bff86,0xff93ff90,0xff9dff99,0xffa4ffa1,0xffabffa8,0xffb1ffae,0xffb7ffb4,0xffbcffb9,0xffc1ffbe,0xffc4ffc2,0xffc7ffc5,
-0xffc8ffc8,0xffc8ffc9,0xffc6ffc8,0xffbfffc4,0x0000bab8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xbe820000,0xff8cff85,0xff98ff92,0xffa1ff9d,0xffa8ffa5,0xffaeffab,0xffb3ffb1,0xffb7ffb5,0xffb9ffb9,0xffbdffbc,0xffbfffbe,0xffbfffbf,
-0xffbfffbf,0xffbeffbf,0xffbcffbd,0xffb8ffb9,0xffb2ffb6,0xffa9ffae,0x7098ffa1,0x00000000,0xff82c482,0xff82ff82,0xff84ff82,0xff8dff89,0xff96ff92,0xff9fff9b,0xffa6ffa2,0xffadffa9,0xffb3ffb0,0xffb8ffb6,0xffbdffbb,0xffc1ffbf,0xffc5ffc3,0xffc7ffc6,0xffc8ffc8,0xffc8ffc8,0xffc5ffc7,0xffbcffc2,0x000070b5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6c820000,0xff88ff83,0xff95ff8f,0xff9eff9a,0xffa6ffa2,0xffacffa9,0xffb2ffaf,0xffb6ffb4,0xffb9ffb8,0xffbcffbb,0xffbeffbd,0xffbfffbf,0xffc0ffc0,0xffbfffbf,0xffbdffbe,0xffb9ffbc,0xffb5ffb7,0xffacffb1,0xc09cffa5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff82c882,0xff82ff82,0xff83ff82,0xff8bff86,0xff93ff90,0xff9dff99,0xffa4ffa1,0xffabffa8,0xffb1ffae,0xffb7ffb4,0xffbcffb9,0xffc1ffbf,0xffc5ffc3,0xffc7ffc6,0xffc9ffc8,0xffc9ffc9,0xffc7ffc8,0xffbfffc4,0x00006ab8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6e820000,0xff8cff85,0xff99ff93,0xffa2ff9e,0xffa9ffa5,0xffafffac,0xffb4ffb1,0xffb8ffb6,0xffbbffb9,0xffbdffbc,0xffbeffbe,0xffbfffbf,0xffbfffbf,0xffbeffbe,0xffbbffbc,0xffb7ffb9,0xffb1ffb5,0xffa8ffad,0xc098ffa2,0xff821382,0xff82ff82,0xff82ff82,0xff89ff84,0xff92ff8d,0xff9bff96,
-0xffa2ff9f,0xffa9ffa6,0xffb0ffad,0xffb6ffb3,0xffbbffb9,0xffc0ffbd,0xffc3ffc2,0xffc6ffc5,0xffc8ffc7,0xffc9ffc9,0xffc7ffc8,0xffc2ffc5,0x16b4ffb9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff831882,
-0xff90ff88,0xff9bff95,0xffa3ff9f,0xffaaffa7,0xffb0ffad,0xffb4ffb2,0xffb8ffb6,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffbfffbf,0xffbfffbf,0xffbdffbe,0xffbbffbc,0xffb6ffb9,0xffb0ffb4,0xffa5ffac,0x1893ff9b,0xff824a82,0xff82ff82,0xff84ff82,0xff8eff89,0xff98ff93,0xffa0ff9c,0xffa8ffa4,0xffafffab,0xffb5ffb2,0xffbbffb8,0xffc0ffbd,0xffc4ffc2,0xffc8ffc6,0xffcaffc9,
-0xffccffcb,0xffccffcc,0xffcaffcb,0xffc2ffc7,0x00009abb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xa0820000,0xff8fff87,0xff9cff96,0xffa5ffa1,0xffacffa9,0xffb2ffaf,0xffb7ffb5,0xffbbffb9,0xffbfffbd,0xffc1ffc0,0xffc3ffc2,0xffc4ffc3,
-0xffc4ffc4,0xffc2ffc3,0xffc0ffc1,0xffbcffbe,0xffb6ffb9,0xffadffb2,0x449bffa4,0x00000000,0xff829a82,0xff82ff82,0xff85ff82,0xff90ff8b,0xff99ff93,0xffa2ff9e,0xffa9ffa6,0xffb0ffad,0xffb7ffb4,0xffbcffb9,0xffc1ffbe,0xffc5ffc3,0xffc8ffc7,0xffcbffc9,0xffccffcb,0xffcbffcc,0xffc8ffca,0xffbfffc5,0x000042b8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4a820000,0xff8cff85,0xff99ff93,0xffa2ff9e,0xffaaffa6,0xffb1ffae,0xffb6ffb3,0xffb9ffb8,0xffbeffbc,0xffc1ffbf,0xffc3ffc2,0xffc4ffc3,0xffc4ffc4,0xffc2ffc3,0xffc0ffc2,0xffbdffbf,0xffb7ffb9,0xffaeffb3,0xa29dffa6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff829a82,0xff82ff82,0xff84ff82,0xff8eff89,0xff98ff93,0xffa0ff9c,0xffa8ffa4,0xffafffab,0xffb5ffb2,0xffbbffb8,0xffc0ffbe,0xffc4ffc2,0xffc8ffc6,0xffcaffc9,0xffcbffcb,0xffcbffcb,0xffc8ffca,0xffbfffc5,0x00004ab8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x46820000,0xff8cff85,0xff9aff93,0xffa3ff9f,0xffabffa7,0xffb2ffaf,0xffb7ffb5,0xffbcffb9,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc3ffc3,0xffc3ffc3,0xffc2ffc3,0xffbfffc1,0xffbbffbd,0xffb5ffb9,0xffacffb1,0xa29bffa5,0xf4820000,0xff82ff82,0xff83ff82,0xff8cff86,0xff95ff91,0xff9eff9a,
-0xffa6ffa2,0xffadffa9,0xffb4ffb0,0xffb9ffb7,0xffbfffbc,0xffc3ffc1,0xffc7ffc5,0xffcaffc9,0xffccffcb,0xffccffcc,0xffcaffcb,0xffc4ffc8,0x05b5efbe,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xef830182,
-0xff92ff8a,0xff9eff98,0xffa6ffa2,0xffaeffaa,0xffb4ffb1,0xffb9ffb6,0xffbdffbb,0xffc0ffbe,0xffc2ffc1,0xffc3ffc3,0xffc3ffc4,0xffc3ffc3,0xffc2ffc2,0xffbfffc1,0xffbbffbd,0xffb4ffb8,0xffa9ffaf,0x0593ef9f,0xff821a82,0xff82ff82,0xff84ff82,0xff8dff88,0xff97ff93,0xffa0ff9c,0xffa8ffa4,0xffafffab,0xffb5ffb2,0xffbbffb8,0xffc0ffbe,0xffc5ffc3,0xffc8ffc7,0xffcbffca,
-0xffcdffcc,0xffcdffcd,0xffcaffcc,0xffc2ffc8,0x000074bb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6c820000,0xff8fff87,0xff9cff96,0xffa5ffa1,0xffadffa9,0xffb3ffb0,0xffb8ffb6,0xffbcffb9,0xffbfffbe,0xffc2ffc1,0xffc3ffc3,0xffc4ffc4,
-0xffc4ffc4,0xffc3ffc3,0xffc0ffc2,0xffbcffbe,0xffb6ffb9,0xffabffb1,0x1899ffa0,0x00000000,0xff828682,0xff82ff82,0xff84ff82,0xff8eff89,0xff98ff93,0xffa1ff9d,0xffa9ffa5,0xffb0ffad,0xffb7ffb4,0xffbdffb9,0xffc2ffbf,0xffc6ffc4,0xffcaffc8,0xffcdffcb,0xffceffcd,0xffceffce,0xffcbffcc,0xfbc1ffc7,0x000019b9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x13820000,0xff8dfd85,0xff9bff93,0xffa4ffa0,0xffacffa8,0xffb2ffaf,0xffb7ffb5,0xffbbffb9,0xffbfffbd,0xffc1ffc0,0xffc3ffc2,0xffc4ffc3,0xffc3ffc4,0xffc2ffc3,0xffbfffc1,0xffbbffbd,0xffb5ffb8,0xffabffb1,0x7e99ffa3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff826a82,0xff82ff82,0xff86ff83,0xff90ff8c,0xff9aff95,0xffa1ff9e,0xffa9ffa5,0xffb0ffac,0xffb6ffb3,0xffbbffb9,0xffc0ffbe,0xffc4ffc2,0xffc7ffc5,0xffc9ffc8,0xffc9ffc9,0xffc9ffc9,0xffc5ffc7,0xffbbffc2,0x000030b4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x38820000,0xff89ff83,0xff97ff90,0xffa1ff9c,0xffa9ffa5,0xffb0ffad,0xffb7ffb4,0xffbcffb9,0xffbfffbe,0xffc2ffc1,0xffc4ffc3,0xffc5ffc5,0xffc5ffc5,0xffc4ffc5,0xffc2ffc3,0xffbfffc0,0xffb9ffbc,0xffafffb5,0x6a9effa7,0xc0820000,0xff82ff82,0xff83ff82,0xff8cff87,0xff96ff91,0xff9fff9a,
-0xffa6ffa3,0xffaeffaa,0xffb4ffb1,0xffb9ffb7,0xffbfffbc,0xffc3ffc1,0xffc7ffc5,0xffcaffc9,0xffcbffcb,0xffcbffcc,0xffc9ffca,0xffc2ffc7,0x0000cebb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xca820000,
-0xff90ff88,0xff9cff97,0xffa5ffa1,0xffadffa9,0xffb3ffb0,0xffb8ffb6,0xffbdffbb,0xffc0ffbe,0xffc2ffc1,0xffc4ffc3,0xffc4ffc4,0xffc4ffc4,0xffc3ffc4,0xffc0ffc2,0xffbcffbe,0xffb5ffb9,0xffa9ffb0,0x0000c0a1,0xf5820382,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9cff98,0xffa4ffa0,0xffacffa8,0xffb2ffaf,0xffb8ffb5,0xffbeffbb,0xffc2ffc0,0xffc6ffc4,0xffc9ffc7,
-0xffcaffca,0xffcaffca,0xffc8ffc9,0xffbeffc5,0x000044b7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x4a820000,0xff8aff84,0xff98ff92,0xffa1ff9d,0xffa9ffa5,0xffafffac,0xffb4ffb2,0xffb9ffb7,0xffbcffb9,0xffbeffbd,0xffc0ffbf,0xffc1ffc0,
-0xffc0ffc1,0xffbfffc0,0xffbcffbe,0xffb8ffb9,0xffb2ffb5,0xffa7ffad,0x0193f39d,0x00000000,0xff827282,0xff82ff82,0xff82ff82,0xff8bff86,0xff95ff90,0xff9eff99,0xffa6ffa2,0xffadffaa,0xffb4ffb1,0xffb9ffb7,0xffc0ffbd,0xffc5ffc2,0xffc8ffc7,0xffcbffca,0xffcdffcc,0xffccffcd,0xffc9ffcb,0xd0bfffc5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff8ad483,0xff98ff92,0xffa2ff9d,0xffaaffa6,0xffb0ffad,0xffb4ffb2,0xffb8ffb7,0xffbcffb9,0xffbeffbd,0xffbfffbf,0xffc0ffc0,0xffc0ffc0,0xffbeffbf,0xffbcffbd,0xffb7ffb9,0xffb1ffb5,0xffa7ffad,0x7096ff9f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xff822682,0xff82ff82,0xff85ff82,0xff8fff8a,0xff97ff93,0xff9fff9b,0xffa6ffa3,0xffadffaa,0xffb3ffb0,0xffb8ffb5,0xffbcffb9,0xffc0ffbe,0xffc3ffc2,0xffc6ffc5,0xffc6ffc6,0xffc6ffc6,0xffc3ffc5,0xffb9ffbf,0x000030b2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30820000,0xff86ff82,0xff93ff8d,0xff9eff99,0xffa6ffa2,0xffadffaa,0xffb3ffb0,0xffb8ffb6,0xffbcffb9,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc3ffc3,0xffc3ffc3,0xffc1ffc2,0xffbdffbf,0xffb8ffbb,0xffaeffb4,0x1f9effa5,0x88820000,0xff82ff82,0xff82ff82,0xff89ff85,0xff93ff8e,0xff9cff97,
-0xffa3ffa0,0xffaaffa7,0xffb1ffae,0xffb7ffb4,0xffbcffb9,0xffc0ffbe,0xffc4ffc2,0xffc6ffc5,0xffc8ffc7,0xffc8ffc8,0xffc6ffc7,0xffbfffc4,0x0000b8b7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb8820000,
-0xff8cff85,0xff98ff92,0xffa1ff9d,0xffa9ffa5,0xffafffac,0xffb5ffb2,0xffb9ffb7,0xffbdffbb,0xffbfffbe,0xffc1ffc0,0xffc2ffc1,0xffc1ffc2,0xffc0ffc1,0xffbeffbf,0xffb9ffbc,0xffb2ffb6,0xffa6ffad,0x0000829d,0xf0820000,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9aff95,0xffa2ff9e,0xffa9ffa5,0xffb0ffad,0xffb6ffb3,0xffbbffb9,0xffc0ffbe,0xffc3ffc2,0xffc6ffc5,
-0xffc8ffc7,0xffc8ffc8,0xffc5ffc7,0xffb9ffc1,0x00002cb3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x24820000,0xff87ff82,0xff93ff8e,0xff9eff99,0xffa6ffa2,0xffacffa9,0xffb1ffaf,0xffb6ffb4,0xffb9ffb7,0xffbbffb9,0xffbdffbc,0xffbeffbe,
-0xffbdffbe,0xffbcffbd,0xffb9ffbb,0xffb5ffb8,0xffaeffb2,0xffa3ffaa,0x0000e699,0x00000000,0xff827282,0xff82ff82,0xff82ff82,0xff89ff84,0xff92ff8d,0xff9bff97,0xffa4ffa0,0xffabffa7,0xffb2ffaf,0xffb8ffb5,0xffbeffbb,0xffc2ffc0,0xffc6ffc4,0xffc9ffc7,0xffcaffc9,0xffcaffca,0xffc6ffc8,0xa2b9ffc2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff86aa82,0xff93ff8d,0xff9eff99,0xffa6ffa2,0xffacffa9,0xffb1ffaf,0xffb5ffb3,0xffb9ffb7,0xffbbffb9,0xffbcffbc,0xffbdffbd,0xffbdffbd,0xffbcffbc,0xffb9ffb9,0xffb5ffb7,0xffafffb2,0xffa5ffaa,0x7293ff9d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xe9820382,0xff82ff82,0xff82ff82,0xff8aff86,0xff93ff8f,0xff9bff97,0xffa3ff9f,0xffaaffa6,0xffb0ffad,0xffb5ffb3,0xffb9ffb8,0xffbeffbc,0xffc1ffc0,0xffc3ffc2,0xffc4ffc4,0xffc4ffc4,0xffc1ffc3,0xffb7ffbd,0x000032b0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3c820000,0xff84ff82,0xff91ff8b,0xff9bff96,0xffa4ffa0,0xffabffa7,0xffb0ffae,0xffb5ffb3,0xffb9ffb7,0xffbcffbb,0xffbeffbd,0xffc0ffbf,0xffc0ffc0,0xffbfffc0,0xffbdffbe,0xffb9ffbc,0xffb3ffb7,0xffa9ffaf,0x0000e29f,0x66820000,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8b,0xff98ff93,
-0xffa0ff9d,0xffa8ffa4,0xffaeffab,0xffb4ffb1,0xffb9ffb7,0xffbeffbc,0xffc1ffc0,0xffc4ffc3,0xffc6ffc5,0xffc6ffc6,0xffc4ffc5,0xffbcffc1,0x0000b0b5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb0820000,
-0xff88ff83,0xff95ff8f,0xff9eff9a,0xffa6ffa2,0xffadffaa,0xffb2ffaf,0xffb6ffb4,0xffb9ffb8,0xffbcffbb,0xffbeffbd,0xffbfffbe,0xffbeffbf,0xffbdffbe,0xffb9ffbc,0xffb6ffb8,0xffafffb3,0xffa1ffa9,0x00006e97,0xe2820000,0xff82ff82,0xff82ff82,0xff85ff82,0xff8fff8a,0xff98ff93,0xffa0ff9c,0xffa7ffa4,0xffaeffab,0xffb4ffb1,0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc4ffc3,
-0xffc6ffc5,0xffc6ffc6,0xffc3ffc5,0xffb6ffbf,0x00001eaf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1e820000,0xff85ff82,0xff92ff8b,0xff9bff97,0xffa3ffa0,0xffaaffa7,0xffafffad,0xffb3ffb1,0xffb7ffb5,0xffb9ffb8,0xffbbffb9,0xffbcffbc,
-0xffbbffbc,0xffb9ffbb,0xffb7ffb9,0xffb3ffb6,0xffacffb0,0xffa1ffa8,0x0000e696,0x00000000,0xff828282,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9aff95,0xffa2ff9e,0xffa9ffa6,0xffb0ffad,0xffb6ffb3,0xffbcffb9,0xffc0ffbe,0xffc4ffc2,0xffc7ffc5,0xffc8ffc7,0xffc7ffc8,0xffc3ffc6,0x96b3ffbd,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff84a082,0xff90ff8a,0xff9aff96,0xffa3ff9f,0xffa9ffa6,0xffafffac,0xffb3ffb1,0xffb6ffb5,0xffb9ffb8,0xffb9ffb9,0xffbbffbb,0xffbbffbb,0xffb9ffb9,0xffb7ffb9,0xffb3ffb5,0xffadffb0,0xffa3ffa9,0x7891ff9b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xca820000,0xff82ff82,0xff82ff82,0xff87ff83,0xff90ff8c,0xff99ff95,0xffa0ff9d,0xffa7ffa4,0xffaeffaa,0xffb3ffb0,0xffb8ffb6,0xffbcffb9,0xffbfffbe,0xffc2ffc1,0xffc3ffc2,0xffc2ffc3,0xffbfffc1,0xffb6ffbc,0x000048ae,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x48820000,0xff84ff82,0xff90ff89,0xff9aff95,0xffa2ff9e,0xffa9ffa6,0xffafffac,0xffb3ffb1,0xffb7ffb5,0xffb9ffb9,0xffbcffbb,0xffbdffbd,0xffbeffbe,0xffbdffbd,0xffb9ffbc,0xffb7ffb9,0xffb0ffb4,0xffa5ffab,0x0000ca9a,0x4e820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff88,0xff96ff92,
-0xff9eff9a,0xffa5ffa2,0xffacffa9,0xffb2ffaf,0xffb7ffb5,0xffbcffb9,0xffc0ffbe,0xffc2ffc1,0xffc4ffc3,0xffc4ffc4,0xffc2ffc4,0xffbbffbf,0x0000b2b3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb0820000,
-0xff86ff82,0xff93ff8d,0xff9cff98,0xffa4ffa1,0xffabffa8,0xffb0ffad,0xffb4ffb2,0xffb8ffb6,0xffb9ffb9,0xffbcffbb,0xffbdffbc,0xffbcffbd,0xffbbffbc,0xffb8ffb9,0xffb3ffb6,0xffacffb0,0xff9dffa6,0x00005093,0xea820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff89,0xff97ff92,0xff9fff9b,0xffa6ffa3,0xffadffaa,0xffb3ffb0,0xffb8ffb6,0xffbdffbb,0xffc1ffbf,0xffc3ffc2,
-0xffc5ffc4,0xffc5ffc5,0xffc2ffc4,0xffb2ffbd,0x00002ca8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2e820000,0xff84ff82,0xff90ff89,0xff9aff95,0xffa2ff9e,0xffa8ffa5,0xffaeffab,0xffb2ffb0,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,
-0xffb9ffb9,0xffb9ffb9,0xffb6ffb8,0xffb2ffb4,0xffabffaf,0xffa0ffa6,0x0000e695,0x00000000,0xff829082,0xff82ff82,0xff82ff82,0xff86ff83,0xff90ff8b,0xff99ff95,0xffa1ff9d,0xffa8ffa5,0xffafffac,0xffb5ffb2,0xffbbffb8,0xffbfffbd,0xffc3ffc1,0xffc5ffc4,0xffc7ffc6,0xffc6ffc7,0xffc0ffc4,0xaeabffb8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82ae82,0xff8eff87,0xff98ff93,0xffa1ff9d,0xffa7ffa4,0xffadffaa,0xffb1ffaf,0xffb5ffb3,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb6ffb7,0xffb2ffb4,0xffacffaf,0xffa2ffa8,0x8891ff9b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xaa820000,0xff82ff82,0xff82ff82,0xff85ff82,0xff8eff8a,0xff97ff93,0xff9fff9b,0xffa6ffa2,0xffacffa9,0xffb2ffaf,0xffb7ffb4,0xffbbffb9,0xffbeffbd,0xffc1ffc0,0xffc2ffc1,0xffc2ffc2,0xffbfffc1,0xffb6ffbc,0x000062ae,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x5e820000,0xff83ff82,0xff8fff89,0xff99ff93,0xffa1ff9d,0xffa8ffa5,0xffaeffab,0xffb2ffb0,0xffb6ffb4,0xffb9ffb8,0xffbbffb9,0xffbcffbc,0xffbcffbc,0xffbbffbc,0xffb8ffb9,0xffb4ffb7,0xffaeffb1,0xffa2ffa9,0x0000ac97,0x4a820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff93ff90,
-0xff9dff99,0xffa4ffa0,0xffabffa7,0xffb1ffae,0xffb6ffb3,0xffbbffb9,0xffbeffbd,0xffc1ffc0,0xffc3ffc2,0xffc3ffc3,0xffc1ffc3,0xffb9ffbf,0x0000c2b0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xbe820000,
-0xff85ff82,0xff92ff8c,0xff9bff97,0xffa3ff9f,0xffaaffa6,0xffafffac,0xffb3ffb1,0xffb6ffb5,0xffb9ffb8,0xffbbffb9,0xffbbffbb,0xffbbffbb,0xffb9ffb9,0xffb6ffb8,0xffb2ffb4,0xffaaffae,0xff9bffa4,0x00004c91,0xf0820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff88,0xff96ff92,0xff9eff9a,0xffa5ffa2,0xffacffa9,0xffb2ffaf,0xffb8ffb5,0xffbcffb9,0xffc0ffbe,0xffc3ffc1,
-0xffc4ffc4,0xffc4ffc4,0xffc0ffc3,0xffafffb9,0x000064a4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6a820000,0xff83ff82,0xff8fff88,0xff99ff93,0xffa1ff9d,0xffa7ffa4,0xffadffaa,0xffb1ffaf,0xffb5ffb3,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,
-0xffb9ffb9,0xffb8ffb9,0xffb5ffb7,0xffb1ffb3,0xffaaffae,0xff9fffa6,0x0000ee93,0x00000000,0xff829e82,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8b,0xff99ff93,0xffa1ff9d,0xffa8ffa4,0xffafffab,0xffb5ffb2,0xffb9ffb7,0xffbfffbc,0xffc2ffc0,0xffc5ffc3,0xffc6ffc5,0xffc4ffc6,0xffbbffc1,0xe9a6ffb3,0x00000599,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff82e982,0xff8bff84,0xff97ff92,0xff9fff9b,0xffa6ffa3,0xffacffa9,0xffb0ffae,0xffb4ffb2,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb6ffb7,0xffb2ffb4,0xffacffaf,0xffa3ffa8,0x9691ff9b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x94820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff88,0xff95ff91,0xff9dff99,0xffa4ffa1,0xffabffa8,0xffb1ffae,0xffb6ffb3,0xffb9ffb8,0xffbdffbc,0xffc0ffbf,0xffc1ffc1,0xffc1ffc2,0xffbfffc0,0xffb5ffbc,0x000080ac,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x80820000,0xff83ff82,0xff8fff89,0xff99ff93,0xffa1ff9d,0xffa7ffa4,0xffadffaa,0xffb2ffb0,0xffb5ffb4,0xffb8ffb7,0xffb9ffb9,0xffbbffbb,0xffbbffbb,0xffb9ffbb,0xffb7ffb9,0xffb3ffb5,0xffacffb0,0xff9fffa7,0x00009693,0x46820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff85,0xff93ff8f,
-0xff9cff98,0xffa3ff9f,0xffaaffa7,0xffb0ffad,0xffb5ffb3,0xffb9ffb8,0xffbeffbc,0xffc1ffbf,0xffc2ffc2,0xffc3ffc3,0xffc1ffc2,0xffb8ffbe,0x019de7ac,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xe9820382,
-0xff85ff82,0xff91ff8c,0xff9bff96,0xffa2ff9f,0xffa9ffa6,0xffaeffac,0xffb2ffb0,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb5ffb7,0xffb1ffb3,0xffa9ffad,0xff9affa3,0x00003a90,0xf6820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff88,0xff96ff91,0xff9eff9a,0xffa5ffa2,0xffacffa9,0xffb2ffaf,0xffb7ffb5,0xffbcffb9,0xffc0ffbe,0xffc2ffc1,
-0xffc4ffc3,0xffc4ffc4,0xffbdffc2,0xffacffb6,0x0000be9f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc2820000,0xff82ff82,0xff8eff86,0xff98ff93,0xffa0ff9c,0xffa7ffa4,0xffacffaa,0xffb1ffaf,0xffb4ffb3,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,
-0xffb9ffb9,0xffb8ffb9,0xffb5ffb7,0xffb1ffb3,0xffaaffae,0xff9fffa5,0x0000f295,0x00000000,0xff82b282,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8b,0xff98ff93,0xffa0ff9c,0xffa8ffa4,0xffaeffab,0xffb5ffb2,0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc4ffc3,0xffc5ffc5,0xffc2ffc5,0xffb7ffbd,0xffa2ffaf,0x00004898,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x42820000,0xff82ff82,0xff88ff83,0xff96ff90,0xff9fff9b,0xffa5ffa2,0xffabffa8,0xffb0ffad,0xffb3ffb2,0xffb6ffb5,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb8ffb8,0xffb5ffb7,0xffb2ffb4,0xffacffaf,0xffa3ffa8,0xb091ff9b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x7e820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff95ff90,0xff9dff99,0xffa4ffa0,0xffaaffa7,0xffb0ffad,0xffb5ffb3,0xffb9ffb7,0xffbdffbb,0xffc0ffbf,0xffc1ffc1,0xffc1ffc1,0xffbfffc0,0xffb4ffbb,0x0000c4a7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc2820000,0xff84ff82,0xff8fff89,0xff99ff93,0xffa1ff9d,0xffa7ffa4,0xffadffaa,0xffb2ffaf,0xffb5ffb3,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffb9ffbb,0xffb9ffb9,0xffb6ffb8,0xffb2ffb5,0xffabffaf,0xff9dffa6,0x00008493,0x38820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8e,
-0xff9bff97,0xffa3ff9f,0xffa9ffa6,0xffafffac,0xffb5ffb2,0xffb9ffb7,0xffbdffbc,0xffc0ffbf,0xffc2ffc1,0xffc3ffc3,0xffc0ffc2,0xffb5ffbc,0x3e9dffa8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff823682,
-0xff85ff82,0xff91ff8b,0xff9bff96,0xffa2ff9f,0xffa9ffa6,0xffaeffab,0xffb2ffb0,0xffb5ffb4,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb5ffb7,0xffb0ffb3,0xffa8ffad,0xff99ffa2,0x0000488e,0xfc820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff88,0xff96ff91,0xff9eff9a,0xffa5ffa2,0xffacffa9,0xffb2ffaf,0xffb7ffb5,0xffbcffb9,0xffc0ffbe,0xffc2ffc1,
-0xffc4ffc3,0xffc3ffc4,0xffb9ffbf,0xffaaffb3,0x3993ff9f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfd824182,0xff82ff82,0xff8cff85,0xff98ff93,0xffa0ff9c,0xffa7ffa4,0xffacffaa,0xffb1ffaf,0xffb4ffb3,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,
-0xffb9ffb9,0xffb8ffb9,0xffb5ffb7,0xffb1ffb3,0xffaaffae,0xff9fffa6,0x058cf995,0x00000000,0xff82ce82,0xff82ff82,0xff82ff82,0xff86ff83,0xff90ff8b,0xff99ff93,0xffa1ff9d,0xffa8ffa4,0xffafffab,0xffb5ffb2,0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc4ffc3,0xffc5ffc5,0xffbeffc2,0xffb3ffb9,0xffa3ffac,0x018fc198,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc5820182,0xff82ff82,0xff87ff82,0xff95ff8e,0xff9eff9a,0xffa5ffa2,0xffabffa8,0xffafffad,0xffb3ffb1,0xffb6ffb5,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb8ffb9,0xffb6ffb7,0xffb2ffb4,0xffacffaf,0xffa3ffa8,0xc692ff9c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x72820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,0xff93ff90,0xff9cff98,0xffa3ffa0,0xffaaffa7,0xffb0ffad,0xffb5ffb2,0xffb9ffb7,0xffbdffbb,0xffc0ffbf,0xffc1ffc1,0xffc1ffc2,0xffbfffc1,0xffb2ffb9,0x1b9afda6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfd821d82,0xff84ff82,0xff90ff8a,0xff99ff95,0xffa1ff9d,0xffa8ffa5,0xffadffab,0xffb2ffb0,0xffb5ffb4,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffb9ffbb,0xffb9ffb9,0xffb6ffb8,0xffb2ffb4,0xffaaffaf,0xff9dffa5,0x00007893,0x36820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff85,0xff92ff8e,
-0xff9bff97,0xffa2ff9f,0xffa9ffa6,0xffafffac,0xffb5ffb2,0xffb9ffb7,0xffbdffbc,0xffc0ffbf,0xffc2ffc2,0xffc3ffc3,0xffbfffc2,0xffb2ffb9,0xac9cffa8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff82b082,
-0xff85ff82,0xff91ff8b,0xff9bff96,0xffa2ff9f,0xffa9ffa6,0xffaeffab,0xffb2ffb0,0xffb5ffb4,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb5ffb6,0xffb0ffb3,0xffa8ffac,0xff98ffa2,0x0000468f,0xff820d82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff88,0xff96ff91,0xff9eff9a,0xffa5ffa2,0xffacffa9,0xffb2ffaf,0xffb7ffb5,0xffbcffb9,0xffc0ffbe,0xffc3ffc1,
-0xffc4ffc3,0xffc0ffc3,0xffb6ffbc,0xffa9ffb0,0xcf93ffa0,0x0000058a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0xff82cd82,0xff82ff82,0xff8cff85,0xff98ff92,0xffa0ff9c,0xffa7ffa4,0xffadffaa,0xffb1ffaf,0xffb5ffb3,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,
-0xffb9ffb9,0xffb8ffb9,0xffb6ffb7,0xffb1ffb4,0xffabffae,0xffa0ffa6,0x0e8cff93,0x00000000,0xff82e282,0xff82ff82,0xff82ff82,0xff87ff83,0xff90ff8b,0xff99ff95,0xffa1ff9d,0xffa8ffa5,0xffafffac,0xffb5ffb2,0xffb9ffb8,0xffbfffbc,0xffc2ffc0,0xffc4ffc3,0xffc3ffc4,0xffb9ffbf,0xffb0ffb6,0xffa3ffaa,0x628eff99,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff825a82,0xff82ff82,0xff86ff82,0xff93ff8d,0xff9eff99,0xffa5ffa2,0xffabffa8,0xffb0ffad,0xffb3ffb2,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb6ffb7,0xffb2ffb4,0xffadffb0,0xffa4ffa9,0xde92ff9d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x70820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,0xff93ff8f,0xff9cff98,0xffa3ff9f,0xffaaffa7,0xffb0ffad,0xffb5ffb2,0xffb9ffb7,0xffbdffbb,0xffc0ffbf,0xffc2ffc1,0xffc2ffc2,0xffbeffc1,0xffb0ffb8,0x9c99ffa6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff829882,0xff84ff82,0xff90ff8a,0xff9aff95,0xffa2ff9e,0xffa8ffa5,0xffaeffab,0xffb2ffb0,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffbbffbb,0xffb9ffbb,0xffb9ffb9,0xffb6ffb8,0xffb2ffb4,0xffaaffae,0xff9dffa5,0x00006c93,0x32820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff92ff8e,
-0xff9bff97,0xffa2ff9f,0xffa9ffa6,0xffafffac,0xffb5ffb2,0xffb9ffb7,0xffbeffbc,0xffc1ffbf,0xffc3ffc2,0xffc3ffc3,0xffbdffc1,0xffb0ffb7,0xff9cffa8,0x00003f90,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x35820000,0xff82ff82,
-0xff84ff82,0xff91ff8b,0xff9bff97,0xffa3ff9f,0xffa9ffa6,0xffaeffac,0xffb2ffb0,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb5ffb7,0xffb0ffb3,0xffa8ffad,0xff98ffa2,0x00004a8e,0xff821682,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff88,0xff96ff92,0xff9eff9a,0xffa6ffa2,0xffacffa9,0xffb2ffb0,0xffb8ffb5,0xffbcffb9,0xffc0ffbe,0xffc3ffc2,
-0xffc4ffc4,0xffbdffc2,0xffb4ffb9,0xffa8ffae,0xff97ffa1,0x0000848c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x80820000,0xff82ff82,0xff82ff82,0xff8cff85,0xff98ff92,0xffa1ff9d,0xffa8ffa4,0xffadffaa,0xffb1ffaf,0xffb5ffb3,0xffb8ffb6,0xffb9ffb9,0xffb9ffb9,
-0xffb9ffb9,0xffb9ffb9,0xffb6ffb8,0xffb2ffb4,0xffabffaf,0xffa0ffa7,0x108eff95,0x00000000,0xff82f282,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9aff95,0xffa2ff9e,0xffa9ffa5,0xffafffac,0xffb5ffb2,0xffbbffb8,0xffbfffbd,0xffc2ffc1,0xffc4ffc4,0xffbfffc3,0xffb7ffbb,0xffafffb3,0xffa3ffa9,0xf191ff9b,0x00001f88,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1d820000,0xff82ef82,0xff82ff82,0xff87ff83,0xff93ff8d,0xff9dff98,0xffa5ffa2,0xffabffa8,0xffb0ffae,0xffb4ffb2,0xffb7ffb5,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb7ffb8,0xffb3ffb5,0xffaeffb1,0xffa5ffaa,0xf193ff9e,0x0000018a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x5c820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff93ff8f,0xff9cff98,0xffa3ff9f,0xffaaffa7,0xffb0ffad,0xffb5ffb3,0xffb9ffb8,0xffbeffbc,0xffc0ffbf,0xffc2ffc1,0xffc2ffc2,0xffbdffc1,0xffafffb6,0xf99bffa7,0x00002f8f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31820000,0xff82fd82,0xff84ff82,0xff91ff8a,0xff9bff96,0xffa2ff9f,0xffa9ffa6,0xffaeffac,0xffb3ffb1,0xffb6ffb5,0xffb9ffb8,0xffb9ffb9,0xffbbffbb,0xffbbffbb,0xffb9ffb9,0xffb7ffb8,0xffb2ffb4,0xffaaffae,0xff9cffa5,0x00006892,0x34820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,
-0xff9bff97,0xffa3ff9f,0xffa9ffa6,0xffb0ffad,0xffb5ffb3,0xffb9ffb8,0xffbeffbc,0xffc1ffc0,0xffc3ffc2,0xffc3ffc3,0xffbbffc0,0xffafffb5,0xff9effa8,0x0989d792,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xcd820982,0xff82ff82,
-0xff85ff82,0xff92ff8b,0xff9cff97,0xffa3ffa0,0xffaaffa7,0xffafffac,0xffb3ffb1,0xffb6ffb5,0xffb9ffb8,0xffb9ffb9,0xffbbffbb,0xffb9ffbb,0xffb8ffb9,0xffb5ffb7,0xffb0ffb3,0xffa8ffad,0xff98ffa2,0x0000428f,0xff822882,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff89,0xff97ff92,0xff9fff9b,0xffa6ffa2,0xffadffaa,0xffb3ffb0,0xffb8ffb6,0xffbdffbb,0xffc1ffbf,0xffc4ffc2,
-0xffc2ffc4,0xffbbffbf,0xffb2ffb7,0xffa8ffad,0xff9affa2,0x5186fd90,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xfd824f82,0xff82ff82,0xff83ff82,0xff8dff87,0xff98ff93,0xffa1ff9d,0xffa8ffa5,0xffaeffab,0xffb2ffb0,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffbbffbb,
-0xffbbffbb,0xffb9ffb9,0xffb7ffb8,0xffb3ffb5,0xffacffb0,0xffa1ffa7,0x268dff96,0x00000000,0xff82fa82,0xff82ff82,0xff82ff82,0xff88ff83,0xff91ff8d,0xff9aff96,0xffa2ff9e,0xffa9ffa6,0xffb0ffad,0xffb6ffb3,0xffbbffb9,0xffbfffbd,0xffc3ffc1,0xffc3ffc4,0xffbcffc0,0xffb5ffb9,0xffadffb1,0xffa3ffa9,0xff95ff9d,0x0f83d38a,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc7820982,0xff82ff82,0xff82ff82,0xff88ff83,0xff93ff8e,0xff9dff98,0xffa6ffa2,0xffabffa9,0xffb0ffae,0xffb4ffb2,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffb9ffbb,0xffb9ffb9,0xffb8ffb9,0xffb4ffb6,0xffaeffb1,0xffa6ffab,0xff93ff9f,0x00000a8a,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x5a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff93ff8f,0xff9cff98,0xffa3ffa0,0xffaaffa7,0xffb0ffad,0xffb6ffb3,0xffb9ffb8,0xffbeffbc,0xffc1ffc0,0xffc3ffc2,0xffc3ffc3,0xffbbffc0,0xffafffb5,0xff9dffa7,0x0f88dd91,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xd7820f82,0xff82ff82,0xff85ff82,0xff92ff8b,0xff9bff97,0xffa3ffa0,0xffaaffa7,0xffafffad,0xffb4ffb1,0xffb7ffb5,0xffb9ffb8,0xffbbffb9,0xffbcffbc,0xffbbffbc,0xffb9ffbb,0xffb7ffb9,0xffb2ffb5,0xffaaffaf,0xff9cffa5,0x00005a92,0x44820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8e,
-0xff9bff97,0xffa3ff9f,0xffaaffa6,0xffb0ffad,0xffb6ffb3,0xffb9ffb8,0xffbfffbd,0xffc2ffc0,0xffc4ffc3,0xffc2ffc4,0xffb9ffbd,0xffaeffb3,0xffa0ffa7,0xad8bff96,0x00000382,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0xff82a982,0xff82ff82,
-0xff86ff82,0xff92ff8c,0xff9cff98,0xffa4ffa0,0xffaaffa7,0xffb0ffad,0xffb4ffb2,0xffb7ffb5,0xffb9ffb8,0xffbbffb9,0xffbbffbb,0xffbbffbb,0xffb9ffb9,0xffb6ffb8,0xffb1ffb4,0xffa9ffad,0xff99ffa3,0x00004690,0xff823082,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff89,0xff97ff93,0xff9fff9b,0xffa7ffa3,0xffaeffaa,0xffb4ffb1,0xffb9ffb6,0xffbeffbb,0xffc1ffc0,0xffc4ffc3,
-0xffc0ffc3,0xffb9ffbc,0xffb1ffb5,0xffa8ffac,0xff9cffa3,0xf58aff95,0x00003d83,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x39820000,0xff82f382,0xff82ff82,0xff84ff82,0xff8eff89,0xff99ff93,0xffa2ff9d,0xffa9ffa5,0xffaeffab,0xffb3ffb1,0xffb6ffb5,0xffb9ffb8,0xffbbffb9,0xffbcffbb,
-0xffbcffbc,0xffb9ffbb,0xffb8ffb9,0xffb3ffb6,0xffadffb1,0xffa2ffa8,0x2c8eff97,0x11820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff92ff8d,0xff9bff97,0xffa3ff9f,0xffaaffa7,0xffb1ffad,0xffb7ffb4,0xffbcffb9,0xffc0ffbe,0xffc3ffc2,0xffc0ffc3,0xffb9ffbd,0xffb3ffb6,0xffacffb0,0xffa4ffa8,0xff98ff9f,0xad86ff90,0x00000582,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff82ab82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8f,0xff9dff99,0xffa6ffa2,0xffacffa9,0xffb1ffaf,0xffb5ffb3,0xffb8ffb6,0xffb9ffb9,0xffbbffbb,0xffbbffbb,0xffb9ffbb,0xffb8ffb9,0xffb5ffb7,0xffafffb2,0xffa7ffac,0xff96ffa0,0x00001c8b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x58820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff93ff8f,0xff9cff98,0xffa4ffa0,0xffaaffa7,0xffb1ffae,0xffb6ffb3,0xffbbffb8,0xffbfffbd,0xffc2ffc0,0xffc3ffc3,0xffc2ffc4,0xffb9ffbe,0xffaeffb4,0xffa0ffa7,0xbf89ff96,0x00000982,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05820000,0xff82bb82,0xff82ff82,0xff86ff82,0xff92ff8d,0xff9cff98,0xffa4ffa1,0xffabffa8,0xffb0ffad,0xffb4ffb2,0xffb8ffb6,0xffb9ffb9,0xffbcffbb,0xffbdffbc,0xffbcffbd,0xffbbffbc,0xffb8ffb9,0xffb3ffb5,0xffabffaf,0xff9cffa5,0x00005492,0x44820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,
-0xff9cff98,0xffa3ffa0,0xffaaffa7,0xffb1ffae,0xffb6ffb3,0xffbbffb9,0xffbfffbd,0xffc2ffc1,0xffc4ffc3,0xffbfffc3,0xffb7ffbb,0xffadffb2,0xffa1ffa7,0xff8fff9a,0x01828b86,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x91820182,0xff82ff82,0xff82ff82,
-0xff87ff83,0xff93ff8e,0xff9dff98,0xffa5ffa1,0xffabffa8,0xffb0ffae,0xffb5ffb3,0xffb8ffb6,0xffb9ffb9,0xffbcffbb,0xffbcffbc,0xffbcffbc,0xffb9ffbb,0xffb7ffb8,0xffb2ffb4,0xffa9ffae,0xff9affa4,0x00003891,0xff823082,0xff82ff82,0xff82ff82,0xff84ff82,0xff8fff8a,0xff98ff93,0xffa0ff9c,0xffa7ffa4,0xffaeffab,0xffb4ffb1,0xffb9ffb7,0xffbeffbc,0xffc2ffc0,0xffc4ffc4,
-0xffbeffc1,0xffb7ffb9,0xffb0ffb3,0xffa8ffac,0xff9effa3,0xff90ff98,0x3d82f787,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xf3823d82,0xff82ff82,0xff82ff82,0xff85ff82,0xff90ff8b,0xff9aff95,0xffa2ff9e,0xffa9ffa6,0xffafffac,0xffb4ffb1,0xffb7ffb6,0xffb9ffb9,0xffbcffbb,0xffbdffbc,
-0xffbcffbd,0xffbbffbc,0xffb8ffb9,0xffb4ffb7,0xffaeffb1,0xffa3ffa9,0x308fff99,0x28820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9cff97,0xffa4ffa0,0xffabffa7,0xffb1ffae,0xffb7ffb4,0xffbdffb9,0xffc1ffbf,0xffc3ffc3,0xffbdffc0,0xffb7ffb9,0xffb2ffb5,0xffacffaf,0xffa4ffa8,0xff9bffa0,0xff8bff93,0x0382a184,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xa1820382,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff95ff90,0xff9eff9a,0xffa6ffa2,0xffadffaa,0xffb2ffaf,0xffb6ffb4,0xffb9ffb7,0xffbbffb9,0xffbcffbb,0xffbcffbc,0xffbbffbc,0xffb9ffbb,0xffb6ffb8,0xffb0ffb3,0xffa8ffad,0xff97ffa2,0x0000228d,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x4a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff93ff90,0xff9cff98,0xffa4ffa0,0xffabffa8,0xffb1ffae,0xffb6ffb4,0xffbbffb9,0xffbfffbd,0xffc2ffc1,0xffc4ffc3,0xffc1ffc4,0xffb8ffbc,0xffadffb3,0xffa1ffa8,0xff8fff99,0x0782b985,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb3820782,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8f,0xff9dff99,0xffa5ffa1,0xffacffa9,0xffb1ffae,0xffb5ffb3,0xffb9ffb7,0xffbbffb9,0xffbdffbc,0xffbdffbd,0xffbdffbd,0xffbbffbc,0xffb8ffb9,0xffb3ffb6,0xffabffb0,0xff9cffa5,0x00004e92,0x3c820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,
-0xff9cff98,0xffa4ffa0,0xffabffa7,0xffb1ffae,0xffb7ffb4,0xffbcffb9,0xffc0ffbe,0xffc3ffc1,0xffc4ffc4,0xffbdffc1,0xffb5ffb9,0xffadffb1,0xffa2ffa8,0xff93ff9c,0x9d83ff8b,0x00000582,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03820000,0xff828b82,0xff82ff82,0xff82ff82,
-0xff8aff84,0xff95ff8f,0xff9eff99,0xffa6ffa2,0xffacffa9,0xffb1ffaf,0xffb5ffb3,0xffb9ffb7,0xffbbffb9,0xffbcffbc,0xffbdffbd,0xffbcffbd,0xffbbffbc,0xffb7ffb9,0xffb2ffb5,0xffaaffaf,0xff9affa4,0x00003891,0xff824482,0xff82ff82,0xff82ff82,0xff85ff82,0xff8fff8a,0xff98ff93,0xffa0ff9c,0xffa8ffa4,0xffafffab,0xffb5ffb2,0xffb9ffb8,0xffbfffbd,0xffc3ffc1,0xffc2ffc4,
-0xffbbffbf,0xffb5ffb8,0xffafffb2,0xffa8ffab,0xff9fffa4,0xff93ff9a,0xf585ff8d,0x00005f82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x59820000,0xff82f982,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff9bff96,0xffa3ff9f,0xffaaffa7,0xffb0ffad,0xffb4ffb2,0xffb8ffb6,0xffbbffb9,0xffbdffbc,0xffbdffbd,
-0xffbdffbd,0xffbcffbd,0xffb9ffbb,0xffb5ffb7,0xffafffb2,0xffa3ffaa,0x3490ff99,0x30820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9cff98,0xffa4ffa1,0xffacffa8,0xffb2ffaf,0xffb8ffb5,0xffbdffbb,0xffc2ffc0,0xffc1ffc2,0xffbbffbe,0xffb6ffb8,0xffb1ffb3,0xffabffae,0xffa4ffa8,0xff9cffa1,0xff91ff97,0xad83ff89,0x00000b82,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x0b820000,0xff82ab82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff89,0xff96ff92,0xff9fff9b,0xffa6ffa3,0xffadffaa,0xffb2ffb0,0xffb6ffb4,0xffb9ffb8,0xffbcffbb,0xffbdffbc,0xffbdffbd,0xffbcffbd,0xffb9ffbb,0xffb7ffb9,0xffb1ffb4,0xffa9ffae,0xff98ffa3,0x0000308f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x38820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,0xff93ff90,0xff9dff99,0xffa4ffa1,0xffabffa8,0xffb2ffae,0xffb7ffb4,0xffbcffb9,0xffc0ffbe,0xffc3ffc1,0xffc5ffc4,0xffbfffc3,0xffb7ffbb,0xffadffb2,0xffa2ffa8,0xff93ff9c,0xc983ff8b,0x00001d82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x23820000,0xff82cb82,0xff82ff82,0xff82ff82,0xff8bff86,0xff96ff91,0xff9fff9a,0xffa6ffa2,0xffadffaa,0xffb2ffaf,0xffb6ffb4,0xffb9ffb8,0xffbcffbb,0xffbeffbd,0xffbeffbe,0xffbeffbe,0xffbcffbd,0xffb9ffbb,0xffb4ffb7,0xffacffb0,0xff9cffa5,0x00003692,0x3c820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff93ff90,
-0xff9dff99,0xffa4ffa1,0xffabffa8,0xffb2ffaf,0xffb7ffb5,0xffbcffb9,0xffc0ffbe,0xffc4ffc2,0xffc3ffc4,0xffbcffbf,0xffb4ffb8,0xffacffb0,0xffa3ffa8,0xff97ff9e,0xff88ff90,0x1182b182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb1820f82,0xff82ff82,0xff82ff82,0xff83ff82,
-0xff8cff87,0xff96ff91,0xff9fff9b,0xffa6ffa3,0xffadffaa,0xffb2ffb0,0xffb6ffb4,0xffb9ffb8,0xffbcffbb,0xffbdffbd,0xffbeffbe,0xffbdffbe,0xffbbffbd,0xffb8ffb9,0xffb3ffb6,0xffabffaf,0xff9affa4,0x00004090,0xff823a82,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8b,0xff99ff93,0xffa1ff9d,0xffa9ffa5,0xffb0ffac,0xffb6ffb3,0xffbbffb8,0xffc0ffbe,0xffc3ffc2,0xffc0ffc2,
-0xffb9ffbd,0xffb4ffb7,0xffaeffb1,0xffa8ffab,0xffa0ffa4,0xff97ff9c,0xff8aff91,0x9682ff83,0x00000d82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x09820000,0xfb829682,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff93ff90,0xff9cff98,0xffa4ffa0,0xffabffa8,0xffb0ffae,0xffb5ffb3,0xffb9ffb7,0xffbcffb9,0xffbdffbd,0xffbeffbe,
-0xffbeffbe,0xffbdffbe,0xffb9ffbc,0xffb6ffb8,0xffafffb3,0xffa4ffab,0x3291ff9a,0x3a820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff85,0xff93ff8f,0xff9dff99,0xffa5ffa1,0xffacffa9,0xffb3ffb0,0xffb9ffb6,0xffbeffbc,0xffc2ffc0,0xffbeffc1,0xffb9ffbb,0xffb4ffb7,0xffb0ffb2,0xffabffad,0xffa5ffa8,0xff9effa1,0xff93ff99,0xff87ff8e,0x1d82c782,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xc1821782,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff90ff8b,0xff98ff93,0xffa0ff9c,0xffa7ffa4,0xffaeffaa,0xffb3ffb1,0xffb7ffb5,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffbeffbe,0xffbdffbe,0xffbbffbc,0xffb8ffb9,0xffb2ffb5,0xffaaffaf,0xff9affa4,0x00003c90,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x2a820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,0xff95ff90,0xff9dff99,0xffa5ffa1,0xffacffa8,0xffb2ffaf,0xffb8ffb5,0xffbcffb9,0xffc0ffbe,0xffc4ffc2,0xffc4ffc5,0xffbdffc1,0xffb5ffb9,0xffadffb1,0xffa3ffa8,0xff97ff9d,0xff88ff90,0x6282ef82,0x00000182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x03820000,0xed826882,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff89,0xff98ff93,0xffa0ff9c,0xffa7ffa4,0xffaeffab,0xffb3ffb0,0xffb7ffb5,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffbfffbf,0xffbfffbf,0xffbdffbe,0xffb9ffbb,0xffb4ffb7,0xffacffb1,0xff9bffa6,0x00002e91,0x34820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff95ff90,
-0xff9dff99,0xffa5ffa1,0xffacffa8,0xffb2ffaf,0xffb8ffb5,0xffbdffbb,0xffc1ffbf,0xffc4ffc3,0xffc1ffc4,0xffb9ffbd,0xffb3ffb6,0xffacffaf,0xffa3ffa8,0xff99ff9f,0xff8dff93,0xe382ff86,0x00004782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3f820000,0xff82d982,0xff82ff82,0xff82ff82,0xff85ff82,
-0xff8fff8a,0xff98ff93,0xffa0ff9c,0xffa7ffa4,0xffaeffab,0xffb3ffb0,0xffb7ffb5,0xffb9ffb9,0xffbdffbc,0xffbeffbe,0xffbfffbf,0xffbeffbf,0xffbcffbd,0xffb9ffbb,0xffb4ffb7,0xffabffb0,0xff9bffa5,0x00003092,0xff823e82,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8b,0xff99ff95,0xffa1ff9e,0xffa9ffa5,0xffb0ffad,0xffb6ffb3,0xffbcffb9,0xffc1ffbe,0xffc2ffc2,0xffbdffc0,
-0xffb8ffbb,0xffb3ffb5,0xffadffb0,0xffa7ffaa,0xffa0ffa4,0xff98ff9c,0xff8dff93,0xff83ff87,0x4482db82,0x00000182,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01820000,0xdd824c82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff89,0xff96ff92,0xff9eff9a,0xffa5ffa2,0xffacffa9,0xffb1ffaf,0xffb6ffb4,0xffb9ffb8,0xffbcffbb,0xffbeffbd,0xffbfffbf,
-0xffbfffbf,0xffbeffbf,0xffbbffbd,0xffb7ffb9,0xffb0ffb4,0xffa5ffab,0x3a91ff9b,0x46820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8bff86,0xff95ff90,0xff9eff9a,0xffa6ffa2,0xffadffaa,0xffb4ffb1,0xffb9ffb7,0xffbfffbd,0xffc0ffc1,0xffbbffbe,0xffb7ffb9,0xffb3ffb5,0xffafffb1,0xffaaffac,0xffa5ffa8,0xff9effa2,0xff96ff9a,0xff8bff91,0xe782ff85,0x00005182,0x00000000,
-0x00000000,0x00000000,0x00000000,0x45820000,0xff82e982,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff85,0xff92ff8e,0xff9aff96,0xffa1ff9d,0xffa8ffa5,0xffaeffab,0xffb4ffb1,0xffb8ffb6,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffbfffbf,0xffbeffbf,0xffbcffbd,0xffb9ffbb,0xffb3ffb6,0xffabffb0,0xff9bffa5,0x00005090,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x14820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff95ff90,0xff9dff99,0xffa5ffa1,0xffacffa9,0xffb2ffaf,0xffb8ffb5,0xffbdffbb,0xffc1ffbf,0xffc4ffc3,0xffc3ffc5,0xffbcffbf,0xffb4ffb8,0xffacffb0,0xffa3ffa8,0xff99ff9e,0xff8cff92,0xff82ff85,0x4a82cf82,0x00000782,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x05820000,0xc3824e82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff91ff8c,0xff9aff95,0xffa1ff9e,0xffa8ffa5,0xffaeffab,0xffb4ffb1,0xffb8ffb6,0xffbcffb9,0xffbeffbd,0xffc0ffbf,0xffc0ffc0,0xffbfffc0,0xffbeffbf,0xffb9ffbc,0xffb5ffb8,0xffacffb1,0xff9affa6,0x00001492,0x26820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,0xff95ff90,
-0xff9dff99,0xffa5ffa1,0xffacffa9,0xffb3ffb0,0xffb9ffb6,0xffbeffbb,0xffc2ffc0,0xffc4ffc4,0xffbfffc2,0xffb8ffbb,0xffb2ffb5,0xffabffaf,0xffa3ffa7,0xff9bff9f,0xff90ff95,0xff84ff89,0xaa82fd82,0x00002b82,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x31820000,0xff82ae82,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,
-0xff92ff8d,0xff9aff96,0xffa2ff9e,0xffa8ffa5,0xffaeffac,0xffb4ffb1,0xffb8ffb6,0xffbbffb9,0xffbeffbd,0xffbfffbf,0xffc0ffc0,0xffbfffbf,0xffbdffbe,0xffb9ffbc,0xffb4ffb7,0xffacffb1,0xff9bffa5,0x00002a91,0xff823482,0xff82ff82,0xff82ff82,0xff86ff83,0xff91ff8c,0xff9aff95,0xffa2ff9e,0xffaaffa6,0xffb1ffad,0xffb7ffb4,0xffbcffb9,0xffc1ffbf,0xffc1ffc2,0xffbbffbe,
-0xffb6ffb9,0xffb1ffb4,0xffacffaf,0xffa7ffaa,0xffa1ffa4,0xff99ff9d,0xff8fff95,0xff84ff8a,0xff82ff82,0x5682c382,0x00000d82,0x00000000,0x00000000,0x00000000,0x11820000,0xc3825682,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff83,0xff90ff8c,0xff98ff93,0xff9fff9c,0xffa6ffa3,0xffadffaa,0xffb2ffaf,0xffb7ffb4,0xffb9ffb9,0xffbdffbc,0xffbfffbe,0xffc0ffc0,
-0xffc0ffc0,0xffbfffbf,0xffbcffbd,0xffb8ffb9,0xffb1ffb4,0xffa6ffac,0x3092ff9b,0x46820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff86,0xff95ff91,0xff9eff9a,0xffa7ffa3,0xffaeffaa,0xffb4ffb1,0xffbbffb8,0xffbfffbd,0xffbeffc0,0xffb9ffbc,0xffb5ffb7,0xffb2ffb3,0xffaeffb0,0xffaaffac,0xffa5ffa7,0xff9fffa2,0xff97ff9b,0xff8dff93,0xff83ff87,0xb082ff82,0x00002582,
-0x00000000,0x00000000,0x21820000,0xfd82ac82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8cff87,0xff93ff90,0xff9bff98,0xffa2ff9f,0xffa9ffa6,0xffafffac,0xffb4ffb1,0xffb9ffb7,0xffbcffb9,0xffbeffbd,0xffbfffbf,0xffc0ffc0,0xffbfffbf,0xffbdffbe,0xffb9ffbb,0xffb4ffb7,0xffacffb0,0xff9bffa5,0x00005092,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x07820000,0xff82fd82,0xff82ff82,0xff83ff82,0xff8cff86,0xff95ff90,0xff9dff99,0xffa5ffa2,0xffacffa9,0xffb3ffb0,0xffb8ffb6,0xffbdffbb,0xffc2ffc0,0xffc5ffc3,0xffc1ffc4,0xffb9ffbe,0xffb3ffb7,0xffabffaf,0xffa3ffa7,0xff99ff9e,0xff8eff93,0xff83ff88,0xff82ff82,0x9282e982,0x42825e82,0x16822882,0x0a820e82,0x1a820a82,0x40822e82,0x30823882,0x08821282,0x08820a82,
-0x2a821082,0x58823882,0xe3829682,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9cff98,0xffa3ffa0,0xffa9ffa6,0xffafffac,0xffb5ffb2,0xffb9ffb7,0xffbcffbb,0xffbfffbe,0xffc0ffc0,0xffc1ffc1,0xffc0ffc1,0xffbeffbf,0xffbbffbd,0xffb5ffb8,0xffadffb2,0xf99bffa6,0x00000990,0x14820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff95ff90,
-0xff9eff9a,0xffa6ffa2,0xffadffa9,0xffb3ffb0,0xffb9ffb6,0xffbeffbc,0xffc2ffc0,0xffc3ffc4,0xffbdffc0,0xffb7ffb9,0xffb1ffb4,0xffaaffae,0xffa3ffa7,0xff9bff9f,0xff92ff97,0xff86ff8c,0xff82ff82,0xb682fd82,0x2c826a82,0x01820882,0x00000000,0x00000000,0x00000000,0x00000000,0x12820182,0x66823082,0xfd82c882,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,
-0xff93ff90,0xff9cff98,0xffa3ffa0,0xffaaffa7,0xffafffad,0xffb5ffb2,0xffb9ffb7,0xffbcffbb,0xffbfffbd,0xffc0ffbf,0xffc0ffc0,0xffc0ffc0,0xffbeffbf,0xffb9ffbc,0xffb5ffb8,0xffacffb1,0xff9affa6,0x00002291,0xff823082,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9aff95,0xffa3ff9e,0xffaaffa7,0xffb1ffae,0xffb8ffb5,0xffbdffb9,0xffc1ffc0,0xffbeffc1,0xffb9ffbc,
-0xffb5ffb7,0xffb0ffb2,0xffabffae,0xffa6ffa9,0xffa0ffa3,0xff99ff9d,0xff90ff95,0xff86ff8b,0xff82ff82,0xff82ff82,0xcc82f782,0x7c829e82,0x5e825c82,0x9e827e82,0xf782c682,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8aff86,0xff92ff8e,0xff9aff96,0xffa1ff9e,0xffa8ffa4,0xffadffaa,0xffb3ffb0,0xffb7ffb5,0xffbbffb9,0xffbeffbd,0xffc0ffbf,0xffc1ffc0,
-0xffc1ffc1,0xffbfffc0,0xffbdffbe,0xffb8ffbb,0xffb1ffb5,0xffa6ffad,0x3092ff9b,0x50820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff96ff91,0xff9fff9a,0xffa7ffa3,0xffafffab,0xffb5ffb2,0xffbbffb8,0xffbfffbe,0xffbcffbe,0xffb7ffb9,0xffb4ffb6,0xffb0ffb2,0xffadffaf,0xffa9ffab,0xffa4ffa7,0xff9fffa1,0xff98ff9b,0xff8fff93,0xff84ff89,0xff82ff82,0xb682fb82,
-0x4c826482,0x70824c82,0xf982b482,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8eff8a,0xff96ff92,0xff9dff99,0xffa4ffa0,0xffaaffa7,0xffafffad,0xffb5ffb2,0xffb9ffb7,0xffbcffbb,0xffbfffbe,0xffc0ffbf,0xffc0ffc0,0xffc0ffc0,0xffbeffbf,0xffb9ffbc,0xffb5ffb8,0xffacffb1,0xff9dffa6,0x00005092,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff82ee82,0xff82ff82,0xff83ff82,0xff8cff86,0xff95ff90,0xff9eff9a,0xffa5ffa2,0xffadffa9,0xffb3ffb0,0xffb9ffb6,0xffbeffbb,0xffc2ffc0,0xffc5ffc4,0xffbfffc3,0xffb9ffbc,0xffb2ffb5,0xffaaffae,0xffa3ffa7,0xff99ff9e,0xff8fff93,0xff84ff89,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff89,0xff96ff92,0xff9eff9a,0xffa5ffa1,0xffaaffa8,0xffb0ffad,0xffb5ffb3,0xffb9ffb8,0xffbdffbc,0xffc0ffbf,0xffc1ffc1,0xffc2ffc1,0xffc1ffc1,0xffbfffc0,0xffbbffbd,0xffb6ffb9,0xffadffb2,0xec9bffa6,0x00000000,0x10820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff95ff91,
-0xff9eff9a,0xffa6ffa2,0xffadffaa,0xffb4ffb1,0xffb9ffb7,0xffbfffbc,0xffc3ffc1,0xffc1ffc3,0xffbbffbe,0xffb5ffb8,0xffafffb2,0xffa9ffac,0xffa3ffa6,0xff9bff9f,0xff92ff97,0xff87ff8d,0xff82ff83,0xff82ff82,0xff82ff82,0xeb82ff82,0xca82d482,0xb682b282,0xb282b882,0xd082c082,0xff82eb82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8eff8a,
-0xff96ff92,0xff9eff9a,0xffa5ffa1,0xffabffa8,0xffb0ffae,0xffb5ffb3,0xffb9ffb7,0xffbdffbb,0xffbfffbe,0xffc1ffc0,0xffc1ffc1,0xffc1ffc1,0xffbeffc0,0xffbbffbd,0xffb6ffb9,0xffadffb2,0xff99ffa6,0x00001290,0xff823082,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9aff96,0xffa3ff9f,0xffabffa7,0xffb2ffae,0xffb8ffb5,0xffbeffbb,0xffc1ffc0,0xffbcffbf,0xffb7ffb9,
-0xffb3ffb5,0xffafffb1,0xffaaffad,0xffa5ffa8,0xffa0ffa3,0xff99ff9c,0xff90ff95,0xff86ff8c,0xff82ff83,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8dff88,0xff95ff91,0xff9cff98,0xffa2ff9f,0xffa9ffa6,0xffaeffac,0xffb3ffb1,0xffb8ffb6,0xffbcffb9,0xffbfffbd,0xffc0ffc0,0xffc1ffc1,
-0xffc1ffc1,0xffc0ffc1,0xffbdffbf,0xffb9ffbb,0xffb2ffb6,0xffa6ffad,0x2c92ff9b,0x54820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff96ff92,0xff9fff9b,0xffa8ffa3,0xffafffac,0xffb6ffb3,0xffbcffb9,0xffbeffbe,0xffb9ffbb,0xffb6ffb7,0xffb2ffb4,0xffafffb1,0xffacffad,0xffa8ffaa,0xffa3ffa6,0xff9effa1,0xff97ff9b,0xff8fff93,0xff85ff8a,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff90ff8d,0xff98ff93,0xff9eff9b,0xffa5ffa1,0xffabffa8,0xffb0ffad,0xffb5ffb3,0xffb9ffb7,0xffbdffbb,0xffbfffbe,0xffc1ffc0,0xffc1ffc1,0xffc0ffc1,0xffbeffbf,0xffbbffbd,0xffb5ffb8,0xffadffb1,0xff9dffa7,0x00005093,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff82d082,0xff82ff82,0xff82ff82,0xff8bff86,0xff95ff90,0xff9eff9a,0xffa6ffa2,0xffadffa9,0xffb3ffb0,0xffb9ffb6,0xffbeffbc,0xffc2ffc0,0xffc4ffc4,0xffbdffc1,0xffb7ffb9,0xffb0ffb4,0xffa9ffad,0xffa2ffa5,0xff99ff9e,0xff8fff93,0xff84ff89,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff84,0xff90ff8c,0xff98ff93,0xffa0ff9c,0xffa6ffa3,0xffacffa9,0xffb1ffae,0xffb6ffb3,0xffb9ffb8,0xffbeffbc,0xffc0ffbf,0xffc2ffc1,0xffc2ffc2,0xffc2ffc2,0xffbfffc1,0xffbcffbe,0xffb6ffb9,0xffadffb2,0xd09bffa6,0x00000000,0x09820000,0xff82fd82,0xff82ff82,0xff83ff82,0xff8cff87,0xff95ff91,
-0xff9eff9a,0xffa6ffa2,0xffaeffaa,0xffb4ffb1,0xffb9ffb7,0xffbfffbd,0xffc3ffc1,0xffbfffc2,0xffb9ffbc,0xffb4ffb6,0xffaeffb1,0xffa8ffab,0xffa2ffa5,0xff9bff9e,0xff92ff97,0xff88ff8d,0xff82ff83,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff91ff8c,
-0xff99ff95,0xffa0ff9c,0xffa6ffa3,0xffacffa9,0xffb1ffaf,0xffb6ffb3,0xffb9ffb8,0xffbeffbc,0xffc0ffbf,0xffc1ffc1,0xffc2ffc2,0xffc1ffc2,0xffbfffc0,0xffbcffbe,0xffb6ffb9,0xffadffb2,0xf39bffa6,0x00000390,0xff821e82,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9bff96,0xffa3ff9f,0xffabffa7,0xffb2ffaf,0xffb8ffb5,0xffbeffbb,0xffbfffc0,0xffb9ffbc,0xffb5ffb8,
-0xffb1ffb3,0xffadffaf,0xffa9ffab,0xffa4ffa7,0xff9effa1,0xff97ff9b,0xff8fff93,0xff85ff8a,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff87ff84,0xff8fff8b,0xff96ff93,0xff9dff9a,0xffa4ffa1,0xffaaffa7,0xffafffac,0xffb4ffb2,0xffb8ffb6,0xffbcffb9,0xffbfffbe,0xffc1ffc0,0xffc2ffc1,
-0xffc2ffc2,0xffc0ffc1,0xffbdffbf,0xffb9ffbb,0xffb2ffb6,0xffa7ffad,0x1c92ff9b,0x52820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff87,0xff97ff92,0xffa0ff9b,0xffa8ffa4,0xffb0ffac,0xffb6ffb3,0xffbcffb9,0xffbbffbd,0xffb7ffb9,0xffb4ffb5,0xffb1ffb2,0xffaeffaf,0xffaaffac,0xffa7ffa9,0xffa2ffa5,0xff9dffa0,0xff96ff9a,0xff8eff92,0xff84ff89,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff87,0xff92ff8f,0xff99ff96,0xffa0ff9c,0xffa6ffa3,0xffabffa9,0xffb1ffae,0xffb5ffb3,0xffb9ffb8,0xffbdffbc,0xffc0ffbf,0xffc1ffc0,0xffc1ffc1,0xffc1ffc1,0xffbfffc0,0xffbbffbd,0xffb6ffb9,0xffadffb2,0xff9dffa7,0x00005493,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff82b882,0xff82ff82,0xff82ff82,0xff8bff86,0xff95ff90,0xff9eff9a,0xffa6ffa2,0xffadffa9,0xffb3ffb0,0xffb9ffb6,0xffbeffbc,0xffc2ffc0,0xffc2ffc4,0xffbbffbf,0xffb5ffb8,0xffaeffb2,0xffa8ffab,0xffa0ffa4,0xff98ff9c,0xff8eff93,0xff84ff88,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,0xff93ff8f,0xff9aff96,0xffa1ff9e,0xffa8ffa5,0xffadffaa,0xffb1ffaf,0xffb7ffb4,0xffbbffb9,0xffbeffbd,0xffc1ffc0,0xffc2ffc2,0xffc3ffc3,0xffc2ffc2,0xffc0ffc1,0xffbcffbe,0xffb6ffb9,0xffadffb2,0xb49bffa5,0x00000000,0x00000000,0xff82ec82,0xff82ff82,0xff83ff82,0xff8cff87,0xff95ff91,
-0xff9eff9a,0xffa6ffa3,0xffaeffaa,0xffb4ffb1,0xffb9ffb7,0xffbfffbd,0xffc2ffc2,0xffbdffc0,0xffb7ffb9,0xffb2ffb4,0xffadffaf,0xffa7ffaa,0xffa1ffa4,0xff99ff9d,0xff91ff95,0xff87ff8c,0xff82ff83,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8bff87,0xff93ff8f,
-0xff9aff97,0xffa1ff9e,0xffa7ffa4,0xffadffaa,0xffb2ffb0,0xffb6ffb4,0xffbbffb9,0xffbeffbc,0xffc0ffbf,0xffc2ffc1,0xffc2ffc2,0xffc2ffc2,0xffbfffc1,0xffbcffbe,0xffb6ffb9,0xffadffb2,0xf09bffa6,0x00000000,0xff822682,0xff82ff82,0xff82ff82,0xff87ff83,0xff91ff8c,0xff9bff96,0xffa3ff9f,0xffabffa7,0xffb2ffaf,0xffb9ffb5,0xffbeffbb,0xffbdffbf,0xffb8ffb9,0xffb3ffb6,
-0xffafffb1,0xffacffae,0xffa7ffa9,0xffa2ffa5,0xff9dffa0,0xff96ff99,0xff8dff92,0xff85ff88,0xff83ff83,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff89ff85,0xff91ff8d,0xff98ff95,0xff9fff9b,0xffa5ffa2,0xffaaffa8,0xffb0ffad,0xffb4ffb2,0xffb9ffb7,0xffbcffb9,0xffbfffbe,0xffc1ffc0,0xffc2ffc2,
-0xffc2ffc2,0xffc0ffc1,0xffbeffbf,0xffb9ffbc,0xffb2ffb6,0xffa7ffad,0x1a92ff9b,0x60820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff87,0xff97ff92,0xffa0ff9b,0xffa8ffa4,0xffb0ffac,0xffb7ffb3,0xffbcffb9,0xffb9ffbb,0xffb5ffb7,0xffb2ffb3,0xffafffb0,0xffacffad,0xffa9ffab,0xffa5ffa7,0xffa1ffa3,0xff9bff9e,0xff93ff98,0xff8cff90,0xff84ff87,0xff82ff83,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8cff89,0xff93ff90,0xff9aff97,0xffa1ff9e,0xffa6ffa4,0xffacffa9,0xffb1ffaf,0xffb6ffb3,0xffb9ffb8,0xffbdffbc,0xffc0ffbf,0xffc1ffc1,0xffc2ffc1,0xffc1ffc1,0xffbfffc0,0xffbbffbd,0xffb6ffb9,0xffadffb2,0xff9effa7,0x00005c93,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff829e82,0xff82ff82,0xff82ff82,0xff8bff85,0xff95ff90,0xff9dff99,0xffa5ffa1,0xffadffa9,0xffb3ffb0,0xffb9ffb6,0xffbeffbc,0xffc2ffc0,0xffc0ffc3,0xffb9ffbd,0xffb3ffb6,0xffacffb0,0xffa6ffa9,0xff9effa2,0xff95ff9a,0xff8cff91,0xff83ff87,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff85ff82,0xff8dff89,0xff95ff91,0xff9cff98,0xffa3ff9f,0xffa9ffa6,0xffaeffab,0xffb2ffb0,0xffb7ffb4,0xffbbffb9,0xffbfffbd,0xffc1ffc0,0xffc3ffc2,0xffc3ffc3,0xffc2ffc3,0xffc0ffc1,0xffbcffbe,0xffb6ffb9,0xffacffb2,0xa699ffa4,0x00000000,0x00000000,0xff82e482,0xff82ff82,0xff83ff82,0xff8cff86,0xff95ff91,
-0xff9eff9a,0xffa6ffa2,0xffaeffaa,0xffb4ffb1,0xffb9ffb7,0xffbfffbd,0xffc0ffc1,0xffb9ffbd,0xffb5ffb8,0xffb0ffb2,0xffabffad,0xffa5ffa8,0xff9fffa2,0xff97ff9b,0xff8fff93,0xff86ff8a,0xff83ff83,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8dff89,0xff95ff91,
-0xff9cff98,0xffa2ff9f,0xffa8ffa6,0xffaeffab,0xffb3ffb0,0xffb6ffb4,0xffbbffb9,0xffbeffbd,0xffc1ffc0,0xffc2ffc2,0xffc3ffc2,0xffc2ffc2,0xffc0ffc1,0xffbcffbe,0xffb6ffb9,0xffadffb2,0xda9bffa6,0x00000000,0xff822482,0xff82ff82,0xff82ff82,0xff86ff83,0xff91ff8c,0xff9aff96,0xffa3ff9f,0xffabffa7,0xffb2ffaf,0xffb8ffb5,0xffbeffbb,0xffb9ffbd,0xffb5ffb7,0xffb1ffb3,
-0xffadffaf,0xffaaffac,0xffa5ffa7,0xffa0ffa3,0xff9aff9d,0xff93ff97,0xff8cff8f,0xff88ff8a,0xff87ff88,0xff85ff86,0xff83ff84,0xff82ff83,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8bff87,0xff92ff8e,0xff99ff96,0xffa0ff9c,0xffa6ffa3,0xffabffa8,0xffb0ffae,0xffb5ffb3,0xffb9ffb7,0xffbcffb9,0xffbfffbe,0xffc1ffc0,0xffc2ffc2,
-0xffc2ffc2,0xffc0ffc1,0xffbeffbf,0xffb9ffbc,0xffb2ffb6,0xffa6ffad,0x1c90ff9a,0x6c820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8dff87,0xff97ff92,0xffa0ff9b,0xffa8ffa4,0xffb0ffac,0xffb7ffb3,0xffb9ffb9,0xffb6ffb8,0xffb3ffb4,0xffb0ffb1,0xffadffae,0xffaaffac,0xffa7ffa9,0xffa3ffa5,0xff9fffa1,0xff99ff9c,0xff91ff95,0xff8bff8e,0xff88ff89,0xff86ff87,0xff84ff85,
-0xff82ff83,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff8eff8a,0xff95ff91,0xff9bff98,0xffa1ff9e,0xffa7ffa4,0xffacffaa,0xffb1ffaf,0xffb6ffb4,0xffb9ffb8,0xffbdffbc,0xffc0ffbf,0xffc1ffc0,0xffc1ffc1,0xffc1ffc1,0xffbfffc0,0xffbbffbd,0xffb6ffb9,0xffadffb2,0xff9dffa7,0x00005693,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff828482,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9dff99,0xffa5ffa1,0xffacffa9,0xffb3ffb0,0xffb9ffb6,0xffbeffbb,0xffc2ffc0,0xffbeffc1,0xffb7ffb9,0xffb0ffb4,0xffaaffad,0xffa3ffa7,0xff9bff9f,0xff92ff97,0xff8aff8e,0xff87ff88,0xff86ff86,0xff85ff85,0xff84ff85,0xff83ff84,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff83ff84,0xff82ff82,
-0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff84ff83,0xff88ff85,0xff8fff8b,0xff96ff93,0xff9dff9a,0xffa4ffa1,0xffa9ffa7,0xffaeffac,0xffb2ffb0,0xffb7ffb4,0xffbbffb9,0xffbfffbd,0xffc1ffc0,0xffc3ffc2,0xffc3ffc3,0xffc2ffc3,0xffc0ffc1,0xffbcffbe,0xffb6ffb9,0xffacffb2,0x8298ffa3,0x00000000,0x00000000,0xff82ca82,0xff82ff82,0xff82ff82,0xff8bff86,0xff95ff90,
-0xff9eff99,0xffa6ffa2,0xffadffaa,0xffb4ffb1,0xffb9ffb7,0xffbfffbd,0xffbeffc0,0xffb8ffbb,0xffb3ffb5,0xffaeffb0,0xffa8ffab,0xffa3ffa6,0xff9cffa0,0xff95ff98,0xff8dff90,0xff88ff8a,0xff87ff87,0xff86ff86,0xff84ff85,0xff83ff84,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff83,0xff87ff84,0xff8fff8b,0xff96ff93,
-0xff9dff9a,0xffa3ffa0,0xffa9ffa6,0xffaeffac,0xffb3ffb1,0xffb7ffb5,0xffbbffb9,0xffbeffbd,0xffc1ffc0,0xffc2ffc2,0xffc3ffc3,0xffc2ffc2,0xffc0ffc1,0xffbcffbe,0xffb6ffb9,0xffacffb2,0xca9affa5,0x00000000,0xff822282,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8b,0xff9aff95,0xffa3ff9e,0xffaaffa7,0xffb2ffae,0xffb8ffb5,0xffbcffbb,0xffb7ffb9,0xffb3ffb5,0xffafffb1,
-0xffabffad,0xffa7ffa9,0xffa3ffa5,0xff9dffa0,0xff97ff9a,0xff91ff93,0xff8fff90,0xff8fff8f,0xff8dff8e,0xff8bff8c,0xff89ff8a,0xff85ff87,0xff82ff83,0xff82ff82,0xff82ff82,0xff83ff82,0xff84ff83,0xff85ff84,0xff88ff86,0xff8cff8a,0xff93ff8f,0xff9aff96,0xffa0ff9d,0xffa6ffa3,0xffabffa9,0xffb0ffae,0xffb5ffb3,0xffb8ffb7,0xffbcffb9,0xffbfffbd,0xffc1ffc0,0xffc2ffc1,
-0xffc1ffc2,0xffc0ffc1,0xffbdffbf,0xffb9ffbb,0xffb1ffb5,0xffa6ffac,0x1091ff99,0x70820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff96ff91,0xff9fff9b,0xffa8ffa4,0xffafffac,0xffb6ffb3,0xffb8ffb8,0xffb3ffb5,0xffb0ffb2,0xffadffaf,0xffabffac,0xffa8ffa9,0xffa5ffa6,0xffa1ffa3,0xff9cff9e,0xff96ff99,0xff91ff93,0xff8fff90,0xff8eff8f,0xff8cff8d,0xff89ff8b,
-0xff84ff87,0xff82ff82,0xff82ff82,0xff82ff82,0xff83ff82,0xff84ff83,0xff88ff86,0xff8fff8b,0xff95ff92,0xff9cff99,0xffa2ff9f,0xffa7ffa5,0xffacffaa,0xffb1ffaf,0xffb6ffb4,0xffb9ffb8,0xffbdffbb,0xffbfffbe,0xffc1ffc0,0xffc1ffc1,0xffc0ffc1,0xffbeffbf,0xffbbffbd,0xffb5ffb8,0xffacffb1,0xff9dffa6,0x00007092,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff826a82,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,0xff9cff98,0xffa4ffa0,0xffacffa8,0xffb2ffaf,0xffb8ffb5,0xffbdffbb,0xffc1ffbf,0xffbbffbe,0xffb4ffb7,0xffaeffb1,0xffa7ffaa,0xffa0ffa3,0xff98ff9c,0xff91ff93,0xff8eff8f,0xff8dff8d,0xff8dff8d,0xff8cff8c,0xff8aff8b,0xff88ff89,0xff84ff86,0xff83ff83,0xff85ff84,0xff89ff87,0xff89ff8a,0xff86ff87,
-0xff85ff86,0xff86ff85,0xff87ff86,0xff88ff87,0xff89ff89,0xff8bff8a,0xff90ff8d,0xff97ff93,0xff9eff9b,0xffa4ffa1,0xffaaffa7,0xffafffad,0xffb2ffb1,0xffb6ffb4,0xffbbffb9,0xffbeffbd,0xffc1ffc0,0xffc2ffc2,0xffc3ffc3,0xffc2ffc2,0xffc0ffc1,0xffbcffbe,0xffb5ffb9,0xffabffb1,0x6a97ffa2,0x00000000,0x00000000,0xff82c882,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,
-0xff9dff99,0xffa5ffa1,0xffadffa9,0xffb4ffb0,0xffb9ffb7,0xffbfffbc,0xffbbffbe,0xffb5ffb8,0xffb0ffb2,0xffabffad,0xffa6ffa8,0xffa0ffa3,0xff99ff9c,0xff92ff95,0xff8fff90,0xff8eff8e,0xff8dff8e,0xff8cff8d,0xff8aff8b,0xff87ff89,0xff84ff86,0xff83ff83,0xff85ff84,0xff84ff84,0xff84ff84,0xff84ff84,0xff85ff84,0xff86ff85,0xff88ff87,0xff8bff89,0xff90ff8d,0xff97ff93,
-0xff9eff9a,0xffa4ffa1,0xffaaffa7,0xffafffac,0xffb3ffb1,0xffb7ffb5,0xffb9ffb8,0xffbeffbc,0xffc0ffbf,0xffc2ffc1,0xffc2ffc2,0xffc1ffc2,0xffbfffc1,0xffbcffbe,0xffb6ffb9,0xffacffb1,0xb499ffa4,0x00000000,0xff821a82,0xff82ff82,0xff82ff82,0xff85ff82,0xff90ff8a,0xff99ff93,0xffa2ff9d,0xffaaffa6,0xffb1ffad,0xffb7ffb4,0xffb9ffb9,0xffb4ffb7,0xffb0ffb2,0xffacffae,
-0xffa8ffaa,0xffa4ffa6,0xff9fffa2,0xff9aff9c,0xff96ff98,0xff95ff95,0xff95ff95,0xff93ff95,0xff93ff93,0xff92ff92,0xff8fff90,0xff8bff8d,0xff86ff88,0xff85ff85,0xff85ff85,0xff87ff86,0xff89ff88,0xff8cff8a,0xff8dff8d,0xff90ff8f,0xff93ff92,0xff9aff96,0xffa0ff9d,0xffa6ffa3,0xffabffa9,0xffb0ffae,0xffb4ffb2,0xffb8ffb6,0xffbbffb9,0xffbeffbc,0xffc0ffbf,0xffc1ffc0,
-0xffc1ffc1,0xffbfffc0,0xffbcffbe,0xffb8ffb9,0xffb0ffb4,0xffa4ffab,0x148fff98,0x74820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,0xff95ff91,0xff9fff9a,0xffa7ffa3,0xffafffab,0xffb6ffb2,0xffb5ffb7,0xffb1ffb2,0xffadffaf,0xffabffac,0xffa8ffa9,0xffa5ffa7,0xffa2ffa3,0xff9dffa0,0xff99ff9b,0xff96ff97,0xff95ff95,0xff95ff95,0xff93ff93,0xff92ff93,0xff90ff91,
-0xff89ff8d,0xff83ff85,0xff83ff83,0xff85ff84,0xff87ff86,0xff8aff88,0xff8cff8b,0xff90ff8e,0xff95ff93,0xff9cff98,0xffa2ff9f,0xffa7ffa5,0xffacffaa,0xffb1ffaf,0xffb5ffb3,0xffb9ffb7,0xffbcffb9,0xffbeffbd,0xffc0ffbf,0xffc0ffc0,0xffbfffc0,0xffbdffbe,0xffb9ffbc,0xffb4ffb7,0xffabffb0,0xff9cffa5,0x00008091,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff825682,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,0xff9bff97,0xffa3ff9f,0xffabffa7,0xffb1ffae,0xffb7ffb4,0xffbcffb9,0xffbeffbe,0xffb8ffbb,0xffb1ffb4,0xffaaffae,0xffa3ffa7,0xff9cffa0,0xff96ff98,0xff93ff93,0xff93ff93,0xff93ff93,0xff93ff93,0xff92ff92,0xff90ff91,0xff8eff8f,0xff8aff8c,0xff87ff87,0xff8bff89,0xff8fff8e,0xff90ff91,0xff8dff8e,
-0xff8dff8d,0xff8dff8d,0xff8eff8d,0xff8fff8e,0xff90ff90,0xff92ff91,0xff93ff92,0xff97ff95,0xff9eff9b,0xffa4ffa1,0xffaaffa7,0xffafffac,0xffb2ffb1,0xffb5ffb3,0xffb9ffb8,0xffbeffbc,0xffc0ffbf,0xffc2ffc1,0xffc2ffc2,0xffc1ffc2,0xffbfffc0,0xffbbffbd,0xffb5ffb8,0xffaaffb0,0x5495ffa0,0x00000000,0x00000000,0xff82b082,0xff82ff82,0xff82ff82,0xff89ff84,0xff93ff8e,
-0xff9cff98,0xffa4ffa0,0xffacffa8,0xffb3ffaf,0xffb9ffb6,0xffbdffbb,0xffb8ffbb,0xffb2ffb5,0xffadffaf,0xffa8ffaa,0xffa2ffa5,0xff9cff9f,0xff97ff99,0xff93ff95,0xff93ff93,0xff93ff93,0xff93ff93,0xff92ff93,0xff91ff92,0xff8eff8f,0xff89ff8c,0xff88ff88,0xff8bff8a,0xff89ff8b,0xff89ff89,0xff8aff89,0xff8bff8a,0xff8dff8c,0xff8fff8e,0xff90ff90,0xff93ff91,0xff97ff95,
-0xff9eff9a,0xffa4ffa1,0xffaaffa7,0xffafffac,0xffb3ffb1,0xffb6ffb5,0xffb9ffb8,0xffbdffbb,0xffc0ffbe,0xffc1ffc0,0xffc1ffc1,0xffc1ffc1,0xffbfffc0,0xffbbffbd,0xffb5ffb8,0xffabffb0,0xb498ffa3,0x00000000,0xff821e82,0xff82ff82,0xff82ff82,0xff84ff82,0xff8eff89,0xff98ff93,0xffa0ff9c,0xffa8ffa4,0xffb0ffac,0xffb6ffb3,0xffb7ffb8,0xffb1ffb4,0xffadffaf,0xffa9ffab,
-0xffa5ffa7,0xffa0ffa2,0xff9cff9e,0xff9aff9b,0xff9aff99,0xff9aff9a,0xff9aff9a,0xff9aff9a,0xff99ff99,0xff97ff98,0xff95ff96,0xff91ff93,0xff8dff8f,0xff8bff8c,0xff8cff8b,0xff8dff8d,0xff8fff8e,0xff92ff90,0xff93ff93,0xff95ff95,0xff97ff96,0xff9bff99,0xff9fff9d,0xffa5ffa2,0xffaaffa8,0xffafffad,0xffb3ffb1,0xffb7ffb5,0xffb9ffb8,0xffbcffbb,0xffbeffbd,0xffbfffbf,
-0xffbfffbf,0xffbeffbf,0xffbbffbc,0xffb6ffb9,0xffafffb3,0xffa3ffaa,0x1e8dff97,0x98820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9dff99,0xffa6ffa2,0xffaeffaa,0xffb4ffb1,0xffb1ffb4,0xffadffaf,0xffaaffac,0xffa8ffa9,0xffa5ffa6,0xffa2ffa3,0xff9effa0,0xff9cff9d,0xff9aff9a,0xff9aff9a,0xff9bff9a,0xff9aff9a,0xff99ff9a,0xff98ff99,0xff96ff97,
-0xff8fff93,0xff88ff8b,0xff88ff87,0xff8bff89,0xff8dff8c,0xff90ff8f,0xff92ff91,0xff95ff93,0xff97ff96,0xff9cff99,0xffa1ff9e,0xffa6ffa4,0xffabffa9,0xffb0ffae,0xffb4ffb2,0xffb8ffb6,0xffb9ffb9,0xffbdffbc,0xffbeffbd,0xffbeffbe,0xffbeffbe,0xffbbffbd,0xffb8ffb9,0xffb2ffb5,0xffaaffaf,0xff9bffa4,0x00009290,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff824882,0xff82ff82,0xff82ff82,0xff86ff83,0xff90ff8c,0xff9aff95,0xffa2ff9e,0xffa9ffa5,0xffb0ffac,0xffb5ffb2,0xffb9ffb8,0xffbcffbc,0xffb4ffb8,0xffadffb0,0xffa6ffaa,0xff9fffa3,0xff9aff9c,0xff98ff99,0xff99ff99,0xff99ff99,0xff99ff99,0xff98ff99,0xff98ff98,0xff96ff97,0xff93ff95,0xff90ff92,0xff8dff8d,0xff91ff8f,0xff96ff93,0xff97ff97,0xff93ff95,
-0xff93ff93,0xff93ff93,0xff93ff93,0xff95ff95,0xff97ff96,0xff98ff97,0xff99ff98,0xff9bff9a,0xff9eff9c,0xffa3ffa0,0xffa9ffa6,0xffaeffac,0xffb1ffb0,0xffb4ffb2,0xffb8ffb6,0xffbcffb9,0xffbfffbe,0xffc0ffc0,0xffc1ffc1,0xffc0ffc1,0xffbeffbf,0xffb9ffbc,0xffb3ffb7,0xffa8ffae,0x4a93ff9e,0x00000000,0x00000000,0xff82b082,0xff82ff82,0xff82ff82,0xff88ff83,0xff92ff8d,
-0xff9bff96,0xffa3ff9f,0xffabffa7,0xffb1ffae,0xffb7ffb4,0xffb9ffb9,0xffb5ffb8,0xffafffb2,0xffa9ffac,0xffa4ffa7,0xff9effa1,0xff9aff9c,0xff99ff99,0xff99ff99,0xff9aff99,0xff99ff99,0xff99ff99,0xff98ff98,0xff96ff97,0xff93ff95,0xff8fff92,0xff8fff8e,0xff92ff91,0xff90ff91,0xff90ff90,0xff90ff90,0xff92ff91,0xff93ff92,0xff95ff93,0xff97ff96,0xff98ff97,0xff9aff99,
-0xff9eff9c,0xffa3ffa0,0xffa9ffa6,0xffaeffab,0xffb2ffb0,0xffb5ffb4,0xffb8ffb6,0xffbcffb9,0xffbeffbd,0xffc0ffbf,0xffc0ffc0,0xffbfffc0,0xffbdffbe,0xffb9ffbb,0xffb3ffb7,0xffa9ffaf,0xb096ffa1,0x00000000,0xff823682,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff96ff91,0xff9fff9a,0xffa6ffa3,0xffaeffaa,0xffb4ffb1,0xffb3ffb5,0xffadffb0,0xffa9ffab,0xffa5ffa7,
-0xffa1ffa3,0xff9fff9f,0xff9dff9e,0xff9eff9d,0xff9eff9e,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9eff9f,0xff9dff9d,0xff9aff9c,0xff97ff99,0xff93ff93,0xff92ff92,0xff92ff92,0xff93ff93,0xff95ff95,0xff97ff96,0xff99ff98,0xff9bff9a,0xff9dff9c,0xff9fff9e,0xffa1ffa0,0xffa5ffa3,0xffa9ffa7,0xffaeffab,0xffb2ffb0,0xffb5ffb4,0xffb7ffb6,0xffb9ffb9,0xffbcffbb,0xffbdffbd,
-0xffbdffbd,0xffbbffbc,0xffb8ffb9,0xffb4ffb7,0xffadffb1,0xffa1ffa8,0x288dff96,0xba820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff92ff8e,0xff9cff97,0xffa4ffa0,0xffacffa8,0xffb1ffaf,0xffaeffb0,0xffaaffac,0xffa7ffa8,0xffa4ffa6,0xffa1ffa3,0xff9fffa0,0xff9eff9e,0xff9eff9d,0xff9fff9e,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9fff9f,0xff9dff9e,0xff9bff9c,
-0xff96ff99,0xff8eff90,0xff8fff8e,0xff90ff8f,0xff93ff92,0xff95ff93,0xff98ff96,0xff9aff99,0xff9cff9b,0xff9eff9d,0xffa2ffa0,0xffa5ffa3,0xffaaffa7,0xffaeffac,0xffb2ffb1,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffbcffbb,0xffbcffbc,0xffbbffbb,0xffb9ffb9,0xffb5ffb7,0xffb0ffb3,0xffa8ffac,0xff9affa2,0x0000ba8e,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff823482,0xff82ff82,0xff82ff82,0xff85ff82,0xff8fff8a,0xff97ff93,0xff9fff9c,0xffa7ffa3,0xffadffaa,0xffb3ffb0,0xffb8ffb6,0xffb8ffb9,0xffb0ffb4,0xffa8ffac,0xffa2ffa5,0xff9effa0,0xff9dff9d,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9eff9e,0xff9dff9d,0xff9cff9d,0xff99ff9b,0xff95ff98,0xff92ff92,0xff97ff95,0xff9bff99,0xff9dff9d,0xff9aff9b,
-0xff99ff9a,0xff9aff99,0xff9aff9a,0xff9bff9b,0xff9dff9c,0xff9eff9d,0xff9fff9f,0xffa0ffa0,0xffa1ffa1,0xffa4ffa2,0xffa8ffa6,0xffacffaa,0xffb0ffae,0xffb2ffb1,0xffb6ffb4,0xffb9ffb8,0xffbdffbb,0xffbeffbd,0xffbfffbf,0xffbeffbf,0xffbcffbd,0xffb8ffb9,0xffb1ffb5,0xffa6ffac,0x3092ff9c,0x00000000,0x00000000,0xff82b282,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8b,
-0xff99ff93,0xffa1ff9d,0xffa9ffa5,0xffafffac,0xffb5ffb2,0xffb7ffb8,0xffb1ffb4,0xffabffae,0xffa5ffa8,0xffa1ffa3,0xff9eff9f,0xff9dff9d,0xff9eff9d,0xff9eff9e,0xff9fff9e,0xff9fff9f,0xff9eff9e,0xff9eff9e,0xff9cff9d,0xff99ff9b,0xff95ff97,0xff95ff93,0xff98ff97,0xff97ff98,0xff96ff96,0xff96ff96,0xff98ff97,0xff99ff98,0xff9bff9a,0xff9dff9c,0xff9eff9d,0xff9fff9f,
-0xffa1ffa0,0xffa4ffa2,0xffa7ffa5,0xffacffaa,0xffb0ffaf,0xffb4ffb2,0xffb6ffb4,0xffb9ffb8,0xffbcffbb,0xffbdffbd,0xffbeffbe,0xffbdffbe,0xffbbffbc,0xffb7ffb9,0xffb1ffb5,0xffa7ffad,0xb093ffa0,0x00000000,0xff825082,0xff82ff82,0xff82ff82,0xff82ff82,0xff8aff85,0xff93ff8f,0xff9cff98,0xffa4ffa0,0xffabffa7,0xffb1ffae,0xffaeffb1,0xffa9ffac,0xffa5ffa7,0xffa3ffa4,
-0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,0xffa2ffa2,0xffa3ffa3,0xffa3ffa3,0xffa4ffa4,0xffa4ffa4,0xffa3ffa4,0xffa2ffa2,0xff9fffa1,0xff9cff9e,0xff99ff9a,0xff98ff98,0xff98ff98,0xff99ff98,0xff9bff9a,0xff9dff9c,0xff9fff9e,0xffa1ffa0,0xffa3ffa2,0xffa4ffa3,0xffa6ffa5,0xffa8ffa7,0xffaaffa8,0xffadffab,0xffafffae,0xffb2ffb1,0xffb4ffb4,0xffb7ffb5,0xffb8ffb8,0xffb9ffb9,
-0xffb9ffb9,0xffb8ffb8,0xffb5ffb7,0xffb1ffb3,0xffaaffad,0xff9effa5,0x508aff93,0xef820582,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff82,0xff90ff8b,0xff99ff95,0xffa2ff9d,0xffa9ffa5,0xffaeffad,0xffaaffac,0xffa6ffa8,0xffa3ffa4,0xffa1ffa2,0xffa0ffa1,0xffa0ffa0,0xffa1ffa1,0xffa2ffa2,0xffa3ffa3,0xffa4ffa3,0xffa4ffa4,0xffa4ffa4,0xffa4ffa4,0xffa2ffa3,0xffa0ffa1,
-0xff9bff9f,0xff93ff96,0xff93ff93,0xff96ff95,0xff98ff97,0xff9bff9a,0xff9dff9c,0xff9fff9e,0xffa2ffa1,0xffa3ffa3,0xffa5ffa4,0xffa7ffa6,0xffaaffa8,0xffadffab,0xffb0ffae,0xffb3ffb2,0xffb5ffb4,0xffb7ffb6,0xffb8ffb7,0xffb8ffb8,0xffb7ffb8,0xffb5ffb6,0xffb1ffb3,0xffacffaf,0xffa5ffa9,0xff98ff9f,0x0383e58c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff823082,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff93ff90,0xff9cff99,0xffa3ffa0,0xffaaffa7,0xffafffad,0xffb4ffb2,0xffb3ffb5,0xffabffaf,0xffa6ffa9,0xffa3ffa4,0xffa2ffa3,0xffa2ffa2,0xffa2ffa2,0xffa3ffa3,0xffa3ffa3,0xffa3ffa3,0xffa3ffa3,0xffa2ffa3,0xffa1ffa2,0xff9fffa0,0xff9bff9d,0xff98ff98,0xff9dff9a,0xffa1ff9f,0xffa3ffa3,0xffa0ffa1,
-0xff9fffa0,0xffa0ff9f,0xffa0ffa0,0xffa1ffa1,0xffa2ffa2,0xffa4ffa3,0xffa5ffa5,0xffa6ffa6,0xffa7ffa7,0xffa8ffa7,0xffa9ffa8,0xffabffaa,0xffadffac,0xffaeffad,0xffb3ffb0,0xffb6ffb5,0xffb9ffb8,0xffbbffb9,0xffbcffbb,0xffbbffbb,0xffb9ffb9,0xffb5ffb7,0xffafffb2,0xffa4ffaa,0x3090ff99,0x00000000,0x00000000,0xff82b882,0xff82ff82,0xff82ff82,0xff84ff82,0xff8dff89,
-0xff96ff92,0xff9eff9a,0xffa5ffa2,0xffacffa9,0xffb2ffaf,0xffb3ffb4,0xffacffaf,0xffa7ffa9,0xffa3ffa5,0xffa1ffa2,0xffa1ffa1,0xffa2ffa2,0xffa2ffa2,0xffa3ffa3,0xffa3ffa3,0xffa3ffa3,0xffa3ffa3,0xffa3ffa3,0xffa1ffa2,0xff9effa0,0xff9aff9c,0xff9aff99,0xff9eff9c,0xff9dff9e,0xff9cff9c,0xff9cff9c,0xff9dff9d,0xff9fff9e,0xffa0ff9f,0xffa2ffa1,0xffa4ffa3,0xffa5ffa5,
-0xffa6ffa6,0xffa7ffa7,0xffa9ffa8,0xffacffaa,0xffaeffad,0xffb1ffaf,0xffb3ffb1,0xffb6ffb4,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffb9ffb9,0xffb8ffb9,0xffb4ffb6,0xffaeffb2,0xffa5ffaa,0xc292ff9d,0x00000000,0xff827a82,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff92ff8d,0xff9aff96,0xffa2ff9e,0xffa9ffa6,0xffafffac,0xffacffaf,0xffa7ffa9,0xffa5ffa6,0xffa4ffa4,
-0xffa4ffa4,0xffa5ffa5,0xffa6ffa5,0xffa7ffa6,0xffa7ffa7,0xffa8ffa8,0xffa8ffa8,0xffa8ffa9,0xffa8ffa8,0xffa7ffa7,0xffa4ffa6,0xffa1ffa3,0xff9eff9f,0xff9eff9e,0xff9eff9e,0xff9fff9e,0xffa0ff9f,0xffa2ffa1,0xffa4ffa3,0xffa6ffa5,0xffa8ffa7,0xffa9ffa9,0xffabffaa,0xffadffac,0xffaeffad,0xffafffae,0xffb0ffaf,0xffb2ffb1,0xffb2ffb2,0xffb4ffb3,0xffb6ffb5,0xffb7ffb7,
-0xffb7ffb7,0xffb6ffb7,0xffb3ffb5,0xffafffb2,0xffa9ffac,0xff9effa4,0x808aff95,0xff822c82,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff83,0xff90ff8b,0xff98ff93,0xffa1ff9d,0xffa8ffa4,0xffacffab,0xffa7ffa9,0xffa4ffa6,0xffa3ffa3,0xffa3ffa2,0xffa3ffa3,0xffa4ffa4,0xffa5ffa5,0xffa6ffa6,0xffa7ffa7,0xffa8ffa8,0xffa8ffa8,0xffa9ffa9,0xffa8ffa8,0xffa7ffa8,0xffa5ffa6,
-0xffa1ffa4,0xff99ff9b,0xff9aff99,0xff9bff9a,0xff9eff9d,0xffa0ff9f,0xffa2ffa1,0xffa4ffa3,0xffa7ffa6,0xffa8ffa8,0xffaaffa9,0xffacffab,0xffadffad,0xffafffae,0xffb0ffaf,0xffb2ffb1,0xffb4ffb3,0xffb5ffb4,0xffb6ffb6,0xffb7ffb6,0xffb6ffb7,0xffb4ffb5,0xffb1ffb3,0xffadffaf,0xffa6ffaa,0xff9affa1,0x2c87ff8f,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff823882,0xff82ff82,0xff82ff82,0xff82ff82,0xff88ff84,0xff91ff8d,0xff9aff96,0xffa1ff9d,0xffa8ffa4,0xffaeffab,0xffb3ffb0,0xffb1ffb4,0xffabffae,0xffa9ffaa,0xffa7ffa8,0xffa7ffa7,0xffa7ffa7,0xffa7ffa7,0xffa7ffa7,0xffa8ffa8,0xffa8ffa8,0xffa8ffa8,0xffa7ffa8,0xffa6ffa7,0xffa3ffa5,0xff9fffa2,0xff9dff9d,0xffa2ff9f,0xffa6ffa4,0xffa8ffa8,0xffa6ffa7,
-0xffa5ffa5,0xffa5ffa5,0xffa6ffa5,0xffa7ffa6,0xffa8ffa8,0xffa9ffa9,0xffabffaa,0xffacffab,0xffadffac,0xffadffad,0xffaeffae,0xffaeffae,0xffaeffae,0xffaeffae,0xffb1ffaf,0xffb5ffb3,0xffb7ffb6,0xffb8ffb8,0xffb8ffb8,0xffb7ffb8,0xffb5ffb6,0xffb1ffb3,0xffabffae,0xffa0ffa6,0x3e8cff96,0x00000000,0x00000000,0xff82d682,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,
-0xff93ff8f,0xff9cff98,0xffa3ffa0,0xffaaffa7,0xffb0ffad,0xffb1ffb2,0xffabffad,0xffa7ffa8,0xffa6ffa6,0xffa6ffa6,0xffa6ffa6,0xffa6ffa6,0xffa7ffa7,0xffa8ffa7,0xffa8ffa8,0xffa8ffa8,0xffa8ffa8,0xffa7ffa8,0xffa6ffa7,0xffa3ffa5,0xff9fffa1,0xffa0ff9e,0xffa4ffa2,0xffa2ffa3,0xffa2ffa2,0xffa2ffa2,0xffa3ffa2,0xffa4ffa3,0xffa6ffa5,0xffa7ffa7,0xffa9ffa8,0xffaaffaa,
-0xffacffab,0xffadffac,0xffaeffad,0xffaeffae,0xffafffaf,0xffb0ffb0,0xffb1ffb1,0xffb4ffb2,0xffb6ffb5,0xffb8ffb7,0xffb8ffb8,0xffb7ffb8,0xffb5ffb6,0xffb1ffb3,0xffabffaf,0xffa1ffa7,0xda8fff9a,0x00000000,0xff82b482,0xff82ff82,0xff82ff82,0xff83ff82,0xff8bff86,0xff93ff8f,0xff9cff98,0xffa4ffa0,0xffabffa8,0xffb1ffae,0xffadffb0,0xffaaffab,0xffa8ffa9,0xffa8ffa8,
-0xffa8ffa8,0xffa9ffa8,0xffaaffa9,0xffabffaa,0xffacffab,0xffacffac,0xffadffad,0xffadffad,0xffacffad,0xffabffac,0xffa9ffaa,0xffa5ffa7,0xffa4ffa4,0xffa3ffa4,0xffa3ffa3,0xffa4ffa3,0xffa5ffa5,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xffadffac,0xffaeffae,0xffb0ffaf,0xffb1ffb1,0xffb3ffb2,0xffb4ffb3,0xffb5ffb4,0xffb5ffb5,0xffb5ffb5,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,
-0xffb9ffb9,0xffb9ffb9,0xffb6ffb8,0xffb2ffb4,0xffacffaf,0xffa1ffa7,0xaa8fff99,0xff825a82,0xff82ff82,0xff82ff82,0xff87ff82,0xff8aff8a,0xff93ff8e,0xff9bff97,0xffa3ff9f,0xffaaffa7,0xffadffad,0xffa9ffaa,0xffa7ffa7,0xffa6ffa6,0xffa6ffa6,0xffa7ffa7,0xffa8ffa8,0xffa9ffa9,0xffaaffaa,0xffabffab,0xffacffac,0xffadffac,0xffadffad,0xffadffad,0xffacffac,0xffaaffab,
-0xffa6ffa9,0xff9effa1,0xff9fff9f,0xffa1ffa0,0xffa3ffa2,0xffa5ffa4,0xffa7ffa6,0xffa9ffa8,0xffabffaa,0xffadffac,0xffafffae,0xffb1ffb0,0xffb2ffb2,0xffb4ffb3,0xffb5ffb4,0xffb6ffb5,0xffb6ffb6,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffadffb8,0xffb2ffae,0xffabffaf,0xffa0ffa6,0x5e8cff96,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff825a82,0xff82ff82,0xff82ff82,0xff82ff82,0xff89ff84,0xff92ff8d,0xff9aff96,0xffa2ff9e,0xffa9ffa6,0xffb0ffad,0xffb6ffb3,0xffb4ffb7,0xffafffb2,0xffadffae,0xffabffac,0xffabffab,0xffabffab,0xffabffab,0xffacffab,0xffacffac,0xffadffac,0xffadffad,0xffacffac,0xffaaffab,0xffa8ffa9,0xffa4ffa6,0xffa2ffa1,0xffa7ffa4,0xffabffa9,0xffaeffad,0xffabffac,
-0xffaaffab,0xffaaffaa,0xffabffab,0xffacffab,0xffadffad,0xffaeffae,0xffb0ffaf,0xffb1ffb0,0xffb2ffb1,0xffb3ffb2,0xffb3ffb3,0xffb3ffb3,0xffb3ffb3,0xffb2ffb2,0xffb5ffb3,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb5ffb7,0xffb1ffb3,0xffaaffae,0xff9fffa5,0x568bff96,0x00000000,0x0b820000,0xff82fb82,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,
-0xff95ff91,0xff9dff99,0xffa5ffa1,0xffacffa9,0xffb2ffaf,0xffb2ffb4,0xffadffb0,0xffabffac,0xffaaffaa,0xffa9ffaa,0xffaaffaa,0xffaaffaa,0xffabffab,0xffacffab,0xffacffac,0xffadffac,0xffadffad,0xffacffac,0xffabffab,0xffa8ffa9,0xffa3ffa6,0xffa5ffa2,0xffa9ffa7,0xffa8ffa9,0xffa7ffa7,0xffa7ffa7,0xffa8ffa8,0xffa9ffa9,0xffabffaa,0xffacffac,0xffaeffad,0xffafffaf,
-0xffb1ffb0,0xffb2ffb1,0xffb3ffb3,0xffb4ffb3,0xffb4ffb4,0xffb4ffb4,0xffb4ffb4,0xffb6ffb5,0xffb8ffb8,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb6ffb8,0xffb3ffb5,0xffacffb0,0xffa3ffa8,0xf991ff9c,0x00000788,0xff82d082,0xff82ff82,0xff82ff82,0xff89ff82,0xff8eff8e,0xff98ff93,0xffa0ff9c,0xffa8ffa4,0xffafffab,0xffb4ffb2,0xffb0ffb3,0xffadffae,0xffacffac,0xffabffab,
-0xffacffac,0xffadffac,0xffadffad,0xffaeffae,0xffb0ffaf,0xffb0ffb0,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffb0ffb0,0xffadffaf,0xffaaffac,0xffa9ffa9,0xffa8ffa9,0xffa8ffa8,0xffa9ffa8,0xffaaffaa,0xffacffab,0xffaeffad,0xffb0ffaf,0xffb1ffb1,0xffb3ffb2,0xffb5ffb4,0xffb6ffb5,0xffb7ffb7,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffbcffb9,0xffbeffbd,0xffbfffbe,
-0xffbfffbf,0xffbdffbe,0xffb9ffbc,0xffb7ffae,0xffb1ffb4,0xffa7ffac,0xca93ff9f,0xff827082,0xff82ff82,0xff82ff82,0xff8eff82,0xff91ff95,0xff97ff92,0xff9fff9b,0xffa7ffa3,0xffaeffaa,0xffb0ffb0,0xffacffad,0xffaaffab,0xffa9ffa9,0xffaaffaa,0xffabffaa,0xffacffab,0xffadffac,0xffaeffae,0xffafffaf,0xffb0ffb0,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffb0ffb1,0xffafffaf,
-0xffaaffad,0xffa3ffa6,0xffa4ffa4,0xffa6ffa5,0xffa7ffa6,0xffaaffa8,0xffacffab,0xffaeffad,0xffb0ffaf,0xffb2ffb1,0xffb4ffb3,0xffb6ffb5,0xffb7ffb6,0xffb8ffb8,0xffb9ffb9,0xffbbffb9,0xffbbffbb,0xffbcffbb,0xffbeffbd,0xffbfffbe,0xffbfffbf,0xffbdffbe,0xffa1ffb7,0xffb6ffb2,0xffb0ffb3,0xffa5ffab,0x7291ff9c,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff827282,0xff82ff82,0xff82ff82,0xff83ff82,0xff8cff87,0xff95ff91,0xff9eff9a,0xffa6ffa2,0xffadffaa,0xffb4ffb0,0xffb9ffb6,0xffb8ffb9,0xffb3ffb5,0xffb0ffb2,0xffafffb0,0xffafffaf,0xffafffaf,0xffafffaf,0xffb0ffb0,0xffb0ffb0,0xffb1ffb1,0xffb1ffb1,0xffb0ffb1,0xffafffb0,0xffadffae,0xffa8ffab,0xffa6ffa6,0xffacffa9,0xffb0ffae,0xffb3ffb2,0xffb1ffb2,
-0xffb0ffb0,0xffb0ffb0,0xffb0ffb0,0xffb1ffb0,0xffb2ffb2,0xffb4ffb3,0xffb5ffb4,0xffb6ffb5,0xffb7ffb6,0xffb8ffb7,0xffb8ffb8,0xffb9ffb8,0xffb8ffb8,0xffb7ffb7,0xffb9ffb7,0xffbcffbb,0xffbeffbd,0xffbeffbe,0xffbeffbe,0xffbdffbe,0xffb9ffbb,0xffb5ffb8,0xffaeffb2,0xffa3ffa9,0x728fff99,0x00000000,0x1e820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff86ff82,0xff8fff8b,
-0xff99ff93,0xffa1ff9d,0xffa9ffa5,0xffb0ffac,0xffb6ffb3,0xffb5ffb7,0xffb1ffb3,0xffafffaf,0xffadffae,0xffadffad,0xffaeffad,0xffaeffae,0xffafffaf,0xffb0ffaf,0xffb0ffb0,0xffb1ffb1,0xffb1ffb1,0xffb0ffb1,0xffafffb0,0xffacffae,0xffa7ffaa,0xffa9ffa7,0xffaeffac,0xffadffae,0xffacffad,0xffacffac,0xffadffad,0xffaeffae,0xffb0ffaf,0xffb1ffb1,0xffb3ffb2,0xffb4ffb4,
-0xffb6ffb5,0xffb7ffb6,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffbbffb9,0xffbdffbc,0xffbeffbe,0xffbfffbf,0xffbdffbe,0xffbbffbc,0xffb7ffb9,0xffb1ffb4,0xffa8ffad,0xff93ffa1,0x0000228b,0xff82d482,0xff82ff82,0xff82ff82,0xff8fff83,0xff92ff93,0xff9bff96,0xffa3ff9f,0xffabffa7,0xffb2ffaf,0xffb7ffb5,0xffb3ffb6,0xffb0ffb1,0xffafffaf,0xffafffaf,
-0xffafffaf,0xffb0ffb0,0xffb1ffb1,0xffb2ffb2,0xffb3ffb3,0xffb4ffb4,0xffb5ffb4,0xffb5ffb5,0xffb5ffb5,0xffb4ffb4,0xffb2ffb3,0xffaeffb0,0xffaeffad,0xffaeffae,0xffadffad,0xffaeffad,0xffafffae,0xffb1ffb0,0xffb3ffb2,0xffb4ffb3,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbdffbc,0xffbeffbd,0xffbfffbe,0xffbfffbf,0xffc0ffbf,0xffc2ffc1,0xffc3ffc3,
-0xffc3ffc3,0xffc2ffc3,0xffafffc1,0xffbbffa9,0xffb5ffb8,0xffabffb1,0xd497ffa3,0xff828082,0xff82ff82,0xff82ff82,0xff8eff83,0xff97ff99,0xff9aff97,0xffa2ff9e,0xffaaffa6,0xffb1ffae,0xffb3ffb3,0xffafffb0,0xffadffae,0xffadffad,0xffadffad,0xffaeffae,0xffafffaf,0xffb0ffb0,0xffb2ffb1,0xffb3ffb2,0xffb4ffb3,0xffb5ffb4,0xffb5ffb5,0xffb5ffb5,0xffb4ffb5,0xffb3ffb4,
-0xffafffb1,0xffa8ffab,0xffa9ffa9,0xffaaffaa,0xffacffab,0xffaeffad,0xffb0ffaf,0xffb2ffb1,0xffb5ffb4,0xffb6ffb5,0xffb8ffb7,0xffb9ffb9,0xffbbffbb,0xffbdffbc,0xffbeffbd,0xffbfffbf,0xffc0ffbf,0xffc0ffc0,0xffc2ffc1,0xffc3ffc3,0xffc3ffc3,0xffbdffc3,0xffa0ffa4,0xffbbffb2,0xffb4ffb8,0xffa9ffaf,0x7696ffa0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff828882,0xff82ff82,0xff82ff82,0xff85ff82,0xff8fff8a,0xff99ff93,0xffa1ff9d,0xffa9ffa5,0xffb0ffad,0xffb7ffb4,0xffbdffb9,0xffbbffbd,0xffb6ffb8,0xffb4ffb5,0xffb3ffb3,0xffb3ffb3,0xffb3ffb3,0xffb3ffb3,0xffb4ffb3,0xffb4ffb4,0xffb5ffb5,0xffb5ffb5,0xffb4ffb5,0xffb3ffb4,0xffb1ffb2,0xffacffaf,0xffabffaa,0xffb0ffad,0xffb5ffb3,0xffb8ffb7,0xffb6ffb7,
-0xffb5ffb5,0xffb4ffb4,0xffb5ffb5,0xffb6ffb5,0xffb7ffb7,0xffb8ffb8,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbdffbc,0xffbdffbd,0xffbdffbd,0xffbdffbd,0xffbbffbc,0xffbeffbc,0xffc0ffbf,0xffc2ffc1,0xffc3ffc3,0xffc3ffc3,0xffc1ffc2,0xffbeffc0,0xffb9ffbc,0xffb2ffb6,0xffa7ffad,0x7693ff9d,0x00000000,0x26820000,0xff82ff82,0xff82ff82,0xff82ff82,0xff8dff89,0xff93ff8e,
-0xff9cff97,0xffa4ffa0,0xffacffa8,0xffb3ffb0,0xffb9ffb6,0xffb8ffb9,0xffb4ffb6,0xffb2ffb3,0xffb1ffb1,0xffb1ffb1,0xffb1ffb1,0xffb2ffb2,0xffb3ffb2,0xffb4ffb3,0xffb4ffb4,0xffb5ffb5,0xffb5ffb5,0xffb4ffb5,0xffb3ffb4,0xffb0ffb2,0xffacffae,0xffaeffac,0xffb3ffb1,0xffb2ffb3,0xffb1ffb1,0xffb1ffb1,0xffb2ffb2,0xffb3ffb2,0xffb4ffb4,0xffb6ffb5,0xffb8ffb7,0xffb9ffb8,
-0xffb9ffb9,0xffbbffbb,0xffbdffbc,0xffbdffbd,0xffbeffbe,0xffbeffbe,0xffbdffbd,0xffbfffbe,0xffc2ffc1,0xffc3ffc2,0xffc3ffc3,0xffc2ffc2,0xffc0ffc1,0xffbcffbe,0xffb5ffb9,0xffacffb1,0xff9affa5,0x00002c90,0xff82d082,0xff82ff82,0xff82ff82,0xff91ff85,0xff97ff98,0xff9eff9a,0xffa6ffa2,0xffaeffaa,0xffb5ffb2,0xffb9ffb9,0xffb6ffb8,0xffb3ffb4,0xffb2ffb3,0xffb2ffb2,
-0xffb3ffb2,0xffb3ffb3,0xffb5ffb4,0xffb6ffb5,0xffb7ffb6,0xffb8ffb7,0xffb8ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb8,0xffb5ffb7,0xffb2ffb4,0xffb3ffb1,0xffb3ffb3,0xffb2ffb2,0xffb2ffb2,0xffb4ffb3,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffb9ffb9,0xffbcffbb,0xffbeffbd,0xffbfffbe,0xffc0ffc0,0xffc1ffc1,0xffc2ffc2,0xffc3ffc3,0xffc3ffc3,0xffc4ffc3,0xffc6ffc5,0xffc7ffc7,
-0xffc7ffc7,0xffc6ffc7,0xffa1ffb4,0xffbfffab,0xffb9ffbc,0xffafffb4,0xd09affa6,0xff827282,0xff82ff82,0xff82ff82,0xff90ff84,0xff9aff9a,0xff9cff9a,0xffa5ffa1,0xffadffaa,0xffb5ffb1,0xffb5ffb6,0xffb1ffb3,0xffb0ffb0,0xffb0ffb0,0xffb0ffb0,0xffb1ffb1,0xffb2ffb2,0xffb4ffb3,0xffb5ffb5,0xffb6ffb6,0xffb7ffb7,0xffb8ffb8,0xffb9ffb9,0xffb9ffb9,0xffb8ffb9,0xffb7ffb8,
-0xffb3ffb5,0xffadffaf,0xffaeffae,0xffafffae,0xffb1ffb0,0xffb3ffb2,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbeffbd,0xffc0ffbf,0xffc1ffc0,0xffc2ffc1,0xffc3ffc3,0xffc4ffc4,0xffc4ffc4,0xffc6ffc5,0xffc7ffc7,0xffc7ffc7,0xffa4ffbd,0xffa0ffa0,0xffbfffb6,0xffb8ffbc,0xffadffb3,0x729affa4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff827e82,0xff82ff82,0xff82ff82,0xff8bff83,0xff92ff91,0xff9cff97,0xffa4ffa0,0xffacffa9,0xffb4ffb0,0xffb9ffb7,0xffc0ffbd,0xffbeffc0,0xffb9ffbc,0xffb7ffb8,0xffb6ffb7,0xffb6ffb6,0xffb6ffb6,0xffb7ffb7,0xffb7ffb7,0xffb8ffb8,0xffb8ffb8,0xffb9ffb9,0xffb8ffb8,0xffb7ffb8,0xffb5ffb6,0xffb0ffb3,0xffafffae,0xffb4ffb2,0xffb9ffb7,0xffbcffbb,0xffb9ffbb,
-0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbdffbc,0xffbeffbd,0xffbfffbf,0xffc0ffc0,0xffc1ffc1,0xffc2ffc1,0xffc2ffc2,0xffc1ffc2,0xffc0ffc0,0xffc2ffc0,0xffc5ffc3,0xffc6ffc5,0xffc7ffc7,0xffc7ffc7,0xffc5ffc6,0xffc2ffc4,0xffbdffbe,0xffb6ffb9,0xffabffb1,0x7297ffa1,0x00000000,0x20820000,0xff82ff82,0xff82ff82,0xff83ff82,0xff93ff8b,0xff96ff93,
-0xff9fff9b,0xffa7ffa3,0xffafffab,0xffb6ffb3,0xffbdffb9,0xffbbffbd,0xffb7ffb9,0xffb5ffb6,0xffb4ffb4,0xffb4ffb4,0xffb5ffb4,0xffb5ffb5,0xffb6ffb6,0xffb7ffb7,0xffb8ffb8,0xffb9ffb8,0xffb9ffb9,0xffb8ffb9,0xffb7ffb8,0xffb4ffb6,0xffb0ffb2,0xffb3ffb0,0xffb7ffb5,0xffb7ffb8,0xffb6ffb6,0xffb6ffb6,0xffb6ffb6,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffbcffbb,0xffbdffbd,
-0xffbfffbe,0xffc0ffbf,0xffc1ffc0,0xffc2ffc1,0xffc2ffc2,0xffc2ffc2,0xffc1ffc2,0xffc4ffc2,0xffc6ffc5,0xffc7ffc7,0xffc7ffc7,0xffc6ffc7,0xffbfffc5,0xffc0ffa4,0xffb9ffbd,0xffb0ffb5,0xff9dffa9,0x00002e91,0xff82be82,0xff82ff82,0xff83ff82,0xff92ff88,0xff9aff9a,0xff9fff9b,0xffa9ffa5,0xffb1ffad,0xffb8ffb5,0xffbdffbc,0xffb8ffbb,0xffb6ffb7,0xffb5ffb5,0xffb5ffb5,
-0xffb6ffb5,0xffb7ffb6,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffbbffbb,0xffbcffbc,0xffbcffbc,0xffbcffbc,0xffbbffbc,0xffb9ffb9,0xffb5ffb7,0xffb7ffb5,0xffb7ffb8,0xffb6ffb7,0xffb7ffb7,0xffb8ffb7,0xffb9ffb9,0xffbbffb9,0xffbdffbc,0xffbeffbe,0xffc0ffbf,0xffc2ffc1,0xffc3ffc2,0xffc4ffc4,0xffc5ffc5,0xffc6ffc6,0xffc7ffc7,0xffc7ffc7,0xffc8ffc7,0xffcaffc9,0xffcbffcb,
-0xffcbffcb,0xffafffc7,0xffa1ffa1,0xffc3ffb4,0xffbcffc0,0xffb2ffb8,0xba9dffa9,0xff826282,0xff82ff82,0xff82ff82,0xff8bff86,0xff9aff93,0xff9cff9a,0xffa5ff9e,0xffb0ffad,0xffb8ffb4,0xffb7ffb9,0xffb4ffb5,0xffb2ffb3,0xffb2ffb2,0xffb3ffb3,0xffb4ffb4,0xffb6ffb5,0xffb7ffb6,0xffb8ffb8,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbcffbc,0xffbcffbc,0xffbcffbc,0xffb9ffbb,
-0xffb7ffb9,0xffb2ffb4,0xffb2ffb2,0xffb3ffb3,0xffb5ffb4,0xffb7ffb6,0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffc1ffc0,0xffc2ffc1,0xffc4ffc3,0xffc5ffc4,0xffc6ffc6,0xffc7ffc7,0xffc8ffc8,0xffc8ffc8,0xffcaffc9,0xffcbffcb,0xffb2ffc5,0xffa0ffa1,0xffa3ffa0,0xffc2ffc0,0xffbbffbf,0xffb0ffb7,0x629bffa6,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff826682,0xff82ff82,0xff82ff82,0xff8bff85,0xff97ff92,0xff9fff9a,0xffa7ffa3,0xffafffab,0xffb7ffb3,0xffbdffb9,0xffc3ffc1,0xffc1ffc3,0xffbdffbe,0xffb9ffbb,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbcffbc,0xffbcffbc,0xffbcffbc,0xffbbffbc,0xffb8ffb9,0xffb3ffb6,0xffb3ffb2,0xffb8ffb6,0xffbdffbb,0xffc0ffbf,0xffbfffc0,
-0xffbeffbe,0xffbdffbe,0xffbeffbe,0xffbfffbe,0xffc0ffbf,0xffc1ffc0,0xffc2ffc2,0xffc3ffc3,0xffc4ffc4,0xffc5ffc5,0xffc6ffc5,0xffc6ffc6,0xffc5ffc6,0xffc3ffc5,0xffc6ffc4,0xffc8ffc7,0xffcaffc9,0xffcbffcb,0xffcbffcb,0xffc9ffca,0xffafffc7,0xffc1ffbf,0xffb9ffbe,0xffaeffb5,0x6298ffa4,0x00000000,0x0f820000,0xff82ff82,0xff82ff82,0xff84ff82,0xff93ff89,0xff99ff99,
-0xffa2ff9e,0xffaaffa6,0xffb2ffae,0xffb9ffb6,0xffc0ffbd,0xffbeffc0,0xffb9ffbc,0xffb8ffb9,0xffb7ffb7,0xffb7ffb7,0xffb8ffb7,0xffb9ffb8,0xffb9ffb9,0xffbbffb9,0xffbbffbb,0xffbcffbc,0xffbcffbc,0xffbcffbc,0xffbbffbb,0xffb8ffb9,0xffb4ffb6,0xffb7ffb4,0xffbbffb9,0xffbcffbc,0xffb9ffbb,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbdffbc,0xffbfffbe,0xffc0ffbf,0xffc1ffc1,
-0xffc3ffc2,0xffc4ffc3,0xffc5ffc4,0xffc6ffc5,0xffc6ffc6,0xffc6ffc7,0xffc5ffc6,0xffc8ffc6,0xffcaffc9,0xffcbffca,0xffcbffcb,0xffcaffcb,0xffa5ffc0,0xffc3ffa9,0xffbdffc1,0xffb3ffb9,0xffa0ffac,0x00000f96,0xff828a82,0xff82ff82,0xff86ff83,0xff8fff8c,0xff9aff93,0xff9dff9a,0xffa8ffa0,0xffb4ffb0,0xffbbffb8,0xffbfffbf,0xffbbffbd,0xffb8ffb9,0xffb7ffb8,0xffb8ffb7,
-0xffb8ffb8,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbdffbd,0xffbeffbe,0xffbfffbf,0xffbfffbf,0xffbfffbf,0xffbfffbf,0xffbdffbe,0xffb9ffbb,0xffbbffb9,0xffbbffbc,0xffbbffbb,0xffbbffbb,0xffbcffbb,0xffbdffbd,0xffbfffbe,0xffc1ffc0,0xffc2ffc1,0xffc4ffc3,0xffc6ffc5,0xffc7ffc6,0xffc8ffc8,0xffc9ffc9,0xffcaffca,0xffcbffcb,0xffcbffcb,0xffcbffcb,0xffceffcd,0xffcfffce,
-0xffb8ffc9,0xffa1ffa4,0xffa5ffa1,0xffc2ffc1,0xffc2ffc6,0xffb4ffbb,0x8ea0ffab,0xff823882,0xff82ff82,0xff86ff82,0xff90ff8b,0xff9aff93,0xff9aff9a,0xff9fff9a,0xffa6ffa4,0xffb6ffb0,0xffb9ffb9,0xffb6ffb7,0xffb5ffb5,0xffb5ffb5,0xffb6ffb5,0xffb7ffb6,0xffb8ffb8,0xffb9ffb9,0xffbbffbb,0xffbdffbc,0xffbeffbd,0xffbfffbe,0xffc0ffbf,0xffc0ffc0,0xffbfffc0,0xffbeffbf,
-0xffb9ffbd,0xffb7ffb8,0xffb7ffb6,0xffb8ffb7,0xffb9ffb8,0xffbbffb9,0xffbdffbc,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc4ffc3,0xffc6ffc5,0xffc7ffc7,0xffc9ffc8,0xffcaffc9,0xffcbffca,0xffccffcb,0xffc9ffcb,0xffc1ffc6,0xffacffb9,0xffa0ffa2,0xffa1ffa0,0xffa2ffa1,0xffc6ffc6,0xffc2ffc6,0xffb3ffb9,0x3a9dffa7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xff823a82,0xff82ff82,0xff85ff82,0xff8cff89,0xff9aff92,0xffa1ff9c,0xffaaffa6,0xffb2ffae,0xffb9ffb6,0xffc0ffbd,0xffc6ffc3,0xffc3ffc6,0xffbfffc1,0xffbdffbe,0xffbcffbd,0xffbcffbc,0xffbdffbc,0xffbdffbd,0xffbeffbe,0xffbfffbe,0xffbfffbf,0xffc0ffbf,0xffbfffbf,0xffbeffbf,0xffbcffbd,0xffb7ffb9,0xffb7ffb5,0xffbcffb9,0xffc1ffbf,0xffc4ffc3,0xffc3ffc4,
-0xffc2ffc2,0xffc1ffc2,0xffc2ffc2,0xffc3ffc2,0xffc4ffc3,0xffc5ffc4,0xffc6ffc6,0xffc7ffc7,0xffc8ffc8,0xffc9ffc9,0xffcaffc9,0xffcaffca,0xffc9ffca,0xffc7ffc8,0xffc9ffc7,0xffccffcb,0xffceffcd,0xffcfffce,0xffceffcf,0xffc7ffce,0xffadffab,0xffc3ffc6,0xffc0ffc5,0xffb0ffb7,0x3a9affa5,0x00000000,0x00000000,0xff82e282,0xff82ff82,0xff88ff84,0xff8cff8d,0xff9bff93,
-0xffa2ff9d,0xffadffa9,0xffb5ffb1,0xffbcffb9,0xffc3ffbf,0xffc0ffc3,0xffbcffbe,0xffbbffbb,0xffb9ffb9,0xffb9ffb9,0xffbbffb9,0xffbcffbb,0xffbdffbc,0xffbeffbd,0xffbfffbe,0xffbfffbf,0xffbfffbf,0xffbfffbf,0xffbeffbf,0xffbbffbd,0xffb7ffb9,0xffbbffb8,0xffbfffbd,0xffc0ffc0,0xffbeffbf,0xffbeffbe,0xffbfffbe,0xffc0ffbf,0xffc1ffc0,0xffc2ffc2,0xffc4ffc3,0xffc5ffc5,
-0xffc7ffc6,0xffc8ffc7,0xffc9ffc8,0xffcaffc9,0xffcaffca,0xffcaffca,0xffc9ffca,0xffcbffc9,0xffcdffcc,0xffceffce,0xffcfffcf,0xffb7ffcd,0xffa2ffa2,0xffc0ffb7,0xffc0ffc3,0xffb6ffbc,0xdca2ffae,0x00000000,0xff825482,0xff82ff82,0xffaeff8a,0xffb5ffb5,0xff93ff92,0xff9aff9a,0xffa0ff9b,0xffa9ffa6,0xffb4ffb0,0xffb7ffb7,0xffb7ffb5,0xffb9ffb9,0xffb9ffb9,0xffb9ffb9,
-0xffbbffbb,0xffbcffbc,0xffbeffbd,0xffbfffbe,0xffc0ffbf,0xffc1ffc1,0xffc2ffc2,0xffc3ffc2,0xffc3ffc3,0xffc2ffc2,0xffc0ffc1,0xffbcffbe,0xffbfffbd,0xffc0ffc0,0xffbfffbf,0xffbfffbf,0xffc0ffbf,0xffc1ffc0,0xffc3ffc2,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffc9ffc8,0xffcaffca,0xffccffcb,0xffcdffcc,0xffceffcd,0xffcaffcd,0xffc3ffc5,0xffc3ffc2,0xffc0ffc3,0xffadffb8,
-0xffa1ffa2,0xffa1ffa1,0xffb5ffa3,0xffc3ffb9,0xffc4ffc9,0xffb6ffbd,0x4ca1ffab,0xf7820782,0xff82ff82,0xffa5ff83,0xffb6ffb4,0xff93ff9d,0xff9aff9a,0xff9aff9a,0xff9bff9b,0xff9bff9b,0xff9dff9b,0xffa5ffa1,0xffafffab,0xffb7ffb5,0xffb8ffb8,0xffb9ffb9,0xffbbffb9,0xffbcffbc,0xffbeffbd,0xffc0ffbf,0xffc1ffc0,0xffc2ffc1,0xffc3ffc2,0xffc3ffc3,0xffc2ffc3,0xffc1ffc2,
-0xffbeffc0,0xffbbffbc,0xffbbffbb,0xffbbffbb,0xffbdffbc,0xffbfffbe,0xffc0ffbf,0xffc2ffc1,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffc9ffc9,0xffcbffca,0xffccffcc,0xffc8ffcd,0xffb9ffc0,0xffa7ffb0,0xffa0ffa2,0xffa0ffa0,0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,0xffb2ffaa,0xffc9ffbb,0xffc4ffca,0xffb4ffbb,0x059deba9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xef820382,0xff82ff82,0xffa5ff83,0xff9cffb3,0xff93ff90,0xff9fff9c,0xffacffa5,0xffb5ffb0,0xffbcffb8,0xffc3ffc0,0xffc9ffc6,0xffc6ffc8,0xffc2ffc3,0xffc0ffc0,0xffbfffbf,0xffbfffbf,0xffbfffbf,0xffc0ffc0,0xffc1ffc0,0xffc2ffc1,0xffc2ffc2,0xffc3ffc2,0xffc2ffc3,0xffc1ffc2,0xffbfffc0,0xffb9ffbd,0xffb9ffb8,0xffc0ffbd,0xffc5ffc2,0xffc8ffc7,0xffc7ffc8,
-0xffc6ffc6,0xffc5ffc5,0xffc6ffc5,0xffc6ffc6,0xffc7ffc7,0xffc8ffc8,0xffcaffc9,0xffcbffca,0xffccffcb,0xffcdffcc,0xffcdffcd,0xffcdffcd,0xffcdffcd,0xffcbffcc,0xffccffcb,0xffcfffce,0xffd1ffd0,0xffd2ffd2,0xffceffd2,0xffa5ffb9,0xffc4ffa8,0xffc7ffc7,0xffc3ffca,0xffb2ffb9,0x099af1a6,0x00000000,0x00000000,0xff82a282,0xff82ff82,0xffb0ff97,0xff9fffb6,0xff96ff8f,
-0xff9eff9b,0xffa5ffa2,0xffb8ffb3,0xffbfffbb,0xffc5ffc2,0xffc2ffc5,0xffbfffc0,0xffbdffbe,0xffbcffbd,0xffbdffbc,0xffbdffbd,0xffbeffbe,0xffc0ffbf,0xffc1ffc0,0xffc2ffc1,0xffc2ffc2,0xffc3ffc2,0xffc2ffc3,0xffc1ffc2,0xffbeffc0,0xffbbffbc,0xffbeffbc,0xffc3ffc1,0xffc4ffc4,0xffc2ffc3,0xffc2ffc2,0xffc2ffc2,0xffc4ffc3,0xffc5ffc4,0xffc6ffc5,0xffc8ffc7,0xffc9ffc8,
-0xffcaffca,0xffcbffcb,0xffccffcc,0xffcdffcd,0xffceffcd,0xffceffce,0xffcdffcd,0xffceffcd,0xffd1ffd0,0xffd2ffd1,0xffb9ffca,0xffa1ffa6,0xffb2ffa1,0xffbfffc2,0xffc5ffc8,0xffb8ffbe,0x98a5ffaf,0x00000000,0xf5820d82,0xff82ff82,0xff98ff83,0xffb5ffae,0xff8cffa8,0xff9bff97,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9dff9c,0xffa6ffa1,0xffbcffb8,
-0xffbdffbd,0xffbeffbe,0xffc0ffbf,0xffc1ffc1,0xffc3ffc2,0xffc4ffc3,0xffc5ffc4,0xffc5ffc5,0xffc5ffc5,0xffc5ffc5,0xffc3ffc4,0xffbfffc1,0xffc3ffc0,0xffc3ffc4,0xffc2ffc3,0xffc3ffc2,0xffc3ffc3,0xffc5ffc4,0xffc6ffc5,0xffc8ffc7,0xffc9ffc9,0xffcbffca,0xffccffcc,0xffceffcd,0xffcfffce,0xffbeffcf,0xffa8ffaf,0xffa1ffa2,0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,
-0xffa1ffa1,0xffa7ffa1,0xffbfffc2,0xffcbffc2,0xffc4ffcb,0xffb7ffbe,0x0ba1f3ab,0x9e820000,0xff82ff82,0xff8dff82,0xffb4ffac,0xff8bffb3,0xff9aff96,0xff9bff9a,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9fff9c,0xffb9ffac,0xffbcffbb,0xffbdffbd,0xffbfffbe,0xffc1ffc0,0xffc2ffc2,0xffc4ffc3,0xffc5ffc4,0xffc5ffc5,0xffc6ffc6,0xffc5ffc6,0xffc4ffc5,
-0xffc1ffc3,0xffbfffc0,0xffbfffbf,0xffbfffbf,0xffc0ffc0,0xffc2ffc1,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffcaffc9,0xffcbffca,0xffcdffcc,0xffceffcd,0xffb2ffcf,0xffa0ffa6,0xffa0ffa0,0xffa1ffa0,0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,0xffaeffa1,0xffc0ffc2,0xffcbffc5,0xffc3ffc9,0xffb4ffbd,0x0000a2a9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xac820000,0xff82ff82,0xff8bff82,0xffaeffab,0xff8fff96,0xff9bff96,0xffa4ff9f,0xffb5ffa6,0xffbeffbb,0xffc5ffc2,0xffc9ffc8,0xffb9ffc2,0xffb4ffb7,0xffc2ffbc,0xffc1ffc1,0xffc1ffc1,0xffc2ffc1,0xffc3ffc2,0xffc3ffc3,0xffc4ffc4,0xffc5ffc5,0xffc5ffc5,0xffc5ffc5,0xffc4ffc5,0xffc1ffc3,0xffbcffbf,0xffbdffbb,0xffc3ffc0,0xffc8ffc6,0xffcbffca,0xffcaffcb,
-0xffc9ffca,0xffc9ffc9,0xffc9ffc9,0xffcaffc9,0xffcbffca,0xffccffcb,0xffcdffcc,0xffceffce,0xffcfffcf,0xffd0ffd0,0xffd0ffd0,0xffc4ffd1,0xffc1ffc0,0xffc7ffc1,0xffcfffcd,0xffd2ffd1,0xffd4ffd3,0xffc5ffd1,0xffa4ffb6,0xffaeffa2,0xffc8ffc5,0xffcbffca,0xffc1ffc7,0xffb2ffbb,0x0000aaa6,0x00000000,0x00000000,0xff825082,0xff82ff82,0xffa3ff85,0xffb4ffb2,0xff8eff8e,
-0xff9bff99,0xff9bff9b,0xffa5ff9e,0xffb0ffaa,0xffafffb1,0xffa7ffab,0xffa7ffa7,0xffaeffab,0xffbfffbe,0xffbfffbf,0xffc0ffbf,0xffc1ffc0,0xffc2ffc2,0xffc3ffc3,0xffc4ffc4,0xffc5ffc5,0xffc5ffc5,0xffc5ffc5,0xffc4ffc5,0xffc1ffc3,0xffbdffbf,0xffc2ffbf,0xffc6ffc4,0xffc8ffc8,0xffc6ffc7,0xffc6ffc6,0xffc6ffc6,0xffc7ffc6,0xffc8ffc8,0xffcaffc9,0xffcbffca,0xffccffcc,
-0xffceffcd,0xffcfffce,0xffd0ffcf,0xffccffd0,0xffb4ffb9,0xffb0ffb1,0xffb2ffb0,0xffbcffb8,0xffb8ffbc,0xffa7ffb2,0xffa2ffa2,0xffa3ffa2,0xffc7ffb9,0xffc8ffc6,0xffc8ffcd,0xffb9ffc0,0x58a4ffaf,0x00000000,0x9c820000,0xff82ff82,0xff8aff83,0xffb2ffa1,0xff9bffb5,0xff9dff91,0xff9bff9d,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9cff9c,0xff9cff9c,0xffc4ffa2,0xffbeffc6,
-0xffbfffbf,0xffc1ffc0,0xffc2ffc1,0xffc4ffc3,0xffc5ffc4,0xffc6ffc6,0xffc7ffc7,0xffc8ffc8,0xffc8ffc8,0xffc7ffc8,0xffc5ffc7,0xffc2ffc3,0xffc6ffc4,0xffc7ffc7,0xffc6ffc6,0xffc6ffc6,0xffc7ffc6,0xffc8ffc7,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffceffcd,0xffcfffcf,0xffd1ffd0,0xffd2ffd1,0xffcaffd2,0xffa5ffb2,0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,
-0xffa3ffa2,0xffceffb8,0xffc3ffc4,0xffd0ffcb,0xffc5ffcc,0xffb6ffbf,0x000098ab,0x46820000,0xff82ff82,0xff87ff83,0xffb0ff96,0xffacffb5,0xff9aff8f,0xff9bff9c,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9cff9c,0xffb5ff9e,0xffbcffcd,0xffbeffbd,0xffc0ffbf,0xffc1ffc1,0xffc3ffc2,0xffc5ffc4,0xffc6ffc5,0xffc7ffc7,0xffc8ffc8,0xffc8ffc8,0xffc8ffc8,0xffc7ffc8,
-0xffc4ffc5,0xffc3ffc3,0xffc2ffc2,0xffc3ffc2,0xffc4ffc3,0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffceffcd,0xffd0ffcf,0xffd1ffd0,0xffbeffd2,0xffa1ffae,0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,0xffa1ffa1,0xffa9ffa1,0xffceffc2,0xffc6ffc3,0xffcdffcc,0xffc4ffc9,0xffb2ffbd,0x00004aa8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x48820000,0xff82ff82,0xff85ff82,0xffafff93,0xff96ffa5,0xff9aff8c,0xff9bff9c,0xff9bff9b,0xffa3ffa0,0xffa6ffa5,0xff9dffa3,0xff9cff9c,0xffb8ff9d,0xffc4ffcf,0xffc3ffc3,0xffc3ffc3,0xffc4ffc4,0xffc5ffc4,0xffc6ffc5,0xffc7ffc6,0xffc7ffc7,0xffc8ffc8,0xffc8ffc8,0xffc7ffc7,0xffc4ffc6,0xffbfffc2,0xffc1ffbe,0xffc6ffc3,0xffcbffc9,0xffcfffcd,0xffceffcf,
-0xffccffcd,0xffccffcc,0xffccffcc,0xffcdffcd,0xffceffcd,0xffcfffce,0xffd0ffcf,0xffd1ffd1,0xffd2ffd2,0xffd3ffd3,0xffd3ffd3,0xffc5ffd4,0xffa3ffae,0xffa2ffa2,0xffa9ffa3,0xffafffad,0xffa8ffac,0xffa2ffa4,0xffa9ffa2,0xffcdffc1,0xffceffd1,0xffccffcc,0xffc2ffc7,0xffb0ffbb,0x00004ea6,0x00000000,0x00000000,0xeb820982,0xff82ff82,0xff8cff84,0xffb4ffa9,0xff8cffad,
-0xff9bff95,0xff9bff9b,0xff9bff9b,0xff9bff9b,0xff9cff9c,0xff9cff9c,0xff9cff9c,0xffccffac,0xffc1ffc1,0xffc1ffc1,0xffc2ffc1,0xffc3ffc3,0xffc5ffc4,0xffc6ffc5,0xffc7ffc6,0xffc8ffc7,0xffc8ffc8,0xffc8ffc8,0xffc7ffc7,0xffc4ffc5,0xffc0ffc1,0xffc5ffc2,0xffcaffc7,0xffcbffcb,0xffcaffca,0xffc9ffc9,0xffc9ffc9,0xffcaffca,0xffcbffcb,0xffcdffcc,0xffceffcd,0xffcfffcf,
-0xffd1ffd0,0xffd2ffd1,0xffd3ffd2,0xffd2ffd3,0xffa9ffb7,0xffa1ffa1,0xffa1ffa1,0xffa2ffa2,0xffa2ffa2,0xffa2ffa2,0xffa2ffa2,0xffc9ffb0,0xffc4ffc9,0xffceffc9,0xffc6ffcc,0xffb9ffc0,0x09a3efad,0x00000000,0x25820000,0xff82fd82,0xff89ff84,0xffa4ff91,0xffb6ffb1,0xff9bff9d,0xffa5ffa2,0xff9dffa2,0xff9bff9b,0xff9cff9b,0xffa3ff9c,0xffc4ffb2,0xffd2ffda,0xffc0ffc0,
-0xffc1ffc1,0xffc3ffc2,0xffc4ffc3,0xffc6ffc5,0xffc7ffc7,0xffc9ffc8,0xffcaffc9,0xffcaffca,0xffcbffcb,0xffcaffca,0xffc8ffc9,0xffc5ffc6,0xffc9ffc6,0xffcbffcb,0xffc9ffca,0xffc9ffc9,0xffcaffc9,0xffcbffca,0xffccffcb,0xffceffcd,0xffcfffce,0xffd1ffd0,0xffd2ffd1,0xffd4ffd3,0xffd5ffd4,0xffd6ffd5,0xffc1ffc5,0xffb1ffbc,0xffa2ffa8,0xffa2ffa1,0xffa2ffa2,0xffb0ffa6,
-0xffd5ffc3,0xffc9ffd2,0xffcdffc7,0xffd0ffd2,0xffc5ffcb,0xfbb4ffbf,0x000023aa,0x01820000,0xff82cb82,0xff87ff83,0xff9cff8e,0xffb5ffb1,0xff97ffa7,0xffa3ffa0,0xff9effa4,0xff9bff9b,0xff9bff9b,0xff9fff9c,0xffbdffac,0xffd9ffd6,0xffbeffc1,0xffc0ffbf,0xffc2ffc1,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc8ffc8,0xffcaffc9,0xffcaffca,0xffcbffcb,0xffcbffcb,0xffc9ffca,
-0xffc7ffc8,0xffc6ffc7,0xffc5ffc6,0xffc6ffc6,0xffc7ffc6,0xffc8ffc7,0xffcaffc9,0xffccffcb,0xffceffcd,0xffcfffcf,0xffd1ffd0,0xffd3ffd2,0xffd4ffd3,0xffd2ffd4,0xffc2ffbf,0xffadffb8,0xffa1ffa5,0xffa1ffa1,0xffa2ffa1,0xffb6ffa7,0xffd6ffc8,0xffc7ffd0,0xffceffc7,0xffceffd0,0xffc4ffca,0xd5b0ffbc,0x000003a7,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03820000,0xff82c382,0xff86ff82,0xff9bff8d,0xffa4ffaf,0xff9cff9f,0xffa3ff9f,0xff9effa1,0xff9cff9c,0xff9cff9c,0xffa1ff9c,0xffbfffad,0xffd6ffd5,0xffc5ffcc,0xffc5ffc5,0xffc5ffc5,0xffc6ffc6,0xffc7ffc6,0xffc8ffc7,0xffc9ffc8,0xffcaffc9,0xffcaffca,0xffcaffca,0xffc9ffca,0xffc6ffc8,0xffc1ffc4,0xffc3ffc0,0xffc9ffc6,0xffceffcb,0xffd1ffd0,0xffd1ffd2,
-0xffcfffd0,0xffcfffcf,0xffcfffcf,0xffd0ffcf,0xffd1ffd0,0xffd2ffd1,0xffd3ffd2,0xffd4ffd3,0xffd5ffd4,0xffd5ffd5,0xffd6ffd6,0xffd5ffd6,0xffc3ffc5,0xffafffb9,0xffa2ffa4,0xffa2ffa2,0xffa3ffa2,0xffb6ffa8,0xffd6ffc8,0xffd5ffd5,0xffd1ffd4,0xffccffcf,0xffc2ffc8,0xcfafffb9,0x000003a2,0x00000000,0x00000000,0x7e820000,0xff82ff82,0xff8bff85,0xffacff93,0xffacffb4,
-0xff9cff93,0xffa5ffa2,0xff9cffa0,0xff9cff9b,0xff9cff9c,0xffa9ff9d,0xffd0ffb8,0xffcbffdb,0xffc2ffc2,0xffc3ffc3,0xffc4ffc3,0xffc5ffc5,0xffc7ffc6,0xffc8ffc7,0xffc9ffc8,0xffcaffc9,0xffcaffca,0xffcaffca,0xffc9ffca,0xffc6ffc8,0xffc3ffc3,0xffc8ffc5,0xffcdffca,0xffceffce,0xffcdffcd,0xffccffcc,0xffccffcc,0xffcdffcd,0xffceffce,0xffcfffcf,0xffd1ffd0,0xffd2ffd1,
-0xffd3ffd3,0xffd4ffd4,0xffd5ffd5,0xffd6ffd6,0xffc0ffce,0xffb5ffc1,0xffa4ffab,0xffa2ffa2,0xffa2ffa2,0xffacffa5,0xffd1ffbb,0xffcdffd6,0xffcaffc8,0xffcfffd0,0xffc7ffcc,0xffb7ffc0,0x00007cac,0x00000000,0x00000000,0xff828e82,0xff89ff84,0xff9aff91,0xffb0ffa7,0xffb1ffb6,0xffabffa8,0xffb9ffb5,0xffbeffbd,0xffc5ffc1,0xffd5ffcd,0xffd8ffd8,0xffc2ffd1,0xffc2ffc1,
-0xffc3ffc2,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffc9ffc8,0xffcbffca,0xffccffcb,0xffccffcc,0xffcdffcd,0xffccffcc,0xffcaffcb,0xffc7ffc8,0xffccffc9,0xffceffce,0xffccffcd,0xffccffcc,0xffccffcc,0xffcdffcd,0xffcfffce,0xffd0ffcf,0xffd2ffd1,0xffd3ffd3,0xffd5ffd4,0xffd6ffd5,0xffd6ffd6,0xffd8ffd6,0xffc6ffd8,0xffcdffc4,0xffd2ffd2,0xffcfffcf,0xffd5ffd1,0xffdcffdd,
-0xffd2ffd9,0xffc9ffca,0xffd4ffcf,0xffcfffd4,0xffc4ffca,0x90b1ffbb,0x00000000,0x00000000,0xfd823d82,0xff87ff82,0xff95ff8e,0xffafffa1,0xffafffb6,0xffa7ff9f,0xffb9ffb2,0xffbdffbd,0xffc4ffbe,0xffd3ffcc,0xffd9ffd6,0xffc3ffd6,0xffc0ffbf,0xffc1ffc1,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcaffca,0xffccffcb,0xffcdffcc,0xffcdffcd,0xffcdffcd,0xffcbffcc,
-0xffc9ffca,0xffcaffca,0xffc9ffc9,0xffc9ffc9,0xffcaffc9,0xffcbffca,0xffcdffcc,0xffcfffce,0xffd0ffcf,0xffd2ffd1,0xffd4ffd3,0xffd5ffd4,0xffd6ffd6,0xffd6ffd6,0xffc2ffd3,0xffceffc7,0xffd2ffd2,0xffcfffcd,0xffd8ffd1,0xffdcffdd,0xffd0ffd6,0xffcaffca,0xffd3ffd0,0xffceffd2,0xffc3ffc9,0x3daffdb9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xff823d82,0xff86ff82,0xff93ff8d,0xffa9ffa0,0xffa5ffa9,0xffa6ffa2,0xffb8ffb1,0xffbdffbc,0xffc3ffbf,0xffd3ffcc,0xffd8ffd6,0xffcdffd6,0xffc7ffc7,0xffc6ffc6,0xffc7ffc6,0xffc7ffc7,0xffc8ffc8,0xffcaffc9,0xffcbffca,0xffcbffcb,0xffccffcc,0xffccffcc,0xffcbffcb,0xffc8ffca,0xffc2ffc6,0xffc6ffc2,0xffcbffc9,0xffd0ffce,0xffd4ffd2,0xffd3ffd4,
-0xffd2ffd3,0xffd1ffd2,0xffd2ffd1,0xffd2ffd2,0xffd3ffd3,0xffd4ffd4,0xffd5ffd5,0xffd6ffd6,0xffd6ffd6,0xffd8ffd6,0xffd8ffd8,0xffd8ffd8,0xffc8ffd6,0xffd0ffc9,0xffd2ffd2,0xffd0ffcf,0xffdaffd2,0xffdbffdd,0xffd4ffd6,0xffd6ffd8,0xffd3ffd4,0xffcdffd1,0xffc1ffc8,0x3dacfdb7,0x00000000,0x00000000,0x00000000,0x07820000,0xff82df82,0xff8bff85,0xff9bff92,0xffb5ffac,
-0xffa0ffb1,0xffafffaa,0xffbbffb6,0xffbfffbc,0xffc9ffc2,0xffd6ffd0,0xffd5ffd8,0xffc4ffca,0xffc4ffc4,0xffc4ffc4,0xffc6ffc5,0xffc7ffc6,0xffc8ffc8,0xffcaffc9,0xffcbffca,0xffccffcb,0xffccffcc,0xffccffcc,0xffcbffcc,0xffc8ffca,0xffc5ffc5,0xffcaffc7,0xffcfffcd,0xffd1ffd1,0xffcfffd0,0xffcfffcf,0xffcfffcf,0xffd0ffcf,0xffd1ffd0,0xffd2ffd1,0xffd3ffd3,0xffd4ffd4,
-0xffd6ffd5,0xffd6ffd6,0xffd8ffd6,0xffd8ffd8,0xffd3ffd8,0xffcbffcb,0xffd4ffd0,0xffcdffce,0xffd4ffd1,0xffdcffdc,0xffdaffdb,0xffcaffd2,0xffd3ffcd,0xffd0ffd3,0xffc6ffcc,0xd9b4ffbe,0x000007aa,0x00000000,0x00000000,0xd7820b82,0xff88ff83,0xff97ff90,0xffa7ff9d,0xffb7ffb2,0xffb0ffb2,0xffb5ffb2,0xffc4ffbd,0xffcdffc8,0xffcfffd0,0xffc8ffcd,0xffc2ffc2,0xffc3ffc2,
-0xffc4ffc3,0xffc6ffc5,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffccffcb,0xffcdffcd,0xffceffce,0xffceffce,0xffceffce,0xffccffcd,0xffc9ffc9,0xffceffcc,0xffd0ffd0,0xffcfffcf,0xffceffce,0xffcfffcf,0xffd0ffcf,0xffd1ffd0,0xffd2ffd2,0xffd4ffd3,0xffd5ffd5,0xffd6ffd6,0xffd8ffd6,0xffd9ffd8,0xffdaffd9,0xffdaffda,0xffd3ffd1,0xffd1ffd2,0xffd8ffd5,0xffdaffd9,0xffd2ffd6,
-0xffccffcf,0xffd2ffcc,0xffd6ffd6,0xffcfffd3,0xffc2ffc9,0x0baedfb7,0x00000000,0x00000000,0x90820000,0xff86ff82,0xff95ff8e,0xffa5ff9b,0xffb6ffb0,0xffafffb7,0xffb7ffb4,0xffc2ffbc,0xffccffc7,0xffd1ffcf,0xffc9ffd1,0xffbfffc5,0xffc1ffc0,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcaffca,0xffccffcb,0xffcdffcd,0xffceffce,0xffcfffcf,0xffcfffcf,0xffcdffce,
-0xffcbffcc,0xffcdffcc,0xffcbffcc,0xffcbffcb,0xffccffcc,0xffceffcd,0xffcfffce,0xffd1ffd0,0xffd3ffd2,0xffd4ffd3,0xffd6ffd5,0xffd6ffd6,0xffd8ffd8,0xffd9ffd9,0xffd9ffda,0xffc8ffcc,0xffd2ffce,0xffd9ffd6,0xffdaffda,0xffd1ffd5,0xffcbffce,0xffd4ffcf,0xffd5ffd6,0xffcdffd2,0xffbfffc8,0x000094b4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x8c820000,0xff85ff82,0xff93ff8d,0xffa4ff9a,0xffafffac,0xffadffae,0xffb6ffb4,0xffc1ffb9,0xffcbffc7,0xffd0ffce,0xffd2ffd1,0xffc9ffcd,0xffc8ffc8,0xffc7ffc7,0xffc8ffc7,0xffc9ffc8,0xffcaffc9,0xffcbffca,0xffccffcb,0xffcdffcc,0xffcdffcd,0xffcdffcd,0xffccffcd,0xffcaffcb,0xffc4ffc7,0xffc8ffc4,0xffcdffcb,0xffd2ffd0,0xffd6ffd4,0xffd6ffd6,
-0xffd4ffd5,0xffd4ffd4,0xffd4ffd4,0xffd4ffd4,0xffd5ffd5,0xffd6ffd5,0xffd6ffd6,0xffd8ffd6,0xffd9ffd8,0xffd9ffd9,0xffdaffd9,0xffdaffda,0xffd3ffd9,0xffceffd0,0xffd3ffcd,0xffd9ffd6,0xffd9ffda,0xffdcffdb,0xffd4ffd6,0xffd8ffd8,0xffd4ffd6,0xffccffd0,0xffbdffc6,0x000090b3,0x00000000,0x00000000,0x00000000,0x00000000,0xfd824982,0xff8bff84,0xff98ff92,0xffacffa2,
-0xffb6ffb3,0xffb3ffb2,0xffb7ffb5,0xffc5ffbf,0xffceffca,0xffd0ffd0,0xffcaffcf,0xffc5ffc5,0xffc5ffc5,0xffc6ffc5,0xffc7ffc6,0xffc8ffc7,0xffcaffc9,0xffcbffca,0xffccffcc,0xffcdffcd,0xffceffce,0xffceffce,0xffccffcd,0xffc9ffcb,0xffc7ffc7,0xffccffca,0xffd1ffcf,0xffd4ffd3,0xffd2ffd3,0xffd1ffd1,0xffd1ffd1,0xffd2ffd1,0xffd3ffd2,0xffd4ffd3,0xffd5ffd5,0xffd6ffd6,
-0xffd6ffd6,0xffd8ffd8,0xffd9ffd9,0xffdaffda,0xffdaffda,0xffd2ffd5,0xffcfffd0,0xffd6ffd4,0xffdaffd9,0xffdaffd9,0xffd2ffd6,0xffd1ffd1,0xffd6ffd6,0xffd0ffd3,0xffc4ffcb,0x43b1ffb9,0x00000000,0x00000000,0x00000000,0x29820000,0xff87f382,0xff96ff8f,0xffa3ff9c,0xffb2ffab,0xffb9ffb7,0xffb5ffb5,0xffbeffb9,0xffc3ffc1,0xffc4ffc5,0xffc4ffc4,0xffc2ffc2,0xffc3ffc3,
-0xffc5ffc4,0xffc7ffc6,0xffc8ffc7,0xffcaffc9,0xffccffcb,0xffcdffcd,0xffcfffce,0xffcfffcf,0xffd0ffd0,0xffcfffd0,0xffcdffce,0xffcbffcb,0xffd0ffce,0xffd3ffd2,0xffd1ffd2,0xffd1ffd1,0xffd1ffd1,0xffd2ffd1,0xffd3ffd2,0xffd4ffd4,0xffd6ffd5,0xffd6ffd6,0xffd8ffd8,0xffd9ffd9,0xffdaffda,0xffdbffdb,0xffdcffdb,0xffd4ffd8,0xffcbffce,0xffcfffcd,0xffd0ffd0,0xffccffcf,
-0xffd3ffcd,0xffd9ffd6,0xffd5ffd8,0xffcdffd1,0xf3bcffc6,0x00002fb4,0x00000000,0x00000000,0x0b820000,0xff85c382,0xff93ff8d,0xffa1ff9b,0xffb0ffa9,0xffb9ffb6,0xffb8ffb9,0xffbdffb9,0xffc3ffc0,0xffc6ffc5,0xffc0ffc4,0xffc0ffbf,0xffc2ffc1,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffcaffc9,0xffccffcb,0xffcdffcd,0xffcfffce,0xffd0ffcf,0xffd0ffd0,0xffd0ffd0,0xffcfffd0,
-0xffcdffcd,0xffcfffcf,0xffceffce,0xffceffce,0xffcfffce,0xffd0ffcf,0xffd1ffd0,0xffd3ffd2,0xffd4ffd4,0xffd6ffd5,0xffd8ffd6,0xffd9ffd8,0xffdaffd9,0xffdbffda,0xffdcffdb,0xffd0ffd8,0xffccffc5,0xffcfffce,0xffd0ffd0,0xffcbffcd,0xffd4ffcf,0xffdaffd8,0xffd4ffd6,0xffccffd1,0xbfb9ffc4,0x00000bb1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x07820000,0xff84c582,0xff93ff8b,0xffa0ff99,0xffafffa7,0xffb7ffb4,0xffb9ffb9,0xffc2ffbb,0xffcbffc7,0xffceffcd,0xffccffcd,0xffc9ffcb,0xffc8ffc8,0xffc8ffc8,0xffc8ffc8,0xffc9ffc9,0xffcbffca,0xffccffcb,0xffcdffcc,0xffceffcd,0xffceffce,0xffceffce,0xffcdffce,0xffcbffcc,0xffc5ffc8,0xffc9ffc6,0xffcfffcc,0xffd4ffd2,0xffd8ffd6,0xffd8ffd8,
-0xffd6ffd6,0xffd5ffd5,0xffd5ffd5,0xffd6ffd5,0xffd6ffd6,0xffd6ffd6,0xffd8ffd8,0xffd9ffd9,0xffdaffd9,0xffdaffda,0xffdbffdb,0xffdbffdb,0xffdaffda,0xffd3ffd9,0xffd4ffcf,0xffd9ffd6,0xffd9ffd9,0xffdbffdb,0xffd8ffd9,0xffd9ffd8,0xffd3ffd6,0xffcaffcf,0xc1b8ffc2,0x000005af,0x00000000,0x00000000,0x00000000,0x00000000,0x75820000,0xff89ff82,0xff98ff91,0xffa4ff9e,
-0xffb3ffac,0xffb9ffb7,0xffb7ffb7,0xffbfffbb,0xffc4ffc2,0xffc5ffc5,0xffc7ffc6,0xffc5ffc5,0xffc5ffc5,0xffc6ffc6,0xffc8ffc7,0xffc9ffc8,0xffcbffca,0xffccffcb,0xffcdffcd,0xffceffce,0xffcfffcf,0xffcfffcf,0xffceffcf,0xffcbffcd,0xffc9ffc8,0xffceffcc,0xffd3ffd1,0xffd6ffd5,0xffd4ffd5,0xffd3ffd3,0xffd3ffd3,0xffd4ffd3,0xffd5ffd4,0xffd6ffd5,0xffd6ffd6,0xffd8ffd6,
-0xffd9ffd9,0xffdaffd9,0xffdbffda,0xffdbffdb,0xffdbffdb,0xffd4ffd8,0xffcaffce,0xffcfffcd,0xffd0ffd0,0xffd3ffd0,0xffd2ffd3,0xffd8ffd6,0xffd6ffd8,0xffceffd2,0xffbeffc8,0x00006eb6,0x00000000,0x00000000,0x00000000,0x00000000,0xf3844182,0xff93ff8b,0xffa2ff9b,0xffadffa7,0xffb9ffb3,0xffbdffbb,0xffbfffbf,0xffc1ffbf,0xffc5ffc5,0xffc3ffc3,0xffc3ffc2,0xffc4ffc3,
-0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffceffce,0xffd0ffcf,0xffd0ffd0,0xffd1ffd1,0xffd0ffd1,0xffceffcf,0xffccffcc,0xffd2ffcf,0xffd5ffd4,0xffd3ffd4,0xffd2ffd3,0xffd3ffd2,0xffd3ffd3,0xffd4ffd4,0xffd6ffd5,0xffd6ffd6,0xffd8ffd8,0xffdaffd9,0xffdbffda,0xffdbffdb,0xffdcffdc,0xffdcffdc,0xffd4ffd9,0xffcfffd2,0xffceffce,0xffd2ffcf,0xffd6ffd4,
-0xffdbffd8,0xffd9ffdb,0xffd3ffd6,0xffc8ffcf,0x3db8f7c0,0x00000000,0x00000000,0x00000000,0x00000000,0xcb821182,0xff92ff89,0xffa0ff9a,0xffabffa6,0xffb8ffb2,0xffbdffbb,0xffbfffbe,0xffc1ffc0,0xffc2ffc3,0xffc0ffc0,0xffc0ffc0,0xffc2ffc1,0xffc4ffc3,0xffc6ffc5,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffcfffce,0xffd0ffcf,0xffd1ffd1,0xffd2ffd1,0xffd1ffd2,0xffd0ffd1,
-0xffcfffce,0xffd2ffd1,0xffd0ffd1,0xffd0ffd0,0xffd0ffd0,0xffd1ffd1,0xffd3ffd2,0xffd4ffd4,0xffd6ffd5,0xffd8ffd6,0xffd9ffd8,0xffdaffda,0xffdbffdb,0xffdcffdc,0xffdcffdc,0xffd4ffd9,0xffceffd1,0xffcdffcd,0xffd2ffcf,0xffd6ffd4,0xffdbffd9,0xffd9ffdb,0xffd2ffd6,0xffc7ffce,0x11b6c3be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xc9821582,0xff90ff88,0xff9fff98,0xffaaffa4,0xffb7ffb1,0xffbeffb9,0xffc4ffc2,0xffc9ffc6,0xffcfffcd,0xffccffce,0xffc9ffca,0xffc8ffc8,0xffc8ffc8,0xffc8ffc8,0xffcaffc9,0xffcbffca,0xffccffcc,0xffcdffcd,0xffceffce,0xffcfffcf,0xffcfffcf,0xffceffcf,0xffcbffcd,0xffc6ffc9,0xffcbffc7,0xffd0ffce,0xffd5ffd3,0xffd9ffd6,0xffd9ffda,
-0xffd6ffd8,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd8ffd8,0xffd9ffd9,0xffdaffd9,0xffdaffda,0xffdbffdb,0xffdbffdb,0xffdbffdb,0xffdaffdb,0xffd8ffda,0xffd6ffd6,0xffd8ffd6,0xffdcffda,0xffdaffdd,0xffdbffd9,0xffd8ffda,0xffd1ffd5,0xffc5ffcc,0x11b4cdbc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xff868582,0xff96ff8e,0xffa3ff9d,
-0xffaeffa9,0xffb9ffb4,0xffbeffbc,0xffbfffbf,0xffc2ffc0,0xffc7ffc6,0xffc6ffc6,0xffc5ffc5,0xffc6ffc5,0xffc7ffc6,0xffc8ffc7,0xffcaffc9,0xffcbffca,0xffcdffcc,0xffceffce,0xffcfffcf,0xffd0ffd0,0xffd0ffd0,0xffcfffcf,0xffcbffcd,0xffcaffc9,0xffd0ffcd,0xffd5ffd2,0xffd6ffd6,0xffd6ffd6,0xffd5ffd5,0xffd5ffd4,0xffd5ffd5,0xffd6ffd5,0xffd6ffd6,0xffd8ffd6,0xffd9ffd8,
-0xffdaffda,0xffdbffda,0xffdbffdb,0xffdcffdc,0xffdcffdc,0xffd5ffd9,0xffccffcf,0xffceffcf,0xffd1ffcf,0xffd5ffd3,0xffdaffd8,0xffd9ffdb,0xffd4ffd6,0xffcbffd0,0x8bb9ffc2,0x000001b1,0x00000000,0x00000000,0x00000000,0x00000000,0x33820000,0xff90e787,0xffa0ff99,0xffacffa6,0xffb6ffb1,0xffbfffb9,0xffc5ffc2,0xffc6ffc5,0xffc6ffc8,0xffc2ffc2,0xffc2ffc2,0xffc4ffc3,
-0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffcfffce,0xffd0ffd0,0xffd1ffd1,0xffd1ffd1,0xffd1ffd1,0xffceffd0,0xffceffcd,0xffd3ffd0,0xffd6ffd5,0xffd4ffd5,0xffd4ffd4,0xffd4ffd4,0xffd4ffd4,0xffd6ffd5,0xffd6ffd6,0xffd8ffd6,0xffd9ffd9,0xffdaffda,0xffdbffdb,0xffdcffdc,0xffdcffdc,0xffdcffdc,0xffdcffdc,0xffd8ffdb,0xffd6ffd6,0xffdaffd8,0xffdcffdc,
-0xffdbffdc,0xffd6ffd9,0xffd0ffd4,0xe9c1ffca,0x000033bb,0x00000000,0x00000000,0x00000000,0x00000000,0x0d820000,0xff8dbb85,0xff9eff97,0xffaaffa4,0xffb5ffb0,0xffbeffb9,0xffc2ffc1,0xffc2ffc2,0xffc2ffc4,0xffbfffbe,0xffc0ffbf,0xffc2ffc1,0xffc5ffc3,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffcfffce,0xffd1ffd0,0xffd2ffd1,0xffd2ffd2,0xffd2ffd2,0xffd1ffd2,
-0xffd0ffcf,0xffd3ffd3,0xffd2ffd2,0xffd1ffd1,0xffd2ffd1,0xffd3ffd2,0xffd4ffd4,0xffd6ffd5,0xffd6ffd6,0xffd9ffd8,0xffdaffd9,0xffdbffda,0xffdcffdb,0xffdcffdc,0xffddffdd,0xffddffdd,0xffd8ffdb,0xffd8ffd8,0xffdbffd9,0xffdcffdc,0xffdaffdb,0xffd6ffd9,0xffceffd3,0xb5bfffc7,0x00000db9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x11820000,0xff8cb584,0xff9dff95,0xffa9ffa3,0xffb3ffae,0xffbdffb8,0xffc3ffc1,0xffc8ffc6,0xffceffcc,0xffcbffcd,0xffc8ffc9,0xffc7ffc7,0xffc7ffc7,0xffc8ffc8,0xffc9ffc9,0xffcbffca,0xffccffcb,0xffcdffcd,0xffceffce,0xffcfffcf,0xffcfffcf,0xffceffcf,0xffcbffcd,0xffc7ffc9,0xffcbffc8,0xffd1ffce,0xffd6ffd4,0xffdaffd8,0xffdaffdb,
-0xffd8ffd9,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd8ffd6,0xffd8ffd8,0xffd9ffd9,0xffdaffd9,0xffdaffda,0xffdbffdb,0xffdbffdb,0xffdaffdb,0xffdaffda,0xffd8ffd9,0xffd6ffd6,0xffd8ffd6,0xffdbffd9,0xffdcffdc,0xffdaffdb,0xffd6ffd8,0xffcdffd2,0xb5beffc6,0x000011b5,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x71830000,0xff92ff8a,0xffa1ff9a,
-0xffadffa7,0xffb7ffb2,0xffc0ffbc,0xffc5ffc3,0xffc9ffc8,0xffcaffcb,0xffc5ffc6,0xffc5ffc5,0xffc5ffc5,0xffc6ffc6,0xffc8ffc7,0xffcaffc9,0xffcbffca,0xffcdffcc,0xffceffce,0xffcfffcf,0xffd0ffd0,0xffd0ffd0,0xffcfffd0,0xffccffce,0xffcbffca,0xffd1ffce,0xffd6ffd4,0xffd9ffd8,0xffd6ffd8,0xffd6ffd6,0xffd5ffd5,0xffd6ffd6,0xffd6ffd6,0xffd8ffd6,0xffd9ffd8,0xffd9ffd9,
-0xffdaffda,0xffdbffdb,0xffdbffdb,0xffdcffdc,0xffdcffdc,0xffdbffdb,0xffd4ffd6,0xffd6ffd6,0xffdaffd8,0xffdcffdb,0xffdbffdc,0xffd6ffd9,0xffd1ffd5,0xfbc4ffcc,0x01b574bc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb98a1984,0xff9cff92,0xffa9ffa3,0xffb4ffaf,0xffbdffb9,0xffc5ffc1,0xffc3ffc5,0xffc1ffc1,0xffc0ffc0,0xffc1ffc1,0xffc3ffc2,
-0xffc5ffc4,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffcfffce,0xffd0ffd0,0xffd1ffd1,0xffd1ffd1,0xffd1ffd1,0xffceffd0,0xffceffcd,0xffd4ffd1,0xffd6ffd6,0xffd5ffd6,0xffd4ffd5,0xffd4ffd4,0xffd5ffd5,0xffd6ffd6,0xffd6ffd6,0xffd8ffd8,0xffd9ffd9,0xffdaffda,0xffdbffdb,0xffdcffdb,0xffdcffdc,0xffdcffdc,0xffdbffdc,0xffdbffdb,0xffd9ffda,0xffdaffd9,0xffdaffda,
-0xffd8ffd9,0xffd3ffd6,0xffc7ffcf,0x17bcb5c1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x78880382,0xff99f991,0xffa8ffa1,0xffb3ffae,0xffbcffb8,0xffc0ffbf,0xffbdffbe,0xffbdffbd,0xffbeffbd,0xffc0ffbf,0xffc2ffc1,0xffc4ffc3,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffceffcd,0xffd0ffcf,0xffd1ffd0,0xffd2ffd2,0xffd3ffd3,0xffd3ffd3,0xffd1ffd2,
-0xffd1ffd0,0xffd5ffd4,0xffd3ffd4,0xffd2ffd3,0xffd3ffd3,0xffd4ffd3,0xffd5ffd4,0xffd6ffd6,0xffd8ffd6,0xffd9ffd9,0xffdaffda,0xffdbffdb,0xffdcffdc,0xffdcffdc,0xffddffdd,0xffdcffdc,0xffdcffdc,0xffdbffdb,0xffdaffda,0xffdaffda,0xffd6ffd9,0xffd2ffd5,0xf9c7ffcd,0x05b87ac0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x7e870582,0xff98f98f,0xffa6ffa0,0xffb2ffac,0xffbbffb6,0xffc3ffbf,0xffcaffc7,0xffcdffcd,0xffc9ffcb,0xffc6ffc7,0xffc5ffc6,0xffc6ffc5,0xffc7ffc6,0xffc8ffc7,0xffcaffc9,0xffcbffca,0xffccffcc,0xffceffcd,0xffceffce,0xffceffce,0xffcdffce,0xffcbffcc,0xffc7ffc8,0xffccffc8,0xffd2ffcf,0xffd6ffd4,0xffdaffd8,0xffdaffdb,
-0xffd8ffd9,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd8ffd6,0xffd8ffd8,0xffd9ffd9,0xffd9ffd9,0xffd9ffd9,0xffd9ffd9,0xffd9ffd9,0xffd8ffd9,0xffd6ffd6,0xffd5ffd5,0xffd9ffd6,0xffdaffda,0xffdaffda,0xffd6ffd9,0xffd1ffd5,0xf9c5ffcc,0x03b880be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xe78d4d85,0xff9eff96,
-0xffabffa5,0xffb5ffb0,0xffbeffb9,0xffc6ffc2,0xffcaffc9,0xffc5ffc7,0xffc3ffc4,0xffc3ffc3,0xffc4ffc4,0xffc5ffc5,0xffc7ffc6,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffceffcd,0xffcfffcf,0xffd0ffd0,0xffd0ffd0,0xffcfffcf,0xffcbffcd,0xffccffca,0xffd2ffcf,0xffd6ffd4,0xffd9ffd8,0xffd6ffd9,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd8ffd6,0xffd8ffd8,0xffd9ffd9,
-0xffdaffda,0xffdbffda,0xffdbffdb,0xffdbffdb,0xffdbffdb,0xffdaffda,0xffd8ffd9,0xffd8ffd6,0xffdaffd9,0xffdaffda,0xffd8ffd9,0xffd4ffd6,0xffcaffd0,0x41bde3c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01860000,0xd9955e8d,0xffa5ff9c,0xffb1ffab,0xffb9ffb6,0xffc2ffbf,0xffc0ffc2,0xffbeffbf,0xffbeffbe,0xffc0ffbf,0xffc1ffc1,
-0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffcbffc9,0xffcdffcc,0xffceffcd,0xffd0ffcf,0xffd1ffd0,0xffd1ffd1,0xffd0ffd1,0xffceffcf,0xffcfffcd,0xffd4ffd2,0xffd8ffd6,0xffd6ffd6,0xffd5ffd5,0xffd5ffd4,0xffd5ffd5,0xffd6ffd5,0xffd6ffd6,0xffd8ffd8,0xffd9ffd9,0xffdaffd9,0xffdaffda,0xffdbffda,0xffdaffdb,0xffdaffda,0xffd9ffda,0xffd8ffd9,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,
-0xffd3ffd5,0xffcaffd0,0x58c0ddc5,0x000003b8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xb893318b,0xffa3ff9b,0xffafffaa,0xffb9ffb5,0xffbcffbc,0xffb9ffbb,0xffbbffb9,0xffbcffbb,0xffbeffbd,0xffc1ffc0,0xffc3ffc2,0xffc6ffc5,0xffc9ffc7,0xffcbffca,0xffcdffcc,0xffcfffce,0xffd1ffd0,0xffd2ffd1,0xffd3ffd2,0xffd2ffd3,0xffd1ffd2,
-0xffd1ffd0,0xffd5ffd4,0xffd4ffd5,0xffd3ffd3,0xffd3ffd3,0xffd4ffd4,0xffd5ffd5,0xffd6ffd6,0xffd8ffd6,0xffd9ffd9,0xffdaffda,0xffdbffdb,0xffdbffdb,0xffdcffdc,0xffdbffdc,0xffdbffdb,0xffdaffda,0xffd8ffd9,0xffd6ffd6,0xffd6ffd6,0xffd2ffd4,0xfdcaffcf,0x25beb0c4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xc0912f8a,0xffa2ff9a,0xffaeffa8,0xffb8ffb3,0xffc1ffbd,0xffc7ffc4,0xffcaffca,0xffc6ffc8,0xffc3ffc4,0xffc3ffc3,0xffc3ffc3,0xffc4ffc4,0xffc6ffc5,0xffc8ffc7,0xffc9ffc8,0xffcbffca,0xffccffcb,0xffcdffcc,0xffcdffcd,0xffccffcc,0xffc9ffcb,0xffc6ffc7,0xffcbffc8,0xffd1ffce,0xffd6ffd4,0xffdaffd8,0xffd9ffda,
-0xffd6ffd8,0xffd6ffd6,0xffd5ffd5,0xffd5ffd5,0xffd6ffd5,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd5ffd5,0xffd3ffd4,0xffd2ffd1,0xffd5ffd4,0xffd6ffd6,0xffd6ffd6,0xffd2ffd4,0xffc7ffce,0x29beb5c3,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x13880000,0xf3988c90,
-0xffa7ff9f,0xffb2ffad,0xffbcffb7,0xffc3ffc0,0xffc7ffc7,0xffc3ffc4,0xffc1ffc1,0xffc1ffc1,0xffc2ffc1,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffcaffc9,0xffcbffcb,0xffcdffcc,0xffceffce,0xffcfffcf,0xffcfffcf,0xffceffcf,0xffcbffcc,0xffcbffc9,0xffd1ffce,0xffd6ffd4,0xffd9ffd8,0xffd6ffd9,0xffd6ffd6,0xffd5ffd5,0xffd5ffd5,0xffd6ffd6,0xffd6ffd6,0xffd8ffd6,0xffd8ffd8,
-0xffd9ffd9,0xffd9ffd9,0xffd9ffd9,0xffd9ffd9,0xffd8ffd8,0xffd6ffd8,0xffd5ffd6,0xffd4ffd4,0xffd6ffd6,0xffd6ffd6,0xffd4ffd5,0xffcdffd1,0x84c2f7c7,0x000009bc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05910000,0xc29d5497,0xffaafda4,0xffb5ffb0,0xffbdffb9,0xffbbffbd,0xffb9ffb9,0xffbbffb9,0xffbdffbc,0xffbfffbe,
-0xffc2ffc0,0xffc4ffc3,0xffc7ffc5,0xffc9ffc8,0xffcbffca,0xffcdffcc,0xffceffce,0xffcfffcf,0xffd0ffd0,0xffcfffd0,0xffcdffce,0xffceffcc,0xffd4ffd1,0xffd6ffd6,0xffd5ffd6,0xffd4ffd5,0xffd4ffd4,0xffd4ffd4,0xffd5ffd5,0xffd6ffd5,0xffd6ffd6,0xffd8ffd6,0xffd8ffd8,0xffd8ffd8,0xffd8ffd8,0xffd8ffd8,0xffd6ffd6,0xffd6ffd6,0xffd3ffd5,0xffd1ffd2,0xffd0ffd0,0xffcfffd0,
-0xfdc9ffcc,0x5cc2cac5,0x000003be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xa29b3d93,0xffa8eba2,0xffb4ffaf,0xffb7ffb7,0xffb6ffb7,0xffb7ffb7,0xffb9ffb8,0xffbcffbb,0xffbfffbe,0xffc2ffc1,0xffc5ffc3,0xffc8ffc6,0xffcaffc9,0xffccffcb,0xffceffcd,0xffd0ffcf,0xffd1ffd1,0xffd2ffd2,0xffd2ffd2,0xffd0ffd1,
-0xffd1ffd0,0xffd5ffd4,0xffd4ffd5,0xffd3ffd3,0xffd3ffd3,0xffd4ffd3,0xffd5ffd4,0xffd6ffd6,0xffd6ffd6,0xffd8ffd8,0xffd9ffd9,0xffdaffda,0xffdaffda,0xffdaffda,0xffd9ffd9,0xffd8ffd8,0xffd6ffd6,0xffd4ffd5,0xffd1ffd2,0xffceffd0,0xf5c8ffcb,0x37c0a6c4,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x9a9b3593,0xffa7f3a1,0xffb3ffae,0xffbcffb8,0xffc3ffc0,0xffc5ffc6,0xffc0ffc2,0xffbeffbf,0xffbeffbe,0xffbfffbe,0xffc0ffc0,0xffc2ffc1,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffc9ffc8,0xffcaffc9,0xffcaffca,0xffc9ffca,0xffc7ffc8,0xffc4ffc5,0xffcaffc6,0xffd0ffcd,0xffd5ffd3,0xffd8ffd6,0xffd8ffd9,
-0xffd5ffd6,0xffd3ffd4,0xffd3ffd3,0xffd2ffd2,0xffd3ffd3,0xffd3ffd3,0xffd3ffd3,0xffd3ffd3,0xffd3ffd3,0xffd2ffd3,0xffd1ffd2,0xffd0ffd1,0xffceffcf,0xffccffcd,0xffccffcb,0xffd0ffce,0xffd1ffd0,0xffceffd0,0xefc8ffca,0x3abf9cc4,0x000001b9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1d920000,
-0xd6a07e99,0xffacffa6,0xffb7ffb2,0xffbfffbb,0xffc1ffc2,0xffbeffbf,0xffbdffbd,0xffbdffbd,0xffbfffbe,0xffc1ffc0,0xffc3ffc2,0xffc5ffc4,0xffc7ffc6,0xffc9ffc9,0xffcbffca,0xffccffcc,0xffcdffcd,0xffcdffcd,0xffccffcd,0xffc9ffcb,0xffcaffc8,0xffd1ffce,0xffd5ffd3,0xffd8ffd6,0xffd6ffd8,0xffd4ffd5,0xffd4ffd4,0xffd4ffd4,0xffd4ffd4,0xffd5ffd5,0xffd5ffd5,0xffd6ffd6,
-0xffd6ffd6,0xffd6ffd6,0xffd6ffd6,0xffd5ffd5,0xffd4ffd4,0xffd2ffd3,0xffd0ffd1,0xffcfffcf,0xffd0ffd0,0xffcfffd0,0xffc9ffcd,0x76c3d9c7,0x000019be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x5ea31b9d,0xb6ae98a8,0xf2b5d6b2,0xffb1fbb3,0xffb3ffb2,0xffb6ffb4,0xffb8ffb7,0xffbbffb9,
-0xffbeffbd,0xffc1ffc0,0xffc4ffc3,0xffc7ffc5,0xffc9ffc8,0xffcbffca,0xffccffcc,0xffcdffcd,0xffceffce,0xffcdffcd,0xffcaffcc,0xffcdffca,0xffd2ffd0,0xffd6ffd5,0xffd4ffd6,0xffd3ffd3,0xffd2ffd2,0xffd2ffd2,0xffd3ffd3,0xffd4ffd3,0xffd4ffd4,0xffd5ffd5,0xffd5ffd5,0xffd5ffd5,0xffd4ffd5,0xffd3ffd4,0xffd1ffd2,0xffceffd0,0xffcaffcc,0xfdc6ffc6,0xd8c5eec5,0x9ec3c0c5,
-0x1dbf62c1,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x40a1079d,0xb0ac86a6,0xf9aedaaf,0xffafffad,0xffb2ffb0,0xffb5ffb4,0xffb9ffb7,0xffbcffb9,0xffc0ffbe,0xffc3ffc1,0xffc6ffc4,0xffc8ffc7,0xffcbffca,0xffcdffcc,0xffceffce,0xffd0ffcf,0xffd0ffd0,0xffd0ffd0,0xffceffcf,
-0xffd0ffce,0xffd5ffd3,0xffd3ffd5,0xffd2ffd3,0xffd2ffd2,0xffd3ffd2,0xffd4ffd3,0xffd5ffd4,0xffd6ffd5,0xffd6ffd6,0xffd6ffd6,0xffd8ffd8,0xffd6ffd6,0xffd6ffd6,0xffd5ffd6,0xffd3ffd4,0xffcfffd1,0xffc9ffcd,0xd6c6f7c8,0x80c4b0c4,0x07bf46c2,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x42a0079c,0xb2ab82a6,0xeeb4d8af,0xecb9f0b7,0xc8bbe6bc,0xb6b7c0b8,0xd2b4b8b6,0xeeb5deb4,0xffb5fdb6,0xffb9ffb7,0xffbcffb9,0xffbeffbd,0xffc1ffbf,0xffc2ffc1,0xffc4ffc3,0xffc5ffc4,0xffc5ffc5,0xffc5ffc5,0xffc3ffc4,0xffc1ffc1,0xffc7ffc4,0xffceffcb,0xffd3ffd0,0xffd5ffd4,0xffd5ffd6,
-0xffd1ffd3,0xffcfffd0,0xffceffce,0xffcdffcd,0xffcdffcd,0xffcdffcd,0xffcdffcd,0xffccffcd,0xffcbffcc,0xffc9ffca,0xffc7ffc7,0xe2c5f6c6,0xcac3c8c5,0xbcc2b4c3,0xe2c1b8c1,0xf4c5f0c3,0xd4c6eec5,0x8ac3b6c5,0x07bf4ec0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x74a4299f,0xcaafa8a9,0xf0b7e8b3,0xf0b8f0b9,0xffb4f4b6,0xffb4ffb3,0xffb7ffb5,0xffb9ffb8,0xffbcffbb,0xffbfffbe,0xffc2ffc0,0xffc4ffc3,0xffc6ffc5,0xffc8ffc7,0xffc9ffc8,0xffcaffca,0xffcaffca,0xffc9ffca,0xffc6ffc8,0xffc9ffc6,0xffcfffcc,0xffd4ffd1,0xffd6ffd5,0xffd4ffd6,0xffd2ffd3,0xffd1ffd1,0xffd1ffd1,0xffd1ffd1,0xffd2ffd1,0xffd2ffd2,0xffd2ffd2,
-0xffd2ffd2,0xffd1ffd2,0xffd0ffd1,0xffceffcf,0xffcbffcd,0xffc7ffc9,0xf0c6f9c7,0xf0c4f0c4,0xe8c5f2c5,0xa6c4ccc5,0x34c06cc3,0x000001be,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1aa907aa,0x6aaa3aaa,0xbeac98ab,0xffb0e8ae,0xffb4ffb2,
-0xffb9ffb7,0xffbcffbb,0xffc0ffbe,0xffc3ffc1,0xffc5ffc4,0xffc7ffc6,0xffc8ffc8,0xffcaffc9,0xffcaffca,0xffc9ffca,0xffc7ffc8,0xffcaffc8,0xffd0ffcd,0xffd3ffd2,0xffd1ffd3,0xffcfffd0,0xffcfffcf,0xffcfffcf,0xffd0ffcf,0xffd0ffd0,0xffd0ffd0,0xffd1ffd0,0xffd0ffd1,0xffd0ffd0,0xffceffcf,0xffcaffcc,0xefc7ffc7,0x92c3c0c5,0x44c068c2,0x07b91abe,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x07a30000,0x68a634a5,0xd4a9a2a7,0xffaefbac,0xffb3ffb1,0xffb8ffb5,0xffbcffb9,0xffbfffbe,0xffc3ffc1,0xffc6ffc4,0xffc8ffc7,0xffcaffc9,0xffccffcb,0xffcdffcd,0xffceffcd,0xffcdffce,0xffccffcd,
-0xffcfffcc,0xffd3ffd1,0xffd2ffd3,0xffd0ffd1,0xffd0ffd0,0xffd1ffd0,0xffd2ffd1,0xffd3ffd2,0xffd3ffd3,0xffd4ffd4,0xffd4ffd4,0xffd4ffd4,0xffd3ffd3,0xffd1ffd2,0xffceffd0,0xffc8ffcb,0x98c5dcc6,0x2ebf64c3,0x000007bc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x26ad0bad,0x52b044af,0x80b372b1,0xaeb598b4,0xceb7bab6,0xf0b9deb8,0xf3bbf4b9,0xffb9ffb9,0xffbcffbb,0xffbcffbc,0xffbcffbc,0xffbbffb9,0xffc3ffbf,0xffcaffc7,0xffceffcc,0xffd1ffd0,0xffceffd1,
-0xffcaffcc,0xffc6ffc8,0xffc4ffc5,0xffc2ffc2,0xf0c3fdc3,0xe2c3ecc3,0xbec2c8c3,0x90c1aec2,0x6cc180c1,0x40bf50c1,0x0fbd22bf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0faa0000,0x3eab1eab,0x7eae5aac,0xc6b098af,0xfdb3e6b2,0xffb7ffb4,0xffb9ffb9,0xffbdffbc,0xffc0ffbf,0xffc2ffc1,0xffc4ffc3,0xffc5ffc4,0xffc5ffc5,0xffc4ffc5,0xffc1ffc3,0xffc5ffc2,0xffccffc9,0xffd0ffce,0xffd3ffd2,0xffd0ffd2,0xffcdffce,0xffccffcd,0xffccffcc,0xffcbffcb,0xffccffcc,0xffcbffcb,0xffcbffcb,
-0xffc9ffca,0xffc7ffc8,0xeac5fdc6,0x9ec3c6c4,0x58c182c1,0x1ebd3cbf,0x000005bc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1da70000,0x6cac4aa9,
-0xc4af9eac,0xf9b3e8b1,0xffb7ffb4,0xffbbffb9,0xffbfffbd,0xffc1ffc0,0xffc2ffc1,0xffc4ffc3,0xffc4ffc4,0xffc4ffc4,0xffc2ffc3,0xffc6ffc3,0xffccffc9,0xffcfffce,0xffcdffcf,0xffcaffcb,0xffc9ffca,0xffc9ffc9,0xffc9ffc9,0xffc9ffc9,0xffc9ffc9,0xffc8ffc9,0xffc6ffc7,0xe3c5ffc4,0xa2c3c2c4,0x42c074c2,0x01bc1abf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x50a515a3,0xc8aa88a8,0xffaef5ad,0xffb5ffb2,0xffb9ffb8,0xffbeffbc,0xffc1ffc0,0xffc4ffc2,0xffc6ffc5,0xffc8ffc7,0xffc9ffc9,0xffc9ffc9,0xffc9ffca,0xffc8ffc9,
-0xffcbffc8,0xffd0ffce,0xffceffd0,0xffcdffcd,0xffccffcc,0xffcdffcc,0xffcdffcd,0xffceffce,0xffcfffcf,0xffcfffcf,0xffcfffcf,0xffcdffce,0xffcaffcc,0xf3c6ffc7,0x84c3c0c4,0x17bd54c0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03b10000,0x12b10eb1,0x30b220b2,0x4cb33cb3,0x8eb26ab3,0xf5b1c2b0,0xffbbffb6,0xffc2ffbf,0xffc7ffc5,0xffc6ffc7,0xb8c5f7c7,
-0x70bf8ac2,0x34bd52be,0x26b930b9,0x10b810b9,0x00000db8,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x09a90000,0x48ad26ab,0x72b156b0,0xa2b48eb2,0xb6b7b0b5,0xd0b9c8b7,0xf0b9dab9,0xf2bbf0b9,0xffbbfabb,0xffb9ffb9,0xffb9ffbb,0xffc0ffbc,0xffc7ffc3,0xffcbffc9,0xffccffcc,0xffc8ffca,0xffc3ffc5,0xfbc2ffc1,0xf1c1ffc1,0xe0c1e6c1,0xcac1d8c1,0xb0c0b0c2,0x8ebf9ec0,
-0x5cbf70c0,0x1abd38bf,0x00000bb9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x07aa0000,0x42af26ad,0x6eb25eb0,0x90b482b3,0xb0b6a6b6,0xc4b8b2b8,0xc0b9b8b9,0xd0b9ceb9,0xecb9e2b9,0xffb7f9b9,0xffbeffb9,0xffc4ffc2,0xffc7ffc6,0xf9c3ffc5,0xeabff0c1,0xd0bfd4bf,0xc8beccbe,0xb0bfb8bf,0x9ebfaebf,0x84be98be,0x5cbe6cbf,0x26bc46bd,0x01b90cbb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x22a707a3,0x86ab54a9,0xceb09eaf,0xffb3edb3,0xffb8ffb6,0xffbcffb9,0xffbfffbd,0xffc1ffc0,0xffc2ffc1,0xffc3ffc2,0xffc3ffc2,0xffc1ffc2,
-0xffc6ffc3,0xffcaffc8,0xffc8ffca,0xffc6ffc7,0xffc6ffc6,0xffc6ffc6,0xffc6ffc6,0xffc6ffc6,0xffc6ffc6,0xffc4ffc5,0xeac5fdc5,0xb0c2ccc3,0x56bf84c1,0x03bd20bf,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x07a80000,0x50b128ae,0x72b966b5,0x6abd70bc,0x26be4abe,0x000005bc,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0fb20000,0x32b126b0,0x7aaf4eb0,0xc8b6a6b2,0xf0bcdeb9,0xe4c1f0bf,0xa8c2cec2,0x4cbe74c1,0x20b92cbc,0x09b70cb9,0x01b407b5,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x26ad07ad,0x56b546b0,0x70b970b8,0x3ebd5ebc,0x03b926bb,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0eac01a8,0x40af22ad,0x5cb34eb1,0x70b66eb4,0x84b776b7,0x8eb78cb7,0x90b88eb7,0x94b890b7,0xc2b6aeb7,
-0xe8bcdab9,0xe0c0eebe,0xacbebac1,0x90bd9abd,0x90bc90bb,0x88bb8ebb,0x84bc86bc,0x6cbc70bd,0x52bc66bb,0x26bb3ebb,0x00000bbc,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0 };
-
-static float BodyLayerBoxes[] = {
-	0, 0, 116, 70,
-	116, 0, 228, 70,
-	228, 0, 334, 71,
-	334, 0, 438, 71,
-	0, 71, 102, 143,
-	102, 71, 200, 144,
-	200, 71, 296, 144,
-	296, 71, 390, 145,
-	390, 71, 480, 145,
-	0, 145, 88, 222,
-	88, 145, 174, 225,
-	174, 145, 256, 226,
-	256, 145, 336, 228,
-	336, 145, 414, 228,
-	414, 145, 488, 230,
-};
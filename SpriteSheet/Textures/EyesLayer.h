@@ -1,2094 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT static const unsigned long
-#endif
-
-A32BIT EyesLayer[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x00000100,		/* dwHeight */
-0x00000200,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00018017,		/* dwpfFlags */
-0x00040000,		/* dwDataSize */
-0x00000010,		/* dwBitCount */
-0x000000ff,		/* dwRBitMask */
-0x000000ff,		/* dwGBitMask */
-0x000000ff,		/* dwBBitMask */
-0x0000ff00,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x02000000,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,
-0x04000300,0x06000600,0x04000600,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x04000300,0x06000600,0x06000600,0x03000400,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,
-0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,
-0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020602,
-0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x03000300,0x02000300,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x0614060c,0x061e061c,
-0x060e0617,0x06020607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,
-0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06080606,0x06050607,0x06020604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x060d0607,0x06130612,0x060a060f,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x0627060d,0x06890657,0x06b006ab,
-0x0652068a,0x060e0626,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06090603,0x062b0617,0x0645063c,0x06340643,0x060f061e,0x06020606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x0622060d,0x06660643,0x06880684,0x063b0665,0x060a061c,0x06000603,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06140603,0x06bd0643,0x0bff08ff,0x0dff0dff,
-0x06ff0aff,0x062d0679,0x0602060d,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06030602,0x06020603,
-0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,
-0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06090605,0x0615060f,0x06160618,0x060a0610,0x06020605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060601,0x06490618,0x06ff06a0,0x08ff07ff,0x06ec07ff,0x0648068b,0x0608061b,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06150604,0x06ac0649,0x0aff07ff,0x0bff0cff,0x06d808ff,0x06260667,0x0602060b,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x0643060f,0x0bff06da,0x1dff14ff,0x1dff20ff,
-0x0cff15ff,0x065e06ff,0x0605061a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x060f0608,0x06200616,0x0631062a,0x0624062d,
-0x0612061c,0x06040609,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x061a0609,0x0668063b,0x06ab0693,0x069606af,0x0643066c,0x060f0622,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06240608,0x06ff0675,0x12ff0cff,0x17ff16ff,0x0dff13ff,0x06bb08ff,0x06160645,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x06530616,0x0bff06f0,0x1aff13ff,0x19ff1dff,0x0aff12ff,0x065306e5,0x06060618,0x06000601,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060600,0x06970626,0x15ff0aff,0x32ff24ff,0x2dff33ff,
-0x11ff1fff,0x068608ff,0x06070622,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020601,0x06020602,0x06020602,0x06010602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06090602,0x062c0615,0x06910659,0x06ff06d0,0x06ff06ff,0x06d606ff,
-0x0663069e,0x06190636,0x0604060b,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06160606,0x0693063f,0x0aff06ff,0x0fff0dff,0x0bff0eff,0x06ed08ff,0x06330676,0x06050612,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06050600,0x0670061c,0x0fff07ff,0x25ff1aff,0x2cff2cff,0x17ff22ff,0x07ff0eff,0x06240673,0x06020609,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,
-0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060c0601,0x06cf063c,0x17ff0bff,0x30ff26ff,0x29ff31ff,0x10ff1cff,0x067d07ff,0x06080624,0x06000601,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060b0601,0x06ee063e,0x1bff0eff,0x38ff2cff,0x30ff3aff,
-0x11ff20ff,0x067d08ff,0x06060620,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06030602,0x06080605,0x0611060b,0x06210619,0x062c0626,0x062d062e,0x0629062e,0x06160620,0x060a0610,0x06030606,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060a0603,0x0640061c,0x06ff068d,0x0dff09ff,0x14ff11ff,0x14ff15ff,0x0eff12ff,
-0x06ff0aff,0x0649069a,0x060d0622,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06060601,0x065c061b,0x0bff06f3,0x1bff12ff,0x23ff21ff,0x19ff20ff,0x0aff11ff,0x066706f0,0x060b0624,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060d0601,0x06d1063b,0x18ff0bff,0x34ff27ff,0x36ff3aff,0x1bff2aff,0x07ff0fff,0x06280682,0x0602060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06160603,0x07ff0664,0x1fff10ff,0x3aff30ff,0x2eff39ff,0x11ff1fff,0x068008ff,0x06070624,0x06000601,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060f0602,0x06f70644,0x19ff0dff,0x2fff27ff,0x25ff30ff,
-0x0dff18ff,0x065306fa,0x06040616,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06010600,0x06180607,0x062d062b,0x064f0637,0x06790663,0x06d1069f,0x06ff06fc,0x07ff06ff,0x06ff07ff,0x06e106ff,0x068506ae,0x063c065c,0x06140624,0x0606060b,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06070602,0x06360615,0x06fc067f,0x11ff0aff,0x21ff18ff,0x2dff29ff,0x28ff2dff,0x18ff21ff,
-0x0aff10ff,0x067e06ff,0x06160637,0x06020608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06140604,0x06df064b,0x16ff0bff,0x30ff22ff,0x36ff36ff,0x23ff2fff,0x0dff17ff,0x068707ff,0x060e0630,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06130603,0x06fc0653,0x19ff0dff,0x32ff27ff,0x31ff35ff,0x17ff25ff,0x06ff0dff,0x061d0665,0x06010607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x061a0604,0x08ff0673,0x1eff11ff,0x31ff2aff,0x25ff30ff,0x0dff18ff,0x065806ff,0x06050617,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060c0602,0x06ac0634,0x10ff09ff,0x1cff18ff,0x14ff1aff,
-0x07ff0dff,0x06290682,0x0602060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06170603,0x06ff0668,0x07ff08ff,0x0bff08ff,0x10ff0eff,0x14ff12ff,0x16ff15ff,0x17ff17ff,0x13ff15ff,0x0eff11ff,0x08ff0aff,0x06a006fc,0x06370662,0x0610061e,0x06030608,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06040601,0x061a060a,0x068e0640,0x0bff06ff,0x1cff13ff,0x31ff27ff,0x3aff38ff,0x30ff37ff,0x1bff26ff,
-0x0bff12ff,0x068306ff,0x06160637,0x06020607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06010600,0x06240608,0x07ff0679,0x1bff0fff,0x34ff28ff,0x37ff39ff,0x21ff2dff,0x0cff15ff,0x067206ff,0x060c0628,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06120603,0x06d00649,0x12ff0aff,0x21ff1bff,0x1dff22ff,0x0dff15ff,0x069007ff,0x060f0634,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06170604,0x06ff065b,0x14ff0cff,0x1eff1bff,0x15ff1cff,0x07ff0dff,0x062a0683,0x0602060b,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060601,0x0656061c,0x08ff06cd,0x0cff0bff,0x09ff0bff,
-0x067906f1,0x060d062f,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06010600,0x06970617,0x17ff0aff,0x17ff1dff,0x20ff18ff,0x29ff26ff,0x2eff2cff,0x2eff2fff,0x2aff2dff,0x21ff26ff,0x16ff1cff,0x0cff10ff,0x06e708ff,0x0650068b,0x0616062b,0x0605060b,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06020600,0x060a0605,0x06330617,0x06d00669,0x0dff08ff,0x1dff15ff,0x2dff26ff,0x31ff31ff,0x26ff2dff,0x14ff1cff,
-0x07ff0dff,0x065606b5,0x060e0624,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06010600,0x0628060a,0x07ff067c,0x16ff0dff,0x27ff20ff,0x26ff29ff,0x15ff1eff,0x07ff0dff,0x063c069a,0x06060616,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060b0602,0x06730629,0x09ff06fe,0x10ff0dff,0x0dff0fff,0x06ff09ff,0x0630067c,0x06040611,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060d0602,0x06870631,0x0aff06ff,0x0dff0dff,0x09ff0cff,0x067606f3,0x060e062e,0x06000603,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x061e060a,0x06730644,0x06bb06a0,0x066d06a3,
-0x06200641,0x0603060b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06070600,0x09ff0647,0x30ff1aff,0x26ff33ff,0x30ff25ff,0x37ff36ff,0x38ff38ff,0x35ff37ff,0x2cff31ff,0x21ff27ff,0x14ff1aff,0x0aff0fff,0x06bf07ff,0x06420672,0x06120624,0x06040608,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06000602,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06040601,0x060e0608,0x0634061b,0x06b10661,0x0aff07ff,0x13ff0eff,0x1bff18ff,0x1aff1bff,0x13ff17ff,0x09ff0eff,
-0x069306ff,0x0622064b,0x0605060e,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06010600,0x061b0607,0x06bd0652,0x0cff08ff,0x14ff10ff,0x12ff14ff,0x09ff0eff,0x068906ff,0x0617063c,0x06020607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x062a0610,0x069a065a,0x06ed06d1,0x06b006df,0x06460679,0x060d0621,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x062f0611,0x06990661,0x06cb06c1,0x067506ad,0x061e063f,0x0603060b,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070602,0x061b0610,0x06290624,0x06170623,
-0x0605060d,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x060d0600,0x0bff066d,0x32ff1eff,0x21ff32ff,0x28ff1fff,0x2cff2bff,0x2aff2cff,0x24ff27ff,0x1cff20ff,0x13ff17ff,0x0bff0fff,0x06ff08ff,0x065c069e,0x06200637,0x06080611,0x06020604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06030601,0x060a0606,0x061d0611,0x06590633,0x06d1068c,0x08ff06ff,0x0aff09ff,0x09ff0aff,0x06ff08ff,0x068206c6,
-0x06290650,0x06080613,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x060c0603,0x06470621,0x06cc0682,0x07ff06ff,0x06ff07ff,0x068106cd,0x06220645,0x06060610,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060a0604,0x06240615,0x0634062f,0x06260632,0x060c0617,0x06020605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060b0604,0x06200615,0x062e062b,0x06160624,0x0605060c,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06040602,0x06060605,0x06030605,
-0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x060a0600,0x08ff0657,0x1aff11ff,0x0fff17ff,0x12ff0dff,0x13ff14ff,0x12ff13ff,0x0eff10ff,0x0aff0dff,0x07ff09ff,0x06b106fb,0x064e067d,0x061b062e,0x0608060f,0x06020604,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x06030602,0x06090605,0x0619060f,0x06380624,0x06560649,0x06680662,0x0664066c,0x0638064b,0x06170626,
-0x0606060d,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06120608,0x06320622,0x0645063c,0x06380644,0x06180628,0x0606060d,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06050603,0x06070607,0x06050606,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06050603,0x06060606,0x06020604,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06040600,0x067e0623,0x08ff06ff,0x06b907ff,0x06d4069a,0x06e606ed,0x06cd06da,0x069606b1,0x06700687,0x063f0652,0x061e062f,0x060d0614,0x06040607,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06040602,0x06080606,0x060d060b,0x060e060e,0x060c060e,0x06060608,0x06020604,
-0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06080605,0x060a0609,0x06070609,0x06030605,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x06150606,0x0634062a,0x0619062a,0x06190613,0x061b061d,0x061b061b,0x06130618,0x060c060f,0x06070608,0x06030605,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06010601,0x06000601,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06040603,0x06010602,0x06010601,0x06010602,0x06010601,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000100,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06010600,0x06040602,0x06080607,0x06040606,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000601,0x06010600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x05000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06010600,0x06030601,0x06040603,0x06040605,0x06030604,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06020602,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x060a0607,0x060f060e,0x0607060c,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050602,0x06090608,0x06060609,
-0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06090602,0x06280617,0x063f063a,0x061f0633,0x0604060e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06060603,0x06090607,0x060e060b,0x06130610,0x061a0617,0x060d0618,0x06010602,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06030601,0x060d0607,0x06240618,0x0636062e,0x0636063a,0x0620062c,0x06080613,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060a0604,0x06160610,0x0618061a,0x060c0613,0x06020606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x061e060b,0x0657063b,0x066d066d,0x062f0652,0x06070614,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06090603,0x062e0619,0x06490640,0x062f0644,
-0x06080617,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06040600,0x06330611,0x06d4067d,0x06ff06ff,0x068d06ef,0x060f063a,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x060a0604,0x06200614,0x0642062e,0x067b065f,0x06a00690,0x06ac06b3,0x062e066a,0x060c061b,0x06000601,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06030601,0x06170609,0x066c0636,0x06ff06af,0x07ff07ff,0x07ff07ff,0x067206dd,0x060b0628,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060f0605,0x06500627,0x069a0678,0x06a806b5,0x064d067c,0x060c0624,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06190606,0x06a70648,0x09ff07ff,0x09ff0aff,0x06b707ff,0x06120648,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050600,0x06370613,0x06ee0683,0x08ff07ff,0x06c007ff,
-0x061d065a,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06110603,0x06c20640,0x0fff09ff,0x13ff14ff,0x07ff0eff,0x06190671,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06130608,0x06480624,0x06ca0680,0x09ff07ff,0x0eff0bff,0x0dff0fff,0x06da08ff,0x06170663,0x06000603,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06010600,0x06120605,0x066d062f,0x09ff06e3,0x13ff0eff,0x18ff17ff,0x0fff17ff,0x069108ff,0x06080626,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060a0602,0x0658061f,0x07ff06c5,0x0eff0bff,0x0dff0fff,0x06e309ff,0x06150653,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060601,0x0658061a,0x0bff06f6,0x19ff13ff,0x18ff1cff,0x08ff0fff,0x061d0679,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06150604,0x06d60649,0x10ff0aff,0x17ff16ff,0x0aff11ff,
-0x063106b7,0x06010608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06010600,0x062d060a,0x0aff06a9,0x22ff15ff,0x20ff27ff,0x09ff14ff,0x0620068e,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060c0605,0x0646061f,0x06fa068c,0x0dff09ff,0x19ff13ff,0x22ff20ff,0x0fff18ff,0x064f07ff,0x06020611,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06040601,0x06310610,0x06ff067f,0x15ff0cff,0x2aff20ff,0x2aff2eff,0x11ff1fff,0x066907ff,0x06050619,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06210608,0x06ff0669,0x14ff0cff,0x24ff1eff,0x1cff24ff,0x07ff0fff,0x0619066c,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060e0602,0x06c9063c,0x16ff0bff,0x31ff25ff,0x24ff2eff,0x0aff15ff,0x06260693,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x0637060b,0x0bff06bd,0x24ff16ff,0x27ff2bff,0x0eff1aff,
-0x064306fa,0x0601060d,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06020600,0x06510612,0x10ff06ff,0x28ff1dff,0x20ff2aff,0x09ff13ff,0x062b069f,0x06010608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x061b060b,0x068b0640,0x0aff06ff,0x17ff10ff,0x25ff1fff,0x1cff25ff,0x06ff0eff,0x06110656,0x06000602,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06020603,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06070601,0x064d061a,0x09ff06c7,0x1dff11ff,0x32ff29ff,0x28ff33ff,0x0dff18ff,0x064906f3,0x06030610,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x06470613,0x0bff06d3,0x25ff15ff,0x36ff31ff,0x21ff2fff,0x08ff12ff,0x061d0676,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06150603,0x06ff065b,0x1cff0fff,0x35ff2bff,0x24ff31ff,0x0bff15ff,0x063406b6,0x0601060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x06570613,0x10ff06ff,0x2cff1fff,0x2aff31ff,0x0eff1bff,
-0x065906ff,0x06030614,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06040600,0x06580615,0x0eff06ff,0x1dff17ff,0x1aff1eff,0x0aff12ff,0x063b06c0,0x0602060e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x06030603,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x061d060b,0x06900646,0x0aff06ff,0x15ff0fff,0x1bff1aff,0x0bff14ff,0x064806e6,0x06020611,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06050602,0x06040606,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06070601,0x06440617,0x08ff06ac,0x17ff0eff,0x25ff21ff,0x19ff22ff,0x08ff0fff,0x062b0695,0x0602060b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050600,0x06580618,0x0cff06fc,0x25ff18ff,0x32ff30ff,0x1dff2aff,0x08ff10ff,0x0622067c,0x06010607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06140603,0x06fc0654,0x16ff0cff,0x27ff21ff,0x1fff26ff,0x0bff14ff,0x064906df,0x06020610,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x06570614,0x0eff06ff,0x22ff19ff,0x22ff26ff,0x0fff19ff,
-0x067507ff,0x0606061e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x060b0604,0x063e061a,0x07ff0691,0x11ff0cff,0x15ff15ff,0x0bff10ff,0x065906f2,0x06040618,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06030600,0x06050605,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020602,0x06010602,0x06020601,0x06130607,0x065a062d,0x06ff06a4,0x0bff08ff,0x0aff0cff,0x06a107ff,0x060f063e,0x06000602,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06010600,0x06090605,0x06050609,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,
-0x06030601,0x0624060c,0x06c40658,0x0cff08ff,0x13ff11ff,0x0dff11ff,0x06d409ff,0x06190656,0x06010606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x063c0612,0x09ff06b0,0x18ff10ff,0x22ff20ff,0x16ff1eff,0x07ff0eff,0x0627067d,0x06010609,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x060f0606,0x0683062d,0x0cff07ff,0x18ff12ff,0x18ff1aff,0x0bff12ff,0x065f06ff,0x0605061a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000100,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06090603,0x06370615,0x08ff06a1,0x14ff0dff,0x1aff1aff,0x0fff16ff,
-0x06a208ff,0x060b0632,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,
-0x060e0606,0x06280619,0x06880644,0x0aff06ff,0x10ff0eff,0x0bff0fff,0x068607ff,0x06090629,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06050601,0x06070608,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020601,0x06050604,0x06070606,0x06060607,0x06120608,0x0658062d,0x0696067e,0x06aa06a6,0x06710695,0x061f0645,0x0602060b,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06020600,0x060c0608,0x0605060a,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06080604,
-0x060e060c,0x061c0611,0x065e0634,0x06d30698,0x06ff06ff,0x06e206ff,0x065c069c,0x060d062d,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06020600,
-0x06020604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06060604,0x061b060a,0x06b7064d,0x0cff08ff,0x13ff10ff,0x10ff13ff,0x06ff0bff,0x062d067e,0x0602060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06130606,0x061a061b,0x0630061d,0x06e30669,0x0dff09ff,0x12ff11ff,0x0bff0fff,0x067f06ff,0x060a062a,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x0615060b,0x0624061d,0x06890641,0x0bff06ff,0x13ff10ff,0x0fff12ff,
-0x06db09ff,0x0613064c,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,
-0x06080605,0x061b060f,0x06520630,0x06ff0693,0x0dff09ff,0x0cff0eff,0x06c008ff,0x06110646,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06070602,0x0608060a,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06030602,0x060b0607,0x061a0612,0x0622061e,0x06470631,0x063f064f,0x061e062c,0x060a0613,0x06020604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06040600,0x060e060a,0x0604060a,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x060f0606,
-0x06360623,0x061b062c,0x0627061e,0x06310630,0x062a062e,0x061c0622,0x06160618,0x0604060e,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06040600,
-0x0608060a,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060a0603,0x0624061a,0x0616061d,0x063f0620,0x06c20678,0x08ff06ff,0x08ff09ff,0x06bc06ff,0x0630066c,0x0603060e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x0616060b,0x0619061b,0x06160617,0x06470622,0x06e8068c,0x09ff07ff,0x07ff09ff,0x067406df,0x06110633,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060602,0x0612060c,0x061d0616,0x063b0626,0x06e6066e,0x0cff08ff,0x0dff0eff,
-0x06ff0aff,0x06240678,0x06010607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06020601,0x060b0605,0x06260615,0x06740642,0x07ff06d1,0x09ff09ff,0x06e108ff,0x06220669,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06090604,0x0607060b,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070602,0x06270612,0x0630063c,0x060f0617,0x06040609,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06060601,0x060e060d,0x06020608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060d0603,
-0x062f0621,0x060b0621,0x06030604,0x06030603,0x06010602,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06070601,
-0x060f0610,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060f0604,0x06270620,0x0611061d,0x0610060c,0x0624061b,0x06420632,0x06450648,0x0638063c,0x0619062f,0x06020608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06060605,0x06050605,0x06070606,0x060c0608,0x06230614,0x06400635,0x0650064b,0x062c0643,0x060b0619,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06040603,0x06090606,0x0617060e,0x06470623,0x06e40686,0x07ff07ff,
-0x06c407ff,0x06230663,0x06020609,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06040602,0x0617060a,0x065c0631,0x06a50687,0x067f06a8,0x061a0645,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06010600,0x060a0605,0x0606060a,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06170608,0x06190627,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06080602,0x060c060e,0x06010606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050601,
-0x06070609,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x060b0603,
-0x06110613,0x06010608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06080602,0x0607060b,0x06020604,0x06010601,0x06020601,0x06040603,0x06040604,0x06020603,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06030601,0x06050604,0x06050605,0x06020604,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06090604,0x06200612,0x0632062d,
-0x0626062f,0x060c061a,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06010600,0x06070603,0x06150610,0x06100615,0x06040609,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06020600,0x060a0606,0x06040608,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050601,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010602,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x060a0604,0x060a060d,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06010600,0x060f0606,
-0x060f0614,0x06020606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06070603,0x06020606,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06040604,
-0x06030604,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06030600,0x06090607,0x06030607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06190609,0x060b061c,0x06000603,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06010600,0x060b0605,0x0607060c,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06020600,0x06120609,
-0x06100614,0x06100610,0x0606060c,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06010600,0x06220609,0x06440647,0x060d0620,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06030600,0x06080607,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x0623060b,0x0681065b,0x0629065f,0x0603060d,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06020600,0x060d0608,0x0607060b,0x06060605,0x06050606,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06100606,0x0604060f,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06050600,0x061a060e,
-0x063c0629,0x06560650,0x062a0648,0x06050610,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06040600,0x06590617,0x08ff06e6,0x06b607ff,0x061f0655,0x0603060b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x06070607,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x061f060a,0x06d40659,0x07ff07ff,0x065806c6,0x0608061f,0x06000601,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06040601,0x060e060b,0x0613060f,0x0621061b,0x0618061f,0x0607060f,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x0624060d,0x064c064d,0x06080620,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06090602,0x0642061d,
-0x06ca067f,0x06ff06fe,0x067e06cf,0x0618063b,0x06010607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x060a0601,0x06ad062f,0x12ff0aff,0x13ff16ff,0x06f90cff,0x061c0657,0x06010606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06090603,0x06190612,0x0615061b,0x0608060e,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x060a0605,0x060c060d,0x06040608,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06050602,0x06060608,0x06010602,0x06010601,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06030602,0x06190608,0x06b5064b,0x0dff08ff,0x0bff0eff,0x068b07ff,0x060f0634,0x06000603,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06080602,0x061a0610,0x064b062e,0x06710668,0x06480661,0x0614062b,0x06020608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06080602,0x06300613,0x06f80681,0x068806fe,0x060b062c,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06180605,0x06a60646,
-0x0aff07ff,0x0bff0bff,0x06ff09ff,0x06360684,0x06050613,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06130602,0x06ff0652,0x1aff0eff,0x26ff24ff,0x10ff1fff,0x068708ff,0x060a0628,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06020600,0x063f060e,0x06e80698,0x06f806ff,0x066206ae,0x0611062c,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06010600,0x06200609,0x06870650,0x068e069f,0x062e065e,0x060a0615,0x06060608,0x06030604,0x06010601,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06070603,0x06050608,0x06050603,0x06090608,0x06060609,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06120608,0x061f061c,0x06800632,0x0bff06ff,0x16ff12ff,0x0fff15ff,0x06bf09ff,0x06140647,0x06000604,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06100605,0x064d0624,0x06d4068e,0x06ff06ff,0x06a606e8,0x06300661,0x06050612,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06030601,0x060d0607,0x064c0621,0x08ff06a7,0x0dff0dff,0x06a108ff,0x060d0633,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06030600,0x0634060e,0x07ff0695,
-0x11ff0cff,0x12ff14ff,0x09ff0eff,0x065c06e4,0x0609061f,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06080604,0x06110612,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,
-0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06220605,0x09ff0685,0x21ff13ff,0x32ff2eff,0x1eff2cff,0x07ff10ff,0x06230676,0x06010607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06040600,0x068b061f,0x11ff09ff,0x17ff17ff,0x0bff12ff,0x067406ff,0x06080624,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06060600,0x068d0623,0x0eff08ff,0x11ff12ff,0x07ff0cff,0x06650699,0x062f0644,0x06180624,0x0609060f,0x06030605,
-0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06010600,0x060a0606,0x060a060a,0x061c0611,0x06230623,0x0616061e,0x0606060d,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06130606,0x0665062d,0x06d406aa,0x08ff06f7,0x15ff0eff,0x1eff1bff,0x12ff1aff,0x06e20aff,0x06190654,0x06010606,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06030600,0x0629060e,0x06bd065f,0x09ff07ff,0x0bff0bff,0x07ff09ff,0x065906b6,0x060b0623,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06010600,0x06060603,0x061a060d,0x0671063a,0x09ff06e2,0x19ff0fff,0x12ff19ff,0x06b109ff,0x060f063a,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06070601,0x0664061d,0x0cff06ff,
-0x1aff13ff,0x1cff1dff,0x0dff15ff,0x068807ff,0x060c062e,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x060b0604,0x06290617,0x066a0649,0x06240657,0x06010609,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,
-0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06010600,0x0637060a,0x0bff06c2,0x28ff18ff,0x39ff36ff,0x23ff32ff,0x0aff14ff,0x064106b1,0x06030611,0x06010601,0x06010601,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x06070606,0x06070607,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06080600,0x06c10630,0x1aff0cff,0x30ff28ff,0x24ff31ff,0x09ff13ff,0x062a0697,0x060f0611,0x0608060b,0x06040606,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06070600,0x06ae062b,0x1aff0bff,0x2fff2bff,0x16ff26ff,0x0aff0eff,0x06ff07ff,0x067c06bb,0x0632064f,0x0610061d,
-0x06040609,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06040600,0x0611060c,0x06270617,0x06590641,0x06650668,0x063b0652,0x06100623,0x06020606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060601,0x064d0618,0x09ff06b9,0x10ff0eff,0x0eff0eff,0x1cff14ff,0x24ff23ff,0x14ff1eff,0x06f30bff,0x061b0658,0x06010606,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x060c0601,0x06620627,0x08ff06cc,0x11ff0cff,0x13ff13ff,0x0bff10ff,0x069507ff,0x0613063c,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06020601,0x06090604,0x06210610,0x068b0644,0x0cff07ff,0x1bff12ff,0x28ff27ff,0x13ff20ff,0x06c10aff,0x06110640,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x060f0602,0x06a80637,0x11ff09ff,
-0x24ff1bff,0x25ff28ff,0x12ff1cff,0x06bb09ff,0x06100642,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06020601,0x06040602,0x06150609,0x067b0633,0x08ff06f9,0x07ff09ff,0x062c0696,0x0602060b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,
-0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06020600,0x064f0612,0x0eff06ff,0x2dff1cff,0x3dff3aff,0x25ff34ff,0x0aff15ff,0x064206b4,0x06050613,0x06060603,0x06090608,0x06070608,0x06040605,0x06020603,0x06010602,0x06010601,0x06010601,0x06060603,0x06350611,0x0669065a,0x061d064e,0x06020609,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x060c0601,0x06e1063b,0x19ff0dff,0x34ff29ff,0x2dff36ff,0x11ff1fff,0x068407ff,0x064d0653,0x062f0641,0x06170621,0x0609060f,0x06030605,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x5061144d,0xaa668a64,0xa472b168,0x40ff7f90,0x21ff33ff,0x19ff1bff,0x11ff15ff,0x09ff0cff,0x06bf06ff,0x0649067b,
-0x06150629,0x0605060b,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x09260600,0x7d634460,0xb165a864,0x8464a864,0x144d5461,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x060c0602,0x062b0619,0x067d064c,0x06e806b8,0x06e706fa,0x068206b9,0x0624064b,0x0604060d,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06130604,0x06db0646,0x15ff0bff,0x27ff23ff,0x11ff18ff,0x24ff19ff,0x2bff2cff,0x16ff22ff,0x06ff0cff,0x061c0659,0x06010606,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06010600,0x0624060b,0x06c30659,0x0dff08ff,0x1aff14ff,0x1cff1dff,0x10ff17ff,0x06e80aff,0x06210661,0x06020609,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,
-0x06070603,0x06200610,0x06810641,0x0bff06ff,0x23ff14ff,0x2eff2bff,0x2fff34ff,0x15ff23ff,0x06d60bff,0x06140648,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06010600,0x061b0606,0x06ff065c,0x17ff0cff,
-0x2eff23ff,0x2eff33ff,0x16ff23ff,0x06f80cff,0x06170657,0x06000605,0x06000600,0x06000600,0x06010600,0x06030602,0x06040604,0x06060605,0x060b0608,0x061e0611,0x0689063c,0x0eff07ff,0x1bff18ff,0x09ff12ff,0x063406ac,0x0602060e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x38640933,0x986e736a,0xa47fb172,0x54df8c95,0x23ff35ff,0x0aff14ff,0x063406a9,0x0604060e,0x060e0606,0x061a0616,0x0619061b,0x06120615,0x060b060e,0x0609060a,0x06090608,0x060e060a,0x06300618,0x06ff0673,0x07ff09ff,0x063506a4,0x0602060d,0x10460600,0x90645a62,0xaf65a464,0x7d63a864,
-0x0a334460,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x245a0601,0x98676b64,0xb16ea86a,0x6f9e9a7d,0x22ff32ff,0x0fff19ff,0x06bb07ff,0x06d006b9,0x069e06c5,0x06540674,0x0627063b,0x060f0618,0x0606060a,0x06020603,0x06010601,0x06000601,0x06010601,
-0x06070602,0x060f0610,0x06010606,0x285a0600,0x9a646562,0xaf65b165,0x6b639264,0x06002659,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0xa2642057,0xff66f765,0xff66ff66,0xff68ff67,0xff6bff6a,0x6b83e56c,0x1aff18ff,0x1bff1cff,0x12ff16ff,0x0aff0eff,0x06c907ff,
-0x06460679,0x06160627,0x0606060c,0x06010603,0x06000601,0x06000600,0x06000600,0x0a330600,0xdf656d63,0xff66ff66,0xff66ff66,0xff67ff67,0xf765ff66,0x285a9864,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06020600,0x0629060c,0x067e0650,0x07ff06cd,0x0aff09ff,0x0aff0bff,0x06fa08ff,0x06490692,0x060a061c,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06270608,0x09ff068b,0x27ff14ff,0x33ff34ff,0x14ff1aff,0x2eff20ff,0x30ff34ff,0x17ff25ff,0x06ff0cff,0x061c065e,0x06010607,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06070600,0x06530621,0x277e079a,0x9a706573,0xac75af71,0x7192987e,0x17ff29ff,0x07ff0eff,0x06360692,0x0603060f,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,
-0x06100606,0x06500626,0x07ff06a3,0x18ff0eff,0x36ff2aff,0x38ff38ff,0x33ff3aff,0x16ff25ff,0x06e70bff,0x0615064f,0x06010605,0x2c5b0600,0x92646362,0xad65a864,0x65629a64,0x06002c5b,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06020600,0x062a060b,0x526e146b,0xac728870,
-0xa483ad79,0x3fff7ba3,0x1aff29ff,0x06ff0eff,0x061e066c,0x06010607,0x06000600,0x06000600,0x06030601,0x06090606,0x0610060d,0x061a0614,0x06320623,0x0687064d,0x0bff06ff,0x28ff15ff,0x23ff2cff,0x0aff15ff,0x063e06c0,0x06030611,0x0a330600,0x79634260,0xb165a064,0x8664af65,0x164f5a62,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,
-0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x6f630c3b,0xff66db65,0xff66ff66,0xff69ff67,0xff6bff6a,0x9a79f76a,0x08ff20ce,0x06300699,0x0603060b,0x060f0606,0x0628061c,0x06350631,0x06300633,0x0626062a,0x06210623,0x06260622,0x063c062d,0x06b10660,0x0cff07ff,0x0aff0fff,0x063e06be,0x1e560610,0xf7659a64,0xff66ff66,0xff67ff66,0xff67ff68,
-0xd965ff66,0x0a336d63,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x42600710,0xff65c365,0xff66ff66,0xff67ff66,0xff6bff6a,0xbf6eff68,0x08ff418a,0x067f06ad,0x06ff06b5,0x06ff06ff,0x06c306f3,0x066a0693,0x06350649,0x06170623,0x060b060f,0x06060608,0x06060606,0x060a0607,
-0x06260613,0x06290638,0x3d5f060d,0xff65c765,0xff66ff66,0xff67ff66,0xff67ff68,0xc365fd66,0x06004360,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x66620600,0xff66ef65,0xff67ff66,0xff6dff6a,0xff77ff71,0xff7bff79,0xff77ff7c,0x328cd071,0x12ff10ff,0x12ff13ff,0x0dff10ff,0x07ff0aff,
-0x068c06d6,0x06330656,0x0611061e,0x0606060a,0x06020603,0x06010601,0x06010601,0xd6652c5b,0xff66ff66,0xff6cff68,0xff71ff6e,0xff75ff73,0xff73ff75,0xf369ff70,0x06006262,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x060b0600,0x06870637,0x446e09a5,0xa46a776c,0xa86cb16a,0x5f7c8c71,0x09ff16d8,0x068706ff,0x06140638,0x06010606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x062b0608,0x0aff069f,0x26ff15ff,0x27ff2eff,0x1bff1cff,0x35ff28ff,0x34ff3aff,0x18ff27ff,0x06ff0dff,0x061d0660,0x06010608,
-0x12490600,0x8e645b62,0xb165a864,0x7f639c64,0x09263e5f,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06170602,0x45670643,0xff66be66,0xff66ff66,0xff68ff66,0xff6bff6a,0xc16efb69,0x0aff458e,0x064906ca,0x06050616,0x06000601,0x06000600,0x06000600,0x06000600,0x06010600,
-0x06130607,0x06720633,0x0aff06ed,0x1cff11ff,0x36ff2aff,0x3dff3bff,0x34ff3cff,0x16ff25ff,0x06ea0bff,0x06180653,0x47600605,0xff65bf65,0xff66ff66,0xff68ff66,0xff68ff68,0xbf65ff66,0x06003d5f,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06030600,0x9a651e58,0xff66f765,0xff66ff66,
-0xff69ff67,0xff6cff6b,0x7383df6e,0x07ff12ff,0x0623067c,0x06010608,0x06000600,0x06000600,0x06040601,0x060f0608,0x06240619,0x06410630,0x068b065c,0x07ff06d4,0x14ff0cff,0x2eff20ff,0x24ff31ff,0x0bff15ff,0x064606ce,0x0a350614,0xe5657363,0xff66ff66,0xff67ff66,0xff68ff68,0xf766ff67,0x22589c64,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x2e5c0600,0xff66d265,0xff66ff66,0xff6dff68,0xff76ff71,0xff7cff79,0xff7bff7e,0x6273f573,0x06270678,0x0603060a,0x060b0605,0x06220615,0x0636062c,0x0645063f,0x06450645,0x06460645,0x0654064b,0x067c0663,0x06ff06a7,0x0dff08ff,0x0aff0eff,0x064206c1,0xe9655962,0xff66ff66,0xff6eff6a,0xff74ff70,0xff77ff76,
-0xff72ff76,0xd267ff6e,0x0600325c,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x12490600,0xff66a164,0xff66ff66,0xff6bff67,0xff74ff6e,0xff7bff79,0xff7bff7c,0x9a70ff75,0x06370c5f,0x069e065c,0x06f106d6,0x06ec06f7,0x06a906cf,0x06660684,0x0636064b,0x061f0628,0x06140618,0x06130613,0x06190615,
-0x063e0624,0x10570652,0xfd659c64,0xff67ff66,0xff6eff6b,0xff74ff71,0xff76ff75,0xff70ff74,0x9666ff6a,0x06001046,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0xff657463,0xff66ff66,0xff6eff69,0xff7dff76,0xff88ff83,0xff8fff8c,0xff90ff90,0xed81ff8d,0x06fc327d,0x09ff07ff,0x08ff09ff,0x06ef07ff,
-0x068106b4,0x06390657,0x06160624,0x0608060d,0x06030605,0x06020602,0x305c0601,0xff66ed65,0xff6dff68,0xff7bff74,0xff85ff80,0xff89ff88,0xff8aff8b,0xff80ff87,0x6a66ff73,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x063b0606,0x6b6b1081,0xff66df66,0xff66ff66,0xff69ff67,0xff6dff6b,0xa06eef6a,0x06e2228e,0x06240665,0x0603060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06170604,0x06ff065e,0x14ff0cff,0x21ff1bff,0x21ff21ff,0x3aff2eff,0x35ff3dff,0x18ff27ff,0x06ff0dff,0x061f0660,0x24590608,
-0xf7659c64,0xff66ff66,0xff68ff66,0xff68ff68,0xdb65ff66,0x0a336f63,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x0a460607,0xff669665,0xff66ff66,0xff6bff68,0xff75ff6e,0xff7bff79,0xff7dff7f,0x9476ff77,0x065f0aac,0x06080620,0x06000601,0x06000600,0x06000600,0x06000600,0x06010600,
-0x060b0603,0x064d0620,0x07ff06a3,0x14ff0cff,0x2bff1eff,0x3aff35ff,0x31ff39ff,0x15ff23ff,0x06e60bff,0x0a3f0656,0xff659e64,0xff68ff66,0xff6eff6c,0xff76ff72,0xff78ff76,0xff70ff74,0x9e65fd6a,0x06000a33,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x6a630601,0xff66f365,0xff67ff66,0xff6eff6a,
-0xff78ff73,0xff7dff7b,0xff79ff7e,0x2a7fd473,0x06270679,0x0602060a,0x06000600,0x06000600,0x06030601,0x060c0606,0x06270617,0x0655063b,0x06bb067f,0x09ff06ff,0x14ff0eff,0x28ff1dff,0x22ff2cff,0x0aff15ff,0x064b06d4,0xd265325f,0xff66ff66,0xff6cff68,0xff73ff70,0xff77ff76,0xff73ff77,0xf569ff70,0x06005c62,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,
-0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0xe965395e,0xff66ff66,0xff6dff68,0xff7bff74,0xff87ff82,0xff8fff8c,0xff92ff92,0xfd87ff90,0x0619707b,0x06020607,0x06090604,0x06170610,0x0623061c,0x0631062c,0x06380633,0x0643063c,0x06540649,0x067c0665,0x06d4069d,0x0aff07ff,0x08ff0cff,0x726506a8,0xff66ff65,0xff70ff6a,0xff7fff78,0xff87ff83,0xff8bff8a,
-0xff89ff8b,0xff7cff85,0x325ee96e,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0xc0651046,0xff66ff66,0xff6aff67,0xff78ff70,0xff85ff80,0xff8dff8a,0xff91ff90,0xff8aff90,0x0c4fbc7d,0x0649062c,0x06780662,0x0699068c,0x06820693,0x065c066e,0x063b064c,0x0626062f,0x061b0620,0x06190619,0x061d061a,
-0x06380626,0xbc651261,0xff67ff66,0xff72ff6b,0xff7fff79,0xff88ff84,0xff8bff8a,0xff88ff8a,0xff79ff83,0x0a33ba6b,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x04000200,0x06000600,0x06000600,0x06000600,0x4f610600,0xff66fd65,0xff6bff66,0xff7cff73,0xff8bff84,0xff95ff90,0xff9dff99,0xffa1ffa0,0xff9cffa0,0x1c8de18f,0x06d906d6,0x06c406d6,0x068706a6,
-0x0655066d,0x062e0640,0x0614061f,0x0608060d,0x06040606,0x06030603,0xe1651852,0xff6aff66,0xff7cff72,0xff8bff84,0xff93ff90,0xff99ff97,0xff9bff9a,0xff95ff99,0xfb7fff8f,0x06005769,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06010600,0x2c690620,0xff66ce67,0xff66ff66,0xff6dff69,0xff77ff72,0xff7eff7b,0xff7dff7f,0x6075f375,0x0641069f,0x06060615,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050600,0x06440618,0x09ff06a9,0x1aff11ff,0x22ff1eff,0x38ff2dff,0x31ff39ff,0x16ff24ff,0x06ff0cff,0x06200660,0xed655962,
-0xff67ff66,0xff6eff6b,0xff75ff72,0xff77ff77,0xff72ff76,0xd467ff6e,0x06002a5b,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06020600,0xbe65104c,0xff66ff66,0xff6bff67,0xff79ff72,0xff86ff80,0xff8eff8b,0xff93ff91,0xff8dff93,0x0c71b682,0x060a0626,0x06000602,0x06000600,0x06000600,0x06000600,0x06010600,
-0x06030601,0x06160608,0x066c062f,0x0aff06f7,0x1cff12ff,0x2fff29ff,0x27ff2eff,0x12ff1dff,0x06ce0aff,0xbe650c5c,0xff68ff66,0xff75ff6d,0xff82ff7c,0xff89ff86,0xff8cff8b,0xff88ff8b,0xff77ff82,0x1046b66a,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x03000000,0x06000600,0x06000600,0x06000600,0x06010600,0xff657863,0xff66ff66,0xff6eff69,0xff7eff77,
-0xff89ff84,0xff90ff8d,0xff92ff92,0xe984ff8f,0x06243078,0x0602060a,0x06000600,0x06000600,0x06030601,0x06070605,0x0614060c,0x0631061f,0x067c0651,0x06ff06b9,0x0eff09ff,0x1fff15ff,0x1cff23ff,0x09ff11ff,0x306306c0,0xff66ed65,0xff6eff69,0xff7dff76,0xff86ff82,0xff8bff89,0xff8aff8c,0xff80ff87,0x7866ff72,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,
-0x03000000,0x06000600,0x06000600,0x06000600,0x18510600,0xff66e165,0xff69ff66,0xff79ff71,0xff89ff82,0xff93ff8f,0xff9dff99,0xffa2ffa0,0xffa0ffa2,0x4f84fd97,0x06010604,0x06060602,0x0613060c,0x061d0619,0x061f061f,0x0621061f,0x062a0626,0x0635062e,0x064f063f,0x06900668,0x08ff06d8,0x06ff09ff,0xfb655366,0xff6eff68,0xff81ff78,0xff8eff88,0xff96ff92,0xff9aff98,
-0xff9bff9c,0xff93ff99,0xe376ff8a,0x06001652,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0xff669e64,0xff68ff66,0xff76ff6e,0xff86ff7f,0xff92ff8d,0xff9bff97,0xffa0ff9e,0xffa1ffa2,0x9a8bff9b,0x062b0618,0x0650063f,0x06570659,0x06490652,0x063c0641,0x062b0635,0x061f0624,0x0617061a,0x06150616,0x061c0617,
-0x063c0626,0xff669465,0xff70ff68,0xff83ff7b,0xff8fff8a,0xff96ff93,0xff9aff99,0xff9aff9b,0xff93ff97,0x9e70ff85,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0xe3650f40,0xff67ff66,0xff76ff6c,0xff88ff80,0xff95ff8f,0xffa0ff9b,0xffa8ffa4,0xffaeffab,0xffaeffaf,0x959dffa8,0x07ff08ff,0x06ff07ff,0x06bb06eb,
-0x066d0690,0x06380650,0x061b0627,0x060d0612,0x06070609,0x07040605,0xff669664,0xff77ff6b,0xff8bff82,0xff97ff91,0xffa0ff9c,0xffa5ffa3,0xffa8ffa7,0xffa6ffa7,0xff9affa2,0x0b38e184,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x02000000,0x06000400,0x06000600,0x06000600,0x06070600,0xe7662e60,0xff66ff66,0xff6dff68,0xff7cff74,0xff88ff83,0xff90ff8d,0xff93ff93,0xff89ff92,0x065e7081,0x060a0620,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060e0603,0x069e0632,0x10ff09ff,0x1bff15ff,0x2cff25ff,0x27ff2dff,0x12ff1dff,0x06df0aff,0x7864065a,0xff67ff65,
-0xff72ff6c,0xff81ff7b,0xff89ff86,0xff8cff8b,0xff89ff8c,0xff7bff86,0x2e5ce76d,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x03000000,0x06000600,0x06000600,0x06000600,0x06070600,0xff669664,0xff68ff66,0xff77ff6e,0xff87ff80,0xff93ff8d,0xff9cff98,0xffa2ffa0,0xffa3ffa4,0x9e8fff9d,0x060a0621,0x06000602,0x06000600,0x06000600,0x06000600,0x06020600,
-0x06070603,0x0613060b,0x06430621,0x06f80680,0x10ff0aff,0x1dff18ff,0x19ff1dff,0x0cff12ff,0x069807ff,0xff669e65,0xff73ff6a,0xff86ff7d,0xff91ff8c,0xff98ff95,0xff9cff9b,0xff9aff9c,0xff92ff97,0x9e6eff83,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x04000200,0x06000600,0x06000600,0x06000600,0x4f610600,0xff66fd65,0xff6bff66,0xff7dff74,0xff8cff85,
-0xff96ff91,0xff9eff9a,0xffa3ffa1,0xff9fffa2,0x146edd93,0x06010607,0x06000600,0x06000600,0x06030601,0x06090606,0x060f060c,0x061a0613,0x063f0628,0x06970663,0x08ff06ea,0x13ff0cff,0x12ff16ff,0x07ff0cff,0xe165146e,0xff6cff67,0xff80ff76,0xff8dff87,0xff96ff92,0xff9aff98,0xff9bff9c,0xff96ff9a,0xfd7dff8e,0x06005368,0x06000600,0x06000600,0x06000600,0x02000400,
-0x04000200,0x06000600,0x06000600,0x06000600,0x9a640700,0xff66ff66,0xff73ff69,0xff86ff7d,0xff93ff8d,0xff9fff9a,0xffa7ffa3,0xffaeffab,0xffb0ffb0,0xdda0ffad,0x06010f5e,0x06070602,0x0615060d,0x0627061e,0x0630062d,0x06340633,0x06370635,0x063f0639,0x06560648,0x06a10671,0x09ff06fc,0x11a60aff,0xff68e566,0xff7dff6e,0xff8fff87,0xff9aff95,0xffa2ff9f,0xffa7ffa5,
-0xffa9ffa8,0xffa5ffa8,0xff93ff9f,0x07009a79,0x06000600,0x06000600,0x06000600,0x02000400,0x03000000,0x06000600,0x06000600,0x06000600,0x47600600,0xff66ff65,0xff70ff68,0xff83ff79,0xff92ff8b,0xff9dff97,0xffa6ffa1,0xffacffa9,0xffb0ffaf,0xffa5ffae,0x06354b90,0x065e064c,0x066d066a,0x0662066a,0x064d0658,0x06360641,0x0627062e,0x061d0621,0x061d061c,0x062a0620,
-0x4564063c,0xff69ff65,0xff7fff73,0xff90ff89,0xff9bff96,0xffa2ff9f,0xffa7ffa5,0xffa8ffa8,0xffa4ffa7,0xff8cff9d,0x06004370,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x07000600,0xff666761,0xff6cff66,0xff82ff77,0xff92ff8b,0xff9eff99,0xffa9ffa4,0xffb1ffad,0xffb8ffb5,0xffbbffb9,0xf7aeffb8,0x0aff1ccc,0x08ff09ff,0x06e706ff,
-0x068506b3,0x0642065f,0x0620062f,0x06100616,0x0608060b,0x20520607,0xff6af365,0xff85ff77,0xff97ff8f,0xffa2ff9d,0xffaaffa6,0xffafffad,0xffb3ffb2,0xffb3ffb3,0xffabffb1,0x6d80ff9e,0x06000700,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x16520600,0xff66df65,0xff69ff66,0xff79ff71,0xff8aff82,0xff95ff90,0xff9eff9a,0xffa3ffa1,0xffa2ffa4,0x4d89ff98,0x060d0628,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070603,0x06220610,0x06860643,0x0bff06ff,0x12ff0fff,0x1cff18ff,0x18ff1cff,0x0cff12ff,0x06a307ff,0xff654b64,0xff70ff69,
-0xff84ff7b,0xff91ff8b,0xff98ff95,0xff9bff9a,0xff9bff9c,0xff93ff99,0xe375ff89,0x06001a54,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x445f0600,0xff66ff65,0xff70ff68,0xff83ff79,0xff93ff8b,0xff9dff98,0xffa7ffa2,0xffaeffab,0xffb2ffb0,0xffa7ffb0,0x060e4492,0x06000603,0x06000600,0x06000600,0x06000600,0x06040601,
-0x06110609,0x06340620,0x068b0654,0x08ff06df,0x12ff0cff,0x1cff19ff,0x16ff1aff,0x0aff10ff,0x466706ff,0xff6afd65,0xff83ff77,0xff93ff8c,0xff9eff99,0xffa4ffa1,0xffa8ffa7,0xffa8ffa9,0xffa3ffa7,0xff89ff9b,0x0600436d,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0xe1651046,0xff67ff66,0xff76ff6c,0xff88ff80,0xff96ff90,
-0xffa1ff9c,0xffa9ffa5,0xffafffac,0xffb1ffb1,0x939affab,0x06020707,0x06000600,0x06000600,0x06050602,0x060f060a,0x061f0616,0x06340629,0x06570643,0x06a40676,0x08ff06f3,0x13ff0cff,0x11ff16ff,0x07e70bff,0xff679666,0xff79ff6e,0xff8eff85,0xff9aff95,0xffa2ff9e,0xffa7ffa5,0xffa9ffa8,0xffa6ffa8,0xff99ffa1,0x0d3ce381,0x06000600,0x06000600,0x06000600,0x03000600,
-0x06000300,0x06000600,0x06000600,0x06000600,0xf9651e4f,0xff69ff66,0xff7eff72,0xff90ff88,0xff9dff97,0xffa8ffa2,0xffb1ffac,0xffb8ffb4,0xffbcffbb,0xffb6ffbc,0x0702639f,0x06090603,0x061d0612,0x0635062a,0x0643063c,0x06480647,0x064d0649,0x06590651,0x067c0666,0x06f206a4,0x0eff08ff,0x696e0eff,0xff6eff67,0xff8bff7f,0xff9bff93,0xffa5ffa0,0xffacffa9,0xffb1ffaf,
-0xffb4ffb3,0xffb2ffb4,0xffa7ffae,0x1f62f593,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0xb6640700,0xff67ff66,0xff7bff6e,0xff8dff85,0xff9bff93,0xffa5ffa0,0xffafffaa,0xffb6ffb3,0xffbbffb9,0xffb7ffbc,0x0738b6a8,0x067d0665,0x0690068c,0x0681068c,0x06630672,0x06460654,0x0632063b,0x0627062b,0x06270626,0x063b062d,
-0xb7650746,0xff74ff69,0xff8dff82,0xff9cff95,0xffa6ffa1,0xffadffa9,0xffb2ffaf,0xffb4ffb3,0xffb2ffb3,0xffa3ffad,0x0700bc8b,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x08000600,0xff66bb64,0xff74ff69,0xff8bff81,0xff9bff93,0xff64ff9e,0xff88ff52,0xffb9ffb5,0xffc1ffbd,0xffc6ffc4,0xffc1ffc6,0x09ff64b6,0x07ff08ff,0x06cb06ff,
-0x0673069b,0x063a0653,0x061b0627,0x060d0613,0x0607060a,0x68600705,0xff74ff69,0xff91ff85,0xffa0ff9a,0xffabffa6,0xff55ff81,0xffb5ff71,0xffbcffbb,0xffbeffbe,0xffb9ffbd,0xb997ffb0,0x06000800,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x04000200,0x06000600,0x06000600,0x06000600,0x93640701,0xff66ff66,0xff72ff69,0xff86ff7d,0xff93ff8e,0xff9fff9a,0xffa8ffa4,0xffafffac,0xffb2ffb1,0xe7a2ffaf,0x06131174,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06160608,0x066c0632,0x08ff06d0,0x14ff0eff,0x1aff18ff,0x1dff1eff,0x14ff1aff,0x0aff0fff,0x0d6806ff,0xff69df65,0xff81ff74,
-0xff92ff8b,0xff9dff98,0xffa4ffa1,0xffa8ffa6,0xffa9ffa9,0xffa5ffa8,0xff91ff9f,0x07009877,0x06000600,0x06000600,0x06000600,0x02000400,0x03000000,0x06000600,0x06000600,0x06000600,0xbe640700,0xff67ff66,0xff79ff6e,0xff8dff85,0xff9cff95,0xffa6ffa1,0xffb0ffab,0xffb7ffb4,0xffbdffbb,0xffbbffbe,0x0711baaa,0x06010606,0x06000600,0x06000600,0x06000600,0x06060602,
-0x061c060e,0x06570634,0x06ef068f,0x0dff08ff,0x20ff15ff,0x2eff2dff,0x1dff27ff,0x0bff13ff,0xb86507dc,0xff78ff6a,0xff90ff86,0xff9eff98,0xffa8ffa4,0xffafffac,0xffb3ffb1,0xffb4ffb4,0xffb1ffb3,0xffa2ffac,0x0700be86,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x07000600,0xff666761,0xff6bff66,0xff81ff77,0xff92ff8a,0xff9fff99,
-0xffa9ffa4,0xffb2ffae,0xffb9ffb6,0xffbdffbc,0xf5b1ffbb,0x06041c7e,0x06000601,0x06010600,0x06070603,0x0617060e,0x062e0622,0x064f063c,0x06870666,0x06ff06b7,0x0cff08ff,0x1fff14ff,0x16ff20ff,0x1a8a0dff,0xff6cf766,0xff89ff7b,0xff9aff92,0xffa5ffa0,0xffacffa9,0xffb1ffaf,0xffb4ffb3,0xffb3ffb4,0xffaaffb0,0x6b7dff9c,0x06000600,0x06000600,0x06000600,0x03000600,
-0x06000300,0x06000600,0x06000600,0x07000600,0xff666260,0xff70ff67,0xff88ff7d,0xff98ff90,0xff7bff9f,0xff6cff4f,0xffb8ffb1,0xffc0ffbc,0xffc6ffc4,0xffc4ffc8,0x0802b7b6,0x06080602,0x061c0611,0x06320628,0x063f063a,0x06450643,0x06490646,0x0656064e,0x067c0664,0x06fa06a7,0x0fff09ff,0xbd670eff,0xff7dff6d,0xff96ff8c,0xffa5ff9e,0xffa8ffaa,0xff5bff70,0xffb9ff8d,
-0xffbeffbd,0xffbeffbe,0xffb7ffbc,0x6489ffa9,0x06000700,0x06000600,0x06000600,0x03000600,0x04000200,0x06000600,0x06000600,0x06000600,0xf5651540,0xff6cff66,0xff85ff79,0xff96ff8e,0xff90ff9d,0xff5bff5b,0xffb7ff9c,0xffbfffbb,0xffc5ffc2,0xffc6ffc7,0x1981f9bb,0x0673065e,0x06860681,0x06750680,0x065a0667,0x0640064c,0x062d0636,0x06240627,0x06240623,0x0639062b,
-0xfb661553,0xff81ff70,0xff97ff8e,0xffa5ff9f,0xff9cffaa,0xff5fff5c,0xffbbffa6,0xffbeffbc,0xffbdffbe,0xffb4ffb9,0x195cfba0,0x06000600,0x06000600,0x06000600,0x02000400,0x06000300,0x06000600,0x06000600,0x08000600,0xff67e365,0xff7eff6e,0xff93ff8a,0xffa2ff9b,0xff08ff37,0xff0aff09,0xffc1ff7f,0xffc8ffc5,0xffcfffcc,0xffcdffd0,0x08bc8dbf,0x06d306fc,0x068006a7,
-0x06470660,0x06240634,0x06110618,0x0608060c,0x06040606,0x9c630802,0xff80ff6e,0xff9aff8f,0xffa9ffa3,0xff75ffaf,0xff09ff08,0xff41ff0a,0xffc5ffc3,0xffc7ffc6,0xffc5ffc7,0xe3a9ffbe,0x06000800,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x06000600,0xf3651c4e,0xff68ff66,0xff7eff72,0xff90ff88,0xff9eff97,0xffa8ffa3,0xffb1ffad,0xffb9ffb5,0xffbeffbc,0xffb8ffbe,0x071465a2,0x06020608,0x06000600,0x06000600,0x06000600,0x06000600,0x06050601,0x0628060f,0x06cd065e,0x0fff08ff,0x27ff1aff,0x32ff2eff,0x2cff31ff,0x19ff24ff,0x0aff10ff,0x5f6407bd,0xff73ff68,0xff8eff83,
-0xff9eff97,0xffa8ffa3,0xffaeffab,0xffb3ffb1,0xffb5ffb4,0xffb2ffb4,0xffa5ffae,0x1e5efb8f,0x06000600,0x06000600,0x06000600,0x03000600,0x04000200,0x06000600,0x06000600,0x06000600,0xfd651743,0xff6bff66,0xff84ff78,0xff96ff8e,0xff8fff9d,0xff5fff56,0xffb8ffa1,0xffc0ffbc,0xffc7ffc4,0xffc8ffc9,0x1d80fbbe,0x06010606,0x06000600,0x06000600,0x06000600,0x06060602,
-0x061e060f,0x065c0636,0x06ff069e,0x0fff09ff,0x25ff18ff,0x33ff32ff,0x1bff27ff,0x09ff10ff,0xfb661969,0xff85ff73,0xff9bff92,0xffa8ffa2,0xff9cffad,0xff66ff62,0xffbcffa6,0xffbeffbe,0xffbdffbe,0xffb3ffb9,0x1555f79e,0x06000600,0x06000600,0x06000600,0x02000400,0x06000300,0x06000600,0x06000600,0x08000600,0xff66bb64,0xff74ff69,0xff8bff81,0xff9bff93,0xff65ff9b,
-0xff88ff52,0xffb9ffb5,0xffc2ffbe,0xffc7ffc5,0xffc3ffc8,0x070468a8,0x06000601,0x06000600,0x06070603,0x0617060d,0x062f0622,0x0650063c,0x068c0669,0x06ff06c1,0x0eff09ff,0x21ff16ff,0x15ff21ff,0x60690bff,0xff78ff69,0xff93ff89,0xffa4ff9d,0xffaeffa9,0xff59ff88,0xffb5ff74,0xffbdffbc,0xffbeffbe,0xffb8ffbc,0xaf96ffae,0x06000700,0x06000600,0x06000600,0x03000600,
-0x06000300,0x06000600,0x06000600,0x08000600,0xff669162,0xff78ff6c,0xff90ff85,0xffa0ff98,0xff08ff6e,0xff09ff09,0xffbfff46,0xffc8ffc4,0xffcfffcc,0xffd1ffd1,0x0802e7c6,0x06050601,0x0612060b,0x0620061a,0x06290626,0x062d062b,0x0631062e,0x063b0634,0x06570645,0x06b70679,0x0aff07ff,0xee6609ff,0xff89ff76,0xffa0ff96,0xffadffa7,0xff3cffb2,0xff09ff09,0xff7fff0c,
-0xffc6ffc5,0xffc7ffc7,0xffc2ffc6,0x949cffb9,0x06000800,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x07000600,0xff66455c,0xff74ff68,0xff8dff82,0xff9dff96,0xff12ff95,0xff09ff08,0xffacff1b,0xffc6ffc2,0xffcdffca,0xffd1ffd0,0x3da9ffcb,0x064c063e,0x06570655,0x064c0653,0x06390642,0x06290630,0x061d0623,0x06170619,0x06180617,0x071f061d,
-0xff6a495f,0xff8cff7c,0xffa1ff98,0xffaeffa8,0xff1bffa1,0xff09ff09,0xffafff1d,0xffc6ffc5,0xffc7ffc7,0xffc0ffc5,0x418affb3,0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x12340600,0xff69fd65,0xff85ff76,0xff9aff91,0xffa3ffa2,0xff09ff09,0xff0bff0a,0xffc7ff47,0xffd0ffcc,0xffd6ffd4,0xffd8ffda,0x0765a9ca,0x06670679,0x063c0651,
-0x0620062d,0x06100617,0x0607060b,0x06030605,0x06020602,0xa5640701,0xff8bff75,0xffa3ff98,0xffb1ffab,0xff42ffb6,0xff0aff0a,0xff0dff0b,0xffcdffc1,0xffd0ffce,0xffceffd0,0xf2b6ffc9,0x06000800,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x07000600,0xff666560,0xff6eff67,0xff88ff7d,0xff98ff91,0xff7fff9f,0xff6eff53,0xffb9ffae,0xffc1ffbe,0xffc8ffc5,0xffc7ffc9,0x0811afb8,0x06020608,0x06000600,0x06000600,0x06000600,0x06000600,0x06050601,0x06300611,0x06f80674,0x13ff0aff,0x30ff20ff,0x3bff3aff,0x2dff36ff,0x16ff21ff,0x07ff0dff,0xb7640866,0xff82ff6e,0xff9aff8f,
-0xffa8ffa1,0xffabffad,0xff54ff71,0xffbcff8c,0xffbeffbe,0xffbeffbf,0xffb5ffbb,0x6485ffa6,0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x07000600,0xff66415b,0xff73ff68,0xff8dff82,0xff9dff96,0xff18ff98,0xff09ff08,0xffb0ff18,0xffc7ffc3,0xffcfffcb,0xffd3ffd2,0x41a9ffcd,0x06010604,0x06000600,0x06000600,0x06000600,0x06040601,
-0x0615060a,0x06450626,0x06c30675,0x0cff07ff,0x1eff13ff,0x26ff2bff,0x11ff1bff,0x06dc09ff,0xff6e4560,0xff90ff80,0xffa5ff9c,0xffb1ffac,0xff19ffa4,0xff0aff09,0xffb2ff1b,0xffc7ffc6,0xffc7ffc8,0xffbfffc5,0x4385ffb0,0x06000600,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff66ea65,0xff7dff6e,0xff93ff89,0xffa2ff9b,0xff08ff3b,
-0xff0aff09,0xffc1ff7d,0xffcaffc6,0xffd0ffcd,0xffcfffd2,0x08029abc,0x06000601,0x06000600,0x06040601,0x060f0609,0x061f0616,0x0637062a,0x06650649,0x06ce068c,0x0bff07ff,0x19ff11ff,0x0dff16ff,0x916508cd,0xff85ff6e,0xff9eff93,0xffadffa6,0xff79ffb2,0xff09ff09,0xff45ff0a,0xffc6ffc5,0xffc7ffc7,0xffc4ffc7,0xeaa6ffbb,0x06000800,0x06000600,0x06000600,0x03000600,
-0x06000300,0x06000600,0x06000600,0x08000600,0xff66a663,0xff80ff70,0xff97ff8d,0xffa6ff9f,0xff09ff3e,0xff0bff0a,0xffc6ff0f,0xffcfffcb,0xffd6ffd3,0xffdbffda,0x0a14f3d1,0x06020600,0x06080604,0x060f060b,0x06120611,0x06150614,0x06160616,0x061c0618,0x062b0622,0x065f063e,0x06ee06a0,0xf9690e63,0xff93ff80,0xffa8ff9f,0xffb5ffaf,0xff0cffb5,0xff0bff0a,0xff4bff0b,
-0xffceffcc,0xffd0ffd0,0xffccffcf,0xb1aaffc3,0x06000800,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff66555c,0xff7cff6d,0xff93ff89,0xffa4ff9d,0xff08ff70,0xff0aff09,0xff82ff0b,0xffcdffc9,0xffd6ffd2,0xffdaffd9,0x56b9ffd5,0x0624061a,0x06280628,0x06230627,0x061a061e,0x06120616,0x060d0610,0x060b060c,0x060b060b,0x070e060e,
-0xff6e555f,0xff95ff85,0xffa9ffa1,0xffb6ffb0,0xff09ff80,0xff0bff0a,0xff88ff0b,0xffceffcd,0xffd0ffcf,0xffcbffcf,0x579affbf,0x06000800,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x0a0a0600,0xff6de865,0xff8cff7d,0xffa0ff97,0xffadffa8,0xff0aff28,0xff0cff0b,0xffceff6e,0xffd6ffd3,0xffdfffdb,0xffe1ffe2,0x07239bd0,0x0624062b,0x0615061c,
-0x060a060f,0x06050607,0x06020603,0x06010601,0x06000600,0xa1650700,0xff92ff7c,0xffaaffa0,0xffb8ffb2,0xff6cffbe,0xff0bff0b,0xff37ff0c,0xffd5ffd0,0xffd8ffd6,0xffd6ffd8,0xf0c0ffd2,0x06000800,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x08000600,0xff669c63,0xff78ff6b,0xff90ff85,0xff9fff98,0xff09ff69,0xff09ff09,0xffc0ff44,0xffc9ffc5,0xffd0ffcd,0xffd2ffd3,0x080beac7,0x06010606,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x0624060c,0x06c50659,0x10ff08ff,0x2aff1bff,0x31ff31ff,0x1eff29ff,0x0dff15ff,0x069807ff,0xea67082a,0xff8dff79,0xffa3ff9a,
-0xffb0ffab,0xff3cffb5,0xff09ff09,0xff83ff0a,0xffc7ffc6,0xffc8ffc8,0xffc1ffc6,0x949affb6,0x06000800,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff66575c,0xff7bff6c,0xff93ff89,0xffa4ff9c,0xff08ff6d,0xff0aff09,0xff80ff0b,0xffceffc9,0xffd6ffd3,0xffdcffda,0x55b7ffd5,0x06000702,0x06000600,0x06000600,0x06000600,0x06010600,
-0x06090604,0x06220612,0x0666063c,0x07ff06b3,0x11ff0bff,0x14ff16ff,0x07ff0dff,0x064d06ac,0xff72565f,0xff99ff8b,0xffadffa5,0xffb9ffb4,0xff0aff7f,0xff0bff0a,0xff87ff0b,0xffcfffce,0xffd0ffd0,0xffcaffce,0x5796ffbd,0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff69f065,0xff85ff76,0xff9aff90,0xffa1ffa2,0xff09ff09,
-0xff0bff0a,0xffc8ff45,0xffd1ffcd,0xffd9ffd5,0xffdaffdb,0x0801a4c9,0x06000600,0x06000600,0x06020600,0x06060604,0x060e060a,0x061a0613,0x06320624,0x06690647,0x06ff06a5,0x0dff0aff,0x06ff0bff,0xa265084d,0xff8fff79,0xffa7ff9d,0xffb5ffaf,0xff42ffb9,0xff0bff0a,0xff0eff0b,0xffceffcd,0xffd0ffcf,0xffceffd0,0xf3b4ffc7,0x06000a0f,0x06000600,0x06000600,0x03000600,
-0x06000300,0x06000600,0x06000600,0x08000600,0xff699a63,0xff87ff76,0xff9dff93,0xffacffa5,0xff0aff67,0xff0cff0b,0xffcdff34,0xffd6ffd2,0xffdfffda,0xffe3ffe2,0x0a13ebda,0x06000600,0x06020601,0x06040603,0x06060605,0x06070606,0x06070607,0x06090608,0x060f060b,0x06230616,0x0650063c,0xf16c0a22,0xff9bff88,0xffb0ffa7,0xffbcffb6,0xff2fffc0,0xff0cff0b,0xff78ff0c,
-0xffd6ffd4,0xffd8ffd6,0xffd5ffd8,0x9cb3ffcd,0x06000800,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x07000600,0xff664b5c,0xff83ff70,0xff9aff90,0xffaaffa3,0xff0bff95,0xff0bff0a,0xffb1ff15,0xffd4ffd0,0xffddffd9,0xffe3ffe1,0x44c0ffdc,0x060c0608,0x060d060d,0x060c060d,0x0608060a,0x06060607,0x06040605,0x06030604,0x06030603,0x06060604,
-0xff754e5f,0xff9eff8e,0xffb1ffa8,0xffbdffb7,0xff0fffa5,0xff0cff0b,0xffb3ff13,0xffd6ffd4,0xffd8ffd6,0xffd4ffd8,0x47a0ffc8,0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff6eca64,0xff91ff82,0xffa6ff9d,0xffb5ffae,0xff59ffa9,0xff78ff43,0xffd4ffcc,0xffddffd9,0xffe7ffe3,0xffe7ffea,0x07096ccf,0x0609060b,0x06050607,
-0x06020603,0x06010601,0x06000600,0x06000600,0x06000600,0x70620700,0xff98ff80,0xffb1ffa7,0xffbfffb9,0xffc8ffc4,0xff42ff77,0xffbeff56,0xffdcffd9,0xffe0ffdd,0xffdfffe0,0xc2c5ffda,0x06000800,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x08000600,0xff66a463,0xff7fff70,0xff96ff8c,0xffa6ff9f,0xff09ff39,0xff0bff0a,0xffc7ff0e,0xffd0ffcb,0xffd8ffd4,0xffdcffdb,0x0804f2d3,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06110605,0x06660629,0x09ff06d4,0x18ff10ff,0x1aff1cff,0x0eff14ff,0x06e509ff,0x062d066d,0xf26a080b,0xff97ff85,0xffacffa3,
-0xffb8ffb3,0xff0effb8,0xff0bff0a,0xff48ff0b,0xffcfffce,0xffd0ffd0,0xffccffcf,0xa7a7ffc2,0x06000800,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x07000600,0xff664d5c,0xff82ff70,0xff9aff8f,0xffaaffa2,0xff10ff9c,0xff0bff0a,0xffadff13,0xffd5ffd0,0xffddffda,0xffe4ffe2,0x47bcffdd,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06030601,0x060a0605,0x06230614,0x06720640,0x07ff06c3,0x07ff09ff,0x066406c7,0x0611062b,0xff784a5c,0xffa1ff93,0xffb5ffac,0xffc0ffbb,0xff0effa8,0xff0cff0b,0xffb1ff11,0xffd6ffd5,0xffd8ffd8,0xffd2ffd6,0x4d9dffc6,0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff6dea65,0xff8bff7d,0xff9fff96,0xffaeffa8,0xff0aff2d,
-0xff0cff0b,0xffceff79,0xffd8ffd3,0xffe0ffdc,0xffe2ffe3,0x0800a2cf,0x06000600,0x06000600,0x06000600,0x06020601,0x06040603,0x06080606,0x0611060c,0x06240619,0x0665063c,0x06ea06b6,0x065306ae,0xa0660814,0xff97ff80,0xffaeffa5,0xffbcffb6,0xff6effc1,0xff0cff0b,0xff38ff0c,0xffd6ffd4,0xffd8ffd6,0xffd6ffd8,0xebbdffd1,0x06000a0f,0x06000600,0x06000600,0x03000600,
-0x06000300,0x06000600,0x06000600,0x08000600,0xff6b7260,0xff8dff7b,0xffa2ff99,0xffb2ffab,0xff72ffb6,0xff5eff42,0xffd3ffb9,0xffdcffd8,0xffe6ffe1,0xffeaffea,0x0700c4dd,0x06000600,0x06000600,0x06000600,0x06010601,0x06010601,0x06010601,0x06020601,0x06030602,0x06090605,0x06140611,0xc26e0708,0xffa1ff8e,0xffb6ffad,0xffc3ffbd,0xffb9ffc8,0xff48ff5f,0xffd6ff81,
-0xffddffdb,0xffe0ffdf,0xffddffe0,0x6ab5ffd3,0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x06000600,0xfd66234e,0xff87ff74,0xffa0ff95,0xffb0ffa8,0xff8dffb6,0xff42ff43,0xffd1ff9a,0xffdbffd6,0xffe4ffe0,0xffeaffe8,0x22a6fde4,0x06020602,0x06030603,0x06020603,0x06010602,0x06010601,0x06010601,0x06000600,0x06000600,0x06010601,
-0xff762050,0xffa4ff93,0xffb8ffaf,0xffc4ffbe,0xff9cffc8,0xff51ff50,0xffd9ffa0,0xffddffdc,0xffe0ffdf,0xffdcffe0,0x1d84fbcd,0x06000600,0x06000600,0x06000600,0x02000400,0x06000300,0x06000600,0x08000700,0x08000800,0xff708161,0xff96ff85,0xffabffa2,0xffb9ffb3,0xffc6ffc0,0xffd1ffcc,0xffdbffd6,0xffe5ffe0,0xffeeffea,0xfdebfff0,0x094829b5,0x084e0801,0x0600075c,
-0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x2b520900,0xff9cfd7f,0xffb7ffac,0xffc5ffbf,0xffcfffcb,0xffd6ffd3,0xffddffda,0xffe3ffe0,0xffe7ffe5,0xffe7ffe8,0x76c2ffdd,0x08000900,0x07000800,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x08000600,0xff68a263,0xff86ff74,0xff9dff93,0xffacffa5,0xff0aff64,0xff0bff0b,0xffcdff36,0xffd6ffd2,0xffe0ffdb,0xffe4ffe3,0x0801eada,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050601,0x0622060d,0x069c0649,0x0aff06ff,0x0aff0bff,0x06ca07ff,0x063a0675,0x06080617,0xf06e0802,0xff9fff8d,0xffb3ffab,
-0xffc0ffb9,0xff30ffc3,0xff0cff0b,0xff7eff0c,0xffd6ffd5,0xffd8ffd8,0xffd4ffd6,0x9ab0ffcb,0x06000800,0x06000600,0x06000600,0x03000600,0x05000200,0x06000600,0x06000600,0x06000600,0xff66254f,0xff86ff73,0xff9fff93,0xffafffa8,0xff90ffb6,0xff48ff48,0xffd2ff9f,0xffdbffd6,0xffe5ffe0,0xffebffe8,0x1e99fce5,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06020601,0x06080604,0x061c060f,0x06570633,0x064f0669,0x06110628,0x06020607,0xfd791f49,0xffa8ff97,0xffbbffb3,0xffc7ffc1,0xff97ffcb,0xff50ff54,0xffdaffa5,0xffddffdc,0xffe0ffe0,0xffdaffdf,0x2387fdca,0x06000600,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff6ec664,0xff90ff81,0xffa5ff9c,0xffb4ffad,0xff59ffaa,
-0xff78ff40,0xffd5ffcc,0xffddffda,0xffe7ffe3,0xffe8ffeb,0x08006ccf,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06040602,0x06090606,0x061a060f,0x06390631,0x06100623,0x74630804,0xff9dff85,0xffb5ffab,0xffc2ffbc,0xffc9ffc7,0xff45ff74,0xffc5ff5e,0xffddffdb,0xffe0ffdf,0xffddffe0,0xc6c0ffd6,0x06000800,0x06000600,0x06000600,0x03000600,
-0x06000300,0x06000600,0x07000600,0x09000800,0xfb682a51,0xff90ff7d,0xffa7ff9d,0xffb7ffb0,0xffc4ffbe,0xffcfffc9,0xffd9ffd4,0xffe3ffdd,0xffedffe8,0xffeffff0,0x090079d9,0x08000801,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07010600,0x07020702,0x7b6b0900,0xffa5ff8f,0xffbcffb3,0xffcaffc4,0xffd2ffce,0xffdaffd6,0xffe0ffdd,
-0xffe4ffe2,0xffe8ffe6,0xffe4ffe7,0x2f9effd6,0x08000802,0x07010800,0x06000600,0x03000600,0x04000200,0x06000600,0x08000700,0x08000800,0xcc650900,0xff8aff76,0xffa4ff99,0xffb5ffad,0xffc2ffbc,0xffcdffc8,0xffd6ffd2,0xffe1ffdc,0xffebffe6,0xfff0ffef,0x0941d0e3,0x0800084c,0x07000800,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x08000700,0x08000800,
-0xd0750900,0xffa9ff97,0xffbeffb5,0xffcaffc4,0xffd3ffcf,0xffdaffd6,0xffe0ffdd,0xffe5ffe3,0xffe8ffe7,0xffe1ffe7,0x0907ccce,0x0700070a,0x06000700,0x06000600,0x00000300,0x06000300,0x06000600,0x09000700,0x09000b00,0xef6c4120,0xff99ff86,0xffafffa6,0xffbfffb7,0xffcbffc5,0xffd6ffd1,0xffe1ffdc,0xffecffe6,0xfff5fff0,0xc1dafff5,0x0b3a322a,0x094b0b07,0x0600075c,
-0x06000600,0x06000600,0x06000600,0x07000600,0x0b000900,0x2c000b00,0xff9dbf77,0xffbcffb0,0xffcbffc4,0xffd6ffd1,0xffddffda,0xffe4ffe1,0xffeaffe7,0xffeeffed,0xffecffef,0x3f3febdd,0x0b000b01,0x07000900,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x08000600,0xff6a7660,0xff8bff79,0xffa2ff98,0xffb1ffaa,0xff6cffb7,0xff54ff3c,0xffd3ffbd,0xffddffd8,0xffe7ffe2,0xffecffeb,0x0800c2dd,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06070602,0x06240611,0x06790648,0x0672068c,0x0628064b,0x06080613,0x06010603,0xc2710800,0xffa5ff92,0xffb9ffb1,
-0xffc6ffc1,0xffbdffcb,0xff4cff5e,0xffd8ff81,0xffddffdc,0xffe0ffdf,0xffdcffdf,0x76b1ffd1,0x06000800,0x06000600,0x06000600,0x03000600,0x04000100,0x06000600,0x07000600,0x08000800,0xcc640900,0xff89ff74,0xffa4ff98,0xffb5ffad,0xffc1ffbb,0xffcdffc7,0xffd8ffd2,0xffe2ffdd,0xffecffe7,0xfff1fff0,0x0a1bcde5,0x07000724,0x07000800,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06010600,0x06040602,0x06100609,0x060c0613,0x07010605,0x08000800,0xcf790900,0xffaeff9c,0xffc2ffb9,0xffcdffc8,0xffd6ffd2,0xffdcffd9,0xffe2ffdf,0xffe6ffe4,0xffe7ffe7,0xffe0ffe6,0x0906d0cb,0x08000807,0x06000700,0x06000600,0x02000400,0x06000300,0x06000600,0x07000600,0x08000800,0xff707760,0xff93ff84,0xffaaffa0,0xffb9ffb2,0xffc6ffc0,
-0xffd1ffcb,0xffdbffd6,0xffe5ffe0,0xffefffea,0xfdedfff2,0x07112ebb,0x085b0800,0x0600076c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06040602,0x060a0609,0x07010704,0x2c580800,0xffa0fd83,0xffbbffb0,0xffc9ffc3,0xffd2ffce,0xffd9ffd6,0xffdfffdc,0xffe4ffe2,0xffe7ffe6,0xffe5ffe7,0x7bbfffdb,0x07000800,0x07000800,0x06000600,0x03000600,
-0x04000200,0x06000600,0x08000600,0x0b000b00,0xb4622e00,0xff92ff7c,0xffabffa1,0xffbcffb4,0xffc9ffc3,0xffd5ffcf,0xffdfffda,0xffeaffe4,0xfff3ffef,0xf1effff6,0x0b013d46,0x09000b00,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x09000800,0x4a200b00,0xffa7ef8a,0xffc2ffb7,0xffcfffc9,0xffd9ffd4,0xffe0ffdd,0xffe6ffe3,
-0xffebffe8,0xffefffed,0xffe6ffee,0x2803b2cc,0x0b010b02,0x07010902,0x06000600,0x02000400,0x03000000,0x06000600,0x09000700,0x0b000b00,0x81470b00,0xff8cff74,0xffa9ff9d,0xffb9ffb2,0xffc7ffc1,0xffd3ffcd,0xffddffd8,0xffe8ffe3,0xfff2ffed,0xfff3fff6,0x0bbe83ad,0x0b610b39,0x0700096e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x09000700,0x0b000b00,
-0x7f510b00,0xffacff93,0xffc3ffb9,0xffd0ffca,0xffd9ffd5,0xffe0ffdd,0xffe7ffe4,0xffecffe8,0xffefffee,0xffe4ffed,0x0b217d92,0x09010907,0x06000801,0x06000600,0x00000300,0x06000300,0x06000600,0x08000600,0x0b000b00,0xd7360b00,0xff98ff81,0xffb3ffa8,0xffc4ffbc,0xffd1ffcb,0xffdcffd6,0xffe7ffe2,0xfff2ffed,0xfff9fff6,0xc336fee8,0x0b011b11,0x070c090a,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x09000700,0x17000b00,0xff8dc318,0xffbfffaf,0xffd0ffc9,0xffdbffd6,0xffe4ffe0,0xffebffe8,0xfff1ffee,0xfff5fff3,0xffe8fff3,0x0b02d26c,0x0b000b01,0x06000800,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x08000700,0x08000700,0xfd682a50,0xff8fff7d,0xffa7ff9c,0xffb6ffaf,0xffc3ffbd,0xffcfffc9,0xffd9ffd4,0xffe4ffdd,0xffeeffe8,0xffeffff2,0x090076d8,0x08010800,0x06000701,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06050602,0x0616060b,0x0611061a,0x06040608,0x07000602,0x08000800,0x786d0900,0xffaaff93,0xffc0ffb7,
-0xffcdffc7,0xffd5ffd2,0xffdcffd9,0xffe1ffdf,0xffe5ffe3,0xffe8ffe7,0xffe2ffe7,0x2d97fdd3,0x08000900,0x07000800,0x06000600,0x03000600,0x03000000,0x06000600,0x08000600,0x0b000b00,0x83460b00,0xff8aff73,0xffa7ff9b,0xffb9ffb1,0xffc6ffc0,0xffd2ffcd,0xffddffd8,0xffe8ffe3,0xfff2ffed,0xfff1fff6,0x0a4679ae,0x09890919,0x07000989,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06010602,0x08000600,0x0b000b00,0x61710a00,0xffb1ff99,0xffc7ffbe,0xffd3ffce,0xffdcffd8,0xffe3ffe0,0xffe8ffe6,0xffedffeb,0xffeeffee,0xffe2ffec,0x0b197f97,0x0b010b05,0x06000801,0x06000600,0x00000300,0x06000300,0x06000600,0x08000600,0x09000b00,0xef6b3f18,0xff97ff85,0xffaeffa4,0xffbeffb7,0xffcbffc5,
-0xffd6ffd1,0xffe1ffdb,0xffecffe6,0xfff5fff1,0xb6dffff6,0x0a243726,0x09520b03,0x0600076c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x09000800,0x24000900,0xffa2b77c,0xffc0ffb4,0xffceffc8,0xffd8ffd4,0xffe0ffdc,0xffe6ffe3,0xffebffe8,0xffeeffed,0xffeaffee,0x4533f3db,0x09000902,0x07000900,0x06000600,0x03000600,
-0x03000000,0x06000600,0x07000600,0x0b000900,0xc3141500,0xff91fe6e,0xffaeffa2,0xffc0ffb8,0xffceffc8,0xffdaffd4,0xffe5ffe0,0xfff0ffeb,0xfff9fff6,0xdc80fff7,0x0b014b12,0x088e0b6b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x0b000800,0x0b000b00,0xffa3e33e,0xffc5ffb8,0xffd4ffce,0xffdfffda,0xffe7ffe3,0xffedffea,
-0xfff2fff0,0xfff5fff3,0xffdafff1,0x1907b227,0x09030b01,0x06000702,0x06000600,0x00000300,0x03000000,0x06000600,0x07000600,0x0b000900,0x87020b00,0xff89f457,0xffabff9e,0xffbeffb6,0xffccffc5,0xffd9ffd3,0xffe4ffdd,0xffeeffe8,0xfff8fff3,0xf4bffff8,0x0b847d15,0x099d0b28,0x0600079b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x0b000900,
-0x8d020b00,0xffabf06a,0xffc7ffbb,0xffd5ffcf,0xffdfffdb,0xffe7ffe3,0xffedffea,0xfff3fff0,0xfff3fff3,0xeeb2ffee,0x0b1b8705,0x090d0b0a,0x06000701,0x06000600,0x00000300,0x04000200,0x06000600,0x07000600,0x0b000900,0x8f000b00,0xff92ff4b,0xffb4ffa7,0xffc8ffbf,0xffd6ffcf,0xffe2ffdc,0xffeeffe8,0xfff7fff3,0xfff3fffa,0x4902fb56,0x09020b00,0x06000703,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x0b000900,0xf52b3f00,0xffbdffa4,0xffd4ffcb,0xffe1ffdb,0xffeaffe6,0xfff1ffee,0xfff7fff5,0xfff8fff9,0xff8cfff1,0x0b018b08,0x090b0b0a,0x06000700,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x04000200,0x06000600,0x09000700,0x09000900,0xb4622800,0xff90ff79,0xffaaff9f,0xffbbffb3,0xffc9ffc2,0xffd4ffce,0xffdfffda,0xffeaffe4,0xfff3ffef,0xebf1fff7,0x0b004357,0x09010b00,0x06000701,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06010602,0x06000600,0x07000600,0x0b000900,0x3f220b00,0xffabed8f,0xffc5ffbb,
-0xffd3ffcd,0xffdbffd6,0xffe2ffdf,0xffe8ffe5,0xffecffea,0xffeeffed,0xffe5ffed,0x2a02b4c9,0x0b020b00,0x07000902,0x06000600,0x02000400,0x03000000,0x06000600,0x07000600,0x0b000900,0x7d020b00,0xff87f058,0xffaaff9c,0xffbdffb4,0xffcbffc5,0xffd8ffd2,0xffe3ffdd,0xffefffe8,0xfff8fff3,0xf0c6fff8,0x0b2b871a,0x09ff0b69,0x060007bf,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x0b000900,0x81020b00,0xffaefc70,0xffcbffbf,0xffd9ffd3,0xffe2ffdd,0xffe8ffe6,0xffefffec,0xfff3fff1,0xfff3fff3,0xfcabffed,0x0b148507,0x09090b07,0x06000702,0x06000600,0x00000300,0x04000200,0x06000600,0x08000600,0x0b000b00,0xe7340b00,0xff96ff7e,0xffb1ffa6,0xffc3ffbb,0xffd0ffc9,
-0xffdcffd6,0xffe7ffe1,0xfff2ffec,0xfffafff7,0xba37ffea,0x0b001717,0x07050904,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x09000700,0x13000b00,0xfe91bf16,0xffc2ffb3,0xffd4ffcc,0xffddffda,0xffe6ffe2,0xffedffe8,0xfff2ffef,0xfff5fff3,0xffe8fff2,0x0b02df69,0x0b000b02,0x06000800,0x06000600,0x02000400,
-0x03000000,0x06000600,0x06000600,0x09000700,0x47000b00,0xff85fb22,0xffafff9f,0xffc4ffb9,0xffd3ffcc,0xffe0ffda,0xffecffe6,0xfff6fff1,0xfff6fffa,0x9501ff95,0x0b4e0c00,0x07aa09d3,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x09000700,0x0b000b00,0xff588d00,0xffc5ffb3,0xffd9ffd1,0xffe4ffdf,0xffedffe8,0xfff3fff0,
-0xfff8fff6,0xfff7fff8,0xfb4effea,0x0b014501,0x07020903,0x06000600,0x06000600,0x00000300,0x02000000,0x06000400,0x06000600,0x09000700,0x19000b00,0xff6bd30c,0xffabff9a,0xffc2ffb8,0xffd1ffca,0xffddffd8,0xffeaffe4,0xfff3ffef,0xfffafff8,0xd424ffd1,0x0b641700,0x074009a1,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x09000700,
-0x17000b00,0xff8ad40e,0xffc8ffb9,0xffdaffd2,0xffe5ffe0,0xffedffe8,0xfff3fff1,0xfff8fff7,0xfff3fff8,0xd61cffce,0x0b1b1700,0x0710092b,0x06000600,0x04000600,0x00000200,0x03000000,0x06000600,0x06000600,0x09000700,0x0c000b00,0xff479b03,0xffb1ff9d,0xffc9ffbf,0xffd9ffd1,0xffe6ffe0,0xfff2ffec,0xfff8fff6,0xf548ffe5,0x0b015800,0x07000902,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x09000700,0x58000b00,0xffa6f532,0xffd4ffc6,0xffe4ffdd,0xffeeffe8,0xfff6fff2,0xfffbfff9,0xfff1fffa,0x9f05ff7d,0x0b070c00,0x070f0913,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x07000600,0x0b000900,0xba0f1700,0xff8fff6e,0xffadffa0,0xffbfffb7,0xffcdffc6,0xffdaffd4,0xffe5ffdf,0xfff1ffeb,0xfff9fff6,0xe374fff5,0x0b000b00,0x080a0b07,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x0b000800,0x0a000b00,0xffa7e142,0xffc9ffbc,
-0xffd8ffd2,0xffe1ffdd,0xffe8ffe5,0xffefffec,0xfff3fff1,0xfff3fff3,0xffd3ffef,0x1705bf29,0x09040b02,0x06000703,0x06000600,0x00000300,0x02000000,0x06000400,0x06000600,0x09000700,0x19000b00,0xff6bd40d,0xffa9ff98,0xffc0ffb6,0xffd0ffc9,0xffddffd6,0xffe8ffe3,0xfff3ffef,0xfffafff9,0xd421ffd4,0x0b261700,0x07a809a4,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x09000700,0x17000b00,0xff8cd410,0xffccffbd,0xffddffd6,0xffe8ffe3,0xffefffec,0xfff5fff2,0xfff9fff8,0xfff3fff8,0xd317ffcb,0x0b0c1500,0x070b0916,0x06000600,0x04000600,0x00000200,0x03000000,0x06000600,0x07000600,0x0b000900,0x8b020b00,0xff90ff4b,0xffb3ffa4,0xffc6ffbe,0xffd5ffce,
-0xffe1ffdb,0xffedffe7,0xfff7fff2,0xfff3fffb,0x4102f958,0x09010b00,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x0b000900,0xf72e4700,0xffc1ffa8,0xffd6ffce,0xffe4ffdd,0xffecffe8,0xfff3fff0,0xfff8fff6,0xfff8fff9,0xff90fff1,0x0b009102,0x09020b02,0x06000700,0x06000600,0x00000300,
-0x02000000,0x06000400,0x06000600,0x07000600,0x0b000900,0xf3244e00,0xffaaff88,0xffc5ffb9,0xffd6ffce,0xffe3ffdd,0xfff0ffea,0xfff8fff5,0xff8dfff6,0x0d009702,0x09ac0b49,0x0600077d,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x0b000900,0x9b010d00,0xffbdff5c,0xffdaffcf,0xffe8ffe2,0xfff1ffec,0xfff8fff5,
-0xfffbfffa,0xffe0fff8,0x5800f547,0x09120b0f,0x06000701,0x06000600,0x04000600,0x00000200,0x00000000,0x06000300,0x06000600,0x07000600,0x0b000900,0xcf0d2200,0xffa6ff6e,0xffc2ffb5,0xffd4ffcc,0xffe1ffdb,0xffeeffe8,0xfff7fff3,0xffc5fff7,0x2200d11a,0x0ad20b05,0x060007a0,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,
-0x0b000900,0xd3132800,0xffc3ff84,0xffdcffd2,0xffe8ffe3,0xfff1ffed,0xfff8fff5,0xfffbfffb,0xffb9fff6,0x2200d320,0x096c0b43,0x0600072c,0x06000600,0x03000600,0x00000000,0x02000000,0x06000400,0x06000600,0x07000600,0x09000800,0x6c000c00,0xff83f126,0xffc5ffb8,0xffd9ffd0,0xffe8ffe1,0xfff1ffed,0xff97ffef,0x3900d41c,0x09370b2e,0x06000702,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x07020602,0x0b010901,0xd4173b00,0xffc9ff78,0xffe3ffd9,0xfff0ffea,0xfff7fff3,0xfff7fff8,0xf13fffbf,0x0c016800,0x09090b06,0x0600070b,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x09000700,0x45000b00,0xff82fb20,0xffadff9d,0xffc3ffb9,0xffd2ffcb,0xffdfffd9,0xffebffe5,0xfff6fff1,0xfff9fffa,0x920cff9e,0x0b320b00,0x070c09b4,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x09000700,0x0b030b01,0xff5c8d01,0xffc8ffb7,
-0xffdcffd4,0xffe7ffe2,0xffefffeb,0xfff5fff2,0xfff8fff7,0xfff5fff8,0xf949ffe8,0x0b023b02,0x07030904,0x06000600,0x06000600,0x00000300,0x00000000,0x06000300,0x06000600,0x07000600,0x0b000900,0xd60e2600,0xffa3ff6c,0xffc1ffb3,0xffd2ffca,0xffe1ffda,0xffedffe7,0xfff7fff3,0xffbffff6,0x2400d820,0x095e0b2c,0x0600073c,0x06000600,0x06010600,0x06010602,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07010600,0x0b0b0904,0xd6132805,0xffc7ff8c,0xffdfffd5,0xffebffe6,0xfff3ffef,0xfff9fff7,0xfffafffb,0xffb6fff3,0x2400d31d,0x09400b2c,0x06000713,0x06000600,0x03000600,0x00000000,0x02000000,0x06000400,0x06000600,0x09000700,0x0d000b00,0xff449902,0xffafff99,0xffc8ffbd,0xffd8ffd0,
-0xffe5ffdf,0xfff1ffeb,0xfff8fff6,0xf74effe5,0x0b015000,0x07010902,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x09010700,0x54010b04,0xffacf731,0xffd6ffca,0xffe7ffe0,0xfff0ffec,0xfff7fff3,0xfffbfffa,0xfff2fffa,0xa107ff83,0x0b000f00,0x07020902,0x06000600,0x04000600,0x00000200,
-0x00000000,0x06000300,0x06000600,0x06000600,0x09000700,0x3b000b00,0xff60dc11,0xffc1ffad,0xffd5ffcc,0xffe5ffdd,0xfff0ffeb,0xffc2fff1,0x6c00f140,0x0b000c00,0x060609b3,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x09040701,0x0c1c0b0c,0xf9307605,0xffd2ff96,0xffe7ffdf,0xfff2ffed,0xfff8fff6,
-0xfff0fff9,0xd31dff93,0x0b643900,0x07170983,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x09000700,0x17000b00,0xff44a204,0xffbdff9c,0xffd3ffc9,0xffe3ffdb,0xffefffe8,0xffdbfff0,0xa00afd6e,0x0b281700,0x065c0eff,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x09010700,0x19050b04,0xff56a406,0xffd6ffb4,0xffe8ffe1,0xfff3ffee,0xfff8fff6,0xffdbfff6,0xa007fd6c,0x0b8f1500,0x076a09ef,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x07000600,0x0b000900,0x8d011b00,0xff5ce827,0xffb2ff8f,0xffb8ffc5,0xff5fff96,0x6700cb1e,0x0a640d00,0x074909a0,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06010600,0x06040602,0x060a0607,0x060f060d,0x090e070b,0x0d000a0d,0xc41a6700,0xff93ff5c,0xffd2ffbb,0xffaaffc3,0xe43aff79,0x1f008f00,0x0aed0b20,0x07000807,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x02000000,0x06000400,0x06000600,0x07000600,0x0b000900,0xf3275600,0xffa9ff87,0xffc3ffb7,0xffd4ffcd,0xffe3ffdc,0xffefffe8,0xfff8fff3,0xff82fff6,0x0c009b04,0x09b90b3e,0x06000604,0x06000600,0x06010600,0x06070603,0x06050609,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07060601,0x0b1d090d,0xa1090f22,0xffc1ff64,
-0xffddffd1,0xffeaffe4,0xfff3ffef,0xfff9fff6,0xfffbfffb,0xffddfff7,0x5200f349,0x090b0b07,0x06000703,0x06000600,0x04000600,0x00000200,0x00000000,0x04000200,0x06000600,0x06000600,0x09000700,0x15000b00,0xfd469c04,0xffbbff9b,0xffd1ffc6,0xffe2ffda,0xffeeffe8,0xffe3fff1,0x9e04fd70,0x0b261d00,0x07460cff,0x06000600,0x06000600,0x06070602,0x060c060e,0x06020605,
-0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06120605,0x094f072c,0x176b0b97,0xfd5fa217,0xffd9ffbd,0xffebffe3,0xfff3fff0,0xfff9fff8,0xffdffff7,0xa207ff6e,0x0b121d00,0x07460945,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x06000300,0x06000600,0x07000600,0x0b000900,0x6e000c00,0xff7eef29,0xffc3ffb5,0xffd8ffcf,
-0xffe6ffe0,0xfff0ffec,0xff9cffef,0x3600d41e,0x092a0b23,0x06000702,0x06000600,0x06020600,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x07120606,0x0b4e0924,0xd61b3b15,0xffcbff7e,0xffe5ffdb,0xfff1ffec,0xfff8fff5,0xfff8fff9,0xf145ffc1,0x0c036400,0x09000b0d,0x06000700,0x06000600,0x03000600,0x00000000,
-0x00000000,0x04000200,0x06000600,0x06000600,0x07000600,0x0b000900,0x5d001100,0xff48cc12,0xffa8ff80,0xffbbffc2,0xff75ffa7,0x8e01e334,0x0b352200,0x0801093c,0x06000700,0x06000600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x0722060a,0x09b90859,0x28730dff,0xe234921b,0xffa4ff6d,0xffceffbd,0xff9effc0,
-0xc524ff6e,0x11016100,0x09720b09,0x0600079f,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x07000600,0x09000800,0x45000b00,0xf73bb106,0xff9fff73,0xffbdffb4,0xff89ffb4,0xa90cf74f,0x0b0c3b00,0x09a7090d,0x0600060b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020601,0x06020602,0x06010602,
-0x070c0603,0x095b0828,0x3d190bae,0xf73cae0a,0xffadff85,0xffc6ffc5,0xff8fffb8,0xa909f94f,0x0b4b3f00,0x08be0956,0x060007e3,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x08000700,0x0b000900,0x38000c00,0x91007200,0x75009200,0x25005900,0x08770901,0x07880781,0x06000793,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06010600,0x06060603,0x0610060a,0x06210618,0x0630062b,0x074c0630,0x077507a9,0x09990800,0x5900252b,0x8f0b860c,0x6c017d04,0x0d013500,0x0eff0b37,0x063a0cff,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x04000200,0x06000600,0x06000600,0x09000700,0x39000b00,0xff60c914,0xffbdffab,0xffd4ffca,0xffe3ffdc,0xffeeffea,0xffc0ffef,0x6800ed41,0x09010c00,0x07630853,0x06000600,0x06000600,0x06060602,0x06270612,0x06290638,0x06060610,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x0630060e,0x08c5076d,0x10ff0bff,0xf143662e,
-0xffd5ffa3,0xffe8ffe1,0xfff3ffef,0xfff9fff7,0xffedfff8,0xcd1cff91,0x0b443900,0x070b0956,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x07000600,0x09000800,0x43000b00,0xf538a90b,0xff9dff71,0xffb9ffb9,0xff88ffaf,0xa614f94e,0x0b084300,0x09830909,0x0600060c,0x06000600,0x06020600,0x06190608,0x063c063c,0x060d061a,
-0x06030606,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06050601,0x06500618,0x0aff06d9,0x1eff13ff,0x3ba927ff,0xf950ad42,0xffabff82,0xffcaffc6,0xff8bffb9,0xb10bf54e,0x0b574100,0x08180964,0x0600071b,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x08000700,0x0b000900,0x89002600,0xff5ae927,0xffb0ff92,
-0xffb6ffb5,0xff5cff91,0x6400d022,0x0b1e0f00,0x07380949,0x06000600,0x06000600,0x060b0603,0x0606060c,0x06020603,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06080601,0x06680622,0x0cff07d4,0x1cff14ff,0xcc376c49,0xff99fd59,0xffc3ffb9,0xffa8ffc4,0xe63eff81,0x22008701,0x0aae0b2f,0x07000810,0x06000600,0x06000600,0x02000400,0x00000000,
-0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x08000700,0x0b000900,0x2a000b00,0x7f005b00,0x86009200,0x3d006700,0x092e0d00,0x0846092e,0x06000754,0x06000600,0x06020600,0x06020604,0x06010601,0x06010601,0x06010601,0x06020602,0x06020602,0x06010602,0x06000601,0x060a0602,0x0693062b,0x11ff09ff,0x27ff1eff,0x09210849,0x6908384b,0x92028002,0x5f008100,
-0x0c052900,0x0dff0b8e,0x0700080c,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x07000600,0x0b000900,0x15000b00,0x76004a00,0x87008f00,0x52007400,0x09021800,0x090f0902,0x06000713,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06040602,0x06060605,0x06080608,0x06060607,
-0x06410611,0x0bff06d1,0x082310ff,0x16e80800,0x73015017,0x83039006,0x48007600,0x0b581700,0x09560b56,0x06000777,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x08000700,0x09000800,0x0b000b00,0x0b000b00,0x08000a00,0x078f0702,0x0600069c,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06040602,0x060d0607,0x06240617,0x06490636,0x0669065c,0x06fa0674,0x1bff0eff,0x12ff1fff,0x1bff14ff,0x0be014ff,0x0b430b77,0x0804090d,0x064d09f8,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x07000600,0x0b000900,0x66000d00,0xff4fcd15,0xffa4ff7e,0xffb9ffb5,0xff73ffab,0x8b01e038,0x0b562100,0x07010964,0x06000600,0x06000600,0x06010600,0x06130605,0x06820637,0x06ad06d3,0x06190645,0x0603060a,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06110604,0x06a9063f,0x11ff09ff,0x29ff1cff,0x2fff30ff,
-0xeb408946,0xffa6ff72,0xffd6ffbb,0xff9fffc2,0xd11fff67,0x0f036100,0x094f0b12,0x0600076c,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x07000600,0x0b000900,0x1b000b00,0x76005100,0x90009200,0x47007500,0x0a071900,0x080a0907,0x0600070d,0x06000600,0x06000600,0x06040600,0x06370611,0x06a10698,0x0624064b,
-0x06090612,0x06020604,0x06000601,0x06000600,0x06000600,0x06000600,0x06120604,0x06d30647,0x15ff0bff,0x33ff25ff,0x36ff39ff,0x190d19ff,0x6f035208,0x83008a00,0x57007200,0x0b731b00,0x09630b72,0x0600078a,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x08000700,0x0b000900,0x42000d00,0x7f006400,
-0x84009200,0x29005a00,0x0a4e0901,0x08280953,0x0600072f,0x06000600,0x06010600,0x061d0607,0x06130623,0x0607060b,0x06030605,0x06020602,0x06010601,0x06000600,0x06000600,0x06010600,0x061d0606,0x06ff0665,0x1aff0eff,0x35ff2aff,0x084c2cff,0x5a11231a,0x90017c00,0x6c008100,0x0f024400,0x0dff0b56,0x062b0bff,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,
-0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x08000700,0x09000800,0x0b000b00,0x0a000b00,0x09000900,0x073c0700,0x06000643,0x06000600,0x06000600,0x06040600,0x06060608,0x06030604,0x06030603,0x06030603,0x06040604,0x06040604,0x06030604,0x06010602,0x061a0605,0x07ff0669,0x1eff10ff,0x3aff2eff,0x0dff1eff,0x098a0991,0x0b460a43,0x0b480b6d,
-0x08130900,0x060809ff,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x08000700,0x09000800,0x0b000b00,0x0b000b00,0x09000a00,0x07020900,0x06000703,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06040602,0x06080606,0x060e060b,0x06110611,0x060f0610,
-0x06a5062f,0x16ff0aff,0x2dff26ff,0x09ff18ff,0x0aff0cff,0x0b560ba8,0x0b240b4c,0x08750902,0x07000872,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x08000800,0x07000800,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06010600,0x06060603,0x0614060b,0x06370623,0x066d0650,0x06990687,0x09ff06c3,0x25ff15ff,0x39ff34ff,0x20ff32ff,0x08c60fff,0x08500879,0x06000710,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x08000700,0x0b000900,0x2d000c00,0x7f005300,0x80008300,0x3f006b00,0x0a1c0c00,0x0873091d,0x0600078a,0x06000600,0x06000600,0x06020600,0x0622060a,0x06f80666,0x09ff0aff,0x064306ab,0x06080618,0x06000602,0x06000600,0x06000600,0x06000600,0x06020600,0x062d060c,0x08ff0692,0x1cff10ff,0x36ff2bff,0x33ff3aff,
-0x0b8d25ff,0x6b033704,0x92007e00,0x57007a00,0x0c0e2500,0x09130b2b,0x07020818,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x08000700,0x09000800,0x0b000b00,0x0a000b00,0x0a000900,0x07090900,0x0600070a,0x06000600,0x06000600,0x06000600,0x06050601,0x06490616,0x06f806d3,0x063c0685,
-0x060f061e,0x06030607,0x06000601,0x06000600,0x06000600,0x06010600,0x06220609,0x07ff0678,0x1bff0fff,0x32ff28ff,0x2cff35ff,0x08dd0bff,0x0916096b,0x0b450a18,0x09680b92,0x08990802,0x07000897,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x08000700,0x09000800,0x0b000b00,
-0x0a000b00,0x09000a00,0x07690701,0x06000772,0x06000600,0x06000600,0x06020600,0x062c060b,0x0629063e,0x060e0616,0x06070609,0x06040605,0x06020603,0x06000601,0x06000600,0x06020600,0x063e060f,0x0bff06c0,0x25ff16ff,0x39ff33ff,0x09ff2bff,0x0ac40cff,0x0b320a2e,0x0b610b65,0x080c0919,0x063f0dff,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,
-0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x08000800,0x07010801,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x060a060a,0x06050606,0x06040604,0x06040604,0x06050605,0x06050606,0x06040605,0x06020602,0x062a060a,0x09ff069b,0x1fff12ff,0x2fff2bff,0x1cff2aff,0x08cf0fff,0x08440849,0x0860088c,
-0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x08000800,0x08010801,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020601,0x06050604,0x060c0608,0x06140610,0x06180617,0x061a0615,
-0x06ff0651,0x1cff0eff,0x34ff2bff,0x28ff35ff,0x0aff16ff,0x0854087d,0x082f085c,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06010600,0x06060603,0x0614060b,0x06350622,0x0669064d,0x06910682,0x0aff06d4,0x20ff14ff,0x29ff2aff,0x10ff1dff,0x066207ff,0x06020615,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x08000700,0x09000800,0x0b000b00,0x0a000b00,0x09000a00,0x07260700,0x06000729,0x06000600,0x06000600,0x06000600,0x06020600,0x0624060b,0x06ff0672,0x0cff0dff,0x066406ff,0x060c0624,0x06010603,0x06000600,0x06000600,0x06000600,0x06050601,0x06440614,0x0aff06c1,0x1dff12ff,0x2eff28ff,0x21ff2bff,
-0x07570fff,0x090e081a,0x0b450a18,0x0b690b9f,0x08390900,0x07000839,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x08000800,0x08000800,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x063e0611,0x06e806b3,0x06410691,
-0x060f061e,0x06030607,0x06000601,0x06000600,0x06000600,0x06020600,0x0628060b,0x06ff0679,0x15ff0dff,0x1eff1cff,0x13ff1aff,0x06b40bff,0x081b0717,0x0859081c,0x079108c3,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,
-0x08000800,0x07000800,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x0629060a,0x06350644,0x0611061c,0x0608060b,0x06040606,0x06020603,0x06000601,0x06000600,0x06040600,0x064e0616,0x0bff06df,0x1fff15ff,0x27ff28ff,0x13ff1eff,0x086e09ff,0x082f082e,0x08810882,0x06000723,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,
-0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x06090608,0x06040605,0x06030603,0x06030603,0x06040604,0x06040604,0x06030604,0x06020602,0x062a060b,0x07ff0687,0x14ff0dff,0x17ff18ff,0x0bff11ff,0x064f06e5,0x06030614,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020601,0x06050603,0x060a0607,0x0611060e,0x06140614,0x061c0612,
-0x06ff065b,0x16ff0cff,0x22ff1fff,0x13ff1cff,0x06a309ff,0x0608062b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06010600,0x06040602,0x060c0607,0x06210615,0x0640062f,0x0657064f,0x07ff0691,0x12ff0dff,0x11ff13ff,0x06fc0bff,0x06130653,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x08000800,0x07000800,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06190607,0x06ce064b,0x0aff0aff,0x065906eb,0x060a061f,0x06000603,0x06000600,0x06000600,0x06000600,0x06050601,0x063c0614,0x07ff069a,0x11ff0cff,0x15ff14ff,0x0cff10ff,
-0x067906ff,0x08100721,0x085b081d,0x088c08d3,0x06000700,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x061f0608,0x0686065c,0x0629065e,
-0x06090612,0x06020604,0x06000601,0x06000600,0x06000600,0x06020600,0x061b0608,0x06a10649,0x09ff06ff,0x0bff0bff,0x06ed08ff,0x0627066d,0x0602060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06170605,0x062b062f,0x060c0616,0x06050608,0x06030604,0x06010602,0x06000601,0x06000600,0x06040600,0x063c0613,0x07ff069b,0x10ff0cff,0x0fff11ff,0x06ff0bff,0x061d0661,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06050604,0x06020603,0x06010601,0x06010601,0x06020601,0x06020602,0x06010601,0x06010600,0x06180606,0x06990644,0x08ff06ff,0x07ff08ff,0x066306d6,0x060b0622,0x06000602,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020602,0x06050604,0x06090607,0x060a060a,0x06120609,
-0x069e063e,0x0bff07ff,0x0dff0dff,0x06ff0aff,0x061f0663,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06010600,0x06040602,0x060c0607,0x06170612,0x0620061d,0x0681063e,0x06ff06d6,0x06c606ff,0x0628066b,0x0601060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060a0602,0x0657061d,0x06e506ca,0x062d067f,0x0604060f,0x06000601,0x06000600,0x06000600,0x06000600,0x06030600,0x061d060a,0x06880646,0x06fc06cd,0x06ec06ff,0x065a06a5,
-0x060c0629,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070602,0x062f061b,0x060e0624,
-0x06030606,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06090603,0x062f0618,0x065c0647,0x06520662,0x061d0638,0x06020608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070601,0x06150614,0x0605060a,0x06020603,0x06010601,0x06000600,0x06000600,0x06000600,0x06020600,0x061a0609,0x0678063f,0x06d306b1,0x069606c9,0x06280659,0x0602060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070602,0x06270612,0x0645063e,0x062c063e,0x06090616,0x06000602,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06020602,0x06030603,0x06070603,
-0x06360617,0x06910664,0x067e069e,0x0624064d,0x0602060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06010600,0x06020601,0x06040603,0x06070606,0x061c060f,0x062e062a,0x06180626,0x0603060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06130606,0x063a062e,0x060b0623,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070602,0x061b060f,0x06280626,0x061b0624,0x06070610,
-0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06090604,0x06020607,
-0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06060603,0x060a0608,0x0606060a,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06050604,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050602,0x0615060d,0x061d061c,0x060f0616,0x06020607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06040602,0x06060606,0x06020604,0x06000601,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,
-0x06090604,0x0613060f,0x060c0613,0x06020606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06030604,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06070605,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06020602,0x06010601,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000500,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x05000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000100,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,
-0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000500,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,
-0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,
-0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x02000300,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x06000400,0x06000600,0x06000600,0x04000600,
-0x03000300,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x03000200,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x02000300,
-0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,
-0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,
-0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,
-0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,
-0x02000000,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,
-0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,
-0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,
-0x04000300,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x02000300,0x00000100,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,
-0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,0x05000600,0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06020603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06010600,0x06030602,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030602,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,
-0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06020603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06040600,0x061c060d,0x061d0627,
-0x0603060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060e0603,0x0648062f,0x06330648,0x06040613,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06160606,0x06270627,0x060b061a,0x06000602,0x06000600,0x06000600,0x06010600,0x06050603,0x06080607,0x06090608,0x06090609,0x06070608,0x06050605,0x06030603,0x06020602,0x06010602,0x06020601,0x06040602,0x060d0607,
-0x0637061b,0x06450649,0x06170632,0x06010606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06030604,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06010600,0x06130607,0x06210620,0x06060613,0x06000601,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x061c0608,0x0652063c,0x061f0641,0x0602060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,
-0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06010600,0x06170608,0x061d0624,0x0604060e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x06000400,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06160605,0x06530636,0x0627064c,0x0602060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06340608,0x07ff06b6,0x06e808ff,
-0x061a0661,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06030602,0x06070604,0x0612060b,0x061d061a,0x06050612,0x06060600,0x06a20629,0x0cff08ff,0x07ff0cff,0x06190671,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x060f0601,0x06e30649,0x07ff08ff,0x064906bb,0x06020612,0x06000600,0x06010600,0x06110607,0x06310620,0x06470640,0x064d0649,0x0644064c,0x0634063c,0x0624062c,0x0618061d,0x06110614,0x060e060f,0x0611060e,0x06230617,0x0678063e,
-0x0aff06ff,0x0bff0cff,0x069908ff,0x06060629,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06050600,0x061d0610,0x06150621,0x06010608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x060c0601,0x06440626,0x06430655,0x0606061c,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06190602,0x06e7066b,0x06ff07ff,0x062c068b,0x06000608,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x060e0601,0x06fb0651,0x0dff0aff,0x06dd0aff,0x060e0643,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06210605,0x06ff0688,0x06ff07ff,0x061e0676,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06090600,0x06c8063a,0x0cff09ff,0x06ff0bff,0x0612065a,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06070600,0x07ff0647,0x1aff10ff,0x0fff19ff,
-0x064606ff,0x0600060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06050603,0x060a0607,0x0614060f,0x06210619,0x064e0635,0x0695066c,0x07ff06ef,0x08ff09ff,0x063306c5,0x061a0605,0x0cff06a5,0x26ff1bff,0x12ff21ff,0x064907ff,0x0600060b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x0666060b,0x13ff09ff,0x18ff1cff,0x06e10dff,0x0606062f,0x06000600,0x06050600,0x06380616,0x069e0669,0x06e406c9,0x06ef06f0,0x06d206e6,0x069906b5,0x066a0680,0x06460656,0x0633063c,0x062c062d,0x0637062e,0x06750649,0x09ff06d1,
-0x1eff11ff,0x22ff24ff,0x09ff15ff,0x0611066c,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06010600,0x0642060d,0x07ff06c9,0x06ab06ff,0x060c063b,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x06000600,0x06020600,0x066b0615,0x0cff07ff,0x09ff0dff,0x063506bc,0x06000608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06010600,0x069d061a,0x15ff0bff,0x13ff1aff,0x068309ff,0x06020616,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06430607,0x12ff07ff,0x27ff20ff,0x0eff1cff,0x062406c9,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06030600,0x06d60624,0x17ff0dff,0x12ff1aff,0x066308ff,0x0601060f,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x062b0604,0x0fff06ea,0x26ff1eff,0x10ff1eff,0x063306ff,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x061b0601,0x10ff06d6,0x31ff26ff,0x18ff2fff,
-0x066009ff,0x0601060e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060602,0x0617060d,0x06350623,0x06630649,0x06af0683,0x08ff06fc,0x0fff0bff,0x1eff16ff,0x1cff22ff,0x06a10eff,0x06370610,0x15ff07ff,0x37ff2dff,0x19ff2dff,0x066609ff,0x0601060f,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06030600,0x06ff062b,0x2aff14ff,0x2bff32ff,0x07ff14ff,0x0608063f,0x06000600,0x06080600,0x06560621,0x06ef06a1,0x07ff07ff,0x08ff08ff,0x06ff07ff,0x06d806ff,0x069506b4,0x06610678,0x06470652,0x063e063f,0x06500643,0x06af066d,0x0dff07ff,
-0x31ff1aff,0x31ff38ff,0x0bff1dff,0x0616068f,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x060c0600,0x08ff065e,0x19ff11ff,0x0cff15ff,0x062306b6,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,
-0x06000400,0x06000600,0x06000600,0x06000600,0x060b0600,0x08ff0662,0x23ff15ff,0x19ff25ff,0x06960bff,0x0602061a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06070600,0x09ff0651,0x2fff1aff,0x23ff34ff,0x06c00fff,0x0603061f,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x06870611,0x1fff0cff,0x35ff31ff,0x12ff26ff,0x062f06ff,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x060e0600,0x0cff0679,0x33ff20ff,0x1eff32ff,0x068a0cff,0x06010614,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000601,
-0x06000600,0x06000600,0x06000600,0x06000600,0x065c060a,0x1aff09ff,0x36ff31ff,0x15ff29ff,0x064607ff,0x06000608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x062c0603,0x14ff06ff,0x32ff2aff,0x15ff2aff,
-0x064607ff,0x06000609,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060a0604,0x06240615,0x065a063c,0x06a5067b,0x06ff06dd,0x0cff09ff,0x1aff12ff,0x30ff25ff,0x2bff36ff,0x06df14ff,0x063c0615,0x13ff07ff,0x2dff25ff,0x12ff23ff,0x064407ff,0x0600060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06060600,0x08ff0647,0x2fff18ff,0x26ff31ff,0x06fb11ff,0x0606062e,0x06000600,0x06050600,0x06420619,0x06b9067e,0x06ff06ec,0x06ff06ff,0x06df06fa,0x069d06be,0x06690680,0x06440654,0x06310639,0x062d062c,0x063a0630,0x06830650,0x0aff06f3,
-0x26ff15ff,0x27ff2eff,0x08ff15ff,0x060f0663,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06320603,0x15ff07ff,0x31ff2bff,0x13ff28ff,0x063206ff,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06190601,0x0eff06b2,0x33ff24ff,0x22ff33ff,0x06cb0fff,0x06030622,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x060f0600,0x0cff0686,0x30ff20ff,0x1fff33ff,0x06980cff,0x06020618,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06010600,0x06810612,0x1aff0bff,0x2aff28ff,0x0dff1bff,0x062106af,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x061b0601,0x10ff06bd,0x32ff25ff,0x1aff2fff,0x066409ff,0x0601060e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x0624060c,0x06a20663,0x06b106c2,0x061f0662,
-0x06000606,0x06000600,0x06000600,0x06000600,0x065c060c,0x16ff08ff,0x2cff28ff,0x0fff1fff,0x063106ed,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06240603,0x0dff06d3,0x1cff19ff,0x0aff14ff,
-0x061a0688,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060602,0x061a060e,0x063e0629,0x06730655,0x06d2069c,0x09ff06ff,0x13ff0dff,0x23ff1aff,0x1eff26ff,0x06980eff,0x0621060d,0x09ff06a1,0x12ff10ff,0x07ff0dff,0x06160674,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06060600,0x06ff063a,0x19ff10ff,0x11ff19ff,0x066a08ff,0x06020611,0x06000600,0x06010600,0x06190609,0x064b0632,0x066d065e,0x06690670,0x06570662,0x063a0649,0x0624062e,0x0617061d,0x06100613,0x0610060f,0x06150611,0x0633061e,0x06cc0663,
-0x0fff09ff,0x0fff13ff,0x069308ff,0x06050622,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06520608,0x1bff0aff,0x36ff32ff,0x10ff24ff,0x062406db,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,
-0x06000600,0x06000600,0x06000600,0x06000600,0x061b0602,0x0cff06a9,0x29ff1dff,0x18ff28ff,0x068a0bff,0x06020616,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x060d0600,0x09ff0670,0x1eff14ff,0x0eff1aff,0x064206ff,0x06000609,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x063c060a,0x0cff06e7,0x10ff11ff,0x06e50bff,0x060c063e,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06180601,0x0bff0693,0x1dff17ff,0x0cff17ff,0x062a06cb,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x062e0609,0x09ff06a8,0x1bff11ff,0x1aff20ff,0x06980cff,
-0x06000613,0x06000600,0x06000600,0x06000600,0x062d0606,0x0aff06b8,0x12ff11ff,0x06ff0cff,0x06100659,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06100601,0x06df0654,0x08ff08ff,0x067306ff,
-0x0606061f,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06060603,0x0610060a,0x06210617,0x063b062d,0x06760651,0x06ff06b6,0x0bff08ff,0x09ff0bff,0x063406d0,0x06080603,0x06650626,0x06b806a8,0x06400685,0x06030614,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06020600,0x066a0619,0x08ff06ff,0x06d608ff,0x0615065a,0x06000603,0x06000600,0x06000600,0x06040601,0x060f0609,0x06160613,0x06150617,0x06100613,0x060a060d,0x06070608,0x06040605,0x06030603,0x06020602,0x06030603,0x06090605,0x06280612,
-0x06a20653,0x069306cb,0x061b0649,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06440607,0x12ff07ff,0x1cff1dff,0x08ff12ff,0x060e0663,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x060f0601,0x06ff0656,0x11ff0cff,0x09ff0fff,0x062d06b7,0x06000607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06050600,0x06a7062d,0x0aff07ff,0x06b908ff,0x060e0642,0x06000601,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060f0602,0x06800638,0x06a406b4,0x06280665,0x0601060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x060b0600,0x06b9063c,0x09ff08ff,0x069607ff,0x0609062e,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x0640060c,0x0dff06f3,0x2fff1eff,0x25ff33ff,0x06ab10ff,
-0x06000612,0x06000600,0x06000600,0x06000600,0x060c0601,0x0672062e,0x06b506b3,0x06320676,0x0602060e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06030600,0x0626060f,0x06410640,0x060d0626,
-0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06030602,0x06060604,0x060b0608,0x061b0612,0x06370628,0x06370642,0x0607061b,0x06010600,0x060c0604,0x06120612,0x0605060d,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06130604,0x063c0629,0x061e063a,0x0602060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06020602,0x06020602,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,
-0x06110608,0x06100616,0x06020607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x061e0604,0x07ff0689,0x09ff0aff,0x066106f8,0x06020616,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x063f0613,0x06a30679,0x06550693,0x06070621,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x0621060a,0x064c063c,0x0619063a,0x06010607,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x060c0606,0x06110611,0x0603060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06020600,0x0624060d,0x0641063f,0x0613062b,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06160604,0x06ee065a,0x0dff0bff,0x0bff0eff,0x063506ff,
-0x06000605,0x06000600,0x06000600,0x06000600,0x06010600,0x060c0605,0x06130613,0x0605060c,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06040605,0x06000602,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020601,0x06020602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06040603,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06070601,0x063f061a,0x06460658,0x060b0622,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070602,0x060f060c,0x0608060d,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x06070606,0x06010604,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06050606,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060b0603,0x0632061e,0x061f0633,0x0603060c,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06050602,0x06060607,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060b0605,0x060e060f,0x06040608,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06020600,0x06070605,0x06060606,0x0611060c,0x0608060e,0x06020603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06070603,0x0608060a,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06080604,0x06050609,0x06000601,0x06000600,0x06000600,0x06290604,0x08ff06a8,0x0bff0bff,0x06a707ff,0x061b0649,0x06010607,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06020600,0x0628060d,0x066e0656,0x063e064e,0x06db0687,0x067b06c8,0x06270642,0x060e0617,0x06050608,0x06030604,0x06020603,0x06010602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06080604,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06020602,0x06030602,0x06020603,0x06000601,
-0x06000600,0x06000600,0x06010600,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x060b0607,0x0605060a,0x06000601,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,
-0x063c0615,0x06560665,0x06060622,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06180603,0x06780648,0x0638066e,0x06020610,0x06000600,0x06000600,0x06ae0614,0x1fff0eff,0x2aff2cff,0x0eff1dff,0x066706ff,0x0606061d,0x06000601,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06020600,0x063b0610,0x06fa069e,0x06ff06ee,0x16ff0dff,0x0eff14ff,0x06f009ff,0x0657068c,0x062b0639,0x061b0622,0x06130617,0x060d0610,0x0607060a,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06170608,0x06080616,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06040602,0x060a0606,0x0614060f,0x061c0619,0x06240623,0x061b0621,0x06090612,
-0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050600,0x061c060f,0x06160622,0x06010607,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,
-0x06390612,0x06550661,0x06060623,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06180603,0x068c064e,0x064f068e,0x06040618,0x06000600,0x06010600,0x06cf0619,0x21ff10ff,0x24ff2aff,0x0cff18ff,0x065706fb,0x06060619,0x06000601,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06180603,0x06a20654,0x06e806b5,0x2cff11ff,0x21ff2cff,0x0bff13ff,0x06b906ff,0x06600680,0x063c064b,0x062d0635,0x061f0626,0x06110618,0x0605060a,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06120605,0x060e0617,0x06030607,0x06010601,0x06000600,0x06010601,0x06030602,0x06080605,0x0617060e,0x06340621,0x0669064d,0x0692067f,0x06b206ad,0x067806a2,0x060c0634,
-0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06120608,0x06120619,0x06010606,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06040601,0x06060606,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x061e060b,0x061e062a,0x0602060a,0x06000600,0x06000600,0x064b060a,0x08ff06e1,0x07ff08ff,0x066806d0,0x06120631,0x06010606,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06020600,0x06110609,0x06170611,0x17ff06ff,0x30ff33ff,0x0aff17ff,0x069906f7,0x064d0668,0x0634063c,0x0626062c,0x061a0620,0x060f0615,0x06040609,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x060c0609,0x060c060e,0x06050609,0x06020602,0x06030602,0x06080605,0x0615060d,0x06350621,0x06780651,0x06e406aa,0x07ff06ff,0x07ff08ff,0x067306e4,0x06030624,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06020603,0x06000600,0x06000600,0x06000600,0x06070600,0x0693063c,0x07ff06ee,0x06b206ff,0x0628065f,0x0603060d,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06020601,0x06010601,0x09ff0630,0x38ff1dff,0x11ff2fff,0x067409ff,0x062b0635,0x06240627,0x06220624,0x061b0620,0x060f0615,0x06020608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060a0604,0x06210616,0x06200624,0x06080613,0x06030604,0x06080605,0x0616060e,0x063a0624,0x067f0658,0x06e706ad,0x07ff06ff,0x06ee07ff,0x0615066a,0x06000601,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x08ff063b,0x16ff1aff,0x0aff10ff,0x065c06e5,0x0608061f,0x06000601,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06010602,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06420603,0x19ff08ff,0x21ff25ff,0x07ff0fff,0x06370687,0x06310630,0x06370634,0x06380639,0x0615062b,0x06010606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06090601,0x0648061e,0x06950678,0x0647067e,0x0608061d,0x06050604,0x06100609,0x062c061c,0x06610644,0x0696067b,0x069206a1,0x062b0666,0x06010609,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06ff0604,0x29ff11ff,0x0eff1dff,0x067d07ff,0x060b062a,0x06000602,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x06040603,0x06010603,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050600,0x064f061e,0x07ff06b9,0x06ff09ff,0x065506a7,0x062b0633,0x063a0631,0x063a0644,0x060b0620,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x06050603,0x06020604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070600,0x06630624,0x06a30693,0x06640693,0x0622063a,0x060b0614,0x06100609,0x0636061f,0x0684065b,0x065c0682,0x061d063b,0x0603060b,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06020603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06e0062a,0x0bff13ff,0x066e06ff,0x060a0624,0x06000602,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x06050604,0x06010604,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x06240610,0x0645063f,0x06240633,0x062f0624,0x0617062e,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x06070605,0x06020605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x06330613,0x062a063a,0x06260627,0x06230624,0x061c0620,0x06150616,0x06470624,0x06650663,0x0620064b,0x06020608,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06020604,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x069d0649,0x06460689,0x06040614,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06020600,0x06060605,0x06010604,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060e0603,0x061d061b,0x0619061b,0x0600060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,
-0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06020600,0x06080606,0x06020606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06090604,0x061b0611,0x06280623,0x0633062c,0x0611062b,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06030603,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06040602,0x06020604,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x061a0618,0x06000607,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x06060605,0x06010603,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060b0603,0x0605060e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06030600,0x06080607,0x06020605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06080602,0x062c0617,0x060d0626,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020603,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06040602,0x06020604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06000601,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06050605,0x06000602,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000600,0x06000600,0x06000600,0x06020601,0x06020602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x06070607,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06100605,0x0600060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,
-0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06030602,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060600,0x06ca06cf,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06040605,0x06000602,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06080605,0x06040607,0x06000602,0x06010600,0x06040603,0x06020604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x06060607,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06090605,0x060c060c,
-0x0608060b,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06030602,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06100600,0x07ff1fff,0x06000601,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06030604,0x06000601,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06090600,0x0616061d,0x06090606,0x060e060d,0x0605060a,0x06010601,0x060b0603,0x061b0615,0x0612061a,0x06020608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06040602,0x06040606,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x060f0605,0x062c061e,0x0632062f,
-0x062c0636,0x060b061a,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06020603,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06020602,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060f0600,0x08ff0dff,0x06000604,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06020600,0x060a0606,0x0607060a,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06020603,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x065c0603,0x06f506ff,0x06110634,0x060f0612,0x06030609,0x06030601,0x062b0610,0x0666064e,0x06440661,0x060c0623,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06040602,0x06030605,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060b0604,0x063e061e,0x0666065b,0x06960673,
-0x068e06aa,0x062b0658,0x0604060f,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x01000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x060f0608,0x060f0613,0x06030608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060600,0x06b406b1,0x06000608,0x06000600,0x06000600,
-0x06000600,0x06000600,0x060e0604,0x062e0620,0x06260632,0x06080614,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06010602,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06ff060d,0x14ff15ff,0x061906e6,0x060a060f,0x06010604,0x060f0603,0x06790632,0x06ff06d0,0x06ab06f3,0x0627065c,0x0602060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06040602,0x06020604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06100607,0x060d0612,0x062f0614,0x06850658,0x06aa069b,0x07ff06f3,
-0x07ff08ff,0x066506c6,0x060b0628,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06010600,0x06040603,0x06020604,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x04000200,0x06000500,0x06000600,0x06000600,0x06000600,0x06000600,0x060f0604,0x063e0624,0x063e0649,0x06120627,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x0635062d,0x06000608,0x06000600,0x06000600,
-0x06000600,0x06040600,0x06320612,0x06900665,0x06790699,0x06200648,0x0602060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06010602,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x0aff0621,0x2aff27ff,0x06290aff,0x06040609,0x06010601,0x062c060a,0x06ff0681,0x0bff09ff,0x07ff0aff,0x064f06b2,0x0606061b,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x06040603,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060b0601,0x06760632,0x0656068e,0x0667063b,0x06b00698,0x06ff06b9,0x0dff0aff,
-0x0bff0dff,0x06aa07ff,0x06150644,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,
-0x06000600,0x060a0603,0x061b0615,0x060f0618,0x06020607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x063e0617,0x06bf067e,0x06b106d6,0x0636066e,0x06050613,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x0610060c,0x06000604,0x06000600,0x06000600,
-0x06000600,0x06120603,0x0698063f,0x07ff06ff,0x06ff07ff,0x064906a0,0x0607061a,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06000601,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x0cff062d,0x31ff2cff,0x06400eff,0x06010603,0x06060601,0x06720622,0x0cff06ff,0x11ff10ff,0x0aff0fff,0x067906ff,0x060b062b,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x06040603,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06310605,0x0aff06c8,0x09ff0dff,0x069106a3,0x06a306a7,0x0aff06e8,0x14ff10ff,
-0x0fff14ff,0x06eb0aff,0x061f065c,0x06010608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06050600,0x06310613,0x06690654,0x063c065f,0x060a061d,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06160604,0x06c20653,0x0aff07ff,0x08ff0aff,0x067506f2,0x060d062c,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040603,0x06000601,0x06000600,0x06000600,
-0x06020600,0x0637060d,0x08ff06a5,0x0eff0cff,0x0aff0dff,0x068006ff,0x060e0630,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06020602,0x06000601,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x09ff0621,0x26ff20ff,0x06370cff,0x06000600,0x06160603,0x06ff065c,0x13ff0cff,0x19ff18ff,0x0dff14ff,0x069b07ff,0x06100638,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x03000600,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06020600,0x06050604,0x06010603,0x06010600,0x06020601,0x06010602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06790610,0x19ff0bff,0x15ff1fff,0x068307ff,0x06af067c,0x10ff08ff,0x1bff18ff,
-0x13ff1aff,0x06ff0cff,0x06240672,0x0602060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,
-0x061c0607,0x06ae0653,0x06ff06ff,0x06aa06ff,0x061f0654,0x06010608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x064f0615,0x0aff06dc,0x12ff0fff,0x0dff11ff,0x06c809ff,0x06190650,0x06010606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000600,0x06000600,0x06000600,
-0x060a0601,0x069b062e,0x0eff08ff,0x16ff14ff,0x0eff14ff,0x06bc08ff,0x06150647,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06010600,0x06020602,0x06000601,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06cd060f,0x10ff10ff,0x061606ff,0x06010600,0x063e060c,0x0aff06d0,0x1dff13ff,0x20ff22ff,0x10ff19ff,0x06b009ff,0x06130642,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x04000600,0x00000200,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x06060607,0x06020603,0x06060603,0x06090608,0x06060608,0x06020604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06d4061e,0x2aff11ff,0x20ff31ff,0x065009ff,0x06ff066c,0x18ff0eff,0x23ff20ff,
-0x16ff1fff,0x07ff0dff,0x0628067d,0x0602060b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06070600,
-0x066e0622,0x0aff06ff,0x0eff0dff,0x08ff0bff,0x064906b8,0x06040616,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06110602,0x06dc0649,0x13ff0aff,0x1dff1bff,0x13ff1aff,0x06ff0cff,0x06240672,0x0602060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06230606,0x08ff0681,0x18ff0fff,0x1fff1fff,0x12ff1aff,0x06e30aff,0x061b0657,0x06010607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06040604,0x06000602,0x06000600,0x06010601,0x06020602,
-0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06420604,0x06eb06db,0x06050652,0x06060600,0x068d0624,0x12ff08ff,0x28ff1eff,0x26ff2bff,0x11ff1cff,0x06b909ff,0x06140642,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x00000300,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06080603,0x0609060b,0x060b0607,0x061b0612,0x06210621,0x0614061c,0x0606060b,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x06ff0626,0x2eff14ff,0x1cff36ff,0x064207ff,0x0aff06b5,0x21ff15ff,0x2bff2aff,
-0x19ff23ff,0x07ff0eff,0x062a0680,0x0602060b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06200606,
-0x07ff0679,0x15ff0dff,0x19ff19ff,0x0cff13ff,0x067e07ff,0x060a0628,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x063a060a,0x0aff06c4,0x20ff14ff,0x29ff29ff,0x18ff22ff,0x07ff0eff,0x062d0686,0x0603060d,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,
-0x06640617,0x0fff07ff,0x25ff1aff,0x28ff2aff,0x14ff1fff,0x06fa0bff,0x061e065f,0x06020609,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06060602,0x06070609,0x06010603,0x06030602,0x06080606,0x06090609,
-0x06040607,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06090600,0x061e061f,0x0603060a,0x06140604,0x06ff065a,0x1bff0eff,0x33ff29ff,0x2bff33ff,0x12ff1eff,0x06b609ff,0x0613063e,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x00000300,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06020600,0x0615060a,0x06160618,0x0632061f,0x06570645,0x065c0661,0x0635064b,0x060f061f,0x06020607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06ca061d,0x1dff0fff,0x0cff1cff,0x067e06c9,0x10ff07ff,0x2cff1eff,0x31ff33ff,
-0x1aff27ff,0x07ff0fff,0x06290682,0x0602060b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x06640617,
-0x0fff07ff,0x23ff19ff,0x24ff27ff,0x11ff1bff,0x06b409ff,0x0611063e,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050600,0x068b0621,0x12ff09ff,0x2eff21ff,0x33ff35ff,0x1bff29ff,0x08ff0fff,0x0633068e,0x0604060f,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060c0601,
-0x06db063c,0x18ff0cff,0x31ff26ff,0x2eff35ff,0x16ff22ff,0x06ff0cff,0x061f0661,0x06020609,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06010600,0x06130609,0x265b0616,0x9e646963,0xaa65ad65,0x67639664,0x061e2a5e,
-0x060f0617,0x06040609,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06090606,0x062a060b,0x0aff06a6,0x24ff15ff,0x3bff33ff,0x2dff38ff,0x12ff1eff,0x06b109ff,0x0613063c,0x06010604,0x305c0600,0x94646562,0xad65ad65,0x67629c64,0x06002057,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x00000300,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x060a0601,0x06400623,0x5864145b,0xaa659265,0x9c66b166,0x426b7f67,0x067c0990,0x0627064b,0x06060611,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x064c060a,0x09ff06ff,0x07ff09ff,0x06f306ff,0x17ff0bff,0x35ff27ff,0x35ff3aff,
-0x1bff29ff,0x07ff0fff,0x06290680,0x0603060b,0x09260600,0x7d634a60,0xb165a064,0x8864aa64,0x18515461,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060a0601,0x06d90638,
-0x19ff0cff,0x32ff28ff,0x2dff34ff,0x14ff21ff,0x06dc0bff,0x0617064f,0x06010606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06010600,0x06020602,0x5a621047,0xad658c64,0xa464b165,0x42607963,0x06000926,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060b0601,0x06dc063c,0x19ff0cff,0x37ff29ff,0x37ff3cff,0x1cff2bff,0x08ff10ff,0x0634068f,0x06040610,0x07100601,0x7963405f,0xad65a064,0x8c64a864,0x164f5b62,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x06080605,0x3e5f092a,0xa4647763,0xac64b165,0x52618a64,0x0602144d,0x06020603,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x061b0604,
-0x07ff066e,0x20ff12ff,0x3aff30ff,0x31ff3bff,0x16ff23ff,0x06f70cff,0x061f065c,0x06020609,0x164f0600,0x83645862,0xb165a864,0x77639864,0x0a334460,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x060b0601,0x4d630626,0xfd65bf65,0xff66ff66,0xff69ff67,0xff6cff6b,0xbf68fd69,
-0x07334463,0x060d061a,0x06020606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060c0606,0x06410613,0x0cff06e5,0x29ff19ff,0x3cff37ff,0x2cff38ff,0x11ff1dff,0x06a408ff,0x0612063b,0x45600605,0xff65c165,0xff66ff66,0xff69ff67,0xff68ff69,0xbb65fb66,0x06004960,0x06000600,0x06000600,0x06000600,
-0x06000600,0x02000400,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06330609,0x9e662467,0xff66f366,0xff66ff66,0xff6aff68,0xff6cff6c,0x6f69e369,0x06550a80,0x060f0628,0x06010605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060c0601,0x06460622,0x07ff06ac,0x08ff07ff,0x1dff0eff,0x39ff2dff,0x36ff3dff,
-0x1aff29ff,0x07ff0eff,0x0629067e,0x0c3c060b,0xe7656b63,0xff66ff66,0xff66ff66,0xff68ff68,0xf766ff67,0x285a9a64,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x24590600,0x96646b63,0xaf64af64,0x65629664,0x06002a5a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06110602,0x07ff0658,
-0x1fff10ff,0x3bff2fff,0x32ff3bff,0x15ff23ff,0x06ee0bff,0x061d065a,0x06020608,0x2e5b0600,0x96646b62,0xad64b164,0x65629264,0x06002a5a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x9664265a,0xff66f565,0xff66ff66,0xff6bff68,0xff6dff6d,0x7164d469,0x06010c3b,
-0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060c0601,0x06dd063e,0x19ff0cff,0x35ff29ff,0x34ff39ff,0x1aff27ff,0x07ff0fff,0x0632068a,0x0c3c0610,0xdd656f63,0xff66ff66,0xff68ff66,0xff69ff69,0xf566ff68,0x22589a64,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06070601,0x6f630a3b,0xff66e365,0xff66ff66,0xff6aff67,0xff6dff6c,0x9e67f769,0x06092259,0x06040606,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06240607,
-0x09ff068e,0x23ff14ff,0x3bff32ff,0x2fff39ff,0x14ff21ff,0x06e80bff,0x061e0658,0x22580609,0xf1659264,0xff66ff66,0xff68ff67,0xff68ff69,0xe165ff66,0x0e417363,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x0a460608,0xfd659a65,0xff66ff66,0xff6cff68,0xff76ff71,0xff7fff7b,0xff7fff80,
-0xa372ff79,0x06240a56,0x06070612,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06080603,0x06420612,0x0cff06dc,0x26ff18ff,0x35ff31ff,0x26ff30ff,0x0fff1aff,0x068f07ff,0x0c420636,0xff659e64,0xff69ff66,0xff70ff6d,0xff77ff75,0xff78ff78,0xff70ff75,0x9665ff6a,0x06000a33,0x06000600,0x06000600,
-0x06000600,0x03000600,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06040600,0x60660633,0xff66ef66,0xff67ff66,0xff6eff6b,0xff79ff74,0xff7eff7c,0xff7bff7f,0x2c72c874,0x06220653,0x0604060d,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06170603,0x06db065f,0x08ff06ff,0x1cff0fff,0x36ff2bff,0x31ff38ff,
-0x17ff25ff,0x06ff0dff,0x06270673,0xd4652a5c,0xff66ff66,0xff6eff6a,0xff75ff71,0xff79ff77,0xff74ff77,0xf368ff6e,0x06005c62,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x395e0602,0xfd65c565,0xff66ff66,0xff6aff67,0xff6dff6c,0xbf69ff6a,0x06004360,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060e0602,0x06ff064d,
-0x1cff0eff,0x35ff2cff,0x2eff36ff,0x14ff21ff,0x06ea0bff,0x0622065e,0x435f060a,0xfd65c765,0xff66ff66,0xff69ff67,0xff68ff69,0xc165ff66,0x06004560,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06010600,0x5c620606,0xff66f365,0xff67ff66,0xff6eff6b,0xff79ff75,0xff81ff7e,0xff7eff82,0x2e65ce75,
-0x06050607,0x06010603,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x060c0605,0x06860624,0x12ff08ff,0x28ff1dff,0x28ff2bff,0x15ff1fff,0x06ff0cff,0x0630067c,0xd0652c5c,0xff67ff66,0xff6eff6c,0xff77ff73,0xff78ff79,0xff74ff78,0xf568ff70,0x06005b62,0x06000600,
-0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x285c0609,0xff66cc65,0xff66ff66,0xff6eff6a,0xff79ff73,0xff7fff7d,0xff7fff80,0x596df177,0x060e0617,0x06030607,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x061d0605,
-0x08ff0671,0x1dff10ff,0x2fff2aff,0x27ff2fff,0x11ff1cff,0x06c809ff,0x061c064f,0xf1655b62,0xff68ff66,0xff70ff6d,0xff76ff73,0xff78ff79,0xff72ff77,0xd266ff6e,0x06002e5c,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x02000000,0x06000400,0x06000600,0x06000600,0x06030600,0xba651251,0xff66ff66,0xff6bff67,0xff79ff72,0xff87ff81,0xff90ff8c,0xff93ff93,
-0xff90ff93,0x0c68c283,0x0613062c,0x06020607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060c0605,0x06150613,0x0640061b,0x08ff069c,0x19ff0fff,0x25ff21ff,0x1bff22ff,0x0bff13ff,0x067906ff,0xbc651054,0xff69ff66,0xff77ff70,0xff84ff7f,0xff8bff88,0xff8dff8d,0xff89ff8c,0xff77ff82,0x0c3bbe69,0x06000600,0x06000600,
-0x06000600,0x04000600,0x00000200,0x03000000,0x06000600,0x06000600,0x06000600,0x06120601,0xff666e65,0xff66ff66,0xff70ff69,0xff7fff78,0xff8bff85,0xff92ff8e,0xff93ff93,0xeb86ff91,0x0643327f,0x0608061a,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06100605,0x066c062f,0x06ff06ae,0x15ff0bff,0x29ff1fff,0x25ff2aff,
-0x12ff1cff,0x06ef0aff,0x32600662,0xff67eb65,0xff71ff6b,0xff7fff79,0xff88ff84,0xff8cff8b,0xff8bff8d,0xff7eff87,0x6e65ff71,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x0a340601,0xff659a64,0xff66ff66,0xff6cff68,0xff78ff72,0xff7fff7c,0xff81ff81,0xa272ff7b,0x06011048,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06060603,0x0614060a,0x06890630,
-0x11ff08ff,0x24ff1bff,0x22ff26ff,0x10ff1aff,0x06d409ff,0x0c49065a,0xff659464,0xff6aff67,0xff72ff6e,0xff79ff76,0xff79ff79,0xff70ff75,0x9e65ff6a,0x06000a33,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06070600,0xff657263,0xff66ff66,0xff70ff69,0xff80ff78,0xff8cff87,0xff93ff90,0xff96ff96,0xe789ff93,
-0x06163278,0x0608060e,0x06020604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040603,0x06080604,0x06260613,0x0658063c,0x06b00678,0x0aff06ff,0x14ff0fff,0x18ff18ff,0x0eff14ff,0x06db09ff,0x33600668,0xff67eb65,0xff73ff6c,0xff83ff7c,0xff8bff87,0xff8dff8d,0xff8bff8d,0xff7fff87,0x7264fd71,0x06000600,
-0x06000600,0x06000600,0x06000600,0x00000300,0x02000000,0x06000400,0x06000600,0x06000600,0x06060600,0xed65305f,0xff66ff66,0xff6eff68,0xff7dff76,0xff89ff83,0xff92ff8e,0xff95ff93,0xff8cff95,0x062e6e80,0x060d061a,0x06020605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x060b0609,0x0613060b,0x06430626,
-0x06ff0683,0x10ff09ff,0x1dff17ff,0x1aff1eff,0x0dff13ff,0x069d07ff,0x6e630643,0xff68fd65,0xff75ff6d,0xff83ff7d,0xff8bff88,0xff8eff8d,0xff8aff8d,0xff79ff85,0x375eed6d,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06090600,0xff66a465,0xff68ff66,0xff77ff6e,0xff88ff80,0xff93ff8e,0xff9dff99,0xffa3ffa1,
-0xffa5ffa5,0xa292ffa0,0x06270656,0x0605060f,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060c0602,0x066b062b,0x06a906a4,0x06ff06b4,0x0bff08ff,0x13ff0fff,0x17ff16ff,0x10ff14ff,0x07ff0bff,0x065b06bd,0xff679a65,0xff76ff6c,0xff89ff81,0xff93ff8f,0xff9bff98,0xff9dff9c,0xff9bff9d,0xff90ff97,0x9e6cff82,0x06000600,0x06000600,
-0x06000600,0x06000600,0x00000300,0x04000200,0x06000600,0x06000600,0x06000600,0x51620603,0xff66fd65,0xff6bff67,0xff7eff74,0xff8cff86,0xff98ff92,0xffa0ff9c,0xffa4ffa3,0xffa1ffa5,0x1884d996,0x060e0629,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060e0604,0x06540624,0x06ec06a2,0x08ff06ff,0x11ff0bff,0x19ff16ff,0x16ff1aff,
-0x0cff11ff,0x06ab07ff,0xdd651660,0xff6eff68,0xff83ff79,0xff90ff8a,0xff97ff93,0xff9cff9a,0xff9cff9d,0xff96ff9a,0xfd7bff8d,0x06004f66,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0xbc650e43,0xff66ff66,0xff6bff67,0xff7bff73,0xff89ff82,0xff92ff8e,0xff97ff95,0xff92ff95,0x1058c083,0x06080609,0x06030606,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030602,0x060b0606,0x06240616,0x065c063c,0x06960674,0x06da06bf,
-0x08ff06ff,0x10ff0cff,0x13ff14ff,0x0bff10ff,0x06ae07ff,0xba65125f,0xff6aff65,0xff79ff71,0xff86ff81,0xff8cff8a,0xff8eff8e,0xff89ff8c,0xff75ff82,0x0c3bbc68,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x04000200,0x06000600,0x06000600,0x06000600,0x49610603,0xff66fd65,0xff6cff67,0xff7eff74,0xff8dff86,0xff98ff93,0xffa1ff9d,0xffa6ffa4,0xffa4ffa7,
-0x167ddf97,0x061c0631,0x0607060f,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060d0600,0x0645062b,0x0663064b,0x06ff06af,0x0aff08ff,0x0eff0dff,0x0fff0fff,0x0dff0eff,0x0cff0eff,0x08ff0aff,0x068d06ef,0xe1651c60,0xff70ff69,0xff86ff7c,0xff93ff8d,0xff9aff96,0xff9dff9c,0xff9dff9e,0xff95ff9a,0xfd79ff8c,0x06004f65,
-0x06000600,0x06000600,0x06000600,0x02000400,0x03000000,0x06000600,0x06000600,0x06000600,0x14510601,0xff66e565,0xff69ff66,0xff7bff71,0xff8aff83,0xff96ff91,0xff9fff9b,0xffa5ffa2,0xffa4ffa6,0x578bfb9c,0x06210644,0x0606060f,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x062d060c,0x06730663,0x06a5066c,0x08ff06ff,
-0x0dff0bff,0x10ff0eff,0x12ff11ff,0x0eff11ff,0x08ff0bff,0x066d06d0,0xfd654f63,0xff73ff6a,0xff87ff7f,0xff93ff8e,0xff9aff97,0xff9dff9c,0xff9cff9d,0xff93ff99,0xe573ff89,0x06001853,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x47600600,0xff66ff65,0xff6eff68,0xff83ff79,0xff93ff8c,0xff9eff99,0xffa8ffa3,0xffafffac,
-0xffb3ffb2,0xffaaffb2,0x063f4897,0x060a061a,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x0639060c,0x09ff06b9,0x0fff0fff,0x13ff0fff,0x1eff19ff,0x20ff21ff,0x17ff1dff,0x0cff11ff,0x06db08ff,0x4b630677,0xff6dff66,0xff87ff7b,0xff96ff8f,0xffa0ff9c,0xffa6ffa4,0xffa9ffa8,0xffa9ffaa,0xffa3ffa7,0xff87ff9b,0x0600476a,0x06000600,
-0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0xdf650d3b,0xff67ff66,0xff77ff6d,0xff89ff81,0xff97ff91,0xffa2ff9c,0xffaaffa6,0xffb0ffae,0xffb2ffb2,0x959effae,0x0617072f,0x06020608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x06380610,0x07ff068e,0x12ff0cff,0x13ff14ff,0x1eff1aff,0x1eff1fff,0x13ff19ff,
-0x09ff0dff,0x075f06e7,0xff689664,0xff7eff70,0xff91ff88,0xff9dff97,0xffa4ffa1,0xffa8ffa6,0xffa9ffa9,0xffa6ffa9,0xff96ffa1,0x114bdb80,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06040600,0xff669e64,0xff68ff66,0xff78ff6e,0xff89ff81,0xff95ff8f,0xff9eff9a,0xffa5ffa2,0xffa6ffa7,0x9a93ffa2,0x0622062b,0x060e0617,0x06030607,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060c0600,0x063c0627,0x06920659,0x07ff06dd,0x0bff09ff,0x0eff0cff,0x0fff0fff,
-0x0cff0eff,0x0aff0bff,0x09ff0aff,0x06ff08ff,0x067606bf,0xff679c64,0xff79ff6e,0xff8bff83,0xff96ff91,0xff9cff99,0xff9eff9e,0xff9bff9d,0xff90ff97,0x9e6cff81,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0xdf650f42,0xff66ff66,0xff77ff6c,0xff89ff81,0xff97ff91,0xffa2ff9d,0xffabffa7,0xffb2ffaf,0xffb4ffb4,
-0x96a0ffaf,0x0637074c,0x060d061d,0x06020605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06510605,0x09ff06ff,0x0bff09ff,0x14ff10ff,0x1eff1aff,0x22ff22ff,0x1dff21ff,0x13ff18ff,0x0aff0eff,0x06c307ff,0x073e067e,0xff699a64,0xff82ff72,0xff93ff8d,0xff9fff9a,0xffa6ffa3,0xffaaffa8,0xffabffab,0xffa6ffa9,0xff95ffa0,0x0d3ce57c,
-0x06000600,0x06000600,0x06000600,0x03000600,0x04000200,0x06000600,0x06000600,0x06000600,0x9a640702,0xff66ff66,0xff73ff69,0xff87ff7e,0xff95ff8e,0xffa0ff9b,0xffa9ffa5,0xffb0ffad,0xffb4ffb3,0xe1a5ffb1,0x063c0d80,0x060b061c,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070600,0x06f00642,0x0bff0aff,0x0fff0aff,0x19ff13ff,
-0x22ff1fff,0x1fff21ff,0x15ff1aff,0x0bff0fff,0x06cf07ff,0x0f560679,0xff6ae165,0xff85ff77,0xff95ff8e,0xffa0ff9b,0xffa6ffa3,0xffaaffa9,0xffaaffaa,0xffa5ffa8,0xff8fff9e,0x07008f76,0x06000600,0x06000600,0x06000600,0x02000400,0x03000000,0x06000600,0x06000600,0x06000600,0xb8640700,0xff67ff66,0xff79ff6e,0xff8eff85,0xff9cff95,0xffa7ffa2,0xffb1ffac,0xffb9ffb5,
-0xffbeffbc,0xffbcffbf,0x073cb1ad,0x060d0621,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x0688061c,0x16ff0aff,0x24ff24ff,0x2aff21ff,0x34ff32ff,0x2dff33ff,0x1bff25ff,0x0cff12ff,0x06aa07ff,0xb8640742,0xff7bff6c,0xff93ff8a,0xffa2ff9b,0xffaaffa7,0xffb1ffae,0xffb4ffb3,0xffb5ffb5,0xffb1ffb4,0xffa0ffac,0x0700b785,0x06000600,
-0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x07000600,0xff666160,0xff6bff66,0xff82ff76,0xff92ff8a,0xff9fff99,0xffaaffa5,0xffb3ffaf,0xffb9ffb7,0xffbfffbd,0xf9b3ffbd,0x061f1f8c,0x0603060b,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06080601,0x06720622,0x0eff07ff,0x28ff1bff,0x2aff2aff,0x33ff32ff,0x29ff31ff,0x16ff20ff,
-0x08ff0eff,0x145806c3,0xff6ef366,0xff8cff80,0xff9dff96,0xffa7ffa3,0xffaeffab,0xffb3ffb1,0xffb4ffb4,0xffb3ffb4,0xffa9ffb0,0x6b79ff99,0x06000700,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x45600601,0xff66ff65,0xff70ff68,0xff84ff79,0xff93ff8c,0xff9fff99,0xffa8ffa4,0xffb0ffac,0xffb5ffb3,0xffacffb4,0x0647409a,0x061a062e,0x0606060d,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06520605,0x09ff06ff,0x0fff0bff,0x17ff12ff,0x20ff1cff,0x22ff22ff,0x1eff21ff,
-0x15ff1aff,0x0dff11ff,0x06ff09ff,0x068a06c8,0x47620661,0xff6eff66,0xff8aff7e,0xff99ff93,0xffa3ff9e,0xffa8ffa6,0xffaaffaa,0xffaaffab,0xffa2ffa7,0xfb85ff99,0x06004969,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x07000600,0xff666a62,0xff6bff66,0xff81ff76,0xff92ff8a,0xffa0ff9a,0xffabffa6,0xffb4ffb0,0xffbcffb8,0xffc1ffbf,
-0xf9b4ffc0,0x063c1e93,0x06100621,0x06030607,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06e30613,0x1cff12ff,0x1fff1aff,0x2eff27ff,0x35ff34ff,0x31ff34ff,0x23ff2aff,0x13ff1bff,0x09ff0dff,0x069106fb,0x1c550651,0xff71f765,0xff90ff83,0xffa0ff99,0xffaaffa5,0xffb0ffae,0xffb4ffb2,0xffb6ffb6,0xffb3ffb5,0xffa8ffaf,0x6677ff98,
-0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x06000600,0xf7651c4e,0xff68ff66,0xff7eff72,0xff90ff88,0xff9eff97,0xffa9ffa4,0xffb2ffae,0xffb9ffb6,0xffbfffbd,0xffb9ffbf,0x07386ba6,0x060f0621,0x06020606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06170601,0x0dff06ab,0x1fff1eff,0x22ff1aff,0x33ff2cff,
-0x34ff35ff,0x28ff30ff,0x17ff20ff,0x0aff10ff,0x069706ff,0x6761073e,0xff77ff69,0xff93ff87,0xffa1ff9b,0xffaaffa6,0xffb0ffae,0xffb4ffb3,0xffb5ffb5,0xffb2ffb4,0xffa4ffae,0x1c5bf98d,0x06000600,0x06000600,0x06000600,0x03000600,0x04000200,0x06000600,0x06000600,0x06000600,0xfb651d4b,0xff6bff66,0xff84ff78,0xff96ff8e,0xff93ff9d,0xff60ff5a,0xffb8ffa2,0xffc0ffbd,
-0xffc8ffc4,0xffcaffca,0x1b85f7bf,0x060b061c,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x06be0626,0x21ff0eff,0x33ff33ff,0x37ff2fff,0x39ff3bff,0x29ff32ff,0x15ff1fff,0x08ff0dff,0x065b06c2,0xfb671344,0xff8aff78,0xff9fff96,0xffacffa6,0xff9dffb0,0xff64ff61,0xffbdffa7,0xffbfffbe,0xffbcffbe,0xffb1ffb9,0x1958f99a,0x06000600,
-0x06000600,0x06000600,0x02000400,0x06000300,0x06000600,0x06000600,0x08000600,0xff66be64,0xff74ff69,0xff8bff80,0xff9aff93,0xff6bff9d,0xff89ff52,0xffbbffb6,0xffc3ffbf,0xffc9ffc6,0xffc5ffca,0x07166bac,0x0603060a,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x060a0601,0x068e062b,0x13ff09ff,0x34ff24ff,0x38ff38ff,0x38ff3bff,0x26ff31ff,0x11ff1bff,
-0x06f80aff,0x6561075c,0xff7dff6c,0xff98ff8d,0xffa7ffa0,0xffb0ffac,0xff5eff8c,0xffb8ff70,0xffbeffbd,0xffbeffbf,0xffb7ffbc,0xb392ffac,0x06000800,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0xbc640601,0xff67ff66,0xff79ff6e,0xff8dff85,0xff9cff95,0xffa7ffa2,0xffb1ffac,0xffb9ffb5,0xffc0ffbd,0xffbdffc1,0x073ebcae,0x061c0631,0x0607060f,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07ff0613,0x1cff15ff,0x27ff21ff,0x32ff2dff,0x35ff34ff,0x30ff33ff,0x24ff2bff,
-0x16ff1dff,0x0bff10ff,0x06e808ff,0x06540691,0xb5630728,0xff80ff6d,0xff97ff8d,0xffa5ff9f,0xffadffa9,0xffb2ffb0,0xffb5ffb4,0xffb6ffb6,0xffb1ffb4,0xff9fffab,0x0600bc82,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x07000600,0xff66b064,0xff73ff68,0xff8aff80,0xff9bff93,0xff6eff9e,0xff84ff51,0xffbcffb7,0xffc4ffc0,0xffcbffc8,
-0xffc7ffcc,0x072260ae,0x060c0618,0x06020605,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x08ff061e,0x2eff21ff,0x32ff2dff,0x3aff37ff,0x38ff3bff,0x2cff33ff,0x1aff22ff,0x0dff12ff,0x06dd08ff,0x0644067f,0x645f071c,0xff81ff6d,0xff9cff90,0xffaaffa3,0xffb3ffaf,0xff58ff8b,0xffb8ff71,0xffbfffbf,0xffbeffbf,0xffb6ffbb,0xb68effab,
-0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x07000600,0xff666b61,0xff6eff67,0xff87ff7c,0xff98ff90,0xff7eff9f,0xff69ff52,0xffb9ffaf,0xffc2ffbe,0xffc9ffc6,0xffc8ffcb,0x0823b9b9,0x060c061a,0x06020605,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06230601,0x16ff06ff,0x33ff31ff,0x33ff2bff,0x3bff38ff,
-0x33ff39ff,0x22ff2bff,0x10ff18ff,0x06ff0aff,0x06490695,0xbb640817,0xff86ff71,0xff9eff93,0xffabffa5,0xffafffaf,0xff5fff70,0xffbdff90,0xffbfffbf,0xffbeffbf,0xffb3ffb9,0x6082ffa4,0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x07000600,0xff66475c,0xff73ff68,0xff8cff81,0xff9dff95,0xff14ff91,0xff09ff08,0xffacff1b,0xffc8ffc4,
-0xffd0ffcc,0xffd4ffd3,0x43aaffce,0x0606070c,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x06a50620,0x1eff0cff,0x31ff32ff,0x30ff2dff,0x29ff2eff,0x18ff20ff,0x0bff11ff,0x069806ff,0x061f0649,0xff6c4a5c,0xff95ff84,0xffa8ffa0,0xffb4ffaf,0xff15ffab,0xff0aff09,0xffb4ff17,0xffc8ffc7,0xffc7ffc8,0xffbdffc4,0x4885ffad,0x06000600,
-0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff66ea65,0xff7dff6e,0xff92ff88,0xffa2ff9b,0xff08ff37,0xff0aff09,0xffc2ff7d,0xffcbffc6,0xffd2ffcf,0xffd1ffd4,0x080b98be,0x06020606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070601,0x06730621,0x11ff07ff,0x30ff20ff,0x31ff33ff,0x2aff30ff,0x17ff20ff,0x09ff0fff,
-0x066b06db,0x9663081d,0xff89ff73,0xffa2ff97,0xffafffaa,0xff7bffb4,0xff09ff09,0xff44ff0a,0xffc7ffc6,0xffc7ffc8,0xffc3ffc6,0xe7a3ffb9,0x06000800,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x04000200,0x06000600,0x06000600,0x06000600,0xfb651a4b,0xff6bff66,0xff84ff77,0xff96ff8e,0xff96ff9d,0xff5aff5e,0xffb9ff9b,0xffc1ffbd,0xffc9ffc5,0xffcbffcc,0x177efbc1,0x0612061f,0x0605060a,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x0aff0622,0x35ff2bff,0x39ff37ff,0x3bff3aff,0x35ff39ff,0x29ff2fff,0x1aff22ff,
-0x0eff13ff,0x06ff0aff,0x066906ae,0x0620063e,0xf9671542,0xff8eff7b,0xffa2ff9a,0xffafffa9,0xffa1ffb3,0xff65ff5f,0xffbfffa9,0xffc0ffbf,0xffbcffbe,0xffafffb8,0x1a5bfd97,0x06000600,0x06000600,0x06000600,0x02000400,0x06000300,0x06000600,0x06000600,0x07000600,0xff66e865,0xff7cff6d,0xff92ff88,0xffa2ff9b,0xff08ff3c,0xff0aff09,0xffc2ff7d,0xffcbffc7,0xffd3ffd0,
-0xffd2ffd6,0x080c96c0,0x0605060a,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x08ff061b,0x31ff22ff,0x30ff2fff,0x2eff2fff,0x23ff29ff,0x16ff1dff,0x0cff11ff,0x06e808ff,0x06480685,0x06130626,0x9a630805,0xff8dff77,0xffa6ff9b,0xffb3ffad,0xff79ffb8,0xff09ff09,0xff48ff0a,0xffc8ffc7,0xffc8ffc8,0xffc2ffc6,0xdfa1ffb9,
-0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff669863,0xff77ff6a,0xff8fff84,0xff9fff98,0xff08ff71,0xff0aff09,0xffc1ff47,0xffcaffc5,0xffd1ffce,0xffd4ffd4,0x0a21dcc9,0x0606060d,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x061e0601,0x15ff06ff,0x34ff2fff,0x2eff2bff,0x2dff2fff,
-0x20ff27ff,0x11ff17ff,0x07ff0cff,0x066b06c8,0x06170633,0xea670806,0xff92ff7e,0xffa7ff9e,0xffb3ffae,0xff44ffb8,0xff0aff09,0xff8aff0a,0xffc8ffc7,0xffc7ffc8,0xffc0ffc5,0x9895ffb4,0x06000800,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x07000600,0xff66575e,0xff79ff6c,0xff93ff88,0xffa3ff9c,0xff08ff6c,0xff0aff09,0xff83ff0b,0xffcfffca,
-0xffd8ffd4,0xffddffdb,0x57b9ffd6,0x06020803,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06580610,0x11ff07ff,0x1fff1dff,0x1bff1cff,0x12ff17ff,0x0aff0eff,0x06a206ff,0x062a0655,0x07050612,0xff75575c,0xff9eff8f,0xffb1ffa9,0xffbcffb7,0xff0aff84,0xff0bff0b,0xff86ff0b,0xffd0ffcf,0xffd0ffd0,0xffc8ffce,0x5695ffb9,0x06000600,
-0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff69f865,0xff84ff75,0xff99ff90,0xffa8ffa1,0xff09ff0d,0xff0bff0a,0xffc8ff44,0xffd1ffcd,0xffdaffd6,0xffdbffdd,0x0804b1c8,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x063c060f,0x09ff06b1,0x1cff12ff,0x1cff1fff,0x14ff19ff,0x09ff0eff,0x068806fe,
-0x061c0642,0xa9660807,0xff93ff7d,0xffaaffa0,0xffb8ffb2,0xff41ffbc,0xff0bff0a,0xff0dff0b,0xffcfffc5,0xffd0ffd0,0xffccffcf,0xf2b0ffc5,0x06000800,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x06000600,0xff66485c,0xff72ff68,0xff8cff80,0xff9dff95,0xff14ff95,0xff09ff08,0xffaeff1b,0xffc9ffc4,0xffd1ffcd,0xffd6ffd4,0x3fadffcf,0x0607060c,0x06020604,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x0bff061e,0x37ff30ff,0x34ff34ff,0x2bff30ff,0x1fff25ff,0x14ff19ff,0x0cff10ff,
-0x06fc08ff,0x065c069e,0x061d0634,0x0705060f,0xff6e455b,0xff99ff89,0xffacffa4,0xffb7ffb2,0xff17ffa9,0xff0aff09,0xffb1ff1c,0xffc9ffc8,0xffc6ffc8,0xffbcffc3,0x4581ffaa,0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x0a0a0600,0xff68f165,0xff83ff74,0xff99ff8f,0xffa1ffa1,0xff09ff09,0xff0bff0a,0xffc9ff47,0xffd3ffce,0xffdbffd6,
-0xffdcffdd,0x0803b1cc,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06f30610,0x22ff15ff,0x1bff1eff,0x16ff18ff,0x0eff12ff,0x08ff0bff,0x06a106fe,0x0634065f,0x060e061c,0x06020606,0xaf670800,0xff98ff82,0xffaeffa5,0xffbbffb5,0xff42ffbf,0xff0bff0a,0xff0fff0b,0xffd0ffcf,0xffd0ffd1,0xffccffcf,0xfaadffc4,
-0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff66b164,0xff7fff6e,0xff96ff8c,0xffa6ff9e,0xff09ff39,0xff0bff0a,0xffc0ff0e,0xffd0ffcc,0xffd9ffd5,0xffddffdd,0x0b26f2d4,0x06020604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06100600,0x0cff0691,0x20ff1cff,0x1bff1cff,0x14ff18ff,
-0x0dff11ff,0x06ff09ff,0x066106af,0x06180632,0x0604060b,0xf66c0801,0xff9bff89,0xffb0ffa7,0xffbbffb6,0xff0dffc0,0xff0bff0a,0xff48ff0b,0xffd0ffcf,0xffd0ffd1,0xffcaffce,0xafa4ffc0,0x06000800,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x06000600,0xff66555c,0xff80ff6e,0xff99ff8e,0xffa9ffa2,0xff0cff95,0xff0bff0a,0xffaeff14,0xffd6ffd1,
-0xffddffda,0xffe5ffe3,0x3eb9ffdf,0x06000701,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x061c0604,0x07ff0675,0x0dff0cff,0x09ff0bff,0x06ff08ff,0x067406b9,0x06200640,0x0606060e,0x07000602,0xff794b5b,0xffa6ff97,0xffb9ffb1,0xffc3ffbf,0xff0fffab,0xff0cff0c,0xffb5ff10,0xffd8ffd6,0xffd8ffd8,0xffd1ffd6,0x4596ffc2,0x06000600,
-0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff6cec65,0xff8aff7b,0xff9fff96,0xffaeffa7,0xff0aff31,0xff0cff0b,0xffcfff70,0xffd8ffd4,0xffe1ffdd,0xffe3ffe4,0x0801a2cf,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06130604,0x06a0063c,0x0bff07ff,0x0bff0dff,0x06ff09ff,0x067806c2,0x061d063c,
-0x0605060d,0xa6680801,0xff9bff86,0xffb2ffa8,0xffbfffb9,0xff70ffc4,0xff0cff0b,0xff34ff0c,0xffd6ffd4,0xffd9ffd8,0xffd5ffd8,0xeab9ffcf,0x06000800,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x07000600,0xff66555c,0xff79ff6b,0xff93ff88,0xffa3ff9b,0xff08ff71,0xff0aff09,0xff80ff0b,0xffd0ffcb,0xffd8ffd4,0xffddffdc,0x56beffd9,0x06010702,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x09ff060f,0x22ff1eff,0x19ff1dff,0x12ff15ff,0x0cff0fff,0x07ff09ff,0x069206d2,
-0x0638065f,0x0610061f,0x06040608,0x08000602,0xff78575c,0xffa3ff93,0xffb5ffad,0xffbfffb9,0xff0aff7c,0xff0bff0b,0xff87ff0b,0xffd1ffd0,0xffd0ffd1,0xffc7ffcd,0x558fffb7,0x06000800,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x0a0a0600,0xff6bed65,0xff89ff79,0xff9eff95,0xffacffa7,0xff0aff29,0xff0cff0b,0xffcfff6a,0xffd9ffd4,0xffe2ffdd,
-0xffe4ffe6,0x08009ed2,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x065a0604,0x0dff08ff,0x0aff0cff,0x07ff08ff,0x06ac06f3,0x06530679,0x061b0631,0x0607060f,0x06010603,0x06000600,0x9a6a0800,0xff9fff89,0xffb6ffad,0xffc2ffbd,0xff6effc7,0xff0cff0b,0xff3eff0c,0xffd8ffd6,0xffd9ffd9,0xffd5ffd8,0xf2b6ffcd,
-0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff689e63,0xff85ff75,0xff9cff92,0xffabffa4,0xff0aff65,0xff0bff0b,0xffcdff35,0xffd6ffd2,0xffe0ffdc,0xffe5ffe4,0x0a14e8db,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050600,0x06db0632,0x0dff0bff,0x0aff0bff,0x06ff08ff,
-0x069706dd,0x063b0662,0x06100621,0x06030607,0x06000601,0xec700800,0xffa3ff91,0xffb7ffaf,0xffc3ffbd,0xff32ffc7,0xff0cff0b,0xff76ff0c,0xffd8ffd6,0xffd8ffd8,0xffd3ffd6,0x96aeffc8,0x06000800,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x06000600,0xff651a44,0xff85ff72,0xff9eff93,0xffafffa7,0xff91ffb6,0xff43ff49,0xffd2ff99,0xffdcffd6,
-0xffe5ffe0,0xffedffea,0x23a3fde5,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050600,0x0650061d,0x06a60690,0x06660685,0x062b0649,0x0611061c,0x06030608,0x06000601,0x06000600,0xfb7e234d,0xffacff9c,0xffbfffb7,0xffcaffc5,0xffa0ffce,0xff50ff52,0xffdcffa6,0xffdfffdd,0xffe0ffe0,0xffd9ffdd,0x2583ffc7,0x06000600,
-0x06000600,0x06000600,0x02000400,0x06000300,0x06000600,0x06000600,0x08000600,0xff6ec064,0xff90ff80,0xffa5ff9b,0xffb4ffad,0xff5affa4,0xff76ff3e,0xffd5ffcf,0xffdfffda,0xffe8ffe4,0xffe8ffec,0x080072d0,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x0627060d,0x06830650,0x0685069b,0x063c0661,0x06140623,0x06030609,
-0x06000601,0x72640800,0xffa1ff89,0xffb8ffaf,0xffc6ffc0,0xffccffcb,0xff42ff7f,0xffc4ff64,0xffddffdc,0xffe0ffdf,0xffddffe0,0xc2bfffd6,0x06000800,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x07000600,0xff664e5e,0xff7fff6e,0xff99ff8d,0xffa9ffa1,0xff0dff93,0xff0bff0a,0xffafff11,0xffd6ffd1,0xffdfffdb,0xffe5ffe4,0x4dc1ffe0,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06a70604,0x0cff0aff,0x08ff0aff,0x06d306ff,0x067706a0,0x0636064d,0x06150624,
-0x0606060c,0x06010603,0x06000600,0x07000600,0xff7f4f5c,0xffaaff9b,0xffbcffb4,0xffc6ffc2,0xff0fffab,0xff0cff0c,0xffb6ff13,0xffd8ffd8,0xffd8ffd9,0xffcfffd6,0x4d96ffc0,0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x07000600,0xff6ec964,0xff8eff7f,0xffa4ff9a,0xffb3ffac,0xff51ffac,0xff75ff44,0xffd5ffce,0xffdfffda,0xffe8ffe4,
-0xffeaffed,0x080070d1,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06110600,0x06960655,0x0664068c,0x06360649,0x06190624,0x0609060f,0x06020605,0x06000601,0x06000600,0x06000600,0x76670800,0xffa5ff8d,0xffbcffb3,0xffc9ffc3,0xffcfffce,0xff49ff79,0xffc8ff61,0xffdfffdd,0xffe0ffe0,0xffdcffdf,0xc0bcffd3,
-0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff697460,0xff8aff79,0xffa1ff97,0xffb1ffa9,0xff6effb4,0xff59ff44,0xffd3ffb9,0xffddffd8,0xffe7ffe3,0xffebffeb,0x0800c8dd,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x0633060a,0x069d0680,0x06630681,0x063a064c,
-0x06150624,0x0607060d,0x06010603,0x06000600,0x06000600,0xc6730800,0xffa9ff96,0xffbeffb6,0xffc9ffc4,0xffbdffce,0xff40ff61,0xffdbff87,0xffdfffdd,0xffe0ffe0,0xffdbffdf,0x6eadffcd,0x06000800,0x06000600,0x06000600,0x03000600,0x04000200,0x06000600,0x08000700,0x08000800,0xc8640900,0xff88ff74,0xffa3ff97,0xffb4ffac,0xffc1ffbb,0xffcdffc7,0xffd8ffd2,0xffe2ffdd,
-0xffecffe7,0xfff2fff1,0x0953d0e5,0x08000861,0x07000800,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060a0603,0x06190616,0x060d0612,0x06040609,0x06010602,0x06000600,0x06000600,0x08000700,0xd27b0900,0xffb2ffa0,0xffc5ffbd,0xffd0ffcb,0xffd8ffd4,0xffddffdb,0xffe3ffe1,0xffe6ffe5,0xffe7ffe7,0xffddffe5,0x0904ccc7,0x08000804,
-0x06000700,0x06000600,0x00000300,0x06000300,0x06000600,0x07000600,0x09000800,0xff6e7f61,0xff93ff83,0xffa9ffa0,0xffb9ffb2,0xffc5ffbf,0xffd0ffcb,0xffdbffd6,0xffe5ffe0,0xffefffea,0xfdedfff2,0x07182fb7,0x08870800,0x060007a2,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050601,0x0618060c,0x0614061c,0x0608060c,0x06010604,0x07000600,
-0x08000800,0x2b540900,0xffa5ff87,0xffbfffb4,0xffccffc6,0xffd5ffd1,0xffdcffd9,0xffe1ffdf,0xffe5ffe3,0xffe7ffe6,0xffe4ffe7,0x76bcffd9,0x08000900,0x07000800,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x04000200,0x06000600,0x06000600,0x06000600,0xff651f4c,0xff84ff71,0xff9eff92,0xffaeffa7,0xff91ffb5,0xff4bff45,0xffd2ff99,0xffdcffd6,0xffe6ffe1,0xffedffeb,0x21a2ffe7,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06210600,0x06760660,0x0640065a,0x061d062d,0x060e0613,0x06050609,0x06010603,
-0x06000601,0x06000600,0x06000600,0x06000600,0xfd81234e,0xffb1ffa1,0xffc3ffbb,0xffcdffc8,0xff9effd1,0xff4dff49,0xffddffa9,0xffe0ffdf,0xffdfffe0,0xffd6ffdd,0x2284fdc5,0x06000600,0x06000600,0x06000600,0x02000400,0x06000300,0x06000600,0x08000700,0x09000800,0xff6e7b61,0xff92ff81,0xffa8ff9e,0xffb8ffb1,0xffc5ffbf,0xffd0ffcb,0xffdbffd6,0xffe6ffe0,0xfff0ffeb,
-0xffedfff3,0x09692db9,0x08ae0800,0x060007d0,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x0615060c,0x060a0612,0x06040607,0x06020603,0x06000601,0x06000600,0x06000600,0x07000600,0x08000800,0x27560800,0xffa9fb8c,0xffc2ffb9,0xffcfffca,0xffd8ffd4,0xffddffdb,0xffe2ffe0,0xffe6ffe4,0xffe7ffe7,0xffe3ffe6,0x73b9ffd8,
-0x08000900,0x07000800,0x06000600,0x03000600,0x06000300,0x06000600,0x08000700,0x09000800,0xfb672a50,0xff8eff79,0xffa5ff9b,0xffb6ffae,0xffc3ffbd,0xffceffc9,0xffd9ffd4,0xffe4ffdd,0xffeeffe8,0xffeffff2,0x07007fda,0x07020600,0x06000702,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070601,0x06160612,0x060d0612,0x06050609,
-0x06010603,0x06000601,0x06000600,0x07000600,0x07000700,0x7a700900,0xffaeff97,0xffc3ffbb,0xffd0ffca,0xffd8ffd4,0xffddffdb,0xffe3ffe0,0xffe6ffe5,0xffe7ffe7,0xffe1ffe6,0x2a93fdd1,0x08000900,0x07000800,0x06000600,0x03000600,0x03000000,0x06000600,0x09000700,0x0b000b00,0x8b440b00,0xff89ff72,0xffa7ff9a,0xffb8ffb0,0xffc6ffc0,0xffd2ffcc,0xffddffd8,0xffe8ffe3,
-0xfff3ffee,0xfff2fff7,0x0b6e81a2,0x0b930b49,0x070009a8,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020602,0x06010601,0x06000600,0x06000600,0x06000600,0x07000600,0x0b000900,0x7d550b00,0xffb4ff9d,0xffcaffc1,0xffd6ffd1,0xffddffdb,0xffe5ffe2,0xffe8ffe7,0xffedffeb,0xffedffee,0xffdfffeb,0x0b12838c,0x0b000b03,
-0x06000800,0x06000600,0x00000300,0x06000300,0x06000600,0x08000600,0x0b000b00,0xed6a3b20,0xff95ff83,0xffadffa3,0xffbdffb6,0xffcaffc4,0xffd6ffd0,0xffe1ffdb,0xffecffe6,0xfff6fff1,0xb0e4fff6,0x0b313233,0x09790b04,0x060007a2,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06010602,0x06000601,0x06000600,0x07000600,
-0x0b000900,0x28000b00,0xffa6bc7f,0xffc4ffb8,0xffd2ffcb,0xffdbffd6,0xffe2ffdf,0xffe8ffe5,0xffecffea,0xffeeffed,0xffe8ffed,0x433cedd9,0x0b000b02,0x08000b00,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x07000600,0x08000800,0xcc640900,0xff87ff72,0xffa1ff96,0xffb3ffab,0xffc1ffb9,0xffccffc7,0xffd6ffd2,0xffe2ffdd,0xffedffe7,0xfff2fff2,0x0921c8e6,0x07000826,0x07000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x060c060b,0x06050608,0x06020603,0x06010601,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x08000700,0xcc810900,0xffb6ffa4,0xffc9ffc1,0xffd3ffcf,0xffdbffd6,0xffe0ffdd,0xffe4ffe2,0xffe7ffe6,0xffe6ffe7,0xffdcffe4,0x0903d0c4,0x08000804,0x06000700,0x06000600,0x00000300,0x06000300,0x06000600,0x09000700,0x0b000b00,0xf3694a1c,0xff93ff81,0xffacffa2,0xffbdffb5,0xffcaffc4,0xffd6ffd0,0xffe1ffdb,0xffecffe7,0xfff6fff1,
-0xbce2fff6,0x0b5c3735,0x09a40b0c,0x060007d0,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x0b000900,0x2a000900,0xffaab484,0xffc7ffbc,0xffd5ffcf,0xffddffda,0xffe4ffe1,0xffe8ffe7,0xffedffeb,0xffeeffed,0xffe6ffed,0x5032efd5,
-0x0b000b01,0x07000900,0x06000600,0x03000600,0x04000200,0x06000600,0x09000700,0x0b000b00,0xbd603200,0xff8fff79,0xffa9ff9e,0xffb9ffb2,0xffc8ffc1,0xffd4ffce,0xffdfffd9,0xffeaffe4,0xfff3fff0,0xeff0fff7,0x0800455e,0x09010800,0x06000802,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06000601,0x06000600,
-0x06000600,0x06000600,0x06000600,0x07000600,0x09000800,0x471c0b00,0xffaff191,0xffc9ffbf,0xffd6ffd0,0xffddffda,0xffe4ffe1,0xffe8ffe7,0xffedffeb,0xffeeffee,0xffe3ffec,0x2a01bac3,0x0b010b00,0x07000902,0x06000600,0x02000400,0x03000000,0x06000600,0x07000600,0x0b000900,0x8d020b00,0xff86ee56,0xffa8ff9a,0xffbcffb3,0xffcbffc4,0xffd6ffd1,0xffe3ffdd,0xffeeffe8,
-0xfff8fff3,0xf0c9fff9,0x0b248719,0x0aff0b60,0x060007ea,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x0b000900,0x81010b01,0xffb2ee76,0xffceffc3,0xffdcffd6,0xffe5ffe1,0xffebffe8,0xfff0ffee,0xfff3fff2,0xfff2fff3,0xf6aaffeb,0x0b0e8703,0x09060b05,
-0x06000700,0x06000600,0x00000300,0x04000200,0x06000600,0x08000600,0x0b000b00,0xdd330b00,0xff95ff7c,0xffb0ffa5,0xffc2ffb9,0xffcfffc9,0xffdcffd6,0xffe7ffe1,0xfff2ffed,0xfff9fff7,0xc142ffeb,0x0b001719,0x07070905,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x09000700,0x17000b00,0xff97bf19,0xffc7ffb8,0xffd6ffd0,0xffe1ffdd,0xffe8ffe5,0xffeeffeb,0xfff2fff0,0xfff3fff3,0xffe8fff2,0x0b03d563,0x0b000b01,0x07000900,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x08000600,0x0b000b00,0x7f470a00,0xff87ff70,0xffa5ff98,0xffb7ffaf,0xffc5ffbf,0xffd2ffcb,0xffddffd8,0xffe8ffe3,0xfff3ffee,0xfff2fff7,0x0bb97ba4,0x0a190b1d,0x07000962,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x07000600,0x0b010901,0x875b0b03,0xffb8ffa1,0xffceffc5,0xffd9ffd4,0xffe1ffdd,0xffe7ffe4,0xffebffe8,0xffedffec,0xffedffee,0xffddffe8,0x0a0e8385,0x0b000b03,0x06000800,0x06000600,0x00000300,0x04000200,0x06000600,0x08000600,0x0b000b00,0xdd310a00,0xff93ff79,0xffafffa3,0xffc1ffb8,0xffcfffc8,0xffdbffd5,0xffe7ffe1,0xfff2ffed,0xfffafff7,
-0xc13cffeb,0x0b01131f,0x07140910,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x09060703,0x19050b0b,0xfe9abd19,0xffcbffbd,0xffdaffd4,0xffe4ffdf,0xffeaffe7,0xffefffed,0xfff3fff2,0xfff3fff3,0xffe6fff0,0x0b04d769,
-0x0b000b01,0x06000800,0x06000600,0x02000400,0x03000000,0x06000600,0x07000600,0x0b000900,0xc5141b00,0xff8efe6d,0xffacff9f,0xffbeffb6,0xffcdffc6,0xffd9ffd3,0xffe5ffdf,0xfff0ffeb,0xfff9fff6,0xd77dfff6,0x0b000b00,0x09460b3c,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x0b010800,0x0b090b04,0xffabdf42,0xffcdffc0,0xffdbffd5,0xffe4ffe0,0xffebffe8,0xfff0ffed,0xfff3fff2,0xfff3fff3,0xfed5ffef,0x1704bd28,0x09020b00,0x06000702,0x06000600,0x00000300,0x02000000,0x06000400,0x06000600,0x09000700,0x17000b00,0xff68d60b,0xffa7ff95,0xffbfffb5,0xffcfffc7,0xffdcffd6,0xffe8ffe3,0xfff3ffef,
-0xfffafff8,0xd824ffd4,0x0b141900,0x079a0986,0x06000600,0x06000600,0x06000600,0x06010600,0x06050603,0x06050606,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x09090705,0x170e0b12,0xff93d812,0xffcfffc0,0xffe0ffd9,0xffeaffe6,0xfff1ffee,0xfff6fff3,0xfff9fff8,0xfff2fff7,0xcf18ffc4,0x0b0d1700,0x07080914,
-0x06000600,0x04000600,0x00000200,0x03000000,0x06000600,0x07000600,0x0b000900,0x8f000b00,0xff8eff45,0xffb1ffa3,0xffc5ffbd,0xffd4ffcd,0xffe1ffdb,0xffedffe7,0xfff7fff2,0xfff3fffa,0x4702fb52,0x09010b00,0x06000700,0x06000600,0x06000600,0x06000600,0x06020601,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x07010600,0x0b090904,0xfb2f4b01,0xffc5ffaa,0xffdaffd1,0xffe6ffe1,0xffeeffeb,0xfff3fff1,0xfff8fff7,0xfff7fff9,0xff89ffee,0x0b029104,0x09000b00,0x06000700,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x07000600,0x0b000900,0x8d020b00,0xff84fa53,0xffa7ff99,0xffbbffb2,0xffcaffc3,0xffd6ffd0,0xffe3ffdd,0xffeeffe8,0xfff8fff3,0xf0c2fff9,0x0b9c8918,0x0afc0b67,0x06000613,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06020600,0x070a0605,0x0b17090e,0x87060b28,0xffb6e97c,0xffd2ffc7,0xffdfffd9,0xffe7ffe3,0xffedffea,0xfff1ffef,0xfff3fff3,0xfff1fff3,0xf8aaffe8,0x0b0a8903,0x09030b02,0x06000700,0x06000600,0x00000300,0x03000000,0x06000600,0x07000600,0x0b000900,0x91000b00,0xff8cff40,0xffb0ffa1,0xffc4ffbb,0xffd3ffcc,0xffe0ffda,0xffecffe6,0xfff6fff2,0xfff6fffa,
-0x4702f556,0x09020b00,0x06000702,0x06000600,0x06000600,0x06000600,0x06020601,0x06060603,0x060b0608,0x060e060d,0x0606060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06150608,0x0747062c,0x0b8d0962,0xf9364918,0xffc8ffb2,0xffddffd5,0xffe8ffe4,0xfff0ffed,0xfff6fff3,0xfff9fff8,0xfff6fff9,0xff88ffee,0x0b039205,
-0x09000b00,0x06000700,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x09000700,0x43000b00,0xff81f71e,0xffacff9c,0xffc1ffb8,0xffd1ffc9,0xffddffd8,0xffebffe5,0xfff6fff0,0xfff9fffa,0x9408ff9a,0x0b410b00,0x076209d6,0x06000600,0x06000600,0x06000600,0x06020601,0x06060604,0x060a0608,0x0607060b,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06060602,0x0918070d,0x0b490b2d,0xff669207,0xffccffbc,0xffdfffd6,0xffeaffe5,0xfff1ffed,0xfff6fff3,0xfff8fff8,0xfff5fff8,0xfb49ffe5,0x0b024301,0x07010903,0x06000600,0x06000600,0x00000300,0x00000000,0x06000300,0x06000600,0x07000600,0x0b000900,0xd40f2200,0xffa1ff6d,0xffbfffb2,0xffd1ffc8,0xffdfffd9,0xffecffe6,0xfff6fff2,
-0xffc0fff8,0x2400d41c,0x098d0b67,0x06000721,0x06000600,0x06000600,0x06020601,0x060f0607,0x06280619,0x0632063a,0x06050616,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06120606,0x07640635,0x0bd80986,0xdc212259,0xffceff98,0xffe2ffd8,0xffedffe8,0xfff5fff1,0xfffafff8,0xfffafffb,0xffbbfff3,0x2600d61d,0x093b0b27,0x06000714,
-0x06000600,0x03000600,0x00000000,0x02000000,0x06000400,0x06000600,0x09000700,0x0c000b00,0xff4b9000,0xffaeff98,0xffc6ffbb,0xffd6ffcf,0xffe4ffdd,0xfff1ffeb,0xfff8fff5,0xf94cffe4,0x0b025c00,0x07010904,0x06000600,0x06000600,0x06010600,0x06070603,0x0616060e,0x060d0618,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,
-0x06150606,0x0948072a,0x52140b79,0xffb1f338,0xffdbffcf,0xffe8ffe3,0xfff2ffee,0xfff8fff5,0xfffbfffb,0xfff0fff9,0xa707ff7e,0x0b000d00,0x07000900,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x02000000,0x06000400,0x06000600,0x09000700,0x15000b00,0xff66d309,0xffa6ff93,0xffbdffb3,0xffceffc6,0xffdbffd5,0xffe8ffe2,0xfff3ffee,0xfff9fff8,0xcf24ffd5,0x0b161700,0x07a4098f,0x06000600,0x06000600,0x06000600,0x06000600,0x06030602,0x06070605,0x060b060a,0x0609060b,0x06040607,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06020601,0x06140607,0x065c0631,0x09af078f,0x15910beb,0xff99d624,0xffd3ffcc,0xffe3ffdc,0xffecffe8,0xfff3fff0,0xfff7fff5,0xfff9fff9,0xfff0fff7,0xd416ffc6,0x0b081700,0x0704090c,0x06000600,0x04000600,0x00000200,0x02000000,0x06000400,0x06000600,0x09000700,0x0d000b00,0xff449b02,0xffacff97,0xffc5ffb9,0xffd5ffcd,0xffe3ffdd,0xfff0ffea,0xfff7fff5,0xf54bffe7,
-0x0b065200,0x07000908,0x06000600,0x06000600,0x06000600,0x06020600,0x060b0605,0x06210614,0x06450631,0x065c0656,0x0632065a,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06130606,0x066e062f,0x09ff06e1,0x15ff0eff,0x54661cff,0xffbdf546,0xffddffd2,0xffecffe6,0xfff3fff0,0xfff9fff7,0xfffbfffb,0xfff0fff9,0x9707ff7d,0x0b000c00,
-0x07000900,0x06000600,0x04000600,0x00000200,0x02000000,0x06000400,0x06000600,0x07000600,0x0b000900,0xf5245800,0xffa7ff87,0xffc2ffb6,0xffd3ffcb,0xffe2ffdb,0xffeeffe8,0xfff7fff3,0xff87fff5,0x0f009805,0x0dff0b00,0x0600060a,0x06000600,0x06000600,0x06020600,0x060c0606,0x06280619,0x064e0639,0x063e065b,0x06020611,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06060601,0x06320612,0x07c0066e,0x0fff09ff,0x902a13ff,0xffc7ff6a,0xffe0ffd5,0xffedffe7,0xfff5fff1,0xfffafff7,0xfffafffb,0xffe1fff6,0x5800f545,0x090b0b07,0x06000703,0x06000600,0x04000600,0x00000200,0x00000000,0x04000200,0x06000600,0x06000600,0x09000700,0x19000b00,0xff40a905,0xffb9ff98,0xffd0ffc5,0xffe0ffd9,0xffedffe7,0xffe1ffef,
-0xa607fd6e,0x0b201700,0x07a40dff,0x06000600,0x06000600,0x06010600,0x060b0603,0x063a061b,0x06af066c,0x06fe06ff,0x061b0679,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060a0602,0x065a061f,0x0aff06da,0x19ff11ff,0x2aff23ff,0xff6ca637,0xffdcffbb,0xffedffe5,0xfff6fff2,0xfff9fff8,0xffddfff7,0xaf08ff67,0x0b221700,0x073c0951,0x06000600,
-0x06000600,0x02000400,0x00000000,0x00000000,0x06000300,0x06000600,0x07000600,0x0b000900,0x70000c00,0xff78ef24,0xffc1ffb3,0xffd6ffcd,0xffe5ffdd,0xfff0ffeb,0xff98ffee,0x3600d61d,0x09140b0f,0x06000704,0x06000600,0x06000600,0x06050601,0x0622060e,0x06740645,0x06530685,0x0608061d,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060b0603,
-0x066e0624,0x0bff06f3,0x19ff12ff,0xd4333f77,0xffcdff88,0xffe7ffdd,0xfff3ffee,0xfff9fff6,0xfff6fff9,0xf13bffc1,0x0c037000,0x09000b10,0x06000700,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x07000600,0x0b000900,0xd60e2200,0xff9fff68,0xffbdffaf,0xffd0ffc7,0xffddffd6,0xffecffe5,0xfff6fff2,0xffbffff6,0x2800d41c,0x098d0b65,0x06000723,0x06000600,0x06000600,0x06000600,0x06030601,0x060e0607,0x06260619,0x063c0632,0x063c0642,0x061d062e,0x0600060b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,
-0x06120607,0x0669062c,0x08ff06e0,0x14ff0dff,0x25ff1cff,0xda382cff,0xffceffa2,0xffe4ffdb,0xffefffeb,0xfff6fff3,0xfffbfff9,0xfffafffb,0xffaefff1,0x2600d31f,0x09270b1a,0x0600070d,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x07000600,0x09000800,0x6c000c00,0xff79f121,0xffbfffb1,0xffd5ffcb,0xffe4ffdd,0xffeeffea,0xff9dffea,0x3800d619,
-0x092b0b1f,0x0600070a,0x06000600,0x06000600,0x06000600,0x06050601,0x061d060d,0x0665063a,0x06e606a1,0x07ff06ff,0x06dd08ff,0x06000627,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06090602,0x0644061a,0x07ff069d,0x15ff0dff,0x2cff20ff,0x39ff34ff,0xcf473bf3,0xffd1ff8c,0xffeaffdf,0xfff3fff0,0xfff9fff7,0xfff7fff9,0xef40ffbd,0x0c036100,0x09000b0f,
-0x06000700,0x06000600,0x03000600,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x09000700,0x3b000b00,0xff5fd413,0xffbdffa9,0xffd3ffc8,0xffe2ffdb,0xffeeffe8,0xffbefff1,0x6900f33f,0x0b000b00,0x07000900,0x06000600,0x06000600,0x06000600,0x06080602,0x062b0614,0x068e0654,0x07ff06e1,0x06ff08ff,0x060c0664,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06020600,0x061c0609,0x06bc0649,0x0fff08ff,0x23ff18ff,0x34ff2eff,0xed517465,0xffd9ffaa,0xffebffe3,0xfff5fff1,0xfff9fff8,0xffeffff8,0xd31dff9b,0x0b353900,0x070c0946,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x07000600,0x09000800,0x43000b00,0xf93ab307,0xff93ff6a,0xffc0ffb6,0xff8affac,0xad0bf751,
-0x0b0a3d00,0x0983090b,0x0600060a,0x06000600,0x06000600,0x06020600,0x06180608,0x0687063c,0x09ff06ff,0x0fff0eff,0x066008ff,0x0601060f,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x0621060a,0x06ec065f,0x14ff0bff,0x2fff21ff,0x3aff36ff,0x419335ff,0xf74fa633,0xffb0ff84,0xffcbffcd,0xff8dffb9,0xb10bf953,0x0b5c4500,0x082d096c,0x06000734,0x06000600,
-0x04000600,0x00000200,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x08000700,0x0b000900,0x83002800,0xff5fe424,0xffb5ff8c,0xffb9ffbc,0xff63ff97,0x6800ce28,0x0b010f00,0x07170912,0x06000600,0x06000600,0x06000600,0x060d0603,0x065f0626,0x08ff06c8,0x07ff0aff,0x0620066b,0x06010607,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x062c060c,
-0x07ff067f,0x18ff0eff,0x32ff26ff,0x36ff36ff,0xcd386c58,0xff93ff5a,0xffcaffb7,0xffa9ffc6,0xde31ff7b,0x22008900,0x0aa90b32,0x07000815,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x04000200,0x06000600,0x06000600,0x09000700,0x1b000b00,0xff41a905,0xffb7ff93,0xffcfffc4,0xffdfffd6,0xffecffe6,0xffe1ffee,0xa609ff65,0x0b1b1b00,0x07a20cff,0x06000600,0x06000600,0x06000600,0x06010600,0x06070603,0x06210611,0x065f063c,0x06aa0685,0x06b806bf,0x06610693,0x06000624,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06090603,
-0x063c0619,0x06ff0682,0x11ff0bff,0x24ff1aff,0x35ff2dff,0x3cff39ff,0xfd6ca43c,0xffdfffc1,0xffefffe7,0xfff7fff3,0xfff9fff9,0xffdafff6,0xa609ff64,0x0b081700,0x07290926,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x07000600,0x0b000900,0x85002600,0xff61e81f,0xffa8ff89,0xffb0ffb7,0xff6bff99,0x6800ce1e,0x0b1c0f00,
-0x07310943,0x06000600,0x06000600,0x06000600,0x06000600,0x06070602,0x062d0614,0x06a9065b,0x09ff06ff,0x0eff0bff,0x0aff10ff,0x0602066a,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06150607,0x06830638,0x0bff06ff,0x1cff12ff,0x2eff26ff,0x34ff33ff,0x23ff2dff,0xcc286c2e,0xff90fd5c,0xffceffb5,0xffa5ffcd,0xe63aff74,0x1d008f01,0x0a710b2f,0x07000813,
-0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x07000600,0x0b000900,0x68001100,0xff48cc11,0xffa5ff7c,0xffbbffb5,0xff7bffa0,0x8900e932,0x0b761d00,0x08000987,0x06000700,0x06000600,0x06000600,0x06010600,0x060e0604,0x06540624,0x07ff06a9,0x0eff0aff,0x10ff13ff,0x062406ff,0x06000601,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06080602,0x0648061a,0x08ff06ae,0x19ff0fff,0x30ff25ff,0x39ff38ff,0x26ff34ff,0xe63c8b2c,0xffa6ff6e,0xffcfffc8,0xff9effc2,0xc81efd62,0x11046c00,0x093e0b1b,0x06000755,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x07000600,0x09000800,0x1b000b00,0x74004f00,0x8a008500,0x4e007500,0x0a031700,
-0x080d0903,0x06000710,0x06000600,0x06000600,0x06000600,0x06020600,0x061e060a,0x06bd0650,0x0eff08ff,0x19ff16ff,0x06bf0fff,0x0603061f,0x06000600,0x06000600,0x06000600,0x06000600,0x06050601,0x063b0613,0x07ff069b,0x18ff0eff,0x2cff23ff,0x2eff33ff,0x19ff25ff,0x15150cff,0x75004c00,0x92007d00,0x4a007600,0x0b1e1f00,0x096a0b90,0x06000793,0x06000600,0x06000600,
-0x03000600,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x08000700,0x0b000900,0x37000d00,0x83006c00,0x7a009200,0x24005200,0x0a340900,0x08010937,0x06000701,0x06000600,0x06000600,0x06010600,0x06140605,0x0699063b,0x0dff07ff,0x0eff12ff,0x064406ec,0x0602060f,0x06000600,0x06000600,0x06000600,0x06000600,0x06080601,0x0659061d,
-0x0bff06ef,0x21ff15ff,0x36ff2fff,0x2fff36ff,0x0fff20ff,0x54022b02,0x90008800,0x70008f00,0x0c033700,0x0dff0b66,0x06220cff,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02000000,0x06000400,0x06000600,0x07000600,0x09000800,0x41000b00,0xf932b304,0xff96ff6e,0xffb8ffb3,0xff87ffaa,0xab09fb4e,0x0b083d00,0x097f0909,0x06000615,0x06000600,0x06000600,0x06000600,0x06010600,0x06090603,0x062b0615,0x067e064e,0x06f806bb,0x06ff06ff,0x06aa06fa,0x0602063f,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06120607,
-0x065e062b,0x08ff06bf,0x13ff0dff,0x21ff1aff,0x2aff28ff,0x22ff28ff,0x3f411cff,0xf949ab1a,0xffb2ff85,0xffc8ffbe,0xff93ffbd,0xad0bf751,0x0b493900,0x080b0956,0x0600070b,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x08000700,0x0b000900,0x35000f00,0x7d007400,0x76008800,0x24005a00,0x0a2b0901,0x0824092e,
-0x0600072b,0x06000600,0x06000600,0x06000600,0x06000600,0x06060601,0x06280611,0x069e0652,0x09ff06ff,0x0fff0cff,0x0cff12ff,0x06030690,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x061a060a,0x0687063f,0x0aff06ff,0x14ff0fff,0x1cff18ff,0x16ff1aff,0x0cff11ff,0x09650abc,0x5a002801,0x86007e00,0x70008300,0x0d024400,0x0dff0b66,0x060c0aff,0x06000600,
-0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x08000700,0x0b000900,0x26000b00,0x85005700,0x88009400,0x3b006b00,0x0a0f0e00,0x089c0910,0x060007bb,0x06000600,0x06000600,0x06000600,0x06010600,0x060e0604,0x065b0624,0x08ff06c3,0x12ff0cff,0x18ff19ff,0x06420bff,0x06000603,0x06000600,0x06000600,0x06000600,
-0x06010600,0x060d0604,0x06630627,0x0aff06e1,0x18ff10ff,0x27ff20ff,0x23ff27ff,0x12ff1aff,0x0e330bff,0x6b003b00,0x92008600,0x57007f00,0x0b4e2800,0x09330b5f,0x07010824,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x07000600,0x09000800,0x0b000b00,0x0a000b00,0x09000900,0x07040800,
-0x06000704,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06160607,0x0698063e,0x0cff07ff,0x19ff14ff,0x06d411ff,0x06030622,0x06000600,0x06000600,0x06000600,0x06000600,0x06070601,0x063c0616,0x06ff068e,0x11ff0bff,0x19ff16ff,0x12ff17ff,0x08ff0dff,0x0704075f,0x09120805,0x0b710a34,0x0b610b71,0x0fff0902,0x070007c6,0x06000600,0x06000600,0x06000600,
-0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x08000700,0x09000800,0x0b000b00,0x0a000b00,0x09000a00,0x07460700,0x0600074c,0x06000600,0x06000600,0x06000600,0x06010600,0x06110605,0x06920636,0x0eff07ff,0x12ff15ff,0x065407ff,0x06030613,0x06000600,0x06000600,0x06000600,0x06000600,0x060b0603,0x066b0626,
-0x0bff06ff,0x1bff13ff,0x23ff22ff,0x16ff1eff,0x07b10bff,0x0a17091d,0x0b2e0a16,0x0b6b0b87,0x080f0903,0x06370aff,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x07000600,0x0b000900,0x1b000b00,0x74004f00,0x93009200,0x49007500,0x09041300,0x09090a04,0x0600070c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050602,0x061d060e,0x065c0637,0x06c0068e,0x06f906e8,0x069d06e0,0x0603063c,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06110607,
-0x064e0627,0x06ff0690,0x0cff09ff,0x10ff0eff,0x11ff12ff,0x0aff0eff,0x097708df,0x17050a42,0x77004800,0x92008800,0x4a007a00,0x0b821900,0x0862098f,0x06000775,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x08000700,0x0b000900,0x0b000b00,0x09000a00,0x09000a00,0x073a0701,0x0600073e,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06130607,0x064f0628,0x06df068a,0x09ff07ff,0x08ff0bff,0x06020678,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06110606,0x06480624,0x06cd0681,0x08ff06ff,0x09ff08ff,0x06e807ff,0x074c06a0,0x07000718,0x0a0b0901,0x0a68092d,0x0dff0be3,0x080c0ada,0x062b0eff,0x06000600,0x06000600,
-0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x08000700,0x09000800,0x0b000b00,0x0a000b00,0x08000900,0x07140700,0x06000716,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06080602,0x06380616,0x06ed067c,0x0eff09ff,0x14ff13ff,0x06440aff,0x06000603,0x06000600,0x06000600,0x06000600,
-0x06010600,0x060c0604,0x06490620,0x06ff069a,0x0cff09ff,0x10ff0fff,0x0bff0eff,0x07a307ff,0x07010736,0x090f0801,0x0b510a29,0x0ba60baa,0x0868093c,0x071b087e,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x08000800,0x08000800,0x06000700,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06090602,0x0642061b,0x06ff0692,0x0fff0aff,0x06800bff,0x06010613,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x0621060d,0x06890648,0x07ff06db,0x07ff08ff,0x06bd06ff,0x0635066e,0x06050615,0x08150707,0x08960841,0x071e0779,0x06000700,0x06000600,0x06000600,0x06000600,0x03000400,
-0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x08000800,0x07000800,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06080602,0x0653061d,0x09ff06c6,0x0dff0fff,0x063e06e8,0x0602060e,0x06000600,0x06000600,0x06000600,0x06000600,0x06090602,0x0649061d,
-0x07ff06a1,0x0cff09ff,0x0cff0dff,0x06ff0aff,0x0639068f,0x0809070f,0x083c081a,0x088f08b3,0x06000704,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x08000700,0x09000800,0x0b000b00,0x0a000b00,0x0a000900,0x07060900,0x07000706,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060a0604,0x06230615,0x064b0636,0x066a065c,0x06480665,0x0603061c,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06080604,
-0x06210611,0x06580635,0x06a50680,0x06be06b8,0x068906b0,0x0637065c,0x070e061e,0x09000705,0x09290a09,0x0bbb0a62,0x09510bc1,0x08ad0807,0x060007c7,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x08000700,0x08000800,0x08000800,0x07000800,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x06120609,0x063c0622,0x067d065b,0x068d069d,0x0601063a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050602,0x0612060a,0x062b061d,0x06400636,0x0635063f,0x06130626,0x0605060b,0x06000601,0x080c0700,0x08810835,0x07480772,0x06000611,0x06000600,0x06000600,0x06000600,
-0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x08000800,0x07000800,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06130607,0x0657062a,0x06fe069f,0x09ff08ff,0x062206ee,0x06000601,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06050602,0x061d060d,0x06570635,0x06980680,0x0698069f,0x06460673,0x0613062a,0x06020606,0x08120701,0x086c0833,0x08dd08e2,0x06000752,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x060f0606,0x06480622,0x06cc0685,0x0626069a,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06090603,0x061d0612,0x0638062a,0x0632063a,0x06110622,0x06030608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x061a0608,0x068b0641,0x06f006ff,0x061a0665,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x061a060b,
-0x065b0633,0x067f0676,0x0666067d,0x06210641,0x0604060e,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x08000800,0x08000800,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06050603,0x060c0608,0x06130610,0x060e0614,0x06010606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,
-0x06050603,0x060b0608,0x0611060f,0x06100613,0x0608060c,0x06020604,0x06000601,0x07000600,0x0830080b,0x08f80879,0x077008ff,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06060604,0x060e060a,0x06140613,0x06000609,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06040603,0x06040604,0x06020603,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x060f0607,0x062c061c,0x065a0641,0x0608063c,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06010600,0x06050602,0x060e0609,0x06100610,0x060b060e,0x06030607,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06070603,0x0617060d,0x06050613,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06030602,0x06030603,0x06020602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06150609,0x062b0629,0x06050614,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040602,
-0x060c0608,0x060e060e,0x0607060b,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,
-0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06030602,0x06080605,0x06000605,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06030602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x02000300,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,
-0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,
-0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000400,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,0x03000300,0x04000400,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x04000300,0x03000400,0x03000300,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000200,0x03000300,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x04000300,0x04000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000400,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,
-0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x01000100,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,
-0x03000300,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x02000300,0x02000000,0x02000200,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,
-0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x00000200,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x03000400,0x02000300,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,0x06000600,0x03000400,
-0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,
-0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,
-0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x01000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000500,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030602,0x06020603,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06020603,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06030604,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040602,0x06020603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06010600,0x06130608,0x0617061a,0x0604060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06170605,0x06550638,0x06330653,0x06040613,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06020600,0x061a060b,0x06170620,0x0602060a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x060f0603,0x0651062d,0x06360653,0x06060619,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06020600,0x0617060a,0x0611061b,0x06010606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x060a0602,0x06490626,0x0649065c,0x060b0622,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,
-0x060e0605,0x061b0619,0x0604060f,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06010600,0x061e0607,0x06570643,0x062a064b,0x0602060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x061d0604,0x06e1066a,0x06c906ff,0x0618065b,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06070600,0x06b2062d,0x0dff09ff,0x07ff0cff,0x061c0677,0x06000603,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x062c0608,0x06ff0690,0x06c306ff,0x06140651,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06040600,0x06910621,0x0cff08ff,0x08ff0cff,0x0624069e,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x0636060b,0x06ff06a8,0x068906f6,0x0609062d,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06010600,0x065f0611,0x0bff06ff,0x0aff0dff,0x064d06ed,0x0601060f,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06150602,
-0x06bb064e,0x06e106ff,0x06220672,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x060c0601,0x06eb0647,0x0dff0aff,0x06ff0bff,0x06140660,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06020600,0x06bb0621,0x16ff0cff,0x0fff17ff,0x064e07ff,0x0601060c,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x061f0602,0x0dff06b5,0x28ff1cff,0x13ff22ff,0x064d07ff,0x0600060a,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06060600,0x06ff063c,0x17ff0fff,0x0dff17ff,0x063a06f8,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06140601,0x0bff0691,0x25ff19ff,0x16ff23ff,0x066e09ff,0x06010612,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x02000000,0x06000400,0x06000600,0x06000600,0x060a0600,0x08ff0657,0x17ff10ff,0x0aff13ff,0x061a0691,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06090600,0x08ff0648,0x23ff13ff,0x1dff28ff,0x06cd0eff,0x06040629,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x04000200,0x06000600,0x06000600,0x06010600,0x068e0615,
-0x13ff0aff,0x11ff16ff,0x066c08ff,0x06010611,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06320605,0x10ff06ff,0x28ff20ff,0x10ff20ff,0x063806ff,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x060e0600,0x0cff0683,0x32ff1fff,0x1bff2fff,0x06700aff,0x0601060f,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x063e0606,0x15ff07ff,0x36ff2dff,0x1aff2eff,0x066b0aff,0x0601060d,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x061c0601,0x0fff06c9,0x34ff25ff,0x16ff2cff,0x065008ff,0x06000609,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06290603,0x12ff06ff,0x35ff28ff,0x1eff31ff,0x06930cff,0x06010616,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06300603,0x15ff06ff,0x32ff2aff,0x11ff24ff,0x062406ea,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06120601,0x0cff0680,0x31ff1fff,0x27ff35ff,0x06ff13ff,0x06050634,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x06000300,0x06000600,0x06000600,0x06070600,0x09ff0649,
-0x2eff1aff,0x20ff31ff,0x06a60dff,0x06020619,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x0659060a,0x19ff09ff,0x36ff2dff,0x15ff2aff,0x064b07ff,0x06000609,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x061d0601,0x11ff06d9,0x34ff28ff,0x19ff2fff,0x065609ff,0x0600060b,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x063c0606,0x12ff06ff,0x2aff22ff,0x12ff22ff,0x064e07ff,0x0600060a,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06330603,0x15ff07ff,0x34ff2dff,0x14ff2aff,0x063907ff,0x06000607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x062a0604,0x10ff06e8,0x2aff20ff,0x15ff25ff,0x066309ff,0x0601060e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06580608,0x1eff0aff,0x34ff30ff,0x10ff24ff,0x061d06c5,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06110601,0x0aff0672,0x26ff18ff,0x1cff28ff,0x06c20dff,0x06040623,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x02000000,0x06000400,0x06000600,0x06000600,0x060e0600,0x0dff0687,
-0x33ff24ff,0x1eff34ff,0x06870cff,0x06010613,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,
-0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x0653060b,0x14ff08ff,0x29ff25ff,0x0fff1fff,0x063206ea,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x03000000,0x06000600,0x06000600,0x06000600,0x061d0602,0x0dff06b5,0x21ff1aff,0x0dff18ff,0x062706cc,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x061d0603,0x08ff0681,0x10ff0eff,0x07ff0cff,0x061b066b,0x06000603,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x062d0604,0x0fff06ff,0x1fff1dff,0x0aff15ff,0x06160686,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06150602,0x07ff0667,0x11ff0dff,0x08ff0eff,0x06240691,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x04000200,0x06000600,0x06000600,0x06000600,0x06550608,0x15ff09ff,0x1fff22ff,0x08ff12ff,0x060c0656,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06070600,0x06c50635,0x0fff0aff,0x0aff0fff,0x064306dd,0x0601060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x03000000,0x06000600,0x06000600,0x06000600,0x060f0600,0x0bff0681,
-0x21ff18ff,0x0fff1cff,0x063b06ff,0x06000608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06290606,0x09ff06a8,0x0fff0eff,0x06ff0cff,0x06100650,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x04000200,0x06000600,0x06000600,0x06000600,0x060f0601,0x06ff0652,0x0bff0aff,0x06ac08ff,0x06080632,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060601,0x064c061b,0x069e0689,0x063a0677,0x06040612,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06150602,0x06ff0669,0x0aff0aff,0x068407ff,0x0605061f,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x06430617,0x06a10683,0x06490685,0x06060619,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x06000600,0x062d0605,0x09ff06b8,0x0bff0cff,0x065e06ff,0x06020613,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x0628060b,0x06900660,0x065f068c,0x060b062c,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06080600,0x06db063c,
-0x0cff0aff,0x06dc09ff,0x060d0643,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06080601,0x06590626,0x06980688,0x0631066e,0x06030610,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0x06030600,0x063a0613,0x0656065b,0x06160636,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06080603,0x060e060d,0x0604060a,0x06000601,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06050600,0x063e0618,0x0650065e,0x0611062b,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06080602,0x060f060d,0x0606060c,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x06000600,0x060b0601,0x0657062a,0x065a0672,0x060d0629,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x060c0609,0x0608060b,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06020600,0x062f060e,
-0x06630656,0x061f0647,0x06010608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06090603,0x060e060e,0x0604060a,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06060602,0x06080609,0x06010604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06060602,0x06060608,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x06000600,0x06010600,0x06090604,0x0607060a,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,
-0x06090608,0x06020606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06090603,0x060c060e,0x06020606,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060b0605,0x0609060d,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06070604,0x06060609,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060602,0x060e060d,0x06020608,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06090603,0x060d060f,0x06020607,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060f0607,0x060e0612,0x06010606,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06070603,0x06050608,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060602,0x060e060d,0x06020608,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x06050606,0x06000602,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000100,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x05000200,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x01000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000500,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06060604,0x06040606,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06070604,0x06060608,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,
-0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x060d0603,0x0624061a,0x061a0624,0x0603060c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060f0604,0x06330621,0x06240635,0x06050612,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,
-0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06060601,0x0645061b,0x06930674,0x065f068c,0x060e062e,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x03000300,0x02000200,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,
-0x03000200,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,
-0x06090605,0x0608060b,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x03000300,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070601,0x065b0623,0x06e406ab,0x069606d5,0x0619064c,0x06000606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,
-0x03000300,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06290609,0x06f30674,0x09ff08ff,0x06ff08ff,0x0630067e,0x0602060e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x05000500,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,
-0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060601,0x060f060d,0x0605060b,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x03000300,0x03000300,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06130605,
-0x064d062e,0x0635064f,0x06070619,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x0630060a,0x07ff0692,0x0eff0cff,0x09ff0dff,0x065106d2,0x06040616,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060a0601,0x069e062f,0x0eff08ff,0x14ff13ff,0x0bff11ff,0x066e06ff,0x06070621,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x063a0612,0x067e066d,0x062e065f,0x0602060d,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070601,0x066d0622,
-0x07ff06ee,0x06f007ff,0x06270677,0x06010608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060600,0x06a3062a,0x12ff09ff,0x1eff1aff,0x12ff1aff,0x06c10aff,0x060c063c,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06240606,0x09ff068c,0x1cff12ff,0x23ff23ff,0x12ff1cff,0x06c50aff,0x06110640,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06130602,0x06fc0659,0x0bff09ff,0x06d909ff,0x060f0649,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x061e0604,0x08ff0682,
-0x14ff0fff,0x0fff14ff,0x069108ff,0x06070627,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060f0601,0x07ff0655,0x1eff10ff,0x30ff2cff,0x1dff2bff,0x08ff11ff,0x061f067d,0x06010606,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x0653060f,0x0fff06ff,0x2cff1dff,0x31ff33ff,0x19ff27ff,0x06ff0eff,0x0620066c,0x06010607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x062b0605,0x0cff06d2,0x1cff16ff,0x0fff18ff,0x065306ff,0x0601060d,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06410609,0x0fff06ff,
-0x27ff1dff,0x1eff28ff,0x08ff12ff,0x06190671,0x06000603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x5060164e,0xaf648463,0x9c63b164,0x405e7962,0x06000a32,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06100601,0x08ff065a,0x24ff13ff,0x3bff34ff,0x26ff35ff,0x0bff17ff,0x064506d8,0x06030611,0x07100600,0x7b62445f,0xb164a864,0x8a63a063,0x144c5460,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x405f0924,0xa0647963,0xa464b164,0x5f618363,0x06001249,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06660614,0x12ff08ff,0x33ff22ff,0x39ff3bff,0x1dff2dff,0x08ff11ff,0x06320695,0x0603060d,0x164e0600,0x8c635861,0xad64aa64,0x7d639864,0x0a323e5e,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x3c5e0924,0xa8637f62,0xa663b164,0x50608a63,0x0600144c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x062d0605,0x10ff06f5,0x2eff20ff,0x20ff2fff,0x06ff0fff,0x06090642,0x06000600,0x12490600,0x90635861,0xaf64b164,0x7962a263,0x09243a5c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x07100600,0x6b622b5a,0xa6639863,0x8e63ac63,0x2c5a6d62,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06440608,0x12ff06ff,
-0x33ff23ff,0x2fff38ff,0x0fff1eff,0x064b06ff,0x06020610,0x06000600,0x6b622257,0xad649663,0x9063ac63,0x24586962,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x9a632257,0xff65f965,0xff66ff65,0xff6bff69,0xff6eff6d,0x6f64e169,0x06000a32,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06080601,0x06e70631,0x1cff0eff,0x35ff2dff,0x28ff33ff,0x0eff1aff,0x067507ff,0x0a360624,0xd9657362,0xff65ff65,0xff69ff67,0xff6aff6a,0xf365ff67,
-0x1a52a264,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x73630a33,0xff65df65,0xff66ff66,0xff6aff67,0xff6eff6d,0x9a67f56a,0x06002257,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x0644060c,0x0eff06ff,0x2cff1dff,0x34ff35ff,0x1dff2aff,0x09ff11ff,0x064106af,0x20570614,0xf5659a64,0xff66ff65,0xff68ff67,0xff69ff69,0xe165ff67,0x0c3b7763,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x6f620c3b,0xff64dd64,0xff65ff64,0xff6aff67,0xff6eff6c,0xa067f569,0x06002257,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06160602,0x0bff0690,0x31ff1bff,0x33ff39ff,0x0eff1fff,0x062e06e4,0x24580605,0xf7649a63,0xff65ff64,0xff69ff68,0xff68ff69,0xdf64ff66,0x0a326f62,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0xc4644b60,0xff65ff65,0xff67ff65,0xff6cff6a,0xff6aff6e,0x4460c368,0x06000710,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06210604,0x0cff06af,
-0x2fff1cff,0x34ff38ff,0x17ff26ff,0x06b60bff,0x06090633,0xc164415e,0xff65fd65,0xff68ff66,0xff6aff69,0xff65ff68,0x415ebd64,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x5b610600,0xff66e965,0xff67ff66,0xff70ff6b,0xff7bff77,0xff82ff7f,0xff80ff83,0x2c64d676,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06040603,0x06090606,0x0611060c,0x061b0616,0x065b0624,0x0eff06ff,0x22ff18ff,0x21ff25ff,0x0fff18ff,0x06a708ff,0xd2642c60,0xff68ff65,0xff70ff6d,0xff79ff76,0xff79ff79,0xff74ff78,
-0xed68ff6e,0x06005962,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0x2a5b0600,0xff66cc65,0xff67ff66,0xff6eff6a,0xff79ff74,0xff81ff7e,0xff81ff82,0x5c6ef179,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06030602,0x06070605,0x0611060b,0x062b0618,0x07ff066c,0x19ff0fff,0x24ff21ff,0x17ff20ff,0x08ff0fff,0x064d06b9,0xef655c62,0xff69ff66,0xff71ff6e,0xff79ff76,0xff79ff7b,0xff72ff77,0xd466ff6e,0x06002e5c,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0x2c5a0600,0xff65d964,0xff66ff65,0xff6eff6a,0xff7bff75,0xff82ff7f,0xff82ff85,0x5e6eef79,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06020601,0x06050603,0x06090607,0x060d060b,0x0611060e,0x06180614,0x06ca0638,0x1cff0cff,0x33ff2fff,0x1aff29ff,0x06b20cff,0xf3655c62,0xff6aff66,0xff73ff6e,0xff79ff77,0xff7bff7c,0xff71ff77,0xc865ff6d,0x06002c5a,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,
-0x98630e41,0xff65ff65,0xff68ff66,0xff73ff6d,0xff7eff79,0xff83ff82,0xff7dff83,0x0e459774,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06050603,0x060a0608,0x060f060d,0x06130610,0x061d0615,0x06dc0642,
-0x19ff0cff,0x2aff26ff,0x1aff25ff,0x07ff0fff,0xa0641066,0xff67fd65,0xff70ff6c,0xff78ff74,0xff7bff7b,0xff75ff79,0xff69ff70,0x0c3b9664,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0xfb657a63,0xff66ff66,0xff70ff6a,0xff80ff78,0xff8dff87,0xff95ff91,0xff97ff97,0xe58cff95,0x06002e76,
-0x06020601,0x06020602,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x060e0608,0x06260616,0x064e0639,0x067d0669,0x06a7068e,0x06bd06bb,0x06ae06b4,0x06ff06b9,0x0eff09ff,0x13ff13ff,0x0cff11ff,0x326e08ff,0xff68e965,0xff76ff6e,0xff85ff7f,0xff8cff8a,0xff8fff8e,0xff8cff8e,
-0xff7eff87,0x7064ff70,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x06000600,0xef65305c,0xff66ff66,0xff6eff68,0xff7eff76,0xff8aff85,0xff93ff8f,0xff97ff96,0xff8eff96,0x06037880,0x06040604,0x06030604,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06020600,0x06090605,0x061a0611,0x063c062b,0x066a064f,0x06a20685,0x06cd06c0,0x06e406cd,0x0aff07ff,0x12ff0eff,0x0fff12ff,0x07ff0bff,0x706506ad,0xff69ff65,0xff78ff70,0xff85ff80,0xff8cff8a,0xff8fff8e,0xff8bff8d,0xff79ff85,0x325cef6c,0x06000600,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x06000600,0xe965335c,0xff65ff65,0xff6eff68,0xff7fff77,0xff8bff86,0xff93ff90,0xff99ff97,0xff8fff98,0x06007081,0x06000600,0x06000600,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060602,0x06150612,0x0603060a,0x06000600,0x06000600,0x06010600,
-0x060c0604,0x06260617,0x06470638,0x066e0659,0x067d0679,0x0685067f,0x06870689,0x069f068a,0x0bff06ff,0x21ff14ff,0x21ff26ff,0x746e16ff,0xff6aff65,0xff7bff71,0xff88ff83,0xff8fff8c,0xff90ff90,0xff8bff8f,0xff79ff84,0x335ce96b,0x06000600,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x12490600,
-0xff65bc64,0xff67ff66,0xff73ff6c,0xff83ff7c,0xff8fff8a,0xff96ff93,0xff98ff98,0xbc86ff93,0x06000a43,0x06010600,0x06010601,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000601,0x06000600,0x06010600,0x060b0604,0x06260615,0x06460635,0x066d065c,0x068f0682,0x06a10699,0x0699069c,0x06a00697,
-0x09ff06ed,0x16ff0fff,0x16ff19ff,0x0cff11ff,0xff67bc66,0xff73ff6c,0xff84ff7d,0xff8cff89,0xff8fff8e,0xff8dff8f,0xff82ff8a,0xbe68ff75,0x06000a32,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x4f610600,0xff66fd65,0xff6cff67,0xff7eff74,0xff8dff86,0xff99ff93,0xffa2ff9e,0xffa7ffa5,0xffa6ffa8,0x1873e198,
-0x060e060c,0x0609060c,0x06030606,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x0629060e,0x068d0656,0x07ff06db,0x0aff08ff,0x0dff0cff,0x0eff0dff,0x0dff0eff,0x0bff0cff,0x08ff09ff,0x07ff07ff,0x09ff08ff,0x08ff09ff,0xdd65129b,0xff73ff6a,0xff88ff80,0xff95ff90,0xff9bff99,0xff9eff9d,0xff9dff9e,
-0xff95ff9a,0xff78ff8b,0x06004f64,0x06000600,0x06000600,0x06000600,0x03000600,0x03000000,0x06000600,0x06000600,0x06000600,0x144d0600,0xff66e565,0xff69ff66,0xff7bff71,0xff8bff83,0xff97ff92,0xffa0ff9c,0xffa6ffa4,0xffa6ffa8,0x518bff9d,0x06160618,0x060c0611,0x06030607,0x06000602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x062d060f,0x067e064e,0x06f306af,0x08ff07ff,0x0dff0bff,0x0eff0eff,0x0fff0fff,0x0cff0dff,0x08ff0aff,0x08ff08ff,0x07ff08ff,0x06cb06ff,0xfd654b67,0xff77ff6b,0xff8aff82,0xff96ff91,0xff9cff9a,0xff9eff9d,0xff9dff9e,0xff93ff99,0xe172ff86,0x0600144d,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x144c0600,0xff65e165,0xff69ff66,0xff7cff72,0xff8cff84,0xff98ff92,0xffa1ff9d,0xffa8ffa5,0xffa8ffaa,0x478dff9e,0x06010600,0x06030602,0x06030603,0x06020602,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060602,0x06400612,0x06be06a9,0x061c065e,0x06000604,0x06000600,0x06090601,
-0x064b0621,0x06ca0686,0x07ff06ff,0x09ff08ff,0x0aff0aff,0x09ff0aff,0x09ff09ff,0x08ff08ff,0x08ff08ff,0x11ff0bff,0x1cff18ff,0xfd65559c,0xff79ff6d,0xff8dff85,0xff98ff93,0xff9eff9b,0xffa0ffa0,0xff9dff9f,0xff93ff99,0xdd70ff85,0x06001249,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x9a640600,
-0xff66ff66,0xff6eff68,0xff81ff79,0xff90ff89,0xff9bff96,0xffa3ffa0,0xffa9ffa7,0xffa3ffa8,0x07179f93,0x06070605,0x06060607,0x06030604,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060d0603,0x060a0613,0x06000601,0x060d0602,0x065f062c,0x06ff06a9,0x08ff07ff,0x0bff0aff,0x0cff0bff,0x0bff0cff,0x0aff0bff,0x08ff09ff,
-0x07ff07ff,0x0aff07ff,0x0eff0cff,0x9e6b0eff,0xff6eff68,0xff87ff7d,0xff93ff8e,0xff9bff98,0xff9fff9e,0xff9fff9f,0xff97ff9c,0xff80ff8f,0x0600926b,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0xdb650d39,0xff66ff66,0xff77ff6c,0xff8aff81,0xff97ff91,0xffa3ff9d,0xffacffa7,0xffb4ffb0,0xffb5ffb5,0x96a1ffb2,
-0x061b061d,0x06100616,0x0607060b,0x06020604,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06120606,0x06cd0648,0x0dff09ff,0x15ff11ff,0x1bff18ff,0x1eff1dff,0x1cff1dff,0x17ff1aff,0x11ff14ff,0x0bff0eff,0x07ff09ff,0x06d306ff,0x079006bb,0xff698965,0xff86ff77,0xff97ff90,0xffa2ff9d,0xffa8ffa5,0xffabffaa,0xffabffab,
-0xffa6ffa9,0xff93ffa0,0x0f41e179,0x06000600,0x06000600,0x06000600,0x03000600,0x04000200,0x06000600,0x06000600,0x06000600,0x9a640702,0xff66ff66,0xff73ff69,0xff87ff7e,0xff95ff8e,0xffa1ff9c,0xffaaffa6,0xffb2ffaf,0xffb6ffb4,0xe7a6ffb2,0x062f1380,0x06160622,0x0607060d,0x06010603,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06040600,0x07ff0682,0x0eff0aff,0x14ff11ff,0x1bff17ff,0x21ff1fff,0x20ff21ff,0x1bff1eff,0x13ff17ff,0x0cff0fff,0x07ff09ff,0x069f06d8,0x13630681,0xff6cdf65,0xff88ff7b,0xff98ff91,0xffa2ff9e,0xffa8ffa6,0xffabffaa,0xffaaffab,0xffa4ffa8,0xff8eff9d,0x07009a73,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0x98630700,0xff66ff65,0xff73ff69,0xff87ff7e,0xff96ff8f,0xffa2ff9c,0xffabffa7,0xffb3ffaf,0xffb8ffb6,0xe3a8ffb4,0x0602106b,0x06040604,0x06050605,0x06030604,0x06020602,0x06010601,0x06000601,0x06000600,0x06010600,0x06030601,0x06190607,0x07ff0659,0x10ff0fff,0x066c08ff,0x06010611,0x06000600,0x06170603,
-0x06c10655,0x0aff07ff,0x0fff0dff,0x11ff10ff,0x11ff11ff,0x0fff10ff,0x0cff0dff,0x0bff0bff,0x0aff0aff,0x0bff0aff,0x15ff0dff,0xff6de168,0xff8bff7e,0xff9bff93,0xffa5ffa1,0xffaaffa8,0xffacffac,0xffabffac,0xffa4ffa8,0xff8cff9c,0x0600986e,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0xfd653e5e,
-0xff68ff66,0xff79ff6e,0xff8cff84,0xff9aff93,0xffa5ffa0,0xffaeffaa,0xffb5ffb2,0xffb5ffb6,0x4695ffad,0x060c060b,0x060a060c,0x06060608,0x06020604,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x06620615,0x063c0684,0x0601060a,0x062c0607,0x07ff0696,0x0fff0bff,0x15ff12ff,0x18ff17ff,0x16ff17ff,0x13ff15ff,0x0fff11ff,0x0bff0dff,
-0x08ff09ff,0x07ff07ff,0x07ff06ff,0xff664b72,0xff82ff72,0xff96ff8e,0xffa1ff9c,0xffa8ffa5,0xffabffaa,0xffabffac,0xffa7ffaa,0xff98ffa2,0x4667ff83,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x07000600,0xff666b61,0xff6aff66,0xff82ff76,0xff93ff8b,0xffa0ff9a,0xffabffa6,0xffb5ffb0,0xffbdffb9,0xffc2ffc0,0xf5b6ffc0,
-0x0619228c,0x060f0614,0x0607060a,0x06020604,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060b0601,0x062d0619,0x0aff06a5,0x1aff12ff,0x25ff20ff,0x29ff28ff,0x27ff29ff,0x20ff24ff,0x17ff1cff,0x0fff13ff,0x09ff0cff,0x06e207ff,0x068406ab,0x1c5c0667,0xff75f765,0xff93ff87,0xffa3ff9d,0xffacffa8,0xffb2ffb0,0xffb5ffb4,0xffb6ffb6,
-0xffb3ffb6,0xffa7ffaf,0x6374ff93,0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x06000600,0xf3651a4c,0xff68ff66,0xff7eff72,0xff90ff88,0xff9eff98,0xffa9ffa4,0xffb3ffae,0xffbbffb8,0xffc1ffbf,0xffb9ffc2,0x072667a6,0x06160622,0x0607060d,0x06020604,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x060c0600,0x16ff07ff,0x24ff1eff,0x2eff2aff,0x31ff30ff,0x31ff32ff,0x28ff2dff,0x1dff23ff,0x12ff17ff,0x0aff0dff,0x06da07ff,0x06640693,0x6b610736,0xff7bff6a,0xff95ff8b,0xffa4ff9e,0xffadffa9,0xffb3ffb0,0xffb6ffb4,0xffb6ffb6,0xffb2ffb5,0xffa3ffad,0x1c58f38c,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x06000600,0xf9651849,0xff68ff66,0xff7eff72,0xff91ff88,0xff9eff98,0xffaaffa4,0xffb4ffaf,0xffbcffb8,0xffc2ffc0,0xffbcffc3,0x07016ba5,0x06030603,0x06040604,0x06030603,0x06020602,0x06010601,0x06000601,0x06000600,0x06010601,0x06050602,0x0632060e,0x0eff06bf,0x22ff22ff,0x06cc0fff,0x06030620,0x06000600,0x061e0604,
-0x06ed0669,0x0cff09ff,0x11ff0fff,0x11ff11ff,0x0fff10ff,0x0cff0dff,0x09ff0bff,0x07ff08ff,0x06ff07ff,0x07ff06ff,0x6f6b07ff,0xff7eff6c,0xff99ff8f,0xffa7ffa1,0xffafffac,0xffb4ffb2,0xffb7ffb6,0xffb6ffb7,0xffb2ffb5,0xffa1ffac,0x1c56f988,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,0x07000600,0xff66b664,
-0xff6eff67,0xff85ff79,0xff95ff8e,0xffa3ff9d,0xffadffa8,0xffb7ffb2,0xffbeffb9,0xffc3ffc1,0xb6b0ffbf,0x060a0708,0x0609060a,0x06050607,0x06020604,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060d0603,0x07ff0642,0x069808ff,0x0603061a,0x064b060c,0x0bff06f1,0x15ff10ff,0x1bff19ff,0x1bff1cff,0x17ff1aff,0x12ff15ff,0x0cff0fff,0x08ff0aff,
-0x06ff07ff,0x06bd06d6,0x078706ae,0xff70b765,0xff91ff84,0xffa2ff9b,0xffacffa8,0xffb2ffb0,0xffb6ffb4,0xffb7ffb7,0xffb4ffb6,0xffa9ffb0,0xb37fff9c,0x06000700,0x06000600,0x06000600,0x03000600,0x00000000,0x06000300,0x06000600,0x06000600,0x08000600,0xff66b764,0xff73ff68,0xff8aff80,0xff9bff93,0xff6cff9e,0xff85ff56,0xffbcffb7,0xffc5ffc1,0xffccffc9,0xffc8ffcc,
-0x070a67ae,0x0608060b,0x06040606,0x06010602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x061e0603,0x063b0636,0x0bff06c0,0x1dff15ff,0x25ff22ff,0x23ff25ff,0x1dff21ff,0x15ff19ff,0x0eff11ff,0x08ff0aff,0x06b706ff,0x0656067b,0x062d063f,0x6860071a,0xff85ff6d,0xff9fff93,0xffadffa7,0xffb6ffb2,0xff5bff8e,0xffb9ff75,0xffc0ffc0,
-0xffbeffc0,0xffb5ffbb,0xb78dffa9,0x06000800,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x06000600,0xff666d61,0xff6eff67,0xff87ff7c,0xff98ff90,0xff7cff9f,0xff6eff53,0xffbbffb1,0xffc3ffbf,0xffcbffc7,0xffc9ffcd,0x0812b7b9,0x060d0614,0x06040608,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06170600,0x24ff0eff,0x33ff2eff,0x36ff36ff,0x32ff35ff,0x2aff2fff,0x1eff25ff,0x13ff18ff,0x0aff0eff,0x06e307ff,0x065c0693,0x06240639,0xbb64080f,0xff8aff75,0xffa1ff97,0xffaeffa8,0xffb1ffb2,0xff56ff73,0xffbfff8c,0xffc0ffc0,0xffbdffbf,0xffb2ffb9,0x707fffa2,0x06000600,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x07000600,0xff666b60,0xff6eff67,0xff87ff7b,0xff98ff90,0xff7dffa0,0xff70ff4f,0xffbbffb1,0xffc4ffc0,0xffccffc8,0xffcbffce,0x0800bbbc,0x06010601,0x06010601,0x06010601,0x06010601,0x06000600,0x06000600,0x06000600,0x06010600,0x06040602,0x0632060e,0x10ff06cd,0x25ff28ff,0x06c70fff,0x0603061e,0x06000600,0x06120602,
-0x06980644,0x08ff06ff,0x0aff09ff,0x09ff0aff,0x07ff08ff,0x06f506ff,0x06ae06cf,0x0678068b,0x065c0668,0x06580657,0xb565083e,0xff8eff78,0xffa5ff9b,0xffb1ffac,0xffb6ffb5,0xff5cff7c,0xffc0ff93,0xffc1ffc1,0xffbdffc0,0xffb0ffb9,0x5e7cffa0,0x06000700,0x06000600,0x06000600,0x03000600,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x1d4b0600,0xff66f965,
-0xff77ff6b,0xff8eff83,0xff9dff96,0xff5fff92,0xffa1ff66,0xffbeffb9,0xffc7ffc2,0xffcdffca,0xf9c2ffcc,0x06051b7f,0x06040604,0x06020603,0x06010602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06130604,0x0bff0664,0x06c80dff,0x06030620,0x0641060a,0x09ff06cf,0x11ff0eff,0x13ff13ff,0x12ff13ff,0x0eff10ff,0x09ff0cff,0x06ff07ff,0x069d06cd,
-0x06590676,0x063f0649,0x194d0636,0xff7ff968,0xff9dff92,0xffacffa6,0xffb5ffb1,0xff68ffa1,0xffa7ff63,0xffc0ffc0,0xffbfffc0,0xffb7ffbc,0xfb95ffad,0x06001750,0x06000600,0x06000600,0x04000600,0x00000200,0x06000300,0x06000600,0x06000600,0x07000600,0xff66e765,0xff7cff6e,0xff92ff88,0xffa2ff9a,0xff08ff3c,0xff0cff09,0xffc3ff7f,0xffccffc8,0xffd4ffd1,0xffd4ffd6,
-0x080296c1,0x06020603,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x062b0604,0x062d0641,0x07ff0679,0x11ff0dff,0x14ff14ff,0x12ff14ff,0x0dff0fff,0x08ff0aff,0x06d106ff,0x06670693,0x062d0647,0x0613061d,0x0608060d,0x96630803,0xff92ff79,0xffa9ff9f,0xffb6ffb0,0xff82ffbb,0xff0aff0b,0xff46ff0a,0xffc9ffc8,
-0xffc7ffc9,0xffc0ffc5,0xea9cffb6,0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x07000600,0xff669963,0xff77ff6b,0xff8fff84,0xff9fff98,0xff08ff6e,0xff0aff09,0xffc1ff46,0xffcaffc6,0xffd3ffcf,0xffd5ffd6,0x0806e7c9,0x06040607,0x06010602,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06190600,0x21ff0dff,0x2aff27ff,0x26ff29ff,0x1eff22ff,0x16ff19ff,0x0dff12ff,0x07ff0aff,0x06a006f2,0x0641066b,0x06160626,0x0607060d,0xe7690802,0xff96ff82,0xffabffa2,0xffb6ffb1,0xff45ffbb,0xff0aff09,0xff86ff0d,0xffc8ffc8,0xffc7ffc8,0xffbeffc4,0x9093ffb1,0x06000700,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x08000600,0xff669c62,0xff76ff6a,0xff8eff84,0xff9fff97,0xff09ff71,0xff0aff09,0xffc2ff46,0xffcbffc7,0xffd4ffd0,0xffd6ffd6,0x0800e7cb,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x061a0607,0x0bff0677,0x14ff19ff,0x066708ff,0x0601060f,0x06000600,0x06050600,
-0x06320616,0x06720656,0x067f067f,0x0676067b,0x06560668,0x06390646,0x0621062d,0x06150619,0x060d0611,0x060b060c,0xea6a0807,0xff9aff86,0xffaeffa6,0xffb9ffb5,0xff49ffbd,0xff0aff09,0xff87ff0a,0xffcaffc9,0xffc7ffc9,0xffbcffc3,0x988fffaf,0x06000800,0x06000600,0x06000600,0x03000600,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x415b0600,0xff67ff66,
-0xff80ff71,0xff95ff8b,0xff96ff9d,0xff08ff13,0xff1cff09,0xffc5ffb0,0xffceffc9,0xffd5ffd2,0xffd1ffd6,0x070149b0,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060e0602,0x0aff0655,0x06970cff,0x06020616,0x061c0603,0x06be0660,0x07ff06ff,0x08ff08ff,0x06ff07ff,0x06d506ff,0x067606a2,0x06420657,0x0620062e,
-0x06100616,0x060a060d,0x4b5c0706,0xff8cff71,0xffa8ff9d,0xffb5ffaf,0xffadffb9,0xff09ff13,0xff14ff0a,0xffc9ffb6,0xffc8ffc9,0xffc2ffc6,0xffa8ffb9,0x0700417c,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x0d280600,0xff68f765,0xff83ff73,0xff98ff8f,0xffa3ffa0,0xff09ff09,0xff0bff0a,0xffcaff49,0xffd3ffce,0xffdcffd8,0xffddffdf,
-0x0800a2cc,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06200603,0x0613062c,0x06770629,0x06ff06d0,0x06ff06ff,0x06f106ff,0x068d06b9,0x064b066c,0x06210632,0x060f0616,0x06050609,0x06020603,0x06000601,0xa9690800,0xff9bff86,0xffb2ffa8,0xffbeffb9,0xff3effc2,0xff0bff0a,0xff0cff0b,0xffd1ffd0,
-0xffd0ffd1,0xffcaffce,0xf2abffc1,0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x08000600,0xff66a763,0xff7eff6e,0xff95ff8b,0xffa6ff9e,0xff09ff38,0xff0bff0a,0xffc2ff10,0xffd1ffcc,0xffdaffd6,0xffddffdd,0x0801f6d5,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06100600,0x11ff08ff,0x13ff13ff,0x10ff12ff,0x0bff0dff,0x07ff09ff,0x06a306ec,0x064d0673,0x061c062e,0x06090610,0x06020605,0x06000601,0xf86e0800,0xff9fff8d,0xffb3ffab,0xffbeffb9,0xff10ffc3,0xff0bff0b,0xff4bff0b,0xffd1ffd0,0xffd0ffd1,0xffc9ffce,0xa6a0ffbe,0x06000800,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x08000600,0xff66af63,0xff7eff6e,0xff95ff8b,0xffa5ff9e,0xff09ff3b,0xff0bff0a,0xffc8ff11,0xffd2ffcd,0xffdbffd6,0xffdfffdf,0x0800f2d6,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070601,0x06a90627,0x07ff08ff,0x061e0678,0x06000604,0x06000600,0x06000600,
-0x06070603,0x0612060d,0x06110613,0x06100611,0x0609060b,0x06050607,0x06030604,0x06010602,0x06000601,0x06000600,0xf2710800,0xffa4ff91,0xffb7ffaf,0xffc2ffbd,0xff0affbc,0xff0bff0b,0xff49ff0b,0xffd1ffd1,0xffd0ffd1,0xffc7ffcd,0xaf9cffbb,0x06000800,0x06000600,0x06000600,0x03000600,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x545e0600,0xff6bff66,
-0xff87ff79,0xff9bff92,0xff71ffa3,0xff09ff08,0xff0bff0a,0xffcbff85,0xffd5ffd0,0xffddffd9,0xffdaffdf,0x080057bc,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06060601,0x06e8062b,0x063f06fa,0x06000609,0x06060600,0x062b0615,0x064b063e,0x0646064f,0x0634063e,0x06210629,0x060f0617,0x0608060b,0x06030605,
-0x06010602,0x06000601,0x575c0800,0xff97ff7c,0xffb0ffa6,0xffbdffb8,0xff83ffc2,0xff0bff0a,0xff0bff0b,0xffd1ff8c,0xffd1ffd1,0xffccffcf,0xffb5ffc5,0x0700568c,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x0a0a0600,0xff6beb65,0xff89ff79,0xff9eff95,0xffadffa6,0xff0aff2c,0xff0cff0b,0xffcfff70,0xffd9ffd4,0xffe3ffdf,0xffe5ffe7,
-0x08009ad3,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x060e0601,0x06040610,0x06140606,0x062e0623,0x062f0632,0x061f0629,0x06130619,0x0608060c,0x06030605,0x06010602,0x06000600,0x06000600,0x06000600,0xa06c0800,0xffa3ff8e,0xffb9ffb0,0xffc5ffc0,0xff72ffc9,0xff0cff0b,0xff39ff0c,0xffd8ffd6,
-0xffd8ffd9,0xffd3ffd6,0xe7b4ffca,0x06000700,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x07000600,0xff679a63,0xff84ff73,0xff9bff91,0xffacffa4,0xff0aff5f,0xff0cff0b,0xffcbff35,0xffd8ffd3,0xffe1ffdc,0xffe6ffe5,0x0800eadd,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06070600,0x06ed0670,0x06eb06ff,0x06a606d1,0x06640681,0x062e0644,0x06170620,0x0609060f,0x06020604,0x06000601,0x06000600,0x06000600,0xf0740800,0xffa7ff95,0xffbbffb3,0xffc6ffc1,0xff34ffca,0xff0cff0c,0xff78ff0c,0xffd8ffd8,0xffd8ffd9,0xffd2ffd6,0xa2a9ffc6,0x06000700,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x07000600,0xff679462,0xff83ff73,0xff9bff90,0xffabffa3,0xff0aff62,0xff0bff0b,0xffceff3c,0xffd8ffd3,0xffe2ffdd,0xffe7ffe6,0x0800e7dd,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x061e0606,0x063e0646,0x06040615,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06010600,0x06010601,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0xf0770800,0xffabff9a,0xffbeffb6,0xffc9ffc4,0xff3affcc,0xff0cff0c,0xff75ff0c,0xffd9ffd8,0xffd8ffd9,0xffd0ffd5,0x9ea5ffc3,0x06000700,0x06000600,0x06000600,0x03000600,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x465e0600,0xff6eff66,
-0xff8dff7e,0xffa1ff98,0xff93ffa8,0xff0aff10,0xff0fff0b,0xffd1ffac,0xffdbffd6,0xffe5ffe0,0xffe1ffe7,0x07004dbf,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x0635060b,0x060c0636,0x06000601,0x06000600,0x06040602,0x06080606,0x06070608,0x06040606,0x06020603,0x06010601,0x06000600,0x06000600,
-0x06000600,0x06000600,0x475c0700,0xffa0ff84,0xffb8ffae,0xffc5ffbf,0xffadffc9,0xff0cff10,0xff11ff0c,0xffd9ffb8,0xffd9ffd9,0xffd4ffd6,0xffbdffce,0x06004f93,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x06000600,0x08000600,0xff6dc064,0xff8dff7e,0xffa3ff99,0xffb2ffab,0xff55ffa6,0xff7bff40,0xffd5ffce,0xffe0ffda,0xffeaffe5,0xffeaffed,
-0x080074d4,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x06000603,0x06010600,0x06040603,0x06040604,0x06020603,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x766c0800,0xffa9ff92,0xffc0ffb7,0xffccffc7,0xffd0ffd0,0xff41ff7b,0xffc9ff63,0xffe0ffdd,
-0xffe0ffe0,0xffdbffdf,0xbeb8ffd1,0x06000800,0x06000600,0x06000600,0x03000600,0x06000300,0x06000600,0x06000600,0x07000600,0xff696a60,0xff89ff77,0xffa0ff96,0xffb1ffa9,0xff6bffb5,0xff57ff41,0xffd3ffb9,0xffddffd9,0xffe8ffe3,0xffecffec,0x0800c4e0,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06010600,0x0620060f,0x061f0623,0x06130619,0x060a060d,0x06040606,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0xc6780800,0xffaeff9a,0xffc1ffb9,0xffccffc7,0xffc0ffd1,0xff42ff62,0xffdbff79,0xffe0ffdf,0xffe0ffe0,0xffd9ffdd,0x73aaffcd,0x06000700,0x06000600,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x06000600,0x07000600,0xff697161,0xff88ff76,0xffa0ff95,0xffb0ffa8,0xff70ffb5,0xff59ff3a,0xffd4ffbd,0xffddffd9,0xffe8ffe3,0xffecffec,0x0800cae1,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06040605,0x06000601,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0xc87b0800,0xffb1ff9e,0xffc5ffbd,0xffd0ffcb,0xffc2ffd3,0xff44ff61,0xffdaff7c,0xffe0ffdf,0xffdfffe0,0xffd6ffdd,0x71a8ffca,0x06000700,0x06000600,0x06000600,0x03000600,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x214d0600,0xff70ff65,
-0xff91ff83,0xffa6ff9c,0xffb5ffae,0xff42ff92,0xff9cff48,0xffd6ffd2,0xffe2ffdc,0xffebffe7,0xffe8ffed,0x060025aa,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06070601,0x06010607,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x1d490600,0xffa5ff86,0xffbfffb5,0xffcbffc6,0xffd4ffd0,0xff51ffa9,0xffa8ff50,0xffe0ffdf,0xffe0ffe0,0xffdcffdf,0xfbc1ffd5,0x06001d78,0x06000600,0x06000600,0x06000600,0x00000300,0x06000300,0x06000600,0x07000600,0x08000700,0xff6d7b60,0xff91ff80,0xffa7ff9d,0xffb7ffb0,0xffc4ffbe,0xffd0ffca,0xffdbffd5,0xffe6ffe0,0xfff0ffeb,0xffedfff3,
-0x09052fb7,0x08b70800,0x060007db,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x2a590900,0xffacfd90,0xffc6ffbc,0xffd2ffcd,0xffdaffd6,0xffe0ffdd,0xffe4ffe2,0xffe6ffe5,
-0xffe7ffe7,0xffe1ffe5,0x7fb5ffd4,0x07000700,0x06000700,0x06000600,0x03000600,0x06000300,0x06000600,0x07000600,0x09000800,0xff672951,0xff8cff79,0xffa5ff9a,0xffb5ffae,0xffc2ffbc,0xffceffc8,0xffd9ffd4,0xffe4ffdf,0xffefffe8,0xfff0fff2,0x090076da,0x08030800,0x06000704,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06020601,0x06020602,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x83730900,0xffb2ff9c,0xffc7ffbf,0xffd3ffce,0xffdaffd6,0xffe0ffdd,0xffe4ffe2,0xffe6ffe5,0xffe7ffe7,0xffdfffe5,0x2f93ffce,0x08000900,0x06000700,0x06000600,0x03000600,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x06000300,0x06000600,0x07000700,0x08000700,0xfd662550,0xff8bff78,0xffa4ff99,0xffb4ffad,0xffc2ffbb,0xffceffc8,0xffd9ffd4,0xffe4ffdd,0xffefffea,0xfff0fff2,0x08007ada,0x08010700,0x06000702,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07010601,0x07020802,0x76790803,0xffb5ffa0,0xffcbffc3,0xffd6ffd1,0xffddffda,0xffe2ffdf,0xffe5ffe3,0xffe7ffe6,0xffe6ffe7,0xffddffe4,0x2d91fdcb,0x07000800,0x07000700,0x06000600,0x03000600,0x00000000,0x00000000,0x06000300,0x06000600,0x07000700,0x09000700,0xff71ca64,
-0xff95ff86,0xffaaffa1,0xffb9ffb2,0xffc6ffc0,0xffd2ffcc,0xffddffd6,0xffe8ffe2,0xfff2ffed,0xd0e7fff3,0x0835092e,0x08000800,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x08010700,0x09020801,0xffa8cc85,0xffc4ffb9,0xffd2ffcc,0xffdaffd6,0xffe0ffdd,0xffe4ffe2,0xffe6ffe5,0xffe7ffe7,0xffe2ffe6,0xccc1ffd9,0x07030902,0x07000700,0x06000600,0x04000600,0x00000200,0x06000300,0x06000600,0x08000600,0x08000900,0xf3683e22,0xff93ff80,0xffabffa1,0xffbcffb4,0xffc9ffc3,0xffd5ffcf,0xffe1ffdb,0xffecffe6,0xfff6fff1,0xb8e2fff7,
-0x0b04282c,0x09a70b08,0x060007db,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x07030602,0x0b070905,0x32020b0c,0xffaeb888,0xffcbffc0,0xffd8ffd2,0xffe0ffdd,0xffe6ffe3,0xffeaffe8,0xffedffec,
-0xffeeffee,0xffe4ffeb,0x4240f3d1,0x09000704,0x06000800,0x06000600,0x03000600,0x04000200,0x06000600,0x08000600,0x0a000b00,0xba602b00,0xff8eff77,0xffa8ff9d,0xffb9ffb2,0xffc7ffc1,0xffd3ffcd,0xffdfffd9,0xffeaffe4,0xfff5fff0,0xf3effff6,0x0b024b5c,0x09030b00,0x06000704,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07010600,0x0b030902,0x472a0b06,0xffb4f396,0xffcdffc3,0xffd9ffd3,0xffe0ffdd,0xffe6ffe3,0xffebffe8,0xffedffec,0xffedffee,0xffe0ffea,0x2701bdc0,0x0b010a00,0x06000801,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x04000200,0x06000600,0x08000700,0x09000800,0xba5f2c00,0xff8cff76,0xffa7ff9b,0xffb9ffb1,0xffc7ffc0,0xffd3ffcd,0xffddffd9,0xffeaffe4,0xfff5fff0,0xf3f0fff7,0x09013d62,0x0b010900,0x06000801,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x06010603,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06060603,0x060f060a,0x071a0616,0x0921091a,0x3b2d0926,0xffb8f19a,0xffd0ffc7,0xffdcffd6,0xffe3ffe0,0xffe8ffe6,0xffecffea,0xffeeffed,0xffecffee,0xffddffe8,0x2a00b6c0,0x08010900,0x07000801,0x06000600,0x02000400,0x00000000,0x00000000,0x06000300,0x06000600,0x09000800,0x09000800,0xff708d46,
-0xff97ff86,0xffaeffa4,0xffbeffb6,0xffcbffc5,0xffd6ffd1,0xffe2ffdd,0xffeeffe8,0xfff7fff3,0x85a5fff3,0x0b280b5e,0x09950b19,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06040602,
-0x060c0607,0x0b0f080d,0x0b1c0b14,0xffa6835f,0xffc9ffbd,0xffd6ffd1,0xffe0ffdc,0xffe6ffe3,0xffeaffe8,0xffedffec,0xffedffee,0xffe7ffec,0x8d84ffdb,0x08020909,0x08000900,0x06000600,0x03000600,0x00000000,0x04000200,0x06000600,0x08000600,0x09000a00,0xd7310900,0xff92ff79,0xffaeffa2,0xffc0ffb7,0xffceffc7,0xffdbffd4,0xffe6ffe0,0xfff2ffec,0xfffafff7,0xbd3cfeea,
-0x0b00171e,0x070e090a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06120608,0x063c0624,0x0958074c,0x19360b76,0xffa1c924,0xffceffbf,0xffddffd6,0xffe6ffe2,0xffecffe8,0xfff0ffee,0xfff3fff2,
-0xfff3fff3,0xffe4ffef,0x0904df68,0x0a000903,0x06000800,0x06000600,0x02000400,0x03000000,0x06000600,0x07000600,0x0b000900,0xb6131700,0xff8cfe6c,0xffabff9d,0xffbdffb5,0xffccffc5,0xffd9ffd2,0xffe4ffdd,0xfff0ffea,0xfffafff6,0xd779fff3,0x0b010b02,0x08030b02,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06060603,0x061a060e,0x0b2a0820,0x0b6e0b47,0xffb0dd49,0xffd0ffc4,0xffddffd8,0xffe6ffe3,0xffecffe8,0xfff1ffef,0xfff3fff3,0xfff2fff3,0xfed1ffed,0x1703bf24,0x09020b01,0x06000701,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x09000700,0xbd111500,0xff8aff68,0xffa9ff9c,0xffbcffb4,0xffcbffc4,0xffd8ffd2,0xffe4ffdd,0xfff0ffea,0xfffafff6,0xd583fff9,0x0b010b01,0x09000b00,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06050600,0x063e061a,0x061e063c,
-0x0606060d,0x06020603,0x06020602,0x06040603,0x06090606,0x0618060f,0x06390623,0x06780656,0x06e806aa,0x0bb108c2,0x451c0bcd,0xffb6d852,0xffd3ffc8,0xffe1ffdb,0xffe8ffe5,0xffeeffec,0xfff2fff0,0xfff3fff3,0xfff1fff3,0xfecdffeb,0x1303ba29,0x07020901,0x06000601,0x06000600,0x00000300,0x00000000,0x00000000,0x06000300,0x06000600,0x09000700,0x09000900,0xee558a02,
-0xff97ff82,0xffb1ffa6,0xffc2ffb9,0xffd0ffc9,0xffdcffd6,0xffe8ffe2,0xfff3ffee,0xfff9fff8,0x8d1beac3,0x0b480b35,0x06120aff,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06040604,0x06000601,0x06000600,0x06000600,0x06000600,0x06010600,0x06030602,0x060d0606,0x062c0619,
-0x06730649,0x098a0786,0x0bbc0b9a,0xee868912,0xffcbffbc,0xffdcffd5,0xffe6ffe2,0xffecffe8,0xfff0ffee,0xfff3fff2,0xfff3fff3,0xffe6fff0,0x8302f6a3,0x09020907,0x07000902,0x06000600,0x03000600,0x00000000,0x03000000,0x06000600,0x07000600,0x0a000900,0x88000900,0xff8aff46,0xffafffa0,0xffc3ffb9,0xffd2ffcb,0xffdfffd9,0xffecffe6,0xfff6fff1,0xfff3fffa,0x4702f758,
-0x09020b01,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06030603,0x06040604,0x06020603,0x06000600,0x06000600,0x06000600,0x06010602,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06070603,0x061f0610,0x066a0639,0x07ff06bd,0x0eff0aff,0x18ff13ff,0xf9494766,0xffccffbf,0xffe1ffd8,0xffebffe7,0xfff2ffef,0xfff6fff3,0xfff9fff8,
-0xfff5fff8,0xff86ffeb,0x09028e02,0x09000a00,0x06000700,0x06000600,0x00000300,0x03000000,0x06000600,0x06000600,0x09000700,0x4d000a00,0xff7ffb21,0xffaaff9b,0xffc0ffb6,0xffd0ffc9,0xffddffd6,0xffeaffe4,0xfff5fff0,0xfff8fffa,0x8908ff95,0x0b320b00,0x070309ec,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06050604,0x06080607,0x06050607,0x06010603,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x060b0604,0x06300618,0x06b30660,0x0aff07f1,0x12ff0eff,0xff6d9229,0xffd0ffc8,0xffe2ffdb,0xffecffe8,0xfff2ffef,0xfff7fff5,0xfff8fff8,0xfff3fff7,0xf145ffe3,0x0a024501,0x07010903,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000000,0x06000600,0x06000600,0x07000600,0x49000900,0xff7cf51f,0xffa8ff99,0xffbfffb5,0xffcfffc8,0xffddffd6,0xffe8ffe3,0xfff5ffef,0xfff8fff9,0x8f0bff9e,0x0b340b00,0x07000dff,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06330605,0x09ff06be,0x06e80aff,
-0x062f0669,0x0611061b,0x060e060e,0x06160610,0x062c061e,0x06600641,0x06ca068a,0x08ff06ff,0x0eff0bff,0x12ff10ff,0x15ff14ff,0xff758c24,0xffd3ffc4,0xffe5ffdd,0xffeeffea,0xfff3fff1,0xfff8fff6,0xfff8fff9,0xfff2fff6,0xfb44ffdd,0x09024701,0x06010704,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x04000200,0x06000600,0x07000600,0x09000900,0xcd0d1400,
-0xff92ff66,0xffb2ffa4,0xffc5ffbd,0xffd4ffcd,0xffe1ffdb,0xffeeffe7,0xfff8fff3,0xffd3fffa,0x1700d624,0x09840b2b,0x06000773,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020601,0x06010602,0x06000601,0x06000600,0x06000600,0x06000600,0x06120602,0x06330635,0x06070614,0x06010603,0x06010601,0x06020602,0x06080604,0x0617060d,0x06460628,0x06bf0677,
-0x09ff06ff,0x10ff0dff,0x18ff15ff,0xd43a1cff,0xffd0ffa1,0xffdfffd6,0xffeaffe6,0xfff1ffee,0xfff6fff3,0xfff9fff8,0xfff6fff8,0xffc1ffef,0x1201cf1a,0x090a0907,0x06000703,0x06000600,0x02000400,0x00000000,0x02000000,0x06000400,0x06000600,0x09000700,0x0b000a00,0xff469803,0xffabff93,0xffc3ffb9,0xffd4ffcc,0xffe3ffdc,0xffefffe8,0xfff7fff3,0xf741ffe5,0x0b055800,
-0x07020907,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06050603,0x060b0608,0x060d060d,0x0606060a,0x06000603,0x06000600,0x06060600,0x06130615,0x06010605,0x06000600,0x06000600,0x06020601,0x06070603,0x061d060e,0x0668063a,0x07ff06b7,0x10ff0bff,0x1dff16ff,0x2bff24ff,0x5a9a30ff,0xffc4f551,0xffe0ffd5,0xffeeffe8,0xfff5fff2,0xfffafff8,0xfffbfffb,
-0xffeffff8,0x9a05ff7c,0x0a010c00,0x07000901,0x06000600,0x04000600,0x00000200,0x02000000,0x06000400,0x06000600,0x07000600,0x0a000900,0xf5215700,0xffa5ff82,0xffc0ffb4,0xffd2ffca,0xffe1ffda,0xffedffe7,0xfff7fff3,0xff86fff7,0x0d00a101,0x09ff0b33,0x0600060b,0x06000600,0x06000600,0x06000600,0x06020601,0x06090605,0x0616060f,0x0621061d,0x06190620,0x06070610,
-0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06090604,0x06310616,0x06c90668,0x0cff07ff,0x1aff12ff,0x2bff23ff,0x9a5833ff,0xffceff7d,0xffe3ffd8,0xffefffea,0xfff6fff3,0xfffafff8,0xfffafffb,0xffd6fff5,0x5700f545,0x09080a06,0x06000703,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x0a000800,0xf5205a00,0xffa3ff80,0xffbfffb3,0xffd1ffc9,0xffdfffd8,0xffedffe6,0xfff6fff2,0xff7dfff2,0x0c009f01,0x0aff0b00,0x06000608,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010601,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06b3061b,0x1eff0dff,0x10ff1fff,
-0x069907ff,0x06330652,0x06260628,0x06310628,0x06580640,0x06ad0679,0x07ff06f0,0x0cff09ff,0x11ff0fff,0x15ff14ff,0x15ff16ff,0x9f1913ff,0xffcbff65,0xffe6ffda,0xfff1ffec,0xfff7fff3,0xfffbfff9,0xfffafffb,0xffd9fff3,0x5a00f344,0x08100a0a,0x06000603,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x09000700,0x1f000a00,
-0xff65d20d,0xffaeff9d,0xffc6ffbc,0xffd6ffcf,0xffe4ffdd,0xfff1ffeb,0xfff6fff5,0xd11dffbf,0x0b392200,0x07450973,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020601,0x06040603,0x06040604,0x06010602,0x06000600,0x06000600,0x06000600,0x066d060f,0x07ff07ff,0x0626066e,0x06090611,0x06070607,0x060a0608,0x06190610,0x06420629,0x06b1066d,0x09ff06ff,
-0x11ff0cff,0x1aff16ff,0x23ff1fff,0x28ff25ff,0xff9dd133,0xffddffd2,0xffedffe7,0xfff5fff1,0xfffafff8,0xfffbfffb,0xfff1fff9,0xd61affb4,0x09162100,0x070a091e,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x06000300,0x06000600,0x07000600,0x0a000900,0x6b000a00,0xff7cf327,0xffbeffb0,0xffd4ffca,0xffe3ffdc,0xffedffe8,0xff90ffee,0x3d00da1d,0x094d0b3e,
-0x06000708,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06070604,0x0611060c,0x06150614,0x060c0612,0x06010605,0x06000600,0x061b0602,0x06600667,0x06070617,0x06020603,0x06020602,0x06050603,0x06100609,0x0637061e,0x06ab0664,0x09ff06ff,0x13ff0eff,0x1fff19ff,0x27ff23ff,0x27ff28ff,0xcd2e38a2,0xffd3ff83,0xffecffe2,0xfff6fff1,0xfff9fff8,0xfff5fff8,
-0xed43ffbb,0x0a066f00,0x09010a19,0x06000700,0x06000600,0x03000600,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x09000700,0x40000a00,0xff5ad40f,0xffb9ffa7,0xffd1ffc7,0xffe1ffda,0xffedffe7,0xffc1fff0,0x6c00ef46,0x0b010c00,0x0751093a,0x06000600,0x06000600,0x06000600,0x06000600,0x06040601,0x06110609,0x062c061d,0x0645063b,0x063a0646,0x06110626,
-0x06010604,0x06020603,0x06000600,0x06000600,0x06000600,0x06010600,0x06050602,0x061a060c,0x06700638,0x08ff06d9,0x14ff0dff,0x23ff1bff,0x31ff2bff,0x35ff34ff,0xeb4b6566,0xffdbffad,0xffedffe6,0xfff6fff3,0xfffafff9,0xffeefff8,0xce19ff93,0x0a313c00,0x0709093b,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x08000600,0x3b000a00,0xff5ad40e,0xffb9ffa5,0xffd0ffc6,0xffe0ffd8,0xffecffe7,0xffbcffef,0x6800e945,0x09010c00,0x07000800,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06000600,0x06000600,0x06000600,0x06000600,0x06040600,0x07ff0632,0x30ff16ff,0x18ff2dff,
-0x06db0aff,0x0641066e,0x062b0631,0x0632062c,0x0651063c,0x0690066c,0x06f606bc,0x08ff07ff,0x0aff0aff,0x0bff0bff,0x0aff0bff,0x0c7d0bc2,0xef307206,0xffddffa5,0xffefffe7,0xfff7fff3,0xfffafff9,0xffeffff7,0xda1fff8d,0x0a323800,0x0611084b,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x07000600,0x0a000900,
-0xa9031500,0xff91ff41,0xffc2ffb5,0xffd6ffcd,0xffe5ffdd,0xffeeffeb,0xff71ffdc,0x1900a909,0x09ff0b19,0x0600075b,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020601,0x06050604,0x06040605,0x06010603,0x06000600,0x06000600,0x06020600,0x06ff0628,0x10ff13ff,0x065f06ff,0x06160628,0x060e060f,0x0612060e,0x06240619,0x0659063a,0x06d1068a,0x09ff07ff,
-0x0fff0cff,0x15ff13ff,0x18ff17ff,0x16ff17ff,0xa01513fc,0xffc1ff5e,0xffe8ffe1,0xfff5fff0,0xfffafff8,0xfff5fff9,0xff63ffda,0x1500ad06,0x08180904,0x0600061f,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x08000700,0x09000900,0x88012100,0xff5ae524,0xffaaff87,0xffb3ffb9,0xfd62ff91,0x6e00c820,0x0b010f00,0x07620948,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06050603,0x060d0609,0x06110610,0x060a060f,0x06010605,0x06000600,0x062e0603,0x06d406d6,0x060e0632,0x06030606,0x06030603,0x06060604,0x0611060a,0x0632061e,0x068c0656,0x07ff06d6,0x0cff09ff,0x10ff0eff,0x10ff11ff,0x0eff0fff,0x13600cff,0xd21e6609,0xff92fd5e,0xffc0ffb7,0xffacffcb,0xe02eff79,
-0x1b008a00,0x0a6009bf,0x0700081e,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x07000600,0x0a000900,0x6b001000,0xff4bd012,0xffa1ff7d,0xffb9ffb3,0xff73ffa0,0x9101eb38,0x0b612100,0x08010970,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06030601,0x06110608,0x062d061d,0x064e0640,0x06460651,0x0616062f,
-0x06040606,0x060c060d,0x06000602,0x06000600,0x06000600,0x06010601,0x06080603,0x06230611,0x06840645,0x08ff06ea,0x11ff0cff,0x19ff15ff,0x1cff1cff,0x17ff1bff,0x265412ff,0xe42f8b10,0xffa5ff6a,0xffd6ffc4,0xffa2ffbd,0xcb20ff60,0x0e036500,0x09360a11,0x06000749,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x03000000,0x06000600,0x06000600,0x06000600,0x09000800,0x64001100,0xff48cc15,0xffa1ff7c,0xffb5ffb6,0xff72ff9f,0x8900e930,0x0b4d1d00,0x07010959,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x06ff062c,0x23ff12ff,0x11ff22ff,
-0x068b07ff,0x06240642,0x0616061a,0x06160615,0x0620061a,0x0633062a,0x064c063e,0x0667065a,0x0677066e,0x066e0677,0x07450664,0x091a082d,0x22010b0d,0xe8308f03,0xffa4ff6e,0xffcbffca,0xff9affbf,0xd31bff62,0x0d056400,0x083e0918,0x06000652,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x08000700,
-0x09000800,0xad073c00,0xff70f734,0xffadff97,0xffacffb5,0xf94dff86,0x4100b30d,0x09010b01,0x0609097c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06020602,0x06020602,0x06000601,0x06000600,0x06000600,0x06040600,0x07ff0633,0x15ff15ff,0x066e07ff,0x0616062b,0x060c060f,0x060e060c,0x061a0612,0x06380626,0x06730651,0x06cb069f,
-0x07ff06ff,0x08ff07ff,0x07ff08ff,0x08bc07fa,0x0b54097e,0xad0b4704,0xff82f749,0xffcdffb7,0xffb9ffcb,0xf94dff8c,0x3c00ad0d,0x0749093c,0x07000705,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x07000700,0x09000800,0x3e000d00,0x86006700,0x75009000,0x25006500,0x0a080900,0x08010908,0x06000701,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06040603,0x06060606,0x06040605,0x06000602,0x06000600,0x06270603,0x06dd06d8,0x060e0633,0x06030605,0x06020602,0x06030602,0x06080605,0x0616060d,0x06350623,0x06660649,0x069e0681,0x06ad06ad,0x068d06a7,0x0746066e,0x09180829,0x09090a10,0x5d002800,0x86007900,0x6d008e00,0x0c073f00,
-0x0dff098a,0x061609f3,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x08000700,0x0a000900,0x2b000b00,0x7e005e00,0x7f008c00,0x43006300,0x0a130e00,0x08810914,0x0600079a,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06080604,0x0618060f,0x062c0623,0x062b0630,0x060f061d,
-0x06040604,0x06160616,0x06010604,0x06000600,0x06000600,0x06010600,0x06060603,0x0618060c,0x064e062c,0x06bb067f,0x07ff06ff,0x09ff08ff,0x09ff09ff,0x07b907ff,0x093e0870,0x0c0a0a23,0x67003b00,0x8f008200,0x5e007e00,0x09432b00,0x09150a3f,0x07010816,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x07000600,0x09000800,0x22000a00,0x7d005b00,0x87008900,0x3c006c00,0x0b070d00,0x08670908,0x0600077b,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x066b0612,0x0cff07ff,0x06f90bff,
-0x0623065f,0x0608060f,0x06040605,0x06040604,0x06040604,0x06060605,0x06090608,0x060a0609,0x0609060a,0x06070609,0x06030605,0x07010602,0x09000800,0x0d000b00,0x68003a00,0x8b008b00,0x61007a00,0x0b272b00,0x085209b4,0x06000721,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,
-0x08000600,0x09000900,0x49001700,0x94007500,0x77008e00,0x14005300,0x0a030903,0x07020901,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x06b4061e,0x0cff0cff,0x063b06b9,0x060a0615,0x06040606,0x06050604,0x06070605,0x060e060a,0x061b0614,0x062a0623,
-0x0631062f,0x06310631,0x061f0629,0x0616061a,0x0905070c,0x09020a03,0x4f001600,0x90008400,0x75009000,0x1d015100,0x08ea083e,0x06550841,0x06000600,0x06000600,0x06000600,0x00000300,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x07000700,0x08000700,0x0b000a00,0x0b000b00,0x08000a00,0x070b0701,0x0600070b,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06000601,0x06000600,0x06000600,0x06100601,0x06650661,0x06050617,0x06000602,0x06000600,0x06000600,0x06010601,0x06040602,0x06070605,0x060d060a,0x060f060f,0x060e060e,0x0608060c,0x06020605,0x07000601,0x07000700,0x0a160800,0x0bad0b4c,0x09fc096b,0x07230813,
-0x063509d2,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x08000700,0x09000800,0x0a000b00,0x09000900,0x09000a00,0x071a0700,0x0600071d,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06060603,0x060b0609,0x060c060d,0x06040608,
-0x06020601,0x06120611,0x06000603,0x06000600,0x06000600,0x06000600,0x06020601,0x06070604,0x0615060c,0x0628061f,0x063c0634,0x063f063f,0x06270633,0x0613061e,0x0704060b,0x07000701,0x0a170900,0x09b90959,0x0ba10a6e,0x084e0905,0x0704084f,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x07000600,0x09000700,0x09000900,0x09000900,0x09000900,0x080a0800,0x0600070c,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06120602,0x064d0633,0x06210643,
-0x0603060a,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07000600,0x08010801,0x09270900,0x0a6d097d,0x09d609b0,0x07ac0904,0x064807fb,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06000300,0x06000600,0x06000600,
-0x07000600,0x07000700,0x09000900,0x08000800,0x08000800,0x08000900,0x07040704,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x062f0606,0x0687068e,0x060d062d,0x06010604,0x06000600,0x06000600,0x06000600,0x06010601,0x06010601,0x06020601,
-0x06020602,0x06010602,0x06010601,0x06000600,0x07000600,0x07010700,0x09090800,0x089f0846,0x08fa0aff,0x090908e0,0x079a0fff,0x06000700,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x08000800,0x07000800,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020600,0x060e060d,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x081c0700,0x08e60866,0x07530761,0x06000714,
-0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x07000600,0x08000800,0x08000800,0x07000800,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06010600,0x06010601,0x06000600,
-0x06000600,0x06060605,0x06000601,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020601,0x06030602,0x06030603,0x06020603,0x06010602,0x06000600,0x06000600,0x06000600,0x081d0700,0x08d90868,0x07410760,0x06000703,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x02000000,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x07000700,0x07000700,0x06000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06020602,0x06000601,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x07370600,0x069907af,0x064006ac,0x06000602,0x06000600,0x06000600,0x06000600,0x04000600,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,
-0x06000600,0x06000600,0x07000700,0x07000700,0x07000700,0x07000700,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06030600,0x060b060b,0x06000604,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x070a0700,0x07bf0753,0x078d077d,0x07000718,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000200,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x02000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x04000300,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x04000600,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,
-0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x03000300,
-0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x02000000,0x03000300,0x03000300,0x03000300,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000500,0x03000300,0x03000300,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x06000400,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x03000400,0x03000300,0x03000300,0x03000300,0x01000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,
-0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,0x04000300,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,
-0x03000300,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x04000600,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,
-0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x06000400,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x05000400,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,
-0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x06000600,0x03000400,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000000,0x03000300,0x03000300,0x03000300,0x03000300,0x00000200,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x02000300,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x03000200,0x03000300,0x03000300,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x02000100,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,
-0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x03000300,0x00000200,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0 };
-
-static float EyeLayerBoxes[] = {
-	0, 0, 116, 70,
-	116, 0, 228, 70,
-	228, 0, 334, 71,
-	334, 0, 438, 71,
-	0, 71, 102, 143,
-	102, 71, 200, 144,
-	200, 71, 296, 144,
-	296, 71, 390, 145,
-	390, 71, 480, 145,
-	0, 145, 88, 222,
-	88, 145, 174, 224,
-	174, 145, 256, 226,
-	256, 145, 336, 228,
-	336, 145, 414, 228,
-	414, 145, 488, 230,
-};
@@ -9,20 +9,22 @@ from PIL import Image
 from PIL import ImageFilter
 from PIL import ImageEnhance
 
-#path = '/Users/prideout/Documents/PowerVR-ES2/Utilities/'
-path = '/Users/prideout/Samples/PowerVR-ES2/Utilities/'
+# Build with: g++ -O2 -o TextureCooker TextureCooker.cpp -lpng -lpthread
+#             g++ -O2 -o AssetPacker AssetPacker.cpp
+cooker = '../../Common/Tools/TextureCooker -f 88 -m none '
+packer = '../../Common/Tools/AssetPacker '
 
-textool = 'PVRTexTool/PVRTexToolCL/MacOS/PVRTexTool -h -yflip1 -fOGL88 -i'
-filewrap = 'Filewrap/MacOS/Filewrap -h -o '
+system(cooker + 'Unified.png Unified.pvr')
+system(cooker + 'EyesLayer.png EyesLayer.pvr')
+system(cooker + 'BodyLayer.png BodyLayer.pvr')
+system('../../Common/Tools/TextureCooker -f 565 -m none Tile.png Tile.pvr')
 
-system(path + textool + 'Unified.png')
-system(path + textool + 'EyesLayer.png')
-system(path + textool + 'BodyLayer.png')
-system(path + filewrap + 'Background.h Background.pvrtc')
+# The sprite coordinates go into the pack as float arrays, by way of a
+# scratch header that AssetPacker converts.
 
 ##################################################################
 
-headerFile = open('EyesLayer.h', 'a')
+headerFile = open('Boxes.h', 'w')
 boxes = '''
 static float EyeLayerBoxes[] = {
 	0, 0, 116, 70,
@@ -47,7 +49,7 @@ headerFile.close()
 
 ##################################################################
 
-headerFile = open('BodyLayer.h', 'a')
+headerFile = open('Boxes.h', 'a')
 boxes = '''
 static float BodyLayerBoxes[] = {
 	0, 0, 116, 70,
@@ -72,7 +74,7 @@ headerFile.close()
 
 ##################################################################
 
-headerFile = open('Unified.h', 'a')
+headerFile = open('Boxes.h', 'a')
 boxes = '''
 static float UnifiedBodyLayerBoxes[] = {
     0, 0, 116, 70, // 0
@@ -111,3 +113,8 @@ static float UnifiedEyeLayerBoxes[] = {
 };'''
 headerFile.write(boxes)
 headerFile.close()
+
+##################################################################
+
+system(packer + 'Textures.pack Unified.pvr EyesLayer.pvr BodyLayer.pvr Tile.pvr ' +
+       'Boxes.h Background=Background.pvrtc')
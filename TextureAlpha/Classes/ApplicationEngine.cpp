@@ -1,5 +1,6 @@
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 using namespace std;
 
@@ -41,10 +42,12 @@ void ApplicationEngine::Initialize(int width, int height)
 
 void ApplicationEngine::Render() const
 {
+    PROFILE_ZONE("ApplicationEngine::Render");
     m_renderingEngine->Render(m_theta);
 }
 
 void ApplicationEngine::UpdateAnimation(float dt)
 {
+    PROFILE_ZONE("ApplicationEngine::UpdateAnimation");
     m_theta += dt * 20;
 }
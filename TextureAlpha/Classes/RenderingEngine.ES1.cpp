@@ -2,6 +2,7 @@
 #include <OpenGLES/ES1/glext.h>
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <iostream>
 
 using namespace std;
@@ -146,6 +147,7 @@ void RenderingEngine::Initialize()
 
 void RenderingEngine::Render(float theta) const
 {
+    PROFILE_ZONE("ES1::RenderingEngine::Render");
     glClear(GL_COLOR_BUFFER_BIT);
     glPushMatrix();
     glRotatef(theta, 0, 0, 1);
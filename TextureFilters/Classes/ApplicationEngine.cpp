@@ -1,5 +1,6 @@
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 using namespace std;
 
@@ -59,6 +60,7 @@ void ApplicationEngine::Initialize(int width, int height)
 
 void ApplicationEngine::Render() const
 {
+    PROFILE_ZONE("ApplicationEngine::Render");
     vector<Visual> visuals(1);
     visuals[0].Color = vec3(1, 1, 1);
     visuals[0].LowerLeft = ivec2(-160, 0);
@@ -69,6 +71,7 @@ void ApplicationEngine::Render() const
 
 void ApplicationEngine::UpdateAnimation(float dt)
 {
+    PROFILE_ZONE("ApplicationEngine::UpdateAnimation");
     if (m_animating) {
         vec3 axis(0, 1, 0);
         float angle = M_PI / 2;
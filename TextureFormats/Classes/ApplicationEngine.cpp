@@ -1,5 +1,6 @@
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 using namespace std;
 
@@ -68,6 +69,7 @@ void ApplicationEngine::Initialize(int width, int height)
 
 void ApplicationEngine::Render() const
 {
+    PROFILE_ZONE("ApplicationEngine::Render");
     vector<Visual> visuals(1);
     visuals[0].Color = vec3(1, 1, 1);
     visuals[0].LowerLeft = ivec2(-160, 0);
@@ -87,6 +89,7 @@ void ApplicationEngine::OnFingerDown(ivec2 location)
 
 void ApplicationEngine::UpdateAnimation(float dt)
 {
+    PROFILE_ZONE("ApplicationEngine::UpdateAnimation");
     m_timer += dt;
     if (m_timer > 0.75f) {
         m_timer = 0;
@@ -2,6 +2,7 @@
 #include <OpenGLES/ES2/glext.h>
 #include "Interfaces.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <assert.h>
 #include <iostream>
 #include <algorithm>
@@ -176,6 +177,7 @@ void RenderingEngine::Initialize(const vector<ISurface*>& surfaces)
 
 void RenderingEngine::Render(const vector<Visual>& visuals) const
 {
+    PROFILE_ZONE("ES2::RenderingEngine::Render");
     glClearColor(0.5f, 0.5f, 0.5f, 1);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -291,6 +293,11 @@ void RenderingEngine::SetPngTexture(const string& filename) const
 void RenderingEngine::SetPvrTexture(const string& filename) const
 {
     TextureDescription description = m_resourceManager->LoadPvrImage(filename);
+    if (!description.MipCount) {
+        m_resourceManager->UnloadImage();
+        return;
+    }
+    
     unsigned char* data = (unsigned char*) m_resourceManager->GetImageData();
     int width = description.Size.x;
     int height = description.Size.y;
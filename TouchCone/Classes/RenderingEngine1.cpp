@@ -1,6 +1,7 @@
 #include <OpenGLES/ES1/gl.h>
 #include <OpenGLES/ES1/glext.h>
 #include "IRenderingEngine.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <vector>
 
 using namespace std;
@@ -138,6 +139,7 @@ void RenderingEngine1::Initialize(int width, int height)
 
 void RenderingEngine1::Render() const
 {
+    PROFILE_ZONE("RenderingEngine1::Render");
     GLsizei stride = sizeof(Vertex);
     const GLvoid* pCoords = &m_coneVertices[0].Position.x;
     const GLvoid* pColors = &m_coneVertices[0].Color.x;
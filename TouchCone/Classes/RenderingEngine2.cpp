@@ -2,6 +2,7 @@
 #include <OpenGLES/ES2/glext.h>
 #include "IRenderingEngine.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <vector>
 #include <iostream>
 
@@ -149,6 +150,7 @@ void RenderingEngine2::Initialize(int width, int height)
 
 void RenderingEngine2::Render() const
 {
+    PROFILE_ZONE("RenderingEngine2::Render");
     GLuint positionSlot = glGetAttribLocation(m_simpleProgram, "Position");
     GLuint colorSlot = glGetAttribLocation(m_simpleProgram, "SourceColor");
 
@@ -1,6 +1,7 @@
 #include <OpenGLES/ES1/gl.h>
 #include <OpenGLES/ES1/glext.h>
 #include "IRenderingEngine.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <vector>
 
 using namespace std;
@@ -154,6 +155,7 @@ void VboRenderingEngine1::Initialize(int width, int height)
 
 void VboRenderingEngine1::Render() const
 {
+    PROFILE_ZONE("VboRenderingEngine1::Render");
     glClearColor(0.5f, 0.5f, 0.5f, 1);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     glPushMatrix();
@@ -2,6 +2,7 @@
 #include <OpenGLES/ES2/glext.h>
 #include "IRenderingEngine.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <vector>
 #include <iostream>
 
@@ -165,6 +166,7 @@ void VboRenderingEngine2::Initialize(int width, int height)
 
 void VboRenderingEngine2::Render() const
 {
+    PROFILE_ZONE("VboRenderingEngine2::Render");
     GLuint positionSlot = glGetAttribLocation(m_simpleProgram, "Position");
     GLuint colorSlot = glGetAttribLocation(m_simpleProgram, "SourceColor");
 
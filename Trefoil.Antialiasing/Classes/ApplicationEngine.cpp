@@ -1,5 +1,6 @@
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 using namespace std;
 
@@ -50,6 +51,7 @@ void ApplicationEngine::Initialize(int width, int height)
 
 void ApplicationEngine::Render() const
 {
+    PROFILE_ZONE("ApplicationEngine::Render");
     float objectTheta = m_objectTheta;
     if (m_dragging)
         objectTheta += m_dragEnd - m_dragStart;
@@ -66,6 +68,7 @@ void ApplicationEngine::Render() const
 
 void ApplicationEngine::UpdateAnimation(float dt)
 {
+    PROFILE_ZONE("ApplicationEngine::UpdateAnimation");
     // If the user is not dragging the object, spin it.
     if (!m_dragging)
         m_objectTheta += dt * 20;
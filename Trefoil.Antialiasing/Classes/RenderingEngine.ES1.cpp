@@ -3,6 +3,7 @@
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <iostream>
 
 using namespace std;
@@ -183,6 +184,7 @@ void RenderingEngine::Initialize()
     
 void RenderingEngine::Render(float objectTheta, float fboTheta) const
 {
+    PROFILE_ZONE("ES1::RenderingEngine::Render");
     Drawable drawable;
     GLuint background;
     vec3 color;
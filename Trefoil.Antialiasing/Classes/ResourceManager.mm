@@ -3,7 +3,7 @@
 #import <string>
 #import <iostream>
 #import "Interfaces.hpp"
-#import "../PowerVR/PVRTTexture.h"
+#import "../../Common/Classes/PvrTexture.hpp"
 
 using namespace std;
 
@@ -61,60 +61,80 @@ public:
         
         m_imageData = [NSData dataWithContentsOfFile:fullPath];
         m_hasPvrHeader = true;
-        PVR_Texture_Header* header = (PVR_Texture_Header*) [m_imageData bytes];
-        bool hasAlpha = header->dwAlphaBitMask ? true : false;
+        m_pvrTexture.Parse([m_imageData bytes], [m_imageData length]);
+        return DescribePvrTexture(m_pvrTexture);
+    }
+    void* GetImageData()
+    {
+        if (!m_hasPvrHeader)
+            return (void*) [m_imageData bytes];
         
+        return (void*) m_pvrTexture.GetData();
+    }
+    void UnloadImage()
+    {
+        m_imageData = 0;
+    }
+    
+private:
+    TextureDescription DescribePvrTexture(const PvrTexture& texture)
+    {
+        // A bad or unsupported image comes back with no levels, so nothing
+        // gets uploaded.
         TextureDescription description;
-        switch (header->dwpfFlags & PVRTEX_PIXELTYPE) {
-            case OGL_RGBA_8888:
+        description.Format = TextureFormatRgba;
+        description.BitsPerComponent = 8;
+        description.Size = ivec2(0, 0);
+        description.OriginalSize = description.Size;
+        description.MipCount = 0;
+        if (!texture.IsValid()) {
+            cout << "Bad PVR image: "
+                 << PvrTexture::GetErrorString(texture.GetError()) << endl;
+            return description;
+        }
+        
+        bool hasAlpha = texture.HasAlpha();
+        
+        switch (texture.GetPixelType()) {
+            case PvrPixelTypeRgba8888:
                 description.Format = TextureFormatRgba;
                 description.BitsPerComponent = 8;
                 break;
-            case OGL_RGB_565:
+            case PvrPixelTypeRgb565:
                 description.Format = TextureFormat565;
                 break;
-            case OGL_RGBA_5551:
+            case PvrPixelTypeRgba5551:
                 description.Format = TextureFormat5551;
                 break;
-            case OGL_RGBA_4444:
+            case PvrPixelTypeRgba4444:
                 description.Format = TextureFormatRgba;
                 description.BitsPerComponent = 4;
                 break;
-            case OGL_PVRTC2:    
+            case PvrPixelTypePvrtc2:
                 description.Format = hasAlpha ? TextureFormatPvrtcRgba2 :
                 TextureFormatPvrtcRgb2;
                 break;
-            case OGL_PVRTC4:
+            case PvrPixelTypePvrtc4:
                 description.Format = hasAlpha ? TextureFormatPvrtcRgba4 :
                 TextureFormatPvrtcRgb4;
                 break;
-            default:
-                assert(!"Unsupported PVR image.");
+            case PvrPixelTypeI8:
+                description.Format = TextureFormatGray;
                 break;
+            default:
+                cout << "Unsupported PVR image." << endl;
+                return description;
         }
         
-        description.Size.x = header->dwWidth;
-        description.Size.y = header->dwHeight;
-        description.MipCount = header->dwMipMapCount;
-        return description;
-    }
-    void* GetImageData()
-    {
-        if (!m_hasPvrHeader)
-            return (void*) [m_imageData bytes];
+        description.Size.x = texture.GetWidth();
+        description.Size.y = texture.GetHeight();
+        description.OriginalSize = description.Size;
+        description.MipCount = texture.GetLevelCount();
         
-        PVR_Texture_Header* header = (PVR_Texture_Header*) [m_imageData bytes];
-        char* data = (char*) [m_imageData bytes];
-        unsigned int headerSize = header->dwHeaderSize;
-        return data + headerSize;
-    }
-    void UnloadImage()
-    {
-        m_imageData = 0;
+        return description;
     }
-    
-private:
     NSData* m_imageData;
+    PvrTexture m_pvrTexture;
     bool m_hasPvrHeader;
     unsigned int NextPot(unsigned int n)
     {
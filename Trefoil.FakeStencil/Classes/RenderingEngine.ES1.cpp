@@ -3,6 +3,7 @@
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <iostream>
 
 using namespace std;
@@ -136,6 +137,7 @@ void RenderingEngine::Initialize()
 
 void RenderingEngine::Render(float theta) const
 {
+    PROFILE_ZONE("ES1::RenderingEngine::Render");
     glClear(GL_DEPTH_BUFFER_BIT);
 
     // Set up the transforms for the background.
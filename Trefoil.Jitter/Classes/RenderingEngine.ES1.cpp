@@ -3,7 +3,13 @@
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/JitterPattern.hpp"
+#include "../../Common/Classes/MonotonicClock.hpp"
+#include "../../Common/Classes/Profiler.hpp"
+#include "../../Common/Classes/RenderGraph.hpp"
+#include "../../Common/Classes/TemporalAccumulator.hpp"
 #include <iostream>
+#include <map>
 
 using namespace std;
 
@@ -24,21 +30,64 @@ struct Drawables {
 
 struct Framebuffers {
     GLuint Accumulated;
-    GLuint Scene;
+    GLuint History;
 };
 
 struct Renderbuffers {
     GLuint AccumulatedColor;
-    GLuint SceneColor;
-    GLuint SceneDepth;
-    GLuint SceneStencil;
 };
 
 struct Textures {
     GLuint Marble;
     GLuint RhinoBackground;
     GLuint TigerBackground;
-    GLuint OffscreenSurface;
+    GLuint History;
+};
+
+const int JitterCount = 8;
+
+// The offsets come from a generator rather than a table per count, so the
+// sample count is free to change.  JitterPatternBenchmark picks blue noise,
+// which does best over most counts.
+const JitterPatternKind JitterPattern = JitterPatternBlueNoise;
+
+// Renders one jitter sample per frame into a history buffer rather than
+// all of them every frame, and stops rendering once all 16 are in.  Any
+// motion starts the history over with a burst of as many samples as the
+// budget allows, so progressive accumulation only runs while the view
+// holds still.  HistoryLimit above zero opts into keeping the history
+// through the object's spin instead, at one sample a frame with that many
+// samples' worth of trail; TemporalAccumulationCheck shows what the trail
+// costs.
+const bool Progressive = true;
+const int ProgressiveCount = 16;
+const int HistoryLimit = 0;
+
+// While things move, the samples each frame are fitted to this much GPU
+// time, which leaves the rest of a 60 Hz frame for the resolve.
+const float SampleBudgetMilliseconds = 12;
+
+// ES 1.1 has no timer queries, so timing a burst means waiting for the GPU
+// with glFinish.  That stalls the CPU and drains a tile-based GPU, so only
+// one burst in this many is timed.
+const int BurstTimingInterval = 8;
+
+// Clearing the accumulation buffer, then a scene and an accumulate pass for
+// each jitter offset.  Every sample gets its own surfaces in the render
+// graph, which folds them into one set of storage.  Progressive rendering
+// has one scene and accumulate pass into the history, and then a resolve.
+enum PassKind {
+    PassKindClear,
+    PassKindScene,
+    PassKindAccumulate,
+    PassKindResolve,
+};
+
+struct Pass {
+    PassKind Kind;
+    int Sample;
+    int Input;
+    GLuint Framebuffer;
 };
     
 class RenderingEngine : public IRenderingEngine {
@@ -48,6 +97,11 @@ public:
     void Render(float objectTheta, float fboTheta) const;
 private:
     void RenderPass(float objectTheta, float fboTheta, vec2 jitterOffset) const;
+    void RenderStep(const RenderGraphStep& step, float objectTheta, float fboTheta,
+                    vec2 offset) const;
+    void RenderQuad(GLuint texture) const;
+    int AddPass(const char* name, PassKind kind, int sample, GLuint framebuffer = 0);
+    void CreateOffscreenSurfaces();
     Textures m_textures;
     Renderbuffers m_renderbuffers;
     Framebuffers m_framebuffers;
@@ -56,6 +110,15 @@ private:
     void RenderDrawable(const Drawable& drawable) const;
     void UploadImage(const TextureDescription& description);
     Drawables m_drawables;
+    RenderGraph m_graph;
+    std::vector<Pass> m_passes;
+    std::vector<GLuint> m_slots;
+    std::vector<vec2> m_offsets;
+    mutable TemporalAccumulator m_accumulator;
+    mutable JitterBudget m_budget;
+    mutable int m_burstCount;
+    mutable float m_objectTheta;
+    mutable float m_fboTheta;
     vec2 m_viewport;
     IResourceManager* m_resourceManager;
 };
@@ -65,7 +128,12 @@ IRenderingEngine* CreateRenderingEngine(IResourceManager* resourceManager)
     return new RenderingEngine(resourceManager);
 }
 
-RenderingEngine::RenderingEngine(IResourceManager* resourceManager)
+RenderingEngine::RenderingEngine(IResourceManager* resourceManager) :
+    m_accumulator(ProgressiveCount, HistoryLimit),
+    m_budget(SampleBudgetMilliseconds, 1, ProgressiveCount, JitterCount),
+    m_burstCount(0),
+    m_objectTheta(0),
+    m_fboTheta(0)
 {
     m_resourceManager = resourceManager;
     glGenRenderbuffersOES(1, &m_renderbuffers.AccumulatedColor);
@@ -112,47 +180,62 @@ void RenderingEngine::Initialize()
     glFramebufferRenderbufferOES(GL_FRAMEBUFFER_OES, GL_COLOR_ATTACHMENT0_OES,
                                  GL_RENDERBUFFER_OES, m_renderbuffers.AccumulatedColor);
     
-    // Create the off-screen FBO.
-    
-    glGenRenderbuffersOES(1, &m_renderbuffers.SceneColor);
-    glBindRenderbufferOES(GL_RENDERBUFFER_OES, m_renderbuffers.SceneColor);
-    glRenderbufferStorageOES(GL_RENDERBUFFER_OES, GL_RGBA8_OES, width, height);
-
-    glGenRenderbuffersOES(1, &m_renderbuffers.SceneDepth);
-    glBindRenderbufferOES(GL_RENDERBUFFER_OES, m_renderbuffers.SceneDepth);
-    glRenderbufferStorageOES(GL_RENDERBUFFER_OES, GL_DEPTH_COMPONENT24_OES, width, height);
-
-    glGenRenderbuffersOES(1, &m_renderbuffers.SceneStencil);
-    glBindRenderbufferOES(GL_RENDERBUFFER_OES, m_renderbuffers.SceneStencil);
-    glRenderbufferStorageOES(GL_RENDERBUFFER_OES, GL_STENCIL_INDEX8_OES, width, height);
+    // Create the history texture and its FBO.
+    if (Progressive) {
+        glGenTextures(1, &m_textures.History);
+        glBindTexture(GL_TEXTURE_2D, m_textures.History);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0,
+                     GL_RGBA, GL_UNSIGNED_BYTE, 0);
+        glGenFramebuffersOES(1, &m_framebuffers.History);
+        glBindFramebufferOES(GL_FRAMEBUFFER_OES, m_framebuffers.History);
+        glFramebufferTexture2DOES(GL_FRAMEBUFFER_OES, GL_COLOR_ATTACHMENT0_OES,
+                                  GL_TEXTURE_2D, m_textures.History, 0);
+    }
 
-    glGenFramebuffersOES(1, &m_framebuffers.Scene);
-    glBindFramebufferOES(GL_FRAMEBUFFER_OES, m_framebuffers.Scene);
-    glFramebufferRenderbufferOES(GL_FRAMEBUFFER_OES, GL_COLOR_ATTACHMENT0_OES,
-                                 GL_RENDERBUFFER_OES, m_renderbuffers.SceneColor);
-    glFramebufferRenderbufferOES(GL_FRAMEBUFFER_OES, GL_DEPTH_ATTACHMENT_OES,
-                                    GL_RENDERBUFFER_OES, m_renderbuffers.SceneDepth);
-    glFramebufferRenderbufferOES(GL_FRAMEBUFFER_OES, GL_STENCIL_ATTACHMENT_OES,
-                                 GL_RENDERBUFFER_OES, m_renderbuffers.SceneStencil);
-
-    // Create a texture object and associate it with the big FBO.
-    glGenTextures(1, &m_textures.OffscreenSurface);
-    glBindTexture(GL_TEXTURE_2D, m_textures.OffscreenSurface);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0,
-                 GL_RGBA, GL_UNSIGNED_BYTE, 0);
-    glFramebufferTexture2DOES(GL_FRAMEBUFFER_OES, GL_COLOR_ATTACHMENT0_OES,
-                              GL_TEXTURE_2D, m_textures.OffscreenSurface, 0);
-
-    // check FBO status
-    GLenum status = glCheckFramebufferStatusOES(GL_FRAMEBUFFER_OES);
-    if (status != GL_FRAMEBUFFER_COMPLETE_OES) {
-        cout << "Incomplete FBO" << endl;
-        exit(1);
+    std::vector<JitterOffset> offsets;
+    GenerateJitterPattern(JitterPattern, Progressive ? ProgressiveCount : JitterCount, offsets);
+    for (size_t i = 0; i < offsets.size(); ++i)
+        m_offsets.push_back(vec2(offsets[i].X, offsets[i].Y));
+
+    // Describe the jitter passes.  The scene surfaces for one sample are
+    // done with once it's accumulated, so every sample shares storage.
+    int accumulated = m_graph.ImportResource("Accumulated");
+    int sampleCount = JitterCount;
+    int history = accumulated;
+    GLuint historyFramebuffer = m_framebuffers.Accumulated;
+    if (Progressive) {
+        sampleCount = 1;
+        history = m_graph.ImportResource("History");
+        historyFramebuffer = m_framebuffers.History;
+    } else {
+        int clear = AddPass("Clear", PassKindClear, 0, m_framebuffers.Accumulated);
+        m_graph.Write(clear, accumulated);
+    }
+    for (int i = 0; i < sampleCount; ++i) {
+        int color = m_graph.CreateResource("SceneColor", width, height, RenderGraphFormatRgba8);
+        int depth = m_graph.CreateResource("SceneDepth", width, height, RenderGraphFormatDepth24);
+        int stencil = m_graph.CreateResource("SceneStencil", width, height,
+                                             RenderGraphFormatStencil8);
+        int scene = AddPass("Scene", PassKindScene, i);
+        m_graph.Write(scene, color);
+        m_graph.Write(scene, depth);
+        m_graph.Write(scene, stencil);
+        int accumulate = AddPass("Accumulate", PassKindAccumulate, i, historyFramebuffer);
+        m_graph.Read(accumulate, color);
+        m_graph.Write(accumulate, history, true);
+        m_passes[accumulate].Input = color;
     }
+    if (Progressive) {
+        int resolve = AddPass("Resolve", PassKindResolve, 0, m_framebuffers.Accumulated);
+        m_graph.Read(resolve, history);
+        m_graph.Write(resolve, accumulated);
+    }
+    m_graph.Compile();
+    CreateOffscreenSurfaces();
     
     // Set up various GL state.
     glEnableClientState(GL_VERTEX_ARRAY);
@@ -161,86 +244,263 @@ void RenderingEngine::Initialize()
     glViewport(0, 0, m_viewport.x, m_viewport.y);
 }
 
-void RenderingEngine::Render(float objectTheta, float fboTheta) const
+// Passes that draw into an imported surface come with its FBO.
+int RenderingEngine::AddPass(const char* name, PassKind kind, int sample, GLuint framebuffer)
 {
-    const vec2 JitterOffsets2[2] =
-    {
-        vec2(0.25f, 0.75f), vec2(0.75f, 0.25f),
-    };
-
-    const vec2 JitterOffsets4[4] =
-    {
-        vec2(0.375f, 0.25f), vec2(0.125f, 0.75f),
-        vec2(0.875f, 0.25f), vec2(0.625f, 0.75f),
-    };
-
-    const vec2 JitterOffsets8[8] =
-    {
-        vec2(0.5625f, 0.4375f), vec2(0.0625f, 0.9375f),
-        vec2(0.3125f, 0.6875f), vec2(0.6875f, 0.8125f),
-        
-        vec2(0.8125f, 0.1875f), vec2(0.9375f, 0.5625f),
-        vec2(0.4375f, 0.0625f), vec2(0.1875f, 0.3125f),
-    };
-
-    const vec2 JitterOffsets16[16] =
-    {
-        vec2(0.375f, 0.4375f), vec2(0.625f, 0.0625f),
-        vec2(0.875f, 0.1875f), vec2(0.125f, 0.0625f),
-        
-        vec2(0.375f, 0.6875f), vec2(0.875f, 0.4375f),
-        vec2(0.625f, 0.5625f), vec2(0.375f, 0.9375f),
-        
-        vec2(0.625f, 0.3125f), vec2(0.125f, 0.5625f),
-        vec2(0.125f, 0.8125f), vec2(0.375f, 0.1875f),
-        
-        vec2(0.875f, 0.9375f), vec2(0.875f, 0.6875f),
-        vec2(0.125f, 0.3125f), vec2(0.625f, 0.8125f),
-    };
+    Pass pass;
+    pass.Kind = kind;
+    pass.Sample = sample;
+    pass.Input = -1;
+    pass.Framebuffer = framebuffer;
+    m_passes.push_back(pass);
+    int index = m_graph.AddPass(name);
+    assert(index == (int) m_passes.size() - 1);
+    return index;
+}
 
-    const int JitterCount = 8;
-    const vec2* JitterOffsets = JitterOffsets8;
+static GLenum GetAttachment(RenderGraphFormat format)
+{
+    switch (format) {
+        case RenderGraphFormatDepth16:
+        case RenderGraphFormatDepth24: return GL_DEPTH_ATTACHMENT_OES;
+        case RenderGraphFormatStencil8: return GL_STENCIL_ATTACHMENT_OES;
+        default: return GL_COLOR_ATTACHMENT0_OES;
+    }
+}
 
-    glBindFramebufferOES(GL_FRAMEBUFFER_OES, m_framebuffers.Accumulated);
+static GLbitfield GetClearBit(RenderGraphFormat format)
+{
+    switch (format) {
+        case RenderGraphFormatDepth16:
+        case RenderGraphFormatDepth24: return GL_DEPTH_BUFFER_BIT;
+        case RenderGraphFormatStencil8: return GL_STENCIL_BUFFER_BIT;
+        default: return GL_COLOR_BUFFER_BIT;
+    }
+}
+
+// Allocates a texture or renderbuffer for each slot the graph handed out,
+// and one FBO for each distinct set of attachments.
+void RenderingEngine::CreateOffscreenSurfaces()
+{
+    const std::vector<RenderGraphSlot>& slots = m_graph.GetSlots();
+    m_slots.resize(slots.size());
+    for (size_t i = 0; i < slots.size(); ++i) {
+        const RenderGraphSlot& slot = slots[i];
+        if (slot.Texture) {
+            assert(slot.Format == RenderGraphFormatRgba8);
+            glGenTextures(1, &m_slots[i]);
+            glBindTexture(GL_TEXTURE_2D, m_slots[i]);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, slot.Width, slot.Height, 0,
+                         GL_RGBA, GL_UNSIGNED_BYTE, 0);
+            continue;
+        }
+        GLenum format = GL_RGBA8_OES;
+        switch (slot.Format) {
+            case RenderGraphFormatRgb565: format = GL_RGB565_OES; break;
+            case RenderGraphFormatDepth16: format = GL_DEPTH_COMPONENT16_OES; break;
+            case RenderGraphFormatDepth24: format = GL_DEPTH_COMPONENT24_OES; break;
+            case RenderGraphFormatStencil8: format = GL_STENCIL_INDEX8_OES; break;
+            default: break;
+        }
+        glGenRenderbuffersOES(1, &m_slots[i]);
+        glBindRenderbufferOES(GL_RENDERBUFFER_OES, m_slots[i]);
+        glRenderbufferStorageOES(GL_RENDERBUFFER_OES, format, slot.Width, slot.Height);
+    }
+
+    std::map<std::vector<int>, GLuint> framebuffers;
+    const std::vector<RenderGraphStep>& steps = m_graph.GetSteps();
+    for (size_t i = 0; i < steps.size(); ++i) {
+        const RenderGraphStep& step = steps[i];
+        std::vector<int> key;
+        for (size_t j = 0; j < step.Outputs.size(); ++j)
+            key.push_back(step.Outputs[j].Slot);
+        if (key.size() == 1 && key[0] < 0) {
+            assert(m_passes[step.Pass].Framebuffer && "Imported surfaces need an FBO.");
+            continue;
+        }
+        GLuint& framebuffer = framebuffers[key];
+        if (!framebuffer) {
+            glGenFramebuffersOES(1, &framebuffer);
+            glBindFramebufferOES(GL_FRAMEBUFFER_OES, framebuffer);
+            for (size_t j = 0; j < key.size(); ++j) {
+                assert(key[j] >= 0 && "Passes can't mix onscreen and offscreen outputs.");
+                const RenderGraphSlot& slot = slots[key[j]];
+                GLenum attachment = GetAttachment(slot.Format);
+                if (slot.Texture)
+                    glFramebufferTexture2DOES(GL_FRAMEBUFFER_OES, attachment, GL_TEXTURE_2D,
+                                              m_slots[key[j]], 0);
+                else
+                    glFramebufferRenderbufferOES(GL_FRAMEBUFFER_OES, attachment,
+                                                 GL_RENDERBUFFER_OES, m_slots[key[j]]);
+            }
+
+            // check FBO status
+            GLenum status = glCheckFramebufferStatusOES(GL_FRAMEBUFFER_OES);
+            if (status != GL_FRAMEBUFFER_COMPLETE_OES) {
+                cout << "Incomplete FBO" << endl;
+                exit(1);
+            }
+        }
+        m_passes[step.Pass].Framebuffer = framebuffer;
+    }
     glBindRenderbufferOES(GL_RENDERBUFFER_OES, m_renderbuffers.AccumulatedColor);
+}
+
+void RenderingEngine::Render(float objectTheta, float fboTheta) const
+{
+    PROFILE_ZONE("ES1::RenderingEngine::Render");
     glClearColor(0, 0, 0, 1);
-    glClear(GL_COLOR_BUFFER_BIT);
-    
-    for (int i = 0; i < JitterCount; i++) {
-        
-        glBindFramebufferOES(GL_FRAMEBUFFER_OES, m_framebuffers.Scene);
-        glBindRenderbufferOES(GL_RENDERBUFFER_OES, m_renderbuffers.SceneColor);
+    const std::vector<RenderGraphStep>& steps = m_graph.GetSteps();
+    if (!Progressive) {
+        for (size_t i = 0; i < steps.size(); ++i) {
+            const Pass& pass = m_passes[steps[i].Pass];
+            RenderStep(steps[i], objectTheta, fboTheta, m_offsets[pass.Sample]);
+        }
+        return;
+    }
 
-        RenderPass(objectTheta, fboTheta, JitterOffsets[i]);
-        
-        glMatrixMode(GL_PROJECTION);
-        glLoadIdentity();
-        
-        const float NearPlane = 5, FarPlane = 50;
-        glFrustumf(-0.5, 0.5, -0.5, 0.5, NearPlane, FarPlane);
-        
-        glMatrixMode(GL_MODELVIEW);
-        glLoadIdentity();
-        glTranslatef(0, 0, -NearPlane * 2);
-        
-        float f = 1.0f / JitterCount;
-        f *= (1 + abs(sin(fboTheta * Pi / 180)));
-        glColor4f(f, f, f, 1);
+    // Motion starts the history over, with as many samples as the budget
+    // allows so the animation stays smooth.  With a history limit, a
+    // spinning object only trims the history and adds a sample a frame.
+    int sampleCount = 1;
+    bool burst = false;
+    if (fboTheta != m_fboTheta) {
+        m_accumulator.Reset();
+        burst = true;
+    } else if (objectTheta != m_objectTheta) {
+        m_accumulator.Decay();
+        burst = !HistoryLimit;
+    }
+    if (burst)
+        sampleCount = m_budget.GetSampleCount();
+    m_objectTheta = objectTheta;
+    m_fboTheta = fboTheta;
+    if (m_accumulator.IsConverged())
+        sampleCount = 0;
+
+    uint64_t start = GetMonotonicNanoseconds();
+    for (int sample = 0; sample < sampleCount; ++sample) {
+        vec2 offset = m_offsets[m_accumulator.GetSampleIndex()];
+        for (size_t i = 0; i < steps.size(); ++i)
+            if (m_passes[steps[i].Pass].Kind != PassKindResolve)
+                RenderStep(steps[i], objectTheta, fboTheta, offset);
+        m_accumulator.Advance();
+    }
 
+    // Every so often, a burst waits for the GPU to find out how long its
+    // samples took.
+    if (burst && ++m_burstCount % BurstTimingInterval == 0) {
+        glFinish();
+        float milliseconds = (GetMonotonicNanoseconds() - start) / 1000000.0f;
+        m_budget.AddFrame(milliseconds, sampleCount);
+    }
+    for (size_t i = 0; i < steps.size(); ++i)
+        if (m_passes[steps[i].Pass].Kind == PassKindResolve)
+            RenderStep(steps[i], objectTheta, fboTheta, vec2(0, 0));
+}
+
+void RenderingEngine::RenderStep(const RenderGraphStep& step, float objectTheta,
+                                 float fboTheta, vec2 offset) const
+{
+    const std::vector<RenderGraphSlot>& slots = m_graph.GetSlots();
+    const Pass& pass = m_passes[step.Pass];
+    glBindFramebufferOES(GL_FRAMEBUFFER_OES, pass.Framebuffer);
+
+    // Attachments that the pass draws over completely start cleared,
+    // so a tiler needn't load what was there:
+    GLbitfield clear = 0;
+    for (size_t j = 0; j < step.Outputs.size(); ++j)
+        if (!step.Outputs[j].Load)
+            clear |= step.Outputs[j].Slot < 0 ? GL_COLOR_BUFFER_BIT :
+                     GetClearBit(slots[step.Outputs[j].Slot].Format);
+    if (clear)
+        glClear(clear);
+
+    // The brightness pulse that goes with the flip:
+    float brightness = 1 + abs(sin(fboTheta * Pi / 180));
+
+    if (pass.Kind == PassKindScene)
+        RenderPass(objectTheta, fboTheta, offset);
+
+    if (pass.Kind == PassKindAccumulate && !Progressive) {
+        float f = brightness / JitterCount;
+        glColor4f(f, f, f, 1);
         glEnable(GL_BLEND);
         glBlendFunc(GL_ONE, GL_ONE); 
-        glBindFramebufferOES(GL_FRAMEBUFFER_OES, m_framebuffers.Accumulated);
-        glBindRenderbufferOES(GL_RENDERBUFFER_OES, m_renderbuffers.AccumulatedColor);
-        glDisable(GL_DEPTH_TEST);
-        glBindTexture(GL_TEXTURE_2D, m_textures.OffscreenSurface);
-        RenderDrawable(m_drawables.Quad);
-        glDisable(GL_TEXTURE_2D);
+        RenderQuad(m_slots[m_graph.GetSlot(pass.Input)]);
+        glDisable(GL_BLEND);
+    }
+
+    // Blending with an alpha of 1 / n keeps the history at the mean of
+    // the n samples so far.  The alpha comes from the color alone, since
+    // the lit object leaves zero alpha in the scene.
+    if (pass.Kind == PassKindAccumulate && Progressive) {
+        glColor4f(1, 1, 1, m_accumulator.GetWeight());
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
+        glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_REPLACE);
+        glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_ALPHA, GL_REPLACE);
+        glTexEnvi(GL_TEXTURE_ENV, GL_SRC0_ALPHA, GL_PRIMARY_COLOR);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        RenderQuad(m_slots[m_graph.GetSlot(pass.Input)]);
         glDisable(GL_BLEND);
+        glTexEnvi(GL_TEXTURE_ENV, GL_SRC0_ALPHA, GL_TEXTURE);
+        glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_ALPHA, GL_MODULATE);
+        glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_MODULATE);
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+    }
+
+    // The brightness goes up to 2, past what a color can hold, so it's
+    // halved and the texture combiner doubles it back.
+    if (pass.Kind == PassKindResolve) {
+        glColor4f(brightness / 2, brightness / 2, brightness / 2, 1);
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
+        glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_MODULATE);
+        glTexEnvi(GL_TEXTURE_ENV, GL_RGB_SCALE, 2);
+        RenderQuad(m_textures.History);
+        glTexEnvi(GL_TEXTURE_ENV, GL_RGB_SCALE, 1);
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+        glColor4f(1, 1, 1, 1);
     }
+
+    // Nor need it store the ones that nothing samples afterwards:
+#ifdef GL_EXT_discard_framebuffer
+    GLenum discards[4];
+    GLsizei discardCount = 0;
+    for (size_t j = 0; j < step.Outputs.size() && discardCount < 4; ++j)
+        if (step.Outputs[j].Discard)
+            discards[discardCount++] = GetAttachment(slots[step.Outputs[j].Slot].Format);
+    if (discardCount)
+        glDiscardFramebufferEXT(GL_FRAMEBUFFER_OES, discardCount, discards);
+#endif
+}
+
+void RenderingEngine::RenderQuad(GLuint texture) const
+{
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    
+    const float NearPlane = 5, FarPlane = 50;
+    glFrustumf(-0.5, 0.5, -0.5, 0.5, NearPlane, FarPlane);
+    
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+    glTranslatef(0, 0, -NearPlane * 2);
+
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    RenderDrawable(m_drawables.Quad);
+    glDisable(GL_TEXTURE_2D);
 }
     
 void RenderingEngine::RenderPass(float objectTheta, float fboTheta, vec2 offset) const
 {
+    PROFILE_ZONE("ES1::RenderingEngine::RenderPass");
     // Tweak the jitter offset for the defocus effect:
     
     offset -= vec2(0.5, 0.5);
@@ -293,9 +553,7 @@ void RenderingEngine::RenderPass(float objectTheta, float fboTheta, vec2 offset)
     glLoadMatrixf(projection.Pointer());
     glMatrixMode(GL_MODELVIEW);
     
-    // Clear the back buffer and orient the scene.
-    glClearColor(0, 0, 0, 1);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    // Orient the scene; Render has already cleared the back buffer.
     glLoadIdentity();
     glTranslatef(0, 0, -10);
     glRotatef(20, 1, 0, 0);
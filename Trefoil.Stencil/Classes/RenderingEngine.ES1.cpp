@@ -3,6 +3,7 @@
 #include "Interfaces.hpp"
 #include "ParametricSurface.hpp"
 #include "Matrix.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <iostream>
 
 using namespace std;
@@ -155,6 +156,7 @@ void RenderingEngine::Initialize()
 
 void RenderingEngine::Render(float theta) const
 {
+    PROFILE_ZONE("ES1::RenderingEngine::Render");
     const float DiskY = -1.25f;
     const float KnotY = 0.75f;
 
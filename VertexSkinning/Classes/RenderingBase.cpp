@@ -1,7 +1,8 @@
 #include "RenderingBase.hpp"
-#include "../Textures/Circle.h"
-#include "../Textures/Tile.h"
+#include <OpenGLES/ES1/glext.h>
+#include "../../Common/Classes/PvrUpload.hpp"
 #include "../MotionCapture/StickFigure.h"
+#include <string>
 
 const vec3 Eye(0.5f, 1, 62);
 const vec3 Target(0.5f, 1, 0);
@@ -15,6 +16,8 @@ const float LineWidth = 0.03;
 
 extern const float LongMoCap[FrameCount][JointCount][3];
 
+std::string GetResourcePath(const std::string& file);
+
 void RenderingBase::Initialize(int maxBoneCount, VertexList& vertices, IndexList& indices)
 {
     // Create vertices for full-screen quad:
@@ -52,9 +55,17 @@ void RenderingBase::Initialize(int maxBoneCount, VertexList& vertices, IndexList
     ComputeMatrices(m_skeleton, m_skinnedFigure.Matrices);
     ExtrudeLines(m_skeleton, vertices, LineWidth);
     
-    // Load up some textures:
-    m_textures.Tile = CreateTexture(Tile);
-    m_textures.Circle = CreateTexture(Circle);
+    // Load up some textures.  The pack stays mapped, but once GL has a copy
+    // of each texture its pages can go.
+    std::string packPath = GetResourcePath("Textures.pack");
+    if (m_assets.Open(packPath.c_str()) != AssetPackErrorNone)
+        printf("%s: %s.\n", packPath.c_str(), AssetPack::GetErrorString(m_assets.GetError()));
+    AssetEntry tile = m_assets.Find("Tile");
+    AssetEntry circle = m_assets.Find("Circle");
+    m_textures.Tile = CreateTexture(tile.Data, tile.Size);
+    m_textures.Circle = CreateTexture(circle.Data, circle.Size);
+    m_assets.Release(tile);
+    m_assets.Release(circle);
 }
 
 void RenderingBase::AnimateSkeleton(float time, Skeleton& skeleton)
@@ -262,35 +273,24 @@ void RenderingBase::GenerateBoneData(VertexList& triangles, int maxBoneCount)
     }
 }
 
-GLuint RenderingBase::CreateTexture(const unsigned long* data)
+GLuint RenderingBase::CreateTexture(const void* data, size_t size)
 {
-    PVRTextureHeader* header = (PVRTextureHeader*) data;
-    GLsizei w = header->Width;
-    GLsizei h = header->Height;
-    const unsigned long* texels = data + header->HeaderSize / 4;
+    PvrTexture texture;
+    if (ParseTextureAsset(data, size, texture) != PvrErrorNone) {
+        printf("Bad texture: %s.\n", PvrTexture::GetErrorString(texture.GetError()));
+        return 0;
+    }
 
     GLuint name;
     glGenTextures(1, &name);
     glBindTexture(GL_TEXTURE_2D, name);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    bool mipmapped = texture.GetLevelCount() > 1;
+    GLenum minFilter = mipmapped ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    
-    switch (header->Flags & PVRTEX_PIXELTYPE) {
-        case OGL_I_8: {
-            GLenum format = GL_ALPHA;
-            GLenum type = GL_UNSIGNED_BYTE;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        case OGL_RGB_565: {
-            GLenum format = GL_RGB;
-            GLenum type = GL_UNSIGNED_SHORT_5_6_5;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, type, texels);
-            break;
-        }
-        default:
-            printf("Unknown format.\n");
-    }
+
+    if (!UploadPvrTexture(texture))
+        printf("Unknown format.\n");
 
     return name;
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include <OpenGLES/ES1/gl.h>
 #include "Matrix.hpp"
+#include "../../Common/Classes/AssetPack.hpp"
 #include <vector>
 
 extern const int JointCount;
@@ -9,20 +10,6 @@ extern const int BoneCount;
 extern const int FrameCount;
 extern const float LineWidth;
 
-struct PVRTextureHeader {
-    unsigned int HeaderSize;
-    unsigned int Height;
-    unsigned int Width;
-    unsigned int MipMapCount;
-    unsigned int Flags;
-};
-
-enum PVRPixelType {
-    OGL_RGB_565 = 0x13,
-    OGL_I_8 = 0x16,
-    PVRTEX_PIXELTYPE = 0xff,
-};
-
 struct Framebuffers {
     GLuint Screen;
 };
@@ -63,7 +50,7 @@ struct SkinnedFigure {
 class RenderingBase {
 protected:
     void Initialize(int maxBoneCount, VertexList& vertices, IndexList& indices);
-    GLuint CreateTexture(const unsigned long* data);
+    GLuint CreateTexture(const void* data, size_t size);
     void GenerateBoneData(VertexList& triangles, int maxBoneCount);
     void GenerateTexCoords(VertexList& triangles);
     void GenerateIndices(IndexList& triangles);
@@ -77,4 +64,5 @@ protected:
     VertexList m_backgroundVertices;
     Skeleton m_skeleton;
     SkinnedFigure m_skinnedFigure;
+    AssetPack m_assets;
 };
@@ -2,6 +2,7 @@
 #include <OpenGLES/ES1/glext.h>
 #include "Interfaces.hpp"
 #include "RenderingBase.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 
 // This file has a certain warning turned off: "-Wno-invalid-offsetof"
 // It's safe to use offsetof on non-POD types, as long as they're fairly simple.
@@ -78,12 +79,14 @@ void RenderingEngine::Initialize()
     
 void RenderingEngine::UpdateAnimation(float timestamp)
 {
+    PROFILE_ZONE("ES1::RenderingEngine::UpdateAnimation");
     AnimateSkeleton(timestamp, m_skeleton);
     ComputeMatrices(m_skeleton, m_skinnedFigure.Matrices);
 }
 
 void RenderingEngine::Render() const
 {
+    PROFILE_ZONE("ES1::RenderingEngine::Render");
     GLsizei stride = sizeof(Vertex);
 
     glMatrixMode(GL_PROJECTION);
@@ -2,6 +2,7 @@
 #include <OpenGLES/ES2/glext.h>
 #include "Interfaces.hpp"
 #include "RenderingBase.hpp"
+#include "../../Common/Classes/Profiler.hpp"
 #include <iostream>
 
 // This file has a certain warning turned off: "-Wno-invalid-offsetof"
@@ -104,12 +105,14 @@ void RenderingEngine::Initialize()
     
 void RenderingEngine::UpdateAnimation(float timestamp)
 {
+    PROFILE_ZONE("ES2::RenderingEngine::UpdateAnimation");
     AnimateSkeleton(timestamp, m_skeleton);
     ComputeMatrices(m_skeleton, m_skinnedFigure.Matrices);
 }
 
 void RenderingEngine::Render() const
 {
+    PROFILE_ZONE("ES2::RenderingEngine::Render");
     GLsizei stride = sizeof(Vertex);
     mat4 projection = mat4::Ortho(-1, 1, -1.5, 1.5, -100, 100);
 
@@ -1,30 +0,0 @@
-/********************************************************** 
- * PVRTexture Tool v 3.10 
- * PVRTC Library   v 1.106. 0. 0 Beta
- **********************************************************/
-
-#ifndef A32BIT 
- #define A32BIT static const unsigned long
-#endif
-
-A32BIT Circle[] = {
-
-/* Header */
-0x00000034,		/* dwHeaderSize */
-0x00000010,		/* dwHeight */
-0x00000010,		/* dwWidth */
-0x00000000,		/* dwMipMapCount */
-0x00010016,		/* dwpfFlags */
-0x00000100,		/* dwDataSize */
-0x00000008,		/* dwBitCount */
-0x000000ff,		/* dwRBitMask */
-0x000000ff,		/* dwGBitMask */
-0x000000ff,		/* dwBBitMask */
-0x00000000,		/* dwAlphaBitMask */
-0x21525650,		/* dwPVR */
-0x00000001,		/* dwNumSurfs */
-
-/* Data */
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x59300100,0x00003059,0x00000000,0x00000000,0xffffd953,0x4fd9ffff,0x00000000,0x7f000000,0xffffffff,0xffffffff,0x0000007e,0xff520000,0xe4ffffff,0xffffffe5,0x00004eff,0xffdc0100,0x8085ddff,0xffdd8680,0x0001d9ff,0xffff3300,0x808084fe,0xfe848080,0x0031ffff,0xffff5900,0x808080dd,0xdd808080,0x0058ffff,
-0xffff5a00,0x808080dd,0xdd808080,0x0058ffff,0xffff3400,0x808083fe,0xfe848080,0x0031ffff,0xffdd0100,0x8084daff,0xffdd8480,0x0001daff,0xff550000,0xe3ffffff,0xffffffe3,0x000051ff,0x80000000,0xffffffff,0xffffffff,0x00000080,0x00000000,0xffffdd54,0x53dbffff,0x00000000,0x00000000,0x5b310100,0x0001315b,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0 };
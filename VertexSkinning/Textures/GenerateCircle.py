@@ -41,10 +41,13 @@ alphaChannel = Image.open("Circle.png").split()[3]
 alphaChannel.save("Circle.png")
 showImage("Circle.png")
 
-# Convert to header files:
+# Cook and pack the textures:
 
 if True:
-    path = '/Users/prideout/Documents/PowerVR-ES2/Utilities/PVRTexTool/PVRTexToolCL/MacOS/'
-    system(path + 'PVRTexTool -h -yflip1 -fOGL8 -iCircle.png')
-    system(path + 'PVRTexTool -h -yflip1 -fOGL565 -iTile.png')
+    # Build with: g++ -O2 -o TextureCooker TextureCooker.cpp -lpng -lpthread
+    #             g++ -O2 -o AssetPacker AssetPacker.cpp
+    tools = '../../Common/Tools/'
+    system(tools + 'TextureCooker -f 8 -m none Circle.png Circle.pvr')
+    system(tools + 'TextureCooker -f 565 -m none Tile.png Tile.pvr')
+    system(tools + 'AssetPacker Textures.pack Circle.pvr Tile.pvr')
 